@@ -1,18 +1,339 @@
 
+#include <inc/x86.h>
+
 #include "fs.h"
 
+/* Chosen by fs_init() */
+const struct Disk *disk = &ide_disk;
+
+/* Adjacent blocks are read and written with a single
+ * disk command of up to this many blocks */
+#define BC_MAX_RUN (256 / BLKSECTS)
+
+struct DiskStat bc_stat;
+struct CacheStat bc_cache_stat;
+
+/* Blocks in memory, except the pinned ones, see bc_pinned().
+ * They are evicted with the CLOCK algorithm when the cache
+ * grows over BC_MAX_BLOCKS blocks: bs_ref and the accessed
+ * bit give a block a second chance */
+struct bc_slot {
+    blockno_t bs_blockno; /* 0 if the slot is free */
+    bool bs_ref;          /* Set when the block is read in */
+};
+
+static struct bc_slot bc_slots[BC_MAX_BLOCKS];
+static uint32_t bc_free_slots[BC_MAX_BLOCKS];
+static size_t bc_nfree;
+static size_t bc_hand;
+
+/* Blocks are read ahead here and moved to their place in the cache
+ * when the read completes. Until then accesses to them fault and
+ * wait for it in bc_pgfault() */
+#define BC_RA_VA 0x0D000000
+
+/* Readahead in flight, n is 0 if there is none */
+static struct {
+    blockno_t start;
+    size_t n;
+} bc_ra;
+
+/* Blocks modified since the last writeback (see bc_mark_dirty()),
+ * bc_dirty_map tells which blocks are on the list. Blocks which
+ * don't fit are found by bc_sync() scanning the cache */
+#define BC_DIRTY_MAX 1024
+
+static blockno_t bc_dirty_list[BC_DIRTY_MAX];
+static size_t bc_ndirty;
+static uint32_t bc_dirty_map[DISKSIZE / BLKSIZE / 32];
+static bool bc_dirty_overflow;
+
+/* Writeback starts when this many blocks are on the dirty list
+ * or BC_WRITEBACK_MS after the previous one */
+#define BC_DIRTY_THRESHOLD 256
+#define BC_WRITEBACK_MS    1000
+
+static uint64_t bc_writeback_tsc;
+
+/* Dirty blocks queued by flush_block_deferred() */
+static struct {
+    blockno_t start;
+    size_t n;
+} bc_wrun;
+
+static void *
+bc_addr(blockno_t blockno) {
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+}
+
+static bool
+bc_present(blockno_t blockno) {
+    return is_page_present(bc_addr(blockno));
+}
+
 /* Return the virtual address of this disk block. */
 void *
 diskaddr(uint32_t blockno) {
     if (blockno == 0 || (super && blockno >= super->s_nblocks))
         panic("bad block number %08x in diskaddr", blockno);
-    void *r = (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+    void *r = bc_addr(blockno);
 #ifdef SANITIZE_USER_SHADOW_BASE
     platform_asan_unpoison(r, BLKSIZE);
 #endif
+    if (bc_present(blockno)) bc_cache_stat.cs_hits++;
     return r;
 }
 
+/* The superblock and the bitmap are never evicted */
+static bool
+bc_pinned(blockno_t blockno) {
+    return blockno < 2 || (super && blockno < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE));
+}
+
+/* Start tracking a block which has just been read in */
+static void
+bc_track(blockno_t blockno) {
+    if (bc_pinned(blockno) || !bc_nfree) return;
+
+    struct bc_slot *s = &bc_slots[bc_free_slots[--bc_nfree]];
+    s->bs_blockno = blockno;
+    s->bs_ref = 1;
+    bc_cache_stat.cs_resident++;
+}
+
+static void
+bc_untrack(struct bc_slot *s) {
+    bc_free_slots[bc_nfree++] = s - bc_slots;
+    s->bs_blockno = 0;
+    bc_cache_stat.cs_resident--;
+}
+
+/* Write out the evicted blocks and unmap them */
+static void
+bc_unmap_victims(blockno_t *victims, size_t n) {
+    /* Dirty victims are queued with flush_block_deferred() */
+    flush_commit();
+
+    for (size_t i = 0; i < n; i++)
+        scring_unmap_region(CURENVID, bc_addr(victims[i]), BLKSIZE);
+    flush_commit();
+}
+
+/* Evict blocks until need more blocks fit into the cache.
+ * Blocks passed to flush_block_deferred() are written out first */
+static void
+bc_evict(size_t need) {
+    size_t reserved = bc_cache_stat.cs_resident + bc_ra.n;
+    if (reserved + need <= BC_MAX_BLOCKS) return;
+
+    blockno_t victims[BC_MAX_RUN];
+    size_t nvictims = 0;
+
+    flush_commit();
+
+    /* Accessed bits cleared in one revolution only become visible after
+     * the ring is submitted, every block is a victim by the third one */
+    for (size_t step = 1; step <= 3 * BC_MAX_BLOCKS; step++) {
+        if (bc_cache_stat.cs_resident + bc_ra.n + need <= BC_MAX_BLOCKS) break;
+        if (!(step % BC_MAX_BLOCKS)) flush_commit();
+
+        struct bc_slot *s = &bc_slots[bc_hand];
+        bc_hand = (bc_hand + 1) % BC_MAX_BLOCKS;
+        if (!s->bs_blockno) continue;
+
+        void *addr = bc_addr(s->bs_blockno);
+        pte_t pte = get_uvpt_entry(addr);
+        if (!(pte & PTE_P)) {
+            bc_untrack(s);
+            continue;
+        }
+
+        if (s->bs_ref || (pte & PTE_A)) {
+            /* Second chance. Remapping clears both accessed and dirty bits */
+            s->bs_ref = 0;
+            if (pte & PTE_D)
+                flush_block_deferred(addr);
+            else if (pte & PTE_A)
+                scring_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, get_prot(addr));
+            continue;
+        }
+
+        if (pte & PTE_D) flush_block_deferred(addr);
+        victims[nvictims++] = s->bs_blockno;
+        bc_untrack(s);
+        bc_cache_stat.cs_evictions++;
+
+        if (nvictims == BC_MAX_RUN) {
+            bc_unmap_victims(victims, nvictims);
+            nvictims = 0;
+        }
+    }
+
+    bc_unmap_victims(victims, nvictims);
+}
+
+static bool
+bc_ra_overlaps(blockno_t blockno, size_t n) {
+    return bc_ra.n && blockno < bc_ra.start + bc_ra.n && bc_ra.start < blockno + n;
+}
+
+/* Complete the readahead in flight and map its blocks into the cache,
+ * sleeping until the data is there if wait is set. Returns -E_AGAIN
+ * if the read is not done and wait is not set */
+static int
+bc_ra_complete(bool wait) {
+    if (!bc_ra.n) return 0;
+
+    int res = disk->finish(wait);
+    if (res == -E_AGAIN) return res;
+
+    /* Blocks of a failed read are left to fault in again */
+    if (res >= 0) {
+        res = sys_map_region(CURENVID, (void *)BC_RA_VA, CURENVID, bc_addr(bc_ra.start), bc_ra.n * BLKSIZE, PROT_RW);
+        if (res < 0) panic("bc_ra_complete.sys_map_region failed: %i\n", res);
+        for (size_t i = 0; i < bc_ra.n; i++)
+            bc_track(bc_ra.start + i);
+    }
+    sys_unmap_region(CURENVID, (void *)BC_RA_VA, bc_ra.n * BLKSIZE);
+    bc_ra.n = 0;
+    return 0;
+}
+
+/* Read n blocks starting at blockno which are not in memory */
+static void
+bc_read_run(blockno_t blockno, size_t n) {
+    void *addr = bc_addr(blockno);
+
+    /* The disk handles one command at a time */
+    bc_ra_complete(1);
+    bc_evict(n);
+
+    int res = sys_alloc_region(CURENVID, addr, n * BLKSIZE, PROT_RW);
+    if (res < 0) panic("bc_read_run.sys_alloc_region failed: %i\n", res);
+
+    res = disk->read(blockno * BLKSECTS, addr, n * BLKSECTS);
+    if (res < 0) panic("bc_read_run: disk read failed: %i\n", res);
+
+    bc_stat.ds_reads++;
+    bc_stat.ds_read_blocks += n;
+    for (size_t i = 0; i < n; i++)
+        bc_track(blockno + i);
+}
+
+/* Start reading n blocks starting at blockno which are not in memory
+ * into the readahead slot, which must be free. Returns false if the disk
+ * can't read asynchronously, the blocks have been read already then */
+static bool
+bc_read_start(blockno_t blockno, size_t n) {
+    int res = sys_alloc_region(CURENVID, (void *)BC_RA_VA, n * BLKSIZE, PROT_RW);
+    if (res < 0) panic("bc_read_start.sys_alloc_region failed: %i\n", res);
+
+    res = disk->read_start(blockno * BLKSECTS, (void *)BC_RA_VA, n * BLKSECTS);
+    if (res == -E_NOT_SUPP) {
+        /* Programmed I/O, read synchronously */
+        sys_unmap_region(CURENVID, (void *)BC_RA_VA, n * BLKSIZE);
+        bc_read_run(blockno, n);
+        return 0;
+    }
+    if (res < 0) panic("bc_read_start: disk read failed: %i\n", res);
+
+    bc_ra.start = blockno;
+    bc_ra.n = n;
+    bc_stat.ds_reads++;
+    bc_stat.ds_read_blocks += n;
+    return 1;
+}
+
+/* Returns true if a read started with bc_read_start() is still
+ * in flight, otherwise its blocks are in the cache. Never sleeps */
+bool
+bc_busy(void) {
+    return bc_ra_complete(0) == -E_AGAIN;
+}
+
+/* bc_load() called from a file server thread: missing blocks are read
+ * through the readahead slot and the thread yields while the disk is
+ * busy, so that requests for cached data are served meanwhile. Blocks
+ * evicted or lost to a failed read before the thread gets to them
+ * fault in again synchronously, see bc_pgfault() */
+static void
+bc_load_async(blockno_t blockno, blockno_t end) {
+    while (blockno < end) {
+        if (bc_present(blockno)) {
+            blockno++;
+            continue;
+        }
+        if (bc_busy()) {
+            thread_yield();
+            continue;
+        }
+
+        size_t run = 1;
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+            run++;
+
+        bc_evict(run);
+        bc_cache_stat.cs_misses += run;
+        if (bc_read_start(blockno, run)) {
+            do thread_yield();
+            while (bc_busy());
+        }
+        blockno += run;
+    }
+}
+
+/* Bring blocks [blockno, blockno + n) into memory, adjacent
+ * blocks which are not there yet are read together */
+void
+bc_load(blockno_t blockno, size_t n) {
+    blockno_t end = blockno + n;
+    if (super) end = MIN(end, super->s_nblocks);
+    if (thread_current() && disk->irq() >= 0) {
+        bc_load_async(blockno, end);
+        return;
+    }
+    if (bc_ra_overlaps(blockno, end - blockno)) bc_ra_complete(1);
+
+    while (blockno < end) {
+        if (bc_present(blockno)) {
+            blockno++;
+            continue;
+        }
+
+        size_t run = 1;
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+            run++;
+
+        bc_read_run(blockno, run);
+        bc_cache_stat.cs_misses += run;
+        blockno += run;
+    }
+}
+
+/* Start reading blocks [blockno, blockno + n) into the cache without
+ * waiting for them. Only the first run of missing blocks is read and
+ * only if no other readahead is in flight. Returns the number of
+ * blocks from blockno on that are in the cache or being read */
+size_t
+bc_readahead(blockno_t blockno, size_t n) {
+    if (super) n = MIN(n, super->s_nblocks - MIN(blockno, super->s_nblocks));
+    if (bc_ra_complete(0) < 0) return 0;
+
+    size_t i = 0;
+    while (i < n && bc_present(blockno + i))
+        i++;
+
+    size_t run = 0;
+    while (i + run < n && run < BC_MAX_RUN && !bc_present(blockno + i + run))
+        run++;
+    if (!run) return i;
+
+    bc_evict(run);
+    bc_cache_stat.cs_readahead += run;
+    bc_read_start(blockno + i, run);
+    return i + run;
+}
+
 /* Fault any disk block that is read in to memory by
  * loading it from disk. */
 static bool
@@ -32,15 +353,12 @@ bc_pgfault(struct UTrapframe *utf) {
      * Hint: first round addr to page boundary. fs/ide.c has code to read
      * the disk. */
     // LAB 10: Your code here
-    addr = ROUNDDOWN(addr, PAGE_SIZE);
-    int res = sys_alloc_region(CURENVID, addr, PAGE_SIZE, PROT_RW);
-    if (res < 0) {
-        panic("bc_pgfault.sys_alloc_region failed: %i\n", res);
-    }
-    res = ide_read(blockno * BLKSECTS, addr, BLKSECTS);
-    if (res < 0) {
-        panic("bc_pgfault.ide_read failed: %i\n", res);
+    if (bc_ra_overlaps(blockno, 1)) {
+        bc_ra_complete(1);
+        return 1;
     }
+    bc_read_run(blockno, 1);
+    bc_cache_stat.cs_misses++;
     return 1;
 }
 
@@ -48,11 +366,37 @@ bc_pgfault(struct UTrapframe *utf) {
  * necessary, then clear the PTE_D bit using sys_page_map.
  * If the block is not in the block cache or is not dirty, does
  * nothing.
- * Hint: Use is_page_present, is_page_dirty, and ide_write.
+ * Hint: Use is_page_present, is_page_dirty, and disk->write.
  * Hint: Use the PTE_SYSCALL constant when calling sys_page_map.
  * Hint: Don't forget to round addr down. */
 void
 flush_block(void *addr) {
+    flush_block_deferred(addr);
+    flush_commit();
+    assert(!is_page_dirty(ROUNDDOWN(addr, PAGE_SIZE)));
+}
+
+/* Write out the run of dirty blocks queued by flush_block_deferred() */
+static void
+bc_write_run(void) {
+    if (!bc_wrun.n) return;
+    bc_ra_complete(1);
+
+    int res = disk->write(bc_wrun.start * BLKSECTS, bc_addr(bc_wrun.start), bc_wrun.n * BLKSECTS);
+    if (res < 0) panic("flush_block: disk write failed: %i\n", res);
+
+    bc_stat.ds_writes++;
+    bc_stat.ds_write_blocks += bc_wrun.n;
+    bc_wrun.n = 0;
+}
+
+/* Same as flush_block(), but clearing of the dirty bit is only queued
+ * to the system call ring, so flushing of many blocks costs a single
+ * kernel entry. Blocks flushed in ascending order are also written
+ * with a single disk command. The block must not be modified before
+ * flush_commit(), otherwise the modification is lost. */
+void
+flush_block_deferred(void *addr) {
     blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
 
     if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
@@ -65,15 +409,133 @@ flush_block(void *addr) {
     if (!is_page_present(addr) || !is_page_dirty(addr)) {
         return;
     }
-    int res = ide_write(blockno * BLKSECTS, ROUNDDOWN(addr, PAGE_SIZE), BLKSECTS);
-    if (res < 0) {
-        panic("flush_block.ide_write failed: %i\n", res);
+    if (bc_wrun.n && (blockno != bc_wrun.start + bc_wrun.n || bc_wrun.n == BC_MAX_RUN))
+        bc_write_run();
+    if (!bc_wrun.n) bc_wrun.start = blockno;
+    bc_wrun.n++;
+
+    scring_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
+}
+
+/* Note that the block containing addr has been modified,
+ * so that the next writeback writes it out */
+void
+bc_mark_dirty(void *addr) {
+    blockno_t blockno = ((uintptr_t)addr - DISKMAP) / BLKSIZE;
+
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return;
+    if (TSTBIT(bc_dirty_map, blockno)) return;
+    if (bc_ndirty == BC_DIRTY_MAX) {
+        bc_dirty_overflow = 1;
+        return;
+    }
+    SETBIT(bc_dirty_map, blockno);
+    bc_dirty_list[bc_ndirty++] = blockno;
+}
+
+/* Drop freed block blockno from the cache. Clients may still map its
+ * page (see serve_map() and serve_read_map()), they keep the old data
+ * while whoever gets the block next starts with a page of its own.
+ * Calls queued to the ring still refer to the page, so the unmap
+ * is queued after them and the ring is submitted at once.
+ * Only blocks in memory are tracked, and frees are rare enough
+ * to look for the slot of the block by scanning them all */
+void
+bc_forget(blockno_t blockno) {
+    if (!bc_present(blockno)) return;
+    scring_unmap_region(CURENVID, bc_addr(blockno), BLKSIZE);
+    flush_commit();
+
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+        if (bc_slots[i].bs_blockno == blockno) {
+            bc_untrack(&bc_slots[i]);
+            break;
+        }
+    }
+}
+
+/* Shell sort, the list is short and mostly ascending */
+static void
+bc_sort(blockno_t *a, size_t n) {
+    for (size_t gap = n / 2; gap; gap /= 2) {
+        for (size_t i = gap; i < n; i++) {
+            blockno_t v = a[i];
+            size_t j = i;
+            for (; j >= gap && a[j - gap] > v; j -= gap)
+                a[j] = a[j - gap];
+            a[j] = v;
+        }
     }
-    res = sys_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
+}
+
+/* Write out the blocks on the dirty list in ascending order,
+ * so adjacent ones go to the disk with single commands */
+void
+bc_writeback(void) {
+    bc_sort(bc_dirty_list, bc_ndirty);
+
+    for (size_t i = 0; i < bc_ndirty; i++) {
+        CLRBIT(bc_dirty_map, bc_dirty_list[i]);
+        flush_block_deferred(bc_addr(bc_dirty_list[i]));
+    }
+    bc_ndirty = 0;
+    flush_commit();
+
+    bc_writeback_tsc = read_tsc();
+}
+
+/* Called by the server between requests */
+void
+bc_writeback_maybe(void) {
+    uint64_t khz = vsys[VSYS_tsc_khz];
+
+    if (bc_dirty_overflow)
+        bc_sync();
+    else if (bc_ndirty >= BC_DIRTY_THRESHOLD ||
+             (bc_ndirty && khz && read_tsc() - bc_writeback_tsc >= BC_WRITEBACK_MS * khz))
+        bc_writeback();
+}
+
+/* Put a block found dirty by bc_sync() on the dirty list */
+static void
+bc_sync_block(blockno_t blockno) {
+    if (bc_ndirty == BC_DIRTY_MAX) bc_writeback();
+    bc_mark_dirty(bc_addr(blockno));
+}
+
+/* Write out every dirty block. The dirty list may miss blocks when
+ * it overflows, so the pinned blocks and every block in the cache are
+ * checked too: the cost depends on the cache size, not on the disk size */
+void
+bc_sync(void) {
+    static blockno_t blocks[BC_MAX_BLOCKS];
+    size_t n = 0;
+
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+        blockno_t blockno = bc_slots[i].bs_blockno;
+        if (blockno && !TSTBIT(bc_dirty_map, blockno) && is_page_dirty(bc_addr(blockno)))
+            blocks[n++] = blockno;
+    }
+    bc_dirty_overflow = 0;
+
+    /* Strays are merged into the writeback */
+    for (blockno_t blockno = 1; bc_pinned(blockno); blockno++)
+        if (is_page_dirty(bc_addr(blockno))) bc_sync_block(blockno);
+    for (size_t i = 0; i < n; i++)
+        bc_sync_block(blocks[i]);
+    bc_writeback();
+}
+
+/* Write out blocks flushed by flush_block_deferred()
+ * and clear their dirty bits */
+void
+flush_commit(void) {
+    bc_write_run();
+
+    int res = scring_submit();
     if (res < 0) {
         panic("flush_block.sys_map_region failed: %i\n", res);
     }
-    assert(!is_page_dirty(addr));
 }
 
 /* Test that the block cache works, by smashing the superblock and
@@ -108,6 +570,11 @@ check_bc(void) {
 void
 bc_init(void) {
     struct Super super;
+
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++)
+        bc_free_slots[bc_nfree++] = BC_MAX_BLOCKS - 1 - i;
+    bc_cache_stat.cs_budget = BC_MAX_BLOCKS;
+
     add_pgfault_handler(bc_pgfault);
     check_bc();
 
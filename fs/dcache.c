@@ -0,0 +1,127 @@
+/* Path name lookup cache.
+ *
+ * Names are cached per directory, (dir, name) -> File, and whole
+ * paths as given to walk_path(), path -> (dir, File). A NULL File
+ * is a negative entry: the name is known not to exist. Both tables
+ * are direct-mapped, a colliding insert simply replaces the entry.
+ *
+ * File pointers point into the block cache, which keeps every block
+ * at a fixed address even when it is evicted, so they stay valid
+ * as long as the directory entry does. fs.c keeps the name cache
+ * exact on create and remove. A path depends on every component,
+ * so any change to a directory invalidates all cached paths by
+ * bumping dcache_gen */
+
+#include <inc/string.h>
+
+#include "fs.h"
+
+#define DCACHE_NAMES    512
+#define DCACHE_PATHS    128
+#define DCACHE_PATH_LEN 128 /* Longer paths are not cached */
+
+struct dcache_name {
+    struct File *dn_dir; /* NULL if the entry is free */
+    struct File *dn_file;
+    char dn_name[MAXNAMELEN];
+};
+
+struct dcache_path {
+    uint32_t dp_gen; /* Valid if equal to dcache_gen */
+    struct File *dp_dir;
+    struct File *dp_file;
+    uint16_t dp_last; /* Offset of the last component */
+    char dp_path[DCACHE_PATH_LEN];
+};
+
+static struct dcache_name dcache_names[DCACHE_NAMES];
+static struct dcache_path dcache_paths[DCACHE_PATHS];
+
+/* Starts at 1, so that zeroed entries are invalid */
+static uint32_t dcache_gen = 1;
+
+static uint32_t
+dcache_hash(const char *str, uint32_t seed) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261U ^ seed;
+    while (*str)
+        hash = (hash ^ (uint8_t)*str++) * 16777619U;
+    return hash;
+}
+
+static struct dcache_name *
+dcache_name_slot(struct File *dir, const char *name) {
+    uint32_t seed = (uint32_t)((uintptr_t)dir / sizeof(struct File));
+    return &dcache_names[dcache_hash(name, seed * 2654435761U) % DCACHE_NAMES];
+}
+
+/* Look name up in directory dir. Returns true and sets *pf
+ * if the cache knows the answer, *pf is NULL if there
+ * is no such name */
+bool
+dcache_lookup(struct File *dir, const char *name, struct File **pf) {
+    struct dcache_name *dn = dcache_name_slot(dir, name);
+    if (dn->dn_dir != dir || strcmp(dn->dn_name, name)) return 0;
+
+    *pf = dn->dn_file;
+    return 1;
+}
+
+/* Remember that name in dir is f, or that there is no such name if f is NULL */
+void
+dcache_insert(struct File *dir, const char *name, struct File *f) {
+    struct dcache_name *dn = dcache_name_slot(dir, name);
+    dn->dn_dir = dir;
+    dn->dn_file = f;
+    strcpy(dn->dn_name, name);
+}
+
+/* Same as dcache_insert(), but called when name has been
+ * created or removed, so cached paths are invalidated */
+void
+dcache_update(struct File *dir, const char *name, struct File *f) {
+    dcache_insert(dir, name, f);
+    dcache_gen++;
+}
+
+/* Forget all names in dir, which is being removed */
+void
+dcache_forget_dir(struct File *dir) {
+    for (size_t i = 0; i < DCACHE_NAMES; i++)
+        if (dcache_names[i].dn_dir == dir) dcache_names[i].dn_dir = NULL;
+    dcache_gen++;
+}
+
+/* Look path up. Returns true if the cache knows the answer, then
+ * *pdir is the directory of the file and *pf is the file itself
+ * or NULL if there is no such file in *pdir. In the latter case
+ * the last component of path is copied to lastelem, if not NULL */
+bool
+dcache_path_lookup(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+    struct dcache_path *dp = &dcache_paths[dcache_hash(path, 0) % DCACHE_PATHS];
+    if (dp->dp_gen != dcache_gen || strcmp(dp->dp_path, path)) return 0;
+
+    *pdir = dp->dp_dir;
+    *pf = dp->dp_file;
+    if (!*pf && lastelem) {
+        const char *last = path + dp->dp_last;
+        size_t len = strfind(last, '/') - last;
+        memmove(lastelem, last, len);
+        lastelem[len] = '\0';
+    }
+    return 1;
+}
+
+/* Remember the result of looking path up, see dcache_path_lookup().
+ * last is the offset of the last component of path */
+void
+dcache_path_insert(const char *path, struct File *dir, struct File *f, size_t last) {
+    if (strlen(path) >= DCACHE_PATH_LEN) return;
+
+    struct dcache_path *dp = &dcache_paths[dcache_hash(path, 0) % DCACHE_PATHS];
+    dp->dp_gen = dcache_gen;
+    dp->dp_dir = dir;
+    dp->dp_file = f;
+    dp->dp_last = last;
+    strcpy(dp->dp_path, path);
+}
@@ -8,6 +8,11 @@ struct Super *super;
 /* Bitmap blocks mapped in memory */
 uint32_t *bitmap;
 
+/* Allocation accelerator, kept in memory only: free blocks
+ * per bitmap block and where the previous allocation ended */
+static uint32_t bitmap_nfree[DISKSIZE / BLKSIZE / BLKBITSIZE];
+static blockno_t alloc_cursor;
+
 /****************************************************************
  *                         Super block
  ****************************************************************/
@@ -42,32 +47,72 @@ void
 free_block(uint32_t blockno) {
     /* Blockno zero is the null pointer of block numbers. */
     if (blockno == 0) panic("attempt to free zero block");
+    if (!TSTBIT(bitmap, blockno)) bitmap_nfree[blockno / BLKBITSIZE]++;
     SETBIT(bitmap, blockno);
+    bc_mark_dirty(&bitmap[blockno / 32]);
+    bc_forget(blockno);
+}
+
+/* First free block in [start, end), 0 if there is none.
+ * Bitmap blocks without free blocks are skipped as a whole,
+ * the others are scanned a word at a time */
+static blockno_t
+alloc_scan(blockno_t start, blockno_t end) {
+    for (blockno_t blockno = start; blockno < end;) {
+        if (!bitmap_nfree[blockno / BLKBITSIZE]) {
+            blockno = ROUNDDOWN(blockno, BLKBITSIZE) + BLKBITSIZE;
+            continue;
+        }
+
+        uint32_t word = bitmap[blockno / 32] & (~0U << (blockno % 32));
+        if (word) {
+            blockno = ROUNDDOWN(blockno, 32) + __builtin_ctz(word);
+            return blockno < end ? blockno : 0;
+        }
+        blockno = ROUNDDOWN(blockno, 32) + 32;
+    }
+    return 0;
 }
 
 /* Search the bitmap for a free block and allocate it.  When you
  * allocate a block, immediately flush the changed bitmap block
  * to disk.
  *
- * Return block number allocated on success,
- * 0 if we are out of blocks.
+ * The search starts at hint, so that blocks of a file are placed
+ * one after another, or where the previous allocation ended if
+ * hint is 0.
  *
- * Hint: use free_block as an example for manipulating the bitmap. */
+ * Return block number allocated on success,
+ * 0 if we are out of blocks. */
+blockno_t
+alloc_block_near(blockno_t hint) {
+    if (!hint || hint >= super->s_nblocks) hint = alloc_cursor;
+
+    blockno_t blockno = alloc_scan(hint, super->s_nblocks);
+    if (!blockno) blockno = alloc_scan(1, hint);
+    if (!blockno) return 0;
+
+    CLRBIT(bitmap, blockno);
+    bitmap_nfree[blockno / BLKBITSIZE]--;
+    alloc_cursor = blockno + 1;
+    flush_block(&bitmap[blockno / 32]);
+    return blockno;
+}
+
 blockno_t
 alloc_block(void) {
-    /* The bitmap consists of one or more blocks.  A single bitmap block
-     * contains the in-use bits for BLKBITSIZE blocks.  There are
-     * super->s_nblocks blocks in the disk altogether. */
-
-    // LAB 10: Your code here
-	for (blockno_t blockno = 1; blockno < super->s_nblocks; blockno++) {
-        if (block_is_free(blockno)) {
-            CLRBIT(bitmap, blockno);
-            flush_block(&bitmap[blockno / 32]);
-            return blockno;
-        }
+    return alloc_block_near(0);
+}
+
+/* Count free blocks of every bitmap block */
+static void
+alloc_init(void) {
+    for (blockno_t blockno = 0; blockno < super->s_nblocks; blockno += 32) {
+        uint32_t word = bitmap[blockno / 32];
+        if (super->s_nblocks - blockno < 32) word &= (1U << (super->s_nblocks - blockno)) - 1;
+        bitmap_nfree[blockno / BLKBITSIZE] += __builtin_popcount(word);
     }
-    return 0;
+    alloc_cursor = 1;
 }
 
 /* Validate the file system bitmap.
@@ -98,11 +143,17 @@ void
 fs_init(void) {
     static_assert(sizeof(struct File) == 256, "Unsupported file size");
 
-    /* Find a JOS disk.  Use the second IDE disk (number 1) if availabl */
-    if (ide_probe_disk1())
-        ide_set_disk(1);
-    else
-        ide_set_disk(0);
+    /* Find a JOS disk. A virtio disk is only attached for the
+     * file system, otherwise use the second IDE disk (number 1) if available */
+    if (virtio_blk_init()) {
+        disk = &virtio_disk;
+    } else {
+        if (ide_probe_disk1())
+            ide_set_disk(1);
+        else
+            ide_set_disk(0);
+        ide_dma_init();
+    }
     bc_init();
 
     /* Set "super" to point to the super block. */
@@ -113,74 +164,331 @@ fs_init(void) {
     bitmap = diskaddr(2);
 
     check_bitmap();
+    alloc_init();
 }
 
-/* Find the disk block number slot for the 'filebno'th block in file 'f'.
- * Set '*ppdiskbno' to point to that slot.
- * The slot will be one of the f->f_direct[] entries,
- * or an entry in the indirect block.
- * When 'alloc' is set, this function will allocate an indirect block
+/* Allocate a zeroed indirect block, 0 if the disk is full */
+static blockno_t
+file_alloc_indirect(void) {
+    blockno_t block = alloc_block();
+    if (!block) return 0;
+
+    memset(diskaddr(block), 0, BLKSIZE);
+    bc_mark_dirty(diskaddr(block));
+    return block;
+}
+
+/* Find the disk block number slot for the 'filebno'th block in file 'f'
+ * in the indirect blocks. Set '*ppdiskbno' to point to that slot.
+ * The slot will be an entry in the indirect block for filebno below
+ * NINDIRECT, or in a block the double-indirect block points to.
+ * When 'alloc' is set, this function will allocate indirect blocks
  * if necessary.
  *
+ * Blocks mapped by the extents have slots too but those are unused,
+ * see file_block_map().
+ *
  * Returns:
  *  0 on success (but note that *ppdiskbno might equal 0).
  *  -E_NOT_FOUND if the function needed to allocate an indirect block, but
  *      alloc was 0.
  *  -E_NO_DISK if there's no space on the disk for an indirect block.
- *  -E_INVAL if filebno is out of range (it's >= NDIRECT + NINDIRECT).
+ *  -E_INVAL if filebno is out of range (it's >= MAXFILEBLOCKS).
  *
- * Analogy: This is like pgdir_walk for files.
- * Hint: Don't forget to clear any block you allocate. */
+ * Analogy: This is like pgdir_walk for files. */
 int
 file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
-    // LAB 10: Your code here
-    if (filebno >= NDIRECT + NINDIRECT) {
-        return -E_INVAL;
+    if (filebno >= MAXFILEBLOCKS) return -E_INVAL;
+
+    if (filebno < NINDIRECT) {
+        if (!f->f_indirect) {
+            if (!alloc) return -E_NOT_FOUND;
+            if (!(f->f_indirect = file_alloc_indirect())) return -E_NO_DISK;
+            bc_mark_dirty(f);
+        }
+        *ppdiskbno = (blockno_t *)diskaddr(f->f_indirect) + filebno;
+        return 0;
     }
-    if (filebno < NDIRECT) {
-		*ppdiskbno = (uint32_t*)f->f_direct + filebno;
-    } else {
-		if (!f->f_indirect) {
-			if (!alloc) {
-				return -E_NOT_FOUND;
-			}
-			blockno_t block = alloc_block();
-			if (!block) {
-				return -E_NO_DISK;
-			}
-			f->f_indirect = block;
-			memset(diskaddr(f->f_indirect), 0, BLKSIZE);
-		}
-		*ppdiskbno = (uint32_t *)diskaddr(f->f_indirect) + filebno - NDIRECT;
-	}
+
+    filebno -= NINDIRECT;
+    if (!f->f_dindirect) {
+        if (!alloc) return -E_NOT_FOUND;
+        if (!(f->f_dindirect = file_alloc_indirect())) return -E_NO_DISK;
+        bc_mark_dirty(f);
+    }
+
+    blockno_t *dind = diskaddr(f->f_dindirect);
+    blockno_t *slot = &dind[filebno / NINDIRECT];
+    if (!*slot) {
+        if (!alloc) return -E_NOT_FOUND;
+        if (!(*slot = file_alloc_indirect())) return -E_NO_DISK;
+        bc_mark_dirty(slot);
+    }
+    *ppdiskbno = (blockno_t *)diskaddr(*slot) + filebno % NINDIRECT;
+    return 0;
+}
+
+/* Number of file blocks mapped by the extents of f.
+ * Sets *plast to the last extent in use, NULL if there is none */
+static blockno_t
+file_extent_blocks(struct File *f, struct Extent **plast) {
+    blockno_t nblocks = 0;
+
+    *plast = NULL;
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+        nblocks += ext->e_len;
+        *plast = ext;
+    }
+    return nblocks;
+}
+
+/* Set *pdiskbno to the disk block of the filebno'th block of f.
+ * Returns the number of blocks from filebno on known to follow it
+ * on disk, which is at least 1, or 0 if the block is not allocated.
+ * Returns -E_INVAL if filebno is out of range */
+int
+file_block_map(struct File *f, blockno_t filebno, blockno_t *pdiskbno) {
+    blockno_t base = 0;
+
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+        if (filebno - base < ext->e_len) {
+            *pdiskbno = ext->e_start + (filebno - base);
+            return MIN(ext->e_len - (filebno - base), INT32_MAX);
+        }
+        base += ext->e_len;
+    }
+
+    blockno_t *slot;
+    int res = file_block_walk(f, filebno, &slot, 0);
+    if (res == -E_NOT_FOUND) {
+        *pdiskbno = 0;
+        return 0;
+    }
+    if (res < 0) return res;
+
+    *pdiskbno = *slot;
+    return *slot != 0;
+}
+
+/* Allocate the filebno'th block of f and set *pdiskbno to it.
+ * A block appended right after the extents extends them, so that
+ * a file written sequentially ends up with a few long extents */
+static int
+file_alloc_block(struct File *f, blockno_t filebno, blockno_t *pdiskbno) {
+    struct Extent *last;
+    blockno_t nblocks = file_extent_blocks(f, &last);
+
+    if (filebno == nblocks && !f->f_indirect && !f->f_dindirect) {
+        struct Extent *next = last ? last + 1 : f->f_extent;
+        blockno_t hint = last ? last->e_start + last->e_len : 0;
+        bool grow = last && block_is_free(hint);
+
+        if (grow || next < f->f_extent + NEXTENT) {
+            blockno_t block = alloc_block_near(hint);
+            if (!block) return -E_NO_DISK;
+
+            if (grow) {
+                assert(block == hint);
+                last->e_len++;
+            } else {
+                next->e_start = block;
+                next->e_len = 1;
+            }
+            bc_mark_dirty(f);
+            *pdiskbno = block;
+            return 0;
+        }
+    }
+
+    blockno_t *slot;
+    int res = file_block_walk(f, filebno, &slot, 1);
+    if (res < 0) return res;
+
+    /* Place the block right after the previous one of the file */
+    blockno_t prev = 0;
+    if (filebno && file_block_map(f, filebno - 1, &prev) <= 0) prev = 0;
+
+    blockno_t block = alloc_block_near(prev ? prev + 1 : 0);
+    if (!block) return -E_NO_DISK;
+    *slot = block;
+    bc_mark_dirty(slot);
+    *pdiskbno = block;
     return 0;
 }
 
 /* Set *blk to the address in memory where the filebno'th
- * block of file 'f' would be mapped.
+ * block of file 'f' would be mapped, allocating the block
+ * if it is not there yet.
  *
  * Returns 0 on success, < 0 on error.  Errors are:
  *  -E_NO_DISK if a block needed to be allocated but the disk is full.
- *  -E_INVAL if filebno is out of range.
- *
- * Hint: Use file_block_walk and alloc_block. */
+ *  -E_INVAL if filebno is out of range. */
 int
 file_get_block(struct File *f, uint32_t filebno, char **blk) {
-    // LAB 10: Your code here
-    //if (filebno >= NDIRECT + NINDIRECT) {
-    //    return -E_INVAL;
-    //}
-    uint32_t *pdiskbno;
-    file_block_walk(f, filebno, &pdiskbno, 1);
-    if (!*pdiskbno) {
+    blockno_t diskbno;
+    int res = file_block_map(f, filebno, &diskbno);
+    if (res < 0) return res;
+
+    if (!res && (res = file_alloc_block(f, filebno, &diskbno)) < 0) return res;
+
+    *blk = (char *)diskaddr(diskbno);
+    return 0;
+}
+
+/* Directories of at least this many blocks get a hashed index */
+#define DIRINDEX_MIN_BLOCKS 4
+/* Average chain length above which the index is doubled */
+#define DIRINDEX_LOAD 2
+
+static uint32_t
+dir_hash(const char *name) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+    while (*name)
+        hash = (hash ^ (uint8_t)*name++) * 16777619U;
+    return hash;
+}
+
+/* The File in slot of dir, NULL if there is no such slot */
+static struct File *
+dir_slot(struct File *dir, uint32_t slot) {
+    char *blk;
+    if (slot >= dir->f_size / BLKSIZE * BLKFILES) return NULL;
+    if (file_get_block(dir, slot / BLKFILES, &blk) < 0) return NULL;
+    return (struct File *)blk + slot % BLKFILES;
+}
+
+static uint32_t *
+dir_index_bucket(struct DirIndex *idx, uint32_t hash) {
+    uint32_t bucket = hash & (idx->di_nblocks * DIRINDEX_NBUCKETS - 1);
+    uint32_t *blk = diskaddr(idx->di_buckets[bucket / DIRINDEX_NBUCKETS]);
+    return &blk[bucket % DIRINDEX_NBUCKETS];
+}
+
+/* Free the index of dir, lookups go back to scanning it */
+static void
+dir_index_drop(struct File *dir) {
+    if (!dir->f_dirindex) return;
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+    for (uint32_t i = 0; i < DIRINDEX_MAXBLOCKS; i++)
+        if (idx->di_buckets[i]) free_block(idx->di_buckets[i]);
+    free_block(dir->f_dirindex);
+    dir->f_dirindex = 0;
+    bc_mark_dirty(dir);
+}
+
+/* Build the index of dir from scratch with nblocks bucket blocks.
+ * The index is only an accelerator, if there is no space
+ * for it the directory is left without one */
+static void
+dir_index_build(struct File *dir, uint32_t nblocks) {
+    if (!dir->f_dirindex) {
         blockno_t block = alloc_block();
-        if (!block) {
-			return -E_NO_DISK;
-		}
-        *pdiskbno = block;
+        if (!block) return;
+        memset(diskaddr(block), 0, BLKSIZE);
+        dir->f_dirindex = block;
+        bc_mark_dirty(dir);
     }
-    *blk = (char *)diskaddr(*pdiskbno);
-    return 0;
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+    for (uint32_t i = 0; i < nblocks; i++) {
+        if (!idx->di_buckets[i] && !(idx->di_buckets[i] = alloc_block())) {
+            dir_index_drop(dir);
+            return;
+        }
+        memset(diskaddr(idx->di_buckets[i]), 0, BLKSIZE);
+        bc_mark_dirty(diskaddr(idx->di_buckets[i]));
+    }
+    idx->di_nblocks = nblocks;
+    idx->di_count = 0;
+    idx->di_free_hint = 0;
+
+    uint32_t nslots = dir->f_size / BLKSIZE * BLKFILES;
+    for (uint32_t slot = 0; slot < nslots; slot++) {
+        struct File *f = dir_slot(dir, slot);
+        if (!f || !f->f_name[0]) continue;
+
+        uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+        f->f_hnext = *bucket;
+        *bucket = slot + 1;
+        idx->di_count++;
+        bc_mark_dirty(f);
+    }
+    bc_mark_dirty(idx);
+}
+
+/* Add f, which is in slot of dir, to the index of dir.
+ * Builds the index when dir gets large and grows it
+ * when the chains get long */
+static void
+dir_index_add(struct File *dir, struct File *f, uint32_t slot) {
+    if (!dir->f_dirindex) {
+        if (dir->f_size / BLKSIZE >= DIRINDEX_MIN_BLOCKS) dir_index_build(dir, 1);
+        return;
+    }
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+    if (idx->di_count >= DIRINDEX_LOAD * DIRINDEX_NBUCKETS * idx->di_nblocks &&
+        idx->di_nblocks * 2 <= DIRINDEX_MAXBLOCKS) {
+        /* Rebuilding picks f up as well */
+        dir_index_build(dir, idx->di_nblocks * 2);
+        return;
+    }
+
+    uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+    f->f_hnext = *bucket;
+    *bucket = slot + 1;
+    idx->di_count++;
+    bc_mark_dirty(bucket);
+    bc_mark_dirty(idx);
+    bc_mark_dirty(f);
+}
+
+/* Remove f, which is in dir, from the index of dir */
+static void
+dir_index_remove(struct File *dir, struct File *f) {
+    if (!dir->f_dirindex) return;
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+    uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+    struct File *prev = NULL;
+    uint32_t next = *bucket;
+    for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+        uint32_t slot = next - 1;
+        struct File *cur = dir_slot(dir, slot);
+        if (!cur) break;
+
+        if (cur == f) {
+            if (prev) {
+                prev->f_hnext = f->f_hnext;
+                bc_mark_dirty(prev);
+            } else {
+                *bucket = f->f_hnext;
+                bc_mark_dirty(bucket);
+            }
+            idx->di_count--;
+            idx->di_free_hint = MIN(idx->di_free_hint, slot / BLKFILES);
+            bc_mark_dirty(idx);
+            return;
+        }
+        prev = cur;
+        next = cur->f_hnext;
+    }
+
+    /* Not there, the index is out of step with the directory */
+    dir_index_drop(dir);
+}
+
+/* Write out the index of dir */
+static void
+dir_index_flush(struct File *dir) {
+    if (!dir->f_dirindex) return;
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+    for (uint32_t i = 0; i < idx->di_nblocks; i++)
+        flush_block_deferred(diskaddr(idx->di_buckets[i]));
+    flush_block_deferred(idx);
 }
 
 /* Try to find a file named "name" in dir.  If so, set *file to it.
@@ -188,7 +496,26 @@ file_get_block(struct File *f, uint32_t filebno, char **blk) {
  * Returns 0 and sets *file on success, < 0 on error.  Errors are:
  *  -E_NOT_FOUND if the file is not found */
 static int
-dir_lookup(struct File *dir, const char *name, struct File **file) {
+dir_lookup_uncached(struct File *dir, const char *name, struct File **file) {
+    if (dir->f_dirindex) {
+        struct DirIndex *idx = diskaddr(dir->f_dirindex);
+        uint32_t next = *dir_index_bucket(idx, dir_hash(name));
+        for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+            struct File *f = dir_slot(dir, next - 1);
+            if (!f) break;
+            if (strcmp(f->f_name, name) == 0) {
+                *file = f;
+                return 0;
+            }
+            next = f->f_hnext;
+        }
+        if (!next) return -E_NOT_FOUND;
+
+        /* The chain is broken or loops, the index is
+         * out of step with the directory */
+        dir_index_drop(dir);
+    }
+
     /* Search dir for name.
      * We maintain the invariant that the size of a directory-file
      * is always a multiple of the file system's block size. */
@@ -209,31 +536,61 @@ dir_lookup(struct File *dir, const char *name, struct File **file) {
     return -E_NOT_FOUND;
 }
 
-/* Set *file to point at a free File structure in dir.  The caller is
- * responsible for filling in the File fields. */
+/* Same as dir_lookup_uncached(), but through the name cache */
 static int
-dir_alloc_file(struct File *dir, struct File **file) {
+dir_lookup(struct File *dir, const char *name, struct File **file) {
+    if (dcache_lookup(dir, name, file)) return *file ? 0 : -E_NOT_FOUND;
+
+    int res = dir_lookup_uncached(dir, name, file);
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+    return res;
+}
+
+/* Set *file to point at a free File structure in dir, clear it,
+ * name it "name" and add it to the index of dir. The caller is
+ * responsible for filling in the other File fields. */
+static int
+dir_alloc_file(struct File *dir, const char *name, struct File **file) {
     char *blk;
+    struct File *f = NULL;
 
     assert((dir->f_size % BLKSIZE) == 0);
     blockno_t nblock = dir->f_size / BLKSIZE;
-    for (blockno_t i = 0; i < nblock; i++) {
+    blockno_t i = 0;
+
+    /* Indexed directories know where the free slots may be */
+    struct DirIndex *idx = dir->f_dirindex ? diskaddr(dir->f_dirindex) : NULL;
+    if (idx) i = MIN(idx->di_free_hint, nblock);
+
+    for (; i < nblock && !f; i++) {
         int res = file_get_block(dir, i, &blk);
         if (res < 0) return res;
 
-        struct File *f = (struct File *)blk;
-        for (blockno_t j = 0; j < BLKFILES; j++) {
-            if (f[j].f_name[0] == '\0') {
-                *file = &f[j];
-                return 0;
-            }
-        }
+        for (blockno_t j = 0; j < BLKFILES && !f; j++)
+            if (((struct File *)blk)[j].f_name[0] == '\0') f = (struct File *)blk + j;
+    }
+    if (!f) {
+        dir->f_size += BLKSIZE;
+        bc_mark_dirty(dir);
+        int res = file_get_block(dir, nblock, &blk);
+        if (res < 0) return res;
+
+        /* The block may hold stale data */
+        memset(blk, 0, BLKSIZE);
+        f = (struct File *)blk;
+        i = nblock + 1;
+    }
+    if (idx) {
+        idx->di_free_hint = i - 1;
+        bc_mark_dirty(idx);
     }
-    dir->f_size += BLKSIZE;
-    int res = file_get_block(dir, nblock, &blk);
-    if (res < 0) return res;
 
-    *file = (struct File *)blk;
+    memset(f, 0, sizeof(*f));
+    strcpy(f->f_name, name);
+    bc_mark_dirty(f);
+    dcache_update(dir, name, f);
+    dir_index_add(dir, f, (i - 1) * BLKFILES + (f - (struct File *)ROUNDDOWN(f, BLKSIZE)));
+    *file = f;
     return 0;
 }
 
@@ -253,11 +610,22 @@ skip_slash(const char *p) {
  * element into lastelem. */
 static int
 walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
-    const char *p;
+    const char *p, *start = path;
     char name[MAXNAMELEN];
     struct File *dir, *f;
     int r;
 
+    if (pdir)
+        *pdir = 0;
+    *pf = 0;
+
+    if (dcache_path_lookup(start, &dir, &f, lastelem)) {
+        if (pdir)
+            *pdir = dir;
+        *pf = f;
+        return f ? 0 : -E_NOT_FOUND;
+    }
+
     //if (*path != '/')
     //    return -E_BAD_PATH;
     path = skip_slash(path);
@@ -265,9 +633,6 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
     dir = 0;
     name[0] = 0;
 
-    if (pdir)
-        *pdir = 0;
-    *pf = 0;
     while (*path != '\0') {
         dir = f;
         p = path;
@@ -289,6 +654,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
                 if (lastelem)
                     strcpy(lastelem, name);
                 *pf = 0;
+                dcache_path_insert(start, dir, NULL, p - start);
             }
             return r;
         }
@@ -297,6 +663,7 @@ walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem
     if (pdir)
         *pdir = dir;
     *pf = f;
+    dcache_path_insert(start, dir, f, 0);
     return 0;
 }
 
@@ -314,9 +681,8 @@ file_create(const char *path, struct File **pf) {
 
     if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
     if (res != -E_NOT_FOUND || dir == 0) return res;
-    if ((res = dir_alloc_file(dir, &filp)) < 0) return res;
+    if ((res = dir_alloc_file(dir, name, &filp)) < 0) return res;
 
-    strcpy(filp->f_name, name);
     *pf = filp;
     file_flush(dir);
     return 0;
@@ -329,6 +695,55 @@ file_open(const char *path, struct File **pf) {
     return walk_path(path, 0, pf, 0);
 }
 
+/* Bring blocks [first, end) of f into the block cache, blocks
+ * adjacent on disk are read with a single disk command */
+static void
+file_load_blocks(struct File *f, blockno_t first, blockno_t end) {
+    blockno_t start = 0, n = 0;
+
+    for (blockno_t i = first; i < end;) {
+        blockno_t diskbno;
+        int run = file_block_map(f, i, &diskbno);
+        if (run <= 0) break;
+        run = MIN(run, end - i);
+        i += run;
+
+        if (n && diskbno == start + n) {
+            n += run;
+            continue;
+        }
+        if (n) bc_load(start, n);
+        start = diskbno;
+        n = run;
+    }
+    if (n) bc_load(start, n);
+}
+
+/* Start reading blocks [first, end) of f into the block cache without
+ * waiting for them, see bc_readahead(). Returns the file block up to
+ * which that has been done */
+blockno_t
+file_readahead(struct File *f, blockno_t first, blockno_t end) {
+    blockno_t i = first;
+
+    while (i < end) {
+        blockno_t start;
+        int run = file_block_map(f, i, &start);
+        if (run <= 0) break;
+
+        /* Blocks adjacent on disk */
+        blockno_t n = MIN(run, end - i), next;
+        while (i + n < end && (run = file_block_map(f, i + n, &next)) > 0 && next == start + n)
+            n += MIN(run, end - i - n);
+
+        blockno_t done = bc_readahead(start, n);
+        i += done;
+        if (done < n) break;
+    }
+
+    return i;
+}
+
 /* Read count bytes from f into buf, starting from seek position
  * offset.  This meant to mimic the standard pread function.
  * Returns the number of bytes read, < 0 on error. */
@@ -340,6 +755,12 @@ file_read(struct File *f, void *buf, size_t count, off_t offset) {
         return 0;
 
     count = MIN(count, f->f_size - offset);
+    file_load_blocks(f, offset / BLKSIZE, CEILDIV(offset + count, BLKSIZE));
+
+    /* Other requests run while the blocks are read, see bc_load(),
+     * and the file may have been truncated meanwhile */
+    if (offset >= f->f_size) return 0;
+    count = MIN(count, f->f_size - offset);
 
     for (off_t pos = offset; pos < offset + count;) {
         int r = file_get_block(f, pos / BLKSIZE, &blk);
@@ -362,6 +783,8 @@ ssize_t
 file_write(struct File *f, const void *buf, size_t count, off_t offset) {
     int res;
 
+    if (offset < 0 || offset + count > MAXFILESIZE) return -E_INVAL;
+
     /* Extend file if necessary */
     if (offset + count > f->f_size)
         if ((res = file_set_size(f, offset + count)) < 0) return res;
@@ -372,6 +795,7 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
 
         uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
         memmove(blk + pos % BLKSIZE, buf, bn);
+        bc_mark_dirty(blk);
         pos += bn;
         buf += bn;
     }
@@ -379,42 +803,74 @@ file_write(struct File *f, const void *buf, size_t count, off_t offset) {
     return count;
 }
 
-/* Remove a block from file f.  If it's not there, just silently succeed.
+/* Remove a block mapped by the indirect blocks from file f.
+ * If it's not there, just silently succeed.
  * Returns 0 on success, < 0 on error. */
 static int
 file_free_block(struct File *f, uint32_t filebno) {
     blockno_t *ptr;
     int res = file_block_walk(f, filebno, &ptr, 0);
+    if (res == -E_NOT_FOUND) return 0;
     if (res < 0) return res;
 
     if (*ptr) {
         free_block(*ptr);
         *ptr = 0;
+        bc_mark_dirty(ptr);
     }
     return 0;
 }
 
 /* Remove any blocks currently used by file 'f',
  * but not necessary for a file of size 'newsize'.
- * For both the old and new sizes, figure out the number of blocks required,
- * and then clear the blocks from new_nblocks to old_nblocks.
- * If the new_nblocks is no more than NDIRECT, and the indirect block has
- * been allocated (f->f_indirect != 0), then free the indirect block too.
- * (Remember to clear the f->f_indirect pointer so you'll know
- * whether it's valid!)
+ * Blocks mapped by the indirect blocks go first, then the extents
+ * are cut down. Indirect blocks that no longer map anything are
+ * freed as well and their pointers are cleared.
  * Do not change f->f_size. */
 static void
 file_truncate_blocks(struct File *f, off_t newsize) {
     blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
     blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
-    for (blockno_t bno = new_nblocks; bno < old_nblocks; bno++) {
+    struct Extent *last;
+    blockno_t ext_nblocks = file_extent_blocks(f, &last);
+
+    for (blockno_t bno = MAX(new_nblocks, ext_nblocks); bno < old_nblocks; bno++) {
         int res = file_free_block(f, bno);
         if (res < 0) cprintf("warning: file_free_block: %i", res);
     }
 
-    if (new_nblocks <= NDIRECT && f->f_indirect) {
+    if (f->f_dindirect) {
+        bool drop = new_nblocks <= MAX(ext_nblocks, NINDIRECT);
+        blockno_t *dind = diskaddr(f->f_dindirect);
+        for (blockno_t i = 0; i < NINDIRECT; i++) {
+            if (!dind[i] || (!drop && NINDIRECT + i * NINDIRECT < new_nblocks)) continue;
+            free_block(dind[i]);
+            dind[i] = 0;
+            bc_mark_dirty(dind);
+        }
+        if (drop) {
+            free_block(f->f_dindirect);
+            f->f_dindirect = 0;
+            bc_mark_dirty(f);
+        }
+    }
+
+    if (f->f_indirect && new_nblocks <= ext_nblocks) {
         free_block(f->f_indirect);
         f->f_indirect = 0;
+        bc_mark_dirty(f);
+    }
+
+    blockno_t base = 0;
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+        blockno_t keep = new_nblocks > base ? MIN(new_nblocks - base, ext->e_len) : 0;
+        for (blockno_t i = keep; i < ext->e_len; i++)
+            free_block(ext->e_start + i);
+        if (keep < ext->e_len) bc_mark_dirty(f);
+
+        base += ext->e_len;
+        ext->e_len = keep;
+        if (!keep) ext->e_start = 0;
     }
 }
 
@@ -428,29 +884,87 @@ file_set_size(struct File *f, off_t newsize) {
     return 0;
 }
 
+/* Flush f and the allocation state it depends on out to disk */
+void
+file_fsync(struct File *f) {
+    for (blockno_t i = 2; i < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE); i++)
+        flush_block_deferred(diskaddr(i));
+    file_flush(f);
+}
+
 /* Flush the contents and metadata of file f out to disk.
  * Loop over all the blocks in file.
  * Translate the file block number into a disk block number
  * and then check whether that disk block is dirty.  If so, write it out. */
 void
 file_flush(struct File *f) {
-    blockno_t *pdiskbno;
-
-    for (blockno_t i = 0; i < CEILDIV(f->f_size, BLKSIZE); i++) {
-        if (file_block_walk(f, i, &pdiskbno, 0) < 0 ||
-            pdiskbno == NULL || *pdiskbno == 0)
-            continue;
-        flush_block(diskaddr(*pdiskbno));
+    blockno_t nblocks = CEILDIV(f->f_size, BLKSIZE);
+    struct Extent *last;
+    blockno_t ext_nblocks = file_extent_blocks(f, &last);
+
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++)
+        for (blockno_t i = 0; i < ext->e_len; i++)
+            flush_block_deferred(diskaddr(ext->e_start + i));
+
+    for (blockno_t i = ext_nblocks; i < nblocks; i++) {
+        blockno_t diskbno;
+        if (file_block_map(f, i, &diskbno) > 0)
+            flush_block_deferred(diskaddr(diskbno));
     }
+
     if (f->f_indirect)
-        flush_block(diskaddr(f->f_indirect));
-    flush_block(f);
+        flush_block_deferred(diskaddr(f->f_indirect));
+    if (f->f_dindirect) {
+        blockno_t *dind = diskaddr(f->f_dindirect);
+        for (blockno_t i = 0; i < NINDIRECT; i++)
+            if (dind[i]) flush_block_deferred(diskaddr(dind[i]));
+        flush_block_deferred(dind);
+    }
+    dir_index_flush(f);
+    flush_block_deferred(f);
+    flush_commit();
+}
+
+/* True if directory dir has no entries */
+static bool
+dir_empty(struct File *dir) {
+    if (dir->f_dirindex) return !((struct DirIndex *)diskaddr(dir->f_dirindex))->di_count;
+
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+        struct File *f = dir_slot(dir, slot);
+        if (f && f->f_name[0]) return 0;
+    }
+    return 1;
 }
 
-/* Sync the entire file system.  A big hammer. */
+/* Remove "path" and free its blocks. Directories
+ * have to be empty, the root can't be removed.
+ * Returns 0 on success, < 0 on error. */
+int
+file_remove(const char *path) {
+    struct File *dir, *f;
+    int res = walk_path(path, &dir, &f, 0);
+    if (res < 0) return res;
+
+    if (!dir) return -E_BAD_PATH;
+    if (f->f_type == FTYPE_DIR && !dir_empty(f)) return -E_NOT_SUPP;
+
+    dcache_update(dir, f->f_name, NULL);
+    if (f->f_type == FTYPE_DIR) dcache_forget_dir(f);
+    dir_index_remove(dir, f);
+    file_truncate_blocks(f, 0);
+    dir_index_drop(f);
+    memset(f, 0, sizeof(*f));
+    bc_mark_dirty(f);
+
+    flush_block_deferred(f);
+    dir_index_flush(dir);
+    flush_commit();
+    return 0;
+}
+
+/* Sync the entire file system */
 void
 fs_sync(void) {
-    for (int i = 1; i < super->s_nblocks; i++) {
-        flush_block(diskaddr(i));
-    }
+    bc_sync();
 }
@@ -11,37 +11,129 @@
 /* Maximum disk size we can handle (3GB) */
 #define DISKSIZE 0xC0000000
 
+/* Block cache budget in blocks, the superblock and the bitmap
+ * come on top of it (set with CONFIG_BC_BLOCKS in GNUmakefile) */
+#ifndef BC_MAX_BLOCKS
+#define BC_MAX_BLOCKS 4096
+#endif
+
 extern struct Super *super; /* superblock */
 extern uint32_t *bitmap;    /* bitmap blocks mapped in memory */
 
+/* Block device the cache is backed by */
+struct Disk {
+    const char *name;
+    int (*read)(uint32_t secno, void *dst, size_t nsecs);
+    int (*write)(uint32_t secno, const void *src, size_t nsecs);
+    /* Start a read and return without waiting for the data, nothing
+     * else may be issued until finish() has returned something other
+     * than -E_AGAIN. Returns -E_NOT_SUPP if the read can't be done
+     * asynchronously */
+    int (*read_start)(uint32_t secno, void *dst, size_t nsecs);
+    /* Complete the read started with read_start(), sleeping if wait
+     * is set. Returns -E_AGAIN if it is not done and wait is not set */
+    int (*finish)(bool wait);
+    /* Interrupt line counted in vsys[VSYS_irq + line] that signals the
+     * end of a read started with read_start(), -1 if there is none */
+    int (*irq)(void);
+};
+
+extern const struct Disk *disk;
+
+/* pci.c */
+struct PciFunc {
+    uint8_t pf_bus, pf_dev, pf_func;
+    uint16_t pf_vendor, pf_device;
+    uint32_t pf_class; /* Class, subclass and programming interface */
+};
+
+#define PCI_ID         0x00
+#define PCI_COMMAND    0x04
+#define PCI_CLASS      0x08
+#define PCI_BAR0       0x10
+#define PCI_BAR4       0x20
+#define PCI_INTR       0x3C
+#define PCI_CMD_IO     0x0001
+#define PCI_CMD_MASTER 0x0004
+
+uint32_t pci_conf_read(struct PciFunc *f, int off);
+void pci_conf_write(struct PciFunc *f, int off, uint32_t val);
+bool pci_find(struct PciFunc *f, bool (*match)(struct PciFunc *f));
+void pci_enable(struct PciFunc *f);
+
 /* ide.c */
+extern const struct Disk ide_disk;
 bool ide_probe_disk1(void);
+bool ide_dma_init(void);
 void ide_set_disk(int diskno);
 void ide_set_partition(uint32_t first_sect, uint32_t nsect);
 int ide_read(uint32_t secno, void *dst, size_t nsecs);
 int ide_write(uint32_t secno, const void *src, size_t nsecs);
+int ide_read_start(uint32_t secno, void *dst, size_t nsecs);
+int ide_finish(bool wait);
+int ide_irq(void);
+
+/* virtio.c */
+extern const struct Disk virtio_disk;
+bool virtio_blk_init(void);
+int virtio_read(uint32_t secno, void *dst, size_t nsecs);
+int virtio_write(uint32_t secno, const void *src, size_t nsecs);
+int virtio_read_start(uint32_t secno, void *dst, size_t nsecs);
+int virtio_finish(bool wait);
+int virtio_irq(void);
 
 /* bc.c */
+extern struct DiskStat bc_stat;
+extern struct CacheStat bc_cache_stat;
 void *diskaddr(uint32_t blockno);
+void bc_load(blockno_t blockno, size_t n);
+size_t bc_readahead(blockno_t blockno, size_t n);
+bool bc_busy(void);
 void flush_block(void *addr);
+void flush_block_deferred(void *addr);
+void flush_commit(void);
+void bc_mark_dirty(void *addr);
+void bc_forget(blockno_t blockno);
+void bc_writeback(void);
+void bc_writeback_maybe(void);
+void bc_sync(void);
 void bc_init(void);
 
+/* dcache.c */
+bool dcache_lookup(struct File *dir, const char *name, struct File **pf);
+void dcache_insert(struct File *dir, const char *name, struct File *f);
+void dcache_update(struct File *dir, const char *name, struct File *f);
+void dcache_forget_dir(struct File *dir);
+bool dcache_path_lookup(const char *path, struct File **pdir, struct File **pf, char *lastelem);
+void dcache_path_insert(const char *path, struct File *dir, struct File *f, size_t last);
+
 /* fs.c */
 void fs_init(void);
 int file_get_block(struct File *f, uint32_t file_blockno, char **pblk);
 int file_create(const char *path, struct File **f);
 int file_block_walk(struct File *f, uint32_t filebno, uint32_t **ppdiskbno, bool alloc);
+int file_block_map(struct File *f, blockno_t filebno, blockno_t *pdiskbno);
 int file_open(const char *path, struct File **f);
 ssize_t file_read(struct File *f, void *buf, size_t count, off_t offset);
+blockno_t file_readahead(struct File *f, blockno_t first, blockno_t end);
 ssize_t file_write(struct File *f, const void *buf, size_t count, off_t offset);
 int file_set_size(struct File *f, off_t newsize);
 void file_flush(struct File *f);
+void file_fsync(struct File *f);
 int file_remove(const char *path);
 void fs_sync(void);
 
 /* int  map_block(uint32_t); */
 bool block_is_free(uint32_t blockno);
 blockno_t alloc_block(void);
+blockno_t alloc_block_near(blockno_t hint);
+
+/* thread.c */
+struct Thread;
+int thread_create(struct Thread **pt, void (*entry)(void *), void *arg);
+void thread_run(struct Thread *t);
+void thread_yield(void);
+struct Thread *thread_current(void);
 
 /* test.c */
 void fs_test(void);
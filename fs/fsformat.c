@@ -125,16 +125,11 @@ finishdisk(void) {
 
 void
 finishfile(struct File *f, uint32_t start, uint32_t len) {
-    int i;
     f->f_size = len;
-    len = ROUNDUP(len, BLKSIZE);
-    for (i = 0; i < len / BLKSIZE && i < NDIRECT; ++i)
-        f->f_direct[i] = start + i;
-    if (i == NDIRECT) {
-        uint32_t *ind = alloc(BLKSIZE);
-        f->f_indirect = blockof(ind);
-        for (; i < len / BLKSIZE; ++i)
-            ind[i - NDIRECT] = start + i;
+    /* Files are laid out contiguously, so a single extent maps them */
+    if (len) {
+        f->f_extent[0].e_start = start;
+        f->f_extent[0].e_len = ROUNDUP(len, BLKSIZE) / BLKSIZE;
     }
 }
 
@@ -207,6 +202,7 @@ main(int argc, char **argv) {
     char *s;
     struct Dir root;
 
+    assert(sizeof(struct File) == 256);
     assert(BLKSIZE % sizeof(struct File) == 0);
 
     if (argc < 3)
@@ -1,5 +1,8 @@
 /*
- * Minimal PIO-based (non-interrupt-driven) IDE driver code.
+ * IDE driver code. Transfers use bus master DMA when the controller
+ * supports it, the file server sleeps until the disk interrupt then
+ * (the kernel counts them in vsys[VSYS_irq + IRQ_IDE]). Otherwise the
+ * sectors are moved with programmed I/O polling the disk.
  * For information about what all this IDE/ATA magic means,
  * see the materials available on the class references page.
  */
@@ -12,8 +15,52 @@
 #define IDE_DF   0x20
 #define IDE_ERR  0x01
 
+#define IDE_CMD_READ      0x20
+#define IDE_CMD_WRITE     0x30
+#define IDE_CMD_READ_DMA  0xC8
+#define IDE_CMD_WRITE_DMA 0xCA
+
+/* Bus master IDE registers of the primary channel, relative to BAR4 */
+#define BM_CMD    0
+#define BM_STATUS 2
+#define BM_PRDT   4
+
+#define BM_CMD_START 0x01
+#define BM_CMD_READ  0x08 /* Transfer from the disk to memory */
+
+#define BM_STATUS_ERR 0x02
+#define BM_STATUS_IRQ 0x04
+
+/* Physical region descriptor, a region must not cross 64KB boundary */
+struct ide_prd {
+    uint32_t prd_addr;
+    uint16_t prd_size;
+    uint16_t prd_flags;
+};
+
+#define PRD_EOT 0x8000 /* Last descriptor of the table */
+
+/* 256 sectors in page sized regions */
+#define NPRD (256 * SECTSIZE / PAGE_SIZE + 1)
+
+/* Interrupts are not lost, but the status is checked
+ * every IDE_IRQ_TIMEOUT ms anyway. A timed wait also tells
+ * the kernel that the file server is going to wake up */
+#define IDE_IRQ_TIMEOUT 100
+
+static struct ide_prd prdt[NPRD] __attribute__((aligned(PAGE_SIZE)));
+static uint32_t prdt_pa;
+
+/* I/O base of bus master registers, 0 if DMA is not used */
+static int bmide;
+
 static int diskno = 1;
 
+/* Last interrupt count the line was unmasked for */
+static uint32_t irq_seen;
+
+const struct Disk ide_disk = {"ide", ide_read, ide_write, ide_read_start, ide_finish, ide_irq};
+
 static int
 ide_wait_ready(bool check_error) {
     int r;
@@ -53,12 +100,44 @@ ide_set_disk(int d) {
     diskno = d;
 }
 
-int
-ide_read(uint32_t secno, void *dst, size_t nsecs) {
-    int r;
+/* Mass storage, IDE, bus master capable, with I/O BAR4 */
+static bool
+ide_match(struct PciFunc *f) {
+    return (f->pf_class >> 8) == 0x0101 && (f->pf_class & 0x80) &&
+           (pci_conf_read(f, PCI_BAR4) & 1);
+}
 
-    assert(nsecs <= 256);
+/* Find a bus master capable IDE controller on PCI bus 0
+ * and enable DMA. Returns false if there is none */
+bool
+ide_dma_init(void) {
+    struct PciFunc f;
+    if (!pci_find(&f, ide_match)) return 0;
 
+    int64_t pa = sys_region_pa(prdt, PROT_RW);
+    if (pa < 0 || pa >= 0x100000000LL) return 0;
+    if (sys_irq_ack(IRQ_IDE) < 0) return 0;
+
+    pci_enable(&f);
+    prdt_pa = pa;
+    bmide = pci_conf_read(&f, PCI_BAR4) & 0xFFFC;
+    return 1;
+}
+
+/* The kernel masks the line on every interrupt,
+ * enable it again once the disk has been serviced */
+static void
+ide_irq_ack(void) {
+    uint32_t n = vsys[VSYS_irq + IRQ_IDE];
+    if (n == irq_seen) return;
+
+    irq_seen = n;
+    sys_irq_ack(IRQ_IDE);
+}
+
+/* Select sectors [secno, secno + nsecs) and issue command cmd */
+static void
+ide_start(uint32_t secno, size_t nsecs, int cmd) {
     ide_wait_ready(0);
 
     outb(0x1F2, nsecs);
@@ -66,7 +145,105 @@ ide_read(uint32_t secno, void *dst, size_t nsecs) {
     outb(0x1F4, (secno >> 8) & 0xFF);
     outb(0x1F5, (secno >> 16) & 0xFF);
     outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-    outb(0x1F7, 0x20); /* CMD 0x20 means read sector */
+    outb(0x1F7, cmd);
+}
+
+/* Start a DMA transfer of nsecs sectors between the disk and buf,
+ * ide_dma_finish() completes it. Returns -E_NOT_SUPP if buf can't
+ * be used for DMA, the caller falls back to programmed I/O then */
+static int
+ide_dma_start(uint32_t secno, void *buf, size_t nsecs, bool write) {
+    uintptr_t va = (uintptr_t)buf, end = va + nsecs * SECTSIZE;
+    size_t n = 0;
+
+    if (va & 3) return -E_NOT_SUPP;
+
+    /* Pages are physically contiguous, so every page (part) is a region */
+    while (va < end) {
+        size_t len = MIN(end - va, PAGE_SIZE - PAGE_OFFSET(va));
+        int64_t pa = sys_region_pa((void *)va, write ? PROT_R : PROT_RW);
+        if (pa < 0 || pa + len > 0x100000000LL) return -E_NOT_SUPP;
+
+        prdt[n].prd_addr = pa;
+        prdt[n].prd_size = len;
+        prdt[n].prd_flags = 0;
+        va += len;
+        n++;
+    }
+    prdt[n - 1].prd_flags = PRD_EOT;
+
+    /* The interrupt of the previous transfer may come after its status */
+    ide_irq_ack();
+
+    outb(bmide + BM_CMD, 0);
+    outl(bmide + BM_PRDT, prdt_pa);
+    outb(bmide + BM_STATUS, inb(bmide + BM_STATUS) | BM_STATUS_ERR | BM_STATUS_IRQ);
+
+    ide_start(secno, nsecs, write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+    outb(bmide + BM_CMD, BM_CMD_START | (write ? 0 : BM_CMD_READ));
+    return 0;
+}
+
+/* Complete the transfer started with ide_dma_start(), sleeping until
+ * the disk interrupt if wait is set. Returns -E_AGAIN if the transfer
+ * is still in progress and wait is not set, -1 if it has failed */
+static int
+ide_dma_finish(bool wait) {
+    /* The counter is read before the status, so an interrupt
+     * coming in between makes sys_futex_wait() return at once */
+    uint8_t status;
+    for (;;) {
+        uint32_t seen = vsys[VSYS_irq + IRQ_IDE];
+        status = inb(bmide + BM_STATUS);
+        if (status & (BM_STATUS_IRQ | BM_STATUS_ERR)) break;
+        if (!wait) return -E_AGAIN;
+        sys_futex_wait((const volatile uint32_t *)&vsys[VSYS_irq + IRQ_IDE], seen, IDE_IRQ_TIMEOUT);
+    }
+
+    outb(bmide + BM_CMD, 0);
+    outb(bmide + BM_STATUS, status);
+
+    /* Reading the status also acknowledges the interrupt of the disk */
+    int r = inb(0x1F7);
+    ide_irq_ack();
+    if ((status & BM_STATUS_ERR) || (r & (IDE_DF | IDE_ERR))) return -1;
+    return 0;
+}
+
+static int
+ide_dma(uint32_t secno, void *buf, size_t nsecs, bool write) {
+    int r = ide_dma_start(secno, buf, nsecs, write);
+    return r < 0 ? r : ide_dma_finish(1);
+}
+
+/* Start reading without waiting for the data, see struct Disk */
+int
+ide_read_start(uint32_t secno, void *dst, size_t nsecs) {
+    assert(nsecs <= 256);
+
+    if (!bmide) return -E_NOT_SUPP;
+    return ide_dma_start(secno, dst, nsecs, 0);
+}
+
+int
+ide_finish(bool wait) {
+    return ide_dma_finish(wait);
+}
+
+int
+ide_irq(void) {
+    return bmide ? IRQ_IDE : -1;
+}
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+    int r;
+
+    assert(nsecs <= 256);
+
+    if (bmide && (r = ide_dma(secno, dst, nsecs, 0)) != -E_NOT_SUPP) return r;
+
+    ide_start(secno, nsecs, IDE_CMD_READ);
 
     for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
         if ((r = ide_wait_ready(1)) < 0) return r;
@@ -82,14 +259,9 @@ ide_write(uint32_t secno, const void *src, size_t nsecs) {
 
     assert(nsecs <= 256);
 
-    ide_wait_ready(0);
+    if (bmide && (r = ide_dma(secno, (void *)src, nsecs, 1)) != -E_NOT_SUPP) return r;
 
-    outb(0x1F2, nsecs);
-    outb(0x1F3, secno & 0xFF);
-    outb(0x1F4, (secno >> 8) & 0xFF);
-    outb(0x1F5, (secno >> 16) & 0xFF);
-    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
-    outb(0x1F7, 0x30); /* CMD 0x30 means write sector */
+    ide_start(secno, nsecs, IDE_CMD_WRITE);
 
     for (; nsecs > 0; nsecs--, src += SECTSIZE) {
         if ((r = ide_wait_ready(1)) < 0) return r;
@@ -0,0 +1,50 @@
+/*
+ * PCI configuration space access for the drivers of the file server.
+ * Only bus 0 is scanned, which is everything QEMU has by default.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define PCI_CONF_ADDR 0xCF8
+#define PCI_CONF_DATA 0xCFC
+
+uint32_t
+pci_conf_read(struct PciFunc *f, int off) {
+    outl(PCI_CONF_ADDR, 0x80000000 | f->pf_bus << 16 | f->pf_dev << 11 | f->pf_func << 8 | off);
+    return inl(PCI_CONF_DATA);
+}
+
+void
+pci_conf_write(struct PciFunc *f, int off, uint32_t val) {
+    outl(PCI_CONF_ADDR, 0x80000000 | f->pf_bus << 16 | f->pf_dev << 11 | f->pf_func << 8 | off);
+    outl(PCI_CONF_DATA, val);
+}
+
+/* Find the first function match() accepts and fill in *f.
+ * Returns false if there is none */
+bool
+pci_find(struct PciFunc *f, bool (*match)(struct PciFunc *f)) {
+    for (int dev = 0; dev < 32; dev++) {
+        for (int func = 0; func < 8; func++) {
+            *f = (struct PciFunc){.pf_bus = 0, .pf_dev = dev, .pf_func = func};
+
+            uint32_t id = pci_conf_read(f, PCI_ID);
+            if ((id & 0xFFFF) == 0xFFFF) continue;
+
+            f->pf_vendor = id & 0xFFFF;
+            f->pf_device = id >> 16;
+            f->pf_class = pci_conf_read(f, PCI_CLASS) >> 8;
+            if (match(f)) return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* Enable I/O space decoding and bus mastering */
+void
+pci_enable(struct PciFunc *f) {
+    uint32_t cmd = pci_conf_read(f, PCI_COMMAND);
+    pci_conf_write(f, PCI_COMMAND, (cmd & 0xFFFF) | PCI_CMD_IO | PCI_CMD_MASTER);
+}
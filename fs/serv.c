@@ -7,7 +7,6 @@
 #include <inc/string.h>
 
 #include "fs.h"
-#define BUFSIZE (PAGE_SIZE - sizeof(int) - sizeof(size_t))
 /* The file system server maintains three structures
  * for each open file.
  *
@@ -31,14 +30,75 @@ struct OpenFile {
     struct File *o_file; /* mapped descriptor for open file */
     int o_mode;          /* open mode */
     struct Fd *o_fd;     /* Fd page */
+
+    /* Sequential readahead, see serve_readahead() */
+    off_t o_ra_pos;         /* Where the next sequential read starts */
+    blockno_t o_ra_window;  /* Blocks to keep read ahead of o_ra_pos */
+    blockno_t o_ra_next;    /* First block not read ahead yet */
+
+    bool o_busy; /* A request is being served, see serve_file_of() */
 };
 
+/* Readahead window grows from RA_MIN_WINDOW blocks
+ * while reads stay sequential */
+#define RA_MIN_WINDOW 4
+#define RA_MAX_WINDOW 64
+
 /* initialize to force into data section */
 struct OpenFile opentab[MAXOPEN] = {
         {0, 0, 1, 0}};
 
-/* Virtual address at which to receive page mappings containing client requests. */
-union Fsipc *fsreq = (union Fsipc *)0x0FFFF000;
+/* Requests received through IPC are served by SERVE_WORKERS threads
+ * (see thread.c), so that a request waiting for the disk does not hold
+ * up requests for cached data. Channel requests are served by the main
+ * loop itself and wait for the disk there */
+#define SERVE_WORKERS 8
+
+/* Worker i receives its requests at FSREQ(i). The data area follows
+ * the request page, see FSIPC_DATA_SIZE. The last page of the stride
+ * keeps the copies serve_map() sends */
+#define FSREQ_VA      0x0C000000
+#define FSREQ_STRIDE  0x20000
+#define FSREQ(i)      ((union Fsipc *)(FSREQ_VA + (i)*FSREQ_STRIDE))
+#define FSMAP_COPY(r) ((void *)(r) + FSREQ_STRIDE - PAGE_SIZE)
+
+/* The main loop checks the disk at least every SERVE_IO_TIMEOUT ms
+ * while a worker waits for it, like the drivers do */
+#define SERVE_IO_TIMEOUT 100
+
+struct serve_worker {
+    struct Thread *w_thread;
+    union Fsipc *w_req; /* Where requests are received */
+    uint32_t w_type;    /* Request being served */
+    envid_t w_whom;
+    int w_perm;
+    size_t w_size;      /* Size of the region received with the request */
+    bool w_busy;        /* Set until the reply is sent */
+};
+
+static struct serve_worker serve_workers[SERVE_WORKERS];
+
+/* Request and data area of the request being served, switched
+ * by serve_run() along with the worker */
+union Fsipc *fsreq;
+uint8_t *fsdata;
+/* Size of the data area received with the current request */
+size_t fsdata_size;
+
+/* Channels set up by clients with FSREQ_CHANNEL are mapped here,
+ * FSCHAN_STRIDE bytes apart. A channel is closed when the server
+ * holds the only reference to it */
+#define FSCHAN_VA     0x0F000000
+#define FSCHAN_STRIDE (16 * PAGE_SIZE)
+#define FSCHAN_MAX    32
+#define FSCHAN(i)     ((struct FsChannel *)(FSCHAN_VA + (i)*FSCHAN_STRIDE))
+
+static bool fschan_used[FSCHAN_MAX];
+static envid_t fschan_client[FSCHAN_MAX];
+/* Chain of the last request that failed or came back short */
+static uint32_t fschan_failed[FSCHAN_MAX];
+/* Next request waits for a busy open file, see serve_channel_reqs() */
+static bool fschan_blocked[FSCHAN_MAX];
 
 void
 serve_init(void) {
@@ -50,6 +110,25 @@ serve_init(void) {
     }
 }
 
+/* Let everybody who has f open know that it has changed,
+ * so that clients drop the data they have buffered */
+static void
+serve_invalidate(struct File *f) {
+    for (size_t i = 0; i < MAXOPEN; i++)
+        if (opentab[i].o_file == f && is_page_present(opentab[i].o_fd))
+            opentab[i].o_fd->fd_file.gen++;
+}
+
+/* Returns true if f is open. Mappings made with serve_map() keep
+ * the Fd page of the file referenced too, see mmap() */
+static bool
+serve_file_busy(struct File *f) {
+    for (size_t i = 0; i < MAXOPEN; i++)
+        if (opentab[i].o_file == f && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1)
+            return 1;
+    return 0;
+}
+
 /* Allocate an open file. */
 int
 openfile_alloc(struct OpenFile **o) {
@@ -117,6 +196,10 @@ serve_open(envid_t envid, struct Fsreq_open *req,
             if (debug) cprintf("file_create failed: %i", res);
             return res;
         }
+        if (req->req_omode & O_MKDIR) {
+            f->f_type = FTYPE_DIR;
+            flush_block(f);
+        }
     } else {
     try_open:
         if ((res = file_open(path, &f)) < 0) {
@@ -131,6 +214,7 @@ serve_open(envid_t envid, struct Fsreq_open *req,
             if (debug) cprintf("file_set_size failed: %i", res);
             return res;
         }
+        serve_invalidate(f);
     }
     if ((res = file_open(path, &f)) < 0) {
         if (debug) cprintf("file_open failed: %i", res);
@@ -145,6 +229,9 @@ serve_open(envid_t envid, struct Fsreq_open *req,
     o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
     o->o_fd->fd_dev_id = devfile.dev_id;
     o->o_mode = req->req_omode;
+    o->o_ra_pos = 0;
+    o->o_ra_window = 0;
+    o->o_ra_next = 0;
 
     if (debug) cprintf("sending success, page %08lx\n", (unsigned long)o->o_fd);
 
@@ -179,13 +266,41 @@ serve_set_size(envid_t envid, union Fsipc *ipc) {
 
     /* Second, call the relevant file system function (from fs/fs.c).
      * On failure, return the error code to the client. */
-    return file_set_size(o->o_file, req->req_size);
+    if ((r = file_set_size(o->o_file, req->req_size)) < 0) return r;
+
+    serve_invalidate(o->o_file);
+    return 0;
+}
+
+/* Called after n bytes at offset have been read from o. While reads
+ * are sequential, keep the next o_ra_window blocks of the file being
+ * read from the disk, so the following reads find them in the cache */
+static void
+serve_readahead(struct OpenFile *o, off_t offset, size_t n) {
+    if (offset != o->o_ra_pos) {
+        o->o_ra_window = 0;
+        o->o_ra_next = 0;
+    } else {
+        o->o_ra_window = MIN(MAX(o->o_ra_window * 2, RA_MIN_WINDOW), RA_MAX_WINDOW);
+    }
+    o->o_ra_pos = offset + n;
+    if (!o->o_ra_window) return;
+
+    blockno_t nblocks = CEILDIV(o->o_file->f_size, BLKSIZE);
+    blockno_t first = MAX(o->o_ra_pos / BLKSIZE, o->o_ra_next);
+    blockno_t end = MIN(o->o_ra_pos / BLKSIZE + o->o_ra_window, nblocks);
+
+    /* Read ahead in batches of at least half the window */
+    if (first >= end || (end - first < o->o_ra_window / 2 && end < nblocks)) return;
+    o->o_ra_next = file_readahead(o->o_file, first, end);
 }
 
 /* Read at most ipc->read.req_n bytes from the current seek position
  * in ipc->read.req_fileid.  Return the bytes read from the file to
- * the caller in ipc->readRet, then update the seek position.  Returns
- * the number of bytes successfully read, or < 0 on error. */
+ * the caller in the data area, then update the seek position.  Returns
+ * the number of bytes successfully read, or < 0 on error.
+ * A req_offset other than FSREQ_OFFSET_CUR is read from instead,
+ * the seek position stays where it is then. */
 int
 serve_read(envid_t envid, union Fsipc *ipc) {
     struct Fsreq_read *req = &ipc->read;
@@ -201,21 +316,171 @@ serve_read(envid_t envid, union Fsipc *ipc) {
     if (res < 0) {
         return res;
     }
-    if (req->req_n > BUFSIZE) {
-        req->req_n = BUFSIZE;
-    }
-    ssize_t read = file_read(o->o_file, ipc->readRet.ret_buf, req->req_n, o->o_fd->fd_offset);
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+    if (offset < 0) return -E_INVAL;
+    ssize_t read = file_read(o->o_file, fsdata, MIN(req->req_n, fsdata_size), offset);
     if (read < 0) {
         return read;
     }
-    o->o_fd->fd_offset += read;
+    if (read) serve_readahead(o, offset, read);
+    if (cur) o->o_fd->fd_offset = offset + read;
     return read;
 }
 
-/* Write req->req_n bytes from req->req_buf to req_fileid, starting at
+/* Number of blocks of f from filebno on, at most n, which are contiguous
+ * on disk, *start is the first one. Returns 0 if filebno is a hole */
+static int
+serve_block_run(struct File *f, blockno_t filebno, blockno_t n, blockno_t *start) {
+    blockno_t next;
+    int res = file_block_map(f, filebno, start);
+    if (res <= 0) return res;
+
+    blockno_t run = MIN(res, n);
+    while (run < n && (res = file_block_map(f, filebno + run, &next)) > 0 && next == *start + run)
+        run += MIN(res, n - run);
+    return run;
+}
+
+/* Bring the n blocks of f from offset on, which serve_block_run() found
+ * to start at disk block start, into the cache. Other requests run while
+ * they are read (see bc_load()) and may change f, returns how many of the
+ * blocks are still within f where they were */
+static blockno_t
+serve_load_run(struct File *f, off_t offset, blockno_t n, blockno_t start) {
+    bc_load(start, n);
+
+    blockno_t now;
+    if (offset >= f->f_size) return 0;
+    n = MIN(n, (f->f_size - offset) / BLKSIZE);
+    int res = n ? serve_block_run(f, offset / BLKSIZE, n, &now) : 0;
+    return res > 0 && now == start ? res : 0;
+}
+
+/* Same as serve_read(), but instead of being copied the data is passed
+ * by mapping the block cache pages holding it copy-on-write at the
+ * client's buffer. Only whole blocks adjacent on disk can be passed in
+ * one region, and only clean ones: mapping clears the dirty bit the
+ * block cache relies on. Returns the number of bytes mapped, 0 at the
+ * end of the file or -E_NOT_SUPP if the client has to use serve_read() */
+int
+serve_read_map(envid_t envid, struct Fsreq_read *req, void **pg_store, size_t *size_store, int *perm_store) {
+    if (debug) {
+        cprintf("serve_read_map %08x %08x %08x\n",
+                envid, req->req_fileid, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+
+    struct File *f = o->o_file;
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+    if (offset < 0) return -E_INVAL;
+    if (offset >= f->f_size) return 0;
+    if (offset % BLKSIZE) return -E_NOT_SUPP;
+
+    blockno_t start;
+    blockno_t n = MIN(MIN(req->req_n, FSMAP_MAX_SIZE) / BLKSIZE, (f->f_size - offset) / BLKSIZE);
+    if (!n || (res = serve_block_run(f, offset / BLKSIZE, n, &start)) <= 0) return res < 0 ? res : -E_NOT_SUPP;
+
+    blockno_t run = serve_load_run(f, offset, res, start);
+    if (!run) return -E_NOT_SUPP;
+    char *blk = diskaddr(start);
+    blockno_t mapped = 0;
+    while (mapped < run && is_page_present(blk + mapped * BLKSIZE) && !is_page_dirty(blk + mapped * BLKSIZE))
+        mapped++;
+    if (!mapped) return -E_NOT_SUPP;
+
+    serve_readahead(o, offset, mapped * BLKSIZE);
+    if (cur) o->o_fd->fd_offset = offset + mapped * BLKSIZE;
+
+    *pg_store = blk;
+    *size_store = mapped * BLKSIZE;
+    *perm_store = PROT_RW | PROT_LAZY;
+    return mapped * BLKSIZE;
+}
+
+/* Map up to req->req_n bytes of req_fileid from req->req_offset on for
+ * mmap(). Whole blocks are mapped straight from the block cache, read-only
+ * for shared mappings, which then see later writes to the file while the
+ * block stays in the cache, and copy-on-write for private ones. The block
+ * with the end of the file and holes get a zero-filled copy, so the
+ * client never sees data past the end of the file. Returns the number
+ * of bytes mapped or 0 at the end of the file */
+int
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, size_t *size_store, int *perm_store) {
+    if (debug) {
+        cprintf("serve_map %08x %08x %08lx %08x\n", envid, req->req_fileid,
+                (unsigned long)req->req_offset, (uint32_t)req->req_n);
+    }
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+
+    /* Mapping reads the file, whatever the client asks for */
+    if ((o->o_mode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+
+    int perm = req->req_perm & (PROT_RW | PROT_LAZY);
+    if (!(perm & PROT_R) || (perm & (PROT_W | PROT_LAZY)) == PROT_W) return -E_INVAL;
+
+    struct File *f = o->o_file;
+    off_t offset = req->req_offset;
+    if (offset < 0 || offset % BLKSIZE) return -E_INVAL;
+again:
+    if (offset >= f->f_size) return 0;
+
+    blockno_t start;
+    blockno_t n = MIN(MIN(req->req_n, FSMAP_MAX_SIZE) / BLKSIZE, (f->f_size - offset) / BLKSIZE);
+    if ((res = n ? serve_block_run(f, offset / BLKSIZE, n, &start) : 0) < 0) return res;
+
+    if (!res) {
+        /* Copies live at FSMAP_COPY() until the next one replaces them */
+        void *copy = FSMAP_COPY(fsreq);
+        if ((res = sys_alloc_region(0, copy, PAGE_SIZE, PROT_RW)) < 0) return res;
+        if (file_block_map(f, offset / BLKSIZE, &start) > 0 &&
+            (res = file_read(f, copy, MIN(f->f_size - offset, BLKSIZE), offset)) < 0) return res;
+
+        *pg_store = copy;
+        *size_store = PAGE_SIZE;
+        *perm_store = (perm & PROT_RW) | PROT_LAZY;
+        return PAGE_SIZE;
+    }
+
+    /* The file has changed while the blocks were read */
+    if (!(res = serve_load_run(f, offset, res, start))) goto again;
+    char *blk = diskaddr(start);
+    blockno_t mapped = 0;
+    while (mapped < res && is_page_present(blk + mapped * BLKSIZE))
+        mapped++;
+    if (!mapped) {
+        /* Evicted by the blocks read after it */
+        bc_load(start, 1);
+        mapped = 1;
+    }
+
+    /* Copy-on-write mapping clears the dirty bit, write the blocks out first */
+    if (perm & PROT_LAZY) {
+        for (blockno_t i = 0; i < mapped; i++)
+            flush_block_deferred(blk + i * BLKSIZE);
+        flush_commit();
+    }
+
+    serve_readahead(o, offset, mapped * BLKSIZE);
+
+    *pg_store = blk;
+    *size_store = mapped * BLKSIZE;
+    *perm_store = perm;
+    return mapped * BLKSIZE;
+}
+
+/* Write req->req_n bytes from the data area to req_fileid, starting at
  * the current seek position, and update the seek position
  * accordingly.  Extend the file if necessary.  Returns the number of
- * bytes written, or < 0 on error. */
+ * bytes written, or < 0 on error.  As in serve_read(), req_offset
+ * other than FSREQ_OFFSET_CUR is written at without a seek. */
 int
 serve_write(envid_t envid, union Fsipc *ipc) {
     struct Fsreq_write *req = &ipc->write;
@@ -229,11 +494,15 @@ serve_write(envid_t envid, union Fsipc *ipc) {
     if (res < 0) {
         return res;
     }
-    ssize_t writen = file_write(o->o_file, req->req_buf, req->req_n, o->o_fd->fd_offset);
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+    if (offset < 0) return -E_INVAL;
+    ssize_t writen = file_write(o->o_file, fsdata, MIN(req->req_n, fsdata_size), offset);
     if (writen < 0) {
         return writen;
     }
-    o->o_fd->fd_offset += writen;
+    if (writen) serve_invalidate(o->o_file);
+    if (cur) o->o_fd->fd_offset = offset + writen;
     return writen;
 }
 
@@ -270,12 +539,58 @@ serve_flush(envid_t envid, union Fsipc *ipc) {
     return 0;
 }
 
+/* Write out req->req_fileid, unlike serve_sync() other
+ * dirty blocks are left to the background writeback */
+int
+serve_fsync(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_fsync *req = &ipc->fsync;
+    if (debug) cprintf("serve_fsync %08x %08x\n", envid, req->req_fileid);
+
+    struct OpenFile *o;
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+    if (res < 0) return res;
+
+    file_fsync(o->o_file);
+    return 0;
+}
+
+/* Remove req->req_path */
+int
+serve_remove(envid_t envid, union Fsipc *ipc) {
+    struct Fsreq_remove *req = &ipc->remove;
+    char path[MAXPATHLEN];
+
+    /* Copy in the path, making sure it's null-terminated */
+    memmove(path, req->req_path, MAXPATHLEN);
+    path[MAXPATHLEN - 1] = 0;
+    if (debug) cprintf("serve_remove %08x %s\n", envid, path);
+
+    /* Open files and their mappings would see the entry and
+     * the blocks reused by other files, see serve_file_busy() */
+    struct File *f;
+    if (file_open(path, &f) == 0 && serve_file_busy(f)) return -E_BUSY;
+
+    return file_remove(path);
+}
+
 int
 serve_sync(envid_t envid, union Fsipc *req) {
     fs_sync();
     return 0;
 }
 
+int
+serve_diskstat(envid_t envid, union Fsipc *req) {
+    req->diskstatRet = bc_stat;
+    return 0;
+}
+
+int
+serve_cachestat(envid_t envid, union Fsipc *req) {
+    req->cachestatRet = bc_cache_stat;
+    return 0;
+}
+
 typedef int (*fshandler)(envid_t envid, union Fsipc *req);
 
 fshandler handlers[] = {
@@ -286,48 +601,299 @@ fshandler handlers[] = {
         [FSREQ_FLUSH] = serve_flush,
         [FSREQ_WRITE] = serve_write,
         [FSREQ_SET_SIZE] = serve_set_size,
-        [FSREQ_SYNC] = serve_sync};
+        [FSREQ_REMOVE] = serve_remove,
+        [FSREQ_SYNC] = serve_sync,
+        [FSREQ_DISKSTAT] = serve_diskstat,
+        [FSREQ_CACHESTAT] = serve_cachestat,
+        [FSREQ_FSYNC] = serve_fsync};
 #define NHANDLERS (sizeof(handlers) / sizeof(handlers[0]))
 
+/* Map the channel received with the current request
+ * into a free channel slot */
+static int
+serve_channel(envid_t envid, size_t sz) {
+    if (debug) cprintf("serve_channel %08x\n", envid);
+
+    if (sz < FSCHAN_SIZE) return -E_INVAL;
+
+    for (size_t i = 0; i < FSCHAN_MAX; i++) {
+        struct FsChannel *ch = FSCHAN(i);
+        if (fschan_used[i]) {
+            if (sys_region_refs(ch, PAGE_SIZE) > 1) continue;
+            sys_unmap_region(0, ch, FSCHAN_STRIDE);
+            fschan_used[i] = 0;
+        }
+
+        int res = sys_map_region(0, fsreq, 0, ch, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+        if (res < 0) return res;
+        fschan_used[i] = 1;
+        fschan_client[i] = envid;
+        fschan_failed[i] = 0;
+        fschan_blocked[i] = 0;
+        return 0;
+    }
+    return -E_MAX_OPEN;
+}
+
+/* Open file a request of type works on, NULL if there is none.
+ *
+ * Workers can yield to each other while they wait for the disk, so
+ * requests on one open file are served one at a time: otherwise two
+ * reads through a shared Fd would both start at the same fd_offset.
+ * The server sets o_busy while it serves such a request, workers
+ * wait for it in serve_request(), channel requests stay queued */
+static struct OpenFile *
+serve_file_of(envid_t envid, uint32_t type, union Fsipc *ipc) {
+    struct OpenFile *o;
+
+    switch (type) {
+    case FSREQ_SET_SIZE:
+    case FSREQ_READ:
+    case FSREQ_WRITE:
+    case FSREQ_STAT:
+    case FSREQ_FLUSH:
+    case FSREQ_FSYNC:
+    case FSREQ_READ_MAP:
+    case FSREQ_MAP:
+        /* req_fileid comes first in all of them */
+        return openfile_lookup(envid, ipc->stat.req_fileid, &o) < 0 ? NULL : o;
+    default:
+        return NULL;
+    }
+}
+
+/* Handle one request of channel i, the result goes to resp.
+ * Returns false if its open file is busy, the request is left alone then */
+static bool
+serve_channel_req(size_t i, struct Fsmsg *req, struct Fsmsg *resp) {
+    static union Fsipc ipc;
+    uint32_t type = req->fm_type;
+    uint32_t chain = req->fm_chain;
+
+    /* The client may change the request while it is being handled */
+    memcpy(&ipc, &req->fm_req, sizeof(req->fm_req));
+
+    /* Channel requests never yield, but a worker may be
+     * waiting for the disk halfway through a request */
+    struct OpenFile *o = FSCHAN_TYPE(type) ? serve_file_of(fschan_client[i], type, &ipc) : NULL;
+    if (o && o->o_busy) return 0;
+
+    if (type == FSREQ_WRITE) {
+        fsdata = req->fm_data;
+        fsdata_size = FSCHAN_DATA_SIZE;
+    } else {
+        fsdata = resp->fm_data;
+        fsdata_size = FSCHAN_DATA_SIZE;
+    }
+
+    /* Other requests don't fit into struct Fsmsg, they need IPC */
+    int res = -E_INVAL;
+    if (chain && chain == fschan_failed[i])
+        res = -E_AGAIN;
+    else if (FSCHAN_TYPE(type) && handlers[type])
+        res = handlers[type](fschan_client[i], &ipc);
+
+    /* Later pieces of a read or write would go past this one */
+    if (chain && (type == FSREQ_READ || type == FSREQ_WRITE) &&
+        (res < 0 || (size_t)res < ipc.read.req_n))
+        fschan_failed[i] = chain;
+
+    if (type == FSREQ_STAT && res >= 0)
+        memcpy(resp->fm_data, &ipc.statRet, sizeof(ipc.statRet));
+
+    resp->fm_type = type;
+    resp->fm_res = res;
+    memcpy(&resp->fm_req, &req->fm_req, sizeof(req->fm_req));
+    return 1;
+}
+
+/* Serve requests queued in channel i, stop at one whose open
+ * file is busy and mark the channel blocked then.
+ * Returns true if there were any served */
+static bool
+serve_channel_reqs(size_t i) {
+    struct FsChannel *ch = FSCHAN(i);
+    struct Fsmsg *req, *resp;
+    bool served = 0;
+
+    /* Clients never have more than CHAN_NSLOTS requests in flight,
+     * so there is always room for a response, unless the client
+     * misbehaves. Its requests are left queued then */
+    fschan_blocked[i] = 0;
+    while ((req = chan_peek(&ch->fc_req)) && (resp = chan_prepare(&ch->fc_resp))) {
+        if (!serve_channel_req(i, req, resp)) {
+            fschan_blocked[i] = 1;
+            break;
+        }
+        chan_release(&ch->fc_req);
+        if (chan_publish(&ch->fc_resp)) chan_notify(&ch->fc_resp);
+        served = 1;
+    }
+
+    return served;
+}
+
+/* Serve channel requests until all channels are empty or blocked
+ * and ask their clients to ring the doorbell. Blocked channels are
+ * tried again on the next round of the main loop, which wakes up
+ * for the disk the busy worker waits for */
+static void
+serve_channels(void) {
+    bool idle;
+
+    do {
+        bool served = 0;
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+            if (fschan_used[i]) served |= serve_channel_reqs(i);
+        if (served) {
+            idle = 0;
+            continue;
+        }
+
+        /* Requests queued before the doorbell is armed
+         * would not ring it, check the rings once more */
+        idle = 1;
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+            if (fschan_used[i] && !fschan_blocked[i] && !chan_arm(&FSCHAN(i)->fc_req)) idle = 0;
+    } while (!idle);
+}
+
+/* Serve the request received by w and send the reply */
+static void
+serve_request(struct serve_worker *w) {
+    uint32_t req = w->w_type;
+    envid_t whom = w->w_whom;
+    int perm = w->w_perm, res;
+    void *pg = NULL;
+    size_t pgsize = PAGE_SIZE;
+
+    /* Wait for the worker serving the open file, it
+     * yields only while it waits for the disk */
+    struct OpenFile *o = serve_file_of(whom, req, fsreq);
+    if (o) {
+        while (o->o_busy) thread_yield();
+        o->o_busy = 1;
+    }
+
+    if (req == FSREQ_OPEN) {
+        res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+    } else if (req == FSREQ_READ_MAP) {
+        res = serve_read_map(whom, &fsreq->read, &pg, &pgsize, &perm);
+    } else if (req == FSREQ_MAP) {
+        res = serve_map(whom, &fsreq->map, &pg, &pgsize, &perm);
+    } else if (req == FSREQ_CHANNEL) {
+        res = serve_channel(whom, w->w_size);
+    } else if (req < NHANDLERS && handlers[req]) {
+        res = handlers[req](whom, fsreq);
+    } else {
+        cprintf("Invalid request code %d from %08x\n", req, whom);
+        res = -E_INVAL;
+    }
+    if (o) o->o_busy = 0;
+    ipc_send(whom, res, pg, pgsize, perm);
+    sys_unmap_region(0, fsreq, w->w_size);
+}
+
+static void
+serve_worker(void *arg) {
+    struct serve_worker *w = arg;
+
+    for (;;) {
+        serve_request(w);
+        w->w_busy = 0;
+        thread_yield();
+    }
+}
+
+/* Run w until it has replied or has to wait for the disk */
+static void
+serve_run(struct serve_worker *w) {
+    fsreq = w->w_req;
+    fsdata = (uint8_t *)w->w_req + PAGE_SIZE;
+    fsdata_size = w->w_size > PAGE_SIZE ? w->w_size - PAGE_SIZE : 0;
+    thread_run(w->w_thread);
+}
+
+/* Resume the workers waiting for the disk, which is idle now.
+ * Returns false if there are none */
+static bool
+serve_resume(void) {
+    bool resumed = 0;
+    for (size_t i = 0; i < SERVE_WORKERS; i++) {
+        if (!serve_workers[i].w_busy) continue;
+        serve_run(&serve_workers[i]);
+        resumed = 1;
+    }
+    return resumed;
+}
+
 void
 serve(void) {
-    uint32_t req, whom;
-    int perm, res;
-    void *pg;
+    for (size_t i = 0; i < SERVE_WORKERS; i++) {
+        struct serve_worker *w = &serve_workers[i];
+        w->w_req = FSREQ(i);
+        int res = thread_create(&w->w_thread, serve_worker, w);
+        if (res < 0) panic("serve: thread_create failed: %i", res);
+    }
 
     while (1) {
-        perm = 0;
-        size_t sz = PAGE_SIZE;
-        req = ipc_recv((int32_t *)&whom, fsreq, &sz, &perm);
+        serve_channels();
+        bc_writeback_maybe();
+
+        /* The interrupt counter is read before the disk is checked, so
+         * an interrupt coming in between ends the wait below at once */
+        int irq = disk->irq();
+        const volatile uint32_t *intr = irq >= 0 ? (const volatile uint32_t *)&vsys[VSYS_irq + irq] : NULL;
+        uint32_t seen = intr ? *intr : 0;
+        bool busy = bc_busy();
+        if (!busy && serve_resume()) continue;
+
+        struct serve_worker *w = NULL;
+        for (size_t i = 0; i < SERVE_WORKERS && !w; i++)
+            if (!serve_workers[i].w_busy) w = &serve_workers[i];
+
+        /* Workers only stop halfway to wait for the disk */
+        if (!w) {
+            sys_futex_wait(intr, seen, SERVE_IO_TIMEOUT);
+            continue;
+        }
+
+        /* Wake up for the disk too while it is busy */
+        envid_t whom;
+        w->w_perm = 0;
+        w->w_size = PAGE_SIZE + FSIPC_DATA_SIZE;
+        int32_t req = ipc_recv_futex(&whom, w->w_req, &w->w_size, &w->w_perm,
+                                     busy ? intr : NULL, seen, SERVE_IO_TIMEOUT);
+        if (req == -E_AGAIN || req == -E_TIMEOUT) continue;
         if (debug) {
             cprintf("fs req %d from %08x [page %08lx: %s]\n",
-                    req, whom, (unsigned long)get_uvpt_entry(fsreq),
-                    (char *)fsreq);
+                    req, whom, (unsigned long)get_uvpt_entry(w->w_req),
+                    (char *)w->w_req);
+        }
+
+        /* Doorbells only wake us up to serve the channels */
+        if (req == FSREQ_DOORBELL) {
+            if (w->w_perm) sys_unmap_region(0, w->w_req, w->w_size);
+            continue;
         }
 
         /* All requests must contain an argument page */
-        if (!(perm & PROT_R)) {
+        if (!(w->w_perm & PROT_R)) {
             cprintf("Invalid request from %08x: no argument page\n", whom);
             continue; /* Just leave it hanging... */
         }
 
-        pg = NULL;
-        if (req == FSREQ_OPEN) {
-            res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
-        } else if (req < NHANDLERS && handlers[req]) {
-            res = handlers[req](whom, fsreq);
-        } else {
-            cprintf("Invalid request code %d from %08x\n", req, whom);
-            res = -E_INVAL;
-        }
-        ipc_send(whom, res, pg, PAGE_SIZE, perm);
-        sys_unmap_region(0, fsreq, PAGE_SIZE);
+        w->w_type = req;
+        w->w_whom = whom;
+        w->w_busy = 1;
+        serve_run(w);
     }
 }
 
 void
 umain(int argc, char **argv) {
     static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    static_assert(sizeof(struct Fsmsg) <= CHAN_MSG_SIZE, "Invalid channel message size");
     binaryname = "fs";
     cprintf("FS is running\n");
 
@@ -335,6 +901,9 @@ umain(int argc, char **argv) {
     outw(0x8A00, 0x8A00);
     cprintf("FS can do I/O\n");
 
+    assert(FSCHAN_SIZE <= FSCHAN_STRIDE);
+    assert(PAGE_SIZE + FSIPC_DATA_SIZE <= FSREQ_STRIDE - PAGE_SIZE);
+
     serve_init();
     fs_init();
     fs_test();
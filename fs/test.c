@@ -14,19 +14,19 @@ check_consistency(void) {
 
 void
 check_dir(struct File *dir) {
-    uint32_t *blk;
+    blockno_t blk;
     struct File *files;
 
     blockno_t nblock = dir->f_size / BLKSIZE;
     for (blockno_t i = 0; i < nblock; ++i) {
-        if (file_block_walk(dir, i, &blk, 0) < 0) continue;
+        if (file_block_map(dir, i, &blk) <= 0) continue;
 
-        files = (struct File *)diskaddr(*blk);
+        files = (struct File *)diskaddr(blk);
 
         for (blockno_t j = 0; j < BLKFILES; ++j) {
             struct File *f = &(files[j]);
             if (strcmp(f->f_name, "\0") != 0) {
-                blockno_t *pdiskbno = NULL;
+                blockno_t diskbno;
 
                 cprintf("checking consistency of %s\n", f->f_name);
 
@@ -34,10 +34,10 @@ check_dir(struct File *dir) {
                     if (f->f_type == FTYPE_DIR) {
                         check_dir(f);
                     }
-                    if (file_block_walk(f, k, &pdiskbno, 0) < 0 || pdiskbno == NULL || *pdiskbno == 0) {
+                    if (file_block_map(f, k, &diskbno) <= 0) {
                         continue;
                     }
-                    assert(!block_is_free(*pdiskbno));
+                    assert(!block_is_free(diskbno));
                 }
             }
         }
@@ -89,7 +89,7 @@ fs_test(void) {
 
     if ((r = file_set_size(f, 0)) < 0)
         panic("file_set_size: %i", r);
-    assert(f->f_direct[0] == 0);
+    assert(f->f_extent[0].e_len == 0 && f->f_extent[0].e_start == 0);
     assert(!is_page_dirty(f));
     cprintf("file_truncate is good\n");
 
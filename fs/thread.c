@@ -0,0 +1,81 @@
+/* Cooperative threads of the file server.
+ *
+ * Threads are switched only explicitly: thread_run() switches from the
+ * main loop to a thread, thread_yield() switches back. A thread never
+ * runs another one, so the main loop always knows which one ran last.
+ * Only callee-saved registers are kept (see thread_switch in switch.S),
+ * a switch costs about as much as a function call. */
+
+#include "fs.h"
+
+/* Stacks live here, THREAD_STACK_STRIDE bytes apart. The unmapped
+ * rest of each stride catches overflows */
+#define THREAD_STACK_VA     0x0C800000
+#define THREAD_STACK_SIZE   (8 * PAGE_SIZE)
+#define THREAD_STACK_STRIDE (2 * THREAD_STACK_SIZE)
+#define THREAD_MAX          16
+
+struct Thread {
+    uintptr_t t_rsp; /* Saved stack pointer */
+};
+
+static struct Thread threads[THREAD_MAX];
+static size_t nthreads;
+
+/* Running thread, NULL in the main loop */
+static struct Thread *thread_cur;
+static uintptr_t thread_main_rsp;
+
+/* switch.S */
+void thread_switch(uintptr_t *save_rsp, uintptr_t rsp);
+void thread_start(void);
+
+/* Create a thread that calls entry(arg) when it is first run.
+ * entry must never return. Returns 0 on success, < 0 on error */
+int
+thread_create(struct Thread **pt, void (*entry)(void *), void *arg) {
+    if (nthreads == THREAD_MAX) return -E_NO_MEM;
+
+    uintptr_t stack = THREAD_STACK_VA + nthreads * THREAD_STACK_STRIDE;
+    int res = sys_alloc_region(0, (void *)stack, THREAD_STACK_SIZE, PROT_RW);
+    if (res < 0) return res;
+
+    /* Registers popped by thread_switch, r12 and r13
+     * tell thread_start what to call */
+    uintptr_t *sp = (uintptr_t *)(stack + THREAD_STACK_SIZE) - 7;
+    memset(sp, 0, 7 * sizeof(*sp));
+    sp[2] = (uintptr_t)arg;   /* r13 */
+    sp[3] = (uintptr_t)entry; /* r12 */
+    sp[6] = (uintptr_t)thread_start;
+
+    struct Thread *t = &threads[nthreads++];
+    t->t_rsp = (uintptr_t)sp;
+    *pt = t;
+    return 0;
+}
+
+/* Run t until it yields. Called from the main loop only */
+void
+thread_run(struct Thread *t) {
+    assert(!thread_cur);
+
+    thread_cur = t;
+    thread_switch(&thread_main_rsp, t->t_rsp);
+    thread_cur = NULL;
+}
+
+/* Switch back to the main loop, which resumes
+ * the thread with thread_run() later */
+void
+thread_yield(void) {
+    struct Thread *t = thread_cur;
+    assert(t);
+
+    thread_switch(&t->t_rsp, thread_main_rsp);
+}
+
+/* Running thread, NULL if called from the main loop */
+struct Thread *
+thread_current(void) {
+    return thread_cur;
+}
@@ -0,0 +1,357 @@
+/*
+ * Legacy virtio-pci block device driver (virtio spec 0.9.5).
+ *
+ * The device has a single split virtqueue: a descriptor table, the
+ * available ring the driver publishes request chains in and the used
+ * ring the device returns them in. The queue is divided into
+ * VBLK_NREQ fixed request slots of equal descriptor chains, so large
+ * transfers are split into several requests which are all in flight
+ * at once. Completion is signalled with an interrupt, counted by the
+ * kernel in vsys[VSYS_irq + irq] like for the IDE driver.
+ */
+
+#include "fs.h"
+#include <inc/x86.h>
+
+#define VIRTIO_VENDOR     0x1AF4
+#define VIRTIO_DEVICE_BLK 0x1001 /* Transitional block device */
+
+/* Legacy registers, relative to BAR0 */
+#define VIRTIO_HOST_FEATURES  0x00
+#define VIRTIO_GUEST_FEATURES 0x04
+#define VIRTIO_QUEUE_PFN      0x08
+#define VIRTIO_QUEUE_SIZE     0x0C
+#define VIRTIO_QUEUE_SEL      0x0E
+#define VIRTIO_QUEUE_NOTIFY   0x10
+#define VIRTIO_STATUS         0x12
+#define VIRTIO_ISR            0x13
+#define VIRTIO_BLK_CAPACITY   0x14 /* 64-bit, in sectors */
+
+#define VIRTIO_STATUS_ACK       0x01
+#define VIRTIO_STATUS_DRIVER    0x02
+#define VIRTIO_STATUS_DRIVER_OK 0x04
+#define VIRTIO_STATUS_FAILED    0x80
+
+#define VIRTQ_DESC_F_NEXT  1
+#define VIRTQ_DESC_F_WRITE 2 /* Written by the device */
+
+#define VIRTQ_ALIGN PAGE_SIZE
+
+#define VIRTIO_BLK_T_IN  0
+#define VIRTIO_BLK_T_OUT 1
+
+#define VIRTIO_BLK_S_OK 0
+
+struct virtq_desc {
+    uint64_t addr;
+    uint32_t len;
+    uint16_t flags;
+    uint16_t next;
+};
+
+struct virtq_avail {
+    uint16_t flags;
+    volatile uint16_t idx;
+    uint16_t ring[];
+};
+
+struct virtq_used_elem {
+    uint32_t id;
+    uint32_t len;
+};
+
+struct virtq_used {
+    uint16_t flags;
+    volatile uint16_t idx;
+    struct virtq_used_elem ring[];
+};
+
+struct virtio_blk_req {
+    uint32_t type;
+    uint32_t reserved;
+    uint64_t sector;
+};
+
+/* Requests in flight */
+#define VBLK_NREQ 8
+
+/* The queue lives here, it has to be physically contiguous,
+ * which an aligned allocation of at most a large page is */
+#define VIRTQ_VA      0x0E000000
+#define VIRTQ_MAXSIZE 0x10000
+
+/* Every wait rechecks the used ring after this many ms */
+#define VBLK_IRQ_TIMEOUT 100
+
+/* Request headers and status bytes the device reads and writes */
+struct vblk_dma {
+    struct virtio_blk_req hdr[VBLK_NREQ];
+    volatile uint8_t status[VBLK_NREQ];
+};
+
+static struct vblk_dma dma __attribute__((aligned(PAGE_SIZE)));
+
+static struct {
+    int iobase;
+    int irq;
+    uint32_t irq_seen;
+
+    uint16_t qsize;
+    uint16_t slot_ndesc; /* Descriptors per request slot */
+    uint16_t avail_idx;  /* Next available ring entry */
+    uint16_t used_idx;   /* Next used ring entry to reap */
+
+    struct virtq_desc *desc;
+    struct virtq_avail *avail;
+    struct virtq_used *used;
+
+    uint64_t dma_pa;
+    bool busy[VBLK_NREQ];
+} vblk;
+
+const struct Disk virtio_disk = {"virtio", virtio_read, virtio_write, virtio_read_start, virtio_finish, virtio_irq};
+
+static bool
+virtio_match(struct PciFunc *f) {
+    return f->pf_vendor == VIRTIO_VENDOR && f->pf_device == VIRTIO_DEVICE_BLK &&
+           (pci_conf_read(f, PCI_BAR0) & 1);
+}
+
+/* Allocate the queue for qsize descriptors and check that it is
+ * physically contiguous. Returns its physical address, < 0 on error */
+static int64_t
+virtq_alloc(size_t size) {
+    if (sys_alloc_region(0, (void *)VIRTQ_VA, VIRTQ_MAXSIZE, PROT_RW) < 0) return -E_NO_MEM;
+
+    int64_t pa = sys_region_pa((void *)VIRTQ_VA, PROT_RW);
+    if (pa < 0) return pa;
+
+    for (size_t off = PAGE_SIZE; off < size; off += PAGE_SIZE)
+        if (sys_region_pa((void *)VIRTQ_VA + off, PROT_RW) != pa + off) return -E_NO_MEM;
+
+    return pa;
+}
+
+/* Find a virtio block device on PCI bus 0 and set up its queue.
+ * Returns false if there is none or it can't be used */
+bool
+virtio_blk_init(void) {
+    struct PciFunc f;
+    if (!pci_find(&f, virtio_match)) return 0;
+
+    pci_enable(&f);
+    int io = pci_conf_read(&f, PCI_BAR0) & 0xFFFC;
+    int irq = pci_conf_read(&f, PCI_INTR) & 0xFF;
+
+    /* Reset, then tell the device we know how to drive it
+     * and that we don't need any optional features */
+    outb(io + VIRTIO_STATUS, 0);
+    outb(io + VIRTIO_STATUS, VIRTIO_STATUS_ACK);
+    outb(io + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER);
+    outl(io + VIRTIO_GUEST_FEATURES, 0);
+
+    outw(io + VIRTIO_QUEUE_SEL, 0);
+    uint16_t qsize = inw(io + VIRTIO_QUEUE_SIZE);
+
+    size_t avail_off = qsize * sizeof(struct virtq_desc);
+    size_t used_off = ROUNDUP(avail_off + sizeof(struct virtq_avail) + (qsize + 1) * sizeof(uint16_t), VIRTQ_ALIGN);
+    size_t size = used_off + sizeof(struct virtq_used) + qsize * sizeof(struct virtq_used_elem) + sizeof(uint16_t);
+
+    int64_t qpa = -E_INVAL, dma_pa = -E_INVAL;
+    if (qsize >= VBLK_NREQ * 4 && size <= VIRTQ_MAXSIZE) {
+        qpa = virtq_alloc(size);
+        dma_pa = sys_region_pa(&dma, PROT_RW);
+    }
+    if (qpa < 0 || dma_pa < 0 || sys_irq_ack(irq) < 0) {
+        outb(io + VIRTIO_STATUS, VIRTIO_STATUS_FAILED);
+        return 0;
+    }
+
+    vblk.qsize = qsize;
+    vblk.slot_ndesc = qsize / VBLK_NREQ;
+    vblk.desc = (struct virtq_desc *)VIRTQ_VA;
+    vblk.avail = (struct virtq_avail *)(VIRTQ_VA + avail_off);
+    vblk.used = (struct virtq_used *)(VIRTQ_VA + used_off);
+    vblk.dma_pa = dma_pa;
+    vblk.irq = irq;
+    vblk.irq_seen = vsys[VSYS_irq + irq];
+
+    outl(io + VIRTIO_QUEUE_PFN, qpa / VIRTQ_ALIGN);
+    outb(io + VIRTIO_STATUS, VIRTIO_STATUS_ACK | VIRTIO_STATUS_DRIVER | VIRTIO_STATUS_DRIVER_OK);
+    vblk.iobase = io;
+
+    uint64_t capacity = inl(io + VIRTIO_BLK_CAPACITY) | (uint64_t)inl(io + VIRTIO_BLK_CAPACITY + 4) << 32;
+    cprintf("virtio-blk: %lu sectors, queue size %u, irq %d\n",
+            (unsigned long)capacity, qsize, irq);
+    return 1;
+}
+
+/* Take the requests the device has finished off the used ring */
+static void
+vblk_reap(void) {
+    while (vblk.used_idx != vblk.used->idx) {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint32_t id = vblk.used->ring[vblk.used_idx % vblk.qsize].id;
+        vblk.busy[id / vblk.slot_ndesc] = 0;
+        vblk.used_idx++;
+    }
+}
+
+/* The kernel masks the line on every interrupt. Reading the ISR
+ * deasserts it, so it can be enabled again */
+static void
+vblk_irq_ack(void) {
+    uint32_t n = vsys[VSYS_irq + vblk.irq];
+    if (n == vblk.irq_seen) return;
+
+    vblk.irq_seen = n;
+    inb(vblk.iobase + VIRTIO_ISR);
+    sys_irq_ack(vblk.irq);
+}
+
+/* Fill request slot with a chain transferring nsecs sectors starting
+ * at secno from or to buf and make it available to the device.
+ * Returns -E_NOT_SUPP if buf can't be used for DMA */
+static int
+vblk_start(int slot, uint32_t secno, void *buf, size_t nsecs, bool write) {
+    struct virtq_desc *d = vblk.desc + slot * vblk.slot_ndesc;
+    uintptr_t va = (uintptr_t)buf, end = va + nsecs * SECTSIZE;
+    int n = 0;
+
+    dma.hdr[slot] = (struct virtio_blk_req){
+            .type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN,
+            .sector = secno};
+    dma.status[slot] = 0xFF;
+
+    d[n++] = (struct virtq_desc){
+            .addr = vblk.dma_pa + offsetof(struct vblk_dma, hdr[slot]),
+            .len = sizeof(dma.hdr[slot]),
+            .flags = VIRTQ_DESC_F_NEXT};
+
+    while (va < end) {
+        size_t len = MIN(end - va, PAGE_SIZE - PAGE_OFFSET(va));
+        int64_t pa = sys_region_pa((void *)va, write ? PROT_R : PROT_RW);
+        if (pa < 0) return -E_NOT_SUPP;
+
+        d[n++] = (struct virtq_desc){
+                .addr = pa,
+                .len = len,
+                .flags = VIRTQ_DESC_F_NEXT | (write ? 0 : VIRTQ_DESC_F_WRITE)};
+        va += len;
+    }
+
+    d[n++] = (struct virtq_desc){
+            .addr = vblk.dma_pa + offsetof(struct vblk_dma, status[slot]),
+            .len = 1,
+            .flags = VIRTQ_DESC_F_WRITE};
+
+    for (int i = 0; i < n - 1; i++)
+        d[i].next = slot * vblk.slot_ndesc + i + 1;
+
+    vblk.busy[slot] = 1;
+    vblk.avail->ring[vblk.avail_idx % vblk.qsize] = slot * vblk.slot_ndesc;
+    vblk.avail_idx++;
+    return 0;
+}
+
+/* Sleep until the device has finished all requests in flight if wait
+ * is set. Returns -E_AGAIN if some are not finished and wait is not set,
+ * -1 if any of them has failed */
+static int
+vblk_finish(bool wait) {
+    for (;;) {
+        uint32_t seen = vsys[VSYS_irq + vblk.irq];
+        vblk_irq_ack();
+        vblk_reap();
+
+        bool busy = 0;
+        for (int i = 0; i < VBLK_NREQ; i++)
+            busy |= vblk.busy[i];
+        if (!busy) break;
+        if (!wait) return -E_AGAIN;
+
+        sys_futex_wait((const volatile uint32_t *)&vsys[VSYS_irq + vblk.irq], seen, VBLK_IRQ_TIMEOUT);
+    }
+
+    int res = 0;
+    for (int i = 0; i < VBLK_NREQ; i++)
+        if (dma.status[i] != VIRTIO_BLK_S_OK && dma.status[i] != 0xFF) res = -1;
+    return res;
+}
+
+/* Sectors in one request, a request takes at most slot_ndesc - 3
+ * pages (an unaligned buffer takes one descriptor more than that) */
+static size_t
+vblk_maxsecs(void) {
+    return (vblk.slot_ndesc - 3) * (PAGE_SIZE / SECTSIZE);
+}
+
+/* Split the beginning of the transfer into up to VBLK_NREQ requests
+ * and notify the device once. Advances the transfer past them */
+static int
+vblk_submit(uint32_t *secno, void **buf, size_t *nsecs, bool write) {
+    int res = 0;
+
+    for (int i = 0; i < VBLK_NREQ; i++)
+        dma.status[i] = 0xFF;
+
+    for (int slot = 0; slot < VBLK_NREQ && *nsecs > 0; slot++) {
+        size_t n = MIN(*nsecs, vblk_maxsecs());
+        if ((res = vblk_start(slot, *secno, *buf, n, write)) < 0) break;
+        *secno += n;
+        *buf += n * SECTSIZE;
+        *nsecs -= n;
+    }
+
+    /* Descriptors have to be visible before the index */
+    __atomic_store_n(&vblk.avail->idx, vblk.avail_idx, __ATOMIC_RELEASE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    outw(vblk.iobase + VIRTIO_QUEUE_NOTIFY, 0);
+    return res;
+}
+
+static int
+vblk_rw(uint32_t secno, void *buf, size_t nsecs, bool write) {
+    if ((uintptr_t)buf % SECTSIZE) return -E_INVAL;
+
+    while (nsecs > 0) {
+        int res = vblk_submit(&secno, &buf, &nsecs, write);
+        int r = vblk_finish(1);
+        if (res < 0) return res;
+        if (r < 0) return r;
+    }
+
+    return 0;
+}
+
+int
+virtio_read(uint32_t secno, void *dst, size_t nsecs) {
+    return vblk_rw(secno, dst, nsecs, 0);
+}
+
+int
+virtio_write(uint32_t secno, const void *src, size_t nsecs) {
+    return vblk_rw(secno, (void *)src, nsecs, 1);
+}
+
+/* Start reading without waiting for the data, see struct Disk */
+int
+virtio_read_start(uint32_t secno, void *dst, size_t nsecs) {
+    if ((uintptr_t)dst % SECTSIZE || nsecs > VBLK_NREQ * vblk_maxsecs()) return -E_NOT_SUPP;
+
+    if (vblk_submit(&secno, &dst, &nsecs, 0) < 0) {
+        vblk_finish(1);
+        return -E_NOT_SUPP;
+    }
+    return 0;
+}
+
+int
+virtio_finish(bool wait) {
+    return vblk_finish(wait);
+}
+
+int
+virtio_irq(void) {
+    return vblk.irq;
+}
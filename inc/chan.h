@@ -0,0 +1,29 @@
+#ifndef JOS_INC_CHAN_H
+#define JOS_INC_CHAN_H
+
+#include <inc/types.h>
+
+/* Single-producer/single-consumer rings of fixed-size messages
+ * living in memory shared by two environments (see lib/chan.c).
+ *
+ * Only the producer writes cr_tail and only the consumer writes
+ * cr_head, they are kept on separate cache lines. A consumer that
+ * is going to sleep sets cr_waiting, the producer clears it when
+ * it publishes a message and rings the doorbell: a futex wakeup
+ * on cr_tail or any other wakeup both sides agreed on */
+
+#define CHAN_MSG_SIZE 512
+#define CHAN_NSLOTS   16
+
+struct ChanRing {
+    /* Consumer side */
+    volatile uint32_t cr_head;    /* Next message to consume */
+    volatile uint32_t cr_waiting; /* Consumer wants a doorbell */
+
+    /* Producer side */
+    volatile uint32_t cr_tail __attribute__((aligned(64))); /* Next free slot */
+
+    uint8_t cr_slots[CHAN_NSLOTS][CHAN_MSG_SIZE] __attribute__((aligned(64)));
+} __attribute__((aligned(64)));
+
+#endif /* !JOS_INC_CHAN_H */
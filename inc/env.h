@@ -47,14 +47,30 @@ enum EnvType {
     ENV_TYPE_FS, /* File system server */
 };
 
+/* Scheduling priorities, each one has its own run queue.
+ * Lower value is more urgent */
+enum EnvPriority {
+    ENV_PRIO_HIGH,
+    ENV_PRIO_NORMAL,
+    ENV_PRIO_LOW,
+    ENV_PRIO_IDLE,
+    ENV_NPRIO
+};
+
 struct List {
     struct List *prev, *next;
 };
 
+struct spinlock;
+
 struct AddressSpace {
-    pml4e_t *pml4;     /* Virtual address of pml4 */
-    uintptr_t cr3;     /* Physical address of pml4 */
-    struct Page *root; /* root node of address space tree */
+    pml4e_t *pml4;          /* Virtual address of pml4 */
+    uintptr_t cr3;          /* Physical address of pml4 */
+    struct Page *root;      /* root node of address space tree */
+    /* Protects the tree and user part of page tables. The lock lives in
+     * kernel memory: its size depends on the kernel configuration,
+     * while struct Env is mapped to user space at UENVS */
+    struct spinlock *lock;
 };
 
 
@@ -66,6 +82,11 @@ struct Env {
     enum EnvType env_type;   /* Indicates special system environments */
     unsigned env_status;     /* Status of the environment */
     uint32_t env_runs;       /* Number of times environment has run */
+    int env_cpunum;          /* The CPU that the env is running on */
+
+    enum EnvPriority env_priority; /* Run queue this env is placed to */
+    struct List env_rq;            /* Run queue link (only while ENV_RUNNABLE) */
+    int env_rq_cpu;                /* CPU whose run queue env_rq is linked to */
 
     uint8_t *binary; /* Pointer to process ELF image in kernel memory */
 
@@ -82,6 +103,26 @@ struct Env {
     uint32_t env_ipc_value;  /* Data value sent to us */
     envid_t env_ipc_from;    /* envid of the sender */
     int env_ipc_perm;        /* Perm of page mapping received */
+
+    /* Blocking sys_ipc_send() */
+    struct List env_ipc_senders;  /* Senders blocked on us, in FIFO order */
+    struct List env_ipc_link;     /* Link in env_ipc_senders of the receiver */
+    uint32_t env_ipc_send_value;  /* Message of the blocked sender */
+    uintptr_t env_ipc_send_srcva;
+    size_t env_ipc_send_size;
+    int env_ipc_send_perm;
+
+    /* Futex wait state, see kern/futex.c */
+    struct List env_futex;       /* Wait queue link (only while waiting) */
+    uintptr_t env_futex_key;     /* Physical (or UENVS) address of the word */
+    uint64_t env_futex_deadline; /* TSC value of the timeout, 0 if none */
+    uint32_t env_wait_seq;       /* Bumped when the env exits or blocks in
+                                  * sys_ipc_recv(), others can wait for it */
+
+    struct SyscallRing *env_sc_ring; /* Registered system call ring (user address) */
+    uint64_t env_syscalls;           /* Number of kernel entries for system calls */
+    uint64_t env_cycles;             /* TSC cycles spent running (see env_account()) */
+    uint64_t env_ipc_sends;          /* Number of IPC messages delivered */
 };
 
 #endif /* !JOS_INC_ENV_H */
@@ -27,6 +27,11 @@ enum {
     E_FILE_EXISTS = 17, /* File already exists */
     E_NOT_EXEC = 18,    /* File not a valid executable */
     E_NOT_SUPP = 19,    /* Operation not supported */
+    /* Futex error codes */
+    E_AGAIN = 20,   /* Futex value has changed */
+    E_TIMEOUT = 21, /* Wait timed out */
+    /* File system again */
+    E_BUSY = 22, /* File is in use */
     MAXERROR
 };
 
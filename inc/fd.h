@@ -8,6 +8,9 @@
 #include <inc/types.h>
 #include <inc/fs.h>
 
+/* Maximum number of file descriptors a program may hold open concurrently */
+#define MAXFD 32
+
 struct Fd;
 struct Stat;
 struct Dev;
@@ -21,10 +24,14 @@ struct Dev {
     int (*dev_close)(struct Fd *fd);
     int (*dev_stat)(struct Fd *fd, struct Stat *stat);
     int (*dev_trunc)(struct Fd *fd, off_t length);
+    int (*dev_seek)(struct Fd *fd, off_t offset);
 };
 
 struct FdFile {
     int id;
+    /* Bumped by the file server whenever the file changes,
+     * see the buffering in lib/file.c */
+    uint32_t gen;
 };
 
 struct Fd {
@@ -5,6 +5,7 @@
 
 #include <inc/types.h>
 #include <inc/mmu.h>
+#include <inc/chan.h>
 
 typedef uint32_t blockno_t;
 
@@ -21,42 +22,73 @@ typedef uint32_t blockno_t;
 /* Maximum size of a complete pathname, including null */
 #define MAXPATHLEN 1024
 
-/* Number of block pointers in a File descriptor */
-#define NDIRECT 10
-/* Number of direct block pointers in an indirect block */
+/* Number of extents in a File descriptor */
+#define NEXTENT 13
+/* Number of block pointers in an indirect block */
 #define NINDIRECT (BLKSIZE / 4)
 
-#define MAXFILESIZE ((NDIRECT + NINDIRECT) * BLKSIZE)
+/* Blocks past the extents are mapped by the indirect block
+ * and then by the double-indirect one */
+#define MAXFILEBLOCKS ((uint64_t)NINDIRECT + (uint64_t)NINDIRECT * NINDIRECT)
+
+/* That is more than a 32-bit off_t can address */
+#define MAXFILESIZE 0x7FFFFFFF
 
 #define SETBIT(v, n) ((v)[(n / 32)] |= 1U << ((n) % 32))
 #define CLRBIT(v, n) ((v)[(n / 32)] &= ~(1U << ((n) % 32)))
 #define TSTBIT(v, n) ((v)[(n / 32)] & (1U << ((n) % 32)))
 
+/* Run of e_len blocks adjacent on disk, starting at block e_start */
+struct Extent {
+    blockno_t e_start;
+    uint32_t e_len;
+} __attribute__((packed));
+
 struct File {
     char f_name[MAXNAMELEN]; /* filename */
     off_t f_size;            /* file size in bytes */
     uint32_t f_type;         /* file type */
 
-    /* Block pointers. */
-    /* A block is allocated iff its value is != 0. */
-    blockno_t f_direct[NDIRECT]; /* direct blocks */
-    blockno_t f_indirect;        /* indirect block */
+    /* The extents map the first blocks of the file one after another,
+     * the list ends at the first extent with e_len == 0. The indirect
+     * blocks map the rest, f_indirect covers file blocks below NINDIRECT
+     * and f_dindirect those above. Once either exists the extents are not
+     * extended any more, so the indirect blocks only map blocks past them.
+     * A block is allocated iff its number is != 0. */
+    struct Extent f_extent[NEXTENT]; /* extents */
+    blockno_t f_indirect;            /* indirect block */
+    blockno_t f_dindirect;           /* double-indirect block */
+
+    blockno_t f_dirindex; /* struct DirIndex block of a directory, 0 if none */
+    uint32_t f_hnext;     /* next entry of the DirIndex bucket, slot + 1 */
 
-    /* Pad out to 256 bytes; must do arithmetic in case we're compiling
-     * fsformat on a 64-bit machine. */
-    uint8_t f_pad[256 - MAXNAMELEN - 8 - 4 * NDIRECT - 4];
+    /* No padding, the fields add up to 256 bytes */
 } __attribute__((packed)); /* required only on some 64-bit machines */
 
 /* An inode block contains exactly BLKFILES 'struct File's */
 #define BLKFILES (BLKSIZE / sizeof(struct File))
 
+/* Optional hashed index of a large directory. Entries are identified
+ * by their position in the directory (slot), buckets hold slot + 1 of
+ * the first entry in the chain or 0 and the chain continues through
+ * File.f_hnext. The buckets fill di_nblocks blocks */
+#define DIRINDEX_MAXBLOCKS (BLKSIZE / 4 - 3)
+#define DIRINDEX_NBUCKETS  (BLKSIZE / 4) /* per block */
+
+struct DirIndex {
+    uint32_t di_nblocks;   /* Bucket blocks, a power of 2 */
+    uint32_t di_count;     /* Entries in the index */
+    uint32_t di_free_hint; /* Directory blocks below this one are full */
+    blockno_t di_buckets[DIRINDEX_MAXBLOCKS];
+};
+
 /* File types */
 #define FTYPE_REG 0 /* Regular file */
 #define FTYPE_DIR 1 /* Directory */
 
 /* File system super-block (both in-memory and on-disk) */
 
-#define FS_MAGIC 0x4A0530AE /* related vaguely to 'J\0S!' */
+#define FS_MAGIC 0x4A0531AE /* related vaguely to 'J\0S!', revision 2: extents */
 
 struct Super {
     uint32_t s_magic;    /* Magic number: FS_MAGIC */
@@ -65,17 +97,65 @@ struct Super {
 };
 
 /* Definitions for requests from clients to file system */
+
+/* Requests are sent as a region of the request page (union Fsipc)
+ * followed by up to FSIPC_DATA_SIZE bytes of the data area, reads
+ * and writes move their data through it. Client and server keep
+ * the region aligned to FSIPC_DATA_SIZE, so it is mapped with
+ * large page classes */
+#define FSIPC_DATA_SIZE (16 * PAGE_SIZE)
+
 enum {
     FSREQ_OPEN = 1,
     FSREQ_SET_SIZE,
-    /* Read returns a Fsret_read on the request page */
+    /* Read returns the data in the data area */
     FSREQ_READ,
     FSREQ_WRITE,
     /* Stat returns a Fsret_stat on the request page */
     FSREQ_STAT,
     FSREQ_FLUSH,
     FSREQ_REMOVE,
-    FSREQ_SYNC
+    FSREQ_SYNC,
+    /* Sets up a channel, the request region is a struct FsChannel */
+    FSREQ_CHANNEL,
+    /* Channel doorbell, carries no page and gets no reply */
+    FSREQ_DOORBELL,
+    /* Returns a struct DiskStat on the request page */
+    FSREQ_DISKSTAT,
+    /* Returns a struct CacheStat on the request page */
+    FSREQ_CACHESTAT,
+    /* Write out one file, its metadata and the block bitmap */
+    FSREQ_FSYNC,
+    /* Same as FSREQ_READ, but block cache pages are mapped
+     * copy-on-write at the client's buffer instead */
+    FSREQ_READ_MAP,
+    /* Maps pages of a file for mmap(), see serve_map() */
+    FSREQ_MAP
+};
+
+/* Reads and writes at this req_offset start at fd_offset and advance
+ * it, others leave fd_offset alone (see lib/file.c buffered I/O) */
+#define FSREQ_OFFSET_CUR (-1)
+
+/* Largest FSREQ_READ_MAP and FSREQ_MAP request */
+#define FSMAP_MAX_SIZE (64 * PAGE_SIZE)
+
+/* Block cache disk traffic */
+struct DiskStat {
+    uint64_t ds_reads;        /* Read commands issued */
+    uint64_t ds_read_blocks;  /* Blocks read */
+    uint64_t ds_writes;       /* Write commands issued */
+    uint64_t ds_write_blocks; /* Blocks written */
+};
+
+/* Block cache efficiency */
+struct CacheStat {
+    uint64_t cs_hits;      /* Block lookups which found the block in memory */
+    uint64_t cs_misses;    /* Blocks read from the disk on demand */
+    uint64_t cs_readahead; /* Blocks read ahead */
+    uint64_t cs_evictions; /* Blocks evicted */
+    uint64_t cs_resident;  /* Blocks in memory now */
+    uint64_t cs_budget;    /* Maximum number of blocks in memory */
 };
 
 union Fsipc {
@@ -89,16 +169,20 @@ union Fsipc {
     } set_size;
     struct Fsreq_read {
         int req_fileid;
+        off_t req_offset; /* FSREQ_OFFSET_CUR or where to read */
         size_t req_n;
     } read;
-    struct Fsret_read {
-        char ret_buf[PAGE_SIZE];
-    } readRet;
     struct Fsreq_write {
         int req_fileid;
-        size_t req_n;
-        char req_buf[PAGE_SIZE - (2 * sizeof(size_t))];
+        off_t req_offset; /* FSREQ_OFFSET_CUR or where to write */
+        size_t req_n;     /* Data is in the data area */
     } write;
+    struct Fsreq_map {
+        int req_fileid;
+        off_t req_offset; /* Page aligned */
+        size_t req_n;
+        int req_perm; /* PROT_R or PROT_RW, PROT_LAZY for private mappings */
+    } map;
     struct Fsreq_stat {
         int req_fileid;
     } stat;
@@ -110,12 +194,56 @@ union Fsipc {
     struct Fsreq_flush {
         int req_fileid;
     } flush;
+    struct Fsreq_fsync {
+        int req_fileid;
+    } fsync;
     struct Fsreq_remove {
         char req_path[MAXPATHLEN];
     } remove;
+    struct DiskStat diskstatRet;
+    struct CacheStat cachestatRet;
 
     /* Ensure Fsipc is one page */
     char _pad[PAGE_SIZE];
 };
 
+/* Channels are an alternative to IPC for requests on open files.
+ * Client queues requests to fc_req and the server answers them
+ * in order in fc_resp, so a client can have up to CHAN_NSLOTS
+ * requests in flight without blocking. The server sleeps in
+ * ipc_recv() and is woken up with FSREQ_DOORBELL, clients
+ * sleep in chan_wait(). Only FSCHAN_TYPE() requests can be sent,
+ * the rest don't fit into struct Fsmsg and go through IPC */
+
+#define FSCHAN_TYPE(t) ((t) == FSREQ_READ || (t) == FSREQ_WRITE || (t) == FSREQ_STAT || \
+                        (t) == FSREQ_FLUSH || (t) == FSREQ_SET_SIZE || (t) == FSREQ_FSYNC)
+
+#define FSCHAN_DATA_SIZE (CHAN_MSG_SIZE - 32)
+
+struct Fsmsg {
+    uint32_t fm_type; /* FSREQ_* */
+    int32_t fm_res;   /* Result, set by the server */
+    /* Pieces of one read or write share a nonzero chain, once one of
+     * them fails or comes back short the rest fail with -E_AGAIN */
+    uint32_t fm_chain;
+    union {
+        struct Fsreq_set_size set_size;
+        struct Fsreq_read read;
+        struct Fsreq_write write;
+        struct Fsreq_stat stat;
+        struct Fsreq_flush flush;
+        struct Fsreq_fsync fsync;
+    } fm_req;
+    /* Read and written data, Fsret_stat for FSREQ_STAT */
+    uint8_t fm_data[FSCHAN_DATA_SIZE];
+};
+
+struct FsChannel {
+    int32_t fc_client;       /* Environment which set the channel up */
+    struct ChanRing fc_req;  /* Requests, client to server */
+    struct ChanRing fc_resp; /* Responses, server to client */
+};
+
+#define FSCHAN_SIZE ROUNDUP(sizeof(struct FsChannel), PAGE_SIZE)
+
 #endif /* !JOS_INC_FS_H */
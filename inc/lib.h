@@ -21,6 +21,7 @@
 #include <inc/fs.h>
 #include <inc/fd.h>
 #include <inc/args.h>
+#include <inc/chan.h>
 
 #ifdef SANITIZE_USER_SHADOW_BASE
 /* asan unpoison routine used for whitelisting regions. */
@@ -92,8 +93,16 @@ int sys_map_region(envid_t src_env, void *src_pg,
                    envid_t dst_env, void *dst_pg, size_t size, int perm);
 int sys_unmap_region(envid_t env, void *pg, size_t size);
 int sys_ipc_try_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
+int sys_ipc_send(envid_t to_env, uint64_t value, void *pg, size_t size, int perm);
 int sys_ipc_recv(void *rcv_pg, size_t size);
+int sys_ipc_recv_futex(void *rcv_pg, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout);
 int sys_gettime(void);
+int sys_ring_register(struct SyscallRing *ring);
+int sys_ring_enter(void);
+int sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout);
+int sys_futex_wake(const volatile uint32_t *addr, int n);
+int64_t sys_region_pa(void *va, int perm);
+int sys_irq_ack(int irq);
 
 int vsys_gettime(void);
 
@@ -101,17 +110,41 @@ int vsys_gettime(void);
 static inline envid_t __attribute__((always_inline))
 sys_exofork(void) {
     envid_t ret;
-    asm volatile("int %2"
+    asm volatile("syscall"
                  : "=a"(ret)
-                 : "a"(SYS_exofork), "i"(T_SYSCALL));
+                 : "a"(SYS_exofork)
+                 : "rcx", "r11", "rdx", "rsi", "rdi", "r8", "r9", "r10", "cc", "memory");
     return ret;
 }
 
+/* scring.c */
+void scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6);
+int scring_submit(void);
+void scring_discard(void);
+void scring_alloc_region(envid_t env, void *pg, size_t size, int perm);
+void scring_map_region(envid_t src_env, void *src_pg,
+                       envid_t dst_env, void *dst_pg, size_t size, int perm);
+void scring_unmap_region(envid_t env, void *pg, size_t size);
+void scring_env_set_status(envid_t env, int status);
+void scring_env_set_trapframe(envid_t env, struct Trapframe *tf);
+
 /* ipc.c */
 void ipc_send(envid_t to_env, uint32_t value, void *pg, size_t size, int perm);
 int32_t ipc_recv(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store);
+int32_t ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *psize, int *perm_store,
+                       const volatile uint32_t *addr, uint32_t expected, unsigned timeout);
 envid_t ipc_find_env(enum EnvType type);
 
+/* chan.c */
+void chan_init(struct ChanRing *r);
+void *chan_prepare(struct ChanRing *r);
+bool chan_publish(struct ChanRing *r);
+void *chan_peek(struct ChanRing *r);
+void chan_release(struct ChanRing *r);
+bool chan_arm(struct ChanRing *r);
+void chan_wait(struct ChanRing *r);
+void chan_notify(struct ChanRing *r);
+
 /* fork.c */
 envid_t fork(void);
 envid_t sfork(void);
@@ -139,6 +172,13 @@ int open(const char *path, int mode);
 int ftruncate(int fd, off_t size);
 int remove(const char *path);
 int sync(void);
+int fsync(int fdnum);
+int disk_stat(struct DiskStat *st);
+int cache_stat(struct CacheStat *st);
+int fs_channel(bool enable);
+int mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset);
+int munmap(void *addr, size_t len);
+void file_flush_buffers(void);
 
 /* spawn.c */
 envid_t spawn(const char *program, const char **argv);
@@ -168,6 +208,12 @@ void wait(envid_t env);
 #define O_EXCL  0x0400 /* error if already exists */
 #define O_MKDIR 0x0800 /* create directory, not regular file */
 
+/* mmap() flags */
+#define MAP_SHARED   0x1 /* Read-only view of the file */
+#define MAP_PRIVATE  0x2 /* Copy-on-write copy of the file */
+#define MAP_FIXED    0x4 /* Map at the given address */
+#define MAP_POPULATE 0x8 /* Map all pages right away */
+
 #ifdef JOS_PROG
 extern void (*volatile sys_exit)(void);
 extern void (*volatile sys_yield)(void);
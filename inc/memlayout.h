@@ -12,13 +12,14 @@
  * which are relevant to both the kernel and user-mode software.
  */
 
-/* Global descriptor numbers */
+/* Global descriptor numbers
+ * (SYSRET requires user data to immediately precede user text) */
 #define GD_KT   0x08 /* kernel text */
 #define GD_KD   0x10 /* kernel data */
 #define GD_KT32 0x18 /* kernel text 32bit */
 #define GD_KD32 0x20 /* kernel data 32bit */
-#define GD_UT   0x28 /* user text */
-#define GD_UD   0x30 /* user data */
+#define GD_UD   0x28 /* user data */
+#define GD_UT   0x30 /* user text */
 #define GD_TSS0 0x38 /* Task segment selector for CPU 0 */
 
 /*
@@ -110,6 +111,10 @@
 #define IOPHYSMEM  0x0A0000
 #define EXTPHYSMEM 0x100000
 
+/* Physical address of the application processors' bootstrap code
+ * (it is started in real mode so it should be below 1MB) */
+#define MPENTRY_PADDR 0x7000
+
 /* Amount of memory mapped by entrypgdir */
 #define BOOT_MEM_SIZE (1024 * 1024 * 1024ULL)
 
@@ -121,6 +126,11 @@
 #define KERN_STACK_GAP     (8 * PAGE_SIZE)                                     /* size of a kernel stack guard */
 #define KERN_PF_STACK_TOP  (KERN_STACK_TOP - KERN_STACK_SIZE - KERN_STACK_GAP) /* size of page fault handler stack size */
 
+/* Kernel and #PF stacks of CPU i (CPU0 uses KERN_STACK_TOP and KERN_PF_STACK_TOP) */
+#define KERN_CPU_STACKS_SIZE     (KERN_STACK_SIZE + KERN_PF_STACK_SIZE + 2 * KERN_STACK_GAP)
+#define KERN_STACK_TOP_CPU(i)    (KERN_STACK_TOP - (i)*KERN_CPU_STACKS_SIZE)
+#define KERN_PF_STACK_TOP_CPU(i) (KERN_STACK_TOP_CPU(i) - KERN_STACK_SIZE - KERN_STACK_GAP)
+
 /* Memory-mapped IO */
 #define KERN_HEAP_END   (KERN_STACK_TOP - HUGE_PAGE_SIZE)
 #define KERN_HEAP_START (KERN_HEAP_END - HUGE_PAGE_SIZE * 256) /* Max size of kernel heap is 512MB */
@@ -141,10 +141,17 @@
 
 /* x86_64 related changes */
 #define EFER_MSR 0xC0000080
+#define EFER_SCE (1ULL << 0)
 #define EFER_LME (1ULL << 8)
 #define EFER_LMA (1ULL << 10)
 #define EFER_NXE (1ULL << 11)
 
+/* SYSCALL/SYSRET configuration */
+#define STAR_MSR           0xC0000081 /* Segment selectors */
+#define LSTAR_MSR          0xC0000082 /* 64-bit mode entry point */
+#define SFMASK_MSR         0xC0000084 /* RFLAGS bits cleared on entry */
+#define KERNEL_GS_BASE_MSR 0xC0000102 /* GS base swapped in by swapgs */
+
 /* RFLAGS register */
 #define FL_CF        0x00000001 /* Carry Flag */
 #define FL_PF        0x00000004 /* Parity Flag */
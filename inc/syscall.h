@@ -19,7 +19,38 @@ enum {
     SYS_ipc_try_send,
     SYS_ipc_recv,
     SYS_gettime,
+    SYS_ring_register,
+    SYS_ring_enter,
+    SYS_futex_wait,
+    SYS_futex_wake,
+    SYS_ipc_send,
+    SYS_region_pa,
+    SYS_irq_ack,
     NSYSCALLS
 };
 
+#ifndef __ASSEMBLER__
+#include <inc/types.h>
+
+/* Batched system call descriptor */
+struct SyscallDesc {
+    uint64_t sd_num;     /* System call number */
+    uint64_t sd_args[6]; /* Arguments */
+    int64_t sd_res;      /* Result, filled by the kernel */
+};
+
+#define SCRING_SIZE 32
+
+/* Submission ring shared by an environment with the kernel
+ * (see sys_ring_register() and sys_ring_enter() in kern/syscall.c).
+ * The user fills descriptors at sr_tail, the kernel executes
+ * them starting from sr_head, stores results in place and
+ * advances sr_head. Both indexes are free-running */
+struct SyscallRing {
+    volatile uint32_t sr_head;
+    volatile uint32_t sr_tail;
+    struct SyscallDesc sr_desc[SCRING_SIZE];
+};
+#endif
+
 #endif /* !JOS_INC_SYSCALL_H */
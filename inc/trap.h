@@ -32,13 +32,15 @@
 #define IRQ_OFFSET 32 /* IRQ 0 corresponds to int IRQ_OFFSET */
 
 /* Hardware IRQ numbers. We receive these as (IRQ_OFFSET+IRQ_WHATEVER) */
-#define IRQ_TIMER    0
-#define IRQ_KBD      1
-#define IRQ_SERIAL   4
-#define IRQ_SPURIOUS 7
-#define IRQ_CLOCK    8
-#define IRQ_IDE      14
-#define IRQ_ERROR    19
+#define IRQ_TIMER       0
+#define IRQ_KBD         1
+#define IRQ_SERIAL      4
+#define IRQ_SPURIOUS    7
+#define IRQ_CLOCK       8
+#define IRQ_IDE         14
+#define IRQ_ERROR       19
+#define IRQ_LAPIC_TIMER 20 /* Local APIC timer of application processors */
+#define IRQ_RESCHED     21 /* Inter-processor reschedule request */
 
 #define UTRAP_RSP 152
 #define UTRAP_RIP 136
@@ -4,6 +4,12 @@
 /* system call numbers */
 enum {
     VSYS_gettime,
+    /* Interrupt counters for user-level drivers: vsys[VSYS_irq + n]
+     * is bumped on IRQ n, drivers wait for it with sys_futex_wait()
+     * (see sys_irq_ack()) */
+    VSYS_irq,
+    /* TSC frequency in kHz */
+    VSYS_tsc_khz = VSYS_irq + 16,
     NVSYSCALLS
 };
 
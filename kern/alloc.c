@@ -7,6 +7,8 @@
 
 static uint8_t space[SPACE_SIZE];
 
+static struct spinlock alloc_lock = SPINLOCK_INIT(alloc_lock, LOCK_ORDER_ALLOC);
+
 /* empty list to get started */
 static Header base = {.next = (Header *)space, .prev = (Header *)space};
 /* start of free list */
@@ -29,7 +31,7 @@ test_alloc(uint8_t nbytes) {
 
     /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
     // LAB 5: Your code here
-	spin_lock(&kernel_lock);
+	spin_lock(&alloc_lock);
     size_t nunits = (nbytes + sizeof(Header) - 1) / sizeof(Header) + 1;
 
     /* no free list yet */
@@ -58,12 +60,13 @@ test_alloc(uint8_t nbytes) {
                 p += p->size;
                 p->size = nunits;
             }
+            spin_unlock(&alloc_lock);
             return (void *)(p + 1);
         }
 
         /* wrapped around free list */
         if (p == freep) {
-			spin_unlock(&kernel_lock);
+			spin_unlock(&alloc_lock);
             return NULL;
         }
     }
@@ -78,7 +81,7 @@ test_free(void *ap) {
 
     /* Make allocator thread-safe with the help of spin_lock/spin_unlock. */
     // LAB 5: Your code here
-	spin_lock(&kernel_lock);
+	spin_lock(&alloc_lock);
     /* freed block at start or end of arena */
     Header *p = freep;
     for (; !(bp > p && bp < p->next); p = p->next)
@@ -105,5 +108,5 @@ test_free(void *ap) {
     freep = p;
 
     check_list();
-    spin_unlock(&kernel_lock);
+    spin_unlock(&alloc_lock);
 }
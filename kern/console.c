@@ -11,6 +11,7 @@
 #include <kern/console.h>
 #include <kern/picirq.h>
 #include <kern/pmap.h>
+#include <kern/spinlock.h>
 
 #define COM1 0x3F8
 
@@ -502,17 +503,26 @@ static struct {
     uint32_t wpos;
 } cons;
 
+/* Protects input buffer and device state of keyboard and serial port
+ * (input is polled from any CPU in cons_getc()) */
+static struct spinlock cons_in_lock = SPINLOCK_INIT(cons_in_lock, LOCK_ORDER_CONS_IN);
+
+/* Serializes cprintf() so that lines from different CPUs are not mixed */
+struct spinlock console_lock = SPINLOCK_INIT(console_lock, LOCK_ORDER_CONSOLE);
+
 /* called by device interrupt routines to feed input characters
  * into the circular console input buffer */
 static void
 cons_intr(int (*proc)(void)) {
     int ch;
 
+    spin_lock(&cons_in_lock);
     while ((ch = (*proc)()) != -1) {
         if (!ch) continue;
         cons.buf[cons.wpos++] = ch;
         if (cons.wpos == CONSBUFSIZE) cons.wpos = 0;
     }
+    spin_unlock(&cons_in_lock);
 }
 
 /* Return the next input character from the console, or 0 if none waiting */
@@ -526,12 +536,14 @@ cons_getc(void) {
     kbd_intr();
 
     /* Grab the next character from the input buffer */
+    int ch = 0;
+    spin_lock(&cons_in_lock);
     if (cons.rpos != cons.wpos) {
-        uint8_t ch = cons.buf[cons.rpos++];
+        ch = cons.buf[cons.rpos++];
         cons.rpos %= CONSBUFSIZE;
-        return ch;
     }
-    return 0;
+    spin_unlock(&cons_in_lock);
+    return ch;
 }
 
 /* Output a character to the console */
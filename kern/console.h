@@ -7,6 +7,7 @@
 #endif
 
 #include <inc/types.h>
+#include <kern/spinlock.h>
 
 #define CRT_ROWS    25
 #define CRT_COLS    80
@@ -22,4 +23,7 @@ void kbd_intr(void);
 /* IRQ4 */
 void serial_intr(void);
 
+/* Held by cprintf() while printing, see console.c */
+extern struct spinlock console_lock;
+
 #endif /* _CONSOLE_H_ */
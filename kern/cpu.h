@@ -6,11 +6,73 @@
 #include <inc/memlayout.h>
 #include <inc/mmu.h>
 #include <inc/env.h>
+#include <kern/spinlock.h>
+#include <kern/traceopt.h>
 
-#define NCPU 1
+/* Maximum number of CPUs */
+#define NCPU 8
 
-/* Used by x86 to find stack for interrupt */
-extern struct Taskstate cpu_ts;
+/* Maximum number of locks held by one CPU at once */
+#define NLOCKDEPTH 8
+
+/* Values of status in struct CpuInfo */
+enum {
+    CPU_UNUSED = 0,
+    CPU_STARTED,
+    CPU_HALTED,
+};
+
+/* Per-CPU data of syscall_entry in kern/trapentry.S, which
+ * accesses it through %gs (keep offsets in sync with SC_* there) */
+struct SyscallCpu {
+    uintptr_t sc_kstack; /* Top of the kernel stack */
+    uintptr_t sc_tf;     /* End of curenv->env_tf */
+    uintptr_t sc_ursp;   /* User %rsp while saving registers */
+};
+
+/* Per-CPU state */
+struct CpuInfo {
+    uint8_t cpu_id;                 /* Index into cpus[] below */
+    uint8_t cpu_apicid;             /* Local APIC ID */
+    volatile unsigned cpu_status;   /* The status of the CPU */
+    struct Env *cpu_env;            /* The currently-running environment */
+    struct AddressSpace *cpu_space; /* The currently-active address space */
+    bool cpu_in_page_fault;         /* We do not support recursive page faults in-kernel */
+    struct Taskstate cpu_ts;        /* Used by x86 to find stack for interrupt */
+    struct SyscallCpu cpu_syscall;  /* Used by SYSCALL entry */
+
+    /* Scheduler statistics, see sched.c */
+    uint64_t cpu_steals;      /* Environments taken from other CPUs' run queues */
+    uint64_t cpu_migrations;  /* Environments run here after running elsewhere */
+    uint64_t cpu_idle_start;  /* TSC value when the CPU was last halted */
+    uint64_t cpu_idle_cycles; /* Total TSC cycles spent halted */
+    uint64_t cpu_env_start;   /* TSC value when cpu_env was switched to */
+
+#if trace_lock_order
+    struct spinlock *cpu_locks[NLOCKDEPTH]; /* Locks held by the CPU */
+    int cpu_nlocks;
+#endif
+
+#ifdef CONFIG_MCS_LOCK
+    struct mcs_node cpu_mcs[NLOCKDEPTH]; /* Queue nodes for locks being acquired or held */
+#endif
+};
+
+/* Initialized in mpconfig.c */
+extern struct CpuInfo cpus[NCPU];
+extern int ncpu;                 /* Total number of CPUs in the system */
+extern struct CpuInfo *bootcpu;  /* The boot-strap processor (BSP) */
+extern uint8_t apic2cpu[256];    /* Local APIC ID to cpus[] index */
+extern physaddr_t lapicaddr;     /* Physical MMIO address of the local APIC */
+
+int cpunum(void);
+#define thiscpu (&cpus[cpunum()])
+
+void mp_init(void);
+void lapic_init(void);
+void lapic_startap(uint8_t apicid, uint32_t addr);
+void lapic_eoi(void);
+void lapic_ipi(uint8_t apicid, int vector);
 
 extern char in_intr;
 extern bool in_clk_intr;
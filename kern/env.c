@@ -13,14 +13,15 @@
 #include <kern/trap.h>
 #include <kern/monitor.h>
 #include <kern/sched.h>
+#include <kern/futex.h>
+#include <kern/list.h>
 #include <kern/kdebug.h>
 #include <kern/macro.h>
 #include <kern/pmap.h>
 #include <kern/traceopt.h>
 #include <kern/vsyscall.h>
-
-/* Currently active environment */
-struct Env *curenv = NULL;
+#include <kern/spinlock.h>
+#include <kern/tsc.h>
 
 #ifdef CONFIG_KSPACE
 /* All environments */
@@ -38,6 +39,13 @@ volatile int *vsys;
  * (linked by Env->env_link) */
 static struct Env *env_free_list;
 
+/* Protects env_free_list, status and IPC state of
+ * environments, curenv of every CPU and run queues */
+struct spinlock env_lock = SPINLOCK_INIT(env_lock, LOCK_ORDER_ENV);
+
+/* Address space locks, kept out of envs[], see struct AddressSpace */
+static struct spinlock env_space_locks[NENV];
+
 
 /* NOTE: Should be at least LOGNENV */
 #define ENVGENSHIFT 12
@@ -49,7 +57,9 @@ static struct Env *env_free_list;
  * RETURNS
  *     0 on success, -E_BAD_ENV on error.
  *   On success, sets *env_store to the environment.
- *   On error, sets *env_store to NULL. */
+ *   On error, sets *env_store to NULL.
+ *
+ * Should be called with env_lock held. */
 int
 envid2env(envid_t envid, struct Env **env_store, bool need_check_perm) {
     struct Env *env;
@@ -96,12 +106,14 @@ env_init(void) {
     // LAB 12: Your code here
     if (current_space != NULL) {
         vsys = kzalloc_region(UVSYS_SIZE);
+        vsys[VSYS_tsc_khz] = tsc_calibrate() / 1000;
     }
     /* kzalloc_region only works with current_space != NULL */
     map_region(current_space, UVSYS, &kspace, (uintptr_t)vsys, UVSYS_SIZE, PROT_R | PROT_USER_);
     /* Allocate envs array with kzalloc_region
      * (don't forget about rounding) */
     // LAB 8: Your code here
+    static_assert(sizeof(*envs) * NENV <= UENVS_SIZE, "envs[] does not fit into UENVS");
 	envs = (struct Env *)kzalloc_region(sizeof(*envs) * NENV);
     memset(envs, 0, sizeof(*envs) * NENV);
     /* Map envs to UENVS read-only,
@@ -116,8 +128,11 @@ env_init(void) {
         envs[NENV - i - 1].env_status = ENV_FREE;
         envs[NENV - i - 1].env_id = 0;
         envs[NENV - i - 1].env_link = env_free_list;
+        envs[NENV - i - 1].address_space.lock = &env_space_locks[NENV - i - 1];
         env_free_list = &envs[NENV - i - 1];
     }
+    sched_init();
+    futex_init();
 }
 
 /* Allocates and initializes a new environment.
@@ -128,6 +143,8 @@ env_init(void) {
  * Errors
  *    -E_NO_FREE_ENV if all NENVS environments are allocated
  *    -E_NO_MEM on memory exhaustion
+ *
+ * Should be called with env_lock held.
  */
 int
 env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
@@ -155,6 +172,8 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 #endif
     env->env_status = ENV_RUNNABLE;
     env->env_runs = 0;
+    env->env_cpunum = cpunum();
+    env->env_priority = type == ENV_TYPE_IDLE ? ENV_PRIO_IDLE : ENV_PRIO_NORMAL;
 
     /* Clear out all the saved register state,
      * to prevent the register values
@@ -197,9 +216,20 @@ env_alloc(struct Env **newenv_store, envid_t parent_id, enum EnvType type) {
 
     /* Also clear the IPC receiving flag. */
     env->env_ipc_recving = 0;
+    list_init(&env->env_ipc_senders);
+    list_init(&env->env_ipc_link);
+
+    list_init(&env->env_futex);
+    env->env_futex_deadline = 0;
+
+    env->env_sc_ring = NULL;
+    env->env_syscalls = 0;
+    env->env_cycles = 0;
+    env->env_ipc_sends = 0;
 
     /* Commit the allocation */
     env_free_list = env->env_link;
+    sched_enqueue(env);
     *newenv_store = env;
 
     if (trace_envs) cprintf("[%08x] new env %08x\n", curenv ? curenv->env_id : 0, env->env_id);
@@ -333,7 +363,8 @@ load_icode(struct Env *env, uint8_t *binary, size_t size) {
 /* Allocates a new env with env_alloc, loads the named elf
  * binary into it with load_icode, and sets its env_type.
  * This function is ONLY called during kernel initialization,
- * before running the first user-mode environment.
+ * before running the first user-mode environment
+ * (with env_lock held, see i386_init()).
  * The new env's parent ID is set to 0.
  */
 void
@@ -349,7 +380,8 @@ env_create(uint8_t *binary, size_t size, enum EnvType type) {
 }
 
 
-/* Frees env and all memory it uses */
+/* Frees env and all memory it uses.
+ * Should be called with env_lock held */
 void
 env_free(struct Env *env) {
 
@@ -367,8 +399,22 @@ env_free(struct Env *env) {
     release_address_space(&env->address_space);
 #endif
 
+    /* Senders blocked on env fail, and if env
+     * is a blocked sender itself, it stops sending */
+    while (!list_empty(&env->env_ipc_senders)) {
+        struct Env *from = (struct Env *)((uint8_t *)env->env_ipc_senders.next - offsetof(struct Env, env_ipc_link));
+        list_del(&from->env_ipc_link);
+        from->env_tf.tf_regs.reg_rax = -E_BAD_ENV;
+        from->env_status = ENV_RUNNABLE;
+        sched_enqueue(from);
+    }
+    list_del(&env->env_ipc_link);
+
     /* Return the environment to the free list */
+    sched_dequeue(env);
+    futex_cancel(env);
     env->env_status = ENV_FREE;
+    futex_wake_env(env);
     env->env_link = env_free_list;
     env_free_list = env;
 }
@@ -377,33 +423,46 @@ env_free(struct Env *env) {
  *
  * If env was the current one, then runs a new environment
  * (and does not return to the caller)
+ *
+ * Should be called with env_lock held
  */
 void
 env_destroy(struct Env *env) {
     /* If env is currently running on other CPUs, we change its state to
      * ENV_DYING. A zombie environment will be freed the next time
-     * it traps to the kernel. */
+     * it traps to the kernel or gets descheduled. Its status might
+     * be anything (e.g. ENV_NOT_RUNNABLE set by its parent), so
+     * check curenv of the CPU it has last run on */
 
     // LAB 3: Your code here
+    if (env->env_status == ENV_FREE) return;
+    if (curenv != env && cpus[env->env_cpunum].cpu_env == env) {
+        env->env_status = ENV_DYING;
+        return;
+    }
+
     env->env_status = ENV_DYING;
     env_free(env);
+    // LAB 8: Your code here (set in_page_fault = 0)
+    in_page_fault = 0;
     if (curenv == env) {
+        curenv = NULL;
         sched_yield();
     }
-    // LAB 8: Your code here (set in_page_fault = 0)
-    in_page_fault = 0;
 }
 
 #ifdef CONFIG_KSPACE
 void
 csys_exit(void) {
     if (!curenv) panic("curenv = NULL");
+    spin_lock(&env_lock);
     env_destroy(curenv);
 }
 
 void
 csys_yield(struct Trapframe *tf) {
     memcpy(&curenv->env_tf, tf, sizeof(struct Trapframe));
+    spin_lock(&env_lock);
     sched_yield();
 }
 #endif
@@ -464,10 +523,23 @@ env_pop_tf(struct Trapframe *tf) {
  *    env->env_tf.  Go back through the code you wrote above
  *    and make sure you have set the relevant parts of
  *    env->env_tf to sensible values.
+ *
+ *    Should be called with env_lock held, the lock is
+ *    released right before leaving the kernel.
  */
+/* Charge TSC cycles since the last switch on this CPU to curenv,
+ * called whenever the CPU switches environments or halts */
+void
+env_account(void) {
+    uint64_t now = read_tsc();
+    if (curenv) curenv->env_cycles += now - thiscpu->cpu_env_start;
+    thiscpu->cpu_env_start = now;
+}
+
 _Noreturn void
 env_run(struct Env *env) {
     assert(env);
+    env_account();
 
     if (trace_envs_more) {
         const char *state[] = {"FREE", "DYING", "RUNNABLE", "RUNNING", "NOT_RUNNABLE"};
@@ -477,15 +549,23 @@ env_run(struct Env *env) {
     
     // LAB 3: Your code here
     // LAB 8: Your code here
-    if (curenv) {
-        if (curenv->env_status == ENV_RUNNING) {
-            curenv->env_status = ENV_RUNNABLE;
-        }
+    if (curenv && curenv != env && curenv->env_status == ENV_RUNNING) {
+        curenv->env_status = ENV_RUNNABLE;
+        sched_enqueue(curenv);
     }
+    sched_dequeue(env);
     curenv = env;
     curenv->env_status = ENV_RUNNING;
-    curenv->env_runs++;
+    if (curenv->env_runs++ && curenv->env_cpunum != cpunum())
+        thiscpu->cpu_migrations++;
+    curenv->env_cpunum = cpunum();
+    /* SYSCALL entry saves user registers right there */
+    thiscpu->cpu_syscall.sc_tf = (uintptr_t)(&curenv->env_tf + 1);
     switch_address_space(&curenv->address_space);
+    spin_unlock(&env_lock);
+#if trace_lock_order
+    if (thiscpu->cpu_nlocks) panic("Returning to user mode with %d locks held", thiscpu->cpu_nlocks);
+#endif
 	env_pop_tf(&curenv->env_tf);
 	
     while(1) {}
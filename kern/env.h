@@ -4,13 +4,15 @@
 #define JOS_KERN_ENV_H
 
 #include <inc/env.h>
-
-#define NCPU 1
+#include <kern/cpu.h>
 
 /* All environments */
 extern struct Env *envs;
 /* Currently active environment */
-extern struct Env *curenv;
+#define curenv (thiscpu->cpu_env)
+/* Protects environments state and run queues, see env.c */
+extern struct spinlock env_lock;
+
 extern struct Segdesc32 gdt[];
 
 void env_init(void);
@@ -20,6 +22,7 @@ void env_create(uint8_t *binary, size_t size, enum EnvType type);
 void env_destroy(struct Env *env);
 
 int envid2env(envid_t envid, struct Env **env_store, bool checkperm);
+void env_account(void);
 _Noreturn void env_run(struct Env *e);
 _Noreturn void env_pop_tf(struct Trapframe *tf);
 
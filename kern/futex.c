@@ -0,0 +1,226 @@
+/* Wait queues keyed on 32-bit words of user memory (futexes).
+ *
+ * A word is identified by its physical address, so environments
+ * sharing a page (PROT_SHARE) wait on the same queue no matter
+ * where the page is mapped. Words of the read-only envs[] mapping
+ * are identified by their UENVS address instead, the kernel wakes
+ * them up itself when environment state changes (see futex_wake_env()).
+ * Words of the vsys[] page are used the same way for device
+ * interrupts (see futex_wake_vsys()).
+ *
+ * Waiters are linked through Env->env_futex into a small hash table.
+ * Everything here is protected by env_lock, which the wakers take too,
+ * so checking the value and going to sleep is atomic with respect to
+ * wakeups */
+
+#include <inc/assert.h>
+#include <inc/error.h>
+#include <inc/string.h>
+#include <inc/x86.h>
+
+#include <kern/env.h>
+#include <kern/futex.h>
+#include <kern/list.h>
+#include <kern/pmap.h>
+#include <kern/sched.h>
+#include <kern/tsc.h>
+#include <kern/vsyscall.h>
+
+#define FUTEX_HASH_SIZE 64
+
+static struct List futex_hash[FUTEX_HASH_SIZE];
+
+/* Number of waiters with a timeout */
+static int futex_ntimed;
+
+#define FUTEX2ENV(li) ((struct Env *)((uint8_t *)(li) - offsetof(struct Env, env_futex)))
+
+void
+futex_init(void) {
+    for (size_t i = 0; i < FUTEX_HASH_SIZE; i++)
+        list_init(&futex_hash[i]);
+}
+
+static struct List *
+futex_queue(uintptr_t key) {
+    return &futex_hash[((key >> 2) ^ (key >> 12)) % FUTEX_HASH_SIZE];
+}
+
+/* Words of the kernel-maintained pages are keyed on their address */
+static bool
+futex_kernel_word(const uint32_t *addr) {
+    uintptr_t va = (uintptr_t)addr;
+    return (va >= UENVS && va < UENVS + UENVS_SIZE) ||
+           (va >= UVSYS && va < UVSYS + UVSYS_SIZE);
+}
+
+/* Key of user word addr of the current environment, 0 if it is not mapped */
+static uintptr_t
+futex_key(const uint32_t *addr) {
+    if (futex_kernel_word(addr)) return (uintptr_t)addr;
+    return user_va2pa(curenv, addr, PROT_R | PROT_USER_);
+}
+
+/* Remove env from the wait queue if it is there */
+void
+futex_cancel(struct Env *env) {
+    if (!env->env_futex.next || list_empty(&env->env_futex)) return;
+
+    list_del(&env->env_futex);
+    if (env->env_futex_deadline) futex_ntimed--;
+    env->env_futex_deadline = 0;
+}
+
+static void
+futex_wakeup(struct Env *env, int res) {
+    futex_cancel(env);
+    /* Receivers waiting on a futex too (see sys_ipc_recv())
+     * get no message, tell them why they have woken up */
+    if (env->env_ipc_recving) {
+        env->env_ipc_recving = 0;
+        if (!res) res = -E_AGAIN;
+    }
+    env->env_tf.tf_regs.reg_rax = res;
+    env->env_status = ENV_RUNNABLE;
+    /* Woken environment is likely to touch data
+     * we have just produced, so run it here */
+    sched_enqueue_on(env, cpunum());
+}
+
+static int
+futex_wake_key(uintptr_t key, int n) {
+    struct List *head = futex_queue(key);
+    int woken = 0;
+
+    for (struct List *li = head->next; li != head && woken < n;) {
+        struct Env *env = FUTEX2ENV(li);
+        li = li->next;
+        if (env->env_futex_key != key) continue;
+        futex_wakeup(env, 0);
+        woken++;
+    }
+
+    return woken;
+}
+
+/* Check that addr can be waited on, see futex_wait() for the errors */
+int
+futex_check(const uint32_t *addr) {
+    if ((uintptr_t)addr & (sizeof(*addr) - 1)) return -E_INVAL;
+    if (user_mem_check(curenv, addr, sizeof(*addr), PROT_R | PROT_USER_) < 0) return -E_FAULT;
+    return 0;
+}
+
+/* Put the current environment on the wait queue of addr, checked
+ * with futex_check(), if *addr still equals expected. Timeout is in
+ * milliseconds, 0 means no timeout. Called with env_lock held,
+ * the caller goes to sleep then. Returns -E_FAULT or -E_AGAIN */
+int
+futex_enqueue(const uint32_t *addr, uint32_t expected, uint64_t timeout) {
+    uint64_t deadline = 0;
+    if (timeout) {
+        uint64_t khz = tsc_calibrate() / 1000;
+        if (timeout < (UINT64_MAX - read_tsc()) / khz)
+            deadline = read_tsc() + timeout * khz;
+    }
+
+    uintptr_t key = futex_key(addr);
+    if (!key || (!futex_kernel_word(addr) && key > max_memory_map_addr)) return -E_FAULT;
+
+    /* Other words are read through the kernel mapping of their page.
+     * Reading the user address could fault in a lazy page, and running
+     * out of memory there destroys curenv, which needs env_lock */
+    uint32_t val;
+    nosan_memcpy(&val, futex_kernel_word(addr) ? (void *)addr : KADDR(key), sizeof(val));
+    if (val != expected) return -E_AGAIN;
+
+    curenv->env_futex_key = key;
+    curenv->env_futex_deadline = deadline;
+    if (deadline) futex_ntimed++;
+    list_append(futex_queue(key)->prev, &curenv->env_futex);
+    return 0;
+}
+
+/* Block the current environment until somebody wakes up addr,
+ * if *addr still equals expected. Timeout is in milliseconds,
+ * 0 means no timeout.
+ *
+ * This function only returns on error, the system call returns
+ * 0 when the environment is woken up or -E_TIMEOUT.
+ * Errors are:
+ *  -E_INVAL if addr is not aligned,
+ *  -E_FAULT if addr is not readable,
+ *  -E_AGAIN if *addr differs from expected. */
+int
+futex_wait(const uint32_t *addr, uint32_t expected, uint64_t timeout) {
+    int res = futex_check(addr);
+    if (res < 0) return res;
+
+    spin_lock(&env_lock);
+
+    if ((res = futex_enqueue(addr, expected, timeout)) < 0) {
+        spin_unlock(&env_lock);
+        return res;
+    }
+
+    curenv->env_status = ENV_NOT_RUNNABLE;
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    sched_yield();
+}
+
+/* Wake up at most n environments waiting on addr.
+ * Returns the number of woken environments or
+ *  -E_INVAL if addr is not aligned,
+ *  -E_FAULT if addr is not readable. */
+int
+futex_wake(const uint32_t *addr, int n) {
+    if ((uintptr_t)addr & (sizeof(*addr) - 1)) return -E_INVAL;
+    if (user_mem_check(curenv, addr, sizeof(*addr), PROT_R | PROT_USER_) < 0) return -E_FAULT;
+
+    spin_lock(&env_lock);
+    uintptr_t key = futex_key(addr);
+    int res = key ? futex_wake_key(key, n) : -E_FAULT;
+    spin_unlock(&env_lock);
+
+    return res;
+}
+
+/* Bump env->env_wait_seq and wake up everybody waiting on it through UENVS.
+ * Called with env_lock held when env exits or blocks in sys_ipc_recv().
+ * The counter is never reset, so waiters can't miss an event */
+void
+futex_wake_env(struct Env *env) {
+    env->env_wait_seq++;
+    futex_wake_key(UENVS + ((uintptr_t)&env->env_wait_seq - (uintptr_t)envs), NENV);
+}
+
+/* Bump vsys[idx] and wake up everybody waiting on it.
+ * Called with env_lock held from interrupt handlers */
+void
+futex_wake_vsys(int idx) {
+    vsys[idx]++;
+    futex_wake_key(UVSYS + idx * sizeof(*vsys), NENV);
+}
+
+bool
+futex_timed_waiters(void) {
+    return futex_ntimed > 0;
+}
+
+/* Wake up waiters whose timeout has expired.
+ * Called with env_lock held from sched_yield() */
+void
+futex_expire(void) {
+    if (!futex_ntimed) return;
+
+    uint64_t now = read_tsc();
+    for (size_t i = 0; i < FUTEX_HASH_SIZE && futex_ntimed; i++) {
+        struct List *head = &futex_hash[i];
+        for (struct List *li = head->next; li != head;) {
+            struct Env *env = FUTEX2ENV(li);
+            li = li->next;
+            if (env->env_futex_deadline && env->env_futex_deadline <= now)
+                futex_wakeup(env, -E_TIMEOUT);
+        }
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef JOS_KERN_FUTEX_H
+#define JOS_KERN_FUTEX_H
+#ifndef JOS_KERNEL
+#error "This is a JOS kernel header; user programs should not #include it"
+#endif
+
+#include <inc/env.h>
+
+void futex_init(void);
+int futex_check(const uint32_t *addr);
+int futex_enqueue(const uint32_t *addr, uint32_t expected, uint64_t timeout);
+int futex_wait(const uint32_t *addr, uint32_t expected, uint64_t timeout);
+int futex_wake(const uint32_t *addr, int n);
+void futex_wake_env(struct Env *env);
+void futex_wake_vsys(int idx);
+void futex_cancel(struct Env *env);
+void futex_expire(void);
+bool futex_timed_waiters(void);
+
+#endif /* !JOS_KERN_FUTEX_H */
@@ -17,8 +17,12 @@
 #include <kern/picirq.h>
 #include <kern/kclock.h>
 #include <kern/kdebug.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 #include <kern/traceopt.h>
 
+static void boot_aps(void);
+
 void
 timers_init(void) {
     timertab[0] = timer_rtc;
@@ -147,6 +151,10 @@ i386_init(void) {
     pic_init();
     timers_init();
 
+    /* Multiprocessor initialization functions */
+    mp_init();
+    lapic_init();
+
     /* Framebuffer init should be done after memory init */
     fb_init();
     if (trace_init) cprintf("Framebuffer initialised\n");
@@ -157,6 +165,13 @@ i386_init(void) {
     /* Choose the timer used for scheduling: hpet or pit */
     timers_schedule("hpet0");
 
+    /* Hold env_lock while creating initial environments
+     * so that APs don't enter the scheduler too early */
+    spin_lock(&env_lock);
+
+    /* Starting non-boot CPUs */
+    boot_aps();
+
 #ifdef CONFIG_KSPACE
     /* Touch all you want */
     /* ENV_CREATE_KERNEL_TYPE(prog_test1);
@@ -174,7 +189,7 @@ i386_init(void) {
 
 #if defined(TEST)
     /* Don't touch -- used by grading script! */
-    //ENV_CREATE(TEST, ENV_TYPE_USER);
+    ENV_CREATE(TEST, ENV_TYPE_USER);
 #else
     /* Touch all you want. */
     //ENV_CREATE(user_breakpoint, ENV_TYPE_USER);
@@ -193,6 +208,73 @@ i386_init(void) {
     sched_yield();
 }
 
+/* Start the non-boot (AP) processors */
+static void
+boot_aps(void) {
+#ifndef CONFIG_KSPACE
+    extern unsigned char mpentry_start[], mpentry_end[];
+    extern unsigned char mpentry_kstack[], mpentry_cr3[];
+
+    /* Page table used by APs while entering the long mode:
+     * kernel part of kspace plus 1:1 mapped low 2MB with mpentry code */
+    static __attribute__((aligned(PAGE_SIZE))) pml4e_t mp_pml4[PML4_ENTRY_COUNT];
+    static __attribute__((aligned(PAGE_SIZE))) pdpe_t mp_pdp[PDP_ENTRY_COUNT];
+    static __attribute__((aligned(PAGE_SIZE))) pde_t mp_pd[PD_ENTRY_COUNT];
+
+    if (ncpu < 2) return;
+
+    /* Write entry code to unused memory at MPENTRY_PADDR */
+    uint8_t *code = KADDR(MPENTRY_PADDR);
+    memcpy(code, mpentry_start, mpentry_end - mpentry_start);
+
+    memcpy(mp_pml4, kspace.pml4, sizeof(mp_pml4));
+    mp_pd[0] = 0 | PTE_P | PTE_W | PTE_PS;
+    mp_pdp[0] = PADDR(mp_pd) | PTE_P | PTE_W;
+    mp_pml4[0] = PADDR(mp_pdp) | PTE_P | PTE_W;
+    /* Entry code runs in 32-bit mode when loading %cr3 */
+    assert(PADDR(mp_pml4) < 4 * GB);
+    *(uint32_t *)(code + (mpentry_cr3 - mpentry_start)) = PADDR(mp_pml4);
+
+    /* Boot each AP one at a time */
+    for (struct CpuInfo *c = cpus; c < cpus + ncpu; c++) {
+        /* We've started already. */
+        if (c == bootcpu) continue;
+
+        /* Tell mpentry.S what stack to use */
+        *(uint64_t *)(code + (mpentry_kstack - mpentry_start)) = KERN_STACK_TOP_CPU(c->cpu_id);
+        /* Start the CPU at mpentry_start */
+        lapic_startap(c->cpu_apicid, MPENTRY_PADDR);
+        /* Wait for the CPU to finish some basic setup in mp_main() */
+        while (c->cpu_status != CPU_STARTED) asm volatile("pause");
+    }
+#endif
+}
+
+/* Setup code for APs */
+void
+mp_main(void) {
+    /* We are in high address now,
+     * switch to the kernel address space */
+    switch_address_space(&kspace);
+
+    /* Same control registers as the boot CPU, see init_memory() */
+    lcr0(CR0_PE | CR0_PG | CR0_AM | CR0_WP | CR0_NE | CR0_MP);
+    lcr4(CR4_PSE | CR4_PAE | CR4_PCE);
+
+    cprintf("SMP: CPU %d starting\n", cpunum());
+
+    lapic_init();
+    trap_init_percpu();
+    /* Tell boot_aps() we're up */
+    xchg(&thiscpu->cpu_status, CPU_STARTED);
+
+    /* Now that we have finished some basic setup, call sched_yield()
+     * to start running processes on this CPU. Scheduler state
+     * is protected by env_lock */
+    spin_lock(&env_lock);
+    sched_yield();
+}
+
 /* Variable panicstr contains argument to first call to panic; used as flag
  * to indicate that the kernel has already called panic. */
 const char *panicstr = NULL;
@@ -6,6 +6,7 @@
 #include <kern/timer.h>
 #include <kern/trap.h>
 #include <kern/picirq.h>
+#include <kern/spinlock.h>
 
 /* HINT: Note that selected CMOS
  * register is reset to the first one
@@ -18,24 +19,32 @@
  * Why it is necessary?
  */
 
+/* Index register selection and data access have to be atomic
+ * with respect to other CPUs (e.g. gettime() vs RTC interrupt) */
+static struct spinlock cmos_lock = SPINLOCK_INIT(cmos_lock, LOCK_ORDER_TIMER);
+
 uint8_t
 cmos_read8(uint8_t reg) {
     /* MC146818A controller */
     // LAB 4: Your code here
+    spin_lock(&cmos_lock);
     nmi_disable();
 	outb(CMOS_CMD, reg);
     uint8_t res = inb(CMOS_DATA);
     nmi_enable();
+    spin_unlock(&cmos_lock);
     return res;
 }
 
 void
 cmos_write8(uint8_t reg, uint8_t value) {
     // LAB 4: Your code here
+    spin_lock(&cmos_lock);
     nmi_disable();
     outb(CMOS_CMD, reg);
 	outb(CMOS_DATA, value);
     nmi_enable();
+    spin_unlock(&cmos_lock);
 }
 
 uint16_t
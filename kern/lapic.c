@@ -0,0 +1,176 @@
+/* The local APIC manages internal (non-I/O) interrupts.
+ * See Chapter 8 & Appendix C of Intel processor manual volume 3. */
+
+#include <inc/types.h>
+#include <inc/memlayout.h>
+#include <inc/trap.h>
+#include <inc/mmu.h>
+#include <inc/stdio.h>
+#include <inc/x86.h>
+
+#include <kern/pmap.h>
+#include <kern/cpu.h>
+#include <kern/tsc.h>
+
+/* Local APIC registers, divided by 4 for use as uint32_t[] indices. */
+#define ID    (0x0020 / 4) /* ID */
+#define VER   (0x0030 / 4) /* Version */
+#define TPR   (0x0080 / 4) /* Task Priority */
+#define EOI   (0x00B0 / 4) /* EOI */
+#define SVR   (0x00F0 / 4) /* Spurious Interrupt Vector */
+#define ESR   (0x0280 / 4) /* Error Status */
+#define ICRLO (0x0300 / 4) /* Interrupt Command */
+#define ICRHI (0x0310 / 4) /* Interrupt Command [63:32] */
+#define TIMER (0x0320 / 4) /* Local Vector Table 0 (TIMER) */
+#define PCINT (0x0340 / 4) /* Performance Counter LVT */
+#define LINT0 (0x0350 / 4) /* Local Vector Table 1 (LINT0) */
+#define LINT1 (0x0360 / 4) /* Local Vector Table 2 (LINT1) */
+#define ERROR (0x0370 / 4) /* Local Vector Table 3 (ERROR) */
+#define TICR  (0x0380 / 4) /* Timer Initial Count */
+#define TCCR  (0x0390 / 4) /* Timer Current Count */
+#define TDCR  (0x03E0 / 4) /* Timer Divide Configuration */
+
+/* SVR bits */
+#define ENABLE 0x00000100 /* Unit Enable */
+
+/* ICR bits */
+#define INIT    0x00000500 /* INIT/RESET */
+#define STARTUP 0x00000600 /* Startup IPI */
+#define DELIVS  0x00001000 /* Delivery status */
+#define ASSERT  0x00004000 /* Assert interrupt (vs deassert) */
+#define LEVEL   0x00008000 /* Level triggered */
+
+/* LVT bits */
+#define NMI      0x00000400 /* NMI delivery mode */
+#define EXTINT   0x00000700 /* ExtINT delivery mode */
+#define MASKED   0x00010000 /* Interrupt masked */
+#define PERIODIC 0x00020000 /* Periodic timer mode */
+
+/* TDCR values */
+#define X16 0x00000003 /* Divide counts by 16 */
+
+/* Time slice of application processors */
+#define LAPIC_TIMER_HZ 100
+
+volatile uint32_t *lapic;
+
+/* Timer initial count for LAPIC_TIMER_HZ, calibrated on the boot CPU */
+static uint32_t lapic_timer_count;
+
+static void
+lapicw(int index, uint32_t value) {
+    lapic[index] = value;
+    lapic[ID]; /* wait for write to finish, by reading */
+}
+
+static void
+microdelay(uint64_t us) {
+    uint64_t end = read_tsc() + tsc_calibrate() / 1000000 * us;
+    while (read_tsc() < end) asm volatile("pause");
+}
+
+/* Measure local APIC timer frequency against the TSC */
+static void
+lapic_timer_calibrate(void) {
+    lapicw(TDCR, X16);
+    lapicw(TIMER, MASKED | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+    lapicw(TICR, 0xFFFFFFFF);
+    microdelay(1000000 / LAPIC_TIMER_HZ);
+    lapic_timer_count = 0xFFFFFFFF - lapic[TCCR];
+    lapicw(TICR, 0);
+
+    if (!lapic_timer_count) lapic_timer_count = 10000000 / LAPIC_TIMER_HZ;
+}
+
+void
+lapic_init(void) {
+    if (!lapicaddr) return;
+
+    /* lapicaddr is the physical address of the LAPIC's 4K MMIO
+     * region.  Map it in to virtual memory so we can access it.
+     * All CPUs have their own local APIC at the same address */
+    if (!lapic) lapic = mmio_map_region(lapicaddr, PAGE_SIZE);
+
+    /* Enable local APIC; set spurious interrupt vector. */
+    lapicw(SVR, ENABLE | (IRQ_OFFSET + IRQ_SPURIOUS));
+
+    if (thiscpu == bootcpu) {
+        /* The boot CPU keeps getting its interrupts (including the
+         * scheduling timer) from the 8259A which is wired to LINT0
+         * in virtual wire mode, so local APIC timer is only calibrated */
+        lapicw(LINT0, EXTINT);
+        lapicw(LINT1, NMI);
+        lapic_timer_calibrate();
+    } else {
+        /* Other CPUs are preempted by their own local APIC timers
+         * counting down at bus frequency */
+        lapicw(LINT0, MASKED);
+        lapicw(LINT1, MASKED);
+        lapicw(TDCR, X16);
+        lapicw(TIMER, PERIODIC | (IRQ_OFFSET + IRQ_LAPIC_TIMER));
+        lapicw(TICR, lapic_timer_count);
+    }
+
+    /* Disable performance counter overflow interrupts
+     * on machines that provide that interrupt entry. */
+    if (((lapic[VER] >> 16) & 0xFF) >= 4) lapicw(PCINT, MASKED);
+
+    /* Map error interrupt to IRQ_ERROR. */
+    lapicw(ERROR, IRQ_OFFSET + IRQ_ERROR);
+
+    /* Clear error status register (requires back-to-back writes). */
+    lapicw(ESR, 0);
+    lapicw(ESR, 0);
+
+    /* Ack any outstanding interrupts. */
+    lapicw(EOI, 0);
+
+    /* Enable interrupts on the APIC (but not on the processor). */
+    lapicw(TPR, 0);
+}
+
+int
+cpunum(void) {
+    return lapic ? apic2cpu[lapic[ID] >> 24] : 0;
+}
+
+/* Acknowledge interrupt. */
+void
+lapic_eoi(void) {
+    if (lapic) lapicw(EOI, 0);
+}
+
+/* Send a fixed interrupt with the given vector to another CPU */
+void
+lapic_ipi(uint8_t apicid, int vector) {
+    if (!lapic) return;
+
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, vector);
+    while (lapic[ICRLO] & DELIVS) asm volatile("pause");
+}
+
+/* Start additional processor running entry code at addr.
+ * See Appendix B of MultiProcessor Specification.
+ * The warm reset vector is not set up: UEFI firmware leaves
+ * application processors waiting for INIT-SIPI-SIPI sequence */
+void
+lapic_startap(uint8_t apicid, uint32_t addr) {
+    /* "Universal startup algorithm."
+     * Send INIT (level-triggered) interrupt to reset other CPU. */
+    lapicw(ICRHI, apicid << 24);
+    lapicw(ICRLO, INIT | LEVEL | ASSERT);
+    microdelay(200);
+    lapicw(ICRLO, INIT | LEVEL);
+    microdelay(100); /* should be 10ms, but too slow in Bochs! */
+
+    /* Send startup IPI (twice!) to enter code.
+     * Regular hardware is supposed to only accept a STARTUP
+     * when it is in the halted state due to an INIT.  So the second
+     * should be ignored, but it is part of the official Intel algorithm. */
+    for (int i = 0; i < 2; i++) {
+        lapicw(ICRHI, apicid << 24);
+        lapicw(ICRLO, STARTUP | (addr >> 12));
+        microdelay(200);
+    }
+}
@@ -18,6 +18,8 @@
 #include <kern/trap.h>
 #include <kern/kclock.h>
 #include <kern/alloc.h>
+#include <kern/sched.h>
+#include <kern/spinlock.h>
 
 #define WHITESPACE "\t\r\n "
 #define MAXARGS    16
@@ -36,6 +38,8 @@ int mon_pagetable(int argc, char **argv, struct Trapframe *tf);
 int mon_virt(int argc, char **argv, struct Trapframe *tf);
 int mon_call(int argc, char **argv, struct Trapframe *tf);
 int mon_funcinfo(int argc, char** argv, struct Trapframe* tf);
+int mon_schedstat(int argc, char **argv, struct Trapframe *tf);
+int mon_lockstat(int argc, char **argv, struct Trapframe *tf);
 
 struct Command {
     const char *name;
@@ -57,7 +61,9 @@ static struct Command commands[] = {
         {"dump_mem_lists", "Print free memory lists", mon_memory},
         {"dump_pagetable", "Print page table", mon_pagetable},
         {"call", "Call function", mon_call},
-        {"funcinfo", "Get info about function", mon_funcinfo}};
+        {"funcinfo", "Get info about function", mon_funcinfo},
+        {"schedstat", "Print per-CPU scheduler statistics", mon_schedstat},
+        {"lockstat", "Print lock contention statistics ('lockstat reset' also clears them)", mon_lockstat}};
 
 #define NCOMMANDS (sizeof(commands) / sizeof(commands[0]))
 
@@ -204,6 +210,18 @@ mon_virt(int argc, char **argv, struct Trapframe *tf) {
     return 0;
 }
 
+int
+mon_schedstat(int argc, char **argv, struct Trapframe *tf) {
+    dump_sched_stats();
+    return 0;
+}
+
+int
+mon_lockstat(int argc, char **argv, struct Trapframe *tf) {
+    dump_lock_stats(argc > 1 && !strcmp(argv[1], "reset"));
+    return 0;
+}
+
 void test_call();
 
 int
@@ -0,0 +1,84 @@
+/* Search for and parse the multiprocessor configuration table
+ * (ACPI MADT, see ACPI specification, section 5.2.12) */
+
+#include <inc/types.h>
+#include <inc/string.h>
+#include <inc/memlayout.h>
+#include <inc/x86.h>
+#include <inc/mmu.h>
+#include <inc/env.h>
+#include <inc/assert.h>
+#include <inc/stdio.h>
+
+#include <kern/cpu.h>
+#include <kern/timer.h>
+#include <kern/traceopt.h>
+
+struct CpuInfo cpus[NCPU];
+struct CpuInfo *bootcpu = &cpus[0];
+int ncpu;
+uint8_t apic2cpu[256];
+physaddr_t lapicaddr;
+
+/* Local APIC ID of the CPU executing this code */
+static uint8_t
+cpuid_apicid(void) {
+    uint32_t ebx;
+    cpuid(1, NULL, &ebx, NULL, NULL);
+    return ebx >> 24;
+}
+
+static void
+mp_add_cpu(uint8_t apicid) {
+    if (ncpu >= NCPU) {
+        cprintf("SMP: too many CPUs, CPU with APIC ID %d disabled\n", apicid);
+        return;
+    }
+
+    cpus[ncpu].cpu_id = ncpu;
+    cpus[ncpu].cpu_apicid = apicid;
+    apic2cpu[apicid] = ncpu;
+    ncpu++;
+}
+
+void
+mp_init(void) {
+    /* Boot CPU always is cpus[0]: cpunum() returns 0
+     * until local APIC is initialized and we are using
+     * cpus[0] fields (e.g. curenv) since early boot */
+    uint8_t bootapicid = cpuid_apicid();
+    mp_add_cpu(bootapicid);
+    bootcpu->cpu_status = CPU_STARTED;
+
+    MADT *madt = acpi_find_table("APIC");
+    if (!madt) {
+        /* We can still run as uniprocessor */
+        cprintf("SMP: No MADT found, only boot CPU is available\n");
+        return;
+    }
+
+    lapicaddr = madt->LocalApicAddress;
+
+    uint8_t *entry = madt->Entries;
+    uint8_t *end = (uint8_t *)madt + madt->h.Length;
+    for (; entry < end; entry += ((MADTEntry *)entry)->Length) {
+        switch (((MADTEntry *)entry)->Type) {
+        case MADT_LAPIC: {
+            MADTLapic *proc = (MADTLapic *)entry;
+            if (!(proc->Flags & MADT_LAPIC_ENABLED)) break;
+            if (proc->ApicId != bootapicid) mp_add_cpu(proc->ApicId);
+            break;
+        }
+        case MADT_LAPIC_OVERRIDE:
+            lapicaddr = ((MADTLapicOverride *)entry)->Address;
+            break;
+        default:
+            /* I/O APICs and interrupt overrides are not used,
+             * all device interrupts go through 8259A */
+            break;
+        }
+        if (!((MADTEntry *)entry)->Length) break;
+    }
+
+    if (trace_init) cprintf("SMP: CPU %d found %d CPU(s)\n", bootcpu->cpu_id, ncpu);
+}
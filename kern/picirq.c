@@ -4,11 +4,15 @@
 #include <inc/trap.h>
 
 #include <kern/picirq.h>
+#include <kern/spinlock.h>
 
 /* Current IRQ mask.
- * Initial IRQ mask has interrupt 2 enabled (for slave 8259A) */
+ * Initial IRQ mask has interrupt 2 enabled (for slave 8259A).
+ * Lines are masked and unmasked on any CPU, pic_lock
+ * keeps the mask and the controllers in sync */
 static uint16_t irq_mask_8259A = 0xFFFF & ~(1 << IRQ_SLAVE);
 static bool pic_initilalized;
+static struct spinlock pic_lock = SPINLOCK_INIT(pic_lock, LOCK_ORDER_PIC);
 
 static void
 set_irq_mask(uint16_t mask) {
@@ -67,29 +71,53 @@ pic_init(void) {
     outb(IO_PIC2_CMND, OCW3 | OCW3_SET);
     outb(IO_PIC2_CMND, OCW3 | OCW3_IRR);
 
+    spin_lock(&pic_lock);
     pic_initilalized = 1;
+    uint16_t mask = irq_mask_8259A;
+    if (mask != 0xFFFF)
+        set_irq_mask(mask);
+    spin_unlock(&pic_lock);
+    print_irq_mask(mask);
+}
 
-    if (irq_mask_8259A != 0xFFFF)
-        set_irq_mask(irq_mask_8259A);
-    print_irq_mask(irq_mask_8259A);
+/* Set or clear the mask bit of irq and update the controllers.
+ * Returns the new mask */
+static uint16_t
+update_irq_mask(uint8_t irq, bool masked) {
+    spin_lock(&pic_lock);
+    if (masked)
+        irq_mask_8259A |= (1 << irq);
+    else
+        irq_mask_8259A &= ~(1 << irq);
+    uint16_t mask = irq_mask_8259A;
+    if (pic_initilalized) set_irq_mask(mask);
+    spin_unlock(&pic_lock);
+
+    return mask;
 }
 
 void
 pic_irq_mask(uint8_t irq) {
-    irq_mask_8259A |= (1 << irq);
-    if (pic_initilalized) {
-        set_irq_mask(irq_mask_8259A);
-        print_irq_mask(irq_mask_8259A);
-    }
+    uint16_t mask = update_irq_mask(irq, 1);
+    if (pic_initilalized) print_irq_mask(mask);
 }
 
 void
 pic_irq_unmask(uint8_t irq) {
-    irq_mask_8259A &= ~(1 << irq);
-    if (pic_initilalized) {
-        set_irq_mask(irq_mask_8259A);
-        print_irq_mask(irq_mask_8259A);
-    }
+    uint16_t mask = update_irq_mask(irq, 0);
+    if (pic_initilalized) print_irq_mask(mask);
+}
+
+/* Same as pic_irq_mask() and pic_irq_unmask(), but
+ * quiet, for masking lines while interrupts are handled */
+void
+pic_irq_hold(uint8_t irq) {
+    update_irq_mask(irq, 1);
+}
+
+void
+pic_irq_release(uint8_t irq) {
+    update_irq_mask(irq, 0);
 }
 
 void
@@ -9,6 +9,9 @@
 /* Number of IRQs */
 #define MAX_IRQS 16
 
+/* IRQs which may be driven by user environments, see sys_irq_ack() */
+#define IRQ_USER_MASK ((1 << 5) | (1 << 9) | (1 << 10) | (1 << 11) | (1 << 14) | (1 << 15))
+
 /* I/O Addresses of the two 8259A programmable interrupt controllers */
 /* Master (IRQs 0-7) */
 #define IO_PIC1 0x20
@@ -71,6 +74,8 @@ void pic_init(void);
 void pic_send_eoi(uint8_t irq);
 void pic_irq_mask(uint8_t mask);
 void pic_irq_unmask(uint8_t mask);
+void pic_irq_hold(uint8_t irq);
+void pic_irq_release(uint8_t irq);
 
 #endif /* !__ASSEMBLER__ */
 
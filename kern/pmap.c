@@ -9,9 +9,11 @@
 
 #include <kern/env.h>
 #include <kern/kclock.h>
+#include <kern/list.h>
 #include <kern/pmap.h>
 #include <kern/traceopt.h>
 #include <kern/trap.h>
+#include <kern/spinlock.h>
 
 /*
  * Term "page" used here does not
@@ -30,10 +32,15 @@ static struct List free_descriptors;
 static size_t free_desc_count;
 /* Physical memory size */
 size_t max_memory_map_addr;
-/* Kernel address space */
-struct AddressSpace kspace;
-/* Currently active address spcae */
-struct AddressSpace *current_space;
+/* Kernel address space
+ * (its lock also protects metaheaptop) */
+static struct spinlock kspace_lock = SPINLOCK_INIT(kspace_lock, LOCK_ORDER_SPACE);
+struct AddressSpace kspace = {.lock = &kspace_lock};
+/* Protects physical memory tree, free lists and descriptor pools.
+ * Virtual tree nodes are linked to lists of their physical pages,
+ * so it is held while changing any mapping, as well as while
+ * changing kernel part of page tables of any address space */
+static struct spinlock page_lock = SPINLOCK_INIT(page_lock, LOCK_ORDER_PAGE);
 /* Root node of physical memory tree */
 struct Page root;
 /* Top address for page pools mappings */
@@ -53,6 +60,11 @@ void *end_point = end;
 
 extern char pfstacktop[], pfstack[];
 
+/* Kernel and #PF stacks of application processors,
+ * the boot CPU uses bootstack and pfstack from entry.S */
+static __attribute__((aligned(PAGE_SIZE))) uint8_t percpu_kstacks[NCPU - 1][KERN_STACK_SIZE];
+static __attribute__((aligned(PAGE_SIZE))) uint8_t percpu_pfstacks[NCPU - 1][KERN_PF_STACK_SIZE];
+
 /* Those are internal flags for map_page function */
 #define ALLOC_POOL 0x10000
 /* Allocate but don't remove from free lists */
@@ -77,43 +89,6 @@ extern char pfstacktop[], pfstack[];
 #define assert_physical(n) ({ if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 1); assert(((n)->state & NODE_TYPE_MASK) >= PARTIAL_NODE); })
 #define assert_virtual(n)  ({if (trace_memory_more) _assert_root(__FILE__, __LINE__, n, 0); assert(((n)->state & NODE_TYPE_MASK) < PARTIAL_NODE); })
 
-inline static bool __attribute__((always_inline))
-list_empty(struct List *list) {
-    return list->next == list;
-}
-
-inline static void __attribute__((always_inline))
-list_init(struct List *list) {
-    list->next = list->prev = list;
-}
-
-/*
- * Appends list element 'new' after list element 'list'
- */
-inline static void __attribute__((always_inline))
-list_append(struct List *list, struct List *new) {
-    // LAB 6: Your code here
-    new->prev = list;
-    new->next = list->next;
-    list->next->prev = new;
-    list->next = new;
-}
-
-/*
- * Deletes list element from list.
- * NOTE: Use list_init() on deleted List element
- */
-inline static struct List *__attribute__((always_inline))
-list_del(struct List *list) {
-    // LAB 6: Your code here.
-	if (list) {
-		list->prev->next = list->next;
-		list->next->prev = list->prev;
-		list_init(list);
-	}
-    return list;
-}
-
 static struct Page *alloc_page(int class, int flags);
 
 void
@@ -756,8 +731,10 @@ propagate_pml4(struct AddressSpace *spc) {
     if (!current_space) return;
 
     if (spc != &kspace) propagate_one_pml4(&kspace, spc);
+    /* Check pml4 rather than env_status, since address spaces are
+     * initialized and released under page_lock, while env_status is not */
     for (size_t i = 0; i < NENV; i++) {
-        if (envs[i].env_status != ENV_FREE && &envs[i].address_space != spc)
+        if (envs[i].address_space.pml4 && &envs[i].address_space != spc)
             propagate_one_pml4(&envs[i].address_space, spc);
     }
 }
@@ -828,6 +805,28 @@ tlb_invalidate_range(struct AddressSpace *spc, uintptr_t start, uintptr_t end) {
     }
 }
 
+/* Lock one or two address spaces (b might be NULL or equal to a)
+ * and physical memory, in the order required by enum LockOrder */
+static void
+lock_spaces(struct AddressSpace *a, struct AddressSpace *b) {
+    if (b == a) b = NULL;
+    if (b && b->lock < a->lock) {
+        struct AddressSpace *tmp = a;
+        a = b, b = tmp;
+    }
+
+    spin_lock(a->lock);
+    if (b) spin_lock(b->lock);
+    spin_lock(&page_lock);
+}
+
+static void
+unlock_spaces(struct AddressSpace *a, struct AddressSpace *b) {
+    spin_unlock(&page_lock);
+    if (b && b != a) spin_unlock(b->lock);
+    spin_unlock(a->lock);
+}
+
 static void
 unmap_page(struct AddressSpace *spc, uintptr_t addr, int class) {
     if (trace_memory) cprintf("<%p> Unmapping [%08lX, %08lX]\n",
@@ -1057,6 +1056,8 @@ void
 unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
     int class = 0;
 
+    lock_spaces(dspace, NULL);
+
     uintptr_t start = ROUNDDOWN(dst, 1ULL << CLASS_BASE);
     uintptr_t end = ROUNDUP(dst + size, 1ULL << CLASS_BASE);
 
@@ -1073,6 +1074,8 @@ unmap_region(struct AddressSpace *dspace, uintptr_t dst, uintptr_t size) {
             start += CLASS_SIZE(class);
         }
     }
+
+    unlock_spaces(dspace, NULL);
 }
 
 /* Just allocate page, without mapping it */
@@ -1148,6 +1151,8 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
     int res = 0;
+
+    lock_spaces(spc, NULL);
     while (start < end) {
         struct Page *page = page_lookup_virtual(spc->root, start, 0, LOOKUP_PRESERVE);
         if (page && page->phy) {
@@ -1156,6 +1161,8 @@ region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size) {
         } else
             start += CLASS_SIZE(0);
     }
+    unlock_spaces(spc, NULL);
+
     return res;
 }
 
@@ -1234,22 +1241,12 @@ alloc_composite_page(struct AddressSpace *spc, uintptr_t addr, int class, int fl
     return res;
 }
 
-int
-force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+/* Resolve lazy mapping of va in spc.
+ * Called with spc locked by lock_spaces() */
+static int
+alloc_lazy_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
     int res = -E_FAULT;
-    /* FIXME We need to propagate kernel PML4E
-     * changes to every AddressSpace or just use KPTI
-     * (now it's ok since kernel does not map huge chunks of memory (>= 512GB)
-     * to higher part of address space after initiallization) */
-
-    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
-
-    /* If we are working with kernel addresses
-     * kspace should be current */
-    struct AddressSpace *old = NULL;
-    assert(current_space);
-    old = switch_address_space(spc = (va > MAX_USER_ADDRESS ? &kspace : spc));
-
+    struct AddressSpace *old = switch_address_space(spc);
 
     /* Lookup page mapping such that it's class it not larger than MAX_ALLOCATION_CLASS */
     struct Page *page;
@@ -1279,11 +1276,35 @@ force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
 
 fault:
     switch_address_space(old);
+    return res;
+}
+
+/* Running out of memory destroys the environment, which takes env_lock,
+ * so the kernel must not touch user memory with env_lock held */
+int
+force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass) {
+    /* FIXME We need to propagate kernel PML4E
+     * changes to every AddressSpace or just use KPTI
+     * (now it's ok since kernel does not map huge chunks of memory (>= 512GB)
+     * to higher part of address space after initiallization) */
+
+    static_assert(!(MAX_USER_ADDRESS & (HUGE_PAGE_SIZE * 512 * 512 - 1)), "MAX_USER_ADDRESS should be alligned on 512GiB");
+
+    /* If we are working with kernel addresses
+     * kspace should be current */
+    assert(current_space);
+    if (va > MAX_USER_ADDRESS) spc = &kspace;
+
+    lock_spaces(spc, NULL);
+    int res = alloc_lazy_page(spc, va, maxclass);
+    unlock_spaces(spc, NULL);
 
     if (res == -E_NO_MEM) {
         if (spc != &kspace) {
             struct Env *env = (void *)((uint8_t *)spc - offsetof(struct Env, address_space));
+            spin_lock(&env_lock);
             env_destroy(env);
+            spin_unlock(&env_lock);
         } else
             panic("Out of memory\n");
     } else
@@ -1330,7 +1351,7 @@ do_map_page(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *ssp
     /* Lock page so it cannot be deallocated during copying/mapping */
     if (!(flags & PROT_LAZY) && (oldflags & PROT_LAZY)) {
         int class = phy->class;
-        res = force_alloc_page(sspace, src, MAX_CLASS);
+        res = alloc_lazy_page(sspace, src, MAX_CLASS);
         if (res < 0 || (sspace == dspace && src == dst)) return res;
 
         struct Page *newv = page_lookup_virtual(sspace->root, src, class, LOOKUP_PRESERVE);
@@ -1440,16 +1461,8 @@ do_map_region_one_page(struct AddressSpace *dspace, uintptr_t dst, struct Addres
     return res;
 }
 
-int
-map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
-    if (src & CLASS_MASK(0) || (!sspace && !(flags & (ALLOC_ZERO | ALLOC_ONE)))) return -E_INVAL;
-    if (dst & CLASS_MASK(0) || !dspace) return -E_INVAL;
-    if (size & CLASS_MASK(0) || !size) return -E_INVAL;
-
-    /* FIXME This thing does not properly handle
-     * remapping overlapping regions to higher addresses */
-    assert(sspace != dspace || dst <= src || ABSDIFF(src, dst) >= size);
-
+static int
+do_map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
     uintptr_t end = dst + size;
     int max_class = addr_common_class(src, dst), class = 0, res;
     for (; class < max_class && dst + CLASS_SIZE(class) <= end; class ++) {
@@ -1473,10 +1486,29 @@ map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspa
     return 0;
 }
 
+int
+map_region(struct AddressSpace *dspace, uintptr_t dst, struct AddressSpace *sspace, uintptr_t src, uintptr_t size, int flags) {
+    if (src & CLASS_MASK(0) || (!sspace && !(flags & (ALLOC_ZERO | ALLOC_ONE)))) return -E_INVAL;
+    if (dst & CLASS_MASK(0) || !dspace) return -E_INVAL;
+    if (size & CLASS_MASK(0) || !size) return -E_INVAL;
+
+    /* FIXME This thing does not properly handle
+     * remapping overlapping regions to higher addresses */
+    assert(sspace != dspace || dst <= src || ABSDIFF(src, dst) >= size);
+
+    lock_spaces(dspace, sspace);
+    int res = do_map_region(dspace, dst, sspace, src, size, flags);
+    unlock_spaces(dspace, sspace);
+
+    return res;
+}
+
 void
 release_address_space(struct AddressSpace *space) {
     /* NOTE: This function should not be called for kspace */
 
+    lock_spaces(space, NULL);
+
     /* Manually unref level 3 kernel page tables */
     for (size_t i = NUSERPML4; i < PML4_ENTRY_COUNT; i++) {
         if (kspace.pml4[i] & PTE_P && i != UVPT_INDEX)
@@ -1493,8 +1525,12 @@ release_address_space(struct AddressSpace *space) {
     /* Also unmap PML4 itself since it is never deallocated by page_uname*/
     page_unref(page_lookup(NULL, space->cr3, 0, PARTIAL_NODE, 0));
 
-    /* Zero-out metadata */
-    memset(space, 0, sizeof *space);
+    /* Zero-out metadata (but not the lock we are holding) */
+    space->pml4 = NULL;
+    space->cr3 = 0;
+    space->root = NULL;
+
+    unlock_spaces(space, NULL);
 }
 
 
@@ -1529,6 +1565,8 @@ init_address_space(struct AddressSpace *space) {
     /* Allocte page table with alloc_pt into space->cr3
      * (remember to clean flag bits of result with PTE_ADDR) */
     // LAB 8: Your code here
+    spin_initlock(space->lock, LOCK_ORDER_SPACE);
+    spin_lock(&page_lock);
 	pte_t pte = 0;
     alloc_pt(&pte);
     pte = PTE_ADDR(pte);
@@ -1545,6 +1583,7 @@ init_address_space(struct AddressSpace *space) {
     space->pml4[PML4_INDEX(UVPT)] = space->cr3 | PTE_P | PTE_U;
     /* Why this call is required here and what does it do? */
     propagate_one_pml4(space, &kspace);
+    spin_unlock(&page_lock);
     return 0;
 }
 
@@ -1618,6 +1657,11 @@ detect_memory(void) {
         attach_region(0, max_memory_map_addr, ALLOCATABLE_NODE);
     }
 
+    /* Application processors' bootstrap code page.
+     * It is attached after the memory map since attaching
+     * an allocatable region resets all of its subregions */
+    attach_region(MPENTRY_PADDR, MPENTRY_PADDR + PAGE_SIZE, RESERVED_NODE);
+
     if (trace_init) {
         cprintf("Physical memory: %zuM available, base = %zuK, extended = %zuK\n",
                 (size_t)((basemem + extmem) / MB), (size_t)(basemem / KB), (size_t)(extmem / KB));
@@ -1668,10 +1712,12 @@ kzalloc_region(size_t size) {
 
     size = ROUNDUP(size, PAGE_SIZE);
 
+    spin_lock(kspace.lock);
     if (metaheaptop + size > KERN_HEAP_END) panic("Kernel heap overflow\n");
 
     uintptr_t res = metaheaptop;
     metaheaptop += size;
+    spin_unlock(kspace.lock);
 
     int r = map_region(&kspace, res, NULL, 0, size, PROT_R | PROT_W | ALLOC_ZERO);
     if (r < 0) panic("kzalloc_region: %i\n", r);
@@ -1694,13 +1740,15 @@ mmio_map_region(physaddr_t addr, size_t size) {
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
-    prev_mmio = metaheaptop;
+    lock_spaces(&kspace, NULL);
+    uintptr_t va = prev_mmio = metaheaptop;
     metaheaptop += end - start;
 
-    if (map_physical_region(&kspace, prev_mmio, start, end - start, PROT_R | PROT_W | PROT_CD) < 0)
+    if (map_physical_region(&kspace, va, start, end - start, PROT_R | PROT_W | PROT_CD) < 0)
         panic("Cannot map physical region at %p of size %zd", (void *)addr, size);
+    unlock_spaces(&kspace, NULL);
 
-    return (void *)(prev_mmio + addr - start);
+    return (void *)(va + addr - start);
 }
 
 void *
@@ -1708,11 +1756,13 @@ mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size)
     uintptr_t start = ROUNDDOWN(addr, PAGE_SIZE);
     uintptr_t end = ROUNDUP(addr + size, PAGE_SIZE);
 
+    spin_lock(kspace.lock);
     if (prev_mmio + addr - start != (uintptr_t)oldva &&
         (prev_mmio + end - start != metaheaptop))
         panic("Trying to remap non-last MMIO region!\n");
 
     metaheaptop = prev_mmio;
+    spin_unlock(kspace.lock);
     return mmio_map_region(addr, size);
 }
 
@@ -1830,6 +1880,17 @@ init_memory(void) {
     if (map_physical_region(&kspace, KERN_PF_STACK_TOP - KERN_PF_STACK_SIZE, PADDR(pfstack), KERN_PF_STACK_SIZE, PROT_R | PROT_W) < 0) {
         panic("Cannot map physical region at %p of size %lld", (void *)PADDR(pfstack), KERN_PF_STACK_SIZE);
     }
+
+    /* Stacks of other CPUs go right below, see inc/memlayout.h */
+    for (int i = 1; i < NCPU; i++) {
+        if (map_physical_region(&kspace, KERN_STACK_TOP_CPU(i) - KERN_STACK_SIZE, PADDR(percpu_kstacks[i - 1]), KERN_STACK_SIZE, PROT_R | PROT_W) < 0) {
+            panic("Cannot map physical region at %p of size %lld", (void *)PADDR(percpu_kstacks[i - 1]), KERN_STACK_SIZE);
+        }
+        if (map_physical_region(&kspace, KERN_PF_STACK_TOP_CPU(i) - KERN_PF_STACK_SIZE, PADDR(percpu_pfstacks[i - 1]), KERN_PF_STACK_SIZE, PROT_R | PROT_W) < 0) {
+            panic("Cannot map physical region at %p of size %lld", (void *)PADDR(percpu_pfstacks[i - 1]), KERN_PF_STACK_SIZE);
+        }
+    }
+    static_assert(KERN_CPU_STACKS_SIZE * NCPU <= KERN_STACK_TOP - KERN_HEAP_END, "Per-CPU stacks overlap kernel heap");
     
 #ifdef SANITIZE_SHADOW_BASE
     init_shadow_pre();
@@ -1957,14 +2018,17 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
     const void *current = (void *)ROUNDDOWN(va, PAGE_SIZE);
     const void *end = va + len;
     struct Page *user_root = env->address_space.root;
+    spin_lock(env->address_space.lock);
     while (current < end) {
         struct Page *page = page_lookup_virtual(user_root, (uintptr_t)current, 0, 0);
         if (!page->phy || (page->state & PAGE_PROT(perm)) != PAGE_PROT(perm)) {
+            spin_unlock(env->address_space.lock);
             user_mem_check_addr = (uintptr_t)(MAX(va, current));
             return -E_FAULT;
         }
         current += PAGE_SIZE;
     }
+    spin_unlock(env->address_space.lock);
     if ((uintptr_t)end > MAX_USER_READABLE) {
         user_mem_check_addr = MAX(MAX_USER_READABLE, (uintptr_t)current);
         return -E_FAULT;
@@ -1972,12 +2036,30 @@ user_mem_check(struct Env *env, const void *va, size_t len, int perm) {
     return 0;
 }
 
+/* Translate user virtual address va of env to physical address.
+ * Returns 0 if va is not mapped with permissions perm */
+physaddr_t
+user_va2pa(struct Env *env, const void *va, int perm) {
+    physaddr_t pa = 0;
+
+    spin_lock(env->address_space.lock);
+    struct Page *page = page_lookup_virtual(env->address_space.root, (uintptr_t)va, 0, 0);
+    if (page->phy && (page->state & PAGE_PROT(perm)) == PAGE_PROT(perm))
+        pa = page2pa(page->phy) + ((uintptr_t)va & CLASS_MASK(page->phy->class));
+    spin_unlock(env->address_space.lock);
+
+    return pa;
+}
+
+/* Destroys env if the check fails, so env_lock must not be held */
 void
 user_mem_assert(struct Env *env, const void *va, size_t len, int perm) {
     if (user_mem_check(env, va, len, perm | PROT_USER_) < 0) {
         cprintf("[%08x] user_mem_check assertion failure for "
                 "va=%016zx ip=%016zx\n",
                 env->env_id, user_mem_check_addr, env->env_tf.tf_rip);
+        spin_lock(&env_lock);
         env_destroy(env); /* may not return */
+        spin_unlock(&env_lock);
     }
 }
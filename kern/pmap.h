@@ -10,6 +10,7 @@
 #include <inc/assert.h>
 #include <inc/env.h>
 #include <inc/x86.h>
+#include <kern/cpu.h>
 
 #define CLASS_BASE    12
 #define CLASS_SIZE(c) (1ULL << ((c) + CLASS_BASE))
@@ -108,6 +109,8 @@ void init_memory(void);
 void release_address_space(struct AddressSpace *space);
 struct AddressSpace *switch_address_space(struct AddressSpace *space);
 int init_address_space(struct AddressSpace *space);
+int user_mem_check(struct Env *env, const void *va, size_t len, int perm);
+physaddr_t user_va2pa(struct Env *env, const void *va, int perm);
 void user_mem_assert(struct Env *env, const void *va, size_t len, int perm);
 int region_maxref(struct AddressSpace *spc, uintptr_t addr, size_t size);
 int force_alloc_page(struct AddressSpace *spc, uintptr_t va, int maxclass);
@@ -121,7 +124,8 @@ void *mmio_map_region(physaddr_t addr, size_t size);
 void *mmio_remap_last_region(physaddr_t addr, void *oldva, size_t oldsz, size_t size);
 
 extern struct AddressSpace kspace;
-extern struct AddressSpace *current_space;
+/* Currently active address space of this CPU */
+#define current_space (thiscpu->cpu_space)
 extern struct Page root;
 extern char bootstacktop[], bootstack[];
 extern size_t max_memory_map_addr;
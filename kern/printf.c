@@ -5,6 +5,8 @@
 #include <inc/stdio.h>
 #include <inc/stdarg.h>
 
+#include <kern/console.h>
+
 static void
 putch(int ch, int *cnt) {
     cputchar(ch);
@@ -13,10 +15,17 @@ putch(int ch, int *cnt) {
 
 int
 vcprintf(const char *fmt, va_list ap) {
+    extern const char *panicstr;
     int count = 0;
 
+    /* Don't wait for the lock after panic: it can be
+     * held by the panicking CPU itself */
+    bool locked = !panicstr;
+    if (locked) spin_lock(&console_lock);
+
     vprintfmt((void *)putch, &count, fmt, ap);
 
+    if (locked) spin_unlock(&console_lock);
     return count;
 }
 
@@ -1,50 +1,187 @@
 #include <inc/assert.h>
 #include <inc/x86.h>
 #include <kern/env.h>
+#include <kern/list.h>
 #include <kern/monitor.h>
+#include <kern/sched.h>
+#include <kern/futex.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
+#include <kern/pmap.h>
 
-
-struct Taskstate cpu_ts;
 _Noreturn void sched_halt(void);
 
+/* Per-CPU run queues of ENV_RUNNABLE environments, one FIFO per
+ * priority, linked through Env->env_rq. Bit N of rq_mask is set iff
+ * rq_list[N] is not empty, so picking the next env is O(1).
+ * A CPU runs environments from its own queue and steals from the
+ * most loaded peer only when its own queue is empty */
+struct RunQueue {
+    struct List rq_list[ENV_NPRIO];
+    uint32_t rq_mask;
+    int rq_count; /* Number of queued environments */
+};
+
+static struct RunQueue runq[NCPU];
+
+#define RQ2ENV(li) ((struct Env *)((uint8_t *)(li) - offsetof(struct Env, env_rq)))
+
+static inline bool
+env_queued(struct Env *env) {
+    return env->env_rq.next && !list_empty(&env->env_rq);
+}
+
+void
+sched_init(void) {
+    for (size_t cpu = 0; cpu < NCPU; cpu++) {
+        for (size_t i = 0; i < ENV_NPRIO; i++)
+            list_init(&runq[cpu].rq_list[i]);
+        runq[cpu].rq_mask = 0;
+        runq[cpu].rq_count = 0;
+    }
+}
+
+/* Wake up a halted CPU to pick up environment queued to cpu:
+ * either cpu itself or any other halted CPU that will steal it */
+static void
+sched_kick(int cpu) {
+    if (cpu != cpunum() && cpus[cpu].cpu_status == CPU_HALTED) {
+        lapic_ipi(cpus[cpu].cpu_apicid, IRQ_OFFSET + IRQ_RESCHED);
+        return;
+    }
+
+    for (int i = 0; i < ncpu; i++) {
+        if (i != cpunum() && cpus[i].cpu_status == CPU_HALTED) {
+            lapic_ipi(cpus[i].cpu_apicid, IRQ_OFFSET + IRQ_RESCHED);
+            return;
+        }
+    }
+}
+
+/* Put env to the tail (or the head if first is set) of its run
+ * queue on given CPU. Does nothing if env is already queued */
+static void
+sched_insert(struct Env *env, int cpu, bool first) {
+    assert(env->env_priority < ENV_NPRIO);
+    assert(cpu >= 0 && cpu < NCPU);
+    if (env_queued(env)) return;
+
+    struct RunQueue *rq = &runq[cpu];
+    struct List *head = &rq->rq_list[env->env_priority];
+    list_append(first ? head : head->prev, &env->env_rq);
+    rq->rq_mask |= 1U << env->env_priority;
+    rq->rq_count++;
+    env->env_rq_cpu = cpu;
+
+    /* Preempted current environment is going to be
+     * picked by this CPU right away, don't bother others */
+    if (env != curenv) sched_kick(cpu);
+}
+
+/* Put env to the tail of its run queue on given CPU.
+ * Does nothing if env is already queued */
+void
+sched_enqueue_on(struct Env *env, int cpu) {
+    sched_insert(env, cpu, 0);
+}
+
+/* Put env to the head of its run queue on this CPU, so that it runs
+ * next unless something more urgent is queued. Used to hand the CPU
+ * over and get it back, see sys_ipc_send() */
+void
+sched_enqueue_next(struct Env *env) {
+    sched_insert(env, cpunum(), 1);
+}
+
+/* Put env to the run queue of the CPU it has last run on,
+ * its working set is most likely to be cached there */
+void
+sched_enqueue(struct Env *env) {
+    sched_enqueue_on(env, env->env_cpunum);
+}
+
+/* Remove env from its run queue if it is there */
+void
+sched_dequeue(struct Env *env) {
+    if (!env_queued(env)) return;
+
+    struct RunQueue *rq = &runq[env->env_rq_cpu];
+    list_del(&env->env_rq);
+    rq->rq_count--;
+    if (list_empty(&rq->rq_list[env->env_priority]))
+        rq->rq_mask &= ~(1U << env->env_priority);
+}
+
+/* Take the most urgent environment queued on the most loaded
+ * other CPU. The tail of the queue is taken since it would be
+ * the last one to run there anyway. Returns NULL if all other
+ * run queues are empty */
+static struct Env *
+sched_steal(void) {
+    struct RunQueue *victim = NULL;
+    for (int i = 0; i < ncpu; i++) {
+        if (i != cpunum() && runq[i].rq_count &&
+            (!victim || runq[i].rq_count > victim->rq_count))
+            victim = &runq[i];
+    }
+    if (!victim) return NULL;
+
+    struct Env *env = RQ2ENV(victim->rq_list[__builtin_ctz(victim->rq_mask)].prev);
+    sched_dequeue(env);
+    thiscpu->cpu_steals++;
+    return env;
+}
+
+void
+dump_sched_stats(void) {
+    cprintf("CPU  queued     steals migrations idle(Mcycles)\n");
+    for (int i = 0; i < ncpu; i++) {
+        cprintf("%3d %7d %10lu %10lu %13lu\n", i, runq[i].rq_count,
+                (unsigned long)cpus[i].cpu_steals, (unsigned long)cpus[i].cpu_migrations,
+                (unsigned long)(cpus[i].cpu_idle_cycles / 1000000));
+    }
+}
+
 /* Choose a user environment to run and run it */
 _Noreturn void
 sched_yield(void) {
-    /* Implement simple round-robin scheduling.
-     *
-     * Search through 'envs' for an ENV_RUNNABLE environment in
-     * circular fashion starting just after the env was
-     * last running.  Switch to the first such environment found.
+    /* Round-robin within each priority level:
+     * the current environment (if it is still ENV_RUNNING) goes to
+     * the tail of its queue and the head of the most urgent
+     * non-empty queue is run. So the current environment is chosen
+     * again only if nobody else of the same or better priority
+     * is runnable on this CPU.
      *
-     * If no envs are runnable, but the environment previously
-     * running is still ENV_RUNNING, it's okay to
-     * choose that environment.
-     *
-     * If there are no runnable environments,
+     * If the local run queue is empty, try to steal an environment
+     * from other CPUs. If there are no runnable environments,
      * simply drop through to the code
-     * below to halt the cpu */
-
-    // LAB 3: Your code here:
-    int cur_id, parent_id;
-	if (curenv) {
-		cur_id = ENVX(curenv->env_id);
-	} else {
-		cur_id = 0;
-	}
-	parent_id = cur_id;
-	while (1) {
-		cur_id = (cur_id + 1) % NENV;
-		if (envs[cur_id].env_status == ENV_RUNNABLE) {
-			env_run(&envs[cur_id]);
-		}
-		if (parent_id == cur_id) {
-			if (envs[cur_id].env_status == ENV_RUNNING) {
-				env_run(&envs[cur_id]);
-			}
-			break;
-		}
-	}
-    cprintf("Halt\n");
+     * below to halt the cpu
+     *
+     * Should be called with env_lock held, it is released
+     * when switching to the user mode or halting */
+
+    /* Current environment was destroyed by another CPU */
+    if (curenv && curenv->env_status == ENV_DYING) {
+        env_free(curenv);
+        curenv = NULL;
+    }
+
+    futex_expire();
+
+    if (curenv && curenv->env_status == ENV_RUNNING) {
+        curenv->env_status = ENV_RUNNABLE;
+        sched_enqueue_on(curenv, cpunum());
+    }
+
+    struct RunQueue *rq = &runq[cpunum()];
+    if (rq->rq_mask) {
+        struct List *head = &rq->rq_list[__builtin_ctz(rq->rq_mask)];
+        env_run(RQ2ENV(head->next));
+    }
+
+    struct Env *env = sched_steal();
+    if (env) env_run(env);
+
     /* No runnable environments,
      * so just halt the cpu */
     sched_halt();
@@ -55,19 +192,37 @@ sched_yield(void) {
 _Noreturn void
 sched_halt(void) {
 
+    /* Environments running on other CPUs may still
+     * make something runnable (e.g. send an IPC),
+     * futex waits may time out */
+    bool others_busy = futex_timed_waiters();
+    for (int i = 0; i < ncpu; i++) {
+        if (&cpus[i] != thiscpu && cpus[i].cpu_env)
+            others_busy = 1;
+    }
+
     /* For debugging and testing purposes, if there are no runnable
-     * environments in the system, then drop into the kernel monitor */
-    int i;
-    for (i = 0; i < NENV; i++)
-        if (envs[i].env_status == ENV_RUNNABLE ||
-            envs[i].env_status == ENV_RUNNING) break;
-    if (i == NENV) {
+     * environments in the system (sched_yield() has already found all
+     * run queues empty), then drop into the kernel monitor */
+    if (!others_busy) {
+        cprintf("Halt\n");
         cprintf("No runnable environments in the system!\n");
+        spin_unlock(&env_lock);
         for (;;) monitor(NULL);
     }
 
     /* Mark that no environment is running on CPU */
+    env_account();
     curenv = NULL;
+    switch_address_space(&kspace);
+
+    /* Mark that this CPU is in the HALT state, so that other CPUs
+     * know they should kick it when there is some work to do */
+    thiscpu->cpu_idle_start = read_tsc();
+    xchg(&thiscpu->cpu_status, CPU_HALTED);
+
+    /* Release env_lock as if we were "leaving" the kernel */
+    spin_unlock(&env_lock);
 
     /* Reset stack pointer, enable interrupts and then halt */
     asm volatile(
@@ -76,7 +231,7 @@ sched_halt(void) {
             "pushq $0\n"
             "pushq $0\n"
             "sti\n"
-            "hlt\n" ::"a"(cpu_ts.ts_rsp0));
+            "hlt\n" ::"a"(thiscpu->cpu_ts.ts_rsp0));
 
     /* Unreachable */
     for (;;)
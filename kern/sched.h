@@ -6,6 +6,14 @@
 #error "This is a JOS kernel header; user programs should not #include it"
 #endif
 
+#include <inc/env.h>
+
+void sched_init(void);
+void sched_enqueue(struct Env *env);
+void sched_enqueue_on(struct Env *env, int cpu);
+void sched_enqueue_next(struct Env *env);
+void sched_dequeue(struct Env *env);
 _Noreturn void sched_yield(void);
+void dump_sched_stats(void);
 
 #endif /* !JOS_KERN_SCHED_H */
@@ -7,14 +7,24 @@
 #include <inc/string.h>
 #include <kern/spinlock.h>
 #include <kern/kdebug.h>
+#include <kern/cpu.h>
 #include <kern/traceopt.h>
 
-/* The big kernel lock */
-struct spinlock kernel_lock = {
-#if trace_spinlock
-        .name = "kernel_lock"
+#if trace_spinlock || trace_lock_stats
+/* Print program counter with its source location */
+static void
+print_rip(uintptr_t rip) {
+    struct Ripdebuginfo info;
+    if (debuginfo_rip(rip, &info) >= 0) {
+        cprintf("  %08lx %s:%d: %.*s+%lx\n", rip,
+                info.rip_file, info.rip_line,
+                info.rip_fn_namelen, info.rip_fn_name,
+                rip - info.rip_fn_addr);
+    } else {
+        cprintf("  %08lx\n", rip);
+    }
+}
 #endif
-};
 
 #if trace_spinlock
 /* Record the current call stack in pcs[] by following the %rbp chain. */
@@ -34,18 +44,166 @@ get_caller_pcs(uint64_t pcs[]) {
 /* Check whether this CPU is holding the lock. */
 static int
 holding(struct spinlock *lock) {
-    return lock->locked;
+    return spin_is_locked(lock) && lock->cpu == thiscpu;
 }
 #endif
 
-void
-__spin_initlock(struct spinlock *lk, char *name) {
-    lk->locked = 0;
+#if trace_lock_order
+/* Check that lk can be acquired after all locks
+ * this CPU is already holding, see enum LockOrder */
+static void
+lock_order_check(struct spinlock *lk) {
+    struct CpuInfo *cpu = thiscpu;
+    if (!lk->order) return;
+
+    for (int i = 0; i < cpu->cpu_nlocks; i++) {
+        struct spinlock *held = cpu->cpu_locks[i];
+        if (held->order > lk->order || (held->order == lk->order && held >= lk)) {
 #if trace_spinlock
+            panic("Lock order violation: acquiring %s (class %d) while holding %s (class %d)",
+                  lk->name, lk->order, held->name, held->order);
+#else
+            panic("Lock order violation: acquiring %p (class %d) while holding %p (class %d)",
+                  lk, lk->order, held, held->order);
+#endif
+        }
+    }
+
+    if (cpu->cpu_nlocks == NLOCKDEPTH) panic("Too many locks held");
+    cpu->cpu_locks[cpu->cpu_nlocks++] = lk;
+}
+
+/* Forget about lk being held by this CPU.
+ * Locks need not to be released in reverse order */
+static void
+lock_order_release(struct spinlock *lk) {
+    struct CpuInfo *cpu = thiscpu;
+    if (!lk->order) return;
+
+    for (int i = cpu->cpu_nlocks - 1; i >= 0; i--) {
+        if (cpu->cpu_locks[i] == lk) {
+            cpu->cpu_locks[i] = cpu->cpu_locks[--cpu->cpu_nlocks];
+            return;
+        }
+    }
+    panic("Releasing lock %p not acquired by CPU %d", lk, cpunum());
+}
+#endif
+
+#if trace_lock_stats
+/* List of all locks which were ever acquired */
+static struct spinlock *lock_list;
+
+static void
+lock_stats_register(struct spinlock *lk) {
+    if (lk->stats.registered || xchg(&lk->stats.registered, 1)) return;
+
+    struct spinlock *head = __atomic_load_n(&lock_list, __ATOMIC_RELAXED);
+    do lk->stats.next = head;
+    while (!__atomic_compare_exchange_n(&lock_list, &head, lk, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+#endif
+
+#ifdef CONFIG_MCS_LOCK
+/* Take a free queue node of this CPU. Interrupts are disabled
+ * in the kernel so nobody else is using them concurrently */
+static struct mcs_node *
+mcs_node_get(void) {
+    struct CpuInfo *cpu = thiscpu;
+    for (int i = 0; i < NLOCKDEPTH; i++) {
+        if (!cpu->cpu_mcs[i].busy) {
+            cpu->cpu_mcs[i].busy = 1;
+            return &cpu->cpu_mcs[i];
+        }
+    }
+    panic("Too many locks held");
+}
+#endif
+
+/* Lock statistics (if any) are not reset, so that
+ * the locks of reused structures accumulate them.
+ * Lock has to be zeroed before the first initialization */
+void
+__spin_initlock(struct spinlock *lk, char *name, enum LockOrder order) {
+#ifdef CONFIG_MCS_LOCK
+    lk->tail = lk->holder = NULL;
+#else
+    lk->next = lk->owner = 0;
+#endif
+#if trace_lock_order
+    lk->order = order;
+#endif
+#if SPINLOCK_NAMED
     lk->name = name;
 #endif
 }
 
+bool
+spin_is_locked(struct spinlock *lk) {
+#ifdef CONFIG_MCS_LOCK
+    return lk->tail != NULL;
+#else
+    return lk->next != lk->owner;
+#endif
+}
+
+/* Wait for our turn. Returns true if the lock was not
+ * immediately available */
+static bool
+arch_spin_lock(struct spinlock *lk) {
+#ifdef CONFIG_MCS_LOCK
+    /* Append our node to the queue and spin on it
+     * until the previous holder hands the lock over */
+    struct mcs_node *node = mcs_node_get();
+    node->next = NULL;
+    node->wait = 1;
+
+    struct mcs_node *prev = __atomic_exchange_n(&lk->tail, node, __ATOMIC_ACQ_REL);
+    if (prev) {
+        __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+        while (__atomic_load_n(&node->wait, __ATOMIC_ACQUIRE)) asm volatile("pause");
+    }
+
+    lk->holder = node;
+    return prev != NULL;
+#else
+    /* Take a ticket and wait until it is served */
+    uint32_t ticket = __atomic_fetch_add(&lk->next, 1, __ATOMIC_ACQ_REL);
+    if (__atomic_load_n(&lk->owner, __ATOMIC_ACQUIRE) == ticket) return 0;
+
+    while (__atomic_load_n(&lk->owner, __ATOMIC_ACQUIRE) != ticket) asm volatile("pause");
+    return 1;
+#endif
+}
+
+static void
+arch_spin_unlock(struct spinlock *lk) {
+#ifdef CONFIG_MCS_LOCK
+    struct mcs_node *node = lk->holder;
+    struct mcs_node *next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE);
+
+    if (!next) {
+        /* No known waiters: try to mark the lock free */
+        struct mcs_node *expected = node;
+        if (__atomic_compare_exchange_n(&lk->tail, &expected, NULL, 0,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            node->busy = 0;
+            return;
+        }
+
+        /* Somebody is enqueueing right now, wait for the link */
+        while (!(next = __atomic_load_n(&node->next, __ATOMIC_ACQUIRE)))
+            asm volatile("pause");
+    }
+
+    __atomic_store_n(&next->wait, 0, __ATOMIC_RELEASE);
+    node->busy = 0;
+#else
+    __atomic_store_n(&lk->owner, lk->owner + 1, __ATOMIC_RELEASE);
+#endif
+}
+
 /* Acquire the lock.
  * Loops (spins) until the lock is acquired.
  * Holding a lock for a long time may cause
@@ -55,14 +213,34 @@ spin_lock(struct spinlock *lk) {
 #if trace_spinlock
     if (holding(lk)) panic("Cannot acquire %s: already holding", lk->name);
 #endif
+#if trace_lock_order
+    lock_order_check(lk);
+#endif
+#if trace_lock_stats
+    uint64_t start = read_tsc();
+#endif
 
-    /* The xchg is atomic.
-     * It also serializes, so that reads after acquire are not
+    /* Atomic operations in arch_spin_lock() have acquire
+     * semantics, so that reads after acquire are not
      * reordered before it. */
-    while (xchg(&lk->locked, 1)) asm volatile("pause");
+    bool contended = arch_spin_lock(lk);
+    (void)contended;
+
+#if trace_lock_stats
+    uint64_t now = read_tsc();
+    lk->stats.acquired++;
+    if (contended) {
+        lk->stats.contended++;
+        lk->stats.spin_cycles += now - start;
+    }
+    lk->stats.hold_start = now;
+    lk->stats.holder_pc = (uintptr_t)__builtin_return_address(0);
+    lock_stats_register(lk);
+#endif
 
         /* Record info about lock acquisition for debugging. */
 #if trace_spinlock
+    lk->cpu = thiscpu;
     get_caller_pcs(lk->pcs);
 #endif
 }
@@ -75,32 +253,65 @@ spin_unlock(struct spinlock *lk) {
         uintptr_t pcs[10];
         /* Nab the acquiring EIP chain before it gets released */
         memmove(pcs, lk->pcs, sizeof pcs);
-        cprintf("Cannot release %s\nAcquired at:", lk->name);
-        for (int i = 0; i < 10 && pcs[i]; i++) {
-            struct Ripdebuginfo info;
-            if (debuginfo_rip(pcs[i], &info) >= 0) {
-                cprintf("  %08lx %s:%d: %.*s+%lx\n", pcs[i],
-                        info.rip_file, info.rip_line,
-                        info.rip_fn_namelen, info.rip_fn_name,
-                        pcs[i] - info.rip_fn_addr);
-            } else {
-                cprintf("  %08lx\n", pcs[i]);
-            }
-        }
+        cprintf("CPU %d cannot release %s: held by CPU %d\nAcquired at:",
+                cpunum(), lk->name, lk->cpu ? lk->cpu->cpu_id : -1);
+        for (int i = 0; i < 10 && pcs[i]; i++) print_rip(pcs[i]);
         panic("spin_unlock");
     }
 
     lk->pcs[0] = 0;
+    lk->cpu = 0;
+#endif
+#if trace_lock_order
+    lock_order_release(lk);
+#endif
+#if trace_lock_stats
+    uint64_t hold = read_tsc() - lk->stats.hold_start;
+    if (hold > lk->stats.max_hold) {
+        lk->stats.max_hold = hold;
+        lk->stats.max_hold_pc = lk->stats.holder_pc;
+    }
+    lk->stats.holder_pc = 0;
 #endif
 
-    /* The xchg serializes, so that reads before release are
-     * not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-     * 7.2) says reads can be carried out speculatively and in
-     * any order, which implies we need to serialize here.
-     * But the 2007 Intel 64 Architecture Memory Ordering White
+    /* The 2007 Intel 64 Architecture Memory Ordering White
      * Paper says that Intel 64 and IA-32 will not move a load
-     * after a store. So lock->locked = 0 would work here.
-     * The xchg being asm volatile ensures gcc emits it after
-     * the above assignments (and after the critical section). */
-    xchg(&lk->locked, 0);
+     * after a store, so a plain store with release semantics
+     * is enough to publish the critical section. */
+    arch_spin_unlock(lk);
+}
+
+/* Print statistics of all locks acquired at least once
+ * (and optionally reset them) */
+void
+dump_lock_stats(bool reset) {
+#if trace_lock_stats
+    cprintf("%-24s %16s %10s %10s %12s %12s\n", "lock", "address",
+            "acquired", "contended", "spin(Kcyc)", "maxhold(cyc)");
+    for (struct spinlock *lk = lock_list; lk; lk = lk->stats.next) {
+        struct lock_stats *st = &lk->stats;
+        if (!st->acquired) continue;
+
+        cprintf("%-24s %16p %10lu %10lu %12lu %12lu\n", lk->name, lk,
+                (unsigned long)st->acquired, (unsigned long)st->contended,
+                (unsigned long)(st->spin_cycles / 1000), (unsigned long)st->max_hold);
+        if (st->max_hold_pc) {
+            cprintf(" longest held by:\n");
+            print_rip(st->max_hold_pc);
+        }
+        uintptr_t holder = st->holder_pc;
+        if (spin_is_locked(lk) && holder) {
+            cprintf(" now held by:\n");
+            print_rip(holder);
+        }
+
+        if (reset) {
+            st->acquired = st->contended = 0;
+            st->spin_cycles = st->max_hold = 0;
+            st->max_hold_pc = 0;
+        }
+    }
+#else
+    cprintf("Lock statistics are disabled, set trace_lock_stats in kern/traceopt.h\n");
+#endif
 }
@@ -4,40 +4,108 @@
 #include <inc/types.h>
 #include <kern/traceopt.h>
 
+/* Lock classes in the order locks have to be acquired.
+ * Two locks of the same class (e.g. two address spaces)
+ * are acquired in the order of increasing addresses.
+ * The order is checked if trace_lock_order is enabled */
+enum LockOrder {
+    LOCK_ORDER_NONE = 0, /* Not checked */
+    LOCK_ORDER_ENV,      /* env_lock: env table, IPC state and run queues */
+    LOCK_ORDER_SPACE,    /* AddressSpace.lock: virtual memory tree and page tables */
+    LOCK_ORDER_PAGE,     /* page_lock: physical memory tree, free lists, descriptors */
+    LOCK_ORDER_ALLOC,    /* Kernel test allocator heap */
+    LOCK_ORDER_TIMER,    /* CMOS/RTC registers */
+    LOCK_ORDER_PIC,      /* 8259A interrupt mask */
+    LOCK_ORDER_CONS_IN,  /* Console input buffer and keyboard state */
+    LOCK_ORDER_CONSOLE,  /* Console output devices */
+};
+
+/* Locks are fair: CPUs acquire a lock in the order they started
+ * waiting for it. By default ticket locks are used, building with
+ * CONFIG_SPINLOCK=mcs switches to MCS queue locks, where every
+ * waiter spins on its own cache line (see spinlock.c) */
+
+#if trace_spinlock || trace_lock_stats
+#define SPINLOCK_NAMED 1
+#else
+#define SPINLOCK_NAMED 0
+#endif
+
+#ifdef CONFIG_MCS_LOCK
+/* MCS queue node, CPUs keep them in struct CpuInfo */
+struct mcs_node {
+    struct mcs_node *volatile next; /* Next waiter */
+    volatile uint32_t wait;         /* Spin while set */
+    bool busy;                      /* Node is in use */
+} __attribute__((aligned(64)));
+#endif
+
+#if trace_lock_stats
+/* Contention statistics, see lockstat monitor command */
+struct lock_stats {
+    uint64_t acquired;     /* Number of acquisitions */
+    uint64_t contended;    /* Acquisitions which had to wait */
+    uint64_t spin_cycles;  /* TSC cycles spent waiting */
+    uint64_t max_hold;     /* Maximal hold time in TSC cycles */
+    uintptr_t max_hold_pc; /* Acquirer for max_hold */
+    uint64_t hold_start;   /* TSC value at acquisition */
+    uintptr_t holder_pc;   /* Current acquirer */
+    struct spinlock *next; /* All locks ever acquired are linked here */
+    uint32_t registered;
+};
+#endif
+
 /* Mutual exclusion lock */
 struct spinlock {
-    unsigned locked; /* Is the lock held? */
+#ifdef CONFIG_MCS_LOCK
+    struct mcs_node *volatile tail; /* Last waiter or holder, NULL if free */
+    struct mcs_node *holder;        /* Node of the holder */
+#else
+    volatile uint32_t next;  /* Next ticket to hand out */
+    volatile uint32_t owner; /* Ticket currently served */
+#endif
+
+#if trace_lock_order
+    enum LockOrder order; /* Class of the lock */
+#endif
+
+#if SPINLOCK_NAMED
+    char *name; /* Name of lock */
+#endif
 
 #if trace_spinlock
     /* For debugging: */
-    char *name;        /* Name of lock */
-    uintptr_t pcs[10]; /* The call stack (an array of program counters)
-                        * that locked the lock */
+    struct CpuInfo *cpu; /* The CPU holding the lock */
+    uintptr_t pcs[10];   /* The call stack (an array of program counters)
+                          * that locked the lock */
 #endif
-};
 
-void __spin_initlock(struct spinlock *lk, char *name);
-void spin_lock(struct spinlock *lk);
-void spin_unlock(struct spinlock *lk);
+#if trace_lock_stats
+    struct lock_stats stats;
+#endif
+};
 
-#define spin_initlock(lock) __spin_initlock(lock, #lock)
+#if trace_lock_order
+#define __SPINLOCK_ORDER(o) .order = (o),
+#else
+#define __SPINLOCK_ORDER(o)
+#endif
 
-extern struct spinlock kernel_lock;
+#if SPINLOCK_NAMED
+#define __SPINLOCK_NAME(n) .name = (n),
+#else
+#define __SPINLOCK_NAME(n)
+#endif
 
-static inline void
-lock_kernel(void) {
-    spin_lock(&kernel_lock);
-}
+/* Static initializer of the lock lk of class order */
+#define SPINLOCK_INIT(lk, order) {__SPINLOCK_ORDER(order) __SPINLOCK_NAME(#lk)}
 
-static inline void
-unlock_kernel(void) {
-    spin_unlock(&kernel_lock);
+void __spin_initlock(struct spinlock *lk, char *name, enum LockOrder order);
+void spin_lock(struct spinlock *lk);
+void spin_unlock(struct spinlock *lk);
+bool spin_is_locked(struct spinlock *lk);
+void dump_lock_stats(bool reset);
 
-    /* Normally we wouldn't need to do this, but QEMU only runs
-     * one CPU at a time and has a long time-slice.  Without the
-     * pause, this CPU is likely to reacquire the lock before
-     * another CPU has even been given a chance to acquire it. */
-    asm volatile("pause");
-}
+#define spin_initlock(lock, order) __spin_initlock(lock, #lock, order)
 
 #endif
@@ -7,7 +7,10 @@
 
 #include <kern/console.h>
 #include <kern/env.h>
+#include <kern/futex.h>
+#include <kern/list.h>
 #include <kern/kclock.h>
+#include <kern/picirq.h>
 #include <kern/pmap.h>
 #include <kern/sched.h>
 #include <kern/syscall.h>
@@ -52,7 +55,9 @@ static int
 sys_env_destroy(envid_t envid) {
     // LAB 8: Your code here.
     struct Env* env;
+    spin_lock(&env_lock);
     if (envid2env(envid, &env, true) < 0) {
+        spin_unlock(&env_lock);
         return -E_BAD_ENV;
     }
 
@@ -65,6 +70,7 @@ sys_env_destroy(envid_t envid) {
     }
 #endif
     env_destroy(env);
+    spin_unlock(&env_lock);
     return 0;
 }
 
@@ -72,6 +78,7 @@ sys_env_destroy(envid_t envid) {
 static void
 sys_yield(void) {
     // LAB 9: Your code here
+    spin_lock(&env_lock);
     sched_yield();
 }
 
@@ -89,11 +96,19 @@ sys_exofork(void) {
 
     // LAB 9: Your code here
     struct Env* env;
-    env_alloc(&env, curenv->env_id, ENV_TYPE_USER);
+    spin_lock(&env_lock);
+    int res = env_alloc(&env, curenv->env_id, ENV_TYPE_USER);
+    if (res < 0) {
+        spin_unlock(&env_lock);
+        return res;
+    }
     env->env_status = ENV_NOT_RUNNABLE;
+    sched_dequeue(env);
     env->env_tf = curenv->env_tf;
     env->env_tf.tf_regs.reg_rax = 0;
-    return env->env_id;
+    res = env->env_id;
+    spin_unlock(&env_lock);
+    return res;
 }
 
 /* Set envid's env_status to status, which must be ENV_RUNNABLE
@@ -113,15 +128,27 @@ sys_env_set_status(envid_t envid, int status) {
 
     // LAB 9: Your code here
     struct Env* env;
+    int res = 0;
+    spin_lock(&env_lock);
     if (envid2env(envid, &env, true) < 0) {
-        return -1;
-    }
-    if (status == ENV_NOT_RUNNABLE || status == ENV_RUNNABLE) {
+        res = -1;
+    } else if (status == ENV_RUNNABLE) {
+        /* Running environments are requeued when they stop
+         * (one could be running on another CPU right now) */
+        if (env->env_status != ENV_RUNNING && env->env_status != ENV_DYING) {
+            env->env_status = status;
+            futex_cancel(env);
+            list_del(&env->env_ipc_link);
+            sched_enqueue(env);
+        }
+    } else if (status == ENV_NOT_RUNNABLE) {
         env->env_status = status;
+        sched_dequeue(env);
     } else {
-        return -E_INVAL;
+        res = -E_INVAL;
     }
-    return 0;
+    spin_unlock(&env_lock);
+    return res;
 }
 
 /* Set the page fault upcall for 'envid' by modifying the corresponding struct
@@ -136,13 +163,27 @@ static int
 sys_env_set_pgfault_upcall(envid_t envid, void* func) {
     // LAB 9: Your code here:
     struct Env* env;
+    spin_lock(&env_lock);
     if (envid2env(envid, &env, true) < 0) {
+        spin_unlock(&env_lock);
         return -1;
     }
     env->env_pgfault_upcall = func;
+    spin_unlock(&env_lock);
     return 0;
 }
 
+/* Environments other than curenv can be destroyed on other CPUs
+ * while we are working with their address spaces, so env_lock
+ * is released before the memory operation only if all of them
+ * are curenv (or NULL). Returns true if env_lock is still held */
+static bool
+release_env_lock(struct Env* a, struct Env* b) {
+    if ((a && a != curenv) || (b && b != curenv)) return true;
+    spin_unlock(&env_lock);
+    return false;
+}
+
 /* Allocate a region of memory and map it at 'va' with permission
  * 'perm' in the address space of 'envid'.
  * The page's contents are set to 0.
@@ -168,10 +209,6 @@ sys_env_set_pgfault_upcall(envid_t envid, void* func) {
  *      or to allocate any necessary page tables. */
 static int
 sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
-    struct Env* env;
-    if (envid2env(envid, &env, true) < 0) {
-        return -1;
-    }
     if (CLASS_MASK(0) & addr) {
         return -E_INVAL;
     }
@@ -189,10 +226,17 @@ sys_alloc_region(envid_t envid, uintptr_t addr, size_t size, int perm) {
     }
     perm |= PROT_USER_;
     perm |= PROT_LAZY;
-    if (map_region(&env->address_space, addr, NULL, 0, size, perm) < 0) {
+
+    struct Env* env;
+    spin_lock(&env_lock);
+    if (envid2env(envid, &env, true) < 0) {
+        spin_unlock(&env_lock);
         return -1;
     }
-    return 0;
+    bool locked = release_env_lock(env, NULL);
+    int res = map_region(&env->address_space, addr, NULL, 0, size, perm);
+    if (locked) spin_unlock(&env_lock);
+    return res < 0 ? -1 : 0;
 }
 
 /* Map the region of memory at 'srcva' in srcenvid's address space
@@ -221,12 +265,6 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
     // LAB 9: Your code here
     struct Env* srcenv;
     struct Env* dstenv;
-    if (envid2env(srcenvid, &srcenv, true) < 0) {
-        return -1;
-    }
-    if (envid2env(dstenvid, &dstenv, true) < 0) {
-        return -1;
-    }
     if (CLASS_MASK(0) & srcva || CLASS_MASK(0) & dstva) {
         return -E_INVAL;
     }
@@ -240,10 +278,17 @@ sys_map_region(envid_t srcenvid, uintptr_t srcva,
     if (perm & ~PROT_ALL || perm & ALLOC_ZERO || perm & ALLOC_ONE) {
         return -E_INVAL;
     }
-    if (map_region(&dstenv->address_space, dstva, &srcenv->address_space, srcva, size, perm) < 0) {
+
+    spin_lock(&env_lock);
+    if (envid2env(srcenvid, &srcenv, true) < 0 ||
+        envid2env(dstenvid, &dstenv, true) < 0) {
+        spin_unlock(&env_lock);
         return -1;
     }
-    return 0;
+    bool locked = release_env_lock(srcenv, dstenv);
+    int res = map_region(&dstenv->address_space, dstva, &srcenv->address_space, srcva, size, perm);
+    if (locked) spin_unlock(&env_lock);
+    return res < 0 ? -1 : 0;
 }
 
 /* Unmap the region of memory at 'va' in the address space of 'envid'.
@@ -259,16 +304,51 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
 
     // LAB 9: Your code here
     struct Env* env;
-    if (envid2env(envid, &env, true) < 0) {
-        return -1;
-    }
     if (CLASS_MASK(0) & va) {
         return -E_INVAL;
     }
     if (va >= MAX_USER_ADDRESS) {
         return -E_INVAL;
     }
+    spin_lock(&env_lock);
+    if (envid2env(envid, &env, true) < 0) {
+        spin_unlock(&env_lock);
+        return -1;
+    }
+    bool locked = release_env_lock(env, NULL);
     unmap_region(&env->address_space, va, size);
+    if (locked) spin_unlock(&env_lock);
+    return 0;
+}
+
+#define IPC2ENV(li) ((struct Env*)((uint8_t*)(li)-offsetof(struct Env, env_ipc_link)))
+
+/* Transfer a message from env 'from' to env 'to', which is
+ * (or is just going to be) blocked receiving. Fills IPC fields
+ * of 'to' and clears env_ipc_recving, see sys_ipc_try_send().
+ * Should be called with env_lock held */
+static int
+ipc_deliver(struct Env* from, struct Env* to, uint32_t value, uintptr_t srcva, size_t size, int perm) {
+    if (srcva < MAX_USER_ADDRESS && to->env_ipc_dstva < MAX_USER_ADDRESS) {
+        if (PAGE_OFFSET(srcva) || PAGE_OFFSET(to->env_ipc_dstva)) return -E_INVAL;
+        /* The whole region is mapped at once, map_region() uses
+         * the largest page classes both addresses are aligned to,
+         * so 2MB aligned parts are mapped with huge pages */
+        size = MIN(ROUNDUP(size, PAGE_SIZE), to->env_ipc_maxsz);
+        if (!size || size > MAX_USER_ADDRESS - srcva) return -E_INVAL;
+        if (map_region(&to->address_space, to->env_ipc_dstva, &from->address_space, srcva, size, perm | PROT_USER_) < 0)
+            return -1;
+        to->env_ipc_maxsz = size;
+        to->env_ipc_perm = perm;
+    } else {
+        to->env_ipc_perm = 0;
+    }
+    to->env_ipc_recving = 0;
+    /* The receiver may be waiting on a futex too */
+    futex_cancel(to);
+    to->env_ipc_from = from->env_id;
+    to->env_ipc_value = value;
+    from->env_ipc_sends++;
     return 0;
 }
 
@@ -284,7 +364,8 @@ sys_unmap_region(envid_t envid, uintptr_t va, size_t size) {
  * Otherwise, the send succeeds, and the target's ipc fields are
  * updated as follows:
  *    env_ipc_recving is set to 0 to block future sends;
- *    env_ipc_maxsz is set to min of size and it's current vlaue;
+ *    env_ipc_maxsz is set to min of size (rounded up to pages)
+ *      and it's current vlaue, that many bytes are mapped;
  *    env_ipc_from is set to the sending envid;
  *    env_ipc_value is set to the 'value' parameter;
  *    env_ipc_perm is set to 'perm' if a page was transferred, 0 otherwise.
@@ -317,30 +398,82 @@ static int
 sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm) {
     // LAB 9: Your code here
     struct Env* to_env = NULL;
+    int res = 0;
+    spin_lock(&env_lock);
     if (envid2env(envid, &to_env, false) < 0) {
-        return -1;
+        res = -1;
+        goto out;
     }
     if (to_env->env_ipc_recving == false) {
-        return -E_IPC_NOT_RECV;
+        res = -E_IPC_NOT_RECV;
+        goto out;
     }
-    if (srcva < MAX_USER_ADDRESS && to_env->env_ipc_dstva < MAX_USER_ADDRESS) {
-        if (PAGE_OFFSET(srcva) || PAGE_OFFSET(to_env->env_ipc_dstva)) {
-            return -E_INVAL;
+    if ((res = ipc_deliver(curenv, to_env, value, srcva, size, perm)) < 0) goto out;
+    to_env->env_status = ENV_RUNNABLE;
+    /* Receiver is likely to touch data we have just produced,
+     * so run it here while the caches are warm */
+    sched_enqueue_on(to_env, cpunum());
+out:
+    spin_unlock(&env_lock);
+    return res;
+}
+
+/* Blocking version of sys_ipc_try_send().
+ *
+ * If the receiver is blocked in sys_ipc_recv(), the message is delivered
+ * and this CPU switches directly to the receiver, the sender is queued
+ * to run next. Otherwise the sender is blocked on the receiver's
+ * env_ipc_senders list until the receiver calls sys_ipc_recv()
+ * and takes the message.
+ *
+ * Returns 0 on success, < 0 on error. Errors are the same as for
+ * sys_ipc_try_send() (except -E_IPC_NOT_RECV), and
+ *  -E_INVAL if envid is the caller itself,
+ *  -E_BAD_ENV if the receiver exits before taking the message. */
+static int
+sys_ipc_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, int perm) {
+    struct Env* to_env = NULL;
+    int res;
+
+    spin_lock(&env_lock);
+    if (envid2env(envid, &to_env, false) < 0) {
+        spin_unlock(&env_lock);
+        return -E_BAD_ENV;
+    }
+    if (to_env == curenv) {
+        spin_unlock(&env_lock);
+        return -E_INVAL;
+    }
+
+    if (to_env->env_ipc_recving) {
+        if ((res = ipc_deliver(curenv, to_env, value, srcva, size, perm)) < 0) {
+            spin_unlock(&env_lock);
+            return res;
         }
-        if (map_region(&to_env->address_space, to_env->env_ipc_dstva, &curenv->address_space, srcva, PAGE_SIZE, perm | PROT_USER_) < 0) {
-            return -1;
+        to_env->env_status = ENV_RUNNABLE;
+        curenv->env_tf.tf_regs.reg_rax = 0;
+        /* Hand the CPU over to the receiver without going through
+         * the run queues. We are queued at the head, so we run again
+         * as soon as the receiver blocks (usually waiting for our
+         * next message) and the call and the reply alternate */
+        if (curenv->env_status == ENV_RUNNING) {
+            curenv->env_status = ENV_RUNNABLE;
+            sched_enqueue_next(curenv);
+            env_run(to_env);
         }
-        to_env->env_ipc_maxsz = MIN(size, to_env->env_ipc_maxsz);
-        to_env->env_ipc_perm = perm;
-
-    } else {
-        to_env->env_ipc_perm = 0;
+        sched_enqueue_on(to_env, cpunum());
+        sched_yield();
     }
-    to_env->env_ipc_recving = 0;
-    to_env->env_ipc_from = curenv->env_id;
-    to_env->env_ipc_value = value;
-    to_env->env_status = ENV_RUNNABLE;
-    return 0;
+
+    curenv->env_ipc_send_value = value;
+    curenv->env_ipc_send_srcva = srcva;
+    curenv->env_ipc_send_size = size;
+    curenv->env_ipc_send_perm = perm;
+    list_append(to_env->env_ipc_senders.prev, &curenv->env_ipc_link);
+
+    curenv->env_status = ENV_NOT_RUNNABLE;
+    curenv->env_tf.tf_regs.reg_rax = 0;
+    sched_yield();
 }
 
 /* Block until a value is ready.  Record that you want to receive
@@ -350,16 +483,28 @@ sys_ipc_try_send(envid_t envid, uint32_t value, uintptr_t srcva, size_t size, in
  * If 'dstva' is < MAX_USER_ADDRESS, then you are willing to receive a page of data.
  * 'dstva' is the virtual address at which the sent page should be mapped.
  *
+ * If 'addr' is not 0, also wait on the futex 'addr' as futex_wait() does
+ * with 'expected' and 'timeout' (in milliseconds, 0 means no timeout).
+ * Then the system call returns -E_AGAIN without a message when the futex
+ * is woken up and -E_TIMEOUT when the timeout expires.
+ *
  * This function only returns on error, but the system call will eventually
  * return 0 on success.
  * Return < 0 on error.  Errors are:
+ *  -E_INVAL if addr is not aligned, -E_FAULT if it is not readable,
+ *  -E_AGAIN if *addr differs from expected;
  *  -E_INVAL if dstva < MAX_USER_ADDRESS but dstva is not page-aligned;
  *  -E_INVAL if dstva is valid and maxsize is 0,
- *  -E_INVAL if maxsize is not page aligned.
+ *  -E_INVAL if maxsize is not page aligned,
+ *  -E_INVAL if [dstva, dstva + maxsize) goes beyond MAX_USER_ADDRESS.
  */
 static int
-sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
+sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize, uintptr_t addr, uint32_t expected, uint64_t timeout) {
     // LAB 9: Your code here
+    int res;
+    if (addr && (res = futex_check((const uint32_t *)addr)) < 0) {
+        return res;
+    }
     if (dstva < MAX_USER_ADDRESS && PAGE_OFFSET(dstva)) {
         return -E_INVAL;
     }
@@ -369,13 +514,43 @@ sys_ipc_recv(uintptr_t dstva, uintptr_t maxsize) {
     if (PAGE_OFFSET(maxsize)) {
         return -E_INVAL;
     }
-    curenv->env_ipc_recving = 1;
-    curenv->env_status = ENV_NOT_RUNNABLE;
+    if (dstva < MAX_USER_ADDRESS && maxsize > MAX_USER_ADDRESS - dstva) {
+        return -E_INVAL;
+    }
+    spin_lock(&env_lock);
+    curenv->env_ipc_dstva = dstva;
     if (dstva < MAX_USER_ADDRESS) {
-        curenv->env_ipc_dstva = dstva;
         curenv->env_ipc_maxsz = maxsize;
     }
+
+    /* Take the message of the first blocked sender, if any.
+     * Senders whose messages can't be delivered get the error */
+    while (!list_empty(&curenv->env_ipc_senders)) {
+        struct Env* from = IPC2ENV(curenv->env_ipc_senders.next);
+        list_del(&from->env_ipc_link);
+
+        int res = ipc_deliver(from, curenv, from->env_ipc_send_value, from->env_ipc_send_srcva,
+                              from->env_ipc_send_size, from->env_ipc_send_perm);
+        from->env_tf.tf_regs.reg_rax = res;
+        from->env_status = ENV_RUNNABLE;
+        sched_enqueue(from);
+        if (!res) {
+            spin_unlock(&env_lock);
+            return 0;
+        }
+    }
+
+    /* Wait for the futex as well, if asked to */
+    if (addr && (res = futex_enqueue((const uint32_t *)addr, expected, timeout)) < 0) {
+        spin_unlock(&env_lock);
+        return res;
+    }
+
+    curenv->env_ipc_recving = 1;
+    curenv->env_status = ENV_NOT_RUNNABLE;
     curenv->env_tf.tf_regs.reg_rax = 0;
+    /* Senders may wait for us to start receiving */
+    futex_wake_env(curenv);
     sched_yield();
     return 0;
 }
@@ -394,17 +569,25 @@ static int
 sys_env_set_trapframe(envid_t envid, struct Trapframe* tf) {
     // LAB 11: Your code here
     struct Env* env = NULL;
+    struct Trapframe newtf;
+    /* Trapframe is read from the caller's memory before env_lock
+     * is taken: the copy may fault in a lazy page, and running out
+     * of memory there destroys curenv, which needs env_lock */
+    user_mem_assert(curenv, tf, sizeof(struct Trapframe), PROT_USER_ | PROT_R);
+    nosan_memcpy((void*)&newtf, (void*)tf, sizeof(struct Trapframe));
+    spin_lock(&env_lock);
     if (envid2env(envid, &env, false) < 0) {
+        spin_unlock(&env_lock);
         return -E_BAD_ENV;
     }
-    user_mem_assert(env, tf, sizeof(struct Trapframe), PROT_USER_ | PROT_R);
-    nosan_memcpy((void*)&env->env_tf, (void*)tf, sizeof(struct Trapframe));
+    env->env_tf = newtf;
     env->env_tf.tf_cs |= 3;
     env->env_tf.tf_ds |= 3;
     env->env_tf.tf_es |= 3;
     env->env_tf.tf_ss |= 3;
     env->env_tf.tf_rflags |= FL_IF;
     env->env_tf.tf_rflags &= ~FL_IOPL_3;
+    spin_unlock(&env_lock);
     return 0;
 }
 
@@ -433,6 +616,150 @@ sys_region_refs(uintptr_t addr, size_t size, uintptr_t addr2, uintptr_t size2) {
     return region_maxref(current_space, addr, size) - region_maxref(current_space, addr2, size2);
 }
 
+/* Register 'ring' as the system call ring of the current environment
+ * (or unregister it if ring is NULL).
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_INVAL if ring is not writable memory of the environment. */
+static int
+sys_ring_register(struct SyscallRing* ring) {
+    if (ring && user_mem_check(curenv, ring, sizeof(*ring), PROT_R | PROT_W | PROT_USER_) < 0) {
+        return -E_INVAL;
+    }
+    curenv->env_sc_ring = ring;
+    return 0;
+}
+
+/* Only system calls which return to the caller and don't
+ * change its own saved state can be batched */
+static bool
+ring_call_allowed(struct SyscallDesc* sd) {
+    switch (sd->sd_num) {
+    case SYS_cputs:
+    case SYS_getenvid:
+    case SYS_env_destroy:
+    case SYS_alloc_region:
+    case SYS_map_region:
+    case SYS_unmap_region:
+    case SYS_region_refs:
+    case SYS_env_set_status:
+    case SYS_env_set_pgfault_upcall:
+    case SYS_ipc_try_send:
+    case SYS_gettime:
+    case SYS_futex_wake:
+        return 1;
+    case SYS_env_set_trapframe:
+        return (envid_t)sd->sd_args[0] && (envid_t)sd->sd_args[0] != curenv->env_id;
+    default:
+        return 0;
+    }
+}
+
+/* Execute system calls queued in the registered ring in order,
+ * storing the results in place, with a single kernel entry.
+ * Execution stops after the first failed call, entries after
+ * it are left in the ring.
+ *
+ * Returns 0 if all calls succeeded, or the result of the failed one.
+ * Other errors are:
+ *  -E_INVAL if no ring is registered or ring indexes are invalid,
+ *  -E_FAULT if the ring is not mapped anymore. */
+static int
+sys_ring_enter(void) {
+    struct SyscallRing* ring = curenv->env_sc_ring;
+    if (!ring) return -E_INVAL;
+
+    /* A batched call could unmap the ring, so it is
+     * checked before accessing it every time */
+    const int perm = PROT_R | PROT_W | PROT_USER_;
+    if (user_mem_check(curenv, ring, sizeof(*ring), perm) < 0) return -E_FAULT;
+
+    /* Use nosan_memcpy to access userspace */
+    uint32_t idx[2];
+    nosan_memcpy(idx, (void*)&ring->sr_head, sizeof(idx));
+    uint32_t head = idx[0], tail = idx[1];
+    if (tail - head > SCRING_SIZE) return -E_INVAL;
+
+    for (; head != tail; head++) {
+        struct SyscallDesc sd;
+        nosan_memcpy(&sd, &ring->sr_desc[head % SCRING_SIZE], sizeof(sd));
+
+        int64_t res = -E_INVAL;
+        if (ring_call_allowed(&sd)) {
+            res = (int64_t)syscall(sd.sd_num, sd.sd_args[0], sd.sd_args[1], sd.sd_args[2],
+                                   sd.sd_args[3], sd.sd_args[4], sd.sd_args[5]);
+        }
+
+        if (user_mem_check(curenv, ring, sizeof(*ring), perm) < 0) return -E_FAULT;
+        uint32_t next = head + 1;
+        nosan_memcpy(&ring->sr_desc[head % SCRING_SIZE].sd_res, &res, sizeof(res));
+        nosan_memcpy((void*)&ring->sr_head, &next, sizeof(next));
+        if (res < 0) return res;
+    }
+
+    return 0;
+}
+
+/* Block until the 32-bit word at addr is woken up by sys_futex_wake(),
+ * if it still contains expected. Timeout is in milliseconds, 0 is infinite.
+ * The word can be in a page shared with other environments or
+ * env_wait_seq in envs[], which the kernel wakes up when the environment
+ * exits or starts receiving IPC.
+ *
+ * Returns 0 when woken up, < 0 on error. Errors are:
+ *  -E_AGAIN if *addr != expected,
+ *  -E_TIMEOUT if nobody woke us up in time,
+ *  -E_INVAL if addr is not aligned,
+ *  -E_FAULT if addr is not mapped. */
+static int
+sys_futex_wait(const uint32_t* addr, uint32_t expected, uint64_t timeout) {
+    return futex_wait(addr, expected, timeout);
+}
+
+/* Wake up at most n environments blocked in sys_futex_wait() on addr.
+ * Returns the number of woken environments, < 0 on error. Errors are:
+ *  -E_INVAL if addr is not aligned,
+ *  -E_FAULT if addr is not mapped. */
+static int
+sys_futex_wake(const uint32_t* addr, int n) {
+    return futex_wake(addr, n);
+}
+
+/* Return the physical address of va in the current environment,
+ * so that a user-level driver can program device DMA. A lazily
+ * allocated page is allocated first, so the address stays valid
+ * until the page is unmapped.
+ *
+ * Returns the address, < 0 on error. Errors are:
+ *  -E_BAD_ENV if the environment has no I/O privileges,
+ *  -E_INVAL if va is not a user address or perm is invalid,
+ *  -E_FAULT if va is not mapped with permissions perm. */
+static int64_t
+sys_region_pa(uintptr_t va, int perm) {
+    if ((curenv->env_tf.tf_rflags & FL_IOPL_MASK) != FL_IOPL_3) return -E_BAD_ENV;
+    if (va >= MAX_USER_ADDRESS || (perm & ~(PROT_R | PROT_W))) return -E_INVAL;
+
+    force_alloc_page(&curenv->address_space, va, MAX_ALLOCATION_CLASS);
+    physaddr_t pa = user_va2pa(curenv, (void*)va, perm | PROT_USER_);
+    return pa ? (int64_t)pa : -E_FAULT;
+}
+
+/* Enable IRQ irq for a user-level driver, or enable it again
+ * after the device has been serviced: the kernel masks the line
+ * on every interrupt and bumps vsys[VSYS_irq + irq].
+ *
+ * Returns 0 on success, < 0 on error. Errors are:
+ *  -E_BAD_ENV if the environment has no I/O privileges,
+ *  -E_INVAL if irq is used by the kernel. */
+static int
+sys_irq_ack(int irq) {
+    if ((curenv->env_tf.tf_rflags & FL_IOPL_MASK) != FL_IOPL_3) return -E_BAD_ENV;
+    if (irq < 0 || irq >= MAX_IRQS || !(IRQ_USER_MASK & (1 << irq))) return -E_INVAL;
+
+    pic_irq_release(irq);
+    return 0;
+}
+
 /* Dispatches to the correct kernel function, passing the arguments. */
 uintptr_t
 syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
@@ -470,12 +797,26 @@ syscall(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t
         return 0;
     } else if (syscallno == SYS_ipc_try_send) {
         return sys_ipc_try_send((envid_t)a1, (uint32_t)a2, a3, (size_t)a4, (int)a5);
+    } else if (syscallno == SYS_ipc_send) {
+        return sys_ipc_send((envid_t)a1, (uint32_t)a2, a3, (size_t)a4, (int)a5);
     } else if (syscallno == SYS_ipc_recv) {
-        return sys_ipc_recv(a1, a2);
+        return sys_ipc_recv(a1, a2, a3, (uint32_t)a4, a5);
     } else if (syscallno == SYS_env_set_trapframe) {
         return sys_env_set_trapframe((envid_t)a1, (struct Trapframe*)a2);
     } else if (syscallno == SYS_gettime) {
         return sys_gettime();
+    } else if (syscallno == SYS_ring_register) {
+        return sys_ring_register((struct SyscallRing*)a1);
+    } else if (syscallno == SYS_ring_enter) {
+        return sys_ring_enter();
+    } else if (syscallno == SYS_futex_wait) {
+        return sys_futex_wait((const uint32_t*)a1, (uint32_t)a2, a3);
+    } else if (syscallno == SYS_futex_wake) {
+        return sys_futex_wake((const uint32_t*)a1, (int)a2);
+    } else if (syscallno == SYS_region_pa) {
+        return sys_region_pa(a1, (int)a2);
+    } else if (syscallno == SYS_irq_ack) {
+        return sys_irq_ack((int)a1);
     }
     return -E_NO_SYS;
 }
\ No newline at end of file
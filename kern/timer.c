@@ -73,7 +73,7 @@ acpi_enable(void) {
         ;
 }
 
-static void *
+void *
 acpi_find_table(const char *sign) {
     /*
      * This function performs lookup of ACPI table by its signature
@@ -143,7 +143,7 @@ acpi_find_table(const char *sign) {
     for (i = 0; i < rsdt_len; i++) {
         memcpy(&fadt_pa, (uint8_t *)rsdt->PointerToOtherSDT + i * rsdt_entsz, rsdt_entsz);
         head = mmio_map_region(fadt_pa, sizeof(ACPISDTHeader));
-        head = mmio_remap_last_region(fadt_pa, head, sizeof(ACPISDTHeader), rsdt->h.Length);
+        head = mmio_remap_last_region(fadt_pa, head, sizeof(ACPISDTHeader), head->Length);
         for (size_t i = 0; i < head->Length; i++) {
             err += ((uint8_t *)head)[i];
         }
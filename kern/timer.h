@@ -170,8 +170,40 @@ typedef struct {
     uint8_t Reserved3[3];
 } FADT;
 
+/* Multiple APIC Description Table */
+typedef struct {
+    ACPISDTHeader h;
+    uint32_t LocalApicAddress;
+    uint32_t Flags;
+    uint8_t Entries[]; /* Variable length MADTEntry records */
+} MADT;
+
+typedef struct {
+    uint8_t Type;
+    uint8_t Length;
+} MADTEntry;
+
+#define MADT_LAPIC          0 /* Processor Local APIC */
+#define MADT_LAPIC_OVERRIDE 5 /* Local APIC Address Override */
+
+typedef struct {
+    MADTEntry h;
+    uint8_t ProcessorId;
+    uint8_t ApicId;
+    uint32_t Flags;
+} MADTLapic;
+
+#define MADT_LAPIC_ENABLED 0x1
+
+typedef struct {
+    MADTEntry h;
+    uint16_t Reserved;
+    uint64_t Address;
+} MADTLapicOverride;
+
 #pragma pack(pop)
 
+void *acpi_find_table(const char *sign);
 void acpi_enable(void);
 RSDP *get_rsdp(void);
 FADT *get_fadt(void);
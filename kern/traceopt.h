@@ -46,6 +46,18 @@
 #define trace_spinlock 0
 #endif
 
+/* Check that kernel locks are acquired in the order
+ * given by enum LockOrder in kern/spinlock.h */
+#ifndef trace_lock_order
+#define trace_lock_order 0
+#endif
+
+/* Collect per-lock contention statistics,
+ * see lockstat monitor command */
+#ifndef trace_lock_stats
+#define trace_lock_stats 0
+#endif
+
 #ifndef trace_init
 #define trace_init 1
 #endif
@@ -9,16 +9,17 @@
 #include <kern/console.h>
 #include <kern/monitor.h>
 #include <kern/env.h>
+#include <kern/futex.h>
 #include <kern/syscall.h>
 #include <kern/sched.h>
 #include <kern/kclock.h>
 #include <kern/picirq.h>
 #include <kern/timer.h>
 #include <kern/vsyscall.h>
+#include <kern/cpu.h>
+#include <kern/spinlock.h>
 #include <kern/traceopt.h>
 
-static struct Taskstate ts;
-
 /* For debugging, so print_trapframe can distinguish between printing
  * a saved trapframe and printing the current trapframe and print some
  * additional information in the latter case */
@@ -54,10 +55,10 @@ struct Segdesc32 gdt[2 * NCPU + 7] = {
         [GD_KT32 >> 3] = SEG32(STA_X | STA_R, 0x0, 0xFFFFFFFF, 0),
         /* 0x20 - kernel data segment 32bit */
         [GD_KD32 >> 3] = SEG32(STA_W, 0x0, 0xFFFFFFFF, 0),
-        /* 0x28 - user code segment */
-        [GD_UT >> 3] = SEG64(STA_X | STA_R, 0x0, 0xFFFFFFFF, 3),
-        /* 0x30 - user data segment */
+        /* 0x28 - user data segment */
         [GD_UD >> 3] = SEG64(STA_W, 0x0, 0xFFFFFFFF, 3),
+        /* 0x30 - user code segment */
+        [GD_UT >> 3] = SEG64(STA_X | STA_R, 0x0, 0xFFFFFFFF, 3),
         /* Per-CPU TSS descriptors (starting from GD_TSS0) are initialized
      * in trap_init_percpu() */
         [GD_TSS0 >> 3] = SEG_NULL,
@@ -151,6 +152,28 @@ trap_init(void) {
     idt[IRQ_OFFSET + IRQ_KBD] = GATE(0, GD_KT, (uintptr_t)(&kbd_thdlr), 3);
     extern void (*serial_thdlr)(void);
     idt[IRQ_OFFSET + IRQ_SERIAL] = GATE(0, GD_KT, (uintptr_t)(&serial_thdlr), 3);
+    /* Lines PCI devices and IDE channels are routed to,
+     * they can be driven by user environments */
+    extern void (*irq5_thdlr)(void);
+    idt[IRQ_OFFSET + 5] = GATE(0, GD_KT, (uintptr_t)(&irq5_thdlr), 0);
+    extern void (*irq9_thdlr)(void);
+    idt[IRQ_OFFSET + 9] = GATE(0, GD_KT, (uintptr_t)(&irq9_thdlr), 0);
+    extern void (*irq10_thdlr)(void);
+    idt[IRQ_OFFSET + 10] = GATE(0, GD_KT, (uintptr_t)(&irq10_thdlr), 0);
+    extern void (*irq11_thdlr)(void);
+    idt[IRQ_OFFSET + 11] = GATE(0, GD_KT, (uintptr_t)(&irq11_thdlr), 0);
+    extern void (*irq14_thdlr)(void);
+    idt[IRQ_OFFSET + 14] = GATE(0, GD_KT, (uintptr_t)(&irq14_thdlr), 0);
+    extern void (*irq15_thdlr)(void);
+    idt[IRQ_OFFSET + 15] = GATE(0, GD_KT, (uintptr_t)(&irq15_thdlr), 0);
+    extern void (*spurious_thdlr)(void);
+    idt[IRQ_OFFSET + IRQ_SPURIOUS] = GATE(0, GD_KT, (uintptr_t)(&spurious_thdlr), 0);
+    extern void (*error_thdlr)(void);
+    idt[IRQ_OFFSET + IRQ_ERROR] = GATE(0, GD_KT, (uintptr_t)(&error_thdlr), 0);
+    extern void (*lapic_timer_thdlr)(void);
+    idt[IRQ_OFFSET + IRQ_LAPIC_TIMER] = GATE(0, GD_KT, (uintptr_t)(&lapic_timer_thdlr), 0);
+    extern void (*resched_thdlr)(void);
+    idt[IRQ_OFFSET + IRQ_RESCHED] = GATE(0, GD_KT, (uintptr_t)(&resched_thdlr), 0);
     /* Setup #PF handler dedicated stack
      * It should be switched on #PF because
      * #PF is the only kind of exception that
@@ -193,16 +216,36 @@ trap_init_percpu(void) {
             : "cc", "memory");
 
     /* Setup a TSS so that we get the right stack
-     * when we trap to the kernel. */
-    ts.ts_rsp0 = KERN_STACK_TOP;
-    ts.ts_ist1 = KERN_PF_STACK_TOP;
-
-    /* Initialize the TSS slot of the gdt. */
-    *(volatile struct Segdesc64 *)(&gdt[(GD_TSS0 >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)&ts), sizeof(struct Taskstate), 0);
+     * when we trap to the kernel. Each CPU has its own
+     * TSS, kernel stack and #PF stack. */
+    struct Taskstate *ts = &thiscpu->cpu_ts;
+    int id = thiscpu->cpu_id;
+    ts->ts_rsp0 = KERN_STACK_TOP_CPU(id);
+    ts->ts_ist1 = KERN_PF_STACK_TOP_CPU(id);
+
+    /* Initialize the TSS slot of the gdt
+     * (64-bit TSS descriptor takes two slots) */
+    uint16_t tss_sel = GD_TSS0 + (id << 4);
+    *(volatile struct Segdesc64 *)(&gdt[(tss_sel >> 3)]) = SEG64_TSS(STS_T64A, ((uint64_t)ts), sizeof(struct Taskstate), 0);
 
     /* Load the TSS selector (like other segment selectors, the
      * bottom three bits are special; we leave them 0) */
-    ltr(GD_TSS0);
+    ltr(tss_sel);
+
+#ifndef CONFIG_KSPACE
+    /* Enable SYSCALL/SYSRET: SYSCALL loads CS from STAR[47:32]
+     * and SS from STAR[47:32] + 8, SYSRET to 64-bit mode loads
+     * SS from STAR[63:48] + 8 and CS from STAR[63:48] + 16 (with RPL 3),
+     * which are GD_UD and GD_UT. Interrupts are disabled on entry
+     * and the entry code finds its stack through swapgs */
+    extern void syscall_entry(void);
+    thiscpu->cpu_syscall.sc_kstack = ts->ts_rsp0;
+    wrmsr(STAR_MSR, ((uint64_t)(GD_KD32 | 3) << 48) | ((uint64_t)GD_KT << 32));
+    wrmsr(LSTAR_MSR, (uintptr_t)syscall_entry);
+    wrmsr(SFMASK_MSR, FL_IF | FL_TF | FL_DF | FL_AC | FL_NT);
+    wrmsr(KERNEL_GS_BASE_MSR, (uintptr_t)&thiscpu->cpu_syscall);
+    wrmsr(EFER_MSR, rdmsr(EFER_MSR) | EFER_SCE);
+#endif
 
     /* Load the IDT */
     lidt(&idt_pd);
@@ -266,6 +309,7 @@ static void
 trap_dispatch(struct Trapframe *tf) {
     switch (tf->tf_trapno) {
     case T_SYSCALL:
+        curenv->env_syscalls++;
         tf->tf_regs.reg_rax = syscall(
                 tf->tf_regs.reg_rax,
                 tf->tf_regs.reg_rdx,
@@ -293,6 +337,23 @@ trap_dispatch(struct Trapframe *tf) {
             print_trapframe(tf);
         }
         return;
+    case IRQ_OFFSET + IRQ_ERROR:
+        cprintf("Local APIC error on CPU %d\n", cpunum());
+        lapic_eoi();
+        return;
+    case IRQ_OFFSET + IRQ_LAPIC_TIMER:
+        /* Time slice of an application processor is over */
+        lapic_eoi();
+        spin_lock(&env_lock);
+        sched_yield();
+        return;
+    case IRQ_OFFSET + IRQ_RESCHED:
+        /* Another CPU has queued work for us (or wants us
+         * to steal some), see sched_kick() */
+        lapic_eoi();
+        spin_lock(&env_lock);
+        sched_yield();
+        return;
     case IRQ_OFFSET + IRQ_TIMER:
     case IRQ_OFFSET + IRQ_CLOCK:
         // LAB 12: Your code here
@@ -302,28 +363,76 @@ trap_dispatch(struct Trapframe *tf) {
         timer_for_schedule->handle_interrupts();
         rtc_check_status();
         pic_send_eoi(IRQ_CLOCK);
+        spin_lock(&env_lock);
         sched_yield();
         return;
         /* Handle keyboard and serial interrupts. */
         // LAB 11: Your code here
     case IRQ_OFFSET + IRQ_KBD:
         kbd_intr();
+        spin_lock(&env_lock);
         sched_yield();
         return;
     case IRQ_OFFSET + IRQ_SERIAL:
         serial_intr();
+        spin_lock(&env_lock);
+        sched_yield();
+        return;
+    case IRQ_OFFSET + 5:
+    case IRQ_OFFSET + 9:
+    case IRQ_OFFSET + 10:
+    case IRQ_OFFSET + 11:
+    case IRQ_OFFSET + 14:
+    case IRQ_OFFSET + 15:
+        /* The device is driven by a user environment, just let it
+         * know about the interrupt. PCI interrupts are level triggered,
+         * the line stays masked until the driver has serviced the device */
+        pic_irq_hold(tf->tf_trapno - IRQ_OFFSET);
+        pic_send_eoi(tf->tf_trapno - IRQ_OFFSET);
+        spin_lock(&env_lock);
+        futex_wake_vsys(VSYS_irq + tf->tf_trapno - IRQ_OFFSET);
         sched_yield();
         return;
     default:
         print_trapframe(tf);
         if (!(tf->tf_cs & 3))
             panic("Unhandled trap in kernel");
+        spin_lock(&env_lock);
         env_destroy(curenv);
     }
 }
 
-/* We do not support recursive page faults in-kernel */
-bool in_page_fault;
+/* Called by syscall_entry (kern/trapentry.S) after SYSCALL instruction
+ * with user state already saved in curenv->env_tf. The result is
+ * returned to the user with SYSRET, unless the environment can't
+ * continue right away, in which case we leave through the generic path */
+uintptr_t
+syscall_fast(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+    assert(curenv);
+    curenv->env_syscalls++;
+
+    /* See trap() */
+    if (curenv->env_status == ENV_DYING) {
+        spin_lock(&env_lock);
+        sched_yield();
+    }
+
+    uintptr_t res = syscall(syscallno, a1, a2, a3, a4, a5, a6);
+
+    /* Registers saved on entry might have been replaced */
+    if (curenv->env_status != ENV_RUNNING || syscallno == SYS_env_set_trapframe) {
+        curenv->env_tf.tf_regs.reg_rax = res;
+        if (curenv->env_status == ENV_RUNNING)
+            env_pop_tf(&curenv->env_tf);
+        spin_lock(&env_lock);
+        sched_yield();
+    }
+
+#if trace_lock_order
+    if (thiscpu->cpu_nlocks) panic("Returning to user mode with %d locks held", thiscpu->cpu_nlocks);
+#endif
+    return res;
+}
 
 _Noreturn void
 trap(struct Trapframe *tf) {
@@ -341,6 +450,22 @@ trap(struct Trapframe *tf) {
      * the interrupt path */
     assert(!(read_rflags() & FL_IF));
 
+    /* Account idle time if we were halted in sched_yield() */
+    if (xchg(&thiscpu->cpu_status, CPU_STARTED) == CPU_HALTED)
+        thiscpu->cpu_idle_cycles += read_tsc() - thiscpu->cpu_idle_start;
+
+    if ((tf->tf_cs & 3) == 3) {
+        assert(curenv);
+
+        /* Garbage collect if current enviroment is a zombie
+         * (ENV_DYING is only set by other CPUs and never cleared,
+         * so it is safe to check it without env_lock) */
+        if (curenv->env_status == ENV_DYING) {
+            spin_lock(&env_lock);
+            sched_yield();
+        }
+    }
+
     if (trace_traps) cprintf("Incoming TRAP[%ld] frame at %p\n", tf->tf_trapno, tf);
     if (trace_traps_more) print_trapframe(tf);
 
@@ -387,14 +512,15 @@ trap(struct Trapframe *tf) {
         }
     }
 
-    assert(curenv);
-
-    /* Copy trap frame (which is currently on the stack)
-     * into 'curenv->env_tf', so that running the environment
-     * will restart at the trap point */
-    curenv->env_tf = *tf;
-    /* The trapframe on the stack should be ignored from here on */
-    tf = &curenv->env_tf;
+    /* Idle CPU woken up from sched_halt() has no environment */
+    if (curenv) {
+        /* Copy trap frame (which is currently on the stack)
+         * into 'curenv->env_tf', so that running the environment
+         * will restart at the trap point */
+        curenv->env_tf = *tf;
+        /* The trapframe on the stack should be ignored from here on */
+        tf = &curenv->env_tf;
+    }
 
     /* Record that tf is the last real trapframe so
      * print_trapframe can print some additional information */
@@ -405,11 +531,14 @@ trap(struct Trapframe *tf) {
 
     /* If we made it to this point, then no other environment was
      * scheduled, so we should return to the current environment
-     * if doing so makes sense */
+     * if doing so makes sense. Other CPUs can only make curenv
+     * not runnable or dying, which is handled on the next kernel
+     * entry, so there is no need to take env_lock here */
     if (curenv && curenv->env_status == ENV_RUNNING)
-        env_run(curenv);
-    else
-        sched_yield();
+        env_pop_tf(&curenv->env_tf);
+
+    spin_lock(&env_lock);
+    sched_yield();
 }
 
 static _Noreturn void
@@ -501,10 +630,11 @@ page_fault_handler(struct Trapframe *tf) {
     in_page_fault = 0;
     /* Rerun current environment */
     // LAB 9: Your code here:
-    env_run(curenv);
+    env_pop_tf(&curenv->env_tf);
 ret:
     user_mem_assert(curenv, (void *)tf->tf_rsp, sizeof(struct UTrapframe), PROT_W | PROT_USER_);
     print_trapframe(tf);
+    spin_lock(&env_lock);
     env_destroy(curenv);
     panic("page_fault_handler is return");
 }
\ No newline at end of file
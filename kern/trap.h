@@ -8,17 +8,19 @@
 
 #include <inc/trap.h>
 #include <inc/mmu.h>
+#include <kern/cpu.h>
 
 /* The kernel's interrupt descriptor table */
 extern struct Gatedesc idt[];
 extern struct Pseudodesc idt_pd;
 
-extern bool in_page_fault;
+#define in_page_fault (thiscpu->cpu_in_page_fault)
 
 void clock_idt_init(void);
 void trap_init(void);
 void trap_init_percpu(void);
 void print_regs(struct PushRegs *regs);
 void print_trapframe(struct Trapframe *tf);
+uintptr_t syscall_fast(uintptr_t syscallno, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6);
 
 #endif /* JOS_KERN_TRAP_H */
@@ -0,0 +1,81 @@
+/* Shared memory message rings, see inc/chan.h.
+ *
+ * The two environments only touch each other's cache lines when
+ * a message is published or consumed, system calls are only made
+ * to put the consumer to sleep and to wake it up */
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+    r->cr_waiting = 0;
+    r->cr_tail = 0;
+}
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+}
+
+/* Producer: make the message written to the chan_prepare() slot
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+}
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+    if (!count || count > CHAN_NSLOTS) return NULL;
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+}
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+}
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+    r->cr_waiting = 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!chan_peek(r)) return 1;
+
+    r->cr_waiting = 0;
+    return 0;
+}
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+    while (chan_arm(r))
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+}
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+    sys_futex_wake(&r->cr_tail, 1);
+}
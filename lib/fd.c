@@ -1,7 +1,5 @@
 #include <inc/lib.h>
 
-/* Maximum number of file descriptors a program may hold open concurrently */
-#define MAXFD 32
 /* Bottom of file descriptor area */
 #define FDTABLE 0xD0000000LL
 /* Bottom of file data area.  We reserve one data page for each FD,
@@ -234,6 +232,10 @@ seek(int fdnum, off_t offset) {
 
     if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
 
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+
     fd->fd_offset = offset;
     return 0;
 }
@@ -2,37 +2,256 @@
 #include <inc/string.h>
 #include <inc/lib.h>
 
-union Fsipc fsipcbuf __attribute__((aligned(PAGE_SIZE)));
+/* Request page followed by the data area, sent as a single region */
+static struct {
+    union Fsipc req;
+    uint8_t data[FSIPC_DATA_SIZE];
+} fsipcarea __attribute__((aligned(FSIPC_DATA_SIZE)));
+
+extern union Fsipc fsipcbuf __attribute__((alias("fsipcarea")));
+
+/* Channel to the file server, see struct FsChannel.
+ * Used instead of IPC after fs_channel(1) */
+#define FSCHAN ((struct FsChannel *)0xCFF00000)
+
+static bool fschan_enabled;
+/* Environment the mapped channel belongs to,
+ * children inherit the parent's one */
+static envid_t fschan_owner;
+
+static struct FsChannel *fschan(void);
+static int fschan_call(struct FsChannel *ch, unsigned type);
+
+/* Buffered I/O.
+ *
+ * Reads and writes smaller than FBUF_SIZE go through a private buffer
+ * per descriptor, which holds either data read ahead from the file or
+ * writes not sent to the server yet, starting at file offset fb_start.
+ * fd_offset stays the logical position. The buffer is filled and
+ * flushed at an explicit req_offset, which leaves fd_offset alone,
+ * and is bypassed while the Fd page is shared (see fbuf_shared()),
+ * so other users of the descriptor see every read and write. The
+ * server bumps fd_file.gen of every opener on writes and truncation,
+ * buffered data read before that is dropped. Buffered writes are sent on close, seek, fsync,
+ * and before fork() and spawn() with file_flush_buffers(). */
+
+#ifndef FBUF_PAGES
+#define FBUF_PAGES 4
+#endif
+
+#define FBUF_VA   0xD1000000ULL
+#define FBUF_SIZE (FBUF_PAGES * PAGE_SIZE)
+#define FBUF(i)   ((char *)(FBUF_VA + (i)*FBUF_SIZE))
+
+struct Fbuf {
+    int fb_id;       /* fd_file.id of the buffered data */
+    uint32_t fb_gen; /* fd_file.gen when the data was read */
+    bool fb_dirty;   /* Holds writes rather than read data */
+    off_t fb_start;  /* File offset of the buffer */
+    size_t fb_len;   /* Bytes in the buffer */
+};
+
+static struct Fbuf fbufs[MAXFD];
+
+/* Buffer of fd, NULL if fd is not in the descriptor table */
+static struct Fbuf *
+fbuf(struct Fd *fd) {
+    uint64_t i = fd2num(fd);
+    return i < MAXFD ? &fbufs[i] : NULL;
+}
+
+/* Whether fd is shared with another environment (or with another
+ * descriptor of ours after dup()). The server maps the Fd page too.
+ * Buffers of shared descriptors are not used, other users could not
+ * see the data and the seek position they hold */
+static bool
+fbuf_shared(struct Fd *fd) {
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+}
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+    return envid;
+}
 
 /* Send an inter-environment request to the file server, and wait for
  * a reply.  The request body should be in fsipcbuf, and parts of the
  * response may be written back to fsipcbuf.
  * type: request code, passed as the simple integer IPC value.
  * dstva: virtual address at which to receive reply page, 0 if none.
+ * datasz: number of bytes of fsipcarea.data the request uses.
  * Returns result from the file server. */
 static int
-fsipc(unsigned type, void *dstva) {
-    static envid_t fsenv;
-
-    if (!fsenv) fsenv = ipc_find_env(ENV_TYPE_FS);
+fsipc(unsigned type, void *dstva, size_t datasz) {
+    struct FsChannel *ch;
 
     static_assert(sizeof(fsipcbuf) == PAGE_SIZE, "Invalid fsipcbuf size");
 
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+        return fschan_call(ch, type);
+
     if (debug) {
         cprintf("[%08x] fsipc %d %08x\n",
                 thisenv->env_id, type, *(uint32_t *)&fsipcbuf);
     }
 
-    ipc_send(fsenv, type, &fsipcbuf, PAGE_SIZE, PROT_RW);
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
     size_t maxsz = PAGE_SIZE;
     return ipc_recv(NULL, dstva, &maxsz, NULL);
 }
 
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+    fschan_owner = 0;
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+    if (res < 0) return res;
+
+    FSCHAN->fc_client = thisenv->env_id;
+    chan_init(&FSCHAN->fc_req);
+    chan_init(&FSCHAN->fc_resp);
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+    return 0;
+}
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+}
+
+/* Send requests to the file server through a channel
+ * instead of IPC if enable is set. Returns 0 on success
+ * or the error of the channel setup */
+int
+fs_channel(bool enable) {
+    fschan_enabled = enable;
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+
+    int res = fschan_setup();
+    if (res < 0) fschan_enabled = 0;
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+    if (chan_publish(&ch->fc_req))
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+
+/* Wait for the response to the oldest request in flight,
+ * it has to be released with chan_release() */
+static struct Fsmsg *
+fschan_reply(struct FsChannel *ch) {
+    chan_wait(&ch->fc_resp);
+    return chan_peek(&ch->fc_resp);
+}
+
+/* Channel version of fsipc(), the request is in fsipcbuf */
+static int
+fschan_call(struct FsChannel *ch, unsigned type) {
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+    msg->fm_type = type;
+    msg->fm_chain = 0;
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+    fschan_publish(ch);
+
+    msg = fschan_reply(ch);
+    int res = msg->fm_res;
+    if (type == FSREQ_STAT && res >= 0)
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+    chan_release(&ch->fc_resp);
+
+    return res;
+}
+
+/* Read or write n bytes at offset (FSREQ_OFFSET_CUR for the seek
+ * position) in FSCHAN_DATA_SIZE pieces keeping up to CHAN_NSLOTS
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+    static uint32_t chain;
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+
+    while ((!stop && queued < n) || inflight) {
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+
+            msg->fm_type = type;
+            msg->fm_chain = chain;
+            if (type == FSREQ_READ) {
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+                msg->fm_req.read.req_offset = pos;
+                msg->fm_req.read.req_n = blk;
+            } else {
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+                msg->fm_req.write.req_offset = pos;
+                msg->fm_req.write.req_n = blk;
+                memcpy(msg->fm_data, buf + queued, blk);
+            }
+            fschan_publish(ch);
+
+            queued += blk;
+            inflight++;
+        }
+
+        struct Fsmsg *msg = fschan_reply(ch);
+        inflight--;
+        if (!stop) {
+            if (msg->fm_res < 0) {
+                err = msg->fm_res;
+                stop = 1;
+            } else {
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+                done += msg->fm_res;
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+}
+
 static int devfile_flush(struct Fd *fd);
 static ssize_t devfile_read(struct Fd *fd, void *buf, size_t n);
 static ssize_t devfile_write(struct Fd *fd, const void *buf, size_t n);
 static int devfile_stat(struct Fd *fd, struct Stat *stat);
 static int devfile_trunc(struct Fd *fd, off_t newsize);
+static int devfile_seek(struct Fd *fd, off_t offset);
+static int fbuf_flush(struct Fd *fd);
 
 struct Dev devfile = {
         .dev_id = 'f',
@@ -41,7 +260,8 @@ struct Dev devfile = {
         .dev_close = devfile_flush,
         .dev_stat = devfile_stat,
         .dev_write = devfile_write,
-        .dev_trunc = devfile_trunc};
+        .dev_trunc = devfile_trunc,
+        .dev_seek = devfile_seek};
 
 /* Open a file (or directory).
  *
@@ -78,7 +298,7 @@ open(const char *path, int mode) {
     strcpy(fsipcbuf.open.req_path, path);
     fsipcbuf.open.req_omode = mode;
 
-    if ((res = fsipc(FSREQ_OPEN, fd)) < 0) {
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
         fd_close(fd, 0);
         return res;
     }
@@ -96,33 +316,77 @@ open(const char *path, int mode) {
  * to disk. */
 static int
 devfile_flush(struct Fd *fd) {
+    int res = fbuf_flush(fd);
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+
     fsipcbuf.flush.req_fileid = fd->fd_file.id;
-    return fsipc(FSREQ_FLUSH, NULL);
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+    return res < 0 ? res : res2;
 }
 
-/* Read at most 'n' bytes from 'fd' at the current position into 'buf'.
+/* Read whole blocks by having the file server map its block cache
+ * pages copy-on-write at buf, see serve_read_map(). buf has to be
+ * page aligned and n a multiple of PAGE_SIZE. Returns the number
+ * of bytes read, or -E_NOT_SUPP if the data has to be copied */
+static ssize_t
+devfile_read_map(struct Fd *fd, void *buf, size_t n, off_t offset) {
+    /* The mapping replaces the pages, which would break sharing */
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+    fsipcbuf.read.req_offset = offset;
+    fsipcbuf.read.req_n = n;
+
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+    return ipc_recv(NULL, buf, &n, NULL);
+}
+
+/* Read at most 'n' bytes from 'fd' at 'offset' into 'buf', bypassing
+ * the buffer. FSREQ_OFFSET_CUR reads at the current position and
+ * advances it, other offsets leave it alone.
  *
  * Returns:
  *  The number of bytes successfully read.
  *  < 0 on error. */
 static ssize_t
-devfile_read(struct Fd *fd, void *buf, size_t n) {
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
     /* Make an FSREQ_READ request to the file system server after
    * filling fsipcbuf.read with the request arguments.  The
-   * bytes read will be written back to fsipcbuf by the file
-   * system server. */
-    if (!fd || !buf)
-        return E_INVAL;
+   * bytes read will be written back to the data area by the file
+   * system server, up to FSIPC_DATA_SIZE bytes per request. */
+    struct FsChannel *ch = fschan();
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
 
     size_t read = 0;
+    bool map = 1;
     while (n) {
+        /* Whole pages need no copying */
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+            if (!res) return read;
+            if (res > 0) {
+                buf += res;
+                n -= res;
+                read += res;
+                continue;
+            }
+            if (res != -E_NOT_SUPP) return res;
+            map = 0;
+        }
+
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+
         fsipcbuf.read.req_fileid = fd->fd_file.id;
-        fsipcbuf.read.req_n = n;
+        fsipcbuf.read.req_offset = pos;
+        fsipcbuf.read.req_n = blk;
 
-        int res = fsipc(FSREQ_READ, NULL);
+        int res = fsipc(FSREQ_READ, NULL, blk);
         if (res <= 0)
             return res ? res : read;
-        memcpy(buf, fsipcbuf.readRet.ret_buf, res);
+        memcpy(buf, fsipcarea.data, res);
 
         buf += res;
         n -= res;
@@ -132,29 +396,32 @@ devfile_read(struct Fd *fd, void *buf, size_t n) {
     return read;
 }
 
-/* Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
+/* Write at most 'n' bytes from 'buf' to 'fd' at 'offset', bypassing
+ * the buffer. As in devfile_read_direct(), FSREQ_OFFSET_CUR writes
+ * at the current seek position and advances it.
  *
  * Returns:
  *   The number of bytes successfully written.
  *   < 0 on error. */
 static ssize_t
-devfile_write(struct Fd *fd, const void *buf, size_t n) {
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
     /* Make an FSREQ_WRITE request to the file system server.  Be
-   * careful: fsipcbuf.write.req_buf is only so large, but
+   * careful: the data area is only FSIPC_DATA_SIZE bytes, but
    * remember that write is always allowed to write *fewer*
    * bytes than requested. */
-    if (!fd || !buf)
-        return E_INVAL;
+    struct FsChannel *ch = fschan();
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
 
     size_t write = 0;
 
     while (n) {
-        size_t blk = MIN(n, sizeof(fsipcbuf.write.req_buf));
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
 
-        memcpy(fsipcbuf.write.req_buf, buf, blk);
+        memcpy(fsipcarea.data, buf, blk);
         fsipcbuf.write.req_fileid = fd->fd_file.id;
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
         fsipcbuf.write.req_n = blk;
-        int res = fsipc(FSREQ_WRITE, NULL);
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
         if (res < 0)
             return res;
         buf += res;
@@ -165,11 +432,131 @@ devfile_write(struct Fd *fd, const void *buf, size_t n) {
     return write;
 }
 
+/* Send the buffered writes of fd to the server */
+static int
+fbuf_flush(struct Fd *fd) {
+    struct Fbuf *fb = fbuf(fd);
+    if (!fb || !fb->fb_dirty) return 0;
+
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+
+    fb->fb_dirty = 0;
+    fb->fb_len = 0;
+    return res < 0 ? res : 0;
+}
+
+void
+file_flush_buffers(void) {
+    struct Fd *fd;
+    for (int i = 0; i < MAXFD; i++)
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+}
+
+/* Make sure the buffer holds the data at the current position of fd.
+ * Returns the number of bytes buffered from there on, 0 at the end
+ * of the file */
+static ssize_t
+fbuf_fill(struct Fd *fd, struct Fbuf *fb) {
+    char *data = FBUF(fb - fbufs);
+    off_t pos = fd->fd_offset;
+    int res;
+
+    if ((res = fbuf_flush(fd)) < 0) return res;
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+        return fb->fb_start + fb->fb_len - pos;
+
+    if (!is_page_present(data) &&
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+
+    /* Read ahead from the block boundary, so the pages can be mapped */
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+    fb->fb_len = 0;
+    fb->fb_gen = fd->fd_file.gen;
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+    if (n < 0) return n;
+
+    fb->fb_id = fd->fd_file.id;
+    fb->fb_start = start;
+    fb->fb_len = n;
+    return MAX(start + n - pos, 0);
+}
+
+/* Read at most 'n' bytes from 'fd' at the current position into 'buf'.
+ *
+ * Returns:
+ *  The number of bytes successfully read.
+ *  < 0 on error. */
+static ssize_t
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+    if (!fd || !buf)
+        return E_INVAL;
+
+    struct Fbuf *fb = fbuf(fd);
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+        int res = fbuf_flush(fd);
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+    }
+
+    ssize_t res = fbuf_fill(fd, fb);
+    if (res <= 0) return res;
+
+    n = MIN(n, res);
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+    fd->fd_offset += n;
+    return n;
+}
+
+/* Write at most 'n' bytes from 'buf' to 'fd' at the current seek position.
+ *
+ * Returns:
+ *   The number of bytes successfully written.
+ *   < 0 on error. */
+static ssize_t
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+    if (!fd || !buf)
+        return E_INVAL;
+
+    struct Fbuf *fb = fbuf(fd);
+    if (!fb || fbuf_shared(fd)) {
+        int res = fbuf_flush(fd);
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+    }
+
+    char *data = FBUF(fb - fbufs);
+    int res;
+
+    /* Writes are buffered while they follow each other */
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+        if ((res = fbuf_flush(fd)) < 0) return res;
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+
+    if (!fb->fb_dirty) {
+        if (!is_page_present(data) &&
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+        fb->fb_dirty = 1;
+        fb->fb_start = fd->fd_offset;
+        fb->fb_len = 0;
+    }
+
+    memcpy(data + fb->fb_len, buf, n);
+    fb->fb_len += n;
+    fd->fd_offset += n;
+    return n;
+}
+
+static int
+devfile_seek(struct Fd *fd, off_t offset) {
+    return fbuf_flush(fd);
+}
+
 /* Get file information */
 static int
 devfile_stat(struct Fd *fd, struct Stat *st) {
+    file_flush_buffers();
+
     fsipcbuf.stat.req_fileid = fd->fd_file.id;
-    int res = fsipc(FSREQ_STAT, NULL);
+    int res = fsipc(FSREQ_STAT, NULL, 0);
     if (res < 0) return res;
 
     strcpy(st->st_name, fsipcbuf.statRet.ret_name);
@@ -182,10 +569,21 @@ devfile_stat(struct Fd *fd, struct Stat *st) {
 /* Truncate or extend an open file to 'size' bytes */
 static int
 devfile_trunc(struct Fd *fd, off_t newsize) {
+    file_flush_buffers();
+
     fsipcbuf.set_size.req_fileid = fd->fd_file.id;
     fsipcbuf.set_size.req_size = newsize;
 
-    return fsipc(FSREQ_SET_SIZE, NULL);
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+}
+
+/* Delete a file */
+int
+remove(const char *path) {
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+
+    strcpy(fsipcbuf.remove.req_path, path);
+    return fsipc(FSREQ_REMOVE, NULL, 0);
 }
 
 /* Synchronize disk with buffer cache */
@@ -194,5 +592,226 @@ sync(void) {
     /* Ask the file server to update the disk
      * by writing any dirty blocks in the buffer cache. */
 
-    return fsipc(FSREQ_SYNC, NULL);
-}
\ No newline at end of file
+    file_flush_buffers();
+    return fsipc(FSREQ_SYNC, NULL, 0);
+}
+
+/* Write file fdnum out to disk */
+int
+fsync(int fdnum) {
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+    if (res < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+
+    file_flush_buffers();
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+}
+
+/* Disk traffic of the file server block cache */
+int
+disk_stat(struct DiskStat *st) {
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+    if (res < 0) return res;
+
+    *st = fsipcbuf.diskstatRet;
+    return 0;
+}
+
+/* Hits, misses and evictions of the file server block cache */
+int
+cache_stat(struct CacheStat *st) {
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+    if (res < 0) return res;
+
+    *st = fsipcbuf.cachestatRet;
+    return 0;
+}
+/* Memory-mapped files.
+ *
+ * mmap() only records the mapping, its pages are requested from the file
+ * server with FSREQ_MAP when they are first touched, MMAP_FAULT_AROUND
+ * bytes at a time. The Fd page of the file is mapped once more at
+ * MMAP_FD(i) for mapping i, which keeps the file open on the server
+ * after the descriptor is closed */
+
+#define MMAP_MAX          32
+#define MMAP_VA           0x6000000000ULL
+#define MMAP_SIZE         0x1000000000ULL
+#define MMAP_FD_VA        0xD0400000ULL
+#define MMAP_FD(i)        ((struct Fd *)(MMAP_FD_VA + (i)*PAGE_SIZE))
+#define MMAP_FAULT_AROUND (16 * PAGE_SIZE)
+
+struct Mmap {
+    uintptr_t mm_start; /* 0 if the entry is free */
+    uintptr_t mm_end;
+    off_t mm_offset; /* File offset of mm_start */
+    int mm_perm;     /* As in struct Fsreq_map */
+};
+
+static struct Mmap mmaps[MMAP_MAX];
+
+/* Requests sent from the page fault handler, which can
+ * run while fsipcbuf is being filled in */
+static union Fsipc mmapbuf __attribute__((aligned(PAGE_SIZE)));
+
+static struct Mmap *
+mmap_find(uintptr_t va) {
+    for (size_t i = 0; i < MMAP_MAX; i++)
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+    return NULL;
+}
+
+/* Lowest free address in the mmap area for len bytes, 0 if there is none */
+static uintptr_t
+mmap_place(size_t len) {
+    uintptr_t va = MMAP_VA;
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+            va = mmaps[i].mm_end;
+            i = -1;
+        }
+    }
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+}
+
+/* Free entry with the Fd page fd mapped at its MMAP_FD(), NULL on error */
+static struct Mmap *
+mmap_alloc(struct Fd *fd) {
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+        if (mmaps[i].mm_start) continue;
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+        return &mmaps[i];
+    }
+    return NULL;
+}
+
+static void
+mmap_free(struct Mmap *m) {
+    m->mm_start = 0;
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+}
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+    size = MIN(size, m->mm_end - va);
+    size_t n = PAGE_SIZE;
+    while (n < size && !is_page_present((void *)va + n))
+        n += PAGE_SIZE;
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+    mmapbuf.map.req_n = n;
+    mmapbuf.map.req_perm = m->mm_perm;
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+}
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+}
+
+/* Map len bytes of file fdnum from page aligned offset on.
+ * prot is PROT_R or PROT_RW, flags is MAP_SHARED or MAP_PRIVATE,
+ * optionally with MAP_FIXED to map at *addr instead of an address
+ * chosen here and MAP_POPULATE to map all the pages right away.
+ * Shared mappings are read-only views of the file server's block
+ * cache, writes to private ones are copy-on-write and never reach
+ * the file. Touching pages past the end of the file is fatal.
+ * On success stores the address of the mapping to *addr */
+int
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+    static bool handler;
+    struct Fd *fd;
+    int res;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+
+    file_flush_buffers();
+
+    len = ROUNDUP(len, PAGE_SIZE);
+    uintptr_t va = (uintptr_t)*addr;
+    if (flags & MAP_FIXED) {
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+        if ((res = munmap(*addr, len)) < 0) return res;
+    } else if (!(va = mmap_place(len))) {
+        return -E_NO_MEM;
+    }
+
+    if (!handler) {
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+        handler = 1;
+    }
+
+    struct Mmap *m = mmap_alloc(fd);
+    if (!m) return -E_NO_MEM;
+    m->mm_start = va;
+    m->mm_end = va + len;
+    m->mm_offset = offset;
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+
+    if (flags & MAP_POPULATE) {
+        ssize_t n = 0;
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+            va += n;
+        if (n < 0) {
+            munmap((void *)m->mm_start, len);
+            return n;
+        }
+    }
+
+    *addr = (void *)m->mm_start;
+    return 0;
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+        struct Mmap *m = &mmaps[i];
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+
+        if (m->mm_start < start && m->mm_end > end) {
+            /* Split in two */
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+            m->mm_end = start;
+        } else if (m->mm_end > end) {
+            m->mm_offset += end - m->mm_start;
+            m->mm_start = end;
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+}
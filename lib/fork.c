@@ -18,6 +18,9 @@
 envid_t
 fork(void) {
     // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+
 	envid_t envid = sys_exofork();
     if (envid < 0)
         return envid;
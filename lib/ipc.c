@@ -3,8 +3,9 @@
 #include <inc/lib.h>
 
 /* Receive a value via IPC and return it.
- * If 'pg' is nonnull, then any page sent by the sender will be mapped at
- *    that address.
+ * If 'pg' is nonnull, then any region sent by the sender will be mapped at
+ *    that address. At most *size bytes (one page if 'size' is null)
+ *    are mapped and the size of the received region is stored in *size.
  * If 'from_env_store' is nonnull, then store the IPC sender's envid in
  *    *from_env_store.
  * If 'perm_store' is nonnull, then store the IPC sender's page permission
@@ -21,11 +22,20 @@
  *   a perfectly valid place to map a page.) */
 int32_t
 ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+}
+
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
     // LAB 9: Your code here:
     if (pg == NULL) {
         pg = (void *)MAX_USER_ADDRESS;
     }
-    int res = sys_ipc_recv(pg, PAGE_SIZE);
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
     if (res < 0) {
         if (from_env_store != NULL) {
             *from_env_store = 0;
@@ -33,6 +43,9 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
         if (perm_store != NULL) {
             *perm_store = 0;
         }
+        if (size != NULL) {
+            *size = 0;
+        }
         return res;
     } else {
         if (from_env_store != NULL) {
@@ -41,17 +54,19 @@ ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
         if (perm_store != NULL) {
             *perm_store = thisenv->env_ipc_perm;
         }
+        if (size != NULL) {
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+        }
         return thisenv->env_ipc_value;
     }
     return -1;
 }
 
 /* Send 'val' (and 'pg' with 'perm', if 'pg' is nonnull) to 'toenv'.
- * This function keeps trying until it succeeds.
- * It should panic() on any error other than -E_IPC_NOT_RECV.
+ * The kernel blocks the sender until the receiver takes the message
+ * (see sys_ipc_send()). Panics on errors.
  *
  * Hint:
- *   Use sys_yield() to be CPU-friendly.
  *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
  *   as meaning "no page".  (Zero is not the right value.) */
 void
@@ -60,13 +75,9 @@ ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
     if (pg == NULL) {
         pg = (void *)MAX_USER_ADDRESS;
     }
-    int res = sys_ipc_try_send(to_env, val, pg, size, perm);
-    while (res < 0) {
-        if (res < 0 && res != -E_IPC_NOT_RECV) {
-            panic("ipc_send error: %i\n", res);
-        }
-        sys_yield();
-        res = sys_ipc_try_send(to_env, val, pg, size, perm);
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+    if (res < 0) {
+        panic("ipc_send error: %i\n", res);
     }
 }
 
@@ -14,14 +14,48 @@ struct Dev devpipe = {
         .dev_stat = devpipe_stat,
 };
 
-#define PIPEBUFSIZ (PAGE_SIZE - 2 * sizeof(off_t))
+#define PIPEBUFSIZ (PAGE_SIZE - 2 * sizeof(off_t) - 2 * sizeof(uint32_t))
+
+/* Sleeping readers and writers recheck whether the other
+ * end is closed this often (in milliseconds), since
+ * environments can die without closing the pipe */
+#define PIPE_WAIT_TIMEOUT 10
 
 struct Pipe {
     off_t p_rpos;              /* read position */
     off_t p_wpos;              /* write position */
+    uint32_t p_rwaiting;       /* Readers sleep on p_wpos */
+    uint32_t p_wwaiting;       /* Writers sleep on p_rpos */
     uint8_t p_buf[PIPEBUFSIZ]; /* data buffer */
 };
 
+static int _pipeisclosed(struct Fd *fd, struct Pipe *p);
+
+/* Futex word of a position: its lower half */
+#define POS_WORD(pos) ((volatile uint32_t *)&(pos))
+
+/* Sleep until *pos changes from seen. The waiting flag
+ * is set before the pipe is checked for being closed, so either
+ * we notice the closure or devpipe_close() notices us */
+static void
+pipe_sleep(struct Fd *fd, struct Pipe *p, volatile uint32_t *waiting, off_t *pos, off_t seen) {
+    *waiting = 1;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+}
+
+/* Wake up the other side if it sleeps on pos
+ * which we have just advanced */
+static void
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (*waiting) {
+        *waiting = 0;
+        sys_futex_wake(POS_WORD(*pos), NENV);
+    }
+}
+
 int
 pipe(int pfd[2]) {
     int res;
@@ -99,14 +133,17 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
     for (size_t i = 0; i < n; i++) {
         while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
             /* If we got any data, return it */
-            if (i > 0) return i;
+            if (i > 0) {
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+                return i;
+            }
 
             /* If all the writers are gone, note eof */
             if (_pipeisclosed(fd, p)) return 0;
 
-            /* Yield and see what happens */
-            if (debug) cprintf("devpipe_read yield\n");
-            sys_yield();
+            /* Sleep until a writer advances p_wpos */
+            if (debug) cprintf("devpipe_read sleep\n");
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
         }
 
         /* There's a byte. Take it.
@@ -115,6 +152,7 @@ devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
         p->p_rpos++;
     }
 
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
     return n;
 }
 
@@ -135,9 +173,12 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
              * note eof */
             if (_pipeisclosed(fd, p)) return 0;
 
-            /* Yield and see what happens */
-            if (debug) cprintf("devpipe_write yield\n");
-            sys_yield();
+            /* Readers need the data written so far to make room */
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+
+            /* Sleep until a reader advances p_rpos */
+            if (debug) cprintf("devpipe_write sleep\n");
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
         }
         /* There's room for a byte. Store it.
          * Wait to increment wpos until the byte is stored! */
@@ -145,6 +186,7 @@ devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
         p->p_wpos++;
     }
 
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
     return n;
 }
 
@@ -160,6 +202,11 @@ devpipe_stat(struct Fd *fd, struct Stat *stat) {
 
 static int
 devpipe_close(struct Fd *fd) {
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+
     USED(sys_unmap_region(0, fd, PAGE_SIZE));
-    return sys_unmap_region(0, fd2data(fd), PAGE_SIZE);
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+    return sys_unmap_region(0, p, PAGE_SIZE);
 }
\ No newline at end of file
@@ -0,0 +1,137 @@
+/* Batched system calls: calls are queued to a ring shared
+ * with the kernel and executed with a single kernel entry
+ * by sys_ring_enter() (see kern/syscall.c).
+ *
+ * There is one ring per environment and it is not locked, so it must
+ * not be used by more than one thread of execution at a time. The
+ * file server threads share it, they only switch at explicit yields
+ * (see fs/thread.c). Calls one of them leaves queued across a yield
+ * may be submitted by another one, which gets their errors too */
+
+#include <inc/lib.h>
+
+static struct SyscallRing ring __attribute__((aligned(64)));
+
+/* Error of a submission forced by a full ring,
+ * reported by the next scring_submit() */
+static int pending_error;
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+/* Apply the same shadow memory updates as the stubs in syscall.c */
+static void
+sanitize_call(struct SyscallDesc *sd) {
+    uintptr_t va;
+
+    switch (sd->sd_num) {
+    case SYS_alloc_region:
+    case SYS_unmap_region:
+        va = sd->sd_args[1];
+        if (sd->sd_args[0] != CURENVID ||
+            (va >= SANITIZE_USER_SHADOW_BASE && va < SANITIZE_USER_SHADOW_BASE + SANITIZE_USER_SHADOW_SIZE)) break;
+        if (sd->sd_num == SYS_alloc_region)
+            platform_asan_unpoison((void *)va, sd->sd_args[2]);
+        else
+            platform_asan_poison((void *)va, sd->sd_args[2]);
+        break;
+    case SYS_map_region:
+        if (sd->sd_args[2] == CURENVID)
+            platform_asan_unpoison((void *)sd->sd_args[3], sd->sd_args[4]);
+        break;
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+        (res = sys_ring_register(&ring)) < 0) goto out;
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    for (; head != ring.sr_head; head++) {
+        struct SyscallDesc *sd = &ring.sr_desc[head % SCRING_SIZE];
+        if (sd->sd_res >= 0) sanitize_call(sd);
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+    return res;
+}
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+    if (pending_error) return;
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+    sd->sd_num = num;
+    sd->sd_args[0] = a1;
+    sd->sd_args[1] = a2;
+    sd->sd_args[2] = a3;
+    sd->sd_args[3] = a4;
+    sd->sd_args[4] = a5;
+    sd->sd_args[5] = a6;
+    ring.sr_tail++;
+}
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+    pending_error = 0;
+
+    if (res < 0)
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+        res = ring_enter();
+
+    return res;
+}
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+    ring.sr_tail = ring.sr_head;
+}
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+}
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+}
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+}
+
+void
+scring_env_set_status(envid_t envid, int status) {
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+}
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+}
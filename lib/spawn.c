@@ -78,6 +78,9 @@ spawn(const char *prog, const char **argv) {
 
     // TODO Properly load ELF and check errors
 
+    /* The child may write to the same files */
+    file_flush_buffers();
+
     int fd = open(prog, O_RDONLY);
     if (fd < 0) return fd;
 
@@ -127,19 +130,25 @@ spawn(const char *prog, const char **argv) {
 
     close(fd);
 
-    /* Copy shared library state. */
-    if ((res = foreach_shared_region(copy_shared_region, &child)) < 0)
-        panic("copy_shared_region: %i", res);
-
-    if ((res = sys_env_set_trapframe(child, &child_tf)) < 0)
-        panic("sys_env_set_trapframe: %i", res);
+    /* Memory operations on the child are queued to the system call
+     * ring (see scring.c) and the child is started with them in
+     * a single kernel entry. Shared regions are copied here too. */
+    foreach_shared_region(copy_shared_region, &child);
+    scring_env_set_trapframe(child, &child_tf);
+    scring_env_set_status(child, ENV_RUNNABLE);
 
-    if ((res = sys_env_set_status(child, ENV_RUNNABLE)) < 0)
-        panic("sys_env_set_status: %i", res);
+    if ((res = scring_submit()) < 0) {
+        cprintf("spawn: batched system call failed: %i\n", res);
+        goto error;
+    }
 
     return child;
 
 error:
+    /* Drop calls still queued for the child, one of
+     * them may be the unmap of the stack at UTEMP */
+    scring_discard();
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
     sys_env_destroy(child);
 error2:
     close(fd);
@@ -246,18 +255,19 @@ init_stack(envid_t child, const char **argv, struct Trapframe *tf) {
     tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
 
     /* After completing the stack, map it into the child's address space
-     * and unmap it from ours! */
-    if (sys_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
-                       USER_STACK_SIZE, PROT_RW) < 0) goto error;
-error:
-    if (sys_unmap_region(0, UTEMP, USER_STACK_SIZE) < 0) goto error;
-    return res;
+     * and unmap it from ours! Both calls are queued to the system call
+     * ring, errors are reported when it is submitted. */
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+                      USER_STACK_SIZE, PROT_RW);
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
 }
 
 static int
 copy_shared_region(void *start, void *end, void *arg) {
     envid_t child = *(envid_t *)arg;
-    return sys_map_region(0, start, child, start, end - start, get_prot(start));
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+    return 0;
 }
 
 
@@ -277,47 +287,39 @@ map_segment(envid_t child, uintptr_t va, size_t memsz,
     }
     // LAB 11: Your code here
 
-    /* Allocate filesz - memsz in child */
-    /* Allocate filesz in parent to UTEMP */
-    /* seek() fd to fileoffset  */
-    /* read filesz to UTEMP */
-    /* Map read section conents to child */
-    /* Unmap it from parent */
-    /* Allocate filesz - memsz in child */
+    /* Allocate memsz - filesz in child */
+    /* Map the file pages copy-on-write at UTEMP */
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
     filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
-    if (memsz > filesz) {
-        res = sys_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
-        if (res < 0) {
-            cprintf("map_segmen.sys_alloc_regin failed: %i\n", res);
-            return res;
-        }
-    }
-    res = sys_alloc_region(CURENVID, UTEMP, filesz, PROT_RW);
-    if (res < 0) {
-        cprintf("map_segment.sys_alloc_regin failed: %i\n", res);
-        return res;
-    }
-    res = seek(fd, fileoffset);
-    if (res < 0) {
-        cprintf("map_segment.seek failed: %i\n", res);
-        return res;
-    }
-    for (int i = 0; i < filesz; i += PAGE_SIZE) {
-        res = readn(fd, UTEMP + i, PAGE_SIZE);
-        if (res < 0) {
-            cprintf("map_segment.readn failed: %i\n", res);
-            return res;
-        }
-    }
-    res = sys_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
     if (res < 0) {
-        cprintf("map_segment.sys_map_region failed: %i\n", res);
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
         return res;
     }
-    res = sys_unmap_region(CURENVID, UTEMP, filesz);
+    if (!filesz) return 0;
+
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
     if (res < 0) {
-        cprintf("map_segment.sys_unmap_region failed: %i\n", res);
+        cprintf("map_segment.mmap failed: %i\n", res);
         return res;
     }
-    return 0;
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+    res = scring_submit();
+    munmap(UTEMP, filesz);
+    return res;
 }
\ No newline at end of file
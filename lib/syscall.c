@@ -9,30 +9,33 @@ syscall(uintptr_t num, bool check, uintptr_t a1, uintptr_t a2, uintptr_t a3, uin
 
     /* Generic system call.
      * Pass system call number in RAX,
-     * Up to six parameters in RDX, RCX, RBX, RDI, RSI and R8.
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
      * 
      * Registers are assigned using GCC externsion
      */
 
     register uintptr_t _a0 asm("rax") = num,
-                           _a1 asm("rdx") = a1, _a2 asm("rcx") = a2,
-                           _a3 asm("rbx") = a3, _a4 asm("rdi") = a4,
-                           _a5 asm("rsi") = a5, _a6 asm("r8") = a6;
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
 
-    /* Interrupt kernel with T_SYSCALL.
+    /* Enter the kernel with SYSCALL (see syscall_entry in kern/trapentry.S).
      * 
      * The "volatile" tells the assembler not to optimize
      * this instruction away just because we don't use the
      * return value.
      *
+     * SYSCALL itself overwrites RCX and R11, and argument registers
+     * are not preserved by the kernel, so all of them are outputs too.
      * The last clause tells the assembler that this can
      * potentially change the condition codes and arbitrary
      * memory locations. */
 
-    asm volatile("int %1\n"
-                 : "=a"(ret)
-                 : "i"(T_SYSCALL), "r"(_a0), "r"(_a1), "r"(_a2), "r"(_a3), "r"(_a4), "r"(_a5), "r"(_a6)
-                 : "cc", "memory");
+    asm volatile("syscall\n"
+                 : "+r"(_a0), "+r"(_a1), "+r"(_a2), "+r"(_a3), "+r"(_a4), "+r"(_a5), "+r"(_a6)
+                 :
+                 : "rcx", "r11", "cc", "memory");
+    ret = _a0;
 
     if (check && ret > 0) {
         panic("syscall %zd returned %zd (> 0)", num, ret);
@@ -134,9 +137,19 @@ sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int p
     return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
 }
 
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+}
+
 int
 sys_ipc_recv(void *dstva, size_t size) {
-    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, 0, 0, 0, 0);
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+}
+
+int
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
 #ifdef SANITIZE_USER_SHADOW_BASE
     if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
 #endif
@@ -147,3 +160,33 @@ int
 sys_gettime(void) {
     return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
 }
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+}
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+}
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+}
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+}
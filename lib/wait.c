@@ -7,8 +7,11 @@ wait(envid_t envid) {
 
     const volatile struct Env *env = &envs[ENVX(envid)];
 
-    while (env->env_id == envid &&
-           env->env_status != ENV_FREE) {
-        sys_yield();
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
     }
 }
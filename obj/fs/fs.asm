@@ -0,0 +1,18952 @@
+
+obj/fs/fs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 88 72 00 00       	call   8072ab <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ide_wait_ready>:
+}
+
+static inline uint8_t __attribute__((always_inline))
+inb(int port) {
+    uint8_t data;
+    asm volatile("inb %w1,%0"
+  800025:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80002a:	ec                   	in     (%dx),%al
+
+static int
+ide_wait_ready(bool check_error) {
+    int r;
+
+    while (((r = inb(0x1F7)) & (IDE_BSY | IDE_DRDY)) != IDE_DRDY) /* nothing */
+  80002b:	89 c1                	mov    %eax,%ecx
+  80002d:	83 e1 c0             	and    $0xffffffc0,%ecx
+  800030:	80 f9 40             	cmp    $0x40,%cl
+  800033:	75 f5                	jne    80002a <ide_wait_ready+0x5>
+        ;
+
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+    return 0;
+  800035:	ba 00 00 00 00       	mov    $0x0,%edx
+    if (check_error && (r & (IDE_DF | IDE_ERR)) != 0) return -1;
+  80003a:	40 84 ff             	test   %dil,%dil
+  80003d:	74 0a                	je     800049 <ide_wait_ready+0x24>
+  80003f:	a8 21                	test   $0x21,%al
+  800041:	0f 95 c2             	setne  %dl
+  800044:	0f b6 d2             	movzbl %dl,%edx
+  800047:	f7 da                	neg    %edx
+}
+  800049:	89 d0                	mov    %edx,%eax
+  80004b:	c3                   	ret
+
+000000000080004c <ide_start>:
+    sys_irq_ack(IRQ_IDE);
+}
+
+/* Select sectors [secno, secno + nsecs) and issue command cmd */
+static void
+ide_start(uint32_t secno, size_t nsecs, int cmd) {
+  80004c:	55                   	push   %rbp
+  80004d:	48 89 e5             	mov    %rsp,%rbp
+  800050:	41 55                	push   %r13
+  800052:	41 54                	push   %r12
+  800054:	53                   	push   %rbx
+  800055:	48 83 ec 08          	sub    $0x8,%rsp
+  800059:	89 fb                	mov    %edi,%ebx
+  80005b:	49 89 f5             	mov    %rsi,%r13
+  80005e:	41 89 d4             	mov    %edx,%r12d
+    ide_wait_ready(0);
+  800061:	bf 00 00 00 00       	mov    $0x0,%edi
+  800066:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80006d:	00 00 00 
+  800070:	ff d0                	call   *%rax
+                 : "memory", "cc");
+}
+
+static inline void __attribute__((always_inline))
+outb(int port, uint8_t data) {
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800072:	ba f2 01 00 00       	mov    $0x1f2,%edx
+  800077:	44 89 e8             	mov    %r13d,%eax
+  80007a:	ee                   	out    %al,(%dx)
+  80007b:	ba f3 01 00 00       	mov    $0x1f3,%edx
+  800080:	89 d8                	mov    %ebx,%eax
+  800082:	ee                   	out    %al,(%dx)
+
+    outb(0x1F2, nsecs);
+    outb(0x1F3, secno & 0xFF);
+    outb(0x1F4, (secno >> 8) & 0xFF);
+  800083:	89 d8                	mov    %ebx,%eax
+  800085:	c1 e8 08             	shr    $0x8,%eax
+  800088:	ba f4 01 00 00       	mov    $0x1f4,%edx
+  80008d:	ee                   	out    %al,(%dx)
+    outb(0x1F5, (secno >> 16) & 0xFF);
+  80008e:	89 d8                	mov    %ebx,%eax
+  800090:	c1 e8 10             	shr    $0x10,%eax
+  800093:	ba f5 01 00 00       	mov    $0x1f5,%edx
+  800098:	ee                   	out    %al,(%dx)
+    outb(0x1F6, 0xE0 | ((diskno & 1) << 4) | ((secno >> 24) & 0x0F));
+  800099:	a1 00 d0 80 00 00 00 	movabs 0x80d000,%eax
+  8000a0:	00 00 
+  8000a2:	c1 e0 04             	shl    $0x4,%eax
+  8000a5:	83 e0 10             	and    $0x10,%eax
+  8000a8:	c1 eb 18             	shr    $0x18,%ebx
+  8000ab:	83 e3 0f             	and    $0xf,%ebx
+  8000ae:	09 d8                	or     %ebx,%eax
+  8000b0:	83 c8 e0             	or     $0xffffffe0,%eax
+  8000b3:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  8000b8:	ee                   	out    %al,(%dx)
+  8000b9:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8000be:	44 89 e0             	mov    %r12d,%eax
+  8000c1:	ee                   	out    %al,(%dx)
+    outb(0x1F7, cmd);
+}
+  8000c2:	48 83 c4 08          	add    $0x8,%rsp
+  8000c6:	5b                   	pop    %rbx
+  8000c7:	41 5c                	pop    %r12
+  8000c9:	41 5d                	pop    %r13
+  8000cb:	5d                   	pop    %rbp
+  8000cc:	c3                   	ret
+
+00000000008000cd <ide_irq>:
+    return ide_dma_finish(wait);
+}
+
+int
+ide_irq(void) {
+    return bmide ? IRQ_IDE : -1;
+  8000cd:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  8000d4:	00 00 00 
+  8000d7:	83 38 01             	cmpl   $0x1,(%rax)
+  8000da:	19 c0                	sbb    %eax,%eax
+  8000dc:	83 c8 0e             	or     $0xe,%eax
+}
+  8000df:	c3                   	ret
+
+00000000008000e0 <ide_irq_ack>:
+    uint32_t n = vsys[VSYS_irq + IRQ_IDE];
+  8000e0:	a1 3c f0 bf 1f 80 00 	movabs 0x801fbff03c,%eax
+  8000e7:	00 00 
+    if (n == irq_seen) return;
+  8000e9:	48 ba 00 00 82 00 00 	movabs $0x820000,%rdx
+  8000f0:	00 00 00 
+  8000f3:	39 02                	cmp    %eax,(%rdx)
+  8000f5:	74 19                	je     800110 <ide_irq_ack+0x30>
+ide_irq_ack(void) {
+  8000f7:	55                   	push   %rbp
+  8000f8:	48 89 e5             	mov    %rsp,%rbp
+    irq_seen = n;
+  8000fb:	89 02                	mov    %eax,(%rdx)
+    sys_irq_ack(IRQ_IDE);
+  8000fd:	bf 0e 00 00 00       	mov    $0xe,%edi
+  800102:	48 b8 25 87 80 00 00 	movabs $0x808725,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+}
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+  800110:	c3                   	ret
+
+0000000000800111 <ide_dma_start>:
+ide_dma_start(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  800111:	55                   	push   %rbp
+  800112:	48 89 e5             	mov    %rsp,%rbp
+  800115:	41 57                	push   %r15
+  800117:	41 56                	push   %r14
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	48 83 ec 28          	sub    $0x28,%rsp
+  800122:	89 7d c8             	mov    %edi,-0x38(%rbp)
+  800125:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  800129:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+    uintptr_t va = (uintptr_t)buf, end = va + nsecs * SECTSIZE;
+  80012c:	48 c1 e2 09          	shl    $0x9,%rdx
+  800130:	49 89 d6             	mov    %rdx,%r14
+  800133:	49 01 f6             	add    %rsi,%r14
+    if (va & 3) return -E_NOT_SUPP;
+  800136:	49 89 f7             	mov    %rsi,%r15
+  800139:	41 83 e7 03          	and    $0x3,%r15d
+  80013d:	0f 85 14 01 00 00    	jne    800257 <ide_dma_start+0x146>
+  800143:	49 89 f4             	mov    %rsi,%r12
+    while (va < end) {
+  800146:	4c 39 f6             	cmp    %r14,%rsi
+  800149:	0f 83 87 00 00 00    	jae    8001d6 <ide_dma_start+0xc5>
+  80014f:	80 f9 01             	cmp    $0x1,%cl
+  800152:	19 c0                	sbb    %eax,%eax
+  800154:	83 e0 02             	and    $0x2,%eax
+  800157:	83 c0 04             	add    $0x4,%eax
+  80015a:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  80015d:	49 bd 00 10 82 00 00 	movabs $0x821000,%r13
+  800164:	00 00 00 
+        size_t len = MIN(end - va, PAGE_SIZE - PAGE_OFFSET(va));
+  800167:	4c 89 e0             	mov    %r12,%rax
+  80016a:	25 ff 0f 00 00       	and    $0xfff,%eax
+  80016f:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800174:	48 29 c3             	sub    %rax,%rbx
+  800177:	4c 89 f0             	mov    %r14,%rax
+  80017a:	4c 29 e0             	sub    %r12,%rax
+  80017d:	48 39 c3             	cmp    %rax,%rbx
+  800180:	48 0f 47 d8          	cmova  %rax,%rbx
+        int64_t pa = sys_region_pa((void *)va, write ? PROT_R : PROT_RW);
+  800184:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800187:	4c 89 e7             	mov    %r12,%rdi
+  80018a:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  800191:	00 00 00 
+  800194:	ff d0                	call   *%rax
+        if (pa < 0 || pa + len > 0x100000000LL) return -E_NOT_SUPP;
+  800196:	48 85 c0             	test   %rax,%rax
+  800199:	0f 88 bf 00 00 00    	js     80025e <ide_dma_start+0x14d>
+  80019f:	48 8d 14 18          	lea    (%rax,%rbx,1),%rdx
+  8001a3:	48 b9 00 00 00 00 01 	movabs $0x100000000,%rcx
+  8001aa:	00 00 00 
+  8001ad:	48 39 d1             	cmp    %rdx,%rcx
+  8001b0:	0f 82 af 00 00 00    	jb     800265 <ide_dma_start+0x154>
+        prdt[n].prd_addr = pa;
+  8001b6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        prdt[n].prd_size = len;
+  8001ba:	66 41 89 5d 04       	mov    %bx,0x4(%r13)
+        prdt[n].prd_flags = 0;
+  8001bf:	66 41 c7 45 06 00 00 	movw   $0x0,0x6(%r13)
+        va += len;
+  8001c6:	49 01 dc             	add    %rbx,%r12
+        n++;
+  8001c9:	49 83 c7 01          	add    $0x1,%r15
+    while (va < end) {
+  8001cd:	49 83 c5 08          	add    $0x8,%r13
+  8001d1:	4d 39 f4             	cmp    %r14,%r12
+  8001d4:	72 91                	jb     800167 <ide_dma_start+0x56>
+    prdt[n - 1].prd_flags = PRD_EOT;
+  8001d6:	48 b8 00 10 82 00 00 	movabs $0x821000,%rax
+  8001dd:	00 00 00 
+  8001e0:	66 42 c7 44 f8 fe 00 	movw   $0x8000,-0x2(%rax,%r15,8)
+  8001e7:	80 
+    ide_irq_ack();
+  8001e8:	48 b8 e0 00 80 00 00 	movabs $0x8000e0,%rax
+  8001ef:	00 00 00 
+  8001f2:	ff d0                	call   *%rax
+    outb(bmide + BM_CMD, 0);
+  8001f4:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  8001fb:	00 00 00 
+  8001fe:	8b 18                	mov    (%rax),%ebx
+  800200:	b8 00 00 00 00       	mov    $0x0,%eax
+  800205:	89 da                	mov    %ebx,%edx
+  800207:	ee                   	out    %al,(%dx)
+    outl(bmide + BM_PRDT, prdt_pa);
+  800208:	8d 53 04             	lea    0x4(%rbx),%edx
+                 : "cc");
+}
+
+static inline void __attribute__((always_inline))
+outl(int port, uint32_t data) {
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80020b:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800212:	00 00 
+  800214:	ef                   	out    %eax,(%dx)
+    outb(bmide + BM_STATUS, inb(bmide + BM_STATUS) | BM_STATUS_ERR | BM_STATUS_IRQ);
+  800215:	8d 53 02             	lea    0x2(%rbx),%edx
+    asm volatile("inb %w1,%0"
+  800218:	ec                   	in     (%dx),%al
+  800219:	83 c8 06             	or     $0x6,%eax
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80021c:	ee                   	out    %al,(%dx)
+    ide_start(secno, nsecs, write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+  80021d:	80 7d bc 00          	cmpb   $0x0,-0x44(%rbp)
+  800221:	75 49                	jne    80026c <ide_dma_start+0x15b>
+  800223:	ba c8 00 00 00       	mov    $0xc8,%edx
+  800228:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80022c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  80022f:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  800236:	00 00 00 
+  800239:	ff d0                	call   *%rax
+    outb(bmide + BM_CMD, BM_CMD_START | (write ? 0 : BM_CMD_READ));
+  80023b:	b8 09 00 00 00       	mov    $0x9,%eax
+  800240:	89 da                	mov    %ebx,%edx
+  800242:	ee                   	out    %al,(%dx)
+    return 0;
+  800243:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800248:	48 83 c4 28          	add    $0x28,%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+    if (va & 3) return -E_NOT_SUPP;
+  800257:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80025c:	eb ea                	jmp    800248 <ide_dma_start+0x137>
+        if (pa < 0 || pa + len > 0x100000000LL) return -E_NOT_SUPP;
+  80025e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800263:	eb e3                	jmp    800248 <ide_dma_start+0x137>
+  800265:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80026a:	eb dc                	jmp    800248 <ide_dma_start+0x137>
+    ide_start(secno, nsecs, write ? IDE_CMD_WRITE_DMA : IDE_CMD_READ_DMA);
+  80026c:	ba ca 00 00 00       	mov    $0xca,%edx
+  800271:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  800275:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800278:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  80027f:	00 00 00 
+  800282:	ff d0                	call   *%rax
+    outb(bmide + BM_CMD, BM_CMD_START | (write ? 0 : BM_CMD_READ));
+  800284:	b8 01 00 00 00       	mov    $0x1,%eax
+  800289:	eb b5                	jmp    800240 <ide_dma_start+0x12f>
+
+000000000080028b <ide_read_start>:
+ide_read_start(uint32_t secno, void *dst, size_t nsecs) {
+  80028b:	55                   	push   %rbp
+  80028c:	48 89 e5             	mov    %rsp,%rbp
+    assert(nsecs <= 256);
+  80028f:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  800296:	77 22                	ja     8002ba <ide_read_start+0x2f>
+    if (!bmide) return -E_NOT_SUPP;
+  800298:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  80029f:	00 00 00 
+  8002a2:	83 38 00             	cmpl   $0x0,(%rax)
+  8002a5:	74 48                	je     8002ef <ide_read_start+0x64>
+    return ide_dma_start(secno, dst, nsecs, 0);
+  8002a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8002ac:	48 b8 11 01 80 00 00 	movabs $0x800111,%rax
+  8002b3:	00 00 00 
+  8002b6:	ff d0                	call   *%rax
+}
+  8002b8:	5d                   	pop    %rbp
+  8002b9:	c3                   	ret
+    assert(nsecs <= 256);
+  8002ba:	48 b9 00 bc 80 00 00 	movabs $0x80bc00,%rcx
+  8002c1:	00 00 00 
+  8002c4:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8002cb:	00 00 00 
+  8002ce:	be de 00 00 00       	mov    $0xde,%esi
+  8002d3:	48 bf 22 bc 80 00 00 	movabs $0x80bc22,%rdi
+  8002da:	00 00 00 
+  8002dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e2:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8002e9:	00 00 00 
+  8002ec:	41 ff d0             	call   *%r8
+    if (!bmide) return -E_NOT_SUPP;
+  8002ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8002f4:	eb c2                	jmp    8002b8 <ide_read_start+0x2d>
+
+00000000008002f6 <ide_match>:
+    return (f->pf_class >> 8) == 0x0101 && (f->pf_class & 0x80) &&
+  8002f6:	8b 57 08             	mov    0x8(%rdi),%edx
+  8002f9:	89 d1                	mov    %edx,%ecx
+  8002fb:	c1 e9 08             	shr    $0x8,%ecx
+  8002fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800303:	81 f9 01 01 00 00    	cmp    $0x101,%ecx
+  800309:	74 04                	je     80030f <ide_match+0x19>
+  80030b:	83 e0 01             	and    $0x1,%eax
+}
+  80030e:	c3                   	ret
+    return (f->pf_class >> 8) == 0x0101 && (f->pf_class & 0x80) &&
+  80030f:	f6 c2 80             	test   $0x80,%dl
+  800312:	74 f7                	je     80030b <ide_match+0x15>
+ide_match(struct PciFunc *f) {
+  800314:	55                   	push   %rbp
+  800315:	48 89 e5             	mov    %rsp,%rbp
+           (pci_conf_read(f, PCI_BAR4) & 1);
+  800318:	be 20 00 00 00       	mov    $0x20,%esi
+  80031d:	48 b8 bd 07 80 00 00 	movabs $0x8007bd,%rax
+  800324:	00 00 00 
+  800327:	ff d0                	call   *%rax
+    return (f->pf_class >> 8) == 0x0101 && (f->pf_class & 0x80) &&
+  800329:	83 e0 01             	and    $0x1,%eax
+  80032c:	83 e0 01             	and    $0x1,%eax
+}
+  80032f:	5d                   	pop    %rbp
+  800330:	c3                   	ret
+
+0000000000800331 <ide_dma_finish>:
+ide_dma_finish(bool wait) {
+  800331:	55                   	push   %rbp
+  800332:	48 89 e5             	mov    %rsp,%rbp
+  800335:	41 57                	push   %r15
+  800337:	41 56                	push   %r14
+  800339:	41 55                	push   %r13
+  80033b:	41 54                	push   %r12
+  80033d:	53                   	push   %rbx
+  80033e:	48 83 ec 08          	sub    $0x8,%rsp
+        uint32_t seen = vsys[VSYS_irq + IRQ_IDE];
+  800342:	48 b8 3c f0 bf 1f 80 	movabs $0x801fbff03c,%rax
+  800349:	00 00 00 
+  80034c:	8b 30                	mov    (%rax),%esi
+        status = inb(bmide + BM_STATUS);
+  80034e:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  800355:	00 00 00 
+  800358:	44 8b 00             	mov    (%rax),%r8d
+  80035b:	41 8d 48 02          	lea    0x2(%r8),%ecx
+    asm volatile("inb %w1,%0"
+  80035f:	89 ca                	mov    %ecx,%edx
+  800361:	ec                   	in     (%dx),%al
+  800362:	89 c3                	mov    %eax,%ebx
+        if (status & (BM_STATUS_IRQ | BM_STATUS_ERR)) break;
+  800364:	a8 06                	test   $0x6,%al
+  800366:	75 4b                	jne    8003b3 <ide_dma_finish+0x82>
+        if (!wait) return -E_AGAIN;
+  800368:	40 84 ff             	test   %dil,%dil
+  80036b:	0f 84 85 00 00 00    	je     8003f6 <ide_dma_finish+0xc5>
+        sys_futex_wait((const volatile uint32_t *)&vsys[VSYS_irq + IRQ_IDE], seen, IDE_IRQ_TIMEOUT);
+  800371:	49 bf 3c f0 bf 1f 80 	movabs $0x801fbff03c,%r15
+  800378:	00 00 00 
+  80037b:	49 be c3 86 80 00 00 	movabs $0x8086c3,%r14
+  800382:	00 00 00 
+        uint32_t seen = vsys[VSYS_irq + IRQ_IDE];
+  800385:	4d 8d 6f c4          	lea    -0x3c(%r15),%r13
+        status = inb(bmide + BM_STATUS);
+  800389:	49 bc 04 00 82 00 00 	movabs $0x820004,%r12
+  800390:	00 00 00 
+        sys_futex_wait((const volatile uint32_t *)&vsys[VSYS_irq + IRQ_IDE], seen, IDE_IRQ_TIMEOUT);
+  800393:	ba 64 00 00 00       	mov    $0x64,%edx
+  800398:	4c 89 ff             	mov    %r15,%rdi
+  80039b:	41 ff d6             	call   *%r14
+        uint32_t seen = vsys[VSYS_irq + IRQ_IDE];
+  80039e:	41 8b 75 3c          	mov    0x3c(%r13),%esi
+        status = inb(bmide + BM_STATUS);
+  8003a2:	45 8b 04 24          	mov    (%r12),%r8d
+  8003a6:	41 8d 48 02          	lea    0x2(%r8),%ecx
+  8003aa:	89 ca                	mov    %ecx,%edx
+  8003ac:	ec                   	in     (%dx),%al
+  8003ad:	89 c3                	mov    %eax,%ebx
+        if (status & (BM_STATUS_IRQ | BM_STATUS_ERR)) break;
+  8003af:	a8 06                	test   $0x6,%al
+  8003b1:	74 e0                	je     800393 <ide_dma_finish+0x62>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  8003b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b8:	44 89 c2             	mov    %r8d,%edx
+  8003bb:	ee                   	out    %al,(%dx)
+  8003bc:	89 d8                	mov    %ebx,%eax
+  8003be:	89 ca                	mov    %ecx,%edx
+  8003c0:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1,%0"
+  8003c1:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  8003c6:	ec                   	in     (%dx),%al
+  8003c7:	41 89 c4             	mov    %eax,%r12d
+    ide_irq_ack();
+  8003ca:	48 b8 e0 00 80 00 00 	movabs $0x8000e0,%rax
+  8003d1:	00 00 00 
+  8003d4:	ff d0                	call   *%rax
+    if ((status & BM_STATUS_ERR) || (r & (IDE_DF | IDE_ERR))) return -1;
+  8003d6:	f6 c3 02             	test   $0x2,%bl
+  8003d9:	75 22                	jne    8003fd <ide_dma_finish+0xcc>
+  8003db:	41 f6 c4 21          	test   $0x21,%r12b
+  8003df:	0f 95 c0             	setne  %al
+  8003e2:	0f b6 c0             	movzbl %al,%eax
+  8003e5:	f7 d8                	neg    %eax
+}
+  8003e7:	48 83 c4 08          	add    $0x8,%rsp
+  8003eb:	5b                   	pop    %rbx
+  8003ec:	41 5c                	pop    %r12
+  8003ee:	41 5d                	pop    %r13
+  8003f0:	41 5e                	pop    %r14
+  8003f2:	41 5f                	pop    %r15
+  8003f4:	5d                   	pop    %rbp
+  8003f5:	c3                   	ret
+        if (!wait) return -E_AGAIN;
+  8003f6:	b8 ec ff ff ff       	mov    $0xffffffec,%eax
+  8003fb:	eb ea                	jmp    8003e7 <ide_dma_finish+0xb6>
+    if ((status & BM_STATUS_ERR) || (r & (IDE_DF | IDE_ERR))) return -1;
+  8003fd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  800402:	eb e3                	jmp    8003e7 <ide_dma_finish+0xb6>
+
+0000000000800404 <ide_finish>:
+ide_finish(bool wait) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+    return ide_dma_finish(wait);
+  800408:	40 0f b6 ff          	movzbl %dil,%edi
+  80040c:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  800413:	00 00 00 
+  800416:	ff d0                	call   *%rax
+}
+  800418:	5d                   	pop    %rbp
+  800419:	c3                   	ret
+
+000000000080041a <ide_read>:
+
+int
+ide_read(uint32_t secno, void *dst, size_t nsecs) {
+  80041a:	55                   	push   %rbp
+  80041b:	48 89 e5             	mov    %rsp,%rbp
+  80041e:	41 55                	push   %r13
+  800420:	41 54                	push   %r12
+  800422:	53                   	push   %rbx
+  800423:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800427:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  80042e:	0f 87 9f 00 00 00    	ja     8004d3 <ide_read+0xb9>
+  800434:	41 89 fd             	mov    %edi,%r13d
+  800437:	48 89 f3             	mov    %rsi,%rbx
+  80043a:	49 89 d4             	mov    %rdx,%r12
+
+    if (bmide && (r = ide_dma(secno, dst, nsecs, 0)) != -E_NOT_SUPP) return r;
+  80043d:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  800444:	00 00 00 
+  800447:	83 38 00             	cmpl   $0x0,(%rax)
+  80044a:	74 1e                	je     80046a <ide_read+0x50>
+    int r = ide_dma_start(secno, buf, nsecs, write);
+  80044c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800451:	48 b8 11 01 80 00 00 	movabs $0x800111,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+    return r < 0 ? r : ide_dma_finish(1);
+  80045d:	85 c0                	test   %eax,%eax
+  80045f:	0f 89 a3 00 00 00    	jns    800508 <ide_read+0xee>
+    if (bmide && (r = ide_dma(secno, dst, nsecs, 0)) != -E_NOT_SUPP) return r;
+  800465:	83 f8 ed             	cmp    $0xffffffed,%eax
+  800468:	75 5e                	jne    8004c8 <ide_read+0xae>
+
+    ide_start(secno, nsecs, IDE_CMD_READ);
+  80046a:	ba 20 00 00 00       	mov    $0x20,%edx
+  80046f:	4c 89 e6             	mov    %r12,%rsi
+  800472:	44 89 ef             	mov    %r13d,%edi
+  800475:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  80047c:	00 00 00 
+  80047f:	ff d0                	call   *%rax
+
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  800481:	4d 85 e4             	test   %r12,%r12
+  800484:	0f 84 94 00 00 00    	je     80051e <ide_read+0x104>
+  80048a:	49 c1 e4 09          	shl    $0x9,%r12
+  80048e:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  800491:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  800498:	00 00 00 
+  80049b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8004a0:	41 ff d5             	call   *%r13
+  8004a3:	85 c0                	test   %eax,%eax
+  8004a5:	78 21                	js     8004c8 <ide_read+0xae>
+    asm volatile("cld\n\trepne\n\tinsl"
+  8004a7:	48 89 df             	mov    %rbx,%rdi
+  8004aa:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8004af:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8004b4:	fc                   	cld
+  8004b5:	f2 6d                	repnz insl (%dx),%es:(%rdi)
+    for (; nsecs > 0; nsecs--, dst += SECTSIZE) {
+  8004b7:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8004be:	49 39 dc             	cmp    %rbx,%r12
+  8004c1:	75 d8                	jne    80049b <ide_read+0x81>
+        insl(0x1F0, dst, SECTSIZE / 4);
+    }
+
+    return 0;
+  8004c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8004c8:	48 83 c4 08          	add    $0x8,%rsp
+  8004cc:	5b                   	pop    %rbx
+  8004cd:	41 5c                	pop    %r12
+  8004cf:	41 5d                	pop    %r13
+  8004d1:	5d                   	pop    %rbp
+  8004d2:	c3                   	ret
+    assert(nsecs <= 256);
+  8004d3:	48 b9 00 bc 80 00 00 	movabs $0x80bc00,%rcx
+  8004da:	00 00 00 
+  8004dd:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8004e4:	00 00 00 
+  8004e7:	be f2 00 00 00       	mov    $0xf2,%esi
+  8004ec:	48 bf 22 bc 80 00 00 	movabs $0x80bc22,%rdi
+  8004f3:	00 00 00 
+  8004f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fb:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  800502:	00 00 00 
+  800505:	41 ff d0             	call   *%r8
+    return r < 0 ? r : ide_dma_finish(1);
+  800508:	bf 01 00 00 00       	mov    $0x1,%edi
+  80050d:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  800514:	00 00 00 
+  800517:	ff d0                	call   *%rax
+  800519:	e9 47 ff ff ff       	jmp    800465 <ide_read+0x4b>
+    return 0;
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	eb a3                	jmp    8004c8 <ide_read+0xae>
+
+0000000000800525 <ide_write>:
+
+int
+ide_write(uint32_t secno, const void *src, size_t nsecs) {
+  800525:	55                   	push   %rbp
+  800526:	48 89 e5             	mov    %rsp,%rbp
+  800529:	41 55                	push   %r13
+  80052b:	41 54                	push   %r12
+  80052d:	53                   	push   %rbx
+  80052e:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+
+    assert(nsecs <= 256);
+  800532:	48 81 fa 00 01 00 00 	cmp    $0x100,%rdx
+  800539:	0f 87 9f 00 00 00    	ja     8005de <ide_write+0xb9>
+  80053f:	41 89 fd             	mov    %edi,%r13d
+  800542:	48 89 f3             	mov    %rsi,%rbx
+  800545:	49 89 d4             	mov    %rdx,%r12
+
+    if (bmide && (r = ide_dma(secno, (void *)src, nsecs, 1)) != -E_NOT_SUPP) return r;
+  800548:	48 b8 04 00 82 00 00 	movabs $0x820004,%rax
+  80054f:	00 00 00 
+  800552:	83 38 00             	cmpl   $0x0,(%rax)
+  800555:	74 1e                	je     800575 <ide_write+0x50>
+    int r = ide_dma_start(secno, buf, nsecs, write);
+  800557:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80055c:	48 b8 11 01 80 00 00 	movabs $0x800111,%rax
+  800563:	00 00 00 
+  800566:	ff d0                	call   *%rax
+    return r < 0 ? r : ide_dma_finish(1);
+  800568:	85 c0                	test   %eax,%eax
+  80056a:	0f 89 a3 00 00 00    	jns    800613 <ide_write+0xee>
+    if (bmide && (r = ide_dma(secno, (void *)src, nsecs, 1)) != -E_NOT_SUPP) return r;
+  800570:	83 f8 ed             	cmp    $0xffffffed,%eax
+  800573:	75 5e                	jne    8005d3 <ide_write+0xae>
+
+    ide_start(secno, nsecs, IDE_CMD_WRITE);
+  800575:	ba 30 00 00 00       	mov    $0x30,%edx
+  80057a:	4c 89 e6             	mov    %r12,%rsi
+  80057d:	44 89 ef             	mov    %r13d,%edi
+  800580:	48 b8 4c 00 80 00 00 	movabs $0x80004c,%rax
+  800587:	00 00 00 
+  80058a:	ff d0                	call   *%rax
+
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  80058c:	4d 85 e4             	test   %r12,%r12
+  80058f:	0f 84 94 00 00 00    	je     800629 <ide_write+0x104>
+  800595:	49 c1 e4 09          	shl    $0x9,%r12
+  800599:	49 01 dc             	add    %rbx,%r12
+        if ((r = ide_wait_ready(1)) < 0) return r;
+  80059c:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  8005a3:	00 00 00 
+  8005a6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8005ab:	41 ff d5             	call   *%r13
+  8005ae:	85 c0                	test   %eax,%eax
+  8005b0:	78 21                	js     8005d3 <ide_write+0xae>
+    asm volatile("cld\n\trepne\n\toutsl"
+  8005b2:	48 89 de             	mov    %rbx,%rsi
+  8005b5:	b9 80 00 00 00       	mov    $0x80,%ecx
+  8005ba:	ba f0 01 00 00       	mov    $0x1f0,%edx
+  8005bf:	fc                   	cld
+  8005c0:	f2 6f                	repnz outsl %ds:(%rsi),(%dx)
+    for (; nsecs > 0; nsecs--, src += SECTSIZE) {
+  8005c2:	48 81 c3 00 02 00 00 	add    $0x200,%rbx
+  8005c9:	49 39 dc             	cmp    %rbx,%r12
+  8005cc:	75 d8                	jne    8005a6 <ide_write+0x81>
+        outsl(0x1F0, src, SECTSIZE / 4);
+    }
+
+    return 0;
+  8005ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8005d3:	48 83 c4 08          	add    $0x8,%rsp
+  8005d7:	5b                   	pop    %rbx
+  8005d8:	41 5c                	pop    %r12
+  8005da:	41 5d                	pop    %r13
+  8005dc:	5d                   	pop    %rbp
+  8005dd:	c3                   	ret
+    assert(nsecs <= 256);
+  8005de:	48 b9 00 bc 80 00 00 	movabs $0x80bc00,%rcx
+  8005e5:	00 00 00 
+  8005e8:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8005ef:	00 00 00 
+  8005f2:	be 04 01 00 00       	mov    $0x104,%esi
+  8005f7:	48 bf 22 bc 80 00 00 	movabs $0x80bc22,%rdi
+  8005fe:	00 00 00 
+  800601:	b8 00 00 00 00       	mov    $0x0,%eax
+  800606:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80060d:	00 00 00 
+  800610:	41 ff d0             	call   *%r8
+    return r < 0 ? r : ide_dma_finish(1);
+  800613:	bf 01 00 00 00       	mov    $0x1,%edi
+  800618:	48 b8 31 03 80 00 00 	movabs $0x800331,%rax
+  80061f:	00 00 00 
+  800622:	ff d0                	call   *%rax
+  800624:	e9 47 ff ff ff       	jmp    800570 <ide_write+0x4b>
+    return 0;
+  800629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062e:	eb a3                	jmp    8005d3 <ide_write+0xae>
+
+0000000000800630 <ide_probe_disk1>:
+ide_probe_disk1(void) {
+  800630:	55                   	push   %rbp
+  800631:	48 89 e5             	mov    %rsp,%rbp
+  800634:	53                   	push   %rbx
+  800635:	48 83 ec 08          	sub    $0x8,%rsp
+    ide_wait_ready(0);
+  800639:	bf 00 00 00 00       	mov    $0x0,%edi
+  80063e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800645:	00 00 00 
+  800648:	ff d0                	call   *%rax
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80064a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80064f:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  800654:	ee                   	out    %al,(%dx)
+    asm volatile("inb %w1,%0"
+  800655:	ba f7 01 00 00       	mov    $0x1f7,%edx
+  80065a:	ec                   	in     (%dx),%al
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  80065b:	a8 a1                	test   $0xa1,%al
+  80065d:	74 54                	je     8006b3 <ide_probe_disk1+0x83>
+  80065f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800664:	83 c1 01             	add    $0x1,%ecx
+  800667:	81 f9 e8 03 00 00    	cmp    $0x3e8,%ecx
+  80066d:	74 05                	je     800674 <ide_probe_disk1+0x44>
+  80066f:	ec                   	in     (%dx),%al
+  800670:	a8 a1                	test   $0xa1,%al
+  800672:	75 f0                	jne    800664 <ide_probe_disk1+0x34>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800674:	b8 e0 ff ff ff       	mov    $0xffffffe0,%eax
+  800679:	ba f6 01 00 00       	mov    $0x1f6,%edx
+  80067e:	ee                   	out    %al,(%dx)
+    cprintf("Device 1 presence: %d\n", (x < 1000));
+  80067f:	81 f9 e7 03 00 00    	cmp    $0x3e7,%ecx
+  800685:	0f 9e c3             	setle  %bl
+  800688:	40 0f 9e c6          	setle  %sil
+  80068c:	40 0f b6 f6          	movzbl %sil,%esi
+  800690:	48 bf 2b bc 80 00 00 	movabs $0x80bc2b,%rdi
+  800697:	00 00 00 
+  80069a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069f:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  8006a6:	00 00 00 
+  8006a9:	ff d2                	call   *%rdx
+}
+  8006ab:	89 d8                	mov    %ebx,%eax
+  8006ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8006b1:	c9                   	leave
+  8006b2:	c3                   	ret
+    for (x = 0; x < 1000 && (inb(0x1F7) & (IDE_BSY | IDE_DF | IDE_ERR)) != 0; x++) /* nothing */
+  8006b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8006b8:	eb ba                	jmp    800674 <ide_probe_disk1+0x44>
+
+00000000008006ba <ide_set_disk>:
+    if (d != 0 && d != 1)
+  8006ba:	83 ff 01             	cmp    $0x1,%edi
+  8006bd:	77 0c                	ja     8006cb <ide_set_disk+0x11>
+    diskno = d;
+  8006bf:	89 f8                	mov    %edi,%eax
+  8006c1:	a3 00 d0 80 00 00 00 	movabs %eax,0x80d000
+  8006c8:	00 00 
+  8006ca:	c3                   	ret
+ide_set_disk(int d) {
+  8006cb:	55                   	push   %rbp
+  8006cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("bad disk number");
+  8006cf:	48 ba 42 bc 80 00 00 	movabs $0x80bc42,%rdx
+  8006d6:	00 00 00 
+  8006d9:	be 63 00 00 00       	mov    $0x63,%esi
+  8006de:	48 bf 22 bc 80 00 00 	movabs $0x80bc22,%rdi
+  8006e5:	00 00 00 
+  8006e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ed:	48 b9 81 73 80 00 00 	movabs $0x807381,%rcx
+  8006f4:	00 00 00 
+  8006f7:	ff d1                	call   *%rcx
+
+00000000008006f9 <ide_dma_init>:
+ide_dma_init(void) {
+  8006f9:	55                   	push   %rbp
+  8006fa:	48 89 e5             	mov    %rsp,%rbp
+  8006fd:	41 54                	push   %r12
+  8006ff:	53                   	push   %rbx
+  800700:	48 83 ec 10          	sub    $0x10,%rsp
+    if (!pci_find(&f, ide_match)) return 0;
+  800704:	48 be f6 02 80 00 00 	movabs $0x8002f6,%rsi
+  80070b:	00 00 00 
+  80070e:	48 8d 7d e4          	lea    -0x1c(%rbp),%rdi
+  800712:	48 b8 19 08 80 00 00 	movabs $0x800819,%rax
+  800719:	00 00 00 
+  80071c:	ff d0                	call   *%rax
+  80071e:	89 c3                	mov    %eax,%ebx
+  800720:	84 c0                	test   %al,%al
+  800722:	75 0b                	jne    80072f <ide_dma_init+0x36>
+}
+  800724:	89 d8                	mov    %ebx,%eax
+  800726:	48 83 c4 10          	add    $0x10,%rsp
+  80072a:	5b                   	pop    %rbx
+  80072b:	41 5c                	pop    %r12
+  80072d:	5d                   	pop    %rbp
+  80072e:	c3                   	ret
+    int64_t pa = sys_region_pa(prdt, PROT_RW);
+  80072f:	be 06 00 00 00       	mov    $0x6,%esi
+  800734:	48 bf 00 10 82 00 00 	movabs $0x821000,%rdi
+  80073b:	00 00 00 
+  80073e:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  800745:	00 00 00 
+  800748:	ff d0                	call   *%rax
+  80074a:	49 89 c4             	mov    %rax,%r12
+    if (pa < 0 || pa >= 0x100000000LL) return 0;
+  80074d:	48 c1 e8 20          	shr    $0x20,%rax
+  800751:	74 07                	je     80075a <ide_dma_init+0x61>
+  800753:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800758:	eb ca                	jmp    800724 <ide_dma_init+0x2b>
+    if (sys_irq_ack(IRQ_IDE) < 0) return 0;
+  80075a:	bf 0e 00 00 00       	mov    $0xe,%edi
+  80075f:	48 b8 25 87 80 00 00 	movabs $0x808725,%rax
+  800766:	00 00 00 
+  800769:	ff d0                	call   *%rax
+  80076b:	85 c0                	test   %eax,%eax
+  80076d:	78 44                	js     8007b3 <ide_dma_init+0xba>
+    pci_enable(&f);
+  80076f:	48 8d 7d e4          	lea    -0x1c(%rbp),%rdi
+  800773:	48 b8 c1 08 80 00 00 	movabs $0x8008c1,%rax
+  80077a:	00 00 00 
+  80077d:	ff d0                	call   *%rax
+    prdt_pa = pa;
+  80077f:	44 89 e0             	mov    %r12d,%eax
+  800782:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800789:	00 00 
+    bmide = pci_conf_read(&f, PCI_BAR4) & 0xFFFC;
+  80078b:	be 20 00 00 00       	mov    $0x20,%esi
+  800790:	48 8d 7d e4          	lea    -0x1c(%rbp),%rdi
+  800794:	48 b8 bd 07 80 00 00 	movabs $0x8007bd,%rax
+  80079b:	00 00 00 
+  80079e:	ff d0                	call   *%rax
+  8007a0:	25 fc ff 00 00       	and    $0xfffc,%eax
+  8007a5:	a3 04 00 82 00 00 00 	movabs %eax,0x820004
+  8007ac:	00 00 
+    return 1;
+  8007ae:	e9 71 ff ff ff       	jmp    800724 <ide_dma_init+0x2b>
+    if (sys_irq_ack(IRQ_IDE) < 0) return 0;
+  8007b3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8007b8:	e9 67 ff ff ff       	jmp    800724 <ide_dma_init+0x2b>
+
+00000000008007bd <pci_conf_read>:
+#define PCI_CONF_ADDR 0xCF8
+#define PCI_CONF_DATA 0xCFC
+
+uint32_t
+pci_conf_read(struct PciFunc *f, int off) {
+    outl(PCI_CONF_ADDR, 0x80000000 | f->pf_bus << 16 | f->pf_dev << 11 | f->pf_func << 8 | off);
+  8007bd:	0f b6 07             	movzbl (%rdi),%eax
+  8007c0:	c1 e0 10             	shl    $0x10,%eax
+  8007c3:	0f b6 57 02          	movzbl 0x2(%rdi),%edx
+  8007c7:	c1 e2 08             	shl    $0x8,%edx
+  8007ca:	09 d0                	or     %edx,%eax
+  8007cc:	09 f0                	or     %esi,%eax
+  8007ce:	0f b6 57 01          	movzbl 0x1(%rdi),%edx
+  8007d2:	c1 e2 0b             	shl    $0xb,%edx
+  8007d5:	09 d0                	or     %edx,%eax
+  8007d7:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  8007dc:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  8007e1:	ef                   	out    %eax,(%dx)
+    asm volatile("inl %w1,%0"
+  8007e2:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  8007e7:	ed                   	in     (%dx),%eax
+    return inl(PCI_CONF_DATA);
+}
+  8007e8:	c3                   	ret
+
+00000000008007e9 <pci_conf_write>:
+
+void
+pci_conf_write(struct PciFunc *f, int off, uint32_t val) {
+  8007e9:	89 d1                	mov    %edx,%ecx
+    outl(PCI_CONF_ADDR, 0x80000000 | f->pf_bus << 16 | f->pf_dev << 11 | f->pf_func << 8 | off);
+  8007eb:	0f b6 07             	movzbl (%rdi),%eax
+  8007ee:	c1 e0 10             	shl    $0x10,%eax
+  8007f1:	0f b6 57 02          	movzbl 0x2(%rdi),%edx
+  8007f5:	c1 e2 08             	shl    $0x8,%edx
+  8007f8:	09 d0                	or     %edx,%eax
+  8007fa:	09 f0                	or     %esi,%eax
+  8007fc:	0f b6 57 01          	movzbl 0x1(%rdi),%edx
+  800800:	c1 e2 0b             	shl    $0xb,%edx
+  800803:	09 d0                	or     %edx,%eax
+  800805:	0d 00 00 00 80       	or     $0x80000000,%eax
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  80080a:	ba f8 0c 00 00       	mov    $0xcf8,%edx
+  80080f:	ef                   	out    %eax,(%dx)
+  800810:	ba fc 0c 00 00       	mov    $0xcfc,%edx
+  800815:	89 c8                	mov    %ecx,%eax
+  800817:	ef                   	out    %eax,(%dx)
+    outl(PCI_CONF_DATA, val);
+}
+  800818:	c3                   	ret
+
+0000000000800819 <pci_find>:
+
+/* Find the first function match() accepts and fill in *f.
+ * Returns false if there is none */
+bool
+pci_find(struct PciFunc *f, bool (*match)(struct PciFunc *f)) {
+  800819:	55                   	push   %rbp
+  80081a:	48 89 e5             	mov    %rsp,%rbp
+  80081d:	41 57                	push   %r15
+  80081f:	41 56                	push   %r14
+  800821:	41 55                	push   %r13
+  800823:	41 54                	push   %r12
+  800825:	53                   	push   %rbx
+  800826:	48 83 ec 08          	sub    $0x8,%rsp
+  80082a:	48 89 fb             	mov    %rdi,%rbx
+  80082d:	49 89 f7             	mov    %rsi,%r15
+    for (int dev = 0; dev < 32; dev++) {
+  800830:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        for (int func = 0; func < 8; func++) {
+            *f = (struct PciFunc){.pf_bus = 0, .pf_dev = dev, .pf_func = func};
+
+            uint32_t id = pci_conf_read(f, PCI_ID);
+  800836:	49 bd bd 07 80 00 00 	movabs $0x8007bd,%r13
+  80083d:	00 00 00 
+  800840:	eb 70                	jmp    8008b2 <pci_find+0x99>
+        for (int func = 0; func < 8; func++) {
+  800842:	41 83 c4 01          	add    $0x1,%r12d
+  800846:	41 83 fc 08          	cmp    $0x8,%r12d
+  80084a:	74 5c                	je     8008a8 <pci_find+0x8f>
+            *f = (struct PciFunc){.pf_bus = 0, .pf_dev = dev, .pf_func = func};
+  80084c:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  800853:	c7 43 08 00 00 00 00 	movl   $0x0,0x8(%rbx)
+  80085a:	44 88 73 01          	mov    %r14b,0x1(%rbx)
+  80085e:	44 88 63 02          	mov    %r12b,0x2(%rbx)
+            uint32_t id = pci_conf_read(f, PCI_ID);
+  800862:	be 00 00 00 00       	mov    $0x0,%esi
+  800867:	48 89 df             	mov    %rbx,%rdi
+  80086a:	41 ff d5             	call   *%r13
+            if ((id & 0xFFFF) == 0xFFFF) continue;
+  80086d:	66 83 f8 ff          	cmp    $0xffff,%ax
+  800871:	74 cf                	je     800842 <pci_find+0x29>
+
+            f->pf_vendor = id & 0xFFFF;
+  800873:	66 89 43 04          	mov    %ax,0x4(%rbx)
+            f->pf_device = id >> 16;
+  800877:	c1 e8 10             	shr    $0x10,%eax
+  80087a:	66 89 43 06          	mov    %ax,0x6(%rbx)
+            f->pf_class = pci_conf_read(f, PCI_CLASS) >> 8;
+  80087e:	be 08 00 00 00       	mov    $0x8,%esi
+  800883:	48 89 df             	mov    %rbx,%rdi
+  800886:	41 ff d5             	call   *%r13
+  800889:	c1 e8 08             	shr    $0x8,%eax
+  80088c:	89 43 08             	mov    %eax,0x8(%rbx)
+            if (match(f)) return 1;
+  80088f:	48 89 df             	mov    %rbx,%rdi
+  800892:	41 ff d7             	call   *%r15
+  800895:	84 c0                	test   %al,%al
+  800897:	74 a9                	je     800842 <pci_find+0x29>
+        }
+    }
+
+    return 0;
+}
+  800899:	48 83 c4 08          	add    $0x8,%rsp
+  80089d:	5b                   	pop    %rbx
+  80089e:	41 5c                	pop    %r12
+  8008a0:	41 5d                	pop    %r13
+  8008a2:	41 5e                	pop    %r14
+  8008a4:	41 5f                	pop    %r15
+  8008a6:	5d                   	pop    %rbp
+  8008a7:	c3                   	ret
+    for (int dev = 0; dev < 32; dev++) {
+  8008a8:	41 83 c6 01          	add    $0x1,%r14d
+  8008ac:	41 83 fe 20          	cmp    $0x20,%r14d
+  8008b0:	74 08                	je     8008ba <pci_find+0xa1>
+        for (int func = 0; func < 8; func++) {
+  8008b2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8008b8:	eb 92                	jmp    80084c <pci_find+0x33>
+    return 0;
+  8008ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008bf:	eb d8                	jmp    800899 <pci_find+0x80>
+
+00000000008008c1 <pci_enable>:
+
+/* Enable I/O space decoding and bus mastering */
+void
+pci_enable(struct PciFunc *f) {
+  8008c1:	55                   	push   %rbp
+  8008c2:	48 89 e5             	mov    %rsp,%rbp
+  8008c5:	53                   	push   %rbx
+  8008c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8008ca:	48 89 fb             	mov    %rdi,%rbx
+    uint32_t cmd = pci_conf_read(f, PCI_COMMAND);
+  8008cd:	be 04 00 00 00       	mov    $0x4,%esi
+  8008d2:	48 b8 bd 07 80 00 00 	movabs $0x8007bd,%rax
+  8008d9:	00 00 00 
+  8008dc:	ff d0                	call   *%rax
+    pci_conf_write(f, PCI_COMMAND, (cmd & 0xFFFF) | PCI_CMD_IO | PCI_CMD_MASTER);
+  8008de:	0f b7 d0             	movzwl %ax,%edx
+  8008e1:	83 ca 05             	or     $0x5,%edx
+  8008e4:	be 04 00 00 00       	mov    $0x4,%esi
+  8008e9:	48 89 df             	mov    %rbx,%rdi
+  8008ec:	48 b8 e9 07 80 00 00 	movabs $0x8007e9,%rax
+  8008f3:	00 00 00 
+  8008f6:	ff d0                	call   *%rax
+}
+  8008f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008fc:	c9                   	leave
+  8008fd:	c3                   	ret
+
+00000000008008fe <virtio_irq>:
+}
+
+int
+virtio_irq(void) {
+    return vblk.irq;
+}
+  8008fe:	a1 04 20 82 00 00 00 	movabs 0x822004,%eax
+  800905:	00 00 
+  800907:	c3                   	ret
+
+0000000000800908 <virtio_match>:
+    return f->pf_vendor == VIRTIO_VENDOR && f->pf_device == VIRTIO_DEVICE_BLK &&
+  800908:	b8 00 00 00 00       	mov    $0x0,%eax
+  80090d:	81 7f 04 f4 1a 01 10 	cmpl   $0x10011af4,0x4(%rdi)
+  800914:	74 04                	je     80091a <virtio_match+0x12>
+  800916:	83 e0 01             	and    $0x1,%eax
+}
+  800919:	c3                   	ret
+virtio_match(struct PciFunc *f) {
+  80091a:	55                   	push   %rbp
+  80091b:	48 89 e5             	mov    %rsp,%rbp
+           (pci_conf_read(f, PCI_BAR0) & 1);
+  80091e:	be 10 00 00 00       	mov    $0x10,%esi
+  800923:	48 b8 bd 07 80 00 00 	movabs $0x8007bd,%rax
+  80092a:	00 00 00 
+  80092d:	ff d0                	call   *%rax
+    return f->pf_vendor == VIRTIO_VENDOR && f->pf_device == VIRTIO_DEVICE_BLK &&
+  80092f:	83 e0 01             	and    $0x1,%eax
+  800932:	83 e0 01             	and    $0x1,%eax
+}
+  800935:	5d                   	pop    %rbp
+  800936:	c3                   	ret
+
+0000000000800937 <vblk_submit>:
+vblk_submit(uint32_t *secno, void **buf, size_t *nsecs, bool write) {
+  800937:	55                   	push   %rbp
+  800938:	48 89 e5             	mov    %rsp,%rbp
+  80093b:	41 57                	push   %r15
+  80093d:	41 56                	push   %r14
+  80093f:	41 55                	push   %r13
+  800941:	41 54                	push   %r12
+  800943:	53                   	push   %rbx
+  800944:	48 83 ec 58          	sub    $0x58,%rsp
+  800948:	48 89 fb             	mov    %rdi,%rbx
+  80094b:	48 89 f7             	mov    %rsi,%rdi
+  80094e:	49 89 d2             	mov    %rdx,%r10
+  800951:	88 4d cf             	mov    %cl,-0x31(%rbp)
+        dma.status[i] = 0xFF;
+  800954:	48 b8 00 30 82 00 00 	movabs $0x823000,%rax
+  80095b:	00 00 00 
+  80095e:	c6 80 80 00 00 00 ff 	movb   $0xff,0x80(%rax)
+  800965:	c6 80 81 00 00 00 ff 	movb   $0xff,0x81(%rax)
+  80096c:	c6 80 82 00 00 00 ff 	movb   $0xff,0x82(%rax)
+  800973:	c6 80 83 00 00 00 ff 	movb   $0xff,0x83(%rax)
+  80097a:	c6 80 84 00 00 00 ff 	movb   $0xff,0x84(%rax)
+  800981:	c6 80 85 00 00 00 ff 	movb   $0xff,0x85(%rax)
+  800988:	c6 80 86 00 00 00 ff 	movb   $0xff,0x86(%rax)
+  80098f:	c6 80 87 00 00 00 ff 	movb   $0xff,0x87(%rax)
+    for (int i = 0; i < VBLK_NREQ; i++)
+  800996:	49 89 c1             	mov    %rax,%r9
+        dma.status[i] = 0xFF;
+  800999:	be 00 00 00 00       	mov    $0x0,%esi
+  80099e:	49 89 fb             	mov    %rdi,%r11
+  8009a1:	48 89 df             	mov    %rbx,%rdi
+  8009a4:	e9 e9 00 00 00       	jmp    800a92 <vblk_submit+0x15b>
+    d[n++] = (struct virtq_desc){
+  8009a9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009ad:	48 8b 55 b8          	mov    -0x48(%rbp),%rdx
+  8009b1:	48 8b 5d b0          	mov    -0x50(%rbp),%rbx
+  8009b5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8009b9:	4c 8b 4d a0          	mov    -0x60(%rbp),%r9
+  8009bd:	48 8b 7d 98          	mov    -0x68(%rbp),%rdi
+  8009c1:	4c 8b 5d 90          	mov    -0x70(%rbp),%r11
+  8009c5:	4c 8b 55 88          	mov    -0x78(%rbp),%r10
+  8009c9:	4d 63 e0             	movslq %r8d,%r12
+  8009cc:	49 c1 e4 04          	shl    $0x4,%r12
+  8009d0:	4a 8d 04 22          	lea    (%rdx,%r12,1),%rax
+            .addr = vblk.dma_pa + offsetof(struct vblk_dma, status[slot]),
+  8009d4:	49 bf 00 20 82 00 00 	movabs $0x822000,%r15
+  8009db:	00 00 00 
+  8009de:	4d 8b 6f 30          	mov    0x30(%r15),%r13
+  8009e2:	4e 8d ac 2e 80 00 00 	lea    0x80(%rsi,%r13,1),%r13
+  8009e9:	00 
+    d[n++] = (struct virtq_desc){
+  8009ea:	48 c7 40 08 00 00 00 	movq   $0x0,0x8(%rax)
+  8009f1:	00 
+  8009f2:	4c 89 28             	mov    %r13,(%rax)
+  8009f5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+  8009fc:	66 c7 40 0c 02 00    	movw   $0x2,0xc(%rax)
+    for (int i = 0; i < n - 1; i++)
+  800a02:	45 85 c0             	test   %r8d,%r8d
+  800a05:	7e 2f                	jle    800a36 <vblk_submit+0xff>
+        d[i].next = slot * vblk.slot_ndesc + i + 1;
+  800a07:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  800a0e:	00 00 00 
+  800a11:	41 89 f0             	mov    %esi,%r8d
+  800a14:	66 44 0f af 40 0e    	imul   0xe(%rax),%r8w
+  800a1a:	41 83 c0 01          	add    $0x1,%r8d
+  800a1e:	48 89 d0             	mov    %rdx,%rax
+  800a21:	4c 01 e2             	add    %r12,%rdx
+  800a24:	66 44 89 40 0e       	mov    %r8w,0xe(%rax)
+    for (int i = 0; i < n - 1; i++)
+  800a29:	41 83 c0 01          	add    $0x1,%r8d
+  800a2d:	48 83 c0 10          	add    $0x10,%rax
+  800a31:	48 39 c2             	cmp    %rax,%rdx
+  800a34:	75 ee                	jne    800a24 <vblk_submit+0xed>
+    vblk.busy[slot] = 1;
+  800a36:	48 b8 38 20 82 00 00 	movabs $0x822038,%rax
+  800a3d:	00 00 00 
+  800a40:	c6 04 30 01          	movb   $0x1,(%rax,%rsi,1)
+    vblk.avail->ring[vblk.avail_idx % vblk.qsize] = slot * vblk.slot_ndesc;
+  800a44:	4c 8d 70 c8          	lea    -0x38(%rax),%r14
+  800a48:	45 0f b7 46 10       	movzwl 0x10(%r14),%r8d
+  800a4d:	4d 8b 66 20          	mov    0x20(%r14),%r12
+  800a51:	44 89 c0             	mov    %r8d,%eax
+  800a54:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a59:	66 41 f7 76 0c       	divw   0xc(%r14)
+  800a5e:	0f b7 d2             	movzwl %dx,%edx
+  800a61:	89 f0                	mov    %esi,%eax
+  800a63:	66 41 0f af 46 0e    	imul   0xe(%r14),%ax
+  800a69:	66 41 89 44 54 04    	mov    %ax,0x4(%r12,%rdx,2)
+    vblk.avail_idx++;
+  800a6f:	41 83 c0 01          	add    $0x1,%r8d
+  800a73:	66 45 89 46 10       	mov    %r8w,0x10(%r14)
+        *secno += n;
+  800a78:	01 0f                	add    %ecx,(%rdi)
+        *buf += n * SECTSIZE;
+  800a7a:	49 01 1b             	add    %rbx,(%r11)
+        *nsecs -= n;
+  800a7d:	49 29 0a             	sub    %rcx,(%r10)
+    for (int slot = 0; slot < VBLK_NREQ && *nsecs > 0; slot++) {
+  800a80:	48 83 c6 01          	add    $0x1,%rsi
+  800a84:	49 83 c1 10          	add    $0x10,%r9
+  800a88:	48 83 fe 08          	cmp    $0x8,%rsi
+  800a8c:	0f 84 ef 00 00 00    	je     800b81 <vblk_submit+0x24a>
+  800a92:	49 8b 02             	mov    (%r10),%rax
+  800a95:	48 85 c0             	test   %rax,%rax
+  800a98:	0f 84 dc 00 00 00    	je     800b7a <vblk_submit+0x243>
+    return (vblk.slot_ndesc - 3) * (PAGE_SIZE / SECTSIZE);
+  800a9e:	49 be 00 20 82 00 00 	movabs $0x822000,%r14
+  800aa5:	00 00 00 
+  800aa8:	41 0f b7 56 0e       	movzwl 0xe(%r14),%edx
+  800aad:	8d 4a fd             	lea    -0x3(%rdx),%ecx
+  800ab0:	48 63 c9             	movslq %ecx,%rcx
+  800ab3:	48 c1 e1 03          	shl    $0x3,%rcx
+        size_t n = MIN(*nsecs, vblk_maxsecs());
+  800ab7:	48 39 c1             	cmp    %rax,%rcx
+  800aba:	48 0f 47 c8          	cmova  %rax,%rcx
+    struct virtq_desc *d = vblk.desc + slot * vblk.slot_ndesc;
+  800abe:	0f af d6             	imul   %esi,%edx
+  800ac1:	48 63 d2             	movslq %edx,%rdx
+  800ac4:	48 c1 e2 04          	shl    $0x4,%rdx
+  800ac8:	49 03 56 18          	add    0x18(%r14),%rdx
+    uintptr_t va = (uintptr_t)buf, end = va + nsecs * SECTSIZE;
+  800acc:	4d 8b 23             	mov    (%r11),%r12
+  800acf:	48 89 cb             	mov    %rcx,%rbx
+  800ad2:	48 c1 e3 09          	shl    $0x9,%rbx
+  800ad6:	4d 8d 3c 1c          	lea    (%r12,%rbx,1),%r15
+    dma.hdr[slot] = (struct virtio_blk_req){
+  800ada:	44 8b 2f             	mov    (%rdi),%r13d
+  800add:	4c 89 6d c0          	mov    %r13,-0x40(%rbp)
+  800ae1:	48 63 c6             	movslq %esi,%rax
+  800ae4:	49 89 c5             	mov    %rax,%r13
+  800ae7:	49 c1 e5 04          	shl    $0x4,%r13
+  800aeb:	49 b8 00 30 82 00 00 	movabs $0x823000,%r8
+  800af2:	00 00 00 
+  800af5:	4b c7 04 28 00 00 00 	movq   $0x0,(%r8,%r13,1)
+  800afc:	00 
+  800afd:	4b c7 44 28 08 00 00 	movq   $0x0,0x8(%r8,%r13,1)
+  800b04:	00 00 
+            .type = write ? VIRTIO_BLK_T_OUT : VIRTIO_BLK_T_IN,
+  800b06:	44 0f b6 6d cf       	movzbl -0x31(%rbp),%r13d
+  800b0b:	45 89 29             	mov    %r13d,(%r9)
+    dma.hdr[slot] = (struct virtio_blk_req){
+  800b0e:	4c 8b 6d c0          	mov    -0x40(%rbp),%r13
+  800b12:	4d 89 69 08          	mov    %r13,0x8(%r9)
+    dma.status[slot] = 0xFF;
+  800b16:	41 c6 84 00 80 00 00 	movb   $0xff,0x80(%r8,%rax,1)
+  800b1d:	00 ff 
+            .addr = vblk.dma_pa + offsetof(struct vblk_dma, hdr[slot]),
+  800b1f:	48 89 f0             	mov    %rsi,%rax
+  800b22:	48 c1 e0 04          	shl    $0x4,%rax
+  800b26:	49 03 46 30          	add    0x30(%r14),%rax
+    d[n++] = (struct virtq_desc){
+  800b2a:	48 c7 42 08 00 00 00 	movq   $0x0,0x8(%rdx)
+  800b31:	00 
+  800b32:	48 89 02             	mov    %rax,(%rdx)
+  800b35:	c7 42 08 10 00 00 00 	movl   $0x10,0x8(%rdx)
+  800b3c:	66 c7 42 0c 01 00    	movw   $0x1,0xc(%rdx)
+    while (va < end) {
+  800b42:	4d 39 fc             	cmp    %r15,%r12
+  800b45:	0f 83 16 01 00 00    	jae    800c61 <vblk_submit+0x32a>
+  800b4b:	4c 8d 72 10          	lea    0x10(%rdx),%r14
+  800b4f:	41 bd 02 00 00 00    	mov    $0x2,%r13d
+  800b55:	48 89 4d c0          	mov    %rcx,-0x40(%rbp)
+  800b59:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+  800b5d:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+  800b61:	48 89 75 a8          	mov    %rsi,-0x58(%rbp)
+  800b65:	4c 89 4d a0          	mov    %r9,-0x60(%rbp)
+  800b69:	48 89 7d 98          	mov    %rdi,-0x68(%rbp)
+  800b6d:	4c 89 5d 90          	mov    %r11,-0x70(%rbp)
+  800b71:	4c 89 55 88          	mov    %r10,-0x78(%rbp)
+  800b75:	e9 98 00 00 00       	jmp    800c12 <vblk_submit+0x2db>
+  800b7a:	be 00 00 00 00       	mov    $0x0,%esi
+  800b7f:	eb 05                	jmp    800b86 <vblk_submit+0x24f>
+    return 0;
+  800b81:	be 00 00 00 00       	mov    $0x0,%esi
+    __atomic_store_n(&vblk.avail->idx, vblk.avail_idx, __ATOMIC_RELEASE);
+  800b86:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  800b8d:	00 00 00 
+  800b90:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  800b94:	0f b7 48 10          	movzwl 0x10(%rax),%ecx
+  800b98:	66 89 4a 02          	mov    %cx,0x2(%rdx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  800b9c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    outw(vblk.iobase + VIRTIO_QUEUE_NOTIFY, 0);
+  800ba2:	8b 10                	mov    (%rax),%edx
+  800ba4:	83 c2 10             	add    $0x10,%edx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  800ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bac:	66 ef                	out    %ax,(%dx)
+}
+  800bae:	89 f0                	mov    %esi,%eax
+  800bb0:	48 83 c4 58          	add    $0x58,%rsp
+  800bb4:	5b                   	pop    %rbx
+  800bb5:	41 5c                	pop    %r12
+  800bb7:	41 5d                	pop    %r13
+  800bb9:	41 5e                	pop    %r14
+  800bbb:	41 5f                	pop    %r15
+  800bbd:	5d                   	pop    %rbp
+  800bbe:	c3                   	ret
+        if (pa < 0) return -E_NOT_SUPP;
+  800bbf:	be ed ff ff ff       	mov    $0xffffffed,%esi
+  800bc4:	eb c0                	jmp    800b86 <vblk_submit+0x24f>
+        int64_t pa = sys_region_pa((void *)va, write ? PROT_R : PROT_RW);
+  800bc6:	be 04 00 00 00       	mov    $0x4,%esi
+  800bcb:	4c 89 e7             	mov    %r12,%rdi
+  800bce:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  800bd5:	00 00 00 
+  800bd8:	ff d0                	call   *%rax
+        if (pa < 0) return -E_NOT_SUPP;
+  800bda:	48 85 c0             	test   %rax,%rax
+  800bdd:	78 e0                	js     800bbf <vblk_submit+0x288>
+        d[n++] = (struct virtq_desc){
+  800bdf:	45 89 e8             	mov    %r13d,%r8d
+  800be2:	4c 89 f2             	mov    %r14,%rdx
+  800be5:	89 de                	mov    %ebx,%esi
+  800be7:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800bec:	48 c7 42 08 00 00 00 	movq   $0x0,0x8(%rdx)
+  800bf3:	00 
+  800bf4:	48 89 02             	mov    %rax,(%rdx)
+  800bf7:	89 72 08             	mov    %esi,0x8(%rdx)
+  800bfa:	66 89 4a 0c          	mov    %cx,0xc(%rdx)
+        va += len;
+  800bfe:	49 01 dc             	add    %rbx,%r12
+    while (va < end) {
+  800c01:	41 83 c5 01          	add    $0x1,%r13d
+  800c05:	49 83 c6 10          	add    $0x10,%r14
+  800c09:	4d 39 fc             	cmp    %r15,%r12
+  800c0c:	0f 83 97 fd ff ff    	jae    8009a9 <vblk_submit+0x72>
+        size_t len = MIN(end - va, PAGE_SIZE - PAGE_OFFSET(va));
+  800c12:	4c 89 e0             	mov    %r12,%rax
+  800c15:	25 ff 0f 00 00       	and    $0xfff,%eax
+  800c1a:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  800c1f:	48 29 c3             	sub    %rax,%rbx
+  800c22:	4c 89 f8             	mov    %r15,%rax
+  800c25:	4c 29 e0             	sub    %r12,%rax
+  800c28:	48 39 c3             	cmp    %rax,%rbx
+  800c2b:	48 0f 47 d8          	cmova  %rax,%rbx
+        int64_t pa = sys_region_pa((void *)va, write ? PROT_R : PROT_RW);
+  800c2f:	80 7d cf 00          	cmpb   $0x0,-0x31(%rbp)
+  800c33:	75 91                	jne    800bc6 <vblk_submit+0x28f>
+  800c35:	be 06 00 00 00       	mov    $0x6,%esi
+  800c3a:	4c 89 e7             	mov    %r12,%rdi
+  800c3d:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  800c44:	00 00 00 
+  800c47:	ff d0                	call   *%rax
+        if (pa < 0) return -E_NOT_SUPP;
+  800c49:	48 85 c0             	test   %rax,%rax
+  800c4c:	0f 88 6d ff ff ff    	js     800bbf <vblk_submit+0x288>
+        d[n++] = (struct virtq_desc){
+  800c52:	45 89 e8             	mov    %r13d,%r8d
+  800c55:	4c 89 f2             	mov    %r14,%rdx
+  800c58:	89 de                	mov    %ebx,%esi
+  800c5a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800c5f:	eb 8b                	jmp    800bec <vblk_submit+0x2b5>
+            .addr = vblk.dma_pa + offsetof(struct vblk_dma, status[slot]),
+  800c61:	48 a1 30 20 82 00 00 	movabs 0x822030,%rax
+  800c68:	00 00 00 
+  800c6b:	48 8d 84 06 80 00 00 	lea    0x80(%rsi,%rax,1),%rax
+  800c72:	00 
+    d[n++] = (struct virtq_desc){
+  800c73:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  800c7a:	00 
+  800c7b:	48 89 42 10          	mov    %rax,0x10(%rdx)
+  800c7f:	c7 42 18 01 00 00 00 	movl   $0x1,0x18(%rdx)
+  800c86:	66 c7 42 1c 02 00    	movw   $0x2,0x1c(%rdx)
+  800c8c:	41 bc 10 00 00 00    	mov    $0x10,%r12d
+  800c92:	e9 70 fd ff ff       	jmp    800a07 <vblk_submit+0xd0>
+
+0000000000800c97 <vblk_finish>:
+vblk_finish(bool wait) {
+  800c97:	55                   	push   %rbp
+  800c98:	48 89 e5             	mov    %rsp,%rbp
+  800c9b:	41 57                	push   %r15
+  800c9d:	41 56                	push   %r14
+  800c9f:	41 55                	push   %r13
+  800ca1:	41 54                	push   %r12
+  800ca3:	53                   	push   %rbx
+  800ca4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca8:	41 89 ff             	mov    %edi,%r15d
+        uint32_t seen = vsys[VSYS_irq + vblk.irq];
+  800cab:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  800cb2:	00 00 00 
+  800cb5:	49 bd 00 f0 bf 1f 80 	movabs $0x801fbff000,%r13
+  800cbc:	00 00 00 
+  800cbf:	4c 8d 63 40          	lea    0x40(%rbx),%r12
+  800cc3:	e9 90 00 00 00       	jmp    800d58 <vblk_finish+0xc1>
+    while (vblk.used_idx != vblk.used->idx) {
+  800cc8:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  800ccc:	0f b7 40 02          	movzwl 0x2(%rax),%eax
+  800cd0:	66 39 43 12          	cmp    %ax,0x12(%rbx)
+  800cd4:	74 3a                	je     800d10 <vblk_finish+0x79>
+        uint32_t id = vblk.used->ring[vblk.used_idx % vblk.qsize].id;
+  800cd6:	48 8b 73 28          	mov    0x28(%rbx),%rsi
+  800cda:	0f b7 4b 12          	movzwl 0x12(%rbx),%ecx
+  800cde:	89 c8                	mov    %ecx,%eax
+  800ce0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ce5:	66 f7 73 0c          	divw   0xc(%rbx)
+  800ce9:	0f b7 d2             	movzwl %dx,%edx
+        vblk.busy[id / vblk.slot_ndesc] = 0;
+  800cec:	0f b7 7b 0e          	movzwl 0xe(%rbx),%edi
+  800cf0:	8b 44 d6 04          	mov    0x4(%rsi,%rdx,8),%eax
+  800cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cf9:	f7 f7                	div    %edi
+  800cfb:	c6 44 03 38 00       	movb   $0x0,0x38(%rbx,%rax,1)
+        vblk.used_idx++;
+  800d00:	83 c1 01             	add    $0x1,%ecx
+  800d03:	66 89 4b 12          	mov    %cx,0x12(%rbx)
+    while (vblk.used_idx != vblk.used->idx) {
+  800d07:	0f b7 46 02          	movzwl 0x2(%rsi),%eax
+  800d0b:	66 39 c1             	cmp    %ax,%cx
+  800d0e:	75 c6                	jne    800cd6 <vblk_finish+0x3f>
+        for (int i = 0; i < VBLK_NREQ; i++)
+  800d10:	48 b8 38 20 82 00 00 	movabs $0x822038,%rax
+  800d17:	00 00 00 
+        bool busy = 0;
+  800d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+            busy |= vblk.busy[i];
+  800d1f:	0a 10                	or     (%rax),%dl
+        for (int i = 0; i < VBLK_NREQ; i++)
+  800d21:	48 83 c0 01          	add    $0x1,%rax
+  800d25:	4c 39 e0             	cmp    %r12,%rax
+  800d28:	75 f5                	jne    800d1f <vblk_finish+0x88>
+        if (!busy) break;
+  800d2a:	84 d2                	test   %dl,%dl
+  800d2c:	74 5f                	je     800d8d <vblk_finish+0xf6>
+        if (!wait) return -E_AGAIN;
+  800d2e:	45 84 ff             	test   %r15b,%r15b
+  800d31:	0f 84 9b 00 00 00    	je     800dd2 <vblk_finish+0x13b>
+        sys_futex_wait((const volatile uint32_t *)&vsys[VSYS_irq + vblk.irq], seen, VBLK_IRQ_TIMEOUT);
+  800d37:	8b 43 04             	mov    0x4(%rbx),%eax
+  800d3a:	83 c0 01             	add    $0x1,%eax
+  800d3d:	48 98                	cltq
+  800d3f:	49 8d 7c 85 00       	lea    0x0(%r13,%rax,4),%rdi
+  800d44:	ba 64 00 00 00       	mov    $0x64,%edx
+  800d49:	44 89 f6             	mov    %r14d,%esi
+  800d4c:	48 b8 c3 86 80 00 00 	movabs $0x8086c3,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+        uint32_t seen = vsys[VSYS_irq + vblk.irq];
+  800d58:	8b 7b 04             	mov    0x4(%rbx),%edi
+  800d5b:	8d 47 01             	lea    0x1(%rdi),%eax
+  800d5e:	48 98                	cltq
+  800d60:	45 8b 74 85 00       	mov    0x0(%r13,%rax,4),%r14d
+    uint32_t n = vsys[VSYS_irq + vblk.irq];
+  800d65:	41 8b 44 85 00       	mov    0x0(%r13,%rax,4),%eax
+    if (n == vblk.irq_seen) return;
+  800d6a:	3b 43 08             	cmp    0x8(%rbx),%eax
+  800d6d:	0f 84 55 ff ff ff    	je     800cc8 <vblk_finish+0x31>
+    vblk.irq_seen = n;
+  800d73:	89 43 08             	mov    %eax,0x8(%rbx)
+    inb(vblk.iobase + VIRTIO_ISR);
+  800d76:	8b 03                	mov    (%rbx),%eax
+  800d78:	8d 50 13             	lea    0x13(%rax),%edx
+    asm volatile("inb %w1,%0"
+  800d7b:	ec                   	in     (%dx),%al
+    sys_irq_ack(vblk.irq);
+  800d7c:	48 b8 25 87 80 00 00 	movabs $0x808725,%rax
+  800d83:	00 00 00 
+  800d86:	ff d0                	call   *%rax
+  800d88:	e9 3b ff ff ff       	jmp    800cc8 <vblk_finish+0x31>
+    for (int i = 0; i < VBLK_NREQ; i++)
+  800d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+    int res = 0;
+  800d92:	be 00 00 00 00       	mov    $0x0,%esi
+        if (dma.status[i] != VIRTIO_BLK_S_OK && dma.status[i] != 0xFF) res = -1;
+  800d97:	48 b9 00 30 82 00 00 	movabs $0x823000,%rcx
+  800d9e:	00 00 00 
+  800da1:	bf ff ff ff ff       	mov    $0xffffffff,%edi
+  800da6:	eb 08                	jmp    800db0 <vblk_finish+0x119>
+    for (int i = 0; i < VBLK_NREQ; i++)
+  800da8:	83 c0 01             	add    $0x1,%eax
+  800dab:	83 f8 08             	cmp    $0x8,%eax
+  800dae:	74 27                	je     800dd7 <vblk_finish+0x140>
+        if (dma.status[i] != VIRTIO_BLK_S_OK && dma.status[i] != 0xFF) res = -1;
+  800db0:	48 63 d0             	movslq %eax,%rdx
+  800db3:	0f b6 94 11 80 00 00 	movzbl 0x80(%rcx,%rdx,1),%edx
+  800dba:	00 
+  800dbb:	84 d2                	test   %dl,%dl
+  800dbd:	74 e9                	je     800da8 <vblk_finish+0x111>
+  800dbf:	48 63 d0             	movslq %eax,%rdx
+  800dc2:	0f b6 94 11 80 00 00 	movzbl 0x80(%rcx,%rdx,1),%edx
+  800dc9:	00 
+  800dca:	80 fa ff             	cmp    $0xff,%dl
+  800dcd:	0f 45 f7             	cmovne %edi,%esi
+  800dd0:	eb d6                	jmp    800da8 <vblk_finish+0x111>
+        if (!wait) return -E_AGAIN;
+  800dd2:	be ec ff ff ff       	mov    $0xffffffec,%esi
+}
+  800dd7:	89 f0                	mov    %esi,%eax
+  800dd9:	48 83 c4 08          	add    $0x8,%rsp
+  800ddd:	5b                   	pop    %rbx
+  800dde:	41 5c                	pop    %r12
+  800de0:	41 5d                	pop    %r13
+  800de2:	41 5e                	pop    %r14
+  800de4:	41 5f                	pop    %r15
+  800de6:	5d                   	pop    %rbp
+  800de7:	c3                   	ret
+
+0000000000800de8 <vblk_rw>:
+vblk_rw(uint32_t secno, void *buf, size_t nsecs, bool write) {
+  800de8:	55                   	push   %rbp
+  800de9:	48 89 e5             	mov    %rsp,%rbp
+  800dec:	41 56                	push   %r14
+  800dee:	41 55                	push   %r13
+  800df0:	41 54                	push   %r12
+  800df2:	53                   	push   %rbx
+  800df3:	48 83 ec 20          	sub    $0x20,%rsp
+  800df7:	89 7d dc             	mov    %edi,-0x24(%rbp)
+  800dfa:	48 89 75 d0          	mov    %rsi,-0x30(%rbp)
+  800dfe:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    if ((uintptr_t)buf % SECTSIZE) return -E_INVAL;
+  800e02:	f7 c6 ff 01 00 00    	test   $0x1ff,%esi
+  800e08:	75 5b                	jne    800e65 <vblk_rw+0x7d>
+        int res = vblk_submit(&secno, &buf, &nsecs, write);
+  800e0a:	44 0f b6 e1          	movzbl %cl,%r12d
+  800e0e:	49 be 37 09 80 00 00 	movabs $0x800937,%r14
+  800e15:	00 00 00 
+        int r = vblk_finish(1);
+  800e18:	49 bd 97 0c 80 00 00 	movabs $0x800c97,%r13
+  800e1f:	00 00 00 
+    while (nsecs > 0) {
+  800e22:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  800e27:	74 28                	je     800e51 <vblk_rw+0x69>
+        int res = vblk_submit(&secno, &buf, &nsecs, write);
+  800e29:	44 89 e1             	mov    %r12d,%ecx
+  800e2c:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  800e30:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800e34:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  800e38:	41 ff d6             	call   *%r14
+  800e3b:	89 c3                	mov    %eax,%ebx
+        int r = vblk_finish(1);
+  800e3d:	bf 01 00 00 00       	mov    $0x1,%edi
+  800e42:	41 ff d5             	call   *%r13
+        if (res < 0) return res;
+  800e45:	85 db                	test   %ebx,%ebx
+  800e47:	78 0d                	js     800e56 <vblk_rw+0x6e>
+        if (r < 0) return r;
+  800e49:	85 c0                	test   %eax,%eax
+  800e4b:	79 d5                	jns    800e22 <vblk_rw+0x3a>
+        int r = vblk_finish(1);
+  800e4d:	89 c3                	mov    %eax,%ebx
+  800e4f:	eb 05                	jmp    800e56 <vblk_rw+0x6e>
+    return 0;
+  800e51:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800e56:	89 d8                	mov    %ebx,%eax
+  800e58:	48 83 c4 20          	add    $0x20,%rsp
+  800e5c:	5b                   	pop    %rbx
+  800e5d:	41 5c                	pop    %r12
+  800e5f:	41 5d                	pop    %r13
+  800e61:	41 5e                	pop    %r14
+  800e63:	5d                   	pop    %rbp
+  800e64:	c3                   	ret
+    if ((uintptr_t)buf % SECTSIZE) return -E_INVAL;
+  800e65:	bb fd ff ff ff       	mov    $0xfffffffd,%ebx
+  800e6a:	eb ea                	jmp    800e56 <vblk_rw+0x6e>
+
+0000000000800e6c <virtio_read>:
+virtio_read(uint32_t secno, void *dst, size_t nsecs) {
+  800e6c:	55                   	push   %rbp
+  800e6d:	48 89 e5             	mov    %rsp,%rbp
+    return vblk_rw(secno, dst, nsecs, 0);
+  800e70:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e75:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800e7c:	00 00 00 
+  800e7f:	ff d0                	call   *%rax
+}
+  800e81:	5d                   	pop    %rbp
+  800e82:	c3                   	ret
+
+0000000000800e83 <virtio_write>:
+virtio_write(uint32_t secno, const void *src, size_t nsecs) {
+  800e83:	55                   	push   %rbp
+  800e84:	48 89 e5             	mov    %rsp,%rbp
+    return vblk_rw(secno, (void *)src, nsecs, 1);
+  800e87:	b9 01 00 00 00       	mov    $0x1,%ecx
+  800e8c:	48 b8 e8 0d 80 00 00 	movabs $0x800de8,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+}
+  800e98:	5d                   	pop    %rbp
+  800e99:	c3                   	ret
+
+0000000000800e9a <virtio_finish>:
+virtio_finish(bool wait) {
+  800e9a:	55                   	push   %rbp
+  800e9b:	48 89 e5             	mov    %rsp,%rbp
+    return vblk_finish(wait);
+  800e9e:	40 0f b6 ff          	movzbl %dil,%edi
+  800ea2:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  800ea9:	00 00 00 
+  800eac:	ff d0                	call   *%rax
+}
+  800eae:	5d                   	pop    %rbp
+  800eaf:	c3                   	ret
+
+0000000000800eb0 <virtio_read_start>:
+virtio_read_start(uint32_t secno, void *dst, size_t nsecs) {
+  800eb0:	55                   	push   %rbp
+  800eb1:	48 89 e5             	mov    %rsp,%rbp
+  800eb4:	48 83 ec 20          	sub    $0x20,%rsp
+  800eb8:	89 7d fc             	mov    %edi,-0x4(%rbp)
+  800ebb:	48 89 75 f0          	mov    %rsi,-0x10(%rbp)
+  800ebf:	48 89 55 e8          	mov    %rdx,-0x18(%rbp)
+    if ((uintptr_t)dst % SECTSIZE || nsecs > VBLK_NREQ * vblk_maxsecs()) return -E_NOT_SUPP;
+  800ec3:	f7 c6 ff 01 00 00    	test   $0x1ff,%esi
+  800ec9:	75 5c                	jne    800f27 <virtio_read_start+0x77>
+    return (vblk.slot_ndesc - 3) * (PAGE_SIZE / SECTSIZE);
+  800ecb:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  800ed2:	00 00 00 
+  800ed5:	0f b7 40 0e          	movzwl 0xe(%rax),%eax
+  800ed9:	83 e8 03             	sub    $0x3,%eax
+  800edc:	48 98                	cltq
+    if ((uintptr_t)dst % SECTSIZE || nsecs > VBLK_NREQ * vblk_maxsecs()) return -E_NOT_SUPP;
+  800ede:	48 c1 e0 06          	shl    $0x6,%rax
+  800ee2:	48 39 d0             	cmp    %rdx,%rax
+  800ee5:	72 47                	jb     800f2e <virtio_read_start+0x7e>
+    if (vblk_submit(&secno, &dst, &nsecs, 0) < 0) {
+  800ee7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eec:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  800ef0:	48 8d 75 f0          	lea    -0x10(%rbp),%rsi
+  800ef4:	48 8d 7d fc          	lea    -0x4(%rbp),%rdi
+  800ef8:	48 b8 37 09 80 00 00 	movabs $0x800937,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+  800f04:	85 c0                	test   %eax,%eax
+  800f06:	78 07                	js     800f0f <virtio_read_start+0x5f>
+    return 0;
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f0d:	c9                   	leave
+  800f0e:	c3                   	ret
+        vblk_finish(1);
+  800f0f:	bf 01 00 00 00       	mov    $0x1,%edi
+  800f14:	48 b8 97 0c 80 00 00 	movabs $0x800c97,%rax
+  800f1b:	00 00 00 
+  800f1e:	ff d0                	call   *%rax
+        return -E_NOT_SUPP;
+  800f20:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f25:	eb e6                	jmp    800f0d <virtio_read_start+0x5d>
+    if ((uintptr_t)dst % SECTSIZE || nsecs > VBLK_NREQ * vblk_maxsecs()) return -E_NOT_SUPP;
+  800f27:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f2c:	eb df                	jmp    800f0d <virtio_read_start+0x5d>
+  800f2e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800f33:	eb d8                	jmp    800f0d <virtio_read_start+0x5d>
+
+0000000000800f35 <virtio_blk_init>:
+virtio_blk_init(void) {
+  800f35:	55                   	push   %rbp
+  800f36:	48 89 e5             	mov    %rsp,%rbp
+  800f39:	41 57                	push   %r15
+  800f3b:	41 56                	push   %r14
+  800f3d:	41 55                	push   %r13
+  800f3f:	41 54                	push   %r12
+  800f41:	53                   	push   %rbx
+  800f42:	48 83 ec 38          	sub    $0x38,%rsp
+    if (!pci_find(&f, virtio_match)) return 0;
+  800f46:	48 be 08 09 80 00 00 	movabs $0x800908,%rsi
+  800f4d:	00 00 00 
+  800f50:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800f54:	48 b8 19 08 80 00 00 	movabs $0x800819,%rax
+  800f5b:	00 00 00 
+  800f5e:	ff d0                	call   *%rax
+  800f60:	89 c3                	mov    %eax,%ebx
+  800f62:	84 c0                	test   %al,%al
+  800f64:	75 11                	jne    800f77 <virtio_blk_init+0x42>
+}
+  800f66:	89 d8                	mov    %ebx,%eax
+  800f68:	48 83 c4 38          	add    $0x38,%rsp
+  800f6c:	5b                   	pop    %rbx
+  800f6d:	41 5c                	pop    %r12
+  800f6f:	41 5d                	pop    %r13
+  800f71:	41 5e                	pop    %r14
+  800f73:	41 5f                	pop    %r15
+  800f75:	5d                   	pop    %rbp
+  800f76:	c3                   	ret
+    pci_enable(&f);
+  800f77:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800f7b:	48 b8 c1 08 80 00 00 	movabs $0x8008c1,%rax
+  800f82:	00 00 00 
+  800f85:	ff d0                	call   *%rax
+    int io = pci_conf_read(&f, PCI_BAR0) & 0xFFFC;
+  800f87:	be 10 00 00 00       	mov    $0x10,%esi
+  800f8c:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800f90:	48 bb bd 07 80 00 00 	movabs $0x8007bd,%rbx
+  800f97:	00 00 00 
+  800f9a:	ff d3                	call   *%rbx
+  800f9c:	25 fc ff 00 00       	and    $0xfffc,%eax
+  800fa1:	41 89 c5             	mov    %eax,%r13d
+    int irq = pci_conf_read(&f, PCI_INTR) & 0xFF;
+  800fa4:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800fa9:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800fad:	ff d3                	call   *%rbx
+  800faf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    outb(io + VIRTIO_STATUS, 0);
+  800fb2:	41 8d 55 12          	lea    0x12(%r13),%edx
+  800fb6:	89 55 bc             	mov    %edx,-0x44(%rbp)
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  800fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbe:	ee                   	out    %al,(%dx)
+  800fbf:	b8 01 00 00 00       	mov    $0x1,%eax
+  800fc4:	ee                   	out    %al,(%dx)
+  800fc5:	b8 03 00 00 00       	mov    $0x3,%eax
+  800fca:	ee                   	out    %al,(%dx)
+    outl(io + VIRTIO_GUEST_FEATURES, 0);
+  800fcb:	41 8d 55 04          	lea    0x4(%r13),%edx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  800fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd4:	ef                   	out    %eax,(%dx)
+    outw(io + VIRTIO_QUEUE_SEL, 0);
+  800fd5:	41 8d 55 0e          	lea    0xe(%r13),%edx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  800fd9:	66 ef                	out    %ax,(%dx)
+    uint16_t qsize = inw(io + VIRTIO_QUEUE_SIZE);
+  800fdb:	41 8d 55 0c          	lea    0xc(%r13),%edx
+    asm volatile("inw %w1,%0"
+  800fdf:	66 ed                	in     (%dx),%ax
+  800fe1:	66 89 45 b2          	mov    %ax,-0x4e(%rbp)
+    size_t avail_off = qsize * sizeof(struct virtq_desc);
+  800fe5:	0f b7 d0             	movzwl %ax,%edx
+  800fe8:	48 89 d3             	mov    %rdx,%rbx
+  800feb:	48 c1 e3 04          	shl    $0x4,%rbx
+  800fef:	48 89 5d a8          	mov    %rbx,-0x58(%rbp)
+    size_t used_off = ROUNDUP(avail_off + sizeof(struct virtq_avail) + (qsize + 1) * sizeof(uint16_t), VIRTQ_ALIGN);
+  800ff3:	89 c1                	mov    %eax,%ecx
+  800ff5:	0f b7 c0             	movzwl %ax,%eax
+  800ff8:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+  800ffb:	83 c0 01             	add    $0x1,%eax
+  800ffe:	48 98                	cltq
+  801000:	48 8d 84 43 03 10 00 	lea    0x1003(%rbx,%rax,2),%rax
+  801007:	00 
+  801008:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80100e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    size_t size = used_off + sizeof(struct virtq_used) + qsize * sizeof(struct virtq_used_elem) + sizeof(uint16_t);
+  801012:	4c 8d 7c d0 06       	lea    0x6(%rax,%rdx,8),%r15
+    if (qsize >= VBLK_NREQ * 4 && size <= VIRTQ_MAXSIZE) {
+  801017:	66 83 f9 1f          	cmp    $0x1f,%cx
+  80101b:	0f 97 c3             	seta   %bl
+  80101e:	49 81 ff 00 00 01 00 	cmp    $0x10000,%r15
+  801025:	0f 96 c0             	setbe  %al
+  801028:	20 c3                	and    %al,%bl
+  80102a:	75 13                	jne    80103f <virtio_blk_init+0x10a>
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  80102c:	b8 80 ff ff ff       	mov    $0xffffff80,%eax
+  801031:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  801034:	ee                   	out    %al,(%dx)
+        return 0;
+  801035:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80103a:	e9 27 ff ff ff       	jmp    800f66 <virtio_blk_init+0x31>
+    if (sys_alloc_region(0, (void *)VIRTQ_VA, VIRTQ_MAXSIZE, PROT_RW) < 0) return -E_NO_MEM;
+  80103f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801044:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801049:	be 00 00 00 0e       	mov    $0xe000000,%esi
+  80104e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801053:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80105a:	00 00 00 
+  80105d:	ff d0                	call   *%rax
+  80105f:	85 c0                	test   %eax,%eax
+  801061:	0f 88 5a 01 00 00    	js     8011c1 <virtio_blk_init+0x28c>
+    int64_t pa = sys_region_pa((void *)VIRTQ_VA, PROT_RW);
+  801067:	be 06 00 00 00       	mov    $0x6,%esi
+  80106c:	bf 00 00 00 0e       	mov    $0xe000000,%edi
+  801071:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  801078:	00 00 00 
+  80107b:	ff d0                	call   *%rax
+  80107d:	49 89 c6             	mov    %rax,%r14
+    if (pa < 0) return pa;
+  801080:	48 85 c0             	test   %rax,%rax
+  801083:	78 3b                	js     8010c0 <virtio_blk_init+0x18b>
+    for (size_t off = PAGE_SIZE; off < size; off += PAGE_SIZE)
+  801085:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+        if (sys_region_pa((void *)VIRTQ_VA + off, PROT_RW) != pa + off) return -E_NO_MEM;
+  80108b:	49 8d bc 24 00 00 00 	lea    0xe000000(%r12),%rdi
+  801092:	0e 
+  801093:	be 06 00 00 00       	mov    $0x6,%esi
+  801098:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  80109f:	00 00 00 
+  8010a2:	ff d0                	call   *%rax
+  8010a4:	48 89 c2             	mov    %rax,%rdx
+  8010a7:	4b 8d 04 26          	lea    (%r14,%r12,1),%rax
+  8010ab:	48 39 c2             	cmp    %rax,%rdx
+  8010ae:	0f 85 0d 01 00 00    	jne    8011c1 <virtio_blk_init+0x28c>
+    for (size_t off = PAGE_SIZE; off < size; off += PAGE_SIZE)
+  8010b4:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  8010bb:	4d 39 fc             	cmp    %r15,%r12
+  8010be:	72 cb                	jb     80108b <virtio_blk_init+0x156>
+        dma_pa = sys_region_pa(&dma, PROT_RW);
+  8010c0:	be 06 00 00 00       	mov    $0x6,%esi
+  8010c5:	48 bf 00 30 82 00 00 	movabs $0x823000,%rdi
+  8010cc:	00 00 00 
+  8010cf:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  8010d6:	00 00 00 
+  8010d9:	ff d0                	call   *%rax
+  8010db:	49 89 c7             	mov    %rax,%r15
+    if (qpa < 0 || dma_pa < 0 || sys_irq_ack(irq) < 0) {
+  8010de:	4c 09 f0             	or     %r14,%rax
+  8010e1:	0f 88 45 ff ff ff    	js     80102c <virtio_blk_init+0xf7>
+    int irq = pci_conf_read(&f, PCI_INTR) & 0xFF;
+  8010e7:	44 0f b6 65 b8       	movzbl -0x48(%rbp),%r12d
+    if (qpa < 0 || dma_pa < 0 || sys_irq_ack(irq) < 0) {
+  8010ec:	44 89 e7             	mov    %r12d,%edi
+  8010ef:	48 b8 25 87 80 00 00 	movabs $0x808725,%rax
+  8010f6:	00 00 00 
+  8010f9:	ff d0                	call   *%rax
+  8010fb:	85 c0                	test   %eax,%eax
+  8010fd:	0f 88 29 ff ff ff    	js     80102c <virtio_blk_init+0xf7>
+    vblk.qsize = qsize;
+  801103:	48 b9 00 20 82 00 00 	movabs $0x822000,%rcx
+  80110a:	00 00 00 
+  80110d:	0f b7 45 b2          	movzwl -0x4e(%rbp),%eax
+  801111:	66 89 41 0c          	mov    %ax,0xc(%rcx)
+    vblk.slot_ndesc = qsize / VBLK_NREQ;
+  801115:	66 c1 e8 03          	shr    $0x3,%ax
+  801119:	66 89 41 0e          	mov    %ax,0xe(%rcx)
+    vblk.desc = (struct virtq_desc *)VIRTQ_VA;
+  80111d:	48 c7 41 18 00 00 00 	movq   $0xe000000,0x18(%rcx)
+  801124:	0e 
+    vblk.avail = (struct virtq_avail *)(VIRTQ_VA + avail_off);
+  801125:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801129:	48 05 00 00 00 0e    	add    $0xe000000,%rax
+  80112f:	48 89 41 20          	mov    %rax,0x20(%rcx)
+    vblk.used = (struct virtq_used *)(VIRTQ_VA + used_off);
+  801133:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801137:	48 05 00 00 00 0e    	add    $0xe000000,%rax
+  80113d:	48 89 41 28          	mov    %rax,0x28(%rcx)
+    vblk.dma_pa = dma_pa;
+  801141:	4c 89 79 30          	mov    %r15,0x30(%rcx)
+    vblk.irq = irq;
+  801145:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+    vblk.irq_seen = vsys[VSYS_irq + irq];
+  801149:	41 8d 44 24 01       	lea    0x1(%r12),%eax
+  80114e:	48 98                	cltq
+  801150:	48 ba 00 f0 bf 1f 80 	movabs $0x801fbff000,%rdx
+  801157:	00 00 00 
+  80115a:	8b 04 82             	mov    (%rdx,%rax,4),%eax
+  80115d:	89 41 08             	mov    %eax,0x8(%rcx)
+    outl(io + VIRTIO_QUEUE_PFN, qpa / VIRTQ_ALIGN);
+  801160:	49 8d 86 ff 0f 00 00 	lea    0xfff(%r14),%rax
+  801167:	4d 85 f6             	test   %r14,%r14
+  80116a:	49 0f 49 c6          	cmovns %r14,%rax
+  80116e:	48 c1 f8 0c          	sar    $0xc,%rax
+  801172:	41 8d 55 08          	lea    0x8(%r13),%edx
+    asm volatile("outl %0,%w1" ::"a"(data), "d"(port));
+  801176:	ef                   	out    %eax,(%dx)
+    asm volatile("outb %0,%w1" ::"a"(data), "d"(port));
+  801177:	b8 07 00 00 00       	mov    $0x7,%eax
+  80117c:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  80117f:	ee                   	out    %al,(%dx)
+    vblk.iobase = io;
+  801180:	44 89 29             	mov    %r13d,(%rcx)
+    uint64_t capacity = inl(io + VIRTIO_BLK_CAPACITY) | (uint64_t)inl(io + VIRTIO_BLK_CAPACITY + 4) << 32;
+  801183:	41 8d 55 14          	lea    0x14(%r13),%edx
+    asm volatile("inl %w1,%0"
+  801187:	ed                   	in     (%dx),%eax
+  801188:	89 c1                	mov    %eax,%ecx
+  80118a:	41 8d 55 18          	lea    0x18(%r13),%edx
+  80118e:	ed                   	in     (%dx),%eax
+  80118f:	89 c6                	mov    %eax,%esi
+  801191:	48 c1 e6 20          	shl    $0x20,%rsi
+  801195:	89 c9                	mov    %ecx,%ecx
+  801197:	48 09 ce             	or     %rcx,%rsi
+    cprintf("virtio-blk: %lu sectors, queue size %u, irq %d\n",
+  80119a:	44 89 e1             	mov    %r12d,%ecx
+  80119d:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8011a0:	48 bf 90 bc 80 00 00 	movabs $0x80bc90,%rdi
+  8011a7:	00 00 00 
+  8011aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011af:	49 b8 d1 74 80 00 00 	movabs $0x8074d1,%r8
+  8011b6:	00 00 00 
+  8011b9:	41 ff d0             	call   *%r8
+    return 1;
+  8011bc:	e9 a5 fd ff ff       	jmp    800f66 <virtio_blk_init+0x31>
+        dma_pa = sys_region_pa(&dma, PROT_RW);
+  8011c1:	be 06 00 00 00       	mov    $0x6,%esi
+  8011c6:	48 bf 00 30 82 00 00 	movabs $0x823000,%rdi
+  8011cd:	00 00 00 
+  8011d0:	48 b8 03 87 80 00 00 	movabs $0x808703,%rax
+  8011d7:	00 00 00 
+  8011da:	ff d0                	call   *%rax
+    if (qpa < 0 || dma_pa < 0 || sys_irq_ack(irq) < 0) {
+  8011dc:	e9 4b fe ff ff       	jmp    80102c <virtio_blk_init+0xf7>
+
+00000000008011e1 <bc_pinned>:
+}
+
+/* The superblock and the bitmap are never evicted */
+static bool
+bc_pinned(blockno_t blockno) {
+    return blockno < 2 || (super && blockno < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE));
+  8011e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8011e6:	83 ff 01             	cmp    $0x1,%edi
+  8011e9:	76 2c                	jbe    801217 <bc_pinned+0x36>
+  8011eb:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  8011f2:	00 00 00 
+  8011f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fa:	48 85 c0             	test   %rax,%rax
+  8011fd:	74 18                	je     801217 <bc_pinned+0x36>
+  8011ff:	8b 40 04             	mov    0x4(%rax),%eax
+  801202:	48 05 ff 7f 00 00    	add    $0x7fff,%rax
+  801208:	48 c1 e8 0f          	shr    $0xf,%rax
+  80120c:	83 c0 02             	add    $0x2,%eax
+  80120f:	39 c7                	cmp    %eax,%edi
+  801211:	0f 92 c2             	setb   %dl
+  801214:	0f b6 d2             	movzbl %dl,%edx
+  801217:	89 d0                	mov    %edx,%eax
+  801219:	83 e0 01             	and    $0x1,%eax
+}
+  80121c:	c3                   	ret
+
+000000000080121d <bc_track>:
+
+/* Start tracking a block which has just been read in */
+static void
+bc_track(blockno_t blockno) {
+  80121d:	55                   	push   %rbp
+  80121e:	48 89 e5             	mov    %rsp,%rbp
+  801221:	53                   	push   %rbx
+  801222:	48 83 ec 08          	sub    $0x8,%rsp
+  801226:	89 fb                	mov    %edi,%ebx
+    if (bc_pinned(blockno) || !bc_nfree) return;
+  801228:	48 b8 e1 11 80 00 00 	movabs $0x8011e1,%rax
+  80122f:	00 00 00 
+  801232:	ff d0                	call   *%rax
+  801234:	84 c0                	test   %al,%al
+  801236:	75 4b                	jne    801283 <bc_track+0x66>
+  801238:	48 a1 58 01 84 00 00 	movabs 0x840158,%rax
+  80123f:	00 00 00 
+  801242:	48 85 c0             	test   %rax,%rax
+  801245:	74 3c                	je     801283 <bc_track+0x66>
+
+    struct bc_slot *s = &bc_slots[bc_free_slots[--bc_nfree]];
+  801247:	48 83 e8 01          	sub    $0x1,%rax
+  80124b:	48 a3 58 01 84 00 00 	movabs %rax,0x840158
+  801252:	00 00 00 
+    s->bs_blockno = blockno;
+  801255:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  80125c:	00 00 00 
+  80125f:	48 b9 60 01 84 00 00 	movabs $0x840160,%rcx
+  801266:	00 00 00 
+  801269:	8b 04 81             	mov    (%rcx,%rax,4),%eax
+  80126c:	89 1c c2             	mov    %ebx,(%rdx,%rax,8)
+    s->bs_ref = 1;
+  80126f:	c6 44 c2 04 01       	movb   $0x1,0x4(%rdx,%rax,8)
+    bc_cache_stat.cs_resident++;
+  801274:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  80127b:	00 00 00 
+  80127e:	48 83 40 20 01       	addq   $0x1,0x20(%rax)
+}
+  801283:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801287:	c9                   	leave
+  801288:	c3                   	ret
+
+0000000000801289 <bc_untrack>:
+
+static void
+bc_untrack(struct bc_slot *s) {
+    bc_free_slots[bc_nfree++] = s - bc_slots;
+  801289:	48 b8 58 01 84 00 00 	movabs $0x840158,%rax
+  801290:	00 00 00 
+  801293:	48 8b 10             	mov    (%rax),%rdx
+  801296:	48 8d 4a 01          	lea    0x1(%rdx),%rcx
+  80129a:	48 89 08             	mov    %rcx,(%rax)
+  80129d:	48 b9 60 41 84 00 00 	movabs $0x844160,%rcx
+  8012a4:	00 00 00 
+  8012a7:	48 89 f8             	mov    %rdi,%rax
+  8012aa:	48 29 c8             	sub    %rcx,%rax
+  8012ad:	48 c1 f8 03          	sar    $0x3,%rax
+  8012b1:	48 b9 60 01 84 00 00 	movabs $0x840160,%rcx
+  8012b8:	00 00 00 
+  8012bb:	89 04 91             	mov    %eax,(%rcx,%rdx,4)
+    s->bs_blockno = 0;
+  8012be:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    bc_cache_stat.cs_resident--;
+  8012c4:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  8012cb:	00 00 00 
+  8012ce:	48 83 68 20 01       	subq   $0x1,0x20(%rax)
+}
+  8012d3:	c3                   	ret
+
+00000000008012d4 <bc_present>:
+bc_present(blockno_t blockno) {
+  8012d4:	55                   	push   %rbp
+  8012d5:	48 89 e5             	mov    %rsp,%rbp
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8012d8:	89 ff                	mov    %edi,%edi
+  8012da:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  8012e1:	48 c1 e7 0c          	shl    $0xc,%rdi
+    return is_page_present(bc_addr(blockno));
+  8012e5:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+}
+  8012f1:	5d                   	pop    %rbp
+  8012f2:	c3                   	ret
+
+00000000008012f3 <bc_ra_complete>:
+/* Complete the readahead in flight and map its blocks into the cache,
+ * sleeping until the data is there if wait is set. Returns -E_AGAIN
+ * if the read is not done and wait is not set */
+static int
+bc_ra_complete(bool wait) {
+    if (!bc_ra.n) return 0;
+  8012f3:	48 b8 40 01 84 00 00 	movabs $0x840140,%rax
+  8012fa:	00 00 00 
+  8012fd:	48 83 78 08 00       	cmpq   $0x0,0x8(%rax)
+  801302:	0f 84 0e 01 00 00    	je     801416 <bc_ra_complete+0x123>
+bc_ra_complete(bool wait) {
+  801308:	55                   	push   %rbp
+  801309:	48 89 e5             	mov    %rsp,%rbp
+  80130c:	41 56                	push   %r14
+  80130e:	41 55                	push   %r13
+  801310:	41 54                	push   %r12
+  801312:	53                   	push   %rbx
+
+    int res = disk->finish(wait);
+  801313:	40 0f b6 ff          	movzbl %dil,%edi
+  801317:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  80131e:	00 00 00 
+  801321:	ff 50 20             	call   *0x20(%rax)
+    if (res == -E_AGAIN) return res;
+  801324:	83 f8 ec             	cmp    $0xffffffec,%eax
+  801327:	0f 84 b3 00 00 00    	je     8013e0 <bc_ra_complete+0xed>
+
+    /* Blocks of a failed read are left to fault in again */
+    if (res >= 0) {
+  80132d:	85 c0                	test   %eax,%eax
+  80132f:	78 7a                	js     8013ab <bc_ra_complete+0xb8>
+        res = sys_map_region(CURENVID, (void *)BC_RA_VA, CURENVID, bc_addr(bc_ra.start), bc_ra.n * BLKSIZE, PROT_RW);
+  801331:	48 b8 40 01 84 00 00 	movabs $0x840140,%rax
+  801338:	00 00 00 
+  80133b:	4c 8b 40 08          	mov    0x8(%rax),%r8
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80133f:	8b 08                	mov    (%rax),%ecx
+  801341:	48 81 c1 00 00 01 00 	add    $0x10000,%rcx
+  801348:	48 c1 e1 0c          	shl    $0xc,%rcx
+        res = sys_map_region(CURENVID, (void *)BC_RA_VA, CURENVID, bc_addr(bc_ra.start), bc_ra.n * BLKSIZE, PROT_RW);
+  80134c:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  801352:	49 c1 e0 0c          	shl    $0xc,%r8
+  801356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135b:	be 00 00 00 0d       	mov    $0xd000000,%esi
+  801360:	bf 00 00 00 00       	mov    $0x0,%edi
+  801365:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  80136c:	00 00 00 
+  80136f:	ff d0                	call   *%rax
+        if (res < 0) panic("bc_ra_complete.sys_map_region failed: %i\n", res);
+  801371:	85 c0                	test   %eax,%eax
+  801373:	78 74                	js     8013e9 <bc_ra_complete+0xf6>
+        for (size_t i = 0; i < bc_ra.n; i++)
+  801375:	48 b8 48 01 84 00 00 	movabs $0x840148,%rax
+  80137c:	00 00 00 
+  80137f:	4c 8b 20             	mov    (%rax),%r12
+  801382:	bb 00 00 00 00       	mov    $0x0,%ebx
+            bc_track(bc_ra.start + i);
+  801387:	4c 8d 70 f8          	lea    -0x8(%rax),%r14
+  80138b:	49 bd 1d 12 80 00 00 	movabs $0x80121d,%r13
+  801392:	00 00 00 
+        for (size_t i = 0; i < bc_ra.n; i++)
+  801395:	4d 85 e4             	test   %r12,%r12
+  801398:	74 11                	je     8013ab <bc_ra_complete+0xb8>
+            bc_track(bc_ra.start + i);
+  80139a:	89 df                	mov    %ebx,%edi
+  80139c:	41 03 3e             	add    (%r14),%edi
+  80139f:	41 ff d5             	call   *%r13
+        for (size_t i = 0; i < bc_ra.n; i++)
+  8013a2:	48 83 c3 01          	add    $0x1,%rbx
+  8013a6:	4c 39 e3             	cmp    %r12,%rbx
+  8013a9:	75 ef                	jne    80139a <bc_ra_complete+0xa7>
+    }
+    sys_unmap_region(CURENVID, (void *)BC_RA_VA, bc_ra.n * BLKSIZE);
+  8013ab:	48 bb 40 01 84 00 00 	movabs $0x840140,%rbx
+  8013b2:	00 00 00 
+  8013b5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8013b9:	48 c1 e2 0c          	shl    $0xc,%rdx
+  8013bd:	be 00 00 00 0d       	mov    $0xd000000,%esi
+  8013c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013c7:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8013ce:	00 00 00 
+  8013d1:	ff d0                	call   *%rax
+    bc_ra.n = 0;
+  8013d3:	48 c7 43 08 00 00 00 	movq   $0x0,0x8(%rbx)
+  8013da:	00 
+    return 0;
+  8013db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8013e0:	5b                   	pop    %rbx
+  8013e1:	41 5c                	pop    %r12
+  8013e3:	41 5d                	pop    %r13
+  8013e5:	41 5e                	pop    %r14
+  8013e7:	5d                   	pop    %rbp
+  8013e8:	c3                   	ret
+        if (res < 0) panic("bc_ra_complete.sys_map_region failed: %i\n", res);
+  8013e9:	89 c1                	mov    %eax,%ecx
+  8013eb:	48 ba 10 bd 80 00 00 	movabs $0x80bd10,%rdx
+  8013f2:	00 00 00 
+  8013f5:	be c1 00 00 00       	mov    $0xc1,%esi
+  8013fa:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801401:	00 00 00 
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  801410:	00 00 00 
+  801413:	41 ff d0             	call   *%r8
+    if (!bc_ra.n) return 0;
+  801416:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80141b:	c3                   	ret
+
+000000000080141c <bc_write_run>:
+}
+
+/* Write out the run of dirty blocks queued by flush_block_deferred() */
+static void
+bc_write_run(void) {
+    if (!bc_wrun.n) return;
+  80141c:	48 b8 00 71 82 00 00 	movabs $0x827100,%rax
+  801423:	00 00 00 
+  801426:	48 83 78 08 00       	cmpq   $0x0,0x8(%rax)
+  80142b:	75 01                	jne    80142e <bc_write_run+0x12>
+  80142d:	c3                   	ret
+bc_write_run(void) {
+  80142e:	55                   	push   %rbp
+  80142f:	48 89 e5             	mov    %rsp,%rbp
+    bc_ra_complete(1);
+  801432:	bf 01 00 00 00       	mov    $0x1,%edi
+  801437:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  80143e:	00 00 00 
+  801441:	ff d0                	call   *%rax
+
+    int res = disk->write(bc_wrun.start * BLKSECTS, bc_addr(bc_wrun.start), bc_wrun.n * BLKSECTS);
+  801443:	48 b8 00 71 82 00 00 	movabs $0x827100,%rax
+  80144a:	00 00 00 
+  80144d:	8b 38                	mov    (%rax),%edi
+  80144f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  801453:	48 c1 e2 03          	shl    $0x3,%rdx
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  801457:	89 fe                	mov    %edi,%esi
+  801459:	48 81 c6 00 00 01 00 	add    $0x10000,%rsi
+  801460:	48 c1 e6 0c          	shl    $0xc,%rsi
+    int res = disk->write(bc_wrun.start * BLKSECTS, bc_addr(bc_wrun.start), bc_wrun.n * BLKSECTS);
+  801464:	c1 e7 03             	shl    $0x3,%edi
+  801467:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  80146e:	00 00 00 
+  801471:	ff 50 10             	call   *0x10(%rax)
+    if (res < 0) panic("flush_block: disk write failed: %i\n", res);
+  801474:	85 c0                	test   %eax,%eax
+  801476:	78 2b                	js     8014a3 <bc_write_run+0x87>
+
+    bc_stat.ds_writes++;
+  801478:	48 b8 e0 30 82 00 00 	movabs $0x8230e0,%rax
+  80147f:	00 00 00 
+  801482:	48 83 40 10 01       	addq   $0x1,0x10(%rax)
+    bc_stat.ds_write_blocks += bc_wrun.n;
+  801487:	48 ba 00 71 82 00 00 	movabs $0x827100,%rdx
+  80148e:	00 00 00 
+  801491:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  801495:	48 01 48 18          	add    %rcx,0x18(%rax)
+    bc_wrun.n = 0;
+  801499:	48 c7 42 08 00 00 00 	movq   $0x0,0x8(%rdx)
+  8014a0:	00 
+}
+  8014a1:	5d                   	pop    %rbp
+  8014a2:	c3                   	ret
+    if (res < 0) panic("flush_block: disk write failed: %i\n", res);
+  8014a3:	89 c1                	mov    %eax,%ecx
+  8014a5:	48 ba 40 bd 80 00 00 	movabs $0x80bd40,%rdx
+  8014ac:	00 00 00 
+  8014af:	be 82 01 00 00       	mov    $0x182,%esi
+  8014b4:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  8014bb:	00 00 00 
+  8014be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c3:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8014ca:	00 00 00 
+  8014cd:	41 ff d0             	call   *%r8
+
+00000000008014d0 <diskaddr>:
+diskaddr(uint32_t blockno) {
+  8014d0:	55                   	push   %rbp
+  8014d1:	48 89 e5             	mov    %rsp,%rbp
+  8014d4:	53                   	push   %rbx
+  8014d5:	48 83 ec 08          	sub    $0x8,%rsp
+    if (blockno == 0 || (super && blockno >= super->s_nblocks))
+  8014d9:	85 ff                	test   %edi,%edi
+  8014db:	74 48                	je     801525 <diskaddr+0x55>
+  8014dd:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  8014e4:	00 00 00 
+  8014e7:	48 85 c0             	test   %rax,%rax
+  8014ea:	74 05                	je     8014f1 <diskaddr+0x21>
+  8014ec:	3b 78 04             	cmp    0x4(%rax),%edi
+  8014ef:	73 34                	jae    801525 <diskaddr+0x55>
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8014f1:	89 fb                	mov    %edi,%ebx
+  8014f3:	48 81 c3 00 00 01 00 	add    $0x10000,%rbx
+  8014fa:	48 c1 e3 0c          	shl    $0xc,%rbx
+    if (bc_present(blockno)) bc_cache_stat.cs_hits++;
+  8014fe:	48 b8 d4 12 80 00 00 	movabs $0x8012d4,%rax
+  801505:	00 00 00 
+  801508:	ff d0                	call   *%rax
+  80150a:	84 c0                	test   %al,%al
+  80150c:	74 0e                	je     80151c <diskaddr+0x4c>
+  80150e:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  801515:	00 00 00 
+  801518:	48 83 00 01          	addq   $0x1,(%rax)
+}
+  80151c:	48 89 d8             	mov    %rbx,%rax
+  80151f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801523:	c9                   	leave
+  801524:	c3                   	ret
+        panic("bad block number %08x in diskaddr", blockno);
+  801525:	89 f9                	mov    %edi,%ecx
+  801527:	48 ba 68 bd 80 00 00 	movabs $0x80bd68,%rdx
+  80152e:	00 00 00 
+  801531:	be 4e 00 00 00       	mov    $0x4e,%esi
+  801536:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  80153d:	00 00 00 
+  801540:	b8 00 00 00 00       	mov    $0x0,%eax
+  801545:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80154c:	00 00 00 
+  80154f:	41 ff d0             	call   *%r8
+
+0000000000801552 <bc_busy>:
+bc_busy(void) {
+  801552:	55                   	push   %rbp
+  801553:	48 89 e5             	mov    %rsp,%rbp
+    return bc_ra_complete(0) == -E_AGAIN;
+  801556:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155b:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  801562:	00 00 00 
+  801565:	ff d0                	call   *%rax
+  801567:	83 f8 ec             	cmp    $0xffffffec,%eax
+  80156a:	0f 94 c0             	sete   %al
+}
+  80156d:	5d                   	pop    %rbp
+  80156e:	c3                   	ret
+
+000000000080156f <flush_block_deferred>:
+ * to the system call ring, so flushing of many blocks costs a single
+ * kernel entry. Blocks flushed in ascending order are also written
+ * with a single disk command. The block must not be modified before
+ * flush_commit(), otherwise the modification is lost. */
+void
+flush_block_deferred(void *addr) {
+  80156f:	55                   	push   %rbp
+  801570:	48 89 e5             	mov    %rsp,%rbp
+  801573:	41 54                	push   %r12
+  801575:	53                   	push   %rbx
+  801576:	48 89 fb             	mov    %rdi,%rbx
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  801579:	48 8d 87 00 00 00 f0 	lea    -0x10000000(%rdi),%rax
+  801580:	49 89 c4             	mov    %rax,%r12
+  801583:	49 c1 ec 0c          	shr    $0xc,%r12
+
+    if (addr < (void *)(uintptr_t)DISKMAP || addr >= (void *)(uintptr_t)(DISKMAP + DISKSIZE))
+  801587:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  80158c:	48 39 c2             	cmp    %rax,%rdx
+  80158f:	72 3f                	jb     8015d0 <flush_block_deferred+0x61>
+  801591:	44 89 e1             	mov    %r12d,%ecx
+        panic("flush_block of bad va %p", addr);
+    if (blockno && super && blockno >= super->s_nblocks)
+  801594:	45 85 e4             	test   %r12d,%r12d
+  801597:	74 18                	je     8015b1 <flush_block_deferred+0x42>
+  801599:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  8015a0:	00 00 00 
+  8015a3:	48 85 c0             	test   %rax,%rax
+  8015a6:	74 09                	je     8015b1 <flush_block_deferred+0x42>
+  8015a8:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  8015ac:	45 39 c4             	cmp    %r8d,%r12d
+  8015af:	73 4d                	jae    8015fe <flush_block_deferred+0x8f>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+
+    // LAB 10: Your code here.
+	addr = ROUNDDOWN(addr, PAGE_SIZE);
+  8015b1:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+    if (!is_page_present(addr) || !is_page_dirty(addr)) {
+  8015b8:	48 89 df             	mov    %rbx,%rdi
+  8015bb:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  8015c2:	00 00 00 
+  8015c5:	ff d0                	call   *%rax
+  8015c7:	84 c0                	test   %al,%al
+  8015c9:	75 5e                	jne    801629 <flush_block_deferred+0xba>
+        bc_write_run();
+    if (!bc_wrun.n) bc_wrun.start = blockno;
+    bc_wrun.n++;
+
+    scring_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
+}
+  8015cb:	5b                   	pop    %rbx
+  8015cc:	41 5c                	pop    %r12
+  8015ce:	5d                   	pop    %rbp
+  8015cf:	c3                   	ret
+        panic("flush_block of bad va %p", addr);
+  8015d0:	48 89 f9             	mov    %rdi,%rcx
+  8015d3:	48 ba f4 be 80 00 00 	movabs $0x80bef4,%rdx
+  8015da:	00 00 00 
+  8015dd:	be 93 01 00 00       	mov    $0x193,%esi
+  8015e2:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  8015e9:	00 00 00 
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f1:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8015f8:	00 00 00 
+  8015fb:	41 ff d0             	call   *%r8
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  8015fe:	48 ba 90 bd 80 00 00 	movabs $0x80bd90,%rdx
+  801605:	00 00 00 
+  801608:	be 95 01 00 00       	mov    $0x195,%esi
+  80160d:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801614:	00 00 00 
+  801617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161c:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  801623:	00 00 00 
+  801626:	41 ff d1             	call   *%r9
+    if (!is_page_present(addr) || !is_page_dirty(addr)) {
+  801629:	48 89 df             	mov    %rbx,%rdi
+  80162c:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  801633:	00 00 00 
+  801636:	ff d0                	call   *%rax
+  801638:	84 c0                	test   %al,%al
+  80163a:	74 8f                	je     8015cb <flush_block_deferred+0x5c>
+    if (bc_wrun.n && (blockno != bc_wrun.start + bc_wrun.n || bc_wrun.n == BC_MAX_RUN))
+  80163c:	48 a1 08 71 82 00 00 	movabs 0x827108,%rax
+  801643:	00 00 00 
+  801646:	48 85 c0             	test   %rax,%rax
+  801649:	74 38                	je     801683 <flush_block_deferred+0x114>
+  80164b:	48 ba 00 71 82 00 00 	movabs $0x827100,%rdx
+  801652:	00 00 00 
+  801655:	8b 12                	mov    (%rdx),%edx
+  801657:	48 01 c2             	add    %rax,%rdx
+  80165a:	44 89 e1             	mov    %r12d,%ecx
+  80165d:	48 39 ca             	cmp    %rcx,%rdx
+  801660:	75 06                	jne    801668 <flush_block_deferred+0xf9>
+  801662:	48 83 f8 20          	cmp    $0x20,%rax
+  801666:	75 2c                	jne    801694 <flush_block_deferred+0x125>
+        bc_write_run();
+  801668:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  80166f:	00 00 00 
+  801672:	ff d0                	call   *%rax
+    if (!bc_wrun.n) bc_wrun.start = blockno;
+  801674:	48 a1 08 71 82 00 00 	movabs 0x827108,%rax
+  80167b:	00 00 00 
+  80167e:	48 85 c0             	test   %rax,%rax
+  801681:	75 11                	jne    801694 <flush_block_deferred+0x125>
+  801683:	44 89 e0             	mov    %r12d,%eax
+  801686:	a3 00 71 82 00 00 00 	movabs %eax,0x827100
+  80168d:	00 00 
+  80168f:	b8 00 00 00 00       	mov    $0x0,%eax
+    bc_wrun.n++;
+  801694:	48 83 c0 01          	add    $0x1,%rax
+  801698:	48 a3 08 71 82 00 00 	movabs %rax,0x827108
+  80169f:	00 00 00 
+    scring_map_region(CURENVID, addr, CURENVID, addr, PAGE_SIZE, get_prot(addr));
+  8016a2:	48 89 df             	mov    %rbx,%rdi
+  8016a5:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  8016ac:	00 00 00 
+  8016af:	ff d0                	call   *%rax
+  8016b1:	41 89 c1             	mov    %eax,%r9d
+  8016b4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8016ba:	48 89 d9             	mov    %rbx,%rcx
+  8016bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c2:	48 89 de             	mov    %rbx,%rsi
+  8016c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016ca:	48 b8 4e b7 80 00 00 	movabs $0x80b74e,%rax
+  8016d1:	00 00 00 
+  8016d4:	ff d0                	call   *%rax
+  8016d6:	e9 f0 fe ff ff       	jmp    8015cb <flush_block_deferred+0x5c>
+
+00000000008016db <bc_mark_dirty>:
+
+/* Note that the block containing addr has been modified,
+ * so that the next writeback writes it out */
+void
+bc_mark_dirty(void *addr) {
+    blockno_t blockno = ((uintptr_t)addr - DISKMAP) / BLKSIZE;
+  8016db:	48 8d 8f 00 00 00 f0 	lea    -0x10000000(%rdi),%rcx
+
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return;
+  8016e2:	b8 ff ff ff bf       	mov    $0xbfffffff,%eax
+  8016e7:	48 39 c8             	cmp    %rcx,%rax
+  8016ea:	72 66                	jb     801752 <bc_mark_dirty+0x77>
+    blockno_t blockno = ((uintptr_t)addr - DISKMAP) / BLKSIZE;
+  8016ec:	48 c1 e9 0c          	shr    $0xc,%rcx
+    if (TSTBIT(bc_dirty_map, blockno)) return;
+  8016f0:	89 ce                	mov    %ecx,%esi
+  8016f2:	c1 ee 05             	shr    $0x5,%esi
+  8016f5:	89 f2                	mov    %esi,%edx
+  8016f7:	48 b8 20 71 82 00 00 	movabs $0x827120,%rax
+  8016fe:	00 00 00 
+  801701:	8b 3c 90             	mov    (%rax,%rdx,4),%edi
+  801704:	ba 01 00 00 00       	mov    $0x1,%edx
+  801709:	d3 e2                	shl    %cl,%edx
+  80170b:	85 d7                	test   %edx,%edi
+  80170d:	75 43                	jne    801752 <bc_mark_dirty+0x77>
+    if (bc_ndirty == BC_DIRTY_MAX) {
+  80170f:	48 b8 20 f1 83 00 00 	movabs $0x83f120,%rax
+  801716:	00 00 00 
+  801719:	4c 8b 00             	mov    (%rax),%r8
+  80171c:	49 81 f8 00 04 00 00 	cmp    $0x400,%r8
+  801723:	74 2e                	je     801753 <bc_mark_dirty+0x78>
+        bc_dirty_overflow = 1;
+        return;
+    }
+    SETBIT(bc_dirty_map, blockno);
+  801725:	89 f6                	mov    %esi,%esi
+  801727:	09 d7                	or     %edx,%edi
+  801729:	48 b8 20 71 82 00 00 	movabs $0x827120,%rax
+  801730:	00 00 00 
+  801733:	89 3c b0             	mov    %edi,(%rax,%rsi,4)
+    bc_dirty_list[bc_ndirty++] = blockno;
+  801736:	49 8d 40 01          	lea    0x1(%r8),%rax
+  80173a:	48 a3 20 f1 83 00 00 	movabs %rax,0x83f120
+  801741:	00 00 00 
+  801744:	48 b8 40 f1 83 00 00 	movabs $0x83f140,%rax
+  80174b:	00 00 00 
+  80174e:	42 89 0c 80          	mov    %ecx,(%rax,%r8,4)
+}
+  801752:	c3                   	ret
+        bc_dirty_overflow = 1;
+  801753:	48 b8 18 71 82 00 00 	movabs $0x827118,%rax
+  80175a:	00 00 00 
+  80175d:	c6 00 01             	movb   $0x1,(%rax)
+        return;
+  801760:	c3                   	ret
+
+0000000000801761 <flush_commit>:
+}
+
+/* Write out blocks flushed by flush_block_deferred()
+ * and clear their dirty bits */
+void
+flush_commit(void) {
+  801761:	55                   	push   %rbp
+  801762:	48 89 e5             	mov    %rsp,%rbp
+    bc_write_run();
+  801765:	48 b8 1c 14 80 00 00 	movabs $0x80141c,%rax
+  80176c:	00 00 00 
+  80176f:	ff d0                	call   *%rax
+
+    int res = scring_submit();
+  801771:	48 b8 ac b6 80 00 00 	movabs $0x80b6ac,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+    if (res < 0) {
+  80177d:	85 c0                	test   %eax,%eax
+  80177f:	78 02                	js     801783 <flush_commit+0x22>
+        panic("flush_block.sys_map_region failed: %i\n", res);
+    }
+}
+  801781:	5d                   	pop    %rbp
+  801782:	c3                   	ret
+        panic("flush_block.sys_map_region failed: %i\n", res);
+  801783:	89 c1                	mov    %eax,%ecx
+  801785:	48 ba c0 bd 80 00 00 	movabs $0x80bdc0,%rdx
+  80178c:	00 00 00 
+  80178f:	be 19 02 00 00       	mov    $0x219,%esi
+  801794:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  80179b:	00 00 00 
+  80179e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a3:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8017aa:	00 00 00 
+  8017ad:	41 ff d0             	call   *%r8
+
+00000000008017b0 <bc_unmap_victims>:
+bc_unmap_victims(blockno_t *victims, size_t n) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+  8017b4:	41 56                	push   %r14
+  8017b6:	41 55                	push   %r13
+  8017b8:	41 54                	push   %r12
+  8017ba:	53                   	push   %rbx
+  8017bb:	49 89 fd             	mov    %rdi,%r13
+  8017be:	49 89 f4             	mov    %rsi,%r12
+    flush_commit();
+  8017c1:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8017c8:	00 00 00 
+  8017cb:	ff d0                	call   *%rax
+    for (size_t i = 0; i < n; i++)
+  8017cd:	4d 85 e4             	test   %r12,%r12
+  8017d0:	74 35                	je     801807 <bc_unmap_victims+0x57>
+  8017d2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        scring_unmap_region(CURENVID, bc_addr(victims[i]), BLKSIZE);
+  8017d7:	49 be 87 b7 80 00 00 	movabs $0x80b787,%r14
+  8017de:	00 00 00 
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8017e1:	41 8b 74 9d 00       	mov    0x0(%r13,%rbx,4),%esi
+  8017e6:	48 81 c6 00 00 01 00 	add    $0x10000,%rsi
+  8017ed:	48 c1 e6 0c          	shl    $0xc,%rsi
+        scring_unmap_region(CURENVID, bc_addr(victims[i]), BLKSIZE);
+  8017f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017fb:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < n; i++)
+  8017fe:	48 83 c3 01          	add    $0x1,%rbx
+  801802:	49 39 dc             	cmp    %rbx,%r12
+  801805:	75 da                	jne    8017e1 <bc_unmap_victims+0x31>
+    flush_commit();
+  801807:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  80180e:	00 00 00 
+  801811:	ff d0                	call   *%rax
+}
+  801813:	5b                   	pop    %rbx
+  801814:	41 5c                	pop    %r12
+  801816:	41 5d                	pop    %r13
+  801818:	41 5e                	pop    %r14
+  80181a:	5d                   	pop    %rbp
+  80181b:	c3                   	ret
+
+000000000080181c <bc_evict>:
+bc_evict(size_t need) {
+  80181c:	55                   	push   %rbp
+  80181d:	48 89 e5             	mov    %rsp,%rbp
+  801820:	41 57                	push   %r15
+  801822:	41 56                	push   %r14
+  801824:	41 55                	push   %r13
+  801826:	41 54                	push   %r12
+  801828:	53                   	push   %rbx
+  801829:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+  801830:	48 89 bd 48 ff ff ff 	mov    %rdi,-0xb8(%rbp)
+    size_t reserved = bc_cache_stat.cs_resident + bc_ra.n;
+  801837:	48 b8 c0 30 82 00 00 	movabs $0x8230c0,%rax
+  80183e:	00 00 00 
+  801841:	48 8b 10             	mov    (%rax),%rdx
+  801844:	48 a1 48 01 84 00 00 	movabs 0x840148,%rax
+  80184b:	00 00 00 
+  80184e:	48 01 c2             	add    %rax,%rdx
+    if (reserved + need <= BC_MAX_BLOCKS) return;
+  801851:	48 01 fa             	add    %rdi,%rdx
+  801854:	48 81 fa 00 10 00 00 	cmp    $0x1000,%rdx
+  80185b:	77 12                	ja     80186f <bc_evict+0x53>
+}
+  80185d:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  801864:	5b                   	pop    %rbx
+  801865:	41 5c                	pop    %r12
+  801867:	41 5d                	pop    %r13
+  801869:	41 5e                	pop    %r14
+  80186b:	41 5f                	pop    %r15
+  80186d:	5d                   	pop    %rbp
+  80186e:	c3                   	ret
+    flush_commit();
+  80186f:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+    for (size_t step = 1; step <= 3 * BC_MAX_BLOCKS; step++) {
+  80187b:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+    size_t nvictims = 0;
+  801881:	48 c7 85 30 ff ff ff 	movq   $0x0,-0xd0(%rbp)
+  801888:	00 00 00 00 
+        if (bc_cache_stat.cs_resident + bc_ra.n + need <= BC_MAX_BLOCKS) break;
+  80188c:	49 be a0 30 82 00 00 	movabs $0x8230a0,%r14
+  801893:	00 00 00 
+  801896:	49 bf 40 01 84 00 00 	movabs $0x840140,%r15
+  80189d:	00 00 00 
+        struct bc_slot *s = &bc_slots[bc_hand];
+  8018a0:	49 bd 50 01 84 00 00 	movabs $0x840150,%r13
+  8018a7:	00 00 00 
+  8018aa:	e9 c1 00 00 00       	jmp    801970 <bc_evict+0x154>
+        if (!(step % BC_MAX_BLOCKS)) flush_commit();
+  8018af:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8018b6:	00 00 00 
+  8018b9:	ff d0                	call   *%rax
+  8018bb:	e9 db 00 00 00       	jmp    80199b <bc_evict+0x17f>
+            bc_untrack(s);
+  8018c0:	48 8b bd 40 ff ff ff 	mov    -0xc0(%rbp),%rdi
+  8018c7:	48 b8 89 12 80 00 00 	movabs $0x801289,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+            continue;
+  8018d3:	e9 87 00 00 00       	jmp    80195f <bc_evict+0x143>
+            s->bs_ref = 0;
+  8018d8:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  8018df:	00 00 00 
+  8018e2:	c6 44 da 04 00       	movb   $0x0,0x4(%rdx,%rbx,8)
+            if (pte & PTE_D)
+  8018e7:	a8 40                	test   $0x40,%al
+  8018e9:	75 09                	jne    8018f4 <bc_evict+0xd8>
+            else if (pte & PTE_A)
+  8018eb:	a8 20                	test   $0x20,%al
+  8018ed:	74 70                	je     80195f <bc_evict+0x143>
+  8018ef:	e9 9e 01 00 00       	jmp    801a92 <bc_evict+0x276>
+                flush_block_deferred(addr);
+  8018f4:	48 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%rdi
+  8018fb:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+  801907:	eb 56                	jmp    80195f <bc_evict+0x143>
+        victims[nvictims++] = s->bs_blockno;
+  801909:	48 8b bd 30 ff ff ff 	mov    -0xd0(%rbp),%rdi
+  801910:	48 8d 47 01          	lea    0x1(%rdi),%rax
+  801914:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+  80191b:	48 b8 60 41 84 00 00 	movabs $0x844160,%rax
+  801922:	00 00 00 
+  801925:	8b 04 d8             	mov    (%rax,%rbx,8),%eax
+  801928:	89 84 bd 50 ff ff ff 	mov    %eax,-0xb0(%rbp,%rdi,4)
+        bc_untrack(s);
+  80192f:	48 8b bd 40 ff ff ff 	mov    -0xc0(%rbp),%rdi
+  801936:	48 b8 89 12 80 00 00 	movabs $0x801289,%rax
+  80193d:	00 00 00 
+  801940:	ff d0                	call   *%rax
+        bc_cache_stat.cs_evictions++;
+  801942:	49 83 46 18 01       	addq   $0x1,0x18(%r14)
+        victims[nvictims++] = s->bs_blockno;
+  801947:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  80194e:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+        if (nvictims == BC_MAX_RUN) {
+  801955:	48 83 f8 20          	cmp    $0x20,%rax
+  801959:	0f 84 e1 00 00 00    	je     801a40 <bc_evict+0x224>
+    for (size_t step = 1; step <= 3 * BC_MAX_BLOCKS; step++) {
+  80195f:	49 83 c4 01          	add    $0x1,%r12
+  801963:	49 81 fc 01 30 00 00 	cmp    $0x3001,%r12
+  80196a:	0f 84 fb 00 00 00    	je     801a6b <bc_evict+0x24f>
+        if (bc_cache_stat.cs_resident + bc_ra.n + need <= BC_MAX_BLOCKS) break;
+  801970:	49 8b 47 08          	mov    0x8(%r15),%rax
+  801974:	49 03 46 20          	add    0x20(%r14),%rax
+  801978:	48 8b 8d 48 ff ff ff 	mov    -0xb8(%rbp),%rcx
+  80197f:	48 01 c8             	add    %rcx,%rax
+  801982:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  801988:	0f 86 dd 00 00 00    	jbe    801a6b <bc_evict+0x24f>
+        if (!(step % BC_MAX_BLOCKS)) flush_commit();
+  80198e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801995:	0f 84 14 ff ff ff    	je     8018af <bc_evict+0x93>
+        struct bc_slot *s = &bc_slots[bc_hand];
+  80199b:	49 8b 5d 00          	mov    0x0(%r13),%rbx
+        bc_hand = (bc_hand + 1) % BC_MAX_BLOCKS;
+  80199f:	48 8d 43 01          	lea    0x1(%rbx),%rax
+  8019a3:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8019a8:	49 89 45 00          	mov    %rax,0x0(%r13)
+        if (!s->bs_blockno) continue;
+  8019ac:	48 b8 60 41 84 00 00 	movabs $0x844160,%rax
+  8019b3:	00 00 00 
+  8019b6:	8b 04 d8             	mov    (%rax,%rbx,8),%eax
+  8019b9:	85 c0                	test   %eax,%eax
+  8019bb:	74 a2                	je     80195f <bc_evict+0x143>
+        struct bc_slot *s = &bc_slots[bc_hand];
+  8019bd:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  8019c4:	00 00 00 
+  8019c7:	48 8d 34 da          	lea    (%rdx,%rbx,8),%rsi
+  8019cb:	48 89 b5 40 ff ff ff 	mov    %rsi,-0xc0(%rbp)
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8019d2:	89 c0                	mov    %eax,%eax
+  8019d4:	48 05 00 00 01 00    	add    $0x10000,%rax
+  8019da:	48 c1 e0 0c          	shl    $0xc,%rax
+  8019de:	48 89 85 38 ff ff ff 	mov    %rax,-0xc8(%rbp)
+        pte_t pte = get_uvpt_entry(addr);
+  8019e5:	48 89 c7             	mov    %rax,%rdi
+  8019e8:	48 b8 25 b3 80 00 00 	movabs $0x80b325,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+        if (!(pte & PTE_P)) {
+  8019f4:	a8 01                	test   $0x1,%al
+  8019f6:	0f 84 c4 fe ff ff    	je     8018c0 <bc_evict+0xa4>
+        if (s->bs_ref || (pte & PTE_A)) {
+  8019fc:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  801a03:	00 00 00 
+  801a06:	80 7c da 04 00       	cmpb   $0x0,0x4(%rdx,%rbx,8)
+  801a0b:	0f 85 c7 fe ff ff    	jne    8018d8 <bc_evict+0xbc>
+  801a11:	48 89 c6             	mov    %rax,%rsi
+  801a14:	83 e6 20             	and    $0x20,%esi
+  801a17:	48 89 b5 28 ff ff ff 	mov    %rsi,-0xd8(%rbp)
+  801a1e:	75 6a                	jne    801a8a <bc_evict+0x26e>
+        if (pte & PTE_D) flush_block_deferred(addr);
+  801a20:	a8 40                	test   $0x40,%al
+  801a22:	0f 84 e1 fe ff ff    	je     801909 <bc_evict+0xed>
+  801a28:	48 8b bd 38 ff ff ff 	mov    -0xc8(%rbp),%rdi
+  801a2f:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  801a36:	00 00 00 
+  801a39:	ff d0                	call   *%rax
+  801a3b:	e9 c9 fe ff ff       	jmp    801909 <bc_evict+0xed>
+            bc_unmap_victims(victims, nvictims);
+  801a40:	be 20 00 00 00       	mov    $0x20,%esi
+  801a45:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a4c:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801a53:	00 00 00 
+  801a56:	ff d0                	call   *%rax
+            nvictims = 0;
+  801a58:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  801a5f:	48 89 85 30 ff ff ff 	mov    %rax,-0xd0(%rbp)
+  801a66:	e9 f4 fe ff ff       	jmp    80195f <bc_evict+0x143>
+    bc_unmap_victims(victims, nvictims);
+  801a6b:	48 8b b5 30 ff ff ff 	mov    -0xd0(%rbp),%rsi
+  801a72:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  801a79:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801a80:	00 00 00 
+  801a83:	ff d0                	call   *%rax
+  801a85:	e9 d3 fd ff ff       	jmp    80185d <bc_evict+0x41>
+            if (pte & PTE_D)
+  801a8a:	a8 40                	test   $0x40,%al
+  801a8c:	0f 85 62 fe ff ff    	jne    8018f4 <bc_evict+0xd8>
+                scring_map_region(CURENVID, addr, CURENVID, addr, BLKSIZE, get_prot(addr));
+  801a92:	48 8b 9d 38 ff ff ff 	mov    -0xc8(%rbp),%rbx
+  801a99:	48 89 df             	mov    %rbx,%rdi
+  801a9c:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  801aa3:	00 00 00 
+  801aa6:	ff d0                	call   *%rax
+  801aa8:	41 89 c1             	mov    %eax,%r9d
+  801aab:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ab1:	48 89 d9             	mov    %rbx,%rcx
+  801ab4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab9:	48 89 de             	mov    %rbx,%rsi
+  801abc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac1:	48 b8 4e b7 80 00 00 	movabs $0x80b74e,%rax
+  801ac8:	00 00 00 
+  801acb:	ff d0                	call   *%rax
+  801acd:	e9 8d fe ff ff       	jmp    80195f <bc_evict+0x143>
+
+0000000000801ad2 <bc_read_run>:
+bc_read_run(blockno_t blockno, size_t n) {
+  801ad2:	55                   	push   %rbp
+  801ad3:	48 89 e5             	mov    %rsp,%rbp
+  801ad6:	41 56                	push   %r14
+  801ad8:	41 55                	push   %r13
+  801ada:	41 54                	push   %r12
+  801adc:	53                   	push   %rbx
+  801add:	41 89 fd             	mov    %edi,%r13d
+  801ae0:	49 89 f4             	mov    %rsi,%r12
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  801ae3:	89 fb                	mov    %edi,%ebx
+  801ae5:	48 81 c3 00 00 01 00 	add    $0x10000,%rbx
+  801aec:	48 c1 e3 0c          	shl    $0xc,%rbx
+    bc_ra_complete(1);
+  801af0:	bf 01 00 00 00       	mov    $0x1,%edi
+  801af5:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  801afc:	00 00 00 
+  801aff:	ff d0                	call   *%rax
+    bc_evict(n);
+  801b01:	4c 89 e7             	mov    %r12,%rdi
+  801b04:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801b0b:	00 00 00 
+  801b0e:	ff d0                	call   *%rax
+    int res = sys_alloc_region(CURENVID, addr, n * BLKSIZE, PROT_RW);
+  801b10:	4c 89 e2             	mov    %r12,%rdx
+  801b13:	48 c1 e2 0c          	shl    $0xc,%rdx
+  801b17:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801b1c:	48 89 de             	mov    %rbx,%rsi
+  801b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b24:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  801b2b:	00 00 00 
+  801b2e:	ff d0                	call   *%rax
+    if (res < 0) panic("bc_read_run.sys_alloc_region failed: %i\n", res);
+  801b30:	85 c0                	test   %eax,%eax
+  801b32:	78 64                	js     801b98 <bc_read_run+0xc6>
+    res = disk->read(blockno * BLKSECTS, addr, n * BLKSECTS);
+  801b34:	4a 8d 14 e5 00 00 00 	lea    0x0(,%r12,8),%rdx
+  801b3b:	00 
+  801b3c:	42 8d 3c ed 00 00 00 	lea    0x0(,%r13,8),%edi
+  801b43:	00 
+  801b44:	48 89 de             	mov    %rbx,%rsi
+  801b47:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  801b4e:	00 00 00 
+  801b51:	ff 50 08             	call   *0x8(%rax)
+    if (res < 0) panic("bc_read_run: disk read failed: %i\n", res);
+  801b54:	85 c0                	test   %eax,%eax
+  801b56:	78 6d                	js     801bc5 <bc_read_run+0xf3>
+    bc_stat.ds_reads++;
+  801b58:	48 b8 e0 30 82 00 00 	movabs $0x8230e0,%rax
+  801b5f:	00 00 00 
+  801b62:	48 83 00 01          	addq   $0x1,(%rax)
+    bc_stat.ds_read_blocks += n;
+  801b66:	4c 01 60 08          	add    %r12,0x8(%rax)
+    for (size_t i = 0; i < n; i++)
+  801b6a:	4d 85 e4             	test   %r12,%r12
+  801b6d:	74 20                	je     801b8f <bc_read_run+0xbd>
+  801b6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        bc_track(blockno + i);
+  801b74:	49 be 1d 12 80 00 00 	movabs $0x80121d,%r14
+  801b7b:	00 00 00 
+  801b7e:	41 8d 7c 1d 00       	lea    0x0(%r13,%rbx,1),%edi
+  801b83:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < n; i++)
+  801b86:	48 83 c3 01          	add    $0x1,%rbx
+  801b8a:	49 39 dc             	cmp    %rbx,%r12
+  801b8d:	75 ef                	jne    801b7e <bc_read_run+0xac>
+}
+  801b8f:	5b                   	pop    %rbx
+  801b90:	41 5c                	pop    %r12
+  801b92:	41 5d                	pop    %r13
+  801b94:	41 5e                	pop    %r14
+  801b96:	5d                   	pop    %rbp
+  801b97:	c3                   	ret
+    if (res < 0) panic("bc_read_run.sys_alloc_region failed: %i\n", res);
+  801b98:	89 c1                	mov    %eax,%ecx
+  801b9a:	48 ba e8 bd 80 00 00 	movabs $0x80bde8,%rdx
+  801ba1:	00 00 00 
+  801ba4:	be d4 00 00 00       	mov    $0xd4,%esi
+  801ba9:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801bb0:	00 00 00 
+  801bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb8:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  801bbf:	00 00 00 
+  801bc2:	41 ff d0             	call   *%r8
+    if (res < 0) panic("bc_read_run: disk read failed: %i\n", res);
+  801bc5:	89 c1                	mov    %eax,%ecx
+  801bc7:	48 ba 18 be 80 00 00 	movabs $0x80be18,%rdx
+  801bce:	00 00 00 
+  801bd1:	be d7 00 00 00       	mov    $0xd7,%esi
+  801bd6:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801bdd:	00 00 00 
+  801be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be5:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  801bec:	00 00 00 
+  801bef:	41 ff d0             	call   *%r8
+
+0000000000801bf2 <bc_read_start>:
+bc_read_start(blockno_t blockno, size_t n) {
+  801bf2:	55                   	push   %rbp
+  801bf3:	48 89 e5             	mov    %rsp,%rbp
+  801bf6:	41 55                	push   %r13
+  801bf8:	41 54                	push   %r12
+  801bfa:	53                   	push   %rbx
+  801bfb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bff:	41 89 fc             	mov    %edi,%r12d
+  801c02:	48 89 f3             	mov    %rsi,%rbx
+    int res = sys_alloc_region(CURENVID, (void *)BC_RA_VA, n * BLKSIZE, PROT_RW);
+  801c05:	49 89 f5             	mov    %rsi,%r13
+  801c08:	49 c1 e5 0c          	shl    $0xc,%r13
+  801c0c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801c11:	4c 89 ea             	mov    %r13,%rdx
+  801c14:	be 00 00 00 0d       	mov    $0xd000000,%esi
+  801c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1e:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  801c25:	00 00 00 
+  801c28:	ff d0                	call   *%rax
+    if (res < 0) panic("bc_read_start.sys_alloc_region failed: %i\n", res);
+  801c2a:	85 c0                	test   %eax,%eax
+  801c2c:	78 62                	js     801c90 <bc_read_start+0x9e>
+    res = disk->read_start(blockno * BLKSECTS, (void *)BC_RA_VA, n * BLKSECTS);
+  801c2e:	48 8d 14 dd 00 00 00 	lea    0x0(,%rbx,8),%rdx
+  801c35:	00 
+  801c36:	42 8d 3c e5 00 00 00 	lea    0x0(,%r12,8),%edi
+  801c3d:	00 
+  801c3e:	be 00 00 00 0d       	mov    $0xd000000,%esi
+  801c43:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  801c4a:	00 00 00 
+  801c4d:	ff 50 18             	call   *0x18(%rax)
+    if (res == -E_NOT_SUPP) {
+  801c50:	83 f8 ed             	cmp    $0xffffffed,%eax
+  801c53:	74 68                	je     801cbd <bc_read_start+0xcb>
+    if (res < 0) panic("bc_read_start: disk read failed: %i\n", res);
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	0f 88 92 00 00 00    	js     801cef <bc_read_start+0xfd>
+    bc_ra.start = blockno;
+  801c5d:	48 b8 40 01 84 00 00 	movabs $0x840140,%rax
+  801c64:	00 00 00 
+  801c67:	44 89 20             	mov    %r12d,(%rax)
+    bc_ra.n = n;
+  801c6a:	48 89 58 08          	mov    %rbx,0x8(%rax)
+    bc_stat.ds_reads++;
+  801c6e:	48 b8 e0 30 82 00 00 	movabs $0x8230e0,%rax
+  801c75:	00 00 00 
+  801c78:	48 83 00 01          	addq   $0x1,(%rax)
+    bc_stat.ds_read_blocks += n;
+  801c7c:	48 01 58 08          	add    %rbx,0x8(%rax)
+    return 1;
+  801c80:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801c85:	48 83 c4 08          	add    $0x8,%rsp
+  801c89:	5b                   	pop    %rbx
+  801c8a:	41 5c                	pop    %r12
+  801c8c:	41 5d                	pop    %r13
+  801c8e:	5d                   	pop    %rbp
+  801c8f:	c3                   	ret
+    if (res < 0) panic("bc_read_start.sys_alloc_region failed: %i\n", res);
+  801c90:	89 c1                	mov    %eax,%ecx
+  801c92:	48 ba 40 be 80 00 00 	movabs $0x80be40,%rdx
+  801c99:	00 00 00 
+  801c9c:	be e5 00 00 00       	mov    $0xe5,%esi
+  801ca1:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801ca8:	00 00 00 
+  801cab:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cb0:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  801cb7:	00 00 00 
+  801cba:	41 ff d0             	call   *%r8
+        sys_unmap_region(CURENVID, (void *)BC_RA_VA, n * BLKSIZE);
+  801cbd:	4c 89 ea             	mov    %r13,%rdx
+  801cc0:	be 00 00 00 0d       	mov    $0xd000000,%esi
+  801cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cca:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+        bc_read_run(blockno, n);
+  801cd6:	48 89 de             	mov    %rbx,%rsi
+  801cd9:	44 89 e7             	mov    %r12d,%edi
+  801cdc:	48 b8 d2 1a 80 00 00 	movabs $0x801ad2,%rax
+  801ce3:	00 00 00 
+  801ce6:	ff d0                	call   *%rax
+        return 0;
+  801ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ced:	eb 96                	jmp    801c85 <bc_read_start+0x93>
+    if (res < 0) panic("bc_read_start: disk read failed: %i\n", res);
+  801cef:	89 c1                	mov    %eax,%ecx
+  801cf1:	48 ba 70 be 80 00 00 	movabs $0x80be70,%rdx
+  801cf8:	00 00 00 
+  801cfb:	be ee 00 00 00       	mov    $0xee,%esi
+  801d00:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801d07:	00 00 00 
+  801d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d0f:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  801d16:	00 00 00 
+  801d19:	41 ff d0             	call   *%r8
+
+0000000000801d1c <bc_pgfault>:
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  801d1c:	48 8b 07             	mov    (%rdi),%rax
+  801d1f:	48 2d 00 00 00 10    	sub    $0x10000000,%rax
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  801d25:	ba ff ff ff bf       	mov    $0xbfffffff,%edx
+  801d2a:	48 39 c2             	cmp    %rax,%rdx
+  801d2d:	0f 82 bd 00 00 00    	jb     801df0 <bc_pgfault+0xd4>
+bc_pgfault(struct UTrapframe *utf) {
+  801d33:	55                   	push   %rbp
+  801d34:	48 89 e5             	mov    %rsp,%rbp
+    blockno_t blockno = ((uintptr_t)addr - (uintptr_t)DISKMAP) / BLKSIZE;
+  801d37:	48 c1 e8 0c          	shr    $0xc,%rax
+  801d3b:	48 89 c2             	mov    %rax,%rdx
+  801d3e:	89 c7                	mov    %eax,%edi
+    if (super && blockno >= super->s_nblocks)
+  801d40:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  801d47:	00 00 00 
+  801d4a:	48 85 c0             	test   %rax,%rax
+  801d4d:	74 09                	je     801d58 <bc_pgfault+0x3c>
+  801d4f:	44 8b 40 04          	mov    0x4(%rax),%r8d
+  801d53:	44 39 c2             	cmp    %r8d,%edx
+  801d56:	73 44                	jae    801d9c <bc_pgfault+0x80>
+    return bc_ra.n && blockno < bc_ra.start + bc_ra.n && bc_ra.start < blockno + n;
+  801d58:	48 a1 48 01 84 00 00 	movabs 0x840148,%rax
+  801d5f:	00 00 00 
+  801d62:	48 85 c0             	test   %rax,%rax
+  801d65:	74 62                	je     801dc9 <bc_pgfault+0xad>
+  801d67:	48 b9 40 01 84 00 00 	movabs $0x840140,%rcx
+  801d6e:	00 00 00 
+  801d71:	8b 09                	mov    (%rcx),%ecx
+  801d73:	48 01 c8             	add    %rcx,%rax
+  801d76:	48 39 c2             	cmp    %rax,%rdx
+  801d79:	73 4e                	jae    801dc9 <bc_pgfault+0xad>
+  801d7b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+    if (bc_ra_overlaps(blockno, 1)) {
+  801d7f:	48 39 c1             	cmp    %rax,%rcx
+  801d82:	73 45                	jae    801dc9 <bc_pgfault+0xad>
+        bc_ra_complete(1);
+  801d84:	bf 01 00 00 00       	mov    $0x1,%edi
+  801d89:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  801d90:	00 00 00 
+  801d93:	ff d0                	call   *%rax
+        return 1;
+  801d95:	b8 01 00 00 00       	mov    $0x1,%eax
+  801d9a:	eb 52                	jmp    801dee <bc_pgfault+0xd2>
+        panic("reading non-existent block %08x out of %08x\n", blockno, super->s_nblocks);
+  801d9c:	89 d1                	mov    %edx,%ecx
+  801d9e:	48 ba 90 bd 80 00 00 	movabs $0x80bd90,%rdx
+  801da5:	00 00 00 
+  801da8:	be 5d 01 00 00       	mov    $0x15d,%esi
+  801dad:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  801db4:	00 00 00 
+  801db7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dbc:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  801dc3:	00 00 00 
+  801dc6:	41 ff d1             	call   *%r9
+    bc_read_run(blockno, 1);
+  801dc9:	be 01 00 00 00       	mov    $0x1,%esi
+  801dce:	48 b8 d2 1a 80 00 00 	movabs $0x801ad2,%rax
+  801dd5:	00 00 00 
+  801dd8:	ff d0                	call   *%rax
+    bc_cache_stat.cs_misses++;
+  801dda:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  801de1:	00 00 00 
+  801de4:	48 83 40 08 01       	addq   $0x1,0x8(%rax)
+    return 1;
+  801de9:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+  801dee:	5d                   	pop    %rbp
+  801def:	c3                   	ret
+    if (addr < (void *)DISKMAP || addr >= (void *)(DISKMAP + DISKSIZE)) return 0;
+  801df0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801df5:	c3                   	ret
+
+0000000000801df6 <bc_load>:
+bc_load(blockno_t blockno, size_t n) {
+  801df6:	55                   	push   %rbp
+  801df7:	48 89 e5             	mov    %rsp,%rbp
+  801dfa:	41 57                	push   %r15
+  801dfc:	41 56                	push   %r14
+  801dfe:	41 55                	push   %r13
+  801e00:	41 54                	push   %r12
+  801e02:	53                   	push   %rbx
+  801e03:	48 83 ec 18          	sub    $0x18,%rsp
+  801e07:	41 89 fc             	mov    %edi,%r12d
+    blockno_t end = blockno + n;
+  801e0a:	8d 0c 37             	lea    (%rdi,%rsi,1),%ecx
+  801e0d:	89 4d cc             	mov    %ecx,-0x34(%rbp)
+    if (super) end = MIN(end, super->s_nblocks);
+  801e10:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  801e17:	00 00 00 
+  801e1a:	48 85 c0             	test   %rax,%rax
+  801e1d:	74 0b                	je     801e2a <bc_load+0x34>
+  801e1f:	8b 40 04             	mov    0x4(%rax),%eax
+  801e22:	39 c1                	cmp    %eax,%ecx
+  801e24:	0f 46 c1             	cmovbe %ecx,%eax
+  801e27:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    if (thread_current() && disk->irq() >= 0) {
+  801e2a:	48 b8 af 69 80 00 00 	movabs $0x8069af,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+  801e36:	48 85 c0             	test   %rax,%rax
+  801e39:	74 11                	je     801e4c <bc_load+0x56>
+  801e3b:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  801e42:	00 00 00 
+  801e45:	ff 50 28             	call   *0x28(%rax)
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	79 6a                	jns    801eb6 <bc_load+0xc0>
+    return bc_ra.n && blockno < bc_ra.start + bc_ra.n && bc_ra.start < blockno + n;
+  801e4c:	48 a1 48 01 84 00 00 	movabs 0x840148,%rax
+  801e53:	00 00 00 
+  801e56:	48 85 c0             	test   %rax,%rax
+  801e59:	74 36                	je     801e91 <bc_load+0x9b>
+  801e5b:	44 89 e1             	mov    %r12d,%ecx
+  801e5e:	48 ba 40 01 84 00 00 	movabs $0x840140,%rdx
+  801e65:	00 00 00 
+  801e68:	8b 12                	mov    (%rdx),%edx
+  801e6a:	48 01 d0             	add    %rdx,%rax
+  801e6d:	48 39 c1             	cmp    %rax,%rcx
+  801e70:	73 1f                	jae    801e91 <bc_load+0x9b>
+    if (bc_ra_overlaps(blockno, end - blockno)) bc_ra_complete(1);
+  801e72:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e75:	44 29 e0             	sub    %r12d,%eax
+    return bc_ra.n && blockno < bc_ra.start + bc_ra.n && bc_ra.start < blockno + n;
+  801e78:	48 01 c8             	add    %rcx,%rax
+    if (bc_ra_overlaps(blockno, end - blockno)) bc_ra_complete(1);
+  801e7b:	48 39 c2             	cmp    %rax,%rdx
+  801e7e:	73 11                	jae    801e91 <bc_load+0x9b>
+  801e80:	bf 01 00 00 00       	mov    $0x1,%edi
+  801e85:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  801e8c:	00 00 00 
+  801e8f:	ff d0                	call   *%rax
+        if (bc_present(blockno)) {
+  801e91:	49 bd d4 12 80 00 00 	movabs $0x8012d4,%r13
+  801e98:	00 00 00 
+    while (blockno < end) {
+  801e9b:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801e9e:	41 39 c4             	cmp    %eax,%r12d
+  801ea1:	0f 82 53 01 00 00    	jb     801ffa <bc_load+0x204>
+}
+  801ea7:	48 83 c4 18          	add    $0x18,%rsp
+  801eab:	5b                   	pop    %rbx
+  801eac:	41 5c                	pop    %r12
+  801eae:	41 5d                	pop    %r13
+  801eb0:	41 5e                	pop    %r14
+  801eb2:	41 5f                	pop    %r15
+  801eb4:	5d                   	pop    %rbp
+  801eb5:	c3                   	ret
+    while (blockno < end) {
+  801eb6:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801eb9:	41 39 c4             	cmp    %eax,%r12d
+  801ebc:	73 e9                	jae    801ea7 <bc_load+0xb1>
+        if (bc_present(blockno)) {
+  801ebe:	49 bd d4 12 80 00 00 	movabs $0x8012d4,%r13
+  801ec5:	00 00 00 
+  801ec8:	e9 89 00 00 00       	jmp    801f56 <bc_load+0x160>
+        if (bc_busy()) {
+  801ecd:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  801ed4:	00 00 00 
+  801ed7:	ff d0                	call   *%rax
+  801ed9:	84 c0                	test   %al,%al
+  801edb:	0f 85 89 00 00 00    	jne    801f6a <bc_load+0x174>
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801ee1:	45 89 e6             	mov    %r12d,%r14d
+  801ee4:	44 8b 7d cc          	mov    -0x34(%rbp),%r15d
+  801ee8:	49 8d 46 01          	lea    0x1(%r14),%rax
+        size_t run = 1;
+  801eec:	bb 01 00 00 00       	mov    $0x1,%ebx
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801ef1:	4c 39 f8             	cmp    %r15,%rax
+  801ef4:	73 1e                	jae    801f14 <bc_load+0x11e>
+  801ef6:	41 8d 3c 1c          	lea    (%r12,%rbx,1),%edi
+  801efa:	41 ff d5             	call   *%r13
+  801efd:	84 c0                	test   %al,%al
+  801eff:	75 13                	jne    801f14 <bc_load+0x11e>
+            run++;
+  801f01:	48 83 c3 01          	add    $0x1,%rbx
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801f05:	4a 8d 04 33          	lea    (%rbx,%r14,1),%rax
+  801f09:	4c 39 f8             	cmp    %r15,%rax
+  801f0c:	73 06                	jae    801f14 <bc_load+0x11e>
+  801f0e:	48 83 fb 1f          	cmp    $0x1f,%rbx
+  801f12:	76 e2                	jbe    801ef6 <bc_load+0x100>
+        bc_evict(run);
+  801f14:	48 89 df             	mov    %rbx,%rdi
+  801f17:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  801f1e:	00 00 00 
+  801f21:	ff d0                	call   *%rax
+        bc_cache_stat.cs_misses += run;
+  801f23:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  801f2a:	00 00 00 
+  801f2d:	48 01 58 08          	add    %rbx,0x8(%rax)
+        if (bc_read_start(blockno, run)) {
+  801f31:	48 89 de             	mov    %rbx,%rsi
+  801f34:	44 89 e7             	mov    %r12d,%edi
+  801f37:	48 b8 f2 1b 80 00 00 	movabs $0x801bf2,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	84 c0                	test   %al,%al
+  801f45:	75 31                	jne    801f78 <bc_load+0x182>
+        blockno += run;
+  801f47:	41 01 dc             	add    %ebx,%r12d
+    while (blockno < end) {
+  801f4a:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801f4d:	41 39 c4             	cmp    %eax,%r12d
+  801f50:	0f 83 51 ff ff ff    	jae    801ea7 <bc_load+0xb1>
+        if (bc_present(blockno)) {
+  801f56:	44 89 e7             	mov    %r12d,%edi
+  801f59:	41 ff d5             	call   *%r13
+  801f5c:	84 c0                	test   %al,%al
+  801f5e:	0f 84 69 ff ff ff    	je     801ecd <bc_load+0xd7>
+            blockno++;
+  801f64:	41 83 c4 01          	add    $0x1,%r12d
+            continue;
+  801f68:	eb e0                	jmp    801f4a <bc_load+0x154>
+            thread_yield();
+  801f6a:	48 b8 49 69 80 00 00 	movabs $0x806949,%rax
+  801f71:	00 00 00 
+  801f74:	ff d0                	call   *%rax
+            continue;
+  801f76:	eb d2                	jmp    801f4a <bc_load+0x154>
+            do thread_yield();
+  801f78:	49 be 49 69 80 00 00 	movabs $0x806949,%r14
+  801f7f:	00 00 00 
+            while (bc_busy());
+  801f82:	49 bf 52 15 80 00 00 	movabs $0x801552,%r15
+  801f89:	00 00 00 
+            do thread_yield();
+  801f8c:	41 ff d6             	call   *%r14
+            while (bc_busy());
+  801f8f:	41 ff d7             	call   *%r15
+  801f92:	84 c0                	test   %al,%al
+  801f94:	75 f6                	jne    801f8c <bc_load+0x196>
+  801f96:	eb af                	jmp    801f47 <bc_load+0x151>
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801f98:	45 89 e7             	mov    %r12d,%r15d
+  801f9b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  801f9f:	49 8d 47 01          	lea    0x1(%r15),%rax
+        size_t run = 1;
+  801fa3:	bb 01 00 00 00       	mov    $0x1,%ebx
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801fa8:	4c 39 f0             	cmp    %r14,%rax
+  801fab:	73 1e                	jae    801fcb <bc_load+0x1d5>
+  801fad:	41 8d 3c 1c          	lea    (%r12,%rbx,1),%edi
+  801fb1:	41 ff d5             	call   *%r13
+  801fb4:	84 c0                	test   %al,%al
+  801fb6:	75 13                	jne    801fcb <bc_load+0x1d5>
+            run++;
+  801fb8:	48 83 c3 01          	add    $0x1,%rbx
+        while (blockno + run < end && run < BC_MAX_RUN && !bc_present(blockno + run))
+  801fbc:	4a 8d 04 3b          	lea    (%rbx,%r15,1),%rax
+  801fc0:	4c 39 f0             	cmp    %r14,%rax
+  801fc3:	73 06                	jae    801fcb <bc_load+0x1d5>
+  801fc5:	48 83 fb 1f          	cmp    $0x1f,%rbx
+  801fc9:	76 e2                	jbe    801fad <bc_load+0x1b7>
+        bc_read_run(blockno, run);
+  801fcb:	48 89 de             	mov    %rbx,%rsi
+  801fce:	44 89 e7             	mov    %r12d,%edi
+  801fd1:	48 b8 d2 1a 80 00 00 	movabs $0x801ad2,%rax
+  801fd8:	00 00 00 
+  801fdb:	ff d0                	call   *%rax
+        bc_cache_stat.cs_misses += run;
+  801fdd:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  801fe4:	00 00 00 
+  801fe7:	48 01 58 08          	add    %rbx,0x8(%rax)
+        blockno += run;
+  801feb:	41 01 dc             	add    %ebx,%r12d
+    while (blockno < end) {
+  801fee:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  801ff1:	41 39 c4             	cmp    %eax,%r12d
+  801ff4:	0f 83 ad fe ff ff    	jae    801ea7 <bc_load+0xb1>
+        if (bc_present(blockno)) {
+  801ffa:	44 89 e7             	mov    %r12d,%edi
+  801ffd:	41 ff d5             	call   *%r13
+  802000:	84 c0                	test   %al,%al
+  802002:	74 94                	je     801f98 <bc_load+0x1a2>
+            blockno++;
+  802004:	41 83 c4 01          	add    $0x1,%r12d
+            continue;
+  802008:	eb e4                	jmp    801fee <bc_load+0x1f8>
+
+000000000080200a <bc_readahead>:
+bc_readahead(blockno_t blockno, size_t n) {
+  80200a:	55                   	push   %rbp
+  80200b:	48 89 e5             	mov    %rsp,%rbp
+  80200e:	41 57                	push   %r15
+  802010:	41 56                	push   %r14
+  802012:	41 55                	push   %r13
+  802014:	41 54                	push   %r12
+  802016:	53                   	push   %rbx
+  802017:	48 83 ec 08          	sub    $0x8,%rsp
+  80201b:	41 89 ff             	mov    %edi,%r15d
+  80201e:	49 89 f6             	mov    %rsi,%r14
+    if (super) n = MIN(n, super->s_nblocks - MIN(blockno, super->s_nblocks));
+  802021:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  802028:	00 00 00 
+  80202b:	48 85 c0             	test   %rax,%rax
+  80202e:	74 13                	je     802043 <bc_readahead+0x39>
+  802030:	8b 40 04             	mov    0x4(%rax),%eax
+  802033:	39 f8                	cmp    %edi,%eax
+  802035:	89 fa                	mov    %edi,%edx
+  802037:	0f 46 d0             	cmovbe %eax,%edx
+  80203a:	29 d0                	sub    %edx,%eax
+  80203c:	48 39 c6             	cmp    %rax,%rsi
+  80203f:	4c 0f 47 f0          	cmova  %rax,%r14
+    if (bc_ra_complete(0) < 0) return 0;
+  802043:	bf 00 00 00 00       	mov    $0x0,%edi
+  802048:	48 b8 f3 12 80 00 00 	movabs $0x8012f3,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802059:	85 c0                	test   %eax,%eax
+  80205b:	0f 88 95 00 00 00    	js     8020f6 <bc_readahead+0xec>
+    while (i < n && bc_present(blockno + i))
+  802061:	49 bc d4 12 80 00 00 	movabs $0x8012d4,%r12
+  802068:	00 00 00 
+  80206b:	4d 85 f6             	test   %r14,%r14
+  80206e:	74 14                	je     802084 <bc_readahead+0x7a>
+  802070:	41 8d 3c 1f          	lea    (%r15,%rbx,1),%edi
+  802074:	41 ff d4             	call   *%r12
+  802077:	84 c0                	test   %al,%al
+  802079:	74 0e                	je     802089 <bc_readahead+0x7f>
+        i++;
+  80207b:	48 83 c3 01          	add    $0x1,%rbx
+    while (i < n && bc_present(blockno + i))
+  80207f:	49 39 de             	cmp    %rbx,%r14
+  802082:	75 ec                	jne    802070 <bc_readahead+0x66>
+    return i + run;
+  802084:	4c 89 f3             	mov    %r14,%rbx
+  802087:	eb 6d                	jmp    8020f6 <bc_readahead+0xec>
+    while (i + run < n && run < BC_MAX_RUN && !bc_present(blockno + i + run))
+  802089:	4c 39 f3             	cmp    %r14,%rbx
+  80208c:	73 7a                	jae    802108 <bc_readahead+0xfe>
+  80208e:	49 89 dc             	mov    %rbx,%r12
+  802091:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802097:	43 8d 3c 27          	lea    (%r15,%r12,1),%edi
+  80209b:	48 b8 d4 12 80 00 00 	movabs $0x8012d4,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	84 c0                	test   %al,%al
+  8020a9:	75 13                	jne    8020be <bc_readahead+0xb4>
+        run++;
+  8020ab:	49 83 c5 01          	add    $0x1,%r13
+    while (i + run < n && run < BC_MAX_RUN && !bc_present(blockno + i + run))
+  8020af:	49 83 c4 01          	add    $0x1,%r12
+  8020b3:	49 83 fd 1f          	cmp    $0x1f,%r13
+  8020b7:	77 05                	ja     8020be <bc_readahead+0xb4>
+  8020b9:	4d 39 f4             	cmp    %r14,%r12
+  8020bc:	72 d9                	jb     802097 <bc_readahead+0x8d>
+    if (!run) return i;
+  8020be:	4d 85 ed             	test   %r13,%r13
+  8020c1:	74 33                	je     8020f6 <bc_readahead+0xec>
+    bc_evict(run);
+  8020c3:	4c 89 ef             	mov    %r13,%rdi
+  8020c6:	48 b8 1c 18 80 00 00 	movabs $0x80181c,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+    bc_cache_stat.cs_readahead += run;
+  8020d2:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  8020d9:	00 00 00 
+  8020dc:	4c 01 68 10          	add    %r13,0x10(%rax)
+    while (i + run < n && run < BC_MAX_RUN && !bc_present(blockno + i + run))
+  8020e0:	41 8d 3c 1f          	lea    (%r15,%rbx,1),%edi
+    bc_read_start(blockno + i, run);
+  8020e4:	4c 89 ee             	mov    %r13,%rsi
+  8020e7:	48 b8 f2 1b 80 00 00 	movabs $0x801bf2,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+    return i + run;
+  8020f3:	4c 89 e3             	mov    %r12,%rbx
+}
+  8020f6:	48 89 d8             	mov    %rbx,%rax
+  8020f9:	48 83 c4 08          	add    $0x8,%rsp
+  8020fd:	5b                   	pop    %rbx
+  8020fe:	41 5c                	pop    %r12
+  802100:	41 5d                	pop    %r13
+  802102:	41 5e                	pop    %r14
+  802104:	41 5f                	pop    %r15
+  802106:	5d                   	pop    %rbp
+  802107:	c3                   	ret
+    while (i + run < n && run < BC_MAX_RUN && !bc_present(blockno + i + run))
+  802108:	49 89 de             	mov    %rbx,%r14
+  80210b:	e9 74 ff ff ff       	jmp    802084 <bc_readahead+0x7a>
+
+0000000000802110 <flush_block>:
+flush_block(void *addr) {
+  802110:	55                   	push   %rbp
+  802111:	48 89 e5             	mov    %rsp,%rbp
+  802114:	53                   	push   %rbx
+  802115:	48 83 ec 08          	sub    $0x8,%rsp
+  802119:	48 89 fb             	mov    %rdi,%rbx
+    flush_block_deferred(addr);
+  80211c:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+    flush_commit();
+  802128:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+    assert(!is_page_dirty(ROUNDDOWN(addr, PAGE_SIZE)));
+  802134:	48 81 e3 00 f0 ff ff 	and    $0xfffffffffffff000,%rbx
+  80213b:	48 89 df             	mov    %rbx,%rdi
+  80213e:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+  80214a:	84 c0                	test   %al,%al
+  80214c:	75 06                	jne    802154 <flush_block+0x44>
+}
+  80214e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802152:	c9                   	leave
+  802153:	c3                   	ret
+    assert(!is_page_dirty(ROUNDDOWN(addr, PAGE_SIZE)));
+  802154:	48 b9 98 be 80 00 00 	movabs $0x80be98,%rcx
+  80215b:	00 00 00 
+  80215e:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  802165:	00 00 00 
+  802168:	be 78 01 00 00       	mov    $0x178,%esi
+  80216d:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  802174:	00 00 00 
+  802177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80217c:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802183:	00 00 00 
+  802186:	41 ff d0             	call   *%r8
+
+0000000000802189 <bc_forget>:
+bc_forget(blockno_t blockno) {
+  802189:	55                   	push   %rbp
+  80218a:	48 89 e5             	mov    %rsp,%rbp
+  80218d:	53                   	push   %rbx
+  80218e:	48 83 ec 08          	sub    $0x8,%rsp
+  802192:	89 fb                	mov    %edi,%ebx
+    if (!bc_present(blockno)) return;
+  802194:	48 b8 d4 12 80 00 00 	movabs $0x8012d4,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+  8021a0:	84 c0                	test   %al,%al
+  8021a2:	75 06                	jne    8021aa <bc_forget+0x21>
+}
+  8021a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8021a8:	c9                   	leave
+  8021a9:	c3                   	ret
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  8021aa:	89 de                	mov    %ebx,%esi
+  8021ac:	48 81 c6 00 00 01 00 	add    $0x10000,%rsi
+  8021b3:	48 c1 e6 0c          	shl    $0xc,%rsi
+    scring_unmap_region(CURENVID, bc_addr(blockno), BLKSIZE);
+  8021b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8021bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021c1:	48 b8 87 b7 80 00 00 	movabs $0x80b787,%rax
+  8021c8:	00 00 00 
+  8021cb:	ff d0                	call   *%rax
+    flush_commit();
+  8021cd:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8021d4:	00 00 00 
+  8021d7:	ff d0                	call   *%rax
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+  8021d9:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (bc_slots[i].bs_blockno == blockno) {
+  8021de:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  8021e5:	00 00 00 
+  8021e8:	39 1c c2             	cmp    %ebx,(%rdx,%rax,8)
+  8021eb:	74 0e                	je     8021fb <bc_forget+0x72>
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+  8021ed:	48 83 c0 01          	add    $0x1,%rax
+  8021f1:	48 3d 00 10 00 00    	cmp    $0x1000,%rax
+  8021f7:	75 ef                	jne    8021e8 <bc_forget+0x5f>
+  8021f9:	eb a9                	jmp    8021a4 <bc_forget+0x1b>
+            bc_untrack(&bc_slots[i]);
+  8021fb:	48 ba 60 41 84 00 00 	movabs $0x844160,%rdx
+  802202:	00 00 00 
+  802205:	48 8d 3c c2          	lea    (%rdx,%rax,8),%rdi
+  802209:	48 b8 89 12 80 00 00 	movabs $0x801289,%rax
+  802210:	00 00 00 
+  802213:	ff d0                	call   *%rax
+            break;
+  802215:	eb 8d                	jmp    8021a4 <bc_forget+0x1b>
+
+0000000000802217 <bc_writeback>:
+bc_writeback(void) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	41 57                	push   %r15
+  80221d:	41 56                	push   %r14
+  80221f:	41 55                	push   %r13
+  802221:	41 54                	push   %r12
+  802223:	53                   	push   %rbx
+  802224:	48 83 ec 08          	sub    $0x8,%rsp
+    bc_sort(bc_dirty_list, bc_ndirty);
+  802228:	48 b8 20 f1 83 00 00 	movabs $0x83f120,%rax
+  80222f:	00 00 00 
+  802232:	48 8b 18             	mov    (%rax),%rbx
+    for (size_t gap = n / 2; gap; gap /= 2) {
+  802235:	48 89 df             	mov    %rbx,%rdi
+  802238:	48 d1 ef             	shr    %rdi
+  80223b:	49 bc 40 f1 83 00 00 	movabs $0x83f140,%r12
+  802242:	00 00 00 
+  802245:	48 83 fb 01          	cmp    $0x1,%rbx
+  802249:	0f 87 f6 00 00 00    	ja     802345 <bc_writeback+0x12e>
+    for (size_t i = 0; i < bc_ndirty; i++) {
+  80224f:	48 85 db             	test   %rbx,%rbx
+  802252:	74 5d                	je     8022b1 <bc_writeback+0x9a>
+    for (size_t gap = n / 2; gap; gap /= 2) {
+  802254:	bb 00 00 00 00       	mov    $0x0,%ebx
+        CLRBIT(bc_dirty_map, bc_dirty_list[i]);
+  802259:	49 bf 40 f1 83 00 00 	movabs $0x83f140,%r15
+  802260:	00 00 00 
+  802263:	49 bc 20 71 82 00 00 	movabs $0x827120,%r12
+  80226a:	00 00 00 
+        flush_block_deferred(bc_addr(bc_dirty_list[i]));
+  80226d:	49 be 6f 15 80 00 00 	movabs $0x80156f,%r14
+  802274:	00 00 00 
+    for (size_t i = 0; i < bc_ndirty; i++) {
+  802277:	49 bd 20 f1 83 00 00 	movabs $0x83f120,%r13
+  80227e:	00 00 00 
+        CLRBIT(bc_dirty_map, bc_dirty_list[i]);
+  802281:	41 8b 0c 9f          	mov    (%r15,%rbx,4),%ecx
+  802285:	89 c8                	mov    %ecx,%eax
+  802287:	c1 e8 05             	shr    $0x5,%eax
+  80228a:	89 c0                	mov    %eax,%eax
+  80228c:	ba fe ff ff ff       	mov    $0xfffffffe,%edx
+  802291:	d3 c2                	rol    %cl,%edx
+  802293:	41 21 14 84          	and    %edx,(%r12,%rax,4)
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  802297:	89 cf                	mov    %ecx,%edi
+  802299:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  8022a0:	48 c1 e7 0c          	shl    $0xc,%rdi
+        flush_block_deferred(bc_addr(bc_dirty_list[i]));
+  8022a4:	41 ff d6             	call   *%r14
+    for (size_t i = 0; i < bc_ndirty; i++) {
+  8022a7:	48 83 c3 01          	add    $0x1,%rbx
+  8022ab:	49 3b 5d 00          	cmp    0x0(%r13),%rbx
+  8022af:	72 d0                	jb     802281 <bc_writeback+0x6a>
+    bc_ndirty = 0;
+  8022b1:	48 b8 20 f1 83 00 00 	movabs $0x83f120,%rax
+  8022b8:	00 00 00 
+  8022bb:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    flush_commit();
+  8022c2:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8022c9:	00 00 00 
+  8022cc:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  8022ce:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8022d0:	48 c1 e2 20          	shl    $0x20,%rdx
+  8022d4:	89 c0                	mov    %eax,%eax
+  8022d6:	48 09 d0             	or     %rdx,%rax
+  8022d9:	48 a3 10 71 82 00 00 	movabs %rax,0x827110
+  8022e0:	00 00 00 
+}
+  8022e3:	48 83 c4 08          	add    $0x8,%rsp
+  8022e7:	5b                   	pop    %rbx
+  8022e8:	41 5c                	pop    %r12
+  8022ea:	41 5d                	pop    %r13
+  8022ec:	41 5e                	pop    %r14
+  8022ee:	41 5f                	pop    %r15
+  8022f0:	5d                   	pop    %rbp
+  8022f1:	c3                   	ret
+            a[j] = v;
+  8022f2:	47 89 0c 94          	mov    %r9d,(%r12,%r10,4)
+        for (size_t i = gap; i < n; i++) {
+  8022f6:	49 83 c3 01          	add    $0x1,%r11
+  8022fa:	48 83 c0 04          	add    $0x4,%rax
+  8022fe:	4c 39 db             	cmp    %r11,%rbx
+  802301:	74 2f                	je     802332 <bc_writeback+0x11b>
+            blockno_t v = a[i];
+  802303:	44 8b 08             	mov    (%rax),%r9d
+            for (; j >= gap && a[j - gap] > v; j -= gap)
+  802306:	48 89 c1             	mov    %rax,%rcx
+  802309:	4c 89 da             	mov    %r11,%rdx
+  80230c:	4d 89 da             	mov    %r11,%r10
+  80230f:	49 39 fb             	cmp    %rdi,%r11
+  802312:	72 de                	jb     8022f2 <bc_writeback+0xdb>
+  802314:	49 89 d2             	mov    %rdx,%r10
+  802317:	48 29 fa             	sub    %rdi,%rdx
+  80231a:	42 8b 34 01          	mov    (%rcx,%r8,1),%esi
+  80231e:	41 39 f1             	cmp    %esi,%r9d
+  802321:	73 cf                	jae    8022f2 <bc_writeback+0xdb>
+                a[j] = a[j - gap];
+  802323:	89 31                	mov    %esi,(%rcx)
+            for (; j >= gap && a[j - gap] > v; j -= gap)
+  802325:	4c 01 c1             	add    %r8,%rcx
+  802328:	48 39 fa             	cmp    %rdi,%rdx
+  80232b:	73 e7                	jae    802314 <bc_writeback+0xfd>
+  80232d:	49 89 d2             	mov    %rdx,%r10
+  802330:	eb c0                	jmp    8022f2 <bc_writeback+0xdb>
+    for (size_t gap = n / 2; gap; gap /= 2) {
+  802332:	48 89 f8             	mov    %rdi,%rax
+  802335:	48 d1 e8             	shr    %rax
+  802338:	48 83 ff 01          	cmp    $0x1,%rdi
+  80233c:	0f 86 12 ff ff ff    	jbe    802254 <bc_writeback+0x3d>
+  802342:	48 89 c7             	mov    %rax,%rdi
+        for (size_t i = gap; i < n; i++) {
+  802345:	48 39 df             	cmp    %rbx,%rdi
+  802348:	73 e8                	jae    802332 <bc_writeback+0x11b>
+  80234a:	49 8d 04 bc          	lea    (%r12,%rdi,4),%rax
+  80234e:	49 89 f8             	mov    %rdi,%r8
+  802351:	49 f7 d8             	neg    %r8
+  802354:	49 c1 e0 02          	shl    $0x2,%r8
+  802358:	49 89 fb             	mov    %rdi,%r11
+  80235b:	eb a6                	jmp    802303 <bc_writeback+0xec>
+
+000000000080235d <bc_sync_block>:
+bc_sync_block(blockno_t blockno) {
+  80235d:	55                   	push   %rbp
+  80235e:	48 89 e5             	mov    %rsp,%rbp
+  802361:	53                   	push   %rbx
+  802362:	48 83 ec 08          	sub    $0x8,%rsp
+  802366:	89 fb                	mov    %edi,%ebx
+    if (bc_ndirty == BC_DIRTY_MAX) bc_writeback();
+  802368:	48 b8 20 f1 83 00 00 	movabs $0x83f120,%rax
+  80236f:	00 00 00 
+  802372:	48 81 38 00 04 00 00 	cmpq   $0x400,(%rax)
+  802379:	74 1f                	je     80239a <bc_sync_block+0x3d>
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80237b:	89 df                	mov    %ebx,%edi
+  80237d:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  802384:	48 c1 e7 0c          	shl    $0xc,%rdi
+    bc_mark_dirty(bc_addr(blockno));
+  802388:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+}
+  802394:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802398:	c9                   	leave
+  802399:	c3                   	ret
+    if (bc_ndirty == BC_DIRTY_MAX) bc_writeback();
+  80239a:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+  8023a6:	eb d3                	jmp    80237b <bc_sync_block+0x1e>
+
+00000000008023a8 <bc_sync>:
+bc_sync(void) {
+  8023a8:	55                   	push   %rbp
+  8023a9:	48 89 e5             	mov    %rsp,%rbp
+  8023ac:	41 57                	push   %r15
+  8023ae:	41 56                	push   %r14
+  8023b0:	41 55                	push   %r13
+  8023b2:	41 54                	push   %r12
+  8023b4:	53                   	push   %rbx
+  8023b5:	48 83 ec 18          	sub    $0x18,%rsp
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+  8023b9:	48 bb 60 41 84 00 00 	movabs $0x844160,%rbx
+  8023c0:	00 00 00 
+  8023c3:	4c 8d ab 00 80 00 00 	lea    0x8000(%rbx),%r13
+    size_t n = 0;
+  8023ca:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8023d1:	00 
+        if (blockno && !TSTBIT(bc_dirty_map, blockno) && is_page_dirty(bc_addr(blockno)))
+  8023d2:	49 bf 20 71 82 00 00 	movabs $0x827120,%r15
+  8023d9:	00 00 00 
+  8023dc:	41 be 01 00 00 00    	mov    $0x1,%r14d
+  8023e2:	eb 09                	jmp    8023ed <bc_sync+0x45>
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++) {
+  8023e4:	48 83 c3 08          	add    $0x8,%rbx
+  8023e8:	4c 39 eb             	cmp    %r13,%rbx
+  8023eb:	74 58                	je     802445 <bc_sync+0x9d>
+        blockno_t blockno = bc_slots[i].bs_blockno;
+  8023ed:	44 8b 23             	mov    (%rbx),%r12d
+        if (blockno && !TSTBIT(bc_dirty_map, blockno) && is_page_dirty(bc_addr(blockno)))
+  8023f0:	45 85 e4             	test   %r12d,%r12d
+  8023f3:	74 ef                	je     8023e4 <bc_sync+0x3c>
+  8023f5:	44 89 e2             	mov    %r12d,%edx
+  8023f8:	c1 ea 05             	shr    $0x5,%edx
+  8023fb:	89 d2                	mov    %edx,%edx
+  8023fd:	44 89 f0             	mov    %r14d,%eax
+  802400:	44 89 e1             	mov    %r12d,%ecx
+  802403:	d3 e0                	shl    %cl,%eax
+  802405:	41 23 04 97          	and    (%r15,%rdx,4),%eax
+  802409:	75 d9                	jne    8023e4 <bc_sync+0x3c>
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  80240b:	44 89 e7             	mov    %r12d,%edi
+  80240e:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  802415:	48 c1 e7 0c          	shl    $0xc,%rdi
+        if (blockno && !TSTBIT(bc_dirty_map, blockno) && is_page_dirty(bc_addr(blockno)))
+  802419:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+  802425:	84 c0                	test   %al,%al
+  802427:	74 bb                	je     8023e4 <bc_sync+0x3c>
+            blocks[n++] = blockno;
+  802429:	48 be 00 31 82 00 00 	movabs $0x823100,%rsi
+  802430:	00 00 00 
+  802433:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802437:	44 89 24 86          	mov    %r12d,(%rsi,%rax,4)
+  80243b:	48 8d 40 01          	lea    0x1(%rax),%rax
+  80243f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802443:	eb 9f                	jmp    8023e4 <bc_sync+0x3c>
+    bc_dirty_overflow = 0;
+  802445:	48 b8 18 71 82 00 00 	movabs $0x827118,%rax
+  80244c:	00 00 00 
+  80244f:	c6 00 00             	movb   $0x0,(%rax)
+    for (blockno_t blockno = 1; bc_pinned(blockno); blockno++)
+  802452:	bb 01 00 00 00       	mov    $0x1,%ebx
+  802457:	49 bc e1 11 80 00 00 	movabs $0x8011e1,%r12
+  80245e:	00 00 00 
+        if (is_page_dirty(bc_addr(blockno))) bc_sync_block(blockno);
+  802461:	49 bd 1f b4 80 00 00 	movabs $0x80b41f,%r13
+  802468:	00 00 00 
+  80246b:	49 be 5d 23 80 00 00 	movabs $0x80235d,%r14
+  802472:	00 00 00 
+    for (blockno_t blockno = 1; bc_pinned(blockno); blockno++)
+  802475:	eb 03                	jmp    80247a <bc_sync+0xd2>
+  802477:	83 c3 01             	add    $0x1,%ebx
+  80247a:	89 df                	mov    %ebx,%edi
+  80247c:	41 ff d4             	call   *%r12
+  80247f:	84 c0                	test   %al,%al
+  802481:	74 1b                	je     80249e <bc_sync+0xf6>
+    return (void *)(uintptr_t)(DISKMAP + blockno * BLKSIZE);
+  802483:	89 df                	mov    %ebx,%edi
+  802485:	48 81 c7 00 00 01 00 	add    $0x10000,%rdi
+  80248c:	48 c1 e7 0c          	shl    $0xc,%rdi
+        if (is_page_dirty(bc_addr(blockno))) bc_sync_block(blockno);
+  802490:	41 ff d5             	call   *%r13
+  802493:	84 c0                	test   %al,%al
+  802495:	74 e0                	je     802477 <bc_sync+0xcf>
+  802497:	89 df                	mov    %ebx,%edi
+  802499:	41 ff d6             	call   *%r14
+  80249c:	eb d9                	jmp    802477 <bc_sync+0xcf>
+    for (size_t i = 0; i < n; i++)
+  80249e:	48 83 7d c8 00       	cmpq   $0x0,-0x38(%rbp)
+  8024a3:	74 2b                	je     8024d0 <bc_sync+0x128>
+  8024a5:	bb 00 00 00 00       	mov    $0x0,%ebx
+        bc_sync_block(blocks[i]);
+  8024aa:	49 bd 00 31 82 00 00 	movabs $0x823100,%r13
+  8024b1:	00 00 00 
+  8024b4:	49 bc 5d 23 80 00 00 	movabs $0x80235d,%r12
+  8024bb:	00 00 00 
+  8024be:	41 8b 7c 9d 00       	mov    0x0(%r13,%rbx,4),%edi
+  8024c3:	41 ff d4             	call   *%r12
+    for (size_t i = 0; i < n; i++)
+  8024c6:	48 83 c3 01          	add    $0x1,%rbx
+  8024ca:	48 39 5d c8          	cmp    %rbx,-0x38(%rbp)
+  8024ce:	75 ee                	jne    8024be <bc_sync+0x116>
+    bc_writeback();
+  8024d0:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+}
+  8024dc:	48 83 c4 18          	add    $0x18,%rsp
+  8024e0:	5b                   	pop    %rbx
+  8024e1:	41 5c                	pop    %r12
+  8024e3:	41 5d                	pop    %r13
+  8024e5:	41 5e                	pop    %r14
+  8024e7:	41 5f                	pop    %r15
+  8024e9:	5d                   	pop    %rbp
+  8024ea:	c3                   	ret
+
+00000000008024eb <bc_writeback_maybe>:
+bc_writeback_maybe(void) {
+  8024eb:	55                   	push   %rbp
+  8024ec:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t khz = vsys[VSYS_tsc_khz];
+  8024ef:	48 b8 44 f0 bf 1f 80 	movabs $0x801fbff044,%rax
+  8024f6:	00 00 00 
+  8024f9:	8b 08                	mov    (%rax),%ecx
+    if (bc_dirty_overflow)
+  8024fb:	48 b8 18 71 82 00 00 	movabs $0x827118,%rax
+  802502:	00 00 00 
+  802505:	80 38 00             	cmpb   $0x0,(%rax)
+  802508:	75 51                	jne    80255b <bc_writeback_maybe+0x70>
+    else if (bc_ndirty >= BC_DIRTY_THRESHOLD ||
+  80250a:	48 a1 20 f1 83 00 00 	movabs 0x83f120,%rax
+  802511:	00 00 00 
+  802514:	48 3d ff 00 00 00    	cmp    $0xff,%rax
+  80251a:	77 31                	ja     80254d <bc_writeback_maybe+0x62>
+    uint64_t khz = vsys[VSYS_tsc_khz];
+  80251c:	48 63 c9             	movslq %ecx,%rcx
+             (bc_ndirty && khz && read_tsc() - bc_writeback_tsc >= BC_WRITEBACK_MS * khz))
+  80251f:	48 85 c9             	test   %rcx,%rcx
+  802522:	74 43                	je     802567 <bc_writeback_maybe+0x7c>
+  802524:	48 85 c0             	test   %rax,%rax
+  802527:	74 3e                	je     802567 <bc_writeback_maybe+0x7c>
+    asm volatile("rdtsc"
+  802529:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80252b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80252f:	89 c0                	mov    %eax,%eax
+  802531:	48 09 c2             	or     %rax,%rdx
+  802534:	48 b8 10 71 82 00 00 	movabs $0x827110,%rax
+  80253b:	00 00 00 
+  80253e:	48 2b 10             	sub    (%rax),%rdx
+  802541:	48 69 c9 e8 03 00 00 	imul   $0x3e8,%rcx,%rcx
+  802548:	48 39 ca             	cmp    %rcx,%rdx
+  80254b:	72 1a                	jb     802567 <bc_writeback_maybe+0x7c>
+        bc_writeback();
+  80254d:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+}
+  802559:	eb 0c                	jmp    802567 <bc_writeback_maybe+0x7c>
+        bc_sync();
+  80255b:	48 b8 a8 23 80 00 00 	movabs $0x8023a8,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+}
+  802567:	5d                   	pop    %rbp
+  802568:	c3                   	ret
+
+0000000000802569 <bc_init>:
+
+    cprintf("block cache is good\n");
+}
+
+void
+bc_init(void) {
+  802569:	55                   	push   %rbp
+  80256a:	48 89 e5             	mov    %rsp,%rbp
+  80256d:	41 54                	push   %r12
+  80256f:	53                   	push   %rbx
+  802570:	48 81 ec 10 02 00 00 	sub    $0x210,%rsp
+    struct Super super;
+
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++)
+  802577:	48 a1 58 01 84 00 00 	movabs 0x840158,%rax
+  80257e:	00 00 00 
+  802581:	4c 8d 80 00 10 00 00 	lea    0x1000(%rax),%r8
+bc_init(void) {
+  802588:	48 89 c2             	mov    %rax,%rdx
+        bc_free_slots[bc_nfree++] = BC_MAX_BLOCKS - 1 - i;
+  80258b:	48 bf 5c 01 84 00 00 	movabs $0x84015c,%rdi
+  802592:	00 00 00 
+  802595:	8d 88 00 10 00 00    	lea    0x1000(%rax),%ecx
+  80259b:	48 89 d6             	mov    %rdx,%rsi
+  80259e:	48 83 c2 01          	add    $0x1,%rdx
+  8025a2:	89 c8                	mov    %ecx,%eax
+  8025a4:	29 d0                	sub    %edx,%eax
+  8025a6:	89 04 97             	mov    %eax,(%rdi,%rdx,4)
+    for (size_t i = 0; i < BC_MAX_BLOCKS; i++)
+  8025a9:	4c 39 c2             	cmp    %r8,%rdx
+  8025ac:	75 ed                	jne    80259b <bc_init+0x32>
+  8025ae:	48 89 d0             	mov    %rdx,%rax
+  8025b1:	48 a3 58 01 84 00 00 	movabs %rax,0x840158
+  8025b8:	00 00 00 
+  8025bb:	48 b8 60 01 84 00 00 	movabs $0x840160,%rax
+  8025c2:	00 00 00 
+  8025c5:	c7 04 b0 00 00 00 00 	movl   $0x0,(%rax,%rsi,4)
+    bc_cache_stat.cs_budget = BC_MAX_BLOCKS;
+  8025cc:	48 b8 c8 30 82 00 00 	movabs $0x8230c8,%rax
+  8025d3:	00 00 00 
+  8025d6:	48 c7 00 00 10 00 00 	movq   $0x1000,(%rax)
+
+    add_pgfault_handler(bc_pgfault);
+  8025dd:	48 bf 1c 1d 80 00 00 	movabs $0x801d1c,%rdi
+  8025e4:	00 00 00 
+  8025e7:	48 b8 12 88 80 00 00 	movabs $0x808812,%rax
+  8025ee:	00 00 00 
+  8025f1:	ff d0                	call   *%rax
+    memmove(&backup, diskaddr(1), sizeof backup);
+  8025f3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8025f8:	48 bb d0 14 80 00 00 	movabs $0x8014d0,%rbx
+  8025ff:	00 00 00 
+  802602:	ff d3                	call   *%rbx
+  802604:	48 89 c6             	mov    %rax,%rsi
+  802607:	ba 08 01 00 00       	mov    $0x108,%edx
+  80260c:	48 8d bd e0 fd ff ff 	lea    -0x220(%rbp),%rdi
+  802613:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  80261a:	00 00 00 
+  80261d:	ff d0                	call   *%rax
+    strcpy(diskaddr(1), "OOPS!\n");
+  80261f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802624:	ff d3                	call   *%rbx
+  802626:	48 89 c7             	mov    %rax,%rdi
+  802629:	48 be 0d bf 80 00 00 	movabs $0x80bf0d,%rsi
+  802630:	00 00 00 
+  802633:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+    flush_block(diskaddr(1));
+  80263f:	bf 01 00 00 00       	mov    $0x1,%edi
+  802644:	ff d3                	call   *%rbx
+  802646:	48 89 c7             	mov    %rax,%rdi
+  802649:	48 b8 10 21 80 00 00 	movabs $0x802110,%rax
+  802650:	00 00 00 
+  802653:	ff d0                	call   *%rax
+    assert(is_page_present(diskaddr(1)));
+  802655:	bf 01 00 00 00       	mov    $0x1,%edi
+  80265a:	ff d3                	call   *%rbx
+  80265c:	48 89 c7             	mov    %rax,%rdi
+  80265f:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  802666:	00 00 00 
+  802669:	ff d0                	call   *%rax
+  80266b:	84 c0                	test   %al,%al
+  80266d:	0f 84 25 01 00 00    	je     802798 <bc_init+0x22f>
+    assert(!is_page_dirty(diskaddr(1)));
+  802673:	bf 01 00 00 00       	mov    $0x1,%edi
+  802678:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+  802684:	48 89 c7             	mov    %rax,%rdi
+  802687:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  80268e:	00 00 00 
+  802691:	ff d0                	call   *%rax
+  802693:	84 c0                	test   %al,%al
+  802695:	0f 85 2d 01 00 00    	jne    8027c8 <bc_init+0x25f>
+    sys_unmap_region(0, diskaddr(1), PAGE_SIZE);
+  80269b:	bf 01 00 00 00       	mov    $0x1,%edi
+  8026a0:	48 bb d0 14 80 00 00 	movabs $0x8014d0,%rbx
+  8026a7:	00 00 00 
+  8026aa:	ff d3                	call   *%rbx
+  8026ac:	48 89 c6             	mov    %rax,%rsi
+  8026af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8026b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b9:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+    assert(!is_page_present(diskaddr(1)));
+  8026c5:	bf 01 00 00 00       	mov    $0x1,%edi
+  8026ca:	ff d3                	call   *%rbx
+  8026cc:	48 89 c7             	mov    %rax,%rdi
+  8026cf:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+  8026db:	84 c0                	test   %al,%al
+  8026dd:	0f 85 1a 01 00 00    	jne    8027fd <bc_init+0x294>
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  8026e3:	bf 01 00 00 00       	mov    $0x1,%edi
+  8026e8:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  8026ef:	00 00 00 
+  8026f2:	ff d0                	call   *%rax
+  8026f4:	48 89 c7             	mov    %rax,%rdi
+  8026f7:	48 be 0d bf 80 00 00 	movabs $0x80bf0d,%rsi
+  8026fe:	00 00 00 
+  802701:	48 b8 9a 7e 80 00 00 	movabs $0x807e9a,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	85 c0                	test   %eax,%eax
+  80270f:	0f 85 1d 01 00 00    	jne    802832 <bc_init+0x2c9>
+    memmove(diskaddr(1), &backup, sizeof backup);
+  802715:	bf 01 00 00 00       	mov    $0x1,%edi
+  80271a:	48 bb d0 14 80 00 00 	movabs $0x8014d0,%rbx
+  802721:	00 00 00 
+  802724:	ff d3                	call   *%rbx
+  802726:	48 89 c7             	mov    %rax,%rdi
+  802729:	ba 08 01 00 00       	mov    $0x108,%edx
+  80272e:	48 8d b5 e0 fd ff ff 	lea    -0x220(%rbp),%rsi
+  802735:	49 bc f0 7f 80 00 00 	movabs $0x807ff0,%r12
+  80273c:	00 00 00 
+  80273f:	41 ff d4             	call   *%r12
+    flush_block(diskaddr(1));
+  802742:	bf 01 00 00 00       	mov    $0x1,%edi
+  802747:	ff d3                	call   *%rbx
+  802749:	48 89 c7             	mov    %rax,%rdi
+  80274c:	48 b8 10 21 80 00 00 	movabs $0x802110,%rax
+  802753:	00 00 00 
+  802756:	ff d0                	call   *%rax
+    cprintf("block cache is good\n");
+  802758:	48 bf 4e bf 80 00 00 	movabs $0x80bf4e,%rdi
+  80275f:	00 00 00 
+  802762:	b8 00 00 00 00       	mov    $0x0,%eax
+  802767:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  80276e:	00 00 00 
+  802771:	ff d2                	call   *%rdx
+    check_bc();
+
+    /* Cache the super block by reading it once */
+    memmove(&super, diskaddr(1), sizeof super);
+  802773:	bf 01 00 00 00       	mov    $0x1,%edi
+  802778:	ff d3                	call   *%rbx
+  80277a:	48 89 c6             	mov    %rax,%rsi
+  80277d:	ba 08 01 00 00       	mov    $0x108,%edx
+  802782:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  802789:	41 ff d4             	call   *%r12
+}
+  80278c:	48 81 c4 10 02 00 00 	add    $0x210,%rsp
+  802793:	5b                   	pop    %rbx
+  802794:	41 5c                	pop    %r12
+  802796:	5d                   	pop    %rbp
+  802797:	c3                   	ret
+    assert(is_page_present(diskaddr(1)));
+  802798:	48 b9 31 bf 80 00 00 	movabs $0x80bf31,%rcx
+  80279f:	00 00 00 
+  8027a2:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8027a9:	00 00 00 
+  8027ac:	be 29 02 00 00       	mov    $0x229,%esi
+  8027b1:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  8027b8:	00 00 00 
+  8027bb:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8027c2:	00 00 00 
+  8027c5:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(diskaddr(1)));
+  8027c8:	48 b9 14 bf 80 00 00 	movabs $0x80bf14,%rcx
+  8027cf:	00 00 00 
+  8027d2:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8027d9:	00 00 00 
+  8027dc:	be 2a 02 00 00       	mov    $0x22a,%esi
+  8027e1:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  8027e8:	00 00 00 
+  8027eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f0:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8027f7:	00 00 00 
+  8027fa:	41 ff d0             	call   *%r8
+    assert(!is_page_present(diskaddr(1)));
+  8027fd:	48 b9 30 bf 80 00 00 	movabs $0x80bf30,%rcx
+  802804:	00 00 00 
+  802807:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  80280e:	00 00 00 
+  802811:	be 2e 02 00 00       	mov    $0x22e,%esi
+  802816:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  80281d:	00 00 00 
+  802820:	b8 00 00 00 00       	mov    $0x0,%eax
+  802825:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80282c:	00 00 00 
+  80282f:	41 ff d0             	call   *%r8
+    assert(strcmp(diskaddr(1), "OOPS!\n") == 0);
+  802832:	48 b9 c8 be 80 00 00 	movabs $0x80bec8,%rcx
+  802839:	00 00 00 
+  80283c:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  802843:	00 00 00 
+  802846:	be 31 02 00 00       	mov    $0x231,%esi
+  80284b:	48 bf ec be 80 00 00 	movabs $0x80beec,%rdi
+  802852:	00 00 00 
+  802855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80285a:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802861:	00 00 00 
+  802864:	41 ff d0             	call   *%r8
+
+0000000000802867 <file_extent_blocks>:
+ * Sets *plast to the last extent in use, NULL if there is none */
+static blockno_t
+file_extent_blocks(struct File *f, struct Extent **plast) {
+    blockno_t nblocks = 0;
+
+    *plast = NULL;
+  802867:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  80286e:	48 8d 87 88 00 00 00 	lea    0x88(%rdi),%rax
+  802875:	48 81 c7 f0 00 00 00 	add    $0xf0,%rdi
+    blockno_t nblocks = 0;
+  80287c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  802881:	48 39 f8             	cmp    %rdi,%rax
+  802884:	73 15                	jae    80289b <file_extent_blocks+0x34>
+  802886:	8b 50 04             	mov    0x4(%rax),%edx
+  802889:	85 d2                	test   %edx,%edx
+  80288b:	74 0e                	je     80289b <file_extent_blocks+0x34>
+        nblocks += ext->e_len;
+  80288d:	01 d1                	add    %edx,%ecx
+        *plast = ext;
+  80288f:	48 89 06             	mov    %rax,(%rsi)
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  802892:	48 83 c0 08          	add    $0x8,%rax
+  802896:	48 39 f8             	cmp    %rdi,%rax
+  802899:	75 eb                	jne    802886 <file_extent_blocks+0x1f>
+    }
+    return nblocks;
+}
+  80289b:	89 c8                	mov    %ecx,%eax
+  80289d:	c3                   	ret
+
+000000000080289e <dir_hash>:
+
+static uint32_t
+dir_hash(const char *name) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+    while (*name)
+  80289e:	0f b6 17             	movzbl (%rdi),%edx
+  8028a1:	84 d2                	test   %dl,%dl
+  8028a3:	74 1c                	je     8028c1 <dir_hash+0x23>
+    uint32_t hash = 2166136261U;
+  8028a5:	b8 c5 9d 1c 81       	mov    $0x811c9dc5,%eax
+        hash = (hash ^ (uint8_t)*name++) * 16777619U;
+  8028aa:	48 83 c7 01          	add    $0x1,%rdi
+  8028ae:	0f b6 d2             	movzbl %dl,%edx
+  8028b1:	31 d0                	xor    %edx,%eax
+  8028b3:	69 c0 93 01 00 01    	imul   $0x1000193,%eax,%eax
+    while (*name)
+  8028b9:	0f b6 17             	movzbl (%rdi),%edx
+  8028bc:	84 d2                	test   %dl,%dl
+  8028be:	75 ea                	jne    8028aa <dir_hash+0xc>
+  8028c0:	c3                   	ret
+    uint32_t hash = 2166136261U;
+  8028c1:	b8 c5 9d 1c 81       	mov    $0x811c9dc5,%eax
+    return hash;
+}
+  8028c6:	c3                   	ret
+
+00000000008028c7 <alloc_scan>:
+alloc_scan(blockno_t start, blockno_t end) {
+  8028c7:	89 f9                	mov    %edi,%ecx
+  8028c9:	89 f7                	mov    %esi,%edi
+    for (blockno_t blockno = start; blockno < end;) {
+  8028cb:	39 f1                	cmp    %esi,%ecx
+  8028cd:	73 6e                	jae    80293d <alloc_scan+0x76>
+        uint32_t word = bitmap[blockno / 32] & (~0U << (blockno % 32));
+  8028cf:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  8028d6:	00 00 00 
+        if (!bitmap_nfree[blockno / BLKBITSIZE]) {
+  8028d9:	49 b8 80 c1 84 00 00 	movabs $0x84c180,%r8
+  8028e0:	00 00 00 
+        uint32_t word = bitmap[blockno / 32] & (~0U << (blockno % 32));
+  8028e3:	41 b9 ff ff ff ff    	mov    $0xffffffff,%r9d
+  8028e9:	eb 18                	jmp    802903 <alloc_scan+0x3c>
+            blockno = ROUNDDOWN(blockno, BLKBITSIZE) + BLKBITSIZE;
+  8028eb:	81 e1 00 80 ff ff    	and    $0xffff8000,%ecx
+  8028f1:	81 c1 00 80 00 00    	add    $0x8000,%ecx
+            continue;
+  8028f7:	eb 06                	jmp    8028ff <alloc_scan+0x38>
+        blockno = ROUNDDOWN(blockno, 32) + 32;
+  8028f9:	83 e1 e0             	and    $0xffffffe0,%ecx
+  8028fc:	83 c1 20             	add    $0x20,%ecx
+    for (blockno_t blockno = start; blockno < end;) {
+  8028ff:	39 f9                	cmp    %edi,%ecx
+  802901:	73 34                	jae    802937 <alloc_scan+0x70>
+        if (!bitmap_nfree[blockno / BLKBITSIZE]) {
+  802903:	89 ca                	mov    %ecx,%edx
+  802905:	c1 ea 0f             	shr    $0xf,%edx
+  802908:	89 d2                	mov    %edx,%edx
+  80290a:	41 83 3c 90 00       	cmpl   $0x0,(%r8,%rdx,4)
+  80290f:	74 da                	je     8028eb <alloc_scan+0x24>
+        uint32_t word = bitmap[blockno / 32] & (~0U << (blockno % 32));
+  802911:	89 ca                	mov    %ecx,%edx
+  802913:	c1 ea 05             	shr    $0x5,%edx
+  802916:	89 d2                	mov    %edx,%edx
+  802918:	44 89 ce             	mov    %r9d,%esi
+  80291b:	d3 e6                	shl    %cl,%esi
+        if (word) {
+  80291d:	23 34 90             	and    (%rax,%rdx,4),%esi
+  802920:	74 d7                	je     8028f9 <alloc_scan+0x32>
+            blockno = ROUNDDOWN(blockno, 32) + __builtin_ctz(word);
+  802922:	83 e1 e0             	and    $0xffffffe0,%ecx
+  802925:	f3 0f bc f6          	tzcnt  %esi,%esi
+  802929:	8d 04 0e             	lea    (%rsi,%rcx,1),%eax
+            return blockno < end ? blockno : 0;
+  80292c:	39 f8                	cmp    %edi,%eax
+  80292e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802933:	0f 43 c2             	cmovae %edx,%eax
+  802936:	c3                   	ret
+    return 0;
+  802937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80293c:	c3                   	ret
+  80293d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802942:	c3                   	ret
+
+0000000000802943 <dir_index_bucket>:
+    if (file_get_block(dir, slot / BLKFILES, &blk) < 0) return NULL;
+    return (struct File *)blk + slot % BLKFILES;
+}
+
+static uint32_t *
+dir_index_bucket(struct DirIndex *idx, uint32_t hash) {
+  802943:	55                   	push   %rbp
+  802944:	48 89 e5             	mov    %rsp,%rbp
+  802947:	53                   	push   %rbx
+  802948:	48 83 ec 08          	sub    $0x8,%rsp
+    uint32_t bucket = hash & (idx->di_nblocks * DIRINDEX_NBUCKETS - 1);
+  80294c:	8b 1f                	mov    (%rdi),%ebx
+  80294e:	c1 e3 0a             	shl    $0xa,%ebx
+  802951:	83 eb 01             	sub    $0x1,%ebx
+  802954:	21 f3                	and    %esi,%ebx
+    uint32_t *blk = diskaddr(idx->di_buckets[bucket / DIRINDEX_NBUCKETS]);
+  802956:	89 d8                	mov    %ebx,%eax
+  802958:	c1 e8 0a             	shr    $0xa,%eax
+  80295b:	89 c0                	mov    %eax,%eax
+  80295d:	8b 7c 87 0c          	mov    0xc(%rdi,%rax,4),%edi
+  802961:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+    return &blk[bucket % DIRINDEX_NBUCKETS];
+  80296d:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  802973:	48 8d 04 98          	lea    (%rax,%rbx,4),%rax
+}
+  802977:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80297b:	c9                   	leave
+  80297c:	c3                   	ret
+
+000000000080297d <dir_index_flush>:
+}
+
+/* Write out the index of dir */
+static void
+dir_index_flush(struct File *dir) {
+    if (!dir->f_dirindex) return;
+  80297d:	8b bf f8 00 00 00    	mov    0xf8(%rdi),%edi
+  802983:	85 ff                	test   %edi,%edi
+  802985:	75 01                	jne    802988 <dir_index_flush+0xb>
+  802987:	c3                   	ret
+dir_index_flush(struct File *dir) {
+  802988:	55                   	push   %rbp
+  802989:	48 89 e5             	mov    %rsp,%rbp
+  80298c:	41 56                	push   %r14
+  80298e:	41 55                	push   %r13
+  802990:	41 54                	push   %r12
+  802992:	53                   	push   %rbx
+
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  802993:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80299a:	00 00 00 
+  80299d:	ff d0                	call   *%rax
+  80299f:	49 89 c4             	mov    %rax,%r12
+    for (uint32_t i = 0; i < idx->di_nblocks; i++)
+  8029a2:	83 38 00             	cmpl   $0x0,(%rax)
+  8029a5:	74 32                	je     8029d9 <dir_index_flush+0x5c>
+  8029a7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        flush_block_deferred(diskaddr(idx->di_buckets[i]));
+  8029ac:	49 be d0 14 80 00 00 	movabs $0x8014d0,%r14
+  8029b3:	00 00 00 
+  8029b6:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  8029bd:	00 00 00 
+  8029c0:	89 d8                	mov    %ebx,%eax
+  8029c2:	41 8b 7c 84 0c       	mov    0xc(%r12,%rax,4),%edi
+  8029c7:	41 ff d6             	call   *%r14
+  8029ca:	48 89 c7             	mov    %rax,%rdi
+  8029cd:	41 ff d5             	call   *%r13
+    for (uint32_t i = 0; i < idx->di_nblocks; i++)
+  8029d0:	83 c3 01             	add    $0x1,%ebx
+  8029d3:	41 3b 1c 24          	cmp    (%r12),%ebx
+  8029d7:	72 e7                	jb     8029c0 <dir_index_flush+0x43>
+    flush_block_deferred(idx);
+  8029d9:	4c 89 e7             	mov    %r12,%rdi
+  8029dc:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+}
+  8029e8:	5b                   	pop    %rbx
+  8029e9:	41 5c                	pop    %r12
+  8029eb:	41 5d                	pop    %r13
+  8029ed:	41 5e                	pop    %r14
+  8029ef:	5d                   	pop    %rbp
+  8029f0:	c3                   	ret
+
+00000000008029f1 <check_super>:
+check_super(void) {
+  8029f1:	55                   	push   %rbp
+  8029f2:	48 89 e5             	mov    %rsp,%rbp
+    if (super->s_magic != FS_MAGIC)
+  8029f5:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  8029fc:	00 00 00 
+  8029ff:	8b 08                	mov    (%rax),%ecx
+  802a01:	81 f9 ae 31 05 4a    	cmp    $0x4a0531ae,%ecx
+  802a07:	75 26                	jne    802a2f <check_super+0x3e>
+    if (super->s_nblocks > DISKSIZE / BLKSIZE)
+  802a09:	81 78 04 00 00 0c 00 	cmpl   $0xc0000,0x4(%rax)
+  802a10:	77 48                	ja     802a5a <check_super+0x69>
+    cprintf("superblock is good\n");
+  802a12:	48 bf ab bf 80 00 00 	movabs $0x80bfab,%rdi
+  802a19:	00 00 00 
+  802a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a21:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  802a28:	00 00 00 
+  802a2b:	ff d2                	call   *%rdx
+}
+  802a2d:	5d                   	pop    %rbp
+  802a2e:	c3                   	ret
+        panic("bad file system magic number %08x", super->s_magic);
+  802a2f:	48 ba 68 bf 80 00 00 	movabs $0x80bf68,%rdx
+  802a36:	00 00 00 
+  802a39:	be 18 00 00 00       	mov    $0x18,%esi
+  802a3e:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802a45:	00 00 00 
+  802a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a4d:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802a54:	00 00 00 
+  802a57:	41 ff d0             	call   *%r8
+        panic("file system is too large");
+  802a5a:	48 ba 92 bf 80 00 00 	movabs $0x80bf92,%rdx
+  802a61:	00 00 00 
+  802a64:	be 1b 00 00 00       	mov    $0x1b,%esi
+  802a69:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802a70:	00 00 00 
+  802a73:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a78:	48 b9 81 73 80 00 00 	movabs $0x807381,%rcx
+  802a7f:	00 00 00 
+  802a82:	ff d1                	call   *%rcx
+
+0000000000802a84 <block_is_free>:
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  802a84:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  802a8b:	00 00 00 
+  802a8e:	48 85 c0             	test   %rax,%rax
+  802a91:	74 2d                	je     802ac0 <block_is_free+0x3c>
+  802a93:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a98:	3b 78 04             	cmp    0x4(%rax),%edi
+  802a9b:	73 20                	jae    802abd <block_is_free+0x39>
+    if (TSTBIT(bitmap, blockno)) return 1;
+  802a9d:	89 fe                	mov    %edi,%esi
+  802a9f:	c1 ee 05             	shr    $0x5,%esi
+  802aa2:	89 f6                	mov    %esi,%esi
+  802aa4:	ba 01 00 00 00       	mov    $0x1,%edx
+  802aa9:	89 f9                	mov    %edi,%ecx
+  802aab:	d3 e2                	shl    %cl,%edx
+  802aad:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  802ab4:	00 00 00 
+  802ab7:	23 14 b0             	and    (%rax,%rsi,4),%edx
+  802aba:	0f 95 c2             	setne  %dl
+}
+  802abd:	89 d0                	mov    %edx,%eax
+  802abf:	c3                   	ret
+    if (super == 0 || blockno >= super->s_nblocks) return 0;
+  802ac0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac5:	eb f6                	jmp    802abd <block_is_free+0x39>
+
+0000000000802ac7 <free_block>:
+free_block(uint32_t blockno) {
+  802ac7:	55                   	push   %rbp
+  802ac8:	48 89 e5             	mov    %rsp,%rbp
+  802acb:	53                   	push   %rbx
+  802acc:	48 83 ec 08          	sub    $0x8,%rsp
+    if (blockno == 0) panic("attempt to free zero block");
+  802ad0:	85 ff                	test   %edi,%edi
+  802ad2:	74 73                	je     802b47 <free_block+0x80>
+  802ad4:	89 fb                	mov    %edi,%ebx
+    if (!TSTBIT(bitmap, blockno)) bitmap_nfree[blockno / BLKBITSIZE]++;
+  802ad6:	89 fa                	mov    %edi,%edx
+  802ad8:	c1 ea 05             	shr    $0x5,%edx
+  802adb:	89 d2                	mov    %edx,%edx
+  802add:	48 c1 e2 02          	shl    $0x2,%rdx
+  802ae1:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  802ae8:	00 00 00 
+  802aeb:	48 01 d0             	add    %rdx,%rax
+  802aee:	8b 30                	mov    (%rax),%esi
+  802af0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802af5:	89 d9                	mov    %ebx,%ecx
+  802af7:	d3 e7                	shl    %cl,%edi
+  802af9:	89 f9                	mov    %edi,%ecx
+  802afb:	85 fe                	test   %edi,%esi
+  802afd:	75 16                	jne    802b15 <free_block+0x4e>
+  802aff:	89 df                	mov    %ebx,%edi
+  802b01:	c1 ef 0f             	shr    $0xf,%edi
+  802b04:	89 ff                	mov    %edi,%edi
+  802b06:	49 b8 80 c1 84 00 00 	movabs $0x84c180,%r8
+  802b0d:	00 00 00 
+  802b10:	41 83 04 b8 01       	addl   $0x1,(%r8,%rdi,4)
+    SETBIT(bitmap, blockno);
+  802b15:	09 ce                	or     %ecx,%esi
+  802b17:	89 30                	mov    %esi,(%rax)
+    bc_mark_dirty(&bitmap[blockno / 32]);
+  802b19:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  802b20:	00 00 00 
+  802b23:	48 8d 3c 02          	lea    (%rdx,%rax,1),%rdi
+  802b27:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+    bc_forget(blockno);
+  802b33:	89 df                	mov    %ebx,%edi
+  802b35:	48 b8 89 21 80 00 00 	movabs $0x802189,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+}
+  802b41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802b45:	c9                   	leave
+  802b46:	c3                   	ret
+    if (blockno == 0) panic("attempt to free zero block");
+  802b47:	48 ba bf bf 80 00 00 	movabs $0x80bfbf,%rdx
+  802b4e:	00 00 00 
+  802b51:	be 31 00 00 00       	mov    $0x31,%esi
+  802b56:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802b5d:	00 00 00 
+  802b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b65:	48 b9 81 73 80 00 00 	movabs $0x807381,%rcx
+  802b6c:	00 00 00 
+  802b6f:	ff d1                	call   *%rcx
+
+0000000000802b71 <dir_index_drop>:
+dir_index_drop(struct File *dir) {
+  802b71:	55                   	push   %rbp
+  802b72:	48 89 e5             	mov    %rsp,%rbp
+  802b75:	41 56                	push   %r14
+  802b77:	41 55                	push   %r13
+  802b79:	41 54                	push   %r12
+  802b7b:	53                   	push   %rbx
+  802b7c:	49 89 fd             	mov    %rdi,%r13
+    if (!dir->f_dirindex) return;
+  802b7f:	8b bf f8 00 00 00    	mov    0xf8(%rdi),%edi
+  802b85:	85 ff                	test   %edi,%edi
+  802b87:	75 09                	jne    802b92 <dir_index_drop+0x21>
+}
+  802b89:	5b                   	pop    %rbx
+  802b8a:	41 5c                	pop    %r12
+  802b8c:	41 5d                	pop    %r13
+  802b8e:	41 5e                	pop    %r14
+  802b90:	5d                   	pop    %rbp
+  802b91:	c3                   	ret
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  802b92:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  802b99:	00 00 00 
+  802b9c:	ff d0                	call   *%rax
+    for (uint32_t i = 0; i < DIRINDEX_MAXBLOCKS; i++)
+  802b9e:	48 8d 58 0c          	lea    0xc(%rax),%rbx
+  802ba2:	4c 8d a0 00 10 00 00 	lea    0x1000(%rax),%r12
+        if (idx->di_buckets[i]) free_block(idx->di_buckets[i]);
+  802ba9:	49 be c7 2a 80 00 00 	movabs $0x802ac7,%r14
+  802bb0:	00 00 00 
+  802bb3:	eb 09                	jmp    802bbe <dir_index_drop+0x4d>
+    for (uint32_t i = 0; i < DIRINDEX_MAXBLOCKS; i++)
+  802bb5:	48 83 c3 04          	add    $0x4,%rbx
+  802bb9:	4c 39 e3             	cmp    %r12,%rbx
+  802bbc:	74 0b                	je     802bc9 <dir_index_drop+0x58>
+        if (idx->di_buckets[i]) free_block(idx->di_buckets[i]);
+  802bbe:	8b 3b                	mov    (%rbx),%edi
+  802bc0:	85 ff                	test   %edi,%edi
+  802bc2:	74 f1                	je     802bb5 <dir_index_drop+0x44>
+  802bc4:	41 ff d6             	call   *%r14
+  802bc7:	eb ec                	jmp    802bb5 <dir_index_drop+0x44>
+    free_block(dir->f_dirindex);
+  802bc9:	41 8b bd f8 00 00 00 	mov    0xf8(%r13),%edi
+  802bd0:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  802bd7:	00 00 00 
+  802bda:	ff d0                	call   *%rax
+    dir->f_dirindex = 0;
+  802bdc:	41 c7 85 f8 00 00 00 	movl   $0x0,0xf8(%r13)
+  802be3:	00 00 00 00 
+    bc_mark_dirty(dir);
+  802be7:	4c 89 ef             	mov    %r13,%rdi
+  802bea:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  802bf1:	00 00 00 
+  802bf4:	ff d0                	call   *%rax
+  802bf6:	eb 91                	jmp    802b89 <dir_index_drop+0x18>
+
+0000000000802bf8 <alloc_block_near>:
+alloc_block_near(blockno_t hint) {
+  802bf8:	55                   	push   %rbp
+  802bf9:	48 89 e5             	mov    %rsp,%rbp
+  802bfc:	41 54                	push   %r12
+  802bfe:	53                   	push   %rbx
+    if (!hint || hint >= super->s_nblocks) hint = alloc_cursor;
+  802bff:	85 ff                	test   %edi,%edi
+  802c01:	74 12                	je     802c15 <alloc_block_near+0x1d>
+  802c03:	41 89 fc             	mov    %edi,%r12d
+  802c06:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  802c0d:	00 00 00 
+  802c10:	3b 78 04             	cmp    0x4(%rax),%edi
+  802c13:	72 0d                	jb     802c22 <alloc_block_near+0x2a>
+  802c15:	48 b8 70 c1 84 00 00 	movabs $0x84c170,%rax
+  802c1c:	00 00 00 
+  802c1f:	44 8b 20             	mov    (%rax),%r12d
+    blockno_t blockno = alloc_scan(hint, super->s_nblocks);
+  802c22:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  802c29:	00 00 00 
+  802c2c:	8b 70 04             	mov    0x4(%rax),%esi
+  802c2f:	44 89 e7             	mov    %r12d,%edi
+  802c32:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  802c39:	00 00 00 
+  802c3c:	ff d0                	call   *%rax
+  802c3e:	89 c3                	mov    %eax,%ebx
+    if (!blockno) blockno = alloc_scan(1, hint);
+  802c40:	85 c0                	test   %eax,%eax
+  802c42:	75 1a                	jne    802c5e <alloc_block_near+0x66>
+  802c44:	44 89 e6             	mov    %r12d,%esi
+  802c47:	bf 01 00 00 00       	mov    $0x1,%edi
+  802c4c:	48 b8 c7 28 80 00 00 	movabs $0x8028c7,%rax
+  802c53:	00 00 00 
+  802c56:	ff d0                	call   *%rax
+  802c58:	89 c3                	mov    %eax,%ebx
+    if (!blockno) return 0;
+  802c5a:	85 c0                	test   %eax,%eax
+  802c5c:	74 56                	je     802cb4 <alloc_block_near+0xbc>
+    CLRBIT(bitmap, blockno);
+  802c5e:	89 df                	mov    %ebx,%edi
+  802c60:	c1 ef 05             	shr    $0x5,%edi
+  802c63:	89 ff                	mov    %edi,%edi
+  802c65:	48 c1 e7 02          	shl    $0x2,%rdi
+  802c69:	48 ba 60 c1 84 00 00 	movabs $0x84c160,%rdx
+  802c70:	00 00 00 
+  802c73:	48 89 fe             	mov    %rdi,%rsi
+  802c76:	48 03 32             	add    (%rdx),%rsi
+  802c79:	b8 fe ff ff ff       	mov    $0xfffffffe,%eax
+  802c7e:	89 d9                	mov    %ebx,%ecx
+  802c80:	d3 c0                	rol    %cl,%eax
+  802c82:	21 06                	and    %eax,(%rsi)
+    bitmap_nfree[blockno / BLKBITSIZE]--;
+  802c84:	89 d8                	mov    %ebx,%eax
+  802c86:	c1 e8 0f             	shr    $0xf,%eax
+  802c89:	89 c0                	mov    %eax,%eax
+  802c8b:	48 b9 80 c1 84 00 00 	movabs $0x84c180,%rcx
+  802c92:	00 00 00 
+  802c95:	83 2c 81 01          	subl   $0x1,(%rcx,%rax,4)
+    alloc_cursor = blockno + 1;
+  802c99:	8d 43 01             	lea    0x1(%rbx),%eax
+  802c9c:	a3 70 c1 84 00 00 00 	movabs %eax,0x84c170
+  802ca3:	00 00 
+    flush_block(&bitmap[blockno / 32]);
+  802ca5:	48 03 3a             	add    (%rdx),%rdi
+  802ca8:	48 b8 10 21 80 00 00 	movabs $0x802110,%rax
+  802caf:	00 00 00 
+  802cb2:	ff d0                	call   *%rax
+}
+  802cb4:	89 d8                	mov    %ebx,%eax
+  802cb6:	5b                   	pop    %rbx
+  802cb7:	41 5c                	pop    %r12
+  802cb9:	5d                   	pop    %rbp
+  802cba:	c3                   	ret
+
+0000000000802cbb <alloc_block>:
+alloc_block(void) {
+  802cbb:	55                   	push   %rbp
+  802cbc:	48 89 e5             	mov    %rsp,%rbp
+    return alloc_block_near(0);
+  802cbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc4:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  802ccb:	00 00 00 
+  802cce:	ff d0                	call   *%rax
+}
+  802cd0:	5d                   	pop    %rbp
+  802cd1:	c3                   	ret
+
+0000000000802cd2 <file_alloc_indirect>:
+file_alloc_indirect(void) {
+  802cd2:	55                   	push   %rbp
+  802cd3:	48 89 e5             	mov    %rsp,%rbp
+  802cd6:	41 54                	push   %r12
+  802cd8:	53                   	push   %rbx
+    blockno_t block = alloc_block();
+  802cd9:	48 b8 bb 2c 80 00 00 	movabs $0x802cbb,%rax
+  802ce0:	00 00 00 
+  802ce3:	ff d0                	call   *%rax
+  802ce5:	89 c3                	mov    %eax,%ebx
+    if (!block) return 0;
+  802ce7:	85 c0                	test   %eax,%eax
+  802ce9:	75 07                	jne    802cf2 <file_alloc_indirect+0x20>
+}
+  802ceb:	89 d8                	mov    %ebx,%eax
+  802ced:	5b                   	pop    %rbx
+  802cee:	41 5c                	pop    %r12
+  802cf0:	5d                   	pop    %rbp
+  802cf1:	c3                   	ret
+    memset(diskaddr(block), 0, BLKSIZE);
+  802cf2:	89 c7                	mov    %eax,%edi
+  802cf4:	49 bc d0 14 80 00 00 	movabs $0x8014d0,%r12
+  802cfb:	00 00 00 
+  802cfe:	41 ff d4             	call   *%r12
+  802d01:	48 89 c7             	mov    %rax,%rdi
+  802d04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d09:	be 00 00 00 00       	mov    $0x0,%esi
+  802d0e:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+    bc_mark_dirty(diskaddr(block));
+  802d1a:	89 df                	mov    %ebx,%edi
+  802d1c:	41 ff d4             	call   *%r12
+  802d1f:	48 89 c7             	mov    %rax,%rdi
+  802d22:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+    return block;
+  802d2e:	eb bb                	jmp    802ceb <file_alloc_indirect+0x19>
+
+0000000000802d30 <check_bitmap>:
+check_bitmap(void) {
+  802d30:	55                   	push   %rbp
+  802d31:	48 89 e5             	mov    %rsp,%rbp
+  802d34:	41 55                	push   %r13
+  802d36:	41 54                	push   %r12
+  802d38:	53                   	push   %rbx
+  802d39:	48 83 ec 08          	sub    $0x8,%rsp
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  802d3d:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  802d44:	00 00 00 
+  802d47:	8b 40 04             	mov    0x4(%rax),%eax
+  802d4a:	85 c0                	test   %eax,%eax
+  802d4c:	74 2a                	je     802d78 <check_bitmap+0x48>
+  802d4e:	41 89 c4             	mov    %eax,%r12d
+  802d51:	bb 00 00 00 00       	mov    $0x0,%ebx
+        assert(!block_is_free(2 + i));
+  802d56:	49 bd 84 2a 80 00 00 	movabs $0x802a84,%r13
+  802d5d:	00 00 00 
+  802d60:	8d 7b 02             	lea    0x2(%rbx),%edi
+  802d63:	41 ff d5             	call   *%r13
+  802d66:	84 c0                	test   %al,%al
+  802d68:	75 62                	jne    802dcc <check_bitmap+0x9c>
+    for (uint32_t i = 0; i * BLKBITSIZE < super->s_nblocks; i++)
+  802d6a:	83 c3 01             	add    $0x1,%ebx
+  802d6d:	89 d8                	mov    %ebx,%eax
+  802d6f:	48 c1 e0 0f          	shl    $0xf,%rax
+  802d73:	4c 39 e0             	cmp    %r12,%rax
+  802d76:	7c e8                	jl     802d60 <check_bitmap+0x30>
+    assert(!block_is_free(1));
+  802d78:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d7d:	48 b8 84 2a 80 00 00 	movabs $0x802a84,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+  802d89:	84 c0                	test   %al,%al
+  802d8b:	75 74                	jne    802e01 <check_bitmap+0xd1>
+    assert(!block_is_free(0));
+  802d8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d92:	48 b8 84 2a 80 00 00 	movabs $0x802a84,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+  802d9e:	84 c0                	test   %al,%al
+  802da0:	0f 85 90 00 00 00    	jne    802e36 <check_bitmap+0x106>
+    cprintf("bitmap is good\n");
+  802da6:	48 bf 14 c0 80 00 00 	movabs $0x80c014,%rdi
+  802dad:	00 00 00 
+  802db0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802db5:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  802dbc:	00 00 00 
+  802dbf:	ff d2                	call   *%rdx
+}
+  802dc1:	48 83 c4 08          	add    $0x8,%rsp
+  802dc5:	5b                   	pop    %rbx
+  802dc6:	41 5c                	pop    %r12
+  802dc8:	41 5d                	pop    %r13
+  802dca:	5d                   	pop    %rbp
+  802dcb:	c3                   	ret
+        assert(!block_is_free(2 + i));
+  802dcc:	48 b9 da bf 80 00 00 	movabs $0x80bfda,%rcx
+  802dd3:	00 00 00 
+  802dd6:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  802ddd:	00 00 00 
+  802de0:	be 7f 00 00 00       	mov    $0x7f,%esi
+  802de5:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802dec:	00 00 00 
+  802def:	b8 00 00 00 00       	mov    $0x0,%eax
+  802df4:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802dfb:	00 00 00 
+  802dfe:	41 ff d0             	call   *%r8
+    assert(!block_is_free(1));
+  802e01:	48 b9 f0 bf 80 00 00 	movabs $0x80bff0,%rcx
+  802e08:	00 00 00 
+  802e0b:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  802e12:	00 00 00 
+  802e15:	be 83 00 00 00       	mov    $0x83,%esi
+  802e1a:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802e21:	00 00 00 
+  802e24:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e29:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802e30:	00 00 00 
+  802e33:	41 ff d0             	call   *%r8
+    assert(!block_is_free(0));
+  802e36:	48 b9 02 c0 80 00 00 	movabs $0x80c002,%rcx
+  802e3d:	00 00 00 
+  802e40:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  802e47:	00 00 00 
+  802e4a:	be 84 00 00 00       	mov    $0x84,%esi
+  802e4f:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  802e56:	00 00 00 
+  802e59:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e5e:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  802e65:	00 00 00 
+  802e68:	41 ff d0             	call   *%r8
+
+0000000000802e6b <fs_init>:
+fs_init(void) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+  802e6f:	41 57                	push   %r15
+  802e71:	41 56                	push   %r14
+  802e73:	41 55                	push   %r13
+  802e75:	41 54                	push   %r12
+  802e77:	53                   	push   %rbx
+  802e78:	48 83 ec 18          	sub    $0x18,%rsp
+    if (virtio_blk_init()) {
+  802e7c:	48 b8 35 0f 80 00 00 	movabs $0x800f35,%rax
+  802e83:	00 00 00 
+  802e86:	ff d0                	call   *%rax
+  802e88:	84 c0                	test   %al,%al
+  802e8a:	0f 84 9b 00 00 00    	je     802f2b <fs_init+0xc0>
+        disk = &virtio_disk;
+  802e90:	48 b8 e0 bc 80 00 00 	movabs $0x80bce0,%rax
+  802e97:	00 00 00 
+  802e9a:	48 a3 08 d0 80 00 00 	movabs %rax,0x80d008
+  802ea1:	00 00 00 
+    bc_init();
+  802ea4:	48 b8 69 25 80 00 00 	movabs $0x802569,%rax
+  802eab:	00 00 00 
+  802eae:	ff d0                	call   *%rax
+    super = diskaddr(1);
+  802eb0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802eb5:	49 bc d0 14 80 00 00 	movabs $0x8014d0,%r12
+  802ebc:	00 00 00 
+  802ebf:	41 ff d4             	call   *%r12
+  802ec2:	48 bb 68 c1 84 00 00 	movabs $0x84c168,%rbx
+  802ec9:	00 00 00 
+  802ecc:	48 89 03             	mov    %rax,(%rbx)
+    check_super();
+  802ecf:	48 b8 f1 29 80 00 00 	movabs $0x8029f1,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+    bitmap = diskaddr(2);
+  802edb:	bf 02 00 00 00       	mov    $0x2,%edi
+  802ee0:	41 ff d4             	call   *%r12
+  802ee3:	48 a3 60 c1 84 00 00 	movabs %rax,0x84c160
+  802eea:	00 00 00 
+    check_bitmap();
+  802eed:	48 b8 30 2d 80 00 00 	movabs $0x802d30,%rax
+  802ef4:	00 00 00 
+  802ef7:	ff d0                	call   *%rax
+    for (blockno_t blockno = 0; blockno < super->s_nblocks; blockno += 32) {
+  802ef9:	48 8b 03             	mov    (%rbx),%rax
+  802efc:	44 8b 78 04          	mov    0x4(%rax),%r15d
+  802f00:	45 85 ff             	test   %r15d,%r15d
+  802f03:	0f 84 b3 00 00 00    	je     802fbc <fs_init+0x151>
+        uint32_t word = bitmap[blockno / 32];
+  802f09:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  802f10:	00 00 00 
+  802f13:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+  802f17:	45 89 fd             	mov    %r15d,%r13d
+    for (blockno_t blockno = 0; blockno < super->s_nblocks; blockno += 32) {
+  802f1a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        bitmap_nfree[blockno / BLKBITSIZE] += __builtin_popcount(word);
+  802f1f:	49 be 80 c1 84 00 00 	movabs $0x84c180,%r14
+  802f26:	00 00 00 
+  802f29:	eb 6d                	jmp    802f98 <fs_init+0x12d>
+        if (ide_probe_disk1())
+  802f2b:	48 b8 30 06 80 00 00 	movabs $0x800630,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+  802f37:	84 c0                	test   %al,%al
+  802f39:	74 22                	je     802f5d <fs_init+0xf2>
+            ide_set_disk(1);
+  802f3b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f40:	48 b8 ba 06 80 00 00 	movabs $0x8006ba,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+        ide_dma_init();
+  802f4c:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  802f53:	00 00 00 
+  802f56:	ff d0                	call   *%rax
+  802f58:	e9 47 ff ff ff       	jmp    802ea4 <fs_init+0x39>
+            ide_set_disk(0);
+  802f5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f62:	48 b8 ba 06 80 00 00 	movabs $0x8006ba,%rax
+  802f69:	00 00 00 
+  802f6c:	ff d0                	call   *%rax
+  802f6e:	eb dc                	jmp    802f4c <fs_init+0xe1>
+        bitmap_nfree[blockno / BLKBITSIZE] += __builtin_popcount(word);
+  802f70:	41 89 dc             	mov    %ebx,%r12d
+  802f73:	41 c1 ec 0f          	shr    $0xf,%r12d
+  802f77:	45 89 e4             	mov    %r12d,%r12d
+  802f7a:	89 ff                	mov    %edi,%edi
+  802f7c:	48 b8 a0 bb 80 00 00 	movabs $0x80bba0,%rax
+  802f83:	00 00 00 
+  802f86:	ff d0                	call   *%rax
+  802f88:	43 01 04 a6          	add    %eax,(%r14,%r12,4)
+    for (blockno_t blockno = 0; blockno < super->s_nblocks; blockno += 32) {
+  802f8c:	83 c3 20             	add    $0x20,%ebx
+  802f8f:	41 83 ed 20          	sub    $0x20,%r13d
+  802f93:	44 39 fb             	cmp    %r15d,%ebx
+  802f96:	73 24                	jae    802fbc <fs_init+0x151>
+        uint32_t word = bitmap[blockno / 32];
+  802f98:	89 d8                	mov    %ebx,%eax
+  802f9a:	c1 e8 05             	shr    $0x5,%eax
+  802f9d:	89 c0                	mov    %eax,%eax
+  802f9f:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+  802fa3:	8b 3c 82             	mov    (%rdx,%rax,4),%edi
+        if (super->s_nblocks - blockno < 32) word &= (1U << (super->s_nblocks - blockno)) - 1;
+  802fa6:	41 83 fd 1f          	cmp    $0x1f,%r13d
+  802faa:	77 c4                	ja     802f70 <fs_init+0x105>
+  802fac:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  802fb1:	44 89 e9             	mov    %r13d,%ecx
+  802fb4:	d3 e0                	shl    %cl,%eax
+  802fb6:	f7 d0                	not    %eax
+  802fb8:	21 c7                	and    %eax,%edi
+  802fba:	eb b4                	jmp    802f70 <fs_init+0x105>
+    alloc_cursor = 1;
+  802fbc:	48 b8 70 c1 84 00 00 	movabs $0x84c170,%rax
+  802fc3:	00 00 00 
+  802fc6:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+}
+  802fcc:	48 83 c4 18          	add    $0x18,%rsp
+  802fd0:	5b                   	pop    %rbx
+  802fd1:	41 5c                	pop    %r12
+  802fd3:	41 5d                	pop    %r13
+  802fd5:	41 5e                	pop    %r14
+  802fd7:	41 5f                	pop    %r15
+  802fd9:	5d                   	pop    %rbp
+  802fda:	c3                   	ret
+
+0000000000802fdb <file_block_walk>:
+    if (filebno >= MAXFILEBLOCKS) return -E_INVAL;
+  802fdb:	81 fe ff 03 10 00    	cmp    $0x1003ff,%esi
+  802fe1:	0f 87 75 01 00 00    	ja     80315c <file_block_walk+0x181>
+file_block_walk(struct File *f, blockno_t filebno, blockno_t **ppdiskbno, bool alloc) {
+  802fe7:	55                   	push   %rbp
+  802fe8:	48 89 e5             	mov    %rsp,%rbp
+  802feb:	41 56                	push   %r14
+  802fed:	41 55                	push   %r13
+  802fef:	41 54                	push   %r12
+  802ff1:	53                   	push   %rbx
+  802ff2:	49 89 fc             	mov    %rdi,%r12
+  802ff5:	89 f3                	mov    %esi,%ebx
+  802ff7:	49 89 d5             	mov    %rdx,%r13
+  802ffa:	41 89 ce             	mov    %ecx,%r14d
+    if (filebno < NINDIRECT) {
+  802ffd:	81 fe ff 03 00 00    	cmp    $0x3ff,%esi
+  803003:	77 68                	ja     80306d <file_block_walk+0x92>
+        if (!f->f_indirect) {
+  803005:	83 bf f0 00 00 00 00 	cmpl   $0x0,0xf0(%rdi)
+  80300c:	75 33                	jne    803041 <file_block_walk+0x66>
+            if (!alloc) return -E_NOT_FOUND;
+  80300e:	84 c9                	test   %cl,%cl
+  803010:	0f 84 4c 01 00 00    	je     803162 <file_block_walk+0x187>
+            if (!(f->f_indirect = file_alloc_indirect())) return -E_NO_DISK;
+  803016:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  80301d:	00 00 00 
+  803020:	ff d0                	call   *%rax
+  803022:	41 89 84 24 f0 00 00 	mov    %eax,0xf0(%r12)
+  803029:	00 
+  80302a:	85 c0                	test   %eax,%eax
+  80302c:	0f 84 3a 01 00 00    	je     80316c <file_block_walk+0x191>
+            bc_mark_dirty(f);
+  803032:	4c 89 e7             	mov    %r12,%rdi
+  803035:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+        *ppdiskbno = (blockno_t *)diskaddr(f->f_indirect) + filebno;
+  803041:	41 8b bc 24 f0 00 00 	mov    0xf0(%r12),%edi
+  803048:	00 
+  803049:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  803050:	00 00 00 
+  803053:	ff d0                	call   *%rax
+  803055:	89 db                	mov    %ebx,%ebx
+  803057:	48 8d 04 98          	lea    (%rax,%rbx,4),%rax
+  80305b:	49 89 45 00          	mov    %rax,0x0(%r13)
+        return 0;
+  80305f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803064:	5b                   	pop    %rbx
+  803065:	41 5c                	pop    %r12
+  803067:	41 5d                	pop    %r13
+  803069:	41 5e                	pop    %r14
+  80306b:	5d                   	pop    %rbp
+  80306c:	c3                   	ret
+    filebno -= NINDIRECT;
+  80306d:	81 eb 00 04 00 00    	sub    $0x400,%ebx
+    if (!f->f_dindirect) {
+  803073:	8b bf f4 00 00 00    	mov    0xf4(%rdi),%edi
+  803079:	85 ff                	test   %edi,%edi
+  80307b:	0f 85 ab 00 00 00    	jne    80312c <file_block_walk+0x151>
+        if (!alloc) return -E_NOT_FOUND;
+  803081:	84 c9                	test   %cl,%cl
+  803083:	0f 84 ed 00 00 00    	je     803176 <file_block_walk+0x19b>
+        if (!(f->f_dindirect = file_alloc_indirect())) return -E_NO_DISK;
+  803089:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  803090:	00 00 00 
+  803093:	ff d0                	call   *%rax
+  803095:	41 89 84 24 f4 00 00 	mov    %eax,0xf4(%r12)
+  80309c:	00 
+  80309d:	85 c0                	test   %eax,%eax
+  80309f:	0f 84 db 00 00 00    	je     803180 <file_block_walk+0x1a5>
+        bc_mark_dirty(f);
+  8030a5:	4c 89 e7             	mov    %r12,%rdi
+  8030a8:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8030af:	00 00 00 
+  8030b2:	ff d0                	call   *%rax
+    blockno_t *dind = diskaddr(f->f_dindirect);
+  8030b4:	41 8b bc 24 f4 00 00 	mov    0xf4(%r12),%edi
+  8030bb:	00 
+  8030bc:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  8030c3:	00 00 00 
+  8030c6:	ff d0                	call   *%rax
+  8030c8:	48 89 c2             	mov    %rax,%rdx
+    blockno_t *slot = &dind[filebno / NINDIRECT];
+  8030cb:	89 d8                	mov    %ebx,%eax
+  8030cd:	c1 e8 0a             	shr    $0xa,%eax
+  8030d0:	89 c0                	mov    %eax,%eax
+  8030d2:	4c 8d 24 82          	lea    (%rdx,%rax,4),%r12
+    if (!*slot) {
+  8030d6:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  8030db:	75 27                	jne    803104 <file_block_walk+0x129>
+        if (!(*slot = file_alloc_indirect())) return -E_NO_DISK;
+  8030dd:	48 b8 d2 2c 80 00 00 	movabs $0x802cd2,%rax
+  8030e4:	00 00 00 
+  8030e7:	ff d0                	call   *%rax
+  8030e9:	41 89 04 24          	mov    %eax,(%r12)
+  8030ed:	85 c0                	test   %eax,%eax
+  8030ef:	0f 84 95 00 00 00    	je     80318a <file_block_walk+0x1af>
+        bc_mark_dirty(slot);
+  8030f5:	4c 89 e7             	mov    %r12,%rdi
+  8030f8:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8030ff:	00 00 00 
+  803102:	ff d0                	call   *%rax
+    *ppdiskbno = (blockno_t *)diskaddr(*slot) + filebno % NINDIRECT;
+  803104:	41 8b 3c 24          	mov    (%r12),%edi
+  803108:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+  803114:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+  80311a:	48 8d 04 98          	lea    (%rax,%rbx,4),%rax
+  80311e:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return 0;
+  803122:	b8 00 00 00 00       	mov    $0x0,%eax
+  803127:	e9 38 ff ff ff       	jmp    803064 <file_block_walk+0x89>
+    blockno_t *dind = diskaddr(f->f_dindirect);
+  80312c:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  803133:	00 00 00 
+  803136:	ff d0                	call   *%rax
+  803138:	48 89 c2             	mov    %rax,%rdx
+    blockno_t *slot = &dind[filebno / NINDIRECT];
+  80313b:	89 d8                	mov    %ebx,%eax
+  80313d:	c1 e8 0a             	shr    $0xa,%eax
+  803140:	89 c0                	mov    %eax,%eax
+  803142:	4c 8d 24 82          	lea    (%rdx,%rax,4),%r12
+    if (!*slot) {
+  803146:	41 83 3c 24 00       	cmpl   $0x0,(%r12)
+  80314b:	75 b7                	jne    803104 <file_block_walk+0x129>
+        if (!alloc) return -E_NOT_FOUND;
+  80314d:	45 84 f6             	test   %r14b,%r14b
+  803150:	75 8b                	jne    8030dd <file_block_walk+0x102>
+  803152:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803157:	e9 08 ff ff ff       	jmp    803064 <file_block_walk+0x89>
+    if (filebno >= MAXFILEBLOCKS) return -E_INVAL;
+  80315c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  803161:	c3                   	ret
+            if (!alloc) return -E_NOT_FOUND;
+  803162:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  803167:	e9 f8 fe ff ff       	jmp    803064 <file_block_walk+0x89>
+            if (!(f->f_indirect = file_alloc_indirect())) return -E_NO_DISK;
+  80316c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803171:	e9 ee fe ff ff       	jmp    803064 <file_block_walk+0x89>
+        if (!alloc) return -E_NOT_FOUND;
+  803176:	b8 f1 ff ff ff       	mov    $0xfffffff1,%eax
+  80317b:	e9 e4 fe ff ff       	jmp    803064 <file_block_walk+0x89>
+        if (!(f->f_dindirect = file_alloc_indirect())) return -E_NO_DISK;
+  803180:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803185:	e9 da fe ff ff       	jmp    803064 <file_block_walk+0x89>
+        if (!(*slot = file_alloc_indirect())) return -E_NO_DISK;
+  80318a:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  80318f:	e9 d0 fe ff ff       	jmp    803064 <file_block_walk+0x89>
+
+0000000000803194 <file_truncate_blocks>:
+ * Blocks mapped by the indirect blocks go first, then the extents
+ * are cut down. Indirect blocks that no longer map anything are
+ * freed as well and their pointers are cleared.
+ * Do not change f->f_size. */
+static void
+file_truncate_blocks(struct File *f, off_t newsize) {
+  803194:	55                   	push   %rbp
+  803195:	48 89 e5             	mov    %rsp,%rbp
+  803198:	41 57                	push   %r15
+  80319a:	41 56                	push   %r14
+  80319c:	41 55                	push   %r13
+  80319e:	41 54                	push   %r12
+  8031a0:	53                   	push   %rbx
+  8031a1:	48 83 ec 38          	sub    $0x38,%rsp
+  8031a5:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    blockno_t old_nblocks = CEILDIV(f->f_size, BLKSIZE);
+  8031a9:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  8031b0:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8031b6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031ba:	49 89 c4             	mov    %rax,%r12
+  8031bd:	41 89 c6             	mov    %eax,%r14d
+    blockno_t new_nblocks = CEILDIV(newsize, BLKSIZE);
+  8031c0:	48 63 c6             	movslq %esi,%rax
+  8031c3:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  8031c9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8031cd:	48 89 c3             	mov    %rax,%rbx
+  8031d0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+  8031d4:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    struct Extent *last;
+    blockno_t ext_nblocks = file_extent_blocks(f, &last);
+  8031d7:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8031db:	48 b8 67 28 80 00 00 	movabs $0x802867,%rax
+  8031e2:	00 00 00 
+  8031e5:	ff d0                	call   *%rax
+  8031e7:	89 45 b0             	mov    %eax,-0x50(%rbp)
+
+    for (blockno_t bno = MAX(new_nblocks, ext_nblocks); bno < old_nblocks; bno++) {
+  8031ea:	39 d8                	cmp    %ebx,%eax
+  8031ec:	0f 43 d8             	cmovae %eax,%ebx
+  8031ef:	44 39 e3             	cmp    %r12d,%ebx
+  8031f2:	73 19                	jae    80320d <file_truncate_blocks+0x79>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  8031f4:	49 bd db 2f 80 00 00 	movabs $0x802fdb,%r13
+  8031fb:	00 00 00 
+        int res = file_free_block(f, bno);
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  8031fe:	49 bf d1 74 80 00 00 	movabs $0x8074d1,%r15
+  803205:	00 00 00 
+  803208:	e9 f9 01 00 00       	jmp    803406 <file_truncate_blocks+0x272>
+    }
+
+    if (f->f_dindirect) {
+  80320d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803211:	8b b8 f4 00 00 00    	mov    0xf4(%rax),%edi
+  803217:	85 ff                	test   %edi,%edi
+  803219:	75 57                	jne    803272 <file_truncate_blocks+0xde>
+            f->f_dindirect = 0;
+            bc_mark_dirty(f);
+        }
+    }
+
+    if (f->f_indirect && new_nblocks <= ext_nblocks) {
+  80321b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80321f:	8b b8 f0 00 00 00    	mov    0xf0(%rax),%edi
+  803225:	85 ff                	test   %edi,%edi
+  803227:	74 0c                	je     803235 <file_truncate_blocks+0xa1>
+  803229:	8b 4d a8             	mov    -0x58(%rbp),%ecx
+  80322c:	39 4d b0             	cmp    %ecx,-0x50(%rbp)
+  80322f:	0f 83 f2 00 00 00    	jae    803327 <file_truncate_blocks+0x193>
+        f->f_indirect = 0;
+        bc_mark_dirty(f);
+    }
+
+    blockno_t base = 0;
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  803235:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803239:	4c 8d a0 88 00 00 00 	lea    0x88(%rax),%r12
+  803240:	48 05 f0 00 00 00    	add    $0xf0,%rax
+  803246:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+    blockno_t base = 0;
+  80324a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        blockno_t keep = new_nblocks > base ? MIN(new_nblocks - base, ext->e_len) : 0;
+        for (blockno_t i = keep; i < ext->e_len; i++)
+            free_block(ext->e_start + i);
+  803250:	49 bd c7 2a 80 00 00 	movabs $0x802ac7,%r13
+  803257:	00 00 00 
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  80325a:	49 39 c4             	cmp    %rax,%r12
+  80325d:	0f 82 3f 01 00 00    	jb     8033a2 <file_truncate_blocks+0x20e>
+
+        base += ext->e_len;
+        ext->e_len = keep;
+        if (!keep) ext->e_start = 0;
+    }
+}
+  803263:	48 83 c4 38          	add    $0x38,%rsp
+  803267:	5b                   	pop    %rbx
+  803268:	41 5c                	pop    %r12
+  80326a:	41 5d                	pop    %r13
+  80326c:	41 5e                	pop    %r14
+  80326e:	41 5f                	pop    %r15
+  803270:	5d                   	pop    %rbp
+  803271:	c3                   	ret
+        bool drop = new_nblocks <= MAX(ext_nblocks, NINDIRECT);
+  803272:	44 8b 6d a8          	mov    -0x58(%rbp),%r13d
+  803276:	44 8b 75 b0          	mov    -0x50(%rbp),%r14d
+  80327a:	b8 00 04 00 00       	mov    $0x400,%eax
+  80327f:	49 39 c6             	cmp    %rax,%r14
+  803282:	4c 0f 4c f0          	cmovl  %rax,%r14
+        blockno_t *dind = diskaddr(f->f_dindirect);
+  803286:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80328d:	00 00 00 
+  803290:	ff d0                	call   *%rax
+  803292:	49 89 c4             	mov    %rax,%r12
+  803295:	bb 01 00 00 00       	mov    $0x1,%ebx
+            free_block(dind[i]);
+  80329a:	49 bf c7 2a 80 00 00 	movabs $0x802ac7,%r15
+  8032a1:	00 00 00 
+  8032a4:	eb 28                	jmp    8032ce <file_truncate_blocks+0x13a>
+  8032a6:	41 ff d7             	call   *%r15
+            dind[i] = 0;
+  8032a9:	41 c7 44 9c fc 00 00 	movl   $0x0,-0x4(%r12,%rbx,4)
+  8032b0:	00 00 
+            bc_mark_dirty(dind);
+  8032b2:	4c 89 e7             	mov    %r12,%rdi
+  8032b5:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+        for (blockno_t i = 0; i < NINDIRECT; i++) {
+  8032c1:	48 83 c3 01          	add    $0x1,%rbx
+  8032c5:	48 81 fb 01 04 00 00 	cmp    $0x401,%rbx
+  8032cc:	74 1c                	je     8032ea <file_truncate_blocks+0x156>
+            if (!dind[i] || (!drop && NINDIRECT + i * NINDIRECT < new_nblocks)) continue;
+  8032ce:	41 8b 7c 9c fc       	mov    -0x4(%r12,%rbx,4),%edi
+  8032d3:	85 ff                	test   %edi,%edi
+  8032d5:	74 ea                	je     8032c1 <file_truncate_blocks+0x12d>
+  8032d7:	4d 39 f5             	cmp    %r14,%r13
+  8032da:	7e ca                	jle    8032a6 <file_truncate_blocks+0x112>
+  8032dc:	48 89 d8             	mov    %rbx,%rax
+  8032df:	48 c1 e0 0a          	shl    $0xa,%rax
+  8032e3:	49 39 c5             	cmp    %rax,%r13
+  8032e6:	7e be                	jle    8032a6 <file_truncate_blocks+0x112>
+  8032e8:	eb d7                	jmp    8032c1 <file_truncate_blocks+0x12d>
+        if (drop) {
+  8032ea:	4d 39 f5             	cmp    %r14,%r13
+  8032ed:	0f 8f 28 ff ff ff    	jg     80321b <file_truncate_blocks+0x87>
+            free_block(f->f_dindirect);
+  8032f3:	48 8b 5d b8          	mov    -0x48(%rbp),%rbx
+  8032f7:	8b bb f4 00 00 00    	mov    0xf4(%rbx),%edi
+  8032fd:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+            f->f_dindirect = 0;
+  803309:	c7 83 f4 00 00 00 00 	movl   $0x0,0xf4(%rbx)
+  803310:	00 00 00 
+            bc_mark_dirty(f);
+  803313:	48 89 df             	mov    %rbx,%rdi
+  803316:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80331d:	00 00 00 
+  803320:	ff d0                	call   *%rax
+  803322:	e9 f4 fe ff ff       	jmp    80321b <file_truncate_blocks+0x87>
+        free_block(f->f_indirect);
+  803327:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+        f->f_indirect = 0;
+  803333:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803337:	c7 80 f0 00 00 00 00 	movl   $0x0,0xf0(%rax)
+  80333e:	00 00 00 
+        bc_mark_dirty(f);
+  803341:	48 89 c7             	mov    %rax,%rdi
+  803344:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80334b:	00 00 00 
+  80334e:	ff d0                	call   *%rax
+  803350:	e9 e0 fe ff ff       	jmp    803235 <file_truncate_blocks+0xa1>
+        blockno_t keep = new_nblocks > base ? MIN(new_nblocks - base, ext->e_len) : 0;
+  803355:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  80335b:	bb 00 00 00 00       	mov    $0x0,%ebx
+            free_block(ext->e_start + i);
+  803360:	89 df                	mov    %ebx,%edi
+  803362:	41 03 3c 24          	add    (%r12),%edi
+  803366:	41 ff d5             	call   *%r13
+        for (blockno_t i = keep; i < ext->e_len; i++)
+  803369:	83 c3 01             	add    $0x1,%ebx
+  80336c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803371:	39 c3                	cmp    %eax,%ebx
+  803373:	72 eb                	jb     803360 <file_truncate_blocks+0x1cc>
+        if (keep < ext->e_len) bc_mark_dirty(f);
+  803375:	41 39 c7             	cmp    %eax,%r15d
+  803378:	72 5a                	jb     8033d4 <file_truncate_blocks+0x240>
+        base += ext->e_len;
+  80337a:	45 03 74 24 04       	add    0x4(%r12),%r14d
+        ext->e_len = keep;
+  80337f:	45 89 7c 24 04       	mov    %r15d,0x4(%r12)
+        if (!keep) ext->e_start = 0;
+  803384:	45 85 ff             	test   %r15d,%r15d
+  803387:	75 08                	jne    803391 <file_truncate_blocks+0x1fd>
+  803389:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803390:	00 
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  803391:	49 83 c4 08          	add    $0x8,%r12
+  803395:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803399:	49 39 c4             	cmp    %rax,%r12
+  80339c:	0f 84 c1 fe ff ff    	je     803263 <file_truncate_blocks+0xcf>
+  8033a2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8033a7:	85 c0                	test   %eax,%eax
+  8033a9:	0f 84 b4 fe ff ff    	je     803263 <file_truncate_blocks+0xcf>
+        blockno_t keep = new_nblocks > base ? MIN(new_nblocks - base, ext->e_len) : 0;
+  8033af:	8b 55 b4             	mov    -0x4c(%rbp),%edx
+  8033b2:	41 39 d6             	cmp    %edx,%r14d
+  8033b5:	73 9e                	jae    803355 <file_truncate_blocks+0x1c1>
+  8033b7:	44 29 f2             	sub    %r14d,%edx
+  8033ba:	89 d3                	mov    %edx,%ebx
+  8033bc:	39 c2                	cmp    %eax,%edx
+  8033be:	0f 47 d8             	cmova  %eax,%ebx
+  8033c1:	41 89 df             	mov    %ebx,%r15d
+        for (blockno_t i = keep; i < ext->e_len; i++)
+  8033c4:	39 c3                	cmp    %eax,%ebx
+  8033c6:	72 98                	jb     803360 <file_truncate_blocks+0x1cc>
+        base += ext->e_len;
+  8033c8:	45 03 74 24 04       	add    0x4(%r12),%r14d
+        ext->e_len = keep;
+  8033cd:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+        if (!keep) ext->e_start = 0;
+  8033d2:	eb bd                	jmp    803391 <file_truncate_blocks+0x1fd>
+        if (keep < ext->e_len) bc_mark_dirty(f);
+  8033d4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8033d8:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8033df:	00 00 00 
+  8033e2:	ff d0                	call   *%rax
+  8033e4:	eb 94                	jmp    80337a <file_truncate_blocks+0x1e6>
+        if (res < 0) cprintf("warning: file_free_block: %i", res);
+  8033e6:	89 c6                	mov    %eax,%esi
+  8033e8:	48 bf 24 c0 80 00 00 	movabs $0x80c024,%rdi
+  8033ef:	00 00 00 
+  8033f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f7:	41 ff d7             	call   *%r15
+    for (blockno_t bno = MAX(new_nblocks, ext_nblocks); bno < old_nblocks; bno++) {
+  8033fa:	83 c3 01             	add    $0x1,%ebx
+  8033fd:	41 39 de             	cmp    %ebx,%r14d
+  803400:	0f 84 07 fe ff ff    	je     80320d <file_truncate_blocks+0x79>
+    int res = file_block_walk(f, filebno, &ptr, 0);
+  803406:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80340b:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  80340f:	89 de                	mov    %ebx,%esi
+  803411:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803415:	41 ff d5             	call   *%r13
+    if (res == -E_NOT_FOUND) return 0;
+  803418:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  80341b:	74 dd                	je     8033fa <file_truncate_blocks+0x266>
+    if (res < 0) return res;
+  80341d:	85 c0                	test   %eax,%eax
+  80341f:	78 c5                	js     8033e6 <file_truncate_blocks+0x252>
+    if (*ptr) {
+  803421:	4c 8b 65 c0          	mov    -0x40(%rbp),%r12
+  803425:	41 8b 3c 24          	mov    (%r12),%edi
+  803429:	85 ff                	test   %edi,%edi
+  80342b:	74 cd                	je     8033fa <file_truncate_blocks+0x266>
+        free_block(*ptr);
+  80342d:	48 b8 c7 2a 80 00 00 	movabs $0x802ac7,%rax
+  803434:	00 00 00 
+  803437:	ff d0                	call   *%rax
+        *ptr = 0;
+  803439:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  803440:	00 
+        bc_mark_dirty(ptr);
+  803441:	4c 89 e7             	mov    %r12,%rdi
+  803444:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+  803450:	eb a8                	jmp    8033fa <file_truncate_blocks+0x266>
+
+0000000000803452 <file_block_map>:
+file_block_map(struct File *f, blockno_t filebno, blockno_t *pdiskbno) {
+  803452:	55                   	push   %rbp
+  803453:	48 89 e5             	mov    %rsp,%rbp
+  803456:	53                   	push   %rbx
+  803457:	48 83 ec 18          	sub    $0x18,%rsp
+  80345b:	48 89 d3             	mov    %rdx,%rbx
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  80345e:	48 8d 97 88 00 00 00 	lea    0x88(%rdi),%rdx
+  803465:	4c 8d 8f f0 00 00 00 	lea    0xf0(%rdi),%r9
+    blockno_t base = 0;
+  80346c:	b8 00 00 00 00       	mov    $0x0,%eax
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  803471:	4c 39 ca             	cmp    %r9,%rdx
+  803474:	73 1d                	jae    803493 <file_block_map+0x41>
+  803476:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  803479:	85 c9                	test   %ecx,%ecx
+  80347b:	74 16                	je     803493 <file_block_map+0x41>
+        if (filebno - base < ext->e_len) {
+  80347d:	41 89 f0             	mov    %esi,%r8d
+  803480:	41 29 c0             	sub    %eax,%r8d
+  803483:	41 39 c8             	cmp    %ecx,%r8d
+  803486:	72 3f                	jb     8034c7 <file_block_map+0x75>
+        base += ext->e_len;
+  803488:	01 c8                	add    %ecx,%eax
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++) {
+  80348a:	48 83 c2 08          	add    $0x8,%rdx
+  80348e:	4c 39 ca             	cmp    %r9,%rdx
+  803491:	75 e3                	jne    803476 <file_block_map+0x24>
+    int res = file_block_walk(f, filebno, &slot, 0);
+  803493:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803498:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  80349c:	48 b8 db 2f 80 00 00 	movabs $0x802fdb,%rax
+  8034a3:	00 00 00 
+  8034a6:	ff d0                	call   *%rax
+    if (res == -E_NOT_FOUND) {
+  8034a8:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  8034ab:	74 31                	je     8034de <file_block_map+0x8c>
+    if (res < 0) return res;
+  8034ad:	85 c0                	test   %eax,%eax
+  8034af:	78 10                	js     8034c1 <file_block_map+0x6f>
+    *pdiskbno = *slot;
+  8034b1:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8034b5:	8b 00                	mov    (%rax),%eax
+  8034b7:	89 03                	mov    %eax,(%rbx)
+    return *slot != 0;
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	0f 95 c0             	setne  %al
+  8034be:	0f b6 c0             	movzbl %al,%eax
+}
+  8034c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034c5:	c9                   	leave
+  8034c6:	c3                   	ret
+            *pdiskbno = ext->e_start + (filebno - base);
+  8034c7:	44 03 02             	add    (%rdx),%r8d
+  8034ca:	44 89 03             	mov    %r8d,(%rbx)
+            return MIN(ext->e_len - (filebno - base), INT32_MAX);
+  8034cd:	29 f0                	sub    %esi,%eax
+  8034cf:	03 42 04             	add    0x4(%rdx),%eax
+  8034d2:	ba ff ff ff 7f       	mov    $0x7fffffff,%edx
+  8034d7:	39 d0                	cmp    %edx,%eax
+  8034d9:	0f 47 c2             	cmova  %edx,%eax
+  8034dc:	eb e3                	jmp    8034c1 <file_block_map+0x6f>
+        *pdiskbno = 0;
+  8034de:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+        return 0;
+  8034e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034e9:	eb d6                	jmp    8034c1 <file_block_map+0x6f>
+
+00000000008034eb <file_get_block>:
+file_get_block(struct File *f, uint32_t filebno, char **blk) {
+  8034eb:	55                   	push   %rbp
+  8034ec:	48 89 e5             	mov    %rsp,%rbp
+  8034ef:	41 57                	push   %r15
+  8034f1:	41 56                	push   %r14
+  8034f3:	41 55                	push   %r13
+  8034f5:	41 54                	push   %r12
+  8034f7:	53                   	push   %rbx
+  8034f8:	48 83 ec 28          	sub    $0x28,%rsp
+  8034fc:	49 89 fc             	mov    %rdi,%r12
+  8034ff:	89 f3                	mov    %esi,%ebx
+  803501:	49 89 d5             	mov    %rdx,%r13
+    int res = file_block_map(f, filebno, &diskbno);
+  803504:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  803508:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  80350f:	00 00 00 
+  803512:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803514:	85 c0                	test   %eax,%eax
+  803516:	0f 88 46 01 00 00    	js     803662 <file_get_block+0x177>
+    if (!res && (res = file_alloc_block(f, filebno, &diskbno)) < 0) return res;
+  80351c:	0f 85 28 01 00 00    	jne    80364a <file_get_block+0x15f>
+    blockno_t nblocks = file_extent_blocks(f, &last);
+  803522:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803526:	4c 89 e7             	mov    %r12,%rdi
+  803529:	48 b8 67 28 80 00 00 	movabs $0x802867,%rax
+  803530:	00 00 00 
+  803533:	ff d0                	call   *%rax
+    if (filebno == nblocks && !f->f_indirect && !f->f_dindirect) {
+  803535:	39 c3                	cmp    %eax,%ebx
+  803537:	75 54                	jne    80358d <file_get_block+0xa2>
+  803539:	41 83 bc 24 f0 00 00 	cmpl   $0x0,0xf0(%r12)
+  803540:	00 00 
+  803542:	75 49                	jne    80358d <file_get_block+0xa2>
+  803544:	45 8b b4 24 f4 00 00 	mov    0xf4(%r12),%r14d
+  80354b:	00 
+  80354c:	45 85 f6             	test   %r14d,%r14d
+  80354f:	75 3c                	jne    80358d <file_get_block+0xa2>
+        struct Extent *next = last ? last + 1 : f->f_extent;
+  803551:	4c 8b 7d b8          	mov    -0x48(%rbp),%r15
+  803555:	4d 85 ff             	test   %r15,%r15
+  803558:	74 67                	je     8035c1 <file_get_block+0xd6>
+        blockno_t hint = last ? last->e_start + last->e_len : 0;
+  80355a:	45 8b 77 04          	mov    0x4(%r15),%r14d
+  80355e:	45 03 37             	add    (%r15),%r14d
+        bool grow = last && block_is_free(hint);
+  803561:	44 89 f7             	mov    %r14d,%edi
+  803564:	48 b8 84 2a 80 00 00 	movabs $0x802a84,%rax
+  80356b:	00 00 00 
+  80356e:	ff d0                	call   *%rax
+  803570:	84 c0                	test   %al,%al
+  803572:	0f 85 3a 01 00 00    	jne    8036b2 <file_get_block+0x1c7>
+        struct Extent *next = last ? last + 1 : f->f_extent;
+  803578:	49 83 c7 08          	add    $0x8,%r15
+        if (grow || next < f->f_extent + NEXTENT) {
+  80357c:	49 8d 84 24 f0 00 00 	lea    0xf0(%r12),%rax
+  803583:	00 
+  803584:	49 39 c7             	cmp    %rax,%r15
+  803587:	0f 82 fe 00 00 00    	jb     80368b <file_get_block+0x1a0>
+    int res = file_block_walk(f, filebno, &slot, 1);
+  80358d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803592:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  803596:	89 de                	mov    %ebx,%esi
+  803598:	4c 89 e7             	mov    %r12,%rdi
+  80359b:	48 b8 db 2f 80 00 00 	movabs $0x802fdb,%rax
+  8035a2:	00 00 00 
+  8035a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035a7:	85 c0                	test   %eax,%eax
+  8035a9:	0f 88 b3 00 00 00    	js     803662 <file_get_block+0x177>
+    blockno_t prev = 0;
+  8035af:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%rbp)
+    if (filebno && file_block_map(f, filebno - 1, &prev) <= 0) prev = 0;
+  8035b6:	85 db                	test   %ebx,%ebx
+  8035b8:	75 46                	jne    803600 <file_get_block+0x115>
+    blockno_t block = alloc_block_near(prev ? prev + 1 : 0);
+  8035ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035bf:	eb 62                	jmp    803623 <file_get_block+0x138>
+        struct Extent *next = last ? last + 1 : f->f_extent;
+  8035c1:	4d 8d bc 24 88 00 00 	lea    0x88(%r12),%r15
+  8035c8:	00 
+        bool grow = last && block_is_free(hint);
+  8035c9:	eb b1                	jmp    80357c <file_get_block+0x91>
+                assert(block == hint);
+  8035cb:	48 b9 41 c0 80 00 00 	movabs $0x80c041,%rcx
+  8035d2:	00 00 00 
+  8035d5:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8035dc:	00 00 00 
+  8035df:	be 23 01 00 00       	mov    $0x123,%esi
+  8035e4:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  8035eb:	00 00 00 
+  8035ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f3:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8035fa:	00 00 00 
+  8035fd:	41 ff d0             	call   *%r8
+    if (filebno && file_block_map(f, filebno - 1, &prev) <= 0) prev = 0;
+  803600:	8d 73 ff             	lea    -0x1(%rbx),%esi
+  803603:	48 8d 55 b4          	lea    -0x4c(%rbp),%rdx
+  803607:	4c 89 e7             	mov    %r12,%rdi
+  80360a:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  803611:	00 00 00 
+  803614:	ff d0                	call   *%rax
+  803616:	85 c0                	test   %eax,%eax
+  803618:	7e 57                	jle    803671 <file_get_block+0x186>
+    blockno_t block = alloc_block_near(prev ? prev + 1 : 0);
+  80361a:	8b 7d b4             	mov    -0x4c(%rbp),%edi
+  80361d:	83 ff 01             	cmp    $0x1,%edi
+  803620:	83 df ff             	sbb    $0xffffffff,%edi
+  803623:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  80362a:	00 00 00 
+  80362d:	ff d0                	call   *%rax
+  80362f:	89 c3                	mov    %eax,%ebx
+    if (!block) return -E_NO_DISK;
+  803631:	85 c0                	test   %eax,%eax
+  803633:	74 48                	je     80367d <file_get_block+0x192>
+    *slot = block;
+  803635:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803639:	89 07                	mov    %eax,(%rdi)
+    bc_mark_dirty(slot);
+  80363b:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  803642:	00 00 00 
+  803645:	ff d0                	call   *%rax
+    *pdiskbno = block;
+  803647:	89 5d cc             	mov    %ebx,-0x34(%rbp)
+    *blk = (char *)diskaddr(diskbno);
+  80364a:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80364d:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  803654:	00 00 00 
+  803657:	ff d0                	call   *%rax
+  803659:	49 89 45 00          	mov    %rax,0x0(%r13)
+    return 0;
+  80365d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803662:	48 83 c4 28          	add    $0x28,%rsp
+  803666:	5b                   	pop    %rbx
+  803667:	41 5c                	pop    %r12
+  803669:	41 5d                	pop    %r13
+  80366b:	41 5e                	pop    %r14
+  80366d:	41 5f                	pop    %r15
+  80366f:	5d                   	pop    %rbp
+  803670:	c3                   	ret
+    if (filebno && file_block_map(f, filebno - 1, &prev) <= 0) prev = 0;
+  803671:	c7 45 b4 00 00 00 00 	movl   $0x0,-0x4c(%rbp)
+  803678:	e9 3d ff ff ff       	jmp    8035ba <file_get_block+0xcf>
+    if (!block) return -E_NO_DISK;
+  80367d:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803682:	eb de                	jmp    803662 <file_get_block+0x177>
+            if (!block) return -E_NO_DISK;
+  803684:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  803689:	eb d7                	jmp    803662 <file_get_block+0x177>
+            blockno_t block = alloc_block_near(hint);
+  80368b:	44 89 f7             	mov    %r14d,%edi
+  80368e:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+  80369a:	89 c3                	mov    %eax,%ebx
+            if (!block) return -E_NO_DISK;
+  80369c:	b8 f3 ff ff ff       	mov    $0xfffffff3,%eax
+  8036a1:	85 db                	test   %ebx,%ebx
+  8036a3:	74 bd                	je     803662 <file_get_block+0x177>
+                next->e_start = block;
+  8036a5:	41 89 1f             	mov    %ebx,(%r15)
+                next->e_len = 1;
+  8036a8:	41 c7 47 04 01 00 00 	movl   $0x1,0x4(%r15)
+  8036af:	00 
+  8036b0:	eb 23                	jmp    8036d5 <file_get_block+0x1ea>
+            blockno_t block = alloc_block_near(hint);
+  8036b2:	44 89 f7             	mov    %r14d,%edi
+  8036b5:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  8036bc:	00 00 00 
+  8036bf:	ff d0                	call   *%rax
+  8036c1:	89 c3                	mov    %eax,%ebx
+            if (!block) return -E_NO_DISK;
+  8036c3:	85 c0                	test   %eax,%eax
+  8036c5:	74 bd                	je     803684 <file_get_block+0x199>
+                assert(block == hint);
+  8036c7:	41 39 de             	cmp    %ebx,%r14d
+  8036ca:	0f 85 fb fe ff ff    	jne    8035cb <file_get_block+0xe0>
+                last->e_len++;
+  8036d0:	41 83 47 04 01       	addl   $0x1,0x4(%r15)
+            bc_mark_dirty(f);
+  8036d5:	4c 89 e7             	mov    %r12,%rdi
+  8036d8:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8036df:	00 00 00 
+  8036e2:	ff d0                	call   *%rax
+            return 0;
+  8036e4:	e9 5e ff ff ff       	jmp    803647 <file_get_block+0x15c>
+
+00000000008036e9 <dir_slot>:
+    if (slot >= dir->f_size / BLKSIZE * BLKFILES) return NULL;
+  8036e9:	89 f1                	mov    %esi,%ecx
+  8036eb:	8b 97 80 00 00 00    	mov    0x80(%rdi),%edx
+  8036f1:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  8036f7:	85 d2                	test   %edx,%edx
+  8036f9:	0f 49 c2             	cmovns %edx,%eax
+  8036fc:	c1 f8 0c             	sar    $0xc,%eax
+  8036ff:	48 98                	cltq
+  803701:	48 c1 e0 04          	shl    $0x4,%rax
+  803705:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370a:	48 39 c1             	cmp    %rax,%rcx
+  80370d:	73 40                	jae    80374f <dir_slot+0x66>
+dir_slot(struct File *dir, uint32_t slot) {
+  80370f:	55                   	push   %rbp
+  803710:	48 89 e5             	mov    %rsp,%rbp
+  803713:	53                   	push   %rbx
+  803714:	48 83 ec 18          	sub    $0x18,%rsp
+  803718:	89 f3                	mov    %esi,%ebx
+    if (file_get_block(dir, slot / BLKFILES, &blk) < 0) return NULL;
+  80371a:	c1 ee 04             	shr    $0x4,%esi
+  80371d:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  803721:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  803728:	00 00 00 
+  80372b:	ff d0                	call   *%rax
+  80372d:	85 c0                	test   %eax,%eax
+  80372f:	78 17                	js     803748 <dir_slot+0x5f>
+    return (struct File *)blk + slot % BLKFILES;
+  803731:	83 e3 0f             	and    $0xf,%ebx
+  803734:	48 c1 e3 08          	shl    $0x8,%rbx
+  803738:	48 03 5d e8          	add    -0x18(%rbp),%rbx
+  80373c:	48 89 da             	mov    %rbx,%rdx
+}
+  80373f:	48 89 d0             	mov    %rdx,%rax
+  803742:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803746:	c9                   	leave
+  803747:	c3                   	ret
+    if (file_get_block(dir, slot / BLKFILES, &blk) < 0) return NULL;
+  803748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80374d:	eb f0                	jmp    80373f <dir_slot+0x56>
+}
+  80374f:	48 89 d0             	mov    %rdx,%rax
+  803752:	c3                   	ret
+
+0000000000803753 <dir_index_build>:
+dir_index_build(struct File *dir, uint32_t nblocks) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	41 57                	push   %r15
+  803759:	41 56                	push   %r14
+  80375b:	41 55                	push   %r13
+  80375d:	41 54                	push   %r12
+  80375f:	53                   	push   %rbx
+  803760:	48 83 ec 28          	sub    $0x28,%rsp
+  803764:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803768:	89 75 bc             	mov    %esi,-0x44(%rbp)
+    if (!dir->f_dirindex) {
+  80376b:	83 bf f8 00 00 00 00 	cmpl   $0x0,0xf8(%rdi)
+  803772:	75 56                	jne    8037ca <dir_index_build+0x77>
+  803774:	49 89 ff             	mov    %rdi,%r15
+        blockno_t block = alloc_block();
+  803777:	48 b8 bb 2c 80 00 00 	movabs $0x802cbb,%rax
+  80377e:	00 00 00 
+  803781:	ff d0                	call   *%rax
+  803783:	89 c3                	mov    %eax,%ebx
+        if (!block) return;
+  803785:	85 c0                	test   %eax,%eax
+  803787:	0f 84 b0 01 00 00    	je     80393d <dir_index_build+0x1ea>
+        memset(diskaddr(block), 0, BLKSIZE);
+  80378d:	89 c7                	mov    %eax,%edi
+  80378f:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+  80379b:	48 89 c7             	mov    %rax,%rdi
+  80379e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8037a8:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  8037af:	00 00 00 
+  8037b2:	ff d0                	call   *%rax
+        dir->f_dirindex = block;
+  8037b4:	41 89 9f f8 00 00 00 	mov    %ebx,0xf8(%r15)
+        bc_mark_dirty(dir);
+  8037bb:	4c 89 ff             	mov    %r15,%rdi
+  8037be:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8037c5:	00 00 00 
+  8037c8:	ff d0                	call   *%rax
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  8037ca:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037ce:	8b b8 f8 00 00 00    	mov    0xf8(%rax),%edi
+  8037d4:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+  8037e0:	48 89 c1             	mov    %rax,%rcx
+  8037e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+    for (uint32_t i = 0; i < nblocks; i++) {
+  8037e7:	8b 55 bc             	mov    -0x44(%rbp),%edx
+  8037ea:	85 d2                	test   %edx,%edx
+  8037ec:	0f 84 88 00 00 00    	je     80387a <dir_index_build+0x127>
+  8037f2:	48 89 c3             	mov    %rax,%rbx
+  8037f5:	89 d0                	mov    %edx,%eax
+  8037f7:	4c 8d 3c 81          	lea    (%rcx,%rax,4),%r15
+        memset(diskaddr(idx->di_buckets[i]), 0, BLKSIZE);
+  8037fb:	49 bd d0 14 80 00 00 	movabs $0x8014d0,%r13
+  803802:	00 00 00 
+  803805:	49 be 42 7f 80 00 00 	movabs $0x807f42,%r14
+  80380c:	00 00 00 
+  80380f:	eb 38                	jmp    803849 <dir_index_build+0xf6>
+  803811:	41 8b 7c 24 0c       	mov    0xc(%r12),%edi
+  803816:	41 ff d5             	call   *%r13
+  803819:	48 89 c7             	mov    %rax,%rdi
+  80381c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803821:	be 00 00 00 00       	mov    $0x0,%esi
+  803826:	41 ff d6             	call   *%r14
+        bc_mark_dirty(diskaddr(idx->di_buckets[i]));
+  803829:	41 8b 7c 24 0c       	mov    0xc(%r12),%edi
+  80382e:	41 ff d5             	call   *%r13
+  803831:	48 89 c7             	mov    %rax,%rdi
+  803834:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80383b:	00 00 00 
+  80383e:	ff d0                	call   *%rax
+    for (uint32_t i = 0; i < nblocks; i++) {
+  803840:	48 83 c3 04          	add    $0x4,%rbx
+  803844:	4c 39 fb             	cmp    %r15,%rbx
+  803847:	74 31                	je     80387a <dir_index_build+0x127>
+        if (!idx->di_buckets[i] && !(idx->di_buckets[i] = alloc_block())) {
+  803849:	49 89 dc             	mov    %rbx,%r12
+  80384c:	83 7b 0c 00          	cmpl   $0x0,0xc(%rbx)
+  803850:	75 bf                	jne    803811 <dir_index_build+0xbe>
+  803852:	48 b8 bb 2c 80 00 00 	movabs $0x802cbb,%rax
+  803859:	00 00 00 
+  80385c:	ff d0                	call   *%rax
+  80385e:	89 43 0c             	mov    %eax,0xc(%rbx)
+  803861:	85 c0                	test   %eax,%eax
+  803863:	75 ac                	jne    803811 <dir_index_build+0xbe>
+            dir_index_drop(dir);
+  803865:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803869:	48 b8 71 2b 80 00 00 	movabs $0x802b71,%rax
+  803870:	00 00 00 
+  803873:	ff d0                	call   *%rax
+            return;
+  803875:	e9 c3 00 00 00       	jmp    80393d <dir_index_build+0x1ea>
+    idx->di_nblocks = nblocks;
+  80387a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80387e:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803881:	89 08                	mov    %ecx,(%rax)
+    idx->di_count = 0;
+  803883:	c7 40 04 00 00 00 00 	movl   $0x0,0x4(%rax)
+    idx->di_free_hint = 0;
+  80388a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    uint32_t nslots = dir->f_size / BLKSIZE * BLKFILES;
+  803891:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803895:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  80389b:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  8038a1:	85 d2                	test   %edx,%edx
+  8038a3:	0f 49 c2             	cmovns %edx,%eax
+  8038a6:	c1 f8 0c             	sar    $0xc,%eax
+    for (uint32_t slot = 0; slot < nslots; slot++) {
+  8038a9:	c1 e0 04             	shl    $0x4,%eax
+  8038ac:	41 89 c6             	mov    %eax,%r14d
+  8038af:	74 7c                	je     80392d <dir_index_build+0x1da>
+  8038b1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        struct File *f = dir_slot(dir, slot);
+  8038b7:	49 bd e9 36 80 00 00 	movabs $0x8036e9,%r13
+  8038be:	00 00 00 
+        uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+  8038c1:	49 bf 9e 28 80 00 00 	movabs $0x80289e,%r15
+  8038c8:	00 00 00 
+  8038cb:	eb 09                	jmp    8038d6 <dir_index_build+0x183>
+    for (uint32_t slot = 0; slot < nslots; slot++) {
+  8038cd:	41 83 c4 01          	add    $0x1,%r12d
+  8038d1:	45 39 e6             	cmp    %r12d,%r14d
+  8038d4:	74 57                	je     80392d <dir_index_build+0x1da>
+        struct File *f = dir_slot(dir, slot);
+  8038d6:	44 89 e6             	mov    %r12d,%esi
+  8038d9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038dd:	41 ff d5             	call   *%r13
+  8038e0:	48 89 c3             	mov    %rax,%rbx
+        if (!f || !f->f_name[0]) continue;
+  8038e3:	48 85 c0             	test   %rax,%rax
+  8038e6:	74 e5                	je     8038cd <dir_index_build+0x17a>
+  8038e8:	80 38 00             	cmpb   $0x0,(%rax)
+  8038eb:	74 e0                	je     8038cd <dir_index_build+0x17a>
+        uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+  8038ed:	48 89 c7             	mov    %rax,%rdi
+  8038f0:	41 ff d7             	call   *%r15
+  8038f3:	89 c6                	mov    %eax,%esi
+  8038f5:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  8038f9:	48 b9 43 29 80 00 00 	movabs $0x802943,%rcx
+  803900:	00 00 00 
+  803903:	ff d1                	call   *%rcx
+        f->f_hnext = *bucket;
+  803905:	8b 10                	mov    (%rax),%edx
+  803907:	89 93 fc 00 00 00    	mov    %edx,0xfc(%rbx)
+        *bucket = slot + 1;
+  80390d:	41 8d 54 24 01       	lea    0x1(%r12),%edx
+  803912:	89 10                	mov    %edx,(%rax)
+        idx->di_count++;
+  803914:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803918:	83 40 04 01          	addl   $0x1,0x4(%rax)
+        bc_mark_dirty(f);
+  80391c:	48 89 df             	mov    %rbx,%rdi
+  80391f:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  803926:	00 00 00 
+  803929:	ff d0                	call   *%rax
+  80392b:	eb a0                	jmp    8038cd <dir_index_build+0x17a>
+    bc_mark_dirty(idx);
+  80392d:	48 8b 7d c0          	mov    -0x40(%rbp),%rdi
+  803931:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  803938:	00 00 00 
+  80393b:	ff d0                	call   *%rax
+}
+  80393d:	48 83 c4 28          	add    $0x28,%rsp
+  803941:	5b                   	pop    %rbx
+  803942:	41 5c                	pop    %r12
+  803944:	41 5d                	pop    %r13
+  803946:	41 5e                	pop    %r14
+  803948:	41 5f                	pop    %r15
+  80394a:	5d                   	pop    %rbp
+  80394b:	c3                   	ret
+
+000000000080394c <walk_path>:
+walk_path(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  80394c:	55                   	push   %rbp
+  80394d:	48 89 e5             	mov    %rsp,%rbp
+  803950:	41 57                	push   %r15
+  803952:	41 56                	push   %r14
+  803954:	41 55                	push   %r13
+  803956:	41 54                	push   %r12
+  803958:	53                   	push   %rbx
+  803959:	48 81 ec e8 00 00 00 	sub    $0xe8,%rsp
+  803960:	49 89 fd             	mov    %rdi,%r13
+  803963:	49 89 f4             	mov    %rsi,%r12
+  803966:	48 89 95 10 ff ff ff 	mov    %rdx,-0xf0(%rbp)
+  80396d:	49 89 ce             	mov    %rcx,%r14
+    if (pdir)
+  803970:	48 85 f6             	test   %rsi,%rsi
+  803973:	0f 84 84 04 00 00    	je     803dfd <walk_path+0x4b1>
+        *pdir = 0;
+  803979:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *pf = 0;
+  803980:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+    if (dcache_path_lookup(start, &dir, &f, lastelem)) {
+  803987:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  80398e:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  803995:	48 b8 55 4d 80 00 00 	movabs $0x804d55,%rax
+  80399c:	00 00 00 
+  80399f:	ff d0                	call   *%rax
+  8039a1:	84 c0                	test   %al,%al
+  8039a3:	0f 84 84 04 00 00    	je     803e2d <walk_path+0x4e1>
+            *pdir = dir;
+  8039a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8039b0:	49 89 04 24          	mov    %rax,(%r12)
+        *pf = f;
+  8039b4:	48 8b 85 40 ff ff ff 	mov    -0xc0(%rbp),%rax
+  8039bb:	48 8b 8d 10 ff ff ff 	mov    -0xf0(%rbp),%rcx
+  8039c2:	48 89 01             	mov    %rax,(%rcx)
+        return f ? 0 : -E_NOT_FOUND;
+  8039c5:	48 83 f8 01          	cmp    $0x1,%rax
+  8039c9:	19 db                	sbb    %ebx,%ebx
+  8039cb:	83 e3 f1             	and    $0xfffffff1,%ebx
+}
+  8039ce:	89 d8                	mov    %ebx,%eax
+  8039d0:	48 81 c4 e8 00 00 00 	add    $0xe8,%rsp
+  8039d7:	5b                   	pop    %rbx
+  8039d8:	41 5c                	pop    %r12
+  8039da:	41 5d                	pop    %r13
+  8039dc:	41 5e                	pop    %r14
+  8039de:	41 5f                	pop    %r15
+  8039e0:	5d                   	pop    %rbp
+  8039e1:	c3                   	ret
+        while (*path != '/' && *path != '\0')
+  8039e2:	4c 8b a5 28 ff ff ff 	mov    -0xd8(%rbp),%r12
+        if (path - p >= MAXNAMELEN)
+  8039e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8039ee:	e9 4e 02 00 00       	jmp    803c41 <walk_path+0x2f5>
+    if (dir->f_dirindex) {
+  8039f3:	48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+  8039fa:	8b b8 f8 00 00 00    	mov    0xf8(%rax),%edi
+  803a00:	85 ff                	test   %edi,%edi
+  803a02:	0f 85 a5 00 00 00    	jne    803aad <walk_path+0x161>
+    assert((dir->f_size % BLKSIZE) == 0);
+  803a08:	48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+  803a0f:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  803a15:	f7 c2 ff 0f 00 00    	test   $0xfff,%edx
+  803a1b:	0f 85 6b 01 00 00    	jne    803b8c <walk_path+0x240>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  803a21:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  803a27:	85 d2                	test   %edx,%edx
+  803a29:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; i++) {
+  803a2c:	c1 f8 0c             	sar    $0xc,%eax
+  803a2f:	89 85 18 ff ff ff    	mov    %eax,-0xe8(%rbp)
+  803a35:	0f 84 0b 01 00 00    	je     803b46 <walk_path+0x1fa>
+  803a3b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        int res = file_get_block(dir, i, &blk);
+  803a40:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  803a47:	89 de                	mov    %ebx,%esi
+  803a49:	48 8b bd 20 ff ff ff 	mov    -0xe0(%rbp),%rdi
+  803a50:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  803a57:	00 00 00 
+  803a5a:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  803a5c:	85 c0                	test   %eax,%eax
+  803a5e:	0f 88 69 02 00 00    	js     803ccd <walk_path+0x381>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  803a64:	4c 8b ad 38 ff ff ff 	mov    -0xc8(%rbp),%r13
+  803a6b:	4d 8d b5 00 10 00 00 	lea    0x1000(%r13),%r14
+            if (strcmp(f[j].f_name, name) == 0) {
+  803a72:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  803a79:	4c 89 ef             	mov    %r13,%rdi
+  803a7c:	41 ff d7             	call   *%r15
+  803a7f:	85 c0                	test   %eax,%eax
+  803a81:	0f 84 3a 01 00 00    	je     803bc1 <walk_path+0x275>
+        for (blockno_t j = 0; j < BLKFILES; j++)
+  803a87:	49 81 c5 00 01 00 00 	add    $0x100,%r13
+  803a8e:	4d 39 ee             	cmp    %r13,%r14
+  803a91:	75 df                	jne    803a72 <walk_path+0x126>
+    for (blockno_t i = 0; i < nblock; i++) {
+  803a93:	83 c3 01             	add    $0x1,%ebx
+  803a96:	39 9d 18 ff ff ff    	cmp    %ebx,-0xe8(%rbp)
+  803a9c:	75 a2                	jne    803a40 <walk_path+0xf4>
+    return -E_NOT_FOUND;
+  803a9e:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+  803aa3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aa8:	e9 3c 02 00 00       	jmp    803ce9 <walk_path+0x39d>
+        struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  803aad:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  803ab4:	00 00 00 
+  803ab7:	ff d0                	call   *%rax
+  803ab9:	48 89 c3             	mov    %rax,%rbx
+        uint32_t next = *dir_index_bucket(idx, dir_hash(name));
+  803abc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ac3:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  803aca:	00 00 00 
+  803acd:	ff d0                	call   *%rax
+  803acf:	89 c6                	mov    %eax,%esi
+  803ad1:	48 89 df             	mov    %rbx,%rdi
+  803ad4:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  803adb:	00 00 00 
+  803ade:	ff d0                	call   *%rax
+  803ae0:	44 8b 28             	mov    (%rax),%r13d
+        for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+  803ae3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803ae9:	45 85 ed             	test   %r13d,%r13d
+  803aec:	74 58                	je     803b46 <walk_path+0x1fa>
+  803aee:	4c 89 a5 18 ff ff ff 	mov    %r12,-0xe8(%rbp)
+  803af5:	49 89 dc             	mov    %rbx,%r12
+  803af8:	45 39 74 24 04       	cmp    %r14d,0x4(%r12)
+  803afd:	72 69                	jb     803b68 <walk_path+0x21c>
+            struct File *f = dir_slot(dir, next - 1);
+  803aff:	41 8d 75 ff          	lea    -0x1(%r13),%esi
+  803b03:	48 8b bd 20 ff ff ff 	mov    -0xe0(%rbp),%rdi
+  803b0a:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+  803b16:	48 89 c3             	mov    %rax,%rbx
+            if (!f) break;
+  803b19:	48 85 c0             	test   %rax,%rax
+  803b1c:	74 4a                	je     803b68 <walk_path+0x21c>
+            if (strcmp(f->f_name, name) == 0) {
+  803b1e:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  803b25:	48 89 c7             	mov    %rax,%rdi
+  803b28:	41 ff d7             	call   *%r15
+  803b2b:	85 c0                	test   %eax,%eax
+  803b2d:	74 26                	je     803b55 <walk_path+0x209>
+            next = f->f_hnext;
+  803b2f:	44 8b ab fc 00 00 00 	mov    0xfc(%rbx),%r13d
+        for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+  803b36:	41 83 c6 01          	add    $0x1,%r14d
+  803b3a:	45 85 ed             	test   %r13d,%r13d
+  803b3d:	75 b9                	jne    803af8 <walk_path+0x1ac>
+  803b3f:	4c 8b a5 18 ff ff ff 	mov    -0xe8(%rbp),%r12
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+  803b46:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  803b4b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803b50:	e9 94 01 00 00       	jmp    803ce9 <walk_path+0x39d>
+                *file = f;
+  803b55:	4c 8b a5 18 ff ff ff 	mov    -0xe8(%rbp),%r12
+  803b5c:	48 89 9d 40 ff ff ff 	mov    %rbx,-0xc0(%rbp)
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+  803b63:	e9 75 01 00 00       	jmp    803cdd <walk_path+0x391>
+        if (!next) return -E_NOT_FOUND;
+  803b68:	4c 8b a5 18 ff ff ff 	mov    -0xe8(%rbp),%r12
+  803b6f:	45 85 ed             	test   %r13d,%r13d
+  803b72:	74 d2                	je     803b46 <walk_path+0x1fa>
+        dir_index_drop(dir);
+  803b74:	48 8b bd 20 ff ff ff 	mov    -0xe0(%rbp),%rdi
+  803b7b:	48 b8 71 2b 80 00 00 	movabs $0x802b71,%rax
+  803b82:	00 00 00 
+  803b85:	ff d0                	call   *%rax
+  803b87:	e9 7c fe ff ff       	jmp    803a08 <walk_path+0xbc>
+    assert((dir->f_size % BLKSIZE) == 0);
+  803b8c:	48 b9 4f c0 80 00 00 	movabs $0x80c04f,%rcx
+  803b93:	00 00 00 
+  803b96:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  803b9d:	00 00 00 
+  803ba0:	be 0a 02 00 00       	mov    $0x20a,%esi
+  803ba5:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  803bac:	00 00 00 
+  803baf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb4:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  803bbb:	00 00 00 
+  803bbe:	41 ff d0             	call   *%r8
+                *file = &f[j];
+  803bc1:	89 c3                	mov    %eax,%ebx
+  803bc3:	4c 89 ad 40 ff ff ff 	mov    %r13,-0xc0(%rbp)
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+  803bca:	85 db                	test   %ebx,%ebx
+  803bcc:	0f 84 02 01 00 00    	je     803cd4 <walk_path+0x388>
+  803bd2:	83 fb f1             	cmp    $0xfffffff1,%ebx
+  803bd5:	0f 84 f9 00 00 00    	je     803cd4 <walk_path+0x388>
+        if ((r = dir_lookup(dir, name, &f)) < 0) {
+  803bdb:	85 db                	test   %ebx,%ebx
+  803bdd:	0f 88 25 01 00 00    	js     803d08 <walk_path+0x3bc>
+    if (dcache_lookup(dir, name, file)) return *file ? 0 : -E_NOT_FOUND;
+  803be3:	4c 89 a5 28 ff ff ff 	mov    %r12,-0xd8(%rbp)
+    while (*path != '\0') {
+  803bea:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803bf1:	0f b6 00             	movzbl (%rax),%eax
+  803bf4:	84 c0                	test   %al,%al
+  803bf6:	0f 84 99 01 00 00    	je     803d95 <walk_path+0x449>
+        dir = f;
+  803bfc:	48 8b 95 40 ff ff ff 	mov    -0xc0(%rbp),%rdx
+  803c03:	48 89 95 48 ff ff ff 	mov    %rdx,-0xb8(%rbp)
+        while (*path != '/' && *path != '\0')
+  803c0a:	3c 2f                	cmp    $0x2f,%al
+  803c0c:	0f 84 d0 fd ff ff    	je     8039e2 <walk_path+0x96>
+  803c12:	4c 8b a5 28 ff ff ff 	mov    -0xd8(%rbp),%r12
+            path++;
+  803c19:	49 83 c4 01          	add    $0x1,%r12
+        while (*path != '/' && *path != '\0')
+  803c1d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803c22:	3c 2f                	cmp    $0x2f,%al
+  803c24:	74 04                	je     803c2a <walk_path+0x2de>
+  803c26:	84 c0                	test   %al,%al
+  803c28:	75 ef                	jne    803c19 <walk_path+0x2cd>
+        if (path - p >= MAXNAMELEN)
+  803c2a:	4c 89 e3             	mov    %r12,%rbx
+  803c2d:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803c34:	48 29 c3             	sub    %rax,%rbx
+  803c37:	48 83 fb 7f          	cmp    $0x7f,%rbx
+  803c3b:	0f 8f a8 01 00 00    	jg     803de9 <walk_path+0x49d>
+        memmove(name, p, path - p);
+  803c41:	48 89 da             	mov    %rbx,%rdx
+  803c44:	48 8b b5 28 ff ff ff 	mov    -0xd8(%rbp),%rsi
+  803c4b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803c52:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  803c59:	00 00 00 
+  803c5c:	ff d0                	call   *%rax
+        name[path - p] = '\0';
+  803c5e:	c6 84 1d 50 ff ff ff 	movb   $0x0,-0xb0(%rbp,%rbx,1)
+  803c65:	00 
+    while (*p == '/')
+  803c66:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  803c6b:	75 0b                	jne    803c78 <walk_path+0x32c>
+        p++;
+  803c6d:	49 83 c4 01          	add    $0x1,%r12
+    while (*p == '/')
+  803c71:	41 80 3c 24 2f       	cmpb   $0x2f,(%r12)
+  803c76:	74 f5                	je     803c6d <walk_path+0x321>
+        if (dir->f_type != FTYPE_DIR)
+  803c78:	48 8b bd 48 ff ff ff 	mov    -0xb8(%rbp),%rdi
+  803c7f:	48 89 bd 20 ff ff ff 	mov    %rdi,-0xe0(%rbp)
+  803c86:	83 bf 84 00 00 00 01 	cmpl   $0x1,0x84(%rdi)
+  803c8d:	0f 85 60 01 00 00    	jne    803df3 <walk_path+0x4a7>
+    if (dcache_lookup(dir, name, file)) return *file ? 0 : -E_NOT_FOUND;
+  803c93:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  803c9a:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  803ca1:	48 b8 d3 4b 80 00 00 	movabs $0x804bd3,%rax
+  803ca8:	00 00 00 
+  803cab:	ff d0                	call   *%rax
+  803cad:	84 c0                	test   %al,%al
+  803caf:	0f 84 3e fd ff ff    	je     8039f3 <walk_path+0xa7>
+  803cb5:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  803cba:	48 83 bd 40 ff ff ff 	cmpq   $0x0,-0xc0(%rbp)
+  803cc1:	00 
+  803cc2:	0f 85 1b ff ff ff    	jne    803be3 <walk_path+0x297>
+  803cc8:	e9 0e ff ff ff       	jmp    803bdb <walk_path+0x28f>
+  803ccd:	89 c3                	mov    %eax,%ebx
+  803ccf:	e9 f6 fe ff ff       	jmp    803bca <walk_path+0x27e>
+    if (!res || res == -E_NOT_FOUND) dcache_insert(dir, name, res ? NULL : *file);
+  803cd4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cd9:	85 db                	test   %ebx,%ebx
+  803cdb:	75 0c                	jne    803ce9 <walk_path+0x39d>
+  803cdd:	48 8b 95 40 ff ff ff 	mov    -0xc0(%rbp),%rdx
+  803ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ce9:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  803cf0:	48 8b bd 20 ff ff ff 	mov    -0xe0(%rbp),%rdi
+  803cf7:	48 b8 88 4c 80 00 00 	movabs $0x804c88,%rax
+  803cfe:	00 00 00 
+  803d01:	ff d0                	call   *%rax
+  803d03:	e9 d3 fe ff ff       	jmp    803bdb <walk_path+0x28f>
+            if (r == -E_NOT_FOUND && *path == '\0') {
+  803d08:	4c 89 e0             	mov    %r12,%rax
+  803d0b:	4c 8b ad 08 ff ff ff 	mov    -0xf8(%rbp),%r13
+  803d12:	4c 8b a5 00 ff ff ff 	mov    -0x100(%rbp),%r12
+  803d19:	4c 8b b5 f8 fe ff ff 	mov    -0x108(%rbp),%r14
+  803d20:	83 fb f1             	cmp    $0xfffffff1,%ebx
+  803d23:	0f 85 a5 fc ff ff    	jne    8039ce <walk_path+0x82>
+  803d29:	80 38 00             	cmpb   $0x0,(%rax)
+  803d2c:	0f 85 9c fc ff ff    	jne    8039ce <walk_path+0x82>
+                if (pdir)
+  803d32:	4d 85 e4             	test   %r12,%r12
+  803d35:	74 0b                	je     803d42 <walk_path+0x3f6>
+                    *pdir = dir;
+  803d37:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803d3e:	49 89 04 24          	mov    %rax,(%r12)
+                if (lastelem)
+  803d42:	4d 85 f6             	test   %r14,%r14
+  803d45:	74 16                	je     803d5d <walk_path+0x411>
+                    strcpy(lastelem, name);
+  803d47:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  803d4e:	4c 89 f7             	mov    %r14,%rdi
+  803d51:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  803d58:	00 00 00 
+  803d5b:	ff d0                	call   *%rax
+                *pf = 0;
+  803d5d:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  803d64:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+                dcache_path_insert(start, dir, NULL, p - start);
+  803d6b:	48 8b 8d 28 ff ff ff 	mov    -0xd8(%rbp),%rcx
+  803d72:	4c 29 e9             	sub    %r13,%rcx
+  803d75:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d7a:	48 8b b5 48 ff ff ff 	mov    -0xb8(%rbp),%rsi
+  803d81:	4c 89 ef             	mov    %r13,%rdi
+  803d84:	48 b8 a0 4e 80 00 00 	movabs $0x804ea0,%rax
+  803d8b:	00 00 00 
+  803d8e:	ff d0                	call   *%rax
+  803d90:	e9 39 fc ff ff       	jmp    8039ce <walk_path+0x82>
+    if (pdir)
+  803d95:	4c 8b ad 08 ff ff ff 	mov    -0xf8(%rbp),%r13
+  803d9c:	4c 8b a5 00 ff ff ff 	mov    -0x100(%rbp),%r12
+  803da3:	4d 85 e4             	test   %r12,%r12
+  803da6:	74 0b                	je     803db3 <walk_path+0x467>
+        *pdir = dir;
+  803da8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803daf:	49 89 04 24          	mov    %rax,(%r12)
+    *pf = f;
+  803db3:	48 8b 95 40 ff ff ff 	mov    -0xc0(%rbp),%rdx
+  803dba:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  803dc1:	48 89 10             	mov    %rdx,(%rax)
+    dcache_path_insert(start, dir, f, 0);
+  803dc4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803dc9:	48 8b b5 48 ff ff ff 	mov    -0xb8(%rbp),%rsi
+  803dd0:	4c 89 ef             	mov    %r13,%rdi
+  803dd3:	48 b8 a0 4e 80 00 00 	movabs $0x804ea0,%rax
+  803dda:	00 00 00 
+  803ddd:	ff d0                	call   *%rax
+    return 0;
+  803ddf:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803de4:	e9 e5 fb ff ff       	jmp    8039ce <walk_path+0x82>
+            return -E_BAD_PATH;
+  803de9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803dee:	e9 db fb ff ff       	jmp    8039ce <walk_path+0x82>
+            return -E_NOT_FOUND;
+  803df3:	bb f1 ff ff ff       	mov    $0xfffffff1,%ebx
+  803df8:	e9 d1 fb ff ff       	jmp    8039ce <walk_path+0x82>
+    *pf = 0;
+  803dfd:	48 8b 85 10 ff ff ff 	mov    -0xf0(%rbp),%rax
+  803e04:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+    if (dcache_path_lookup(start, &dir, &f, lastelem)) {
+  803e0b:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  803e12:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  803e19:	48 b8 55 4d 80 00 00 	movabs $0x804d55,%rax
+  803e20:	00 00 00 
+  803e23:	ff d0                	call   *%rax
+  803e25:	84 c0                	test   %al,%al
+  803e27:	0f 85 87 fb ff ff    	jne    8039b4 <walk_path+0x68>
+    while (*p == '/')
+  803e2d:	4c 89 ad 28 ff ff ff 	mov    %r13,-0xd8(%rbp)
+  803e34:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  803e3b:	41 80 7d 00 2f       	cmpb   $0x2f,0x0(%r13)
+  803e40:	75 10                	jne    803e52 <walk_path+0x506>
+        p++;
+  803e42:	48 83 c0 01          	add    $0x1,%rax
+    while (*p == '/')
+  803e46:	80 38 2f             	cmpb   $0x2f,(%rax)
+  803e49:	74 f7                	je     803e42 <walk_path+0x4f6>
+  803e4b:	48 89 85 28 ff ff ff 	mov    %rax,-0xd8(%rbp)
+    f = &super->s_root;
+  803e52:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  803e59:	00 00 00 
+  803e5c:	48 83 c0 08          	add    $0x8,%rax
+  803e60:	48 89 85 40 ff ff ff 	mov    %rax,-0xc0(%rbp)
+    dir = 0;
+  803e67:	48 c7 85 48 ff ff ff 	movq   $0x0,-0xb8(%rbp)
+  803e6e:	00 00 00 00 
+    name[0] = 0;
+  803e72:	c6 85 50 ff ff ff 00 	movb   $0x0,-0xb0(%rbp)
+            if (strcmp(f[j].f_name, name) == 0) {
+  803e79:	49 bf 9a 7e 80 00 00 	movabs $0x807e9a,%r15
+  803e80:	00 00 00 
+  803e83:	4c 89 ad 08 ff ff ff 	mov    %r13,-0xf8(%rbp)
+  803e8a:	4c 89 a5 00 ff ff ff 	mov    %r12,-0x100(%rbp)
+  803e91:	4c 89 b5 f8 fe ff ff 	mov    %r14,-0x108(%rbp)
+    while (*path != '\0') {
+  803e98:	e9 4d fd ff ff       	jmp    803bea <walk_path+0x29e>
+
+0000000000803e9d <file_open>:
+file_open(const char *path, struct File **pf) {
+  803e9d:	55                   	push   %rbp
+  803e9e:	48 89 e5             	mov    %rsp,%rbp
+  803ea1:	48 89 f2             	mov    %rsi,%rdx
+    return walk_path(path, 0, pf, 0);
+  803ea4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803ea9:	be 00 00 00 00       	mov    $0x0,%esi
+  803eae:	48 b8 4c 39 80 00 00 	movabs $0x80394c,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+}
+  803eba:	5d                   	pop    %rbp
+  803ebb:	c3                   	ret
+
+0000000000803ebc <file_readahead>:
+file_readahead(struct File *f, blockno_t first, blockno_t end) {
+  803ebc:	55                   	push   %rbp
+  803ebd:	48 89 e5             	mov    %rsp,%rbp
+  803ec0:	41 57                	push   %r15
+  803ec2:	41 56                	push   %r14
+  803ec4:	41 55                	push   %r13
+  803ec6:	41 54                	push   %r12
+  803ec8:	53                   	push   %rbx
+  803ec9:	48 83 ec 28          	sub    $0x28,%rsp
+  803ecd:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803ed1:	41 89 f4             	mov    %esi,%r12d
+    while (i < end) {
+  803ed4:	39 d6                	cmp    %edx,%esi
+  803ed6:	0f 83 9d 00 00 00    	jae    803f79 <file_readahead+0xbd>
+  803edc:	41 89 d5             	mov    %edx,%r13d
+        int run = file_block_map(f, i, &start);
+  803edf:	49 bf 52 34 80 00 00 	movabs $0x803452,%r15
+  803ee6:	00 00 00 
+  803ee9:	eb 1d                	jmp    803f08 <file_readahead+0x4c>
+        blockno_t done = bc_readahead(start, n);
+  803eeb:	89 de                	mov    %ebx,%esi
+  803eed:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  803ef0:	48 b8 0a 20 80 00 00 	movabs $0x80200a,%rax
+  803ef7:	00 00 00 
+  803efa:	ff d0                	call   *%rax
+        i += done;
+  803efc:	41 01 c4             	add    %eax,%r12d
+        if (done < n) break;
+  803eff:	39 d8                	cmp    %ebx,%eax
+  803f01:	72 64                	jb     803f67 <file_readahead+0xab>
+    while (i < end) {
+  803f03:	45 39 ec             	cmp    %r13d,%r12d
+  803f06:	73 5a                	jae    803f62 <file_readahead+0xa6>
+        int run = file_block_map(f, i, &start);
+  803f08:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803f0c:	44 89 e6             	mov    %r12d,%esi
+  803f0f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f13:	41 ff d7             	call   *%r15
+        if (run <= 0) break;
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	7e 4d                	jle    803f67 <file_readahead+0xab>
+        blockno_t n = MIN(run, end - i), next;
+  803f1a:	45 89 ee             	mov    %r13d,%r14d
+  803f1d:	45 29 e6             	sub    %r12d,%r14d
+  803f20:	44 39 f0             	cmp    %r14d,%eax
+  803f23:	41 0f 47 c6          	cmova  %r14d,%eax
+  803f27:	89 c3                	mov    %eax,%ebx
+        while (i + n < end && (run = file_block_map(f, i + n, &next)) > 0 && next == start + n)
+  803f29:	42 8d 34 20          	lea    (%rax,%r12,1),%esi
+  803f2d:	44 39 ee             	cmp    %r13d,%esi
+  803f30:	73 b9                	jae    803eeb <file_readahead+0x2f>
+  803f32:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  803f36:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803f3a:	41 ff d7             	call   *%r15
+  803f3d:	85 c0                	test   %eax,%eax
+  803f3f:	7e aa                	jle    803eeb <file_readahead+0x2f>
+  803f41:	89 da                	mov    %ebx,%edx
+  803f43:	03 55 c8             	add    -0x38(%rbp),%edx
+  803f46:	3b 55 cc             	cmp    -0x34(%rbp),%edx
+  803f49:	75 a0                	jne    803eeb <file_readahead+0x2f>
+            n += MIN(run, end - i - n);
+  803f4b:	44 89 f2             	mov    %r14d,%edx
+  803f4e:	29 da                	sub    %ebx,%edx
+  803f50:	39 c2                	cmp    %eax,%edx
+  803f52:	0f 47 d0             	cmova  %eax,%edx
+  803f55:	01 d3                	add    %edx,%ebx
+        while (i + n < end && (run = file_block_map(f, i + n, &next)) > 0 && next == start + n)
+  803f57:	42 8d 34 23          	lea    (%rbx,%r12,1),%esi
+  803f5b:	44 39 ee             	cmp    %r13d,%esi
+  803f5e:	72 d2                	jb     803f32 <file_readahead+0x76>
+  803f60:	eb 89                	jmp    803eeb <file_readahead+0x2f>
+        i += done;
+  803f62:	44 89 e0             	mov    %r12d,%eax
+  803f65:	eb 03                	jmp    803f6a <file_readahead+0xae>
+  803f67:	44 89 e0             	mov    %r12d,%eax
+}
+  803f6a:	48 83 c4 28          	add    $0x28,%rsp
+  803f6e:	5b                   	pop    %rbx
+  803f6f:	41 5c                	pop    %r12
+  803f71:	41 5d                	pop    %r13
+  803f73:	41 5e                	pop    %r14
+  803f75:	41 5f                	pop    %r15
+  803f77:	5d                   	pop    %rbp
+  803f78:	c3                   	ret
+    blockno_t i = first;
+  803f79:	89 f0                	mov    %esi,%eax
+    return i;
+  803f7b:	eb ed                	jmp    803f6a <file_readahead+0xae>
+
+0000000000803f7d <file_read>:
+file_read(struct File *f, void *buf, size_t count, off_t offset) {
+  803f7d:	55                   	push   %rbp
+  803f7e:	48 89 e5             	mov    %rsp,%rbp
+  803f81:	41 57                	push   %r15
+  803f83:	41 56                	push   %r14
+  803f85:	41 55                	push   %r13
+  803f87:	41 54                	push   %r12
+  803f89:	53                   	push   %rbx
+  803f8a:	48 83 ec 48          	sub    $0x48,%rsp
+  803f8e:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+  803f92:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+  803f96:	89 cb                	mov    %ecx,%ebx
+    if (offset >= f->f_size)
+  803f98:	8b 8f 80 00 00 00    	mov    0x80(%rdi),%ecx
+        return 0;
+  803f9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    if (offset >= f->f_size)
+  803fa3:	39 d9                	cmp    %ebx,%ecx
+  803fa5:	7f 0f                	jg     803fb6 <file_read+0x39>
+}
+  803fa7:	48 83 c4 48          	add    $0x48,%rsp
+  803fab:	5b                   	pop    %rbx
+  803fac:	41 5c                	pop    %r12
+  803fae:	41 5d                	pop    %r13
+  803fb0:	41 5e                	pop    %r14
+  803fb2:	41 5f                	pop    %r15
+  803fb4:	5d                   	pop    %rbp
+  803fb5:	c3                   	ret
+    count = MIN(count, f->f_size - offset);
+  803fb6:	29 d9                	sub    %ebx,%ecx
+  803fb8:	48 63 c9             	movslq %ecx,%rcx
+  803fbb:	48 39 d1             	cmp    %rdx,%rcx
+  803fbe:	48 0f 46 d1          	cmovbe %rcx,%rdx
+  803fc2:	48 89 55 98          	mov    %rdx,-0x68(%rbp)
+    file_load_blocks(f, offset / BLKSIZE, CEILDIV(offset + count, BLKSIZE));
+  803fc6:	4c 63 fb             	movslq %ebx,%r15
+  803fc9:	49 8d 94 17 ff 0f 00 	lea    0xfff(%r15,%rdx,1),%rdx
+  803fd0:	00 
+  803fd1:	48 c1 ea 0c          	shr    $0xc,%rdx
+  803fd5:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  803fd8:	8d 83 ff 0f 00 00    	lea    0xfff(%rbx),%eax
+  803fde:	85 db                	test   %ebx,%ebx
+  803fe0:	0f 49 c3             	cmovns %ebx,%eax
+  803fe3:	c1 f8 0c             	sar    $0xc,%eax
+  803fe6:	41 89 c5             	mov    %eax,%r13d
+    for (blockno_t i = first; i < end;) {
+  803fe9:	39 d0                	cmp    %edx,%eax
+  803feb:	0f 83 67 01 00 00    	jae    804158 <file_read+0x1db>
+    blockno_t start = 0, n = 0;
+  803ff1:	c7 45 ac 00 00 00 00 	movl   $0x0,-0x54(%rbp)
+  803ff8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  803ffe:	eb 23                	jmp    804023 <file_read+0xa6>
+        if (n) bc_load(start, n);
+  804000:	44 89 f6             	mov    %r14d,%esi
+  804003:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  804006:	48 b8 f6 1d 80 00 00 	movabs $0x801df6,%rax
+  80400d:	00 00 00 
+  804010:	ff d0                	call   *%rax
+        start = diskbno;
+  804012:	8b 45 c4             	mov    -0x3c(%rbp),%eax
+  804015:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        n = run;
+  804018:	45 89 e6             	mov    %r12d,%r14d
+    for (blockno_t i = first; i < end;) {
+  80401b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80401e:	41 39 c5             	cmp    %eax,%r13d
+  804021:	73 41                	jae    804064 <file_read+0xe7>
+        int run = file_block_map(f, i, &diskbno);
+  804023:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  804027:	44 89 ee             	mov    %r13d,%esi
+  80402a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80402e:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  804035:	00 00 00 
+  804038:	ff d0                	call   *%rax
+        if (run <= 0) break;
+  80403a:	85 c0                	test   %eax,%eax
+  80403c:	7e 26                	jle    804064 <file_read+0xe7>
+        run = MIN(run, end - i);
+  80403e:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  804042:	45 29 ec             	sub    %r13d,%r12d
+  804045:	41 39 c4             	cmp    %eax,%r12d
+  804048:	44 0f 47 e0          	cmova  %eax,%r12d
+        i += run;
+  80404c:	45 01 e5             	add    %r12d,%r13d
+        if (n && diskbno == start + n) {
+  80404f:	45 85 f6             	test   %r14d,%r14d
+  804052:	74 be                	je     804012 <file_read+0x95>
+  804054:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  804057:	44 01 f0             	add    %r14d,%eax
+  80405a:	3b 45 c4             	cmp    -0x3c(%rbp),%eax
+  80405d:	75 a1                	jne    804000 <file_read+0x83>
+            n += run;
+  80405f:	45 01 e6             	add    %r12d,%r14d
+            continue;
+  804062:	eb b7                	jmp    80401b <file_read+0x9e>
+    if (n) bc_load(start, n);
+  804064:	45 85 f6             	test   %r14d,%r14d
+  804067:	0f 85 cd 00 00 00    	jne    80413a <file_read+0x1bd>
+    if (offset >= f->f_size) return 0;
+  80406d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804071:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80407c:	39 da                	cmp    %ebx,%edx
+  80407e:	0f 8e 23 ff ff ff    	jle    803fa7 <file_read+0x2a>
+    count = MIN(count, f->f_size - offset);
+  804084:	29 da                	sub    %ebx,%edx
+  804086:	48 63 d2             	movslq %edx,%rdx
+  804089:	48 8b 45 98          	mov    -0x68(%rbp),%rax
+  80408d:	48 39 c2             	cmp    %rax,%rdx
+  804090:	48 0f 47 d0          	cmova  %rax,%rdx
+  804094:	48 89 55 b8          	mov    %rdx,-0x48(%rbp)
+    for (off_t pos = offset; pos < offset + count;) {
+  804098:	4d 8d 34 17          	lea    (%r15,%rdx,1),%r14
+  80409c:	4d 39 f7             	cmp    %r14,%r15
+  80409f:	0f 83 8c 00 00 00    	jae    804131 <file_read+0x1b4>
+        int r = file_get_block(f, pos / BLKSIZE, &blk);
+  8040a5:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  8040ab:	85 db                	test   %ebx,%ebx
+  8040ad:	0f 49 f3             	cmovns %ebx,%esi
+  8040b0:	c1 fe 0c             	sar    $0xc,%esi
+  8040b3:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8040b7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8040bb:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  8040c2:	00 00 00 
+  8040c5:	ff d0                	call   *%rax
+        if (r < 0) return r;
+  8040c7:	85 c0                	test   %eax,%eax
+  8040c9:	0f 88 82 00 00 00    	js     804151 <file_read+0x1d4>
+        int bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  8040cf:	89 d8                	mov    %ebx,%eax
+  8040d1:	c1 f8 1f             	sar    $0x1f,%eax
+  8040d4:	c1 e8 14             	shr    $0x14,%eax
+  8040d7:	8d 34 03             	lea    (%rbx,%rax,1),%esi
+  8040da:	81 e6 ff 0f 00 00    	and    $0xfff,%esi
+  8040e0:	29 c6                	sub    %eax,%esi
+  8040e2:	48 63 f6             	movslq %esi,%rsi
+  8040e5:	41 bc 00 10 00 00    	mov    $0x1000,%r12d
+  8040eb:	49 29 f4             	sub    %rsi,%r12
+  8040ee:	4c 89 f0             	mov    %r14,%rax
+  8040f1:	4c 29 f8             	sub    %r15,%rax
+  8040f4:	49 39 c4             	cmp    %rax,%r12
+  8040f7:	4c 0f 47 e0          	cmova  %rax,%r12
+        memmove(buf, blk + pos % BLKSIZE, bn);
+  8040fb:	4d 63 ec             	movslq %r12d,%r13
+  8040fe:	48 03 75 c8          	add    -0x38(%rbp),%rsi
+  804102:	4c 89 ea             	mov    %r13,%rdx
+  804105:	4c 8b 7d a0          	mov    -0x60(%rbp),%r15
+  804109:	4c 89 ff             	mov    %r15,%rdi
+  80410c:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+        pos += bn;
+  804118:	44 01 e3             	add    %r12d,%ebx
+        buf += bn;
+  80411b:	4c 89 f8             	mov    %r15,%rax
+  80411e:	4c 01 e8             	add    %r13,%rax
+  804121:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+    for (off_t pos = offset; pos < offset + count;) {
+  804125:	4c 63 fb             	movslq %ebx,%r15
+  804128:	4d 39 f7             	cmp    %r14,%r15
+  80412b:	0f 82 74 ff ff ff    	jb     8040a5 <file_read+0x128>
+    return count;
+  804131:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804135:	e9 6d fe ff ff       	jmp    803fa7 <file_read+0x2a>
+    if (n) bc_load(start, n);
+  80413a:	44 89 f6             	mov    %r14d,%esi
+  80413d:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  804140:	48 b8 f6 1d 80 00 00 	movabs $0x801df6,%rax
+  804147:	00 00 00 
+  80414a:	ff d0                	call   *%rax
+  80414c:	e9 1c ff ff ff       	jmp    80406d <file_read+0xf0>
+        if (r < 0) return r;
+  804151:	48 98                	cltq
+  804153:	e9 4f fe ff ff       	jmp    803fa7 <file_read+0x2a>
+    if (offset >= f->f_size) return 0;
+  804158:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80415c:	8b 90 80 00 00 00    	mov    0x80(%rax),%edx
+  804162:	e9 1d ff ff ff       	jmp    804084 <file_read+0x107>
+
+0000000000804167 <file_set_size>:
+
+/* Set the size of file f, truncating or extending as necessary. */
+int
+file_set_size(struct File *f, off_t newsize) {
+  804167:	55                   	push   %rbp
+  804168:	48 89 e5             	mov    %rsp,%rbp
+  80416b:	41 54                	push   %r12
+  80416d:	53                   	push   %rbx
+  80416e:	48 89 fb             	mov    %rdi,%rbx
+  804171:	41 89 f4             	mov    %esi,%r12d
+    if (f->f_size > newsize)
+  804174:	39 b7 80 00 00 00    	cmp    %esi,0x80(%rdi)
+  80417a:	7f 20                	jg     80419c <file_set_size+0x35>
+        file_truncate_blocks(f, newsize);
+    f->f_size = newsize;
+  80417c:	44 89 a3 80 00 00 00 	mov    %r12d,0x80(%rbx)
+    flush_block(f);
+  804183:	48 89 df             	mov    %rbx,%rdi
+  804186:	48 b8 10 21 80 00 00 	movabs $0x802110,%rax
+  80418d:	00 00 00 
+  804190:	ff d0                	call   *%rax
+    return 0;
+}
+  804192:	b8 00 00 00 00       	mov    $0x0,%eax
+  804197:	5b                   	pop    %rbx
+  804198:	41 5c                	pop    %r12
+  80419a:	5d                   	pop    %rbp
+  80419b:	c3                   	ret
+        file_truncate_blocks(f, newsize);
+  80419c:	48 b8 94 31 80 00 00 	movabs $0x803194,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	eb d2                	jmp    80417c <file_set_size+0x15>
+
+00000000008041aa <file_write>:
+file_write(struct File *f, const void *buf, size_t count, off_t offset) {
+  8041aa:	55                   	push   %rbp
+  8041ab:	48 89 e5             	mov    %rsp,%rbp
+  8041ae:	41 57                	push   %r15
+  8041b0:	41 56                	push   %r14
+  8041b2:	41 55                	push   %r13
+  8041b4:	41 54                	push   %r12
+  8041b6:	53                   	push   %rbx
+  8041b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8041bb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8041bf:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+    if (offset < 0 || offset + count > MAXFILESIZE) return -E_INVAL;
+  8041c3:	85 c9                	test   %ecx,%ecx
+  8041c5:	0f 88 03 01 00 00    	js     8042ce <file_write+0x124>
+  8041cb:	49 89 f5             	mov    %rsi,%r13
+  8041ce:	41 89 cc             	mov    %ecx,%r12d
+  8041d1:	4c 63 f1             	movslq %ecx,%r14
+  8041d4:	4d 8d 3c 16          	lea    (%r14,%rdx,1),%r15
+  8041d8:	49 81 ff ff ff ff 7f 	cmp    $0x7fffffff,%r15
+  8041df:	0f 87 f2 00 00 00    	ja     8042d7 <file_write+0x12d>
+    if (offset + count > f->f_size)
+  8041e5:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  8041ec:	4c 39 f8             	cmp    %r15,%rax
+  8041ef:	0f 82 b5 00 00 00    	jb     8042aa <file_write+0x100>
+    for (off_t pos = offset; pos < offset + count;) {
+  8041f5:	4d 39 fe             	cmp    %r15,%r14
+  8041f8:	0f 83 99 00 00 00    	jae    804297 <file_write+0xed>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  8041fe:	41 8d b4 24 ff 0f 00 	lea    0xfff(%r12),%esi
+  804205:	00 
+  804206:	45 85 e4             	test   %r12d,%r12d
+  804209:	41 0f 49 f4          	cmovns %r12d,%esi
+  80420d:	c1 fe 0c             	sar    $0xc,%esi
+  804210:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  804214:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804218:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+  804224:	85 c0                	test   %eax,%eax
+  804226:	0f 88 9e 00 00 00    	js     8042ca <file_write+0x120>
+        uint32_t bn = MIN(BLKSIZE - pos % BLKSIZE, offset + count - pos);
+  80422c:	44 89 e0             	mov    %r12d,%eax
+  80422f:	c1 f8 1f             	sar    $0x1f,%eax
+  804232:	c1 e8 14             	shr    $0x14,%eax
+  804235:	41 8d 3c 04          	lea    (%r12,%rax,1),%edi
+  804239:	81 e7 ff 0f 00 00    	and    $0xfff,%edi
+  80423f:	29 c7                	sub    %eax,%edi
+  804241:	48 63 ff             	movslq %edi,%rdi
+  804244:	bb 00 10 00 00       	mov    $0x1000,%ebx
+  804249:	48 29 fb             	sub    %rdi,%rbx
+  80424c:	4c 89 f8             	mov    %r15,%rax
+  80424f:	4c 29 f0             	sub    %r14,%rax
+  804252:	48 39 c3             	cmp    %rax,%rbx
+  804255:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(blk + pos % BLKSIZE, buf, bn);
+  804259:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80425d:	4c 01 f7             	add    %r14,%rdi
+  804260:	48 89 da             	mov    %rbx,%rdx
+  804263:	4c 89 ee             	mov    %r13,%rsi
+  804266:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  80426d:	00 00 00 
+  804270:	ff d0                	call   *%rax
+        bc_mark_dirty(blk);
+  804272:	4c 89 f7             	mov    %r14,%rdi
+  804275:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80427c:	00 00 00 
+  80427f:	ff d0                	call   *%rax
+        pos += bn;
+  804281:	45 8d 34 1c          	lea    (%r12,%rbx,1),%r14d
+  804285:	45 89 f4             	mov    %r14d,%r12d
+        buf += bn;
+  804288:	49 01 dd             	add    %rbx,%r13
+    for (off_t pos = offset; pos < offset + count;) {
+  80428b:	4d 63 f6             	movslq %r14d,%r14
+  80428e:	4d 39 fe             	cmp    %r15,%r14
+  804291:	0f 82 67 ff ff ff    	jb     8041fe <file_write+0x54>
+    return count;
+  804297:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+}
+  80429b:	48 83 c4 28          	add    $0x28,%rsp
+  80429f:	5b                   	pop    %rbx
+  8042a0:	41 5c                	pop    %r12
+  8042a2:	41 5d                	pop    %r13
+  8042a4:	41 5e                	pop    %r14
+  8042a6:	41 5f                	pop    %r15
+  8042a8:	5d                   	pop    %rbp
+  8042a9:	c3                   	ret
+        if ((res = file_set_size(f, offset + count)) < 0) return res;
+  8042aa:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8042ad:	8d 34 01             	lea    (%rcx,%rax,1),%esi
+  8042b0:	48 b8 67 41 80 00 00 	movabs $0x804167,%rax
+  8042b7:	00 00 00 
+  8042ba:	ff d0                	call   *%rax
+  8042bc:	89 c2                	mov    %eax,%edx
+  8042be:	48 98                	cltq
+  8042c0:	85 d2                	test   %edx,%edx
+  8042c2:	0f 89 2d ff ff ff    	jns    8041f5 <file_write+0x4b>
+  8042c8:	eb d1                	jmp    80429b <file_write+0xf1>
+        if ((res = file_get_block(f, pos / BLKSIZE, &blk)) < 0) return res;
+  8042ca:	48 98                	cltq
+  8042cc:	eb cd                	jmp    80429b <file_write+0xf1>
+    if (offset < 0 || offset + count > MAXFILESIZE) return -E_INVAL;
+  8042ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042d5:	eb c4                	jmp    80429b <file_write+0xf1>
+  8042d7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8042de:	eb bb                	jmp    80429b <file_write+0xf1>
+
+00000000008042e0 <file_flush>:
+/* Flush the contents and metadata of file f out to disk.
+ * Loop over all the blocks in file.
+ * Translate the file block number into a disk block number
+ * and then check whether that disk block is dirty.  If so, write it out. */
+void
+file_flush(struct File *f) {
+  8042e0:	55                   	push   %rbp
+  8042e1:	48 89 e5             	mov    %rsp,%rbp
+  8042e4:	41 57                	push   %r15
+  8042e6:	41 56                	push   %r14
+  8042e8:	41 55                	push   %r13
+  8042ea:	41 54                	push   %r12
+  8042ec:	53                   	push   %rbx
+  8042ed:	48 83 ec 38          	sub    $0x38,%rsp
+  8042f1:	48 89 fb             	mov    %rdi,%rbx
+  8042f4:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+    blockno_t nblocks = CEILDIV(f->f_size, BLKSIZE);
+  8042f8:	48 63 87 80 00 00 00 	movslq 0x80(%rdi),%rax
+  8042ff:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  804305:	48 c1 e8 0c          	shr    $0xc,%rax
+  804309:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80430d:	89 45 b4             	mov    %eax,-0x4c(%rbp)
+    struct Extent *last;
+    blockno_t ext_nblocks = file_extent_blocks(f, &last);
+  804310:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804314:	48 b8 67 28 80 00 00 	movabs $0x802867,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+  804320:	41 89 c7             	mov    %eax,%r15d
+
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++)
+  804323:	4c 8d a3 88 00 00 00 	lea    0x88(%rbx),%r12
+  80432a:	48 8d 83 f0 00 00 00 	lea    0xf0(%rbx),%rax
+  804331:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        for (blockno_t i = 0; i < ext->e_len; i++)
+            flush_block_deferred(diskaddr(ext->e_start + i));
+  804335:	49 be d0 14 80 00 00 	movabs $0x8014d0,%r14
+  80433c:	00 00 00 
+  80433f:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  804346:	00 00 00 
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++)
+  804349:	49 39 c4             	cmp    %rax,%r12
+  80434c:	0f 82 9c 00 00 00    	jb     8043ee <file_flush+0x10e>
+
+    for (blockno_t i = ext_nblocks; i < nblocks; i++) {
+        blockno_t diskbno;
+        if (file_block_map(f, i, &diskbno) > 0)
+  804352:	48 bb 52 34 80 00 00 	movabs $0x803452,%rbx
+  804359:	00 00 00 
+            flush_block_deferred(diskaddr(diskbno));
+  80435c:	49 bc d0 14 80 00 00 	movabs $0x8014d0,%r12
+  804363:	00 00 00 
+  804366:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  80436d:	00 00 00 
+    for (blockno_t i = ext_nblocks; i < nblocks; i++) {
+  804370:	8b 45 a0             	mov    -0x60(%rbp),%eax
+  804373:	41 39 c7             	cmp    %eax,%r15d
+  804376:	0f 82 ac 00 00 00    	jb     804428 <file_flush+0x148>
+    }
+
+    if (f->f_indirect)
+  80437c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804380:	8b b8 f0 00 00 00    	mov    0xf0(%rax),%edi
+  804386:	85 ff                	test   %edi,%edi
+  804388:	0f 85 b9 00 00 00    	jne    804447 <file_flush+0x167>
+        flush_block_deferred(diskaddr(f->f_indirect));
+    if (f->f_dindirect) {
+  80438e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804392:	8b b8 f4 00 00 00    	mov    0xf4(%rax),%edi
+  804398:	85 ff                	test   %edi,%edi
+  80439a:	0f 85 c7 00 00 00    	jne    804467 <file_flush+0x187>
+        blockno_t *dind = diskaddr(f->f_dindirect);
+        for (blockno_t i = 0; i < NINDIRECT; i++)
+            if (dind[i]) flush_block_deferred(diskaddr(dind[i]));
+        flush_block_deferred(dind);
+    }
+    dir_index_flush(f);
+  8043a0:	48 8b 5d b8          	mov    -0x48(%rbp),%rbx
+  8043a4:	48 89 df             	mov    %rbx,%rdi
+  8043a7:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  8043ae:	00 00 00 
+  8043b1:	ff d0                	call   *%rax
+    flush_block_deferred(f);
+  8043b3:	48 89 df             	mov    %rbx,%rdi
+  8043b6:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8043bd:	00 00 00 
+  8043c0:	ff d0                	call   *%rax
+    flush_commit();
+  8043c2:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8043c9:	00 00 00 
+  8043cc:	ff d0                	call   *%rax
+}
+  8043ce:	48 83 c4 38          	add    $0x38,%rsp
+  8043d2:	5b                   	pop    %rbx
+  8043d3:	41 5c                	pop    %r12
+  8043d5:	41 5d                	pop    %r13
+  8043d7:	41 5e                	pop    %r14
+  8043d9:	41 5f                	pop    %r15
+  8043db:	5d                   	pop    %rbp
+  8043dc:	c3                   	ret
+    for (struct Extent *ext = f->f_extent; ext < f->f_extent + NEXTENT && ext->e_len; ext++)
+  8043dd:	49 83 c4 08          	add    $0x8,%r12
+  8043e1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8043e5:	49 39 c4             	cmp    %rax,%r12
+  8043e8:	0f 84 64 ff ff ff    	je     804352 <file_flush+0x72>
+  8043ee:	41 83 7c 24 04 00    	cmpl   $0x0,0x4(%r12)
+  8043f4:	0f 84 58 ff ff ff    	je     804352 <file_flush+0x72>
+        for (blockno_t i = 0; i < ext->e_len; i++)
+  8043fa:	bb 00 00 00 00       	mov    $0x0,%ebx
+            flush_block_deferred(diskaddr(ext->e_start + i));
+  8043ff:	89 df                	mov    %ebx,%edi
+  804401:	41 03 3c 24          	add    (%r12),%edi
+  804405:	41 ff d6             	call   *%r14
+  804408:	48 89 c7             	mov    %rax,%rdi
+  80440b:	41 ff d5             	call   *%r13
+        for (blockno_t i = 0; i < ext->e_len; i++)
+  80440e:	83 c3 01             	add    $0x1,%ebx
+  804411:	41 3b 5c 24 04       	cmp    0x4(%r12),%ebx
+  804416:	72 e7                	jb     8043ff <file_flush+0x11f>
+  804418:	eb c3                	jmp    8043dd <file_flush+0xfd>
+    for (blockno_t i = ext_nblocks; i < nblocks; i++) {
+  80441a:	41 83 c7 01          	add    $0x1,%r15d
+  80441e:	44 39 7d b4          	cmp    %r15d,-0x4c(%rbp)
+  804422:	0f 84 54 ff ff ff    	je     80437c <file_flush+0x9c>
+        if (file_block_map(f, i, &diskbno) > 0)
+  804428:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  80442c:	44 89 fe             	mov    %r15d,%esi
+  80442f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  804433:	ff d3                	call   *%rbx
+  804435:	85 c0                	test   %eax,%eax
+  804437:	7e e1                	jle    80441a <file_flush+0x13a>
+            flush_block_deferred(diskaddr(diskbno));
+  804439:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  80443c:	41 ff d4             	call   *%r12
+  80443f:	48 89 c7             	mov    %rax,%rdi
+  804442:	41 ff d5             	call   *%r13
+  804445:	eb d3                	jmp    80441a <file_flush+0x13a>
+        flush_block_deferred(diskaddr(f->f_indirect));
+  804447:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80444e:	00 00 00 
+  804451:	ff d0                	call   *%rax
+  804453:	48 89 c7             	mov    %rax,%rdi
+  804456:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  80445d:	00 00 00 
+  804460:	ff d0                	call   *%rax
+  804462:	e9 27 ff ff ff       	jmp    80438e <file_flush+0xae>
+        blockno_t *dind = diskaddr(f->f_dindirect);
+  804467:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  80446e:	00 00 00 
+  804471:	ff d0                	call   *%rax
+  804473:	49 89 c7             	mov    %rax,%r15
+        for (blockno_t i = 0; i < NINDIRECT; i++)
+  804476:	48 89 c3             	mov    %rax,%rbx
+  804479:	4c 8d a0 00 10 00 00 	lea    0x1000(%rax),%r12
+            if (dind[i]) flush_block_deferred(diskaddr(dind[i]));
+  804480:	49 be d0 14 80 00 00 	movabs $0x8014d0,%r14
+  804487:	00 00 00 
+  80448a:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  804491:	00 00 00 
+  804494:	eb 09                	jmp    80449f <file_flush+0x1bf>
+        for (blockno_t i = 0; i < NINDIRECT; i++)
+  804496:	48 83 c3 04          	add    $0x4,%rbx
+  80449a:	49 39 dc             	cmp    %rbx,%r12
+  80449d:	74 11                	je     8044b0 <file_flush+0x1d0>
+            if (dind[i]) flush_block_deferred(diskaddr(dind[i]));
+  80449f:	8b 3b                	mov    (%rbx),%edi
+  8044a1:	85 ff                	test   %edi,%edi
+  8044a3:	74 f1                	je     804496 <file_flush+0x1b6>
+  8044a5:	41 ff d6             	call   *%r14
+  8044a8:	48 89 c7             	mov    %rax,%rdi
+  8044ab:	41 ff d5             	call   *%r13
+  8044ae:	eb e6                	jmp    804496 <file_flush+0x1b6>
+        flush_block_deferred(dind);
+  8044b0:	4c 89 ff             	mov    %r15,%rdi
+  8044b3:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8044ba:	00 00 00 
+  8044bd:	ff d0                	call   *%rax
+  8044bf:	e9 dc fe ff ff       	jmp    8043a0 <file_flush+0xc0>
+
+00000000008044c4 <file_create>:
+file_create(const char *path, struct File **pf) {
+  8044c4:	55                   	push   %rbp
+  8044c5:	48 89 e5             	mov    %rsp,%rbp
+  8044c8:	41 57                	push   %r15
+  8044ca:	41 56                	push   %r14
+  8044cc:	41 55                	push   %r13
+  8044ce:	41 54                	push   %r12
+  8044d0:	53                   	push   %rbx
+  8044d1:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  8044d8:	48 89 b5 20 ff ff ff 	mov    %rsi,-0xe0(%rbp)
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  8044df:	48 8d 8d 50 ff ff ff 	lea    -0xb0(%rbp),%rcx
+  8044e6:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8044ed:	48 8d b5 48 ff ff ff 	lea    -0xb8(%rbp),%rsi
+  8044f4:	48 b8 4c 39 80 00 00 	movabs $0x80394c,%rax
+  8044fb:	00 00 00 
+  8044fe:	ff d0                	call   *%rax
+  804500:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%rbp)
+  804506:	85 c0                	test   %eax,%eax
+  804508:	0f 84 2c 03 00 00    	je     80483a <file_create+0x376>
+    if (res != -E_NOT_FOUND || dir == 0) return res;
+  80450e:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  804511:	0f 85 f2 02 00 00    	jne    804809 <file_create+0x345>
+  804517:	4c 8b ad 48 ff ff ff 	mov    -0xb8(%rbp),%r13
+  80451e:	4d 85 ed             	test   %r13,%r13
+  804521:	0f 84 e2 02 00 00    	je     804809 <file_create+0x345>
+    assert((dir->f_size % BLKSIZE) == 0);
+  804527:	41 8b 85 80 00 00 00 	mov    0x80(%r13),%eax
+  80452e:	89 c1                	mov    %eax,%ecx
+  804530:	81 e1 ff 0f 00 00    	and    $0xfff,%ecx
+  804536:	89 8d 2c ff ff ff    	mov    %ecx,-0xd4(%rbp)
+  80453c:	0f 85 a3 00 00 00    	jne    8045e5 <file_create+0x121>
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  804542:	44 8d b0 ff 0f 00 00 	lea    0xfff(%rax),%r14d
+  804549:	85 c0                	test   %eax,%eax
+  80454b:	44 0f 49 f0          	cmovns %eax,%r14d
+  80454f:	41 c1 fe 0c          	sar    $0xc,%r14d
+    struct DirIndex *idx = dir->f_dirindex ? diskaddr(dir->f_dirindex) : NULL;
+  804553:	45 8b a5 f8 00 00 00 	mov    0xf8(%r13),%r12d
+  80455a:	48 c7 85 18 ff ff ff 	movq   $0x0,-0xe8(%rbp)
+  804561:	00 00 00 00 
+  804565:	45 85 e4             	test   %r12d,%r12d
+  804568:	0f 85 ac 00 00 00    	jne    80461a <file_create+0x156>
+        int res = file_get_block(dir, i, &blk);
+  80456e:	49 bf eb 34 80 00 00 	movabs $0x8034eb,%r15
+  804575:	00 00 00 
+    for (; i < nblock && !f; i++) {
+  804578:	45 39 f4             	cmp    %r14d,%r12d
+  80457b:	0f 82 ef 00 00 00    	jb     804670 <file_create+0x1ac>
+        dir->f_size += BLKSIZE;
+  804581:	41 81 85 80 00 00 00 	addl   $0x1000,0x80(%r13)
+  804588:	00 10 00 00 
+        bc_mark_dirty(dir);
+  80458c:	4c 89 ef             	mov    %r13,%rdi
+  80458f:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804596:	00 00 00 
+  804599:	ff d0                	call   *%rax
+        int res = file_get_block(dir, nblock, &blk);
+  80459b:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  8045a2:	44 89 f6             	mov    %r14d,%esi
+  8045a5:	4c 89 ef             	mov    %r13,%rdi
+  8045a8:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  8045af:	00 00 00 
+  8045b2:	ff d0                	call   *%rax
+        if (res < 0) return res;
+  8045b4:	85 c0                	test   %eax,%eax
+  8045b6:	0f 88 8a 02 00 00    	js     804846 <file_create+0x382>
+        memset(blk, 0, BLKSIZE);
+  8045bc:	48 8b 9d 38 ff ff ff 	mov    -0xc8(%rbp),%rbx
+  8045c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8045cd:	48 89 df             	mov    %rbx,%rdi
+  8045d0:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  8045d7:	00 00 00 
+  8045da:	ff d0                	call   *%rax
+        i = nblock + 1;
+  8045dc:	45 8d 66 01          	lea    0x1(%r14),%r12d
+  8045e0:	e9 c3 00 00 00       	jmp    8046a8 <file_create+0x1e4>
+    assert((dir->f_size % BLKSIZE) == 0);
+  8045e5:	48 b9 4f c0 80 00 00 	movabs $0x80c04f,%rcx
+  8045ec:	00 00 00 
+  8045ef:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8045f6:	00 00 00 
+  8045f9:	be 2d 02 00 00       	mov    $0x22d,%esi
+  8045fe:	48 bf 8a bf 80 00 00 	movabs $0x80bf8a,%rdi
+  804605:	00 00 00 
+  804608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460d:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  804614:	00 00 00 
+  804617:	41 ff d0             	call   *%r8
+    struct DirIndex *idx = dir->f_dirindex ? diskaddr(dir->f_dirindex) : NULL;
+  80461a:	44 89 e7             	mov    %r12d,%edi
+  80461d:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  804624:	00 00 00 
+  804627:	ff d0                	call   *%rax
+  804629:	48 89 85 18 ff ff ff 	mov    %rax,-0xe8(%rbp)
+    blockno_t i = 0;
+  804630:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    if (idx) i = MIN(idx->di_free_hint, nblock);
+  804636:	48 85 c0             	test   %rax,%rax
+  804639:	0f 84 2f ff ff ff    	je     80456e <file_create+0xaa>
+  80463f:	44 8b 60 08          	mov    0x8(%rax),%r12d
+  804643:	45 39 e6             	cmp    %r12d,%r14d
+  804646:	45 0f 46 e6          	cmovbe %r14d,%r12d
+  80464a:	e9 1f ff ff ff       	jmp    80456e <file_create+0xaa>
+        for (blockno_t j = 0; j < BLKFILES && !f; j++)
+  80464f:	48 05 00 01 00 00    	add    $0x100,%rax
+  804655:	48 39 c2             	cmp    %rax,%rdx
+  804658:	74 3e                	je     804698 <file_create+0x1d4>
+            if (((struct File *)blk)[j].f_name[0] == '\0') f = (struct File *)blk + j;
+  80465a:	48 89 c3             	mov    %rax,%rbx
+  80465d:	80 38 00             	cmpb   $0x0,(%rax)
+  804660:	75 ed                	jne    80464f <file_create+0x18b>
+    for (; i < nblock && !f; i++) {
+  804662:	41 83 c4 01          	add    $0x1,%r12d
+  804666:	45 39 f4             	cmp    %r14d,%r12d
+  804669:	73 34                	jae    80469f <file_create+0x1db>
+  80466b:	48 85 db             	test   %rbx,%rbx
+  80466e:	75 2f                	jne    80469f <file_create+0x1db>
+        int res = file_get_block(dir, i, &blk);
+  804670:	48 8d 95 38 ff ff ff 	lea    -0xc8(%rbp),%rdx
+  804677:	44 89 e6             	mov    %r12d,%esi
+  80467a:	4c 89 ef             	mov    %r13,%rdi
+  80467d:	41 ff d7             	call   *%r15
+        if (res < 0) return res;
+  804680:	85 c0                	test   %eax,%eax
+  804682:	0f 88 aa 01 00 00    	js     804832 <file_create+0x36e>
+  804688:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  80468f:	48 8d 90 00 10 00 00 	lea    0x1000(%rax),%rdx
+  804696:	eb c2                	jmp    80465a <file_create+0x196>
+  804698:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80469d:	eb c3                	jmp    804662 <file_create+0x19e>
+    if (!f) {
+  80469f:	48 85 db             	test   %rbx,%rbx
+  8046a2:	0f 84 d9 fe ff ff    	je     804581 <file_create+0xbd>
+    if (idx) {
+  8046a8:	48 8b 8d 18 ff ff ff 	mov    -0xe8(%rbp),%rcx
+  8046af:	48 85 c9             	test   %rcx,%rcx
+  8046b2:	74 17                	je     8046cb <file_create+0x207>
+        idx->di_free_hint = i - 1;
+  8046b4:	41 8d 44 24 ff       	lea    -0x1(%r12),%eax
+  8046b9:	89 41 08             	mov    %eax,0x8(%rcx)
+        bc_mark_dirty(idx);
+  8046bc:	48 89 cf             	mov    %rcx,%rdi
+  8046bf:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8046c6:	00 00 00 
+  8046c9:	ff d0                	call   *%rax
+    memset(f, 0, sizeof(*f));
+  8046cb:	ba 00 01 00 00       	mov    $0x100,%edx
+  8046d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8046d5:	48 89 df             	mov    %rbx,%rdi
+  8046d8:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  8046df:	00 00 00 
+  8046e2:	ff d0                	call   *%rax
+    strcpy(f->f_name, name);
+  8046e4:	49 89 df             	mov    %rbx,%r15
+  8046e7:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8046ee:	48 89 df             	mov    %rbx,%rdi
+  8046f1:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  8046f8:	00 00 00 
+  8046fb:	ff d0                	call   *%rax
+    bc_mark_dirty(f);
+  8046fd:	48 89 df             	mov    %rbx,%rdi
+  804700:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804707:	00 00 00 
+  80470a:	ff d0                	call   *%rax
+    dcache_update(dir, name, f);
+  80470c:	48 89 da             	mov    %rbx,%rdx
+  80470f:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  804716:	4c 89 ef             	mov    %r13,%rdi
+  804719:	48 b8 fc 4c 80 00 00 	movabs $0x804cfc,%rax
+  804720:	00 00 00 
+  804723:	ff d0                	call   *%rax
+    if (!dir->f_dirindex) {
+  804725:	41 8b bd f8 00 00 00 	mov    0xf8(%r13),%edi
+  80472c:	85 ff                	test   %edi,%edi
+  80472e:	75 2a                	jne    80475a <file_create+0x296>
+        if (dir->f_size / BLKSIZE >= DIRINDEX_MIN_BLOCKS) dir_index_build(dir, 1);
+  804730:	41 81 bd 80 00 00 00 	cmpl   $0x3fff,0x80(%r13)
+  804737:	ff 3f 00 00 
+  80473b:	0f 8e a8 00 00 00    	jle    8047e9 <file_create+0x325>
+  804741:	be 01 00 00 00       	mov    $0x1,%esi
+  804746:	4c 89 ef             	mov    %r13,%rdi
+  804749:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  804750:	00 00 00 
+  804753:	ff d0                	call   *%rax
+  804755:	e9 8f 00 00 00       	jmp    8047e9 <file_create+0x325>
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  80475a:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  804761:	00 00 00 
+  804764:	ff d0                	call   *%rax
+  804766:	49 89 c6             	mov    %rax,%r14
+    if (idx->di_count >= DIRINDEX_LOAD * DIRINDEX_NBUCKETS * idx->di_nblocks &&
+  804769:	8b 00                	mov    (%rax),%eax
+  80476b:	41 8b 4e 04          	mov    0x4(%r14),%ecx
+  80476f:	89 c2                	mov    %eax,%edx
+  804771:	48 c1 e2 0b          	shl    $0xb,%rdx
+  804775:	48 39 d1             	cmp    %rdx,%rcx
+  804778:	7c 0f                	jl     804789 <file_create+0x2c5>
+        idx->di_nblocks * 2 <= DIRINDEX_MAXBLOCKS) {
+  80477a:	8d 34 00             	lea    (%rax,%rax,1),%esi
+    if (idx->di_count >= DIRINDEX_LOAD * DIRINDEX_NBUCKETS * idx->di_nblocks &&
+  80477d:	81 fe fd 03 00 00    	cmp    $0x3fd,%esi
+  804783:	0f 86 98 00 00 00    	jbe    804821 <file_create+0x35d>
+    uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+  804789:	4c 89 ff             	mov    %r15,%rdi
+  80478c:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  804793:	00 00 00 
+  804796:	ff d0                	call   *%rax
+  804798:	89 c6                	mov    %eax,%esi
+  80479a:	4c 89 f7             	mov    %r14,%rdi
+  80479d:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  8047a4:	00 00 00 
+  8047a7:	ff d0                	call   *%rax
+  8047a9:	48 89 c7             	mov    %rax,%rdi
+    f->f_hnext = *bucket;
+  8047ac:	8b 00                	mov    (%rax),%eax
+  8047ae:	89 83 fc 00 00 00    	mov    %eax,0xfc(%rbx)
+    dir_index_add(dir, f, (i - 1) * BLKFILES + (f - (struct File *)ROUNDDOWN(f, BLKSIZE)));
+  8047b4:	41 c1 e4 04          	shl    $0x4,%r12d
+  8047b8:	48 89 d8             	mov    %rbx,%rax
+  8047bb:	25 ff 0f 00 00       	and    $0xfff,%eax
+  8047c0:	48 c1 f8 08          	sar    $0x8,%rax
+    *bucket = slot + 1;
+  8047c4:	41 8d 44 04 f1       	lea    -0xf(%r12,%rax,1),%eax
+  8047c9:	89 07                	mov    %eax,(%rdi)
+    idx->di_count++;
+  8047cb:	41 83 46 04 01       	addl   $0x1,0x4(%r14)
+    bc_mark_dirty(bucket);
+  8047d0:	49 bc db 16 80 00 00 	movabs $0x8016db,%r12
+  8047d7:	00 00 00 
+  8047da:	41 ff d4             	call   *%r12
+    bc_mark_dirty(idx);
+  8047dd:	4c 89 f7             	mov    %r14,%rdi
+  8047e0:	41 ff d4             	call   *%r12
+    bc_mark_dirty(f);
+  8047e3:	48 89 df             	mov    %rbx,%rdi
+  8047e6:	41 ff d4             	call   *%r12
+    *file = f;
+  8047e9:	48 89 9d 40 ff ff ff 	mov    %rbx,-0xc0(%rbp)
+    *pf = filp;
+  8047f0:	48 8b 85 20 ff ff ff 	mov    -0xe0(%rbp),%rax
+  8047f7:	48 89 18             	mov    %rbx,(%rax)
+    file_flush(dir);
+  8047fa:	4c 89 ef             	mov    %r13,%rdi
+  8047fd:	48 b8 e0 42 80 00 00 	movabs $0x8042e0,%rax
+  804804:	00 00 00 
+  804807:	ff d0                	call   *%rax
+}
+  804809:	8b 85 2c ff ff ff    	mov    -0xd4(%rbp),%eax
+  80480f:	48 81 c4 c8 00 00 00 	add    $0xc8,%rsp
+  804816:	5b                   	pop    %rbx
+  804817:	41 5c                	pop    %r12
+  804819:	41 5d                	pop    %r13
+  80481b:	41 5e                	pop    %r14
+  80481d:	41 5f                	pop    %r15
+  80481f:	5d                   	pop    %rbp
+  804820:	c3                   	ret
+        dir_index_build(dir, idx->di_nblocks * 2);
+  804821:	4c 89 ef             	mov    %r13,%rdi
+  804824:	48 b8 53 37 80 00 00 	movabs $0x803753,%rax
+  80482b:	00 00 00 
+  80482e:	ff d0                	call   *%rax
+        return;
+  804830:	eb b7                	jmp    8047e9 <file_create+0x325>
+        int res = file_get_block(dir, i, &blk);
+  804832:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%rbp)
+  804838:	eb cf                	jmp    804809 <file_create+0x345>
+    if (!(res = walk_path(path, &dir, &filp, name))) return -E_FILE_EXISTS;
+  80483a:	c7 85 2c ff ff ff ef 	movl   $0xffffffef,-0xd4(%rbp)
+  804841:	ff ff ff 
+  804844:	eb c3                	jmp    804809 <file_create+0x345>
+        if (res < 0) return res;
+  804846:	89 85 2c ff ff ff    	mov    %eax,-0xd4(%rbp)
+  80484c:	eb bb                	jmp    804809 <file_create+0x345>
+
+000000000080484e <file_fsync>:
+file_fsync(struct File *f) {
+  80484e:	55                   	push   %rbp
+  80484f:	48 89 e5             	mov    %rsp,%rbp
+  804852:	41 57                	push   %r15
+  804854:	41 56                	push   %r14
+  804856:	41 55                	push   %r13
+  804858:	41 54                	push   %r12
+  80485a:	53                   	push   %rbx
+  80485b:	48 83 ec 08          	sub    $0x8,%rsp
+  80485f:	49 89 ff             	mov    %rdi,%r15
+    for (blockno_t i = 2; i < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE); i++)
+  804862:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  804869:	00 00 00 
+  80486c:	8b 40 04             	mov    0x4(%rax),%eax
+  80486f:	48 05 ff 7f 00 00    	add    $0x7fff,%rax
+  804875:	48 c1 e8 0f          	shr    $0xf,%rax
+  804879:	83 c0 02             	add    $0x2,%eax
+  80487c:	83 f8 02             	cmp    $0x2,%eax
+  80487f:	76 49                	jbe    8048ca <file_fsync+0x7c>
+  804881:	bb 02 00 00 00       	mov    $0x2,%ebx
+        flush_block_deferred(diskaddr(i));
+  804886:	49 be d0 14 80 00 00 	movabs $0x8014d0,%r14
+  80488d:	00 00 00 
+  804890:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  804897:	00 00 00 
+    for (blockno_t i = 2; i < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE); i++)
+  80489a:	49 bc 68 c1 84 00 00 	movabs $0x84c168,%r12
+  8048a1:	00 00 00 
+        flush_block_deferred(diskaddr(i));
+  8048a4:	89 df                	mov    %ebx,%edi
+  8048a6:	41 ff d6             	call   *%r14
+  8048a9:	48 89 c7             	mov    %rax,%rdi
+  8048ac:	41 ff d5             	call   *%r13
+    for (blockno_t i = 2; i < 2 + CEILDIV(super->s_nblocks, BLKBITSIZE); i++)
+  8048af:	83 c3 01             	add    $0x1,%ebx
+  8048b2:	49 8b 04 24          	mov    (%r12),%rax
+  8048b6:	8b 40 04             	mov    0x4(%rax),%eax
+  8048b9:	48 05 ff 7f 00 00    	add    $0x7fff,%rax
+  8048bf:	48 c1 e8 0f          	shr    $0xf,%rax
+  8048c3:	83 c0 02             	add    $0x2,%eax
+  8048c6:	39 c3                	cmp    %eax,%ebx
+  8048c8:	72 da                	jb     8048a4 <file_fsync+0x56>
+    file_flush(f);
+  8048ca:	4c 89 ff             	mov    %r15,%rdi
+  8048cd:	48 b8 e0 42 80 00 00 	movabs $0x8042e0,%rax
+  8048d4:	00 00 00 
+  8048d7:	ff d0                	call   *%rax
+}
+  8048d9:	48 83 c4 08          	add    $0x8,%rsp
+  8048dd:	5b                   	pop    %rbx
+  8048de:	41 5c                	pop    %r12
+  8048e0:	41 5d                	pop    %r13
+  8048e2:	41 5e                	pop    %r14
+  8048e4:	41 5f                	pop    %r15
+  8048e6:	5d                   	pop    %rbp
+  8048e7:	c3                   	ret
+
+00000000008048e8 <file_remove>:
+
+/* Remove "path" and free its blocks. Directories
+ * have to be empty, the root can't be removed.
+ * Returns 0 on success, < 0 on error. */
+int
+file_remove(const char *path) {
+  8048e8:	55                   	push   %rbp
+  8048e9:	48 89 e5             	mov    %rsp,%rbp
+  8048ec:	41 57                	push   %r15
+  8048ee:	41 56                	push   %r14
+  8048f0:	41 55                	push   %r13
+  8048f2:	41 54                	push   %r12
+  8048f4:	53                   	push   %rbx
+  8048f5:	48 83 ec 28          	sub    $0x28,%rsp
+    struct File *dir, *f;
+    int res = walk_path(path, &dir, &f, 0);
+  8048f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8048fe:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  804902:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804906:	48 b8 4c 39 80 00 00 	movabs $0x80394c,%rax
+  80490d:	00 00 00 
+  804910:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804912:	85 c0                	test   %eax,%eax
+  804914:	0f 88 cf 00 00 00    	js     8049e9 <file_remove+0x101>
+
+    if (!dir) return -E_BAD_PATH;
+  80491a:	4c 8b 75 c8          	mov    -0x38(%rbp),%r14
+  80491e:	4d 85 f6             	test   %r14,%r14
+  804921:	0f 84 90 02 00 00    	je     804bb7 <file_remove+0x2cf>
+    if (f->f_type == FTYPE_DIR && !dir_empty(f)) return -E_NOT_SUPP;
+  804927:	4c 8b 65 c0          	mov    -0x40(%rbp),%r12
+  80492b:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  804932:	00 01 
+  804934:	0f 84 be 00 00 00    	je     8049f8 <file_remove+0x110>
+
+    dcache_update(dir, f->f_name, NULL);
+  80493a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80493f:	4c 89 e6             	mov    %r12,%rsi
+  804942:	4c 89 f7             	mov    %r14,%rdi
+  804945:	48 b8 fc 4c 80 00 00 	movabs $0x804cfc,%rax
+  80494c:	00 00 00 
+  80494f:	ff d0                	call   *%rax
+    if (f->f_type == FTYPE_DIR) dcache_forget_dir(f);
+  804951:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  804958:	00 01 
+  80495a:	0f 84 36 01 00 00    	je     804a96 <file_remove+0x1ae>
+    if (!dir->f_dirindex) return;
+  804960:	41 8b be f8 00 00 00 	mov    0xf8(%r14),%edi
+  804967:	85 ff                	test   %edi,%edi
+  804969:	0f 85 3b 01 00 00    	jne    804aaa <file_remove+0x1c2>
+    dir_index_remove(dir, f);
+    file_truncate_blocks(f, 0);
+  80496f:	be 00 00 00 00       	mov    $0x0,%esi
+  804974:	4c 89 e7             	mov    %r12,%rdi
+  804977:	48 b8 94 31 80 00 00 	movabs $0x803194,%rax
+  80497e:	00 00 00 
+  804981:	ff d0                	call   *%rax
+    dir_index_drop(f);
+  804983:	4c 89 e7             	mov    %r12,%rdi
+  804986:	48 b8 71 2b 80 00 00 	movabs $0x802b71,%rax
+  80498d:	00 00 00 
+  804990:	ff d0                	call   *%rax
+    memset(f, 0, sizeof(*f));
+  804992:	ba 00 01 00 00       	mov    $0x100,%edx
+  804997:	be 00 00 00 00       	mov    $0x0,%esi
+  80499c:	4c 89 e7             	mov    %r12,%rdi
+  80499f:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  8049a6:	00 00 00 
+  8049a9:	ff d0                	call   *%rax
+    bc_mark_dirty(f);
+  8049ab:	4c 89 e7             	mov    %r12,%rdi
+  8049ae:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8049b5:	00 00 00 
+  8049b8:	ff d0                	call   *%rax
+
+    flush_block_deferred(f);
+  8049ba:	4c 89 e7             	mov    %r12,%rdi
+  8049bd:	48 b8 6f 15 80 00 00 	movabs $0x80156f,%rax
+  8049c4:	00 00 00 
+  8049c7:	ff d0                	call   *%rax
+    dir_index_flush(dir);
+  8049c9:	4c 89 f7             	mov    %r14,%rdi
+  8049cc:	48 b8 7d 29 80 00 00 	movabs $0x80297d,%rax
+  8049d3:	00 00 00 
+  8049d6:	ff d0                	call   *%rax
+    flush_commit();
+  8049d8:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  8049df:	00 00 00 
+  8049e2:	ff d0                	call   *%rax
+    return 0;
+  8049e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049e9:	48 83 c4 28          	add    $0x28,%rsp
+  8049ed:	5b                   	pop    %rbx
+  8049ee:	41 5c                	pop    %r12
+  8049f0:	41 5d                	pop    %r13
+  8049f2:	41 5e                	pop    %r14
+  8049f4:	41 5f                	pop    %r15
+  8049f6:	5d                   	pop    %rbp
+  8049f7:	c3                   	ret
+    if (dir->f_dirindex) return !((struct DirIndex *)diskaddr(dir->f_dirindex))->di_count;
+  8049f8:	41 8b 9c 24 f8 00 00 	mov    0xf8(%r12),%ebx
+  8049ff:	00 
+  804a00:	85 db                	test   %ebx,%ebx
+  804a02:	75 2d                	jne    804a31 <file_remove+0x149>
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+  804a04:	41 8b 94 24 80 00 00 	mov    0x80(%r12),%edx
+  804a0b:	00 
+  804a0c:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  804a12:	85 d2                	test   %edx,%edx
+  804a14:	0f 49 c2             	cmovns %edx,%eax
+  804a17:	c1 f8 0c             	sar    $0xc,%eax
+  804a1a:	48 98                	cltq
+        struct File *f = dir_slot(dir, slot);
+  804a1c:	49 bd e9 36 80 00 00 	movabs $0x8036e9,%r13
+  804a23:	00 00 00 
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+  804a26:	48 c1 e0 04          	shl    $0x4,%rax
+  804a2a:	75 4e                	jne    804a7a <file_remove+0x192>
+  804a2c:	e9 09 ff ff ff       	jmp    80493a <file_remove+0x52>
+    if (dir->f_dirindex) return !((struct DirIndex *)diskaddr(dir->f_dirindex))->di_count;
+  804a31:	89 df                	mov    %ebx,%edi
+  804a33:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  804a3a:	00 00 00 
+  804a3d:	ff d0                	call   *%rax
+    if (f->f_type == FTYPE_DIR && !dir_empty(f)) return -E_NOT_SUPP;
+  804a3f:	83 78 04 00          	cmpl   $0x0,0x4(%rax)
+  804a43:	0f 84 f1 fe ff ff    	je     80493a <file_remove+0x52>
+  804a49:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804a4e:	eb 99                	jmp    8049e9 <file_remove+0x101>
+    for (uint32_t slot = 0; slot < dir->f_size / BLKSIZE * BLKFILES; slot++) {
+  804a50:	83 c3 01             	add    $0x1,%ebx
+  804a53:	89 d9                	mov    %ebx,%ecx
+  804a55:	41 8b 94 24 80 00 00 	mov    0x80(%r12),%edx
+  804a5c:	00 
+  804a5d:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  804a63:	85 d2                	test   %edx,%edx
+  804a65:	0f 49 c2             	cmovns %edx,%eax
+  804a68:	c1 f8 0c             	sar    $0xc,%eax
+  804a6b:	48 98                	cltq
+  804a6d:	48 c1 e0 04          	shl    $0x4,%rax
+  804a71:	48 39 c1             	cmp    %rax,%rcx
+  804a74:	0f 83 c0 fe ff ff    	jae    80493a <file_remove+0x52>
+        struct File *f = dir_slot(dir, slot);
+  804a7a:	89 de                	mov    %ebx,%esi
+  804a7c:	4c 89 e7             	mov    %r12,%rdi
+  804a7f:	41 ff d5             	call   *%r13
+        if (f && f->f_name[0]) return 0;
+  804a82:	48 85 c0             	test   %rax,%rax
+  804a85:	74 c9                	je     804a50 <file_remove+0x168>
+  804a87:	80 38 00             	cmpb   $0x0,(%rax)
+  804a8a:	74 c4                	je     804a50 <file_remove+0x168>
+    if (f->f_type == FTYPE_DIR && !dir_empty(f)) return -E_NOT_SUPP;
+  804a8c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  804a91:	e9 53 ff ff ff       	jmp    8049e9 <file_remove+0x101>
+    if (f->f_type == FTYPE_DIR) dcache_forget_dir(f);
+  804a96:	4c 89 e7             	mov    %r12,%rdi
+  804a99:	48 b8 1b 4d 80 00 00 	movabs $0x804d1b,%rax
+  804aa0:	00 00 00 
+  804aa3:	ff d0                	call   *%rax
+  804aa5:	e9 b6 fe ff ff       	jmp    804960 <file_remove+0x78>
+    struct DirIndex *idx = diskaddr(dir->f_dirindex);
+  804aaa:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  804ab1:	00 00 00 
+  804ab4:	ff d0                	call   *%rax
+  804ab6:	49 89 c7             	mov    %rax,%r15
+    uint32_t *bucket = dir_index_bucket(idx, dir_hash(f->f_name));
+  804ab9:	4c 89 e7             	mov    %r12,%rdi
+  804abc:	48 b8 9e 28 80 00 00 	movabs $0x80289e,%rax
+  804ac3:	00 00 00 
+  804ac6:	ff d0                	call   *%rax
+  804ac8:	89 c6                	mov    %eax,%esi
+  804aca:	4c 89 ff             	mov    %r15,%rdi
+  804acd:	48 b8 43 29 80 00 00 	movabs $0x802943,%rax
+  804ad4:	00 00 00 
+  804ad7:	ff d0                	call   *%rax
+  804ad9:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+    uint32_t next = *bucket;
+  804add:	8b 18                	mov    (%rax),%ebx
+    for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+  804adf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    struct File *prev = NULL;
+  804ae5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804aec:	00 
+    for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+  804aed:	85 db                	test   %ebx,%ebx
+  804aef:	0f 84 ae 00 00 00    	je     804ba3 <file_remove+0x2bb>
+  804af5:	45 39 6f 04          	cmp    %r13d,0x4(%r15)
+  804af9:	0f 82 a4 00 00 00    	jb     804ba3 <file_remove+0x2bb>
+        uint32_t slot = next - 1;
+  804aff:	83 eb 01             	sub    $0x1,%ebx
+        struct File *cur = dir_slot(dir, slot);
+  804b02:	89 de                	mov    %ebx,%esi
+  804b04:	4c 89 f7             	mov    %r14,%rdi
+  804b07:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  804b0e:	00 00 00 
+  804b11:	ff d0                	call   *%rax
+        if (!cur) break;
+  804b13:	48 85 c0             	test   %rax,%rax
+  804b16:	0f 84 87 00 00 00    	je     804ba3 <file_remove+0x2bb>
+        if (cur == f) {
+  804b1c:	49 39 c4             	cmp    %rax,%r12
+  804b1f:	74 14                	je     804b35 <file_remove+0x24d>
+        next = cur->f_hnext;
+  804b21:	8b 98 fc 00 00 00    	mov    0xfc(%rax),%ebx
+    for (uint32_t n = 0; next && n <= idx->di_count; n++) {
+  804b27:	41 83 c5 01          	add    $0x1,%r13d
+  804b2b:	85 db                	test   %ebx,%ebx
+  804b2d:	74 74                	je     804ba3 <file_remove+0x2bb>
+        struct File *cur = dir_slot(dir, slot);
+  804b2f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  804b33:	eb c0                	jmp    804af5 <file_remove+0x20d>
+            if (prev) {
+  804b35:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804b39:	48 85 c9             	test   %rcx,%rcx
+  804b3c:	74 48                	je     804b86 <file_remove+0x29e>
+                prev->f_hnext = f->f_hnext;
+  804b3e:	8b 80 fc 00 00 00    	mov    0xfc(%rax),%eax
+  804b44:	89 81 fc 00 00 00    	mov    %eax,0xfc(%rcx)
+                bc_mark_dirty(prev);
+  804b4a:	48 89 cf             	mov    %rcx,%rdi
+  804b4d:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+            idx->di_count--;
+  804b59:	41 83 6f 04 01       	subl   $0x1,0x4(%r15)
+            idx->di_free_hint = MIN(idx->di_free_hint, slot / BLKFILES);
+  804b5e:	c1 eb 04             	shr    $0x4,%ebx
+  804b61:	89 db                	mov    %ebx,%ebx
+  804b63:	41 8b 47 08          	mov    0x8(%r15),%eax
+  804b67:	48 39 c3             	cmp    %rax,%rbx
+  804b6a:	48 0f 47 d8          	cmova  %rax,%rbx
+  804b6e:	41 89 5f 08          	mov    %ebx,0x8(%r15)
+            bc_mark_dirty(idx);
+  804b72:	4c 89 ff             	mov    %r15,%rdi
+  804b75:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804b7c:	00 00 00 
+  804b7f:	ff d0                	call   *%rax
+            return;
+  804b81:	e9 e9 fd ff ff       	jmp    80496f <file_remove+0x87>
+                *bucket = f->f_hnext;
+  804b86:	8b 80 fc 00 00 00    	mov    0xfc(%rax),%eax
+  804b8c:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  804b90:	89 01                	mov    %eax,(%rcx)
+                bc_mark_dirty(bucket);
+  804b92:	48 89 cf             	mov    %rcx,%rdi
+  804b95:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804b9c:	00 00 00 
+  804b9f:	ff d0                	call   *%rax
+  804ba1:	eb b6                	jmp    804b59 <file_remove+0x271>
+    dir_index_drop(dir);
+  804ba3:	4c 89 f7             	mov    %r14,%rdi
+  804ba6:	48 b8 71 2b 80 00 00 	movabs $0x802b71,%rax
+  804bad:	00 00 00 
+  804bb0:	ff d0                	call   *%rax
+  804bb2:	e9 b8 fd ff ff       	jmp    80496f <file_remove+0x87>
+    if (!dir) return -E_BAD_PATH;
+  804bb7:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  804bbc:	e9 28 fe ff ff       	jmp    8049e9 <file_remove+0x101>
+
+0000000000804bc1 <fs_sync>:
+
+/* Sync the entire file system */
+void
+fs_sync(void) {
+  804bc1:	55                   	push   %rbp
+  804bc2:	48 89 e5             	mov    %rsp,%rbp
+    bc_sync();
+  804bc5:	48 b8 a8 23 80 00 00 	movabs $0x8023a8,%rax
+  804bcc:	00 00 00 
+  804bcf:	ff d0                	call   *%rax
+}
+  804bd1:	5d                   	pop    %rbp
+  804bd2:	c3                   	ret
+
+0000000000804bd3 <dcache_lookup>:
+
+/* Look name up in directory dir. Returns true and sets *pf
+ * if the cache knows the answer, *pf is NULL if there
+ * is no such name */
+bool
+dcache_lookup(struct File *dir, const char *name, struct File **pf) {
+  804bd3:	55                   	push   %rbp
+  804bd4:	48 89 e5             	mov    %rsp,%rbp
+  804bd7:	41 54                	push   %r12
+  804bd9:	53                   	push   %rbx
+  804bda:	48 89 d3             	mov    %rdx,%rbx
+    uint32_t seed = (uint32_t)((uintptr_t)dir / sizeof(struct File));
+  804bdd:	48 89 fa             	mov    %rdi,%rdx
+  804be0:	48 c1 ea 08          	shr    $0x8,%rdx
+    return &dcache_names[dcache_hash(name, seed * 2654435761U) % DCACHE_NAMES];
+  804be4:	69 d2 b1 79 37 9e    	imul   $0x9e3779b1,%edx,%edx
+    uint32_t hash = 2166136261U ^ seed;
+  804bea:	81 f2 c5 9d 1c 81    	xor    $0x811c9dc5,%edx
+    while (*str)
+  804bf0:	0f b6 06             	movzbl (%rsi),%eax
+  804bf3:	84 c0                	test   %al,%al
+  804bf5:	74 19                	je     804c10 <dcache_lookup+0x3d>
+  804bf7:	48 89 f1             	mov    %rsi,%rcx
+        hash = (hash ^ (uint8_t)*str++) * 16777619U;
+  804bfa:	48 83 c1 01          	add    $0x1,%rcx
+  804bfe:	0f b6 c0             	movzbl %al,%eax
+  804c01:	31 c2                	xor    %eax,%edx
+  804c03:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+    while (*str)
+  804c09:	0f b6 01             	movzbl (%rcx),%eax
+  804c0c:	84 c0                	test   %al,%al
+  804c0e:	75 ea                	jne    804bfa <dcache_lookup+0x27>
+    return &dcache_names[dcache_hash(name, seed * 2654435761U) % DCACHE_NAMES];
+  804c10:	81 e2 ff 01 00 00    	and    $0x1ff,%edx
+  804c16:	41 89 d4             	mov    %edx,%r12d
+    struct dcache_name *dn = dcache_name_slot(dir, name);
+    if (dn->dn_dir != dir || strcmp(dn->dn_name, name)) return 0;
+  804c19:	89 d0                	mov    %edx,%eax
+  804c1b:	48 8d 04 c0          	lea    (%rax,%rax,8),%rax
+  804c1f:	48 c1 e0 04          	shl    $0x4,%rax
+  804c23:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c28:	48 b9 e0 11 85 00 00 	movabs $0x8511e0,%rcx
+  804c2f:	00 00 00 
+  804c32:	48 39 3c 01          	cmp    %rdi,(%rcx,%rax,1)
+  804c36:	74 07                	je     804c3f <dcache_lookup+0x6c>
+
+    *pf = dn->dn_file;
+    return 1;
+}
+  804c38:	89 d0                	mov    %edx,%eax
+  804c3a:	5b                   	pop    %rbx
+  804c3b:	41 5c                	pop    %r12
+  804c3d:	5d                   	pop    %rbp
+  804c3e:	c3                   	ret
+    if (dn->dn_dir != dir || strcmp(dn->dn_name, name)) return 0;
+  804c3f:	44 89 e0             	mov    %r12d,%eax
+  804c42:	48 8d 04 c0          	lea    (%rax,%rax,8),%rax
+  804c46:	48 c1 e0 04          	shl    $0x4,%rax
+  804c4a:	48 8d 7c 01 10       	lea    0x10(%rcx,%rax,1),%rdi
+  804c4f:	48 b8 9a 7e 80 00 00 	movabs $0x807e9a,%rax
+  804c56:	00 00 00 
+  804c59:	ff d0                	call   *%rax
+  804c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c60:	85 c0                	test   %eax,%eax
+  804c62:	75 d4                	jne    804c38 <dcache_lookup+0x65>
+    *pf = dn->dn_file;
+  804c64:	44 89 e2             	mov    %r12d,%edx
+  804c67:	48 8d 04 d2          	lea    (%rdx,%rdx,8),%rax
+  804c6b:	48 c1 e0 04          	shl    $0x4,%rax
+  804c6f:	48 ba e0 11 85 00 00 	movabs $0x8511e0,%rdx
+  804c76:	00 00 00 
+  804c79:	48 8b 44 02 08       	mov    0x8(%rdx,%rax,1),%rax
+  804c7e:	48 89 03             	mov    %rax,(%rbx)
+    return 1;
+  804c81:	ba 01 00 00 00       	mov    $0x1,%edx
+  804c86:	eb b0                	jmp    804c38 <dcache_lookup+0x65>
+
+0000000000804c88 <dcache_insert>:
+
+/* Remember that name in dir is f, or that there is no such name if f is NULL */
+void
+dcache_insert(struct File *dir, const char *name, struct File *f) {
+  804c88:	55                   	push   %rbp
+  804c89:	48 89 e5             	mov    %rsp,%rbp
+  804c8c:	49 89 d0             	mov    %rdx,%r8
+    uint32_t seed = (uint32_t)((uintptr_t)dir / sizeof(struct File));
+  804c8f:	48 89 f8             	mov    %rdi,%rax
+  804c92:	48 c1 e8 08          	shr    $0x8,%rax
+    return &dcache_names[dcache_hash(name, seed * 2654435761U) % DCACHE_NAMES];
+  804c96:	69 c0 b1 79 37 9e    	imul   $0x9e3779b1,%eax,%eax
+    uint32_t hash = 2166136261U ^ seed;
+  804c9c:	35 c5 9d 1c 81       	xor    $0x811c9dc5,%eax
+    while (*str)
+  804ca1:	0f b6 16             	movzbl (%rsi),%edx
+  804ca4:	84 d2                	test   %dl,%dl
+  804ca6:	74 19                	je     804cc1 <dcache_insert+0x39>
+  804ca8:	48 89 f1             	mov    %rsi,%rcx
+        hash = (hash ^ (uint8_t)*str++) * 16777619U;
+  804cab:	48 83 c1 01          	add    $0x1,%rcx
+  804caf:	0f b6 d2             	movzbl %dl,%edx
+  804cb2:	31 d0                	xor    %edx,%eax
+  804cb4:	69 c0 93 01 00 01    	imul   $0x1000193,%eax,%eax
+    while (*str)
+  804cba:	0f b6 11             	movzbl (%rcx),%edx
+  804cbd:	84 d2                	test   %dl,%dl
+  804cbf:	75 ea                	jne    804cab <dcache_insert+0x23>
+    struct dcache_name *dn = dcache_name_slot(dir, name);
+    dn->dn_dir = dir;
+  804cc1:	48 b9 e0 11 85 00 00 	movabs $0x8511e0,%rcx
+  804cc8:	00 00 00 
+  804ccb:	25 ff 01 00 00       	and    $0x1ff,%eax
+  804cd0:	48 8d 14 c5 00 00 00 	lea    0x0(,%rax,8),%rdx
+  804cd7:	00 
+  804cd8:	4c 8d 0c 02          	lea    (%rdx,%rax,1),%r9
+  804cdc:	49 c1 e1 04          	shl    $0x4,%r9
+  804ce0:	4a 89 3c 09          	mov    %rdi,(%rcx,%r9,1)
+    dn->dn_file = f;
+  804ce4:	4e 89 44 09 08       	mov    %r8,0x8(%rcx,%r9,1)
+    strcpy(dn->dn_name, name);
+  804ce9:	4a 8d 7c 09 10       	lea    0x10(%rcx,%r9,1),%rdi
+  804cee:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  804cf5:	00 00 00 
+  804cf8:	ff d0                	call   *%rax
+}
+  804cfa:	5d                   	pop    %rbp
+  804cfb:	c3                   	ret
+
+0000000000804cfc <dcache_update>:
+
+/* Same as dcache_insert(), but called when name has been
+ * created or removed, so cached paths are invalidated */
+void
+dcache_update(struct File *dir, const char *name, struct File *f) {
+  804cfc:	55                   	push   %rbp
+  804cfd:	48 89 e5             	mov    %rsp,%rbp
+    dcache_insert(dir, name, f);
+  804d00:	48 b8 88 4c 80 00 00 	movabs $0x804c88,%rax
+  804d07:	00 00 00 
+  804d0a:	ff d0                	call   *%rax
+    dcache_gen++;
+  804d0c:	48 b8 10 d0 80 00 00 	movabs $0x80d010,%rax
+  804d13:	00 00 00 
+  804d16:	83 00 01             	addl   $0x1,(%rax)
+}
+  804d19:	5d                   	pop    %rbp
+  804d1a:	c3                   	ret
+
+0000000000804d1b <dcache_forget_dir>:
+
+/* Forget all names in dir, which is being removed */
+void
+dcache_forget_dir(struct File *dir) {
+    for (size_t i = 0; i < DCACHE_NAMES; i++)
+  804d1b:	48 b8 e0 11 85 00 00 	movabs $0x8511e0,%rax
+  804d22:	00 00 00 
+  804d25:	48 8d 90 00 20 01 00 	lea    0x12000(%rax),%rdx
+  804d2c:	eb 0b                	jmp    804d39 <dcache_forget_dir+0x1e>
+  804d2e:	48 05 90 00 00 00    	add    $0x90,%rax
+  804d34:	48 39 d0             	cmp    %rdx,%rax
+  804d37:	74 0e                	je     804d47 <dcache_forget_dir+0x2c>
+        if (dcache_names[i].dn_dir == dir) dcache_names[i].dn_dir = NULL;
+  804d39:	48 39 38             	cmp    %rdi,(%rax)
+  804d3c:	75 f0                	jne    804d2e <dcache_forget_dir+0x13>
+  804d3e:	48 c7 00 00 00 00 00 	movq   $0x0,(%rax)
+  804d45:	eb e7                	jmp    804d2e <dcache_forget_dir+0x13>
+    dcache_gen++;
+  804d47:	48 b8 10 d0 80 00 00 	movabs $0x80d010,%rax
+  804d4e:	00 00 00 
+  804d51:	83 00 01             	addl   $0x1,(%rax)
+}
+  804d54:	c3                   	ret
+
+0000000000804d55 <dcache_path_lookup>:
+/* Look path up. Returns true if the cache knows the answer, then
+ * *pdir is the directory of the file and *pf is the file itself
+ * or NULL if there is no such file in *pdir. In the latter case
+ * the last component of path is copied to lastelem, if not NULL */
+bool
+dcache_path_lookup(const char *path, struct File **pdir, struct File **pf, char *lastelem) {
+  804d55:	55                   	push   %rbp
+  804d56:	48 89 e5             	mov    %rsp,%rbp
+  804d59:	41 57                	push   %r15
+  804d5b:	41 56                	push   %r14
+  804d5d:	41 55                	push   %r13
+  804d5f:	41 54                	push   %r12
+  804d61:	53                   	push   %rbx
+  804d62:	48 83 ec 18          	sub    $0x18,%rsp
+  804d66:	49 89 fc             	mov    %rdi,%r12
+  804d69:	49 89 f7             	mov    %rsi,%r15
+  804d6c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  804d70:	49 89 ce             	mov    %rcx,%r14
+    while (*str)
+  804d73:	0f b6 07             	movzbl (%rdi),%eax
+  804d76:	84 c0                	test   %al,%al
+  804d78:	74 5e                	je     804dd8 <dcache_path_lookup+0x83>
+  804d7a:	48 89 fa             	mov    %rdi,%rdx
+    uint32_t hash = 2166136261U ^ seed;
+  804d7d:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+        hash = (hash ^ (uint8_t)*str++) * 16777619U;
+  804d82:	48 83 c2 01          	add    $0x1,%rdx
+  804d86:	0f b6 c0             	movzbl %al,%eax
+  804d89:	31 c3                	xor    %eax,%ebx
+  804d8b:	69 db 93 01 00 01    	imul   $0x1000193,%ebx,%ebx
+    while (*str)
+  804d91:	0f b6 02             	movzbl (%rdx),%eax
+  804d94:	84 c0                	test   %al,%al
+  804d96:	75 ea                	jne    804d82 <dcache_path_lookup+0x2d>
+    struct dcache_path *dp = &dcache_paths[dcache_hash(path, 0) % DCACHE_PATHS];
+  804d98:	83 e3 7f             	and    $0x7f,%ebx
+    if (dp->dp_gen != dcache_gen || strcmp(dp->dp_path, path)) return 0;
+  804d9b:	89 d8                	mov    %ebx,%eax
+  804d9d:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  804da1:	48 c1 e0 05          	shl    $0x5,%rax
+  804da5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  804dab:	48 b9 e0 c1 84 00 00 	movabs $0x84c1e0,%rcx
+  804db2:	00 00 00 
+  804db5:	48 ba 10 d0 80 00 00 	movabs $0x80d010,%rdx
+  804dbc:	00 00 00 
+  804dbf:	8b 32                	mov    (%rdx),%esi
+  804dc1:	39 34 01             	cmp    %esi,(%rcx,%rax,1)
+  804dc4:	74 19                	je     804ddf <dcache_path_lookup+0x8a>
+        size_t len = strfind(last, '/') - last;
+        memmove(lastelem, last, len);
+        lastelem[len] = '\0';
+    }
+    return 1;
+}
+  804dc6:	44 89 e8             	mov    %r13d,%eax
+  804dc9:	48 83 c4 18          	add    $0x18,%rsp
+  804dcd:	5b                   	pop    %rbx
+  804dce:	41 5c                	pop    %r12
+  804dd0:	41 5d                	pop    %r13
+  804dd2:	41 5e                	pop    %r14
+  804dd4:	41 5f                	pop    %r15
+  804dd6:	5d                   	pop    %rbp
+  804dd7:	c3                   	ret
+    uint32_t hash = 2166136261U ^ seed;
+  804dd8:	bb c5 9d 1c 81       	mov    $0x811c9dc5,%ebx
+  804ddd:	eb b9                	jmp    804d98 <dcache_path_lookup+0x43>
+    if (dp->dp_gen != dcache_gen || strcmp(dp->dp_path, path)) return 0;
+  804ddf:	89 d8                	mov    %ebx,%eax
+  804de1:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  804de5:	48 c1 e0 05          	shl    $0x5,%rax
+  804de9:	48 8d 7c 01 1a       	lea    0x1a(%rcx,%rax,1),%rdi
+  804dee:	4c 89 e6             	mov    %r12,%rsi
+  804df1:	48 b8 9a 7e 80 00 00 	movabs $0x807e9a,%rax
+  804df8:	00 00 00 
+  804dfb:	ff d0                	call   *%rax
+  804dfd:	85 c0                	test   %eax,%eax
+  804dff:	75 c5                	jne    804dc6 <dcache_path_lookup+0x71>
+    *pdir = dp->dp_dir;
+  804e01:	48 be e0 c1 84 00 00 	movabs $0x84c1e0,%rsi
+  804e08:	00 00 00 
+  804e0b:	89 da                	mov    %ebx,%edx
+  804e0d:	48 8d 04 95 00 00 00 	lea    0x0(,%rdx,4),%rax
+  804e14:	00 
+  804e15:	48 8d 0c 10          	lea    (%rax,%rdx,1),%rcx
+  804e19:	48 c1 e1 05          	shl    $0x5,%rcx
+  804e1d:	48 8b 4c 0e 08       	mov    0x8(%rsi,%rcx,1),%rcx
+  804e22:	49 89 0f             	mov    %rcx,(%r15)
+    *pf = dp->dp_file;
+  804e25:	48 01 d0             	add    %rdx,%rax
+  804e28:	48 c1 e0 05          	shl    $0x5,%rax
+  804e2c:	48 8b 44 06 10       	mov    0x10(%rsi,%rax,1),%rax
+  804e31:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804e35:	48 89 07             	mov    %rax,(%rdi)
+    if (!*pf && lastelem) {
+  804e38:	4d 85 f6             	test   %r14,%r14
+  804e3b:	41 0f 95 c5          	setne  %r13b
+  804e3f:	48 85 c0             	test   %rax,%rax
+  804e42:	0f 94 c0             	sete   %al
+  804e45:	41 20 c5             	and    %al,%r13b
+  804e48:	75 0b                	jne    804e55 <dcache_path_lookup+0x100>
+    return 1;
+  804e4a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+  804e50:	e9 71 ff ff ff       	jmp    804dc6 <dcache_path_lookup+0x71>
+        const char *last = path + dp->dp_last;
+  804e55:	89 db                	mov    %ebx,%ebx
+  804e57:	48 8d 04 9b          	lea    (%rbx,%rbx,4),%rax
+  804e5b:	48 c1 e0 05          	shl    $0x5,%rax
+  804e5f:	0f b7 5c 06 18       	movzwl 0x18(%rsi,%rax,1),%ebx
+  804e64:	4c 01 e3             	add    %r12,%rbx
+        size_t len = strfind(last, '/') - last;
+  804e67:	be 2f 00 00 00       	mov    $0x2f,%esi
+  804e6c:	48 89 df             	mov    %rbx,%rdi
+  804e6f:	48 b8 24 7f 80 00 00 	movabs $0x807f24,%rax
+  804e76:	00 00 00 
+  804e79:	ff d0                	call   *%rax
+  804e7b:	48 29 d8             	sub    %rbx,%rax
+  804e7e:	49 89 c4             	mov    %rax,%r12
+        memmove(lastelem, last, len);
+  804e81:	48 89 c2             	mov    %rax,%rdx
+  804e84:	48 89 de             	mov    %rbx,%rsi
+  804e87:	4c 89 f7             	mov    %r14,%rdi
+  804e8a:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  804e91:	00 00 00 
+  804e94:	ff d0                	call   *%rax
+        lastelem[len] = '\0';
+  804e96:	43 c6 04 26 00       	movb   $0x0,(%r14,%r12,1)
+  804e9b:	e9 26 ff ff ff       	jmp    804dc6 <dcache_path_lookup+0x71>
+
+0000000000804ea0 <dcache_path_insert>:
+
+/* Remember the result of looking path up, see dcache_path_lookup().
+ * last is the offset of the last component of path */
+void
+dcache_path_insert(const char *path, struct File *dir, struct File *f, size_t last) {
+  804ea0:	55                   	push   %rbp
+  804ea1:	48 89 e5             	mov    %rsp,%rbp
+  804ea4:	41 56                	push   %r14
+  804ea6:	41 55                	push   %r13
+  804ea8:	41 54                	push   %r12
+  804eaa:	53                   	push   %rbx
+  804eab:	48 89 fb             	mov    %rdi,%rbx
+  804eae:	49 89 f6             	mov    %rsi,%r14
+  804eb1:	49 89 d5             	mov    %rdx,%r13
+  804eb4:	49 89 cc             	mov    %rcx,%r12
+    if (strlen(path) >= DCACHE_PATH_LEN) return;
+  804eb7:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  804ebe:	00 00 00 
+  804ec1:	ff d0                	call   *%rax
+  804ec3:	48 83 f8 7f          	cmp    $0x7f,%rax
+  804ec7:	76 09                	jbe    804ed2 <dcache_path_insert+0x32>
+    dp->dp_gen = dcache_gen;
+    dp->dp_dir = dir;
+    dp->dp_file = f;
+    dp->dp_last = last;
+    strcpy(dp->dp_path, path);
+}
+  804ec9:	5b                   	pop    %rbx
+  804eca:	41 5c                	pop    %r12
+  804ecc:	41 5d                	pop    %r13
+  804ece:	41 5e                	pop    %r14
+  804ed0:	5d                   	pop    %rbp
+  804ed1:	c3                   	ret
+    while (*str)
+  804ed2:	0f b6 03             	movzbl (%rbx),%eax
+  804ed5:	84 c0                	test   %al,%al
+  804ed7:	74 6d                	je     804f46 <dcache_path_insert+0xa6>
+  804ed9:	48 89 d9             	mov    %rbx,%rcx
+    uint32_t hash = 2166136261U ^ seed;
+  804edc:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+        hash = (hash ^ (uint8_t)*str++) * 16777619U;
+  804ee1:	48 83 c1 01          	add    $0x1,%rcx
+  804ee5:	0f b6 c0             	movzbl %al,%eax
+  804ee8:	31 c2                	xor    %eax,%edx
+  804eea:	69 d2 93 01 00 01    	imul   $0x1000193,%edx,%edx
+    while (*str)
+  804ef0:	0f b6 01             	movzbl (%rcx),%eax
+  804ef3:	84 c0                	test   %al,%al
+  804ef5:	75 ea                	jne    804ee1 <dcache_path_insert+0x41>
+    dp->dp_gen = dcache_gen;
+  804ef7:	48 be e0 c1 84 00 00 	movabs $0x84c1e0,%rsi
+  804efe:	00 00 00 
+  804f01:	83 e2 7f             	and    $0x7f,%edx
+  804f04:	48 8d 0c 95 00 00 00 	lea    0x0(,%rdx,4),%rcx
+  804f0b:	00 
+  804f0c:	48 8d 3c 11          	lea    (%rcx,%rdx,1),%rdi
+  804f10:	48 c1 e7 05          	shl    $0x5,%rdi
+  804f14:	a1 10 d0 80 00 00 00 	movabs 0x80d010,%eax
+  804f1b:	00 00 
+  804f1d:	89 04 3e             	mov    %eax,(%rsi,%rdi,1)
+    dp->dp_dir = dir;
+  804f20:	4c 89 74 3e 08       	mov    %r14,0x8(%rsi,%rdi,1)
+    dp->dp_file = f;
+  804f25:	4c 89 6c 3e 10       	mov    %r13,0x10(%rsi,%rdi,1)
+    dp->dp_last = last;
+  804f2a:	66 44 89 64 3e 18    	mov    %r12w,0x18(%rsi,%rdi,1)
+    strcpy(dp->dp_path, path);
+  804f30:	48 8d 7c 3e 1a       	lea    0x1a(%rsi,%rdi,1),%rdi
+  804f35:	48 89 de             	mov    %rbx,%rsi
+  804f38:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  804f3f:	00 00 00 
+  804f42:	ff d0                	call   *%rax
+  804f44:	eb 83                	jmp    804ec9 <dcache_path_insert+0x29>
+    uint32_t hash = 2166136261U ^ seed;
+  804f46:	ba c5 9d 1c 81       	mov    $0x811c9dc5,%edx
+  804f4b:	eb aa                	jmp    804ef7 <dcache_path_insert+0x57>
+
+0000000000804f4d <serve_diskstat>:
+    return 0;
+}
+
+int
+serve_diskstat(envid_t envid, union Fsipc *req) {
+    req->diskstatRet = bc_stat;
+  804f4d:	48 b8 e0 30 82 00 00 	movabs $0x8230e0,%rax
+  804f54:	00 00 00 
+  804f57:	48 8b 10             	mov    (%rax),%rdx
+  804f5a:	48 89 16             	mov    %rdx,(%rsi)
+  804f5d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f61:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  804f65:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f69:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  804f6d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804f71:	48 89 46 18          	mov    %rax,0x18(%rsi)
+    return 0;
+}
+  804f75:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f7a:	c3                   	ret
+
+0000000000804f7b <serve_cachestat>:
+
+int
+serve_cachestat(envid_t envid, union Fsipc *req) {
+    req->cachestatRet = bc_cache_stat;
+  804f7b:	48 b8 a0 30 82 00 00 	movabs $0x8230a0,%rax
+  804f82:	00 00 00 
+  804f85:	48 8b 10             	mov    (%rax),%rdx
+  804f88:	48 89 16             	mov    %rdx,(%rsi)
+  804f8b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804f8f:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  804f93:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804f97:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  804f9b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  804f9f:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  804fa3:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  804fa7:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  804fab:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804faf:	48 89 46 28          	mov    %rax,0x28(%rsi)
+    return 0;
+}
+  804fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804fb8:	c3                   	ret
+
+0000000000804fb9 <serve_invalidate>:
+serve_invalidate(struct File *f) {
+  804fb9:	55                   	push   %rbp
+  804fba:	48 89 e5             	mov    %rsp,%rbp
+  804fbd:	41 57                	push   %r15
+  804fbf:	41 56                	push   %r14
+  804fc1:	41 55                	push   %r13
+  804fc3:	41 54                	push   %r12
+  804fc5:	53                   	push   %rbx
+  804fc6:	48 83 ec 08          	sub    $0x8,%rsp
+  804fca:	49 89 fd             	mov    %rdi,%r13
+    for (size_t i = 0; i < MAXOPEN; i++)
+  804fcd:	48 bb b8 d0 80 00 00 	movabs $0x80d0b8,%rbx
+  804fd4:	00 00 00 
+  804fd7:	4c 8d b3 00 60 00 00 	lea    0x6000(%rbx),%r14
+        if (opentab[i].o_file == f && is_page_present(opentab[i].o_fd))
+  804fde:	49 bf 38 b4 80 00 00 	movabs $0x80b438,%r15
+  804fe5:	00 00 00 
+  804fe8:	eb 09                	jmp    804ff3 <serve_invalidate+0x3a>
+    for (size_t i = 0; i < MAXOPEN; i++)
+  804fea:	48 83 c3 30          	add    $0x30,%rbx
+  804fee:	4c 39 f3             	cmp    %r14,%rbx
+  804ff1:	74 19                	je     80500c <serve_invalidate+0x53>
+        if (opentab[i].o_file == f && is_page_present(opentab[i].o_fd))
+  804ff3:	4c 39 6b f0          	cmp    %r13,-0x10(%rbx)
+  804ff7:	75 f1                	jne    804fea <serve_invalidate+0x31>
+  804ff9:	48 8b 3b             	mov    (%rbx),%rdi
+  804ffc:	41 ff d7             	call   *%r15
+  804fff:	84 c0                	test   %al,%al
+  805001:	74 e7                	je     804fea <serve_invalidate+0x31>
+            opentab[i].o_fd->fd_file.gen++;
+  805003:	48 8b 03             	mov    (%rbx),%rax
+  805006:	83 40 10 01          	addl   $0x1,0x10(%rax)
+  80500a:	eb de                	jmp    804fea <serve_invalidate+0x31>
+}
+  80500c:	48 83 c4 08          	add    $0x8,%rsp
+  805010:	5b                   	pop    %rbx
+  805011:	41 5c                	pop    %r12
+  805013:	41 5d                	pop    %r13
+  805015:	41 5e                	pop    %r14
+  805017:	41 5f                	pop    %r15
+  805019:	5d                   	pop    %rbp
+  80501a:	c3                   	ret
+
+000000000080501b <serve_readahead>:
+serve_readahead(struct OpenFile *o, off_t offset, size_t n) {
+  80501b:	55                   	push   %rbp
+  80501c:	48 89 e5             	mov    %rsp,%rbp
+  80501f:	53                   	push   %rbx
+  805020:	48 83 ec 08          	sub    $0x8,%rsp
+  805024:	48 89 fb             	mov    %rdi,%rbx
+    if (offset != o->o_ra_pos) {
+  805027:	39 77 20             	cmp    %esi,0x20(%rdi)
+  80502a:	0f 84 8f 00 00 00    	je     8050bf <serve_readahead+0xa4>
+        o->o_ra_window = 0;
+  805030:	c7 47 24 00 00 00 00 	movl   $0x0,0x24(%rdi)
+        o->o_ra_next = 0;
+  805037:	c7 47 28 00 00 00 00 	movl   $0x0,0x28(%rdi)
+    o->o_ra_pos = offset + n;
+  80503e:	01 d6                	add    %edx,%esi
+  805040:	89 73 20             	mov    %esi,0x20(%rbx)
+    if (!o->o_ra_window) return;
+  805043:	44 8b 4b 24          	mov    0x24(%rbx),%r9d
+  805047:	45 85 c9             	test   %r9d,%r9d
+  80504a:	74 6d                	je     8050b9 <serve_readahead+0x9e>
+    blockno_t nblocks = CEILDIV(o->o_file->f_size, BLKSIZE);
+  80504c:	4c 8b 43 08          	mov    0x8(%rbx),%r8
+  805050:	49 63 b8 80 00 00 00 	movslq 0x80(%r8),%rdi
+  805057:	48 81 c7 ff 0f 00 00 	add    $0xfff,%rdi
+  80505e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    blockno_t first = MAX(o->o_ra_pos / BLKSIZE, o->o_ra_next);
+  805062:	8d 86 ff 0f 00 00    	lea    0xfff(%rsi),%eax
+  805068:	85 f6                	test   %esi,%esi
+  80506a:	0f 49 c6             	cmovns %esi,%eax
+  80506d:	c1 f8 0c             	sar    $0xc,%eax
+  805070:	48 98                	cltq
+  805072:	8b 4b 28             	mov    0x28(%rbx),%ecx
+  805075:	48 39 c1             	cmp    %rax,%rcx
+  805078:	48 0f 4c c8          	cmovl  %rax,%rcx
+  80507c:	41 89 ca             	mov    %ecx,%r10d
+    blockno_t end = MIN(o->o_ra_pos / BLKSIZE + o->o_ra_window, nblocks);
+  80507f:	89 fa                	mov    %edi,%edx
+  805081:	44 89 ce             	mov    %r9d,%esi
+  805084:	48 01 f0             	add    %rsi,%rax
+  805087:	48 39 c2             	cmp    %rax,%rdx
+  80508a:	48 0f 4e c2          	cmovle %rdx,%rax
+  80508e:	89 c2                	mov    %eax,%edx
+    if (first >= end || (end - first < o->o_ra_window / 2 && end < nblocks)) return;
+  805090:	39 c1                	cmp    %eax,%ecx
+  805092:	73 25                	jae    8050b9 <serve_readahead+0x9e>
+  805094:	89 c6                	mov    %eax,%esi
+  805096:	29 ce                	sub    %ecx,%esi
+  805098:	41 d1 e9             	shr    %r9d
+  80509b:	44 39 ce             	cmp    %r9d,%esi
+  80509e:	73 04                	jae    8050a4 <serve_readahead+0x89>
+  8050a0:	39 f8                	cmp    %edi,%eax
+  8050a2:	72 15                	jb     8050b9 <serve_readahead+0x9e>
+    o->o_ra_next = file_readahead(o->o_file, first, end);
+  8050a4:	44 89 d6             	mov    %r10d,%esi
+  8050a7:	4c 89 c7             	mov    %r8,%rdi
+  8050aa:	48 b8 bc 3e 80 00 00 	movabs $0x803ebc,%rax
+  8050b1:	00 00 00 
+  8050b4:	ff d0                	call   *%rax
+  8050b6:	89 43 28             	mov    %eax,0x28(%rbx)
+}
+  8050b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8050bd:	c9                   	leave
+  8050be:	c3                   	ret
+        o->o_ra_window = MIN(MAX(o->o_ra_window * 2, RA_MIN_WINDOW), RA_MAX_WINDOW);
+  8050bf:	d1 67 24             	shll   0x24(%rdi)
+  8050c2:	8b 47 24             	mov    0x24(%rdi),%eax
+  8050c5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8050ca:	39 c8                	cmp    %ecx,%eax
+  8050cc:	0f 42 c1             	cmovb  %ecx,%eax
+  8050cf:	b9 40 00 00 00       	mov    $0x40,%ecx
+  8050d4:	39 c8                	cmp    %ecx,%eax
+  8050d6:	0f 47 c1             	cmova  %ecx,%eax
+  8050d9:	89 47 24             	mov    %eax,0x24(%rdi)
+  8050dc:	e9 5d ff ff ff       	jmp    80503e <serve_readahead+0x23>
+
+00000000008050e1 <serve_block_run>:
+serve_block_run(struct File *f, blockno_t filebno, blockno_t n, blockno_t *start) {
+  8050e1:	55                   	push   %rbp
+  8050e2:	48 89 e5             	mov    %rsp,%rbp
+  8050e5:	41 57                	push   %r15
+  8050e7:	41 56                	push   %r14
+  8050e9:	41 55                	push   %r13
+  8050eb:	41 54                	push   %r12
+  8050ed:	53                   	push   %rbx
+  8050ee:	48 83 ec 28          	sub    $0x28,%rsp
+  8050f2:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8050f6:	41 89 f5             	mov    %esi,%r13d
+  8050f9:	41 89 d4             	mov    %edx,%r12d
+  8050fc:	49 89 ce             	mov    %rcx,%r14
+    int res = file_block_map(f, filebno, start);
+  8050ff:	48 89 ca             	mov    %rcx,%rdx
+  805102:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  805109:	00 00 00 
+  80510c:	ff d0                	call   *%rax
+    if (res <= 0) return res;
+  80510e:	85 c0                	test   %eax,%eax
+  805110:	7e 49                	jle    80515b <serve_block_run+0x7a>
+    blockno_t run = MIN(res, n);
+  805112:	44 39 e0             	cmp    %r12d,%eax
+  805115:	41 0f 47 c4          	cmova  %r12d,%eax
+  805119:	89 c3                	mov    %eax,%ebx
+    while (run < n && (res = file_block_map(f, filebno + run, &next)) > 0 && next == *start + run)
+  80511b:	49 bf 52 34 80 00 00 	movabs $0x803452,%r15
+  805122:	00 00 00 
+  805125:	44 39 e0             	cmp    %r12d,%eax
+  805128:	73 2f                	jae    805159 <serve_block_run+0x78>
+  80512a:	41 8d 74 1d 00       	lea    0x0(%r13,%rbx,1),%esi
+  80512f:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  805133:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  805137:	41 ff d7             	call   *%r15
+  80513a:	85 c0                	test   %eax,%eax
+  80513c:	7e 1b                	jle    805159 <serve_block_run+0x78>
+  80513e:	89 da                	mov    %ebx,%edx
+  805140:	41 03 16             	add    (%r14),%edx
+  805143:	3b 55 cc             	cmp    -0x34(%rbp),%edx
+  805146:	75 11                	jne    805159 <serve_block_run+0x78>
+        run += MIN(res, n - run);
+  805148:	44 89 e2             	mov    %r12d,%edx
+  80514b:	29 da                	sub    %ebx,%edx
+  80514d:	39 c2                	cmp    %eax,%edx
+  80514f:	0f 47 d0             	cmova  %eax,%edx
+  805152:	01 d3                	add    %edx,%ebx
+    while (run < n && (res = file_block_map(f, filebno + run, &next)) > 0 && next == *start + run)
+  805154:	44 39 e3             	cmp    %r12d,%ebx
+  805157:	72 d1                	jb     80512a <serve_block_run+0x49>
+    return run;
+  805159:	89 d8                	mov    %ebx,%eax
+}
+  80515b:	48 83 c4 28          	add    $0x28,%rsp
+  80515f:	5b                   	pop    %rbx
+  805160:	41 5c                	pop    %r12
+  805162:	41 5d                	pop    %r13
+  805164:	41 5e                	pop    %r14
+  805166:	41 5f                	pop    %r15
+  805168:	5d                   	pop    %rbp
+  805169:	c3                   	ret
+
+000000000080516a <serve_load_run>:
+serve_load_run(struct File *f, off_t offset, blockno_t n, blockno_t start) {
+  80516a:	55                   	push   %rbp
+  80516b:	48 89 e5             	mov    %rsp,%rbp
+  80516e:	41 56                	push   %r14
+  805170:	41 55                	push   %r13
+  805172:	41 54                	push   %r12
+  805174:	53                   	push   %rbx
+  805175:	48 83 ec 10          	sub    $0x10,%rsp
+  805179:	49 89 fc             	mov    %rdi,%r12
+  80517c:	89 f3                	mov    %esi,%ebx
+  80517e:	41 89 d6             	mov    %edx,%r14d
+  805181:	41 89 cd             	mov    %ecx,%r13d
+    bc_load(start, n);
+  805184:	89 d6                	mov    %edx,%esi
+  805186:	89 cf                	mov    %ecx,%edi
+  805188:	48 b8 f6 1d 80 00 00 	movabs $0x801df6,%rax
+  80518f:	00 00 00 
+  805192:	ff d0                	call   *%rax
+    if (offset >= f->f_size) return 0;
+  805194:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80519b:	00 
+  80519c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051a1:	39 d8                	cmp    %ebx,%eax
+  8051a3:	7e 22                	jle    8051c7 <serve_load_run+0x5d>
+    n = MIN(n, (f->f_size - offset) / BLKSIZE);
+  8051a5:	29 d8                	sub    %ebx,%eax
+  8051a7:	89 c2                	mov    %eax,%edx
+  8051a9:	8d 80 ff 0f 00 00    	lea    0xfff(%rax),%eax
+  8051af:	0f 49 c2             	cmovns %edx,%eax
+  8051b2:	c1 f8 0c             	sar    $0xc,%eax
+  8051b5:	48 98                	cltq
+  8051b7:	45 89 f6             	mov    %r14d,%r14d
+  8051ba:	4c 39 f0             	cmp    %r14,%rax
+  8051bd:	49 0f 4f c6          	cmovg  %r14,%rax
+  8051c1:	89 c2                	mov    %eax,%edx
+    int res = n ? serve_block_run(f, offset / BLKSIZE, n, &now) : 0;
+  8051c3:	85 c0                	test   %eax,%eax
+  8051c5:	75 0f                	jne    8051d6 <serve_load_run+0x6c>
+}
+  8051c7:	89 d0                	mov    %edx,%eax
+  8051c9:	48 83 c4 10          	add    $0x10,%rsp
+  8051cd:	5b                   	pop    %rbx
+  8051ce:	41 5c                	pop    %r12
+  8051d0:	41 5d                	pop    %r13
+  8051d2:	41 5e                	pop    %r14
+  8051d4:	5d                   	pop    %rbp
+  8051d5:	c3                   	ret
+    int res = n ? serve_block_run(f, offset / BLKSIZE, n, &now) : 0;
+  8051d6:	8d b3 ff 0f 00 00    	lea    0xfff(%rbx),%esi
+  8051dc:	85 db                	test   %ebx,%ebx
+  8051de:	0f 49 f3             	cmovns %ebx,%esi
+  8051e1:	c1 fe 0c             	sar    $0xc,%esi
+  8051e4:	48 8d 4d dc          	lea    -0x24(%rbp),%rcx
+  8051e8:	4c 89 e7             	mov    %r12,%rdi
+  8051eb:	48 b8 e1 50 80 00 00 	movabs $0x8050e1,%rax
+  8051f2:	00 00 00 
+  8051f5:	ff d0                	call   *%rax
+    return res > 0 && now == start ? res : 0;
+  8051f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8051fc:	85 c0                	test   %eax,%eax
+  8051fe:	7e c7                	jle    8051c7 <serve_load_run+0x5d>
+  805200:	44 39 6d dc          	cmp    %r13d,-0x24(%rbp)
+  805204:	0f 44 d0             	cmove  %eax,%edx
+  805207:	eb be                	jmp    8051c7 <serve_load_run+0x5d>
+
+0000000000805209 <serve_remove>:
+serve_remove(envid_t envid, union Fsipc *ipc) {
+  805209:	55                   	push   %rbp
+  80520a:	48 89 e5             	mov    %rsp,%rbp
+  80520d:	41 56                	push   %r14
+  80520f:	41 55                	push   %r13
+  805211:	41 54                	push   %r12
+  805213:	53                   	push   %rbx
+  805214:	48 81 ec 10 04 00 00 	sub    $0x410,%rsp
+    memmove(path, req->req_path, MAXPATHLEN);
+  80521b:	ba 00 04 00 00       	mov    $0x400,%edx
+  805220:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805227:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  80522e:	00 00 00 
+  805231:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  805233:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if (file_open(path, &f) == 0 && serve_file_busy(f)) return -E_BUSY;
+  805237:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  80523e:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805245:	48 b8 9d 3e 80 00 00 	movabs $0x803e9d,%rax
+  80524c:	00 00 00 
+  80524f:	ff d0                	call   *%rax
+  805251:	85 c0                	test   %eax,%eax
+  805253:	75 4a                	jne    80529f <serve_remove+0x96>
+  805255:	4c 8b a5 d8 fb ff ff 	mov    -0x428(%rbp),%r12
+    for (size_t i = 0; i < MAXOPEN; i++)
+  80525c:	48 bb a8 d0 80 00 00 	movabs $0x80d0a8,%rbx
+  805263:	00 00 00 
+  805266:	4c 8d ab 00 60 00 00 	lea    0x6000(%rbx),%r13
+        if (opentab[i].o_file == f && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1)
+  80526d:	49 be 1a 83 80 00 00 	movabs $0x80831a,%r14
+  805274:	00 00 00 
+  805277:	eb 09                	jmp    805282 <serve_remove+0x79>
+    for (size_t i = 0; i < MAXOPEN; i++)
+  805279:	48 83 c3 30          	add    $0x30,%rbx
+  80527d:	4c 39 eb             	cmp    %r13,%rbx
+  805280:	74 1d                	je     80529f <serve_remove+0x96>
+        if (opentab[i].o_file == f && sys_region_refs(opentab[i].o_fd, PAGE_SIZE) > 1)
+  805282:	4c 3b 23             	cmp    (%rbx),%r12
+  805285:	75 f2                	jne    805279 <serve_remove+0x70>
+  805287:	48 8b 7b 10          	mov    0x10(%rbx),%rdi
+  80528b:	be 00 10 00 00       	mov    $0x1000,%esi
+  805290:	41 ff d6             	call   *%r14
+  805293:	83 f8 01             	cmp    $0x1,%eax
+  805296:	7e e1                	jle    805279 <serve_remove+0x70>
+    if (file_open(path, &f) == 0 && serve_file_busy(f)) return -E_BUSY;
+  805298:	b8 ea ff ff ff       	mov    $0xffffffea,%eax
+  80529d:	eb 13                	jmp    8052b2 <serve_remove+0xa9>
+    return file_remove(path);
+  80529f:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  8052a6:	48 b8 e8 48 80 00 00 	movabs $0x8048e8,%rax
+  8052ad:	00 00 00 
+  8052b0:	ff d0                	call   *%rax
+}
+  8052b2:	48 81 c4 10 04 00 00 	add    $0x410,%rsp
+  8052b9:	5b                   	pop    %rbx
+  8052ba:	41 5c                	pop    %r12
+  8052bc:	41 5d                	pop    %r13
+  8052be:	41 5e                	pop    %r14
+  8052c0:	5d                   	pop    %rbp
+  8052c1:	c3                   	ret
+
+00000000008052c2 <serve_sync>:
+serve_sync(envid_t envid, union Fsipc *req) {
+  8052c2:	55                   	push   %rbp
+  8052c3:	48 89 e5             	mov    %rsp,%rbp
+    fs_sync();
+  8052c6:	48 b8 c1 4b 80 00 00 	movabs $0x804bc1,%rax
+  8052cd:	00 00 00 
+  8052d0:	ff d0                	call   *%rax
+}
+  8052d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d7:	5d                   	pop    %rbp
+  8052d8:	c3                   	ret
+
+00000000008052d9 <serve_run>:
+    }
+}
+
+/* Run w until it has replied or has to wait for the disk */
+static void
+serve_run(struct serve_worker *w) {
+  8052d9:	55                   	push   %rbp
+  8052da:	48 89 e5             	mov    %rsp,%rbp
+    fsreq = w->w_req;
+  8052dd:	48 8b 47 08          	mov    0x8(%rdi),%rax
+  8052e1:	48 a3 f0 31 86 00 00 	movabs %rax,0x8631f0
+  8052e8:	00 00 00 
+    fsdata = (uint8_t *)w->w_req + PAGE_SIZE;
+  8052eb:	48 05 00 10 00 00    	add    $0x1000,%rax
+  8052f1:	48 a3 e8 31 86 00 00 	movabs %rax,0x8631e8
+  8052f8:	00 00 00 
+    fsdata_size = w->w_size > PAGE_SIZE ? w->w_size - PAGE_SIZE : 0;
+  8052fb:	48 8b 47 20          	mov    0x20(%rdi),%rax
+  8052ff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805304:	48 39 d0             	cmp    %rdx,%rax
+  805307:	48 0f 42 c2          	cmovb  %rdx,%rax
+  80530b:	48 2d 00 10 00 00    	sub    $0x1000,%rax
+  805311:	48 a3 e0 31 86 00 00 	movabs %rax,0x8631e0
+  805318:	00 00 00 
+    thread_run(w->w_thread);
+  80531b:	48 8b 3f             	mov    (%rdi),%rdi
+  80531e:	48 b8 c8 68 80 00 00 	movabs $0x8068c8,%rax
+  805325:	00 00 00 
+  805328:	ff d0                	call   *%rax
+}
+  80532a:	5d                   	pop    %rbp
+  80532b:	c3                   	ret
+
+000000000080532c <serve_init>:
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  80532c:	48 ba a0 d0 80 00 00 	movabs $0x80d0a0,%rdx
+  805333:	00 00 00 
+  805336:	b9 00 00 00 00       	mov    $0x0,%ecx
+    uintptr_t va = FILE_BASE;
+  80533b:	48 b8 00 00 00 00 02 	movabs $0x200000000,%rax
+  805342:	00 00 00 
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  805345:	48 be 00 00 20 00 02 	movabs $0x200200000,%rsi
+  80534c:	00 00 00 
+        opentab[i].o_fileid = i;
+  80534f:	89 0a                	mov    %ecx,(%rdx)
+        opentab[i].o_fd = (struct Fd *)va;
+  805351:	48 89 42 18          	mov    %rax,0x18(%rdx)
+        va += PAGE_SIZE;
+  805355:	48 05 00 10 00 00    	add    $0x1000,%rax
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  80535b:	48 83 c1 01          	add    $0x1,%rcx
+  80535f:	48 83 c2 30          	add    $0x30,%rdx
+  805363:	48 39 f0             	cmp    %rsi,%rax
+  805366:	75 e7                	jne    80534f <serve_init+0x23>
+}
+  805368:	c3                   	ret
+
+0000000000805369 <openfile_alloc>:
+openfile_alloc(struct OpenFile **o) {
+  805369:	55                   	push   %rbp
+  80536a:	48 89 e5             	mov    %rsp,%rbp
+  80536d:	41 56                	push   %r14
+  80536f:	41 55                	push   %r13
+  805371:	41 54                	push   %r12
+  805373:	53                   	push   %rbx
+  805374:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  805377:	49 bd b8 d0 80 00 00 	movabs $0x80d0b8,%r13
+  80537e:	00 00 00 
+  805381:	bb 00 00 00 00       	mov    $0x0,%ebx
+        switch (sys_region_refs(opentab[i].o_fd, PAGE_SIZE)) {
+  805386:	49 be 1a 83 80 00 00 	movabs $0x80831a,%r14
+  80538d:	00 00 00 
+  805390:	49 8b 7d 00          	mov    0x0(%r13),%rdi
+  805394:	be 00 10 00 00       	mov    $0x1000,%esi
+  805399:	41 ff d6             	call   *%r14
+  80539c:	85 c0                	test   %eax,%eax
+  80539e:	74 20                	je     8053c0 <openfile_alloc+0x57>
+  8053a0:	83 f8 01             	cmp    $0x1,%eax
+  8053a3:	74 51                	je     8053f6 <openfile_alloc+0x8d>
+    for (size_t i = 0; i < MAXOPEN; i++) {
+  8053a5:	48 83 c3 01          	add    $0x1,%rbx
+  8053a9:	49 83 c5 30          	add    $0x30,%r13
+  8053ad:	48 81 fb 00 02 00 00 	cmp    $0x200,%rbx
+  8053b4:	75 da                	jne    805390 <openfile_alloc+0x27>
+    return -E_MAX_OPEN;
+  8053b6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+  8053bb:	e9 81 00 00 00       	jmp    805441 <openfile_alloc+0xd8>
+            int res = sys_alloc_region(0, opentab[i].o_fd, PAGE_SIZE, PROT_RW);
+  8053c0:	48 8d 04 5b          	lea    (%rbx,%rbx,2),%rax
+  8053c4:	48 c1 e0 04          	shl    $0x4,%rax
+  8053c8:	48 ba a0 d0 80 00 00 	movabs $0x80d0a0,%rdx
+  8053cf:	00 00 00 
+  8053d2:	48 8b 74 02 18       	mov    0x18(%rdx,%rax,1),%rsi
+  8053d7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8053dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8053e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8053e6:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  8053ed:	00 00 00 
+  8053f0:	ff d0                	call   *%rax
+            if (res < 0) return res;
+  8053f2:	85 c0                	test   %eax,%eax
+  8053f4:	78 4b                	js     805441 <openfile_alloc+0xd8>
+            opentab[i].o_fileid += MAXOPEN;
+  8053f6:	48 b9 a0 d0 80 00 00 	movabs $0x80d0a0,%rcx
+  8053fd:	00 00 00 
+  805400:	48 8d 14 1b          	lea    (%rbx,%rbx,1),%rdx
+  805404:	48 8d 04 1a          	lea    (%rdx,%rbx,1),%rax
+  805408:	48 c1 e0 04          	shl    $0x4,%rax
+  80540c:	48 01 c8             	add    %rcx,%rax
+  80540f:	81 00 00 02 00 00    	addl   $0x200,(%rax)
+            *o = &opentab[i];
+  805415:	49 89 04 24          	mov    %rax,(%r12)
+            memset(opentab[i].o_fd, 0, PAGE_SIZE);
+  805419:	48 01 da             	add    %rbx,%rdx
+  80541c:	48 c1 e2 04          	shl    $0x4,%rdx
+  805420:	48 8b 7c 11 18       	mov    0x18(%rcx,%rdx,1),%rdi
+  805425:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80542a:	be 00 00 00 00       	mov    $0x0,%esi
+  80542f:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  805436:	00 00 00 
+  805439:	ff d0                	call   *%rax
+            return (*o)->o_fileid;
+  80543b:	49 8b 04 24          	mov    (%r12),%rax
+  80543f:	8b 00                	mov    (%rax),%eax
+}
+  805441:	5b                   	pop    %rbx
+  805442:	41 5c                	pop    %r12
+  805444:	41 5d                	pop    %r13
+  805446:	41 5e                	pop    %r14
+  805448:	5d                   	pop    %rbp
+  805449:	c3                   	ret
+
+000000000080544a <openfile_lookup>:
+openfile_lookup(envid_t envid, uint32_t fileid, struct OpenFile **po) {
+  80544a:	55                   	push   %rbp
+  80544b:	48 89 e5             	mov    %rsp,%rbp
+  80544e:	41 56                	push   %r14
+  805450:	41 55                	push   %r13
+  805452:	41 54                	push   %r12
+  805454:	53                   	push   %rbx
+  805455:	41 89 f5             	mov    %esi,%r13d
+  805458:	49 89 d6             	mov    %rdx,%r14
+    o = &opentab[fileid % MAXOPEN];
+  80545b:	41 89 f4             	mov    %esi,%r12d
+  80545e:	41 81 e4 ff 01 00 00 	and    $0x1ff,%r12d
+  805465:	44 89 e2             	mov    %r12d,%edx
+  805468:	48 8d 04 12          	lea    (%rdx,%rdx,1),%rax
+  80546c:	48 8d 1c 10          	lea    (%rax,%rdx,1),%rbx
+  805470:	48 c1 e3 04          	shl    $0x4,%rbx
+  805474:	48 b9 a0 d0 80 00 00 	movabs $0x80d0a0,%rcx
+  80547b:	00 00 00 
+  80547e:	48 01 cb             	add    %rcx,%rbx
+    if (sys_region_refs(o->o_fd, PAGE_SIZE) <= 1 || o->o_fileid != fileid)
+  805481:	48 01 d0             	add    %rdx,%rax
+  805484:	48 c1 e0 04          	shl    $0x4,%rax
+  805488:	48 8b 7c 01 18       	mov    0x18(%rcx,%rax,1),%rdi
+  80548d:	be 00 10 00 00       	mov    $0x1000,%esi
+  805492:	48 b8 1a 83 80 00 00 	movabs $0x80831a,%rax
+  805499:	00 00 00 
+  80549c:	ff d0                	call   *%rax
+  80549e:	83 f8 01             	cmp    $0x1,%eax
+  8054a1:	7e 2c                	jle    8054cf <openfile_lookup+0x85>
+  8054a3:	45 89 e4             	mov    %r12d,%r12d
+  8054a6:	4b 8d 04 64          	lea    (%r12,%r12,2),%rax
+  8054aa:	48 c1 e0 04          	shl    $0x4,%rax
+  8054ae:	48 ba a0 d0 80 00 00 	movabs $0x80d0a0,%rdx
+  8054b5:	00 00 00 
+  8054b8:	44 39 2c 02          	cmp    %r13d,(%rdx,%rax,1)
+  8054bc:	75 18                	jne    8054d6 <openfile_lookup+0x8c>
+    *po = o;
+  8054be:	49 89 1e             	mov    %rbx,(%r14)
+    return 0;
+  8054c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8054c6:	5b                   	pop    %rbx
+  8054c7:	41 5c                	pop    %r12
+  8054c9:	41 5d                	pop    %r13
+  8054cb:	41 5e                	pop    %r14
+  8054cd:	5d                   	pop    %rbp
+  8054ce:	c3                   	ret
+        return -E_INVAL;
+  8054cf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8054d4:	eb f0                	jmp    8054c6 <openfile_lookup+0x7c>
+  8054d6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8054db:	eb e9                	jmp    8054c6 <openfile_lookup+0x7c>
+
+00000000008054dd <serve_set_size>:
+serve_set_size(envid_t envid, union Fsipc *ipc) {
+  8054dd:	55                   	push   %rbp
+  8054de:	48 89 e5             	mov    %rsp,%rbp
+  8054e1:	41 54                	push   %r12
+  8054e3:	53                   	push   %rbx
+  8054e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8054e8:	48 89 f3             	mov    %rsi,%rbx
+    if ((r = openfile_lookup(envid, req->req_fileid, &o)) < 0)
+  8054eb:	8b 36                	mov    (%rsi),%esi
+  8054ed:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8054f1:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  8054f8:	00 00 00 
+  8054fb:	ff d0                	call   *%rax
+  8054fd:	85 c0                	test   %eax,%eax
+  8054ff:	78 32                	js     805533 <serve_set_size+0x56>
+    if ((r = file_set_size(o->o_file, req->req_size)) < 0) return r;
+  805501:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  805505:	8b 73 04             	mov    0x4(%rbx),%esi
+  805508:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  80550d:	48 b8 67 41 80 00 00 	movabs $0x804167,%rax
+  805514:	00 00 00 
+  805517:	ff d0                	call   *%rax
+  805519:	85 c0                	test   %eax,%eax
+  80551b:	78 16                	js     805533 <serve_set_size+0x56>
+    serve_invalidate(o->o_file);
+  80551d:	49 8b 7c 24 08       	mov    0x8(%r12),%rdi
+  805522:	48 b8 b9 4f 80 00 00 	movabs $0x804fb9,%rax
+  805529:	00 00 00 
+  80552c:	ff d0                	call   *%rax
+    return 0;
+  80552e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805533:	48 83 c4 10          	add    $0x10,%rsp
+  805537:	5b                   	pop    %rbx
+  805538:	41 5c                	pop    %r12
+  80553a:	5d                   	pop    %rbp
+  80553b:	c3                   	ret
+
+000000000080553c <serve_read>:
+serve_read(envid_t envid, union Fsipc *ipc) {
+  80553c:	55                   	push   %rbp
+  80553d:	48 89 e5             	mov    %rsp,%rbp
+  805540:	41 56                	push   %r14
+  805542:	41 55                	push   %r13
+  805544:	41 54                	push   %r12
+  805546:	53                   	push   %rbx
+  805547:	48 83 ec 10          	sub    $0x10,%rsp
+  80554b:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  80554e:	8b 36                	mov    (%rsi),%esi
+  805550:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805554:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  80555b:	00 00 00 
+  80555e:	ff d0                	call   *%rax
+    if (res < 0) {
+  805560:	85 c0                	test   %eax,%eax
+  805562:	78 61                	js     8055c5 <serve_read+0x89>
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+  805564:	44 8b 6b 04          	mov    0x4(%rbx),%r13d
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  805568:	45 89 ec             	mov    %r13d,%r12d
+  80556b:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80556f:	74 61                	je     8055d2 <serve_read+0x96>
+    if (offset < 0) return -E_INVAL;
+  805571:	45 85 e4             	test   %r12d,%r12d
+  805574:	0f 88 8a 00 00 00    	js     805604 <serve_read+0xc8>
+    ssize_t read = file_read(o->o_file, fsdata, MIN(req->req_n, fsdata_size), offset);
+  80557a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80557e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805582:	48 a1 e0 31 86 00 00 	movabs 0x8631e0,%rax
+  805589:	00 00 00 
+  80558c:	48 39 c2             	cmp    %rax,%rdx
+  80558f:	48 0f 47 d0          	cmova  %rax,%rdx
+  805593:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  805597:	44 89 e1             	mov    %r12d,%ecx
+  80559a:	48 b8 e8 31 86 00 00 	movabs $0x8631e8,%rax
+  8055a1:	00 00 00 
+  8055a4:	48 8b 30             	mov    (%rax),%rsi
+  8055a7:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  8055ae:	00 00 00 
+  8055b1:	ff d0                	call   *%rax
+  8055b3:	48 89 c3             	mov    %rax,%rbx
+    if (read < 0) {
+  8055b6:	48 85 c0             	test   %rax,%rax
+  8055b9:	78 0a                	js     8055c5 <serve_read+0x89>
+    if (read) serve_readahead(o, offset, read);
+  8055bb:	75 23                	jne    8055e0 <serve_read+0xa4>
+    if (cur) o->o_fd->fd_offset = offset + read;
+  8055bd:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8055c1:	74 34                	je     8055f7 <serve_read+0xbb>
+    return read;
+  8055c3:	89 d8                	mov    %ebx,%eax
+}
+  8055c5:	48 83 c4 10          	add    $0x10,%rsp
+  8055c9:	5b                   	pop    %rbx
+  8055ca:	41 5c                	pop    %r12
+  8055cc:	41 5d                	pop    %r13
+  8055ce:	41 5e                	pop    %r14
+  8055d0:	5d                   	pop    %rbp
+  8055d1:	c3                   	ret
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  8055d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8055d6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8055da:	44 8b 60 04          	mov    0x4(%rax),%r12d
+  8055de:	eb 91                	jmp    805571 <serve_read+0x35>
+    if (read) serve_readahead(o, offset, read);
+  8055e0:	48 89 c2             	mov    %rax,%rdx
+  8055e3:	44 89 e6             	mov    %r12d,%esi
+  8055e6:	4c 89 f7             	mov    %r14,%rdi
+  8055e9:	48 b8 1b 50 80 00 00 	movabs $0x80501b,%rax
+  8055f0:	00 00 00 
+  8055f3:	ff d0                	call   *%rax
+  8055f5:	eb c6                	jmp    8055bd <serve_read+0x81>
+    if (cur) o->o_fd->fd_offset = offset + read;
+  8055f7:	49 8b 46 18          	mov    0x18(%r14),%rax
+  8055fb:	41 01 dc             	add    %ebx,%r12d
+  8055fe:	44 89 60 04          	mov    %r12d,0x4(%rax)
+  805602:	eb bf                	jmp    8055c3 <serve_read+0x87>
+    if (offset < 0) return -E_INVAL;
+  805604:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805609:	eb ba                	jmp    8055c5 <serve_read+0x89>
+
+000000000080560b <serve_write>:
+serve_write(envid_t envid, union Fsipc *ipc) {
+  80560b:	55                   	push   %rbp
+  80560c:	48 89 e5             	mov    %rsp,%rbp
+  80560f:	41 56                	push   %r14
+  805611:	41 55                	push   %r13
+  805613:	41 54                	push   %r12
+  805615:	53                   	push   %rbx
+  805616:	48 83 ec 10          	sub    $0x10,%rsp
+  80561a:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  80561d:	8b 36                	mov    (%rsi),%esi
+  80561f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  805623:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  80562a:	00 00 00 
+  80562d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80562f:	85 c0                	test   %eax,%eax
+  805631:	78 61                	js     805694 <serve_write+0x89>
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+  805633:	44 8b 6b 04          	mov    0x4(%rbx),%r13d
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  805637:	45 89 ec             	mov    %r13d,%r12d
+  80563a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80563e:	74 61                	je     8056a1 <serve_write+0x96>
+    if (offset < 0) return -E_INVAL;
+  805640:	45 85 e4             	test   %r12d,%r12d
+  805643:	0f 88 85 00 00 00    	js     8056ce <serve_write+0xc3>
+    ssize_t writen = file_write(o->o_file, fsdata, MIN(req->req_n, fsdata_size), offset);
+  805649:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80564d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  805651:	48 a1 e0 31 86 00 00 	movabs 0x8631e0,%rax
+  805658:	00 00 00 
+  80565b:	48 39 c2             	cmp    %rax,%rdx
+  80565e:	48 0f 47 d0          	cmova  %rax,%rdx
+  805662:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  805666:	44 89 e1             	mov    %r12d,%ecx
+  805669:	48 b8 e8 31 86 00 00 	movabs $0x8631e8,%rax
+  805670:	00 00 00 
+  805673:	48 8b 30             	mov    (%rax),%rsi
+  805676:	48 b8 aa 41 80 00 00 	movabs $0x8041aa,%rax
+  80567d:	00 00 00 
+  805680:	ff d0                	call   *%rax
+  805682:	48 89 c3             	mov    %rax,%rbx
+    if (writen < 0) {
+  805685:	48 85 c0             	test   %rax,%rax
+  805688:	78 0a                	js     805694 <serve_write+0x89>
+    if (writen) serve_invalidate(o->o_file);
+  80568a:	75 23                	jne    8056af <serve_write+0xa4>
+    if (cur) o->o_fd->fd_offset = offset + writen;
+  80568c:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  805690:	74 2f                	je     8056c1 <serve_write+0xb6>
+    return writen;
+  805692:	89 d8                	mov    %ebx,%eax
+}
+  805694:	48 83 c4 10          	add    $0x10,%rsp
+  805698:	5b                   	pop    %rbx
+  805699:	41 5c                	pop    %r12
+  80569b:	41 5d                	pop    %r13
+  80569d:	41 5e                	pop    %r14
+  80569f:	5d                   	pop    %rbp
+  8056a0:	c3                   	ret
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  8056a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8056a5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8056a9:	44 8b 60 04          	mov    0x4(%rax),%r12d
+  8056ad:	eb 91                	jmp    805640 <serve_write+0x35>
+    if (writen) serve_invalidate(o->o_file);
+  8056af:	49 8b 7e 08          	mov    0x8(%r14),%rdi
+  8056b3:	48 b8 b9 4f 80 00 00 	movabs $0x804fb9,%rax
+  8056ba:	00 00 00 
+  8056bd:	ff d0                	call   *%rax
+  8056bf:	eb cb                	jmp    80568c <serve_write+0x81>
+    if (cur) o->o_fd->fd_offset = offset + writen;
+  8056c1:	49 8b 46 18          	mov    0x18(%r14),%rax
+  8056c5:	41 01 dc             	add    %ebx,%r12d
+  8056c8:	44 89 60 04          	mov    %r12d,0x4(%rax)
+  8056cc:	eb c4                	jmp    805692 <serve_write+0x87>
+    if (offset < 0) return -E_INVAL;
+  8056ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8056d3:	eb bf                	jmp    805694 <serve_write+0x89>
+
+00000000008056d5 <serve_stat>:
+serve_stat(envid_t envid, union Fsipc *ipc) {
+  8056d5:	55                   	push   %rbp
+  8056d6:	48 89 e5             	mov    %rsp,%rbp
+  8056d9:	41 54                	push   %r12
+  8056db:	53                   	push   %rbx
+  8056dc:	48 83 ec 10          	sub    $0x10,%rsp
+  8056e0:	48 89 f3             	mov    %rsi,%rbx
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  8056e3:	8b 36                	mov    (%rsi),%esi
+  8056e5:	48 8d 55 e8          	lea    -0x18(%rbp),%rdx
+  8056e9:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  8056f0:	00 00 00 
+  8056f3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8056f5:	85 c0                	test   %eax,%eax
+  8056f7:	78 46                	js     80573f <serve_stat+0x6a>
+    strcpy(ret->ret_name, o->o_file->f_name);
+  8056f9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8056fd:	49 8b 74 24 08       	mov    0x8(%r12),%rsi
+  805702:	48 89 df             	mov    %rbx,%rdi
+  805705:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80570c:	00 00 00 
+  80570f:	ff d0                	call   *%rax
+    ret->ret_size = o->o_file->f_size;
+  805711:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  805716:	8b 80 80 00 00 00    	mov    0x80(%rax),%eax
+  80571c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    ret->ret_isdir = (o->o_file->f_type == FTYPE_DIR);
+  805722:	49 8b 44 24 08       	mov    0x8(%r12),%rax
+  805727:	83 b8 84 00 00 00 01 	cmpl   $0x1,0x84(%rax)
+  80572e:	0f 94 c0             	sete   %al
+  805731:	0f b6 c0             	movzbl %al,%eax
+  805734:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80573a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80573f:	48 83 c4 10          	add    $0x10,%rsp
+  805743:	5b                   	pop    %rbx
+  805744:	41 5c                	pop    %r12
+  805746:	5d                   	pop    %rbp
+  805747:	c3                   	ret
+
+0000000000805748 <serve_flush>:
+serve_flush(envid_t envid, union Fsipc *ipc) {
+  805748:	55                   	push   %rbp
+  805749:	48 89 e5             	mov    %rsp,%rbp
+  80574c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805750:	8b 36                	mov    (%rsi),%esi
+  805752:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  805756:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  80575d:	00 00 00 
+  805760:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805762:	85 c0                	test   %eax,%eax
+  805764:	78 19                	js     80577f <serve_flush+0x37>
+    file_flush(o->o_file);
+  805766:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80576a:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80576e:	48 b8 e0 42 80 00 00 	movabs $0x8042e0,%rax
+  805775:	00 00 00 
+  805778:	ff d0                	call   *%rax
+    return 0;
+  80577a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80577f:	c9                   	leave
+  805780:	c3                   	ret
+
+0000000000805781 <serve_fsync>:
+serve_fsync(envid_t envid, union Fsipc *ipc) {
+  805781:	55                   	push   %rbp
+  805782:	48 89 e5             	mov    %rsp,%rbp
+  805785:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805789:	8b 36                	mov    (%rsi),%esi
+  80578b:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  80578f:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  805796:	00 00 00 
+  805799:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80579b:	85 c0                	test   %eax,%eax
+  80579d:	78 19                	js     8057b8 <serve_fsync+0x37>
+    file_fsync(o->o_file);
+  80579f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8057a3:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  8057a7:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  8057ae:	00 00 00 
+  8057b1:	ff d0                	call   *%rax
+    return 0;
+  8057b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8057b8:	c9                   	leave
+  8057b9:	c3                   	ret
+
+00000000008057ba <serve_file_of>:
+    switch (type) {
+  8057ba:	83 fe 06             	cmp    $0x6,%esi
+  8057bd:	77 0b                	ja     8057ca <serve_file_of+0x10>
+  8057bf:	83 fe 01             	cmp    $0x1,%esi
+  8057c2:	77 13                	ja     8057d7 <serve_file_of+0x1d>
+  8057c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057c9:	c3                   	ret
+  8057ca:	83 ee 0d             	sub    $0xd,%esi
+  8057cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057d2:	83 fe 02             	cmp    $0x2,%esi
+  8057d5:	77 2b                	ja     805802 <serve_file_of+0x48>
+serve_file_of(envid_t envid, uint32_t type, union Fsipc *ipc) {
+  8057d7:	55                   	push   %rbp
+  8057d8:	48 89 e5             	mov    %rsp,%rbp
+  8057db:	48 83 ec 10          	sub    $0x10,%rsp
+        return openfile_lookup(envid, ipc->stat.req_fileid, &o) < 0 ? NULL : o;
+  8057df:	8b 32                	mov    (%rdx),%esi
+  8057e1:	48 8d 55 f8          	lea    -0x8(%rbp),%rdx
+  8057e5:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  8057ec:	00 00 00 
+  8057ef:	ff d0                	call   *%rax
+  8057f1:	89 c2                	mov    %eax,%edx
+  8057f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057f8:	85 d2                	test   %edx,%edx
+  8057fa:	78 04                	js     805800 <serve_file_of+0x46>
+  8057fc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+}
+  805800:	c9                   	leave
+  805801:	c3                   	ret
+  805802:	c3                   	ret
+
+0000000000805803 <serve_open>:
+           void **pg_store, int *perm_store) {
+  805803:	55                   	push   %rbp
+  805804:	48 89 e5             	mov    %rsp,%rbp
+  805807:	41 55                	push   %r13
+  805809:	41 54                	push   %r12
+  80580b:	53                   	push   %rbx
+  80580c:	48 81 ec 18 04 00 00 	sub    $0x418,%rsp
+  805813:	48 89 f3             	mov    %rsi,%rbx
+  805816:	49 89 d5             	mov    %rdx,%r13
+  805819:	49 89 cc             	mov    %rcx,%r12
+    memmove(path, req->req_path, MAXPATHLEN);
+  80581c:	ba 00 04 00 00       	mov    $0x400,%edx
+  805821:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805828:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  80582f:	00 00 00 
+  805832:	ff d0                	call   *%rax
+    path[MAXPATHLEN - 1] = 0;
+  805834:	c6 45 df 00          	movb   $0x0,-0x21(%rbp)
+    if ((res = openfile_alloc(&o)) < 0) {
+  805838:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80583f:	48 b8 69 53 80 00 00 	movabs $0x805369,%rax
+  805846:	00 00 00 
+  805849:	ff d0                	call   *%rax
+  80584b:	85 c0                	test   %eax,%eax
+  80584d:	0f 88 4e 01 00 00    	js     8059a1 <serve_open+0x19e>
+    if (req->req_omode & O_CREAT) {
+  805853:	f6 83 01 04 00 00 01 	testb  $0x1,0x401(%rbx)
+  80585a:	74 5c                	je     8058b8 <serve_open+0xb5>
+        if ((res = file_create(path, &f)) < 0) {
+  80585c:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  805863:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  80586a:	48 b8 c4 44 80 00 00 	movabs $0x8044c4,%rax
+  805871:	00 00 00 
+  805874:	ff d0                	call   *%rax
+  805876:	85 c0                	test   %eax,%eax
+  805878:	78 28                	js     8058a2 <serve_open+0x9f>
+        if (req->req_omode & O_MKDIR) {
+  80587a:	f6 83 01 04 00 00 08 	testb  $0x8,0x401(%rbx)
+  805881:	74 57                	je     8058da <serve_open+0xd7>
+            f->f_type = FTYPE_DIR;
+  805883:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  80588a:	c7 87 84 00 00 00 01 	movl   $0x1,0x84(%rdi)
+  805891:	00 00 00 
+            flush_block(f);
+  805894:	48 b8 10 21 80 00 00 	movabs $0x802110,%rax
+  80589b:	00 00 00 
+  80589e:	ff d0                	call   *%rax
+  8058a0:	eb 38                	jmp    8058da <serve_open+0xd7>
+            if (!(req->req_omode & O_EXCL) && res == -E_FILE_EXISTS)
+  8058a2:	f6 83 01 04 00 00 04 	testb  $0x4,0x401(%rbx)
+  8058a9:	0f 85 f2 00 00 00    	jne    8059a1 <serve_open+0x19e>
+  8058af:	83 f8 ef             	cmp    $0xffffffef,%eax
+  8058b2:	0f 85 e9 00 00 00    	jne    8059a1 <serve_open+0x19e>
+        if ((res = file_open(path, &f)) < 0) {
+  8058b8:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  8058bf:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  8058c6:	48 b8 9d 3e 80 00 00 	movabs $0x803e9d,%rax
+  8058cd:	00 00 00 
+  8058d0:	ff d0                	call   *%rax
+  8058d2:	85 c0                	test   %eax,%eax
+  8058d4:	0f 88 c7 00 00 00    	js     8059a1 <serve_open+0x19e>
+    if (req->req_omode & O_TRUNC) {
+  8058da:	f6 83 01 04 00 00 02 	testb  $0x2,0x401(%rbx)
+  8058e1:	74 33                	je     805916 <serve_open+0x113>
+        if ((res = file_set_size(f, 0)) < 0) {
+  8058e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8058e8:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  8058ef:	48 b8 67 41 80 00 00 	movabs $0x804167,%rax
+  8058f6:	00 00 00 
+  8058f9:	ff d0                	call   *%rax
+  8058fb:	85 c0                	test   %eax,%eax
+  8058fd:	0f 88 9e 00 00 00    	js     8059a1 <serve_open+0x19e>
+        serve_invalidate(f);
+  805903:	48 8b bd d8 fb ff ff 	mov    -0x428(%rbp),%rdi
+  80590a:	48 b8 b9 4f 80 00 00 	movabs $0x804fb9,%rax
+  805911:	00 00 00 
+  805914:	ff d0                	call   *%rax
+    if ((res = file_open(path, &f)) < 0) {
+  805916:	48 8d b5 d8 fb ff ff 	lea    -0x428(%rbp),%rsi
+  80591d:	48 8d bd e0 fb ff ff 	lea    -0x420(%rbp),%rdi
+  805924:	48 b8 9d 3e 80 00 00 	movabs $0x803e9d,%rax
+  80592b:	00 00 00 
+  80592e:	ff d0                	call   *%rax
+  805930:	85 c0                	test   %eax,%eax
+  805932:	78 6d                	js     8059a1 <serve_open+0x19e>
+    o->o_file = f;
+  805934:	48 8b 95 d0 fb ff ff 	mov    -0x430(%rbp),%rdx
+  80593b:	48 8b 85 d8 fb ff ff 	mov    -0x428(%rbp),%rax
+  805942:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    o->o_fd->fd_file.id = o->o_fileid;
+  805946:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  80594a:	8b 0a                	mov    (%rdx),%ecx
+  80594c:	89 48 0c             	mov    %ecx,0xc(%rax)
+    o->o_fd->fd_omode = req->req_omode & O_ACCMODE;
+  80594f:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  805953:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  805959:	83 e0 03             	and    $0x3,%eax
+  80595c:	89 41 08             	mov    %eax,0x8(%rcx)
+    o->o_fd->fd_dev_id = devfile.dev_id;
+  80595f:	48 8b 4a 18          	mov    0x18(%rdx),%rcx
+  805963:	a1 c0 30 81 00 00 00 	movabs 0x8130c0,%eax
+  80596a:	00 00 
+  80596c:	89 01                	mov    %eax,(%rcx)
+    o->o_mode = req->req_omode;
+  80596e:	8b 83 00 04 00 00    	mov    0x400(%rbx),%eax
+  805974:	89 42 10             	mov    %eax,0x10(%rdx)
+    o->o_ra_pos = 0;
+  805977:	c7 42 20 00 00 00 00 	movl   $0x0,0x20(%rdx)
+    o->o_ra_window = 0;
+  80597e:	c7 42 24 00 00 00 00 	movl   $0x0,0x24(%rdx)
+    o->o_ra_next = 0;
+  805985:	c7 42 28 00 00 00 00 	movl   $0x0,0x28(%rdx)
+    *pg_store = o->o_fd;
+  80598c:	48 8b 42 18          	mov    0x18(%rdx),%rax
+  805990:	49 89 45 00          	mov    %rax,0x0(%r13)
+    *perm_store = PROT_RW | PROT_SHARE;
+  805994:	41 c7 04 24 46 00 00 	movl   $0x46,(%r12)
+  80599b:	00 
+    return 0;
+  80599c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8059a1:	48 81 c4 18 04 00 00 	add    $0x418,%rsp
+  8059a8:	5b                   	pop    %rbx
+  8059a9:	41 5c                	pop    %r12
+  8059ab:	41 5d                	pop    %r13
+  8059ad:	5d                   	pop    %rbp
+  8059ae:	c3                   	ret
+
+00000000008059af <serve_read_map>:
+serve_read_map(envid_t envid, struct Fsreq_read *req, void **pg_store, size_t *size_store, int *perm_store) {
+  8059af:	55                   	push   %rbp
+  8059b0:	48 89 e5             	mov    %rsp,%rbp
+  8059b3:	41 57                	push   %r15
+  8059b5:	41 56                	push   %r14
+  8059b7:	41 55                	push   %r13
+  8059b9:	41 54                	push   %r12
+  8059bb:	53                   	push   %rbx
+  8059bc:	48 83 ec 48          	sub    $0x48,%rsp
+  8059c0:	49 89 f4             	mov    %rsi,%r12
+  8059c3:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  8059c7:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  8059cb:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  8059cf:	8b 36                	mov    (%rsi),%esi
+  8059d1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8059d5:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  8059dc:	00 00 00 
+  8059df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8059e1:	85 c0                	test   %eax,%eax
+  8059e3:	78 72                	js     805a57 <serve_read_map+0xa8>
+    struct File *f = o->o_file;
+  8059e5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8059e9:	49 8b 5f 08          	mov    0x8(%r15),%rbx
+    bool cur = req->req_offset == FSREQ_OFFSET_CUR;
+  8059ed:	45 8b 74 24 04       	mov    0x4(%r12),%r14d
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  8059f2:	45 89 f5             	mov    %r14d,%r13d
+  8059f5:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8059f9:	74 6b                	je     805a66 <serve_read_map+0xb7>
+    if (offset < 0) return -E_INVAL;
+  8059fb:	45 85 ed             	test   %r13d,%r13d
+  8059fe:	0f 88 7e 01 00 00    	js     805b82 <serve_read_map+0x1d3>
+    if (offset >= f->f_size) return 0;
+  805a04:	8b 8b 80 00 00 00    	mov    0x80(%rbx),%ecx
+  805a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a0f:	44 39 e9             	cmp    %r13d,%ecx
+  805a12:	7e 43                	jle    805a57 <serve_read_map+0xa8>
+    if (offset % BLKSIZE) return -E_NOT_SUPP;
+  805a14:	41 f7 c5 ff 0f 00 00 	test   $0xfff,%r13d
+  805a1b:	0f 85 6b 01 00 00    	jne    805b8c <serve_read_map+0x1dd>
+    blockno_t n = MIN(MIN(req->req_n, FSMAP_MAX_SIZE) / BLKSIZE, (f->f_size - offset) / BLKSIZE);
+  805a21:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  805a26:	b8 00 00 04 00       	mov    $0x40000,%eax
+  805a2b:	48 39 c2             	cmp    %rax,%rdx
+  805a2e:	48 0f 47 d0          	cmova  %rax,%rdx
+  805a32:	48 c1 ea 0c          	shr    $0xc,%rdx
+  805a36:	44 29 e9             	sub    %r13d,%ecx
+  805a39:	8d 81 ff 0f 00 00    	lea    0xfff(%rcx),%eax
+  805a3f:	0f 49 c1             	cmovns %ecx,%eax
+  805a42:	c1 f8 0c             	sar    $0xc,%eax
+  805a45:	48 98                	cltq
+  805a47:	48 39 c2             	cmp    %rax,%rdx
+  805a4a:	48 0f 47 d0          	cmova  %rax,%rdx
+    if (!n || (res = serve_block_run(f, offset / BLKSIZE, n, &start)) <= 0) return res < 0 ? res : -E_NOT_SUPP;
+  805a4e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805a53:	85 d2                	test   %edx,%edx
+  805a55:	75 19                	jne    805a70 <serve_read_map+0xc1>
+}
+  805a57:	48 83 c4 48          	add    $0x48,%rsp
+  805a5b:	5b                   	pop    %rbx
+  805a5c:	41 5c                	pop    %r12
+  805a5e:	41 5d                	pop    %r13
+  805a60:	41 5e                	pop    %r14
+  805a62:	41 5f                	pop    %r15
+  805a64:	5d                   	pop    %rbp
+  805a65:	c3                   	ret
+    off_t offset = cur ? o->o_fd->fd_offset : req->req_offset;
+  805a66:	49 8b 47 18          	mov    0x18(%r15),%rax
+  805a6a:	44 8b 68 04          	mov    0x4(%rax),%r13d
+  805a6e:	eb 8b                	jmp    8059fb <serve_read_map+0x4c>
+    if (!n || (res = serve_block_run(f, offset / BLKSIZE, n, &start)) <= 0) return res < 0 ? res : -E_NOT_SUPP;
+  805a70:	41 8d b5 ff 0f 00 00 	lea    0xfff(%r13),%esi
+  805a77:	45 85 ed             	test   %r13d,%r13d
+  805a7a:	41 0f 49 f5          	cmovns %r13d,%esi
+  805a7e:	c1 fe 0c             	sar    $0xc,%esi
+  805a81:	48 8d 4d c4          	lea    -0x3c(%rbp),%rcx
+  805a85:	48 89 df             	mov    %rbx,%rdi
+  805a88:	48 b8 e1 50 80 00 00 	movabs $0x8050e1,%rax
+  805a8f:	00 00 00 
+  805a92:	ff d0                	call   *%rax
+  805a94:	85 c0                	test   %eax,%eax
+  805a96:	0f 8e c5 00 00 00    	jle    805b61 <serve_read_map+0x1b2>
+    blockno_t run = serve_load_run(f, offset, res, start);
+  805a9c:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  805a9f:	89 c2                	mov    %eax,%edx
+  805aa1:	44 89 ee             	mov    %r13d,%esi
+  805aa4:	48 89 df             	mov    %rbx,%rdi
+  805aa7:	48 b8 6a 51 80 00 00 	movabs $0x80516a,%rax
+  805aae:	00 00 00 
+  805ab1:	ff d0                	call   *%rax
+  805ab3:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    if (!run) return -E_NOT_SUPP;
+  805ab6:	85 c0                	test   %eax,%eax
+  805ab8:	0f 84 d8 00 00 00    	je     805b96 <serve_read_map+0x1e7>
+    char *blk = diskaddr(start);
+  805abe:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  805ac1:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  805ac8:	00 00 00 
+  805acb:	ff d0                	call   *%rax
+  805acd:	48 89 45 98          	mov    %rax,-0x68(%rbp)
+    while (mapped < run && is_page_present(blk + mapped * BLKSIZE) && !is_page_dirty(blk + mapped * BLKSIZE))
+  805ad1:	49 89 c4             	mov    %rax,%r12
+    blockno_t mapped = 0;
+  805ad4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while (mapped < run && is_page_present(blk + mapped * BLKSIZE) && !is_page_dirty(blk + mapped * BLKSIZE))
+  805ad9:	4c 89 e7             	mov    %r12,%rdi
+  805adc:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  805ae3:	00 00 00 
+  805ae6:	ff d0                	call   *%rax
+  805ae8:	84 c0                	test   %al,%al
+  805aea:	74 25                	je     805b11 <serve_read_map+0x162>
+  805aec:	4c 89 e7             	mov    %r12,%rdi
+  805aef:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  805af6:	00 00 00 
+  805af9:	ff d0                	call   *%rax
+  805afb:	84 c0                	test   %al,%al
+  805afd:	75 12                	jne    805b11 <serve_read_map+0x162>
+        mapped++;
+  805aff:	83 c3 01             	add    $0x1,%ebx
+    while (mapped < run && is_page_present(blk + mapped * BLKSIZE) && !is_page_dirty(blk + mapped * BLKSIZE))
+  805b02:	49 81 c4 00 10 00 00 	add    $0x1000,%r12
+  805b09:	39 5d bc             	cmp    %ebx,-0x44(%rbp)
+  805b0c:	75 cb                	jne    805ad9 <serve_read_map+0x12a>
+        mapped++;
+  805b0e:	8b 5d bc             	mov    -0x44(%rbp),%ebx
+    if (!mapped) return -E_NOT_SUPP;
+  805b11:	85 db                	test   %ebx,%ebx
+  805b13:	0f 84 87 00 00 00    	je     805ba0 <serve_read_map+0x1f1>
+    serve_readahead(o, offset, mapped * BLKSIZE);
+  805b19:	41 89 dc             	mov    %ebx,%r12d
+  805b1c:	49 c1 e4 0c          	shl    $0xc,%r12
+  805b20:	4c 89 e2             	mov    %r12,%rdx
+  805b23:	44 89 ee             	mov    %r13d,%esi
+  805b26:	4c 89 ff             	mov    %r15,%rdi
+  805b29:	48 b8 1b 50 80 00 00 	movabs $0x80501b,%rax
+  805b30:	00 00 00 
+  805b33:	ff d0                	call   *%rax
+    if (cur) o->o_fd->fd_offset = offset + mapped * BLKSIZE;
+  805b35:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  805b39:	74 36                	je     805b71 <serve_read_map+0x1c2>
+    *pg_store = blk;
+  805b3b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805b3f:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  805b43:	48 89 08             	mov    %rcx,(%rax)
+    *size_store = mapped * BLKSIZE;
+  805b46:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805b4a:	4c 89 20             	mov    %r12,(%rax)
+    *perm_store = PROT_RW | PROT_LAZY;
+  805b4d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  805b51:	c7 00 86 00 00 00    	movl   $0x86,(%rax)
+    return mapped * BLKSIZE;
+  805b57:	89 d8                	mov    %ebx,%eax
+  805b59:	c1 e0 0c             	shl    $0xc,%eax
+  805b5c:	e9 f6 fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+    if (!n || (res = serve_block_run(f, offset / BLKSIZE, n, &start)) <= 0) return res < 0 ? res : -E_NOT_SUPP;
+  805b61:	0f 88 f0 fe ff ff    	js     805a57 <serve_read_map+0xa8>
+  805b67:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805b6c:	e9 e6 fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+    if (cur) o->o_fd->fd_offset = offset + mapped * BLKSIZE;
+  805b71:	49 8b 57 18          	mov    0x18(%r15),%rdx
+  805b75:	89 d8                	mov    %ebx,%eax
+  805b77:	c1 e0 0c             	shl    $0xc,%eax
+  805b7a:	44 01 e8             	add    %r13d,%eax
+  805b7d:	89 42 04             	mov    %eax,0x4(%rdx)
+  805b80:	eb b9                	jmp    805b3b <serve_read_map+0x18c>
+    if (offset < 0) return -E_INVAL;
+  805b82:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  805b87:	e9 cb fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+    if (offset % BLKSIZE) return -E_NOT_SUPP;
+  805b8c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805b91:	e9 c1 fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+    if (!run) return -E_NOT_SUPP;
+  805b96:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805b9b:	e9 b7 fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+    if (!mapped) return -E_NOT_SUPP;
+  805ba0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  805ba5:	e9 ad fe ff ff       	jmp    805a57 <serve_read_map+0xa8>
+
+0000000000805baa <serve_map>:
+serve_map(envid_t envid, struct Fsreq_map *req, void **pg_store, size_t *size_store, int *perm_store) {
+  805baa:	55                   	push   %rbp
+  805bab:	48 89 e5             	mov    %rsp,%rbp
+  805bae:	41 57                	push   %r15
+  805bb0:	41 56                	push   %r14
+  805bb2:	41 55                	push   %r13
+  805bb4:	41 54                	push   %r12
+  805bb6:	53                   	push   %rbx
+  805bb7:	48 83 ec 48          	sub    $0x48,%rsp
+  805bbb:	49 89 f6             	mov    %rsi,%r14
+  805bbe:	48 89 55 b0          	mov    %rdx,-0x50(%rbp)
+  805bc2:	48 89 4d a8          	mov    %rcx,-0x58(%rbp)
+  805bc6:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+    int res = openfile_lookup(envid, req->req_fileid, &o);
+  805bca:	8b 36                	mov    (%rsi),%esi
+  805bcc:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  805bd0:	48 b8 4a 54 80 00 00 	movabs $0x80544a,%rax
+  805bd7:	00 00 00 
+  805bda:	ff d0                	call   *%rax
+  805bdc:	89 c2                	mov    %eax,%edx
+    if (res < 0) return res;
+  805bde:	85 c0                	test   %eax,%eax
+  805be0:	0f 88 b8 02 00 00    	js     805e9e <serve_map+0x2f4>
+    if ((o->o_mode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  805be6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  805bea:	48 89 5d 90          	mov    %rbx,-0x70(%rbp)
+  805bee:	8b 43 10             	mov    0x10(%rbx),%eax
+  805bf1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  805bf4:	83 e0 03             	and    $0x3,%eax
+  805bf7:	83 f8 01             	cmp    $0x1,%eax
+  805bfa:	0f 84 79 02 00 00    	je     805e79 <serve_map+0x2cf>
+    int perm = req->req_perm & (PROT_RW | PROT_LAZY);
+  805c00:	41 8b 46 10          	mov    0x10(%r14),%eax
+  805c04:	89 45 9c             	mov    %eax,-0x64(%rbp)
+    if (!(perm & PROT_R) || (perm & (PROT_W | PROT_LAZY)) == PROT_W) return -E_INVAL;
+  805c07:	a8 04                	test   $0x4,%al
+  805c09:	0f 84 71 02 00 00    	je     805e80 <serve_map+0x2d6>
+  805c0f:	25 82 00 00 00       	and    $0x82,%eax
+  805c14:	83 f8 02             	cmp    $0x2,%eax
+  805c17:	0f 84 6a 02 00 00    	je     805e87 <serve_map+0x2dd>
+    struct File *f = o->o_file;
+  805c1d:	4c 8b 6b 08          	mov    0x8(%rbx),%r13
+    off_t offset = req->req_offset;
+  805c21:	45 8b 7e 04          	mov    0x4(%r14),%r15d
+    if (offset < 0 || offset % BLKSIZE) return -E_INVAL;
+  805c25:	45 85 ff             	test   %r15d,%r15d
+  805c28:	0f 88 60 02 00 00    	js     805e8e <serve_map+0x2e4>
+  805c2e:	44 89 fa             	mov    %r15d,%edx
+  805c31:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  805c37:	0f 85 58 02 00 00    	jne    805e95 <serve_map+0x2eb>
+    if ((res = n ? serve_block_run(f, offset / BLKSIZE, n, &start) : 0) < 0) return res;
+  805c3d:	41 8d 87 ff 0f 00 00 	lea    0xfff(%r15),%eax
+  805c44:	45 85 ff             	test   %r15d,%r15d
+  805c47:	41 0f 49 c7          	cmovns %r15d,%eax
+  805c4b:	c1 f8 0c             	sar    $0xc,%eax
+  805c4e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+    if (!(res = serve_load_run(f, offset, res, start))) goto again;
+  805c51:	49 bc 6a 51 80 00 00 	movabs $0x80516a,%r12
+  805c58:	00 00 00 
+  805c5b:	89 d3                	mov    %edx,%ebx
+  805c5d:	eb 16                	jmp    805c75 <serve_map+0xcb>
+    if (!res) {
+  805c5f:	74 78                	je     805cd9 <serve_map+0x12f>
+    if (!(res = serve_load_run(f, offset, res, start))) goto again;
+  805c61:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  805c64:	44 89 fe             	mov    %r15d,%esi
+  805c67:	4c 89 ef             	mov    %r13,%rdi
+  805c6a:	41 ff d4             	call   *%r12
+  805c6d:	85 c0                	test   %eax,%eax
+  805c6f:	0f 85 19 01 00 00    	jne    805d8e <serve_map+0x1e4>
+    if (offset >= f->f_size) return 0;
+  805c75:	41 8b 8d 80 00 00 00 	mov    0x80(%r13),%ecx
+  805c7c:	44 39 f9             	cmp    %r15d,%ecx
+  805c7f:	0f 8e 17 02 00 00    	jle    805e9c <serve_map+0x2f2>
+    blockno_t n = MIN(MIN(req->req_n, FSMAP_MAX_SIZE) / BLKSIZE, (f->f_size - offset) / BLKSIZE);
+  805c85:	49 8b 46 08          	mov    0x8(%r14),%rax
+  805c89:	ba 00 00 04 00       	mov    $0x40000,%edx
+  805c8e:	48 39 d0             	cmp    %rdx,%rax
+  805c91:	48 0f 47 c2          	cmova  %rdx,%rax
+  805c95:	48 c1 e8 0c          	shr    $0xc,%rax
+  805c99:	44 29 f9             	sub    %r15d,%ecx
+  805c9c:	8d 91 ff 0f 00 00    	lea    0xfff(%rcx),%edx
+  805ca2:	0f 49 d1             	cmovns %ecx,%edx
+  805ca5:	c1 fa 0c             	sar    $0xc,%edx
+  805ca8:	48 63 d2             	movslq %edx,%rdx
+  805cab:	48 39 d0             	cmp    %rdx,%rax
+  805cae:	48 0f 47 c2          	cmova  %rdx,%rax
+  805cb2:	89 c2                	mov    %eax,%edx
+    if ((res = n ? serve_block_run(f, offset / BLKSIZE, n, &start) : 0) < 0) return res;
+  805cb4:	85 c0                	test   %eax,%eax
+  805cb6:	74 21                	je     805cd9 <serve_map+0x12f>
+  805cb8:	48 8d 4d c4          	lea    -0x3c(%rbp),%rcx
+  805cbc:	8b 75 b8             	mov    -0x48(%rbp),%esi
+  805cbf:	4c 89 ef             	mov    %r13,%rdi
+  805cc2:	48 b8 e1 50 80 00 00 	movabs $0x8050e1,%rax
+  805cc9:	00 00 00 
+  805ccc:	ff d0                	call   *%rax
+  805cce:	89 c2                	mov    %eax,%edx
+  805cd0:	85 c0                	test   %eax,%eax
+  805cd2:	79 8b                	jns    805c5f <serve_map+0xb5>
+  805cd4:	e9 c5 01 00 00       	jmp    805e9e <serve_map+0x2f4>
+        void *copy = FSMAP_COPY(fsreq);
+  805cd9:	48 a1 f0 31 86 00 00 	movabs 0x8631f0,%rax
+  805ce0:	00 00 00 
+  805ce3:	48 8d 98 00 f0 01 00 	lea    0x1f000(%rax),%rbx
+        if ((res = sys_alloc_region(0, copy, PAGE_SIZE, PROT_RW)) < 0) return res;
+  805cea:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805cef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805cf4:	48 89 de             	mov    %rbx,%rsi
+  805cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  805cfc:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  805d03:	00 00 00 
+  805d06:	ff d0                	call   *%rax
+  805d08:	89 c2                	mov    %eax,%edx
+  805d0a:	85 c0                	test   %eax,%eax
+  805d0c:	0f 88 8c 01 00 00    	js     805e9e <serve_map+0x2f4>
+        if (file_block_map(f, offset / BLKSIZE, &start) > 0 &&
+  805d12:	48 8d 55 c4          	lea    -0x3c(%rbp),%rdx
+  805d16:	8b 75 b8             	mov    -0x48(%rbp),%esi
+  805d19:	4c 89 ef             	mov    %r13,%rdi
+  805d1c:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  805d23:	00 00 00 
+  805d26:	ff d0                	call   *%rax
+  805d28:	85 c0                	test   %eax,%eax
+  805d2a:	7e 38                	jle    805d64 <serve_map+0x1ba>
+            (res = file_read(f, copy, MIN(f->f_size - offset, BLKSIZE), offset)) < 0) return res;
+  805d2c:	41 8b 95 80 00 00 00 	mov    0x80(%r13),%edx
+  805d33:	44 29 fa             	sub    %r15d,%edx
+  805d36:	48 63 d2             	movslq %edx,%rdx
+  805d39:	b8 00 10 00 00       	mov    $0x1000,%eax
+  805d3e:	48 39 c2             	cmp    %rax,%rdx
+  805d41:	48 0f 4f d0          	cmovg  %rax,%rdx
+  805d45:	44 89 f9             	mov    %r15d,%ecx
+  805d48:	48 89 de             	mov    %rbx,%rsi
+  805d4b:	4c 89 ef             	mov    %r13,%rdi
+  805d4e:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  805d55:	00 00 00 
+  805d58:	ff d0                	call   *%rax
+  805d5a:	89 c2                	mov    %eax,%edx
+        if (file_block_map(f, offset / BLKSIZE, &start) > 0 &&
+  805d5c:	85 c0                	test   %eax,%eax
+  805d5e:	0f 88 3a 01 00 00    	js     805e9e <serve_map+0x2f4>
+        *pg_store = copy;
+  805d64:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805d68:	48 89 18             	mov    %rbx,(%rax)
+        *size_store = PAGE_SIZE;
+  805d6b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805d6f:	48 c7 00 00 10 00 00 	movq   $0x1000,(%rax)
+        *perm_store = (perm & PROT_RW) | PROT_LAZY;
+  805d76:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805d79:	83 e0 06             	and    $0x6,%eax
+  805d7c:	0c 80                	or     $0x80,%al
+  805d7e:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  805d82:	89 03                	mov    %eax,(%rbx)
+        return PAGE_SIZE;
+  805d84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805d89:	e9 10 01 00 00       	jmp    805e9e <serve_map+0x2f4>
+    char *blk = diskaddr(start);
+  805d8e:	89 c3                	mov    %eax,%ebx
+  805d90:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  805d93:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  805d9a:	00 00 00 
+  805d9d:	ff d0                	call   *%rax
+  805d9f:	49 89 c5             	mov    %rax,%r13
+  805da2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+    while (mapped < res && is_page_present(blk + mapped * BLKSIZE))
+  805da6:	49 89 c6             	mov    %rax,%r14
+    blockno_t mapped = 0;
+  805da9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while (mapped < res && is_page_present(blk + mapped * BLKSIZE))
+  805daf:	4c 89 ef             	mov    %r13,%rdi
+  805db2:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  805db9:	00 00 00 
+  805dbc:	ff d0                	call   *%rax
+  805dbe:	84 c0                	test   %al,%al
+  805dc0:	74 10                	je     805dd2 <serve_map+0x228>
+        mapped++;
+  805dc2:	41 83 c4 01          	add    $0x1,%r12d
+    while (mapped < res && is_page_present(blk + mapped * BLKSIZE))
+  805dc6:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  805dcd:	41 39 dc             	cmp    %ebx,%r12d
+  805dd0:	72 dd                	jb     805daf <serve_map+0x205>
+    if (!mapped) {
+  805dd2:	45 85 e4             	test   %r12d,%r12d
+  805dd5:	74 4b                	je     805e22 <serve_map+0x278>
+    if (perm & PROT_LAZY) {
+  805dd7:	f6 45 9c 80          	testb  $0x80,-0x64(%rbp)
+  805ddb:	75 61                	jne    805e3e <serve_map+0x294>
+    serve_readahead(o, offset, mapped * BLKSIZE);
+  805ddd:	44 89 e3             	mov    %r12d,%ebx
+  805de0:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805de4:	48 89 da             	mov    %rbx,%rdx
+  805de7:	44 89 fe             	mov    %r15d,%esi
+  805dea:	48 8b 7d 90          	mov    -0x70(%rbp),%rdi
+  805dee:	48 b8 1b 50 80 00 00 	movabs $0x80501b,%rax
+  805df5:	00 00 00 
+  805df8:	ff d0                	call   *%rax
+    *pg_store = blk;
+  805dfa:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805dfe:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  805e02:	48 89 30             	mov    %rsi,(%rax)
+    *size_store = mapped * BLKSIZE;
+  805e05:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805e09:	48 89 18             	mov    %rbx,(%rax)
+    int perm = req->req_perm & (PROT_RW | PROT_LAZY);
+  805e0c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  805e0f:	25 86 00 00 00       	and    $0x86,%eax
+  805e14:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  805e18:	89 03                	mov    %eax,(%rbx)
+    return mapped * BLKSIZE;
+  805e1a:	44 89 e2             	mov    %r12d,%edx
+  805e1d:	c1 e2 0c             	shl    $0xc,%edx
+  805e20:	eb 7c                	jmp    805e9e <serve_map+0x2f4>
+        bc_load(start, 1);
+  805e22:	be 01 00 00 00       	mov    $0x1,%esi
+  805e27:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  805e2a:	48 b8 f6 1d 80 00 00 	movabs $0x801df6,%rax
+  805e31:	00 00 00 
+  805e34:	ff d0                	call   *%rax
+        mapped = 1;
+  805e36:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  805e3c:	eb 99                	jmp    805dd7 <serve_map+0x22d>
+  805e3e:	44 89 e3             	mov    %r12d,%ebx
+  805e41:	48 c1 e3 0c          	shl    $0xc,%rbx
+  805e45:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805e49:	48 01 c3             	add    %rax,%rbx
+            flush_block_deferred(blk + i * BLKSIZE);
+  805e4c:	49 bd 6f 15 80 00 00 	movabs $0x80156f,%r13
+  805e53:	00 00 00 
+  805e56:	4c 89 f7             	mov    %r14,%rdi
+  805e59:	41 ff d5             	call   *%r13
+        for (blockno_t i = 0; i < mapped; i++)
+  805e5c:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  805e63:	49 39 de             	cmp    %rbx,%r14
+  805e66:	75 ee                	jne    805e56 <serve_map+0x2ac>
+        flush_commit();
+  805e68:	48 b8 61 17 80 00 00 	movabs $0x801761,%rax
+  805e6f:	00 00 00 
+  805e72:	ff d0                	call   *%rax
+  805e74:	e9 64 ff ff ff       	jmp    805ddd <serve_map+0x233>
+    if ((o->o_mode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  805e79:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  805e7e:	eb 1e                	jmp    805e9e <serve_map+0x2f4>
+    if (!(perm & PROT_R) || (perm & (PROT_W | PROT_LAZY)) == PROT_W) return -E_INVAL;
+  805e80:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  805e85:	eb 17                	jmp    805e9e <serve_map+0x2f4>
+  805e87:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  805e8c:	eb 10                	jmp    805e9e <serve_map+0x2f4>
+    if (offset < 0 || offset % BLKSIZE) return -E_INVAL;
+  805e8e:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  805e93:	eb 09                	jmp    805e9e <serve_map+0x2f4>
+  805e95:	ba fd ff ff ff       	mov    $0xfffffffd,%edx
+  805e9a:	eb 02                	jmp    805e9e <serve_map+0x2f4>
+  805e9c:	89 da                	mov    %ebx,%edx
+}
+  805e9e:	89 d0                	mov    %edx,%eax
+  805ea0:	48 83 c4 48          	add    $0x48,%rsp
+  805ea4:	5b                   	pop    %rbx
+  805ea5:	41 5c                	pop    %r12
+  805ea7:	41 5d                	pop    %r13
+  805ea9:	41 5e                	pop    %r14
+  805eab:	41 5f                	pop    %r15
+  805ead:	5d                   	pop    %rbp
+  805eae:	c3                   	ret
+
+0000000000805eaf <serve_worker>:
+serve_worker(void *arg) {
+  805eaf:	55                   	push   %rbp
+  805eb0:	48 89 e5             	mov    %rsp,%rbp
+  805eb3:	41 57                	push   %r15
+  805eb5:	41 56                	push   %r14
+  805eb7:	41 55                	push   %r13
+  805eb9:	41 54                	push   %r12
+  805ebb:	53                   	push   %rbx
+  805ebc:	48 83 ec 48          	sub    $0x48,%rsp
+  805ec0:	49 89 fe             	mov    %rdi,%r14
+    struct OpenFile *o = serve_file_of(whom, req, fsreq);
+  805ec3:	49 bf f0 31 86 00 00 	movabs $0x8631f0,%r15
+  805eca:	00 00 00 
+        while (o->o_busy) thread_yield();
+  805ecd:	49 bc 49 69 80 00 00 	movabs $0x806949,%r12
+  805ed4:	00 00 00 
+  805ed7:	e9 f5 01 00 00       	jmp    8060d1 <serve_worker+0x222>
+        res = serve_open(whom, (struct Fsreq_open *)fsreq, &pg, &perm);
+  805edc:	49 8b 37             	mov    (%r15),%rsi
+  805edf:	48 8d 4d bc          	lea    -0x44(%rbp),%rcx
+  805ee3:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  805ee7:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  805eea:	48 b8 03 58 80 00 00 	movabs $0x805803,%rax
+  805ef1:	00 00 00 
+  805ef4:	ff d0                	call   *%rax
+  805ef6:	89 c6                	mov    %eax,%esi
+  805ef8:	e9 90 01 00 00       	jmp    80608d <serve_worker+0x1de>
+        res = serve_read_map(whom, &fsreq->read, &pg, &pgsize, &perm);
+  805efd:	49 8b 37             	mov    (%r15),%rsi
+  805f00:	4c 8d 45 bc          	lea    -0x44(%rbp),%r8
+  805f04:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  805f08:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  805f0c:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  805f0f:	48 b8 af 59 80 00 00 	movabs $0x8059af,%rax
+  805f16:	00 00 00 
+  805f19:	ff d0                	call   *%rax
+  805f1b:	89 c6                	mov    %eax,%esi
+  805f1d:	e9 6b 01 00 00       	jmp    80608d <serve_worker+0x1de>
+        res = serve_map(whom, &fsreq->map, &pg, &pgsize, &perm);
+  805f22:	49 8b 37             	mov    (%r15),%rsi
+  805f25:	4c 8d 45 bc          	lea    -0x44(%rbp),%r8
+  805f29:	48 8d 4d c8          	lea    -0x38(%rbp),%rcx
+  805f2d:	48 8d 55 c0          	lea    -0x40(%rbp),%rdx
+  805f31:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  805f34:	48 b8 aa 5b 80 00 00 	movabs $0x805baa,%rax
+  805f3b:	00 00 00 
+  805f3e:	ff d0                	call   *%rax
+  805f40:	89 c6                	mov    %eax,%esi
+  805f42:	e9 46 01 00 00       	jmp    80608d <serve_worker+0x1de>
+    if (sz < FSCHAN_SIZE) return -E_INVAL;
+  805f47:	49 81 7e 20 ff 4f 00 	cmpq   $0x4fff,0x20(%r14)
+  805f4e:	00 
+  805f4f:	0f 86 26 02 00 00    	jbe    80617b <serve_worker+0x2cc>
+    for (size_t i = 0; i < FSCHAN_MAX; i++) {
+  805f55:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+            if (sys_region_refs(ch, PAGE_SIZE) > 1) continue;
+  805f5b:	48 89 5d a0          	mov    %rbx,-0x60(%rbp)
+        struct FsChannel *ch = FSCHAN(i);
+  805f5f:	4c 89 e8             	mov    %r13,%rax
+  805f62:	48 c1 e0 10          	shl    $0x10,%rax
+  805f66:	48 8d 98 00 00 00 0f 	lea    0xf000000(%rax),%rbx
+        if (fschan_used[i]) {
+  805f6d:	48 b8 20 43 86 00 00 	movabs $0x864320,%rax
+  805f74:	00 00 00 
+  805f77:	42 80 3c 28 00       	cmpb   $0x0,(%rax,%r13,1)
+  805f7c:	0f 84 d8 00 00 00    	je     80605a <serve_worker+0x1ab>
+            if (sys_region_refs(ch, PAGE_SIZE) > 1) continue;
+  805f82:	be 00 10 00 00       	mov    $0x1000,%esi
+  805f87:	48 89 df             	mov    %rbx,%rdi
+  805f8a:	48 b8 1a 83 80 00 00 	movabs $0x80831a,%rax
+  805f91:	00 00 00 
+  805f94:	ff d0                	call   *%rax
+  805f96:	83 f8 01             	cmp    $0x1,%eax
+  805f99:	7e 18                	jle    805fb3 <serve_worker+0x104>
+    for (size_t i = 0; i < FSCHAN_MAX; i++) {
+  805f9b:	49 83 c5 01          	add    $0x1,%r13
+  805f9f:	49 83 fd 20          	cmp    $0x20,%r13
+  805fa3:	75 ba                	jne    805f5f <serve_worker+0xb0>
+    return -E_MAX_OPEN;
+  805fa5:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  805fa9:	be f2 ff ff ff       	mov    $0xfffffff2,%esi
+  805fae:	e9 da 00 00 00       	jmp    80608d <serve_worker+0x1de>
+            sys_unmap_region(0, ch, FSCHAN_STRIDE);
+  805fb3:	48 89 de             	mov    %rbx,%rsi
+  805fb6:	48 89 5d 98          	mov    %rbx,-0x68(%rbp)
+  805fba:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  805fbe:	ba 00 00 01 00       	mov    $0x10000,%edx
+  805fc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  805fc8:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  805fcf:	00 00 00 
+  805fd2:	ff d0                	call   *%rax
+            fschan_used[i] = 0;
+  805fd4:	48 b8 20 43 86 00 00 	movabs $0x864320,%rax
+  805fdb:	00 00 00 
+  805fde:	42 c6 04 28 00       	movb   $0x0,(%rax,%r13,1)
+        int res = sys_map_region(0, fsreq, 0, ch, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  805fe3:	49 8b 37             	mov    (%r15),%rsi
+  805fe6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  805fec:	41 b8 00 50 00 00    	mov    $0x5000,%r8d
+  805ff2:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  805ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  805ffb:	bf 00 00 00 00       	mov    $0x0,%edi
+  806000:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  806007:	00 00 00 
+  80600a:	ff d0                	call   *%rax
+  80600c:	89 c6                	mov    %eax,%esi
+        if (res < 0) return res;
+  80600e:	85 c0                	test   %eax,%eax
+  806010:	78 7b                	js     80608d <serve_worker+0x1de>
+        fschan_used[i] = 1;
+  806012:	48 b8 20 43 86 00 00 	movabs $0x864320,%rax
+  806019:	00 00 00 
+  80601c:	42 c6 04 28 01       	movb   $0x1,(%rax,%r13,1)
+        fschan_client[i] = envid;
+  806021:	48 b8 a0 42 86 00 00 	movabs $0x8642a0,%rax
+  806028:	00 00 00 
+  80602b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80602e:	42 89 0c a8          	mov    %ecx,(%rax,%r13,4)
+        fschan_failed[i] = 0;
+  806032:	48 b8 20 42 86 00 00 	movabs $0x864220,%rax
+  806039:	00 00 00 
+  80603c:	42 c7 04 a8 00 00 00 	movl   $0x0,(%rax,%r13,4)
+  806043:	00 
+        fschan_blocked[i] = 0;
+  806044:	48 b8 00 42 86 00 00 	movabs $0x864200,%rax
+  80604b:	00 00 00 
+  80604e:	42 c6 04 28 00       	movb   $0x0,(%rax,%r13,1)
+        return 0;
+  806053:	be 00 00 00 00       	mov    $0x0,%esi
+  806058:	eb 33                	jmp    80608d <serve_worker+0x1de>
+  80605a:	48 89 5d 98          	mov    %rbx,-0x68(%rbp)
+  80605e:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  806062:	e9 7c ff ff ff       	jmp    805fe3 <serve_worker+0x134>
+        cprintf("Invalid request code %d from %08x\n", req, whom);
+  806067:	8b 55 ac             	mov    -0x54(%rbp),%edx
+  80606a:	44 89 ee             	mov    %r13d,%esi
+  80606d:	48 bf 70 c0 80 00 00 	movabs $0x80c070,%rdi
+  806074:	00 00 00 
+  806077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80607c:	48 b9 d1 74 80 00 00 	movabs $0x8074d1,%rcx
+  806083:	00 00 00 
+  806086:	ff d1                	call   *%rcx
+        res = -E_INVAL;
+  806088:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+    if (o) o->o_busy = 0;
+  80608d:	48 85 db             	test   %rbx,%rbx
+  806090:	74 04                	je     806096 <serve_worker+0x1e7>
+  806092:	c6 43 2c 00          	movb   $0x0,0x2c(%rbx)
+    ipc_send(whom, res, pg, pgsize, perm);
+  806096:	44 8b 45 bc          	mov    -0x44(%rbp),%r8d
+  80609a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80609e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8060a2:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  8060a5:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  8060ac:	00 00 00 
+  8060af:	ff d0                	call   *%rax
+    sys_unmap_region(0, fsreq, w->w_size);
+  8060b1:	49 8b 56 20          	mov    0x20(%r14),%rdx
+  8060b5:	49 8b 37             	mov    (%r15),%rsi
+  8060b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8060bd:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8060c4:	00 00 00 
+  8060c7:	ff d0                	call   *%rax
+        w->w_busy = 0;
+  8060c9:	41 c6 46 28 00       	movb   $0x0,0x28(%r14)
+        thread_yield();
+  8060ce:	41 ff d4             	call   *%r12
+    uint32_t req = w->w_type;
+  8060d1:	45 8b 6e 10          	mov    0x10(%r14),%r13d
+    envid_t whom = w->w_whom;
+  8060d5:	41 8b 7e 14          	mov    0x14(%r14),%edi
+  8060d9:	89 7d ac             	mov    %edi,-0x54(%rbp)
+    int perm = w->w_perm, res;
+  8060dc:	41 8b 46 18          	mov    0x18(%r14),%eax
+  8060e0:	89 45 bc             	mov    %eax,-0x44(%rbp)
+    void *pg = NULL;
+  8060e3:	48 c7 45 c0 00 00 00 	movq   $0x0,-0x40(%rbp)
+  8060ea:	00 
+    size_t pgsize = PAGE_SIZE;
+  8060eb:	48 c7 45 c8 00 10 00 	movq   $0x1000,-0x38(%rbp)
+  8060f2:	00 
+    struct OpenFile *o = serve_file_of(whom, req, fsreq);
+  8060f3:	49 8b 17             	mov    (%r15),%rdx
+  8060f6:	44 89 ee             	mov    %r13d,%esi
+  8060f9:	48 b8 ba 57 80 00 00 	movabs $0x8057ba,%rax
+  806100:	00 00 00 
+  806103:	ff d0                	call   *%rax
+  806105:	48 89 c3             	mov    %rax,%rbx
+    if (o) {
+  806108:	48 85 c0             	test   %rax,%rax
+  80610b:	74 13                	je     806120 <serve_worker+0x271>
+        while (o->o_busy) thread_yield();
+  80610d:	80 78 2c 00          	cmpb   $0x0,0x2c(%rax)
+  806111:	74 09                	je     80611c <serve_worker+0x26d>
+  806113:	41 ff d4             	call   *%r12
+  806116:	80 7b 2c 00          	cmpb   $0x0,0x2c(%rbx)
+  80611a:	75 f7                	jne    806113 <serve_worker+0x264>
+        o->o_busy = 1;
+  80611c:	c6 43 2c 01          	movb   $0x1,0x2c(%rbx)
+    if (req == FSREQ_OPEN) {
+  806120:	41 83 fd 01          	cmp    $0x1,%r13d
+  806124:	0f 84 b2 fd ff ff    	je     805edc <serve_worker+0x2d>
+    } else if (req == FSREQ_READ_MAP) {
+  80612a:	41 83 fd 0e          	cmp    $0xe,%r13d
+  80612e:	0f 84 c9 fd ff ff    	je     805efd <serve_worker+0x4e>
+    } else if (req == FSREQ_MAP) {
+  806134:	41 83 fd 0f          	cmp    $0xf,%r13d
+  806138:	0f 84 e4 fd ff ff    	je     805f22 <serve_worker+0x73>
+    } else if (req == FSREQ_CHANNEL) {
+  80613e:	41 83 fd 09          	cmp    $0x9,%r13d
+  806142:	0f 84 ff fd ff ff    	je     805f47 <serve_worker+0x98>
+    } else if (req < NHANDLERS && handlers[req]) {
+  806148:	41 83 fd 0d          	cmp    $0xd,%r13d
+  80614c:	0f 87 15 ff ff ff    	ja     806067 <serve_worker+0x1b8>
+  806152:	44 89 e8             	mov    %r13d,%eax
+  806155:	48 ba 20 d0 80 00 00 	movabs $0x80d020,%rdx
+  80615c:	00 00 00 
+  80615f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  806163:	48 85 c0             	test   %rax,%rax
+  806166:	0f 84 fb fe ff ff    	je     806067 <serve_worker+0x1b8>
+        res = handlers[req](whom, fsreq);
+  80616c:	49 8b 37             	mov    (%r15),%rsi
+  80616f:	8b 7d ac             	mov    -0x54(%rbp),%edi
+  806172:	ff d0                	call   *%rax
+  806174:	89 c6                	mov    %eax,%esi
+  806176:	e9 12 ff ff ff       	jmp    80608d <serve_worker+0x1de>
+    if (sz < FSCHAN_SIZE) return -E_INVAL;
+  80617b:	be fd ff ff ff       	mov    $0xfffffffd,%esi
+  806180:	e9 08 ff ff ff       	jmp    80608d <serve_worker+0x1de>
+
+0000000000806185 <serve>:
+    }
+    return resumed;
+}
+
+void
+serve(void) {
+  806185:	55                   	push   %rbp
+  806186:	48 89 e5             	mov    %rsp,%rbp
+  806189:	41 57                	push   %r15
+  80618b:	41 56                	push   %r14
+  80618d:	41 55                	push   %r13
+  80618f:	41 54                	push   %r12
+  806191:	53                   	push   %rbx
+  806192:	48 83 ec 68          	sub    $0x68,%rsp
+  806196:	48 bb 40 43 86 00 00 	movabs $0x864340,%rbx
+  80619d:	00 00 00 
+  8061a0:	41 bc 00 00 00 0c    	mov    $0xc000000,%r12d
+    for (size_t i = 0; i < SERVE_WORKERS; i++) {
+        struct serve_worker *w = &serve_workers[i];
+        w->w_req = FSREQ(i);
+        int res = thread_create(&w->w_thread, serve_worker, w);
+  8061a6:	49 be af 5e 80 00 00 	movabs $0x805eaf,%r14
+  8061ad:	00 00 00 
+  8061b0:	49 bd ff 67 80 00 00 	movabs $0x8067ff,%r13
+  8061b7:	00 00 00 
+        w->w_req = FSREQ(i);
+  8061ba:	4c 89 63 08          	mov    %r12,0x8(%rbx)
+        int res = thread_create(&w->w_thread, serve_worker, w);
+  8061be:	48 89 da             	mov    %rbx,%rdx
+  8061c1:	4c 89 f6             	mov    %r14,%rsi
+  8061c4:	48 89 df             	mov    %rbx,%rdi
+  8061c7:	41 ff d5             	call   *%r13
+  8061ca:	89 c1                	mov    %eax,%ecx
+        if (res < 0) panic("serve: thread_create failed: %i", res);
+  8061cc:	85 c0                	test   %eax,%eax
+  8061ce:	78 1f                	js     8061ef <serve+0x6a>
+    for (size_t i = 0; i < SERVE_WORKERS; i++) {
+  8061d0:	49 81 c4 00 00 02 00 	add    $0x20000,%r12
+  8061d7:	48 83 c3 30          	add    $0x30,%rbx
+  8061db:	48 b8 c0 44 86 00 00 	movabs $0x8644c0,%rax
+  8061e2:	00 00 00 
+  8061e5:	48 39 c3             	cmp    %rax,%rbx
+  8061e8:	75 d0                	jne    8061ba <serve+0x35>
+  8061ea:	e9 a1 02 00 00       	jmp    806490 <serve+0x30b>
+        if (res < 0) panic("serve: thread_create failed: %i", res);
+  8061ef:	48 ba 98 c0 80 00 00 	movabs $0x80c098,%rdx
+  8061f6:	00 00 00 
+  8061f9:	be 44 03 00 00       	mov    $0x344,%esi
+  8061fe:	48 bf e5 c0 80 00 00 	movabs $0x80c0e5,%rdi
+  806205:	00 00 00 
+  806208:	b8 00 00 00 00       	mov    $0x0,%eax
+  80620d:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806214:	00 00 00 
+  806217:	41 ff d0             	call   *%r8
+    struct OpenFile *o = FSCHAN_TYPE(type) ? serve_file_of(fschan_client[i], type, &ipc) : NULL;
+  80621a:	41 8b 3e             	mov    (%r14),%edi
+  80621d:	48 ba 00 32 86 00 00 	movabs $0x863200,%rdx
+  806224:	00 00 00 
+  806227:	89 de                	mov    %ebx,%esi
+  806229:	48 b8 ba 57 80 00 00 	movabs $0x8057ba,%rax
+  806230:	00 00 00 
+  806233:	ff d0                	call   *%rax
+    if (o && o->o_busy) return 0;
+  806235:	48 85 c0             	test   %rax,%rax
+  806238:	0f 84 6c 01 00 00    	je     8063aa <serve+0x225>
+  80623e:	80 78 2c 00          	cmpb   $0x0,0x2c(%rax)
+  806242:	0f 84 62 01 00 00    	je     8063aa <serve+0x225>
+            fschan_blocked[i] = 1;
+  806248:	48 8b 5d 98          	mov    -0x68(%rbp),%rbx
+  80624c:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  806250:	4d 89 f7             	mov    %r14,%r15
+  806253:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+  806257:	4c 8b 65 88          	mov    -0x78(%rbp),%r12
+  80625b:	41 c6 04 24 01       	movb   $0x1,(%r12)
+            break;
+  806260:	e9 cc 01 00 00       	jmp    806431 <serve+0x2ac>
+    else if (FSCHAN_TYPE(type) && handlers[type])
+  806265:	45 84 ff             	test   %r15b,%r15b
+  806268:	0f 85 a4 04 00 00    	jne    806712 <serve+0x58d>
+    if (chain && (type == FSREQ_READ || type == FSREQ_WRITE) &&
+  80626e:	45 85 ed             	test   %r13d,%r13d
+  806271:	0f 84 65 04 00 00    	je     8066dc <serve+0x557>
+  806277:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  80627d:	8d 43 fd             	lea    -0x3(%rbx),%eax
+  806280:	83 f8 01             	cmp    $0x1,%eax
+  806283:	0f 86 e5 04 00 00    	jbe    80676e <serve+0x5e9>
+    if (type == FSREQ_STAT && res >= 0)
+  806289:	83 fb 05             	cmp    $0x5,%ebx
+  80628c:	75 28                	jne    8062b6 <serve+0x131>
+  80628e:	45 85 e4             	test   %r12d,%r12d
+  806291:	78 23                	js     8062b6 <serve+0x131>
+        memcpy(resp->fm_data, &ipc.statRet, sizeof(ipc.statRet));
+  806293:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  806297:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80629b:	ba 88 00 00 00       	mov    $0x88,%edx
+  8062a0:	48 be 00 32 86 00 00 	movabs $0x863200,%rsi
+  8062a7:	00 00 00 
+  8062aa:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  8062b1:	00 00 00 
+  8062b4:	ff d0                	call   *%rax
+    resp->fm_type = type;
+  8062b6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8062ba:	89 18                	mov    %ebx,(%rax)
+    resp->fm_res = res;
+  8062bc:	44 89 60 04          	mov    %r12d,0x4(%rax)
+    memcpy(&resp->fm_req, &req->fm_req, sizeof(req->fm_req));
+  8062c0:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8062c4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8062c9:	48 8b b5 70 ff ff ff 	mov    -0x90(%rbp),%rsi
+  8062d0:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  8062d7:	00 00 00 
+  8062da:	ff d0                	call   *%rax
+        chan_release(&ch->fc_req);
+  8062dc:	48 8b 7d 80          	mov    -0x80(%rbp),%rdi
+  8062e0:	48 b8 bd b8 80 00 00 	movabs $0x80b8bd,%rax
+  8062e7:	00 00 00 
+  8062ea:	ff d0                	call   *%rax
+        if (chan_publish(&ch->fc_resp)) chan_notify(&ch->fc_resp);
+  8062ec:	48 8b bd 78 ff ff ff 	mov    -0x88(%rbp),%rdi
+  8062f3:	48 b8 6a b8 80 00 00 	movabs $0x80b86a,%rax
+  8062fa:	00 00 00 
+  8062fd:	ff d0                	call   *%rax
+  8062ff:	88 45 ae             	mov    %al,-0x52(%rbp)
+  806302:	84 c0                	test   %al,%al
+  806304:	0f 85 ef 00 00 00    	jne    8063f9 <serve+0x274>
+        served = 1;
+  80630a:	0f b6 45 af          	movzbl -0x51(%rbp),%eax
+  80630e:	88 45 ae             	mov    %al,-0x52(%rbp)
+    while ((req = chan_peek(&ch->fc_req)) && (resp = chan_prepare(&ch->fc_resp))) {
+  806311:	48 8b 5d a0          	mov    -0x60(%rbp),%rbx
+  806315:	48 8d 83 80 df ff ff 	lea    -0x2080(%rbx),%rax
+  80631c:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+  806320:	48 89 c7             	mov    %rax,%rdi
+  806323:	48 b8 96 b8 80 00 00 	movabs $0x80b896,%rax
+  80632a:	00 00 00 
+  80632d:	ff d0                	call   *%rax
+  80632f:	49 89 c4             	mov    %rax,%r12
+  806332:	48 85 c0             	test   %rax,%rax
+  806335:	0f 84 e7 00 00 00    	je     806422 <serve+0x29d>
+  80633b:	48 89 df             	mov    %rbx,%rdi
+  80633e:	48 89 9d 78 ff ff ff 	mov    %rbx,-0x88(%rbp)
+  806345:	48 b8 45 b8 80 00 00 	movabs $0x80b845,%rax
+  80634c:	00 00 00 
+  80634f:	ff d0                	call   *%rax
+  806351:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  806355:	48 85 c0             	test   %rax,%rax
+  806358:	0f 84 b3 00 00 00    	je     806411 <serve+0x28c>
+    uint32_t type = req->fm_type;
+  80635e:	41 8b 1c 24          	mov    (%r12),%ebx
+    uint32_t chain = req->fm_chain;
+  806362:	45 8b 6c 24 08       	mov    0x8(%r12),%r13d
+    memcpy(&ipc, &req->fm_req, sizeof(req->fm_req));
+  806367:	49 8d 44 24 10       	lea    0x10(%r12),%rax
+  80636c:	48 89 85 70 ff ff ff 	mov    %rax,-0x90(%rbp)
+  806373:	ba 10 00 00 00       	mov    $0x10,%edx
+  806378:	48 89 c6             	mov    %rax,%rsi
+  80637b:	48 bf 00 32 86 00 00 	movabs $0x863200,%rdi
+  806382:	00 00 00 
+  806385:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  80638c:	00 00 00 
+  80638f:	ff d0                	call   *%rax
+    struct OpenFile *o = FSCHAN_TYPE(type) ? serve_file_of(fschan_client[i], type, &ipc) : NULL;
+  806391:	8d 43 fe             	lea    -0x2(%rbx),%eax
+  806394:	83 f8 04             	cmp    $0x4,%eax
+  806397:	41 0f 96 c7          	setbe  %r15b
+  80639b:	83 fb 0d             	cmp    $0xd,%ebx
+  80639e:	0f 94 c0             	sete   %al
+  8063a1:	41 08 c7             	or     %al,%r15b
+  8063a4:	0f 85 70 fe ff ff    	jne    80621a <serve+0x95>
+        fsdata = req->fm_data;
+  8063aa:	49 83 c4 20          	add    $0x20,%r12
+  8063ae:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8063b2:	48 83 c0 20          	add    $0x20,%rax
+  8063b6:	83 fb 04             	cmp    $0x4,%ebx
+  8063b9:	49 0f 44 c4          	cmove  %r12,%rax
+  8063bd:	48 a3 e8 31 86 00 00 	movabs %rax,0x8631e8
+  8063c4:	00 00 00 
+        fsdata_size = FSCHAN_DATA_SIZE;
+  8063c7:	48 b8 e0 31 86 00 00 	movabs $0x8631e0,%rax
+  8063ce:	00 00 00 
+  8063d1:	48 c7 00 e0 01 00 00 	movq   $0x1e0,(%rax)
+    if (chain && chain == fschan_failed[i])
+  8063d8:	45 85 ed             	test   %r13d,%r13d
+  8063db:	0f 84 22 03 00 00    	je     806703 <serve+0x57e>
+  8063e1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8063e5:	44 3b 28             	cmp    (%rax),%r13d
+  8063e8:	0f 85 77 fe ff ff    	jne    806265 <serve+0xe0>
+        res = -E_AGAIN;
+  8063ee:	41 bc ec ff ff ff    	mov    $0xffffffec,%r12d
+  8063f4:	e9 84 fe ff ff       	jmp    80627d <serve+0xf8>
+        if (chan_publish(&ch->fc_resp)) chan_notify(&ch->fc_resp);
+  8063f9:	48 8b bd 78 ff ff ff 	mov    -0x88(%rbp),%rdi
+  806400:	48 b8 50 b9 80 00 00 	movabs $0x80b950,%rax
+  806407:	00 00 00 
+  80640a:	ff d0                	call   *%rax
+  80640c:	e9 00 ff ff ff       	jmp    806311 <serve+0x18c>
+  806411:	48 8b 5d 98          	mov    -0x68(%rbp),%rbx
+  806415:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  806419:	4d 89 f7             	mov    %r14,%r15
+  80641c:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+  806420:	eb 0f                	jmp    806431 <serve+0x2ac>
+  806422:	48 8b 5d 98          	mov    -0x68(%rbp),%rbx
+  806426:	4c 8b 6d 90          	mov    -0x70(%rbp),%r13
+  80642a:	4d 89 f7             	mov    %r14,%r15
+  80642d:	4c 8b 75 b0          	mov    -0x50(%rbp),%r14
+            if (fschan_used[i]) served |= serve_channel_reqs(i);
+  806431:	0f b6 4d ae          	movzbl -0x52(%rbp),%ecx
+  806435:	08 4d ad             	or     %cl,-0x53(%rbp)
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+  806438:	48 83 c3 01          	add    $0x1,%rbx
+  80643c:	49 83 c5 01          	add    $0x1,%r13
+  806440:	48 81 45 a0 00 00 01 	addq   $0x10000,-0x60(%rbp)
+  806447:	00 
+  806448:	49 83 c6 04          	add    $0x4,%r14
+  80644c:	49 83 c7 04          	add    $0x4,%r15
+  806450:	48 b8 40 43 86 00 00 	movabs $0x864340,%rax
+  806457:	00 00 00 
+  80645a:	48 39 c3             	cmp    %rax,%rbx
+  80645d:	74 2b                	je     80648a <serve+0x305>
+            if (fschan_used[i]) served |= serve_channel_reqs(i);
+  80645f:	0f b6 03             	movzbl (%rbx),%eax
+  806462:	88 45 af             	mov    %al,-0x51(%rbp)
+  806465:	84 c0                	test   %al,%al
+  806467:	74 cf                	je     806438 <serve+0x2b3>
+    fschan_blocked[i] = 0;
+  806469:	41 c6 45 00 00       	movb   $0x0,0x0(%r13)
+    bool served = 0;
+  80646e:	c6 45 ae 00          	movb   $0x0,-0x52(%rbp)
+  806472:	48 89 5d 98          	mov    %rbx,-0x68(%rbp)
+  806476:	4c 89 6d 90          	mov    %r13,-0x70(%rbp)
+  80647a:	4c 89 75 b0          	mov    %r14,-0x50(%rbp)
+  80647e:	4d 89 fe             	mov    %r15,%r14
+  806481:	4c 89 6d 88          	mov    %r13,-0x78(%rbp)
+    while ((req = chan_peek(&ch->fc_req)) && (resp = chan_prepare(&ch->fc_resp))) {
+  806485:	e9 87 fe ff ff       	jmp    806311 <serve+0x18c>
+        if (served) {
+  80648a:	80 7d ad 00          	cmpb   $0x0,-0x53(%rbp)
+  80648e:	74 45                	je     8064d5 <serve+0x350>
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+  806490:	49 bc 20 43 86 00 00 	movabs $0x864320,%r12
+  806497:	00 00 00 
+  80649a:	49 bf 00 42 86 00 00 	movabs $0x864200,%r15
+  8064a1:	00 00 00 
+  8064a4:	49 bd 20 42 86 00 00 	movabs $0x864220,%r13
+  8064ab:	00 00 00 
+  8064ae:	49 be a0 42 86 00 00 	movabs $0x8642a0,%r14
+  8064b5:	00 00 00 
+serve(void) {
+  8064b8:	48 c7 45 a0 c0 20 00 	movq   $0xf0020c0,-0x60(%rbp)
+  8064bf:	0f 
+        bool served = 0;
+  8064c0:	c6 45 ad 00          	movb   $0x0,-0x53(%rbp)
+    while ((req = chan_peek(&ch->fc_req)) && (resp = chan_prepare(&ch->fc_resp))) {
+  8064c4:	4c 89 e3             	mov    %r12,%rbx
+  8064c7:	4c 89 f0             	mov    %r14,%rax
+  8064ca:	4d 89 ee             	mov    %r13,%r14
+  8064cd:	4d 89 fd             	mov    %r15,%r13
+  8064d0:	49 89 c7             	mov    %rax,%r15
+  8064d3:	eb 8a                	jmp    80645f <serve+0x2da>
+        idle = 1;
+  8064d5:	41 be 01 00 00 00    	mov    $0x1,%r14d
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+  8064db:	bb 00 00 00 00       	mov    $0x0,%ebx
+            if (fschan_used[i] && !fschan_blocked[i] && !chan_arm(&FSCHAN(i)->fc_req)) idle = 0;
+  8064e0:	4c 8d 60 e0          	lea    -0x20(%rax),%r12
+  8064e4:	49 bd 00 42 86 00 00 	movabs $0x864200,%r13
+  8064eb:	00 00 00 
+  8064ee:	49 bf c5 b8 80 00 00 	movabs $0x80b8c5,%r15
+  8064f5:	00 00 00 
+  8064f8:	eb 21                	jmp    80651b <serve+0x396>
+  8064fa:	48 89 df             	mov    %rbx,%rdi
+  8064fd:	48 c1 e7 10          	shl    $0x10,%rdi
+  806501:	48 81 c7 40 00 00 0f 	add    $0xf000040,%rdi
+  806508:	41 ff d7             	call   *%r15
+  80650b:	84 c0                	test   %al,%al
+  80650d:	44 0f 44 f0          	cmove  %eax,%r14d
+        for (size_t i = 0; i < FSCHAN_MAX; i++)
+  806511:	48 83 c3 01          	add    $0x1,%rbx
+  806515:	48 83 fb 20          	cmp    $0x20,%rbx
+  806519:	74 11                	je     80652c <serve+0x3a7>
+            if (fschan_used[i] && !fschan_blocked[i] && !chan_arm(&FSCHAN(i)->fc_req)) idle = 0;
+  80651b:	41 80 3c 1c 00       	cmpb   $0x0,(%r12,%rbx,1)
+  806520:	74 ef                	je     806511 <serve+0x38c>
+  806522:	41 80 7c 1d 00 00    	cmpb   $0x0,0x0(%r13,%rbx,1)
+  806528:	75 e7                	jne    806511 <serve+0x38c>
+  80652a:	eb ce                	jmp    8064fa <serve+0x375>
+    } while (!idle);
+  80652c:	45 84 f6             	test   %r14b,%r14b
+  80652f:	0f 84 5b ff ff ff    	je     806490 <serve+0x30b>
+    }
+
+    while (1) {
+        serve_channels();
+        bc_writeback_maybe();
+  806535:	48 b8 eb 24 80 00 00 	movabs $0x8024eb,%rax
+  80653c:	00 00 00 
+  80653f:	ff d0                	call   *%rax
+
+        /* The interrupt counter is read before the disk is checked, so
+         * an interrupt coming in between ends the wait below at once */
+        int irq = disk->irq();
+  806541:	48 a1 08 d0 80 00 00 	movabs 0x80d008,%rax
+  806548:	00 00 00 
+  80654b:	ff 50 28             	call   *0x28(%rax)
+        const volatile uint32_t *intr = irq >= 0 ? (const volatile uint32_t *)&vsys[VSYS_irq + irq] : NULL;
+  80654e:	85 c0                	test   %eax,%eax
+  806550:	78 42                	js     806594 <serve+0x40f>
+  806552:	83 c0 01             	add    $0x1,%eax
+  806555:	48 98                	cltq
+  806557:	48 ba 00 f0 bf 1f 80 	movabs $0x801fbff000,%rdx
+  80655e:	00 00 00 
+  806561:	4c 8d 2c 82          	lea    (%rdx,%rax,4),%r13
+        uint32_t seen = intr ? *intr : 0;
+  806565:	45 8b 75 00          	mov    0x0(%r13),%r14d
+        bool busy = bc_busy();
+  806569:	48 b8 52 15 80 00 00 	movabs $0x801552,%rax
+  806570:	00 00 00 
+  806573:	ff d0                	call   *%rax
+  806575:	89 c1                	mov    %eax,%ecx
+        if (!busy && serve_resume()) continue;
+  806577:	84 c0                	test   %al,%al
+  806579:	75 5b                	jne    8065d6 <serve+0x451>
+  80657b:	48 bb 40 43 86 00 00 	movabs $0x864340,%rbx
+  806582:	00 00 00 
+        serve_run(&serve_workers[i]);
+  806585:	49 bf d9 52 80 00 00 	movabs $0x8052d9,%r15
+  80658c:	00 00 00 
+  80658f:	88 45 b8             	mov    %al,-0x48(%rbp)
+  806592:	eb 21                	jmp    8065b5 <serve+0x430>
+        const volatile uint32_t *intr = irq >= 0 ? (const volatile uint32_t *)&vsys[VSYS_irq + irq] : NULL;
+  806594:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        uint32_t seen = intr ? *intr : 0;
+  80659a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+  8065a0:	eb c7                	jmp    806569 <serve+0x3e4>
+    for (size_t i = 0; i < SERVE_WORKERS; i++) {
+  8065a2:	48 83 c3 30          	add    $0x30,%rbx
+  8065a6:	48 b9 c0 44 86 00 00 	movabs $0x8644c0,%rcx
+  8065ad:	00 00 00 
+  8065b0:	48 39 cb             	cmp    %rcx,%rbx
+  8065b3:	74 15                	je     8065ca <serve+0x445>
+        if (!serve_workers[i].w_busy) continue;
+  8065b5:	44 0f b6 63 28       	movzbl 0x28(%rbx),%r12d
+  8065ba:	45 84 e4             	test   %r12b,%r12b
+  8065bd:	74 e3                	je     8065a2 <serve+0x41d>
+        serve_run(&serve_workers[i]);
+  8065bf:	48 89 df             	mov    %rbx,%rdi
+  8065c2:	41 ff d7             	call   *%r15
+        resumed = 1;
+  8065c5:	44 89 e0             	mov    %r12d,%eax
+  8065c8:	eb d8                	jmp    8065a2 <serve+0x41d>
+        if (!busy && serve_resume()) continue;
+  8065ca:	0f b6 4d b8          	movzbl -0x48(%rbp),%ecx
+  8065ce:	84 c0                	test   %al,%al
+  8065d0:	0f 85 ba fe ff ff    	jne    806490 <serve+0x30b>
+
+        struct serve_worker *w = NULL;
+        for (size_t i = 0; i < SERVE_WORKERS && !w; i++)
+  8065d6:	48 ba 68 43 86 00 00 	movabs $0x864368,%rdx
+  8065dd:	00 00 00 
+  8065e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8065e5:	eb 12                	jmp    8065f9 <serve+0x474>
+  8065e7:	48 83 c0 01          	add    $0x1,%rax
+  8065eb:	48 83 c2 30          	add    $0x30,%rdx
+  8065ef:	48 83 f8 08          	cmp    $0x8,%rax
+  8065f3:	0f 84 ee 00 00 00    	je     8066e7 <serve+0x562>
+            if (!serve_workers[i].w_busy) w = &serve_workers[i];
+  8065f9:	80 3a 00             	cmpb   $0x0,(%rdx)
+  8065fc:	75 e9                	jne    8065e7 <serve+0x462>
+  8065fe:	48 8d 1c 40          	lea    (%rax,%rax,2),%rbx
+  806602:	48 c1 e3 04          	shl    $0x4,%rbx
+  806606:	48 b8 40 43 86 00 00 	movabs $0x864340,%rax
+  80660d:	00 00 00 
+  806610:	48 01 c3             	add    %rax,%rbx
+            continue;
+        }
+
+        /* Wake up for the disk too while it is busy */
+        envid_t whom;
+        w->w_perm = 0;
+  806613:	c7 43 18 00 00 00 00 	movl   $0x0,0x18(%rbx)
+        w->w_size = PAGE_SIZE + FSIPC_DATA_SIZE;
+  80661a:	48 c7 43 20 00 10 01 	movq   $0x11000,0x20(%rbx)
+  806621:	00 
+        int32_t req = ipc_recv_futex(&whom, w->w_req, &w->w_size, &w->w_perm,
+  806622:	84 c9                	test   %cl,%cl
+  806624:	b8 00 00 00 00       	mov    $0x0,%eax
+  806629:	4c 0f 44 e8          	cmove  %rax,%r13
+  80662d:	48 8d 4b 18          	lea    0x18(%rbx),%rcx
+  806631:	48 8d 53 20          	lea    0x20(%rbx),%rdx
+  806635:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+  806639:	48 83 ec 08          	sub    $0x8,%rsp
+  80663d:	6a 64                	push   $0x64
+  80663f:	45 89 f1             	mov    %r14d,%r9d
+  806642:	4d 89 e8             	mov    %r13,%r8
+  806645:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  806649:	48 b8 55 8a 80 00 00 	movabs $0x808a55,%rax
+  806650:	00 00 00 
+  806653:	ff d0                	call   *%rax
+                                     busy ? intr : NULL, seen, SERVE_IO_TIMEOUT);
+        if (req == -E_AGAIN || req == -E_TIMEOUT) continue;
+  806655:	8d 50 15             	lea    0x15(%rax),%edx
+  806658:	48 83 c4 10          	add    $0x10,%rsp
+  80665c:	83 fa 01             	cmp    $0x1,%edx
+  80665f:	0f 86 2b fe ff ff    	jbe    806490 <serve+0x30b>
+                    req, whom, (unsigned long)get_uvpt_entry(w->w_req),
+                    (char *)w->w_req);
+        }
+
+        /* Doorbells only wake us up to serve the channels */
+        if (req == FSREQ_DOORBELL) {
+  806665:	83 f8 0a             	cmp    $0xa,%eax
+  806668:	74 27                	je     806691 <serve+0x50c>
+            if (w->w_perm) sys_unmap_region(0, w->w_req, w->w_size);
+            continue;
+        }
+
+        /* All requests must contain an argument page */
+        if (!(w->w_perm & PROT_R)) {
+  80666a:	f6 43 18 04          	testb  $0x4,0x18(%rbx)
+  80666e:	74 49                	je     8066b9 <serve+0x534>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+            continue; /* Just leave it hanging... */
+        }
+
+        w->w_type = req;
+  806670:	89 43 10             	mov    %eax,0x10(%rbx)
+        w->w_whom = whom;
+  806673:	8b 45 cc             	mov    -0x34(%rbp),%eax
+  806676:	89 43 14             	mov    %eax,0x14(%rbx)
+        w->w_busy = 1;
+  806679:	c6 43 28 01          	movb   $0x1,0x28(%rbx)
+        serve_run(w);
+  80667d:	48 89 df             	mov    %rbx,%rdi
+  806680:	48 b8 d9 52 80 00 00 	movabs $0x8052d9,%rax
+  806687:	00 00 00 
+  80668a:	ff d0                	call   *%rax
+  80668c:	e9 ff fd ff ff       	jmp    806490 <serve+0x30b>
+            if (w->w_perm) sys_unmap_region(0, w->w_req, w->w_size);
+  806691:	83 7b 18 00          	cmpl   $0x0,0x18(%rbx)
+  806695:	0f 84 f5 fd ff ff    	je     806490 <serve+0x30b>
+  80669b:	48 8b 53 20          	mov    0x20(%rbx),%rdx
+  80669f:	48 8b 73 08          	mov    0x8(%rbx),%rsi
+  8066a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8066a8:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8066af:	00 00 00 
+  8066b2:	ff d0                	call   *%rax
+  8066b4:	e9 d7 fd ff ff       	jmp    806490 <serve+0x30b>
+            cprintf("Invalid request from %08x: no argument page\n", whom);
+  8066b9:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  8066bc:	48 bf b8 c0 80 00 00 	movabs $0x80c0b8,%rdi
+  8066c3:	00 00 00 
+  8066c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8066cb:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  8066d2:	00 00 00 
+  8066d5:	ff d2                	call   *%rdx
+            continue; /* Just leave it hanging... */
+  8066d7:	e9 b4 fd ff ff       	jmp    806490 <serve+0x30b>
+    if (chain && (type == FSREQ_READ || type == FSREQ_WRITE) &&
+  8066dc:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  8066e2:	e9 cf fb ff ff       	jmp    8062b6 <serve+0x131>
+            sys_futex_wait(intr, seen, SERVE_IO_TIMEOUT);
+  8066e7:	ba 64 00 00 00       	mov    $0x64,%edx
+  8066ec:	44 89 f6             	mov    %r14d,%esi
+  8066ef:	4c 89 ef             	mov    %r13,%rdi
+  8066f2:	48 b8 c3 86 80 00 00 	movabs $0x8086c3,%rax
+  8066f9:	00 00 00 
+  8066fc:	ff d0                	call   *%rax
+            continue;
+  8066fe:	e9 8d fd ff ff       	jmp    806490 <serve+0x30b>
+    else if (FSCHAN_TYPE(type) && handlers[type])
+  806703:	41 bc fd ff ff ff    	mov    $0xfffffffd,%r12d
+  806709:	45 84 ff             	test   %r15b,%r15b
+  80670c:	0f 84 a4 fb ff ff    	je     8062b6 <serve+0x131>
+  806712:	89 d8                	mov    %ebx,%eax
+  806714:	48 ba 20 d0 80 00 00 	movabs $0x80d020,%rdx
+  80671b:	00 00 00 
+  80671e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  806722:	48 85 c0             	test   %rax,%rax
+  806725:	0f 84 43 fb ff ff    	je     80626e <serve+0xe9>
+        res = handlers[type](fschan_client[i], &ipc);
+  80672b:	41 8b 3e             	mov    (%r14),%edi
+  80672e:	48 be 00 32 86 00 00 	movabs $0x863200,%rsi
+  806735:	00 00 00 
+  806738:	ff d0                	call   *%rax
+  80673a:	41 89 c4             	mov    %eax,%r12d
+    if (chain && (type == FSREQ_READ || type == FSREQ_WRITE) &&
+  80673d:	45 85 ed             	test   %r13d,%r13d
+  806740:	0f 84 43 fb ff ff    	je     806289 <serve+0x104>
+  806746:	8d 43 fd             	lea    -0x3(%rbx),%eax
+  806749:	83 f8 01             	cmp    $0x1,%eax
+  80674c:	0f 87 37 fb ff ff    	ja     806289 <serve+0x104>
+  806752:	45 85 e4             	test   %r12d,%r12d
+  806755:	78 17                	js     80676e <serve+0x5e9>
+        (res < 0 || (size_t)res < ipc.read.req_n))
+  806757:	49 63 c4             	movslq %r12d,%rax
+  80675a:	48 b9 00 32 86 00 00 	movabs $0x863200,%rcx
+  806761:	00 00 00 
+  806764:	48 3b 41 08          	cmp    0x8(%rcx),%rax
+  806768:	0f 83 48 fb ff ff    	jae    8062b6 <serve+0x131>
+        fschan_failed[i] = chain;
+  80676e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  806772:	44 89 28             	mov    %r13d,(%rax)
+  806775:	e9 3c fb ff ff       	jmp    8062b6 <serve+0x131>
+
+000000000080677a <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  80677a:	55                   	push   %rbp
+  80677b:	48 89 e5             	mov    %rsp,%rbp
+  80677e:	53                   	push   %rbx
+  80677f:	48 83 ec 08          	sub    $0x8,%rsp
+    static_assert(sizeof(struct File) == 256, "Unsupported file size");
+    static_assert(sizeof(struct Fsmsg) <= CHAN_MSG_SIZE, "Invalid channel message size");
+    binaryname = "fs";
+  806783:	48 b8 ef c0 80 00 00 	movabs $0x80c0ef,%rax
+  80678a:	00 00 00 
+  80678d:	48 a3 a0 30 81 00 00 	movabs %rax,0x8130a0
+  806794:	00 00 00 
+    cprintf("FS is running\n");
+  806797:	48 bf f2 c0 80 00 00 	movabs $0x80c0f2,%rdi
+  80679e:	00 00 00 
+  8067a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067a6:	48 bb d1 74 80 00 00 	movabs $0x8074d1,%rbx
+  8067ad:	00 00 00 
+  8067b0:	ff d3                	call   *%rbx
+    asm volatile("outw %0,%w1" ::"a"(data), "d"(port));
+  8067b2:	b8 00 8a ff ff       	mov    $0xffff8a00,%eax
+  8067b7:	ba 00 8a 00 00       	mov    $0x8a00,%edx
+  8067bc:	66 ef                	out    %ax,(%dx)
+
+    /* Check that we are able to do I/O */
+    outw(0x8A00, 0x8A00);
+    cprintf("FS can do I/O\n");
+  8067be:	48 bf 01 c1 80 00 00 	movabs $0x80c101,%rdi
+  8067c5:	00 00 00 
+  8067c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8067cd:	ff d3                	call   *%rbx
+
+    assert(FSCHAN_SIZE <= FSCHAN_STRIDE);
+    assert(PAGE_SIZE + FSIPC_DATA_SIZE <= FSREQ_STRIDE - PAGE_SIZE);
+
+    serve_init();
+  8067cf:	48 b8 2c 53 80 00 00 	movabs $0x80532c,%rax
+  8067d6:	00 00 00 
+  8067d9:	ff d0                	call   *%rax
+    fs_init();
+  8067db:	48 b8 6b 2e 80 00 00 	movabs $0x802e6b,%rax
+  8067e2:	00 00 00 
+  8067e5:	ff d0                	call   *%rax
+    fs_test();
+  8067e7:	48 b8 73 6b 80 00 00 	movabs $0x806b73,%rax
+  8067ee:	00 00 00 
+  8067f1:	ff d0                	call   *%rax
+    serve();
+  8067f3:	48 b8 85 61 80 00 00 	movabs $0x806185,%rax
+  8067fa:	00 00 00 
+  8067fd:	ff d0                	call   *%rax
+
+00000000008067ff <thread_create>:
+
+/* Create a thread that calls entry(arg) when it is first run.
+ * entry must never return. Returns 0 on success, < 0 on error */
+int
+thread_create(struct Thread **pt, void (*entry)(void *), void *arg) {
+    if (nthreads == THREAD_MAX) return -E_NO_MEM;
+  8067ff:	48 a1 d0 44 86 00 00 	movabs 0x8644d0,%rax
+  806806:	00 00 00 
+  806809:	48 83 f8 10          	cmp    $0x10,%rax
+  80680d:	0f 84 af 00 00 00    	je     8068c2 <thread_create+0xc3>
+thread_create(struct Thread **pt, void (*entry)(void *), void *arg) {
+  806813:	55                   	push   %rbp
+  806814:	48 89 e5             	mov    %rsp,%rbp
+  806817:	41 56                	push   %r14
+  806819:	41 55                	push   %r13
+  80681b:	41 54                	push   %r12
+  80681d:	53                   	push   %rbx
+  80681e:	49 89 fc             	mov    %rdi,%r12
+  806821:	49 89 f5             	mov    %rsi,%r13
+  806824:	49 89 d6             	mov    %rdx,%r14
+
+    uintptr_t stack = THREAD_STACK_VA + nthreads * THREAD_STACK_STRIDE;
+  806827:	48 8d 98 80 0c 00 00 	lea    0xc80(%rax),%rbx
+  80682e:	48 c1 e3 10          	shl    $0x10,%rbx
+    int res = sys_alloc_region(0, (void *)stack, THREAD_STACK_SIZE, PROT_RW);
+  806832:	b9 06 00 00 00       	mov    $0x6,%ecx
+  806837:	ba 00 80 00 00       	mov    $0x8000,%edx
+  80683c:	48 89 de             	mov    %rbx,%rsi
+  80683f:	bf 00 00 00 00       	mov    $0x0,%edi
+  806844:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80684b:	00 00 00 
+  80684e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  806850:	85 c0                	test   %eax,%eax
+  806852:	78 65                	js     8068b9 <thread_create+0xba>
+
+    /* Registers popped by thread_switch, r12 and r13
+     * tell thread_start what to call */
+    uintptr_t *sp = (uintptr_t *)(stack + THREAD_STACK_SIZE) - 7;
+  806854:	48 81 c3 c8 7f 00 00 	add    $0x7fc8,%rbx
+    memset(sp, 0, 7 * sizeof(*sp));
+  80685b:	ba 38 00 00 00       	mov    $0x38,%edx
+  806860:	be 00 00 00 00       	mov    $0x0,%esi
+  806865:	48 89 df             	mov    %rbx,%rdi
+  806868:	48 b8 42 7f 80 00 00 	movabs $0x807f42,%rax
+  80686f:	00 00 00 
+  806872:	ff d0                	call   *%rax
+    sp[2] = (uintptr_t)arg;   /* r13 */
+  806874:	4c 89 73 10          	mov    %r14,0x10(%rbx)
+    sp[3] = (uintptr_t)entry; /* r12 */
+  806878:	4c 89 6b 18          	mov    %r13,0x18(%rbx)
+    sp[6] = (uintptr_t)thread_start;
+  80687c:	48 b8 d5 69 80 00 00 	movabs $0x8069d5,%rax
+  806883:	00 00 00 
+  806886:	48 89 43 30          	mov    %rax,0x30(%rbx)
+
+    struct Thread *t = &threads[nthreads++];
+  80688a:	48 ba d0 44 86 00 00 	movabs $0x8644d0,%rdx
+  806891:	00 00 00 
+  806894:	48 8b 02             	mov    (%rdx),%rax
+  806897:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80689b:	48 89 0a             	mov    %rcx,(%rdx)
+    t->t_rsp = (uintptr_t)sp;
+  80689e:	48 ba e0 44 86 00 00 	movabs $0x8644e0,%rdx
+  8068a5:	00 00 00 
+  8068a8:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+    struct Thread *t = &threads[nthreads++];
+  8068ac:	48 8d 04 c2          	lea    (%rdx,%rax,8),%rax
+  8068b0:	49 89 04 24          	mov    %rax,(%r12)
+    *pt = t;
+    return 0;
+  8068b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8068b9:	5b                   	pop    %rbx
+  8068ba:	41 5c                	pop    %r12
+  8068bc:	41 5d                	pop    %r13
+  8068be:	41 5e                	pop    %r14
+  8068c0:	5d                   	pop    %rbp
+  8068c1:	c3                   	ret
+    if (nthreads == THREAD_MAX) return -E_NO_MEM;
+  8068c2:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+}
+  8068c7:	c3                   	ret
+
+00000000008068c8 <thread_run>:
+
+/* Run t until it yields. Called from the main loop only */
+void
+thread_run(struct Thread *t) {
+  8068c8:	55                   	push   %rbp
+  8068c9:	48 89 e5             	mov    %rsp,%rbp
+  8068cc:	53                   	push   %rbx
+  8068cd:	48 83 ec 08          	sub    $0x8,%rsp
+    assert(!thread_cur);
+  8068d1:	48 b8 c8 44 86 00 00 	movabs $0x8644c8,%rax
+  8068d8:	00 00 00 
+  8068db:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8068df:	75 33                	jne    806914 <thread_run+0x4c>
+
+    thread_cur = t;
+  8068e1:	48 bb c8 44 86 00 00 	movabs $0x8644c8,%rbx
+  8068e8:	00 00 00 
+  8068eb:	48 89 3b             	mov    %rdi,(%rbx)
+    thread_switch(&thread_main_rsp, t->t_rsp);
+  8068ee:	48 8b 37             	mov    (%rdi),%rsi
+  8068f1:	48 bf c0 44 86 00 00 	movabs $0x8644c0,%rdi
+  8068f8:	00 00 00 
+  8068fb:	48 b8 ba 69 80 00 00 	movabs $0x8069ba,%rax
+  806902:	00 00 00 
+  806905:	ff d0                	call   *%rax
+    thread_cur = NULL;
+  806907:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+}
+  80690e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806912:	c9                   	leave
+  806913:	c3                   	ret
+    assert(!thread_cur);
+  806914:	48 b9 10 c1 80 00 00 	movabs $0x80c110,%rcx
+  80691b:	00 00 00 
+  80691e:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  806925:	00 00 00 
+  806928:	be 3c 00 00 00       	mov    $0x3c,%esi
+  80692d:	48 bf 1c c1 80 00 00 	movabs $0x80c11c,%rdi
+  806934:	00 00 00 
+  806937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80693c:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806943:	00 00 00 
+  806946:	41 ff d0             	call   *%r8
+
+0000000000806949 <thread_yield>:
+
+/* Switch back to the main loop, which resumes
+ * the thread with thread_run() later */
+void
+thread_yield(void) {
+  806949:	55                   	push   %rbp
+  80694a:	48 89 e5             	mov    %rsp,%rbp
+    struct Thread *t = thread_cur;
+  80694d:	48 b8 c8 44 86 00 00 	movabs $0x8644c8,%rax
+  806954:	00 00 00 
+  806957:	48 8b 38             	mov    (%rax),%rdi
+    assert(t);
+  80695a:	48 85 ff             	test   %rdi,%rdi
+  80695d:	74 1b                	je     80697a <thread_yield+0x31>
+
+    thread_switch(&t->t_rsp, thread_main_rsp);
+  80695f:	48 b8 c0 44 86 00 00 	movabs $0x8644c0,%rax
+  806966:	00 00 00 
+  806969:	48 8b 30             	mov    (%rax),%rsi
+  80696c:	48 b8 ba 69 80 00 00 	movabs $0x8069ba,%rax
+  806973:	00 00 00 
+  806976:	ff d0                	call   *%rax
+}
+  806978:	5d                   	pop    %rbp
+  806979:	c3                   	ret
+    assert(t);
+  80697a:	48 b9 89 c4 80 00 00 	movabs $0x80c489,%rcx
+  806981:	00 00 00 
+  806984:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  80698b:	00 00 00 
+  80698e:	be 48 00 00 00       	mov    $0x48,%esi
+  806993:	48 bf 1c c1 80 00 00 	movabs $0x80c11c,%rdi
+  80699a:	00 00 00 
+  80699d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8069a2:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8069a9:	00 00 00 
+  8069ac:	41 ff d0             	call   *%r8
+
+00000000008069af <thread_current>:
+
+/* Running thread, NULL if called from the main loop */
+struct Thread *
+thread_current(void) {
+    return thread_cur;
+}
+  8069af:	48 a1 c8 44 86 00 00 	movabs 0x8644c8,%rax
+  8069b6:	00 00 00 
+  8069b9:	c3                   	ret
+
+00000000008069ba <thread_switch>:
+#
+# Save the callee-saved registers on the current stack and its
+# pointer in *save_rsp, then continue on the stack at rsp.
+.globl thread_switch
+thread_switch:
+    pushq %rbp
+  8069ba:	55                   	push   %rbp
+    pushq %rbx
+  8069bb:	53                   	push   %rbx
+    pushq %r12
+  8069bc:	41 54                	push   %r12
+    pushq %r13
+  8069be:	41 55                	push   %r13
+    pushq %r14
+  8069c0:	41 56                	push   %r14
+    pushq %r15
+  8069c2:	41 57                	push   %r15
+    movq %rsp, (%rdi)
+  8069c4:	48 89 27             	mov    %rsp,(%rdi)
+    movq %rsi, %rsp
+  8069c7:	48 89 f4             	mov    %rsi,%rsp
+    popq %r15
+  8069ca:	41 5f                	pop    %r15
+    popq %r14
+  8069cc:	41 5e                	pop    %r14
+    popq %r13
+  8069ce:	41 5d                	pop    %r13
+    popq %r12
+  8069d0:	41 5c                	pop    %r12
+    popq %rbx
+  8069d2:	5b                   	pop    %rbx
+    popq %rbp
+  8069d3:	5d                   	pop    %rbp
+    ret
+  8069d4:	c3                   	ret
+
+00000000008069d5 <thread_start>:
+# First code a new thread runs, thread_create() leaves the entry
+# function in r12 and its argument in r13. The stack is aligned
+# to 16 bytes here, as the call requires.
+.globl thread_start
+thread_start:
+    movq %r13, %rdi
+  8069d5:	4c 89 ef             	mov    %r13,%rdi
+    callq *%r12
+  8069d8:	41 ff d4             	call   *%r12
+    ud2
+  8069db:	0f 0b                	ud2
+
+00000000008069dd <check_dir>:
+check_consistency(void) {
+    check_dir(&super->s_root);
+}
+
+void
+check_dir(struct File *dir) {
+  8069dd:	55                   	push   %rbp
+  8069de:	48 89 e5             	mov    %rsp,%rbp
+  8069e1:	41 57                	push   %r15
+  8069e3:	41 56                	push   %r14
+  8069e5:	41 55                	push   %r13
+  8069e7:	41 54                	push   %r12
+  8069e9:	53                   	push   %rbx
+  8069ea:	48 83 ec 28          	sub    $0x28,%rsp
+  8069ee:	48 89 7d b0          	mov    %rdi,-0x50(%rbp)
+    blockno_t blk;
+    struct File *files;
+
+    blockno_t nblock = dir->f_size / BLKSIZE;
+  8069f2:	8b 97 80 00 00 00    	mov    0x80(%rdi),%edx
+  8069f8:	8d 82 ff 0f 00 00    	lea    0xfff(%rdx),%eax
+  8069fe:	85 d2                	test   %edx,%edx
+  806a00:	0f 49 c2             	cmovns %edx,%eax
+    for (blockno_t i = 0; i < nblock; ++i) {
+  806a03:	c1 f8 0c             	sar    $0xc,%eax
+  806a06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  806a09:	0f 84 55 01 00 00    	je     806b64 <check_dir+0x187>
+  806a0f:	c7 45 bc 00 00 00 00 	movl   $0x0,-0x44(%rbp)
+  806a16:	e9 06 01 00 00       	jmp    806b21 <check_dir+0x144>
+
+                cprintf("checking consistency of %s\n", f->f_name);
+
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+                    if (f->f_type == FTYPE_DIR) {
+                        check_dir(f);
+  806a1b:	4c 89 e7             	mov    %r12,%rdi
+  806a1e:	48 b8 dd 69 80 00 00 	movabs $0x8069dd,%rax
+  806a25:	00 00 00 
+  806a28:	ff d0                	call   *%rax
+  806a2a:	eb 26                	jmp    806a52 <check_dir+0x75>
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  806a2c:	41 83 c5 01          	add    $0x1,%r13d
+  806a30:	49 63 84 24 80 00 00 	movslq 0x80(%r12),%rax
+  806a37:	00 
+  806a38:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  806a3e:	48 c1 e8 0c          	shr    $0xc,%rax
+  806a42:	41 39 c5             	cmp    %eax,%r13d
+  806a45:	73 6d                	jae    806ab4 <check_dir+0xd7>
+                    if (f->f_type == FTYPE_DIR) {
+  806a47:	41 83 bc 24 84 00 00 	cmpl   $0x1,0x84(%r12)
+  806a4e:	00 01 
+  806a50:	74 c9                	je     806a1b <check_dir+0x3e>
+                    }
+                    if (file_block_map(f, k, &diskbno) <= 0) {
+  806a52:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  806a56:	44 89 ee             	mov    %r13d,%esi
+  806a59:	4c 89 e7             	mov    %r12,%rdi
+  806a5c:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  806a63:	00 00 00 
+  806a66:	ff d0                	call   *%rax
+  806a68:	85 c0                	test   %eax,%eax
+  806a6a:	7e c0                	jle    806a2c <check_dir+0x4f>
+                        continue;
+                    }
+                    assert(!block_is_free(diskbno));
+  806a6c:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  806a6f:	48 b8 84 2a 80 00 00 	movabs $0x802a84,%rax
+  806a76:	00 00 00 
+  806a79:	ff d0                	call   *%rax
+  806a7b:	84 c0                	test   %al,%al
+  806a7d:	74 ad                	je     806a2c <check_dir+0x4f>
+  806a7f:	48 b9 46 c1 80 00 00 	movabs $0x80c146,%rcx
+  806a86:	00 00 00 
+  806a89:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  806a90:	00 00 00 
+  806a93:	be 28 00 00 00       	mov    $0x28,%esi
+  806a98:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806a9f:	00 00 00 
+  806aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  806aa7:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806aae:	00 00 00 
+  806ab1:	41 ff d0             	call   *%r8
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  806ab4:	48 81 c3 00 01 00 00 	add    $0x100,%rbx
+  806abb:	4c 39 fb             	cmp    %r15,%rbx
+  806abe:	74 55                	je     806b15 <check_dir+0x138>
+            struct File *f = &(files[j]);
+  806ac0:	49 89 dc             	mov    %rbx,%r12
+            if (strcmp(f->f_name, "\0") != 0) {
+  806ac3:	48 be 28 c1 80 00 00 	movabs $0x80c128,%rsi
+  806aca:	00 00 00 
+  806acd:	48 89 df             	mov    %rbx,%rdi
+  806ad0:	41 ff d6             	call   *%r14
+  806ad3:	85 c0                	test   %eax,%eax
+  806ad5:	74 dd                	je     806ab4 <check_dir+0xd7>
+                cprintf("checking consistency of %s\n", f->f_name);
+  806ad7:	48 89 de             	mov    %rbx,%rsi
+  806ada:	48 bf 2a c1 80 00 00 	movabs $0x80c12a,%rdi
+  806ae1:	00 00 00 
+  806ae4:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ae9:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806af0:	00 00 00 
+  806af3:	ff d2                	call   *%rdx
+                for (blockno_t k = 0; k < CEILDIV(f->f_size, BLKSIZE); ++k) {
+  806af5:	48 63 83 80 00 00 00 	movslq 0x80(%rbx),%rax
+  806afc:	48 05 ff 0f 00 00    	add    $0xfff,%rax
+  806b02:	48 c1 e8 0c          	shr    $0xc,%rax
+  806b06:	85 c0                	test   %eax,%eax
+  806b08:	74 aa                	je     806ab4 <check_dir+0xd7>
+  806b0a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  806b10:	e9 32 ff ff ff       	jmp    806a47 <check_dir+0x6a>
+    for (blockno_t i = 0; i < nblock; ++i) {
+  806b15:	83 45 bc 01          	addl   $0x1,-0x44(%rbp)
+  806b19:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  806b1c:	39 45 b8             	cmp    %eax,-0x48(%rbp)
+  806b1f:	74 43                	je     806b64 <check_dir+0x187>
+        if (file_block_map(dir, i, &blk) <= 0) continue;
+  806b21:	48 8d 55 cc          	lea    -0x34(%rbp),%rdx
+  806b25:	8b 75 bc             	mov    -0x44(%rbp),%esi
+  806b28:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  806b2c:	48 b8 52 34 80 00 00 	movabs $0x803452,%rax
+  806b33:	00 00 00 
+  806b36:	ff d0                	call   *%rax
+  806b38:	85 c0                	test   %eax,%eax
+  806b3a:	7e d9                	jle    806b15 <check_dir+0x138>
+        files = (struct File *)diskaddr(blk);
+  806b3c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  806b3f:	48 b8 d0 14 80 00 00 	movabs $0x8014d0,%rax
+  806b46:	00 00 00 
+  806b49:	ff d0                	call   *%rax
+  806b4b:	48 89 c3             	mov    %rax,%rbx
+        for (blockno_t j = 0; j < BLKFILES; ++j) {
+  806b4e:	4c 8d b8 00 10 00 00 	lea    0x1000(%rax),%r15
+            if (strcmp(f->f_name, "\0") != 0) {
+  806b55:	49 be 9a 7e 80 00 00 	movabs $0x807e9a,%r14
+  806b5c:	00 00 00 
+  806b5f:	e9 5c ff ff ff       	jmp    806ac0 <check_dir+0xe3>
+                }
+            }
+        }
+    }
+}
+  806b64:	48 83 c4 28          	add    $0x28,%rsp
+  806b68:	5b                   	pop    %rbx
+  806b69:	41 5c                	pop    %r12
+  806b6b:	41 5d                	pop    %r13
+  806b6d:	41 5e                	pop    %r14
+  806b6f:	41 5f                	pop    %r15
+  806b71:	5d                   	pop    %rbp
+  806b72:	c3                   	ret
+
+0000000000806b73 <fs_test>:
+
+void
+fs_test(void) {
+  806b73:	55                   	push   %rbp
+  806b74:	48 89 e5             	mov    %rsp,%rbp
+  806b77:	53                   	push   %rbx
+  806b78:	48 83 ec 18          	sub    $0x18,%rsp
+    int r;
+    char *blk;
+    uint32_t *bits;
+
+    /* Back up bitmap */
+    if ((r = sys_alloc_region(0, (void *)PAGE_SIZE, PAGE_SIZE, PROT_RW)) < 0)
+  806b7c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  806b81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  806b86:	be 00 10 00 00       	mov    $0x1000,%esi
+  806b8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  806b90:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  806b97:	00 00 00 
+  806b9a:	ff d0                	call   *%rax
+  806b9c:	85 c0                	test   %eax,%eax
+  806b9e:	0f 88 41 03 00 00    	js     806ee5 <fs_test+0x372>
+        panic("sys_page_alloc: %i", r);
+    bits = (uint32_t *)PAGE_SIZE;
+    memmove(bits, bitmap, PAGE_SIZE);
+  806ba4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  806ba9:	48 b8 60 c1 84 00 00 	movabs $0x84c160,%rax
+  806bb0:	00 00 00 
+  806bb3:	48 8b 30             	mov    (%rax),%rsi
+  806bb6:	bf 00 10 00 00       	mov    $0x1000,%edi
+  806bbb:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  806bc2:	00 00 00 
+  806bc5:	ff d0                	call   *%rax
+    /* Allocate block */
+    if (!(r = alloc_block()))
+  806bc7:	48 b8 bb 2c 80 00 00 	movabs $0x802cbb,%rax
+  806bce:	00 00 00 
+  806bd1:	ff d0                	call   *%rax
+  806bd3:	89 c1                	mov    %eax,%ecx
+  806bd5:	85 c0                	test   %eax,%eax
+  806bd7:	0f 84 35 03 00 00    	je     806f12 <fs_test+0x39f>
+        panic("alloc_block: %i", -E_NO_DISK);
+    /* Check that block was free */
+    assert(TSTBIT(bits, r));
+  806bdd:	8d 50 1f             	lea    0x1f(%rax),%edx
+  806be0:	0f 49 d0             	cmovns %eax,%edx
+  806be3:	c1 fa 05             	sar    $0x5,%edx
+  806be6:	48 63 d2             	movslq %edx,%rdx
+  806be9:	b8 01 00 00 00       	mov    $0x1,%eax
+  806bee:	d3 e0                	shl    %cl,%eax
+  806bf0:	89 c1                	mov    %eax,%ecx
+  806bf2:	23 04 95 00 10 00 00 	and    0x1000(,%rdx,4),%eax
+  806bf9:	0f 84 43 03 00 00    	je     806f42 <fs_test+0x3cf>
+    /* And is not free any more */
+    assert(!TSTBIT(bitmap, r));
+  806bff:	48 a1 60 c1 84 00 00 	movabs 0x84c160,%rax
+  806c06:	00 00 00 
+  806c09:	23 0c 90             	and    (%rax,%rdx,4),%ecx
+  806c0c:	0f 85 60 03 00 00    	jne    806f72 <fs_test+0x3ff>
+    cprintf("alloc_block is good\n");
+  806c12:	48 bf ae c1 80 00 00 	movabs $0x80c1ae,%rdi
+  806c19:	00 00 00 
+  806c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c21:	48 bb d1 74 80 00 00 	movabs $0x8074d1,%rbx
+  806c28:	00 00 00 
+  806c2b:	ff d3                	call   *%rbx
+    check_dir(&super->s_root);
+  806c2d:	48 a1 68 c1 84 00 00 	movabs 0x84c168,%rax
+  806c34:	00 00 00 
+  806c37:	48 8d 78 08          	lea    0x8(%rax),%rdi
+  806c3b:	48 b8 dd 69 80 00 00 	movabs $0x8069dd,%rax
+  806c42:	00 00 00 
+  806c45:	ff d0                	call   *%rax
+    check_consistency();
+    cprintf("fs consistency is good\n");
+  806c47:	48 bf c3 c1 80 00 00 	movabs $0x80c1c3,%rdi
+  806c4e:	00 00 00 
+  806c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  806c56:	ff d3                	call   *%rbx
+
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806c58:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  806c5c:	48 bf db c1 80 00 00 	movabs $0x80c1db,%rdi
+  806c63:	00 00 00 
+  806c66:	48 b8 9d 3e 80 00 00 	movabs $0x803e9d,%rax
+  806c6d:	00 00 00 
+  806c70:	ff d0                	call   *%rax
+  806c72:	85 c0                	test   %eax,%eax
+  806c74:	0f 88 2d 03 00 00    	js     806fa7 <fs_test+0x434>
+        panic("file_open /not-found: %i", r);
+    else if (r == 0)
+  806c7a:	0f 84 5d 03 00 00    	je     806fdd <fs_test+0x46a>
+        panic("file_open /not-found succeeded!");
+    if ((r = file_open("/newmotd", &f)) < 0)
+  806c80:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  806c84:	48 bf ff c1 80 00 00 	movabs $0x80c1ff,%rdi
+  806c8b:	00 00 00 
+  806c8e:	48 b8 9d 3e 80 00 00 	movabs $0x803e9d,%rax
+  806c95:	00 00 00 
+  806c98:	ff d0                	call   *%rax
+  806c9a:	85 c0                	test   %eax,%eax
+  806c9c:	0f 88 60 03 00 00    	js     807002 <fs_test+0x48f>
+        panic("file_open /newmotd: %i", r);
+    cprintf("file_open is good\n");
+  806ca2:	48 bf 1f c2 80 00 00 	movabs $0x80c21f,%rdi
+  806ca9:	00 00 00 
+  806cac:	b8 00 00 00 00       	mov    $0x0,%eax
+  806cb1:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806cb8:	00 00 00 
+  806cbb:	ff d2                	call   *%rdx
+
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  806cbd:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806cc1:	be 00 00 00 00       	mov    $0x0,%esi
+  806cc6:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806cca:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  806cd1:	00 00 00 
+  806cd4:	ff d0                	call   *%rax
+  806cd6:	85 c0                	test   %eax,%eax
+  806cd8:	0f 88 51 03 00 00    	js     80702f <fs_test+0x4bc>
+        panic("file_get_block: %i", r);
+    if (strcmp(blk, msg) != 0)
+  806cde:	48 be 20 c3 80 00 00 	movabs $0x80c320,%rsi
+  806ce5:	00 00 00 
+  806ce8:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806cec:	48 b8 9a 7e 80 00 00 	movabs $0x807e9a,%rax
+  806cf3:	00 00 00 
+  806cf6:	ff d0                	call   *%rax
+  806cf8:	85 c0                	test   %eax,%eax
+  806cfa:	0f 85 5c 03 00 00    	jne    80705c <fs_test+0x4e9>
+        panic("file_get_block returned wrong data");
+    cprintf("file_get_block is good\n");
+  806d00:	48 bf 45 c2 80 00 00 	movabs $0x80c245,%rdi
+  806d07:	00 00 00 
+  806d0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d0f:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806d16:	00 00 00 
+  806d19:	ff d2                	call   *%rdx
+
+    *(volatile char *)blk = *(volatile char *)blk;
+  806d1b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  806d1f:	0f b6 10             	movzbl (%rax),%edx
+  806d22:	88 10                	mov    %dl,(%rax)
+    assert(is_page_dirty(blk));
+  806d24:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806d28:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806d2f:	00 00 00 
+  806d32:	ff d0                	call   *%rax
+  806d34:	84 c0                	test   %al,%al
+  806d36:	0f 84 4a 03 00 00    	je     807086 <fs_test+0x513>
+    file_flush(f);
+  806d3c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806d40:	48 b8 e0 42 80 00 00 	movabs $0x8042e0,%rax
+  806d47:	00 00 00 
+  806d4a:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  806d4c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806d50:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806d57:	00 00 00 
+  806d5a:	ff d0                	call   *%rax
+  806d5c:	84 c0                	test   %al,%al
+  806d5e:	0f 85 52 03 00 00    	jne    8070b6 <fs_test+0x543>
+    cprintf("file_flush is good\n");
+  806d64:	48 bf 71 c2 80 00 00 	movabs $0x80c271,%rdi
+  806d6b:	00 00 00 
+  806d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  806d73:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806d7a:	00 00 00 
+  806d7d:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, 0)) < 0)
+  806d7f:	be 00 00 00 00       	mov    $0x0,%esi
+  806d84:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806d88:	48 b8 67 41 80 00 00 	movabs $0x804167,%rax
+  806d8f:	00 00 00 
+  806d92:	ff d0                	call   *%rax
+  806d94:	85 c0                	test   %eax,%eax
+  806d96:	0f 88 4f 03 00 00    	js     8070eb <fs_test+0x578>
+        panic("file_set_size: %i", r);
+    assert(f->f_extent[0].e_len == 0 && f->f_extent[0].e_start == 0);
+  806d9c:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806da0:	83 bf 8c 00 00 00 00 	cmpl   $0x0,0x8c(%rdi)
+  806da7:	0f 85 6b 03 00 00    	jne    807118 <fs_test+0x5a5>
+  806dad:	83 bf 88 00 00 00 00 	cmpl   $0x0,0x88(%rdi)
+  806db4:	0f 85 5e 03 00 00    	jne    807118 <fs_test+0x5a5>
+    assert(!is_page_dirty(f));
+  806dba:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806dc1:	00 00 00 
+  806dc4:	ff d0                	call   *%rax
+  806dc6:	84 c0                	test   %al,%al
+  806dc8:	0f 85 7f 03 00 00    	jne    80714d <fs_test+0x5da>
+    cprintf("file_truncate is good\n");
+  806dce:	48 bf a9 c2 80 00 00 	movabs $0x80c2a9,%rdi
+  806dd5:	00 00 00 
+  806dd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ddd:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806de4:	00 00 00 
+  806de7:	ff d2                	call   *%rdx
+
+    if ((r = file_set_size(f, strlen(msg))) < 0)
+  806de9:	48 bf 20 c3 80 00 00 	movabs $0x80c320,%rdi
+  806df0:	00 00 00 
+  806df3:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  806dfa:	00 00 00 
+  806dfd:	ff d0                	call   *%rax
+  806dff:	89 c6                	mov    %eax,%esi
+  806e01:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806e05:	48 b8 67 41 80 00 00 	movabs $0x804167,%rax
+  806e0c:	00 00 00 
+  806e0f:	ff d0                	call   *%rax
+  806e11:	85 c0                	test   %eax,%eax
+  806e13:	0f 88 69 03 00 00    	js     807182 <fs_test+0x60f>
+        panic("file_set_size 2: %i", r);
+    assert(!is_page_dirty(f));
+  806e19:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806e1d:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806e24:	00 00 00 
+  806e27:	ff d0                	call   *%rax
+  806e29:	84 c0                	test   %al,%al
+  806e2b:	0f 85 7e 03 00 00    	jne    8071af <fs_test+0x63c>
+    if ((r = file_get_block(f, 0, &blk)) < 0)
+  806e31:	48 8d 55 e0          	lea    -0x20(%rbp),%rdx
+  806e35:	be 00 00 00 00       	mov    $0x0,%esi
+  806e3a:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806e3e:	48 b8 eb 34 80 00 00 	movabs $0x8034eb,%rax
+  806e45:	00 00 00 
+  806e48:	ff d0                	call   *%rax
+  806e4a:	85 c0                	test   %eax,%eax
+  806e4c:	0f 88 92 03 00 00    	js     8071e4 <fs_test+0x671>
+        panic("file_get_block 2: %i", r);
+    strcpy(blk, msg);
+  806e52:	48 be 20 c3 80 00 00 	movabs $0x80c320,%rsi
+  806e59:	00 00 00 
+  806e5c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806e60:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  806e67:	00 00 00 
+  806e6a:	ff d0                	call   *%rax
+    assert(is_page_dirty(blk));
+  806e6c:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806e70:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806e77:	00 00 00 
+  806e7a:	ff d0                	call   *%rax
+  806e7c:	84 c0                	test   %al,%al
+  806e7e:	0f 84 8d 03 00 00    	je     807211 <fs_test+0x69e>
+    file_flush(f);
+  806e84:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806e88:	48 b8 e0 42 80 00 00 	movabs $0x8042e0,%rax
+  806e8f:	00 00 00 
+  806e92:	ff d0                	call   *%rax
+    assert(!is_page_dirty(blk));
+  806e94:	48 8b 7d e0          	mov    -0x20(%rbp),%rdi
+  806e98:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806e9f:	00 00 00 
+  806ea2:	ff d0                	call   *%rax
+  806ea4:	84 c0                	test   %al,%al
+  806ea6:	0f 85 95 03 00 00    	jne    807241 <fs_test+0x6ce>
+    assert(!is_page_dirty(f));
+  806eac:	48 8b 7d e8          	mov    -0x18(%rbp),%rdi
+  806eb0:	48 b8 1f b4 80 00 00 	movabs $0x80b41f,%rax
+  806eb7:	00 00 00 
+  806eba:	ff d0                	call   *%rax
+  806ebc:	84 c0                	test   %al,%al
+  806ebe:	0f 85 b2 03 00 00    	jne    807276 <fs_test+0x703>
+    cprintf("file rewrite is good\n");
+  806ec4:	48 bf e9 c2 80 00 00 	movabs $0x80c2e9,%rdi
+  806ecb:	00 00 00 
+  806ece:	b8 00 00 00 00       	mov    $0x0,%eax
+  806ed3:	48 ba d1 74 80 00 00 	movabs $0x8074d1,%rdx
+  806eda:	00 00 00 
+  806edd:	ff d2                	call   *%rdx
+}
+  806edf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806ee3:	c9                   	leave
+  806ee4:	c3                   	ret
+        panic("sys_page_alloc: %i", r);
+  806ee5:	89 c1                	mov    %eax,%ecx
+  806ee7:	48 ba 68 c1 80 00 00 	movabs $0x80c168,%rdx
+  806eee:	00 00 00 
+  806ef1:	be 38 00 00 00       	mov    $0x38,%esi
+  806ef6:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806efd:	00 00 00 
+  806f00:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f05:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806f0c:	00 00 00 
+  806f0f:	41 ff d0             	call   *%r8
+        panic("alloc_block: %i", -E_NO_DISK);
+  806f12:	b9 f3 ff ff ff       	mov    $0xfffffff3,%ecx
+  806f17:	48 ba 7b c1 80 00 00 	movabs $0x80c17b,%rdx
+  806f1e:	00 00 00 
+  806f21:	be 3d 00 00 00       	mov    $0x3d,%esi
+  806f26:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806f2d:	00 00 00 
+  806f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f35:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806f3c:	00 00 00 
+  806f3f:	41 ff d0             	call   *%r8
+    assert(TSTBIT(bits, r));
+  806f42:	48 b9 8b c1 80 00 00 	movabs $0x80c18b,%rcx
+  806f49:	00 00 00 
+  806f4c:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  806f53:	00 00 00 
+  806f56:	be 3f 00 00 00       	mov    $0x3f,%esi
+  806f5b:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806f62:	00 00 00 
+  806f65:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806f6c:	00 00 00 
+  806f6f:	41 ff d0             	call   *%r8
+    assert(!TSTBIT(bitmap, r));
+  806f72:	48 b9 9b c1 80 00 00 	movabs $0x80c19b,%rcx
+  806f79:	00 00 00 
+  806f7c:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  806f83:	00 00 00 
+  806f86:	be 41 00 00 00       	mov    $0x41,%esi
+  806f8b:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806f92:	00 00 00 
+  806f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  806f9a:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806fa1:	00 00 00 
+  806fa4:	41 ff d0             	call   *%r8
+    if ((r = file_open("/not-found", &f)) < 0 && r != -E_NOT_FOUND)
+  806fa7:	83 f8 f1             	cmp    $0xfffffff1,%eax
+  806faa:	0f 84 d0 fc ff ff    	je     806c80 <fs_test+0x10d>
+        panic("file_open /not-found: %i", r);
+  806fb0:	89 c1                	mov    %eax,%ecx
+  806fb2:	48 ba e6 c1 80 00 00 	movabs $0x80c1e6,%rdx
+  806fb9:	00 00 00 
+  806fbc:	be 47 00 00 00       	mov    $0x47,%esi
+  806fc1:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806fc8:	00 00 00 
+  806fcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  806fd0:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  806fd7:	00 00 00 
+  806fda:	41 ff d0             	call   *%r8
+        panic("file_open /not-found succeeded!");
+  806fdd:	48 ba 00 c3 80 00 00 	movabs $0x80c300,%rdx
+  806fe4:	00 00 00 
+  806fe7:	be 49 00 00 00       	mov    $0x49,%esi
+  806fec:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  806ff3:	00 00 00 
+  806ff6:	48 b9 81 73 80 00 00 	movabs $0x807381,%rcx
+  806ffd:	00 00 00 
+  807000:	ff d1                	call   *%rcx
+        panic("file_open /newmotd: %i", r);
+  807002:	89 c1                	mov    %eax,%ecx
+  807004:	48 ba 08 c2 80 00 00 	movabs $0x80c208,%rdx
+  80700b:	00 00 00 
+  80700e:	be 4b 00 00 00       	mov    $0x4b,%esi
+  807013:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  80701a:	00 00 00 
+  80701d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807022:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  807029:	00 00 00 
+  80702c:	41 ff d0             	call   *%r8
+        panic("file_get_block: %i", r);
+  80702f:	89 c1                	mov    %eax,%ecx
+  807031:	48 ba 32 c2 80 00 00 	movabs $0x80c232,%rdx
+  807038:	00 00 00 
+  80703b:	be 4f 00 00 00       	mov    $0x4f,%esi
+  807040:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807047:	00 00 00 
+  80704a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80704f:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  807056:	00 00 00 
+  807059:	41 ff d0             	call   *%r8
+        panic("file_get_block returned wrong data");
+  80705c:	48 ba 48 c3 80 00 00 	movabs $0x80c348,%rdx
+  807063:	00 00 00 
+  807066:	be 51 00 00 00       	mov    $0x51,%esi
+  80706b:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807072:	00 00 00 
+  807075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80707a:	48 b9 81 73 80 00 00 	movabs $0x807381,%rcx
+  807081:	00 00 00 
+  807084:	ff d1                	call   *%rcx
+    assert(is_page_dirty(blk));
+  807086:	48 b9 5e c2 80 00 00 	movabs $0x80c25e,%rcx
+  80708d:	00 00 00 
+  807090:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  807097:	00 00 00 
+  80709a:	be 55 00 00 00       	mov    $0x55,%esi
+  80709f:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  8070a6:	00 00 00 
+  8070a9:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8070b0:	00 00 00 
+  8070b3:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  8070b6:	48 b9 5d c2 80 00 00 	movabs $0x80c25d,%rcx
+  8070bd:	00 00 00 
+  8070c0:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8070c7:	00 00 00 
+  8070ca:	be 57 00 00 00       	mov    $0x57,%esi
+  8070cf:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  8070d6:	00 00 00 
+  8070d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8070de:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8070e5:	00 00 00 
+  8070e8:	41 ff d0             	call   *%r8
+        panic("file_set_size: %i", r);
+  8070eb:	89 c1                	mov    %eax,%ecx
+  8070ed:	48 ba 85 c2 80 00 00 	movabs $0x80c285,%rdx
+  8070f4:	00 00 00 
+  8070f7:	be 5b 00 00 00       	mov    $0x5b,%esi
+  8070fc:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807103:	00 00 00 
+  807106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80710b:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  807112:	00 00 00 
+  807115:	41 ff d0             	call   *%r8
+    assert(f->f_extent[0].e_len == 0 && f->f_extent[0].e_start == 0);
+  807118:	48 b9 70 c3 80 00 00 	movabs $0x80c370,%rcx
+  80711f:	00 00 00 
+  807122:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  807129:	00 00 00 
+  80712c:	be 5c 00 00 00       	mov    $0x5c,%esi
+  807131:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807138:	00 00 00 
+  80713b:	b8 00 00 00 00       	mov    $0x0,%eax
+  807140:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  807147:	00 00 00 
+  80714a:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  80714d:	48 b9 97 c2 80 00 00 	movabs $0x80c297,%rcx
+  807154:	00 00 00 
+  807157:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  80715e:	00 00 00 
+  807161:	be 5d 00 00 00       	mov    $0x5d,%esi
+  807166:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  80716d:	00 00 00 
+  807170:	b8 00 00 00 00       	mov    $0x0,%eax
+  807175:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80717c:	00 00 00 
+  80717f:	41 ff d0             	call   *%r8
+        panic("file_set_size 2: %i", r);
+  807182:	89 c1                	mov    %eax,%ecx
+  807184:	48 ba c0 c2 80 00 00 	movabs $0x80c2c0,%rdx
+  80718b:	00 00 00 
+  80718e:	be 61 00 00 00       	mov    $0x61,%esi
+  807193:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  80719a:	00 00 00 
+  80719d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071a2:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8071a9:	00 00 00 
+  8071ac:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  8071af:	48 b9 97 c2 80 00 00 	movabs $0x80c297,%rcx
+  8071b6:	00 00 00 
+  8071b9:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8071c0:	00 00 00 
+  8071c3:	be 62 00 00 00       	mov    $0x62,%esi
+  8071c8:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  8071cf:	00 00 00 
+  8071d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8071d7:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8071de:	00 00 00 
+  8071e1:	41 ff d0             	call   *%r8
+        panic("file_get_block 2: %i", r);
+  8071e4:	89 c1                	mov    %eax,%ecx
+  8071e6:	48 ba d4 c2 80 00 00 	movabs $0x80c2d4,%rdx
+  8071ed:	00 00 00 
+  8071f0:	be 64 00 00 00       	mov    $0x64,%esi
+  8071f5:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  8071fc:	00 00 00 
+  8071ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  807204:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80720b:	00 00 00 
+  80720e:	41 ff d0             	call   *%r8
+    assert(is_page_dirty(blk));
+  807211:	48 b9 5e c2 80 00 00 	movabs $0x80c25e,%rcx
+  807218:	00 00 00 
+  80721b:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  807222:	00 00 00 
+  807225:	be 66 00 00 00       	mov    $0x66,%esi
+  80722a:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807231:	00 00 00 
+  807234:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80723b:	00 00 00 
+  80723e:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(blk));
+  807241:	48 b9 5d c2 80 00 00 	movabs $0x80c25d,%rcx
+  807248:	00 00 00 
+  80724b:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  807252:	00 00 00 
+  807255:	be 68 00 00 00       	mov    $0x68,%esi
+  80725a:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807261:	00 00 00 
+  807264:	b8 00 00 00 00       	mov    $0x0,%eax
+  807269:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  807270:	00 00 00 
+  807273:	41 ff d0             	call   *%r8
+    assert(!is_page_dirty(f));
+  807276:	48 b9 97 c2 80 00 00 	movabs $0x80c297,%rcx
+  80727d:	00 00 00 
+  807280:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  807287:	00 00 00 
+  80728a:	be 69 00 00 00       	mov    $0x69,%esi
+  80728f:	48 bf 5e c1 80 00 00 	movabs $0x80c15e,%rdi
+  807296:	00 00 00 
+  807299:	b8 00 00 00 00       	mov    $0x0,%eax
+  80729e:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8072a5:	00 00 00 
+  8072a8:	41 ff d0             	call   *%r8
+
+00000000008072ab <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8072ab:	55                   	push   %rbp
+  8072ac:	48 89 e5             	mov    %rsp,%rbp
+  8072af:	41 56                	push   %r14
+  8072b1:	41 55                	push   %r13
+  8072b3:	41 54                	push   %r12
+  8072b5:	53                   	push   %rbx
+  8072b6:	41 89 fd             	mov    %edi,%r13d
+  8072b9:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8072bc:	48 ba 80 31 81 00 00 	movabs $0x813180,%rdx
+  8072c3:	00 00 00 
+  8072c6:	48 b8 80 31 81 00 00 	movabs $0x813180,%rax
+  8072cd:	00 00 00 
+  8072d0:	48 39 c2             	cmp    %rax,%rdx
+  8072d3:	73 17                	jae    8072ec <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8072d5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8072d8:	49 89 c4             	mov    %rax,%r12
+  8072db:	48 83 c3 08          	add    $0x8,%rbx
+  8072df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8072e4:	ff 53 f8             	call   *-0x8(%rbx)
+  8072e7:	4c 39 e3             	cmp    %r12,%rbx
+  8072ea:	72 ef                	jb     8072db <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8072ec:	48 b8 c8 82 80 00 00 	movabs $0x8082c8,%rax
+  8072f3:	00 00 00 
+  8072f6:	ff d0                	call   *%rax
+  8072f8:	89 c2                	mov    %eax,%edx
+  8072fa:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  807300:	48 89 d0             	mov    %rdx,%rax
+  807303:	48 c1 e0 04          	shl    $0x4,%rax
+  807307:	48 29 d0             	sub    %rdx,%rax
+  80730a:	48 c1 e0 05          	shl    $0x5,%rax
+  80730e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  807315:	00 00 00 
+  807318:	48 01 d0             	add    %rdx,%rax
+  80731b:	48 a3 60 45 86 00 00 	movabs %rax,0x864560
+  807322:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  807325:	45 85 ed             	test   %r13d,%r13d
+  807328:	7e 0d                	jle    807337 <libmain+0x8c>
+  80732a:	49 8b 06             	mov    (%r14),%rax
+  80732d:	48 a3 a0 30 81 00 00 	movabs %rax,0x8130a0
+  807334:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  807337:	4c 89 f6             	mov    %r14,%rsi
+  80733a:	44 89 ef             	mov    %r13d,%edi
+  80733d:	48 b8 7a 67 80 00 00 	movabs $0x80677a,%rax
+  807344:	00 00 00 
+  807347:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  807349:	48 b8 5e 73 80 00 00 	movabs $0x80735e,%rax
+  807350:	00 00 00 
+  807353:	ff d0                	call   *%rax
+#endif
+}
+  807355:	5b                   	pop    %rbx
+  807356:	41 5c                	pop    %r12
+  807358:	41 5d                	pop    %r13
+  80735a:	41 5e                	pop    %r14
+  80735c:	5d                   	pop    %rbp
+  80735d:	c3                   	ret
+
+000000000080735e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80735e:	55                   	push   %rbp
+  80735f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  807362:	48 b8 42 8e 80 00 00 	movabs $0x808e42,%rax
+  807369:	00 00 00 
+  80736c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80736e:	bf 00 00 00 00       	mov    $0x0,%edi
+  807373:	48 b8 65 82 80 00 00 	movabs $0x808265,%rax
+  80737a:	00 00 00 
+  80737d:	ff d0                	call   *%rax
+}
+  80737f:	5d                   	pop    %rbp
+  807380:	c3                   	ret
+
+0000000000807381 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  807381:	55                   	push   %rbp
+  807382:	48 89 e5             	mov    %rsp,%rbp
+  807385:	41 56                	push   %r14
+  807387:	41 55                	push   %r13
+  807389:	41 54                	push   %r12
+  80738b:	53                   	push   %rbx
+  80738c:	48 83 ec 50          	sub    $0x50,%rsp
+  807390:	49 89 fc             	mov    %rdi,%r12
+  807393:	41 89 f5             	mov    %esi,%r13d
+  807396:	48 89 d3             	mov    %rdx,%rbx
+  807399:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80739d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8073a1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8073a5:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8073ac:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8073b0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8073b4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8073b8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8073bc:	48 b8 a0 30 81 00 00 	movabs $0x8130a0,%rax
+  8073c3:	00 00 00 
+  8073c6:	4c 8b 30             	mov    (%rax),%r14
+  8073c9:	48 b8 c8 82 80 00 00 	movabs $0x8082c8,%rax
+  8073d0:	00 00 00 
+  8073d3:	ff d0                	call   *%rax
+  8073d5:	89 c6                	mov    %eax,%esi
+  8073d7:	45 89 e8             	mov    %r13d,%r8d
+  8073da:	4c 89 e1             	mov    %r12,%rcx
+  8073dd:	4c 89 f2             	mov    %r14,%rdx
+  8073e0:	48 bf b8 c3 80 00 00 	movabs $0x80c3b8,%rdi
+  8073e7:	00 00 00 
+  8073ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8073ef:	49 bc d1 74 80 00 00 	movabs $0x8074d1,%r12
+  8073f6:	00 00 00 
+  8073f9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8073fc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  807400:	48 89 df             	mov    %rbx,%rdi
+  807403:	48 b8 6d 74 80 00 00 	movabs $0x80746d,%rax
+  80740a:	00 00 00 
+  80740d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80740f:	48 bf 12 bf 80 00 00 	movabs $0x80bf12,%rdi
+  807416:	00 00 00 
+  807419:	b8 00 00 00 00       	mov    $0x0,%eax
+  80741e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  807421:	cc                   	int3
+  807422:	eb fd                	jmp    807421 <_panic+0xa0>
+
+0000000000807424 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  807424:	55                   	push   %rbp
+  807425:	48 89 e5             	mov    %rsp,%rbp
+  807428:	53                   	push   %rbx
+  807429:	48 83 ec 08          	sub    $0x8,%rsp
+  80742d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  807430:	8b 06                	mov    (%rsi),%eax
+  807432:	8d 50 01             	lea    0x1(%rax),%edx
+  807435:	89 16                	mov    %edx,(%rsi)
+  807437:	48 98                	cltq
+  807439:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80743e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  807444:	74 0a                	je     807450 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  807446:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80744a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80744e:	c9                   	leave
+  80744f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  807450:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  807454:	be ff 00 00 00       	mov    $0xff,%esi
+  807459:	48 b8 1d 82 80 00 00 	movabs $0x80821d,%rax
+  807460:	00 00 00 
+  807463:	ff d0                	call   *%rax
+        state->offset = 0;
+  807465:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80746b:	eb d9                	jmp    807446 <putch+0x22>
+
+000000000080746d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80746d:	55                   	push   %rbp
+  80746e:	48 89 e5             	mov    %rsp,%rbp
+  807471:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  807478:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80747b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  807482:	b9 21 00 00 00       	mov    $0x21,%ecx
+  807487:	b8 00 00 00 00       	mov    $0x0,%eax
+  80748c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80748f:	48 89 f1             	mov    %rsi,%rcx
+  807492:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  807499:	48 bf 24 74 80 00 00 	movabs $0x807424,%rdi
+  8074a0:	00 00 00 
+  8074a3:	48 b8 21 76 80 00 00 	movabs $0x807621,%rax
+  8074aa:	00 00 00 
+  8074ad:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8074af:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8074b6:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8074bd:	48 b8 1d 82 80 00 00 	movabs $0x80821d,%rax
+  8074c4:	00 00 00 
+  8074c7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8074c9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8074cf:	c9                   	leave
+  8074d0:	c3                   	ret
+
+00000000008074d1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8074d1:	55                   	push   %rbp
+  8074d2:	48 89 e5             	mov    %rsp,%rbp
+  8074d5:	48 83 ec 50          	sub    $0x50,%rsp
+  8074d9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8074dd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8074e1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8074e5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8074e9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8074ed:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8074f4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8074f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8074fc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  807500:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  807504:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  807508:	48 b8 6d 74 80 00 00 	movabs $0x80746d,%rax
+  80750f:	00 00 00 
+  807512:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  807514:	c9                   	leave
+  807515:	c3                   	ret
+
+0000000000807516 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  807516:	55                   	push   %rbp
+  807517:	48 89 e5             	mov    %rsp,%rbp
+  80751a:	41 57                	push   %r15
+  80751c:	41 56                	push   %r14
+  80751e:	41 55                	push   %r13
+  807520:	41 54                	push   %r12
+  807522:	53                   	push   %rbx
+  807523:	48 83 ec 18          	sub    $0x18,%rsp
+  807527:	49 89 fc             	mov    %rdi,%r12
+  80752a:	49 89 f5             	mov    %rsi,%r13
+  80752d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  807531:	8b 45 10             	mov    0x10(%rbp),%eax
+  807534:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  807537:	41 89 cf             	mov    %ecx,%r15d
+  80753a:	4c 39 fa             	cmp    %r15,%rdx
+  80753d:	73 5b                	jae    80759a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80753f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  807543:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  807547:	85 db                	test   %ebx,%ebx
+  807549:	7e 0e                	jle    807559 <print_num+0x43>
+            putch(padc, put_arg);
+  80754b:	4c 89 ee             	mov    %r13,%rsi
+  80754e:	44 89 f7             	mov    %r14d,%edi
+  807551:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  807554:	83 eb 01             	sub    $0x1,%ebx
+  807557:	75 f2                	jne    80754b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  807559:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80755d:	48 b9 ec c3 80 00 00 	movabs $0x80c3ec,%rcx
+  807564:	00 00 00 
+  807567:	48 b8 db c3 80 00 00 	movabs $0x80c3db,%rax
+  80756e:	00 00 00 
+  807571:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  807575:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  807579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80757e:	49 f7 f7             	div    %r15
+  807581:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  807585:	4c 89 ee             	mov    %r13,%rsi
+  807588:	41 ff d4             	call   *%r12
+}
+  80758b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80758f:	5b                   	pop    %rbx
+  807590:	41 5c                	pop    %r12
+  807592:	41 5d                	pop    %r13
+  807594:	41 5e                	pop    %r14
+  807596:	41 5f                	pop    %r15
+  807598:	5d                   	pop    %rbp
+  807599:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80759a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80759e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8075a3:	49 f7 f7             	div    %r15
+  8075a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8075aa:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8075ae:	52                   	push   %rdx
+  8075af:	45 0f be c9          	movsbl %r9b,%r9d
+  8075b3:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8075b7:	48 89 c2             	mov    %rax,%rdx
+  8075ba:	48 b8 16 75 80 00 00 	movabs $0x807516,%rax
+  8075c1:	00 00 00 
+  8075c4:	ff d0                	call   *%rax
+  8075c6:	48 83 c4 10          	add    $0x10,%rsp
+  8075ca:	eb 8d                	jmp    807559 <print_num+0x43>
+
+00000000008075cc <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8075cc:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8075d0:	48 8b 06             	mov    (%rsi),%rax
+  8075d3:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8075d7:	73 0a                	jae    8075e3 <sprintputch+0x17>
+        *state->start++ = ch;
+  8075d9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8075dd:	48 89 16             	mov    %rdx,(%rsi)
+  8075e0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8075e3:	c3                   	ret
+
+00000000008075e4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8075e4:	55                   	push   %rbp
+  8075e5:	48 89 e5             	mov    %rsp,%rbp
+  8075e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8075ec:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8075f0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8075f4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8075f8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8075ff:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  807603:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807607:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80760b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80760f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  807613:	48 b8 21 76 80 00 00 	movabs $0x807621,%rax
+  80761a:	00 00 00 
+  80761d:	ff d0                	call   *%rax
+}
+  80761f:	c9                   	leave
+  807620:	c3                   	ret
+
+0000000000807621 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  807621:	55                   	push   %rbp
+  807622:	48 89 e5             	mov    %rsp,%rbp
+  807625:	41 57                	push   %r15
+  807627:	41 56                	push   %r14
+  807629:	41 55                	push   %r13
+  80762b:	41 54                	push   %r12
+  80762d:	53                   	push   %rbx
+  80762e:	48 83 ec 38          	sub    $0x38,%rsp
+  807632:	49 89 fe             	mov    %rdi,%r14
+  807635:	49 89 f5             	mov    %rsi,%r13
+  807638:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80763b:	48 8b 01             	mov    (%rcx),%rax
+  80763e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  807642:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  807646:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80764a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80764e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  807652:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  807656:	0f b6 3b             	movzbl (%rbx),%edi
+  807659:	40 80 ff 25          	cmp    $0x25,%dil
+  80765d:	74 18                	je     807677 <vprintfmt+0x56>
+            if (!ch) return;
+  80765f:	40 84 ff             	test   %dil,%dil
+  807662:	0f 84 b1 06 00 00    	je     807d19 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  807668:	40 0f b6 ff          	movzbl %dil,%edi
+  80766c:	4c 89 ee             	mov    %r13,%rsi
+  80766f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  807672:	4c 89 e3             	mov    %r12,%rbx
+  807675:	eb db                	jmp    807652 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  807677:	be 00 00 00 00       	mov    $0x0,%esi
+  80767c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  807680:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  807685:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80768b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  807692:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  807696:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80769b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8076a0:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8076a3:	83 e8 23             	sub    $0x23,%eax
+  8076a6:	3c 57                	cmp    $0x57,%al
+  8076a8:	0f 87 51 06 00 00    	ja     807cff <vprintfmt+0x6de>
+  8076ae:	0f b6 c0             	movzbl %al,%eax
+  8076b1:	48 b9 a0 c5 80 00 00 	movabs $0x80c5a0,%rcx
+  8076b8:	00 00 00 
+  8076bb:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8076be:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8076c1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8076c5:	eb cf                	jmp    807696 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8076c7:	49 89 dc             	mov    %rbx,%r12
+  8076ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8076cf:	eb c5                	jmp    807696 <vprintfmt+0x75>
+            padc = ch;
+  8076d1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8076d5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8076d8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8076db:	eb b9                	jmp    807696 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8076dd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8076e0:	83 f8 2f             	cmp    $0x2f,%eax
+  8076e3:	77 24                	ja     807709 <vprintfmt+0xe8>
+  8076e5:	89 c1                	mov    %eax,%ecx
+  8076e7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8076eb:	83 c0 08             	add    $0x8,%eax
+  8076ee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8076f1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8076f4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8076f7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8076fb:	79 99                	jns    807696 <vprintfmt+0x75>
+                width = precision;
+  8076fd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  807701:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  807707:	eb 8d                	jmp    807696 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  807709:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80770d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  807711:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807715:	eb da                	jmp    8076f1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  807717:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80771c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  807720:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  807726:	3c 39                	cmp    $0x39,%al
+  807728:	77 1c                	ja     807746 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80772a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80772e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  807732:	0f b6 c0             	movzbl %al,%eax
+  807735:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80773a:	0f b6 03             	movzbl (%rbx),%eax
+  80773d:	3c 39                	cmp    $0x39,%al
+  80773f:	76 e9                	jbe    80772a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  807741:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  807744:	eb b1                	jmp    8076f7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  807746:	49 89 dc             	mov    %rbx,%r12
+  807749:	eb ac                	jmp    8076f7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80774b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80774e:	85 c9                	test   %ecx,%ecx
+  807750:	b8 00 00 00 00       	mov    $0x0,%eax
+  807755:	0f 49 c1             	cmovns %ecx,%eax
+  807758:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80775b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80775e:	e9 33 ff ff ff       	jmp    807696 <vprintfmt+0x75>
+            lflag++;
+  807763:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  807766:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  807769:	e9 28 ff ff ff       	jmp    807696 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80776e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807771:	83 f8 2f             	cmp    $0x2f,%eax
+  807774:	77 19                	ja     80778f <vprintfmt+0x16e>
+  807776:	89 c2                	mov    %eax,%edx
+  807778:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80777c:	83 c0 08             	add    $0x8,%eax
+  80777f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807782:	8b 3a                	mov    (%rdx),%edi
+  807784:	4c 89 ee             	mov    %r13,%rsi
+  807787:	41 ff d6             	call   *%r14
+            break;
+  80778a:	e9 c3 fe ff ff       	jmp    807652 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80778f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807793:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807797:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80779b:	eb e5                	jmp    807782 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80779d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8077a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8077a3:	77 5a                	ja     8077ff <vprintfmt+0x1de>
+  8077a5:	89 c2                	mov    %eax,%edx
+  8077a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8077ab:	83 c0 08             	add    $0x8,%eax
+  8077ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8077b1:	8b 02                	mov    (%rdx),%eax
+  8077b3:	89 c1                	mov    %eax,%ecx
+  8077b5:	f7 d9                	neg    %ecx
+  8077b7:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8077ba:	83 f9 16             	cmp    $0x16,%ecx
+  8077bd:	7f 4e                	jg     80780d <vprintfmt+0x1ec>
+  8077bf:	48 63 c1             	movslq %ecx,%rax
+  8077c2:	48 ba 60 c8 80 00 00 	movabs $0x80c860,%rdx
+  8077c9:	00 00 00 
+  8077cc:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8077d0:	48 85 c0             	test   %rax,%rax
+  8077d3:	74 38                	je     80780d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8077d5:	48 89 c1             	mov    %rax,%rcx
+  8077d8:	48 ba 1f bc 80 00 00 	movabs $0x80bc1f,%rdx
+  8077df:	00 00 00 
+  8077e2:	4c 89 ee             	mov    %r13,%rsi
+  8077e5:	4c 89 f7             	mov    %r14,%rdi
+  8077e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8077ed:	49 b8 e4 75 80 00 00 	movabs $0x8075e4,%r8
+  8077f4:	00 00 00 
+  8077f7:	41 ff d0             	call   *%r8
+  8077fa:	e9 53 fe ff ff       	jmp    807652 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8077ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807803:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80780b:	eb a4                	jmp    8077b1 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80780d:	48 ba 04 c4 80 00 00 	movabs $0x80c404,%rdx
+  807814:	00 00 00 
+  807817:	4c 89 ee             	mov    %r13,%rsi
+  80781a:	4c 89 f7             	mov    %r14,%rdi
+  80781d:	b8 00 00 00 00       	mov    $0x0,%eax
+  807822:	49 b8 e4 75 80 00 00 	movabs $0x8075e4,%r8
+  807829:	00 00 00 
+  80782c:	41 ff d0             	call   *%r8
+  80782f:	e9 1e fe ff ff       	jmp    807652 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  807834:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807837:	83 f8 2f             	cmp    $0x2f,%eax
+  80783a:	77 6c                	ja     8078a8 <vprintfmt+0x287>
+  80783c:	89 c2                	mov    %eax,%edx
+  80783e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807842:	83 c0 08             	add    $0x8,%eax
+  807845:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807848:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80784b:	48 85 d2             	test   %rdx,%rdx
+  80784e:	48 b8 fd c3 80 00 00 	movabs $0x80c3fd,%rax
+  807855:	00 00 00 
+  807858:	48 0f 45 c2          	cmovne %rdx,%rax
+  80785c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  807860:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  807864:	7e 06                	jle    80786c <vprintfmt+0x24b>
+  807866:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80786a:	75 4a                	jne    8078b6 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80786c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  807870:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  807874:	0f b6 00             	movzbl (%rax),%eax
+  807877:	84 c0                	test   %al,%al
+  807879:	0f 85 9a 00 00 00    	jne    807919 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80787f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  807882:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  807886:	85 c0                	test   %eax,%eax
+  807888:	0f 8e c4 fd ff ff    	jle    807652 <vprintfmt+0x31>
+  80788e:	4c 89 ee             	mov    %r13,%rsi
+  807891:	bf 20 00 00 00       	mov    $0x20,%edi
+  807896:	41 ff d6             	call   *%r14
+  807899:	41 83 ec 01          	sub    $0x1,%r12d
+  80789d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8078a1:	75 eb                	jne    80788e <vprintfmt+0x26d>
+  8078a3:	e9 aa fd ff ff       	jmp    807652 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8078a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8078ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8078b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8078b4:	eb 92                	jmp    807848 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8078b6:	49 63 f7             	movslq %r15d,%rsi
+  8078b9:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8078bd:	48 b8 d3 7d 80 00 00 	movabs $0x807dd3,%rax
+  8078c4:	00 00 00 
+  8078c7:	ff d0                	call   *%rax
+  8078c9:	48 89 c2             	mov    %rax,%rdx
+  8078cc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8078cf:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8078d1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8078d4:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8078d7:	85 c0                	test   %eax,%eax
+  8078d9:	7e 91                	jle    80786c <vprintfmt+0x24b>
+  8078db:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8078e0:	4c 89 ee             	mov    %r13,%rsi
+  8078e3:	44 89 e7             	mov    %r12d,%edi
+  8078e6:	41 ff d6             	call   *%r14
+  8078e9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8078ed:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8078f0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8078f3:	75 eb                	jne    8078e0 <vprintfmt+0x2bf>
+  8078f5:	e9 72 ff ff ff       	jmp    80786c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8078fa:	0f b6 f8             	movzbl %al,%edi
+  8078fd:	4c 89 ee             	mov    %r13,%rsi
+  807900:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  807903:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  807907:	49 83 c4 01          	add    $0x1,%r12
+  80790b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  807911:	84 c0                	test   %al,%al
+  807913:	0f 84 66 ff ff ff    	je     80787f <vprintfmt+0x25e>
+  807919:	45 85 ff             	test   %r15d,%r15d
+  80791c:	78 0a                	js     807928 <vprintfmt+0x307>
+  80791e:	41 83 ef 01          	sub    $0x1,%r15d
+  807922:	0f 88 57 ff ff ff    	js     80787f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  807928:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80792c:	74 cc                	je     8078fa <vprintfmt+0x2d9>
+  80792e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  807931:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  807936:	80 fa 5e             	cmp    $0x5e,%dl
+  807939:	77 c2                	ja     8078fd <vprintfmt+0x2dc>
+  80793b:	eb bd                	jmp    8078fa <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80793d:	40 84 f6             	test   %sil,%sil
+  807940:	75 26                	jne    807968 <vprintfmt+0x347>
+    switch (lflag) {
+  807942:	85 d2                	test   %edx,%edx
+  807944:	74 59                	je     80799f <vprintfmt+0x37e>
+  807946:	83 fa 01             	cmp    $0x1,%edx
+  807949:	74 7b                	je     8079c6 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80794b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80794e:	83 f8 2f             	cmp    $0x2f,%eax
+  807951:	0f 87 96 00 00 00    	ja     8079ed <vprintfmt+0x3cc>
+  807957:	89 c2                	mov    %eax,%edx
+  807959:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80795d:	83 c0 08             	add    $0x8,%eax
+  807960:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807963:	4c 8b 22             	mov    (%rdx),%r12
+  807966:	eb 17                	jmp    80797f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  807968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80796b:	83 f8 2f             	cmp    $0x2f,%eax
+  80796e:	77 21                	ja     807991 <vprintfmt+0x370>
+  807970:	89 c2                	mov    %eax,%edx
+  807972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807976:	83 c0 08             	add    $0x8,%eax
+  807979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80797c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80797f:	4d 85 e4             	test   %r12,%r12
+  807982:	78 7a                	js     8079fe <vprintfmt+0x3dd>
+            num = i;
+  807984:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  807987:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80798c:	e9 50 02 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  807991:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807995:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807999:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80799d:	eb dd                	jmp    80797c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80799f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8079a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8079a5:	77 11                	ja     8079b8 <vprintfmt+0x397>
+  8079a7:	89 c2                	mov    %eax,%edx
+  8079a9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8079ad:	83 c0 08             	add    $0x8,%eax
+  8079b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8079b3:	4c 63 22             	movslq (%rdx),%r12
+  8079b6:	eb c7                	jmp    80797f <vprintfmt+0x35e>
+  8079b8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8079bc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8079c0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8079c4:	eb ed                	jmp    8079b3 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8079c6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8079c9:	83 f8 2f             	cmp    $0x2f,%eax
+  8079cc:	77 11                	ja     8079df <vprintfmt+0x3be>
+  8079ce:	89 c2                	mov    %eax,%edx
+  8079d0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8079d4:	83 c0 08             	add    $0x8,%eax
+  8079d7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8079da:	4c 8b 22             	mov    (%rdx),%r12
+  8079dd:	eb a0                	jmp    80797f <vprintfmt+0x35e>
+  8079df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8079e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8079e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8079eb:	eb ed                	jmp    8079da <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8079ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8079f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8079f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8079f9:	e9 65 ff ff ff       	jmp    807963 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8079fe:	4c 89 ee             	mov    %r13,%rsi
+  807a01:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  807a06:	41 ff d6             	call   *%r14
+                i = -i;
+  807a09:	49 f7 dc             	neg    %r12
+  807a0c:	e9 73 ff ff ff       	jmp    807984 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  807a11:	40 84 f6             	test   %sil,%sil
+  807a14:	75 32                	jne    807a48 <vprintfmt+0x427>
+    switch (lflag) {
+  807a16:	85 d2                	test   %edx,%edx
+  807a18:	74 5d                	je     807a77 <vprintfmt+0x456>
+  807a1a:	83 fa 01             	cmp    $0x1,%edx
+  807a1d:	0f 84 82 00 00 00    	je     807aa5 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  807a23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807a26:	83 f8 2f             	cmp    $0x2f,%eax
+  807a29:	0f 87 a5 00 00 00    	ja     807ad4 <vprintfmt+0x4b3>
+  807a2f:	89 c2                	mov    %eax,%edx
+  807a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807a35:	83 c0 08             	add    $0x8,%eax
+  807a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807a3b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  807a3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  807a43:	e9 99 01 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  807a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  807a4e:	77 19                	ja     807a69 <vprintfmt+0x448>
+  807a50:	89 c2                	mov    %eax,%edx
+  807a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807a56:	83 c0 08             	add    $0x8,%eax
+  807a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807a5c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  807a5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  807a64:	e9 78 01 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+  807a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807a75:	eb e5                	jmp    807a5c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  807a77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807a7a:	83 f8 2f             	cmp    $0x2f,%eax
+  807a7d:	77 18                	ja     807a97 <vprintfmt+0x476>
+  807a7f:	89 c2                	mov    %eax,%edx
+  807a81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807a85:	83 c0 08             	add    $0x8,%eax
+  807a88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807a8b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  807a8d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  807a92:	e9 4a 01 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+  807a97:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807a9b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807a9f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807aa3:	eb e6                	jmp    807a8b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  807aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  807aab:	77 19                	ja     807ac6 <vprintfmt+0x4a5>
+  807aad:	89 c2                	mov    %eax,%edx
+  807aaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807ab3:	83 c0 08             	add    $0x8,%eax
+  807ab6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807ab9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  807abc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  807ac1:	e9 1b 01 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+  807ac6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807aca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807ace:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807ad2:	eb e5                	jmp    807ab9 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  807ad4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807ad8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807adc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807ae0:	e9 56 ff ff ff       	jmp    807a3b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  807ae5:	40 84 f6             	test   %sil,%sil
+  807ae8:	75 2e                	jne    807b18 <vprintfmt+0x4f7>
+    switch (lflag) {
+  807aea:	85 d2                	test   %edx,%edx
+  807aec:	74 59                	je     807b47 <vprintfmt+0x526>
+  807aee:	83 fa 01             	cmp    $0x1,%edx
+  807af1:	74 7f                	je     807b72 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  807af3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807af6:	83 f8 2f             	cmp    $0x2f,%eax
+  807af9:	0f 87 9f 00 00 00    	ja     807b9e <vprintfmt+0x57d>
+  807aff:	89 c2                	mov    %eax,%edx
+  807b01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807b05:	83 c0 08             	add    $0x8,%eax
+  807b08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807b0b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  807b0e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  807b13:	e9 c9 00 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  807b18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807b1b:	83 f8 2f             	cmp    $0x2f,%eax
+  807b1e:	77 19                	ja     807b39 <vprintfmt+0x518>
+  807b20:	89 c2                	mov    %eax,%edx
+  807b22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807b26:	83 c0 08             	add    $0x8,%eax
+  807b29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807b2c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  807b2f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  807b34:	e9 a8 00 00 00       	jmp    807be1 <vprintfmt+0x5c0>
+  807b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807b3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807b45:	eb e5                	jmp    807b2c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  807b47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807b4a:	83 f8 2f             	cmp    $0x2f,%eax
+  807b4d:	77 15                	ja     807b64 <vprintfmt+0x543>
+  807b4f:	89 c2                	mov    %eax,%edx
+  807b51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807b55:	83 c0 08             	add    $0x8,%eax
+  807b58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807b5b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  807b5d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  807b62:	eb 7d                	jmp    807be1 <vprintfmt+0x5c0>
+  807b64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807b68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807b6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807b70:	eb e9                	jmp    807b5b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  807b72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807b75:	83 f8 2f             	cmp    $0x2f,%eax
+  807b78:	77 16                	ja     807b90 <vprintfmt+0x56f>
+  807b7a:	89 c2                	mov    %eax,%edx
+  807b7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807b80:	83 c0 08             	add    $0x8,%eax
+  807b83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807b86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  807b89:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  807b8e:	eb 51                	jmp    807be1 <vprintfmt+0x5c0>
+  807b90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807b94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807b98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807b9c:	eb e8                	jmp    807b86 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  807b9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807ba2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807ba6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807baa:	e9 5c ff ff ff       	jmp    807b0b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  807baf:	4c 89 ee             	mov    %r13,%rsi
+  807bb2:	bf 30 00 00 00       	mov    $0x30,%edi
+  807bb7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  807bba:	4c 89 ee             	mov    %r13,%rsi
+  807bbd:	bf 78 00 00 00       	mov    $0x78,%edi
+  807bc2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  807bc5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807bc8:	83 f8 2f             	cmp    $0x2f,%eax
+  807bcb:	77 47                	ja     807c14 <vprintfmt+0x5f3>
+  807bcd:	89 c2                	mov    %eax,%edx
+  807bcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807bd3:	83 c0 08             	add    $0x8,%eax
+  807bd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807bd9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  807bdc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  807be1:	48 83 ec 08          	sub    $0x8,%rsp
+  807be5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  807be9:	0f 94 c0             	sete   %al
+  807bec:	0f b6 c0             	movzbl %al,%eax
+  807bef:	50                   	push   %rax
+  807bf0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  807bf5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  807bf9:	4c 89 ee             	mov    %r13,%rsi
+  807bfc:	4c 89 f7             	mov    %r14,%rdi
+  807bff:	48 b8 16 75 80 00 00 	movabs $0x807516,%rax
+  807c06:	00 00 00 
+  807c09:	ff d0                	call   *%rax
+            break;
+  807c0b:	48 83 c4 10          	add    $0x10,%rsp
+  807c0f:	e9 3e fa ff ff       	jmp    807652 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  807c14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807c18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807c1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807c20:	eb b7                	jmp    807bd9 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  807c22:	40 84 f6             	test   %sil,%sil
+  807c25:	75 2b                	jne    807c52 <vprintfmt+0x631>
+    switch (lflag) {
+  807c27:	85 d2                	test   %edx,%edx
+  807c29:	74 56                	je     807c81 <vprintfmt+0x660>
+  807c2b:	83 fa 01             	cmp    $0x1,%edx
+  807c2e:	74 7f                	je     807caf <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  807c30:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807c33:	83 f8 2f             	cmp    $0x2f,%eax
+  807c36:	0f 87 a2 00 00 00    	ja     807cde <vprintfmt+0x6bd>
+  807c3c:	89 c2                	mov    %eax,%edx
+  807c3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807c42:	83 c0 08             	add    $0x8,%eax
+  807c45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807c48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  807c4b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  807c50:	eb 8f                	jmp    807be1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  807c52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807c55:	83 f8 2f             	cmp    $0x2f,%eax
+  807c58:	77 19                	ja     807c73 <vprintfmt+0x652>
+  807c5a:	89 c2                	mov    %eax,%edx
+  807c5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807c60:	83 c0 08             	add    $0x8,%eax
+  807c63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807c66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  807c69:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  807c6e:	e9 6e ff ff ff       	jmp    807be1 <vprintfmt+0x5c0>
+  807c73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807c77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807c7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807c7f:	eb e5                	jmp    807c66 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  807c81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807c84:	83 f8 2f             	cmp    $0x2f,%eax
+  807c87:	77 18                	ja     807ca1 <vprintfmt+0x680>
+  807c89:	89 c2                	mov    %eax,%edx
+  807c8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807c8f:	83 c0 08             	add    $0x8,%eax
+  807c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807c95:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  807c97:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  807c9c:	e9 40 ff ff ff       	jmp    807be1 <vprintfmt+0x5c0>
+  807ca1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807ca5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807ca9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807cad:	eb e6                	jmp    807c95 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  807caf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  807cb2:	83 f8 2f             	cmp    $0x2f,%eax
+  807cb5:	77 19                	ja     807cd0 <vprintfmt+0x6af>
+  807cb7:	89 c2                	mov    %eax,%edx
+  807cb9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  807cbd:	83 c0 08             	add    $0x8,%eax
+  807cc0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  807cc3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  807cc6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  807ccb:	e9 11 ff ff ff       	jmp    807be1 <vprintfmt+0x5c0>
+  807cd0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807cd4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807cd8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807cdc:	eb e5                	jmp    807cc3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  807cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  807ce2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  807ce6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807cea:	e9 59 ff ff ff       	jmp    807c48 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  807cef:	4c 89 ee             	mov    %r13,%rsi
+  807cf2:	bf 25 00 00 00       	mov    $0x25,%edi
+  807cf7:	41 ff d6             	call   *%r14
+            break;
+  807cfa:	e9 53 f9 ff ff       	jmp    807652 <vprintfmt+0x31>
+            putch('%', put_arg);
+  807cff:	4c 89 ee             	mov    %r13,%rsi
+  807d02:	bf 25 00 00 00       	mov    $0x25,%edi
+  807d07:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  807d0a:	48 83 eb 01          	sub    $0x1,%rbx
+  807d0e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  807d12:	75 f6                	jne    807d0a <vprintfmt+0x6e9>
+  807d14:	e9 39 f9 ff ff       	jmp    807652 <vprintfmt+0x31>
+}
+  807d19:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  807d1d:	5b                   	pop    %rbx
+  807d1e:	41 5c                	pop    %r12
+  807d20:	41 5d                	pop    %r13
+  807d22:	41 5e                	pop    %r14
+  807d24:	41 5f                	pop    %r15
+  807d26:	5d                   	pop    %rbp
+  807d27:	c3                   	ret
+
+0000000000807d28 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  807d28:	55                   	push   %rbp
+  807d29:	48 89 e5             	mov    %rsp,%rbp
+  807d2c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  807d30:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  807d34:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  807d39:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  807d3d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  807d44:	48 85 ff             	test   %rdi,%rdi
+  807d47:	74 2b                	je     807d74 <vsnprintf+0x4c>
+  807d49:	48 85 f6             	test   %rsi,%rsi
+  807d4c:	74 26                	je     807d74 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  807d4e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  807d52:	48 bf cc 75 80 00 00 	movabs $0x8075cc,%rdi
+  807d59:	00 00 00 
+  807d5c:	48 b8 21 76 80 00 00 	movabs $0x807621,%rax
+  807d63:	00 00 00 
+  807d66:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  807d68:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  807d6c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  807d6f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  807d72:	c9                   	leave
+  807d73:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  807d74:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  807d79:	eb f7                	jmp    807d72 <vsnprintf+0x4a>
+
+0000000000807d7b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  807d7b:	55                   	push   %rbp
+  807d7c:	48 89 e5             	mov    %rsp,%rbp
+  807d7f:	48 83 ec 50          	sub    $0x50,%rsp
+  807d83:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  807d87:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  807d8b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  807d8f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  807d96:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  807d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  807d9e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  807da2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  807da6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  807daa:	48 b8 28 7d 80 00 00 	movabs $0x807d28,%rax
+  807db1:	00 00 00 
+  807db4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  807db6:	c9                   	leave
+  807db7:	c3                   	ret
+
+0000000000807db8 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  807db8:	80 3f 00             	cmpb   $0x0,(%rdi)
+  807dbb:	74 10                	je     807dcd <strlen+0x15>
+    size_t n = 0;
+  807dbd:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  807dc2:	48 83 c0 01          	add    $0x1,%rax
+  807dc6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  807dca:	75 f6                	jne    807dc2 <strlen+0xa>
+  807dcc:	c3                   	ret
+    size_t n = 0;
+  807dcd:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  807dd2:	c3                   	ret
+
+0000000000807dd3 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  807dd3:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  807dd6:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  807ddb:	48 85 f6             	test   %rsi,%rsi
+  807dde:	74 11                	je     807df1 <strnlen+0x1e>
+  807de0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  807de4:	74 0c                	je     807df2 <strnlen+0x1f>
+  807de6:	48 83 c2 01          	add    $0x1,%rdx
+  807dea:	48 39 d0             	cmp    %rdx,%rax
+  807ded:	75 f1                	jne    807de0 <strnlen+0xd>
+  807def:	eb 04                	jmp    807df5 <strnlen+0x22>
+  807df1:	c3                   	ret
+  807df2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  807df5:	c3                   	ret
+
+0000000000807df6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  807df6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  807df9:	ba 00 00 00 00       	mov    $0x0,%edx
+  807dfe:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  807e02:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  807e05:	48 83 c2 01          	add    $0x1,%rdx
+  807e09:	84 c9                	test   %cl,%cl
+  807e0b:	75 f1                	jne    807dfe <strcpy+0x8>
+        ;
+    return res;
+}
+  807e0d:	c3                   	ret
+
+0000000000807e0e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  807e0e:	55                   	push   %rbp
+  807e0f:	48 89 e5             	mov    %rsp,%rbp
+  807e12:	41 54                	push   %r12
+  807e14:	53                   	push   %rbx
+  807e15:	48 89 fb             	mov    %rdi,%rbx
+  807e18:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  807e1b:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  807e22:	00 00 00 
+  807e25:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  807e27:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  807e2b:	4c 89 e6             	mov    %r12,%rsi
+  807e2e:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  807e35:	00 00 00 
+  807e38:	ff d0                	call   *%rax
+    return dst;
+}
+  807e3a:	48 89 d8             	mov    %rbx,%rax
+  807e3d:	5b                   	pop    %rbx
+  807e3e:	41 5c                	pop    %r12
+  807e40:	5d                   	pop    %rbp
+  807e41:	c3                   	ret
+
+0000000000807e42 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  807e42:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  807e45:	48 85 d2             	test   %rdx,%rdx
+  807e48:	74 1f                	je     807e69 <strncpy+0x27>
+  807e4a:	48 01 fa             	add    %rdi,%rdx
+  807e4d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  807e50:	48 83 c1 01          	add    $0x1,%rcx
+  807e54:	44 0f b6 06          	movzbl (%rsi),%r8d
+  807e58:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  807e5c:	41 80 f8 01          	cmp    $0x1,%r8b
+  807e60:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  807e64:	48 39 ca             	cmp    %rcx,%rdx
+  807e67:	75 e7                	jne    807e50 <strncpy+0xe>
+    }
+    return ret;
+}
+  807e69:	c3                   	ret
+
+0000000000807e6a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  807e6a:	48 89 f8             	mov    %rdi,%rax
+  807e6d:	48 85 d2             	test   %rdx,%rdx
+  807e70:	74 24                	je     807e96 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  807e72:	48 83 ea 01          	sub    $0x1,%rdx
+  807e76:	74 1b                	je     807e93 <strlcpy+0x29>
+  807e78:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  807e7c:	0f b6 16             	movzbl (%rsi),%edx
+  807e7f:	84 d2                	test   %dl,%dl
+  807e81:	74 10                	je     807e93 <strlcpy+0x29>
+            *dst++ = *src++;
+  807e83:	48 83 c6 01          	add    $0x1,%rsi
+  807e87:	48 83 c0 01          	add    $0x1,%rax
+  807e8b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  807e8e:	48 39 c8             	cmp    %rcx,%rax
+  807e91:	75 e9                	jne    807e7c <strlcpy+0x12>
+        *dst = '\0';
+  807e93:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  807e96:	48 29 f8             	sub    %rdi,%rax
+}
+  807e99:	c3                   	ret
+
+0000000000807e9a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  807e9a:	0f b6 07             	movzbl (%rdi),%eax
+  807e9d:	84 c0                	test   %al,%al
+  807e9f:	74 13                	je     807eb4 <strcmp+0x1a>
+  807ea1:	38 06                	cmp    %al,(%rsi)
+  807ea3:	75 0f                	jne    807eb4 <strcmp+0x1a>
+  807ea5:	48 83 c7 01          	add    $0x1,%rdi
+  807ea9:	48 83 c6 01          	add    $0x1,%rsi
+  807ead:	0f b6 07             	movzbl (%rdi),%eax
+  807eb0:	84 c0                	test   %al,%al
+  807eb2:	75 ed                	jne    807ea1 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  807eb4:	0f b6 c0             	movzbl %al,%eax
+  807eb7:	0f b6 16             	movzbl (%rsi),%edx
+  807eba:	29 d0                	sub    %edx,%eax
+}
+  807ebc:	c3                   	ret
+
+0000000000807ebd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  807ebd:	48 85 d2             	test   %rdx,%rdx
+  807ec0:	74 1f                	je     807ee1 <strncmp+0x24>
+  807ec2:	0f b6 07             	movzbl (%rdi),%eax
+  807ec5:	84 c0                	test   %al,%al
+  807ec7:	74 1e                	je     807ee7 <strncmp+0x2a>
+  807ec9:	3a 06                	cmp    (%rsi),%al
+  807ecb:	75 1a                	jne    807ee7 <strncmp+0x2a>
+  807ecd:	48 83 c7 01          	add    $0x1,%rdi
+  807ed1:	48 83 c6 01          	add    $0x1,%rsi
+  807ed5:	48 83 ea 01          	sub    $0x1,%rdx
+  807ed9:	75 e7                	jne    807ec2 <strncmp+0x5>
+
+    if (!n) return 0;
+  807edb:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ee0:	c3                   	ret
+  807ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  807ee6:	c3                   	ret
+  807ee7:	48 85 d2             	test   %rdx,%rdx
+  807eea:	74 09                	je     807ef5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  807eec:	0f b6 07             	movzbl (%rdi),%eax
+  807eef:	0f b6 16             	movzbl (%rsi),%edx
+  807ef2:	29 d0                	sub    %edx,%eax
+  807ef4:	c3                   	ret
+    if (!n) return 0;
+  807ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  807efa:	c3                   	ret
+
+0000000000807efb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  807efb:	0f b6 17             	movzbl (%rdi),%edx
+  807efe:	84 d2                	test   %dl,%dl
+  807f00:	74 18                	je     807f1a <strchr+0x1f>
+        if (*str == c) {
+  807f02:	0f be d2             	movsbl %dl,%edx
+  807f05:	39 f2                	cmp    %esi,%edx
+  807f07:	74 17                	je     807f20 <strchr+0x25>
+    for (; *str; str++) {
+  807f09:	48 83 c7 01          	add    $0x1,%rdi
+  807f0d:	0f b6 17             	movzbl (%rdi),%edx
+  807f10:	84 d2                	test   %dl,%dl
+  807f12:	75 ee                	jne    807f02 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  807f14:	b8 00 00 00 00       	mov    $0x0,%eax
+  807f19:	c3                   	ret
+  807f1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  807f1f:	c3                   	ret
+  807f20:	48 89 f8             	mov    %rdi,%rax
+}
+  807f23:	c3                   	ret
+
+0000000000807f24 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  807f24:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  807f27:	0f b6 17             	movzbl (%rdi),%edx
+  807f2a:	84 d2                	test   %dl,%dl
+  807f2c:	74 13                	je     807f41 <strfind+0x1d>
+  807f2e:	0f be d2             	movsbl %dl,%edx
+  807f31:	39 f2                	cmp    %esi,%edx
+  807f33:	74 0b                	je     807f40 <strfind+0x1c>
+  807f35:	48 83 c0 01          	add    $0x1,%rax
+  807f39:	0f b6 10             	movzbl (%rax),%edx
+  807f3c:	84 d2                	test   %dl,%dl
+  807f3e:	75 ee                	jne    807f2e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  807f40:	c3                   	ret
+  807f41:	c3                   	ret
+
+0000000000807f42 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  807f42:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  807f45:	48 89 f8             	mov    %rdi,%rax
+  807f48:	48 f7 d8             	neg    %rax
+  807f4b:	83 e0 07             	and    $0x7,%eax
+  807f4e:	49 89 d1             	mov    %rdx,%r9
+  807f51:	49 29 c1             	sub    %rax,%r9
+  807f54:	78 36                	js     807f8c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  807f56:	40 0f b6 c6          	movzbl %sil,%eax
+  807f5a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  807f61:	01 01 01 
+  807f64:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  807f68:	40 f6 c7 07          	test   $0x7,%dil
+  807f6c:	75 38                	jne    807fa6 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  807f6e:	4c 89 c9             	mov    %r9,%rcx
+  807f71:	48 c1 f9 03          	sar    $0x3,%rcx
+  807f75:	74 0c                	je     807f83 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  807f77:	fc                   	cld
+  807f78:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  807f7b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  807f7f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  807f83:	4d 85 c9             	test   %r9,%r9
+  807f86:	75 45                	jne    807fcd <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  807f88:	4c 89 c0             	mov    %r8,%rax
+  807f8b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  807f8c:	48 85 d2             	test   %rdx,%rdx
+  807f8f:	74 f7                	je     807f88 <memset+0x46>
+  807f91:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  807f94:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  807f97:	48 83 c0 01          	add    $0x1,%rax
+  807f9b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  807f9f:	48 39 c2             	cmp    %rax,%rdx
+  807fa2:	75 f3                	jne    807f97 <memset+0x55>
+  807fa4:	eb e2                	jmp    807f88 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  807fa6:	40 f6 c7 01          	test   $0x1,%dil
+  807faa:	74 06                	je     807fb2 <memset+0x70>
+  807fac:	88 07                	mov    %al,(%rdi)
+  807fae:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  807fb2:	40 f6 c7 02          	test   $0x2,%dil
+  807fb6:	74 07                	je     807fbf <memset+0x7d>
+  807fb8:	66 89 07             	mov    %ax,(%rdi)
+  807fbb:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  807fbf:	40 f6 c7 04          	test   $0x4,%dil
+  807fc3:	74 a9                	je     807f6e <memset+0x2c>
+  807fc5:	89 07                	mov    %eax,(%rdi)
+  807fc7:	48 83 c7 04          	add    $0x4,%rdi
+  807fcb:	eb a1                	jmp    807f6e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  807fcd:	41 f6 c1 04          	test   $0x4,%r9b
+  807fd1:	74 06                	je     807fd9 <memset+0x97>
+  807fd3:	89 07                	mov    %eax,(%rdi)
+  807fd5:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  807fd9:	41 f6 c1 02          	test   $0x2,%r9b
+  807fdd:	74 07                	je     807fe6 <memset+0xa4>
+  807fdf:	66 89 07             	mov    %ax,(%rdi)
+  807fe2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  807fe6:	41 f6 c1 01          	test   $0x1,%r9b
+  807fea:	74 9c                	je     807f88 <memset+0x46>
+  807fec:	88 07                	mov    %al,(%rdi)
+  807fee:	eb 98                	jmp    807f88 <memset+0x46>
+
+0000000000807ff0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  807ff0:	48 89 f8             	mov    %rdi,%rax
+  807ff3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  807ff6:	48 39 fe             	cmp    %rdi,%rsi
+  807ff9:	73 3b                	jae    808036 <memmove+0x46>
+  807ffb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  807fff:	48 39 d7             	cmp    %rdx,%rdi
+  808002:	73 32                	jae    808036 <memmove+0x46>
+        s += n;
+        d += n;
+  808004:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  808008:	48 89 d6             	mov    %rdx,%rsi
+  80800b:	48 09 fe             	or     %rdi,%rsi
+  80800e:	48 09 ce             	or     %rcx,%rsi
+  808011:	40 f6 c6 07          	test   $0x7,%sil
+  808015:	75 12                	jne    808029 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  808017:	48 83 ef 08          	sub    $0x8,%rdi
+  80801b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80801f:	48 c1 e9 03          	shr    $0x3,%rcx
+  808023:	fd                   	std
+  808024:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  808027:	fc                   	cld
+  808028:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  808029:	48 83 ef 01          	sub    $0x1,%rdi
+  80802d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  808031:	fd                   	std
+  808032:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  808034:	eb f1                	jmp    808027 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  808036:	48 89 f2             	mov    %rsi,%rdx
+  808039:	48 09 c2             	or     %rax,%rdx
+  80803c:	48 09 ca             	or     %rcx,%rdx
+  80803f:	f6 c2 07             	test   $0x7,%dl
+  808042:	75 0c                	jne    808050 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  808044:	48 c1 e9 03          	shr    $0x3,%rcx
+  808048:	48 89 c7             	mov    %rax,%rdi
+  80804b:	fc                   	cld
+  80804c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80804f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  808050:	48 89 c7             	mov    %rax,%rdi
+  808053:	fc                   	cld
+  808054:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  808056:	c3                   	ret
+
+0000000000808057 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  808057:	55                   	push   %rbp
+  808058:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80805b:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  808062:	00 00 00 
+  808065:	ff d0                	call   *%rax
+}
+  808067:	5d                   	pop    %rbp
+  808068:	c3                   	ret
+
+0000000000808069 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  808069:	55                   	push   %rbp
+  80806a:	48 89 e5             	mov    %rsp,%rbp
+  80806d:	41 57                	push   %r15
+  80806f:	41 56                	push   %r14
+  808071:	41 55                	push   %r13
+  808073:	41 54                	push   %r12
+  808075:	53                   	push   %rbx
+  808076:	48 83 ec 08          	sub    $0x8,%rsp
+  80807a:	49 89 fe             	mov    %rdi,%r14
+  80807d:	49 89 f7             	mov    %rsi,%r15
+  808080:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  808083:	48 89 f7             	mov    %rsi,%rdi
+  808086:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  80808d:	00 00 00 
+  808090:	ff d0                	call   *%rax
+  808092:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  808095:	48 89 de             	mov    %rbx,%rsi
+  808098:	4c 89 f7             	mov    %r14,%rdi
+  80809b:	48 b8 d3 7d 80 00 00 	movabs $0x807dd3,%rax
+  8080a2:	00 00 00 
+  8080a5:	ff d0                	call   *%rax
+  8080a7:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8080aa:	48 39 c3             	cmp    %rax,%rbx
+  8080ad:	74 36                	je     8080e5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8080af:	48 89 d8             	mov    %rbx,%rax
+  8080b2:	4c 29 e8             	sub    %r13,%rax
+  8080b5:	49 39 c4             	cmp    %rax,%r12
+  8080b8:	73 31                	jae    8080eb <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8080ba:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8080bf:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8080c3:	4c 89 fe             	mov    %r15,%rsi
+  8080c6:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  8080cd:	00 00 00 
+  8080d0:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8080d2:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8080d6:	48 83 c4 08          	add    $0x8,%rsp
+  8080da:	5b                   	pop    %rbx
+  8080db:	41 5c                	pop    %r12
+  8080dd:	41 5d                	pop    %r13
+  8080df:	41 5e                	pop    %r14
+  8080e1:	41 5f                	pop    %r15
+  8080e3:	5d                   	pop    %rbp
+  8080e4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8080e5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8080e9:	eb eb                	jmp    8080d6 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8080eb:	48 83 eb 01          	sub    $0x1,%rbx
+  8080ef:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8080f3:	48 89 da             	mov    %rbx,%rdx
+  8080f6:	4c 89 fe             	mov    %r15,%rsi
+  8080f9:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  808100:	00 00 00 
+  808103:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  808105:	49 01 de             	add    %rbx,%r14
+  808108:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80810d:	eb c3                	jmp    8080d2 <strlcat+0x69>
+
+000000000080810f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80810f:	48 85 d2             	test   %rdx,%rdx
+  808112:	74 2d                	je     808141 <memcmp+0x32>
+  808114:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  808119:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80811d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  808122:	44 38 c1             	cmp    %r8b,%cl
+  808125:	75 0f                	jne    808136 <memcmp+0x27>
+    while (n-- > 0) {
+  808127:	48 83 c0 01          	add    $0x1,%rax
+  80812b:	48 39 c2             	cmp    %rax,%rdx
+  80812e:	75 e9                	jne    808119 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  808130:	b8 00 00 00 00       	mov    $0x0,%eax
+  808135:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  808136:	0f b6 c1             	movzbl %cl,%eax
+  808139:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80813d:	44 29 c0             	sub    %r8d,%eax
+  808140:	c3                   	ret
+    return 0;
+  808141:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808146:	c3                   	ret
+
+0000000000808147 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  808147:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80814b:	48 39 c7             	cmp    %rax,%rdi
+  80814e:	73 0f                	jae    80815f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  808150:	40 38 37             	cmp    %sil,(%rdi)
+  808153:	74 0e                	je     808163 <memfind+0x1c>
+    for (; src < end; src++) {
+  808155:	48 83 c7 01          	add    $0x1,%rdi
+  808159:	48 39 f8             	cmp    %rdi,%rax
+  80815c:	75 f2                	jne    808150 <memfind+0x9>
+  80815e:	c3                   	ret
+  80815f:	48 89 f8             	mov    %rdi,%rax
+  808162:	c3                   	ret
+  808163:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  808166:	c3                   	ret
+
+0000000000808167 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  808167:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80816a:	0f b6 37             	movzbl (%rdi),%esi
+  80816d:	40 80 fe 20          	cmp    $0x20,%sil
+  808171:	74 06                	je     808179 <strtol+0x12>
+  808173:	40 80 fe 09          	cmp    $0x9,%sil
+  808177:	75 13                	jne    80818c <strtol+0x25>
+  808179:	48 83 c7 01          	add    $0x1,%rdi
+  80817d:	0f b6 37             	movzbl (%rdi),%esi
+  808180:	40 80 fe 20          	cmp    $0x20,%sil
+  808184:	74 f3                	je     808179 <strtol+0x12>
+  808186:	40 80 fe 09          	cmp    $0x9,%sil
+  80818a:	74 ed                	je     808179 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80818c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80818f:	83 e0 fd             	and    $0xfffffffd,%eax
+  808192:	3c 01                	cmp    $0x1,%al
+  808194:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  808198:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80819e:	75 0f                	jne    8081af <strtol+0x48>
+  8081a0:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8081a3:	74 14                	je     8081b9 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8081a5:	85 d2                	test   %edx,%edx
+  8081a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8081ac:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8081af:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8081b4:	4c 63 ca             	movslq %edx,%r9
+  8081b7:	eb 36                	jmp    8081ef <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8081b9:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8081bd:	74 0f                	je     8081ce <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8081bf:	85 d2                	test   %edx,%edx
+  8081c1:	75 ec                	jne    8081af <strtol+0x48>
+        s++;
+  8081c3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8081c7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8081cc:	eb e1                	jmp    8081af <strtol+0x48>
+        s += 2;
+  8081ce:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8081d2:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8081d7:	eb d6                	jmp    8081af <strtol+0x48>
+            dig -= '0';
+  8081d9:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8081dc:	44 0f b6 c1          	movzbl %cl,%r8d
+  8081e0:	41 39 d0             	cmp    %edx,%r8d
+  8081e3:	7d 21                	jge    808206 <strtol+0x9f>
+        val = val * base + dig;
+  8081e5:	49 0f af c1          	imul   %r9,%rax
+  8081e9:	0f b6 c9             	movzbl %cl,%ecx
+  8081ec:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8081ef:	48 83 c7 01          	add    $0x1,%rdi
+  8081f3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8081f7:	80 f9 39             	cmp    $0x39,%cl
+  8081fa:	76 dd                	jbe    8081d9 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8081fc:	80 f9 7b             	cmp    $0x7b,%cl
+  8081ff:	77 05                	ja     808206 <strtol+0x9f>
+            dig -= 'a' - 10;
+  808201:	83 e9 57             	sub    $0x57,%ecx
+  808204:	eb d6                	jmp    8081dc <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  808206:	4d 85 d2             	test   %r10,%r10
+  808209:	74 03                	je     80820e <strtol+0xa7>
+  80820b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80820e:	48 89 c2             	mov    %rax,%rdx
+  808211:	48 f7 da             	neg    %rdx
+  808214:	40 80 fe 2d          	cmp    $0x2d,%sil
+  808218:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80821c:	c3                   	ret
+
+000000000080821d <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80821d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808222:	ba 00 00 00 00       	mov    $0x0,%edx
+  808227:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80822d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808233:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  808239:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80823b:	c3                   	ret
+
+000000000080823c <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80823c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  808241:	bf 00 00 00 00       	mov    $0x0,%edi
+  808246:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80824b:	ba 00 00 00 00       	mov    $0x0,%edx
+  808250:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808256:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80825c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808262:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  808264:	c3                   	ret
+
+0000000000808265 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  808265:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  808268:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80826d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808272:	ba 00 00 00 00       	mov    $0x0,%edx
+  808277:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80827d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808283:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808289:	0f 05                	syscall
+    if (check && ret > 0) {
+  80828b:	48 85 c0             	test   %rax,%rax
+  80828e:	7f 01                	jg     808291 <sys_env_destroy+0x2c>
+}
+  808290:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  808291:	55                   	push   %rbp
+  808292:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808295:	49 89 c0             	mov    %rax,%r8
+  808298:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80829d:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  8082a4:	00 00 00 
+  8082a7:	be 29 00 00 00       	mov    $0x29,%esi
+  8082ac:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  8082b3:	00 00 00 
+  8082b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8082bb:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  8082c2:	00 00 00 
+  8082c5:	41 ff d1             	call   *%r9
+
+00000000008082c8 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8082c8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8082cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8082d2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8082d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8082dc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8082e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8082e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8082ee:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8082f0:	c3                   	ret
+
+00000000008082f1 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8082f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8082f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8082fb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808300:	ba 00 00 00 00       	mov    $0x0,%edx
+  808305:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80830b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808311:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808317:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  808319:	c3                   	ret
+
+000000000080831a <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80831a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80831f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  808326:	00 00 00 
+  808329:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80832f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808335:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80833b:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80833d:	c3                   	ret
+
+000000000080833e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80833e:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  808341:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80834c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808352:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  808354:	c3                   	ret
+
+0000000000808355 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  808355:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  808358:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80835d:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808360:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808366:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80836c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80836e:	48 85 c0             	test   %rax,%rax
+  808371:	7f 01                	jg     808374 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  808373:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  808374:	55                   	push   %rbp
+  808375:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808378:	49 89 c0             	mov    %rax,%r8
+  80837b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  808380:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  808387:	00 00 00 
+  80838a:	be 29 00 00 00       	mov    $0x29,%esi
+  80838f:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  808396:	00 00 00 
+  808399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80839e:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  8083a5:	00 00 00 
+  8083a8:	41 ff d1             	call   *%r9
+
+00000000008083ab <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8083ab:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8083ae:	48 63 d2             	movslq %edx,%rdx
+  8083b1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8083b4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8083b9:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8083bc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8083be:	48 85 c0             	test   %rax,%rax
+  8083c1:	7f 01                	jg     8083c4 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8083c3:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8083c4:	55                   	push   %rbp
+  8083c5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8083c8:	49 89 c0             	mov    %rax,%r8
+  8083cb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8083d0:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  8083d7:	00 00 00 
+  8083da:	be 29 00 00 00       	mov    $0x29,%esi
+  8083df:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  8083e6:	00 00 00 
+  8083e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8083ee:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  8083f5:	00 00 00 
+  8083f8:	41 ff d1             	call   *%r9
+
+00000000008083fb <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8083fb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8083fe:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808403:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808409:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80840f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808415:	0f 05                	syscall
+    if (check && ret > 0) {
+  808417:	48 85 c0             	test   %rax,%rax
+  80841a:	7f 01                	jg     80841d <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80841c:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80841d:	55                   	push   %rbp
+  80841e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808421:	49 89 c0             	mov    %rax,%r8
+  808424:	b9 06 00 00 00       	mov    $0x6,%ecx
+  808429:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  808430:	00 00 00 
+  808433:	be 29 00 00 00       	mov    $0x29,%esi
+  808438:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  80843f:	00 00 00 
+  808442:	b8 00 00 00 00       	mov    $0x0,%eax
+  808447:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  80844e:	00 00 00 
+  808451:	41 ff d1             	call   *%r9
+
+0000000000808454 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  808454:	48 63 f6             	movslq %esi,%rsi
+  808457:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80845a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80845f:	ba 00 00 00 00       	mov    $0x0,%edx
+  808464:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80846a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808470:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808476:	0f 05                	syscall
+    if (check && ret > 0) {
+  808478:	48 85 c0             	test   %rax,%rax
+  80847b:	7f 01                	jg     80847e <sys_env_set_status+0x2a>
+}
+  80847d:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80847e:	55                   	push   %rbp
+  80847f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808482:	49 89 c0             	mov    %rax,%r8
+  808485:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80848a:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  808491:	00 00 00 
+  808494:	be 29 00 00 00       	mov    $0x29,%esi
+  808499:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  8084a0:	00 00 00 
+  8084a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8084a8:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  8084af:	00 00 00 
+  8084b2:	41 ff d1             	call   *%r9
+
+00000000008084b5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8084b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8084b8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8084bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8084c2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8084c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8084ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8084d4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8084d6:	48 85 c0             	test   %rax,%rax
+  8084d9:	7f 01                	jg     8084dc <sys_env_set_trapframe+0x27>
+}
+  8084db:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8084dc:	55                   	push   %rbp
+  8084dd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8084e0:	49 89 c0             	mov    %rax,%r8
+  8084e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8084e8:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  8084ef:	00 00 00 
+  8084f2:	be 29 00 00 00       	mov    $0x29,%esi
+  8084f7:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  8084fe:	00 00 00 
+  808501:	b8 00 00 00 00       	mov    $0x0,%eax
+  808506:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  80850d:	00 00 00 
+  808510:	41 ff d1             	call   *%r9
+
+0000000000808513 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  808513:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  808516:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80851b:	ba 00 00 00 00       	mov    $0x0,%edx
+  808520:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808526:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80852c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808532:	0f 05                	syscall
+    if (check && ret > 0) {
+  808534:	48 85 c0             	test   %rax,%rax
+  808537:	7f 01                	jg     80853a <sys_env_set_pgfault_upcall+0x27>
+}
+  808539:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80853a:	55                   	push   %rbp
+  80853b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80853e:	49 89 c0             	mov    %rax,%r8
+  808541:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  808546:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  80854d:	00 00 00 
+  808550:	be 29 00 00 00       	mov    $0x29,%esi
+  808555:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  80855c:	00 00 00 
+  80855f:	b8 00 00 00 00       	mov    $0x0,%eax
+  808564:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  80856b:	00 00 00 
+  80856e:	41 ff d1             	call   *%r9
+
+0000000000808571 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  808571:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  808574:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  808577:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80857c:	4d 63 c0             	movslq %r8d,%r8
+  80857f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808585:	0f 05                	syscall
+}
+  808587:	c3                   	ret
+
+0000000000808588 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  808588:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80858b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80858e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808593:	4d 63 c0             	movslq %r8d,%r8
+  808596:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80859c:	0f 05                	syscall
+}
+  80859e:	c3                   	ret
+
+000000000080859f <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80859f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8085a4:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8085a7:	45 89 c0             	mov    %r8d,%r8d
+  8085aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8085b0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8085b2:	48 85 c0             	test   %rax,%rax
+  8085b5:	7f 01                	jg     8085b8 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8085b7:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8085b8:	55                   	push   %rbp
+  8085b9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8085bc:	49 89 c0             	mov    %rax,%r8
+  8085bf:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8085c4:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  8085cb:	00 00 00 
+  8085ce:	be 29 00 00 00       	mov    $0x29,%esi
+  8085d3:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  8085da:	00 00 00 
+  8085dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8085e2:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  8085e9:	00 00 00 
+  8085ec:	41 ff d1             	call   *%r9
+
+00000000008085ef <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8085ef:	55                   	push   %rbp
+  8085f0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8085f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8085f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8085fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  808603:	48 b8 9f 85 80 00 00 	movabs $0x80859f,%rax
+  80860a:	00 00 00 
+  80860d:	ff d0                	call   *%rax
+}
+  80860f:	5d                   	pop    %rbp
+  808610:	c3                   	ret
+
+0000000000808611 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  808611:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  808616:	bf 00 00 00 00       	mov    $0x0,%edi
+  80861b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808620:	ba 00 00 00 00       	mov    $0x0,%edx
+  808625:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80862b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808631:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808637:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  808639:	c3                   	ret
+
+000000000080863a <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80863a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80863f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808644:	ba 00 00 00 00       	mov    $0x0,%edx
+  808649:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80864f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80865b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80865d:	48 85 c0             	test   %rax,%rax
+  808660:	7f 01                	jg     808663 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  808662:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  808663:	55                   	push   %rbp
+  808664:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808667:	49 89 c0             	mov    %rax,%r8
+  80866a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80866f:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  808676:	00 00 00 
+  808679:	be 29 00 00 00       	mov    $0x29,%esi
+  80867e:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  808685:	00 00 00 
+  808688:	b8 00 00 00 00       	mov    $0x0,%eax
+  80868d:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  808694:	00 00 00 
+  808697:	41 ff d1             	call   *%r9
+
+000000000080869a <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80869a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80869f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8086a4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8086a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8086ae:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8086b4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8086ba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8086c0:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8086c2:	c3                   	ret
+
+00000000008086c3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8086c3:	89 d2                	mov    %edx,%edx
+  8086c5:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8086c7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8086cc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8086d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8086d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8086de:	0f 05                	syscall
+}
+  8086e0:	c3                   	ret
+
+00000000008086e1 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8086e1:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8086e4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8086e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8086ee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8086f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8086fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808700:	0f 05                	syscall
+}
+  808702:	c3                   	ret
+
+0000000000808703 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  808703:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  808706:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80870b:	ba 00 00 00 00       	mov    $0x0,%edx
+  808710:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  808716:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80871c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808722:	0f 05                	syscall
+}
+  808724:	c3                   	ret
+
+0000000000808725 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  808725:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  808728:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80872d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  808732:	ba 00 00 00 00       	mov    $0x0,%edx
+  808737:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80873d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808743:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  808749:	0f 05                	syscall
+    if (check && ret > 0) {
+  80874b:	48 85 c0             	test   %rax,%rax
+  80874e:	7f 01                	jg     808751 <sys_irq_ack+0x2c>
+}
+  808750:	c3                   	ret
+sys_irq_ack(int irq) {
+  808751:	55                   	push   %rbp
+  808752:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  808755:	49 89 c0             	mov    %rax,%r8
+  808758:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80875d:	48 ba 38 c9 80 00 00 	movabs $0x80c938,%rdx
+  808764:	00 00 00 
+  808767:	be 29 00 00 00       	mov    $0x29,%esi
+  80876c:	48 bf 57 c9 80 00 00 	movabs $0x80c957,%rdi
+  808773:	00 00 00 
+  808776:	b8 00 00 00 00       	mov    $0x0,%eax
+  80877b:	49 b9 81 73 80 00 00 	movabs $0x807381,%r9
+  808782:	00 00 00 
+  808785:	41 ff d1             	call   *%r9
+
+0000000000808788 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  808788:	55                   	push   %rbp
+  808789:	48 89 e5             	mov    %rsp,%rbp
+  80878c:	41 56                	push   %r14
+  80878e:	41 55                	push   %r13
+  808790:	41 54                	push   %r12
+  808792:	53                   	push   %rbx
+  808793:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  808796:	48 b8 c8 45 86 00 00 	movabs $0x8645c8,%rax
+  80879d:	00 00 00 
+  8087a0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8087a4:	74 27                	je     8087cd <_handle_vectored_pagefault+0x45>
+  8087a6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8087ab:	49 bd 80 45 86 00 00 	movabs $0x864580,%r13
+  8087b2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8087b5:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8087b8:	4c 89 e7             	mov    %r12,%rdi
+  8087bb:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8087c0:	84 c0                	test   %al,%al
+  8087c2:	75 45                	jne    808809 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8087c4:	48 83 c3 01          	add    $0x1,%rbx
+  8087c8:	49 3b 1e             	cmp    (%r14),%rbx
+  8087cb:	72 eb                	jb     8087b8 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8087cd:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8087d4:	00 
+  8087d5:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8087da:	4d 8b 04 24          	mov    (%r12),%r8
+  8087de:	48 ba 68 c9 80 00 00 	movabs $0x80c968,%rdx
+  8087e5:	00 00 00 
+  8087e8:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8087ed:	48 bf 98 c9 80 00 00 	movabs $0x80c998,%rdi
+  8087f4:	00 00 00 
+  8087f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8087fc:	49 ba 81 73 80 00 00 	movabs $0x807381,%r10
+  808803:	00 00 00 
+  808806:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  808809:	5b                   	pop    %rbx
+  80880a:	41 5c                	pop    %r12
+  80880c:	41 5d                	pop    %r13
+  80880e:	41 5e                	pop    %r14
+  808810:	5d                   	pop    %rbp
+  808811:	c3                   	ret
+
+0000000000808812 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  808812:	55                   	push   %rbp
+  808813:	48 89 e5             	mov    %rsp,%rbp
+  808816:	53                   	push   %rbx
+  808817:	48 83 ec 08          	sub    $0x8,%rsp
+  80881b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80881e:	48 b8 c0 45 86 00 00 	movabs $0x8645c0,%rax
+  808825:	00 00 00 
+  808828:	80 38 00             	cmpb   $0x0,(%rax)
+  80882b:	0f 84 84 00 00 00    	je     8088b5 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  808831:	48 b8 c8 45 86 00 00 	movabs $0x8645c8,%rax
+  808838:	00 00 00 
+  80883b:	48 8b 10             	mov    (%rax),%rdx
+  80883e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  808843:	48 b9 80 45 86 00 00 	movabs $0x864580,%rcx
+  80884a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80884d:	48 85 d2             	test   %rdx,%rdx
+  808850:	74 19                	je     80886b <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  808852:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  808856:	0f 84 e8 00 00 00    	je     808944 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80885c:	48 83 c0 01          	add    $0x1,%rax
+  808860:	48 39 d0             	cmp    %rdx,%rax
+  808863:	75 ed                	jne    808852 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  808865:	48 83 fa 08          	cmp    $0x8,%rdx
+  808869:	74 1c                	je     808887 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80886b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80886f:	48 a3 c8 45 86 00 00 	movabs %rax,0x8645c8
+  808876:	00 00 00 
+  808879:	48 b8 80 45 86 00 00 	movabs $0x864580,%rax
+  808880:	00 00 00 
+  808883:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  808887:	48 b8 c8 82 80 00 00 	movabs $0x8082c8,%rax
+  80888e:	00 00 00 
+  808891:	ff d0                	call   *%rax
+  808893:	89 c7                	mov    %eax,%edi
+  808895:	48 be 0a 8a 80 00 00 	movabs $0x808a0a,%rsi
+  80889c:	00 00 00 
+  80889f:	48 b8 13 85 80 00 00 	movabs $0x808513,%rax
+  8088a6:	00 00 00 
+  8088a9:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8088ab:	85 c0                	test   %eax,%eax
+  8088ad:	78 68                	js     808917 <add_pgfault_handler+0x105>
+    return res;
+}
+  8088af:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8088b3:	c9                   	leave
+  8088b4:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8088b5:	48 b8 c8 82 80 00 00 	movabs $0x8082c8,%rax
+  8088bc:	00 00 00 
+  8088bf:	ff d0                	call   *%rax
+  8088c1:	89 c7                	mov    %eax,%edi
+  8088c3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8088c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8088cd:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8088d4:	00 00 00 
+  8088d7:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  8088de:	00 00 00 
+  8088e1:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8088e3:	48 ba c8 45 86 00 00 	movabs $0x8645c8,%rdx
+  8088ea:	00 00 00 
+  8088ed:	48 8b 02             	mov    (%rdx),%rax
+  8088f0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8088f4:	48 89 0a             	mov    %rcx,(%rdx)
+  8088f7:	48 ba 80 45 86 00 00 	movabs $0x864580,%rdx
+  8088fe:	00 00 00 
+  808901:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  808905:	48 b8 c0 45 86 00 00 	movabs $0x8645c0,%rax
+  80890c:	00 00 00 
+  80890f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  808912:	e9 70 ff ff ff       	jmp    808887 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  808917:	89 c1                	mov    %eax,%ecx
+  808919:	48 ba a6 c9 80 00 00 	movabs $0x80c9a6,%rdx
+  808920:	00 00 00 
+  808923:	be 3d 00 00 00       	mov    $0x3d,%esi
+  808928:	48 bf 98 c9 80 00 00 	movabs $0x80c998,%rdi
+  80892f:	00 00 00 
+  808932:	b8 00 00 00 00       	mov    $0x0,%eax
+  808937:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80893e:	00 00 00 
+  808941:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  808944:	b8 00 00 00 00       	mov    $0x0,%eax
+  808949:	e9 61 ff ff ff       	jmp    8088af <add_pgfault_handler+0x9d>
+
+000000000080894e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80894e:	55                   	push   %rbp
+  80894f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  808952:	48 b8 c0 45 86 00 00 	movabs $0x8645c0,%rax
+  808959:	00 00 00 
+  80895c:	80 38 00             	cmpb   $0x0,(%rax)
+  80895f:	74 33                	je     808994 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  808961:	48 a1 c8 45 86 00 00 	movabs 0x8645c8,%rax
+  808968:	00 00 00 
+  80896b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  808970:	48 ba 80 45 86 00 00 	movabs $0x864580,%rdx
+  808977:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80897a:	48 85 c0             	test   %rax,%rax
+  80897d:	0f 84 85 00 00 00    	je     808a08 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  808983:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  808987:	74 40                	je     8089c9 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  808989:	48 83 c1 01          	add    $0x1,%rcx
+  80898d:	48 39 c1             	cmp    %rax,%rcx
+  808990:	75 f1                	jne    808983 <remove_pgfault_handler+0x35>
+  808992:	eb 74                	jmp    808a08 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  808994:	48 b9 be c9 80 00 00 	movabs $0x80c9be,%rcx
+  80899b:	00 00 00 
+  80899e:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  8089a5:	00 00 00 
+  8089a8:	be 43 00 00 00       	mov    $0x43,%esi
+  8089ad:	48 bf 98 c9 80 00 00 	movabs $0x80c998,%rdi
+  8089b4:	00 00 00 
+  8089b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8089bc:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  8089c3:	00 00 00 
+  8089c6:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8089c9:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8089d0:	00 
+  8089d1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8089d5:	48 29 ca             	sub    %rcx,%rdx
+  8089d8:	48 b8 80 45 86 00 00 	movabs $0x864580,%rax
+  8089df:	00 00 00 
+  8089e2:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8089e6:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8089eb:	48 89 ce             	mov    %rcx,%rsi
+  8089ee:	48 b8 f0 7f 80 00 00 	movabs $0x807ff0,%rax
+  8089f5:	00 00 00 
+  8089f8:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8089fa:	48 b8 c8 45 86 00 00 	movabs $0x8645c8,%rax
+  808a01:	00 00 00 
+  808a04:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  808a08:	5d                   	pop    %rbp
+  808a09:	c3                   	ret
+
+0000000000808a0a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  808a0a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  808a0d:	48 b8 88 87 80 00 00 	movabs $0x808788,%rax
+  808a14:	00 00 00 
+    call *%rax
+  808a17:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  808a19:	41 5f                	pop    %r15
+	popq %r15
+  808a1b:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  808a1d:	41 5f                	pop    %r15
+	popq %r14
+  808a1f:	41 5e                	pop    %r14
+	popq %r13
+  808a21:	41 5d                	pop    %r13
+	popq %r12
+  808a23:	41 5c                	pop    %r12
+	popq %r11
+  808a25:	41 5b                	pop    %r11
+	popq %r10
+  808a27:	41 5a                	pop    %r10
+	popq %r9
+  808a29:	41 59                	pop    %r9
+	popq %r8
+  808a2b:	41 58                	pop    %r8
+	popq %rsi
+  808a2d:	5e                   	pop    %rsi
+	popq %rdi
+  808a2e:	5f                   	pop    %rdi
+	popq %rbp
+  808a2f:	5d                   	pop    %rbp
+	popq %rdx
+  808a30:	5a                   	pop    %rdx
+	popq %rcx
+  808a31:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  808a32:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  808a37:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  808a3c:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  808a40:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  808a43:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  808a48:	5b                   	pop    %rbx
+	popq %rax
+  808a49:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  808a4a:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  808a4e:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  808a4f:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  808a54:	c3                   	ret
+
+0000000000808a55 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  808a55:	55                   	push   %rbp
+  808a56:	48 89 e5             	mov    %rsp,%rbp
+  808a59:	41 55                	push   %r13
+  808a5b:	41 54                	push   %r12
+  808a5d:	53                   	push   %rbx
+  808a5e:	48 83 ec 08          	sub    $0x8,%rsp
+  808a62:	49 89 fd             	mov    %rdi,%r13
+  808a65:	48 89 f7             	mov    %rsi,%rdi
+  808a68:	48 89 d3             	mov    %rdx,%rbx
+  808a6b:	49 89 cc             	mov    %rcx,%r12
+  808a6e:	4c 89 c2             	mov    %r8,%rdx
+  808a71:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  808a74:	48 85 f6             	test   %rsi,%rsi
+  808a77:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  808a7e:	00 00 00 
+  808a81:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  808a85:	be 00 10 00 00       	mov    $0x1000,%esi
+  808a8a:	48 85 db             	test   %rbx,%rbx
+  808a8d:	74 03                	je     808a92 <ipc_recv_futex+0x3d>
+  808a8f:	48 8b 33             	mov    (%rbx),%rsi
+  808a92:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  808a96:	48 b8 9f 85 80 00 00 	movabs $0x80859f,%rax
+  808a9d:	00 00 00 
+  808aa0:	ff d0                	call   *%rax
+    if (res < 0) {
+  808aa2:	85 c0                	test   %eax,%eax
+  808aa4:	78 75                	js     808b1b <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  808aa6:	4d 85 ed             	test   %r13,%r13
+  808aa9:	74 14                	je     808abf <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  808aab:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  808ab2:	00 00 00 
+  808ab5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  808abb:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  808abf:	4d 85 e4             	test   %r12,%r12
+  808ac2:	74 14                	je     808ad8 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  808ac4:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  808acb:	00 00 00 
+  808ace:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  808ad4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  808ad8:	48 85 db             	test   %rbx,%rbx
+  808adb:	74 23                	je     808b00 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  808add:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  808ae4:	00 00 00 
+  808ae7:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  808aed:	ba 00 00 00 00       	mov    $0x0,%edx
+  808af2:	85 c9                	test   %ecx,%ecx
+  808af4:	74 07                	je     808afd <ipc_recv_futex+0xa8>
+  808af6:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  808afd:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  808b00:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  808b07:	00 00 00 
+  808b0a:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  808b10:	48 83 c4 08          	add    $0x8,%rsp
+  808b14:	5b                   	pop    %rbx
+  808b15:	41 5c                	pop    %r12
+  808b17:	41 5d                	pop    %r13
+  808b19:	5d                   	pop    %rbp
+  808b1a:	c3                   	ret
+        if (from_env_store != NULL) {
+  808b1b:	4d 85 ed             	test   %r13,%r13
+  808b1e:	74 08                	je     808b28 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  808b20:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  808b27:	00 
+        if (perm_store != NULL) {
+  808b28:	4d 85 e4             	test   %r12,%r12
+  808b2b:	74 08                	je     808b35 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  808b2d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  808b34:	00 
+        if (size != NULL) {
+  808b35:	48 85 db             	test   %rbx,%rbx
+  808b38:	74 d6                	je     808b10 <ipc_recv_futex+0xbb>
+            *size = 0;
+  808b3a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  808b41:	eb cd                	jmp    808b10 <ipc_recv_futex+0xbb>
+
+0000000000808b43 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  808b43:	55                   	push   %rbp
+  808b44:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  808b47:	48 83 ec 08          	sub    $0x8,%rsp
+  808b4b:	6a 00                	push   $0x0
+  808b4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  808b53:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  808b59:	48 b8 55 8a 80 00 00 	movabs $0x808a55,%rax
+  808b60:	00 00 00 
+  808b63:	ff d0                	call   *%rax
+}
+  808b65:	c9                   	leave
+  808b66:	c3                   	ret
+
+0000000000808b67 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  808b67:	55                   	push   %rbp
+  808b68:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  808b6b:	48 85 d2             	test   %rdx,%rdx
+  808b6e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  808b75:	00 00 00 
+  808b78:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  808b7c:	89 f6                	mov    %esi,%esi
+  808b7e:	48 b8 88 85 80 00 00 	movabs $0x808588,%rax
+  808b85:	00 00 00 
+  808b88:	ff d0                	call   *%rax
+    if (res < 0) {
+  808b8a:	85 c0                	test   %eax,%eax
+  808b8c:	78 02                	js     808b90 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  808b8e:	5d                   	pop    %rbp
+  808b8f:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  808b90:	89 c1                	mov    %eax,%ecx
+  808b92:	48 ba d8 c9 80 00 00 	movabs $0x80c9d8,%rdx
+  808b99:	00 00 00 
+  808b9c:	be 50 00 00 00       	mov    $0x50,%esi
+  808ba1:	48 bf ec c9 80 00 00 	movabs $0x80c9ec,%rdi
+  808ba8:	00 00 00 
+  808bab:	b8 00 00 00 00       	mov    $0x0,%eax
+  808bb0:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  808bb7:	00 00 00 
+  808bba:	41 ff d0             	call   *%r8
+
+0000000000808bbd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  808bbd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  808bc2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  808bc9:	00 00 00 
+  808bcc:	48 89 d0             	mov    %rdx,%rax
+  808bcf:	48 c1 e0 04          	shl    $0x4,%rax
+  808bd3:	48 29 d0             	sub    %rdx,%rax
+  808bd6:	48 c1 e0 05          	shl    $0x5,%rax
+  808bda:	48 01 c8             	add    %rcx,%rax
+  808bdd:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  808be3:	39 f8                	cmp    %edi,%eax
+  808be5:	74 13                	je     808bfa <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  808be7:	48 83 c2 01          	add    $0x1,%rdx
+  808beb:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  808bf2:	75 d8                	jne    808bcc <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  808bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808bf9:	c3                   	ret
+            return envs[i].env_id;
+  808bfa:	48 89 d0             	mov    %rdx,%rax
+  808bfd:	48 c1 e0 04          	shl    $0x4,%rax
+  808c01:	48 29 d0             	sub    %rdx,%rax
+  808c04:	48 c1 e0 05          	shl    $0x5,%rax
+  808c08:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  808c0f:	00 00 00 
+  808c12:	48 01 d0             	add    %rdx,%rax
+  808c15:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  808c1b:	c3                   	ret
+
+0000000000808c1c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  808c1c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  808c23:	ff ff ff 
+  808c26:	48 01 f8             	add    %rdi,%rax
+  808c29:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  808c2d:	c3                   	ret
+
+0000000000808c2e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  808c2e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  808c35:	ff ff ff 
+  808c38:	48 01 f8             	add    %rdi,%rax
+  808c3b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  808c3f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  808c45:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  808c49:	c3                   	ret
+
+0000000000808c4a <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  808c4a:	55                   	push   %rbp
+  808c4b:	48 89 e5             	mov    %rsp,%rbp
+  808c4e:	41 57                	push   %r15
+  808c50:	41 56                	push   %r14
+  808c52:	41 55                	push   %r13
+  808c54:	41 54                	push   %r12
+  808c56:	53                   	push   %rbx
+  808c57:	48 83 ec 08          	sub    $0x8,%rsp
+  808c5b:	49 89 ff             	mov    %rdi,%r15
+  808c5e:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  808c63:	49 bd d9 b3 80 00 00 	movabs $0x80b3d9,%r13
+  808c6a:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  808c6d:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  808c73:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  808c76:	48 89 df             	mov    %rbx,%rdi
+  808c79:	41 ff d5             	call   *%r13
+  808c7c:	83 e0 04             	and    $0x4,%eax
+  808c7f:	74 17                	je     808c98 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  808c81:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  808c88:	4c 39 f3             	cmp    %r14,%rbx
+  808c8b:	75 e6                	jne    808c73 <fd_alloc+0x29>
+  808c8d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  808c93:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  808c98:	4d 89 27             	mov    %r12,(%r15)
+}
+  808c9b:	48 83 c4 08          	add    $0x8,%rsp
+  808c9f:	5b                   	pop    %rbx
+  808ca0:	41 5c                	pop    %r12
+  808ca2:	41 5d                	pop    %r13
+  808ca4:	41 5e                	pop    %r14
+  808ca6:	41 5f                	pop    %r15
+  808ca8:	5d                   	pop    %rbp
+  808ca9:	c3                   	ret
+
+0000000000808caa <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  808caa:	83 ff 1f             	cmp    $0x1f,%edi
+  808cad:	77 39                	ja     808ce8 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  808caf:	55                   	push   %rbp
+  808cb0:	48 89 e5             	mov    %rsp,%rbp
+  808cb3:	41 54                	push   %r12
+  808cb5:	53                   	push   %rbx
+  808cb6:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  808cb9:	48 63 df             	movslq %edi,%rbx
+  808cbc:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  808cc3:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  808cc7:	48 89 df             	mov    %rbx,%rdi
+  808cca:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  808cd1:	00 00 00 
+  808cd4:	ff d0                	call   *%rax
+  808cd6:	a8 04                	test   $0x4,%al
+  808cd8:	74 14                	je     808cee <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  808cda:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  808cde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  808ce3:	5b                   	pop    %rbx
+  808ce4:	41 5c                	pop    %r12
+  808ce6:	5d                   	pop    %rbp
+  808ce7:	c3                   	ret
+        return -E_INVAL;
+  808ce8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  808ced:	c3                   	ret
+        return -E_INVAL;
+  808cee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  808cf3:	eb ee                	jmp    808ce3 <fd_lookup+0x39>
+
+0000000000808cf5 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  808cf5:	55                   	push   %rbp
+  808cf6:	48 89 e5             	mov    %rsp,%rbp
+  808cf9:	41 54                	push   %r12
+  808cfb:	53                   	push   %rbx
+  808cfc:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  808cff:	48 b8 80 ca 80 00 00 	movabs $0x80ca80,%rax
+  808d06:	00 00 00 
+  808d09:	48 bb c0 30 81 00 00 	movabs $0x8130c0,%rbx
+  808d10:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  808d13:	39 3b                	cmp    %edi,(%rbx)
+  808d15:	74 47                	je     808d5e <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  808d17:	48 83 c0 08          	add    $0x8,%rax
+  808d1b:	48 8b 18             	mov    (%rax),%rbx
+  808d1e:	48 85 db             	test   %rbx,%rbx
+  808d21:	75 f0                	jne    808d13 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  808d23:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  808d2a:	00 00 00 
+  808d2d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  808d33:	89 fa                	mov    %edi,%edx
+  808d35:	48 bf f8 c9 80 00 00 	movabs $0x80c9f8,%rdi
+  808d3c:	00 00 00 
+  808d3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d44:	48 b9 d1 74 80 00 00 	movabs $0x8074d1,%rcx
+  808d4b:	00 00 00 
+  808d4e:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  808d50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  808d55:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  808d59:	5b                   	pop    %rbx
+  808d5a:	41 5c                	pop    %r12
+  808d5c:	5d                   	pop    %rbp
+  808d5d:	c3                   	ret
+            return 0;
+  808d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  808d63:	eb f0                	jmp    808d55 <dev_lookup+0x60>
+
+0000000000808d65 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  808d65:	55                   	push   %rbp
+  808d66:	48 89 e5             	mov    %rsp,%rbp
+  808d69:	41 55                	push   %r13
+  808d6b:	41 54                	push   %r12
+  808d6d:	53                   	push   %rbx
+  808d6e:	48 83 ec 18          	sub    $0x18,%rsp
+  808d72:	48 89 fb             	mov    %rdi,%rbx
+  808d75:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  808d78:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  808d7f:	ff ff ff 
+  808d82:	48 01 df             	add    %rbx,%rdi
+  808d85:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  808d89:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  808d8d:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  808d94:	00 00 00 
+  808d97:	ff d0                	call   *%rax
+  808d99:	41 89 c5             	mov    %eax,%r13d
+  808d9c:	85 c0                	test   %eax,%eax
+  808d9e:	78 06                	js     808da6 <fd_close+0x41>
+  808da0:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  808da4:	74 1a                	je     808dc0 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  808da6:	45 84 e4             	test   %r12b,%r12b
+  808da9:	b8 00 00 00 00       	mov    $0x0,%eax
+  808dae:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  808db2:	44 89 e8             	mov    %r13d,%eax
+  808db5:	48 83 c4 18          	add    $0x18,%rsp
+  808db9:	5b                   	pop    %rbx
+  808dba:	41 5c                	pop    %r12
+  808dbc:	41 5d                	pop    %r13
+  808dbe:	5d                   	pop    %rbp
+  808dbf:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  808dc0:	8b 3b                	mov    (%rbx),%edi
+  808dc2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808dc6:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  808dcd:	00 00 00 
+  808dd0:	ff d0                	call   *%rax
+  808dd2:	41 89 c5             	mov    %eax,%r13d
+  808dd5:	85 c0                	test   %eax,%eax
+  808dd7:	78 1b                	js     808df4 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  808dd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808ddd:	48 8b 40 20          	mov    0x20(%rax),%rax
+  808de1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  808de7:	48 85 c0             	test   %rax,%rax
+  808dea:	74 08                	je     808df4 <fd_close+0x8f>
+  808dec:	48 89 df             	mov    %rbx,%rdi
+  808def:	ff d0                	call   *%rax
+  808df1:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  808df4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  808df9:	48 89 de             	mov    %rbx,%rsi
+  808dfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  808e01:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  808e08:	00 00 00 
+  808e0b:	ff d0                	call   *%rax
+    return res;
+  808e0d:	eb a3                	jmp    808db2 <fd_close+0x4d>
+
+0000000000808e0f <close>:
+
+int
+close(int fdnum) {
+  808e0f:	55                   	push   %rbp
+  808e10:	48 89 e5             	mov    %rsp,%rbp
+  808e13:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  808e17:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  808e1b:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  808e22:	00 00 00 
+  808e25:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  808e27:	85 c0                	test   %eax,%eax
+  808e29:	78 15                	js     808e40 <close+0x31>
+
+    return fd_close(fd, 1);
+  808e2b:	be 01 00 00 00       	mov    $0x1,%esi
+  808e30:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  808e34:	48 b8 65 8d 80 00 00 	movabs $0x808d65,%rax
+  808e3b:	00 00 00 
+  808e3e:	ff d0                	call   *%rax
+}
+  808e40:	c9                   	leave
+  808e41:	c3                   	ret
+
+0000000000808e42 <close_all>:
+
+void
+close_all(void) {
+  808e42:	55                   	push   %rbp
+  808e43:	48 89 e5             	mov    %rsp,%rbp
+  808e46:	41 54                	push   %r12
+  808e48:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  808e49:	bb 00 00 00 00       	mov    $0x0,%ebx
+  808e4e:	49 bc 0f 8e 80 00 00 	movabs $0x808e0f,%r12
+  808e55:	00 00 00 
+  808e58:	89 df                	mov    %ebx,%edi
+  808e5a:	41 ff d4             	call   *%r12
+  808e5d:	83 c3 01             	add    $0x1,%ebx
+  808e60:	83 fb 20             	cmp    $0x20,%ebx
+  808e63:	75 f3                	jne    808e58 <close_all+0x16>
+}
+  808e65:	5b                   	pop    %rbx
+  808e66:	41 5c                	pop    %r12
+  808e68:	5d                   	pop    %rbp
+  808e69:	c3                   	ret
+
+0000000000808e6a <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  808e6a:	55                   	push   %rbp
+  808e6b:	48 89 e5             	mov    %rsp,%rbp
+  808e6e:	41 57                	push   %r15
+  808e70:	41 56                	push   %r14
+  808e72:	41 55                	push   %r13
+  808e74:	41 54                	push   %r12
+  808e76:	53                   	push   %rbx
+  808e77:	48 83 ec 18          	sub    $0x18,%rsp
+  808e7b:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  808e7e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  808e82:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  808e89:	00 00 00 
+  808e8c:	ff d0                	call   *%rax
+  808e8e:	89 c3                	mov    %eax,%ebx
+  808e90:	85 c0                	test   %eax,%eax
+  808e92:	0f 88 b8 00 00 00    	js     808f50 <dup+0xe6>
+    close(newfdnum);
+  808e98:	44 89 e7             	mov    %r12d,%edi
+  808e9b:	48 b8 0f 8e 80 00 00 	movabs $0x808e0f,%rax
+  808ea2:	00 00 00 
+  808ea5:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  808ea7:	4d 63 ec             	movslq %r12d,%r13
+  808eaa:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  808eb1:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  808eb5:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  808eb9:	4c 89 ff             	mov    %r15,%rdi
+  808ebc:	49 be 2e 8c 80 00 00 	movabs $0x808c2e,%r14
+  808ec3:	00 00 00 
+  808ec6:	41 ff d6             	call   *%r14
+  808ec9:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  808ecc:	4c 89 ef             	mov    %r13,%rdi
+  808ecf:	41 ff d6             	call   *%r14
+  808ed2:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  808ed5:	48 89 df             	mov    %rbx,%rdi
+  808ed8:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  808edf:	00 00 00 
+  808ee2:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  808ee4:	a8 04                	test   $0x4,%al
+  808ee6:	74 2b                	je     808f13 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  808ee8:	41 89 c1             	mov    %eax,%r9d
+  808eeb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  808ef1:	4c 89 f1             	mov    %r14,%rcx
+  808ef4:	ba 00 00 00 00       	mov    $0x0,%edx
+  808ef9:	48 89 de             	mov    %rbx,%rsi
+  808efc:	bf 00 00 00 00       	mov    $0x0,%edi
+  808f01:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  808f08:	00 00 00 
+  808f0b:	ff d0                	call   *%rax
+  808f0d:	89 c3                	mov    %eax,%ebx
+  808f0f:	85 c0                	test   %eax,%eax
+  808f11:	78 4e                	js     808f61 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  808f13:	4c 89 ff             	mov    %r15,%rdi
+  808f16:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  808f1d:	00 00 00 
+  808f20:	ff d0                	call   *%rax
+  808f22:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  808f25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  808f2b:	4c 89 e9             	mov    %r13,%rcx
+  808f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  808f33:	4c 89 fe             	mov    %r15,%rsi
+  808f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  808f3b:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  808f42:	00 00 00 
+  808f45:	ff d0                	call   *%rax
+  808f47:	89 c3                	mov    %eax,%ebx
+  808f49:	85 c0                	test   %eax,%eax
+  808f4b:	78 14                	js     808f61 <dup+0xf7>
+
+    return newfdnum;
+  808f4d:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  808f50:	89 d8                	mov    %ebx,%eax
+  808f52:	48 83 c4 18          	add    $0x18,%rsp
+  808f56:	5b                   	pop    %rbx
+  808f57:	41 5c                	pop    %r12
+  808f59:	41 5d                	pop    %r13
+  808f5b:	41 5e                	pop    %r14
+  808f5d:	41 5f                	pop    %r15
+  808f5f:	5d                   	pop    %rbp
+  808f60:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  808f61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  808f66:	4c 89 ee             	mov    %r13,%rsi
+  808f69:	bf 00 00 00 00       	mov    $0x0,%edi
+  808f6e:	49 bc fb 83 80 00 00 	movabs $0x8083fb,%r12
+  808f75:	00 00 00 
+  808f78:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  808f7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  808f80:	4c 89 f6             	mov    %r14,%rsi
+  808f83:	bf 00 00 00 00       	mov    $0x0,%edi
+  808f88:	41 ff d4             	call   *%r12
+    return res;
+  808f8b:	eb c3                	jmp    808f50 <dup+0xe6>
+
+0000000000808f8d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  808f8d:	55                   	push   %rbp
+  808f8e:	48 89 e5             	mov    %rsp,%rbp
+  808f91:	41 56                	push   %r14
+  808f93:	41 55                	push   %r13
+  808f95:	41 54                	push   %r12
+  808f97:	53                   	push   %rbx
+  808f98:	48 83 ec 10          	sub    $0x10,%rsp
+  808f9c:	89 fb                	mov    %edi,%ebx
+  808f9e:	49 89 f4             	mov    %rsi,%r12
+  808fa1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  808fa4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  808fa8:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  808faf:	00 00 00 
+  808fb2:	ff d0                	call   *%rax
+  808fb4:	85 c0                	test   %eax,%eax
+  808fb6:	78 4c                	js     809004 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  808fb8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  808fbc:	41 8b 3e             	mov    (%r14),%edi
+  808fbf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  808fc3:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  808fca:	00 00 00 
+  808fcd:	ff d0                	call   *%rax
+  808fcf:	85 c0                	test   %eax,%eax
+  808fd1:	78 35                	js     809008 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  808fd3:	41 8b 46 08          	mov    0x8(%r14),%eax
+  808fd7:	83 e0 03             	and    $0x3,%eax
+  808fda:	83 f8 01             	cmp    $0x1,%eax
+  808fdd:	74 2d                	je     80900c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  808fdf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  808fe3:	48 8b 40 10          	mov    0x10(%rax),%rax
+  808fe7:	48 85 c0             	test   %rax,%rax
+  808fea:	74 56                	je     809042 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  808fec:	4c 89 ea             	mov    %r13,%rdx
+  808fef:	4c 89 e6             	mov    %r12,%rsi
+  808ff2:	4c 89 f7             	mov    %r14,%rdi
+  808ff5:	ff d0                	call   *%rax
+}
+  808ff7:	48 83 c4 10          	add    $0x10,%rsp
+  808ffb:	5b                   	pop    %rbx
+  808ffc:	41 5c                	pop    %r12
+  808ffe:	41 5d                	pop    %r13
+  809000:	41 5e                	pop    %r14
+  809002:	5d                   	pop    %rbp
+  809003:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  809004:	48 98                	cltq
+  809006:	eb ef                	jmp    808ff7 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  809008:	48 98                	cltq
+  80900a:	eb eb                	jmp    808ff7 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80900c:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  809013:	00 00 00 
+  809016:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80901c:	89 da                	mov    %ebx,%edx
+  80901e:	48 bf 39 ca 80 00 00 	movabs $0x80ca39,%rdi
+  809025:	00 00 00 
+  809028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80902d:	48 b9 d1 74 80 00 00 	movabs $0x8074d1,%rcx
+  809034:	00 00 00 
+  809037:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  809039:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  809040:	eb b5                	jmp    808ff7 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  809042:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  809049:	eb ac                	jmp    808ff7 <read+0x6a>
+
+000000000080904b <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  80904b:	55                   	push   %rbp
+  80904c:	48 89 e5             	mov    %rsp,%rbp
+  80904f:	41 57                	push   %r15
+  809051:	41 56                	push   %r14
+  809053:	41 55                	push   %r13
+  809055:	41 54                	push   %r12
+  809057:	53                   	push   %rbx
+  809058:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  80905c:	48 85 d2             	test   %rdx,%rdx
+  80905f:	74 54                	je     8090b5 <readn+0x6a>
+  809061:	41 89 fd             	mov    %edi,%r13d
+  809064:	49 89 f6             	mov    %rsi,%r14
+  809067:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  80906a:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80906f:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  809074:	49 bf 8d 8f 80 00 00 	movabs $0x808f8d,%r15
+  80907b:	00 00 00 
+  80907e:	4c 89 e2             	mov    %r12,%rdx
+  809081:	48 29 f2             	sub    %rsi,%rdx
+  809084:	4c 01 f6             	add    %r14,%rsi
+  809087:	44 89 ef             	mov    %r13d,%edi
+  80908a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80908d:	85 c0                	test   %eax,%eax
+  80908f:	78 20                	js     8090b1 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  809091:	01 c3                	add    %eax,%ebx
+  809093:	85 c0                	test   %eax,%eax
+  809095:	74 08                	je     80909f <readn+0x54>
+  809097:	48 63 f3             	movslq %ebx,%rsi
+  80909a:	4c 39 e6             	cmp    %r12,%rsi
+  80909d:	72 df                	jb     80907e <readn+0x33>
+    }
+    return res;
+  80909f:	48 63 c3             	movslq %ebx,%rax
+}
+  8090a2:	48 83 c4 08          	add    $0x8,%rsp
+  8090a6:	5b                   	pop    %rbx
+  8090a7:	41 5c                	pop    %r12
+  8090a9:	41 5d                	pop    %r13
+  8090ab:	41 5e                	pop    %r14
+  8090ad:	41 5f                	pop    %r15
+  8090af:	5d                   	pop    %rbp
+  8090b0:	c3                   	ret
+        if (inc < 0) return inc;
+  8090b1:	48 98                	cltq
+  8090b3:	eb ed                	jmp    8090a2 <readn+0x57>
+    int inc = 1, res = 0;
+  8090b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8090ba:	eb e3                	jmp    80909f <readn+0x54>
+
+00000000008090bc <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  8090bc:	55                   	push   %rbp
+  8090bd:	48 89 e5             	mov    %rsp,%rbp
+  8090c0:	41 56                	push   %r14
+  8090c2:	41 55                	push   %r13
+  8090c4:	41 54                	push   %r12
+  8090c6:	53                   	push   %rbx
+  8090c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8090cb:	89 fb                	mov    %edi,%ebx
+  8090cd:	49 89 f4             	mov    %rsi,%r12
+  8090d0:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8090d3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8090d7:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  8090de:	00 00 00 
+  8090e1:	ff d0                	call   *%rax
+  8090e3:	85 c0                	test   %eax,%eax
+  8090e5:	78 47                	js     80912e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8090e7:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8090eb:	41 8b 3e             	mov    (%r14),%edi
+  8090ee:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8090f2:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  8090f9:	00 00 00 
+  8090fc:	ff d0                	call   *%rax
+  8090fe:	85 c0                	test   %eax,%eax
+  809100:	78 30                	js     809132 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  809102:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  809107:	74 2d                	je     809136 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  809109:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80910d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  809111:	48 85 c0             	test   %rax,%rax
+  809114:	74 56                	je     80916c <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  809116:	4c 89 ea             	mov    %r13,%rdx
+  809119:	4c 89 e6             	mov    %r12,%rsi
+  80911c:	4c 89 f7             	mov    %r14,%rdi
+  80911f:	ff d0                	call   *%rax
+}
+  809121:	48 83 c4 10          	add    $0x10,%rsp
+  809125:	5b                   	pop    %rbx
+  809126:	41 5c                	pop    %r12
+  809128:	41 5d                	pop    %r13
+  80912a:	41 5e                	pop    %r14
+  80912c:	5d                   	pop    %rbp
+  80912d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80912e:	48 98                	cltq
+  809130:	eb ef                	jmp    809121 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  809132:	48 98                	cltq
+  809134:	eb eb                	jmp    809121 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  809136:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  80913d:	00 00 00 
+  809140:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  809146:	89 da                	mov    %ebx,%edx
+  809148:	48 bf 55 ca 80 00 00 	movabs $0x80ca55,%rdi
+  80914f:	00 00 00 
+  809152:	b8 00 00 00 00       	mov    $0x0,%eax
+  809157:	48 b9 d1 74 80 00 00 	movabs $0x8074d1,%rcx
+  80915e:	00 00 00 
+  809161:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  809163:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  80916a:	eb b5                	jmp    809121 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80916c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  809173:	eb ac                	jmp    809121 <write+0x65>
+
+0000000000809175 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  809175:	55                   	push   %rbp
+  809176:	48 89 e5             	mov    %rsp,%rbp
+  809179:	41 54                	push   %r12
+  80917b:	53                   	push   %rbx
+  80917c:	48 83 ec 10          	sub    $0x10,%rsp
+  809180:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  809182:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  809186:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80918d:	00 00 00 
+  809190:	ff d0                	call   *%rax
+  809192:	85 c0                	test   %eax,%eax
+  809194:	78 3e                	js     8091d4 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  809196:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80919a:	41 8b 3c 24          	mov    (%r12),%edi
+  80919e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8091a2:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  8091a9:	00 00 00 
+  8091ac:	ff d0                	call   *%rax
+  8091ae:	85 c0                	test   %eax,%eax
+  8091b0:	78 22                	js     8091d4 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  8091b2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8091b6:	48 8b 40 38          	mov    0x38(%rax),%rax
+  8091ba:	48 85 c0             	test   %rax,%rax
+  8091bd:	74 0b                	je     8091ca <seek+0x55>
+  8091bf:	89 de                	mov    %ebx,%esi
+  8091c1:	4c 89 e7             	mov    %r12,%rdi
+  8091c4:	ff d0                	call   *%rax
+  8091c6:	85 c0                	test   %eax,%eax
+  8091c8:	78 0a                	js     8091d4 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  8091ca:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  8091cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8091d4:	48 83 c4 10          	add    $0x10,%rsp
+  8091d8:	5b                   	pop    %rbx
+  8091d9:	41 5c                	pop    %r12
+  8091db:	5d                   	pop    %rbp
+  8091dc:	c3                   	ret
+
+00000000008091dd <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  8091dd:	55                   	push   %rbp
+  8091de:	48 89 e5             	mov    %rsp,%rbp
+  8091e1:	41 55                	push   %r13
+  8091e3:	41 54                	push   %r12
+  8091e5:	53                   	push   %rbx
+  8091e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8091ea:	89 fb                	mov    %edi,%ebx
+  8091ec:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8091ef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8091f3:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  8091fa:	00 00 00 
+  8091fd:	ff d0                	call   *%rax
+  8091ff:	85 c0                	test   %eax,%eax
+  809201:	78 38                	js     80923b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  809203:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  809207:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80920b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80920f:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  809216:	00 00 00 
+  809219:	ff d0                	call   *%rax
+  80921b:	85 c0                	test   %eax,%eax
+  80921d:	78 1c                	js     80923b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80921f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  809224:	74 20                	je     809246 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  809226:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80922a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80922e:	48 85 c0             	test   %rax,%rax
+  809231:	74 47                	je     80927a <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  809233:	44 89 e6             	mov    %r12d,%esi
+  809236:	4c 89 ef             	mov    %r13,%rdi
+  809239:	ff d0                	call   *%rax
+}
+  80923b:	48 83 c4 18          	add    $0x18,%rsp
+  80923f:	5b                   	pop    %rbx
+  809240:	41 5c                	pop    %r12
+  809242:	41 5d                	pop    %r13
+  809244:	5d                   	pop    %rbp
+  809245:	c3                   	ret
+                thisenv->env_id, fdnum);
+  809246:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  80924d:	00 00 00 
+  809250:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  809256:	89 da                	mov    %ebx,%edx
+  809258:	48 bf 18 ca 80 00 00 	movabs $0x80ca18,%rdi
+  80925f:	00 00 00 
+  809262:	b8 00 00 00 00       	mov    $0x0,%eax
+  809267:	48 b9 d1 74 80 00 00 	movabs $0x8074d1,%rcx
+  80926e:	00 00 00 
+  809271:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  809273:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  809278:	eb c1                	jmp    80923b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80927a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80927f:	eb ba                	jmp    80923b <ftruncate+0x5e>
+
+0000000000809281 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  809281:	55                   	push   %rbp
+  809282:	48 89 e5             	mov    %rsp,%rbp
+  809285:	41 54                	push   %r12
+  809287:	53                   	push   %rbx
+  809288:	48 83 ec 10          	sub    $0x10,%rsp
+  80928c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80928f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  809293:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80929a:	00 00 00 
+  80929d:	ff d0                	call   *%rax
+  80929f:	85 c0                	test   %eax,%eax
+  8092a1:	78 4e                	js     8092f1 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8092a3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8092a7:	41 8b 3c 24          	mov    (%r12),%edi
+  8092ab:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8092af:	48 b8 f5 8c 80 00 00 	movabs $0x808cf5,%rax
+  8092b6:	00 00 00 
+  8092b9:	ff d0                	call   *%rax
+  8092bb:	85 c0                	test   %eax,%eax
+  8092bd:	78 32                	js     8092f1 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8092bf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8092c3:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8092c8:	74 30                	je     8092fa <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8092ca:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8092cd:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8092d4:	00 00 00 
+    stat->st_isdir = 0;
+  8092d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8092de:	00 00 00 
+    stat->st_dev = dev;
+  8092e1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8092e8:	48 89 de             	mov    %rbx,%rsi
+  8092eb:	4c 89 e7             	mov    %r12,%rdi
+  8092ee:	ff 50 28             	call   *0x28(%rax)
+}
+  8092f1:	48 83 c4 10          	add    $0x10,%rsp
+  8092f5:	5b                   	pop    %rbx
+  8092f6:	41 5c                	pop    %r12
+  8092f8:	5d                   	pop    %rbp
+  8092f9:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8092fa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8092ff:	eb f0                	jmp    8092f1 <fstat+0x70>
+
+0000000000809301 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  809301:	55                   	push   %rbp
+  809302:	48 89 e5             	mov    %rsp,%rbp
+  809305:	41 54                	push   %r12
+  809307:	53                   	push   %rbx
+  809308:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80930b:	be 00 00 00 00       	mov    $0x0,%esi
+  809310:	48 b8 6f a4 80 00 00 	movabs $0x80a46f,%rax
+  809317:	00 00 00 
+  80931a:	ff d0                	call   *%rax
+  80931c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80931e:	85 c0                	test   %eax,%eax
+  809320:	78 25                	js     809347 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  809322:	4c 89 e6             	mov    %r12,%rsi
+  809325:	89 c7                	mov    %eax,%edi
+  809327:	48 b8 81 92 80 00 00 	movabs $0x809281,%rax
+  80932e:	00 00 00 
+  809331:	ff d0                	call   *%rax
+  809333:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  809336:	89 df                	mov    %ebx,%edi
+  809338:	48 b8 0f 8e 80 00 00 	movabs $0x808e0f,%rax
+  80933f:	00 00 00 
+  809342:	ff d0                	call   *%rax
+
+    return res;
+  809344:	44 89 e3             	mov    %r12d,%ebx
+}
+  809347:	89 d8                	mov    %ebx,%eax
+  809349:	5b                   	pop    %rbx
+  80934a:	41 5c                	pop    %r12
+  80934c:	5d                   	pop    %rbp
+  80934d:	c3                   	ret
+
+000000000080934e <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80934e:	48 b8 08 00 87 00 00 	movabs $0x870008,%rax
+  809355:	00 00 00 
+  809358:	83 38 00             	cmpl   $0x0,(%rax)
+  80935b:	74 0a                	je     809367 <fsenv+0x19>
+    return envid;
+}
+  80935d:	a1 08 00 87 00 00 00 	movabs 0x870008,%eax
+  809364:	00 00 
+  809366:	c3                   	ret
+fsenv(void) {
+  809367:	55                   	push   %rbp
+  809368:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80936b:	bf 03 00 00 00       	mov    $0x3,%edi
+  809370:	48 b8 bd 8b 80 00 00 	movabs $0x808bbd,%rax
+  809377:	00 00 00 
+  80937a:	ff d0                	call   *%rax
+  80937c:	a3 08 00 87 00 00 00 	movabs %eax,0x870008
+  809383:	00 00 
+}
+  809385:	a1 08 00 87 00 00 00 	movabs 0x870008,%eax
+  80938c:	00 00 
+  80938e:	5d                   	pop    %rbp
+  80938f:	c3                   	ret
+
+0000000000809390 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  809390:	55                   	push   %rbp
+  809391:	48 89 e5             	mov    %rsp,%rbp
+  809394:	41 54                	push   %r12
+  809396:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  809397:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80939c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8093a1:	48 89 de             	mov    %rbx,%rsi
+  8093a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8093a9:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8093b0:	00 00 00 
+  8093b3:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8093b5:	48 b8 00 26 87 00 00 	movabs $0x872600,%rax
+  8093bc:	00 00 00 
+  8093bf:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8093c5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8093ca:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8093cf:	48 89 de             	mov    %rbx,%rsi
+  8093d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8093d7:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  8093de:	00 00 00 
+  8093e1:	ff d0                	call   *%rax
+  8093e3:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8093e5:	85 c0                	test   %eax,%eax
+  8093e7:	0f 88 a2 00 00 00    	js     80948f <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8093ed:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  8093f4:	00 00 00 
+  8093f7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8093fd:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  809402:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  809404:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  809409:	49 bc 30 b8 80 00 00 	movabs $0x80b830,%r12
+  809410:	00 00 00 
+  809413:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  809416:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  80941b:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80941e:	48 b8 4e 93 80 00 00 	movabs $0x80934e,%rax
+  809425:	00 00 00 
+  809428:	ff d0                	call   *%rax
+  80942a:	89 c7                	mov    %eax,%edi
+  80942c:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  809432:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  809437:	48 89 da             	mov    %rbx,%rdx
+  80943a:	be 09 00 00 00       	mov    $0x9,%esi
+  80943f:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  809446:	00 00 00 
+  809449:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80944b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  809450:	ba 00 00 00 00       	mov    $0x0,%edx
+  809455:	be 00 00 00 00       	mov    $0x0,%esi
+  80945a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80945f:	48 b8 43 8b 80 00 00 	movabs $0x808b43,%rax
+  809466:	00 00 00 
+  809469:	ff d0                	call   *%rax
+  80946b:	89 c3                	mov    %eax,%ebx
+  80946d:	85 c0                	test   %eax,%eax
+  80946f:	78 25                	js     809496 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  809471:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  809478:	00 00 00 
+  80947b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  809481:	a3 00 26 87 00 00 00 	movabs %eax,0x872600
+  809488:	00 00 
+    return 0;
+  80948a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80948f:	89 d8                	mov    %ebx,%eax
+  809491:	5b                   	pop    %rbx
+  809492:	41 5c                	pop    %r12
+  809494:	5d                   	pop    %rbp
+  809495:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  809496:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80949b:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8094a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8094a5:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  8094ac:	00 00 00 
+  8094af:	ff d0                	call   *%rax
+        return res;
+  8094b1:	eb dc                	jmp    80948f <fschan_setup+0xff>
+
+00000000008094b3 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8094b3:	48 b8 04 26 87 00 00 	movabs $0x872604,%rax
+  8094ba:	00 00 00 
+  8094bd:	80 38 00             	cmpb   $0x0,(%rax)
+  8094c0:	74 55                	je     809517 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8094c2:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  8094c9:	00 00 00 
+  8094cc:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8094d2:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8094d7:	48 ba 00 26 87 00 00 	movabs $0x872600,%rdx
+  8094de:	00 00 00 
+  8094e1:	3b 0a                	cmp    (%rdx),%ecx
+  8094e3:	75 01                	jne    8094e6 <fschan+0x33>
+}
+  8094e5:	c3                   	ret
+fschan(void) {
+  8094e6:	55                   	push   %rbp
+  8094e7:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8094ea:	48 b8 90 93 80 00 00 	movabs $0x809390,%rax
+  8094f1:	00 00 00 
+  8094f4:	ff d0                	call   *%rax
+  8094f6:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8094f8:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8094fd:	85 d2                	test   %edx,%edx
+  8094ff:	78 02                	js     809503 <fschan+0x50>
+}
+  809501:	5d                   	pop    %rbp
+  809502:	c3                   	ret
+        fschan_enabled = 0;
+  809503:	48 b8 04 26 87 00 00 	movabs $0x872604,%rax
+  80950a:	00 00 00 
+  80950d:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  809510:	b8 00 00 00 00       	mov    $0x0,%eax
+  809515:	eb ea                	jmp    809501 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  809517:	b8 00 00 00 00       	mov    $0x0,%eax
+  80951c:	c3                   	ret
+
+000000000080951d <fbuf>:
+fbuf(struct Fd *fd) {
+  80951d:	55                   	push   %rbp
+  80951e:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  809521:	48 b8 1c 8c 80 00 00 	movabs $0x808c1c,%rax
+  809528:	00 00 00 
+  80952b:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  80952d:	ba 00 00 00 00       	mov    $0x0,%edx
+  809532:	48 83 f8 1f          	cmp    $0x1f,%rax
+  809536:	77 12                	ja     80954a <fbuf+0x2d>
+  809538:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80953c:	48 b8 00 23 87 00 00 	movabs $0x872300,%rax
+  809543:	00 00 00 
+  809546:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80954a:	48 89 d0             	mov    %rdx,%rax
+  80954d:	5d                   	pop    %rbp
+  80954e:	c3                   	ret
+
+000000000080954f <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  80954f:	55                   	push   %rbp
+  809550:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  809553:	48 83 c7 40          	add    $0x40,%rdi
+  809557:	48 b8 6a b8 80 00 00 	movabs $0x80b86a,%rax
+  80955e:	00 00 00 
+  809561:	ff d0                	call   *%rax
+  809563:	84 c0                	test   %al,%al
+  809565:	75 02                	jne    809569 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  809567:	5d                   	pop    %rbp
+  809568:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  809569:	48 b8 4e 93 80 00 00 	movabs $0x80934e,%rax
+  809570:	00 00 00 
+  809573:	ff d0                	call   *%rax
+  809575:	89 c7                	mov    %eax,%edi
+  809577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80957d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  809582:	ba 00 00 00 00       	mov    $0x0,%edx
+  809587:	be 0a 00 00 00       	mov    $0xa,%esi
+  80958c:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  809593:	00 00 00 
+  809596:	ff d0                	call   *%rax
+}
+  809598:	eb cd                	jmp    809567 <fschan_publish+0x18>
+
+000000000080959a <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80959a:	55                   	push   %rbp
+  80959b:	48 89 e5             	mov    %rsp,%rbp
+  80959e:	41 57                	push   %r15
+  8095a0:	41 56                	push   %r14
+  8095a2:	41 55                	push   %r13
+  8095a4:	41 54                	push   %r12
+  8095a6:	53                   	push   %rbx
+  8095a7:	48 83 ec 48          	sub    $0x48,%rsp
+  8095ab:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8095af:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8095b3:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8095b6:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8095ba:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8095bd:	48 ba 04 00 87 00 00 	movabs $0x870004,%rdx
+  8095c4:	00 00 00 
+  8095c7:	8b 02                	mov    (%rdx),%eax
+  8095c9:	83 c0 01             	add    $0x1,%eax
+  8095cc:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8095d1:	0f 44 c1             	cmove  %ecx,%eax
+  8095d4:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8095d6:	4d 85 c0             	test   %r8,%r8
+  8095d9:	74 2c                	je     809607 <fschan_rw+0x6d>
+  8095db:	45 89 ce             	mov    %r9d,%r14d
+  8095de:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8095e5:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8095e9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8095ef:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8095f6:	00 
+  8095f7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8095fd:	b8 01 00 00 00       	mov    $0x1,%eax
+  809602:	e9 41 01 00 00       	jmp    809748 <fschan_rw+0x1ae>
+  809607:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80960b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80960f:	e9 9c 01 00 00       	jmp    8097b0 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  809614:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  809618:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80961b:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80961e:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  809621:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  809625:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  809629:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80962d:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  809631:	48 89 da             	mov    %rbx,%rdx
+  809634:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  80963b:	00 00 00 
+  80963e:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  809640:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  809644:	48 b8 4f 95 80 00 00 	movabs $0x80954f,%rax
+  80964b:	00 00 00 
+  80964e:	ff d0                	call   *%rax
+            queued += blk;
+  809650:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  809653:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  809657:	4d 39 fc             	cmp    %r15,%r12
+  80965a:	73 6b                	jae    8096c7 <fschan_rw+0x12d>
+  80965c:	41 83 fd 0f          	cmp    $0xf,%r13d
+  809660:	77 65                	ja     8096c7 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  809662:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809666:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80966a:	48 b8 45 b8 80 00 00 	movabs $0x80b845,%rax
+  809671:	00 00 00 
+  809674:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  809676:	4c 89 fb             	mov    %r15,%rbx
+  809679:	4c 29 e3             	sub    %r12,%rbx
+  80967c:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  809681:	48 39 d3             	cmp    %rdx,%rbx
+  809684:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  809688:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80968c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  809690:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  809694:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  809697:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  809699:	48 b9 04 00 87 00 00 	movabs $0x870004,%rcx
+  8096a0:	00 00 00 
+  8096a3:	8b 09                	mov    (%rcx),%ecx
+  8096a5:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8096a8:	83 fe 03             	cmp    $0x3,%esi
+  8096ab:	0f 85 63 ff ff ff    	jne    809614 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8096b1:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8096b5:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8096b8:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8096bb:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8096be:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8096c2:	e9 79 ff ff ff       	jmp    809640 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8096c7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8096cb:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8096d2:	48 89 df             	mov    %rbx,%rdi
+  8096d5:	48 b8 08 b9 80 00 00 	movabs $0x80b908,%rax
+  8096dc:	00 00 00 
+  8096df:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8096e1:	48 89 df             	mov    %rbx,%rdi
+  8096e4:	48 b8 96 b8 80 00 00 	movabs $0x80b896,%rax
+  8096eb:	00 00 00 
+  8096ee:	ff d0                	call   *%rax
+  8096f0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8096f4:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8096f8:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8096fc:	75 25                	jne    809723 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8096fe:	8b 40 04             	mov    0x4(%rax),%eax
+  809701:	85 c0                	test   %eax,%eax
+  809703:	0f 88 86 00 00 00    	js     80978f <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  809709:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80970d:	74 5b                	je     80976a <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80970f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  809713:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  809717:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80971b:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80971f:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  809723:	48 89 df             	mov    %rbx,%rdi
+  809726:	48 b8 bd b8 80 00 00 	movabs $0x80b8bd,%rax
+  80972d:	00 00 00 
+  809730:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  809732:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  809736:	83 f0 01             	xor    $0x1,%eax
+  809739:	4d 39 fc             	cmp    %r15,%r12
+  80973c:	0f 92 c2             	setb   %dl
+  80973f:	84 c2                	test   %al,%dl
+  809741:	75 05                	jne    809748 <fschan_rw+0x1ae>
+  809743:	45 85 ed             	test   %r13d,%r13d
+  809746:	74 50                	je     809798 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  809748:	4d 39 fc             	cmp    %r15,%r12
+  80974b:	0f 92 c1             	setb   %cl
+  80974e:	41 83 fd 0f          	cmp    $0xf,%r13d
+  809752:	0f 96 c2             	setbe  %dl
+  809755:	84 d1                	test   %dl,%cl
+  809757:	0f 84 6a ff ff ff    	je     8096c7 <fschan_rw+0x12d>
+  80975d:	84 c0                	test   %al,%al
+  80975f:	0f 85 fd fe ff ff    	jne    809662 <fschan_rw+0xc8>
+  809765:	e9 5d ff ff ff       	jmp    8096c7 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80976a:	48 63 d0             	movslq %eax,%rdx
+  80976d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  809771:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  809775:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  809779:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80977d:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  809781:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  809788:	00 00 00 
+  80978b:	ff d0                	call   *%rax
+  80978d:	eb 80                	jmp    80970f <fschan_rw+0x175>
+                err = msg->fm_res;
+  80978f:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  809792:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  809796:	eb 8b                	jmp    809723 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  809798:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80979d:	0f 85 68 fe ff ff    	jne    80960b <fschan_rw+0x71>
+  8097a3:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8097a6:	85 c0                	test   %eax,%eax
+  8097a8:	0f 84 5d fe ff ff    	je     80960b <fschan_rw+0x71>
+  8097ae:	48 98                	cltq
+}
+  8097b0:	48 83 c4 48          	add    $0x48,%rsp
+  8097b4:	5b                   	pop    %rbx
+  8097b5:	41 5c                	pop    %r12
+  8097b7:	41 5d                	pop    %r13
+  8097b9:	41 5e                	pop    %r14
+  8097bb:	41 5f                	pop    %r15
+  8097bd:	5d                   	pop    %rbp
+  8097be:	c3                   	ret
+
+00000000008097bf <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8097bf:	55                   	push   %rbp
+  8097c0:	48 89 e5             	mov    %rsp,%rbp
+  8097c3:	41 56                	push   %r14
+  8097c5:	41 55                	push   %r13
+  8097c7:	41 54                	push   %r12
+  8097c9:	53                   	push   %rbx
+  8097ca:	48 83 ec 10          	sub    $0x10,%rsp
+  8097ce:	49 89 fe             	mov    %rdi,%r14
+  8097d1:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8097d4:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8097d8:	48 29 f3             	sub    %rsi,%rbx
+  8097db:	48 39 d3             	cmp    %rdx,%rbx
+  8097de:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8097e2:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8097e9:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8097ea:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8097ef:	49 bd 38 b4 80 00 00 	movabs $0x80b438,%r13
+  8097f6:	00 00 00 
+  8097f9:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  809800:	76 1e                	jbe    809820 <mmap_fault+0x61>
+  809802:	4c 01 e7             	add    %r12,%rdi
+  809805:	41 ff d5             	call   *%r13
+  809808:	84 c0                	test   %al,%al
+  80980a:	75 14                	jne    809820 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80980c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  809810:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  809817:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80981b:	48 39 df             	cmp    %rbx,%rdi
+  80981e:	72 e2                	jb     809802 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  809820:	48 bb 00 10 87 00 00 	movabs $0x871000,%rbx
+  809827:	00 00 00 
+  80982a:	48 ba 00 20 87 00 00 	movabs $0x872000,%rdx
+  809831:	00 00 00 
+  809834:	4c 89 f0             	mov    %r14,%rax
+  809837:	48 29 d0             	sub    %rdx,%rax
+  80983a:	48 c1 f8 03          	sar    $0x3,%rax
+  80983e:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  809845:	aa aa aa 
+  809848:	48 0f af c2          	imul   %rdx,%rax
+  80984c:	48 c1 e0 0c          	shl    $0xc,%rax
+  809850:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  809855:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  809859:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80985b:	44 89 e0             	mov    %r12d,%eax
+  80985e:	41 03 46 10          	add    0x10(%r14),%eax
+  809862:	41 2b 06             	sub    (%r14),%eax
+  809865:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  809868:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80986c:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  809870:	41 8b 46 14          	mov    0x14(%r14),%eax
+  809874:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  809877:	48 b8 4e 93 80 00 00 	movabs $0x80934e,%rax
+  80987e:	00 00 00 
+  809881:	ff d0                	call   *%rax
+  809883:	89 c7                	mov    %eax,%edi
+  809885:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80988b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  809890:	48 89 da             	mov    %rbx,%rdx
+  809893:	be 0f 00 00 00       	mov    $0xf,%esi
+  809898:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  80989f:	00 00 00 
+  8098a2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8098a4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8098a9:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8098ad:	4c 89 e6             	mov    %r12,%rsi
+  8098b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8098b5:	48 b8 43 8b 80 00 00 	movabs $0x808b43,%rax
+  8098bc:	00 00 00 
+  8098bf:	ff d0                	call   *%rax
+  8098c1:	48 98                	cltq
+}
+  8098c3:	48 83 c4 10          	add    $0x10,%rsp
+  8098c7:	5b                   	pop    %rbx
+  8098c8:	41 5c                	pop    %r12
+  8098ca:	41 5d                	pop    %r13
+  8098cc:	41 5e                	pop    %r14
+  8098ce:	5d                   	pop    %rbp
+  8098cf:	c3                   	ret
+
+00000000008098d0 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8098d0:	48 8b 37             	mov    (%rdi),%rsi
+  8098d3:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8098da:	48 ba 00 20 87 00 00 	movabs $0x872000,%rdx
+  8098e1:	00 00 00 
+  8098e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8098e9:	eb 0f                	jmp    8098fa <mmap_pgfault+0x2a>
+  8098eb:	c3                   	ret
+  8098ec:	48 83 c1 01          	add    $0x1,%rcx
+  8098f0:	48 83 c2 18          	add    $0x18,%rdx
+  8098f4:	48 83 f9 20          	cmp    $0x20,%rcx
+  8098f8:	74 6e                	je     809968 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8098fa:	48 8b 02             	mov    (%rdx),%rax
+  8098fd:	48 83 e8 01          	sub    $0x1,%rax
+  809901:	48 39 f0             	cmp    %rsi,%rax
+  809904:	73 e6                	jae    8098ec <mmap_pgfault+0x1c>
+  809906:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80990a:	73 e0                	jae    8098ec <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80990c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  809910:	b8 00 00 00 00       	mov    $0x0,%eax
+  809915:	f6 c2 01             	test   $0x1,%dl
+  809918:	75 d1                	jne    8098eb <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80991a:	f6 c2 02             	test   $0x2,%dl
+  80991d:	74 1a                	je     809939 <mmap_pgfault+0x69>
+  80991f:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  809923:	b8 00 00 00 00       	mov    $0x0,%eax
+  809928:	48 bf 00 20 87 00 00 	movabs $0x872000,%rdi
+  80992f:	00 00 00 
+  809932:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  809937:	74 35                	je     80996e <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  809939:	55                   	push   %rbp
+  80993a:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80993d:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  809941:	48 b8 00 20 87 00 00 	movabs $0x872000,%rax
+  809948:	00 00 00 
+  80994b:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80994f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  809954:	48 b8 bf 97 80 00 00 	movabs $0x8097bf,%rax
+  80995b:	00 00 00 
+  80995e:	ff d0                	call   *%rax
+  809960:	48 85 c0             	test   %rax,%rax
+  809963:	0f 9f c0             	setg   %al
+}
+  809966:	5d                   	pop    %rbp
+  809967:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  809968:	b8 00 00 00 00       	mov    $0x0,%eax
+  80996d:	c3                   	ret
+}
+  80996e:	c3                   	ret
+
+000000000080996f <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80996f:	55                   	push   %rbp
+  809970:	48 89 e5             	mov    %rsp,%rbp
+  809973:	41 54                	push   %r12
+  809975:	53                   	push   %rbx
+  809976:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  809979:	48 b8 00 20 87 00 00 	movabs $0x872000,%rax
+  809980:	00 00 00 
+  809983:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  809988:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80998c:	74 15                	je     8099a3 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80998e:	48 83 c3 01          	add    $0x1,%rbx
+  809992:	48 83 c0 18          	add    $0x18,%rax
+  809996:	48 83 fb 20          	cmp    $0x20,%rbx
+  80999a:	75 ec                	jne    809988 <mmap_alloc+0x19>
+    return NULL;
+  80999c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8099a1:	eb 52                	jmp    8099f5 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8099a3:	4c 89 e7             	mov    %r12,%rdi
+  8099a6:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  8099ad:	00 00 00 
+  8099b0:	ff d0                	call   *%rax
+  8099b2:	41 89 c1             	mov    %eax,%r9d
+  8099b5:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8099bc:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8099c0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8099c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8099cb:	4c 89 e6             	mov    %r12,%rsi
+  8099ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8099d3:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  8099da:	00 00 00 
+  8099dd:	ff d0                	call   *%rax
+  8099df:	85 c0                	test   %eax,%eax
+  8099e1:	78 17                	js     8099fa <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8099e3:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8099e7:	48 b8 00 20 87 00 00 	movabs $0x872000,%rax
+  8099ee:	00 00 00 
+  8099f1:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8099f5:	5b                   	pop    %rbx
+  8099f6:	41 5c                	pop    %r12
+  8099f8:	5d                   	pop    %rbp
+  8099f9:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8099fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8099ff:	eb f4                	jmp    8099f5 <mmap_alloc+0x86>
+
+0000000000809a01 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  809a01:	55                   	push   %rbp
+  809a02:	48 89 e5             	mov    %rsp,%rbp
+  809a05:	41 56                	push   %r14
+  809a07:	41 55                	push   %r13
+  809a09:	41 54                	push   %r12
+  809a0b:	53                   	push   %rbx
+  809a0c:	48 83 ec 10          	sub    $0x10,%rsp
+  809a10:	41 89 fc             	mov    %edi,%r12d
+  809a13:	49 89 f5             	mov    %rsi,%r13
+  809a16:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  809a19:	48 89 f0             	mov    %rsi,%rax
+  809a1c:	48 09 d0             	or     %rdx,%rax
+  809a1f:	75 0d                	jne    809a2e <fsipc+0x2d>
+  809a21:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  809a24:	83 f8 04             	cmp    $0x4,%eax
+  809a27:	76 7d                	jbe    809aa6 <fsipc+0xa5>
+  809a29:	83 ff 0d             	cmp    $0xd,%edi
+  809a2c:	74 78                	je     809aa6 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  809a2e:	48 b8 4e 93 80 00 00 	movabs $0x80934e,%rax
+  809a35:	00 00 00 
+  809a38:	ff d0                	call   *%rax
+  809a3a:	89 c7                	mov    %eax,%edi
+  809a3c:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  809a43:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  809a4a:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  809a51:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  809a57:	48 ba 00 00 88 00 00 	movabs $0x880000,%rdx
+  809a5e:	00 00 00 
+  809a61:	44 89 e6             	mov    %r12d,%esi
+  809a64:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  809a6b:	00 00 00 
+  809a6e:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  809a70:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  809a77:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  809a78:	b9 00 00 00 00       	mov    $0x0,%ecx
+  809a7d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  809a81:	4c 89 ee             	mov    %r13,%rsi
+  809a84:	bf 00 00 00 00       	mov    $0x0,%edi
+  809a89:	48 b8 43 8b 80 00 00 	movabs $0x808b43,%rax
+  809a90:	00 00 00 
+  809a93:	ff d0                	call   *%rax
+  809a95:	89 c3                	mov    %eax,%ebx
+}
+  809a97:	89 d8                	mov    %ebx,%eax
+  809a99:	48 83 c4 10          	add    $0x10,%rsp
+  809a9d:	5b                   	pop    %rbx
+  809a9e:	41 5c                	pop    %r12
+  809aa0:	41 5d                	pop    %r13
+  809aa2:	41 5e                	pop    %r14
+  809aa4:	5d                   	pop    %rbp
+  809aa5:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  809aa6:	48 b8 b3 94 80 00 00 	movabs $0x8094b3,%rax
+  809aad:	00 00 00 
+  809ab0:	ff d0                	call   *%rax
+  809ab2:	49 89 c6             	mov    %rax,%r14
+  809ab5:	48 85 c0             	test   %rax,%rax
+  809ab8:	0f 84 70 ff ff ff    	je     809a2e <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  809abe:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  809ac2:	48 b8 45 b8 80 00 00 	movabs $0x80b845,%rax
+  809ac9:	00 00 00 
+  809acc:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  809ace:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  809ad1:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  809ad8:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  809adc:	ba 10 00 00 00       	mov    $0x10,%edx
+  809ae1:	48 be 00 00 88 00 00 	movabs $0x880000,%rsi
+  809ae8:	00 00 00 
+  809aeb:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  809af2:	00 00 00 
+  809af5:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  809af7:	4c 89 f7             	mov    %r14,%rdi
+  809afa:	48 b8 4f 95 80 00 00 	movabs $0x80954f,%rax
+  809b01:	00 00 00 
+  809b04:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  809b06:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  809b0d:	4c 89 f7             	mov    %r14,%rdi
+  809b10:	48 b8 08 b9 80 00 00 	movabs $0x80b908,%rax
+  809b17:	00 00 00 
+  809b1a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  809b1c:	4c 89 f7             	mov    %r14,%rdi
+  809b1f:	48 b8 96 b8 80 00 00 	movabs $0x80b896,%rax
+  809b26:	00 00 00 
+  809b29:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  809b2b:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  809b2e:	41 83 fc 05          	cmp    $0x5,%r12d
+  809b32:	75 04                	jne    809b38 <fsipc+0x137>
+  809b34:	85 db                	test   %ebx,%ebx
+  809b36:	79 14                	jns    809b4c <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  809b38:	4c 89 f7             	mov    %r14,%rdi
+  809b3b:	48 b8 bd b8 80 00 00 	movabs $0x80b8bd,%rax
+  809b42:	00 00 00 
+  809b45:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  809b47:	e9 4b ff ff ff       	jmp    809a97 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  809b4c:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  809b50:	ba 88 00 00 00       	mov    $0x88,%edx
+  809b55:	48 bf 00 00 88 00 00 	movabs $0x880000,%rdi
+  809b5c:	00 00 00 
+  809b5f:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  809b66:	00 00 00 
+  809b69:	ff d0                	call   *%rax
+  809b6b:	eb cb                	jmp    809b38 <fsipc+0x137>
+
+0000000000809b6d <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  809b6d:	55                   	push   %rbp
+  809b6e:	48 89 e5             	mov    %rsp,%rbp
+  809b71:	41 57                	push   %r15
+  809b73:	41 56                	push   %r14
+  809b75:	41 55                	push   %r13
+  809b77:	41 54                	push   %r12
+  809b79:	53                   	push   %rbx
+  809b7a:	48 83 ec 18          	sub    $0x18,%rsp
+  809b7e:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  809b82:	49 89 f6             	mov    %rsi,%r14
+  809b85:	49 89 d4             	mov    %rdx,%r12
+  809b88:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  809b8b:	48 b8 b3 94 80 00 00 	movabs $0x8094b3,%rax
+  809b92:	00 00 00 
+  809b95:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  809b97:	48 85 c0             	test   %rax,%rax
+  809b9a:	0f 85 96 00 00 00    	jne    809c36 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  809ba0:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  809ba7:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  809ba8:	49 bf 00 00 88 00 00 	movabs $0x880000,%r15
+  809baf:	00 00 00 
+    while (n) {
+  809bb2:	4d 85 e4             	test   %r12,%r12
+  809bb5:	74 79                	je     809c30 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  809bb7:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  809bbc:	49 39 dc             	cmp    %rbx,%r12
+  809bbf:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  809bc3:	48 89 da             	mov    %rbx,%rdx
+  809bc6:	4c 89 f6             	mov    %r14,%rsi
+  809bc9:	48 bf 00 10 88 00 00 	movabs $0x881000,%rdi
+  809bd0:	00 00 00 
+  809bd3:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  809bda:	00 00 00 
+  809bdd:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  809bdf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  809be3:	8b 40 0c             	mov    0xc(%rax),%eax
+  809be6:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  809be9:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  809bec:	44 01 e8             	add    %r13d,%eax
+  809bef:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  809bf3:	41 0f 44 c5          	cmove  %r13d,%eax
+  809bf7:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  809bfb:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  809bff:	48 89 da             	mov    %rbx,%rdx
+  809c02:	be 00 00 00 00       	mov    $0x0,%esi
+  809c07:	bf 04 00 00 00       	mov    $0x4,%edi
+  809c0c:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  809c13:	00 00 00 
+  809c16:	ff d0                	call   *%rax
+        if (res < 0)
+  809c18:	85 c0                	test   %eax,%eax
+  809c1a:	78 4a                	js     809c66 <devfile_write_direct+0xf9>
+        buf += res;
+  809c1c:	48 98                	cltq
+  809c1e:	49 01 c6             	add    %rax,%r14
+        write += res;
+  809c21:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  809c25:	49 29 c4             	sub    %rax,%r12
+  809c28:	75 8d                	jne    809bb7 <devfile_write_direct+0x4a>
+    return write;
+  809c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  809c2e:	eb 27                	jmp    809c57 <devfile_write_direct+0xea>
+    size_t write = 0;
+  809c30:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  809c34:	eb f4                	jmp    809c2a <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  809c36:	45 89 e9             	mov    %r13d,%r9d
+  809c39:	4d 89 e0             	mov    %r12,%r8
+  809c3c:	4c 89 f1             	mov    %r14,%rcx
+  809c3f:	ba 04 00 00 00       	mov    $0x4,%edx
+  809c44:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  809c48:	48 89 c7             	mov    %rax,%rdi
+  809c4b:	48 b8 9a 95 80 00 00 	movabs $0x80959a,%rax
+  809c52:	00 00 00 
+  809c55:	ff d0                	call   *%rax
+}
+  809c57:	48 83 c4 18          	add    $0x18,%rsp
+  809c5b:	5b                   	pop    %rbx
+  809c5c:	41 5c                	pop    %r12
+  809c5e:	41 5d                	pop    %r13
+  809c60:	41 5e                	pop    %r14
+  809c62:	41 5f                	pop    %r15
+  809c64:	5d                   	pop    %rbp
+  809c65:	c3                   	ret
+            return res;
+  809c66:	48 98                	cltq
+  809c68:	eb ed                	jmp    809c57 <devfile_write_direct+0xea>
+
+0000000000809c6a <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  809c6a:	55                   	push   %rbp
+  809c6b:	48 89 e5             	mov    %rsp,%rbp
+  809c6e:	41 54                	push   %r12
+  809c70:	53                   	push   %rbx
+  809c71:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  809c74:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  809c7b:	00 00 00 
+  809c7e:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  809c80:	48 85 c0             	test   %rax,%rax
+  809c83:	74 71                	je     809cf6 <fbuf_flush+0x8c>
+  809c85:	48 89 c3             	mov    %rax,%rbx
+  809c88:	b8 00 00 00 00       	mov    $0x0,%eax
+  809c8d:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  809c91:	75 05                	jne    809c98 <fbuf_flush+0x2e>
+}
+  809c93:	5b                   	pop    %rbx
+  809c94:	41 5c                	pop    %r12
+  809c96:	5d                   	pop    %rbp
+  809c97:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  809c98:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  809c9b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  809c9f:	48 b8 00 23 87 00 00 	movabs $0x872300,%rax
+  809ca6:	00 00 00 
+  809ca9:	48 89 de             	mov    %rbx,%rsi
+  809cac:	48 29 c6             	sub    %rax,%rsi
+  809caf:	48 c1 fe 03          	sar    $0x3,%rsi
+  809cb3:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  809cba:	aa aa aa 
+  809cbd:	48 0f af f0          	imul   %rax,%rsi
+  809cc1:	48 c1 e6 0e          	shl    $0xe,%rsi
+  809cc5:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  809cca:	48 01 c6             	add    %rax,%rsi
+  809ccd:	4c 89 e7             	mov    %r12,%rdi
+  809cd0:	48 b8 6d 9b 80 00 00 	movabs $0x809b6d,%rax
+  809cd7:	00 00 00 
+  809cda:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  809cdc:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  809ce0:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  809ce7:	00 
+    return res < 0 ? res : 0;
+  809ce8:	48 85 c0             	test   %rax,%rax
+  809ceb:	ba 00 00 00 00       	mov    $0x0,%edx
+  809cf0:	48 0f 4f c2          	cmovg  %rdx,%rax
+  809cf4:	eb 9d                	jmp    809c93 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  809cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  809cfb:	eb 96                	jmp    809c93 <fbuf_flush+0x29>
+
+0000000000809cfd <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  809cfd:	55                   	push   %rbp
+  809cfe:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  809d01:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  809d08:	00 00 00 
+  809d0b:	ff d0                	call   *%rax
+}
+  809d0d:	5d                   	pop    %rbp
+  809d0e:	c3                   	ret
+
+0000000000809d0f <devfile_write>:
+    if (!fd || !buf)
+  809d0f:	48 85 ff             	test   %rdi,%rdi
+  809d12:	0f 84 d3 01 00 00    	je     809eeb <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  809d18:	55                   	push   %rbp
+  809d19:	48 89 e5             	mov    %rsp,%rbp
+  809d1c:	41 57                	push   %r15
+  809d1e:	41 56                	push   %r14
+  809d20:	41 55                	push   %r13
+  809d22:	41 54                	push   %r12
+  809d24:	53                   	push   %rbx
+  809d25:	48 83 ec 08          	sub    $0x8,%rsp
+  809d29:	49 89 fc             	mov    %rdi,%r12
+  809d2c:	49 89 f6             	mov    %rsi,%r14
+  809d2f:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  809d32:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  809d37:	48 85 f6             	test   %rsi,%rsi
+  809d3a:	0f 84 9c 01 00 00    	je     809edc <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  809d40:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  809d47:	00 00 00 
+  809d4a:	ff d0                	call   *%rax
+  809d4c:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  809d4f:	48 85 c0             	test   %rax,%rax
+  809d52:	0f 84 a2 00 00 00    	je     809dfa <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  809d58:	be 00 10 00 00       	mov    $0x1000,%esi
+  809d5d:	4c 89 e7             	mov    %r12,%rdi
+  809d60:	48 b8 1a 83 80 00 00 	movabs $0x80831a,%rax
+  809d67:	00 00 00 
+  809d6a:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  809d6c:	83 f8 02             	cmp    $0x2,%eax
+  809d6f:	0f 8f 85 00 00 00    	jg     809dfa <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  809d75:	48 b8 00 23 87 00 00 	movabs $0x872300,%rax
+  809d7c:	00 00 00 
+  809d7f:	4d 89 ef             	mov    %r13,%r15
+  809d82:	49 29 c7             	sub    %rax,%r15
+  809d85:	49 c1 ff 03          	sar    $0x3,%r15
+  809d89:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  809d90:	aa aa aa 
+  809d93:	4c 0f af f8          	imul   %rax,%r15
+  809d97:	49 c1 e7 0e          	shl    $0xe,%r15
+  809d9b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  809da0:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  809da3:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  809da8:	0f 84 d7 00 00 00    	je     809e85 <devfile_write+0x176>
+  809dae:	49 8b 45 10          	mov    0x10(%r13),%rax
+  809db2:	89 c2                	mov    %eax,%edx
+  809db4:	41 03 55 0c          	add    0xc(%r13),%edx
+  809db8:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  809dbd:	75 0f                	jne    809dce <devfile_write+0xbf>
+  809dbf:	48 01 d8             	add    %rbx,%rax
+  809dc2:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  809dc8:	0f 86 92 00 00 00    	jbe    809e60 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  809dce:	4c 89 e7             	mov    %r12,%rdi
+  809dd1:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  809dd8:	00 00 00 
+  809ddb:	ff d0                	call   *%rax
+  809ddd:	85 c0                	test   %eax,%eax
+  809ddf:	78 52                	js     809e33 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  809de1:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  809de8:	77 7f                	ja     809e69 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  809dea:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  809def:	0f 85 c2 00 00 00    	jne    809eb7 <devfile_write+0x1a8>
+  809df5:	e9 94 00 00 00       	jmp    809e8e <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  809dfa:	4c 89 e7             	mov    %r12,%rdi
+  809dfd:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  809e04:	00 00 00 
+  809e07:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  809e09:	85 c0                	test   %eax,%eax
+  809e0b:	79 07                	jns    809e14 <devfile_write+0x105>
+  809e0d:	48 98                	cltq
+  809e0f:	e9 c8 00 00 00       	jmp    809edc <devfile_write+0x1cd>
+  809e14:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  809e19:	48 89 da             	mov    %rbx,%rdx
+  809e1c:	4c 89 f6             	mov    %r14,%rsi
+  809e1f:	4c 89 e7             	mov    %r12,%rdi
+  809e22:	48 b8 6d 9b 80 00 00 	movabs $0x809b6d,%rax
+  809e29:	00 00 00 
+  809e2c:	ff d0                	call   *%rax
+  809e2e:	e9 a9 00 00 00       	jmp    809edc <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  809e33:	48 98                	cltq
+  809e35:	e9 a2 00 00 00       	jmp    809edc <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  809e3a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  809e3f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  809e44:	4c 89 fe             	mov    %r15,%rsi
+  809e47:	bf 00 00 00 00       	mov    $0x0,%edi
+  809e4c:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  809e53:	00 00 00 
+  809e56:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  809e58:	85 c0                	test   %eax,%eax
+  809e5a:	79 45                	jns    809ea1 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  809e5c:	48 98                	cltq
+  809e5e:	eb 7c                	jmp    809edc <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  809e60:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  809e67:	76 4e                	jbe    809eb7 <devfile_write+0x1a8>
+  809e69:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  809e6e:	48 89 da             	mov    %rbx,%rdx
+  809e71:	4c 89 f6             	mov    %r14,%rsi
+  809e74:	4c 89 e7             	mov    %r12,%rdi
+  809e77:	48 b8 6d 9b 80 00 00 	movabs $0x809b6d,%rax
+  809e7e:	00 00 00 
+  809e81:	ff d0                	call   *%rax
+  809e83:	eb 57                	jmp    809edc <devfile_write+0x1cd>
+  809e85:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  809e8c:	77 db                	ja     809e69 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  809e8e:	4c 89 ff             	mov    %r15,%rdi
+  809e91:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  809e98:	00 00 00 
+  809e9b:	ff d0                	call   *%rax
+  809e9d:	84 c0                	test   %al,%al
+  809e9f:	74 99                	je     809e3a <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  809ea1:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  809ea6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  809eab:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  809eaf:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  809eb6:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  809eb7:	4c 89 ff             	mov    %r15,%rdi
+  809eba:	49 03 7d 10          	add    0x10(%r13),%rdi
+  809ebe:	48 89 da             	mov    %rbx,%rdx
+  809ec1:	4c 89 f6             	mov    %r14,%rsi
+  809ec4:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  809ecb:	00 00 00 
+  809ece:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  809ed0:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  809ed4:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  809ed9:	48 89 d8             	mov    %rbx,%rax
+}
+  809edc:	48 83 c4 08          	add    $0x8,%rsp
+  809ee0:	5b                   	pop    %rbx
+  809ee1:	41 5c                	pop    %r12
+  809ee3:	41 5d                	pop    %r13
+  809ee5:	41 5e                	pop    %r14
+  809ee7:	41 5f                	pop    %r15
+  809ee9:	5d                   	pop    %rbp
+  809eea:	c3                   	ret
+        return E_INVAL;
+  809eeb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  809ef0:	c3                   	ret
+
+0000000000809ef1 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  809ef1:	55                   	push   %rbp
+  809ef2:	48 89 e5             	mov    %rsp,%rbp
+  809ef5:	41 54                	push   %r12
+  809ef7:	53                   	push   %rbx
+  809ef8:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  809efb:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  809f02:	00 00 00 
+  809f05:	ff d0                	call   *%rax
+  809f07:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  809f0a:	48 89 df             	mov    %rbx,%rdi
+  809f0d:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  809f14:	00 00 00 
+  809f17:	ff d0                	call   *%rax
+  809f19:	48 85 c0             	test   %rax,%rax
+  809f1c:	74 17                	je     809f35 <devfile_flush+0x44>
+  809f1e:	48 89 df             	mov    %rbx,%rdi
+  809f21:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  809f28:	00 00 00 
+  809f2b:	ff d0                	call   *%rax
+  809f2d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  809f34:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  809f35:	8b 43 0c             	mov    0xc(%rbx),%eax
+  809f38:	a3 00 00 88 00 00 00 	movabs %eax,0x880000
+  809f3f:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  809f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  809f46:	be 00 00 00 00       	mov    $0x0,%esi
+  809f4b:	bf 06 00 00 00       	mov    $0x6,%edi
+  809f50:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  809f57:	00 00 00 
+  809f5a:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  809f5c:	45 85 e4             	test   %r12d,%r12d
+  809f5f:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  809f63:	5b                   	pop    %rbx
+  809f64:	41 5c                	pop    %r12
+  809f66:	5d                   	pop    %rbp
+  809f67:	c3                   	ret
+
+0000000000809f68 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  809f68:	55                   	push   %rbp
+  809f69:	48 89 e5             	mov    %rsp,%rbp
+  809f6c:	41 57                	push   %r15
+  809f6e:	41 56                	push   %r14
+  809f70:	41 55                	push   %r13
+  809f72:	41 54                	push   %r12
+  809f74:	53                   	push   %rbx
+  809f75:	48 83 ec 38          	sub    $0x38,%rsp
+  809f79:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  809f7d:	49 89 f7             	mov    %rsi,%r15
+  809f80:	48 89 d3             	mov    %rdx,%rbx
+  809f83:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  809f86:	48 b8 b3 94 80 00 00 	movabs $0x8094b3,%rax
+  809f8d:	00 00 00 
+  809f90:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  809f92:	48 85 c0             	test   %rax,%rax
+  809f95:	75 20                	jne    809fb7 <devfile_read_direct+0x4f>
+    bool map = 1;
+  809f97:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  809f9c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  809fa3:	00 
+    while (n) {
+  809fa4:	48 85 db             	test   %rbx,%rbx
+  809fa7:	0f 85 df 00 00 00    	jne    80a08c <devfile_read_direct+0x124>
+    size_t read = 0;
+  809fad:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  809fb1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  809fb5:	eb 21                	jmp    809fd8 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  809fb7:	45 89 f1             	mov    %r14d,%r9d
+  809fba:	49 89 d8             	mov    %rbx,%r8
+  809fbd:	4c 89 f9             	mov    %r15,%rcx
+  809fc0:	ba 03 00 00 00       	mov    $0x3,%edx
+  809fc5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  809fc9:	48 89 c7             	mov    %rax,%rdi
+  809fcc:	48 b8 9a 95 80 00 00 	movabs $0x80959a,%rax
+  809fd3:	00 00 00 
+  809fd6:	ff d0                	call   *%rax
+}
+  809fd8:	48 83 c4 38          	add    $0x38,%rsp
+  809fdc:	5b                   	pop    %rbx
+  809fdd:	41 5c                	pop    %r12
+  809fdf:	41 5d                	pop    %r13
+  809fe1:	41 5e                	pop    %r14
+  809fe3:	41 5f                	pop    %r15
+  809fe5:	5d                   	pop    %rbp
+  809fe6:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  809fe7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  809feb:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  809ff1:	75 1e                	jne    80a011 <devfile_read_direct+0xa9>
+  809ff3:	e9 e2 00 00 00       	jmp    80a0da <devfile_read_direct+0x172>
+            if (!res) return read;
+  809ff8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  809ffc:	eb da                	jmp    809fd8 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  809ffe:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80a002:	0f 85 d0 01 00 00    	jne    80a1d8 <devfile_read_direct+0x270>
+            map = 0;
+  80a008:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80a00c:	eb 03                	jmp    80a011 <devfile_read_direct+0xa9>
+  80a00e:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80a011:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80a016:	48 39 d3             	cmp    %rdx,%rbx
+  80a019:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80a01d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80a021:	8b 40 0c             	mov    0xc(%rax),%eax
+  80a024:	48 b9 00 00 88 00 00 	movabs $0x880000,%rcx
+  80a02b:	00 00 00 
+  80a02e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  80a030:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80a034:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  80a038:	be 00 00 00 00       	mov    $0x0,%esi
+  80a03d:	bf 03 00 00 00       	mov    $0x3,%edi
+  80a042:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a049:	00 00 00 
+  80a04c:	ff d0                	call   *%rax
+        if (res <= 0)
+  80a04e:	85 c0                	test   %eax,%eax
+  80a050:	0f 8e 63 01 00 00    	jle    80a1b9 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  80a056:	4c 63 e0             	movslq %eax,%r12
+  80a059:	4c 89 e2             	mov    %r12,%rdx
+  80a05c:	48 be 00 10 88 00 00 	movabs $0x881000,%rsi
+  80a063:	00 00 00 
+  80a066:	4c 89 ff             	mov    %r15,%rdi
+  80a069:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  80a070:	00 00 00 
+  80a073:	ff d0                	call   *%rax
+        buf += res;
+  80a075:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  80a078:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  80a07b:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  80a07f:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  80a083:	48 85 db             	test   %rbx,%rbx
+  80a086:	0f 84 25 ff ff ff    	je     809fb1 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80a08c:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80a08f:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80a093:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80a097:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80a09b:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80a0a2:	0f 97 c2             	seta   %dl
+  80a0a5:	20 c2                	and    %al,%dl
+  80a0a7:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  80a0aa:	0f 84 5e ff ff ff    	je     80a00e <devfile_read_direct+0xa6>
+  80a0b0:	4c 89 fa             	mov    %r15,%rdx
+  80a0b3:	4d 89 fd             	mov    %r15,%r13
+  80a0b6:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80a0bd:	0f 85 4e ff ff ff    	jne    80a011 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80a0c3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80a0c7:	0f 84 1a ff ff ff    	je     809fe7 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80a0cd:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80a0d4:	0f 85 37 ff ff ff    	jne    80a011 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  80a0da:	48 89 d8             	mov    %rbx,%rax
+  80a0dd:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80a0e3:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80a0e8:	48 39 c8             	cmp    %rcx,%rax
+  80a0eb:	48 0f 47 c1          	cmova  %rcx,%rax
+  80a0ef:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  80a0f3:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  80a0f7:	49 89 d4             	mov    %rdx,%r12
+  80a0fa:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80a0fe:	48 b8 d9 b3 80 00 00 	movabs $0x80b3d9,%rax
+  80a105:	00 00 00 
+  80a108:	ff d0                	call   *%rax
+  80a10a:	a8 40                	test   $0x40,%al
+  80a10c:	0f 85 b9 00 00 00    	jne    80a1cb <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  80a112:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80a119:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80a11d:	49 39 c5             	cmp    %rax,%r13
+  80a120:	72 d8                	jb     80a0fa <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80a122:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80a126:	48 ba 00 00 88 00 00 	movabs $0x880000,%rdx
+  80a12d:	00 00 00 
+  80a130:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80a134:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  80a137:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  80a139:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  80a13d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  80a141:	48 b8 4e 93 80 00 00 	movabs $0x80934e,%rax
+  80a148:	00 00 00 
+  80a14b:	ff d0                	call   *%rax
+  80a14d:	89 c7                	mov    %eax,%edi
+  80a14f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80a155:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80a15a:	48 ba 00 00 88 00 00 	movabs $0x880000,%rdx
+  80a161:	00 00 00 
+  80a164:	be 0e 00 00 00       	mov    $0xe,%esi
+  80a169:	48 b8 67 8b 80 00 00 	movabs $0x808b67,%rax
+  80a170:	00 00 00 
+  80a173:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  80a175:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80a17a:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80a17e:	4c 89 fe             	mov    %r15,%rsi
+  80a181:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a186:	48 b8 43 8b 80 00 00 	movabs $0x808b43,%rax
+  80a18d:	00 00 00 
+  80a190:	ff d0                	call   *%rax
+  80a192:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80a195:	48 85 d2             	test   %rdx,%rdx
+  80a198:	0f 84 5a fe ff ff    	je     809ff8 <devfile_read_direct+0x90>
+            if (res > 0) {
+  80a19e:	0f 8e 5a fe ff ff    	jle    809ffe <devfile_read_direct+0x96>
+                buf += res;
+  80a1a4:	48 98                	cltq
+  80a1a6:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  80a1a9:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  80a1ac:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  80a1b0:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80a1b4:	e9 ca fe ff ff       	jmp    80a083 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  80a1b9:	41 89 c5             	mov    %eax,%r13d
+  80a1bc:	48 98                	cltq
+  80a1be:	45 85 ed             	test   %r13d,%r13d
+  80a1c1:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80a1c6:	e9 0d fe ff ff       	jmp    809fd8 <devfile_read_direct+0x70>
+            map = 0;
+  80a1cb:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80a1cf:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80a1d3:	e9 39 fe ff ff       	jmp    80a011 <devfile_read_direct+0xa9>
+  80a1d8:	48 89 d0             	mov    %rdx,%rax
+  80a1db:	e9 f8 fd ff ff       	jmp    809fd8 <devfile_read_direct+0x70>
+
+000000000080a1e0 <devfile_read>:
+    if (!fd || !buf)
+  80a1e0:	48 85 ff             	test   %rdi,%rdi
+  80a1e3:	0f 84 21 02 00 00    	je     80a40a <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80a1e9:	55                   	push   %rbp
+  80a1ea:	48 89 e5             	mov    %rsp,%rbp
+  80a1ed:	41 57                	push   %r15
+  80a1ef:	41 56                	push   %r14
+  80a1f1:	41 55                	push   %r13
+  80a1f3:	41 54                	push   %r12
+  80a1f5:	53                   	push   %rbx
+  80a1f6:	48 83 ec 28          	sub    $0x28,%rsp
+  80a1fa:	48 89 fb             	mov    %rdi,%rbx
+  80a1fd:	49 89 f4             	mov    %rsi,%r12
+  80a200:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  80a203:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80a208:	48 85 f6             	test   %rsi,%rsi
+  80a20b:	74 4b                	je     80a258 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  80a20d:	48 b8 1d 95 80 00 00 	movabs $0x80951d,%rax
+  80a214:	00 00 00 
+  80a217:	ff d0                	call   *%rax
+  80a219:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  80a21c:	48 85 c0             	test   %rax,%rax
+  80a21f:	74 22                	je     80a243 <devfile_read+0x63>
+  80a221:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80a228:	77 19                	ja     80a243 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80a22a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80a22f:	48 89 df             	mov    %rbx,%rdi
+  80a232:	48 b8 1a 83 80 00 00 	movabs $0x80831a,%rax
+  80a239:	00 00 00 
+  80a23c:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  80a23e:	83 f8 02             	cmp    $0x2,%eax
+  80a241:	7e 40                	jle    80a283 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  80a243:	48 89 df             	mov    %rbx,%rdi
+  80a246:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  80a24d:	00 00 00 
+  80a250:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80a252:	85 c0                	test   %eax,%eax
+  80a254:	79 11                	jns    80a267 <devfile_read+0x87>
+  80a256:	48 98                	cltq
+}
+  80a258:	48 83 c4 28          	add    $0x28,%rsp
+  80a25c:	5b                   	pop    %rbx
+  80a25d:	41 5c                	pop    %r12
+  80a25f:	41 5d                	pop    %r13
+  80a261:	41 5e                	pop    %r14
+  80a263:	41 5f                	pop    %r15
+  80a265:	5d                   	pop    %rbp
+  80a266:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80a267:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80a26c:	4c 89 ea             	mov    %r13,%rdx
+  80a26f:	4c 89 e6             	mov    %r12,%rsi
+  80a272:	48 89 df             	mov    %rbx,%rdi
+  80a275:	48 b8 68 9f 80 00 00 	movabs $0x809f68,%rax
+  80a27c:	00 00 00 
+  80a27f:	ff d0                	call   *%rax
+  80a281:	eb d5                	jmp    80a258 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  80a283:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80a287:	48 89 df             	mov    %rbx,%rdi
+  80a28a:	48 b8 6a 9c 80 00 00 	movabs $0x809c6a,%rax
+  80a291:	00 00 00 
+  80a294:	ff d0                	call   *%rax
+  80a296:	85 c0                	test   %eax,%eax
+  80a298:	0f 88 33 01 00 00    	js     80a3d1 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  80a29e:	48 ba 00 23 87 00 00 	movabs $0x872300,%rdx
+  80a2a5:	00 00 00 
+  80a2a8:	4c 89 f0             	mov    %r14,%rax
+  80a2ab:	48 29 d0             	sub    %rdx,%rax
+  80a2ae:	48 c1 f8 03          	sar    $0x3,%rax
+  80a2b2:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80a2b9:	aa aa aa 
+  80a2bc:	48 0f af c2          	imul   %rdx,%rax
+  80a2c0:	48 c1 e0 0e          	shl    $0xe,%rax
+  80a2c4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80a2c8:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80a2cb:	41 39 06             	cmp    %eax,(%r14)
+  80a2ce:	75 0d                	jne    80a2dd <devfile_read+0xfd>
+  80a2d0:	8b 43 10             	mov    0x10(%rbx),%eax
+  80a2d3:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80a2d7:	0f 84 fb 00 00 00    	je     80a3d8 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  80a2dd:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80a2e2:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80a2e6:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80a2e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80a2ed:	48 89 c7             	mov    %rax,%rdi
+  80a2f0:	48 b8 38 b4 80 00 00 	movabs $0x80b438,%rax
+  80a2f7:	00 00 00 
+  80a2fa:	ff d0                	call   *%rax
+  80a2fc:	84 c0                	test   %al,%al
+  80a2fe:	75 27                	jne    80a327 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80a300:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80a305:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80a30a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80a30e:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a313:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80a31a:	00 00 00 
+  80a31d:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  80a31f:	85 c0                	test   %eax,%eax
+  80a321:	0f 88 dc 00 00 00    	js     80a403 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80a327:	44 89 f8             	mov    %r15d,%eax
+  80a32a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  80a32f:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  80a331:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80a338:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80a339:	8b 43 10             	mov    0x10(%rbx),%eax
+  80a33c:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  80a340:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80a343:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80a348:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80a34c:	48 89 df             	mov    %rbx,%rdi
+  80a34f:	48 b8 68 9f 80 00 00 	movabs $0x809f68,%rax
+  80a356:	00 00 00 
+  80a359:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80a35b:	48 85 c0             	test   %rax,%rax
+  80a35e:	0f 88 f4 fe ff ff    	js     80a258 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80a364:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80a367:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80a36a:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80a36d:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80a371:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80a375:	48 63 d1             	movslq %ecx,%rdx
+  80a378:	48 01 d0             	add    %rdx,%rax
+  80a37b:	4d 63 ff             	movslq %r15d,%r15
+  80a37e:	4c 29 f8             	sub    %r15,%rax
+  80a381:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a386:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80a38a:	48 85 c0             	test   %rax,%rax
+  80a38d:	0f 8e c5 fe ff ff    	jle    80a258 <devfile_read+0x78>
+    n = MIN(n, res);
+  80a393:	4c 39 e8             	cmp    %r13,%rax
+  80a396:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80a39a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80a39d:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80a3a1:	48 63 f6             	movslq %esi,%rsi
+  80a3a4:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80a3a9:	48 01 c6             	add    %rax,%rsi
+  80a3ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80a3b0:	48 01 c6             	add    %rax,%rsi
+  80a3b3:	4c 89 ea             	mov    %r13,%rdx
+  80a3b6:	4c 89 e7             	mov    %r12,%rdi
+  80a3b9:	48 b8 57 80 80 00 00 	movabs $0x808057,%rax
+  80a3c0:	00 00 00 
+  80a3c3:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80a3c5:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80a3c9:	4c 89 e8             	mov    %r13,%rax
+  80a3cc:	e9 87 fe ff ff       	jmp    80a258 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80a3d1:	48 98                	cltq
+  80a3d3:	e9 80 fe ff ff       	jmp    80a258 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80a3d8:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80a3dc:	41 39 d7             	cmp    %edx,%r15d
+  80a3df:	0f 8c f8 fe ff ff    	jl     80a2dd <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80a3e5:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80a3e9:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  80a3ec:	41 39 cf             	cmp    %ecx,%r15d
+  80a3ef:	0f 8d e8 fe ff ff    	jge    80a2dd <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80a3f5:	4d 63 ff             	movslq %r15d,%r15
+  80a3f8:	4c 29 f8             	sub    %r15,%rax
+  80a3fb:	48 63 d2             	movslq %edx,%rdx
+  80a3fe:	48 01 d0             	add    %rdx,%rax
+  80a401:	eb 87                	jmp    80a38a <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80a403:	48 98                	cltq
+  80a405:	e9 4e fe ff ff       	jmp    80a258 <devfile_read+0x78>
+        return E_INVAL;
+  80a40a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80a40f:	c3                   	ret
+
+000000000080a410 <fs_channel>:
+fs_channel(bool enable) {
+  80a410:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  80a412:	a2 04 26 87 00 00 00 	movabs %al,0x872604
+  80a419:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  80a41b:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a420:	40 84 ff             	test   %dil,%dil
+  80a423:	74 47                	je     80a46c <fs_channel+0x5c>
+  80a425:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  80a42c:	00 00 00 
+  80a42f:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80a435:	48 b8 00 26 87 00 00 	movabs $0x872600,%rax
+  80a43c:	00 00 00 
+  80a43f:	3b 08                	cmp    (%rax),%ecx
+  80a441:	74 29                	je     80a46c <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80a443:	55                   	push   %rbp
+  80a444:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80a447:	48 b8 90 93 80 00 00 	movabs $0x809390,%rax
+  80a44e:	00 00 00 
+  80a451:	ff d0                	call   *%rax
+  80a453:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80a455:	85 c0                	test   %eax,%eax
+  80a457:	78 04                	js     80a45d <fs_channel+0x4d>
+}
+  80a459:	89 d0                	mov    %edx,%eax
+  80a45b:	5d                   	pop    %rbp
+  80a45c:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  80a45d:	48 b8 04 26 87 00 00 	movabs $0x872604,%rax
+  80a464:	00 00 00 
+  80a467:	c6 00 00             	movb   $0x0,(%rax)
+  80a46a:	eb ed                	jmp    80a459 <fs_channel+0x49>
+}
+  80a46c:	89 d0                	mov    %edx,%eax
+  80a46e:	c3                   	ret
+
+000000000080a46f <open>:
+open(const char *path, int mode) {
+  80a46f:	55                   	push   %rbp
+  80a470:	48 89 e5             	mov    %rsp,%rbp
+  80a473:	41 55                	push   %r13
+  80a475:	41 54                	push   %r12
+  80a477:	53                   	push   %rbx
+  80a478:	48 83 ec 18          	sub    $0x18,%rsp
+  80a47c:	49 89 fc             	mov    %rdi,%r12
+  80a47f:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80a482:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  80a489:	00 00 00 
+  80a48c:	ff d0                	call   *%rax
+  80a48e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80a494:	0f 87 8f 00 00 00    	ja     80a529 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80a49a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80a49e:	48 b8 4a 8c 80 00 00 	movabs $0x808c4a,%rax
+  80a4a5:	00 00 00 
+  80a4a8:	ff d0                	call   *%rax
+  80a4aa:	89 c3                	mov    %eax,%ebx
+  80a4ac:	85 c0                	test   %eax,%eax
+  80a4ae:	78 55                	js     80a505 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80a4b0:	4c 89 e6             	mov    %r12,%rsi
+  80a4b3:	48 bb 00 00 88 00 00 	movabs $0x880000,%rbx
+  80a4ba:	00 00 00 
+  80a4bd:	48 89 df             	mov    %rbx,%rdi
+  80a4c0:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80a4c7:	00 00 00 
+  80a4ca:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80a4cc:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80a4d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a4d8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80a4dc:	bf 01 00 00 00       	mov    $0x1,%edi
+  80a4e1:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a4e8:	00 00 00 
+  80a4eb:	ff d0                	call   *%rax
+  80a4ed:	89 c3                	mov    %eax,%ebx
+  80a4ef:	85 c0                	test   %eax,%eax
+  80a4f1:	78 1f                	js     80a512 <open+0xa3>
+    return fd2num(fd);
+  80a4f3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80a4f7:	48 b8 1c 8c 80 00 00 	movabs $0x808c1c,%rax
+  80a4fe:	00 00 00 
+  80a501:	ff d0                	call   *%rax
+  80a503:	89 c3                	mov    %eax,%ebx
+}
+  80a505:	89 d8                	mov    %ebx,%eax
+  80a507:	48 83 c4 18          	add    $0x18,%rsp
+  80a50b:	5b                   	pop    %rbx
+  80a50c:	41 5c                	pop    %r12
+  80a50e:	41 5d                	pop    %r13
+  80a510:	5d                   	pop    %rbp
+  80a511:	c3                   	ret
+        fd_close(fd, 0);
+  80a512:	be 00 00 00 00       	mov    $0x0,%esi
+  80a517:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80a51b:	48 b8 65 8d 80 00 00 	movabs $0x808d65,%rax
+  80a522:	00 00 00 
+  80a525:	ff d0                	call   *%rax
+        return res;
+  80a527:	eb dc                	jmp    80a505 <open+0x96>
+        return -E_BAD_PATH;
+  80a529:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80a52e:	eb d5                	jmp    80a505 <open+0x96>
+
+000000000080a530 <file_flush_buffers>:
+file_flush_buffers(void) {
+  80a530:	55                   	push   %rbp
+  80a531:	48 89 e5             	mov    %rsp,%rbp
+  80a534:	41 56                	push   %r14
+  80a536:	41 55                	push   %r13
+  80a538:	41 54                	push   %r12
+  80a53a:	53                   	push   %rbx
+  80a53b:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  80a53f:	49 bc 08 23 87 00 00 	movabs $0x872308,%r12
+  80a546:	00 00 00 
+  80a549:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80a54e:	49 bd aa 8c 80 00 00 	movabs $0x808caa,%r13
+  80a555:	00 00 00 
+  80a558:	49 be 6a 9c 80 00 00 	movabs $0x809c6a,%r14
+  80a55f:	00 00 00 
+  80a562:	eb 0c                	jmp    80a570 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80a564:	83 c3 01             	add    $0x1,%ebx
+  80a567:	49 83 c4 18          	add    $0x18,%r12
+  80a56b:	83 fb 20             	cmp    $0x20,%ebx
+  80a56e:	74 1d                	je     80a58d <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80a570:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80a575:	74 ed                	je     80a564 <file_flush_buffers+0x34>
+  80a577:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80a57b:	89 df                	mov    %ebx,%edi
+  80a57d:	41 ff d5             	call   *%r13
+  80a580:	85 c0                	test   %eax,%eax
+  80a582:	78 e0                	js     80a564 <file_flush_buffers+0x34>
+  80a584:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80a588:	41 ff d6             	call   *%r14
+  80a58b:	eb d7                	jmp    80a564 <file_flush_buffers+0x34>
+}
+  80a58d:	48 83 c4 10          	add    $0x10,%rsp
+  80a591:	5b                   	pop    %rbx
+  80a592:	41 5c                	pop    %r12
+  80a594:	41 5d                	pop    %r13
+  80a596:	41 5e                	pop    %r14
+  80a598:	5d                   	pop    %rbp
+  80a599:	c3                   	ret
+
+000000000080a59a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80a59a:	55                   	push   %rbp
+  80a59b:	48 89 e5             	mov    %rsp,%rbp
+  80a59e:	41 54                	push   %r12
+  80a5a0:	53                   	push   %rbx
+  80a5a1:	49 89 fc             	mov    %rdi,%r12
+  80a5a4:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80a5a6:	48 b8 30 a5 80 00 00 	movabs $0x80a530,%rax
+  80a5ad:	00 00 00 
+  80a5b0:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80a5b2:	48 b8 00 00 88 00 00 	movabs $0x880000,%rax
+  80a5b9:	00 00 00 
+  80a5bc:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80a5c1:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80a5c3:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80a5c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a5cb:	be 00 00 00 00       	mov    $0x0,%esi
+  80a5d0:	bf 02 00 00 00       	mov    $0x2,%edi
+  80a5d5:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a5dc:	00 00 00 
+  80a5df:	ff d0                	call   *%rax
+}
+  80a5e1:	5b                   	pop    %rbx
+  80a5e2:	41 5c                	pop    %r12
+  80a5e4:	5d                   	pop    %rbp
+  80a5e5:	c3                   	ret
+
+000000000080a5e6 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80a5e6:	55                   	push   %rbp
+  80a5e7:	48 89 e5             	mov    %rsp,%rbp
+  80a5ea:	41 54                	push   %r12
+  80a5ec:	53                   	push   %rbx
+  80a5ed:	49 89 fc             	mov    %rdi,%r12
+  80a5f0:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80a5f3:	48 b8 30 a5 80 00 00 	movabs $0x80a530,%rax
+  80a5fa:	00 00 00 
+  80a5fd:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80a5ff:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80a604:	a3 00 00 88 00 00 00 	movabs %eax,0x880000
+  80a60b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80a60d:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a612:	be 00 00 00 00       	mov    $0x0,%esi
+  80a617:	bf 05 00 00 00       	mov    $0x5,%edi
+  80a61c:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a623:	00 00 00 
+  80a626:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80a628:	85 c0                	test   %eax,%eax
+  80a62a:	78 3d                	js     80a669 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80a62c:	49 bc 00 00 88 00 00 	movabs $0x880000,%r12
+  80a633:	00 00 00 
+  80a636:	4c 89 e6             	mov    %r12,%rsi
+  80a639:	48 89 df             	mov    %rbx,%rdi
+  80a63c:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80a643:	00 00 00 
+  80a646:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80a648:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80a64f:	00 
+  80a650:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80a656:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80a65d:	00 
+  80a65e:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80a664:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a669:	5b                   	pop    %rbx
+  80a66a:	41 5c                	pop    %r12
+  80a66c:	5d                   	pop    %rbp
+  80a66d:	c3                   	ret
+
+000000000080a66e <remove>:
+remove(const char *path) {
+  80a66e:	55                   	push   %rbp
+  80a66f:	48 89 e5             	mov    %rsp,%rbp
+  80a672:	53                   	push   %rbx
+  80a673:	48 83 ec 08          	sub    $0x8,%rsp
+  80a677:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80a67a:	48 b8 b8 7d 80 00 00 	movabs $0x807db8,%rax
+  80a681:	00 00 00 
+  80a684:	ff d0                	call   *%rax
+  80a686:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80a68c:	77 3a                	ja     80a6c8 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80a68e:	48 89 de             	mov    %rbx,%rsi
+  80a691:	48 bf 00 00 88 00 00 	movabs $0x880000,%rdi
+  80a698:	00 00 00 
+  80a69b:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80a6a2:	00 00 00 
+  80a6a5:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80a6a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a6ac:	be 00 00 00 00       	mov    $0x0,%esi
+  80a6b1:	bf 07 00 00 00       	mov    $0x7,%edi
+  80a6b6:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a6bd:	00 00 00 
+  80a6c0:	ff d0                	call   *%rax
+}
+  80a6c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a6c6:	c9                   	leave
+  80a6c7:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80a6c8:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80a6cd:	eb f3                	jmp    80a6c2 <remove+0x54>
+
+000000000080a6cf <sync>:
+sync(void) {
+  80a6cf:	55                   	push   %rbp
+  80a6d0:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80a6d3:	48 b8 30 a5 80 00 00 	movabs $0x80a530,%rax
+  80a6da:	00 00 00 
+  80a6dd:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80a6df:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a6e4:	be 00 00 00 00       	mov    $0x0,%esi
+  80a6e9:	bf 08 00 00 00       	mov    $0x8,%edi
+  80a6ee:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a6f5:	00 00 00 
+  80a6f8:	ff d0                	call   *%rax
+}
+  80a6fa:	5d                   	pop    %rbp
+  80a6fb:	c3                   	ret
+
+000000000080a6fc <fsync>:
+fsync(int fdnum) {
+  80a6fc:	55                   	push   %rbp
+  80a6fd:	48 89 e5             	mov    %rsp,%rbp
+  80a700:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80a704:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80a708:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80a70f:	00 00 00 
+  80a712:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80a714:	85 c0                	test   %eax,%eax
+  80a716:	78 4b                	js     80a763 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80a718:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80a71c:	48 b8 c0 30 81 00 00 	movabs $0x8130c0,%rax
+  80a723:	00 00 00 
+  80a726:	8b 00                	mov    (%rax),%eax
+  80a728:	39 02                	cmp    %eax,(%rdx)
+  80a72a:	75 39                	jne    80a765 <fsync+0x69>
+    file_flush_buffers();
+  80a72c:	48 b8 30 a5 80 00 00 	movabs $0x80a530,%rax
+  80a733:	00 00 00 
+  80a736:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80a738:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80a73c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80a73f:	a3 00 00 88 00 00 00 	movabs %eax,0x880000
+  80a746:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80a748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a74d:	be 00 00 00 00       	mov    $0x0,%esi
+  80a752:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80a757:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a75e:	00 00 00 
+  80a761:	ff d0                	call   *%rax
+}
+  80a763:	c9                   	leave
+  80a764:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80a765:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80a76a:	eb f7                	jmp    80a763 <fsync+0x67>
+
+000000000080a76c <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80a76c:	55                   	push   %rbp
+  80a76d:	48 89 e5             	mov    %rsp,%rbp
+  80a770:	53                   	push   %rbx
+  80a771:	48 83 ec 08          	sub    $0x8,%rsp
+  80a775:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80a778:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a77d:	be 00 00 00 00       	mov    $0x0,%esi
+  80a782:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80a787:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a78e:	00 00 00 
+  80a791:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80a793:	85 c0                	test   %eax,%eax
+  80a795:	78 2d                	js     80a7c4 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80a797:	48 b8 00 00 88 00 00 	movabs $0x880000,%rax
+  80a79e:	00 00 00 
+  80a7a1:	48 8b 10             	mov    (%rax),%rdx
+  80a7a4:	48 89 13             	mov    %rdx,(%rbx)
+  80a7a7:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80a7ab:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80a7af:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80a7b3:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80a7b7:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80a7bb:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80a7bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a7c4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a7c8:	c9                   	leave
+  80a7c9:	c3                   	ret
+
+000000000080a7ca <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80a7ca:	55                   	push   %rbp
+  80a7cb:	48 89 e5             	mov    %rsp,%rbp
+  80a7ce:	53                   	push   %rbx
+  80a7cf:	48 83 ec 08          	sub    $0x8,%rsp
+  80a7d3:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80a7d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  80a7db:	be 00 00 00 00       	mov    $0x0,%esi
+  80a7e0:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80a7e5:	48 b8 01 9a 80 00 00 	movabs $0x809a01,%rax
+  80a7ec:	00 00 00 
+  80a7ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80a7f1:	85 c0                	test   %eax,%eax
+  80a7f3:	78 3d                	js     80a832 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80a7f5:	48 b8 00 00 88 00 00 	movabs $0x880000,%rax
+  80a7fc:	00 00 00 
+  80a7ff:	48 8b 10             	mov    (%rax),%rdx
+  80a802:	48 89 13             	mov    %rdx,(%rbx)
+  80a805:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80a809:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80a80d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80a811:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80a815:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80a819:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80a81d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80a821:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80a825:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80a829:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80a82d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80a832:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80a836:	c9                   	leave
+  80a837:	c3                   	ret
+
+000000000080a838 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80a838:	55                   	push   %rbp
+  80a839:	48 89 e5             	mov    %rsp,%rbp
+  80a83c:	41 57                	push   %r15
+  80a83e:	41 56                	push   %r14
+  80a840:	41 55                	push   %r13
+  80a842:	41 54                	push   %r12
+  80a844:	53                   	push   %rbx
+  80a845:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80a849:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80a850:	00 
+  80a851:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80a858:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80a85e:	0f 85 43 01 00 00    	jne    80a9a7 <munmap+0x16f>
+  80a864:	49 89 ff             	mov    %rdi,%r15
+  80a867:	4c 39 f7             	cmp    %r14,%rdi
+  80a86a:	0f 87 37 01 00 00    	ja     80a9a7 <munmap+0x16f>
+  80a870:	48 bb 00 20 87 00 00 	movabs $0x872000,%rbx
+  80a877:	00 00 00 
+  80a87a:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80a880:	eb 2c                	jmp    80a8ae <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80a882:	4c 39 f8             	cmp    %r15,%rax
+  80a885:	0f 83 85 00 00 00    	jae    80a910 <munmap+0xd8>
+            m->mm_end = start;
+  80a88b:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80a890:	48 83 c3 18          	add    $0x18,%rbx
+  80a894:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80a89b:	48 b8 00 23 87 00 00 	movabs $0x872300,%rax
+  80a8a2:	00 00 00 
+  80a8a5:	48 39 c3             	cmp    %rax,%rbx
+  80a8a8:	0f 84 d0 00 00 00    	je     80a97e <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80a8ae:	49 89 dc             	mov    %rbx,%r12
+  80a8b1:	48 8b 03             	mov    (%rbx),%rax
+  80a8b4:	4c 39 f0             	cmp    %r14,%rax
+  80a8b7:	73 d7                	jae    80a890 <munmap+0x58>
+  80a8b9:	48 85 c0             	test   %rax,%rax
+  80a8bc:	74 d2                	je     80a890 <munmap+0x58>
+  80a8be:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80a8c2:	49 39 d7             	cmp    %rdx,%r15
+  80a8c5:	73 c9                	jae    80a890 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80a8c7:	49 39 d6             	cmp    %rdx,%r14
+  80a8ca:	73 b6                	jae    80a882 <munmap+0x4a>
+  80a8cc:	49 39 c7             	cmp    %rax,%r15
+  80a8cf:	76 b1                	jbe    80a882 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80a8d1:	4c 89 ef             	mov    %r13,%rdi
+  80a8d4:	48 b8 6f 99 80 00 00 	movabs $0x80996f,%rax
+  80a8db:	00 00 00 
+  80a8de:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80a8e0:	48 85 c0             	test   %rax,%rax
+  80a8e3:	0f 84 c5 00 00 00    	je     80a9ae <munmap+0x176>
+            *tail = *m;
+  80a8e9:	48 8b 13             	mov    (%rbx),%rdx
+  80a8ec:	48 89 10             	mov    %rdx,(%rax)
+  80a8ef:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80a8f3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80a8f7:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80a8fb:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80a8ff:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80a902:	44 89 f2             	mov    %r14d,%edx
+  80a905:	2b 13                	sub    (%rbx),%edx
+  80a907:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80a90a:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80a90e:	eb 80                	jmp    80a890 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80a910:	49 39 d6             	cmp    %rdx,%r14
+  80a913:	73 18                	jae    80a92d <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80a915:	44 89 f2             	mov    %r14d,%edx
+  80a918:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80a91d:	29 c2                	sub    %eax,%edx
+  80a91f:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80a924:	4d 89 34 24          	mov    %r14,(%r12)
+  80a928:	e9 63 ff ff ff       	jmp    80a890 <munmap+0x58>
+    m->mm_start = 0;
+  80a92d:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80a934:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80a935:	4c 89 e6             	mov    %r12,%rsi
+  80a938:	48 b8 00 20 87 00 00 	movabs $0x872000,%rax
+  80a93f:	00 00 00 
+  80a942:	48 29 c6             	sub    %rax,%rsi
+  80a945:	48 c1 fe 03          	sar    $0x3,%rsi
+  80a949:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80a950:	aa aa aa 
+  80a953:	48 0f af f0          	imul   %rax,%rsi
+  80a957:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80a95b:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80a960:	48 01 c6             	add    %rax,%rsi
+  80a963:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80a968:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a96d:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  80a974:	00 00 00 
+  80a977:	ff d0                	call   *%rax
+}
+  80a979:	e9 12 ff ff ff       	jmp    80a890 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80a97e:	4c 89 f2             	mov    %r14,%rdx
+  80a981:	4c 29 fa             	sub    %r15,%rdx
+  80a984:	4c 89 fe             	mov    %r15,%rsi
+  80a987:	bf 00 00 00 00       	mov    $0x0,%edi
+  80a98c:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  80a993:	00 00 00 
+  80a996:	ff d0                	call   *%rax
+}
+  80a998:	48 83 c4 08          	add    $0x8,%rsp
+  80a99c:	5b                   	pop    %rbx
+  80a99d:	41 5c                	pop    %r12
+  80a99f:	41 5d                	pop    %r13
+  80a9a1:	41 5e                	pop    %r14
+  80a9a3:	41 5f                	pop    %r15
+  80a9a5:	5d                   	pop    %rbp
+  80a9a6:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80a9a7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80a9ac:	eb ea                	jmp    80a998 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80a9ae:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80a9b3:	eb e3                	jmp    80a998 <munmap+0x160>
+
+000000000080a9b5 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80a9b5:	55                   	push   %rbp
+  80a9b6:	48 89 e5             	mov    %rsp,%rbp
+  80a9b9:	41 57                	push   %r15
+  80a9bb:	41 56                	push   %r14
+  80a9bd:	41 55                	push   %r13
+  80a9bf:	41 54                	push   %r12
+  80a9c1:	53                   	push   %rbx
+  80a9c2:	48 83 ec 28          	sub    $0x28,%rsp
+  80a9c6:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80a9ca:	49 89 f5             	mov    %rsi,%r13
+  80a9cd:	41 89 d6             	mov    %edx,%r14d
+  80a9d0:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80a9d3:	41 89 cc             	mov    %ecx,%r12d
+  80a9d6:	44 89 c7             	mov    %r8d,%edi
+  80a9d9:	44 89 cb             	mov    %r9d,%ebx
+  80a9dc:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80a9e0:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80a9e4:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80a9eb:	00 00 00 
+  80a9ee:	ff d0                	call   *%rax
+  80a9f0:	41 89 c7             	mov    %eax,%r15d
+  80a9f3:	85 c0                	test   %eax,%eax
+  80a9f5:	0f 88 ae 01 00 00    	js     80aba9 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80a9fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80a9ff:	48 ba c0 30 81 00 00 	movabs $0x8130c0,%rdx
+  80aa06:	00 00 00 
+  80aa09:	8b 32                	mov    (%rdx),%esi
+  80aa0b:	39 30                	cmp    %esi,(%rax)
+  80aa0d:	0f 85 7a 02 00 00    	jne    80ac8d <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80aa13:	8b 40 08             	mov    0x8(%rax),%eax
+  80aa16:	83 e0 03             	and    $0x3,%eax
+  80aa19:	83 f8 01             	cmp    $0x1,%eax
+  80aa1c:	0f 84 76 02 00 00    	je     80ac98 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80aa22:	4d 85 ed             	test   %r13,%r13
+  80aa25:	0f 84 78 02 00 00    	je     80aca3 <mmap+0x2ee>
+  80aa2b:	85 db                	test   %ebx,%ebx
+  80aa2d:	0f 88 70 02 00 00    	js     80aca3 <mmap+0x2ee>
+  80aa33:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80aa39:	41 89 df             	mov    %ebx,%r15d
+  80aa3c:	0f 85 6c 02 00 00    	jne    80acae <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80aa42:	44 89 f0             	mov    %r14d,%eax
+  80aa45:	83 e0 fd             	and    $0xfffffffd,%eax
+  80aa48:	83 f8 04             	cmp    $0x4,%eax
+  80aa4b:	0f 85 68 02 00 00    	jne    80acb9 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80aa51:	44 89 e1             	mov    %r12d,%ecx
+  80aa54:	83 e1 01             	and    $0x1,%ecx
+  80aa57:	0f 95 c2             	setne  %dl
+  80aa5a:	44 89 e0             	mov    %r12d,%eax
+  80aa5d:	d1 e8                	shr    %eax
+  80aa5f:	83 f0 01             	xor    $0x1,%eax
+  80aa62:	83 e0 01             	and    $0x1,%eax
+  80aa65:	38 c2                	cmp    %al,%dl
+  80aa67:	0f 85 57 02 00 00    	jne    80acc4 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80aa6d:	85 c9                	test   %ecx,%ecx
+  80aa6f:	74 0a                	je     80aa7b <mmap+0xc6>
+  80aa71:	41 f6 c6 02          	test   $0x2,%r14b
+  80aa75:	0f 85 54 02 00 00    	jne    80accf <mmap+0x31a>
+    file_flush_buffers();
+  80aa7b:	48 b8 30 a5 80 00 00 	movabs $0x80a530,%rax
+  80aa82:	00 00 00 
+  80aa85:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80aa87:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80aa8e:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80aa95:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80aa99:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80aa9c:	41 f6 c4 04          	test   $0x4,%r12b
+  80aaa0:	0f 84 15 01 00 00    	je     80abbb <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80aaa6:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80aaa9:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80aaaf:	0f 85 25 02 00 00    	jne    80acda <mmap+0x325>
+  80aab5:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80aab9:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80aac0:	00 00 00 
+  80aac3:	48 39 c2             	cmp    %rax,%rdx
+  80aac6:	0f 82 19 02 00 00    	jb     80ace5 <mmap+0x330>
+  80aacc:	48 39 c7             	cmp    %rax,%rdi
+  80aacf:	0f 87 10 02 00 00    	ja     80ace5 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80aad5:	4c 89 ee             	mov    %r13,%rsi
+  80aad8:	48 b8 38 a8 80 00 00 	movabs $0x80a838,%rax
+  80aadf:	00 00 00 
+  80aae2:	ff d0                	call   *%rax
+  80aae4:	85 c0                	test   %eax,%eax
+  80aae6:	0f 88 04 02 00 00    	js     80acf0 <mmap+0x33b>
+    if (!handler) {
+  80aaec:	48 b8 00 00 87 00 00 	movabs $0x870000,%rax
+  80aaf3:	00 00 00 
+  80aaf6:	80 38 00             	cmpb   $0x0,(%rax)
+  80aaf9:	75 2b                	jne    80ab26 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80aafb:	48 bf d0 98 80 00 00 	movabs $0x8098d0,%rdi
+  80ab02:	00 00 00 
+  80ab05:	48 b8 12 88 80 00 00 	movabs $0x808812,%rax
+  80ab0c:	00 00 00 
+  80ab0f:	ff d0                	call   *%rax
+  80ab11:	85 c0                	test   %eax,%eax
+  80ab13:	0f 88 ea 01 00 00    	js     80ad03 <mmap+0x34e>
+        handler = 1;
+  80ab19:	48 b8 00 00 87 00 00 	movabs $0x870000,%rax
+  80ab20:	00 00 00 
+  80ab23:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80ab26:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80ab2a:	48 b8 6f 99 80 00 00 	movabs $0x80996f,%rax
+  80ab31:	00 00 00 
+  80ab34:	ff d0                	call   *%rax
+  80ab36:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80ab39:	48 85 c0             	test   %rax,%rax
+  80ab3c:	0f 84 c9 01 00 00    	je     80ad0b <mmap+0x356>
+    m->mm_start = va;
+  80ab42:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80ab45:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80ab49:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80ab4d:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80ab50:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80ab54:	44 89 e0             	mov    %r12d,%eax
+  80ab57:	c1 e0 06             	shl    $0x6,%eax
+  80ab5a:	25 80 00 00 00       	and    $0x80,%eax
+  80ab5f:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80ab62:	09 f0                	or     %esi,%eax
+  80ab64:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80ab68:	41 f6 c4 08          	test   $0x8,%r12b
+  80ab6c:	74 31                	je     80ab9f <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80ab6e:	48 39 d3             	cmp    %rdx,%rbx
+  80ab71:	73 2c                	jae    80ab9f <mmap+0x1ea>
+  80ab73:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80ab78:	48 89 de             	mov    %rbx,%rsi
+  80ab7b:	4c 89 f7             	mov    %r14,%rdi
+  80ab7e:	48 b8 bf 97 80 00 00 	movabs $0x8097bf,%rax
+  80ab85:	00 00 00 
+  80ab88:	ff d0                	call   *%rax
+  80ab8a:	49 89 c4             	mov    %rax,%r12
+  80ab8d:	48 85 c0             	test   %rax,%rax
+  80ab90:	0f 8e d7 00 00 00    	jle    80ac6d <mmap+0x2b8>
+            va += n;
+  80ab96:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80ab99:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80ab9d:	72 d4                	jb     80ab73 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80ab9f:	49 8b 06             	mov    (%r14),%rax
+  80aba2:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80aba6:	48 89 06             	mov    %rax,(%rsi)
+}
+  80aba9:	44 89 f8             	mov    %r15d,%eax
+  80abac:	48 83 c4 28          	add    $0x28,%rsp
+  80abb0:	5b                   	pop    %rbx
+  80abb1:	41 5c                	pop    %r12
+  80abb3:	41 5d                	pop    %r13
+  80abb5:	41 5e                	pop    %r14
+  80abb7:	41 5f                	pop    %r15
+  80abb9:	5d                   	pop    %rbp
+  80abba:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80abbb:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80abc2:	00 00 00 
+  80abc5:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80abc8:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80abcf:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80abd2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80abd7:	48 be 00 20 87 00 00 	movabs $0x872000,%rsi
+  80abde:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80abe1:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80abe8:	00 00 00 
+  80abeb:	48 39 d7             	cmp    %rdx,%rdi
+  80abee:	73 1c                	jae    80ac0c <mmap+0x257>
+        return -E_NO_MEM;
+  80abf0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80abf6:	eb b1                	jmp    80aba9 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80abf8:	48 83 c0 01          	add    $0x1,%rax
+  80abfc:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80ac00:	77 3f                	ja     80ac41 <mmap+0x28c>
+  80ac02:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80ac07:	48 39 d7             	cmp    %rdx,%rdi
+  80ac0a:	72 2a                	jb     80ac36 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80ac0c:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80ac10:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80ac14:	48 39 d1             	cmp    %rdx,%rcx
+  80ac17:	73 df                	jae    80abf8 <mmap+0x243>
+  80ac19:	48 85 c9             	test   %rcx,%rcx
+  80ac1c:	74 da                	je     80abf8 <mmap+0x243>
+  80ac1e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80ac22:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80ac27:	48 39 d3             	cmp    %rdx,%rbx
+  80ac2a:	73 cc                	jae    80abf8 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80ac2c:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80ac2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ac34:	eb cc                	jmp    80ac02 <mmap+0x24d>
+        return -E_NO_MEM;
+  80ac36:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80ac3c:	e9 68 ff ff ff       	jmp    80aba9 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80ac41:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80ac46:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80ac4d:	00 00 00 
+  80ac50:	48 39 c2             	cmp    %rax,%rdx
+  80ac53:	0f 82 9f 00 00 00    	jb     80acf8 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80ac59:	48 85 db             	test   %rbx,%rbx
+  80ac5c:	0f 85 8a fe ff ff    	jne    80aaec <mmap+0x137>
+        return -E_NO_MEM;
+  80ac62:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80ac68:	e9 3c ff ff ff       	jmp    80aba9 <mmap+0x1f4>
+        if (n < 0) {
+  80ac6d:	0f 89 2c ff ff ff    	jns    80ab9f <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80ac73:	49 8b 3e             	mov    (%r14),%rdi
+  80ac76:	4c 89 ee             	mov    %r13,%rsi
+  80ac79:	48 b8 38 a8 80 00 00 	movabs $0x80a838,%rax
+  80ac80:	00 00 00 
+  80ac83:	ff d0                	call   *%rax
+            return n;
+  80ac85:	45 89 e7             	mov    %r12d,%r15d
+  80ac88:	e9 1c ff ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80ac8d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80ac93:	e9 11 ff ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80ac98:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80ac9e:	e9 06 ff ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80aca3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80aca9:	e9 fb fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+  80acae:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80acb4:	e9 f0 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80acb9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80acbf:	e9 e5 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80acc4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80acca:	e9 da fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80accf:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80acd5:	e9 cf fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80acda:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80ace0:	e9 c4 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+  80ace5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80aceb:	e9 b9 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80acf0:	41 89 c7             	mov    %eax,%r15d
+  80acf3:	e9 b1 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+        return -E_NO_MEM;
+  80acf8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80acfe:	e9 a6 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80ad03:	41 89 c7             	mov    %eax,%r15d
+  80ad06:	e9 9e fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80ad0b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80ad11:	e9 93 fe ff ff       	jmp    80aba9 <mmap+0x1f4>
+
+000000000080ad16 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80ad16:	55                   	push   %rbp
+  80ad17:	48 89 e5             	mov    %rsp,%rbp
+  80ad1a:	41 54                	push   %r12
+  80ad1c:	53                   	push   %rbx
+  80ad1d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80ad20:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80ad27:	00 00 00 
+  80ad2a:	ff d0                	call   *%rax
+  80ad2c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80ad2f:	48 be a0 ca 80 00 00 	movabs $0x80caa0,%rsi
+  80ad36:	00 00 00 
+  80ad39:	48 89 df             	mov    %rbx,%rdi
+  80ad3c:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80ad43:	00 00 00 
+  80ad46:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80ad48:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80ad4d:	41 2b 04 24          	sub    (%r12),%eax
+  80ad51:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80ad57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80ad5e:	00 00 00 
+    stat->st_dev = &devpipe;
+  80ad61:	48 b8 00 31 81 00 00 	movabs $0x813100,%rax
+  80ad68:	00 00 00 
+  80ad6b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  80ad72:	b8 00 00 00 00       	mov    $0x0,%eax
+  80ad77:	5b                   	pop    %rbx
+  80ad78:	41 5c                	pop    %r12
+  80ad7a:	5d                   	pop    %rbp
+  80ad7b:	c3                   	ret
+
+000000000080ad7c <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80ad7c:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80ad7f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  80ad85:	8b 17                	mov    (%rdi),%edx
+  80ad87:	85 d2                	test   %edx,%edx
+  80ad89:	75 01                	jne    80ad8c <pipe_wakeup+0x10>
+  80ad8b:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80ad8c:	55                   	push   %rbp
+  80ad8d:	48 89 e5             	mov    %rsp,%rbp
+  80ad90:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  80ad93:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80ad99:	be 00 04 00 00       	mov    $0x400,%esi
+  80ad9e:	48 b8 e1 86 80 00 00 	movabs $0x8086e1,%rax
+  80ada5:	00 00 00 
+  80ada8:	ff d0                	call   *%rax
+}
+  80adaa:	5d                   	pop    %rbp
+  80adab:	c3                   	ret
+
+000000000080adac <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80adac:	55                   	push   %rbp
+  80adad:	48 89 e5             	mov    %rsp,%rbp
+  80adb0:	41 55                	push   %r13
+  80adb2:	41 54                	push   %r12
+  80adb4:	53                   	push   %rbx
+  80adb5:	48 83 ec 08          	sub    $0x8,%rsp
+  80adb9:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80adbc:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80adc3:	00 00 00 
+  80adc6:	ff d0                	call   *%rax
+  80adc8:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80adcb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80add0:	4c 89 e6             	mov    %r12,%rsi
+  80add3:	bf 00 00 00 00       	mov    $0x0,%edi
+  80add8:	49 bc fb 83 80 00 00 	movabs $0x8083fb,%r12
+  80addf:	00 00 00 
+  80ade2:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80ade5:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80ade9:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80aded:	49 bd 7c ad 80 00 00 	movabs $0x80ad7c,%r13
+  80adf4:	00 00 00 
+  80adf7:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80adfa:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80adfe:	48 89 de             	mov    %rbx,%rsi
+  80ae01:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80ae04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80ae09:	48 89 de             	mov    %rbx,%rsi
+  80ae0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  80ae11:	41 ff d4             	call   *%r12
+  80ae14:	48 83 c4 08          	add    $0x8,%rsp
+  80ae18:	5b                   	pop    %rbx
+  80ae19:	41 5c                	pop    %r12
+  80ae1b:	41 5d                	pop    %r13
+  80ae1d:	5d                   	pop    %rbp
+  80ae1e:	c3                   	ret
+
+000000000080ae1f <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80ae1f:	55                   	push   %rbp
+  80ae20:	48 89 e5             	mov    %rsp,%rbp
+  80ae23:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80ae26:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80ae2b:	be 00 10 00 00       	mov    $0x1000,%esi
+  80ae30:	48 b8 3e 83 80 00 00 	movabs $0x80833e,%rax
+  80ae37:	00 00 00 
+  80ae3a:	ff d0                	call   *%rax
+  80ae3c:	85 c0                	test   %eax,%eax
+  80ae3e:	0f 94 c0             	sete   %al
+  80ae41:	0f b6 c0             	movzbl %al,%eax
+}
+  80ae44:	5d                   	pop    %rbp
+  80ae45:	c3                   	ret
+
+000000000080ae46 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80ae46:	55                   	push   %rbp
+  80ae47:	48 89 e5             	mov    %rsp,%rbp
+  80ae4a:	41 57                	push   %r15
+  80ae4c:	41 56                	push   %r14
+  80ae4e:	41 55                	push   %r13
+  80ae50:	41 54                	push   %r12
+  80ae52:	53                   	push   %rbx
+  80ae53:	48 83 ec 38          	sub    $0x38,%rsp
+  80ae57:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80ae5b:	49 89 f4             	mov    %rsi,%r12
+  80ae5e:	49 89 d7             	mov    %rdx,%r15
+  80ae61:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80ae65:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80ae6c:	00 00 00 
+  80ae6f:	ff d0                	call   *%rax
+  80ae71:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80ae74:	4d 85 ff             	test   %r15,%r15
+  80ae77:	0f 84 f1 00 00 00    	je     80af6e <devpipe_write+0x128>
+  80ae7d:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80ae81:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80ae85:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80ae89:	49 bd 1f ae 80 00 00 	movabs $0x80ae1f,%r13
+  80ae90:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80ae93:	49 bf 7c ad 80 00 00 	movabs $0x80ad7c,%r15
+  80ae9a:	00 00 00 
+  80ae9d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80aea1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80aea5:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80aea9:	8b 73 04             	mov    0x4(%rbx),%esi
+  80aeac:	48 63 ce             	movslq %esi,%rcx
+  80aeaf:	48 63 03             	movslq (%rbx),%rax
+  80aeb2:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80aeb8:	48 39 c1             	cmp    %rax,%rcx
+  80aebb:	72 64                	jb     80af21 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80aebd:	48 89 de             	mov    %rbx,%rsi
+  80aec0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80aec4:	41 ff d5             	call   *%r13
+  80aec7:	85 c0                	test   %eax,%eax
+  80aec9:	0f 85 b9 00 00 00    	jne    80af88 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80aecf:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80aed3:	4c 89 f7             	mov    %r14,%rdi
+  80aed6:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80aed9:	8b 43 04             	mov    0x4(%rbx),%eax
+  80aedc:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80aee3:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80aeea:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80aef0:	8b 03                	mov    (%rbx),%eax
+  80aef2:	41 39 c4             	cmp    %eax,%r12d
+  80aef5:	75 b2                	jne    80aea9 <devpipe_write+0x63>
+  80aef7:	48 89 de             	mov    %rbx,%rsi
+  80aefa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80aefe:	41 ff d5             	call   *%r13
+  80af01:	85 c0                	test   %eax,%eax
+  80af03:	75 a0                	jne    80aea5 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80af05:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80af0a:	44 89 e6             	mov    %r12d,%esi
+  80af0d:	48 89 df             	mov    %rbx,%rdi
+  80af10:	48 b8 c3 86 80 00 00 	movabs $0x8086c3,%rax
+  80af17:	00 00 00 
+  80af1a:	ff d0                	call   *%rax
+  80af1c:	e9 7c ff ff ff       	jmp    80ae9d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80af21:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80af25:	41 0f b6 38          	movzbl (%r8),%edi
+  80af29:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80af30:	80 80 80 
+  80af33:	48 89 c8             	mov    %rcx,%rax
+  80af36:	48 f7 e2             	mul    %rdx
+  80af39:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80af3d:	48 89 d0             	mov    %rdx,%rax
+  80af40:	48 c1 e0 08          	shl    $0x8,%rax
+  80af44:	48 29 d0             	sub    %rdx,%rax
+  80af47:	48 c1 e0 04          	shl    $0x4,%rax
+  80af4b:	48 29 c1             	sub    %rax,%rcx
+  80af4e:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80af53:	83 c6 01             	add    $0x1,%esi
+  80af56:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80af59:	49 83 c0 01          	add    $0x1,%r8
+  80af5d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80af61:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80af65:	49 39 c0             	cmp    %rax,%r8
+  80af68:	0f 85 2f ff ff ff    	jne    80ae9d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80af6e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80af72:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80af76:	48 b8 7c ad 80 00 00 	movabs $0x80ad7c,%rax
+  80af7d:	00 00 00 
+  80af80:	ff d0                	call   *%rax
+    return n;
+  80af82:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80af86:	eb 05                	jmp    80af8d <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  80af88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80af8d:	48 83 c4 38          	add    $0x38,%rsp
+  80af91:	5b                   	pop    %rbx
+  80af92:	41 5c                	pop    %r12
+  80af94:	41 5d                	pop    %r13
+  80af96:	41 5e                	pop    %r14
+  80af98:	41 5f                	pop    %r15
+  80af9a:	5d                   	pop    %rbp
+  80af9b:	c3                   	ret
+
+000000000080af9c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80af9c:	55                   	push   %rbp
+  80af9d:	48 89 e5             	mov    %rsp,%rbp
+  80afa0:	41 57                	push   %r15
+  80afa2:	41 56                	push   %r14
+  80afa4:	41 55                	push   %r13
+  80afa6:	41 54                	push   %r12
+  80afa8:	53                   	push   %rbx
+  80afa9:	48 83 ec 28          	sub    $0x28,%rsp
+  80afad:	49 89 fd             	mov    %rdi,%r13
+  80afb0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80afb4:	49 89 d4             	mov    %rdx,%r12
+  80afb7:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80afbb:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80afc2:	00 00 00 
+  80afc5:	ff d0                	call   *%rax
+  80afc7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80afca:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80afd0:	49 bf 1f ae 80 00 00 	movabs $0x80ae1f,%r15
+  80afd7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80afda:	4d 85 e4             	test   %r12,%r12
+  80afdd:	0f 84 d5 00 00 00    	je     80b0b8 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80afe3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80afe7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80afeb:	8b 03                	mov    (%rbx),%eax
+  80afed:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80aff0:	75 7a                	jne    80b06c <devpipe_read+0xd0>
+            if (i > 0) {
+  80aff2:	4d 85 f6             	test   %r14,%r14
+  80aff5:	75 50                	jne    80b047 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  80aff7:	48 89 de             	mov    %rbx,%rsi
+  80affa:	4c 89 ef             	mov    %r13,%rdi
+  80affd:	41 ff d7             	call   *%r15
+  80b000:	85 c0                	test   %eax,%eax
+  80b002:	0f 85 c9 00 00 00    	jne    80b0d1 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80b008:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80b00b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80b012:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80b018:	8b 43 04             	mov    0x4(%rbx),%eax
+  80b01b:	41 39 c4             	cmp    %eax,%r12d
+  80b01e:	75 cb                	jne    80afeb <devpipe_read+0x4f>
+  80b020:	48 89 de             	mov    %rbx,%rsi
+  80b023:	4c 89 ef             	mov    %r13,%rdi
+  80b026:	41 ff d7             	call   *%r15
+  80b029:	85 c0                	test   %eax,%eax
+  80b02b:	75 be                	jne    80afeb <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80b02d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80b032:	44 89 e6             	mov    %r12d,%esi
+  80b035:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80b039:	48 b8 c3 86 80 00 00 	movabs $0x8086c3,%rax
+  80b040:	00 00 00 
+  80b043:	ff d0                	call   *%rax
+  80b045:	eb a4                	jmp    80afeb <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80b047:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80b04b:	48 89 de             	mov    %rbx,%rsi
+  80b04e:	48 b8 7c ad 80 00 00 	movabs $0x80ad7c,%rax
+  80b055:	00 00 00 
+  80b058:	ff d0                	call   *%rax
+                return i;
+  80b05a:	4c 89 f0             	mov    %r14,%rax
+}
+  80b05d:	48 83 c4 28          	add    $0x28,%rsp
+  80b061:	5b                   	pop    %rbx
+  80b062:	41 5c                	pop    %r12
+  80b064:	41 5d                	pop    %r13
+  80b066:	41 5e                	pop    %r14
+  80b068:	41 5f                	pop    %r15
+  80b06a:	5d                   	pop    %rbp
+  80b06b:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80b06c:	48 63 c8             	movslq %eax,%rcx
+  80b06f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80b076:	80 80 80 
+  80b079:	48 89 c8             	mov    %rcx,%rax
+  80b07c:	48 f7 e2             	mul    %rdx
+  80b07f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80b083:	48 89 d0             	mov    %rdx,%rax
+  80b086:	48 c1 e0 08          	shl    $0x8,%rax
+  80b08a:	48 29 d0             	sub    %rdx,%rax
+  80b08d:	48 c1 e0 04          	shl    $0x4,%rax
+  80b091:	48 89 c2             	mov    %rax,%rdx
+  80b094:	48 89 c8             	mov    %rcx,%rax
+  80b097:	48 29 d0             	sub    %rdx,%rax
+  80b09a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80b09f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80b0a3:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  80b0a7:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80b0aa:	49 83 c6 01          	add    $0x1,%r14
+  80b0ae:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80b0b2:	0f 85 2b ff ff ff    	jne    80afe3 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80b0b8:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80b0bc:	48 89 de             	mov    %rbx,%rsi
+  80b0bf:	48 b8 7c ad 80 00 00 	movabs $0x80ad7c,%rax
+  80b0c6:	00 00 00 
+  80b0c9:	ff d0                	call   *%rax
+    return n;
+  80b0cb:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80b0cf:	eb 8c                	jmp    80b05d <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80b0d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b0d6:	eb 85                	jmp    80b05d <devpipe_read+0xc1>
+
+000000000080b0d8 <pipe>:
+pipe(int pfd[2]) {
+  80b0d8:	55                   	push   %rbp
+  80b0d9:	48 89 e5             	mov    %rsp,%rbp
+  80b0dc:	41 55                	push   %r13
+  80b0de:	41 54                	push   %r12
+  80b0e0:	53                   	push   %rbx
+  80b0e1:	48 83 ec 18          	sub    $0x18,%rsp
+  80b0e5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80b0e8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80b0ec:	48 b8 4a 8c 80 00 00 	movabs $0x808c4a,%rax
+  80b0f3:	00 00 00 
+  80b0f6:	ff d0                	call   *%rax
+  80b0f8:	89 c3                	mov    %eax,%ebx
+  80b0fa:	85 c0                	test   %eax,%eax
+  80b0fc:	0f 88 a0 01 00 00    	js     80b2a2 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80b102:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80b107:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b10c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80b110:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b115:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80b11c:	00 00 00 
+  80b11f:	ff d0                	call   *%rax
+  80b121:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80b123:	85 c0                	test   %eax,%eax
+  80b125:	0f 88 77 01 00 00    	js     80b2a2 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80b12b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80b12f:	48 b8 4a 8c 80 00 00 	movabs $0x808c4a,%rax
+  80b136:	00 00 00 
+  80b139:	ff d0                	call   *%rax
+  80b13b:	89 c3                	mov    %eax,%ebx
+  80b13d:	85 c0                	test   %eax,%eax
+  80b13f:	0f 88 43 01 00 00    	js     80b288 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80b145:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80b14a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b14f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80b153:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b158:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80b15f:	00 00 00 
+  80b162:	ff d0                	call   *%rax
+  80b164:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80b166:	85 c0                	test   %eax,%eax
+  80b168:	0f 88 1a 01 00 00    	js     80b288 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80b16e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80b172:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80b179:	00 00 00 
+  80b17c:	ff d0                	call   *%rax
+  80b17e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80b181:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80b186:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b18b:	48 89 c6             	mov    %rax,%rsi
+  80b18e:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b193:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80b19a:	00 00 00 
+  80b19d:	ff d0                	call   *%rax
+  80b19f:	89 c3                	mov    %eax,%ebx
+  80b1a1:	85 c0                	test   %eax,%eax
+  80b1a3:	0f 88 c5 00 00 00    	js     80b26e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  80b1a9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80b1ad:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80b1b4:	00 00 00 
+  80b1b7:	ff d0                	call   *%rax
+  80b1b9:	48 89 c1             	mov    %rax,%rcx
+  80b1bc:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80b1c2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80b1c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  80b1cd:	4c 89 ee             	mov    %r13,%rsi
+  80b1d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b1d5:	48 b8 ab 83 80 00 00 	movabs $0x8083ab,%rax
+  80b1dc:	00 00 00 
+  80b1df:	ff d0                	call   *%rax
+  80b1e1:	89 c3                	mov    %eax,%ebx
+  80b1e3:	85 c0                	test   %eax,%eax
+  80b1e5:	78 6e                	js     80b255 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80b1e7:	be 00 10 00 00       	mov    $0x1000,%esi
+  80b1ec:	4c 89 ef             	mov    %r13,%rdi
+  80b1ef:	48 b8 1a 83 80 00 00 	movabs $0x80831a,%rax
+  80b1f6:	00 00 00 
+  80b1f9:	ff d0                	call   *%rax
+  80b1fb:	83 f8 02             	cmp    $0x2,%eax
+  80b1fe:	0f 85 ab 00 00 00    	jne    80b2af <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80b204:	a1 00 31 81 00 00 00 	movabs 0x813100,%eax
+  80b20b:	00 00 
+  80b20d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80b211:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80b213:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80b217:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80b21e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80b222:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80b224:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80b228:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80b22f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80b233:	48 bb 1c 8c 80 00 00 	movabs $0x808c1c,%rbx
+  80b23a:	00 00 00 
+  80b23d:	ff d3                	call   *%rbx
+  80b23f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80b243:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80b247:	ff d3                	call   *%rbx
+  80b249:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80b24e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80b253:	eb 4d                	jmp    80b2a2 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80b255:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b25a:	4c 89 ee             	mov    %r13,%rsi
+  80b25d:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b262:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  80b269:	00 00 00 
+  80b26c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80b26e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b273:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80b277:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b27c:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  80b283:	00 00 00 
+  80b286:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80b288:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80b28d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80b291:	bf 00 00 00 00       	mov    $0x0,%edi
+  80b296:	48 b8 fb 83 80 00 00 	movabs $0x8083fb,%rax
+  80b29d:	00 00 00 
+  80b2a0:	ff d0                	call   *%rax
+}
+  80b2a2:	89 d8                	mov    %ebx,%eax
+  80b2a4:	48 83 c4 18          	add    $0x18,%rsp
+  80b2a8:	5b                   	pop    %rbx
+  80b2a9:	41 5c                	pop    %r12
+  80b2ab:	41 5d                	pop    %r13
+  80b2ad:	5d                   	pop    %rbp
+  80b2ae:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80b2af:	48 b9 b8 ca 80 00 00 	movabs $0x80cab8,%rcx
+  80b2b6:	00 00 00 
+  80b2b9:	48 ba 0d bc 80 00 00 	movabs $0x80bc0d,%rdx
+  80b2c0:	00 00 00 
+  80b2c3:	be 50 00 00 00       	mov    $0x50,%esi
+  80b2c8:	48 bf a7 ca 80 00 00 	movabs $0x80caa7,%rdi
+  80b2cf:	00 00 00 
+  80b2d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b2d7:	49 b8 81 73 80 00 00 	movabs $0x807381,%r8
+  80b2de:	00 00 00 
+  80b2e1:	41 ff d0             	call   *%r8
+
+000000000080b2e4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80b2e4:	55                   	push   %rbp
+  80b2e5:	48 89 e5             	mov    %rsp,%rbp
+  80b2e8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80b2ec:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80b2f0:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80b2f7:	00 00 00 
+  80b2fa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80b2fc:	85 c0                	test   %eax,%eax
+  80b2fe:	78 23                	js     80b323 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80b300:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80b304:	48 b8 2e 8c 80 00 00 	movabs $0x808c2e,%rax
+  80b30b:	00 00 00 
+  80b30e:	ff d0                	call   *%rax
+  80b310:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80b313:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80b317:	48 b8 1f ae 80 00 00 	movabs $0x80ae1f,%rax
+  80b31e:	00 00 00 
+  80b321:	ff d0                	call   *%rax
+}
+  80b323:	c9                   	leave
+  80b324:	c3                   	ret
+
+000000000080b325 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80b325:	48 89 f8             	mov    %rdi,%rax
+  80b328:	48 c1 e8 27          	shr    $0x27,%rax
+  80b32c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80b333:	01 00 00 
+  80b336:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80b33a:	f6 c2 01             	test   $0x1,%dl
+  80b33d:	74 6d                	je     80b3ac <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80b33f:	48 89 f8             	mov    %rdi,%rax
+  80b342:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80b346:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80b34d:	01 00 00 
+  80b350:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80b354:	f6 c2 01             	test   $0x1,%dl
+  80b357:	74 62                	je     80b3bb <get_uvpt_entry+0x96>
+  80b359:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80b360:	01 00 00 
+  80b363:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80b367:	f6 c2 80             	test   $0x80,%dl
+  80b36a:	75 4f                	jne    80b3bb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80b36c:	48 89 f8             	mov    %rdi,%rax
+  80b36f:	48 c1 e8 15          	shr    $0x15,%rax
+  80b373:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80b37a:	01 00 00 
+  80b37d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80b381:	f6 c2 01             	test   $0x1,%dl
+  80b384:	74 44                	je     80b3ca <get_uvpt_entry+0xa5>
+  80b386:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80b38d:	01 00 00 
+  80b390:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80b394:	f6 c2 80             	test   $0x80,%dl
+  80b397:	75 31                	jne    80b3ca <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80b399:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80b39d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80b3a4:	01 00 00 
+  80b3a7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80b3ab:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80b3ac:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80b3b3:	01 00 00 
+  80b3b6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80b3ba:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80b3bb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80b3c2:	01 00 00 
+  80b3c5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80b3c9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80b3ca:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80b3d1:	01 00 00 
+  80b3d4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80b3d8:	c3                   	ret
+
+000000000080b3d9 <get_prot>:
+
+int
+get_prot(void *va) {
+  80b3d9:	55                   	push   %rbp
+  80b3da:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80b3dd:	48 b8 25 b3 80 00 00 	movabs $0x80b325,%rax
+  80b3e4:	00 00 00 
+  80b3e7:	ff d0                	call   *%rax
+  80b3e9:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80b3ec:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80b3f1:	89 c1                	mov    %eax,%ecx
+  80b3f3:	83 c9 04             	or     $0x4,%ecx
+  80b3f6:	f6 c2 01             	test   $0x1,%dl
+  80b3f9:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80b3fc:	89 c1                	mov    %eax,%ecx
+  80b3fe:	83 c9 02             	or     $0x2,%ecx
+  80b401:	f6 c2 02             	test   $0x2,%dl
+  80b404:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80b407:	89 c1                	mov    %eax,%ecx
+  80b409:	83 c9 01             	or     $0x1,%ecx
+  80b40c:	48 85 d2             	test   %rdx,%rdx
+  80b40f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80b412:	89 c1                	mov    %eax,%ecx
+  80b414:	83 c9 40             	or     $0x40,%ecx
+  80b417:	f6 c6 04             	test   $0x4,%dh
+  80b41a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80b41d:	5d                   	pop    %rbp
+  80b41e:	c3                   	ret
+
+000000000080b41f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80b41f:	55                   	push   %rbp
+  80b420:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80b423:	48 b8 25 b3 80 00 00 	movabs $0x80b325,%rax
+  80b42a:	00 00 00 
+  80b42d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80b42f:	48 c1 e8 06          	shr    $0x6,%rax
+  80b433:	83 e0 01             	and    $0x1,%eax
+}
+  80b436:	5d                   	pop    %rbp
+  80b437:	c3                   	ret
+
+000000000080b438 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80b438:	55                   	push   %rbp
+  80b439:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80b43c:	48 b8 25 b3 80 00 00 	movabs $0x80b325,%rax
+  80b443:	00 00 00 
+  80b446:	ff d0                	call   *%rax
+  80b448:	83 e0 01             	and    $0x1,%eax
+}
+  80b44b:	5d                   	pop    %rbp
+  80b44c:	c3                   	ret
+
+000000000080b44d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80b44d:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80b454:	01 00 00 
+  80b457:	a8 01                	test   $0x1,%al
+  80b459:	75 06                	jne    80b461 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80b45b:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b460:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80b461:	55                   	push   %rbp
+  80b462:	48 89 e5             	mov    %rsp,%rbp
+  80b465:	41 57                	push   %r15
+  80b467:	41 56                	push   %r14
+  80b469:	41 55                	push   %r13
+  80b46b:	41 54                	push   %r12
+  80b46d:	53                   	push   %rbx
+  80b46e:	48 83 ec 28          	sub    $0x28,%rsp
+  80b472:	49 89 fe             	mov    %rdi,%r14
+  80b475:	49 89 f7             	mov    %rsi,%r15
+  80b478:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80b47f:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80b480:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80b487:	01 00 00 
+  80b48a:	e9 ae 00 00 00       	jmp    80b53d <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80b48f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80b496:	49 83 ec 01          	sub    $0x1,%r12
+  80b49a:	74 2d                	je     80b4c9 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80b49c:	48 89 d8             	mov    %rbx,%rax
+  80b49f:	48 c1 e8 0c          	shr    $0xc,%rax
+  80b4a3:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80b4a8:	f6 c2 01             	test   $0x1,%dl
+  80b4ab:	74 e2                	je     80b48f <foreach_shared_region+0x42>
+  80b4ad:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80b4b2:	f6 c4 04             	test   $0x4,%ah
+  80b4b5:	74 d8                	je     80b48f <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80b4b7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80b4be:	4c 89 fa             	mov    %r15,%rdx
+  80b4c1:	48 89 df             	mov    %rbx,%rdi
+  80b4c4:	41 ff d6             	call   *%r14
+  80b4c7:	eb c6                	jmp    80b48f <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80b4c9:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80b4d0:	00 
+  80b4d1:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80b4d6:	74 4a                	je     80b522 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80b4d8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80b4dc:	48 c1 e8 15          	shr    $0x15,%rax
+  80b4e0:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80b4e7:	01 00 00 
+  80b4ea:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80b4ee:	a8 01                	test   $0x1,%al
+  80b4f0:	74 d7                	je     80b4c9 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80b4f2:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80b4f6:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80b4fd:	48 39 c3             	cmp    %rax,%rbx
+  80b500:	73 c7                	jae    80b4c9 <foreach_shared_region+0x7c>
+  80b502:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80b509:	48 39 d0             	cmp    %rdx,%rax
+  80b50c:	4d 19 e4             	sbb    %r12,%r12
+  80b50f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80b516:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80b51d:	e9 7a ff ff ff       	jmp    80b49c <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  80b522:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80b529:	40 
+  80b52a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80b52e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80b535:	00 00 00 
+  80b538:	48 39 c1             	cmp    %rax,%rcx
+  80b53b:	74 50                	je     80b58d <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80b53d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80b541:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80b545:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80b54c:	01 00 00 
+  80b54f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80b553:	a8 01                	test   $0x1,%al
+  80b555:	74 cb                	je     80b522 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80b557:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80b55b:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80b562:	48 39 c1             	cmp    %rax,%rcx
+  80b565:	73 bb                	jae    80b522 <foreach_shared_region+0xd5>
+  80b567:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80b56e:	48 39 d0             	cmp    %rdx,%rax
+  80b571:	48 19 c0             	sbb    %rax,%rax
+  80b574:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80b57a:	48 05 00 02 00 00    	add    $0x200,%rax
+  80b580:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80b584:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80b588:	e9 4b ff ff ff       	jmp    80b4d8 <foreach_shared_region+0x8b>
+  80b58d:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b592:	48 83 c4 28          	add    $0x28,%rsp
+  80b596:	5b                   	pop    %rbx
+  80b597:	41 5c                	pop    %r12
+  80b599:	41 5d                	pop    %r13
+  80b59b:	41 5e                	pop    %r14
+  80b59d:	41 5f                	pop    %r15
+  80b59f:	5d                   	pop    %rbp
+  80b5a0:	c3                   	ret
+
+000000000080b5a1 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  80b5a1:	55                   	push   %rbp
+  80b5a2:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  80b5a5:	48 a1 60 45 86 00 00 	movabs 0x864560,%rax
+  80b5ac:	00 00 00 
+  80b5af:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  80b5b6:	48 b8 40 10 89 00 00 	movabs $0x891040,%rax
+  80b5bd:	00 00 00 
+  80b5c0:	48 39 c2             	cmp    %rax,%rdx
+  80b5c3:	74 13                	je     80b5d8 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  80b5c5:	48 89 c7             	mov    %rax,%rdi
+  80b5c8:	48 b8 3a 86 80 00 00 	movabs $0x80863a,%rax
+  80b5cf:	00 00 00 
+  80b5d2:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  80b5d4:	85 c0                	test   %eax,%eax
+  80b5d6:	78 0c                	js     80b5e4 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  80b5d8:	48 b8 9a 86 80 00 00 	movabs $0x80869a,%rax
+  80b5df:	00 00 00 
+  80b5e2:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  80b5e4:	48 ba 40 10 89 00 00 	movabs $0x891040,%rdx
+  80b5eb:	00 00 00 
+  80b5ee:	8b 0a                	mov    (%rdx),%ecx
+  80b5f0:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  80b5f3:	5d                   	pop    %rbp
+  80b5f4:	c3                   	ret
+
+000000000080b5f5 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  80b5f5:	55                   	push   %rbp
+  80b5f6:	48 89 e5             	mov    %rsp,%rbp
+  80b5f9:	41 57                	push   %r15
+  80b5fb:	41 56                	push   %r14
+  80b5fd:	41 55                	push   %r13
+  80b5ff:	41 54                	push   %r12
+  80b601:	53                   	push   %rbx
+  80b602:	48 83 ec 18          	sub    $0x18,%rsp
+  80b606:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  80b60a:	48 b8 00 10 89 00 00 	movabs $0x891000,%rax
+  80b611:	00 00 00 
+  80b614:	83 38 00             	cmpl   $0x0,(%rax)
+  80b617:	75 69                	jne    80b682 <scring_push+0x8d>
+  80b619:	49 89 ff             	mov    %rdi,%r15
+  80b61c:	49 89 f6             	mov    %rsi,%r14
+  80b61f:	49 89 d5             	mov    %rdx,%r13
+  80b622:	49 89 cc             	mov    %rcx,%r12
+  80b625:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  80b628:	48 ba 40 10 89 00 00 	movabs $0x891040,%rdx
+  80b62f:	00 00 00 
+  80b632:	8b 42 04             	mov    0x4(%rdx),%eax
+  80b635:	8b 12                	mov    (%rdx),%edx
+  80b637:	29 d0                	sub    %edx,%eax
+  80b639:	83 f8 20             	cmp    $0x20,%eax
+  80b63c:	74 53                	je     80b691 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  80b63e:	48 ba 40 10 89 00 00 	movabs $0x891040,%rdx
+  80b645:	00 00 00 
+  80b648:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  80b64b:	83 e0 1f             	and    $0x1f,%eax
+  80b64e:	48 c1 e0 06          	shl    $0x6,%rax
+  80b652:	48 01 d0             	add    %rdx,%rax
+  80b655:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  80b659:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  80b65d:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  80b661:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  80b665:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  80b669:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80b66d:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  80b671:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  80b675:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  80b679:	8b 42 04             	mov    0x4(%rdx),%eax
+  80b67c:	83 c0 01             	add    $0x1,%eax
+  80b67f:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  80b682:	48 83 c4 18          	add    $0x18,%rsp
+  80b686:	5b                   	pop    %rbx
+  80b687:	41 5c                	pop    %r12
+  80b689:	41 5d                	pop    %r13
+  80b68b:	41 5e                	pop    %r14
+  80b68d:	41 5f                	pop    %r15
+  80b68f:	5d                   	pop    %rbp
+  80b690:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  80b691:	48 b8 a1 b5 80 00 00 	movabs $0x80b5a1,%rax
+  80b698:	00 00 00 
+  80b69b:	ff d0                	call   *%rax
+  80b69d:	a3 00 10 89 00 00 00 	movabs %eax,0x891000
+  80b6a4:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  80b6a6:	85 c0                	test   %eax,%eax
+  80b6a8:	79 94                	jns    80b63e <scring_push+0x49>
+  80b6aa:	eb d6                	jmp    80b682 <scring_push+0x8d>
+
+000000000080b6ac <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  80b6ac:	48 ba 00 10 89 00 00 	movabs $0x891000,%rdx
+  80b6b3:	00 00 00 
+  80b6b6:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  80b6b8:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  80b6be:	85 c0                	test   %eax,%eax
+  80b6c0:	78 14                	js     80b6d6 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  80b6c2:	48 ba 40 10 89 00 00 	movabs $0x891040,%rdx
+  80b6c9:	00 00 00 
+  80b6cc:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  80b6cf:	8b 12                	mov    (%rdx),%edx
+  80b6d1:	39 d1                	cmp    %edx,%ecx
+  80b6d3:	75 11                	jne    80b6e6 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  80b6d5:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  80b6d6:	48 ba 40 10 89 00 00 	movabs $0x891040,%rdx
+  80b6dd:	00 00 00 
+  80b6e0:	8b 0a                	mov    (%rdx),%ecx
+  80b6e2:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80b6e5:	c3                   	ret
+scring_submit(void) {
+  80b6e6:	55                   	push   %rbp
+  80b6e7:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  80b6ea:	48 b8 a1 b5 80 00 00 	movabs $0x80b5a1,%rax
+  80b6f1:	00 00 00 
+  80b6f4:	ff d0                	call   *%rax
+}
+  80b6f6:	5d                   	pop    %rbp
+  80b6f7:	c3                   	ret
+
+000000000080b6f8 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  80b6f8:	48 b8 00 10 89 00 00 	movabs $0x891000,%rax
+  80b6ff:	00 00 00 
+  80b702:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  80b708:	48 b8 40 10 89 00 00 	movabs $0x891040,%rax
+  80b70f:	00 00 00 
+  80b712:	8b 10                	mov    (%rax),%edx
+  80b714:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80b717:	c3                   	ret
+
+000000000080b718 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80b718:	55                   	push   %rbp
+  80b719:	48 89 e5             	mov    %rsp,%rbp
+  80b71c:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  80b71f:	48 63 f7             	movslq %edi,%rsi
+  80b722:	48 83 ec 08          	sub    $0x8,%rsp
+  80b726:	6a 00                	push   $0x0
+  80b728:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80b72e:	4c 63 c1             	movslq %ecx,%r8
+  80b731:	48 89 d1             	mov    %rdx,%rcx
+  80b734:	48 89 c2             	mov    %rax,%rdx
+  80b737:	bf 04 00 00 00       	mov    $0x4,%edi
+  80b73c:	48 b8 f5 b5 80 00 00 	movabs $0x80b5f5,%rax
+  80b743:	00 00 00 
+  80b746:	ff d0                	call   *%rax
+}
+  80b748:	48 83 c4 10          	add    $0x10,%rsp
+  80b74c:	c9                   	leave
+  80b74d:	c3                   	ret
+
+000000000080b74e <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80b74e:	55                   	push   %rbp
+  80b74f:	48 89 e5             	mov    %rsp,%rbp
+  80b752:	48 89 f0             	mov    %rsi,%rax
+  80b755:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80b758:	48 63 ca             	movslq %edx,%rcx
+  80b75b:	48 63 f7             	movslq %edi,%rsi
+  80b75e:	48 83 ec 08          	sub    $0x8,%rsp
+  80b762:	4d 63 c9             	movslq %r9d,%r9
+  80b765:	41 51                	push   %r9
+  80b767:	4d 89 c1             	mov    %r8,%r9
+  80b76a:	4d 89 d0             	mov    %r10,%r8
+  80b76d:	48 89 c2             	mov    %rax,%rdx
+  80b770:	bf 05 00 00 00       	mov    $0x5,%edi
+  80b775:	48 b8 f5 b5 80 00 00 	movabs $0x80b5f5,%rax
+  80b77c:	00 00 00 
+  80b77f:	ff d0                	call   *%rax
+}
+  80b781:	48 83 c4 10          	add    $0x10,%rsp
+  80b785:	c9                   	leave
+  80b786:	c3                   	ret
+
+000000000080b787 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  80b787:	55                   	push   %rbp
+  80b788:	48 89 e5             	mov    %rsp,%rbp
+  80b78b:	48 89 f0             	mov    %rsi,%rax
+  80b78e:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  80b791:	48 63 f7             	movslq %edi,%rsi
+  80b794:	48 83 ec 08          	sub    $0x8,%rsp
+  80b798:	6a 00                	push   $0x0
+  80b79a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80b7a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80b7a6:	48 89 c2             	mov    %rax,%rdx
+  80b7a9:	bf 06 00 00 00       	mov    $0x6,%edi
+  80b7ae:	48 b8 f5 b5 80 00 00 	movabs $0x80b5f5,%rax
+  80b7b5:	00 00 00 
+  80b7b8:	ff d0                	call   *%rax
+}
+  80b7ba:	48 83 c4 10          	add    $0x10,%rsp
+  80b7be:	c9                   	leave
+  80b7bf:	c3                   	ret
+
+000000000080b7c0 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  80b7c0:	55                   	push   %rbp
+  80b7c1:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  80b7c4:	48 63 d6             	movslq %esi,%rdx
+  80b7c7:	48 63 f7             	movslq %edi,%rsi
+  80b7ca:	48 83 ec 08          	sub    $0x8,%rsp
+  80b7ce:	6a 00                	push   $0x0
+  80b7d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80b7d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80b7dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80b7e1:	bf 09 00 00 00       	mov    $0x9,%edi
+  80b7e6:	48 b8 f5 b5 80 00 00 	movabs $0x80b5f5,%rax
+  80b7ed:	00 00 00 
+  80b7f0:	ff d0                	call   *%rax
+}
+  80b7f2:	48 83 c4 10          	add    $0x10,%rsp
+  80b7f6:	c9                   	leave
+  80b7f7:	c3                   	ret
+
+000000000080b7f8 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80b7f8:	55                   	push   %rbp
+  80b7f9:	48 89 e5             	mov    %rsp,%rbp
+  80b7fc:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80b7ff:	48 63 f7             	movslq %edi,%rsi
+  80b802:	48 83 ec 08          	sub    $0x8,%rsp
+  80b806:	6a 00                	push   $0x0
+  80b808:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80b80e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80b814:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80b819:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80b81e:	48 b8 f5 b5 80 00 00 	movabs $0x80b5f5,%rax
+  80b825:	00 00 00 
+  80b828:	ff d0                	call   *%rax
+}
+  80b82a:	48 83 c4 10          	add    $0x10,%rsp
+  80b82e:	c9                   	leave
+  80b82f:	c3                   	ret
+
+000000000080b830 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80b830:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80b836:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80b83d:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80b844:	c3                   	ret
+
+000000000080b845 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80b845:	8b 47 40             	mov    0x40(%rdi),%eax
+  80b848:	8b 17                	mov    (%rdi),%edx
+  80b84a:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80b84c:	83 f8 0f             	cmp    $0xf,%eax
+  80b84f:	77 13                	ja     80b864 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80b851:	8b 47 40             	mov    0x40(%rdi),%eax
+  80b854:	83 e0 0f             	and    $0xf,%eax
+  80b857:	48 c1 e0 09          	shl    $0x9,%rax
+  80b85b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80b862:	00 
+  80b863:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80b864:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b869:	c3                   	ret
+
+000000000080b86a <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80b86a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80b86d:	83 c0 01             	add    $0x1,%eax
+  80b870:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80b873:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80b879:	8b 57 04             	mov    0x4(%rdi),%edx
+  80b87c:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b881:	85 d2                	test   %edx,%edx
+  80b883:	75 04                	jne    80b889 <chan_publish+0x1f>
+  80b885:	83 e0 01             	and    $0x1,%eax
+}
+  80b888:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80b889:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80b88c:	85 c0                	test   %eax,%eax
+  80b88e:	0f 95 c0             	setne  %al
+  80b891:	0f b6 c0             	movzbl %al,%eax
+  80b894:	eb ef                	jmp    80b885 <chan_publish+0x1b>
+
+000000000080b896 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80b896:	8b 47 40             	mov    0x40(%rdi),%eax
+  80b899:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80b89b:	29 d0                	sub    %edx,%eax
+  80b89d:	83 e8 01             	sub    $0x1,%eax
+  80b8a0:	83 f8 0f             	cmp    $0xf,%eax
+  80b8a3:	77 12                	ja     80b8b7 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80b8a5:	8b 07                	mov    (%rdi),%eax
+  80b8a7:	83 e0 0f             	and    $0xf,%eax
+  80b8aa:	48 c1 e0 09          	shl    $0x9,%rax
+  80b8ae:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80b8b5:	00 
+  80b8b6:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80b8b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b8bc:	c3                   	ret
+
+000000000080b8bd <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80b8bd:	8b 07                	mov    (%rdi),%eax
+  80b8bf:	83 c0 01             	add    $0x1,%eax
+  80b8c2:	89 07                	mov    %eax,(%rdi)
+}
+  80b8c4:	c3                   	ret
+
+000000000080b8c5 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80b8c5:	55                   	push   %rbp
+  80b8c6:	48 89 e5             	mov    %rsp,%rbp
+  80b8c9:	53                   	push   %rbx
+  80b8ca:	48 83 ec 08          	sub    $0x8,%rsp
+  80b8ce:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80b8d1:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80b8d8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80b8de:	48 b8 96 b8 80 00 00 	movabs $0x80b896,%rax
+  80b8e5:	00 00 00 
+  80b8e8:	ff d0                	call   *%rax
+  80b8ea:	48 85 c0             	test   %rax,%rax
+  80b8ed:	74 12                	je     80b901 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80b8ef:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80b8f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80b8fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80b8ff:	c9                   	leave
+  80b900:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80b901:	b8 01 00 00 00       	mov    $0x1,%eax
+  80b906:	eb f3                	jmp    80b8fb <chan_arm+0x36>
+
+000000000080b908 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80b908:	55                   	push   %rbp
+  80b909:	48 89 e5             	mov    %rsp,%rbp
+  80b90c:	41 56                	push   %r14
+  80b90e:	41 55                	push   %r13
+  80b910:	41 54                	push   %r12
+  80b912:	53                   	push   %rbx
+  80b913:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80b916:	49 bc c5 b8 80 00 00 	movabs $0x80b8c5,%r12
+  80b91d:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80b920:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80b924:	49 bd c3 86 80 00 00 	movabs $0x8086c3,%r13
+  80b92b:	00 00 00 
+    while (chan_arm(r))
+  80b92e:	eb 0d                	jmp    80b93d <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80b930:	8b 33                	mov    (%rbx),%esi
+  80b932:	ba 00 00 00 00       	mov    $0x0,%edx
+  80b937:	4c 89 f7             	mov    %r14,%rdi
+  80b93a:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80b93d:	48 89 df             	mov    %rbx,%rdi
+  80b940:	41 ff d4             	call   *%r12
+  80b943:	84 c0                	test   %al,%al
+  80b945:	75 e9                	jne    80b930 <chan_wait+0x28>
+}
+  80b947:	5b                   	pop    %rbx
+  80b948:	41 5c                	pop    %r12
+  80b94a:	41 5d                	pop    %r13
+  80b94c:	41 5e                	pop    %r14
+  80b94e:	5d                   	pop    %rbp
+  80b94f:	c3                   	ret
+
+000000000080b950 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80b950:	55                   	push   %rbp
+  80b951:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80b954:	48 83 c7 40          	add    $0x40,%rdi
+  80b958:	be 01 00 00 00       	mov    $0x1,%esi
+  80b95d:	48 b8 e1 86 80 00 00 	movabs $0x8086e1,%rax
+  80b964:	00 00 00 
+  80b967:	ff d0                	call   *%rax
+}
+  80b969:	5d                   	pop    %rbp
+  80b96a:	c3                   	ret
+
+000000000080b96b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80b96b:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b970:	c3                   	ret
+
+000000000080b971 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80b971:	55                   	push   %rbp
+  80b972:	48 89 e5             	mov    %rsp,%rbp
+  80b975:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80b978:	48 be dc ca 80 00 00 	movabs $0x80cadc,%rsi
+  80b97f:	00 00 00 
+  80b982:	48 b8 f6 7d 80 00 00 	movabs $0x807df6,%rax
+  80b989:	00 00 00 
+  80b98c:	ff d0                	call   *%rax
+    return 0;
+}
+  80b98e:	b8 00 00 00 00       	mov    $0x0,%eax
+  80b993:	5d                   	pop    %rbp
+  80b994:	c3                   	ret
+
+000000000080b995 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80b995:	55                   	push   %rbp
+  80b996:	48 89 e5             	mov    %rsp,%rbp
+  80b999:	41 57                	push   %r15
+  80b99b:	41 56                	push   %r14
+  80b99d:	41 55                	push   %r13
+  80b99f:	41 54                	push   %r12
+  80b9a1:	53                   	push   %rbx
+  80b9a2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80b9a9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80b9b0:	48 85 d2             	test   %rdx,%rdx
+  80b9b3:	74 7a                	je     80ba2f <devcons_write+0x9a>
+  80b9b5:	49 89 d6             	mov    %rdx,%r14
+  80b9b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80b9be:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80b9c3:	49 bf f0 7f 80 00 00 	movabs $0x807ff0,%r15
+  80b9ca:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80b9cd:	4c 89 f3             	mov    %r14,%rbx
+  80b9d0:	48 29 f3             	sub    %rsi,%rbx
+  80b9d3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80b9d8:	48 39 c3             	cmp    %rax,%rbx
+  80b9db:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80b9df:	4c 63 eb             	movslq %ebx,%r13
+  80b9e2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80b9e9:	48 01 c6             	add    %rax,%rsi
+  80b9ec:	4c 89 ea             	mov    %r13,%rdx
+  80b9ef:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80b9f6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80b9f9:	4c 89 ee             	mov    %r13,%rsi
+  80b9fc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80ba03:	48 b8 1d 82 80 00 00 	movabs $0x80821d,%rax
+  80ba0a:	00 00 00 
+  80ba0d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80ba0f:	41 01 dc             	add    %ebx,%r12d
+  80ba12:	49 63 f4             	movslq %r12d,%rsi
+  80ba15:	4c 39 f6             	cmp    %r14,%rsi
+  80ba18:	72 b3                	jb     80b9cd <devcons_write+0x38>
+    return res;
+  80ba1a:	49 63 c4             	movslq %r12d,%rax
+}
+  80ba1d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80ba24:	5b                   	pop    %rbx
+  80ba25:	41 5c                	pop    %r12
+  80ba27:	41 5d                	pop    %r13
+  80ba29:	41 5e                	pop    %r14
+  80ba2b:	41 5f                	pop    %r15
+  80ba2d:	5d                   	pop    %rbp
+  80ba2e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80ba2f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80ba35:	eb e3                	jmp    80ba1a <devcons_write+0x85>
+
+000000000080ba37 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80ba37:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80ba3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80ba3f:	48 85 c0             	test   %rax,%rax
+  80ba42:	74 55                	je     80ba99 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80ba44:	55                   	push   %rbp
+  80ba45:	48 89 e5             	mov    %rsp,%rbp
+  80ba48:	41 55                	push   %r13
+  80ba4a:	41 54                	push   %r12
+  80ba4c:	53                   	push   %rbx
+  80ba4d:	48 83 ec 08          	sub    $0x8,%rsp
+  80ba51:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80ba54:	48 bb 3c 82 80 00 00 	movabs $0x80823c,%rbx
+  80ba5b:	00 00 00 
+  80ba5e:	49 bc f1 82 80 00 00 	movabs $0x8082f1,%r12
+  80ba65:	00 00 00 
+  80ba68:	eb 03                	jmp    80ba6d <devcons_read+0x36>
+  80ba6a:	41 ff d4             	call   *%r12
+  80ba6d:	ff d3                	call   *%rbx
+  80ba6f:	85 c0                	test   %eax,%eax
+  80ba71:	74 f7                	je     80ba6a <devcons_read+0x33>
+    if (c < 0) return c;
+  80ba73:	48 63 d0             	movslq %eax,%rdx
+  80ba76:	78 13                	js     80ba8b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80ba78:	ba 00 00 00 00       	mov    $0x0,%edx
+  80ba7d:	83 f8 04             	cmp    $0x4,%eax
+  80ba80:	74 09                	je     80ba8b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80ba82:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80ba86:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80ba8b:	48 89 d0             	mov    %rdx,%rax
+  80ba8e:	48 83 c4 08          	add    $0x8,%rsp
+  80ba92:	5b                   	pop    %rbx
+  80ba93:	41 5c                	pop    %r12
+  80ba95:	41 5d                	pop    %r13
+  80ba97:	5d                   	pop    %rbp
+  80ba98:	c3                   	ret
+  80ba99:	48 89 d0             	mov    %rdx,%rax
+  80ba9c:	c3                   	ret
+
+000000000080ba9d <cputchar>:
+cputchar(int ch) {
+  80ba9d:	55                   	push   %rbp
+  80ba9e:	48 89 e5             	mov    %rsp,%rbp
+  80baa1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80baa5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80baa9:	be 01 00 00 00       	mov    $0x1,%esi
+  80baae:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80bab2:	48 b8 1d 82 80 00 00 	movabs $0x80821d,%rax
+  80bab9:	00 00 00 
+  80babc:	ff d0                	call   *%rax
+}
+  80babe:	c9                   	leave
+  80babf:	c3                   	ret
+
+000000000080bac0 <getchar>:
+getchar(void) {
+  80bac0:	55                   	push   %rbp
+  80bac1:	48 89 e5             	mov    %rsp,%rbp
+  80bac4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80bac8:	ba 01 00 00 00       	mov    $0x1,%edx
+  80bacd:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80bad1:	bf 00 00 00 00       	mov    $0x0,%edi
+  80bad6:	48 b8 8d 8f 80 00 00 	movabs $0x808f8d,%rax
+  80badd:	00 00 00 
+  80bae0:	ff d0                	call   *%rax
+  80bae2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80bae4:	85 c0                	test   %eax,%eax
+  80bae6:	78 06                	js     80baee <getchar+0x2e>
+  80bae8:	74 08                	je     80baf2 <getchar+0x32>
+  80baea:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80baee:	89 d0                	mov    %edx,%eax
+  80baf0:	c9                   	leave
+  80baf1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80baf2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80baf7:	eb f5                	jmp    80baee <getchar+0x2e>
+
+000000000080baf9 <iscons>:
+iscons(int fdnum) {
+  80baf9:	55                   	push   %rbp
+  80bafa:	48 89 e5             	mov    %rsp,%rbp
+  80bafd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80bb01:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80bb05:	48 b8 aa 8c 80 00 00 	movabs $0x808caa,%rax
+  80bb0c:	00 00 00 
+  80bb0f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80bb11:	85 c0                	test   %eax,%eax
+  80bb13:	78 18                	js     80bb2d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80bb15:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80bb19:	48 b8 40 31 81 00 00 	movabs $0x813140,%rax
+  80bb20:	00 00 00 
+  80bb23:	8b 00                	mov    (%rax),%eax
+  80bb25:	39 02                	cmp    %eax,(%rdx)
+  80bb27:	0f 94 c0             	sete   %al
+  80bb2a:	0f b6 c0             	movzbl %al,%eax
+}
+  80bb2d:	c9                   	leave
+  80bb2e:	c3                   	ret
+
+000000000080bb2f <opencons>:
+opencons(void) {
+  80bb2f:	55                   	push   %rbp
+  80bb30:	48 89 e5             	mov    %rsp,%rbp
+  80bb33:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80bb37:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80bb3b:	48 b8 4a 8c 80 00 00 	movabs $0x808c4a,%rax
+  80bb42:	00 00 00 
+  80bb45:	ff d0                	call   *%rax
+  80bb47:	85 c0                	test   %eax,%eax
+  80bb49:	78 49                	js     80bb94 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80bb4b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80bb50:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80bb55:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80bb59:	bf 00 00 00 00       	mov    $0x0,%edi
+  80bb5e:	48 b8 55 83 80 00 00 	movabs $0x808355,%rax
+  80bb65:	00 00 00 
+  80bb68:	ff d0                	call   *%rax
+  80bb6a:	85 c0                	test   %eax,%eax
+  80bb6c:	78 26                	js     80bb94 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80bb6e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80bb72:	a1 40 31 81 00 00 00 	movabs 0x813140,%eax
+  80bb79:	00 00 
+  80bb7b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80bb7d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80bb81:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80bb88:	48 b8 1c 8c 80 00 00 	movabs $0x808c1c,%rax
+  80bb8f:	00 00 00 
+  80bb92:	ff d0                	call   *%rax
+}
+  80bb94:	c9                   	leave
+  80bb95:	c3                   	ret
+  80bb96:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80bb9d:	00 00 00 
+
+000000000080bba0 <__popcountdi2>:
+  80bba0:	f3 0f 1e fa          	endbr64
+  80bba4:	48 ba 55 55 55 55 55 	movabs $0x5555555555555555,%rdx
+  80bbab:	55 55 55 
+  80bbae:	48 89 f8             	mov    %rdi,%rax
+  80bbb1:	48 d1 e8             	shr    %rax
+  80bbb4:	48 21 d0             	and    %rdx,%rax
+  80bbb7:	48 29 c7             	sub    %rax,%rdi
+  80bbba:	48 b8 33 33 33 33 33 	movabs $0x3333333333333333,%rax
+  80bbc1:	33 33 33 
+  80bbc4:	48 89 fa             	mov    %rdi,%rdx
+  80bbc7:	48 c1 ef 02          	shr    $0x2,%rdi
+  80bbcb:	48 21 c2             	and    %rax,%rdx
+  80bbce:	48 21 c7             	and    %rax,%rdi
+  80bbd1:	48 01 fa             	add    %rdi,%rdx
+  80bbd4:	48 89 d0             	mov    %rdx,%rax
+  80bbd7:	48 c1 e8 04          	shr    $0x4,%rax
+  80bbdb:	48 01 d0             	add    %rdx,%rax
+  80bbde:	48 ba 0f 0f 0f 0f 0f 	movabs $0xf0f0f0f0f0f0f0f,%rdx
+  80bbe5:	0f 0f 0f 
+  80bbe8:	48 21 d0             	and    %rdx,%rax
+  80bbeb:	48 ba 01 01 01 01 01 	movabs $0x101010101010101,%rdx
+  80bbf2:	01 01 01 
+  80bbf5:	48 0f af c2          	imul   %rdx,%rax
+  80bbf9:	48 c1 e8 38          	shr    $0x38,%rax
+  80bbfd:	c3                   	ret
+  80bbfe:	66 90                	xchg   %ax,%ax
+
+000000000080bc00 <__rodata_start>:
+  80bc00:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80bc01:	73 65                	jae    80bc68 <ide_disk+0x8>
+  80bc03:	63 73 20             	movsxd 0x20(%rbx),%esi
+  80bc06:	3c 3d                	cmp    $0x3d,%al
+  80bc08:	20 32                	and    %dh,(%rdx)
+  80bc0a:	35 36 00 61 73       	xor    $0x73610036,%eax
+  80bc0f:	73 65                	jae    80bc76 <ide_disk+0x16>
+  80bc11:	72 74                	jb     80bc87 <ide_disk+0x27>
+  80bc13:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  80bc1a:	6c                   	insb   (%dx),%es:(%rdi)
+  80bc1b:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80bc1f:	25 73 00 66 73       	and    $0x73660073,%eax
+  80bc24:	2f                   	(bad)
+  80bc25:	69 64 65 2e 63 00 44 	imul   $0x65440063,0x2e(%rbp,%riz,2),%esp
+  80bc2c:	65 
+  80bc2d:	76 69                	jbe    80bc98 <ide_disk+0x38>
+  80bc2f:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80bc32:	31 20                	xor    %esp,(%rax)
+  80bc34:	70 72                	jo     80bca8 <ide_disk+0x48>
+  80bc36:	65 73 65             	gs jae 80bc9e <ide_disk+0x3e>
+  80bc39:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80bc3a:	63 65 3a             	movsxd 0x3a(%rbp),%esp
+  80bc3d:	20 25 64 0a 00 62    	and    %ah,0x62000a64(%rip)        # 6280c6a7 <__bss_end+0x61f7a6a7>
+  80bc43:	61                   	(bad)
+  80bc44:	64 20 64 69 73       	and    %ah,%fs:0x73(%rcx,%rbp,2)
+  80bc49:	6b 20 6e             	imul   $0x6e,(%rax),%esp
+  80bc4c:	75 6d                	jne    80bcbb <ide_disk+0x5b>
+  80bc4e:	62 65                	(bad)
+  80bc50:	72 00                	jb     80bc52 <__rodata_start+0x52>
+  80bc52:	69 64 65 00 66 2e 0f 	imul   $0x1f0f2e66,0x0(%rbp,%riz,2),%esp
+  80bc59:	1f 
+  80bc5a:	84 00                	test   %al,(%rax)
+  80bc5c:	00 00                	add    %al,(%rax)
+	...
+
+000000000080bc60 <ide_disk>:
+  80bc60:	52 bc 80 00 00 00 00 00 1a 04 80 00 00 00 00 00     R...............
+  80bc70:	25 05 80 00 00 00 00 00 8b 02 80 00 00 00 00 00     %...............
+  80bc80:	04 04 80 00 00 00 00 00 cd 00 80 00 00 00 00 00     ................
+  80bc90:	76 69 72 74 69 6f 2d 62 6c 6b 3a 20 25 6c 75 20     virtio-blk: %lu 
+  80bca0:	73 65 63 74 6f 72 73 2c 20 71 75 65 75 65 20 73     sectors, queue s
+  80bcb0:	69 7a 65 20 25 75 2c 20 69 72 71 20 25 64 0a 00     ize %u, irq %d..
+  80bcc0:	76 69 72 74 69 6f 00 66 2e 0f 1f 84 00 00 00 00     virtio.f........
+  80bcd0:	00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 44 00 00     .f...........D..
+
+000000000080bce0 <virtio_disk>:
+  80bce0:	c0 bc 80 00 00 00 00 00 6c 0e 80 00 00 00 00 00     ........l.......
+  80bcf0:	83 0e 80 00 00 00 00 00 b0 0e 80 00 00 00 00 00     ................
+  80bd00:	9a 0e 80 00 00 00 00 00 fe 08 80 00 00 00 00 00     ................
+  80bd10:	62 63 5f 72 61 5f 63 6f 6d 70 6c 65 74 65 2e 73     bc_ra_complete.s
+  80bd20:	79 73 5f 6d 61 70 5f 72 65 67 69 6f 6e 20 66 61     ys_map_region fa
+  80bd30:	69 6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00     iled: %i........
+  80bd40:	66 6c 75 73 68 5f 62 6c 6f 63 6b 3a 20 64 69 73     flush_block: dis
+  80bd50:	6b 20 77 72 69 74 65 20 66 61 69 6c 65 64 3a 20     k write failed: 
+  80bd60:	25 69 0a 00 00 00 00 00 62 61 64 20 62 6c 6f 63     %i......bad bloc
+  80bd70:	6b 20 6e 75 6d 62 65 72 20 25 30 38 78 20 69 6e     k number %08x in
+  80bd80:	20 64 69 73 6b 61 64 64 72 00 00 00 00 00 00 00      diskaddr.......
+  80bd90:	72 65 61 64 69 6e 67 20 6e 6f 6e 2d 65 78 69 73     reading non-exis
+  80bda0:	74 65 6e 74 20 62 6c 6f 63 6b 20 25 30 38 78 20     tent block %08x 
+  80bdb0:	6f 75 74 20 6f 66 20 25 30 38 78 0a 00 00 00 00     out of %08x.....
+  80bdc0:	66 6c 75 73 68 5f 62 6c 6f 63 6b 2e 73 79 73 5f     flush_block.sys_
+  80bdd0:	6d 61 70 5f 72 65 67 69 6f 6e 20 66 61 69 6c 65     map_region faile
+  80bde0:	64 3a 20 25 69 0a 00 00 62 63 5f 72 65 61 64 5f     d: %i...bc_read_
+  80bdf0:	72 75 6e 2e 73 79 73 5f 61 6c 6c 6f 63 5f 72 65     run.sys_alloc_re
+  80be00:	67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25 69 0a     gion failed: %i.
+	...
+  80be18:	62 63 5f 72 65 61 64 5f 72 75 6e 3a 20 64 69 73     bc_read_run: dis
+  80be28:	6b 20 72 65 61 64 20 66 61 69 6c 65 64 3a 20 25     k read failed: %
+  80be38:	69 0a 00 00 00 00 00 00 62 63 5f 72 65 61 64 5f     i.......bc_read_
+  80be48:	73 74 61 72 74 2e 73 79 73 5f 61 6c 6c 6f 63 5f     start.sys_alloc_
+  80be58:	72 65 67 69 6f 6e 20 66 61 69 6c 65 64 3a 20 25     region failed: %
+  80be68:	69 0a 00 00 00 00 00 00 62 63 5f 72 65 61 64 5f     i.......bc_read_
+  80be78:	73 74 61 72 74 3a 20 64 69 73 6b 20 72 65 61 64     start: disk read
+  80be88:	20 66 61 69 6c 65 64 3a 20 25 69 0a 00 00 00 00      failed: %i.....
+  80be98:	21 69 73 5f 70 61 67 65 5f 64 69 72 74 79 28 52     !is_page_dirty(R
+  80bea8:	4f 55 4e 44 44 4f 57 4e 28 61 64 64 72 2c 20 50     OUNDDOWN(addr, P
+  80beb8:	41 47 45 5f 53 49 5a 45 29 29 00 00 00 00 00 00     AGE_SIZE))......
+  80bec8:	73 74 72 63 6d 70 28 64 69 73 6b 61 64 64 72 28     strcmp(diskaddr(
+  80bed8:	31 29 2c 20 22 4f 4f 50 53 21 5c 6e 22 29 20 3d     1), "OOPS!\n") =
+  80bee8:	3d 20 30 00 66 73 2f 62 63 2e 63 00 66 6c 75 73     = 0.fs/bc.c.flus
+  80bef8:	68 5f 62 6c 6f 63 6b 20 6f 66 20 62 61 64 20 76     h_block of bad v
+  80bf08:	61 20 25 70 00 4f 4f 50 53 21 0a 00 21 69 73 5f     a %p.OOPS!..!is_
+  80bf18:	70 61 67 65 5f 64 69 72 74 79 28 64 69 73 6b 61     page_dirty(diska
+  80bf28:	64 64 72 28 31 29 29 00 21 69 73 5f 70 61 67 65     ddr(1)).!is_page
+  80bf38:	5f 70 72 65 73 65 6e 74 28 64 69 73 6b 61 64 64     _present(diskadd
+  80bf48:	72 28 31 29 29 00 62 6c 6f 63 6b 20 63 61 63 68     r(1)).block cach
+  80bf58:	65 20 69 73 20 67 6f 6f 64 0a 00 0f 1f 44 00 00     e is good....D..
+  80bf68:	62 61 64 20 66 69 6c 65 20 73 79 73 74 65 6d 20     bad file system 
+  80bf78:	6d 61 67 69 63 20 6e 75 6d 62 65 72 20 25 30 38     magic number %08
+  80bf88:	78 00 66 73 2f 66 73 2e 63 00 66 69 6c 65 20 73     x.fs/fs.c.file s
+  80bf98:	79 73 74 65 6d 20 69 73 20 74 6f 6f 20 6c 61 72     ystem is too lar
+  80bfa8:	67 65 00 73 75 70 65 72 62 6c 6f 63 6b 20 69 73     ge.superblock is
+  80bfb8:	20 67 6f 6f 64 0a 00 61 74 74 65 6d 70 74 20 74      good..attempt t
+  80bfc8:	6f 20 66 72 65 65 20 7a 65 72 6f 20 62 6c 6f 63     o free zero bloc
+  80bfd8:	6b 00 21 62 6c 6f 63 6b 5f 69 73 5f 66 72 65 65     k.!block_is_free
+  80bfe8:	28 32 20 2b 20 69 29 00 21 62 6c 6f 63 6b 5f 69     (2 + i).!block_i
+  80bff8:	73 5f 66 72 65 65 28 31 29 00 21 62 6c 6f 63 6b     s_free(1).!block
+  80c008:	5f 69 73 5f 66 72 65 65 28 30 29 00 62 69 74 6d     _is_free(0).bitm
+  80c018:	61 70 20 69 73 20 67 6f 6f 64 0a 00 77 61 72 6e     ap is good..warn
+  80c028:	69 6e 67 3a 20 66 69 6c 65 5f 66 72 65 65 5f 62     ing: file_free_b
+  80c038:	6c 6f 63 6b 3a 20 25 69 00 62 6c 6f 63 6b 20 3d     lock: %i.block =
+  80c048:	3d 20 68 69 6e 74 00 28 64 69 72 2d 3e 66 5f 73     = hint.(dir->f_s
+  80c058:	69 7a 65 20 25 20 42 4c 4b 53 49 5a 45 29 20 3d     ize % BLKSIZE) =
+  80c068:	3d 20 30 00 0f 1f 40 00 49 6e 76 61 6c 69 64 20     = 0...@.Invalid 
+  80c078:	72 65 71 75 65 73 74 20 63 6f 64 65 20 25 64 20     request code %d 
+  80c088:	66 72 6f 6d 20 25 30 38 78 0a 00 00 00 00 00 00     from %08x.......
+  80c098:	73 65 72 76 65 3a 20 74 68 72 65 61 64 5f 63 72     serve: thread_cr
+  80c0a8:	65 61 74 65 20 66 61 69 6c 65 64 3a 20 25 69 00     eate failed: %i.
+  80c0b8:	49 6e 76 61 6c 69 64 20 72 65 71 75 65 73 74 20     Invalid request 
+  80c0c8:	66 72 6f 6d 20 25 30 38 78 3a 20 6e 6f 20 61 72     from %08x: no ar
+  80c0d8:	67 75 6d 65 6e 74 20 70 61 67 65 0a 00 66 73 2f     gument page..fs/
+  80c0e8:	73 65 72 76 2e 63 00 66 73 00 46 53 20 69 73 20     serv.c.fs.FS is 
+  80c0f8:	72 75 6e 6e 69 6e 67 0a 00 46 53 20 63 61 6e 20     running..FS can 
+  80c108:	64 6f 20 49 2f 4f 0a 00 21 74 68 72 65 61 64 5f     do I/O..!thread_
+  80c118:	63 75 72 00 66 73 2f 74 68 72 65 61 64 2e 63 00     cur.fs/thread.c.
+  80c128:	00 00 63 68 65 63 6b 69 6e 67 20 63 6f 6e 73 69     ..checking consi
+  80c138:	73 74 65 6e 63 79 20 6f 66 20 25 73 0a 00 21 62     stency of %s..!b
+  80c148:	6c 6f 63 6b 5f 69 73 5f 66 72 65 65 28 64 69 73     lock_is_free(dis
+  80c158:	6b 62 6e 6f 29 00 66 73 2f 74 65 73 74 2e 63 00     kbno).fs/test.c.
+  80c168:	73 79 73 5f 70 61 67 65 5f 61 6c 6c 6f 63 3a 20     sys_page_alloc: 
+  80c178:	25 69 00 61 6c 6c 6f 63 5f 62 6c 6f 63 6b 3a 20     %i.alloc_block: 
+  80c188:	25 69 00 54 53 54 42 49 54 28 62 69 74 73 2c 20     %i.TSTBIT(bits, 
+  80c198:	72 29 00 21 54 53 54 42 49 54 28 62 69 74 6d 61     r).!TSTBIT(bitma
+  80c1a8:	70 2c 20 72 29 00 61 6c 6c 6f 63 5f 62 6c 6f 63     p, r).alloc_bloc
+  80c1b8:	6b 20 69 73 20 67 6f 6f 64 0a 00 66 73 20 63 6f     k is good..fs co
+  80c1c8:	6e 73 69 73 74 65 6e 63 79 20 69 73 20 67 6f 6f     nsistency is goo
+  80c1d8:	64 0a 00 2f 6e 6f 74 2d 66 6f 75 6e 64 00 66 69     d../not-found.fi
+  80c1e8:	6c 65 5f 6f 70 65 6e 20 2f 6e 6f 74 2d 66 6f 75     le_open /not-fou
+  80c1f8:	6e 64 3a 20 25 69 00 2f 6e 65 77 6d 6f 74 64 00     nd: %i./newmotd.
+  80c208:	66 69 6c 65 5f 6f 70 65 6e 20 2f 6e 65 77 6d 6f     file_open /newmo
+  80c218:	74 64 3a 20 25 69 00 66 69 6c 65 5f 6f 70 65 6e     td: %i.file_open
+  80c228:	20 69 73 20 67 6f 6f 64 0a 00 66 69 6c 65 5f 67      is good..file_g
+  80c238:	65 74 5f 62 6c 6f 63 6b 3a 20 25 69 00 66 69 6c     et_block: %i.fil
+  80c248:	65 5f 67 65 74 5f 62 6c 6f 63 6b 20 69 73 20 67     e_get_block is g
+  80c258:	6f 6f 64 0a 00 21 69 73 5f 70 61 67 65 5f 64 69     ood..!is_page_di
+  80c268:	72 74 79 28 62 6c 6b 29 00 66 69 6c 65 5f 66 6c     rty(blk).file_fl
+  80c278:	75 73 68 20 69 73 20 67 6f 6f 64 0a 00 66 69 6c     ush is good..fil
+  80c288:	65 5f 73 65 74 5f 73 69 7a 65 3a 20 25 69 00 21     e_set_size: %i.!
+  80c298:	69 73 5f 70 61 67 65 5f 64 69 72 74 79 28 66 29     is_page_dirty(f)
+  80c2a8:	00 66 69 6c 65 5f 74 72 75 6e 63 61 74 65 20 69     .file_truncate i
+  80c2b8:	73 20 67 6f 6f 64 0a 00 66 69 6c 65 5f 73 65 74     s good..file_set
+  80c2c8:	5f 73 69 7a 65 20 32 3a 20 25 69 00 66 69 6c 65     _size 2: %i.file
+  80c2d8:	5f 67 65 74 5f 62 6c 6f 63 6b 20 32 3a 20 25 69     _get_block 2: %i
+  80c2e8:	00 66 69 6c 65 20 72 65 77 72 69 74 65 20 69 73     .file rewrite is
+  80c2f8:	20 67 6f 6f 64 0a 00 90 66 69 6c 65 5f 6f 70 65      good...file_ope
+  80c308:	6e 20 2f 6e 6f 74 2d 66 6f 75 6e 64 20 73 75 63     n /not-found suc
+  80c318:	63 65 65 64 65 64 21 00 54 68 69 73 20 69 73 20     ceeded!.This is 
+  80c328:	74 68 65 20 4e 45 57 20 6d 65 73 73 61 67 65 20     the NEW message 
+  80c338:	6f 66 20 74 68 65 20 64 61 79 21 0a 0a 00 00 00     of the day!.....
+  80c348:	66 69 6c 65 5f 67 65 74 5f 62 6c 6f 63 6b 20 72     file_get_block r
+  80c358:	65 74 75 72 6e 65 64 20 77 72 6f 6e 67 20 64 61     eturned wrong da
+  80c368:	74 61 00 00 00 00 00 00 66 2d 3e 66 5f 65 78 74     ta......f->f_ext
+  80c378:	65 6e 74 5b 30 5d 2e 65 5f 6c 65 6e 20 3d 3d 20     ent[0].e_len == 
+  80c388:	30 20 26 26 20 66 2d 3e 66 5f 65 78 74 65 6e 74     0 && f->f_extent
+  80c398:	5b 30 5d 2e 65 5f 73 74 61 72 74 20 3d 3d 20 30     [0].e_start == 0
+  80c3a8:	00 3c 75 6e 6b 6e 6f 77 6e 3e 00 0f 1f 44 00 00     .<unknown>...D..
+  80c3b8:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  80c3c8:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  80c3d8:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  80c3e8:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  80c3f8:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  80c408:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  80c418:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  80c428:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  80c438:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  80c448:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  80c458:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  80c468:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  80c478:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  80c488:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  80c498:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  80c4a8:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  80c4b8:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  80c4c8:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  80c4d8:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  80c4e8:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  80c4f8:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  80c508:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  80c518:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  80c528:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  80c538:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  80c548:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  80c558:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  80c568:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  80c578:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  80c588:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 66      use.f.........f
+  80c598:	0f 1f 84 00 00 00 00 00 be 76 80 00 00 00 00 00     .........v......
+  80c5a8:	ff 7c 80 00 00 00 00 00 ef 7c 80 00 00 00 00 00     .|.......|......
+  80c5b8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c5c8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c5d8:	dd 76 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .v.......|......
+  80c5e8:	ff 7c 80 00 00 00 00 00 d1 76 80 00 00 00 00 00     .|.......v......
+  80c5f8:	4b 77 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     Kw.......|......
+  80c608:	d1 76 80 00 00 00 00 00 17 77 80 00 00 00 00 00     .v.......w......
+  80c618:	17 77 80 00 00 00 00 00 17 77 80 00 00 00 00 00     .w.......w......
+  80c628:	17 77 80 00 00 00 00 00 17 77 80 00 00 00 00 00     .w.......w......
+  80c638:	17 77 80 00 00 00 00 00 17 77 80 00 00 00 00 00     .w.......w......
+  80c648:	17 77 80 00 00 00 00 00 17 77 80 00 00 00 00 00     .w.......w......
+  80c658:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c668:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c678:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c688:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c698:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6a8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6b8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6c8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6d8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6e8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c6f8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c708:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c718:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c728:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c738:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c748:	22 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     "|.......|......
+  80c758:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c768:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c778:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c788:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c798:	ff 7c 80 00 00 00 00 00 6e 77 80 00 00 00 00 00     .|......nw......
+  80c7a8:	3d 79 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     =y.......|......
+  80c7b8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c7c8:	ff 7c 80 00 00 00 00 00 9d 77 80 00 00 00 00 00     .|.......w......
+  80c7d8:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c7e8:	63 77 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     cw.......|......
+  80c7f8:	ff 7c 80 00 00 00 00 00 e5 7a 80 00 00 00 00 00     .|.......z......
+  80c808:	af 7b 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .{.......|......
+  80c818:	ff 7c 80 00 00 00 00 00 34 78 80 00 00 00 00 00     .|......4x......
+  80c828:	ff 7c 80 00 00 00 00 00 11 7a 80 00 00 00 00 00     .|.......z......
+  80c838:	ff 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     .|.......|......
+  80c848:	22 7c 80 00 00 00 00 00 ff 7c 80 00 00 00 00 00     "|.......|......
+  80c858:	c7 76 80 00 00 00 00 00                             .v......
+
+000000000080c860 <error_string>:
+	...
+  80c868:	0d c4 80 00 00 00 00 00 1f c4 80 00 00 00 00 00     ................
+  80c878:	2f c4 80 00 00 00 00 00 41 c4 80 00 00 00 00 00     /.......A.......
+  80c888:	4f c4 80 00 00 00 00 00 63 c4 80 00 00 00 00 00     O.......c.......
+  80c898:	78 c4 80 00 00 00 00 00 8b c4 80 00 00 00 00 00     x...............
+  80c8a8:	9d c4 80 00 00 00 00 00 b1 c4 80 00 00 00 00 00     ................
+  80c8b8:	c1 c4 80 00 00 00 00 00 d4 c4 80 00 00 00 00 00     ................
+  80c8c8:	eb c4 80 00 00 00 00 00 01 c5 80 00 00 00 00 00     ................
+  80c8d8:	19 c5 80 00 00 00 00 00 31 c5 80 00 00 00 00 00     ........1.......
+  80c8e8:	3e c5 80 00 00 00 00 00 18 c9 80 00 00 00 00 00     >...............
+  80c8f8:	52 c5 80 00 00 00 00 00 6a c5 80 00 00 00 00 00     R.......j.......
+  80c908:	74 c5 80 00 00 00 00 00 7e c5 80 00 00 00 00 00     t.......~.......
+  80c918:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  80c928:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  80c938:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  80c948:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  80c958:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  80c968:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  80c978:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  80c988:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  80c998:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  80c9a8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  80c9b8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  80c9c8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  80c9d8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  80c9e8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 90     %i..lib/ipc.c.f.
+  80c9f8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  80ca08:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  80ca18:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  80ca28:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  80ca38:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  80ca48:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  80ca58:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  80ca68:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  80ca78:	00 00 00 00 0f 1f 40 00                             ......@.
+
+000000000080ca80 <devtab>:
+  80ca80:	c0 30 81 00 00 00 00 00 00 31 81 00 00 00 00 00     .0.......1......
+  80ca90:	40 31 81 00 00 00 00 00 00 00 00 00 00 00 00 00     @1..............
+  80caa0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  80cab0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  80cac0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  80cad0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  80cae0:	73 3e 00 63 6f 6e 73 00 66 2e 0f 1f 84 00 00 00     s>.cons.f.......
+  80caf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cb00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cb10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cb20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cb30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cb40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cb50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cb60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cb70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cb80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cb90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cbb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cbc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cbd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cbe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cbf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cc00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cc10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cc20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cc30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cc40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cc50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cc60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cc70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cc80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cc90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80ccb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80ccc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80ccd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80ccf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cd00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cd10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cd20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cd30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cd40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cd50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cd60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cd70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cd80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cd90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cda0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cdb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cdc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cdd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cde0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cdf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80ce00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80ce10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80ce20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80ce30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80ce40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80ce50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80ce60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80ce70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80ce80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80ce90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80ceb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80ced0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cf00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cf10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cf20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cf30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cf40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cf50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cf60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cf70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cf80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cf90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cfa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  80cfb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  80cfc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  80cfd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  80cfe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  80cff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,8327 @@
+
+obj/user/allocbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0a 03 00 00       	call   80032d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+/* Report after every so many blocks */
+#define PHASE_BLOCKS 2048
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 28 04 00 00 	sub    $0x428,%rsp
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+  800039:	bf 03 00 00 00       	mov    $0x3,%edi
+  80003e:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  800045:	00 00 00 
+  800048:	ff d0                	call   *%rax
+    if (!fsenv) panic("no file server");
+  80004a:	85 c0                	test   %eax,%eax
+  80004c:	0f 84 97 00 00 00    	je     8000e9 <umain+0xc4>
+    const volatile struct Env *fs = &envs[ENVX(fsenv)];
+  800052:	89 c3                	mov    %eax,%ebx
+  800054:	81 e3 ff 03 00 00    	and    $0x3ff,%ebx
+
+    char path[MAXPATHLEN];
+    size_t nfiles = 0, nblocks = 0, phase_blocks = 0;
+    uint64_t fs_start = fs->env_cycles;
+  80005a:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005f:	48 89 c2             	mov    %rax,%rdx
+  800062:	48 c1 e2 04          	shl    $0x4,%rdx
+  800066:	48 29 c2             	sub    %rax,%rdx
+  800069:	48 89 d0             	mov    %rdx,%rax
+  80006c:	48 c1 e0 05          	shl    $0x5,%rax
+  800070:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800077:	00 00 00 
+  80007a:	48 01 d0             	add    %rdx,%rax
+  80007d:	48 8b 80 d0 01 00 00 	mov    0x1d0(%rax),%rax
+  800084:	48 89 85 b0 fb ff ff 	mov    %rax,-0x450(%rbp)
+    int res = 0;
+
+    memset(buf, 'x', sizeof(buf));
+  80008b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800090:	be 78 00 00 00       	mov    $0x78,%esi
+  800095:	48 bf 00 00 81 00 00 	movabs $0x810000,%rdi
+  80009c:	00 00 00 
+  80009f:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  8000a6:	00 00 00 
+  8000a9:	ff d0                	call   *%rax
+    int res = 0;
+  8000ab:	c7 85 cc fb ff ff 00 	movl   $0x0,-0x434(%rbp)
+  8000b2:	00 00 00 
+    size_t nfiles = 0, nblocks = 0, phase_blocks = 0;
+  8000b5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8000bb:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8000c1:	48 c7 85 c0 fb ff ff 	movq   $0x0,-0x440(%rbp)
+  8000c8:	00 00 00 00 
+            phase_blocks += res / BLKSIZE;
+        }
+        close(fd);
+
+        if (phase_blocks >= PHASE_BLOCKS || res < 0) {
+            uint64_t fs_cycles = fs->env_cycles - fs_start;
+  8000cc:	48 63 db             	movslq %ebx,%rbx
+  8000cf:	48 89 d8             	mov    %rbx,%rax
+  8000d2:	48 c1 e0 04          	shl    $0x4,%rax
+  8000d6:	48 29 d8             	sub    %rbx,%rax
+  8000d9:	48 c1 e0 05          	shl    $0x5,%rax
+  8000dd:	48 89 85 b8 fb ff ff 	mov    %rax,-0x448(%rbp)
+  8000e4:	e9 44 01 00 00       	jmp    80022d <umain+0x208>
+    if (!fsenv) panic("no file server");
+  8000e9:	48 ba 90 49 80 00 00 	movabs $0x804990,%rdx
+  8000f0:	00 00 00 
+  8000f3:	be 14 00 00 00       	mov    $0x14,%esi
+  8000f8:	48 bf 9f 49 80 00 00 	movabs $0x80499f,%rdi
+  8000ff:	00 00 00 
+  800102:	48 b9 03 04 80 00 00 	movabs $0x800403,%rcx
+  800109:	00 00 00 
+  80010c:	ff d1                	call   *%rcx
+            left -= res;
+  80010e:	48 63 c8             	movslq %eax,%rcx
+            nblocks += res / BLKSIZE;
+  800111:	8d 90 ff 0f 00 00    	lea    0xfff(%rax),%edx
+  800117:	0f 48 c2             	cmovs  %edx,%eax
+  80011a:	c1 f8 0c             	sar    $0xc,%eax
+  80011d:	48 98                	cltq
+  80011f:	49 01 c5             	add    %rax,%r13
+            phase_blocks += res / BLKSIZE;
+  800122:	49 01 c4             	add    %rax,%r12
+        while (left && res >= 0) {
+  800125:	48 29 cb             	sub    %rcx,%rbx
+  800128:	0f 84 d6 00 00 00    	je     800204 <umain+0x1df>
+            size_t n = MIN(left, sizeof(buf));
+  80012e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800133:	48 39 d3             	cmp    %rdx,%rbx
+  800136:	48 0f 46 d3          	cmovbe %rbx,%rdx
+            if ((res = write(fd, buf, n)) < 0) break;
+  80013a:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  800141:	00 00 00 
+  800144:	44 89 f7             	mov    %r14d,%edi
+  800147:	41 ff d7             	call   *%r15
+  80014a:	89 85 cc fb ff ff    	mov    %eax,-0x434(%rbp)
+  800150:	85 c0                	test   %eax,%eax
+  800152:	78 0c                	js     800160 <umain+0x13b>
+            if (!res) res = -E_NO_DISK;
+  800154:	75 b8                	jne    80010e <umain+0xe9>
+  800156:	c7 85 cc fb ff ff f3 	movl   $0xfffffff3,-0x434(%rbp)
+  80015d:	ff ff ff 
+        close(fd);
+  800160:	44 89 f7             	mov    %r14d,%edi
+  800163:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+            uint64_t fs_cycles = fs->env_cycles - fs_start;
+  80016f:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800176:	00 00 00 
+  800179:	48 8b b5 b8 fb ff ff 	mov    -0x448(%rbp),%rsi
+  800180:	48 01 f0             	add    %rsi,%rax
+  800183:	48 8b 80 d0 01 00 00 	mov    0x1d0(%rax),%rax
+            cprintf("allocbench: %lu blocks in %lu files: %lu cycles per block\n",
+  80018a:	4d 85 e4             	test   %r12,%r12
+  80018d:	74 15                	je     8001a4 <umain+0x17f>
+            uint64_t fs_cycles = fs->env_cycles - fs_start;
+  80018f:	48 8b b5 b0 fb ff ff 	mov    -0x450(%rbp),%rsi
+  800196:	48 29 f0             	sub    %rsi,%rax
+            cprintf("allocbench: %lu blocks in %lu files: %lu cycles per block\n",
+  800199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80019e:	49 f7 f4             	div    %r12
+  8001a1:	49 89 c4             	mov    %rax,%r12
+  8001a4:	4c 89 e1             	mov    %r12,%rcx
+  8001a7:	48 8b 95 c0 fb ff ff 	mov    -0x440(%rbp),%rdx
+  8001ae:	4c 89 ee             	mov    %r13,%rsi
+  8001b1:	48 bf c8 49 80 00 00 	movabs $0x8049c8,%rdi
+  8001b8:	00 00 00 
+  8001bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c0:	49 b8 53 05 80 00 00 	movabs $0x800553,%r8
+  8001c7:	00 00 00 
+  8001ca:	41 ff d0             	call   *%r8
+                    (unsigned long)nblocks, (unsigned long)nfiles,
+                    (unsigned long)(phase_blocks ? fs_cycles / phase_blocks : 0));
+            fs_start = fs->env_cycles;
+  8001cd:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8001d4:	00 00 00 
+  8001d7:	48 8b b5 b8 fb ff ff 	mov    -0x448(%rbp),%rsi
+  8001de:	48 01 f0             	add    %rsi,%rax
+  8001e1:	48 8b 80 d0 01 00 00 	mov    0x1d0(%rax),%rax
+  8001e8:	48 89 85 b0 fb ff ff 	mov    %rax,-0x450(%rbp)
+    while (res >= 0) {
+  8001ef:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8001f6:	0f 88 c6 00 00 00    	js     8002c2 <umain+0x29d>
+            phase_blocks = 0;
+  8001fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800202:	eb 29                	jmp    80022d <umain+0x208>
+        close(fd);
+  800204:	44 89 f7             	mov    %r14d,%edi
+  800207:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+        if (phase_blocks >= PHASE_BLOCKS || res < 0) {
+  800213:	49 81 fc ff 07 00 00 	cmp    $0x7ff,%r12
+  80021a:	0f 87 4f ff ff ff    	ja     80016f <umain+0x14a>
+  800220:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  800227:	0f 88 42 ff ff ff    	js     80016f <umain+0x14a>
+        snprintf(path, sizeof(path), "/fill%u", (unsigned)nfiles);
+  80022d:	48 8b 9d c0 fb ff ff 	mov    -0x440(%rbp),%rbx
+  800234:	89 d9                	mov    %ebx,%ecx
+  800236:	48 ba b1 49 80 00 00 	movabs $0x8049b1,%rdx
+  80023d:	00 00 00 
+  800240:	be 00 04 00 00       	mov    $0x400,%esi
+  800245:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80024c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800251:	49 b8 fd 0d 80 00 00 	movabs $0x800dfd,%r8
+  800258:	00 00 00 
+  80025b:	41 ff d0             	call   *%r8
+        int fd = open(path, O_RDWR | O_CREAT | O_TRUNC);
+  80025e:	be 02 03 00 00       	mov    $0x302,%esi
+  800263:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80026a:	48 b8 24 32 80 00 00 	movabs $0x803224,%rax
+  800271:	00 00 00 
+  800274:	ff d0                	call   *%rax
+  800276:	41 89 c6             	mov    %eax,%r14d
+        if (fd < 0) {
+  800279:	85 c0                	test   %eax,%eax
+  80027b:	78 4c                	js     8002c9 <umain+0x2a4>
+        nfiles++;
+  80027d:	48 83 c3 01          	add    $0x1,%rbx
+  800281:	48 89 9d c0 fb ff ff 	mov    %rbx,-0x440(%rbp)
+        size_t left = sizes[nfiles % (sizeof(sizes) / sizeof(*sizes))] * BLKSIZE;
+  800288:	48 89 da             	mov    %rbx,%rdx
+  80028b:	83 e2 07             	and    $0x7,%edx
+  80028e:	48 b8 40 4a 80 00 00 	movabs $0x804a40,%rax
+  800295:	00 00 00 
+  800298:	48 8b 1c d0          	mov    (%rax,%rdx,8),%rbx
+        while (left && res >= 0) {
+  80029c:	48 c1 e3 0c          	shl    $0xc,%rbx
+  8002a0:	0f 84 5e ff ff ff    	je     800204 <umain+0x1df>
+  8002a6:	83 bd cc fb ff ff 00 	cmpl   $0x0,-0x434(%rbp)
+  8002ad:	0f 88 51 ff ff ff    	js     800204 <umain+0x1df>
+            if ((res = write(fd, buf, n)) < 0) break;
+  8002b3:	49 bf 71 1e 80 00 00 	movabs $0x801e71,%r15
+  8002ba:	00 00 00 
+  8002bd:	e9 6c fe ff ff       	jmp    80012e <umain+0x109>
+  8002c2:	44 8b b5 cc fb ff ff 	mov    -0x434(%rbp),%r14d
+        }
+    }
+
+    if (res != -E_NO_DISK) panic("allocbench: %i", res);
+  8002c9:	41 83 fe f3          	cmp    $0xfffffff3,%r14d
+  8002cd:	75 30                	jne    8002ff <umain+0x2da>
+    cprintf("allocbench: disk full after %lu blocks\n", (unsigned long)nblocks);
+  8002cf:	4c 89 ee             	mov    %r13,%rsi
+  8002d2:	48 bf 08 4a 80 00 00 	movabs $0x804a08,%rdi
+  8002d9:	00 00 00 
+  8002dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e1:	48 ba 53 05 80 00 00 	movabs $0x800553,%rdx
+  8002e8:	00 00 00 
+  8002eb:	ff d2                	call   *%rdx
+}
+  8002ed:	48 81 c4 28 04 00 00 	add    $0x428,%rsp
+  8002f4:	5b                   	pop    %rbx
+  8002f5:	41 5c                	pop    %r12
+  8002f7:	41 5d                	pop    %r13
+  8002f9:	41 5e                	pop    %r14
+  8002fb:	41 5f                	pop    %r15
+  8002fd:	5d                   	pop    %rbp
+  8002fe:	c3                   	ret
+    if (res != -E_NO_DISK) panic("allocbench: %i", res);
+  8002ff:	44 89 f1             	mov    %r14d,%ecx
+  800302:	48 ba b9 49 80 00 00 	movabs $0x8049b9,%rdx
+  800309:	00 00 00 
+  80030c:	be 3b 00 00 00       	mov    $0x3b,%esi
+  800311:	48 bf 9f 49 80 00 00 	movabs $0x80499f,%rdi
+  800318:	00 00 00 
+  80031b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800320:	49 b8 03 04 80 00 00 	movabs $0x800403,%r8
+  800327:	00 00 00 
+  80032a:	41 ff d0             	call   *%r8
+
+000000000080032d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80032d:	55                   	push   %rbp
+  80032e:	48 89 e5             	mov    %rsp,%rbp
+  800331:	41 56                	push   %r14
+  800333:	41 55                	push   %r13
+  800335:	41 54                	push   %r12
+  800337:	53                   	push   %rbx
+  800338:	41 89 fd             	mov    %edi,%r13d
+  80033b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80033e:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800345:	00 00 00 
+  800348:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80034f:	00 00 00 
+  800352:	48 39 c2             	cmp    %rax,%rdx
+  800355:	73 17                	jae    80036e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800357:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80035a:	49 89 c4             	mov    %rax,%r12
+  80035d:	48 83 c3 08          	add    $0x8,%rbx
+  800361:	b8 00 00 00 00       	mov    $0x0,%eax
+  800366:	ff 53 f8             	call   *-0x8(%rbx)
+  800369:	4c 39 e3             	cmp    %r12,%rbx
+  80036c:	72 ef                	jb     80035d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80036e:	48 b8 4a 13 80 00 00 	movabs $0x80134a,%rax
+  800375:	00 00 00 
+  800378:	ff d0                	call   *%rax
+  80037a:	89 c2                	mov    %eax,%edx
+  80037c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800382:	48 89 d0             	mov    %rdx,%rax
+  800385:	48 c1 e0 04          	shl    $0x4,%rax
+  800389:	48 29 d0             	sub    %rdx,%rax
+  80038c:	48 c1 e0 05          	shl    $0x5,%rax
+  800390:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800397:	00 00 00 
+  80039a:	48 01 d0             	add    %rdx,%rax
+  80039d:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  8003a4:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003a7:	45 85 ed             	test   %r13d,%r13d
+  8003aa:	7e 0d                	jle    8003b9 <libmain+0x8c>
+  8003ac:	49 8b 06             	mov    (%r14),%rax
+  8003af:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003b6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003b9:	4c 89 f6             	mov    %r14,%rsi
+  8003bc:	44 89 ef             	mov    %r13d,%edi
+  8003bf:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8003c6:	00 00 00 
+  8003c9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003cb:	48 b8 e0 03 80 00 00 	movabs $0x8003e0,%rax
+  8003d2:	00 00 00 
+  8003d5:	ff d0                	call   *%rax
+#endif
+}
+  8003d7:	5b                   	pop    %rbx
+  8003d8:	41 5c                	pop    %r12
+  8003da:	41 5d                	pop    %r13
+  8003dc:	41 5e                	pop    %r14
+  8003de:	5d                   	pop    %rbp
+  8003df:	c3                   	ret
+
+00000000008003e0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8003e0:	55                   	push   %rbp
+  8003e1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8003e4:	48 b8 f7 1b 80 00 00 	movabs $0x801bf7,%rax
+  8003eb:	00 00 00 
+  8003ee:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003f5:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  8003fc:	00 00 00 
+  8003ff:	ff d0                	call   *%rax
+}
+  800401:	5d                   	pop    %rbp
+  800402:	c3                   	ret
+
+0000000000800403 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800403:	55                   	push   %rbp
+  800404:	48 89 e5             	mov    %rsp,%rbp
+  800407:	41 56                	push   %r14
+  800409:	41 55                	push   %r13
+  80040b:	41 54                	push   %r12
+  80040d:	53                   	push   %rbx
+  80040e:	48 83 ec 50          	sub    $0x50,%rsp
+  800412:	49 89 fc             	mov    %rdi,%r12
+  800415:	41 89 f5             	mov    %esi,%r13d
+  800418:	48 89 d3             	mov    %rdx,%rbx
+  80041b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80041f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800423:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800427:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80042e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800432:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800436:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80043a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80043e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800445:	00 00 00 
+  800448:	4c 8b 30             	mov    (%rax),%r14
+  80044b:	48 b8 4a 13 80 00 00 	movabs $0x80134a,%rax
+  800452:	00 00 00 
+  800455:	ff d0                	call   *%rax
+  800457:	89 c6                	mov    %eax,%esi
+  800459:	45 89 e8             	mov    %r13d,%r8d
+  80045c:	4c 89 e1             	mov    %r12,%rcx
+  80045f:	4c 89 f2             	mov    %r14,%rdx
+  800462:	48 bf 90 4a 80 00 00 	movabs $0x804a90,%rdi
+  800469:	00 00 00 
+  80046c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800471:	49 bc 53 05 80 00 00 	movabs $0x800553,%r12
+  800478:	00 00 00 
+  80047b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80047e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800482:	48 89 df             	mov    %rbx,%rdi
+  800485:	48 b8 ef 04 80 00 00 	movabs $0x8004ef,%rax
+  80048c:	00 00 00 
+  80048f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800491:	48 bf c3 50 80 00 00 	movabs $0x8050c3,%rdi
+  800498:	00 00 00 
+  80049b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004a0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004a3:	cc                   	int3
+  8004a4:	eb fd                	jmp    8004a3 <_panic+0xa0>
+
+00000000008004a6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004a6:	55                   	push   %rbp
+  8004a7:	48 89 e5             	mov    %rsp,%rbp
+  8004aa:	53                   	push   %rbx
+  8004ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8004af:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004b2:	8b 06                	mov    (%rsi),%eax
+  8004b4:	8d 50 01             	lea    0x1(%rax),%edx
+  8004b7:	89 16                	mov    %edx,(%rsi)
+  8004b9:	48 98                	cltq
+  8004bb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004c0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004c6:	74 0a                	je     8004d2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004c8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004d0:	c9                   	leave
+  8004d1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004d2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8004d6:	be ff 00 00 00       	mov    $0xff,%esi
+  8004db:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8004e2:	00 00 00 
+  8004e5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8004e7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004ed:	eb d9                	jmp    8004c8 <putch+0x22>
+
+00000000008004ef <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004ef:	55                   	push   %rbp
+  8004f0:	48 89 e5             	mov    %rsp,%rbp
+  8004f3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004fa:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004fd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800504:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800509:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800511:	48 89 f1             	mov    %rsi,%rcx
+  800514:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80051b:	48 bf a6 04 80 00 00 	movabs $0x8004a6,%rdi
+  800522:	00 00 00 
+  800525:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  80052c:	00 00 00 
+  80052f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800531:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800538:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80053f:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  800546:	00 00 00 
+  800549:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80054b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800551:	c9                   	leave
+  800552:	c3                   	ret
+
+0000000000800553 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800553:	55                   	push   %rbp
+  800554:	48 89 e5             	mov    %rsp,%rbp
+  800557:	48 83 ec 50          	sub    $0x50,%rsp
+  80055b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80055f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800563:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800567:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80056b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80056f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800576:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80057a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80057e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800582:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800586:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80058a:	48 b8 ef 04 80 00 00 	movabs $0x8004ef,%rax
+  800591:	00 00 00 
+  800594:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800596:	c9                   	leave
+  800597:	c3                   	ret
+
+0000000000800598 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800598:	55                   	push   %rbp
+  800599:	48 89 e5             	mov    %rsp,%rbp
+  80059c:	41 57                	push   %r15
+  80059e:	41 56                	push   %r14
+  8005a0:	41 55                	push   %r13
+  8005a2:	41 54                	push   %r12
+  8005a4:	53                   	push   %rbx
+  8005a5:	48 83 ec 18          	sub    $0x18,%rsp
+  8005a9:	49 89 fc             	mov    %rdi,%r12
+  8005ac:	49 89 f5             	mov    %rsi,%r13
+  8005af:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005b3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005b6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005b9:	41 89 cf             	mov    %ecx,%r15d
+  8005bc:	4c 39 fa             	cmp    %r15,%rdx
+  8005bf:	73 5b                	jae    80061c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005c1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005c5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005c9:	85 db                	test   %ebx,%ebx
+  8005cb:	7e 0e                	jle    8005db <print_num+0x43>
+            putch(padc, put_arg);
+  8005cd:	4c 89 ee             	mov    %r13,%rsi
+  8005d0:	44 89 f7             	mov    %r14d,%edi
+  8005d3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8005d6:	83 eb 01             	sub    $0x1,%ebx
+  8005d9:	75 f2                	jne    8005cd <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8005db:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8005df:	48 b9 c4 4a 80 00 00 	movabs $0x804ac4,%rcx
+  8005e6:	00 00 00 
+  8005e9:	48 b8 b3 4a 80 00 00 	movabs $0x804ab3,%rax
+  8005f0:	00 00 00 
+  8005f3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800600:	49 f7 f7             	div    %r15
+  800603:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800607:	4c 89 ee             	mov    %r13,%rsi
+  80060a:	41 ff d4             	call   *%r12
+}
+  80060d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800611:	5b                   	pop    %rbx
+  800612:	41 5c                	pop    %r12
+  800614:	41 5d                	pop    %r13
+  800616:	41 5e                	pop    %r14
+  800618:	41 5f                	pop    %r15
+  80061a:	5d                   	pop    %rbp
+  80061b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80061c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800620:	ba 00 00 00 00       	mov    $0x0,%edx
+  800625:	49 f7 f7             	div    %r15
+  800628:	48 83 ec 08          	sub    $0x8,%rsp
+  80062c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800630:	52                   	push   %rdx
+  800631:	45 0f be c9          	movsbl %r9b,%r9d
+  800635:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800639:	48 89 c2             	mov    %rax,%rdx
+  80063c:	48 b8 98 05 80 00 00 	movabs $0x800598,%rax
+  800643:	00 00 00 
+  800646:	ff d0                	call   *%rax
+  800648:	48 83 c4 10          	add    $0x10,%rsp
+  80064c:	eb 8d                	jmp    8005db <print_num+0x43>
+
+000000000080064e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80064e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800652:	48 8b 06             	mov    (%rsi),%rax
+  800655:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800659:	73 0a                	jae    800665 <sprintputch+0x17>
+        *state->start++ = ch;
+  80065b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80065f:	48 89 16             	mov    %rdx,(%rsi)
+  800662:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800665:	c3                   	ret
+
+0000000000800666 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800666:	55                   	push   %rbp
+  800667:	48 89 e5             	mov    %rsp,%rbp
+  80066a:	48 83 ec 50          	sub    $0x50,%rsp
+  80066e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800672:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800676:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80067a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800681:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800685:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800689:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80068d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800691:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800695:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  80069c:	00 00 00 
+  80069f:	ff d0                	call   *%rax
+}
+  8006a1:	c9                   	leave
+  8006a2:	c3                   	ret
+
+00000000008006a3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006a3:	55                   	push   %rbp
+  8006a4:	48 89 e5             	mov    %rsp,%rbp
+  8006a7:	41 57                	push   %r15
+  8006a9:	41 56                	push   %r14
+  8006ab:	41 55                	push   %r13
+  8006ad:	41 54                	push   %r12
+  8006af:	53                   	push   %rbx
+  8006b0:	48 83 ec 38          	sub    $0x38,%rsp
+  8006b4:	49 89 fe             	mov    %rdi,%r14
+  8006b7:	49 89 f5             	mov    %rsi,%r13
+  8006ba:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006bd:	48 8b 01             	mov    (%rcx),%rax
+  8006c0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006c4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006cc:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006d0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8006d4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8006d8:	0f b6 3b             	movzbl (%rbx),%edi
+  8006db:	40 80 ff 25          	cmp    $0x25,%dil
+  8006df:	74 18                	je     8006f9 <vprintfmt+0x56>
+            if (!ch) return;
+  8006e1:	40 84 ff             	test   %dil,%dil
+  8006e4:	0f 84 b1 06 00 00    	je     800d9b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006ea:	40 0f b6 ff          	movzbl %dil,%edi
+  8006ee:	4c 89 ee             	mov    %r13,%rsi
+  8006f1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006f4:	4c 89 e3             	mov    %r12,%rbx
+  8006f7:	eb db                	jmp    8006d4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8006fe:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800702:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800707:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80070d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800714:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800718:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80071d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800722:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800725:	83 e8 23             	sub    $0x23,%eax
+  800728:	3c 57                	cmp    $0x57,%al
+  80072a:	0f 87 51 06 00 00    	ja     800d81 <vprintfmt+0x6de>
+  800730:	0f b6 c0             	movzbl %al,%eax
+  800733:	48 b9 80 4c 80 00 00 	movabs $0x804c80,%rcx
+  80073a:	00 00 00 
+  80073d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800740:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800743:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800747:	eb cf                	jmp    800718 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800749:	49 89 dc             	mov    %rbx,%r12
+  80074c:	be 01 00 00 00       	mov    $0x1,%esi
+  800751:	eb c5                	jmp    800718 <vprintfmt+0x75>
+            padc = ch;
+  800753:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800757:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80075a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80075d:	eb b9                	jmp    800718 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80075f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800762:	83 f8 2f             	cmp    $0x2f,%eax
+  800765:	77 24                	ja     80078b <vprintfmt+0xe8>
+  800767:	89 c1                	mov    %eax,%ecx
+  800769:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80076d:	83 c0 08             	add    $0x8,%eax
+  800770:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800773:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800776:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800779:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80077d:	79 99                	jns    800718 <vprintfmt+0x75>
+                width = precision;
+  80077f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800783:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800789:	eb 8d                	jmp    800718 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80078b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80078f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	eb da                	jmp    800773 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800799:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80079e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007a2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007a8:	3c 39                	cmp    $0x39,%al
+  8007aa:	77 1c                	ja     8007c8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ac:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007b0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007b4:	0f b6 c0             	movzbl %al,%eax
+  8007b7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007bc:	0f b6 03             	movzbl (%rbx),%eax
+  8007bf:	3c 39                	cmp    $0x39,%al
+  8007c1:	76 e9                	jbe    8007ac <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007c3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007c6:	eb b1                	jmp    800779 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007c8:	49 89 dc             	mov    %rbx,%r12
+  8007cb:	eb ac                	jmp    800779 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007cd:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007d0:	85 c9                	test   %ecx,%ecx
+  8007d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d7:	0f 49 c1             	cmovns %ecx,%eax
+  8007da:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8007dd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007e0:	e9 33 ff ff ff       	jmp    800718 <vprintfmt+0x75>
+            lflag++;
+  8007e5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8007e8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007eb:	e9 28 ff ff ff       	jmp    800718 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007f0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f3:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f6:	77 19                	ja     800811 <vprintfmt+0x16e>
+  8007f8:	89 c2                	mov    %eax,%edx
+  8007fa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fe:	83 c0 08             	add    $0x8,%eax
+  800801:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800804:	8b 3a                	mov    (%rdx),%edi
+  800806:	4c 89 ee             	mov    %r13,%rsi
+  800809:	41 ff d6             	call   *%r14
+            break;
+  80080c:	e9 c3 fe ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800811:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800815:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800819:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80081d:	eb e5                	jmp    800804 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80081f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800822:	83 f8 2f             	cmp    $0x2f,%eax
+  800825:	77 5a                	ja     800881 <vprintfmt+0x1de>
+  800827:	89 c2                	mov    %eax,%edx
+  800829:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082d:	83 c0 08             	add    $0x8,%eax
+  800830:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800833:	8b 02                	mov    (%rdx),%eax
+  800835:	89 c1                	mov    %eax,%ecx
+  800837:	f7 d9                	neg    %ecx
+  800839:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80083c:	83 f9 16             	cmp    $0x16,%ecx
+  80083f:	7f 4e                	jg     80088f <vprintfmt+0x1ec>
+  800841:	48 63 c1             	movslq %ecx,%rax
+  800844:	48 ba 40 4f 80 00 00 	movabs $0x804f40,%rdx
+  80084b:	00 00 00 
+  80084e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800852:	48 85 c0             	test   %rax,%rax
+  800855:	74 38                	je     80088f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800857:	48 89 c1             	mov    %rax,%rcx
+  80085a:	48 ba 39 51 80 00 00 	movabs $0x805139,%rdx
+  800861:	00 00 00 
+  800864:	4c 89 ee             	mov    %r13,%rsi
+  800867:	4c 89 f7             	mov    %r14,%rdi
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	49 b8 66 06 80 00 00 	movabs $0x800666,%r8
+  800876:	00 00 00 
+  800879:	41 ff d0             	call   *%r8
+  80087c:	e9 53 fe ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800881:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800885:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800889:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088d:	eb a4                	jmp    800833 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80088f:	48 ba dc 4a 80 00 00 	movabs $0x804adc,%rdx
+  800896:	00 00 00 
+  800899:	4c 89 ee             	mov    %r13,%rsi
+  80089c:	4c 89 f7             	mov    %r14,%rdi
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	49 b8 66 06 80 00 00 	movabs $0x800666,%r8
+  8008ab:	00 00 00 
+  8008ae:	41 ff d0             	call   *%r8
+  8008b1:	e9 1e fe ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bc:	77 6c                	ja     80092a <vprintfmt+0x287>
+  8008be:	89 c2                	mov    %eax,%edx
+  8008c0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c4:	83 c0 08             	add    $0x8,%eax
+  8008c7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ca:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008cd:	48 85 d2             	test   %rdx,%rdx
+  8008d0:	48 b8 d5 4a 80 00 00 	movabs $0x804ad5,%rax
+  8008d7:	00 00 00 
+  8008da:	48 0f 45 c2          	cmovne %rdx,%rax
+  8008de:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8008e2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8008e6:	7e 06                	jle    8008ee <vprintfmt+0x24b>
+  8008e8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008ec:	75 4a                	jne    800938 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008ee:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008f2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008f6:	0f b6 00             	movzbl (%rax),%eax
+  8008f9:	84 c0                	test   %al,%al
+  8008fb:	0f 85 9a 00 00 00    	jne    80099b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800901:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800904:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800908:	85 c0                	test   %eax,%eax
+  80090a:	0f 8e c4 fd ff ff    	jle    8006d4 <vprintfmt+0x31>
+  800910:	4c 89 ee             	mov    %r13,%rsi
+  800913:	bf 20 00 00 00       	mov    $0x20,%edi
+  800918:	41 ff d6             	call   *%r14
+  80091b:	41 83 ec 01          	sub    $0x1,%r12d
+  80091f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800923:	75 eb                	jne    800910 <vprintfmt+0x26d>
+  800925:	e9 aa fd ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80092a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800932:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800936:	eb 92                	jmp    8008ca <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800938:	49 63 f7             	movslq %r15d,%rsi
+  80093b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80093f:	48 b8 55 0e 80 00 00 	movabs $0x800e55,%rax
+  800946:	00 00 00 
+  800949:	ff d0                	call   *%rax
+  80094b:	48 89 c2             	mov    %rax,%rdx
+  80094e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800951:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800953:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800956:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800959:	85 c0                	test   %eax,%eax
+  80095b:	7e 91                	jle    8008ee <vprintfmt+0x24b>
+  80095d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800962:	4c 89 ee             	mov    %r13,%rsi
+  800965:	44 89 e7             	mov    %r12d,%edi
+  800968:	41 ff d6             	call   *%r14
+  80096b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80096f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800972:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800975:	75 eb                	jne    800962 <vprintfmt+0x2bf>
+  800977:	e9 72 ff ff ff       	jmp    8008ee <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80097c:	0f b6 f8             	movzbl %al,%edi
+  80097f:	4c 89 ee             	mov    %r13,%rsi
+  800982:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800985:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800989:	49 83 c4 01          	add    $0x1,%r12
+  80098d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800993:	84 c0                	test   %al,%al
+  800995:	0f 84 66 ff ff ff    	je     800901 <vprintfmt+0x25e>
+  80099b:	45 85 ff             	test   %r15d,%r15d
+  80099e:	78 0a                	js     8009aa <vprintfmt+0x307>
+  8009a0:	41 83 ef 01          	sub    $0x1,%r15d
+  8009a4:	0f 88 57 ff ff ff    	js     800901 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009aa:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ae:	74 cc                	je     80097c <vprintfmt+0x2d9>
+  8009b0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009b3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009b8:	80 fa 5e             	cmp    $0x5e,%dl
+  8009bb:	77 c2                	ja     80097f <vprintfmt+0x2dc>
+  8009bd:	eb bd                	jmp    80097c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bf:	40 84 f6             	test   %sil,%sil
+  8009c2:	75 26                	jne    8009ea <vprintfmt+0x347>
+    switch (lflag) {
+  8009c4:	85 d2                	test   %edx,%edx
+  8009c6:	74 59                	je     800a21 <vprintfmt+0x37e>
+  8009c8:	83 fa 01             	cmp    $0x1,%edx
+  8009cb:	74 7b                	je     800a48 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009cd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d3:	0f 87 96 00 00 00    	ja     800a6f <vprintfmt+0x3cc>
+  8009d9:	89 c2                	mov    %eax,%edx
+  8009db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009df:	83 c0 08             	add    $0x8,%eax
+  8009e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e5:	4c 8b 22             	mov    (%rdx),%r12
+  8009e8:	eb 17                	jmp    800a01 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ed:	83 f8 2f             	cmp    $0x2f,%eax
+  8009f0:	77 21                	ja     800a13 <vprintfmt+0x370>
+  8009f2:	89 c2                	mov    %eax,%edx
+  8009f4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f8:	83 c0 08             	add    $0x8,%eax
+  8009fb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fe:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a01:	4d 85 e4             	test   %r12,%r12
+  800a04:	78 7a                	js     800a80 <vprintfmt+0x3dd>
+            num = i;
+  800a06:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a09:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a0e:	e9 50 02 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a1f:	eb dd                	jmp    8009fe <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a24:	83 f8 2f             	cmp    $0x2f,%eax
+  800a27:	77 11                	ja     800a3a <vprintfmt+0x397>
+  800a29:	89 c2                	mov    %eax,%edx
+  800a2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2f:	83 c0 08             	add    $0x8,%eax
+  800a32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a35:	4c 63 22             	movslq (%rdx),%r12
+  800a38:	eb c7                	jmp    800a01 <vprintfmt+0x35e>
+  800a3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a46:	eb ed                	jmp    800a35 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a48:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4e:	77 11                	ja     800a61 <vprintfmt+0x3be>
+  800a50:	89 c2                	mov    %eax,%edx
+  800a52:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a56:	83 c0 08             	add    $0x8,%eax
+  800a59:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5c:	4c 8b 22             	mov    (%rdx),%r12
+  800a5f:	eb a0                	jmp    800a01 <vprintfmt+0x35e>
+  800a61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6d:	eb ed                	jmp    800a5c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7b:	e9 65 ff ff ff       	jmp    8009e5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a80:	4c 89 ee             	mov    %r13,%rsi
+  800a83:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a88:	41 ff d6             	call   *%r14
+                i = -i;
+  800a8b:	49 f7 dc             	neg    %r12
+  800a8e:	e9 73 ff ff ff       	jmp    800a06 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a93:	40 84 f6             	test   %sil,%sil
+  800a96:	75 32                	jne    800aca <vprintfmt+0x427>
+    switch (lflag) {
+  800a98:	85 d2                	test   %edx,%edx
+  800a9a:	74 5d                	je     800af9 <vprintfmt+0x456>
+  800a9c:	83 fa 01             	cmp    $0x1,%edx
+  800a9f:	0f 84 82 00 00 00    	je     800b27 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aab:	0f 87 a5 00 00 00    	ja     800b56 <vprintfmt+0x4b3>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ac0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac5:	e9 99 01 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acd:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad0:	77 19                	ja     800aeb <vprintfmt+0x448>
+  800ad2:	89 c2                	mov    %eax,%edx
+  800ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad8:	83 c0 08             	add    $0x8,%eax
+  800adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ade:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ae1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae6:	e9 78 01 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+  800aeb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af7:	eb e5                	jmp    800ade <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afc:	83 f8 2f             	cmp    $0x2f,%eax
+  800aff:	77 18                	ja     800b19 <vprintfmt+0x476>
+  800b01:	89 c2                	mov    %eax,%edx
+  800b03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b07:	83 c0 08             	add    $0x8,%eax
+  800b0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b0f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b14:	e9 4a 01 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+  800b19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b25:	eb e6                	jmp    800b0d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2d:	77 19                	ja     800b48 <vprintfmt+0x4a5>
+  800b2f:	89 c2                	mov    %eax,%edx
+  800b31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b35:	83 c0 08             	add    $0x8,%eax
+  800b38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b3b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b3e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b43:	e9 1b 01 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+  800b48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b54:	eb e5                	jmp    800b3b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b62:	e9 56 ff ff ff       	jmp    800abd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b67:	40 84 f6             	test   %sil,%sil
+  800b6a:	75 2e                	jne    800b9a <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b6c:	85 d2                	test   %edx,%edx
+  800b6e:	74 59                	je     800bc9 <vprintfmt+0x526>
+  800b70:	83 fa 01             	cmp    $0x1,%edx
+  800b73:	74 7f                	je     800bf4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b78:	83 f8 2f             	cmp    $0x2f,%eax
+  800b7b:	0f 87 9f 00 00 00    	ja     800c20 <vprintfmt+0x57d>
+  800b81:	89 c2                	mov    %eax,%edx
+  800b83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b87:	83 c0 08             	add    $0x8,%eax
+  800b8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b90:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b95:	e9 c9 00 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b9d:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba0:	77 19                	ja     800bbb <vprintfmt+0x518>
+  800ba2:	89 c2                	mov    %eax,%edx
+  800ba4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba8:	83 c0 08             	add    $0x8,%eax
+  800bab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bae:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bb1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bb6:	e9 a8 00 00 00       	jmp    800c63 <vprintfmt+0x5c0>
+  800bbb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bbf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc7:	eb e5                	jmp    800bae <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bc9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bcc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bcf:	77 15                	ja     800be6 <vprintfmt+0x543>
+  800bd1:	89 c2                	mov    %eax,%edx
+  800bd3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd7:	83 c0 08             	add    $0x8,%eax
+  800bda:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bdd:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800bdf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800be4:	eb 7d                	jmp    800c63 <vprintfmt+0x5c0>
+  800be6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf2:	eb e9                	jmp    800bdd <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800bf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfa:	77 16                	ja     800c12 <vprintfmt+0x56f>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c02:	83 c0 08             	add    $0x8,%eax
+  800c05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c10:	eb 51                	jmp    800c63 <vprintfmt+0x5c0>
+  800c12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1e:	eb e8                	jmp    800c08 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2c:	e9 5c ff ff ff       	jmp    800b8d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c31:	4c 89 ee             	mov    %r13,%rsi
+  800c34:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c39:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c3c:	4c 89 ee             	mov    %r13,%rsi
+  800c3f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c44:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c47:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c4d:	77 47                	ja     800c96 <vprintfmt+0x5f3>
+  800c4f:	89 c2                	mov    %eax,%edx
+  800c51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c55:	83 c0 08             	add    $0x8,%eax
+  800c58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c5e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c63:	48 83 ec 08          	sub    $0x8,%rsp
+  800c67:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c6b:	0f 94 c0             	sete   %al
+  800c6e:	0f b6 c0             	movzbl %al,%eax
+  800c71:	50                   	push   %rax
+  800c72:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c77:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c7b:	4c 89 ee             	mov    %r13,%rsi
+  800c7e:	4c 89 f7             	mov    %r14,%rdi
+  800c81:	48 b8 98 05 80 00 00 	movabs $0x800598,%rax
+  800c88:	00 00 00 
+  800c8b:	ff d0                	call   *%rax
+            break;
+  800c8d:	48 83 c4 10          	add    $0x10,%rsp
+  800c91:	e9 3e fa ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca2:	eb b7                	jmp    800c5b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ca4:	40 84 f6             	test   %sil,%sil
+  800ca7:	75 2b                	jne    800cd4 <vprintfmt+0x631>
+    switch (lflag) {
+  800ca9:	85 d2                	test   %edx,%edx
+  800cab:	74 56                	je     800d03 <vprintfmt+0x660>
+  800cad:	83 fa 01             	cmp    $0x1,%edx
+  800cb0:	74 7f                	je     800d31 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cb8:	0f 87 a2 00 00 00    	ja     800d60 <vprintfmt+0x6bd>
+  800cbe:	89 c2                	mov    %eax,%edx
+  800cc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc4:	83 c0 08             	add    $0x8,%eax
+  800cc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ccd:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cd2:	eb 8f                	jmp    800c63 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd7:	83 f8 2f             	cmp    $0x2f,%eax
+  800cda:	77 19                	ja     800cf5 <vprintfmt+0x652>
+  800cdc:	89 c2                	mov    %eax,%edx
+  800cde:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce2:	83 c0 08             	add    $0x8,%eax
+  800ce5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ceb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cf0:	e9 6e ff ff ff       	jmp    800c63 <vprintfmt+0x5c0>
+  800cf5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d01:	eb e5                	jmp    800ce8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d06:	83 f8 2f             	cmp    $0x2f,%eax
+  800d09:	77 18                	ja     800d23 <vprintfmt+0x680>
+  800d0b:	89 c2                	mov    %eax,%edx
+  800d0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d11:	83 c0 08             	add    $0x8,%eax
+  800d14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d17:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d19:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d1e:	e9 40 ff ff ff       	jmp    800c63 <vprintfmt+0x5c0>
+  800d23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2f:	eb e6                	jmp    800d17 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d34:	83 f8 2f             	cmp    $0x2f,%eax
+  800d37:	77 19                	ja     800d52 <vprintfmt+0x6af>
+  800d39:	89 c2                	mov    %eax,%edx
+  800d3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3f:	83 c0 08             	add    $0x8,%eax
+  800d42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d45:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d48:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d4d:	e9 11 ff ff ff       	jmp    800c63 <vprintfmt+0x5c0>
+  800d52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5e:	eb e5                	jmp    800d45 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6c:	e9 59 ff ff ff       	jmp    800cca <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d71:	4c 89 ee             	mov    %r13,%rsi
+  800d74:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d79:	41 ff d6             	call   *%r14
+            break;
+  800d7c:	e9 53 f9 ff ff       	jmp    8006d4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d81:	4c 89 ee             	mov    %r13,%rsi
+  800d84:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d89:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d8c:	48 83 eb 01          	sub    $0x1,%rbx
+  800d90:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d94:	75 f6                	jne    800d8c <vprintfmt+0x6e9>
+  800d96:	e9 39 f9 ff ff       	jmp    8006d4 <vprintfmt+0x31>
+}
+  800d9b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d9f:	5b                   	pop    %rbx
+  800da0:	41 5c                	pop    %r12
+  800da2:	41 5d                	pop    %r13
+  800da4:	41 5e                	pop    %r14
+  800da6:	41 5f                	pop    %r15
+  800da8:	5d                   	pop    %rbp
+  800da9:	c3                   	ret
+
+0000000000800daa <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800daa:	55                   	push   %rbp
+  800dab:	48 89 e5             	mov    %rsp,%rbp
+  800dae:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800db2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800db6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dbb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dbf:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800dc6:	48 85 ff             	test   %rdi,%rdi
+  800dc9:	74 2b                	je     800df6 <vsnprintf+0x4c>
+  800dcb:	48 85 f6             	test   %rsi,%rsi
+  800dce:	74 26                	je     800df6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dd0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800dd4:	48 bf 4e 06 80 00 00 	movabs $0x80064e,%rdi
+  800ddb:	00 00 00 
+  800dde:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800dea:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800dee:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800df1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800df4:	c9                   	leave
+  800df5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800df6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800dfb:	eb f7                	jmp    800df4 <vsnprintf+0x4a>
+
+0000000000800dfd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800dfd:	55                   	push   %rbp
+  800dfe:	48 89 e5             	mov    %rsp,%rbp
+  800e01:	48 83 ec 50          	sub    $0x50,%rsp
+  800e05:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e09:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e0d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e11:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e18:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e20:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e24:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e28:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e2c:	48 b8 aa 0d 80 00 00 	movabs $0x800daa,%rax
+  800e33:	00 00 00 
+  800e36:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e38:	c9                   	leave
+  800e39:	c3                   	ret
+
+0000000000800e3a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e3a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e3d:	74 10                	je     800e4f <strlen+0x15>
+    size_t n = 0;
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e44:	48 83 c0 01          	add    $0x1,%rax
+  800e48:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e4c:	75 f6                	jne    800e44 <strlen+0xa>
+  800e4e:	c3                   	ret
+    size_t n = 0;
+  800e4f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e54:	c3                   	ret
+
+0000000000800e55 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e55:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e58:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e5d:	48 85 f6             	test   %rsi,%rsi
+  800e60:	74 11                	je     800e73 <strnlen+0x1e>
+  800e62:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e66:	74 0c                	je     800e74 <strnlen+0x1f>
+  800e68:	48 83 c2 01          	add    $0x1,%rdx
+  800e6c:	48 39 d0             	cmp    %rdx,%rax
+  800e6f:	75 f1                	jne    800e62 <strnlen+0xd>
+  800e71:	eb 04                	jmp    800e77 <strnlen+0x22>
+  800e73:	c3                   	ret
+  800e74:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e77:	c3                   	ret
+
+0000000000800e78 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e78:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e80:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e84:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e87:	48 83 c2 01          	add    $0x1,%rdx
+  800e8b:	84 c9                	test   %cl,%cl
+  800e8d:	75 f1                	jne    800e80 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e8f:	c3                   	ret
+
+0000000000800e90 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e90:	55                   	push   %rbp
+  800e91:	48 89 e5             	mov    %rsp,%rbp
+  800e94:	41 54                	push   %r12
+  800e96:	53                   	push   %rbx
+  800e97:	48 89 fb             	mov    %rdi,%rbx
+  800e9a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e9d:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ea9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ead:	4c 89 e6             	mov    %r12,%rsi
+  800eb0:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  800eb7:	00 00 00 
+  800eba:	ff d0                	call   *%rax
+    return dst;
+}
+  800ebc:	48 89 d8             	mov    %rbx,%rax
+  800ebf:	5b                   	pop    %rbx
+  800ec0:	41 5c                	pop    %r12
+  800ec2:	5d                   	pop    %rbp
+  800ec3:	c3                   	ret
+
+0000000000800ec4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ec4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ec7:	48 85 d2             	test   %rdx,%rdx
+  800eca:	74 1f                	je     800eeb <strncpy+0x27>
+  800ecc:	48 01 fa             	add    %rdi,%rdx
+  800ecf:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800ed2:	48 83 c1 01          	add    $0x1,%rcx
+  800ed6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800eda:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ede:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ee2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ee6:	48 39 ca             	cmp    %rcx,%rdx
+  800ee9:	75 e7                	jne    800ed2 <strncpy+0xe>
+    }
+    return ret;
+}
+  800eeb:	c3                   	ret
+
+0000000000800eec <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800eec:	48 89 f8             	mov    %rdi,%rax
+  800eef:	48 85 d2             	test   %rdx,%rdx
+  800ef2:	74 24                	je     800f18 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800ef4:	48 83 ea 01          	sub    $0x1,%rdx
+  800ef8:	74 1b                	je     800f15 <strlcpy+0x29>
+  800efa:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800efe:	0f b6 16             	movzbl (%rsi),%edx
+  800f01:	84 d2                	test   %dl,%dl
+  800f03:	74 10                	je     800f15 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f05:	48 83 c6 01          	add    $0x1,%rsi
+  800f09:	48 83 c0 01          	add    $0x1,%rax
+  800f0d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f10:	48 39 c8             	cmp    %rcx,%rax
+  800f13:	75 e9                	jne    800efe <strlcpy+0x12>
+        *dst = '\0';
+  800f15:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f18:	48 29 f8             	sub    %rdi,%rax
+}
+  800f1b:	c3                   	ret
+
+0000000000800f1c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f1c:	0f b6 07             	movzbl (%rdi),%eax
+  800f1f:	84 c0                	test   %al,%al
+  800f21:	74 13                	je     800f36 <strcmp+0x1a>
+  800f23:	38 06                	cmp    %al,(%rsi)
+  800f25:	75 0f                	jne    800f36 <strcmp+0x1a>
+  800f27:	48 83 c7 01          	add    $0x1,%rdi
+  800f2b:	48 83 c6 01          	add    $0x1,%rsi
+  800f2f:	0f b6 07             	movzbl (%rdi),%eax
+  800f32:	84 c0                	test   %al,%al
+  800f34:	75 ed                	jne    800f23 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f36:	0f b6 c0             	movzbl %al,%eax
+  800f39:	0f b6 16             	movzbl (%rsi),%edx
+  800f3c:	29 d0                	sub    %edx,%eax
+}
+  800f3e:	c3                   	ret
+
+0000000000800f3f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f3f:	48 85 d2             	test   %rdx,%rdx
+  800f42:	74 1f                	je     800f63 <strncmp+0x24>
+  800f44:	0f b6 07             	movzbl (%rdi),%eax
+  800f47:	84 c0                	test   %al,%al
+  800f49:	74 1e                	je     800f69 <strncmp+0x2a>
+  800f4b:	3a 06                	cmp    (%rsi),%al
+  800f4d:	75 1a                	jne    800f69 <strncmp+0x2a>
+  800f4f:	48 83 c7 01          	add    $0x1,%rdi
+  800f53:	48 83 c6 01          	add    $0x1,%rsi
+  800f57:	48 83 ea 01          	sub    $0x1,%rdx
+  800f5b:	75 e7                	jne    800f44 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f62:	c3                   	ret
+  800f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f68:	c3                   	ret
+  800f69:	48 85 d2             	test   %rdx,%rdx
+  800f6c:	74 09                	je     800f77 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f6e:	0f b6 07             	movzbl (%rdi),%eax
+  800f71:	0f b6 16             	movzbl (%rsi),%edx
+  800f74:	29 d0                	sub    %edx,%eax
+  800f76:	c3                   	ret
+    if (!n) return 0;
+  800f77:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f7c:	c3                   	ret
+
+0000000000800f7d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f7d:	0f b6 17             	movzbl (%rdi),%edx
+  800f80:	84 d2                	test   %dl,%dl
+  800f82:	74 18                	je     800f9c <strchr+0x1f>
+        if (*str == c) {
+  800f84:	0f be d2             	movsbl %dl,%edx
+  800f87:	39 f2                	cmp    %esi,%edx
+  800f89:	74 17                	je     800fa2 <strchr+0x25>
+    for (; *str; str++) {
+  800f8b:	48 83 c7 01          	add    $0x1,%rdi
+  800f8f:	0f b6 17             	movzbl (%rdi),%edx
+  800f92:	84 d2                	test   %dl,%dl
+  800f94:	75 ee                	jne    800f84 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f9b:	c3                   	ret
+  800f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa1:	c3                   	ret
+  800fa2:	48 89 f8             	mov    %rdi,%rax
+}
+  800fa5:	c3                   	ret
+
+0000000000800fa6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fa6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fa9:	0f b6 17             	movzbl (%rdi),%edx
+  800fac:	84 d2                	test   %dl,%dl
+  800fae:	74 13                	je     800fc3 <strfind+0x1d>
+  800fb0:	0f be d2             	movsbl %dl,%edx
+  800fb3:	39 f2                	cmp    %esi,%edx
+  800fb5:	74 0b                	je     800fc2 <strfind+0x1c>
+  800fb7:	48 83 c0 01          	add    $0x1,%rax
+  800fbb:	0f b6 10             	movzbl (%rax),%edx
+  800fbe:	84 d2                	test   %dl,%dl
+  800fc0:	75 ee                	jne    800fb0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fc2:	c3                   	ret
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800fc4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800fc7:	48 89 f8             	mov    %rdi,%rax
+  800fca:	48 f7 d8             	neg    %rax
+  800fcd:	83 e0 07             	and    $0x7,%eax
+  800fd0:	49 89 d1             	mov    %rdx,%r9
+  800fd3:	49 29 c1             	sub    %rax,%r9
+  800fd6:	78 36                	js     80100e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800fd8:	40 0f b6 c6          	movzbl %sil,%eax
+  800fdc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800fe3:	01 01 01 
+  800fe6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fea:	40 f6 c7 07          	test   $0x7,%dil
+  800fee:	75 38                	jne    801028 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800ff0:	4c 89 c9             	mov    %r9,%rcx
+  800ff3:	48 c1 f9 03          	sar    $0x3,%rcx
+  800ff7:	74 0c                	je     801005 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800ff9:	fc                   	cld
+  800ffa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ffd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801001:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801005:	4d 85 c9             	test   %r9,%r9
+  801008:	75 45                	jne    80104f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80100a:	4c 89 c0             	mov    %r8,%rax
+  80100d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80100e:	48 85 d2             	test   %rdx,%rdx
+  801011:	74 f7                	je     80100a <memset+0x46>
+  801013:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801016:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801019:	48 83 c0 01          	add    $0x1,%rax
+  80101d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801021:	48 39 c2             	cmp    %rax,%rdx
+  801024:	75 f3                	jne    801019 <memset+0x55>
+  801026:	eb e2                	jmp    80100a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801028:	40 f6 c7 01          	test   $0x1,%dil
+  80102c:	74 06                	je     801034 <memset+0x70>
+  80102e:	88 07                	mov    %al,(%rdi)
+  801030:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801034:	40 f6 c7 02          	test   $0x2,%dil
+  801038:	74 07                	je     801041 <memset+0x7d>
+  80103a:	66 89 07             	mov    %ax,(%rdi)
+  80103d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801041:	40 f6 c7 04          	test   $0x4,%dil
+  801045:	74 a9                	je     800ff0 <memset+0x2c>
+  801047:	89 07                	mov    %eax,(%rdi)
+  801049:	48 83 c7 04          	add    $0x4,%rdi
+  80104d:	eb a1                	jmp    800ff0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80104f:	41 f6 c1 04          	test   $0x4,%r9b
+  801053:	74 06                	je     80105b <memset+0x97>
+  801055:	89 07                	mov    %eax,(%rdi)
+  801057:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80105b:	41 f6 c1 02          	test   $0x2,%r9b
+  80105f:	74 07                	je     801068 <memset+0xa4>
+  801061:	66 89 07             	mov    %ax,(%rdi)
+  801064:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801068:	41 f6 c1 01          	test   $0x1,%r9b
+  80106c:	74 9c                	je     80100a <memset+0x46>
+  80106e:	88 07                	mov    %al,(%rdi)
+  801070:	eb 98                	jmp    80100a <memset+0x46>
+
+0000000000801072 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801072:	48 89 f8             	mov    %rdi,%rax
+  801075:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801078:	48 39 fe             	cmp    %rdi,%rsi
+  80107b:	73 3b                	jae    8010b8 <memmove+0x46>
+  80107d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801081:	48 39 d7             	cmp    %rdx,%rdi
+  801084:	73 32                	jae    8010b8 <memmove+0x46>
+        s += n;
+        d += n;
+  801086:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80108a:	48 89 d6             	mov    %rdx,%rsi
+  80108d:	48 09 fe             	or     %rdi,%rsi
+  801090:	48 09 ce             	or     %rcx,%rsi
+  801093:	40 f6 c6 07          	test   $0x7,%sil
+  801097:	75 12                	jne    8010ab <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801099:	48 83 ef 08          	sub    $0x8,%rdi
+  80109d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010a1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010a5:	fd                   	std
+  8010a6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010a9:	fc                   	cld
+  8010aa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010ab:	48 83 ef 01          	sub    $0x1,%rdi
+  8010af:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010b3:	fd                   	std
+  8010b4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010b6:	eb f1                	jmp    8010a9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010b8:	48 89 f2             	mov    %rsi,%rdx
+  8010bb:	48 09 c2             	or     %rax,%rdx
+  8010be:	48 09 ca             	or     %rcx,%rdx
+  8010c1:	f6 c2 07             	test   $0x7,%dl
+  8010c4:	75 0c                	jne    8010d2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010c6:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ca:	48 89 c7             	mov    %rax,%rdi
+  8010cd:	fc                   	cld
+  8010ce:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010d1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010d2:	48 89 c7             	mov    %rax,%rdi
+  8010d5:	fc                   	cld
+  8010d6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8010d8:	c3                   	ret
+
+00000000008010d9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8010d9:	55                   	push   %rbp
+  8010da:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8010dd:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  8010e4:	00 00 00 
+  8010e7:	ff d0                	call   *%rax
+}
+  8010e9:	5d                   	pop    %rbp
+  8010ea:	c3                   	ret
+
+00000000008010eb <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010eb:	55                   	push   %rbp
+  8010ec:	48 89 e5             	mov    %rsp,%rbp
+  8010ef:	41 57                	push   %r15
+  8010f1:	41 56                	push   %r14
+  8010f3:	41 55                	push   %r13
+  8010f5:	41 54                	push   %r12
+  8010f7:	53                   	push   %rbx
+  8010f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8010fc:	49 89 fe             	mov    %rdi,%r14
+  8010ff:	49 89 f7             	mov    %rsi,%r15
+  801102:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801105:	48 89 f7             	mov    %rsi,%rdi
+  801108:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  80110f:	00 00 00 
+  801112:	ff d0                	call   *%rax
+  801114:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801117:	48 89 de             	mov    %rbx,%rsi
+  80111a:	4c 89 f7             	mov    %r14,%rdi
+  80111d:	48 b8 55 0e 80 00 00 	movabs $0x800e55,%rax
+  801124:	00 00 00 
+  801127:	ff d0                	call   *%rax
+  801129:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80112c:	48 39 c3             	cmp    %rax,%rbx
+  80112f:	74 36                	je     801167 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801131:	48 89 d8             	mov    %rbx,%rax
+  801134:	4c 29 e8             	sub    %r13,%rax
+  801137:	49 39 c4             	cmp    %rax,%r12
+  80113a:	73 31                	jae    80116d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80113c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801141:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801145:	4c 89 fe             	mov    %r15,%rsi
+  801148:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80114f:	00 00 00 
+  801152:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801154:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801158:	48 83 c4 08          	add    $0x8,%rsp
+  80115c:	5b                   	pop    %rbx
+  80115d:	41 5c                	pop    %r12
+  80115f:	41 5d                	pop    %r13
+  801161:	41 5e                	pop    %r14
+  801163:	41 5f                	pop    %r15
+  801165:	5d                   	pop    %rbp
+  801166:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801167:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80116b:	eb eb                	jmp    801158 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80116d:	48 83 eb 01          	sub    $0x1,%rbx
+  801171:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801175:	48 89 da             	mov    %rbx,%rdx
+  801178:	4c 89 fe             	mov    %r15,%rsi
+  80117b:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  801182:	00 00 00 
+  801185:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801187:	49 01 de             	add    %rbx,%r14
+  80118a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80118f:	eb c3                	jmp    801154 <strlcat+0x69>
+
+0000000000801191 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801191:	48 85 d2             	test   %rdx,%rdx
+  801194:	74 2d                	je     8011c3 <memcmp+0x32>
+  801196:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80119b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80119f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011a4:	44 38 c1             	cmp    %r8b,%cl
+  8011a7:	75 0f                	jne    8011b8 <memcmp+0x27>
+    while (n-- > 0) {
+  8011a9:	48 83 c0 01          	add    $0x1,%rax
+  8011ad:	48 39 c2             	cmp    %rax,%rdx
+  8011b0:	75 e9                	jne    80119b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011b8:	0f b6 c1             	movzbl %cl,%eax
+  8011bb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011bf:	44 29 c0             	sub    %r8d,%eax
+  8011c2:	c3                   	ret
+    return 0;
+  8011c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011c8:	c3                   	ret
+
+00000000008011c9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011c9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011cd:	48 39 c7             	cmp    %rax,%rdi
+  8011d0:	73 0f                	jae    8011e1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011d2:	40 38 37             	cmp    %sil,(%rdi)
+  8011d5:	74 0e                	je     8011e5 <memfind+0x1c>
+    for (; src < end; src++) {
+  8011d7:	48 83 c7 01          	add    $0x1,%rdi
+  8011db:	48 39 f8             	cmp    %rdi,%rax
+  8011de:	75 f2                	jne    8011d2 <memfind+0x9>
+  8011e0:	c3                   	ret
+  8011e1:	48 89 f8             	mov    %rdi,%rax
+  8011e4:	c3                   	ret
+  8011e5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8011e8:	c3                   	ret
+
+00000000008011e9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8011e9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011ec:	0f b6 37             	movzbl (%rdi),%esi
+  8011ef:	40 80 fe 20          	cmp    $0x20,%sil
+  8011f3:	74 06                	je     8011fb <strtol+0x12>
+  8011f5:	40 80 fe 09          	cmp    $0x9,%sil
+  8011f9:	75 13                	jne    80120e <strtol+0x25>
+  8011fb:	48 83 c7 01          	add    $0x1,%rdi
+  8011ff:	0f b6 37             	movzbl (%rdi),%esi
+  801202:	40 80 fe 20          	cmp    $0x20,%sil
+  801206:	74 f3                	je     8011fb <strtol+0x12>
+  801208:	40 80 fe 09          	cmp    $0x9,%sil
+  80120c:	74 ed                	je     8011fb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80120e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801211:	83 e0 fd             	and    $0xfffffffd,%eax
+  801214:	3c 01                	cmp    $0x1,%al
+  801216:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80121a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801220:	75 0f                	jne    801231 <strtol+0x48>
+  801222:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801225:	74 14                	je     80123b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801227:	85 d2                	test   %edx,%edx
+  801229:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80122e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801231:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801236:	4c 63 ca             	movslq %edx,%r9
+  801239:	eb 36                	jmp    801271 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80123b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80123f:	74 0f                	je     801250 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801241:	85 d2                	test   %edx,%edx
+  801243:	75 ec                	jne    801231 <strtol+0x48>
+        s++;
+  801245:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801249:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80124e:	eb e1                	jmp    801231 <strtol+0x48>
+        s += 2;
+  801250:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801254:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801259:	eb d6                	jmp    801231 <strtol+0x48>
+            dig -= '0';
+  80125b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80125e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801262:	41 39 d0             	cmp    %edx,%r8d
+  801265:	7d 21                	jge    801288 <strtol+0x9f>
+        val = val * base + dig;
+  801267:	49 0f af c1          	imul   %r9,%rax
+  80126b:	0f b6 c9             	movzbl %cl,%ecx
+  80126e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801271:	48 83 c7 01          	add    $0x1,%rdi
+  801275:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801279:	80 f9 39             	cmp    $0x39,%cl
+  80127c:	76 dd                	jbe    80125b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80127e:	80 f9 7b             	cmp    $0x7b,%cl
+  801281:	77 05                	ja     801288 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801283:	83 e9 57             	sub    $0x57,%ecx
+  801286:	eb d6                	jmp    80125e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801288:	4d 85 d2             	test   %r10,%r10
+  80128b:	74 03                	je     801290 <strtol+0xa7>
+  80128d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801290:	48 89 c2             	mov    %rax,%rdx
+  801293:	48 f7 da             	neg    %rdx
+  801296:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80129a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80129e:	c3                   	ret
+
+000000000080129f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80129f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8012bb:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012bd:	c3                   	ret
+
+00000000008012be <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012c8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e4:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012e6:	c3                   	ret
+
+00000000008012e7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8012e7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ea:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012ef:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801305:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80130b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80130d:	48 85 c0             	test   %rax,%rax
+  801310:	7f 01                	jg     801313 <sys_env_destroy+0x2c>
+}
+  801312:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801313:	55                   	push   %rbp
+  801314:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801317:	49 89 c0             	mov    %rax,%r8
+  80131a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80131f:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801326:	00 00 00 
+  801329:	be 29 00 00 00       	mov    $0x29,%esi
+  80132e:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801335:	00 00 00 
+  801338:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133d:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801344:	00 00 00 
+  801347:	41 ff d1             	call   *%r9
+
+000000000080134a <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80134a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80134f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801354:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80136a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801370:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801372:	c3                   	ret
+
+0000000000801373 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801373:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801378:	bf 00 00 00 00       	mov    $0x0,%edi
+  80137d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801382:	ba 00 00 00 00       	mov    $0x0,%edx
+  801387:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80138d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801393:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801399:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80139b:	c3                   	ret
+
+000000000080139c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80139c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a1:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8013a8:	00 00 00 
+  8013ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bd:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013bf:	c3                   	ret
+
+00000000008013c0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013c0:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8013c3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d4:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8013d6:	c3                   	ret
+
+00000000008013d7 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8013d7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013da:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013df:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ee:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f0:	48 85 c0             	test   %rax,%rax
+  8013f3:	7f 01                	jg     8013f6 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013f5:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013f6:	55                   	push   %rbp
+  8013f7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fa:	49 89 c0             	mov    %rax,%r8
+  8013fd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801402:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801409:	00 00 00 
+  80140c:	be 29 00 00 00       	mov    $0x29,%esi
+  801411:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801418:	00 00 00 
+  80141b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801420:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801427:	00 00 00 
+  80142a:	41 ff d1             	call   *%r9
+
+000000000080142d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80142d:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801430:	48 63 d2             	movslq %edx,%rdx
+  801433:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143b:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80143e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801440:	48 85 c0             	test   %rax,%rax
+  801443:	7f 01                	jg     801446 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801445:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801446:	55                   	push   %rbp
+  801447:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144a:	49 89 c0             	mov    %rax,%r8
+  80144d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801452:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801459:	00 00 00 
+  80145c:	be 29 00 00 00       	mov    $0x29,%esi
+  801461:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801468:	00 00 00 
+  80146b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801470:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801477:	00 00 00 
+  80147a:	41 ff d1             	call   *%r9
+
+000000000080147d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80147d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801480:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801485:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80148b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801491:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801497:	0f 05                	syscall
+    if (check && ret > 0) {
+  801499:	48 85 c0             	test   %rax,%rax
+  80149c:	7f 01                	jg     80149f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80149e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80149f:	55                   	push   %rbp
+  8014a0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a3:	49 89 c0             	mov    %rax,%r8
+  8014a6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014ab:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8014b2:	00 00 00 
+  8014b5:	be 29 00 00 00       	mov    $0x29,%esi
+  8014ba:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8014c1:	00 00 00 
+  8014c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c9:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  8014d0:	00 00 00 
+  8014d3:	41 ff d1             	call   *%r9
+
+00000000008014d6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8014d6:	48 63 f6             	movslq %esi,%rsi
+  8014d9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014dc:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014f8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014fa:	48 85 c0             	test   %rax,%rax
+  8014fd:	7f 01                	jg     801500 <sys_env_set_status+0x2a>
+}
+  8014ff:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801500:	55                   	push   %rbp
+  801501:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801504:	49 89 c0             	mov    %rax,%r8
+  801507:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80150c:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801513:	00 00 00 
+  801516:	be 29 00 00 00       	mov    $0x29,%esi
+  80151b:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801522:	00 00 00 
+  801525:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152a:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801531:	00 00 00 
+  801534:	41 ff d1             	call   *%r9
+
+0000000000801537 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801537:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80153a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80153f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801544:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80154a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801550:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801556:	0f 05                	syscall
+    if (check && ret > 0) {
+  801558:	48 85 c0             	test   %rax,%rax
+  80155b:	7f 01                	jg     80155e <sys_env_set_trapframe+0x27>
+}
+  80155d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80155e:	55                   	push   %rbp
+  80155f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801562:	49 89 c0             	mov    %rax,%r8
+  801565:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80156a:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801571:	00 00 00 
+  801574:	be 29 00 00 00       	mov    $0x29,%esi
+  801579:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801580:	00 00 00 
+  801583:	b8 00 00 00 00       	mov    $0x0,%eax
+  801588:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  80158f:	00 00 00 
+  801592:	41 ff d1             	call   *%r9
+
+0000000000801595 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801595:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801598:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80159d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015a2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015b4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015b6:	48 85 c0             	test   %rax,%rax
+  8015b9:	7f 01                	jg     8015bc <sys_env_set_pgfault_upcall+0x27>
+}
+  8015bb:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015bc:	55                   	push   %rbp
+  8015bd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015c0:	49 89 c0             	mov    %rax,%r8
+  8015c3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015c8:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8015cf:	00 00 00 
+  8015d2:	be 29 00 00 00       	mov    $0x29,%esi
+  8015d7:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8015de:	00 00 00 
+  8015e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e6:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  8015ed:	00 00 00 
+  8015f0:	41 ff d1             	call   *%r9
+
+00000000008015f3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015f3:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015f6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015f9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015fe:	4d 63 c0             	movslq %r8d,%r8
+  801601:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801607:	0f 05                	syscall
+}
+  801609:	c3                   	ret
+
+000000000080160a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80160a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80160d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801610:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801615:	4d 63 c0             	movslq %r8d,%r8
+  801618:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80161e:	0f 05                	syscall
+}
+  801620:	c3                   	ret
+
+0000000000801621 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801621:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801626:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801629:	45 89 c0             	mov    %r8d,%r8d
+  80162c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801632:	0f 05                	syscall
+    if (check && ret > 0) {
+  801634:	48 85 c0             	test   %rax,%rax
+  801637:	7f 01                	jg     80163a <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801639:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80163a:	55                   	push   %rbp
+  80163b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163e:	49 89 c0             	mov    %rax,%r8
+  801641:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801646:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  80164d:	00 00 00 
+  801650:	be 29 00 00 00       	mov    $0x29,%esi
+  801655:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  80165c:	00 00 00 
+  80165f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801664:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  80166b:	00 00 00 
+  80166e:	41 ff d1             	call   *%r9
+
+0000000000801671 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801671:	55                   	push   %rbp
+  801672:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801675:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80167b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801680:	ba 00 00 00 00       	mov    $0x0,%edx
+  801685:	48 b8 21 16 80 00 00 	movabs $0x801621,%rax
+  80168c:	00 00 00 
+  80168f:	ff d0                	call   *%rax
+}
+  801691:	5d                   	pop    %rbp
+  801692:	c3                   	ret
+
+0000000000801693 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801693:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801698:	bf 00 00 00 00       	mov    $0x0,%edi
+  80169d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016b9:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016bb:	c3                   	ret
+
+00000000008016bc <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016bc:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016c1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016dd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016df:	48 85 c0             	test   %rax,%rax
+  8016e2:	7f 01                	jg     8016e5 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8016e4:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e9:	49 89 c0             	mov    %rax,%r8
+  8016ec:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016f1:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8016f8:	00 00 00 
+  8016fb:	be 29 00 00 00       	mov    $0x29,%esi
+  801700:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801707:	00 00 00 
+  80170a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170f:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801716:	00 00 00 
+  801719:	41 ff d1             	call   *%r9
+
+000000000080171c <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80171c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801721:	bf 00 00 00 00       	mov    $0x0,%edi
+  801726:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80172b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801730:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801736:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80173c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801742:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801744:	c3                   	ret
+
+0000000000801745 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801745:	89 d2                	mov    %edx,%edx
+  801747:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801749:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80174e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801754:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80175a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801760:	0f 05                	syscall
+}
+  801762:	c3                   	ret
+
+0000000000801763 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801763:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801766:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80176b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801770:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801776:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80177c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801782:	0f 05                	syscall
+}
+  801784:	c3                   	ret
+
+0000000000801785 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801785:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801788:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80178d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801792:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801798:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80179e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017a4:	0f 05                	syscall
+}
+  8017a6:	c3                   	ret
+
+00000000008017a7 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8017a7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017aa:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017af:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017cb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017cd:	48 85 c0             	test   %rax,%rax
+  8017d0:	7f 01                	jg     8017d3 <sys_irq_ack+0x2c>
+}
+  8017d2:	c3                   	ret
+sys_irq_ack(int irq) {
+  8017d3:	55                   	push   %rbp
+  8017d4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d7:	49 89 c0             	mov    %rax,%r8
+  8017da:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8017df:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8017e6:	00 00 00 
+  8017e9:	be 29 00 00 00       	mov    $0x29,%esi
+  8017ee:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8017f5:	00 00 00 
+  8017f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fd:	49 b9 03 04 80 00 00 	movabs $0x800403,%r9
+  801804:	00 00 00 
+  801807:	41 ff d1             	call   *%r9
+
+000000000080180a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80180a:	55                   	push   %rbp
+  80180b:	48 89 e5             	mov    %rsp,%rbp
+  80180e:	41 55                	push   %r13
+  801810:	41 54                	push   %r12
+  801812:	53                   	push   %rbx
+  801813:	48 83 ec 08          	sub    $0x8,%rsp
+  801817:	49 89 fd             	mov    %rdi,%r13
+  80181a:	48 89 f7             	mov    %rsi,%rdi
+  80181d:	48 89 d3             	mov    %rdx,%rbx
+  801820:	49 89 cc             	mov    %rcx,%r12
+  801823:	4c 89 c2             	mov    %r8,%rdx
+  801826:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801829:	48 85 f6             	test   %rsi,%rsi
+  80182c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801833:	00 00 00 
+  801836:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80183a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80183f:	48 85 db             	test   %rbx,%rbx
+  801842:	74 03                	je     801847 <ipc_recv_futex+0x3d>
+  801844:	48 8b 33             	mov    (%rbx),%rsi
+  801847:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80184b:	48 b8 21 16 80 00 00 	movabs $0x801621,%rax
+  801852:	00 00 00 
+  801855:	ff d0                	call   *%rax
+    if (res < 0) {
+  801857:	85 c0                	test   %eax,%eax
+  801859:	78 75                	js     8018d0 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80185b:	4d 85 ed             	test   %r13,%r13
+  80185e:	74 14                	je     801874 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  801860:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801867:	00 00 00 
+  80186a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801870:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801874:	4d 85 e4             	test   %r12,%r12
+  801877:	74 14                	je     80188d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  801879:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801880:	00 00 00 
+  801883:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  801889:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80188d:	48 85 db             	test   %rbx,%rbx
+  801890:	74 23                	je     8018b5 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801892:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801899:	00 00 00 
+  80189c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8018a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018a7:	85 c9                	test   %ecx,%ecx
+  8018a9:	74 07                	je     8018b2 <ipc_recv_futex+0xa8>
+  8018ab:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8018b2:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8018b5:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8018bc:	00 00 00 
+  8018bf:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8018c5:	48 83 c4 08          	add    $0x8,%rsp
+  8018c9:	5b                   	pop    %rbx
+  8018ca:	41 5c                	pop    %r12
+  8018cc:	41 5d                	pop    %r13
+  8018ce:	5d                   	pop    %rbp
+  8018cf:	c3                   	ret
+        if (from_env_store != NULL) {
+  8018d0:	4d 85 ed             	test   %r13,%r13
+  8018d3:	74 08                	je     8018dd <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8018d5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8018dc:	00 
+        if (perm_store != NULL) {
+  8018dd:	4d 85 e4             	test   %r12,%r12
+  8018e0:	74 08                	je     8018ea <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8018e2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8018e9:	00 
+        if (size != NULL) {
+  8018ea:	48 85 db             	test   %rbx,%rbx
+  8018ed:	74 d6                	je     8018c5 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8018ef:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8018f6:	eb cd                	jmp    8018c5 <ipc_recv_futex+0xbb>
+
+00000000008018f8 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8018f8:	55                   	push   %rbp
+  8018f9:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8018fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801900:	6a 00                	push   $0x0
+  801902:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801908:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80190e:	48 b8 0a 18 80 00 00 	movabs $0x80180a,%rax
+  801915:	00 00 00 
+  801918:	ff d0                	call   *%rax
+}
+  80191a:	c9                   	leave
+  80191b:	c3                   	ret
+
+000000000080191c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80191c:	55                   	push   %rbp
+  80191d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801920:	48 85 d2             	test   %rdx,%rdx
+  801923:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80192a:	00 00 00 
+  80192d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801931:	89 f6                	mov    %esi,%esi
+  801933:	48 b8 0a 16 80 00 00 	movabs $0x80160a,%rax
+  80193a:	00 00 00 
+  80193d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80193f:	85 c0                	test   %eax,%eax
+  801941:	78 02                	js     801945 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801943:	5d                   	pop    %rbp
+  801944:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801945:	89 c1                	mov    %eax,%ecx
+  801947:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  80194e:	00 00 00 
+  801951:	be 50 00 00 00       	mov    $0x50,%esi
+  801956:	48 bf 59 50 80 00 00 	movabs $0x805059,%rdi
+  80195d:	00 00 00 
+  801960:	b8 00 00 00 00       	mov    $0x0,%eax
+  801965:	49 b8 03 04 80 00 00 	movabs $0x800403,%r8
+  80196c:	00 00 00 
+  80196f:	41 ff d0             	call   *%r8
+
+0000000000801972 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801972:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801977:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80197e:	00 00 00 
+  801981:	48 89 d0             	mov    %rdx,%rax
+  801984:	48 c1 e0 04          	shl    $0x4,%rax
+  801988:	48 29 d0             	sub    %rdx,%rax
+  80198b:	48 c1 e0 05          	shl    $0x5,%rax
+  80198f:	48 01 c8             	add    %rcx,%rax
+  801992:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801998:	39 f8                	cmp    %edi,%eax
+  80199a:	74 13                	je     8019af <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80199c:	48 83 c2 01          	add    $0x1,%rdx
+  8019a0:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8019a7:	75 d8                	jne    801981 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8019a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ae:	c3                   	ret
+            return envs[i].env_id;
+  8019af:	48 89 d0             	mov    %rdx,%rax
+  8019b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8019b6:	48 29 d0             	sub    %rdx,%rax
+  8019b9:	48 c1 e0 05          	shl    $0x5,%rax
+  8019bd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019c4:	00 00 00 
+  8019c7:	48 01 d0             	add    %rdx,%rax
+  8019ca:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8019d0:	c3                   	ret
+
+00000000008019d1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019d1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019d8:	ff ff ff 
+  8019db:	48 01 f8             	add    %rdi,%rax
+  8019de:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8019e2:	c3                   	ret
+
+00000000008019e3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019e3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8019ea:	ff ff ff 
+  8019ed:	48 01 f8             	add    %rdi,%rax
+  8019f0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8019f4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8019fa:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8019fe:	c3                   	ret
+
+00000000008019ff <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019ff:	55                   	push   %rbp
+  801a00:	48 89 e5             	mov    %rsp,%rbp
+  801a03:	41 57                	push   %r15
+  801a05:	41 56                	push   %r14
+  801a07:	41 55                	push   %r13
+  801a09:	41 54                	push   %r12
+  801a0b:	53                   	push   %rbx
+  801a0c:	48 83 ec 08          	sub    $0x8,%rsp
+  801a10:	49 89 ff             	mov    %rdi,%r15
+  801a13:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a18:	49 bd 8e 41 80 00 00 	movabs $0x80418e,%r13
+  801a1f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a22:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a28:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a2b:	48 89 df             	mov    %rbx,%rdi
+  801a2e:	41 ff d5             	call   *%r13
+  801a31:	83 e0 04             	and    $0x4,%eax
+  801a34:	74 17                	je     801a4d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a36:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a3d:	4c 39 f3             	cmp    %r14,%rbx
+  801a40:	75 e6                	jne    801a28 <fd_alloc+0x29>
+  801a42:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a48:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a4d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a50:	48 83 c4 08          	add    $0x8,%rsp
+  801a54:	5b                   	pop    %rbx
+  801a55:	41 5c                	pop    %r12
+  801a57:	41 5d                	pop    %r13
+  801a59:	41 5e                	pop    %r14
+  801a5b:	41 5f                	pop    %r15
+  801a5d:	5d                   	pop    %rbp
+  801a5e:	c3                   	ret
+
+0000000000801a5f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a5f:	83 ff 1f             	cmp    $0x1f,%edi
+  801a62:	77 39                	ja     801a9d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a64:	55                   	push   %rbp
+  801a65:	48 89 e5             	mov    %rsp,%rbp
+  801a68:	41 54                	push   %r12
+  801a6a:	53                   	push   %rbx
+  801a6b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a6e:	48 63 df             	movslq %edi,%rbx
+  801a71:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a78:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a7c:	48 89 df             	mov    %rbx,%rdi
+  801a7f:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+  801a8b:	a8 04                	test   $0x4,%al
+  801a8d:	74 14                	je     801aa3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a8f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a98:	5b                   	pop    %rbx
+  801a99:	41 5c                	pop    %r12
+  801a9b:	5d                   	pop    %rbp
+  801a9c:	c3                   	ret
+        return -E_INVAL;
+  801a9d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801aa2:	c3                   	ret
+        return -E_INVAL;
+  801aa3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801aa8:	eb ee                	jmp    801a98 <fd_lookup+0x39>
+
+0000000000801aaa <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aaa:	55                   	push   %rbp
+  801aab:	48 89 e5             	mov    %rsp,%rbp
+  801aae:	41 54                	push   %r12
+  801ab0:	53                   	push   %rbx
+  801ab1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ab4:	48 b8 00 51 80 00 00 	movabs $0x805100,%rax
+  801abb:	00 00 00 
+  801abe:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801ac5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ac8:	39 3b                	cmp    %edi,(%rbx)
+  801aca:	74 47                	je     801b13 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801acc:	48 83 c0 08          	add    $0x8,%rax
+  801ad0:	48 8b 18             	mov    (%rax),%rbx
+  801ad3:	48 85 db             	test   %rbx,%rbx
+  801ad6:	75 f0                	jne    801ac8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ad8:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801adf:	00 00 00 
+  801ae2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ae8:	89 fa                	mov    %edi,%edx
+  801aea:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  801af1:	00 00 00 
+  801af4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af9:	48 b9 53 05 80 00 00 	movabs $0x800553,%rcx
+  801b00:	00 00 00 
+  801b03:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b0a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b0e:	5b                   	pop    %rbx
+  801b0f:	41 5c                	pop    %r12
+  801b11:	5d                   	pop    %rbp
+  801b12:	c3                   	ret
+            return 0;
+  801b13:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b18:	eb f0                	jmp    801b0a <dev_lookup+0x60>
+
+0000000000801b1a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b1a:	55                   	push   %rbp
+  801b1b:	48 89 e5             	mov    %rsp,%rbp
+  801b1e:	41 55                	push   %r13
+  801b20:	41 54                	push   %r12
+  801b22:	53                   	push   %rbx
+  801b23:	48 83 ec 18          	sub    $0x18,%rsp
+  801b27:	48 89 fb             	mov    %rdi,%rbx
+  801b2a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b2d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b34:	ff ff ff 
+  801b37:	48 01 df             	add    %rbx,%rdi
+  801b3a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b3e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b42:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801b49:	00 00 00 
+  801b4c:	ff d0                	call   *%rax
+  801b4e:	41 89 c5             	mov    %eax,%r13d
+  801b51:	85 c0                	test   %eax,%eax
+  801b53:	78 06                	js     801b5b <fd_close+0x41>
+  801b55:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b59:	74 1a                	je     801b75 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b5b:	45 84 e4             	test   %r12b,%r12b
+  801b5e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b63:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b67:	44 89 e8             	mov    %r13d,%eax
+  801b6a:	48 83 c4 18          	add    $0x18,%rsp
+  801b6e:	5b                   	pop    %rbx
+  801b6f:	41 5c                	pop    %r12
+  801b71:	41 5d                	pop    %r13
+  801b73:	5d                   	pop    %rbp
+  801b74:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b75:	8b 3b                	mov    (%rbx),%edi
+  801b77:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7b:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+  801b87:	41 89 c5             	mov    %eax,%r13d
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 1b                	js     801ba9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b8e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b92:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b96:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b9c:	48 85 c0             	test   %rax,%rax
+  801b9f:	74 08                	je     801ba9 <fd_close+0x8f>
+  801ba1:	48 89 df             	mov    %rbx,%rdi
+  801ba4:	ff d0                	call   *%rax
+  801ba6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ba9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bae:	48 89 de             	mov    %rbx,%rsi
+  801bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb6:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+    return res;
+  801bc2:	eb a3                	jmp    801b67 <fd_close+0x4d>
+
+0000000000801bc4 <close>:
+
+int
+close(int fdnum) {
+  801bc4:	55                   	push   %rbp
+  801bc5:	48 89 e5             	mov    %rsp,%rbp
+  801bc8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bcc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801bd0:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801bdc:	85 c0                	test   %eax,%eax
+  801bde:	78 15                	js     801bf5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801be0:	be 01 00 00 00       	mov    $0x1,%esi
+  801be5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801be9:	48 b8 1a 1b 80 00 00 	movabs $0x801b1a,%rax
+  801bf0:	00 00 00 
+  801bf3:	ff d0                	call   *%rax
+}
+  801bf5:	c9                   	leave
+  801bf6:	c3                   	ret
+
+0000000000801bf7 <close_all>:
+
+void
+close_all(void) {
+  801bf7:	55                   	push   %rbp
+  801bf8:	48 89 e5             	mov    %rsp,%rbp
+  801bfb:	41 54                	push   %r12
+  801bfd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801bfe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c03:	49 bc c4 1b 80 00 00 	movabs $0x801bc4,%r12
+  801c0a:	00 00 00 
+  801c0d:	89 df                	mov    %ebx,%edi
+  801c0f:	41 ff d4             	call   *%r12
+  801c12:	83 c3 01             	add    $0x1,%ebx
+  801c15:	83 fb 20             	cmp    $0x20,%ebx
+  801c18:	75 f3                	jne    801c0d <close_all+0x16>
+}
+  801c1a:	5b                   	pop    %rbx
+  801c1b:	41 5c                	pop    %r12
+  801c1d:	5d                   	pop    %rbp
+  801c1e:	c3                   	ret
+
+0000000000801c1f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c1f:	55                   	push   %rbp
+  801c20:	48 89 e5             	mov    %rsp,%rbp
+  801c23:	41 57                	push   %r15
+  801c25:	41 56                	push   %r14
+  801c27:	41 55                	push   %r13
+  801c29:	41 54                	push   %r12
+  801c2b:	53                   	push   %rbx
+  801c2c:	48 83 ec 18          	sub    $0x18,%rsp
+  801c30:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c33:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c37:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+  801c43:	89 c3                	mov    %eax,%ebx
+  801c45:	85 c0                	test   %eax,%eax
+  801c47:	0f 88 b8 00 00 00    	js     801d05 <dup+0xe6>
+    close(newfdnum);
+  801c4d:	44 89 e7             	mov    %r12d,%edi
+  801c50:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  801c57:	00 00 00 
+  801c5a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c5c:	4d 63 ec             	movslq %r12d,%r13
+  801c5f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c66:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c6a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c6e:	4c 89 ff             	mov    %r15,%rdi
+  801c71:	49 be e3 19 80 00 00 	movabs $0x8019e3,%r14
+  801c78:	00 00 00 
+  801c7b:	41 ff d6             	call   *%r14
+  801c7e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c81:	4c 89 ef             	mov    %r13,%rdi
+  801c84:	41 ff d6             	call   *%r14
+  801c87:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c8a:	48 89 df             	mov    %rbx,%rdi
+  801c8d:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  801c94:	00 00 00 
+  801c97:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c99:	a8 04                	test   $0x4,%al
+  801c9b:	74 2b                	je     801cc8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c9d:	41 89 c1             	mov    %eax,%r9d
+  801ca0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ca6:	4c 89 f1             	mov    %r14,%rcx
+  801ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cae:	48 89 de             	mov    %rbx,%rsi
+  801cb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cb6:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  801cbd:	00 00 00 
+  801cc0:	ff d0                	call   *%rax
+  801cc2:	89 c3                	mov    %eax,%ebx
+  801cc4:	85 c0                	test   %eax,%eax
+  801cc6:	78 4e                	js     801d16 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cc8:	4c 89 ff             	mov    %r15,%rdi
+  801ccb:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801cda:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ce0:	4c 89 e9             	mov    %r13,%rcx
+  801ce3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce8:	4c 89 fe             	mov    %r15,%rsi
+  801ceb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf0:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  801cf7:	00 00 00 
+  801cfa:	ff d0                	call   *%rax
+  801cfc:	89 c3                	mov    %eax,%ebx
+  801cfe:	85 c0                	test   %eax,%eax
+  801d00:	78 14                	js     801d16 <dup+0xf7>
+
+    return newfdnum;
+  801d02:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d05:	89 d8                	mov    %ebx,%eax
+  801d07:	48 83 c4 18          	add    $0x18,%rsp
+  801d0b:	5b                   	pop    %rbx
+  801d0c:	41 5c                	pop    %r12
+  801d0e:	41 5d                	pop    %r13
+  801d10:	41 5e                	pop    %r14
+  801d12:	41 5f                	pop    %r15
+  801d14:	5d                   	pop    %rbp
+  801d15:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d1b:	4c 89 ee             	mov    %r13,%rsi
+  801d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d23:	49 bc 7d 14 80 00 00 	movabs $0x80147d,%r12
+  801d2a:	00 00 00 
+  801d2d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d35:	4c 89 f6             	mov    %r14,%rsi
+  801d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3d:	41 ff d4             	call   *%r12
+    return res;
+  801d40:	eb c3                	jmp    801d05 <dup+0xe6>
+
+0000000000801d42 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d42:	55                   	push   %rbp
+  801d43:	48 89 e5             	mov    %rsp,%rbp
+  801d46:	41 56                	push   %r14
+  801d48:	41 55                	push   %r13
+  801d4a:	41 54                	push   %r12
+  801d4c:	53                   	push   %rbx
+  801d4d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d51:	89 fb                	mov    %edi,%ebx
+  801d53:	49 89 f4             	mov    %rsi,%r12
+  801d56:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d59:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d5d:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801d64:	00 00 00 
+  801d67:	ff d0                	call   *%rax
+  801d69:	85 c0                	test   %eax,%eax
+  801d6b:	78 4c                	js     801db9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d6d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d71:	41 8b 3e             	mov    (%r14),%edi
+  801d74:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d78:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 35                	js     801dbd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d88:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d8c:	83 e0 03             	and    $0x3,%eax
+  801d8f:	83 f8 01             	cmp    $0x1,%eax
+  801d92:	74 2d                	je     801dc1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d98:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d9c:	48 85 c0             	test   %rax,%rax
+  801d9f:	74 56                	je     801df7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801da1:	4c 89 ea             	mov    %r13,%rdx
+  801da4:	4c 89 e6             	mov    %r12,%rsi
+  801da7:	4c 89 f7             	mov    %r14,%rdi
+  801daa:	ff d0                	call   *%rax
+}
+  801dac:	48 83 c4 10          	add    $0x10,%rsp
+  801db0:	5b                   	pop    %rbx
+  801db1:	41 5c                	pop    %r12
+  801db3:	41 5d                	pop    %r13
+  801db5:	41 5e                	pop    %r14
+  801db7:	5d                   	pop    %rbp
+  801db8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801db9:	48 98                	cltq
+  801dbb:	eb ef                	jmp    801dac <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dbd:	48 98                	cltq
+  801dbf:	eb eb                	jmp    801dac <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dc1:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801dc8:	00 00 00 
+  801dcb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801dd1:	89 da                	mov    %ebx,%edx
+  801dd3:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  801dda:	00 00 00 
+  801ddd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de2:	48 b9 53 05 80 00 00 	movabs $0x800553,%rcx
+  801de9:	00 00 00 
+  801dec:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dee:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801df5:	eb b5                	jmp    801dac <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801df7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dfe:	eb ac                	jmp    801dac <read+0x6a>
+
+0000000000801e00 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e00:	55                   	push   %rbp
+  801e01:	48 89 e5             	mov    %rsp,%rbp
+  801e04:	41 57                	push   %r15
+  801e06:	41 56                	push   %r14
+  801e08:	41 55                	push   %r13
+  801e0a:	41 54                	push   %r12
+  801e0c:	53                   	push   %rbx
+  801e0d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e11:	48 85 d2             	test   %rdx,%rdx
+  801e14:	74 54                	je     801e6a <readn+0x6a>
+  801e16:	41 89 fd             	mov    %edi,%r13d
+  801e19:	49 89 f6             	mov    %rsi,%r14
+  801e1c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e1f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e24:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e29:	49 bf 42 1d 80 00 00 	movabs $0x801d42,%r15
+  801e30:	00 00 00 
+  801e33:	4c 89 e2             	mov    %r12,%rdx
+  801e36:	48 29 f2             	sub    %rsi,%rdx
+  801e39:	4c 01 f6             	add    %r14,%rsi
+  801e3c:	44 89 ef             	mov    %r13d,%edi
+  801e3f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e42:	85 c0                	test   %eax,%eax
+  801e44:	78 20                	js     801e66 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e46:	01 c3                	add    %eax,%ebx
+  801e48:	85 c0                	test   %eax,%eax
+  801e4a:	74 08                	je     801e54 <readn+0x54>
+  801e4c:	48 63 f3             	movslq %ebx,%rsi
+  801e4f:	4c 39 e6             	cmp    %r12,%rsi
+  801e52:	72 df                	jb     801e33 <readn+0x33>
+    }
+    return res;
+  801e54:	48 63 c3             	movslq %ebx,%rax
+}
+  801e57:	48 83 c4 08          	add    $0x8,%rsp
+  801e5b:	5b                   	pop    %rbx
+  801e5c:	41 5c                	pop    %r12
+  801e5e:	41 5d                	pop    %r13
+  801e60:	41 5e                	pop    %r14
+  801e62:	41 5f                	pop    %r15
+  801e64:	5d                   	pop    %rbp
+  801e65:	c3                   	ret
+        if (inc < 0) return inc;
+  801e66:	48 98                	cltq
+  801e68:	eb ed                	jmp    801e57 <readn+0x57>
+    int inc = 1, res = 0;
+  801e6a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e6f:	eb e3                	jmp    801e54 <readn+0x54>
+
+0000000000801e71 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e71:	55                   	push   %rbp
+  801e72:	48 89 e5             	mov    %rsp,%rbp
+  801e75:	41 56                	push   %r14
+  801e77:	41 55                	push   %r13
+  801e79:	41 54                	push   %r12
+  801e7b:	53                   	push   %rbx
+  801e7c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e80:	89 fb                	mov    %edi,%ebx
+  801e82:	49 89 f4             	mov    %rsi,%r12
+  801e85:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e88:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e8c:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801e93:	00 00 00 
+  801e96:	ff d0                	call   *%rax
+  801e98:	85 c0                	test   %eax,%eax
+  801e9a:	78 47                	js     801ee3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e9c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ea0:	41 8b 3e             	mov    (%r14),%edi
+  801ea3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ea7:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 30                	js     801ee7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eb7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801ebc:	74 2d                	je     801eeb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ebe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ec2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ec6:	48 85 c0             	test   %rax,%rax
+  801ec9:	74 56                	je     801f21 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ecb:	4c 89 ea             	mov    %r13,%rdx
+  801ece:	4c 89 e6             	mov    %r12,%rsi
+  801ed1:	4c 89 f7             	mov    %r14,%rdi
+  801ed4:	ff d0                	call   *%rax
+}
+  801ed6:	48 83 c4 10          	add    $0x10,%rsp
+  801eda:	5b                   	pop    %rbx
+  801edb:	41 5c                	pop    %r12
+  801edd:	41 5d                	pop    %r13
+  801edf:	41 5e                	pop    %r14
+  801ee1:	5d                   	pop    %rbp
+  801ee2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ee3:	48 98                	cltq
+  801ee5:	eb ef                	jmp    801ed6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee7:	48 98                	cltq
+  801ee9:	eb eb                	jmp    801ed6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801eeb:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801ef2:	00 00 00 
+  801ef5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801efb:	89 da                	mov    %ebx,%edx
+  801efd:	48 bf c5 50 80 00 00 	movabs $0x8050c5,%rdi
+  801f04:	00 00 00 
+  801f07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f0c:	48 b9 53 05 80 00 00 	movabs $0x800553,%rcx
+  801f13:	00 00 00 
+  801f16:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f18:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f1f:	eb b5                	jmp    801ed6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f21:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f28:	eb ac                	jmp    801ed6 <write+0x65>
+
+0000000000801f2a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f2a:	55                   	push   %rbp
+  801f2b:	48 89 e5             	mov    %rsp,%rbp
+  801f2e:	41 54                	push   %r12
+  801f30:	53                   	push   %rbx
+  801f31:	48 83 ec 10          	sub    $0x10,%rsp
+  801f35:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f37:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f3b:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801f42:	00 00 00 
+  801f45:	ff d0                	call   *%rax
+  801f47:	85 c0                	test   %eax,%eax
+  801f49:	78 3e                	js     801f89 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f4f:	41 8b 3c 24          	mov    (%r12),%edi
+  801f53:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f57:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	85 c0                	test   %eax,%eax
+  801f65:	78 22                	js     801f89 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801f67:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f6b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801f6f:	48 85 c0             	test   %rax,%rax
+  801f72:	74 0b                	je     801f7f <seek+0x55>
+  801f74:	89 de                	mov    %ebx,%esi
+  801f76:	4c 89 e7             	mov    %r12,%rdi
+  801f79:	ff d0                	call   *%rax
+  801f7b:	85 c0                	test   %eax,%eax
+  801f7d:	78 0a                	js     801f89 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801f7f:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801f84:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f89:	48 83 c4 10          	add    $0x10,%rsp
+  801f8d:	5b                   	pop    %rbx
+  801f8e:	41 5c                	pop    %r12
+  801f90:	5d                   	pop    %rbp
+  801f91:	c3                   	ret
+
+0000000000801f92 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f92:	55                   	push   %rbp
+  801f93:	48 89 e5             	mov    %rsp,%rbp
+  801f96:	41 55                	push   %r13
+  801f98:	41 54                	push   %r12
+  801f9a:	53                   	push   %rbx
+  801f9b:	48 83 ec 18          	sub    $0x18,%rsp
+  801f9f:	89 fb                	mov    %edi,%ebx
+  801fa1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fa8:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  801faf:	00 00 00 
+  801fb2:	ff d0                	call   *%rax
+  801fb4:	85 c0                	test   %eax,%eax
+  801fb6:	78 38                	js     801ff0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fb8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fbc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801fc0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801fc4:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801fcb:	00 00 00 
+  801fce:	ff d0                	call   *%rax
+  801fd0:	85 c0                	test   %eax,%eax
+  801fd2:	78 1c                	js     801ff0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801fd4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801fd9:	74 20                	je     801ffb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fdb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801fdf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801fe3:	48 85 c0             	test   %rax,%rax
+  801fe6:	74 47                	je     80202f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801fe8:	44 89 e6             	mov    %r12d,%esi
+  801feb:	4c 89 ef             	mov    %r13,%rdi
+  801fee:	ff d0                	call   *%rax
+}
+  801ff0:	48 83 c4 18          	add    $0x18,%rsp
+  801ff4:	5b                   	pop    %rbx
+  801ff5:	41 5c                	pop    %r12
+  801ff7:	41 5d                	pop    %r13
+  801ff9:	5d                   	pop    %rbp
+  801ffa:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ffb:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802002:	00 00 00 
+  802005:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80200b:	89 da                	mov    %ebx,%edx
+  80200d:	48 bf 88 50 80 00 00 	movabs $0x805088,%rdi
+  802014:	00 00 00 
+  802017:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201c:	48 b9 53 05 80 00 00 	movabs $0x800553,%rcx
+  802023:	00 00 00 
+  802026:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802028:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80202d:	eb c1                	jmp    801ff0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80202f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802034:	eb ba                	jmp    801ff0 <ftruncate+0x5e>
+
+0000000000802036 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802036:	55                   	push   %rbp
+  802037:	48 89 e5             	mov    %rsp,%rbp
+  80203a:	41 54                	push   %r12
+  80203c:	53                   	push   %rbx
+  80203d:	48 83 ec 10          	sub    $0x10,%rsp
+  802041:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802044:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802048:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  80204f:	00 00 00 
+  802052:	ff d0                	call   *%rax
+  802054:	85 c0                	test   %eax,%eax
+  802056:	78 4e                	js     8020a6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802058:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80205c:	41 8b 3c 24          	mov    (%r12),%edi
+  802060:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802064:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  80206b:	00 00 00 
+  80206e:	ff d0                	call   *%rax
+  802070:	85 c0                	test   %eax,%eax
+  802072:	78 32                	js     8020a6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802074:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802078:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80207d:	74 30                	je     8020af <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80207f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802082:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802089:	00 00 00 
+    stat->st_isdir = 0;
+  80208c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802093:	00 00 00 
+    stat->st_dev = dev;
+  802096:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80209d:	48 89 de             	mov    %rbx,%rsi
+  8020a0:	4c 89 e7             	mov    %r12,%rdi
+  8020a3:	ff 50 28             	call   *0x28(%rax)
+}
+  8020a6:	48 83 c4 10          	add    $0x10,%rsp
+  8020aa:	5b                   	pop    %rbx
+  8020ab:	41 5c                	pop    %r12
+  8020ad:	5d                   	pop    %rbp
+  8020ae:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020af:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020b4:	eb f0                	jmp    8020a6 <fstat+0x70>
+
+00000000008020b6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020b6:	55                   	push   %rbp
+  8020b7:	48 89 e5             	mov    %rsp,%rbp
+  8020ba:	41 54                	push   %r12
+  8020bc:	53                   	push   %rbx
+  8020bd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020c5:	48 b8 24 32 80 00 00 	movabs $0x803224,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+  8020d1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8020d3:	85 c0                	test   %eax,%eax
+  8020d5:	78 25                	js     8020fc <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8020d7:	4c 89 e6             	mov    %r12,%rsi
+  8020da:	89 c7                	mov    %eax,%edi
+  8020dc:	48 b8 36 20 80 00 00 	movabs $0x802036,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+  8020e8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8020eb:	89 df                	mov    %ebx,%edi
+  8020ed:	48 b8 c4 1b 80 00 00 	movabs $0x801bc4,%rax
+  8020f4:	00 00 00 
+  8020f7:	ff d0                	call   *%rax
+
+    return res;
+  8020f9:	44 89 e3             	mov    %r12d,%ebx
+}
+  8020fc:	89 d8                	mov    %ebx,%eax
+  8020fe:	5b                   	pop    %rbx
+  8020ff:	41 5c                	pop    %r12
+  802101:	5d                   	pop    %rbp
+  802102:	c3                   	ret
+
+0000000000802103 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802103:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  80210a:	00 00 00 
+  80210d:	83 38 00             	cmpl   $0x0,(%rax)
+  802110:	74 0a                	je     80211c <fsenv+0x19>
+    return envid;
+}
+  802112:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  802119:	00 00 
+  80211b:	c3                   	ret
+fsenv(void) {
+  80211c:	55                   	push   %rbp
+  80211d:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802120:	bf 03 00 00 00       	mov    $0x3,%edi
+  802125:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  802138:	00 00 
+}
+  80213a:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  802141:	00 00 
+  802143:	5d                   	pop    %rbp
+  802144:	c3                   	ret
+
+0000000000802145 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802145:	55                   	push   %rbp
+  802146:	48 89 e5             	mov    %rsp,%rbp
+  802149:	41 54                	push   %r12
+  80214b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80214c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802151:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802156:	48 89 de             	mov    %rbx,%rsi
+  802159:	bf 00 00 00 00       	mov    $0x0,%edi
+  80215e:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80216a:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  802171:	00 00 00 
+  802174:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80217a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80217f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802184:	48 89 de             	mov    %rbx,%rsi
+  802187:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218c:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  802193:	00 00 00 
+  802196:	ff d0                	call   *%rax
+  802198:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80219a:	85 c0                	test   %eax,%eax
+  80219c:	0f 88 a2 00 00 00    	js     802244 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8021a2:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8021a9:	00 00 00 
+  8021ac:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021b2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021b7:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8021b9:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8021be:	49 bc 56 43 80 00 00 	movabs $0x804356,%r12
+  8021c5:	00 00 00 
+  8021c8:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8021cb:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8021d0:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8021d3:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+  8021df:	89 c7                	mov    %eax,%edi
+  8021e1:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8021e7:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8021ec:	48 89 da             	mov    %rbx,%rdx
+  8021ef:	be 09 00 00 00       	mov    $0x9,%esi
+  8021f4:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  8021fb:	00 00 00 
+  8021fe:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802200:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802205:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220a:	be 00 00 00 00       	mov    $0x0,%esi
+  80220f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802214:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	89 c3                	mov    %eax,%ebx
+  802222:	85 c0                	test   %eax,%eax
+  802224:	78 25                	js     80224b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802226:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80222d:	00 00 00 
+  802230:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802236:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  80223d:	00 00 
+    return 0;
+  80223f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802244:	89 d8                	mov    %ebx,%eax
+  802246:	5b                   	pop    %rbx
+  802247:	41 5c                	pop    %r12
+  802249:	5d                   	pop    %rbp
+  80224a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80224b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802250:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802255:	bf 00 00 00 00       	mov    $0x0,%edi
+  80225a:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+        return res;
+  802266:	eb dc                	jmp    802244 <fschan_setup+0xff>
+
+0000000000802268 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802268:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  80226f:	00 00 00 
+  802272:	80 38 00             	cmpb   $0x0,(%rax)
+  802275:	74 55                	je     8022cc <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802277:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80227e:	00 00 00 
+  802281:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802287:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80228c:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  802293:	00 00 00 
+  802296:	3b 0a                	cmp    (%rdx),%ecx
+  802298:	75 01                	jne    80229b <fschan+0x33>
+}
+  80229a:	c3                   	ret
+fschan(void) {
+  80229b:	55                   	push   %rbp
+  80229c:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80229f:	48 b8 45 21 80 00 00 	movabs $0x802145,%rax
+  8022a6:	00 00 00 
+  8022a9:	ff d0                	call   *%rax
+  8022ab:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8022ad:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022b2:	85 d2                	test   %edx,%edx
+  8022b4:	78 02                	js     8022b8 <fschan+0x50>
+}
+  8022b6:	5d                   	pop    %rbp
+  8022b7:	c3                   	ret
+        fschan_enabled = 0;
+  8022b8:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8022bf:	00 00 00 
+  8022c2:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8022c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022ca:	eb ea                	jmp    8022b6 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8022cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022d1:	c3                   	ret
+
+00000000008022d2 <fbuf>:
+fbuf(struct Fd *fd) {
+  8022d2:	55                   	push   %rbp
+  8022d3:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8022d6:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8022dd:	00 00 00 
+  8022e0:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8022e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022e7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8022eb:	77 12                	ja     8022ff <fbuf+0x2d>
+  8022ed:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8022f1:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  8022f8:	00 00 00 
+  8022fb:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8022ff:	48 89 d0             	mov    %rdx,%rax
+  802302:	5d                   	pop    %rbp
+  802303:	c3                   	ret
+
+0000000000802304 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802304:	55                   	push   %rbp
+  802305:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802308:	48 83 c7 40          	add    $0x40,%rdi
+  80230c:	48 b8 90 43 80 00 00 	movabs $0x804390,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+  802318:	84 c0                	test   %al,%al
+  80231a:	75 02                	jne    80231e <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80231e:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  802325:	00 00 00 
+  802328:	ff d0                	call   *%rax
+  80232a:	89 c7                	mov    %eax,%edi
+  80232c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802332:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802337:	ba 00 00 00 00       	mov    $0x0,%edx
+  80233c:	be 0a 00 00 00       	mov    $0xa,%esi
+  802341:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  802348:	00 00 00 
+  80234b:	ff d0                	call   *%rax
+}
+  80234d:	eb cd                	jmp    80231c <fschan_publish+0x18>
+
+000000000080234f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80234f:	55                   	push   %rbp
+  802350:	48 89 e5             	mov    %rsp,%rbp
+  802353:	41 57                	push   %r15
+  802355:	41 56                	push   %r14
+  802357:	41 55                	push   %r13
+  802359:	41 54                	push   %r12
+  80235b:	53                   	push   %rbx
+  80235c:	48 83 ec 48          	sub    $0x48,%rsp
+  802360:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802364:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802368:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80236b:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80236f:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802372:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  802379:	00 00 00 
+  80237c:	8b 02                	mov    (%rdx),%eax
+  80237e:	83 c0 01             	add    $0x1,%eax
+  802381:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802386:	0f 44 c1             	cmove  %ecx,%eax
+  802389:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80238b:	4d 85 c0             	test   %r8,%r8
+  80238e:	74 2c                	je     8023bc <fschan_rw+0x6d>
+  802390:	45 89 ce             	mov    %r9d,%r14d
+  802393:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80239a:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80239e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023a4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8023ab:	00 
+  8023ac:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023b2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023b7:	e9 41 01 00 00       	jmp    8024fd <fschan_rw+0x1ae>
+  8023bc:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8023c0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8023c4:	e9 9c 01 00 00       	jmp    802565 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8023c9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8023cd:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8023d0:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8023d3:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8023d6:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8023da:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8023de:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8023e2:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8023e6:	48 89 da             	mov    %rbx,%rdx
+  8023e9:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  8023f0:	00 00 00 
+  8023f3:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8023f5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8023f9:	48 b8 04 23 80 00 00 	movabs $0x802304,%rax
+  802400:	00 00 00 
+  802403:	ff d0                	call   *%rax
+            queued += blk;
+  802405:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802408:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80240c:	4d 39 fc             	cmp    %r15,%r12
+  80240f:	73 6b                	jae    80247c <fschan_rw+0x12d>
+  802411:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802415:	77 65                	ja     80247c <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802417:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80241b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80241f:	48 b8 6b 43 80 00 00 	movabs $0x80436b,%rax
+  802426:	00 00 00 
+  802429:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80242b:	4c 89 fb             	mov    %r15,%rbx
+  80242e:	4c 29 e3             	sub    %r12,%rbx
+  802431:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802436:	48 39 d3             	cmp    %rdx,%rbx
+  802439:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80243d:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802441:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802445:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802449:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80244c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80244e:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  802455:	00 00 00 
+  802458:	8b 09                	mov    (%rcx),%ecx
+  80245a:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80245d:	83 fe 03             	cmp    $0x3,%esi
+  802460:	0f 85 63 ff ff ff    	jne    8023c9 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802466:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80246a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80246d:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802470:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802473:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802477:	e9 79 ff ff ff       	jmp    8023f5 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80247c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802480:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802487:	48 89 df             	mov    %rbx,%rdi
+  80248a:	48 b8 2e 44 80 00 00 	movabs $0x80442e,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802496:	48 89 df             	mov    %rbx,%rdi
+  802499:	48 b8 bc 43 80 00 00 	movabs $0x8043bc,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8024a9:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8024ad:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8024b1:	75 25                	jne    8024d8 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8024b3:	8b 40 04             	mov    0x4(%rax),%eax
+  8024b6:	85 c0                	test   %eax,%eax
+  8024b8:	0f 88 86 00 00 00    	js     802544 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024be:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8024c2:	74 5b                	je     80251f <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8024c4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8024c8:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8024cc:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8024d0:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8024d4:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8024d8:	48 89 df             	mov    %rbx,%rdi
+  8024db:	48 b8 e3 43 80 00 00 	movabs $0x8043e3,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8024e7:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8024eb:	83 f0 01             	xor    $0x1,%eax
+  8024ee:	4d 39 fc             	cmp    %r15,%r12
+  8024f1:	0f 92 c2             	setb   %dl
+  8024f4:	84 c2                	test   %al,%dl
+  8024f6:	75 05                	jne    8024fd <fschan_rw+0x1ae>
+  8024f8:	45 85 ed             	test   %r13d,%r13d
+  8024fb:	74 50                	je     80254d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8024fd:	4d 39 fc             	cmp    %r15,%r12
+  802500:	0f 92 c1             	setb   %cl
+  802503:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802507:	0f 96 c2             	setbe  %dl
+  80250a:	84 d1                	test   %dl,%cl
+  80250c:	0f 84 6a ff ff ff    	je     80247c <fschan_rw+0x12d>
+  802512:	84 c0                	test   %al,%al
+  802514:	0f 85 fd fe ff ff    	jne    802417 <fschan_rw+0xc8>
+  80251a:	e9 5d ff ff ff       	jmp    80247c <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80251f:	48 63 d0             	movslq %eax,%rdx
+  802522:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802526:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80252a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80252e:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802532:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802536:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	eb 80                	jmp    8024c4 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802544:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802547:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80254b:	eb 8b                	jmp    8024d8 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80254d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802552:	0f 85 68 fe ff ff    	jne    8023c0 <fschan_rw+0x71>
+  802558:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80255b:	85 c0                	test   %eax,%eax
+  80255d:	0f 84 5d fe ff ff    	je     8023c0 <fschan_rw+0x71>
+  802563:	48 98                	cltq
+}
+  802565:	48 83 c4 48          	add    $0x48,%rsp
+  802569:	5b                   	pop    %rbx
+  80256a:	41 5c                	pop    %r12
+  80256c:	41 5d                	pop    %r13
+  80256e:	41 5e                	pop    %r14
+  802570:	41 5f                	pop    %r15
+  802572:	5d                   	pop    %rbp
+  802573:	c3                   	ret
+
+0000000000802574 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+  802578:	41 56                	push   %r14
+  80257a:	41 55                	push   %r13
+  80257c:	41 54                	push   %r12
+  80257e:	53                   	push   %rbx
+  80257f:	48 83 ec 10          	sub    $0x10,%rsp
+  802583:	49 89 fe             	mov    %rdi,%r14
+  802586:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802589:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80258d:	48 29 f3             	sub    %rsi,%rbx
+  802590:	48 39 d3             	cmp    %rdx,%rbx
+  802593:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802597:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80259e:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80259f:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8025a4:	49 bd ed 41 80 00 00 	movabs $0x8041ed,%r13
+  8025ab:	00 00 00 
+  8025ae:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8025b5:	76 1e                	jbe    8025d5 <mmap_fault+0x61>
+  8025b7:	4c 01 e7             	add    %r12,%rdi
+  8025ba:	41 ff d5             	call   *%r13
+  8025bd:	84 c0                	test   %al,%al
+  8025bf:	75 14                	jne    8025d5 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8025c1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c5:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8025cc:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8025d0:	48 39 df             	cmp    %rbx,%rdi
+  8025d3:	72 e2                	jb     8025b7 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8025d5:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  8025dc:	00 00 00 
+  8025df:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8025e6:	00 00 00 
+  8025e9:	4c 89 f0             	mov    %r14,%rax
+  8025ec:	48 29 d0             	sub    %rdx,%rax
+  8025ef:	48 c1 f8 03          	sar    $0x3,%rax
+  8025f3:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8025fa:	aa aa aa 
+  8025fd:	48 0f af c2          	imul   %rdx,%rax
+  802601:	48 c1 e0 0c          	shl    $0xc,%rax
+  802605:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80260a:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80260e:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802610:	44 89 e0             	mov    %r12d,%eax
+  802613:	41 03 46 10          	add    0x10(%r14),%eax
+  802617:	41 2b 06             	sub    (%r14),%eax
+  80261a:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80261d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802621:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802625:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802629:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80262c:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  802633:	00 00 00 
+  802636:	ff d0                	call   *%rax
+  802638:	89 c7                	mov    %eax,%edi
+  80263a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802640:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802645:	48 89 da             	mov    %rbx,%rdx
+  802648:	be 0f 00 00 00       	mov    $0xf,%esi
+  80264d:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  802654:	00 00 00 
+  802657:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802659:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80265e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802662:	4c 89 e6             	mov    %r12,%rsi
+  802665:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266a:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  802671:	00 00 00 
+  802674:	ff d0                	call   *%rax
+  802676:	48 98                	cltq
+}
+  802678:	48 83 c4 10          	add    $0x10,%rsp
+  80267c:	5b                   	pop    %rbx
+  80267d:	41 5c                	pop    %r12
+  80267f:	41 5d                	pop    %r13
+  802681:	41 5e                	pop    %r14
+  802683:	5d                   	pop    %rbp
+  802684:	c3                   	ret
+
+0000000000802685 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802685:	48 8b 37             	mov    (%rdi),%rsi
+  802688:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80268f:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  802696:	00 00 00 
+  802699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269e:	eb 0f                	jmp    8026af <mmap_pgfault+0x2a>
+  8026a0:	c3                   	ret
+  8026a1:	48 83 c1 01          	add    $0x1,%rcx
+  8026a5:	48 83 c2 18          	add    $0x18,%rdx
+  8026a9:	48 83 f9 20          	cmp    $0x20,%rcx
+  8026ad:	74 6e                	je     80271d <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8026af:	48 8b 02             	mov    (%rdx),%rax
+  8026b2:	48 83 e8 01          	sub    $0x1,%rax
+  8026b6:	48 39 f0             	cmp    %rsi,%rax
+  8026b9:	73 e6                	jae    8026a1 <mmap_pgfault+0x1c>
+  8026bb:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8026bf:	73 e0                	jae    8026a1 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8026c1:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8026c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ca:	f6 c2 01             	test   $0x1,%dl
+  8026cd:	75 d1                	jne    8026a0 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8026cf:	f6 c2 02             	test   $0x2,%dl
+  8026d2:	74 1a                	je     8026ee <mmap_pgfault+0x69>
+  8026d4:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8026d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026dd:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  8026e4:	00 00 00 
+  8026e7:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8026ec:	74 35                	je     802723 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8026ee:	55                   	push   %rbp
+  8026ef:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8026f2:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8026f6:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8026fd:	00 00 00 
+  802700:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802704:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802709:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+  802715:	48 85 c0             	test   %rax,%rax
+  802718:	0f 9f c0             	setg   %al
+}
+  80271b:	5d                   	pop    %rbp
+  80271c:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80271d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802722:	c3                   	ret
+}
+  802723:	c3                   	ret
+
+0000000000802724 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802724:	55                   	push   %rbp
+  802725:	48 89 e5             	mov    %rsp,%rbp
+  802728:	41 54                	push   %r12
+  80272a:	53                   	push   %rbx
+  80272b:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80272e:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802735:	00 00 00 
+  802738:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80273d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802741:	74 15                	je     802758 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802743:	48 83 c3 01          	add    $0x1,%rbx
+  802747:	48 83 c0 18          	add    $0x18,%rax
+  80274b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80274f:	75 ec                	jne    80273d <mmap_alloc+0x19>
+    return NULL;
+  802751:	b8 00 00 00 00       	mov    $0x0,%eax
+  802756:	eb 52                	jmp    8027aa <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802758:	4c 89 e7             	mov    %r12,%rdi
+  80275b:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  802762:	00 00 00 
+  802765:	ff d0                	call   *%rax
+  802767:	41 89 c1             	mov    %eax,%r9d
+  80276a:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802771:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802775:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80277b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802780:	4c 89 e6             	mov    %r12,%rsi
+  802783:	bf 00 00 00 00       	mov    $0x0,%edi
+  802788:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+  802794:	85 c0                	test   %eax,%eax
+  802796:	78 17                	js     8027af <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802798:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80279c:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8027a3:	00 00 00 
+  8027a6:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8027aa:	5b                   	pop    %rbx
+  8027ab:	41 5c                	pop    %r12
+  8027ad:	5d                   	pop    %rbp
+  8027ae:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027b4:	eb f4                	jmp    8027aa <mmap_alloc+0x86>
+
+00000000008027b6 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8027b6:	55                   	push   %rbp
+  8027b7:	48 89 e5             	mov    %rsp,%rbp
+  8027ba:	41 56                	push   %r14
+  8027bc:	41 55                	push   %r13
+  8027be:	41 54                	push   %r12
+  8027c0:	53                   	push   %rbx
+  8027c1:	48 83 ec 10          	sub    $0x10,%rsp
+  8027c5:	41 89 fc             	mov    %edi,%r12d
+  8027c8:	49 89 f5             	mov    %rsi,%r13
+  8027cb:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027ce:	48 89 f0             	mov    %rsi,%rax
+  8027d1:	48 09 d0             	or     %rdx,%rax
+  8027d4:	75 0d                	jne    8027e3 <fsipc+0x2d>
+  8027d6:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8027d9:	83 f8 04             	cmp    $0x4,%eax
+  8027dc:	76 7d                	jbe    80285b <fsipc+0xa5>
+  8027de:	83 ff 0d             	cmp    $0xd,%edi
+  8027e1:	74 78                	je     80285b <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8027e3:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  8027ea:	00 00 00 
+  8027ed:	ff d0                	call   *%rax
+  8027ef:	89 c7                	mov    %eax,%edi
+  8027f1:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8027f8:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8027ff:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802806:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80280c:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802813:	00 00 00 
+  802816:	44 89 e6             	mov    %r12d,%esi
+  802819:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  802820:	00 00 00 
+  802823:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802825:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80282c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80282d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802832:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802836:	4c 89 ee             	mov    %r13,%rsi
+  802839:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283e:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  802845:	00 00 00 
+  802848:	ff d0                	call   *%rax
+  80284a:	89 c3                	mov    %eax,%ebx
+}
+  80284c:	89 d8                	mov    %ebx,%eax
+  80284e:	48 83 c4 10          	add    $0x10,%rsp
+  802852:	5b                   	pop    %rbx
+  802853:	41 5c                	pop    %r12
+  802855:	41 5d                	pop    %r13
+  802857:	41 5e                	pop    %r14
+  802859:	5d                   	pop    %rbp
+  80285a:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80285b:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	49 89 c6             	mov    %rax,%r14
+  80286a:	48 85 c0             	test   %rax,%rax
+  80286d:	0f 84 70 ff ff ff    	je     8027e3 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802873:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802877:	48 b8 6b 43 80 00 00 	movabs $0x80436b,%rax
+  80287e:	00 00 00 
+  802881:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802883:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802886:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80288d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802891:	ba 10 00 00 00       	mov    $0x10,%edx
+  802896:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  80289d:	00 00 00 
+  8028a0:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  8028a7:	00 00 00 
+  8028aa:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8028ac:	4c 89 f7             	mov    %r14,%rdi
+  8028af:	48 b8 04 23 80 00 00 	movabs $0x802304,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8028bb:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8028c2:	4c 89 f7             	mov    %r14,%rdi
+  8028c5:	48 b8 2e 44 80 00 00 	movabs $0x80442e,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8028d1:	4c 89 f7             	mov    %r14,%rdi
+  8028d4:	48 b8 bc 43 80 00 00 	movabs $0x8043bc,%rax
+  8028db:	00 00 00 
+  8028de:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8028e0:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8028e3:	41 83 fc 05          	cmp    $0x5,%r12d
+  8028e7:	75 04                	jne    8028ed <fsipc+0x137>
+  8028e9:	85 db                	test   %ebx,%ebx
+  8028eb:	79 14                	jns    802901 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8028ed:	4c 89 f7             	mov    %r14,%rdi
+  8028f0:	48 b8 e3 43 80 00 00 	movabs $0x8043e3,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8028fc:	e9 4b ff ff ff       	jmp    80284c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802901:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802905:	ba 88 00 00 00       	mov    $0x88,%edx
+  80290a:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802911:	00 00 00 
+  802914:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+  802920:	eb cb                	jmp    8028ed <fsipc+0x137>
+
+0000000000802922 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802922:	55                   	push   %rbp
+  802923:	48 89 e5             	mov    %rsp,%rbp
+  802926:	41 57                	push   %r15
+  802928:	41 56                	push   %r14
+  80292a:	41 55                	push   %r13
+  80292c:	41 54                	push   %r12
+  80292e:	53                   	push   %rbx
+  80292f:	48 83 ec 18          	sub    $0x18,%rsp
+  802933:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802937:	49 89 f6             	mov    %rsi,%r14
+  80293a:	49 89 d4             	mov    %rdx,%r12
+  80293d:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802940:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  802947:	00 00 00 
+  80294a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80294c:	48 85 c0             	test   %rax,%rax
+  80294f:	0f 85 96 00 00 00    	jne    8029eb <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802955:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80295c:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80295d:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802964:	00 00 00 
+    while (n) {
+  802967:	4d 85 e4             	test   %r12,%r12
+  80296a:	74 79                	je     8029e5 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80296c:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802971:	49 39 dc             	cmp    %rbx,%r12
+  802974:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802978:	48 89 da             	mov    %rbx,%rdx
+  80297b:	4c 89 f6             	mov    %r14,%rsi
+  80297e:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  802985:	00 00 00 
+  802988:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  80298f:	00 00 00 
+  802992:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802994:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802998:	8b 40 0c             	mov    0xc(%rax),%eax
+  80299b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80299e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8029a1:	44 01 e8             	add    %r13d,%eax
+  8029a4:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8029a8:	41 0f 44 c5          	cmove  %r13d,%eax
+  8029ac:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8029b0:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8029b4:	48 89 da             	mov    %rbx,%rdx
+  8029b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029bc:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029c1:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+        if (res < 0)
+  8029cd:	85 c0                	test   %eax,%eax
+  8029cf:	78 4a                	js     802a1b <devfile_write_direct+0xf9>
+        buf += res;
+  8029d1:	48 98                	cltq
+  8029d3:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8029d6:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8029da:	49 29 c4             	sub    %rax,%r12
+  8029dd:	75 8d                	jne    80296c <devfile_write_direct+0x4a>
+    return write;
+  8029df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029e3:	eb 27                	jmp    802a0c <devfile_write_direct+0xea>
+    size_t write = 0;
+  8029e5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8029e9:	eb f4                	jmp    8029df <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8029eb:	45 89 e9             	mov    %r13d,%r9d
+  8029ee:	4d 89 e0             	mov    %r12,%r8
+  8029f1:	4c 89 f1             	mov    %r14,%rcx
+  8029f4:	ba 04 00 00 00       	mov    $0x4,%edx
+  8029f9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8029fd:	48 89 c7             	mov    %rax,%rdi
+  802a00:	48 b8 4f 23 80 00 00 	movabs $0x80234f,%rax
+  802a07:	00 00 00 
+  802a0a:	ff d0                	call   *%rax
+}
+  802a0c:	48 83 c4 18          	add    $0x18,%rsp
+  802a10:	5b                   	pop    %rbx
+  802a11:	41 5c                	pop    %r12
+  802a13:	41 5d                	pop    %r13
+  802a15:	41 5e                	pop    %r14
+  802a17:	41 5f                	pop    %r15
+  802a19:	5d                   	pop    %rbp
+  802a1a:	c3                   	ret
+            return res;
+  802a1b:	48 98                	cltq
+  802a1d:	eb ed                	jmp    802a0c <devfile_write_direct+0xea>
+
+0000000000802a1f <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802a1f:	55                   	push   %rbp
+  802a20:	48 89 e5             	mov    %rsp,%rbp
+  802a23:	41 54                	push   %r12
+  802a25:	53                   	push   %rbx
+  802a26:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802a29:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802a30:	00 00 00 
+  802a33:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802a35:	48 85 c0             	test   %rax,%rax
+  802a38:	74 71                	je     802aab <fbuf_flush+0x8c>
+  802a3a:	48 89 c3             	mov    %rax,%rbx
+  802a3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a42:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802a46:	75 05                	jne    802a4d <fbuf_flush+0x2e>
+}
+  802a48:	5b                   	pop    %rbx
+  802a49:	41 5c                	pop    %r12
+  802a4b:	5d                   	pop    %rbp
+  802a4c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802a4d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802a50:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802a54:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802a5b:	00 00 00 
+  802a5e:	48 89 de             	mov    %rbx,%rsi
+  802a61:	48 29 c6             	sub    %rax,%rsi
+  802a64:	48 c1 fe 03          	sar    $0x3,%rsi
+  802a68:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a6f:	aa aa aa 
+  802a72:	48 0f af f0          	imul   %rax,%rsi
+  802a76:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802a7a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a7f:	48 01 c6             	add    %rax,%rsi
+  802a82:	4c 89 e7             	mov    %r12,%rdi
+  802a85:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802a91:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802a95:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802a9c:	00 
+    return res < 0 ? res : 0;
+  802a9d:	48 85 c0             	test   %rax,%rax
+  802aa0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aa5:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802aa9:	eb 9d                	jmp    802a48 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802aab:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab0:	eb 96                	jmp    802a48 <fbuf_flush+0x29>
+
+0000000000802ab2 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802ab2:	55                   	push   %rbp
+  802ab3:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802ab6:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+}
+  802ac2:	5d                   	pop    %rbp
+  802ac3:	c3                   	ret
+
+0000000000802ac4 <devfile_write>:
+    if (!fd || !buf)
+  802ac4:	48 85 ff             	test   %rdi,%rdi
+  802ac7:	0f 84 d3 01 00 00    	je     802ca0 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	41 57                	push   %r15
+  802ad3:	41 56                	push   %r14
+  802ad5:	41 55                	push   %r13
+  802ad7:	41 54                	push   %r12
+  802ad9:	53                   	push   %rbx
+  802ada:	48 83 ec 08          	sub    $0x8,%rsp
+  802ade:	49 89 fc             	mov    %rdi,%r12
+  802ae1:	49 89 f6             	mov    %rsi,%r14
+  802ae4:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802ae7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802aec:	48 85 f6             	test   %rsi,%rsi
+  802aef:	0f 84 9c 01 00 00    	je     802c91 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802af5:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802b04:	48 85 c0             	test   %rax,%rax
+  802b07:	0f 84 a2 00 00 00    	je     802baf <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b0d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b12:	4c 89 e7             	mov    %r12,%rdi
+  802b15:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802b21:	83 f8 02             	cmp    $0x2,%eax
+  802b24:	0f 8f 85 00 00 00    	jg     802baf <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802b2a:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802b31:	00 00 00 
+  802b34:	4d 89 ef             	mov    %r13,%r15
+  802b37:	49 29 c7             	sub    %rax,%r15
+  802b3a:	49 c1 ff 03          	sar    $0x3,%r15
+  802b3e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b45:	aa aa aa 
+  802b48:	4c 0f af f8          	imul   %rax,%r15
+  802b4c:	49 c1 e7 0e          	shl    $0xe,%r15
+  802b50:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b55:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802b58:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b5d:	0f 84 d7 00 00 00    	je     802c3a <devfile_write+0x176>
+  802b63:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802b67:	89 c2                	mov    %eax,%edx
+  802b69:	41 03 55 0c          	add    0xc(%r13),%edx
+  802b6d:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802b72:	75 0f                	jne    802b83 <devfile_write+0xbf>
+  802b74:	48 01 d8             	add    %rbx,%rax
+  802b77:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802b7d:	0f 86 92 00 00 00    	jbe    802c15 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b83:	4c 89 e7             	mov    %r12,%rdi
+  802b86:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	78 52                	js     802be8 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b96:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b9d:	77 7f                	ja     802c1e <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802b9f:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ba4:	0f 85 c2 00 00 00    	jne    802c6c <devfile_write+0x1a8>
+  802baa:	e9 94 00 00 00       	jmp    802c43 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802baf:	4c 89 e7             	mov    %r12,%rdi
+  802bb2:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  802bb9:	00 00 00 
+  802bbc:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bbe:	85 c0                	test   %eax,%eax
+  802bc0:	79 07                	jns    802bc9 <devfile_write+0x105>
+  802bc2:	48 98                	cltq
+  802bc4:	e9 c8 00 00 00       	jmp    802c91 <devfile_write+0x1cd>
+  802bc9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802bce:	48 89 da             	mov    %rbx,%rdx
+  802bd1:	4c 89 f6             	mov    %r14,%rsi
+  802bd4:	4c 89 e7             	mov    %r12,%rdi
+  802bd7:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802bde:	00 00 00 
+  802be1:	ff d0                	call   *%rax
+  802be3:	e9 a9 00 00 00       	jmp    802c91 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802be8:	48 98                	cltq
+  802bea:	e9 a2 00 00 00       	jmp    802c91 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802bef:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802bf4:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bf9:	4c 89 fe             	mov    %r15,%rsi
+  802bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c01:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802c0d:	85 c0                	test   %eax,%eax
+  802c0f:	79 45                	jns    802c56 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c11:	48 98                	cltq
+  802c13:	eb 7c                	jmp    802c91 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c15:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c1c:	76 4e                	jbe    802c6c <devfile_write+0x1a8>
+  802c1e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c23:	48 89 da             	mov    %rbx,%rdx
+  802c26:	4c 89 f6             	mov    %r14,%rsi
+  802c29:	4c 89 e7             	mov    %r12,%rdi
+  802c2c:	48 b8 22 29 80 00 00 	movabs $0x802922,%rax
+  802c33:	00 00 00 
+  802c36:	ff d0                	call   *%rax
+  802c38:	eb 57                	jmp    802c91 <devfile_write+0x1cd>
+  802c3a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c41:	77 db                	ja     802c1e <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802c43:	4c 89 ff             	mov    %r15,%rdi
+  802c46:	48 b8 ed 41 80 00 00 	movabs $0x8041ed,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  802c52:	84 c0                	test   %al,%al
+  802c54:	74 99                	je     802bef <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802c56:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802c5b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c60:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802c64:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802c6b:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802c6c:	4c 89 ff             	mov    %r15,%rdi
+  802c6f:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802c73:	48 89 da             	mov    %rbx,%rdx
+  802c76:	4c 89 f6             	mov    %r14,%rsi
+  802c79:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  802c80:	00 00 00 
+  802c83:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802c85:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802c89:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802c8e:	48 89 d8             	mov    %rbx,%rax
+}
+  802c91:	48 83 c4 08          	add    $0x8,%rsp
+  802c95:	5b                   	pop    %rbx
+  802c96:	41 5c                	pop    %r12
+  802c98:	41 5d                	pop    %r13
+  802c9a:	41 5e                	pop    %r14
+  802c9c:	41 5f                	pop    %r15
+  802c9e:	5d                   	pop    %rbp
+  802c9f:	c3                   	ret
+        return E_INVAL;
+  802ca0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ca5:	c3                   	ret
+
+0000000000802ca6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ca6:	55                   	push   %rbp
+  802ca7:	48 89 e5             	mov    %rsp,%rbp
+  802caa:	41 54                	push   %r12
+  802cac:	53                   	push   %rbx
+  802cad:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802cb0:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+  802cbc:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802cbf:	48 89 df             	mov    %rbx,%rdi
+  802cc2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+  802cce:	48 85 c0             	test   %rax,%rax
+  802cd1:	74 17                	je     802cea <devfile_flush+0x44>
+  802cd3:	48 89 df             	mov    %rbx,%rdi
+  802cd6:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802cdd:	00 00 00 
+  802ce0:	ff d0                	call   *%rax
+  802ce2:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ce9:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802cea:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ced:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  802cf4:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802cf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cfb:	be 00 00 00 00       	mov    $0x0,%esi
+  802d00:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d05:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  802d0c:	00 00 00 
+  802d0f:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d11:	45 85 e4             	test   %r12d,%r12d
+  802d14:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d18:	5b                   	pop    %rbx
+  802d19:	41 5c                	pop    %r12
+  802d1b:	5d                   	pop    %rbp
+  802d1c:	c3                   	ret
+
+0000000000802d1d <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802d1d:	55                   	push   %rbp
+  802d1e:	48 89 e5             	mov    %rsp,%rbp
+  802d21:	41 57                	push   %r15
+  802d23:	41 56                	push   %r14
+  802d25:	41 55                	push   %r13
+  802d27:	41 54                	push   %r12
+  802d29:	53                   	push   %rbx
+  802d2a:	48 83 ec 38          	sub    $0x38,%rsp
+  802d2e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802d32:	49 89 f7             	mov    %rsi,%r15
+  802d35:	48 89 d3             	mov    %rdx,%rbx
+  802d38:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802d3b:	48 b8 68 22 80 00 00 	movabs $0x802268,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d47:	48 85 c0             	test   %rax,%rax
+  802d4a:	75 20                	jne    802d6c <devfile_read_direct+0x4f>
+    bool map = 1;
+  802d4c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802d51:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d58:	00 
+    while (n) {
+  802d59:	48 85 db             	test   %rbx,%rbx
+  802d5c:	0f 85 df 00 00 00    	jne    802e41 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802d62:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802d66:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d6a:	eb 21                	jmp    802d8d <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d6c:	45 89 f1             	mov    %r14d,%r9d
+  802d6f:	49 89 d8             	mov    %rbx,%r8
+  802d72:	4c 89 f9             	mov    %r15,%rcx
+  802d75:	ba 03 00 00 00       	mov    $0x3,%edx
+  802d7a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d7e:	48 89 c7             	mov    %rax,%rdi
+  802d81:	48 b8 4f 23 80 00 00 	movabs $0x80234f,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+}
+  802d8d:	48 83 c4 38          	add    $0x38,%rsp
+  802d91:	5b                   	pop    %rbx
+  802d92:	41 5c                	pop    %r12
+  802d94:	41 5d                	pop    %r13
+  802d96:	41 5e                	pop    %r14
+  802d98:	41 5f                	pop    %r15
+  802d9a:	5d                   	pop    %rbp
+  802d9b:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d9c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802da0:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802da6:	75 1e                	jne    802dc6 <devfile_read_direct+0xa9>
+  802da8:	e9 e2 00 00 00       	jmp    802e8f <devfile_read_direct+0x172>
+            if (!res) return read;
+  802dad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802db1:	eb da                	jmp    802d8d <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802db3:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802db7:	0f 85 d0 01 00 00    	jne    802f8d <devfile_read_direct+0x270>
+            map = 0;
+  802dbd:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802dc1:	eb 03                	jmp    802dc6 <devfile_read_direct+0xa9>
+  802dc3:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802dc6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802dcb:	48 39 d3             	cmp    %rdx,%rbx
+  802dce:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802dd2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802dd6:	8b 40 0c             	mov    0xc(%rax),%eax
+  802dd9:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  802de0:	00 00 00 
+  802de3:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802de5:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802de9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ded:	be 00 00 00 00       	mov    $0x0,%esi
+  802df2:	bf 03 00 00 00       	mov    $0x3,%edi
+  802df7:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  802dfe:	00 00 00 
+  802e01:	ff d0                	call   *%rax
+        if (res <= 0)
+  802e03:	85 c0                	test   %eax,%eax
+  802e05:	0f 8e 63 01 00 00    	jle    802f6e <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802e0b:	4c 63 e0             	movslq %eax,%r12
+  802e0e:	4c 89 e2             	mov    %r12,%rdx
+  802e11:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  802e18:	00 00 00 
+  802e1b:	4c 89 ff             	mov    %r15,%rdi
+  802e1e:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  802e25:	00 00 00 
+  802e28:	ff d0                	call   *%rax
+        buf += res;
+  802e2a:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802e2d:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802e30:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802e34:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802e38:	48 85 db             	test   %rbx,%rbx
+  802e3b:	0f 84 25 ff ff ff    	je     802d66 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802e41:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802e44:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802e48:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802e4c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e50:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802e57:	0f 97 c2             	seta   %dl
+  802e5a:	20 c2                	and    %al,%dl
+  802e5c:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802e5f:	0f 84 5e ff ff ff    	je     802dc3 <devfile_read_direct+0xa6>
+  802e65:	4c 89 fa             	mov    %r15,%rdx
+  802e68:	4d 89 fd             	mov    %r15,%r13
+  802e6b:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802e72:	0f 85 4e ff ff ff    	jne    802dc6 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802e78:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802e7c:	0f 84 1a ff ff ff    	je     802d9c <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e82:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e89:	0f 85 37 ff ff ff    	jne    802dc6 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802e8f:	48 89 d8             	mov    %rbx,%rax
+  802e92:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e98:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802e9d:	48 39 c8             	cmp    %rcx,%rax
+  802ea0:	48 0f 47 c1          	cmova  %rcx,%rax
+  802ea4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ea8:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802eac:	49 89 d4             	mov    %rdx,%r12
+  802eaf:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802eb3:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  802eba:	00 00 00 
+  802ebd:	ff d0                	call   *%rax
+  802ebf:	a8 40                	test   $0x40,%al
+  802ec1:	0f 85 b9 00 00 00    	jne    802f80 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802ec7:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802ece:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed2:	49 39 c5             	cmp    %rax,%r13
+  802ed5:	72 d8                	jb     802eaf <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ed7:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802edb:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802ee2:	00 00 00 
+  802ee5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ee9:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802eec:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802eee:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802ef2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802ef6:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  802efd:	00 00 00 
+  802f00:	ff d0                	call   *%rax
+  802f02:	89 c7                	mov    %eax,%edi
+  802f04:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f0a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f0f:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802f16:	00 00 00 
+  802f19:	be 0e 00 00 00       	mov    $0xe,%esi
+  802f1e:	48 b8 1c 19 80 00 00 	movabs $0x80191c,%rax
+  802f25:	00 00 00 
+  802f28:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802f2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f2f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f33:	4c 89 fe             	mov    %r15,%rsi
+  802f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f3b:	48 b8 f8 18 80 00 00 	movabs $0x8018f8,%rax
+  802f42:	00 00 00 
+  802f45:	ff d0                	call   *%rax
+  802f47:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802f4a:	48 85 d2             	test   %rdx,%rdx
+  802f4d:	0f 84 5a fe ff ff    	je     802dad <devfile_read_direct+0x90>
+            if (res > 0) {
+  802f53:	0f 8e 5a fe ff ff    	jle    802db3 <devfile_read_direct+0x96>
+                buf += res;
+  802f59:	48 98                	cltq
+  802f5b:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802f5e:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802f61:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802f65:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802f69:	e9 ca fe ff ff       	jmp    802e38 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802f6e:	41 89 c5             	mov    %eax,%r13d
+  802f71:	48 98                	cltq
+  802f73:	45 85 ed             	test   %r13d,%r13d
+  802f76:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802f7b:	e9 0d fe ff ff       	jmp    802d8d <devfile_read_direct+0x70>
+            map = 0;
+  802f80:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f84:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f88:	e9 39 fe ff ff       	jmp    802dc6 <devfile_read_direct+0xa9>
+  802f8d:	48 89 d0             	mov    %rdx,%rax
+  802f90:	e9 f8 fd ff ff       	jmp    802d8d <devfile_read_direct+0x70>
+
+0000000000802f95 <devfile_read>:
+    if (!fd || !buf)
+  802f95:	48 85 ff             	test   %rdi,%rdi
+  802f98:	0f 84 21 02 00 00    	je     8031bf <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f9e:	55                   	push   %rbp
+  802f9f:	48 89 e5             	mov    %rsp,%rbp
+  802fa2:	41 57                	push   %r15
+  802fa4:	41 56                	push   %r14
+  802fa6:	41 55                	push   %r13
+  802fa8:	41 54                	push   %r12
+  802faa:	53                   	push   %rbx
+  802fab:	48 83 ec 28          	sub    $0x28,%rsp
+  802faf:	48 89 fb             	mov    %rdi,%rbx
+  802fb2:	49 89 f4             	mov    %rsi,%r12
+  802fb5:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802fb8:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802fbd:	48 85 f6             	test   %rsi,%rsi
+  802fc0:	74 4b                	je     80300d <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802fc2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+  802fce:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802fd1:	48 85 c0             	test   %rax,%rax
+  802fd4:	74 22                	je     802ff8 <devfile_read+0x63>
+  802fd6:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802fdd:	77 19                	ja     802ff8 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802fdf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802fe4:	48 89 df             	mov    %rbx,%rdi
+  802fe7:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ff3:	83 f8 02             	cmp    $0x2,%eax
+  802ff6:	7e 40                	jle    803038 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ff8:	48 89 df             	mov    %rbx,%rdi
+  802ffb:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803007:	85 c0                	test   %eax,%eax
+  803009:	79 11                	jns    80301c <devfile_read+0x87>
+  80300b:	48 98                	cltq
+}
+  80300d:	48 83 c4 28          	add    $0x28,%rsp
+  803011:	5b                   	pop    %rbx
+  803012:	41 5c                	pop    %r12
+  803014:	41 5d                	pop    %r13
+  803016:	41 5e                	pop    %r14
+  803018:	41 5f                	pop    %r15
+  80301a:	5d                   	pop    %rbp
+  80301b:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80301c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803021:	4c 89 ea             	mov    %r13,%rdx
+  803024:	4c 89 e6             	mov    %r12,%rsi
+  803027:	48 89 df             	mov    %rbx,%rdi
+  80302a:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	eb d5                	jmp    80300d <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803038:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80303c:	48 89 df             	mov    %rbx,%rdi
+  80303f:	48 b8 1f 2a 80 00 00 	movabs $0x802a1f,%rax
+  803046:	00 00 00 
+  803049:	ff d0                	call   *%rax
+  80304b:	85 c0                	test   %eax,%eax
+  80304d:	0f 88 33 01 00 00    	js     803186 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803053:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  80305a:	00 00 00 
+  80305d:	4c 89 f0             	mov    %r14,%rax
+  803060:	48 29 d0             	sub    %rdx,%rax
+  803063:	48 c1 f8 03          	sar    $0x3,%rax
+  803067:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80306e:	aa aa aa 
+  803071:	48 0f af c2          	imul   %rdx,%rax
+  803075:	48 c1 e0 0e          	shl    $0xe,%rax
+  803079:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80307d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803080:	41 39 06             	cmp    %eax,(%r14)
+  803083:	75 0d                	jne    803092 <devfile_read+0xfd>
+  803085:	8b 43 10             	mov    0x10(%rbx),%eax
+  803088:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80308c:	0f 84 fb 00 00 00    	je     80318d <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803092:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803097:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80309b:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80309e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030a2:	48 89 c7             	mov    %rax,%rdi
+  8030a5:	48 b8 ed 41 80 00 00 	movabs $0x8041ed,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+  8030b1:	84 c0                	test   %al,%al
+  8030b3:	75 27                	jne    8030dc <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030b5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030ba:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8030bf:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030c8:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  8030cf:	00 00 00 
+  8030d2:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8030d4:	85 c0                	test   %eax,%eax
+  8030d6:	0f 88 dc 00 00 00    	js     8031b8 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8030dc:	44 89 f8             	mov    %r15d,%eax
+  8030df:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8030e4:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8030e6:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8030ed:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8030ee:	8b 43 10             	mov    0x10(%rbx),%eax
+  8030f1:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8030f5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8030f8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8030fd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803101:	48 89 df             	mov    %rbx,%rdi
+  803104:	48 b8 1d 2d 80 00 00 	movabs $0x802d1d,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803110:	48 85 c0             	test   %rax,%rax
+  803113:	0f 88 f4 fe ff ff    	js     80300d <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803119:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80311c:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80311f:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803122:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803126:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80312a:	48 63 d1             	movslq %ecx,%rdx
+  80312d:	48 01 d0             	add    %rdx,%rax
+  803130:	4d 63 ff             	movslq %r15d,%r15
+  803133:	4c 29 f8             	sub    %r15,%rax
+  803136:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313b:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80313f:	48 85 c0             	test   %rax,%rax
+  803142:	0f 8e c5 fe ff ff    	jle    80300d <devfile_read+0x78>
+    n = MIN(n, res);
+  803148:	4c 39 e8             	cmp    %r13,%rax
+  80314b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80314f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803152:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803156:	48 63 f6             	movslq %esi,%rsi
+  803159:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80315e:	48 01 c6             	add    %rax,%rsi
+  803161:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803165:	48 01 c6             	add    %rax,%rsi
+  803168:	4c 89 ea             	mov    %r13,%rdx
+  80316b:	4c 89 e7             	mov    %r12,%rdi
+  80316e:	48 b8 d9 10 80 00 00 	movabs $0x8010d9,%rax
+  803175:	00 00 00 
+  803178:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80317a:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80317e:	4c 89 e8             	mov    %r13,%rax
+  803181:	e9 87 fe ff ff       	jmp    80300d <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803186:	48 98                	cltq
+  803188:	e9 80 fe ff ff       	jmp    80300d <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80318d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803191:	41 39 d7             	cmp    %edx,%r15d
+  803194:	0f 8c f8 fe ff ff    	jl     803092 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80319a:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80319e:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8031a1:	41 39 cf             	cmp    %ecx,%r15d
+  8031a4:	0f 8d e8 fe ff ff    	jge    803092 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8031aa:	4d 63 ff             	movslq %r15d,%r15
+  8031ad:	4c 29 f8             	sub    %r15,%rax
+  8031b0:	48 63 d2             	movslq %edx,%rdx
+  8031b3:	48 01 d0             	add    %rdx,%rax
+  8031b6:	eb 87                	jmp    80313f <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8031b8:	48 98                	cltq
+  8031ba:	e9 4e fe ff ff       	jmp    80300d <devfile_read+0x78>
+        return E_INVAL;
+  8031bf:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8031c4:	c3                   	ret
+
+00000000008031c5 <fs_channel>:
+fs_channel(bool enable) {
+  8031c5:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8031c7:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  8031ce:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8031d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031d5:	40 84 ff             	test   %dil,%dil
+  8031d8:	74 47                	je     803221 <fs_channel+0x5c>
+  8031da:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8031e1:	00 00 00 
+  8031e4:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8031ea:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  8031f1:	00 00 00 
+  8031f4:	3b 08                	cmp    (%rax),%ecx
+  8031f6:	74 29                	je     803221 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8031f8:	55                   	push   %rbp
+  8031f9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8031fc:	48 b8 45 21 80 00 00 	movabs $0x802145,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+  803208:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80320a:	85 c0                	test   %eax,%eax
+  80320c:	78 04                	js     803212 <fs_channel+0x4d>
+}
+  80320e:	89 d0                	mov    %edx,%eax
+  803210:	5d                   	pop    %rbp
+  803211:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803212:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  803219:	00 00 00 
+  80321c:	c6 00 00             	movb   $0x0,(%rax)
+  80321f:	eb ed                	jmp    80320e <fs_channel+0x49>
+}
+  803221:	89 d0                	mov    %edx,%eax
+  803223:	c3                   	ret
+
+0000000000803224 <open>:
+open(const char *path, int mode) {
+  803224:	55                   	push   %rbp
+  803225:	48 89 e5             	mov    %rsp,%rbp
+  803228:	41 55                	push   %r13
+  80322a:	41 54                	push   %r12
+  80322c:	53                   	push   %rbx
+  80322d:	48 83 ec 18          	sub    $0x18,%rsp
+  803231:	49 89 fc             	mov    %rdi,%r12
+  803234:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803237:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  80323e:	00 00 00 
+  803241:	ff d0                	call   *%rax
+  803243:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803249:	0f 87 8f 00 00 00    	ja     8032de <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80324f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803253:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+  80325f:	89 c3                	mov    %eax,%ebx
+  803261:	85 c0                	test   %eax,%eax
+  803263:	78 55                	js     8032ba <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803265:	4c 89 e6             	mov    %r12,%rsi
+  803268:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  80326f:	00 00 00 
+  803272:	48 89 df             	mov    %rbx,%rdi
+  803275:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  80327c:	00 00 00 
+  80327f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803281:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803288:	ba 00 00 00 00       	mov    $0x0,%edx
+  80328d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803291:	bf 01 00 00 00       	mov    $0x1,%edi
+  803296:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  80329d:	00 00 00 
+  8032a0:	ff d0                	call   *%rax
+  8032a2:	89 c3                	mov    %eax,%ebx
+  8032a4:	85 c0                	test   %eax,%eax
+  8032a6:	78 1f                	js     8032c7 <open+0xa3>
+    return fd2num(fd);
+  8032a8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032ac:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+  8032b8:	89 c3                	mov    %eax,%ebx
+}
+  8032ba:	89 d8                	mov    %ebx,%eax
+  8032bc:	48 83 c4 18          	add    $0x18,%rsp
+  8032c0:	5b                   	pop    %rbx
+  8032c1:	41 5c                	pop    %r12
+  8032c3:	41 5d                	pop    %r13
+  8032c5:	5d                   	pop    %rbp
+  8032c6:	c3                   	ret
+        fd_close(fd, 0);
+  8032c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8032cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032d0:	48 b8 1a 1b 80 00 00 	movabs $0x801b1a,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+        return res;
+  8032dc:	eb dc                	jmp    8032ba <open+0x96>
+        return -E_BAD_PATH;
+  8032de:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8032e3:	eb d5                	jmp    8032ba <open+0x96>
+
+00000000008032e5 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8032e5:	55                   	push   %rbp
+  8032e6:	48 89 e5             	mov    %rsp,%rbp
+  8032e9:	41 56                	push   %r14
+  8032eb:	41 55                	push   %r13
+  8032ed:	41 54                	push   %r12
+  8032ef:	53                   	push   %rbx
+  8032f0:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8032f4:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  8032fb:	00 00 00 
+  8032fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803303:	49 bd 5f 1a 80 00 00 	movabs $0x801a5f,%r13
+  80330a:	00 00 00 
+  80330d:	49 be 1f 2a 80 00 00 	movabs $0x802a1f,%r14
+  803314:	00 00 00 
+  803317:	eb 0c                	jmp    803325 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803319:	83 c3 01             	add    $0x1,%ebx
+  80331c:	49 83 c4 18          	add    $0x18,%r12
+  803320:	83 fb 20             	cmp    $0x20,%ebx
+  803323:	74 1d                	je     803342 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803325:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80332a:	74 ed                	je     803319 <file_flush_buffers+0x34>
+  80332c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803330:	89 df                	mov    %ebx,%edi
+  803332:	41 ff d5             	call   *%r13
+  803335:	85 c0                	test   %eax,%eax
+  803337:	78 e0                	js     803319 <file_flush_buffers+0x34>
+  803339:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80333d:	41 ff d6             	call   *%r14
+  803340:	eb d7                	jmp    803319 <file_flush_buffers+0x34>
+}
+  803342:	48 83 c4 10          	add    $0x10,%rsp
+  803346:	5b                   	pop    %rbx
+  803347:	41 5c                	pop    %r12
+  803349:	41 5d                	pop    %r13
+  80334b:	41 5e                	pop    %r14
+  80334d:	5d                   	pop    %rbp
+  80334e:	c3                   	ret
+
+000000000080334f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80334f:	55                   	push   %rbp
+  803350:	48 89 e5             	mov    %rsp,%rbp
+  803353:	41 54                	push   %r12
+  803355:	53                   	push   %rbx
+  803356:	49 89 fc             	mov    %rdi,%r12
+  803359:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80335b:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  803362:	00 00 00 
+  803365:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803367:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80336e:	00 00 00 
+  803371:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803376:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803378:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80337b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803380:	be 00 00 00 00       	mov    $0x0,%esi
+  803385:	bf 02 00 00 00       	mov    $0x2,%edi
+  80338a:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+}
+  803396:	5b                   	pop    %rbx
+  803397:	41 5c                	pop    %r12
+  803399:	5d                   	pop    %rbp
+  80339a:	c3                   	ret
+
+000000000080339b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80339b:	55                   	push   %rbp
+  80339c:	48 89 e5             	mov    %rsp,%rbp
+  80339f:	41 54                	push   %r12
+  8033a1:	53                   	push   %rbx
+  8033a2:	49 89 fc             	mov    %rdi,%r12
+  8033a5:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8033a8:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  8033af:	00 00 00 
+  8033b2:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8033b4:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8033b9:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8033c0:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8033c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c7:	be 00 00 00 00       	mov    $0x0,%esi
+  8033cc:	bf 05 00 00 00       	mov    $0x5,%edi
+  8033d1:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  8033d8:	00 00 00 
+  8033db:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033dd:	85 c0                	test   %eax,%eax
+  8033df:	78 3d                	js     80341e <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8033e1:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  8033e8:	00 00 00 
+  8033eb:	4c 89 e6             	mov    %r12,%rsi
+  8033ee:	48 89 df             	mov    %rbx,%rdi
+  8033f1:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  8033f8:	00 00 00 
+  8033fb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8033fd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803404:	00 
+  803405:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80340b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803412:	00 
+  803413:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803419:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80341e:	5b                   	pop    %rbx
+  80341f:	41 5c                	pop    %r12
+  803421:	5d                   	pop    %rbp
+  803422:	c3                   	ret
+
+0000000000803423 <remove>:
+remove(const char *path) {
+  803423:	55                   	push   %rbp
+  803424:	48 89 e5             	mov    %rsp,%rbp
+  803427:	53                   	push   %rbx
+  803428:	48 83 ec 08          	sub    $0x8,%rsp
+  80342c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80342f:	48 b8 3a 0e 80 00 00 	movabs $0x800e3a,%rax
+  803436:	00 00 00 
+  803439:	ff d0                	call   *%rax
+  80343b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803441:	77 3a                	ja     80347d <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803443:	48 89 de             	mov    %rbx,%rsi
+  803446:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  80344d:	00 00 00 
+  803450:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  803457:	00 00 00 
+  80345a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80345c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803461:	be 00 00 00 00       	mov    $0x0,%esi
+  803466:	bf 07 00 00 00       	mov    $0x7,%edi
+  80346b:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  803472:	00 00 00 
+  803475:	ff d0                	call   *%rax
+}
+  803477:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80347b:	c9                   	leave
+  80347c:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80347d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803482:	eb f3                	jmp    803477 <remove+0x54>
+
+0000000000803484 <sync>:
+sync(void) {
+  803484:	55                   	push   %rbp
+  803485:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803488:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  80348f:	00 00 00 
+  803492:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803494:	ba 00 00 00 00       	mov    $0x0,%edx
+  803499:	be 00 00 00 00       	mov    $0x0,%esi
+  80349e:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034a3:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+}
+  8034af:	5d                   	pop    %rbp
+  8034b0:	c3                   	ret
+
+00000000008034b1 <fsync>:
+fsync(int fdnum) {
+  8034b1:	55                   	push   %rbp
+  8034b2:	48 89 e5             	mov    %rsp,%rbp
+  8034b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034bd:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  8034c4:	00 00 00 
+  8034c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034c9:	85 c0                	test   %eax,%eax
+  8034cb:	78 4b                	js     803518 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8034d1:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8034d8:	00 00 00 
+  8034db:	8b 00                	mov    (%rax),%eax
+  8034dd:	39 02                	cmp    %eax,(%rdx)
+  8034df:	75 39                	jne    80351a <fsync+0x69>
+    file_flush_buffers();
+  8034e1:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8034ed:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8034f1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8034f4:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8034fb:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8034fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803502:	be 00 00 00 00       	mov    $0x0,%esi
+  803507:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80350c:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  803513:	00 00 00 
+  803516:	ff d0                	call   *%rax
+}
+  803518:	c9                   	leave
+  803519:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80351a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80351f:	eb f7                	jmp    803518 <fsync+0x67>
+
+0000000000803521 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803521:	55                   	push   %rbp
+  803522:	48 89 e5             	mov    %rsp,%rbp
+  803525:	53                   	push   %rbx
+  803526:	48 83 ec 08          	sub    $0x8,%rsp
+  80352a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80352d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803532:	be 00 00 00 00       	mov    $0x0,%esi
+  803537:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80353c:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  803543:	00 00 00 
+  803546:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803548:	85 c0                	test   %eax,%eax
+  80354a:	78 2d                	js     803579 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80354c:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803553:	00 00 00 
+  803556:	48 8b 10             	mov    (%rax),%rdx
+  803559:	48 89 13             	mov    %rdx,(%rbx)
+  80355c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803560:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803564:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803568:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80356c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803570:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803574:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803579:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80357d:	c9                   	leave
+  80357e:	c3                   	ret
+
+000000000080357f <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80357f:	55                   	push   %rbp
+  803580:	48 89 e5             	mov    %rsp,%rbp
+  803583:	53                   	push   %rbx
+  803584:	48 83 ec 08          	sub    $0x8,%rsp
+  803588:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80358b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803590:	be 00 00 00 00       	mov    $0x0,%esi
+  803595:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80359a:	48 b8 b6 27 80 00 00 	movabs $0x8027b6,%rax
+  8035a1:	00 00 00 
+  8035a4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035a6:	85 c0                	test   %eax,%eax
+  8035a8:	78 3d                	js     8035e7 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8035aa:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  8035b1:	00 00 00 
+  8035b4:	48 8b 10             	mov    (%rax),%rdx
+  8035b7:	48 89 13             	mov    %rdx,(%rbx)
+  8035ba:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035be:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8035c2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8035c6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8035ca:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8035ce:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8035d2:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8035d6:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8035da:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8035de:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8035e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035e7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035eb:	c9                   	leave
+  8035ec:	c3                   	ret
+
+00000000008035ed <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8035ed:	55                   	push   %rbp
+  8035ee:	48 89 e5             	mov    %rsp,%rbp
+  8035f1:	41 57                	push   %r15
+  8035f3:	41 56                	push   %r14
+  8035f5:	41 55                	push   %r13
+  8035f7:	41 54                	push   %r12
+  8035f9:	53                   	push   %rbx
+  8035fa:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8035fe:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803605:	00 
+  803606:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80360d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803613:	0f 85 43 01 00 00    	jne    80375c <munmap+0x16f>
+  803619:	49 89 ff             	mov    %rdi,%r15
+  80361c:	4c 39 f7             	cmp    %r14,%rdi
+  80361f:	0f 87 37 01 00 00    	ja     80375c <munmap+0x16f>
+  803625:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  80362c:	00 00 00 
+  80362f:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803635:	eb 2c                	jmp    803663 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803637:	4c 39 f8             	cmp    %r15,%rax
+  80363a:	0f 83 85 00 00 00    	jae    8036c5 <munmap+0xd8>
+            m->mm_end = start;
+  803640:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803645:	48 83 c3 18          	add    $0x18,%rbx
+  803649:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803650:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803657:	00 00 00 
+  80365a:	48 39 c3             	cmp    %rax,%rbx
+  80365d:	0f 84 d0 00 00 00    	je     803733 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803663:	49 89 dc             	mov    %rbx,%r12
+  803666:	48 8b 03             	mov    (%rbx),%rax
+  803669:	4c 39 f0             	cmp    %r14,%rax
+  80366c:	73 d7                	jae    803645 <munmap+0x58>
+  80366e:	48 85 c0             	test   %rax,%rax
+  803671:	74 d2                	je     803645 <munmap+0x58>
+  803673:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803677:	49 39 d7             	cmp    %rdx,%r15
+  80367a:	73 c9                	jae    803645 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80367c:	49 39 d6             	cmp    %rdx,%r14
+  80367f:	73 b6                	jae    803637 <munmap+0x4a>
+  803681:	49 39 c7             	cmp    %rax,%r15
+  803684:	76 b1                	jbe    803637 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803686:	4c 89 ef             	mov    %r13,%rdi
+  803689:	48 b8 24 27 80 00 00 	movabs $0x802724,%rax
+  803690:	00 00 00 
+  803693:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803695:	48 85 c0             	test   %rax,%rax
+  803698:	0f 84 c5 00 00 00    	je     803763 <munmap+0x176>
+            *tail = *m;
+  80369e:	48 8b 13             	mov    (%rbx),%rdx
+  8036a1:	48 89 10             	mov    %rdx,(%rax)
+  8036a4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036a8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8036ac:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8036b0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8036b4:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8036b7:	44 89 f2             	mov    %r14d,%edx
+  8036ba:	2b 13                	sub    (%rbx),%edx
+  8036bc:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8036bf:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8036c3:	eb 80                	jmp    803645 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8036c5:	49 39 d6             	cmp    %rdx,%r14
+  8036c8:	73 18                	jae    8036e2 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8036ca:	44 89 f2             	mov    %r14d,%edx
+  8036cd:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8036d2:	29 c2                	sub    %eax,%edx
+  8036d4:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8036d9:	4d 89 34 24          	mov    %r14,(%r12)
+  8036dd:	e9 63 ff ff ff       	jmp    803645 <munmap+0x58>
+    m->mm_start = 0;
+  8036e2:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8036e9:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8036ea:	4c 89 e6             	mov    %r12,%rsi
+  8036ed:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8036f4:	00 00 00 
+  8036f7:	48 29 c6             	sub    %rax,%rsi
+  8036fa:	48 c1 fe 03          	sar    $0x3,%rsi
+  8036fe:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803705:	aa aa aa 
+  803708:	48 0f af f0          	imul   %rax,%rsi
+  80370c:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803710:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803715:	48 01 c6             	add    %rax,%rsi
+  803718:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80371d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803722:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803729:	00 00 00 
+  80372c:	ff d0                	call   *%rax
+}
+  80372e:	e9 12 ff ff ff       	jmp    803645 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803733:	4c 89 f2             	mov    %r14,%rdx
+  803736:	4c 29 fa             	sub    %r15,%rdx
+  803739:	4c 89 fe             	mov    %r15,%rsi
+  80373c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803741:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  803748:	00 00 00 
+  80374b:	ff d0                	call   *%rax
+}
+  80374d:	48 83 c4 08          	add    $0x8,%rsp
+  803751:	5b                   	pop    %rbx
+  803752:	41 5c                	pop    %r12
+  803754:	41 5d                	pop    %r13
+  803756:	41 5e                	pop    %r14
+  803758:	41 5f                	pop    %r15
+  80375a:	5d                   	pop    %rbp
+  80375b:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80375c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803761:	eb ea                	jmp    80374d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803763:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803768:	eb e3                	jmp    80374d <munmap+0x160>
+
+000000000080376a <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80376a:	55                   	push   %rbp
+  80376b:	48 89 e5             	mov    %rsp,%rbp
+  80376e:	41 57                	push   %r15
+  803770:	41 56                	push   %r14
+  803772:	41 55                	push   %r13
+  803774:	41 54                	push   %r12
+  803776:	53                   	push   %rbx
+  803777:	48 83 ec 28          	sub    $0x28,%rsp
+  80377b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80377f:	49 89 f5             	mov    %rsi,%r13
+  803782:	41 89 d6             	mov    %edx,%r14d
+  803785:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803788:	41 89 cc             	mov    %ecx,%r12d
+  80378b:	44 89 c7             	mov    %r8d,%edi
+  80378e:	44 89 cb             	mov    %r9d,%ebx
+  803791:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803795:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803799:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  8037a0:	00 00 00 
+  8037a3:	ff d0                	call   *%rax
+  8037a5:	41 89 c7             	mov    %eax,%r15d
+  8037a8:	85 c0                	test   %eax,%eax
+  8037aa:	0f 88 ae 01 00 00    	js     80395e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037b0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037b4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8037bb:	00 00 00 
+  8037be:	8b 32                	mov    (%rdx),%esi
+  8037c0:	39 30                	cmp    %esi,(%rax)
+  8037c2:	0f 85 7a 02 00 00    	jne    803a42 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8037c8:	8b 40 08             	mov    0x8(%rax),%eax
+  8037cb:	83 e0 03             	and    $0x3,%eax
+  8037ce:	83 f8 01             	cmp    $0x1,%eax
+  8037d1:	0f 84 76 02 00 00    	je     803a4d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8037d7:	4d 85 ed             	test   %r13,%r13
+  8037da:	0f 84 78 02 00 00    	je     803a58 <mmap+0x2ee>
+  8037e0:	85 db                	test   %ebx,%ebx
+  8037e2:	0f 88 70 02 00 00    	js     803a58 <mmap+0x2ee>
+  8037e8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8037ee:	41 89 df             	mov    %ebx,%r15d
+  8037f1:	0f 85 6c 02 00 00    	jne    803a63 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8037f7:	44 89 f0             	mov    %r14d,%eax
+  8037fa:	83 e0 fd             	and    $0xfffffffd,%eax
+  8037fd:	83 f8 04             	cmp    $0x4,%eax
+  803800:	0f 85 68 02 00 00    	jne    803a6e <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803806:	44 89 e1             	mov    %r12d,%ecx
+  803809:	83 e1 01             	and    $0x1,%ecx
+  80380c:	0f 95 c2             	setne  %dl
+  80380f:	44 89 e0             	mov    %r12d,%eax
+  803812:	d1 e8                	shr    %eax
+  803814:	83 f0 01             	xor    $0x1,%eax
+  803817:	83 e0 01             	and    $0x1,%eax
+  80381a:	38 c2                	cmp    %al,%dl
+  80381c:	0f 85 57 02 00 00    	jne    803a79 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803822:	85 c9                	test   %ecx,%ecx
+  803824:	74 0a                	je     803830 <mmap+0xc6>
+  803826:	41 f6 c6 02          	test   $0x2,%r14b
+  80382a:	0f 85 54 02 00 00    	jne    803a84 <mmap+0x31a>
+    file_flush_buffers();
+  803830:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80383c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803843:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80384a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80384e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803851:	41 f6 c4 04          	test   $0x4,%r12b
+  803855:	0f 84 15 01 00 00    	je     803970 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80385b:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80385e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803864:	0f 85 25 02 00 00    	jne    803a8f <mmap+0x325>
+  80386a:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80386e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803875:	00 00 00 
+  803878:	48 39 c2             	cmp    %rax,%rdx
+  80387b:	0f 82 19 02 00 00    	jb     803a9a <mmap+0x330>
+  803881:	48 39 c7             	cmp    %rax,%rdi
+  803884:	0f 87 10 02 00 00    	ja     803a9a <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80388a:	4c 89 ee             	mov    %r13,%rsi
+  80388d:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  803894:	00 00 00 
+  803897:	ff d0                	call   *%rax
+  803899:	85 c0                	test   %eax,%eax
+  80389b:	0f 88 04 02 00 00    	js     803aa5 <mmap+0x33b>
+    if (!handler) {
+  8038a1:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8038a8:	00 00 00 
+  8038ab:	80 38 00             	cmpb   $0x0,(%rax)
+  8038ae:	75 2b                	jne    8038db <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038b0:	48 bf 85 26 80 00 00 	movabs $0x802685,%rdi
+  8038b7:	00 00 00 
+  8038ba:	48 b8 46 47 80 00 00 	movabs $0x804746,%rax
+  8038c1:	00 00 00 
+  8038c4:	ff d0                	call   *%rax
+  8038c6:	85 c0                	test   %eax,%eax
+  8038c8:	0f 88 ea 01 00 00    	js     803ab8 <mmap+0x34e>
+        handler = 1;
+  8038ce:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8038d5:	00 00 00 
+  8038d8:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8038db:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038df:	48 b8 24 27 80 00 00 	movabs $0x802724,%rax
+  8038e6:	00 00 00 
+  8038e9:	ff d0                	call   *%rax
+  8038eb:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8038ee:	48 85 c0             	test   %rax,%rax
+  8038f1:	0f 84 c9 01 00 00    	je     803ac0 <mmap+0x356>
+    m->mm_start = va;
+  8038f7:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8038fa:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8038fe:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803902:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803905:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803909:	44 89 e0             	mov    %r12d,%eax
+  80390c:	c1 e0 06             	shl    $0x6,%eax
+  80390f:	25 80 00 00 00       	and    $0x80,%eax
+  803914:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803917:	09 f0                	or     %esi,%eax
+  803919:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80391d:	41 f6 c4 08          	test   $0x8,%r12b
+  803921:	74 31                	je     803954 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803923:	48 39 d3             	cmp    %rdx,%rbx
+  803926:	73 2c                	jae    803954 <mmap+0x1ea>
+  803928:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80392d:	48 89 de             	mov    %rbx,%rsi
+  803930:	4c 89 f7             	mov    %r14,%rdi
+  803933:	48 b8 74 25 80 00 00 	movabs $0x802574,%rax
+  80393a:	00 00 00 
+  80393d:	ff d0                	call   *%rax
+  80393f:	49 89 c4             	mov    %rax,%r12
+  803942:	48 85 c0             	test   %rax,%rax
+  803945:	0f 8e d7 00 00 00    	jle    803a22 <mmap+0x2b8>
+            va += n;
+  80394b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80394e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803952:	72 d4                	jb     803928 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803954:	49 8b 06             	mov    (%r14),%rax
+  803957:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80395b:	48 89 06             	mov    %rax,(%rsi)
+}
+  80395e:	44 89 f8             	mov    %r15d,%eax
+  803961:	48 83 c4 28          	add    $0x28,%rsp
+  803965:	5b                   	pop    %rbx
+  803966:	41 5c                	pop    %r12
+  803968:	41 5d                	pop    %r13
+  80396a:	41 5e                	pop    %r14
+  80396c:	41 5f                	pop    %r15
+  80396e:	5d                   	pop    %rbp
+  80396f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803970:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803977:	00 00 00 
+  80397a:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80397d:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803984:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803987:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80398c:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  803993:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803996:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80399d:	00 00 00 
+  8039a0:	48 39 d7             	cmp    %rdx,%rdi
+  8039a3:	73 1c                	jae    8039c1 <mmap+0x257>
+        return -E_NO_MEM;
+  8039a5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039ab:	eb b1                	jmp    80395e <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039ad:	48 83 c0 01          	add    $0x1,%rax
+  8039b1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8039b5:	77 3f                	ja     8039f6 <mmap+0x28c>
+  8039b7:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8039bc:	48 39 d7             	cmp    %rdx,%rdi
+  8039bf:	72 2a                	jb     8039eb <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039c1:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8039c5:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8039c9:	48 39 d1             	cmp    %rdx,%rcx
+  8039cc:	73 df                	jae    8039ad <mmap+0x243>
+  8039ce:	48 85 c9             	test   %rcx,%rcx
+  8039d1:	74 da                	je     8039ad <mmap+0x243>
+  8039d3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8039d7:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8039dc:	48 39 d3             	cmp    %rdx,%rbx
+  8039df:	73 cc                	jae    8039ad <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8039e1:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039e9:	eb cc                	jmp    8039b7 <mmap+0x24d>
+        return -E_NO_MEM;
+  8039eb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039f1:	e9 68 ff ff ff       	jmp    80395e <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8039f6:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8039fb:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803a02:	00 00 00 
+  803a05:	48 39 c2             	cmp    %rax,%rdx
+  803a08:	0f 82 9f 00 00 00    	jb     803aad <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803a0e:	48 85 db             	test   %rbx,%rbx
+  803a11:	0f 85 8a fe ff ff    	jne    8038a1 <mmap+0x137>
+        return -E_NO_MEM;
+  803a17:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a1d:	e9 3c ff ff ff       	jmp    80395e <mmap+0x1f4>
+        if (n < 0) {
+  803a22:	0f 89 2c ff ff ff    	jns    803954 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803a28:	49 8b 3e             	mov    (%r14),%rdi
+  803a2b:	4c 89 ee             	mov    %r13,%rsi
+  803a2e:	48 b8 ed 35 80 00 00 	movabs $0x8035ed,%rax
+  803a35:	00 00 00 
+  803a38:	ff d0                	call   *%rax
+            return n;
+  803a3a:	45 89 e7             	mov    %r12d,%r15d
+  803a3d:	e9 1c ff ff ff       	jmp    80395e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803a42:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a48:	e9 11 ff ff ff       	jmp    80395e <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803a4d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a53:	e9 06 ff ff ff       	jmp    80395e <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803a58:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a5e:	e9 fb fe ff ff       	jmp    80395e <mmap+0x1f4>
+  803a63:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a69:	e9 f0 fe ff ff       	jmp    80395e <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803a6e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a74:	e9 e5 fe ff ff       	jmp    80395e <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803a79:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a7f:	e9 da fe ff ff       	jmp    80395e <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a84:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803a8a:	e9 cf fe ff ff       	jmp    80395e <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a8f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a95:	e9 c4 fe ff ff       	jmp    80395e <mmap+0x1f4>
+  803a9a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803aa0:	e9 b9 fe ff ff       	jmp    80395e <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803aa5:	41 89 c7             	mov    %eax,%r15d
+  803aa8:	e9 b1 fe ff ff       	jmp    80395e <mmap+0x1f4>
+        return -E_NO_MEM;
+  803aad:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ab3:	e9 a6 fe ff ff       	jmp    80395e <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803ab8:	41 89 c7             	mov    %eax,%r15d
+  803abb:	e9 9e fe ff ff       	jmp    80395e <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803ac0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ac6:	e9 93 fe ff ff       	jmp    80395e <mmap+0x1f4>
+
+0000000000803acb <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803acb:	55                   	push   %rbp
+  803acc:	48 89 e5             	mov    %rsp,%rbp
+  803acf:	41 54                	push   %r12
+  803ad1:	53                   	push   %rbx
+  803ad2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ad5:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803adc:	00 00 00 
+  803adf:	ff d0                	call   *%rax
+  803ae1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803ae4:	48 be 20 51 80 00 00 	movabs $0x805120,%rsi
+  803aeb:	00 00 00 
+  803aee:	48 89 df             	mov    %rbx,%rdi
+  803af1:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  803af8:	00 00 00 
+  803afb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803afd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b02:	41 2b 04 24          	sub    (%r12),%eax
+  803b06:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b0c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b13:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b16:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b1d:	00 00 00 
+  803b20:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b2c:	5b                   	pop    %rbx
+  803b2d:	41 5c                	pop    %r12
+  803b2f:	5d                   	pop    %rbp
+  803b30:	c3                   	ret
+
+0000000000803b31 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b31:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b34:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803b3a:	8b 17                	mov    (%rdi),%edx
+  803b3c:	85 d2                	test   %edx,%edx
+  803b3e:	75 01                	jne    803b41 <pipe_wakeup+0x10>
+  803b40:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b41:	55                   	push   %rbp
+  803b42:	48 89 e5             	mov    %rsp,%rbp
+  803b45:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803b48:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803b4e:	be 00 04 00 00       	mov    $0x400,%esi
+  803b53:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  803b5a:	00 00 00 
+  803b5d:	ff d0                	call   *%rax
+}
+  803b5f:	5d                   	pop    %rbp
+  803b60:	c3                   	ret
+
+0000000000803b61 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b61:	55                   	push   %rbp
+  803b62:	48 89 e5             	mov    %rsp,%rbp
+  803b65:	41 55                	push   %r13
+  803b67:	41 54                	push   %r12
+  803b69:	53                   	push   %rbx
+  803b6a:	48 83 ec 08          	sub    $0x8,%rsp
+  803b6e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b71:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803b78:	00 00 00 
+  803b7b:	ff d0                	call   *%rax
+  803b7d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b80:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b85:	4c 89 e6             	mov    %r12,%rsi
+  803b88:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b8d:	49 bc 7d 14 80 00 00 	movabs $0x80147d,%r12
+  803b94:	00 00 00 
+  803b97:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b9a:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b9e:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ba2:	49 bd 31 3b 80 00 00 	movabs $0x803b31,%r13
+  803ba9:	00 00 00 
+  803bac:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803baf:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bb3:	48 89 de             	mov    %rbx,%rsi
+  803bb6:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803bb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbe:	48 89 de             	mov    %rbx,%rsi
+  803bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc6:	41 ff d4             	call   *%r12
+  803bc9:	48 83 c4 08          	add    $0x8,%rsp
+  803bcd:	5b                   	pop    %rbx
+  803bce:	41 5c                	pop    %r12
+  803bd0:	41 5d                	pop    %r13
+  803bd2:	5d                   	pop    %rbp
+  803bd3:	c3                   	ret
+
+0000000000803bd4 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803bd4:	55                   	push   %rbp
+  803bd5:	48 89 e5             	mov    %rsp,%rbp
+  803bd8:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803bdb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803be0:	be 00 10 00 00       	mov    $0x1000,%esi
+  803be5:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  803bec:	00 00 00 
+  803bef:	ff d0                	call   *%rax
+  803bf1:	85 c0                	test   %eax,%eax
+  803bf3:	0f 94 c0             	sete   %al
+  803bf6:	0f b6 c0             	movzbl %al,%eax
+}
+  803bf9:	5d                   	pop    %rbp
+  803bfa:	c3                   	ret
+
+0000000000803bfb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803bfb:	55                   	push   %rbp
+  803bfc:	48 89 e5             	mov    %rsp,%rbp
+  803bff:	41 57                	push   %r15
+  803c01:	41 56                	push   %r14
+  803c03:	41 55                	push   %r13
+  803c05:	41 54                	push   %r12
+  803c07:	53                   	push   %rbx
+  803c08:	48 83 ec 38          	sub    $0x38,%rsp
+  803c0c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c10:	49 89 f4             	mov    %rsi,%r12
+  803c13:	49 89 d7             	mov    %rdx,%r15
+  803c16:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c1a:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803c21:	00 00 00 
+  803c24:	ff d0                	call   *%rax
+  803c26:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c29:	4d 85 ff             	test   %r15,%r15
+  803c2c:	0f 84 f1 00 00 00    	je     803d23 <devpipe_write+0x128>
+  803c32:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803c36:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803c3a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803c3e:	49 bd d4 3b 80 00 00 	movabs $0x803bd4,%r13
+  803c45:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c48:	49 bf 31 3b 80 00 00 	movabs $0x803b31,%r15
+  803c4f:	00 00 00 
+  803c52:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c5a:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803c5e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c61:	48 63 ce             	movslq %esi,%rcx
+  803c64:	48 63 03             	movslq (%rbx),%rax
+  803c67:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803c6d:	48 39 c1             	cmp    %rax,%rcx
+  803c70:	72 64                	jb     803cd6 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c72:	48 89 de             	mov    %rbx,%rsi
+  803c75:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c79:	41 ff d5             	call   *%r13
+  803c7c:	85 c0                	test   %eax,%eax
+  803c7e:	0f 85 b9 00 00 00    	jne    803d3d <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c84:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c88:	4c 89 f7             	mov    %r14,%rdi
+  803c8b:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803c8e:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c91:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803c98:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c9f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ca5:	8b 03                	mov    (%rbx),%eax
+  803ca7:	41 39 c4             	cmp    %eax,%r12d
+  803caa:	75 b2                	jne    803c5e <devpipe_write+0x63>
+  803cac:	48 89 de             	mov    %rbx,%rsi
+  803caf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cb3:	41 ff d5             	call   *%r13
+  803cb6:	85 c0                	test   %eax,%eax
+  803cb8:	75 a0                	jne    803c5a <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cba:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cbf:	44 89 e6             	mov    %r12d,%esi
+  803cc2:	48 89 df             	mov    %rbx,%rdi
+  803cc5:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  803ccc:	00 00 00 
+  803ccf:	ff d0                	call   *%rax
+  803cd1:	e9 7c ff ff ff       	jmp    803c52 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803cd6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803cda:	41 0f b6 38          	movzbl (%r8),%edi
+  803cde:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ce5:	80 80 80 
+  803ce8:	48 89 c8             	mov    %rcx,%rax
+  803ceb:	48 f7 e2             	mul    %rdx
+  803cee:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803cf2:	48 89 d0             	mov    %rdx,%rax
+  803cf5:	48 c1 e0 08          	shl    $0x8,%rax
+  803cf9:	48 29 d0             	sub    %rdx,%rax
+  803cfc:	48 c1 e0 04          	shl    $0x4,%rax
+  803d00:	48 29 c1             	sub    %rax,%rcx
+  803d03:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d08:	83 c6 01             	add    $0x1,%esi
+  803d0b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d0e:	49 83 c0 01          	add    $0x1,%r8
+  803d12:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803d16:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803d1a:	49 39 c0             	cmp    %rax,%r8
+  803d1d:	0f 85 2f ff ff ff    	jne    803c52 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d23:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803d27:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803d2b:	48 b8 31 3b 80 00 00 	movabs $0x803b31,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+    return n;
+  803d37:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803d3b:	eb 05                	jmp    803d42 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d42:	48 83 c4 38          	add    $0x38,%rsp
+  803d46:	5b                   	pop    %rbx
+  803d47:	41 5c                	pop    %r12
+  803d49:	41 5d                	pop    %r13
+  803d4b:	41 5e                	pop    %r14
+  803d4d:	41 5f                	pop    %r15
+  803d4f:	5d                   	pop    %rbp
+  803d50:	c3                   	ret
+
+0000000000803d51 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d51:	55                   	push   %rbp
+  803d52:	48 89 e5             	mov    %rsp,%rbp
+  803d55:	41 57                	push   %r15
+  803d57:	41 56                	push   %r14
+  803d59:	41 55                	push   %r13
+  803d5b:	41 54                	push   %r12
+  803d5d:	53                   	push   %rbx
+  803d5e:	48 83 ec 28          	sub    $0x28,%rsp
+  803d62:	49 89 fd             	mov    %rdi,%r13
+  803d65:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803d69:	49 89 d4             	mov    %rdx,%r12
+  803d6c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d70:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803d77:	00 00 00 
+  803d7a:	ff d0                	call   *%rax
+  803d7c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d7f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803d85:	49 bf d4 3b 80 00 00 	movabs $0x803bd4,%r15
+  803d8c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803d8f:	4d 85 e4             	test   %r12,%r12
+  803d92:	0f 84 d5 00 00 00    	je     803e6d <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d98:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803da0:	8b 03                	mov    (%rbx),%eax
+  803da2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803da5:	75 7a                	jne    803e21 <devpipe_read+0xd0>
+            if (i > 0) {
+  803da7:	4d 85 f6             	test   %r14,%r14
+  803daa:	75 50                	jne    803dfc <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803dac:	48 89 de             	mov    %rbx,%rsi
+  803daf:	4c 89 ef             	mov    %r13,%rdi
+  803db2:	41 ff d7             	call   *%r15
+  803db5:	85 c0                	test   %eax,%eax
+  803db7:	0f 85 c9 00 00 00    	jne    803e86 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803dbd:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803dc0:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803dc7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803dcd:	8b 43 04             	mov    0x4(%rbx),%eax
+  803dd0:	41 39 c4             	cmp    %eax,%r12d
+  803dd3:	75 cb                	jne    803da0 <devpipe_read+0x4f>
+  803dd5:	48 89 de             	mov    %rbx,%rsi
+  803dd8:	4c 89 ef             	mov    %r13,%rdi
+  803ddb:	41 ff d7             	call   *%r15
+  803dde:	85 c0                	test   %eax,%eax
+  803de0:	75 be                	jne    803da0 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803de2:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803de7:	44 89 e6             	mov    %r12d,%esi
+  803dea:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803dee:	48 b8 45 17 80 00 00 	movabs $0x801745,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+  803dfa:	eb a4                	jmp    803da0 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803dfc:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e00:	48 89 de             	mov    %rbx,%rsi
+  803e03:	48 b8 31 3b 80 00 00 	movabs $0x803b31,%rax
+  803e0a:	00 00 00 
+  803e0d:	ff d0                	call   *%rax
+                return i;
+  803e0f:	4c 89 f0             	mov    %r14,%rax
+}
+  803e12:	48 83 c4 28          	add    $0x28,%rsp
+  803e16:	5b                   	pop    %rbx
+  803e17:	41 5c                	pop    %r12
+  803e19:	41 5d                	pop    %r13
+  803e1b:	41 5e                	pop    %r14
+  803e1d:	41 5f                	pop    %r15
+  803e1f:	5d                   	pop    %rbp
+  803e20:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e21:	48 63 c8             	movslq %eax,%rcx
+  803e24:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803e2b:	80 80 80 
+  803e2e:	48 89 c8             	mov    %rcx,%rax
+  803e31:	48 f7 e2             	mul    %rdx
+  803e34:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803e38:	48 89 d0             	mov    %rdx,%rax
+  803e3b:	48 c1 e0 08          	shl    $0x8,%rax
+  803e3f:	48 29 d0             	sub    %rdx,%rax
+  803e42:	48 c1 e0 04          	shl    $0x4,%rax
+  803e46:	48 89 c2             	mov    %rax,%rdx
+  803e49:	48 89 c8             	mov    %rcx,%rax
+  803e4c:	48 29 d0             	sub    %rdx,%rax
+  803e4f:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803e54:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e58:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803e5c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e5f:	49 83 c6 01          	add    $0x1,%r14
+  803e63:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803e67:	0f 85 2b ff ff ff    	jne    803d98 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e6d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e71:	48 89 de             	mov    %rbx,%rsi
+  803e74:	48 b8 31 3b 80 00 00 	movabs $0x803b31,%rax
+  803e7b:	00 00 00 
+  803e7e:	ff d0                	call   *%rax
+    return n;
+  803e80:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e84:	eb 8c                	jmp    803e12 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e86:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e8b:	eb 85                	jmp    803e12 <devpipe_read+0xc1>
+
+0000000000803e8d <pipe>:
+pipe(int pfd[2]) {
+  803e8d:	55                   	push   %rbp
+  803e8e:	48 89 e5             	mov    %rsp,%rbp
+  803e91:	41 55                	push   %r13
+  803e93:	41 54                	push   %r12
+  803e95:	53                   	push   %rbx
+  803e96:	48 83 ec 18          	sub    $0x18,%rsp
+  803e9a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e9d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ea1:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  803ea8:	00 00 00 
+  803eab:	ff d0                	call   *%rax
+  803ead:	89 c3                	mov    %eax,%ebx
+  803eaf:	85 c0                	test   %eax,%eax
+  803eb1:	0f 88 a0 01 00 00    	js     804057 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803eb7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ebc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ec5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eca:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  803ed1:	00 00 00 
+  803ed4:	ff d0                	call   *%rax
+  803ed6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ed8:	85 c0                	test   %eax,%eax
+  803eda:	0f 88 77 01 00 00    	js     804057 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ee0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803ee4:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  803eeb:	00 00 00 
+  803eee:	ff d0                	call   *%rax
+  803ef0:	89 c3                	mov    %eax,%ebx
+  803ef2:	85 c0                	test   %eax,%eax
+  803ef4:	0f 88 43 01 00 00    	js     80403d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803efa:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803eff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f04:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f08:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0d:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  803f14:	00 00 00 
+  803f17:	ff d0                	call   *%rax
+  803f19:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f1b:	85 c0                	test   %eax,%eax
+  803f1d:	0f 88 1a 01 00 00    	js     80403d <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f23:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f27:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803f2e:	00 00 00 
+  803f31:	ff d0                	call   *%rax
+  803f33:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f36:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f40:	48 89 c6             	mov    %rax,%rsi
+  803f43:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f48:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  803f4f:	00 00 00 
+  803f52:	ff d0                	call   *%rax
+  803f54:	89 c3                	mov    %eax,%ebx
+  803f56:	85 c0                	test   %eax,%eax
+  803f58:	0f 88 c5 00 00 00    	js     804023 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f5e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f62:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  803f69:	00 00 00 
+  803f6c:	ff d0                	call   *%rax
+  803f6e:	48 89 c1             	mov    %rax,%rcx
+  803f71:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f77:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f82:	4c 89 ee             	mov    %r13,%rsi
+  803f85:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f8a:	48 b8 2d 14 80 00 00 	movabs $0x80142d,%rax
+  803f91:	00 00 00 
+  803f94:	ff d0                	call   *%rax
+  803f96:	89 c3                	mov    %eax,%ebx
+  803f98:	85 c0                	test   %eax,%eax
+  803f9a:	78 6e                	js     80400a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f9c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fa1:	4c 89 ef             	mov    %r13,%rdi
+  803fa4:	48 b8 9c 13 80 00 00 	movabs $0x80139c,%rax
+  803fab:	00 00 00 
+  803fae:	ff d0                	call   *%rax
+  803fb0:	83 f8 02             	cmp    $0x2,%eax
+  803fb3:	0f 85 ab 00 00 00    	jne    804064 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803fb9:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803fc0:	00 00 
+  803fc2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fc6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803fc8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803fcc:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803fd3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803fd7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803fd9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803fdd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803fe4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803fe8:	48 bb d1 19 80 00 00 	movabs $0x8019d1,%rbx
+  803fef:	00 00 00 
+  803ff2:	ff d3                	call   *%rbx
+  803ff4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ff8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ffc:	ff d3                	call   *%rbx
+  803ffe:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804003:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804008:	eb 4d                	jmp    804057 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80400a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80400f:	4c 89 ee             	mov    %r13,%rsi
+  804012:	bf 00 00 00 00       	mov    $0x0,%edi
+  804017:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  80401e:	00 00 00 
+  804021:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804023:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804028:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80402c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804031:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  804038:	00 00 00 
+  80403b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80403d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804042:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804046:	bf 00 00 00 00       	mov    $0x0,%edi
+  80404b:	48 b8 7d 14 80 00 00 	movabs $0x80147d,%rax
+  804052:	00 00 00 
+  804055:	ff d0                	call   *%rax
+}
+  804057:	89 d8                	mov    %ebx,%eax
+  804059:	48 83 c4 18          	add    $0x18,%rsp
+  80405d:	5b                   	pop    %rbx
+  80405e:	41 5c                	pop    %r12
+  804060:	41 5d                	pop    %r13
+  804062:	5d                   	pop    %rbp
+  804063:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804064:	48 b9 50 51 80 00 00 	movabs $0x805150,%rcx
+  80406b:	00 00 00 
+  80406e:	48 ba 27 51 80 00 00 	movabs $0x805127,%rdx
+  804075:	00 00 00 
+  804078:	be 50 00 00 00       	mov    $0x50,%esi
+  80407d:	48 bf 3c 51 80 00 00 	movabs $0x80513c,%rdi
+  804084:	00 00 00 
+  804087:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408c:	49 b8 03 04 80 00 00 	movabs $0x800403,%r8
+  804093:	00 00 00 
+  804096:	41 ff d0             	call   *%r8
+
+0000000000804099 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804099:	55                   	push   %rbp
+  80409a:	48 89 e5             	mov    %rsp,%rbp
+  80409d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040a5:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  8040ac:	00 00 00 
+  8040af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040b1:	85 c0                	test   %eax,%eax
+  8040b3:	78 23                	js     8040d8 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8040b5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040b9:	48 b8 e3 19 80 00 00 	movabs $0x8019e3,%rax
+  8040c0:	00 00 00 
+  8040c3:	ff d0                	call   *%rax
+  8040c5:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8040c8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040cc:	48 b8 d4 3b 80 00 00 	movabs $0x803bd4,%rax
+  8040d3:	00 00 00 
+  8040d6:	ff d0                	call   *%rax
+}
+  8040d8:	c9                   	leave
+  8040d9:	c3                   	ret
+
+00000000008040da <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8040da:	48 89 f8             	mov    %rdi,%rax
+  8040dd:	48 c1 e8 27          	shr    $0x27,%rax
+  8040e1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8040e8:	01 00 00 
+  8040eb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040ef:	f6 c2 01             	test   $0x1,%dl
+  8040f2:	74 6d                	je     804161 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8040f4:	48 89 f8             	mov    %rdi,%rax
+  8040f7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040fb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804102:	01 00 00 
+  804105:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804109:	f6 c2 01             	test   $0x1,%dl
+  80410c:	74 62                	je     804170 <get_uvpt_entry+0x96>
+  80410e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804115:	01 00 00 
+  804118:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80411c:	f6 c2 80             	test   $0x80,%dl
+  80411f:	75 4f                	jne    804170 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804121:	48 89 f8             	mov    %rdi,%rax
+  804124:	48 c1 e8 15          	shr    $0x15,%rax
+  804128:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80412f:	01 00 00 
+  804132:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804136:	f6 c2 01             	test   $0x1,%dl
+  804139:	74 44                	je     80417f <get_uvpt_entry+0xa5>
+  80413b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804142:	01 00 00 
+  804145:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804149:	f6 c2 80             	test   $0x80,%dl
+  80414c:	75 31                	jne    80417f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80414e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804152:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804159:	01 00 00 
+  80415c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804160:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804161:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804168:	01 00 00 
+  80416b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80416f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804170:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804177:	01 00 00 
+  80417a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80417e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80417f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804186:	01 00 00 
+  804189:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80418d:	c3                   	ret
+
+000000000080418e <get_prot>:
+
+int
+get_prot(void *va) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804192:	48 b8 da 40 80 00 00 	movabs $0x8040da,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  80419e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8041a1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8041a6:	89 c1                	mov    %eax,%ecx
+  8041a8:	83 c9 04             	or     $0x4,%ecx
+  8041ab:	f6 c2 01             	test   $0x1,%dl
+  8041ae:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8041b1:	89 c1                	mov    %eax,%ecx
+  8041b3:	83 c9 02             	or     $0x2,%ecx
+  8041b6:	f6 c2 02             	test   $0x2,%dl
+  8041b9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8041bc:	89 c1                	mov    %eax,%ecx
+  8041be:	83 c9 01             	or     $0x1,%ecx
+  8041c1:	48 85 d2             	test   %rdx,%rdx
+  8041c4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8041c7:	89 c1                	mov    %eax,%ecx
+  8041c9:	83 c9 40             	or     $0x40,%ecx
+  8041cc:	f6 c6 04             	test   $0x4,%dh
+  8041cf:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8041d2:	5d                   	pop    %rbp
+  8041d3:	c3                   	ret
+
+00000000008041d4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8041d4:	55                   	push   %rbp
+  8041d5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041d8:	48 b8 da 40 80 00 00 	movabs $0x8040da,%rax
+  8041df:	00 00 00 
+  8041e2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8041e4:	48 c1 e8 06          	shr    $0x6,%rax
+  8041e8:	83 e0 01             	and    $0x1,%eax
+}
+  8041eb:	5d                   	pop    %rbp
+  8041ec:	c3                   	ret
+
+00000000008041ed <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8041ed:	55                   	push   %rbp
+  8041ee:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8041f1:	48 b8 da 40 80 00 00 	movabs $0x8040da,%rax
+  8041f8:	00 00 00 
+  8041fb:	ff d0                	call   *%rax
+  8041fd:	83 e0 01             	and    $0x1,%eax
+}
+  804200:	5d                   	pop    %rbp
+  804201:	c3                   	ret
+
+0000000000804202 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804202:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804209:	01 00 00 
+  80420c:	a8 01                	test   $0x1,%al
+  80420e:	75 06                	jne    804216 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804210:	b8 00 00 00 00       	mov    $0x0,%eax
+  804215:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804216:	55                   	push   %rbp
+  804217:	48 89 e5             	mov    %rsp,%rbp
+  80421a:	41 57                	push   %r15
+  80421c:	41 56                	push   %r14
+  80421e:	41 55                	push   %r13
+  804220:	41 54                	push   %r12
+  804222:	53                   	push   %rbx
+  804223:	48 83 ec 28          	sub    $0x28,%rsp
+  804227:	49 89 fe             	mov    %rdi,%r14
+  80422a:	49 89 f7             	mov    %rsi,%r15
+  80422d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804234:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804235:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80423c:	01 00 00 
+  80423f:	e9 ae 00 00 00       	jmp    8042f2 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804244:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80424b:	49 83 ec 01          	sub    $0x1,%r12
+  80424f:	74 2d                	je     80427e <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804251:	48 89 d8             	mov    %rbx,%rax
+  804254:	48 c1 e8 0c          	shr    $0xc,%rax
+  804258:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80425d:	f6 c2 01             	test   $0x1,%dl
+  804260:	74 e2                	je     804244 <foreach_shared_region+0x42>
+  804262:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804267:	f6 c4 04             	test   $0x4,%ah
+  80426a:	74 d8                	je     804244 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80426c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804273:	4c 89 fa             	mov    %r15,%rdx
+  804276:	48 89 df             	mov    %rbx,%rdi
+  804279:	41 ff d6             	call   *%r14
+  80427c:	eb c6                	jmp    804244 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80427e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804285:	00 
+  804286:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80428b:	74 4a                	je     8042d7 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80428d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804291:	48 c1 e8 15          	shr    $0x15,%rax
+  804295:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80429c:	01 00 00 
+  80429f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042a3:	a8 01                	test   $0x1,%al
+  8042a5:	74 d7                	je     80427e <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8042a7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8042ab:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8042b2:	48 39 c3             	cmp    %rax,%rbx
+  8042b5:	73 c7                	jae    80427e <foreach_shared_region+0x7c>
+  8042b7:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8042be:	48 39 d0             	cmp    %rdx,%rax
+  8042c1:	4d 19 e4             	sbb    %r12,%r12
+  8042c4:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8042cb:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8042d2:	e9 7a ff ff ff       	jmp    804251 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8042d7:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8042de:	40 
+  8042df:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8042ea:	00 00 00 
+  8042ed:	48 39 c1             	cmp    %rax,%rcx
+  8042f0:	74 50                	je     804342 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8042f2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8042f6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8042fa:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804301:	01 00 00 
+  804304:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804308:	a8 01                	test   $0x1,%al
+  80430a:	74 cb                	je     8042d7 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80430c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804310:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804317:	48 39 c1             	cmp    %rax,%rcx
+  80431a:	73 bb                	jae    8042d7 <foreach_shared_region+0xd5>
+  80431c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804323:	48 39 d0             	cmp    %rdx,%rax
+  804326:	48 19 c0             	sbb    %rax,%rax
+  804329:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80432f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804335:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804339:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80433d:	e9 4b ff ff ff       	jmp    80428d <foreach_shared_region+0x8b>
+  804342:	b8 00 00 00 00       	mov    $0x0,%eax
+  804347:	48 83 c4 28          	add    $0x28,%rsp
+  80434b:	5b                   	pop    %rbx
+  80434c:	41 5c                	pop    %r12
+  80434e:	41 5d                	pop    %r13
+  804350:	41 5e                	pop    %r14
+  804352:	41 5f                	pop    %r15
+  804354:	5d                   	pop    %rbp
+  804355:	c3                   	ret
+
+0000000000804356 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804356:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80435c:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804363:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80436a:	c3                   	ret
+
+000000000080436b <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80436b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80436e:	8b 17                	mov    (%rdi),%edx
+  804370:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804372:	83 f8 0f             	cmp    $0xf,%eax
+  804375:	77 13                	ja     80438a <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804377:	8b 47 40             	mov    0x40(%rdi),%eax
+  80437a:	83 e0 0f             	and    $0xf,%eax
+  80437d:	48 c1 e0 09          	shl    $0x9,%rax
+  804381:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804388:	00 
+  804389:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80438a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80438f:	c3                   	ret
+
+0000000000804390 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804390:	8b 47 40             	mov    0x40(%rdi),%eax
+  804393:	83 c0 01             	add    $0x1,%eax
+  804396:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804399:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80439f:	8b 57 04             	mov    0x4(%rdi),%edx
+  8043a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a7:	85 d2                	test   %edx,%edx
+  8043a9:	75 04                	jne    8043af <chan_publish+0x1f>
+  8043ab:	83 e0 01             	and    $0x1,%eax
+}
+  8043ae:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043af:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8043b2:	85 c0                	test   %eax,%eax
+  8043b4:	0f 95 c0             	setne  %al
+  8043b7:	0f b6 c0             	movzbl %al,%eax
+  8043ba:	eb ef                	jmp    8043ab <chan_publish+0x1b>
+
+00000000008043bc <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8043bc:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043bf:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8043c1:	29 d0                	sub    %edx,%eax
+  8043c3:	83 e8 01             	sub    $0x1,%eax
+  8043c6:	83 f8 0f             	cmp    $0xf,%eax
+  8043c9:	77 12                	ja     8043dd <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8043cb:	8b 07                	mov    (%rdi),%eax
+  8043cd:	83 e0 0f             	and    $0xf,%eax
+  8043d0:	48 c1 e0 09          	shl    $0x9,%rax
+  8043d4:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8043db:	00 
+  8043dc:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8043dd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043e2:	c3                   	ret
+
+00000000008043e3 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8043e3:	8b 07                	mov    (%rdi),%eax
+  8043e5:	83 c0 01             	add    $0x1,%eax
+  8043e8:	89 07                	mov    %eax,(%rdi)
+}
+  8043ea:	c3                   	ret
+
+00000000008043eb <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8043eb:	55                   	push   %rbp
+  8043ec:	48 89 e5             	mov    %rsp,%rbp
+  8043ef:	53                   	push   %rbx
+  8043f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8043f4:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8043f7:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8043fe:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804404:	48 b8 bc 43 80 00 00 	movabs $0x8043bc,%rax
+  80440b:	00 00 00 
+  80440e:	ff d0                	call   *%rax
+  804410:	48 85 c0             	test   %rax,%rax
+  804413:	74 12                	je     804427 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804415:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80441c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804421:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804425:	c9                   	leave
+  804426:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804427:	b8 01 00 00 00       	mov    $0x1,%eax
+  80442c:	eb f3                	jmp    804421 <chan_arm+0x36>
+
+000000000080442e <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80442e:	55                   	push   %rbp
+  80442f:	48 89 e5             	mov    %rsp,%rbp
+  804432:	41 56                	push   %r14
+  804434:	41 55                	push   %r13
+  804436:	41 54                	push   %r12
+  804438:	53                   	push   %rbx
+  804439:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80443c:	49 bc eb 43 80 00 00 	movabs $0x8043eb,%r12
+  804443:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804446:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80444a:	49 bd 45 17 80 00 00 	movabs $0x801745,%r13
+  804451:	00 00 00 
+    while (chan_arm(r))
+  804454:	eb 0d                	jmp    804463 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804456:	8b 33                	mov    (%rbx),%esi
+  804458:	ba 00 00 00 00       	mov    $0x0,%edx
+  80445d:	4c 89 f7             	mov    %r14,%rdi
+  804460:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804463:	48 89 df             	mov    %rbx,%rdi
+  804466:	41 ff d4             	call   *%r12
+  804469:	84 c0                	test   %al,%al
+  80446b:	75 e9                	jne    804456 <chan_wait+0x28>
+}
+  80446d:	5b                   	pop    %rbx
+  80446e:	41 5c                	pop    %r12
+  804470:	41 5d                	pop    %r13
+  804472:	41 5e                	pop    %r14
+  804474:	5d                   	pop    %rbp
+  804475:	c3                   	ret
+
+0000000000804476 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804476:	55                   	push   %rbp
+  804477:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80447a:	48 83 c7 40          	add    $0x40,%rdi
+  80447e:	be 01 00 00 00       	mov    $0x1,%esi
+  804483:	48 b8 63 17 80 00 00 	movabs $0x801763,%rax
+  80448a:	00 00 00 
+  80448d:	ff d0                	call   *%rax
+}
+  80448f:	5d                   	pop    %rbp
+  804490:	c3                   	ret
+
+0000000000804491 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804491:	b8 00 00 00 00       	mov    $0x0,%eax
+  804496:	c3                   	ret
+
+0000000000804497 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804497:	55                   	push   %rbp
+  804498:	48 89 e5             	mov    %rsp,%rbp
+  80449b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80449e:	48 be 74 51 80 00 00 	movabs $0x805174,%rsi
+  8044a5:	00 00 00 
+  8044a8:	48 b8 78 0e 80 00 00 	movabs $0x800e78,%rax
+  8044af:	00 00 00 
+  8044b2:	ff d0                	call   *%rax
+    return 0;
+}
+  8044b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044b9:	5d                   	pop    %rbp
+  8044ba:	c3                   	ret
+
+00000000008044bb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8044bb:	55                   	push   %rbp
+  8044bc:	48 89 e5             	mov    %rsp,%rbp
+  8044bf:	41 57                	push   %r15
+  8044c1:	41 56                	push   %r14
+  8044c3:	41 55                	push   %r13
+  8044c5:	41 54                	push   %r12
+  8044c7:	53                   	push   %rbx
+  8044c8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8044cf:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8044d6:	48 85 d2             	test   %rdx,%rdx
+  8044d9:	74 7a                	je     804555 <devcons_write+0x9a>
+  8044db:	49 89 d6             	mov    %rdx,%r14
+  8044de:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044e4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8044e9:	49 bf 72 10 80 00 00 	movabs $0x801072,%r15
+  8044f0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8044f3:	4c 89 f3             	mov    %r14,%rbx
+  8044f6:	48 29 f3             	sub    %rsi,%rbx
+  8044f9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8044fe:	48 39 c3             	cmp    %rax,%rbx
+  804501:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804505:	4c 63 eb             	movslq %ebx,%r13
+  804508:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80450f:	48 01 c6             	add    %rax,%rsi
+  804512:	4c 89 ea             	mov    %r13,%rdx
+  804515:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80451c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80451f:	4c 89 ee             	mov    %r13,%rsi
+  804522:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804529:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  804530:	00 00 00 
+  804533:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804535:	41 01 dc             	add    %ebx,%r12d
+  804538:	49 63 f4             	movslq %r12d,%rsi
+  80453b:	4c 39 f6             	cmp    %r14,%rsi
+  80453e:	72 b3                	jb     8044f3 <devcons_write+0x38>
+    return res;
+  804540:	49 63 c4             	movslq %r12d,%rax
+}
+  804543:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80454a:	5b                   	pop    %rbx
+  80454b:	41 5c                	pop    %r12
+  80454d:	41 5d                	pop    %r13
+  80454f:	41 5e                	pop    %r14
+  804551:	41 5f                	pop    %r15
+  804553:	5d                   	pop    %rbp
+  804554:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804555:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80455b:	eb e3                	jmp    804540 <devcons_write+0x85>
+
+000000000080455d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80455d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804560:	ba 00 00 00 00       	mov    $0x0,%edx
+  804565:	48 85 c0             	test   %rax,%rax
+  804568:	74 55                	je     8045bf <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80456a:	55                   	push   %rbp
+  80456b:	48 89 e5             	mov    %rsp,%rbp
+  80456e:	41 55                	push   %r13
+  804570:	41 54                	push   %r12
+  804572:	53                   	push   %rbx
+  804573:	48 83 ec 08          	sub    $0x8,%rsp
+  804577:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80457a:	48 bb be 12 80 00 00 	movabs $0x8012be,%rbx
+  804581:	00 00 00 
+  804584:	49 bc 73 13 80 00 00 	movabs $0x801373,%r12
+  80458b:	00 00 00 
+  80458e:	eb 03                	jmp    804593 <devcons_read+0x36>
+  804590:	41 ff d4             	call   *%r12
+  804593:	ff d3                	call   *%rbx
+  804595:	85 c0                	test   %eax,%eax
+  804597:	74 f7                	je     804590 <devcons_read+0x33>
+    if (c < 0) return c;
+  804599:	48 63 d0             	movslq %eax,%rdx
+  80459c:	78 13                	js     8045b1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80459e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a3:	83 f8 04             	cmp    $0x4,%eax
+  8045a6:	74 09                	je     8045b1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8045a8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8045ac:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8045b1:	48 89 d0             	mov    %rdx,%rax
+  8045b4:	48 83 c4 08          	add    $0x8,%rsp
+  8045b8:	5b                   	pop    %rbx
+  8045b9:	41 5c                	pop    %r12
+  8045bb:	41 5d                	pop    %r13
+  8045bd:	5d                   	pop    %rbp
+  8045be:	c3                   	ret
+  8045bf:	48 89 d0             	mov    %rdx,%rax
+  8045c2:	c3                   	ret
+
+00000000008045c3 <cputchar>:
+cputchar(int ch) {
+  8045c3:	55                   	push   %rbp
+  8045c4:	48 89 e5             	mov    %rsp,%rbp
+  8045c7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8045cb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8045cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8045d4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8045d8:	48 b8 9f 12 80 00 00 	movabs $0x80129f,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+}
+  8045e4:	c9                   	leave
+  8045e5:	c3                   	ret
+
+00000000008045e6 <getchar>:
+getchar(void) {
+  8045e6:	55                   	push   %rbp
+  8045e7:	48 89 e5             	mov    %rsp,%rbp
+  8045ea:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8045ee:	ba 01 00 00 00       	mov    $0x1,%edx
+  8045f3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8045f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045fc:	48 b8 42 1d 80 00 00 	movabs $0x801d42,%rax
+  804603:	00 00 00 
+  804606:	ff d0                	call   *%rax
+  804608:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80460a:	85 c0                	test   %eax,%eax
+  80460c:	78 06                	js     804614 <getchar+0x2e>
+  80460e:	74 08                	je     804618 <getchar+0x32>
+  804610:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804614:	89 d0                	mov    %edx,%eax
+  804616:	c9                   	leave
+  804617:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804618:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80461d:	eb f5                	jmp    804614 <getchar+0x2e>
+
+000000000080461f <iscons>:
+iscons(int fdnum) {
+  80461f:	55                   	push   %rbp
+  804620:	48 89 e5             	mov    %rsp,%rbp
+  804623:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804627:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80462b:	48 b8 5f 1a 80 00 00 	movabs $0x801a5f,%rax
+  804632:	00 00 00 
+  804635:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804637:	85 c0                	test   %eax,%eax
+  804639:	78 18                	js     804653 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80463b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80463f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804646:	00 00 00 
+  804649:	8b 00                	mov    (%rax),%eax
+  80464b:	39 02                	cmp    %eax,(%rdx)
+  80464d:	0f 94 c0             	sete   %al
+  804650:	0f b6 c0             	movzbl %al,%eax
+}
+  804653:	c9                   	leave
+  804654:	c3                   	ret
+
+0000000000804655 <opencons>:
+opencons(void) {
+  804655:	55                   	push   %rbp
+  804656:	48 89 e5             	mov    %rsp,%rbp
+  804659:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80465d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804661:	48 b8 ff 19 80 00 00 	movabs $0x8019ff,%rax
+  804668:	00 00 00 
+  80466b:	ff d0                	call   *%rax
+  80466d:	85 c0                	test   %eax,%eax
+  80466f:	78 49                	js     8046ba <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804671:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804676:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80467b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80467f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804684:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  80468b:	00 00 00 
+  80468e:	ff d0                	call   *%rax
+  804690:	85 c0                	test   %eax,%eax
+  804692:	78 26                	js     8046ba <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804694:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804698:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80469f:	00 00 
+  8046a1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8046a3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046a7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8046ae:	48 b8 d1 19 80 00 00 	movabs $0x8019d1,%rax
+  8046b5:	00 00 00 
+  8046b8:	ff d0                	call   *%rax
+}
+  8046ba:	c9                   	leave
+  8046bb:	c3                   	ret
+
+00000000008046bc <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8046bc:	55                   	push   %rbp
+  8046bd:	48 89 e5             	mov    %rsp,%rbp
+  8046c0:	41 56                	push   %r14
+  8046c2:	41 55                	push   %r13
+  8046c4:	41 54                	push   %r12
+  8046c6:	53                   	push   %rbx
+  8046c7:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046ca:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  8046d1:	00 00 00 
+  8046d4:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8046d8:	74 27                	je     804701 <_handle_vectored_pagefault+0x45>
+  8046da:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8046df:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  8046e6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046e9:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8046ec:	4c 89 e7             	mov    %r12,%rdi
+  8046ef:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8046f4:	84 c0                	test   %al,%al
+  8046f6:	75 45                	jne    80473d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046f8:	48 83 c3 01          	add    $0x1,%rbx
+  8046fc:	49 3b 1e             	cmp    (%r14),%rbx
+  8046ff:	72 eb                	jb     8046ec <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804701:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804708:	00 
+  804709:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80470e:	4d 8b 04 24          	mov    (%r12),%r8
+  804712:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  804719:	00 00 00 
+  80471c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804721:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  804728:	00 00 00 
+  80472b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804730:	49 ba 03 04 80 00 00 	movabs $0x800403,%r10
+  804737:	00 00 00 
+  80473a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80473d:	5b                   	pop    %rbx
+  80473e:	41 5c                	pop    %r12
+  804740:	41 5d                	pop    %r13
+  804742:	41 5e                	pop    %r14
+  804744:	5d                   	pop    %rbp
+  804745:	c3                   	ret
+
+0000000000804746 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804746:	55                   	push   %rbp
+  804747:	48 89 e5             	mov    %rsp,%rbp
+  80474a:	53                   	push   %rbx
+  80474b:	48 83 ec 08          	sub    $0x8,%rsp
+  80474f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804752:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804759:	00 00 00 
+  80475c:	80 38 00             	cmpb   $0x0,(%rax)
+  80475f:	0f 84 84 00 00 00    	je     8047e9 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804765:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  80476c:	00 00 00 
+  80476f:	48 8b 10             	mov    (%rax),%rdx
+  804772:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804777:	48 b9 00 10 85 00 00 	movabs $0x851000,%rcx
+  80477e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804781:	48 85 d2             	test   %rdx,%rdx
+  804784:	74 19                	je     80479f <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804786:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80478a:	0f 84 e8 00 00 00    	je     804878 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804790:	48 83 c0 01          	add    $0x1,%rax
+  804794:	48 39 d0             	cmp    %rdx,%rax
+  804797:	75 ed                	jne    804786 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804799:	48 83 fa 08          	cmp    $0x8,%rdx
+  80479d:	74 1c                	je     8047bb <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80479f:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047a3:	48 a3 48 10 85 00 00 	movabs %rax,0x851048
+  8047aa:	00 00 00 
+  8047ad:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  8047b4:	00 00 00 
+  8047b7:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8047bb:	48 b8 4a 13 80 00 00 	movabs $0x80134a,%rax
+  8047c2:	00 00 00 
+  8047c5:	ff d0                	call   *%rax
+  8047c7:	89 c7                	mov    %eax,%edi
+  8047c9:	48 be 3e 49 80 00 00 	movabs $0x80493e,%rsi
+  8047d0:	00 00 00 
+  8047d3:	48 b8 95 15 80 00 00 	movabs $0x801595,%rax
+  8047da:	00 00 00 
+  8047dd:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047df:	85 c0                	test   %eax,%eax
+  8047e1:	78 68                	js     80484b <add_pgfault_handler+0x105>
+    return res;
+}
+  8047e3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8047e7:	c9                   	leave
+  8047e8:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8047e9:	48 b8 4a 13 80 00 00 	movabs $0x80134a,%rax
+  8047f0:	00 00 00 
+  8047f3:	ff d0                	call   *%rax
+  8047f5:	89 c7                	mov    %eax,%edi
+  8047f7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8047fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804801:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804808:	00 00 00 
+  80480b:	48 b8 d7 13 80 00 00 	movabs $0x8013d7,%rax
+  804812:	00 00 00 
+  804815:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804817:	48 ba 48 10 85 00 00 	movabs $0x851048,%rdx
+  80481e:	00 00 00 
+  804821:	48 8b 02             	mov    (%rdx),%rax
+  804824:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804828:	48 89 0a             	mov    %rcx,(%rdx)
+  80482b:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804832:	00 00 00 
+  804835:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804839:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804840:	00 00 00 
+  804843:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804846:	e9 70 ff ff ff       	jmp    8047bb <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80484b:	89 c1                	mov    %eax,%ecx
+  80484d:	48 ba be 51 80 00 00 	movabs $0x8051be,%rdx
+  804854:	00 00 00 
+  804857:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80485c:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  804863:	00 00 00 
+  804866:	b8 00 00 00 00       	mov    $0x0,%eax
+  80486b:	49 b8 03 04 80 00 00 	movabs $0x800403,%r8
+  804872:	00 00 00 
+  804875:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804878:	b8 00 00 00 00       	mov    $0x0,%eax
+  80487d:	e9 61 ff ff ff       	jmp    8047e3 <add_pgfault_handler+0x9d>
+
+0000000000804882 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804882:	55                   	push   %rbp
+  804883:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804886:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  80488d:	00 00 00 
+  804890:	80 38 00             	cmpb   $0x0,(%rax)
+  804893:	74 33                	je     8048c8 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804895:	48 a1 48 10 85 00 00 	movabs 0x851048,%rax
+  80489c:	00 00 00 
+  80489f:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8048a4:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  8048ab:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048ae:	48 85 c0             	test   %rax,%rax
+  8048b1:	0f 84 85 00 00 00    	je     80493c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8048b7:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8048bb:	74 40                	je     8048fd <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048bd:	48 83 c1 01          	add    $0x1,%rcx
+  8048c1:	48 39 c1             	cmp    %rax,%rcx
+  8048c4:	75 f1                	jne    8048b7 <remove_pgfault_handler+0x35>
+  8048c6:	eb 74                	jmp    80493c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8048c8:	48 b9 d6 51 80 00 00 	movabs $0x8051d6,%rcx
+  8048cf:	00 00 00 
+  8048d2:	48 ba 27 51 80 00 00 	movabs $0x805127,%rdx
+  8048d9:	00 00 00 
+  8048dc:	be 43 00 00 00       	mov    $0x43,%esi
+  8048e1:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  8048e8:	00 00 00 
+  8048eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f0:	49 b8 03 04 80 00 00 	movabs $0x800403,%r8
+  8048f7:	00 00 00 
+  8048fa:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8048fd:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804904:	00 
+  804905:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804909:	48 29 ca             	sub    %rcx,%rdx
+  80490c:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804913:	00 00 00 
+  804916:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80491a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80491f:	48 89 ce             	mov    %rcx,%rsi
+  804922:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  804929:	00 00 00 
+  80492c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80492e:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804935:	00 00 00 
+  804938:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80493c:	5d                   	pop    %rbp
+  80493d:	c3                   	ret
+
+000000000080493e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80493e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804941:	48 b8 bc 46 80 00 00 	movabs $0x8046bc,%rax
+  804948:	00 00 00 
+    call *%rax
+  80494b:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80494d:	41 5f                	pop    %r15
+	popq %r15
+  80494f:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804951:	41 5f                	pop    %r15
+	popq %r14
+  804953:	41 5e                	pop    %r14
+	popq %r13
+  804955:	41 5d                	pop    %r13
+	popq %r12
+  804957:	41 5c                	pop    %r12
+	popq %r11
+  804959:	41 5b                	pop    %r11
+	popq %r10
+  80495b:	41 5a                	pop    %r10
+	popq %r9
+  80495d:	41 59                	pop    %r9
+	popq %r8
+  80495f:	41 58                	pop    %r8
+	popq %rsi
+  804961:	5e                   	pop    %rsi
+	popq %rdi
+  804962:	5f                   	pop    %rdi
+	popq %rbp
+  804963:	5d                   	pop    %rbp
+	popq %rdx
+  804964:	5a                   	pop    %rdx
+	popq %rcx
+  804965:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804966:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80496b:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804970:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804974:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804977:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80497c:	5b                   	pop    %rbx
+	popq %rax
+  80497d:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80497e:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804982:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804983:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804988:	c3                   	ret
+  804989:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804990 <__rodata_start>:
+  804990:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804991:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804992:	20 66 69             	and    %ah,0x69(%rsi)
+  804995:	6c                   	insb   (%dx),%es:(%rdi)
+  804996:	65 20 73 65          	and    %dh,%gs:0x65(%rbx)
+  80499a:	72 76                	jb     804a12 <__rodata_start+0x82>
+  80499c:	65 72 00             	gs jb  80499f <__rodata_start+0xf>
+  80499f:	75 73                	jne    804a14 <__rodata_start+0x84>
+  8049a1:	65 72 2f             	gs jb  8049d3 <__rodata_start+0x43>
+  8049a4:	61                   	(bad)
+  8049a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8049a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8049a7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049a8:	63 62 65             	movsxd 0x65(%rdx),%esp
+  8049ab:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ac:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  8049af:	63 00                	movsxd (%rax),%eax
+  8049b1:	2f                   	(bad)
+  8049b2:	66 69 6c 6c 25 75 00 	imul   $0x75,0x25(%rsp,%rbp,2),%bp
+  8049b9:	61                   	(bad)
+  8049ba:	6c                   	insb   (%dx),%es:(%rdi)
+  8049bb:	6c                   	insb   (%dx),%es:(%rdi)
+  8049bc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049bd:	63 62 65             	movsxd 0x65(%rdx),%esp
+  8049c0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049c1:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8049c4:	20 25 69 00 61 6c    	and    %ah,0x6c610069(%rip)        # 6ce14a33 <__bss_end+0x6c5c2a33>
+  8049ca:	6c                   	insb   (%dx),%es:(%rdi)
+  8049cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049cc:	63 62 65             	movsxd 0x65(%rdx),%esp
+  8049cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049d0:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8049d3:	20 25 6c 75 20 62    	and    %ah,0x6220756c(%rip)        # 62a0bf45 <__bss_end+0x621b9f45>
+  8049d9:	6c                   	insb   (%dx),%es:(%rdi)
+  8049da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049db:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  8049de:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049e1:	20 25 6c 75 20 66    	and    %ah,0x6620756c(%rip)        # 66a0bf53 <__bss_end+0x661b9f53>
+  8049e7:	69 6c 65 73 3a 20 25 	imul   $0x6c25203a,0x73(%rbp,%riz,2),%ebp
+  8049ee:	6c 
+  8049ef:	75 20                	jne    804a11 <__rodata_start+0x81>
+  8049f1:	63 79 63             	movsxd 0x63(%rcx),%edi
+  8049f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8049f5:	65 73 20             	gs jae 804a18 <__rodata_start+0x88>
+  8049f8:	70 65                	jo     804a5f <sizes+0x1f>
+  8049fa:	72 20                	jb     804a1c <__rodata_start+0x8c>
+  8049fc:	62                   	(bad)
+  8049fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8049fe:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ff:	63 6b 0a             	movsxd 0xa(%rbx),%ebp
+  804a02:	00 00                	add    %al,(%rax)
+  804a04:	00 00                	add    %al,(%rax)
+  804a06:	00 00                	add    %al,(%rax)
+  804a08:	61                   	(bad)
+  804a09:	6c                   	insb   (%dx),%es:(%rdi)
+  804a0a:	6c                   	insb   (%dx),%es:(%rdi)
+  804a0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a0c:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804a0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a10:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804a13:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a17:	6b 20 66             	imul   $0x66,(%rax),%esp
+  804a1a:	75 6c                	jne    804a88 <sizes+0x48>
+  804a1c:	6c                   	insb   (%dx),%es:(%rdi)
+  804a1d:	20 61 66             	and    %ah,0x66(%rcx)
+  804a20:	74 65                	je     804a87 <sizes+0x47>
+  804a22:	72 20                	jb     804a44 <sizes+0x4>
+  804a24:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  804a29:	6c                   	insb   (%dx),%es:(%rdi)
+  804a2a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a2b:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  804a2e:	0a 00                	or     (%rax),%al
+  804a30:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a37:	00 00 00 
+  804a3a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804a40 <sizes>:
+  804a40:	01 00 00 00 00 00 00 00 03 00 00 00 00 00 00 00     ................
+  804a50:	10 00 00 00 00 00 00 00 02 00 00 00 00 00 00 00     ................
+  804a60:	40 00 00 00 00 00 00 00 07 00 00 00 00 00 00 00     @...............
+  804a70:	00 01 00 00 00 00 00 00 01 00 00 00 00 00 00 00     ................
+  804a80:	3c 75 6e 6b 6e 6f 77 6e 3e 00 66 0f 1f 44 00 00     <unknown>.f..D..
+  804a90:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804aa0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804ab0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804ac0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804ad0:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804ae0:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804af0:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804b00:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804b10:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804b20:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804b30:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804b40:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  804b50:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  804b60:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  804b70:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  804b80:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804b90:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804ba0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804bb0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804bc0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804bd0:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804be0:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804bf0:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804c00:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804c10:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804c20:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804c30:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804c40:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  804c50:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  804c60:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 66      use.f.........f
+  804c70:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
+  804c80:	40 07 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     @...............
+  804c90:	71 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     q...............
+  804ca0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804cb0:	81 0d 80 00 00 00 00 00 5f 07 80 00 00 00 00 00     ........_.......
+  804cc0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804cd0:	53 07 80 00 00 00 00 00 cd 07 80 00 00 00 00 00     S...............
+  804ce0:	81 0d 80 00 00 00 00 00 53 07 80 00 00 00 00 00     ........S.......
+  804cf0:	99 07 80 00 00 00 00 00 99 07 80 00 00 00 00 00     ................
+  804d00:	99 07 80 00 00 00 00 00 99 07 80 00 00 00 00 00     ................
+  804d10:	99 07 80 00 00 00 00 00 99 07 80 00 00 00 00 00     ................
+  804d20:	99 07 80 00 00 00 00 00 99 07 80 00 00 00 00 00     ................
+  804d30:	99 07 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d40:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d50:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d60:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d70:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d80:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804d90:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804da0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804db0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804dc0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804dd0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804de0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804df0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e00:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e10:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e20:	81 0d 80 00 00 00 00 00 a4 0c 80 00 00 00 00 00     ................
+  804e30:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e40:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e50:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e60:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e70:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804e80:	f0 07 80 00 00 00 00 00 bf 09 80 00 00 00 00 00     ................
+  804e90:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804ea0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804eb0:	1f 08 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804ec0:	81 0d 80 00 00 00 00 00 e5 07 80 00 00 00 00 00     ................
+  804ed0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804ee0:	67 0b 80 00 00 00 00 00 31 0c 80 00 00 00 00 00     g.......1.......
+  804ef0:	81 0d 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804f00:	b6 08 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804f10:	93 0a 80 00 00 00 00 00 81 0d 80 00 00 00 00 00     ................
+  804f20:	81 0d 80 00 00 00 00 00 a4 0c 80 00 00 00 00 00     ................
+  804f30:	81 0d 80 00 00 00 00 00 49 07 80 00 00 00 00 00     ........I.......
+
+0000000000804f40 <error_string>:
+	...
+  804f48:	e5 4a 80 00 00 00 00 00 f7 4a 80 00 00 00 00 00     .J.......J......
+  804f58:	07 4b 80 00 00 00 00 00 19 4b 80 00 00 00 00 00     .K.......K......
+  804f68:	27 4b 80 00 00 00 00 00 3b 4b 80 00 00 00 00 00     'K......;K......
+  804f78:	50 4b 80 00 00 00 00 00 63 4b 80 00 00 00 00 00     PK......cK......
+  804f88:	75 4b 80 00 00 00 00 00 89 4b 80 00 00 00 00 00     uK.......K......
+  804f98:	99 4b 80 00 00 00 00 00 ac 4b 80 00 00 00 00 00     .K.......K......
+  804fa8:	c3 4b 80 00 00 00 00 00 d9 4b 80 00 00 00 00 00     .K.......K......
+  804fb8:	f1 4b 80 00 00 00 00 00 09 4c 80 00 00 00 00 00     .K.......L......
+  804fc8:	16 4c 80 00 00 00 00 00 f8 4f 80 00 00 00 00 00     .L.......O......
+  804fd8:	2a 4c 80 00 00 00 00 00 42 4c 80 00 00 00 00 00     *L......BL......
+  804fe8:	4c 4c 80 00 00 00 00 00 56 4c 80 00 00 00 00 00     LL......VL......
+  804ff8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805008:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805018:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805028:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805038:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  805048:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  805058:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  805068:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805078:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805088:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805098:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8050a8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8050b8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8050c8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8050d8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8050e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050f8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805100 <devtab>:
+  805100:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805110:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805120:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805130:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805140:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805150:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805160:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805170:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805180:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805190:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8051a0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8051b0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8051c0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8051d0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8051e0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8051f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805200:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805210:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805220:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805230:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805240:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805250:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805260:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805270:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805280:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805290:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,7877 @@
+
+obj/user/badsegment:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 09 00 00 00       	call   80002c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    /* Try to load the kernel's TSS selector into the DS register. */
+    asm volatile("movw $0x38,%ax; movw %ax,%ds");
+  800025:	66 b8 38 00          	mov    $0x38,%ax
+  800029:	8e d8                	mov    %eax,%ds
+}
+  80002b:	c3                   	ret
+
+000000000080002c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80002c:	55                   	push   %rbp
+  80002d:	48 89 e5             	mov    %rsp,%rbp
+  800030:	41 56                	push   %r14
+  800032:	41 55                	push   %r13
+  800034:	41 54                	push   %r12
+  800036:	53                   	push   %rbx
+  800037:	41 89 fd             	mov    %edi,%r13d
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80003d:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800044:	00 00 00 
+  800047:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80004e:	00 00 00 
+  800051:	48 39 c2             	cmp    %rax,%rdx
+  800054:	73 17                	jae    80006d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800056:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800059:	49 89 c4             	mov    %rax,%r12
+  80005c:	48 83 c3 08          	add    $0x8,%rbx
+  800060:	b8 00 00 00 00       	mov    $0x0,%eax
+  800065:	ff 53 f8             	call   *-0x8(%rbx)
+  800068:	4c 39 e3             	cmp    %r12,%rbx
+  80006b:	72 ef                	jb     80005c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80006d:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  800074:	00 00 00 
+  800077:	ff d0                	call   *%rax
+  800079:	89 c2                	mov    %eax,%edx
+  80007b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800081:	48 89 d0             	mov    %rdx,%rax
+  800084:	48 c1 e0 04          	shl    $0x4,%rax
+  800088:	48 29 d0             	sub    %rdx,%rax
+  80008b:	48 c1 e0 05          	shl    $0x5,%rax
+  80008f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800096:	00 00 00 
+  800099:	48 01 d0             	add    %rdx,%rax
+  80009c:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000a3:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a6:	45 85 ed             	test   %r13d,%r13d
+  8000a9:	7e 0d                	jle    8000b8 <libmain+0x8c>
+  8000ab:	49 8b 06             	mov    (%r14),%rax
+  8000ae:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b8:	4c 89 f6             	mov    %r14,%rsi
+  8000bb:	44 89 ef             	mov    %r13d,%edi
+  8000be:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c5:	00 00 00 
+  8000c8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ca:	48 b8 df 00 80 00 00 	movabs $0x8000df,%rax
+  8000d1:	00 00 00 
+  8000d4:	ff d0                	call   *%rax
+#endif
+}
+  8000d6:	5b                   	pop    %rbx
+  8000d7:	41 5c                	pop    %r12
+  8000d9:	41 5d                	pop    %r13
+  8000db:	41 5e                	pop    %r14
+  8000dd:	5d                   	pop    %rbp
+  8000de:	c3                   	ret
+
+00000000008000df <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000df:	55                   	push   %rbp
+  8000e0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e3:	48 b8 93 08 80 00 00 	movabs $0x800893,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f4:	48 b8 4a 01 80 00 00 	movabs $0x80014a,%rax
+  8000fb:	00 00 00 
+  8000fe:	ff d0                	call   *%rax
+}
+  800100:	5d                   	pop    %rbp
+  800101:	c3                   	ret
+
+0000000000800102 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800102:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80010c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800112:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800118:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80011e:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800120:	c3                   	ret
+
+0000000000800121 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800121:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800126:	bf 00 00 00 00       	mov    $0x0,%edi
+  80012b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800130:	ba 00 00 00 00       	mov    $0x0,%edx
+  800135:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80013b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800141:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800147:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800149:	c3                   	ret
+
+000000000080014a <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80014a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80014d:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800152:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800157:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800162:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800168:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80016e:	0f 05                	syscall
+    if (check && ret > 0) {
+  800170:	48 85 c0             	test   %rax,%rax
+  800173:	7f 01                	jg     800176 <sys_env_destroy+0x2c>
+}
+  800175:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800176:	55                   	push   %rbp
+  800177:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80017a:	49 89 c0             	mov    %rax,%r8
+  80017d:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800182:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800189:	00 00 00 
+  80018c:	be 29 00 00 00       	mov    $0x29,%esi
+  800191:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  8001a7:	00 00 00 
+  8001aa:	41 ff d1             	call   *%r9
+
+00000000008001ad <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001ad:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001d3:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001d5:	c3                   	ret
+
+00000000008001d6 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001d6:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001fc:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001fe:	c3                   	ret
+
+00000000008001ff <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001ff:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800204:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80020b:	00 00 00 
+  80020e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800220:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800222:	c3                   	ret
+
+0000000000800223 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800223:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800226:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80022b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800231:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800237:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800239:	c3                   	ret
+
+000000000080023a <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80023a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80023d:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800242:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80024b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800251:	0f 05                	syscall
+    if (check && ret > 0) {
+  800253:	48 85 c0             	test   %rax,%rax
+  800256:	7f 01                	jg     800259 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800258:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800259:	55                   	push   %rbp
+  80025a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80025d:	49 89 c0             	mov    %rax,%r8
+  800260:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800265:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  80026c:	00 00 00 
+  80026f:	be 29 00 00 00       	mov    $0x29,%esi
+  800274:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  80027b:	00 00 00 
+  80027e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800283:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  80028a:	00 00 00 
+  80028d:	41 ff d1             	call   *%r9
+
+0000000000800290 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800290:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800293:	48 63 d2             	movslq %edx,%rdx
+  800296:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800299:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80029e:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002a1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002a3:	48 85 c0             	test   %rax,%rax
+  8002a6:	7f 01                	jg     8002a9 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002a8:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002a9:	55                   	push   %rbp
+  8002aa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ad:	49 89 c0             	mov    %rax,%r8
+  8002b0:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002b5:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8002bc:	00 00 00 
+  8002bf:	be 29 00 00 00       	mov    $0x29,%esi
+  8002c4:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8002cb:	00 00 00 
+  8002ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d3:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  8002da:	00 00 00 
+  8002dd:	41 ff d1             	call   *%r9
+
+00000000008002e0 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002e0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002e3:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8002fa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002fc:	48 85 c0             	test   %rax,%rax
+  8002ff:	7f 01                	jg     800302 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800301:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800302:	55                   	push   %rbp
+  800303:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800306:	49 89 c0             	mov    %rax,%r8
+  800309:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80030e:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800315:	00 00 00 
+  800318:	be 29 00 00 00       	mov    $0x29,%esi
+  80031d:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800324:	00 00 00 
+  800327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80032c:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  800333:	00 00 00 
+  800336:	41 ff d1             	call   *%r9
+
+0000000000800339 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800339:	48 63 f6             	movslq %esi,%rsi
+  80033c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80033f:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800344:	ba 00 00 00 00       	mov    $0x0,%edx
+  800349:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80034f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800355:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80035b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80035d:	48 85 c0             	test   %rax,%rax
+  800360:	7f 01                	jg     800363 <sys_env_set_status+0x2a>
+}
+  800362:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800363:	55                   	push   %rbp
+  800364:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800367:	49 89 c0             	mov    %rax,%r8
+  80036a:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80036f:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800376:	00 00 00 
+  800379:	be 29 00 00 00       	mov    $0x29,%esi
+  80037e:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800385:	00 00 00 
+  800388:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038d:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  800394:	00 00 00 
+  800397:	41 ff d1             	call   *%r9
+
+000000000080039a <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80039a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80039d:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003b9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003bb:	48 85 c0             	test   %rax,%rax
+  8003be:	7f 01                	jg     8003c1 <sys_env_set_trapframe+0x27>
+}
+  8003c0:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003c1:	55                   	push   %rbp
+  8003c2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c5:	49 89 c0             	mov    %rax,%r8
+  8003c8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003cd:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8003d4:	00 00 00 
+  8003d7:	be 29 00 00 00       	mov    $0x29,%esi
+  8003dc:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8003e3:	00 00 00 
+  8003e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003eb:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  8003f2:	00 00 00 
+  8003f5:	41 ff d1             	call   *%r9
+
+00000000008003f8 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8003f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003fb:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800400:	ba 00 00 00 00       	mov    $0x0,%edx
+  800405:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80040b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800411:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800417:	0f 05                	syscall
+    if (check && ret > 0) {
+  800419:	48 85 c0             	test   %rax,%rax
+  80041c:	7f 01                	jg     80041f <sys_env_set_pgfault_upcall+0x27>
+}
+  80041e:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80041f:	55                   	push   %rbp
+  800420:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800423:	49 89 c0             	mov    %rax,%r8
+  800426:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80042b:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800432:	00 00 00 
+  800435:	be 29 00 00 00       	mov    $0x29,%esi
+  80043a:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800441:	00 00 00 
+  800444:	b8 00 00 00 00       	mov    $0x0,%eax
+  800449:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  800450:	00 00 00 
+  800453:	41 ff d1             	call   *%r9
+
+0000000000800456 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800456:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800459:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80045c:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800461:	4d 63 c0             	movslq %r8d,%r8
+  800464:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80046a:	0f 05                	syscall
+}
+  80046c:	c3                   	ret
+
+000000000080046d <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80046d:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800470:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800473:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800478:	4d 63 c0             	movslq %r8d,%r8
+  80047b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800481:	0f 05                	syscall
+}
+  800483:	c3                   	ret
+
+0000000000800484 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  800484:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800489:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80048c:	45 89 c0             	mov    %r8d,%r8d
+  80048f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800495:	0f 05                	syscall
+    if (check && ret > 0) {
+  800497:	48 85 c0             	test   %rax,%rax
+  80049a:	7f 01                	jg     80049d <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80049c:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80049d:	55                   	push   %rbp
+  80049e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004a1:	49 89 c0             	mov    %rax,%r8
+  8004a4:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004a9:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8004b0:	00 00 00 
+  8004b3:	be 29 00 00 00       	mov    $0x29,%esi
+  8004b8:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8004bf:	00 00 00 
+  8004c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c7:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  8004ce:	00 00 00 
+  8004d1:	41 ff d1             	call   *%r9
+
+00000000008004d4 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004d4:	55                   	push   %rbp
+  8004d5:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e8:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  8004ef:	00 00 00 
+  8004f2:	ff d0                	call   *%rax
+}
+  8004f4:	5d                   	pop    %rbp
+  8004f5:	c3                   	ret
+
+00000000008004f6 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004f6:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8004fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800500:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800516:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80051c:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80051e:	c3                   	ret
+
+000000000080051f <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80051f:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800524:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800540:	0f 05                	syscall
+    if (check && ret > 0) {
+  800542:	48 85 c0             	test   %rax,%rax
+  800545:	7f 01                	jg     800548 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800547:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800548:	55                   	push   %rbp
+  800549:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80054c:	49 89 c0             	mov    %rax,%r8
+  80054f:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800554:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  80055b:	00 00 00 
+  80055e:	be 29 00 00 00       	mov    $0x29,%esi
+  800563:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  80056a:	00 00 00 
+  80056d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800572:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  800579:	00 00 00 
+  80057c:	41 ff d1             	call   *%r9
+
+000000000080057f <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80057f:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800584:	bf 00 00 00 00       	mov    $0x0,%edi
+  800589:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80058e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800593:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800599:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80059f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005a5:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005a7:	c3                   	ret
+
+00000000008005a8 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005a8:	89 d2                	mov    %edx,%edx
+  8005aa:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005ac:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005c3:	0f 05                	syscall
+}
+  8005c5:	c3                   	ret
+
+00000000008005c6 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005c6:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c9:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e5:	0f 05                	syscall
+}
+  8005e7:	c3                   	ret
+
+00000000008005e8 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005e8:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005eb:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800601:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800607:	0f 05                	syscall
+}
+  800609:	c3                   	ret
+
+000000000080060a <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80060a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80060d:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800612:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800628:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80062e:	0f 05                	syscall
+    if (check && ret > 0) {
+  800630:	48 85 c0             	test   %rax,%rax
+  800633:	7f 01                	jg     800636 <sys_irq_ack+0x2c>
+}
+  800635:	c3                   	ret
+sys_irq_ack(int irq) {
+  800636:	55                   	push   %rbp
+  800637:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80063a:	49 89 c0             	mov    %rax,%r8
+  80063d:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800642:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800649:	00 00 00 
+  80064c:	be 29 00 00 00       	mov    $0x29,%esi
+  800651:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800658:	00 00 00 
+  80065b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800660:	49 b9 58 33 80 00 00 	movabs $0x803358,%r9
+  800667:	00 00 00 
+  80066a:	41 ff d1             	call   *%r9
+
+000000000080066d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80066d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800674:	ff ff ff 
+  800677:	48 01 f8             	add    %rdi,%rax
+  80067a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80067e:	c3                   	ret
+
+000000000080067f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80067f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800686:	ff ff ff 
+  800689:	48 01 f8             	add    %rdi,%rax
+  80068c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800690:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800696:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80069a:	c3                   	ret
+
+000000000080069b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80069b:	55                   	push   %rbp
+  80069c:	48 89 e5             	mov    %rsp,%rbp
+  80069f:	41 57                	push   %r15
+  8006a1:	41 56                	push   %r14
+  8006a3:	41 55                	push   %r13
+  8006a5:	41 54                	push   %r12
+  8006a7:	53                   	push   %rbx
+  8006a8:	48 83 ec 08          	sub    $0x8,%rsp
+  8006ac:	49 89 ff             	mov    %rdi,%r15
+  8006af:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b4:	49 bd 2a 2e 80 00 00 	movabs $0x802e2a,%r13
+  8006bb:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006be:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006c4:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c7:	48 89 df             	mov    %rbx,%rdi
+  8006ca:	41 ff d5             	call   *%r13
+  8006cd:	83 e0 04             	and    $0x4,%eax
+  8006d0:	74 17                	je     8006e9 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006d2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006d9:	4c 39 f3             	cmp    %r14,%rbx
+  8006dc:	75 e6                	jne    8006c4 <fd_alloc+0x29>
+  8006de:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006e4:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006e9:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006ec:	48 83 c4 08          	add    $0x8,%rsp
+  8006f0:	5b                   	pop    %rbx
+  8006f1:	41 5c                	pop    %r12
+  8006f3:	41 5d                	pop    %r13
+  8006f5:	41 5e                	pop    %r14
+  8006f7:	41 5f                	pop    %r15
+  8006f9:	5d                   	pop    %rbp
+  8006fa:	c3                   	ret
+
+00000000008006fb <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006fb:	83 ff 1f             	cmp    $0x1f,%edi
+  8006fe:	77 39                	ja     800739 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800700:	55                   	push   %rbp
+  800701:	48 89 e5             	mov    %rsp,%rbp
+  800704:	41 54                	push   %r12
+  800706:	53                   	push   %rbx
+  800707:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80070a:	48 63 df             	movslq %edi,%rbx
+  80070d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800714:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800718:	48 89 df             	mov    %rbx,%rdi
+  80071b:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  800722:	00 00 00 
+  800725:	ff d0                	call   *%rax
+  800727:	a8 04                	test   $0x4,%al
+  800729:	74 14                	je     80073f <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80072b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80072f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800734:	5b                   	pop    %rbx
+  800735:	41 5c                	pop    %r12
+  800737:	5d                   	pop    %rbp
+  800738:	c3                   	ret
+        return -E_INVAL;
+  800739:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80073e:	c3                   	ret
+        return -E_INVAL;
+  80073f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800744:	eb ee                	jmp    800734 <fd_lookup+0x39>
+
+0000000000800746 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800746:	55                   	push   %rbp
+  800747:	48 89 e5             	mov    %rsp,%rbp
+  80074a:	41 54                	push   %r12
+  80074c:	53                   	push   %rbx
+  80074d:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800750:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  800757:	00 00 00 
+  80075a:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800761:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800764:	39 3b                	cmp    %edi,(%rbx)
+  800766:	74 47                	je     8007af <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800768:	48 83 c0 08          	add    $0x8,%rax
+  80076c:	48 8b 18             	mov    (%rax),%rbx
+  80076f:	48 85 db             	test   %rbx,%rbx
+  800772:	75 f0                	jne    800764 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800774:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80077b:	00 00 00 
+  80077e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800784:	89 fa                	mov    %edi,%edx
+  800786:	48 bf c8 46 80 00 00 	movabs $0x8046c8,%rdi
+  80078d:	00 00 00 
+  800790:	b8 00 00 00 00       	mov    $0x0,%eax
+  800795:	48 b9 a8 34 80 00 00 	movabs $0x8034a8,%rcx
+  80079c:	00 00 00 
+  80079f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007a1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007a6:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007aa:	5b                   	pop    %rbx
+  8007ab:	41 5c                	pop    %r12
+  8007ad:	5d                   	pop    %rbp
+  8007ae:	c3                   	ret
+            return 0;
+  8007af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b4:	eb f0                	jmp    8007a6 <dev_lookup+0x60>
+
+00000000008007b6 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007b6:	55                   	push   %rbp
+  8007b7:	48 89 e5             	mov    %rsp,%rbp
+  8007ba:	41 55                	push   %r13
+  8007bc:	41 54                	push   %r12
+  8007be:	53                   	push   %rbx
+  8007bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8007c3:	48 89 fb             	mov    %rdi,%rbx
+  8007c6:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007c9:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007d0:	ff ff ff 
+  8007d3:	48 01 df             	add    %rbx,%rdi
+  8007d6:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007da:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007de:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  8007e5:	00 00 00 
+  8007e8:	ff d0                	call   *%rax
+  8007ea:	41 89 c5             	mov    %eax,%r13d
+  8007ed:	85 c0                	test   %eax,%eax
+  8007ef:	78 06                	js     8007f7 <fd_close+0x41>
+  8007f1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007f5:	74 1a                	je     800811 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007f7:	45 84 e4             	test   %r12b,%r12b
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800803:	44 89 e8             	mov    %r13d,%eax
+  800806:	48 83 c4 18          	add    $0x18,%rsp
+  80080a:	5b                   	pop    %rbx
+  80080b:	41 5c                	pop    %r12
+  80080d:	41 5d                	pop    %r13
+  80080f:	5d                   	pop    %rbp
+  800810:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800811:	8b 3b                	mov    (%rbx),%edi
+  800813:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800817:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  80081e:	00 00 00 
+  800821:	ff d0                	call   *%rax
+  800823:	41 89 c5             	mov    %eax,%r13d
+  800826:	85 c0                	test   %eax,%eax
+  800828:	78 1b                	js     800845 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80082a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80082e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800832:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800838:	48 85 c0             	test   %rax,%rax
+  80083b:	74 08                	je     800845 <fd_close+0x8f>
+  80083d:	48 89 df             	mov    %rbx,%rdi
+  800840:	ff d0                	call   *%rax
+  800842:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800845:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80084a:	48 89 de             	mov    %rbx,%rsi
+  80084d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800852:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  800859:	00 00 00 
+  80085c:	ff d0                	call   *%rax
+    return res;
+  80085e:	eb a3                	jmp    800803 <fd_close+0x4d>
+
+0000000000800860 <close>:
+
+int
+close(int fdnum) {
+  800860:	55                   	push   %rbp
+  800861:	48 89 e5             	mov    %rsp,%rbp
+  800864:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800868:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80086c:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800873:	00 00 00 
+  800876:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800878:	85 c0                	test   %eax,%eax
+  80087a:	78 15                	js     800891 <close+0x31>
+
+    return fd_close(fd, 1);
+  80087c:	be 01 00 00 00       	mov    $0x1,%esi
+  800881:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800885:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  80088c:	00 00 00 
+  80088f:	ff d0                	call   *%rax
+}
+  800891:	c9                   	leave
+  800892:	c3                   	ret
+
+0000000000800893 <close_all>:
+
+void
+close_all(void) {
+  800893:	55                   	push   %rbp
+  800894:	48 89 e5             	mov    %rsp,%rbp
+  800897:	41 54                	push   %r12
+  800899:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80089a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80089f:	49 bc 60 08 80 00 00 	movabs $0x800860,%r12
+  8008a6:	00 00 00 
+  8008a9:	89 df                	mov    %ebx,%edi
+  8008ab:	41 ff d4             	call   *%r12
+  8008ae:	83 c3 01             	add    $0x1,%ebx
+  8008b1:	83 fb 20             	cmp    $0x20,%ebx
+  8008b4:	75 f3                	jne    8008a9 <close_all+0x16>
+}
+  8008b6:	5b                   	pop    %rbx
+  8008b7:	41 5c                	pop    %r12
+  8008b9:	5d                   	pop    %rbp
+  8008ba:	c3                   	ret
+
+00000000008008bb <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008bb:	55                   	push   %rbp
+  8008bc:	48 89 e5             	mov    %rsp,%rbp
+  8008bf:	41 57                	push   %r15
+  8008c1:	41 56                	push   %r14
+  8008c3:	41 55                	push   %r13
+  8008c5:	41 54                	push   %r12
+  8008c7:	53                   	push   %rbx
+  8008c8:	48 83 ec 18          	sub    $0x18,%rsp
+  8008cc:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008cf:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008d3:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  8008da:	00 00 00 
+  8008dd:	ff d0                	call   *%rax
+  8008df:	89 c3                	mov    %eax,%ebx
+  8008e1:	85 c0                	test   %eax,%eax
+  8008e3:	0f 88 b8 00 00 00    	js     8009a1 <dup+0xe6>
+    close(newfdnum);
+  8008e9:	44 89 e7             	mov    %r12d,%edi
+  8008ec:	48 b8 60 08 80 00 00 	movabs $0x800860,%rax
+  8008f3:	00 00 00 
+  8008f6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008f8:	4d 63 ec             	movslq %r12d,%r13
+  8008fb:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800902:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800906:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80090a:	4c 89 ff             	mov    %r15,%rdi
+  80090d:	49 be 7f 06 80 00 00 	movabs $0x80067f,%r14
+  800914:	00 00 00 
+  800917:	41 ff d6             	call   *%r14
+  80091a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80091d:	4c 89 ef             	mov    %r13,%rdi
+  800920:	41 ff d6             	call   *%r14
+  800923:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800926:	48 89 df             	mov    %rbx,%rdi
+  800929:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  800930:	00 00 00 
+  800933:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800935:	a8 04                	test   $0x4,%al
+  800937:	74 2b                	je     800964 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800939:	41 89 c1             	mov    %eax,%r9d
+  80093c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800942:	4c 89 f1             	mov    %r14,%rcx
+  800945:	ba 00 00 00 00       	mov    $0x0,%edx
+  80094a:	48 89 de             	mov    %rbx,%rsi
+  80094d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800952:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  800959:	00 00 00 
+  80095c:	ff d0                	call   *%rax
+  80095e:	89 c3                	mov    %eax,%ebx
+  800960:	85 c0                	test   %eax,%eax
+  800962:	78 4e                	js     8009b2 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800964:	4c 89 ff             	mov    %r15,%rdi
+  800967:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  80096e:	00 00 00 
+  800971:	ff d0                	call   *%rax
+  800973:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800976:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80097c:	4c 89 e9             	mov    %r13,%rcx
+  80097f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800984:	4c 89 fe             	mov    %r15,%rsi
+  800987:	bf 00 00 00 00       	mov    $0x0,%edi
+  80098c:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  800993:	00 00 00 
+  800996:	ff d0                	call   *%rax
+  800998:	89 c3                	mov    %eax,%ebx
+  80099a:	85 c0                	test   %eax,%eax
+  80099c:	78 14                	js     8009b2 <dup+0xf7>
+
+    return newfdnum;
+  80099e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009a1:	89 d8                	mov    %ebx,%eax
+  8009a3:	48 83 c4 18          	add    $0x18,%rsp
+  8009a7:	5b                   	pop    %rbx
+  8009a8:	41 5c                	pop    %r12
+  8009aa:	41 5d                	pop    %r13
+  8009ac:	41 5e                	pop    %r14
+  8009ae:	41 5f                	pop    %r15
+  8009b0:	5d                   	pop    %rbp
+  8009b1:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009b2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b7:	4c 89 ee             	mov    %r13,%rsi
+  8009ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009bf:	49 bc e0 02 80 00 00 	movabs $0x8002e0,%r12
+  8009c6:	00 00 00 
+  8009c9:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d1:	4c 89 f6             	mov    %r14,%rsi
+  8009d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d9:	41 ff d4             	call   *%r12
+    return res;
+  8009dc:	eb c3                	jmp    8009a1 <dup+0xe6>
+
+00000000008009de <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009de:	55                   	push   %rbp
+  8009df:	48 89 e5             	mov    %rsp,%rbp
+  8009e2:	41 56                	push   %r14
+  8009e4:	41 55                	push   %r13
+  8009e6:	41 54                	push   %r12
+  8009e8:	53                   	push   %rbx
+  8009e9:	48 83 ec 10          	sub    $0x10,%rsp
+  8009ed:	89 fb                	mov    %edi,%ebx
+  8009ef:	49 89 f4             	mov    %rsi,%r12
+  8009f2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009f5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009f9:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800a00:	00 00 00 
+  800a03:	ff d0                	call   *%rax
+  800a05:	85 c0                	test   %eax,%eax
+  800a07:	78 4c                	js     800a55 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a09:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a0d:	41 8b 3e             	mov    (%r14),%edi
+  800a10:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a14:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  800a1b:	00 00 00 
+  800a1e:	ff d0                	call   *%rax
+  800a20:	85 c0                	test   %eax,%eax
+  800a22:	78 35                	js     800a59 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a24:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a28:	83 e0 03             	and    $0x3,%eax
+  800a2b:	83 f8 01             	cmp    $0x1,%eax
+  800a2e:	74 2d                	je     800a5d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a30:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a34:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a38:	48 85 c0             	test   %rax,%rax
+  800a3b:	74 56                	je     800a93 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a3d:	4c 89 ea             	mov    %r13,%rdx
+  800a40:	4c 89 e6             	mov    %r12,%rsi
+  800a43:	4c 89 f7             	mov    %r14,%rdi
+  800a46:	ff d0                	call   *%rax
+}
+  800a48:	48 83 c4 10          	add    $0x10,%rsp
+  800a4c:	5b                   	pop    %rbx
+  800a4d:	41 5c                	pop    %r12
+  800a4f:	41 5d                	pop    %r13
+  800a51:	41 5e                	pop    %r14
+  800a53:	5d                   	pop    %rbp
+  800a54:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a55:	48 98                	cltq
+  800a57:	eb ef                	jmp    800a48 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a59:	48 98                	cltq
+  800a5b:	eb eb                	jmp    800a48 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a5d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a64:	00 00 00 
+  800a67:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a6d:	89 da                	mov    %ebx,%edx
+  800a6f:	48 bf 09 47 80 00 00 	movabs $0x804709,%rdi
+  800a76:	00 00 00 
+  800a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7e:	48 b9 a8 34 80 00 00 	movabs $0x8034a8,%rcx
+  800a85:	00 00 00 
+  800a88:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a8a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a91:	eb b5                	jmp    800a48 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a93:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a9a:	eb ac                	jmp    800a48 <read+0x6a>
+
+0000000000800a9c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800a9c:	55                   	push   %rbp
+  800a9d:	48 89 e5             	mov    %rsp,%rbp
+  800aa0:	41 57                	push   %r15
+  800aa2:	41 56                	push   %r14
+  800aa4:	41 55                	push   %r13
+  800aa6:	41 54                	push   %r12
+  800aa8:	53                   	push   %rbx
+  800aa9:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800aad:	48 85 d2             	test   %rdx,%rdx
+  800ab0:	74 54                	je     800b06 <readn+0x6a>
+  800ab2:	41 89 fd             	mov    %edi,%r13d
+  800ab5:	49 89 f6             	mov    %rsi,%r14
+  800ab8:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800abb:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ac0:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ac5:	49 bf de 09 80 00 00 	movabs $0x8009de,%r15
+  800acc:	00 00 00 
+  800acf:	4c 89 e2             	mov    %r12,%rdx
+  800ad2:	48 29 f2             	sub    %rsi,%rdx
+  800ad5:	4c 01 f6             	add    %r14,%rsi
+  800ad8:	44 89 ef             	mov    %r13d,%edi
+  800adb:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ade:	85 c0                	test   %eax,%eax
+  800ae0:	78 20                	js     800b02 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ae2:	01 c3                	add    %eax,%ebx
+  800ae4:	85 c0                	test   %eax,%eax
+  800ae6:	74 08                	je     800af0 <readn+0x54>
+  800ae8:	48 63 f3             	movslq %ebx,%rsi
+  800aeb:	4c 39 e6             	cmp    %r12,%rsi
+  800aee:	72 df                	jb     800acf <readn+0x33>
+    }
+    return res;
+  800af0:	48 63 c3             	movslq %ebx,%rax
+}
+  800af3:	48 83 c4 08          	add    $0x8,%rsp
+  800af7:	5b                   	pop    %rbx
+  800af8:	41 5c                	pop    %r12
+  800afa:	41 5d                	pop    %r13
+  800afc:	41 5e                	pop    %r14
+  800afe:	41 5f                	pop    %r15
+  800b00:	5d                   	pop    %rbp
+  800b01:	c3                   	ret
+        if (inc < 0) return inc;
+  800b02:	48 98                	cltq
+  800b04:	eb ed                	jmp    800af3 <readn+0x57>
+    int inc = 1, res = 0;
+  800b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b0b:	eb e3                	jmp    800af0 <readn+0x54>
+
+0000000000800b0d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b0d:	55                   	push   %rbp
+  800b0e:	48 89 e5             	mov    %rsp,%rbp
+  800b11:	41 56                	push   %r14
+  800b13:	41 55                	push   %r13
+  800b15:	41 54                	push   %r12
+  800b17:	53                   	push   %rbx
+  800b18:	48 83 ec 10          	sub    $0x10,%rsp
+  800b1c:	89 fb                	mov    %edi,%ebx
+  800b1e:	49 89 f4             	mov    %rsi,%r12
+  800b21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b28:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800b2f:	00 00 00 
+  800b32:	ff d0                	call   *%rax
+  800b34:	85 c0                	test   %eax,%eax
+  800b36:	78 47                	js     800b7f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b3c:	41 8b 3e             	mov    (%r14),%edi
+  800b3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b43:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  800b4a:	00 00 00 
+  800b4d:	ff d0                	call   *%rax
+  800b4f:	85 c0                	test   %eax,%eax
+  800b51:	78 30                	js     800b83 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b53:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b58:	74 2d                	je     800b87 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b5a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b5e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b62:	48 85 c0             	test   %rax,%rax
+  800b65:	74 56                	je     800bbd <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b67:	4c 89 ea             	mov    %r13,%rdx
+  800b6a:	4c 89 e6             	mov    %r12,%rsi
+  800b6d:	4c 89 f7             	mov    %r14,%rdi
+  800b70:	ff d0                	call   *%rax
+}
+  800b72:	48 83 c4 10          	add    $0x10,%rsp
+  800b76:	5b                   	pop    %rbx
+  800b77:	41 5c                	pop    %r12
+  800b79:	41 5d                	pop    %r13
+  800b7b:	41 5e                	pop    %r14
+  800b7d:	5d                   	pop    %rbp
+  800b7e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b7f:	48 98                	cltq
+  800b81:	eb ef                	jmp    800b72 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b83:	48 98                	cltq
+  800b85:	eb eb                	jmp    800b72 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b87:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800b8e:	00 00 00 
+  800b91:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b97:	89 da                	mov    %ebx,%edx
+  800b99:	48 bf 25 47 80 00 00 	movabs $0x804725,%rdi
+  800ba0:	00 00 00 
+  800ba3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba8:	48 b9 a8 34 80 00 00 	movabs $0x8034a8,%rcx
+  800baf:	00 00 00 
+  800bb2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bb4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bbb:	eb b5                	jmp    800b72 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bbd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bc4:	eb ac                	jmp    800b72 <write+0x65>
+
+0000000000800bc6 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bc6:	55                   	push   %rbp
+  800bc7:	48 89 e5             	mov    %rsp,%rbp
+  800bca:	41 54                	push   %r12
+  800bcc:	53                   	push   %rbx
+  800bcd:	48 83 ec 10          	sub    $0x10,%rsp
+  800bd1:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bd3:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd7:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800bde:	00 00 00 
+  800be1:	ff d0                	call   *%rax
+  800be3:	85 c0                	test   %eax,%eax
+  800be5:	78 3e                	js     800c25 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be7:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800beb:	41 8b 3c 24          	mov    (%r12),%edi
+  800bef:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bf3:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  800bfa:	00 00 00 
+  800bfd:	ff d0                	call   *%rax
+  800bff:	85 c0                	test   %eax,%eax
+  800c01:	78 22                	js     800c25 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c03:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c07:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c0b:	48 85 c0             	test   %rax,%rax
+  800c0e:	74 0b                	je     800c1b <seek+0x55>
+  800c10:	89 de                	mov    %ebx,%esi
+  800c12:	4c 89 e7             	mov    %r12,%rdi
+  800c15:	ff d0                	call   *%rax
+  800c17:	85 c0                	test   %eax,%eax
+  800c19:	78 0a                	js     800c25 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c1b:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c20:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c25:	48 83 c4 10          	add    $0x10,%rsp
+  800c29:	5b                   	pop    %rbx
+  800c2a:	41 5c                	pop    %r12
+  800c2c:	5d                   	pop    %rbp
+  800c2d:	c3                   	ret
+
+0000000000800c2e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c2e:	55                   	push   %rbp
+  800c2f:	48 89 e5             	mov    %rsp,%rbp
+  800c32:	41 55                	push   %r13
+  800c34:	41 54                	push   %r12
+  800c36:	53                   	push   %rbx
+  800c37:	48 83 ec 18          	sub    $0x18,%rsp
+  800c3b:	89 fb                	mov    %edi,%ebx
+  800c3d:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c40:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c44:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800c4b:	00 00 00 
+  800c4e:	ff d0                	call   *%rax
+  800c50:	85 c0                	test   %eax,%eax
+  800c52:	78 38                	js     800c8c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c54:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c58:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c5c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c60:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  800c67:	00 00 00 
+  800c6a:	ff d0                	call   *%rax
+  800c6c:	85 c0                	test   %eax,%eax
+  800c6e:	78 1c                	js     800c8c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c70:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c75:	74 20                	je     800c97 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c7b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c7f:	48 85 c0             	test   %rax,%rax
+  800c82:	74 47                	je     800ccb <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c84:	44 89 e6             	mov    %r12d,%esi
+  800c87:	4c 89 ef             	mov    %r13,%rdi
+  800c8a:	ff d0                	call   *%rax
+}
+  800c8c:	48 83 c4 18          	add    $0x18,%rsp
+  800c90:	5b                   	pop    %rbx
+  800c91:	41 5c                	pop    %r12
+  800c93:	41 5d                	pop    %r13
+  800c95:	5d                   	pop    %rbp
+  800c96:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800c97:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800c9e:	00 00 00 
+  800ca1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ca7:	89 da                	mov    %ebx,%edx
+  800ca9:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  800cb0:	00 00 00 
+  800cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb8:	48 b9 a8 34 80 00 00 	movabs $0x8034a8,%rcx
+  800cbf:	00 00 00 
+  800cc2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cc4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc9:	eb c1                	jmp    800c8c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ccb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800cd0:	eb ba                	jmp    800c8c <ftruncate+0x5e>
+
+0000000000800cd2 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cd2:	55                   	push   %rbp
+  800cd3:	48 89 e5             	mov    %rsp,%rbp
+  800cd6:	41 54                	push   %r12
+  800cd8:	53                   	push   %rbx
+  800cd9:	48 83 ec 10          	sub    $0x10,%rsp
+  800cdd:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ce0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ce4:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  800ceb:	00 00 00 
+  800cee:	ff d0                	call   *%rax
+  800cf0:	85 c0                	test   %eax,%eax
+  800cf2:	78 4e                	js     800d42 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800cf8:	41 8b 3c 24          	mov    (%r12),%edi
+  800cfc:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d00:	48 b8 46 07 80 00 00 	movabs $0x800746,%rax
+  800d07:	00 00 00 
+  800d0a:	ff d0                	call   *%rax
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	78 32                	js     800d42 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d10:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d14:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d19:	74 30                	je     800d4b <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d1b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d1e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d25:	00 00 00 
+    stat->st_isdir = 0;
+  800d28:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d2f:	00 00 00 
+    stat->st_dev = dev;
+  800d32:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d39:	48 89 de             	mov    %rbx,%rsi
+  800d3c:	4c 89 e7             	mov    %r12,%rdi
+  800d3f:	ff 50 28             	call   *0x28(%rax)
+}
+  800d42:	48 83 c4 10          	add    $0x10,%rsp
+  800d46:	5b                   	pop    %rbx
+  800d47:	41 5c                	pop    %r12
+  800d49:	5d                   	pop    %rbp
+  800d4a:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d4b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d50:	eb f0                	jmp    800d42 <fstat+0x70>
+
+0000000000800d52 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d52:	55                   	push   %rbp
+  800d53:	48 89 e5             	mov    %rsp,%rbp
+  800d56:	41 54                	push   %r12
+  800d58:	53                   	push   %rbx
+  800d59:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d5c:	be 00 00 00 00       	mov    $0x0,%esi
+  800d61:	48 b8 c0 1e 80 00 00 	movabs $0x801ec0,%rax
+  800d68:	00 00 00 
+  800d6b:	ff d0                	call   *%rax
+  800d6d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d6f:	85 c0                	test   %eax,%eax
+  800d71:	78 25                	js     800d98 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d73:	4c 89 e6             	mov    %r12,%rsi
+  800d76:	89 c7                	mov    %eax,%edi
+  800d78:	48 b8 d2 0c 80 00 00 	movabs $0x800cd2,%rax
+  800d7f:	00 00 00 
+  800d82:	ff d0                	call   *%rax
+  800d84:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d87:	89 df                	mov    %ebx,%edi
+  800d89:	48 b8 60 08 80 00 00 	movabs $0x800860,%rax
+  800d90:	00 00 00 
+  800d93:	ff d0                	call   *%rax
+
+    return res;
+  800d95:	44 89 e3             	mov    %r12d,%ebx
+}
+  800d98:	89 d8                	mov    %ebx,%eax
+  800d9a:	5b                   	pop    %rbx
+  800d9b:	41 5c                	pop    %r12
+  800d9d:	5d                   	pop    %rbp
+  800d9e:	c3                   	ret
+
+0000000000800d9f <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800d9f:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800da6:	00 00 00 
+  800da9:	83 38 00             	cmpl   $0x0,(%rax)
+  800dac:	74 0a                	je     800db8 <fsenv+0x19>
+    return envid;
+}
+  800dae:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800db5:	00 00 
+  800db7:	c3                   	ret
+fsenv(void) {
+  800db8:	55                   	push   %rbp
+  800db9:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dbc:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dc1:	48 b8 29 46 80 00 00 	movabs $0x804629,%rax
+  800dc8:	00 00 00 
+  800dcb:	ff d0                	call   *%rax
+  800dcd:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dd4:	00 00 
+}
+  800dd6:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800ddd:	00 00 
+  800ddf:	5d                   	pop    %rbp
+  800de0:	c3                   	ret
+
+0000000000800de1 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800de1:	55                   	push   %rbp
+  800de2:	48 89 e5             	mov    %rsp,%rbp
+  800de5:	41 54                	push   %r12
+  800de7:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800de8:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800ded:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800df2:	48 89 de             	mov    %rbx,%rsi
+  800df5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dfa:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  800e01:	00 00 00 
+  800e04:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e06:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e0d:	00 00 00 
+  800e10:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e1b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e20:	48 89 de             	mov    %rbx,%rsi
+  800e23:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e28:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  800e2f:	00 00 00 
+  800e32:	ff d0                	call   *%rax
+  800e34:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e36:	85 c0                	test   %eax,%eax
+  800e38:	0f 88 a2 00 00 00    	js     800ee0 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e3e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e45:	00 00 00 
+  800e48:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e4e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e53:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e55:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e5a:	49 bc f2 2f 80 00 00 	movabs $0x802ff2,%r12
+  800e61:	00 00 00 
+  800e64:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e67:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e6c:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e6f:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+  800e7b:	89 c7                	mov    %eax,%edi
+  800e7d:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e83:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e88:	48 89 da             	mov    %rbx,%rdx
+  800e8b:	be 09 00 00 00       	mov    $0x9,%esi
+  800e90:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800e9c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea6:	be 00 00 00 00       	mov    $0x0,%esi
+  800eab:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb0:	48 b8 af 45 80 00 00 	movabs $0x8045af,%rax
+  800eb7:	00 00 00 
+  800eba:	ff d0                	call   *%rax
+  800ebc:	89 c3                	mov    %eax,%ebx
+  800ebe:	85 c0                	test   %eax,%eax
+  800ec0:	78 25                	js     800ee7 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ec2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ec9:	00 00 00 
+  800ecc:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ed2:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ed9:	00 00 
+    return 0;
+  800edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800ee0:	89 d8                	mov    %ebx,%eax
+  800ee2:	5b                   	pop    %rbx
+  800ee3:	41 5c                	pop    %r12
+  800ee5:	5d                   	pop    %rbp
+  800ee6:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800ee7:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800eec:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800ef1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef6:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  800efd:	00 00 00 
+  800f00:	ff d0                	call   *%rax
+        return res;
+  800f02:	eb dc                	jmp    800ee0 <fschan_setup+0xff>
+
+0000000000800f04 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f04:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f0b:	00 00 00 
+  800f0e:	80 38 00             	cmpb   $0x0,(%rax)
+  800f11:	74 55                	je     800f68 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f13:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f1a:	00 00 00 
+  800f1d:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f23:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f28:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f2f:	00 00 00 
+  800f32:	3b 0a                	cmp    (%rdx),%ecx
+  800f34:	75 01                	jne    800f37 <fschan+0x33>
+}
+  800f36:	c3                   	ret
+fschan(void) {
+  800f37:	55                   	push   %rbp
+  800f38:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f3b:	48 b8 e1 0d 80 00 00 	movabs $0x800de1,%rax
+  800f42:	00 00 00 
+  800f45:	ff d0                	call   *%rax
+  800f47:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f49:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f4e:	85 d2                	test   %edx,%edx
+  800f50:	78 02                	js     800f54 <fschan+0x50>
+}
+  800f52:	5d                   	pop    %rbp
+  800f53:	c3                   	ret
+        fschan_enabled = 0;
+  800f54:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f5b:	00 00 00 
+  800f5e:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f66:	eb ea                	jmp    800f52 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f68:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6d:	c3                   	ret
+
+0000000000800f6e <fbuf>:
+fbuf(struct Fd *fd) {
+  800f6e:	55                   	push   %rbp
+  800f6f:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f72:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  800f79:	00 00 00 
+  800f7c:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f83:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f87:	77 12                	ja     800f9b <fbuf+0x2d>
+  800f89:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800f8d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800f94:	00 00 00 
+  800f97:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800f9b:	48 89 d0             	mov    %rdx,%rax
+  800f9e:	5d                   	pop    %rbp
+  800f9f:	c3                   	ret
+
+0000000000800fa0 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fa0:	55                   	push   %rbp
+  800fa1:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fa4:	48 83 c7 40          	add    $0x40,%rdi
+  800fa8:	48 b8 2c 30 80 00 00 	movabs $0x80302c,%rax
+  800faf:	00 00 00 
+  800fb2:	ff d0                	call   *%rax
+  800fb4:	84 c0                	test   %al,%al
+  800fb6:	75 02                	jne    800fba <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fb8:	5d                   	pop    %rbp
+  800fb9:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fba:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  800fc1:	00 00 00 
+  800fc4:	ff d0                	call   *%rax
+  800fc6:	89 c7                	mov    %eax,%edi
+  800fc8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd8:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fdd:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  800fe4:	00 00 00 
+  800fe7:	ff d0                	call   *%rax
+}
+  800fe9:	eb cd                	jmp    800fb8 <fschan_publish+0x18>
+
+0000000000800feb <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  800feb:	55                   	push   %rbp
+  800fec:	48 89 e5             	mov    %rsp,%rbp
+  800fef:	41 57                	push   %r15
+  800ff1:	41 56                	push   %r14
+  800ff3:	41 55                	push   %r13
+  800ff5:	41 54                	push   %r12
+  800ff7:	53                   	push   %rbx
+  800ff8:	48 83 ec 48          	sub    $0x48,%rsp
+  800ffc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801000:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801004:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801007:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80100b:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80100e:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801015:	00 00 00 
+  801018:	8b 02                	mov    (%rdx),%eax
+  80101a:	83 c0 01             	add    $0x1,%eax
+  80101d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801022:	0f 44 c1             	cmove  %ecx,%eax
+  801025:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801027:	4d 85 c0             	test   %r8,%r8
+  80102a:	74 2c                	je     801058 <fschan_rw+0x6d>
+  80102c:	45 89 ce             	mov    %r9d,%r14d
+  80102f:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801036:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80103a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801040:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801047:	00 
+  801048:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80104e:	b8 01 00 00 00       	mov    $0x1,%eax
+  801053:	e9 41 01 00 00       	jmp    801199 <fschan_rw+0x1ae>
+  801058:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80105c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801060:	e9 9c 01 00 00       	jmp    801201 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801065:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801069:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80106c:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80106f:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801072:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801076:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80107a:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80107e:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801082:	48 89 da             	mov    %rbx,%rdx
+  801085:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801091:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801095:	48 b8 a0 0f 80 00 00 	movabs $0x800fa0,%rax
+  80109c:	00 00 00 
+  80109f:	ff d0                	call   *%rax
+            queued += blk;
+  8010a1:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010a4:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010a8:	4d 39 fc             	cmp    %r15,%r12
+  8010ab:	73 6b                	jae    801118 <fschan_rw+0x12d>
+  8010ad:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010b1:	77 65                	ja     801118 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010b3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010b7:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010bb:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  8010c2:	00 00 00 
+  8010c5:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010c7:	4c 89 fb             	mov    %r15,%rbx
+  8010ca:	4c 29 e3             	sub    %r12,%rbx
+  8010cd:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010d2:	48 39 d3             	cmp    %rdx,%rbx
+  8010d5:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010d9:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010dd:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010e1:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010e5:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010e8:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010ea:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8010f1:	00 00 00 
+  8010f4:	8b 09                	mov    (%rcx),%ecx
+  8010f6:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8010f9:	83 fe 03             	cmp    $0x3,%esi
+  8010fc:	0f 85 63 ff ff ff    	jne    801065 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801102:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801106:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801109:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80110c:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80110f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801113:	e9 79 ff ff ff       	jmp    801091 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801118:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80111c:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801123:	48 89 df             	mov    %rbx,%rdi
+  801126:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  80112d:	00 00 00 
+  801130:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801132:	48 89 df             	mov    %rbx,%rdi
+  801135:	48 b8 58 30 80 00 00 	movabs $0x803058,%rax
+  80113c:	00 00 00 
+  80113f:	ff d0                	call   *%rax
+  801141:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801145:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801149:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80114d:	75 25                	jne    801174 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80114f:	8b 40 04             	mov    0x4(%rax),%eax
+  801152:	85 c0                	test   %eax,%eax
+  801154:	0f 88 86 00 00 00    	js     8011e0 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80115a:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80115e:	74 5b                	je     8011bb <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801160:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801164:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801168:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80116c:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801170:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801174:	48 89 df             	mov    %rbx,%rdi
+  801177:	48 b8 7f 30 80 00 00 	movabs $0x80307f,%rax
+  80117e:	00 00 00 
+  801181:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801183:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801187:	83 f0 01             	xor    $0x1,%eax
+  80118a:	4d 39 fc             	cmp    %r15,%r12
+  80118d:	0f 92 c2             	setb   %dl
+  801190:	84 c2                	test   %al,%dl
+  801192:	75 05                	jne    801199 <fschan_rw+0x1ae>
+  801194:	45 85 ed             	test   %r13d,%r13d
+  801197:	74 50                	je     8011e9 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801199:	4d 39 fc             	cmp    %r15,%r12
+  80119c:	0f 92 c1             	setb   %cl
+  80119f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011a3:	0f 96 c2             	setbe  %dl
+  8011a6:	84 d1                	test   %dl,%cl
+  8011a8:	0f 84 6a ff ff ff    	je     801118 <fschan_rw+0x12d>
+  8011ae:	84 c0                	test   %al,%al
+  8011b0:	0f 85 fd fe ff ff    	jne    8010b3 <fschan_rw+0xc8>
+  8011b6:	e9 5d ff ff ff       	jmp    801118 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011bb:	48 63 d0             	movslq %eax,%rdx
+  8011be:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011c2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011c6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011ca:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011ce:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011d2:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  8011d9:	00 00 00 
+  8011dc:	ff d0                	call   *%rax
+  8011de:	eb 80                	jmp    801160 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011e0:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011e3:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011e7:	eb 8b                	jmp    801174 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011e9:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8011ee:	0f 85 68 fe ff ff    	jne    80105c <fschan_rw+0x71>
+  8011f4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8011f7:	85 c0                	test   %eax,%eax
+  8011f9:	0f 84 5d fe ff ff    	je     80105c <fschan_rw+0x71>
+  8011ff:	48 98                	cltq
+}
+  801201:	48 83 c4 48          	add    $0x48,%rsp
+  801205:	5b                   	pop    %rbx
+  801206:	41 5c                	pop    %r12
+  801208:	41 5d                	pop    %r13
+  80120a:	41 5e                	pop    %r14
+  80120c:	41 5f                	pop    %r15
+  80120e:	5d                   	pop    %rbp
+  80120f:	c3                   	ret
+
+0000000000801210 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801210:	55                   	push   %rbp
+  801211:	48 89 e5             	mov    %rsp,%rbp
+  801214:	41 56                	push   %r14
+  801216:	41 55                	push   %r13
+  801218:	41 54                	push   %r12
+  80121a:	53                   	push   %rbx
+  80121b:	48 83 ec 10          	sub    $0x10,%rsp
+  80121f:	49 89 fe             	mov    %rdi,%r14
+  801222:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801225:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801229:	48 29 f3             	sub    %rsi,%rbx
+  80122c:	48 39 d3             	cmp    %rdx,%rbx
+  80122f:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801233:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80123a:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80123b:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801240:	49 bd 89 2e 80 00 00 	movabs $0x802e89,%r13
+  801247:	00 00 00 
+  80124a:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801251:	76 1e                	jbe    801271 <mmap_fault+0x61>
+  801253:	4c 01 e7             	add    %r12,%rdi
+  801256:	41 ff d5             	call   *%r13
+  801259:	84 c0                	test   %al,%al
+  80125b:	75 14                	jne    801271 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80125d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801261:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801268:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80126c:	48 39 df             	cmp    %rbx,%rdi
+  80126f:	72 e2                	jb     801253 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  801271:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801278:	00 00 00 
+  80127b:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801282:	00 00 00 
+  801285:	4c 89 f0             	mov    %r14,%rax
+  801288:	48 29 d0             	sub    %rdx,%rax
+  80128b:	48 c1 f8 03          	sar    $0x3,%rax
+  80128f:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801296:	aa aa aa 
+  801299:	48 0f af c2          	imul   %rdx,%rax
+  80129d:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012a1:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012a6:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012aa:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012ac:	44 89 e0             	mov    %r12d,%eax
+  8012af:	41 03 46 10          	add    0x10(%r14),%eax
+  8012b3:	41 2b 06             	sub    (%r14),%eax
+  8012b6:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012bd:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012c1:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012c5:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012c8:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  8012cf:	00 00 00 
+  8012d2:	ff d0                	call   *%rax
+  8012d4:	89 c7                	mov    %eax,%edi
+  8012d6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012dc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012e1:	48 89 da             	mov    %rbx,%rdx
+  8012e4:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012e9:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  8012f0:	00 00 00 
+  8012f3:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8012f5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012fe:	4c 89 e6             	mov    %r12,%rsi
+  801301:	bf 00 00 00 00       	mov    $0x0,%edi
+  801306:	48 b8 af 45 80 00 00 	movabs $0x8045af,%rax
+  80130d:	00 00 00 
+  801310:	ff d0                	call   *%rax
+  801312:	48 98                	cltq
+}
+  801314:	48 83 c4 10          	add    $0x10,%rsp
+  801318:	5b                   	pop    %rbx
+  801319:	41 5c                	pop    %r12
+  80131b:	41 5d                	pop    %r13
+  80131d:	41 5e                	pop    %r14
+  80131f:	5d                   	pop    %rbp
+  801320:	c3                   	ret
+
+0000000000801321 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801321:	48 8b 37             	mov    (%rdi),%rsi
+  801324:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80132b:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801332:	00 00 00 
+  801335:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133a:	eb 0f                	jmp    80134b <mmap_pgfault+0x2a>
+  80133c:	c3                   	ret
+  80133d:	48 83 c1 01          	add    $0x1,%rcx
+  801341:	48 83 c2 18          	add    $0x18,%rdx
+  801345:	48 83 f9 20          	cmp    $0x20,%rcx
+  801349:	74 6e                	je     8013b9 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80134b:	48 8b 02             	mov    (%rdx),%rax
+  80134e:	48 83 e8 01          	sub    $0x1,%rax
+  801352:	48 39 f0             	cmp    %rsi,%rax
+  801355:	73 e6                	jae    80133d <mmap_pgfault+0x1c>
+  801357:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80135b:	73 e0                	jae    80133d <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80135d:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801361:	b8 00 00 00 00       	mov    $0x0,%eax
+  801366:	f6 c2 01             	test   $0x1,%dl
+  801369:	75 d1                	jne    80133c <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80136b:	f6 c2 02             	test   $0x2,%dl
+  80136e:	74 1a                	je     80138a <mmap_pgfault+0x69>
+  801370:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801374:	b8 00 00 00 00       	mov    $0x0,%eax
+  801379:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  801380:	00 00 00 
+  801383:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  801388:	74 35                	je     8013bf <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80138a:	55                   	push   %rbp
+  80138b:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80138e:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801392:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801399:	00 00 00 
+  80139c:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013a0:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013a5:	48 b8 10 12 80 00 00 	movabs $0x801210,%rax
+  8013ac:	00 00 00 
+  8013af:	ff d0                	call   *%rax
+  8013b1:	48 85 c0             	test   %rax,%rax
+  8013b4:	0f 9f c0             	setg   %al
+}
+  8013b7:	5d                   	pop    %rbp
+  8013b8:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013be:	c3                   	ret
+}
+  8013bf:	c3                   	ret
+
+00000000008013c0 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013c0:	55                   	push   %rbp
+  8013c1:	48 89 e5             	mov    %rsp,%rbp
+  8013c4:	41 54                	push   %r12
+  8013c6:	53                   	push   %rbx
+  8013c7:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013ca:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013d1:	00 00 00 
+  8013d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013d9:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013dd:	74 15                	je     8013f4 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013df:	48 83 c3 01          	add    $0x1,%rbx
+  8013e3:	48 83 c0 18          	add    $0x18,%rax
+  8013e7:	48 83 fb 20          	cmp    $0x20,%rbx
+  8013eb:	75 ec                	jne    8013d9 <mmap_alloc+0x19>
+    return NULL;
+  8013ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f2:	eb 52                	jmp    801446 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8013f4:	4c 89 e7             	mov    %r12,%rdi
+  8013f7:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  8013fe:	00 00 00 
+  801401:	ff d0                	call   *%rax
+  801403:	41 89 c1             	mov    %eax,%r9d
+  801406:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80140d:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801411:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801417:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141c:	4c 89 e6             	mov    %r12,%rsi
+  80141f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801424:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  80142b:	00 00 00 
+  80142e:	ff d0                	call   *%rax
+  801430:	85 c0                	test   %eax,%eax
+  801432:	78 17                	js     80144b <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801434:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801438:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80143f:	00 00 00 
+  801442:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801446:	5b                   	pop    %rbx
+  801447:	41 5c                	pop    %r12
+  801449:	5d                   	pop    %rbp
+  80144a:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80144b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801450:	eb f4                	jmp    801446 <mmap_alloc+0x86>
+
+0000000000801452 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  801452:	55                   	push   %rbp
+  801453:	48 89 e5             	mov    %rsp,%rbp
+  801456:	41 56                	push   %r14
+  801458:	41 55                	push   %r13
+  80145a:	41 54                	push   %r12
+  80145c:	53                   	push   %rbx
+  80145d:	48 83 ec 10          	sub    $0x10,%rsp
+  801461:	41 89 fc             	mov    %edi,%r12d
+  801464:	49 89 f5             	mov    %rsi,%r13
+  801467:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80146a:	48 89 f0             	mov    %rsi,%rax
+  80146d:	48 09 d0             	or     %rdx,%rax
+  801470:	75 0d                	jne    80147f <fsipc+0x2d>
+  801472:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801475:	83 f8 04             	cmp    $0x4,%eax
+  801478:	76 7d                	jbe    8014f7 <fsipc+0xa5>
+  80147a:	83 ff 0d             	cmp    $0xd,%edi
+  80147d:	74 78                	je     8014f7 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80147f:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  801486:	00 00 00 
+  801489:	ff d0                	call   *%rax
+  80148b:	89 c7                	mov    %eax,%edi
+  80148d:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  801494:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80149b:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014a2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014a8:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014af:	00 00 00 
+  8014b2:	44 89 e6             	mov    %r12d,%esi
+  8014b5:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  8014bc:	00 00 00 
+  8014bf:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014c1:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014c8:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014c9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ce:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014d2:	4c 89 ee             	mov    %r13,%rsi
+  8014d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014da:	48 b8 af 45 80 00 00 	movabs $0x8045af,%rax
+  8014e1:	00 00 00 
+  8014e4:	ff d0                	call   *%rax
+  8014e6:	89 c3                	mov    %eax,%ebx
+}
+  8014e8:	89 d8                	mov    %ebx,%eax
+  8014ea:	48 83 c4 10          	add    $0x10,%rsp
+  8014ee:	5b                   	pop    %rbx
+  8014ef:	41 5c                	pop    %r12
+  8014f1:	41 5d                	pop    %r13
+  8014f3:	41 5e                	pop    %r14
+  8014f5:	5d                   	pop    %rbp
+  8014f6:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014f7:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8014fe:	00 00 00 
+  801501:	ff d0                	call   *%rax
+  801503:	49 89 c6             	mov    %rax,%r14
+  801506:	48 85 c0             	test   %rax,%rax
+  801509:	0f 84 70 ff ff ff    	je     80147f <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80150f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801513:	48 b8 07 30 80 00 00 	movabs $0x803007,%rax
+  80151a:	00 00 00 
+  80151d:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80151f:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801522:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801529:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80152d:	ba 10 00 00 00       	mov    $0x10,%edx
+  801532:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801539:	00 00 00 
+  80153c:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  801543:	00 00 00 
+  801546:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801548:	4c 89 f7             	mov    %r14,%rdi
+  80154b:	48 b8 a0 0f 80 00 00 	movabs $0x800fa0,%rax
+  801552:	00 00 00 
+  801555:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801557:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80155e:	4c 89 f7             	mov    %r14,%rdi
+  801561:	48 b8 ca 30 80 00 00 	movabs $0x8030ca,%rax
+  801568:	00 00 00 
+  80156b:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80156d:	4c 89 f7             	mov    %r14,%rdi
+  801570:	48 b8 58 30 80 00 00 	movabs $0x803058,%rax
+  801577:	00 00 00 
+  80157a:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80157c:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80157f:	41 83 fc 05          	cmp    $0x5,%r12d
+  801583:	75 04                	jne    801589 <fsipc+0x137>
+  801585:	85 db                	test   %ebx,%ebx
+  801587:	79 14                	jns    80159d <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  801589:	4c 89 f7             	mov    %r14,%rdi
+  80158c:	48 b8 7f 30 80 00 00 	movabs $0x80307f,%rax
+  801593:	00 00 00 
+  801596:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  801598:	e9 4b ff ff ff       	jmp    8014e8 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80159d:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015a1:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015a6:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015ad:	00 00 00 
+  8015b0:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  8015b7:	00 00 00 
+  8015ba:	ff d0                	call   *%rax
+  8015bc:	eb cb                	jmp    801589 <fsipc+0x137>
+
+00000000008015be <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015be:	55                   	push   %rbp
+  8015bf:	48 89 e5             	mov    %rsp,%rbp
+  8015c2:	41 57                	push   %r15
+  8015c4:	41 56                	push   %r14
+  8015c6:	41 55                	push   %r13
+  8015c8:	41 54                	push   %r12
+  8015ca:	53                   	push   %rbx
+  8015cb:	48 83 ec 18          	sub    $0x18,%rsp
+  8015cf:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015d3:	49 89 f6             	mov    %rsi,%r14
+  8015d6:	49 89 d4             	mov    %rdx,%r12
+  8015d9:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015dc:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8015e3:	00 00 00 
+  8015e6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015e8:	48 85 c0             	test   %rax,%rax
+  8015eb:	0f 85 96 00 00 00    	jne    801687 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8015f1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015f8:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015f9:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801600:	00 00 00 
+    while (n) {
+  801603:	4d 85 e4             	test   %r12,%r12
+  801606:	74 79                	je     801681 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801608:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80160d:	49 39 dc             	cmp    %rbx,%r12
+  801610:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801614:	48 89 da             	mov    %rbx,%rdx
+  801617:	4c 89 f6             	mov    %r14,%rsi
+  80161a:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801621:	00 00 00 
+  801624:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  80162b:	00 00 00 
+  80162e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801630:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801634:	8b 40 0c             	mov    0xc(%rax),%eax
+  801637:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80163a:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80163d:	44 01 e8             	add    %r13d,%eax
+  801640:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801644:	41 0f 44 c5          	cmove  %r13d,%eax
+  801648:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80164c:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801650:	48 89 da             	mov    %rbx,%rdx
+  801653:	be 00 00 00 00       	mov    $0x0,%esi
+  801658:	bf 04 00 00 00       	mov    $0x4,%edi
+  80165d:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  801664:	00 00 00 
+  801667:	ff d0                	call   *%rax
+        if (res < 0)
+  801669:	85 c0                	test   %eax,%eax
+  80166b:	78 4a                	js     8016b7 <devfile_write_direct+0xf9>
+        buf += res;
+  80166d:	48 98                	cltq
+  80166f:	49 01 c6             	add    %rax,%r14
+        write += res;
+  801672:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801676:	49 29 c4             	sub    %rax,%r12
+  801679:	75 8d                	jne    801608 <devfile_write_direct+0x4a>
+    return write;
+  80167b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80167f:	eb 27                	jmp    8016a8 <devfile_write_direct+0xea>
+    size_t write = 0;
+  801681:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  801685:	eb f4                	jmp    80167b <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801687:	45 89 e9             	mov    %r13d,%r9d
+  80168a:	4d 89 e0             	mov    %r12,%r8
+  80168d:	4c 89 f1             	mov    %r14,%rcx
+  801690:	ba 04 00 00 00       	mov    $0x4,%edx
+  801695:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801699:	48 89 c7             	mov    %rax,%rdi
+  80169c:	48 b8 eb 0f 80 00 00 	movabs $0x800feb,%rax
+  8016a3:	00 00 00 
+  8016a6:	ff d0                	call   *%rax
+}
+  8016a8:	48 83 c4 18          	add    $0x18,%rsp
+  8016ac:	5b                   	pop    %rbx
+  8016ad:	41 5c                	pop    %r12
+  8016af:	41 5d                	pop    %r13
+  8016b1:	41 5e                	pop    %r14
+  8016b3:	41 5f                	pop    %r15
+  8016b5:	5d                   	pop    %rbp
+  8016b6:	c3                   	ret
+            return res;
+  8016b7:	48 98                	cltq
+  8016b9:	eb ed                	jmp    8016a8 <devfile_write_direct+0xea>
+
+00000000008016bb <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016bb:	55                   	push   %rbp
+  8016bc:	48 89 e5             	mov    %rsp,%rbp
+  8016bf:	41 54                	push   %r12
+  8016c1:	53                   	push   %rbx
+  8016c2:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016c5:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  8016cc:	00 00 00 
+  8016cf:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016d1:	48 85 c0             	test   %rax,%rax
+  8016d4:	74 71                	je     801747 <fbuf_flush+0x8c>
+  8016d6:	48 89 c3             	mov    %rax,%rbx
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016e2:	75 05                	jne    8016e9 <fbuf_flush+0x2e>
+}
+  8016e4:	5b                   	pop    %rbx
+  8016e5:	41 5c                	pop    %r12
+  8016e7:	5d                   	pop    %rbp
+  8016e8:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016e9:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8016ec:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8016f0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8016f7:	00 00 00 
+  8016fa:	48 89 de             	mov    %rbx,%rsi
+  8016fd:	48 29 c6             	sub    %rax,%rsi
+  801700:	48 c1 fe 03          	sar    $0x3,%rsi
+  801704:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80170b:	aa aa aa 
+  80170e:	48 0f af f0          	imul   %rax,%rsi
+  801712:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801716:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80171b:	48 01 c6             	add    %rax,%rsi
+  80171e:	4c 89 e7             	mov    %r12,%rdi
+  801721:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  801728:	00 00 00 
+  80172b:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80172d:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801731:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801738:	00 
+    return res < 0 ? res : 0;
+  801739:	48 85 c0             	test   %rax,%rax
+  80173c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801741:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801745:	eb 9d                	jmp    8016e4 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801747:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174c:	eb 96                	jmp    8016e4 <fbuf_flush+0x29>
+
+000000000080174e <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80174e:	55                   	push   %rbp
+  80174f:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801752:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801759:	00 00 00 
+  80175c:	ff d0                	call   *%rax
+}
+  80175e:	5d                   	pop    %rbp
+  80175f:	c3                   	ret
+
+0000000000801760 <devfile_write>:
+    if (!fd || !buf)
+  801760:	48 85 ff             	test   %rdi,%rdi
+  801763:	0f 84 d3 01 00 00    	je     80193c <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801769:	55                   	push   %rbp
+  80176a:	48 89 e5             	mov    %rsp,%rbp
+  80176d:	41 57                	push   %r15
+  80176f:	41 56                	push   %r14
+  801771:	41 55                	push   %r13
+  801773:	41 54                	push   %r12
+  801775:	53                   	push   %rbx
+  801776:	48 83 ec 08          	sub    $0x8,%rsp
+  80177a:	49 89 fc             	mov    %rdi,%r12
+  80177d:	49 89 f6             	mov    %rsi,%r14
+  801780:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  801783:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801788:	48 85 f6             	test   %rsi,%rsi
+  80178b:	0f 84 9c 01 00 00    	je     80192d <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  801791:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+  80179d:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017a0:	48 85 c0             	test   %rax,%rax
+  8017a3:	0f 84 a2 00 00 00    	je     80184b <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017a9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017ae:	4c 89 e7             	mov    %r12,%rdi
+  8017b1:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  8017b8:	00 00 00 
+  8017bb:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017bd:	83 f8 02             	cmp    $0x2,%eax
+  8017c0:	0f 8f 85 00 00 00    	jg     80184b <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017c6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017cd:	00 00 00 
+  8017d0:	4d 89 ef             	mov    %r13,%r15
+  8017d3:	49 29 c7             	sub    %rax,%r15
+  8017d6:	49 c1 ff 03          	sar    $0x3,%r15
+  8017da:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017e1:	aa aa aa 
+  8017e4:	4c 0f af f8          	imul   %rax,%r15
+  8017e8:	49 c1 e7 0e          	shl    $0xe,%r15
+  8017ec:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8017f1:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8017f4:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8017f9:	0f 84 d7 00 00 00    	je     8018d6 <devfile_write+0x176>
+  8017ff:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801803:	89 c2                	mov    %eax,%edx
+  801805:	41 03 55 0c          	add    0xc(%r13),%edx
+  801809:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80180e:	75 0f                	jne    80181f <devfile_write+0xbf>
+  801810:	48 01 d8             	add    %rbx,%rax
+  801813:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801819:	0f 86 92 00 00 00    	jbe    8018b1 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80181f:	4c 89 e7             	mov    %r12,%rdi
+  801822:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801829:	00 00 00 
+  80182c:	ff d0                	call   *%rax
+  80182e:	85 c0                	test   %eax,%eax
+  801830:	78 52                	js     801884 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801832:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801839:	77 7f                	ja     8018ba <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80183b:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801840:	0f 85 c2 00 00 00    	jne    801908 <devfile_write+0x1a8>
+  801846:	e9 94 00 00 00       	jmp    8018df <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80184b:	4c 89 e7             	mov    %r12,%rdi
+  80184e:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801855:	00 00 00 
+  801858:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80185a:	85 c0                	test   %eax,%eax
+  80185c:	79 07                	jns    801865 <devfile_write+0x105>
+  80185e:	48 98                	cltq
+  801860:	e9 c8 00 00 00       	jmp    80192d <devfile_write+0x1cd>
+  801865:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80186a:	48 89 da             	mov    %rbx,%rdx
+  80186d:	4c 89 f6             	mov    %r14,%rsi
+  801870:	4c 89 e7             	mov    %r12,%rdi
+  801873:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+  80187f:	e9 a9 00 00 00       	jmp    80192d <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801884:	48 98                	cltq
+  801886:	e9 a2 00 00 00       	jmp    80192d <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80188b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801890:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801895:	4c 89 fe             	mov    %r15,%rsi
+  801898:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189d:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  8018a4:	00 00 00 
+  8018a7:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018a9:	85 c0                	test   %eax,%eax
+  8018ab:	79 45                	jns    8018f2 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018ad:	48 98                	cltq
+  8018af:	eb 7c                	jmp    80192d <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018b1:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018b8:	76 4e                	jbe    801908 <devfile_write+0x1a8>
+  8018ba:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018bf:	48 89 da             	mov    %rbx,%rdx
+  8018c2:	4c 89 f6             	mov    %r14,%rsi
+  8018c5:	4c 89 e7             	mov    %r12,%rdi
+  8018c8:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  8018cf:	00 00 00 
+  8018d2:	ff d0                	call   *%rax
+  8018d4:	eb 57                	jmp    80192d <devfile_write+0x1cd>
+  8018d6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018dd:	77 db                	ja     8018ba <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018df:	4c 89 ff             	mov    %r15,%rdi
+  8018e2:	48 b8 89 2e 80 00 00 	movabs $0x802e89,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	84 c0                	test   %al,%al
+  8018f0:	74 99                	je     80188b <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8018f2:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8018f7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8018fc:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801900:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801907:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801908:	4c 89 ff             	mov    %r15,%rdi
+  80190b:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80190f:	48 89 da             	mov    %rbx,%rdx
+  801912:	4c 89 f6             	mov    %r14,%rsi
+  801915:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  80191c:	00 00 00 
+  80191f:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801921:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801925:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80192a:	48 89 d8             	mov    %rbx,%rax
+}
+  80192d:	48 83 c4 08          	add    $0x8,%rsp
+  801931:	5b                   	pop    %rbx
+  801932:	41 5c                	pop    %r12
+  801934:	41 5d                	pop    %r13
+  801936:	41 5e                	pop    %r14
+  801938:	41 5f                	pop    %r15
+  80193a:	5d                   	pop    %rbp
+  80193b:	c3                   	ret
+        return E_INVAL;
+  80193c:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801941:	c3                   	ret
+
+0000000000801942 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801942:	55                   	push   %rbp
+  801943:	48 89 e5             	mov    %rsp,%rbp
+  801946:	41 54                	push   %r12
+  801948:	53                   	push   %rbx
+  801949:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80194c:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801953:	00 00 00 
+  801956:	ff d0                	call   *%rax
+  801958:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80195b:	48 89 df             	mov    %rbx,%rdi
+  80195e:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  801965:	00 00 00 
+  801968:	ff d0                	call   *%rax
+  80196a:	48 85 c0             	test   %rax,%rax
+  80196d:	74 17                	je     801986 <devfile_flush+0x44>
+  80196f:	48 89 df             	mov    %rbx,%rdi
+  801972:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  801979:	00 00 00 
+  80197c:	ff d0                	call   *%rax
+  80197e:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801985:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801986:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801989:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  801990:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  801992:	ba 00 00 00 00       	mov    $0x0,%edx
+  801997:	be 00 00 00 00       	mov    $0x0,%esi
+  80199c:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019a1:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019ad:	45 85 e4             	test   %r12d,%r12d
+  8019b0:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019b4:	5b                   	pop    %rbx
+  8019b5:	41 5c                	pop    %r12
+  8019b7:	5d                   	pop    %rbp
+  8019b8:	c3                   	ret
+
+00000000008019b9 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019b9:	55                   	push   %rbp
+  8019ba:	48 89 e5             	mov    %rsp,%rbp
+  8019bd:	41 57                	push   %r15
+  8019bf:	41 56                	push   %r14
+  8019c1:	41 55                	push   %r13
+  8019c3:	41 54                	push   %r12
+  8019c5:	53                   	push   %rbx
+  8019c6:	48 83 ec 38          	sub    $0x38,%rsp
+  8019ca:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019ce:	49 89 f7             	mov    %rsi,%r15
+  8019d1:	48 89 d3             	mov    %rdx,%rbx
+  8019d4:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019d7:	48 b8 04 0f 80 00 00 	movabs $0x800f04,%rax
+  8019de:	00 00 00 
+  8019e1:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019e3:	48 85 c0             	test   %rax,%rax
+  8019e6:	75 20                	jne    801a08 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019e8:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8019ed:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8019f4:	00 
+    while (n) {
+  8019f5:	48 85 db             	test   %rbx,%rbx
+  8019f8:	0f 85 df 00 00 00    	jne    801add <devfile_read_direct+0x124>
+    size_t read = 0;
+  8019fe:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a02:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a06:	eb 21                	jmp    801a29 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a08:	45 89 f1             	mov    %r14d,%r9d
+  801a0b:	49 89 d8             	mov    %rbx,%r8
+  801a0e:	4c 89 f9             	mov    %r15,%rcx
+  801a11:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a16:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a1a:	48 89 c7             	mov    %rax,%rdi
+  801a1d:	48 b8 eb 0f 80 00 00 	movabs $0x800feb,%rax
+  801a24:	00 00 00 
+  801a27:	ff d0                	call   *%rax
+}
+  801a29:	48 83 c4 38          	add    $0x38,%rsp
+  801a2d:	5b                   	pop    %rbx
+  801a2e:	41 5c                	pop    %r12
+  801a30:	41 5d                	pop    %r13
+  801a32:	41 5e                	pop    %r14
+  801a34:	41 5f                	pop    %r15
+  801a36:	5d                   	pop    %rbp
+  801a37:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a38:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a3c:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a42:	75 1e                	jne    801a62 <devfile_read_direct+0xa9>
+  801a44:	e9 e2 00 00 00       	jmp    801b2b <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a49:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a4d:	eb da                	jmp    801a29 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a4f:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a53:	0f 85 d0 01 00 00    	jne    801c29 <devfile_read_direct+0x270>
+            map = 0;
+  801a59:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a5d:	eb 03                	jmp    801a62 <devfile_read_direct+0xa9>
+  801a5f:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a62:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a67:	48 39 d3             	cmp    %rdx,%rbx
+  801a6a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a6e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a72:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a75:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a7c:	00 00 00 
+  801a7f:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a81:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a85:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a89:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8e:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a93:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  801a9a:	00 00 00 
+  801a9d:	ff d0                	call   *%rax
+        if (res <= 0)
+  801a9f:	85 c0                	test   %eax,%eax
+  801aa1:	0f 8e 63 01 00 00    	jle    801c0a <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801aa7:	4c 63 e0             	movslq %eax,%r12
+  801aaa:	4c 89 e2             	mov    %r12,%rdx
+  801aad:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ab4:	00 00 00 
+  801ab7:	4c 89 ff             	mov    %r15,%rdi
+  801aba:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  801ac1:	00 00 00 
+  801ac4:	ff d0                	call   *%rax
+        buf += res;
+  801ac6:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ac9:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801acc:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801ad0:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801ad4:	48 85 db             	test   %rbx,%rbx
+  801ad7:	0f 84 25 ff ff ff    	je     801a02 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801add:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801ae0:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801ae4:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801ae8:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801aec:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801af3:	0f 97 c2             	seta   %dl
+  801af6:	20 c2                	and    %al,%dl
+  801af8:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801afb:	0f 84 5e ff ff ff    	je     801a5f <devfile_read_direct+0xa6>
+  801b01:	4c 89 fa             	mov    %r15,%rdx
+  801b04:	4d 89 fd             	mov    %r15,%r13
+  801b07:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b0e:	0f 85 4e ff ff ff    	jne    801a62 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b14:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b18:	0f 84 1a ff ff ff    	je     801a38 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b1e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b25:	0f 85 37 ff ff ff    	jne    801a62 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b2b:	48 89 d8             	mov    %rbx,%rax
+  801b2e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b34:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b39:	48 39 c8             	cmp    %rcx,%rax
+  801b3c:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b40:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b44:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b48:	49 89 d4             	mov    %rdx,%r12
+  801b4b:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b4f:	48 b8 2a 2e 80 00 00 	movabs $0x802e2a,%rax
+  801b56:	00 00 00 
+  801b59:	ff d0                	call   *%rax
+  801b5b:	a8 40                	test   $0x40,%al
+  801b5d:	0f 85 b9 00 00 00    	jne    801c1c <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b63:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b6a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b6e:	49 39 c5             	cmp    %rax,%r13
+  801b71:	72 d8                	jb     801b4b <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b73:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b77:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b7e:	00 00 00 
+  801b81:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b85:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b88:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b8a:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801b8e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801b92:	48 b8 9f 0d 80 00 00 	movabs $0x800d9f,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+  801b9e:	89 c7                	mov    %eax,%edi
+  801ba0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ba6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bab:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bb2:	00 00 00 
+  801bb5:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bba:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  801bc1:	00 00 00 
+  801bc4:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bcb:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bcf:	4c 89 fe             	mov    %r15,%rsi
+  801bd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd7:	48 b8 af 45 80 00 00 	movabs $0x8045af,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801be6:	48 85 d2             	test   %rdx,%rdx
+  801be9:	0f 84 5a fe ff ff    	je     801a49 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801bef:	0f 8e 5a fe ff ff    	jle    801a4f <devfile_read_direct+0x96>
+                buf += res;
+  801bf5:	48 98                	cltq
+  801bf7:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801bfa:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801bfd:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c01:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c05:	e9 ca fe ff ff       	jmp    801ad4 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c0a:	41 89 c5             	mov    %eax,%r13d
+  801c0d:	48 98                	cltq
+  801c0f:	45 85 ed             	test   %r13d,%r13d
+  801c12:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c17:	e9 0d fe ff ff       	jmp    801a29 <devfile_read_direct+0x70>
+            map = 0;
+  801c1c:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c20:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c24:	e9 39 fe ff ff       	jmp    801a62 <devfile_read_direct+0xa9>
+  801c29:	48 89 d0             	mov    %rdx,%rax
+  801c2c:	e9 f8 fd ff ff       	jmp    801a29 <devfile_read_direct+0x70>
+
+0000000000801c31 <devfile_read>:
+    if (!fd || !buf)
+  801c31:	48 85 ff             	test   %rdi,%rdi
+  801c34:	0f 84 21 02 00 00    	je     801e5b <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c3a:	55                   	push   %rbp
+  801c3b:	48 89 e5             	mov    %rsp,%rbp
+  801c3e:	41 57                	push   %r15
+  801c40:	41 56                	push   %r14
+  801c42:	41 55                	push   %r13
+  801c44:	41 54                	push   %r12
+  801c46:	53                   	push   %rbx
+  801c47:	48 83 ec 28          	sub    $0x28,%rsp
+  801c4b:	48 89 fb             	mov    %rdi,%rbx
+  801c4e:	49 89 f4             	mov    %rsi,%r12
+  801c51:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c54:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c59:	48 85 f6             	test   %rsi,%rsi
+  801c5c:	74 4b                	je     801ca9 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c5e:	48 b8 6e 0f 80 00 00 	movabs $0x800f6e,%rax
+  801c65:	00 00 00 
+  801c68:	ff d0                	call   *%rax
+  801c6a:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c6d:	48 85 c0             	test   %rax,%rax
+  801c70:	74 22                	je     801c94 <devfile_read+0x63>
+  801c72:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c79:	77 19                	ja     801c94 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c7b:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c80:	48 89 df             	mov    %rbx,%rdi
+  801c83:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c8f:	83 f8 02             	cmp    $0x2,%eax
+  801c92:	7e 40                	jle    801cd4 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801c94:	48 89 df             	mov    %rbx,%rdi
+  801c97:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801c9e:	00 00 00 
+  801ca1:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801ca3:	85 c0                	test   %eax,%eax
+  801ca5:	79 11                	jns    801cb8 <devfile_read+0x87>
+  801ca7:	48 98                	cltq
+}
+  801ca9:	48 83 c4 28          	add    $0x28,%rsp
+  801cad:	5b                   	pop    %rbx
+  801cae:	41 5c                	pop    %r12
+  801cb0:	41 5d                	pop    %r13
+  801cb2:	41 5e                	pop    %r14
+  801cb4:	41 5f                	pop    %r15
+  801cb6:	5d                   	pop    %rbp
+  801cb7:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cb8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cbd:	4c 89 ea             	mov    %r13,%rdx
+  801cc0:	4c 89 e6             	mov    %r12,%rsi
+  801cc3:	48 89 df             	mov    %rbx,%rdi
+  801cc6:	48 b8 b9 19 80 00 00 	movabs $0x8019b9,%rax
+  801ccd:	00 00 00 
+  801cd0:	ff d0                	call   *%rax
+  801cd2:	eb d5                	jmp    801ca9 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cd4:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cd8:	48 89 df             	mov    %rbx,%rdi
+  801cdb:	48 b8 bb 16 80 00 00 	movabs $0x8016bb,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	0f 88 33 01 00 00    	js     801e22 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801cef:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801cf6:	00 00 00 
+  801cf9:	4c 89 f0             	mov    %r14,%rax
+  801cfc:	48 29 d0             	sub    %rdx,%rax
+  801cff:	48 c1 f8 03          	sar    $0x3,%rax
+  801d03:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d0a:	aa aa aa 
+  801d0d:	48 0f af c2          	imul   %rdx,%rax
+  801d11:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d19:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d1c:	41 39 06             	cmp    %eax,(%r14)
+  801d1f:	75 0d                	jne    801d2e <devfile_read+0xfd>
+  801d21:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d24:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d28:	0f 84 fb 00 00 00    	je     801e29 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d2e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d33:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d37:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d3e:	48 89 c7             	mov    %rax,%rdi
+  801d41:	48 b8 89 2e 80 00 00 	movabs $0x802e89,%rax
+  801d48:	00 00 00 
+  801d4b:	ff d0                	call   *%rax
+  801d4d:	84 c0                	test   %al,%al
+  801d4f:	75 27                	jne    801d78 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d51:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d56:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d5b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d5f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d64:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  801d6b:	00 00 00 
+  801d6e:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d70:	85 c0                	test   %eax,%eax
+  801d72:	0f 88 dc 00 00 00    	js     801e54 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d78:	44 89 f8             	mov    %r15d,%eax
+  801d7b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d80:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d82:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d89:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d8a:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d8d:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801d91:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801d94:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d99:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d9d:	48 89 df             	mov    %rbx,%rdi
+  801da0:	48 b8 b9 19 80 00 00 	movabs $0x8019b9,%rax
+  801da7:	00 00 00 
+  801daa:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801dac:	48 85 c0             	test   %rax,%rax
+  801daf:	0f 88 f4 fe ff ff    	js     801ca9 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801db5:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801db8:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dbb:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dbe:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dc2:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dc6:	48 63 d1             	movslq %ecx,%rdx
+  801dc9:	48 01 d0             	add    %rdx,%rax
+  801dcc:	4d 63 ff             	movslq %r15d,%r15
+  801dcf:	4c 29 f8             	sub    %r15,%rax
+  801dd2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd7:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801ddb:	48 85 c0             	test   %rax,%rax
+  801dde:	0f 8e c5 fe ff ff    	jle    801ca9 <devfile_read+0x78>
+    n = MIN(n, res);
+  801de4:	4c 39 e8             	cmp    %r13,%rax
+  801de7:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801deb:	8b 73 04             	mov    0x4(%rbx),%esi
+  801dee:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801df2:	48 63 f6             	movslq %esi,%rsi
+  801df5:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801dfa:	48 01 c6             	add    %rax,%rsi
+  801dfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e01:	48 01 c6             	add    %rax,%rsi
+  801e04:	4c 89 ea             	mov    %r13,%rdx
+  801e07:	4c 89 e7             	mov    %r12,%rdi
+  801e0a:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e16:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e1a:	4c 89 e8             	mov    %r13,%rax
+  801e1d:	e9 87 fe ff ff       	jmp    801ca9 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e22:	48 98                	cltq
+  801e24:	e9 80 fe ff ff       	jmp    801ca9 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e29:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e2d:	41 39 d7             	cmp    %edx,%r15d
+  801e30:	0f 8c f8 fe ff ff    	jl     801d2e <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e36:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e3a:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e3d:	41 39 cf             	cmp    %ecx,%r15d
+  801e40:	0f 8d e8 fe ff ff    	jge    801d2e <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e46:	4d 63 ff             	movslq %r15d,%r15
+  801e49:	4c 29 f8             	sub    %r15,%rax
+  801e4c:	48 63 d2             	movslq %edx,%rdx
+  801e4f:	48 01 d0             	add    %rdx,%rax
+  801e52:	eb 87                	jmp    801ddb <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e54:	48 98                	cltq
+  801e56:	e9 4e fe ff ff       	jmp    801ca9 <devfile_read+0x78>
+        return E_INVAL;
+  801e5b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e60:	c3                   	ret
+
+0000000000801e61 <fs_channel>:
+fs_channel(bool enable) {
+  801e61:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e63:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e6a:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e71:	40 84 ff             	test   %dil,%dil
+  801e74:	74 47                	je     801ebd <fs_channel+0x5c>
+  801e76:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e7d:	00 00 00 
+  801e80:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e86:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e8d:	00 00 00 
+  801e90:	3b 08                	cmp    (%rax),%ecx
+  801e92:	74 29                	je     801ebd <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801e94:	55                   	push   %rbp
+  801e95:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801e98:	48 b8 e1 0d 80 00 00 	movabs $0x800de1,%rax
+  801e9f:	00 00 00 
+  801ea2:	ff d0                	call   *%rax
+  801ea4:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ea6:	85 c0                	test   %eax,%eax
+  801ea8:	78 04                	js     801eae <fs_channel+0x4d>
+}
+  801eaa:	89 d0                	mov    %edx,%eax
+  801eac:	5d                   	pop    %rbp
+  801ead:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801eae:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eb5:	00 00 00 
+  801eb8:	c6 00 00             	movb   $0x0,(%rax)
+  801ebb:	eb ed                	jmp    801eaa <fs_channel+0x49>
+}
+  801ebd:	89 d0                	mov    %edx,%eax
+  801ebf:	c3                   	ret
+
+0000000000801ec0 <open>:
+open(const char *path, int mode) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	41 55                	push   %r13
+  801ec6:	41 54                	push   %r12
+  801ec8:	53                   	push   %rbx
+  801ec9:	48 83 ec 18          	sub    $0x18,%rsp
+  801ecd:	49 89 fc             	mov    %rdi,%r12
+  801ed0:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ed3:	48 b8 8f 3d 80 00 00 	movabs $0x803d8f,%rax
+  801eda:	00 00 00 
+  801edd:	ff d0                	call   *%rax
+  801edf:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801ee5:	0f 87 8f 00 00 00    	ja     801f7a <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801eeb:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801eef:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  801ef6:	00 00 00 
+  801ef9:	ff d0                	call   *%rax
+  801efb:	89 c3                	mov    %eax,%ebx
+  801efd:	85 c0                	test   %eax,%eax
+  801eff:	78 55                	js     801f56 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f01:	4c 89 e6             	mov    %r12,%rsi
+  801f04:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f0b:	00 00 00 
+  801f0e:	48 89 df             	mov    %rbx,%rdi
+  801f11:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  801f18:	00 00 00 
+  801f1b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f1d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f24:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f29:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f2d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f32:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  801f39:	00 00 00 
+  801f3c:	ff d0                	call   *%rax
+  801f3e:	89 c3                	mov    %eax,%ebx
+  801f40:	85 c0                	test   %eax,%eax
+  801f42:	78 1f                	js     801f63 <open+0xa3>
+    return fd2num(fd);
+  801f44:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f48:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  801f4f:	00 00 00 
+  801f52:	ff d0                	call   *%rax
+  801f54:	89 c3                	mov    %eax,%ebx
+}
+  801f56:	89 d8                	mov    %ebx,%eax
+  801f58:	48 83 c4 18          	add    $0x18,%rsp
+  801f5c:	5b                   	pop    %rbx
+  801f5d:	41 5c                	pop    %r12
+  801f5f:	41 5d                	pop    %r13
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+        fd_close(fd, 0);
+  801f63:	be 00 00 00 00       	mov    $0x0,%esi
+  801f68:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f6c:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+        return res;
+  801f78:	eb dc                	jmp    801f56 <open+0x96>
+        return -E_BAD_PATH;
+  801f7a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f7f:	eb d5                	jmp    801f56 <open+0x96>
+
+0000000000801f81 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f81:	55                   	push   %rbp
+  801f82:	48 89 e5             	mov    %rsp,%rbp
+  801f85:	41 56                	push   %r14
+  801f87:	41 55                	push   %r13
+  801f89:	41 54                	push   %r12
+  801f8b:	53                   	push   %rbx
+  801f8c:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801f90:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801f97:	00 00 00 
+  801f9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801f9f:	49 bd fb 06 80 00 00 	movabs $0x8006fb,%r13
+  801fa6:	00 00 00 
+  801fa9:	49 be bb 16 80 00 00 	movabs $0x8016bb,%r14
+  801fb0:	00 00 00 
+  801fb3:	eb 0c                	jmp    801fc1 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fb5:	83 c3 01             	add    $0x1,%ebx
+  801fb8:	49 83 c4 18          	add    $0x18,%r12
+  801fbc:	83 fb 20             	cmp    $0x20,%ebx
+  801fbf:	74 1d                	je     801fde <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fc1:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fc6:	74 ed                	je     801fb5 <file_flush_buffers+0x34>
+  801fc8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fcc:	89 df                	mov    %ebx,%edi
+  801fce:	41 ff d5             	call   *%r13
+  801fd1:	85 c0                	test   %eax,%eax
+  801fd3:	78 e0                	js     801fb5 <file_flush_buffers+0x34>
+  801fd5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fd9:	41 ff d6             	call   *%r14
+  801fdc:	eb d7                	jmp    801fb5 <file_flush_buffers+0x34>
+}
+  801fde:	48 83 c4 10          	add    $0x10,%rsp
+  801fe2:	5b                   	pop    %rbx
+  801fe3:	41 5c                	pop    %r12
+  801fe5:	41 5d                	pop    %r13
+  801fe7:	41 5e                	pop    %r14
+  801fe9:	5d                   	pop    %rbp
+  801fea:	c3                   	ret
+
+0000000000801feb <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801feb:	55                   	push   %rbp
+  801fec:	48 89 e5             	mov    %rsp,%rbp
+  801fef:	41 54                	push   %r12
+  801ff1:	53                   	push   %rbx
+  801ff2:	49 89 fc             	mov    %rdi,%r12
+  801ff5:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  801ff7:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  801ffe:	00 00 00 
+  802001:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802003:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80200a:	00 00 00 
+  80200d:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802012:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802014:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802017:	ba 00 00 00 00       	mov    $0x0,%edx
+  80201c:	be 00 00 00 00       	mov    $0x0,%esi
+  802021:	bf 02 00 00 00       	mov    $0x2,%edi
+  802026:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  80202d:	00 00 00 
+  802030:	ff d0                	call   *%rax
+}
+  802032:	5b                   	pop    %rbx
+  802033:	41 5c                	pop    %r12
+  802035:	5d                   	pop    %rbp
+  802036:	c3                   	ret
+
+0000000000802037 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802037:	55                   	push   %rbp
+  802038:	48 89 e5             	mov    %rsp,%rbp
+  80203b:	41 54                	push   %r12
+  80203d:	53                   	push   %rbx
+  80203e:	49 89 fc             	mov    %rdi,%r12
+  802041:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802044:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802050:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802055:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80205c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80205e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802063:	be 00 00 00 00       	mov    $0x0,%esi
+  802068:	bf 05 00 00 00       	mov    $0x5,%edi
+  80206d:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  802074:	00 00 00 
+  802077:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802079:	85 c0                	test   %eax,%eax
+  80207b:	78 3d                	js     8020ba <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80207d:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802084:	00 00 00 
+  802087:	4c 89 e6             	mov    %r12,%rsi
+  80208a:	48 89 df             	mov    %rbx,%rdi
+  80208d:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  802094:	00 00 00 
+  802097:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802099:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020a0:	00 
+  8020a1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020a7:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020ae:	00 
+  8020af:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020b5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ba:	5b                   	pop    %rbx
+  8020bb:	41 5c                	pop    %r12
+  8020bd:	5d                   	pop    %rbp
+  8020be:	c3                   	ret
+
+00000000008020bf <remove>:
+remove(const char *path) {
+  8020bf:	55                   	push   %rbp
+  8020c0:	48 89 e5             	mov    %rsp,%rbp
+  8020c3:	53                   	push   %rbx
+  8020c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c8:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020cb:	48 b8 8f 3d 80 00 00 	movabs $0x803d8f,%rax
+  8020d2:	00 00 00 
+  8020d5:	ff d0                	call   *%rax
+  8020d7:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020dd:	77 3a                	ja     802119 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020df:	48 89 de             	mov    %rbx,%rsi
+  8020e2:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020e9:	00 00 00 
+  8020ec:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  8020f3:	00 00 00 
+  8020f6:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8020f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020fd:	be 00 00 00 00       	mov    $0x0,%esi
+  802102:	bf 07 00 00 00       	mov    $0x7,%edi
+  802107:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+}
+  802113:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802117:	c9                   	leave
+  802118:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802119:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80211e:	eb f3                	jmp    802113 <remove+0x54>
+
+0000000000802120 <sync>:
+sync(void) {
+  802120:	55                   	push   %rbp
+  802121:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802124:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802130:	ba 00 00 00 00       	mov    $0x0,%edx
+  802135:	be 00 00 00 00       	mov    $0x0,%esi
+  80213a:	bf 08 00 00 00       	mov    $0x8,%edi
+  80213f:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  802146:	00 00 00 
+  802149:	ff d0                	call   *%rax
+}
+  80214b:	5d                   	pop    %rbp
+  80214c:	c3                   	ret
+
+000000000080214d <fsync>:
+fsync(int fdnum) {
+  80214d:	55                   	push   %rbp
+  80214e:	48 89 e5             	mov    %rsp,%rbp
+  802151:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802155:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802159:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  802160:	00 00 00 
+  802163:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802165:	85 c0                	test   %eax,%eax
+  802167:	78 4b                	js     8021b4 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802169:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80216d:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802174:	00 00 00 
+  802177:	8b 00                	mov    (%rax),%eax
+  802179:	39 02                	cmp    %eax,(%rdx)
+  80217b:	75 39                	jne    8021b6 <fsync+0x69>
+    file_flush_buffers();
+  80217d:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802189:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80218d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802190:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802197:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802199:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219e:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a3:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021a8:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  8021af:	00 00 00 
+  8021b2:	ff d0                	call   *%rax
+}
+  8021b4:	c9                   	leave
+  8021b5:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021bb:	eb f7                	jmp    8021b4 <fsync+0x67>
+
+00000000008021bd <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	53                   	push   %rbx
+  8021c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c6:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ce:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d3:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021d8:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021e4:	85 c0                	test   %eax,%eax
+  8021e6:	78 2d                	js     802215 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021e8:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8021ef:	00 00 00 
+  8021f2:	48 8b 10             	mov    (%rax),%rdx
+  8021f5:	48 89 13             	mov    %rdx,(%rbx)
+  8021f8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8021fc:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802200:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802204:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802208:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80220c:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802210:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802215:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802219:	c9                   	leave
+  80221a:	c3                   	ret
+
+000000000080221b <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80221b:	55                   	push   %rbp
+  80221c:	48 89 e5             	mov    %rsp,%rbp
+  80221f:	53                   	push   %rbx
+  802220:	48 83 ec 08          	sub    $0x8,%rsp
+  802224:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80222c:	be 00 00 00 00       	mov    $0x0,%esi
+  802231:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802236:	48 b8 52 14 80 00 00 	movabs $0x801452,%rax
+  80223d:	00 00 00 
+  802240:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802242:	85 c0                	test   %eax,%eax
+  802244:	78 3d                	js     802283 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802246:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80224d:	00 00 00 
+  802250:	48 8b 10             	mov    (%rax),%rdx
+  802253:	48 89 13             	mov    %rdx,(%rbx)
+  802256:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80225a:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80225e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802262:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802266:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80226a:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80226e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802272:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802276:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80227a:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80227e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802283:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802287:	c9                   	leave
+  802288:	c3                   	ret
+
+0000000000802289 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  802289:	55                   	push   %rbp
+  80228a:	48 89 e5             	mov    %rsp,%rbp
+  80228d:	41 57                	push   %r15
+  80228f:	41 56                	push   %r14
+  802291:	41 55                	push   %r13
+  802293:	41 54                	push   %r12
+  802295:	53                   	push   %rbx
+  802296:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80229a:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022a1:	00 
+  8022a2:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022a9:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022af:	0f 85 43 01 00 00    	jne    8023f8 <munmap+0x16f>
+  8022b5:	49 89 ff             	mov    %rdi,%r15
+  8022b8:	4c 39 f7             	cmp    %r14,%rdi
+  8022bb:	0f 87 37 01 00 00    	ja     8023f8 <munmap+0x16f>
+  8022c1:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022c8:	00 00 00 
+  8022cb:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022d1:	eb 2c                	jmp    8022ff <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022d3:	4c 39 f8             	cmp    %r15,%rax
+  8022d6:	0f 83 85 00 00 00    	jae    802361 <munmap+0xd8>
+            m->mm_end = start;
+  8022dc:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022e1:	48 83 c3 18          	add    $0x18,%rbx
+  8022e5:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8022ec:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8022f3:	00 00 00 
+  8022f6:	48 39 c3             	cmp    %rax,%rbx
+  8022f9:	0f 84 d0 00 00 00    	je     8023cf <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8022ff:	49 89 dc             	mov    %rbx,%r12
+  802302:	48 8b 03             	mov    (%rbx),%rax
+  802305:	4c 39 f0             	cmp    %r14,%rax
+  802308:	73 d7                	jae    8022e1 <munmap+0x58>
+  80230a:	48 85 c0             	test   %rax,%rax
+  80230d:	74 d2                	je     8022e1 <munmap+0x58>
+  80230f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802313:	49 39 d7             	cmp    %rdx,%r15
+  802316:	73 c9                	jae    8022e1 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802318:	49 39 d6             	cmp    %rdx,%r14
+  80231b:	73 b6                	jae    8022d3 <munmap+0x4a>
+  80231d:	49 39 c7             	cmp    %rax,%r15
+  802320:	76 b1                	jbe    8022d3 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802322:	4c 89 ef             	mov    %r13,%rdi
+  802325:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  802331:	48 85 c0             	test   %rax,%rax
+  802334:	0f 84 c5 00 00 00    	je     8023ff <munmap+0x176>
+            *tail = *m;
+  80233a:	48 8b 13             	mov    (%rbx),%rdx
+  80233d:	48 89 10             	mov    %rdx,(%rax)
+  802340:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802344:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802348:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80234c:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  802350:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802353:	44 89 f2             	mov    %r14d,%edx
+  802356:	2b 13                	sub    (%rbx),%edx
+  802358:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80235b:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80235f:	eb 80                	jmp    8022e1 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  802361:	49 39 d6             	cmp    %rdx,%r14
+  802364:	73 18                	jae    80237e <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802366:	44 89 f2             	mov    %r14d,%edx
+  802369:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80236e:	29 c2                	sub    %eax,%edx
+  802370:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  802375:	4d 89 34 24          	mov    %r14,(%r12)
+  802379:	e9 63 ff ff ff       	jmp    8022e1 <munmap+0x58>
+    m->mm_start = 0;
+  80237e:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  802385:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  802386:	4c 89 e6             	mov    %r12,%rsi
+  802389:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802390:	00 00 00 
+  802393:	48 29 c6             	sub    %rax,%rsi
+  802396:	48 c1 fe 03          	sar    $0x3,%rsi
+  80239a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023a1:	aa aa aa 
+  8023a4:	48 0f af f0          	imul   %rax,%rsi
+  8023a8:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023ac:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023b1:	48 01 c6             	add    %rax,%rsi
+  8023b4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023b9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023be:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+}
+  8023ca:	e9 12 ff ff ff       	jmp    8022e1 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023cf:	4c 89 f2             	mov    %r14,%rdx
+  8023d2:	4c 29 fa             	sub    %r15,%rdx
+  8023d5:	4c 89 fe             	mov    %r15,%rsi
+  8023d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023dd:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+}
+  8023e9:	48 83 c4 08          	add    $0x8,%rsp
+  8023ed:	5b                   	pop    %rbx
+  8023ee:	41 5c                	pop    %r12
+  8023f0:	41 5d                	pop    %r13
+  8023f2:	41 5e                	pop    %r14
+  8023f4:	41 5f                	pop    %r15
+  8023f6:	5d                   	pop    %rbp
+  8023f7:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8023f8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023fd:	eb ea                	jmp    8023e9 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8023ff:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802404:	eb e3                	jmp    8023e9 <munmap+0x160>
+
+0000000000802406 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802406:	55                   	push   %rbp
+  802407:	48 89 e5             	mov    %rsp,%rbp
+  80240a:	41 57                	push   %r15
+  80240c:	41 56                	push   %r14
+  80240e:	41 55                	push   %r13
+  802410:	41 54                	push   %r12
+  802412:	53                   	push   %rbx
+  802413:	48 83 ec 28          	sub    $0x28,%rsp
+  802417:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80241b:	49 89 f5             	mov    %rsi,%r13
+  80241e:	41 89 d6             	mov    %edx,%r14d
+  802421:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802424:	41 89 cc             	mov    %ecx,%r12d
+  802427:	44 89 c7             	mov    %r8d,%edi
+  80242a:	44 89 cb             	mov    %r9d,%ebx
+  80242d:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802431:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802435:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	41 89 c7             	mov    %eax,%r15d
+  802444:	85 c0                	test   %eax,%eax
+  802446:	0f 88 ae 01 00 00    	js     8025fa <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80244c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802450:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802457:	00 00 00 
+  80245a:	8b 32                	mov    (%rdx),%esi
+  80245c:	39 30                	cmp    %esi,(%rax)
+  80245e:	0f 85 7a 02 00 00    	jne    8026de <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802464:	8b 40 08             	mov    0x8(%rax),%eax
+  802467:	83 e0 03             	and    $0x3,%eax
+  80246a:	83 f8 01             	cmp    $0x1,%eax
+  80246d:	0f 84 76 02 00 00    	je     8026e9 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802473:	4d 85 ed             	test   %r13,%r13
+  802476:	0f 84 78 02 00 00    	je     8026f4 <mmap+0x2ee>
+  80247c:	85 db                	test   %ebx,%ebx
+  80247e:	0f 88 70 02 00 00    	js     8026f4 <mmap+0x2ee>
+  802484:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80248a:	41 89 df             	mov    %ebx,%r15d
+  80248d:	0f 85 6c 02 00 00    	jne    8026ff <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802493:	44 89 f0             	mov    %r14d,%eax
+  802496:	83 e0 fd             	and    $0xfffffffd,%eax
+  802499:	83 f8 04             	cmp    $0x4,%eax
+  80249c:	0f 85 68 02 00 00    	jne    80270a <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024a2:	44 89 e1             	mov    %r12d,%ecx
+  8024a5:	83 e1 01             	and    $0x1,%ecx
+  8024a8:	0f 95 c2             	setne  %dl
+  8024ab:	44 89 e0             	mov    %r12d,%eax
+  8024ae:	d1 e8                	shr    %eax
+  8024b0:	83 f0 01             	xor    $0x1,%eax
+  8024b3:	83 e0 01             	and    $0x1,%eax
+  8024b6:	38 c2                	cmp    %al,%dl
+  8024b8:	0f 85 57 02 00 00    	jne    802715 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024be:	85 c9                	test   %ecx,%ecx
+  8024c0:	74 0a                	je     8024cc <mmap+0xc6>
+  8024c2:	41 f6 c6 02          	test   $0x2,%r14b
+  8024c6:	0f 85 54 02 00 00    	jne    802720 <mmap+0x31a>
+    file_flush_buffers();
+  8024cc:	48 b8 81 1f 80 00 00 	movabs $0x801f81,%rax
+  8024d3:	00 00 00 
+  8024d6:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024d8:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024df:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024e6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024ea:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8024ed:	41 f6 c4 04          	test   $0x4,%r12b
+  8024f1:	0f 84 15 01 00 00    	je     80260c <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8024f7:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8024fa:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802500:	0f 85 25 02 00 00    	jne    80272b <mmap+0x325>
+  802506:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80250a:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802511:	00 00 00 
+  802514:	48 39 c2             	cmp    %rax,%rdx
+  802517:	0f 82 19 02 00 00    	jb     802736 <mmap+0x330>
+  80251d:	48 39 c7             	cmp    %rax,%rdi
+  802520:	0f 87 10 02 00 00    	ja     802736 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802526:	4c 89 ee             	mov    %r13,%rsi
+  802529:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	85 c0                	test   %eax,%eax
+  802537:	0f 88 04 02 00 00    	js     802741 <mmap+0x33b>
+    if (!handler) {
+  80253d:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802544:	00 00 00 
+  802547:	80 38 00             	cmpb   $0x0,(%rax)
+  80254a:	75 2b                	jne    802577 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80254c:	48 bf 21 13 80 00 00 	movabs $0x801321,%rdi
+  802553:	00 00 00 
+  802556:	48 b8 7e 42 80 00 00 	movabs $0x80427e,%rax
+  80255d:	00 00 00 
+  802560:	ff d0                	call   *%rax
+  802562:	85 c0                	test   %eax,%eax
+  802564:	0f 88 ea 01 00 00    	js     802754 <mmap+0x34e>
+        handler = 1;
+  80256a:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802571:	00 00 00 
+  802574:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802577:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80257b:	48 b8 c0 13 80 00 00 	movabs $0x8013c0,%rax
+  802582:	00 00 00 
+  802585:	ff d0                	call   *%rax
+  802587:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80258a:	48 85 c0             	test   %rax,%rax
+  80258d:	0f 84 c9 01 00 00    	je     80275c <mmap+0x356>
+    m->mm_start = va;
+  802593:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  802596:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80259a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80259e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025a1:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025a5:	44 89 e0             	mov    %r12d,%eax
+  8025a8:	c1 e0 06             	shl    $0x6,%eax
+  8025ab:	25 80 00 00 00       	and    $0x80,%eax
+  8025b0:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025b3:	09 f0                	or     %esi,%eax
+  8025b5:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025b9:	41 f6 c4 08          	test   $0x8,%r12b
+  8025bd:	74 31                	je     8025f0 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025bf:	48 39 d3             	cmp    %rdx,%rbx
+  8025c2:	73 2c                	jae    8025f0 <mmap+0x1ea>
+  8025c4:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025c9:	48 89 de             	mov    %rbx,%rsi
+  8025cc:	4c 89 f7             	mov    %r14,%rdi
+  8025cf:	48 b8 10 12 80 00 00 	movabs $0x801210,%rax
+  8025d6:	00 00 00 
+  8025d9:	ff d0                	call   *%rax
+  8025db:	49 89 c4             	mov    %rax,%r12
+  8025de:	48 85 c0             	test   %rax,%rax
+  8025e1:	0f 8e d7 00 00 00    	jle    8026be <mmap+0x2b8>
+            va += n;
+  8025e7:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025ea:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8025ee:	72 d4                	jb     8025c4 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8025f0:	49 8b 06             	mov    (%r14),%rax
+  8025f3:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8025f7:	48 89 06             	mov    %rax,(%rsi)
+}
+  8025fa:	44 89 f8             	mov    %r15d,%eax
+  8025fd:	48 83 c4 28          	add    $0x28,%rsp
+  802601:	5b                   	pop    %rbx
+  802602:	41 5c                	pop    %r12
+  802604:	41 5d                	pop    %r13
+  802606:	41 5e                	pop    %r14
+  802608:	41 5f                	pop    %r15
+  80260a:	5d                   	pop    %rbp
+  80260b:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80260c:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802613:	00 00 00 
+  802616:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802619:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802620:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802623:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802628:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80262f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802632:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802639:	00 00 00 
+  80263c:	48 39 d7             	cmp    %rdx,%rdi
+  80263f:	73 1c                	jae    80265d <mmap+0x257>
+        return -E_NO_MEM;
+  802641:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802647:	eb b1                	jmp    8025fa <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802649:	48 83 c0 01          	add    $0x1,%rax
+  80264d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802651:	77 3f                	ja     802692 <mmap+0x28c>
+  802653:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802658:	48 39 d7             	cmp    %rdx,%rdi
+  80265b:	72 2a                	jb     802687 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80265d:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  802661:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802665:	48 39 d1             	cmp    %rdx,%rcx
+  802668:	73 df                	jae    802649 <mmap+0x243>
+  80266a:	48 85 c9             	test   %rcx,%rcx
+  80266d:	74 da                	je     802649 <mmap+0x243>
+  80266f:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802673:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802678:	48 39 d3             	cmp    %rdx,%rbx
+  80267b:	73 cc                	jae    802649 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80267d:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802680:	b8 00 00 00 00       	mov    $0x0,%eax
+  802685:	eb cc                	jmp    802653 <mmap+0x24d>
+        return -E_NO_MEM;
+  802687:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80268d:	e9 68 ff ff ff       	jmp    8025fa <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  802692:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  802697:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80269e:	00 00 00 
+  8026a1:	48 39 c2             	cmp    %rax,%rdx
+  8026a4:	0f 82 9f 00 00 00    	jb     802749 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026aa:	48 85 db             	test   %rbx,%rbx
+  8026ad:	0f 85 8a fe ff ff    	jne    80253d <mmap+0x137>
+        return -E_NO_MEM;
+  8026b3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026b9:	e9 3c ff ff ff       	jmp    8025fa <mmap+0x1f4>
+        if (n < 0) {
+  8026be:	0f 89 2c ff ff ff    	jns    8025f0 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026c4:	49 8b 3e             	mov    (%r14),%rdi
+  8026c7:	4c 89 ee             	mov    %r13,%rsi
+  8026ca:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+            return n;
+  8026d6:	45 89 e7             	mov    %r12d,%r15d
+  8026d9:	e9 1c ff ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026de:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026e4:	e9 11 ff ff ff       	jmp    8025fa <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026e9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026ef:	e9 06 ff ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8026f4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026fa:	e9 fb fe ff ff       	jmp    8025fa <mmap+0x1f4>
+  8026ff:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802705:	e9 f0 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80270a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802710:	e9 e5 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802715:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80271b:	e9 da fe ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802720:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802726:	e9 cf fe ff ff       	jmp    8025fa <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80272b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802731:	e9 c4 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+  802736:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80273c:	e9 b9 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802741:	41 89 c7             	mov    %eax,%r15d
+  802744:	e9 b1 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+        return -E_NO_MEM;
+  802749:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80274f:	e9 a6 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802754:	41 89 c7             	mov    %eax,%r15d
+  802757:	e9 9e fe ff ff       	jmp    8025fa <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80275c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802762:	e9 93 fe ff ff       	jmp    8025fa <mmap+0x1f4>
+
+0000000000802767 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	41 54                	push   %r12
+  80276d:	53                   	push   %rbx
+  80276e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802771:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+  80277d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802780:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  802787:	00 00 00 
+  80278a:	48 89 df             	mov    %rbx,%rdi
+  80278d:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  802794:	00 00 00 
+  802797:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802799:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80279e:	41 2b 04 24          	sub    (%r12),%eax
+  8027a2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027a8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027af:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027b2:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027b9:	00 00 00 
+  8027bc:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c8:	5b                   	pop    %rbx
+  8027c9:	41 5c                	pop    %r12
+  8027cb:	5d                   	pop    %rbp
+  8027cc:	c3                   	ret
+
+00000000008027cd <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027cd:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027d0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027d6:	8b 17                	mov    (%rdi),%edx
+  8027d8:	85 d2                	test   %edx,%edx
+  8027da:	75 01                	jne    8027dd <pipe_wakeup+0x10>
+  8027dc:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027dd:	55                   	push   %rbp
+  8027de:	48 89 e5             	mov    %rsp,%rbp
+  8027e1:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027e4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027ea:	be 00 04 00 00       	mov    $0x400,%esi
+  8027ef:	48 b8 c6 05 80 00 00 	movabs $0x8005c6,%rax
+  8027f6:	00 00 00 
+  8027f9:	ff d0                	call   *%rax
+}
+  8027fb:	5d                   	pop    %rbp
+  8027fc:	c3                   	ret
+
+00000000008027fd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8027fd:	55                   	push   %rbp
+  8027fe:	48 89 e5             	mov    %rsp,%rbp
+  802801:	41 55                	push   %r13
+  802803:	41 54                	push   %r12
+  802805:	53                   	push   %rbx
+  802806:	48 83 ec 08          	sub    $0x8,%rsp
+  80280a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80280d:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+  802819:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80281c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802821:	4c 89 e6             	mov    %r12,%rsi
+  802824:	bf 00 00 00 00       	mov    $0x0,%edi
+  802829:	49 bc e0 02 80 00 00 	movabs $0x8002e0,%r12
+  802830:	00 00 00 
+  802833:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802836:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80283a:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80283e:	49 bd cd 27 80 00 00 	movabs $0x8027cd,%r13
+  802845:	00 00 00 
+  802848:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80284b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80284f:	48 89 de             	mov    %rbx,%rsi
+  802852:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802855:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80285a:	48 89 de             	mov    %rbx,%rsi
+  80285d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802862:	41 ff d4             	call   *%r12
+  802865:	48 83 c4 08          	add    $0x8,%rsp
+  802869:	5b                   	pop    %rbx
+  80286a:	41 5c                	pop    %r12
+  80286c:	41 5d                	pop    %r13
+  80286e:	5d                   	pop    %rbp
+  80286f:	c3                   	ret
+
+0000000000802870 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802870:	55                   	push   %rbp
+  802871:	48 89 e5             	mov    %rsp,%rbp
+  802874:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802877:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80287c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802881:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+  80288d:	85 c0                	test   %eax,%eax
+  80288f:	0f 94 c0             	sete   %al
+  802892:	0f b6 c0             	movzbl %al,%eax
+}
+  802895:	5d                   	pop    %rbp
+  802896:	c3                   	ret
+
+0000000000802897 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802897:	55                   	push   %rbp
+  802898:	48 89 e5             	mov    %rsp,%rbp
+  80289b:	41 57                	push   %r15
+  80289d:	41 56                	push   %r14
+  80289f:	41 55                	push   %r13
+  8028a1:	41 54                	push   %r12
+  8028a3:	53                   	push   %rbx
+  8028a4:	48 83 ec 38          	sub    $0x38,%rsp
+  8028a8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028ac:	49 89 f4             	mov    %rsi,%r12
+  8028af:	49 89 d7             	mov    %rdx,%r15
+  8028b2:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b6:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+  8028c2:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028c5:	4d 85 ff             	test   %r15,%r15
+  8028c8:	0f 84 f1 00 00 00    	je     8029bf <devpipe_write+0x128>
+  8028ce:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028d2:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028d6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028da:	49 bd 70 28 80 00 00 	movabs $0x802870,%r13
+  8028e1:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028e4:	49 bf cd 27 80 00 00 	movabs $0x8027cd,%r15
+  8028eb:	00 00 00 
+  8028ee:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8028f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028f6:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8028fa:	8b 73 04             	mov    0x4(%rbx),%esi
+  8028fd:	48 63 ce             	movslq %esi,%rcx
+  802900:	48 63 03             	movslq (%rbx),%rax
+  802903:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802909:	48 39 c1             	cmp    %rax,%rcx
+  80290c:	72 64                	jb     802972 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80290e:	48 89 de             	mov    %rbx,%rsi
+  802911:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802915:	41 ff d5             	call   *%r13
+  802918:	85 c0                	test   %eax,%eax
+  80291a:	0f 85 b9 00 00 00    	jne    8029d9 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802920:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802924:	4c 89 f7             	mov    %r14,%rdi
+  802927:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80292a:	8b 43 04             	mov    0x4(%rbx),%eax
+  80292d:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802934:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80293b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802941:	8b 03                	mov    (%rbx),%eax
+  802943:	41 39 c4             	cmp    %eax,%r12d
+  802946:	75 b2                	jne    8028fa <devpipe_write+0x63>
+  802948:	48 89 de             	mov    %rbx,%rsi
+  80294b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80294f:	41 ff d5             	call   *%r13
+  802952:	85 c0                	test   %eax,%eax
+  802954:	75 a0                	jne    8028f6 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802956:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80295b:	44 89 e6             	mov    %r12d,%esi
+  80295e:	48 89 df             	mov    %rbx,%rdi
+  802961:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+  80296d:	e9 7c ff ff ff       	jmp    8028ee <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802972:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802976:	41 0f b6 38          	movzbl (%r8),%edi
+  80297a:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802981:	80 80 80 
+  802984:	48 89 c8             	mov    %rcx,%rax
+  802987:	48 f7 e2             	mul    %rdx
+  80298a:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80298e:	48 89 d0             	mov    %rdx,%rax
+  802991:	48 c1 e0 08          	shl    $0x8,%rax
+  802995:	48 29 d0             	sub    %rdx,%rax
+  802998:	48 c1 e0 04          	shl    $0x4,%rax
+  80299c:	48 29 c1             	sub    %rax,%rcx
+  80299f:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029a4:	83 c6 01             	add    $0x1,%esi
+  8029a7:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029aa:	49 83 c0 01          	add    $0x1,%r8
+  8029ae:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029b2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029b6:	49 39 c0             	cmp    %rax,%r8
+  8029b9:	0f 85 2f ff ff ff    	jne    8028ee <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029bf:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029c3:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029c7:	48 b8 cd 27 80 00 00 	movabs $0x8027cd,%rax
+  8029ce:	00 00 00 
+  8029d1:	ff d0                	call   *%rax
+    return n;
+  8029d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029d7:	eb 05                	jmp    8029de <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029de:	48 83 c4 38          	add    $0x38,%rsp
+  8029e2:	5b                   	pop    %rbx
+  8029e3:	41 5c                	pop    %r12
+  8029e5:	41 5d                	pop    %r13
+  8029e7:	41 5e                	pop    %r14
+  8029e9:	41 5f                	pop    %r15
+  8029eb:	5d                   	pop    %rbp
+  8029ec:	c3                   	ret
+
+00000000008029ed <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029ed:	55                   	push   %rbp
+  8029ee:	48 89 e5             	mov    %rsp,%rbp
+  8029f1:	41 57                	push   %r15
+  8029f3:	41 56                	push   %r14
+  8029f5:	41 55                	push   %r13
+  8029f7:	41 54                	push   %r12
+  8029f9:	53                   	push   %rbx
+  8029fa:	48 83 ec 28          	sub    $0x28,%rsp
+  8029fe:	49 89 fd             	mov    %rdi,%r13
+  802a01:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a05:	49 89 d4             	mov    %rdx,%r12
+  802a08:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a0c:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+  802a18:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a1b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a21:	49 bf 70 28 80 00 00 	movabs $0x802870,%r15
+  802a28:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a2b:	4d 85 e4             	test   %r12,%r12
+  802a2e:	0f 84 d5 00 00 00    	je     802b09 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a34:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a38:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a3c:	8b 03                	mov    (%rbx),%eax
+  802a3e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a41:	75 7a                	jne    802abd <devpipe_read+0xd0>
+            if (i > 0) {
+  802a43:	4d 85 f6             	test   %r14,%r14
+  802a46:	75 50                	jne    802a98 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a48:	48 89 de             	mov    %rbx,%rsi
+  802a4b:	4c 89 ef             	mov    %r13,%rdi
+  802a4e:	41 ff d7             	call   *%r15
+  802a51:	85 c0                	test   %eax,%eax
+  802a53:	0f 85 c9 00 00 00    	jne    802b22 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a59:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a5c:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a63:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a69:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a6c:	41 39 c4             	cmp    %eax,%r12d
+  802a6f:	75 cb                	jne    802a3c <devpipe_read+0x4f>
+  802a71:	48 89 de             	mov    %rbx,%rsi
+  802a74:	4c 89 ef             	mov    %r13,%rdi
+  802a77:	41 ff d7             	call   *%r15
+  802a7a:	85 c0                	test   %eax,%eax
+  802a7c:	75 be                	jne    802a3c <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a7e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a83:	44 89 e6             	mov    %r12d,%esi
+  802a86:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a8a:	48 b8 a8 05 80 00 00 	movabs $0x8005a8,%rax
+  802a91:	00 00 00 
+  802a94:	ff d0                	call   *%rax
+  802a96:	eb a4                	jmp    802a3c <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802a98:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802a9c:	48 89 de             	mov    %rbx,%rsi
+  802a9f:	48 b8 cd 27 80 00 00 	movabs $0x8027cd,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+                return i;
+  802aab:	4c 89 f0             	mov    %r14,%rax
+}
+  802aae:	48 83 c4 28          	add    $0x28,%rsp
+  802ab2:	5b                   	pop    %rbx
+  802ab3:	41 5c                	pop    %r12
+  802ab5:	41 5d                	pop    %r13
+  802ab7:	41 5e                	pop    %r14
+  802ab9:	41 5f                	pop    %r15
+  802abb:	5d                   	pop    %rbp
+  802abc:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802abd:	48 63 c8             	movslq %eax,%rcx
+  802ac0:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ac7:	80 80 80 
+  802aca:	48 89 c8             	mov    %rcx,%rax
+  802acd:	48 f7 e2             	mul    %rdx
+  802ad0:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802ad4:	48 89 d0             	mov    %rdx,%rax
+  802ad7:	48 c1 e0 08          	shl    $0x8,%rax
+  802adb:	48 29 d0             	sub    %rdx,%rax
+  802ade:	48 c1 e0 04          	shl    $0x4,%rax
+  802ae2:	48 89 c2             	mov    %rax,%rdx
+  802ae5:	48 89 c8             	mov    %rcx,%rax
+  802ae8:	48 29 d0             	sub    %rdx,%rax
+  802aeb:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802af0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802af4:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802af8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802afb:	49 83 c6 01          	add    $0x1,%r14
+  802aff:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b03:	0f 85 2b ff ff ff    	jne    802a34 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b09:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b0d:	48 89 de             	mov    %rbx,%rsi
+  802b10:	48 b8 cd 27 80 00 00 	movabs $0x8027cd,%rax
+  802b17:	00 00 00 
+  802b1a:	ff d0                	call   *%rax
+    return n;
+  802b1c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b20:	eb 8c                	jmp    802aae <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b22:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b27:	eb 85                	jmp    802aae <devpipe_read+0xc1>
+
+0000000000802b29 <pipe>:
+pipe(int pfd[2]) {
+  802b29:	55                   	push   %rbp
+  802b2a:	48 89 e5             	mov    %rsp,%rbp
+  802b2d:	41 55                	push   %r13
+  802b2f:	41 54                	push   %r12
+  802b31:	53                   	push   %rbx
+  802b32:	48 83 ec 18          	sub    $0x18,%rsp
+  802b36:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b39:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b3d:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  802b44:	00 00 00 
+  802b47:	ff d0                	call   *%rax
+  802b49:	89 c3                	mov    %eax,%ebx
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	0f 88 a0 01 00 00    	js     802cf3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b53:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b58:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b5d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b61:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b66:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+  802b72:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b74:	85 c0                	test   %eax,%eax
+  802b76:	0f 88 77 01 00 00    	js     802cf3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b7c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b80:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  802b87:	00 00 00 
+  802b8a:	ff d0                	call   *%rax
+  802b8c:	89 c3                	mov    %eax,%ebx
+  802b8e:	85 c0                	test   %eax,%eax
+  802b90:	0f 88 43 01 00 00    	js     802cd9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802b96:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba9:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  802bb0:	00 00 00 
+  802bb3:	ff d0                	call   *%rax
+  802bb5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bb7:	85 c0                	test   %eax,%eax
+  802bb9:	0f 88 1a 01 00 00    	js     802cd9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bbf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bc3:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+  802bcf:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bd2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bd7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bdc:	48 89 c6             	mov    %rax,%rsi
+  802bdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be4:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  802beb:	00 00 00 
+  802bee:	ff d0                	call   *%rax
+  802bf0:	89 c3                	mov    %eax,%ebx
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	0f 88 c5 00 00 00    	js     802cbf <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802bfa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802bfe:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+  802c0a:	48 89 c1             	mov    %rax,%rcx
+  802c0d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c13:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1e:	4c 89 ee             	mov    %r13,%rsi
+  802c21:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c26:	48 b8 90 02 80 00 00 	movabs $0x800290,%rax
+  802c2d:	00 00 00 
+  802c30:	ff d0                	call   *%rax
+  802c32:	89 c3                	mov    %eax,%ebx
+  802c34:	85 c0                	test   %eax,%eax
+  802c36:	78 6e                	js     802ca6 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c38:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c3d:	4c 89 ef             	mov    %r13,%rdi
+  802c40:	48 b8 ff 01 80 00 00 	movabs $0x8001ff,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+  802c4c:	83 f8 02             	cmp    $0x2,%eax
+  802c4f:	0f 85 ab 00 00 00    	jne    802d00 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c55:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c5c:	00 00 
+  802c5e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c62:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c64:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c68:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c6f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c73:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c75:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c79:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c80:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c84:	48 bb 6d 06 80 00 00 	movabs $0x80066d,%rbx
+  802c8b:	00 00 00 
+  802c8e:	ff d3                	call   *%rbx
+  802c90:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802c94:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c98:	ff d3                	call   *%rbx
+  802c9a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802c9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca4:	eb 4d                	jmp    802cf3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802ca6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cab:	4c 89 ee             	mov    %r13,%rsi
+  802cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb3:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccd:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cde:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce7:	48 b8 e0 02 80 00 00 	movabs $0x8002e0,%rax
+  802cee:	00 00 00 
+  802cf1:	ff d0                	call   *%rax
+}
+  802cf3:	89 d8                	mov    %ebx,%eax
+  802cf5:	48 83 c4 18          	add    $0x18,%rsp
+  802cf9:	5b                   	pop    %rbx
+  802cfa:	41 5c                	pop    %r12
+  802cfc:	41 5d                	pop    %r13
+  802cfe:	5d                   	pop    %rbp
+  802cff:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d00:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d07:	00 00 00 
+  802d0a:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d11:	00 00 00 
+  802d14:	be 50 00 00 00       	mov    $0x50,%esi
+  802d19:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d20:	00 00 00 
+  802d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d28:	49 b8 58 33 80 00 00 	movabs $0x803358,%r8
+  802d2f:	00 00 00 
+  802d32:	41 ff d0             	call   *%r8
+
+0000000000802d35 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d35:	55                   	push   %rbp
+  802d36:	48 89 e5             	mov    %rsp,%rbp
+  802d39:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d3d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d41:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  802d48:	00 00 00 
+  802d4b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d4d:	85 c0                	test   %eax,%eax
+  802d4f:	78 23                	js     802d74 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d55:	48 b8 7f 06 80 00 00 	movabs $0x80067f,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+  802d61:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d64:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d68:	48 b8 70 28 80 00 00 	movabs $0x802870,%rax
+  802d6f:	00 00 00 
+  802d72:	ff d0                	call   *%rax
+}
+  802d74:	c9                   	leave
+  802d75:	c3                   	ret
+
+0000000000802d76 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d76:	48 89 f8             	mov    %rdi,%rax
+  802d79:	48 c1 e8 27          	shr    $0x27,%rax
+  802d7d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d84:	01 00 00 
+  802d87:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d8b:	f6 c2 01             	test   $0x1,%dl
+  802d8e:	74 6d                	je     802dfd <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d90:	48 89 f8             	mov    %rdi,%rax
+  802d93:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d97:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d9e:	01 00 00 
+  802da1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da5:	f6 c2 01             	test   $0x1,%dl
+  802da8:	74 62                	je     802e0c <get_uvpt_entry+0x96>
+  802daa:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802db1:	01 00 00 
+  802db4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802db8:	f6 c2 80             	test   $0x80,%dl
+  802dbb:	75 4f                	jne    802e0c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dbd:	48 89 f8             	mov    %rdi,%rax
+  802dc0:	48 c1 e8 15          	shr    $0x15,%rax
+  802dc4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dcb:	01 00 00 
+  802dce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dd2:	f6 c2 01             	test   $0x1,%dl
+  802dd5:	74 44                	je     802e1b <get_uvpt_entry+0xa5>
+  802dd7:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dde:	01 00 00 
+  802de1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802de5:	f6 c2 80             	test   $0x80,%dl
+  802de8:	75 31                	jne    802e1b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802dea:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802dee:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802df5:	01 00 00 
+  802df8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802dfc:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802dfd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e04:	01 00 00 
+  802e07:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e0b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e0c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e13:	01 00 00 
+  802e16:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e1a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e1b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e22:	01 00 00 
+  802e25:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e29:	c3                   	ret
+
+0000000000802e2a <get_prot>:
+
+int
+get_prot(void *va) {
+  802e2a:	55                   	push   %rbp
+  802e2b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e2e:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  802e35:	00 00 00 
+  802e38:	ff d0                	call   *%rax
+  802e3a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e3d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e42:	89 c1                	mov    %eax,%ecx
+  802e44:	83 c9 04             	or     $0x4,%ecx
+  802e47:	f6 c2 01             	test   $0x1,%dl
+  802e4a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e4d:	89 c1                	mov    %eax,%ecx
+  802e4f:	83 c9 02             	or     $0x2,%ecx
+  802e52:	f6 c2 02             	test   $0x2,%dl
+  802e55:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e58:	89 c1                	mov    %eax,%ecx
+  802e5a:	83 c9 01             	or     $0x1,%ecx
+  802e5d:	48 85 d2             	test   %rdx,%rdx
+  802e60:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e63:	89 c1                	mov    %eax,%ecx
+  802e65:	83 c9 40             	or     $0x40,%ecx
+  802e68:	f6 c6 04             	test   $0x4,%dh
+  802e6b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e6e:	5d                   	pop    %rbp
+  802e6f:	c3                   	ret
+
+0000000000802e70 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e70:	55                   	push   %rbp
+  802e71:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e74:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  802e7b:	00 00 00 
+  802e7e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e80:	48 c1 e8 06          	shr    $0x6,%rax
+  802e84:	83 e0 01             	and    $0x1,%eax
+}
+  802e87:	5d                   	pop    %rbp
+  802e88:	c3                   	ret
+
+0000000000802e89 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e89:	55                   	push   %rbp
+  802e8a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802e8d:	48 b8 76 2d 80 00 00 	movabs $0x802d76,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+  802e99:	83 e0 01             	and    $0x1,%eax
+}
+  802e9c:	5d                   	pop    %rbp
+  802e9d:	c3                   	ret
+
+0000000000802e9e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802e9e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ea5:	01 00 00 
+  802ea8:	a8 01                	test   $0x1,%al
+  802eaa:	75 06                	jne    802eb2 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802eac:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb1:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802eb2:	55                   	push   %rbp
+  802eb3:	48 89 e5             	mov    %rsp,%rbp
+  802eb6:	41 57                	push   %r15
+  802eb8:	41 56                	push   %r14
+  802eba:	41 55                	push   %r13
+  802ebc:	41 54                	push   %r12
+  802ebe:	53                   	push   %rbx
+  802ebf:	48 83 ec 28          	sub    $0x28,%rsp
+  802ec3:	49 89 fe             	mov    %rdi,%r14
+  802ec6:	49 89 f7             	mov    %rsi,%r15
+  802ec9:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ed0:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ed1:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ed8:	01 00 00 
+  802edb:	e9 ae 00 00 00       	jmp    802f8e <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802ee0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ee7:	49 83 ec 01          	sub    $0x1,%r12
+  802eeb:	74 2d                	je     802f1a <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802eed:	48 89 d8             	mov    %rbx,%rax
+  802ef0:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802ef9:	f6 c2 01             	test   $0x1,%dl
+  802efc:	74 e2                	je     802ee0 <foreach_shared_region+0x42>
+  802efe:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f03:	f6 c4 04             	test   $0x4,%ah
+  802f06:	74 d8                	je     802ee0 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f08:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f0f:	4c 89 fa             	mov    %r15,%rdx
+  802f12:	48 89 df             	mov    %rbx,%rdi
+  802f15:	41 ff d6             	call   *%r14
+  802f18:	eb c6                	jmp    802ee0 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f1a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f21:	00 
+  802f22:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f27:	74 4a                	je     802f73 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f29:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f2d:	48 c1 e8 15          	shr    $0x15,%rax
+  802f31:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f38:	01 00 00 
+  802f3b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f3f:	a8 01                	test   $0x1,%al
+  802f41:	74 d7                	je     802f1a <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f43:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f47:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f4e:	48 39 c3             	cmp    %rax,%rbx
+  802f51:	73 c7                	jae    802f1a <foreach_shared_region+0x7c>
+  802f53:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f5a:	48 39 d0             	cmp    %rdx,%rax
+  802f5d:	4d 19 e4             	sbb    %r12,%r12
+  802f60:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f67:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f6e:	e9 7a ff ff ff       	jmp    802eed <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f73:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f7a:	40 
+  802f7b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f7f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f86:	00 00 00 
+  802f89:	48 39 c1             	cmp    %rax,%rcx
+  802f8c:	74 50                	je     802fde <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802f8e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f92:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f96:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802f9d:	01 00 00 
+  802fa0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fa4:	a8 01                	test   $0x1,%al
+  802fa6:	74 cb                	je     802f73 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fa8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fac:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fb3:	48 39 c1             	cmp    %rax,%rcx
+  802fb6:	73 bb                	jae    802f73 <foreach_shared_region+0xd5>
+  802fb8:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fbf:	48 39 d0             	cmp    %rdx,%rax
+  802fc2:	48 19 c0             	sbb    %rax,%rax
+  802fc5:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fcb:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fd1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fd5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fd9:	e9 4b ff ff ff       	jmp    802f29 <foreach_shared_region+0x8b>
+  802fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe3:	48 83 c4 28          	add    $0x28,%rsp
+  802fe7:	5b                   	pop    %rbx
+  802fe8:	41 5c                	pop    %r12
+  802fea:	41 5d                	pop    %r13
+  802fec:	41 5e                	pop    %r14
+  802fee:	41 5f                	pop    %r15
+  802ff0:	5d                   	pop    %rbp
+  802ff1:	c3                   	ret
+
+0000000000802ff2 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  802ff2:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  802ff8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  802fff:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803006:	c3                   	ret
+
+0000000000803007 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803007:	8b 47 40             	mov    0x40(%rdi),%eax
+  80300a:	8b 17                	mov    (%rdi),%edx
+  80300c:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80300e:	83 f8 0f             	cmp    $0xf,%eax
+  803011:	77 13                	ja     803026 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803013:	8b 47 40             	mov    0x40(%rdi),%eax
+  803016:	83 e0 0f             	and    $0xf,%eax
+  803019:	48 c1 e0 09          	shl    $0x9,%rax
+  80301d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803024:	00 
+  803025:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803026:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80302b:	c3                   	ret
+
+000000000080302c <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80302c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80302f:	83 c0 01             	add    $0x1,%eax
+  803032:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803035:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80303b:	8b 57 04             	mov    0x4(%rdi),%edx
+  80303e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803043:	85 d2                	test   %edx,%edx
+  803045:	75 04                	jne    80304b <chan_publish+0x1f>
+  803047:	83 e0 01             	and    $0x1,%eax
+}
+  80304a:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80304b:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80304e:	85 c0                	test   %eax,%eax
+  803050:	0f 95 c0             	setne  %al
+  803053:	0f b6 c0             	movzbl %al,%eax
+  803056:	eb ef                	jmp    803047 <chan_publish+0x1b>
+
+0000000000803058 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803058:	8b 47 40             	mov    0x40(%rdi),%eax
+  80305b:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80305d:	29 d0                	sub    %edx,%eax
+  80305f:	83 e8 01             	sub    $0x1,%eax
+  803062:	83 f8 0f             	cmp    $0xf,%eax
+  803065:	77 12                	ja     803079 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803067:	8b 07                	mov    (%rdi),%eax
+  803069:	83 e0 0f             	and    $0xf,%eax
+  80306c:	48 c1 e0 09          	shl    $0x9,%rax
+  803070:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803077:	00 
+  803078:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803079:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307e:	c3                   	ret
+
+000000000080307f <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80307f:	8b 07                	mov    (%rdi),%eax
+  803081:	83 c0 01             	add    $0x1,%eax
+  803084:	89 07                	mov    %eax,(%rdi)
+}
+  803086:	c3                   	ret
+
+0000000000803087 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803087:	55                   	push   %rbp
+  803088:	48 89 e5             	mov    %rsp,%rbp
+  80308b:	53                   	push   %rbx
+  80308c:	48 83 ec 08          	sub    $0x8,%rsp
+  803090:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803093:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80309a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030a0:	48 b8 58 30 80 00 00 	movabs $0x803058,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+  8030ac:	48 85 c0             	test   %rax,%rax
+  8030af:	74 12                	je     8030c3 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030b1:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030b8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030bd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c1:	c9                   	leave
+  8030c2:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c8:	eb f3                	jmp    8030bd <chan_arm+0x36>
+
+00000000008030ca <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	41 56                	push   %r14
+  8030d0:	41 55                	push   %r13
+  8030d2:	41 54                	push   %r12
+  8030d4:	53                   	push   %rbx
+  8030d5:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030d8:	49 bc 87 30 80 00 00 	movabs $0x803087,%r12
+  8030df:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030e2:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030e6:	49 bd a8 05 80 00 00 	movabs $0x8005a8,%r13
+  8030ed:	00 00 00 
+    while (chan_arm(r))
+  8030f0:	eb 0d                	jmp    8030ff <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030f2:	8b 33                	mov    (%rbx),%esi
+  8030f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f9:	4c 89 f7             	mov    %r14,%rdi
+  8030fc:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8030ff:	48 89 df             	mov    %rbx,%rdi
+  803102:	41 ff d4             	call   *%r12
+  803105:	84 c0                	test   %al,%al
+  803107:	75 e9                	jne    8030f2 <chan_wait+0x28>
+}
+  803109:	5b                   	pop    %rbx
+  80310a:	41 5c                	pop    %r12
+  80310c:	41 5d                	pop    %r13
+  80310e:	41 5e                	pop    %r14
+  803110:	5d                   	pop    %rbp
+  803111:	c3                   	ret
+
+0000000000803112 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803112:	55                   	push   %rbp
+  803113:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803116:	48 83 c7 40          	add    $0x40,%rdi
+  80311a:	be 01 00 00 00       	mov    $0x1,%esi
+  80311f:	48 b8 c6 05 80 00 00 	movabs $0x8005c6,%rax
+  803126:	00 00 00 
+  803129:	ff d0                	call   *%rax
+}
+  80312b:	5d                   	pop    %rbp
+  80312c:	c3                   	ret
+
+000000000080312d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80312d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803132:	c3                   	ret
+
+0000000000803133 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803133:	55                   	push   %rbp
+  803134:	48 89 e5             	mov    %rsp,%rbp
+  803137:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80313a:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  803141:	00 00 00 
+  803144:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+    return 0;
+}
+  803150:	b8 00 00 00 00       	mov    $0x0,%eax
+  803155:	5d                   	pop    %rbp
+  803156:	c3                   	ret
+
+0000000000803157 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803157:	55                   	push   %rbp
+  803158:	48 89 e5             	mov    %rsp,%rbp
+  80315b:	41 57                	push   %r15
+  80315d:	41 56                	push   %r14
+  80315f:	41 55                	push   %r13
+  803161:	41 54                	push   %r12
+  803163:	53                   	push   %rbx
+  803164:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80316b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803172:	48 85 d2             	test   %rdx,%rdx
+  803175:	74 7a                	je     8031f1 <devcons_write+0x9a>
+  803177:	49 89 d6             	mov    %rdx,%r14
+  80317a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803180:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803185:	49 bf c7 3f 80 00 00 	movabs $0x803fc7,%r15
+  80318c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80318f:	4c 89 f3             	mov    %r14,%rbx
+  803192:	48 29 f3             	sub    %rsi,%rbx
+  803195:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80319a:	48 39 c3             	cmp    %rax,%rbx
+  80319d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031a1:	4c 63 eb             	movslq %ebx,%r13
+  8031a4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031ab:	48 01 c6             	add    %rax,%rsi
+  8031ae:	4c 89 ea             	mov    %r13,%rdx
+  8031b1:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031b8:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031bb:	4c 89 ee             	mov    %r13,%rsi
+  8031be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031c5:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  8031cc:	00 00 00 
+  8031cf:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031d1:	41 01 dc             	add    %ebx,%r12d
+  8031d4:	49 63 f4             	movslq %r12d,%rsi
+  8031d7:	4c 39 f6             	cmp    %r14,%rsi
+  8031da:	72 b3                	jb     80318f <devcons_write+0x38>
+    return res;
+  8031dc:	49 63 c4             	movslq %r12d,%rax
+}
+  8031df:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031e6:	5b                   	pop    %rbx
+  8031e7:	41 5c                	pop    %r12
+  8031e9:	41 5d                	pop    %r13
+  8031eb:	41 5e                	pop    %r14
+  8031ed:	41 5f                	pop    %r15
+  8031ef:	5d                   	pop    %rbp
+  8031f0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8031f1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031f7:	eb e3                	jmp    8031dc <devcons_write+0x85>
+
+00000000008031f9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031f9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8031fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803201:	48 85 c0             	test   %rax,%rax
+  803204:	74 55                	je     80325b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803206:	55                   	push   %rbp
+  803207:	48 89 e5             	mov    %rsp,%rbp
+  80320a:	41 55                	push   %r13
+  80320c:	41 54                	push   %r12
+  80320e:	53                   	push   %rbx
+  80320f:	48 83 ec 08          	sub    $0x8,%rsp
+  803213:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803216:	48 bb 21 01 80 00 00 	movabs $0x800121,%rbx
+  80321d:	00 00 00 
+  803220:	49 bc d6 01 80 00 00 	movabs $0x8001d6,%r12
+  803227:	00 00 00 
+  80322a:	eb 03                	jmp    80322f <devcons_read+0x36>
+  80322c:	41 ff d4             	call   *%r12
+  80322f:	ff d3                	call   *%rbx
+  803231:	85 c0                	test   %eax,%eax
+  803233:	74 f7                	je     80322c <devcons_read+0x33>
+    if (c < 0) return c;
+  803235:	48 63 d0             	movslq %eax,%rdx
+  803238:	78 13                	js     80324d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80323a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323f:	83 f8 04             	cmp    $0x4,%eax
+  803242:	74 09                	je     80324d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803244:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803248:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80324d:	48 89 d0             	mov    %rdx,%rax
+  803250:	48 83 c4 08          	add    $0x8,%rsp
+  803254:	5b                   	pop    %rbx
+  803255:	41 5c                	pop    %r12
+  803257:	41 5d                	pop    %r13
+  803259:	5d                   	pop    %rbp
+  80325a:	c3                   	ret
+  80325b:	48 89 d0             	mov    %rdx,%rax
+  80325e:	c3                   	ret
+
+000000000080325f <cputchar>:
+cputchar(int ch) {
+  80325f:	55                   	push   %rbp
+  803260:	48 89 e5             	mov    %rsp,%rbp
+  803263:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803267:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80326b:	be 01 00 00 00       	mov    $0x1,%esi
+  803270:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803274:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+}
+  803280:	c9                   	leave
+  803281:	c3                   	ret
+
+0000000000803282 <getchar>:
+getchar(void) {
+  803282:	55                   	push   %rbp
+  803283:	48 89 e5             	mov    %rsp,%rbp
+  803286:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80328a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80328f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803293:	bf 00 00 00 00       	mov    $0x0,%edi
+  803298:	48 b8 de 09 80 00 00 	movabs $0x8009de,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+  8032a4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032a6:	85 c0                	test   %eax,%eax
+  8032a8:	78 06                	js     8032b0 <getchar+0x2e>
+  8032aa:	74 08                	je     8032b4 <getchar+0x32>
+  8032ac:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032b0:	89 d0                	mov    %edx,%eax
+  8032b2:	c9                   	leave
+  8032b3:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032b4:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032b9:	eb f5                	jmp    8032b0 <getchar+0x2e>
+
+00000000008032bb <iscons>:
+iscons(int fdnum) {
+  8032bb:	55                   	push   %rbp
+  8032bc:	48 89 e5             	mov    %rsp,%rbp
+  8032bf:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032c3:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032c7:	48 b8 fb 06 80 00 00 	movabs $0x8006fb,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032d3:	85 c0                	test   %eax,%eax
+  8032d5:	78 18                	js     8032ef <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032d7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032db:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032e2:	00 00 00 
+  8032e5:	8b 00                	mov    (%rax),%eax
+  8032e7:	39 02                	cmp    %eax,(%rdx)
+  8032e9:	0f 94 c0             	sete   %al
+  8032ec:	0f b6 c0             	movzbl %al,%eax
+}
+  8032ef:	c9                   	leave
+  8032f0:	c3                   	ret
+
+00000000008032f1 <opencons>:
+opencons(void) {
+  8032f1:	55                   	push   %rbp
+  8032f2:	48 89 e5             	mov    %rsp,%rbp
+  8032f5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032f9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8032fd:	48 b8 9b 06 80 00 00 	movabs $0x80069b,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+  803309:	85 c0                	test   %eax,%eax
+  80330b:	78 49                	js     803356 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80330d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803312:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803317:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80331b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803320:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  803327:	00 00 00 
+  80332a:	ff d0                	call   *%rax
+  80332c:	85 c0                	test   %eax,%eax
+  80332e:	78 26                	js     803356 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803330:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803334:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80333b:	00 00 
+  80333d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80333f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803343:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80334a:	48 b8 6d 06 80 00 00 	movabs $0x80066d,%rax
+  803351:	00 00 00 
+  803354:	ff d0                	call   *%rax
+}
+  803356:	c9                   	leave
+  803357:	c3                   	ret
+
+0000000000803358 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803358:	55                   	push   %rbp
+  803359:	48 89 e5             	mov    %rsp,%rbp
+  80335c:	41 56                	push   %r14
+  80335e:	41 55                	push   %r13
+  803360:	41 54                	push   %r12
+  803362:	53                   	push   %rbx
+  803363:	48 83 ec 50          	sub    $0x50,%rsp
+  803367:	49 89 fc             	mov    %rdi,%r12
+  80336a:	41 89 f5             	mov    %esi,%r13d
+  80336d:	48 89 d3             	mov    %rdx,%rbx
+  803370:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803374:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803378:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80337c:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803383:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803387:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80338b:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80338f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803393:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80339a:	00 00 00 
+  80339d:	4c 8b 30             	mov    (%rax),%r14
+  8033a0:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  8033a7:	00 00 00 
+  8033aa:	ff d0                	call   *%rax
+  8033ac:	89 c6                	mov    %eax,%esi
+  8033ae:	45 89 e8             	mov    %r13d,%r8d
+  8033b1:	4c 89 e1             	mov    %r12,%rcx
+  8033b4:	4c 89 f2             	mov    %r14,%rdx
+  8033b7:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033be:	00 00 00 
+  8033c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c6:	49 bc a8 34 80 00 00 	movabs $0x8034a8,%r12
+  8033cd:	00 00 00 
+  8033d0:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033d3:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033d7:	48 89 df             	mov    %rbx,%rdi
+  8033da:	48 b8 44 34 80 00 00 	movabs $0x803444,%rax
+  8033e1:	00 00 00 
+  8033e4:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033e6:	48 bf 23 47 80 00 00 	movabs $0x804723,%rdi
+  8033ed:	00 00 00 
+  8033f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f5:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8033f8:	cc                   	int3
+  8033f9:	eb fd                	jmp    8033f8 <_panic+0xa0>
+
+00000000008033fb <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8033fb:	55                   	push   %rbp
+  8033fc:	48 89 e5             	mov    %rsp,%rbp
+  8033ff:	53                   	push   %rbx
+  803400:	48 83 ec 08          	sub    $0x8,%rsp
+  803404:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803407:	8b 06                	mov    (%rsi),%eax
+  803409:	8d 50 01             	lea    0x1(%rax),%edx
+  80340c:	89 16                	mov    %edx,(%rsi)
+  80340e:	48 98                	cltq
+  803410:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803415:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80341b:	74 0a                	je     803427 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80341d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803421:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803425:	c9                   	leave
+  803426:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803427:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80342b:	be ff 00 00 00       	mov    $0xff,%esi
+  803430:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  803437:	00 00 00 
+  80343a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80343c:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803442:	eb d9                	jmp    80341d <putch+0x22>
+
+0000000000803444 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803444:	55                   	push   %rbp
+  803445:	48 89 e5             	mov    %rsp,%rbp
+  803448:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80344f:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803452:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803459:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80345e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803463:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803466:	48 89 f1             	mov    %rsi,%rcx
+  803469:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803470:	48 bf fb 33 80 00 00 	movabs $0x8033fb,%rdi
+  803477:	00 00 00 
+  80347a:	48 b8 f8 35 80 00 00 	movabs $0x8035f8,%rax
+  803481:	00 00 00 
+  803484:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803486:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80348d:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803494:	48 b8 02 01 80 00 00 	movabs $0x800102,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034a0:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034a6:	c9                   	leave
+  8034a7:	c3                   	ret
+
+00000000008034a8 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034a8:	55                   	push   %rbp
+  8034a9:	48 89 e5             	mov    %rsp,%rbp
+  8034ac:	48 83 ec 50          	sub    $0x50,%rsp
+  8034b0:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034b4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034b8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034bc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034c0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034c4:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034cb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034d3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034d7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034db:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034df:	48 b8 44 34 80 00 00 	movabs $0x803444,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8034eb:	c9                   	leave
+  8034ec:	c3                   	ret
+
+00000000008034ed <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+  8034f1:	41 57                	push   %r15
+  8034f3:	41 56                	push   %r14
+  8034f5:	41 55                	push   %r13
+  8034f7:	41 54                	push   %r12
+  8034f9:	53                   	push   %rbx
+  8034fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8034fe:	49 89 fc             	mov    %rdi,%r12
+  803501:	49 89 f5             	mov    %rsi,%r13
+  803504:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803508:	8b 45 10             	mov    0x10(%rbp),%eax
+  80350b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80350e:	41 89 cf             	mov    %ecx,%r15d
+  803511:	4c 39 fa             	cmp    %r15,%rdx
+  803514:	73 5b                	jae    803571 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803516:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80351a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80351e:	85 db                	test   %ebx,%ebx
+  803520:	7e 0e                	jle    803530 <print_num+0x43>
+            putch(padc, put_arg);
+  803522:	4c 89 ee             	mov    %r13,%rsi
+  803525:	44 89 f7             	mov    %r14d,%edi
+  803528:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80352b:	83 eb 01             	sub    $0x1,%ebx
+  80352e:	75 f2                	jne    803522 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803530:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803534:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  80353b:	00 00 00 
+  80353e:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  803545:	00 00 00 
+  803548:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80354c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803550:	ba 00 00 00 00       	mov    $0x0,%edx
+  803555:	49 f7 f7             	div    %r15
+  803558:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80355c:	4c 89 ee             	mov    %r13,%rsi
+  80355f:	41 ff d4             	call   *%r12
+}
+  803562:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803566:	5b                   	pop    %rbx
+  803567:	41 5c                	pop    %r12
+  803569:	41 5d                	pop    %r13
+  80356b:	41 5e                	pop    %r14
+  80356d:	41 5f                	pop    %r15
+  80356f:	5d                   	pop    %rbp
+  803570:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803571:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803575:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357a:	49 f7 f7             	div    %r15
+  80357d:	48 83 ec 08          	sub    $0x8,%rsp
+  803581:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803585:	52                   	push   %rdx
+  803586:	45 0f be c9          	movsbl %r9b,%r9d
+  80358a:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80358e:	48 89 c2             	mov    %rax,%rdx
+  803591:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  803598:	00 00 00 
+  80359b:	ff d0                	call   *%rax
+  80359d:	48 83 c4 10          	add    $0x10,%rsp
+  8035a1:	eb 8d                	jmp    803530 <print_num+0x43>
+
+00000000008035a3 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035a3:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035a7:	48 8b 06             	mov    (%rsi),%rax
+  8035aa:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035ae:	73 0a                	jae    8035ba <sprintputch+0x17>
+        *state->start++ = ch;
+  8035b0:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035b4:	48 89 16             	mov    %rdx,(%rsi)
+  8035b7:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035ba:	c3                   	ret
+
+00000000008035bb <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035bb:	55                   	push   %rbp
+  8035bc:	48 89 e5             	mov    %rsp,%rbp
+  8035bf:	48 83 ec 50          	sub    $0x50,%rsp
+  8035c3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035c7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035cb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035cf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035d6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035de:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035e2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035e6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035ea:	48 b8 f8 35 80 00 00 	movabs $0x8035f8,%rax
+  8035f1:	00 00 00 
+  8035f4:	ff d0                	call   *%rax
+}
+  8035f6:	c9                   	leave
+  8035f7:	c3                   	ret
+
+00000000008035f8 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8035f8:	55                   	push   %rbp
+  8035f9:	48 89 e5             	mov    %rsp,%rbp
+  8035fc:	41 57                	push   %r15
+  8035fe:	41 56                	push   %r14
+  803600:	41 55                	push   %r13
+  803602:	41 54                	push   %r12
+  803604:	53                   	push   %rbx
+  803605:	48 83 ec 38          	sub    $0x38,%rsp
+  803609:	49 89 fe             	mov    %rdi,%r14
+  80360c:	49 89 f5             	mov    %rsi,%r13
+  80360f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803612:	48 8b 01             	mov    (%rcx),%rax
+  803615:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803619:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80361d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803621:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803625:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803629:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80362d:	0f b6 3b             	movzbl (%rbx),%edi
+  803630:	40 80 ff 25          	cmp    $0x25,%dil
+  803634:	74 18                	je     80364e <vprintfmt+0x56>
+            if (!ch) return;
+  803636:	40 84 ff             	test   %dil,%dil
+  803639:	0f 84 b1 06 00 00    	je     803cf0 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80363f:	40 0f b6 ff          	movzbl %dil,%edi
+  803643:	4c 89 ee             	mov    %r13,%rsi
+  803646:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803649:	4c 89 e3             	mov    %r12,%rbx
+  80364c:	eb db                	jmp    803629 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80364e:	be 00 00 00 00       	mov    $0x0,%esi
+  803653:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803657:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80365c:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803662:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803669:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80366d:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803672:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803677:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80367a:	83 e8 23             	sub    $0x23,%eax
+  80367d:	3c 57                	cmp    $0x57,%al
+  80367f:	0f 87 51 06 00 00    	ja     803cd6 <vprintfmt+0x6de>
+  803685:	0f b6 c0             	movzbl %al,%eax
+  803688:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  80368f:	00 00 00 
+  803692:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803695:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803698:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80369c:	eb cf                	jmp    80366d <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80369e:	49 89 dc             	mov    %rbx,%r12
+  8036a1:	be 01 00 00 00       	mov    $0x1,%esi
+  8036a6:	eb c5                	jmp    80366d <vprintfmt+0x75>
+            padc = ch;
+  8036a8:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036ac:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036af:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036b2:	eb b9                	jmp    80366d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8036ba:	77 24                	ja     8036e0 <vprintfmt+0xe8>
+  8036bc:	89 c1                	mov    %eax,%ecx
+  8036be:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036c2:	83 c0 08             	add    $0x8,%eax
+  8036c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036c8:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036cb:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036ce:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036d2:	79 99                	jns    80366d <vprintfmt+0x75>
+                width = precision;
+  8036d4:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036d8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036de:	eb 8d                	jmp    80366d <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036e0:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036e4:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036ec:	eb da                	jmp    8036c8 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8036ee:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8036f3:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8036f7:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8036fd:	3c 39                	cmp    $0x39,%al
+  8036ff:	77 1c                	ja     80371d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803701:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803705:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803709:	0f b6 c0             	movzbl %al,%eax
+  80370c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803711:	0f b6 03             	movzbl (%rbx),%eax
+  803714:	3c 39                	cmp    $0x39,%al
+  803716:	76 e9                	jbe    803701 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803718:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80371b:	eb b1                	jmp    8036ce <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80371d:	49 89 dc             	mov    %rbx,%r12
+  803720:	eb ac                	jmp    8036ce <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803722:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803725:	85 c9                	test   %ecx,%ecx
+  803727:	b8 00 00 00 00       	mov    $0x0,%eax
+  80372c:	0f 49 c1             	cmovns %ecx,%eax
+  80372f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803732:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803735:	e9 33 ff ff ff       	jmp    80366d <vprintfmt+0x75>
+            lflag++;
+  80373a:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80373d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803740:	e9 28 ff ff ff       	jmp    80366d <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803745:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803748:	83 f8 2f             	cmp    $0x2f,%eax
+  80374b:	77 19                	ja     803766 <vprintfmt+0x16e>
+  80374d:	89 c2                	mov    %eax,%edx
+  80374f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803753:	83 c0 08             	add    $0x8,%eax
+  803756:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803759:	8b 3a                	mov    (%rdx),%edi
+  80375b:	4c 89 ee             	mov    %r13,%rsi
+  80375e:	41 ff d6             	call   *%r14
+            break;
+  803761:	e9 c3 fe ff ff       	jmp    803629 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803766:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80376a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80376e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803772:	eb e5                	jmp    803759 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803774:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803777:	83 f8 2f             	cmp    $0x2f,%eax
+  80377a:	77 5a                	ja     8037d6 <vprintfmt+0x1de>
+  80377c:	89 c2                	mov    %eax,%edx
+  80377e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803782:	83 c0 08             	add    $0x8,%eax
+  803785:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803788:	8b 02                	mov    (%rdx),%eax
+  80378a:	89 c1                	mov    %eax,%ecx
+  80378c:	f7 d9                	neg    %ecx
+  80378e:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803791:	83 f9 16             	cmp    $0x16,%ecx
+  803794:	7f 4e                	jg     8037e4 <vprintfmt+0x1ec>
+  803796:	48 63 c1             	movslq %ecx,%rax
+  803799:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  8037a0:	00 00 00 
+  8037a3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037a7:	48 85 c0             	test   %rax,%rax
+  8037aa:	74 38                	je     8037e4 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037ac:	48 89 c1             	mov    %rax,%rcx
+  8037af:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037b6:	00 00 00 
+  8037b9:	4c 89 ee             	mov    %r13,%rsi
+  8037bc:	4c 89 f7             	mov    %r14,%rdi
+  8037bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c4:	49 b8 bb 35 80 00 00 	movabs $0x8035bb,%r8
+  8037cb:	00 00 00 
+  8037ce:	41 ff d0             	call   *%r8
+  8037d1:	e9 53 fe ff ff       	jmp    803629 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037e2:	eb a4                	jmp    803788 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037e4:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  8037eb:	00 00 00 
+  8037ee:	4c 89 ee             	mov    %r13,%rsi
+  8037f1:	4c 89 f7             	mov    %r14,%rdi
+  8037f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f9:	49 b8 bb 35 80 00 00 	movabs $0x8035bb,%r8
+  803800:	00 00 00 
+  803803:	41 ff d0             	call   *%r8
+  803806:	e9 1e fe ff ff       	jmp    803629 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80380b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80380e:	83 f8 2f             	cmp    $0x2f,%eax
+  803811:	77 6c                	ja     80387f <vprintfmt+0x287>
+  803813:	89 c2                	mov    %eax,%edx
+  803815:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803819:	83 c0 08             	add    $0x8,%eax
+  80381c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80381f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803822:	48 85 d2             	test   %rdx,%rdx
+  803825:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  80382c:	00 00 00 
+  80382f:	48 0f 45 c2          	cmovne %rdx,%rax
+  803833:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803837:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80383b:	7e 06                	jle    803843 <vprintfmt+0x24b>
+  80383d:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803841:	75 4a                	jne    80388d <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803843:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803847:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80384b:	0f b6 00             	movzbl (%rax),%eax
+  80384e:	84 c0                	test   %al,%al
+  803850:	0f 85 9a 00 00 00    	jne    8038f0 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803856:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803859:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80385d:	85 c0                	test   %eax,%eax
+  80385f:	0f 8e c4 fd ff ff    	jle    803629 <vprintfmt+0x31>
+  803865:	4c 89 ee             	mov    %r13,%rsi
+  803868:	bf 20 00 00 00       	mov    $0x20,%edi
+  80386d:	41 ff d6             	call   *%r14
+  803870:	41 83 ec 01          	sub    $0x1,%r12d
+  803874:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803878:	75 eb                	jne    803865 <vprintfmt+0x26d>
+  80387a:	e9 aa fd ff ff       	jmp    803629 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80387f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803883:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803887:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80388b:	eb 92                	jmp    80381f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80388d:	49 63 f7             	movslq %r15d,%rsi
+  803890:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803894:	48 b8 aa 3d 80 00 00 	movabs $0x803daa,%rax
+  80389b:	00 00 00 
+  80389e:	ff d0                	call   *%rax
+  8038a0:	48 89 c2             	mov    %rax,%rdx
+  8038a3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038a6:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038a8:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038ab:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038ae:	85 c0                	test   %eax,%eax
+  8038b0:	7e 91                	jle    803843 <vprintfmt+0x24b>
+  8038b2:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038b7:	4c 89 ee             	mov    %r13,%rsi
+  8038ba:	44 89 e7             	mov    %r12d,%edi
+  8038bd:	41 ff d6             	call   *%r14
+  8038c0:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038c4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038ca:	75 eb                	jne    8038b7 <vprintfmt+0x2bf>
+  8038cc:	e9 72 ff ff ff       	jmp    803843 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038d1:	0f b6 f8             	movzbl %al,%edi
+  8038d4:	4c 89 ee             	mov    %r13,%rsi
+  8038d7:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038da:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038de:	49 83 c4 01          	add    $0x1,%r12
+  8038e2:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038e8:	84 c0                	test   %al,%al
+  8038ea:	0f 84 66 ff ff ff    	je     803856 <vprintfmt+0x25e>
+  8038f0:	45 85 ff             	test   %r15d,%r15d
+  8038f3:	78 0a                	js     8038ff <vprintfmt+0x307>
+  8038f5:	41 83 ef 01          	sub    $0x1,%r15d
+  8038f9:	0f 88 57 ff ff ff    	js     803856 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038ff:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803903:	74 cc                	je     8038d1 <vprintfmt+0x2d9>
+  803905:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803908:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80390d:	80 fa 5e             	cmp    $0x5e,%dl
+  803910:	77 c2                	ja     8038d4 <vprintfmt+0x2dc>
+  803912:	eb bd                	jmp    8038d1 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803914:	40 84 f6             	test   %sil,%sil
+  803917:	75 26                	jne    80393f <vprintfmt+0x347>
+    switch (lflag) {
+  803919:	85 d2                	test   %edx,%edx
+  80391b:	74 59                	je     803976 <vprintfmt+0x37e>
+  80391d:	83 fa 01             	cmp    $0x1,%edx
+  803920:	74 7b                	je     80399d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803922:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803925:	83 f8 2f             	cmp    $0x2f,%eax
+  803928:	0f 87 96 00 00 00    	ja     8039c4 <vprintfmt+0x3cc>
+  80392e:	89 c2                	mov    %eax,%edx
+  803930:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803934:	83 c0 08             	add    $0x8,%eax
+  803937:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80393a:	4c 8b 22             	mov    (%rdx),%r12
+  80393d:	eb 17                	jmp    803956 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80393f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803942:	83 f8 2f             	cmp    $0x2f,%eax
+  803945:	77 21                	ja     803968 <vprintfmt+0x370>
+  803947:	89 c2                	mov    %eax,%edx
+  803949:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80394d:	83 c0 08             	add    $0x8,%eax
+  803950:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803953:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803956:	4d 85 e4             	test   %r12,%r12
+  803959:	78 7a                	js     8039d5 <vprintfmt+0x3dd>
+            num = i;
+  80395b:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80395e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803963:	e9 50 02 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803968:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80396c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803970:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803974:	eb dd                	jmp    803953 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803979:	83 f8 2f             	cmp    $0x2f,%eax
+  80397c:	77 11                	ja     80398f <vprintfmt+0x397>
+  80397e:	89 c2                	mov    %eax,%edx
+  803980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803984:	83 c0 08             	add    $0x8,%eax
+  803987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80398a:	4c 63 22             	movslq (%rdx),%r12
+  80398d:	eb c7                	jmp    803956 <vprintfmt+0x35e>
+  80398f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803993:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803997:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80399b:	eb ed                	jmp    80398a <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80399d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039a0:	83 f8 2f             	cmp    $0x2f,%eax
+  8039a3:	77 11                	ja     8039b6 <vprintfmt+0x3be>
+  8039a5:	89 c2                	mov    %eax,%edx
+  8039a7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039ab:	83 c0 08             	add    $0x8,%eax
+  8039ae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039b1:	4c 8b 22             	mov    (%rdx),%r12
+  8039b4:	eb a0                	jmp    803956 <vprintfmt+0x35e>
+  8039b6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039ba:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039be:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039c2:	eb ed                	jmp    8039b1 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d0:	e9 65 ff ff ff       	jmp    80393a <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039d5:	4c 89 ee             	mov    %r13,%rsi
+  8039d8:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039dd:	41 ff d6             	call   *%r14
+                i = -i;
+  8039e0:	49 f7 dc             	neg    %r12
+  8039e3:	e9 73 ff ff ff       	jmp    80395b <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039e8:	40 84 f6             	test   %sil,%sil
+  8039eb:	75 32                	jne    803a1f <vprintfmt+0x427>
+    switch (lflag) {
+  8039ed:	85 d2                	test   %edx,%edx
+  8039ef:	74 5d                	je     803a4e <vprintfmt+0x456>
+  8039f1:	83 fa 01             	cmp    $0x1,%edx
+  8039f4:	0f 84 82 00 00 00    	je     803a7c <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8039fa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039fd:	83 f8 2f             	cmp    $0x2f,%eax
+  803a00:	0f 87 a5 00 00 00    	ja     803aab <vprintfmt+0x4b3>
+  803a06:	89 c2                	mov    %eax,%edx
+  803a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a0c:	83 c0 08             	add    $0x8,%eax
+  803a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a12:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a15:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a1a:	e9 99 01 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a22:	83 f8 2f             	cmp    $0x2f,%eax
+  803a25:	77 19                	ja     803a40 <vprintfmt+0x448>
+  803a27:	89 c2                	mov    %eax,%edx
+  803a29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a2d:	83 c0 08             	add    $0x8,%eax
+  803a30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a33:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a3b:	e9 78 01 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+  803a40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a4c:	eb e5                	jmp    803a33 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a51:	83 f8 2f             	cmp    $0x2f,%eax
+  803a54:	77 18                	ja     803a6e <vprintfmt+0x476>
+  803a56:	89 c2                	mov    %eax,%edx
+  803a58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a5c:	83 c0 08             	add    $0x8,%eax
+  803a5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a62:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a64:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a69:	e9 4a 01 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+  803a6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a7a:	eb e6                	jmp    803a62 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a7f:	83 f8 2f             	cmp    $0x2f,%eax
+  803a82:	77 19                	ja     803a9d <vprintfmt+0x4a5>
+  803a84:	89 c2                	mov    %eax,%edx
+  803a86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a8a:	83 c0 08             	add    $0x8,%eax
+  803a8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a90:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a93:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803a98:	e9 1b 01 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+  803a9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aa1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aa5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aa9:	eb e5                	jmp    803a90 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803aab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aaf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ab3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab7:	e9 56 ff ff ff       	jmp    803a12 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803abc:	40 84 f6             	test   %sil,%sil
+  803abf:	75 2e                	jne    803aef <vprintfmt+0x4f7>
+    switch (lflag) {
+  803ac1:	85 d2                	test   %edx,%edx
+  803ac3:	74 59                	je     803b1e <vprintfmt+0x526>
+  803ac5:	83 fa 01             	cmp    $0x1,%edx
+  803ac8:	74 7f                	je     803b49 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803aca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803acd:	83 f8 2f             	cmp    $0x2f,%eax
+  803ad0:	0f 87 9f 00 00 00    	ja     803b75 <vprintfmt+0x57d>
+  803ad6:	89 c2                	mov    %eax,%edx
+  803ad8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803adc:	83 c0 08             	add    $0x8,%eax
+  803adf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ae2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803ae5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803aea:	e9 c9 00 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803aef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803af2:	83 f8 2f             	cmp    $0x2f,%eax
+  803af5:	77 19                	ja     803b10 <vprintfmt+0x518>
+  803af7:	89 c2                	mov    %eax,%edx
+  803af9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803afd:	83 c0 08             	add    $0x8,%eax
+  803b00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b03:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b06:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b0b:	e9 a8 00 00 00       	jmp    803bb8 <vprintfmt+0x5c0>
+  803b10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b1c:	eb e5                	jmp    803b03 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b21:	83 f8 2f             	cmp    $0x2f,%eax
+  803b24:	77 15                	ja     803b3b <vprintfmt+0x543>
+  803b26:	89 c2                	mov    %eax,%edx
+  803b28:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b2c:	83 c0 08             	add    $0x8,%eax
+  803b2f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b32:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b34:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b39:	eb 7d                	jmp    803bb8 <vprintfmt+0x5c0>
+  803b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b47:	eb e9                	jmp    803b32 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b4c:	83 f8 2f             	cmp    $0x2f,%eax
+  803b4f:	77 16                	ja     803b67 <vprintfmt+0x56f>
+  803b51:	89 c2                	mov    %eax,%edx
+  803b53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b57:	83 c0 08             	add    $0x8,%eax
+  803b5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b5d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b60:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b65:	eb 51                	jmp    803bb8 <vprintfmt+0x5c0>
+  803b67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b73:	eb e8                	jmp    803b5d <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b81:	e9 5c ff ff ff       	jmp    803ae2 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b86:	4c 89 ee             	mov    %r13,%rsi
+  803b89:	bf 30 00 00 00       	mov    $0x30,%edi
+  803b8e:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803b91:	4c 89 ee             	mov    %r13,%rsi
+  803b94:	bf 78 00 00 00       	mov    $0x78,%edi
+  803b99:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803b9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b9f:	83 f8 2f             	cmp    $0x2f,%eax
+  803ba2:	77 47                	ja     803beb <vprintfmt+0x5f3>
+  803ba4:	89 c2                	mov    %eax,%edx
+  803ba6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803baa:	83 c0 08             	add    $0x8,%eax
+  803bad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bb0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bb3:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bb8:	48 83 ec 08          	sub    $0x8,%rsp
+  803bbc:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bc0:	0f 94 c0             	sete   %al
+  803bc3:	0f b6 c0             	movzbl %al,%eax
+  803bc6:	50                   	push   %rax
+  803bc7:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bcc:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bd0:	4c 89 ee             	mov    %r13,%rsi
+  803bd3:	4c 89 f7             	mov    %r14,%rdi
+  803bd6:	48 b8 ed 34 80 00 00 	movabs $0x8034ed,%rax
+  803bdd:	00 00 00 
+  803be0:	ff d0                	call   *%rax
+            break;
+  803be2:	48 83 c4 10          	add    $0x10,%rsp
+  803be6:	e9 3e fa ff ff       	jmp    803629 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803beb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bf3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf7:	eb b7                	jmp    803bb0 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803bf9:	40 84 f6             	test   %sil,%sil
+  803bfc:	75 2b                	jne    803c29 <vprintfmt+0x631>
+    switch (lflag) {
+  803bfe:	85 d2                	test   %edx,%edx
+  803c00:	74 56                	je     803c58 <vprintfmt+0x660>
+  803c02:	83 fa 01             	cmp    $0x1,%edx
+  803c05:	74 7f                	je     803c86 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c0a:	83 f8 2f             	cmp    $0x2f,%eax
+  803c0d:	0f 87 a2 00 00 00    	ja     803cb5 <vprintfmt+0x6bd>
+  803c13:	89 c2                	mov    %eax,%edx
+  803c15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c19:	83 c0 08             	add    $0x8,%eax
+  803c1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c27:	eb 8f                	jmp    803bb8 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c2c:	83 f8 2f             	cmp    $0x2f,%eax
+  803c2f:	77 19                	ja     803c4a <vprintfmt+0x652>
+  803c31:	89 c2                	mov    %eax,%edx
+  803c33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c37:	83 c0 08             	add    $0x8,%eax
+  803c3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c3d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c40:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c45:	e9 6e ff ff ff       	jmp    803bb8 <vprintfmt+0x5c0>
+  803c4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c56:	eb e5                	jmp    803c3d <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c5b:	83 f8 2f             	cmp    $0x2f,%eax
+  803c5e:	77 18                	ja     803c78 <vprintfmt+0x680>
+  803c60:	89 c2                	mov    %eax,%edx
+  803c62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c66:	83 c0 08             	add    $0x8,%eax
+  803c69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c6c:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c6e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c73:	e9 40 ff ff ff       	jmp    803bb8 <vprintfmt+0x5c0>
+  803c78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c84:	eb e6                	jmp    803c6c <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c89:	83 f8 2f             	cmp    $0x2f,%eax
+  803c8c:	77 19                	ja     803ca7 <vprintfmt+0x6af>
+  803c8e:	89 c2                	mov    %eax,%edx
+  803c90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c94:	83 c0 08             	add    $0x8,%eax
+  803c97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803ca2:	e9 11 ff ff ff       	jmp    803bb8 <vprintfmt+0x5c0>
+  803ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cb3:	eb e5                	jmp    803c9a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cb5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cbd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc1:	e9 59 ff ff ff       	jmp    803c1f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cc6:	4c 89 ee             	mov    %r13,%rsi
+  803cc9:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cce:	41 ff d6             	call   *%r14
+            break;
+  803cd1:	e9 53 f9 ff ff       	jmp    803629 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cd6:	4c 89 ee             	mov    %r13,%rsi
+  803cd9:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cde:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803ce1:	48 83 eb 01          	sub    $0x1,%rbx
+  803ce5:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803ce9:	75 f6                	jne    803ce1 <vprintfmt+0x6e9>
+  803ceb:	e9 39 f9 ff ff       	jmp    803629 <vprintfmt+0x31>
+}
+  803cf0:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803cf4:	5b                   	pop    %rbx
+  803cf5:	41 5c                	pop    %r12
+  803cf7:	41 5d                	pop    %r13
+  803cf9:	41 5e                	pop    %r14
+  803cfb:	41 5f                	pop    %r15
+  803cfd:	5d                   	pop    %rbp
+  803cfe:	c3                   	ret
+
+0000000000803cff <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803cff:	55                   	push   %rbp
+  803d00:	48 89 e5             	mov    %rsp,%rbp
+  803d03:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d07:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d0b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d10:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d14:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d1b:	48 85 ff             	test   %rdi,%rdi
+  803d1e:	74 2b                	je     803d4b <vsnprintf+0x4c>
+  803d20:	48 85 f6             	test   %rsi,%rsi
+  803d23:	74 26                	je     803d4b <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d29:	48 bf a3 35 80 00 00 	movabs $0x8035a3,%rdi
+  803d30:	00 00 00 
+  803d33:	48 b8 f8 35 80 00 00 	movabs $0x8035f8,%rax
+  803d3a:	00 00 00 
+  803d3d:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d3f:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d43:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d46:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d49:	c9                   	leave
+  803d4a:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d4b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d50:	eb f7                	jmp    803d49 <vsnprintf+0x4a>
+
+0000000000803d52 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d52:	55                   	push   %rbp
+  803d53:	48 89 e5             	mov    %rsp,%rbp
+  803d56:	48 83 ec 50          	sub    $0x50,%rsp
+  803d5a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d5e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d62:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d66:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d6d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d75:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d79:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d7d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d81:	48 b8 ff 3c 80 00 00 	movabs $0x803cff,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803d8d:	c9                   	leave
+  803d8e:	c3                   	ret
+
+0000000000803d8f <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803d8f:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803d92:	74 10                	je     803da4 <strlen+0x15>
+    size_t n = 0;
+  803d94:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803d99:	48 83 c0 01          	add    $0x1,%rax
+  803d9d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803da1:	75 f6                	jne    803d99 <strlen+0xa>
+  803da3:	c3                   	ret
+    size_t n = 0;
+  803da4:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803da9:	c3                   	ret
+
+0000000000803daa <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803daa:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803dad:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803db2:	48 85 f6             	test   %rsi,%rsi
+  803db5:	74 11                	je     803dc8 <strnlen+0x1e>
+  803db7:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dbb:	74 0c                	je     803dc9 <strnlen+0x1f>
+  803dbd:	48 83 c2 01          	add    $0x1,%rdx
+  803dc1:	48 39 d0             	cmp    %rdx,%rax
+  803dc4:	75 f1                	jne    803db7 <strnlen+0xd>
+  803dc6:	eb 04                	jmp    803dcc <strnlen+0x22>
+  803dc8:	c3                   	ret
+  803dc9:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803dcc:	c3                   	ret
+
+0000000000803dcd <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dcd:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd5:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dd9:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803ddc:	48 83 c2 01          	add    $0x1,%rdx
+  803de0:	84 c9                	test   %cl,%cl
+  803de2:	75 f1                	jne    803dd5 <strcpy+0x8>
+        ;
+    return res;
+}
+  803de4:	c3                   	ret
+
+0000000000803de5 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803de5:	55                   	push   %rbp
+  803de6:	48 89 e5             	mov    %rsp,%rbp
+  803de9:	41 54                	push   %r12
+  803deb:	53                   	push   %rbx
+  803dec:	48 89 fb             	mov    %rdi,%rbx
+  803def:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803df2:	48 b8 8f 3d 80 00 00 	movabs $0x803d8f,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803dfe:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e02:	4c 89 e6             	mov    %r12,%rsi
+  803e05:	48 b8 cd 3d 80 00 00 	movabs $0x803dcd,%rax
+  803e0c:	00 00 00 
+  803e0f:	ff d0                	call   *%rax
+    return dst;
+}
+  803e11:	48 89 d8             	mov    %rbx,%rax
+  803e14:	5b                   	pop    %rbx
+  803e15:	41 5c                	pop    %r12
+  803e17:	5d                   	pop    %rbp
+  803e18:	c3                   	ret
+
+0000000000803e19 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e19:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e1c:	48 85 d2             	test   %rdx,%rdx
+  803e1f:	74 1f                	je     803e40 <strncpy+0x27>
+  803e21:	48 01 fa             	add    %rdi,%rdx
+  803e24:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e27:	48 83 c1 01          	add    $0x1,%rcx
+  803e2b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e2f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e33:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e37:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e3b:	48 39 ca             	cmp    %rcx,%rdx
+  803e3e:	75 e7                	jne    803e27 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e40:	c3                   	ret
+
+0000000000803e41 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e41:	48 89 f8             	mov    %rdi,%rax
+  803e44:	48 85 d2             	test   %rdx,%rdx
+  803e47:	74 24                	je     803e6d <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e49:	48 83 ea 01          	sub    $0x1,%rdx
+  803e4d:	74 1b                	je     803e6a <strlcpy+0x29>
+  803e4f:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e53:	0f b6 16             	movzbl (%rsi),%edx
+  803e56:	84 d2                	test   %dl,%dl
+  803e58:	74 10                	je     803e6a <strlcpy+0x29>
+            *dst++ = *src++;
+  803e5a:	48 83 c6 01          	add    $0x1,%rsi
+  803e5e:	48 83 c0 01          	add    $0x1,%rax
+  803e62:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e65:	48 39 c8             	cmp    %rcx,%rax
+  803e68:	75 e9                	jne    803e53 <strlcpy+0x12>
+        *dst = '\0';
+  803e6a:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e6d:	48 29 f8             	sub    %rdi,%rax
+}
+  803e70:	c3                   	ret
+
+0000000000803e71 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e71:	0f b6 07             	movzbl (%rdi),%eax
+  803e74:	84 c0                	test   %al,%al
+  803e76:	74 13                	je     803e8b <strcmp+0x1a>
+  803e78:	38 06                	cmp    %al,(%rsi)
+  803e7a:	75 0f                	jne    803e8b <strcmp+0x1a>
+  803e7c:	48 83 c7 01          	add    $0x1,%rdi
+  803e80:	48 83 c6 01          	add    $0x1,%rsi
+  803e84:	0f b6 07             	movzbl (%rdi),%eax
+  803e87:	84 c0                	test   %al,%al
+  803e89:	75 ed                	jne    803e78 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803e8b:	0f b6 c0             	movzbl %al,%eax
+  803e8e:	0f b6 16             	movzbl (%rsi),%edx
+  803e91:	29 d0                	sub    %edx,%eax
+}
+  803e93:	c3                   	ret
+
+0000000000803e94 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803e94:	48 85 d2             	test   %rdx,%rdx
+  803e97:	74 1f                	je     803eb8 <strncmp+0x24>
+  803e99:	0f b6 07             	movzbl (%rdi),%eax
+  803e9c:	84 c0                	test   %al,%al
+  803e9e:	74 1e                	je     803ebe <strncmp+0x2a>
+  803ea0:	3a 06                	cmp    (%rsi),%al
+  803ea2:	75 1a                	jne    803ebe <strncmp+0x2a>
+  803ea4:	48 83 c7 01          	add    $0x1,%rdi
+  803ea8:	48 83 c6 01          	add    $0x1,%rsi
+  803eac:	48 83 ea 01          	sub    $0x1,%rdx
+  803eb0:	75 e7                	jne    803e99 <strncmp+0x5>
+
+    if (!n) return 0;
+  803eb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb7:	c3                   	ret
+  803eb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebd:	c3                   	ret
+  803ebe:	48 85 d2             	test   %rdx,%rdx
+  803ec1:	74 09                	je     803ecc <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ec3:	0f b6 07             	movzbl (%rdi),%eax
+  803ec6:	0f b6 16             	movzbl (%rsi),%edx
+  803ec9:	29 d0                	sub    %edx,%eax
+  803ecb:	c3                   	ret
+    if (!n) return 0;
+  803ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed1:	c3                   	ret
+
+0000000000803ed2 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ed2:	0f b6 17             	movzbl (%rdi),%edx
+  803ed5:	84 d2                	test   %dl,%dl
+  803ed7:	74 18                	je     803ef1 <strchr+0x1f>
+        if (*str == c) {
+  803ed9:	0f be d2             	movsbl %dl,%edx
+  803edc:	39 f2                	cmp    %esi,%edx
+  803ede:	74 17                	je     803ef7 <strchr+0x25>
+    for (; *str; str++) {
+  803ee0:	48 83 c7 01          	add    $0x1,%rdi
+  803ee4:	0f b6 17             	movzbl (%rdi),%edx
+  803ee7:	84 d2                	test   %dl,%dl
+  803ee9:	75 ee                	jne    803ed9 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803eeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef0:	c3                   	ret
+  803ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef6:	c3                   	ret
+  803ef7:	48 89 f8             	mov    %rdi,%rax
+}
+  803efa:	c3                   	ret
+
+0000000000803efb <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803efb:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803efe:	0f b6 17             	movzbl (%rdi),%edx
+  803f01:	84 d2                	test   %dl,%dl
+  803f03:	74 13                	je     803f18 <strfind+0x1d>
+  803f05:	0f be d2             	movsbl %dl,%edx
+  803f08:	39 f2                	cmp    %esi,%edx
+  803f0a:	74 0b                	je     803f17 <strfind+0x1c>
+  803f0c:	48 83 c0 01          	add    $0x1,%rax
+  803f10:	0f b6 10             	movzbl (%rax),%edx
+  803f13:	84 d2                	test   %dl,%dl
+  803f15:	75 ee                	jne    803f05 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f17:	c3                   	ret
+  803f18:	c3                   	ret
+
+0000000000803f19 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f19:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f1c:	48 89 f8             	mov    %rdi,%rax
+  803f1f:	48 f7 d8             	neg    %rax
+  803f22:	83 e0 07             	and    $0x7,%eax
+  803f25:	49 89 d1             	mov    %rdx,%r9
+  803f28:	49 29 c1             	sub    %rax,%r9
+  803f2b:	78 36                	js     803f63 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f2d:	40 0f b6 c6          	movzbl %sil,%eax
+  803f31:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f38:	01 01 01 
+  803f3b:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f3f:	40 f6 c7 07          	test   $0x7,%dil
+  803f43:	75 38                	jne    803f7d <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f45:	4c 89 c9             	mov    %r9,%rcx
+  803f48:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f4c:	74 0c                	je     803f5a <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f4e:	fc                   	cld
+  803f4f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f52:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f56:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f5a:	4d 85 c9             	test   %r9,%r9
+  803f5d:	75 45                	jne    803fa4 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f5f:	4c 89 c0             	mov    %r8,%rax
+  803f62:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f63:	48 85 d2             	test   %rdx,%rdx
+  803f66:	74 f7                	je     803f5f <memset+0x46>
+  803f68:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f6b:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f6e:	48 83 c0 01          	add    $0x1,%rax
+  803f72:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f76:	48 39 c2             	cmp    %rax,%rdx
+  803f79:	75 f3                	jne    803f6e <memset+0x55>
+  803f7b:	eb e2                	jmp    803f5f <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f7d:	40 f6 c7 01          	test   $0x1,%dil
+  803f81:	74 06                	je     803f89 <memset+0x70>
+  803f83:	88 07                	mov    %al,(%rdi)
+  803f85:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f89:	40 f6 c7 02          	test   $0x2,%dil
+  803f8d:	74 07                	je     803f96 <memset+0x7d>
+  803f8f:	66 89 07             	mov    %ax,(%rdi)
+  803f92:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803f96:	40 f6 c7 04          	test   $0x4,%dil
+  803f9a:	74 a9                	je     803f45 <memset+0x2c>
+  803f9c:	89 07                	mov    %eax,(%rdi)
+  803f9e:	48 83 c7 04          	add    $0x4,%rdi
+  803fa2:	eb a1                	jmp    803f45 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fa4:	41 f6 c1 04          	test   $0x4,%r9b
+  803fa8:	74 06                	je     803fb0 <memset+0x97>
+  803faa:	89 07                	mov    %eax,(%rdi)
+  803fac:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fb0:	41 f6 c1 02          	test   $0x2,%r9b
+  803fb4:	74 07                	je     803fbd <memset+0xa4>
+  803fb6:	66 89 07             	mov    %ax,(%rdi)
+  803fb9:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fbd:	41 f6 c1 01          	test   $0x1,%r9b
+  803fc1:	74 9c                	je     803f5f <memset+0x46>
+  803fc3:	88 07                	mov    %al,(%rdi)
+  803fc5:	eb 98                	jmp    803f5f <memset+0x46>
+
+0000000000803fc7 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fc7:	48 89 f8             	mov    %rdi,%rax
+  803fca:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fcd:	48 39 fe             	cmp    %rdi,%rsi
+  803fd0:	73 3b                	jae    80400d <memmove+0x46>
+  803fd2:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803fd6:	48 39 d7             	cmp    %rdx,%rdi
+  803fd9:	73 32                	jae    80400d <memmove+0x46>
+        s += n;
+        d += n;
+  803fdb:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803fdf:	48 89 d6             	mov    %rdx,%rsi
+  803fe2:	48 09 fe             	or     %rdi,%rsi
+  803fe5:	48 09 ce             	or     %rcx,%rsi
+  803fe8:	40 f6 c6 07          	test   $0x7,%sil
+  803fec:	75 12                	jne    804000 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803fee:	48 83 ef 08          	sub    $0x8,%rdi
+  803ff2:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803ff6:	48 c1 e9 03          	shr    $0x3,%rcx
+  803ffa:	fd                   	std
+  803ffb:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803ffe:	fc                   	cld
+  803fff:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804000:	48 83 ef 01          	sub    $0x1,%rdi
+  804004:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804008:	fd                   	std
+  804009:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80400b:	eb f1                	jmp    803ffe <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80400d:	48 89 f2             	mov    %rsi,%rdx
+  804010:	48 09 c2             	or     %rax,%rdx
+  804013:	48 09 ca             	or     %rcx,%rdx
+  804016:	f6 c2 07             	test   $0x7,%dl
+  804019:	75 0c                	jne    804027 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80401b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80401f:	48 89 c7             	mov    %rax,%rdi
+  804022:	fc                   	cld
+  804023:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804026:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804027:	48 89 c7             	mov    %rax,%rdi
+  80402a:	fc                   	cld
+  80402b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80402d:	c3                   	ret
+
+000000000080402e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80402e:	55                   	push   %rbp
+  80402f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  804032:	48 b8 c7 3f 80 00 00 	movabs $0x803fc7,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+}
+  80403e:	5d                   	pop    %rbp
+  80403f:	c3                   	ret
+
+0000000000804040 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804040:	55                   	push   %rbp
+  804041:	48 89 e5             	mov    %rsp,%rbp
+  804044:	41 57                	push   %r15
+  804046:	41 56                	push   %r14
+  804048:	41 55                	push   %r13
+  80404a:	41 54                	push   %r12
+  80404c:	53                   	push   %rbx
+  80404d:	48 83 ec 08          	sub    $0x8,%rsp
+  804051:	49 89 fe             	mov    %rdi,%r14
+  804054:	49 89 f7             	mov    %rsi,%r15
+  804057:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80405a:	48 89 f7             	mov    %rsi,%rdi
+  80405d:	48 b8 8f 3d 80 00 00 	movabs $0x803d8f,%rax
+  804064:	00 00 00 
+  804067:	ff d0                	call   *%rax
+  804069:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80406c:	48 89 de             	mov    %rbx,%rsi
+  80406f:	4c 89 f7             	mov    %r14,%rdi
+  804072:	48 b8 aa 3d 80 00 00 	movabs $0x803daa,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  804081:	48 39 c3             	cmp    %rax,%rbx
+  804084:	74 36                	je     8040bc <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  804086:	48 89 d8             	mov    %rbx,%rax
+  804089:	4c 29 e8             	sub    %r13,%rax
+  80408c:	49 39 c4             	cmp    %rax,%r12
+  80408f:	73 31                	jae    8040c2 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  804091:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  804096:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80409a:	4c 89 fe             	mov    %r15,%rsi
+  80409d:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  8040a4:	00 00 00 
+  8040a7:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040a9:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040ad:	48 83 c4 08          	add    $0x8,%rsp
+  8040b1:	5b                   	pop    %rbx
+  8040b2:	41 5c                	pop    %r12
+  8040b4:	41 5d                	pop    %r13
+  8040b6:	41 5e                	pop    %r14
+  8040b8:	41 5f                	pop    %r15
+  8040ba:	5d                   	pop    %rbp
+  8040bb:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040bc:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040c0:	eb eb                	jmp    8040ad <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040c2:	48 83 eb 01          	sub    $0x1,%rbx
+  8040c6:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040ca:	48 89 da             	mov    %rbx,%rdx
+  8040cd:	4c 89 fe             	mov    %r15,%rsi
+  8040d0:	48 b8 2e 40 80 00 00 	movabs $0x80402e,%rax
+  8040d7:	00 00 00 
+  8040da:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040dc:	49 01 de             	add    %rbx,%r14
+  8040df:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040e4:	eb c3                	jmp    8040a9 <strlcat+0x69>
+
+00000000008040e6 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040e6:	48 85 d2             	test   %rdx,%rdx
+  8040e9:	74 2d                	je     804118 <memcmp+0x32>
+  8040eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8040f0:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8040f4:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8040f9:	44 38 c1             	cmp    %r8b,%cl
+  8040fc:	75 0f                	jne    80410d <memcmp+0x27>
+    while (n-- > 0) {
+  8040fe:	48 83 c0 01          	add    $0x1,%rax
+  804102:	48 39 c2             	cmp    %rax,%rdx
+  804105:	75 e9                	jne    8040f0 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804107:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80410d:	0f b6 c1             	movzbl %cl,%eax
+  804110:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804114:	44 29 c0             	sub    %r8d,%eax
+  804117:	c3                   	ret
+    return 0;
+  804118:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80411d:	c3                   	ret
+
+000000000080411e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80411e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804122:	48 39 c7             	cmp    %rax,%rdi
+  804125:	73 0f                	jae    804136 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804127:	40 38 37             	cmp    %sil,(%rdi)
+  80412a:	74 0e                	je     80413a <memfind+0x1c>
+    for (; src < end; src++) {
+  80412c:	48 83 c7 01          	add    $0x1,%rdi
+  804130:	48 39 f8             	cmp    %rdi,%rax
+  804133:	75 f2                	jne    804127 <memfind+0x9>
+  804135:	c3                   	ret
+  804136:	48 89 f8             	mov    %rdi,%rax
+  804139:	c3                   	ret
+  80413a:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80413d:	c3                   	ret
+
+000000000080413e <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80413e:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  804141:	0f b6 37             	movzbl (%rdi),%esi
+  804144:	40 80 fe 20          	cmp    $0x20,%sil
+  804148:	74 06                	je     804150 <strtol+0x12>
+  80414a:	40 80 fe 09          	cmp    $0x9,%sil
+  80414e:	75 13                	jne    804163 <strtol+0x25>
+  804150:	48 83 c7 01          	add    $0x1,%rdi
+  804154:	0f b6 37             	movzbl (%rdi),%esi
+  804157:	40 80 fe 20          	cmp    $0x20,%sil
+  80415b:	74 f3                	je     804150 <strtol+0x12>
+  80415d:	40 80 fe 09          	cmp    $0x9,%sil
+  804161:	74 ed                	je     804150 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  804163:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804166:	83 e0 fd             	and    $0xfffffffd,%eax
+  804169:	3c 01                	cmp    $0x1,%al
+  80416b:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80416f:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  804175:	75 0f                	jne    804186 <strtol+0x48>
+  804177:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80417a:	74 14                	je     804190 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80417c:	85 d2                	test   %edx,%edx
+  80417e:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804183:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  804186:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80418b:	4c 63 ca             	movslq %edx,%r9
+  80418e:	eb 36                	jmp    8041c6 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804190:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  804194:	74 0f                	je     8041a5 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  804196:	85 d2                	test   %edx,%edx
+  804198:	75 ec                	jne    804186 <strtol+0x48>
+        s++;
+  80419a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80419e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041a3:	eb e1                	jmp    804186 <strtol+0x48>
+        s += 2;
+  8041a5:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041a9:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041ae:	eb d6                	jmp    804186 <strtol+0x48>
+            dig -= '0';
+  8041b0:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041b3:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041b7:	41 39 d0             	cmp    %edx,%r8d
+  8041ba:	7d 21                	jge    8041dd <strtol+0x9f>
+        val = val * base + dig;
+  8041bc:	49 0f af c1          	imul   %r9,%rax
+  8041c0:	0f b6 c9             	movzbl %cl,%ecx
+  8041c3:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041c6:	48 83 c7 01          	add    $0x1,%rdi
+  8041ca:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041ce:	80 f9 39             	cmp    $0x39,%cl
+  8041d1:	76 dd                	jbe    8041b0 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041d3:	80 f9 7b             	cmp    $0x7b,%cl
+  8041d6:	77 05                	ja     8041dd <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041d8:	83 e9 57             	sub    $0x57,%ecx
+  8041db:	eb d6                	jmp    8041b3 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041dd:	4d 85 d2             	test   %r10,%r10
+  8041e0:	74 03                	je     8041e5 <strtol+0xa7>
+  8041e2:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041e5:	48 89 c2             	mov    %rax,%rdx
+  8041e8:	48 f7 da             	neg    %rdx
+  8041eb:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8041ef:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8041f3:	c3                   	ret
+
+00000000008041f4 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8041f4:	55                   	push   %rbp
+  8041f5:	48 89 e5             	mov    %rsp,%rbp
+  8041f8:	41 56                	push   %r14
+  8041fa:	41 55                	push   %r13
+  8041fc:	41 54                	push   %r12
+  8041fe:	53                   	push   %rbx
+  8041ff:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804202:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804209:	00 00 00 
+  80420c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804210:	74 27                	je     804239 <_handle_vectored_pagefault+0x45>
+  804212:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804217:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80421e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804221:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804224:	4c 89 e7             	mov    %r12,%rdi
+  804227:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80422c:	84 c0                	test   %al,%al
+  80422e:	75 45                	jne    804275 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804230:	48 83 c3 01          	add    $0x1,%rbx
+  804234:	49 3b 1e             	cmp    (%r14),%rbx
+  804237:	72 eb                	jb     804224 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804239:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804240:	00 
+  804241:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804246:	4d 8b 04 24          	mov    (%r12),%r8
+  80424a:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  804251:	00 00 00 
+  804254:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804259:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804260:	00 00 00 
+  804263:	b8 00 00 00 00       	mov    $0x0,%eax
+  804268:	49 ba 58 33 80 00 00 	movabs $0x803358,%r10
+  80426f:	00 00 00 
+  804272:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804275:	5b                   	pop    %rbx
+  804276:	41 5c                	pop    %r12
+  804278:	41 5d                	pop    %r13
+  80427a:	41 5e                	pop    %r14
+  80427c:	5d                   	pop    %rbp
+  80427d:	c3                   	ret
+
+000000000080427e <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80427e:	55                   	push   %rbp
+  80427f:	48 89 e5             	mov    %rsp,%rbp
+  804282:	53                   	push   %rbx
+  804283:	48 83 ec 08          	sub    $0x8,%rsp
+  804287:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80428a:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804291:	00 00 00 
+  804294:	80 38 00             	cmpb   $0x0,(%rax)
+  804297:	0f 84 84 00 00 00    	je     804321 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80429d:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042a4:	00 00 00 
+  8042a7:	48 8b 10             	mov    (%rax),%rdx
+  8042aa:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042af:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042b6:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042b9:	48 85 d2             	test   %rdx,%rdx
+  8042bc:	74 19                	je     8042d7 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042be:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042c2:	0f 84 e8 00 00 00    	je     8043b0 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c8:	48 83 c0 01          	add    $0x1,%rax
+  8042cc:	48 39 d0             	cmp    %rdx,%rax
+  8042cf:	75 ed                	jne    8042be <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042d1:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042d5:	74 1c                	je     8042f3 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042d7:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042db:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042e2:	00 00 00 
+  8042e5:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8042ec:	00 00 00 
+  8042ef:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8042f3:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  8042fa:	00 00 00 
+  8042fd:	ff d0                	call   *%rax
+  8042ff:	89 c7                	mov    %eax,%edi
+  804301:	48 be 76 44 80 00 00 	movabs $0x804476,%rsi
+  804308:	00 00 00 
+  80430b:	48 b8 f8 03 80 00 00 	movabs $0x8003f8,%rax
+  804312:	00 00 00 
+  804315:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804317:	85 c0                	test   %eax,%eax
+  804319:	78 68                	js     804383 <add_pgfault_handler+0x105>
+    return res;
+}
+  80431b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80431f:	c9                   	leave
+  804320:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804321:	48 b8 ad 01 80 00 00 	movabs $0x8001ad,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+  80432d:	89 c7                	mov    %eax,%edi
+  80432f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804334:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804339:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804340:	00 00 00 
+  804343:	48 b8 3a 02 80 00 00 	movabs $0x80023a,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80434f:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804356:	00 00 00 
+  804359:	48 8b 02             	mov    (%rdx),%rax
+  80435c:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804360:	48 89 0a             	mov    %rcx,(%rdx)
+  804363:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80436a:	00 00 00 
+  80436d:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804371:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804378:	00 00 00 
+  80437b:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80437e:	e9 70 ff ff ff       	jmp    8042f3 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804383:	89 c1                	mov    %eax,%ecx
+  804385:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  80438c:	00 00 00 
+  80438f:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804394:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80439b:	00 00 00 
+  80439e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a3:	49 b8 58 33 80 00 00 	movabs $0x803358,%r8
+  8043aa:	00 00 00 
+  8043ad:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b5:	e9 61 ff ff ff       	jmp    80431b <add_pgfault_handler+0x9d>
+
+00000000008043ba <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043ba:	55                   	push   %rbp
+  8043bb:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043be:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043c5:	00 00 00 
+  8043c8:	80 38 00             	cmpb   $0x0,(%rax)
+  8043cb:	74 33                	je     804400 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043cd:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043d4:	00 00 00 
+  8043d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043dc:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043e3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043e6:	48 85 c0             	test   %rax,%rax
+  8043e9:	0f 84 85 00 00 00    	je     804474 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8043ef:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8043f3:	74 40                	je     804435 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f5:	48 83 c1 01          	add    $0x1,%rcx
+  8043f9:	48 39 c1             	cmp    %rax,%rcx
+  8043fc:	75 f1                	jne    8043ef <remove_pgfault_handler+0x35>
+  8043fe:	eb 74                	jmp    804474 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804400:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  804407:	00 00 00 
+  80440a:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  804411:	00 00 00 
+  804414:	be 43 00 00 00       	mov    $0x43,%esi
+  804419:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804420:	00 00 00 
+  804423:	b8 00 00 00 00       	mov    $0x0,%eax
+  804428:	49 b8 58 33 80 00 00 	movabs $0x803358,%r8
+  80442f:	00 00 00 
+  804432:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804435:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80443c:	00 
+  80443d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804441:	48 29 ca             	sub    %rcx,%rdx
+  804444:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80444b:	00 00 00 
+  80444e:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804452:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804457:	48 89 ce             	mov    %rcx,%rsi
+  80445a:	48 b8 c7 3f 80 00 00 	movabs $0x803fc7,%rax
+  804461:	00 00 00 
+  804464:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804466:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80446d:	00 00 00 
+  804470:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804474:	5d                   	pop    %rbp
+  804475:	c3                   	ret
+
+0000000000804476 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804476:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804479:	48 b8 f4 41 80 00 00 	movabs $0x8041f4,%rax
+  804480:	00 00 00 
+    call *%rax
+  804483:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804485:	41 5f                	pop    %r15
+	popq %r15
+  804487:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804489:	41 5f                	pop    %r15
+	popq %r14
+  80448b:	41 5e                	pop    %r14
+	popq %r13
+  80448d:	41 5d                	pop    %r13
+	popq %r12
+  80448f:	41 5c                	pop    %r12
+	popq %r11
+  804491:	41 5b                	pop    %r11
+	popq %r10
+  804493:	41 5a                	pop    %r10
+	popq %r9
+  804495:	41 59                	pop    %r9
+	popq %r8
+  804497:	41 58                	pop    %r8
+	popq %rsi
+  804499:	5e                   	pop    %rsi
+	popq %rdi
+  80449a:	5f                   	pop    %rdi
+	popq %rbp
+  80449b:	5d                   	pop    %rbp
+	popq %rdx
+  80449c:	5a                   	pop    %rdx
+	popq %rcx
+  80449d:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80449e:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044a3:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044a8:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044ac:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044af:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044b4:	5b                   	pop    %rbx
+	popq %rax
+  8044b5:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044b6:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044ba:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044bb:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044c0:	c3                   	ret
+
+00000000008044c1 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044c1:	55                   	push   %rbp
+  8044c2:	48 89 e5             	mov    %rsp,%rbp
+  8044c5:	41 55                	push   %r13
+  8044c7:	41 54                	push   %r12
+  8044c9:	53                   	push   %rbx
+  8044ca:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ce:	49 89 fd             	mov    %rdi,%r13
+  8044d1:	48 89 f7             	mov    %rsi,%rdi
+  8044d4:	48 89 d3             	mov    %rdx,%rbx
+  8044d7:	49 89 cc             	mov    %rcx,%r12
+  8044da:	4c 89 c2             	mov    %r8,%rdx
+  8044dd:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044e0:	48 85 f6             	test   %rsi,%rsi
+  8044e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044ea:	00 00 00 
+  8044ed:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8044f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044f6:	48 85 db             	test   %rbx,%rbx
+  8044f9:	74 03                	je     8044fe <ipc_recv_futex+0x3d>
+  8044fb:	48 8b 33             	mov    (%rbx),%rsi
+  8044fe:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804502:	48 b8 84 04 80 00 00 	movabs $0x800484,%rax
+  804509:	00 00 00 
+  80450c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80450e:	85 c0                	test   %eax,%eax
+  804510:	78 75                	js     804587 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804512:	4d 85 ed             	test   %r13,%r13
+  804515:	74 14                	je     80452b <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804517:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80451e:	00 00 00 
+  804521:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804527:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80452b:	4d 85 e4             	test   %r12,%r12
+  80452e:	74 14                	je     804544 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804530:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804537:	00 00 00 
+  80453a:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804540:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804544:	48 85 db             	test   %rbx,%rbx
+  804547:	74 23                	je     80456c <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804549:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804550:	00 00 00 
+  804553:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804559:	ba 00 00 00 00       	mov    $0x0,%edx
+  80455e:	85 c9                	test   %ecx,%ecx
+  804560:	74 07                	je     804569 <ipc_recv_futex+0xa8>
+  804562:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804569:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80456c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804573:	00 00 00 
+  804576:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80457c:	48 83 c4 08          	add    $0x8,%rsp
+  804580:	5b                   	pop    %rbx
+  804581:	41 5c                	pop    %r12
+  804583:	41 5d                	pop    %r13
+  804585:	5d                   	pop    %rbp
+  804586:	c3                   	ret
+        if (from_env_store != NULL) {
+  804587:	4d 85 ed             	test   %r13,%r13
+  80458a:	74 08                	je     804594 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80458c:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804593:	00 
+        if (perm_store != NULL) {
+  804594:	4d 85 e4             	test   %r12,%r12
+  804597:	74 08                	je     8045a1 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804599:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045a0:	00 
+        if (size != NULL) {
+  8045a1:	48 85 db             	test   %rbx,%rbx
+  8045a4:	74 d6                	je     80457c <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045a6:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045ad:	eb cd                	jmp    80457c <ipc_recv_futex+0xbb>
+
+00000000008045af <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045af:	55                   	push   %rbp
+  8045b0:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045b7:	6a 00                	push   $0x0
+  8045b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045c5:	48 b8 c1 44 80 00 00 	movabs $0x8044c1,%rax
+  8045cc:	00 00 00 
+  8045cf:	ff d0                	call   *%rax
+}
+  8045d1:	c9                   	leave
+  8045d2:	c3                   	ret
+
+00000000008045d3 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045d3:	55                   	push   %rbp
+  8045d4:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045d7:	48 85 d2             	test   %rdx,%rdx
+  8045da:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045e1:	00 00 00 
+  8045e4:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045e8:	89 f6                	mov    %esi,%esi
+  8045ea:	48 b8 6d 04 80 00 00 	movabs $0x80046d,%rax
+  8045f1:	00 00 00 
+  8045f4:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045f6:	85 c0                	test   %eax,%eax
+  8045f8:	78 02                	js     8045fc <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8045fa:	5d                   	pop    %rbp
+  8045fb:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8045fc:	89 c1                	mov    %eax,%ecx
+  8045fe:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  804605:	00 00 00 
+  804608:	be 50 00 00 00       	mov    $0x50,%esi
+  80460d:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  804614:	00 00 00 
+  804617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461c:	49 b8 58 33 80 00 00 	movabs $0x803358,%r8
+  804623:	00 00 00 
+  804626:	41 ff d0             	call   *%r8
+
+0000000000804629 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804629:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80462e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804635:	00 00 00 
+  804638:	48 89 d0             	mov    %rdx,%rax
+  80463b:	48 c1 e0 04          	shl    $0x4,%rax
+  80463f:	48 29 d0             	sub    %rdx,%rax
+  804642:	48 c1 e0 05          	shl    $0x5,%rax
+  804646:	48 01 c8             	add    %rcx,%rax
+  804649:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80464f:	39 f8                	cmp    %edi,%eax
+  804651:	74 13                	je     804666 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804653:	48 83 c2 01          	add    $0x1,%rdx
+  804657:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80465e:	75 d8                	jne    804638 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804660:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804665:	c3                   	ret
+            return envs[i].env_id;
+  804666:	48 89 d0             	mov    %rdx,%rax
+  804669:	48 c1 e0 04          	shl    $0x4,%rax
+  80466d:	48 29 d0             	sub    %rdx,%rax
+  804670:	48 c1 e0 05          	shl    $0x5,%rax
+  804674:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80467b:	00 00 00 
+  80467e:	48 01 d0             	add    %rdx,%rax
+  804681:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804687:	c3                   	ret
+
+0000000000804688 <__rodata_start>:
+  804688:	3c 75                	cmp    $0x75,%al
+  80468a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80468b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80468f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804690:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  804694:	1f                   	(bad)
+  804695:	44 00 00             	add    %r8b,(%rax)
+  804698:	73 79                	jae    804713 <__rodata_start+0x8b>
+  80469a:	73 63                	jae    8046ff <__rodata_start+0x77>
+  80469c:	61                   	(bad)
+  80469d:	6c                   	insb   (%dx),%es:(%rdi)
+  80469e:	6c                   	insb   (%dx),%es:(%rdi)
+  80469f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab1f <__bss_end+0x721c8b1f>
+  8046a5:	65 74 75             	gs je  80471d <__rodata_start+0x95>
+  8046a8:	72 6e                	jb     804718 <__rodata_start+0x90>
+  8046aa:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab2c <__bss_end+0x281c8b2c>
+  8046b1:	28 
+  8046b2:	3e 20 30             	ds and %dh,(%rax)
+  8046b5:	29 00                	sub    %eax,(%rax)
+  8046b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8046b8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046bf:	61                   	(bad)
+  8046c0:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c2:	2e 63 00             	cs movsxd (%rax),%eax
+  8046c5:	0f 1f 00             	nopl   (%rax)
+  8046c8:	5b                   	pop    %rbx
+  8046c9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ce:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046d1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046d6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046da:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046e1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80514c <__ctors_end+0x6c>
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ee:	20 66 74             	and    %ah,0x74(%rsi)
+  8046f1:	72 75                	jb     804768 <devtab+0x8>
+  8046f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046f4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8046f7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad6762 <__bss_end+0x2d294762>
+  8046fe:	20 62 61             	and    %ah,0x61(%rdx)
+  804701:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804705:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804709:	5b                   	pop    %rbx
+  80470a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80470f:	20 72 65             	and    %dh,0x65(%rdx)
+  804712:	61                   	(bad)
+  804713:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad677e <__bss_end+0x2d29477e>
+  80471a:	20 62 61             	and    %ah,0x61(%rdx)
+  80471d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804721:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804725:	5b                   	pop    %rbx
+  804726:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80472b:	20 77 72             	and    %dh,0x72(%rdi)
+  80472e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  804735:	2d 
+  804736:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80473b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80473e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	95 36 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	c6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	d6 3c 80 00 00 00 00 00 b4 36 80 00 00 00 00 00     .<.......6......
+  804a00:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	a8 36 80 00 00 00 00 00 22 37 80 00 00 00 00 00     .6......"7......
+  804a20:	d6 3c 80 00 00 00 00 00 a8 36 80 00 00 00 00 00     .<.......6......
+  804a30:	ee 36 80 00 00 00 00 00 ee 36 80 00 00 00 00 00     .6.......6......
+  804a40:	ee 36 80 00 00 00 00 00 ee 36 80 00 00 00 00 00     .6.......6......
+  804a50:	ee 36 80 00 00 00 00 00 ee 36 80 00 00 00 00 00     .6.......6......
+  804a60:	ee 36 80 00 00 00 00 00 ee 36 80 00 00 00 00 00     .6.......6......
+  804a70:	ee 36 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .6.......<......
+  804a80:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	d6 3c 80 00 00 00 00 00 f9 3b 80 00 00 00 00 00     .<.......;......
+  804b70:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	45 37 80 00 00 00 00 00 14 39 80 00 00 00 00 00     E7.......9......
+  804bd0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	74 37 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     t7.......<......
+  804c00:	d6 3c 80 00 00 00 00 00 3a 37 80 00 00 00 00 00     .<......:7......
+  804c10:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	bc 3a 80 00 00 00 00 00 86 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	d6 3c 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	0b 38 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .8.......<......
+  804c50:	e8 39 80 00 00 00 00 00 d6 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	d6 3c 80 00 00 00 00 00 f9 3b 80 00 00 00 00 00     .<.......;......
+  804c70:	d6 3c 80 00 00 00 00 00 9e 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,8149 @@
+
+obj/user/bounds:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3a 00 00 00       	call   80005d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Test for UBSAN support - accessing array element with an out-of-borders index */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	48 83 ec 10          	sub    $0x10,%rsp
+    int a[4] = {0};
+    /* Trying to print the value of the fifth element of the array (which causes undefined behavior).
+     * The "cprintf" function is sanitized by UBSAN because lib/Makefrag accesses the USER_SAN_CFLAGS variable.
+     * The access operator ([]) is not used because it will trigger -Warray-bounds option of Clang,
+     * which will make this test unrunnable because of -Werror flag which is specified in GNUmakefile. */
+    cprintf("%d\n", *(a + 5));
+  80002d:	48 c7 45 f0 00 00 00 	movq   $0x0,-0x10(%rbp)
+  800034:	00 
+  800035:	48 c7 45 f8 00 00 00 	movq   $0x0,-0x8(%rbp)
+  80003c:	00 
+  80003d:	8b 75 04             	mov    0x4(%rbp),%esi
+  800040:	48 bf c0 46 80 00 00 	movabs $0x8046c0,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 ba e0 01 80 00 00 	movabs $0x8001e0,%rdx
+  800056:	00 00 00 
+  800059:	ff d2                	call   *%rdx
+}
+  80005b:	c9                   	leave
+  80005c:	c3                   	ret
+
+000000000080005d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80005d:	55                   	push   %rbp
+  80005e:	48 89 e5             	mov    %rsp,%rbp
+  800061:	41 56                	push   %r14
+  800063:	41 55                	push   %r13
+  800065:	41 54                	push   %r12
+  800067:	53                   	push   %rbx
+  800068:	41 89 fd             	mov    %edi,%r13d
+  80006b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800075:	00 00 00 
+  800078:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80007f:	00 00 00 
+  800082:	48 39 c2             	cmp    %rax,%rdx
+  800085:	73 17                	jae    80009e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800087:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008a:	49 89 c4             	mov    %rax,%r12
+  80008d:	48 83 c3 08          	add    $0x8,%rbx
+  800091:	b8 00 00 00 00       	mov    $0x0,%eax
+  800096:	ff 53 f8             	call   *-0x8(%rbx)
+  800099:	4c 39 e3             	cmp    %r12,%rbx
+  80009c:	72 ef                	jb     80008d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80009e:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  8000a5:	00 00 00 
+  8000a8:	ff d0                	call   *%rax
+  8000aa:	89 c2                	mov    %eax,%edx
+  8000ac:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000b2:	48 89 d0             	mov    %rdx,%rax
+  8000b5:	48 c1 e0 04          	shl    $0x4,%rax
+  8000b9:	48 29 d0             	sub    %rdx,%rax
+  8000bc:	48 c1 e0 05          	shl    $0x5,%rax
+  8000c0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000c7:	00 00 00 
+  8000ca:	48 01 d0             	add    %rdx,%rax
+  8000cd:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000d4:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000d7:	45 85 ed             	test   %r13d,%r13d
+  8000da:	7e 0d                	jle    8000e9 <libmain+0x8c>
+  8000dc:	49 8b 06             	mov    (%r14),%rax
+  8000df:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000e9:	4c 89 f6             	mov    %r14,%rsi
+  8000ec:	44 89 ef             	mov    %r13d,%edi
+  8000ef:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000fb:	48 b8 10 01 80 00 00 	movabs $0x800110,%rax
+  800102:	00 00 00 
+  800105:	ff d0                	call   *%rax
+#endif
+}
+  800107:	5b                   	pop    %rbx
+  800108:	41 5c                	pop    %r12
+  80010a:	41 5d                	pop    %r13
+  80010c:	41 5e                	pop    %r14
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+
+0000000000800110 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800110:	55                   	push   %rbp
+  800111:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800114:	48 b8 bd 16 80 00 00 	movabs $0x8016bd,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800120:	bf 00 00 00 00       	mov    $0x0,%edi
+  800125:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+}
+  800131:	5d                   	pop    %rbp
+  800132:	c3                   	ret
+
+0000000000800133 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800133:	55                   	push   %rbp
+  800134:	48 89 e5             	mov    %rsp,%rbp
+  800137:	53                   	push   %rbx
+  800138:	48 83 ec 08          	sub    $0x8,%rsp
+  80013c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80013f:	8b 06                	mov    (%rsi),%eax
+  800141:	8d 50 01             	lea    0x1(%rax),%edx
+  800144:	89 16                	mov    %edx,(%rsi)
+  800146:	48 98                	cltq
+  800148:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80014d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800153:	74 0a                	je     80015f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800155:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800159:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80015d:	c9                   	leave
+  80015e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80015f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800163:	be ff 00 00 00       	mov    $0xff,%esi
+  800168:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  80016f:	00 00 00 
+  800172:	ff d0                	call   *%rax
+        state->offset = 0;
+  800174:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80017a:	eb d9                	jmp    800155 <putch+0x22>
+
+000000000080017c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80017c:	55                   	push   %rbp
+  80017d:	48 89 e5             	mov    %rsp,%rbp
+  800180:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800187:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80018a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800191:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80019e:	48 89 f1             	mov    %rsi,%rcx
+  8001a1:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001a8:	48 bf 33 01 80 00 00 	movabs $0x800133,%rdi
+  8001af:	00 00 00 
+  8001b2:	48 b8 30 03 80 00 00 	movabs $0x800330,%rax
+  8001b9:	00 00 00 
+  8001bc:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001be:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001c5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001cc:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001d8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001de:	c9                   	leave
+  8001df:	c3                   	ret
+
+00000000008001e0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001e0:	55                   	push   %rbp
+  8001e1:	48 89 e5             	mov    %rsp,%rbp
+  8001e4:	48 83 ec 50          	sub    $0x50,%rsp
+  8001e8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001ec:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001fc:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800203:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800207:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80020b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80020f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800213:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800217:	48 b8 7c 01 80 00 00 	movabs $0x80017c,%rax
+  80021e:	00 00 00 
+  800221:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800223:	c9                   	leave
+  800224:	c3                   	ret
+
+0000000000800225 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800225:	55                   	push   %rbp
+  800226:	48 89 e5             	mov    %rsp,%rbp
+  800229:	41 57                	push   %r15
+  80022b:	41 56                	push   %r14
+  80022d:	41 55                	push   %r13
+  80022f:	41 54                	push   %r12
+  800231:	53                   	push   %rbx
+  800232:	48 83 ec 18          	sub    $0x18,%rsp
+  800236:	49 89 fc             	mov    %rdi,%r12
+  800239:	49 89 f5             	mov    %rsi,%r13
+  80023c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800240:	8b 45 10             	mov    0x10(%rbp),%eax
+  800243:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800246:	41 89 cf             	mov    %ecx,%r15d
+  800249:	4c 39 fa             	cmp    %r15,%rdx
+  80024c:	73 5b                	jae    8002a9 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80024e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800252:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800256:	85 db                	test   %ebx,%ebx
+  800258:	7e 0e                	jle    800268 <print_num+0x43>
+            putch(padc, put_arg);
+  80025a:	4c 89 ee             	mov    %r13,%rsi
+  80025d:	44 89 f7             	mov    %r14d,%edi
+  800260:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800263:	83 eb 01             	sub    $0x1,%ebx
+  800266:	75 f2                	jne    80025a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800268:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80026c:	48 b9 df 46 80 00 00 	movabs $0x8046df,%rcx
+  800273:	00 00 00 
+  800276:	48 b8 ce 46 80 00 00 	movabs $0x8046ce,%rax
+  80027d:	00 00 00 
+  800280:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800284:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800288:	ba 00 00 00 00       	mov    $0x0,%edx
+  80028d:	49 f7 f7             	div    %r15
+  800290:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800294:	4c 89 ee             	mov    %r13,%rsi
+  800297:	41 ff d4             	call   *%r12
+}
+  80029a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80029e:	5b                   	pop    %rbx
+  80029f:	41 5c                	pop    %r12
+  8002a1:	41 5d                	pop    %r13
+  8002a3:	41 5e                	pop    %r14
+  8002a5:	41 5f                	pop    %r15
+  8002a7:	5d                   	pop    %rbp
+  8002a8:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b2:	49 f7 f7             	div    %r15
+  8002b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002bd:	52                   	push   %rdx
+  8002be:	45 0f be c9          	movsbl %r9b,%r9d
+  8002c2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002c6:	48 89 c2             	mov    %rax,%rdx
+  8002c9:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  8002d0:	00 00 00 
+  8002d3:	ff d0                	call   *%rax
+  8002d5:	48 83 c4 10          	add    $0x10,%rsp
+  8002d9:	eb 8d                	jmp    800268 <print_num+0x43>
+
+00000000008002db <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002db:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002df:	48 8b 06             	mov    (%rsi),%rax
+  8002e2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002e6:	73 0a                	jae    8002f2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002e8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ec:	48 89 16             	mov    %rdx,(%rsi)
+  8002ef:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002f2:	c3                   	ret
+
+00000000008002f3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002f3:	55                   	push   %rbp
+  8002f4:	48 89 e5             	mov    %rsp,%rbp
+  8002f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8002fb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ff:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800303:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800307:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80030e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800312:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800316:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80031a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80031e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800322:	48 b8 30 03 80 00 00 	movabs $0x800330,%rax
+  800329:	00 00 00 
+  80032c:	ff d0                	call   *%rax
+}
+  80032e:	c9                   	leave
+  80032f:	c3                   	ret
+
+0000000000800330 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800330:	55                   	push   %rbp
+  800331:	48 89 e5             	mov    %rsp,%rbp
+  800334:	41 57                	push   %r15
+  800336:	41 56                	push   %r14
+  800338:	41 55                	push   %r13
+  80033a:	41 54                	push   %r12
+  80033c:	53                   	push   %rbx
+  80033d:	48 83 ec 38          	sub    $0x38,%rsp
+  800341:	49 89 fe             	mov    %rdi,%r14
+  800344:	49 89 f5             	mov    %rsi,%r13
+  800347:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80034a:	48 8b 01             	mov    (%rcx),%rax
+  80034d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800351:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800355:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800359:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80035d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800361:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800365:	0f b6 3b             	movzbl (%rbx),%edi
+  800368:	40 80 ff 25          	cmp    $0x25,%dil
+  80036c:	74 18                	je     800386 <vprintfmt+0x56>
+            if (!ch) return;
+  80036e:	40 84 ff             	test   %dil,%dil
+  800371:	0f 84 b1 06 00 00    	je     800a28 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800377:	40 0f b6 ff          	movzbl %dil,%edi
+  80037b:	4c 89 ee             	mov    %r13,%rsi
+  80037e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800381:	4c 89 e3             	mov    %r12,%rbx
+  800384:	eb db                	jmp    800361 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800386:	be 00 00 00 00       	mov    $0x0,%esi
+  80038b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80038f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800394:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80039a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003a1:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003a5:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003aa:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003af:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003b2:	83 e8 23             	sub    $0x23,%eax
+  8003b5:	3c 57                	cmp    $0x57,%al
+  8003b7:	0f 87 51 06 00 00    	ja     800a0e <vprintfmt+0x6de>
+  8003bd:	0f b6 c0             	movzbl %al,%eax
+  8003c0:	48 b9 80 48 80 00 00 	movabs $0x804880,%rcx
+  8003c7:	00 00 00 
+  8003ca:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003cd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003d0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003d4:	eb cf                	jmp    8003a5 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003d6:	49 89 dc             	mov    %rbx,%r12
+  8003d9:	be 01 00 00 00       	mov    $0x1,%esi
+  8003de:	eb c5                	jmp    8003a5 <vprintfmt+0x75>
+            padc = ch;
+  8003e0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003e4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003e7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003ea:	eb b9                	jmp    8003a5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f2:	77 24                	ja     800418 <vprintfmt+0xe8>
+  8003f4:	89 c1                	mov    %eax,%ecx
+  8003f6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003fa:	83 c0 08             	add    $0x8,%eax
+  8003fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800400:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800403:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800406:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80040a:	79 99                	jns    8003a5 <vprintfmt+0x75>
+                width = precision;
+  80040c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800410:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800416:	eb 8d                	jmp    8003a5 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800418:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80041c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800420:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800424:	eb da                	jmp    800400 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800426:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80042b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80042f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800435:	3c 39                	cmp    $0x39,%al
+  800437:	77 1c                	ja     800455 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800439:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80043d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800441:	0f b6 c0             	movzbl %al,%eax
+  800444:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800449:	0f b6 03             	movzbl (%rbx),%eax
+  80044c:	3c 39                	cmp    $0x39,%al
+  80044e:	76 e9                	jbe    800439 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800450:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800453:	eb b1                	jmp    800406 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800455:	49 89 dc             	mov    %rbx,%r12
+  800458:	eb ac                	jmp    800406 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80045a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80045d:	85 c9                	test   %ecx,%ecx
+  80045f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800464:	0f 49 c1             	cmovns %ecx,%eax
+  800467:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80046a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046d:	e9 33 ff ff ff       	jmp    8003a5 <vprintfmt+0x75>
+            lflag++;
+  800472:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800475:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800478:	e9 28 ff ff ff       	jmp    8003a5 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80047d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800480:	83 f8 2f             	cmp    $0x2f,%eax
+  800483:	77 19                	ja     80049e <vprintfmt+0x16e>
+  800485:	89 c2                	mov    %eax,%edx
+  800487:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80048b:	83 c0 08             	add    $0x8,%eax
+  80048e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800491:	8b 3a                	mov    (%rdx),%edi
+  800493:	4c 89 ee             	mov    %r13,%rsi
+  800496:	41 ff d6             	call   *%r14
+            break;
+  800499:	e9 c3 fe ff ff       	jmp    800361 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80049e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004aa:	eb e5                	jmp    800491 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004af:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b2:	77 5a                	ja     80050e <vprintfmt+0x1de>
+  8004b4:	89 c2                	mov    %eax,%edx
+  8004b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004ba:	83 c0 08             	add    $0x8,%eax
+  8004bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004c0:	8b 02                	mov    (%rdx),%eax
+  8004c2:	89 c1                	mov    %eax,%ecx
+  8004c4:	f7 d9                	neg    %ecx
+  8004c6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004c9:	83 f9 16             	cmp    $0x16,%ecx
+  8004cc:	7f 4e                	jg     80051c <vprintfmt+0x1ec>
+  8004ce:	48 63 c1             	movslq %ecx,%rax
+  8004d1:	48 ba 40 4b 80 00 00 	movabs $0x804b40,%rdx
+  8004d8:	00 00 00 
+  8004db:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004df:	48 85 c0             	test   %rax,%rax
+  8004e2:	74 38                	je     80051c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004e4:	48 89 c1             	mov    %rax,%rcx
+  8004e7:	48 ba 19 4d 80 00 00 	movabs $0x804d19,%rdx
+  8004ee:	00 00 00 
+  8004f1:	4c 89 ee             	mov    %r13,%rsi
+  8004f4:	4c 89 f7             	mov    %r14,%rdi
+  8004f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fc:	49 b8 f3 02 80 00 00 	movabs $0x8002f3,%r8
+  800503:	00 00 00 
+  800506:	41 ff d0             	call   *%r8
+  800509:	e9 53 fe ff ff       	jmp    800361 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80050e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800512:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800516:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051a:	eb a4                	jmp    8004c0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80051c:	48 ba f7 46 80 00 00 	movabs $0x8046f7,%rdx
+  800523:	00 00 00 
+  800526:	4c 89 ee             	mov    %r13,%rsi
+  800529:	4c 89 f7             	mov    %r14,%rdi
+  80052c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800531:	49 b8 f3 02 80 00 00 	movabs $0x8002f3,%r8
+  800538:	00 00 00 
+  80053b:	41 ff d0             	call   *%r8
+  80053e:	e9 1e fe ff ff       	jmp    800361 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800543:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800546:	83 f8 2f             	cmp    $0x2f,%eax
+  800549:	77 6c                	ja     8005b7 <vprintfmt+0x287>
+  80054b:	89 c2                	mov    %eax,%edx
+  80054d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800551:	83 c0 08             	add    $0x8,%eax
+  800554:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800557:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80055a:	48 85 d2             	test   %rdx,%rdx
+  80055d:	48 b8 f0 46 80 00 00 	movabs $0x8046f0,%rax
+  800564:	00 00 00 
+  800567:	48 0f 45 c2          	cmovne %rdx,%rax
+  80056b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80056f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800573:	7e 06                	jle    80057b <vprintfmt+0x24b>
+  800575:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800579:	75 4a                	jne    8005c5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80057b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80057f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800583:	0f b6 00             	movzbl (%rax),%eax
+  800586:	84 c0                	test   %al,%al
+  800588:	0f 85 9a 00 00 00    	jne    800628 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80058e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800591:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800595:	85 c0                	test   %eax,%eax
+  800597:	0f 8e c4 fd ff ff    	jle    800361 <vprintfmt+0x31>
+  80059d:	4c 89 ee             	mov    %r13,%rsi
+  8005a0:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005a5:	41 ff d6             	call   *%r14
+  8005a8:	41 83 ec 01          	sub    $0x1,%r12d
+  8005ac:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005b0:	75 eb                	jne    80059d <vprintfmt+0x26d>
+  8005b2:	e9 aa fd ff ff       	jmp    800361 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c3:	eb 92                	jmp    800557 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005c5:	49 63 f7             	movslq %r15d,%rsi
+  8005c8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005cc:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  8005d3:	00 00 00 
+  8005d6:	ff d0                	call   *%rax
+  8005d8:	48 89 c2             	mov    %rax,%rdx
+  8005db:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005de:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005e0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005e3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005e6:	85 c0                	test   %eax,%eax
+  8005e8:	7e 91                	jle    80057b <vprintfmt+0x24b>
+  8005ea:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005ef:	4c 89 ee             	mov    %r13,%rsi
+  8005f2:	44 89 e7             	mov    %r12d,%edi
+  8005f5:	41 ff d6             	call   *%r14
+  8005f8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005fc:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ff:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800602:	75 eb                	jne    8005ef <vprintfmt+0x2bf>
+  800604:	e9 72 ff ff ff       	jmp    80057b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800609:	0f b6 f8             	movzbl %al,%edi
+  80060c:	4c 89 ee             	mov    %r13,%rsi
+  80060f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800612:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800616:	49 83 c4 01          	add    $0x1,%r12
+  80061a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800620:	84 c0                	test   %al,%al
+  800622:	0f 84 66 ff ff ff    	je     80058e <vprintfmt+0x25e>
+  800628:	45 85 ff             	test   %r15d,%r15d
+  80062b:	78 0a                	js     800637 <vprintfmt+0x307>
+  80062d:	41 83 ef 01          	sub    $0x1,%r15d
+  800631:	0f 88 57 ff ff ff    	js     80058e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800637:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80063b:	74 cc                	je     800609 <vprintfmt+0x2d9>
+  80063d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800640:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800645:	80 fa 5e             	cmp    $0x5e,%dl
+  800648:	77 c2                	ja     80060c <vprintfmt+0x2dc>
+  80064a:	eb bd                	jmp    800609 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80064c:	40 84 f6             	test   %sil,%sil
+  80064f:	75 26                	jne    800677 <vprintfmt+0x347>
+    switch (lflag) {
+  800651:	85 d2                	test   %edx,%edx
+  800653:	74 59                	je     8006ae <vprintfmt+0x37e>
+  800655:	83 fa 01             	cmp    $0x1,%edx
+  800658:	74 7b                	je     8006d5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80065a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80065d:	83 f8 2f             	cmp    $0x2f,%eax
+  800660:	0f 87 96 00 00 00    	ja     8006fc <vprintfmt+0x3cc>
+  800666:	89 c2                	mov    %eax,%edx
+  800668:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066c:	83 c0 08             	add    $0x8,%eax
+  80066f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800672:	4c 8b 22             	mov    (%rdx),%r12
+  800675:	eb 17                	jmp    80068e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800677:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80067a:	83 f8 2f             	cmp    $0x2f,%eax
+  80067d:	77 21                	ja     8006a0 <vprintfmt+0x370>
+  80067f:	89 c2                	mov    %eax,%edx
+  800681:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800685:	83 c0 08             	add    $0x8,%eax
+  800688:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80068e:	4d 85 e4             	test   %r12,%r12
+  800691:	78 7a                	js     80070d <vprintfmt+0x3dd>
+            num = i;
+  800693:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800696:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80069b:	e9 50 02 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ac:	eb dd                	jmp    80068b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b4:	77 11                	ja     8006c7 <vprintfmt+0x397>
+  8006b6:	89 c2                	mov    %eax,%edx
+  8006b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bc:	83 c0 08             	add    $0x8,%eax
+  8006bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c2:	4c 63 22             	movslq (%rdx),%r12
+  8006c5:	eb c7                	jmp    80068e <vprintfmt+0x35e>
+  8006c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d3:	eb ed                	jmp    8006c2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006db:	77 11                	ja     8006ee <vprintfmt+0x3be>
+  8006dd:	89 c2                	mov    %eax,%edx
+  8006df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e3:	83 c0 08             	add    $0x8,%eax
+  8006e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006e9:	4c 8b 22             	mov    (%rdx),%r12
+  8006ec:	eb a0                	jmp    80068e <vprintfmt+0x35e>
+  8006ee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fa:	eb ed                	jmp    8006e9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800700:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800704:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800708:	e9 65 ff ff ff       	jmp    800672 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80070d:	4c 89 ee             	mov    %r13,%rsi
+  800710:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800715:	41 ff d6             	call   *%r14
+                i = -i;
+  800718:	49 f7 dc             	neg    %r12
+  80071b:	e9 73 ff ff ff       	jmp    800693 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800720:	40 84 f6             	test   %sil,%sil
+  800723:	75 32                	jne    800757 <vprintfmt+0x427>
+    switch (lflag) {
+  800725:	85 d2                	test   %edx,%edx
+  800727:	74 5d                	je     800786 <vprintfmt+0x456>
+  800729:	83 fa 01             	cmp    $0x1,%edx
+  80072c:	0f 84 82 00 00 00    	je     8007b4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800732:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800735:	83 f8 2f             	cmp    $0x2f,%eax
+  800738:	0f 87 a5 00 00 00    	ja     8007e3 <vprintfmt+0x4b3>
+  80073e:	89 c2                	mov    %eax,%edx
+  800740:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800744:	83 c0 08             	add    $0x8,%eax
+  800747:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80074d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800752:	e9 99 01 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800757:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075a:	83 f8 2f             	cmp    $0x2f,%eax
+  80075d:	77 19                	ja     800778 <vprintfmt+0x448>
+  80075f:	89 c2                	mov    %eax,%edx
+  800761:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800765:	83 c0 08             	add    $0x8,%eax
+  800768:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80076e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800773:	e9 78 01 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+  800778:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800780:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800784:	eb e5                	jmp    80076b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800786:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800789:	83 f8 2f             	cmp    $0x2f,%eax
+  80078c:	77 18                	ja     8007a6 <vprintfmt+0x476>
+  80078e:	89 c2                	mov    %eax,%edx
+  800790:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800794:	83 c0 08             	add    $0x8,%eax
+  800797:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80079c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007a1:	e9 4a 01 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+  8007a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b2:	eb e6                	jmp    80079a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ba:	77 19                	ja     8007d5 <vprintfmt+0x4a5>
+  8007bc:	89 c2                	mov    %eax,%edx
+  8007be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c2:	83 c0 08             	add    $0x8,%eax
+  8007c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007d0:	e9 1b 01 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+  8007d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e1:	eb e5                	jmp    8007c8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ef:	e9 56 ff ff ff       	jmp    80074a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f4:	40 84 f6             	test   %sil,%sil
+  8007f7:	75 2e                	jne    800827 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007f9:	85 d2                	test   %edx,%edx
+  8007fb:	74 59                	je     800856 <vprintfmt+0x526>
+  8007fd:	83 fa 01             	cmp    $0x1,%edx
+  800800:	74 7f                	je     800881 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800802:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800805:	83 f8 2f             	cmp    $0x2f,%eax
+  800808:	0f 87 9f 00 00 00    	ja     8008ad <vprintfmt+0x57d>
+  80080e:	89 c2                	mov    %eax,%edx
+  800810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800814:	83 c0 08             	add    $0x8,%eax
+  800817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80081d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800822:	e9 c9 00 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800827:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082a:	83 f8 2f             	cmp    $0x2f,%eax
+  80082d:	77 19                	ja     800848 <vprintfmt+0x518>
+  80082f:	89 c2                	mov    %eax,%edx
+  800831:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800835:	83 c0 08             	add    $0x8,%eax
+  800838:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80083e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800843:	e9 a8 00 00 00       	jmp    8008f0 <vprintfmt+0x5c0>
+  800848:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800850:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800854:	eb e5                	jmp    80083b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 15                	ja     800873 <vprintfmt+0x543>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80086c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800871:	eb 7d                	jmp    8008f0 <vprintfmt+0x5c0>
+  800873:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800877:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087f:	eb e9                	jmp    80086a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800881:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800884:	83 f8 2f             	cmp    $0x2f,%eax
+  800887:	77 16                	ja     80089f <vprintfmt+0x56f>
+  800889:	89 c2                	mov    %eax,%edx
+  80088b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088f:	83 c0 08             	add    $0x8,%eax
+  800892:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800895:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800898:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80089d:	eb 51                	jmp    8008f0 <vprintfmt+0x5c0>
+  80089f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ab:	eb e8                	jmp    800895 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	e9 5c ff ff ff       	jmp    80081a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008be:	4c 89 ee             	mov    %r13,%rsi
+  8008c1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008c6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008c9:	4c 89 ee             	mov    %r13,%rsi
+  8008cc:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008d1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008da:	77 47                	ja     800923 <vprintfmt+0x5f3>
+  8008dc:	89 c2                	mov    %eax,%edx
+  8008de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e2:	83 c0 08             	add    $0x8,%eax
+  8008e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008eb:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8008f4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008f8:	0f 94 c0             	sete   %al
+  8008fb:	0f b6 c0             	movzbl %al,%eax
+  8008fe:	50                   	push   %rax
+  8008ff:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800904:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800908:	4c 89 ee             	mov    %r13,%rsi
+  80090b:	4c 89 f7             	mov    %r14,%rdi
+  80090e:	48 b8 25 02 80 00 00 	movabs $0x800225,%rax
+  800915:	00 00 00 
+  800918:	ff d0                	call   *%rax
+            break;
+  80091a:	48 83 c4 10          	add    $0x10,%rsp
+  80091e:	e9 3e fa ff ff       	jmp    800361 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800923:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800927:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092f:	eb b7                	jmp    8008e8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800931:	40 84 f6             	test   %sil,%sil
+  800934:	75 2b                	jne    800961 <vprintfmt+0x631>
+    switch (lflag) {
+  800936:	85 d2                	test   %edx,%edx
+  800938:	74 56                	je     800990 <vprintfmt+0x660>
+  80093a:	83 fa 01             	cmp    $0x1,%edx
+  80093d:	74 7f                	je     8009be <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80093f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800942:	83 f8 2f             	cmp    $0x2f,%eax
+  800945:	0f 87 a2 00 00 00    	ja     8009ed <vprintfmt+0x6bd>
+  80094b:	89 c2                	mov    %eax,%edx
+  80094d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800951:	83 c0 08             	add    $0x8,%eax
+  800954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800957:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80095f:	eb 8f                	jmp    8008f0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800961:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800964:	83 f8 2f             	cmp    $0x2f,%eax
+  800967:	77 19                	ja     800982 <vprintfmt+0x652>
+  800969:	89 c2                	mov    %eax,%edx
+  80096b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80096f:	83 c0 08             	add    $0x8,%eax
+  800972:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800975:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800978:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80097d:	e9 6e ff ff ff       	jmp    8008f0 <vprintfmt+0x5c0>
+  800982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098e:	eb e5                	jmp    800975 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 18                	ja     8009b0 <vprintfmt+0x680>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009a6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ab:	e9 40 ff ff ff       	jmp    8008f0 <vprintfmt+0x5c0>
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb e6                	jmp    8009a4 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c4:	77 19                	ja     8009df <vprintfmt+0x6af>
+  8009c6:	89 c2                	mov    %eax,%edx
+  8009c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cc:	83 c0 08             	add    $0x8,%eax
+  8009cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009da:	e9 11 ff ff ff       	jmp    8008f0 <vprintfmt+0x5c0>
+  8009df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009eb:	eb e5                	jmp    8009d2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f9:	e9 59 ff ff ff       	jmp    800957 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009fe:	4c 89 ee             	mov    %r13,%rsi
+  800a01:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a06:	41 ff d6             	call   *%r14
+            break;
+  800a09:	e9 53 f9 ff ff       	jmp    800361 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a0e:	4c 89 ee             	mov    %r13,%rsi
+  800a11:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a16:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a19:	48 83 eb 01          	sub    $0x1,%rbx
+  800a1d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a21:	75 f6                	jne    800a19 <vprintfmt+0x6e9>
+  800a23:	e9 39 f9 ff ff       	jmp    800361 <vprintfmt+0x31>
+}
+  800a28:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a2c:	5b                   	pop    %rbx
+  800a2d:	41 5c                	pop    %r12
+  800a2f:	41 5d                	pop    %r13
+  800a31:	41 5e                	pop    %r14
+  800a33:	41 5f                	pop    %r15
+  800a35:	5d                   	pop    %rbp
+  800a36:	c3                   	ret
+
+0000000000800a37 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a37:	55                   	push   %rbp
+  800a38:	48 89 e5             	mov    %rsp,%rbp
+  800a3b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a3f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a43:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a48:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a4c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a53:	48 85 ff             	test   %rdi,%rdi
+  800a56:	74 2b                	je     800a83 <vsnprintf+0x4c>
+  800a58:	48 85 f6             	test   %rsi,%rsi
+  800a5b:	74 26                	je     800a83 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a5d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a61:	48 bf db 02 80 00 00 	movabs $0x8002db,%rdi
+  800a68:	00 00 00 
+  800a6b:	48 b8 30 03 80 00 00 	movabs $0x800330,%rax
+  800a72:	00 00 00 
+  800a75:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a77:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a7e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a81:	c9                   	leave
+  800a82:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a88:	eb f7                	jmp    800a81 <vsnprintf+0x4a>
+
+0000000000800a8a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a8a:	55                   	push   %rbp
+  800a8b:	48 89 e5             	mov    %rsp,%rbp
+  800a8e:	48 83 ec 50          	sub    $0x50,%rsp
+  800a92:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a96:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a9a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a9e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ab1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ab5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ab9:	48 b8 37 0a 80 00 00 	movabs $0x800a37,%rax
+  800ac0:	00 00 00 
+  800ac3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ac5:	c9                   	leave
+  800ac6:	c3                   	ret
+
+0000000000800ac7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ac7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aca:	74 10                	je     800adc <strlen+0x15>
+    size_t n = 0;
+  800acc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ad1:	48 83 c0 01          	add    $0x1,%rax
+  800ad5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ad9:	75 f6                	jne    800ad1 <strlen+0xa>
+  800adb:	c3                   	ret
+    size_t n = 0;
+  800adc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ae1:	c3                   	ret
+
+0000000000800ae2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ae2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800aea:	48 85 f6             	test   %rsi,%rsi
+  800aed:	74 11                	je     800b00 <strnlen+0x1e>
+  800aef:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800af3:	74 0c                	je     800b01 <strnlen+0x1f>
+  800af5:	48 83 c2 01          	add    $0x1,%rdx
+  800af9:	48 39 d0             	cmp    %rdx,%rax
+  800afc:	75 f1                	jne    800aef <strnlen+0xd>
+  800afe:	eb 04                	jmp    800b04 <strnlen+0x22>
+  800b00:	c3                   	ret
+  800b01:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b04:	c3                   	ret
+
+0000000000800b05 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b05:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b08:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b0d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b11:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b14:	48 83 c2 01          	add    $0x1,%rdx
+  800b18:	84 c9                	test   %cl,%cl
+  800b1a:	75 f1                	jne    800b0d <strcpy+0x8>
+        ;
+    return res;
+}
+  800b1c:	c3                   	ret
+
+0000000000800b1d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b1d:	55                   	push   %rbp
+  800b1e:	48 89 e5             	mov    %rsp,%rbp
+  800b21:	41 54                	push   %r12
+  800b23:	53                   	push   %rbx
+  800b24:	48 89 fb             	mov    %rdi,%rbx
+  800b27:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b2a:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  800b31:	00 00 00 
+  800b34:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b36:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b3a:	4c 89 e6             	mov    %r12,%rsi
+  800b3d:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  800b44:	00 00 00 
+  800b47:	ff d0                	call   *%rax
+    return dst;
+}
+  800b49:	48 89 d8             	mov    %rbx,%rax
+  800b4c:	5b                   	pop    %rbx
+  800b4d:	41 5c                	pop    %r12
+  800b4f:	5d                   	pop    %rbp
+  800b50:	c3                   	ret
+
+0000000000800b51 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b51:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b54:	48 85 d2             	test   %rdx,%rdx
+  800b57:	74 1f                	je     800b78 <strncpy+0x27>
+  800b59:	48 01 fa             	add    %rdi,%rdx
+  800b5c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b5f:	48 83 c1 01          	add    $0x1,%rcx
+  800b63:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b67:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b6b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b6f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b73:	48 39 ca             	cmp    %rcx,%rdx
+  800b76:	75 e7                	jne    800b5f <strncpy+0xe>
+    }
+    return ret;
+}
+  800b78:	c3                   	ret
+
+0000000000800b79 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b79:	48 89 f8             	mov    %rdi,%rax
+  800b7c:	48 85 d2             	test   %rdx,%rdx
+  800b7f:	74 24                	je     800ba5 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b81:	48 83 ea 01          	sub    $0x1,%rdx
+  800b85:	74 1b                	je     800ba2 <strlcpy+0x29>
+  800b87:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b8b:	0f b6 16             	movzbl (%rsi),%edx
+  800b8e:	84 d2                	test   %dl,%dl
+  800b90:	74 10                	je     800ba2 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b92:	48 83 c6 01          	add    $0x1,%rsi
+  800b96:	48 83 c0 01          	add    $0x1,%rax
+  800b9a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b9d:	48 39 c8             	cmp    %rcx,%rax
+  800ba0:	75 e9                	jne    800b8b <strlcpy+0x12>
+        *dst = '\0';
+  800ba2:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ba5:	48 29 f8             	sub    %rdi,%rax
+}
+  800ba8:	c3                   	ret
+
+0000000000800ba9 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ba9:	0f b6 07             	movzbl (%rdi),%eax
+  800bac:	84 c0                	test   %al,%al
+  800bae:	74 13                	je     800bc3 <strcmp+0x1a>
+  800bb0:	38 06                	cmp    %al,(%rsi)
+  800bb2:	75 0f                	jne    800bc3 <strcmp+0x1a>
+  800bb4:	48 83 c7 01          	add    $0x1,%rdi
+  800bb8:	48 83 c6 01          	add    $0x1,%rsi
+  800bbc:	0f b6 07             	movzbl (%rdi),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	75 ed                	jne    800bb0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bc3:	0f b6 c0             	movzbl %al,%eax
+  800bc6:	0f b6 16             	movzbl (%rsi),%edx
+  800bc9:	29 d0                	sub    %edx,%eax
+}
+  800bcb:	c3                   	ret
+
+0000000000800bcc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bcc:	48 85 d2             	test   %rdx,%rdx
+  800bcf:	74 1f                	je     800bf0 <strncmp+0x24>
+  800bd1:	0f b6 07             	movzbl (%rdi),%eax
+  800bd4:	84 c0                	test   %al,%al
+  800bd6:	74 1e                	je     800bf6 <strncmp+0x2a>
+  800bd8:	3a 06                	cmp    (%rsi),%al
+  800bda:	75 1a                	jne    800bf6 <strncmp+0x2a>
+  800bdc:	48 83 c7 01          	add    $0x1,%rdi
+  800be0:	48 83 c6 01          	add    $0x1,%rsi
+  800be4:	48 83 ea 01          	sub    $0x1,%rdx
+  800be8:	75 e7                	jne    800bd1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bea:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bef:	c3                   	ret
+  800bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf5:	c3                   	ret
+  800bf6:	48 85 d2             	test   %rdx,%rdx
+  800bf9:	74 09                	je     800c04 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfb:	0f b6 07             	movzbl (%rdi),%eax
+  800bfe:	0f b6 16             	movzbl (%rsi),%edx
+  800c01:	29 d0                	sub    %edx,%eax
+  800c03:	c3                   	ret
+    if (!n) return 0;
+  800c04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c09:	c3                   	ret
+
+0000000000800c0a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c0a:	0f b6 17             	movzbl (%rdi),%edx
+  800c0d:	84 d2                	test   %dl,%dl
+  800c0f:	74 18                	je     800c29 <strchr+0x1f>
+        if (*str == c) {
+  800c11:	0f be d2             	movsbl %dl,%edx
+  800c14:	39 f2                	cmp    %esi,%edx
+  800c16:	74 17                	je     800c2f <strchr+0x25>
+    for (; *str; str++) {
+  800c18:	48 83 c7 01          	add    $0x1,%rdi
+  800c1c:	0f b6 17             	movzbl (%rdi),%edx
+  800c1f:	84 d2                	test   %dl,%dl
+  800c21:	75 ee                	jne    800c11 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c28:	c3                   	ret
+  800c29:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2e:	c3                   	ret
+  800c2f:	48 89 f8             	mov    %rdi,%rax
+}
+  800c32:	c3                   	ret
+
+0000000000800c33 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c33:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c36:	0f b6 17             	movzbl (%rdi),%edx
+  800c39:	84 d2                	test   %dl,%dl
+  800c3b:	74 13                	je     800c50 <strfind+0x1d>
+  800c3d:	0f be d2             	movsbl %dl,%edx
+  800c40:	39 f2                	cmp    %esi,%edx
+  800c42:	74 0b                	je     800c4f <strfind+0x1c>
+  800c44:	48 83 c0 01          	add    $0x1,%rax
+  800c48:	0f b6 10             	movzbl (%rax),%edx
+  800c4b:	84 d2                	test   %dl,%dl
+  800c4d:	75 ee                	jne    800c3d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c4f:	c3                   	ret
+  800c50:	c3                   	ret
+
+0000000000800c51 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c51:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c54:	48 89 f8             	mov    %rdi,%rax
+  800c57:	48 f7 d8             	neg    %rax
+  800c5a:	83 e0 07             	and    $0x7,%eax
+  800c5d:	49 89 d1             	mov    %rdx,%r9
+  800c60:	49 29 c1             	sub    %rax,%r9
+  800c63:	78 36                	js     800c9b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c65:	40 0f b6 c6          	movzbl %sil,%eax
+  800c69:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c70:	01 01 01 
+  800c73:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c77:	40 f6 c7 07          	test   $0x7,%dil
+  800c7b:	75 38                	jne    800cb5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c7d:	4c 89 c9             	mov    %r9,%rcx
+  800c80:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c84:	74 0c                	je     800c92 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c86:	fc                   	cld
+  800c87:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c8a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c8e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c92:	4d 85 c9             	test   %r9,%r9
+  800c95:	75 45                	jne    800cdc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c97:	4c 89 c0             	mov    %r8,%rax
+  800c9a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c9b:	48 85 d2             	test   %rdx,%rdx
+  800c9e:	74 f7                	je     800c97 <memset+0x46>
+  800ca0:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ca3:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ca6:	48 83 c0 01          	add    $0x1,%rax
+  800caa:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cae:	48 39 c2             	cmp    %rax,%rdx
+  800cb1:	75 f3                	jne    800ca6 <memset+0x55>
+  800cb3:	eb e2                	jmp    800c97 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cb5:	40 f6 c7 01          	test   $0x1,%dil
+  800cb9:	74 06                	je     800cc1 <memset+0x70>
+  800cbb:	88 07                	mov    %al,(%rdi)
+  800cbd:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cc1:	40 f6 c7 02          	test   $0x2,%dil
+  800cc5:	74 07                	je     800cce <memset+0x7d>
+  800cc7:	66 89 07             	mov    %ax,(%rdi)
+  800cca:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cce:	40 f6 c7 04          	test   $0x4,%dil
+  800cd2:	74 a9                	je     800c7d <memset+0x2c>
+  800cd4:	89 07                	mov    %eax,(%rdi)
+  800cd6:	48 83 c7 04          	add    $0x4,%rdi
+  800cda:	eb a1                	jmp    800c7d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cdc:	41 f6 c1 04          	test   $0x4,%r9b
+  800ce0:	74 06                	je     800ce8 <memset+0x97>
+  800ce2:	89 07                	mov    %eax,(%rdi)
+  800ce4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ce8:	41 f6 c1 02          	test   $0x2,%r9b
+  800cec:	74 07                	je     800cf5 <memset+0xa4>
+  800cee:	66 89 07             	mov    %ax,(%rdi)
+  800cf1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cf5:	41 f6 c1 01          	test   $0x1,%r9b
+  800cf9:	74 9c                	je     800c97 <memset+0x46>
+  800cfb:	88 07                	mov    %al,(%rdi)
+  800cfd:	eb 98                	jmp    800c97 <memset+0x46>
+
+0000000000800cff <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cff:	48 89 f8             	mov    %rdi,%rax
+  800d02:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d05:	48 39 fe             	cmp    %rdi,%rsi
+  800d08:	73 3b                	jae    800d45 <memmove+0x46>
+  800d0a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d0e:	48 39 d7             	cmp    %rdx,%rdi
+  800d11:	73 32                	jae    800d45 <memmove+0x46>
+        s += n;
+        d += n;
+  800d13:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d17:	48 89 d6             	mov    %rdx,%rsi
+  800d1a:	48 09 fe             	or     %rdi,%rsi
+  800d1d:	48 09 ce             	or     %rcx,%rsi
+  800d20:	40 f6 c6 07          	test   $0x7,%sil
+  800d24:	75 12                	jne    800d38 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d26:	48 83 ef 08          	sub    $0x8,%rdi
+  800d2a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d2e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d32:	fd                   	std
+  800d33:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d36:	fc                   	cld
+  800d37:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d38:	48 83 ef 01          	sub    $0x1,%rdi
+  800d3c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d40:	fd                   	std
+  800d41:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d43:	eb f1                	jmp    800d36 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d45:	48 89 f2             	mov    %rsi,%rdx
+  800d48:	48 09 c2             	or     %rax,%rdx
+  800d4b:	48 09 ca             	or     %rcx,%rdx
+  800d4e:	f6 c2 07             	test   $0x7,%dl
+  800d51:	75 0c                	jne    800d5f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d53:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d57:	48 89 c7             	mov    %rax,%rdi
+  800d5a:	fc                   	cld
+  800d5b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d5e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d5f:	48 89 c7             	mov    %rax,%rdi
+  800d62:	fc                   	cld
+  800d63:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d65:	c3                   	ret
+
+0000000000800d66 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d66:	55                   	push   %rbp
+  800d67:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d6a:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  800d71:	00 00 00 
+  800d74:	ff d0                	call   *%rax
+}
+  800d76:	5d                   	pop    %rbp
+  800d77:	c3                   	ret
+
+0000000000800d78 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d78:	55                   	push   %rbp
+  800d79:	48 89 e5             	mov    %rsp,%rbp
+  800d7c:	41 57                	push   %r15
+  800d7e:	41 56                	push   %r14
+  800d80:	41 55                	push   %r13
+  800d82:	41 54                	push   %r12
+  800d84:	53                   	push   %rbx
+  800d85:	48 83 ec 08          	sub    $0x8,%rsp
+  800d89:	49 89 fe             	mov    %rdi,%r14
+  800d8c:	49 89 f7             	mov    %rsi,%r15
+  800d8f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d92:	48 89 f7             	mov    %rsi,%rdi
+  800d95:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+  800da1:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800da4:	48 89 de             	mov    %rbx,%rsi
+  800da7:	4c 89 f7             	mov    %r14,%rdi
+  800daa:	48 b8 e2 0a 80 00 00 	movabs $0x800ae2,%rax
+  800db1:	00 00 00 
+  800db4:	ff d0                	call   *%rax
+  800db6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800db9:	48 39 c3             	cmp    %rax,%rbx
+  800dbc:	74 36                	je     800df4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dbe:	48 89 d8             	mov    %rbx,%rax
+  800dc1:	4c 29 e8             	sub    %r13,%rax
+  800dc4:	49 39 c4             	cmp    %rax,%r12
+  800dc7:	73 31                	jae    800dfa <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dc9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dce:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dd2:	4c 89 fe             	mov    %r15,%rsi
+  800dd5:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  800ddc:	00 00 00 
+  800ddf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800de1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800de5:	48 83 c4 08          	add    $0x8,%rsp
+  800de9:	5b                   	pop    %rbx
+  800dea:	41 5c                	pop    %r12
+  800dec:	41 5d                	pop    %r13
+  800dee:	41 5e                	pop    %r14
+  800df0:	41 5f                	pop    %r15
+  800df2:	5d                   	pop    %rbp
+  800df3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800df8:	eb eb                	jmp    800de5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dfa:	48 83 eb 01          	sub    $0x1,%rbx
+  800dfe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e02:	48 89 da             	mov    %rbx,%rdx
+  800e05:	4c 89 fe             	mov    %r15,%rsi
+  800e08:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  800e0f:	00 00 00 
+  800e12:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e14:	49 01 de             	add    %rbx,%r14
+  800e17:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e1c:	eb c3                	jmp    800de1 <strlcat+0x69>
+
+0000000000800e1e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e1e:	48 85 d2             	test   %rdx,%rdx
+  800e21:	74 2d                	je     800e50 <memcmp+0x32>
+  800e23:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e28:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e2c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e31:	44 38 c1             	cmp    %r8b,%cl
+  800e34:	75 0f                	jne    800e45 <memcmp+0x27>
+    while (n-- > 0) {
+  800e36:	48 83 c0 01          	add    $0x1,%rax
+  800e3a:	48 39 c2             	cmp    %rax,%rdx
+  800e3d:	75 e9                	jne    800e28 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e44:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e45:	0f b6 c1             	movzbl %cl,%eax
+  800e48:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e4c:	44 29 c0             	sub    %r8d,%eax
+  800e4f:	c3                   	ret
+    return 0;
+  800e50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e55:	c3                   	ret
+
+0000000000800e56 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e56:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e5a:	48 39 c7             	cmp    %rax,%rdi
+  800e5d:	73 0f                	jae    800e6e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e5f:	40 38 37             	cmp    %sil,(%rdi)
+  800e62:	74 0e                	je     800e72 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e64:	48 83 c7 01          	add    $0x1,%rdi
+  800e68:	48 39 f8             	cmp    %rdi,%rax
+  800e6b:	75 f2                	jne    800e5f <memfind+0x9>
+  800e6d:	c3                   	ret
+  800e6e:	48 89 f8             	mov    %rdi,%rax
+  800e71:	c3                   	ret
+  800e72:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e75:	c3                   	ret
+
+0000000000800e76 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e76:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e79:	0f b6 37             	movzbl (%rdi),%esi
+  800e7c:	40 80 fe 20          	cmp    $0x20,%sil
+  800e80:	74 06                	je     800e88 <strtol+0x12>
+  800e82:	40 80 fe 09          	cmp    $0x9,%sil
+  800e86:	75 13                	jne    800e9b <strtol+0x25>
+  800e88:	48 83 c7 01          	add    $0x1,%rdi
+  800e8c:	0f b6 37             	movzbl (%rdi),%esi
+  800e8f:	40 80 fe 20          	cmp    $0x20,%sil
+  800e93:	74 f3                	je     800e88 <strtol+0x12>
+  800e95:	40 80 fe 09          	cmp    $0x9,%sil
+  800e99:	74 ed                	je     800e88 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e9b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e9e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ea1:	3c 01                	cmp    $0x1,%al
+  800ea3:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ea7:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ead:	75 0f                	jne    800ebe <strtol+0x48>
+  800eaf:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eb2:	74 14                	je     800ec8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eb4:	85 d2                	test   %edx,%edx
+  800eb6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebb:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ebe:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ec3:	4c 63 ca             	movslq %edx,%r9
+  800ec6:	eb 36                	jmp    800efe <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ec8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ecc:	74 0f                	je     800edd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ece:	85 d2                	test   %edx,%edx
+  800ed0:	75 ec                	jne    800ebe <strtol+0x48>
+        s++;
+  800ed2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ed6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800edb:	eb e1                	jmp    800ebe <strtol+0x48>
+        s += 2;
+  800edd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ee1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ee6:	eb d6                	jmp    800ebe <strtol+0x48>
+            dig -= '0';
+  800ee8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800eeb:	44 0f b6 c1          	movzbl %cl,%r8d
+  800eef:	41 39 d0             	cmp    %edx,%r8d
+  800ef2:	7d 21                	jge    800f15 <strtol+0x9f>
+        val = val * base + dig;
+  800ef4:	49 0f af c1          	imul   %r9,%rax
+  800ef8:	0f b6 c9             	movzbl %cl,%ecx
+  800efb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800efe:	48 83 c7 01          	add    $0x1,%rdi
+  800f02:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f06:	80 f9 39             	cmp    $0x39,%cl
+  800f09:	76 dd                	jbe    800ee8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f0b:	80 f9 7b             	cmp    $0x7b,%cl
+  800f0e:	77 05                	ja     800f15 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f10:	83 e9 57             	sub    $0x57,%ecx
+  800f13:	eb d6                	jmp    800eeb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f15:	4d 85 d2             	test   %r10,%r10
+  800f18:	74 03                	je     800f1d <strtol+0xa7>
+  800f1a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f1d:	48 89 c2             	mov    %rax,%rdx
+  800f20:	48 f7 da             	neg    %rdx
+  800f23:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f27:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f2b:	c3                   	ret
+
+0000000000800f2c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f2c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f36:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f3c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f42:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f48:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f4a:	c3                   	ret
+
+0000000000800f4b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f4b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f50:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f55:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f65:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f6b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f71:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f73:	c3                   	ret
+
+0000000000800f74 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f74:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f77:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f7c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f81:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f86:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f8c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f92:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f98:	0f 05                	syscall
+    if (check && ret > 0) {
+  800f9a:	48 85 c0             	test   %rax,%rax
+  800f9d:	7f 01                	jg     800fa0 <sys_env_destroy+0x2c>
+}
+  800f9f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800fa0:	55                   	push   %rbp
+  800fa1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa4:	49 89 c0             	mov    %rax,%r8
+  800fa7:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fac:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  800fb3:	00 00 00 
+  800fb6:	be 29 00 00 00       	mov    $0x29,%esi
+  800fbb:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  800fc2:	00 00 00 
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  800fd1:	00 00 00 
+  800fd4:	41 ff d1             	call   *%r9
+
+0000000000800fd7 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fd7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fe6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800feb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800ff1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ff7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800ffd:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fff:	c3                   	ret
+
+0000000000801000 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801000:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801005:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80100f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801014:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80101a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801020:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801026:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801028:	c3                   	ret
+
+0000000000801029 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801029:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80102e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801035:	00 00 00 
+  801038:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80103e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801044:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80104a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80104c:	c3                   	ret
+
+000000000080104d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80104d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801050:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801055:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80105b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801061:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801063:	c3                   	ret
+
+0000000000801064 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801064:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801067:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80106c:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80106f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801075:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80107b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80107d:	48 85 c0             	test   %rax,%rax
+  801080:	7f 01                	jg     801083 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801082:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801083:	55                   	push   %rbp
+  801084:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801087:	49 89 c0             	mov    %rax,%r8
+  80108a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80108f:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801096:	00 00 00 
+  801099:	be 29 00 00 00       	mov    $0x29,%esi
+  80109e:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8010a5:	00 00 00 
+  8010a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ad:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  8010b4:	00 00 00 
+  8010b7:	41 ff d1             	call   *%r9
+
+00000000008010ba <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010ba:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010bd:	48 63 d2             	movslq %edx,%rdx
+  8010c0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010c8:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010cb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010cd:	48 85 c0             	test   %rax,%rax
+  8010d0:	7f 01                	jg     8010d3 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010d2:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010d7:	49 89 c0             	mov    %rax,%r8
+  8010da:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010df:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8010e6:	00 00 00 
+  8010e9:	be 29 00 00 00       	mov    $0x29,%esi
+  8010ee:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8010f5:	00 00 00 
+  8010f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fd:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  801104:	00 00 00 
+  801107:	41 ff d1             	call   *%r9
+
+000000000080110a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80110a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80110d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801112:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801118:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80111e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801124:	0f 05                	syscall
+    if (check && ret > 0) {
+  801126:	48 85 c0             	test   %rax,%rax
+  801129:	7f 01                	jg     80112c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80112b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80112c:	55                   	push   %rbp
+  80112d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801130:	49 89 c0             	mov    %rax,%r8
+  801133:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801138:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  80113f:	00 00 00 
+  801142:	be 29 00 00 00       	mov    $0x29,%esi
+  801147:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  80114e:	00 00 00 
+  801151:	b8 00 00 00 00       	mov    $0x0,%eax
+  801156:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  80115d:	00 00 00 
+  801160:	41 ff d1             	call   *%r9
+
+0000000000801163 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801163:	48 63 f6             	movslq %esi,%rsi
+  801166:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801169:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80116e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801173:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801179:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80117f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801185:	0f 05                	syscall
+    if (check && ret > 0) {
+  801187:	48 85 c0             	test   %rax,%rax
+  80118a:	7f 01                	jg     80118d <sys_env_set_status+0x2a>
+}
+  80118c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80118d:	55                   	push   %rbp
+  80118e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801191:	49 89 c0             	mov    %rax,%r8
+  801194:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801199:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8011a0:	00 00 00 
+  8011a3:	be 29 00 00 00       	mov    $0x29,%esi
+  8011a8:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8011af:	00 00 00 
+  8011b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011b7:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  8011be:	00 00 00 
+  8011c1:	41 ff d1             	call   *%r9
+
+00000000008011c4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011c4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011c7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011e5:	48 85 c0             	test   %rax,%rax
+  8011e8:	7f 01                	jg     8011eb <sys_env_set_trapframe+0x27>
+}
+  8011ea:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011eb:	55                   	push   %rbp
+  8011ec:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ef:	49 89 c0             	mov    %rax,%r8
+  8011f2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8011f7:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8011fe:	00 00 00 
+  801201:	be 29 00 00 00       	mov    $0x29,%esi
+  801206:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  80120d:	00 00 00 
+  801210:	b8 00 00 00 00       	mov    $0x0,%eax
+  801215:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  80121c:	00 00 00 
+  80121f:	41 ff d1             	call   *%r9
+
+0000000000801222 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801222:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801225:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80122a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80122f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80123b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801241:	0f 05                	syscall
+    if (check && ret > 0) {
+  801243:	48 85 c0             	test   %rax,%rax
+  801246:	7f 01                	jg     801249 <sys_env_set_pgfault_upcall+0x27>
+}
+  801248:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801249:	55                   	push   %rbp
+  80124a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124d:	49 89 c0             	mov    %rax,%r8
+  801250:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801255:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  80125c:	00 00 00 
+  80125f:	be 29 00 00 00       	mov    $0x29,%esi
+  801264:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  80126b:	00 00 00 
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801273:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  80127a:	00 00 00 
+  80127d:	41 ff d1             	call   *%r9
+
+0000000000801280 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801280:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801283:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801286:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128b:	4d 63 c0             	movslq %r8d,%r8
+  80128e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801294:	0f 05                	syscall
+}
+  801296:	c3                   	ret
+
+0000000000801297 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801297:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80129a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80129d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a2:	4d 63 c0             	movslq %r8d,%r8
+  8012a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012ab:	0f 05                	syscall
+}
+  8012ad:	c3                   	ret
+
+00000000008012ae <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012ae:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b3:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b6:	45 89 c0             	mov    %r8d,%r8d
+  8012b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012bf:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c1:	48 85 c0             	test   %rax,%rax
+  8012c4:	7f 01                	jg     8012c7 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012c6:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cb:	49 89 c0             	mov    %rax,%r8
+  8012ce:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012d3:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  8012da:	00 00 00 
+  8012dd:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e2:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  8012e9:	00 00 00 
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  8012f8:	00 00 00 
+  8012fb:	41 ff d1             	call   *%r9
+
+00000000008012fe <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8012fe:	55                   	push   %rbp
+  8012ff:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801302:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801308:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801312:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801319:	00 00 00 
+  80131c:	ff d0                	call   *%rax
+}
+  80131e:	5d                   	pop    %rbp
+  80131f:	c3                   	ret
+
+0000000000801320 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801320:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801325:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80132f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801334:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80133a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801340:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801346:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801348:	c3                   	ret
+
+0000000000801349 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801349:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80134e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801353:	ba 00 00 00 00       	mov    $0x0,%edx
+  801358:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80135e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801364:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80136a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80136c:	48 85 c0             	test   %rax,%rax
+  80136f:	7f 01                	jg     801372 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801371:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801376:	49 89 c0             	mov    %rax,%r8
+  801379:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80137e:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801385:	00 00 00 
+  801388:	be 29 00 00 00       	mov    $0x29,%esi
+  80138d:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801394:	00 00 00 
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139c:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  8013a3:	00 00 00 
+  8013a6:	41 ff d1             	call   *%r9
+
+00000000008013a9 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013a9:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013bd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013cf:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d1:	c3                   	ret
+
+00000000008013d2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013d2:	89 d2                	mov    %edx,%edx
+  8013d4:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013db:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ed:	0f 05                	syscall
+}
+  8013ef:	c3                   	ret
+
+00000000008013f0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8013f0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801403:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801409:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80140f:	0f 05                	syscall
+}
+  801411:	c3                   	ret
+
+0000000000801412 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801412:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801415:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80142b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801431:	0f 05                	syscall
+}
+  801433:	c3                   	ret
+
+0000000000801434 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801434:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801437:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80143c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801441:	ba 00 00 00 00       	mov    $0x0,%edx
+  801446:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801452:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801458:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145a:	48 85 c0             	test   %rax,%rax
+  80145d:	7f 01                	jg     801460 <sys_irq_ack+0x2c>
+}
+  80145f:	c3                   	ret
+sys_irq_ack(int irq) {
+  801460:	55                   	push   %rbp
+  801461:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801464:	49 89 c0             	mov    %rax,%r8
+  801467:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80146c:	48 ba 18 4c 80 00 00 	movabs $0x804c18,%rdx
+  801473:	00 00 00 
+  801476:	be 29 00 00 00       	mov    $0x29,%esi
+  80147b:	48 bf 37 4c 80 00 00 	movabs $0x804c37,%rdi
+  801482:	00 00 00 
+  801485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148a:	49 b9 82 41 80 00 00 	movabs $0x804182,%r9
+  801491:	00 00 00 
+  801494:	41 ff d1             	call   *%r9
+
+0000000000801497 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801497:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80149e:	ff ff ff 
+  8014a1:	48 01 f8             	add    %rdi,%rax
+  8014a4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014a8:	c3                   	ret
+
+00000000008014a9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014a9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014b0:	ff ff ff 
+  8014b3:	48 01 f8             	add    %rdi,%rax
+  8014b6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014ba:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014c0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014c4:	c3                   	ret
+
+00000000008014c5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+  8014c9:	41 57                	push   %r15
+  8014cb:	41 56                	push   %r14
+  8014cd:	41 55                	push   %r13
+  8014cf:	41 54                	push   %r12
+  8014d1:	53                   	push   %rbx
+  8014d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d6:	49 89 ff             	mov    %rdi,%r15
+  8014d9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014de:	49 bd 54 3c 80 00 00 	movabs $0x803c54,%r13
+  8014e5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014e8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8014ee:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8014f1:	48 89 df             	mov    %rbx,%rdi
+  8014f4:	41 ff d5             	call   *%r13
+  8014f7:	83 e0 04             	and    $0x4,%eax
+  8014fa:	74 17                	je     801513 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8014fc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801503:	4c 39 f3             	cmp    %r14,%rbx
+  801506:	75 e6                	jne    8014ee <fd_alloc+0x29>
+  801508:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80150e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801513:	4d 89 27             	mov    %r12,(%r15)
+}
+  801516:	48 83 c4 08          	add    $0x8,%rsp
+  80151a:	5b                   	pop    %rbx
+  80151b:	41 5c                	pop    %r12
+  80151d:	41 5d                	pop    %r13
+  80151f:	41 5e                	pop    %r14
+  801521:	41 5f                	pop    %r15
+  801523:	5d                   	pop    %rbp
+  801524:	c3                   	ret
+
+0000000000801525 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801525:	83 ff 1f             	cmp    $0x1f,%edi
+  801528:	77 39                	ja     801563 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80152a:	55                   	push   %rbp
+  80152b:	48 89 e5             	mov    %rsp,%rbp
+  80152e:	41 54                	push   %r12
+  801530:	53                   	push   %rbx
+  801531:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801534:	48 63 df             	movslq %edi,%rbx
+  801537:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80153e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801542:	48 89 df             	mov    %rbx,%rdi
+  801545:	48 b8 54 3c 80 00 00 	movabs $0x803c54,%rax
+  80154c:	00 00 00 
+  80154f:	ff d0                	call   *%rax
+  801551:	a8 04                	test   $0x4,%al
+  801553:	74 14                	je     801569 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801555:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801559:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80155e:	5b                   	pop    %rbx
+  80155f:	41 5c                	pop    %r12
+  801561:	5d                   	pop    %rbp
+  801562:	c3                   	ret
+        return -E_INVAL;
+  801563:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801568:	c3                   	ret
+        return -E_INVAL;
+  801569:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80156e:	eb ee                	jmp    80155e <fd_lookup+0x39>
+
+0000000000801570 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801570:	55                   	push   %rbp
+  801571:	48 89 e5             	mov    %rsp,%rbp
+  801574:	41 54                	push   %r12
+  801576:	53                   	push   %rbx
+  801577:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80157a:	48 b8 e0 4c 80 00 00 	movabs $0x804ce0,%rax
+  801581:	00 00 00 
+  801584:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80158b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80158e:	39 3b                	cmp    %edi,(%rbx)
+  801590:	74 47                	je     8015d9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801592:	48 83 c0 08          	add    $0x8,%rax
+  801596:	48 8b 18             	mov    (%rax),%rbx
+  801599:	48 85 db             	test   %rbx,%rbx
+  80159c:	75 f0                	jne    80158e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80159e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015a5:	00 00 00 
+  8015a8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8015ae:	89 fa                	mov    %edi,%edx
+  8015b0:	48 bf 48 4c 80 00 00 	movabs $0x804c48,%rdi
+  8015b7:	00 00 00 
+  8015ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bf:	48 b9 e0 01 80 00 00 	movabs $0x8001e0,%rcx
+  8015c6:	00 00 00 
+  8015c9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015d0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015d4:	5b                   	pop    %rbx
+  8015d5:	41 5c                	pop    %r12
+  8015d7:	5d                   	pop    %rbp
+  8015d8:	c3                   	ret
+            return 0;
+  8015d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015de:	eb f0                	jmp    8015d0 <dev_lookup+0x60>
+
+00000000008015e0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015e0:	55                   	push   %rbp
+  8015e1:	48 89 e5             	mov    %rsp,%rbp
+  8015e4:	41 55                	push   %r13
+  8015e6:	41 54                	push   %r12
+  8015e8:	53                   	push   %rbx
+  8015e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8015ed:	48 89 fb             	mov    %rdi,%rbx
+  8015f0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015f3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8015fa:	ff ff ff 
+  8015fd:	48 01 df             	add    %rbx,%rdi
+  801600:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801604:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801608:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  80160f:	00 00 00 
+  801612:	ff d0                	call   *%rax
+  801614:	41 89 c5             	mov    %eax,%r13d
+  801617:	85 c0                	test   %eax,%eax
+  801619:	78 06                	js     801621 <fd_close+0x41>
+  80161b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80161f:	74 1a                	je     80163b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801621:	45 84 e4             	test   %r12b,%r12b
+  801624:	b8 00 00 00 00       	mov    $0x0,%eax
+  801629:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80162d:	44 89 e8             	mov    %r13d,%eax
+  801630:	48 83 c4 18          	add    $0x18,%rsp
+  801634:	5b                   	pop    %rbx
+  801635:	41 5c                	pop    %r12
+  801637:	41 5d                	pop    %r13
+  801639:	5d                   	pop    %rbp
+  80163a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80163b:	8b 3b                	mov    (%rbx),%edi
+  80163d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801641:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801648:	00 00 00 
+  80164b:	ff d0                	call   *%rax
+  80164d:	41 89 c5             	mov    %eax,%r13d
+  801650:	85 c0                	test   %eax,%eax
+  801652:	78 1b                	js     80166f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801654:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801658:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80165c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801662:	48 85 c0             	test   %rax,%rax
+  801665:	74 08                	je     80166f <fd_close+0x8f>
+  801667:	48 89 df             	mov    %rbx,%rdi
+  80166a:	ff d0                	call   *%rax
+  80166c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80166f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801674:	48 89 de             	mov    %rbx,%rsi
+  801677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167c:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  801683:	00 00 00 
+  801686:	ff d0                	call   *%rax
+    return res;
+  801688:	eb a3                	jmp    80162d <fd_close+0x4d>
+
+000000000080168a <close>:
+
+int
+close(int fdnum) {
+  80168a:	55                   	push   %rbp
+  80168b:	48 89 e5             	mov    %rsp,%rbp
+  80168e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801692:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801696:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  80169d:	00 00 00 
+  8016a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016a2:	85 c0                	test   %eax,%eax
+  8016a4:	78 15                	js     8016bb <close+0x31>
+
+    return fd_close(fd, 1);
+  8016a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8016ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016af:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  8016b6:	00 00 00 
+  8016b9:	ff d0                	call   *%rax
+}
+  8016bb:	c9                   	leave
+  8016bc:	c3                   	ret
+
+00000000008016bd <close_all>:
+
+void
+close_all(void) {
+  8016bd:	55                   	push   %rbp
+  8016be:	48 89 e5             	mov    %rsp,%rbp
+  8016c1:	41 54                	push   %r12
+  8016c3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016c9:	49 bc 8a 16 80 00 00 	movabs $0x80168a,%r12
+  8016d0:	00 00 00 
+  8016d3:	89 df                	mov    %ebx,%edi
+  8016d5:	41 ff d4             	call   *%r12
+  8016d8:	83 c3 01             	add    $0x1,%ebx
+  8016db:	83 fb 20             	cmp    $0x20,%ebx
+  8016de:	75 f3                	jne    8016d3 <close_all+0x16>
+}
+  8016e0:	5b                   	pop    %rbx
+  8016e1:	41 5c                	pop    %r12
+  8016e3:	5d                   	pop    %rbp
+  8016e4:	c3                   	ret
+
+00000000008016e5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016e5:	55                   	push   %rbp
+  8016e6:	48 89 e5             	mov    %rsp,%rbp
+  8016e9:	41 57                	push   %r15
+  8016eb:	41 56                	push   %r14
+  8016ed:	41 55                	push   %r13
+  8016ef:	41 54                	push   %r12
+  8016f1:	53                   	push   %rbx
+  8016f2:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8016f9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8016fd:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  801704:	00 00 00 
+  801707:	ff d0                	call   *%rax
+  801709:	89 c3                	mov    %eax,%ebx
+  80170b:	85 c0                	test   %eax,%eax
+  80170d:	0f 88 b8 00 00 00    	js     8017cb <dup+0xe6>
+    close(newfdnum);
+  801713:	44 89 e7             	mov    %r12d,%edi
+  801716:	48 b8 8a 16 80 00 00 	movabs $0x80168a,%rax
+  80171d:	00 00 00 
+  801720:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801722:	4d 63 ec             	movslq %r12d,%r13
+  801725:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80172c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801730:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801734:	4c 89 ff             	mov    %r15,%rdi
+  801737:	49 be a9 14 80 00 00 	movabs $0x8014a9,%r14
+  80173e:	00 00 00 
+  801741:	41 ff d6             	call   *%r14
+  801744:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801747:	4c 89 ef             	mov    %r13,%rdi
+  80174a:	41 ff d6             	call   *%r14
+  80174d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801750:	48 89 df             	mov    %rbx,%rdi
+  801753:	48 b8 54 3c 80 00 00 	movabs $0x803c54,%rax
+  80175a:	00 00 00 
+  80175d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80175f:	a8 04                	test   $0x4,%al
+  801761:	74 2b                	je     80178e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801763:	41 89 c1             	mov    %eax,%r9d
+  801766:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80176c:	4c 89 f1             	mov    %r14,%rcx
+  80176f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801774:	48 89 de             	mov    %rbx,%rsi
+  801777:	bf 00 00 00 00       	mov    $0x0,%edi
+  80177c:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  801783:	00 00 00 
+  801786:	ff d0                	call   *%rax
+  801788:	89 c3                	mov    %eax,%ebx
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	78 4e                	js     8017dc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80178e:	4c 89 ff             	mov    %r15,%rdi
+  801791:	48 b8 54 3c 80 00 00 	movabs $0x803c54,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+  80179d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8017a0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017a6:	4c 89 e9             	mov    %r13,%rcx
+  8017a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ae:	4c 89 fe             	mov    %r15,%rsi
+  8017b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b6:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+  8017c2:	89 c3                	mov    %eax,%ebx
+  8017c4:	85 c0                	test   %eax,%eax
+  8017c6:	78 14                	js     8017dc <dup+0xf7>
+
+    return newfdnum;
+  8017c8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017cb:	89 d8                	mov    %ebx,%eax
+  8017cd:	48 83 c4 18          	add    $0x18,%rsp
+  8017d1:	5b                   	pop    %rbx
+  8017d2:	41 5c                	pop    %r12
+  8017d4:	41 5d                	pop    %r13
+  8017d6:	41 5e                	pop    %r14
+  8017d8:	41 5f                	pop    %r15
+  8017da:	5d                   	pop    %rbp
+  8017db:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017dc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017e1:	4c 89 ee             	mov    %r13,%rsi
+  8017e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017e9:	49 bc 0a 11 80 00 00 	movabs $0x80110a,%r12
+  8017f0:	00 00 00 
+  8017f3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8017f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017fb:	4c 89 f6             	mov    %r14,%rsi
+  8017fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801803:	41 ff d4             	call   *%r12
+    return res;
+  801806:	eb c3                	jmp    8017cb <dup+0xe6>
+
+0000000000801808 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801808:	55                   	push   %rbp
+  801809:	48 89 e5             	mov    %rsp,%rbp
+  80180c:	41 56                	push   %r14
+  80180e:	41 55                	push   %r13
+  801810:	41 54                	push   %r12
+  801812:	53                   	push   %rbx
+  801813:	48 83 ec 10          	sub    $0x10,%rsp
+  801817:	89 fb                	mov    %edi,%ebx
+  801819:	49 89 f4             	mov    %rsi,%r12
+  80181c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80181f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801823:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  80182a:	00 00 00 
+  80182d:	ff d0                	call   *%rax
+  80182f:	85 c0                	test   %eax,%eax
+  801831:	78 4c                	js     80187f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801833:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801837:	41 8b 3e             	mov    (%r14),%edi
+  80183a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80183e:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801845:	00 00 00 
+  801848:	ff d0                	call   *%rax
+  80184a:	85 c0                	test   %eax,%eax
+  80184c:	78 35                	js     801883 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80184e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801852:	83 e0 03             	and    $0x3,%eax
+  801855:	83 f8 01             	cmp    $0x1,%eax
+  801858:	74 2d                	je     801887 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80185a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80185e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801862:	48 85 c0             	test   %rax,%rax
+  801865:	74 56                	je     8018bd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801867:	4c 89 ea             	mov    %r13,%rdx
+  80186a:	4c 89 e6             	mov    %r12,%rsi
+  80186d:	4c 89 f7             	mov    %r14,%rdi
+  801870:	ff d0                	call   *%rax
+}
+  801872:	48 83 c4 10          	add    $0x10,%rsp
+  801876:	5b                   	pop    %rbx
+  801877:	41 5c                	pop    %r12
+  801879:	41 5d                	pop    %r13
+  80187b:	41 5e                	pop    %r14
+  80187d:	5d                   	pop    %rbp
+  80187e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80187f:	48 98                	cltq
+  801881:	eb ef                	jmp    801872 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801883:	48 98                	cltq
+  801885:	eb eb                	jmp    801872 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801887:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80188e:	00 00 00 
+  801891:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801897:	89 da                	mov    %ebx,%edx
+  801899:	48 bf 89 4c 80 00 00 	movabs $0x804c89,%rdi
+  8018a0:	00 00 00 
+  8018a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018a8:	48 b9 e0 01 80 00 00 	movabs $0x8001e0,%rcx
+  8018af:	00 00 00 
+  8018b2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018b4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018bb:	eb b5                	jmp    801872 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018bd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018c4:	eb ac                	jmp    801872 <read+0x6a>
+
+00000000008018c6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018c6:	55                   	push   %rbp
+  8018c7:	48 89 e5             	mov    %rsp,%rbp
+  8018ca:	41 57                	push   %r15
+  8018cc:	41 56                	push   %r14
+  8018ce:	41 55                	push   %r13
+  8018d0:	41 54                	push   %r12
+  8018d2:	53                   	push   %rbx
+  8018d3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018d7:	48 85 d2             	test   %rdx,%rdx
+  8018da:	74 54                	je     801930 <readn+0x6a>
+  8018dc:	41 89 fd             	mov    %edi,%r13d
+  8018df:	49 89 f6             	mov    %rsi,%r14
+  8018e2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018e5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018ea:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8018ef:	49 bf 08 18 80 00 00 	movabs $0x801808,%r15
+  8018f6:	00 00 00 
+  8018f9:	4c 89 e2             	mov    %r12,%rdx
+  8018fc:	48 29 f2             	sub    %rsi,%rdx
+  8018ff:	4c 01 f6             	add    %r14,%rsi
+  801902:	44 89 ef             	mov    %r13d,%edi
+  801905:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801908:	85 c0                	test   %eax,%eax
+  80190a:	78 20                	js     80192c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80190c:	01 c3                	add    %eax,%ebx
+  80190e:	85 c0                	test   %eax,%eax
+  801910:	74 08                	je     80191a <readn+0x54>
+  801912:	48 63 f3             	movslq %ebx,%rsi
+  801915:	4c 39 e6             	cmp    %r12,%rsi
+  801918:	72 df                	jb     8018f9 <readn+0x33>
+    }
+    return res;
+  80191a:	48 63 c3             	movslq %ebx,%rax
+}
+  80191d:	48 83 c4 08          	add    $0x8,%rsp
+  801921:	5b                   	pop    %rbx
+  801922:	41 5c                	pop    %r12
+  801924:	41 5d                	pop    %r13
+  801926:	41 5e                	pop    %r14
+  801928:	41 5f                	pop    %r15
+  80192a:	5d                   	pop    %rbp
+  80192b:	c3                   	ret
+        if (inc < 0) return inc;
+  80192c:	48 98                	cltq
+  80192e:	eb ed                	jmp    80191d <readn+0x57>
+    int inc = 1, res = 0;
+  801930:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801935:	eb e3                	jmp    80191a <readn+0x54>
+
+0000000000801937 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801937:	55                   	push   %rbp
+  801938:	48 89 e5             	mov    %rsp,%rbp
+  80193b:	41 56                	push   %r14
+  80193d:	41 55                	push   %r13
+  80193f:	41 54                	push   %r12
+  801941:	53                   	push   %rbx
+  801942:	48 83 ec 10          	sub    $0x10,%rsp
+  801946:	89 fb                	mov    %edi,%ebx
+  801948:	49 89 f4             	mov    %rsi,%r12
+  80194b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80194e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801952:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  801959:	00 00 00 
+  80195c:	ff d0                	call   *%rax
+  80195e:	85 c0                	test   %eax,%eax
+  801960:	78 47                	js     8019a9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801962:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801966:	41 8b 3e             	mov    (%r14),%edi
+  801969:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80196d:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801974:	00 00 00 
+  801977:	ff d0                	call   *%rax
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 30                	js     8019ad <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80197d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801982:	74 2d                	je     8019b1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801984:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801988:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80198c:	48 85 c0             	test   %rax,%rax
+  80198f:	74 56                	je     8019e7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801991:	4c 89 ea             	mov    %r13,%rdx
+  801994:	4c 89 e6             	mov    %r12,%rsi
+  801997:	4c 89 f7             	mov    %r14,%rdi
+  80199a:	ff d0                	call   *%rax
+}
+  80199c:	48 83 c4 10          	add    $0x10,%rsp
+  8019a0:	5b                   	pop    %rbx
+  8019a1:	41 5c                	pop    %r12
+  8019a3:	41 5d                	pop    %r13
+  8019a5:	41 5e                	pop    %r14
+  8019a7:	5d                   	pop    %rbp
+  8019a8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019a9:	48 98                	cltq
+  8019ab:	eb ef                	jmp    80199c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019ad:	48 98                	cltq
+  8019af:	eb eb                	jmp    80199c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019b1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019b8:	00 00 00 
+  8019bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019c1:	89 da                	mov    %ebx,%edx
+  8019c3:	48 bf a5 4c 80 00 00 	movabs $0x804ca5,%rdi
+  8019ca:	00 00 00 
+  8019cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d2:	48 b9 e0 01 80 00 00 	movabs $0x8001e0,%rcx
+  8019d9:	00 00 00 
+  8019dc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019de:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019e5:	eb b5                	jmp    80199c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019e7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019ee:	eb ac                	jmp    80199c <write+0x65>
+
+00000000008019f0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8019f0:	55                   	push   %rbp
+  8019f1:	48 89 e5             	mov    %rsp,%rbp
+  8019f4:	41 54                	push   %r12
+  8019f6:	53                   	push   %rbx
+  8019f7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019fb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019fd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a01:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+  801a0d:	85 c0                	test   %eax,%eax
+  801a0f:	78 3e                	js     801a4f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a11:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a15:	41 8b 3c 24          	mov    (%r12),%edi
+  801a19:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a1d:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801a24:	00 00 00 
+  801a27:	ff d0                	call   *%rax
+  801a29:	85 c0                	test   %eax,%eax
+  801a2b:	78 22                	js     801a4f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a31:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a35:	48 85 c0             	test   %rax,%rax
+  801a38:	74 0b                	je     801a45 <seek+0x55>
+  801a3a:	89 de                	mov    %ebx,%esi
+  801a3c:	4c 89 e7             	mov    %r12,%rdi
+  801a3f:	ff d0                	call   *%rax
+  801a41:	85 c0                	test   %eax,%eax
+  801a43:	78 0a                	js     801a4f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a45:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a4a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a4f:	48 83 c4 10          	add    $0x10,%rsp
+  801a53:	5b                   	pop    %rbx
+  801a54:	41 5c                	pop    %r12
+  801a56:	5d                   	pop    %rbp
+  801a57:	c3                   	ret
+
+0000000000801a58 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a58:	55                   	push   %rbp
+  801a59:	48 89 e5             	mov    %rsp,%rbp
+  801a5c:	41 55                	push   %r13
+  801a5e:	41 54                	push   %r12
+  801a60:	53                   	push   %rbx
+  801a61:	48 83 ec 18          	sub    $0x18,%rsp
+  801a65:	89 fb                	mov    %edi,%ebx
+  801a67:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a6a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a6e:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 38                	js     801ab6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a7e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a82:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a86:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a8a:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801a91:	00 00 00 
+  801a94:	ff d0                	call   *%rax
+  801a96:	85 c0                	test   %eax,%eax
+  801a98:	78 1c                	js     801ab6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a9a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801a9f:	74 20                	je     801ac1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801aa9:	48 85 c0             	test   %rax,%rax
+  801aac:	74 47                	je     801af5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801aae:	44 89 e6             	mov    %r12d,%esi
+  801ab1:	4c 89 ef             	mov    %r13,%rdi
+  801ab4:	ff d0                	call   *%rax
+}
+  801ab6:	48 83 c4 18          	add    $0x18,%rsp
+  801aba:	5b                   	pop    %rbx
+  801abb:	41 5c                	pop    %r12
+  801abd:	41 5d                	pop    %r13
+  801abf:	5d                   	pop    %rbp
+  801ac0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ac1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ac8:	00 00 00 
+  801acb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ad1:	89 da                	mov    %ebx,%edx
+  801ad3:	48 bf 68 4c 80 00 00 	movabs $0x804c68,%rdi
+  801ada:	00 00 00 
+  801add:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae2:	48 b9 e0 01 80 00 00 	movabs $0x8001e0,%rcx
+  801ae9:	00 00 00 
+  801aec:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801aee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af3:	eb c1                	jmp    801ab6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801af5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801afa:	eb ba                	jmp    801ab6 <ftruncate+0x5e>
+
+0000000000801afc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801afc:	55                   	push   %rbp
+  801afd:	48 89 e5             	mov    %rsp,%rbp
+  801b00:	41 54                	push   %r12
+  801b02:	53                   	push   %rbx
+  801b03:	48 83 ec 10          	sub    $0x10,%rsp
+  801b07:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b0a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b0e:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  801b15:	00 00 00 
+  801b18:	ff d0                	call   *%rax
+  801b1a:	85 c0                	test   %eax,%eax
+  801b1c:	78 4e                	js     801b6c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b1e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b22:	41 8b 3c 24          	mov    (%r12),%edi
+  801b26:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b2a:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+  801b36:	85 c0                	test   %eax,%eax
+  801b38:	78 32                	js     801b6c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b3a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b3e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b43:	74 30                	je     801b75 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b45:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b48:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b4f:	00 00 00 
+    stat->st_isdir = 0;
+  801b52:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b59:	00 00 00 
+    stat->st_dev = dev;
+  801b5c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b63:	48 89 de             	mov    %rbx,%rsi
+  801b66:	4c 89 e7             	mov    %r12,%rdi
+  801b69:	ff 50 28             	call   *0x28(%rax)
+}
+  801b6c:	48 83 c4 10          	add    $0x10,%rsp
+  801b70:	5b                   	pop    %rbx
+  801b71:	41 5c                	pop    %r12
+  801b73:	5d                   	pop    %rbp
+  801b74:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b75:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b7a:	eb f0                	jmp    801b6c <fstat+0x70>
+
+0000000000801b7c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+  801b80:	41 54                	push   %r12
+  801b82:	53                   	push   %rbx
+  801b83:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b86:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8b:	48 b8 ea 2c 80 00 00 	movabs $0x802cea,%rax
+  801b92:	00 00 00 
+  801b95:	ff d0                	call   *%rax
+  801b97:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	78 25                	js     801bc2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801b9d:	4c 89 e6             	mov    %r12,%rsi
+  801ba0:	89 c7                	mov    %eax,%edi
+  801ba2:	48 b8 fc 1a 80 00 00 	movabs $0x801afc,%rax
+  801ba9:	00 00 00 
+  801bac:	ff d0                	call   *%rax
+  801bae:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bb1:	89 df                	mov    %ebx,%edi
+  801bb3:	48 b8 8a 16 80 00 00 	movabs $0x80168a,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+
+    return res;
+  801bbf:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bc2:	89 d8                	mov    %ebx,%eax
+  801bc4:	5b                   	pop    %rbx
+  801bc5:	41 5c                	pop    %r12
+  801bc7:	5d                   	pop    %rbp
+  801bc8:	c3                   	ret
+
+0000000000801bc9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bc9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801bd0:	00 00 00 
+  801bd3:	83 38 00             	cmpl   $0x0,(%rax)
+  801bd6:	74 0a                	je     801be2 <fsenv+0x19>
+    return envid;
+}
+  801bd8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bdf:	00 00 
+  801be1:	c3                   	ret
+fsenv(void) {
+  801be2:	55                   	push   %rbp
+  801be3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801be6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801beb:	48 b8 5a 46 80 00 00 	movabs $0x80465a,%rax
+  801bf2:	00 00 00 
+  801bf5:	ff d0                	call   *%rax
+  801bf7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801bfe:	00 00 
+}
+  801c00:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801c07:	00 00 
+  801c09:	5d                   	pop    %rbp
+  801c0a:	c3                   	ret
+
+0000000000801c0b <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801c0b:	55                   	push   %rbp
+  801c0c:	48 89 e5             	mov    %rsp,%rbp
+  801c0f:	41 54                	push   %r12
+  801c11:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c12:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c17:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c1c:	48 89 de             	mov    %rbx,%rsi
+  801c1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c24:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  801c2b:	00 00 00 
+  801c2e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c30:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c37:	00 00 00 
+  801c3a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c40:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c45:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c4a:	48 89 de             	mov    %rbx,%rsi
+  801c4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c52:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  801c59:	00 00 00 
+  801c5c:	ff d0                	call   *%rax
+  801c5e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c60:	85 c0                	test   %eax,%eax
+  801c62:	0f 88 a2 00 00 00    	js     801d0a <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c68:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c6f:	00 00 00 
+  801c72:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c78:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c7d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c7f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c84:	49 bc 1c 3e 80 00 00 	movabs $0x803e1c,%r12
+  801c8b:	00 00 00 
+  801c8e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801c91:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801c96:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c99:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  801ca0:	00 00 00 
+  801ca3:	ff d0                	call   *%rax
+  801ca5:	89 c7                	mov    %eax,%edi
+  801ca7:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801cad:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801cb2:	48 89 da             	mov    %rbx,%rdx
+  801cb5:	be 09 00 00 00       	mov    $0x9,%esi
+  801cba:	48 b8 04 46 80 00 00 	movabs $0x804604,%rax
+  801cc1:	00 00 00 
+  801cc4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cc6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ccb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd0:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cda:	48 b8 e0 45 80 00 00 	movabs $0x8045e0,%rax
+  801ce1:	00 00 00 
+  801ce4:	ff d0                	call   *%rax
+  801ce6:	89 c3                	mov    %eax,%ebx
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	78 25                	js     801d11 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801cec:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cf3:	00 00 00 
+  801cf6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801cfc:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801d03:	00 00 
+    return 0;
+  801d05:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801d0a:	89 d8                	mov    %ebx,%eax
+  801d0c:	5b                   	pop    %rbx
+  801d0d:	41 5c                	pop    %r12
+  801d0f:	5d                   	pop    %rbp
+  801d10:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d11:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d16:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d20:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+        return res;
+  801d2c:	eb dc                	jmp    801d0a <fschan_setup+0xff>
+
+0000000000801d2e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d2e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d35:	00 00 00 
+  801d38:	80 38 00             	cmpb   $0x0,(%rax)
+  801d3b:	74 55                	je     801d92 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d3d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d44:	00 00 00 
+  801d47:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d4d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d52:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d59:	00 00 00 
+  801d5c:	3b 0a                	cmp    (%rdx),%ecx
+  801d5e:	75 01                	jne    801d61 <fschan+0x33>
+}
+  801d60:	c3                   	ret
+fschan(void) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d65:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+  801d71:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d73:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d78:	85 d2                	test   %edx,%edx
+  801d7a:	78 02                	js     801d7e <fschan+0x50>
+}
+  801d7c:	5d                   	pop    %rbp
+  801d7d:	c3                   	ret
+        fschan_enabled = 0;
+  801d7e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d85:	00 00 00 
+  801d88:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d90:	eb ea                	jmp    801d7c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801d92:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d97:	c3                   	ret
+
+0000000000801d98 <fbuf>:
+fbuf(struct Fd *fd) {
+  801d98:	55                   	push   %rbp
+  801d99:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801d9c:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  801da3:	00 00 00 
+  801da6:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dad:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801db1:	77 12                	ja     801dc5 <fbuf+0x2d>
+  801db3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801db7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801dbe:	00 00 00 
+  801dc1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801dc5:	48 89 d0             	mov    %rdx,%rax
+  801dc8:	5d                   	pop    %rbp
+  801dc9:	c3                   	ret
+
+0000000000801dca <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801dca:	55                   	push   %rbp
+  801dcb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801dce:	48 83 c7 40          	add    $0x40,%rdi
+  801dd2:	48 b8 56 3e 80 00 00 	movabs $0x803e56,%rax
+  801dd9:	00 00 00 
+  801ddc:	ff d0                	call   *%rax
+  801dde:	84 c0                	test   %al,%al
+  801de0:	75 02                	jne    801de4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801de2:	5d                   	pop    %rbp
+  801de3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801de4:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  801deb:	00 00 00 
+  801dee:	ff d0                	call   *%rax
+  801df0:	89 c7                	mov    %eax,%edi
+  801df2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801df8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801dfd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e02:	be 0a 00 00 00       	mov    $0xa,%esi
+  801e07:	48 b8 04 46 80 00 00 	movabs $0x804604,%rax
+  801e0e:	00 00 00 
+  801e11:	ff d0                	call   *%rax
+}
+  801e13:	eb cd                	jmp    801de2 <fschan_publish+0x18>
+
+0000000000801e15 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e15:	55                   	push   %rbp
+  801e16:	48 89 e5             	mov    %rsp,%rbp
+  801e19:	41 57                	push   %r15
+  801e1b:	41 56                	push   %r14
+  801e1d:	41 55                	push   %r13
+  801e1f:	41 54                	push   %r12
+  801e21:	53                   	push   %rbx
+  801e22:	48 83 ec 48          	sub    $0x48,%rsp
+  801e26:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e2a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e2e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e31:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e35:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e38:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e3f:	00 00 00 
+  801e42:	8b 02                	mov    (%rdx),%eax
+  801e44:	83 c0 01             	add    $0x1,%eax
+  801e47:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e4c:	0f 44 c1             	cmove  %ecx,%eax
+  801e4f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e51:	4d 85 c0             	test   %r8,%r8
+  801e54:	74 2c                	je     801e82 <fschan_rw+0x6d>
+  801e56:	45 89 ce             	mov    %r9d,%r14d
+  801e59:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e60:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e64:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e6a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e71:	00 
+  801e72:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e78:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e7d:	e9 41 01 00 00       	jmp    801fc3 <fschan_rw+0x1ae>
+  801e82:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e86:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e8a:	e9 9c 01 00 00       	jmp    80202b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801e8f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801e93:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801e96:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801e99:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801e9c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801ea0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801ea4:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801ea8:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801eac:	48 89 da             	mov    %rbx,%rdx
+  801eaf:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801ebb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801ebf:	48 b8 ca 1d 80 00 00 	movabs $0x801dca,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+            queued += blk;
+  801ecb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ece:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ed2:	4d 39 fc             	cmp    %r15,%r12
+  801ed5:	73 6b                	jae    801f42 <fschan_rw+0x12d>
+  801ed7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801edb:	77 65                	ja     801f42 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801edd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ee1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801ee5:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  801eec:	00 00 00 
+  801eef:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801ef1:	4c 89 fb             	mov    %r15,%rbx
+  801ef4:	4c 29 e3             	sub    %r12,%rbx
+  801ef7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801efc:	48 39 d3             	cmp    %rdx,%rbx
+  801eff:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801f03:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801f07:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801f0b:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801f0f:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f12:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f14:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f1b:	00 00 00 
+  801f1e:	8b 09                	mov    (%rcx),%ecx
+  801f20:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f23:	83 fe 03             	cmp    $0x3,%esi
+  801f26:	0f 85 63 ff ff ff    	jne    801e8f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f2c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f30:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f33:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f36:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f39:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f3d:	e9 79 ff ff ff       	jmp    801ebb <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f46:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f4d:	48 89 df             	mov    %rbx,%rdi
+  801f50:	48 b8 f4 3e 80 00 00 	movabs $0x803ef4,%rax
+  801f57:	00 00 00 
+  801f5a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f5c:	48 89 df             	mov    %rbx,%rdi
+  801f5f:	48 b8 82 3e 80 00 00 	movabs $0x803e82,%rax
+  801f66:	00 00 00 
+  801f69:	ff d0                	call   *%rax
+  801f6b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f6f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f73:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f77:	75 25                	jne    801f9e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f79:	8b 40 04             	mov    0x4(%rax),%eax
+  801f7c:	85 c0                	test   %eax,%eax
+  801f7e:	0f 88 86 00 00 00    	js     80200a <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f84:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f88:	74 5b                	je     801fe5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f8a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f8e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801f92:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801f96:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801f9a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801f9e:	48 89 df             	mov    %rbx,%rdi
+  801fa1:	48 b8 a9 3e 80 00 00 	movabs $0x803ea9,%rax
+  801fa8:	00 00 00 
+  801fab:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801fad:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801fb1:	83 f0 01             	xor    $0x1,%eax
+  801fb4:	4d 39 fc             	cmp    %r15,%r12
+  801fb7:	0f 92 c2             	setb   %dl
+  801fba:	84 c2                	test   %al,%dl
+  801fbc:	75 05                	jne    801fc3 <fschan_rw+0x1ae>
+  801fbe:	45 85 ed             	test   %r13d,%r13d
+  801fc1:	74 50                	je     802013 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fc3:	4d 39 fc             	cmp    %r15,%r12
+  801fc6:	0f 92 c1             	setb   %cl
+  801fc9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fcd:	0f 96 c2             	setbe  %dl
+  801fd0:	84 d1                	test   %dl,%cl
+  801fd2:	0f 84 6a ff ff ff    	je     801f42 <fschan_rw+0x12d>
+  801fd8:	84 c0                	test   %al,%al
+  801fda:	0f 85 fd fe ff ff    	jne    801edd <fschan_rw+0xc8>
+  801fe0:	e9 5d ff ff ff       	jmp    801f42 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801fe5:	48 63 d0             	movslq %eax,%rdx
+  801fe8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fec:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801ff0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801ff4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801ff8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801ffc:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  802003:	00 00 00 
+  802006:	ff d0                	call   *%rax
+  802008:	eb 80                	jmp    801f8a <fschan_rw+0x175>
+                err = msg->fm_res;
+  80200a:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80200d:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802011:	eb 8b                	jmp    801f9e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802013:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802018:	0f 85 68 fe ff ff    	jne    801e86 <fschan_rw+0x71>
+  80201e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802021:	85 c0                	test   %eax,%eax
+  802023:	0f 84 5d fe ff ff    	je     801e86 <fschan_rw+0x71>
+  802029:	48 98                	cltq
+}
+  80202b:	48 83 c4 48          	add    $0x48,%rsp
+  80202f:	5b                   	pop    %rbx
+  802030:	41 5c                	pop    %r12
+  802032:	41 5d                	pop    %r13
+  802034:	41 5e                	pop    %r14
+  802036:	41 5f                	pop    %r15
+  802038:	5d                   	pop    %rbp
+  802039:	c3                   	ret
+
+000000000080203a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80203a:	55                   	push   %rbp
+  80203b:	48 89 e5             	mov    %rsp,%rbp
+  80203e:	41 56                	push   %r14
+  802040:	41 55                	push   %r13
+  802042:	41 54                	push   %r12
+  802044:	53                   	push   %rbx
+  802045:	48 83 ec 10          	sub    $0x10,%rsp
+  802049:	49 89 fe             	mov    %rdi,%r14
+  80204c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80204f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802053:	48 29 f3             	sub    %rsi,%rbx
+  802056:	48 39 d3             	cmp    %rdx,%rbx
+  802059:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80205d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802064:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802065:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80206a:	49 bd b3 3c 80 00 00 	movabs $0x803cb3,%r13
+  802071:	00 00 00 
+  802074:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80207b:	76 1e                	jbe    80209b <mmap_fault+0x61>
+  80207d:	4c 01 e7             	add    %r12,%rdi
+  802080:	41 ff d5             	call   *%r13
+  802083:	84 c0                	test   %al,%al
+  802085:	75 14                	jne    80209b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802087:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802092:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802096:	48 39 df             	cmp    %rbx,%rdi
+  802099:	72 e2                	jb     80207d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80209b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8020a2:	00 00 00 
+  8020a5:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8020ac:	00 00 00 
+  8020af:	4c 89 f0             	mov    %r14,%rax
+  8020b2:	48 29 d0             	sub    %rdx,%rax
+  8020b5:	48 c1 f8 03          	sar    $0x3,%rax
+  8020b9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020c0:	aa aa aa 
+  8020c3:	48 0f af c2          	imul   %rdx,%rax
+  8020c7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020cb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020d0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020d4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020d6:	44 89 e0             	mov    %r12d,%eax
+  8020d9:	41 03 46 10          	add    0x10(%r14),%eax
+  8020dd:	41 2b 06             	sub    (%r14),%eax
+  8020e0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020e3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020e7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020eb:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8020ef:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8020f2:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  8020f9:	00 00 00 
+  8020fc:	ff d0                	call   *%rax
+  8020fe:	89 c7                	mov    %eax,%edi
+  802100:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802106:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80210b:	48 89 da             	mov    %rbx,%rdx
+  80210e:	be 0f 00 00 00       	mov    $0xf,%esi
+  802113:	48 b8 04 46 80 00 00 	movabs $0x804604,%rax
+  80211a:	00 00 00 
+  80211d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80211f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802124:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802128:	4c 89 e6             	mov    %r12,%rsi
+  80212b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802130:	48 b8 e0 45 80 00 00 	movabs $0x8045e0,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+  80213c:	48 98                	cltq
+}
+  80213e:	48 83 c4 10          	add    $0x10,%rsp
+  802142:	5b                   	pop    %rbx
+  802143:	41 5c                	pop    %r12
+  802145:	41 5d                	pop    %r13
+  802147:	41 5e                	pop    %r14
+  802149:	5d                   	pop    %rbp
+  80214a:	c3                   	ret
+
+000000000080214b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80214b:	48 8b 37             	mov    (%rdi),%rsi
+  80214e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802155:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80215c:	00 00 00 
+  80215f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802164:	eb 0f                	jmp    802175 <mmap_pgfault+0x2a>
+  802166:	c3                   	ret
+  802167:	48 83 c1 01          	add    $0x1,%rcx
+  80216b:	48 83 c2 18          	add    $0x18,%rdx
+  80216f:	48 83 f9 20          	cmp    $0x20,%rcx
+  802173:	74 6e                	je     8021e3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802175:	48 8b 02             	mov    (%rdx),%rax
+  802178:	48 83 e8 01          	sub    $0x1,%rax
+  80217c:	48 39 f0             	cmp    %rsi,%rax
+  80217f:	73 e6                	jae    802167 <mmap_pgfault+0x1c>
+  802181:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802185:	73 e0                	jae    802167 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802187:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80218b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802190:	f6 c2 01             	test   $0x1,%dl
+  802193:	75 d1                	jne    802166 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802195:	f6 c2 02             	test   $0x2,%dl
+  802198:	74 1a                	je     8021b4 <mmap_pgfault+0x69>
+  80219a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a3:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8021aa:	00 00 00 
+  8021ad:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021b2:	74 35                	je     8021e9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021b4:	55                   	push   %rbp
+  8021b5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021b8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021bc:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021c3:	00 00 00 
+  8021c6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021ca:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021cf:	48 b8 3a 20 80 00 00 	movabs $0x80203a,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+  8021db:	48 85 c0             	test   %rax,%rax
+  8021de:	0f 9f c0             	setg   %al
+}
+  8021e1:	5d                   	pop    %rbp
+  8021e2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e8:	c3                   	ret
+}
+  8021e9:	c3                   	ret
+
+00000000008021ea <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021ea:	55                   	push   %rbp
+  8021eb:	48 89 e5             	mov    %rsp,%rbp
+  8021ee:	41 54                	push   %r12
+  8021f0:	53                   	push   %rbx
+  8021f1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021fb:	00 00 00 
+  8021fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802203:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802207:	74 15                	je     80221e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802209:	48 83 c3 01          	add    $0x1,%rbx
+  80220d:	48 83 c0 18          	add    $0x18,%rax
+  802211:	48 83 fb 20          	cmp    $0x20,%rbx
+  802215:	75 ec                	jne    802203 <mmap_alloc+0x19>
+    return NULL;
+  802217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221c:	eb 52                	jmp    802270 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80221e:	4c 89 e7             	mov    %r12,%rdi
+  802221:	48 b8 54 3c 80 00 00 	movabs $0x803c54,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+  80222d:	41 89 c1             	mov    %eax,%r9d
+  802230:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802237:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80223b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802241:	ba 00 00 00 00       	mov    $0x0,%edx
+  802246:	4c 89 e6             	mov    %r12,%rsi
+  802249:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224e:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  802255:	00 00 00 
+  802258:	ff d0                	call   *%rax
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	78 17                	js     802275 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80225e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802262:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802269:	00 00 00 
+  80226c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802270:	5b                   	pop    %rbx
+  802271:	41 5c                	pop    %r12
+  802273:	5d                   	pop    %rbp
+  802274:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802275:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227a:	eb f4                	jmp    802270 <mmap_alloc+0x86>
+
+000000000080227c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80227c:	55                   	push   %rbp
+  80227d:	48 89 e5             	mov    %rsp,%rbp
+  802280:	41 56                	push   %r14
+  802282:	41 55                	push   %r13
+  802284:	41 54                	push   %r12
+  802286:	53                   	push   %rbx
+  802287:	48 83 ec 10          	sub    $0x10,%rsp
+  80228b:	41 89 fc             	mov    %edi,%r12d
+  80228e:	49 89 f5             	mov    %rsi,%r13
+  802291:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802294:	48 89 f0             	mov    %rsi,%rax
+  802297:	48 09 d0             	or     %rdx,%rax
+  80229a:	75 0d                	jne    8022a9 <fsipc+0x2d>
+  80229c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80229f:	83 f8 04             	cmp    $0x4,%eax
+  8022a2:	76 7d                	jbe    802321 <fsipc+0xa5>
+  8022a4:	83 ff 0d             	cmp    $0xd,%edi
+  8022a7:	74 78                	je     802321 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8022a9:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  8022b0:	00 00 00 
+  8022b3:	ff d0                	call   *%rax
+  8022b5:	89 c7                	mov    %eax,%edi
+  8022b7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022be:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022c5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022cc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022d2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022d9:	00 00 00 
+  8022dc:	44 89 e6             	mov    %r12d,%esi
+  8022df:	48 b8 04 46 80 00 00 	movabs $0x804604,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022eb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022f2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022f8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022fc:	4c 89 ee             	mov    %r13,%rsi
+  8022ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802304:	48 b8 e0 45 80 00 00 	movabs $0x8045e0,%rax
+  80230b:	00 00 00 
+  80230e:	ff d0                	call   *%rax
+  802310:	89 c3                	mov    %eax,%ebx
+}
+  802312:	89 d8                	mov    %ebx,%eax
+  802314:	48 83 c4 10          	add    $0x10,%rsp
+  802318:	5b                   	pop    %rbx
+  802319:	41 5c                	pop    %r12
+  80231b:	41 5d                	pop    %r13
+  80231d:	41 5e                	pop    %r14
+  80231f:	5d                   	pop    %rbp
+  802320:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802321:	48 b8 2e 1d 80 00 00 	movabs $0x801d2e,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+  80232d:	49 89 c6             	mov    %rax,%r14
+  802330:	48 85 c0             	test   %rax,%rax
+  802333:	0f 84 70 ff ff ff    	je     8022a9 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802339:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80233d:	48 b8 31 3e 80 00 00 	movabs $0x803e31,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802349:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80234c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802353:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802357:	ba 10 00 00 00       	mov    $0x10,%edx
+  80235c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802363:	00 00 00 
+  802366:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  80236d:	00 00 00 
+  802370:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802372:	4c 89 f7             	mov    %r14,%rdi
+  802375:	48 b8 ca 1d 80 00 00 	movabs $0x801dca,%rax
+  80237c:	00 00 00 
+  80237f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802381:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802388:	4c 89 f7             	mov    %r14,%rdi
+  80238b:	48 b8 f4 3e 80 00 00 	movabs $0x803ef4,%rax
+  802392:	00 00 00 
+  802395:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802397:	4c 89 f7             	mov    %r14,%rdi
+  80239a:	48 b8 82 3e 80 00 00 	movabs $0x803e82,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8023a6:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8023a9:	41 83 fc 05          	cmp    $0x5,%r12d
+  8023ad:	75 04                	jne    8023b3 <fsipc+0x137>
+  8023af:	85 db                	test   %ebx,%ebx
+  8023b1:	79 14                	jns    8023c7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023b3:	4c 89 f7             	mov    %r14,%rdi
+  8023b6:	48 b8 a9 3e 80 00 00 	movabs $0x803ea9,%rax
+  8023bd:	00 00 00 
+  8023c0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023c2:	e9 4b ff ff ff       	jmp    802312 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023c7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023cb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023d0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023d7:	00 00 00 
+  8023da:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  8023e1:	00 00 00 
+  8023e4:	ff d0                	call   *%rax
+  8023e6:	eb cb                	jmp    8023b3 <fsipc+0x137>
+
+00000000008023e8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023e8:	55                   	push   %rbp
+  8023e9:	48 89 e5             	mov    %rsp,%rbp
+  8023ec:	41 57                	push   %r15
+  8023ee:	41 56                	push   %r14
+  8023f0:	41 55                	push   %r13
+  8023f2:	41 54                	push   %r12
+  8023f4:	53                   	push   %rbx
+  8023f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023f9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8023fd:	49 89 f6             	mov    %rsi,%r14
+  802400:	49 89 d4             	mov    %rdx,%r12
+  802403:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802406:	48 b8 2e 1d 80 00 00 	movabs $0x801d2e,%rax
+  80240d:	00 00 00 
+  802410:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802412:	48 85 c0             	test   %rax,%rax
+  802415:	0f 85 96 00 00 00    	jne    8024b1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80241b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802422:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802423:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80242a:	00 00 00 
+    while (n) {
+  80242d:	4d 85 e4             	test   %r12,%r12
+  802430:	74 79                	je     8024ab <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802432:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802437:	49 39 dc             	cmp    %rbx,%r12
+  80243a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80243e:	48 89 da             	mov    %rbx,%rdx
+  802441:	4c 89 f6             	mov    %r14,%rsi
+  802444:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80244b:	00 00 00 
+  80244e:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  802455:	00 00 00 
+  802458:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80245a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80245e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802461:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802464:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802467:	44 01 e8             	add    %r13d,%eax
+  80246a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80246e:	41 0f 44 c5          	cmove  %r13d,%eax
+  802472:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802476:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80247a:	48 89 da             	mov    %rbx,%rdx
+  80247d:	be 00 00 00 00       	mov    $0x0,%esi
+  802482:	bf 04 00 00 00       	mov    $0x4,%edi
+  802487:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  80248e:	00 00 00 
+  802491:	ff d0                	call   *%rax
+        if (res < 0)
+  802493:	85 c0                	test   %eax,%eax
+  802495:	78 4a                	js     8024e1 <devfile_write_direct+0xf9>
+        buf += res;
+  802497:	48 98                	cltq
+  802499:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80249c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8024a0:	49 29 c4             	sub    %rax,%r12
+  8024a3:	75 8d                	jne    802432 <devfile_write_direct+0x4a>
+    return write;
+  8024a5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024a9:	eb 27                	jmp    8024d2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8024ab:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8024af:	eb f4                	jmp    8024a5 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8024b1:	45 89 e9             	mov    %r13d,%r9d
+  8024b4:	4d 89 e0             	mov    %r12,%r8
+  8024b7:	4c 89 f1             	mov    %r14,%rcx
+  8024ba:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024bf:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024c3:	48 89 c7             	mov    %rax,%rdi
+  8024c6:	48 b8 15 1e 80 00 00 	movabs $0x801e15,%rax
+  8024cd:	00 00 00 
+  8024d0:	ff d0                	call   *%rax
+}
+  8024d2:	48 83 c4 18          	add    $0x18,%rsp
+  8024d6:	5b                   	pop    %rbx
+  8024d7:	41 5c                	pop    %r12
+  8024d9:	41 5d                	pop    %r13
+  8024db:	41 5e                	pop    %r14
+  8024dd:	41 5f                	pop    %r15
+  8024df:	5d                   	pop    %rbp
+  8024e0:	c3                   	ret
+            return res;
+  8024e1:	48 98                	cltq
+  8024e3:	eb ed                	jmp    8024d2 <devfile_write_direct+0xea>
+
+00000000008024e5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	41 54                	push   %r12
+  8024eb:	53                   	push   %rbx
+  8024ec:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8024ef:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  8024f6:	00 00 00 
+  8024f9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8024fb:	48 85 c0             	test   %rax,%rax
+  8024fe:	74 71                	je     802571 <fbuf_flush+0x8c>
+  802500:	48 89 c3             	mov    %rax,%rbx
+  802503:	b8 00 00 00 00       	mov    $0x0,%eax
+  802508:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80250c:	75 05                	jne    802513 <fbuf_flush+0x2e>
+}
+  80250e:	5b                   	pop    %rbx
+  80250f:	41 5c                	pop    %r12
+  802511:	5d                   	pop    %rbp
+  802512:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802513:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802516:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80251a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802521:	00 00 00 
+  802524:	48 89 de             	mov    %rbx,%rsi
+  802527:	48 29 c6             	sub    %rax,%rsi
+  80252a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80252e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802535:	aa aa aa 
+  802538:	48 0f af f0          	imul   %rax,%rsi
+  80253c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802540:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802545:	48 01 c6             	add    %rax,%rsi
+  802548:	4c 89 e7             	mov    %r12,%rdi
+  80254b:	48 b8 e8 23 80 00 00 	movabs $0x8023e8,%rax
+  802552:	00 00 00 
+  802555:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802557:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80255b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802562:	00 
+    return res < 0 ? res : 0;
+  802563:	48 85 c0             	test   %rax,%rax
+  802566:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80256f:	eb 9d                	jmp    80250e <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802571:	b8 00 00 00 00       	mov    $0x0,%eax
+  802576:	eb 96                	jmp    80250e <fbuf_flush+0x29>
+
+0000000000802578 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802578:	55                   	push   %rbp
+  802579:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80257c:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802583:	00 00 00 
+  802586:	ff d0                	call   *%rax
+}
+  802588:	5d                   	pop    %rbp
+  802589:	c3                   	ret
+
+000000000080258a <devfile_write>:
+    if (!fd || !buf)
+  80258a:	48 85 ff             	test   %rdi,%rdi
+  80258d:	0f 84 d3 01 00 00    	je     802766 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802593:	55                   	push   %rbp
+  802594:	48 89 e5             	mov    %rsp,%rbp
+  802597:	41 57                	push   %r15
+  802599:	41 56                	push   %r14
+  80259b:	41 55                	push   %r13
+  80259d:	41 54                	push   %r12
+  80259f:	53                   	push   %rbx
+  8025a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a4:	49 89 fc             	mov    %rdi,%r12
+  8025a7:	49 89 f6             	mov    %rsi,%r14
+  8025aa:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8025ad:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025b2:	48 85 f6             	test   %rsi,%rsi
+  8025b5:	0f 84 9c 01 00 00    	je     802757 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025bb:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  8025c2:	00 00 00 
+  8025c5:	ff d0                	call   *%rax
+  8025c7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025ca:	48 85 c0             	test   %rax,%rax
+  8025cd:	0f 84 a2 00 00 00    	je     802675 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025d3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025d8:	4c 89 e7             	mov    %r12,%rdi
+  8025db:	48 b8 29 10 80 00 00 	movabs $0x801029,%rax
+  8025e2:	00 00 00 
+  8025e5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025e7:	83 f8 02             	cmp    $0x2,%eax
+  8025ea:	0f 8f 85 00 00 00    	jg     802675 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8025f0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025f7:	00 00 00 
+  8025fa:	4d 89 ef             	mov    %r13,%r15
+  8025fd:	49 29 c7             	sub    %rax,%r15
+  802600:	49 c1 ff 03          	sar    $0x3,%r15
+  802604:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80260b:	aa aa aa 
+  80260e:	4c 0f af f8          	imul   %rax,%r15
+  802612:	49 c1 e7 0e          	shl    $0xe,%r15
+  802616:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80261b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80261e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802623:	0f 84 d7 00 00 00    	je     802700 <devfile_write+0x176>
+  802629:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80262d:	89 c2                	mov    %eax,%edx
+  80262f:	41 03 55 0c          	add    0xc(%r13),%edx
+  802633:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802638:	75 0f                	jne    802649 <devfile_write+0xbf>
+  80263a:	48 01 d8             	add    %rbx,%rax
+  80263d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802643:	0f 86 92 00 00 00    	jbe    8026db <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802649:	4c 89 e7             	mov    %r12,%rdi
+  80264c:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802653:	00 00 00 
+  802656:	ff d0                	call   *%rax
+  802658:	85 c0                	test   %eax,%eax
+  80265a:	78 52                	js     8026ae <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80265c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802663:	77 7f                	ja     8026e4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802665:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80266a:	0f 85 c2 00 00 00    	jne    802732 <devfile_write+0x1a8>
+  802670:	e9 94 00 00 00       	jmp    802709 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802675:	4c 89 e7             	mov    %r12,%rdi
+  802678:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802684:	85 c0                	test   %eax,%eax
+  802686:	79 07                	jns    80268f <devfile_write+0x105>
+  802688:	48 98                	cltq
+  80268a:	e9 c8 00 00 00       	jmp    802757 <devfile_write+0x1cd>
+  80268f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802694:	48 89 da             	mov    %rbx,%rdx
+  802697:	4c 89 f6             	mov    %r14,%rsi
+  80269a:	4c 89 e7             	mov    %r12,%rdi
+  80269d:	48 b8 e8 23 80 00 00 	movabs $0x8023e8,%rax
+  8026a4:	00 00 00 
+  8026a7:	ff d0                	call   *%rax
+  8026a9:	e9 a9 00 00 00       	jmp    802757 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8026ae:	48 98                	cltq
+  8026b0:	e9 a2 00 00 00       	jmp    802757 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026b5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026ba:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026bf:	4c 89 fe             	mov    %r15,%rsi
+  8026c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c7:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  8026ce:	00 00 00 
+  8026d1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026d3:	85 c0                	test   %eax,%eax
+  8026d5:	79 45                	jns    80271c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026d7:	48 98                	cltq
+  8026d9:	eb 7c                	jmp    802757 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026db:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026e2:	76 4e                	jbe    802732 <devfile_write+0x1a8>
+  8026e4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026e9:	48 89 da             	mov    %rbx,%rdx
+  8026ec:	4c 89 f6             	mov    %r14,%rsi
+  8026ef:	4c 89 e7             	mov    %r12,%rdi
+  8026f2:	48 b8 e8 23 80 00 00 	movabs $0x8023e8,%rax
+  8026f9:	00 00 00 
+  8026fc:	ff d0                	call   *%rax
+  8026fe:	eb 57                	jmp    802757 <devfile_write+0x1cd>
+  802700:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802707:	77 db                	ja     8026e4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802709:	4c 89 ff             	mov    %r15,%rdi
+  80270c:	48 b8 b3 3c 80 00 00 	movabs $0x803cb3,%rax
+  802713:	00 00 00 
+  802716:	ff d0                	call   *%rax
+  802718:	84 c0                	test   %al,%al
+  80271a:	74 99                	je     8026b5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80271c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802721:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802726:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80272a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802731:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802732:	4c 89 ff             	mov    %r15,%rdi
+  802735:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802739:	48 89 da             	mov    %rbx,%rdx
+  80273c:	4c 89 f6             	mov    %r14,%rsi
+  80273f:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  802746:	00 00 00 
+  802749:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80274b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80274f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802754:	48 89 d8             	mov    %rbx,%rax
+}
+  802757:	48 83 c4 08          	add    $0x8,%rsp
+  80275b:	5b                   	pop    %rbx
+  80275c:	41 5c                	pop    %r12
+  80275e:	41 5d                	pop    %r13
+  802760:	41 5e                	pop    %r14
+  802762:	41 5f                	pop    %r15
+  802764:	5d                   	pop    %rbp
+  802765:	c3                   	ret
+        return E_INVAL;
+  802766:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80276b:	c3                   	ret
+
+000000000080276c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+  802770:	41 54                	push   %r12
+  802772:	53                   	push   %rbx
+  802773:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802776:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802785:	48 89 df             	mov    %rbx,%rdi
+  802788:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+  802794:	48 85 c0             	test   %rax,%rax
+  802797:	74 17                	je     8027b0 <devfile_flush+0x44>
+  802799:	48 89 df             	mov    %rbx,%rdi
+  80279c:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  8027a3:	00 00 00 
+  8027a6:	ff d0                	call   *%rax
+  8027a8:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8027af:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027b0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027b3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027ba:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027cb:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027d7:	45 85 e4             	test   %r12d,%r12d
+  8027da:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027de:	5b                   	pop    %rbx
+  8027df:	41 5c                	pop    %r12
+  8027e1:	5d                   	pop    %rbp
+  8027e2:	c3                   	ret
+
+00000000008027e3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027e3:	55                   	push   %rbp
+  8027e4:	48 89 e5             	mov    %rsp,%rbp
+  8027e7:	41 57                	push   %r15
+  8027e9:	41 56                	push   %r14
+  8027eb:	41 55                	push   %r13
+  8027ed:	41 54                	push   %r12
+  8027ef:	53                   	push   %rbx
+  8027f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8027f4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027f8:	49 89 f7             	mov    %rsi,%r15
+  8027fb:	48 89 d3             	mov    %rdx,%rbx
+  8027fe:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802801:	48 b8 2e 1d 80 00 00 	movabs $0x801d2e,%rax
+  802808:	00 00 00 
+  80280b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  80280d:	48 85 c0             	test   %rax,%rax
+  802810:	75 20                	jne    802832 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802812:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802817:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80281e:	00 
+    while (n) {
+  80281f:	48 85 db             	test   %rbx,%rbx
+  802822:	0f 85 df 00 00 00    	jne    802907 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802828:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80282c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802830:	eb 21                	jmp    802853 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802832:	45 89 f1             	mov    %r14d,%r9d
+  802835:	49 89 d8             	mov    %rbx,%r8
+  802838:	4c 89 f9             	mov    %r15,%rcx
+  80283b:	ba 03 00 00 00       	mov    $0x3,%edx
+  802840:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802844:	48 89 c7             	mov    %rax,%rdi
+  802847:	48 b8 15 1e 80 00 00 	movabs $0x801e15,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+}
+  802853:	48 83 c4 38          	add    $0x38,%rsp
+  802857:	5b                   	pop    %rbx
+  802858:	41 5c                	pop    %r12
+  80285a:	41 5d                	pop    %r13
+  80285c:	41 5e                	pop    %r14
+  80285e:	41 5f                	pop    %r15
+  802860:	5d                   	pop    %rbp
+  802861:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802862:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802866:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80286c:	75 1e                	jne    80288c <devfile_read_direct+0xa9>
+  80286e:	e9 e2 00 00 00       	jmp    802955 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802873:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802877:	eb da                	jmp    802853 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802879:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80287d:	0f 85 d0 01 00 00    	jne    802a53 <devfile_read_direct+0x270>
+            map = 0;
+  802883:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802887:	eb 03                	jmp    80288c <devfile_read_direct+0xa9>
+  802889:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80288c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802891:	48 39 d3             	cmp    %rdx,%rbx
+  802894:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802898:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80289c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80289f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  8028a6:	00 00 00 
+  8028a9:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8028ab:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8028af:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028b8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028bd:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  8028c4:	00 00 00 
+  8028c7:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028c9:	85 c0                	test   %eax,%eax
+  8028cb:	0f 8e 63 01 00 00    	jle    802a34 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028d1:	4c 63 e0             	movslq %eax,%r12
+  8028d4:	4c 89 e2             	mov    %r12,%rdx
+  8028d7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028de:	00 00 00 
+  8028e1:	4c 89 ff             	mov    %r15,%rdi
+  8028e4:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+        buf += res;
+  8028f0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8028f3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8028f6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8028fa:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8028fe:	48 85 db             	test   %rbx,%rbx
+  802901:	0f 84 25 ff ff ff    	je     80282c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802907:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80290a:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80290e:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802912:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802916:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80291d:	0f 97 c2             	seta   %dl
+  802920:	20 c2                	and    %al,%dl
+  802922:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802925:	0f 84 5e ff ff ff    	je     802889 <devfile_read_direct+0xa6>
+  80292b:	4c 89 fa             	mov    %r15,%rdx
+  80292e:	4d 89 fd             	mov    %r15,%r13
+  802931:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802938:	0f 85 4e ff ff ff    	jne    80288c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80293e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802942:	0f 84 1a ff ff ff    	je     802862 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802948:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80294f:	0f 85 37 ff ff ff    	jne    80288c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802955:	48 89 d8             	mov    %rbx,%rax
+  802958:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80295e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802963:	48 39 c8             	cmp    %rcx,%rax
+  802966:	48 0f 47 c1          	cmova  %rcx,%rax
+  80296a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  80296e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802972:	49 89 d4             	mov    %rdx,%r12
+  802975:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802979:	48 b8 54 3c 80 00 00 	movabs $0x803c54,%rax
+  802980:	00 00 00 
+  802983:	ff d0                	call   *%rax
+  802985:	a8 40                	test   $0x40,%al
+  802987:	0f 85 b9 00 00 00    	jne    802a46 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  80298d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802994:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802998:	49 39 c5             	cmp    %rax,%r13
+  80299b:	72 d8                	jb     802975 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80299d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8029a1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029a8:	00 00 00 
+  8029ab:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029af:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029b2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029b4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029b8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029bc:	48 b8 c9 1b 80 00 00 	movabs $0x801bc9,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	89 c7                	mov    %eax,%edi
+  8029ca:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029d0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029d5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029dc:	00 00 00 
+  8029df:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029e4:	48 b8 04 46 80 00 00 	movabs $0x804604,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8029f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029f9:	4c 89 fe             	mov    %r15,%rsi
+  8029fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a01:	48 b8 e0 45 80 00 00 	movabs $0x8045e0,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a10:	48 85 d2             	test   %rdx,%rdx
+  802a13:	0f 84 5a fe ff ff    	je     802873 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a19:	0f 8e 5a fe ff ff    	jle    802879 <devfile_read_direct+0x96>
+                buf += res;
+  802a1f:	48 98                	cltq
+  802a21:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a24:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a27:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a2b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a2f:	e9 ca fe ff ff       	jmp    8028fe <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a34:	41 89 c5             	mov    %eax,%r13d
+  802a37:	48 98                	cltq
+  802a39:	45 85 ed             	test   %r13d,%r13d
+  802a3c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a41:	e9 0d fe ff ff       	jmp    802853 <devfile_read_direct+0x70>
+            map = 0;
+  802a46:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a4a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a4e:	e9 39 fe ff ff       	jmp    80288c <devfile_read_direct+0xa9>
+  802a53:	48 89 d0             	mov    %rdx,%rax
+  802a56:	e9 f8 fd ff ff       	jmp    802853 <devfile_read_direct+0x70>
+
+0000000000802a5b <devfile_read>:
+    if (!fd || !buf)
+  802a5b:	48 85 ff             	test   %rdi,%rdi
+  802a5e:	0f 84 21 02 00 00    	je     802c85 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a64:	55                   	push   %rbp
+  802a65:	48 89 e5             	mov    %rsp,%rbp
+  802a68:	41 57                	push   %r15
+  802a6a:	41 56                	push   %r14
+  802a6c:	41 55                	push   %r13
+  802a6e:	41 54                	push   %r12
+  802a70:	53                   	push   %rbx
+  802a71:	48 83 ec 28          	sub    $0x28,%rsp
+  802a75:	48 89 fb             	mov    %rdi,%rbx
+  802a78:	49 89 f4             	mov    %rsi,%r12
+  802a7b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a7e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a83:	48 85 f6             	test   %rsi,%rsi
+  802a86:	74 4b                	je     802ad3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a88:	48 b8 98 1d 80 00 00 	movabs $0x801d98,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+  802a94:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802a97:	48 85 c0             	test   %rax,%rax
+  802a9a:	74 22                	je     802abe <devfile_read+0x63>
+  802a9c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802aa3:	77 19                	ja     802abe <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802aa5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802aaa:	48 89 df             	mov    %rbx,%rdi
+  802aad:	48 b8 29 10 80 00 00 	movabs $0x801029,%rax
+  802ab4:	00 00 00 
+  802ab7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ab9:	83 f8 02             	cmp    $0x2,%eax
+  802abc:	7e 40                	jle    802afe <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802abe:	48 89 df             	mov    %rbx,%rdi
+  802ac1:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802ac8:	00 00 00 
+  802acb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802acd:	85 c0                	test   %eax,%eax
+  802acf:	79 11                	jns    802ae2 <devfile_read+0x87>
+  802ad1:	48 98                	cltq
+}
+  802ad3:	48 83 c4 28          	add    $0x28,%rsp
+  802ad7:	5b                   	pop    %rbx
+  802ad8:	41 5c                	pop    %r12
+  802ada:	41 5d                	pop    %r13
+  802adc:	41 5e                	pop    %r14
+  802ade:	41 5f                	pop    %r15
+  802ae0:	5d                   	pop    %rbp
+  802ae1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ae2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ae7:	4c 89 ea             	mov    %r13,%rdx
+  802aea:	4c 89 e6             	mov    %r12,%rsi
+  802aed:	48 89 df             	mov    %rbx,%rdi
+  802af0:	48 b8 e3 27 80 00 00 	movabs $0x8027e3,%rax
+  802af7:	00 00 00 
+  802afa:	ff d0                	call   *%rax
+  802afc:	eb d5                	jmp    802ad3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802afe:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802b02:	48 89 df             	mov    %rbx,%rdi
+  802b05:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802b0c:	00 00 00 
+  802b0f:	ff d0                	call   *%rax
+  802b11:	85 c0                	test   %eax,%eax
+  802b13:	0f 88 33 01 00 00    	js     802c4c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b19:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b20:	00 00 00 
+  802b23:	4c 89 f0             	mov    %r14,%rax
+  802b26:	48 29 d0             	sub    %rdx,%rax
+  802b29:	48 c1 f8 03          	sar    $0x3,%rax
+  802b2d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b34:	aa aa aa 
+  802b37:	48 0f af c2          	imul   %rdx,%rax
+  802b3b:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b3f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b43:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b46:	41 39 06             	cmp    %eax,(%r14)
+  802b49:	75 0d                	jne    802b58 <devfile_read+0xfd>
+  802b4b:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b4e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b52:	0f 84 fb 00 00 00    	je     802c53 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b58:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b5d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b61:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b68:	48 89 c7             	mov    %rax,%rdi
+  802b6b:	48 b8 b3 3c 80 00 00 	movabs $0x803cb3,%rax
+  802b72:	00 00 00 
+  802b75:	ff d0                	call   *%rax
+  802b77:	84 c0                	test   %al,%al
+  802b79:	75 27                	jne    802ba2 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b7b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b80:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b85:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b89:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8e:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  802b95:	00 00 00 
+  802b98:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802b9a:	85 c0                	test   %eax,%eax
+  802b9c:	0f 88 dc 00 00 00    	js     802c7e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ba2:	44 89 f8             	mov    %r15d,%eax
+  802ba5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802baa:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802bac:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802bb3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802bb4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802bb7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802bbb:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bbe:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bc3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bc7:	48 89 df             	mov    %rbx,%rdi
+  802bca:	48 b8 e3 27 80 00 00 	movabs $0x8027e3,%rax
+  802bd1:	00 00 00 
+  802bd4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802bd6:	48 85 c0             	test   %rax,%rax
+  802bd9:	0f 88 f4 fe ff ff    	js     802ad3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802bdf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802be2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802be5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802be8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802bec:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802bf0:	48 63 d1             	movslq %ecx,%rdx
+  802bf3:	48 01 d0             	add    %rdx,%rax
+  802bf6:	4d 63 ff             	movslq %r15d,%r15
+  802bf9:	4c 29 f8             	sub    %r15,%rax
+  802bfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c01:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802c05:	48 85 c0             	test   %rax,%rax
+  802c08:	0f 8e c5 fe ff ff    	jle    802ad3 <devfile_read+0x78>
+    n = MIN(n, res);
+  802c0e:	4c 39 e8             	cmp    %r13,%rax
+  802c11:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c15:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c18:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c1c:	48 63 f6             	movslq %esi,%rsi
+  802c1f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c24:	48 01 c6             	add    %rax,%rsi
+  802c27:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c2b:	48 01 c6             	add    %rax,%rsi
+  802c2e:	4c 89 ea             	mov    %r13,%rdx
+  802c31:	4c 89 e7             	mov    %r12,%rdi
+  802c34:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  802c3b:	00 00 00 
+  802c3e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c40:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c44:	4c 89 e8             	mov    %r13,%rax
+  802c47:	e9 87 fe ff ff       	jmp    802ad3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c4c:	48 98                	cltq
+  802c4e:	e9 80 fe ff ff       	jmp    802ad3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c53:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c57:	41 39 d7             	cmp    %edx,%r15d
+  802c5a:	0f 8c f8 fe ff ff    	jl     802b58 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c60:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c64:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c67:	41 39 cf             	cmp    %ecx,%r15d
+  802c6a:	0f 8d e8 fe ff ff    	jge    802b58 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c70:	4d 63 ff             	movslq %r15d,%r15
+  802c73:	4c 29 f8             	sub    %r15,%rax
+  802c76:	48 63 d2             	movslq %edx,%rdx
+  802c79:	48 01 d0             	add    %rdx,%rax
+  802c7c:	eb 87                	jmp    802c05 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c7e:	48 98                	cltq
+  802c80:	e9 4e fe ff ff       	jmp    802ad3 <devfile_read+0x78>
+        return E_INVAL;
+  802c85:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c8a:	c3                   	ret
+
+0000000000802c8b <fs_channel>:
+fs_channel(bool enable) {
+  802c8b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802c8d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802c94:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802c96:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9b:	40 84 ff             	test   %dil,%dil
+  802c9e:	74 47                	je     802ce7 <fs_channel+0x5c>
+  802ca0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802ca7:	00 00 00 
+  802caa:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802cb0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802cb7:	00 00 00 
+  802cba:	3b 08                	cmp    (%rax),%ecx
+  802cbc:	74 29                	je     802ce7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cbe:	55                   	push   %rbp
+  802cbf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cc2:	48 b8 0b 1c 80 00 00 	movabs $0x801c0b,%rax
+  802cc9:	00 00 00 
+  802ccc:	ff d0                	call   *%rax
+  802cce:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802cd0:	85 c0                	test   %eax,%eax
+  802cd2:	78 04                	js     802cd8 <fs_channel+0x4d>
+}
+  802cd4:	89 d0                	mov    %edx,%eax
+  802cd6:	5d                   	pop    %rbp
+  802cd7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802cd8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802cdf:	00 00 00 
+  802ce2:	c6 00 00             	movb   $0x0,(%rax)
+  802ce5:	eb ed                	jmp    802cd4 <fs_channel+0x49>
+}
+  802ce7:	89 d0                	mov    %edx,%eax
+  802ce9:	c3                   	ret
+
+0000000000802cea <open>:
+open(const char *path, int mode) {
+  802cea:	55                   	push   %rbp
+  802ceb:	48 89 e5             	mov    %rsp,%rbp
+  802cee:	41 55                	push   %r13
+  802cf0:	41 54                	push   %r12
+  802cf2:	53                   	push   %rbx
+  802cf3:	48 83 ec 18          	sub    $0x18,%rsp
+  802cf7:	49 89 fc             	mov    %rdi,%r12
+  802cfa:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cfd:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802d04:	00 00 00 
+  802d07:	ff d0                	call   *%rax
+  802d09:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d0f:	0f 87 8f 00 00 00    	ja     802da4 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d15:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d19:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  802d20:	00 00 00 
+  802d23:	ff d0                	call   *%rax
+  802d25:	89 c3                	mov    %eax,%ebx
+  802d27:	85 c0                	test   %eax,%eax
+  802d29:	78 55                	js     802d80 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d2b:	4c 89 e6             	mov    %r12,%rsi
+  802d2e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d35:	00 00 00 
+  802d38:	48 89 df             	mov    %rbx,%rdi
+  802d3b:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d47:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d4e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d53:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d57:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d5c:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802d63:	00 00 00 
+  802d66:	ff d0                	call   *%rax
+  802d68:	89 c3                	mov    %eax,%ebx
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	78 1f                	js     802d8d <open+0xa3>
+    return fd2num(fd);
+  802d6e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d72:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+  802d7e:	89 c3                	mov    %eax,%ebx
+}
+  802d80:	89 d8                	mov    %ebx,%eax
+  802d82:	48 83 c4 18          	add    $0x18,%rsp
+  802d86:	5b                   	pop    %rbx
+  802d87:	41 5c                	pop    %r12
+  802d89:	41 5d                	pop    %r13
+  802d8b:	5d                   	pop    %rbp
+  802d8c:	c3                   	ret
+        fd_close(fd, 0);
+  802d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d92:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d96:	48 b8 e0 15 80 00 00 	movabs $0x8015e0,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+        return res;
+  802da2:	eb dc                	jmp    802d80 <open+0x96>
+        return -E_BAD_PATH;
+  802da4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802da9:	eb d5                	jmp    802d80 <open+0x96>
+
+0000000000802dab <file_flush_buffers>:
+file_flush_buffers(void) {
+  802dab:	55                   	push   %rbp
+  802dac:	48 89 e5             	mov    %rsp,%rbp
+  802daf:	41 56                	push   %r14
+  802db1:	41 55                	push   %r13
+  802db3:	41 54                	push   %r12
+  802db5:	53                   	push   %rbx
+  802db6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802dba:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802dc1:	00 00 00 
+  802dc4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dc9:	49 bd 25 15 80 00 00 	movabs $0x801525,%r13
+  802dd0:	00 00 00 
+  802dd3:	49 be e5 24 80 00 00 	movabs $0x8024e5,%r14
+  802dda:	00 00 00 
+  802ddd:	eb 0c                	jmp    802deb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802ddf:	83 c3 01             	add    $0x1,%ebx
+  802de2:	49 83 c4 18          	add    $0x18,%r12
+  802de6:	83 fb 20             	cmp    $0x20,%ebx
+  802de9:	74 1d                	je     802e08 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802deb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802df0:	74 ed                	je     802ddf <file_flush_buffers+0x34>
+  802df2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802df6:	89 df                	mov    %ebx,%edi
+  802df8:	41 ff d5             	call   *%r13
+  802dfb:	85 c0                	test   %eax,%eax
+  802dfd:	78 e0                	js     802ddf <file_flush_buffers+0x34>
+  802dff:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e03:	41 ff d6             	call   *%r14
+  802e06:	eb d7                	jmp    802ddf <file_flush_buffers+0x34>
+}
+  802e08:	48 83 c4 10          	add    $0x10,%rsp
+  802e0c:	5b                   	pop    %rbx
+  802e0d:	41 5c                	pop    %r12
+  802e0f:	41 5d                	pop    %r13
+  802e11:	41 5e                	pop    %r14
+  802e13:	5d                   	pop    %rbp
+  802e14:	c3                   	ret
+
+0000000000802e15 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e15:	55                   	push   %rbp
+  802e16:	48 89 e5             	mov    %rsp,%rbp
+  802e19:	41 54                	push   %r12
+  802e1b:	53                   	push   %rbx
+  802e1c:	49 89 fc             	mov    %rdi,%r12
+  802e1f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e21:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802e28:	00 00 00 
+  802e2b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e2d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e34:	00 00 00 
+  802e37:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e3c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e3e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e46:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e50:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802e57:	00 00 00 
+  802e5a:	ff d0                	call   *%rax
+}
+  802e5c:	5b                   	pop    %rbx
+  802e5d:	41 5c                	pop    %r12
+  802e5f:	5d                   	pop    %rbp
+  802e60:	c3                   	ret
+
+0000000000802e61 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e61:	55                   	push   %rbp
+  802e62:	48 89 e5             	mov    %rsp,%rbp
+  802e65:	41 54                	push   %r12
+  802e67:	53                   	push   %rbx
+  802e68:	49 89 fc             	mov    %rdi,%r12
+  802e6b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e6e:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802e75:	00 00 00 
+  802e78:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e7a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e7f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e86:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e92:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e97:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ea3:	85 c0                	test   %eax,%eax
+  802ea5:	78 3d                	js     802ee4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802ea7:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802eae:	00 00 00 
+  802eb1:	4c 89 e6             	mov    %r12,%rsi
+  802eb4:	48 89 df             	mov    %rbx,%rdi
+  802eb7:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  802ebe:	00 00 00 
+  802ec1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ec3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802eca:	00 
+  802ecb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ed1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ed8:	00 
+  802ed9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802edf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee4:	5b                   	pop    %rbx
+  802ee5:	41 5c                	pop    %r12
+  802ee7:	5d                   	pop    %rbp
+  802ee8:	c3                   	ret
+
+0000000000802ee9 <remove>:
+remove(const char *path) {
+  802ee9:	55                   	push   %rbp
+  802eea:	48 89 e5             	mov    %rsp,%rbp
+  802eed:	53                   	push   %rbx
+  802eee:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802ef5:	48 b8 c7 0a 80 00 00 	movabs $0x800ac7,%rax
+  802efc:	00 00 00 
+  802eff:	ff d0                	call   *%rax
+  802f01:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f07:	77 3a                	ja     802f43 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802f09:	48 89 de             	mov    %rbx,%rsi
+  802f0c:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f13:	00 00 00 
+  802f16:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  802f1d:	00 00 00 
+  802f20:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f22:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f27:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f31:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802f38:	00 00 00 
+  802f3b:	ff d0                	call   *%rax
+}
+  802f3d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f41:	c9                   	leave
+  802f42:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f43:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f48:	eb f3                	jmp    802f3d <remove+0x54>
+
+0000000000802f4a <sync>:
+sync(void) {
+  802f4a:	55                   	push   %rbp
+  802f4b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f4e:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802f55:	00 00 00 
+  802f58:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f5a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f64:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f69:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802f70:	00 00 00 
+  802f73:	ff d0                	call   *%rax
+}
+  802f75:	5d                   	pop    %rbp
+  802f76:	c3                   	ret
+
+0000000000802f77 <fsync>:
+fsync(int fdnum) {
+  802f77:	55                   	push   %rbp
+  802f78:	48 89 e5             	mov    %rsp,%rbp
+  802f7b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f7f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f83:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  802f8a:	00 00 00 
+  802f8d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f8f:	85 c0                	test   %eax,%eax
+  802f91:	78 4b                	js     802fde <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f93:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f97:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802f9e:	00 00 00 
+  802fa1:	8b 00                	mov    (%rax),%eax
+  802fa3:	39 02                	cmp    %eax,(%rdx)
+  802fa5:	75 39                	jne    802fe0 <fsync+0x69>
+    file_flush_buffers();
+  802fa7:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fb3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fb7:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fba:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802fc1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fcd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fd2:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  802fd9:	00 00 00 
+  802fdc:	ff d0                	call   *%rax
+}
+  802fde:	c9                   	leave
+  802fdf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fe0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fe5:	eb f7                	jmp    802fde <fsync+0x67>
+
+0000000000802fe7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802fe7:	55                   	push   %rbp
+  802fe8:	48 89 e5             	mov    %rsp,%rbp
+  802feb:	53                   	push   %rbx
+  802fec:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ff8:	be 00 00 00 00       	mov    $0x0,%esi
+  802ffd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803002:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80300e:	85 c0                	test   %eax,%eax
+  803010:	78 2d                	js     80303f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803012:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803019:	00 00 00 
+  80301c:	48 8b 10             	mov    (%rax),%rdx
+  80301f:	48 89 13             	mov    %rdx,(%rbx)
+  803022:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803026:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80302a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80302e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803032:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803036:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80303a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80303f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803043:	c9                   	leave
+  803044:	c3                   	ret
+
+0000000000803045 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803045:	55                   	push   %rbp
+  803046:	48 89 e5             	mov    %rsp,%rbp
+  803049:	53                   	push   %rbx
+  80304a:	48 83 ec 08          	sub    $0x8,%rsp
+  80304e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803051:	ba 00 00 00 00       	mov    $0x0,%edx
+  803056:	be 00 00 00 00       	mov    $0x0,%esi
+  80305b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803060:	48 b8 7c 22 80 00 00 	movabs $0x80227c,%rax
+  803067:	00 00 00 
+  80306a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80306c:	85 c0                	test   %eax,%eax
+  80306e:	78 3d                	js     8030ad <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803070:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803077:	00 00 00 
+  80307a:	48 8b 10             	mov    (%rax),%rdx
+  80307d:	48 89 13             	mov    %rdx,(%rbx)
+  803080:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803084:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803088:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80308c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803090:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803094:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803098:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80309c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8030a0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8030a4:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8030a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ad:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030b1:	c9                   	leave
+  8030b2:	c3                   	ret
+
+00000000008030b3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030b3:	55                   	push   %rbp
+  8030b4:	48 89 e5             	mov    %rsp,%rbp
+  8030b7:	41 57                	push   %r15
+  8030b9:	41 56                	push   %r14
+  8030bb:	41 55                	push   %r13
+  8030bd:	41 54                	push   %r12
+  8030bf:	53                   	push   %rbx
+  8030c0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030c4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030cb:	00 
+  8030cc:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030d3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030d9:	0f 85 43 01 00 00    	jne    803222 <munmap+0x16f>
+  8030df:	49 89 ff             	mov    %rdi,%r15
+  8030e2:	4c 39 f7             	cmp    %r14,%rdi
+  8030e5:	0f 87 37 01 00 00    	ja     803222 <munmap+0x16f>
+  8030eb:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8030f2:	00 00 00 
+  8030f5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8030fb:	eb 2c                	jmp    803129 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8030fd:	4c 39 f8             	cmp    %r15,%rax
+  803100:	0f 83 85 00 00 00    	jae    80318b <munmap+0xd8>
+            m->mm_end = start;
+  803106:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80310b:	48 83 c3 18          	add    $0x18,%rbx
+  80310f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803116:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80311d:	00 00 00 
+  803120:	48 39 c3             	cmp    %rax,%rbx
+  803123:	0f 84 d0 00 00 00    	je     8031f9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803129:	49 89 dc             	mov    %rbx,%r12
+  80312c:	48 8b 03             	mov    (%rbx),%rax
+  80312f:	4c 39 f0             	cmp    %r14,%rax
+  803132:	73 d7                	jae    80310b <munmap+0x58>
+  803134:	48 85 c0             	test   %rax,%rax
+  803137:	74 d2                	je     80310b <munmap+0x58>
+  803139:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80313d:	49 39 d7             	cmp    %rdx,%r15
+  803140:	73 c9                	jae    80310b <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803142:	49 39 d6             	cmp    %rdx,%r14
+  803145:	73 b6                	jae    8030fd <munmap+0x4a>
+  803147:	49 39 c7             	cmp    %rax,%r15
+  80314a:	76 b1                	jbe    8030fd <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80314c:	4c 89 ef             	mov    %r13,%rdi
+  80314f:	48 b8 ea 21 80 00 00 	movabs $0x8021ea,%rax
+  803156:	00 00 00 
+  803159:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80315b:	48 85 c0             	test   %rax,%rax
+  80315e:	0f 84 c5 00 00 00    	je     803229 <munmap+0x176>
+            *tail = *m;
+  803164:	48 8b 13             	mov    (%rbx),%rdx
+  803167:	48 89 10             	mov    %rdx,(%rax)
+  80316a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80316e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803172:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803176:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80317a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80317d:	44 89 f2             	mov    %r14d,%edx
+  803180:	2b 13                	sub    (%rbx),%edx
+  803182:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803185:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803189:	eb 80                	jmp    80310b <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80318b:	49 39 d6             	cmp    %rdx,%r14
+  80318e:	73 18                	jae    8031a8 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803190:	44 89 f2             	mov    %r14d,%edx
+  803193:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803198:	29 c2                	sub    %eax,%edx
+  80319a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80319f:	4d 89 34 24          	mov    %r14,(%r12)
+  8031a3:	e9 63 ff ff ff       	jmp    80310b <munmap+0x58>
+    m->mm_start = 0;
+  8031a8:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8031af:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8031b0:	4c 89 e6             	mov    %r12,%rsi
+  8031b3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031ba:	00 00 00 
+  8031bd:	48 29 c6             	sub    %rax,%rsi
+  8031c0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031c4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031cb:	aa aa aa 
+  8031ce:	48 0f af f0          	imul   %rax,%rsi
+  8031d2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031d6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031db:	48 01 c6             	add    %rax,%rsi
+  8031de:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031e8:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  8031ef:	00 00 00 
+  8031f2:	ff d0                	call   *%rax
+}
+  8031f4:	e9 12 ff ff ff       	jmp    80310b <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8031f9:	4c 89 f2             	mov    %r14,%rdx
+  8031fc:	4c 29 fa             	sub    %r15,%rdx
+  8031ff:	4c 89 fe             	mov    %r15,%rsi
+  803202:	bf 00 00 00 00       	mov    $0x0,%edi
+  803207:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  80320e:	00 00 00 
+  803211:	ff d0                	call   *%rax
+}
+  803213:	48 83 c4 08          	add    $0x8,%rsp
+  803217:	5b                   	pop    %rbx
+  803218:	41 5c                	pop    %r12
+  80321a:	41 5d                	pop    %r13
+  80321c:	41 5e                	pop    %r14
+  80321e:	41 5f                	pop    %r15
+  803220:	5d                   	pop    %rbp
+  803221:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803222:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803227:	eb ea                	jmp    803213 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803229:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80322e:	eb e3                	jmp    803213 <munmap+0x160>
+
+0000000000803230 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803230:	55                   	push   %rbp
+  803231:	48 89 e5             	mov    %rsp,%rbp
+  803234:	41 57                	push   %r15
+  803236:	41 56                	push   %r14
+  803238:	41 55                	push   %r13
+  80323a:	41 54                	push   %r12
+  80323c:	53                   	push   %rbx
+  80323d:	48 83 ec 28          	sub    $0x28,%rsp
+  803241:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803245:	49 89 f5             	mov    %rsi,%r13
+  803248:	41 89 d6             	mov    %edx,%r14d
+  80324b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80324e:	41 89 cc             	mov    %ecx,%r12d
+  803251:	44 89 c7             	mov    %r8d,%edi
+  803254:	44 89 cb             	mov    %r9d,%ebx
+  803257:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80325b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80325f:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  803266:	00 00 00 
+  803269:	ff d0                	call   *%rax
+  80326b:	41 89 c7             	mov    %eax,%r15d
+  80326e:	85 c0                	test   %eax,%eax
+  803270:	0f 88 ae 01 00 00    	js     803424 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803276:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80327a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803281:	00 00 00 
+  803284:	8b 32                	mov    (%rdx),%esi
+  803286:	39 30                	cmp    %esi,(%rax)
+  803288:	0f 85 7a 02 00 00    	jne    803508 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80328e:	8b 40 08             	mov    0x8(%rax),%eax
+  803291:	83 e0 03             	and    $0x3,%eax
+  803294:	83 f8 01             	cmp    $0x1,%eax
+  803297:	0f 84 76 02 00 00    	je     803513 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80329d:	4d 85 ed             	test   %r13,%r13
+  8032a0:	0f 84 78 02 00 00    	je     80351e <mmap+0x2ee>
+  8032a6:	85 db                	test   %ebx,%ebx
+  8032a8:	0f 88 70 02 00 00    	js     80351e <mmap+0x2ee>
+  8032ae:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032b4:	41 89 df             	mov    %ebx,%r15d
+  8032b7:	0f 85 6c 02 00 00    	jne    803529 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032bd:	44 89 f0             	mov    %r14d,%eax
+  8032c0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032c3:	83 f8 04             	cmp    $0x4,%eax
+  8032c6:	0f 85 68 02 00 00    	jne    803534 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032cc:	44 89 e1             	mov    %r12d,%ecx
+  8032cf:	83 e1 01             	and    $0x1,%ecx
+  8032d2:	0f 95 c2             	setne  %dl
+  8032d5:	44 89 e0             	mov    %r12d,%eax
+  8032d8:	d1 e8                	shr    %eax
+  8032da:	83 f0 01             	xor    $0x1,%eax
+  8032dd:	83 e0 01             	and    $0x1,%eax
+  8032e0:	38 c2                	cmp    %al,%dl
+  8032e2:	0f 85 57 02 00 00    	jne    80353f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032e8:	85 c9                	test   %ecx,%ecx
+  8032ea:	74 0a                	je     8032f6 <mmap+0xc6>
+  8032ec:	41 f6 c6 02          	test   $0x2,%r14b
+  8032f0:	0f 85 54 02 00 00    	jne    80354a <mmap+0x31a>
+    file_flush_buffers();
+  8032f6:	48 b8 ab 2d 80 00 00 	movabs $0x802dab,%rax
+  8032fd:	00 00 00 
+  803300:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803302:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803309:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803310:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803314:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803317:	41 f6 c4 04          	test   $0x4,%r12b
+  80331b:	0f 84 15 01 00 00    	je     803436 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803321:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803324:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80332a:	0f 85 25 02 00 00    	jne    803555 <mmap+0x325>
+  803330:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803334:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80333b:	00 00 00 
+  80333e:	48 39 c2             	cmp    %rax,%rdx
+  803341:	0f 82 19 02 00 00    	jb     803560 <mmap+0x330>
+  803347:	48 39 c7             	cmp    %rax,%rdi
+  80334a:	0f 87 10 02 00 00    	ja     803560 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803350:	4c 89 ee             	mov    %r13,%rsi
+  803353:	48 b8 b3 30 80 00 00 	movabs $0x8030b3,%rax
+  80335a:	00 00 00 
+  80335d:	ff d0                	call   *%rax
+  80335f:	85 c0                	test   %eax,%eax
+  803361:	0f 88 04 02 00 00    	js     80356b <mmap+0x33b>
+    if (!handler) {
+  803367:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80336e:	00 00 00 
+  803371:	80 38 00             	cmpb   $0x0,(%rax)
+  803374:	75 2b                	jne    8033a1 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803376:	48 bf 4b 21 80 00 00 	movabs $0x80214b,%rdi
+  80337d:	00 00 00 
+  803380:	48 b8 af 42 80 00 00 	movabs $0x8042af,%rax
+  803387:	00 00 00 
+  80338a:	ff d0                	call   *%rax
+  80338c:	85 c0                	test   %eax,%eax
+  80338e:	0f 88 ea 01 00 00    	js     80357e <mmap+0x34e>
+        handler = 1;
+  803394:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80339b:	00 00 00 
+  80339e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8033a1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033a5:	48 b8 ea 21 80 00 00 	movabs $0x8021ea,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+  8033b1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033b4:	48 85 c0             	test   %rax,%rax
+  8033b7:	0f 84 c9 01 00 00    	je     803586 <mmap+0x356>
+    m->mm_start = va;
+  8033bd:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033c0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033c4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033c8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033cb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033cf:	44 89 e0             	mov    %r12d,%eax
+  8033d2:	c1 e0 06             	shl    $0x6,%eax
+  8033d5:	25 80 00 00 00       	and    $0x80,%eax
+  8033da:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033dd:	09 f0                	or     %esi,%eax
+  8033df:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033e3:	41 f6 c4 08          	test   $0x8,%r12b
+  8033e7:	74 31                	je     80341a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033e9:	48 39 d3             	cmp    %rdx,%rbx
+  8033ec:	73 2c                	jae    80341a <mmap+0x1ea>
+  8033ee:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8033f3:	48 89 de             	mov    %rbx,%rsi
+  8033f6:	4c 89 f7             	mov    %r14,%rdi
+  8033f9:	48 b8 3a 20 80 00 00 	movabs $0x80203a,%rax
+  803400:	00 00 00 
+  803403:	ff d0                	call   *%rax
+  803405:	49 89 c4             	mov    %rax,%r12
+  803408:	48 85 c0             	test   %rax,%rax
+  80340b:	0f 8e d7 00 00 00    	jle    8034e8 <mmap+0x2b8>
+            va += n;
+  803411:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803414:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803418:	72 d4                	jb     8033ee <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80341a:	49 8b 06             	mov    (%r14),%rax
+  80341d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803421:	48 89 06             	mov    %rax,(%rsi)
+}
+  803424:	44 89 f8             	mov    %r15d,%eax
+  803427:	48 83 c4 28          	add    $0x28,%rsp
+  80342b:	5b                   	pop    %rbx
+  80342c:	41 5c                	pop    %r12
+  80342e:	41 5d                	pop    %r13
+  803430:	41 5e                	pop    %r14
+  803432:	41 5f                	pop    %r15
+  803434:	5d                   	pop    %rbp
+  803435:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803436:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80343d:	00 00 00 
+  803440:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803443:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80344a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80344d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803452:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803459:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80345c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803463:	00 00 00 
+  803466:	48 39 d7             	cmp    %rdx,%rdi
+  803469:	73 1c                	jae    803487 <mmap+0x257>
+        return -E_NO_MEM;
+  80346b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803471:	eb b1                	jmp    803424 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803473:	48 83 c0 01          	add    $0x1,%rax
+  803477:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80347b:	77 3f                	ja     8034bc <mmap+0x28c>
+  80347d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803482:	48 39 d7             	cmp    %rdx,%rdi
+  803485:	72 2a                	jb     8034b1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803487:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80348b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80348f:	48 39 d1             	cmp    %rdx,%rcx
+  803492:	73 df                	jae    803473 <mmap+0x243>
+  803494:	48 85 c9             	test   %rcx,%rcx
+  803497:	74 da                	je     803473 <mmap+0x243>
+  803499:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80349d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8034a2:	48 39 d3             	cmp    %rdx,%rbx
+  8034a5:	73 cc                	jae    803473 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8034a7:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034af:	eb cc                	jmp    80347d <mmap+0x24d>
+        return -E_NO_MEM;
+  8034b1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034b7:	e9 68 ff ff ff       	jmp    803424 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034bc:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034c1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034c8:	00 00 00 
+  8034cb:	48 39 c2             	cmp    %rax,%rdx
+  8034ce:	0f 82 9f 00 00 00    	jb     803573 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034d4:	48 85 db             	test   %rbx,%rbx
+  8034d7:	0f 85 8a fe ff ff    	jne    803367 <mmap+0x137>
+        return -E_NO_MEM;
+  8034dd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034e3:	e9 3c ff ff ff       	jmp    803424 <mmap+0x1f4>
+        if (n < 0) {
+  8034e8:	0f 89 2c ff ff ff    	jns    80341a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8034ee:	49 8b 3e             	mov    (%r14),%rdi
+  8034f1:	4c 89 ee             	mov    %r13,%rsi
+  8034f4:	48 b8 b3 30 80 00 00 	movabs $0x8030b3,%rax
+  8034fb:	00 00 00 
+  8034fe:	ff d0                	call   *%rax
+            return n;
+  803500:	45 89 e7             	mov    %r12d,%r15d
+  803503:	e9 1c ff ff ff       	jmp    803424 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803508:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80350e:	e9 11 ff ff ff       	jmp    803424 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803513:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803519:	e9 06 ff ff ff       	jmp    803424 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80351e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803524:	e9 fb fe ff ff       	jmp    803424 <mmap+0x1f4>
+  803529:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80352f:	e9 f0 fe ff ff       	jmp    803424 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803534:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80353a:	e9 e5 fe ff ff       	jmp    803424 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80353f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803545:	e9 da fe ff ff       	jmp    803424 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80354a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803550:	e9 cf fe ff ff       	jmp    803424 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803555:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80355b:	e9 c4 fe ff ff       	jmp    803424 <mmap+0x1f4>
+  803560:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803566:	e9 b9 fe ff ff       	jmp    803424 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80356b:	41 89 c7             	mov    %eax,%r15d
+  80356e:	e9 b1 fe ff ff       	jmp    803424 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803573:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803579:	e9 a6 fe ff ff       	jmp    803424 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80357e:	41 89 c7             	mov    %eax,%r15d
+  803581:	e9 9e fe ff ff       	jmp    803424 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803586:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80358c:	e9 93 fe ff ff       	jmp    803424 <mmap+0x1f4>
+
+0000000000803591 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803591:	55                   	push   %rbp
+  803592:	48 89 e5             	mov    %rsp,%rbp
+  803595:	41 54                	push   %r12
+  803597:	53                   	push   %rbx
+  803598:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80359b:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8035a2:	00 00 00 
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8035aa:	48 be 00 4d 80 00 00 	movabs $0x804d00,%rsi
+  8035b1:	00 00 00 
+  8035b4:	48 89 df             	mov    %rbx,%rdi
+  8035b7:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  8035be:	00 00 00 
+  8035c1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035c3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035c8:	41 2b 04 24          	sub    (%r12),%eax
+  8035cc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035d2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035d9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035dc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035e3:	00 00 00 
+  8035e6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f2:	5b                   	pop    %rbx
+  8035f3:	41 5c                	pop    %r12
+  8035f5:	5d                   	pop    %rbp
+  8035f6:	c3                   	ret
+
+00000000008035f7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035f7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035fa:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803600:	8b 17                	mov    (%rdi),%edx
+  803602:	85 d2                	test   %edx,%edx
+  803604:	75 01                	jne    803607 <pipe_wakeup+0x10>
+  803606:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803607:	55                   	push   %rbp
+  803608:	48 89 e5             	mov    %rsp,%rbp
+  80360b:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  80360e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803614:	be 00 04 00 00       	mov    $0x400,%esi
+  803619:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  803620:	00 00 00 
+  803623:	ff d0                	call   *%rax
+}
+  803625:	5d                   	pop    %rbp
+  803626:	c3                   	ret
+
+0000000000803627 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803627:	55                   	push   %rbp
+  803628:	48 89 e5             	mov    %rsp,%rbp
+  80362b:	41 55                	push   %r13
+  80362d:	41 54                	push   %r12
+  80362f:	53                   	push   %rbx
+  803630:	48 83 ec 08          	sub    $0x8,%rsp
+  803634:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803637:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  80363e:	00 00 00 
+  803641:	ff d0                	call   *%rax
+  803643:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803646:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80364b:	4c 89 e6             	mov    %r12,%rsi
+  80364e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803653:	49 bc 0a 11 80 00 00 	movabs $0x80110a,%r12
+  80365a:	00 00 00 
+  80365d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803660:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803664:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803668:	49 bd f7 35 80 00 00 	movabs $0x8035f7,%r13
+  80366f:	00 00 00 
+  803672:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803675:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803679:	48 89 de             	mov    %rbx,%rsi
+  80367c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80367f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803684:	48 89 de             	mov    %rbx,%rsi
+  803687:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368c:	41 ff d4             	call   *%r12
+  80368f:	48 83 c4 08          	add    $0x8,%rsp
+  803693:	5b                   	pop    %rbx
+  803694:	41 5c                	pop    %r12
+  803696:	41 5d                	pop    %r13
+  803698:	5d                   	pop    %rbp
+  803699:	c3                   	ret
+
+000000000080369a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80369a:	55                   	push   %rbp
+  80369b:	48 89 e5             	mov    %rsp,%rbp
+  80369e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036a1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036a6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036ab:	48 b8 4d 10 80 00 00 	movabs $0x80104d,%rax
+  8036b2:	00 00 00 
+  8036b5:	ff d0                	call   *%rax
+  8036b7:	85 c0                	test   %eax,%eax
+  8036b9:	0f 94 c0             	sete   %al
+  8036bc:	0f b6 c0             	movzbl %al,%eax
+}
+  8036bf:	5d                   	pop    %rbp
+  8036c0:	c3                   	ret
+
+00000000008036c1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036c1:	55                   	push   %rbp
+  8036c2:	48 89 e5             	mov    %rsp,%rbp
+  8036c5:	41 57                	push   %r15
+  8036c7:	41 56                	push   %r14
+  8036c9:	41 55                	push   %r13
+  8036cb:	41 54                	push   %r12
+  8036cd:	53                   	push   %rbx
+  8036ce:	48 83 ec 38          	sub    $0x38,%rsp
+  8036d2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036d6:	49 89 f4             	mov    %rsi,%r12
+  8036d9:	49 89 d7             	mov    %rdx,%r15
+  8036dc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036e0:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8036e7:	00 00 00 
+  8036ea:	ff d0                	call   *%rax
+  8036ec:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036ef:	4d 85 ff             	test   %r15,%r15
+  8036f2:	0f 84 f1 00 00 00    	je     8037e9 <devpipe_write+0x128>
+  8036f8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8036fc:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803700:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803704:	49 bd 9a 36 80 00 00 	movabs $0x80369a,%r13
+  80370b:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80370e:	49 bf f7 35 80 00 00 	movabs $0x8035f7,%r15
+  803715:	00 00 00 
+  803718:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80371c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803720:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803724:	8b 73 04             	mov    0x4(%rbx),%esi
+  803727:	48 63 ce             	movslq %esi,%rcx
+  80372a:	48 63 03             	movslq (%rbx),%rax
+  80372d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803733:	48 39 c1             	cmp    %rax,%rcx
+  803736:	72 64                	jb     80379c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803738:	48 89 de             	mov    %rbx,%rsi
+  80373b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80373f:	41 ff d5             	call   *%r13
+  803742:	85 c0                	test   %eax,%eax
+  803744:	0f 85 b9 00 00 00    	jne    803803 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80374a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80374e:	4c 89 f7             	mov    %r14,%rdi
+  803751:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803754:	8b 43 04             	mov    0x4(%rbx),%eax
+  803757:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80375e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803765:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80376b:	8b 03                	mov    (%rbx),%eax
+  80376d:	41 39 c4             	cmp    %eax,%r12d
+  803770:	75 b2                	jne    803724 <devpipe_write+0x63>
+  803772:	48 89 de             	mov    %rbx,%rsi
+  803775:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803779:	41 ff d5             	call   *%r13
+  80377c:	85 c0                	test   %eax,%eax
+  80377e:	75 a0                	jne    803720 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803780:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803785:	44 89 e6             	mov    %r12d,%esi
+  803788:	48 89 df             	mov    %rbx,%rdi
+  80378b:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  803792:	00 00 00 
+  803795:	ff d0                	call   *%rax
+  803797:	e9 7c ff ff ff       	jmp    803718 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80379c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8037a0:	41 0f b6 38          	movzbl (%r8),%edi
+  8037a4:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8037ab:	80 80 80 
+  8037ae:	48 89 c8             	mov    %rcx,%rax
+  8037b1:	48 f7 e2             	mul    %rdx
+  8037b4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037b8:	48 89 d0             	mov    %rdx,%rax
+  8037bb:	48 c1 e0 08          	shl    $0x8,%rax
+  8037bf:	48 29 d0             	sub    %rdx,%rax
+  8037c2:	48 c1 e0 04          	shl    $0x4,%rax
+  8037c6:	48 29 c1             	sub    %rax,%rcx
+  8037c9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037ce:	83 c6 01             	add    $0x1,%esi
+  8037d1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037d4:	49 83 c0 01          	add    $0x1,%r8
+  8037d8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037dc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037e0:	49 39 c0             	cmp    %rax,%r8
+  8037e3:	0f 85 2f ff ff ff    	jne    803718 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037e9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037ed:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037f1:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+    return n;
+  8037fd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803801:	eb 05                	jmp    803808 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803803:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803808:	48 83 c4 38          	add    $0x38,%rsp
+  80380c:	5b                   	pop    %rbx
+  80380d:	41 5c                	pop    %r12
+  80380f:	41 5d                	pop    %r13
+  803811:	41 5e                	pop    %r14
+  803813:	41 5f                	pop    %r15
+  803815:	5d                   	pop    %rbp
+  803816:	c3                   	ret
+
+0000000000803817 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803817:	55                   	push   %rbp
+  803818:	48 89 e5             	mov    %rsp,%rbp
+  80381b:	41 57                	push   %r15
+  80381d:	41 56                	push   %r14
+  80381f:	41 55                	push   %r13
+  803821:	41 54                	push   %r12
+  803823:	53                   	push   %rbx
+  803824:	48 83 ec 28          	sub    $0x28,%rsp
+  803828:	49 89 fd             	mov    %rdi,%r13
+  80382b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80382f:	49 89 d4             	mov    %rdx,%r12
+  803832:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803836:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  80383d:	00 00 00 
+  803840:	ff d0                	call   *%rax
+  803842:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803845:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80384b:	49 bf 9a 36 80 00 00 	movabs $0x80369a,%r15
+  803852:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803855:	4d 85 e4             	test   %r12,%r12
+  803858:	0f 84 d5 00 00 00    	je     803933 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80385e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803862:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803866:	8b 03                	mov    (%rbx),%eax
+  803868:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80386b:	75 7a                	jne    8038e7 <devpipe_read+0xd0>
+            if (i > 0) {
+  80386d:	4d 85 f6             	test   %r14,%r14
+  803870:	75 50                	jne    8038c2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803872:	48 89 de             	mov    %rbx,%rsi
+  803875:	4c 89 ef             	mov    %r13,%rdi
+  803878:	41 ff d7             	call   *%r15
+  80387b:	85 c0                	test   %eax,%eax
+  80387d:	0f 85 c9 00 00 00    	jne    80394c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803883:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803886:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80388d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803893:	8b 43 04             	mov    0x4(%rbx),%eax
+  803896:	41 39 c4             	cmp    %eax,%r12d
+  803899:	75 cb                	jne    803866 <devpipe_read+0x4f>
+  80389b:	48 89 de             	mov    %rbx,%rsi
+  80389e:	4c 89 ef             	mov    %r13,%rdi
+  8038a1:	41 ff d7             	call   *%r15
+  8038a4:	85 c0                	test   %eax,%eax
+  8038a6:	75 be                	jne    803866 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8038a8:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8038ad:	44 89 e6             	mov    %r12d,%esi
+  8038b0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038b4:	48 b8 d2 13 80 00 00 	movabs $0x8013d2,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+  8038c0:	eb a4                	jmp    803866 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038c2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038c6:	48 89 de             	mov    %rbx,%rsi
+  8038c9:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  8038d0:	00 00 00 
+  8038d3:	ff d0                	call   *%rax
+                return i;
+  8038d5:	4c 89 f0             	mov    %r14,%rax
+}
+  8038d8:	48 83 c4 28          	add    $0x28,%rsp
+  8038dc:	5b                   	pop    %rbx
+  8038dd:	41 5c                	pop    %r12
+  8038df:	41 5d                	pop    %r13
+  8038e1:	41 5e                	pop    %r14
+  8038e3:	41 5f                	pop    %r15
+  8038e5:	5d                   	pop    %rbp
+  8038e6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038e7:	48 63 c8             	movslq %eax,%rcx
+  8038ea:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8038f1:	80 80 80 
+  8038f4:	48 89 c8             	mov    %rcx,%rax
+  8038f7:	48 f7 e2             	mul    %rdx
+  8038fa:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8038fe:	48 89 d0             	mov    %rdx,%rax
+  803901:	48 c1 e0 08          	shl    $0x8,%rax
+  803905:	48 29 d0             	sub    %rdx,%rax
+  803908:	48 c1 e0 04          	shl    $0x4,%rax
+  80390c:	48 89 c2             	mov    %rax,%rdx
+  80390f:	48 89 c8             	mov    %rcx,%rax
+  803912:	48 29 d0             	sub    %rdx,%rax
+  803915:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80391a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80391e:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803922:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803925:	49 83 c6 01          	add    $0x1,%r14
+  803929:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80392d:	0f 85 2b ff ff ff    	jne    80385e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803933:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803937:	48 89 de             	mov    %rbx,%rsi
+  80393a:	48 b8 f7 35 80 00 00 	movabs $0x8035f7,%rax
+  803941:	00 00 00 
+  803944:	ff d0                	call   *%rax
+    return n;
+  803946:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80394a:	eb 8c                	jmp    8038d8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80394c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803951:	eb 85                	jmp    8038d8 <devpipe_read+0xc1>
+
+0000000000803953 <pipe>:
+pipe(int pfd[2]) {
+  803953:	55                   	push   %rbp
+  803954:	48 89 e5             	mov    %rsp,%rbp
+  803957:	41 55                	push   %r13
+  803959:	41 54                	push   %r12
+  80395b:	53                   	push   %rbx
+  80395c:	48 83 ec 18          	sub    $0x18,%rsp
+  803960:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803963:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803967:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  80396e:	00 00 00 
+  803971:	ff d0                	call   *%rax
+  803973:	89 c3                	mov    %eax,%ebx
+  803975:	85 c0                	test   %eax,%eax
+  803977:	0f 88 a0 01 00 00    	js     803b1d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80397d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803982:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803987:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80398b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803990:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  803997:	00 00 00 
+  80399a:	ff d0                	call   *%rax
+  80399c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80399e:	85 c0                	test   %eax,%eax
+  8039a0:	0f 88 77 01 00 00    	js     803b1d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039a6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8039aa:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8039b1:	00 00 00 
+  8039b4:	ff d0                	call   *%rax
+  8039b6:	89 c3                	mov    %eax,%ebx
+  8039b8:	85 c0                	test   %eax,%eax
+  8039ba:	0f 88 43 01 00 00    	js     803b03 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039c0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ca:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d3:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  8039da:	00 00 00 
+  8039dd:	ff d0                	call   *%rax
+  8039df:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039e1:	85 c0                	test   %eax,%eax
+  8039e3:	0f 88 1a 01 00 00    	js     803b03 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039e9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039ed:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8039f4:	00 00 00 
+  8039f7:	ff d0                	call   *%rax
+  8039f9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039fc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a01:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a06:	48 89 c6             	mov    %rax,%rsi
+  803a09:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a0e:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  803a15:	00 00 00 
+  803a18:	ff d0                	call   *%rax
+  803a1a:	89 c3                	mov    %eax,%ebx
+  803a1c:	85 c0                	test   %eax,%eax
+  803a1e:	0f 88 c5 00 00 00    	js     803ae9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a24:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a28:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803a2f:	00 00 00 
+  803a32:	ff d0                	call   *%rax
+  803a34:	48 89 c1             	mov    %rax,%rcx
+  803a37:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a3d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a43:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a48:	4c 89 ee             	mov    %r13,%rsi
+  803a4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a50:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  803a57:	00 00 00 
+  803a5a:	ff d0                	call   *%rax
+  803a5c:	89 c3                	mov    %eax,%ebx
+  803a5e:	85 c0                	test   %eax,%eax
+  803a60:	78 6e                	js     803ad0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a62:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a67:	4c 89 ef             	mov    %r13,%rdi
+  803a6a:	48 b8 29 10 80 00 00 	movabs $0x801029,%rax
+  803a71:	00 00 00 
+  803a74:	ff d0                	call   *%rax
+  803a76:	83 f8 02             	cmp    $0x2,%eax
+  803a79:	0f 85 ab 00 00 00    	jne    803b2a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a7f:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a86:	00 00 
+  803a88:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a8c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a8e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a92:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a99:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a9d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803aa3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803aaa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803aae:	48 bb 97 14 80 00 00 	movabs $0x801497,%rbx
+  803ab5:	00 00 00 
+  803ab8:	ff d3                	call   *%rbx
+  803aba:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803abe:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ac2:	ff d3                	call   *%rbx
+  803ac4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ac9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ace:	eb 4d                	jmp    803b1d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ad0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ad5:	4c 89 ee             	mov    %r13,%rsi
+  803ad8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803add:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ae9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aee:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803af2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af7:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  803afe:	00 00 00 
+  803b01:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b08:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b11:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  803b18:	00 00 00 
+  803b1b:	ff d0                	call   *%rax
+}
+  803b1d:	89 d8                	mov    %ebx,%eax
+  803b1f:	48 83 c4 18          	add    $0x18,%rsp
+  803b23:	5b                   	pop    %rbx
+  803b24:	41 5c                	pop    %r12
+  803b26:	41 5d                	pop    %r13
+  803b28:	5d                   	pop    %rbp
+  803b29:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b2a:	48 b9 30 4d 80 00 00 	movabs $0x804d30,%rcx
+  803b31:	00 00 00 
+  803b34:	48 ba 07 4d 80 00 00 	movabs $0x804d07,%rdx
+  803b3b:	00 00 00 
+  803b3e:	be 50 00 00 00       	mov    $0x50,%esi
+  803b43:	48 bf 1c 4d 80 00 00 	movabs $0x804d1c,%rdi
+  803b4a:	00 00 00 
+  803b4d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b52:	49 b8 82 41 80 00 00 	movabs $0x804182,%r8
+  803b59:	00 00 00 
+  803b5c:	41 ff d0             	call   *%r8
+
+0000000000803b5f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b5f:	55                   	push   %rbp
+  803b60:	48 89 e5             	mov    %rsp,%rbp
+  803b63:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b67:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b6b:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  803b72:	00 00 00 
+  803b75:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b77:	85 c0                	test   %eax,%eax
+  803b79:	78 23                	js     803b9e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b7b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b7f:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803b86:	00 00 00 
+  803b89:	ff d0                	call   *%rax
+  803b8b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b8e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b92:	48 b8 9a 36 80 00 00 	movabs $0x80369a,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+}
+  803b9e:	c9                   	leave
+  803b9f:	c3                   	ret
+
+0000000000803ba0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ba0:	48 89 f8             	mov    %rdi,%rax
+  803ba3:	48 c1 e8 27          	shr    $0x27,%rax
+  803ba7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803bae:	01 00 00 
+  803bb1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bb5:	f6 c2 01             	test   $0x1,%dl
+  803bb8:	74 6d                	je     803c27 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bba:	48 89 f8             	mov    %rdi,%rax
+  803bbd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bc1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bc8:	01 00 00 
+  803bcb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bcf:	f6 c2 01             	test   $0x1,%dl
+  803bd2:	74 62                	je     803c36 <get_uvpt_entry+0x96>
+  803bd4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bdb:	01 00 00 
+  803bde:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803be2:	f6 c2 80             	test   $0x80,%dl
+  803be5:	75 4f                	jne    803c36 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803be7:	48 89 f8             	mov    %rdi,%rax
+  803bea:	48 c1 e8 15          	shr    $0x15,%rax
+  803bee:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bf5:	01 00 00 
+  803bf8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bfc:	f6 c2 01             	test   $0x1,%dl
+  803bff:	74 44                	je     803c45 <get_uvpt_entry+0xa5>
+  803c01:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c08:	01 00 00 
+  803c0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c0f:	f6 c2 80             	test   $0x80,%dl
+  803c12:	75 31                	jne    803c45 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c14:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c18:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c1f:	01 00 00 
+  803c22:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c26:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c27:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c2e:	01 00 00 
+  803c31:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c35:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c36:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c3d:	01 00 00 
+  803c40:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c44:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c45:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c4c:	01 00 00 
+  803c4f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c53:	c3                   	ret
+
+0000000000803c54 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c54:	55                   	push   %rbp
+  803c55:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c58:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803c5f:	00 00 00 
+  803c62:	ff d0                	call   *%rax
+  803c64:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c67:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c6c:	89 c1                	mov    %eax,%ecx
+  803c6e:	83 c9 04             	or     $0x4,%ecx
+  803c71:	f6 c2 01             	test   $0x1,%dl
+  803c74:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c77:	89 c1                	mov    %eax,%ecx
+  803c79:	83 c9 02             	or     $0x2,%ecx
+  803c7c:	f6 c2 02             	test   $0x2,%dl
+  803c7f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c82:	89 c1                	mov    %eax,%ecx
+  803c84:	83 c9 01             	or     $0x1,%ecx
+  803c87:	48 85 d2             	test   %rdx,%rdx
+  803c8a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c8d:	89 c1                	mov    %eax,%ecx
+  803c8f:	83 c9 40             	or     $0x40,%ecx
+  803c92:	f6 c6 04             	test   $0x4,%dh
+  803c95:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c98:	5d                   	pop    %rbp
+  803c99:	c3                   	ret
+
+0000000000803c9a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c9e:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803ca5:	00 00 00 
+  803ca8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803caa:	48 c1 e8 06          	shr    $0x6,%rax
+  803cae:	83 e0 01             	and    $0x1,%eax
+}
+  803cb1:	5d                   	pop    %rbp
+  803cb2:	c3                   	ret
+
+0000000000803cb3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803cb3:	55                   	push   %rbp
+  803cb4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803cb7:	48 b8 a0 3b 80 00 00 	movabs $0x803ba0,%rax
+  803cbe:	00 00 00 
+  803cc1:	ff d0                	call   *%rax
+  803cc3:	83 e0 01             	and    $0x1,%eax
+}
+  803cc6:	5d                   	pop    %rbp
+  803cc7:	c3                   	ret
+
+0000000000803cc8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803cc8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803ccf:	01 00 00 
+  803cd2:	a8 01                	test   $0x1,%al
+  803cd4:	75 06                	jne    803cdc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803cd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cdb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cdc:	55                   	push   %rbp
+  803cdd:	48 89 e5             	mov    %rsp,%rbp
+  803ce0:	41 57                	push   %r15
+  803ce2:	41 56                	push   %r14
+  803ce4:	41 55                	push   %r13
+  803ce6:	41 54                	push   %r12
+  803ce8:	53                   	push   %rbx
+  803ce9:	48 83 ec 28          	sub    $0x28,%rsp
+  803ced:	49 89 fe             	mov    %rdi,%r14
+  803cf0:	49 89 f7             	mov    %rsi,%r15
+  803cf3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803cfa:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803cfb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803d02:	01 00 00 
+  803d05:	e9 ae 00 00 00       	jmp    803db8 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d0a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d11:	49 83 ec 01          	sub    $0x1,%r12
+  803d15:	74 2d                	je     803d44 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d17:	48 89 d8             	mov    %rbx,%rax
+  803d1a:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d1e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d23:	f6 c2 01             	test   $0x1,%dl
+  803d26:	74 e2                	je     803d0a <foreach_shared_region+0x42>
+  803d28:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d2d:	f6 c4 04             	test   $0x4,%ah
+  803d30:	74 d8                	je     803d0a <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d32:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d39:	4c 89 fa             	mov    %r15,%rdx
+  803d3c:	48 89 df             	mov    %rbx,%rdi
+  803d3f:	41 ff d6             	call   *%r14
+  803d42:	eb c6                	jmp    803d0a <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d44:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d4b:	00 
+  803d4c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d51:	74 4a                	je     803d9d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d57:	48 c1 e8 15          	shr    $0x15,%rax
+  803d5b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d62:	01 00 00 
+  803d65:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d69:	a8 01                	test   $0x1,%al
+  803d6b:	74 d7                	je     803d44 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d6d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d71:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d78:	48 39 c3             	cmp    %rax,%rbx
+  803d7b:	73 c7                	jae    803d44 <foreach_shared_region+0x7c>
+  803d7d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d84:	48 39 d0             	cmp    %rdx,%rax
+  803d87:	4d 19 e4             	sbb    %r12,%r12
+  803d8a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d91:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d98:	e9 7a ff ff ff       	jmp    803d17 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803d9d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803da4:	40 
+  803da5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803da9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803db0:	00 00 00 
+  803db3:	48 39 c1             	cmp    %rax,%rcx
+  803db6:	74 50                	je     803e08 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803db8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803dbc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dc0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803dc7:	01 00 00 
+  803dca:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803dce:	a8 01                	test   $0x1,%al
+  803dd0:	74 cb                	je     803d9d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dd2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dd6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803ddd:	48 39 c1             	cmp    %rax,%rcx
+  803de0:	73 bb                	jae    803d9d <foreach_shared_region+0xd5>
+  803de2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803de9:	48 39 d0             	cmp    %rdx,%rax
+  803dec:	48 19 c0             	sbb    %rax,%rax
+  803def:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803df5:	48 05 00 02 00 00    	add    $0x200,%rax
+  803dfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dff:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e03:	e9 4b ff ff ff       	jmp    803d53 <foreach_shared_region+0x8b>
+  803e08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e0d:	48 83 c4 28          	add    $0x28,%rsp
+  803e11:	5b                   	pop    %rbx
+  803e12:	41 5c                	pop    %r12
+  803e14:	41 5d                	pop    %r13
+  803e16:	41 5e                	pop    %r14
+  803e18:	41 5f                	pop    %r15
+  803e1a:	5d                   	pop    %rbp
+  803e1b:	c3                   	ret
+
+0000000000803e1c <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e1c:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e22:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e29:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e30:	c3                   	ret
+
+0000000000803e31 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e31:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e34:	8b 17                	mov    (%rdi),%edx
+  803e36:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e38:	83 f8 0f             	cmp    $0xf,%eax
+  803e3b:	77 13                	ja     803e50 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e3d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e40:	83 e0 0f             	and    $0xf,%eax
+  803e43:	48 c1 e0 09          	shl    $0x9,%rax
+  803e47:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e4e:	00 
+  803e4f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e55:	c3                   	ret
+
+0000000000803e56 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e56:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e59:	83 c0 01             	add    $0x1,%eax
+  803e5c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e5f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e65:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e68:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e6d:	85 d2                	test   %edx,%edx
+  803e6f:	75 04                	jne    803e75 <chan_publish+0x1f>
+  803e71:	83 e0 01             	and    $0x1,%eax
+}
+  803e74:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e75:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e78:	85 c0                	test   %eax,%eax
+  803e7a:	0f 95 c0             	setne  %al
+  803e7d:	0f b6 c0             	movzbl %al,%eax
+  803e80:	eb ef                	jmp    803e71 <chan_publish+0x1b>
+
+0000000000803e82 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e82:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e85:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e87:	29 d0                	sub    %edx,%eax
+  803e89:	83 e8 01             	sub    $0x1,%eax
+  803e8c:	83 f8 0f             	cmp    $0xf,%eax
+  803e8f:	77 12                	ja     803ea3 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803e91:	8b 07                	mov    (%rdi),%eax
+  803e93:	83 e0 0f             	and    $0xf,%eax
+  803e96:	48 c1 e0 09          	shl    $0x9,%rax
+  803e9a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803ea1:	00 
+  803ea2:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ea8:	c3                   	ret
+
+0000000000803ea9 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803ea9:	8b 07                	mov    (%rdi),%eax
+  803eab:	83 c0 01             	add    $0x1,%eax
+  803eae:	89 07                	mov    %eax,(%rdi)
+}
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803eb1:	55                   	push   %rbp
+  803eb2:	48 89 e5             	mov    %rsp,%rbp
+  803eb5:	53                   	push   %rbx
+  803eb6:	48 83 ec 08          	sub    $0x8,%rsp
+  803eba:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803ebd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ec4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803eca:	48 b8 82 3e 80 00 00 	movabs $0x803e82,%rax
+  803ed1:	00 00 00 
+  803ed4:	ff d0                	call   *%rax
+  803ed6:	48 85 c0             	test   %rax,%rax
+  803ed9:	74 12                	je     803eed <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803edb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803eeb:	c9                   	leave
+  803eec:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803eed:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ef2:	eb f3                	jmp    803ee7 <chan_arm+0x36>
+
+0000000000803ef4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803ef4:	55                   	push   %rbp
+  803ef5:	48 89 e5             	mov    %rsp,%rbp
+  803ef8:	41 56                	push   %r14
+  803efa:	41 55                	push   %r13
+  803efc:	41 54                	push   %r12
+  803efe:	53                   	push   %rbx
+  803eff:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803f02:	49 bc b1 3e 80 00 00 	movabs $0x803eb1,%r12
+  803f09:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f0c:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f10:	49 bd d2 13 80 00 00 	movabs $0x8013d2,%r13
+  803f17:	00 00 00 
+    while (chan_arm(r))
+  803f1a:	eb 0d                	jmp    803f29 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f1c:	8b 33                	mov    (%rbx),%esi
+  803f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f23:	4c 89 f7             	mov    %r14,%rdi
+  803f26:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f29:	48 89 df             	mov    %rbx,%rdi
+  803f2c:	41 ff d4             	call   *%r12
+  803f2f:	84 c0                	test   %al,%al
+  803f31:	75 e9                	jne    803f1c <chan_wait+0x28>
+}
+  803f33:	5b                   	pop    %rbx
+  803f34:	41 5c                	pop    %r12
+  803f36:	41 5d                	pop    %r13
+  803f38:	41 5e                	pop    %r14
+  803f3a:	5d                   	pop    %rbp
+  803f3b:	c3                   	ret
+
+0000000000803f3c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f3c:	55                   	push   %rbp
+  803f3d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f40:	48 83 c7 40          	add    $0x40,%rdi
+  803f44:	be 01 00 00 00       	mov    $0x1,%esi
+  803f49:	48 b8 f0 13 80 00 00 	movabs $0x8013f0,%rax
+  803f50:	00 00 00 
+  803f53:	ff d0                	call   *%rax
+}
+  803f55:	5d                   	pop    %rbp
+  803f56:	c3                   	ret
+
+0000000000803f57 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f57:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5c:	c3                   	ret
+
+0000000000803f5d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f5d:	55                   	push   %rbp
+  803f5e:	48 89 e5             	mov    %rsp,%rbp
+  803f61:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f64:	48 be 54 4d 80 00 00 	movabs $0x804d54,%rsi
+  803f6b:	00 00 00 
+  803f6e:	48 b8 05 0b 80 00 00 	movabs $0x800b05,%rax
+  803f75:	00 00 00 
+  803f78:	ff d0                	call   *%rax
+    return 0;
+}
+  803f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f7f:	5d                   	pop    %rbp
+  803f80:	c3                   	ret
+
+0000000000803f81 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f81:	55                   	push   %rbp
+  803f82:	48 89 e5             	mov    %rsp,%rbp
+  803f85:	41 57                	push   %r15
+  803f87:	41 56                	push   %r14
+  803f89:	41 55                	push   %r13
+  803f8b:	41 54                	push   %r12
+  803f8d:	53                   	push   %rbx
+  803f8e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f95:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f9c:	48 85 d2             	test   %rdx,%rdx
+  803f9f:	74 7a                	je     80401b <devcons_write+0x9a>
+  803fa1:	49 89 d6             	mov    %rdx,%r14
+  803fa4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803faa:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803faf:	49 bf ff 0c 80 00 00 	movabs $0x800cff,%r15
+  803fb6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fb9:	4c 89 f3             	mov    %r14,%rbx
+  803fbc:	48 29 f3             	sub    %rsi,%rbx
+  803fbf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fc4:	48 39 c3             	cmp    %rax,%rbx
+  803fc7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fcb:	4c 63 eb             	movslq %ebx,%r13
+  803fce:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fd5:	48 01 c6             	add    %rax,%rsi
+  803fd8:	4c 89 ea             	mov    %r13,%rdx
+  803fdb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fe2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fe5:	4c 89 ee             	mov    %r13,%rsi
+  803fe8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fef:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  803ff6:	00 00 00 
+  803ff9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803ffb:	41 01 dc             	add    %ebx,%r12d
+  803ffe:	49 63 f4             	movslq %r12d,%rsi
+  804001:	4c 39 f6             	cmp    %r14,%rsi
+  804004:	72 b3                	jb     803fb9 <devcons_write+0x38>
+    return res;
+  804006:	49 63 c4             	movslq %r12d,%rax
+}
+  804009:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804010:	5b                   	pop    %rbx
+  804011:	41 5c                	pop    %r12
+  804013:	41 5d                	pop    %r13
+  804015:	41 5e                	pop    %r14
+  804017:	41 5f                	pop    %r15
+  804019:	5d                   	pop    %rbp
+  80401a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80401b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804021:	eb e3                	jmp    804006 <devcons_write+0x85>
+
+0000000000804023 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804023:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80402b:	48 85 c0             	test   %rax,%rax
+  80402e:	74 55                	je     804085 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804030:	55                   	push   %rbp
+  804031:	48 89 e5             	mov    %rsp,%rbp
+  804034:	41 55                	push   %r13
+  804036:	41 54                	push   %r12
+  804038:	53                   	push   %rbx
+  804039:	48 83 ec 08          	sub    $0x8,%rsp
+  80403d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804040:	48 bb 4b 0f 80 00 00 	movabs $0x800f4b,%rbx
+  804047:	00 00 00 
+  80404a:	49 bc 00 10 80 00 00 	movabs $0x801000,%r12
+  804051:	00 00 00 
+  804054:	eb 03                	jmp    804059 <devcons_read+0x36>
+  804056:	41 ff d4             	call   *%r12
+  804059:	ff d3                	call   *%rbx
+  80405b:	85 c0                	test   %eax,%eax
+  80405d:	74 f7                	je     804056 <devcons_read+0x33>
+    if (c < 0) return c;
+  80405f:	48 63 d0             	movslq %eax,%rdx
+  804062:	78 13                	js     804077 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804064:	ba 00 00 00 00       	mov    $0x0,%edx
+  804069:	83 f8 04             	cmp    $0x4,%eax
+  80406c:	74 09                	je     804077 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80406e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804072:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804077:	48 89 d0             	mov    %rdx,%rax
+  80407a:	48 83 c4 08          	add    $0x8,%rsp
+  80407e:	5b                   	pop    %rbx
+  80407f:	41 5c                	pop    %r12
+  804081:	41 5d                	pop    %r13
+  804083:	5d                   	pop    %rbp
+  804084:	c3                   	ret
+  804085:	48 89 d0             	mov    %rdx,%rax
+  804088:	c3                   	ret
+
+0000000000804089 <cputchar>:
+cputchar(int ch) {
+  804089:	55                   	push   %rbp
+  80408a:	48 89 e5             	mov    %rsp,%rbp
+  80408d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804091:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804095:	be 01 00 00 00       	mov    $0x1,%esi
+  80409a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80409e:	48 b8 2c 0f 80 00 00 	movabs $0x800f2c,%rax
+  8040a5:	00 00 00 
+  8040a8:	ff d0                	call   *%rax
+}
+  8040aa:	c9                   	leave
+  8040ab:	c3                   	ret
+
+00000000008040ac <getchar>:
+getchar(void) {
+  8040ac:	55                   	push   %rbp
+  8040ad:	48 89 e5             	mov    %rsp,%rbp
+  8040b0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040b4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040b9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c2:	48 b8 08 18 80 00 00 	movabs $0x801808,%rax
+  8040c9:	00 00 00 
+  8040cc:	ff d0                	call   *%rax
+  8040ce:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040d0:	85 c0                	test   %eax,%eax
+  8040d2:	78 06                	js     8040da <getchar+0x2e>
+  8040d4:	74 08                	je     8040de <getchar+0x32>
+  8040d6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040da:	89 d0                	mov    %edx,%eax
+  8040dc:	c9                   	leave
+  8040dd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040de:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040e3:	eb f5                	jmp    8040da <getchar+0x2e>
+
+00000000008040e5 <iscons>:
+iscons(int fdnum) {
+  8040e5:	55                   	push   %rbp
+  8040e6:	48 89 e5             	mov    %rsp,%rbp
+  8040e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040f1:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  8040f8:	00 00 00 
+  8040fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	78 18                	js     804119 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804101:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804105:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80410c:	00 00 00 
+  80410f:	8b 00                	mov    (%rax),%eax
+  804111:	39 02                	cmp    %eax,(%rdx)
+  804113:	0f 94 c0             	sete   %al
+  804116:	0f b6 c0             	movzbl %al,%eax
+}
+  804119:	c9                   	leave
+  80411a:	c3                   	ret
+
+000000000080411b <opencons>:
+opencons(void) {
+  80411b:	55                   	push   %rbp
+  80411c:	48 89 e5             	mov    %rsp,%rbp
+  80411f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804123:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804127:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  80412e:	00 00 00 
+  804131:	ff d0                	call   *%rax
+  804133:	85 c0                	test   %eax,%eax
+  804135:	78 49                	js     804180 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804137:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80413c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804141:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804145:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414a:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  804151:	00 00 00 
+  804154:	ff d0                	call   *%rax
+  804156:	85 c0                	test   %eax,%eax
+  804158:	78 26                	js     804180 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80415a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80415e:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804165:	00 00 
+  804167:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804169:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80416d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804174:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  80417b:	00 00 00 
+  80417e:	ff d0                	call   *%rax
+}
+  804180:	c9                   	leave
+  804181:	c3                   	ret
+
+0000000000804182 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804182:	55                   	push   %rbp
+  804183:	48 89 e5             	mov    %rsp,%rbp
+  804186:	41 56                	push   %r14
+  804188:	41 55                	push   %r13
+  80418a:	41 54                	push   %r12
+  80418c:	53                   	push   %rbx
+  80418d:	48 83 ec 50          	sub    $0x50,%rsp
+  804191:	49 89 fc             	mov    %rdi,%r12
+  804194:	41 89 f5             	mov    %esi,%r13d
+  804197:	48 89 d3             	mov    %rdx,%rbx
+  80419a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80419e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8041a2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8041a6:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8041ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041b1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041b5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041b9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041bd:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041c4:	00 00 00 
+  8041c7:	4c 8b 30             	mov    (%rax),%r14
+  8041ca:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  8041d1:	00 00 00 
+  8041d4:	ff d0                	call   *%rax
+  8041d6:	89 c6                	mov    %eax,%esi
+  8041d8:	45 89 e8             	mov    %r13d,%r8d
+  8041db:	4c 89 e1             	mov    %r12,%rcx
+  8041de:	4c 89 f2             	mov    %r14,%rdx
+  8041e1:	48 bf 60 4d 80 00 00 	movabs $0x804d60,%rdi
+  8041e8:	00 00 00 
+  8041eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f0:	49 bc e0 01 80 00 00 	movabs $0x8001e0,%r12
+  8041f7:	00 00 00 
+  8041fa:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8041fd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804201:	48 89 df             	mov    %rbx,%rdi
+  804204:	48 b8 7c 01 80 00 00 	movabs $0x80017c,%rax
+  80420b:	00 00 00 
+  80420e:	ff d0                	call   *%rax
+    cprintf("\n");
+  804210:	48 bf c2 46 80 00 00 	movabs $0x8046c2,%rdi
+  804217:	00 00 00 
+  80421a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80421f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804222:	cc                   	int3
+  804223:	eb fd                	jmp    804222 <_panic+0xa0>
+
+0000000000804225 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804225:	55                   	push   %rbp
+  804226:	48 89 e5             	mov    %rsp,%rbp
+  804229:	41 56                	push   %r14
+  80422b:	41 55                	push   %r13
+  80422d:	41 54                	push   %r12
+  80422f:	53                   	push   %rbx
+  804230:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804233:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80423a:	00 00 00 
+  80423d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804241:	74 27                	je     80426a <_handle_vectored_pagefault+0x45>
+  804243:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804248:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80424f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804252:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804255:	4c 89 e7             	mov    %r12,%rdi
+  804258:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80425d:	84 c0                	test   %al,%al
+  80425f:	75 45                	jne    8042a6 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804261:	48 83 c3 01          	add    $0x1,%rbx
+  804265:	49 3b 1e             	cmp    (%r14),%rbx
+  804268:	72 eb                	jb     804255 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80426a:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804271:	00 
+  804272:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804277:	4d 8b 04 24          	mov    (%r12),%r8
+  80427b:	48 ba 88 4d 80 00 00 	movabs $0x804d88,%rdx
+  804282:	00 00 00 
+  804285:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80428a:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  804291:	00 00 00 
+  804294:	b8 00 00 00 00       	mov    $0x0,%eax
+  804299:	49 ba 82 41 80 00 00 	movabs $0x804182,%r10
+  8042a0:	00 00 00 
+  8042a3:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8042a6:	5b                   	pop    %rbx
+  8042a7:	41 5c                	pop    %r12
+  8042a9:	41 5d                	pop    %r13
+  8042ab:	41 5e                	pop    %r14
+  8042ad:	5d                   	pop    %rbp
+  8042ae:	c3                   	ret
+
+00000000008042af <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042af:	55                   	push   %rbp
+  8042b0:	48 89 e5             	mov    %rsp,%rbp
+  8042b3:	53                   	push   %rbx
+  8042b4:	48 83 ec 08          	sub    $0x8,%rsp
+  8042b8:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042bb:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042c2:	00 00 00 
+  8042c5:	80 38 00             	cmpb   $0x0,(%rax)
+  8042c8:	0f 84 84 00 00 00    	je     804352 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ce:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042d5:	00 00 00 
+  8042d8:	48 8b 10             	mov    (%rax),%rdx
+  8042db:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042e0:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042e7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ea:	48 85 d2             	test   %rdx,%rdx
+  8042ed:	74 19                	je     804308 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042ef:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042f3:	0f 84 e8 00 00 00    	je     8043e1 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042f9:	48 83 c0 01          	add    $0x1,%rax
+  8042fd:	48 39 d0             	cmp    %rdx,%rax
+  804300:	75 ed                	jne    8042ef <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804302:	48 83 fa 08          	cmp    $0x8,%rdx
+  804306:	74 1c                	je     804324 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804308:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80430c:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804313:	00 00 00 
+  804316:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80431d:	00 00 00 
+  804320:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804324:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  80432b:	00 00 00 
+  80432e:	ff d0                	call   *%rax
+  804330:	89 c7                	mov    %eax,%edi
+  804332:	48 be a7 44 80 00 00 	movabs $0x8044a7,%rsi
+  804339:	00 00 00 
+  80433c:	48 b8 22 12 80 00 00 	movabs $0x801222,%rax
+  804343:	00 00 00 
+  804346:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	78 68                	js     8043b4 <add_pgfault_handler+0x105>
+    return res;
+}
+  80434c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804350:	c9                   	leave
+  804351:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804352:	48 b8 d7 0f 80 00 00 	movabs $0x800fd7,%rax
+  804359:	00 00 00 
+  80435c:	ff d0                	call   *%rax
+  80435e:	89 c7                	mov    %eax,%edi
+  804360:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804365:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80436a:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804371:	00 00 00 
+  804374:	48 b8 64 10 80 00 00 	movabs $0x801064,%rax
+  80437b:	00 00 00 
+  80437e:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804380:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804387:	00 00 00 
+  80438a:	48 8b 02             	mov    (%rdx),%rax
+  80438d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804391:	48 89 0a             	mov    %rcx,(%rdx)
+  804394:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80439b:	00 00 00 
+  80439e:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8043a2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043a9:	00 00 00 
+  8043ac:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043af:	e9 70 ff ff ff       	jmp    804324 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043b4:	89 c1                	mov    %eax,%ecx
+  8043b6:	48 ba c6 4d 80 00 00 	movabs $0x804dc6,%rdx
+  8043bd:	00 00 00 
+  8043c0:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043c5:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  8043cc:	00 00 00 
+  8043cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d4:	49 b8 82 41 80 00 00 	movabs $0x804182,%r8
+  8043db:	00 00 00 
+  8043de:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e6:	e9 61 ff ff ff       	jmp    80434c <add_pgfault_handler+0x9d>
+
+00000000008043eb <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043eb:	55                   	push   %rbp
+  8043ec:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043ef:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043f6:	00 00 00 
+  8043f9:	80 38 00             	cmpb   $0x0,(%rax)
+  8043fc:	74 33                	je     804431 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043fe:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804405:	00 00 00 
+  804408:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80440d:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804414:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804417:	48 85 c0             	test   %rax,%rax
+  80441a:	0f 84 85 00 00 00    	je     8044a5 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804420:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804424:	74 40                	je     804466 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804426:	48 83 c1 01          	add    $0x1,%rcx
+  80442a:	48 39 c1             	cmp    %rax,%rcx
+  80442d:	75 f1                	jne    804420 <remove_pgfault_handler+0x35>
+  80442f:	eb 74                	jmp    8044a5 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804431:	48 b9 de 4d 80 00 00 	movabs $0x804dde,%rcx
+  804438:	00 00 00 
+  80443b:	48 ba 07 4d 80 00 00 	movabs $0x804d07,%rdx
+  804442:	00 00 00 
+  804445:	be 43 00 00 00       	mov    $0x43,%esi
+  80444a:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  804451:	00 00 00 
+  804454:	b8 00 00 00 00       	mov    $0x0,%eax
+  804459:	49 b8 82 41 80 00 00 	movabs $0x804182,%r8
+  804460:	00 00 00 
+  804463:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804466:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80446d:	00 
+  80446e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804472:	48 29 ca             	sub    %rcx,%rdx
+  804475:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80447c:	00 00 00 
+  80447f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804483:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804488:	48 89 ce             	mov    %rcx,%rsi
+  80448b:	48 b8 ff 0c 80 00 00 	movabs $0x800cff,%rax
+  804492:	00 00 00 
+  804495:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804497:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80449e:	00 00 00 
+  8044a1:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8044a5:	5d                   	pop    %rbp
+  8044a6:	c3                   	ret
+
+00000000008044a7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8044a7:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8044aa:	48 b8 25 42 80 00 00 	movabs $0x804225,%rax
+  8044b1:	00 00 00 
+    call *%rax
+  8044b4:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044b6:	41 5f                	pop    %r15
+	popq %r15
+  8044b8:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044ba:	41 5f                	pop    %r15
+	popq %r14
+  8044bc:	41 5e                	pop    %r14
+	popq %r13
+  8044be:	41 5d                	pop    %r13
+	popq %r12
+  8044c0:	41 5c                	pop    %r12
+	popq %r11
+  8044c2:	41 5b                	pop    %r11
+	popq %r10
+  8044c4:	41 5a                	pop    %r10
+	popq %r9
+  8044c6:	41 59                	pop    %r9
+	popq %r8
+  8044c8:	41 58                	pop    %r8
+	popq %rsi
+  8044ca:	5e                   	pop    %rsi
+	popq %rdi
+  8044cb:	5f                   	pop    %rdi
+	popq %rbp
+  8044cc:	5d                   	pop    %rbp
+	popq %rdx
+  8044cd:	5a                   	pop    %rdx
+	popq %rcx
+  8044ce:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044cf:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044d4:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044d9:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044dd:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044e0:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044e5:	5b                   	pop    %rbx
+	popq %rax
+  8044e6:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044e7:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044eb:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044ec:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044f1:	c3                   	ret
+
+00000000008044f2 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044f2:	55                   	push   %rbp
+  8044f3:	48 89 e5             	mov    %rsp,%rbp
+  8044f6:	41 55                	push   %r13
+  8044f8:	41 54                	push   %r12
+  8044fa:	53                   	push   %rbx
+  8044fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ff:	49 89 fd             	mov    %rdi,%r13
+  804502:	48 89 f7             	mov    %rsi,%rdi
+  804505:	48 89 d3             	mov    %rdx,%rbx
+  804508:	49 89 cc             	mov    %rcx,%r12
+  80450b:	4c 89 c2             	mov    %r8,%rdx
+  80450e:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804511:	48 85 f6             	test   %rsi,%rsi
+  804514:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80451b:	00 00 00 
+  80451e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804522:	be 00 10 00 00       	mov    $0x1000,%esi
+  804527:	48 85 db             	test   %rbx,%rbx
+  80452a:	74 03                	je     80452f <ipc_recv_futex+0x3d>
+  80452c:	48 8b 33             	mov    (%rbx),%rsi
+  80452f:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804533:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  80453a:	00 00 00 
+  80453d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80453f:	85 c0                	test   %eax,%eax
+  804541:	78 75                	js     8045b8 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804543:	4d 85 ed             	test   %r13,%r13
+  804546:	74 14                	je     80455c <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804548:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80454f:	00 00 00 
+  804552:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804558:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80455c:	4d 85 e4             	test   %r12,%r12
+  80455f:	74 14                	je     804575 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804561:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804568:	00 00 00 
+  80456b:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804571:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804575:	48 85 db             	test   %rbx,%rbx
+  804578:	74 23                	je     80459d <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80457a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804581:	00 00 00 
+  804584:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80458a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80458f:	85 c9                	test   %ecx,%ecx
+  804591:	74 07                	je     80459a <ipc_recv_futex+0xa8>
+  804593:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80459a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80459d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045a4:	00 00 00 
+  8045a7:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045ad:	48 83 c4 08          	add    $0x8,%rsp
+  8045b1:	5b                   	pop    %rbx
+  8045b2:	41 5c                	pop    %r12
+  8045b4:	41 5d                	pop    %r13
+  8045b6:	5d                   	pop    %rbp
+  8045b7:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045b8:	4d 85 ed             	test   %r13,%r13
+  8045bb:	74 08                	je     8045c5 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045bd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045c4:	00 
+        if (perm_store != NULL) {
+  8045c5:	4d 85 e4             	test   %r12,%r12
+  8045c8:	74 08                	je     8045d2 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045ca:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045d1:	00 
+        if (size != NULL) {
+  8045d2:	48 85 db             	test   %rbx,%rbx
+  8045d5:	74 d6                	je     8045ad <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045d7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045de:	eb cd                	jmp    8045ad <ipc_recv_futex+0xbb>
+
+00000000008045e0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045e0:	55                   	push   %rbp
+  8045e1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8045e8:	6a 00                	push   $0x0
+  8045ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045f6:	48 b8 f2 44 80 00 00 	movabs $0x8044f2,%rax
+  8045fd:	00 00 00 
+  804600:	ff d0                	call   *%rax
+}
+  804602:	c9                   	leave
+  804603:	c3                   	ret
+
+0000000000804604 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804604:	55                   	push   %rbp
+  804605:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804608:	48 85 d2             	test   %rdx,%rdx
+  80460b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804612:	00 00 00 
+  804615:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804619:	89 f6                	mov    %esi,%esi
+  80461b:	48 b8 97 12 80 00 00 	movabs $0x801297,%rax
+  804622:	00 00 00 
+  804625:	ff d0                	call   *%rax
+    if (res < 0) {
+  804627:	85 c0                	test   %eax,%eax
+  804629:	78 02                	js     80462d <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80462b:	5d                   	pop    %rbp
+  80462c:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80462d:	89 c1                	mov    %eax,%ecx
+  80462f:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  804636:	00 00 00 
+  804639:	be 50 00 00 00       	mov    $0x50,%esi
+  80463e:	48 bf 0c 4e 80 00 00 	movabs $0x804e0c,%rdi
+  804645:	00 00 00 
+  804648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464d:	49 b8 82 41 80 00 00 	movabs $0x804182,%r8
+  804654:	00 00 00 
+  804657:	41 ff d0             	call   *%r8
+
+000000000080465a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80465a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80465f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804666:	00 00 00 
+  804669:	48 89 d0             	mov    %rdx,%rax
+  80466c:	48 c1 e0 04          	shl    $0x4,%rax
+  804670:	48 29 d0             	sub    %rdx,%rax
+  804673:	48 c1 e0 05          	shl    $0x5,%rax
+  804677:	48 01 c8             	add    %rcx,%rax
+  80467a:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804680:	39 f8                	cmp    %edi,%eax
+  804682:	74 13                	je     804697 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804684:	48 83 c2 01          	add    $0x1,%rdx
+  804688:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80468f:	75 d8                	jne    804669 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804691:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804696:	c3                   	ret
+            return envs[i].env_id;
+  804697:	48 89 d0             	mov    %rdx,%rax
+  80469a:	48 c1 e0 04          	shl    $0x4,%rax
+  80469e:	48 29 d0             	sub    %rdx,%rax
+  8046a1:	48 c1 e0 05          	shl    $0x5,%rax
+  8046a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046ac:	00 00 00 
+  8046af:	48 01 d0             	add    %rdx,%rax
+  8046b2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046b8:	c3                   	ret
+  8046b9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008046c0 <__rodata_start>:
+  8046c0:	25 64 0a 00 3c       	and    $0x3c000a64,%eax
+  8046c5:	75 6e                	jne    804735 <__rodata_start+0x75>
+  8046c7:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046cc:	3e 00 30             	ds add %dh,(%rax)
+  8046cf:	31 32                	xor    %esi,(%rdx)
+  8046d1:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046d8:	41                   	rex.B
+  8046d9:	42                   	rex.X
+  8046da:	43                   	rex.XB
+  8046db:	44                   	rex.R
+  8046dc:	45                   	rex.RB
+  8046dd:	46 00 30             	rex.RX add %r14b,(%rax)
+  8046e0:	31 32                	xor    %esi,(%rdx)
+  8046e2:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046e9:	61                   	(bad)
+  8046ea:	62 63 64 65 66       	(bad)
+  8046ef:	00 28                	add    %ch,(%rax)
+  8046f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046f2:	75 6c                	jne    804760 <__rodata_start+0xa0>
+  8046f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8046f5:	29 00                	sub    %eax,(%rax)
+  8046f7:	65 72 72             	gs jb  80476c <__rodata_start+0xac>
+  8046fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046fb:	72 20                	jb     80471d <__rodata_start+0x5d>
+  8046fd:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804702:	73 70                	jae    804774 <__rodata_start+0xb4>
+  804704:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804708:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80470f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804710:	72 00                	jb     804712 <__rodata_start+0x52>
+  804712:	62 61 64 20 65       	(bad)
+  804717:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804718:	76 69                	jbe    804783 <__rodata_start+0xc3>
+  80471a:	72 6f                	jb     80478b <__rodata_start+0xcb>
+  80471c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471d:	6d                   	insl   (%dx),%es:(%rdi)
+  80471e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804720:	74 00                	je     804722 <__rodata_start+0x62>
+  804722:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804729:	20 70 61             	and    %dh,0x61(%rax)
+  80472c:	72 61                	jb     80478f <__rodata_start+0xcf>
+  80472e:	6d                   	insl   (%dx),%es:(%rdi)
+  80472f:	65 74 65             	gs je  804797 <__rodata_start+0xd7>
+  804732:	72 00                	jb     804734 <__rodata_start+0x74>
+  804734:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804735:	75 74                	jne    8047ab <__rodata_start+0xeb>
+  804737:	20 6f 66             	and    %ch,0x66(%rdi)
+  80473a:	20 6d 65             	and    %ch,0x65(%rbp)
+  80473d:	6d                   	insl   (%dx),%es:(%rdi)
+  80473e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80473f:	72 79                	jb     8047ba <__rodata_start+0xfa>
+  804741:	00 6f 75             	add    %ch,0x75(%rdi)
+  804744:	74 20                	je     804766 <__rodata_start+0xa6>
+  804746:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804747:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80474b:	76 69                	jbe    8047b6 <__rodata_start+0xf6>
+  80474d:	72 6f                	jb     8047be <__rodata_start+0xfe>
+  80474f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804750:	6d                   	insl   (%dx),%es:(%rdi)
+  804751:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804753:	74 73                	je     8047c8 <__rodata_start+0x108>
+  804755:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804758:	72 72                	jb     8047cc <__rodata_start+0x10c>
+  80475a:	75 70                	jne    8047cc <__rodata_start+0x10c>
+  80475c:	74 65                	je     8047c3 <__rodata_start+0x103>
+  80475e:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804763:	75 67                	jne    8047cc <__rodata_start+0x10c>
+  804765:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804768:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80476a:	00 73 65             	add    %dh,0x65(%rbx)
+  80476d:	67 6d                	insl   (%dx),%es:(%edi)
+  80476f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804771:	74 61                	je     8047d4 <__rodata_start+0x114>
+  804773:	74 69                	je     8047de <__rodata_start+0x11e>
+  804775:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804776:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804777:	20 66 61             	and    %ah,0x61(%rsi)
+  80477a:	75 6c                	jne    8047e8 <__rodata_start+0x128>
+  80477c:	74 00                	je     80477e <__rodata_start+0xbe>
+  80477e:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804785:	20 45 4c             	and    %al,0x4c(%rbp)
+  804788:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80478c:	61                   	(bad)
+  80478d:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804792:	20 73 75             	and    %dh,0x75(%rbx)
+  804795:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804798:	73 79                	jae    804813 <__rodata_start+0x153>
+  80479a:	73 74                	jae    804810 <__rodata_start+0x150>
+  80479c:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80479e:	20 63 61             	and    %ah,0x61(%rbx)
+  8047a1:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a2:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a3:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047a6:	74 72                	je     80481a <__rodata_start+0x15a>
+  8047a8:	79 20                	jns    8047ca <__rodata_start+0x10a>
+  8047aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047ac:	74 20                	je     8047ce <__rodata_start+0x10e>
+  8047ae:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047b0:	75 6e                	jne    804820 <__rodata_start+0x160>
+  8047b2:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8047b6:	76 20                	jbe    8047d8 <__rodata_start+0x118>
+  8047b8:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047bf:	72 65                	jb     804826 <__rodata_start+0x166>
+  8047c1:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047c4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047c5:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047c9:	65 78 70             	gs js  80483c <__rodata_start+0x17c>
+  8047cc:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8047d1:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047d4:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8047d8:	20 66 69             	and    %ah,0x69(%rsi)
+  8047db:	6c                   	insb   (%dx),%es:(%rdi)
+  8047dc:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8047e0:	20 66 72             	and    %ah,0x72(%rsi)
+  8047e3:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8047e8:	61                   	(bad)
+  8047e9:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8047ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ee:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8047f2:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8047f5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047f7:	20 6d 61             	and    %ch,0x61(%rbp)
+  8047fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047fb:	79 20                	jns    80481d <__rodata_start+0x15d>
+  8047fd:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804804:	72 65                	jb     80486b <__rodata_start+0x1ab>
+  804806:	20 6f 70             	and    %ch,0x70(%rdi)
+  804809:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80480b:	00 66 69             	add    %ah,0x69(%rsi)
+  80480e:	6c                   	insb   (%dx),%es:(%rdi)
+  80480f:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804813:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804816:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804817:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80481a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80481b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80481c:	74 20                	je     80483e <__rodata_start+0x17e>
+  80481e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804820:	75 6e                	jne    804890 <__rodata_start+0x1d0>
+  804822:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804826:	76 61                	jbe    804889 <__rodata_start+0x1c9>
+  804828:	6c                   	insb   (%dx),%es:(%rdi)
+  804829:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804830:	00 
+  804831:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804838:	72 65                	jb     80489f <__rodata_start+0x1df>
+  80483a:	61                   	(bad)
+  80483b:	64 79 20             	fs jns 80485e <__rodata_start+0x19e>
+  80483e:	65 78 69             	gs js  8048aa <__rodata_start+0x1ea>
+  804841:	73 74                	jae    8048b7 <__rodata_start+0x1f7>
+  804843:	73 00                	jae    804845 <__rodata_start+0x185>
+  804845:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804846:	70 65                	jo     8048ad <__rodata_start+0x1ed>
+  804848:	72 61                	jb     8048ab <__rodata_start+0x1eb>
+  80484a:	74 69                	je     8048b5 <__rodata_start+0x1f5>
+  80484c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80484d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80484e:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804851:	74 20                	je     804873 <__rodata_start+0x1b3>
+  804853:	73 75                	jae    8048ca <__rodata_start+0x20a>
+  804855:	70 70                	jo     8048c7 <__rodata_start+0x207>
+  804857:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804858:	72 74                	jb     8048ce <__rodata_start+0x20e>
+  80485a:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804860:	20 61 67             	and    %ah,0x67(%rcx)
+  804863:	61                   	(bad)
+  804864:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  80486b:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  80486f:	74 00                	je     804871 <__rodata_start+0x1b1>
+  804871:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804878:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80487b:	20 75 73             	and    %dh,0x73(%rbp)
+  80487e:	65 00 cd             	gs add %cl,%ch
+  804881:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  804887:	00 0e                	add    %cl,(%rsi)
+  804889:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80488f:	00 fe                	add    %bh,%dh
+  804891:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804897:	00 0e                	add    %cl,(%rsi)
+  804899:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80489f:	00 0e                	add    %cl,(%rsi)
+  8048a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048a7:	00 0e                	add    %cl,(%rsi)
+  8048a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048af:	00 0e                	add    %cl,(%rsi)
+  8048b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048b7:	00 ec                	add    %ch,%ah
+  8048b9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048bf:	00 0e                	add    %cl,(%rsi)
+  8048c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048c7:	00 0e                	add    %cl,(%rsi)
+  8048c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048cf:	00 e0                	add    %ah,%al
+  8048d1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048d7:	00 5a 04             	add    %bl,0x4(%rdx)
+  8048da:	80 00 00             	addb   $0x0,(%rax)
+  8048dd:	00 00                	add    %al,(%rax)
+  8048df:	00 0e                	add    %cl,(%rsi)
+  8048e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048e7:	00 e0                	add    %ah,%al
+  8048e9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048ef:	00 26                	add    %ah,(%rsi)
+  8048f1:	04 80                	add    $0x80,%al
+  8048f3:	00 00                	add    %al,(%rax)
+  8048f5:	00 00                	add    %al,(%rax)
+  8048f7:	00 26                	add    %ah,(%rsi)
+  8048f9:	04 80                	add    $0x80,%al
+  8048fb:	00 00                	add    %al,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 26                	add    %ah,(%rsi)
+  804901:	04 80                	add    $0x80,%al
+  804903:	00 00                	add    %al,(%rax)
+  804905:	00 00                	add    %al,(%rax)
+  804907:	00 26                	add    %ah,(%rsi)
+  804909:	04 80                	add    $0x80,%al
+  80490b:	00 00                	add    %al,(%rax)
+  80490d:	00 00                	add    %al,(%rax)
+  80490f:	00 26                	add    %ah,(%rsi)
+  804911:	04 80                	add    $0x80,%al
+  804913:	00 00                	add    %al,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 26                	add    %ah,(%rsi)
+  804919:	04 80                	add    $0x80,%al
+  80491b:	00 00                	add    %al,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 26                	add    %ah,(%rsi)
+  804921:	04 80                	add    $0x80,%al
+  804923:	00 00                	add    %al,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 26                	add    %ah,(%rsi)
+  804929:	04 80                	add    $0x80,%al
+  80492b:	00 00                	add    %al,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 26                	add    %ah,(%rsi)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 0e                	add    %cl,(%rsi)
+  804939:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80493f:	00 0e                	add    %cl,(%rsi)
+  804941:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804947:	00 0e                	add    %cl,(%rsi)
+  804949:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80494f:	00 0e                	add    %cl,(%rsi)
+  804951:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804957:	00 0e                	add    %cl,(%rsi)
+  804959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80495f:	00 0e                	add    %cl,(%rsi)
+  804961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804967:	00 0e                	add    %cl,(%rsi)
+  804969:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80496f:	00 0e                	add    %cl,(%rsi)
+  804971:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804977:	00 0e                	add    %cl,(%rsi)
+  804979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80497f:	00 0e                	add    %cl,(%rsi)
+  804981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804987:	00 0e                	add    %cl,(%rsi)
+  804989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80498f:	00 0e                	add    %cl,(%rsi)
+  804991:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804997:	00 0e                	add    %cl,(%rsi)
+  804999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80499f:	00 0e                	add    %cl,(%rsi)
+  8049a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049a7:	00 0e                	add    %cl,(%rsi)
+  8049a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049af:	00 0e                	add    %cl,(%rsi)
+  8049b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049b7:	00 0e                	add    %cl,(%rsi)
+  8049b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049bf:	00 0e                	add    %cl,(%rsi)
+  8049c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049c7:	00 0e                	add    %cl,(%rsi)
+  8049c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049cf:	00 0e                	add    %cl,(%rsi)
+  8049d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049d7:	00 0e                	add    %cl,(%rsi)
+  8049d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049df:	00 0e                	add    %cl,(%rsi)
+  8049e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049e7:	00 0e                	add    %cl,(%rsi)
+  8049e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ef:	00 0e                	add    %cl,(%rsi)
+  8049f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049f7:	00 0e                	add    %cl,(%rsi)
+  8049f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ff:	00 0e                	add    %cl,(%rsi)
+  804a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a07:	00 0e                	add    %cl,(%rsi)
+  804a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a0f:	00 0e                	add    %cl,(%rsi)
+  804a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a17:	00 0e                	add    %cl,(%rsi)
+  804a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a1f:	00 0e                	add    %cl,(%rsi)
+  804a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a27:	00 31                	add    %dh,(%rcx)
+  804a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a2f:	00 0e                	add    %cl,(%rsi)
+  804a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a37:	00 0e                	add    %cl,(%rsi)
+  804a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a3f:	00 0e                	add    %cl,(%rsi)
+  804a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a47:	00 0e                	add    %cl,(%rsi)
+  804a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a4f:	00 0e                	add    %cl,(%rsi)
+  804a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a57:	00 0e                	add    %cl,(%rsi)
+  804a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a5f:	00 0e                	add    %cl,(%rsi)
+  804a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a67:	00 0e                	add    %cl,(%rsi)
+  804a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a6f:	00 0e                	add    %cl,(%rsi)
+  804a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a77:	00 0e                	add    %cl,(%rsi)
+  804a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a7f:	00 7d 04             	add    %bh,0x4(%rbp)
+  804a82:	80 00 00             	addb   $0x0,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 4c 06 80          	add    %cl,-0x80(%rsi,%rax,1)
+  804a8b:	00 00                	add    %al,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 0e                	add    %cl,(%rsi)
+  804a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a97:	00 0e                	add    %cl,(%rsi)
+  804a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a9f:	00 0e                	add    %cl,(%rsi)
+  804aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aa7:	00 0e                	add    %cl,(%rsi)
+  804aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aaf:	00 ac 04 80 00 00 00 	add    %ch,0x80(%rsp,%rax,1)
+  804ab6:	00 00                	add    %al,(%rax)
+  804ab8:	0e                   	(bad)
+  804ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804abf:	00 0e                	add    %cl,(%rsi)
+  804ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ac7:	00 72 04             	add    %dh,0x4(%rdx)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 0e                	add    %cl,(%rsi)
+  804ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ad7:	00 0e                	add    %cl,(%rsi)
+  804ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804adf:	00 f4                	add    %dh,%ah
+  804ae1:	07                   	(bad)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 be 08 80 00 00    	add    %bh,0x8008(%rsi)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 0e                	add    %cl,(%rsi)
+  804af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804af7:	00 0e                	add    %cl,(%rsi)
+  804af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aff:	00 43 05             	add    %al,0x5(%rbx)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 0e                	add    %cl,(%rsi)
+  804b09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b0f:	00 20                	add    %ah,(%rax)
+  804b11:	07                   	(bad)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 0e                	add    %cl,(%rsi)
+  804b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b1f:	00 0e                	add    %cl,(%rsi)
+  804b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b27:	00 31                	add    %dh,(%rcx)
+  804b29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b2f:	00 0e                	add    %cl,(%rsi)
+  804b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b37:	00 d6                	add    %dl,%dh
+  804b39:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b40 <error_string>:
+	...
+  804b48:	00 47 80 00 00 00 00 00 12 47 80 00 00 00 00 00     .G.......G......
+  804b58:	22 47 80 00 00 00 00 00 34 47 80 00 00 00 00 00     "G......4G......
+  804b68:	42 47 80 00 00 00 00 00 56 47 80 00 00 00 00 00     BG......VG......
+  804b78:	6b 47 80 00 00 00 00 00 7e 47 80 00 00 00 00 00     kG......~G......
+  804b88:	90 47 80 00 00 00 00 00 a4 47 80 00 00 00 00 00     .G.......G......
+  804b98:	b4 47 80 00 00 00 00 00 c7 47 80 00 00 00 00 00     .G.......G......
+  804ba8:	de 47 80 00 00 00 00 00 f4 47 80 00 00 00 00 00     .G.......G......
+  804bb8:	0c 48 80 00 00 00 00 00 24 48 80 00 00 00 00 00     .H......$H......
+  804bc8:	31 48 80 00 00 00 00 00 f8 4b 80 00 00 00 00 00     1H.......K......
+  804bd8:	45 48 80 00 00 00 00 00 5d 48 80 00 00 00 00 00     EH......]H......
+  804be8:	67 48 80 00 00 00 00 00 71 48 80 00 00 00 00 00     gH......qH......
+  804bf8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c08:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c18:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c28:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c38:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c48:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c58:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804c68:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804c78:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804c88:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804c98:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804ca8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cb8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804cc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cd8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804ce0 <devtab>:
+  804ce0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804cf0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804d60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804d70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804d80:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804d90:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804da0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804db0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804dc0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804dd0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804de0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804df0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e00:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e10:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
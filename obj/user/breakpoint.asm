@@ -0,0 +1,7877 @@
+
+obj/user/breakpoint:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 04 00 00 00       	call   800027 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    asm volatile("int $3");
+  800025:	cc                   	int3
+}
+  800026:	c3                   	ret
+
+0000000000800027 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800027:	55                   	push   %rbp
+  800028:	48 89 e5             	mov    %rsp,%rbp
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	41 89 fd             	mov    %edi,%r13d
+  800035:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800038:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  80003f:	00 00 00 
+  800042:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800049:	00 00 00 
+  80004c:	48 39 c2             	cmp    %rax,%rdx
+  80004f:	73 17                	jae    800068 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800051:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800054:	49 89 c4             	mov    %rax,%r12
+  800057:	48 83 c3 08          	add    $0x8,%rbx
+  80005b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800060:	ff 53 f8             	call   *-0x8(%rbx)
+  800063:	4c 39 e3             	cmp    %r12,%rbx
+  800066:	72 ef                	jb     800057 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800068:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	89 c2                	mov    %eax,%edx
+  800076:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007c:	48 89 d0             	mov    %rdx,%rax
+  80007f:	48 c1 e0 04          	shl    $0x4,%rax
+  800083:	48 29 d0             	sub    %rdx,%rax
+  800086:	48 c1 e0 05          	shl    $0x5,%rax
+  80008a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800091:	00 00 00 
+  800094:	48 01 d0             	add    %rdx,%rax
+  800097:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80009e:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a1:	45 85 ed             	test   %r13d,%r13d
+  8000a4:	7e 0d                	jle    8000b3 <libmain+0x8c>
+  8000a6:	49 8b 06             	mov    (%r14),%rax
+  8000a9:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b0:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b3:	4c 89 f6             	mov    %r14,%rsi
+  8000b6:	44 89 ef             	mov    %r13d,%edi
+  8000b9:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000c0:	00 00 00 
+  8000c3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c5:	48 b8 da 00 80 00 00 	movabs $0x8000da,%rax
+  8000cc:	00 00 00 
+  8000cf:	ff d0                	call   *%rax
+#endif
+}
+  8000d1:	5b                   	pop    %rbx
+  8000d2:	41 5c                	pop    %r12
+  8000d4:	41 5d                	pop    %r13
+  8000d6:	41 5e                	pop    %r14
+  8000d8:	5d                   	pop    %rbp
+  8000d9:	c3                   	ret
+
+00000000008000da <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000da:	55                   	push   %rbp
+  8000db:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000de:	48 b8 8e 08 80 00 00 	movabs $0x80088e,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000ef:	48 b8 45 01 80 00 00 	movabs $0x800145,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+}
+  8000fb:	5d                   	pop    %rbp
+  8000fc:	c3                   	ret
+
+00000000008000fd <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800102:	ba 00 00 00 00       	mov    $0x0,%edx
+  800107:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800119:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011b:	c3                   	ret
+
+000000000080011c <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80011c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800121:	bf 00 00 00 00       	mov    $0x0,%edi
+  800126:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800142:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800144:	c3                   	ret
+
+0000000000800145 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800145:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800148:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80014d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800152:	ba 00 00 00 00       	mov    $0x0,%edx
+  800157:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80015d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800163:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800169:	0f 05                	syscall
+    if (check && ret > 0) {
+  80016b:	48 85 c0             	test   %rax,%rax
+  80016e:	7f 01                	jg     800171 <sys_env_destroy+0x2c>
+}
+  800170:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800171:	55                   	push   %rbp
+  800172:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800175:	49 89 c0             	mov    %rax,%r8
+  800178:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80017d:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800184:	00 00 00 
+  800187:	be 29 00 00 00       	mov    $0x29,%esi
+  80018c:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800193:	00 00 00 
+  800196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019b:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  8001a2:	00 00 00 
+  8001a5:	41 ff d1             	call   *%r9
+
+00000000008001a8 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001a8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001ce:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001d0:	c3                   	ret
+
+00000000008001d1 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001db:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001f7:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f9:	c3                   	ret
+
+00000000008001fa <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001fa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001ff:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800206:	00 00 00 
+  800209:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80020f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800215:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80021b:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80021d:	c3                   	ret
+
+000000000080021e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80021e:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800221:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800226:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80022c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800232:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800234:	c3                   	ret
+
+0000000000800235 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800235:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800238:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80023d:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80024c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80024e:	48 85 c0             	test   %rax,%rax
+  800251:	7f 01                	jg     800254 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800253:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800254:	55                   	push   %rbp
+  800255:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800258:	49 89 c0             	mov    %rax,%r8
+  80025b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800260:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800267:	00 00 00 
+  80026a:	be 29 00 00 00       	mov    $0x29,%esi
+  80026f:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800276:	00 00 00 
+  800279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027e:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  800285:	00 00 00 
+  800288:	41 ff d1             	call   *%r9
+
+000000000080028b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80028b:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80028e:	48 63 d2             	movslq %edx,%rdx
+  800291:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800294:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800299:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80029c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80029e:	48 85 c0             	test   %rax,%rax
+  8002a1:	7f 01                	jg     8002a4 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002a3:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002a4:	55                   	push   %rbp
+  8002a5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002a8:	49 89 c0             	mov    %rax,%r8
+  8002ab:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002b0:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8002b7:	00 00 00 
+  8002ba:	be 29 00 00 00       	mov    $0x29,%esi
+  8002bf:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8002c6:	00 00 00 
+  8002c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ce:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  8002d5:	00 00 00 
+  8002d8:	41 ff d1             	call   *%r9
+
+00000000008002db <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002db:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002de:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8002f5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002f7:	48 85 c0             	test   %rax,%rax
+  8002fa:	7f 01                	jg     8002fd <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8002fc:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8002fd:	55                   	push   %rbp
+  8002fe:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800301:	49 89 c0             	mov    %rax,%r8
+  800304:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800309:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800310:	00 00 00 
+  800313:	be 29 00 00 00       	mov    $0x29,%esi
+  800318:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  80031f:	00 00 00 
+  800322:	b8 00 00 00 00       	mov    $0x0,%eax
+  800327:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  80032e:	00 00 00 
+  800331:	41 ff d1             	call   *%r9
+
+0000000000800334 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800334:	48 63 f6             	movslq %esi,%rsi
+  800337:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80033a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80033f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800344:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80034a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800350:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800356:	0f 05                	syscall
+    if (check && ret > 0) {
+  800358:	48 85 c0             	test   %rax,%rax
+  80035b:	7f 01                	jg     80035e <sys_env_set_status+0x2a>
+}
+  80035d:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80035e:	55                   	push   %rbp
+  80035f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800362:	49 89 c0             	mov    %rax,%r8
+  800365:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80036a:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800371:	00 00 00 
+  800374:	be 29 00 00 00       	mov    $0x29,%esi
+  800379:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800380:	00 00 00 
+  800383:	b8 00 00 00 00       	mov    $0x0,%eax
+  800388:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  80038f:	00 00 00 
+  800392:	41 ff d1             	call   *%r9
+
+0000000000800395 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800395:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800398:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80039d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003b4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003b6:	48 85 c0             	test   %rax,%rax
+  8003b9:	7f 01                	jg     8003bc <sys_env_set_trapframe+0x27>
+}
+  8003bb:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003bc:	55                   	push   %rbp
+  8003bd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c0:	49 89 c0             	mov    %rax,%r8
+  8003c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003c8:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8003cf:	00 00 00 
+  8003d2:	be 29 00 00 00       	mov    $0x29,%esi
+  8003d7:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8003de:	00 00 00 
+  8003e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e6:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  8003ed:	00 00 00 
+  8003f0:	41 ff d1             	call   *%r9
+
+00000000008003f3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8003f3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800400:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80040c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800412:	0f 05                	syscall
+    if (check && ret > 0) {
+  800414:	48 85 c0             	test   %rax,%rax
+  800417:	7f 01                	jg     80041a <sys_env_set_pgfault_upcall+0x27>
+}
+  800419:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80041a:	55                   	push   %rbp
+  80041b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80041e:	49 89 c0             	mov    %rax,%r8
+  800421:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800426:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  80042d:	00 00 00 
+  800430:	be 29 00 00 00       	mov    $0x29,%esi
+  800435:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  80043c:	00 00 00 
+  80043f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800444:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  80044b:	00 00 00 
+  80044e:	41 ff d1             	call   *%r9
+
+0000000000800451 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800451:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800454:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800457:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80045c:	4d 63 c0             	movslq %r8d,%r8
+  80045f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800465:	0f 05                	syscall
+}
+  800467:	c3                   	ret
+
+0000000000800468 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800468:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80046b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80046e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800473:	4d 63 c0             	movslq %r8d,%r8
+  800476:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80047c:	0f 05                	syscall
+}
+  80047e:	c3                   	ret
+
+000000000080047f <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80047f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800484:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800487:	45 89 c0             	mov    %r8d,%r8d
+  80048a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800490:	0f 05                	syscall
+    if (check && ret > 0) {
+  800492:	48 85 c0             	test   %rax,%rax
+  800495:	7f 01                	jg     800498 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800497:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  800498:	55                   	push   %rbp
+  800499:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80049c:	49 89 c0             	mov    %rax,%r8
+  80049f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004a4:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8004ab:	00 00 00 
+  8004ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8004b3:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8004ba:	00 00 00 
+  8004bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c2:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  8004c9:	00 00 00 
+  8004cc:	41 ff d1             	call   *%r9
+
+00000000008004cf <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004cf:	55                   	push   %rbp
+  8004d0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e3:	48 b8 7f 04 80 00 00 	movabs $0x80047f,%rax
+  8004ea:	00 00 00 
+  8004ed:	ff d0                	call   *%rax
+}
+  8004ef:	5d                   	pop    %rbp
+  8004f0:	c3                   	ret
+
+00000000008004f1 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8004f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004fb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800500:	ba 00 00 00 00       	mov    $0x0,%edx
+  800505:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80050b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800511:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800517:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800519:	c3                   	ret
+
+000000000080051a <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80051a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80051f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800524:	ba 00 00 00 00       	mov    $0x0,%edx
+  800529:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80052f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800535:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80053b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80053d:	48 85 c0             	test   %rax,%rax
+  800540:	7f 01                	jg     800543 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800542:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800543:	55                   	push   %rbp
+  800544:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800547:	49 89 c0             	mov    %rax,%r8
+  80054a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80054f:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800556:	00 00 00 
+  800559:	be 29 00 00 00       	mov    $0x29,%esi
+  80055e:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800565:	00 00 00 
+  800568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056d:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  800574:	00 00 00 
+  800577:	41 ff d1             	call   *%r9
+
+000000000080057a <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80057a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80057f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800584:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800589:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80059a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005a0:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005a2:	c3                   	ret
+
+00000000008005a3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005a3:	89 d2                	mov    %edx,%edx
+  8005a5:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005a7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005be:	0f 05                	syscall
+}
+  8005c0:	c3                   	ret
+
+00000000008005c1 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005c1:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e0:	0f 05                	syscall
+}
+  8005e2:	c3                   	ret
+
+00000000008005e3 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005e3:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005e6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800602:	0f 05                	syscall
+}
+  800604:	c3                   	ret
+
+0000000000800605 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800605:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800608:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80060d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800612:	ba 00 00 00 00       	mov    $0x0,%edx
+  800617:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80061d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800623:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800629:	0f 05                	syscall
+    if (check && ret > 0) {
+  80062b:	48 85 c0             	test   %rax,%rax
+  80062e:	7f 01                	jg     800631 <sys_irq_ack+0x2c>
+}
+  800630:	c3                   	ret
+sys_irq_ack(int irq) {
+  800631:	55                   	push   %rbp
+  800632:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800635:	49 89 c0             	mov    %rax,%r8
+  800638:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80063d:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800644:	00 00 00 
+  800647:	be 29 00 00 00       	mov    $0x29,%esi
+  80064c:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800653:	00 00 00 
+  800656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065b:	49 b9 53 33 80 00 00 	movabs $0x803353,%r9
+  800662:	00 00 00 
+  800665:	41 ff d1             	call   *%r9
+
+0000000000800668 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800668:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80066f:	ff ff ff 
+  800672:	48 01 f8             	add    %rdi,%rax
+  800675:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800679:	c3                   	ret
+
+000000000080067a <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80067a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800681:	ff ff ff 
+  800684:	48 01 f8             	add    %rdi,%rax
+  800687:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80068b:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800691:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800695:	c3                   	ret
+
+0000000000800696 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800696:	55                   	push   %rbp
+  800697:	48 89 e5             	mov    %rsp,%rbp
+  80069a:	41 57                	push   %r15
+  80069c:	41 56                	push   %r14
+  80069e:	41 55                	push   %r13
+  8006a0:	41 54                	push   %r12
+  8006a2:	53                   	push   %rbx
+  8006a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a7:	49 89 ff             	mov    %rdi,%r15
+  8006aa:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006af:	49 bd 25 2e 80 00 00 	movabs $0x802e25,%r13
+  8006b6:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006b9:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006bf:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c2:	48 89 df             	mov    %rbx,%rdi
+  8006c5:	41 ff d5             	call   *%r13
+  8006c8:	83 e0 04             	and    $0x4,%eax
+  8006cb:	74 17                	je     8006e4 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006cd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006d4:	4c 39 f3             	cmp    %r14,%rbx
+  8006d7:	75 e6                	jne    8006bf <fd_alloc+0x29>
+  8006d9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006df:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006e4:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006e7:	48 83 c4 08          	add    $0x8,%rsp
+  8006eb:	5b                   	pop    %rbx
+  8006ec:	41 5c                	pop    %r12
+  8006ee:	41 5d                	pop    %r13
+  8006f0:	41 5e                	pop    %r14
+  8006f2:	41 5f                	pop    %r15
+  8006f4:	5d                   	pop    %rbp
+  8006f5:	c3                   	ret
+
+00000000008006f6 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006f6:	83 ff 1f             	cmp    $0x1f,%edi
+  8006f9:	77 39                	ja     800734 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006fb:	55                   	push   %rbp
+  8006fc:	48 89 e5             	mov    %rsp,%rbp
+  8006ff:	41 54                	push   %r12
+  800701:	53                   	push   %rbx
+  800702:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800705:	48 63 df             	movslq %edi,%rbx
+  800708:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80070f:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800713:	48 89 df             	mov    %rbx,%rdi
+  800716:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  80071d:	00 00 00 
+  800720:	ff d0                	call   *%rax
+  800722:	a8 04                	test   $0x4,%al
+  800724:	74 14                	je     80073a <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800726:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80072a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80072f:	5b                   	pop    %rbx
+  800730:	41 5c                	pop    %r12
+  800732:	5d                   	pop    %rbp
+  800733:	c3                   	ret
+        return -E_INVAL;
+  800734:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800739:	c3                   	ret
+        return -E_INVAL;
+  80073a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80073f:	eb ee                	jmp    80072f <fd_lookup+0x39>
+
+0000000000800741 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800741:	55                   	push   %rbp
+  800742:	48 89 e5             	mov    %rsp,%rbp
+  800745:	41 54                	push   %r12
+  800747:	53                   	push   %rbx
+  800748:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80074b:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  800752:	00 00 00 
+  800755:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80075c:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80075f:	39 3b                	cmp    %edi,(%rbx)
+  800761:	74 47                	je     8007aa <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800763:	48 83 c0 08          	add    $0x8,%rax
+  800767:	48 8b 18             	mov    (%rax),%rbx
+  80076a:	48 85 db             	test   %rbx,%rbx
+  80076d:	75 f0                	jne    80075f <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80076f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800776:	00 00 00 
+  800779:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80077f:	89 fa                	mov    %edi,%edx
+  800781:	48 bf c8 46 80 00 00 	movabs $0x8046c8,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 b9 a3 34 80 00 00 	movabs $0x8034a3,%rcx
+  800797:	00 00 00 
+  80079a:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80079c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007a1:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007a5:	5b                   	pop    %rbx
+  8007a6:	41 5c                	pop    %r12
+  8007a8:	5d                   	pop    %rbp
+  8007a9:	c3                   	ret
+            return 0;
+  8007aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007af:	eb f0                	jmp    8007a1 <dev_lookup+0x60>
+
+00000000008007b1 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007b1:	55                   	push   %rbp
+  8007b2:	48 89 e5             	mov    %rsp,%rbp
+  8007b5:	41 55                	push   %r13
+  8007b7:	41 54                	push   %r12
+  8007b9:	53                   	push   %rbx
+  8007ba:	48 83 ec 18          	sub    $0x18,%rsp
+  8007be:	48 89 fb             	mov    %rdi,%rbx
+  8007c1:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007c4:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007cb:	ff ff ff 
+  8007ce:	48 01 df             	add    %rbx,%rdi
+  8007d1:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007d5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007d9:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  8007e0:	00 00 00 
+  8007e3:	ff d0                	call   *%rax
+  8007e5:	41 89 c5             	mov    %eax,%r13d
+  8007e8:	85 c0                	test   %eax,%eax
+  8007ea:	78 06                	js     8007f2 <fd_close+0x41>
+  8007ec:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007f0:	74 1a                	je     80080c <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007f2:	45 84 e4             	test   %r12b,%r12b
+  8007f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fa:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007fe:	44 89 e8             	mov    %r13d,%eax
+  800801:	48 83 c4 18          	add    $0x18,%rsp
+  800805:	5b                   	pop    %rbx
+  800806:	41 5c                	pop    %r12
+  800808:	41 5d                	pop    %r13
+  80080a:	5d                   	pop    %rbp
+  80080b:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80080c:	8b 3b                	mov    (%rbx),%edi
+  80080e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800812:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800819:	00 00 00 
+  80081c:	ff d0                	call   *%rax
+  80081e:	41 89 c5             	mov    %eax,%r13d
+  800821:	85 c0                	test   %eax,%eax
+  800823:	78 1b                	js     800840 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800825:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800829:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80082d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800833:	48 85 c0             	test   %rax,%rax
+  800836:	74 08                	je     800840 <fd_close+0x8f>
+  800838:	48 89 df             	mov    %rbx,%rdi
+  80083b:	ff d0                	call   *%rax
+  80083d:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800840:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800845:	48 89 de             	mov    %rbx,%rsi
+  800848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80084d:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  800854:	00 00 00 
+  800857:	ff d0                	call   *%rax
+    return res;
+  800859:	eb a3                	jmp    8007fe <fd_close+0x4d>
+
+000000000080085b <close>:
+
+int
+close(int fdnum) {
+  80085b:	55                   	push   %rbp
+  80085c:	48 89 e5             	mov    %rsp,%rbp
+  80085f:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800863:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800867:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  80086e:	00 00 00 
+  800871:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800873:	85 c0                	test   %eax,%eax
+  800875:	78 15                	js     80088c <close+0x31>
+
+    return fd_close(fd, 1);
+  800877:	be 01 00 00 00       	mov    $0x1,%esi
+  80087c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800880:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  800887:	00 00 00 
+  80088a:	ff d0                	call   *%rax
+}
+  80088c:	c9                   	leave
+  80088d:	c3                   	ret
+
+000000000080088e <close_all>:
+
+void
+close_all(void) {
+  80088e:	55                   	push   %rbp
+  80088f:	48 89 e5             	mov    %rsp,%rbp
+  800892:	41 54                	push   %r12
+  800894:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800895:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80089a:	49 bc 5b 08 80 00 00 	movabs $0x80085b,%r12
+  8008a1:	00 00 00 
+  8008a4:	89 df                	mov    %ebx,%edi
+  8008a6:	41 ff d4             	call   *%r12
+  8008a9:	83 c3 01             	add    $0x1,%ebx
+  8008ac:	83 fb 20             	cmp    $0x20,%ebx
+  8008af:	75 f3                	jne    8008a4 <close_all+0x16>
+}
+  8008b1:	5b                   	pop    %rbx
+  8008b2:	41 5c                	pop    %r12
+  8008b4:	5d                   	pop    %rbp
+  8008b5:	c3                   	ret
+
+00000000008008b6 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008b6:	55                   	push   %rbp
+  8008b7:	48 89 e5             	mov    %rsp,%rbp
+  8008ba:	41 57                	push   %r15
+  8008bc:	41 56                	push   %r14
+  8008be:	41 55                	push   %r13
+  8008c0:	41 54                	push   %r12
+  8008c2:	53                   	push   %rbx
+  8008c3:	48 83 ec 18          	sub    $0x18,%rsp
+  8008c7:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008ca:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008ce:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  8008d5:	00 00 00 
+  8008d8:	ff d0                	call   *%rax
+  8008da:	89 c3                	mov    %eax,%ebx
+  8008dc:	85 c0                	test   %eax,%eax
+  8008de:	0f 88 b8 00 00 00    	js     80099c <dup+0xe6>
+    close(newfdnum);
+  8008e4:	44 89 e7             	mov    %r12d,%edi
+  8008e7:	48 b8 5b 08 80 00 00 	movabs $0x80085b,%rax
+  8008ee:	00 00 00 
+  8008f1:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008f3:	4d 63 ec             	movslq %r12d,%r13
+  8008f6:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008fd:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800901:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800905:	4c 89 ff             	mov    %r15,%rdi
+  800908:	49 be 7a 06 80 00 00 	movabs $0x80067a,%r14
+  80090f:	00 00 00 
+  800912:	41 ff d6             	call   *%r14
+  800915:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800918:	4c 89 ef             	mov    %r13,%rdi
+  80091b:	41 ff d6             	call   *%r14
+  80091e:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800921:	48 89 df             	mov    %rbx,%rdi
+  800924:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  80092b:	00 00 00 
+  80092e:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800930:	a8 04                	test   $0x4,%al
+  800932:	74 2b                	je     80095f <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800934:	41 89 c1             	mov    %eax,%r9d
+  800937:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80093d:	4c 89 f1             	mov    %r14,%rcx
+  800940:	ba 00 00 00 00       	mov    $0x0,%edx
+  800945:	48 89 de             	mov    %rbx,%rsi
+  800948:	bf 00 00 00 00       	mov    $0x0,%edi
+  80094d:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  800954:	00 00 00 
+  800957:	ff d0                	call   *%rax
+  800959:	89 c3                	mov    %eax,%ebx
+  80095b:	85 c0                	test   %eax,%eax
+  80095d:	78 4e                	js     8009ad <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80095f:	4c 89 ff             	mov    %r15,%rdi
+  800962:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  800969:	00 00 00 
+  80096c:	ff d0                	call   *%rax
+  80096e:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800971:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800977:	4c 89 e9             	mov    %r13,%rcx
+  80097a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80097f:	4c 89 fe             	mov    %r15,%rsi
+  800982:	bf 00 00 00 00       	mov    $0x0,%edi
+  800987:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  80098e:	00 00 00 
+  800991:	ff d0                	call   *%rax
+  800993:	89 c3                	mov    %eax,%ebx
+  800995:	85 c0                	test   %eax,%eax
+  800997:	78 14                	js     8009ad <dup+0xf7>
+
+    return newfdnum;
+  800999:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80099c:	89 d8                	mov    %ebx,%eax
+  80099e:	48 83 c4 18          	add    $0x18,%rsp
+  8009a2:	5b                   	pop    %rbx
+  8009a3:	41 5c                	pop    %r12
+  8009a5:	41 5d                	pop    %r13
+  8009a7:	41 5e                	pop    %r14
+  8009a9:	41 5f                	pop    %r15
+  8009ab:	5d                   	pop    %rbp
+  8009ac:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009ad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b2:	4c 89 ee             	mov    %r13,%rsi
+  8009b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ba:	49 bc db 02 80 00 00 	movabs $0x8002db,%r12
+  8009c1:	00 00 00 
+  8009c4:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009cc:	4c 89 f6             	mov    %r14,%rsi
+  8009cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d4:	41 ff d4             	call   *%r12
+    return res;
+  8009d7:	eb c3                	jmp    80099c <dup+0xe6>
+
+00000000008009d9 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009d9:	55                   	push   %rbp
+  8009da:	48 89 e5             	mov    %rsp,%rbp
+  8009dd:	41 56                	push   %r14
+  8009df:	41 55                	push   %r13
+  8009e1:	41 54                	push   %r12
+  8009e3:	53                   	push   %rbx
+  8009e4:	48 83 ec 10          	sub    $0x10,%rsp
+  8009e8:	89 fb                	mov    %edi,%ebx
+  8009ea:	49 89 f4             	mov    %rsi,%r12
+  8009ed:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009f0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009f4:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  8009fb:	00 00 00 
+  8009fe:	ff d0                	call   *%rax
+  800a00:	85 c0                	test   %eax,%eax
+  800a02:	78 4c                	js     800a50 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a04:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a08:	41 8b 3e             	mov    (%r14),%edi
+  800a0b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a0f:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800a16:	00 00 00 
+  800a19:	ff d0                	call   *%rax
+  800a1b:	85 c0                	test   %eax,%eax
+  800a1d:	78 35                	js     800a54 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a1f:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a23:	83 e0 03             	and    $0x3,%eax
+  800a26:	83 f8 01             	cmp    $0x1,%eax
+  800a29:	74 2d                	je     800a58 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a2b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a2f:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a33:	48 85 c0             	test   %rax,%rax
+  800a36:	74 56                	je     800a8e <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a38:	4c 89 ea             	mov    %r13,%rdx
+  800a3b:	4c 89 e6             	mov    %r12,%rsi
+  800a3e:	4c 89 f7             	mov    %r14,%rdi
+  800a41:	ff d0                	call   *%rax
+}
+  800a43:	48 83 c4 10          	add    $0x10,%rsp
+  800a47:	5b                   	pop    %rbx
+  800a48:	41 5c                	pop    %r12
+  800a4a:	41 5d                	pop    %r13
+  800a4c:	41 5e                	pop    %r14
+  800a4e:	5d                   	pop    %rbp
+  800a4f:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a50:	48 98                	cltq
+  800a52:	eb ef                	jmp    800a43 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a54:	48 98                	cltq
+  800a56:	eb eb                	jmp    800a43 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a58:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a5f:	00 00 00 
+  800a62:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a68:	89 da                	mov    %ebx,%edx
+  800a6a:	48 bf 09 47 80 00 00 	movabs $0x804709,%rdi
+  800a71:	00 00 00 
+  800a74:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a79:	48 b9 a3 34 80 00 00 	movabs $0x8034a3,%rcx
+  800a80:	00 00 00 
+  800a83:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a85:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a8c:	eb b5                	jmp    800a43 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a8e:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a95:	eb ac                	jmp    800a43 <read+0x6a>
+
+0000000000800a97 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800a97:	55                   	push   %rbp
+  800a98:	48 89 e5             	mov    %rsp,%rbp
+  800a9b:	41 57                	push   %r15
+  800a9d:	41 56                	push   %r14
+  800a9f:	41 55                	push   %r13
+  800aa1:	41 54                	push   %r12
+  800aa3:	53                   	push   %rbx
+  800aa4:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800aa8:	48 85 d2             	test   %rdx,%rdx
+  800aab:	74 54                	je     800b01 <readn+0x6a>
+  800aad:	41 89 fd             	mov    %edi,%r13d
+  800ab0:	49 89 f6             	mov    %rsi,%r14
+  800ab3:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ab6:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800abb:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ac0:	49 bf d9 09 80 00 00 	movabs $0x8009d9,%r15
+  800ac7:	00 00 00 
+  800aca:	4c 89 e2             	mov    %r12,%rdx
+  800acd:	48 29 f2             	sub    %rsi,%rdx
+  800ad0:	4c 01 f6             	add    %r14,%rsi
+  800ad3:	44 89 ef             	mov    %r13d,%edi
+  800ad6:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ad9:	85 c0                	test   %eax,%eax
+  800adb:	78 20                	js     800afd <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800add:	01 c3                	add    %eax,%ebx
+  800adf:	85 c0                	test   %eax,%eax
+  800ae1:	74 08                	je     800aeb <readn+0x54>
+  800ae3:	48 63 f3             	movslq %ebx,%rsi
+  800ae6:	4c 39 e6             	cmp    %r12,%rsi
+  800ae9:	72 df                	jb     800aca <readn+0x33>
+    }
+    return res;
+  800aeb:	48 63 c3             	movslq %ebx,%rax
+}
+  800aee:	48 83 c4 08          	add    $0x8,%rsp
+  800af2:	5b                   	pop    %rbx
+  800af3:	41 5c                	pop    %r12
+  800af5:	41 5d                	pop    %r13
+  800af7:	41 5e                	pop    %r14
+  800af9:	41 5f                	pop    %r15
+  800afb:	5d                   	pop    %rbp
+  800afc:	c3                   	ret
+        if (inc < 0) return inc;
+  800afd:	48 98                	cltq
+  800aff:	eb ed                	jmp    800aee <readn+0x57>
+    int inc = 1, res = 0;
+  800b01:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b06:	eb e3                	jmp    800aeb <readn+0x54>
+
+0000000000800b08 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b08:	55                   	push   %rbp
+  800b09:	48 89 e5             	mov    %rsp,%rbp
+  800b0c:	41 56                	push   %r14
+  800b0e:	41 55                	push   %r13
+  800b10:	41 54                	push   %r12
+  800b12:	53                   	push   %rbx
+  800b13:	48 83 ec 10          	sub    $0x10,%rsp
+  800b17:	89 fb                	mov    %edi,%ebx
+  800b19:	49 89 f4             	mov    %rsi,%r12
+  800b1c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b1f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b23:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  800b2a:	00 00 00 
+  800b2d:	ff d0                	call   *%rax
+  800b2f:	85 c0                	test   %eax,%eax
+  800b31:	78 47                	js     800b7a <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b33:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b37:	41 8b 3e             	mov    (%r14),%edi
+  800b3a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b3e:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800b45:	00 00 00 
+  800b48:	ff d0                	call   *%rax
+  800b4a:	85 c0                	test   %eax,%eax
+  800b4c:	78 30                	js     800b7e <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b4e:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b53:	74 2d                	je     800b82 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b55:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b59:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b5d:	48 85 c0             	test   %rax,%rax
+  800b60:	74 56                	je     800bb8 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b62:	4c 89 ea             	mov    %r13,%rdx
+  800b65:	4c 89 e6             	mov    %r12,%rsi
+  800b68:	4c 89 f7             	mov    %r14,%rdi
+  800b6b:	ff d0                	call   *%rax
+}
+  800b6d:	48 83 c4 10          	add    $0x10,%rsp
+  800b71:	5b                   	pop    %rbx
+  800b72:	41 5c                	pop    %r12
+  800b74:	41 5d                	pop    %r13
+  800b76:	41 5e                	pop    %r14
+  800b78:	5d                   	pop    %rbp
+  800b79:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b7a:	48 98                	cltq
+  800b7c:	eb ef                	jmp    800b6d <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b7e:	48 98                	cltq
+  800b80:	eb eb                	jmp    800b6d <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b82:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800b89:	00 00 00 
+  800b8c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b92:	89 da                	mov    %ebx,%edx
+  800b94:	48 bf 25 47 80 00 00 	movabs $0x804725,%rdi
+  800b9b:	00 00 00 
+  800b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba3:	48 b9 a3 34 80 00 00 	movabs $0x8034a3,%rcx
+  800baa:	00 00 00 
+  800bad:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800baf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bb6:	eb b5                	jmp    800b6d <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bb8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bbf:	eb ac                	jmp    800b6d <write+0x65>
+
+0000000000800bc1 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bc1:	55                   	push   %rbp
+  800bc2:	48 89 e5             	mov    %rsp,%rbp
+  800bc5:	41 54                	push   %r12
+  800bc7:	53                   	push   %rbx
+  800bc8:	48 83 ec 10          	sub    $0x10,%rsp
+  800bcc:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bce:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd2:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  800bd9:	00 00 00 
+  800bdc:	ff d0                	call   *%rax
+  800bde:	85 c0                	test   %eax,%eax
+  800be0:	78 3e                	js     800c20 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be2:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800be6:	41 8b 3c 24          	mov    (%r12),%edi
+  800bea:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bee:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800bf5:	00 00 00 
+  800bf8:	ff d0                	call   *%rax
+  800bfa:	85 c0                	test   %eax,%eax
+  800bfc:	78 22                	js     800c20 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800bfe:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c02:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c06:	48 85 c0             	test   %rax,%rax
+  800c09:	74 0b                	je     800c16 <seek+0x55>
+  800c0b:	89 de                	mov    %ebx,%esi
+  800c0d:	4c 89 e7             	mov    %r12,%rdi
+  800c10:	ff d0                	call   *%rax
+  800c12:	85 c0                	test   %eax,%eax
+  800c14:	78 0a                	js     800c20 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c16:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c1b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c20:	48 83 c4 10          	add    $0x10,%rsp
+  800c24:	5b                   	pop    %rbx
+  800c25:	41 5c                	pop    %r12
+  800c27:	5d                   	pop    %rbp
+  800c28:	c3                   	ret
+
+0000000000800c29 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c29:	55                   	push   %rbp
+  800c2a:	48 89 e5             	mov    %rsp,%rbp
+  800c2d:	41 55                	push   %r13
+  800c2f:	41 54                	push   %r12
+  800c31:	53                   	push   %rbx
+  800c32:	48 83 ec 18          	sub    $0x18,%rsp
+  800c36:	89 fb                	mov    %edi,%ebx
+  800c38:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c3b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c3f:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  800c46:	00 00 00 
+  800c49:	ff d0                	call   *%rax
+  800c4b:	85 c0                	test   %eax,%eax
+  800c4d:	78 38                	js     800c87 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c4f:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c53:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c57:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c5b:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800c62:	00 00 00 
+  800c65:	ff d0                	call   *%rax
+  800c67:	85 c0                	test   %eax,%eax
+  800c69:	78 1c                	js     800c87 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c6b:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c70:	74 20                	je     800c92 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c72:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c76:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c7a:	48 85 c0             	test   %rax,%rax
+  800c7d:	74 47                	je     800cc6 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c7f:	44 89 e6             	mov    %r12d,%esi
+  800c82:	4c 89 ef             	mov    %r13,%rdi
+  800c85:	ff d0                	call   *%rax
+}
+  800c87:	48 83 c4 18          	add    $0x18,%rsp
+  800c8b:	5b                   	pop    %rbx
+  800c8c:	41 5c                	pop    %r12
+  800c8e:	41 5d                	pop    %r13
+  800c90:	5d                   	pop    %rbp
+  800c91:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800c92:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800c99:	00 00 00 
+  800c9c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ca2:	89 da                	mov    %ebx,%edx
+  800ca4:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  800cab:	00 00 00 
+  800cae:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb3:	48 b9 a3 34 80 00 00 	movabs $0x8034a3,%rcx
+  800cba:	00 00 00 
+  800cbd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cbf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc4:	eb c1                	jmp    800c87 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cc6:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ccb:	eb ba                	jmp    800c87 <ftruncate+0x5e>
+
+0000000000800ccd <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800ccd:	55                   	push   %rbp
+  800cce:	48 89 e5             	mov    %rsp,%rbp
+  800cd1:	41 54                	push   %r12
+  800cd3:	53                   	push   %rbx
+  800cd4:	48 83 ec 10          	sub    $0x10,%rsp
+  800cd8:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cdb:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cdf:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  800ce6:	00 00 00 
+  800ce9:	ff d0                	call   *%rax
+  800ceb:	85 c0                	test   %eax,%eax
+  800ced:	78 4e                	js     800d3d <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cef:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800cf3:	41 8b 3c 24          	mov    (%r12),%edi
+  800cf7:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800cfb:	48 b8 41 07 80 00 00 	movabs $0x800741,%rax
+  800d02:	00 00 00 
+  800d05:	ff d0                	call   *%rax
+  800d07:	85 c0                	test   %eax,%eax
+  800d09:	78 32                	js     800d3d <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d0b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d0f:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d14:	74 30                	je     800d46 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d16:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d19:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d20:	00 00 00 
+    stat->st_isdir = 0;
+  800d23:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d2a:	00 00 00 
+    stat->st_dev = dev;
+  800d2d:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d34:	48 89 de             	mov    %rbx,%rsi
+  800d37:	4c 89 e7             	mov    %r12,%rdi
+  800d3a:	ff 50 28             	call   *0x28(%rax)
+}
+  800d3d:	48 83 c4 10          	add    $0x10,%rsp
+  800d41:	5b                   	pop    %rbx
+  800d42:	41 5c                	pop    %r12
+  800d44:	5d                   	pop    %rbp
+  800d45:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d46:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d4b:	eb f0                	jmp    800d3d <fstat+0x70>
+
+0000000000800d4d <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d4d:	55                   	push   %rbp
+  800d4e:	48 89 e5             	mov    %rsp,%rbp
+  800d51:	41 54                	push   %r12
+  800d53:	53                   	push   %rbx
+  800d54:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d57:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5c:	48 b8 bb 1e 80 00 00 	movabs $0x801ebb,%rax
+  800d63:	00 00 00 
+  800d66:	ff d0                	call   *%rax
+  800d68:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d6a:	85 c0                	test   %eax,%eax
+  800d6c:	78 25                	js     800d93 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d6e:	4c 89 e6             	mov    %r12,%rsi
+  800d71:	89 c7                	mov    %eax,%edi
+  800d73:	48 b8 cd 0c 80 00 00 	movabs $0x800ccd,%rax
+  800d7a:	00 00 00 
+  800d7d:	ff d0                	call   *%rax
+  800d7f:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d82:	89 df                	mov    %ebx,%edi
+  800d84:	48 b8 5b 08 80 00 00 	movabs $0x80085b,%rax
+  800d8b:	00 00 00 
+  800d8e:	ff d0                	call   *%rax
+
+    return res;
+  800d90:	44 89 e3             	mov    %r12d,%ebx
+}
+  800d93:	89 d8                	mov    %ebx,%eax
+  800d95:	5b                   	pop    %rbx
+  800d96:	41 5c                	pop    %r12
+  800d98:	5d                   	pop    %rbp
+  800d99:	c3                   	ret
+
+0000000000800d9a <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800d9a:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800da1:	00 00 00 
+  800da4:	83 38 00             	cmpl   $0x0,(%rax)
+  800da7:	74 0a                	je     800db3 <fsenv+0x19>
+    return envid;
+}
+  800da9:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800db0:	00 00 
+  800db2:	c3                   	ret
+fsenv(void) {
+  800db3:	55                   	push   %rbp
+  800db4:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800db7:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dbc:	48 b8 24 46 80 00 00 	movabs $0x804624,%rax
+  800dc3:	00 00 00 
+  800dc6:	ff d0                	call   *%rax
+  800dc8:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dcf:	00 00 
+}
+  800dd1:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dd8:	00 00 
+  800dda:	5d                   	pop    %rbp
+  800ddb:	c3                   	ret
+
+0000000000800ddc <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800ddc:	55                   	push   %rbp
+  800ddd:	48 89 e5             	mov    %rsp,%rbp
+  800de0:	41 54                	push   %r12
+  800de2:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800de3:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800de8:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800ded:	48 89 de             	mov    %rbx,%rsi
+  800df0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800df5:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  800dfc:	00 00 00 
+  800dff:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e01:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e08:	00 00 00 
+  800e0b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e11:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e16:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e1b:	48 89 de             	mov    %rbx,%rsi
+  800e1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e23:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  800e2a:	00 00 00 
+  800e2d:	ff d0                	call   *%rax
+  800e2f:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e31:	85 c0                	test   %eax,%eax
+  800e33:	0f 88 a2 00 00 00    	js     800edb <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e39:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e40:	00 00 00 
+  800e43:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e49:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e4e:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e50:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e55:	49 bc ed 2f 80 00 00 	movabs $0x802fed,%r12
+  800e5c:	00 00 00 
+  800e5f:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e62:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e67:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e6a:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+  800e76:	89 c7                	mov    %eax,%edi
+  800e78:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e7e:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e83:	48 89 da             	mov    %rbx,%rdx
+  800e86:	be 09 00 00 00       	mov    $0x9,%esi
+  800e8b:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  800e92:	00 00 00 
+  800e95:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800e97:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea1:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eab:	48 b8 aa 45 80 00 00 	movabs $0x8045aa,%rax
+  800eb2:	00 00 00 
+  800eb5:	ff d0                	call   *%rax
+  800eb7:	89 c3                	mov    %eax,%ebx
+  800eb9:	85 c0                	test   %eax,%eax
+  800ebb:	78 25                	js     800ee2 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ebd:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ec4:	00 00 00 
+  800ec7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ecd:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ed4:	00 00 
+    return 0;
+  800ed6:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800edb:	89 d8                	mov    %ebx,%eax
+  800edd:	5b                   	pop    %rbx
+  800ede:	41 5c                	pop    %r12
+  800ee0:	5d                   	pop    %rbp
+  800ee1:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800ee2:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800ee7:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800eec:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef1:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  800ef8:	00 00 00 
+  800efb:	ff d0                	call   *%rax
+        return res;
+  800efd:	eb dc                	jmp    800edb <fschan_setup+0xff>
+
+0000000000800eff <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800eff:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f06:	00 00 00 
+  800f09:	80 38 00             	cmpb   $0x0,(%rax)
+  800f0c:	74 55                	je     800f63 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f0e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f15:	00 00 00 
+  800f18:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f1e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f23:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f2a:	00 00 00 
+  800f2d:	3b 0a                	cmp    (%rdx),%ecx
+  800f2f:	75 01                	jne    800f32 <fschan+0x33>
+}
+  800f31:	c3                   	ret
+fschan(void) {
+  800f32:	55                   	push   %rbp
+  800f33:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f36:	48 b8 dc 0d 80 00 00 	movabs $0x800ddc,%rax
+  800f3d:	00 00 00 
+  800f40:	ff d0                	call   *%rax
+  800f42:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f44:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f49:	85 d2                	test   %edx,%edx
+  800f4b:	78 02                	js     800f4f <fschan+0x50>
+}
+  800f4d:	5d                   	pop    %rbp
+  800f4e:	c3                   	ret
+        fschan_enabled = 0;
+  800f4f:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f56:	00 00 00 
+  800f59:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f61:	eb ea                	jmp    800f4d <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f63:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f68:	c3                   	ret
+
+0000000000800f69 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f69:	55                   	push   %rbp
+  800f6a:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f6d:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  800f74:	00 00 00 
+  800f77:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f79:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f82:	77 12                	ja     800f96 <fbuf+0x2d>
+  800f84:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800f88:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800f8f:	00 00 00 
+  800f92:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800f96:	48 89 d0             	mov    %rdx,%rax
+  800f99:	5d                   	pop    %rbp
+  800f9a:	c3                   	ret
+
+0000000000800f9b <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800f9b:	55                   	push   %rbp
+  800f9c:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800f9f:	48 83 c7 40          	add    $0x40,%rdi
+  800fa3:	48 b8 27 30 80 00 00 	movabs $0x803027,%rax
+  800faa:	00 00 00 
+  800fad:	ff d0                	call   *%rax
+  800faf:	84 c0                	test   %al,%al
+  800fb1:	75 02                	jne    800fb5 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fb3:	5d                   	pop    %rbp
+  800fb4:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fb5:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  800fbc:	00 00 00 
+  800fbf:	ff d0                	call   *%rax
+  800fc1:	89 c7                	mov    %eax,%edi
+  800fc3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fce:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd3:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fd8:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  800fdf:	00 00 00 
+  800fe2:	ff d0                	call   *%rax
+}
+  800fe4:	eb cd                	jmp    800fb3 <fschan_publish+0x18>
+
+0000000000800fe6 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  800fe6:	55                   	push   %rbp
+  800fe7:	48 89 e5             	mov    %rsp,%rbp
+  800fea:	41 57                	push   %r15
+  800fec:	41 56                	push   %r14
+  800fee:	41 55                	push   %r13
+  800ff0:	41 54                	push   %r12
+  800ff2:	53                   	push   %rbx
+  800ff3:	48 83 ec 48          	sub    $0x48,%rsp
+  800ff7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800ffb:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  800fff:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801002:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801006:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801009:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801010:	00 00 00 
+  801013:	8b 02                	mov    (%rdx),%eax
+  801015:	83 c0 01             	add    $0x1,%eax
+  801018:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80101d:	0f 44 c1             	cmove  %ecx,%eax
+  801020:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801022:	4d 85 c0             	test   %r8,%r8
+  801025:	74 2c                	je     801053 <fschan_rw+0x6d>
+  801027:	45 89 ce             	mov    %r9d,%r14d
+  80102a:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801031:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801035:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80103b:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801042:	00 
+  801043:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801049:	b8 01 00 00 00       	mov    $0x1,%eax
+  80104e:	e9 41 01 00 00       	jmp    801194 <fschan_rw+0x1ae>
+  801053:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801057:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80105b:	e9 9c 01 00 00       	jmp    8011fc <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801060:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801064:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801067:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80106a:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80106d:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801071:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801075:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801079:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80107d:	48 89 da             	mov    %rbx,%rdx
+  801080:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  801087:	00 00 00 
+  80108a:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80108c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801090:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  801097:	00 00 00 
+  80109a:	ff d0                	call   *%rax
+            queued += blk;
+  80109c:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80109f:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010a3:	4d 39 fc             	cmp    %r15,%r12
+  8010a6:	73 6b                	jae    801113 <fschan_rw+0x12d>
+  8010a8:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010ac:	77 65                	ja     801113 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010ae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010b2:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010b6:	48 b8 02 30 80 00 00 	movabs $0x803002,%rax
+  8010bd:	00 00 00 
+  8010c0:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010c2:	4c 89 fb             	mov    %r15,%rbx
+  8010c5:	4c 29 e3             	sub    %r12,%rbx
+  8010c8:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010cd:	48 39 d3             	cmp    %rdx,%rbx
+  8010d0:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010d4:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010d8:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010dc:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010e0:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010e3:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010e5:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8010ec:	00 00 00 
+  8010ef:	8b 09                	mov    (%rcx),%ecx
+  8010f1:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8010f4:	83 fe 03             	cmp    $0x3,%esi
+  8010f7:	0f 85 63 ff ff ff    	jne    801060 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8010fd:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801101:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801104:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801107:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80110a:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80110e:	e9 79 ff ff ff       	jmp    80108c <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801113:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801117:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80111e:	48 89 df             	mov    %rbx,%rdi
+  801121:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  801128:	00 00 00 
+  80112b:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80112d:	48 89 df             	mov    %rbx,%rdi
+  801130:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  801137:	00 00 00 
+  80113a:	ff d0                	call   *%rax
+  80113c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801140:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801144:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801148:	75 25                	jne    80116f <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80114a:	8b 40 04             	mov    0x4(%rax),%eax
+  80114d:	85 c0                	test   %eax,%eax
+  80114f:	0f 88 86 00 00 00    	js     8011db <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801155:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801159:	74 5b                	je     8011b6 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80115b:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80115f:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801163:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801167:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80116b:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80116f:	48 89 df             	mov    %rbx,%rdi
+  801172:	48 b8 7a 30 80 00 00 	movabs $0x80307a,%rax
+  801179:	00 00 00 
+  80117c:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80117e:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801182:	83 f0 01             	xor    $0x1,%eax
+  801185:	4d 39 fc             	cmp    %r15,%r12
+  801188:	0f 92 c2             	setb   %dl
+  80118b:	84 c2                	test   %al,%dl
+  80118d:	75 05                	jne    801194 <fschan_rw+0x1ae>
+  80118f:	45 85 ed             	test   %r13d,%r13d
+  801192:	74 50                	je     8011e4 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801194:	4d 39 fc             	cmp    %r15,%r12
+  801197:	0f 92 c1             	setb   %cl
+  80119a:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80119e:	0f 96 c2             	setbe  %dl
+  8011a1:	84 d1                	test   %dl,%cl
+  8011a3:	0f 84 6a ff ff ff    	je     801113 <fschan_rw+0x12d>
+  8011a9:	84 c0                	test   %al,%al
+  8011ab:	0f 85 fd fe ff ff    	jne    8010ae <fschan_rw+0xc8>
+  8011b1:	e9 5d ff ff ff       	jmp    801113 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011b6:	48 63 d0             	movslq %eax,%rdx
+  8011b9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011bd:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011c5:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011c9:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011cd:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  8011d4:	00 00 00 
+  8011d7:	ff d0                	call   *%rax
+  8011d9:	eb 80                	jmp    80115b <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011db:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011de:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011e2:	eb 8b                	jmp    80116f <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011e4:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8011e9:	0f 85 68 fe ff ff    	jne    801057 <fschan_rw+0x71>
+  8011ef:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8011f2:	85 c0                	test   %eax,%eax
+  8011f4:	0f 84 5d fe ff ff    	je     801057 <fschan_rw+0x71>
+  8011fa:	48 98                	cltq
+}
+  8011fc:	48 83 c4 48          	add    $0x48,%rsp
+  801200:	5b                   	pop    %rbx
+  801201:	41 5c                	pop    %r12
+  801203:	41 5d                	pop    %r13
+  801205:	41 5e                	pop    %r14
+  801207:	41 5f                	pop    %r15
+  801209:	5d                   	pop    %rbp
+  80120a:	c3                   	ret
+
+000000000080120b <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80120b:	55                   	push   %rbp
+  80120c:	48 89 e5             	mov    %rsp,%rbp
+  80120f:	41 56                	push   %r14
+  801211:	41 55                	push   %r13
+  801213:	41 54                	push   %r12
+  801215:	53                   	push   %rbx
+  801216:	48 83 ec 10          	sub    $0x10,%rsp
+  80121a:	49 89 fe             	mov    %rdi,%r14
+  80121d:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801220:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801224:	48 29 f3             	sub    %rsi,%rbx
+  801227:	48 39 d3             	cmp    %rdx,%rbx
+  80122a:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80122e:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801235:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801236:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80123b:	49 bd 84 2e 80 00 00 	movabs $0x802e84,%r13
+  801242:	00 00 00 
+  801245:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80124c:	76 1e                	jbe    80126c <mmap_fault+0x61>
+  80124e:	4c 01 e7             	add    %r12,%rdi
+  801251:	41 ff d5             	call   *%r13
+  801254:	84 c0                	test   %al,%al
+  801256:	75 14                	jne    80126c <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801258:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80125c:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801263:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801267:	48 39 df             	cmp    %rbx,%rdi
+  80126a:	72 e2                	jb     80124e <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80126c:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801273:	00 00 00 
+  801276:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80127d:	00 00 00 
+  801280:	4c 89 f0             	mov    %r14,%rax
+  801283:	48 29 d0             	sub    %rdx,%rax
+  801286:	48 c1 f8 03          	sar    $0x3,%rax
+  80128a:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801291:	aa aa aa 
+  801294:	48 0f af c2          	imul   %rdx,%rax
+  801298:	48 c1 e0 0c          	shl    $0xc,%rax
+  80129c:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012a1:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012a5:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012a7:	44 89 e0             	mov    %r12d,%eax
+  8012aa:	41 03 46 10          	add    0x10(%r14),%eax
+  8012ae:	41 2b 06             	sub    (%r14),%eax
+  8012b1:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012b4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012b8:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012bc:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012c0:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012c3:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  8012ca:	00 00 00 
+  8012cd:	ff d0                	call   *%rax
+  8012cf:	89 c7                	mov    %eax,%edi
+  8012d1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012d7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012dc:	48 89 da             	mov    %rbx,%rdx
+  8012df:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012e4:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  8012eb:	00 00 00 
+  8012ee:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8012f0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f5:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012f9:	4c 89 e6             	mov    %r12,%rsi
+  8012fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801301:	48 b8 aa 45 80 00 00 	movabs $0x8045aa,%rax
+  801308:	00 00 00 
+  80130b:	ff d0                	call   *%rax
+  80130d:	48 98                	cltq
+}
+  80130f:	48 83 c4 10          	add    $0x10,%rsp
+  801313:	5b                   	pop    %rbx
+  801314:	41 5c                	pop    %r12
+  801316:	41 5d                	pop    %r13
+  801318:	41 5e                	pop    %r14
+  80131a:	5d                   	pop    %rbp
+  80131b:	c3                   	ret
+
+000000000080131c <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80131c:	48 8b 37             	mov    (%rdi),%rsi
+  80131f:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801326:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80132d:	00 00 00 
+  801330:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801335:	eb 0f                	jmp    801346 <mmap_pgfault+0x2a>
+  801337:	c3                   	ret
+  801338:	48 83 c1 01          	add    $0x1,%rcx
+  80133c:	48 83 c2 18          	add    $0x18,%rdx
+  801340:	48 83 f9 20          	cmp    $0x20,%rcx
+  801344:	74 6e                	je     8013b4 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801346:	48 8b 02             	mov    (%rdx),%rax
+  801349:	48 83 e8 01          	sub    $0x1,%rax
+  80134d:	48 39 f0             	cmp    %rsi,%rax
+  801350:	73 e6                	jae    801338 <mmap_pgfault+0x1c>
+  801352:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801356:	73 e0                	jae    801338 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801358:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80135c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801361:	f6 c2 01             	test   $0x1,%dl
+  801364:	75 d1                	jne    801337 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801366:	f6 c2 02             	test   $0x2,%dl
+  801369:	74 1a                	je     801385 <mmap_pgfault+0x69>
+  80136b:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80136f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801374:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80137b:	00 00 00 
+  80137e:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  801383:	74 35                	je     8013ba <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801389:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80138d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801394:	00 00 00 
+  801397:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80139b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013a0:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8013a7:	00 00 00 
+  8013aa:	ff d0                	call   *%rax
+  8013ac:	48 85 c0             	test   %rax,%rax
+  8013af:	0f 9f c0             	setg   %al
+}
+  8013b2:	5d                   	pop    %rbp
+  8013b3:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b9:	c3                   	ret
+}
+  8013ba:	c3                   	ret
+
+00000000008013bb <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013bb:	55                   	push   %rbp
+  8013bc:	48 89 e5             	mov    %rsp,%rbp
+  8013bf:	41 54                	push   %r12
+  8013c1:	53                   	push   %rbx
+  8013c2:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013c5:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013cc:	00 00 00 
+  8013cf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013d4:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013d8:	74 15                	je     8013ef <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013da:	48 83 c3 01          	add    $0x1,%rbx
+  8013de:	48 83 c0 18          	add    $0x18,%rax
+  8013e2:	48 83 fb 20          	cmp    $0x20,%rbx
+  8013e6:	75 ec                	jne    8013d4 <mmap_alloc+0x19>
+    return NULL;
+  8013e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ed:	eb 52                	jmp    801441 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8013ef:	4c 89 e7             	mov    %r12,%rdi
+  8013f2:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  8013f9:	00 00 00 
+  8013fc:	ff d0                	call   *%rax
+  8013fe:	41 89 c1             	mov    %eax,%r9d
+  801401:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801408:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80140c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801412:	ba 00 00 00 00       	mov    $0x0,%edx
+  801417:	4c 89 e6             	mov    %r12,%rsi
+  80141a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80141f:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  801426:	00 00 00 
+  801429:	ff d0                	call   *%rax
+  80142b:	85 c0                	test   %eax,%eax
+  80142d:	78 17                	js     801446 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80142f:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801433:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80143a:	00 00 00 
+  80143d:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801441:	5b                   	pop    %rbx
+  801442:	41 5c                	pop    %r12
+  801444:	5d                   	pop    %rbp
+  801445:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801446:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144b:	eb f4                	jmp    801441 <mmap_alloc+0x86>
+
+000000000080144d <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80144d:	55                   	push   %rbp
+  80144e:	48 89 e5             	mov    %rsp,%rbp
+  801451:	41 56                	push   %r14
+  801453:	41 55                	push   %r13
+  801455:	41 54                	push   %r12
+  801457:	53                   	push   %rbx
+  801458:	48 83 ec 10          	sub    $0x10,%rsp
+  80145c:	41 89 fc             	mov    %edi,%r12d
+  80145f:	49 89 f5             	mov    %rsi,%r13
+  801462:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801465:	48 89 f0             	mov    %rsi,%rax
+  801468:	48 09 d0             	or     %rdx,%rax
+  80146b:	75 0d                	jne    80147a <fsipc+0x2d>
+  80146d:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801470:	83 f8 04             	cmp    $0x4,%eax
+  801473:	76 7d                	jbe    8014f2 <fsipc+0xa5>
+  801475:	83 ff 0d             	cmp    $0xd,%edi
+  801478:	74 78                	je     8014f2 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80147a:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  801481:	00 00 00 
+  801484:	ff d0                	call   *%rax
+  801486:	89 c7                	mov    %eax,%edi
+  801488:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80148f:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  801496:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80149d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014a3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014aa:	00 00 00 
+  8014ad:	44 89 e6             	mov    %r12d,%esi
+  8014b0:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  8014b7:	00 00 00 
+  8014ba:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014bc:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014c3:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014c9:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014cd:	4c 89 ee             	mov    %r13,%rsi
+  8014d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d5:	48 b8 aa 45 80 00 00 	movabs $0x8045aa,%rax
+  8014dc:	00 00 00 
+  8014df:	ff d0                	call   *%rax
+  8014e1:	89 c3                	mov    %eax,%ebx
+}
+  8014e3:	89 d8                	mov    %ebx,%eax
+  8014e5:	48 83 c4 10          	add    $0x10,%rsp
+  8014e9:	5b                   	pop    %rbx
+  8014ea:	41 5c                	pop    %r12
+  8014ec:	41 5d                	pop    %r13
+  8014ee:	41 5e                	pop    %r14
+  8014f0:	5d                   	pop    %rbp
+  8014f1:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014f2:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8014f9:	00 00 00 
+  8014fc:	ff d0                	call   *%rax
+  8014fe:	49 89 c6             	mov    %rax,%r14
+  801501:	48 85 c0             	test   %rax,%rax
+  801504:	0f 84 70 ff ff ff    	je     80147a <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80150a:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80150e:	48 b8 02 30 80 00 00 	movabs $0x803002,%rax
+  801515:	00 00 00 
+  801518:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80151a:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80151d:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801524:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801528:	ba 10 00 00 00       	mov    $0x10,%edx
+  80152d:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801534:	00 00 00 
+  801537:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  80153e:	00 00 00 
+  801541:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801543:	4c 89 f7             	mov    %r14,%rdi
+  801546:	48 b8 9b 0f 80 00 00 	movabs $0x800f9b,%rax
+  80154d:	00 00 00 
+  801550:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801552:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801559:	4c 89 f7             	mov    %r14,%rdi
+  80155c:	48 b8 c5 30 80 00 00 	movabs $0x8030c5,%rax
+  801563:	00 00 00 
+  801566:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801568:	4c 89 f7             	mov    %r14,%rdi
+  80156b:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  801572:	00 00 00 
+  801575:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801577:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80157a:	41 83 fc 05          	cmp    $0x5,%r12d
+  80157e:	75 04                	jne    801584 <fsipc+0x137>
+  801580:	85 db                	test   %ebx,%ebx
+  801582:	79 14                	jns    801598 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  801584:	4c 89 f7             	mov    %r14,%rdi
+  801587:	48 b8 7a 30 80 00 00 	movabs $0x80307a,%rax
+  80158e:	00 00 00 
+  801591:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  801593:	e9 4b ff ff ff       	jmp    8014e3 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  801598:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80159c:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015a1:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015a8:	00 00 00 
+  8015ab:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  8015b2:	00 00 00 
+  8015b5:	ff d0                	call   *%rax
+  8015b7:	eb cb                	jmp    801584 <fsipc+0x137>
+
+00000000008015b9 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015b9:	55                   	push   %rbp
+  8015ba:	48 89 e5             	mov    %rsp,%rbp
+  8015bd:	41 57                	push   %r15
+  8015bf:	41 56                	push   %r14
+  8015c1:	41 55                	push   %r13
+  8015c3:	41 54                	push   %r12
+  8015c5:	53                   	push   %rbx
+  8015c6:	48 83 ec 18          	sub    $0x18,%rsp
+  8015ca:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015ce:	49 89 f6             	mov    %rsi,%r14
+  8015d1:	49 89 d4             	mov    %rdx,%r12
+  8015d4:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015d7:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8015de:	00 00 00 
+  8015e1:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015e3:	48 85 c0             	test   %rax,%rax
+  8015e6:	0f 85 96 00 00 00    	jne    801682 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8015ec:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015f3:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015f4:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8015fb:	00 00 00 
+    while (n) {
+  8015fe:	4d 85 e4             	test   %r12,%r12
+  801601:	74 79                	je     80167c <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801603:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801608:	49 39 dc             	cmp    %rbx,%r12
+  80160b:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80160f:	48 89 da             	mov    %rbx,%rdx
+  801612:	4c 89 f6             	mov    %r14,%rsi
+  801615:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80161c:	00 00 00 
+  80161f:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  801626:	00 00 00 
+  801629:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80162b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80162f:	8b 40 0c             	mov    0xc(%rax),%eax
+  801632:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801635:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801638:	44 01 e8             	add    %r13d,%eax
+  80163b:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80163f:	41 0f 44 c5          	cmove  %r13d,%eax
+  801643:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801647:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80164b:	48 89 da             	mov    %rbx,%rdx
+  80164e:	be 00 00 00 00       	mov    $0x0,%esi
+  801653:	bf 04 00 00 00       	mov    $0x4,%edi
+  801658:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  80165f:	00 00 00 
+  801662:	ff d0                	call   *%rax
+        if (res < 0)
+  801664:	85 c0                	test   %eax,%eax
+  801666:	78 4a                	js     8016b2 <devfile_write_direct+0xf9>
+        buf += res;
+  801668:	48 98                	cltq
+  80166a:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80166d:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801671:	49 29 c4             	sub    %rax,%r12
+  801674:	75 8d                	jne    801603 <devfile_write_direct+0x4a>
+    return write;
+  801676:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80167a:	eb 27                	jmp    8016a3 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80167c:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  801680:	eb f4                	jmp    801676 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801682:	45 89 e9             	mov    %r13d,%r9d
+  801685:	4d 89 e0             	mov    %r12,%r8
+  801688:	4c 89 f1             	mov    %r14,%rcx
+  80168b:	ba 04 00 00 00       	mov    $0x4,%edx
+  801690:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801694:	48 89 c7             	mov    %rax,%rdi
+  801697:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  80169e:	00 00 00 
+  8016a1:	ff d0                	call   *%rax
+}
+  8016a3:	48 83 c4 18          	add    $0x18,%rsp
+  8016a7:	5b                   	pop    %rbx
+  8016a8:	41 5c                	pop    %r12
+  8016aa:	41 5d                	pop    %r13
+  8016ac:	41 5e                	pop    %r14
+  8016ae:	41 5f                	pop    %r15
+  8016b0:	5d                   	pop    %rbp
+  8016b1:	c3                   	ret
+            return res;
+  8016b2:	48 98                	cltq
+  8016b4:	eb ed                	jmp    8016a3 <devfile_write_direct+0xea>
+
+00000000008016b6 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016b6:	55                   	push   %rbp
+  8016b7:	48 89 e5             	mov    %rsp,%rbp
+  8016ba:	41 54                	push   %r12
+  8016bc:	53                   	push   %rbx
+  8016bd:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016c0:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  8016c7:	00 00 00 
+  8016ca:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016cc:	48 85 c0             	test   %rax,%rax
+  8016cf:	74 71                	je     801742 <fbuf_flush+0x8c>
+  8016d1:	48 89 c3             	mov    %rax,%rbx
+  8016d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d9:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016dd:	75 05                	jne    8016e4 <fbuf_flush+0x2e>
+}
+  8016df:	5b                   	pop    %rbx
+  8016e0:	41 5c                	pop    %r12
+  8016e2:	5d                   	pop    %rbp
+  8016e3:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016e4:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8016e7:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8016eb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8016f2:	00 00 00 
+  8016f5:	48 89 de             	mov    %rbx,%rsi
+  8016f8:	48 29 c6             	sub    %rax,%rsi
+  8016fb:	48 c1 fe 03          	sar    $0x3,%rsi
+  8016ff:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801706:	aa aa aa 
+  801709:	48 0f af f0          	imul   %rax,%rsi
+  80170d:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801711:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801716:	48 01 c6             	add    %rax,%rsi
+  801719:	4c 89 e7             	mov    %r12,%rdi
+  80171c:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801723:	00 00 00 
+  801726:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801728:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80172c:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801733:	00 
+    return res < 0 ? res : 0;
+  801734:	48 85 c0             	test   %rax,%rax
+  801737:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173c:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801740:	eb 9d                	jmp    8016df <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801742:	b8 00 00 00 00       	mov    $0x0,%eax
+  801747:	eb 96                	jmp    8016df <fbuf_flush+0x29>
+
+0000000000801749 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80174d:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  801754:	00 00 00 
+  801757:	ff d0                	call   *%rax
+}
+  801759:	5d                   	pop    %rbp
+  80175a:	c3                   	ret
+
+000000000080175b <devfile_write>:
+    if (!fd || !buf)
+  80175b:	48 85 ff             	test   %rdi,%rdi
+  80175e:	0f 84 d3 01 00 00    	je     801937 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801764:	55                   	push   %rbp
+  801765:	48 89 e5             	mov    %rsp,%rbp
+  801768:	41 57                	push   %r15
+  80176a:	41 56                	push   %r14
+  80176c:	41 55                	push   %r13
+  80176e:	41 54                	push   %r12
+  801770:	53                   	push   %rbx
+  801771:	48 83 ec 08          	sub    $0x8,%rsp
+  801775:	49 89 fc             	mov    %rdi,%r12
+  801778:	49 89 f6             	mov    %rsi,%r14
+  80177b:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80177e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801783:	48 85 f6             	test   %rsi,%rsi
+  801786:	0f 84 9c 01 00 00    	je     801928 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80178c:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  801793:	00 00 00 
+  801796:	ff d0                	call   *%rax
+  801798:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  80179b:	48 85 c0             	test   %rax,%rax
+  80179e:	0f 84 a2 00 00 00    	je     801846 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017a4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017a9:	4c 89 e7             	mov    %r12,%rdi
+  8017ac:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  8017b3:	00 00 00 
+  8017b6:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017b8:	83 f8 02             	cmp    $0x2,%eax
+  8017bb:	0f 8f 85 00 00 00    	jg     801846 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017c1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017c8:	00 00 00 
+  8017cb:	4d 89 ef             	mov    %r13,%r15
+  8017ce:	49 29 c7             	sub    %rax,%r15
+  8017d1:	49 c1 ff 03          	sar    $0x3,%r15
+  8017d5:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017dc:	aa aa aa 
+  8017df:	4c 0f af f8          	imul   %rax,%r15
+  8017e3:	49 c1 e7 0e          	shl    $0xe,%r15
+  8017e7:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8017ec:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8017ef:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8017f4:	0f 84 d7 00 00 00    	je     8018d1 <devfile_write+0x176>
+  8017fa:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8017fe:	89 c2                	mov    %eax,%edx
+  801800:	41 03 55 0c          	add    0xc(%r13),%edx
+  801804:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801809:	75 0f                	jne    80181a <devfile_write+0xbf>
+  80180b:	48 01 d8             	add    %rbx,%rax
+  80180e:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801814:	0f 86 92 00 00 00    	jbe    8018ac <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80181a:	4c 89 e7             	mov    %r12,%rdi
+  80181d:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  801824:	00 00 00 
+  801827:	ff d0                	call   *%rax
+  801829:	85 c0                	test   %eax,%eax
+  80182b:	78 52                	js     80187f <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80182d:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801834:	77 7f                	ja     8018b5 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801836:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80183b:	0f 85 c2 00 00 00    	jne    801903 <devfile_write+0x1a8>
+  801841:	e9 94 00 00 00       	jmp    8018da <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801846:	4c 89 e7             	mov    %r12,%rdi
+  801849:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  801850:	00 00 00 
+  801853:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801855:	85 c0                	test   %eax,%eax
+  801857:	79 07                	jns    801860 <devfile_write+0x105>
+  801859:	48 98                	cltq
+  80185b:	e9 c8 00 00 00       	jmp    801928 <devfile_write+0x1cd>
+  801860:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801865:	48 89 da             	mov    %rbx,%rdx
+  801868:	4c 89 f6             	mov    %r14,%rsi
+  80186b:	4c 89 e7             	mov    %r12,%rdi
+  80186e:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  801875:	00 00 00 
+  801878:	ff d0                	call   *%rax
+  80187a:	e9 a9 00 00 00       	jmp    801928 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80187f:	48 98                	cltq
+  801881:	e9 a2 00 00 00       	jmp    801928 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801886:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80188b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801890:	4c 89 fe             	mov    %r15,%rsi
+  801893:	bf 00 00 00 00       	mov    $0x0,%edi
+  801898:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  80189f:	00 00 00 
+  8018a2:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018a4:	85 c0                	test   %eax,%eax
+  8018a6:	79 45                	jns    8018ed <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018a8:	48 98                	cltq
+  8018aa:	eb 7c                	jmp    801928 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018ac:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018b3:	76 4e                	jbe    801903 <devfile_write+0x1a8>
+  8018b5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018ba:	48 89 da             	mov    %rbx,%rdx
+  8018bd:	4c 89 f6             	mov    %r14,%rsi
+  8018c0:	4c 89 e7             	mov    %r12,%rdi
+  8018c3:	48 b8 b9 15 80 00 00 	movabs $0x8015b9,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	eb 57                	jmp    801928 <devfile_write+0x1cd>
+  8018d1:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018d8:	77 db                	ja     8018b5 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018da:	4c 89 ff             	mov    %r15,%rdi
+  8018dd:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+  8018e9:	84 c0                	test   %al,%al
+  8018eb:	74 99                	je     801886 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8018ed:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8018f2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8018f7:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8018fb:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801902:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801903:	4c 89 ff             	mov    %r15,%rdi
+  801906:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80190a:	48 89 da             	mov    %rbx,%rdx
+  80190d:	4c 89 f6             	mov    %r14,%rsi
+  801910:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  801917:	00 00 00 
+  80191a:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80191c:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801920:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801925:	48 89 d8             	mov    %rbx,%rax
+}
+  801928:	48 83 c4 08          	add    $0x8,%rsp
+  80192c:	5b                   	pop    %rbx
+  80192d:	41 5c                	pop    %r12
+  80192f:	41 5d                	pop    %r13
+  801931:	41 5e                	pop    %r14
+  801933:	41 5f                	pop    %r15
+  801935:	5d                   	pop    %rbp
+  801936:	c3                   	ret
+        return E_INVAL;
+  801937:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80193c:	c3                   	ret
+
+000000000080193d <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80193d:	55                   	push   %rbp
+  80193e:	48 89 e5             	mov    %rsp,%rbp
+  801941:	41 54                	push   %r12
+  801943:	53                   	push   %rbx
+  801944:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801947:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+  801953:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801956:	48 89 df             	mov    %rbx,%rdi
+  801959:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  801960:	00 00 00 
+  801963:	ff d0                	call   *%rax
+  801965:	48 85 c0             	test   %rax,%rax
+  801968:	74 17                	je     801981 <devfile_flush+0x44>
+  80196a:	48 89 df             	mov    %rbx,%rdi
+  80196d:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  801974:	00 00 00 
+  801977:	ff d0                	call   *%rax
+  801979:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801980:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801981:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801984:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80198b:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80198d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801992:	be 00 00 00 00       	mov    $0x0,%esi
+  801997:	bf 06 00 00 00       	mov    $0x6,%edi
+  80199c:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  8019a3:	00 00 00 
+  8019a6:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019a8:	45 85 e4             	test   %r12d,%r12d
+  8019ab:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019af:	5b                   	pop    %rbx
+  8019b0:	41 5c                	pop    %r12
+  8019b2:	5d                   	pop    %rbp
+  8019b3:	c3                   	ret
+
+00000000008019b4 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019b4:	55                   	push   %rbp
+  8019b5:	48 89 e5             	mov    %rsp,%rbp
+  8019b8:	41 57                	push   %r15
+  8019ba:	41 56                	push   %r14
+  8019bc:	41 55                	push   %r13
+  8019be:	41 54                	push   %r12
+  8019c0:	53                   	push   %rbx
+  8019c1:	48 83 ec 38          	sub    $0x38,%rsp
+  8019c5:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019c9:	49 89 f7             	mov    %rsi,%r15
+  8019cc:	48 89 d3             	mov    %rdx,%rbx
+  8019cf:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019d2:	48 b8 ff 0e 80 00 00 	movabs $0x800eff,%rax
+  8019d9:	00 00 00 
+  8019dc:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019de:	48 85 c0             	test   %rax,%rax
+  8019e1:	75 20                	jne    801a03 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019e3:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8019e8:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8019ef:	00 
+    while (n) {
+  8019f0:	48 85 db             	test   %rbx,%rbx
+  8019f3:	0f 85 df 00 00 00    	jne    801ad8 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8019f9:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8019fd:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a01:	eb 21                	jmp    801a24 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a03:	45 89 f1             	mov    %r14d,%r9d
+  801a06:	49 89 d8             	mov    %rbx,%r8
+  801a09:	4c 89 f9             	mov    %r15,%rcx
+  801a0c:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a11:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a15:	48 89 c7             	mov    %rax,%rdi
+  801a18:	48 b8 e6 0f 80 00 00 	movabs $0x800fe6,%rax
+  801a1f:	00 00 00 
+  801a22:	ff d0                	call   *%rax
+}
+  801a24:	48 83 c4 38          	add    $0x38,%rsp
+  801a28:	5b                   	pop    %rbx
+  801a29:	41 5c                	pop    %r12
+  801a2b:	41 5d                	pop    %r13
+  801a2d:	41 5e                	pop    %r14
+  801a2f:	41 5f                	pop    %r15
+  801a31:	5d                   	pop    %rbp
+  801a32:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a33:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a37:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a3d:	75 1e                	jne    801a5d <devfile_read_direct+0xa9>
+  801a3f:	e9 e2 00 00 00       	jmp    801b26 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a44:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a48:	eb da                	jmp    801a24 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a4a:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a4e:	0f 85 d0 01 00 00    	jne    801c24 <devfile_read_direct+0x270>
+            map = 0;
+  801a54:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a58:	eb 03                	jmp    801a5d <devfile_read_direct+0xa9>
+  801a5a:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a5d:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a62:	48 39 d3             	cmp    %rdx,%rbx
+  801a65:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a69:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a6d:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a70:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a77:	00 00 00 
+  801a7a:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a7c:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a80:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a84:	be 00 00 00 00       	mov    $0x0,%esi
+  801a89:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a8e:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  801a95:	00 00 00 
+  801a98:	ff d0                	call   *%rax
+        if (res <= 0)
+  801a9a:	85 c0                	test   %eax,%eax
+  801a9c:	0f 8e 63 01 00 00    	jle    801c05 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801aa2:	4c 63 e0             	movslq %eax,%r12
+  801aa5:	4c 89 e2             	mov    %r12,%rdx
+  801aa8:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801aaf:	00 00 00 
+  801ab2:	4c 89 ff             	mov    %r15,%rdi
+  801ab5:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  801abc:	00 00 00 
+  801abf:	ff d0                	call   *%rax
+        buf += res;
+  801ac1:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ac4:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ac7:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801acb:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801acf:	48 85 db             	test   %rbx,%rbx
+  801ad2:	0f 84 25 ff ff ff    	je     8019fd <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801ad8:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801adb:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801adf:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801ae3:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801ae7:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801aee:	0f 97 c2             	seta   %dl
+  801af1:	20 c2                	and    %al,%dl
+  801af3:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801af6:	0f 84 5e ff ff ff    	je     801a5a <devfile_read_direct+0xa6>
+  801afc:	4c 89 fa             	mov    %r15,%rdx
+  801aff:	4d 89 fd             	mov    %r15,%r13
+  801b02:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b09:	0f 85 4e ff ff ff    	jne    801a5d <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b0f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b13:	0f 84 1a ff ff ff    	je     801a33 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b19:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b20:	0f 85 37 ff ff ff    	jne    801a5d <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b26:	48 89 d8             	mov    %rbx,%rax
+  801b29:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b2f:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b34:	48 39 c8             	cmp    %rcx,%rax
+  801b37:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b3b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b3f:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b43:	49 89 d4             	mov    %rdx,%r12
+  801b46:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b4a:	48 b8 25 2e 80 00 00 	movabs $0x802e25,%rax
+  801b51:	00 00 00 
+  801b54:	ff d0                	call   *%rax
+  801b56:	a8 40                	test   $0x40,%al
+  801b58:	0f 85 b9 00 00 00    	jne    801c17 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b5e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b65:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b69:	49 39 c5             	cmp    %rax,%r13
+  801b6c:	72 d8                	jb     801b46 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b6e:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b72:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b79:	00 00 00 
+  801b7c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b80:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b83:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b85:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801b89:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801b8d:	48 b8 9a 0d 80 00 00 	movabs $0x800d9a,%rax
+  801b94:	00 00 00 
+  801b97:	ff d0                	call   *%rax
+  801b99:	89 c7                	mov    %eax,%edi
+  801b9b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ba1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ba6:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bad:	00 00 00 
+  801bb0:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bb5:	48 b8 ce 45 80 00 00 	movabs $0x8045ce,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bc1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bc6:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bca:	4c 89 fe             	mov    %r15,%rsi
+  801bcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd2:	48 b8 aa 45 80 00 00 	movabs $0x8045aa,%rax
+  801bd9:	00 00 00 
+  801bdc:	ff d0                	call   *%rax
+  801bde:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801be1:	48 85 d2             	test   %rdx,%rdx
+  801be4:	0f 84 5a fe ff ff    	je     801a44 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801bea:	0f 8e 5a fe ff ff    	jle    801a4a <devfile_read_direct+0x96>
+                buf += res;
+  801bf0:	48 98                	cltq
+  801bf2:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801bf5:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801bf8:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801bfc:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c00:	e9 ca fe ff ff       	jmp    801acf <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c05:	41 89 c5             	mov    %eax,%r13d
+  801c08:	48 98                	cltq
+  801c0a:	45 85 ed             	test   %r13d,%r13d
+  801c0d:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c12:	e9 0d fe ff ff       	jmp    801a24 <devfile_read_direct+0x70>
+            map = 0;
+  801c17:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c1b:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c1f:	e9 39 fe ff ff       	jmp    801a5d <devfile_read_direct+0xa9>
+  801c24:	48 89 d0             	mov    %rdx,%rax
+  801c27:	e9 f8 fd ff ff       	jmp    801a24 <devfile_read_direct+0x70>
+
+0000000000801c2c <devfile_read>:
+    if (!fd || !buf)
+  801c2c:	48 85 ff             	test   %rdi,%rdi
+  801c2f:	0f 84 21 02 00 00    	je     801e56 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c35:	55                   	push   %rbp
+  801c36:	48 89 e5             	mov    %rsp,%rbp
+  801c39:	41 57                	push   %r15
+  801c3b:	41 56                	push   %r14
+  801c3d:	41 55                	push   %r13
+  801c3f:	41 54                	push   %r12
+  801c41:	53                   	push   %rbx
+  801c42:	48 83 ec 28          	sub    $0x28,%rsp
+  801c46:	48 89 fb             	mov    %rdi,%rbx
+  801c49:	49 89 f4             	mov    %rsi,%r12
+  801c4c:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c4f:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c54:	48 85 f6             	test   %rsi,%rsi
+  801c57:	74 4b                	je     801ca4 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c59:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  801c60:	00 00 00 
+  801c63:	ff d0                	call   *%rax
+  801c65:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c68:	48 85 c0             	test   %rax,%rax
+  801c6b:	74 22                	je     801c8f <devfile_read+0x63>
+  801c6d:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c74:	77 19                	ja     801c8f <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c76:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c7b:	48 89 df             	mov    %rbx,%rdi
+  801c7e:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  801c85:	00 00 00 
+  801c88:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c8a:	83 f8 02             	cmp    $0x2,%eax
+  801c8d:	7e 40                	jle    801ccf <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801c8f:	48 89 df             	mov    %rbx,%rdi
+  801c92:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  801c99:	00 00 00 
+  801c9c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801c9e:	85 c0                	test   %eax,%eax
+  801ca0:	79 11                	jns    801cb3 <devfile_read+0x87>
+  801ca2:	48 98                	cltq
+}
+  801ca4:	48 83 c4 28          	add    $0x28,%rsp
+  801ca8:	5b                   	pop    %rbx
+  801ca9:	41 5c                	pop    %r12
+  801cab:	41 5d                	pop    %r13
+  801cad:	41 5e                	pop    %r14
+  801caf:	41 5f                	pop    %r15
+  801cb1:	5d                   	pop    %rbp
+  801cb2:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cb3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cb8:	4c 89 ea             	mov    %r13,%rdx
+  801cbb:	4c 89 e6             	mov    %r12,%rsi
+  801cbe:	48 89 df             	mov    %rbx,%rdi
+  801cc1:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+  801ccd:	eb d5                	jmp    801ca4 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801ccf:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cd3:	48 89 df             	mov    %rbx,%rdi
+  801cd6:	48 b8 b6 16 80 00 00 	movabs $0x8016b6,%rax
+  801cdd:	00 00 00 
+  801ce0:	ff d0                	call   *%rax
+  801ce2:	85 c0                	test   %eax,%eax
+  801ce4:	0f 88 33 01 00 00    	js     801e1d <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801cea:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801cf1:	00 00 00 
+  801cf4:	4c 89 f0             	mov    %r14,%rax
+  801cf7:	48 29 d0             	sub    %rdx,%rax
+  801cfa:	48 c1 f8 03          	sar    $0x3,%rax
+  801cfe:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d05:	aa aa aa 
+  801d08:	48 0f af c2          	imul   %rdx,%rax
+  801d0c:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d10:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d14:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d17:	41 39 06             	cmp    %eax,(%r14)
+  801d1a:	75 0d                	jne    801d29 <devfile_read+0xfd>
+  801d1c:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d1f:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d23:	0f 84 fb 00 00 00    	je     801e24 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d29:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d2e:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d32:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d39:	48 89 c7             	mov    %rax,%rdi
+  801d3c:	48 b8 84 2e 80 00 00 	movabs $0x802e84,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	84 c0                	test   %al,%al
+  801d4a:	75 27                	jne    801d73 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d4c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d51:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d56:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d5f:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  801d66:	00 00 00 
+  801d69:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d6b:	85 c0                	test   %eax,%eax
+  801d6d:	0f 88 dc 00 00 00    	js     801e4f <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d73:	44 89 f8             	mov    %r15d,%eax
+  801d76:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d7b:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d7d:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d84:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d85:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d88:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801d8c:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801d8f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d94:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d98:	48 89 df             	mov    %rbx,%rdi
+  801d9b:	48 b8 b4 19 80 00 00 	movabs $0x8019b4,%rax
+  801da2:	00 00 00 
+  801da5:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801da7:	48 85 c0             	test   %rax,%rax
+  801daa:	0f 88 f4 fe ff ff    	js     801ca4 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801db0:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801db3:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801db6:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801db9:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dbd:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dc1:	48 63 d1             	movslq %ecx,%rdx
+  801dc4:	48 01 d0             	add    %rdx,%rax
+  801dc7:	4d 63 ff             	movslq %r15d,%r15
+  801dca:	4c 29 f8             	sub    %r15,%rax
+  801dcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd2:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801dd6:	48 85 c0             	test   %rax,%rax
+  801dd9:	0f 8e c5 fe ff ff    	jle    801ca4 <devfile_read+0x78>
+    n = MIN(n, res);
+  801ddf:	4c 39 e8             	cmp    %r13,%rax
+  801de2:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801de6:	8b 73 04             	mov    0x4(%rbx),%esi
+  801de9:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801ded:	48 63 f6             	movslq %esi,%rsi
+  801df0:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801df5:	48 01 c6             	add    %rax,%rsi
+  801df8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dfc:	48 01 c6             	add    %rax,%rsi
+  801dff:	4c 89 ea             	mov    %r13,%rdx
+  801e02:	4c 89 e7             	mov    %r12,%rdi
+  801e05:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  801e0c:	00 00 00 
+  801e0f:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e11:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e15:	4c 89 e8             	mov    %r13,%rax
+  801e18:	e9 87 fe ff ff       	jmp    801ca4 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e1d:	48 98                	cltq
+  801e1f:	e9 80 fe ff ff       	jmp    801ca4 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e24:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e28:	41 39 d7             	cmp    %edx,%r15d
+  801e2b:	0f 8c f8 fe ff ff    	jl     801d29 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e31:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e35:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e38:	41 39 cf             	cmp    %ecx,%r15d
+  801e3b:	0f 8d e8 fe ff ff    	jge    801d29 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e41:	4d 63 ff             	movslq %r15d,%r15
+  801e44:	4c 29 f8             	sub    %r15,%rax
+  801e47:	48 63 d2             	movslq %edx,%rdx
+  801e4a:	48 01 d0             	add    %rdx,%rax
+  801e4d:	eb 87                	jmp    801dd6 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e4f:	48 98                	cltq
+  801e51:	e9 4e fe ff ff       	jmp    801ca4 <devfile_read+0x78>
+        return E_INVAL;
+  801e56:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e5b:	c3                   	ret
+
+0000000000801e5c <fs_channel>:
+fs_channel(bool enable) {
+  801e5c:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e5e:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e65:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e67:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6c:	40 84 ff             	test   %dil,%dil
+  801e6f:	74 47                	je     801eb8 <fs_channel+0x5c>
+  801e71:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e78:	00 00 00 
+  801e7b:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e81:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e88:	00 00 00 
+  801e8b:	3b 08                	cmp    (%rax),%ecx
+  801e8d:	74 29                	je     801eb8 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801e8f:	55                   	push   %rbp
+  801e90:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801e93:	48 b8 dc 0d 80 00 00 	movabs $0x800ddc,%rax
+  801e9a:	00 00 00 
+  801e9d:	ff d0                	call   *%rax
+  801e9f:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ea1:	85 c0                	test   %eax,%eax
+  801ea3:	78 04                	js     801ea9 <fs_channel+0x4d>
+}
+  801ea5:	89 d0                	mov    %edx,%eax
+  801ea7:	5d                   	pop    %rbp
+  801ea8:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ea9:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eb0:	00 00 00 
+  801eb3:	c6 00 00             	movb   $0x0,(%rax)
+  801eb6:	eb ed                	jmp    801ea5 <fs_channel+0x49>
+}
+  801eb8:	89 d0                	mov    %edx,%eax
+  801eba:	c3                   	ret
+
+0000000000801ebb <open>:
+open(const char *path, int mode) {
+  801ebb:	55                   	push   %rbp
+  801ebc:	48 89 e5             	mov    %rsp,%rbp
+  801ebf:	41 55                	push   %r13
+  801ec1:	41 54                	push   %r12
+  801ec3:	53                   	push   %rbx
+  801ec4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec8:	49 89 fc             	mov    %rdi,%r12
+  801ecb:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ece:	48 b8 8a 3d 80 00 00 	movabs $0x803d8a,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+  801eda:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801ee0:	0f 87 8f 00 00 00    	ja     801f75 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ee6:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801eea:	48 b8 96 06 80 00 00 	movabs $0x800696,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+  801ef6:	89 c3                	mov    %eax,%ebx
+  801ef8:	85 c0                	test   %eax,%eax
+  801efa:	78 55                	js     801f51 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801efc:	4c 89 e6             	mov    %r12,%rsi
+  801eff:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f06:	00 00 00 
+  801f09:	48 89 df             	mov    %rbx,%rdi
+  801f0c:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f18:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f1f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f24:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f28:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f2d:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+  801f39:	89 c3                	mov    %eax,%ebx
+  801f3b:	85 c0                	test   %eax,%eax
+  801f3d:	78 1f                	js     801f5e <open+0xa3>
+    return fd2num(fd);
+  801f3f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f43:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+  801f4f:	89 c3                	mov    %eax,%ebx
+}
+  801f51:	89 d8                	mov    %ebx,%eax
+  801f53:	48 83 c4 18          	add    $0x18,%rsp
+  801f57:	5b                   	pop    %rbx
+  801f58:	41 5c                	pop    %r12
+  801f5a:	41 5d                	pop    %r13
+  801f5c:	5d                   	pop    %rbp
+  801f5d:	c3                   	ret
+        fd_close(fd, 0);
+  801f5e:	be 00 00 00 00       	mov    $0x0,%esi
+  801f63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f67:	48 b8 b1 07 80 00 00 	movabs $0x8007b1,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+        return res;
+  801f73:	eb dc                	jmp    801f51 <open+0x96>
+        return -E_BAD_PATH;
+  801f75:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f7a:	eb d5                	jmp    801f51 <open+0x96>
+
+0000000000801f7c <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f7c:	55                   	push   %rbp
+  801f7d:	48 89 e5             	mov    %rsp,%rbp
+  801f80:	41 56                	push   %r14
+  801f82:	41 55                	push   %r13
+  801f84:	41 54                	push   %r12
+  801f86:	53                   	push   %rbx
+  801f87:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801f8b:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801f92:	00 00 00 
+  801f95:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801f9a:	49 bd f6 06 80 00 00 	movabs $0x8006f6,%r13
+  801fa1:	00 00 00 
+  801fa4:	49 be b6 16 80 00 00 	movabs $0x8016b6,%r14
+  801fab:	00 00 00 
+  801fae:	eb 0c                	jmp    801fbc <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fb0:	83 c3 01             	add    $0x1,%ebx
+  801fb3:	49 83 c4 18          	add    $0x18,%r12
+  801fb7:	83 fb 20             	cmp    $0x20,%ebx
+  801fba:	74 1d                	je     801fd9 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fbc:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fc1:	74 ed                	je     801fb0 <file_flush_buffers+0x34>
+  801fc3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc7:	89 df                	mov    %ebx,%edi
+  801fc9:	41 ff d5             	call   *%r13
+  801fcc:	85 c0                	test   %eax,%eax
+  801fce:	78 e0                	js     801fb0 <file_flush_buffers+0x34>
+  801fd0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fd4:	41 ff d6             	call   *%r14
+  801fd7:	eb d7                	jmp    801fb0 <file_flush_buffers+0x34>
+}
+  801fd9:	48 83 c4 10          	add    $0x10,%rsp
+  801fdd:	5b                   	pop    %rbx
+  801fde:	41 5c                	pop    %r12
+  801fe0:	41 5d                	pop    %r13
+  801fe2:	41 5e                	pop    %r14
+  801fe4:	5d                   	pop    %rbp
+  801fe5:	c3                   	ret
+
+0000000000801fe6 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fe6:	55                   	push   %rbp
+  801fe7:	48 89 e5             	mov    %rsp,%rbp
+  801fea:	41 54                	push   %r12
+  801fec:	53                   	push   %rbx
+  801fed:	49 89 fc             	mov    %rdi,%r12
+  801ff0:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  801ff2:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  801ff9:	00 00 00 
+  801ffc:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801ffe:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802005:	00 00 00 
+  802008:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80200d:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80200f:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802012:	ba 00 00 00 00       	mov    $0x0,%edx
+  802017:	be 00 00 00 00       	mov    $0x0,%esi
+  80201c:	bf 02 00 00 00       	mov    $0x2,%edi
+  802021:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  802028:	00 00 00 
+  80202b:	ff d0                	call   *%rax
+}
+  80202d:	5b                   	pop    %rbx
+  80202e:	41 5c                	pop    %r12
+  802030:	5d                   	pop    %rbp
+  802031:	c3                   	ret
+
+0000000000802032 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802032:	55                   	push   %rbp
+  802033:	48 89 e5             	mov    %rsp,%rbp
+  802036:	41 54                	push   %r12
+  802038:	53                   	push   %rbx
+  802039:	49 89 fc             	mov    %rdi,%r12
+  80203c:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80203f:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  802046:	00 00 00 
+  802049:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80204b:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802050:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802057:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205e:	be 00 00 00 00       	mov    $0x0,%esi
+  802063:	bf 05 00 00 00       	mov    $0x5,%edi
+  802068:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 3d                	js     8020b5 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802078:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80207f:	00 00 00 
+  802082:	4c 89 e6             	mov    %r12,%rsi
+  802085:	48 89 df             	mov    %rbx,%rdi
+  802088:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802094:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80209b:	00 
+  80209c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020a2:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020a9:	00 
+  8020aa:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b5:	5b                   	pop    %rbx
+  8020b6:	41 5c                	pop    %r12
+  8020b8:	5d                   	pop    %rbp
+  8020b9:	c3                   	ret
+
+00000000008020ba <remove>:
+remove(const char *path) {
+  8020ba:	55                   	push   %rbp
+  8020bb:	48 89 e5             	mov    %rsp,%rbp
+  8020be:	53                   	push   %rbx
+  8020bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c3:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020c6:	48 b8 8a 3d 80 00 00 	movabs $0x803d8a,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+  8020d2:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020d8:	77 3a                	ja     802114 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020da:	48 89 de             	mov    %rbx,%rsi
+  8020dd:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020e4:	00 00 00 
+  8020e7:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8020f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fd:	bf 07 00 00 00       	mov    $0x7,%edi
+  802102:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  802109:	00 00 00 
+  80210c:	ff d0                	call   *%rax
+}
+  80210e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802112:	c9                   	leave
+  802113:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802114:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802119:	eb f3                	jmp    80210e <remove+0x54>
+
+000000000080211b <sync>:
+sync(void) {
+  80211b:	55                   	push   %rbp
+  80211c:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80211f:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  802126:	00 00 00 
+  802129:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80212b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802130:	be 00 00 00 00       	mov    $0x0,%esi
+  802135:	bf 08 00 00 00       	mov    $0x8,%edi
+  80213a:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+}
+  802146:	5d                   	pop    %rbp
+  802147:	c3                   	ret
+
+0000000000802148 <fsync>:
+fsync(int fdnum) {
+  802148:	55                   	push   %rbp
+  802149:	48 89 e5             	mov    %rsp,%rbp
+  80214c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802150:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802154:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802160:	85 c0                	test   %eax,%eax
+  802162:	78 4b                	js     8021af <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802164:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802168:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80216f:	00 00 00 
+  802172:	8b 00                	mov    (%rax),%eax
+  802174:	39 02                	cmp    %eax,(%rdx)
+  802176:	75 39                	jne    8021b1 <fsync+0x69>
+    file_flush_buffers();
+  802178:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  80217f:	00 00 00 
+  802182:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802184:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802188:	8b 40 0c             	mov    0xc(%rax),%eax
+  80218b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802192:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802194:	ba 00 00 00 00       	mov    $0x0,%edx
+  802199:	be 00 00 00 00       	mov    $0x0,%esi
+  80219e:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021a3:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  8021aa:	00 00 00 
+  8021ad:	ff d0                	call   *%rax
+}
+  8021af:	c9                   	leave
+  8021b0:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021b1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b6:	eb f7                	jmp    8021af <fsync+0x67>
+
+00000000008021b8 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021b8:	55                   	push   %rbp
+  8021b9:	48 89 e5             	mov    %rsp,%rbp
+  8021bc:	53                   	push   %rbx
+  8021bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c1:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c9:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ce:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021d3:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021df:	85 c0                	test   %eax,%eax
+  8021e1:	78 2d                	js     802210 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021e3:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8021ea:	00 00 00 
+  8021ed:	48 8b 10             	mov    (%rax),%rdx
+  8021f0:	48 89 13             	mov    %rdx,(%rbx)
+  8021f3:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8021f7:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8021fb:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8021ff:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802203:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802207:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80220b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802214:	c9                   	leave
+  802215:	c3                   	ret
+
+0000000000802216 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802216:	55                   	push   %rbp
+  802217:	48 89 e5             	mov    %rsp,%rbp
+  80221a:	53                   	push   %rbx
+  80221b:	48 83 ec 08          	sub    $0x8,%rsp
+  80221f:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802222:	ba 00 00 00 00       	mov    $0x0,%edx
+  802227:	be 00 00 00 00       	mov    $0x0,%esi
+  80222c:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802231:	48 b8 4d 14 80 00 00 	movabs $0x80144d,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80223d:	85 c0                	test   %eax,%eax
+  80223f:	78 3d                	js     80227e <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802241:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802248:	00 00 00 
+  80224b:	48 8b 10             	mov    (%rax),%rdx
+  80224e:	48 89 13             	mov    %rdx,(%rbx)
+  802251:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802255:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802259:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80225d:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802261:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802265:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802269:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80226d:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802271:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802275:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  802279:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80227e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802282:	c9                   	leave
+  802283:	c3                   	ret
+
+0000000000802284 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  802284:	55                   	push   %rbp
+  802285:	48 89 e5             	mov    %rsp,%rbp
+  802288:	41 57                	push   %r15
+  80228a:	41 56                	push   %r14
+  80228c:	41 55                	push   %r13
+  80228e:	41 54                	push   %r12
+  802290:	53                   	push   %rbx
+  802291:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  802295:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80229c:	00 
+  80229d:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022a4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022aa:	0f 85 43 01 00 00    	jne    8023f3 <munmap+0x16f>
+  8022b0:	49 89 ff             	mov    %rdi,%r15
+  8022b3:	4c 39 f7             	cmp    %r14,%rdi
+  8022b6:	0f 87 37 01 00 00    	ja     8023f3 <munmap+0x16f>
+  8022bc:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022c3:	00 00 00 
+  8022c6:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022cc:	eb 2c                	jmp    8022fa <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022ce:	4c 39 f8             	cmp    %r15,%rax
+  8022d1:	0f 83 85 00 00 00    	jae    80235c <munmap+0xd8>
+            m->mm_end = start;
+  8022d7:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022dc:	48 83 c3 18          	add    $0x18,%rbx
+  8022e0:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8022e7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8022ee:	00 00 00 
+  8022f1:	48 39 c3             	cmp    %rax,%rbx
+  8022f4:	0f 84 d0 00 00 00    	je     8023ca <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8022fa:	49 89 dc             	mov    %rbx,%r12
+  8022fd:	48 8b 03             	mov    (%rbx),%rax
+  802300:	4c 39 f0             	cmp    %r14,%rax
+  802303:	73 d7                	jae    8022dc <munmap+0x58>
+  802305:	48 85 c0             	test   %rax,%rax
+  802308:	74 d2                	je     8022dc <munmap+0x58>
+  80230a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80230e:	49 39 d7             	cmp    %rdx,%r15
+  802311:	73 c9                	jae    8022dc <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802313:	49 39 d6             	cmp    %rdx,%r14
+  802316:	73 b6                	jae    8022ce <munmap+0x4a>
+  802318:	49 39 c7             	cmp    %rax,%r15
+  80231b:	76 b1                	jbe    8022ce <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80231d:	4c 89 ef             	mov    %r13,%rdi
+  802320:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  802327:	00 00 00 
+  80232a:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80232c:	48 85 c0             	test   %rax,%rax
+  80232f:	0f 84 c5 00 00 00    	je     8023fa <munmap+0x176>
+            *tail = *m;
+  802335:	48 8b 13             	mov    (%rbx),%rdx
+  802338:	48 89 10             	mov    %rdx,(%rax)
+  80233b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80233f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802343:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802347:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80234b:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80234e:	44 89 f2             	mov    %r14d,%edx
+  802351:	2b 13                	sub    (%rbx),%edx
+  802353:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802356:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80235a:	eb 80                	jmp    8022dc <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80235c:	49 39 d6             	cmp    %rdx,%r14
+  80235f:	73 18                	jae    802379 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802361:	44 89 f2             	mov    %r14d,%edx
+  802364:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802369:	29 c2                	sub    %eax,%edx
+  80236b:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  802370:	4d 89 34 24          	mov    %r14,(%r12)
+  802374:	e9 63 ff ff ff       	jmp    8022dc <munmap+0x58>
+    m->mm_start = 0;
+  802379:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  802380:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  802381:	4c 89 e6             	mov    %r12,%rsi
+  802384:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80238b:	00 00 00 
+  80238e:	48 29 c6             	sub    %rax,%rsi
+  802391:	48 c1 fe 03          	sar    $0x3,%rsi
+  802395:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80239c:	aa aa aa 
+  80239f:	48 0f af f0          	imul   %rax,%rsi
+  8023a3:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023a7:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023ac:	48 01 c6             	add    %rax,%rsi
+  8023af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b9:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+}
+  8023c5:	e9 12 ff ff ff       	jmp    8022dc <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023ca:	4c 89 f2             	mov    %r14,%rdx
+  8023cd:	4c 29 fa             	sub    %r15,%rdx
+  8023d0:	4c 89 fe             	mov    %r15,%rsi
+  8023d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d8:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+}
+  8023e4:	48 83 c4 08          	add    $0x8,%rsp
+  8023e8:	5b                   	pop    %rbx
+  8023e9:	41 5c                	pop    %r12
+  8023eb:	41 5d                	pop    %r13
+  8023ed:	41 5e                	pop    %r14
+  8023ef:	41 5f                	pop    %r15
+  8023f1:	5d                   	pop    %rbp
+  8023f2:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8023f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f8:	eb ea                	jmp    8023e4 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8023fa:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8023ff:	eb e3                	jmp    8023e4 <munmap+0x160>
+
+0000000000802401 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802401:	55                   	push   %rbp
+  802402:	48 89 e5             	mov    %rsp,%rbp
+  802405:	41 57                	push   %r15
+  802407:	41 56                	push   %r14
+  802409:	41 55                	push   %r13
+  80240b:	41 54                	push   %r12
+  80240d:	53                   	push   %rbx
+  80240e:	48 83 ec 28          	sub    $0x28,%rsp
+  802412:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802416:	49 89 f5             	mov    %rsi,%r13
+  802419:	41 89 d6             	mov    %edx,%r14d
+  80241c:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80241f:	41 89 cc             	mov    %ecx,%r12d
+  802422:	44 89 c7             	mov    %r8d,%edi
+  802425:	44 89 cb             	mov    %r9d,%ebx
+  802428:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80242c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802430:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	41 89 c7             	mov    %eax,%r15d
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	0f 88 ae 01 00 00    	js     8025f5 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802447:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80244b:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802452:	00 00 00 
+  802455:	8b 32                	mov    (%rdx),%esi
+  802457:	39 30                	cmp    %esi,(%rax)
+  802459:	0f 85 7a 02 00 00    	jne    8026d9 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80245f:	8b 40 08             	mov    0x8(%rax),%eax
+  802462:	83 e0 03             	and    $0x3,%eax
+  802465:	83 f8 01             	cmp    $0x1,%eax
+  802468:	0f 84 76 02 00 00    	je     8026e4 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80246e:	4d 85 ed             	test   %r13,%r13
+  802471:	0f 84 78 02 00 00    	je     8026ef <mmap+0x2ee>
+  802477:	85 db                	test   %ebx,%ebx
+  802479:	0f 88 70 02 00 00    	js     8026ef <mmap+0x2ee>
+  80247f:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802485:	41 89 df             	mov    %ebx,%r15d
+  802488:	0f 85 6c 02 00 00    	jne    8026fa <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80248e:	44 89 f0             	mov    %r14d,%eax
+  802491:	83 e0 fd             	and    $0xfffffffd,%eax
+  802494:	83 f8 04             	cmp    $0x4,%eax
+  802497:	0f 85 68 02 00 00    	jne    802705 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80249d:	44 89 e1             	mov    %r12d,%ecx
+  8024a0:	83 e1 01             	and    $0x1,%ecx
+  8024a3:	0f 95 c2             	setne  %dl
+  8024a6:	44 89 e0             	mov    %r12d,%eax
+  8024a9:	d1 e8                	shr    %eax
+  8024ab:	83 f0 01             	xor    $0x1,%eax
+  8024ae:	83 e0 01             	and    $0x1,%eax
+  8024b1:	38 c2                	cmp    %al,%dl
+  8024b3:	0f 85 57 02 00 00    	jne    802710 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024b9:	85 c9                	test   %ecx,%ecx
+  8024bb:	74 0a                	je     8024c7 <mmap+0xc6>
+  8024bd:	41 f6 c6 02          	test   $0x2,%r14b
+  8024c1:	0f 85 54 02 00 00    	jne    80271b <mmap+0x31a>
+    file_flush_buffers();
+  8024c7:	48 b8 7c 1f 80 00 00 	movabs $0x801f7c,%rax
+  8024ce:	00 00 00 
+  8024d1:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024d3:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024da:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024e1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024e5:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8024e8:	41 f6 c4 04          	test   $0x4,%r12b
+  8024ec:	0f 84 15 01 00 00    	je     802607 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8024f2:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8024f5:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8024fb:	0f 85 25 02 00 00    	jne    802726 <mmap+0x325>
+  802501:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802505:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80250c:	00 00 00 
+  80250f:	48 39 c2             	cmp    %rax,%rdx
+  802512:	0f 82 19 02 00 00    	jb     802731 <mmap+0x330>
+  802518:	48 39 c7             	cmp    %rax,%rdi
+  80251b:	0f 87 10 02 00 00    	ja     802731 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802521:	4c 89 ee             	mov    %r13,%rsi
+  802524:	48 b8 84 22 80 00 00 	movabs $0x802284,%rax
+  80252b:	00 00 00 
+  80252e:	ff d0                	call   *%rax
+  802530:	85 c0                	test   %eax,%eax
+  802532:	0f 88 04 02 00 00    	js     80273c <mmap+0x33b>
+    if (!handler) {
+  802538:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80253f:	00 00 00 
+  802542:	80 38 00             	cmpb   $0x0,(%rax)
+  802545:	75 2b                	jne    802572 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802547:	48 bf 1c 13 80 00 00 	movabs $0x80131c,%rdi
+  80254e:	00 00 00 
+  802551:	48 b8 79 42 80 00 00 	movabs $0x804279,%rax
+  802558:	00 00 00 
+  80255b:	ff d0                	call   *%rax
+  80255d:	85 c0                	test   %eax,%eax
+  80255f:	0f 88 ea 01 00 00    	js     80274f <mmap+0x34e>
+        handler = 1;
+  802565:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80256c:	00 00 00 
+  80256f:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802572:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802576:	48 b8 bb 13 80 00 00 	movabs $0x8013bb,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  802585:	48 85 c0             	test   %rax,%rax
+  802588:	0f 84 c9 01 00 00    	je     802757 <mmap+0x356>
+    m->mm_start = va;
+  80258e:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  802591:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  802595:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  802599:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80259c:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025a0:	44 89 e0             	mov    %r12d,%eax
+  8025a3:	c1 e0 06             	shl    $0x6,%eax
+  8025a6:	25 80 00 00 00       	and    $0x80,%eax
+  8025ab:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025ae:	09 f0                	or     %esi,%eax
+  8025b0:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025b4:	41 f6 c4 08          	test   $0x8,%r12b
+  8025b8:	74 31                	je     8025eb <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025ba:	48 39 d3             	cmp    %rdx,%rbx
+  8025bd:	73 2c                	jae    8025eb <mmap+0x1ea>
+  8025bf:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025c4:	48 89 de             	mov    %rbx,%rsi
+  8025c7:	4c 89 f7             	mov    %r14,%rdi
+  8025ca:	48 b8 0b 12 80 00 00 	movabs $0x80120b,%rax
+  8025d1:	00 00 00 
+  8025d4:	ff d0                	call   *%rax
+  8025d6:	49 89 c4             	mov    %rax,%r12
+  8025d9:	48 85 c0             	test   %rax,%rax
+  8025dc:	0f 8e d7 00 00 00    	jle    8026b9 <mmap+0x2b8>
+            va += n;
+  8025e2:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025e5:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8025e9:	72 d4                	jb     8025bf <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8025eb:	49 8b 06             	mov    (%r14),%rax
+  8025ee:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8025f2:	48 89 06             	mov    %rax,(%rsi)
+}
+  8025f5:	44 89 f8             	mov    %r15d,%eax
+  8025f8:	48 83 c4 28          	add    $0x28,%rsp
+  8025fc:	5b                   	pop    %rbx
+  8025fd:	41 5c                	pop    %r12
+  8025ff:	41 5d                	pop    %r13
+  802601:	41 5e                	pop    %r14
+  802603:	41 5f                	pop    %r15
+  802605:	5d                   	pop    %rbp
+  802606:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802607:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80260e:	00 00 00 
+  802611:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802614:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80261b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80261e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802623:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80262a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80262d:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802634:	00 00 00 
+  802637:	48 39 d7             	cmp    %rdx,%rdi
+  80263a:	73 1c                	jae    802658 <mmap+0x257>
+        return -E_NO_MEM;
+  80263c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802642:	eb b1                	jmp    8025f5 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802644:	48 83 c0 01          	add    $0x1,%rax
+  802648:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80264c:	77 3f                	ja     80268d <mmap+0x28c>
+  80264e:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802653:	48 39 d7             	cmp    %rdx,%rdi
+  802656:	72 2a                	jb     802682 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802658:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80265c:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802660:	48 39 d1             	cmp    %rdx,%rcx
+  802663:	73 df                	jae    802644 <mmap+0x243>
+  802665:	48 85 c9             	test   %rcx,%rcx
+  802668:	74 da                	je     802644 <mmap+0x243>
+  80266a:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80266e:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802673:	48 39 d3             	cmp    %rdx,%rbx
+  802676:	73 cc                	jae    802644 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802678:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80267b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802680:	eb cc                	jmp    80264e <mmap+0x24d>
+        return -E_NO_MEM;
+  802682:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802688:	e9 68 ff ff ff       	jmp    8025f5 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80268d:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  802692:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  802699:	00 00 00 
+  80269c:	48 39 c2             	cmp    %rax,%rdx
+  80269f:	0f 82 9f 00 00 00    	jb     802744 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026a5:	48 85 db             	test   %rbx,%rbx
+  8026a8:	0f 85 8a fe ff ff    	jne    802538 <mmap+0x137>
+        return -E_NO_MEM;
+  8026ae:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026b4:	e9 3c ff ff ff       	jmp    8025f5 <mmap+0x1f4>
+        if (n < 0) {
+  8026b9:	0f 89 2c ff ff ff    	jns    8025eb <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026bf:	49 8b 3e             	mov    (%r14),%rdi
+  8026c2:	4c 89 ee             	mov    %r13,%rsi
+  8026c5:	48 b8 84 22 80 00 00 	movabs $0x802284,%rax
+  8026cc:	00 00 00 
+  8026cf:	ff d0                	call   *%rax
+            return n;
+  8026d1:	45 89 e7             	mov    %r12d,%r15d
+  8026d4:	e9 1c ff ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026d9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026df:	e9 11 ff ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026e4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026ea:	e9 06 ff ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8026ef:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026f5:	e9 fb fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+  8026fa:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802700:	e9 f0 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802705:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270b:	e9 e5 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802710:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802716:	e9 da fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80271b:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802721:	e9 cf fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802726:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80272c:	e9 c4 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+  802731:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802737:	e9 b9 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80273c:	41 89 c7             	mov    %eax,%r15d
+  80273f:	e9 b1 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802744:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80274a:	e9 a6 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80274f:	41 89 c7             	mov    %eax,%r15d
+  802752:	e9 9e fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802757:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80275d:	e9 93 fe ff ff       	jmp    8025f5 <mmap+0x1f4>
+
+0000000000802762 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802762:	55                   	push   %rbp
+  802763:	48 89 e5             	mov    %rsp,%rbp
+  802766:	41 54                	push   %r12
+  802768:	53                   	push   %rbx
+  802769:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80276c:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802773:	00 00 00 
+  802776:	ff d0                	call   *%rax
+  802778:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80277b:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  802782:	00 00 00 
+  802785:	48 89 df             	mov    %rbx,%rdi
+  802788:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  80278f:	00 00 00 
+  802792:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802794:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802799:	41 2b 04 24          	sub    (%r12),%eax
+  80279d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027a3:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027aa:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027ad:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027b4:	00 00 00 
+  8027b7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c3:	5b                   	pop    %rbx
+  8027c4:	41 5c                	pop    %r12
+  8027c6:	5d                   	pop    %rbp
+  8027c7:	c3                   	ret
+
+00000000008027c8 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027c8:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027cb:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027d1:	8b 17                	mov    (%rdi),%edx
+  8027d3:	85 d2                	test   %edx,%edx
+  8027d5:	75 01                	jne    8027d8 <pipe_wakeup+0x10>
+  8027d7:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027d8:	55                   	push   %rbp
+  8027d9:	48 89 e5             	mov    %rsp,%rbp
+  8027dc:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027df:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027e5:	be 00 04 00 00       	mov    $0x400,%esi
+  8027ea:	48 b8 c1 05 80 00 00 	movabs $0x8005c1,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+}
+  8027f6:	5d                   	pop    %rbp
+  8027f7:	c3                   	ret
+
+00000000008027f8 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	41 55                	push   %r13
+  8027fe:	41 54                	push   %r12
+  802800:	53                   	push   %rbx
+  802801:	48 83 ec 08          	sub    $0x8,%rsp
+  802805:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802808:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  80280f:	00 00 00 
+  802812:	ff d0                	call   *%rax
+  802814:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802817:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80281c:	4c 89 e6             	mov    %r12,%rsi
+  80281f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802824:	49 bc db 02 80 00 00 	movabs $0x8002db,%r12
+  80282b:	00 00 00 
+  80282e:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802831:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802835:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802839:	49 bd c8 27 80 00 00 	movabs $0x8027c8,%r13
+  802840:	00 00 00 
+  802843:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802846:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80284a:	48 89 de             	mov    %rbx,%rsi
+  80284d:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802850:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802855:	48 89 de             	mov    %rbx,%rsi
+  802858:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285d:	41 ff d4             	call   *%r12
+  802860:	48 83 c4 08          	add    $0x8,%rsp
+  802864:	5b                   	pop    %rbx
+  802865:	41 5c                	pop    %r12
+  802867:	41 5d                	pop    %r13
+  802869:	5d                   	pop    %rbp
+  80286a:	c3                   	ret
+
+000000000080286b <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80286b:	55                   	push   %rbp
+  80286c:	48 89 e5             	mov    %rsp,%rbp
+  80286f:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802872:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802877:	be 00 10 00 00       	mov    $0x1000,%esi
+  80287c:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  802883:	00 00 00 
+  802886:	ff d0                	call   *%rax
+  802888:	85 c0                	test   %eax,%eax
+  80288a:	0f 94 c0             	sete   %al
+  80288d:	0f b6 c0             	movzbl %al,%eax
+}
+  802890:	5d                   	pop    %rbp
+  802891:	c3                   	ret
+
+0000000000802892 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802892:	55                   	push   %rbp
+  802893:	48 89 e5             	mov    %rsp,%rbp
+  802896:	41 57                	push   %r15
+  802898:	41 56                	push   %r14
+  80289a:	41 55                	push   %r13
+  80289c:	41 54                	push   %r12
+  80289e:	53                   	push   %rbx
+  80289f:	48 83 ec 38          	sub    $0x38,%rsp
+  8028a3:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028a7:	49 89 f4             	mov    %rsi,%r12
+  8028aa:	49 89 d7             	mov    %rdx,%r15
+  8028ad:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b1:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  8028b8:	00 00 00 
+  8028bb:	ff d0                	call   *%rax
+  8028bd:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028c0:	4d 85 ff             	test   %r15,%r15
+  8028c3:	0f 84 f1 00 00 00    	je     8029ba <devpipe_write+0x128>
+  8028c9:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028cd:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028d1:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028d5:	49 bd 6b 28 80 00 00 	movabs $0x80286b,%r13
+  8028dc:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028df:	49 bf c8 27 80 00 00 	movabs $0x8027c8,%r15
+  8028e6:	00 00 00 
+  8028e9:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8028ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028f1:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8028f5:	8b 73 04             	mov    0x4(%rbx),%esi
+  8028f8:	48 63 ce             	movslq %esi,%rcx
+  8028fb:	48 63 03             	movslq (%rbx),%rax
+  8028fe:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802904:	48 39 c1             	cmp    %rax,%rcx
+  802907:	72 64                	jb     80296d <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802909:	48 89 de             	mov    %rbx,%rsi
+  80290c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802910:	41 ff d5             	call   *%r13
+  802913:	85 c0                	test   %eax,%eax
+  802915:	0f 85 b9 00 00 00    	jne    8029d4 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80291b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80291f:	4c 89 f7             	mov    %r14,%rdi
+  802922:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802925:	8b 43 04             	mov    0x4(%rbx),%eax
+  802928:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80292f:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802936:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80293c:	8b 03                	mov    (%rbx),%eax
+  80293e:	41 39 c4             	cmp    %eax,%r12d
+  802941:	75 b2                	jne    8028f5 <devpipe_write+0x63>
+  802943:	48 89 de             	mov    %rbx,%rsi
+  802946:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80294a:	41 ff d5             	call   *%r13
+  80294d:	85 c0                	test   %eax,%eax
+  80294f:	75 a0                	jne    8028f1 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802951:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802956:	44 89 e6             	mov    %r12d,%esi
+  802959:	48 89 df             	mov    %rbx,%rdi
+  80295c:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  802963:	00 00 00 
+  802966:	ff d0                	call   *%rax
+  802968:	e9 7c ff ff ff       	jmp    8028e9 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80296d:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802971:	41 0f b6 38          	movzbl (%r8),%edi
+  802975:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80297c:	80 80 80 
+  80297f:	48 89 c8             	mov    %rcx,%rax
+  802982:	48 f7 e2             	mul    %rdx
+  802985:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802989:	48 89 d0             	mov    %rdx,%rax
+  80298c:	48 c1 e0 08          	shl    $0x8,%rax
+  802990:	48 29 d0             	sub    %rdx,%rax
+  802993:	48 c1 e0 04          	shl    $0x4,%rax
+  802997:	48 29 c1             	sub    %rax,%rcx
+  80299a:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80299f:	83 c6 01             	add    $0x1,%esi
+  8029a2:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029a5:	49 83 c0 01          	add    $0x1,%r8
+  8029a9:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029ad:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029b1:	49 39 c0             	cmp    %rax,%r8
+  8029b4:	0f 85 2f ff ff ff    	jne    8028e9 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029ba:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029be:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029c2:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  8029c9:	00 00 00 
+  8029cc:	ff d0                	call   *%rax
+    return n;
+  8029ce:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029d2:	eb 05                	jmp    8029d9 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029d9:	48 83 c4 38          	add    $0x38,%rsp
+  8029dd:	5b                   	pop    %rbx
+  8029de:	41 5c                	pop    %r12
+  8029e0:	41 5d                	pop    %r13
+  8029e2:	41 5e                	pop    %r14
+  8029e4:	41 5f                	pop    %r15
+  8029e6:	5d                   	pop    %rbp
+  8029e7:	c3                   	ret
+
+00000000008029e8 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029e8:	55                   	push   %rbp
+  8029e9:	48 89 e5             	mov    %rsp,%rbp
+  8029ec:	41 57                	push   %r15
+  8029ee:	41 56                	push   %r14
+  8029f0:	41 55                	push   %r13
+  8029f2:	41 54                	push   %r12
+  8029f4:	53                   	push   %rbx
+  8029f5:	48 83 ec 28          	sub    $0x28,%rsp
+  8029f9:	49 89 fd             	mov    %rdi,%r13
+  8029fc:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a00:	49 89 d4             	mov    %rdx,%r12
+  802a03:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a07:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802a0e:	00 00 00 
+  802a11:	ff d0                	call   *%rax
+  802a13:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a16:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a1c:	49 bf 6b 28 80 00 00 	movabs $0x80286b,%r15
+  802a23:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a26:	4d 85 e4             	test   %r12,%r12
+  802a29:	0f 84 d5 00 00 00    	je     802b04 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a2f:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a37:	8b 03                	mov    (%rbx),%eax
+  802a39:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a3c:	75 7a                	jne    802ab8 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a3e:	4d 85 f6             	test   %r14,%r14
+  802a41:	75 50                	jne    802a93 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a43:	48 89 de             	mov    %rbx,%rsi
+  802a46:	4c 89 ef             	mov    %r13,%rdi
+  802a49:	41 ff d7             	call   *%r15
+  802a4c:	85 c0                	test   %eax,%eax
+  802a4e:	0f 85 c9 00 00 00    	jne    802b1d <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a54:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a57:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a5e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a64:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a67:	41 39 c4             	cmp    %eax,%r12d
+  802a6a:	75 cb                	jne    802a37 <devpipe_read+0x4f>
+  802a6c:	48 89 de             	mov    %rbx,%rsi
+  802a6f:	4c 89 ef             	mov    %r13,%rdi
+  802a72:	41 ff d7             	call   *%r15
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	75 be                	jne    802a37 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a79:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a7e:	44 89 e6             	mov    %r12d,%esi
+  802a81:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a85:	48 b8 a3 05 80 00 00 	movabs $0x8005a3,%rax
+  802a8c:	00 00 00 
+  802a8f:	ff d0                	call   *%rax
+  802a91:	eb a4                	jmp    802a37 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802a93:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802a97:	48 89 de             	mov    %rbx,%rsi
+  802a9a:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  802aa1:	00 00 00 
+  802aa4:	ff d0                	call   *%rax
+                return i;
+  802aa6:	4c 89 f0             	mov    %r14,%rax
+}
+  802aa9:	48 83 c4 28          	add    $0x28,%rsp
+  802aad:	5b                   	pop    %rbx
+  802aae:	41 5c                	pop    %r12
+  802ab0:	41 5d                	pop    %r13
+  802ab2:	41 5e                	pop    %r14
+  802ab4:	41 5f                	pop    %r15
+  802ab6:	5d                   	pop    %rbp
+  802ab7:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ab8:	48 63 c8             	movslq %eax,%rcx
+  802abb:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ac2:	80 80 80 
+  802ac5:	48 89 c8             	mov    %rcx,%rax
+  802ac8:	48 f7 e2             	mul    %rdx
+  802acb:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802acf:	48 89 d0             	mov    %rdx,%rax
+  802ad2:	48 c1 e0 08          	shl    $0x8,%rax
+  802ad6:	48 29 d0             	sub    %rdx,%rax
+  802ad9:	48 c1 e0 04          	shl    $0x4,%rax
+  802add:	48 89 c2             	mov    %rax,%rdx
+  802ae0:	48 89 c8             	mov    %rcx,%rax
+  802ae3:	48 29 d0             	sub    %rdx,%rax
+  802ae6:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802aeb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802aef:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802af3:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802af6:	49 83 c6 01          	add    $0x1,%r14
+  802afa:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802afe:	0f 85 2b ff ff ff    	jne    802a2f <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b04:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b08:	48 89 de             	mov    %rbx,%rsi
+  802b0b:	48 b8 c8 27 80 00 00 	movabs $0x8027c8,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+    return n;
+  802b17:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b1b:	eb 8c                	jmp    802aa9 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b22:	eb 85                	jmp    802aa9 <devpipe_read+0xc1>
+
+0000000000802b24 <pipe>:
+pipe(int pfd[2]) {
+  802b24:	55                   	push   %rbp
+  802b25:	48 89 e5             	mov    %rsp,%rbp
+  802b28:	41 55                	push   %r13
+  802b2a:	41 54                	push   %r12
+  802b2c:	53                   	push   %rbx
+  802b2d:	48 83 ec 18          	sub    $0x18,%rsp
+  802b31:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b34:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b38:	48 b8 96 06 80 00 00 	movabs $0x800696,%rax
+  802b3f:	00 00 00 
+  802b42:	ff d0                	call   *%rax
+  802b44:	89 c3                	mov    %eax,%ebx
+  802b46:	85 c0                	test   %eax,%eax
+  802b48:	0f 88 a0 01 00 00    	js     802cee <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b4e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b53:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b58:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b61:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+  802b6d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	0f 88 77 01 00 00    	js     802cee <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b77:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b7b:	48 b8 96 06 80 00 00 	movabs $0x800696,%rax
+  802b82:	00 00 00 
+  802b85:	ff d0                	call   *%rax
+  802b87:	89 c3                	mov    %eax,%ebx
+  802b89:	85 c0                	test   %eax,%eax
+  802b8b:	0f 88 43 01 00 00    	js     802cd4 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802b91:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b96:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802b9f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba4:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	0f 88 1a 01 00 00    	js     802cd4 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bba:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bbe:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+  802bca:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bcd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bd2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bd7:	48 89 c6             	mov    %rax,%rsi
+  802bda:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bdf:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  802be6:	00 00 00 
+  802be9:	ff d0                	call   *%rax
+  802beb:	89 c3                	mov    %eax,%ebx
+  802bed:	85 c0                	test   %eax,%eax
+  802bef:	0f 88 c5 00 00 00    	js     802cba <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802bf5:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802bf9:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+  802c05:	48 89 c1             	mov    %rax,%rcx
+  802c08:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c0e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c14:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c19:	4c 89 ee             	mov    %r13,%rsi
+  802c1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c21:	48 b8 8b 02 80 00 00 	movabs $0x80028b,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+  802c2d:	89 c3                	mov    %eax,%ebx
+  802c2f:	85 c0                	test   %eax,%eax
+  802c31:	78 6e                	js     802ca1 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c33:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c38:	4c 89 ef             	mov    %r13,%rdi
+  802c3b:	48 b8 fa 01 80 00 00 	movabs $0x8001fa,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+  802c47:	83 f8 02             	cmp    $0x2,%eax
+  802c4a:	0f 85 ab 00 00 00    	jne    802cfb <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c50:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c57:	00 00 
+  802c59:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c5d:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c5f:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c63:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c6a:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c6e:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c74:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c7b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c7f:	48 bb 68 06 80 00 00 	movabs $0x800668,%rbx
+  802c86:	00 00 00 
+  802c89:	ff d3                	call   *%rbx
+  802c8b:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802c8f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c93:	ff d3                	call   *%rbx
+  802c95:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802c9a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802c9f:	eb 4d                	jmp    802cee <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802ca1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ca6:	4c 89 ee             	mov    %r13,%rsi
+  802ca9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cae:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  802cb5:	00 00 00 
+  802cb8:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cbf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc8:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cd4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cd9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce2:	48 b8 db 02 80 00 00 	movabs $0x8002db,%rax
+  802ce9:	00 00 00 
+  802cec:	ff d0                	call   *%rax
+}
+  802cee:	89 d8                	mov    %ebx,%eax
+  802cf0:	48 83 c4 18          	add    $0x18,%rsp
+  802cf4:	5b                   	pop    %rbx
+  802cf5:	41 5c                	pop    %r12
+  802cf7:	41 5d                	pop    %r13
+  802cf9:	5d                   	pop    %rbp
+  802cfa:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802cfb:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d02:	00 00 00 
+  802d05:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d0c:	00 00 00 
+  802d0f:	be 50 00 00 00       	mov    $0x50,%esi
+  802d14:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d1b:	00 00 00 
+  802d1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d23:	49 b8 53 33 80 00 00 	movabs $0x803353,%r8
+  802d2a:	00 00 00 
+  802d2d:	41 ff d0             	call   *%r8
+
+0000000000802d30 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d30:	55                   	push   %rbp
+  802d31:	48 89 e5             	mov    %rsp,%rbp
+  802d34:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d38:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d3c:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  802d43:	00 00 00 
+  802d46:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d48:	85 c0                	test   %eax,%eax
+  802d4a:	78 23                	js     802d6f <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d4c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d50:	48 b8 7a 06 80 00 00 	movabs $0x80067a,%rax
+  802d57:	00 00 00 
+  802d5a:	ff d0                	call   *%rax
+  802d5c:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d5f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d63:	48 b8 6b 28 80 00 00 	movabs $0x80286b,%rax
+  802d6a:	00 00 00 
+  802d6d:	ff d0                	call   *%rax
+}
+  802d6f:	c9                   	leave
+  802d70:	c3                   	ret
+
+0000000000802d71 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d71:	48 89 f8             	mov    %rdi,%rax
+  802d74:	48 c1 e8 27          	shr    $0x27,%rax
+  802d78:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d7f:	01 00 00 
+  802d82:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d86:	f6 c2 01             	test   $0x1,%dl
+  802d89:	74 6d                	je     802df8 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d8b:	48 89 f8             	mov    %rdi,%rax
+  802d8e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d92:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d99:	01 00 00 
+  802d9c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da0:	f6 c2 01             	test   $0x1,%dl
+  802da3:	74 62                	je     802e07 <get_uvpt_entry+0x96>
+  802da5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dac:	01 00 00 
+  802daf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802db3:	f6 c2 80             	test   $0x80,%dl
+  802db6:	75 4f                	jne    802e07 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802db8:	48 89 f8             	mov    %rdi,%rax
+  802dbb:	48 c1 e8 15          	shr    $0x15,%rax
+  802dbf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dc6:	01 00 00 
+  802dc9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dcd:	f6 c2 01             	test   $0x1,%dl
+  802dd0:	74 44                	je     802e16 <get_uvpt_entry+0xa5>
+  802dd2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dd9:	01 00 00 
+  802ddc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802de0:	f6 c2 80             	test   $0x80,%dl
+  802de3:	75 31                	jne    802e16 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802de5:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802de9:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802df0:	01 00 00 
+  802df3:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802df7:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802df8:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802dff:	01 00 00 
+  802e02:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e06:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e07:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e0e:	01 00 00 
+  802e11:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e15:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e16:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e1d:	01 00 00 
+  802e20:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e24:	c3                   	ret
+
+0000000000802e25 <get_prot>:
+
+int
+get_prot(void *va) {
+  802e25:	55                   	push   %rbp
+  802e26:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e29:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802e30:	00 00 00 
+  802e33:	ff d0                	call   *%rax
+  802e35:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e38:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e3d:	89 c1                	mov    %eax,%ecx
+  802e3f:	83 c9 04             	or     $0x4,%ecx
+  802e42:	f6 c2 01             	test   $0x1,%dl
+  802e45:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e48:	89 c1                	mov    %eax,%ecx
+  802e4a:	83 c9 02             	or     $0x2,%ecx
+  802e4d:	f6 c2 02             	test   $0x2,%dl
+  802e50:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e53:	89 c1                	mov    %eax,%ecx
+  802e55:	83 c9 01             	or     $0x1,%ecx
+  802e58:	48 85 d2             	test   %rdx,%rdx
+  802e5b:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e5e:	89 c1                	mov    %eax,%ecx
+  802e60:	83 c9 40             	or     $0x40,%ecx
+  802e63:	f6 c6 04             	test   $0x4,%dh
+  802e66:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e69:	5d                   	pop    %rbp
+  802e6a:	c3                   	ret
+
+0000000000802e6b <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e6b:	55                   	push   %rbp
+  802e6c:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e6f:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802e76:	00 00 00 
+  802e79:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e7b:	48 c1 e8 06          	shr    $0x6,%rax
+  802e7f:	83 e0 01             	and    $0x1,%eax
+}
+  802e82:	5d                   	pop    %rbp
+  802e83:	c3                   	ret
+
+0000000000802e84 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802e88:	48 b8 71 2d 80 00 00 	movabs $0x802d71,%rax
+  802e8f:	00 00 00 
+  802e92:	ff d0                	call   *%rax
+  802e94:	83 e0 01             	and    $0x1,%eax
+}
+  802e97:	5d                   	pop    %rbp
+  802e98:	c3                   	ret
+
+0000000000802e99 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802e99:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ea0:	01 00 00 
+  802ea3:	a8 01                	test   $0x1,%al
+  802ea5:	75 06                	jne    802ead <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ea7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eac:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ead:	55                   	push   %rbp
+  802eae:	48 89 e5             	mov    %rsp,%rbp
+  802eb1:	41 57                	push   %r15
+  802eb3:	41 56                	push   %r14
+  802eb5:	41 55                	push   %r13
+  802eb7:	41 54                	push   %r12
+  802eb9:	53                   	push   %rbx
+  802eba:	48 83 ec 28          	sub    $0x28,%rsp
+  802ebe:	49 89 fe             	mov    %rdi,%r14
+  802ec1:	49 89 f7             	mov    %rsi,%r15
+  802ec4:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ecb:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ecc:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ed3:	01 00 00 
+  802ed6:	e9 ae 00 00 00       	jmp    802f89 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802edb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ee2:	49 83 ec 01          	sub    $0x1,%r12
+  802ee6:	74 2d                	je     802f15 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ee8:	48 89 d8             	mov    %rbx,%rax
+  802eeb:	48 c1 e8 0c          	shr    $0xc,%rax
+  802eef:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802ef4:	f6 c2 01             	test   $0x1,%dl
+  802ef7:	74 e2                	je     802edb <foreach_shared_region+0x42>
+  802ef9:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802efe:	f6 c4 04             	test   $0x4,%ah
+  802f01:	74 d8                	je     802edb <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f03:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f0a:	4c 89 fa             	mov    %r15,%rdx
+  802f0d:	48 89 df             	mov    %rbx,%rdi
+  802f10:	41 ff d6             	call   *%r14
+  802f13:	eb c6                	jmp    802edb <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f15:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f1c:	00 
+  802f1d:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f22:	74 4a                	je     802f6e <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f24:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f28:	48 c1 e8 15          	shr    $0x15,%rax
+  802f2c:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f33:	01 00 00 
+  802f36:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f3a:	a8 01                	test   $0x1,%al
+  802f3c:	74 d7                	je     802f15 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f3e:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f42:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f49:	48 39 c3             	cmp    %rax,%rbx
+  802f4c:	73 c7                	jae    802f15 <foreach_shared_region+0x7c>
+  802f4e:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f55:	48 39 d0             	cmp    %rdx,%rax
+  802f58:	4d 19 e4             	sbb    %r12,%r12
+  802f5b:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f62:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f69:	e9 7a ff ff ff       	jmp    802ee8 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f6e:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f75:	40 
+  802f76:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f7a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f81:	00 00 00 
+  802f84:	48 39 c1             	cmp    %rax,%rcx
+  802f87:	74 50                	je     802fd9 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802f89:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f8d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f91:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802f98:	01 00 00 
+  802f9b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f9f:	a8 01                	test   $0x1,%al
+  802fa1:	74 cb                	je     802f6e <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fa3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fa7:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fae:	48 39 c1             	cmp    %rax,%rcx
+  802fb1:	73 bb                	jae    802f6e <foreach_shared_region+0xd5>
+  802fb3:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fba:	48 39 d0             	cmp    %rdx,%rax
+  802fbd:	48 19 c0             	sbb    %rax,%rax
+  802fc0:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fc6:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fcc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fd0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fd4:	e9 4b ff ff ff       	jmp    802f24 <foreach_shared_region+0x8b>
+  802fd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fde:	48 83 c4 28          	add    $0x28,%rsp
+  802fe2:	5b                   	pop    %rbx
+  802fe3:	41 5c                	pop    %r12
+  802fe5:	41 5d                	pop    %r13
+  802fe7:	41 5e                	pop    %r14
+  802fe9:	41 5f                	pop    %r15
+  802feb:	5d                   	pop    %rbp
+  802fec:	c3                   	ret
+
+0000000000802fed <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  802fed:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  802ff3:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  802ffa:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803001:	c3                   	ret
+
+0000000000803002 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803002:	8b 47 40             	mov    0x40(%rdi),%eax
+  803005:	8b 17                	mov    (%rdi),%edx
+  803007:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803009:	83 f8 0f             	cmp    $0xf,%eax
+  80300c:	77 13                	ja     803021 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80300e:	8b 47 40             	mov    0x40(%rdi),%eax
+  803011:	83 e0 0f             	and    $0xf,%eax
+  803014:	48 c1 e0 09          	shl    $0x9,%rax
+  803018:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80301f:	00 
+  803020:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803026:	c3                   	ret
+
+0000000000803027 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803027:	8b 47 40             	mov    0x40(%rdi),%eax
+  80302a:	83 c0 01             	add    $0x1,%eax
+  80302d:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803030:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803036:	8b 57 04             	mov    0x4(%rdi),%edx
+  803039:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303e:	85 d2                	test   %edx,%edx
+  803040:	75 04                	jne    803046 <chan_publish+0x1f>
+  803042:	83 e0 01             	and    $0x1,%eax
+}
+  803045:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803046:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803049:	85 c0                	test   %eax,%eax
+  80304b:	0f 95 c0             	setne  %al
+  80304e:	0f b6 c0             	movzbl %al,%eax
+  803051:	eb ef                	jmp    803042 <chan_publish+0x1b>
+
+0000000000803053 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803053:	8b 47 40             	mov    0x40(%rdi),%eax
+  803056:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803058:	29 d0                	sub    %edx,%eax
+  80305a:	83 e8 01             	sub    $0x1,%eax
+  80305d:	83 f8 0f             	cmp    $0xf,%eax
+  803060:	77 12                	ja     803074 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803062:	8b 07                	mov    (%rdi),%eax
+  803064:	83 e0 0f             	and    $0xf,%eax
+  803067:	48 c1 e0 09          	shl    $0x9,%rax
+  80306b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803072:	00 
+  803073:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803074:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803079:	c3                   	ret
+
+000000000080307a <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80307a:	8b 07                	mov    (%rdi),%eax
+  80307c:	83 c0 01             	add    $0x1,%eax
+  80307f:	89 07                	mov    %eax,(%rdi)
+}
+  803081:	c3                   	ret
+
+0000000000803082 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803082:	55                   	push   %rbp
+  803083:	48 89 e5             	mov    %rsp,%rbp
+  803086:	53                   	push   %rbx
+  803087:	48 83 ec 08          	sub    $0x8,%rsp
+  80308b:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80308e:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803095:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80309b:	48 b8 53 30 80 00 00 	movabs $0x803053,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	48 85 c0             	test   %rax,%rax
+  8030aa:	74 12                	je     8030be <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030ac:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030b3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030bc:	c9                   	leave
+  8030bd:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c3:	eb f3                	jmp    8030b8 <chan_arm+0x36>
+
+00000000008030c5 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030c5:	55                   	push   %rbp
+  8030c6:	48 89 e5             	mov    %rsp,%rbp
+  8030c9:	41 56                	push   %r14
+  8030cb:	41 55                	push   %r13
+  8030cd:	41 54                	push   %r12
+  8030cf:	53                   	push   %rbx
+  8030d0:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030d3:	49 bc 82 30 80 00 00 	movabs $0x803082,%r12
+  8030da:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030dd:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030e1:	49 bd a3 05 80 00 00 	movabs $0x8005a3,%r13
+  8030e8:	00 00 00 
+    while (chan_arm(r))
+  8030eb:	eb 0d                	jmp    8030fa <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030ed:	8b 33                	mov    (%rbx),%esi
+  8030ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f4:	4c 89 f7             	mov    %r14,%rdi
+  8030f7:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8030fa:	48 89 df             	mov    %rbx,%rdi
+  8030fd:	41 ff d4             	call   *%r12
+  803100:	84 c0                	test   %al,%al
+  803102:	75 e9                	jne    8030ed <chan_wait+0x28>
+}
+  803104:	5b                   	pop    %rbx
+  803105:	41 5c                	pop    %r12
+  803107:	41 5d                	pop    %r13
+  803109:	41 5e                	pop    %r14
+  80310b:	5d                   	pop    %rbp
+  80310c:	c3                   	ret
+
+000000000080310d <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80310d:	55                   	push   %rbp
+  80310e:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803111:	48 83 c7 40          	add    $0x40,%rdi
+  803115:	be 01 00 00 00       	mov    $0x1,%esi
+  80311a:	48 b8 c1 05 80 00 00 	movabs $0x8005c1,%rax
+  803121:	00 00 00 
+  803124:	ff d0                	call   *%rax
+}
+  803126:	5d                   	pop    %rbp
+  803127:	c3                   	ret
+
+0000000000803128 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803128:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312d:	c3                   	ret
+
+000000000080312e <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80312e:	55                   	push   %rbp
+  80312f:	48 89 e5             	mov    %rsp,%rbp
+  803132:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803135:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  80313c:	00 00 00 
+  80313f:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+    return 0;
+}
+  80314b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803150:	5d                   	pop    %rbp
+  803151:	c3                   	ret
+
+0000000000803152 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803152:	55                   	push   %rbp
+  803153:	48 89 e5             	mov    %rsp,%rbp
+  803156:	41 57                	push   %r15
+  803158:	41 56                	push   %r14
+  80315a:	41 55                	push   %r13
+  80315c:	41 54                	push   %r12
+  80315e:	53                   	push   %rbx
+  80315f:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803166:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80316d:	48 85 d2             	test   %rdx,%rdx
+  803170:	74 7a                	je     8031ec <devcons_write+0x9a>
+  803172:	49 89 d6             	mov    %rdx,%r14
+  803175:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80317b:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803180:	49 bf c2 3f 80 00 00 	movabs $0x803fc2,%r15
+  803187:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80318a:	4c 89 f3             	mov    %r14,%rbx
+  80318d:	48 29 f3             	sub    %rsi,%rbx
+  803190:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803195:	48 39 c3             	cmp    %rax,%rbx
+  803198:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80319c:	4c 63 eb             	movslq %ebx,%r13
+  80319f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031a6:	48 01 c6             	add    %rax,%rsi
+  8031a9:	4c 89 ea             	mov    %r13,%rdx
+  8031ac:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031b3:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031b6:	4c 89 ee             	mov    %r13,%rsi
+  8031b9:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031c0:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  8031c7:	00 00 00 
+  8031ca:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031cc:	41 01 dc             	add    %ebx,%r12d
+  8031cf:	49 63 f4             	movslq %r12d,%rsi
+  8031d2:	4c 39 f6             	cmp    %r14,%rsi
+  8031d5:	72 b3                	jb     80318a <devcons_write+0x38>
+    return res;
+  8031d7:	49 63 c4             	movslq %r12d,%rax
+}
+  8031da:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031e1:	5b                   	pop    %rbx
+  8031e2:	41 5c                	pop    %r12
+  8031e4:	41 5d                	pop    %r13
+  8031e6:	41 5e                	pop    %r14
+  8031e8:	41 5f                	pop    %r15
+  8031ea:	5d                   	pop    %rbp
+  8031eb:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8031ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031f2:	eb e3                	jmp    8031d7 <devcons_write+0x85>
+
+00000000008031f4 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031f4:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8031f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fc:	48 85 c0             	test   %rax,%rax
+  8031ff:	74 55                	je     803256 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803201:	55                   	push   %rbp
+  803202:	48 89 e5             	mov    %rsp,%rbp
+  803205:	41 55                	push   %r13
+  803207:	41 54                	push   %r12
+  803209:	53                   	push   %rbx
+  80320a:	48 83 ec 08          	sub    $0x8,%rsp
+  80320e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803211:	48 bb 1c 01 80 00 00 	movabs $0x80011c,%rbx
+  803218:	00 00 00 
+  80321b:	49 bc d1 01 80 00 00 	movabs $0x8001d1,%r12
+  803222:	00 00 00 
+  803225:	eb 03                	jmp    80322a <devcons_read+0x36>
+  803227:	41 ff d4             	call   *%r12
+  80322a:	ff d3                	call   *%rbx
+  80322c:	85 c0                	test   %eax,%eax
+  80322e:	74 f7                	je     803227 <devcons_read+0x33>
+    if (c < 0) return c;
+  803230:	48 63 d0             	movslq %eax,%rdx
+  803233:	78 13                	js     803248 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803235:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323a:	83 f8 04             	cmp    $0x4,%eax
+  80323d:	74 09                	je     803248 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80323f:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803243:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803248:	48 89 d0             	mov    %rdx,%rax
+  80324b:	48 83 c4 08          	add    $0x8,%rsp
+  80324f:	5b                   	pop    %rbx
+  803250:	41 5c                	pop    %r12
+  803252:	41 5d                	pop    %r13
+  803254:	5d                   	pop    %rbp
+  803255:	c3                   	ret
+  803256:	48 89 d0             	mov    %rdx,%rax
+  803259:	c3                   	ret
+
+000000000080325a <cputchar>:
+cputchar(int ch) {
+  80325a:	55                   	push   %rbp
+  80325b:	48 89 e5             	mov    %rsp,%rbp
+  80325e:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803262:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803266:	be 01 00 00 00       	mov    $0x1,%esi
+  80326b:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80326f:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+}
+  80327b:	c9                   	leave
+  80327c:	c3                   	ret
+
+000000000080327d <getchar>:
+getchar(void) {
+  80327d:	55                   	push   %rbp
+  80327e:	48 89 e5             	mov    %rsp,%rbp
+  803281:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803285:	ba 01 00 00 00       	mov    $0x1,%edx
+  80328a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80328e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803293:	48 b8 d9 09 80 00 00 	movabs $0x8009d9,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+  80329f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 06                	js     8032ab <getchar+0x2e>
+  8032a5:	74 08                	je     8032af <getchar+0x32>
+  8032a7:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032ab:	89 d0                	mov    %edx,%eax
+  8032ad:	c9                   	leave
+  8032ae:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032af:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032b4:	eb f5                	jmp    8032ab <getchar+0x2e>
+
+00000000008032b6 <iscons>:
+iscons(int fdnum) {
+  8032b6:	55                   	push   %rbp
+  8032b7:	48 89 e5             	mov    %rsp,%rbp
+  8032ba:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032be:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032c2:	48 b8 f6 06 80 00 00 	movabs $0x8006f6,%rax
+  8032c9:	00 00 00 
+  8032cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032ce:	85 c0                	test   %eax,%eax
+  8032d0:	78 18                	js     8032ea <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032d2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032d6:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032dd:	00 00 00 
+  8032e0:	8b 00                	mov    (%rax),%eax
+  8032e2:	39 02                	cmp    %eax,(%rdx)
+  8032e4:	0f 94 c0             	sete   %al
+  8032e7:	0f b6 c0             	movzbl %al,%eax
+}
+  8032ea:	c9                   	leave
+  8032eb:	c3                   	ret
+
+00000000008032ec <opencons>:
+opencons(void) {
+  8032ec:	55                   	push   %rbp
+  8032ed:	48 89 e5             	mov    %rsp,%rbp
+  8032f0:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032f4:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8032f8:	48 b8 96 06 80 00 00 	movabs $0x800696,%rax
+  8032ff:	00 00 00 
+  803302:	ff d0                	call   *%rax
+  803304:	85 c0                	test   %eax,%eax
+  803306:	78 49                	js     803351 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803308:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80330d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803312:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331b:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  803322:	00 00 00 
+  803325:	ff d0                	call   *%rax
+  803327:	85 c0                	test   %eax,%eax
+  803329:	78 26                	js     803351 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80332b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80332f:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803336:	00 00 
+  803338:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80333a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80333e:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803345:	48 b8 68 06 80 00 00 	movabs $0x800668,%rax
+  80334c:	00 00 00 
+  80334f:	ff d0                	call   *%rax
+}
+  803351:	c9                   	leave
+  803352:	c3                   	ret
+
+0000000000803353 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803353:	55                   	push   %rbp
+  803354:	48 89 e5             	mov    %rsp,%rbp
+  803357:	41 56                	push   %r14
+  803359:	41 55                	push   %r13
+  80335b:	41 54                	push   %r12
+  80335d:	53                   	push   %rbx
+  80335e:	48 83 ec 50          	sub    $0x50,%rsp
+  803362:	49 89 fc             	mov    %rdi,%r12
+  803365:	41 89 f5             	mov    %esi,%r13d
+  803368:	48 89 d3             	mov    %rdx,%rbx
+  80336b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80336f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803373:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803377:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80337e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803382:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803386:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80338a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80338e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803395:	00 00 00 
+  803398:	4c 8b 30             	mov    (%rax),%r14
+  80339b:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+  8033a7:	89 c6                	mov    %eax,%esi
+  8033a9:	45 89 e8             	mov    %r13d,%r8d
+  8033ac:	4c 89 e1             	mov    %r12,%rcx
+  8033af:	4c 89 f2             	mov    %r14,%rdx
+  8033b2:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033b9:	00 00 00 
+  8033bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c1:	49 bc a3 34 80 00 00 	movabs $0x8034a3,%r12
+  8033c8:	00 00 00 
+  8033cb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033ce:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033d2:	48 89 df             	mov    %rbx,%rdi
+  8033d5:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8033dc:	00 00 00 
+  8033df:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033e1:	48 bf 23 47 80 00 00 	movabs $0x804723,%rdi
+  8033e8:	00 00 00 
+  8033eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8033f3:	cc                   	int3
+  8033f4:	eb fd                	jmp    8033f3 <_panic+0xa0>
+
+00000000008033f6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8033f6:	55                   	push   %rbp
+  8033f7:	48 89 e5             	mov    %rsp,%rbp
+  8033fa:	53                   	push   %rbx
+  8033fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8033ff:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803402:	8b 06                	mov    (%rsi),%eax
+  803404:	8d 50 01             	lea    0x1(%rax),%edx
+  803407:	89 16                	mov    %edx,(%rsi)
+  803409:	48 98                	cltq
+  80340b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803410:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803416:	74 0a                	je     803422 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803418:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80341c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803420:	c9                   	leave
+  803421:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803422:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803426:	be ff 00 00 00       	mov    $0xff,%esi
+  80342b:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  803432:	00 00 00 
+  803435:	ff d0                	call   *%rax
+        state->offset = 0;
+  803437:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80343d:	eb d9                	jmp    803418 <putch+0x22>
+
+000000000080343f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80343f:	55                   	push   %rbp
+  803440:	48 89 e5             	mov    %rsp,%rbp
+  803443:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80344a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80344d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803454:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803461:	48 89 f1             	mov    %rsi,%rcx
+  803464:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80346b:	48 bf f6 33 80 00 00 	movabs $0x8033f6,%rdi
+  803472:	00 00 00 
+  803475:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  80347c:	00 00 00 
+  80347f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803481:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803488:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80348f:	48 b8 fd 00 80 00 00 	movabs $0x8000fd,%rax
+  803496:	00 00 00 
+  803499:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80349b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034a1:	c9                   	leave
+  8034a2:	c3                   	ret
+
+00000000008034a3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034a3:	55                   	push   %rbp
+  8034a4:	48 89 e5             	mov    %rsp,%rbp
+  8034a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8034ab:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034af:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034b3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034b7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034bb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034bf:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034c6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034ce:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034d6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034da:	48 b8 3f 34 80 00 00 	movabs $0x80343f,%rax
+  8034e1:	00 00 00 
+  8034e4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8034e6:	c9                   	leave
+  8034e7:	c3                   	ret
+
+00000000008034e8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8034e8:	55                   	push   %rbp
+  8034e9:	48 89 e5             	mov    %rsp,%rbp
+  8034ec:	41 57                	push   %r15
+  8034ee:	41 56                	push   %r14
+  8034f0:	41 55                	push   %r13
+  8034f2:	41 54                	push   %r12
+  8034f4:	53                   	push   %rbx
+  8034f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8034f9:	49 89 fc             	mov    %rdi,%r12
+  8034fc:	49 89 f5             	mov    %rsi,%r13
+  8034ff:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803503:	8b 45 10             	mov    0x10(%rbp),%eax
+  803506:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803509:	41 89 cf             	mov    %ecx,%r15d
+  80350c:	4c 39 fa             	cmp    %r15,%rdx
+  80350f:	73 5b                	jae    80356c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803511:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803515:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803519:	85 db                	test   %ebx,%ebx
+  80351b:	7e 0e                	jle    80352b <print_num+0x43>
+            putch(padc, put_arg);
+  80351d:	4c 89 ee             	mov    %r13,%rsi
+  803520:	44 89 f7             	mov    %r14d,%edi
+  803523:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803526:	83 eb 01             	sub    $0x1,%ebx
+  803529:	75 f2                	jne    80351d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80352b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80352f:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  803536:	00 00 00 
+  803539:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  803540:	00 00 00 
+  803543:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803547:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80354b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803550:	49 f7 f7             	div    %r15
+  803553:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803557:	4c 89 ee             	mov    %r13,%rsi
+  80355a:	41 ff d4             	call   *%r12
+}
+  80355d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803561:	5b                   	pop    %rbx
+  803562:	41 5c                	pop    %r12
+  803564:	41 5d                	pop    %r13
+  803566:	41 5e                	pop    %r14
+  803568:	41 5f                	pop    %r15
+  80356a:	5d                   	pop    %rbp
+  80356b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80356c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803570:	ba 00 00 00 00       	mov    $0x0,%edx
+  803575:	49 f7 f7             	div    %r15
+  803578:	48 83 ec 08          	sub    $0x8,%rsp
+  80357c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803580:	52                   	push   %rdx
+  803581:	45 0f be c9          	movsbl %r9b,%r9d
+  803585:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803589:	48 89 c2             	mov    %rax,%rdx
+  80358c:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  803593:	00 00 00 
+  803596:	ff d0                	call   *%rax
+  803598:	48 83 c4 10          	add    $0x10,%rsp
+  80359c:	eb 8d                	jmp    80352b <print_num+0x43>
+
+000000000080359e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80359e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035a2:	48 8b 06             	mov    (%rsi),%rax
+  8035a5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035a9:	73 0a                	jae    8035b5 <sprintputch+0x17>
+        *state->start++ = ch;
+  8035ab:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035af:	48 89 16             	mov    %rdx,(%rsi)
+  8035b2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035b5:	c3                   	ret
+
+00000000008035b6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035b6:	55                   	push   %rbp
+  8035b7:	48 89 e5             	mov    %rsp,%rbp
+  8035ba:	48 83 ec 50          	sub    $0x50,%rsp
+  8035be:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035c2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035c6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035ca:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035e1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035e5:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  8035ec:	00 00 00 
+  8035ef:	ff d0                	call   *%rax
+}
+  8035f1:	c9                   	leave
+  8035f2:	c3                   	ret
+
+00000000008035f3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8035f3:	55                   	push   %rbp
+  8035f4:	48 89 e5             	mov    %rsp,%rbp
+  8035f7:	41 57                	push   %r15
+  8035f9:	41 56                	push   %r14
+  8035fb:	41 55                	push   %r13
+  8035fd:	41 54                	push   %r12
+  8035ff:	53                   	push   %rbx
+  803600:	48 83 ec 38          	sub    $0x38,%rsp
+  803604:	49 89 fe             	mov    %rdi,%r14
+  803607:	49 89 f5             	mov    %rsi,%r13
+  80360a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80360d:	48 8b 01             	mov    (%rcx),%rax
+  803610:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803614:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803618:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80361c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803620:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803624:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803628:	0f b6 3b             	movzbl (%rbx),%edi
+  80362b:	40 80 ff 25          	cmp    $0x25,%dil
+  80362f:	74 18                	je     803649 <vprintfmt+0x56>
+            if (!ch) return;
+  803631:	40 84 ff             	test   %dil,%dil
+  803634:	0f 84 b1 06 00 00    	je     803ceb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80363a:	40 0f b6 ff          	movzbl %dil,%edi
+  80363e:	4c 89 ee             	mov    %r13,%rsi
+  803641:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803644:	4c 89 e3             	mov    %r12,%rbx
+  803647:	eb db                	jmp    803624 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803649:	be 00 00 00 00       	mov    $0x0,%esi
+  80364e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803652:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803657:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80365d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803664:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803668:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80366d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803672:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803675:	83 e8 23             	sub    $0x23,%eax
+  803678:	3c 57                	cmp    $0x57,%al
+  80367a:	0f 87 51 06 00 00    	ja     803cd1 <vprintfmt+0x6de>
+  803680:	0f b6 c0             	movzbl %al,%eax
+  803683:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  80368a:	00 00 00 
+  80368d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803690:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803693:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803697:	eb cf                	jmp    803668 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803699:	49 89 dc             	mov    %rbx,%r12
+  80369c:	be 01 00 00 00       	mov    $0x1,%esi
+  8036a1:	eb c5                	jmp    803668 <vprintfmt+0x75>
+            padc = ch;
+  8036a3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036a7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036aa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036ad:	eb b9                	jmp    803668 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b5:	77 24                	ja     8036db <vprintfmt+0xe8>
+  8036b7:	89 c1                	mov    %eax,%ecx
+  8036b9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036bd:	83 c0 08             	add    $0x8,%eax
+  8036c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036c3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036c6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036c9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036cd:	79 99                	jns    803668 <vprintfmt+0x75>
+                width = precision;
+  8036cf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036d3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036d9:	eb 8d                	jmp    803668 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036db:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036df:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036e7:	eb da                	jmp    8036c3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8036e9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8036ee:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8036f2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8036f8:	3c 39                	cmp    $0x39,%al
+  8036fa:	77 1c                	ja     803718 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8036fc:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803700:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803704:	0f b6 c0             	movzbl %al,%eax
+  803707:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80370c:	0f b6 03             	movzbl (%rbx),%eax
+  80370f:	3c 39                	cmp    $0x39,%al
+  803711:	76 e9                	jbe    8036fc <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803713:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803716:	eb b1                	jmp    8036c9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803718:	49 89 dc             	mov    %rbx,%r12
+  80371b:	eb ac                	jmp    8036c9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80371d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803720:	85 c9                	test   %ecx,%ecx
+  803722:	b8 00 00 00 00       	mov    $0x0,%eax
+  803727:	0f 49 c1             	cmovns %ecx,%eax
+  80372a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80372d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803730:	e9 33 ff ff ff       	jmp    803668 <vprintfmt+0x75>
+            lflag++;
+  803735:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803738:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80373b:	e9 28 ff ff ff       	jmp    803668 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803740:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803743:	83 f8 2f             	cmp    $0x2f,%eax
+  803746:	77 19                	ja     803761 <vprintfmt+0x16e>
+  803748:	89 c2                	mov    %eax,%edx
+  80374a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80374e:	83 c0 08             	add    $0x8,%eax
+  803751:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803754:	8b 3a                	mov    (%rdx),%edi
+  803756:	4c 89 ee             	mov    %r13,%rsi
+  803759:	41 ff d6             	call   *%r14
+            break;
+  80375c:	e9 c3 fe ff ff       	jmp    803624 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803761:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803765:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803769:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80376d:	eb e5                	jmp    803754 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80376f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803772:	83 f8 2f             	cmp    $0x2f,%eax
+  803775:	77 5a                	ja     8037d1 <vprintfmt+0x1de>
+  803777:	89 c2                	mov    %eax,%edx
+  803779:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80377d:	83 c0 08             	add    $0x8,%eax
+  803780:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803783:	8b 02                	mov    (%rdx),%eax
+  803785:	89 c1                	mov    %eax,%ecx
+  803787:	f7 d9                	neg    %ecx
+  803789:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80378c:	83 f9 16             	cmp    $0x16,%ecx
+  80378f:	7f 4e                	jg     8037df <vprintfmt+0x1ec>
+  803791:	48 63 c1             	movslq %ecx,%rax
+  803794:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  80379b:	00 00 00 
+  80379e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037a2:	48 85 c0             	test   %rax,%rax
+  8037a5:	74 38                	je     8037df <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037a7:	48 89 c1             	mov    %rax,%rcx
+  8037aa:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037b1:	00 00 00 
+  8037b4:	4c 89 ee             	mov    %r13,%rsi
+  8037b7:	4c 89 f7             	mov    %r14,%rdi
+  8037ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037bf:	49 b8 b6 35 80 00 00 	movabs $0x8035b6,%r8
+  8037c6:	00 00 00 
+  8037c9:	41 ff d0             	call   *%r8
+  8037cc:	e9 53 fe ff ff       	jmp    803624 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037dd:	eb a4                	jmp    803783 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037df:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  8037e6:	00 00 00 
+  8037e9:	4c 89 ee             	mov    %r13,%rsi
+  8037ec:	4c 89 f7             	mov    %r14,%rdi
+  8037ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f4:	49 b8 b6 35 80 00 00 	movabs $0x8035b6,%r8
+  8037fb:	00 00 00 
+  8037fe:	41 ff d0             	call   *%r8
+  803801:	e9 1e fe ff ff       	jmp    803624 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803806:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803809:	83 f8 2f             	cmp    $0x2f,%eax
+  80380c:	77 6c                	ja     80387a <vprintfmt+0x287>
+  80380e:	89 c2                	mov    %eax,%edx
+  803810:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803814:	83 c0 08             	add    $0x8,%eax
+  803817:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80381a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80381d:	48 85 d2             	test   %rdx,%rdx
+  803820:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  803827:	00 00 00 
+  80382a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80382e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803832:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803836:	7e 06                	jle    80383e <vprintfmt+0x24b>
+  803838:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80383c:	75 4a                	jne    803888 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80383e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803842:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803846:	0f b6 00             	movzbl (%rax),%eax
+  803849:	84 c0                	test   %al,%al
+  80384b:	0f 85 9a 00 00 00    	jne    8038eb <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803851:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803854:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803858:	85 c0                	test   %eax,%eax
+  80385a:	0f 8e c4 fd ff ff    	jle    803624 <vprintfmt+0x31>
+  803860:	4c 89 ee             	mov    %r13,%rsi
+  803863:	bf 20 00 00 00       	mov    $0x20,%edi
+  803868:	41 ff d6             	call   *%r14
+  80386b:	41 83 ec 01          	sub    $0x1,%r12d
+  80386f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803873:	75 eb                	jne    803860 <vprintfmt+0x26d>
+  803875:	e9 aa fd ff ff       	jmp    803624 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80387a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80387e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803882:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803886:	eb 92                	jmp    80381a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803888:	49 63 f7             	movslq %r15d,%rsi
+  80388b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80388f:	48 b8 a5 3d 80 00 00 	movabs $0x803da5,%rax
+  803896:	00 00 00 
+  803899:	ff d0                	call   *%rax
+  80389b:	48 89 c2             	mov    %rax,%rdx
+  80389e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038a1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038a3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038a6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038a9:	85 c0                	test   %eax,%eax
+  8038ab:	7e 91                	jle    80383e <vprintfmt+0x24b>
+  8038ad:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038b2:	4c 89 ee             	mov    %r13,%rsi
+  8038b5:	44 89 e7             	mov    %r12d,%edi
+  8038b8:	41 ff d6             	call   *%r14
+  8038bb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038bf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038c5:	75 eb                	jne    8038b2 <vprintfmt+0x2bf>
+  8038c7:	e9 72 ff ff ff       	jmp    80383e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038cc:	0f b6 f8             	movzbl %al,%edi
+  8038cf:	4c 89 ee             	mov    %r13,%rsi
+  8038d2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038d5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038d9:	49 83 c4 01          	add    $0x1,%r12
+  8038dd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038e3:	84 c0                	test   %al,%al
+  8038e5:	0f 84 66 ff ff ff    	je     803851 <vprintfmt+0x25e>
+  8038eb:	45 85 ff             	test   %r15d,%r15d
+  8038ee:	78 0a                	js     8038fa <vprintfmt+0x307>
+  8038f0:	41 83 ef 01          	sub    $0x1,%r15d
+  8038f4:	0f 88 57 ff ff ff    	js     803851 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038fa:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8038fe:	74 cc                	je     8038cc <vprintfmt+0x2d9>
+  803900:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803903:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803908:	80 fa 5e             	cmp    $0x5e,%dl
+  80390b:	77 c2                	ja     8038cf <vprintfmt+0x2dc>
+  80390d:	eb bd                	jmp    8038cc <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80390f:	40 84 f6             	test   %sil,%sil
+  803912:	75 26                	jne    80393a <vprintfmt+0x347>
+    switch (lflag) {
+  803914:	85 d2                	test   %edx,%edx
+  803916:	74 59                	je     803971 <vprintfmt+0x37e>
+  803918:	83 fa 01             	cmp    $0x1,%edx
+  80391b:	74 7b                	je     803998 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80391d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803920:	83 f8 2f             	cmp    $0x2f,%eax
+  803923:	0f 87 96 00 00 00    	ja     8039bf <vprintfmt+0x3cc>
+  803929:	89 c2                	mov    %eax,%edx
+  80392b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80392f:	83 c0 08             	add    $0x8,%eax
+  803932:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803935:	4c 8b 22             	mov    (%rdx),%r12
+  803938:	eb 17                	jmp    803951 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80393a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393d:	83 f8 2f             	cmp    $0x2f,%eax
+  803940:	77 21                	ja     803963 <vprintfmt+0x370>
+  803942:	89 c2                	mov    %eax,%edx
+  803944:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803948:	83 c0 08             	add    $0x8,%eax
+  80394b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80394e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803951:	4d 85 e4             	test   %r12,%r12
+  803954:	78 7a                	js     8039d0 <vprintfmt+0x3dd>
+            num = i;
+  803956:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803959:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80395e:	e9 50 02 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803963:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803967:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80396b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80396f:	eb dd                	jmp    80394e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803971:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803974:	83 f8 2f             	cmp    $0x2f,%eax
+  803977:	77 11                	ja     80398a <vprintfmt+0x397>
+  803979:	89 c2                	mov    %eax,%edx
+  80397b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80397f:	83 c0 08             	add    $0x8,%eax
+  803982:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803985:	4c 63 22             	movslq (%rdx),%r12
+  803988:	eb c7                	jmp    803951 <vprintfmt+0x35e>
+  80398a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80398e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803992:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803996:	eb ed                	jmp    803985 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803998:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80399b:	83 f8 2f             	cmp    $0x2f,%eax
+  80399e:	77 11                	ja     8039b1 <vprintfmt+0x3be>
+  8039a0:	89 c2                	mov    %eax,%edx
+  8039a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039a6:	83 c0 08             	add    $0x8,%eax
+  8039a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039ac:	4c 8b 22             	mov    (%rdx),%r12
+  8039af:	eb a0                	jmp    803951 <vprintfmt+0x35e>
+  8039b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039bd:	eb ed                	jmp    8039ac <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039cb:	e9 65 ff ff ff       	jmp    803935 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039d0:	4c 89 ee             	mov    %r13,%rsi
+  8039d3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039d8:	41 ff d6             	call   *%r14
+                i = -i;
+  8039db:	49 f7 dc             	neg    %r12
+  8039de:	e9 73 ff ff ff       	jmp    803956 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039e3:	40 84 f6             	test   %sil,%sil
+  8039e6:	75 32                	jne    803a1a <vprintfmt+0x427>
+    switch (lflag) {
+  8039e8:	85 d2                	test   %edx,%edx
+  8039ea:	74 5d                	je     803a49 <vprintfmt+0x456>
+  8039ec:	83 fa 01             	cmp    $0x1,%edx
+  8039ef:	0f 84 82 00 00 00    	je     803a77 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8039f5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039f8:	83 f8 2f             	cmp    $0x2f,%eax
+  8039fb:	0f 87 a5 00 00 00    	ja     803aa6 <vprintfmt+0x4b3>
+  803a01:	89 c2                	mov    %eax,%edx
+  803a03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a07:	83 c0 08             	add    $0x8,%eax
+  803a0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a0d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a10:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a15:	e9 99 01 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a1d:	83 f8 2f             	cmp    $0x2f,%eax
+  803a20:	77 19                	ja     803a3b <vprintfmt+0x448>
+  803a22:	89 c2                	mov    %eax,%edx
+  803a24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a28:	83 c0 08             	add    $0x8,%eax
+  803a2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a2e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a31:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a36:	e9 78 01 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+  803a3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a47:	eb e5                	jmp    803a2e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a4c:	83 f8 2f             	cmp    $0x2f,%eax
+  803a4f:	77 18                	ja     803a69 <vprintfmt+0x476>
+  803a51:	89 c2                	mov    %eax,%edx
+  803a53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a57:	83 c0 08             	add    $0x8,%eax
+  803a5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a5d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a5f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a64:	e9 4a 01 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+  803a69:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a6d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a71:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a75:	eb e6                	jmp    803a5d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a7a:	83 f8 2f             	cmp    $0x2f,%eax
+  803a7d:	77 19                	ja     803a98 <vprintfmt+0x4a5>
+  803a7f:	89 c2                	mov    %eax,%edx
+  803a81:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a85:	83 c0 08             	add    $0x8,%eax
+  803a88:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a8b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a8e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803a93:	e9 1b 01 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+  803a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aa4:	eb e5                	jmp    803a8b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803aa6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aaa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab2:	e9 56 ff ff ff       	jmp    803a0d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ab7:	40 84 f6             	test   %sil,%sil
+  803aba:	75 2e                	jne    803aea <vprintfmt+0x4f7>
+    switch (lflag) {
+  803abc:	85 d2                	test   %edx,%edx
+  803abe:	74 59                	je     803b19 <vprintfmt+0x526>
+  803ac0:	83 fa 01             	cmp    $0x1,%edx
+  803ac3:	74 7f                	je     803b44 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803ac5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ac8:	83 f8 2f             	cmp    $0x2f,%eax
+  803acb:	0f 87 9f 00 00 00    	ja     803b70 <vprintfmt+0x57d>
+  803ad1:	89 c2                	mov    %eax,%edx
+  803ad3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ad7:	83 c0 08             	add    $0x8,%eax
+  803ada:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803add:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803ae0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803ae5:	e9 c9 00 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803aea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aed:	83 f8 2f             	cmp    $0x2f,%eax
+  803af0:	77 19                	ja     803b0b <vprintfmt+0x518>
+  803af2:	89 c2                	mov    %eax,%edx
+  803af4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803af8:	83 c0 08             	add    $0x8,%eax
+  803afb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803afe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b01:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b06:	e9 a8 00 00 00       	jmp    803bb3 <vprintfmt+0x5c0>
+  803b0b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b0f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b13:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b17:	eb e5                	jmp    803afe <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b19:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b1c:	83 f8 2f             	cmp    $0x2f,%eax
+  803b1f:	77 15                	ja     803b36 <vprintfmt+0x543>
+  803b21:	89 c2                	mov    %eax,%edx
+  803b23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b27:	83 c0 08             	add    $0x8,%eax
+  803b2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b2d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b2f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b34:	eb 7d                	jmp    803bb3 <vprintfmt+0x5c0>
+  803b36:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b3a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b42:	eb e9                	jmp    803b2d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b44:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b47:	83 f8 2f             	cmp    $0x2f,%eax
+  803b4a:	77 16                	ja     803b62 <vprintfmt+0x56f>
+  803b4c:	89 c2                	mov    %eax,%edx
+  803b4e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b52:	83 c0 08             	add    $0x8,%eax
+  803b55:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b58:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b5b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b60:	eb 51                	jmp    803bb3 <vprintfmt+0x5c0>
+  803b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6e:	eb e8                	jmp    803b58 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b7c:	e9 5c ff ff ff       	jmp    803add <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b81:	4c 89 ee             	mov    %r13,%rsi
+  803b84:	bf 30 00 00 00       	mov    $0x30,%edi
+  803b89:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803b8c:	4c 89 ee             	mov    %r13,%rsi
+  803b8f:	bf 78 00 00 00       	mov    $0x78,%edi
+  803b94:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803b97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b9a:	83 f8 2f             	cmp    $0x2f,%eax
+  803b9d:	77 47                	ja     803be6 <vprintfmt+0x5f3>
+  803b9f:	89 c2                	mov    %eax,%edx
+  803ba1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ba5:	83 c0 08             	add    $0x8,%eax
+  803ba8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bae:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bb3:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bbb:	0f 94 c0             	sete   %al
+  803bbe:	0f b6 c0             	movzbl %al,%eax
+  803bc1:	50                   	push   %rax
+  803bc2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bc7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bcb:	4c 89 ee             	mov    %r13,%rsi
+  803bce:	4c 89 f7             	mov    %r14,%rdi
+  803bd1:	48 b8 e8 34 80 00 00 	movabs $0x8034e8,%rax
+  803bd8:	00 00 00 
+  803bdb:	ff d0                	call   *%rax
+            break;
+  803bdd:	48 83 c4 10          	add    $0x10,%rsp
+  803be1:	e9 3e fa ff ff       	jmp    803624 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803be6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf2:	eb b7                	jmp    803bab <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803bf4:	40 84 f6             	test   %sil,%sil
+  803bf7:	75 2b                	jne    803c24 <vprintfmt+0x631>
+    switch (lflag) {
+  803bf9:	85 d2                	test   %edx,%edx
+  803bfb:	74 56                	je     803c53 <vprintfmt+0x660>
+  803bfd:	83 fa 01             	cmp    $0x1,%edx
+  803c00:	74 7f                	je     803c81 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c05:	83 f8 2f             	cmp    $0x2f,%eax
+  803c08:	0f 87 a2 00 00 00    	ja     803cb0 <vprintfmt+0x6bd>
+  803c0e:	89 c2                	mov    %eax,%edx
+  803c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c14:	83 c0 08             	add    $0x8,%eax
+  803c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c1a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c22:	eb 8f                	jmp    803bb3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c27:	83 f8 2f             	cmp    $0x2f,%eax
+  803c2a:	77 19                	ja     803c45 <vprintfmt+0x652>
+  803c2c:	89 c2                	mov    %eax,%edx
+  803c2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c32:	83 c0 08             	add    $0x8,%eax
+  803c35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c38:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c3b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c40:	e9 6e ff ff ff       	jmp    803bb3 <vprintfmt+0x5c0>
+  803c45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c51:	eb e5                	jmp    803c38 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c56:	83 f8 2f             	cmp    $0x2f,%eax
+  803c59:	77 18                	ja     803c73 <vprintfmt+0x680>
+  803c5b:	89 c2                	mov    %eax,%edx
+  803c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c61:	83 c0 08             	add    $0x8,%eax
+  803c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c67:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c69:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c6e:	e9 40 ff ff ff       	jmp    803bb3 <vprintfmt+0x5c0>
+  803c73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c7f:	eb e6                	jmp    803c67 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c84:	83 f8 2f             	cmp    $0x2f,%eax
+  803c87:	77 19                	ja     803ca2 <vprintfmt+0x6af>
+  803c89:	89 c2                	mov    %eax,%edx
+  803c8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c8f:	83 c0 08             	add    $0x8,%eax
+  803c92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c95:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c98:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803c9d:	e9 11 ff ff ff       	jmp    803bb3 <vprintfmt+0x5c0>
+  803ca2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ca6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803caa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cae:	eb e5                	jmp    803c95 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbc:	e9 59 ff ff ff       	jmp    803c1a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cc1:	4c 89 ee             	mov    %r13,%rsi
+  803cc4:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cc9:	41 ff d6             	call   *%r14
+            break;
+  803ccc:	e9 53 f9 ff ff       	jmp    803624 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cd1:	4c 89 ee             	mov    %r13,%rsi
+  803cd4:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cd9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803cdc:	48 83 eb 01          	sub    $0x1,%rbx
+  803ce0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803ce4:	75 f6                	jne    803cdc <vprintfmt+0x6e9>
+  803ce6:	e9 39 f9 ff ff       	jmp    803624 <vprintfmt+0x31>
+}
+  803ceb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803cef:	5b                   	pop    %rbx
+  803cf0:	41 5c                	pop    %r12
+  803cf2:	41 5d                	pop    %r13
+  803cf4:	41 5e                	pop    %r14
+  803cf6:	41 5f                	pop    %r15
+  803cf8:	5d                   	pop    %rbp
+  803cf9:	c3                   	ret
+
+0000000000803cfa <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803cfa:	55                   	push   %rbp
+  803cfb:	48 89 e5             	mov    %rsp,%rbp
+  803cfe:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d02:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d06:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d0b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d0f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d16:	48 85 ff             	test   %rdi,%rdi
+  803d19:	74 2b                	je     803d46 <vsnprintf+0x4c>
+  803d1b:	48 85 f6             	test   %rsi,%rsi
+  803d1e:	74 26                	je     803d46 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d20:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d24:	48 bf 9e 35 80 00 00 	movabs $0x80359e,%rdi
+  803d2b:	00 00 00 
+  803d2e:	48 b8 f3 35 80 00 00 	movabs $0x8035f3,%rax
+  803d35:	00 00 00 
+  803d38:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d3a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d3e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d41:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d44:	c9                   	leave
+  803d45:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d46:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d4b:	eb f7                	jmp    803d44 <vsnprintf+0x4a>
+
+0000000000803d4d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d4d:	55                   	push   %rbp
+  803d4e:	48 89 e5             	mov    %rsp,%rbp
+  803d51:	48 83 ec 50          	sub    $0x50,%rsp
+  803d55:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d59:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d5d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d61:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d68:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d70:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d74:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d78:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d7c:	48 b8 fa 3c 80 00 00 	movabs $0x803cfa,%rax
+  803d83:	00 00 00 
+  803d86:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803d88:	c9                   	leave
+  803d89:	c3                   	ret
+
+0000000000803d8a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803d8a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803d8d:	74 10                	je     803d9f <strlen+0x15>
+    size_t n = 0;
+  803d8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803d94:	48 83 c0 01          	add    $0x1,%rax
+  803d98:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803d9c:	75 f6                	jne    803d94 <strlen+0xa>
+  803d9e:	c3                   	ret
+    size_t n = 0;
+  803d9f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803da4:	c3                   	ret
+
+0000000000803da5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803da5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803da8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dad:	48 85 f6             	test   %rsi,%rsi
+  803db0:	74 11                	je     803dc3 <strnlen+0x1e>
+  803db2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803db6:	74 0c                	je     803dc4 <strnlen+0x1f>
+  803db8:	48 83 c2 01          	add    $0x1,%rdx
+  803dbc:	48 39 d0             	cmp    %rdx,%rax
+  803dbf:	75 f1                	jne    803db2 <strnlen+0xd>
+  803dc1:	eb 04                	jmp    803dc7 <strnlen+0x22>
+  803dc3:	c3                   	ret
+  803dc4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803dc7:	c3                   	ret
+
+0000000000803dc8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dc8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dcb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dd4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803dd7:	48 83 c2 01          	add    $0x1,%rdx
+  803ddb:	84 c9                	test   %cl,%cl
+  803ddd:	75 f1                	jne    803dd0 <strcpy+0x8>
+        ;
+    return res;
+}
+  803ddf:	c3                   	ret
+
+0000000000803de0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803de0:	55                   	push   %rbp
+  803de1:	48 89 e5             	mov    %rsp,%rbp
+  803de4:	41 54                	push   %r12
+  803de6:	53                   	push   %rbx
+  803de7:	48 89 fb             	mov    %rdi,%rbx
+  803dea:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803ded:	48 b8 8a 3d 80 00 00 	movabs $0x803d8a,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803df9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803dfd:	4c 89 e6             	mov    %r12,%rsi
+  803e00:	48 b8 c8 3d 80 00 00 	movabs $0x803dc8,%rax
+  803e07:	00 00 00 
+  803e0a:	ff d0                	call   *%rax
+    return dst;
+}
+  803e0c:	48 89 d8             	mov    %rbx,%rax
+  803e0f:	5b                   	pop    %rbx
+  803e10:	41 5c                	pop    %r12
+  803e12:	5d                   	pop    %rbp
+  803e13:	c3                   	ret
+
+0000000000803e14 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e14:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e17:	48 85 d2             	test   %rdx,%rdx
+  803e1a:	74 1f                	je     803e3b <strncpy+0x27>
+  803e1c:	48 01 fa             	add    %rdi,%rdx
+  803e1f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e22:	48 83 c1 01          	add    $0x1,%rcx
+  803e26:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e2a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e2e:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e32:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e36:	48 39 ca             	cmp    %rcx,%rdx
+  803e39:	75 e7                	jne    803e22 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e3b:	c3                   	ret
+
+0000000000803e3c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e3c:	48 89 f8             	mov    %rdi,%rax
+  803e3f:	48 85 d2             	test   %rdx,%rdx
+  803e42:	74 24                	je     803e68 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e44:	48 83 ea 01          	sub    $0x1,%rdx
+  803e48:	74 1b                	je     803e65 <strlcpy+0x29>
+  803e4a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e4e:	0f b6 16             	movzbl (%rsi),%edx
+  803e51:	84 d2                	test   %dl,%dl
+  803e53:	74 10                	je     803e65 <strlcpy+0x29>
+            *dst++ = *src++;
+  803e55:	48 83 c6 01          	add    $0x1,%rsi
+  803e59:	48 83 c0 01          	add    $0x1,%rax
+  803e5d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e60:	48 39 c8             	cmp    %rcx,%rax
+  803e63:	75 e9                	jne    803e4e <strlcpy+0x12>
+        *dst = '\0';
+  803e65:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e68:	48 29 f8             	sub    %rdi,%rax
+}
+  803e6b:	c3                   	ret
+
+0000000000803e6c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e6c:	0f b6 07             	movzbl (%rdi),%eax
+  803e6f:	84 c0                	test   %al,%al
+  803e71:	74 13                	je     803e86 <strcmp+0x1a>
+  803e73:	38 06                	cmp    %al,(%rsi)
+  803e75:	75 0f                	jne    803e86 <strcmp+0x1a>
+  803e77:	48 83 c7 01          	add    $0x1,%rdi
+  803e7b:	48 83 c6 01          	add    $0x1,%rsi
+  803e7f:	0f b6 07             	movzbl (%rdi),%eax
+  803e82:	84 c0                	test   %al,%al
+  803e84:	75 ed                	jne    803e73 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803e86:	0f b6 c0             	movzbl %al,%eax
+  803e89:	0f b6 16             	movzbl (%rsi),%edx
+  803e8c:	29 d0                	sub    %edx,%eax
+}
+  803e8e:	c3                   	ret
+
+0000000000803e8f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803e8f:	48 85 d2             	test   %rdx,%rdx
+  803e92:	74 1f                	je     803eb3 <strncmp+0x24>
+  803e94:	0f b6 07             	movzbl (%rdi),%eax
+  803e97:	84 c0                	test   %al,%al
+  803e99:	74 1e                	je     803eb9 <strncmp+0x2a>
+  803e9b:	3a 06                	cmp    (%rsi),%al
+  803e9d:	75 1a                	jne    803eb9 <strncmp+0x2a>
+  803e9f:	48 83 c7 01          	add    $0x1,%rdi
+  803ea3:	48 83 c6 01          	add    $0x1,%rsi
+  803ea7:	48 83 ea 01          	sub    $0x1,%rdx
+  803eab:	75 e7                	jne    803e94 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ead:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb2:	c3                   	ret
+  803eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb8:	c3                   	ret
+  803eb9:	48 85 d2             	test   %rdx,%rdx
+  803ebc:	74 09                	je     803ec7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ebe:	0f b6 07             	movzbl (%rdi),%eax
+  803ec1:	0f b6 16             	movzbl (%rsi),%edx
+  803ec4:	29 d0                	sub    %edx,%eax
+  803ec6:	c3                   	ret
+    if (!n) return 0;
+  803ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ecc:	c3                   	ret
+
+0000000000803ecd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ecd:	0f b6 17             	movzbl (%rdi),%edx
+  803ed0:	84 d2                	test   %dl,%dl
+  803ed2:	74 18                	je     803eec <strchr+0x1f>
+        if (*str == c) {
+  803ed4:	0f be d2             	movsbl %dl,%edx
+  803ed7:	39 f2                	cmp    %esi,%edx
+  803ed9:	74 17                	je     803ef2 <strchr+0x25>
+    for (; *str; str++) {
+  803edb:	48 83 c7 01          	add    $0x1,%rdi
+  803edf:	0f b6 17             	movzbl (%rdi),%edx
+  803ee2:	84 d2                	test   %dl,%dl
+  803ee4:	75 ee                	jne    803ed4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eeb:	c3                   	ret
+  803eec:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef1:	c3                   	ret
+  803ef2:	48 89 f8             	mov    %rdi,%rax
+}
+  803ef5:	c3                   	ret
+
+0000000000803ef6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803ef6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803ef9:	0f b6 17             	movzbl (%rdi),%edx
+  803efc:	84 d2                	test   %dl,%dl
+  803efe:	74 13                	je     803f13 <strfind+0x1d>
+  803f00:	0f be d2             	movsbl %dl,%edx
+  803f03:	39 f2                	cmp    %esi,%edx
+  803f05:	74 0b                	je     803f12 <strfind+0x1c>
+  803f07:	48 83 c0 01          	add    $0x1,%rax
+  803f0b:	0f b6 10             	movzbl (%rax),%edx
+  803f0e:	84 d2                	test   %dl,%dl
+  803f10:	75 ee                	jne    803f00 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f12:	c3                   	ret
+  803f13:	c3                   	ret
+
+0000000000803f14 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f14:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f17:	48 89 f8             	mov    %rdi,%rax
+  803f1a:	48 f7 d8             	neg    %rax
+  803f1d:	83 e0 07             	and    $0x7,%eax
+  803f20:	49 89 d1             	mov    %rdx,%r9
+  803f23:	49 29 c1             	sub    %rax,%r9
+  803f26:	78 36                	js     803f5e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f28:	40 0f b6 c6          	movzbl %sil,%eax
+  803f2c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f33:	01 01 01 
+  803f36:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f3a:	40 f6 c7 07          	test   $0x7,%dil
+  803f3e:	75 38                	jne    803f78 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f40:	4c 89 c9             	mov    %r9,%rcx
+  803f43:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f47:	74 0c                	je     803f55 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f49:	fc                   	cld
+  803f4a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f4d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f51:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f55:	4d 85 c9             	test   %r9,%r9
+  803f58:	75 45                	jne    803f9f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f5a:	4c 89 c0             	mov    %r8,%rax
+  803f5d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f5e:	48 85 d2             	test   %rdx,%rdx
+  803f61:	74 f7                	je     803f5a <memset+0x46>
+  803f63:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f66:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f69:	48 83 c0 01          	add    $0x1,%rax
+  803f6d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f71:	48 39 c2             	cmp    %rax,%rdx
+  803f74:	75 f3                	jne    803f69 <memset+0x55>
+  803f76:	eb e2                	jmp    803f5a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f78:	40 f6 c7 01          	test   $0x1,%dil
+  803f7c:	74 06                	je     803f84 <memset+0x70>
+  803f7e:	88 07                	mov    %al,(%rdi)
+  803f80:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f84:	40 f6 c7 02          	test   $0x2,%dil
+  803f88:	74 07                	je     803f91 <memset+0x7d>
+  803f8a:	66 89 07             	mov    %ax,(%rdi)
+  803f8d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803f91:	40 f6 c7 04          	test   $0x4,%dil
+  803f95:	74 a9                	je     803f40 <memset+0x2c>
+  803f97:	89 07                	mov    %eax,(%rdi)
+  803f99:	48 83 c7 04          	add    $0x4,%rdi
+  803f9d:	eb a1                	jmp    803f40 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803f9f:	41 f6 c1 04          	test   $0x4,%r9b
+  803fa3:	74 06                	je     803fab <memset+0x97>
+  803fa5:	89 07                	mov    %eax,(%rdi)
+  803fa7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fab:	41 f6 c1 02          	test   $0x2,%r9b
+  803faf:	74 07                	je     803fb8 <memset+0xa4>
+  803fb1:	66 89 07             	mov    %ax,(%rdi)
+  803fb4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fb8:	41 f6 c1 01          	test   $0x1,%r9b
+  803fbc:	74 9c                	je     803f5a <memset+0x46>
+  803fbe:	88 07                	mov    %al,(%rdi)
+  803fc0:	eb 98                	jmp    803f5a <memset+0x46>
+
+0000000000803fc2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fc2:	48 89 f8             	mov    %rdi,%rax
+  803fc5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fc8:	48 39 fe             	cmp    %rdi,%rsi
+  803fcb:	73 3b                	jae    804008 <memmove+0x46>
+  803fcd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803fd1:	48 39 d7             	cmp    %rdx,%rdi
+  803fd4:	73 32                	jae    804008 <memmove+0x46>
+        s += n;
+        d += n;
+  803fd6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803fda:	48 89 d6             	mov    %rdx,%rsi
+  803fdd:	48 09 fe             	or     %rdi,%rsi
+  803fe0:	48 09 ce             	or     %rcx,%rsi
+  803fe3:	40 f6 c6 07          	test   $0x7,%sil
+  803fe7:	75 12                	jne    803ffb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803fe9:	48 83 ef 08          	sub    $0x8,%rdi
+  803fed:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803ff1:	48 c1 e9 03          	shr    $0x3,%rcx
+  803ff5:	fd                   	std
+  803ff6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803ff9:	fc                   	cld
+  803ffa:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803ffb:	48 83 ef 01          	sub    $0x1,%rdi
+  803fff:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804003:	fd                   	std
+  804004:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804006:	eb f1                	jmp    803ff9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804008:	48 89 f2             	mov    %rsi,%rdx
+  80400b:	48 09 c2             	or     %rax,%rdx
+  80400e:	48 09 ca             	or     %rcx,%rdx
+  804011:	f6 c2 07             	test   $0x7,%dl
+  804014:	75 0c                	jne    804022 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804016:	48 c1 e9 03          	shr    $0x3,%rcx
+  80401a:	48 89 c7             	mov    %rax,%rdi
+  80401d:	fc                   	cld
+  80401e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804021:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804022:	48 89 c7             	mov    %rax,%rdi
+  804025:	fc                   	cld
+  804026:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804028:	c3                   	ret
+
+0000000000804029 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804029:	55                   	push   %rbp
+  80402a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80402d:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  804034:	00 00 00 
+  804037:	ff d0                	call   *%rax
+}
+  804039:	5d                   	pop    %rbp
+  80403a:	c3                   	ret
+
+000000000080403b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80403b:	55                   	push   %rbp
+  80403c:	48 89 e5             	mov    %rsp,%rbp
+  80403f:	41 57                	push   %r15
+  804041:	41 56                	push   %r14
+  804043:	41 55                	push   %r13
+  804045:	41 54                	push   %r12
+  804047:	53                   	push   %rbx
+  804048:	48 83 ec 08          	sub    $0x8,%rsp
+  80404c:	49 89 fe             	mov    %rdi,%r14
+  80404f:	49 89 f7             	mov    %rsi,%r15
+  804052:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  804055:	48 89 f7             	mov    %rsi,%rdi
+  804058:	48 b8 8a 3d 80 00 00 	movabs $0x803d8a,%rax
+  80405f:	00 00 00 
+  804062:	ff d0                	call   *%rax
+  804064:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804067:	48 89 de             	mov    %rbx,%rsi
+  80406a:	4c 89 f7             	mov    %r14,%rdi
+  80406d:	48 b8 a5 3d 80 00 00 	movabs $0x803da5,%rax
+  804074:	00 00 00 
+  804077:	ff d0                	call   *%rax
+  804079:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80407c:	48 39 c3             	cmp    %rax,%rbx
+  80407f:	74 36                	je     8040b7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  804081:	48 89 d8             	mov    %rbx,%rax
+  804084:	4c 29 e8             	sub    %r13,%rax
+  804087:	49 39 c4             	cmp    %rax,%r12
+  80408a:	73 31                	jae    8040bd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80408c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  804091:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  804095:	4c 89 fe             	mov    %r15,%rsi
+  804098:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  80409f:	00 00 00 
+  8040a2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040a4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040a8:	48 83 c4 08          	add    $0x8,%rsp
+  8040ac:	5b                   	pop    %rbx
+  8040ad:	41 5c                	pop    %r12
+  8040af:	41 5d                	pop    %r13
+  8040b1:	41 5e                	pop    %r14
+  8040b3:	41 5f                	pop    %r15
+  8040b5:	5d                   	pop    %rbp
+  8040b6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040b7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040bb:	eb eb                	jmp    8040a8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040bd:	48 83 eb 01          	sub    $0x1,%rbx
+  8040c1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040c5:	48 89 da             	mov    %rbx,%rdx
+  8040c8:	4c 89 fe             	mov    %r15,%rsi
+  8040cb:	48 b8 29 40 80 00 00 	movabs $0x804029,%rax
+  8040d2:	00 00 00 
+  8040d5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040d7:	49 01 de             	add    %rbx,%r14
+  8040da:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040df:	eb c3                	jmp    8040a4 <strlcat+0x69>
+
+00000000008040e1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040e1:	48 85 d2             	test   %rdx,%rdx
+  8040e4:	74 2d                	je     804113 <memcmp+0x32>
+  8040e6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8040eb:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8040ef:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8040f4:	44 38 c1             	cmp    %r8b,%cl
+  8040f7:	75 0f                	jne    804108 <memcmp+0x27>
+    while (n-- > 0) {
+  8040f9:	48 83 c0 01          	add    $0x1,%rax
+  8040fd:	48 39 c2             	cmp    %rax,%rdx
+  804100:	75 e9                	jne    8040eb <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804102:	b8 00 00 00 00       	mov    $0x0,%eax
+  804107:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804108:	0f b6 c1             	movzbl %cl,%eax
+  80410b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80410f:	44 29 c0             	sub    %r8d,%eax
+  804112:	c3                   	ret
+    return 0;
+  804113:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804118:	c3                   	ret
+
+0000000000804119 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804119:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80411d:	48 39 c7             	cmp    %rax,%rdi
+  804120:	73 0f                	jae    804131 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804122:	40 38 37             	cmp    %sil,(%rdi)
+  804125:	74 0e                	je     804135 <memfind+0x1c>
+    for (; src < end; src++) {
+  804127:	48 83 c7 01          	add    $0x1,%rdi
+  80412b:	48 39 f8             	cmp    %rdi,%rax
+  80412e:	75 f2                	jne    804122 <memfind+0x9>
+  804130:	c3                   	ret
+  804131:	48 89 f8             	mov    %rdi,%rax
+  804134:	c3                   	ret
+  804135:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804138:	c3                   	ret
+
+0000000000804139 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804139:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80413c:	0f b6 37             	movzbl (%rdi),%esi
+  80413f:	40 80 fe 20          	cmp    $0x20,%sil
+  804143:	74 06                	je     80414b <strtol+0x12>
+  804145:	40 80 fe 09          	cmp    $0x9,%sil
+  804149:	75 13                	jne    80415e <strtol+0x25>
+  80414b:	48 83 c7 01          	add    $0x1,%rdi
+  80414f:	0f b6 37             	movzbl (%rdi),%esi
+  804152:	40 80 fe 20          	cmp    $0x20,%sil
+  804156:	74 f3                	je     80414b <strtol+0x12>
+  804158:	40 80 fe 09          	cmp    $0x9,%sil
+  80415c:	74 ed                	je     80414b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80415e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804161:	83 e0 fd             	and    $0xfffffffd,%eax
+  804164:	3c 01                	cmp    $0x1,%al
+  804166:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80416a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  804170:	75 0f                	jne    804181 <strtol+0x48>
+  804172:	80 3f 30             	cmpb   $0x30,(%rdi)
+  804175:	74 14                	je     80418b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804177:	85 d2                	test   %edx,%edx
+  804179:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80417e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  804181:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  804186:	4c 63 ca             	movslq %edx,%r9
+  804189:	eb 36                	jmp    8041c1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80418b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80418f:	74 0f                	je     8041a0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  804191:	85 d2                	test   %edx,%edx
+  804193:	75 ec                	jne    804181 <strtol+0x48>
+        s++;
+  804195:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  804199:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80419e:	eb e1                	jmp    804181 <strtol+0x48>
+        s += 2;
+  8041a0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041a4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041a9:	eb d6                	jmp    804181 <strtol+0x48>
+            dig -= '0';
+  8041ab:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041ae:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041b2:	41 39 d0             	cmp    %edx,%r8d
+  8041b5:	7d 21                	jge    8041d8 <strtol+0x9f>
+        val = val * base + dig;
+  8041b7:	49 0f af c1          	imul   %r9,%rax
+  8041bb:	0f b6 c9             	movzbl %cl,%ecx
+  8041be:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041c1:	48 83 c7 01          	add    $0x1,%rdi
+  8041c5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041c9:	80 f9 39             	cmp    $0x39,%cl
+  8041cc:	76 dd                	jbe    8041ab <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041ce:	80 f9 7b             	cmp    $0x7b,%cl
+  8041d1:	77 05                	ja     8041d8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041d3:	83 e9 57             	sub    $0x57,%ecx
+  8041d6:	eb d6                	jmp    8041ae <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041d8:	4d 85 d2             	test   %r10,%r10
+  8041db:	74 03                	je     8041e0 <strtol+0xa7>
+  8041dd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041e0:	48 89 c2             	mov    %rax,%rdx
+  8041e3:	48 f7 da             	neg    %rdx
+  8041e6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8041ea:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8041ee:	c3                   	ret
+
+00000000008041ef <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8041ef:	55                   	push   %rbp
+  8041f0:	48 89 e5             	mov    %rsp,%rbp
+  8041f3:	41 56                	push   %r14
+  8041f5:	41 55                	push   %r13
+  8041f7:	41 54                	push   %r12
+  8041f9:	53                   	push   %rbx
+  8041fa:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8041fd:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804204:	00 00 00 
+  804207:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80420b:	74 27                	je     804234 <_handle_vectored_pagefault+0x45>
+  80420d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804212:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804219:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80421c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80421f:	4c 89 e7             	mov    %r12,%rdi
+  804222:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804227:	84 c0                	test   %al,%al
+  804229:	75 45                	jne    804270 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80422b:	48 83 c3 01          	add    $0x1,%rbx
+  80422f:	49 3b 1e             	cmp    (%r14),%rbx
+  804232:	72 eb                	jb     80421f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804234:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80423b:	00 
+  80423c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804241:	4d 8b 04 24          	mov    (%r12),%r8
+  804245:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  80424c:	00 00 00 
+  80424f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804254:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80425b:	00 00 00 
+  80425e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804263:	49 ba 53 33 80 00 00 	movabs $0x803353,%r10
+  80426a:	00 00 00 
+  80426d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804270:	5b                   	pop    %rbx
+  804271:	41 5c                	pop    %r12
+  804273:	41 5d                	pop    %r13
+  804275:	41 5e                	pop    %r14
+  804277:	5d                   	pop    %rbp
+  804278:	c3                   	ret
+
+0000000000804279 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804279:	55                   	push   %rbp
+  80427a:	48 89 e5             	mov    %rsp,%rbp
+  80427d:	53                   	push   %rbx
+  80427e:	48 83 ec 08          	sub    $0x8,%rsp
+  804282:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804285:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80428c:	00 00 00 
+  80428f:	80 38 00             	cmpb   $0x0,(%rax)
+  804292:	0f 84 84 00 00 00    	je     80431c <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804298:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80429f:	00 00 00 
+  8042a2:	48 8b 10             	mov    (%rax),%rdx
+  8042a5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042aa:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042b1:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042b4:	48 85 d2             	test   %rdx,%rdx
+  8042b7:	74 19                	je     8042d2 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042b9:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042bd:	0f 84 e8 00 00 00    	je     8043ab <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c3:	48 83 c0 01          	add    $0x1,%rax
+  8042c7:	48 39 d0             	cmp    %rdx,%rax
+  8042ca:	75 ed                	jne    8042b9 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042cc:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042d0:	74 1c                	je     8042ee <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042d2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042d6:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042dd:	00 00 00 
+  8042e0:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8042e7:	00 00 00 
+  8042ea:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8042ee:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  8042f5:	00 00 00 
+  8042f8:	ff d0                	call   *%rax
+  8042fa:	89 c7                	mov    %eax,%edi
+  8042fc:	48 be 71 44 80 00 00 	movabs $0x804471,%rsi
+  804303:	00 00 00 
+  804306:	48 b8 f3 03 80 00 00 	movabs $0x8003f3,%rax
+  80430d:	00 00 00 
+  804310:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804312:	85 c0                	test   %eax,%eax
+  804314:	78 68                	js     80437e <add_pgfault_handler+0x105>
+    return res;
+}
+  804316:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80431a:	c9                   	leave
+  80431b:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80431c:	48 b8 a8 01 80 00 00 	movabs $0x8001a8,%rax
+  804323:	00 00 00 
+  804326:	ff d0                	call   *%rax
+  804328:	89 c7                	mov    %eax,%edi
+  80432a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80432f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804334:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80433b:	00 00 00 
+  80433e:	48 b8 35 02 80 00 00 	movabs $0x800235,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80434a:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804351:	00 00 00 
+  804354:	48 8b 02             	mov    (%rdx),%rax
+  804357:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80435b:	48 89 0a             	mov    %rcx,(%rdx)
+  80435e:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804365:	00 00 00 
+  804368:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80436c:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804373:	00 00 00 
+  804376:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804379:	e9 70 ff ff ff       	jmp    8042ee <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80437e:	89 c1                	mov    %eax,%ecx
+  804380:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  804387:	00 00 00 
+  80438a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80438f:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804396:	00 00 00 
+  804399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439e:	49 b8 53 33 80 00 00 	movabs $0x803353,%r8
+  8043a5:	00 00 00 
+  8043a8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b0:	e9 61 ff ff ff       	jmp    804316 <add_pgfault_handler+0x9d>
+
+00000000008043b5 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043b5:	55                   	push   %rbp
+  8043b6:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043b9:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043c0:	00 00 00 
+  8043c3:	80 38 00             	cmpb   $0x0,(%rax)
+  8043c6:	74 33                	je     8043fb <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043c8:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043cf:	00 00 00 
+  8043d2:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043d7:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043de:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043e1:	48 85 c0             	test   %rax,%rax
+  8043e4:	0f 84 85 00 00 00    	je     80446f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8043ea:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8043ee:	74 40                	je     804430 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f0:	48 83 c1 01          	add    $0x1,%rcx
+  8043f4:	48 39 c1             	cmp    %rax,%rcx
+  8043f7:	75 f1                	jne    8043ea <remove_pgfault_handler+0x35>
+  8043f9:	eb 74                	jmp    80446f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8043fb:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  804402:	00 00 00 
+  804405:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  80440c:	00 00 00 
+  80440f:	be 43 00 00 00       	mov    $0x43,%esi
+  804414:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80441b:	00 00 00 
+  80441e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804423:	49 b8 53 33 80 00 00 	movabs $0x803353,%r8
+  80442a:	00 00 00 
+  80442d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804430:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804437:	00 
+  804438:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80443c:	48 29 ca             	sub    %rcx,%rdx
+  80443f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804446:	00 00 00 
+  804449:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80444d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804452:	48 89 ce             	mov    %rcx,%rsi
+  804455:	48 b8 c2 3f 80 00 00 	movabs $0x803fc2,%rax
+  80445c:	00 00 00 
+  80445f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804461:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804468:	00 00 00 
+  80446b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80446f:	5d                   	pop    %rbp
+  804470:	c3                   	ret
+
+0000000000804471 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804471:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804474:	48 b8 ef 41 80 00 00 	movabs $0x8041ef,%rax
+  80447b:	00 00 00 
+    call *%rax
+  80447e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804480:	41 5f                	pop    %r15
+	popq %r15
+  804482:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804484:	41 5f                	pop    %r15
+	popq %r14
+  804486:	41 5e                	pop    %r14
+	popq %r13
+  804488:	41 5d                	pop    %r13
+	popq %r12
+  80448a:	41 5c                	pop    %r12
+	popq %r11
+  80448c:	41 5b                	pop    %r11
+	popq %r10
+  80448e:	41 5a                	pop    %r10
+	popq %r9
+  804490:	41 59                	pop    %r9
+	popq %r8
+  804492:	41 58                	pop    %r8
+	popq %rsi
+  804494:	5e                   	pop    %rsi
+	popq %rdi
+  804495:	5f                   	pop    %rdi
+	popq %rbp
+  804496:	5d                   	pop    %rbp
+	popq %rdx
+  804497:	5a                   	pop    %rdx
+	popq %rcx
+  804498:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804499:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80449e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044a3:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044a7:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044aa:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044af:	5b                   	pop    %rbx
+	popq %rax
+  8044b0:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044b1:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044b5:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044b6:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044bb:	c3                   	ret
+
+00000000008044bc <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044bc:	55                   	push   %rbp
+  8044bd:	48 89 e5             	mov    %rsp,%rbp
+  8044c0:	41 55                	push   %r13
+  8044c2:	41 54                	push   %r12
+  8044c4:	53                   	push   %rbx
+  8044c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8044c9:	49 89 fd             	mov    %rdi,%r13
+  8044cc:	48 89 f7             	mov    %rsi,%rdi
+  8044cf:	48 89 d3             	mov    %rdx,%rbx
+  8044d2:	49 89 cc             	mov    %rcx,%r12
+  8044d5:	4c 89 c2             	mov    %r8,%rdx
+  8044d8:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044db:	48 85 f6             	test   %rsi,%rsi
+  8044de:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044e5:	00 00 00 
+  8044e8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8044ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044f1:	48 85 db             	test   %rbx,%rbx
+  8044f4:	74 03                	je     8044f9 <ipc_recv_futex+0x3d>
+  8044f6:	48 8b 33             	mov    (%rbx),%rsi
+  8044f9:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8044fd:	48 b8 7f 04 80 00 00 	movabs $0x80047f,%rax
+  804504:	00 00 00 
+  804507:	ff d0                	call   *%rax
+    if (res < 0) {
+  804509:	85 c0                	test   %eax,%eax
+  80450b:	78 75                	js     804582 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80450d:	4d 85 ed             	test   %r13,%r13
+  804510:	74 14                	je     804526 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804512:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804519:	00 00 00 
+  80451c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804522:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804526:	4d 85 e4             	test   %r12,%r12
+  804529:	74 14                	je     80453f <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80452b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804532:	00 00 00 
+  804535:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80453b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80453f:	48 85 db             	test   %rbx,%rbx
+  804542:	74 23                	je     804567 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804544:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80454b:	00 00 00 
+  80454e:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804554:	ba 00 00 00 00       	mov    $0x0,%edx
+  804559:	85 c9                	test   %ecx,%ecx
+  80455b:	74 07                	je     804564 <ipc_recv_futex+0xa8>
+  80455d:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804564:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804567:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80456e:	00 00 00 
+  804571:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804577:	48 83 c4 08          	add    $0x8,%rsp
+  80457b:	5b                   	pop    %rbx
+  80457c:	41 5c                	pop    %r12
+  80457e:	41 5d                	pop    %r13
+  804580:	5d                   	pop    %rbp
+  804581:	c3                   	ret
+        if (from_env_store != NULL) {
+  804582:	4d 85 ed             	test   %r13,%r13
+  804585:	74 08                	je     80458f <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804587:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80458e:	00 
+        if (perm_store != NULL) {
+  80458f:	4d 85 e4             	test   %r12,%r12
+  804592:	74 08                	je     80459c <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804594:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80459b:	00 
+        if (size != NULL) {
+  80459c:	48 85 db             	test   %rbx,%rbx
+  80459f:	74 d6                	je     804577 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045a1:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045a8:	eb cd                	jmp    804577 <ipc_recv_futex+0xbb>
+
+00000000008045aa <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045aa:	55                   	push   %rbp
+  8045ab:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8045b2:	6a 00                	push   $0x0
+  8045b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045c0:	48 b8 bc 44 80 00 00 	movabs $0x8044bc,%rax
+  8045c7:	00 00 00 
+  8045ca:	ff d0                	call   *%rax
+}
+  8045cc:	c9                   	leave
+  8045cd:	c3                   	ret
+
+00000000008045ce <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045ce:	55                   	push   %rbp
+  8045cf:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045d2:	48 85 d2             	test   %rdx,%rdx
+  8045d5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045dc:	00 00 00 
+  8045df:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045e3:	89 f6                	mov    %esi,%esi
+  8045e5:	48 b8 68 04 80 00 00 	movabs $0x800468,%rax
+  8045ec:	00 00 00 
+  8045ef:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045f1:	85 c0                	test   %eax,%eax
+  8045f3:	78 02                	js     8045f7 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8045f5:	5d                   	pop    %rbp
+  8045f6:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8045f7:	89 c1                	mov    %eax,%ecx
+  8045f9:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  804600:	00 00 00 
+  804603:	be 50 00 00 00       	mov    $0x50,%esi
+  804608:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  80460f:	00 00 00 
+  804612:	b8 00 00 00 00       	mov    $0x0,%eax
+  804617:	49 b8 53 33 80 00 00 	movabs $0x803353,%r8
+  80461e:	00 00 00 
+  804621:	41 ff d0             	call   *%r8
+
+0000000000804624 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804624:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804629:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804630:	00 00 00 
+  804633:	48 89 d0             	mov    %rdx,%rax
+  804636:	48 c1 e0 04          	shl    $0x4,%rax
+  80463a:	48 29 d0             	sub    %rdx,%rax
+  80463d:	48 c1 e0 05          	shl    $0x5,%rax
+  804641:	48 01 c8             	add    %rcx,%rax
+  804644:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80464a:	39 f8                	cmp    %edi,%eax
+  80464c:	74 13                	je     804661 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80464e:	48 83 c2 01          	add    $0x1,%rdx
+  804652:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804659:	75 d8                	jne    804633 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80465b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804660:	c3                   	ret
+            return envs[i].env_id;
+  804661:	48 89 d0             	mov    %rdx,%rax
+  804664:	48 c1 e0 04          	shl    $0x4,%rax
+  804668:	48 29 d0             	sub    %rdx,%rax
+  80466b:	48 c1 e0 05          	shl    $0x5,%rax
+  80466f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804676:	00 00 00 
+  804679:	48 01 d0             	add    %rdx,%rax
+  80467c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804682:	c3                   	ret
+  804683:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804688 <__rodata_start>:
+  804688:	3c 75                	cmp    $0x75,%al
+  80468a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80468b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80468f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804690:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  804694:	1f                   	(bad)
+  804695:	44 00 00             	add    %r8b,(%rax)
+  804698:	73 79                	jae    804713 <__rodata_start+0x8b>
+  80469a:	73 63                	jae    8046ff <__rodata_start+0x77>
+  80469c:	61                   	(bad)
+  80469d:	6c                   	insb   (%dx),%es:(%rdi)
+  80469e:	6c                   	insb   (%dx),%es:(%rdi)
+  80469f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab1f <__bss_end+0x721c8b1f>
+  8046a5:	65 74 75             	gs je  80471d <__rodata_start+0x95>
+  8046a8:	72 6e                	jb     804718 <__rodata_start+0x90>
+  8046aa:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab2c <__bss_end+0x281c8b2c>
+  8046b1:	28 
+  8046b2:	3e 20 30             	ds and %dh,(%rax)
+  8046b5:	29 00                	sub    %eax,(%rax)
+  8046b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8046b8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046bf:	61                   	(bad)
+  8046c0:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c2:	2e 63 00             	cs movsxd (%rax),%eax
+  8046c5:	0f 1f 00             	nopl   (%rax)
+  8046c8:	5b                   	pop    %rbx
+  8046c9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ce:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046d1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046d6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046da:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046e1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80514c <__ctors_end+0x6c>
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ee:	20 66 74             	and    %ah,0x74(%rsi)
+  8046f1:	72 75                	jb     804768 <devtab+0x8>
+  8046f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046f4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8046f7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad6762 <__bss_end+0x2d294762>
+  8046fe:	20 62 61             	and    %ah,0x61(%rdx)
+  804701:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804705:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804709:	5b                   	pop    %rbx
+  80470a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80470f:	20 72 65             	and    %dh,0x65(%rdx)
+  804712:	61                   	(bad)
+  804713:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad677e <__bss_end+0x2d29477e>
+  80471a:	20 62 61             	and    %ah,0x61(%rdx)
+  80471d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804721:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804725:	5b                   	pop    %rbx
+  804726:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80472b:	20 77 72             	and    %dh,0x72(%rdi)
+  80472e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  804735:	2d 
+  804736:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80473b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80473e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	90 36 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	c1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	d1 3c 80 00 00 00 00 00 af 36 80 00 00 00 00 00     .<.......6......
+  804a00:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	a3 36 80 00 00 00 00 00 1d 37 80 00 00 00 00 00     .6.......7......
+  804a20:	d1 3c 80 00 00 00 00 00 a3 36 80 00 00 00 00 00     .<.......6......
+  804a30:	e9 36 80 00 00 00 00 00 e9 36 80 00 00 00 00 00     .6.......6......
+  804a40:	e9 36 80 00 00 00 00 00 e9 36 80 00 00 00 00 00     .6.......6......
+  804a50:	e9 36 80 00 00 00 00 00 e9 36 80 00 00 00 00 00     .6.......6......
+  804a60:	e9 36 80 00 00 00 00 00 e9 36 80 00 00 00 00 00     .6.......6......
+  804a70:	e9 36 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .6.......<......
+  804a80:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	d1 3c 80 00 00 00 00 00 f4 3b 80 00 00 00 00 00     .<.......;......
+  804b70:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	40 37 80 00 00 00 00 00 0f 39 80 00 00 00 00 00     @7.......9......
+  804bd0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	6f 37 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     o7.......<......
+  804c00:	d1 3c 80 00 00 00 00 00 35 37 80 00 00 00 00 00     .<......57......
+  804c10:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	b7 3a 80 00 00 00 00 00 81 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	d1 3c 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	06 38 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .8.......<......
+  804c50:	e3 39 80 00 00 00 00 00 d1 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	d1 3c 80 00 00 00 00 00 f4 3b 80 00 00 00 00 00     .<.......;......
+  804c70:	d1 3c 80 00 00 00 00 00 99 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,7880 @@
+
+obj/user/buggyhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1e 00 00 00       	call   800041 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs((char *)1, 1);
+  800029:	be 01 00 00 00       	mov    $0x1,%esi
+  80002e:	bf 01 00 00 00       	mov    $0x1,%edi
+  800033:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  80003a:	00 00 00 
+  80003d:	ff d0                	call   *%rax
+}
+  80003f:	5d                   	pop    %rbp
+  800040:	c3                   	ret
+
+0000000000800041 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800041:	55                   	push   %rbp
+  800042:	48 89 e5             	mov    %rsp,%rbp
+  800045:	41 56                	push   %r14
+  800047:	41 55                	push   %r13
+  800049:	41 54                	push   %r12
+  80004b:	53                   	push   %rbx
+  80004c:	41 89 fd             	mov    %edi,%r13d
+  80004f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800052:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800059:	00 00 00 
+  80005c:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800063:	00 00 00 
+  800066:	48 39 c2             	cmp    %rax,%rdx
+  800069:	73 17                	jae    800082 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80006b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80006e:	49 89 c4             	mov    %rax,%r12
+  800071:	48 83 c3 08          	add    $0x8,%rbx
+  800075:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007a:	ff 53 f8             	call   *-0x8(%rbx)
+  80007d:	4c 39 e3             	cmp    %r12,%rbx
+  800080:	72 ef                	jb     800071 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800082:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  800089:	00 00 00 
+  80008c:	ff d0                	call   *%rax
+  80008e:	89 c2                	mov    %eax,%edx
+  800090:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800096:	48 89 d0             	mov    %rdx,%rax
+  800099:	48 c1 e0 04          	shl    $0x4,%rax
+  80009d:	48 29 d0             	sub    %rdx,%rax
+  8000a0:	48 c1 e0 05          	shl    $0x5,%rax
+  8000a4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ab:	00 00 00 
+  8000ae:	48 01 d0             	add    %rdx,%rax
+  8000b1:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000b8:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000bb:	45 85 ed             	test   %r13d,%r13d
+  8000be:	7e 0d                	jle    8000cd <libmain+0x8c>
+  8000c0:	49 8b 06             	mov    (%r14),%rax
+  8000c3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ca:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000cd:	4c 89 f6             	mov    %r14,%rsi
+  8000d0:	44 89 ef             	mov    %r13d,%edi
+  8000d3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000da:	00 00 00 
+  8000dd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000df:	48 b8 f4 00 80 00 00 	movabs $0x8000f4,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+#endif
+}
+  8000eb:	5b                   	pop    %rbx
+  8000ec:	41 5c                	pop    %r12
+  8000ee:	41 5d                	pop    %r13
+  8000f0:	41 5e                	pop    %r14
+  8000f2:	5d                   	pop    %rbp
+  8000f3:	c3                   	ret
+
+00000000008000f4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f4:	55                   	push   %rbp
+  8000f5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000f8:	48 b8 a8 08 80 00 00 	movabs $0x8008a8,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800104:	bf 00 00 00 00       	mov    $0x0,%edi
+  800109:	48 b8 5f 01 80 00 00 	movabs $0x80015f,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+}
+  800115:	5d                   	pop    %rbp
+  800116:	c3                   	ret
+
+0000000000800117 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800117:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80011c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800121:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800127:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80012d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800133:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800135:	c3                   	ret
+
+0000000000800136 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800136:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80013b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800140:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80015c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80015e:	c3                   	ret
+
+000000000080015f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80015f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800162:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800167:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80016c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800171:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800177:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80017d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800183:	0f 05                	syscall
+    if (check && ret > 0) {
+  800185:	48 85 c0             	test   %rax,%rax
+  800188:	7f 01                	jg     80018b <sys_env_destroy+0x2c>
+}
+  80018a:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80018f:	49 89 c0             	mov    %rax,%r8
+  800192:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800197:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  80019e:	00 00 00 
+  8001a1:	be 29 00 00 00       	mov    $0x29,%esi
+  8001a6:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  8001ad:	00 00 00 
+  8001b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001b5:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  8001bc:	00 00 00 
+  8001bf:	41 ff d1             	call   *%r9
+
+00000000008001c2 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001c2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001cc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001e8:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ea:	c3                   	ret
+
+00000000008001eb <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001eb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ff:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800205:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80020b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800211:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800213:	c3                   	ret
+
+0000000000800214 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800214:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800219:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800220:	00 00 00 
+  800223:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80022f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800235:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800237:	c3                   	ret
+
+0000000000800238 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800238:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80023b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80024c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80024e:	c3                   	ret
+
+000000000080024f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80024f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800252:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800257:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80025a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800260:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800266:	0f 05                	syscall
+    if (check && ret > 0) {
+  800268:	48 85 c0             	test   %rax,%rax
+  80026b:	7f 01                	jg     80026e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80026d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80026e:	55                   	push   %rbp
+  80026f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800272:	49 89 c0             	mov    %rax,%r8
+  800275:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80027a:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  800281:	00 00 00 
+  800284:	be 29 00 00 00       	mov    $0x29,%esi
+  800289:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  800290:	00 00 00 
+  800293:	b8 00 00 00 00       	mov    $0x0,%eax
+  800298:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  80029f:	00 00 00 
+  8002a2:	41 ff d1             	call   *%r9
+
+00000000008002a5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002a5:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002a8:	48 63 d2             	movslq %edx,%rdx
+  8002ab:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002ae:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002b3:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002b6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002b8:	48 85 c0             	test   %rax,%rax
+  8002bb:	7f 01                	jg     8002be <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002bd:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002be:	55                   	push   %rbp
+  8002bf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002c2:	49 89 c0             	mov    %rax,%r8
+  8002c5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002ca:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  8002d1:	00 00 00 
+  8002d4:	be 29 00 00 00       	mov    $0x29,%esi
+  8002d9:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  8002e0:	00 00 00 
+  8002e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e8:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  8002ef:	00 00 00 
+  8002f2:	41 ff d1             	call   *%r9
+
+00000000008002f5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002f5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002f8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800303:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800309:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80030f:	0f 05                	syscall
+    if (check && ret > 0) {
+  800311:	48 85 c0             	test   %rax,%rax
+  800314:	7f 01                	jg     800317 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800316:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800317:	55                   	push   %rbp
+  800318:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80031b:	49 89 c0             	mov    %rax,%r8
+  80031e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800323:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  80032a:	00 00 00 
+  80032d:	be 29 00 00 00       	mov    $0x29,%esi
+  800332:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  800339:	00 00 00 
+  80033c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800341:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  800348:	00 00 00 
+  80034b:	41 ff d1             	call   *%r9
+
+000000000080034e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80034e:	48 63 f6             	movslq %esi,%rsi
+  800351:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800354:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800359:	ba 00 00 00 00       	mov    $0x0,%edx
+  80035e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800364:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80036a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800370:	0f 05                	syscall
+    if (check && ret > 0) {
+  800372:	48 85 c0             	test   %rax,%rax
+  800375:	7f 01                	jg     800378 <sys_env_set_status+0x2a>
+}
+  800377:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800378:	55                   	push   %rbp
+  800379:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80037c:	49 89 c0             	mov    %rax,%r8
+  80037f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800384:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  80038b:	00 00 00 
+  80038e:	be 29 00 00 00       	mov    $0x29,%esi
+  800393:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  80039a:	00 00 00 
+  80039d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a2:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  8003a9:	00 00 00 
+  8003ac:	41 ff d1             	call   *%r9
+
+00000000008003af <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003af:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003b2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003bc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003ce:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003d0:	48 85 c0             	test   %rax,%rax
+  8003d3:	7f 01                	jg     8003d6 <sys_env_set_trapframe+0x27>
+}
+  8003d5:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003d6:	55                   	push   %rbp
+  8003d7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003da:	49 89 c0             	mov    %rax,%r8
+  8003dd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003e2:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  8003e9:	00 00 00 
+  8003ec:	be 29 00 00 00       	mov    $0x29,%esi
+  8003f1:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  8003f8:	00 00 00 
+  8003fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800400:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  800407:	00 00 00 
+  80040a:	41 ff d1             	call   *%r9
+
+000000000080040d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80040d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800410:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800415:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800420:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800426:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80042c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80042e:	48 85 c0             	test   %rax,%rax
+  800431:	7f 01                	jg     800434 <sys_env_set_pgfault_upcall+0x27>
+}
+  800433:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800438:	49 89 c0             	mov    %rax,%r8
+  80043b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800440:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  800447:	00 00 00 
+  80044a:	be 29 00 00 00       	mov    $0x29,%esi
+  80044f:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  800456:	00 00 00 
+  800459:	b8 00 00 00 00       	mov    $0x0,%eax
+  80045e:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  800465:	00 00 00 
+  800468:	41 ff d1             	call   *%r9
+
+000000000080046b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80046b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80046e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800471:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800476:	4d 63 c0             	movslq %r8d,%r8
+  800479:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80047f:	0f 05                	syscall
+}
+  800481:	c3                   	ret
+
+0000000000800482 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800482:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800485:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800488:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80048d:	4d 63 c0             	movslq %r8d,%r8
+  800490:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800496:	0f 05                	syscall
+}
+  800498:	c3                   	ret
+
+0000000000800499 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  800499:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80049e:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004a1:	45 89 c0             	mov    %r8d,%r8d
+  8004a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004aa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004ac:	48 85 c0             	test   %rax,%rax
+  8004af:	7f 01                	jg     8004b2 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004b1:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004b2:	55                   	push   %rbp
+  8004b3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004b6:	49 89 c0             	mov    %rax,%r8
+  8004b9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004be:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  8004c5:	00 00 00 
+  8004c8:	be 29 00 00 00       	mov    $0x29,%esi
+  8004cd:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  8004d4:	00 00 00 
+  8004d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004dc:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  8004e3:	00 00 00 
+  8004e6:	41 ff d1             	call   *%r9
+
+00000000008004e9 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004e9:	55                   	push   %rbp
+  8004ea:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004fd:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  800504:	00 00 00 
+  800507:	ff d0                	call   *%rax
+}
+  800509:	5d                   	pop    %rbp
+  80050a:	c3                   	ret
+
+000000000080050b <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80050b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800510:	bf 00 00 00 00       	mov    $0x0,%edi
+  800515:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80051a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80051f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80052b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800531:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800533:	c3                   	ret
+
+0000000000800534 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800534:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800539:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80053e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800543:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800549:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80054f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800555:	0f 05                	syscall
+    if (check && ret > 0) {
+  800557:	48 85 c0             	test   %rax,%rax
+  80055a:	7f 01                	jg     80055d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80055c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80055d:	55                   	push   %rbp
+  80055e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800561:	49 89 c0             	mov    %rax,%r8
+  800564:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800569:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  800570:	00 00 00 
+  800573:	be 29 00 00 00       	mov    $0x29,%esi
+  800578:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  80057f:	00 00 00 
+  800582:	b8 00 00 00 00       	mov    $0x0,%eax
+  800587:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  80058e:	00 00 00 
+  800591:	41 ff d1             	call   *%r9
+
+0000000000800594 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  800594:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800599:	bf 00 00 00 00       	mov    $0x0,%edi
+  80059e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ba:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005bc:	c3                   	ret
+
+00000000008005bd <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005bd:	89 d2                	mov    %edx,%edx
+  8005bf:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005d8:	0f 05                	syscall
+}
+  8005da:	c3                   	ret
+
+00000000008005db <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005db:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005de:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005fa:	0f 05                	syscall
+}
+  8005fc:	c3                   	ret
+
+00000000008005fd <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005fd:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800600:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800605:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800610:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800616:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80061c:	0f 05                	syscall
+}
+  80061e:	c3                   	ret
+
+000000000080061f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80061f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800622:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800627:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80062c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800631:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80063d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800643:	0f 05                	syscall
+    if (check && ret > 0) {
+  800645:	48 85 c0             	test   %rax,%rax
+  800648:	7f 01                	jg     80064b <sys_irq_ack+0x2c>
+}
+  80064a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80064b:	55                   	push   %rbp
+  80064c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80064f:	49 89 c0             	mov    %rax,%r8
+  800652:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800657:	48 ba b0 46 80 00 00 	movabs $0x8046b0,%rdx
+  80065e:	00 00 00 
+  800661:	be 29 00 00 00       	mov    $0x29,%esi
+  800666:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  80066d:	00 00 00 
+  800670:	b8 00 00 00 00       	mov    $0x0,%eax
+  800675:	49 b9 6d 33 80 00 00 	movabs $0x80336d,%r9
+  80067c:	00 00 00 
+  80067f:	41 ff d1             	call   *%r9
+
+0000000000800682 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800682:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800689:	ff ff ff 
+  80068c:	48 01 f8             	add    %rdi,%rax
+  80068f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800693:	c3                   	ret
+
+0000000000800694 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800694:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80069b:	ff ff ff 
+  80069e:	48 01 f8             	add    %rdi,%rax
+  8006a1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006a5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ab:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006af:	c3                   	ret
+
+00000000008006b0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006b0:	55                   	push   %rbp
+  8006b1:	48 89 e5             	mov    %rsp,%rbp
+  8006b4:	41 57                	push   %r15
+  8006b6:	41 56                	push   %r14
+  8006b8:	41 55                	push   %r13
+  8006ba:	41 54                	push   %r12
+  8006bc:	53                   	push   %rbx
+  8006bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c1:	49 89 ff             	mov    %rdi,%r15
+  8006c4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c9:	49 bd 3f 2e 80 00 00 	movabs $0x802e3f,%r13
+  8006d0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006d3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006d9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006dc:	48 89 df             	mov    %rbx,%rdi
+  8006df:	41 ff d5             	call   *%r13
+  8006e2:	83 e0 04             	and    $0x4,%eax
+  8006e5:	74 17                	je     8006fe <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006e7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006ee:	4c 39 f3             	cmp    %r14,%rbx
+  8006f1:	75 e6                	jne    8006d9 <fd_alloc+0x29>
+  8006f3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006f9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006fe:	4d 89 27             	mov    %r12,(%r15)
+}
+  800701:	48 83 c4 08          	add    $0x8,%rsp
+  800705:	5b                   	pop    %rbx
+  800706:	41 5c                	pop    %r12
+  800708:	41 5d                	pop    %r13
+  80070a:	41 5e                	pop    %r14
+  80070c:	41 5f                	pop    %r15
+  80070e:	5d                   	pop    %rbp
+  80070f:	c3                   	ret
+
+0000000000800710 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800710:	83 ff 1f             	cmp    $0x1f,%edi
+  800713:	77 39                	ja     80074e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800715:	55                   	push   %rbp
+  800716:	48 89 e5             	mov    %rsp,%rbp
+  800719:	41 54                	push   %r12
+  80071b:	53                   	push   %rbx
+  80071c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80071f:	48 63 df             	movslq %edi,%rbx
+  800722:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800729:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80072d:	48 89 df             	mov    %rbx,%rdi
+  800730:	48 b8 3f 2e 80 00 00 	movabs $0x802e3f,%rax
+  800737:	00 00 00 
+  80073a:	ff d0                	call   *%rax
+  80073c:	a8 04                	test   $0x4,%al
+  80073e:	74 14                	je     800754 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800740:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800744:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800749:	5b                   	pop    %rbx
+  80074a:	41 5c                	pop    %r12
+  80074c:	5d                   	pop    %rbp
+  80074d:	c3                   	ret
+        return -E_INVAL;
+  80074e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800753:	c3                   	ret
+        return -E_INVAL;
+  800754:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800759:	eb ee                	jmp    800749 <fd_lookup+0x39>
+
+000000000080075b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80075b:	55                   	push   %rbp
+  80075c:	48 89 e5             	mov    %rsp,%rbp
+  80075f:	41 54                	push   %r12
+  800761:	53                   	push   %rbx
+  800762:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800765:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  80076c:	00 00 00 
+  80076f:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800776:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800779:	39 3b                	cmp    %edi,(%rbx)
+  80077b:	74 47                	je     8007c4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80077d:	48 83 c0 08          	add    $0x8,%rax
+  800781:	48 8b 18             	mov    (%rax),%rbx
+  800784:	48 85 db             	test   %rbx,%rbx
+  800787:	75 f0                	jne    800779 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800789:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800790:	00 00 00 
+  800793:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800799:	89 fa                	mov    %edi,%edx
+  80079b:	48 bf e0 46 80 00 00 	movabs $0x8046e0,%rdi
+  8007a2:	00 00 00 
+  8007a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007aa:	48 b9 bd 34 80 00 00 	movabs $0x8034bd,%rcx
+  8007b1:	00 00 00 
+  8007b4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007bb:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007bf:	5b                   	pop    %rbx
+  8007c0:	41 5c                	pop    %r12
+  8007c2:	5d                   	pop    %rbp
+  8007c3:	c3                   	ret
+            return 0;
+  8007c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c9:	eb f0                	jmp    8007bb <dev_lookup+0x60>
+
+00000000008007cb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007cb:	55                   	push   %rbp
+  8007cc:	48 89 e5             	mov    %rsp,%rbp
+  8007cf:	41 55                	push   %r13
+  8007d1:	41 54                	push   %r12
+  8007d3:	53                   	push   %rbx
+  8007d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8007d8:	48 89 fb             	mov    %rdi,%rbx
+  8007db:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007de:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007e5:	ff ff ff 
+  8007e8:	48 01 df             	add    %rbx,%rdi
+  8007eb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007ef:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007f3:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  8007fa:	00 00 00 
+  8007fd:	ff d0                	call   *%rax
+  8007ff:	41 89 c5             	mov    %eax,%r13d
+  800802:	85 c0                	test   %eax,%eax
+  800804:	78 06                	js     80080c <fd_close+0x41>
+  800806:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80080a:	74 1a                	je     800826 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80080c:	45 84 e4             	test   %r12b,%r12b
+  80080f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800814:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800818:	44 89 e8             	mov    %r13d,%eax
+  80081b:	48 83 c4 18          	add    $0x18,%rsp
+  80081f:	5b                   	pop    %rbx
+  800820:	41 5c                	pop    %r12
+  800822:	41 5d                	pop    %r13
+  800824:	5d                   	pop    %rbp
+  800825:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800826:	8b 3b                	mov    (%rbx),%edi
+  800828:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80082c:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800833:	00 00 00 
+  800836:	ff d0                	call   *%rax
+  800838:	41 89 c5             	mov    %eax,%r13d
+  80083b:	85 c0                	test   %eax,%eax
+  80083d:	78 1b                	js     80085a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80083f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800843:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800847:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80084d:	48 85 c0             	test   %rax,%rax
+  800850:	74 08                	je     80085a <fd_close+0x8f>
+  800852:	48 89 df             	mov    %rbx,%rdi
+  800855:	ff d0                	call   *%rax
+  800857:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80085a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80085f:	48 89 de             	mov    %rbx,%rsi
+  800862:	bf 00 00 00 00       	mov    $0x0,%edi
+  800867:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  80086e:	00 00 00 
+  800871:	ff d0                	call   *%rax
+    return res;
+  800873:	eb a3                	jmp    800818 <fd_close+0x4d>
+
+0000000000800875 <close>:
+
+int
+close(int fdnum) {
+  800875:	55                   	push   %rbp
+  800876:	48 89 e5             	mov    %rsp,%rbp
+  800879:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80087d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800881:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800888:	00 00 00 
+  80088b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80088d:	85 c0                	test   %eax,%eax
+  80088f:	78 15                	js     8008a6 <close+0x31>
+
+    return fd_close(fd, 1);
+  800891:	be 01 00 00 00       	mov    $0x1,%esi
+  800896:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80089a:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  8008a1:	00 00 00 
+  8008a4:	ff d0                	call   *%rax
+}
+  8008a6:	c9                   	leave
+  8008a7:	c3                   	ret
+
+00000000008008a8 <close_all>:
+
+void
+close_all(void) {
+  8008a8:	55                   	push   %rbp
+  8008a9:	48 89 e5             	mov    %rsp,%rbp
+  8008ac:	41 54                	push   %r12
+  8008ae:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008af:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b4:	49 bc 75 08 80 00 00 	movabs $0x800875,%r12
+  8008bb:	00 00 00 
+  8008be:	89 df                	mov    %ebx,%edi
+  8008c0:	41 ff d4             	call   *%r12
+  8008c3:	83 c3 01             	add    $0x1,%ebx
+  8008c6:	83 fb 20             	cmp    $0x20,%ebx
+  8008c9:	75 f3                	jne    8008be <close_all+0x16>
+}
+  8008cb:	5b                   	pop    %rbx
+  8008cc:	41 5c                	pop    %r12
+  8008ce:	5d                   	pop    %rbp
+  8008cf:	c3                   	ret
+
+00000000008008d0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008d0:	55                   	push   %rbp
+  8008d1:	48 89 e5             	mov    %rsp,%rbp
+  8008d4:	41 57                	push   %r15
+  8008d6:	41 56                	push   %r14
+  8008d8:	41 55                	push   %r13
+  8008da:	41 54                	push   %r12
+  8008dc:	53                   	push   %rbx
+  8008dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8008e1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008e4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008e8:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  8008ef:	00 00 00 
+  8008f2:	ff d0                	call   *%rax
+  8008f4:	89 c3                	mov    %eax,%ebx
+  8008f6:	85 c0                	test   %eax,%eax
+  8008f8:	0f 88 b8 00 00 00    	js     8009b6 <dup+0xe6>
+    close(newfdnum);
+  8008fe:	44 89 e7             	mov    %r12d,%edi
+  800901:	48 b8 75 08 80 00 00 	movabs $0x800875,%rax
+  800908:	00 00 00 
+  80090b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80090d:	4d 63 ec             	movslq %r12d,%r13
+  800910:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800917:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80091b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80091f:	4c 89 ff             	mov    %r15,%rdi
+  800922:	49 be 94 06 80 00 00 	movabs $0x800694,%r14
+  800929:	00 00 00 
+  80092c:	41 ff d6             	call   *%r14
+  80092f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800932:	4c 89 ef             	mov    %r13,%rdi
+  800935:	41 ff d6             	call   *%r14
+  800938:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80093b:	48 89 df             	mov    %rbx,%rdi
+  80093e:	48 b8 3f 2e 80 00 00 	movabs $0x802e3f,%rax
+  800945:	00 00 00 
+  800948:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80094a:	a8 04                	test   $0x4,%al
+  80094c:	74 2b                	je     800979 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80094e:	41 89 c1             	mov    %eax,%r9d
+  800951:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800957:	4c 89 f1             	mov    %r14,%rcx
+  80095a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095f:	48 89 de             	mov    %rbx,%rsi
+  800962:	bf 00 00 00 00       	mov    $0x0,%edi
+  800967:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  80096e:	00 00 00 
+  800971:	ff d0                	call   *%rax
+  800973:	89 c3                	mov    %eax,%ebx
+  800975:	85 c0                	test   %eax,%eax
+  800977:	78 4e                	js     8009c7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800979:	4c 89 ff             	mov    %r15,%rdi
+  80097c:	48 b8 3f 2e 80 00 00 	movabs $0x802e3f,%rax
+  800983:	00 00 00 
+  800986:	ff d0                	call   *%rax
+  800988:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80098b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800991:	4c 89 e9             	mov    %r13,%rcx
+  800994:	ba 00 00 00 00       	mov    $0x0,%edx
+  800999:	4c 89 fe             	mov    %r15,%rsi
+  80099c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a1:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  8009a8:	00 00 00 
+  8009ab:	ff d0                	call   *%rax
+  8009ad:	89 c3                	mov    %eax,%ebx
+  8009af:	85 c0                	test   %eax,%eax
+  8009b1:	78 14                	js     8009c7 <dup+0xf7>
+
+    return newfdnum;
+  8009b3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009b6:	89 d8                	mov    %ebx,%eax
+  8009b8:	48 83 c4 18          	add    $0x18,%rsp
+  8009bc:	5b                   	pop    %rbx
+  8009bd:	41 5c                	pop    %r12
+  8009bf:	41 5d                	pop    %r13
+  8009c1:	41 5e                	pop    %r14
+  8009c3:	41 5f                	pop    %r15
+  8009c5:	5d                   	pop    %rbp
+  8009c6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009c7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009cc:	4c 89 ee             	mov    %r13,%rsi
+  8009cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d4:	49 bc f5 02 80 00 00 	movabs $0x8002f5,%r12
+  8009db:	00 00 00 
+  8009de:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009e6:	4c 89 f6             	mov    %r14,%rsi
+  8009e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009ee:	41 ff d4             	call   *%r12
+    return res;
+  8009f1:	eb c3                	jmp    8009b6 <dup+0xe6>
+
+00000000008009f3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009f3:	55                   	push   %rbp
+  8009f4:	48 89 e5             	mov    %rsp,%rbp
+  8009f7:	41 56                	push   %r14
+  8009f9:	41 55                	push   %r13
+  8009fb:	41 54                	push   %r12
+  8009fd:	53                   	push   %rbx
+  8009fe:	48 83 ec 10          	sub    $0x10,%rsp
+  800a02:	89 fb                	mov    %edi,%ebx
+  800a04:	49 89 f4             	mov    %rsi,%r12
+  800a07:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a0a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a0e:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800a15:	00 00 00 
+  800a18:	ff d0                	call   *%rax
+  800a1a:	85 c0                	test   %eax,%eax
+  800a1c:	78 4c                	js     800a6a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a1e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a22:	41 8b 3e             	mov    (%r14),%edi
+  800a25:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a29:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800a30:	00 00 00 
+  800a33:	ff d0                	call   *%rax
+  800a35:	85 c0                	test   %eax,%eax
+  800a37:	78 35                	js     800a6e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a39:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a3d:	83 e0 03             	and    $0x3,%eax
+  800a40:	83 f8 01             	cmp    $0x1,%eax
+  800a43:	74 2d                	je     800a72 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a45:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a49:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a4d:	48 85 c0             	test   %rax,%rax
+  800a50:	74 56                	je     800aa8 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a52:	4c 89 ea             	mov    %r13,%rdx
+  800a55:	4c 89 e6             	mov    %r12,%rsi
+  800a58:	4c 89 f7             	mov    %r14,%rdi
+  800a5b:	ff d0                	call   *%rax
+}
+  800a5d:	48 83 c4 10          	add    $0x10,%rsp
+  800a61:	5b                   	pop    %rbx
+  800a62:	41 5c                	pop    %r12
+  800a64:	41 5d                	pop    %r13
+  800a66:	41 5e                	pop    %r14
+  800a68:	5d                   	pop    %rbp
+  800a69:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a6a:	48 98                	cltq
+  800a6c:	eb ef                	jmp    800a5d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a6e:	48 98                	cltq
+  800a70:	eb eb                	jmp    800a5d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a72:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a79:	00 00 00 
+  800a7c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a82:	89 da                	mov    %ebx,%edx
+  800a84:	48 bf 21 47 80 00 00 	movabs $0x804721,%rdi
+  800a8b:	00 00 00 
+  800a8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a93:	48 b9 bd 34 80 00 00 	movabs $0x8034bd,%rcx
+  800a9a:	00 00 00 
+  800a9d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a9f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800aa6:	eb b5                	jmp    800a5d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aa8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800aaf:	eb ac                	jmp    800a5d <read+0x6a>
+
+0000000000800ab1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	41 57                	push   %r15
+  800ab7:	41 56                	push   %r14
+  800ab9:	41 55                	push   %r13
+  800abb:	41 54                	push   %r12
+  800abd:	53                   	push   %rbx
+  800abe:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ac2:	48 85 d2             	test   %rdx,%rdx
+  800ac5:	74 54                	je     800b1b <readn+0x6a>
+  800ac7:	41 89 fd             	mov    %edi,%r13d
+  800aca:	49 89 f6             	mov    %rsi,%r14
+  800acd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ad0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ad5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ada:	49 bf f3 09 80 00 00 	movabs $0x8009f3,%r15
+  800ae1:	00 00 00 
+  800ae4:	4c 89 e2             	mov    %r12,%rdx
+  800ae7:	48 29 f2             	sub    %rsi,%rdx
+  800aea:	4c 01 f6             	add    %r14,%rsi
+  800aed:	44 89 ef             	mov    %r13d,%edi
+  800af0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800af3:	85 c0                	test   %eax,%eax
+  800af5:	78 20                	js     800b17 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800af7:	01 c3                	add    %eax,%ebx
+  800af9:	85 c0                	test   %eax,%eax
+  800afb:	74 08                	je     800b05 <readn+0x54>
+  800afd:	48 63 f3             	movslq %ebx,%rsi
+  800b00:	4c 39 e6             	cmp    %r12,%rsi
+  800b03:	72 df                	jb     800ae4 <readn+0x33>
+    }
+    return res;
+  800b05:	48 63 c3             	movslq %ebx,%rax
+}
+  800b08:	48 83 c4 08          	add    $0x8,%rsp
+  800b0c:	5b                   	pop    %rbx
+  800b0d:	41 5c                	pop    %r12
+  800b0f:	41 5d                	pop    %r13
+  800b11:	41 5e                	pop    %r14
+  800b13:	41 5f                	pop    %r15
+  800b15:	5d                   	pop    %rbp
+  800b16:	c3                   	ret
+        if (inc < 0) return inc;
+  800b17:	48 98                	cltq
+  800b19:	eb ed                	jmp    800b08 <readn+0x57>
+    int inc = 1, res = 0;
+  800b1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b20:	eb e3                	jmp    800b05 <readn+0x54>
+
+0000000000800b22 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b22:	55                   	push   %rbp
+  800b23:	48 89 e5             	mov    %rsp,%rbp
+  800b26:	41 56                	push   %r14
+  800b28:	41 55                	push   %r13
+  800b2a:	41 54                	push   %r12
+  800b2c:	53                   	push   %rbx
+  800b2d:	48 83 ec 10          	sub    $0x10,%rsp
+  800b31:	89 fb                	mov    %edi,%ebx
+  800b33:	49 89 f4             	mov    %rsi,%r12
+  800b36:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b39:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b3d:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800b44:	00 00 00 
+  800b47:	ff d0                	call   *%rax
+  800b49:	85 c0                	test   %eax,%eax
+  800b4b:	78 47                	js     800b94 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b4d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b51:	41 8b 3e             	mov    (%r14),%edi
+  800b54:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b58:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800b5f:	00 00 00 
+  800b62:	ff d0                	call   *%rax
+  800b64:	85 c0                	test   %eax,%eax
+  800b66:	78 30                	js     800b98 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b68:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b6d:	74 2d                	je     800b9c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b6f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b73:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b77:	48 85 c0             	test   %rax,%rax
+  800b7a:	74 56                	je     800bd2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b7c:	4c 89 ea             	mov    %r13,%rdx
+  800b7f:	4c 89 e6             	mov    %r12,%rsi
+  800b82:	4c 89 f7             	mov    %r14,%rdi
+  800b85:	ff d0                	call   *%rax
+}
+  800b87:	48 83 c4 10          	add    $0x10,%rsp
+  800b8b:	5b                   	pop    %rbx
+  800b8c:	41 5c                	pop    %r12
+  800b8e:	41 5d                	pop    %r13
+  800b90:	41 5e                	pop    %r14
+  800b92:	5d                   	pop    %rbp
+  800b93:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b94:	48 98                	cltq
+  800b96:	eb ef                	jmp    800b87 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b98:	48 98                	cltq
+  800b9a:	eb eb                	jmp    800b87 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b9c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ba3:	00 00 00 
+  800ba6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800bac:	89 da                	mov    %ebx,%edx
+  800bae:	48 bf 3d 47 80 00 00 	movabs $0x80473d,%rdi
+  800bb5:	00 00 00 
+  800bb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bbd:	48 b9 bd 34 80 00 00 	movabs $0x8034bd,%rcx
+  800bc4:	00 00 00 
+  800bc7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bc9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bd0:	eb b5                	jmp    800b87 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bd2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bd9:	eb ac                	jmp    800b87 <write+0x65>
+
+0000000000800bdb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bdb:	55                   	push   %rbp
+  800bdc:	48 89 e5             	mov    %rsp,%rbp
+  800bdf:	41 54                	push   %r12
+  800be1:	53                   	push   %rbx
+  800be2:	48 83 ec 10          	sub    $0x10,%rsp
+  800be6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800be8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bec:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+  800bf8:	85 c0                	test   %eax,%eax
+  800bfa:	78 3e                	js     800c3a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bfc:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c00:	41 8b 3c 24          	mov    (%r12),%edi
+  800c04:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c08:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800c0f:	00 00 00 
+  800c12:	ff d0                	call   *%rax
+  800c14:	85 c0                	test   %eax,%eax
+  800c16:	78 22                	js     800c3a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c18:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c1c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c20:	48 85 c0             	test   %rax,%rax
+  800c23:	74 0b                	je     800c30 <seek+0x55>
+  800c25:	89 de                	mov    %ebx,%esi
+  800c27:	4c 89 e7             	mov    %r12,%rdi
+  800c2a:	ff d0                	call   *%rax
+  800c2c:	85 c0                	test   %eax,%eax
+  800c2e:	78 0a                	js     800c3a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c30:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c3a:	48 83 c4 10          	add    $0x10,%rsp
+  800c3e:	5b                   	pop    %rbx
+  800c3f:	41 5c                	pop    %r12
+  800c41:	5d                   	pop    %rbp
+  800c42:	c3                   	ret
+
+0000000000800c43 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c43:	55                   	push   %rbp
+  800c44:	48 89 e5             	mov    %rsp,%rbp
+  800c47:	41 55                	push   %r13
+  800c49:	41 54                	push   %r12
+  800c4b:	53                   	push   %rbx
+  800c4c:	48 83 ec 18          	sub    $0x18,%rsp
+  800c50:	89 fb                	mov    %edi,%ebx
+  800c52:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c55:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c59:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800c60:	00 00 00 
+  800c63:	ff d0                	call   *%rax
+  800c65:	85 c0                	test   %eax,%eax
+  800c67:	78 38                	js     800ca1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c69:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c6d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c71:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c75:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800c7c:	00 00 00 
+  800c7f:	ff d0                	call   *%rax
+  800c81:	85 c0                	test   %eax,%eax
+  800c83:	78 1c                	js     800ca1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c85:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c8a:	74 20                	je     800cac <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c90:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c94:	48 85 c0             	test   %rax,%rax
+  800c97:	74 47                	je     800ce0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c99:	44 89 e6             	mov    %r12d,%esi
+  800c9c:	4c 89 ef             	mov    %r13,%rdi
+  800c9f:	ff d0                	call   *%rax
+}
+  800ca1:	48 83 c4 18          	add    $0x18,%rsp
+  800ca5:	5b                   	pop    %rbx
+  800ca6:	41 5c                	pop    %r12
+  800ca8:	41 5d                	pop    %r13
+  800caa:	5d                   	pop    %rbp
+  800cab:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cac:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800cb3:	00 00 00 
+  800cb6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cbc:	89 da                	mov    %ebx,%edx
+  800cbe:	48 bf 00 47 80 00 00 	movabs $0x804700,%rdi
+  800cc5:	00 00 00 
+  800cc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccd:	48 b9 bd 34 80 00 00 	movabs $0x8034bd,%rcx
+  800cd4:	00 00 00 
+  800cd7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cd9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cde:	eb c1                	jmp    800ca1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ce0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ce5:	eb ba                	jmp    800ca1 <ftruncate+0x5e>
+
+0000000000800ce7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800ce7:	55                   	push   %rbp
+  800ce8:	48 89 e5             	mov    %rsp,%rbp
+  800ceb:	41 54                	push   %r12
+  800ced:	53                   	push   %rbx
+  800cee:	48 83 ec 10          	sub    $0x10,%rsp
+  800cf2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cf5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cf9:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  800d00:	00 00 00 
+  800d03:	ff d0                	call   *%rax
+  800d05:	85 c0                	test   %eax,%eax
+  800d07:	78 4e                	js     800d57 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d09:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d0d:	41 8b 3c 24          	mov    (%r12),%edi
+  800d11:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d15:	48 b8 5b 07 80 00 00 	movabs $0x80075b,%rax
+  800d1c:	00 00 00 
+  800d1f:	ff d0                	call   *%rax
+  800d21:	85 c0                	test   %eax,%eax
+  800d23:	78 32                	js     800d57 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d25:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d29:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d2e:	74 30                	je     800d60 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d30:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d33:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d3a:	00 00 00 
+    stat->st_isdir = 0;
+  800d3d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d44:	00 00 00 
+    stat->st_dev = dev;
+  800d47:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d4e:	48 89 de             	mov    %rbx,%rsi
+  800d51:	4c 89 e7             	mov    %r12,%rdi
+  800d54:	ff 50 28             	call   *0x28(%rax)
+}
+  800d57:	48 83 c4 10          	add    $0x10,%rsp
+  800d5b:	5b                   	pop    %rbx
+  800d5c:	41 5c                	pop    %r12
+  800d5e:	5d                   	pop    %rbp
+  800d5f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d60:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d65:	eb f0                	jmp    800d57 <fstat+0x70>
+
+0000000000800d67 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d67:	55                   	push   %rbp
+  800d68:	48 89 e5             	mov    %rsp,%rbp
+  800d6b:	41 54                	push   %r12
+  800d6d:	53                   	push   %rbx
+  800d6e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d71:	be 00 00 00 00       	mov    $0x0,%esi
+  800d76:	48 b8 d5 1e 80 00 00 	movabs $0x801ed5,%rax
+  800d7d:	00 00 00 
+  800d80:	ff d0                	call   *%rax
+  800d82:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d84:	85 c0                	test   %eax,%eax
+  800d86:	78 25                	js     800dad <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d88:	4c 89 e6             	mov    %r12,%rsi
+  800d8b:	89 c7                	mov    %eax,%edi
+  800d8d:	48 b8 e7 0c 80 00 00 	movabs $0x800ce7,%rax
+  800d94:	00 00 00 
+  800d97:	ff d0                	call   *%rax
+  800d99:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d9c:	89 df                	mov    %ebx,%edi
+  800d9e:	48 b8 75 08 80 00 00 	movabs $0x800875,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+
+    return res;
+  800daa:	44 89 e3             	mov    %r12d,%ebx
+}
+  800dad:	89 d8                	mov    %ebx,%eax
+  800daf:	5b                   	pop    %rbx
+  800db0:	41 5c                	pop    %r12
+  800db2:	5d                   	pop    %rbp
+  800db3:	c3                   	ret
+
+0000000000800db4 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800db4:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800dbb:	00 00 00 
+  800dbe:	83 38 00             	cmpl   $0x0,(%rax)
+  800dc1:	74 0a                	je     800dcd <fsenv+0x19>
+    return envid;
+}
+  800dc3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dca:	00 00 
+  800dcc:	c3                   	ret
+fsenv(void) {
+  800dcd:	55                   	push   %rbp
+  800dce:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dd1:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dd6:	48 b8 3e 46 80 00 00 	movabs $0x80463e,%rax
+  800ddd:	00 00 00 
+  800de0:	ff d0                	call   *%rax
+  800de2:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800de9:	00 00 
+}
+  800deb:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800df2:	00 00 
+  800df4:	5d                   	pop    %rbp
+  800df5:	c3                   	ret
+
+0000000000800df6 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800df6:	55                   	push   %rbp
+  800df7:	48 89 e5             	mov    %rsp,%rbp
+  800dfa:	41 54                	push   %r12
+  800dfc:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800dfd:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e02:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e07:	48 89 de             	mov    %rbx,%rsi
+  800e0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e0f:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  800e16:	00 00 00 
+  800e19:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e1b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e22:	00 00 00 
+  800e25:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e30:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e35:	48 89 de             	mov    %rbx,%rsi
+  800e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e3d:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  800e44:	00 00 00 
+  800e47:	ff d0                	call   *%rax
+  800e49:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e4b:	85 c0                	test   %eax,%eax
+  800e4d:	0f 88 a2 00 00 00    	js     800ef5 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e53:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e5a:	00 00 00 
+  800e5d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e63:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e68:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e6a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e6f:	49 bc 07 30 80 00 00 	movabs $0x803007,%r12
+  800e76:	00 00 00 
+  800e79:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e7c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e81:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e84:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  800e8b:	00 00 00 
+  800e8e:	ff d0                	call   *%rax
+  800e90:	89 c7                	mov    %eax,%edi
+  800e92:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e98:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e9d:	48 89 da             	mov    %rbx,%rdx
+  800ea0:	be 09 00 00 00       	mov    $0x9,%esi
+  800ea5:	48 b8 e8 45 80 00 00 	movabs $0x8045e8,%rax
+  800eac:	00 00 00 
+  800eaf:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800eb1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eb6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ebb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ec5:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  800ecc:	00 00 00 
+  800ecf:	ff d0                	call   *%rax
+  800ed1:	89 c3                	mov    %eax,%ebx
+  800ed3:	85 c0                	test   %eax,%eax
+  800ed5:	78 25                	js     800efc <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ed7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ede:	00 00 00 
+  800ee1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ee7:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800eee:	00 00 
+    return 0;
+  800ef0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800ef5:	89 d8                	mov    %ebx,%eax
+  800ef7:	5b                   	pop    %rbx
+  800ef8:	41 5c                	pop    %r12
+  800efa:	5d                   	pop    %rbp
+  800efb:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800efc:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f01:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f0b:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  800f12:	00 00 00 
+  800f15:	ff d0                	call   *%rax
+        return res;
+  800f17:	eb dc                	jmp    800ef5 <fschan_setup+0xff>
+
+0000000000800f19 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f19:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f20:	00 00 00 
+  800f23:	80 38 00             	cmpb   $0x0,(%rax)
+  800f26:	74 55                	je     800f7d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f28:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f2f:	00 00 00 
+  800f32:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f38:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f3d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f44:	00 00 00 
+  800f47:	3b 0a                	cmp    (%rdx),%ecx
+  800f49:	75 01                	jne    800f4c <fschan+0x33>
+}
+  800f4b:	c3                   	ret
+fschan(void) {
+  800f4c:	55                   	push   %rbp
+  800f4d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f50:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  800f57:	00 00 00 
+  800f5a:	ff d0                	call   *%rax
+  800f5c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f5e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f63:	85 d2                	test   %edx,%edx
+  800f65:	78 02                	js     800f69 <fschan+0x50>
+}
+  800f67:	5d                   	pop    %rbp
+  800f68:	c3                   	ret
+        fschan_enabled = 0;
+  800f69:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f70:	00 00 00 
+  800f73:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f7b:	eb ea                	jmp    800f67 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f82:	c3                   	ret
+
+0000000000800f83 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f83:	55                   	push   %rbp
+  800f84:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f87:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  800f8e:	00 00 00 
+  800f91:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f93:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f98:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f9c:	77 12                	ja     800fb0 <fbuf+0x2d>
+  800f9e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800fa2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800fa9:	00 00 00 
+  800fac:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fb0:	48 89 d0             	mov    %rdx,%rax
+  800fb3:	5d                   	pop    %rbp
+  800fb4:	c3                   	ret
+
+0000000000800fb5 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fb5:	55                   	push   %rbp
+  800fb6:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fb9:	48 83 c7 40          	add    $0x40,%rdi
+  800fbd:	48 b8 41 30 80 00 00 	movabs $0x803041,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+  800fc9:	84 c0                	test   %al,%al
+  800fcb:	75 02                	jne    800fcf <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fcd:	5d                   	pop    %rbp
+  800fce:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fcf:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  800fd6:	00 00 00 
+  800fd9:	ff d0                	call   *%rax
+  800fdb:	89 c7                	mov    %eax,%edi
+  800fdd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fed:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ff2:	48 b8 e8 45 80 00 00 	movabs $0x8045e8,%rax
+  800ff9:	00 00 00 
+  800ffc:	ff d0                	call   *%rax
+}
+  800ffe:	eb cd                	jmp    800fcd <fschan_publish+0x18>
+
+0000000000801000 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801000:	55                   	push   %rbp
+  801001:	48 89 e5             	mov    %rsp,%rbp
+  801004:	41 57                	push   %r15
+  801006:	41 56                	push   %r14
+  801008:	41 55                	push   %r13
+  80100a:	41 54                	push   %r12
+  80100c:	53                   	push   %rbx
+  80100d:	48 83 ec 48          	sub    $0x48,%rsp
+  801011:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801015:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801019:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80101c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801020:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801023:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80102a:	00 00 00 
+  80102d:	8b 02                	mov    (%rdx),%eax
+  80102f:	83 c0 01             	add    $0x1,%eax
+  801032:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801037:	0f 44 c1             	cmove  %ecx,%eax
+  80103a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80103c:	4d 85 c0             	test   %r8,%r8
+  80103f:	74 2c                	je     80106d <fschan_rw+0x6d>
+  801041:	45 89 ce             	mov    %r9d,%r14d
+  801044:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80104b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80104f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801055:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80105c:	00 
+  80105d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801063:	b8 01 00 00 00       	mov    $0x1,%eax
+  801068:	e9 41 01 00 00       	jmp    8011ae <fschan_rw+0x1ae>
+  80106d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801071:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801075:	e9 9c 01 00 00       	jmp    801216 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80107a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80107e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801081:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801084:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801087:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80108b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80108f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801093:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801097:	48 89 da             	mov    %rbx,%rdx
+  80109a:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  8010a1:	00 00 00 
+  8010a4:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8010a6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8010aa:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  8010b1:	00 00 00 
+  8010b4:	ff d0                	call   *%rax
+            queued += blk;
+  8010b6:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010b9:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010bd:	4d 39 fc             	cmp    %r15,%r12
+  8010c0:	73 6b                	jae    80112d <fschan_rw+0x12d>
+  8010c2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010c6:	77 65                	ja     80112d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010cc:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010d0:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  8010d7:	00 00 00 
+  8010da:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010dc:	4c 89 fb             	mov    %r15,%rbx
+  8010df:	4c 29 e3             	sub    %r12,%rbx
+  8010e2:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010e7:	48 39 d3             	cmp    %rdx,%rbx
+  8010ea:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010ee:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010f2:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010f6:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010fa:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010fd:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010ff:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801106:	00 00 00 
+  801109:	8b 09                	mov    (%rcx),%ecx
+  80110b:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80110e:	83 fe 03             	cmp    $0x3,%esi
+  801111:	0f 85 63 ff ff ff    	jne    80107a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801117:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80111b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80111e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801121:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801124:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801128:	e9 79 ff ff ff       	jmp    8010a6 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80112d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801131:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801138:	48 89 df             	mov    %rbx,%rdi
+  80113b:	48 b8 df 30 80 00 00 	movabs $0x8030df,%rax
+  801142:	00 00 00 
+  801145:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801147:	48 89 df             	mov    %rbx,%rdi
+  80114a:	48 b8 6d 30 80 00 00 	movabs $0x80306d,%rax
+  801151:	00 00 00 
+  801154:	ff d0                	call   *%rax
+  801156:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80115a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80115e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801162:	75 25                	jne    801189 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801164:	8b 40 04             	mov    0x4(%rax),%eax
+  801167:	85 c0                	test   %eax,%eax
+  801169:	0f 88 86 00 00 00    	js     8011f5 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80116f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801173:	74 5b                	je     8011d0 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801175:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801179:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80117d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801181:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801185:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801189:	48 89 df             	mov    %rbx,%rdi
+  80118c:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  801193:	00 00 00 
+  801196:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801198:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80119c:	83 f0 01             	xor    $0x1,%eax
+  80119f:	4d 39 fc             	cmp    %r15,%r12
+  8011a2:	0f 92 c2             	setb   %dl
+  8011a5:	84 c2                	test   %al,%dl
+  8011a7:	75 05                	jne    8011ae <fschan_rw+0x1ae>
+  8011a9:	45 85 ed             	test   %r13d,%r13d
+  8011ac:	74 50                	je     8011fe <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011ae:	4d 39 fc             	cmp    %r15,%r12
+  8011b1:	0f 92 c1             	setb   %cl
+  8011b4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011b8:	0f 96 c2             	setbe  %dl
+  8011bb:	84 d1                	test   %dl,%cl
+  8011bd:	0f 84 6a ff ff ff    	je     80112d <fschan_rw+0x12d>
+  8011c3:	84 c0                	test   %al,%al
+  8011c5:	0f 85 fd fe ff ff    	jne    8010c8 <fschan_rw+0xc8>
+  8011cb:	e9 5d ff ff ff       	jmp    80112d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011d0:	48 63 d0             	movslq %eax,%rdx
+  8011d3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011d7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011db:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011df:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011e3:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011e7:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  8011ee:	00 00 00 
+  8011f1:	ff d0                	call   *%rax
+  8011f3:	eb 80                	jmp    801175 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011f5:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011f8:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011fc:	eb 8b                	jmp    801189 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011fe:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  801203:	0f 85 68 fe ff ff    	jne    801071 <fschan_rw+0x71>
+  801209:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80120c:	85 c0                	test   %eax,%eax
+  80120e:	0f 84 5d fe ff ff    	je     801071 <fschan_rw+0x71>
+  801214:	48 98                	cltq
+}
+  801216:	48 83 c4 48          	add    $0x48,%rsp
+  80121a:	5b                   	pop    %rbx
+  80121b:	41 5c                	pop    %r12
+  80121d:	41 5d                	pop    %r13
+  80121f:	41 5e                	pop    %r14
+  801221:	41 5f                	pop    %r15
+  801223:	5d                   	pop    %rbp
+  801224:	c3                   	ret
+
+0000000000801225 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801225:	55                   	push   %rbp
+  801226:	48 89 e5             	mov    %rsp,%rbp
+  801229:	41 56                	push   %r14
+  80122b:	41 55                	push   %r13
+  80122d:	41 54                	push   %r12
+  80122f:	53                   	push   %rbx
+  801230:	48 83 ec 10          	sub    $0x10,%rsp
+  801234:	49 89 fe             	mov    %rdi,%r14
+  801237:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80123a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80123e:	48 29 f3             	sub    %rsi,%rbx
+  801241:	48 39 d3             	cmp    %rdx,%rbx
+  801244:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801248:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80124f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801250:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801255:	49 bd 9e 2e 80 00 00 	movabs $0x802e9e,%r13
+  80125c:	00 00 00 
+  80125f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801266:	76 1e                	jbe    801286 <mmap_fault+0x61>
+  801268:	4c 01 e7             	add    %r12,%rdi
+  80126b:	41 ff d5             	call   *%r13
+  80126e:	84 c0                	test   %al,%al
+  801270:	75 14                	jne    801286 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801272:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801276:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80127d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801281:	48 39 df             	cmp    %rbx,%rdi
+  801284:	72 e2                	jb     801268 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  801286:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80128d:	00 00 00 
+  801290:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801297:	00 00 00 
+  80129a:	4c 89 f0             	mov    %r14,%rax
+  80129d:	48 29 d0             	sub    %rdx,%rax
+  8012a0:	48 c1 f8 03          	sar    $0x3,%rax
+  8012a4:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012ab:	aa aa aa 
+  8012ae:	48 0f af c2          	imul   %rdx,%rax
+  8012b2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012b6:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012bb:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012bf:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012c1:	44 89 e0             	mov    %r12d,%eax
+  8012c4:	41 03 46 10          	add    0x10(%r14),%eax
+  8012c8:	41 2b 06             	sub    (%r14),%eax
+  8012cb:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012ce:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012d2:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012d6:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012da:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012dd:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  8012e4:	00 00 00 
+  8012e7:	ff d0                	call   *%rax
+  8012e9:	89 c7                	mov    %eax,%edi
+  8012eb:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012f1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012f6:	48 89 da             	mov    %rbx,%rdx
+  8012f9:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012fe:	48 b8 e8 45 80 00 00 	movabs $0x8045e8,%rax
+  801305:	00 00 00 
+  801308:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80130a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80130f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801313:	4c 89 e6             	mov    %r12,%rsi
+  801316:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131b:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  801322:	00 00 00 
+  801325:	ff d0                	call   *%rax
+  801327:	48 98                	cltq
+}
+  801329:	48 83 c4 10          	add    $0x10,%rsp
+  80132d:	5b                   	pop    %rbx
+  80132e:	41 5c                	pop    %r12
+  801330:	41 5d                	pop    %r13
+  801332:	41 5e                	pop    %r14
+  801334:	5d                   	pop    %rbp
+  801335:	c3                   	ret
+
+0000000000801336 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801336:	48 8b 37             	mov    (%rdi),%rsi
+  801339:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801340:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801347:	00 00 00 
+  80134a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80134f:	eb 0f                	jmp    801360 <mmap_pgfault+0x2a>
+  801351:	c3                   	ret
+  801352:	48 83 c1 01          	add    $0x1,%rcx
+  801356:	48 83 c2 18          	add    $0x18,%rdx
+  80135a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80135e:	74 6e                	je     8013ce <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801360:	48 8b 02             	mov    (%rdx),%rax
+  801363:	48 83 e8 01          	sub    $0x1,%rax
+  801367:	48 39 f0             	cmp    %rsi,%rax
+  80136a:	73 e6                	jae    801352 <mmap_pgfault+0x1c>
+  80136c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801370:	73 e0                	jae    801352 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801372:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137b:	f6 c2 01             	test   $0x1,%dl
+  80137e:	75 d1                	jne    801351 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801380:	f6 c2 02             	test   $0x2,%dl
+  801383:	74 1a                	je     80139f <mmap_pgfault+0x69>
+  801385:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801389:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  801395:	00 00 00 
+  801398:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80139d:	74 35                	je     8013d4 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80139f:	55                   	push   %rbp
+  8013a0:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013a3:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013a7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013ae:	00 00 00 
+  8013b1:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013b5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013ba:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8013c1:	00 00 00 
+  8013c4:	ff d0                	call   *%rax
+  8013c6:	48 85 c0             	test   %rax,%rax
+  8013c9:	0f 9f c0             	setg   %al
+}
+  8013cc:	5d                   	pop    %rbp
+  8013cd:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d3:	c3                   	ret
+}
+  8013d4:	c3                   	ret
+
+00000000008013d5 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013d5:	55                   	push   %rbp
+  8013d6:	48 89 e5             	mov    %rsp,%rbp
+  8013d9:	41 54                	push   %r12
+  8013db:	53                   	push   %rbx
+  8013dc:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013df:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013e6:	00 00 00 
+  8013e9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013ee:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013f2:	74 15                	je     801409 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013f4:	48 83 c3 01          	add    $0x1,%rbx
+  8013f8:	48 83 c0 18          	add    $0x18,%rax
+  8013fc:	48 83 fb 20          	cmp    $0x20,%rbx
+  801400:	75 ec                	jne    8013ee <mmap_alloc+0x19>
+    return NULL;
+  801402:	b8 00 00 00 00       	mov    $0x0,%eax
+  801407:	eb 52                	jmp    80145b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801409:	4c 89 e7             	mov    %r12,%rdi
+  80140c:	48 b8 3f 2e 80 00 00 	movabs $0x802e3f,%rax
+  801413:	00 00 00 
+  801416:	ff d0                	call   *%rax
+  801418:	41 89 c1             	mov    %eax,%r9d
+  80141b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801422:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801426:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80142c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801431:	4c 89 e6             	mov    %r12,%rsi
+  801434:	bf 00 00 00 00       	mov    $0x0,%edi
+  801439:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  801440:	00 00 00 
+  801443:	ff d0                	call   *%rax
+  801445:	85 c0                	test   %eax,%eax
+  801447:	78 17                	js     801460 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801449:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80144d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801454:	00 00 00 
+  801457:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80145b:	5b                   	pop    %rbx
+  80145c:	41 5c                	pop    %r12
+  80145e:	5d                   	pop    %rbp
+  80145f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801460:	b8 00 00 00 00       	mov    $0x0,%eax
+  801465:	eb f4                	jmp    80145b <mmap_alloc+0x86>
+
+0000000000801467 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  801467:	55                   	push   %rbp
+  801468:	48 89 e5             	mov    %rsp,%rbp
+  80146b:	41 56                	push   %r14
+  80146d:	41 55                	push   %r13
+  80146f:	41 54                	push   %r12
+  801471:	53                   	push   %rbx
+  801472:	48 83 ec 10          	sub    $0x10,%rsp
+  801476:	41 89 fc             	mov    %edi,%r12d
+  801479:	49 89 f5             	mov    %rsi,%r13
+  80147c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80147f:	48 89 f0             	mov    %rsi,%rax
+  801482:	48 09 d0             	or     %rdx,%rax
+  801485:	75 0d                	jne    801494 <fsipc+0x2d>
+  801487:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80148a:	83 f8 04             	cmp    $0x4,%eax
+  80148d:	76 7d                	jbe    80150c <fsipc+0xa5>
+  80148f:	83 ff 0d             	cmp    $0xd,%edi
+  801492:	74 78                	je     80150c <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  801494:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  80149b:	00 00 00 
+  80149e:	ff d0                	call   *%rax
+  8014a0:	89 c7                	mov    %eax,%edi
+  8014a2:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8014a9:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014b0:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014b7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014bd:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014c4:	00 00 00 
+  8014c7:	44 89 e6             	mov    %r12d,%esi
+  8014ca:	48 b8 e8 45 80 00 00 	movabs $0x8045e8,%rax
+  8014d1:	00 00 00 
+  8014d4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014d6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014dd:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014e7:	4c 89 ee             	mov    %r13,%rsi
+  8014ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014ef:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8014f6:	00 00 00 
+  8014f9:	ff d0                	call   *%rax
+  8014fb:	89 c3                	mov    %eax,%ebx
+}
+  8014fd:	89 d8                	mov    %ebx,%eax
+  8014ff:	48 83 c4 10          	add    $0x10,%rsp
+  801503:	5b                   	pop    %rbx
+  801504:	41 5c                	pop    %r12
+  801506:	41 5d                	pop    %r13
+  801508:	41 5e                	pop    %r14
+  80150a:	5d                   	pop    %rbp
+  80150b:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80150c:	48 b8 19 0f 80 00 00 	movabs $0x800f19,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	49 89 c6             	mov    %rax,%r14
+  80151b:	48 85 c0             	test   %rax,%rax
+  80151e:	0f 84 70 ff ff ff    	je     801494 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801524:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801528:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  80152f:	00 00 00 
+  801532:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801534:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801537:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80153e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801542:	ba 10 00 00 00       	mov    $0x10,%edx
+  801547:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80154e:	00 00 00 
+  801551:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  801558:	00 00 00 
+  80155b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80155d:	4c 89 f7             	mov    %r14,%rdi
+  801560:	48 b8 b5 0f 80 00 00 	movabs $0x800fb5,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80156c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801573:	4c 89 f7             	mov    %r14,%rdi
+  801576:	48 b8 df 30 80 00 00 	movabs $0x8030df,%rax
+  80157d:	00 00 00 
+  801580:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801582:	4c 89 f7             	mov    %r14,%rdi
+  801585:	48 b8 6d 30 80 00 00 	movabs $0x80306d,%rax
+  80158c:	00 00 00 
+  80158f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801591:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  801594:	41 83 fc 05          	cmp    $0x5,%r12d
+  801598:	75 04                	jne    80159e <fsipc+0x137>
+  80159a:	85 db                	test   %ebx,%ebx
+  80159c:	79 14                	jns    8015b2 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80159e:	4c 89 f7             	mov    %r14,%rdi
+  8015a1:	48 b8 94 30 80 00 00 	movabs $0x803094,%rax
+  8015a8:	00 00 00 
+  8015ab:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015ad:	e9 4b ff ff ff       	jmp    8014fd <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015b2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015b6:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015bb:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015c2:	00 00 00 
+  8015c5:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  8015cc:	00 00 00 
+  8015cf:	ff d0                	call   *%rax
+  8015d1:	eb cb                	jmp    80159e <fsipc+0x137>
+
+00000000008015d3 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015d3:	55                   	push   %rbp
+  8015d4:	48 89 e5             	mov    %rsp,%rbp
+  8015d7:	41 57                	push   %r15
+  8015d9:	41 56                	push   %r14
+  8015db:	41 55                	push   %r13
+  8015dd:	41 54                	push   %r12
+  8015df:	53                   	push   %rbx
+  8015e0:	48 83 ec 18          	sub    $0x18,%rsp
+  8015e4:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015e8:	49 89 f6             	mov    %rsi,%r14
+  8015eb:	49 89 d4             	mov    %rdx,%r12
+  8015ee:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015f1:	48 b8 19 0f 80 00 00 	movabs $0x800f19,%rax
+  8015f8:	00 00 00 
+  8015fb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015fd:	48 85 c0             	test   %rax,%rax
+  801600:	0f 85 96 00 00 00    	jne    80169c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  801606:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80160d:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80160e:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801615:	00 00 00 
+    while (n) {
+  801618:	4d 85 e4             	test   %r12,%r12
+  80161b:	74 79                	je     801696 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80161d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801622:	49 39 dc             	cmp    %rbx,%r12
+  801625:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801629:	48 89 da             	mov    %rbx,%rdx
+  80162c:	4c 89 f6             	mov    %r14,%rsi
+  80162f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801636:	00 00 00 
+  801639:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  801640:	00 00 00 
+  801643:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801645:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801649:	8b 40 0c             	mov    0xc(%rax),%eax
+  80164c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80164f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801652:	44 01 e8             	add    %r13d,%eax
+  801655:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801659:	41 0f 44 c5          	cmove  %r13d,%eax
+  80165d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801661:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801665:	48 89 da             	mov    %rbx,%rdx
+  801668:	be 00 00 00 00       	mov    $0x0,%esi
+  80166d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801672:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+        if (res < 0)
+  80167e:	85 c0                	test   %eax,%eax
+  801680:	78 4a                	js     8016cc <devfile_write_direct+0xf9>
+        buf += res;
+  801682:	48 98                	cltq
+  801684:	49 01 c6             	add    %rax,%r14
+        write += res;
+  801687:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80168b:	49 29 c4             	sub    %rax,%r12
+  80168e:	75 8d                	jne    80161d <devfile_write_direct+0x4a>
+    return write;
+  801690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801694:	eb 27                	jmp    8016bd <devfile_write_direct+0xea>
+    size_t write = 0;
+  801696:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80169a:	eb f4                	jmp    801690 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80169c:	45 89 e9             	mov    %r13d,%r9d
+  80169f:	4d 89 e0             	mov    %r12,%r8
+  8016a2:	4c 89 f1             	mov    %r14,%rcx
+  8016a5:	ba 04 00 00 00       	mov    $0x4,%edx
+  8016aa:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016ae:	48 89 c7             	mov    %rax,%rdi
+  8016b1:	48 b8 00 10 80 00 00 	movabs $0x801000,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+}
+  8016bd:	48 83 c4 18          	add    $0x18,%rsp
+  8016c1:	5b                   	pop    %rbx
+  8016c2:	41 5c                	pop    %r12
+  8016c4:	41 5d                	pop    %r13
+  8016c6:	41 5e                	pop    %r14
+  8016c8:	41 5f                	pop    %r15
+  8016ca:	5d                   	pop    %rbp
+  8016cb:	c3                   	ret
+            return res;
+  8016cc:	48 98                	cltq
+  8016ce:	eb ed                	jmp    8016bd <devfile_write_direct+0xea>
+
+00000000008016d0 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	41 54                	push   %r12
+  8016d6:	53                   	push   %rbx
+  8016d7:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016da:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  8016e1:	00 00 00 
+  8016e4:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016e6:	48 85 c0             	test   %rax,%rax
+  8016e9:	74 71                	je     80175c <fbuf_flush+0x8c>
+  8016eb:	48 89 c3             	mov    %rax,%rbx
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f3:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016f7:	75 05                	jne    8016fe <fbuf_flush+0x2e>
+}
+  8016f9:	5b                   	pop    %rbx
+  8016fa:	41 5c                	pop    %r12
+  8016fc:	5d                   	pop    %rbp
+  8016fd:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016fe:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801701:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  801705:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80170c:	00 00 00 
+  80170f:	48 89 de             	mov    %rbx,%rsi
+  801712:	48 29 c6             	sub    %rax,%rsi
+  801715:	48 c1 fe 03          	sar    $0x3,%rsi
+  801719:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801720:	aa aa aa 
+  801723:	48 0f af f0          	imul   %rax,%rsi
+  801727:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80172b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801730:	48 01 c6             	add    %rax,%rsi
+  801733:	4c 89 e7             	mov    %r12,%rdi
+  801736:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  80173d:	00 00 00 
+  801740:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801742:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801746:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80174d:	00 
+    return res < 0 ? res : 0;
+  80174e:	48 85 c0             	test   %rax,%rax
+  801751:	ba 00 00 00 00       	mov    $0x0,%edx
+  801756:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80175a:	eb 9d                	jmp    8016f9 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80175c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801761:	eb 96                	jmp    8016f9 <fbuf_flush+0x29>
+
+0000000000801763 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801763:	55                   	push   %rbp
+  801764:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801767:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80176e:	00 00 00 
+  801771:	ff d0                	call   *%rax
+}
+  801773:	5d                   	pop    %rbp
+  801774:	c3                   	ret
+
+0000000000801775 <devfile_write>:
+    if (!fd || !buf)
+  801775:	48 85 ff             	test   %rdi,%rdi
+  801778:	0f 84 d3 01 00 00    	je     801951 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+  801782:	41 57                	push   %r15
+  801784:	41 56                	push   %r14
+  801786:	41 55                	push   %r13
+  801788:	41 54                	push   %r12
+  80178a:	53                   	push   %rbx
+  80178b:	48 83 ec 08          	sub    $0x8,%rsp
+  80178f:	49 89 fc             	mov    %rdi,%r12
+  801792:	49 89 f6             	mov    %rsi,%r14
+  801795:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  801798:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80179d:	48 85 f6             	test   %rsi,%rsi
+  8017a0:	0f 84 9c 01 00 00    	je     801942 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8017a6:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+  8017b2:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017b5:	48 85 c0             	test   %rax,%rax
+  8017b8:	0f 84 a2 00 00 00    	je     801860 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017be:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017c3:	4c 89 e7             	mov    %r12,%rdi
+  8017c6:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  8017cd:	00 00 00 
+  8017d0:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017d2:	83 f8 02             	cmp    $0x2,%eax
+  8017d5:	0f 8f 85 00 00 00    	jg     801860 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017db:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017e2:	00 00 00 
+  8017e5:	4d 89 ef             	mov    %r13,%r15
+  8017e8:	49 29 c7             	sub    %rax,%r15
+  8017eb:	49 c1 ff 03          	sar    $0x3,%r15
+  8017ef:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017f6:	aa aa aa 
+  8017f9:	4c 0f af f8          	imul   %rax,%r15
+  8017fd:	49 c1 e7 0e          	shl    $0xe,%r15
+  801801:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801806:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801809:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80180e:	0f 84 d7 00 00 00    	je     8018eb <devfile_write+0x176>
+  801814:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801818:	89 c2                	mov    %eax,%edx
+  80181a:	41 03 55 0c          	add    0xc(%r13),%edx
+  80181e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801823:	75 0f                	jne    801834 <devfile_write+0xbf>
+  801825:	48 01 d8             	add    %rbx,%rax
+  801828:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80182e:	0f 86 92 00 00 00    	jbe    8018c6 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801834:	4c 89 e7             	mov    %r12,%rdi
+  801837:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80183e:	00 00 00 
+  801841:	ff d0                	call   *%rax
+  801843:	85 c0                	test   %eax,%eax
+  801845:	78 52                	js     801899 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801847:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80184e:	77 7f                	ja     8018cf <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801850:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801855:	0f 85 c2 00 00 00    	jne    80191d <devfile_write+0x1a8>
+  80185b:	e9 94 00 00 00       	jmp    8018f4 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801860:	4c 89 e7             	mov    %r12,%rdi
+  801863:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80186a:	00 00 00 
+  80186d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	79 07                	jns    80187a <devfile_write+0x105>
+  801873:	48 98                	cltq
+  801875:	e9 c8 00 00 00       	jmp    801942 <devfile_write+0x1cd>
+  80187a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80187f:	48 89 da             	mov    %rbx,%rdx
+  801882:	4c 89 f6             	mov    %r14,%rsi
+  801885:	4c 89 e7             	mov    %r12,%rdi
+  801888:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  80188f:	00 00 00 
+  801892:	ff d0                	call   *%rax
+  801894:	e9 a9 00 00 00       	jmp    801942 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801899:	48 98                	cltq
+  80189b:	e9 a2 00 00 00       	jmp    801942 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018a5:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8018aa:	4c 89 fe             	mov    %r15,%rsi
+  8018ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b2:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  8018b9:	00 00 00 
+  8018bc:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018be:	85 c0                	test   %eax,%eax
+  8018c0:	79 45                	jns    801907 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018c2:	48 98                	cltq
+  8018c4:	eb 7c                	jmp    801942 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018c6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018cd:	76 4e                	jbe    80191d <devfile_write+0x1a8>
+  8018cf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018d4:	48 89 da             	mov    %rbx,%rdx
+  8018d7:	4c 89 f6             	mov    %r14,%rsi
+  8018da:	4c 89 e7             	mov    %r12,%rdi
+  8018dd:	48 b8 d3 15 80 00 00 	movabs $0x8015d3,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+  8018e9:	eb 57                	jmp    801942 <devfile_write+0x1cd>
+  8018eb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018f2:	77 db                	ja     8018cf <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018f4:	4c 89 ff             	mov    %r15,%rdi
+  8018f7:	48 b8 9e 2e 80 00 00 	movabs $0x802e9e,%rax
+  8018fe:	00 00 00 
+  801901:	ff d0                	call   *%rax
+  801903:	84 c0                	test   %al,%al
+  801905:	74 99                	je     8018a0 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  801907:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80190c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801911:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801915:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80191c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80191d:	4c 89 ff             	mov    %r15,%rdi
+  801920:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801924:	48 89 da             	mov    %rbx,%rdx
+  801927:	4c 89 f6             	mov    %r14,%rsi
+  80192a:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801936:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80193a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80193f:	48 89 d8             	mov    %rbx,%rax
+}
+  801942:	48 83 c4 08          	add    $0x8,%rsp
+  801946:	5b                   	pop    %rbx
+  801947:	41 5c                	pop    %r12
+  801949:	41 5d                	pop    %r13
+  80194b:	41 5e                	pop    %r14
+  80194d:	41 5f                	pop    %r15
+  80194f:	5d                   	pop    %rbp
+  801950:	c3                   	ret
+        return E_INVAL;
+  801951:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801956:	c3                   	ret
+
+0000000000801957 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801957:	55                   	push   %rbp
+  801958:	48 89 e5             	mov    %rsp,%rbp
+  80195b:	41 54                	push   %r12
+  80195d:	53                   	push   %rbx
+  80195e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801961:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  801968:	00 00 00 
+  80196b:	ff d0                	call   *%rax
+  80196d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801970:	48 89 df             	mov    %rbx,%rdi
+  801973:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+  80197f:	48 85 c0             	test   %rax,%rax
+  801982:	74 17                	je     80199b <devfile_flush+0x44>
+  801984:	48 89 df             	mov    %rbx,%rdi
+  801987:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  80198e:	00 00 00 
+  801991:	ff d0                	call   *%rax
+  801993:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80199a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80199b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80199e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8019a5:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8019a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019b6:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  8019bd:	00 00 00 
+  8019c0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019c2:	45 85 e4             	test   %r12d,%r12d
+  8019c5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019c9:	5b                   	pop    %rbx
+  8019ca:	41 5c                	pop    %r12
+  8019cc:	5d                   	pop    %rbp
+  8019cd:	c3                   	ret
+
+00000000008019ce <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+  8019d2:	41 57                	push   %r15
+  8019d4:	41 56                	push   %r14
+  8019d6:	41 55                	push   %r13
+  8019d8:	41 54                	push   %r12
+  8019da:	53                   	push   %rbx
+  8019db:	48 83 ec 38          	sub    $0x38,%rsp
+  8019df:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019e3:	49 89 f7             	mov    %rsi,%r15
+  8019e6:	48 89 d3             	mov    %rdx,%rbx
+  8019e9:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019ec:	48 b8 19 0f 80 00 00 	movabs $0x800f19,%rax
+  8019f3:	00 00 00 
+  8019f6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019f8:	48 85 c0             	test   %rax,%rax
+  8019fb:	75 20                	jne    801a1d <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019fd:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a02:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a09:	00 
+    while (n) {
+  801a0a:	48 85 db             	test   %rbx,%rbx
+  801a0d:	0f 85 df 00 00 00    	jne    801af2 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a13:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a17:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a1b:	eb 21                	jmp    801a3e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a1d:	45 89 f1             	mov    %r14d,%r9d
+  801a20:	49 89 d8             	mov    %rbx,%r8
+  801a23:	4c 89 f9             	mov    %r15,%rcx
+  801a26:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a2b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a2f:	48 89 c7             	mov    %rax,%rdi
+  801a32:	48 b8 00 10 80 00 00 	movabs $0x801000,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+}
+  801a3e:	48 83 c4 38          	add    $0x38,%rsp
+  801a42:	5b                   	pop    %rbx
+  801a43:	41 5c                	pop    %r12
+  801a45:	41 5d                	pop    %r13
+  801a47:	41 5e                	pop    %r14
+  801a49:	41 5f                	pop    %r15
+  801a4b:	5d                   	pop    %rbp
+  801a4c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a4d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a51:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a57:	75 1e                	jne    801a77 <devfile_read_direct+0xa9>
+  801a59:	e9 e2 00 00 00       	jmp    801b40 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a5e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a62:	eb da                	jmp    801a3e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a64:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a68:	0f 85 d0 01 00 00    	jne    801c3e <devfile_read_direct+0x270>
+            map = 0;
+  801a6e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a72:	eb 03                	jmp    801a77 <devfile_read_direct+0xa9>
+  801a74:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a77:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a7c:	48 39 d3             	cmp    %rdx,%rbx
+  801a7f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a83:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a87:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a8a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a91:	00 00 00 
+  801a94:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a96:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a9a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a9e:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801aa8:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801aaf:	00 00 00 
+  801ab2:	ff d0                	call   *%rax
+        if (res <= 0)
+  801ab4:	85 c0                	test   %eax,%eax
+  801ab6:	0f 8e 63 01 00 00    	jle    801c1f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801abc:	4c 63 e0             	movslq %eax,%r12
+  801abf:	4c 89 e2             	mov    %r12,%rdx
+  801ac2:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ac9:	00 00 00 
+  801acc:	4c 89 ff             	mov    %r15,%rdi
+  801acf:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  801ad6:	00 00 00 
+  801ad9:	ff d0                	call   *%rax
+        buf += res;
+  801adb:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ade:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ae1:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801ae5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801ae9:	48 85 db             	test   %rbx,%rbx
+  801aec:	0f 84 25 ff ff ff    	je     801a17 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801af2:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801af5:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801af9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801afd:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b01:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b08:	0f 97 c2             	seta   %dl
+  801b0b:	20 c2                	and    %al,%dl
+  801b0d:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b10:	0f 84 5e ff ff ff    	je     801a74 <devfile_read_direct+0xa6>
+  801b16:	4c 89 fa             	mov    %r15,%rdx
+  801b19:	4d 89 fd             	mov    %r15,%r13
+  801b1c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b23:	0f 85 4e ff ff ff    	jne    801a77 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b29:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b2d:	0f 84 1a ff ff ff    	je     801a4d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b33:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b3a:	0f 85 37 ff ff ff    	jne    801a77 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b40:	48 89 d8             	mov    %rbx,%rax
+  801b43:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b49:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b4e:	48 39 c8             	cmp    %rcx,%rax
+  801b51:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b55:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b59:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b5d:	49 89 d4             	mov    %rdx,%r12
+  801b60:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b64:	48 b8 3f 2e 80 00 00 	movabs $0x802e3f,%rax
+  801b6b:	00 00 00 
+  801b6e:	ff d0                	call   *%rax
+  801b70:	a8 40                	test   $0x40,%al
+  801b72:	0f 85 b9 00 00 00    	jne    801c31 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b78:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b7f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b83:	49 39 c5             	cmp    %rax,%r13
+  801b86:	72 d8                	jb     801b60 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b88:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b8c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b93:	00 00 00 
+  801b96:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b9a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b9d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b9f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801ba3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801ba7:	48 b8 b4 0d 80 00 00 	movabs $0x800db4,%rax
+  801bae:	00 00 00 
+  801bb1:	ff d0                	call   *%rax
+  801bb3:	89 c7                	mov    %eax,%edi
+  801bb5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bbb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bc0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bc7:	00 00 00 
+  801bca:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bcf:	48 b8 e8 45 80 00 00 	movabs $0x8045e8,%rax
+  801bd6:	00 00 00 
+  801bd9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bdb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801be4:	4c 89 fe             	mov    %r15,%rsi
+  801be7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bec:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801bfb:	48 85 d2             	test   %rdx,%rdx
+  801bfe:	0f 84 5a fe ff ff    	je     801a5e <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c04:	0f 8e 5a fe ff ff    	jle    801a64 <devfile_read_direct+0x96>
+                buf += res;
+  801c0a:	48 98                	cltq
+  801c0c:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c0f:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c12:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c16:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c1a:	e9 ca fe ff ff       	jmp    801ae9 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c1f:	41 89 c5             	mov    %eax,%r13d
+  801c22:	48 98                	cltq
+  801c24:	45 85 ed             	test   %r13d,%r13d
+  801c27:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c2c:	e9 0d fe ff ff       	jmp    801a3e <devfile_read_direct+0x70>
+            map = 0;
+  801c31:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c35:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c39:	e9 39 fe ff ff       	jmp    801a77 <devfile_read_direct+0xa9>
+  801c3e:	48 89 d0             	mov    %rdx,%rax
+  801c41:	e9 f8 fd ff ff       	jmp    801a3e <devfile_read_direct+0x70>
+
+0000000000801c46 <devfile_read>:
+    if (!fd || !buf)
+  801c46:	48 85 ff             	test   %rdi,%rdi
+  801c49:	0f 84 21 02 00 00    	je     801e70 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c4f:	55                   	push   %rbp
+  801c50:	48 89 e5             	mov    %rsp,%rbp
+  801c53:	41 57                	push   %r15
+  801c55:	41 56                	push   %r14
+  801c57:	41 55                	push   %r13
+  801c59:	41 54                	push   %r12
+  801c5b:	53                   	push   %rbx
+  801c5c:	48 83 ec 28          	sub    $0x28,%rsp
+  801c60:	48 89 fb             	mov    %rdi,%rbx
+  801c63:	49 89 f4             	mov    %rsi,%r12
+  801c66:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c69:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c6e:	48 85 f6             	test   %rsi,%rsi
+  801c71:	74 4b                	je     801cbe <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c73:	48 b8 83 0f 80 00 00 	movabs $0x800f83,%rax
+  801c7a:	00 00 00 
+  801c7d:	ff d0                	call   *%rax
+  801c7f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c82:	48 85 c0             	test   %rax,%rax
+  801c85:	74 22                	je     801ca9 <devfile_read+0x63>
+  801c87:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c8e:	77 19                	ja     801ca9 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c90:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c95:	48 89 df             	mov    %rbx,%rdi
+  801c98:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  801c9f:	00 00 00 
+  801ca2:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801ca4:	83 f8 02             	cmp    $0x2,%eax
+  801ca7:	7e 40                	jle    801ce9 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801ca9:	48 89 df             	mov    %rbx,%rdi
+  801cac:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  801cb3:	00 00 00 
+  801cb6:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cb8:	85 c0                	test   %eax,%eax
+  801cba:	79 11                	jns    801ccd <devfile_read+0x87>
+  801cbc:	48 98                	cltq
+}
+  801cbe:	48 83 c4 28          	add    $0x28,%rsp
+  801cc2:	5b                   	pop    %rbx
+  801cc3:	41 5c                	pop    %r12
+  801cc5:	41 5d                	pop    %r13
+  801cc7:	41 5e                	pop    %r14
+  801cc9:	41 5f                	pop    %r15
+  801ccb:	5d                   	pop    %rbp
+  801ccc:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801ccd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cd2:	4c 89 ea             	mov    %r13,%rdx
+  801cd5:	4c 89 e6             	mov    %r12,%rsi
+  801cd8:	48 89 df             	mov    %rbx,%rdi
+  801cdb:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	eb d5                	jmp    801cbe <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801ce9:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801ced:	48 89 df             	mov    %rbx,%rdi
+  801cf0:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  801cf7:	00 00 00 
+  801cfa:	ff d0                	call   *%rax
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	0f 88 33 01 00 00    	js     801e37 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d04:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d0b:	00 00 00 
+  801d0e:	4c 89 f0             	mov    %r14,%rax
+  801d11:	48 29 d0             	sub    %rdx,%rax
+  801d14:	48 c1 f8 03          	sar    $0x3,%rax
+  801d18:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d1f:	aa aa aa 
+  801d22:	48 0f af c2          	imul   %rdx,%rax
+  801d26:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d2e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d31:	41 39 06             	cmp    %eax,(%r14)
+  801d34:	75 0d                	jne    801d43 <devfile_read+0xfd>
+  801d36:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d39:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d3d:	0f 84 fb 00 00 00    	je     801e3e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d43:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d48:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d4c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d53:	48 89 c7             	mov    %rax,%rdi
+  801d56:	48 b8 9e 2e 80 00 00 	movabs $0x802e9e,%rax
+  801d5d:	00 00 00 
+  801d60:	ff d0                	call   *%rax
+  801d62:	84 c0                	test   %al,%al
+  801d64:	75 27                	jne    801d8d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d66:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d6b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d70:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d79:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  801d80:	00 00 00 
+  801d83:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d85:	85 c0                	test   %eax,%eax
+  801d87:	0f 88 dc 00 00 00    	js     801e69 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d8d:	44 89 f8             	mov    %r15d,%eax
+  801d90:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d95:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d97:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d9e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d9f:	8b 43 10             	mov    0x10(%rbx),%eax
+  801da2:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801da6:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801da9:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801dae:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801db2:	48 89 df             	mov    %rbx,%rdi
+  801db5:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  801dbc:	00 00 00 
+  801dbf:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801dc1:	48 85 c0             	test   %rax,%rax
+  801dc4:	0f 88 f4 fe ff ff    	js     801cbe <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dca:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dcd:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dd0:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dd3:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dd7:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801ddb:	48 63 d1             	movslq %ecx,%rdx
+  801dde:	48 01 d0             	add    %rdx,%rax
+  801de1:	4d 63 ff             	movslq %r15d,%r15
+  801de4:	4c 29 f8             	sub    %r15,%rax
+  801de7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dec:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801df0:	48 85 c0             	test   %rax,%rax
+  801df3:	0f 8e c5 fe ff ff    	jle    801cbe <devfile_read+0x78>
+    n = MIN(n, res);
+  801df9:	4c 39 e8             	cmp    %r13,%rax
+  801dfc:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e00:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e03:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e07:	48 63 f6             	movslq %esi,%rsi
+  801e0a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e0f:	48 01 c6             	add    %rax,%rsi
+  801e12:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e16:	48 01 c6             	add    %rax,%rsi
+  801e19:	4c 89 ea             	mov    %r13,%rdx
+  801e1c:	4c 89 e7             	mov    %r12,%rdi
+  801e1f:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  801e26:	00 00 00 
+  801e29:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e2b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e2f:	4c 89 e8             	mov    %r13,%rax
+  801e32:	e9 87 fe ff ff       	jmp    801cbe <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e37:	48 98                	cltq
+  801e39:	e9 80 fe ff ff       	jmp    801cbe <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e3e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e42:	41 39 d7             	cmp    %edx,%r15d
+  801e45:	0f 8c f8 fe ff ff    	jl     801d43 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e4b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e4f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e52:	41 39 cf             	cmp    %ecx,%r15d
+  801e55:	0f 8d e8 fe ff ff    	jge    801d43 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e5b:	4d 63 ff             	movslq %r15d,%r15
+  801e5e:	4c 29 f8             	sub    %r15,%rax
+  801e61:	48 63 d2             	movslq %edx,%rdx
+  801e64:	48 01 d0             	add    %rdx,%rax
+  801e67:	eb 87                	jmp    801df0 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e69:	48 98                	cltq
+  801e6b:	e9 4e fe ff ff       	jmp    801cbe <devfile_read+0x78>
+        return E_INVAL;
+  801e70:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e75:	c3                   	ret
+
+0000000000801e76 <fs_channel>:
+fs_channel(bool enable) {
+  801e76:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e78:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e7f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e81:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e86:	40 84 ff             	test   %dil,%dil
+  801e89:	74 47                	je     801ed2 <fs_channel+0x5c>
+  801e8b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e92:	00 00 00 
+  801e95:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e9b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ea2:	00 00 00 
+  801ea5:	3b 08                	cmp    (%rax),%ecx
+  801ea7:	74 29                	je     801ed2 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801ea9:	55                   	push   %rbp
+  801eaa:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801ead:	48 b8 f6 0d 80 00 00 	movabs $0x800df6,%rax
+  801eb4:	00 00 00 
+  801eb7:	ff d0                	call   *%rax
+  801eb9:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ebb:	85 c0                	test   %eax,%eax
+  801ebd:	78 04                	js     801ec3 <fs_channel+0x4d>
+}
+  801ebf:	89 d0                	mov    %edx,%eax
+  801ec1:	5d                   	pop    %rbp
+  801ec2:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ec3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eca:	00 00 00 
+  801ecd:	c6 00 00             	movb   $0x0,(%rax)
+  801ed0:	eb ed                	jmp    801ebf <fs_channel+0x49>
+}
+  801ed2:	89 d0                	mov    %edx,%eax
+  801ed4:	c3                   	ret
+
+0000000000801ed5 <open>:
+open(const char *path, int mode) {
+  801ed5:	55                   	push   %rbp
+  801ed6:	48 89 e5             	mov    %rsp,%rbp
+  801ed9:	41 55                	push   %r13
+  801edb:	41 54                	push   %r12
+  801edd:	53                   	push   %rbx
+  801ede:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee2:	49 89 fc             	mov    %rdi,%r12
+  801ee5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ee8:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  801eef:	00 00 00 
+  801ef2:	ff d0                	call   *%rax
+  801ef4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801efa:	0f 87 8f 00 00 00    	ja     801f8f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f00:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f04:	48 b8 b0 06 80 00 00 	movabs $0x8006b0,%rax
+  801f0b:	00 00 00 
+  801f0e:	ff d0                	call   *%rax
+  801f10:	89 c3                	mov    %eax,%ebx
+  801f12:	85 c0                	test   %eax,%eax
+  801f14:	78 55                	js     801f6b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f16:	4c 89 e6             	mov    %r12,%rsi
+  801f19:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f20:	00 00 00 
+  801f23:	48 89 df             	mov    %rbx,%rdi
+  801f26:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  801f2d:	00 00 00 
+  801f30:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f32:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f39:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f3e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f42:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f47:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	89 c3                	mov    %eax,%ebx
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 1f                	js     801f78 <open+0xa3>
+    return fd2num(fd);
+  801f59:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f5d:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  801f64:	00 00 00 
+  801f67:	ff d0                	call   *%rax
+  801f69:	89 c3                	mov    %eax,%ebx
+}
+  801f6b:	89 d8                	mov    %ebx,%eax
+  801f6d:	48 83 c4 18          	add    $0x18,%rsp
+  801f71:	5b                   	pop    %rbx
+  801f72:	41 5c                	pop    %r12
+  801f74:	41 5d                	pop    %r13
+  801f76:	5d                   	pop    %rbp
+  801f77:	c3                   	ret
+        fd_close(fd, 0);
+  801f78:	be 00 00 00 00       	mov    $0x0,%esi
+  801f7d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f81:	48 b8 cb 07 80 00 00 	movabs $0x8007cb,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+        return res;
+  801f8d:	eb dc                	jmp    801f6b <open+0x96>
+        return -E_BAD_PATH;
+  801f8f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f94:	eb d5                	jmp    801f6b <open+0x96>
+
+0000000000801f96 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	41 56                	push   %r14
+  801f9c:	41 55                	push   %r13
+  801f9e:	41 54                	push   %r12
+  801fa0:	53                   	push   %rbx
+  801fa1:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801fa5:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fac:	00 00 00 
+  801faf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fb4:	49 bd 10 07 80 00 00 	movabs $0x800710,%r13
+  801fbb:	00 00 00 
+  801fbe:	49 be d0 16 80 00 00 	movabs $0x8016d0,%r14
+  801fc5:	00 00 00 
+  801fc8:	eb 0c                	jmp    801fd6 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fca:	83 c3 01             	add    $0x1,%ebx
+  801fcd:	49 83 c4 18          	add    $0x18,%r12
+  801fd1:	83 fb 20             	cmp    $0x20,%ebx
+  801fd4:	74 1d                	je     801ff3 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fd6:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fdb:	74 ed                	je     801fca <file_flush_buffers+0x34>
+  801fdd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe1:	89 df                	mov    %ebx,%edi
+  801fe3:	41 ff d5             	call   *%r13
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 e0                	js     801fca <file_flush_buffers+0x34>
+  801fea:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fee:	41 ff d6             	call   *%r14
+  801ff1:	eb d7                	jmp    801fca <file_flush_buffers+0x34>
+}
+  801ff3:	48 83 c4 10          	add    $0x10,%rsp
+  801ff7:	5b                   	pop    %rbx
+  801ff8:	41 5c                	pop    %r12
+  801ffa:	41 5d                	pop    %r13
+  801ffc:	41 5e                	pop    %r14
+  801ffe:	5d                   	pop    %rbp
+  801fff:	c3                   	ret
+
+0000000000802000 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802000:	55                   	push   %rbp
+  802001:	48 89 e5             	mov    %rsp,%rbp
+  802004:	41 54                	push   %r12
+  802006:	53                   	push   %rbx
+  802007:	49 89 fc             	mov    %rdi,%r12
+  80200a:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80200c:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  802013:	00 00 00 
+  802016:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802018:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80201f:	00 00 00 
+  802022:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802027:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802029:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80202c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802031:	be 00 00 00 00       	mov    $0x0,%esi
+  802036:	bf 02 00 00 00       	mov    $0x2,%edi
+  80203b:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+}
+  802047:	5b                   	pop    %rbx
+  802048:	41 5c                	pop    %r12
+  80204a:	5d                   	pop    %rbp
+  80204b:	c3                   	ret
+
+000000000080204c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80204c:	55                   	push   %rbp
+  80204d:	48 89 e5             	mov    %rsp,%rbp
+  802050:	41 54                	push   %r12
+  802052:	53                   	push   %rbx
+  802053:	49 89 fc             	mov    %rdi,%r12
+  802056:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802059:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802065:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80206a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802071:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802073:	ba 00 00 00 00       	mov    $0x0,%edx
+  802078:	be 00 00 00 00       	mov    $0x0,%esi
+  80207d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802082:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  802089:	00 00 00 
+  80208c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80208e:	85 c0                	test   %eax,%eax
+  802090:	78 3d                	js     8020cf <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802092:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802099:	00 00 00 
+  80209c:	4c 89 e6             	mov    %r12,%rsi
+  80209f:	48 89 df             	mov    %rbx,%rdi
+  8020a2:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  8020a9:	00 00 00 
+  8020ac:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020ae:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020b5:	00 
+  8020b6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020bc:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020c3:	00 
+  8020c4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020cf:	5b                   	pop    %rbx
+  8020d0:	41 5c                	pop    %r12
+  8020d2:	5d                   	pop    %rbp
+  8020d3:	c3                   	ret
+
+00000000008020d4 <remove>:
+remove(const char *path) {
+  8020d4:	55                   	push   %rbp
+  8020d5:	48 89 e5             	mov    %rsp,%rbp
+  8020d8:	53                   	push   %rbx
+  8020d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020dd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020e0:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+  8020ec:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020f2:	77 3a                	ja     80212e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020f4:	48 89 de             	mov    %rbx,%rsi
+  8020f7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020fe:	00 00 00 
+  802101:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  802108:	00 00 00 
+  80210b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80210d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802112:	be 00 00 00 00       	mov    $0x0,%esi
+  802117:	bf 07 00 00 00       	mov    $0x7,%edi
+  80211c:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+}
+  802128:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80212c:	c9                   	leave
+  80212d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80212e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802133:	eb f3                	jmp    802128 <remove+0x54>
+
+0000000000802135 <sync>:
+sync(void) {
+  802135:	55                   	push   %rbp
+  802136:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802139:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802145:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214a:	be 00 00 00 00       	mov    $0x0,%esi
+  80214f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802154:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  80215b:	00 00 00 
+  80215e:	ff d0                	call   *%rax
+}
+  802160:	5d                   	pop    %rbp
+  802161:	c3                   	ret
+
+0000000000802162 <fsync>:
+fsync(int fdnum) {
+  802162:	55                   	push   %rbp
+  802163:	48 89 e5             	mov    %rsp,%rbp
+  802166:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80216a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80216e:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80217a:	85 c0                	test   %eax,%eax
+  80217c:	78 4b                	js     8021c9 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80217e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802182:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802189:	00 00 00 
+  80218c:	8b 00                	mov    (%rax),%eax
+  80218e:	39 02                	cmp    %eax,(%rdx)
+  802190:	75 39                	jne    8021cb <fsync+0x69>
+    file_flush_buffers();
+  802192:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80219e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021a2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021a5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021ac:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021bd:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+}
+  8021c9:	c9                   	leave
+  8021ca:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021cb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d0:	eb f7                	jmp    8021c9 <fsync+0x67>
+
+00000000008021d2 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021d2:	55                   	push   %rbp
+  8021d3:	48 89 e5             	mov    %rsp,%rbp
+  8021d6:	53                   	push   %rbx
+  8021d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021db:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021ed:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021f9:	85 c0                	test   %eax,%eax
+  8021fb:	78 2d                	js     80222a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021fd:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802204:	00 00 00 
+  802207:	48 8b 10             	mov    (%rax),%rdx
+  80220a:	48 89 13             	mov    %rdx,(%rbx)
+  80220d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802211:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802215:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802219:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80221d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802221:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802225:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80222e:	c9                   	leave
+  80222f:	c3                   	ret
+
+0000000000802230 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802230:	55                   	push   %rbp
+  802231:	48 89 e5             	mov    %rsp,%rbp
+  802234:	53                   	push   %rbx
+  802235:	48 83 ec 08          	sub    $0x8,%rsp
+  802239:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80223c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802241:	be 00 00 00 00       	mov    $0x0,%esi
+  802246:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80224b:	48 b8 67 14 80 00 00 	movabs $0x801467,%rax
+  802252:	00 00 00 
+  802255:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802257:	85 c0                	test   %eax,%eax
+  802259:	78 3d                	js     802298 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80225b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802262:	00 00 00 
+  802265:	48 8b 10             	mov    (%rax),%rdx
+  802268:	48 89 13             	mov    %rdx,(%rbx)
+  80226b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80226f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802273:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802277:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80227b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80227f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802283:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802287:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80228b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80228f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  802293:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802298:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80229c:	c9                   	leave
+  80229d:	c3                   	ret
+
+000000000080229e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80229e:	55                   	push   %rbp
+  80229f:	48 89 e5             	mov    %rsp,%rbp
+  8022a2:	41 57                	push   %r15
+  8022a4:	41 56                	push   %r14
+  8022a6:	41 55                	push   %r13
+  8022a8:	41 54                	push   %r12
+  8022aa:	53                   	push   %rbx
+  8022ab:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022af:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022b6:	00 
+  8022b7:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022be:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022c4:	0f 85 43 01 00 00    	jne    80240d <munmap+0x16f>
+  8022ca:	49 89 ff             	mov    %rdi,%r15
+  8022cd:	4c 39 f7             	cmp    %r14,%rdi
+  8022d0:	0f 87 37 01 00 00    	ja     80240d <munmap+0x16f>
+  8022d6:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022dd:	00 00 00 
+  8022e0:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022e6:	eb 2c                	jmp    802314 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022e8:	4c 39 f8             	cmp    %r15,%rax
+  8022eb:	0f 83 85 00 00 00    	jae    802376 <munmap+0xd8>
+            m->mm_end = start;
+  8022f1:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022f6:	48 83 c3 18          	add    $0x18,%rbx
+  8022fa:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802301:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802308:	00 00 00 
+  80230b:	48 39 c3             	cmp    %rax,%rbx
+  80230e:	0f 84 d0 00 00 00    	je     8023e4 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802314:	49 89 dc             	mov    %rbx,%r12
+  802317:	48 8b 03             	mov    (%rbx),%rax
+  80231a:	4c 39 f0             	cmp    %r14,%rax
+  80231d:	73 d7                	jae    8022f6 <munmap+0x58>
+  80231f:	48 85 c0             	test   %rax,%rax
+  802322:	74 d2                	je     8022f6 <munmap+0x58>
+  802324:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802328:	49 39 d7             	cmp    %rdx,%r15
+  80232b:	73 c9                	jae    8022f6 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80232d:	49 39 d6             	cmp    %rdx,%r14
+  802330:	73 b6                	jae    8022e8 <munmap+0x4a>
+  802332:	49 39 c7             	cmp    %rax,%r15
+  802335:	76 b1                	jbe    8022e8 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802337:	4c 89 ef             	mov    %r13,%rdi
+  80233a:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  802341:	00 00 00 
+  802344:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  802346:	48 85 c0             	test   %rax,%rax
+  802349:	0f 84 c5 00 00 00    	je     802414 <munmap+0x176>
+            *tail = *m;
+  80234f:	48 8b 13             	mov    (%rbx),%rdx
+  802352:	48 89 10             	mov    %rdx,(%rax)
+  802355:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802359:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80235d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802361:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  802365:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802368:	44 89 f2             	mov    %r14d,%edx
+  80236b:	2b 13                	sub    (%rbx),%edx
+  80236d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802370:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  802374:	eb 80                	jmp    8022f6 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  802376:	49 39 d6             	cmp    %rdx,%r14
+  802379:	73 18                	jae    802393 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80237b:	44 89 f2             	mov    %r14d,%edx
+  80237e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802383:	29 c2                	sub    %eax,%edx
+  802385:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80238a:	4d 89 34 24          	mov    %r14,(%r12)
+  80238e:	e9 63 ff ff ff       	jmp    8022f6 <munmap+0x58>
+    m->mm_start = 0;
+  802393:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80239a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80239b:	4c 89 e6             	mov    %r12,%rsi
+  80239e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023a5:	00 00 00 
+  8023a8:	48 29 c6             	sub    %rax,%rsi
+  8023ab:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023af:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023b6:	aa aa aa 
+  8023b9:	48 0f af f0          	imul   %rax,%rsi
+  8023bd:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023c1:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023c6:	48 01 c6             	add    %rax,%rsi
+  8023c9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d3:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  8023da:	00 00 00 
+  8023dd:	ff d0                	call   *%rax
+}
+  8023df:	e9 12 ff ff ff       	jmp    8022f6 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023e4:	4c 89 f2             	mov    %r14,%rdx
+  8023e7:	4c 29 fa             	sub    %r15,%rdx
+  8023ea:	4c 89 fe             	mov    %r15,%rsi
+  8023ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f2:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  8023f9:	00 00 00 
+  8023fc:	ff d0                	call   *%rax
+}
+  8023fe:	48 83 c4 08          	add    $0x8,%rsp
+  802402:	5b                   	pop    %rbx
+  802403:	41 5c                	pop    %r12
+  802405:	41 5d                	pop    %r13
+  802407:	41 5e                	pop    %r14
+  802409:	41 5f                	pop    %r15
+  80240b:	5d                   	pop    %rbp
+  80240c:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80240d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802412:	eb ea                	jmp    8023fe <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802414:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802419:	eb e3                	jmp    8023fe <munmap+0x160>
+
+000000000080241b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80241b:	55                   	push   %rbp
+  80241c:	48 89 e5             	mov    %rsp,%rbp
+  80241f:	41 57                	push   %r15
+  802421:	41 56                	push   %r14
+  802423:	41 55                	push   %r13
+  802425:	41 54                	push   %r12
+  802427:	53                   	push   %rbx
+  802428:	48 83 ec 28          	sub    $0x28,%rsp
+  80242c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802430:	49 89 f5             	mov    %rsi,%r13
+  802433:	41 89 d6             	mov    %edx,%r14d
+  802436:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802439:	41 89 cc             	mov    %ecx,%r12d
+  80243c:	44 89 c7             	mov    %r8d,%edi
+  80243f:	44 89 cb             	mov    %r9d,%ebx
+  802442:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802446:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80244a:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  802451:	00 00 00 
+  802454:	ff d0                	call   *%rax
+  802456:	41 89 c7             	mov    %eax,%r15d
+  802459:	85 c0                	test   %eax,%eax
+  80245b:	0f 88 ae 01 00 00    	js     80260f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802461:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802465:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80246c:	00 00 00 
+  80246f:	8b 32                	mov    (%rdx),%esi
+  802471:	39 30                	cmp    %esi,(%rax)
+  802473:	0f 85 7a 02 00 00    	jne    8026f3 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802479:	8b 40 08             	mov    0x8(%rax),%eax
+  80247c:	83 e0 03             	and    $0x3,%eax
+  80247f:	83 f8 01             	cmp    $0x1,%eax
+  802482:	0f 84 76 02 00 00    	je     8026fe <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802488:	4d 85 ed             	test   %r13,%r13
+  80248b:	0f 84 78 02 00 00    	je     802709 <mmap+0x2ee>
+  802491:	85 db                	test   %ebx,%ebx
+  802493:	0f 88 70 02 00 00    	js     802709 <mmap+0x2ee>
+  802499:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80249f:	41 89 df             	mov    %ebx,%r15d
+  8024a2:	0f 85 6c 02 00 00    	jne    802714 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8024a8:	44 89 f0             	mov    %r14d,%eax
+  8024ab:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024ae:	83 f8 04             	cmp    $0x4,%eax
+  8024b1:	0f 85 68 02 00 00    	jne    80271f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024b7:	44 89 e1             	mov    %r12d,%ecx
+  8024ba:	83 e1 01             	and    $0x1,%ecx
+  8024bd:	0f 95 c2             	setne  %dl
+  8024c0:	44 89 e0             	mov    %r12d,%eax
+  8024c3:	d1 e8                	shr    %eax
+  8024c5:	83 f0 01             	xor    $0x1,%eax
+  8024c8:	83 e0 01             	and    $0x1,%eax
+  8024cb:	38 c2                	cmp    %al,%dl
+  8024cd:	0f 85 57 02 00 00    	jne    80272a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024d3:	85 c9                	test   %ecx,%ecx
+  8024d5:	74 0a                	je     8024e1 <mmap+0xc6>
+  8024d7:	41 f6 c6 02          	test   $0x2,%r14b
+  8024db:	0f 85 54 02 00 00    	jne    802735 <mmap+0x31a>
+    file_flush_buffers();
+  8024e1:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  8024e8:	00 00 00 
+  8024eb:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024ed:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024f4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024fb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024ff:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  802502:	41 f6 c4 04          	test   $0x4,%r12b
+  802506:	0f 84 15 01 00 00    	je     802621 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80250c:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80250f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802515:	0f 85 25 02 00 00    	jne    802740 <mmap+0x325>
+  80251b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80251f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802526:	00 00 00 
+  802529:	48 39 c2             	cmp    %rax,%rdx
+  80252c:	0f 82 19 02 00 00    	jb     80274b <mmap+0x330>
+  802532:	48 39 c7             	cmp    %rax,%rdi
+  802535:	0f 87 10 02 00 00    	ja     80274b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80253b:	4c 89 ee             	mov    %r13,%rsi
+  80253e:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  802545:	00 00 00 
+  802548:	ff d0                	call   *%rax
+  80254a:	85 c0                	test   %eax,%eax
+  80254c:	0f 88 04 02 00 00    	js     802756 <mmap+0x33b>
+    if (!handler) {
+  802552:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802559:	00 00 00 
+  80255c:	80 38 00             	cmpb   $0x0,(%rax)
+  80255f:	75 2b                	jne    80258c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802561:	48 bf 36 13 80 00 00 	movabs $0x801336,%rdi
+  802568:	00 00 00 
+  80256b:	48 b8 93 42 80 00 00 	movabs $0x804293,%rax
+  802572:	00 00 00 
+  802575:	ff d0                	call   *%rax
+  802577:	85 c0                	test   %eax,%eax
+  802579:	0f 88 ea 01 00 00    	js     802769 <mmap+0x34e>
+        handler = 1;
+  80257f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802586:	00 00 00 
+  802589:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80258c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802590:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  802597:	00 00 00 
+  80259a:	ff d0                	call   *%rax
+  80259c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80259f:	48 85 c0             	test   %rax,%rax
+  8025a2:	0f 84 c9 01 00 00    	je     802771 <mmap+0x356>
+    m->mm_start = va;
+  8025a8:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025ab:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025af:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025b3:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025b6:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025ba:	44 89 e0             	mov    %r12d,%eax
+  8025bd:	c1 e0 06             	shl    $0x6,%eax
+  8025c0:	25 80 00 00 00       	and    $0x80,%eax
+  8025c5:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025c8:	09 f0                	or     %esi,%eax
+  8025ca:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025ce:	41 f6 c4 08          	test   $0x8,%r12b
+  8025d2:	74 31                	je     802605 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025d4:	48 39 d3             	cmp    %rdx,%rbx
+  8025d7:	73 2c                	jae    802605 <mmap+0x1ea>
+  8025d9:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025de:	48 89 de             	mov    %rbx,%rsi
+  8025e1:	4c 89 f7             	mov    %r14,%rdi
+  8025e4:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  8025eb:	00 00 00 
+  8025ee:	ff d0                	call   *%rax
+  8025f0:	49 89 c4             	mov    %rax,%r12
+  8025f3:	48 85 c0             	test   %rax,%rax
+  8025f6:	0f 8e d7 00 00 00    	jle    8026d3 <mmap+0x2b8>
+            va += n;
+  8025fc:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025ff:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  802603:	72 d4                	jb     8025d9 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  802605:	49 8b 06             	mov    (%r14),%rax
+  802608:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80260c:	48 89 06             	mov    %rax,(%rsi)
+}
+  80260f:	44 89 f8             	mov    %r15d,%eax
+  802612:	48 83 c4 28          	add    $0x28,%rsp
+  802616:	5b                   	pop    %rbx
+  802617:	41 5c                	pop    %r12
+  802619:	41 5d                	pop    %r13
+  80261b:	41 5e                	pop    %r14
+  80261d:	41 5f                	pop    %r15
+  80261f:	5d                   	pop    %rbp
+  802620:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802621:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802628:	00 00 00 
+  80262b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80262e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802635:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802638:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80263d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802644:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802647:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80264e:	00 00 00 
+  802651:	48 39 d7             	cmp    %rdx,%rdi
+  802654:	73 1c                	jae    802672 <mmap+0x257>
+        return -E_NO_MEM;
+  802656:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80265c:	eb b1                	jmp    80260f <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80265e:	48 83 c0 01          	add    $0x1,%rax
+  802662:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802666:	77 3f                	ja     8026a7 <mmap+0x28c>
+  802668:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80266d:	48 39 d7             	cmp    %rdx,%rdi
+  802670:	72 2a                	jb     80269c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802672:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  802676:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80267a:	48 39 d1             	cmp    %rdx,%rcx
+  80267d:	73 df                	jae    80265e <mmap+0x243>
+  80267f:	48 85 c9             	test   %rcx,%rcx
+  802682:	74 da                	je     80265e <mmap+0x243>
+  802684:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802688:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80268d:	48 39 d3             	cmp    %rdx,%rbx
+  802690:	73 cc                	jae    80265e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802692:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269a:	eb cc                	jmp    802668 <mmap+0x24d>
+        return -E_NO_MEM;
+  80269c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026a2:	e9 68 ff ff ff       	jmp    80260f <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8026a7:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026ac:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026b3:	00 00 00 
+  8026b6:	48 39 c2             	cmp    %rax,%rdx
+  8026b9:	0f 82 9f 00 00 00    	jb     80275e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026bf:	48 85 db             	test   %rbx,%rbx
+  8026c2:	0f 85 8a fe ff ff    	jne    802552 <mmap+0x137>
+        return -E_NO_MEM;
+  8026c8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026ce:	e9 3c ff ff ff       	jmp    80260f <mmap+0x1f4>
+        if (n < 0) {
+  8026d3:	0f 89 2c ff ff ff    	jns    802605 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026d9:	49 8b 3e             	mov    (%r14),%rdi
+  8026dc:	4c 89 ee             	mov    %r13,%rsi
+  8026df:	48 b8 9e 22 80 00 00 	movabs $0x80229e,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+            return n;
+  8026eb:	45 89 e7             	mov    %r12d,%r15d
+  8026ee:	e9 1c ff ff ff       	jmp    80260f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026f3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026f9:	e9 11 ff ff ff       	jmp    80260f <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026fe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802704:	e9 06 ff ff ff       	jmp    80260f <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802709:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270f:	e9 fb fe ff ff       	jmp    80260f <mmap+0x1f4>
+  802714:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80271a:	e9 f0 fe ff ff       	jmp    80260f <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80271f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802725:	e9 e5 fe ff ff       	jmp    80260f <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80272a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802730:	e9 da fe ff ff       	jmp    80260f <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802735:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80273b:	e9 cf fe ff ff       	jmp    80260f <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802740:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802746:	e9 c4 fe ff ff       	jmp    80260f <mmap+0x1f4>
+  80274b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802751:	e9 b9 fe ff ff       	jmp    80260f <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802756:	41 89 c7             	mov    %eax,%r15d
+  802759:	e9 b1 fe ff ff       	jmp    80260f <mmap+0x1f4>
+        return -E_NO_MEM;
+  80275e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802764:	e9 a6 fe ff ff       	jmp    80260f <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802769:	41 89 c7             	mov    %eax,%r15d
+  80276c:	e9 9e fe ff ff       	jmp    80260f <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802771:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802777:	e9 93 fe ff ff       	jmp    80260f <mmap+0x1f4>
+
+000000000080277c <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80277c:	55                   	push   %rbp
+  80277d:	48 89 e5             	mov    %rsp,%rbp
+  802780:	41 54                	push   %r12
+  802782:	53                   	push   %rbx
+  802783:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802786:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+  802792:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802795:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  80279c:	00 00 00 
+  80279f:	48 89 df             	mov    %rbx,%rdi
+  8027a2:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  8027a9:	00 00 00 
+  8027ac:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027ae:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027b3:	41 2b 04 24          	sub    (%r12),%eax
+  8027b7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027c4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027c7:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027ce:	00 00 00 
+  8027d1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027dd:	5b                   	pop    %rbx
+  8027de:	41 5c                	pop    %r12
+  8027e0:	5d                   	pop    %rbp
+  8027e1:	c3                   	ret
+
+00000000008027e2 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027e2:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027e5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027eb:	8b 17                	mov    (%rdi),%edx
+  8027ed:	85 d2                	test   %edx,%edx
+  8027ef:	75 01                	jne    8027f2 <pipe_wakeup+0x10>
+  8027f1:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027f2:	55                   	push   %rbp
+  8027f3:	48 89 e5             	mov    %rsp,%rbp
+  8027f6:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027f9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027ff:	be 00 04 00 00       	mov    $0x400,%esi
+  802804:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+}
+  802810:	5d                   	pop    %rbp
+  802811:	c3                   	ret
+
+0000000000802812 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802812:	55                   	push   %rbp
+  802813:	48 89 e5             	mov    %rsp,%rbp
+  802816:	41 55                	push   %r13
+  802818:	41 54                	push   %r12
+  80281a:	53                   	push   %rbx
+  80281b:	48 83 ec 08          	sub    $0x8,%rsp
+  80281f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802822:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  802829:	00 00 00 
+  80282c:	ff d0                	call   *%rax
+  80282e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802831:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802836:	4c 89 e6             	mov    %r12,%rsi
+  802839:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283e:	49 bc f5 02 80 00 00 	movabs $0x8002f5,%r12
+  802845:	00 00 00 
+  802848:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80284b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80284f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802853:	49 bd e2 27 80 00 00 	movabs $0x8027e2,%r13
+  80285a:	00 00 00 
+  80285d:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802860:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802864:	48 89 de             	mov    %rbx,%rsi
+  802867:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80286a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80286f:	48 89 de             	mov    %rbx,%rsi
+  802872:	bf 00 00 00 00       	mov    $0x0,%edi
+  802877:	41 ff d4             	call   *%r12
+  80287a:	48 83 c4 08          	add    $0x8,%rsp
+  80287e:	5b                   	pop    %rbx
+  80287f:	41 5c                	pop    %r12
+  802881:	41 5d                	pop    %r13
+  802883:	5d                   	pop    %rbp
+  802884:	c3                   	ret
+
+0000000000802885 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802885:	55                   	push   %rbp
+  802886:	48 89 e5             	mov    %rsp,%rbp
+  802889:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80288c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802891:	be 00 10 00 00       	mov    $0x1000,%esi
+  802896:	48 b8 38 02 80 00 00 	movabs $0x800238,%rax
+  80289d:	00 00 00 
+  8028a0:	ff d0                	call   *%rax
+  8028a2:	85 c0                	test   %eax,%eax
+  8028a4:	0f 94 c0             	sete   %al
+  8028a7:	0f b6 c0             	movzbl %al,%eax
+}
+  8028aa:	5d                   	pop    %rbp
+  8028ab:	c3                   	ret
+
+00000000008028ac <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028ac:	55                   	push   %rbp
+  8028ad:	48 89 e5             	mov    %rsp,%rbp
+  8028b0:	41 57                	push   %r15
+  8028b2:	41 56                	push   %r14
+  8028b4:	41 55                	push   %r13
+  8028b6:	41 54                	push   %r12
+  8028b8:	53                   	push   %rbx
+  8028b9:	48 83 ec 38          	sub    $0x38,%rsp
+  8028bd:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028c1:	49 89 f4             	mov    %rsi,%r12
+  8028c4:	49 89 d7             	mov    %rdx,%r15
+  8028c7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028cb:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  8028d2:	00 00 00 
+  8028d5:	ff d0                	call   *%rax
+  8028d7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028da:	4d 85 ff             	test   %r15,%r15
+  8028dd:	0f 84 f1 00 00 00    	je     8029d4 <devpipe_write+0x128>
+  8028e3:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028e7:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028eb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028ef:	49 bd 85 28 80 00 00 	movabs $0x802885,%r13
+  8028f6:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028f9:	49 bf e2 27 80 00 00 	movabs $0x8027e2,%r15
+  802900:	00 00 00 
+  802903:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802907:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80290b:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80290f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802912:	48 63 ce             	movslq %esi,%rcx
+  802915:	48 63 03             	movslq (%rbx),%rax
+  802918:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80291e:	48 39 c1             	cmp    %rax,%rcx
+  802921:	72 64                	jb     802987 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802923:	48 89 de             	mov    %rbx,%rsi
+  802926:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80292a:	41 ff d5             	call   *%r13
+  80292d:	85 c0                	test   %eax,%eax
+  80292f:	0f 85 b9 00 00 00    	jne    8029ee <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802935:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802939:	4c 89 f7             	mov    %r14,%rdi
+  80293c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80293f:	8b 43 04             	mov    0x4(%rbx),%eax
+  802942:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802949:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802950:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802956:	8b 03                	mov    (%rbx),%eax
+  802958:	41 39 c4             	cmp    %eax,%r12d
+  80295b:	75 b2                	jne    80290f <devpipe_write+0x63>
+  80295d:	48 89 de             	mov    %rbx,%rsi
+  802960:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802964:	41 ff d5             	call   *%r13
+  802967:	85 c0                	test   %eax,%eax
+  802969:	75 a0                	jne    80290b <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80296b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802970:	44 89 e6             	mov    %r12d,%esi
+  802973:	48 89 df             	mov    %rbx,%rdi
+  802976:	48 b8 bd 05 80 00 00 	movabs $0x8005bd,%rax
+  80297d:	00 00 00 
+  802980:	ff d0                	call   *%rax
+  802982:	e9 7c ff ff ff       	jmp    802903 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802987:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80298b:	41 0f b6 38          	movzbl (%r8),%edi
+  80298f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802996:	80 80 80 
+  802999:	48 89 c8             	mov    %rcx,%rax
+  80299c:	48 f7 e2             	mul    %rdx
+  80299f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029a3:	48 89 d0             	mov    %rdx,%rax
+  8029a6:	48 c1 e0 08          	shl    $0x8,%rax
+  8029aa:	48 29 d0             	sub    %rdx,%rax
+  8029ad:	48 c1 e0 04          	shl    $0x4,%rax
+  8029b1:	48 29 c1             	sub    %rax,%rcx
+  8029b4:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029b9:	83 c6 01             	add    $0x1,%esi
+  8029bc:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029bf:	49 83 c0 01          	add    $0x1,%r8
+  8029c3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029c7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029cb:	49 39 c0             	cmp    %rax,%r8
+  8029ce:	0f 85 2f ff ff ff    	jne    802903 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029d4:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029d8:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029dc:	48 b8 e2 27 80 00 00 	movabs $0x8027e2,%rax
+  8029e3:	00 00 00 
+  8029e6:	ff d0                	call   *%rax
+    return n;
+  8029e8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029ec:	eb 05                	jmp    8029f3 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f3:	48 83 c4 38          	add    $0x38,%rsp
+  8029f7:	5b                   	pop    %rbx
+  8029f8:	41 5c                	pop    %r12
+  8029fa:	41 5d                	pop    %r13
+  8029fc:	41 5e                	pop    %r14
+  8029fe:	41 5f                	pop    %r15
+  802a00:	5d                   	pop    %rbp
+  802a01:	c3                   	ret
+
+0000000000802a02 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a02:	55                   	push   %rbp
+  802a03:	48 89 e5             	mov    %rsp,%rbp
+  802a06:	41 57                	push   %r15
+  802a08:	41 56                	push   %r14
+  802a0a:	41 55                	push   %r13
+  802a0c:	41 54                	push   %r12
+  802a0e:	53                   	push   %rbx
+  802a0f:	48 83 ec 28          	sub    $0x28,%rsp
+  802a13:	49 89 fd             	mov    %rdi,%r13
+  802a16:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a1a:	49 89 d4             	mov    %rdx,%r12
+  802a1d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a21:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  802a28:	00 00 00 
+  802a2b:	ff d0                	call   *%rax
+  802a2d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a30:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a36:	49 bf 85 28 80 00 00 	movabs $0x802885,%r15
+  802a3d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a40:	4d 85 e4             	test   %r12,%r12
+  802a43:	0f 84 d5 00 00 00    	je     802b1e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a49:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a4d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a51:	8b 03                	mov    (%rbx),%eax
+  802a53:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a56:	75 7a                	jne    802ad2 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a58:	4d 85 f6             	test   %r14,%r14
+  802a5b:	75 50                	jne    802aad <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a5d:	48 89 de             	mov    %rbx,%rsi
+  802a60:	4c 89 ef             	mov    %r13,%rdi
+  802a63:	41 ff d7             	call   *%r15
+  802a66:	85 c0                	test   %eax,%eax
+  802a68:	0f 85 c9 00 00 00    	jne    802b37 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a6e:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a71:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a78:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a7e:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a81:	41 39 c4             	cmp    %eax,%r12d
+  802a84:	75 cb                	jne    802a51 <devpipe_read+0x4f>
+  802a86:	48 89 de             	mov    %rbx,%rsi
+  802a89:	4c 89 ef             	mov    %r13,%rdi
+  802a8c:	41 ff d7             	call   *%r15
+  802a8f:	85 c0                	test   %eax,%eax
+  802a91:	75 be                	jne    802a51 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a93:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a98:	44 89 e6             	mov    %r12d,%esi
+  802a9b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a9f:	48 b8 bd 05 80 00 00 	movabs $0x8005bd,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+  802aab:	eb a4                	jmp    802a51 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802aad:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802ab1:	48 89 de             	mov    %rbx,%rsi
+  802ab4:	48 b8 e2 27 80 00 00 	movabs $0x8027e2,%rax
+  802abb:	00 00 00 
+  802abe:	ff d0                	call   *%rax
+                return i;
+  802ac0:	4c 89 f0             	mov    %r14,%rax
+}
+  802ac3:	48 83 c4 28          	add    $0x28,%rsp
+  802ac7:	5b                   	pop    %rbx
+  802ac8:	41 5c                	pop    %r12
+  802aca:	41 5d                	pop    %r13
+  802acc:	41 5e                	pop    %r14
+  802ace:	41 5f                	pop    %r15
+  802ad0:	5d                   	pop    %rbp
+  802ad1:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ad2:	48 63 c8             	movslq %eax,%rcx
+  802ad5:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802adc:	80 80 80 
+  802adf:	48 89 c8             	mov    %rcx,%rax
+  802ae2:	48 f7 e2             	mul    %rdx
+  802ae5:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802ae9:	48 89 d0             	mov    %rdx,%rax
+  802aec:	48 c1 e0 08          	shl    $0x8,%rax
+  802af0:	48 29 d0             	sub    %rdx,%rax
+  802af3:	48 c1 e0 04          	shl    $0x4,%rax
+  802af7:	48 89 c2             	mov    %rax,%rdx
+  802afa:	48 89 c8             	mov    %rcx,%rax
+  802afd:	48 29 d0             	sub    %rdx,%rax
+  802b00:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b05:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b09:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b0d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b10:	49 83 c6 01          	add    $0x1,%r14
+  802b14:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b18:	0f 85 2b ff ff ff    	jne    802a49 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b1e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b22:	48 89 de             	mov    %rbx,%rsi
+  802b25:	48 b8 e2 27 80 00 00 	movabs $0x8027e2,%rax
+  802b2c:	00 00 00 
+  802b2f:	ff d0                	call   *%rax
+    return n;
+  802b31:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b35:	eb 8c                	jmp    802ac3 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b37:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b3c:	eb 85                	jmp    802ac3 <devpipe_read+0xc1>
+
+0000000000802b3e <pipe>:
+pipe(int pfd[2]) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	41 55                	push   %r13
+  802b44:	41 54                	push   %r12
+  802b46:	53                   	push   %rbx
+  802b47:	48 83 ec 18          	sub    $0x18,%rsp
+  802b4b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b4e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b52:	48 b8 b0 06 80 00 00 	movabs $0x8006b0,%rax
+  802b59:	00 00 00 
+  802b5c:	ff d0                	call   *%rax
+  802b5e:	89 c3                	mov    %eax,%ebx
+  802b60:	85 c0                	test   %eax,%eax
+  802b62:	0f 88 a0 01 00 00    	js     802d08 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b68:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b6d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b72:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7b:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  802b82:	00 00 00 
+  802b85:	ff d0                	call   *%rax
+  802b87:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b89:	85 c0                	test   %eax,%eax
+  802b8b:	0f 88 77 01 00 00    	js     802d08 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b91:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b95:	48 b8 b0 06 80 00 00 	movabs $0x8006b0,%rax
+  802b9c:	00 00 00 
+  802b9f:	ff d0                	call   *%rax
+  802ba1:	89 c3                	mov    %eax,%ebx
+  802ba3:	85 c0                	test   %eax,%eax
+  802ba5:	0f 88 43 01 00 00    	js     802cee <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802bab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bb5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bbe:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  802bc5:	00 00 00 
+  802bc8:	ff d0                	call   *%rax
+  802bca:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bcc:	85 c0                	test   %eax,%eax
+  802bce:	0f 88 1a 01 00 00    	js     802cee <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bd4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bd8:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+  802be4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802be7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bf1:	48 89 c6             	mov    %rax,%rsi
+  802bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf9:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  802c00:	00 00 00 
+  802c03:	ff d0                	call   *%rax
+  802c05:	89 c3                	mov    %eax,%ebx
+  802c07:	85 c0                	test   %eax,%eax
+  802c09:	0f 88 c5 00 00 00    	js     802cd4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c0f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c13:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+  802c1f:	48 89 c1             	mov    %rax,%rcx
+  802c22:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c28:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c33:	4c 89 ee             	mov    %r13,%rsi
+  802c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c3b:	48 b8 a5 02 80 00 00 	movabs $0x8002a5,%rax
+  802c42:	00 00 00 
+  802c45:	ff d0                	call   *%rax
+  802c47:	89 c3                	mov    %eax,%ebx
+  802c49:	85 c0                	test   %eax,%eax
+  802c4b:	78 6e                	js     802cbb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c52:	4c 89 ef             	mov    %r13,%rdi
+  802c55:	48 b8 14 02 80 00 00 	movabs $0x800214,%rax
+  802c5c:	00 00 00 
+  802c5f:	ff d0                	call   *%rax
+  802c61:	83 f8 02             	cmp    $0x2,%eax
+  802c64:	0f 85 ab 00 00 00    	jne    802d15 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c6a:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c71:	00 00 
+  802c73:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c77:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c79:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c7d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c84:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c88:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c8a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c8e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c95:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c99:	48 bb 82 06 80 00 00 	movabs $0x800682,%rbx
+  802ca0:	00 00 00 
+  802ca3:	ff d3                	call   *%rbx
+  802ca5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802ca9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cad:	ff d3                	call   *%rbx
+  802caf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802cb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cb9:	eb 4d                	jmp    802d08 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc0:	4c 89 ee             	mov    %r13,%rsi
+  802cc3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc8:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  802ccf:	00 00 00 
+  802cd2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cd4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cd9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cdd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce2:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  802ce9:	00 00 00 
+  802cec:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cf3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cfc:	48 b8 f5 02 80 00 00 	movabs $0x8002f5,%rax
+  802d03:	00 00 00 
+  802d06:	ff d0                	call   *%rax
+}
+  802d08:	89 d8                	mov    %ebx,%eax
+  802d0a:	48 83 c4 18          	add    $0x18,%rsp
+  802d0e:	5b                   	pop    %rbx
+  802d0f:	41 5c                	pop    %r12
+  802d11:	41 5d                	pop    %r13
+  802d13:	5d                   	pop    %rbp
+  802d14:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d15:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d1c:	00 00 00 
+  802d1f:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d26:	00 00 00 
+  802d29:	be 50 00 00 00       	mov    $0x50,%esi
+  802d2e:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d35:	00 00 00 
+  802d38:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d3d:	49 b8 6d 33 80 00 00 	movabs $0x80336d,%r8
+  802d44:	00 00 00 
+  802d47:	41 ff d0             	call   *%r8
+
+0000000000802d4a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d4a:	55                   	push   %rbp
+  802d4b:	48 89 e5             	mov    %rsp,%rbp
+  802d4e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d52:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d56:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  802d5d:	00 00 00 
+  802d60:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d62:	85 c0                	test   %eax,%eax
+  802d64:	78 23                	js     802d89 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d66:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d6a:	48 b8 94 06 80 00 00 	movabs $0x800694,%rax
+  802d71:	00 00 00 
+  802d74:	ff d0                	call   *%rax
+  802d76:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d79:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d7d:	48 b8 85 28 80 00 00 	movabs $0x802885,%rax
+  802d84:	00 00 00 
+  802d87:	ff d0                	call   *%rax
+}
+  802d89:	c9                   	leave
+  802d8a:	c3                   	ret
+
+0000000000802d8b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d8b:	48 89 f8             	mov    %rdi,%rax
+  802d8e:	48 c1 e8 27          	shr    $0x27,%rax
+  802d92:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d99:	01 00 00 
+  802d9c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da0:	f6 c2 01             	test   $0x1,%dl
+  802da3:	74 6d                	je     802e12 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802da5:	48 89 f8             	mov    %rdi,%rax
+  802da8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802dac:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802db3:	01 00 00 
+  802db6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dba:	f6 c2 01             	test   $0x1,%dl
+  802dbd:	74 62                	je     802e21 <get_uvpt_entry+0x96>
+  802dbf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dc6:	01 00 00 
+  802dc9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dcd:	f6 c2 80             	test   $0x80,%dl
+  802dd0:	75 4f                	jne    802e21 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dd2:	48 89 f8             	mov    %rdi,%rax
+  802dd5:	48 c1 e8 15          	shr    $0x15,%rax
+  802dd9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802de0:	01 00 00 
+  802de3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802de7:	f6 c2 01             	test   $0x1,%dl
+  802dea:	74 44                	je     802e30 <get_uvpt_entry+0xa5>
+  802dec:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802df3:	01 00 00 
+  802df6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dfa:	f6 c2 80             	test   $0x80,%dl
+  802dfd:	75 31                	jne    802e30 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802dff:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e03:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e0a:	01 00 00 
+  802e0d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e11:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e12:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e19:	01 00 00 
+  802e1c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e20:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e21:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e28:	01 00 00 
+  802e2b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e2f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e30:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e37:	01 00 00 
+  802e3a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e3e:	c3                   	ret
+
+0000000000802e3f <get_prot>:
+
+int
+get_prot(void *va) {
+  802e3f:	55                   	push   %rbp
+  802e40:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e43:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e52:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e57:	89 c1                	mov    %eax,%ecx
+  802e59:	83 c9 04             	or     $0x4,%ecx
+  802e5c:	f6 c2 01             	test   $0x1,%dl
+  802e5f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e62:	89 c1                	mov    %eax,%ecx
+  802e64:	83 c9 02             	or     $0x2,%ecx
+  802e67:	f6 c2 02             	test   $0x2,%dl
+  802e6a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e6d:	89 c1                	mov    %eax,%ecx
+  802e6f:	83 c9 01             	or     $0x1,%ecx
+  802e72:	48 85 d2             	test   %rdx,%rdx
+  802e75:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e78:	89 c1                	mov    %eax,%ecx
+  802e7a:	83 c9 40             	or     $0x40,%ecx
+  802e7d:	f6 c6 04             	test   $0x4,%dh
+  802e80:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+
+0000000000802e85 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e89:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e95:	48 c1 e8 06          	shr    $0x6,%rax
+  802e99:	83 e0 01             	and    $0x1,%eax
+}
+  802e9c:	5d                   	pop    %rbp
+  802e9d:	c3                   	ret
+
+0000000000802e9e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e9e:	55                   	push   %rbp
+  802e9f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ea2:	48 b8 8b 2d 80 00 00 	movabs $0x802d8b,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  802eae:	83 e0 01             	and    $0x1,%eax
+}
+  802eb1:	5d                   	pop    %rbp
+  802eb2:	c3                   	ret
+
+0000000000802eb3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802eb3:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802eba:	01 00 00 
+  802ebd:	a8 01                	test   $0x1,%al
+  802ebf:	75 06                	jne    802ec7 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ec6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ec7:	55                   	push   %rbp
+  802ec8:	48 89 e5             	mov    %rsp,%rbp
+  802ecb:	41 57                	push   %r15
+  802ecd:	41 56                	push   %r14
+  802ecf:	41 55                	push   %r13
+  802ed1:	41 54                	push   %r12
+  802ed3:	53                   	push   %rbx
+  802ed4:	48 83 ec 28          	sub    $0x28,%rsp
+  802ed8:	49 89 fe             	mov    %rdi,%r14
+  802edb:	49 89 f7             	mov    %rsi,%r15
+  802ede:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ee5:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ee6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802eed:	01 00 00 
+  802ef0:	e9 ae 00 00 00       	jmp    802fa3 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802ef5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802efc:	49 83 ec 01          	sub    $0x1,%r12
+  802f00:	74 2d                	je     802f2f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f02:	48 89 d8             	mov    %rbx,%rax
+  802f05:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f09:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f0e:	f6 c2 01             	test   $0x1,%dl
+  802f11:	74 e2                	je     802ef5 <foreach_shared_region+0x42>
+  802f13:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f18:	f6 c4 04             	test   $0x4,%ah
+  802f1b:	74 d8                	je     802ef5 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f1d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f24:	4c 89 fa             	mov    %r15,%rdx
+  802f27:	48 89 df             	mov    %rbx,%rdi
+  802f2a:	41 ff d6             	call   *%r14
+  802f2d:	eb c6                	jmp    802ef5 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f2f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f36:	00 
+  802f37:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f3c:	74 4a                	je     802f88 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f3e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f42:	48 c1 e8 15          	shr    $0x15,%rax
+  802f46:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f4d:	01 00 00 
+  802f50:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f54:	a8 01                	test   $0x1,%al
+  802f56:	74 d7                	je     802f2f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f58:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f5c:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f63:	48 39 c3             	cmp    %rax,%rbx
+  802f66:	73 c7                	jae    802f2f <foreach_shared_region+0x7c>
+  802f68:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f6f:	48 39 d0             	cmp    %rdx,%rax
+  802f72:	4d 19 e4             	sbb    %r12,%r12
+  802f75:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f7c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f83:	e9 7a ff ff ff       	jmp    802f02 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f88:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f8f:	40 
+  802f90:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f94:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f9b:	00 00 00 
+  802f9e:	48 39 c1             	cmp    %rax,%rcx
+  802fa1:	74 50                	je     802ff3 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802fa3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fa7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fab:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fb2:	01 00 00 
+  802fb5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fb9:	a8 01                	test   $0x1,%al
+  802fbb:	74 cb                	je     802f88 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fbd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fc1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fc8:	48 39 c1             	cmp    %rax,%rcx
+  802fcb:	73 bb                	jae    802f88 <foreach_shared_region+0xd5>
+  802fcd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fd4:	48 39 d0             	cmp    %rdx,%rax
+  802fd7:	48 19 c0             	sbb    %rax,%rax
+  802fda:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fe0:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fe6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fea:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fee:	e9 4b ff ff ff       	jmp    802f3e <foreach_shared_region+0x8b>
+  802ff3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ff8:	48 83 c4 28          	add    $0x28,%rsp
+  802ffc:	5b                   	pop    %rbx
+  802ffd:	41 5c                	pop    %r12
+  802fff:	41 5d                	pop    %r13
+  803001:	41 5e                	pop    %r14
+  803003:	41 5f                	pop    %r15
+  803005:	5d                   	pop    %rbp
+  803006:	c3                   	ret
+
+0000000000803007 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803007:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80300d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803014:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80301b:	c3                   	ret
+
+000000000080301c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80301c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80301f:	8b 17                	mov    (%rdi),%edx
+  803021:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803023:	83 f8 0f             	cmp    $0xf,%eax
+  803026:	77 13                	ja     80303b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803028:	8b 47 40             	mov    0x40(%rdi),%eax
+  80302b:	83 e0 0f             	and    $0xf,%eax
+  80302e:	48 c1 e0 09          	shl    $0x9,%rax
+  803032:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803039:	00 
+  80303a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80303b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803040:	c3                   	ret
+
+0000000000803041 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803041:	8b 47 40             	mov    0x40(%rdi),%eax
+  803044:	83 c0 01             	add    $0x1,%eax
+  803047:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80304a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803050:	8b 57 04             	mov    0x4(%rdi),%edx
+  803053:	b8 00 00 00 00       	mov    $0x0,%eax
+  803058:	85 d2                	test   %edx,%edx
+  80305a:	75 04                	jne    803060 <chan_publish+0x1f>
+  80305c:	83 e0 01             	and    $0x1,%eax
+}
+  80305f:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803060:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803063:	85 c0                	test   %eax,%eax
+  803065:	0f 95 c0             	setne  %al
+  803068:	0f b6 c0             	movzbl %al,%eax
+  80306b:	eb ef                	jmp    80305c <chan_publish+0x1b>
+
+000000000080306d <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80306d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803070:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803072:	29 d0                	sub    %edx,%eax
+  803074:	83 e8 01             	sub    $0x1,%eax
+  803077:	83 f8 0f             	cmp    $0xf,%eax
+  80307a:	77 12                	ja     80308e <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80307c:	8b 07                	mov    (%rdi),%eax
+  80307e:	83 e0 0f             	and    $0xf,%eax
+  803081:	48 c1 e0 09          	shl    $0x9,%rax
+  803085:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80308c:	00 
+  80308d:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80308e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803093:	c3                   	ret
+
+0000000000803094 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803094:	8b 07                	mov    (%rdi),%eax
+  803096:	83 c0 01             	add    $0x1,%eax
+  803099:	89 07                	mov    %eax,(%rdi)
+}
+  80309b:	c3                   	ret
+
+000000000080309c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80309c:	55                   	push   %rbp
+  80309d:	48 89 e5             	mov    %rsp,%rbp
+  8030a0:	53                   	push   %rbx
+  8030a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8030a5:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8030a8:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030af:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030b5:	48 b8 6d 30 80 00 00 	movabs $0x80306d,%rax
+  8030bc:	00 00 00 
+  8030bf:	ff d0                	call   *%rax
+  8030c1:	48 85 c0             	test   %rax,%rax
+  8030c4:	74 12                	je     8030d8 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030c6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030d6:	c9                   	leave
+  8030d7:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030d8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030dd:	eb f3                	jmp    8030d2 <chan_arm+0x36>
+
+00000000008030df <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030df:	55                   	push   %rbp
+  8030e0:	48 89 e5             	mov    %rsp,%rbp
+  8030e3:	41 56                	push   %r14
+  8030e5:	41 55                	push   %r13
+  8030e7:	41 54                	push   %r12
+  8030e9:	53                   	push   %rbx
+  8030ea:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030ed:	49 bc 9c 30 80 00 00 	movabs $0x80309c,%r12
+  8030f4:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030f7:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030fb:	49 bd bd 05 80 00 00 	movabs $0x8005bd,%r13
+  803102:	00 00 00 
+    while (chan_arm(r))
+  803105:	eb 0d                	jmp    803114 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803107:	8b 33                	mov    (%rbx),%esi
+  803109:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310e:	4c 89 f7             	mov    %r14,%rdi
+  803111:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803114:	48 89 df             	mov    %rbx,%rdi
+  803117:	41 ff d4             	call   *%r12
+  80311a:	84 c0                	test   %al,%al
+  80311c:	75 e9                	jne    803107 <chan_wait+0x28>
+}
+  80311e:	5b                   	pop    %rbx
+  80311f:	41 5c                	pop    %r12
+  803121:	41 5d                	pop    %r13
+  803123:	41 5e                	pop    %r14
+  803125:	5d                   	pop    %rbp
+  803126:	c3                   	ret
+
+0000000000803127 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803127:	55                   	push   %rbp
+  803128:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80312b:	48 83 c7 40          	add    $0x40,%rdi
+  80312f:	be 01 00 00 00       	mov    $0x1,%esi
+  803134:	48 b8 db 05 80 00 00 	movabs $0x8005db,%rax
+  80313b:	00 00 00 
+  80313e:	ff d0                	call   *%rax
+}
+  803140:	5d                   	pop    %rbp
+  803141:	c3                   	ret
+
+0000000000803142 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803142:	b8 00 00 00 00       	mov    $0x0,%eax
+  803147:	c3                   	ret
+
+0000000000803148 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803148:	55                   	push   %rbp
+  803149:	48 89 e5             	mov    %rsp,%rbp
+  80314c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80314f:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  803156:	00 00 00 
+  803159:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  803160:	00 00 00 
+  803163:	ff d0                	call   *%rax
+    return 0;
+}
+  803165:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316a:	5d                   	pop    %rbp
+  80316b:	c3                   	ret
+
+000000000080316c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80316c:	55                   	push   %rbp
+  80316d:	48 89 e5             	mov    %rsp,%rbp
+  803170:	41 57                	push   %r15
+  803172:	41 56                	push   %r14
+  803174:	41 55                	push   %r13
+  803176:	41 54                	push   %r12
+  803178:	53                   	push   %rbx
+  803179:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803180:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803187:	48 85 d2             	test   %rdx,%rdx
+  80318a:	74 7a                	je     803206 <devcons_write+0x9a>
+  80318c:	49 89 d6             	mov    %rdx,%r14
+  80318f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803195:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80319a:	49 bf dc 3f 80 00 00 	movabs $0x803fdc,%r15
+  8031a1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031a4:	4c 89 f3             	mov    %r14,%rbx
+  8031a7:	48 29 f3             	sub    %rsi,%rbx
+  8031aa:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031af:	48 39 c3             	cmp    %rax,%rbx
+  8031b2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031b6:	4c 63 eb             	movslq %ebx,%r13
+  8031b9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031c0:	48 01 c6             	add    %rax,%rsi
+  8031c3:	4c 89 ea             	mov    %r13,%rdx
+  8031c6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031cd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031d0:	4c 89 ee             	mov    %r13,%rsi
+  8031d3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031da:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8031e1:	00 00 00 
+  8031e4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031e6:	41 01 dc             	add    %ebx,%r12d
+  8031e9:	49 63 f4             	movslq %r12d,%rsi
+  8031ec:	4c 39 f6             	cmp    %r14,%rsi
+  8031ef:	72 b3                	jb     8031a4 <devcons_write+0x38>
+    return res;
+  8031f1:	49 63 c4             	movslq %r12d,%rax
+}
+  8031f4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031fb:	5b                   	pop    %rbx
+  8031fc:	41 5c                	pop    %r12
+  8031fe:	41 5d                	pop    %r13
+  803200:	41 5e                	pop    %r14
+  803202:	41 5f                	pop    %r15
+  803204:	5d                   	pop    %rbp
+  803205:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803206:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80320c:	eb e3                	jmp    8031f1 <devcons_write+0x85>
+
+000000000080320e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80320e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803211:	ba 00 00 00 00       	mov    $0x0,%edx
+  803216:	48 85 c0             	test   %rax,%rax
+  803219:	74 55                	je     803270 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80321b:	55                   	push   %rbp
+  80321c:	48 89 e5             	mov    %rsp,%rbp
+  80321f:	41 55                	push   %r13
+  803221:	41 54                	push   %r12
+  803223:	53                   	push   %rbx
+  803224:	48 83 ec 08          	sub    $0x8,%rsp
+  803228:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80322b:	48 bb 36 01 80 00 00 	movabs $0x800136,%rbx
+  803232:	00 00 00 
+  803235:	49 bc eb 01 80 00 00 	movabs $0x8001eb,%r12
+  80323c:	00 00 00 
+  80323f:	eb 03                	jmp    803244 <devcons_read+0x36>
+  803241:	41 ff d4             	call   *%r12
+  803244:	ff d3                	call   *%rbx
+  803246:	85 c0                	test   %eax,%eax
+  803248:	74 f7                	je     803241 <devcons_read+0x33>
+    if (c < 0) return c;
+  80324a:	48 63 d0             	movslq %eax,%rdx
+  80324d:	78 13                	js     803262 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80324f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803254:	83 f8 04             	cmp    $0x4,%eax
+  803257:	74 09                	je     803262 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803259:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80325d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803262:	48 89 d0             	mov    %rdx,%rax
+  803265:	48 83 c4 08          	add    $0x8,%rsp
+  803269:	5b                   	pop    %rbx
+  80326a:	41 5c                	pop    %r12
+  80326c:	41 5d                	pop    %r13
+  80326e:	5d                   	pop    %rbp
+  80326f:	c3                   	ret
+  803270:	48 89 d0             	mov    %rdx,%rax
+  803273:	c3                   	ret
+
+0000000000803274 <cputchar>:
+cputchar(int ch) {
+  803274:	55                   	push   %rbp
+  803275:	48 89 e5             	mov    %rsp,%rbp
+  803278:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80327c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803280:	be 01 00 00 00       	mov    $0x1,%esi
+  803285:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803289:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  803290:	00 00 00 
+  803293:	ff d0                	call   *%rax
+}
+  803295:	c9                   	leave
+  803296:	c3                   	ret
+
+0000000000803297 <getchar>:
+getchar(void) {
+  803297:	55                   	push   %rbp
+  803298:	48 89 e5             	mov    %rsp,%rbp
+  80329b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80329f:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032a4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032ad:	48 b8 f3 09 80 00 00 	movabs $0x8009f3,%rax
+  8032b4:	00 00 00 
+  8032b7:	ff d0                	call   *%rax
+  8032b9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032bb:	85 c0                	test   %eax,%eax
+  8032bd:	78 06                	js     8032c5 <getchar+0x2e>
+  8032bf:	74 08                	je     8032c9 <getchar+0x32>
+  8032c1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032c5:	89 d0                	mov    %edx,%eax
+  8032c7:	c9                   	leave
+  8032c8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032c9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032ce:	eb f5                	jmp    8032c5 <getchar+0x2e>
+
+00000000008032d0 <iscons>:
+iscons(int fdnum) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032dc:	48 b8 10 07 80 00 00 	movabs $0x800710,%rax
+  8032e3:	00 00 00 
+  8032e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032e8:	85 c0                	test   %eax,%eax
+  8032ea:	78 18                	js     803304 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032ec:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f0:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032f7:	00 00 00 
+  8032fa:	8b 00                	mov    (%rax),%eax
+  8032fc:	39 02                	cmp    %eax,(%rdx)
+  8032fe:	0f 94 c0             	sete   %al
+  803301:	0f b6 c0             	movzbl %al,%eax
+}
+  803304:	c9                   	leave
+  803305:	c3                   	ret
+
+0000000000803306 <opencons>:
+opencons(void) {
+  803306:	55                   	push   %rbp
+  803307:	48 89 e5             	mov    %rsp,%rbp
+  80330a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80330e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803312:	48 b8 b0 06 80 00 00 	movabs $0x8006b0,%rax
+  803319:	00 00 00 
+  80331c:	ff d0                	call   *%rax
+  80331e:	85 c0                	test   %eax,%eax
+  803320:	78 49                	js     80336b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803322:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803327:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80332c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803330:	bf 00 00 00 00       	mov    $0x0,%edi
+  803335:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+  803341:	85 c0                	test   %eax,%eax
+  803343:	78 26                	js     80336b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803345:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803349:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803350:	00 00 
+  803352:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803354:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803358:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80335f:	48 b8 82 06 80 00 00 	movabs $0x800682,%rax
+  803366:	00 00 00 
+  803369:	ff d0                	call   *%rax
+}
+  80336b:	c9                   	leave
+  80336c:	c3                   	ret
+
+000000000080336d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80336d:	55                   	push   %rbp
+  80336e:	48 89 e5             	mov    %rsp,%rbp
+  803371:	41 56                	push   %r14
+  803373:	41 55                	push   %r13
+  803375:	41 54                	push   %r12
+  803377:	53                   	push   %rbx
+  803378:	48 83 ec 50          	sub    $0x50,%rsp
+  80337c:	49 89 fc             	mov    %rdi,%r12
+  80337f:	41 89 f5             	mov    %esi,%r13d
+  803382:	48 89 d3             	mov    %rdx,%rbx
+  803385:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803389:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80338d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803391:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803398:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80339c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033a0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033a4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033a8:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8033af:	00 00 00 
+  8033b2:	4c 8b 30             	mov    (%rax),%r14
+  8033b5:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  8033bc:	00 00 00 
+  8033bf:	ff d0                	call   *%rax
+  8033c1:	89 c6                	mov    %eax,%esi
+  8033c3:	45 89 e8             	mov    %r13d,%r8d
+  8033c6:	4c 89 e1             	mov    %r12,%rcx
+  8033c9:	4c 89 f2             	mov    %r14,%rdx
+  8033cc:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033d3:	00 00 00 
+  8033d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033db:	49 bc bd 34 80 00 00 	movabs $0x8034bd,%r12
+  8033e2:	00 00 00 
+  8033e5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033e8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033ec:	48 89 df             	mov    %rbx,%rdi
+  8033ef:	48 b8 59 34 80 00 00 	movabs $0x803459,%rax
+  8033f6:	00 00 00 
+  8033f9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033fb:	48 bf 3b 47 80 00 00 	movabs $0x80473b,%rdi
+  803402:	00 00 00 
+  803405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80340d:	cc                   	int3
+  80340e:	eb fd                	jmp    80340d <_panic+0xa0>
+
+0000000000803410 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803410:	55                   	push   %rbp
+  803411:	48 89 e5             	mov    %rsp,%rbp
+  803414:	53                   	push   %rbx
+  803415:	48 83 ec 08          	sub    $0x8,%rsp
+  803419:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80341c:	8b 06                	mov    (%rsi),%eax
+  80341e:	8d 50 01             	lea    0x1(%rax),%edx
+  803421:	89 16                	mov    %edx,(%rsi)
+  803423:	48 98                	cltq
+  803425:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80342a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803430:	74 0a                	je     80343c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803432:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803436:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80343a:	c9                   	leave
+  80343b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80343c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803440:	be ff 00 00 00       	mov    $0xff,%esi
+  803445:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  80344c:	00 00 00 
+  80344f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803451:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803457:	eb d9                	jmp    803432 <putch+0x22>
+
+0000000000803459 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803459:	55                   	push   %rbp
+  80345a:	48 89 e5             	mov    %rsp,%rbp
+  80345d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803464:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803467:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80346e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803473:	b8 00 00 00 00       	mov    $0x0,%eax
+  803478:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80347b:	48 89 f1             	mov    %rsi,%rcx
+  80347e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803485:	48 bf 10 34 80 00 00 	movabs $0x803410,%rdi
+  80348c:	00 00 00 
+  80348f:	48 b8 0d 36 80 00 00 	movabs $0x80360d,%rax
+  803496:	00 00 00 
+  803499:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80349b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034a2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8034a9:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034b5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034bb:	c9                   	leave
+  8034bc:	c3                   	ret
+
+00000000008034bd <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034bd:	55                   	push   %rbp
+  8034be:	48 89 e5             	mov    %rsp,%rbp
+  8034c1:	48 83 ec 50          	sub    $0x50,%rsp
+  8034c5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034c9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034d1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034d5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034d9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034e8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034f0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034f4:	48 b8 59 34 80 00 00 	movabs $0x803459,%rax
+  8034fb:	00 00 00 
+  8034fe:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803500:	c9                   	leave
+  803501:	c3                   	ret
+
+0000000000803502 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803502:	55                   	push   %rbp
+  803503:	48 89 e5             	mov    %rsp,%rbp
+  803506:	41 57                	push   %r15
+  803508:	41 56                	push   %r14
+  80350a:	41 55                	push   %r13
+  80350c:	41 54                	push   %r12
+  80350e:	53                   	push   %rbx
+  80350f:	48 83 ec 18          	sub    $0x18,%rsp
+  803513:	49 89 fc             	mov    %rdi,%r12
+  803516:	49 89 f5             	mov    %rsi,%r13
+  803519:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80351d:	8b 45 10             	mov    0x10(%rbp),%eax
+  803520:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803523:	41 89 cf             	mov    %ecx,%r15d
+  803526:	4c 39 fa             	cmp    %r15,%rdx
+  803529:	73 5b                	jae    803586 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80352b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80352f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803533:	85 db                	test   %ebx,%ebx
+  803535:	7e 0e                	jle    803545 <print_num+0x43>
+            putch(padc, put_arg);
+  803537:	4c 89 ee             	mov    %r13,%rsi
+  80353a:	44 89 f7             	mov    %r14d,%edi
+  80353d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803540:	83 eb 01             	sub    $0x1,%ebx
+  803543:	75 f2                	jne    803537 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803545:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803549:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  803550:	00 00 00 
+  803553:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  80355a:	00 00 00 
+  80355d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803561:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803565:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356a:	49 f7 f7             	div    %r15
+  80356d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803571:	4c 89 ee             	mov    %r13,%rsi
+  803574:	41 ff d4             	call   *%r12
+}
+  803577:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80357b:	5b                   	pop    %rbx
+  80357c:	41 5c                	pop    %r12
+  80357e:	41 5d                	pop    %r13
+  803580:	41 5e                	pop    %r14
+  803582:	41 5f                	pop    %r15
+  803584:	5d                   	pop    %rbp
+  803585:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803586:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80358a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80358f:	49 f7 f7             	div    %r15
+  803592:	48 83 ec 08          	sub    $0x8,%rsp
+  803596:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80359a:	52                   	push   %rdx
+  80359b:	45 0f be c9          	movsbl %r9b,%r9d
+  80359f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035a3:	48 89 c2             	mov    %rax,%rdx
+  8035a6:	48 b8 02 35 80 00 00 	movabs $0x803502,%rax
+  8035ad:	00 00 00 
+  8035b0:	ff d0                	call   *%rax
+  8035b2:	48 83 c4 10          	add    $0x10,%rsp
+  8035b6:	eb 8d                	jmp    803545 <print_num+0x43>
+
+00000000008035b8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035b8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035bc:	48 8b 06             	mov    (%rsi),%rax
+  8035bf:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035c3:	73 0a                	jae    8035cf <sprintputch+0x17>
+        *state->start++ = ch;
+  8035c5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035c9:	48 89 16             	mov    %rdx,(%rsi)
+  8035cc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035cf:	c3                   	ret
+
+00000000008035d0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035d0:	55                   	push   %rbp
+  8035d1:	48 89 e5             	mov    %rsp,%rbp
+  8035d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8035d8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035dc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035e4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035eb:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035f7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035fb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035ff:	48 b8 0d 36 80 00 00 	movabs $0x80360d,%rax
+  803606:	00 00 00 
+  803609:	ff d0                	call   *%rax
+}
+  80360b:	c9                   	leave
+  80360c:	c3                   	ret
+
+000000000080360d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80360d:	55                   	push   %rbp
+  80360e:	48 89 e5             	mov    %rsp,%rbp
+  803611:	41 57                	push   %r15
+  803613:	41 56                	push   %r14
+  803615:	41 55                	push   %r13
+  803617:	41 54                	push   %r12
+  803619:	53                   	push   %rbx
+  80361a:	48 83 ec 38          	sub    $0x38,%rsp
+  80361e:	49 89 fe             	mov    %rdi,%r14
+  803621:	49 89 f5             	mov    %rsi,%r13
+  803624:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803627:	48 8b 01             	mov    (%rcx),%rax
+  80362a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80362e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803632:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803636:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80363a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80363e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803642:	0f b6 3b             	movzbl (%rbx),%edi
+  803645:	40 80 ff 25          	cmp    $0x25,%dil
+  803649:	74 18                	je     803663 <vprintfmt+0x56>
+            if (!ch) return;
+  80364b:	40 84 ff             	test   %dil,%dil
+  80364e:	0f 84 b1 06 00 00    	je     803d05 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803654:	40 0f b6 ff          	movzbl %dil,%edi
+  803658:	4c 89 ee             	mov    %r13,%rsi
+  80365b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80365e:	4c 89 e3             	mov    %r12,%rbx
+  803661:	eb db                	jmp    80363e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803663:	be 00 00 00 00       	mov    $0x0,%esi
+  803668:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80366c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803671:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803677:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80367e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803682:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803687:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80368c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80368f:	83 e8 23             	sub    $0x23,%eax
+  803692:	3c 57                	cmp    $0x57,%al
+  803694:	0f 87 51 06 00 00    	ja     803ceb <vprintfmt+0x6de>
+  80369a:	0f b6 c0             	movzbl %al,%eax
+  80369d:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  8036a4:	00 00 00 
+  8036a7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8036aa:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036ad:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036b1:	eb cf                	jmp    803682 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036b3:	49 89 dc             	mov    %rbx,%r12
+  8036b6:	be 01 00 00 00       	mov    $0x1,%esi
+  8036bb:	eb c5                	jmp    803682 <vprintfmt+0x75>
+            padc = ch;
+  8036bd:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036c1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036c4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036c7:	eb b9                	jmp    803682 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8036cf:	77 24                	ja     8036f5 <vprintfmt+0xe8>
+  8036d1:	89 c1                	mov    %eax,%ecx
+  8036d3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036d7:	83 c0 08             	add    $0x8,%eax
+  8036da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036dd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036e0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036e3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036e7:	79 99                	jns    803682 <vprintfmt+0x75>
+                width = precision;
+  8036e9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036ed:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036f3:	eb 8d                	jmp    803682 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036f5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036f9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036fd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803701:	eb da                	jmp    8036dd <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803703:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803708:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80370c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803712:	3c 39                	cmp    $0x39,%al
+  803714:	77 1c                	ja     803732 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803716:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80371a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80371e:	0f b6 c0             	movzbl %al,%eax
+  803721:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803726:	0f b6 03             	movzbl (%rbx),%eax
+  803729:	3c 39                	cmp    $0x39,%al
+  80372b:	76 e9                	jbe    803716 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80372d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803730:	eb b1                	jmp    8036e3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803732:	49 89 dc             	mov    %rbx,%r12
+  803735:	eb ac                	jmp    8036e3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803737:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80373a:	85 c9                	test   %ecx,%ecx
+  80373c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803741:	0f 49 c1             	cmovns %ecx,%eax
+  803744:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803747:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80374a:	e9 33 ff ff ff       	jmp    803682 <vprintfmt+0x75>
+            lflag++;
+  80374f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803752:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803755:	e9 28 ff ff ff       	jmp    803682 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80375a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80375d:	83 f8 2f             	cmp    $0x2f,%eax
+  803760:	77 19                	ja     80377b <vprintfmt+0x16e>
+  803762:	89 c2                	mov    %eax,%edx
+  803764:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803768:	83 c0 08             	add    $0x8,%eax
+  80376b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80376e:	8b 3a                	mov    (%rdx),%edi
+  803770:	4c 89 ee             	mov    %r13,%rsi
+  803773:	41 ff d6             	call   *%r14
+            break;
+  803776:	e9 c3 fe ff ff       	jmp    80363e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80377b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80377f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803783:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803787:	eb e5                	jmp    80376e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803789:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80378c:	83 f8 2f             	cmp    $0x2f,%eax
+  80378f:	77 5a                	ja     8037eb <vprintfmt+0x1de>
+  803791:	89 c2                	mov    %eax,%edx
+  803793:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803797:	83 c0 08             	add    $0x8,%eax
+  80379a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80379d:	8b 02                	mov    (%rdx),%eax
+  80379f:	89 c1                	mov    %eax,%ecx
+  8037a1:	f7 d9                	neg    %ecx
+  8037a3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8037a6:	83 f9 16             	cmp    $0x16,%ecx
+  8037a9:	7f 4e                	jg     8037f9 <vprintfmt+0x1ec>
+  8037ab:	48 63 c1             	movslq %ecx,%rax
+  8037ae:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  8037b5:	00 00 00 
+  8037b8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037bc:	48 85 c0             	test   %rax,%rax
+  8037bf:	74 38                	je     8037f9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037c1:	48 89 c1             	mov    %rax,%rcx
+  8037c4:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037cb:	00 00 00 
+  8037ce:	4c 89 ee             	mov    %r13,%rsi
+  8037d1:	4c 89 f7             	mov    %r14,%rdi
+  8037d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d9:	49 b8 d0 35 80 00 00 	movabs $0x8035d0,%r8
+  8037e0:	00 00 00 
+  8037e3:	41 ff d0             	call   *%r8
+  8037e6:	e9 53 fe ff ff       	jmp    80363e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037f7:	eb a4                	jmp    80379d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037f9:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  803800:	00 00 00 
+  803803:	4c 89 ee             	mov    %r13,%rsi
+  803806:	4c 89 f7             	mov    %r14,%rdi
+  803809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380e:	49 b8 d0 35 80 00 00 	movabs $0x8035d0,%r8
+  803815:	00 00 00 
+  803818:	41 ff d0             	call   *%r8
+  80381b:	e9 1e fe ff ff       	jmp    80363e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803820:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803823:	83 f8 2f             	cmp    $0x2f,%eax
+  803826:	77 6c                	ja     803894 <vprintfmt+0x287>
+  803828:	89 c2                	mov    %eax,%edx
+  80382a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80382e:	83 c0 08             	add    $0x8,%eax
+  803831:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803834:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803837:	48 85 d2             	test   %rdx,%rdx
+  80383a:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  803841:	00 00 00 
+  803844:	48 0f 45 c2          	cmovne %rdx,%rax
+  803848:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80384c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803850:	7e 06                	jle    803858 <vprintfmt+0x24b>
+  803852:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803856:	75 4a                	jne    8038a2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803858:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80385c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803860:	0f b6 00             	movzbl (%rax),%eax
+  803863:	84 c0                	test   %al,%al
+  803865:	0f 85 9a 00 00 00    	jne    803905 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80386b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80386e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803872:	85 c0                	test   %eax,%eax
+  803874:	0f 8e c4 fd ff ff    	jle    80363e <vprintfmt+0x31>
+  80387a:	4c 89 ee             	mov    %r13,%rsi
+  80387d:	bf 20 00 00 00       	mov    $0x20,%edi
+  803882:	41 ff d6             	call   *%r14
+  803885:	41 83 ec 01          	sub    $0x1,%r12d
+  803889:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80388d:	75 eb                	jne    80387a <vprintfmt+0x26d>
+  80388f:	e9 aa fd ff ff       	jmp    80363e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80389c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a0:	eb 92                	jmp    803834 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038a2:	49 63 f7             	movslq %r15d,%rsi
+  8038a5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8038a9:	48 b8 bf 3d 80 00 00 	movabs $0x803dbf,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+  8038b5:	48 89 c2             	mov    %rax,%rdx
+  8038b8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038bb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038bd:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038c0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038c3:	85 c0                	test   %eax,%eax
+  8038c5:	7e 91                	jle    803858 <vprintfmt+0x24b>
+  8038c7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038cc:	4c 89 ee             	mov    %r13,%rsi
+  8038cf:	44 89 e7             	mov    %r12d,%edi
+  8038d2:	41 ff d6             	call   *%r14
+  8038d5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038dc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038df:	75 eb                	jne    8038cc <vprintfmt+0x2bf>
+  8038e1:	e9 72 ff ff ff       	jmp    803858 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038e6:	0f b6 f8             	movzbl %al,%edi
+  8038e9:	4c 89 ee             	mov    %r13,%rsi
+  8038ec:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038f3:	49 83 c4 01          	add    $0x1,%r12
+  8038f7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038fd:	84 c0                	test   %al,%al
+  8038ff:	0f 84 66 ff ff ff    	je     80386b <vprintfmt+0x25e>
+  803905:	45 85 ff             	test   %r15d,%r15d
+  803908:	78 0a                	js     803914 <vprintfmt+0x307>
+  80390a:	41 83 ef 01          	sub    $0x1,%r15d
+  80390e:	0f 88 57 ff ff ff    	js     80386b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803914:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803918:	74 cc                	je     8038e6 <vprintfmt+0x2d9>
+  80391a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80391d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803922:	80 fa 5e             	cmp    $0x5e,%dl
+  803925:	77 c2                	ja     8038e9 <vprintfmt+0x2dc>
+  803927:	eb bd                	jmp    8038e6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803929:	40 84 f6             	test   %sil,%sil
+  80392c:	75 26                	jne    803954 <vprintfmt+0x347>
+    switch (lflag) {
+  80392e:	85 d2                	test   %edx,%edx
+  803930:	74 59                	je     80398b <vprintfmt+0x37e>
+  803932:	83 fa 01             	cmp    $0x1,%edx
+  803935:	74 7b                	je     8039b2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803937:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393a:	83 f8 2f             	cmp    $0x2f,%eax
+  80393d:	0f 87 96 00 00 00    	ja     8039d9 <vprintfmt+0x3cc>
+  803943:	89 c2                	mov    %eax,%edx
+  803945:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803949:	83 c0 08             	add    $0x8,%eax
+  80394c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80394f:	4c 8b 22             	mov    (%rdx),%r12
+  803952:	eb 17                	jmp    80396b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803954:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803957:	83 f8 2f             	cmp    $0x2f,%eax
+  80395a:	77 21                	ja     80397d <vprintfmt+0x370>
+  80395c:	89 c2                	mov    %eax,%edx
+  80395e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803962:	83 c0 08             	add    $0x8,%eax
+  803965:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803968:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80396b:	4d 85 e4             	test   %r12,%r12
+  80396e:	78 7a                	js     8039ea <vprintfmt+0x3dd>
+            num = i;
+  803970:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803973:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803978:	e9 50 02 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80397d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803981:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803989:	eb dd                	jmp    803968 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80398b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80398e:	83 f8 2f             	cmp    $0x2f,%eax
+  803991:	77 11                	ja     8039a4 <vprintfmt+0x397>
+  803993:	89 c2                	mov    %eax,%edx
+  803995:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803999:	83 c0 08             	add    $0x8,%eax
+  80399c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80399f:	4c 63 22             	movslq (%rdx),%r12
+  8039a2:	eb c7                	jmp    80396b <vprintfmt+0x35e>
+  8039a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b0:	eb ed                	jmp    80399f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039b2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039b5:	83 f8 2f             	cmp    $0x2f,%eax
+  8039b8:	77 11                	ja     8039cb <vprintfmt+0x3be>
+  8039ba:	89 c2                	mov    %eax,%edx
+  8039bc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039c0:	83 c0 08             	add    $0x8,%eax
+  8039c3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039c6:	4c 8b 22             	mov    (%rdx),%r12
+  8039c9:	eb a0                	jmp    80396b <vprintfmt+0x35e>
+  8039cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d7:	eb ed                	jmp    8039c6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039e5:	e9 65 ff ff ff       	jmp    80394f <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039ea:	4c 89 ee             	mov    %r13,%rsi
+  8039ed:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039f2:	41 ff d6             	call   *%r14
+                i = -i;
+  8039f5:	49 f7 dc             	neg    %r12
+  8039f8:	e9 73 ff ff ff       	jmp    803970 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039fd:	40 84 f6             	test   %sil,%sil
+  803a00:	75 32                	jne    803a34 <vprintfmt+0x427>
+    switch (lflag) {
+  803a02:	85 d2                	test   %edx,%edx
+  803a04:	74 5d                	je     803a63 <vprintfmt+0x456>
+  803a06:	83 fa 01             	cmp    $0x1,%edx
+  803a09:	0f 84 82 00 00 00    	je     803a91 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a12:	83 f8 2f             	cmp    $0x2f,%eax
+  803a15:	0f 87 a5 00 00 00    	ja     803ac0 <vprintfmt+0x4b3>
+  803a1b:	89 c2                	mov    %eax,%edx
+  803a1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a21:	83 c0 08             	add    $0x8,%eax
+  803a24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a27:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a2a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a2f:	e9 99 01 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a37:	83 f8 2f             	cmp    $0x2f,%eax
+  803a3a:	77 19                	ja     803a55 <vprintfmt+0x448>
+  803a3c:	89 c2                	mov    %eax,%edx
+  803a3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a42:	83 c0 08             	add    $0x8,%eax
+  803a45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a48:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a50:	e9 78 01 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+  803a55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a61:	eb e5                	jmp    803a48 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a66:	83 f8 2f             	cmp    $0x2f,%eax
+  803a69:	77 18                	ja     803a83 <vprintfmt+0x476>
+  803a6b:	89 c2                	mov    %eax,%edx
+  803a6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a71:	83 c0 08             	add    $0x8,%eax
+  803a74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a77:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a79:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a7e:	e9 4a 01 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+  803a83:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a87:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a8f:	eb e6                	jmp    803a77 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a94:	83 f8 2f             	cmp    $0x2f,%eax
+  803a97:	77 19                	ja     803ab2 <vprintfmt+0x4a5>
+  803a99:	89 c2                	mov    %eax,%edx
+  803a9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a9f:	83 c0 08             	add    $0x8,%eax
+  803aa2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aa5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803aa8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803aad:	e9 1b 01 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+  803ab2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ab6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803abe:	eb e5                	jmp    803aa5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ac0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ac4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ac8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803acc:	e9 56 ff ff ff       	jmp    803a27 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ad1:	40 84 f6             	test   %sil,%sil
+  803ad4:	75 2e                	jne    803b04 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803ad6:	85 d2                	test   %edx,%edx
+  803ad8:	74 59                	je     803b33 <vprintfmt+0x526>
+  803ada:	83 fa 01             	cmp    $0x1,%edx
+  803add:	74 7f                	je     803b5e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803adf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ae2:	83 f8 2f             	cmp    $0x2f,%eax
+  803ae5:	0f 87 9f 00 00 00    	ja     803b8a <vprintfmt+0x57d>
+  803aeb:	89 c2                	mov    %eax,%edx
+  803aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803af1:	83 c0 08             	add    $0x8,%eax
+  803af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803af7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803afa:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803aff:	e9 c9 00 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b07:	83 f8 2f             	cmp    $0x2f,%eax
+  803b0a:	77 19                	ja     803b25 <vprintfmt+0x518>
+  803b0c:	89 c2                	mov    %eax,%edx
+  803b0e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b12:	83 c0 08             	add    $0x8,%eax
+  803b15:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b18:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b1b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b20:	e9 a8 00 00 00       	jmp    803bcd <vprintfmt+0x5c0>
+  803b25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b31:	eb e5                	jmp    803b18 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b36:	83 f8 2f             	cmp    $0x2f,%eax
+  803b39:	77 15                	ja     803b50 <vprintfmt+0x543>
+  803b3b:	89 c2                	mov    %eax,%edx
+  803b3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b41:	83 c0 08             	add    $0x8,%eax
+  803b44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b47:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b49:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b4e:	eb 7d                	jmp    803bcd <vprintfmt+0x5c0>
+  803b50:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b54:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b5c:	eb e9                	jmp    803b47 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b5e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b61:	83 f8 2f             	cmp    $0x2f,%eax
+  803b64:	77 16                	ja     803b7c <vprintfmt+0x56f>
+  803b66:	89 c2                	mov    %eax,%edx
+  803b68:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b6c:	83 c0 08             	add    $0x8,%eax
+  803b6f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b72:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b75:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b7a:	eb 51                	jmp    803bcd <vprintfmt+0x5c0>
+  803b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b88:	eb e8                	jmp    803b72 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b96:	e9 5c ff ff ff       	jmp    803af7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b9b:	4c 89 ee             	mov    %r13,%rsi
+  803b9e:	bf 30 00 00 00       	mov    $0x30,%edi
+  803ba3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803ba6:	4c 89 ee             	mov    %r13,%rsi
+  803ba9:	bf 78 00 00 00       	mov    $0x78,%edi
+  803bae:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803bb1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bb4:	83 f8 2f             	cmp    $0x2f,%eax
+  803bb7:	77 47                	ja     803c00 <vprintfmt+0x5f3>
+  803bb9:	89 c2                	mov    %eax,%edx
+  803bbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bbf:	83 c0 08             	add    $0x8,%eax
+  803bc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bc5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bc8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bcd:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bd5:	0f 94 c0             	sete   %al
+  803bd8:	0f b6 c0             	movzbl %al,%eax
+  803bdb:	50                   	push   %rax
+  803bdc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803be1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803be5:	4c 89 ee             	mov    %r13,%rsi
+  803be8:	4c 89 f7             	mov    %r14,%rdi
+  803beb:	48 b8 02 35 80 00 00 	movabs $0x803502,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+            break;
+  803bf7:	48 83 c4 10          	add    $0x10,%rsp
+  803bfb:	e9 3e fa ff ff       	jmp    80363e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c0c:	eb b7                	jmp    803bc5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c0e:	40 84 f6             	test   %sil,%sil
+  803c11:	75 2b                	jne    803c3e <vprintfmt+0x631>
+    switch (lflag) {
+  803c13:	85 d2                	test   %edx,%edx
+  803c15:	74 56                	je     803c6d <vprintfmt+0x660>
+  803c17:	83 fa 01             	cmp    $0x1,%edx
+  803c1a:	74 7f                	je     803c9b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c1f:	83 f8 2f             	cmp    $0x2f,%eax
+  803c22:	0f 87 a2 00 00 00    	ja     803cca <vprintfmt+0x6bd>
+  803c28:	89 c2                	mov    %eax,%edx
+  803c2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c2e:	83 c0 08             	add    $0x8,%eax
+  803c31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c37:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c3c:	eb 8f                	jmp    803bcd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c41:	83 f8 2f             	cmp    $0x2f,%eax
+  803c44:	77 19                	ja     803c5f <vprintfmt+0x652>
+  803c46:	89 c2                	mov    %eax,%edx
+  803c48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c4c:	83 c0 08             	add    $0x8,%eax
+  803c4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c55:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c5a:	e9 6e ff ff ff       	jmp    803bcd <vprintfmt+0x5c0>
+  803c5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c6b:	eb e5                	jmp    803c52 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c70:	83 f8 2f             	cmp    $0x2f,%eax
+  803c73:	77 18                	ja     803c8d <vprintfmt+0x680>
+  803c75:	89 c2                	mov    %eax,%edx
+  803c77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c7b:	83 c0 08             	add    $0x8,%eax
+  803c7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c81:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c88:	e9 40 ff ff ff       	jmp    803bcd <vprintfmt+0x5c0>
+  803c8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c99:	eb e6                	jmp    803c81 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c9b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c9e:	83 f8 2f             	cmp    $0x2f,%eax
+  803ca1:	77 19                	ja     803cbc <vprintfmt+0x6af>
+  803ca3:	89 c2                	mov    %eax,%edx
+  803ca5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ca9:	83 c0 08             	add    $0x8,%eax
+  803cac:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803caf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803cb2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803cb7:	e9 11 ff ff ff       	jmp    803bcd <vprintfmt+0x5c0>
+  803cbc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc8:	eb e5                	jmp    803caf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cd6:	e9 59 ff ff ff       	jmp    803c34 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cdb:	4c 89 ee             	mov    %r13,%rsi
+  803cde:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ce3:	41 ff d6             	call   *%r14
+            break;
+  803ce6:	e9 53 f9 ff ff       	jmp    80363e <vprintfmt+0x31>
+            putch('%', put_arg);
+  803ceb:	4c 89 ee             	mov    %r13,%rsi
+  803cee:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cf3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803cf6:	48 83 eb 01          	sub    $0x1,%rbx
+  803cfa:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803cfe:	75 f6                	jne    803cf6 <vprintfmt+0x6e9>
+  803d00:	e9 39 f9 ff ff       	jmp    80363e <vprintfmt+0x31>
+}
+  803d05:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d09:	5b                   	pop    %rbx
+  803d0a:	41 5c                	pop    %r12
+  803d0c:	41 5d                	pop    %r13
+  803d0e:	41 5e                	pop    %r14
+  803d10:	41 5f                	pop    %r15
+  803d12:	5d                   	pop    %rbp
+  803d13:	c3                   	ret
+
+0000000000803d14 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d14:	55                   	push   %rbp
+  803d15:	48 89 e5             	mov    %rsp,%rbp
+  803d18:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d1c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d20:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d25:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d29:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d30:	48 85 ff             	test   %rdi,%rdi
+  803d33:	74 2b                	je     803d60 <vsnprintf+0x4c>
+  803d35:	48 85 f6             	test   %rsi,%rsi
+  803d38:	74 26                	je     803d60 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d3a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d3e:	48 bf b8 35 80 00 00 	movabs $0x8035b8,%rdi
+  803d45:	00 00 00 
+  803d48:	48 b8 0d 36 80 00 00 	movabs $0x80360d,%rax
+  803d4f:	00 00 00 
+  803d52:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d54:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d58:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d5b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d5e:	c9                   	leave
+  803d5f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d65:	eb f7                	jmp    803d5e <vsnprintf+0x4a>
+
+0000000000803d67 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d67:	55                   	push   %rbp
+  803d68:	48 89 e5             	mov    %rsp,%rbp
+  803d6b:	48 83 ec 50          	sub    $0x50,%rsp
+  803d6f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d73:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d77:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d7b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d82:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d8a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d8e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d92:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d96:	48 b8 14 3d 80 00 00 	movabs $0x803d14,%rax
+  803d9d:	00 00 00 
+  803da0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803da2:	c9                   	leave
+  803da3:	c3                   	ret
+
+0000000000803da4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803da4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803da7:	74 10                	je     803db9 <strlen+0x15>
+    size_t n = 0;
+  803da9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803dae:	48 83 c0 01          	add    $0x1,%rax
+  803db2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803db6:	75 f6                	jne    803dae <strlen+0xa>
+  803db8:	c3                   	ret
+    size_t n = 0;
+  803db9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dbe:	c3                   	ret
+
+0000000000803dbf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803dbf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803dc2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dc7:	48 85 f6             	test   %rsi,%rsi
+  803dca:	74 11                	je     803ddd <strnlen+0x1e>
+  803dcc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dd0:	74 0c                	je     803dde <strnlen+0x1f>
+  803dd2:	48 83 c2 01          	add    $0x1,%rdx
+  803dd6:	48 39 d0             	cmp    %rdx,%rax
+  803dd9:	75 f1                	jne    803dcc <strnlen+0xd>
+  803ddb:	eb 04                	jmp    803de1 <strnlen+0x22>
+  803ddd:	c3                   	ret
+  803dde:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803de1:	c3                   	ret
+
+0000000000803de2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803de2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803de5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dea:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dee:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803df1:	48 83 c2 01          	add    $0x1,%rdx
+  803df5:	84 c9                	test   %cl,%cl
+  803df7:	75 f1                	jne    803dea <strcpy+0x8>
+        ;
+    return res;
+}
+  803df9:	c3                   	ret
+
+0000000000803dfa <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803dfa:	55                   	push   %rbp
+  803dfb:	48 89 e5             	mov    %rsp,%rbp
+  803dfe:	41 54                	push   %r12
+  803e00:	53                   	push   %rbx
+  803e01:	48 89 fb             	mov    %rdi,%rbx
+  803e04:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e07:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e13:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e17:	4c 89 e6             	mov    %r12,%rsi
+  803e1a:	48 b8 e2 3d 80 00 00 	movabs $0x803de2,%rax
+  803e21:	00 00 00 
+  803e24:	ff d0                	call   *%rax
+    return dst;
+}
+  803e26:	48 89 d8             	mov    %rbx,%rax
+  803e29:	5b                   	pop    %rbx
+  803e2a:	41 5c                	pop    %r12
+  803e2c:	5d                   	pop    %rbp
+  803e2d:	c3                   	ret
+
+0000000000803e2e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e2e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e31:	48 85 d2             	test   %rdx,%rdx
+  803e34:	74 1f                	je     803e55 <strncpy+0x27>
+  803e36:	48 01 fa             	add    %rdi,%rdx
+  803e39:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e3c:	48 83 c1 01          	add    $0x1,%rcx
+  803e40:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e44:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e48:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e4c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e50:	48 39 ca             	cmp    %rcx,%rdx
+  803e53:	75 e7                	jne    803e3c <strncpy+0xe>
+    }
+    return ret;
+}
+  803e55:	c3                   	ret
+
+0000000000803e56 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e56:	48 89 f8             	mov    %rdi,%rax
+  803e59:	48 85 d2             	test   %rdx,%rdx
+  803e5c:	74 24                	je     803e82 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e5e:	48 83 ea 01          	sub    $0x1,%rdx
+  803e62:	74 1b                	je     803e7f <strlcpy+0x29>
+  803e64:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e68:	0f b6 16             	movzbl (%rsi),%edx
+  803e6b:	84 d2                	test   %dl,%dl
+  803e6d:	74 10                	je     803e7f <strlcpy+0x29>
+            *dst++ = *src++;
+  803e6f:	48 83 c6 01          	add    $0x1,%rsi
+  803e73:	48 83 c0 01          	add    $0x1,%rax
+  803e77:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e7a:	48 39 c8             	cmp    %rcx,%rax
+  803e7d:	75 e9                	jne    803e68 <strlcpy+0x12>
+        *dst = '\0';
+  803e7f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e82:	48 29 f8             	sub    %rdi,%rax
+}
+  803e85:	c3                   	ret
+
+0000000000803e86 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e86:	0f b6 07             	movzbl (%rdi),%eax
+  803e89:	84 c0                	test   %al,%al
+  803e8b:	74 13                	je     803ea0 <strcmp+0x1a>
+  803e8d:	38 06                	cmp    %al,(%rsi)
+  803e8f:	75 0f                	jne    803ea0 <strcmp+0x1a>
+  803e91:	48 83 c7 01          	add    $0x1,%rdi
+  803e95:	48 83 c6 01          	add    $0x1,%rsi
+  803e99:	0f b6 07             	movzbl (%rdi),%eax
+  803e9c:	84 c0                	test   %al,%al
+  803e9e:	75 ed                	jne    803e8d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ea0:	0f b6 c0             	movzbl %al,%eax
+  803ea3:	0f b6 16             	movzbl (%rsi),%edx
+  803ea6:	29 d0                	sub    %edx,%eax
+}
+  803ea8:	c3                   	ret
+
+0000000000803ea9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ea9:	48 85 d2             	test   %rdx,%rdx
+  803eac:	74 1f                	je     803ecd <strncmp+0x24>
+  803eae:	0f b6 07             	movzbl (%rdi),%eax
+  803eb1:	84 c0                	test   %al,%al
+  803eb3:	74 1e                	je     803ed3 <strncmp+0x2a>
+  803eb5:	3a 06                	cmp    (%rsi),%al
+  803eb7:	75 1a                	jne    803ed3 <strncmp+0x2a>
+  803eb9:	48 83 c7 01          	add    $0x1,%rdi
+  803ebd:	48 83 c6 01          	add    $0x1,%rsi
+  803ec1:	48 83 ea 01          	sub    $0x1,%rdx
+  803ec5:	75 e7                	jne    803eae <strncmp+0x5>
+
+    if (!n) return 0;
+  803ec7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecc:	c3                   	ret
+  803ecd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed2:	c3                   	ret
+  803ed3:	48 85 d2             	test   %rdx,%rdx
+  803ed6:	74 09                	je     803ee1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ed8:	0f b6 07             	movzbl (%rdi),%eax
+  803edb:	0f b6 16             	movzbl (%rsi),%edx
+  803ede:	29 d0                	sub    %edx,%eax
+  803ee0:	c3                   	ret
+    if (!n) return 0;
+  803ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ee6:	c3                   	ret
+
+0000000000803ee7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ee7:	0f b6 17             	movzbl (%rdi),%edx
+  803eea:	84 d2                	test   %dl,%dl
+  803eec:	74 18                	je     803f06 <strchr+0x1f>
+        if (*str == c) {
+  803eee:	0f be d2             	movsbl %dl,%edx
+  803ef1:	39 f2                	cmp    %esi,%edx
+  803ef3:	74 17                	je     803f0c <strchr+0x25>
+    for (; *str; str++) {
+  803ef5:	48 83 c7 01          	add    $0x1,%rdi
+  803ef9:	0f b6 17             	movzbl (%rdi),%edx
+  803efc:	84 d2                	test   %dl,%dl
+  803efe:	75 ee                	jne    803eee <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f00:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f05:	c3                   	ret
+  803f06:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0b:	c3                   	ret
+  803f0c:	48 89 f8             	mov    %rdi,%rax
+}
+  803f0f:	c3                   	ret
+
+0000000000803f10 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f10:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f13:	0f b6 17             	movzbl (%rdi),%edx
+  803f16:	84 d2                	test   %dl,%dl
+  803f18:	74 13                	je     803f2d <strfind+0x1d>
+  803f1a:	0f be d2             	movsbl %dl,%edx
+  803f1d:	39 f2                	cmp    %esi,%edx
+  803f1f:	74 0b                	je     803f2c <strfind+0x1c>
+  803f21:	48 83 c0 01          	add    $0x1,%rax
+  803f25:	0f b6 10             	movzbl (%rax),%edx
+  803f28:	84 d2                	test   %dl,%dl
+  803f2a:	75 ee                	jne    803f1a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f2c:	c3                   	ret
+  803f2d:	c3                   	ret
+
+0000000000803f2e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f2e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f31:	48 89 f8             	mov    %rdi,%rax
+  803f34:	48 f7 d8             	neg    %rax
+  803f37:	83 e0 07             	and    $0x7,%eax
+  803f3a:	49 89 d1             	mov    %rdx,%r9
+  803f3d:	49 29 c1             	sub    %rax,%r9
+  803f40:	78 36                	js     803f78 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f42:	40 0f b6 c6          	movzbl %sil,%eax
+  803f46:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f4d:	01 01 01 
+  803f50:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f54:	40 f6 c7 07          	test   $0x7,%dil
+  803f58:	75 38                	jne    803f92 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f5a:	4c 89 c9             	mov    %r9,%rcx
+  803f5d:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f61:	74 0c                	je     803f6f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f63:	fc                   	cld
+  803f64:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f67:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f6b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f6f:	4d 85 c9             	test   %r9,%r9
+  803f72:	75 45                	jne    803fb9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f74:	4c 89 c0             	mov    %r8,%rax
+  803f77:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f78:	48 85 d2             	test   %rdx,%rdx
+  803f7b:	74 f7                	je     803f74 <memset+0x46>
+  803f7d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f80:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f83:	48 83 c0 01          	add    $0x1,%rax
+  803f87:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f8b:	48 39 c2             	cmp    %rax,%rdx
+  803f8e:	75 f3                	jne    803f83 <memset+0x55>
+  803f90:	eb e2                	jmp    803f74 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f92:	40 f6 c7 01          	test   $0x1,%dil
+  803f96:	74 06                	je     803f9e <memset+0x70>
+  803f98:	88 07                	mov    %al,(%rdi)
+  803f9a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f9e:	40 f6 c7 02          	test   $0x2,%dil
+  803fa2:	74 07                	je     803fab <memset+0x7d>
+  803fa4:	66 89 07             	mov    %ax,(%rdi)
+  803fa7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fab:	40 f6 c7 04          	test   $0x4,%dil
+  803faf:	74 a9                	je     803f5a <memset+0x2c>
+  803fb1:	89 07                	mov    %eax,(%rdi)
+  803fb3:	48 83 c7 04          	add    $0x4,%rdi
+  803fb7:	eb a1                	jmp    803f5a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fb9:	41 f6 c1 04          	test   $0x4,%r9b
+  803fbd:	74 06                	je     803fc5 <memset+0x97>
+  803fbf:	89 07                	mov    %eax,(%rdi)
+  803fc1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fc5:	41 f6 c1 02          	test   $0x2,%r9b
+  803fc9:	74 07                	je     803fd2 <memset+0xa4>
+  803fcb:	66 89 07             	mov    %ax,(%rdi)
+  803fce:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fd2:	41 f6 c1 01          	test   $0x1,%r9b
+  803fd6:	74 9c                	je     803f74 <memset+0x46>
+  803fd8:	88 07                	mov    %al,(%rdi)
+  803fda:	eb 98                	jmp    803f74 <memset+0x46>
+
+0000000000803fdc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fdc:	48 89 f8             	mov    %rdi,%rax
+  803fdf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fe2:	48 39 fe             	cmp    %rdi,%rsi
+  803fe5:	73 3b                	jae    804022 <memmove+0x46>
+  803fe7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803feb:	48 39 d7             	cmp    %rdx,%rdi
+  803fee:	73 32                	jae    804022 <memmove+0x46>
+        s += n;
+        d += n;
+  803ff0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803ff4:	48 89 d6             	mov    %rdx,%rsi
+  803ff7:	48 09 fe             	or     %rdi,%rsi
+  803ffa:	48 09 ce             	or     %rcx,%rsi
+  803ffd:	40 f6 c6 07          	test   $0x7,%sil
+  804001:	75 12                	jne    804015 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  804003:	48 83 ef 08          	sub    $0x8,%rdi
+  804007:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80400b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80400f:	fd                   	std
+  804010:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804013:	fc                   	cld
+  804014:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804015:	48 83 ef 01          	sub    $0x1,%rdi
+  804019:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80401d:	fd                   	std
+  80401e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804020:	eb f1                	jmp    804013 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804022:	48 89 f2             	mov    %rsi,%rdx
+  804025:	48 09 c2             	or     %rax,%rdx
+  804028:	48 09 ca             	or     %rcx,%rdx
+  80402b:	f6 c2 07             	test   $0x7,%dl
+  80402e:	75 0c                	jne    80403c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804030:	48 c1 e9 03          	shr    $0x3,%rcx
+  804034:	48 89 c7             	mov    %rax,%rdi
+  804037:	fc                   	cld
+  804038:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80403b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80403c:	48 89 c7             	mov    %rax,%rdi
+  80403f:	fc                   	cld
+  804040:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804042:	c3                   	ret
+
+0000000000804043 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804043:	55                   	push   %rbp
+  804044:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  804047:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  80404e:	00 00 00 
+  804051:	ff d0                	call   *%rax
+}
+  804053:	5d                   	pop    %rbp
+  804054:	c3                   	ret
+
+0000000000804055 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804055:	55                   	push   %rbp
+  804056:	48 89 e5             	mov    %rsp,%rbp
+  804059:	41 57                	push   %r15
+  80405b:	41 56                	push   %r14
+  80405d:	41 55                	push   %r13
+  80405f:	41 54                	push   %r12
+  804061:	53                   	push   %rbx
+  804062:	48 83 ec 08          	sub    $0x8,%rsp
+  804066:	49 89 fe             	mov    %rdi,%r14
+  804069:	49 89 f7             	mov    %rsi,%r15
+  80406c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80406f:	48 89 f7             	mov    %rsi,%rdi
+  804072:	48 b8 a4 3d 80 00 00 	movabs $0x803da4,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804081:	48 89 de             	mov    %rbx,%rsi
+  804084:	4c 89 f7             	mov    %r14,%rdi
+  804087:	48 b8 bf 3d 80 00 00 	movabs $0x803dbf,%rax
+  80408e:	00 00 00 
+  804091:	ff d0                	call   *%rax
+  804093:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  804096:	48 39 c3             	cmp    %rax,%rbx
+  804099:	74 36                	je     8040d1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80409b:	48 89 d8             	mov    %rbx,%rax
+  80409e:	4c 29 e8             	sub    %r13,%rax
+  8040a1:	49 39 c4             	cmp    %rax,%r12
+  8040a4:	73 31                	jae    8040d7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8040a6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040ab:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040af:	4c 89 fe             	mov    %r15,%rsi
+  8040b2:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  8040b9:	00 00 00 
+  8040bc:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040be:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040c2:	48 83 c4 08          	add    $0x8,%rsp
+  8040c6:	5b                   	pop    %rbx
+  8040c7:	41 5c                	pop    %r12
+  8040c9:	41 5d                	pop    %r13
+  8040cb:	41 5e                	pop    %r14
+  8040cd:	41 5f                	pop    %r15
+  8040cf:	5d                   	pop    %rbp
+  8040d0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040d1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040d5:	eb eb                	jmp    8040c2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040d7:	48 83 eb 01          	sub    $0x1,%rbx
+  8040db:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040df:	48 89 da             	mov    %rbx,%rdx
+  8040e2:	4c 89 fe             	mov    %r15,%rsi
+  8040e5:	48 b8 43 40 80 00 00 	movabs $0x804043,%rax
+  8040ec:	00 00 00 
+  8040ef:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040f1:	49 01 de             	add    %rbx,%r14
+  8040f4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040f9:	eb c3                	jmp    8040be <strlcat+0x69>
+
+00000000008040fb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040fb:	48 85 d2             	test   %rdx,%rdx
+  8040fe:	74 2d                	je     80412d <memcmp+0x32>
+  804100:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  804105:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  804109:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80410e:	44 38 c1             	cmp    %r8b,%cl
+  804111:	75 0f                	jne    804122 <memcmp+0x27>
+    while (n-- > 0) {
+  804113:	48 83 c0 01          	add    $0x1,%rax
+  804117:	48 39 c2             	cmp    %rax,%rdx
+  80411a:	75 e9                	jne    804105 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80411c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804121:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804122:	0f b6 c1             	movzbl %cl,%eax
+  804125:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804129:	44 29 c0             	sub    %r8d,%eax
+  80412c:	c3                   	ret
+    return 0;
+  80412d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804132:	c3                   	ret
+
+0000000000804133 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804133:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804137:	48 39 c7             	cmp    %rax,%rdi
+  80413a:	73 0f                	jae    80414b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80413c:	40 38 37             	cmp    %sil,(%rdi)
+  80413f:	74 0e                	je     80414f <memfind+0x1c>
+    for (; src < end; src++) {
+  804141:	48 83 c7 01          	add    $0x1,%rdi
+  804145:	48 39 f8             	cmp    %rdi,%rax
+  804148:	75 f2                	jne    80413c <memfind+0x9>
+  80414a:	c3                   	ret
+  80414b:	48 89 f8             	mov    %rdi,%rax
+  80414e:	c3                   	ret
+  80414f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804152:	c3                   	ret
+
+0000000000804153 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804153:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  804156:	0f b6 37             	movzbl (%rdi),%esi
+  804159:	40 80 fe 20          	cmp    $0x20,%sil
+  80415d:	74 06                	je     804165 <strtol+0x12>
+  80415f:	40 80 fe 09          	cmp    $0x9,%sil
+  804163:	75 13                	jne    804178 <strtol+0x25>
+  804165:	48 83 c7 01          	add    $0x1,%rdi
+  804169:	0f b6 37             	movzbl (%rdi),%esi
+  80416c:	40 80 fe 20          	cmp    $0x20,%sil
+  804170:	74 f3                	je     804165 <strtol+0x12>
+  804172:	40 80 fe 09          	cmp    $0x9,%sil
+  804176:	74 ed                	je     804165 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  804178:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80417b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80417e:	3c 01                	cmp    $0x1,%al
+  804180:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804184:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80418a:	75 0f                	jne    80419b <strtol+0x48>
+  80418c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80418f:	74 14                	je     8041a5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804191:	85 d2                	test   %edx,%edx
+  804193:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804198:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80419b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041a0:	4c 63 ca             	movslq %edx,%r9
+  8041a3:	eb 36                	jmp    8041db <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041a5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8041a9:	74 0f                	je     8041ba <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041ab:	85 d2                	test   %edx,%edx
+  8041ad:	75 ec                	jne    80419b <strtol+0x48>
+        s++;
+  8041af:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041b3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041b8:	eb e1                	jmp    80419b <strtol+0x48>
+        s += 2;
+  8041ba:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041be:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041c3:	eb d6                	jmp    80419b <strtol+0x48>
+            dig -= '0';
+  8041c5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041c8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041cc:	41 39 d0             	cmp    %edx,%r8d
+  8041cf:	7d 21                	jge    8041f2 <strtol+0x9f>
+        val = val * base + dig;
+  8041d1:	49 0f af c1          	imul   %r9,%rax
+  8041d5:	0f b6 c9             	movzbl %cl,%ecx
+  8041d8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041db:	48 83 c7 01          	add    $0x1,%rdi
+  8041df:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041e3:	80 f9 39             	cmp    $0x39,%cl
+  8041e6:	76 dd                	jbe    8041c5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041e8:	80 f9 7b             	cmp    $0x7b,%cl
+  8041eb:	77 05                	ja     8041f2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041ed:	83 e9 57             	sub    $0x57,%ecx
+  8041f0:	eb d6                	jmp    8041c8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041f2:	4d 85 d2             	test   %r10,%r10
+  8041f5:	74 03                	je     8041fa <strtol+0xa7>
+  8041f7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041fa:	48 89 c2             	mov    %rax,%rdx
+  8041fd:	48 f7 da             	neg    %rdx
+  804200:	40 80 fe 2d          	cmp    $0x2d,%sil
+  804204:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804208:	c3                   	ret
+
+0000000000804209 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804209:	55                   	push   %rbp
+  80420a:	48 89 e5             	mov    %rsp,%rbp
+  80420d:	41 56                	push   %r14
+  80420f:	41 55                	push   %r13
+  804211:	41 54                	push   %r12
+  804213:	53                   	push   %rbx
+  804214:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804217:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80421e:	00 00 00 
+  804221:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804225:	74 27                	je     80424e <_handle_vectored_pagefault+0x45>
+  804227:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80422c:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804233:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804236:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804239:	4c 89 e7             	mov    %r12,%rdi
+  80423c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804241:	84 c0                	test   %al,%al
+  804243:	75 45                	jne    80428a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804245:	48 83 c3 01          	add    $0x1,%rbx
+  804249:	49 3b 1e             	cmp    (%r14),%rbx
+  80424c:	72 eb                	jb     804239 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80424e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804255:	00 
+  804256:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80425b:	4d 8b 04 24          	mov    (%r12),%r8
+  80425f:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  804266:	00 00 00 
+  804269:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80426e:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804275:	00 00 00 
+  804278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427d:	49 ba 6d 33 80 00 00 	movabs $0x80336d,%r10
+  804284:	00 00 00 
+  804287:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80428a:	5b                   	pop    %rbx
+  80428b:	41 5c                	pop    %r12
+  80428d:	41 5d                	pop    %r13
+  80428f:	41 5e                	pop    %r14
+  804291:	5d                   	pop    %rbp
+  804292:	c3                   	ret
+
+0000000000804293 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804293:	55                   	push   %rbp
+  804294:	48 89 e5             	mov    %rsp,%rbp
+  804297:	53                   	push   %rbx
+  804298:	48 83 ec 08          	sub    $0x8,%rsp
+  80429c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80429f:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042a6:	00 00 00 
+  8042a9:	80 38 00             	cmpb   $0x0,(%rax)
+  8042ac:	0f 84 84 00 00 00    	je     804336 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042b2:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042b9:	00 00 00 
+  8042bc:	48 8b 10             	mov    (%rax),%rdx
+  8042bf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042c4:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042cb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ce:	48 85 d2             	test   %rdx,%rdx
+  8042d1:	74 19                	je     8042ec <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042d3:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042d7:	0f 84 e8 00 00 00    	je     8043c5 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042dd:	48 83 c0 01          	add    $0x1,%rax
+  8042e1:	48 39 d0             	cmp    %rdx,%rax
+  8042e4:	75 ed                	jne    8042d3 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042e6:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042ea:	74 1c                	je     804308 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042ec:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042f0:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042f7:	00 00 00 
+  8042fa:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804301:	00 00 00 
+  804304:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804308:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+  804314:	89 c7                	mov    %eax,%edi
+  804316:	48 be 8b 44 80 00 00 	movabs $0x80448b,%rsi
+  80431d:	00 00 00 
+  804320:	48 b8 0d 04 80 00 00 	movabs $0x80040d,%rax
+  804327:	00 00 00 
+  80432a:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80432c:	85 c0                	test   %eax,%eax
+  80432e:	78 68                	js     804398 <add_pgfault_handler+0x105>
+    return res;
+}
+  804330:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804334:	c9                   	leave
+  804335:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804336:	48 b8 c2 01 80 00 00 	movabs $0x8001c2,%rax
+  80433d:	00 00 00 
+  804340:	ff d0                	call   *%rax
+  804342:	89 c7                	mov    %eax,%edi
+  804344:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804349:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80434e:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804355:	00 00 00 
+  804358:	48 b8 4f 02 80 00 00 	movabs $0x80024f,%rax
+  80435f:	00 00 00 
+  804362:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804364:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80436b:	00 00 00 
+  80436e:	48 8b 02             	mov    (%rdx),%rax
+  804371:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804375:	48 89 0a             	mov    %rcx,(%rdx)
+  804378:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80437f:	00 00 00 
+  804382:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804386:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80438d:	00 00 00 
+  804390:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804393:	e9 70 ff ff ff       	jmp    804308 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804398:	89 c1                	mov    %eax,%ecx
+  80439a:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  8043a1:	00 00 00 
+  8043a4:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043a9:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  8043b0:	00 00 00 
+  8043b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b8:	49 b8 6d 33 80 00 00 	movabs $0x80336d,%r8
+  8043bf:	00 00 00 
+  8043c2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ca:	e9 61 ff ff ff       	jmp    804330 <add_pgfault_handler+0x9d>
+
+00000000008043cf <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043cf:	55                   	push   %rbp
+  8043d0:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043d3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043da:	00 00 00 
+  8043dd:	80 38 00             	cmpb   $0x0,(%rax)
+  8043e0:	74 33                	je     804415 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043e2:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043e9:	00 00 00 
+  8043ec:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043f1:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043f8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043fb:	48 85 c0             	test   %rax,%rax
+  8043fe:	0f 84 85 00 00 00    	je     804489 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804404:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804408:	74 40                	je     80444a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80440a:	48 83 c1 01          	add    $0x1,%rcx
+  80440e:	48 39 c1             	cmp    %rax,%rcx
+  804411:	75 f1                	jne    804404 <remove_pgfault_handler+0x35>
+  804413:	eb 74                	jmp    804489 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804415:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  80441c:	00 00 00 
+  80441f:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  804426:	00 00 00 
+  804429:	be 43 00 00 00       	mov    $0x43,%esi
+  80442e:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804435:	00 00 00 
+  804438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443d:	49 b8 6d 33 80 00 00 	movabs $0x80336d,%r8
+  804444:	00 00 00 
+  804447:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80444a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804451:	00 
+  804452:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804456:	48 29 ca             	sub    %rcx,%rdx
+  804459:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804460:	00 00 00 
+  804463:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804467:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80446c:	48 89 ce             	mov    %rcx,%rsi
+  80446f:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  804476:	00 00 00 
+  804479:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80447b:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804482:	00 00 00 
+  804485:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804489:	5d                   	pop    %rbp
+  80448a:	c3                   	ret
+
+000000000080448b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80448b:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80448e:	48 b8 09 42 80 00 00 	movabs $0x804209,%rax
+  804495:	00 00 00 
+    call *%rax
+  804498:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80449a:	41 5f                	pop    %r15
+	popq %r15
+  80449c:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80449e:	41 5f                	pop    %r15
+	popq %r14
+  8044a0:	41 5e                	pop    %r14
+	popq %r13
+  8044a2:	41 5d                	pop    %r13
+	popq %r12
+  8044a4:	41 5c                	pop    %r12
+	popq %r11
+  8044a6:	41 5b                	pop    %r11
+	popq %r10
+  8044a8:	41 5a                	pop    %r10
+	popq %r9
+  8044aa:	41 59                	pop    %r9
+	popq %r8
+  8044ac:	41 58                	pop    %r8
+	popq %rsi
+  8044ae:	5e                   	pop    %rsi
+	popq %rdi
+  8044af:	5f                   	pop    %rdi
+	popq %rbp
+  8044b0:	5d                   	pop    %rbp
+	popq %rdx
+  8044b1:	5a                   	pop    %rdx
+	popq %rcx
+  8044b2:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044b3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044b8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044bd:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044c1:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044c4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044c9:	5b                   	pop    %rbx
+	popq %rax
+  8044ca:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044cb:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044cf:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044d0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044d5:	c3                   	ret
+
+00000000008044d6 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044d6:	55                   	push   %rbp
+  8044d7:	48 89 e5             	mov    %rsp,%rbp
+  8044da:	41 55                	push   %r13
+  8044dc:	41 54                	push   %r12
+  8044de:	53                   	push   %rbx
+  8044df:	48 83 ec 08          	sub    $0x8,%rsp
+  8044e3:	49 89 fd             	mov    %rdi,%r13
+  8044e6:	48 89 f7             	mov    %rsi,%rdi
+  8044e9:	48 89 d3             	mov    %rdx,%rbx
+  8044ec:	49 89 cc             	mov    %rcx,%r12
+  8044ef:	4c 89 c2             	mov    %r8,%rdx
+  8044f2:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044f5:	48 85 f6             	test   %rsi,%rsi
+  8044f8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044ff:	00 00 00 
+  804502:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804506:	be 00 10 00 00       	mov    $0x1000,%esi
+  80450b:	48 85 db             	test   %rbx,%rbx
+  80450e:	74 03                	je     804513 <ipc_recv_futex+0x3d>
+  804510:	48 8b 33             	mov    (%rbx),%rsi
+  804513:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804517:	48 b8 99 04 80 00 00 	movabs $0x800499,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+    if (res < 0) {
+  804523:	85 c0                	test   %eax,%eax
+  804525:	78 75                	js     80459c <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804527:	4d 85 ed             	test   %r13,%r13
+  80452a:	74 14                	je     804540 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80452c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804533:	00 00 00 
+  804536:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80453c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804540:	4d 85 e4             	test   %r12,%r12
+  804543:	74 14                	je     804559 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804545:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80454c:	00 00 00 
+  80454f:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804555:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804559:	48 85 db             	test   %rbx,%rbx
+  80455c:	74 23                	je     804581 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80455e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804565:	00 00 00 
+  804568:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80456e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804573:	85 c9                	test   %ecx,%ecx
+  804575:	74 07                	je     80457e <ipc_recv_futex+0xa8>
+  804577:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80457e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804581:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804588:	00 00 00 
+  80458b:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804591:	48 83 c4 08          	add    $0x8,%rsp
+  804595:	5b                   	pop    %rbx
+  804596:	41 5c                	pop    %r12
+  804598:	41 5d                	pop    %r13
+  80459a:	5d                   	pop    %rbp
+  80459b:	c3                   	ret
+        if (from_env_store != NULL) {
+  80459c:	4d 85 ed             	test   %r13,%r13
+  80459f:	74 08                	je     8045a9 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045a1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045a8:	00 
+        if (perm_store != NULL) {
+  8045a9:	4d 85 e4             	test   %r12,%r12
+  8045ac:	74 08                	je     8045b6 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045ae:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045b5:	00 
+        if (size != NULL) {
+  8045b6:	48 85 db             	test   %rbx,%rbx
+  8045b9:	74 d6                	je     804591 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045bb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045c2:	eb cd                	jmp    804591 <ipc_recv_futex+0xbb>
+
+00000000008045c4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045c4:	55                   	push   %rbp
+  8045c5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8045cc:	6a 00                	push   $0x0
+  8045ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045da:	48 b8 d6 44 80 00 00 	movabs $0x8044d6,%rax
+  8045e1:	00 00 00 
+  8045e4:	ff d0                	call   *%rax
+}
+  8045e6:	c9                   	leave
+  8045e7:	c3                   	ret
+
+00000000008045e8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045e8:	55                   	push   %rbp
+  8045e9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045ec:	48 85 d2             	test   %rdx,%rdx
+  8045ef:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045f6:	00 00 00 
+  8045f9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045fd:	89 f6                	mov    %esi,%esi
+  8045ff:	48 b8 82 04 80 00 00 	movabs $0x800482,%rax
+  804606:	00 00 00 
+  804609:	ff d0                	call   *%rax
+    if (res < 0) {
+  80460b:	85 c0                	test   %eax,%eax
+  80460d:	78 02                	js     804611 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80460f:	5d                   	pop    %rbp
+  804610:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804611:	89 c1                	mov    %eax,%ecx
+  804613:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  80461a:	00 00 00 
+  80461d:	be 50 00 00 00       	mov    $0x50,%esi
+  804622:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  804629:	00 00 00 
+  80462c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804631:	49 b8 6d 33 80 00 00 	movabs $0x80336d,%r8
+  804638:	00 00 00 
+  80463b:	41 ff d0             	call   *%r8
+
+000000000080463e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80463e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804643:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80464a:	00 00 00 
+  80464d:	48 89 d0             	mov    %rdx,%rax
+  804650:	48 c1 e0 04          	shl    $0x4,%rax
+  804654:	48 29 d0             	sub    %rdx,%rax
+  804657:	48 c1 e0 05          	shl    $0x5,%rax
+  80465b:	48 01 c8             	add    %rcx,%rax
+  80465e:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804664:	39 f8                	cmp    %edi,%eax
+  804666:	74 13                	je     80467b <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804668:	48 83 c2 01          	add    $0x1,%rdx
+  80466c:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804673:	75 d8                	jne    80464d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804675:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80467a:	c3                   	ret
+            return envs[i].env_id;
+  80467b:	48 89 d0             	mov    %rdx,%rax
+  80467e:	48 c1 e0 04          	shl    $0x4,%rax
+  804682:	48 29 d0             	sub    %rdx,%rax
+  804685:	48 c1 e0 05          	shl    $0x5,%rax
+  804689:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804690:	00 00 00 
+  804693:	48 01 d0             	add    %rdx,%rax
+  804696:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80469c:	c3                   	ret
+  80469d:	0f 1f 00             	nopl   (%rax)
+
+00000000008046a0 <__rodata_start>:
+  8046a0:	3c 75                	cmp    $0x75,%al
+  8046a2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046a3:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046a8:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8046ac:	1f                   	(bad)
+  8046ad:	44 00 00             	add    %r8b,(%rax)
+  8046b0:	73 79                	jae    80472b <__rodata_start+0x8b>
+  8046b2:	73 63                	jae    804717 <__rodata_start+0x77>
+  8046b4:	61                   	(bad)
+  8046b5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046b7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab37 <__bss_end+0x721c8b37>
+  8046bd:	65 74 75             	gs je  804735 <__rodata_start+0x95>
+  8046c0:	72 6e                	jb     804730 <__rodata_start+0x90>
+  8046c2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab44 <__bss_end+0x281c8b44>
+  8046c9:	28 
+  8046ca:	3e 20 30             	ds and %dh,(%rax)
+  8046cd:	29 00                	sub    %eax,(%rax)
+  8046cf:	6c                   	insb   (%dx),%es:(%rdi)
+  8046d0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046d7:	61                   	(bad)
+  8046d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8046d9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046da:	2e 63 00             	cs movsxd (%rax),%eax
+  8046dd:	0f 1f 00             	nopl   (%rax)
+  8046e0:	5b                   	pop    %rbx
+  8046e1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046e6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046e9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046ed:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046ee:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046f2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046f9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805164 <__ctors_end+0x84>
+  804700:	5b                   	pop    %rbx
+  804701:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804706:	20 66 74             	and    %ah,0x74(%rsi)
+  804709:	72 75                	jb     804780 <devtab+0x20>
+  80470b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80470c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80470f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad677a <__bss_end+0x2d29477a>
+  804716:	20 62 61             	and    %ah,0x61(%rdx)
+  804719:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80471d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804721:	5b                   	pop    %rbx
+  804722:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804727:	20 72 65             	and    %dh,0x65(%rdx)
+  80472a:	61                   	(bad)
+  80472b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad6796 <__bss_end+0x2d294796>
+  804732:	20 62 61             	and    %ah,0x61(%rdx)
+  804735:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804739:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80473d:	5b                   	pop    %rbx
+  80473e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804743:	20 77 72             	and    %dh,0x72(%rdi)
+  804746:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80474d:	2d 
+  80474e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804753:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804756:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80475a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	aa 36 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	db 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	eb 3c 80 00 00 00 00 00 c9 36 80 00 00 00 00 00     .<.......6......
+  804a00:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	bd 36 80 00 00 00 00 00 37 37 80 00 00 00 00 00     .6......77......
+  804a20:	eb 3c 80 00 00 00 00 00 bd 36 80 00 00 00 00 00     .<.......6......
+  804a30:	03 37 80 00 00 00 00 00 03 37 80 00 00 00 00 00     .7.......7......
+  804a40:	03 37 80 00 00 00 00 00 03 37 80 00 00 00 00 00     .7.......7......
+  804a50:	03 37 80 00 00 00 00 00 03 37 80 00 00 00 00 00     .7.......7......
+  804a60:	03 37 80 00 00 00 00 00 03 37 80 00 00 00 00 00     .7.......7......
+  804a70:	03 37 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .7.......<......
+  804a80:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	eb 3c 80 00 00 00 00 00 0e 3c 80 00 00 00 00 00     .<.......<......
+  804b70:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	5a 37 80 00 00 00 00 00 29 39 80 00 00 00 00 00     Z7......)9......
+  804bd0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	89 37 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .7.......<......
+  804c00:	eb 3c 80 00 00 00 00 00 4f 37 80 00 00 00 00 00     .<......O7......
+  804c10:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	d1 3a 80 00 00 00 00 00 9b 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	eb 3c 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	20 38 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00      8.......<......
+  804c50:	fd 39 80 00 00 00 00 00 eb 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	eb 3c 80 00 00 00 00 00 0e 3c 80 00 00 00 00 00     .<.......<......
+  804c70:	eb 3c 80 00 00 00 00 00 b3 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,7886 @@
+
+obj/user/buggyhello2:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 26 00 00 00       	call   800049 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+const char *hello = "hello, world\n";
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    sys_cputs(hello, 1024 * 1024);
+  800029:	be 00 00 10 00       	mov    $0x100000,%esi
+  80002e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800035:	00 00 00 
+  800038:	48 8b 38             	mov    (%rax),%rdi
+  80003b:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  800042:	00 00 00 
+  800045:	ff d0                	call   *%rax
+}
+  800047:	5d                   	pop    %rbp
+  800048:	c3                   	ret
+
+0000000000800049 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800049:	55                   	push   %rbp
+  80004a:	48 89 e5             	mov    %rsp,%rbp
+  80004d:	41 56                	push   %r14
+  80004f:	41 55                	push   %r13
+  800051:	41 54                	push   %r12
+  800053:	53                   	push   %rbx
+  800054:	41 89 fd             	mov    %edi,%r13d
+  800057:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005a:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800061:	00 00 00 
+  800064:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80006b:	00 00 00 
+  80006e:	48 39 c2             	cmp    %rax,%rdx
+  800071:	73 17                	jae    80008a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800073:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800076:	49 89 c4             	mov    %rax,%r12
+  800079:	48 83 c3 08          	add    $0x8,%rbx
+  80007d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800082:	ff 53 f8             	call   *-0x8(%rbx)
+  800085:	4c 39 e3             	cmp    %r12,%rbx
+  800088:	72 ef                	jb     800079 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80008a:	48 b8 ca 01 80 00 00 	movabs $0x8001ca,%rax
+  800091:	00 00 00 
+  800094:	ff d0                	call   *%rax
+  800096:	89 c2                	mov    %eax,%edx
+  800098:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80009e:	48 89 d0             	mov    %rdx,%rax
+  8000a1:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a5:	48 29 d0             	sub    %rdx,%rax
+  8000a8:	48 c1 e0 05          	shl    $0x5,%rax
+  8000ac:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b3:	00 00 00 
+  8000b6:	48 01 d0             	add    %rdx,%rax
+  8000b9:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c0:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c3:	45 85 ed             	test   %r13d,%r13d
+  8000c6:	7e 0d                	jle    8000d5 <libmain+0x8c>
+  8000c8:	49 8b 06             	mov    (%r14),%rax
+  8000cb:	48 a3 08 50 80 00 00 	movabs %rax,0x805008
+  8000d2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d5:	4c 89 f6             	mov    %r14,%rsi
+  8000d8:	44 89 ef             	mov    %r13d,%edi
+  8000db:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e2:	00 00 00 
+  8000e5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e7:	48 b8 fc 00 80 00 00 	movabs $0x8000fc,%rax
+  8000ee:	00 00 00 
+  8000f1:	ff d0                	call   *%rax
+#endif
+}
+  8000f3:	5b                   	pop    %rbx
+  8000f4:	41 5c                	pop    %r12
+  8000f6:	41 5d                	pop    %r13
+  8000f8:	41 5e                	pop    %r14
+  8000fa:	5d                   	pop    %rbp
+  8000fb:	c3                   	ret
+
+00000000008000fc <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000fc:	55                   	push   %rbp
+  8000fd:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800100:	48 b8 b0 08 80 00 00 	movabs $0x8008b0,%rax
+  800107:	00 00 00 
+  80010a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80010c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800111:	48 b8 67 01 80 00 00 	movabs $0x800167,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+}
+  80011d:	5d                   	pop    %rbp
+  80011e:	c3                   	ret
+
+000000000080011f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80011f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800124:	ba 00 00 00 00       	mov    $0x0,%edx
+  800129:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80012f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800135:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80013b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013d:	c3                   	ret
+
+000000000080013e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80013e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800143:	bf 00 00 00 00       	mov    $0x0,%edi
+  800148:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80014d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800152:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800158:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80015e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800164:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800166:	c3                   	ret
+
+0000000000800167 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800167:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80016a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80016f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800174:	ba 00 00 00 00       	mov    $0x0,%edx
+  800179:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80017f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800185:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80018b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80018d:	48 85 c0             	test   %rax,%rax
+  800190:	7f 01                	jg     800193 <sys_env_destroy+0x2c>
+}
+  800192:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800197:	49 89 c0             	mov    %rax,%r8
+  80019a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019f:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8001a6:	00 00 00 
+  8001a9:	be 29 00 00 00       	mov    $0x29,%esi
+  8001ae:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8001b5:	00 00 00 
+  8001b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bd:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  8001c4:	00 00 00 
+  8001c7:	41 ff d1             	call   *%r9
+
+00000000008001ca <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001ca:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001de:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001f0:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f2:	c3                   	ret
+
+00000000008001f3 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001f3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800202:	ba 00 00 00 00       	mov    $0x0,%edx
+  800207:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80020d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800213:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800219:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021b:	c3                   	ret
+
+000000000080021c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80021c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800221:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800228:	00 00 00 
+  80022b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800231:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800237:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80023d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80023f:	c3                   	ret
+
+0000000000800240 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800240:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800243:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800248:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80024e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800254:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800256:	c3                   	ret
+
+0000000000800257 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800257:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80025a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80025f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800262:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800268:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80026e:	0f 05                	syscall
+    if (check && ret > 0) {
+  800270:	48 85 c0             	test   %rax,%rax
+  800273:	7f 01                	jg     800276 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800275:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800276:	55                   	push   %rbp
+  800277:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80027a:	49 89 c0             	mov    %rax,%r8
+  80027d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800282:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800289:	00 00 00 
+  80028c:	be 29 00 00 00       	mov    $0x29,%esi
+  800291:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800298:	00 00 00 
+  80029b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a0:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  8002a7:	00 00 00 
+  8002aa:	41 ff d1             	call   *%r9
+
+00000000008002ad <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ad:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002b0:	48 63 d2             	movslq %edx,%rdx
+  8002b3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002b6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002bb:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002be:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002c0:	48 85 c0             	test   %rax,%rax
+  8002c3:	7f 01                	jg     8002c6 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002c5:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002c6:	55                   	push   %rbp
+  8002c7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002ca:	49 89 c0             	mov    %rax,%r8
+  8002cd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002d2:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8002d9:	00 00 00 
+  8002dc:	be 29 00 00 00       	mov    $0x29,%esi
+  8002e1:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8002e8:	00 00 00 
+  8002eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f0:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  8002f7:	00 00 00 
+  8002fa:	41 ff d1             	call   *%r9
+
+00000000008002fd <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002fd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800300:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800305:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80030b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800311:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800317:	0f 05                	syscall
+    if (check && ret > 0) {
+  800319:	48 85 c0             	test   %rax,%rax
+  80031c:	7f 01                	jg     80031f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80031e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80031f:	55                   	push   %rbp
+  800320:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800323:	49 89 c0             	mov    %rax,%r8
+  800326:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80032b:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800332:	00 00 00 
+  800335:	be 29 00 00 00       	mov    $0x29,%esi
+  80033a:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800341:	00 00 00 
+  800344:	b8 00 00 00 00       	mov    $0x0,%eax
+  800349:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  800350:	00 00 00 
+  800353:	41 ff d1             	call   *%r9
+
+0000000000800356 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800356:	48 63 f6             	movslq %esi,%rsi
+  800359:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80035c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800361:	ba 00 00 00 00       	mov    $0x0,%edx
+  800366:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80036c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800372:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800378:	0f 05                	syscall
+    if (check && ret > 0) {
+  80037a:	48 85 c0             	test   %rax,%rax
+  80037d:	7f 01                	jg     800380 <sys_env_set_status+0x2a>
+}
+  80037f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800380:	55                   	push   %rbp
+  800381:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800384:	49 89 c0             	mov    %rax,%r8
+  800387:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80038c:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800393:	00 00 00 
+  800396:	be 29 00 00 00       	mov    $0x29,%esi
+  80039b:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8003a2:	00 00 00 
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  8003b1:	00 00 00 
+  8003b4:	41 ff d1             	call   *%r9
+
+00000000008003b7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003b7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003ba:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003d6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003d8:	48 85 c0             	test   %rax,%rax
+  8003db:	7f 01                	jg     8003de <sys_env_set_trapframe+0x27>
+}
+  8003dd:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003de:	55                   	push   %rbp
+  8003df:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e2:	49 89 c0             	mov    %rax,%r8
+  8003e5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003ea:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8003f1:	00 00 00 
+  8003f4:	be 29 00 00 00       	mov    $0x29,%esi
+  8003f9:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800400:	00 00 00 
+  800403:	b8 00 00 00 00       	mov    $0x0,%eax
+  800408:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  80040f:	00 00 00 
+  800412:	41 ff d1             	call   *%r9
+
+0000000000800415 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800415:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800418:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80041d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800422:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80042e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800434:	0f 05                	syscall
+    if (check && ret > 0) {
+  800436:	48 85 c0             	test   %rax,%rax
+  800439:	7f 01                	jg     80043c <sys_env_set_pgfault_upcall+0x27>
+}
+  80043b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80043c:	55                   	push   %rbp
+  80043d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800440:	49 89 c0             	mov    %rax,%r8
+  800443:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800448:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80044f:	00 00 00 
+  800452:	be 29 00 00 00       	mov    $0x29,%esi
+  800457:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80045e:	00 00 00 
+  800461:	b8 00 00 00 00       	mov    $0x0,%eax
+  800466:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  80046d:	00 00 00 
+  800470:	41 ff d1             	call   *%r9
+
+0000000000800473 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800473:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800476:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800479:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80047e:	4d 63 c0             	movslq %r8d,%r8
+  800481:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800487:	0f 05                	syscall
+}
+  800489:	c3                   	ret
+
+000000000080048a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80048a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80048d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800490:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800495:	4d 63 c0             	movslq %r8d,%r8
+  800498:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80049e:	0f 05                	syscall
+}
+  8004a0:	c3                   	ret
+
+00000000008004a1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004a1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8004a6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004a9:	45 89 c0             	mov    %r8d,%r8d
+  8004ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004b2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004b4:	48 85 c0             	test   %rax,%rax
+  8004b7:	7f 01                	jg     8004ba <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004b9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004be:	49 89 c0             	mov    %rax,%r8
+  8004c1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004c6:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8004cd:	00 00 00 
+  8004d0:	be 29 00 00 00       	mov    $0x29,%esi
+  8004d5:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8004dc:	00 00 00 
+  8004df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e4:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  8004eb:	00 00 00 
+  8004ee:	41 ff d1             	call   *%r9
+
+00000000008004f1 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004f1:	55                   	push   %rbp
+  8004f2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800500:	ba 00 00 00 00       	mov    $0x0,%edx
+  800505:	48 b8 a1 04 80 00 00 	movabs $0x8004a1,%rax
+  80050c:	00 00 00 
+  80050f:	ff d0                	call   *%rax
+}
+  800511:	5d                   	pop    %rbp
+  800512:	c3                   	ret
+
+0000000000800513 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  800513:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800518:	bf 00 00 00 00       	mov    $0x0,%edi
+  80051d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800522:	ba 00 00 00 00       	mov    $0x0,%edx
+  800527:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80052d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800533:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800539:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80053b:	c3                   	ret
+
+000000000080053c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80053c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800541:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800551:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800557:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80055d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80055f:	48 85 c0             	test   %rax,%rax
+  800562:	7f 01                	jg     800565 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800564:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800569:	49 89 c0             	mov    %rax,%r8
+  80056c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800571:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800578:	00 00 00 
+  80057b:	be 29 00 00 00       	mov    $0x29,%esi
+  800580:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800587:	00 00 00 
+  80058a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058f:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  800596:	00 00 00 
+  800599:	41 ff d1             	call   *%r9
+
+000000000080059c <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80059c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8005a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005a6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005c2:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005c4:	c3                   	ret
+
+00000000008005c5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005c5:	89 d2                	mov    %edx,%edx
+  8005c7:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e0:	0f 05                	syscall
+}
+  8005e2:	c3                   	ret
+
+00000000008005e3 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005e3:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005e6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800602:	0f 05                	syscall
+}
+  800604:	c3                   	ret
+
+0000000000800605 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  800605:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800608:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80060d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800612:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800618:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80061e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800624:	0f 05                	syscall
+}
+  800626:	c3                   	ret
+
+0000000000800627 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800627:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80062a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80062f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800634:	ba 00 00 00 00       	mov    $0x0,%edx
+  800639:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80063f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800645:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80064b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80064d:	48 85 c0             	test   %rax,%rax
+  800650:	7f 01                	jg     800653 <sys_irq_ack+0x2c>
+}
+  800652:	c3                   	ret
+sys_irq_ack(int irq) {
+  800653:	55                   	push   %rbp
+  800654:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800657:	49 89 c0             	mov    %rax,%r8
+  80065a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80065f:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800666:	00 00 00 
+  800669:	be 29 00 00 00       	mov    $0x29,%esi
+  80066e:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	49 b9 75 33 80 00 00 	movabs $0x803375,%r9
+  800684:	00 00 00 
+  800687:	41 ff d1             	call   *%r9
+
+000000000080068a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80068a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800691:	ff ff ff 
+  800694:	48 01 f8             	add    %rdi,%rax
+  800697:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80069b:	c3                   	ret
+
+000000000080069c <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80069c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006a3:	ff ff ff 
+  8006a6:	48 01 f8             	add    %rdi,%rax
+  8006a9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006ad:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006b3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006b7:	c3                   	ret
+
+00000000008006b8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006b8:	55                   	push   %rbp
+  8006b9:	48 89 e5             	mov    %rsp,%rbp
+  8006bc:	41 57                	push   %r15
+  8006be:	41 56                	push   %r14
+  8006c0:	41 55                	push   %r13
+  8006c2:	41 54                	push   %r12
+  8006c4:	53                   	push   %rbx
+  8006c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c9:	49 89 ff             	mov    %rdi,%r15
+  8006cc:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006d1:	49 bd 47 2e 80 00 00 	movabs $0x802e47,%r13
+  8006d8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006db:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006e1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006e4:	48 89 df             	mov    %rbx,%rdi
+  8006e7:	41 ff d5             	call   *%r13
+  8006ea:	83 e0 04             	and    $0x4,%eax
+  8006ed:	74 17                	je     800706 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006ef:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006f6:	4c 39 f3             	cmp    %r14,%rbx
+  8006f9:	75 e6                	jne    8006e1 <fd_alloc+0x29>
+  8006fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800701:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800706:	4d 89 27             	mov    %r12,(%r15)
+}
+  800709:	48 83 c4 08          	add    $0x8,%rsp
+  80070d:	5b                   	pop    %rbx
+  80070e:	41 5c                	pop    %r12
+  800710:	41 5d                	pop    %r13
+  800712:	41 5e                	pop    %r14
+  800714:	41 5f                	pop    %r15
+  800716:	5d                   	pop    %rbp
+  800717:	c3                   	ret
+
+0000000000800718 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800718:	83 ff 1f             	cmp    $0x1f,%edi
+  80071b:	77 39                	ja     800756 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80071d:	55                   	push   %rbp
+  80071e:	48 89 e5             	mov    %rsp,%rbp
+  800721:	41 54                	push   %r12
+  800723:	53                   	push   %rbx
+  800724:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800727:	48 63 df             	movslq %edi,%rbx
+  80072a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800731:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800735:	48 89 df             	mov    %rbx,%rdi
+  800738:	48 b8 47 2e 80 00 00 	movabs $0x802e47,%rax
+  80073f:	00 00 00 
+  800742:	ff d0                	call   *%rax
+  800744:	a8 04                	test   $0x4,%al
+  800746:	74 14                	je     80075c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800748:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80074c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800751:	5b                   	pop    %rbx
+  800752:	41 5c                	pop    %r12
+  800754:	5d                   	pop    %rbp
+  800755:	c3                   	ret
+        return -E_INVAL;
+  800756:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80075b:	c3                   	ret
+        return -E_INVAL;
+  80075c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800761:	eb ee                	jmp    800751 <fd_lookup+0x39>
+
+0000000000800763 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800763:	55                   	push   %rbp
+  800764:	48 89 e5             	mov    %rsp,%rbp
+  800767:	41 54                	push   %r12
+  800769:	53                   	push   %rbx
+  80076a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80076d:	48 b8 80 47 80 00 00 	movabs $0x804780,%rax
+  800774:	00 00 00 
+  800777:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80077e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800781:	39 3b                	cmp    %edi,(%rbx)
+  800783:	74 47                	je     8007cc <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800785:	48 83 c0 08          	add    $0x8,%rax
+  800789:	48 8b 18             	mov    (%rax),%rbx
+  80078c:	48 85 db             	test   %rbx,%rbx
+  80078f:	75 f0                	jne    800781 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800791:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800798:	00 00 00 
+  80079b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007a1:	89 fa                	mov    %edi,%edx
+  8007a3:	48 bf f0 46 80 00 00 	movabs $0x8046f0,%rdi
+  8007aa:	00 00 00 
+  8007ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b2:	48 b9 c5 34 80 00 00 	movabs $0x8034c5,%rcx
+  8007b9:	00 00 00 
+  8007bc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007be:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007c3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007c7:	5b                   	pop    %rbx
+  8007c8:	41 5c                	pop    %r12
+  8007ca:	5d                   	pop    %rbp
+  8007cb:	c3                   	ret
+            return 0;
+  8007cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d1:	eb f0                	jmp    8007c3 <dev_lookup+0x60>
+
+00000000008007d3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007d3:	55                   	push   %rbp
+  8007d4:	48 89 e5             	mov    %rsp,%rbp
+  8007d7:	41 55                	push   %r13
+  8007d9:	41 54                	push   %r12
+  8007db:	53                   	push   %rbx
+  8007dc:	48 83 ec 18          	sub    $0x18,%rsp
+  8007e0:	48 89 fb             	mov    %rdi,%rbx
+  8007e3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007e6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007ed:	ff ff ff 
+  8007f0:	48 01 df             	add    %rbx,%rdi
+  8007f3:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007fb:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800802:	00 00 00 
+  800805:	ff d0                	call   *%rax
+  800807:	41 89 c5             	mov    %eax,%r13d
+  80080a:	85 c0                	test   %eax,%eax
+  80080c:	78 06                	js     800814 <fd_close+0x41>
+  80080e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800812:	74 1a                	je     80082e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800814:	45 84 e4             	test   %r12b,%r12b
+  800817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800820:	44 89 e8             	mov    %r13d,%eax
+  800823:	48 83 c4 18          	add    $0x18,%rsp
+  800827:	5b                   	pop    %rbx
+  800828:	41 5c                	pop    %r12
+  80082a:	41 5d                	pop    %r13
+  80082c:	5d                   	pop    %rbp
+  80082d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80082e:	8b 3b                	mov    (%rbx),%edi
+  800830:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800834:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  80083b:	00 00 00 
+  80083e:	ff d0                	call   *%rax
+  800840:	41 89 c5             	mov    %eax,%r13d
+  800843:	85 c0                	test   %eax,%eax
+  800845:	78 1b                	js     800862 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800847:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80084b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80084f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800855:	48 85 c0             	test   %rax,%rax
+  800858:	74 08                	je     800862 <fd_close+0x8f>
+  80085a:	48 89 df             	mov    %rbx,%rdi
+  80085d:	ff d0                	call   *%rax
+  80085f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800862:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800867:	48 89 de             	mov    %rbx,%rsi
+  80086a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80086f:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800876:	00 00 00 
+  800879:	ff d0                	call   *%rax
+    return res;
+  80087b:	eb a3                	jmp    800820 <fd_close+0x4d>
+
+000000000080087d <close>:
+
+int
+close(int fdnum) {
+  80087d:	55                   	push   %rbp
+  80087e:	48 89 e5             	mov    %rsp,%rbp
+  800881:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800885:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800889:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800890:	00 00 00 
+  800893:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800895:	85 c0                	test   %eax,%eax
+  800897:	78 15                	js     8008ae <close+0x31>
+
+    return fd_close(fd, 1);
+  800899:	be 01 00 00 00       	mov    $0x1,%esi
+  80089e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008a2:	48 b8 d3 07 80 00 00 	movabs $0x8007d3,%rax
+  8008a9:	00 00 00 
+  8008ac:	ff d0                	call   *%rax
+}
+  8008ae:	c9                   	leave
+  8008af:	c3                   	ret
+
+00000000008008b0 <close_all>:
+
+void
+close_all(void) {
+  8008b0:	55                   	push   %rbp
+  8008b1:	48 89 e5             	mov    %rsp,%rbp
+  8008b4:	41 54                	push   %r12
+  8008b6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008b7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008bc:	49 bc 7d 08 80 00 00 	movabs $0x80087d,%r12
+  8008c3:	00 00 00 
+  8008c6:	89 df                	mov    %ebx,%edi
+  8008c8:	41 ff d4             	call   *%r12
+  8008cb:	83 c3 01             	add    $0x1,%ebx
+  8008ce:	83 fb 20             	cmp    $0x20,%ebx
+  8008d1:	75 f3                	jne    8008c6 <close_all+0x16>
+}
+  8008d3:	5b                   	pop    %rbx
+  8008d4:	41 5c                	pop    %r12
+  8008d6:	5d                   	pop    %rbp
+  8008d7:	c3                   	ret
+
+00000000008008d8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008d8:	55                   	push   %rbp
+  8008d9:	48 89 e5             	mov    %rsp,%rbp
+  8008dc:	41 57                	push   %r15
+  8008de:	41 56                	push   %r14
+  8008e0:	41 55                	push   %r13
+  8008e2:	41 54                	push   %r12
+  8008e4:	53                   	push   %rbx
+  8008e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8008e9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008ec:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008f0:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  8008f7:	00 00 00 
+  8008fa:	ff d0                	call   *%rax
+  8008fc:	89 c3                	mov    %eax,%ebx
+  8008fe:	85 c0                	test   %eax,%eax
+  800900:	0f 88 b8 00 00 00    	js     8009be <dup+0xe6>
+    close(newfdnum);
+  800906:	44 89 e7             	mov    %r12d,%edi
+  800909:	48 b8 7d 08 80 00 00 	movabs $0x80087d,%rax
+  800910:	00 00 00 
+  800913:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800915:	4d 63 ec             	movslq %r12d,%r13
+  800918:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80091f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800923:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800927:	4c 89 ff             	mov    %r15,%rdi
+  80092a:	49 be 9c 06 80 00 00 	movabs $0x80069c,%r14
+  800931:	00 00 00 
+  800934:	41 ff d6             	call   *%r14
+  800937:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80093a:	4c 89 ef             	mov    %r13,%rdi
+  80093d:	41 ff d6             	call   *%r14
+  800940:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800943:	48 89 df             	mov    %rbx,%rdi
+  800946:	48 b8 47 2e 80 00 00 	movabs $0x802e47,%rax
+  80094d:	00 00 00 
+  800950:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800952:	a8 04                	test   $0x4,%al
+  800954:	74 2b                	je     800981 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800956:	41 89 c1             	mov    %eax,%r9d
+  800959:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80095f:	4c 89 f1             	mov    %r14,%rcx
+  800962:	ba 00 00 00 00       	mov    $0x0,%edx
+  800967:	48 89 de             	mov    %rbx,%rsi
+  80096a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80096f:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  800976:	00 00 00 
+  800979:	ff d0                	call   *%rax
+  80097b:	89 c3                	mov    %eax,%ebx
+  80097d:	85 c0                	test   %eax,%eax
+  80097f:	78 4e                	js     8009cf <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800981:	4c 89 ff             	mov    %r15,%rdi
+  800984:	48 b8 47 2e 80 00 00 	movabs $0x802e47,%rax
+  80098b:	00 00 00 
+  80098e:	ff d0                	call   *%rax
+  800990:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800993:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800999:	4c 89 e9             	mov    %r13,%rcx
+  80099c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a1:	4c 89 fe             	mov    %r15,%rsi
+  8009a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a9:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  8009b0:	00 00 00 
+  8009b3:	ff d0                	call   *%rax
+  8009b5:	89 c3                	mov    %eax,%ebx
+  8009b7:	85 c0                	test   %eax,%eax
+  8009b9:	78 14                	js     8009cf <dup+0xf7>
+
+    return newfdnum;
+  8009bb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009be:	89 d8                	mov    %ebx,%eax
+  8009c0:	48 83 c4 18          	add    $0x18,%rsp
+  8009c4:	5b                   	pop    %rbx
+  8009c5:	41 5c                	pop    %r12
+  8009c7:	41 5d                	pop    %r13
+  8009c9:	41 5e                	pop    %r14
+  8009cb:	41 5f                	pop    %r15
+  8009cd:	5d                   	pop    %rbp
+  8009ce:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009cf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d4:	4c 89 ee             	mov    %r13,%rsi
+  8009d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009dc:	49 bc fd 02 80 00 00 	movabs $0x8002fd,%r12
+  8009e3:	00 00 00 
+  8009e6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009e9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009ee:	4c 89 f6             	mov    %r14,%rsi
+  8009f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f6:	41 ff d4             	call   *%r12
+    return res;
+  8009f9:	eb c3                	jmp    8009be <dup+0xe6>
+
+00000000008009fb <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009fb:	55                   	push   %rbp
+  8009fc:	48 89 e5             	mov    %rsp,%rbp
+  8009ff:	41 56                	push   %r14
+  800a01:	41 55                	push   %r13
+  800a03:	41 54                	push   %r12
+  800a05:	53                   	push   %rbx
+  800a06:	48 83 ec 10          	sub    $0x10,%rsp
+  800a0a:	89 fb                	mov    %edi,%ebx
+  800a0c:	49 89 f4             	mov    %rsi,%r12
+  800a0f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a12:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a16:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800a1d:	00 00 00 
+  800a20:	ff d0                	call   *%rax
+  800a22:	85 c0                	test   %eax,%eax
+  800a24:	78 4c                	js     800a72 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a26:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a2a:	41 8b 3e             	mov    (%r14),%edi
+  800a2d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a31:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800a38:	00 00 00 
+  800a3b:	ff d0                	call   *%rax
+  800a3d:	85 c0                	test   %eax,%eax
+  800a3f:	78 35                	js     800a76 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a41:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a45:	83 e0 03             	and    $0x3,%eax
+  800a48:	83 f8 01             	cmp    $0x1,%eax
+  800a4b:	74 2d                	je     800a7a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a4d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a51:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a55:	48 85 c0             	test   %rax,%rax
+  800a58:	74 56                	je     800ab0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a5a:	4c 89 ea             	mov    %r13,%rdx
+  800a5d:	4c 89 e6             	mov    %r12,%rsi
+  800a60:	4c 89 f7             	mov    %r14,%rdi
+  800a63:	ff d0                	call   *%rax
+}
+  800a65:	48 83 c4 10          	add    $0x10,%rsp
+  800a69:	5b                   	pop    %rbx
+  800a6a:	41 5c                	pop    %r12
+  800a6c:	41 5d                	pop    %r13
+  800a6e:	41 5e                	pop    %r14
+  800a70:	5d                   	pop    %rbp
+  800a71:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a72:	48 98                	cltq
+  800a74:	eb ef                	jmp    800a65 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a76:	48 98                	cltq
+  800a78:	eb eb                	jmp    800a65 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a7a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a81:	00 00 00 
+  800a84:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a8a:	89 da                	mov    %ebx,%edx
+  800a8c:	48 bf 31 47 80 00 00 	movabs $0x804731,%rdi
+  800a93:	00 00 00 
+  800a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a9b:	48 b9 c5 34 80 00 00 	movabs $0x8034c5,%rcx
+  800aa2:	00 00 00 
+  800aa5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800aa7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800aae:	eb b5                	jmp    800a65 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ab0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800ab7:	eb ac                	jmp    800a65 <read+0x6a>
+
+0000000000800ab9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ab9:	55                   	push   %rbp
+  800aba:	48 89 e5             	mov    %rsp,%rbp
+  800abd:	41 57                	push   %r15
+  800abf:	41 56                	push   %r14
+  800ac1:	41 55                	push   %r13
+  800ac3:	41 54                	push   %r12
+  800ac5:	53                   	push   %rbx
+  800ac6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800aca:	48 85 d2             	test   %rdx,%rdx
+  800acd:	74 54                	je     800b23 <readn+0x6a>
+  800acf:	41 89 fd             	mov    %edi,%r13d
+  800ad2:	49 89 f6             	mov    %rsi,%r14
+  800ad5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ad8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800add:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ae2:	49 bf fb 09 80 00 00 	movabs $0x8009fb,%r15
+  800ae9:	00 00 00 
+  800aec:	4c 89 e2             	mov    %r12,%rdx
+  800aef:	48 29 f2             	sub    %rsi,%rdx
+  800af2:	4c 01 f6             	add    %r14,%rsi
+  800af5:	44 89 ef             	mov    %r13d,%edi
+  800af8:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800afb:	85 c0                	test   %eax,%eax
+  800afd:	78 20                	js     800b1f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800aff:	01 c3                	add    %eax,%ebx
+  800b01:	85 c0                	test   %eax,%eax
+  800b03:	74 08                	je     800b0d <readn+0x54>
+  800b05:	48 63 f3             	movslq %ebx,%rsi
+  800b08:	4c 39 e6             	cmp    %r12,%rsi
+  800b0b:	72 df                	jb     800aec <readn+0x33>
+    }
+    return res;
+  800b0d:	48 63 c3             	movslq %ebx,%rax
+}
+  800b10:	48 83 c4 08          	add    $0x8,%rsp
+  800b14:	5b                   	pop    %rbx
+  800b15:	41 5c                	pop    %r12
+  800b17:	41 5d                	pop    %r13
+  800b19:	41 5e                	pop    %r14
+  800b1b:	41 5f                	pop    %r15
+  800b1d:	5d                   	pop    %rbp
+  800b1e:	c3                   	ret
+        if (inc < 0) return inc;
+  800b1f:	48 98                	cltq
+  800b21:	eb ed                	jmp    800b10 <readn+0x57>
+    int inc = 1, res = 0;
+  800b23:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b28:	eb e3                	jmp    800b0d <readn+0x54>
+
+0000000000800b2a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b2a:	55                   	push   %rbp
+  800b2b:	48 89 e5             	mov    %rsp,%rbp
+  800b2e:	41 56                	push   %r14
+  800b30:	41 55                	push   %r13
+  800b32:	41 54                	push   %r12
+  800b34:	53                   	push   %rbx
+  800b35:	48 83 ec 10          	sub    $0x10,%rsp
+  800b39:	89 fb                	mov    %edi,%ebx
+  800b3b:	49 89 f4             	mov    %rsi,%r12
+  800b3e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b41:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b45:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800b4c:	00 00 00 
+  800b4f:	ff d0                	call   *%rax
+  800b51:	85 c0                	test   %eax,%eax
+  800b53:	78 47                	js     800b9c <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b55:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b59:	41 8b 3e             	mov    (%r14),%edi
+  800b5c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b60:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800b67:	00 00 00 
+  800b6a:	ff d0                	call   *%rax
+  800b6c:	85 c0                	test   %eax,%eax
+  800b6e:	78 30                	js     800ba0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b70:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b75:	74 2d                	je     800ba4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b77:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b7b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b7f:	48 85 c0             	test   %rax,%rax
+  800b82:	74 56                	je     800bda <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b84:	4c 89 ea             	mov    %r13,%rdx
+  800b87:	4c 89 e6             	mov    %r12,%rsi
+  800b8a:	4c 89 f7             	mov    %r14,%rdi
+  800b8d:	ff d0                	call   *%rax
+}
+  800b8f:	48 83 c4 10          	add    $0x10,%rsp
+  800b93:	5b                   	pop    %rbx
+  800b94:	41 5c                	pop    %r12
+  800b96:	41 5d                	pop    %r13
+  800b98:	41 5e                	pop    %r14
+  800b9a:	5d                   	pop    %rbp
+  800b9b:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b9c:	48 98                	cltq
+  800b9e:	eb ef                	jmp    800b8f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ba0:	48 98                	cltq
+  800ba2:	eb eb                	jmp    800b8f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ba4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800bab:	00 00 00 
+  800bae:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800bb4:	89 da                	mov    %ebx,%edx
+  800bb6:	48 bf 4d 47 80 00 00 	movabs $0x80474d,%rdi
+  800bbd:	00 00 00 
+  800bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc5:	48 b9 c5 34 80 00 00 	movabs $0x8034c5,%rcx
+  800bcc:	00 00 00 
+  800bcf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bd1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bd8:	eb b5                	jmp    800b8f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bda:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800be1:	eb ac                	jmp    800b8f <write+0x65>
+
+0000000000800be3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800be3:	55                   	push   %rbp
+  800be4:	48 89 e5             	mov    %rsp,%rbp
+  800be7:	41 54                	push   %r12
+  800be9:	53                   	push   %rbx
+  800bea:	48 83 ec 10          	sub    $0x10,%rsp
+  800bee:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bf0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bf4:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800bfb:	00 00 00 
+  800bfe:	ff d0                	call   *%rax
+  800c00:	85 c0                	test   %eax,%eax
+  800c02:	78 3e                	js     800c42 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c04:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c08:	41 8b 3c 24          	mov    (%r12),%edi
+  800c0c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c10:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800c17:	00 00 00 
+  800c1a:	ff d0                	call   *%rax
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	78 22                	js     800c42 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c20:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c24:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c28:	48 85 c0             	test   %rax,%rax
+  800c2b:	74 0b                	je     800c38 <seek+0x55>
+  800c2d:	89 de                	mov    %ebx,%esi
+  800c2f:	4c 89 e7             	mov    %r12,%rdi
+  800c32:	ff d0                	call   *%rax
+  800c34:	85 c0                	test   %eax,%eax
+  800c36:	78 0a                	js     800c42 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c38:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c3d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c42:	48 83 c4 10          	add    $0x10,%rsp
+  800c46:	5b                   	pop    %rbx
+  800c47:	41 5c                	pop    %r12
+  800c49:	5d                   	pop    %rbp
+  800c4a:	c3                   	ret
+
+0000000000800c4b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c4b:	55                   	push   %rbp
+  800c4c:	48 89 e5             	mov    %rsp,%rbp
+  800c4f:	41 55                	push   %r13
+  800c51:	41 54                	push   %r12
+  800c53:	53                   	push   %rbx
+  800c54:	48 83 ec 18          	sub    $0x18,%rsp
+  800c58:	89 fb                	mov    %edi,%ebx
+  800c5a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c5d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c61:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800c68:	00 00 00 
+  800c6b:	ff d0                	call   *%rax
+  800c6d:	85 c0                	test   %eax,%eax
+  800c6f:	78 38                	js     800ca9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c71:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c75:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c79:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c7d:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800c84:	00 00 00 
+  800c87:	ff d0                	call   *%rax
+  800c89:	85 c0                	test   %eax,%eax
+  800c8b:	78 1c                	js     800ca9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c8d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c92:	74 20                	je     800cb4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c98:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c9c:	48 85 c0             	test   %rax,%rax
+  800c9f:	74 47                	je     800ce8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ca1:	44 89 e6             	mov    %r12d,%esi
+  800ca4:	4c 89 ef             	mov    %r13,%rdi
+  800ca7:	ff d0                	call   *%rax
+}
+  800ca9:	48 83 c4 18          	add    $0x18,%rsp
+  800cad:	5b                   	pop    %rbx
+  800cae:	41 5c                	pop    %r12
+  800cb0:	41 5d                	pop    %r13
+  800cb2:	5d                   	pop    %rbp
+  800cb3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cb4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800cbb:	00 00 00 
+  800cbe:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cc4:	89 da                	mov    %ebx,%edx
+  800cc6:	48 bf 10 47 80 00 00 	movabs $0x804710,%rdi
+  800ccd:	00 00 00 
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd5:	48 b9 c5 34 80 00 00 	movabs $0x8034c5,%rcx
+  800cdc:	00 00 00 
+  800cdf:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ce1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce6:	eb c1                	jmp    800ca9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ce8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ced:	eb ba                	jmp    800ca9 <ftruncate+0x5e>
+
+0000000000800cef <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cef:	55                   	push   %rbp
+  800cf0:	48 89 e5             	mov    %rsp,%rbp
+  800cf3:	41 54                	push   %r12
+  800cf5:	53                   	push   %rbx
+  800cf6:	48 83 ec 10          	sub    $0x10,%rsp
+  800cfa:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cfd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d01:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  800d08:	00 00 00 
+  800d0b:	ff d0                	call   *%rax
+  800d0d:	85 c0                	test   %eax,%eax
+  800d0f:	78 4e                	js     800d5f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d11:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d15:	41 8b 3c 24          	mov    (%r12),%edi
+  800d19:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d1d:	48 b8 63 07 80 00 00 	movabs $0x800763,%rax
+  800d24:	00 00 00 
+  800d27:	ff d0                	call   *%rax
+  800d29:	85 c0                	test   %eax,%eax
+  800d2b:	78 32                	js     800d5f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d2d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d31:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d36:	74 30                	je     800d68 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d38:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d3b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d42:	00 00 00 
+    stat->st_isdir = 0;
+  800d45:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d4c:	00 00 00 
+    stat->st_dev = dev;
+  800d4f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d56:	48 89 de             	mov    %rbx,%rsi
+  800d59:	4c 89 e7             	mov    %r12,%rdi
+  800d5c:	ff 50 28             	call   *0x28(%rax)
+}
+  800d5f:	48 83 c4 10          	add    $0x10,%rsp
+  800d63:	5b                   	pop    %rbx
+  800d64:	41 5c                	pop    %r12
+  800d66:	5d                   	pop    %rbp
+  800d67:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d68:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d6d:	eb f0                	jmp    800d5f <fstat+0x70>
+
+0000000000800d6f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d6f:	55                   	push   %rbp
+  800d70:	48 89 e5             	mov    %rsp,%rbp
+  800d73:	41 54                	push   %r12
+  800d75:	53                   	push   %rbx
+  800d76:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d79:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7e:	48 b8 dd 1e 80 00 00 	movabs $0x801edd,%rax
+  800d85:	00 00 00 
+  800d88:	ff d0                	call   *%rax
+  800d8a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d8c:	85 c0                	test   %eax,%eax
+  800d8e:	78 25                	js     800db5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d90:	4c 89 e6             	mov    %r12,%rsi
+  800d93:	89 c7                	mov    %eax,%edi
+  800d95:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d9c:	00 00 00 
+  800d9f:	ff d0                	call   *%rax
+  800da1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800da4:	89 df                	mov    %ebx,%edi
+  800da6:	48 b8 7d 08 80 00 00 	movabs $0x80087d,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+
+    return res;
+  800db2:	44 89 e3             	mov    %r12d,%ebx
+}
+  800db5:	89 d8                	mov    %ebx,%eax
+  800db7:	5b                   	pop    %rbx
+  800db8:	41 5c                	pop    %r12
+  800dba:	5d                   	pop    %rbp
+  800dbb:	c3                   	ret
+
+0000000000800dbc <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dbc:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800dc3:	00 00 00 
+  800dc6:	83 38 00             	cmpl   $0x0,(%rax)
+  800dc9:	74 0a                	je     800dd5 <fsenv+0x19>
+    return envid;
+}
+  800dcb:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dd2:	00 00 
+  800dd4:	c3                   	ret
+fsenv(void) {
+  800dd5:	55                   	push   %rbp
+  800dd6:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dd9:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dde:	48 b8 46 46 80 00 00 	movabs $0x804646,%rax
+  800de5:	00 00 00 
+  800de8:	ff d0                	call   *%rax
+  800dea:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800df1:	00 00 
+}
+  800df3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dfa:	00 00 
+  800dfc:	5d                   	pop    %rbp
+  800dfd:	c3                   	ret
+
+0000000000800dfe <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800dfe:	55                   	push   %rbp
+  800dff:	48 89 e5             	mov    %rsp,%rbp
+  800e02:	41 54                	push   %r12
+  800e04:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800e05:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e0a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e0f:	48 89 de             	mov    %rbx,%rsi
+  800e12:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e17:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800e1e:	00 00 00 
+  800e21:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e23:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e2a:	00 00 00 
+  800e2d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e33:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e38:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e3d:	48 89 de             	mov    %rbx,%rsi
+  800e40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e45:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  800e4c:	00 00 00 
+  800e4f:	ff d0                	call   *%rax
+  800e51:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e53:	85 c0                	test   %eax,%eax
+  800e55:	0f 88 a2 00 00 00    	js     800efd <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e5b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e62:	00 00 00 
+  800e65:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e6b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e70:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e72:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e77:	49 bc 0f 30 80 00 00 	movabs $0x80300f,%r12
+  800e7e:	00 00 00 
+  800e81:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e84:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e89:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e8c:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+  800e98:	89 c7                	mov    %eax,%edi
+  800e9a:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800ea0:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800ea5:	48 89 da             	mov    %rbx,%rdx
+  800ea8:	be 09 00 00 00       	mov    $0x9,%esi
+  800ead:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  800eb4:	00 00 00 
+  800eb7:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800eb9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ebe:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec3:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec8:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ecd:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+  800ed9:	89 c3                	mov    %eax,%ebx
+  800edb:	85 c0                	test   %eax,%eax
+  800edd:	78 25                	js     800f04 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800edf:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ee6:	00 00 00 
+  800ee9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800eef:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ef6:	00 00 
+    return 0;
+  800ef8:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800efd:	89 d8                	mov    %ebx,%eax
+  800eff:	5b                   	pop    %rbx
+  800f00:	41 5c                	pop    %r12
+  800f02:	5d                   	pop    %rbp
+  800f03:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800f04:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f09:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f13:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  800f1a:	00 00 00 
+  800f1d:	ff d0                	call   *%rax
+        return res;
+  800f1f:	eb dc                	jmp    800efd <fschan_setup+0xff>
+
+0000000000800f21 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f21:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f28:	00 00 00 
+  800f2b:	80 38 00             	cmpb   $0x0,(%rax)
+  800f2e:	74 55                	je     800f85 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f30:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f37:	00 00 00 
+  800f3a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f40:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f45:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f4c:	00 00 00 
+  800f4f:	3b 0a                	cmp    (%rdx),%ecx
+  800f51:	75 01                	jne    800f54 <fschan+0x33>
+}
+  800f53:	c3                   	ret
+fschan(void) {
+  800f54:	55                   	push   %rbp
+  800f55:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f58:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  800f5f:	00 00 00 
+  800f62:	ff d0                	call   *%rax
+  800f64:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f66:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f6b:	85 d2                	test   %edx,%edx
+  800f6d:	78 02                	js     800f71 <fschan+0x50>
+}
+  800f6f:	5d                   	pop    %rbp
+  800f70:	c3                   	ret
+        fschan_enabled = 0;
+  800f71:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f78:	00 00 00 
+  800f7b:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f83:	eb ea                	jmp    800f6f <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	c3                   	ret
+
+0000000000800f8b <fbuf>:
+fbuf(struct Fd *fd) {
+  800f8b:	55                   	push   %rbp
+  800f8c:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f8f:	48 b8 8a 06 80 00 00 	movabs $0x80068a,%rax
+  800f96:	00 00 00 
+  800f99:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800fa4:	77 12                	ja     800fb8 <fbuf+0x2d>
+  800fa6:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800faa:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800fb1:	00 00 00 
+  800fb4:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fb8:	48 89 d0             	mov    %rdx,%rax
+  800fbb:	5d                   	pop    %rbp
+  800fbc:	c3                   	ret
+
+0000000000800fbd <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fbd:	55                   	push   %rbp
+  800fbe:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fc1:	48 83 c7 40          	add    $0x40,%rdi
+  800fc5:	48 b8 49 30 80 00 00 	movabs $0x803049,%rax
+  800fcc:	00 00 00 
+  800fcf:	ff d0                	call   *%rax
+  800fd1:	84 c0                	test   %al,%al
+  800fd3:	75 02                	jne    800fd7 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fd5:	5d                   	pop    %rbp
+  800fd6:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fd7:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  800fde:	00 00 00 
+  800fe1:	ff d0                	call   *%rax
+  800fe3:	89 c7                	mov    %eax,%edi
+  800fe5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800feb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff5:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ffa:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  801001:	00 00 00 
+  801004:	ff d0                	call   *%rax
+}
+  801006:	eb cd                	jmp    800fd5 <fschan_publish+0x18>
+
+0000000000801008 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801008:	55                   	push   %rbp
+  801009:	48 89 e5             	mov    %rsp,%rbp
+  80100c:	41 57                	push   %r15
+  80100e:	41 56                	push   %r14
+  801010:	41 55                	push   %r13
+  801012:	41 54                	push   %r12
+  801014:	53                   	push   %rbx
+  801015:	48 83 ec 48          	sub    $0x48,%rsp
+  801019:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80101d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801021:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801024:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801028:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80102b:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801032:	00 00 00 
+  801035:	8b 02                	mov    (%rdx),%eax
+  801037:	83 c0 01             	add    $0x1,%eax
+  80103a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80103f:	0f 44 c1             	cmove  %ecx,%eax
+  801042:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801044:	4d 85 c0             	test   %r8,%r8
+  801047:	74 2c                	je     801075 <fschan_rw+0x6d>
+  801049:	45 89 ce             	mov    %r9d,%r14d
+  80104c:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801053:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801057:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80105d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801064:	00 
+  801065:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80106b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801070:	e9 41 01 00 00       	jmp    8011b6 <fschan_rw+0x1ae>
+  801075:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801079:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80107d:	e9 9c 01 00 00       	jmp    80121e <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801082:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801086:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801089:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80108c:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80108f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801093:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801097:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80109b:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80109f:	48 89 da             	mov    %rbx,%rdx
+  8010a2:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8010ae:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8010b2:	48 b8 bd 0f 80 00 00 	movabs $0x800fbd,%rax
+  8010b9:	00 00 00 
+  8010bc:	ff d0                	call   *%rax
+            queued += blk;
+  8010be:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010c1:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010c5:	4d 39 fc             	cmp    %r15,%r12
+  8010c8:	73 6b                	jae    801135 <fschan_rw+0x12d>
+  8010ca:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010ce:	77 65                	ja     801135 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010d4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010d8:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  8010df:	00 00 00 
+  8010e2:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010e4:	4c 89 fb             	mov    %r15,%rbx
+  8010e7:	4c 29 e3             	sub    %r12,%rbx
+  8010ea:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010ef:	48 39 d3             	cmp    %rdx,%rbx
+  8010f2:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010f6:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010fa:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010fe:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801102:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801105:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801107:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80110e:	00 00 00 
+  801111:	8b 09                	mov    (%rcx),%ecx
+  801113:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801116:	83 fe 03             	cmp    $0x3,%esi
+  801119:	0f 85 63 ff ff ff    	jne    801082 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80111f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801123:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801126:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801129:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80112c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801130:	e9 79 ff ff ff       	jmp    8010ae <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801135:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801139:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801140:	48 89 df             	mov    %rbx,%rdi
+  801143:	48 b8 e7 30 80 00 00 	movabs $0x8030e7,%rax
+  80114a:	00 00 00 
+  80114d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80114f:	48 89 df             	mov    %rbx,%rdi
+  801152:	48 b8 75 30 80 00 00 	movabs $0x803075,%rax
+  801159:	00 00 00 
+  80115c:	ff d0                	call   *%rax
+  80115e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801162:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801166:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80116a:	75 25                	jne    801191 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80116c:	8b 40 04             	mov    0x4(%rax),%eax
+  80116f:	85 c0                	test   %eax,%eax
+  801171:	0f 88 86 00 00 00    	js     8011fd <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801177:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80117b:	74 5b                	je     8011d8 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80117d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801181:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801185:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801189:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80118d:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801191:	48 89 df             	mov    %rbx,%rdi
+  801194:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  80119b:	00 00 00 
+  80119e:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8011a0:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8011a4:	83 f0 01             	xor    $0x1,%eax
+  8011a7:	4d 39 fc             	cmp    %r15,%r12
+  8011aa:	0f 92 c2             	setb   %dl
+  8011ad:	84 c2                	test   %al,%dl
+  8011af:	75 05                	jne    8011b6 <fschan_rw+0x1ae>
+  8011b1:	45 85 ed             	test   %r13d,%r13d
+  8011b4:	74 50                	je     801206 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011b6:	4d 39 fc             	cmp    %r15,%r12
+  8011b9:	0f 92 c1             	setb   %cl
+  8011bc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011c0:	0f 96 c2             	setbe  %dl
+  8011c3:	84 d1                	test   %dl,%cl
+  8011c5:	0f 84 6a ff ff ff    	je     801135 <fschan_rw+0x12d>
+  8011cb:	84 c0                	test   %al,%al
+  8011cd:	0f 85 fd fe ff ff    	jne    8010d0 <fschan_rw+0xc8>
+  8011d3:	e9 5d ff ff ff       	jmp    801135 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011d8:	48 63 d0             	movslq %eax,%rdx
+  8011db:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011df:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011e3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011e7:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011eb:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011ef:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  8011f6:	00 00 00 
+  8011f9:	ff d0                	call   *%rax
+  8011fb:	eb 80                	jmp    80117d <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011fd:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801200:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  801204:	eb 8b                	jmp    801191 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  801206:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80120b:	0f 85 68 fe ff ff    	jne    801079 <fschan_rw+0x71>
+  801211:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  801214:	85 c0                	test   %eax,%eax
+  801216:	0f 84 5d fe ff ff    	je     801079 <fschan_rw+0x71>
+  80121c:	48 98                	cltq
+}
+  80121e:	48 83 c4 48          	add    $0x48,%rsp
+  801222:	5b                   	pop    %rbx
+  801223:	41 5c                	pop    %r12
+  801225:	41 5d                	pop    %r13
+  801227:	41 5e                	pop    %r14
+  801229:	41 5f                	pop    %r15
+  80122b:	5d                   	pop    %rbp
+  80122c:	c3                   	ret
+
+000000000080122d <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80122d:	55                   	push   %rbp
+  80122e:	48 89 e5             	mov    %rsp,%rbp
+  801231:	41 56                	push   %r14
+  801233:	41 55                	push   %r13
+  801235:	41 54                	push   %r12
+  801237:	53                   	push   %rbx
+  801238:	48 83 ec 10          	sub    $0x10,%rsp
+  80123c:	49 89 fe             	mov    %rdi,%r14
+  80123f:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801242:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801246:	48 29 f3             	sub    %rsi,%rbx
+  801249:	48 39 d3             	cmp    %rdx,%rbx
+  80124c:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801250:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801257:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801258:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80125d:	49 bd a6 2e 80 00 00 	movabs $0x802ea6,%r13
+  801264:	00 00 00 
+  801267:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80126e:	76 1e                	jbe    80128e <mmap_fault+0x61>
+  801270:	4c 01 e7             	add    %r12,%rdi
+  801273:	41 ff d5             	call   *%r13
+  801276:	84 c0                	test   %al,%al
+  801278:	75 14                	jne    80128e <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80127a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80127e:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801285:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801289:	48 39 df             	cmp    %rbx,%rdi
+  80128c:	72 e2                	jb     801270 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80128e:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801295:	00 00 00 
+  801298:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80129f:	00 00 00 
+  8012a2:	4c 89 f0             	mov    %r14,%rax
+  8012a5:	48 29 d0             	sub    %rdx,%rax
+  8012a8:	48 c1 f8 03          	sar    $0x3,%rax
+  8012ac:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012b3:	aa aa aa 
+  8012b6:	48 0f af c2          	imul   %rdx,%rax
+  8012ba:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012be:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012c3:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012c7:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012c9:	44 89 e0             	mov    %r12d,%eax
+  8012cc:	41 03 46 10          	add    0x10(%r14),%eax
+  8012d0:	41 2b 06             	sub    (%r14),%eax
+  8012d3:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012d6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012da:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012de:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012e2:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012e5:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+  8012f1:	89 c7                	mov    %eax,%edi
+  8012f3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012f9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012fe:	48 89 da             	mov    %rbx,%rdx
+  801301:	be 0f 00 00 00       	mov    $0xf,%esi
+  801306:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  80130d:	00 00 00 
+  801310:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  801312:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801317:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80131b:	4c 89 e6             	mov    %r12,%rsi
+  80131e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801323:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  80132a:	00 00 00 
+  80132d:	ff d0                	call   *%rax
+  80132f:	48 98                	cltq
+}
+  801331:	48 83 c4 10          	add    $0x10,%rsp
+  801335:	5b                   	pop    %rbx
+  801336:	41 5c                	pop    %r12
+  801338:	41 5d                	pop    %r13
+  80133a:	41 5e                	pop    %r14
+  80133c:	5d                   	pop    %rbp
+  80133d:	c3                   	ret
+
+000000000080133e <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80133e:	48 8b 37             	mov    (%rdi),%rsi
+  801341:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801348:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80134f:	00 00 00 
+  801352:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801357:	eb 0f                	jmp    801368 <mmap_pgfault+0x2a>
+  801359:	c3                   	ret
+  80135a:	48 83 c1 01          	add    $0x1,%rcx
+  80135e:	48 83 c2 18          	add    $0x18,%rdx
+  801362:	48 83 f9 20          	cmp    $0x20,%rcx
+  801366:	74 6e                	je     8013d6 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801368:	48 8b 02             	mov    (%rdx),%rax
+  80136b:	48 83 e8 01          	sub    $0x1,%rax
+  80136f:	48 39 f0             	cmp    %rsi,%rax
+  801372:	73 e6                	jae    80135a <mmap_pgfault+0x1c>
+  801374:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801378:	73 e0                	jae    80135a <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80137a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801383:	f6 c2 01             	test   $0x1,%dl
+  801386:	75 d1                	jne    801359 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801388:	f6 c2 02             	test   $0x2,%dl
+  80138b:	74 1a                	je     8013a7 <mmap_pgfault+0x69>
+  80138d:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801391:	b8 00 00 00 00       	mov    $0x0,%eax
+  801396:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80139d:	00 00 00 
+  8013a0:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8013a5:	74 35                	je     8013dc <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8013a7:	55                   	push   %rbp
+  8013a8:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013ab:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013af:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013b6:	00 00 00 
+  8013b9:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013bd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013c2:	48 b8 2d 12 80 00 00 	movabs $0x80122d,%rax
+  8013c9:	00 00 00 
+  8013cc:	ff d0                	call   *%rax
+  8013ce:	48 85 c0             	test   %rax,%rax
+  8013d1:	0f 9f c0             	setg   %al
+}
+  8013d4:	5d                   	pop    %rbp
+  8013d5:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013db:	c3                   	ret
+}
+  8013dc:	c3                   	ret
+
+00000000008013dd <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013dd:	55                   	push   %rbp
+  8013de:	48 89 e5             	mov    %rsp,%rbp
+  8013e1:	41 54                	push   %r12
+  8013e3:	53                   	push   %rbx
+  8013e4:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013e7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013ee:	00 00 00 
+  8013f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013f6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013fa:	74 15                	je     801411 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013fc:	48 83 c3 01          	add    $0x1,%rbx
+  801400:	48 83 c0 18          	add    $0x18,%rax
+  801404:	48 83 fb 20          	cmp    $0x20,%rbx
+  801408:	75 ec                	jne    8013f6 <mmap_alloc+0x19>
+    return NULL;
+  80140a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140f:	eb 52                	jmp    801463 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801411:	4c 89 e7             	mov    %r12,%rdi
+  801414:	48 b8 47 2e 80 00 00 	movabs $0x802e47,%rax
+  80141b:	00 00 00 
+  80141e:	ff d0                	call   *%rax
+  801420:	41 89 c1             	mov    %eax,%r9d
+  801423:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80142a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80142e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801434:	ba 00 00 00 00       	mov    $0x0,%edx
+  801439:	4c 89 e6             	mov    %r12,%rsi
+  80143c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801441:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  801448:	00 00 00 
+  80144b:	ff d0                	call   *%rax
+  80144d:	85 c0                	test   %eax,%eax
+  80144f:	78 17                	js     801468 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801451:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801455:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80145c:	00 00 00 
+  80145f:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801463:	5b                   	pop    %rbx
+  801464:	41 5c                	pop    %r12
+  801466:	5d                   	pop    %rbp
+  801467:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146d:	eb f4                	jmp    801463 <mmap_alloc+0x86>
+
+000000000080146f <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80146f:	55                   	push   %rbp
+  801470:	48 89 e5             	mov    %rsp,%rbp
+  801473:	41 56                	push   %r14
+  801475:	41 55                	push   %r13
+  801477:	41 54                	push   %r12
+  801479:	53                   	push   %rbx
+  80147a:	48 83 ec 10          	sub    $0x10,%rsp
+  80147e:	41 89 fc             	mov    %edi,%r12d
+  801481:	49 89 f5             	mov    %rsi,%r13
+  801484:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801487:	48 89 f0             	mov    %rsi,%rax
+  80148a:	48 09 d0             	or     %rdx,%rax
+  80148d:	75 0d                	jne    80149c <fsipc+0x2d>
+  80148f:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801492:	83 f8 04             	cmp    $0x4,%eax
+  801495:	76 7d                	jbe    801514 <fsipc+0xa5>
+  801497:	83 ff 0d             	cmp    $0xd,%edi
+  80149a:	74 78                	je     801514 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80149c:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  8014a3:	00 00 00 
+  8014a6:	ff d0                	call   *%rax
+  8014a8:	89 c7                	mov    %eax,%edi
+  8014aa:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8014b1:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014b8:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014bf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014c5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014cc:	00 00 00 
+  8014cf:	44 89 e6             	mov    %r12d,%esi
+  8014d2:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  8014d9:	00 00 00 
+  8014dc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014de:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014e5:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014eb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014ef:	4c 89 ee             	mov    %r13,%rsi
+  8014f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f7:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  8014fe:	00 00 00 
+  801501:	ff d0                	call   *%rax
+  801503:	89 c3                	mov    %eax,%ebx
+}
+  801505:	89 d8                	mov    %ebx,%eax
+  801507:	48 83 c4 10          	add    $0x10,%rsp
+  80150b:	5b                   	pop    %rbx
+  80150c:	41 5c                	pop    %r12
+  80150e:	41 5d                	pop    %r13
+  801510:	41 5e                	pop    %r14
+  801512:	5d                   	pop    %rbp
+  801513:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801514:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  80151b:	00 00 00 
+  80151e:	ff d0                	call   *%rax
+  801520:	49 89 c6             	mov    %rax,%r14
+  801523:	48 85 c0             	test   %rax,%rax
+  801526:	0f 84 70 ff ff ff    	je     80149c <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80152c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801530:	48 b8 24 30 80 00 00 	movabs $0x803024,%rax
+  801537:	00 00 00 
+  80153a:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80153c:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80153f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801546:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80154a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80154f:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801556:	00 00 00 
+  801559:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  801560:	00 00 00 
+  801563:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801565:	4c 89 f7             	mov    %r14,%rdi
+  801568:	48 b8 bd 0f 80 00 00 	movabs $0x800fbd,%rax
+  80156f:	00 00 00 
+  801572:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801574:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80157b:	4c 89 f7             	mov    %r14,%rdi
+  80157e:	48 b8 e7 30 80 00 00 	movabs $0x8030e7,%rax
+  801585:	00 00 00 
+  801588:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80158a:	4c 89 f7             	mov    %r14,%rdi
+  80158d:	48 b8 75 30 80 00 00 	movabs $0x803075,%rax
+  801594:	00 00 00 
+  801597:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801599:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80159c:	41 83 fc 05          	cmp    $0x5,%r12d
+  8015a0:	75 04                	jne    8015a6 <fsipc+0x137>
+  8015a2:	85 db                	test   %ebx,%ebx
+  8015a4:	79 14                	jns    8015ba <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8015a6:	4c 89 f7             	mov    %r14,%rdi
+  8015a9:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  8015b0:	00 00 00 
+  8015b3:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015b5:	e9 4b ff ff ff       	jmp    801505 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015ba:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015be:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015c3:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015ca:	00 00 00 
+  8015cd:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  8015d4:	00 00 00 
+  8015d7:	ff d0                	call   *%rax
+  8015d9:	eb cb                	jmp    8015a6 <fsipc+0x137>
+
+00000000008015db <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015db:	55                   	push   %rbp
+  8015dc:	48 89 e5             	mov    %rsp,%rbp
+  8015df:	41 57                	push   %r15
+  8015e1:	41 56                	push   %r14
+  8015e3:	41 55                	push   %r13
+  8015e5:	41 54                	push   %r12
+  8015e7:	53                   	push   %rbx
+  8015e8:	48 83 ec 18          	sub    $0x18,%rsp
+  8015ec:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015f0:	49 89 f6             	mov    %rsi,%r14
+  8015f3:	49 89 d4             	mov    %rdx,%r12
+  8015f6:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015f9:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  801600:	00 00 00 
+  801603:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801605:	48 85 c0             	test   %rax,%rax
+  801608:	0f 85 96 00 00 00    	jne    8016a4 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80160e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801615:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801616:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80161d:	00 00 00 
+    while (n) {
+  801620:	4d 85 e4             	test   %r12,%r12
+  801623:	74 79                	je     80169e <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801625:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80162a:	49 39 dc             	cmp    %rbx,%r12
+  80162d:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801631:	48 89 da             	mov    %rbx,%rdx
+  801634:	4c 89 f6             	mov    %r14,%rsi
+  801637:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80163e:	00 00 00 
+  801641:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  801648:	00 00 00 
+  80164b:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80164d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801651:	8b 40 0c             	mov    0xc(%rax),%eax
+  801654:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801657:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80165a:	44 01 e8             	add    %r13d,%eax
+  80165d:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801661:	41 0f 44 c5          	cmove  %r13d,%eax
+  801665:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801669:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80166d:	48 89 da             	mov    %rbx,%rdx
+  801670:	be 00 00 00 00       	mov    $0x0,%esi
+  801675:	bf 04 00 00 00       	mov    $0x4,%edi
+  80167a:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  801681:	00 00 00 
+  801684:	ff d0                	call   *%rax
+        if (res < 0)
+  801686:	85 c0                	test   %eax,%eax
+  801688:	78 4a                	js     8016d4 <devfile_write_direct+0xf9>
+        buf += res;
+  80168a:	48 98                	cltq
+  80168c:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80168f:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801693:	49 29 c4             	sub    %rax,%r12
+  801696:	75 8d                	jne    801625 <devfile_write_direct+0x4a>
+    return write;
+  801698:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80169c:	eb 27                	jmp    8016c5 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80169e:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8016a2:	eb f4                	jmp    801698 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8016a4:	45 89 e9             	mov    %r13d,%r9d
+  8016a7:	4d 89 e0             	mov    %r12,%r8
+  8016aa:	4c 89 f1             	mov    %r14,%rcx
+  8016ad:	ba 04 00 00 00       	mov    $0x4,%edx
+  8016b2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016b6:	48 89 c7             	mov    %rax,%rdi
+  8016b9:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  8016c0:	00 00 00 
+  8016c3:	ff d0                	call   *%rax
+}
+  8016c5:	48 83 c4 18          	add    $0x18,%rsp
+  8016c9:	5b                   	pop    %rbx
+  8016ca:	41 5c                	pop    %r12
+  8016cc:	41 5d                	pop    %r13
+  8016ce:	41 5e                	pop    %r14
+  8016d0:	41 5f                	pop    %r15
+  8016d2:	5d                   	pop    %rbp
+  8016d3:	c3                   	ret
+            return res;
+  8016d4:	48 98                	cltq
+  8016d6:	eb ed                	jmp    8016c5 <devfile_write_direct+0xea>
+
+00000000008016d8 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016d8:	55                   	push   %rbp
+  8016d9:	48 89 e5             	mov    %rsp,%rbp
+  8016dc:	41 54                	push   %r12
+  8016de:	53                   	push   %rbx
+  8016df:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016e2:	48 b8 8b 0f 80 00 00 	movabs $0x800f8b,%rax
+  8016e9:	00 00 00 
+  8016ec:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016ee:	48 85 c0             	test   %rax,%rax
+  8016f1:	74 71                	je     801764 <fbuf_flush+0x8c>
+  8016f3:	48 89 c3             	mov    %rax,%rbx
+  8016f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016fb:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016ff:	75 05                	jne    801706 <fbuf_flush+0x2e>
+}
+  801701:	5b                   	pop    %rbx
+  801702:	41 5c                	pop    %r12
+  801704:	5d                   	pop    %rbp
+  801705:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  801706:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801709:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80170d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801714:	00 00 00 
+  801717:	48 89 de             	mov    %rbx,%rsi
+  80171a:	48 29 c6             	sub    %rax,%rsi
+  80171d:	48 c1 fe 03          	sar    $0x3,%rsi
+  801721:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801728:	aa aa aa 
+  80172b:	48 0f af f0          	imul   %rax,%rsi
+  80172f:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801733:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801738:	48 01 c6             	add    %rax,%rsi
+  80173b:	4c 89 e7             	mov    %r12,%rdi
+  80173e:	48 b8 db 15 80 00 00 	movabs $0x8015db,%rax
+  801745:	00 00 00 
+  801748:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80174a:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80174e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801755:	00 
+    return res < 0 ? res : 0;
+  801756:	48 85 c0             	test   %rax,%rax
+  801759:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801762:	eb 9d                	jmp    801701 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801764:	b8 00 00 00 00       	mov    $0x0,%eax
+  801769:	eb 96                	jmp    801701 <fbuf_flush+0x29>
+
+000000000080176b <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80176b:	55                   	push   %rbp
+  80176c:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80176f:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801776:	00 00 00 
+  801779:	ff d0                	call   *%rax
+}
+  80177b:	5d                   	pop    %rbp
+  80177c:	c3                   	ret
+
+000000000080177d <devfile_write>:
+    if (!fd || !buf)
+  80177d:	48 85 ff             	test   %rdi,%rdi
+  801780:	0f 84 d3 01 00 00    	je     801959 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801786:	55                   	push   %rbp
+  801787:	48 89 e5             	mov    %rsp,%rbp
+  80178a:	41 57                	push   %r15
+  80178c:	41 56                	push   %r14
+  80178e:	41 55                	push   %r13
+  801790:	41 54                	push   %r12
+  801792:	53                   	push   %rbx
+  801793:	48 83 ec 08          	sub    $0x8,%rsp
+  801797:	49 89 fc             	mov    %rdi,%r12
+  80179a:	49 89 f6             	mov    %rsi,%r14
+  80179d:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8017a0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8017a5:	48 85 f6             	test   %rsi,%rsi
+  8017a8:	0f 84 9c 01 00 00    	je     80194a <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8017ae:	48 b8 8b 0f 80 00 00 	movabs $0x800f8b,%rax
+  8017b5:	00 00 00 
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017bd:	48 85 c0             	test   %rax,%rax
+  8017c0:	0f 84 a2 00 00 00    	je     801868 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017c6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017cb:	4c 89 e7             	mov    %r12,%rdi
+  8017ce:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  8017d5:	00 00 00 
+  8017d8:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017da:	83 f8 02             	cmp    $0x2,%eax
+  8017dd:	0f 8f 85 00 00 00    	jg     801868 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017e3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017ea:	00 00 00 
+  8017ed:	4d 89 ef             	mov    %r13,%r15
+  8017f0:	49 29 c7             	sub    %rax,%r15
+  8017f3:	49 c1 ff 03          	sar    $0x3,%r15
+  8017f7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017fe:	aa aa aa 
+  801801:	4c 0f af f8          	imul   %rax,%r15
+  801805:	49 c1 e7 0e          	shl    $0xe,%r15
+  801809:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80180e:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801811:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801816:	0f 84 d7 00 00 00    	je     8018f3 <devfile_write+0x176>
+  80181c:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801820:	89 c2                	mov    %eax,%edx
+  801822:	41 03 55 0c          	add    0xc(%r13),%edx
+  801826:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80182b:	75 0f                	jne    80183c <devfile_write+0xbf>
+  80182d:	48 01 d8             	add    %rbx,%rax
+  801830:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801836:	0f 86 92 00 00 00    	jbe    8018ce <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80183c:	4c 89 e7             	mov    %r12,%rdi
+  80183f:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801846:	00 00 00 
+  801849:	ff d0                	call   *%rax
+  80184b:	85 c0                	test   %eax,%eax
+  80184d:	78 52                	js     8018a1 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80184f:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801856:	77 7f                	ja     8018d7 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801858:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80185d:	0f 85 c2 00 00 00    	jne    801925 <devfile_write+0x1a8>
+  801863:	e9 94 00 00 00       	jmp    8018fc <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801868:	4c 89 e7             	mov    %r12,%rdi
+  80186b:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801872:	00 00 00 
+  801875:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801877:	85 c0                	test   %eax,%eax
+  801879:	79 07                	jns    801882 <devfile_write+0x105>
+  80187b:	48 98                	cltq
+  80187d:	e9 c8 00 00 00       	jmp    80194a <devfile_write+0x1cd>
+  801882:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801887:	48 89 da             	mov    %rbx,%rdx
+  80188a:	4c 89 f6             	mov    %r14,%rsi
+  80188d:	4c 89 e7             	mov    %r12,%rdi
+  801890:	48 b8 db 15 80 00 00 	movabs $0x8015db,%rax
+  801897:	00 00 00 
+  80189a:	ff d0                	call   *%rax
+  80189c:	e9 a9 00 00 00       	jmp    80194a <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8018a1:	48 98                	cltq
+  8018a3:	e9 a2 00 00 00       	jmp    80194a <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018a8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018ad:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8018b2:	4c 89 fe             	mov    %r15,%rsi
+  8018b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ba:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  8018c1:	00 00 00 
+  8018c4:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018c6:	85 c0                	test   %eax,%eax
+  8018c8:	79 45                	jns    80190f <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018ca:	48 98                	cltq
+  8018cc:	eb 7c                	jmp    80194a <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018ce:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018d5:	76 4e                	jbe    801925 <devfile_write+0x1a8>
+  8018d7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018dc:	48 89 da             	mov    %rbx,%rdx
+  8018df:	4c 89 f6             	mov    %r14,%rsi
+  8018e2:	4c 89 e7             	mov    %r12,%rdi
+  8018e5:	48 b8 db 15 80 00 00 	movabs $0x8015db,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+  8018f1:	eb 57                	jmp    80194a <devfile_write+0x1cd>
+  8018f3:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018fa:	77 db                	ja     8018d7 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018fc:	4c 89 ff             	mov    %r15,%rdi
+  8018ff:	48 b8 a6 2e 80 00 00 	movabs $0x802ea6,%rax
+  801906:	00 00 00 
+  801909:	ff d0                	call   *%rax
+  80190b:	84 c0                	test   %al,%al
+  80190d:	74 99                	je     8018a8 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80190f:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  801914:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801919:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80191d:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801924:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801925:	4c 89 ff             	mov    %r15,%rdi
+  801928:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80192c:	48 89 da             	mov    %rbx,%rdx
+  80192f:	4c 89 f6             	mov    %r14,%rsi
+  801932:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  801939:	00 00 00 
+  80193c:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80193e:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801942:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801947:	48 89 d8             	mov    %rbx,%rax
+}
+  80194a:	48 83 c4 08          	add    $0x8,%rsp
+  80194e:	5b                   	pop    %rbx
+  80194f:	41 5c                	pop    %r12
+  801951:	41 5d                	pop    %r13
+  801953:	41 5e                	pop    %r14
+  801955:	41 5f                	pop    %r15
+  801957:	5d                   	pop    %rbp
+  801958:	c3                   	ret
+        return E_INVAL;
+  801959:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80195e:	c3                   	ret
+
+000000000080195f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80195f:	55                   	push   %rbp
+  801960:	48 89 e5             	mov    %rsp,%rbp
+  801963:	41 54                	push   %r12
+  801965:	53                   	push   %rbx
+  801966:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801969:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801970:	00 00 00 
+  801973:	ff d0                	call   *%rax
+  801975:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801978:	48 89 df             	mov    %rbx,%rdi
+  80197b:	48 b8 8b 0f 80 00 00 	movabs $0x800f8b,%rax
+  801982:	00 00 00 
+  801985:	ff d0                	call   *%rax
+  801987:	48 85 c0             	test   %rax,%rax
+  80198a:	74 17                	je     8019a3 <devfile_flush+0x44>
+  80198c:	48 89 df             	mov    %rbx,%rdi
+  80198f:	48 b8 8b 0f 80 00 00 	movabs $0x800f8b,%rax
+  801996:	00 00 00 
+  801999:	ff d0                	call   *%rax
+  80199b:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019a2:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019a3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019a6:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8019ad:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8019af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019be:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  8019c5:	00 00 00 
+  8019c8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019ca:	45 85 e4             	test   %r12d,%r12d
+  8019cd:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019d1:	5b                   	pop    %rbx
+  8019d2:	41 5c                	pop    %r12
+  8019d4:	5d                   	pop    %rbp
+  8019d5:	c3                   	ret
+
+00000000008019d6 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019d6:	55                   	push   %rbp
+  8019d7:	48 89 e5             	mov    %rsp,%rbp
+  8019da:	41 57                	push   %r15
+  8019dc:	41 56                	push   %r14
+  8019de:	41 55                	push   %r13
+  8019e0:	41 54                	push   %r12
+  8019e2:	53                   	push   %rbx
+  8019e3:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019eb:	49 89 f7             	mov    %rsi,%r15
+  8019ee:	48 89 d3             	mov    %rdx,%rbx
+  8019f1:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019f4:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  8019fb:	00 00 00 
+  8019fe:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a00:	48 85 c0             	test   %rax,%rax
+  801a03:	75 20                	jne    801a25 <devfile_read_direct+0x4f>
+    bool map = 1;
+  801a05:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a0a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a11:	00 
+    while (n) {
+  801a12:	48 85 db             	test   %rbx,%rbx
+  801a15:	0f 85 df 00 00 00    	jne    801afa <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a1b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a1f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a23:	eb 21                	jmp    801a46 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a25:	45 89 f1             	mov    %r14d,%r9d
+  801a28:	49 89 d8             	mov    %rbx,%r8
+  801a2b:	4c 89 f9             	mov    %r15,%rcx
+  801a2e:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a33:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a37:	48 89 c7             	mov    %rax,%rdi
+  801a3a:	48 b8 08 10 80 00 00 	movabs $0x801008,%rax
+  801a41:	00 00 00 
+  801a44:	ff d0                	call   *%rax
+}
+  801a46:	48 83 c4 38          	add    $0x38,%rsp
+  801a4a:	5b                   	pop    %rbx
+  801a4b:	41 5c                	pop    %r12
+  801a4d:	41 5d                	pop    %r13
+  801a4f:	41 5e                	pop    %r14
+  801a51:	41 5f                	pop    %r15
+  801a53:	5d                   	pop    %rbp
+  801a54:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a55:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a59:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a5f:	75 1e                	jne    801a7f <devfile_read_direct+0xa9>
+  801a61:	e9 e2 00 00 00       	jmp    801b48 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a66:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a6a:	eb da                	jmp    801a46 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a6c:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a70:	0f 85 d0 01 00 00    	jne    801c46 <devfile_read_direct+0x270>
+            map = 0;
+  801a76:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a7a:	eb 03                	jmp    801a7f <devfile_read_direct+0xa9>
+  801a7c:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a7f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a84:	48 39 d3             	cmp    %rdx,%rbx
+  801a87:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a8b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a8f:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a92:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a99:	00 00 00 
+  801a9c:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a9e:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801aa2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801aa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801aab:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ab0:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+        if (res <= 0)
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	0f 8e 63 01 00 00    	jle    801c27 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801ac4:	4c 63 e0             	movslq %eax,%r12
+  801ac7:	4c 89 e2             	mov    %r12,%rdx
+  801aca:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ad1:	00 00 00 
+  801ad4:	4c 89 ff             	mov    %r15,%rdi
+  801ad7:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  801ade:	00 00 00 
+  801ae1:	ff d0                	call   *%rax
+        buf += res;
+  801ae3:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ae6:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ae9:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801aed:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801af1:	48 85 db             	test   %rbx,%rbx
+  801af4:	0f 84 25 ff ff ff    	je     801a1f <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801afa:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801afd:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801b01:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801b05:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b09:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b10:	0f 97 c2             	seta   %dl
+  801b13:	20 c2                	and    %al,%dl
+  801b15:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b18:	0f 84 5e ff ff ff    	je     801a7c <devfile_read_direct+0xa6>
+  801b1e:	4c 89 fa             	mov    %r15,%rdx
+  801b21:	4d 89 fd             	mov    %r15,%r13
+  801b24:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b2b:	0f 85 4e ff ff ff    	jne    801a7f <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b31:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b35:	0f 84 1a ff ff ff    	je     801a55 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b3b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b42:	0f 85 37 ff ff ff    	jne    801a7f <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b48:	48 89 d8             	mov    %rbx,%rax
+  801b4b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b51:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b56:	48 39 c8             	cmp    %rcx,%rax
+  801b59:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b5d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b61:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b65:	49 89 d4             	mov    %rdx,%r12
+  801b68:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b6c:	48 b8 47 2e 80 00 00 	movabs $0x802e47,%rax
+  801b73:	00 00 00 
+  801b76:	ff d0                	call   *%rax
+  801b78:	a8 40                	test   $0x40,%al
+  801b7a:	0f 85 b9 00 00 00    	jne    801c39 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b80:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b87:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b8b:	49 39 c5             	cmp    %rax,%r13
+  801b8e:	72 d8                	jb     801b68 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b90:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b94:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b9b:	00 00 00 
+  801b9e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ba2:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801ba5:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801ba7:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801bab:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801baf:	48 b8 bc 0d 80 00 00 	movabs $0x800dbc,%rax
+  801bb6:	00 00 00 
+  801bb9:	ff d0                	call   *%rax
+  801bbb:	89 c7                	mov    %eax,%edi
+  801bbd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bc3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bc8:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bcf:	00 00 00 
+  801bd2:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bd7:	48 b8 f0 45 80 00 00 	movabs $0x8045f0,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801be3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bec:	4c 89 fe             	mov    %r15,%rsi
+  801bef:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf4:	48 b8 cc 45 80 00 00 	movabs $0x8045cc,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801c03:	48 85 d2             	test   %rdx,%rdx
+  801c06:	0f 84 5a fe ff ff    	je     801a66 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c0c:	0f 8e 5a fe ff ff    	jle    801a6c <devfile_read_direct+0x96>
+                buf += res;
+  801c12:	48 98                	cltq
+  801c14:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c17:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c1a:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c1e:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c22:	e9 ca fe ff ff       	jmp    801af1 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c27:	41 89 c5             	mov    %eax,%r13d
+  801c2a:	48 98                	cltq
+  801c2c:	45 85 ed             	test   %r13d,%r13d
+  801c2f:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c34:	e9 0d fe ff ff       	jmp    801a46 <devfile_read_direct+0x70>
+            map = 0;
+  801c39:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c3d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c41:	e9 39 fe ff ff       	jmp    801a7f <devfile_read_direct+0xa9>
+  801c46:	48 89 d0             	mov    %rdx,%rax
+  801c49:	e9 f8 fd ff ff       	jmp    801a46 <devfile_read_direct+0x70>
+
+0000000000801c4e <devfile_read>:
+    if (!fd || !buf)
+  801c4e:	48 85 ff             	test   %rdi,%rdi
+  801c51:	0f 84 21 02 00 00    	je     801e78 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c57:	55                   	push   %rbp
+  801c58:	48 89 e5             	mov    %rsp,%rbp
+  801c5b:	41 57                	push   %r15
+  801c5d:	41 56                	push   %r14
+  801c5f:	41 55                	push   %r13
+  801c61:	41 54                	push   %r12
+  801c63:	53                   	push   %rbx
+  801c64:	48 83 ec 28          	sub    $0x28,%rsp
+  801c68:	48 89 fb             	mov    %rdi,%rbx
+  801c6b:	49 89 f4             	mov    %rsi,%r12
+  801c6e:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c71:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c76:	48 85 f6             	test   %rsi,%rsi
+  801c79:	74 4b                	je     801cc6 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c7b:	48 b8 8b 0f 80 00 00 	movabs $0x800f8b,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c8a:	48 85 c0             	test   %rax,%rax
+  801c8d:	74 22                	je     801cb1 <devfile_read+0x63>
+  801c8f:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c96:	77 19                	ja     801cb1 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c98:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c9d:	48 89 df             	mov    %rbx,%rdi
+  801ca0:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cac:	83 f8 02             	cmp    $0x2,%eax
+  801caf:	7e 40                	jle    801cf1 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801cb1:	48 89 df             	mov    %rbx,%rdi
+  801cb4:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801cbb:	00 00 00 
+  801cbe:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cc0:	85 c0                	test   %eax,%eax
+  801cc2:	79 11                	jns    801cd5 <devfile_read+0x87>
+  801cc4:	48 98                	cltq
+}
+  801cc6:	48 83 c4 28          	add    $0x28,%rsp
+  801cca:	5b                   	pop    %rbx
+  801ccb:	41 5c                	pop    %r12
+  801ccd:	41 5d                	pop    %r13
+  801ccf:	41 5e                	pop    %r14
+  801cd1:	41 5f                	pop    %r15
+  801cd3:	5d                   	pop    %rbp
+  801cd4:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cd5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cda:	4c 89 ea             	mov    %r13,%rdx
+  801cdd:	4c 89 e6             	mov    %r12,%rsi
+  801ce0:	48 89 df             	mov    %rbx,%rdi
+  801ce3:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  801cea:	00 00 00 
+  801ced:	ff d0                	call   *%rax
+  801cef:	eb d5                	jmp    801cc6 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cf1:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cf5:	48 89 df             	mov    %rbx,%rdi
+  801cf8:	48 b8 d8 16 80 00 00 	movabs $0x8016d8,%rax
+  801cff:	00 00 00 
+  801d02:	ff d0                	call   *%rax
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	0f 88 33 01 00 00    	js     801e3f <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d0c:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d13:	00 00 00 
+  801d16:	4c 89 f0             	mov    %r14,%rax
+  801d19:	48 29 d0             	sub    %rdx,%rax
+  801d1c:	48 c1 f8 03          	sar    $0x3,%rax
+  801d20:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d27:	aa aa aa 
+  801d2a:	48 0f af c2          	imul   %rdx,%rax
+  801d2e:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d36:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d39:	41 39 06             	cmp    %eax,(%r14)
+  801d3c:	75 0d                	jne    801d4b <devfile_read+0xfd>
+  801d3e:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d41:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d45:	0f 84 fb 00 00 00    	je     801e46 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d4b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d50:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d54:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d5b:	48 89 c7             	mov    %rax,%rdi
+  801d5e:	48 b8 a6 2e 80 00 00 	movabs $0x802ea6,%rax
+  801d65:	00 00 00 
+  801d68:	ff d0                	call   *%rax
+  801d6a:	84 c0                	test   %al,%al
+  801d6c:	75 27                	jne    801d95 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d6e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d73:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d78:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d81:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  801d88:	00 00 00 
+  801d8b:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	0f 88 dc 00 00 00    	js     801e71 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d95:	44 89 f8             	mov    %r15d,%eax
+  801d98:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d9d:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d9f:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801da6:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801da7:	8b 43 10             	mov    0x10(%rbx),%eax
+  801daa:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801dae:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801db1:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801db6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801dba:	48 89 df             	mov    %rbx,%rdi
+  801dbd:	48 b8 d6 19 80 00 00 	movabs $0x8019d6,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801dc9:	48 85 c0             	test   %rax,%rax
+  801dcc:	0f 88 f4 fe ff ff    	js     801cc6 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dd2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dd5:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dd8:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801ddb:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801ddf:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801de3:	48 63 d1             	movslq %ecx,%rdx
+  801de6:	48 01 d0             	add    %rdx,%rax
+  801de9:	4d 63 ff             	movslq %r15d,%r15
+  801dec:	4c 29 f8             	sub    %r15,%rax
+  801def:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df4:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801df8:	48 85 c0             	test   %rax,%rax
+  801dfb:	0f 8e c5 fe ff ff    	jle    801cc6 <devfile_read+0x78>
+    n = MIN(n, res);
+  801e01:	4c 39 e8             	cmp    %r13,%rax
+  801e04:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e08:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e0b:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e0f:	48 63 f6             	movslq %esi,%rsi
+  801e12:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e17:	48 01 c6             	add    %rax,%rsi
+  801e1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1e:	48 01 c6             	add    %rax,%rsi
+  801e21:	4c 89 ea             	mov    %r13,%rdx
+  801e24:	4c 89 e7             	mov    %r12,%rdi
+  801e27:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  801e2e:	00 00 00 
+  801e31:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e33:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e37:	4c 89 e8             	mov    %r13,%rax
+  801e3a:	e9 87 fe ff ff       	jmp    801cc6 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e3f:	48 98                	cltq
+  801e41:	e9 80 fe ff ff       	jmp    801cc6 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e46:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e4a:	41 39 d7             	cmp    %edx,%r15d
+  801e4d:	0f 8c f8 fe ff ff    	jl     801d4b <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e53:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e57:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e5a:	41 39 cf             	cmp    %ecx,%r15d
+  801e5d:	0f 8d e8 fe ff ff    	jge    801d4b <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e63:	4d 63 ff             	movslq %r15d,%r15
+  801e66:	4c 29 f8             	sub    %r15,%rax
+  801e69:	48 63 d2             	movslq %edx,%rdx
+  801e6c:	48 01 d0             	add    %rdx,%rax
+  801e6f:	eb 87                	jmp    801df8 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e71:	48 98                	cltq
+  801e73:	e9 4e fe ff ff       	jmp    801cc6 <devfile_read+0x78>
+        return E_INVAL;
+  801e78:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e7d:	c3                   	ret
+
+0000000000801e7e <fs_channel>:
+fs_channel(bool enable) {
+  801e7e:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e80:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e87:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8e:	40 84 ff             	test   %dil,%dil
+  801e91:	74 47                	je     801eda <fs_channel+0x5c>
+  801e93:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e9a:	00 00 00 
+  801e9d:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801ea3:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801eaa:	00 00 00 
+  801ead:	3b 08                	cmp    (%rax),%ecx
+  801eaf:	74 29                	je     801eda <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801eb1:	55                   	push   %rbp
+  801eb2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801eb5:	48 b8 fe 0d 80 00 00 	movabs $0x800dfe,%rax
+  801ebc:	00 00 00 
+  801ebf:	ff d0                	call   *%rax
+  801ec1:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ec3:	85 c0                	test   %eax,%eax
+  801ec5:	78 04                	js     801ecb <fs_channel+0x4d>
+}
+  801ec7:	89 d0                	mov    %edx,%eax
+  801ec9:	5d                   	pop    %rbp
+  801eca:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ecb:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801ed2:	00 00 00 
+  801ed5:	c6 00 00             	movb   $0x0,(%rax)
+  801ed8:	eb ed                	jmp    801ec7 <fs_channel+0x49>
+}
+  801eda:	89 d0                	mov    %edx,%eax
+  801edc:	c3                   	ret
+
+0000000000801edd <open>:
+open(const char *path, int mode) {
+  801edd:	55                   	push   %rbp
+  801ede:	48 89 e5             	mov    %rsp,%rbp
+  801ee1:	41 55                	push   %r13
+  801ee3:	41 54                	push   %r12
+  801ee5:	53                   	push   %rbx
+  801ee6:	48 83 ec 18          	sub    $0x18,%rsp
+  801eea:	49 89 fc             	mov    %rdi,%r12
+  801eed:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ef0:	48 b8 ac 3d 80 00 00 	movabs $0x803dac,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f02:	0f 87 8f 00 00 00    	ja     801f97 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f08:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f0c:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	89 c3                	mov    %eax,%ebx
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 55                	js     801f73 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f1e:	4c 89 e6             	mov    %r12,%rsi
+  801f21:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f28:	00 00 00 
+  801f2b:	48 89 df             	mov    %rbx,%rdi
+  801f2e:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f3a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f41:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f46:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f4a:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f4f:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+  801f5b:	89 c3                	mov    %eax,%ebx
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 1f                	js     801f80 <open+0xa3>
+    return fd2num(fd);
+  801f61:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f65:	48 b8 8a 06 80 00 00 	movabs $0x80068a,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	89 c3                	mov    %eax,%ebx
+}
+  801f73:	89 d8                	mov    %ebx,%eax
+  801f75:	48 83 c4 18          	add    $0x18,%rsp
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	41 5d                	pop    %r13
+  801f7e:	5d                   	pop    %rbp
+  801f7f:	c3                   	ret
+        fd_close(fd, 0);
+  801f80:	be 00 00 00 00       	mov    $0x0,%esi
+  801f85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f89:	48 b8 d3 07 80 00 00 	movabs $0x8007d3,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+        return res;
+  801f95:	eb dc                	jmp    801f73 <open+0x96>
+        return -E_BAD_PATH;
+  801f97:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f9c:	eb d5                	jmp    801f73 <open+0x96>
+
+0000000000801f9e <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f9e:	55                   	push   %rbp
+  801f9f:	48 89 e5             	mov    %rsp,%rbp
+  801fa2:	41 56                	push   %r14
+  801fa4:	41 55                	push   %r13
+  801fa6:	41 54                	push   %r12
+  801fa8:	53                   	push   %rbx
+  801fa9:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801fad:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fb4:	00 00 00 
+  801fb7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fbc:	49 bd 18 07 80 00 00 	movabs $0x800718,%r13
+  801fc3:	00 00 00 
+  801fc6:	49 be d8 16 80 00 00 	movabs $0x8016d8,%r14
+  801fcd:	00 00 00 
+  801fd0:	eb 0c                	jmp    801fde <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fd2:	83 c3 01             	add    $0x1,%ebx
+  801fd5:	49 83 c4 18          	add    $0x18,%r12
+  801fd9:	83 fb 20             	cmp    $0x20,%ebx
+  801fdc:	74 1d                	je     801ffb <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fde:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fe3:	74 ed                	je     801fd2 <file_flush_buffers+0x34>
+  801fe5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe9:	89 df                	mov    %ebx,%edi
+  801feb:	41 ff d5             	call   *%r13
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	78 e0                	js     801fd2 <file_flush_buffers+0x34>
+  801ff2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ff6:	41 ff d6             	call   *%r14
+  801ff9:	eb d7                	jmp    801fd2 <file_flush_buffers+0x34>
+}
+  801ffb:	48 83 c4 10          	add    $0x10,%rsp
+  801fff:	5b                   	pop    %rbx
+  802000:	41 5c                	pop    %r12
+  802002:	41 5d                	pop    %r13
+  802004:	41 5e                	pop    %r14
+  802006:	5d                   	pop    %rbp
+  802007:	c3                   	ret
+
+0000000000802008 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802008:	55                   	push   %rbp
+  802009:	48 89 e5             	mov    %rsp,%rbp
+  80200c:	41 54                	push   %r12
+  80200e:	53                   	push   %rbx
+  80200f:	49 89 fc             	mov    %rdi,%r12
+  802012:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802014:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  80201b:	00 00 00 
+  80201e:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802020:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802027:	00 00 00 
+  80202a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80202f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802031:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802034:	ba 00 00 00 00       	mov    $0x0,%edx
+  802039:	be 00 00 00 00       	mov    $0x0,%esi
+  80203e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802043:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+}
+  80204f:	5b                   	pop    %rbx
+  802050:	41 5c                	pop    %r12
+  802052:	5d                   	pop    %rbp
+  802053:	c3                   	ret
+
+0000000000802054 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802054:	55                   	push   %rbp
+  802055:	48 89 e5             	mov    %rsp,%rbp
+  802058:	41 54                	push   %r12
+  80205a:	53                   	push   %rbx
+  80205b:	49 89 fc             	mov    %rdi,%r12
+  80205e:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802061:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80206d:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802072:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802079:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80207b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802080:	be 00 00 00 00       	mov    $0x0,%esi
+  802085:	bf 05 00 00 00       	mov    $0x5,%edi
+  80208a:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  802091:	00 00 00 
+  802094:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802096:	85 c0                	test   %eax,%eax
+  802098:	78 3d                	js     8020d7 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80209a:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8020a1:	00 00 00 
+  8020a4:	4c 89 e6             	mov    %r12,%rsi
+  8020a7:	48 89 df             	mov    %rbx,%rdi
+  8020aa:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020b6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020bd:	00 
+  8020be:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020c4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020cb:	00 
+  8020cc:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d7:	5b                   	pop    %rbx
+  8020d8:	41 5c                	pop    %r12
+  8020da:	5d                   	pop    %rbp
+  8020db:	c3                   	ret
+
+00000000008020dc <remove>:
+remove(const char *path) {
+  8020dc:	55                   	push   %rbp
+  8020dd:	48 89 e5             	mov    %rsp,%rbp
+  8020e0:	53                   	push   %rbx
+  8020e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e5:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020e8:	48 b8 ac 3d 80 00 00 	movabs $0x803dac,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+  8020f4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020fa:	77 3a                	ja     802136 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020fc:	48 89 de             	mov    %rbx,%rsi
+  8020ff:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802106:	00 00 00 
+  802109:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  802110:	00 00 00 
+  802113:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802115:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211a:	be 00 00 00 00       	mov    $0x0,%esi
+  80211f:	bf 07 00 00 00       	mov    $0x7,%edi
+  802124:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+}
+  802130:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802134:	c9                   	leave
+  802135:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802136:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80213b:	eb f3                	jmp    802130 <remove+0x54>
+
+000000000080213d <sync>:
+sync(void) {
+  80213d:	55                   	push   %rbp
+  80213e:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802141:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80214d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802152:	be 00 00 00 00       	mov    $0x0,%esi
+  802157:	bf 08 00 00 00       	mov    $0x8,%edi
+  80215c:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+}
+  802168:	5d                   	pop    %rbp
+  802169:	c3                   	ret
+
+000000000080216a <fsync>:
+fsync(int fdnum) {
+  80216a:	55                   	push   %rbp
+  80216b:	48 89 e5             	mov    %rsp,%rbp
+  80216e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802172:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802176:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  80217d:	00 00 00 
+  802180:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802182:	85 c0                	test   %eax,%eax
+  802184:	78 4b                	js     8021d1 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802186:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80218a:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802191:	00 00 00 
+  802194:	8b 00                	mov    (%rax),%eax
+  802196:	39 02                	cmp    %eax,(%rdx)
+  802198:	75 39                	jne    8021d3 <fsync+0x69>
+    file_flush_buffers();
+  80219a:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8021a1:	00 00 00 
+  8021a4:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8021a6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021aa:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021ad:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021b4:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021c5:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  8021cc:	00 00 00 
+  8021cf:	ff d0                	call   *%rax
+}
+  8021d1:	c9                   	leave
+  8021d2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021d3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d8:	eb f7                	jmp    8021d1 <fsync+0x67>
+
+00000000008021da <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021da:	55                   	push   %rbp
+  8021db:	48 89 e5             	mov    %rsp,%rbp
+  8021de:	53                   	push   %rbx
+  8021df:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e3:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021eb:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f0:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021f5:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  8021fc:	00 00 00 
+  8021ff:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802201:	85 c0                	test   %eax,%eax
+  802203:	78 2d                	js     802232 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  802205:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80220c:	00 00 00 
+  80220f:	48 8b 10             	mov    (%rax),%rdx
+  802212:	48 89 13             	mov    %rdx,(%rbx)
+  802215:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802219:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80221d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802221:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802225:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802229:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80222d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802236:	c9                   	leave
+  802237:	c3                   	ret
+
+0000000000802238 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802238:	55                   	push   %rbp
+  802239:	48 89 e5             	mov    %rsp,%rbp
+  80223c:	53                   	push   %rbx
+  80223d:	48 83 ec 08          	sub    $0x8,%rsp
+  802241:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802244:	ba 00 00 00 00       	mov    $0x0,%edx
+  802249:	be 00 00 00 00       	mov    $0x0,%esi
+  80224e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802253:	48 b8 6f 14 80 00 00 	movabs $0x80146f,%rax
+  80225a:	00 00 00 
+  80225d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80225f:	85 c0                	test   %eax,%eax
+  802261:	78 3d                	js     8022a0 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802263:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80226a:	00 00 00 
+  80226d:	48 8b 10             	mov    (%rax),%rdx
+  802270:	48 89 13             	mov    %rdx,(%rbx)
+  802273:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802277:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80227b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80227f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802283:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802287:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80228b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80228f:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802293:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802297:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80229b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022a4:	c9                   	leave
+  8022a5:	c3                   	ret
+
+00000000008022a6 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8022a6:	55                   	push   %rbp
+  8022a7:	48 89 e5             	mov    %rsp,%rbp
+  8022aa:	41 57                	push   %r15
+  8022ac:	41 56                	push   %r14
+  8022ae:	41 55                	push   %r13
+  8022b0:	41 54                	push   %r12
+  8022b2:	53                   	push   %rbx
+  8022b3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022b7:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022be:	00 
+  8022bf:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022c6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022cc:	0f 85 43 01 00 00    	jne    802415 <munmap+0x16f>
+  8022d2:	49 89 ff             	mov    %rdi,%r15
+  8022d5:	4c 39 f7             	cmp    %r14,%rdi
+  8022d8:	0f 87 37 01 00 00    	ja     802415 <munmap+0x16f>
+  8022de:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022e5:	00 00 00 
+  8022e8:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022ee:	eb 2c                	jmp    80231c <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022f0:	4c 39 f8             	cmp    %r15,%rax
+  8022f3:	0f 83 85 00 00 00    	jae    80237e <munmap+0xd8>
+            m->mm_end = start;
+  8022f9:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022fe:	48 83 c3 18          	add    $0x18,%rbx
+  802302:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802309:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802310:	00 00 00 
+  802313:	48 39 c3             	cmp    %rax,%rbx
+  802316:	0f 84 d0 00 00 00    	je     8023ec <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80231c:	49 89 dc             	mov    %rbx,%r12
+  80231f:	48 8b 03             	mov    (%rbx),%rax
+  802322:	4c 39 f0             	cmp    %r14,%rax
+  802325:	73 d7                	jae    8022fe <munmap+0x58>
+  802327:	48 85 c0             	test   %rax,%rax
+  80232a:	74 d2                	je     8022fe <munmap+0x58>
+  80232c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802330:	49 39 d7             	cmp    %rdx,%r15
+  802333:	73 c9                	jae    8022fe <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802335:	49 39 d6             	cmp    %rdx,%r14
+  802338:	73 b6                	jae    8022f0 <munmap+0x4a>
+  80233a:	49 39 c7             	cmp    %rax,%r15
+  80233d:	76 b1                	jbe    8022f0 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80233f:	4c 89 ef             	mov    %r13,%rdi
+  802342:	48 b8 dd 13 80 00 00 	movabs $0x8013dd,%rax
+  802349:	00 00 00 
+  80234c:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80234e:	48 85 c0             	test   %rax,%rax
+  802351:	0f 84 c5 00 00 00    	je     80241c <munmap+0x176>
+            *tail = *m;
+  802357:	48 8b 13             	mov    (%rbx),%rdx
+  80235a:	48 89 10             	mov    %rdx,(%rax)
+  80235d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802361:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802365:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802369:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80236d:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802370:	44 89 f2             	mov    %r14d,%edx
+  802373:	2b 13                	sub    (%rbx),%edx
+  802375:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802378:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80237c:	eb 80                	jmp    8022fe <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80237e:	49 39 d6             	cmp    %rdx,%r14
+  802381:	73 18                	jae    80239b <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802383:	44 89 f2             	mov    %r14d,%edx
+  802386:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80238b:	29 c2                	sub    %eax,%edx
+  80238d:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  802392:	4d 89 34 24          	mov    %r14,(%r12)
+  802396:	e9 63 ff ff ff       	jmp    8022fe <munmap+0x58>
+    m->mm_start = 0;
+  80239b:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8023a2:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8023a3:	4c 89 e6             	mov    %r12,%rsi
+  8023a6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023ad:	00 00 00 
+  8023b0:	48 29 c6             	sub    %rax,%rsi
+  8023b3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023b7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023be:	aa aa aa 
+  8023c1:	48 0f af f0          	imul   %rax,%rsi
+  8023c5:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023c9:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023ce:	48 01 c6             	add    %rax,%rsi
+  8023d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023db:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  8023e2:	00 00 00 
+  8023e5:	ff d0                	call   *%rax
+}
+  8023e7:	e9 12 ff ff ff       	jmp    8022fe <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023ec:	4c 89 f2             	mov    %r14,%rdx
+  8023ef:	4c 29 fa             	sub    %r15,%rdx
+  8023f2:	4c 89 fe             	mov    %r15,%rsi
+  8023f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023fa:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  802401:	00 00 00 
+  802404:	ff d0                	call   *%rax
+}
+  802406:	48 83 c4 08          	add    $0x8,%rsp
+  80240a:	5b                   	pop    %rbx
+  80240b:	41 5c                	pop    %r12
+  80240d:	41 5d                	pop    %r13
+  80240f:	41 5e                	pop    %r14
+  802411:	41 5f                	pop    %r15
+  802413:	5d                   	pop    %rbp
+  802414:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802415:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80241a:	eb ea                	jmp    802406 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80241c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802421:	eb e3                	jmp    802406 <munmap+0x160>
+
+0000000000802423 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802423:	55                   	push   %rbp
+  802424:	48 89 e5             	mov    %rsp,%rbp
+  802427:	41 57                	push   %r15
+  802429:	41 56                	push   %r14
+  80242b:	41 55                	push   %r13
+  80242d:	41 54                	push   %r12
+  80242f:	53                   	push   %rbx
+  802430:	48 83 ec 28          	sub    $0x28,%rsp
+  802434:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802438:	49 89 f5             	mov    %rsi,%r13
+  80243b:	41 89 d6             	mov    %edx,%r14d
+  80243e:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802441:	41 89 cc             	mov    %ecx,%r12d
+  802444:	44 89 c7             	mov    %r8d,%edi
+  802447:	44 89 cb             	mov    %r9d,%ebx
+  80244a:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80244e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802452:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  802459:	00 00 00 
+  80245c:	ff d0                	call   *%rax
+  80245e:	41 89 c7             	mov    %eax,%r15d
+  802461:	85 c0                	test   %eax,%eax
+  802463:	0f 88 ae 01 00 00    	js     802617 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802469:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80246d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802474:	00 00 00 
+  802477:	8b 32                	mov    (%rdx),%esi
+  802479:	39 30                	cmp    %esi,(%rax)
+  80247b:	0f 85 7a 02 00 00    	jne    8026fb <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802481:	8b 40 08             	mov    0x8(%rax),%eax
+  802484:	83 e0 03             	and    $0x3,%eax
+  802487:	83 f8 01             	cmp    $0x1,%eax
+  80248a:	0f 84 76 02 00 00    	je     802706 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802490:	4d 85 ed             	test   %r13,%r13
+  802493:	0f 84 78 02 00 00    	je     802711 <mmap+0x2ee>
+  802499:	85 db                	test   %ebx,%ebx
+  80249b:	0f 88 70 02 00 00    	js     802711 <mmap+0x2ee>
+  8024a1:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8024a7:	41 89 df             	mov    %ebx,%r15d
+  8024aa:	0f 85 6c 02 00 00    	jne    80271c <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8024b0:	44 89 f0             	mov    %r14d,%eax
+  8024b3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024b6:	83 f8 04             	cmp    $0x4,%eax
+  8024b9:	0f 85 68 02 00 00    	jne    802727 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024bf:	44 89 e1             	mov    %r12d,%ecx
+  8024c2:	83 e1 01             	and    $0x1,%ecx
+  8024c5:	0f 95 c2             	setne  %dl
+  8024c8:	44 89 e0             	mov    %r12d,%eax
+  8024cb:	d1 e8                	shr    %eax
+  8024cd:	83 f0 01             	xor    $0x1,%eax
+  8024d0:	83 e0 01             	and    $0x1,%eax
+  8024d3:	38 c2                	cmp    %al,%dl
+  8024d5:	0f 85 57 02 00 00    	jne    802732 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024db:	85 c9                	test   %ecx,%ecx
+  8024dd:	74 0a                	je     8024e9 <mmap+0xc6>
+  8024df:	41 f6 c6 02          	test   $0x2,%r14b
+  8024e3:	0f 85 54 02 00 00    	jne    80273d <mmap+0x31a>
+    file_flush_buffers();
+  8024e9:	48 b8 9e 1f 80 00 00 	movabs $0x801f9e,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024f5:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024fc:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  802503:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802507:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80250a:	41 f6 c4 04          	test   $0x4,%r12b
+  80250e:	0f 84 15 01 00 00    	je     802629 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  802514:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802517:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80251d:	0f 85 25 02 00 00    	jne    802748 <mmap+0x325>
+  802523:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802527:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80252e:	00 00 00 
+  802531:	48 39 c2             	cmp    %rax,%rdx
+  802534:	0f 82 19 02 00 00    	jb     802753 <mmap+0x330>
+  80253a:	48 39 c7             	cmp    %rax,%rdi
+  80253d:	0f 87 10 02 00 00    	ja     802753 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802543:	4c 89 ee             	mov    %r13,%rsi
+  802546:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  80254d:	00 00 00 
+  802550:	ff d0                	call   *%rax
+  802552:	85 c0                	test   %eax,%eax
+  802554:	0f 88 04 02 00 00    	js     80275e <mmap+0x33b>
+    if (!handler) {
+  80255a:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802561:	00 00 00 
+  802564:	80 38 00             	cmpb   $0x0,(%rax)
+  802567:	75 2b                	jne    802594 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802569:	48 bf 3e 13 80 00 00 	movabs $0x80133e,%rdi
+  802570:	00 00 00 
+  802573:	48 b8 9b 42 80 00 00 	movabs $0x80429b,%rax
+  80257a:	00 00 00 
+  80257d:	ff d0                	call   *%rax
+  80257f:	85 c0                	test   %eax,%eax
+  802581:	0f 88 ea 01 00 00    	js     802771 <mmap+0x34e>
+        handler = 1;
+  802587:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80258e:	00 00 00 
+  802591:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802594:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802598:	48 b8 dd 13 80 00 00 	movabs $0x8013dd,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+  8025a4:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8025a7:	48 85 c0             	test   %rax,%rax
+  8025aa:	0f 84 c9 01 00 00    	je     802779 <mmap+0x356>
+    m->mm_start = va;
+  8025b0:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025b3:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025b7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025bb:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025be:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025c2:	44 89 e0             	mov    %r12d,%eax
+  8025c5:	c1 e0 06             	shl    $0x6,%eax
+  8025c8:	25 80 00 00 00       	and    $0x80,%eax
+  8025cd:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025d0:	09 f0                	or     %esi,%eax
+  8025d2:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025d6:	41 f6 c4 08          	test   $0x8,%r12b
+  8025da:	74 31                	je     80260d <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025dc:	48 39 d3             	cmp    %rdx,%rbx
+  8025df:	73 2c                	jae    80260d <mmap+0x1ea>
+  8025e1:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025e6:	48 89 de             	mov    %rbx,%rsi
+  8025e9:	4c 89 f7             	mov    %r14,%rdi
+  8025ec:	48 b8 2d 12 80 00 00 	movabs $0x80122d,%rax
+  8025f3:	00 00 00 
+  8025f6:	ff d0                	call   *%rax
+  8025f8:	49 89 c4             	mov    %rax,%r12
+  8025fb:	48 85 c0             	test   %rax,%rax
+  8025fe:	0f 8e d7 00 00 00    	jle    8026db <mmap+0x2b8>
+            va += n;
+  802604:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  802607:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80260b:	72 d4                	jb     8025e1 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80260d:	49 8b 06             	mov    (%r14),%rax
+  802610:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802614:	48 89 06             	mov    %rax,(%rsi)
+}
+  802617:	44 89 f8             	mov    %r15d,%eax
+  80261a:	48 83 c4 28          	add    $0x28,%rsp
+  80261e:	5b                   	pop    %rbx
+  80261f:	41 5c                	pop    %r12
+  802621:	41 5d                	pop    %r13
+  802623:	41 5e                	pop    %r14
+  802625:	41 5f                	pop    %r15
+  802627:	5d                   	pop    %rbp
+  802628:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802629:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802630:	00 00 00 
+  802633:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802636:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80263d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802640:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802645:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80264c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80264f:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802656:	00 00 00 
+  802659:	48 39 d7             	cmp    %rdx,%rdi
+  80265c:	73 1c                	jae    80267a <mmap+0x257>
+        return -E_NO_MEM;
+  80265e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802664:	eb b1                	jmp    802617 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802666:	48 83 c0 01          	add    $0x1,%rax
+  80266a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80266e:	77 3f                	ja     8026af <mmap+0x28c>
+  802670:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802675:	48 39 d7             	cmp    %rdx,%rdi
+  802678:	72 2a                	jb     8026a4 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80267a:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80267e:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802682:	48 39 d1             	cmp    %rdx,%rcx
+  802685:	73 df                	jae    802666 <mmap+0x243>
+  802687:	48 85 c9             	test   %rcx,%rcx
+  80268a:	74 da                	je     802666 <mmap+0x243>
+  80268c:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802690:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802695:	48 39 d3             	cmp    %rdx,%rbx
+  802698:	73 cc                	jae    802666 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80269a:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80269d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a2:	eb cc                	jmp    802670 <mmap+0x24d>
+        return -E_NO_MEM;
+  8026a4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026aa:	e9 68 ff ff ff       	jmp    802617 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8026af:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026b4:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026bb:	00 00 00 
+  8026be:	48 39 c2             	cmp    %rax,%rdx
+  8026c1:	0f 82 9f 00 00 00    	jb     802766 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026c7:	48 85 db             	test   %rbx,%rbx
+  8026ca:	0f 85 8a fe ff ff    	jne    80255a <mmap+0x137>
+        return -E_NO_MEM;
+  8026d0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026d6:	e9 3c ff ff ff       	jmp    802617 <mmap+0x1f4>
+        if (n < 0) {
+  8026db:	0f 89 2c ff ff ff    	jns    80260d <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026e1:	49 8b 3e             	mov    (%r14),%rdi
+  8026e4:	4c 89 ee             	mov    %r13,%rsi
+  8026e7:	48 b8 a6 22 80 00 00 	movabs $0x8022a6,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+            return n;
+  8026f3:	45 89 e7             	mov    %r12d,%r15d
+  8026f6:	e9 1c ff ff ff       	jmp    802617 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026fb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802701:	e9 11 ff ff ff       	jmp    802617 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802706:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270c:	e9 06 ff ff ff       	jmp    802617 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802711:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802717:	e9 fb fe ff ff       	jmp    802617 <mmap+0x1f4>
+  80271c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802722:	e9 f0 fe ff ff       	jmp    802617 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802727:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80272d:	e9 e5 fe ff ff       	jmp    802617 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802732:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802738:	e9 da fe ff ff       	jmp    802617 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80273d:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802743:	e9 cf fe ff ff       	jmp    802617 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802748:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80274e:	e9 c4 fe ff ff       	jmp    802617 <mmap+0x1f4>
+  802753:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802759:	e9 b9 fe ff ff       	jmp    802617 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80275e:	41 89 c7             	mov    %eax,%r15d
+  802761:	e9 b1 fe ff ff       	jmp    802617 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802766:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80276c:	e9 a6 fe ff ff       	jmp    802617 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802771:	41 89 c7             	mov    %eax,%r15d
+  802774:	e9 9e fe ff ff       	jmp    802617 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802779:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80277f:	e9 93 fe ff ff       	jmp    802617 <mmap+0x1f4>
+
+0000000000802784 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802784:	55                   	push   %rbp
+  802785:	48 89 e5             	mov    %rsp,%rbp
+  802788:	41 54                	push   %r12
+  80278a:	53                   	push   %rbx
+  80278b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80278e:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802795:	00 00 00 
+  802798:	ff d0                	call   *%rax
+  80279a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80279d:	48 be a0 47 80 00 00 	movabs $0x8047a0,%rsi
+  8027a4:	00 00 00 
+  8027a7:	48 89 df             	mov    %rbx,%rdi
+  8027aa:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  8027b1:	00 00 00 
+  8027b4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027b6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027bb:	41 2b 04 24          	sub    (%r12),%eax
+  8027bf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027c5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027cc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027cf:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027d6:	00 00 00 
+  8027d9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e5:	5b                   	pop    %rbx
+  8027e6:	41 5c                	pop    %r12
+  8027e8:	5d                   	pop    %rbp
+  8027e9:	c3                   	ret
+
+00000000008027ea <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027ea:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027ed:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027f3:	8b 17                	mov    (%rdi),%edx
+  8027f5:	85 d2                	test   %edx,%edx
+  8027f7:	75 01                	jne    8027fa <pipe_wakeup+0x10>
+  8027f9:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027fa:	55                   	push   %rbp
+  8027fb:	48 89 e5             	mov    %rsp,%rbp
+  8027fe:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  802801:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  802807:	be 00 04 00 00       	mov    $0x400,%esi
+  80280c:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  802813:	00 00 00 
+  802816:	ff d0                	call   *%rax
+}
+  802818:	5d                   	pop    %rbp
+  802819:	c3                   	ret
+
+000000000080281a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80281a:	55                   	push   %rbp
+  80281b:	48 89 e5             	mov    %rsp,%rbp
+  80281e:	41 55                	push   %r13
+  802820:	41 54                	push   %r12
+  802822:	53                   	push   %rbx
+  802823:	48 83 ec 08          	sub    $0x8,%rsp
+  802827:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80282a:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802831:	00 00 00 
+  802834:	ff d0                	call   *%rax
+  802836:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802839:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80283e:	4c 89 e6             	mov    %r12,%rsi
+  802841:	bf 00 00 00 00       	mov    $0x0,%edi
+  802846:	49 bc fd 02 80 00 00 	movabs $0x8002fd,%r12
+  80284d:	00 00 00 
+  802850:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802853:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802857:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80285b:	49 bd ea 27 80 00 00 	movabs $0x8027ea,%r13
+  802862:	00 00 00 
+  802865:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802868:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80286c:	48 89 de             	mov    %rbx,%rsi
+  80286f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802872:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802877:	48 89 de             	mov    %rbx,%rsi
+  80287a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80287f:	41 ff d4             	call   *%r12
+  802882:	48 83 c4 08          	add    $0x8,%rsp
+  802886:	5b                   	pop    %rbx
+  802887:	41 5c                	pop    %r12
+  802889:	41 5d                	pop    %r13
+  80288b:	5d                   	pop    %rbp
+  80288c:	c3                   	ret
+
+000000000080288d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80288d:	55                   	push   %rbp
+  80288e:	48 89 e5             	mov    %rsp,%rbp
+  802891:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802894:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802899:	be 00 10 00 00       	mov    $0x1000,%esi
+  80289e:	48 b8 40 02 80 00 00 	movabs $0x800240,%rax
+  8028a5:	00 00 00 
+  8028a8:	ff d0                	call   *%rax
+  8028aa:	85 c0                	test   %eax,%eax
+  8028ac:	0f 94 c0             	sete   %al
+  8028af:	0f b6 c0             	movzbl %al,%eax
+}
+  8028b2:	5d                   	pop    %rbp
+  8028b3:	c3                   	ret
+
+00000000008028b4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028b4:	55                   	push   %rbp
+  8028b5:	48 89 e5             	mov    %rsp,%rbp
+  8028b8:	41 57                	push   %r15
+  8028ba:	41 56                	push   %r14
+  8028bc:	41 55                	push   %r13
+  8028be:	41 54                	push   %r12
+  8028c0:	53                   	push   %rbx
+  8028c1:	48 83 ec 38          	sub    $0x38,%rsp
+  8028c5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028c9:	49 89 f4             	mov    %rsi,%r12
+  8028cc:	49 89 d7             	mov    %rdx,%r15
+  8028cf:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028d3:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  8028da:	00 00 00 
+  8028dd:	ff d0                	call   *%rax
+  8028df:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028e2:	4d 85 ff             	test   %r15,%r15
+  8028e5:	0f 84 f1 00 00 00    	je     8029dc <devpipe_write+0x128>
+  8028eb:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028ef:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028f3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028f7:	49 bd 8d 28 80 00 00 	movabs $0x80288d,%r13
+  8028fe:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802901:	49 bf ea 27 80 00 00 	movabs $0x8027ea,%r15
+  802908:	00 00 00 
+  80290b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80290f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802913:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802917:	8b 73 04             	mov    0x4(%rbx),%esi
+  80291a:	48 63 ce             	movslq %esi,%rcx
+  80291d:	48 63 03             	movslq (%rbx),%rax
+  802920:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802926:	48 39 c1             	cmp    %rax,%rcx
+  802929:	72 64                	jb     80298f <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80292b:	48 89 de             	mov    %rbx,%rsi
+  80292e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802932:	41 ff d5             	call   *%r13
+  802935:	85 c0                	test   %eax,%eax
+  802937:	0f 85 b9 00 00 00    	jne    8029f6 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80293d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802941:	4c 89 f7             	mov    %r14,%rdi
+  802944:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802947:	8b 43 04             	mov    0x4(%rbx),%eax
+  80294a:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802951:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802958:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80295e:	8b 03                	mov    (%rbx),%eax
+  802960:	41 39 c4             	cmp    %eax,%r12d
+  802963:	75 b2                	jne    802917 <devpipe_write+0x63>
+  802965:	48 89 de             	mov    %rbx,%rsi
+  802968:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80296c:	41 ff d5             	call   *%r13
+  80296f:	85 c0                	test   %eax,%eax
+  802971:	75 a0                	jne    802913 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802973:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802978:	44 89 e6             	mov    %r12d,%esi
+  80297b:	48 89 df             	mov    %rbx,%rdi
+  80297e:	48 b8 c5 05 80 00 00 	movabs $0x8005c5,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+  80298a:	e9 7c ff ff ff       	jmp    80290b <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80298f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802993:	41 0f b6 38          	movzbl (%r8),%edi
+  802997:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80299e:	80 80 80 
+  8029a1:	48 89 c8             	mov    %rcx,%rax
+  8029a4:	48 f7 e2             	mul    %rdx
+  8029a7:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029ab:	48 89 d0             	mov    %rdx,%rax
+  8029ae:	48 c1 e0 08          	shl    $0x8,%rax
+  8029b2:	48 29 d0             	sub    %rdx,%rax
+  8029b5:	48 c1 e0 04          	shl    $0x4,%rax
+  8029b9:	48 29 c1             	sub    %rax,%rcx
+  8029bc:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029c1:	83 c6 01             	add    $0x1,%esi
+  8029c4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029c7:	49 83 c0 01          	add    $0x1,%r8
+  8029cb:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029cf:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029d3:	49 39 c0             	cmp    %rax,%r8
+  8029d6:	0f 85 2f ff ff ff    	jne    80290b <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029dc:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029e0:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029e4:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  8029eb:	00 00 00 
+  8029ee:	ff d0                	call   *%rax
+    return n;
+  8029f0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029f4:	eb 05                	jmp    8029fb <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029f6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029fb:	48 83 c4 38          	add    $0x38,%rsp
+  8029ff:	5b                   	pop    %rbx
+  802a00:	41 5c                	pop    %r12
+  802a02:	41 5d                	pop    %r13
+  802a04:	41 5e                	pop    %r14
+  802a06:	41 5f                	pop    %r15
+  802a08:	5d                   	pop    %rbp
+  802a09:	c3                   	ret
+
+0000000000802a0a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a0a:	55                   	push   %rbp
+  802a0b:	48 89 e5             	mov    %rsp,%rbp
+  802a0e:	41 57                	push   %r15
+  802a10:	41 56                	push   %r14
+  802a12:	41 55                	push   %r13
+  802a14:	41 54                	push   %r12
+  802a16:	53                   	push   %rbx
+  802a17:	48 83 ec 28          	sub    $0x28,%rsp
+  802a1b:	49 89 fd             	mov    %rdi,%r13
+  802a1e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a22:	49 89 d4             	mov    %rdx,%r12
+  802a25:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a29:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802a30:	00 00 00 
+  802a33:	ff d0                	call   *%rax
+  802a35:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a38:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a3e:	49 bf 8d 28 80 00 00 	movabs $0x80288d,%r15
+  802a45:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a48:	4d 85 e4             	test   %r12,%r12
+  802a4b:	0f 84 d5 00 00 00    	je     802b26 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a51:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a55:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a59:	8b 03                	mov    (%rbx),%eax
+  802a5b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a5e:	75 7a                	jne    802ada <devpipe_read+0xd0>
+            if (i > 0) {
+  802a60:	4d 85 f6             	test   %r14,%r14
+  802a63:	75 50                	jne    802ab5 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a65:	48 89 de             	mov    %rbx,%rsi
+  802a68:	4c 89 ef             	mov    %r13,%rdi
+  802a6b:	41 ff d7             	call   *%r15
+  802a6e:	85 c0                	test   %eax,%eax
+  802a70:	0f 85 c9 00 00 00    	jne    802b3f <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a76:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a79:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a80:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a86:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a89:	41 39 c4             	cmp    %eax,%r12d
+  802a8c:	75 cb                	jne    802a59 <devpipe_read+0x4f>
+  802a8e:	48 89 de             	mov    %rbx,%rsi
+  802a91:	4c 89 ef             	mov    %r13,%rdi
+  802a94:	41 ff d7             	call   *%r15
+  802a97:	85 c0                	test   %eax,%eax
+  802a99:	75 be                	jne    802a59 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a9b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802aa0:	44 89 e6             	mov    %r12d,%esi
+  802aa3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802aa7:	48 b8 c5 05 80 00 00 	movabs $0x8005c5,%rax
+  802aae:	00 00 00 
+  802ab1:	ff d0                	call   *%rax
+  802ab3:	eb a4                	jmp    802a59 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802ab5:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802ab9:	48 89 de             	mov    %rbx,%rsi
+  802abc:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802ac3:	00 00 00 
+  802ac6:	ff d0                	call   *%rax
+                return i;
+  802ac8:	4c 89 f0             	mov    %r14,%rax
+}
+  802acb:	48 83 c4 28          	add    $0x28,%rsp
+  802acf:	5b                   	pop    %rbx
+  802ad0:	41 5c                	pop    %r12
+  802ad2:	41 5d                	pop    %r13
+  802ad4:	41 5e                	pop    %r14
+  802ad6:	41 5f                	pop    %r15
+  802ad8:	5d                   	pop    %rbp
+  802ad9:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ada:	48 63 c8             	movslq %eax,%rcx
+  802add:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ae4:	80 80 80 
+  802ae7:	48 89 c8             	mov    %rcx,%rax
+  802aea:	48 f7 e2             	mul    %rdx
+  802aed:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802af1:	48 89 d0             	mov    %rdx,%rax
+  802af4:	48 c1 e0 08          	shl    $0x8,%rax
+  802af8:	48 29 d0             	sub    %rdx,%rax
+  802afb:	48 c1 e0 04          	shl    $0x4,%rax
+  802aff:	48 89 c2             	mov    %rax,%rdx
+  802b02:	48 89 c8             	mov    %rcx,%rax
+  802b05:	48 29 d0             	sub    %rdx,%rax
+  802b08:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b0d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b11:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b15:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b18:	49 83 c6 01          	add    $0x1,%r14
+  802b1c:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b20:	0f 85 2b ff ff ff    	jne    802a51 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b26:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b2a:	48 89 de             	mov    %rbx,%rsi
+  802b2d:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802b34:	00 00 00 
+  802b37:	ff d0                	call   *%rax
+    return n;
+  802b39:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b3d:	eb 8c                	jmp    802acb <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b44:	eb 85                	jmp    802acb <devpipe_read+0xc1>
+
+0000000000802b46 <pipe>:
+pipe(int pfd[2]) {
+  802b46:	55                   	push   %rbp
+  802b47:	48 89 e5             	mov    %rsp,%rbp
+  802b4a:	41 55                	push   %r13
+  802b4c:	41 54                	push   %r12
+  802b4e:	53                   	push   %rbx
+  802b4f:	48 83 ec 18          	sub    $0x18,%rsp
+  802b53:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b56:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b5a:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  802b61:	00 00 00 
+  802b64:	ff d0                	call   *%rax
+  802b66:	89 c3                	mov    %eax,%ebx
+  802b68:	85 c0                	test   %eax,%eax
+  802b6a:	0f 88 a0 01 00 00    	js     802d10 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b70:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b7a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b83:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+  802b8f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b91:	85 c0                	test   %eax,%eax
+  802b93:	0f 88 77 01 00 00    	js     802d10 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b99:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b9d:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  802ba4:	00 00 00 
+  802ba7:	ff d0                	call   *%rax
+  802ba9:	89 c3                	mov    %eax,%ebx
+  802bab:	85 c0                	test   %eax,%eax
+  802bad:	0f 88 43 01 00 00    	js     802cf6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802bb3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bb8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bbd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bc1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc6:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  802bcd:	00 00 00 
+  802bd0:	ff d0                	call   *%rax
+  802bd2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bd4:	85 c0                	test   %eax,%eax
+  802bd6:	0f 88 1a 01 00 00    	js     802cf6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bdc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802be0:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+  802bec:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bf4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bf9:	48 89 c6             	mov    %rax,%rsi
+  802bfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c01:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  802c08:	00 00 00 
+  802c0b:	ff d0                	call   *%rax
+  802c0d:	89 c3                	mov    %eax,%ebx
+  802c0f:	85 c0                	test   %eax,%eax
+  802c11:	0f 88 c5 00 00 00    	js     802cdc <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c17:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c1b:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+  802c27:	48 89 c1             	mov    %rax,%rcx
+  802c2a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c30:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c3b:	4c 89 ee             	mov    %r13,%rsi
+  802c3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c43:	48 b8 ad 02 80 00 00 	movabs $0x8002ad,%rax
+  802c4a:	00 00 00 
+  802c4d:	ff d0                	call   *%rax
+  802c4f:	89 c3                	mov    %eax,%ebx
+  802c51:	85 c0                	test   %eax,%eax
+  802c53:	78 6e                	js     802cc3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c55:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c5a:	4c 89 ef             	mov    %r13,%rdi
+  802c5d:	48 b8 1c 02 80 00 00 	movabs $0x80021c,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+  802c69:	83 f8 02             	cmp    $0x2,%eax
+  802c6c:	0f 85 ab 00 00 00    	jne    802d1d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c72:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c79:	00 00 
+  802c7b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c7f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c81:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c85:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c8c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c90:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c96:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c9d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ca1:	48 bb 8a 06 80 00 00 	movabs $0x80068a,%rbx
+  802ca8:	00 00 00 
+  802cab:	ff d3                	call   *%rbx
+  802cad:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802cb1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cb5:	ff d3                	call   *%rbx
+  802cb7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802cbc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc1:	eb 4d                	jmp    802d10 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cc3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc8:	4c 89 ee             	mov    %r13,%rsi
+  802ccb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd0:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ce1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ce5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cea:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cf6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cfb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d04:	48 b8 fd 02 80 00 00 	movabs $0x8002fd,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+}
+  802d10:	89 d8                	mov    %ebx,%eax
+  802d12:	48 83 c4 18          	add    $0x18,%rsp
+  802d16:	5b                   	pop    %rbx
+  802d17:	41 5c                	pop    %r12
+  802d19:	41 5d                	pop    %r13
+  802d1b:	5d                   	pop    %rbp
+  802d1c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d1d:	48 b9 d0 47 80 00 00 	movabs $0x8047d0,%rcx
+  802d24:	00 00 00 
+  802d27:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  802d2e:	00 00 00 
+  802d31:	be 50 00 00 00       	mov    $0x50,%esi
+  802d36:	48 bf bc 47 80 00 00 	movabs $0x8047bc,%rdi
+  802d3d:	00 00 00 
+  802d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d45:	49 b8 75 33 80 00 00 	movabs $0x803375,%r8
+  802d4c:	00 00 00 
+  802d4f:	41 ff d0             	call   *%r8
+
+0000000000802d52 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d52:	55                   	push   %rbp
+  802d53:	48 89 e5             	mov    %rsp,%rbp
+  802d56:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d5a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d5e:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  802d65:	00 00 00 
+  802d68:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d6a:	85 c0                	test   %eax,%eax
+  802d6c:	78 23                	js     802d91 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d6e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d72:	48 b8 9c 06 80 00 00 	movabs $0x80069c,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+  802d7e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d81:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d85:	48 b8 8d 28 80 00 00 	movabs $0x80288d,%rax
+  802d8c:	00 00 00 
+  802d8f:	ff d0                	call   *%rax
+}
+  802d91:	c9                   	leave
+  802d92:	c3                   	ret
+
+0000000000802d93 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d93:	48 89 f8             	mov    %rdi,%rax
+  802d96:	48 c1 e8 27          	shr    $0x27,%rax
+  802d9a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802da1:	01 00 00 
+  802da4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da8:	f6 c2 01             	test   $0x1,%dl
+  802dab:	74 6d                	je     802e1a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802dad:	48 89 f8             	mov    %rdi,%rax
+  802db0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802db4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dbb:	01 00 00 
+  802dbe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dc2:	f6 c2 01             	test   $0x1,%dl
+  802dc5:	74 62                	je     802e29 <get_uvpt_entry+0x96>
+  802dc7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dce:	01 00 00 
+  802dd1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dd5:	f6 c2 80             	test   $0x80,%dl
+  802dd8:	75 4f                	jne    802e29 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dda:	48 89 f8             	mov    %rdi,%rax
+  802ddd:	48 c1 e8 15          	shr    $0x15,%rax
+  802de1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802de8:	01 00 00 
+  802deb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802def:	f6 c2 01             	test   $0x1,%dl
+  802df2:	74 44                	je     802e38 <get_uvpt_entry+0xa5>
+  802df4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dfb:	01 00 00 
+  802dfe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e02:	f6 c2 80             	test   $0x80,%dl
+  802e05:	75 31                	jne    802e38 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802e07:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e0b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e12:	01 00 00 
+  802e15:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e19:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e1a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e21:	01 00 00 
+  802e24:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e28:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e29:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e30:	01 00 00 
+  802e33:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e37:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e38:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e3f:	01 00 00 
+  802e42:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e46:	c3                   	ret
+
+0000000000802e47 <get_prot>:
+
+int
+get_prot(void *va) {
+  802e47:	55                   	push   %rbp
+  802e48:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e4b:	48 b8 93 2d 80 00 00 	movabs $0x802d93,%rax
+  802e52:	00 00 00 
+  802e55:	ff d0                	call   *%rax
+  802e57:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e5a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e5f:	89 c1                	mov    %eax,%ecx
+  802e61:	83 c9 04             	or     $0x4,%ecx
+  802e64:	f6 c2 01             	test   $0x1,%dl
+  802e67:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e6a:	89 c1                	mov    %eax,%ecx
+  802e6c:	83 c9 02             	or     $0x2,%ecx
+  802e6f:	f6 c2 02             	test   $0x2,%dl
+  802e72:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e75:	89 c1                	mov    %eax,%ecx
+  802e77:	83 c9 01             	or     $0x1,%ecx
+  802e7a:	48 85 d2             	test   %rdx,%rdx
+  802e7d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e80:	89 c1                	mov    %eax,%ecx
+  802e82:	83 c9 40             	or     $0x40,%ecx
+  802e85:	f6 c6 04             	test   $0x4,%dh
+  802e88:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e8b:	5d                   	pop    %rbp
+  802e8c:	c3                   	ret
+
+0000000000802e8d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e8d:	55                   	push   %rbp
+  802e8e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e91:	48 b8 93 2d 80 00 00 	movabs $0x802d93,%rax
+  802e98:	00 00 00 
+  802e9b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e9d:	48 c1 e8 06          	shr    $0x6,%rax
+  802ea1:	83 e0 01             	and    $0x1,%eax
+}
+  802ea4:	5d                   	pop    %rbp
+  802ea5:	c3                   	ret
+
+0000000000802ea6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ea6:	55                   	push   %rbp
+  802ea7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802eaa:	48 b8 93 2d 80 00 00 	movabs $0x802d93,%rax
+  802eb1:	00 00 00 
+  802eb4:	ff d0                	call   *%rax
+  802eb6:	83 e0 01             	and    $0x1,%eax
+}
+  802eb9:	5d                   	pop    %rbp
+  802eba:	c3                   	ret
+
+0000000000802ebb <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802ebb:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ec2:	01 00 00 
+  802ec5:	a8 01                	test   $0x1,%al
+  802ec7:	75 06                	jne    802ecf <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ec9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ece:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ecf:	55                   	push   %rbp
+  802ed0:	48 89 e5             	mov    %rsp,%rbp
+  802ed3:	41 57                	push   %r15
+  802ed5:	41 56                	push   %r14
+  802ed7:	41 55                	push   %r13
+  802ed9:	41 54                	push   %r12
+  802edb:	53                   	push   %rbx
+  802edc:	48 83 ec 28          	sub    $0x28,%rsp
+  802ee0:	49 89 fe             	mov    %rdi,%r14
+  802ee3:	49 89 f7             	mov    %rsi,%r15
+  802ee6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802eed:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802eee:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ef5:	01 00 00 
+  802ef8:	e9 ae 00 00 00       	jmp    802fab <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802efd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f04:	49 83 ec 01          	sub    $0x1,%r12
+  802f08:	74 2d                	je     802f37 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f0a:	48 89 d8             	mov    %rbx,%rax
+  802f0d:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f11:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f16:	f6 c2 01             	test   $0x1,%dl
+  802f19:	74 e2                	je     802efd <foreach_shared_region+0x42>
+  802f1b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f20:	f6 c4 04             	test   $0x4,%ah
+  802f23:	74 d8                	je     802efd <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f25:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f2c:	4c 89 fa             	mov    %r15,%rdx
+  802f2f:	48 89 df             	mov    %rbx,%rdi
+  802f32:	41 ff d6             	call   *%r14
+  802f35:	eb c6                	jmp    802efd <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f37:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f3e:	00 
+  802f3f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f44:	74 4a                	je     802f90 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f46:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f4a:	48 c1 e8 15          	shr    $0x15,%rax
+  802f4e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f55:	01 00 00 
+  802f58:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f5c:	a8 01                	test   $0x1,%al
+  802f5e:	74 d7                	je     802f37 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f60:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f64:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f6b:	48 39 c3             	cmp    %rax,%rbx
+  802f6e:	73 c7                	jae    802f37 <foreach_shared_region+0x7c>
+  802f70:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f77:	48 39 d0             	cmp    %rdx,%rax
+  802f7a:	4d 19 e4             	sbb    %r12,%r12
+  802f7d:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f84:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f8b:	e9 7a ff ff ff       	jmp    802f0a <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f90:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f97:	40 
+  802f98:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f9c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fa3:	00 00 00 
+  802fa6:	48 39 c1             	cmp    %rax,%rcx
+  802fa9:	74 50                	je     802ffb <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802fab:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802faf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fb3:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fba:	01 00 00 
+  802fbd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fc1:	a8 01                	test   $0x1,%al
+  802fc3:	74 cb                	je     802f90 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fc5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fc9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fd0:	48 39 c1             	cmp    %rax,%rcx
+  802fd3:	73 bb                	jae    802f90 <foreach_shared_region+0xd5>
+  802fd5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fdc:	48 39 d0             	cmp    %rdx,%rax
+  802fdf:	48 19 c0             	sbb    %rax,%rax
+  802fe2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fe8:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ff6:	e9 4b ff ff ff       	jmp    802f46 <foreach_shared_region+0x8b>
+  802ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803000:	48 83 c4 28          	add    $0x28,%rsp
+  803004:	5b                   	pop    %rbx
+  803005:	41 5c                	pop    %r12
+  803007:	41 5d                	pop    %r13
+  803009:	41 5e                	pop    %r14
+  80300b:	41 5f                	pop    %r15
+  80300d:	5d                   	pop    %rbp
+  80300e:	c3                   	ret
+
+000000000080300f <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80300f:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803015:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80301c:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803023:	c3                   	ret
+
+0000000000803024 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803024:	8b 47 40             	mov    0x40(%rdi),%eax
+  803027:	8b 17                	mov    (%rdi),%edx
+  803029:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80302b:	83 f8 0f             	cmp    $0xf,%eax
+  80302e:	77 13                	ja     803043 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803030:	8b 47 40             	mov    0x40(%rdi),%eax
+  803033:	83 e0 0f             	and    $0xf,%eax
+  803036:	48 c1 e0 09          	shl    $0x9,%rax
+  80303a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803041:	00 
+  803042:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803048:	c3                   	ret
+
+0000000000803049 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803049:	8b 47 40             	mov    0x40(%rdi),%eax
+  80304c:	83 c0 01             	add    $0x1,%eax
+  80304f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803052:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803058:	8b 57 04             	mov    0x4(%rdi),%edx
+  80305b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803060:	85 d2                	test   %edx,%edx
+  803062:	75 04                	jne    803068 <chan_publish+0x1f>
+  803064:	83 e0 01             	and    $0x1,%eax
+}
+  803067:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803068:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80306b:	85 c0                	test   %eax,%eax
+  80306d:	0f 95 c0             	setne  %al
+  803070:	0f b6 c0             	movzbl %al,%eax
+  803073:	eb ef                	jmp    803064 <chan_publish+0x1b>
+
+0000000000803075 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803075:	8b 47 40             	mov    0x40(%rdi),%eax
+  803078:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80307a:	29 d0                	sub    %edx,%eax
+  80307c:	83 e8 01             	sub    $0x1,%eax
+  80307f:	83 f8 0f             	cmp    $0xf,%eax
+  803082:	77 12                	ja     803096 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803084:	8b 07                	mov    (%rdi),%eax
+  803086:	83 e0 0f             	and    $0xf,%eax
+  803089:	48 c1 e0 09          	shl    $0x9,%rax
+  80308d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803094:	00 
+  803095:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309b:	c3                   	ret
+
+000000000080309c <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80309c:	8b 07                	mov    (%rdi),%eax
+  80309e:	83 c0 01             	add    $0x1,%eax
+  8030a1:	89 07                	mov    %eax,(%rdi)
+}
+  8030a3:	c3                   	ret
+
+00000000008030a4 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8030a4:	55                   	push   %rbp
+  8030a5:	48 89 e5             	mov    %rsp,%rbp
+  8030a8:	53                   	push   %rbx
+  8030a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8030ad:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8030b0:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030b7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030bd:	48 b8 75 30 80 00 00 	movabs $0x803075,%rax
+  8030c4:	00 00 00 
+  8030c7:	ff d0                	call   *%rax
+  8030c9:	48 85 c0             	test   %rax,%rax
+  8030cc:	74 12                	je     8030e0 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030ce:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030de:	c9                   	leave
+  8030df:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030e5:	eb f3                	jmp    8030da <chan_arm+0x36>
+
+00000000008030e7 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030e7:	55                   	push   %rbp
+  8030e8:	48 89 e5             	mov    %rsp,%rbp
+  8030eb:	41 56                	push   %r14
+  8030ed:	41 55                	push   %r13
+  8030ef:	41 54                	push   %r12
+  8030f1:	53                   	push   %rbx
+  8030f2:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030f5:	49 bc a4 30 80 00 00 	movabs $0x8030a4,%r12
+  8030fc:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030ff:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803103:	49 bd c5 05 80 00 00 	movabs $0x8005c5,%r13
+  80310a:	00 00 00 
+    while (chan_arm(r))
+  80310d:	eb 0d                	jmp    80311c <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80310f:	8b 33                	mov    (%rbx),%esi
+  803111:	ba 00 00 00 00       	mov    $0x0,%edx
+  803116:	4c 89 f7             	mov    %r14,%rdi
+  803119:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80311c:	48 89 df             	mov    %rbx,%rdi
+  80311f:	41 ff d4             	call   *%r12
+  803122:	84 c0                	test   %al,%al
+  803124:	75 e9                	jne    80310f <chan_wait+0x28>
+}
+  803126:	5b                   	pop    %rbx
+  803127:	41 5c                	pop    %r12
+  803129:	41 5d                	pop    %r13
+  80312b:	41 5e                	pop    %r14
+  80312d:	5d                   	pop    %rbp
+  80312e:	c3                   	ret
+
+000000000080312f <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80312f:	55                   	push   %rbp
+  803130:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803133:	48 83 c7 40          	add    $0x40,%rdi
+  803137:	be 01 00 00 00       	mov    $0x1,%esi
+  80313c:	48 b8 e3 05 80 00 00 	movabs $0x8005e3,%rax
+  803143:	00 00 00 
+  803146:	ff d0                	call   *%rax
+}
+  803148:	5d                   	pop    %rbp
+  803149:	c3                   	ret
+
+000000000080314a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80314a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314f:	c3                   	ret
+
+0000000000803150 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803150:	55                   	push   %rbp
+  803151:	48 89 e5             	mov    %rsp,%rbp
+  803154:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803157:	48 be f4 47 80 00 00 	movabs $0x8047f4,%rsi
+  80315e:	00 00 00 
+  803161:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+    return 0;
+}
+  80316d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803172:	5d                   	pop    %rbp
+  803173:	c3                   	ret
+
+0000000000803174 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803174:	55                   	push   %rbp
+  803175:	48 89 e5             	mov    %rsp,%rbp
+  803178:	41 57                	push   %r15
+  80317a:	41 56                	push   %r14
+  80317c:	41 55                	push   %r13
+  80317e:	41 54                	push   %r12
+  803180:	53                   	push   %rbx
+  803181:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803188:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80318f:	48 85 d2             	test   %rdx,%rdx
+  803192:	74 7a                	je     80320e <devcons_write+0x9a>
+  803194:	49 89 d6             	mov    %rdx,%r14
+  803197:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80319d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8031a2:	49 bf e4 3f 80 00 00 	movabs $0x803fe4,%r15
+  8031a9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031ac:	4c 89 f3             	mov    %r14,%rbx
+  8031af:	48 29 f3             	sub    %rsi,%rbx
+  8031b2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031b7:	48 39 c3             	cmp    %rax,%rbx
+  8031ba:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031be:	4c 63 eb             	movslq %ebx,%r13
+  8031c1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031c8:	48 01 c6             	add    %rax,%rsi
+  8031cb:	4c 89 ea             	mov    %r13,%rdx
+  8031ce:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031d5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031d8:	4c 89 ee             	mov    %r13,%rsi
+  8031db:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031e2:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  8031e9:	00 00 00 
+  8031ec:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031ee:	41 01 dc             	add    %ebx,%r12d
+  8031f1:	49 63 f4             	movslq %r12d,%rsi
+  8031f4:	4c 39 f6             	cmp    %r14,%rsi
+  8031f7:	72 b3                	jb     8031ac <devcons_write+0x38>
+    return res;
+  8031f9:	49 63 c4             	movslq %r12d,%rax
+}
+  8031fc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803203:	5b                   	pop    %rbx
+  803204:	41 5c                	pop    %r12
+  803206:	41 5d                	pop    %r13
+  803208:	41 5e                	pop    %r14
+  80320a:	41 5f                	pop    %r15
+  80320c:	5d                   	pop    %rbp
+  80320d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80320e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803214:	eb e3                	jmp    8031f9 <devcons_write+0x85>
+
+0000000000803216 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803216:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803219:	ba 00 00 00 00       	mov    $0x0,%edx
+  80321e:	48 85 c0             	test   %rax,%rax
+  803221:	74 55                	je     803278 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803223:	55                   	push   %rbp
+  803224:	48 89 e5             	mov    %rsp,%rbp
+  803227:	41 55                	push   %r13
+  803229:	41 54                	push   %r12
+  80322b:	53                   	push   %rbx
+  80322c:	48 83 ec 08          	sub    $0x8,%rsp
+  803230:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803233:	48 bb 3e 01 80 00 00 	movabs $0x80013e,%rbx
+  80323a:	00 00 00 
+  80323d:	49 bc f3 01 80 00 00 	movabs $0x8001f3,%r12
+  803244:	00 00 00 
+  803247:	eb 03                	jmp    80324c <devcons_read+0x36>
+  803249:	41 ff d4             	call   *%r12
+  80324c:	ff d3                	call   *%rbx
+  80324e:	85 c0                	test   %eax,%eax
+  803250:	74 f7                	je     803249 <devcons_read+0x33>
+    if (c < 0) return c;
+  803252:	48 63 d0             	movslq %eax,%rdx
+  803255:	78 13                	js     80326a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803257:	ba 00 00 00 00       	mov    $0x0,%edx
+  80325c:	83 f8 04             	cmp    $0x4,%eax
+  80325f:	74 09                	je     80326a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803261:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803265:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80326a:	48 89 d0             	mov    %rdx,%rax
+  80326d:	48 83 c4 08          	add    $0x8,%rsp
+  803271:	5b                   	pop    %rbx
+  803272:	41 5c                	pop    %r12
+  803274:	41 5d                	pop    %r13
+  803276:	5d                   	pop    %rbp
+  803277:	c3                   	ret
+  803278:	48 89 d0             	mov    %rdx,%rax
+  80327b:	c3                   	ret
+
+000000000080327c <cputchar>:
+cputchar(int ch) {
+  80327c:	55                   	push   %rbp
+  80327d:	48 89 e5             	mov    %rsp,%rbp
+  803280:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803284:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803288:	be 01 00 00 00       	mov    $0x1,%esi
+  80328d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803291:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  803298:	00 00 00 
+  80329b:	ff d0                	call   *%rax
+}
+  80329d:	c9                   	leave
+  80329e:	c3                   	ret
+
+000000000080329f <getchar>:
+getchar(void) {
+  80329f:	55                   	push   %rbp
+  8032a0:	48 89 e5             	mov    %rsp,%rbp
+  8032a3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032a7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032ac:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b5:	48 b8 fb 09 80 00 00 	movabs $0x8009fb,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+  8032c1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 06                	js     8032cd <getchar+0x2e>
+  8032c7:	74 08                	je     8032d1 <getchar+0x32>
+  8032c9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032cd:	89 d0                	mov    %edx,%eax
+  8032cf:	c9                   	leave
+  8032d0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032d1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032d6:	eb f5                	jmp    8032cd <getchar+0x2e>
+
+00000000008032d8 <iscons>:
+iscons(int fdnum) {
+  8032d8:	55                   	push   %rbp
+  8032d9:	48 89 e5             	mov    %rsp,%rbp
+  8032dc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032e0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032e4:	48 b8 18 07 80 00 00 	movabs $0x800718,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	78 18                	js     80330c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032f4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f8:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032ff:	00 00 00 
+  803302:	8b 00                	mov    (%rax),%eax
+  803304:	39 02                	cmp    %eax,(%rdx)
+  803306:	0f 94 c0             	sete   %al
+  803309:	0f b6 c0             	movzbl %al,%eax
+}
+  80330c:	c9                   	leave
+  80330d:	c3                   	ret
+
+000000000080330e <opencons>:
+opencons(void) {
+  80330e:	55                   	push   %rbp
+  80330f:	48 89 e5             	mov    %rsp,%rbp
+  803312:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803316:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80331a:	48 b8 b8 06 80 00 00 	movabs $0x8006b8,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+  803326:	85 c0                	test   %eax,%eax
+  803328:	78 49                	js     803373 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80332a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80332f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803334:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333d:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+  803349:	85 c0                	test   %eax,%eax
+  80334b:	78 26                	js     803373 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80334d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803351:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803358:	00 00 
+  80335a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80335c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803360:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803367:	48 b8 8a 06 80 00 00 	movabs $0x80068a,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+}
+  803373:	c9                   	leave
+  803374:	c3                   	ret
+
+0000000000803375 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803375:	55                   	push   %rbp
+  803376:	48 89 e5             	mov    %rsp,%rbp
+  803379:	41 56                	push   %r14
+  80337b:	41 55                	push   %r13
+  80337d:	41 54                	push   %r12
+  80337f:	53                   	push   %rbx
+  803380:	48 83 ec 50          	sub    $0x50,%rsp
+  803384:	49 89 fc             	mov    %rdi,%r12
+  803387:	41 89 f5             	mov    %esi,%r13d
+  80338a:	48 89 d3             	mov    %rdx,%rbx
+  80338d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803391:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803395:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803399:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8033a0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033a4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033a8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033ac:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033b0:	48 b8 08 50 80 00 00 	movabs $0x805008,%rax
+  8033b7:	00 00 00 
+  8033ba:	4c 8b 30             	mov    (%rax),%r14
+  8033bd:	48 b8 ca 01 80 00 00 	movabs $0x8001ca,%rax
+  8033c4:	00 00 00 
+  8033c7:	ff d0                	call   *%rax
+  8033c9:	89 c6                	mov    %eax,%esi
+  8033cb:	45 89 e8             	mov    %r13d,%r8d
+  8033ce:	4c 89 e1             	mov    %r12,%rcx
+  8033d1:	4c 89 f2             	mov    %r14,%rdx
+  8033d4:	48 bf 00 48 80 00 00 	movabs $0x804800,%rdi
+  8033db:	00 00 00 
+  8033de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e3:	49 bc c5 34 80 00 00 	movabs $0x8034c5,%r12
+  8033ea:	00 00 00 
+  8033ed:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033f0:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033f4:	48 89 df             	mov    %rbx,%rdi
+  8033f7:	48 b8 61 34 80 00 00 	movabs $0x803461,%rax
+  8033fe:	00 00 00 
+  803401:	ff d0                	call   *%rax
+    cprintf("\n");
+  803403:	48 bf b4 46 80 00 00 	movabs $0x8046b4,%rdi
+  80340a:	00 00 00 
+  80340d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803412:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803415:	cc                   	int3
+  803416:	eb fd                	jmp    803415 <_panic+0xa0>
+
+0000000000803418 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803418:	55                   	push   %rbp
+  803419:	48 89 e5             	mov    %rsp,%rbp
+  80341c:	53                   	push   %rbx
+  80341d:	48 83 ec 08          	sub    $0x8,%rsp
+  803421:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803424:	8b 06                	mov    (%rsi),%eax
+  803426:	8d 50 01             	lea    0x1(%rax),%edx
+  803429:	89 16                	mov    %edx,(%rsi)
+  80342b:	48 98                	cltq
+  80342d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803432:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803438:	74 0a                	je     803444 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80343a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80343e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803442:	c9                   	leave
+  803443:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803444:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803448:	be ff 00 00 00       	mov    $0xff,%esi
+  80344d:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  803454:	00 00 00 
+  803457:	ff d0                	call   *%rax
+        state->offset = 0;
+  803459:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80345f:	eb d9                	jmp    80343a <putch+0x22>
+
+0000000000803461 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803461:	55                   	push   %rbp
+  803462:	48 89 e5             	mov    %rsp,%rbp
+  803465:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80346c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80346f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803476:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80347b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803480:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803483:	48 89 f1             	mov    %rsi,%rcx
+  803486:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80348d:	48 bf 18 34 80 00 00 	movabs $0x803418,%rdi
+  803494:	00 00 00 
+  803497:	48 b8 15 36 80 00 00 	movabs $0x803615,%rax
+  80349e:	00 00 00 
+  8034a1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8034a3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034aa:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8034b1:	48 b8 1f 01 80 00 00 	movabs $0x80011f,%rax
+  8034b8:	00 00 00 
+  8034bb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034bd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034c3:	c9                   	leave
+  8034c4:	c3                   	ret
+
+00000000008034c5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034c5:	55                   	push   %rbp
+  8034c6:	48 89 e5             	mov    %rsp,%rbp
+  8034c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8034cd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034d1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034d9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034dd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034e1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034f0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034f8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034fc:	48 b8 61 34 80 00 00 	movabs $0x803461,%rax
+  803503:	00 00 00 
+  803506:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803508:	c9                   	leave
+  803509:	c3                   	ret
+
+000000000080350a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80350a:	55                   	push   %rbp
+  80350b:	48 89 e5             	mov    %rsp,%rbp
+  80350e:	41 57                	push   %r15
+  803510:	41 56                	push   %r14
+  803512:	41 55                	push   %r13
+  803514:	41 54                	push   %r12
+  803516:	53                   	push   %rbx
+  803517:	48 83 ec 18          	sub    $0x18,%rsp
+  80351b:	49 89 fc             	mov    %rdi,%r12
+  80351e:	49 89 f5             	mov    %rsi,%r13
+  803521:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803525:	8b 45 10             	mov    0x10(%rbp),%eax
+  803528:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80352b:	41 89 cf             	mov    %ecx,%r15d
+  80352e:	4c 39 fa             	cmp    %r15,%rdx
+  803531:	73 5b                	jae    80358e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803533:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803537:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80353b:	85 db                	test   %ebx,%ebx
+  80353d:	7e 0e                	jle    80354d <print_num+0x43>
+            putch(padc, put_arg);
+  80353f:	4c 89 ee             	mov    %r13,%rsi
+  803542:	44 89 f7             	mov    %r14d,%edi
+  803545:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803548:	83 eb 01             	sub    $0x1,%ebx
+  80354b:	75 f2                	jne    80353f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80354d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803551:	48 b9 34 48 80 00 00 	movabs $0x804834,%rcx
+  803558:	00 00 00 
+  80355b:	48 b8 23 48 80 00 00 	movabs $0x804823,%rax
+  803562:	00 00 00 
+  803565:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803569:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80356d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803572:	49 f7 f7             	div    %r15
+  803575:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803579:	4c 89 ee             	mov    %r13,%rsi
+  80357c:	41 ff d4             	call   *%r12
+}
+  80357f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803583:	5b                   	pop    %rbx
+  803584:	41 5c                	pop    %r12
+  803586:	41 5d                	pop    %r13
+  803588:	41 5e                	pop    %r14
+  80358a:	41 5f                	pop    %r15
+  80358c:	5d                   	pop    %rbp
+  80358d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80358e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803592:	ba 00 00 00 00       	mov    $0x0,%edx
+  803597:	49 f7 f7             	div    %r15
+  80359a:	48 83 ec 08          	sub    $0x8,%rsp
+  80359e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8035a2:	52                   	push   %rdx
+  8035a3:	45 0f be c9          	movsbl %r9b,%r9d
+  8035a7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035ab:	48 89 c2             	mov    %rax,%rdx
+  8035ae:	48 b8 0a 35 80 00 00 	movabs $0x80350a,%rax
+  8035b5:	00 00 00 
+  8035b8:	ff d0                	call   *%rax
+  8035ba:	48 83 c4 10          	add    $0x10,%rsp
+  8035be:	eb 8d                	jmp    80354d <print_num+0x43>
+
+00000000008035c0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035c0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035c4:	48 8b 06             	mov    (%rsi),%rax
+  8035c7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035cb:	73 0a                	jae    8035d7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8035cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035d1:	48 89 16             	mov    %rdx,(%rsi)
+  8035d4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035d7:	c3                   	ret
+
+00000000008035d8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035d8:	55                   	push   %rbp
+  8035d9:	48 89 e5             	mov    %rsp,%rbp
+  8035dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8035e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035ec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803603:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803607:	48 b8 15 36 80 00 00 	movabs $0x803615,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+}
+  803613:	c9                   	leave
+  803614:	c3                   	ret
+
+0000000000803615 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803615:	55                   	push   %rbp
+  803616:	48 89 e5             	mov    %rsp,%rbp
+  803619:	41 57                	push   %r15
+  80361b:	41 56                	push   %r14
+  80361d:	41 55                	push   %r13
+  80361f:	41 54                	push   %r12
+  803621:	53                   	push   %rbx
+  803622:	48 83 ec 38          	sub    $0x38,%rsp
+  803626:	49 89 fe             	mov    %rdi,%r14
+  803629:	49 89 f5             	mov    %rsi,%r13
+  80362c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80362f:	48 8b 01             	mov    (%rcx),%rax
+  803632:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803636:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80363a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80363e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803642:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803646:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80364a:	0f b6 3b             	movzbl (%rbx),%edi
+  80364d:	40 80 ff 25          	cmp    $0x25,%dil
+  803651:	74 18                	je     80366b <vprintfmt+0x56>
+            if (!ch) return;
+  803653:	40 84 ff             	test   %dil,%dil
+  803656:	0f 84 b1 06 00 00    	je     803d0d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80365c:	40 0f b6 ff          	movzbl %dil,%edi
+  803660:	4c 89 ee             	mov    %r13,%rsi
+  803663:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803666:	4c 89 e3             	mov    %r12,%rbx
+  803669:	eb db                	jmp    803646 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80366b:	be 00 00 00 00       	mov    $0x0,%esi
+  803670:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803674:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803679:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80367f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803686:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80368a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80368f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803694:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803697:	83 e8 23             	sub    $0x23,%eax
+  80369a:	3c 57                	cmp    $0x57,%al
+  80369c:	0f 87 51 06 00 00    	ja     803cf3 <vprintfmt+0x6de>
+  8036a2:	0f b6 c0             	movzbl %al,%eax
+  8036a5:	48 b9 e0 49 80 00 00 	movabs $0x8049e0,%rcx
+  8036ac:	00 00 00 
+  8036af:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8036b2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036b5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036b9:	eb cf                	jmp    80368a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036bb:	49 89 dc             	mov    %rbx,%r12
+  8036be:	be 01 00 00 00       	mov    $0x1,%esi
+  8036c3:	eb c5                	jmp    80368a <vprintfmt+0x75>
+            padc = ch;
+  8036c5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036c9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036cc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036cf:	eb b9                	jmp    80368a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8036d7:	77 24                	ja     8036fd <vprintfmt+0xe8>
+  8036d9:	89 c1                	mov    %eax,%ecx
+  8036db:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036df:	83 c0 08             	add    $0x8,%eax
+  8036e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036e5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036e8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036eb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036ef:	79 99                	jns    80368a <vprintfmt+0x75>
+                width = precision;
+  8036f1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036f5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036fb:	eb 8d                	jmp    80368a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036fd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803701:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803705:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803709:	eb da                	jmp    8036e5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80370b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803710:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803714:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80371a:	3c 39                	cmp    $0x39,%al
+  80371c:	77 1c                	ja     80373a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80371e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803722:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803726:	0f b6 c0             	movzbl %al,%eax
+  803729:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80372e:	0f b6 03             	movzbl (%rbx),%eax
+  803731:	3c 39                	cmp    $0x39,%al
+  803733:	76 e9                	jbe    80371e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803735:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803738:	eb b1                	jmp    8036eb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80373a:	49 89 dc             	mov    %rbx,%r12
+  80373d:	eb ac                	jmp    8036eb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80373f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803742:	85 c9                	test   %ecx,%ecx
+  803744:	b8 00 00 00 00       	mov    $0x0,%eax
+  803749:	0f 49 c1             	cmovns %ecx,%eax
+  80374c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80374f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803752:	e9 33 ff ff ff       	jmp    80368a <vprintfmt+0x75>
+            lflag++;
+  803757:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80375a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80375d:	e9 28 ff ff ff       	jmp    80368a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803762:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803765:	83 f8 2f             	cmp    $0x2f,%eax
+  803768:	77 19                	ja     803783 <vprintfmt+0x16e>
+  80376a:	89 c2                	mov    %eax,%edx
+  80376c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803770:	83 c0 08             	add    $0x8,%eax
+  803773:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803776:	8b 3a                	mov    (%rdx),%edi
+  803778:	4c 89 ee             	mov    %r13,%rsi
+  80377b:	41 ff d6             	call   *%r14
+            break;
+  80377e:	e9 c3 fe ff ff       	jmp    803646 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803783:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803787:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80378b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80378f:	eb e5                	jmp    803776 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803791:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803794:	83 f8 2f             	cmp    $0x2f,%eax
+  803797:	77 5a                	ja     8037f3 <vprintfmt+0x1de>
+  803799:	89 c2                	mov    %eax,%edx
+  80379b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80379f:	83 c0 08             	add    $0x8,%eax
+  8037a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8037a5:	8b 02                	mov    (%rdx),%eax
+  8037a7:	89 c1                	mov    %eax,%ecx
+  8037a9:	f7 d9                	neg    %ecx
+  8037ab:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8037ae:	83 f9 16             	cmp    $0x16,%ecx
+  8037b1:	7f 4e                	jg     803801 <vprintfmt+0x1ec>
+  8037b3:	48 63 c1             	movslq %ecx,%rax
+  8037b6:	48 ba a0 4c 80 00 00 	movabs $0x804ca0,%rdx
+  8037bd:	00 00 00 
+  8037c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037c4:	48 85 c0             	test   %rax,%rax
+  8037c7:	74 38                	je     803801 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037c9:	48 89 c1             	mov    %rax,%rcx
+  8037cc:	48 ba b9 47 80 00 00 	movabs $0x8047b9,%rdx
+  8037d3:	00 00 00 
+  8037d6:	4c 89 ee             	mov    %r13,%rsi
+  8037d9:	4c 89 f7             	mov    %r14,%rdi
+  8037dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e1:	49 b8 d8 35 80 00 00 	movabs $0x8035d8,%r8
+  8037e8:	00 00 00 
+  8037eb:	41 ff d0             	call   *%r8
+  8037ee:	e9 53 fe ff ff       	jmp    803646 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037ff:	eb a4                	jmp    8037a5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803801:	48 ba 4c 48 80 00 00 	movabs $0x80484c,%rdx
+  803808:	00 00 00 
+  80380b:	4c 89 ee             	mov    %r13,%rsi
+  80380e:	4c 89 f7             	mov    %r14,%rdi
+  803811:	b8 00 00 00 00       	mov    $0x0,%eax
+  803816:	49 b8 d8 35 80 00 00 	movabs $0x8035d8,%r8
+  80381d:	00 00 00 
+  803820:	41 ff d0             	call   *%r8
+  803823:	e9 1e fe ff ff       	jmp    803646 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803828:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80382b:	83 f8 2f             	cmp    $0x2f,%eax
+  80382e:	77 6c                	ja     80389c <vprintfmt+0x287>
+  803830:	89 c2                	mov    %eax,%edx
+  803832:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803836:	83 c0 08             	add    $0x8,%eax
+  803839:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80383c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80383f:	48 85 d2             	test   %rdx,%rdx
+  803842:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  803849:	00 00 00 
+  80384c:	48 0f 45 c2          	cmovne %rdx,%rax
+  803850:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803854:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803858:	7e 06                	jle    803860 <vprintfmt+0x24b>
+  80385a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80385e:	75 4a                	jne    8038aa <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803860:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803864:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803868:	0f b6 00             	movzbl (%rax),%eax
+  80386b:	84 c0                	test   %al,%al
+  80386d:	0f 85 9a 00 00 00    	jne    80390d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803873:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803876:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80387a:	85 c0                	test   %eax,%eax
+  80387c:	0f 8e c4 fd ff ff    	jle    803646 <vprintfmt+0x31>
+  803882:	4c 89 ee             	mov    %r13,%rsi
+  803885:	bf 20 00 00 00       	mov    $0x20,%edi
+  80388a:	41 ff d6             	call   *%r14
+  80388d:	41 83 ec 01          	sub    $0x1,%r12d
+  803891:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803895:	75 eb                	jne    803882 <vprintfmt+0x26d>
+  803897:	e9 aa fd ff ff       	jmp    803646 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80389c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a8:	eb 92                	jmp    80383c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038aa:	49 63 f7             	movslq %r15d,%rsi
+  8038ad:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8038b1:	48 b8 c7 3d 80 00 00 	movabs $0x803dc7,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	48 89 c2             	mov    %rax,%rdx
+  8038c0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038c5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038c8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	7e 91                	jle    803860 <vprintfmt+0x24b>
+  8038cf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038d4:	4c 89 ee             	mov    %r13,%rsi
+  8038d7:	44 89 e7             	mov    %r12d,%edi
+  8038da:	41 ff d6             	call   *%r14
+  8038dd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038e1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038e7:	75 eb                	jne    8038d4 <vprintfmt+0x2bf>
+  8038e9:	e9 72 ff ff ff       	jmp    803860 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038ee:	0f b6 f8             	movzbl %al,%edi
+  8038f1:	4c 89 ee             	mov    %r13,%rsi
+  8038f4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038f7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038fb:	49 83 c4 01          	add    $0x1,%r12
+  8038ff:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803905:	84 c0                	test   %al,%al
+  803907:	0f 84 66 ff ff ff    	je     803873 <vprintfmt+0x25e>
+  80390d:	45 85 ff             	test   %r15d,%r15d
+  803910:	78 0a                	js     80391c <vprintfmt+0x307>
+  803912:	41 83 ef 01          	sub    $0x1,%r15d
+  803916:	0f 88 57 ff ff ff    	js     803873 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80391c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803920:	74 cc                	je     8038ee <vprintfmt+0x2d9>
+  803922:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803925:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80392a:	80 fa 5e             	cmp    $0x5e,%dl
+  80392d:	77 c2                	ja     8038f1 <vprintfmt+0x2dc>
+  80392f:	eb bd                	jmp    8038ee <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803931:	40 84 f6             	test   %sil,%sil
+  803934:	75 26                	jne    80395c <vprintfmt+0x347>
+    switch (lflag) {
+  803936:	85 d2                	test   %edx,%edx
+  803938:	74 59                	je     803993 <vprintfmt+0x37e>
+  80393a:	83 fa 01             	cmp    $0x1,%edx
+  80393d:	74 7b                	je     8039ba <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80393f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803942:	83 f8 2f             	cmp    $0x2f,%eax
+  803945:	0f 87 96 00 00 00    	ja     8039e1 <vprintfmt+0x3cc>
+  80394b:	89 c2                	mov    %eax,%edx
+  80394d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803951:	83 c0 08             	add    $0x8,%eax
+  803954:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803957:	4c 8b 22             	mov    (%rdx),%r12
+  80395a:	eb 17                	jmp    803973 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80395c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80395f:	83 f8 2f             	cmp    $0x2f,%eax
+  803962:	77 21                	ja     803985 <vprintfmt+0x370>
+  803964:	89 c2                	mov    %eax,%edx
+  803966:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80396a:	83 c0 08             	add    $0x8,%eax
+  80396d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803970:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803973:	4d 85 e4             	test   %r12,%r12
+  803976:	78 7a                	js     8039f2 <vprintfmt+0x3dd>
+            num = i;
+  803978:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80397b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803980:	e9 50 02 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803985:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803989:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80398d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803991:	eb dd                	jmp    803970 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803993:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803996:	83 f8 2f             	cmp    $0x2f,%eax
+  803999:	77 11                	ja     8039ac <vprintfmt+0x397>
+  80399b:	89 c2                	mov    %eax,%edx
+  80399d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039a1:	83 c0 08             	add    $0x8,%eax
+  8039a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039a7:	4c 63 22             	movslq (%rdx),%r12
+  8039aa:	eb c7                	jmp    803973 <vprintfmt+0x35e>
+  8039ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b8:	eb ed                	jmp    8039a7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8039c0:	77 11                	ja     8039d3 <vprintfmt+0x3be>
+  8039c2:	89 c2                	mov    %eax,%edx
+  8039c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039c8:	83 c0 08             	add    $0x8,%eax
+  8039cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039ce:	4c 8b 22             	mov    (%rdx),%r12
+  8039d1:	eb a0                	jmp    803973 <vprintfmt+0x35e>
+  8039d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039df:	eb ed                	jmp    8039ce <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039ed:	e9 65 ff ff ff       	jmp    803957 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039f2:	4c 89 ee             	mov    %r13,%rsi
+  8039f5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039fa:	41 ff d6             	call   *%r14
+                i = -i;
+  8039fd:	49 f7 dc             	neg    %r12
+  803a00:	e9 73 ff ff ff       	jmp    803978 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803a05:	40 84 f6             	test   %sil,%sil
+  803a08:	75 32                	jne    803a3c <vprintfmt+0x427>
+    switch (lflag) {
+  803a0a:	85 d2                	test   %edx,%edx
+  803a0c:	74 5d                	je     803a6b <vprintfmt+0x456>
+  803a0e:	83 fa 01             	cmp    $0x1,%edx
+  803a11:	0f 84 82 00 00 00    	je     803a99 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a17:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a1a:	83 f8 2f             	cmp    $0x2f,%eax
+  803a1d:	0f 87 a5 00 00 00    	ja     803ac8 <vprintfmt+0x4b3>
+  803a23:	89 c2                	mov    %eax,%edx
+  803a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a29:	83 c0 08             	add    $0x8,%eax
+  803a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a2f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a37:	e9 99 01 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a3f:	83 f8 2f             	cmp    $0x2f,%eax
+  803a42:	77 19                	ja     803a5d <vprintfmt+0x448>
+  803a44:	89 c2                	mov    %eax,%edx
+  803a46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a4a:	83 c0 08             	add    $0x8,%eax
+  803a4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a50:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a53:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a58:	e9 78 01 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+  803a5d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a61:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a65:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a69:	eb e5                	jmp    803a50 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a6e:	83 f8 2f             	cmp    $0x2f,%eax
+  803a71:	77 18                	ja     803a8b <vprintfmt+0x476>
+  803a73:	89 c2                	mov    %eax,%edx
+  803a75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a79:	83 c0 08             	add    $0x8,%eax
+  803a7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a7f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a81:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a86:	e9 4a 01 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+  803a8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a97:	eb e6                	jmp    803a7f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a9c:	83 f8 2f             	cmp    $0x2f,%eax
+  803a9f:	77 19                	ja     803aba <vprintfmt+0x4a5>
+  803aa1:	89 c2                	mov    %eax,%edx
+  803aa3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803aa7:	83 c0 08             	add    $0x8,%eax
+  803aaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aad:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803ab0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803ab5:	e9 1b 01 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+  803aba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803abe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ac2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ac6:	eb e5                	jmp    803aad <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ac8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803acc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ad0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ad4:	e9 56 ff ff ff       	jmp    803a2f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ad9:	40 84 f6             	test   %sil,%sil
+  803adc:	75 2e                	jne    803b0c <vprintfmt+0x4f7>
+    switch (lflag) {
+  803ade:	85 d2                	test   %edx,%edx
+  803ae0:	74 59                	je     803b3b <vprintfmt+0x526>
+  803ae2:	83 fa 01             	cmp    $0x1,%edx
+  803ae5:	74 7f                	je     803b66 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803ae7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aea:	83 f8 2f             	cmp    $0x2f,%eax
+  803aed:	0f 87 9f 00 00 00    	ja     803b92 <vprintfmt+0x57d>
+  803af3:	89 c2                	mov    %eax,%edx
+  803af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803af9:	83 c0 08             	add    $0x8,%eax
+  803afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b02:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803b07:	e9 c9 00 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b0f:	83 f8 2f             	cmp    $0x2f,%eax
+  803b12:	77 19                	ja     803b2d <vprintfmt+0x518>
+  803b14:	89 c2                	mov    %eax,%edx
+  803b16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b1a:	83 c0 08             	add    $0x8,%eax
+  803b1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b23:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b28:	e9 a8 00 00 00       	jmp    803bd5 <vprintfmt+0x5c0>
+  803b2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b39:	eb e5                	jmp    803b20 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b3e:	83 f8 2f             	cmp    $0x2f,%eax
+  803b41:	77 15                	ja     803b58 <vprintfmt+0x543>
+  803b43:	89 c2                	mov    %eax,%edx
+  803b45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b49:	83 c0 08             	add    $0x8,%eax
+  803b4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b4f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b51:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b56:	eb 7d                	jmp    803bd5 <vprintfmt+0x5c0>
+  803b58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b64:	eb e9                	jmp    803b4f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b69:	83 f8 2f             	cmp    $0x2f,%eax
+  803b6c:	77 16                	ja     803b84 <vprintfmt+0x56f>
+  803b6e:	89 c2                	mov    %eax,%edx
+  803b70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b74:	83 c0 08             	add    $0x8,%eax
+  803b77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b7a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b7d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b82:	eb 51                	jmp    803bd5 <vprintfmt+0x5c0>
+  803b84:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b88:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b8c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b90:	eb e8                	jmp    803b7a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b9e:	e9 5c ff ff ff       	jmp    803aff <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803ba3:	4c 89 ee             	mov    %r13,%rsi
+  803ba6:	bf 30 00 00 00       	mov    $0x30,%edi
+  803bab:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803bae:	4c 89 ee             	mov    %r13,%rsi
+  803bb1:	bf 78 00 00 00       	mov    $0x78,%edi
+  803bb6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  803bbf:	77 47                	ja     803c08 <vprintfmt+0x5f3>
+  803bc1:	89 c2                	mov    %eax,%edx
+  803bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bc7:	83 c0 08             	add    $0x8,%eax
+  803bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bd0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bd5:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bdd:	0f 94 c0             	sete   %al
+  803be0:	0f b6 c0             	movzbl %al,%eax
+  803be3:	50                   	push   %rax
+  803be4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803be9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bed:	4c 89 ee             	mov    %r13,%rsi
+  803bf0:	4c 89 f7             	mov    %r14,%rdi
+  803bf3:	48 b8 0a 35 80 00 00 	movabs $0x80350a,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+            break;
+  803bff:	48 83 c4 10          	add    $0x10,%rsp
+  803c03:	e9 3e fa ff ff       	jmp    803646 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c14:	eb b7                	jmp    803bcd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c16:	40 84 f6             	test   %sil,%sil
+  803c19:	75 2b                	jne    803c46 <vprintfmt+0x631>
+    switch (lflag) {
+  803c1b:	85 d2                	test   %edx,%edx
+  803c1d:	74 56                	je     803c75 <vprintfmt+0x660>
+  803c1f:	83 fa 01             	cmp    $0x1,%edx
+  803c22:	74 7f                	je     803ca3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c27:	83 f8 2f             	cmp    $0x2f,%eax
+  803c2a:	0f 87 a2 00 00 00    	ja     803cd2 <vprintfmt+0x6bd>
+  803c30:	89 c2                	mov    %eax,%edx
+  803c32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c36:	83 c0 08             	add    $0x8,%eax
+  803c39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c44:	eb 8f                	jmp    803bd5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c49:	83 f8 2f             	cmp    $0x2f,%eax
+  803c4c:	77 19                	ja     803c67 <vprintfmt+0x652>
+  803c4e:	89 c2                	mov    %eax,%edx
+  803c50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c54:	83 c0 08             	add    $0x8,%eax
+  803c57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c62:	e9 6e ff ff ff       	jmp    803bd5 <vprintfmt+0x5c0>
+  803c67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c73:	eb e5                	jmp    803c5a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c78:	83 f8 2f             	cmp    $0x2f,%eax
+  803c7b:	77 18                	ja     803c95 <vprintfmt+0x680>
+  803c7d:	89 c2                	mov    %eax,%edx
+  803c7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c83:	83 c0 08             	add    $0x8,%eax
+  803c86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c89:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c8b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c90:	e9 40 ff ff ff       	jmp    803bd5 <vprintfmt+0x5c0>
+  803c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ca1:	eb e6                	jmp    803c89 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803ca3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  803ca9:	77 19                	ja     803cc4 <vprintfmt+0x6af>
+  803cab:	89 c2                	mov    %eax,%edx
+  803cad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cb1:	83 c0 08             	add    $0x8,%eax
+  803cb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cb7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803cba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803cbf:	e9 11 ff ff ff       	jmp    803bd5 <vprintfmt+0x5c0>
+  803cc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ccc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cd0:	eb e5                	jmp    803cb7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cde:	e9 59 ff ff ff       	jmp    803c3c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803ce3:	4c 89 ee             	mov    %r13,%rsi
+  803ce6:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ceb:	41 ff d6             	call   *%r14
+            break;
+  803cee:	e9 53 f9 ff ff       	jmp    803646 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cf3:	4c 89 ee             	mov    %r13,%rsi
+  803cf6:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cfb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803cfe:	48 83 eb 01          	sub    $0x1,%rbx
+  803d02:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803d06:	75 f6                	jne    803cfe <vprintfmt+0x6e9>
+  803d08:	e9 39 f9 ff ff       	jmp    803646 <vprintfmt+0x31>
+}
+  803d0d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d11:	5b                   	pop    %rbx
+  803d12:	41 5c                	pop    %r12
+  803d14:	41 5d                	pop    %r13
+  803d16:	41 5e                	pop    %r14
+  803d18:	41 5f                	pop    %r15
+  803d1a:	5d                   	pop    %rbp
+  803d1b:	c3                   	ret
+
+0000000000803d1c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d1c:	55                   	push   %rbp
+  803d1d:	48 89 e5             	mov    %rsp,%rbp
+  803d20:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d24:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d28:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d2d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d31:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d38:	48 85 ff             	test   %rdi,%rdi
+  803d3b:	74 2b                	je     803d68 <vsnprintf+0x4c>
+  803d3d:	48 85 f6             	test   %rsi,%rsi
+  803d40:	74 26                	je     803d68 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d42:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d46:	48 bf c0 35 80 00 00 	movabs $0x8035c0,%rdi
+  803d4d:	00 00 00 
+  803d50:	48 b8 15 36 80 00 00 	movabs $0x803615,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d60:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d63:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d66:	c9                   	leave
+  803d67:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d6d:	eb f7                	jmp    803d66 <vsnprintf+0x4a>
+
+0000000000803d6f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d6f:	55                   	push   %rbp
+  803d70:	48 89 e5             	mov    %rsp,%rbp
+  803d73:	48 83 ec 50          	sub    $0x50,%rsp
+  803d77:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d7b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d7f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d83:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d8a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d92:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d96:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d9a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d9e:	48 b8 1c 3d 80 00 00 	movabs $0x803d1c,%rax
+  803da5:	00 00 00 
+  803da8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803daa:	c9                   	leave
+  803dab:	c3                   	ret
+
+0000000000803dac <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803dac:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803daf:	74 10                	je     803dc1 <strlen+0x15>
+    size_t n = 0;
+  803db1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803db6:	48 83 c0 01          	add    $0x1,%rax
+  803dba:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803dbe:	75 f6                	jne    803db6 <strlen+0xa>
+  803dc0:	c3                   	ret
+    size_t n = 0;
+  803dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dc6:	c3                   	ret
+
+0000000000803dc7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803dc7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803dca:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dcf:	48 85 f6             	test   %rsi,%rsi
+  803dd2:	74 11                	je     803de5 <strnlen+0x1e>
+  803dd4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dd8:	74 0c                	je     803de6 <strnlen+0x1f>
+  803dda:	48 83 c2 01          	add    $0x1,%rdx
+  803dde:	48 39 d0             	cmp    %rdx,%rax
+  803de1:	75 f1                	jne    803dd4 <strnlen+0xd>
+  803de3:	eb 04                	jmp    803de9 <strnlen+0x22>
+  803de5:	c3                   	ret
+  803de6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803de9:	c3                   	ret
+
+0000000000803dea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dea:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803df6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803df9:	48 83 c2 01          	add    $0x1,%rdx
+  803dfd:	84 c9                	test   %cl,%cl
+  803dff:	75 f1                	jne    803df2 <strcpy+0x8>
+        ;
+    return res;
+}
+  803e01:	c3                   	ret
+
+0000000000803e02 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803e02:	55                   	push   %rbp
+  803e03:	48 89 e5             	mov    %rsp,%rbp
+  803e06:	41 54                	push   %r12
+  803e08:	53                   	push   %rbx
+  803e09:	48 89 fb             	mov    %rdi,%rbx
+  803e0c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e0f:	48 b8 ac 3d 80 00 00 	movabs $0x803dac,%rax
+  803e16:	00 00 00 
+  803e19:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e1b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e1f:	4c 89 e6             	mov    %r12,%rsi
+  803e22:	48 b8 ea 3d 80 00 00 	movabs $0x803dea,%rax
+  803e29:	00 00 00 
+  803e2c:	ff d0                	call   *%rax
+    return dst;
+}
+  803e2e:	48 89 d8             	mov    %rbx,%rax
+  803e31:	5b                   	pop    %rbx
+  803e32:	41 5c                	pop    %r12
+  803e34:	5d                   	pop    %rbp
+  803e35:	c3                   	ret
+
+0000000000803e36 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e36:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e39:	48 85 d2             	test   %rdx,%rdx
+  803e3c:	74 1f                	je     803e5d <strncpy+0x27>
+  803e3e:	48 01 fa             	add    %rdi,%rdx
+  803e41:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e44:	48 83 c1 01          	add    $0x1,%rcx
+  803e48:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e4c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e50:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e54:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e58:	48 39 ca             	cmp    %rcx,%rdx
+  803e5b:	75 e7                	jne    803e44 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e5d:	c3                   	ret
+
+0000000000803e5e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e5e:	48 89 f8             	mov    %rdi,%rax
+  803e61:	48 85 d2             	test   %rdx,%rdx
+  803e64:	74 24                	je     803e8a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e66:	48 83 ea 01          	sub    $0x1,%rdx
+  803e6a:	74 1b                	je     803e87 <strlcpy+0x29>
+  803e6c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e70:	0f b6 16             	movzbl (%rsi),%edx
+  803e73:	84 d2                	test   %dl,%dl
+  803e75:	74 10                	je     803e87 <strlcpy+0x29>
+            *dst++ = *src++;
+  803e77:	48 83 c6 01          	add    $0x1,%rsi
+  803e7b:	48 83 c0 01          	add    $0x1,%rax
+  803e7f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e82:	48 39 c8             	cmp    %rcx,%rax
+  803e85:	75 e9                	jne    803e70 <strlcpy+0x12>
+        *dst = '\0';
+  803e87:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e8a:	48 29 f8             	sub    %rdi,%rax
+}
+  803e8d:	c3                   	ret
+
+0000000000803e8e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e8e:	0f b6 07             	movzbl (%rdi),%eax
+  803e91:	84 c0                	test   %al,%al
+  803e93:	74 13                	je     803ea8 <strcmp+0x1a>
+  803e95:	38 06                	cmp    %al,(%rsi)
+  803e97:	75 0f                	jne    803ea8 <strcmp+0x1a>
+  803e99:	48 83 c7 01          	add    $0x1,%rdi
+  803e9d:	48 83 c6 01          	add    $0x1,%rsi
+  803ea1:	0f b6 07             	movzbl (%rdi),%eax
+  803ea4:	84 c0                	test   %al,%al
+  803ea6:	75 ed                	jne    803e95 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ea8:	0f b6 c0             	movzbl %al,%eax
+  803eab:	0f b6 16             	movzbl (%rsi),%edx
+  803eae:	29 d0                	sub    %edx,%eax
+}
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803eb1:	48 85 d2             	test   %rdx,%rdx
+  803eb4:	74 1f                	je     803ed5 <strncmp+0x24>
+  803eb6:	0f b6 07             	movzbl (%rdi),%eax
+  803eb9:	84 c0                	test   %al,%al
+  803ebb:	74 1e                	je     803edb <strncmp+0x2a>
+  803ebd:	3a 06                	cmp    (%rsi),%al
+  803ebf:	75 1a                	jne    803edb <strncmp+0x2a>
+  803ec1:	48 83 c7 01          	add    $0x1,%rdi
+  803ec5:	48 83 c6 01          	add    $0x1,%rsi
+  803ec9:	48 83 ea 01          	sub    $0x1,%rdx
+  803ecd:	75 e7                	jne    803eb6 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed4:	c3                   	ret
+  803ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eda:	c3                   	ret
+  803edb:	48 85 d2             	test   %rdx,%rdx
+  803ede:	74 09                	je     803ee9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ee0:	0f b6 07             	movzbl (%rdi),%eax
+  803ee3:	0f b6 16             	movzbl (%rsi),%edx
+  803ee6:	29 d0                	sub    %edx,%eax
+  803ee8:	c3                   	ret
+    if (!n) return 0;
+  803ee9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eee:	c3                   	ret
+
+0000000000803eef <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803eef:	0f b6 17             	movzbl (%rdi),%edx
+  803ef2:	84 d2                	test   %dl,%dl
+  803ef4:	74 18                	je     803f0e <strchr+0x1f>
+        if (*str == c) {
+  803ef6:	0f be d2             	movsbl %dl,%edx
+  803ef9:	39 f2                	cmp    %esi,%edx
+  803efb:	74 17                	je     803f14 <strchr+0x25>
+    for (; *str; str++) {
+  803efd:	48 83 c7 01          	add    $0x1,%rdi
+  803f01:	0f b6 17             	movzbl (%rdi),%edx
+  803f04:	84 d2                	test   %dl,%dl
+  803f06:	75 ee                	jne    803ef6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f08:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0d:	c3                   	ret
+  803f0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f13:	c3                   	ret
+  803f14:	48 89 f8             	mov    %rdi,%rax
+}
+  803f17:	c3                   	ret
+
+0000000000803f18 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f18:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f1b:	0f b6 17             	movzbl (%rdi),%edx
+  803f1e:	84 d2                	test   %dl,%dl
+  803f20:	74 13                	je     803f35 <strfind+0x1d>
+  803f22:	0f be d2             	movsbl %dl,%edx
+  803f25:	39 f2                	cmp    %esi,%edx
+  803f27:	74 0b                	je     803f34 <strfind+0x1c>
+  803f29:	48 83 c0 01          	add    $0x1,%rax
+  803f2d:	0f b6 10             	movzbl (%rax),%edx
+  803f30:	84 d2                	test   %dl,%dl
+  803f32:	75 ee                	jne    803f22 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f34:	c3                   	ret
+  803f35:	c3                   	ret
+
+0000000000803f36 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f36:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f39:	48 89 f8             	mov    %rdi,%rax
+  803f3c:	48 f7 d8             	neg    %rax
+  803f3f:	83 e0 07             	and    $0x7,%eax
+  803f42:	49 89 d1             	mov    %rdx,%r9
+  803f45:	49 29 c1             	sub    %rax,%r9
+  803f48:	78 36                	js     803f80 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f4a:	40 0f b6 c6          	movzbl %sil,%eax
+  803f4e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f55:	01 01 01 
+  803f58:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f5c:	40 f6 c7 07          	test   $0x7,%dil
+  803f60:	75 38                	jne    803f9a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f62:	4c 89 c9             	mov    %r9,%rcx
+  803f65:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f69:	74 0c                	je     803f77 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f6b:	fc                   	cld
+  803f6c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f6f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f73:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f77:	4d 85 c9             	test   %r9,%r9
+  803f7a:	75 45                	jne    803fc1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f7c:	4c 89 c0             	mov    %r8,%rax
+  803f7f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f80:	48 85 d2             	test   %rdx,%rdx
+  803f83:	74 f7                	je     803f7c <memset+0x46>
+  803f85:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f88:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f8b:	48 83 c0 01          	add    $0x1,%rax
+  803f8f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f93:	48 39 c2             	cmp    %rax,%rdx
+  803f96:	75 f3                	jne    803f8b <memset+0x55>
+  803f98:	eb e2                	jmp    803f7c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f9a:	40 f6 c7 01          	test   $0x1,%dil
+  803f9e:	74 06                	je     803fa6 <memset+0x70>
+  803fa0:	88 07                	mov    %al,(%rdi)
+  803fa2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fa6:	40 f6 c7 02          	test   $0x2,%dil
+  803faa:	74 07                	je     803fb3 <memset+0x7d>
+  803fac:	66 89 07             	mov    %ax,(%rdi)
+  803faf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fb3:	40 f6 c7 04          	test   $0x4,%dil
+  803fb7:	74 a9                	je     803f62 <memset+0x2c>
+  803fb9:	89 07                	mov    %eax,(%rdi)
+  803fbb:	48 83 c7 04          	add    $0x4,%rdi
+  803fbf:	eb a1                	jmp    803f62 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fc1:	41 f6 c1 04          	test   $0x4,%r9b
+  803fc5:	74 06                	je     803fcd <memset+0x97>
+  803fc7:	89 07                	mov    %eax,(%rdi)
+  803fc9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fcd:	41 f6 c1 02          	test   $0x2,%r9b
+  803fd1:	74 07                	je     803fda <memset+0xa4>
+  803fd3:	66 89 07             	mov    %ax,(%rdi)
+  803fd6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fda:	41 f6 c1 01          	test   $0x1,%r9b
+  803fde:	74 9c                	je     803f7c <memset+0x46>
+  803fe0:	88 07                	mov    %al,(%rdi)
+  803fe2:	eb 98                	jmp    803f7c <memset+0x46>
+
+0000000000803fe4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fe4:	48 89 f8             	mov    %rdi,%rax
+  803fe7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fea:	48 39 fe             	cmp    %rdi,%rsi
+  803fed:	73 3b                	jae    80402a <memmove+0x46>
+  803fef:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803ff3:	48 39 d7             	cmp    %rdx,%rdi
+  803ff6:	73 32                	jae    80402a <memmove+0x46>
+        s += n;
+        d += n;
+  803ff8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803ffc:	48 89 d6             	mov    %rdx,%rsi
+  803fff:	48 09 fe             	or     %rdi,%rsi
+  804002:	48 09 ce             	or     %rcx,%rsi
+  804005:	40 f6 c6 07          	test   $0x7,%sil
+  804009:	75 12                	jne    80401d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80400b:	48 83 ef 08          	sub    $0x8,%rdi
+  80400f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  804013:	48 c1 e9 03          	shr    $0x3,%rcx
+  804017:	fd                   	std
+  804018:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80401b:	fc                   	cld
+  80401c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80401d:	48 83 ef 01          	sub    $0x1,%rdi
+  804021:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804025:	fd                   	std
+  804026:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804028:	eb f1                	jmp    80401b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80402a:	48 89 f2             	mov    %rsi,%rdx
+  80402d:	48 09 c2             	or     %rax,%rdx
+  804030:	48 09 ca             	or     %rcx,%rdx
+  804033:	f6 c2 07             	test   $0x7,%dl
+  804036:	75 0c                	jne    804044 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804038:	48 c1 e9 03          	shr    $0x3,%rcx
+  80403c:	48 89 c7             	mov    %rax,%rdi
+  80403f:	fc                   	cld
+  804040:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804043:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804044:	48 89 c7             	mov    %rax,%rdi
+  804047:	fc                   	cld
+  804048:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80404a:	c3                   	ret
+
+000000000080404b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80404b:	55                   	push   %rbp
+  80404c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80404f:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  804056:	00 00 00 
+  804059:	ff d0                	call   *%rax
+}
+  80405b:	5d                   	pop    %rbp
+  80405c:	c3                   	ret
+
+000000000080405d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80405d:	55                   	push   %rbp
+  80405e:	48 89 e5             	mov    %rsp,%rbp
+  804061:	41 57                	push   %r15
+  804063:	41 56                	push   %r14
+  804065:	41 55                	push   %r13
+  804067:	41 54                	push   %r12
+  804069:	53                   	push   %rbx
+  80406a:	48 83 ec 08          	sub    $0x8,%rsp
+  80406e:	49 89 fe             	mov    %rdi,%r14
+  804071:	49 89 f7             	mov    %rsi,%r15
+  804074:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  804077:	48 89 f7             	mov    %rsi,%rdi
+  80407a:	48 b8 ac 3d 80 00 00 	movabs $0x803dac,%rax
+  804081:	00 00 00 
+  804084:	ff d0                	call   *%rax
+  804086:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804089:	48 89 de             	mov    %rbx,%rsi
+  80408c:	4c 89 f7             	mov    %r14,%rdi
+  80408f:	48 b8 c7 3d 80 00 00 	movabs $0x803dc7,%rax
+  804096:	00 00 00 
+  804099:	ff d0                	call   *%rax
+  80409b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80409e:	48 39 c3             	cmp    %rax,%rbx
+  8040a1:	74 36                	je     8040d9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8040a3:	48 89 d8             	mov    %rbx,%rax
+  8040a6:	4c 29 e8             	sub    %r13,%rax
+  8040a9:	49 39 c4             	cmp    %rax,%r12
+  8040ac:	73 31                	jae    8040df <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8040ae:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040b3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040b7:	4c 89 fe             	mov    %r15,%rsi
+  8040ba:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  8040c1:	00 00 00 
+  8040c4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040c6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040ca:	48 83 c4 08          	add    $0x8,%rsp
+  8040ce:	5b                   	pop    %rbx
+  8040cf:	41 5c                	pop    %r12
+  8040d1:	41 5d                	pop    %r13
+  8040d3:	41 5e                	pop    %r14
+  8040d5:	41 5f                	pop    %r15
+  8040d7:	5d                   	pop    %rbp
+  8040d8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040d9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040dd:	eb eb                	jmp    8040ca <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040df:	48 83 eb 01          	sub    $0x1,%rbx
+  8040e3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040e7:	48 89 da             	mov    %rbx,%rdx
+  8040ea:	4c 89 fe             	mov    %r15,%rsi
+  8040ed:	48 b8 4b 40 80 00 00 	movabs $0x80404b,%rax
+  8040f4:	00 00 00 
+  8040f7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040f9:	49 01 de             	add    %rbx,%r14
+  8040fc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  804101:	eb c3                	jmp    8040c6 <strlcat+0x69>
+
+0000000000804103 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  804103:	48 85 d2             	test   %rdx,%rdx
+  804106:	74 2d                	je     804135 <memcmp+0x32>
+  804108:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80410d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  804111:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  804116:	44 38 c1             	cmp    %r8b,%cl
+  804119:	75 0f                	jne    80412a <memcmp+0x27>
+    while (n-- > 0) {
+  80411b:	48 83 c0 01          	add    $0x1,%rax
+  80411f:	48 39 c2             	cmp    %rax,%rdx
+  804122:	75 e9                	jne    80410d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804124:	b8 00 00 00 00       	mov    $0x0,%eax
+  804129:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80412a:	0f b6 c1             	movzbl %cl,%eax
+  80412d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804131:	44 29 c0             	sub    %r8d,%eax
+  804134:	c3                   	ret
+    return 0;
+  804135:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80413a:	c3                   	ret
+
+000000000080413b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80413b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80413f:	48 39 c7             	cmp    %rax,%rdi
+  804142:	73 0f                	jae    804153 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804144:	40 38 37             	cmp    %sil,(%rdi)
+  804147:	74 0e                	je     804157 <memfind+0x1c>
+    for (; src < end; src++) {
+  804149:	48 83 c7 01          	add    $0x1,%rdi
+  80414d:	48 39 f8             	cmp    %rdi,%rax
+  804150:	75 f2                	jne    804144 <memfind+0x9>
+  804152:	c3                   	ret
+  804153:	48 89 f8             	mov    %rdi,%rax
+  804156:	c3                   	ret
+  804157:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80415a:	c3                   	ret
+
+000000000080415b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80415b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80415e:	0f b6 37             	movzbl (%rdi),%esi
+  804161:	40 80 fe 20          	cmp    $0x20,%sil
+  804165:	74 06                	je     80416d <strtol+0x12>
+  804167:	40 80 fe 09          	cmp    $0x9,%sil
+  80416b:	75 13                	jne    804180 <strtol+0x25>
+  80416d:	48 83 c7 01          	add    $0x1,%rdi
+  804171:	0f b6 37             	movzbl (%rdi),%esi
+  804174:	40 80 fe 20          	cmp    $0x20,%sil
+  804178:	74 f3                	je     80416d <strtol+0x12>
+  80417a:	40 80 fe 09          	cmp    $0x9,%sil
+  80417e:	74 ed                	je     80416d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  804180:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804183:	83 e0 fd             	and    $0xfffffffd,%eax
+  804186:	3c 01                	cmp    $0x1,%al
+  804188:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80418c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  804192:	75 0f                	jne    8041a3 <strtol+0x48>
+  804194:	80 3f 30             	cmpb   $0x30,(%rdi)
+  804197:	74 14                	je     8041ad <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804199:	85 d2                	test   %edx,%edx
+  80419b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8041a0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8041a3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041a8:	4c 63 ca             	movslq %edx,%r9
+  8041ab:	eb 36                	jmp    8041e3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041ad:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8041b1:	74 0f                	je     8041c2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041b3:	85 d2                	test   %edx,%edx
+  8041b5:	75 ec                	jne    8041a3 <strtol+0x48>
+        s++;
+  8041b7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041bb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041c0:	eb e1                	jmp    8041a3 <strtol+0x48>
+        s += 2;
+  8041c2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041c6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041cb:	eb d6                	jmp    8041a3 <strtol+0x48>
+            dig -= '0';
+  8041cd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041d0:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041d4:	41 39 d0             	cmp    %edx,%r8d
+  8041d7:	7d 21                	jge    8041fa <strtol+0x9f>
+        val = val * base + dig;
+  8041d9:	49 0f af c1          	imul   %r9,%rax
+  8041dd:	0f b6 c9             	movzbl %cl,%ecx
+  8041e0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041e3:	48 83 c7 01          	add    $0x1,%rdi
+  8041e7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041eb:	80 f9 39             	cmp    $0x39,%cl
+  8041ee:	76 dd                	jbe    8041cd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041f0:	80 f9 7b             	cmp    $0x7b,%cl
+  8041f3:	77 05                	ja     8041fa <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041f5:	83 e9 57             	sub    $0x57,%ecx
+  8041f8:	eb d6                	jmp    8041d0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041fa:	4d 85 d2             	test   %r10,%r10
+  8041fd:	74 03                	je     804202 <strtol+0xa7>
+  8041ff:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  804202:	48 89 c2             	mov    %rax,%rdx
+  804205:	48 f7 da             	neg    %rdx
+  804208:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80420c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804210:	c3                   	ret
+
+0000000000804211 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804211:	55                   	push   %rbp
+  804212:	48 89 e5             	mov    %rsp,%rbp
+  804215:	41 56                	push   %r14
+  804217:	41 55                	push   %r13
+  804219:	41 54                	push   %r12
+  80421b:	53                   	push   %rbx
+  80421c:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80421f:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804226:	00 00 00 
+  804229:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80422d:	74 27                	je     804256 <_handle_vectored_pagefault+0x45>
+  80422f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804234:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80423b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80423e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804241:	4c 89 e7             	mov    %r12,%rdi
+  804244:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804249:	84 c0                	test   %al,%al
+  80424b:	75 45                	jne    804292 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80424d:	48 83 c3 01          	add    $0x1,%rbx
+  804251:	49 3b 1e             	cmp    (%r14),%rbx
+  804254:	72 eb                	jb     804241 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804256:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80425d:	00 
+  80425e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804263:	4d 8b 04 24          	mov    (%r12),%r8
+  804267:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  80426e:	00 00 00 
+  804271:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804276:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  80427d:	00 00 00 
+  804280:	b8 00 00 00 00       	mov    $0x0,%eax
+  804285:	49 ba 75 33 80 00 00 	movabs $0x803375,%r10
+  80428c:	00 00 00 
+  80428f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804292:	5b                   	pop    %rbx
+  804293:	41 5c                	pop    %r12
+  804295:	41 5d                	pop    %r13
+  804297:	41 5e                	pop    %r14
+  804299:	5d                   	pop    %rbp
+  80429a:	c3                   	ret
+
+000000000080429b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80429b:	55                   	push   %rbp
+  80429c:	48 89 e5             	mov    %rsp,%rbp
+  80429f:	53                   	push   %rbx
+  8042a0:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a4:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042a7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042ae:	00 00 00 
+  8042b1:	80 38 00             	cmpb   $0x0,(%rax)
+  8042b4:	0f 84 84 00 00 00    	je     80433e <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ba:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042c1:	00 00 00 
+  8042c4:	48 8b 10             	mov    (%rax),%rdx
+  8042c7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042cc:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042d3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042d6:	48 85 d2             	test   %rdx,%rdx
+  8042d9:	74 19                	je     8042f4 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042db:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042df:	0f 84 e8 00 00 00    	je     8043cd <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e5:	48 83 c0 01          	add    $0x1,%rax
+  8042e9:	48 39 d0             	cmp    %rdx,%rax
+  8042ec:	75 ed                	jne    8042db <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042ee:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042f2:	74 1c                	je     804310 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042f4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042f8:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042ff:	00 00 00 
+  804302:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804309:	00 00 00 
+  80430c:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804310:	48 b8 ca 01 80 00 00 	movabs $0x8001ca,%rax
+  804317:	00 00 00 
+  80431a:	ff d0                	call   *%rax
+  80431c:	89 c7                	mov    %eax,%edi
+  80431e:	48 be 93 44 80 00 00 	movabs $0x804493,%rsi
+  804325:	00 00 00 
+  804328:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  80432f:	00 00 00 
+  804332:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804334:	85 c0                	test   %eax,%eax
+  804336:	78 68                	js     8043a0 <add_pgfault_handler+0x105>
+    return res;
+}
+  804338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80433c:	c9                   	leave
+  80433d:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80433e:	48 b8 ca 01 80 00 00 	movabs $0x8001ca,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+  80434a:	89 c7                	mov    %eax,%edi
+  80434c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804351:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804356:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80435d:	00 00 00 
+  804360:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  804367:	00 00 00 
+  80436a:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80436c:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804373:	00 00 00 
+  804376:	48 8b 02             	mov    (%rdx),%rax
+  804379:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80437d:	48 89 0a             	mov    %rcx,(%rdx)
+  804380:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804387:	00 00 00 
+  80438a:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80438e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804395:	00 00 00 
+  804398:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80439b:	e9 70 ff ff ff       	jmp    804310 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043a0:	89 c1                	mov    %eax,%ecx
+  8043a2:	48 ba b6 4d 80 00 00 	movabs $0x804db6,%rdx
+  8043a9:	00 00 00 
+  8043ac:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043b1:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  8043b8:	00 00 00 
+  8043bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c0:	49 b8 75 33 80 00 00 	movabs $0x803375,%r8
+  8043c7:	00 00 00 
+  8043ca:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d2:	e9 61 ff ff ff       	jmp    804338 <add_pgfault_handler+0x9d>
+
+00000000008043d7 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043d7:	55                   	push   %rbp
+  8043d8:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043db:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043e2:	00 00 00 
+  8043e5:	80 38 00             	cmpb   $0x0,(%rax)
+  8043e8:	74 33                	je     80441d <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043ea:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043f1:	00 00 00 
+  8043f4:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043f9:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804400:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804403:	48 85 c0             	test   %rax,%rax
+  804406:	0f 84 85 00 00 00    	je     804491 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80440c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804410:	74 40                	je     804452 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804412:	48 83 c1 01          	add    $0x1,%rcx
+  804416:	48 39 c1             	cmp    %rax,%rcx
+  804419:	75 f1                	jne    80440c <remove_pgfault_handler+0x35>
+  80441b:	eb 74                	jmp    804491 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80441d:	48 b9 ce 4d 80 00 00 	movabs $0x804dce,%rcx
+  804424:	00 00 00 
+  804427:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  80442e:	00 00 00 
+  804431:	be 43 00 00 00       	mov    $0x43,%esi
+  804436:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  80443d:	00 00 00 
+  804440:	b8 00 00 00 00       	mov    $0x0,%eax
+  804445:	49 b8 75 33 80 00 00 	movabs $0x803375,%r8
+  80444c:	00 00 00 
+  80444f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804452:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804459:	00 
+  80445a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80445e:	48 29 ca             	sub    %rcx,%rdx
+  804461:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804468:	00 00 00 
+  80446b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80446f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804474:	48 89 ce             	mov    %rcx,%rsi
+  804477:	48 b8 e4 3f 80 00 00 	movabs $0x803fe4,%rax
+  80447e:	00 00 00 
+  804481:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804483:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80448a:	00 00 00 
+  80448d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804491:	5d                   	pop    %rbp
+  804492:	c3                   	ret
+
+0000000000804493 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804493:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804496:	48 b8 11 42 80 00 00 	movabs $0x804211,%rax
+  80449d:	00 00 00 
+    call *%rax
+  8044a0:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044a2:	41 5f                	pop    %r15
+	popq %r15
+  8044a4:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044a6:	41 5f                	pop    %r15
+	popq %r14
+  8044a8:	41 5e                	pop    %r14
+	popq %r13
+  8044aa:	41 5d                	pop    %r13
+	popq %r12
+  8044ac:	41 5c                	pop    %r12
+	popq %r11
+  8044ae:	41 5b                	pop    %r11
+	popq %r10
+  8044b0:	41 5a                	pop    %r10
+	popq %r9
+  8044b2:	41 59                	pop    %r9
+	popq %r8
+  8044b4:	41 58                	pop    %r8
+	popq %rsi
+  8044b6:	5e                   	pop    %rsi
+	popq %rdi
+  8044b7:	5f                   	pop    %rdi
+	popq %rbp
+  8044b8:	5d                   	pop    %rbp
+	popq %rdx
+  8044b9:	5a                   	pop    %rdx
+	popq %rcx
+  8044ba:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044bb:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044c0:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044c5:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044c9:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044cc:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044d1:	5b                   	pop    %rbx
+	popq %rax
+  8044d2:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044d3:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044d7:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044d8:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044dd:	c3                   	ret
+
+00000000008044de <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044de:	55                   	push   %rbp
+  8044df:	48 89 e5             	mov    %rsp,%rbp
+  8044e2:	41 55                	push   %r13
+  8044e4:	41 54                	push   %r12
+  8044e6:	53                   	push   %rbx
+  8044e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8044eb:	49 89 fd             	mov    %rdi,%r13
+  8044ee:	48 89 f7             	mov    %rsi,%rdi
+  8044f1:	48 89 d3             	mov    %rdx,%rbx
+  8044f4:	49 89 cc             	mov    %rcx,%r12
+  8044f7:	4c 89 c2             	mov    %r8,%rdx
+  8044fa:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044fd:	48 85 f6             	test   %rsi,%rsi
+  804500:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804507:	00 00 00 
+  80450a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80450e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804513:	48 85 db             	test   %rbx,%rbx
+  804516:	74 03                	je     80451b <ipc_recv_futex+0x3d>
+  804518:	48 8b 33             	mov    (%rbx),%rsi
+  80451b:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80451f:	48 b8 a1 04 80 00 00 	movabs $0x8004a1,%rax
+  804526:	00 00 00 
+  804529:	ff d0                	call   *%rax
+    if (res < 0) {
+  80452b:	85 c0                	test   %eax,%eax
+  80452d:	78 75                	js     8045a4 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80452f:	4d 85 ed             	test   %r13,%r13
+  804532:	74 14                	je     804548 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804534:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80453b:	00 00 00 
+  80453e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804544:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804548:	4d 85 e4             	test   %r12,%r12
+  80454b:	74 14                	je     804561 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80454d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804554:	00 00 00 
+  804557:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80455d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804561:	48 85 db             	test   %rbx,%rbx
+  804564:	74 23                	je     804589 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804566:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80456d:	00 00 00 
+  804570:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804576:	ba 00 00 00 00       	mov    $0x0,%edx
+  80457b:	85 c9                	test   %ecx,%ecx
+  80457d:	74 07                	je     804586 <ipc_recv_futex+0xa8>
+  80457f:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804586:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804589:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804590:	00 00 00 
+  804593:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804599:	48 83 c4 08          	add    $0x8,%rsp
+  80459d:	5b                   	pop    %rbx
+  80459e:	41 5c                	pop    %r12
+  8045a0:	41 5d                	pop    %r13
+  8045a2:	5d                   	pop    %rbp
+  8045a3:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045a4:	4d 85 ed             	test   %r13,%r13
+  8045a7:	74 08                	je     8045b1 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045a9:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b0:	00 
+        if (perm_store != NULL) {
+  8045b1:	4d 85 e4             	test   %r12,%r12
+  8045b4:	74 08                	je     8045be <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045b6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045bd:	00 
+        if (size != NULL) {
+  8045be:	48 85 db             	test   %rbx,%rbx
+  8045c1:	74 d6                	je     804599 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045c3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045ca:	eb cd                	jmp    804599 <ipc_recv_futex+0xbb>
+
+00000000008045cc <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045cc:	55                   	push   %rbp
+  8045cd:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d4:	6a 00                	push   $0x0
+  8045d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045e2:	48 b8 de 44 80 00 00 	movabs $0x8044de,%rax
+  8045e9:	00 00 00 
+  8045ec:	ff d0                	call   *%rax
+}
+  8045ee:	c9                   	leave
+  8045ef:	c3                   	ret
+
+00000000008045f0 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f0:	55                   	push   %rbp
+  8045f1:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045f4:	48 85 d2             	test   %rdx,%rdx
+  8045f7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045fe:	00 00 00 
+  804601:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804605:	89 f6                	mov    %esi,%esi
+  804607:	48 b8 8a 04 80 00 00 	movabs $0x80048a,%rax
+  80460e:	00 00 00 
+  804611:	ff d0                	call   *%rax
+    if (res < 0) {
+  804613:	85 c0                	test   %eax,%eax
+  804615:	78 02                	js     804619 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804617:	5d                   	pop    %rbp
+  804618:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804619:	89 c1                	mov    %eax,%ecx
+  80461b:	48 ba e8 4d 80 00 00 	movabs $0x804de8,%rdx
+  804622:	00 00 00 
+  804625:	be 50 00 00 00       	mov    $0x50,%esi
+  80462a:	48 bf fc 4d 80 00 00 	movabs $0x804dfc,%rdi
+  804631:	00 00 00 
+  804634:	b8 00 00 00 00       	mov    $0x0,%eax
+  804639:	49 b8 75 33 80 00 00 	movabs $0x803375,%r8
+  804640:	00 00 00 
+  804643:	41 ff d0             	call   *%r8
+
+0000000000804646 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804646:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80464b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804652:	00 00 00 
+  804655:	48 89 d0             	mov    %rdx,%rax
+  804658:	48 c1 e0 04          	shl    $0x4,%rax
+  80465c:	48 29 d0             	sub    %rdx,%rax
+  80465f:	48 c1 e0 05          	shl    $0x5,%rax
+  804663:	48 01 c8             	add    %rcx,%rax
+  804666:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80466c:	39 f8                	cmp    %edi,%eax
+  80466e:	74 13                	je     804683 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804670:	48 83 c2 01          	add    $0x1,%rdx
+  804674:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80467b:	75 d8                	jne    804655 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80467d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804682:	c3                   	ret
+            return envs[i].env_id;
+  804683:	48 89 d0             	mov    %rdx,%rax
+  804686:	48 c1 e0 04          	shl    $0x4,%rax
+  80468a:	48 29 d0             	sub    %rdx,%rax
+  80468d:	48 c1 e0 05          	shl    $0x5,%rax
+  804691:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804698:	00 00 00 
+  80469b:	48 01 d0             	add    %rdx,%rax
+  80469e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046a4:	c3                   	ret
+  8046a5:	0f 1f 00             	nopl   (%rax)
+
+00000000008046a8 <__rodata_start>:
+  8046a8:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  8046ad:	2c 20                	sub    $0x20,%al
+  8046af:	77 6f                	ja     804720 <__rodata_start+0x78>
+  8046b1:	72 6c                	jb     80471f <__rodata_start+0x77>
+  8046b3:	64 0a 00             	or     %fs:(%rax),%al
+  8046b6:	3c 75                	cmp    $0x75,%al
+  8046b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046b9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046bd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046be:	3e 00 73 79          	ds add %dh,0x79(%rbx)
+  8046c2:	73 63                	jae    804727 <__rodata_start+0x7f>
+  8046c4:	61                   	(bad)
+  8046c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab47 <__bss_end+0x721c8b47>
+  8046cd:	65 74 75             	gs je  804745 <__rodata_start+0x9d>
+  8046d0:	72 6e                	jb     804740 <__rodata_start+0x98>
+  8046d2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab54 <__bss_end+0x281c8b54>
+  8046d9:	28 
+  8046da:	3e 20 30             	ds and %dh,(%rax)
+  8046dd:	29 00                	sub    %eax,(%rax)
+  8046df:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046e7:	61                   	(bad)
+  8046e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ea:	2e 63 00             	cs movsxd (%rax),%eax
+  8046ed:	0f 1f 00             	nopl   (%rax)
+  8046f0:	5b                   	pop    %rbx
+  8046f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046f6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046f9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046fe:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  804702:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  804709:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805174 <__ctors_end+0x94>
+  804710:	5b                   	pop    %rbx
+  804711:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804716:	20 66 74             	and    %ah,0x74(%rsi)
+  804719:	72 75                	jb     804790 <devtab+0x10>
+  80471b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80471f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad678a <__bss_end+0x2d29478a>
+  804726:	20 62 61             	and    %ah,0x61(%rdx)
+  804729:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80472d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804731:	5b                   	pop    %rbx
+  804732:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804737:	20 72 65             	and    %dh,0x65(%rdx)
+  80473a:	61                   	(bad)
+  80473b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad67a6 <__bss_end+0x2d2947a6>
+  804742:	20 62 61             	and    %ah,0x61(%rdx)
+  804745:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804749:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80474d:	5b                   	pop    %rbx
+  80474e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804753:	20 77 72             	and    %dh,0x72(%rdi)
+  804756:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80475d:	2d 
+  80475e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804763:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804766:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 90                	xchg   %ax,%ax
+
+0000000000804780 <devtab>:
+  804780:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804790:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8047b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8048a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8048b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8049a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8049b0:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049c0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049d0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049e0:	b2 36 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .6.......<......
+  8049f0:	e3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804a00:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	f3 3c 80 00 00 00 00 00 d1 36 80 00 00 00 00 00     .<.......6......
+  804a20:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804a30:	c5 36 80 00 00 00 00 00 3f 37 80 00 00 00 00 00     .6......?7......
+  804a40:	f3 3c 80 00 00 00 00 00 c5 36 80 00 00 00 00 00     .<.......6......
+  804a50:	0b 37 80 00 00 00 00 00 0b 37 80 00 00 00 00 00     .7.......7......
+  804a60:	0b 37 80 00 00 00 00 00 0b 37 80 00 00 00 00 00     .7.......7......
+  804a70:	0b 37 80 00 00 00 00 00 0b 37 80 00 00 00 00 00     .7.......7......
+  804a80:	0b 37 80 00 00 00 00 00 0b 37 80 00 00 00 00 00     .7.......7......
+  804a90:	0b 37 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .7.......<......
+  804aa0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b70:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	f3 3c 80 00 00 00 00 00 16 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804bd0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	62 37 80 00 00 00 00 00 31 39 80 00 00 00 00 00     b7......19......
+  804bf0:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804c00:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804c10:	91 37 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .7.......<......
+  804c20:	f3 3c 80 00 00 00 00 00 57 37 80 00 00 00 00 00     .<......W7......
+  804c30:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	d9 3a 80 00 00 00 00 00 a3 3b 80 00 00 00 00 00     .:.......;......
+  804c50:	f3 3c 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .<.......<......
+  804c60:	28 38 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     (8.......<......
+  804c70:	05 3a 80 00 00 00 00 00 f3 3c 80 00 00 00 00 00     .:.......<......
+  804c80:	f3 3c 80 00 00 00 00 00 16 3c 80 00 00 00 00 00     .<.......<......
+  804c90:	f3 3c 80 00 00 00 00 00 bb 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804ca0 <error_string>:
+	...
+  804ca8:	55 48 80 00 00 00 00 00 67 48 80 00 00 00 00 00     UH......gH......
+  804cb8:	77 48 80 00 00 00 00 00 89 48 80 00 00 00 00 00     wH.......H......
+  804cc8:	97 48 80 00 00 00 00 00 ab 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	c0 48 80 00 00 00 00 00 d3 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	e5 48 80 00 00 00 00 00 f9 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	09 49 80 00 00 00 00 00 1c 49 80 00 00 00 00 00     .I.......I......
+  804d08:	33 49 80 00 00 00 00 00 49 49 80 00 00 00 00 00     3I......II......
+  804d18:	61 49 80 00 00 00 00 00 79 49 80 00 00 00 00 00     aI......yI......
+  804d28:	86 49 80 00 00 00 00 00 58 4d 80 00 00 00 00 00     .I......XM......
+  804d38:	9a 49 80 00 00 00 00 00 b2 49 80 00 00 00 00 00     .I.......I......
+  804d48:	bc 49 80 00 00 00 00 00 c6 49 80 00 00 00 00 00     .I.......I......
+  804d58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d78:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d88:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d98:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804da8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804db8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804dc8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804dd8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804de8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804df8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
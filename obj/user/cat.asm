@@ -0,0 +1,8704 @@
+
+obj/user/cat:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 a6 01 00 00       	call   8001c9 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <cat>:
+#include <inc/lib.h>
+
+char buf[8192] __attribute__((aligned(PAGE_SIZE)));
+
+void
+cat(int f, char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 fd             	mov    %edi,%r13d
+  800039:	48 89 75 c8          	mov    %rsi,-0x38(%rbp)
+    long n;
+    int r;
+
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80003d:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  800044:	00 00 00 
+  800047:	49 be 17 1a 80 00 00 	movabs $0x801a17,%r14
+  80004e:	00 00 00 
+        if ((r = write(1, buf, n)) != n)
+  800051:	49 bf 46 1b 80 00 00 	movabs $0x801b46,%r15
+  800058:	00 00 00 
+    while ((n = read(f, buf, (long)sizeof(buf))) > 0)
+  80005b:	ba 00 20 00 00       	mov    $0x2000,%edx
+  800060:	4c 89 e6             	mov    %r12,%rsi
+  800063:	44 89 ef             	mov    %r13d,%edi
+  800066:	41 ff d6             	call   *%r14
+  800069:	48 89 c3             	mov    %rax,%rbx
+  80006c:	48 85 c0             	test   %rax,%rax
+  80006f:	7e 48                	jle    8000b9 <cat+0x94>
+        if ((r = write(1, buf, n)) != n)
+  800071:	48 89 da             	mov    %rbx,%rdx
+  800074:	4c 89 e6             	mov    %r12,%rsi
+  800077:	bf 01 00 00 00       	mov    $0x1,%edi
+  80007c:	41 ff d7             	call   *%r15
+  80007f:	48 63 d0             	movslq %eax,%rdx
+  800082:	48 39 da             	cmp    %rbx,%rdx
+  800085:	74 d4                	je     80005b <cat+0x36>
+            panic("write error copying %s: %i", s, r);
+  800087:	41 89 c0             	mov    %eax,%r8d
+  80008a:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80008e:	48 ba d0 49 80 00 00 	movabs $0x8049d0,%rdx
+  800095:	00 00 00 
+  800098:	be 0c 00 00 00       	mov    $0xc,%esi
+  80009d:	48 bf eb 49 80 00 00 	movabs $0x8049eb,%rdi
+  8000a4:	00 00 00 
+  8000a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ac:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8000b3:	00 00 00 
+  8000b6:	41 ff d1             	call   *%r9
+    if (n < 0)
+  8000b9:	78 0f                	js     8000ca <cat+0xa5>
+        panic("error reading %s: %i", s, (int)n);
+}
+  8000bb:	48 83 c4 18          	add    $0x18,%rsp
+  8000bf:	5b                   	pop    %rbx
+  8000c0:	41 5c                	pop    %r12
+  8000c2:	41 5d                	pop    %r13
+  8000c4:	41 5e                	pop    %r14
+  8000c6:	41 5f                	pop    %r15
+  8000c8:	5d                   	pop    %rbp
+  8000c9:	c3                   	ret
+        panic("error reading %s: %i", s, (int)n);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8000d1:	48 ba f6 49 80 00 00 	movabs $0x8049f6,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000e0:	48 bf eb 49 80 00 00 	movabs $0x8049eb,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+
+00000000008000fc <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000fc:	55                   	push   %rbp
+  8000fd:	48 89 e5             	mov    %rsp,%rbp
+  800100:	41 57                	push   %r15
+  800102:	41 56                	push   %r14
+  800104:	41 55                	push   %r13
+  800106:	41 54                	push   %r12
+  800108:	53                   	push   %rbx
+  800109:	48 83 ec 08          	sub    $0x8,%rsp
+    int f, i;
+
+    binaryname = "cat";
+  80010d:	48 b8 0b 4a 80 00 00 	movabs $0x804a0b,%rax
+  800114:	00 00 00 
+  800117:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80011e:	00 00 00 
+    if (argc == 1)
+  800121:	83 ff 01             	cmp    $0x1,%edi
+  800124:	74 24                	je     80014a <umain+0x4e>
+        cat(0, "<stdin>");
+    else
+        for (i = 1; i < argc; i++) {
+  800126:	7e 3d                	jle    800165 <umain+0x69>
+  800128:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  80012c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80012f:	4c 8d 74 c6 10       	lea    0x10(%rsi,%rax,8),%r14
+            f = open(argv[i], O_RDONLY);
+  800134:	49 bd f9 2e 80 00 00 	movabs $0x802ef9,%r13
+  80013b:	00 00 00 
+            if (f < 0)
+                printf("can't open %s: %i\n", argv[i], f);
+            else {
+                cat(f, argv[i]);
+  80013e:	49 bf 25 00 80 00 00 	movabs $0x800025,%r15
+  800145:	00 00 00 
+  800148:	eb 54                	jmp    80019e <umain+0xa2>
+        cat(0, "<stdin>");
+  80014a:	48 be 0f 4a 80 00 00 	movabs $0x804a0f,%rsi
+  800151:	00 00 00 
+  800154:	bf 00 00 00 00       	mov    $0x0,%edi
+  800159:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800160:	00 00 00 
+  800163:	ff d0                	call   *%rax
+                close(f);
+            }
+        }
+}
+  800165:	48 83 c4 08          	add    $0x8,%rsp
+  800169:	5b                   	pop    %rbx
+  80016a:	41 5c                	pop    %r12
+  80016c:	41 5d                	pop    %r13
+  80016e:	41 5e                	pop    %r14
+  800170:	41 5f                	pop    %r15
+  800172:	5d                   	pop    %rbp
+  800173:	c3                   	ret
+                printf("can't open %s: %i\n", argv[i], f);
+  800174:	49 8b 34 24          	mov    (%r12),%rsi
+  800178:	89 c2                	mov    %eax,%edx
+  80017a:	48 bf 17 4a 80 00 00 	movabs $0x804a17,%rdi
+  800181:	00 00 00 
+  800184:	b8 00 00 00 00       	mov    $0x0,%eax
+  800189:	48 b9 f7 38 80 00 00 	movabs $0x8038f7,%rcx
+  800190:	00 00 00 
+  800193:	ff d1                	call   *%rcx
+        for (i = 1; i < argc; i++) {
+  800195:	49 83 c4 08          	add    $0x8,%r12
+  800199:	4d 39 f4             	cmp    %r14,%r12
+  80019c:	74 c7                	je     800165 <umain+0x69>
+            f = open(argv[i], O_RDONLY);
+  80019e:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a2:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a7:	41 ff d5             	call   *%r13
+  8001aa:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ac:	85 c0                	test   %eax,%eax
+  8001ae:	78 c4                	js     800174 <umain+0x78>
+                cat(f, argv[i]);
+  8001b0:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b4:	89 c7                	mov    %eax,%edi
+  8001b6:	41 ff d7             	call   *%r15
+                close(f);
+  8001b9:	89 df                	mov    %ebx,%edi
+  8001bb:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+  8001c7:	eb cc                	jmp    800195 <umain+0x99>
+
+00000000008001c9 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001c9:	55                   	push   %rbp
+  8001ca:	48 89 e5             	mov    %rsp,%rbp
+  8001cd:	41 56                	push   %r14
+  8001cf:	41 55                	push   %r13
+  8001d1:	41 54                	push   %r12
+  8001d3:	53                   	push   %rbx
+  8001d4:	41 89 fd             	mov    %edi,%r13d
+  8001d7:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001da:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8001e1:	00 00 00 
+  8001e4:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8001eb:	00 00 00 
+  8001ee:	48 39 c2             	cmp    %rax,%rdx
+  8001f1:	73 17                	jae    80020a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001f3:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001f6:	49 89 c4             	mov    %rax,%r12
+  8001f9:	48 83 c3 08          	add    $0x8,%rbx
+  8001fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800202:	ff 53 f8             	call   *-0x8(%rbx)
+  800205:	4c 39 e3             	cmp    %r12,%rbx
+  800208:	72 ef                	jb     8001f9 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80020a:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+  800216:	89 c2                	mov    %eax,%edx
+  800218:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80021e:	48 89 d0             	mov    %rdx,%rax
+  800221:	48 c1 e0 04          	shl    $0x4,%rax
+  800225:	48 29 d0             	sub    %rdx,%rax
+  800228:	48 c1 e0 05          	shl    $0x5,%rax
+  80022c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800233:	00 00 00 
+  800236:	48 01 d0             	add    %rdx,%rax
+  800239:	48 a3 00 20 81 00 00 	movabs %rax,0x812000
+  800240:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800243:	45 85 ed             	test   %r13d,%r13d
+  800246:	7e 0d                	jle    800255 <libmain+0x8c>
+  800248:	49 8b 06             	mov    (%r14),%rax
+  80024b:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800252:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800255:	4c 89 f6             	mov    %r14,%rsi
+  800258:	44 89 ef             	mov    %r13d,%edi
+  80025b:	48 b8 fc 00 80 00 00 	movabs $0x8000fc,%rax
+  800262:	00 00 00 
+  800265:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800267:	48 b8 7c 02 80 00 00 	movabs $0x80027c,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+#endif
+}
+  800273:	5b                   	pop    %rbx
+  800274:	41 5c                	pop    %r12
+  800276:	41 5d                	pop    %r13
+  800278:	41 5e                	pop    %r14
+  80027a:	5d                   	pop    %rbp
+  80027b:	c3                   	ret
+
+000000000080027c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80027c:	55                   	push   %rbp
+  80027d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800280:	48 b8 cc 18 80 00 00 	movabs $0x8018cc,%rax
+  800287:	00 00 00 
+  80028a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80028c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800291:	48 b8 83 11 80 00 00 	movabs $0x801183,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+}
+  80029d:	5d                   	pop    %rbp
+  80029e:	c3                   	ret
+
+000000000080029f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80029f:	55                   	push   %rbp
+  8002a0:	48 89 e5             	mov    %rsp,%rbp
+  8002a3:	41 56                	push   %r14
+  8002a5:	41 55                	push   %r13
+  8002a7:	41 54                	push   %r12
+  8002a9:	53                   	push   %rbx
+  8002aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ae:	49 89 fc             	mov    %rdi,%r12
+  8002b1:	41 89 f5             	mov    %esi,%r13d
+  8002b4:	48 89 d3             	mov    %rdx,%rbx
+  8002b7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002bb:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002bf:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002c3:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002ca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ce:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002d2:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002d6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002da:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002e1:	00 00 00 
+  8002e4:	4c 8b 30             	mov    (%rax),%r14
+  8002e7:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	89 c6                	mov    %eax,%esi
+  8002f5:	45 89 e8             	mov    %r13d,%r8d
+  8002f8:	4c 89 e1             	mov    %r12,%rcx
+  8002fb:	4c 89 f2             	mov    %r14,%rdx
+  8002fe:	48 bf 38 4a 80 00 00 	movabs $0x804a38,%rdi
+  800305:	00 00 00 
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	49 bc ef 03 80 00 00 	movabs $0x8003ef,%r12
+  800314:	00 00 00 
+  800317:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80031a:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80031e:	48 89 df             	mov    %rbx,%rdi
+  800321:	48 b8 8b 03 80 00 00 	movabs $0x80038b,%rax
+  800328:	00 00 00 
+  80032b:	ff d0                	call   *%rax
+    cprintf("\n");
+  80032d:	48 bf 43 50 80 00 00 	movabs $0x805043,%rdi
+  800334:	00 00 00 
+  800337:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033c:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80033f:	cc                   	int3
+  800340:	eb fd                	jmp    80033f <_panic+0xa0>
+
+0000000000800342 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800342:	55                   	push   %rbp
+  800343:	48 89 e5             	mov    %rsp,%rbp
+  800346:	53                   	push   %rbx
+  800347:	48 83 ec 08          	sub    $0x8,%rsp
+  80034b:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80034e:	8b 06                	mov    (%rsi),%eax
+  800350:	8d 50 01             	lea    0x1(%rax),%edx
+  800353:	89 16                	mov    %edx,(%rsi)
+  800355:	48 98                	cltq
+  800357:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80035c:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800362:	74 0a                	je     80036e <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800364:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80036c:	c9                   	leave
+  80036d:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80036e:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800372:	be ff 00 00 00       	mov    $0xff,%esi
+  800377:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  80037e:	00 00 00 
+  800381:	ff d0                	call   *%rax
+        state->offset = 0;
+  800383:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800389:	eb d9                	jmp    800364 <putch+0x22>
+
+000000000080038b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80038b:	55                   	push   %rbp
+  80038c:	48 89 e5             	mov    %rsp,%rbp
+  80038f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800396:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800399:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003a0:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003aa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003ad:	48 89 f1             	mov    %rsi,%rcx
+  8003b0:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003b7:	48 bf 42 03 80 00 00 	movabs $0x800342,%rdi
+  8003be:	00 00 00 
+  8003c1:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  8003c8:	00 00 00 
+  8003cb:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003cd:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003d4:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003db:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8003e2:	00 00 00 
+  8003e5:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003e7:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003ed:	c9                   	leave
+  8003ee:	c3                   	ret
+
+00000000008003ef <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003ef:	55                   	push   %rbp
+  8003f0:	48 89 e5             	mov    %rsp,%rbp
+  8003f3:	48 83 ec 50          	sub    $0x50,%rsp
+  8003f7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003fb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800403:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800407:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80040b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800412:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800416:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80041e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800422:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800426:	48 b8 8b 03 80 00 00 	movabs $0x80038b,%rax
+  80042d:	00 00 00 
+  800430:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800432:	c9                   	leave
+  800433:	c3                   	ret
+
+0000000000800434 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800434:	55                   	push   %rbp
+  800435:	48 89 e5             	mov    %rsp,%rbp
+  800438:	41 57                	push   %r15
+  80043a:	41 56                	push   %r14
+  80043c:	41 55                	push   %r13
+  80043e:	41 54                	push   %r12
+  800440:	53                   	push   %rbx
+  800441:	48 83 ec 18          	sub    $0x18,%rsp
+  800445:	49 89 fc             	mov    %rdi,%r12
+  800448:	49 89 f5             	mov    %rsi,%r13
+  80044b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80044f:	8b 45 10             	mov    0x10(%rbp),%eax
+  800452:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800455:	41 89 cf             	mov    %ecx,%r15d
+  800458:	4c 39 fa             	cmp    %r15,%rdx
+  80045b:	73 5b                	jae    8004b8 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80045d:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800461:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800465:	85 db                	test   %ebx,%ebx
+  800467:	7e 0e                	jle    800477 <print_num+0x43>
+            putch(padc, put_arg);
+  800469:	4c 89 ee             	mov    %r13,%rsi
+  80046c:	44 89 f7             	mov    %r14d,%edi
+  80046f:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800472:	83 eb 01             	sub    $0x1,%ebx
+  800475:	75 f2                	jne    800469 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800477:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80047b:	48 b9 6c 4a 80 00 00 	movabs $0x804a6c,%rcx
+  800482:	00 00 00 
+  800485:	48 b8 5b 4a 80 00 00 	movabs $0x804a5b,%rax
+  80048c:	00 00 00 
+  80048f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800493:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80049c:	49 f7 f7             	div    %r15
+  80049f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004a3:	4c 89 ee             	mov    %r13,%rsi
+  8004a6:	41 ff d4             	call   *%r12
+}
+  8004a9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004ad:	5b                   	pop    %rbx
+  8004ae:	41 5c                	pop    %r12
+  8004b0:	41 5d                	pop    %r13
+  8004b2:	41 5e                	pop    %r14
+  8004b4:	41 5f                	pop    %r15
+  8004b6:	5d                   	pop    %rbp
+  8004b7:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004c1:	49 f7 f7             	div    %r15
+  8004c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8004c8:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004cc:	52                   	push   %rdx
+  8004cd:	45 0f be c9          	movsbl %r9b,%r9d
+  8004d1:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004d5:	48 89 c2             	mov    %rax,%rdx
+  8004d8:	48 b8 34 04 80 00 00 	movabs $0x800434,%rax
+  8004df:	00 00 00 
+  8004e2:	ff d0                	call   *%rax
+  8004e4:	48 83 c4 10          	add    $0x10,%rsp
+  8004e8:	eb 8d                	jmp    800477 <print_num+0x43>
+
+00000000008004ea <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004ea:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004ee:	48 8b 06             	mov    (%rsi),%rax
+  8004f1:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004f5:	73 0a                	jae    800501 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004f7:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004fb:	48 89 16             	mov    %rdx,(%rsi)
+  8004fe:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800501:	c3                   	ret
+
+0000000000800502 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800502:	55                   	push   %rbp
+  800503:	48 89 e5             	mov    %rsp,%rbp
+  800506:	48 83 ec 50          	sub    $0x50,%rsp
+  80050a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80050e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800512:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800516:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80051d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800521:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800525:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800529:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80052d:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800531:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  800538:	00 00 00 
+  80053b:	ff d0                	call   *%rax
+}
+  80053d:	c9                   	leave
+  80053e:	c3                   	ret
+
+000000000080053f <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80053f:	55                   	push   %rbp
+  800540:	48 89 e5             	mov    %rsp,%rbp
+  800543:	41 57                	push   %r15
+  800545:	41 56                	push   %r14
+  800547:	41 55                	push   %r13
+  800549:	41 54                	push   %r12
+  80054b:	53                   	push   %rbx
+  80054c:	48 83 ec 38          	sub    $0x38,%rsp
+  800550:	49 89 fe             	mov    %rdi,%r14
+  800553:	49 89 f5             	mov    %rsi,%r13
+  800556:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800559:	48 8b 01             	mov    (%rcx),%rax
+  80055c:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800560:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800564:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800568:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80056c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800570:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800574:	0f b6 3b             	movzbl (%rbx),%edi
+  800577:	40 80 ff 25          	cmp    $0x25,%dil
+  80057b:	74 18                	je     800595 <vprintfmt+0x56>
+            if (!ch) return;
+  80057d:	40 84 ff             	test   %dil,%dil
+  800580:	0f 84 b1 06 00 00    	je     800c37 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800586:	40 0f b6 ff          	movzbl %dil,%edi
+  80058a:	4c 89 ee             	mov    %r13,%rsi
+  80058d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800590:	4c 89 e3             	mov    %r12,%rbx
+  800593:	eb db                	jmp    800570 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800595:	be 00 00 00 00       	mov    $0x0,%esi
+  80059a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80059e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005a3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005a9:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005b0:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b4:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005b9:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005be:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005c1:	83 e8 23             	sub    $0x23,%eax
+  8005c4:	3c 57                	cmp    $0x57,%al
+  8005c6:	0f 87 51 06 00 00    	ja     800c1d <vprintfmt+0x6de>
+  8005cc:	0f b6 c0             	movzbl %al,%eax
+  8005cf:	48 b9 20 4c 80 00 00 	movabs $0x804c20,%rcx
+  8005d6:	00 00 00 
+  8005d9:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005dc:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005df:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005e3:	eb cf                	jmp    8005b4 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005e5:	49 89 dc             	mov    %rbx,%r12
+  8005e8:	be 01 00 00 00       	mov    $0x1,%esi
+  8005ed:	eb c5                	jmp    8005b4 <vprintfmt+0x75>
+            padc = ch;
+  8005ef:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005f3:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005f6:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005f9:	eb b9                	jmp    8005b4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800601:	77 24                	ja     800627 <vprintfmt+0xe8>
+  800603:	89 c1                	mov    %eax,%ecx
+  800605:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800609:	83 c0 08             	add    $0x8,%eax
+  80060c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80060f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800612:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800615:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800619:	79 99                	jns    8005b4 <vprintfmt+0x75>
+                width = precision;
+  80061b:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80061f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800625:	eb 8d                	jmp    8005b4 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800627:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80062b:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80062f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800633:	eb da                	jmp    80060f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800635:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80063a:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80063e:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800644:	3c 39                	cmp    $0x39,%al
+  800646:	77 1c                	ja     800664 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800648:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80064c:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800650:	0f b6 c0             	movzbl %al,%eax
+  800653:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800658:	0f b6 03             	movzbl (%rbx),%eax
+  80065b:	3c 39                	cmp    $0x39,%al
+  80065d:	76 e9                	jbe    800648 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80065f:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800662:	eb b1                	jmp    800615 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800664:	49 89 dc             	mov    %rbx,%r12
+  800667:	eb ac                	jmp    800615 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800669:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80066c:	85 c9                	test   %ecx,%ecx
+  80066e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800673:	0f 49 c1             	cmovns %ecx,%eax
+  800676:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800679:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80067c:	e9 33 ff ff ff       	jmp    8005b4 <vprintfmt+0x75>
+            lflag++;
+  800681:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800684:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800687:	e9 28 ff ff ff       	jmp    8005b4 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80068c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068f:	83 f8 2f             	cmp    $0x2f,%eax
+  800692:	77 19                	ja     8006ad <vprintfmt+0x16e>
+  800694:	89 c2                	mov    %eax,%edx
+  800696:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80069a:	83 c0 08             	add    $0x8,%eax
+  80069d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006a0:	8b 3a                	mov    (%rdx),%edi
+  8006a2:	4c 89 ee             	mov    %r13,%rsi
+  8006a5:	41 ff d6             	call   *%r14
+            break;
+  8006a8:	e9 c3 fe ff ff       	jmp    800570 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b9:	eb e5                	jmp    8006a0 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006be:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c1:	77 5a                	ja     80071d <vprintfmt+0x1de>
+  8006c3:	89 c2                	mov    %eax,%edx
+  8006c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c9:	83 c0 08             	add    $0x8,%eax
+  8006cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006cf:	8b 02                	mov    (%rdx),%eax
+  8006d1:	89 c1                	mov    %eax,%ecx
+  8006d3:	f7 d9                	neg    %ecx
+  8006d5:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006d8:	83 f9 16             	cmp    $0x16,%ecx
+  8006db:	7f 4e                	jg     80072b <vprintfmt+0x1ec>
+  8006dd:	48 63 c1             	movslq %ecx,%rax
+  8006e0:	48 ba e0 4e 80 00 00 	movabs $0x804ee0,%rdx
+  8006e7:	00 00 00 
+  8006ea:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006ee:	48 85 c0             	test   %rax,%rax
+  8006f1:	74 38                	je     80072b <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006f3:	48 89 c1             	mov    %rax,%rcx
+  8006f6:	48 ba b9 50 80 00 00 	movabs $0x8050b9,%rdx
+  8006fd:	00 00 00 
+  800700:	4c 89 ee             	mov    %r13,%rsi
+  800703:	4c 89 f7             	mov    %r14,%rdi
+  800706:	b8 00 00 00 00       	mov    $0x0,%eax
+  80070b:	49 b8 02 05 80 00 00 	movabs $0x800502,%r8
+  800712:	00 00 00 
+  800715:	41 ff d0             	call   *%r8
+  800718:	e9 53 fe ff ff       	jmp    800570 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80071d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800721:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800725:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800729:	eb a4                	jmp    8006cf <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80072b:	48 ba 84 4a 80 00 00 	movabs $0x804a84,%rdx
+  800732:	00 00 00 
+  800735:	4c 89 ee             	mov    %r13,%rsi
+  800738:	4c 89 f7             	mov    %r14,%rdi
+  80073b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800740:	49 b8 02 05 80 00 00 	movabs $0x800502,%r8
+  800747:	00 00 00 
+  80074a:	41 ff d0             	call   *%r8
+  80074d:	e9 1e fe ff ff       	jmp    800570 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800752:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800755:	83 f8 2f             	cmp    $0x2f,%eax
+  800758:	77 6c                	ja     8007c6 <vprintfmt+0x287>
+  80075a:	89 c2                	mov    %eax,%edx
+  80075c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800760:	83 c0 08             	add    $0x8,%eax
+  800763:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800766:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800769:	48 85 d2             	test   %rdx,%rdx
+  80076c:	48 b8 7d 4a 80 00 00 	movabs $0x804a7d,%rax
+  800773:	00 00 00 
+  800776:	48 0f 45 c2          	cmovne %rdx,%rax
+  80077a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80077e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800782:	7e 06                	jle    80078a <vprintfmt+0x24b>
+  800784:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800788:	75 4a                	jne    8007d4 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80078a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80078e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800792:	0f b6 00             	movzbl (%rax),%eax
+  800795:	84 c0                	test   %al,%al
+  800797:	0f 85 9a 00 00 00    	jne    800837 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80079d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007a0:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007a4:	85 c0                	test   %eax,%eax
+  8007a6:	0f 8e c4 fd ff ff    	jle    800570 <vprintfmt+0x31>
+  8007ac:	4c 89 ee             	mov    %r13,%rsi
+  8007af:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007b4:	41 ff d6             	call   *%r14
+  8007b7:	41 83 ec 01          	sub    $0x1,%r12d
+  8007bb:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007bf:	75 eb                	jne    8007ac <vprintfmt+0x26d>
+  8007c1:	e9 aa fd ff ff       	jmp    800570 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d2:	eb 92                	jmp    800766 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007d4:	49 63 f7             	movslq %r15d,%rsi
+  8007d7:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007db:	48 b8 f1 0c 80 00 00 	movabs $0x800cf1,%rax
+  8007e2:	00 00 00 
+  8007e5:	ff d0                	call   *%rax
+  8007e7:	48 89 c2             	mov    %rax,%rdx
+  8007ea:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007ed:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007ef:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007f2:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007f5:	85 c0                	test   %eax,%eax
+  8007f7:	7e 91                	jle    80078a <vprintfmt+0x24b>
+  8007f9:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007fe:	4c 89 ee             	mov    %r13,%rsi
+  800801:	44 89 e7             	mov    %r12d,%edi
+  800804:	41 ff d6             	call   *%r14
+  800807:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80080b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80080e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800811:	75 eb                	jne    8007fe <vprintfmt+0x2bf>
+  800813:	e9 72 ff ff ff       	jmp    80078a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800818:	0f b6 f8             	movzbl %al,%edi
+  80081b:	4c 89 ee             	mov    %r13,%rsi
+  80081e:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800821:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800825:	49 83 c4 01          	add    $0x1,%r12
+  800829:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80082f:	84 c0                	test   %al,%al
+  800831:	0f 84 66 ff ff ff    	je     80079d <vprintfmt+0x25e>
+  800837:	45 85 ff             	test   %r15d,%r15d
+  80083a:	78 0a                	js     800846 <vprintfmt+0x307>
+  80083c:	41 83 ef 01          	sub    $0x1,%r15d
+  800840:	0f 88 57 ff ff ff    	js     80079d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800846:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80084a:	74 cc                	je     800818 <vprintfmt+0x2d9>
+  80084c:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80084f:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800854:	80 fa 5e             	cmp    $0x5e,%dl
+  800857:	77 c2                	ja     80081b <vprintfmt+0x2dc>
+  800859:	eb bd                	jmp    800818 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80085b:	40 84 f6             	test   %sil,%sil
+  80085e:	75 26                	jne    800886 <vprintfmt+0x347>
+    switch (lflag) {
+  800860:	85 d2                	test   %edx,%edx
+  800862:	74 59                	je     8008bd <vprintfmt+0x37e>
+  800864:	83 fa 01             	cmp    $0x1,%edx
+  800867:	74 7b                	je     8008e4 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800869:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086c:	83 f8 2f             	cmp    $0x2f,%eax
+  80086f:	0f 87 96 00 00 00    	ja     80090b <vprintfmt+0x3cc>
+  800875:	89 c2                	mov    %eax,%edx
+  800877:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087b:	83 c0 08             	add    $0x8,%eax
+  80087e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800881:	4c 8b 22             	mov    (%rdx),%r12
+  800884:	eb 17                	jmp    80089d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800886:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800889:	83 f8 2f             	cmp    $0x2f,%eax
+  80088c:	77 21                	ja     8008af <vprintfmt+0x370>
+  80088e:	89 c2                	mov    %eax,%edx
+  800890:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800894:	83 c0 08             	add    $0x8,%eax
+  800897:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80089d:	4d 85 e4             	test   %r12,%r12
+  8008a0:	78 7a                	js     80091c <vprintfmt+0x3dd>
+            num = i;
+  8008a2:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008a5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008aa:	e9 50 02 00 00       	jmp    800aff <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bb:	eb dd                	jmp    80089a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8008c3:	77 11                	ja     8008d6 <vprintfmt+0x397>
+  8008c5:	89 c2                	mov    %eax,%edx
+  8008c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008cb:	83 c0 08             	add    $0x8,%eax
+  8008ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d1:	4c 63 22             	movslq (%rdx),%r12
+  8008d4:	eb c7                	jmp    80089d <vprintfmt+0x35e>
+  8008d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e2:	eb ed                	jmp    8008d1 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ea:	77 11                	ja     8008fd <vprintfmt+0x3be>
+  8008ec:	89 c2                	mov    %eax,%edx
+  8008ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f2:	83 c0 08             	add    $0x8,%eax
+  8008f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f8:	4c 8b 22             	mov    (%rdx),%r12
+  8008fb:	eb a0                	jmp    80089d <vprintfmt+0x35e>
+  8008fd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800901:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800905:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800909:	eb ed                	jmp    8008f8 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80090b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800913:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800917:	e9 65 ff ff ff       	jmp    800881 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80091c:	4c 89 ee             	mov    %r13,%rsi
+  80091f:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800924:	41 ff d6             	call   *%r14
+                i = -i;
+  800927:	49 f7 dc             	neg    %r12
+  80092a:	e9 73 ff ff ff       	jmp    8008a2 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80092f:	40 84 f6             	test   %sil,%sil
+  800932:	75 32                	jne    800966 <vprintfmt+0x427>
+    switch (lflag) {
+  800934:	85 d2                	test   %edx,%edx
+  800936:	74 5d                	je     800995 <vprintfmt+0x456>
+  800938:	83 fa 01             	cmp    $0x1,%edx
+  80093b:	0f 84 82 00 00 00    	je     8009c3 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800941:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800944:	83 f8 2f             	cmp    $0x2f,%eax
+  800947:	0f 87 a5 00 00 00    	ja     8009f2 <vprintfmt+0x4b3>
+  80094d:	89 c2                	mov    %eax,%edx
+  80094f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800953:	83 c0 08             	add    $0x8,%eax
+  800956:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800959:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80095c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800961:	e9 99 01 00 00       	jmp    800aff <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 19                	ja     800987 <vprintfmt+0x448>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80097d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800982:	e9 78 01 00 00       	jmp    800aff <vprintfmt+0x5c0>
+  800987:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800993:	eb e5                	jmp    80097a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800995:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800998:	83 f8 2f             	cmp    $0x2f,%eax
+  80099b:	77 18                	ja     8009b5 <vprintfmt+0x476>
+  80099d:	89 c2                	mov    %eax,%edx
+  80099f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a3:	83 c0 08             	add    $0x8,%eax
+  8009a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a9:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009ab:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009b0:	e9 4a 01 00 00       	jmp    800aff <vprintfmt+0x5c0>
+  8009b5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c1:	eb e6                	jmp    8009a9 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c9:	77 19                	ja     8009e4 <vprintfmt+0x4a5>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009da:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009df:	e9 1b 01 00 00       	jmp    800aff <vprintfmt+0x5c0>
+  8009e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f0:	eb e5                	jmp    8009d7 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	e9 56 ff ff ff       	jmp    800959 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a03:	40 84 f6             	test   %sil,%sil
+  800a06:	75 2e                	jne    800a36 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a08:	85 d2                	test   %edx,%edx
+  800a0a:	74 59                	je     800a65 <vprintfmt+0x526>
+  800a0c:	83 fa 01             	cmp    $0x1,%edx
+  800a0f:	74 7f                	je     800a90 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a14:	83 f8 2f             	cmp    $0x2f,%eax
+  800a17:	0f 87 9f 00 00 00    	ja     800abc <vprintfmt+0x57d>
+  800a1d:	89 c2                	mov    %eax,%edx
+  800a1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a23:	83 c0 08             	add    $0x8,%eax
+  800a26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a2c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a31:	e9 c9 00 00 00       	jmp    800aff <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 19                	ja     800a57 <vprintfmt+0x518>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a4d:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a52:	e9 a8 00 00 00       	jmp    800aff <vprintfmt+0x5c0>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e5                	jmp    800a4a <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a65:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a68:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6b:	77 15                	ja     800a82 <vprintfmt+0x543>
+  800a6d:	89 c2                	mov    %eax,%edx
+  800a6f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a73:	83 c0 08             	add    $0x8,%eax
+  800a76:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a79:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a7b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a80:	eb 7d                	jmp    800aff <vprintfmt+0x5c0>
+  800a82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8e:	eb e9                	jmp    800a79 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a93:	83 f8 2f             	cmp    $0x2f,%eax
+  800a96:	77 16                	ja     800aae <vprintfmt+0x56f>
+  800a98:	89 c2                	mov    %eax,%edx
+  800a9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9e:	83 c0 08             	add    $0x8,%eax
+  800aa1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aa7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800aac:	eb 51                	jmp    800aff <vprintfmt+0x5c0>
+  800aae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aba:	eb e8                	jmp    800aa4 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800abc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac8:	e9 5c ff ff ff       	jmp    800a29 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800acd:	4c 89 ee             	mov    %r13,%rsi
+  800ad0:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ad5:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800ad8:	4c 89 ee             	mov    %r13,%rsi
+  800adb:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ae0:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae9:	77 47                	ja     800b32 <vprintfmt+0x5f3>
+  800aeb:	89 c2                	mov    %eax,%edx
+  800aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af1:	83 c0 08             	add    $0x8,%eax
+  800af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800afa:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800aff:	48 83 ec 08          	sub    $0x8,%rsp
+  800b03:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b07:	0f 94 c0             	sete   %al
+  800b0a:	0f b6 c0             	movzbl %al,%eax
+  800b0d:	50                   	push   %rax
+  800b0e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b13:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b17:	4c 89 ee             	mov    %r13,%rsi
+  800b1a:	4c 89 f7             	mov    %r14,%rdi
+  800b1d:	48 b8 34 04 80 00 00 	movabs $0x800434,%rax
+  800b24:	00 00 00 
+  800b27:	ff d0                	call   *%rax
+            break;
+  800b29:	48 83 c4 10          	add    $0x10,%rsp
+  800b2d:	e9 3e fa ff ff       	jmp    800570 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3e:	eb b7                	jmp    800af7 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b40:	40 84 f6             	test   %sil,%sil
+  800b43:	75 2b                	jne    800b70 <vprintfmt+0x631>
+    switch (lflag) {
+  800b45:	85 d2                	test   %edx,%edx
+  800b47:	74 56                	je     800b9f <vprintfmt+0x660>
+  800b49:	83 fa 01             	cmp    $0x1,%edx
+  800b4c:	74 7f                	je     800bcd <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b51:	83 f8 2f             	cmp    $0x2f,%eax
+  800b54:	0f 87 a2 00 00 00    	ja     800bfc <vprintfmt+0x6bd>
+  800b5a:	89 c2                	mov    %eax,%edx
+  800b5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b60:	83 c0 08             	add    $0x8,%eax
+  800b63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b69:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b6e:	eb 8f                	jmp    800aff <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b70:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b73:	83 f8 2f             	cmp    $0x2f,%eax
+  800b76:	77 19                	ja     800b91 <vprintfmt+0x652>
+  800b78:	89 c2                	mov    %eax,%edx
+  800b7a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7e:	83 c0 08             	add    $0x8,%eax
+  800b81:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b84:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b87:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b8c:	e9 6e ff ff ff       	jmp    800aff <vprintfmt+0x5c0>
+  800b91:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b95:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9d:	eb e5                	jmp    800b84 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b9f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba5:	77 18                	ja     800bbf <vprintfmt+0x680>
+  800ba7:	89 c2                	mov    %eax,%edx
+  800ba9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bad:	83 c0 08             	add    $0x8,%eax
+  800bb0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb3:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bb5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bba:	e9 40 ff ff ff       	jmp    800aff <vprintfmt+0x5c0>
+  800bbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcb:	eb e6                	jmp    800bb3 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd3:	77 19                	ja     800bee <vprintfmt+0x6af>
+  800bd5:	89 c2                	mov    %eax,%edx
+  800bd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdb:	83 c0 08             	add    $0x8,%eax
+  800bde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800be4:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800be9:	e9 11 ff ff ff       	jmp    800aff <vprintfmt+0x5c0>
+  800bee:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfa:	eb e5                	jmp    800be1 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bfc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c08:	e9 59 ff ff ff       	jmp    800b66 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c0d:	4c 89 ee             	mov    %r13,%rsi
+  800c10:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c15:	41 ff d6             	call   *%r14
+            break;
+  800c18:	e9 53 f9 ff ff       	jmp    800570 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c1d:	4c 89 ee             	mov    %r13,%rsi
+  800c20:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c25:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c28:	48 83 eb 01          	sub    $0x1,%rbx
+  800c2c:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c30:	75 f6                	jne    800c28 <vprintfmt+0x6e9>
+  800c32:	e9 39 f9 ff ff       	jmp    800570 <vprintfmt+0x31>
+}
+  800c37:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c3b:	5b                   	pop    %rbx
+  800c3c:	41 5c                	pop    %r12
+  800c3e:	41 5d                	pop    %r13
+  800c40:	41 5e                	pop    %r14
+  800c42:	41 5f                	pop    %r15
+  800c44:	5d                   	pop    %rbp
+  800c45:	c3                   	ret
+
+0000000000800c46 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c46:	55                   	push   %rbp
+  800c47:	48 89 e5             	mov    %rsp,%rbp
+  800c4a:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c4e:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c52:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c57:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c5b:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c62:	48 85 ff             	test   %rdi,%rdi
+  800c65:	74 2b                	je     800c92 <vsnprintf+0x4c>
+  800c67:	48 85 f6             	test   %rsi,%rsi
+  800c6a:	74 26                	je     800c92 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c6c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c70:	48 bf ea 04 80 00 00 	movabs $0x8004ea,%rdi
+  800c77:	00 00 00 
+  800c7a:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  800c81:	00 00 00 
+  800c84:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c86:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c8a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c8d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c90:	c9                   	leave
+  800c91:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c92:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c97:	eb f7                	jmp    800c90 <vsnprintf+0x4a>
+
+0000000000800c99 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c99:	55                   	push   %rbp
+  800c9a:	48 89 e5             	mov    %rsp,%rbp
+  800c9d:	48 83 ec 50          	sub    $0x50,%rsp
+  800ca1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ca5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ca9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cad:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cb4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cbc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800cc0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800cc4:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cc8:	48 b8 46 0c 80 00 00 	movabs $0x800c46,%rax
+  800ccf:	00 00 00 
+  800cd2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cd4:	c9                   	leave
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cd6:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cd9:	74 10                	je     800ceb <strlen+0x15>
+    size_t n = 0;
+  800cdb:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ce0:	48 83 c0 01          	add    $0x1,%rax
+  800ce4:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ce8:	75 f6                	jne    800ce0 <strlen+0xa>
+  800cea:	c3                   	ret
+    size_t n = 0;
+  800ceb:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cf0:	c3                   	ret
+
+0000000000800cf1 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cf1:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cf4:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cf9:	48 85 f6             	test   %rsi,%rsi
+  800cfc:	74 11                	je     800d0f <strnlen+0x1e>
+  800cfe:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d02:	74 0c                	je     800d10 <strnlen+0x1f>
+  800d04:	48 83 c2 01          	add    $0x1,%rdx
+  800d08:	48 39 d0             	cmp    %rdx,%rax
+  800d0b:	75 f1                	jne    800cfe <strnlen+0xd>
+  800d0d:	eb 04                	jmp    800d13 <strnlen+0x22>
+  800d0f:	c3                   	ret
+  800d10:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d13:	c3                   	ret
+
+0000000000800d14 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d14:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d1c:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d20:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d23:	48 83 c2 01          	add    $0x1,%rdx
+  800d27:	84 c9                	test   %cl,%cl
+  800d29:	75 f1                	jne    800d1c <strcpy+0x8>
+        ;
+    return res;
+}
+  800d2b:	c3                   	ret
+
+0000000000800d2c <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d2c:	55                   	push   %rbp
+  800d2d:	48 89 e5             	mov    %rsp,%rbp
+  800d30:	41 54                	push   %r12
+  800d32:	53                   	push   %rbx
+  800d33:	48 89 fb             	mov    %rdi,%rbx
+  800d36:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d39:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800d40:	00 00 00 
+  800d43:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d45:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d49:	4c 89 e6             	mov    %r12,%rsi
+  800d4c:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  800d53:	00 00 00 
+  800d56:	ff d0                	call   *%rax
+    return dst;
+}
+  800d58:	48 89 d8             	mov    %rbx,%rax
+  800d5b:	5b                   	pop    %rbx
+  800d5c:	41 5c                	pop    %r12
+  800d5e:	5d                   	pop    %rbp
+  800d5f:	c3                   	ret
+
+0000000000800d60 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d60:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d63:	48 85 d2             	test   %rdx,%rdx
+  800d66:	74 1f                	je     800d87 <strncpy+0x27>
+  800d68:	48 01 fa             	add    %rdi,%rdx
+  800d6b:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d6e:	48 83 c1 01          	add    $0x1,%rcx
+  800d72:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d76:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d7a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d7e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d82:	48 39 ca             	cmp    %rcx,%rdx
+  800d85:	75 e7                	jne    800d6e <strncpy+0xe>
+    }
+    return ret;
+}
+  800d87:	c3                   	ret
+
+0000000000800d88 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d88:	48 89 f8             	mov    %rdi,%rax
+  800d8b:	48 85 d2             	test   %rdx,%rdx
+  800d8e:	74 24                	je     800db4 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d90:	48 83 ea 01          	sub    $0x1,%rdx
+  800d94:	74 1b                	je     800db1 <strlcpy+0x29>
+  800d96:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d9a:	0f b6 16             	movzbl (%rsi),%edx
+  800d9d:	84 d2                	test   %dl,%dl
+  800d9f:	74 10                	je     800db1 <strlcpy+0x29>
+            *dst++ = *src++;
+  800da1:	48 83 c6 01          	add    $0x1,%rsi
+  800da5:	48 83 c0 01          	add    $0x1,%rax
+  800da9:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dac:	48 39 c8             	cmp    %rcx,%rax
+  800daf:	75 e9                	jne    800d9a <strlcpy+0x12>
+        *dst = '\0';
+  800db1:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800db4:	48 29 f8             	sub    %rdi,%rax
+}
+  800db7:	c3                   	ret
+
+0000000000800db8 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800db8:	0f b6 07             	movzbl (%rdi),%eax
+  800dbb:	84 c0                	test   %al,%al
+  800dbd:	74 13                	je     800dd2 <strcmp+0x1a>
+  800dbf:	38 06                	cmp    %al,(%rsi)
+  800dc1:	75 0f                	jne    800dd2 <strcmp+0x1a>
+  800dc3:	48 83 c7 01          	add    $0x1,%rdi
+  800dc7:	48 83 c6 01          	add    $0x1,%rsi
+  800dcb:	0f b6 07             	movzbl (%rdi),%eax
+  800dce:	84 c0                	test   %al,%al
+  800dd0:	75 ed                	jne    800dbf <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dd2:	0f b6 c0             	movzbl %al,%eax
+  800dd5:	0f b6 16             	movzbl (%rsi),%edx
+  800dd8:	29 d0                	sub    %edx,%eax
+}
+  800dda:	c3                   	ret
+
+0000000000800ddb <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ddb:	48 85 d2             	test   %rdx,%rdx
+  800dde:	74 1f                	je     800dff <strncmp+0x24>
+  800de0:	0f b6 07             	movzbl (%rdi),%eax
+  800de3:	84 c0                	test   %al,%al
+  800de5:	74 1e                	je     800e05 <strncmp+0x2a>
+  800de7:	3a 06                	cmp    (%rsi),%al
+  800de9:	75 1a                	jne    800e05 <strncmp+0x2a>
+  800deb:	48 83 c7 01          	add    $0x1,%rdi
+  800def:	48 83 c6 01          	add    $0x1,%rsi
+  800df3:	48 83 ea 01          	sub    $0x1,%rdx
+  800df7:	75 e7                	jne    800de0 <strncmp+0x5>
+
+    if (!n) return 0;
+  800df9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dfe:	c3                   	ret
+  800dff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e04:	c3                   	ret
+  800e05:	48 85 d2             	test   %rdx,%rdx
+  800e08:	74 09                	je     800e13 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e0a:	0f b6 07             	movzbl (%rdi),%eax
+  800e0d:	0f b6 16             	movzbl (%rsi),%edx
+  800e10:	29 d0                	sub    %edx,%eax
+  800e12:	c3                   	ret
+    if (!n) return 0;
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e18:	c3                   	ret
+
+0000000000800e19 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e19:	0f b6 17             	movzbl (%rdi),%edx
+  800e1c:	84 d2                	test   %dl,%dl
+  800e1e:	74 18                	je     800e38 <strchr+0x1f>
+        if (*str == c) {
+  800e20:	0f be d2             	movsbl %dl,%edx
+  800e23:	39 f2                	cmp    %esi,%edx
+  800e25:	74 17                	je     800e3e <strchr+0x25>
+    for (; *str; str++) {
+  800e27:	48 83 c7 01          	add    $0x1,%rdi
+  800e2b:	0f b6 17             	movzbl (%rdi),%edx
+  800e2e:	84 d2                	test   %dl,%dl
+  800e30:	75 ee                	jne    800e20 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e32:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e37:	c3                   	ret
+  800e38:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e3d:	c3                   	ret
+  800e3e:	48 89 f8             	mov    %rdi,%rax
+}
+  800e41:	c3                   	ret
+
+0000000000800e42 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e42:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e45:	0f b6 17             	movzbl (%rdi),%edx
+  800e48:	84 d2                	test   %dl,%dl
+  800e4a:	74 13                	je     800e5f <strfind+0x1d>
+  800e4c:	0f be d2             	movsbl %dl,%edx
+  800e4f:	39 f2                	cmp    %esi,%edx
+  800e51:	74 0b                	je     800e5e <strfind+0x1c>
+  800e53:	48 83 c0 01          	add    $0x1,%rax
+  800e57:	0f b6 10             	movzbl (%rax),%edx
+  800e5a:	84 d2                	test   %dl,%dl
+  800e5c:	75 ee                	jne    800e4c <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e5e:	c3                   	ret
+  800e5f:	c3                   	ret
+
+0000000000800e60 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e60:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e63:	48 89 f8             	mov    %rdi,%rax
+  800e66:	48 f7 d8             	neg    %rax
+  800e69:	83 e0 07             	and    $0x7,%eax
+  800e6c:	49 89 d1             	mov    %rdx,%r9
+  800e6f:	49 29 c1             	sub    %rax,%r9
+  800e72:	78 36                	js     800eaa <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e74:	40 0f b6 c6          	movzbl %sil,%eax
+  800e78:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e7f:	01 01 01 
+  800e82:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e86:	40 f6 c7 07          	test   $0x7,%dil
+  800e8a:	75 38                	jne    800ec4 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e8c:	4c 89 c9             	mov    %r9,%rcx
+  800e8f:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e93:	74 0c                	je     800ea1 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e95:	fc                   	cld
+  800e96:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e99:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e9d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ea1:	4d 85 c9             	test   %r9,%r9
+  800ea4:	75 45                	jne    800eeb <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ea6:	4c 89 c0             	mov    %r8,%rax
+  800ea9:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800eaa:	48 85 d2             	test   %rdx,%rdx
+  800ead:	74 f7                	je     800ea6 <memset+0x46>
+  800eaf:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800eb2:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800eb5:	48 83 c0 01          	add    $0x1,%rax
+  800eb9:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ebd:	48 39 c2             	cmp    %rax,%rdx
+  800ec0:	75 f3                	jne    800eb5 <memset+0x55>
+  800ec2:	eb e2                	jmp    800ea6 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ec4:	40 f6 c7 01          	test   $0x1,%dil
+  800ec8:	74 06                	je     800ed0 <memset+0x70>
+  800eca:	88 07                	mov    %al,(%rdi)
+  800ecc:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ed0:	40 f6 c7 02          	test   $0x2,%dil
+  800ed4:	74 07                	je     800edd <memset+0x7d>
+  800ed6:	66 89 07             	mov    %ax,(%rdi)
+  800ed9:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800edd:	40 f6 c7 04          	test   $0x4,%dil
+  800ee1:	74 a9                	je     800e8c <memset+0x2c>
+  800ee3:	89 07                	mov    %eax,(%rdi)
+  800ee5:	48 83 c7 04          	add    $0x4,%rdi
+  800ee9:	eb a1                	jmp    800e8c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800eeb:	41 f6 c1 04          	test   $0x4,%r9b
+  800eef:	74 06                	je     800ef7 <memset+0x97>
+  800ef1:	89 07                	mov    %eax,(%rdi)
+  800ef3:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ef7:	41 f6 c1 02          	test   $0x2,%r9b
+  800efb:	74 07                	je     800f04 <memset+0xa4>
+  800efd:	66 89 07             	mov    %ax,(%rdi)
+  800f00:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f04:	41 f6 c1 01          	test   $0x1,%r9b
+  800f08:	74 9c                	je     800ea6 <memset+0x46>
+  800f0a:	88 07                	mov    %al,(%rdi)
+  800f0c:	eb 98                	jmp    800ea6 <memset+0x46>
+
+0000000000800f0e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f0e:	48 89 f8             	mov    %rdi,%rax
+  800f11:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f14:	48 39 fe             	cmp    %rdi,%rsi
+  800f17:	73 3b                	jae    800f54 <memmove+0x46>
+  800f19:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f1d:	48 39 d7             	cmp    %rdx,%rdi
+  800f20:	73 32                	jae    800f54 <memmove+0x46>
+        s += n;
+        d += n;
+  800f22:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f26:	48 89 d6             	mov    %rdx,%rsi
+  800f29:	48 09 fe             	or     %rdi,%rsi
+  800f2c:	48 09 ce             	or     %rcx,%rsi
+  800f2f:	40 f6 c6 07          	test   $0x7,%sil
+  800f33:	75 12                	jne    800f47 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f35:	48 83 ef 08          	sub    $0x8,%rdi
+  800f39:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f3d:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f41:	fd                   	std
+  800f42:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f45:	fc                   	cld
+  800f46:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f47:	48 83 ef 01          	sub    $0x1,%rdi
+  800f4b:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f4f:	fd                   	std
+  800f50:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f52:	eb f1                	jmp    800f45 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f54:	48 89 f2             	mov    %rsi,%rdx
+  800f57:	48 09 c2             	or     %rax,%rdx
+  800f5a:	48 09 ca             	or     %rcx,%rdx
+  800f5d:	f6 c2 07             	test   $0x7,%dl
+  800f60:	75 0c                	jne    800f6e <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f62:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f66:	48 89 c7             	mov    %rax,%rdi
+  800f69:	fc                   	cld
+  800f6a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f6d:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f6e:	48 89 c7             	mov    %rax,%rdi
+  800f71:	fc                   	cld
+  800f72:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f74:	c3                   	ret
+
+0000000000800f75 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f75:	55                   	push   %rbp
+  800f76:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f79:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  800f80:	00 00 00 
+  800f83:	ff d0                	call   *%rax
+}
+  800f85:	5d                   	pop    %rbp
+  800f86:	c3                   	ret
+
+0000000000800f87 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f87:	55                   	push   %rbp
+  800f88:	48 89 e5             	mov    %rsp,%rbp
+  800f8b:	41 57                	push   %r15
+  800f8d:	41 56                	push   %r14
+  800f8f:	41 55                	push   %r13
+  800f91:	41 54                	push   %r12
+  800f93:	53                   	push   %rbx
+  800f94:	48 83 ec 08          	sub    $0x8,%rsp
+  800f98:	49 89 fe             	mov    %rdi,%r14
+  800f9b:	49 89 f7             	mov    %rsi,%r15
+  800f9e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fa1:	48 89 f7             	mov    %rsi,%rdi
+  800fa4:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800fab:	00 00 00 
+  800fae:	ff d0                	call   *%rax
+  800fb0:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fb3:	48 89 de             	mov    %rbx,%rsi
+  800fb6:	4c 89 f7             	mov    %r14,%rdi
+  800fb9:	48 b8 f1 0c 80 00 00 	movabs $0x800cf1,%rax
+  800fc0:	00 00 00 
+  800fc3:	ff d0                	call   *%rax
+  800fc5:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc8:	48 39 c3             	cmp    %rax,%rbx
+  800fcb:	74 36                	je     801003 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fcd:	48 89 d8             	mov    %rbx,%rax
+  800fd0:	4c 29 e8             	sub    %r13,%rax
+  800fd3:	49 39 c4             	cmp    %rax,%r12
+  800fd6:	73 31                	jae    801009 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fd8:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fdd:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fe1:	4c 89 fe             	mov    %r15,%rsi
+  800fe4:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  800feb:	00 00 00 
+  800fee:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ff0:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ff4:	48 83 c4 08          	add    $0x8,%rsp
+  800ff8:	5b                   	pop    %rbx
+  800ff9:	41 5c                	pop    %r12
+  800ffb:	41 5d                	pop    %r13
+  800ffd:	41 5e                	pop    %r14
+  800fff:	41 5f                	pop    %r15
+  801001:	5d                   	pop    %rbp
+  801002:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801003:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801007:	eb eb                	jmp    800ff4 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801009:	48 83 eb 01          	sub    $0x1,%rbx
+  80100d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801011:	48 89 da             	mov    %rbx,%rdx
+  801014:	4c 89 fe             	mov    %r15,%rsi
+  801017:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  80101e:	00 00 00 
+  801021:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801023:	49 01 de             	add    %rbx,%r14
+  801026:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80102b:	eb c3                	jmp    800ff0 <strlcat+0x69>
+
+000000000080102d <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80102d:	48 85 d2             	test   %rdx,%rdx
+  801030:	74 2d                	je     80105f <memcmp+0x32>
+  801032:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801037:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80103b:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801040:	44 38 c1             	cmp    %r8b,%cl
+  801043:	75 0f                	jne    801054 <memcmp+0x27>
+    while (n-- > 0) {
+  801045:	48 83 c0 01          	add    $0x1,%rax
+  801049:	48 39 c2             	cmp    %rax,%rdx
+  80104c:	75 e9                	jne    801037 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80104e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801053:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801054:	0f b6 c1             	movzbl %cl,%eax
+  801057:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80105b:	44 29 c0             	sub    %r8d,%eax
+  80105e:	c3                   	ret
+    return 0;
+  80105f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801064:	c3                   	ret
+
+0000000000801065 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801065:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801069:	48 39 c7             	cmp    %rax,%rdi
+  80106c:	73 0f                	jae    80107d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80106e:	40 38 37             	cmp    %sil,(%rdi)
+  801071:	74 0e                	je     801081 <memfind+0x1c>
+    for (; src < end; src++) {
+  801073:	48 83 c7 01          	add    $0x1,%rdi
+  801077:	48 39 f8             	cmp    %rdi,%rax
+  80107a:	75 f2                	jne    80106e <memfind+0x9>
+  80107c:	c3                   	ret
+  80107d:	48 89 f8             	mov    %rdi,%rax
+  801080:	c3                   	ret
+  801081:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801084:	c3                   	ret
+
+0000000000801085 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801085:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801088:	0f b6 37             	movzbl (%rdi),%esi
+  80108b:	40 80 fe 20          	cmp    $0x20,%sil
+  80108f:	74 06                	je     801097 <strtol+0x12>
+  801091:	40 80 fe 09          	cmp    $0x9,%sil
+  801095:	75 13                	jne    8010aa <strtol+0x25>
+  801097:	48 83 c7 01          	add    $0x1,%rdi
+  80109b:	0f b6 37             	movzbl (%rdi),%esi
+  80109e:	40 80 fe 20          	cmp    $0x20,%sil
+  8010a2:	74 f3                	je     801097 <strtol+0x12>
+  8010a4:	40 80 fe 09          	cmp    $0x9,%sil
+  8010a8:	74 ed                	je     801097 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010aa:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010ad:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010b0:	3c 01                	cmp    $0x1,%al
+  8010b2:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010b6:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010bc:	75 0f                	jne    8010cd <strtol+0x48>
+  8010be:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010c1:	74 14                	je     8010d7 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010c3:	85 d2                	test   %edx,%edx
+  8010c5:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ca:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010cd:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010d2:	4c 63 ca             	movslq %edx,%r9
+  8010d5:	eb 36                	jmp    80110d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d7:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010db:	74 0f                	je     8010ec <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010dd:	85 d2                	test   %edx,%edx
+  8010df:	75 ec                	jne    8010cd <strtol+0x48>
+        s++;
+  8010e1:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010e5:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010ea:	eb e1                	jmp    8010cd <strtol+0x48>
+        s += 2;
+  8010ec:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010f0:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010f5:	eb d6                	jmp    8010cd <strtol+0x48>
+            dig -= '0';
+  8010f7:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010fa:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010fe:	41 39 d0             	cmp    %edx,%r8d
+  801101:	7d 21                	jge    801124 <strtol+0x9f>
+        val = val * base + dig;
+  801103:	49 0f af c1          	imul   %r9,%rax
+  801107:	0f b6 c9             	movzbl %cl,%ecx
+  80110a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80110d:	48 83 c7 01          	add    $0x1,%rdi
+  801111:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801115:	80 f9 39             	cmp    $0x39,%cl
+  801118:	76 dd                	jbe    8010f7 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80111a:	80 f9 7b             	cmp    $0x7b,%cl
+  80111d:	77 05                	ja     801124 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80111f:	83 e9 57             	sub    $0x57,%ecx
+  801122:	eb d6                	jmp    8010fa <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801124:	4d 85 d2             	test   %r10,%r10
+  801127:	74 03                	je     80112c <strtol+0xa7>
+  801129:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80112c:	48 89 c2             	mov    %rax,%rdx
+  80112f:	48 f7 da             	neg    %rdx
+  801132:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801136:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80113a:	c3                   	ret
+
+000000000080113b <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80113b:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801140:	ba 00 00 00 00       	mov    $0x0,%edx
+  801145:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80114b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801151:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801157:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801159:	c3                   	ret
+
+000000000080115a <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80115a:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80115f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801164:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80116e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801174:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80117a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801180:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801182:	c3                   	ret
+
+0000000000801183 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801183:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801186:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80118b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801190:	ba 00 00 00 00       	mov    $0x0,%edx
+  801195:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80119b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011a7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011a9:	48 85 c0             	test   %rax,%rax
+  8011ac:	7f 01                	jg     8011af <sys_env_destroy+0x2c>
+}
+  8011ae:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8011af:	55                   	push   %rbp
+  8011b0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b3:	49 89 c0             	mov    %rax,%r8
+  8011b6:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011bb:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  8011c2:	00 00 00 
+  8011c5:	be 29 00 00 00       	mov    $0x29,%esi
+  8011ca:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  8011d1:	00 00 00 
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d9:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8011e0:	00 00 00 
+  8011e3:	41 ff d1             	call   *%r9
+
+00000000008011e6 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011e6:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011f0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801200:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801206:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80120c:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80120e:	c3                   	ret
+
+000000000080120f <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80120f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801214:	bf 00 00 00 00       	mov    $0x0,%edi
+  801219:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80121e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801223:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80122f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801235:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801237:	c3                   	ret
+
+0000000000801238 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80123d:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801244:	00 00 00 
+  801247:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80124d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801253:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801259:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80125b:	c3                   	ret
+
+000000000080125c <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80125c:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80125f:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801264:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80126a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801270:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801272:	c3                   	ret
+
+0000000000801273 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801273:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801276:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80127b:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80127e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801284:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80128a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80128c:	48 85 c0             	test   %rax,%rax
+  80128f:	7f 01                	jg     801292 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801291:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801292:	55                   	push   %rbp
+  801293:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801296:	49 89 c0             	mov    %rax,%r8
+  801299:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80129e:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  8012a5:	00 00 00 
+  8012a8:	be 29 00 00 00       	mov    $0x29,%esi
+  8012ad:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  8012b4:	00 00 00 
+  8012b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012bc:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8012c3:	00 00 00 
+  8012c6:	41 ff d1             	call   *%r9
+
+00000000008012c9 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012c9:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012cc:	48 63 d2             	movslq %edx,%rdx
+  8012cf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012d2:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012d7:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8012da:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012dc:	48 85 c0             	test   %rax,%rax
+  8012df:	7f 01                	jg     8012e2 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012e1:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012e2:	55                   	push   %rbp
+  8012e3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e6:	49 89 c0             	mov    %rax,%r8
+  8012e9:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012ee:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  8012f5:	00 00 00 
+  8012f8:	be 29 00 00 00       	mov    $0x29,%esi
+  8012fd:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  801304:	00 00 00 
+  801307:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130c:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  801313:	00 00 00 
+  801316:	41 ff d1             	call   *%r9
+
+0000000000801319 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801319:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80131c:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801321:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801327:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80132d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801333:	0f 05                	syscall
+    if (check && ret > 0) {
+  801335:	48 85 c0             	test   %rax,%rax
+  801338:	7f 01                	jg     80133b <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80133a:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80133b:	55                   	push   %rbp
+  80133c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80133f:	49 89 c0             	mov    %rax,%r8
+  801342:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801347:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  80134e:	00 00 00 
+  801351:	be 29 00 00 00       	mov    $0x29,%esi
+  801356:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  80135d:	00 00 00 
+  801360:	b8 00 00 00 00       	mov    $0x0,%eax
+  801365:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  80136c:	00 00 00 
+  80136f:	41 ff d1             	call   *%r9
+
+0000000000801372 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801372:	48 63 f6             	movslq %esi,%rsi
+  801375:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801378:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80137d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801382:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80138e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801394:	0f 05                	syscall
+    if (check && ret > 0) {
+  801396:	48 85 c0             	test   %rax,%rax
+  801399:	7f 01                	jg     80139c <sys_env_set_status+0x2a>
+}
+  80139b:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80139c:	55                   	push   %rbp
+  80139d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a0:	49 89 c0             	mov    %rax,%r8
+  8013a3:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013a8:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  8013af:	00 00 00 
+  8013b2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013b7:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  8013be:	00 00 00 
+  8013c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c6:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8013cd:	00 00 00 
+  8013d0:	41 ff d1             	call   *%r9
+
+00000000008013d3 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d6:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 01                	jg     8013fa <sys_env_set_trapframe+0x27>
+}
+  8013f9:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fe:	49 89 c0             	mov    %rax,%r8
+  801401:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801406:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  80140d:	00 00 00 
+  801410:	be 29 00 00 00       	mov    $0x29,%esi
+  801415:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  80141c:	00 00 00 
+  80141f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801424:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  80142b:	00 00 00 
+  80142e:	41 ff d1             	call   *%r9
+
+0000000000801431 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801431:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801434:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801439:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801444:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80144a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801450:	0f 05                	syscall
+    if (check && ret > 0) {
+  801452:	48 85 c0             	test   %rax,%rax
+  801455:	7f 01                	jg     801458 <sys_env_set_pgfault_upcall+0x27>
+}
+  801457:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801458:	55                   	push   %rbp
+  801459:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145c:	49 89 c0             	mov    %rax,%r8
+  80145f:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801464:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  80146b:	00 00 00 
+  80146e:	be 29 00 00 00       	mov    $0x29,%esi
+  801473:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  80147a:	00 00 00 
+  80147d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801482:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  801489:	00 00 00 
+  80148c:	41 ff d1             	call   *%r9
+
+000000000080148f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80148f:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801492:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801495:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80149a:	4d 63 c0             	movslq %r8d,%r8
+  80149d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014a3:	0f 05                	syscall
+}
+  8014a5:	c3                   	ret
+
+00000000008014a6 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014a6:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b1:	4d 63 c0             	movslq %r8d,%r8
+  8014b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ba:	0f 05                	syscall
+}
+  8014bc:	c3                   	ret
+
+00000000008014bd <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014bd:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c2:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014c5:	45 89 c0             	mov    %r8d,%r8d
+  8014c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ce:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014d0:	48 85 c0             	test   %rax,%rax
+  8014d3:	7f 01                	jg     8014d6 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014d5:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8014d6:	55                   	push   %rbp
+  8014d7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014da:	49 89 c0             	mov    %rax,%r8
+  8014dd:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014e2:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  8014e9:	00 00 00 
+  8014ec:	be 29 00 00 00       	mov    $0x29,%esi
+  8014f1:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  8014f8:	00 00 00 
+  8014fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801500:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  801507:	00 00 00 
+  80150a:	41 ff d1             	call   *%r9
+
+000000000080150d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80150d:	55                   	push   %rbp
+  80150e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801517:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801521:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  801528:	00 00 00 
+  80152b:	ff d0                	call   *%rax
+}
+  80152d:	5d                   	pop    %rbp
+  80152e:	c3                   	ret
+
+000000000080152f <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80152f:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801534:	bf 00 00 00 00       	mov    $0x0,%edi
+  801539:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80153e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801543:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801549:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80154f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801555:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801557:	c3                   	ret
+
+0000000000801558 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801558:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80155d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801562:	ba 00 00 00 00       	mov    $0x0,%edx
+  801567:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80156d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801573:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801579:	0f 05                	syscall
+    if (check && ret > 0) {
+  80157b:	48 85 c0             	test   %rax,%rax
+  80157e:	7f 01                	jg     801581 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801580:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801585:	49 89 c0             	mov    %rax,%r8
+  801588:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80158d:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  801594:	00 00 00 
+  801597:	be 29 00 00 00       	mov    $0x29,%esi
+  80159c:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  8015a3:	00 00 00 
+  8015a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ab:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8015b2:	00 00 00 
+  8015b5:	41 ff d1             	call   *%r9
+
+00000000008015b8 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015b8:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015cc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015de:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e0:	c3                   	ret
+
+00000000008015e1 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8015e1:	89 d2                	mov    %edx,%edx
+  8015e3:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e5:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015fc:	0f 05                	syscall
+}
+  8015fe:	c3                   	ret
+
+00000000008015ff <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8015ff:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801602:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801607:	ba 00 00 00 00       	mov    $0x0,%edx
+  80160c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801612:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801618:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80161e:	0f 05                	syscall
+}
+  801620:	c3                   	ret
+
+0000000000801621 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801621:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801624:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801629:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801634:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80163a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801640:	0f 05                	syscall
+}
+  801642:	c3                   	ret
+
+0000000000801643 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801643:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801646:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801650:	ba 00 00 00 00       	mov    $0x0,%edx
+  801655:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80165b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801661:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801667:	0f 05                	syscall
+    if (check && ret > 0) {
+  801669:	48 85 c0             	test   %rax,%rax
+  80166c:	7f 01                	jg     80166f <sys_irq_ack+0x2c>
+}
+  80166e:	c3                   	ret
+sys_irq_ack(int irq) {
+  80166f:	55                   	push   %rbp
+  801670:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801673:	49 89 c0             	mov    %rax,%r8
+  801676:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80167b:	48 ba b8 4f 80 00 00 	movabs $0x804fb8,%rdx
+  801682:	00 00 00 
+  801685:	be 29 00 00 00       	mov    $0x29,%esi
+  80168a:	48 bf d7 4f 80 00 00 	movabs $0x804fd7,%rdi
+  801691:	00 00 00 
+  801694:	b8 00 00 00 00       	mov    $0x0,%eax
+  801699:	49 b9 9f 02 80 00 00 	movabs $0x80029f,%r9
+  8016a0:	00 00 00 
+  8016a3:	41 ff d1             	call   *%r9
+
+00000000008016a6 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016a6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016ad:	ff ff ff 
+  8016b0:	48 01 f8             	add    %rdi,%rax
+  8016b3:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016b7:	c3                   	ret
+
+00000000008016b8 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016b8:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016bf:	ff ff ff 
+  8016c2:	48 01 f8             	add    %rdi,%rax
+  8016c5:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016c9:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016cf:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016d3:	c3                   	ret
+
+00000000008016d4 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8016d4:	55                   	push   %rbp
+  8016d5:	48 89 e5             	mov    %rsp,%rbp
+  8016d8:	41 57                	push   %r15
+  8016da:	41 56                	push   %r14
+  8016dc:	41 55                	push   %r13
+  8016de:	41 54                	push   %r12
+  8016e0:	53                   	push   %rbx
+  8016e1:	48 83 ec 08          	sub    $0x8,%rsp
+  8016e5:	49 89 ff             	mov    %rdi,%r15
+  8016e8:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016ed:	49 bd 07 40 80 00 00 	movabs $0x804007,%r13
+  8016f4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8016f7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016fd:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801700:	48 89 df             	mov    %rbx,%rdi
+  801703:	41 ff d5             	call   *%r13
+  801706:	83 e0 04             	and    $0x4,%eax
+  801709:	74 17                	je     801722 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80170b:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801712:	4c 39 f3             	cmp    %r14,%rbx
+  801715:	75 e6                	jne    8016fd <fd_alloc+0x29>
+  801717:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80171d:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801722:	4d 89 27             	mov    %r12,(%r15)
+}
+  801725:	48 83 c4 08          	add    $0x8,%rsp
+  801729:	5b                   	pop    %rbx
+  80172a:	41 5c                	pop    %r12
+  80172c:	41 5d                	pop    %r13
+  80172e:	41 5e                	pop    %r14
+  801730:	41 5f                	pop    %r15
+  801732:	5d                   	pop    %rbp
+  801733:	c3                   	ret
+
+0000000000801734 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801734:	83 ff 1f             	cmp    $0x1f,%edi
+  801737:	77 39                	ja     801772 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801739:	55                   	push   %rbp
+  80173a:	48 89 e5             	mov    %rsp,%rbp
+  80173d:	41 54                	push   %r12
+  80173f:	53                   	push   %rbx
+  801740:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801743:	48 63 df             	movslq %edi,%rbx
+  801746:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80174d:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801751:	48 89 df             	mov    %rbx,%rdi
+  801754:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  80175b:	00 00 00 
+  80175e:	ff d0                	call   *%rax
+  801760:	a8 04                	test   $0x4,%al
+  801762:	74 14                	je     801778 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801764:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801768:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80176d:	5b                   	pop    %rbx
+  80176e:	41 5c                	pop    %r12
+  801770:	5d                   	pop    %rbp
+  801771:	c3                   	ret
+        return -E_INVAL;
+  801772:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801777:	c3                   	ret
+        return -E_INVAL;
+  801778:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80177d:	eb ee                	jmp    80176d <fd_lookup+0x39>
+
+000000000080177f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80177f:	55                   	push   %rbp
+  801780:	48 89 e5             	mov    %rsp,%rbp
+  801783:	41 54                	push   %r12
+  801785:	53                   	push   %rbx
+  801786:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801789:	48 b8 80 50 80 00 00 	movabs $0x805080,%rax
+  801790:	00 00 00 
+  801793:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80179a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80179d:	39 3b                	cmp    %edi,(%rbx)
+  80179f:	74 47                	je     8017e8 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017a1:	48 83 c0 08          	add    $0x8,%rax
+  8017a5:	48 8b 18             	mov    (%rax),%rbx
+  8017a8:	48 85 db             	test   %rbx,%rbx
+  8017ab:	75 f0                	jne    80179d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017ad:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  8017b4:	00 00 00 
+  8017b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017bd:	89 fa                	mov    %edi,%edx
+  8017bf:	48 bf e8 4f 80 00 00 	movabs $0x804fe8,%rdi
+  8017c6:	00 00 00 
+  8017c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ce:	48 b9 ef 03 80 00 00 	movabs $0x8003ef,%rcx
+  8017d5:	00 00 00 
+  8017d8:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8017df:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8017e3:	5b                   	pop    %rbx
+  8017e4:	41 5c                	pop    %r12
+  8017e6:	5d                   	pop    %rbp
+  8017e7:	c3                   	ret
+            return 0;
+  8017e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ed:	eb f0                	jmp    8017df <dev_lookup+0x60>
+
+00000000008017ef <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8017ef:	55                   	push   %rbp
+  8017f0:	48 89 e5             	mov    %rsp,%rbp
+  8017f3:	41 55                	push   %r13
+  8017f5:	41 54                	push   %r12
+  8017f7:	53                   	push   %rbx
+  8017f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8017fc:	48 89 fb             	mov    %rdi,%rbx
+  8017ff:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801802:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801809:	ff ff ff 
+  80180c:	48 01 df             	add    %rbx,%rdi
+  80180f:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801813:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801817:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  80181e:	00 00 00 
+  801821:	ff d0                	call   *%rax
+  801823:	41 89 c5             	mov    %eax,%r13d
+  801826:	85 c0                	test   %eax,%eax
+  801828:	78 06                	js     801830 <fd_close+0x41>
+  80182a:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80182e:	74 1a                	je     80184a <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801830:	45 84 e4             	test   %r12b,%r12b
+  801833:	b8 00 00 00 00       	mov    $0x0,%eax
+  801838:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80183c:	44 89 e8             	mov    %r13d,%eax
+  80183f:	48 83 c4 18          	add    $0x18,%rsp
+  801843:	5b                   	pop    %rbx
+  801844:	41 5c                	pop    %r12
+  801846:	41 5d                	pop    %r13
+  801848:	5d                   	pop    %rbp
+  801849:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80184a:	8b 3b                	mov    (%rbx),%edi
+  80184c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801850:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801857:	00 00 00 
+  80185a:	ff d0                	call   *%rax
+  80185c:	41 89 c5             	mov    %eax,%r13d
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	78 1b                	js     80187e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801863:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801867:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80186b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801871:	48 85 c0             	test   %rax,%rax
+  801874:	74 08                	je     80187e <fd_close+0x8f>
+  801876:	48 89 df             	mov    %rbx,%rdi
+  801879:	ff d0                	call   *%rax
+  80187b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80187e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801883:	48 89 de             	mov    %rbx,%rsi
+  801886:	bf 00 00 00 00       	mov    $0x0,%edi
+  80188b:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  801892:	00 00 00 
+  801895:	ff d0                	call   *%rax
+    return res;
+  801897:	eb a3                	jmp    80183c <fd_close+0x4d>
+
+0000000000801899 <close>:
+
+int
+close(int fdnum) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018a5:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  8018ac:	00 00 00 
+  8018af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018b1:	85 c0                	test   %eax,%eax
+  8018b3:	78 15                	js     8018ca <close+0x31>
+
+    return fd_close(fd, 1);
+  8018b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8018ba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018be:	48 b8 ef 17 80 00 00 	movabs $0x8017ef,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+}
+  8018ca:	c9                   	leave
+  8018cb:	c3                   	ret
+
+00000000008018cc <close_all>:
+
+void
+close_all(void) {
+  8018cc:	55                   	push   %rbp
+  8018cd:	48 89 e5             	mov    %rsp,%rbp
+  8018d0:	41 54                	push   %r12
+  8018d2:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018d3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018d8:	49 bc 99 18 80 00 00 	movabs $0x801899,%r12
+  8018df:	00 00 00 
+  8018e2:	89 df                	mov    %ebx,%edi
+  8018e4:	41 ff d4             	call   *%r12
+  8018e7:	83 c3 01             	add    $0x1,%ebx
+  8018ea:	83 fb 20             	cmp    $0x20,%ebx
+  8018ed:	75 f3                	jne    8018e2 <close_all+0x16>
+}
+  8018ef:	5b                   	pop    %rbx
+  8018f0:	41 5c                	pop    %r12
+  8018f2:	5d                   	pop    %rbp
+  8018f3:	c3                   	ret
+
+00000000008018f4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8018f4:	55                   	push   %rbp
+  8018f5:	48 89 e5             	mov    %rsp,%rbp
+  8018f8:	41 57                	push   %r15
+  8018fa:	41 56                	push   %r14
+  8018fc:	41 55                	push   %r13
+  8018fe:	41 54                	push   %r12
+  801900:	53                   	push   %rbx
+  801901:	48 83 ec 18          	sub    $0x18,%rsp
+  801905:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801908:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80190c:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801913:	00 00 00 
+  801916:	ff d0                	call   *%rax
+  801918:	89 c3                	mov    %eax,%ebx
+  80191a:	85 c0                	test   %eax,%eax
+  80191c:	0f 88 b8 00 00 00    	js     8019da <dup+0xe6>
+    close(newfdnum);
+  801922:	44 89 e7             	mov    %r12d,%edi
+  801925:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  80192c:	00 00 00 
+  80192f:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801931:	4d 63 ec             	movslq %r12d,%r13
+  801934:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80193b:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80193f:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801943:	4c 89 ff             	mov    %r15,%rdi
+  801946:	49 be b8 16 80 00 00 	movabs $0x8016b8,%r14
+  80194d:	00 00 00 
+  801950:	41 ff d6             	call   *%r14
+  801953:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801956:	4c 89 ef             	mov    %r13,%rdi
+  801959:	41 ff d6             	call   *%r14
+  80195c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80195f:	48 89 df             	mov    %rbx,%rdi
+  801962:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  801969:	00 00 00 
+  80196c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80196e:	a8 04                	test   $0x4,%al
+  801970:	74 2b                	je     80199d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801972:	41 89 c1             	mov    %eax,%r9d
+  801975:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80197b:	4c 89 f1             	mov    %r14,%rcx
+  80197e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801983:	48 89 de             	mov    %rbx,%rsi
+  801986:	bf 00 00 00 00       	mov    $0x0,%edi
+  80198b:	48 b8 c9 12 80 00 00 	movabs $0x8012c9,%rax
+  801992:	00 00 00 
+  801995:	ff d0                	call   *%rax
+  801997:	89 c3                	mov    %eax,%ebx
+  801999:	85 c0                	test   %eax,%eax
+  80199b:	78 4e                	js     8019eb <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80199d:	4c 89 ff             	mov    %r15,%rdi
+  8019a0:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  8019a7:	00 00 00 
+  8019aa:	ff d0                	call   *%rax
+  8019ac:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019af:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019b5:	4c 89 e9             	mov    %r13,%rcx
+  8019b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bd:	4c 89 fe             	mov    %r15,%rsi
+  8019c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c5:	48 b8 c9 12 80 00 00 	movabs $0x8012c9,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+  8019d1:	89 c3                	mov    %eax,%ebx
+  8019d3:	85 c0                	test   %eax,%eax
+  8019d5:	78 14                	js     8019eb <dup+0xf7>
+
+    return newfdnum;
+  8019d7:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019da:	89 d8                	mov    %ebx,%eax
+  8019dc:	48 83 c4 18          	add    $0x18,%rsp
+  8019e0:	5b                   	pop    %rbx
+  8019e1:	41 5c                	pop    %r12
+  8019e3:	41 5d                	pop    %r13
+  8019e5:	41 5e                	pop    %r14
+  8019e7:	41 5f                	pop    %r15
+  8019e9:	5d                   	pop    %rbp
+  8019ea:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019f0:	4c 89 ee             	mov    %r13,%rsi
+  8019f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f8:	49 bc 19 13 80 00 00 	movabs $0x801319,%r12
+  8019ff:	00 00 00 
+  801a02:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a0a:	4c 89 f6             	mov    %r14,%rsi
+  801a0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a12:	41 ff d4             	call   *%r12
+    return res;
+  801a15:	eb c3                	jmp    8019da <dup+0xe6>
+
+0000000000801a17 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a17:	55                   	push   %rbp
+  801a18:	48 89 e5             	mov    %rsp,%rbp
+  801a1b:	41 56                	push   %r14
+  801a1d:	41 55                	push   %r13
+  801a1f:	41 54                	push   %r12
+  801a21:	53                   	push   %rbx
+  801a22:	48 83 ec 10          	sub    $0x10,%rsp
+  801a26:	89 fb                	mov    %edi,%ebx
+  801a28:	49 89 f4             	mov    %rsi,%r12
+  801a2b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a2e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a32:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 4c                	js     801a8e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a42:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a46:	41 8b 3e             	mov    (%r14),%edi
+  801a49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a4d:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801a54:	00 00 00 
+  801a57:	ff d0                	call   *%rax
+  801a59:	85 c0                	test   %eax,%eax
+  801a5b:	78 35                	js     801a92 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a5d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a61:	83 e0 03             	and    $0x3,%eax
+  801a64:	83 f8 01             	cmp    $0x1,%eax
+  801a67:	74 2d                	je     801a96 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a6d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a71:	48 85 c0             	test   %rax,%rax
+  801a74:	74 56                	je     801acc <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a76:	4c 89 ea             	mov    %r13,%rdx
+  801a79:	4c 89 e6             	mov    %r12,%rsi
+  801a7c:	4c 89 f7             	mov    %r14,%rdi
+  801a7f:	ff d0                	call   *%rax
+}
+  801a81:	48 83 c4 10          	add    $0x10,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	41 5e                	pop    %r14
+  801a8c:	5d                   	pop    %rbp
+  801a8d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a8e:	48 98                	cltq
+  801a90:	eb ef                	jmp    801a81 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a92:	48 98                	cltq
+  801a94:	eb eb                	jmp    801a81 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a96:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801a9d:	00 00 00 
+  801aa0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801aa6:	89 da                	mov    %ebx,%edx
+  801aa8:	48 bf 29 50 80 00 00 	movabs $0x805029,%rdi
+  801aaf:	00 00 00 
+  801ab2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab7:	48 b9 ef 03 80 00 00 	movabs $0x8003ef,%rcx
+  801abe:	00 00 00 
+  801ac1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ac3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801aca:	eb b5                	jmp    801a81 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801acc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ad3:	eb ac                	jmp    801a81 <read+0x6a>
+
+0000000000801ad5 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 57                	push   %r15
+  801adb:	41 56                	push   %r14
+  801add:	41 55                	push   %r13
+  801adf:	41 54                	push   %r12
+  801ae1:	53                   	push   %rbx
+  801ae2:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ae6:	48 85 d2             	test   %rdx,%rdx
+  801ae9:	74 54                	je     801b3f <readn+0x6a>
+  801aeb:	41 89 fd             	mov    %edi,%r13d
+  801aee:	49 89 f6             	mov    %rsi,%r14
+  801af1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801af4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801af9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801afe:	49 bf 17 1a 80 00 00 	movabs $0x801a17,%r15
+  801b05:	00 00 00 
+  801b08:	4c 89 e2             	mov    %r12,%rdx
+  801b0b:	48 29 f2             	sub    %rsi,%rdx
+  801b0e:	4c 01 f6             	add    %r14,%rsi
+  801b11:	44 89 ef             	mov    %r13d,%edi
+  801b14:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b17:	85 c0                	test   %eax,%eax
+  801b19:	78 20                	js     801b3b <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b1b:	01 c3                	add    %eax,%ebx
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	74 08                	je     801b29 <readn+0x54>
+  801b21:	48 63 f3             	movslq %ebx,%rsi
+  801b24:	4c 39 e6             	cmp    %r12,%rsi
+  801b27:	72 df                	jb     801b08 <readn+0x33>
+    }
+    return res;
+  801b29:	48 63 c3             	movslq %ebx,%rax
+}
+  801b2c:	48 83 c4 08          	add    $0x8,%rsp
+  801b30:	5b                   	pop    %rbx
+  801b31:	41 5c                	pop    %r12
+  801b33:	41 5d                	pop    %r13
+  801b35:	41 5e                	pop    %r14
+  801b37:	41 5f                	pop    %r15
+  801b39:	5d                   	pop    %rbp
+  801b3a:	c3                   	ret
+        if (inc < 0) return inc;
+  801b3b:	48 98                	cltq
+  801b3d:	eb ed                	jmp    801b2c <readn+0x57>
+    int inc = 1, res = 0;
+  801b3f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b44:	eb e3                	jmp    801b29 <readn+0x54>
+
+0000000000801b46 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b46:	55                   	push   %rbp
+  801b47:	48 89 e5             	mov    %rsp,%rbp
+  801b4a:	41 56                	push   %r14
+  801b4c:	41 55                	push   %r13
+  801b4e:	41 54                	push   %r12
+  801b50:	53                   	push   %rbx
+  801b51:	48 83 ec 10          	sub    $0x10,%rsp
+  801b55:	89 fb                	mov    %edi,%ebx
+  801b57:	49 89 f4             	mov    %rsi,%r12
+  801b5a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b5d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b61:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801b68:	00 00 00 
+  801b6b:	ff d0                	call   *%rax
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 47                	js     801bb8 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b71:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b75:	41 8b 3e             	mov    (%r14),%edi
+  801b78:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b7c:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801b83:	00 00 00 
+  801b86:	ff d0                	call   *%rax
+  801b88:	85 c0                	test   %eax,%eax
+  801b8a:	78 30                	js     801bbc <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b8c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b91:	74 2d                	je     801bc0 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b97:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b9b:	48 85 c0             	test   %rax,%rax
+  801b9e:	74 56                	je     801bf6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801ba0:	4c 89 ea             	mov    %r13,%rdx
+  801ba3:	4c 89 e6             	mov    %r12,%rsi
+  801ba6:	4c 89 f7             	mov    %r14,%rdi
+  801ba9:	ff d0                	call   *%rax
+}
+  801bab:	48 83 c4 10          	add    $0x10,%rsp
+  801baf:	5b                   	pop    %rbx
+  801bb0:	41 5c                	pop    %r12
+  801bb2:	41 5d                	pop    %r13
+  801bb4:	41 5e                	pop    %r14
+  801bb6:	5d                   	pop    %rbp
+  801bb7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb8:	48 98                	cltq
+  801bba:	eb ef                	jmp    801bab <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bbc:	48 98                	cltq
+  801bbe:	eb eb                	jmp    801bab <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bc0:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801bc7:	00 00 00 
+  801bca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bd0:	89 da                	mov    %ebx,%edx
+  801bd2:	48 bf 45 50 80 00 00 	movabs $0x805045,%rdi
+  801bd9:	00 00 00 
+  801bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801be1:	48 b9 ef 03 80 00 00 	movabs $0x8003ef,%rcx
+  801be8:	00 00 00 
+  801beb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bed:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bf4:	eb b5                	jmp    801bab <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bf6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bfd:	eb ac                	jmp    801bab <write+0x65>
+
+0000000000801bff <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801bff:	55                   	push   %rbp
+  801c00:	48 89 e5             	mov    %rsp,%rbp
+  801c03:	41 54                	push   %r12
+  801c05:	53                   	push   %rbx
+  801c06:	48 83 ec 10          	sub    $0x10,%rsp
+  801c0a:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c0c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c10:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 3e                	js     801c5e <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c20:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c24:	41 8b 3c 24          	mov    (%r12),%edi
+  801c28:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c2c:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801c33:	00 00 00 
+  801c36:	ff d0                	call   *%rax
+  801c38:	85 c0                	test   %eax,%eax
+  801c3a:	78 22                	js     801c5e <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c3c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c40:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c44:	48 85 c0             	test   %rax,%rax
+  801c47:	74 0b                	je     801c54 <seek+0x55>
+  801c49:	89 de                	mov    %ebx,%esi
+  801c4b:	4c 89 e7             	mov    %r12,%rdi
+  801c4e:	ff d0                	call   *%rax
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	78 0a                	js     801c5e <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801c54:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801c59:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c5e:	48 83 c4 10          	add    $0x10,%rsp
+  801c62:	5b                   	pop    %rbx
+  801c63:	41 5c                	pop    %r12
+  801c65:	5d                   	pop    %rbp
+  801c66:	c3                   	ret
+
+0000000000801c67 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c67:	55                   	push   %rbp
+  801c68:	48 89 e5             	mov    %rsp,%rbp
+  801c6b:	41 55                	push   %r13
+  801c6d:	41 54                	push   %r12
+  801c6f:	53                   	push   %rbx
+  801c70:	48 83 ec 18          	sub    $0x18,%rsp
+  801c74:	89 fb                	mov    %edi,%ebx
+  801c76:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c79:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c7d:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801c84:	00 00 00 
+  801c87:	ff d0                	call   *%rax
+  801c89:	85 c0                	test   %eax,%eax
+  801c8b:	78 38                	js     801cc5 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c91:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c95:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c99:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801ca0:	00 00 00 
+  801ca3:	ff d0                	call   *%rax
+  801ca5:	85 c0                	test   %eax,%eax
+  801ca7:	78 1c                	js     801cc5 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca9:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cae:	74 20                	je     801cd0 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cb0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb4:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cb8:	48 85 c0             	test   %rax,%rax
+  801cbb:	74 47                	je     801d04 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cbd:	44 89 e6             	mov    %r12d,%esi
+  801cc0:	4c 89 ef             	mov    %r13,%rdi
+  801cc3:	ff d0                	call   *%rax
+}
+  801cc5:	48 83 c4 18          	add    $0x18,%rsp
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5c                	pop    %r12
+  801ccc:	41 5d                	pop    %r13
+  801cce:	5d                   	pop    %rbp
+  801ccf:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cd0:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801cd7:	00 00 00 
+  801cda:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ce0:	89 da                	mov    %ebx,%edx
+  801ce2:	48 bf 08 50 80 00 00 	movabs $0x805008,%rdi
+  801ce9:	00 00 00 
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf1:	48 b9 ef 03 80 00 00 	movabs $0x8003ef,%rcx
+  801cf8:	00 00 00 
+  801cfb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cfd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d02:	eb c1                	jmp    801cc5 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d04:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d09:	eb ba                	jmp    801cc5 <ftruncate+0x5e>
+
+0000000000801d0b <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d0b:	55                   	push   %rbp
+  801d0c:	48 89 e5             	mov    %rsp,%rbp
+  801d0f:	41 54                	push   %r12
+  801d11:	53                   	push   %rbx
+  801d12:	48 83 ec 10          	sub    $0x10,%rsp
+  801d16:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d19:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d1d:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  801d24:	00 00 00 
+  801d27:	ff d0                	call   *%rax
+  801d29:	85 c0                	test   %eax,%eax
+  801d2b:	78 4e                	js     801d7b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2d:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d31:	41 8b 3c 24          	mov    (%r12),%edi
+  801d35:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d39:	48 b8 7f 17 80 00 00 	movabs $0x80177f,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 32                	js     801d7b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d49:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d4d:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d52:	74 30                	je     801d84 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d54:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d57:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d5e:	00 00 00 
+    stat->st_isdir = 0;
+  801d61:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d68:	00 00 00 
+    stat->st_dev = dev;
+  801d6b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d72:	48 89 de             	mov    %rbx,%rsi
+  801d75:	4c 89 e7             	mov    %r12,%rdi
+  801d78:	ff 50 28             	call   *0x28(%rax)
+}
+  801d7b:	48 83 c4 10          	add    $0x10,%rsp
+  801d7f:	5b                   	pop    %rbx
+  801d80:	41 5c                	pop    %r12
+  801d82:	5d                   	pop    %rbp
+  801d83:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d84:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d89:	eb f0                	jmp    801d7b <fstat+0x70>
+
+0000000000801d8b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d8b:	55                   	push   %rbp
+  801d8c:	48 89 e5             	mov    %rsp,%rbp
+  801d8f:	41 54                	push   %r12
+  801d91:	53                   	push   %rbx
+  801d92:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d95:	be 00 00 00 00       	mov    $0x0,%esi
+  801d9a:	48 b8 f9 2e 80 00 00 	movabs $0x802ef9,%rax
+  801da1:	00 00 00 
+  801da4:	ff d0                	call   *%rax
+  801da6:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801da8:	85 c0                	test   %eax,%eax
+  801daa:	78 25                	js     801dd1 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dac:	4c 89 e6             	mov    %r12,%rsi
+  801daf:	89 c7                	mov    %eax,%edi
+  801db1:	48 b8 0b 1d 80 00 00 	movabs $0x801d0b,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dc0:	89 df                	mov    %ebx,%edi
+  801dc2:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+
+    return res;
+  801dce:	44 89 e3             	mov    %r12d,%ebx
+}
+  801dd1:	89 d8                	mov    %ebx,%eax
+  801dd3:	5b                   	pop    %rbx
+  801dd4:	41 5c                	pop    %r12
+  801dd6:	5d                   	pop    %rbp
+  801dd7:	c3                   	ret
+
+0000000000801dd8 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dd8:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801ddf:	00 00 00 
+  801de2:	83 38 00             	cmpl   $0x0,(%rax)
+  801de5:	74 0a                	je     801df1 <fsenv+0x19>
+    return envid;
+}
+  801de7:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801dee:	00 00 
+  801df0:	c3                   	ret
+fsenv(void) {
+  801df1:	55                   	push   %rbp
+  801df2:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801df5:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dfa:	48 b8 6a 49 80 00 00 	movabs $0x80496a,%rax
+  801e01:	00 00 00 
+  801e04:	ff d0                	call   *%rax
+  801e06:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e0d:	00 00 
+}
+  801e0f:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e16:	00 00 
+  801e18:	5d                   	pop    %rbp
+  801e19:	c3                   	ret
+
+0000000000801e1a <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e1a:	55                   	push   %rbp
+  801e1b:	48 89 e5             	mov    %rsp,%rbp
+  801e1e:	41 54                	push   %r12
+  801e20:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e21:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e26:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e2b:	48 89 de             	mov    %rbx,%rsi
+  801e2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e33:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  801e3a:	00 00 00 
+  801e3d:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e3f:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e46:	00 00 00 
+  801e49:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e4f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801e54:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e59:	48 89 de             	mov    %rbx,%rsi
+  801e5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e61:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  801e68:	00 00 00 
+  801e6b:	ff d0                	call   *%rax
+  801e6d:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801e6f:	85 c0                	test   %eax,%eax
+  801e71:	0f 88 a2 00 00 00    	js     801f19 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e77:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801e7e:	00 00 00 
+  801e81:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e87:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e8c:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e8e:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e93:	49 bc cf 41 80 00 00 	movabs $0x8041cf,%r12
+  801e9a:	00 00 00 
+  801e9d:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801ea0:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801ea5:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ea8:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  801eaf:	00 00 00 
+  801eb2:	ff d0                	call   *%rax
+  801eb4:	89 c7                	mov    %eax,%edi
+  801eb6:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801ebc:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ec1:	48 89 da             	mov    %rbx,%rdx
+  801ec4:	be 09 00 00 00       	mov    $0x9,%esi
+  801ec9:	48 b8 14 49 80 00 00 	movabs $0x804914,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801ed5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801edf:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ee9:	48 b8 f0 48 80 00 00 	movabs $0x8048f0,%rax
+  801ef0:	00 00 00 
+  801ef3:	ff d0                	call   *%rax
+  801ef5:	89 c3                	mov    %eax,%ebx
+  801ef7:	85 c0                	test   %eax,%eax
+  801ef9:	78 25                	js     801f20 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801efb:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801f02:	00 00 00 
+  801f05:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f0b:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f12:	00 00 
+    return 0;
+  801f14:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f19:	89 d8                	mov    %ebx,%eax
+  801f1b:	5b                   	pop    %rbx
+  801f1c:	41 5c                	pop    %r12
+  801f1e:	5d                   	pop    %rbp
+  801f1f:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f20:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f25:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f2f:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  801f36:	00 00 00 
+  801f39:	ff d0                	call   *%rax
+        return res;
+  801f3b:	eb dc                	jmp    801f19 <fschan_setup+0xff>
+
+0000000000801f3d <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f3d:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f44:	00 00 00 
+  801f47:	80 38 00             	cmpb   $0x0,(%rax)
+  801f4a:	74 55                	je     801fa1 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f4c:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  801f53:	00 00 00 
+  801f56:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801f5c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f61:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801f68:	00 00 00 
+  801f6b:	3b 0a                	cmp    (%rdx),%ecx
+  801f6d:	75 01                	jne    801f70 <fschan+0x33>
+}
+  801f6f:	c3                   	ret
+fschan(void) {
+  801f70:	55                   	push   %rbp
+  801f71:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f74:	48 b8 1a 1e 80 00 00 	movabs $0x801e1a,%rax
+  801f7b:	00 00 00 
+  801f7e:	ff d0                	call   *%rax
+  801f80:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f82:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f87:	85 d2                	test   %edx,%edx
+  801f89:	78 02                	js     801f8d <fschan+0x50>
+}
+  801f8b:	5d                   	pop    %rbp
+  801f8c:	c3                   	ret
+        fschan_enabled = 0;
+  801f8d:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f94:	00 00 00 
+  801f97:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9f:	eb ea                	jmp    801f8b <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa6:	c3                   	ret
+
+0000000000801fa7 <fbuf>:
+fbuf(struct Fd *fd) {
+  801fa7:	55                   	push   %rbp
+  801fa8:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801fab:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fbc:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801fc0:	77 12                	ja     801fd4 <fbuf+0x2d>
+  801fc2:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801fc6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801fcd:	00 00 00 
+  801fd0:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801fd4:	48 89 d0             	mov    %rdx,%rax
+  801fd7:	5d                   	pop    %rbp
+  801fd8:	c3                   	ret
+
+0000000000801fd9 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801fdd:	48 83 c7 40          	add    $0x40,%rdi
+  801fe1:	48 b8 09 42 80 00 00 	movabs $0x804209,%rax
+  801fe8:	00 00 00 
+  801feb:	ff d0                	call   *%rax
+  801fed:	84 c0                	test   %al,%al
+  801fef:	75 02                	jne    801ff3 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801ff1:	5d                   	pop    %rbp
+  801ff2:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801ff3:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+  801fff:	89 c7                	mov    %eax,%edi
+  802001:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802007:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80200c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802011:	be 0a 00 00 00       	mov    $0xa,%esi
+  802016:	48 b8 14 49 80 00 00 	movabs $0x804914,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+}
+  802022:	eb cd                	jmp    801ff1 <fschan_publish+0x18>
+
+0000000000802024 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+  802028:	41 57                	push   %r15
+  80202a:	41 56                	push   %r14
+  80202c:	41 55                	push   %r13
+  80202e:	41 54                	push   %r12
+  802030:	53                   	push   %rbx
+  802031:	48 83 ec 48          	sub    $0x48,%rsp
+  802035:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80203d:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802040:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802044:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802047:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80204e:	00 00 00 
+  802051:	8b 02                	mov    (%rdx),%eax
+  802053:	83 c0 01             	add    $0x1,%eax
+  802056:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80205b:	0f 44 c1             	cmove  %ecx,%eax
+  80205e:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802060:	4d 85 c0             	test   %r8,%r8
+  802063:	74 2c                	je     802091 <fschan_rw+0x6d>
+  802065:	45 89 ce             	mov    %r9d,%r14d
+  802068:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80206f:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802073:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802079:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802080:	00 
+  802081:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802087:	b8 01 00 00 00       	mov    $0x1,%eax
+  80208c:	e9 41 01 00 00       	jmp    8021d2 <fschan_rw+0x1ae>
+  802091:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802095:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802099:	e9 9c 01 00 00       	jmp    80223a <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80209e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8020a2:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8020a5:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8020a8:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8020ab:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8020af:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020b3:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8020b7:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8020bb:	48 89 da             	mov    %rbx,%rdx
+  8020be:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  8020c5:	00 00 00 
+  8020c8:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8020ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020ce:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  8020d5:	00 00 00 
+  8020d8:	ff d0                	call   *%rax
+            queued += blk;
+  8020da:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8020dd:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8020e1:	4d 39 fc             	cmp    %r15,%r12
+  8020e4:	73 6b                	jae    802151 <fschan_rw+0x12d>
+  8020e6:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8020ea:	77 65                	ja     802151 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8020ec:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020f0:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8020f4:	48 b8 e4 41 80 00 00 	movabs $0x8041e4,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802100:	4c 89 fb             	mov    %r15,%rbx
+  802103:	4c 29 e3             	sub    %r12,%rbx
+  802106:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80210b:	48 39 d3             	cmp    %rdx,%rbx
+  80210e:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802112:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802116:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80211a:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80211e:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802121:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802123:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80212a:	00 00 00 
+  80212d:	8b 09                	mov    (%rcx),%ecx
+  80212f:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802132:	83 fe 03             	cmp    $0x3,%esi
+  802135:	0f 85 63 ff ff ff    	jne    80209e <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80213b:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80213f:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802142:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802145:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802148:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80214c:	e9 79 ff ff ff       	jmp    8020ca <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802151:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802155:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80215c:	48 89 df             	mov    %rbx,%rdi
+  80215f:	48 b8 a7 42 80 00 00 	movabs $0x8042a7,%rax
+  802166:	00 00 00 
+  802169:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80216b:	48 89 df             	mov    %rbx,%rdi
+  80216e:	48 b8 35 42 80 00 00 	movabs $0x804235,%rax
+  802175:	00 00 00 
+  802178:	ff d0                	call   *%rax
+  80217a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80217e:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802182:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802186:	75 25                	jne    8021ad <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802188:	8b 40 04             	mov    0x4(%rax),%eax
+  80218b:	85 c0                	test   %eax,%eax
+  80218d:	0f 88 86 00 00 00    	js     802219 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802193:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802197:	74 5b                	je     8021f4 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802199:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80219d:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8021a1:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8021a5:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8021a9:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8021ad:	48 89 df             	mov    %rbx,%rdi
+  8021b0:	48 b8 5c 42 80 00 00 	movabs $0x80425c,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8021bc:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8021c0:	83 f0 01             	xor    $0x1,%eax
+  8021c3:	4d 39 fc             	cmp    %r15,%r12
+  8021c6:	0f 92 c2             	setb   %dl
+  8021c9:	84 c2                	test   %al,%dl
+  8021cb:	75 05                	jne    8021d2 <fschan_rw+0x1ae>
+  8021cd:	45 85 ed             	test   %r13d,%r13d
+  8021d0:	74 50                	je     802222 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021d2:	4d 39 fc             	cmp    %r15,%r12
+  8021d5:	0f 92 c1             	setb   %cl
+  8021d8:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8021dc:	0f 96 c2             	setbe  %dl
+  8021df:	84 d1                	test   %dl,%cl
+  8021e1:	0f 84 6a ff ff ff    	je     802151 <fschan_rw+0x12d>
+  8021e7:	84 c0                	test   %al,%al
+  8021e9:	0f 85 fd fe ff ff    	jne    8020ec <fschan_rw+0xc8>
+  8021ef:	e9 5d ff ff ff       	jmp    802151 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021f4:	48 63 d0             	movslq %eax,%rdx
+  8021f7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8021fb:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8021ff:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802203:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802207:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80220b:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  802212:	00 00 00 
+  802215:	ff d0                	call   *%rax
+  802217:	eb 80                	jmp    802199 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802219:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80221c:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802220:	eb 8b                	jmp    8021ad <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802222:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802227:	0f 85 68 fe ff ff    	jne    802095 <fschan_rw+0x71>
+  80222d:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802230:	85 c0                	test   %eax,%eax
+  802232:	0f 84 5d fe ff ff    	je     802095 <fschan_rw+0x71>
+  802238:	48 98                	cltq
+}
+  80223a:	48 83 c4 48          	add    $0x48,%rsp
+  80223e:	5b                   	pop    %rbx
+  80223f:	41 5c                	pop    %r12
+  802241:	41 5d                	pop    %r13
+  802243:	41 5e                	pop    %r14
+  802245:	41 5f                	pop    %r15
+  802247:	5d                   	pop    %rbp
+  802248:	c3                   	ret
+
+0000000000802249 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802249:	55                   	push   %rbp
+  80224a:	48 89 e5             	mov    %rsp,%rbp
+  80224d:	41 56                	push   %r14
+  80224f:	41 55                	push   %r13
+  802251:	41 54                	push   %r12
+  802253:	53                   	push   %rbx
+  802254:	48 83 ec 10          	sub    $0x10,%rsp
+  802258:	49 89 fe             	mov    %rdi,%r14
+  80225b:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80225e:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802262:	48 29 f3             	sub    %rsi,%rbx
+  802265:	48 39 d3             	cmp    %rdx,%rbx
+  802268:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80226c:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802273:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802274:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802279:	49 bd 66 40 80 00 00 	movabs $0x804066,%r13
+  802280:	00 00 00 
+  802283:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80228a:	76 1e                	jbe    8022aa <mmap_fault+0x61>
+  80228c:	4c 01 e7             	add    %r12,%rdi
+  80228f:	41 ff d5             	call   *%r13
+  802292:	84 c0                	test   %al,%al
+  802294:	75 14                	jne    8022aa <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802296:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80229a:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8022a1:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8022a5:	48 39 df             	cmp    %rbx,%rdi
+  8022a8:	72 e2                	jb     80228c <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8022aa:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8022b1:	00 00 00 
+  8022b4:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022bb:	00 00 00 
+  8022be:	4c 89 f0             	mov    %r14,%rax
+  8022c1:	48 29 d0             	sub    %rdx,%rax
+  8022c4:	48 c1 f8 03          	sar    $0x3,%rax
+  8022c8:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8022cf:	aa aa aa 
+  8022d2:	48 0f af c2          	imul   %rdx,%rax
+  8022d6:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022da:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8022df:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8022e3:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8022e5:	44 89 e0             	mov    %r12d,%eax
+  8022e8:	41 03 46 10          	add    0x10(%r14),%eax
+  8022ec:	41 2b 06             	sub    (%r14),%eax
+  8022ef:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8022f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022f6:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8022fa:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8022fe:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802301:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  802308:	00 00 00 
+  80230b:	ff d0                	call   *%rax
+  80230d:	89 c7                	mov    %eax,%edi
+  80230f:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802315:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80231a:	48 89 da             	mov    %rbx,%rdx
+  80231d:	be 0f 00 00 00       	mov    $0xf,%esi
+  802322:	48 b8 14 49 80 00 00 	movabs $0x804914,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80232e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802333:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802337:	4c 89 e6             	mov    %r12,%rsi
+  80233a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80233f:	48 b8 f0 48 80 00 00 	movabs $0x8048f0,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+  80234b:	48 98                	cltq
+}
+  80234d:	48 83 c4 10          	add    $0x10,%rsp
+  802351:	5b                   	pop    %rbx
+  802352:	41 5c                	pop    %r12
+  802354:	41 5d                	pop    %r13
+  802356:	41 5e                	pop    %r14
+  802358:	5d                   	pop    %rbp
+  802359:	c3                   	ret
+
+000000000080235a <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80235a:	48 8b 37             	mov    (%rdi),%rsi
+  80235d:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802364:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80236b:	00 00 00 
+  80236e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802373:	eb 0f                	jmp    802384 <mmap_pgfault+0x2a>
+  802375:	c3                   	ret
+  802376:	48 83 c1 01          	add    $0x1,%rcx
+  80237a:	48 83 c2 18          	add    $0x18,%rdx
+  80237e:	48 83 f9 20          	cmp    $0x20,%rcx
+  802382:	74 6e                	je     8023f2 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802384:	48 8b 02             	mov    (%rdx),%rax
+  802387:	48 83 e8 01          	sub    $0x1,%rax
+  80238b:	48 39 f0             	cmp    %rsi,%rax
+  80238e:	73 e6                	jae    802376 <mmap_pgfault+0x1c>
+  802390:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802394:	73 e0                	jae    802376 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802396:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80239a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80239f:	f6 c2 01             	test   $0x1,%dl
+  8023a2:	75 d1                	jne    802375 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8023a4:	f6 c2 02             	test   $0x2,%dl
+  8023a7:	74 1a                	je     8023c3 <mmap_pgfault+0x69>
+  8023a9:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023b2:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8023b9:	00 00 00 
+  8023bc:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8023c1:	74 35                	je     8023f8 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8023c3:	55                   	push   %rbp
+  8023c4:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023c7:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023cb:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023d2:	00 00 00 
+  8023d5:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8023d9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8023de:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	48 85 c0             	test   %rax,%rax
+  8023ed:	0f 9f c0             	setg   %al
+}
+  8023f0:	5d                   	pop    %rbp
+  8023f1:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f7:	c3                   	ret
+}
+  8023f8:	c3                   	ret
+
+00000000008023f9 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8023f9:	55                   	push   %rbp
+  8023fa:	48 89 e5             	mov    %rsp,%rbp
+  8023fd:	41 54                	push   %r12
+  8023ff:	53                   	push   %rbx
+  802400:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802403:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80240a:	00 00 00 
+  80240d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802412:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802416:	74 15                	je     80242d <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802418:	48 83 c3 01          	add    $0x1,%rbx
+  80241c:	48 83 c0 18          	add    $0x18,%rax
+  802420:	48 83 fb 20          	cmp    $0x20,%rbx
+  802424:	75 ec                	jne    802412 <mmap_alloc+0x19>
+    return NULL;
+  802426:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242b:	eb 52                	jmp    80247f <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80242d:	4c 89 e7             	mov    %r12,%rdi
+  802430:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  802437:	00 00 00 
+  80243a:	ff d0                	call   *%rax
+  80243c:	41 89 c1             	mov    %eax,%r9d
+  80243f:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802446:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80244a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802450:	ba 00 00 00 00       	mov    $0x0,%edx
+  802455:	4c 89 e6             	mov    %r12,%rsi
+  802458:	bf 00 00 00 00       	mov    $0x0,%edi
+  80245d:	48 b8 c9 12 80 00 00 	movabs $0x8012c9,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+  802469:	85 c0                	test   %eax,%eax
+  80246b:	78 17                	js     802484 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80246d:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802471:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802478:	00 00 00 
+  80247b:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80247f:	5b                   	pop    %rbx
+  802480:	41 5c                	pop    %r12
+  802482:	5d                   	pop    %rbp
+  802483:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802484:	b8 00 00 00 00       	mov    $0x0,%eax
+  802489:	eb f4                	jmp    80247f <mmap_alloc+0x86>
+
+000000000080248b <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80248b:	55                   	push   %rbp
+  80248c:	48 89 e5             	mov    %rsp,%rbp
+  80248f:	41 56                	push   %r14
+  802491:	41 55                	push   %r13
+  802493:	41 54                	push   %r12
+  802495:	53                   	push   %rbx
+  802496:	48 83 ec 10          	sub    $0x10,%rsp
+  80249a:	41 89 fc             	mov    %edi,%r12d
+  80249d:	49 89 f5             	mov    %rsi,%r13
+  8024a0:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024a3:	48 89 f0             	mov    %rsi,%rax
+  8024a6:	48 09 d0             	or     %rdx,%rax
+  8024a9:	75 0d                	jne    8024b8 <fsipc+0x2d>
+  8024ab:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8024ae:	83 f8 04             	cmp    $0x4,%eax
+  8024b1:	76 7d                	jbe    802530 <fsipc+0xa5>
+  8024b3:	83 ff 0d             	cmp    $0xd,%edi
+  8024b6:	74 78                	je     802530 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8024b8:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+  8024c4:	89 c7                	mov    %eax,%edi
+  8024c6:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8024cd:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8024d4:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8024db:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024e1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8024e8:	00 00 00 
+  8024eb:	44 89 e6             	mov    %r12d,%esi
+  8024ee:	48 b8 14 49 80 00 00 	movabs $0x804914,%rax
+  8024f5:	00 00 00 
+  8024f8:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8024fa:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802501:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802502:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802507:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80250b:	4c 89 ee             	mov    %r13,%rsi
+  80250e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802513:	48 b8 f0 48 80 00 00 	movabs $0x8048f0,%rax
+  80251a:	00 00 00 
+  80251d:	ff d0                	call   *%rax
+  80251f:	89 c3                	mov    %eax,%ebx
+}
+  802521:	89 d8                	mov    %ebx,%eax
+  802523:	48 83 c4 10          	add    $0x10,%rsp
+  802527:	5b                   	pop    %rbx
+  802528:	41 5c                	pop    %r12
+  80252a:	41 5d                	pop    %r13
+  80252c:	41 5e                	pop    %r14
+  80252e:	5d                   	pop    %rbp
+  80252f:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802530:	48 b8 3d 1f 80 00 00 	movabs $0x801f3d,%rax
+  802537:	00 00 00 
+  80253a:	ff d0                	call   *%rax
+  80253c:	49 89 c6             	mov    %rax,%r14
+  80253f:	48 85 c0             	test   %rax,%rax
+  802542:	0f 84 70 ff ff ff    	je     8024b8 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802548:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80254c:	48 b8 e4 41 80 00 00 	movabs $0x8041e4,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802558:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80255b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802562:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802566:	ba 10 00 00 00       	mov    $0x10,%edx
+  80256b:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802572:	00 00 00 
+  802575:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  80257c:	00 00 00 
+  80257f:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802581:	4c 89 f7             	mov    %r14,%rdi
+  802584:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  80258b:	00 00 00 
+  80258e:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802590:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802597:	4c 89 f7             	mov    %r14,%rdi
+  80259a:	48 b8 a7 42 80 00 00 	movabs $0x8042a7,%rax
+  8025a1:	00 00 00 
+  8025a4:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8025a6:	4c 89 f7             	mov    %r14,%rdi
+  8025a9:	48 b8 35 42 80 00 00 	movabs $0x804235,%rax
+  8025b0:	00 00 00 
+  8025b3:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8025b5:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8025b8:	41 83 fc 05          	cmp    $0x5,%r12d
+  8025bc:	75 04                	jne    8025c2 <fsipc+0x137>
+  8025be:	85 db                	test   %ebx,%ebx
+  8025c0:	79 14                	jns    8025d6 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8025c2:	4c 89 f7             	mov    %r14,%rdi
+  8025c5:	48 b8 5c 42 80 00 00 	movabs $0x80425c,%rax
+  8025cc:	00 00 00 
+  8025cf:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8025d1:	e9 4b ff ff ff       	jmp    802521 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8025d6:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025da:	ba 88 00 00 00       	mov    $0x88,%edx
+  8025df:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8025e6:	00 00 00 
+  8025e9:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	eb cb                	jmp    8025c2 <fsipc+0x137>
+
+00000000008025f7 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8025f7:	55                   	push   %rbp
+  8025f8:	48 89 e5             	mov    %rsp,%rbp
+  8025fb:	41 57                	push   %r15
+  8025fd:	41 56                	push   %r14
+  8025ff:	41 55                	push   %r13
+  802601:	41 54                	push   %r12
+  802603:	53                   	push   %rbx
+  802604:	48 83 ec 18          	sub    $0x18,%rsp
+  802608:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80260c:	49 89 f6             	mov    %rsi,%r14
+  80260f:	49 89 d4             	mov    %rdx,%r12
+  802612:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802615:	48 b8 3d 1f 80 00 00 	movabs $0x801f3d,%rax
+  80261c:	00 00 00 
+  80261f:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802621:	48 85 c0             	test   %rax,%rax
+  802624:	0f 85 96 00 00 00    	jne    8026c0 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80262a:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802631:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802632:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802639:	00 00 00 
+    while (n) {
+  80263c:	4d 85 e4             	test   %r12,%r12
+  80263f:	74 79                	je     8026ba <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802641:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802646:	49 39 dc             	cmp    %rbx,%r12
+  802649:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80264d:	48 89 da             	mov    %rbx,%rdx
+  802650:	4c 89 f6             	mov    %r14,%rsi
+  802653:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80265a:	00 00 00 
+  80265d:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802669:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80266d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802670:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802673:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802676:	44 01 e8             	add    %r13d,%eax
+  802679:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80267d:	41 0f 44 c5          	cmove  %r13d,%eax
+  802681:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802685:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802689:	48 89 da             	mov    %rbx,%rdx
+  80268c:	be 00 00 00 00       	mov    $0x0,%esi
+  802691:	bf 04 00 00 00       	mov    $0x4,%edi
+  802696:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  80269d:	00 00 00 
+  8026a0:	ff d0                	call   *%rax
+        if (res < 0)
+  8026a2:	85 c0                	test   %eax,%eax
+  8026a4:	78 4a                	js     8026f0 <devfile_write_direct+0xf9>
+        buf += res;
+  8026a6:	48 98                	cltq
+  8026a8:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8026ab:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8026af:	49 29 c4             	sub    %rax,%r12
+  8026b2:	75 8d                	jne    802641 <devfile_write_direct+0x4a>
+    return write;
+  8026b4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026b8:	eb 27                	jmp    8026e1 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8026ba:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8026be:	eb f4                	jmp    8026b4 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8026c0:	45 89 e9             	mov    %r13d,%r9d
+  8026c3:	4d 89 e0             	mov    %r12,%r8
+  8026c6:	4c 89 f1             	mov    %r14,%rcx
+  8026c9:	ba 04 00 00 00       	mov    $0x4,%edx
+  8026ce:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026d2:	48 89 c7             	mov    %rax,%rdi
+  8026d5:	48 b8 24 20 80 00 00 	movabs $0x802024,%rax
+  8026dc:	00 00 00 
+  8026df:	ff d0                	call   *%rax
+}
+  8026e1:	48 83 c4 18          	add    $0x18,%rsp
+  8026e5:	5b                   	pop    %rbx
+  8026e6:	41 5c                	pop    %r12
+  8026e8:	41 5d                	pop    %r13
+  8026ea:	41 5e                	pop    %r14
+  8026ec:	41 5f                	pop    %r15
+  8026ee:	5d                   	pop    %rbp
+  8026ef:	c3                   	ret
+            return res;
+  8026f0:	48 98                	cltq
+  8026f2:	eb ed                	jmp    8026e1 <devfile_write_direct+0xea>
+
+00000000008026f4 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8026f4:	55                   	push   %rbp
+  8026f5:	48 89 e5             	mov    %rsp,%rbp
+  8026f8:	41 54                	push   %r12
+  8026fa:	53                   	push   %rbx
+  8026fb:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8026fe:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  802705:	00 00 00 
+  802708:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80270a:	48 85 c0             	test   %rax,%rax
+  80270d:	74 71                	je     802780 <fbuf_flush+0x8c>
+  80270f:	48 89 c3             	mov    %rax,%rbx
+  802712:	b8 00 00 00 00       	mov    $0x0,%eax
+  802717:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80271b:	75 05                	jne    802722 <fbuf_flush+0x2e>
+}
+  80271d:	5b                   	pop    %rbx
+  80271e:	41 5c                	pop    %r12
+  802720:	5d                   	pop    %rbp
+  802721:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802722:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802725:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802729:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802730:	00 00 00 
+  802733:	48 89 de             	mov    %rbx,%rsi
+  802736:	48 29 c6             	sub    %rax,%rsi
+  802739:	48 c1 fe 03          	sar    $0x3,%rsi
+  80273d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802744:	aa aa aa 
+  802747:	48 0f af f0          	imul   %rax,%rsi
+  80274b:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80274f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802754:	48 01 c6             	add    %rax,%rsi
+  802757:	4c 89 e7             	mov    %r12,%rdi
+  80275a:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  802761:	00 00 00 
+  802764:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802766:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80276a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802771:	00 
+    return res < 0 ? res : 0;
+  802772:	48 85 c0             	test   %rax,%rax
+  802775:	ba 00 00 00 00       	mov    $0x0,%edx
+  80277a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80277e:	eb 9d                	jmp    80271d <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802780:	b8 00 00 00 00       	mov    $0x0,%eax
+  802785:	eb 96                	jmp    80271d <fbuf_flush+0x29>
+
+0000000000802787 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80278b:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+}
+  802797:	5d                   	pop    %rbp
+  802798:	c3                   	ret
+
+0000000000802799 <devfile_write>:
+    if (!fd || !buf)
+  802799:	48 85 ff             	test   %rdi,%rdi
+  80279c:	0f 84 d3 01 00 00    	je     802975 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8027a2:	55                   	push   %rbp
+  8027a3:	48 89 e5             	mov    %rsp,%rbp
+  8027a6:	41 57                	push   %r15
+  8027a8:	41 56                	push   %r14
+  8027aa:	41 55                	push   %r13
+  8027ac:	41 54                	push   %r12
+  8027ae:	53                   	push   %rbx
+  8027af:	48 83 ec 08          	sub    $0x8,%rsp
+  8027b3:	49 89 fc             	mov    %rdi,%r12
+  8027b6:	49 89 f6             	mov    %rsi,%r14
+  8027b9:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8027bc:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8027c1:	48 85 f6             	test   %rsi,%rsi
+  8027c4:	0f 84 9c 01 00 00    	je     802966 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8027ca:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  8027d1:	00 00 00 
+  8027d4:	ff d0                	call   *%rax
+  8027d6:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8027d9:	48 85 c0             	test   %rax,%rax
+  8027dc:	0f 84 a2 00 00 00    	je     802884 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8027e2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027e7:	4c 89 e7             	mov    %r12,%rdi
+  8027ea:	48 b8 38 12 80 00 00 	movabs $0x801238,%rax
+  8027f1:	00 00 00 
+  8027f4:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8027f6:	83 f8 02             	cmp    $0x2,%eax
+  8027f9:	0f 8f 85 00 00 00    	jg     802884 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8027ff:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802806:	00 00 00 
+  802809:	4d 89 ef             	mov    %r13,%r15
+  80280c:	49 29 c7             	sub    %rax,%r15
+  80280f:	49 c1 ff 03          	sar    $0x3,%r15
+  802813:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80281a:	aa aa aa 
+  80281d:	4c 0f af f8          	imul   %rax,%r15
+  802821:	49 c1 e7 0e          	shl    $0xe,%r15
+  802825:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80282a:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80282d:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802832:	0f 84 d7 00 00 00    	je     80290f <devfile_write+0x176>
+  802838:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80283c:	89 c2                	mov    %eax,%edx
+  80283e:	41 03 55 0c          	add    0xc(%r13),%edx
+  802842:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802847:	75 0f                	jne    802858 <devfile_write+0xbf>
+  802849:	48 01 d8             	add    %rbx,%rax
+  80284c:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802852:	0f 86 92 00 00 00    	jbe    8028ea <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802858:	4c 89 e7             	mov    %r12,%rdi
+  80285b:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  802862:	00 00 00 
+  802865:	ff d0                	call   *%rax
+  802867:	85 c0                	test   %eax,%eax
+  802869:	78 52                	js     8028bd <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80286b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802872:	77 7f                	ja     8028f3 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802874:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802879:	0f 85 c2 00 00 00    	jne    802941 <devfile_write+0x1a8>
+  80287f:	e9 94 00 00 00       	jmp    802918 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802884:	4c 89 e7             	mov    %r12,%rdi
+  802887:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  80288e:	00 00 00 
+  802891:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802893:	85 c0                	test   %eax,%eax
+  802895:	79 07                	jns    80289e <devfile_write+0x105>
+  802897:	48 98                	cltq
+  802899:	e9 c8 00 00 00       	jmp    802966 <devfile_write+0x1cd>
+  80289e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028a3:	48 89 da             	mov    %rbx,%rdx
+  8028a6:	4c 89 f6             	mov    %r14,%rsi
+  8028a9:	4c 89 e7             	mov    %r12,%rdi
+  8028ac:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+  8028b8:	e9 a9 00 00 00       	jmp    802966 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028bd:	48 98                	cltq
+  8028bf:	e9 a2 00 00 00       	jmp    802966 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028c4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028c9:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8028ce:	4c 89 fe             	mov    %r15,%rsi
+  8028d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d6:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  8028dd:	00 00 00 
+  8028e0:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8028e2:	85 c0                	test   %eax,%eax
+  8028e4:	79 45                	jns    80292b <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028e6:	48 98                	cltq
+  8028e8:	eb 7c                	jmp    802966 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028ea:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028f1:	76 4e                	jbe    802941 <devfile_write+0x1a8>
+  8028f3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028f8:	48 89 da             	mov    %rbx,%rdx
+  8028fb:	4c 89 f6             	mov    %r14,%rsi
+  8028fe:	4c 89 e7             	mov    %r12,%rdi
+  802901:	48 b8 f7 25 80 00 00 	movabs $0x8025f7,%rax
+  802908:	00 00 00 
+  80290b:	ff d0                	call   *%rax
+  80290d:	eb 57                	jmp    802966 <devfile_write+0x1cd>
+  80290f:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802916:	77 db                	ja     8028f3 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802918:	4c 89 ff             	mov    %r15,%rdi
+  80291b:	48 b8 66 40 80 00 00 	movabs $0x804066,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+  802927:	84 c0                	test   %al,%al
+  802929:	74 99                	je     8028c4 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80292b:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802930:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802935:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802939:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802940:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802941:	4c 89 ff             	mov    %r15,%rdi
+  802944:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802948:	48 89 da             	mov    %rbx,%rdx
+  80294b:	4c 89 f6             	mov    %r14,%rsi
+  80294e:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  802955:	00 00 00 
+  802958:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80295a:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80295e:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802963:	48 89 d8             	mov    %rbx,%rax
+}
+  802966:	48 83 c4 08          	add    $0x8,%rsp
+  80296a:	5b                   	pop    %rbx
+  80296b:	41 5c                	pop    %r12
+  80296d:	41 5d                	pop    %r13
+  80296f:	41 5e                	pop    %r14
+  802971:	41 5f                	pop    %r15
+  802973:	5d                   	pop    %rbp
+  802974:	c3                   	ret
+        return E_INVAL;
+  802975:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80297a:	c3                   	ret
+
+000000000080297b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80297b:	55                   	push   %rbp
+  80297c:	48 89 e5             	mov    %rsp,%rbp
+  80297f:	41 54                	push   %r12
+  802981:	53                   	push   %rbx
+  802982:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802985:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802994:	48 89 df             	mov    %rbx,%rdi
+  802997:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  80299e:	00 00 00 
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	48 85 c0             	test   %rax,%rax
+  8029a6:	74 17                	je     8029bf <devfile_flush+0x44>
+  8029a8:	48 89 df             	mov    %rbx,%rdi
+  8029ab:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  8029b2:	00 00 00 
+  8029b5:	ff d0                	call   *%rax
+  8029b7:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8029be:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029bf:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029c2:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8029c9:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8029cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8029d5:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029da:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  8029e1:	00 00 00 
+  8029e4:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029e6:	45 85 e4             	test   %r12d,%r12d
+  8029e9:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029ed:	5b                   	pop    %rbx
+  8029ee:	41 5c                	pop    %r12
+  8029f0:	5d                   	pop    %rbp
+  8029f1:	c3                   	ret
+
+00000000008029f2 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	41 57                	push   %r15
+  8029f8:	41 56                	push   %r14
+  8029fa:	41 55                	push   %r13
+  8029fc:	41 54                	push   %r12
+  8029fe:	53                   	push   %rbx
+  8029ff:	48 83 ec 38          	sub    $0x38,%rsp
+  802a03:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a07:	49 89 f7             	mov    %rsi,%r15
+  802a0a:	48 89 d3             	mov    %rdx,%rbx
+  802a0d:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a10:	48 b8 3d 1f 80 00 00 	movabs $0x801f3d,%rax
+  802a17:	00 00 00 
+  802a1a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a1c:	48 85 c0             	test   %rax,%rax
+  802a1f:	75 20                	jne    802a41 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a21:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a26:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a2d:	00 
+    while (n) {
+  802a2e:	48 85 db             	test   %rbx,%rbx
+  802a31:	0f 85 df 00 00 00    	jne    802b16 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a37:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a3b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a3f:	eb 21                	jmp    802a62 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a41:	45 89 f1             	mov    %r14d,%r9d
+  802a44:	49 89 d8             	mov    %rbx,%r8
+  802a47:	4c 89 f9             	mov    %r15,%rcx
+  802a4a:	ba 03 00 00 00       	mov    $0x3,%edx
+  802a4f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a53:	48 89 c7             	mov    %rax,%rdi
+  802a56:	48 b8 24 20 80 00 00 	movabs $0x802024,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+}
+  802a62:	48 83 c4 38          	add    $0x38,%rsp
+  802a66:	5b                   	pop    %rbx
+  802a67:	41 5c                	pop    %r12
+  802a69:	41 5d                	pop    %r13
+  802a6b:	41 5e                	pop    %r14
+  802a6d:	41 5f                	pop    %r15
+  802a6f:	5d                   	pop    %rbp
+  802a70:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a71:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a75:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a7b:	75 1e                	jne    802a9b <devfile_read_direct+0xa9>
+  802a7d:	e9 e2 00 00 00       	jmp    802b64 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a82:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a86:	eb da                	jmp    802a62 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a88:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a8c:	0f 85 d0 01 00 00    	jne    802c62 <devfile_read_direct+0x270>
+            map = 0;
+  802a92:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a96:	eb 03                	jmp    802a9b <devfile_read_direct+0xa9>
+  802a98:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a9b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802aa0:	48 39 d3             	cmp    %rdx,%rbx
+  802aa3:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802aa7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802aab:	8b 40 0c             	mov    0xc(%rax),%eax
+  802aae:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802ab5:	00 00 00 
+  802ab8:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802aba:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802abe:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ac2:	be 00 00 00 00       	mov    $0x0,%esi
+  802ac7:	bf 03 00 00 00       	mov    $0x3,%edi
+  802acc:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ad8:	85 c0                	test   %eax,%eax
+  802ada:	0f 8e 63 01 00 00    	jle    802c43 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ae0:	4c 63 e0             	movslq %eax,%r12
+  802ae3:	4c 89 e2             	mov    %r12,%rdx
+  802ae6:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802aed:	00 00 00 
+  802af0:	4c 89 ff             	mov    %r15,%rdi
+  802af3:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+        buf += res;
+  802aff:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b02:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b05:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b09:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b0d:	48 85 db             	test   %rbx,%rbx
+  802b10:	0f 84 25 ff ff ff    	je     802a3b <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b16:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b19:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b1d:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b21:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b25:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b2c:	0f 97 c2             	seta   %dl
+  802b2f:	20 c2                	and    %al,%dl
+  802b31:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b34:	0f 84 5e ff ff ff    	je     802a98 <devfile_read_direct+0xa6>
+  802b3a:	4c 89 fa             	mov    %r15,%rdx
+  802b3d:	4d 89 fd             	mov    %r15,%r13
+  802b40:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802b47:	0f 85 4e ff ff ff    	jne    802a9b <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802b4d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b51:	0f 84 1a ff ff ff    	je     802a71 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b57:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b5e:	0f 85 37 ff ff ff    	jne    802a9b <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802b64:	48 89 d8             	mov    %rbx,%rax
+  802b67:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b6d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b72:	48 39 c8             	cmp    %rcx,%rax
+  802b75:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b79:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b7d:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b81:	49 89 d4             	mov    %rdx,%r12
+  802b84:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b88:	48 b8 07 40 80 00 00 	movabs $0x804007,%rax
+  802b8f:	00 00 00 
+  802b92:	ff d0                	call   *%rax
+  802b94:	a8 40                	test   $0x40,%al
+  802b96:	0f 85 b9 00 00 00    	jne    802c55 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b9c:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802ba3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ba7:	49 39 c5             	cmp    %rax,%r13
+  802baa:	72 d8                	jb     802b84 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bac:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802bb0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802bb7:	00 00 00 
+  802bba:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bbe:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802bc1:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802bc3:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802bc7:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802bcb:	48 b8 d8 1d 80 00 00 	movabs $0x801dd8,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+  802bd7:	89 c7                	mov    %eax,%edi
+  802bd9:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bdf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802be4:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802beb:	00 00 00 
+  802bee:	be 0e 00 00 00       	mov    $0xe,%esi
+  802bf3:	48 b8 14 49 80 00 00 	movabs $0x804914,%rax
+  802bfa:	00 00 00 
+  802bfd:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802bff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c04:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c08:	4c 89 fe             	mov    %r15,%rsi
+  802c0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c10:	48 b8 f0 48 80 00 00 	movabs $0x8048f0,%rax
+  802c17:	00 00 00 
+  802c1a:	ff d0                	call   *%rax
+  802c1c:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c1f:	48 85 d2             	test   %rdx,%rdx
+  802c22:	0f 84 5a fe ff ff    	je     802a82 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c28:	0f 8e 5a fe ff ff    	jle    802a88 <devfile_read_direct+0x96>
+                buf += res;
+  802c2e:	48 98                	cltq
+  802c30:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c33:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c36:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c3a:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c3e:	e9 ca fe ff ff       	jmp    802b0d <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c43:	41 89 c5             	mov    %eax,%r13d
+  802c46:	48 98                	cltq
+  802c48:	45 85 ed             	test   %r13d,%r13d
+  802c4b:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802c50:	e9 0d fe ff ff       	jmp    802a62 <devfile_read_direct+0x70>
+            map = 0;
+  802c55:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c59:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c5d:	e9 39 fe ff ff       	jmp    802a9b <devfile_read_direct+0xa9>
+  802c62:	48 89 d0             	mov    %rdx,%rax
+  802c65:	e9 f8 fd ff ff       	jmp    802a62 <devfile_read_direct+0x70>
+
+0000000000802c6a <devfile_read>:
+    if (!fd || !buf)
+  802c6a:	48 85 ff             	test   %rdi,%rdi
+  802c6d:	0f 84 21 02 00 00    	je     802e94 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c73:	55                   	push   %rbp
+  802c74:	48 89 e5             	mov    %rsp,%rbp
+  802c77:	41 57                	push   %r15
+  802c79:	41 56                	push   %r14
+  802c7b:	41 55                	push   %r13
+  802c7d:	41 54                	push   %r12
+  802c7f:	53                   	push   %rbx
+  802c80:	48 83 ec 28          	sub    $0x28,%rsp
+  802c84:	48 89 fb             	mov    %rdi,%rbx
+  802c87:	49 89 f4             	mov    %rsi,%r12
+  802c8a:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c8d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c92:	48 85 f6             	test   %rsi,%rsi
+  802c95:	74 4b                	je     802ce2 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c97:	48 b8 a7 1f 80 00 00 	movabs $0x801fa7,%rax
+  802c9e:	00 00 00 
+  802ca1:	ff d0                	call   *%rax
+  802ca3:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ca6:	48 85 c0             	test   %rax,%rax
+  802ca9:	74 22                	je     802ccd <devfile_read+0x63>
+  802cab:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802cb2:	77 19                	ja     802ccd <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802cb4:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cb9:	48 89 df             	mov    %rbx,%rdi
+  802cbc:	48 b8 38 12 80 00 00 	movabs $0x801238,%rax
+  802cc3:	00 00 00 
+  802cc6:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802cc8:	83 f8 02             	cmp    $0x2,%eax
+  802ccb:	7e 40                	jle    802d0d <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ccd:	48 89 df             	mov    %rbx,%rdi
+  802cd0:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  802cd7:	00 00 00 
+  802cda:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cdc:	85 c0                	test   %eax,%eax
+  802cde:	79 11                	jns    802cf1 <devfile_read+0x87>
+  802ce0:	48 98                	cltq
+}
+  802ce2:	48 83 c4 28          	add    $0x28,%rsp
+  802ce6:	5b                   	pop    %rbx
+  802ce7:	41 5c                	pop    %r12
+  802ce9:	41 5d                	pop    %r13
+  802ceb:	41 5e                	pop    %r14
+  802ced:	41 5f                	pop    %r15
+  802cef:	5d                   	pop    %rbp
+  802cf0:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cf1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802cf6:	4c 89 ea             	mov    %r13,%rdx
+  802cf9:	4c 89 e6             	mov    %r12,%rsi
+  802cfc:	48 89 df             	mov    %rbx,%rdi
+  802cff:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802d06:	00 00 00 
+  802d09:	ff d0                	call   *%rax
+  802d0b:	eb d5                	jmp    802ce2 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d0d:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d11:	48 89 df             	mov    %rbx,%rdi
+  802d14:	48 b8 f4 26 80 00 00 	movabs $0x8026f4,%rax
+  802d1b:	00 00 00 
+  802d1e:	ff d0                	call   *%rax
+  802d20:	85 c0                	test   %eax,%eax
+  802d22:	0f 88 33 01 00 00    	js     802e5b <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d28:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d2f:	00 00 00 
+  802d32:	4c 89 f0             	mov    %r14,%rax
+  802d35:	48 29 d0             	sub    %rdx,%rax
+  802d38:	48 c1 f8 03          	sar    $0x3,%rax
+  802d3c:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d43:	aa aa aa 
+  802d46:	48 0f af c2          	imul   %rdx,%rax
+  802d4a:	48 c1 e0 0e          	shl    $0xe,%rax
+  802d4e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d52:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d55:	41 39 06             	cmp    %eax,(%r14)
+  802d58:	75 0d                	jne    802d67 <devfile_read+0xfd>
+  802d5a:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d5d:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802d61:	0f 84 fb 00 00 00    	je     802e62 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802d67:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d6c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d70:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d77:	48 89 c7             	mov    %rax,%rdi
+  802d7a:	48 b8 66 40 80 00 00 	movabs $0x804066,%rax
+  802d81:	00 00 00 
+  802d84:	ff d0                	call   *%rax
+  802d86:	84 c0                	test   %al,%al
+  802d88:	75 27                	jne    802db1 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d8a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d8f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d94:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d98:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d9d:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802da9:	85 c0                	test   %eax,%eax
+  802dab:	0f 88 dc 00 00 00    	js     802e8d <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802db1:	44 89 f8             	mov    %r15d,%eax
+  802db4:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802db9:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802dbb:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802dc2:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802dc3:	8b 43 10             	mov    0x10(%rbx),%eax
+  802dc6:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802dca:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802dcd:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802dd2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802dd6:	48 89 df             	mov    %rbx,%rdi
+  802dd9:	48 b8 f2 29 80 00 00 	movabs $0x8029f2,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802de5:	48 85 c0             	test   %rax,%rax
+  802de8:	0f 88 f4 fe ff ff    	js     802ce2 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802dee:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802df1:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802df4:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802df7:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802dfb:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802dff:	48 63 d1             	movslq %ecx,%rdx
+  802e02:	48 01 d0             	add    %rdx,%rax
+  802e05:	4d 63 ff             	movslq %r15d,%r15
+  802e08:	4c 29 f8             	sub    %r15,%rax
+  802e0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e10:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e14:	48 85 c0             	test   %rax,%rax
+  802e17:	0f 8e c5 fe ff ff    	jle    802ce2 <devfile_read+0x78>
+    n = MIN(n, res);
+  802e1d:	4c 39 e8             	cmp    %r13,%rax
+  802e20:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e24:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e27:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e2b:	48 63 f6             	movslq %esi,%rsi
+  802e2e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e33:	48 01 c6             	add    %rax,%rsi
+  802e36:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e3a:	48 01 c6             	add    %rax,%rsi
+  802e3d:	4c 89 ea             	mov    %r13,%rdx
+  802e40:	4c 89 e7             	mov    %r12,%rdi
+  802e43:	48 b8 75 0f 80 00 00 	movabs $0x800f75,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802e4f:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802e53:	4c 89 e8             	mov    %r13,%rax
+  802e56:	e9 87 fe ff ff       	jmp    802ce2 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e5b:	48 98                	cltq
+  802e5d:	e9 80 fe ff ff       	jmp    802ce2 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e62:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e66:	41 39 d7             	cmp    %edx,%r15d
+  802e69:	0f 8c f8 fe ff ff    	jl     802d67 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e6f:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e73:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e76:	41 39 cf             	cmp    %ecx,%r15d
+  802e79:	0f 8d e8 fe ff ff    	jge    802d67 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e7f:	4d 63 ff             	movslq %r15d,%r15
+  802e82:	4c 29 f8             	sub    %r15,%rax
+  802e85:	48 63 d2             	movslq %edx,%rdx
+  802e88:	48 01 d0             	add    %rdx,%rax
+  802e8b:	eb 87                	jmp    802e14 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e8d:	48 98                	cltq
+  802e8f:	e9 4e fe ff ff       	jmp    802ce2 <devfile_read+0x78>
+        return E_INVAL;
+  802e94:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e99:	c3                   	ret
+
+0000000000802e9a <fs_channel>:
+fs_channel(bool enable) {
+  802e9a:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e9c:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802ea3:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802ea5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eaa:	40 84 ff             	test   %dil,%dil
+  802ead:	74 47                	je     802ef6 <fs_channel+0x5c>
+  802eaf:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  802eb6:	00 00 00 
+  802eb9:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802ebf:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802ec6:	00 00 00 
+  802ec9:	3b 08                	cmp    (%rax),%ecx
+  802ecb:	74 29                	je     802ef6 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802ecd:	55                   	push   %rbp
+  802ece:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802ed1:	48 b8 1a 1e 80 00 00 	movabs $0x801e1a,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+  802edd:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802edf:	85 c0                	test   %eax,%eax
+  802ee1:	78 04                	js     802ee7 <fs_channel+0x4d>
+}
+  802ee3:	89 d0                	mov    %edx,%eax
+  802ee5:	5d                   	pop    %rbp
+  802ee6:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ee7:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802eee:	00 00 00 
+  802ef1:	c6 00 00             	movb   $0x0,(%rax)
+  802ef4:	eb ed                	jmp    802ee3 <fs_channel+0x49>
+}
+  802ef6:	89 d0                	mov    %edx,%eax
+  802ef8:	c3                   	ret
+
+0000000000802ef9 <open>:
+open(const char *path, int mode) {
+  802ef9:	55                   	push   %rbp
+  802efa:	48 89 e5             	mov    %rsp,%rbp
+  802efd:	41 55                	push   %r13
+  802eff:	41 54                	push   %r12
+  802f01:	53                   	push   %rbx
+  802f02:	48 83 ec 18          	sub    $0x18,%rsp
+  802f06:	49 89 fc             	mov    %rdi,%r12
+  802f09:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f0c:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  802f13:	00 00 00 
+  802f16:	ff d0                	call   *%rax
+  802f18:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f1e:	0f 87 8f 00 00 00    	ja     802fb3 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f24:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f28:	48 b8 d4 16 80 00 00 	movabs $0x8016d4,%rax
+  802f2f:	00 00 00 
+  802f32:	ff d0                	call   *%rax
+  802f34:	89 c3                	mov    %eax,%ebx
+  802f36:	85 c0                	test   %eax,%eax
+  802f38:	78 55                	js     802f8f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f3a:	4c 89 e6             	mov    %r12,%rsi
+  802f3d:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f44:	00 00 00 
+  802f47:	48 89 df             	mov    %rbx,%rdi
+  802f4a:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  802f51:	00 00 00 
+  802f54:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f56:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f62:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f66:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f6b:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  802f72:	00 00 00 
+  802f75:	ff d0                	call   *%rax
+  802f77:	89 c3                	mov    %eax,%ebx
+  802f79:	85 c0                	test   %eax,%eax
+  802f7b:	78 1f                	js     802f9c <open+0xa3>
+    return fd2num(fd);
+  802f7d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f81:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  802f88:	00 00 00 
+  802f8b:	ff d0                	call   *%rax
+  802f8d:	89 c3                	mov    %eax,%ebx
+}
+  802f8f:	89 d8                	mov    %ebx,%eax
+  802f91:	48 83 c4 18          	add    $0x18,%rsp
+  802f95:	5b                   	pop    %rbx
+  802f96:	41 5c                	pop    %r12
+  802f98:	41 5d                	pop    %r13
+  802f9a:	5d                   	pop    %rbp
+  802f9b:	c3                   	ret
+        fd_close(fd, 0);
+  802f9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802fa1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa5:	48 b8 ef 17 80 00 00 	movabs $0x8017ef,%rax
+  802fac:	00 00 00 
+  802faf:	ff d0                	call   *%rax
+        return res;
+  802fb1:	eb dc                	jmp    802f8f <open+0x96>
+        return -E_BAD_PATH;
+  802fb3:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fb8:	eb d5                	jmp    802f8f <open+0x96>
+
+0000000000802fba <file_flush_buffers>:
+file_flush_buffers(void) {
+  802fba:	55                   	push   %rbp
+  802fbb:	48 89 e5             	mov    %rsp,%rbp
+  802fbe:	41 56                	push   %r14
+  802fc0:	41 55                	push   %r13
+  802fc2:	41 54                	push   %r12
+  802fc4:	53                   	push   %rbx
+  802fc5:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802fc9:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802fd0:	00 00 00 
+  802fd3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802fd8:	49 bd 34 17 80 00 00 	movabs $0x801734,%r13
+  802fdf:	00 00 00 
+  802fe2:	49 be f4 26 80 00 00 	movabs $0x8026f4,%r14
+  802fe9:	00 00 00 
+  802fec:	eb 0c                	jmp    802ffa <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802fee:	83 c3 01             	add    $0x1,%ebx
+  802ff1:	49 83 c4 18          	add    $0x18,%r12
+  802ff5:	83 fb 20             	cmp    $0x20,%ebx
+  802ff8:	74 1d                	je     803017 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802ffa:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802fff:	74 ed                	je     802fee <file_flush_buffers+0x34>
+  803001:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803005:	89 df                	mov    %ebx,%edi
+  803007:	41 ff d5             	call   *%r13
+  80300a:	85 c0                	test   %eax,%eax
+  80300c:	78 e0                	js     802fee <file_flush_buffers+0x34>
+  80300e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803012:	41 ff d6             	call   *%r14
+  803015:	eb d7                	jmp    802fee <file_flush_buffers+0x34>
+}
+  803017:	48 83 c4 10          	add    $0x10,%rsp
+  80301b:	5b                   	pop    %rbx
+  80301c:	41 5c                	pop    %r12
+  80301e:	41 5d                	pop    %r13
+  803020:	41 5e                	pop    %r14
+  803022:	5d                   	pop    %rbp
+  803023:	c3                   	ret
+
+0000000000803024 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803024:	55                   	push   %rbp
+  803025:	48 89 e5             	mov    %rsp,%rbp
+  803028:	41 54                	push   %r12
+  80302a:	53                   	push   %rbx
+  80302b:	49 89 fc             	mov    %rdi,%r12
+  80302e:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803030:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803037:	00 00 00 
+  80303a:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80303c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803043:	00 00 00 
+  803046:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80304b:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80304d:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803050:	ba 00 00 00 00       	mov    $0x0,%edx
+  803055:	be 00 00 00 00       	mov    $0x0,%esi
+  80305a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80305f:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  803066:	00 00 00 
+  803069:	ff d0                	call   *%rax
+}
+  80306b:	5b                   	pop    %rbx
+  80306c:	41 5c                	pop    %r12
+  80306e:	5d                   	pop    %rbp
+  80306f:	c3                   	ret
+
+0000000000803070 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803070:	55                   	push   %rbp
+  803071:	48 89 e5             	mov    %rsp,%rbp
+  803074:	41 54                	push   %r12
+  803076:	53                   	push   %rbx
+  803077:	49 89 fc             	mov    %rdi,%r12
+  80307a:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80307d:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803089:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80308e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803095:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80309c:	be 00 00 00 00       	mov    $0x0,%esi
+  8030a1:	bf 05 00 00 00       	mov    $0x5,%edi
+  8030a6:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  8030ad:	00 00 00 
+  8030b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030b2:	85 c0                	test   %eax,%eax
+  8030b4:	78 3d                	js     8030f3 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8030b6:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8030bd:	00 00 00 
+  8030c0:	4c 89 e6             	mov    %r12,%rsi
+  8030c3:	48 89 df             	mov    %rbx,%rdi
+  8030c6:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8030d2:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8030d9:	00 
+  8030da:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8030e0:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8030e7:	00 
+  8030e8:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8030ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030f3:	5b                   	pop    %rbx
+  8030f4:	41 5c                	pop    %r12
+  8030f6:	5d                   	pop    %rbp
+  8030f7:	c3                   	ret
+
+00000000008030f8 <remove>:
+remove(const char *path) {
+  8030f8:	55                   	push   %rbp
+  8030f9:	48 89 e5             	mov    %rsp,%rbp
+  8030fc:	53                   	push   %rbx
+  8030fd:	48 83 ec 08          	sub    $0x8,%rsp
+  803101:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803104:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803116:	77 3a                	ja     803152 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803118:	48 89 de             	mov    %rbx,%rsi
+  80311b:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803122:	00 00 00 
+  803125:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803131:	ba 00 00 00 00       	mov    $0x0,%edx
+  803136:	be 00 00 00 00       	mov    $0x0,%esi
+  80313b:	bf 07 00 00 00       	mov    $0x7,%edi
+  803140:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  803147:	00 00 00 
+  80314a:	ff d0                	call   *%rax
+}
+  80314c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803150:	c9                   	leave
+  803151:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803152:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803157:	eb f3                	jmp    80314c <remove+0x54>
+
+0000000000803159 <sync>:
+sync(void) {
+  803159:	55                   	push   %rbp
+  80315a:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80315d:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  803164:	00 00 00 
+  803167:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316e:	be 00 00 00 00       	mov    $0x0,%esi
+  803173:	bf 08 00 00 00       	mov    $0x8,%edi
+  803178:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  80317f:	00 00 00 
+  803182:	ff d0                	call   *%rax
+}
+  803184:	5d                   	pop    %rbp
+  803185:	c3                   	ret
+
+0000000000803186 <fsync>:
+fsync(int fdnum) {
+  803186:	55                   	push   %rbp
+  803187:	48 89 e5             	mov    %rsp,%rbp
+  80318a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80318e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803192:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803199:	00 00 00 
+  80319c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80319e:	85 c0                	test   %eax,%eax
+  8031a0:	78 4b                	js     8031ed <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031a2:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031a6:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8031ad:	00 00 00 
+  8031b0:	8b 00                	mov    (%rax),%eax
+  8031b2:	39 02                	cmp    %eax,(%rdx)
+  8031b4:	75 39                	jne    8031ef <fsync+0x69>
+    file_flush_buffers();
+  8031b6:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8031c2:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031c6:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031c9:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8031d0:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8031d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031d7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031dc:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8031e1:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  8031e8:	00 00 00 
+  8031eb:	ff d0                	call   *%rax
+}
+  8031ed:	c9                   	leave
+  8031ee:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031ef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031f4:	eb f7                	jmp    8031ed <fsync+0x67>
+
+00000000008031f6 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8031f6:	55                   	push   %rbp
+  8031f7:	48 89 e5             	mov    %rsp,%rbp
+  8031fa:	53                   	push   %rbx
+  8031fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8031ff:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803202:	ba 00 00 00 00       	mov    $0x0,%edx
+  803207:	be 00 00 00 00       	mov    $0x0,%esi
+  80320c:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803211:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  803218:	00 00 00 
+  80321b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80321d:	85 c0                	test   %eax,%eax
+  80321f:	78 2d                	js     80324e <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803221:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803228:	00 00 00 
+  80322b:	48 8b 10             	mov    (%rax),%rdx
+  80322e:	48 89 13             	mov    %rdx,(%rbx)
+  803231:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803235:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803239:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80323d:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803241:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803245:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803249:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80324e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803252:	c9                   	leave
+  803253:	c3                   	ret
+
+0000000000803254 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803254:	55                   	push   %rbp
+  803255:	48 89 e5             	mov    %rsp,%rbp
+  803258:	53                   	push   %rbx
+  803259:	48 83 ec 08          	sub    $0x8,%rsp
+  80325d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803260:	ba 00 00 00 00       	mov    $0x0,%edx
+  803265:	be 00 00 00 00       	mov    $0x0,%esi
+  80326a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80326f:	48 b8 8b 24 80 00 00 	movabs $0x80248b,%rax
+  803276:	00 00 00 
+  803279:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80327b:	85 c0                	test   %eax,%eax
+  80327d:	78 3d                	js     8032bc <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80327f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803286:	00 00 00 
+  803289:	48 8b 10             	mov    (%rax),%rdx
+  80328c:	48 89 13             	mov    %rdx,(%rbx)
+  80328f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803293:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803297:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80329b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80329f:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8032a3:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8032a7:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8032ab:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8032af:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032b3:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8032b7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032bc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032c0:	c9                   	leave
+  8032c1:	c3                   	ret
+
+00000000008032c2 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8032c2:	55                   	push   %rbp
+  8032c3:	48 89 e5             	mov    %rsp,%rbp
+  8032c6:	41 57                	push   %r15
+  8032c8:	41 56                	push   %r14
+  8032ca:	41 55                	push   %r13
+  8032cc:	41 54                	push   %r12
+  8032ce:	53                   	push   %rbx
+  8032cf:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8032d3:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8032da:	00 
+  8032db:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8032e2:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8032e8:	0f 85 43 01 00 00    	jne    803431 <munmap+0x16f>
+  8032ee:	49 89 ff             	mov    %rdi,%r15
+  8032f1:	4c 39 f7             	cmp    %r14,%rdi
+  8032f4:	0f 87 37 01 00 00    	ja     803431 <munmap+0x16f>
+  8032fa:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803301:	00 00 00 
+  803304:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80330a:	eb 2c                	jmp    803338 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80330c:	4c 39 f8             	cmp    %r15,%rax
+  80330f:	0f 83 85 00 00 00    	jae    80339a <munmap+0xd8>
+            m->mm_end = start;
+  803315:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80331a:	48 83 c3 18          	add    $0x18,%rbx
+  80331e:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803325:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80332c:	00 00 00 
+  80332f:	48 39 c3             	cmp    %rax,%rbx
+  803332:	0f 84 d0 00 00 00    	je     803408 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803338:	49 89 dc             	mov    %rbx,%r12
+  80333b:	48 8b 03             	mov    (%rbx),%rax
+  80333e:	4c 39 f0             	cmp    %r14,%rax
+  803341:	73 d7                	jae    80331a <munmap+0x58>
+  803343:	48 85 c0             	test   %rax,%rax
+  803346:	74 d2                	je     80331a <munmap+0x58>
+  803348:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80334c:	49 39 d7             	cmp    %rdx,%r15
+  80334f:	73 c9                	jae    80331a <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803351:	49 39 d6             	cmp    %rdx,%r14
+  803354:	73 b6                	jae    80330c <munmap+0x4a>
+  803356:	49 39 c7             	cmp    %rax,%r15
+  803359:	76 b1                	jbe    80330c <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80335b:	4c 89 ef             	mov    %r13,%rdi
+  80335e:	48 b8 f9 23 80 00 00 	movabs $0x8023f9,%rax
+  803365:	00 00 00 
+  803368:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80336a:	48 85 c0             	test   %rax,%rax
+  80336d:	0f 84 c5 00 00 00    	je     803438 <munmap+0x176>
+            *tail = *m;
+  803373:	48 8b 13             	mov    (%rbx),%rdx
+  803376:	48 89 10             	mov    %rdx,(%rax)
+  803379:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80337d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803381:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803385:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803389:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80338c:	44 89 f2             	mov    %r14d,%edx
+  80338f:	2b 13                	sub    (%rbx),%edx
+  803391:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803394:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803398:	eb 80                	jmp    80331a <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80339a:	49 39 d6             	cmp    %rdx,%r14
+  80339d:	73 18                	jae    8033b7 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80339f:	44 89 f2             	mov    %r14d,%edx
+  8033a2:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8033a7:	29 c2                	sub    %eax,%edx
+  8033a9:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8033ae:	4d 89 34 24          	mov    %r14,(%r12)
+  8033b2:	e9 63 ff ff ff       	jmp    80331a <munmap+0x58>
+    m->mm_start = 0;
+  8033b7:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8033be:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8033bf:	4c 89 e6             	mov    %r12,%rsi
+  8033c2:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8033c9:	00 00 00 
+  8033cc:	48 29 c6             	sub    %rax,%rsi
+  8033cf:	48 c1 fe 03          	sar    $0x3,%rsi
+  8033d3:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8033da:	aa aa aa 
+  8033dd:	48 0f af f0          	imul   %rax,%rsi
+  8033e1:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8033e5:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8033ea:	48 01 c6             	add    %rax,%rsi
+  8033ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033f7:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  8033fe:	00 00 00 
+  803401:	ff d0                	call   *%rax
+}
+  803403:	e9 12 ff ff ff       	jmp    80331a <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803408:	4c 89 f2             	mov    %r14,%rdx
+  80340b:	4c 29 fa             	sub    %r15,%rdx
+  80340e:	4c 89 fe             	mov    %r15,%rsi
+  803411:	bf 00 00 00 00       	mov    $0x0,%edi
+  803416:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  80341d:	00 00 00 
+  803420:	ff d0                	call   *%rax
+}
+  803422:	48 83 c4 08          	add    $0x8,%rsp
+  803426:	5b                   	pop    %rbx
+  803427:	41 5c                	pop    %r12
+  803429:	41 5d                	pop    %r13
+  80342b:	41 5e                	pop    %r14
+  80342d:	41 5f                	pop    %r15
+  80342f:	5d                   	pop    %rbp
+  803430:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803431:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803436:	eb ea                	jmp    803422 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803438:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80343d:	eb e3                	jmp    803422 <munmap+0x160>
+
+000000000080343f <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80343f:	55                   	push   %rbp
+  803440:	48 89 e5             	mov    %rsp,%rbp
+  803443:	41 57                	push   %r15
+  803445:	41 56                	push   %r14
+  803447:	41 55                	push   %r13
+  803449:	41 54                	push   %r12
+  80344b:	53                   	push   %rbx
+  80344c:	48 83 ec 28          	sub    $0x28,%rsp
+  803450:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803454:	49 89 f5             	mov    %rsi,%r13
+  803457:	41 89 d6             	mov    %edx,%r14d
+  80345a:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80345d:	41 89 cc             	mov    %ecx,%r12d
+  803460:	44 89 c7             	mov    %r8d,%edi
+  803463:	44 89 cb             	mov    %r9d,%ebx
+  803466:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80346a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80346e:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803475:	00 00 00 
+  803478:	ff d0                	call   *%rax
+  80347a:	41 89 c7             	mov    %eax,%r15d
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	0f 88 ae 01 00 00    	js     803633 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803485:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803489:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803490:	00 00 00 
+  803493:	8b 32                	mov    (%rdx),%esi
+  803495:	39 30                	cmp    %esi,(%rax)
+  803497:	0f 85 7a 02 00 00    	jne    803717 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80349d:	8b 40 08             	mov    0x8(%rax),%eax
+  8034a0:	83 e0 03             	and    $0x3,%eax
+  8034a3:	83 f8 01             	cmp    $0x1,%eax
+  8034a6:	0f 84 76 02 00 00    	je     803722 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8034ac:	4d 85 ed             	test   %r13,%r13
+  8034af:	0f 84 78 02 00 00    	je     80372d <mmap+0x2ee>
+  8034b5:	85 db                	test   %ebx,%ebx
+  8034b7:	0f 88 70 02 00 00    	js     80372d <mmap+0x2ee>
+  8034bd:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8034c3:	41 89 df             	mov    %ebx,%r15d
+  8034c6:	0f 85 6c 02 00 00    	jne    803738 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8034cc:	44 89 f0             	mov    %r14d,%eax
+  8034cf:	83 e0 fd             	and    $0xfffffffd,%eax
+  8034d2:	83 f8 04             	cmp    $0x4,%eax
+  8034d5:	0f 85 68 02 00 00    	jne    803743 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8034db:	44 89 e1             	mov    %r12d,%ecx
+  8034de:	83 e1 01             	and    $0x1,%ecx
+  8034e1:	0f 95 c2             	setne  %dl
+  8034e4:	44 89 e0             	mov    %r12d,%eax
+  8034e7:	d1 e8                	shr    %eax
+  8034e9:	83 f0 01             	xor    $0x1,%eax
+  8034ec:	83 e0 01             	and    $0x1,%eax
+  8034ef:	38 c2                	cmp    %al,%dl
+  8034f1:	0f 85 57 02 00 00    	jne    80374e <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8034f7:	85 c9                	test   %ecx,%ecx
+  8034f9:	74 0a                	je     803505 <mmap+0xc6>
+  8034fb:	41 f6 c6 02          	test   $0x2,%r14b
+  8034ff:	0f 85 54 02 00 00    	jne    803759 <mmap+0x31a>
+    file_flush_buffers();
+  803505:	48 b8 ba 2f 80 00 00 	movabs $0x802fba,%rax
+  80350c:	00 00 00 
+  80350f:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803511:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803518:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80351f:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803523:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803526:	41 f6 c4 04          	test   $0x4,%r12b
+  80352a:	0f 84 15 01 00 00    	je     803645 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803530:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803533:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803539:	0f 85 25 02 00 00    	jne    803764 <mmap+0x325>
+  80353f:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803543:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80354a:	00 00 00 
+  80354d:	48 39 c2             	cmp    %rax,%rdx
+  803550:	0f 82 19 02 00 00    	jb     80376f <mmap+0x330>
+  803556:	48 39 c7             	cmp    %rax,%rdi
+  803559:	0f 87 10 02 00 00    	ja     80376f <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80355f:	4c 89 ee             	mov    %r13,%rsi
+  803562:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  803569:	00 00 00 
+  80356c:	ff d0                	call   *%rax
+  80356e:	85 c0                	test   %eax,%eax
+  803570:	0f 88 04 02 00 00    	js     80377a <mmap+0x33b>
+    if (!handler) {
+  803576:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80357d:	00 00 00 
+  803580:	80 38 00             	cmpb   $0x0,(%rax)
+  803583:	75 2b                	jne    8035b0 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803585:	48 bf 5a 23 80 00 00 	movabs $0x80235a,%rdi
+  80358c:	00 00 00 
+  80358f:	48 b8 bf 45 80 00 00 	movabs $0x8045bf,%rax
+  803596:	00 00 00 
+  803599:	ff d0                	call   *%rax
+  80359b:	85 c0                	test   %eax,%eax
+  80359d:	0f 88 ea 01 00 00    	js     80378d <mmap+0x34e>
+        handler = 1;
+  8035a3:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035aa:	00 00 00 
+  8035ad:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8035b0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035b4:	48 b8 f9 23 80 00 00 	movabs $0x8023f9,%rax
+  8035bb:	00 00 00 
+  8035be:	ff d0                	call   *%rax
+  8035c0:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8035c3:	48 85 c0             	test   %rax,%rax
+  8035c6:	0f 84 c9 01 00 00    	je     803795 <mmap+0x356>
+    m->mm_start = va;
+  8035cc:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8035cf:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8035d3:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8035d7:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8035da:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8035de:	44 89 e0             	mov    %r12d,%eax
+  8035e1:	c1 e0 06             	shl    $0x6,%eax
+  8035e4:	25 80 00 00 00       	and    $0x80,%eax
+  8035e9:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8035ec:	09 f0                	or     %esi,%eax
+  8035ee:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8035f2:	41 f6 c4 08          	test   $0x8,%r12b
+  8035f6:	74 31                	je     803629 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035f8:	48 39 d3             	cmp    %rdx,%rbx
+  8035fb:	73 2c                	jae    803629 <mmap+0x1ea>
+  8035fd:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803602:	48 89 de             	mov    %rbx,%rsi
+  803605:	4c 89 f7             	mov    %r14,%rdi
+  803608:	48 b8 49 22 80 00 00 	movabs $0x802249,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+  803614:	49 89 c4             	mov    %rax,%r12
+  803617:	48 85 c0             	test   %rax,%rax
+  80361a:	0f 8e d7 00 00 00    	jle    8036f7 <mmap+0x2b8>
+            va += n;
+  803620:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803623:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803627:	72 d4                	jb     8035fd <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803629:	49 8b 06             	mov    (%r14),%rax
+  80362c:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803630:	48 89 06             	mov    %rax,(%rsi)
+}
+  803633:	44 89 f8             	mov    %r15d,%eax
+  803636:	48 83 c4 28          	add    $0x28,%rsp
+  80363a:	5b                   	pop    %rbx
+  80363b:	41 5c                	pop    %r12
+  80363d:	41 5d                	pop    %r13
+  80363f:	41 5e                	pop    %r14
+  803641:	41 5f                	pop    %r15
+  803643:	5d                   	pop    %rbp
+  803644:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803645:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80364c:	00 00 00 
+  80364f:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803652:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803659:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80365c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803661:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803668:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80366b:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803672:	00 00 00 
+  803675:	48 39 d7             	cmp    %rdx,%rdi
+  803678:	73 1c                	jae    803696 <mmap+0x257>
+        return -E_NO_MEM;
+  80367a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803680:	eb b1                	jmp    803633 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803682:	48 83 c0 01          	add    $0x1,%rax
+  803686:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80368a:	77 3f                	ja     8036cb <mmap+0x28c>
+  80368c:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803691:	48 39 d7             	cmp    %rdx,%rdi
+  803694:	72 2a                	jb     8036c0 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803696:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80369a:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80369e:	48 39 d1             	cmp    %rdx,%rcx
+  8036a1:	73 df                	jae    803682 <mmap+0x243>
+  8036a3:	48 85 c9             	test   %rcx,%rcx
+  8036a6:	74 da                	je     803682 <mmap+0x243>
+  8036a8:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8036ac:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8036b1:	48 39 d3             	cmp    %rdx,%rbx
+  8036b4:	73 cc                	jae    803682 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8036b6:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036be:	eb cc                	jmp    80368c <mmap+0x24d>
+        return -E_NO_MEM;
+  8036c0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036c6:	e9 68 ff ff ff       	jmp    803633 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8036cb:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8036d0:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8036d7:	00 00 00 
+  8036da:	48 39 c2             	cmp    %rax,%rdx
+  8036dd:	0f 82 9f 00 00 00    	jb     803782 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8036e3:	48 85 db             	test   %rbx,%rbx
+  8036e6:	0f 85 8a fe ff ff    	jne    803576 <mmap+0x137>
+        return -E_NO_MEM;
+  8036ec:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036f2:	e9 3c ff ff ff       	jmp    803633 <mmap+0x1f4>
+        if (n < 0) {
+  8036f7:	0f 89 2c ff ff ff    	jns    803629 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8036fd:	49 8b 3e             	mov    (%r14),%rdi
+  803700:	4c 89 ee             	mov    %r13,%rsi
+  803703:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  80370a:	00 00 00 
+  80370d:	ff d0                	call   *%rax
+            return n;
+  80370f:	45 89 e7             	mov    %r12d,%r15d
+  803712:	e9 1c ff ff ff       	jmp    803633 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803717:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80371d:	e9 11 ff ff ff       	jmp    803633 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803722:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803728:	e9 06 ff ff ff       	jmp    803633 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80372d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803733:	e9 fb fe ff ff       	jmp    803633 <mmap+0x1f4>
+  803738:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80373e:	e9 f0 fe ff ff       	jmp    803633 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803743:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803749:	e9 e5 fe ff ff       	jmp    803633 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80374e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803754:	e9 da fe ff ff       	jmp    803633 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803759:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80375f:	e9 cf fe ff ff       	jmp    803633 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803764:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80376a:	e9 c4 fe ff ff       	jmp    803633 <mmap+0x1f4>
+  80376f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803775:	e9 b9 fe ff ff       	jmp    803633 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80377a:	41 89 c7             	mov    %eax,%r15d
+  80377d:	e9 b1 fe ff ff       	jmp    803633 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803782:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803788:	e9 a6 fe ff ff       	jmp    803633 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80378d:	41 89 c7             	mov    %eax,%r15d
+  803790:	e9 9e fe ff ff       	jmp    803633 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803795:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80379b:	e9 93 fe ff ff       	jmp    803633 <mmap+0x1f4>
+
+00000000008037a0 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  8037a0:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  8037a4:	7f 01                	jg     8037a7 <writebuf+0x7>
+  8037a6:	c3                   	ret
+writebuf(struct printbuf *state) {
+  8037a7:	55                   	push   %rbp
+  8037a8:	48 89 e5             	mov    %rsp,%rbp
+  8037ab:	53                   	push   %rbx
+  8037ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8037b0:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8037b3:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8037b7:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8037bb:	8b 3f                	mov    (%rdi),%edi
+  8037bd:	48 b8 46 1b 80 00 00 	movabs $0x801b46,%rax
+  8037c4:	00 00 00 
+  8037c7:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8037c9:	48 85 c0             	test   %rax,%rax
+  8037cc:	7e 04                	jle    8037d2 <writebuf+0x32>
+  8037ce:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8037d2:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8037d6:	48 39 c2             	cmp    %rax,%rdx
+  8037d9:	74 0f                	je     8037ea <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8037db:	48 85 c0             	test   %rax,%rax
+  8037de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037e3:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8037e7:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8037ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ee:	c9                   	leave
+  8037ef:	c3                   	ret
+
+00000000008037f0 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8037f0:	8b 46 04             	mov    0x4(%rsi),%eax
+  8037f3:	8d 50 01             	lea    0x1(%rax),%edx
+  8037f6:	89 56 04             	mov    %edx,0x4(%rsi)
+  8037f9:	48 98                	cltq
+  8037fb:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803800:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803806:	74 01                	je     803809 <putch+0x19>
+  803808:	c3                   	ret
+putch(int ch, void *arg) {
+  803809:	55                   	push   %rbp
+  80380a:	48 89 e5             	mov    %rsp,%rbp
+  80380d:	53                   	push   %rbx
+  80380e:	48 83 ec 08          	sub    $0x8,%rsp
+  803812:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803815:	48 89 f7             	mov    %rsi,%rdi
+  803818:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  80381f:	00 00 00 
+  803822:	ff d0                	call   *%rax
+        state->offset = 0;
+  803824:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80382b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80382f:	c9                   	leave
+  803830:	c3                   	ret
+
+0000000000803831 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803831:	55                   	push   %rbp
+  803832:	48 89 e5             	mov    %rsp,%rbp
+  803835:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  80383c:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  80383f:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803845:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  80384c:	00 00 00 
+    state.result = 0;
+  80384f:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803856:	00 00 00 00 
+    state.error = 1;
+  80385a:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803861:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803864:	48 89 f2             	mov    %rsi,%rdx
+  803867:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  80386e:	48 bf f0 37 80 00 00 	movabs $0x8037f0,%rdi
+  803875:	00 00 00 
+  803878:	48 b8 3f 05 80 00 00 	movabs $0x80053f,%rax
+  80387f:	00 00 00 
+  803882:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803884:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  80388b:	7f 14                	jg     8038a1 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  80388d:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803894:	48 85 c0             	test   %rax,%rax
+  803897:	75 06                	jne    80389f <vfprintf+0x6e>
+  803899:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80389f:	c9                   	leave
+  8038a0:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  8038a1:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8038a8:	48 b8 a0 37 80 00 00 	movabs $0x8037a0,%rax
+  8038af:	00 00 00 
+  8038b2:	ff d0                	call   *%rax
+  8038b4:	eb d7                	jmp    80388d <vfprintf+0x5c>
+
+00000000008038b6 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8038b6:	55                   	push   %rbp
+  8038b7:	48 89 e5             	mov    %rsp,%rbp
+  8038ba:	48 83 ec 50          	sub    $0x50,%rsp
+  8038be:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8038c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8038c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8038ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8038ce:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8038d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8038e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8038e5:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8038e9:	48 b8 31 38 80 00 00 	movabs $0x803831,%rax
+  8038f0:	00 00 00 
+  8038f3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8038f5:	c9                   	leave
+  8038f6:	c3                   	ret
+
+00000000008038f7 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8038f7:	55                   	push   %rbp
+  8038f8:	48 89 e5             	mov    %rsp,%rbp
+  8038fb:	48 83 ec 50          	sub    $0x50,%rsp
+  8038ff:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803903:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803907:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80390b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80390f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803913:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80391a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80391e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803922:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803926:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80392a:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80392e:	48 89 fe             	mov    %rdi,%rsi
+  803931:	bf 01 00 00 00       	mov    $0x1,%edi
+  803936:	48 b8 31 38 80 00 00 	movabs $0x803831,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803942:	c9                   	leave
+  803943:	c3                   	ret
+
+0000000000803944 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803944:	55                   	push   %rbp
+  803945:	48 89 e5             	mov    %rsp,%rbp
+  803948:	41 54                	push   %r12
+  80394a:	53                   	push   %rbx
+  80394b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80394e:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803955:	00 00 00 
+  803958:	ff d0                	call   *%rax
+  80395a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80395d:	48 be a0 50 80 00 00 	movabs $0x8050a0,%rsi
+  803964:	00 00 00 
+  803967:	48 89 df             	mov    %rbx,%rdi
+  80396a:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803976:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80397b:	41 2b 04 24          	sub    (%r12),%eax
+  80397f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803985:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80398c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80398f:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803996:	00 00 00 
+  803999:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039a5:	5b                   	pop    %rbx
+  8039a6:	41 5c                	pop    %r12
+  8039a8:	5d                   	pop    %rbp
+  8039a9:	c3                   	ret
+
+00000000008039aa <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039aa:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8039ad:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8039b3:	8b 17                	mov    (%rdi),%edx
+  8039b5:	85 d2                	test   %edx,%edx
+  8039b7:	75 01                	jne    8039ba <pipe_wakeup+0x10>
+  8039b9:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039ba:	55                   	push   %rbp
+  8039bb:	48 89 e5             	mov    %rsp,%rbp
+  8039be:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8039c1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8039c7:	be 00 04 00 00       	mov    $0x400,%esi
+  8039cc:	48 b8 ff 15 80 00 00 	movabs $0x8015ff,%rax
+  8039d3:	00 00 00 
+  8039d6:	ff d0                	call   *%rax
+}
+  8039d8:	5d                   	pop    %rbp
+  8039d9:	c3                   	ret
+
+00000000008039da <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039da:	55                   	push   %rbp
+  8039db:	48 89 e5             	mov    %rsp,%rbp
+  8039de:	41 55                	push   %r13
+  8039e0:	41 54                	push   %r12
+  8039e2:	53                   	push   %rbx
+  8039e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8039e7:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039ea:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  8039f1:	00 00 00 
+  8039f4:	ff d0                	call   *%rax
+  8039f6:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8039f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039fe:	4c 89 e6             	mov    %r12,%rsi
+  803a01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a06:	49 bc 19 13 80 00 00 	movabs $0x801319,%r12
+  803a0d:	00 00 00 
+  803a10:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a13:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a17:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a1b:	49 bd aa 39 80 00 00 	movabs $0x8039aa,%r13
+  803a22:	00 00 00 
+  803a25:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a28:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a2c:	48 89 de             	mov    %rbx,%rsi
+  803a2f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803a32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a37:	48 89 de             	mov    %rbx,%rsi
+  803a3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a3f:	41 ff d4             	call   *%r12
+  803a42:	48 83 c4 08          	add    $0x8,%rsp
+  803a46:	5b                   	pop    %rbx
+  803a47:	41 5c                	pop    %r12
+  803a49:	41 5d                	pop    %r13
+  803a4b:	5d                   	pop    %rbp
+  803a4c:	c3                   	ret
+
+0000000000803a4d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803a4d:	55                   	push   %rbp
+  803a4e:	48 89 e5             	mov    %rsp,%rbp
+  803a51:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a54:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a59:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a5e:	48 b8 5c 12 80 00 00 	movabs $0x80125c,%rax
+  803a65:	00 00 00 
+  803a68:	ff d0                	call   *%rax
+  803a6a:	85 c0                	test   %eax,%eax
+  803a6c:	0f 94 c0             	sete   %al
+  803a6f:	0f b6 c0             	movzbl %al,%eax
+}
+  803a72:	5d                   	pop    %rbp
+  803a73:	c3                   	ret
+
+0000000000803a74 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	41 57                	push   %r15
+  803a7a:	41 56                	push   %r14
+  803a7c:	41 55                	push   %r13
+  803a7e:	41 54                	push   %r12
+  803a80:	53                   	push   %rbx
+  803a81:	48 83 ec 38          	sub    $0x38,%rsp
+  803a85:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a89:	49 89 f4             	mov    %rsi,%r12
+  803a8c:	49 89 d7             	mov    %rdx,%r15
+  803a8f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a93:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803a9a:	00 00 00 
+  803a9d:	ff d0                	call   *%rax
+  803a9f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803aa2:	4d 85 ff             	test   %r15,%r15
+  803aa5:	0f 84 f1 00 00 00    	je     803b9c <devpipe_write+0x128>
+  803aab:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803aaf:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803ab3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803ab7:	49 bd 4d 3a 80 00 00 	movabs $0x803a4d,%r13
+  803abe:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ac1:	49 bf aa 39 80 00 00 	movabs $0x8039aa,%r15
+  803ac8:	00 00 00 
+  803acb:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803acf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ad3:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ad7:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ada:	48 63 ce             	movslq %esi,%rcx
+  803add:	48 63 03             	movslq (%rbx),%rax
+  803ae0:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803ae6:	48 39 c1             	cmp    %rax,%rcx
+  803ae9:	72 64                	jb     803b4f <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803aeb:	48 89 de             	mov    %rbx,%rsi
+  803aee:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803af2:	41 ff d5             	call   *%r13
+  803af5:	85 c0                	test   %eax,%eax
+  803af7:	0f 85 b9 00 00 00    	jne    803bb6 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803afd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b01:	4c 89 f7             	mov    %r14,%rdi
+  803b04:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b07:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b0a:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b11:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b18:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b1e:	8b 03                	mov    (%rbx),%eax
+  803b20:	41 39 c4             	cmp    %eax,%r12d
+  803b23:	75 b2                	jne    803ad7 <devpipe_write+0x63>
+  803b25:	48 89 de             	mov    %rbx,%rsi
+  803b28:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b2c:	41 ff d5             	call   *%r13
+  803b2f:	85 c0                	test   %eax,%eax
+  803b31:	75 a0                	jne    803ad3 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b33:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b38:	44 89 e6             	mov    %r12d,%esi
+  803b3b:	48 89 df             	mov    %rbx,%rdi
+  803b3e:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  803b45:	00 00 00 
+  803b48:	ff d0                	call   *%rax
+  803b4a:	e9 7c ff ff ff       	jmp    803acb <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b4f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803b53:	41 0f b6 38          	movzbl (%r8),%edi
+  803b57:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803b5e:	80 80 80 
+  803b61:	48 89 c8             	mov    %rcx,%rax
+  803b64:	48 f7 e2             	mul    %rdx
+  803b67:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803b6b:	48 89 d0             	mov    %rdx,%rax
+  803b6e:	48 c1 e0 08          	shl    $0x8,%rax
+  803b72:	48 29 d0             	sub    %rdx,%rax
+  803b75:	48 c1 e0 04          	shl    $0x4,%rax
+  803b79:	48 29 c1             	sub    %rax,%rcx
+  803b7c:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b81:	83 c6 01             	add    $0x1,%esi
+  803b84:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b87:	49 83 c0 01          	add    $0x1,%r8
+  803b8b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803b8f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b93:	49 39 c0             	cmp    %rax,%r8
+  803b96:	0f 85 2f ff ff ff    	jne    803acb <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b9c:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803ba0:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ba4:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803bab:	00 00 00 
+  803bae:	ff d0                	call   *%rax
+    return n;
+  803bb0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803bb4:	eb 05                	jmp    803bbb <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bbb:	48 83 c4 38          	add    $0x38,%rsp
+  803bbf:	5b                   	pop    %rbx
+  803bc0:	41 5c                	pop    %r12
+  803bc2:	41 5d                	pop    %r13
+  803bc4:	41 5e                	pop    %r14
+  803bc6:	41 5f                	pop    %r15
+  803bc8:	5d                   	pop    %rbp
+  803bc9:	c3                   	ret
+
+0000000000803bca <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bca:	55                   	push   %rbp
+  803bcb:	48 89 e5             	mov    %rsp,%rbp
+  803bce:	41 57                	push   %r15
+  803bd0:	41 56                	push   %r14
+  803bd2:	41 55                	push   %r13
+  803bd4:	41 54                	push   %r12
+  803bd6:	53                   	push   %rbx
+  803bd7:	48 83 ec 28          	sub    $0x28,%rsp
+  803bdb:	49 89 fd             	mov    %rdi,%r13
+  803bde:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803be2:	49 89 d4             	mov    %rdx,%r12
+  803be5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803be9:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803bf0:	00 00 00 
+  803bf3:	ff d0                	call   *%rax
+  803bf5:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803bf8:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803bfe:	49 bf 4d 3a 80 00 00 	movabs $0x803a4d,%r15
+  803c05:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c08:	4d 85 e4             	test   %r12,%r12
+  803c0b:	0f 84 d5 00 00 00    	je     803ce6 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c11:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c19:	8b 03                	mov    (%rbx),%eax
+  803c1b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c1e:	75 7a                	jne    803c9a <devpipe_read+0xd0>
+            if (i > 0) {
+  803c20:	4d 85 f6             	test   %r14,%r14
+  803c23:	75 50                	jne    803c75 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c25:	48 89 de             	mov    %rbx,%rsi
+  803c28:	4c 89 ef             	mov    %r13,%rdi
+  803c2b:	41 ff d7             	call   *%r15
+  803c2e:	85 c0                	test   %eax,%eax
+  803c30:	0f 85 c9 00 00 00    	jne    803cff <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c36:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803c39:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c40:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c46:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c49:	41 39 c4             	cmp    %eax,%r12d
+  803c4c:	75 cb                	jne    803c19 <devpipe_read+0x4f>
+  803c4e:	48 89 de             	mov    %rbx,%rsi
+  803c51:	4c 89 ef             	mov    %r13,%rdi
+  803c54:	41 ff d7             	call   *%r15
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	75 be                	jne    803c19 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c5b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c60:	44 89 e6             	mov    %r12d,%esi
+  803c63:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c67:	48 b8 e1 15 80 00 00 	movabs $0x8015e1,%rax
+  803c6e:	00 00 00 
+  803c71:	ff d0                	call   *%rax
+  803c73:	eb a4                	jmp    803c19 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c75:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c79:	48 89 de             	mov    %rbx,%rsi
+  803c7c:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803c83:	00 00 00 
+  803c86:	ff d0                	call   *%rax
+                return i;
+  803c88:	4c 89 f0             	mov    %r14,%rax
+}
+  803c8b:	48 83 c4 28          	add    $0x28,%rsp
+  803c8f:	5b                   	pop    %rbx
+  803c90:	41 5c                	pop    %r12
+  803c92:	41 5d                	pop    %r13
+  803c94:	41 5e                	pop    %r14
+  803c96:	41 5f                	pop    %r15
+  803c98:	5d                   	pop    %rbp
+  803c99:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803c9a:	48 63 c8             	movslq %eax,%rcx
+  803c9d:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ca4:	80 80 80 
+  803ca7:	48 89 c8             	mov    %rcx,%rax
+  803caa:	48 f7 e2             	mul    %rdx
+  803cad:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803cb1:	48 89 d0             	mov    %rdx,%rax
+  803cb4:	48 c1 e0 08          	shl    $0x8,%rax
+  803cb8:	48 29 d0             	sub    %rdx,%rax
+  803cbb:	48 c1 e0 04          	shl    $0x4,%rax
+  803cbf:	48 89 c2             	mov    %rax,%rdx
+  803cc2:	48 89 c8             	mov    %rcx,%rax
+  803cc5:	48 29 d0             	sub    %rdx,%rax
+  803cc8:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803ccd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803cd1:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803cd5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803cd8:	49 83 c6 01          	add    $0x1,%r14
+  803cdc:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803ce0:	0f 85 2b ff ff ff    	jne    803c11 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ce6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803cea:	48 89 de             	mov    %rbx,%rsi
+  803ced:	48 b8 aa 39 80 00 00 	movabs $0x8039aa,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+    return n;
+  803cf9:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803cfd:	eb 8c                	jmp    803c8b <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cff:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d04:	eb 85                	jmp    803c8b <devpipe_read+0xc1>
+
+0000000000803d06 <pipe>:
+pipe(int pfd[2]) {
+  803d06:	55                   	push   %rbp
+  803d07:	48 89 e5             	mov    %rsp,%rbp
+  803d0a:	41 55                	push   %r13
+  803d0c:	41 54                	push   %r12
+  803d0e:	53                   	push   %rbx
+  803d0f:	48 83 ec 18          	sub    $0x18,%rsp
+  803d13:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d16:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d1a:	48 b8 d4 16 80 00 00 	movabs $0x8016d4,%rax
+  803d21:	00 00 00 
+  803d24:	ff d0                	call   *%rax
+  803d26:	89 c3                	mov    %eax,%ebx
+  803d28:	85 c0                	test   %eax,%eax
+  803d2a:	0f 88 a0 01 00 00    	js     803ed0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d35:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d3a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d43:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  803d4a:	00 00 00 
+  803d4d:	ff d0                	call   *%rax
+  803d4f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d51:	85 c0                	test   %eax,%eax
+  803d53:	0f 88 77 01 00 00    	js     803ed0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d59:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803d5d:	48 b8 d4 16 80 00 00 	movabs $0x8016d4,%rax
+  803d64:	00 00 00 
+  803d67:	ff d0                	call   *%rax
+  803d69:	89 c3                	mov    %eax,%ebx
+  803d6b:	85 c0                	test   %eax,%eax
+  803d6d:	0f 88 43 01 00 00    	js     803eb6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803d73:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d7d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d81:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d86:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+  803d92:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d94:	85 c0                	test   %eax,%eax
+  803d96:	0f 88 1a 01 00 00    	js     803eb6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803d9c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803da0:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803da7:	00 00 00 
+  803daa:	ff d0                	call   *%rax
+  803dac:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803daf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803db4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db9:	48 89 c6             	mov    %rax,%rsi
+  803dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dc1:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  803dc8:	00 00 00 
+  803dcb:	ff d0                	call   *%rax
+  803dcd:	89 c3                	mov    %eax,%ebx
+  803dcf:	85 c0                	test   %eax,%eax
+  803dd1:	0f 88 c5 00 00 00    	js     803e9c <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803dd7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ddb:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803de2:	00 00 00 
+  803de5:	ff d0                	call   *%rax
+  803de7:	48 89 c1             	mov    %rax,%rcx
+  803dea:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803df0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dfb:	4c 89 ee             	mov    %r13,%rsi
+  803dfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e03:	48 b8 c9 12 80 00 00 	movabs $0x8012c9,%rax
+  803e0a:	00 00 00 
+  803e0d:	ff d0                	call   *%rax
+  803e0f:	89 c3                	mov    %eax,%ebx
+  803e11:	85 c0                	test   %eax,%eax
+  803e13:	78 6e                	js     803e83 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e15:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e1a:	4c 89 ef             	mov    %r13,%rdi
+  803e1d:	48 b8 38 12 80 00 00 	movabs $0x801238,%rax
+  803e24:	00 00 00 
+  803e27:	ff d0                	call   *%rax
+  803e29:	83 f8 02             	cmp    $0x2,%eax
+  803e2c:	0f 85 ab 00 00 00    	jne    803edd <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e32:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803e39:	00 00 
+  803e3b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e3f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803e41:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e45:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803e4c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e50:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803e52:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e56:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803e5d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e61:	48 bb a6 16 80 00 00 	movabs $0x8016a6,%rbx
+  803e68:	00 00 00 
+  803e6b:	ff d3                	call   *%rbx
+  803e6d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803e71:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e75:	ff d3                	call   *%rbx
+  803e77:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803e7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e81:	eb 4d                	jmp    803ed0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803e83:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e88:	4c 89 ee             	mov    %r13,%rsi
+  803e8b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e90:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803e9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ea5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eaa:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803eb1:	00 00 00 
+  803eb4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803eb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ebb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ebf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec4:	48 b8 19 13 80 00 00 	movabs $0x801319,%rax
+  803ecb:	00 00 00 
+  803ece:	ff d0                	call   *%rax
+}
+  803ed0:	89 d8                	mov    %ebx,%eax
+  803ed2:	48 83 c4 18          	add    $0x18,%rsp
+  803ed6:	5b                   	pop    %rbx
+  803ed7:	41 5c                	pop    %r12
+  803ed9:	41 5d                	pop    %r13
+  803edb:	5d                   	pop    %rbp
+  803edc:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803edd:	48 b9 d0 50 80 00 00 	movabs $0x8050d0,%rcx
+  803ee4:	00 00 00 
+  803ee7:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  803eee:	00 00 00 
+  803ef1:	be 50 00 00 00       	mov    $0x50,%esi
+  803ef6:	48 bf bc 50 80 00 00 	movabs $0x8050bc,%rdi
+  803efd:	00 00 00 
+  803f00:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f05:	49 b8 9f 02 80 00 00 	movabs $0x80029f,%r8
+  803f0c:	00 00 00 
+  803f0f:	41 ff d0             	call   *%r8
+
+0000000000803f12 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f12:	55                   	push   %rbp
+  803f13:	48 89 e5             	mov    %rsp,%rbp
+  803f16:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f1a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f1e:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803f25:	00 00 00 
+  803f28:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f2a:	85 c0                	test   %eax,%eax
+  803f2c:	78 23                	js     803f51 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f2e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f32:	48 b8 b8 16 80 00 00 	movabs $0x8016b8,%rax
+  803f39:	00 00 00 
+  803f3c:	ff d0                	call   *%rax
+  803f3e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803f41:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f45:	48 b8 4d 3a 80 00 00 	movabs $0x803a4d,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+}
+  803f51:	c9                   	leave
+  803f52:	c3                   	ret
+
+0000000000803f53 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f53:	48 89 f8             	mov    %rdi,%rax
+  803f56:	48 c1 e8 27          	shr    $0x27,%rax
+  803f5a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f61:	01 00 00 
+  803f64:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f68:	f6 c2 01             	test   $0x1,%dl
+  803f6b:	74 6d                	je     803fda <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f6d:	48 89 f8             	mov    %rdi,%rax
+  803f70:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f74:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f7b:	01 00 00 
+  803f7e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f82:	f6 c2 01             	test   $0x1,%dl
+  803f85:	74 62                	je     803fe9 <get_uvpt_entry+0x96>
+  803f87:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f8e:	01 00 00 
+  803f91:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f95:	f6 c2 80             	test   $0x80,%dl
+  803f98:	75 4f                	jne    803fe9 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f9a:	48 89 f8             	mov    %rdi,%rax
+  803f9d:	48 c1 e8 15          	shr    $0x15,%rax
+  803fa1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fa8:	01 00 00 
+  803fab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803faf:	f6 c2 01             	test   $0x1,%dl
+  803fb2:	74 44                	je     803ff8 <get_uvpt_entry+0xa5>
+  803fb4:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fbb:	01 00 00 
+  803fbe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fc2:	f6 c2 80             	test   $0x80,%dl
+  803fc5:	75 31                	jne    803ff8 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803fc7:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803fcb:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803fd2:	01 00 00 
+  803fd5:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803fd9:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fda:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fe1:	01 00 00 
+  803fe4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803fe8:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fe9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ff0:	01 00 00 
+  803ff3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ff7:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ff8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fff:	01 00 00 
+  804002:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804006:	c3                   	ret
+
+0000000000804007 <get_prot>:
+
+int
+get_prot(void *va) {
+  804007:	55                   	push   %rbp
+  804008:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80400b:	48 b8 53 3f 80 00 00 	movabs $0x803f53,%rax
+  804012:	00 00 00 
+  804015:	ff d0                	call   *%rax
+  804017:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80401a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80401f:	89 c1                	mov    %eax,%ecx
+  804021:	83 c9 04             	or     $0x4,%ecx
+  804024:	f6 c2 01             	test   $0x1,%dl
+  804027:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80402a:	89 c1                	mov    %eax,%ecx
+  80402c:	83 c9 02             	or     $0x2,%ecx
+  80402f:	f6 c2 02             	test   $0x2,%dl
+  804032:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804035:	89 c1                	mov    %eax,%ecx
+  804037:	83 c9 01             	or     $0x1,%ecx
+  80403a:	48 85 d2             	test   %rdx,%rdx
+  80403d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804040:	89 c1                	mov    %eax,%ecx
+  804042:	83 c9 40             	or     $0x40,%ecx
+  804045:	f6 c6 04             	test   $0x4,%dh
+  804048:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80404b:	5d                   	pop    %rbp
+  80404c:	c3                   	ret
+
+000000000080404d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80404d:	55                   	push   %rbp
+  80404e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804051:	48 b8 53 3f 80 00 00 	movabs $0x803f53,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80405d:	48 c1 e8 06          	shr    $0x6,%rax
+  804061:	83 e0 01             	and    $0x1,%eax
+}
+  804064:	5d                   	pop    %rbp
+  804065:	c3                   	ret
+
+0000000000804066 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804066:	55                   	push   %rbp
+  804067:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80406a:	48 b8 53 3f 80 00 00 	movabs $0x803f53,%rax
+  804071:	00 00 00 
+  804074:	ff d0                	call   *%rax
+  804076:	83 e0 01             	and    $0x1,%eax
+}
+  804079:	5d                   	pop    %rbp
+  80407a:	c3                   	ret
+
+000000000080407b <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80407b:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804082:	01 00 00 
+  804085:	a8 01                	test   $0x1,%al
+  804087:	75 06                	jne    80408f <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80408e:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80408f:	55                   	push   %rbp
+  804090:	48 89 e5             	mov    %rsp,%rbp
+  804093:	41 57                	push   %r15
+  804095:	41 56                	push   %r14
+  804097:	41 55                	push   %r13
+  804099:	41 54                	push   %r12
+  80409b:	53                   	push   %rbx
+  80409c:	48 83 ec 28          	sub    $0x28,%rsp
+  8040a0:	49 89 fe             	mov    %rdi,%r14
+  8040a3:	49 89 f7             	mov    %rsi,%r15
+  8040a6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8040ad:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040ae:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8040b5:	01 00 00 
+  8040b8:	e9 ae 00 00 00       	jmp    80416b <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8040bd:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040c4:	49 83 ec 01          	sub    $0x1,%r12
+  8040c8:	74 2d                	je     8040f7 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040ca:	48 89 d8             	mov    %rbx,%rax
+  8040cd:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040d1:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040d6:	f6 c2 01             	test   $0x1,%dl
+  8040d9:	74 e2                	je     8040bd <foreach_shared_region+0x42>
+  8040db:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040e0:	f6 c4 04             	test   $0x4,%ah
+  8040e3:	74 d8                	je     8040bd <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8040e5:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040ec:	4c 89 fa             	mov    %r15,%rdx
+  8040ef:	48 89 df             	mov    %rbx,%rdi
+  8040f2:	41 ff d6             	call   *%r14
+  8040f5:	eb c6                	jmp    8040bd <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8040f7:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8040fe:	00 
+  8040ff:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804104:	74 4a                	je     804150 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804106:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80410a:	48 c1 e8 15          	shr    $0x15,%rax
+  80410e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804115:	01 00 00 
+  804118:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80411c:	a8 01                	test   $0x1,%al
+  80411e:	74 d7                	je     8040f7 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804120:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804124:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80412b:	48 39 c3             	cmp    %rax,%rbx
+  80412e:	73 c7                	jae    8040f7 <foreach_shared_region+0x7c>
+  804130:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804137:	48 39 d0             	cmp    %rdx,%rax
+  80413a:	4d 19 e4             	sbb    %r12,%r12
+  80413d:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804144:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80414b:	e9 7a ff ff ff       	jmp    8040ca <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804150:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804157:	40 
+  804158:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80415c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804163:	00 00 00 
+  804166:	48 39 c1             	cmp    %rax,%rcx
+  804169:	74 50                	je     8041bb <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80416b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80416f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804173:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80417a:	01 00 00 
+  80417d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804181:	a8 01                	test   $0x1,%al
+  804183:	74 cb                	je     804150 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804185:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804189:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804190:	48 39 c1             	cmp    %rax,%rcx
+  804193:	73 bb                	jae    804150 <foreach_shared_region+0xd5>
+  804195:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80419c:	48 39 d0             	cmp    %rdx,%rax
+  80419f:	48 19 c0             	sbb    %rax,%rax
+  8041a2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8041a8:	48 05 00 02 00 00    	add    $0x200,%rax
+  8041ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041b2:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041b6:	e9 4b ff ff ff       	jmp    804106 <foreach_shared_region+0x8b>
+  8041bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c0:	48 83 c4 28          	add    $0x28,%rsp
+  8041c4:	5b                   	pop    %rbx
+  8041c5:	41 5c                	pop    %r12
+  8041c7:	41 5d                	pop    %r13
+  8041c9:	41 5e                	pop    %r14
+  8041cb:	41 5f                	pop    %r15
+  8041cd:	5d                   	pop    %rbp
+  8041ce:	c3                   	ret
+
+00000000008041cf <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8041cf:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8041d5:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8041dc:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8041e3:	c3                   	ret
+
+00000000008041e4 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8041e4:	8b 47 40             	mov    0x40(%rdi),%eax
+  8041e7:	8b 17                	mov    (%rdi),%edx
+  8041e9:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8041eb:	83 f8 0f             	cmp    $0xf,%eax
+  8041ee:	77 13                	ja     804203 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8041f0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8041f3:	83 e0 0f             	and    $0xf,%eax
+  8041f6:	48 c1 e0 09          	shl    $0x9,%rax
+  8041fa:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804201:	00 
+  804202:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804208:	c3                   	ret
+
+0000000000804209 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804209:	8b 47 40             	mov    0x40(%rdi),%eax
+  80420c:	83 c0 01             	add    $0x1,%eax
+  80420f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804212:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804218:	8b 57 04             	mov    0x4(%rdi),%edx
+  80421b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804220:	85 d2                	test   %edx,%edx
+  804222:	75 04                	jne    804228 <chan_publish+0x1f>
+  804224:	83 e0 01             	and    $0x1,%eax
+}
+  804227:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804228:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80422b:	85 c0                	test   %eax,%eax
+  80422d:	0f 95 c0             	setne  %al
+  804230:	0f b6 c0             	movzbl %al,%eax
+  804233:	eb ef                	jmp    804224 <chan_publish+0x1b>
+
+0000000000804235 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804235:	8b 47 40             	mov    0x40(%rdi),%eax
+  804238:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80423a:	29 d0                	sub    %edx,%eax
+  80423c:	83 e8 01             	sub    $0x1,%eax
+  80423f:	83 f8 0f             	cmp    $0xf,%eax
+  804242:	77 12                	ja     804256 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804244:	8b 07                	mov    (%rdi),%eax
+  804246:	83 e0 0f             	and    $0xf,%eax
+  804249:	48 c1 e0 09          	shl    $0x9,%rax
+  80424d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804254:	00 
+  804255:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804256:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80425b:	c3                   	ret
+
+000000000080425c <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80425c:	8b 07                	mov    (%rdi),%eax
+  80425e:	83 c0 01             	add    $0x1,%eax
+  804261:	89 07                	mov    %eax,(%rdi)
+}
+  804263:	c3                   	ret
+
+0000000000804264 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804264:	55                   	push   %rbp
+  804265:	48 89 e5             	mov    %rsp,%rbp
+  804268:	53                   	push   %rbx
+  804269:	48 83 ec 08          	sub    $0x8,%rsp
+  80426d:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804270:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804277:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80427d:	48 b8 35 42 80 00 00 	movabs $0x804235,%rax
+  804284:	00 00 00 
+  804287:	ff d0                	call   *%rax
+  804289:	48 85 c0             	test   %rax,%rax
+  80428c:	74 12                	je     8042a0 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80428e:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804295:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80429a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80429e:	c9                   	leave
+  80429f:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8042a0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042a5:	eb f3                	jmp    80429a <chan_arm+0x36>
+
+00000000008042a7 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8042a7:	55                   	push   %rbp
+  8042a8:	48 89 e5             	mov    %rsp,%rbp
+  8042ab:	41 56                	push   %r14
+  8042ad:	41 55                	push   %r13
+  8042af:	41 54                	push   %r12
+  8042b1:	53                   	push   %rbx
+  8042b2:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8042b5:	49 bc 64 42 80 00 00 	movabs $0x804264,%r12
+  8042bc:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042bf:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8042c3:	49 bd e1 15 80 00 00 	movabs $0x8015e1,%r13
+  8042ca:	00 00 00 
+    while (chan_arm(r))
+  8042cd:	eb 0d                	jmp    8042dc <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042cf:	8b 33                	mov    (%rbx),%esi
+  8042d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042d6:	4c 89 f7             	mov    %r14,%rdi
+  8042d9:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8042dc:	48 89 df             	mov    %rbx,%rdi
+  8042df:	41 ff d4             	call   *%r12
+  8042e2:	84 c0                	test   %al,%al
+  8042e4:	75 e9                	jne    8042cf <chan_wait+0x28>
+}
+  8042e6:	5b                   	pop    %rbx
+  8042e7:	41 5c                	pop    %r12
+  8042e9:	41 5d                	pop    %r13
+  8042eb:	41 5e                	pop    %r14
+  8042ed:	5d                   	pop    %rbp
+  8042ee:	c3                   	ret
+
+00000000008042ef <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8042ef:	55                   	push   %rbp
+  8042f0:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8042f3:	48 83 c7 40          	add    $0x40,%rdi
+  8042f7:	be 01 00 00 00       	mov    $0x1,%esi
+  8042fc:	48 b8 ff 15 80 00 00 	movabs $0x8015ff,%rax
+  804303:	00 00 00 
+  804306:	ff d0                	call   *%rax
+}
+  804308:	5d                   	pop    %rbp
+  804309:	c3                   	ret
+
+000000000080430a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80430a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80430f:	c3                   	ret
+
+0000000000804310 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804310:	55                   	push   %rbp
+  804311:	48 89 e5             	mov    %rsp,%rbp
+  804314:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804317:	48 be f4 50 80 00 00 	movabs $0x8050f4,%rsi
+  80431e:	00 00 00 
+  804321:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+    return 0;
+}
+  80432d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804332:	5d                   	pop    %rbp
+  804333:	c3                   	ret
+
+0000000000804334 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804334:	55                   	push   %rbp
+  804335:	48 89 e5             	mov    %rsp,%rbp
+  804338:	41 57                	push   %r15
+  80433a:	41 56                	push   %r14
+  80433c:	41 55                	push   %r13
+  80433e:	41 54                	push   %r12
+  804340:	53                   	push   %rbx
+  804341:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804348:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80434f:	48 85 d2             	test   %rdx,%rdx
+  804352:	74 7a                	je     8043ce <devcons_write+0x9a>
+  804354:	49 89 d6             	mov    %rdx,%r14
+  804357:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80435d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804362:	49 bf 0e 0f 80 00 00 	movabs $0x800f0e,%r15
+  804369:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80436c:	4c 89 f3             	mov    %r14,%rbx
+  80436f:	48 29 f3             	sub    %rsi,%rbx
+  804372:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804377:	48 39 c3             	cmp    %rax,%rbx
+  80437a:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80437e:	4c 63 eb             	movslq %ebx,%r13
+  804381:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804388:	48 01 c6             	add    %rax,%rsi
+  80438b:	4c 89 ea             	mov    %r13,%rdx
+  80438e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804395:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804398:	4c 89 ee             	mov    %r13,%rsi
+  80439b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043a2:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  8043a9:	00 00 00 
+  8043ac:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8043ae:	41 01 dc             	add    %ebx,%r12d
+  8043b1:	49 63 f4             	movslq %r12d,%rsi
+  8043b4:	4c 39 f6             	cmp    %r14,%rsi
+  8043b7:	72 b3                	jb     80436c <devcons_write+0x38>
+    return res;
+  8043b9:	49 63 c4             	movslq %r12d,%rax
+}
+  8043bc:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8043c3:	5b                   	pop    %rbx
+  8043c4:	41 5c                	pop    %r12
+  8043c6:	41 5d                	pop    %r13
+  8043c8:	41 5e                	pop    %r14
+  8043ca:	41 5f                	pop    %r15
+  8043cc:	5d                   	pop    %rbp
+  8043cd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8043ce:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043d4:	eb e3                	jmp    8043b9 <devcons_write+0x85>
+
+00000000008043d6 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043d6:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8043d9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043de:	48 85 c0             	test   %rax,%rax
+  8043e1:	74 55                	je     804438 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043e3:	55                   	push   %rbp
+  8043e4:	48 89 e5             	mov    %rsp,%rbp
+  8043e7:	41 55                	push   %r13
+  8043e9:	41 54                	push   %r12
+  8043eb:	53                   	push   %rbx
+  8043ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8043f0:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8043f3:	48 bb 5a 11 80 00 00 	movabs $0x80115a,%rbx
+  8043fa:	00 00 00 
+  8043fd:	49 bc 0f 12 80 00 00 	movabs $0x80120f,%r12
+  804404:	00 00 00 
+  804407:	eb 03                	jmp    80440c <devcons_read+0x36>
+  804409:	41 ff d4             	call   *%r12
+  80440c:	ff d3                	call   *%rbx
+  80440e:	85 c0                	test   %eax,%eax
+  804410:	74 f7                	je     804409 <devcons_read+0x33>
+    if (c < 0) return c;
+  804412:	48 63 d0             	movslq %eax,%rdx
+  804415:	78 13                	js     80442a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804417:	ba 00 00 00 00       	mov    $0x0,%edx
+  80441c:	83 f8 04             	cmp    $0x4,%eax
+  80441f:	74 09                	je     80442a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804421:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804425:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80442a:	48 89 d0             	mov    %rdx,%rax
+  80442d:	48 83 c4 08          	add    $0x8,%rsp
+  804431:	5b                   	pop    %rbx
+  804432:	41 5c                	pop    %r12
+  804434:	41 5d                	pop    %r13
+  804436:	5d                   	pop    %rbp
+  804437:	c3                   	ret
+  804438:	48 89 d0             	mov    %rdx,%rax
+  80443b:	c3                   	ret
+
+000000000080443c <cputchar>:
+cputchar(int ch) {
+  80443c:	55                   	push   %rbp
+  80443d:	48 89 e5             	mov    %rsp,%rbp
+  804440:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804444:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804448:	be 01 00 00 00       	mov    $0x1,%esi
+  80444d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804451:	48 b8 3b 11 80 00 00 	movabs $0x80113b,%rax
+  804458:	00 00 00 
+  80445b:	ff d0                	call   *%rax
+}
+  80445d:	c9                   	leave
+  80445e:	c3                   	ret
+
+000000000080445f <getchar>:
+getchar(void) {
+  80445f:	55                   	push   %rbp
+  804460:	48 89 e5             	mov    %rsp,%rbp
+  804463:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804467:	ba 01 00 00 00       	mov    $0x1,%edx
+  80446c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804470:	bf 00 00 00 00       	mov    $0x0,%edi
+  804475:	48 b8 17 1a 80 00 00 	movabs $0x801a17,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+  804481:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804483:	85 c0                	test   %eax,%eax
+  804485:	78 06                	js     80448d <getchar+0x2e>
+  804487:	74 08                	je     804491 <getchar+0x32>
+  804489:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80448d:	89 d0                	mov    %edx,%eax
+  80448f:	c9                   	leave
+  804490:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804491:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804496:	eb f5                	jmp    80448d <getchar+0x2e>
+
+0000000000804498 <iscons>:
+iscons(int fdnum) {
+  804498:	55                   	push   %rbp
+  804499:	48 89 e5             	mov    %rsp,%rbp
+  80449c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044a0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8044a4:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  8044ab:	00 00 00 
+  8044ae:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044b0:	85 c0                	test   %eax,%eax
+  8044b2:	78 18                	js     8044cc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8044b4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044b8:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8044bf:	00 00 00 
+  8044c2:	8b 00                	mov    (%rax),%eax
+  8044c4:	39 02                	cmp    %eax,(%rdx)
+  8044c6:	0f 94 c0             	sete   %al
+  8044c9:	0f b6 c0             	movzbl %al,%eax
+}
+  8044cc:	c9                   	leave
+  8044cd:	c3                   	ret
+
+00000000008044ce <opencons>:
+opencons(void) {
+  8044ce:	55                   	push   %rbp
+  8044cf:	48 89 e5             	mov    %rsp,%rbp
+  8044d2:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8044d6:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8044da:	48 b8 d4 16 80 00 00 	movabs $0x8016d4,%rax
+  8044e1:	00 00 00 
+  8044e4:	ff d0                	call   *%rax
+  8044e6:	85 c0                	test   %eax,%eax
+  8044e8:	78 49                	js     804533 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8044ea:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044f4:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8044f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044fd:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  804504:	00 00 00 
+  804507:	ff d0                	call   *%rax
+  804509:	85 c0                	test   %eax,%eax
+  80450b:	78 26                	js     804533 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80450d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804511:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804518:	00 00 
+  80451a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80451c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804520:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804527:	48 b8 a6 16 80 00 00 	movabs $0x8016a6,%rax
+  80452e:	00 00 00 
+  804531:	ff d0                	call   *%rax
+}
+  804533:	c9                   	leave
+  804534:	c3                   	ret
+
+0000000000804535 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804535:	55                   	push   %rbp
+  804536:	48 89 e5             	mov    %rsp,%rbp
+  804539:	41 56                	push   %r14
+  80453b:	41 55                	push   %r13
+  80453d:	41 54                	push   %r12
+  80453f:	53                   	push   %rbx
+  804540:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804543:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80454a:	00 00 00 
+  80454d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804551:	74 27                	je     80457a <_handle_vectored_pagefault+0x45>
+  804553:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804558:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80455f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804562:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804565:	4c 89 e7             	mov    %r12,%rdi
+  804568:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80456d:	84 c0                	test   %al,%al
+  80456f:	75 45                	jne    8045b6 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804571:	48 83 c3 01          	add    $0x1,%rbx
+  804575:	49 3b 1e             	cmp    (%r14),%rbx
+  804578:	72 eb                	jb     804565 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80457a:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804581:	00 
+  804582:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804587:	4d 8b 04 24          	mov    (%r12),%r8
+  80458b:	48 ba 00 51 80 00 00 	movabs $0x805100,%rdx
+  804592:	00 00 00 
+  804595:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80459a:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  8045a1:	00 00 00 
+  8045a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045a9:	49 ba 9f 02 80 00 00 	movabs $0x80029f,%r10
+  8045b0:	00 00 00 
+  8045b3:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8045b6:	5b                   	pop    %rbx
+  8045b7:	41 5c                	pop    %r12
+  8045b9:	41 5d                	pop    %r13
+  8045bb:	41 5e                	pop    %r14
+  8045bd:	5d                   	pop    %rbp
+  8045be:	c3                   	ret
+
+00000000008045bf <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8045bf:	55                   	push   %rbp
+  8045c0:	48 89 e5             	mov    %rsp,%rbp
+  8045c3:	53                   	push   %rbx
+  8045c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c8:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8045cb:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8045d2:	00 00 00 
+  8045d5:	80 38 00             	cmpb   $0x0,(%rax)
+  8045d8:	0f 84 84 00 00 00    	je     804662 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045de:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045e5:	00 00 00 
+  8045e8:	48 8b 10             	mov    (%rax),%rdx
+  8045eb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8045f0:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8045f7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045fa:	48 85 d2             	test   %rdx,%rdx
+  8045fd:	74 19                	je     804618 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8045ff:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804603:	0f 84 e8 00 00 00    	je     8046f1 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804609:	48 83 c0 01          	add    $0x1,%rax
+  80460d:	48 39 d0             	cmp    %rdx,%rax
+  804610:	75 ed                	jne    8045ff <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804612:	48 83 fa 08          	cmp    $0x8,%rdx
+  804616:	74 1c                	je     804634 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804618:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80461c:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804623:	00 00 00 
+  804626:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80462d:	00 00 00 
+  804630:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804634:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  80463b:	00 00 00 
+  80463e:	ff d0                	call   *%rax
+  804640:	89 c7                	mov    %eax,%edi
+  804642:	48 be b7 47 80 00 00 	movabs $0x8047b7,%rsi
+  804649:	00 00 00 
+  80464c:	48 b8 31 14 80 00 00 	movabs $0x801431,%rax
+  804653:	00 00 00 
+  804656:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804658:	85 c0                	test   %eax,%eax
+  80465a:	78 68                	js     8046c4 <add_pgfault_handler+0x105>
+    return res;
+}
+  80465c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804660:	c9                   	leave
+  804661:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804662:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  804669:	00 00 00 
+  80466c:	ff d0                	call   *%rax
+  80466e:	89 c7                	mov    %eax,%edi
+  804670:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804675:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80467a:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804681:	00 00 00 
+  804684:	48 b8 73 12 80 00 00 	movabs $0x801273,%rax
+  80468b:	00 00 00 
+  80468e:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804690:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804697:	00 00 00 
+  80469a:	48 8b 02             	mov    (%rdx),%rax
+  80469d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8046a1:	48 89 0a             	mov    %rcx,(%rdx)
+  8046a4:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8046ab:	00 00 00 
+  8046ae:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8046b2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046b9:	00 00 00 
+  8046bc:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8046bf:	e9 70 ff ff ff       	jmp    804634 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8046c4:	89 c1                	mov    %eax,%ecx
+  8046c6:	48 ba 3e 51 80 00 00 	movabs $0x80513e,%rdx
+  8046cd:	00 00 00 
+  8046d0:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8046d5:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  8046dc:	00 00 00 
+  8046df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046e4:	49 b8 9f 02 80 00 00 	movabs $0x80029f,%r8
+  8046eb:	00 00 00 
+  8046ee:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046f6:	e9 61 ff ff ff       	jmp    80465c <add_pgfault_handler+0x9d>
+
+00000000008046fb <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8046fb:	55                   	push   %rbp
+  8046fc:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8046ff:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804706:	00 00 00 
+  804709:	80 38 00             	cmpb   $0x0,(%rax)
+  80470c:	74 33                	je     804741 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80470e:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804715:	00 00 00 
+  804718:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80471d:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804724:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804727:	48 85 c0             	test   %rax,%rax
+  80472a:	0f 84 85 00 00 00    	je     8047b5 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804730:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804734:	74 40                	je     804776 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804736:	48 83 c1 01          	add    $0x1,%rcx
+  80473a:	48 39 c1             	cmp    %rax,%rcx
+  80473d:	75 f1                	jne    804730 <remove_pgfault_handler+0x35>
+  80473f:	eb 74                	jmp    8047b5 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804741:	48 b9 56 51 80 00 00 	movabs $0x805156,%rcx
+  804748:	00 00 00 
+  80474b:	48 ba a7 50 80 00 00 	movabs $0x8050a7,%rdx
+  804752:	00 00 00 
+  804755:	be 43 00 00 00       	mov    $0x43,%esi
+  80475a:	48 bf 30 51 80 00 00 	movabs $0x805130,%rdi
+  804761:	00 00 00 
+  804764:	b8 00 00 00 00       	mov    $0x0,%eax
+  804769:	49 b8 9f 02 80 00 00 	movabs $0x80029f,%r8
+  804770:	00 00 00 
+  804773:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804776:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80477d:	00 
+  80477e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804782:	48 29 ca             	sub    %rcx,%rdx
+  804785:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80478c:	00 00 00 
+  80478f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804793:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804798:	48 89 ce             	mov    %rcx,%rsi
+  80479b:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  8047a2:	00 00 00 
+  8047a5:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8047a7:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8047ae:	00 00 00 
+  8047b1:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8047b5:	5d                   	pop    %rbp
+  8047b6:	c3                   	ret
+
+00000000008047b7 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8047b7:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8047ba:	48 b8 35 45 80 00 00 	movabs $0x804535,%rax
+  8047c1:	00 00 00 
+    call *%rax
+  8047c4:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8047c6:	41 5f                	pop    %r15
+	popq %r15
+  8047c8:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8047ca:	41 5f                	pop    %r15
+	popq %r14
+  8047cc:	41 5e                	pop    %r14
+	popq %r13
+  8047ce:	41 5d                	pop    %r13
+	popq %r12
+  8047d0:	41 5c                	pop    %r12
+	popq %r11
+  8047d2:	41 5b                	pop    %r11
+	popq %r10
+  8047d4:	41 5a                	pop    %r10
+	popq %r9
+  8047d6:	41 59                	pop    %r9
+	popq %r8
+  8047d8:	41 58                	pop    %r8
+	popq %rsi
+  8047da:	5e                   	pop    %rsi
+	popq %rdi
+  8047db:	5f                   	pop    %rdi
+	popq %rbp
+  8047dc:	5d                   	pop    %rbp
+	popq %rdx
+  8047dd:	5a                   	pop    %rdx
+	popq %rcx
+  8047de:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8047df:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8047e4:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8047e9:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8047ed:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8047f0:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8047f5:	5b                   	pop    %rbx
+	popq %rax
+  8047f6:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8047f7:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8047fb:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8047fc:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804801:	c3                   	ret
+
+0000000000804802 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804802:	55                   	push   %rbp
+  804803:	48 89 e5             	mov    %rsp,%rbp
+  804806:	41 55                	push   %r13
+  804808:	41 54                	push   %r12
+  80480a:	53                   	push   %rbx
+  80480b:	48 83 ec 08          	sub    $0x8,%rsp
+  80480f:	49 89 fd             	mov    %rdi,%r13
+  804812:	48 89 f7             	mov    %rsi,%rdi
+  804815:	48 89 d3             	mov    %rdx,%rbx
+  804818:	49 89 cc             	mov    %rcx,%r12
+  80481b:	4c 89 c2             	mov    %r8,%rdx
+  80481e:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804821:	48 85 f6             	test   %rsi,%rsi
+  804824:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80482b:	00 00 00 
+  80482e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804832:	be 00 10 00 00       	mov    $0x1000,%esi
+  804837:	48 85 db             	test   %rbx,%rbx
+  80483a:	74 03                	je     80483f <ipc_recv_futex+0x3d>
+  80483c:	48 8b 33             	mov    (%rbx),%rsi
+  80483f:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804843:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  80484a:	00 00 00 
+  80484d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80484f:	85 c0                	test   %eax,%eax
+  804851:	78 75                	js     8048c8 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804853:	4d 85 ed             	test   %r13,%r13
+  804856:	74 14                	je     80486c <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804858:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  80485f:	00 00 00 
+  804862:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804868:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80486c:	4d 85 e4             	test   %r12,%r12
+  80486f:	74 14                	je     804885 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804871:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  804878:	00 00 00 
+  80487b:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804881:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804885:	48 85 db             	test   %rbx,%rbx
+  804888:	74 23                	je     8048ad <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80488a:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  804891:	00 00 00 
+  804894:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80489a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80489f:	85 c9                	test   %ecx,%ecx
+  8048a1:	74 07                	je     8048aa <ipc_recv_futex+0xa8>
+  8048a3:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8048aa:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8048ad:	48 a1 00 20 81 00 00 	movabs 0x812000,%rax
+  8048b4:	00 00 00 
+  8048b7:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8048bd:	48 83 c4 08          	add    $0x8,%rsp
+  8048c1:	5b                   	pop    %rbx
+  8048c2:	41 5c                	pop    %r12
+  8048c4:	41 5d                	pop    %r13
+  8048c6:	5d                   	pop    %rbp
+  8048c7:	c3                   	ret
+        if (from_env_store != NULL) {
+  8048c8:	4d 85 ed             	test   %r13,%r13
+  8048cb:	74 08                	je     8048d5 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8048cd:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8048d4:	00 
+        if (perm_store != NULL) {
+  8048d5:	4d 85 e4             	test   %r12,%r12
+  8048d8:	74 08                	je     8048e2 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8048da:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8048e1:	00 
+        if (size != NULL) {
+  8048e2:	48 85 db             	test   %rbx,%rbx
+  8048e5:	74 d6                	je     8048bd <ipc_recv_futex+0xbb>
+            *size = 0;
+  8048e7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8048ee:	eb cd                	jmp    8048bd <ipc_recv_futex+0xbb>
+
+00000000008048f0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8048f0:	55                   	push   %rbp
+  8048f1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8048f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8048f8:	6a 00                	push   $0x0
+  8048fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804900:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804906:	48 b8 02 48 80 00 00 	movabs $0x804802,%rax
+  80490d:	00 00 00 
+  804910:	ff d0                	call   *%rax
+}
+  804912:	c9                   	leave
+  804913:	c3                   	ret
+
+0000000000804914 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804914:	55                   	push   %rbp
+  804915:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804918:	48 85 d2             	test   %rdx,%rdx
+  80491b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804922:	00 00 00 
+  804925:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804929:	89 f6                	mov    %esi,%esi
+  80492b:	48 b8 a6 14 80 00 00 	movabs $0x8014a6,%rax
+  804932:	00 00 00 
+  804935:	ff d0                	call   *%rax
+    if (res < 0) {
+  804937:	85 c0                	test   %eax,%eax
+  804939:	78 02                	js     80493d <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80493b:	5d                   	pop    %rbp
+  80493c:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80493d:	89 c1                	mov    %eax,%ecx
+  80493f:	48 ba 70 51 80 00 00 	movabs $0x805170,%rdx
+  804946:	00 00 00 
+  804949:	be 50 00 00 00       	mov    $0x50,%esi
+  80494e:	48 bf 84 51 80 00 00 	movabs $0x805184,%rdi
+  804955:	00 00 00 
+  804958:	b8 00 00 00 00       	mov    $0x0,%eax
+  80495d:	49 b8 9f 02 80 00 00 	movabs $0x80029f,%r8
+  804964:	00 00 00 
+  804967:	41 ff d0             	call   *%r8
+
+000000000080496a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80496a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80496f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804976:	00 00 00 
+  804979:	48 89 d0             	mov    %rdx,%rax
+  80497c:	48 c1 e0 04          	shl    $0x4,%rax
+  804980:	48 29 d0             	sub    %rdx,%rax
+  804983:	48 c1 e0 05          	shl    $0x5,%rax
+  804987:	48 01 c8             	add    %rcx,%rax
+  80498a:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804990:	39 f8                	cmp    %edi,%eax
+  804992:	74 13                	je     8049a7 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804994:	48 83 c2 01          	add    $0x1,%rdx
+  804998:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80499f:	75 d8                	jne    804979 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8049a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8049a6:	c3                   	ret
+            return envs[i].env_id;
+  8049a7:	48 89 d0             	mov    %rdx,%rax
+  8049aa:	48 c1 e0 04          	shl    $0x4,%rax
+  8049ae:	48 29 d0             	sub    %rdx,%rax
+  8049b1:	48 c1 e0 05          	shl    $0x5,%rax
+  8049b5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8049bc:	00 00 00 
+  8049bf:	48 01 d0             	add    %rdx,%rax
+  8049c2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8049c8:	c3                   	ret
+  8049c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008049d0 <__rodata_start>:
+  8049d0:	77 72                	ja     804a44 <__rodata_start+0x74>
+  8049d2:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  8049d9:	6f 
+  8049da:	72 20                	jb     8049fc <__rodata_start+0x2c>
+  8049dc:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  8049df:	79 69                	jns    804a4a <__rodata_start+0x7a>
+  8049e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e2:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a0845c <__bss_end+0x251c645c>
+  8049e9:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  8049ef:	2f                   	(bad)
+  8049f0:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8049f3:	2e 63 00             	cs movsxd (%rax),%eax
+  8049f6:	65 72 72             	gs jb  804a6b <__rodata_start+0x9b>
+  8049f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049fa:	72 20                	jb     804a1c <__rodata_start+0x4c>
+  8049fc:	72 65                	jb     804a63 <__rodata_start+0x93>
+  8049fe:	61                   	(bad)
+  8049ff:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  804a06:	3a 
+  804a07:	20 25 69 00 63 61    	and    %ah,0x61630069(%rip)        # 61e34a76 <__bss_end+0x615f2a76>
+  804a0d:	74 00                	je     804a0f <__rodata_start+0x3f>
+  804a0f:	3c 73                	cmp    $0x73,%al
+  804a11:	74 64                	je     804a77 <__rodata_start+0xa7>
+  804a13:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  804a1a:	27                   	(bad)
+  804a1b:	74 20                	je     804a3d <__rodata_start+0x6d>
+  804a1d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a1e:	70 65                	jo     804a85 <__rodata_start+0xb5>
+  804a20:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a21:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0849a <__bss_end+0x251c649a>
+  804a27:	69 0a 00 3c 75 6e    	imul   $0x6e753c00,(%rdx),%ecx
+  804a2d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804a31:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a32:	3e 00 0f             	ds add %cl,(%rdi)
+  804a35:	1f                   	(bad)
+  804a36:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  804a3a:	30 38                	xor    %bh,(%rax)
+  804a3c:	78 5d                	js     804a9b <__rodata_start+0xcb>
+  804a3e:	20 75 73             	and    %dh,0x73(%rbp)
+  804a41:	65 72 20             	gs jb  804a64 <__rodata_start+0x94>
+  804a44:	70 61                	jo     804aa7 <__rodata_start+0xd7>
+  804a46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a47:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804a4e:	73 20                	jae    804a70 <__rodata_start+0xa0>
+  804a50:	61                   	(bad)
+  804a51:	74 20                	je     804a73 <__rodata_start+0xa3>
+  804a53:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804a58:	3a 20                	cmp    (%rax),%ah
+  804a5a:	00 30                	add    %dh,(%rax)
+  804a5c:	31 32                	xor    %esi,(%rdx)
+  804a5e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a65:	41                   	rex.B
+  804a66:	42                   	rex.X
+  804a67:	43                   	rex.XB
+  804a68:	44                   	rex.R
+  804a69:	45                   	rex.RB
+  804a6a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a6d:	31 32                	xor    %esi,(%rdx)
+  804a6f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a76:	61                   	(bad)
+  804a77:	62 63 64 65 66       	(bad)
+  804a7c:	00 28                	add    %ch,(%rax)
+  804a7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a7f:	75 6c                	jne    804aed <__rodata_start+0x11d>
+  804a81:	6c                   	insb   (%dx),%es:(%rdi)
+  804a82:	29 00                	sub    %eax,(%rax)
+  804a84:	65 72 72             	gs jb  804af9 <__rodata_start+0x129>
+  804a87:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a88:	72 20                	jb     804aaa <__rodata_start+0xda>
+  804a8a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804a8f:	73 70                	jae    804b01 <__rodata_start+0x131>
+  804a91:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804a95:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804a9c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a9d:	72 00                	jb     804a9f <__rodata_start+0xcf>
+  804a9f:	62 61 64 20 65       	(bad)
+  804aa4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aa5:	76 69                	jbe    804b10 <__rodata_start+0x140>
+  804aa7:	72 6f                	jb     804b18 <__rodata_start+0x148>
+  804aa9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aaa:	6d                   	insl   (%dx),%es:(%rdi)
+  804aab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804aad:	74 00                	je     804aaf <__rodata_start+0xdf>
+  804aaf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ab6:	20 70 61             	and    %dh,0x61(%rax)
+  804ab9:	72 61                	jb     804b1c <__rodata_start+0x14c>
+  804abb:	6d                   	insl   (%dx),%es:(%rdi)
+  804abc:	65 74 65             	gs je  804b24 <__rodata_start+0x154>
+  804abf:	72 00                	jb     804ac1 <__rodata_start+0xf1>
+  804ac1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ac2:	75 74                	jne    804b38 <__rodata_start+0x168>
+  804ac4:	20 6f 66             	and    %ch,0x66(%rdi)
+  804ac7:	20 6d 65             	and    %ch,0x65(%rbp)
+  804aca:	6d                   	insl   (%dx),%es:(%rdi)
+  804acb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804acc:	72 79                	jb     804b47 <__rodata_start+0x177>
+  804ace:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ad1:	74 20                	je     804af3 <__rodata_start+0x123>
+  804ad3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ad4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804ad8:	76 69                	jbe    804b43 <__rodata_start+0x173>
+  804ada:	72 6f                	jb     804b4b <__rodata_start+0x17b>
+  804adc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804add:	6d                   	insl   (%dx),%es:(%rdi)
+  804ade:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ae0:	74 73                	je     804b55 <__rodata_start+0x185>
+  804ae2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804ae5:	72 72                	jb     804b59 <__rodata_start+0x189>
+  804ae7:	75 70                	jne    804b59 <__rodata_start+0x189>
+  804ae9:	74 65                	je     804b50 <__rodata_start+0x180>
+  804aeb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804af0:	75 67                	jne    804b59 <__rodata_start+0x189>
+  804af2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804af5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804af7:	00 73 65             	add    %dh,0x65(%rbx)
+  804afa:	67 6d                	insl   (%dx),%es:(%edi)
+  804afc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804afe:	74 61                	je     804b61 <__rodata_start+0x191>
+  804b00:	74 69                	je     804b6b <__rodata_start+0x19b>
+  804b02:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b03:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b04:	20 66 61             	and    %ah,0x61(%rsi)
+  804b07:	75 6c                	jne    804b75 <__rodata_start+0x1a5>
+  804b09:	74 00                	je     804b0b <__rodata_start+0x13b>
+  804b0b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b12:	20 45 4c             	and    %al,0x4c(%rbp)
+  804b15:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804b19:	61                   	(bad)
+  804b1a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804b1f:	20 73 75             	and    %dh,0x75(%rbx)
+  804b22:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804b25:	73 79                	jae    804ba0 <__rodata_start+0x1d0>
+  804b27:	73 74                	jae    804b9d <__rodata_start+0x1cd>
+  804b29:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b2b:	20 63 61             	and    %ah,0x61(%rbx)
+  804b2e:	6c                   	insb   (%dx),%es:(%rdi)
+  804b2f:	6c                   	insb   (%dx),%es:(%rdi)
+  804b30:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804b33:	74 72                	je     804ba7 <__rodata_start+0x1d7>
+  804b35:	79 20                	jns    804b57 <__rodata_start+0x187>
+  804b37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b39:	74 20                	je     804b5b <__rodata_start+0x18b>
+  804b3b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b3d:	75 6e                	jne    804bad <__rodata_start+0x1dd>
+  804b3f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804b43:	76 20                	jbe    804b65 <__rodata_start+0x195>
+  804b45:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b4c:	72 65                	jb     804bb3 <__rodata_start+0x1e3>
+  804b4e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b52:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b56:	65 78 70             	gs js  804bc9 <__rodata_start+0x1f9>
+  804b59:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b5e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b61:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b65:	20 66 69             	and    %ah,0x69(%rsi)
+  804b68:	6c                   	insb   (%dx),%es:(%rdi)
+  804b69:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b6d:	20 66 72             	and    %ah,0x72(%rsi)
+  804b70:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b75:	61                   	(bad)
+  804b76:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b79:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b7a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b7b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b7f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b83:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b84:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b87:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b88:	79 20                	jns    804baa <__rodata_start+0x1da>
+  804b8a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804b91:	72 65                	jb     804bf8 <__rodata_start+0x228>
+  804b93:	20 6f 70             	and    %ch,0x70(%rdi)
+  804b96:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b98:	00 66 69             	add    %ah,0x69(%rsi)
+  804b9b:	6c                   	insb   (%dx),%es:(%rdi)
+  804b9c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804ba0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804ba3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804ba7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ba8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba9:	74 20                	je     804bcb <__rodata_start+0x1fb>
+  804bab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804bad:	75 6e                	jne    804c1d <__rodata_start+0x24d>
+  804baf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804bb3:	76 61                	jbe    804c16 <__rodata_start+0x246>
+  804bb5:	6c                   	insb   (%dx),%es:(%rdi)
+  804bb6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804bbd:	00 
+  804bbe:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804bc5:	72 65                	jb     804c2c <__rodata_start+0x25c>
+  804bc7:	61                   	(bad)
+  804bc8:	64 79 20             	fs jns 804beb <__rodata_start+0x21b>
+  804bcb:	65 78 69             	gs js  804c37 <__rodata_start+0x267>
+  804bce:	73 74                	jae    804c44 <__rodata_start+0x274>
+  804bd0:	73 00                	jae    804bd2 <__rodata_start+0x202>
+  804bd2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bd3:	70 65                	jo     804c3a <__rodata_start+0x26a>
+  804bd5:	72 61                	jb     804c38 <__rodata_start+0x268>
+  804bd7:	74 69                	je     804c42 <__rodata_start+0x272>
+  804bd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bdb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804bde:	74 20                	je     804c00 <__rodata_start+0x230>
+  804be0:	73 75                	jae    804c57 <__rodata_start+0x287>
+  804be2:	70 70                	jo     804c54 <__rodata_start+0x284>
+  804be4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be5:	72 74                	jb     804c5b <__rodata_start+0x28b>
+  804be7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804bed:	20 61 67             	and    %ah,0x67(%rcx)
+  804bf0:	61                   	(bad)
+  804bf1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804bf8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804bfc:	74 00                	je     804bfe <__rodata_start+0x22e>
+  804bfe:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804c05:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c08:	20 75 73             	and    %dh,0x73(%rbp)
+  804c0b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804c0f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804c16:	00 
+  804c17:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804c1e:	00 00 
+  804c20:	dc 05 80 00 00 00    	faddl  0x80(%rip)        # 804ca6 <__rodata_start+0x2d6>
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	1d 0c 80 00 00       	sbb    $0x800c,%eax
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 0d 0c 80 00 00    	add    %cl,0x800c(%rip)        # 80cc41 <__ctors_end+0x6b61>
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cc49 <__ctors_end+0x6b69>
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cc51 <__ctors_end+0x6b71>
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cc59 <__ctors_end+0x6b79>
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cc61 <__ctors_end+0x6b81>
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 fb                	add    %bh,%bl
+  804c59:	05 80 00 00 00       	add    $0x80,%eax
+  804c5e:	00 00                	add    %al,(%rax)
+  804c60:	1d 0c 80 00 00       	sbb    $0x800c,%eax
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cc79 <__ctors_end+0x6b99>
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 ef                	add    %ch,%bh
+  804c71:	05 80 00 00 00       	add    $0x80,%eax
+  804c76:	00 00                	add    %al,(%rax)
+  804c78:	69 06 80 00 00 00    	imul   $0x80,(%rsi),%eax
+  804c7e:	00 00                	add    %al,(%rax)
+  804c80:	1d 0c 80 00 00       	sbb    $0x800c,%eax
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 ef                	add    %ch,%bh
+  804c89:	05 80 00 00 00       	add    $0x80,%eax
+  804c8e:	00 00                	add    %al,(%rax)
+  804c90:	35 06 80 00 00       	xor    $0x8006,%eax
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80cca3 <__ctors_end+0x6bc3>
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccab <__ctors_end+0x6bcb>
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccb3 <__ctors_end+0x6bd3>
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccbb <__ctors_end+0x6bdb>
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccc3 <__ctors_end+0x6be3>
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80cccb <__ctors_end+0x6beb>
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccd3 <__ctors_end+0x6bf3>
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 35 06 80 00 00    	add    %dh,0x8006(%rip)        # 80ccdb <__ctors_end+0x6bfb>
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cce9 <__ctors_end+0x6c09>
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ccf1 <__ctors_end+0x6c11>
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ccf9 <__ctors_end+0x6c19>
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd01 <__ctors_end+0x6c21>
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd09 <__ctors_end+0x6c29>
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd11 <__ctors_end+0x6c31>
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd19 <__ctors_end+0x6c39>
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd21 <__ctors_end+0x6c41>
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd29 <__ctors_end+0x6c49>
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd31 <__ctors_end+0x6c51>
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd39 <__ctors_end+0x6c59>
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd41 <__ctors_end+0x6c61>
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd49 <__ctors_end+0x6c69>
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd51 <__ctors_end+0x6c71>
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd59 <__ctors_end+0x6c79>
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd61 <__ctors_end+0x6c81>
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd69 <__ctors_end+0x6c89>
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd71 <__ctors_end+0x6c91>
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd79 <__ctors_end+0x6c99>
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd81 <__ctors_end+0x6ca1>
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd89 <__ctors_end+0x6ca9>
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd91 <__ctors_end+0x6cb1>
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cd99 <__ctors_end+0x6cb9>
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cda1 <__ctors_end+0x6cc1>
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cda9 <__ctors_end+0x6cc9>
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdb1 <__ctors_end+0x6cd1>
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdb9 <__ctors_end+0x6cd9>
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdc1 <__ctors_end+0x6ce1>
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdc9 <__ctors_end+0x6ce9>
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdd1 <__ctors_end+0x6cf1>
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 40 0b             	add    %al,0xb(%rax)
+  804dca:	80 00 00             	addb   $0x0,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cde1 <__ctors_end+0x6d01>
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cde9 <__ctors_end+0x6d09>
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdf1 <__ctors_end+0x6d11>
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cdf9 <__ctors_end+0x6d19>
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce01 <__ctors_end+0x6d21>
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce09 <__ctors_end+0x6d29>
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce11 <__ctors_end+0x6d31>
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce19 <__ctors_end+0x6d39>
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce21 <__ctors_end+0x6d41>
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce29 <__ctors_end+0x6d49>
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 8c 06 80 00 00 00 	add    %cl,0x80(%rsi,%rax,1)
+  804e26:	00 00                	add    %al,(%rax)
+  804e28:	5b                   	pop    %rbx
+  804e29:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804e2f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce41 <__ctors_end+0x6d61>
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce49 <__ctors_end+0x6d69>
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce51 <__ctors_end+0x6d71>
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce59 <__ctors_end+0x6d79>
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 bb 06 80 00 00    	add    %bh,0x8006(%rbx)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce69 <__ctors_end+0x6d89>
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce71 <__ctors_end+0x6d91>
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 81 06 80 00 00    	add    %al,0x8006(%rcx)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce81 <__ctors_end+0x6da1>
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ce89 <__ctors_end+0x6da9>
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 03                	add    %al,(%rbx)
+  804e81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804e87:	00 cd                	add    %cl,%ch
+  804e89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804e8f:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cea1 <__ctors_end+0x6dc1>
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cea9 <__ctors_end+0x6dc9>
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 52 07             	add    %dl,0x7(%rdx)
+  804ea2:	80 00 00             	addb   $0x0,(%rax)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ceb9 <__ctors_end+0x6dd9>
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 2f                	add    %ch,(%rdi)
+  804eb1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804eb7:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cec9 <__ctors_end+0x6de9>
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80ced1 <__ctors_end+0x6df1>
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 40 0b             	add    %al,0xb(%rax)
+  804eca:	80 00 00             	addb   $0x0,(%rax)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 1d 0c 80 00 00    	add    %bl,0x800c(%rip)        # 80cee1 <__ctors_end+0x6e01>
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 e5                	add    %ah,%ch
+  804ed9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804ee0 <error_string>:
+	...
+  804ee8:	8d 4a 80 00 00 00 00 00 9f 4a 80 00 00 00 00 00     .J.......J......
+  804ef8:	af 4a 80 00 00 00 00 00 c1 4a 80 00 00 00 00 00     .J.......J......
+  804f08:	cf 4a 80 00 00 00 00 00 e3 4a 80 00 00 00 00 00     .J.......J......
+  804f18:	f8 4a 80 00 00 00 00 00 0b 4b 80 00 00 00 00 00     .J.......K......
+  804f28:	1d 4b 80 00 00 00 00 00 31 4b 80 00 00 00 00 00     .K......1K......
+  804f38:	41 4b 80 00 00 00 00 00 54 4b 80 00 00 00 00 00     AK......TK......
+  804f48:	6b 4b 80 00 00 00 00 00 81 4b 80 00 00 00 00 00     kK.......K......
+  804f58:	99 4b 80 00 00 00 00 00 b1 4b 80 00 00 00 00 00     .K.......K......
+  804f68:	be 4b 80 00 00 00 00 00 98 4f 80 00 00 00 00 00     .K.......O......
+  804f78:	d2 4b 80 00 00 00 00 00 ea 4b 80 00 00 00 00 00     .K.......K......
+  804f88:	f4 4b 80 00 00 00 00 00 fe 4b 80 00 00 00 00 00     .K.......K......
+  804f98:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804fa8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804fb8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804fc8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804fd8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804fe8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804ff8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805008:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805018:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805028:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805038:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805048:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805058:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805068:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805078:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805080 <devtab>:
+  805080:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805090:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8050a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8050b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8050c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8050d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8050e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8050f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805100:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805110:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805120:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805130:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805140:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805150:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805160:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805170:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805180:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805190:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,10116 @@
+
+obj/user/catbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 80 05 00 00       	call   8005a3 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench_read>:
+
+static char buf[8192];
+static char rbuf[FSMAP_MAX_SIZE + PAGE_SIZE] __attribute__((aligned(PAGE_SIZE)));
+
+static void
+bench_read(const char *name, char *dst, size_t n) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80003a:	49 89 f5             	mov    %rsi,%r13
+  80003d:	49 89 d6             	mov    %rdx,%r14
+    int fd, res;
+    size_t total = 0;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800040:	be 00 00 00 00       	mov    $0x0,%esi
+  800045:	48 bf 68 59 80 00 00 	movabs $0x805968,%rdi
+  80004c:	00 00 00 
+  80004f:	48 b8 f3 33 80 00 00 	movabs $0x8033f3,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+  80005b:	41 89 c4             	mov    %eax,%r12d
+  80005e:	85 c0                	test   %eax,%eax
+  800060:	78 20                	js     800082 <bench_read+0x5d>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800062:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800064:	48 c1 e2 20          	shl    $0x20,%rdx
+  800068:	89 c0                	mov    %eax,%eax
+  80006a:	48 09 c2             	or     %rax,%rdx
+  80006d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+    size_t total = 0;
+  800071:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+    uint64_t start = read_tsc();
+    while ((res = read(fd, dst, n)) > 0)
+  800076:	49 bf 11 1f 80 00 00 	movabs $0x801f11,%r15
+  80007d:	00 00 00 
+  800080:	eb 33                	jmp    8000b5 <bench_read+0x90>
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800082:	89 c1                	mov    %eax,%ecx
+  800084:	48 ba 71 59 80 00 00 	movabs $0x805971,%rdx
+  80008b:	00 00 00 
+  80008e:	be 13 00 00 00       	mov    $0x13,%esi
+  800093:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  80009a:	00 00 00 
+  80009d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a2:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  8000a9:	00 00 00 
+  8000ac:	41 ff d0             	call   *%r8
+        total += res;
+  8000af:	48 63 c9             	movslq %ecx,%rcx
+  8000b2:	48 01 cb             	add    %rcx,%rbx
+    while ((res = read(fd, dst, n)) > 0)
+  8000b5:	4c 89 f2             	mov    %r14,%rdx
+  8000b8:	4c 89 ee             	mov    %r13,%rsi
+  8000bb:	44 89 e7             	mov    %r12d,%edi
+  8000be:	41 ff d7             	call   *%r15
+  8000c1:	48 89 c1             	mov    %rax,%rcx
+  8000c4:	85 c0                	test   %eax,%eax
+  8000c6:	7f e7                	jg     8000af <bench_read+0x8a>
+    asm volatile("rdtsc"
+  8000c8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ca:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ce:	89 c0                	mov    %eax,%eax
+  8000d0:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8000d3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000d7:	48 29 c2             	sub    %rax,%rdx
+  8000da:	49 89 d5             	mov    %rdx,%r13
+
+    if (res < 0) panic("read /bigfile: %i", res);
+  8000dd:	85 c9                	test   %ecx,%ecx
+  8000df:	0f 88 d5 00 00 00    	js     8001ba <bench_read+0x195>
+    close(fd);
+  8000e5:	44 89 e7             	mov    %r12d,%edi
+  8000e8:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+  8000f4:	a1 44 f0 bf 1f 80 00 	movabs 0x801fbff044,%eax
+  8000fb:	00 00 
+  8000fd:	48 63 f0             	movslq %eax,%rsi
+    cprintf("catbench: %s reads: %lu MB/s, %lu.%02lu cycles per byte\n", name,
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+            (unsigned long)(cycles / total), (unsigned long)(cycles * 100 / total % 100));
+  800100:	4b 8d 44 ad 00       	lea    0x0(%r13,%r13,4),%rax
+  800105:	48 8d 0c 80          	lea    (%rax,%rax,4),%rcx
+  800109:	48 c1 e1 02          	shl    $0x2,%rcx
+  80010d:	48 89 c8             	mov    %rcx,%rax
+  800110:	ba 00 00 00 00       	mov    $0x0,%edx
+  800115:	48 f7 f3             	div    %rbx
+  800118:	48 89 c1             	mov    %rax,%rcx
+    cprintf("catbench: %s reads: %lu MB/s, %lu.%02lu cycles per byte\n", name,
+  80011b:	48 89 c2             	mov    %rax,%rdx
+  80011e:	48 c1 ea 02          	shr    $0x2,%rdx
+  800122:	48 bf c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdi
+  800129:	c2 f5 28 
+  80012c:	48 89 d0             	mov    %rdx,%rax
+  80012f:	48 f7 e7             	mul    %rdi
+  800132:	49 89 d0             	mov    %rdx,%r8
+  800135:	49 c1 e8 02          	shr    $0x2,%r8
+  800139:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  80013d:	4c 01 c2             	add    %r8,%rdx
+  800140:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  800144:	48 c1 e0 02          	shl    $0x2,%rax
+  800148:	48 29 c1             	sub    %rax,%rcx
+  80014b:	49 89 c8             	mov    %rcx,%r8
+  80014e:	4c 89 e8             	mov    %r13,%rax
+  800151:	ba 00 00 00 00       	mov    $0x0,%edx
+  800156:	48 f7 f3             	div    %rbx
+  800159:	48 89 c1             	mov    %rax,%rcx
+  80015c:	48 85 f6             	test   %rsi,%rsi
+  80015f:	74 27                	je     800188 <bench_read+0x163>
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+  800161:	48 89 d8             	mov    %rbx,%rax
+  800164:	48 0f af c6          	imul   %rsi,%rax
+  800168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80016d:	49 f7 f5             	div    %r13
+    cprintf("catbench: %s reads: %lu MB/s, %lu.%02lu cycles per byte\n", name,
+  800170:	48 c1 e8 03          	shr    $0x3,%rax
+  800174:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  80017b:	9b c4 20 
+  80017e:	48 f7 e2             	mul    %rdx
+  800181:	48 89 d6             	mov    %rdx,%rsi
+  800184:	48 c1 ee 04          	shr    $0x4,%rsi
+  800188:	48 89 f2             	mov    %rsi,%rdx
+  80018b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80018f:	48 bf f0 59 80 00 00 	movabs $0x8059f0,%rdi
+  800196:	00 00 00 
+  800199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019e:	49 b9 c9 07 80 00 00 	movabs $0x8007c9,%r9
+  8001a5:	00 00 00 
+  8001a8:	41 ff d1             	call   *%r9
+}
+  8001ab:	48 83 c4 18          	add    $0x18,%rsp
+  8001af:	5b                   	pop    %rbx
+  8001b0:	41 5c                	pop    %r12
+  8001b2:	41 5d                	pop    %r13
+  8001b4:	41 5e                	pop    %r14
+  8001b6:	41 5f                	pop    %r15
+  8001b8:	5d                   	pop    %rbp
+  8001b9:	c3                   	ret
+    if (res < 0) panic("read /bigfile: %i", res);
+  8001ba:	48 ba 93 59 80 00 00 	movabs $0x805993,%rdx
+  8001c1:	00 00 00 
+  8001c4:	be 1a 00 00 00       	mov    $0x1a,%esi
+  8001c9:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  8001d0:	00 00 00 
+  8001d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d8:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  8001df:	00 00 00 
+  8001e2:	41 ff d0             	call   *%r8
+
+00000000008001e5 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8001e5:	55                   	push   %rbp
+  8001e6:	48 89 e5             	mov    %rsp,%rbp
+  8001e9:	41 57                	push   %r15
+  8001eb:	41 56                	push   %r14
+  8001ed:	41 55                	push   %r13
+  8001ef:	41 54                	push   %r12
+  8001f1:	53                   	push   %rbx
+  8001f2:	48 83 ec 58          	sub    $0x58,%rsp
+    int p[2], res;
+    struct DiskStat st0, st1;
+
+    if ((res = pipe(p)) < 0) panic("pipe: %i", res);
+  8001f6:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  8001fa:	48 b8 16 49 80 00 00 	movabs $0x804916,%rax
+  800201:	00 00 00 
+  800204:	ff d0                	call   *%rax
+  800206:	85 c0                	test   %eax,%eax
+  800208:	0f 88 02 01 00 00    	js     800310 <umain+0x12b>
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80020e:	48 8d 7d a8          	lea    -0x58(%rbp),%rdi
+  800212:	48 b8 f0 36 80 00 00 	movabs $0x8036f0,%rax
+  800219:	00 00 00 
+  80021c:	ff d0                	call   *%rax
+  80021e:	85 c0                	test   %eax,%eax
+  800220:	0f 88 17 01 00 00    	js     80033d <umain+0x158>
+    asm volatile("rdtsc"
+  800226:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800228:	48 c1 e2 20          	shl    $0x20,%rdx
+  80022c:	89 c0                	mov    %eax,%eax
+  80022e:	48 09 c2             	or     %rax,%rdx
+  800231:	49 89 d7             	mov    %rdx,%r15
+
+    uint64_t start = read_tsc();
+
+    envid_t child = fork();
+  800234:	48 b8 80 1a 80 00 00 	movabs $0x801a80,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	41 89 c6             	mov    %eax,%r14d
+    if (child < 0) panic("fork: %i", child);
+  800243:	85 c0                	test   %eax,%eax
+  800245:	0f 88 1f 01 00 00    	js     80036a <umain+0x185>
+    if (!child) {
+  80024b:	0f 85 92 00 00 00    	jne    8002e3 <umain+0xfe>
+        dup(p[1], 1);
+  800251:	be 01 00 00 00       	mov    $0x1,%esi
+  800256:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800259:	48 b8 ee 1d 80 00 00 	movabs $0x801dee,%rax
+  800260:	00 00 00 
+  800263:	ff d0                	call   *%rax
+        close(p[0]);
+  800265:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  800268:	48 bb 93 1d 80 00 00 	movabs $0x801d93,%rbx
+  80026f:	00 00 00 
+  800272:	ff d3                	call   *%rbx
+        close(p[1]);
+  800274:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800277:	ff d3                	call   *%rbx
+        envid_t cat = spawnl("/cat", "cat", "/bigfile", (char *)0);
+  800279:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80027e:	48 ba 68 59 80 00 00 	movabs $0x805968,%rdx
+  800285:	00 00 00 
+  800288:	48 be c6 59 80 00 00 	movabs $0x8059c6,%rsi
+  80028f:	00 00 00 
+  800292:	48 bf c5 59 80 00 00 	movabs $0x8059c5,%rdi
+  800299:	00 00 00 
+  80029c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a1:	49 b8 4a 44 80 00 00 	movabs $0x80444a,%r8
+  8002a8:	00 00 00 
+  8002ab:	41 ff d0             	call   *%r8
+  8002ae:	89 c3                	mov    %eax,%ebx
+        if (cat < 0) panic("spawn cat: %i", cat);
+  8002b0:	85 c0                	test   %eax,%eax
+  8002b2:	0f 88 df 00 00 00    	js     800397 <umain+0x1b2>
+        close(1);
+  8002b8:	bf 01 00 00 00       	mov    $0x1,%edi
+  8002bd:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8002c4:	00 00 00 
+  8002c7:	ff d0                	call   *%rax
+        wait(cat);
+  8002c9:	89 df                	mov    %ebx,%edi
+  8002cb:	48 b8 63 4b 80 00 00 	movabs $0x804b63,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+        exit();
+  8002d7:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  8002de:	00 00 00 
+  8002e1:	ff d0                	call   *%rax
+    }
+
+    close(p[1]);
+  8002e3:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8002e6:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8002ed:	00 00 00 
+  8002f0:	ff d0                	call   *%rax
+    size_t total = 0;
+  8002f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+    while ((res = read(p[0], buf, sizeof(buf))) > 0)
+  8002f7:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  8002fe:	00 00 00 
+  800301:	49 bc 11 1f 80 00 00 	movabs $0x801f11,%r12
+  800308:	00 00 00 
+  80030b:	e9 b9 00 00 00       	jmp    8003c9 <umain+0x1e4>
+    if ((res = pipe(p)) < 0) panic("pipe: %i", res);
+  800310:	89 c1                	mov    %eax,%ecx
+  800312:	48 ba a5 59 80 00 00 	movabs $0x8059a5,%rdx
+  800319:	00 00 00 
+  80031c:	be 28 00 00 00       	mov    $0x28,%esi
+  800321:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  800328:	00 00 00 
+  80032b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800330:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  800337:	00 00 00 
+  80033a:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80033d:	89 c1                	mov    %eax,%ecx
+  80033f:	48 ba ae 59 80 00 00 	movabs $0x8059ae,%rdx
+  800346:	00 00 00 
+  800349:	be 29 00 00 00       	mov    $0x29,%esi
+  80034e:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  800355:	00 00 00 
+  800358:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035d:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  800364:	00 00 00 
+  800367:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  80036a:	89 c1                	mov    %eax,%ecx
+  80036c:	48 ba bc 59 80 00 00 	movabs $0x8059bc,%rdx
+  800373:	00 00 00 
+  800376:	be 2e 00 00 00       	mov    $0x2e,%esi
+  80037b:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  800382:	00 00 00 
+  800385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038a:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  800391:	00 00 00 
+  800394:	41 ff d0             	call   *%r8
+        if (cat < 0) panic("spawn cat: %i", cat);
+  800397:	89 c1                	mov    %eax,%ecx
+  800399:	48 ba ca 59 80 00 00 	movabs $0x8059ca,%rdx
+  8003a0:	00 00 00 
+  8003a3:	be 34 00 00 00       	mov    $0x34,%esi
+  8003a8:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  8003af:	00 00 00 
+  8003b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b7:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  8003be:	00 00 00 
+  8003c1:	41 ff d0             	call   *%r8
+        total += res;
+  8003c4:	48 98                	cltq
+  8003c6:	48 01 c3             	add    %rax,%rbx
+    while ((res = read(p[0], buf, sizeof(buf))) > 0)
+  8003c9:	ba 00 20 00 00       	mov    $0x2000,%edx
+  8003ce:	4c 89 ee             	mov    %r13,%rsi
+  8003d1:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8003d4:	41 ff d4             	call   *%r12
+  8003d7:	89 c1                	mov    %eax,%ecx
+  8003d9:	85 c0                	test   %eax,%eax
+  8003db:	7f e7                	jg     8003c4 <umain+0x1df>
+    if (res < 0) panic("read: %i", res);
+  8003dd:	0f 88 68 01 00 00    	js     80054b <umain+0x366>
+    close(p[0]);
+  8003e3:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8003e6:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8003ed:	00 00 00 
+  8003f0:	ff d0                	call   *%rax
+    wait(child);
+  8003f2:	44 89 f7             	mov    %r14d,%edi
+  8003f5:	48 b8 63 4b 80 00 00 	movabs $0x804b63,%rax
+  8003fc:	00 00 00 
+  8003ff:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800401:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800403:	48 c1 e2 20          	shl    $0x20,%rdx
+  800407:	89 c0                	mov    %eax,%eax
+  800409:	48 09 c2             	or     %rax,%rdx
+
+    uint64_t cycles = read_tsc() - start;
+  80040c:	4c 29 fa             	sub    %r15,%rdx
+  80040f:	49 89 d4             	mov    %rdx,%r12
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  800412:	48 8d 7d 88          	lea    -0x78(%rbp),%rdi
+  800416:	48 b8 f0 36 80 00 00 	movabs $0x8036f0,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+  800422:	85 c0                	test   %eax,%eax
+  800424:	0f 88 4c 01 00 00    	js     800576 <umain+0x391>
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+  80042a:	a1 44 f0 bf 1f 80 00 	movabs 0x801fbff044,%eax
+  800431:	00 00 
+  800433:	48 63 d0             	movslq %eax,%rdx
+    cprintf("catbench: %lu KB, %lu MB/s, %lu read commands for %lu blocks\n",
+            (unsigned long)(total / 1024),
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+            (unsigned long)(st1.ds_read_blocks - st0.ds_read_blocks));
+  800436:	4c 8b 45 90          	mov    -0x70(%rbp),%r8
+  80043a:	4c 2b 45 b0          	sub    -0x50(%rbp),%r8
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+  80043e:	48 8b 4d 88          	mov    -0x78(%rbp),%rcx
+  800442:	48 2b 4d a8          	sub    -0x58(%rbp),%rcx
+    cprintf("catbench: %lu KB, %lu MB/s, %lu read commands for %lu blocks\n",
+  800446:	48 85 d2             	test   %rdx,%rdx
+  800449:	74 24                	je     80046f <umain+0x28a>
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+  80044b:	48 89 d0             	mov    %rdx,%rax
+  80044e:	48 0f af c3          	imul   %rbx,%rax
+  800452:	ba 00 00 00 00       	mov    $0x0,%edx
+  800457:	49 f7 f4             	div    %r12
+    cprintf("catbench: %lu KB, %lu MB/s, %lu read commands for %lu blocks\n",
+  80045a:	48 c1 e8 03          	shr    $0x3,%rax
+  80045e:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800465:	9b c4 20 
+  800468:	48 f7 e2             	mul    %rdx
+  80046b:	48 c1 ea 04          	shr    $0x4,%rdx
+            (unsigned long)(total / 1024),
+  80046f:	48 89 de             	mov    %rbx,%rsi
+  800472:	48 c1 ee 0a          	shr    $0xa,%rsi
+    cprintf("catbench: %lu KB, %lu MB/s, %lu read commands for %lu blocks\n",
+  800476:	48 bf 30 5a 80 00 00 	movabs $0x805a30,%rdi
+  80047d:	00 00 00 
+  800480:	b8 00 00 00 00       	mov    $0x0,%eax
+  800485:	49 bd c9 07 80 00 00 	movabs $0x8007c9,%r13
+  80048c:	00 00 00 
+  80048f:	41 ff d5             	call   *%r13
+    cprintf("catbench: %lu.%02lu cycles per byte\n",
+            (unsigned long)(cycles / total), (unsigned long)(cycles * 100 / total % 100));
+  800492:	4b 8d 04 a4          	lea    (%r12,%r12,4),%rax
+  800496:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  80049a:	48 c1 e0 02          	shl    $0x2,%rax
+  80049e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a3:	48 f7 f3             	div    %rbx
+  8004a6:	48 89 c1             	mov    %rax,%rcx
+    cprintf("catbench: %lu.%02lu cycles per byte\n",
+  8004a9:	48 89 c2             	mov    %rax,%rdx
+  8004ac:	48 c1 ea 02          	shr    $0x2,%rdx
+  8004b0:	48 be c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rsi
+  8004b7:	c2 f5 28 
+  8004ba:	48 89 d0             	mov    %rdx,%rax
+  8004bd:	48 f7 e6             	mul    %rsi
+  8004c0:	48 89 d0             	mov    %rdx,%rax
+  8004c3:	48 c1 e8 02          	shr    $0x2,%rax
+  8004c7:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  8004cb:	48 01 c2             	add    %rax,%rdx
+  8004ce:	48 8d 04 92          	lea    (%rdx,%rdx,4),%rax
+  8004d2:	48 c1 e0 02          	shl    $0x2,%rax
+  8004d6:	48 29 c1             	sub    %rax,%rcx
+  8004d9:	4c 89 e0             	mov    %r12,%rax
+  8004dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e1:	48 f7 f3             	div    %rbx
+  8004e4:	48 89 c6             	mov    %rax,%rsi
+  8004e7:	48 89 ca             	mov    %rcx,%rdx
+  8004ea:	48 bf 70 5a 80 00 00 	movabs $0x805a70,%rdi
+  8004f1:	00 00 00 
+  8004f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f9:	41 ff d5             	call   *%r13
+
+    bench_read("copied", rbuf + 64, FSMAP_MAX_SIZE);
+  8004fc:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800501:	48 be 40 00 81 00 00 	movabs $0x810040,%rsi
+  800508:	00 00 00 
+  80050b:	48 bf e1 59 80 00 00 	movabs $0x8059e1,%rdi
+  800512:	00 00 00 
+  800515:	48 bb 25 00 80 00 00 	movabs $0x800025,%rbx
+  80051c:	00 00 00 
+  80051f:	ff d3                	call   *%rbx
+    bench_read("mapped", rbuf, FSMAP_MAX_SIZE);
+  800521:	ba 00 00 04 00       	mov    $0x40000,%edx
+  800526:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  80052d:	00 00 00 
+  800530:	48 bf e8 59 80 00 00 	movabs $0x8059e8,%rdi
+  800537:	00 00 00 
+  80053a:	ff d3                	call   *%rbx
+}
+  80053c:	48 83 c4 58          	add    $0x58,%rsp
+  800540:	5b                   	pop    %rbx
+  800541:	41 5c                	pop    %r12
+  800543:	41 5d                	pop    %r13
+  800545:	41 5e                	pop    %r14
+  800547:	41 5f                	pop    %r15
+  800549:	5d                   	pop    %rbp
+  80054a:	c3                   	ret
+    if (res < 0) panic("read: %i", res);
+  80054b:	48 ba d8 59 80 00 00 	movabs $0x8059d8,%rdx
+  800552:	00 00 00 
+  800555:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80055a:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  800561:	00 00 00 
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  800570:	00 00 00 
+  800573:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  800576:	89 c1                	mov    %eax,%ecx
+  800578:	48 ba ae 59 80 00 00 	movabs $0x8059ae,%rdx
+  80057f:	00 00 00 
+  800582:	be 43 00 00 00       	mov    $0x43,%esi
+  800587:	48 bf 83 59 80 00 00 	movabs $0x805983,%rdi
+  80058e:	00 00 00 
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  80059d:	00 00 00 
+  8005a0:	41 ff d0             	call   *%r8
+
+00000000008005a3 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8005a3:	55                   	push   %rbp
+  8005a4:	48 89 e5             	mov    %rsp,%rbp
+  8005a7:	41 56                	push   %r14
+  8005a9:	41 55                	push   %r13
+  8005ab:	41 54                	push   %r12
+  8005ad:	53                   	push   %rbx
+  8005ae:	41 89 fd             	mov    %edi,%r13d
+  8005b1:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005b4:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  8005bb:	00 00 00 
+  8005be:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  8005c5:	00 00 00 
+  8005c8:	48 39 c2             	cmp    %rax,%rdx
+  8005cb:	73 17                	jae    8005e4 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8005cd:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8005d0:	49 89 c4             	mov    %rax,%r12
+  8005d3:	48 83 c3 08          	add    $0x8,%rbx
+  8005d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dc:	ff 53 f8             	call   *-0x8(%rbx)
+  8005df:	4c 39 e3             	cmp    %r12,%rbx
+  8005e2:	72 ef                	jb     8005d3 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8005e4:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  8005eb:	00 00 00 
+  8005ee:	ff d0                	call   *%rax
+  8005f0:	89 c2                	mov    %eax,%edx
+  8005f2:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8005f8:	48 89 d0             	mov    %rdx,%rax
+  8005fb:	48 c1 e0 04          	shl    $0x4,%rax
+  8005ff:	48 29 d0             	sub    %rdx,%rax
+  800602:	48 c1 e0 05          	shl    $0x5,%rax
+  800606:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80060d:	00 00 00 
+  800610:	48 01 d0             	add    %rdx,%rax
+  800613:	48 a3 00 30 85 00 00 	movabs %rax,0x853000
+  80061a:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80061d:	45 85 ed             	test   %r13d,%r13d
+  800620:	7e 0d                	jle    80062f <libmain+0x8c>
+  800622:	49 8b 06             	mov    (%r14),%rax
+  800625:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  80062c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80062f:	4c 89 f6             	mov    %r14,%rsi
+  800632:	44 89 ef             	mov    %r13d,%edi
+  800635:	48 b8 e5 01 80 00 00 	movabs $0x8001e5,%rax
+  80063c:	00 00 00 
+  80063f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800641:	48 b8 56 06 80 00 00 	movabs $0x800656,%rax
+  800648:	00 00 00 
+  80064b:	ff d0                	call   *%rax
+#endif
+}
+  80064d:	5b                   	pop    %rbx
+  80064e:	41 5c                	pop    %r12
+  800650:	41 5d                	pop    %r13
+  800652:	41 5e                	pop    %r14
+  800654:	5d                   	pop    %rbp
+  800655:	c3                   	ret
+
+0000000000800656 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800656:	55                   	push   %rbp
+  800657:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80065a:	48 b8 c6 1d 80 00 00 	movabs $0x801dc6,%rax
+  800661:	00 00 00 
+  800664:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800666:	bf 00 00 00 00       	mov    $0x0,%edi
+  80066b:	48 b8 5d 15 80 00 00 	movabs $0x80155d,%rax
+  800672:	00 00 00 
+  800675:	ff d0                	call   *%rax
+}
+  800677:	5d                   	pop    %rbp
+  800678:	c3                   	ret
+
+0000000000800679 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800679:	55                   	push   %rbp
+  80067a:	48 89 e5             	mov    %rsp,%rbp
+  80067d:	41 56                	push   %r14
+  80067f:	41 55                	push   %r13
+  800681:	41 54                	push   %r12
+  800683:	53                   	push   %rbx
+  800684:	48 83 ec 50          	sub    $0x50,%rsp
+  800688:	49 89 fc             	mov    %rdi,%r12
+  80068b:	41 89 f5             	mov    %esi,%r13d
+  80068e:	48 89 d3             	mov    %rdx,%rbx
+  800691:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800695:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800699:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80069d:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8006a4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006a8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8006ac:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8006b0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8006b4:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8006bb:	00 00 00 
+  8006be:	4c 8b 30             	mov    (%rax),%r14
+  8006c1:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+  8006cd:	89 c6                	mov    %eax,%esi
+  8006cf:	45 89 e8             	mov    %r13d,%r8d
+  8006d2:	4c 89 e1             	mov    %r12,%rcx
+  8006d5:	4c 89 f2             	mov    %r14,%rdx
+  8006d8:	48 bf a0 5a 80 00 00 	movabs $0x805aa0,%rdi
+  8006df:	00 00 00 
+  8006e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e7:	49 bc c9 07 80 00 00 	movabs $0x8007c9,%r12
+  8006ee:	00 00 00 
+  8006f1:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006f4:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006f8:	48 89 df             	mov    %rbx,%rdi
+  8006fb:	48 b8 65 07 80 00 00 	movabs $0x800765,%rax
+  800702:	00 00 00 
+  800705:	ff d0                	call   *%rax
+    cprintf("\n");
+  800707:	48 bf cb 60 80 00 00 	movabs $0x8060cb,%rdi
+  80070e:	00 00 00 
+  800711:	b8 00 00 00 00       	mov    $0x0,%eax
+  800716:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800719:	cc                   	int3
+  80071a:	eb fd                	jmp    800719 <_panic+0xa0>
+
+000000000080071c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80071c:	55                   	push   %rbp
+  80071d:	48 89 e5             	mov    %rsp,%rbp
+  800720:	53                   	push   %rbx
+  800721:	48 83 ec 08          	sub    $0x8,%rsp
+  800725:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800728:	8b 06                	mov    (%rsi),%eax
+  80072a:	8d 50 01             	lea    0x1(%rax),%edx
+  80072d:	89 16                	mov    %edx,(%rsi)
+  80072f:	48 98                	cltq
+  800731:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800736:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80073c:	74 0a                	je     800748 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80073e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800742:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800746:	c9                   	leave
+  800747:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800748:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80074c:	be ff 00 00 00       	mov    $0xff,%esi
+  800751:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  800758:	00 00 00 
+  80075b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80075d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800763:	eb d9                	jmp    80073e <putch+0x22>
+
+0000000000800765 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800765:	55                   	push   %rbp
+  800766:	48 89 e5             	mov    %rsp,%rbp
+  800769:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800770:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800773:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80077a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80077f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800784:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800787:	48 89 f1             	mov    %rsi,%rcx
+  80078a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800791:	48 bf 1c 07 80 00 00 	movabs $0x80071c,%rdi
+  800798:	00 00 00 
+  80079b:	48 b8 19 09 80 00 00 	movabs $0x800919,%rax
+  8007a2:	00 00 00 
+  8007a5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8007a7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8007ae:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8007b5:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8007bc:	00 00 00 
+  8007bf:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8007c1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8007c7:	c9                   	leave
+  8007c8:	c3                   	ret
+
+00000000008007c9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8007c9:	55                   	push   %rbp
+  8007ca:	48 89 e5             	mov    %rsp,%rbp
+  8007cd:	48 83 ec 50          	sub    $0x50,%rsp
+  8007d1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8007d5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8007d9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8007dd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007e1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007e5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007ec:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007f8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007fc:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800800:	48 b8 65 07 80 00 00 	movabs $0x800765,%rax
+  800807:	00 00 00 
+  80080a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80080c:	c9                   	leave
+  80080d:	c3                   	ret
+
+000000000080080e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80080e:	55                   	push   %rbp
+  80080f:	48 89 e5             	mov    %rsp,%rbp
+  800812:	41 57                	push   %r15
+  800814:	41 56                	push   %r14
+  800816:	41 55                	push   %r13
+  800818:	41 54                	push   %r12
+  80081a:	53                   	push   %rbx
+  80081b:	48 83 ec 18          	sub    $0x18,%rsp
+  80081f:	49 89 fc             	mov    %rdi,%r12
+  800822:	49 89 f5             	mov    %rsi,%r13
+  800825:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800829:	8b 45 10             	mov    0x10(%rbp),%eax
+  80082c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80082f:	41 89 cf             	mov    %ecx,%r15d
+  800832:	4c 39 fa             	cmp    %r15,%rdx
+  800835:	73 5b                	jae    800892 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800837:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80083b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80083f:	85 db                	test   %ebx,%ebx
+  800841:	7e 0e                	jle    800851 <print_num+0x43>
+            putch(padc, put_arg);
+  800843:	4c 89 ee             	mov    %r13,%rsi
+  800846:	44 89 f7             	mov    %r14d,%edi
+  800849:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80084c:	83 eb 01             	sub    $0x1,%ebx
+  80084f:	75 f2                	jne    800843 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800851:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800855:	48 b9 d4 5a 80 00 00 	movabs $0x805ad4,%rcx
+  80085c:	00 00 00 
+  80085f:	48 b8 c3 5a 80 00 00 	movabs $0x805ac3,%rax
+  800866:	00 00 00 
+  800869:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80086d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800871:	ba 00 00 00 00       	mov    $0x0,%edx
+  800876:	49 f7 f7             	div    %r15
+  800879:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80087d:	4c 89 ee             	mov    %r13,%rsi
+  800880:	41 ff d4             	call   *%r12
+}
+  800883:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800887:	5b                   	pop    %rbx
+  800888:	41 5c                	pop    %r12
+  80088a:	41 5d                	pop    %r13
+  80088c:	41 5e                	pop    %r14
+  80088e:	41 5f                	pop    %r15
+  800890:	5d                   	pop    %rbp
+  800891:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800892:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800896:	ba 00 00 00 00       	mov    $0x0,%edx
+  80089b:	49 f7 f7             	div    %r15
+  80089e:	48 83 ec 08          	sub    $0x8,%rsp
+  8008a2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8008a6:	52                   	push   %rdx
+  8008a7:	45 0f be c9          	movsbl %r9b,%r9d
+  8008ab:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8008af:	48 89 c2             	mov    %rax,%rdx
+  8008b2:	48 b8 0e 08 80 00 00 	movabs $0x80080e,%rax
+  8008b9:	00 00 00 
+  8008bc:	ff d0                	call   *%rax
+  8008be:	48 83 c4 10          	add    $0x10,%rsp
+  8008c2:	eb 8d                	jmp    800851 <print_num+0x43>
+
+00000000008008c4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8008c4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8008c8:	48 8b 06             	mov    (%rsi),%rax
+  8008cb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8008cf:	73 0a                	jae    8008db <sprintputch+0x17>
+        *state->start++ = ch;
+  8008d1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8008d5:	48 89 16             	mov    %rdx,(%rsi)
+  8008d8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8008db:	c3                   	ret
+
+00000000008008dc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8008dc:	55                   	push   %rbp
+  8008dd:	48 89 e5             	mov    %rsp,%rbp
+  8008e0:	48 83 ec 50          	sub    $0x50,%rsp
+  8008e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008f0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800903:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800907:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80090b:	48 b8 19 09 80 00 00 	movabs $0x800919,%rax
+  800912:	00 00 00 
+  800915:	ff d0                	call   *%rax
+}
+  800917:	c9                   	leave
+  800918:	c3                   	ret
+
+0000000000800919 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800919:	55                   	push   %rbp
+  80091a:	48 89 e5             	mov    %rsp,%rbp
+  80091d:	41 57                	push   %r15
+  80091f:	41 56                	push   %r14
+  800921:	41 55                	push   %r13
+  800923:	41 54                	push   %r12
+  800925:	53                   	push   %rbx
+  800926:	48 83 ec 38          	sub    $0x38,%rsp
+  80092a:	49 89 fe             	mov    %rdi,%r14
+  80092d:	49 89 f5             	mov    %rsi,%r13
+  800930:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800933:	48 8b 01             	mov    (%rcx),%rax
+  800936:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80093a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80093e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800942:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800946:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80094a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80094e:	0f b6 3b             	movzbl (%rbx),%edi
+  800951:	40 80 ff 25          	cmp    $0x25,%dil
+  800955:	74 18                	je     80096f <vprintfmt+0x56>
+            if (!ch) return;
+  800957:	40 84 ff             	test   %dil,%dil
+  80095a:	0f 84 b1 06 00 00    	je     801011 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800960:	40 0f b6 ff          	movzbl %dil,%edi
+  800964:	4c 89 ee             	mov    %r13,%rsi
+  800967:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80096a:	4c 89 e3             	mov    %r12,%rbx
+  80096d:	eb db                	jmp    80094a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80096f:	be 00 00 00 00       	mov    $0x0,%esi
+  800974:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800978:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80097d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800983:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80098a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80098e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800993:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800998:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80099b:	83 e8 23             	sub    $0x23,%eax
+  80099e:	3c 57                	cmp    $0x57,%al
+  8009a0:	0f 87 51 06 00 00    	ja     800ff7 <vprintfmt+0x6de>
+  8009a6:	0f b6 c0             	movzbl %al,%eax
+  8009a9:	48 b9 80 5c 80 00 00 	movabs $0x805c80,%rcx
+  8009b0:	00 00 00 
+  8009b3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8009b6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8009b9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8009bd:	eb cf                	jmp    80098e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8009bf:	49 89 dc             	mov    %rbx,%r12
+  8009c2:	be 01 00 00 00       	mov    $0x1,%esi
+  8009c7:	eb c5                	jmp    80098e <vprintfmt+0x75>
+            padc = ch;
+  8009c9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8009cd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8009d0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8009d3:	eb b9                	jmp    80098e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009db:	77 24                	ja     800a01 <vprintfmt+0xe8>
+  8009dd:	89 c1                	mov    %eax,%ecx
+  8009df:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009e3:	83 c0 08             	add    $0x8,%eax
+  8009e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009ec:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009f3:	79 99                	jns    80098e <vprintfmt+0x75>
+                width = precision;
+  8009f5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009f9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009ff:	eb 8d                	jmp    80098e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800a01:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800a05:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800a09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0d:	eb da                	jmp    8009e9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800a0f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800a14:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a18:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800a1e:	3c 39                	cmp    $0x39,%al
+  800a20:	77 1c                	ja     800a3e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800a22:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800a26:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800a2a:	0f b6 c0             	movzbl %al,%eax
+  800a2d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800a32:	0f b6 03             	movzbl (%rbx),%eax
+  800a35:	3c 39                	cmp    $0x39,%al
+  800a37:	76 e9                	jbe    800a22 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800a39:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800a3c:	eb b1                	jmp    8009ef <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a3e:	49 89 dc             	mov    %rbx,%r12
+  800a41:	eb ac                	jmp    8009ef <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a43:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a46:	85 c9                	test   %ecx,%ecx
+  800a48:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a4d:	0f 49 c1             	cmovns %ecx,%eax
+  800a50:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a53:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a56:	e9 33 ff ff ff       	jmp    80098e <vprintfmt+0x75>
+            lflag++;
+  800a5b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a5e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a61:	e9 28 ff ff ff       	jmp    80098e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a66:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a69:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6c:	77 19                	ja     800a87 <vprintfmt+0x16e>
+  800a6e:	89 c2                	mov    %eax,%edx
+  800a70:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a74:	83 c0 08             	add    $0x8,%eax
+  800a77:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7a:	8b 3a                	mov    (%rdx),%edi
+  800a7c:	4c 89 ee             	mov    %r13,%rsi
+  800a7f:	41 ff d6             	call   *%r14
+            break;
+  800a82:	e9 c3 fe ff ff       	jmp    80094a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a87:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a93:	eb e5                	jmp    800a7a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a95:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a98:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9b:	77 5a                	ja     800af7 <vprintfmt+0x1de>
+  800a9d:	89 c2                	mov    %eax,%edx
+  800a9f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa3:	83 c0 08             	add    $0x8,%eax
+  800aa6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800aa9:	8b 02                	mov    (%rdx),%eax
+  800aab:	89 c1                	mov    %eax,%ecx
+  800aad:	f7 d9                	neg    %ecx
+  800aaf:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800ab2:	83 f9 16             	cmp    $0x16,%ecx
+  800ab5:	7f 4e                	jg     800b05 <vprintfmt+0x1ec>
+  800ab7:	48 63 c1             	movslq %ecx,%rax
+  800aba:	48 ba 40 5f 80 00 00 	movabs $0x805f40,%rdx
+  800ac1:	00 00 00 
+  800ac4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800ac8:	48 85 c0             	test   %rax,%rax
+  800acb:	74 38                	je     800b05 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800acd:	48 89 c1             	mov    %rax,%rcx
+  800ad0:	48 ba 03 62 80 00 00 	movabs $0x806203,%rdx
+  800ad7:	00 00 00 
+  800ada:	4c 89 ee             	mov    %r13,%rsi
+  800add:	4c 89 f7             	mov    %r14,%rdi
+  800ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ae5:	49 b8 dc 08 80 00 00 	movabs $0x8008dc,%r8
+  800aec:	00 00 00 
+  800aef:	41 ff d0             	call   *%r8
+  800af2:	e9 53 fe ff ff       	jmp    80094a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800af7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b03:	eb a4                	jmp    800aa9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800b05:	48 ba ec 5a 80 00 00 	movabs $0x805aec,%rdx
+  800b0c:	00 00 00 
+  800b0f:	4c 89 ee             	mov    %r13,%rsi
+  800b12:	4c 89 f7             	mov    %r14,%rdi
+  800b15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b1a:	49 b8 dc 08 80 00 00 	movabs $0x8008dc,%r8
+  800b21:	00 00 00 
+  800b24:	41 ff d0             	call   *%r8
+  800b27:	e9 1e fe ff ff       	jmp    80094a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b32:	77 6c                	ja     800ba0 <vprintfmt+0x287>
+  800b34:	89 c2                	mov    %eax,%edx
+  800b36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3a:	83 c0 08             	add    $0x8,%eax
+  800b3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b40:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b43:	48 85 d2             	test   %rdx,%rdx
+  800b46:	48 b8 e5 5a 80 00 00 	movabs $0x805ae5,%rax
+  800b4d:	00 00 00 
+  800b50:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b54:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b58:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b5c:	7e 06                	jle    800b64 <vprintfmt+0x24b>
+  800b5e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b62:	75 4a                	jne    800bae <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b64:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b68:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b6c:	0f b6 00             	movzbl (%rax),%eax
+  800b6f:	84 c0                	test   %al,%al
+  800b71:	0f 85 9a 00 00 00    	jne    800c11 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b77:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b7a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b7e:	85 c0                	test   %eax,%eax
+  800b80:	0f 8e c4 fd ff ff    	jle    80094a <vprintfmt+0x31>
+  800b86:	4c 89 ee             	mov    %r13,%rsi
+  800b89:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b8e:	41 ff d6             	call   *%r14
+  800b91:	41 83 ec 01          	sub    $0x1,%r12d
+  800b95:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b99:	75 eb                	jne    800b86 <vprintfmt+0x26d>
+  800b9b:	e9 aa fd ff ff       	jmp    80094a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800ba0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bac:	eb 92                	jmp    800b40 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800bae:	49 63 f7             	movslq %r15d,%rsi
+  800bb1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800bb5:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  800bbc:	00 00 00 
+  800bbf:	ff d0                	call   *%rax
+  800bc1:	48 89 c2             	mov    %rax,%rdx
+  800bc4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800bc7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800bc9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800bcc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800bcf:	85 c0                	test   %eax,%eax
+  800bd1:	7e 91                	jle    800b64 <vprintfmt+0x24b>
+  800bd3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800bd8:	4c 89 ee             	mov    %r13,%rsi
+  800bdb:	44 89 e7             	mov    %r12d,%edi
+  800bde:	41 ff d6             	call   *%r14
+  800be1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800be5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800be8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800beb:	75 eb                	jne    800bd8 <vprintfmt+0x2bf>
+  800bed:	e9 72 ff ff ff       	jmp    800b64 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bf2:	0f b6 f8             	movzbl %al,%edi
+  800bf5:	4c 89 ee             	mov    %r13,%rsi
+  800bf8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bfb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bff:	49 83 c4 01          	add    $0x1,%r12
+  800c03:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800c09:	84 c0                	test   %al,%al
+  800c0b:	0f 84 66 ff ff ff    	je     800b77 <vprintfmt+0x25e>
+  800c11:	45 85 ff             	test   %r15d,%r15d
+  800c14:	78 0a                	js     800c20 <vprintfmt+0x307>
+  800c16:	41 83 ef 01          	sub    $0x1,%r15d
+  800c1a:	0f 88 57 ff ff ff    	js     800b77 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800c20:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800c24:	74 cc                	je     800bf2 <vprintfmt+0x2d9>
+  800c26:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800c29:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800c2e:	80 fa 5e             	cmp    $0x5e,%dl
+  800c31:	77 c2                	ja     800bf5 <vprintfmt+0x2dc>
+  800c33:	eb bd                	jmp    800bf2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800c35:	40 84 f6             	test   %sil,%sil
+  800c38:	75 26                	jne    800c60 <vprintfmt+0x347>
+    switch (lflag) {
+  800c3a:	85 d2                	test   %edx,%edx
+  800c3c:	74 59                	je     800c97 <vprintfmt+0x37e>
+  800c3e:	83 fa 01             	cmp    $0x1,%edx
+  800c41:	74 7b                	je     800cbe <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c46:	83 f8 2f             	cmp    $0x2f,%eax
+  800c49:	0f 87 96 00 00 00    	ja     800ce5 <vprintfmt+0x3cc>
+  800c4f:	89 c2                	mov    %eax,%edx
+  800c51:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c55:	83 c0 08             	add    $0x8,%eax
+  800c58:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c5b:	4c 8b 22             	mov    (%rdx),%r12
+  800c5e:	eb 17                	jmp    800c77 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c63:	83 f8 2f             	cmp    $0x2f,%eax
+  800c66:	77 21                	ja     800c89 <vprintfmt+0x370>
+  800c68:	89 c2                	mov    %eax,%edx
+  800c6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6e:	83 c0 08             	add    $0x8,%eax
+  800c71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c74:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c77:	4d 85 e4             	test   %r12,%r12
+  800c7a:	78 7a                	js     800cf6 <vprintfmt+0x3dd>
+            num = i;
+  800c7c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c7f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c84:	e9 50 02 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c95:	eb dd                	jmp    800c74 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c9d:	77 11                	ja     800cb0 <vprintfmt+0x397>
+  800c9f:	89 c2                	mov    %eax,%edx
+  800ca1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ca5:	83 c0 08             	add    $0x8,%eax
+  800ca8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cab:	4c 63 22             	movslq (%rdx),%r12
+  800cae:	eb c7                	jmp    800c77 <vprintfmt+0x35e>
+  800cb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cbc:	eb ed                	jmp    800cab <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800cbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cc1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc4:	77 11                	ja     800cd7 <vprintfmt+0x3be>
+  800cc6:	89 c2                	mov    %eax,%edx
+  800cc8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ccc:	83 c0 08             	add    $0x8,%eax
+  800ccf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cd2:	4c 8b 22             	mov    (%rdx),%r12
+  800cd5:	eb a0                	jmp    800c77 <vprintfmt+0x35e>
+  800cd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce3:	eb ed                	jmp    800cd2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ce5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ced:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf1:	e9 65 ff ff ff       	jmp    800c5b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cf6:	4c 89 ee             	mov    %r13,%rsi
+  800cf9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cfe:	41 ff d6             	call   *%r14
+                i = -i;
+  800d01:	49 f7 dc             	neg    %r12
+  800d04:	e9 73 ff ff ff       	jmp    800c7c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800d09:	40 84 f6             	test   %sil,%sil
+  800d0c:	75 32                	jne    800d40 <vprintfmt+0x427>
+    switch (lflag) {
+  800d0e:	85 d2                	test   %edx,%edx
+  800d10:	74 5d                	je     800d6f <vprintfmt+0x456>
+  800d12:	83 fa 01             	cmp    $0x1,%edx
+  800d15:	0f 84 82 00 00 00    	je     800d9d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800d1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d21:	0f 87 a5 00 00 00    	ja     800dcc <vprintfmt+0x4b3>
+  800d27:	89 c2                	mov    %eax,%edx
+  800d29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2d:	83 c0 08             	add    $0x8,%eax
+  800d30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d33:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d36:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d3b:	e9 99 01 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d43:	83 f8 2f             	cmp    $0x2f,%eax
+  800d46:	77 19                	ja     800d61 <vprintfmt+0x448>
+  800d48:	89 c2                	mov    %eax,%edx
+  800d4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d4e:	83 c0 08             	add    $0x8,%eax
+  800d51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d54:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d5c:	e9 78 01 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+  800d61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6d:	eb e5                	jmp    800d54 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d72:	83 f8 2f             	cmp    $0x2f,%eax
+  800d75:	77 18                	ja     800d8f <vprintfmt+0x476>
+  800d77:	89 c2                	mov    %eax,%edx
+  800d79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7d:	83 c0 08             	add    $0x8,%eax
+  800d80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d83:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d8a:	e9 4a 01 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+  800d8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9b:	eb e6                	jmp    800d83 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800da0:	83 f8 2f             	cmp    $0x2f,%eax
+  800da3:	77 19                	ja     800dbe <vprintfmt+0x4a5>
+  800da5:	89 c2                	mov    %eax,%edx
+  800da7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dab:	83 c0 08             	add    $0x8,%eax
+  800dae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800db1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800db4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800db9:	e9 1b 01 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+  800dbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dca:	eb e5                	jmp    800db1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800dcc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd8:	e9 56 ff ff ff       	jmp    800d33 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ddd:	40 84 f6             	test   %sil,%sil
+  800de0:	75 2e                	jne    800e10 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800de2:	85 d2                	test   %edx,%edx
+  800de4:	74 59                	je     800e3f <vprintfmt+0x526>
+  800de6:	83 fa 01             	cmp    $0x1,%edx
+  800de9:	74 7f                	je     800e6a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800deb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dee:	83 f8 2f             	cmp    $0x2f,%eax
+  800df1:	0f 87 9f 00 00 00    	ja     800e96 <vprintfmt+0x57d>
+  800df7:	89 c2                	mov    %eax,%edx
+  800df9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfd:	83 c0 08             	add    $0x8,%eax
+  800e00:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e03:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e06:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e0b:	e9 c9 00 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e13:	83 f8 2f             	cmp    $0x2f,%eax
+  800e16:	77 19                	ja     800e31 <vprintfmt+0x518>
+  800e18:	89 c2                	mov    %eax,%edx
+  800e1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1e:	83 c0 08             	add    $0x8,%eax
+  800e21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e27:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e2c:	e9 a8 00 00 00       	jmp    800ed9 <vprintfmt+0x5c0>
+  800e31:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e35:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e39:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3d:	eb e5                	jmp    800e24 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e42:	83 f8 2f             	cmp    $0x2f,%eax
+  800e45:	77 15                	ja     800e5c <vprintfmt+0x543>
+  800e47:	89 c2                	mov    %eax,%edx
+  800e49:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4d:	83 c0 08             	add    $0x8,%eax
+  800e50:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e53:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e5a:	eb 7d                	jmp    800ed9 <vprintfmt+0x5c0>
+  800e5c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e60:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e68:	eb e9                	jmp    800e53 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e70:	77 16                	ja     800e88 <vprintfmt+0x56f>
+  800e72:	89 c2                	mov    %eax,%edx
+  800e74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e78:	83 c0 08             	add    $0x8,%eax
+  800e7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e81:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e86:	eb 51                	jmp    800ed9 <vprintfmt+0x5c0>
+  800e88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e94:	eb e8                	jmp    800e7e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ea2:	e9 5c ff ff ff       	jmp    800e03 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ea7:	4c 89 ee             	mov    %r13,%rsi
+  800eaa:	bf 30 00 00 00       	mov    $0x30,%edi
+  800eaf:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800eb2:	4c 89 ee             	mov    %r13,%rsi
+  800eb5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800eba:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ebd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ec0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ec3:	77 47                	ja     800f0c <vprintfmt+0x5f3>
+  800ec5:	89 c2                	mov    %eax,%edx
+  800ec7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ecb:	83 c0 08             	add    $0x8,%eax
+  800ece:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ed1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ed4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ed9:	48 83 ec 08          	sub    $0x8,%rsp
+  800edd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ee1:	0f 94 c0             	sete   %al
+  800ee4:	0f b6 c0             	movzbl %al,%eax
+  800ee7:	50                   	push   %rax
+  800ee8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800eed:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ef1:	4c 89 ee             	mov    %r13,%rsi
+  800ef4:	4c 89 f7             	mov    %r14,%rdi
+  800ef7:	48 b8 0e 08 80 00 00 	movabs $0x80080e,%rax
+  800efe:	00 00 00 
+  800f01:	ff d0                	call   *%rax
+            break;
+  800f03:	48 83 c4 10          	add    $0x10,%rsp
+  800f07:	e9 3e fa ff ff       	jmp    80094a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800f0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f18:	eb b7                	jmp    800ed1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800f1a:	40 84 f6             	test   %sil,%sil
+  800f1d:	75 2b                	jne    800f4a <vprintfmt+0x631>
+    switch (lflag) {
+  800f1f:	85 d2                	test   %edx,%edx
+  800f21:	74 56                	je     800f79 <vprintfmt+0x660>
+  800f23:	83 fa 01             	cmp    $0x1,%edx
+  800f26:	74 7f                	je     800fa7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800f28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800f2e:	0f 87 a2 00 00 00    	ja     800fd6 <vprintfmt+0x6bd>
+  800f34:	89 c2                	mov    %eax,%edx
+  800f36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f3a:	83 c0 08             	add    $0x8,%eax
+  800f3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f43:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f48:	eb 8f                	jmp    800ed9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f50:	77 19                	ja     800f6b <vprintfmt+0x652>
+  800f52:	89 c2                	mov    %eax,%edx
+  800f54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f58:	83 c0 08             	add    $0x8,%eax
+  800f5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f5e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f61:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f66:	e9 6e ff ff ff       	jmp    800ed9 <vprintfmt+0x5c0>
+  800f6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f77:	eb e5                	jmp    800f5e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7f:	77 18                	ja     800f99 <vprintfmt+0x680>
+  800f81:	89 c2                	mov    %eax,%edx
+  800f83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f87:	83 c0 08             	add    $0x8,%eax
+  800f8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f8d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f8f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f94:	e9 40 ff ff ff       	jmp    800ed9 <vprintfmt+0x5c0>
+  800f99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa5:	eb e6                	jmp    800f8d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800fa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800faa:	83 f8 2f             	cmp    $0x2f,%eax
+  800fad:	77 19                	ja     800fc8 <vprintfmt+0x6af>
+  800faf:	89 c2                	mov    %eax,%edx
+  800fb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fb5:	83 c0 08             	add    $0x8,%eax
+  800fb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fbb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800fbe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800fc3:	e9 11 ff ff ff       	jmp    800ed9 <vprintfmt+0x5c0>
+  800fc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fcc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fd4:	eb e5                	jmp    800fbb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800fd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fe2:	e9 59 ff ff ff       	jmp    800f40 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fe7:	4c 89 ee             	mov    %r13,%rsi
+  800fea:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fef:	41 ff d6             	call   *%r14
+            break;
+  800ff2:	e9 53 f9 ff ff       	jmp    80094a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ff7:	4c 89 ee             	mov    %r13,%rsi
+  800ffa:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fff:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801002:	48 83 eb 01          	sub    $0x1,%rbx
+  801006:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  80100a:	75 f6                	jne    801002 <vprintfmt+0x6e9>
+  80100c:	e9 39 f9 ff ff       	jmp    80094a <vprintfmt+0x31>
+}
+  801011:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801015:	5b                   	pop    %rbx
+  801016:	41 5c                	pop    %r12
+  801018:	41 5d                	pop    %r13
+  80101a:	41 5e                	pop    %r14
+  80101c:	41 5f                	pop    %r15
+  80101e:	5d                   	pop    %rbp
+  80101f:	c3                   	ret
+
+0000000000801020 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  801020:	55                   	push   %rbp
+  801021:	48 89 e5             	mov    %rsp,%rbp
+  801024:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801028:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80102c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  801031:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801035:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80103c:	48 85 ff             	test   %rdi,%rdi
+  80103f:	74 2b                	je     80106c <vsnprintf+0x4c>
+  801041:	48 85 f6             	test   %rsi,%rsi
+  801044:	74 26                	je     80106c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801046:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80104a:	48 bf c4 08 80 00 00 	movabs $0x8008c4,%rdi
+  801051:	00 00 00 
+  801054:	48 b8 19 09 80 00 00 	movabs $0x800919,%rax
+  80105b:	00 00 00 
+  80105e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801060:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801064:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801067:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80106a:	c9                   	leave
+  80106b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80106c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801071:	eb f7                	jmp    80106a <vsnprintf+0x4a>
+
+0000000000801073 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+  801077:	48 83 ec 50          	sub    $0x50,%rsp
+  80107b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80107f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801083:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801087:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80108e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801092:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801096:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80109a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80109e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8010a2:	48 b8 20 10 80 00 00 	movabs $0x801020,%rax
+  8010a9:	00 00 00 
+  8010ac:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8010ae:	c9                   	leave
+  8010af:	c3                   	ret
+
+00000000008010b0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8010b0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8010b3:	74 10                	je     8010c5 <strlen+0x15>
+    size_t n = 0;
+  8010b5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8010ba:	48 83 c0 01          	add    $0x1,%rax
+  8010be:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8010c2:	75 f6                	jne    8010ba <strlen+0xa>
+  8010c4:	c3                   	ret
+    size_t n = 0;
+  8010c5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8010ca:	c3                   	ret
+
+00000000008010cb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8010cb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8010ce:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8010d3:	48 85 f6             	test   %rsi,%rsi
+  8010d6:	74 11                	je     8010e9 <strnlen+0x1e>
+  8010d8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8010dc:	74 0c                	je     8010ea <strnlen+0x1f>
+  8010de:	48 83 c2 01          	add    $0x1,%rdx
+  8010e2:	48 39 d0             	cmp    %rdx,%rax
+  8010e5:	75 f1                	jne    8010d8 <strnlen+0xd>
+  8010e7:	eb 04                	jmp    8010ed <strnlen+0x22>
+  8010e9:	c3                   	ret
+  8010ea:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010ed:	c3                   	ret
+
+00000000008010ee <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010ee:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010fa:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010fd:	48 83 c2 01          	add    $0x1,%rdx
+  801101:	84 c9                	test   %cl,%cl
+  801103:	75 f1                	jne    8010f6 <strcpy+0x8>
+        ;
+    return res;
+}
+  801105:	c3                   	ret
+
+0000000000801106 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801106:	55                   	push   %rbp
+  801107:	48 89 e5             	mov    %rsp,%rbp
+  80110a:	41 54                	push   %r12
+  80110c:	53                   	push   %rbx
+  80110d:	48 89 fb             	mov    %rdi,%rbx
+  801110:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801113:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80111a:	00 00 00 
+  80111d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80111f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801123:	4c 89 e6             	mov    %r12,%rsi
+  801126:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  80112d:	00 00 00 
+  801130:	ff d0                	call   *%rax
+    return dst;
+}
+  801132:	48 89 d8             	mov    %rbx,%rax
+  801135:	5b                   	pop    %rbx
+  801136:	41 5c                	pop    %r12
+  801138:	5d                   	pop    %rbp
+  801139:	c3                   	ret
+
+000000000080113a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  80113a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80113d:	48 85 d2             	test   %rdx,%rdx
+  801140:	74 1f                	je     801161 <strncpy+0x27>
+  801142:	48 01 fa             	add    %rdi,%rdx
+  801145:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801148:	48 83 c1 01          	add    $0x1,%rcx
+  80114c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801150:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801154:	41 80 f8 01          	cmp    $0x1,%r8b
+  801158:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80115c:	48 39 ca             	cmp    %rcx,%rdx
+  80115f:	75 e7                	jne    801148 <strncpy+0xe>
+    }
+    return ret;
+}
+  801161:	c3                   	ret
+
+0000000000801162 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801162:	48 89 f8             	mov    %rdi,%rax
+  801165:	48 85 d2             	test   %rdx,%rdx
+  801168:	74 24                	je     80118e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80116a:	48 83 ea 01          	sub    $0x1,%rdx
+  80116e:	74 1b                	je     80118b <strlcpy+0x29>
+  801170:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801174:	0f b6 16             	movzbl (%rsi),%edx
+  801177:	84 d2                	test   %dl,%dl
+  801179:	74 10                	je     80118b <strlcpy+0x29>
+            *dst++ = *src++;
+  80117b:	48 83 c6 01          	add    $0x1,%rsi
+  80117f:	48 83 c0 01          	add    $0x1,%rax
+  801183:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801186:	48 39 c8             	cmp    %rcx,%rax
+  801189:	75 e9                	jne    801174 <strlcpy+0x12>
+        *dst = '\0';
+  80118b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80118e:	48 29 f8             	sub    %rdi,%rax
+}
+  801191:	c3                   	ret
+
+0000000000801192 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801192:	0f b6 07             	movzbl (%rdi),%eax
+  801195:	84 c0                	test   %al,%al
+  801197:	74 13                	je     8011ac <strcmp+0x1a>
+  801199:	38 06                	cmp    %al,(%rsi)
+  80119b:	75 0f                	jne    8011ac <strcmp+0x1a>
+  80119d:	48 83 c7 01          	add    $0x1,%rdi
+  8011a1:	48 83 c6 01          	add    $0x1,%rsi
+  8011a5:	0f b6 07             	movzbl (%rdi),%eax
+  8011a8:	84 c0                	test   %al,%al
+  8011aa:	75 ed                	jne    801199 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011ac:	0f b6 c0             	movzbl %al,%eax
+  8011af:	0f b6 16             	movzbl (%rsi),%edx
+  8011b2:	29 d0                	sub    %edx,%eax
+}
+  8011b4:	c3                   	ret
+
+00000000008011b5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8011b5:	48 85 d2             	test   %rdx,%rdx
+  8011b8:	74 1f                	je     8011d9 <strncmp+0x24>
+  8011ba:	0f b6 07             	movzbl (%rdi),%eax
+  8011bd:	84 c0                	test   %al,%al
+  8011bf:	74 1e                	je     8011df <strncmp+0x2a>
+  8011c1:	3a 06                	cmp    (%rsi),%al
+  8011c3:	75 1a                	jne    8011df <strncmp+0x2a>
+  8011c5:	48 83 c7 01          	add    $0x1,%rdi
+  8011c9:	48 83 c6 01          	add    $0x1,%rsi
+  8011cd:	48 83 ea 01          	sub    $0x1,%rdx
+  8011d1:	75 e7                	jne    8011ba <strncmp+0x5>
+
+    if (!n) return 0;
+  8011d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d8:	c3                   	ret
+  8011d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011de:	c3                   	ret
+  8011df:	48 85 d2             	test   %rdx,%rdx
+  8011e2:	74 09                	je     8011ed <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011e4:	0f b6 07             	movzbl (%rdi),%eax
+  8011e7:	0f b6 16             	movzbl (%rsi),%edx
+  8011ea:	29 d0                	sub    %edx,%eax
+  8011ec:	c3                   	ret
+    if (!n) return 0;
+  8011ed:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f2:	c3                   	ret
+
+00000000008011f3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011f3:	0f b6 17             	movzbl (%rdi),%edx
+  8011f6:	84 d2                	test   %dl,%dl
+  8011f8:	74 18                	je     801212 <strchr+0x1f>
+        if (*str == c) {
+  8011fa:	0f be d2             	movsbl %dl,%edx
+  8011fd:	39 f2                	cmp    %esi,%edx
+  8011ff:	74 17                	je     801218 <strchr+0x25>
+    for (; *str; str++) {
+  801201:	48 83 c7 01          	add    $0x1,%rdi
+  801205:	0f b6 17             	movzbl (%rdi),%edx
+  801208:	84 d2                	test   %dl,%dl
+  80120a:	75 ee                	jne    8011fa <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80120c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801211:	c3                   	ret
+  801212:	b8 00 00 00 00       	mov    $0x0,%eax
+  801217:	c3                   	ret
+  801218:	48 89 f8             	mov    %rdi,%rax
+}
+  80121b:	c3                   	ret
+
+000000000080121c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80121c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80121f:	0f b6 17             	movzbl (%rdi),%edx
+  801222:	84 d2                	test   %dl,%dl
+  801224:	74 13                	je     801239 <strfind+0x1d>
+  801226:	0f be d2             	movsbl %dl,%edx
+  801229:	39 f2                	cmp    %esi,%edx
+  80122b:	74 0b                	je     801238 <strfind+0x1c>
+  80122d:	48 83 c0 01          	add    $0x1,%rax
+  801231:	0f b6 10             	movzbl (%rax),%edx
+  801234:	84 d2                	test   %dl,%dl
+  801236:	75 ee                	jne    801226 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801238:	c3                   	ret
+  801239:	c3                   	ret
+
+000000000080123a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80123a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80123d:	48 89 f8             	mov    %rdi,%rax
+  801240:	48 f7 d8             	neg    %rax
+  801243:	83 e0 07             	and    $0x7,%eax
+  801246:	49 89 d1             	mov    %rdx,%r9
+  801249:	49 29 c1             	sub    %rax,%r9
+  80124c:	78 36                	js     801284 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80124e:	40 0f b6 c6          	movzbl %sil,%eax
+  801252:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801259:	01 01 01 
+  80125c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801260:	40 f6 c7 07          	test   $0x7,%dil
+  801264:	75 38                	jne    80129e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801266:	4c 89 c9             	mov    %r9,%rcx
+  801269:	48 c1 f9 03          	sar    $0x3,%rcx
+  80126d:	74 0c                	je     80127b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80126f:	fc                   	cld
+  801270:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801273:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801277:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80127b:	4d 85 c9             	test   %r9,%r9
+  80127e:	75 45                	jne    8012c5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801280:	4c 89 c0             	mov    %r8,%rax
+  801283:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801284:	48 85 d2             	test   %rdx,%rdx
+  801287:	74 f7                	je     801280 <memset+0x46>
+  801289:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80128c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80128f:	48 83 c0 01          	add    $0x1,%rax
+  801293:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801297:	48 39 c2             	cmp    %rax,%rdx
+  80129a:	75 f3                	jne    80128f <memset+0x55>
+  80129c:	eb e2                	jmp    801280 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80129e:	40 f6 c7 01          	test   $0x1,%dil
+  8012a2:	74 06                	je     8012aa <memset+0x70>
+  8012a4:	88 07                	mov    %al,(%rdi)
+  8012a6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012aa:	40 f6 c7 02          	test   $0x2,%dil
+  8012ae:	74 07                	je     8012b7 <memset+0x7d>
+  8012b0:	66 89 07             	mov    %ax,(%rdi)
+  8012b3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012b7:	40 f6 c7 04          	test   $0x4,%dil
+  8012bb:	74 a9                	je     801266 <memset+0x2c>
+  8012bd:	89 07                	mov    %eax,(%rdi)
+  8012bf:	48 83 c7 04          	add    $0x4,%rdi
+  8012c3:	eb a1                	jmp    801266 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8012c5:	41 f6 c1 04          	test   $0x4,%r9b
+  8012c9:	74 06                	je     8012d1 <memset+0x97>
+  8012cb:	89 07                	mov    %eax,(%rdi)
+  8012cd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8012d1:	41 f6 c1 02          	test   $0x2,%r9b
+  8012d5:	74 07                	je     8012de <memset+0xa4>
+  8012d7:	66 89 07             	mov    %ax,(%rdi)
+  8012da:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012de:	41 f6 c1 01          	test   $0x1,%r9b
+  8012e2:	74 9c                	je     801280 <memset+0x46>
+  8012e4:	88 07                	mov    %al,(%rdi)
+  8012e6:	eb 98                	jmp    801280 <memset+0x46>
+
+00000000008012e8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012e8:	48 89 f8             	mov    %rdi,%rax
+  8012eb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012ee:	48 39 fe             	cmp    %rdi,%rsi
+  8012f1:	73 3b                	jae    80132e <memmove+0x46>
+  8012f3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012f7:	48 39 d7             	cmp    %rdx,%rdi
+  8012fa:	73 32                	jae    80132e <memmove+0x46>
+        s += n;
+        d += n;
+  8012fc:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801300:	48 89 d6             	mov    %rdx,%rsi
+  801303:	48 09 fe             	or     %rdi,%rsi
+  801306:	48 09 ce             	or     %rcx,%rsi
+  801309:	40 f6 c6 07          	test   $0x7,%sil
+  80130d:	75 12                	jne    801321 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80130f:	48 83 ef 08          	sub    $0x8,%rdi
+  801313:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801317:	48 c1 e9 03          	shr    $0x3,%rcx
+  80131b:	fd                   	std
+  80131c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80131f:	fc                   	cld
+  801320:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801321:	48 83 ef 01          	sub    $0x1,%rdi
+  801325:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801329:	fd                   	std
+  80132a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80132c:	eb f1                	jmp    80131f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80132e:	48 89 f2             	mov    %rsi,%rdx
+  801331:	48 09 c2             	or     %rax,%rdx
+  801334:	48 09 ca             	or     %rcx,%rdx
+  801337:	f6 c2 07             	test   $0x7,%dl
+  80133a:	75 0c                	jne    801348 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80133c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801340:	48 89 c7             	mov    %rax,%rdi
+  801343:	fc                   	cld
+  801344:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801347:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801348:	48 89 c7             	mov    %rax,%rdi
+  80134b:	fc                   	cld
+  80134c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80134e:	c3                   	ret
+
+000000000080134f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80134f:	55                   	push   %rbp
+  801350:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801353:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  80135a:	00 00 00 
+  80135d:	ff d0                	call   *%rax
+}
+  80135f:	5d                   	pop    %rbp
+  801360:	c3                   	ret
+
+0000000000801361 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801361:	55                   	push   %rbp
+  801362:	48 89 e5             	mov    %rsp,%rbp
+  801365:	41 57                	push   %r15
+  801367:	41 56                	push   %r14
+  801369:	41 55                	push   %r13
+  80136b:	41 54                	push   %r12
+  80136d:	53                   	push   %rbx
+  80136e:	48 83 ec 08          	sub    $0x8,%rsp
+  801372:	49 89 fe             	mov    %rdi,%r14
+  801375:	49 89 f7             	mov    %rsi,%r15
+  801378:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80137b:	48 89 f7             	mov    %rsi,%rdi
+  80137e:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  801385:	00 00 00 
+  801388:	ff d0                	call   *%rax
+  80138a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80138d:	48 89 de             	mov    %rbx,%rsi
+  801390:	4c 89 f7             	mov    %r14,%rdi
+  801393:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  80139a:	00 00 00 
+  80139d:	ff d0                	call   *%rax
+  80139f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013a2:	48 39 c3             	cmp    %rax,%rbx
+  8013a5:	74 36                	je     8013dd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8013a7:	48 89 d8             	mov    %rbx,%rax
+  8013aa:	4c 29 e8             	sub    %r13,%rax
+  8013ad:	49 39 c4             	cmp    %rax,%r12
+  8013b0:	73 31                	jae    8013e3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8013b2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8013b7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013bb:	4c 89 fe             	mov    %r15,%rsi
+  8013be:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  8013c5:	00 00 00 
+  8013c8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8013ca:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8013ce:	48 83 c4 08          	add    $0x8,%rsp
+  8013d2:	5b                   	pop    %rbx
+  8013d3:	41 5c                	pop    %r12
+  8013d5:	41 5d                	pop    %r13
+  8013d7:	41 5e                	pop    %r14
+  8013d9:	41 5f                	pop    %r15
+  8013db:	5d                   	pop    %rbp
+  8013dc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8013dd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013e1:	eb eb                	jmp    8013ce <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013e3:	48 83 eb 01          	sub    $0x1,%rbx
+  8013e7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013eb:	48 89 da             	mov    %rbx,%rdx
+  8013ee:	4c 89 fe             	mov    %r15,%rsi
+  8013f1:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  8013f8:	00 00 00 
+  8013fb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013fd:	49 01 de             	add    %rbx,%r14
+  801400:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801405:	eb c3                	jmp    8013ca <strlcat+0x69>
+
+0000000000801407 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801407:	48 85 d2             	test   %rdx,%rdx
+  80140a:	74 2d                	je     801439 <memcmp+0x32>
+  80140c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801411:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801415:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80141a:	44 38 c1             	cmp    %r8b,%cl
+  80141d:	75 0f                	jne    80142e <memcmp+0x27>
+    while (n-- > 0) {
+  80141f:	48 83 c0 01          	add    $0x1,%rax
+  801423:	48 39 c2             	cmp    %rax,%rdx
+  801426:	75 e9                	jne    801411 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80142e:	0f b6 c1             	movzbl %cl,%eax
+  801431:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801435:	44 29 c0             	sub    %r8d,%eax
+  801438:	c3                   	ret
+    return 0;
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80143e:	c3                   	ret
+
+000000000080143f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80143f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801443:	48 39 c7             	cmp    %rax,%rdi
+  801446:	73 0f                	jae    801457 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801448:	40 38 37             	cmp    %sil,(%rdi)
+  80144b:	74 0e                	je     80145b <memfind+0x1c>
+    for (; src < end; src++) {
+  80144d:	48 83 c7 01          	add    $0x1,%rdi
+  801451:	48 39 f8             	cmp    %rdi,%rax
+  801454:	75 f2                	jne    801448 <memfind+0x9>
+  801456:	c3                   	ret
+  801457:	48 89 f8             	mov    %rdi,%rax
+  80145a:	c3                   	ret
+  80145b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80145e:	c3                   	ret
+
+000000000080145f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80145f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801462:	0f b6 37             	movzbl (%rdi),%esi
+  801465:	40 80 fe 20          	cmp    $0x20,%sil
+  801469:	74 06                	je     801471 <strtol+0x12>
+  80146b:	40 80 fe 09          	cmp    $0x9,%sil
+  80146f:	75 13                	jne    801484 <strtol+0x25>
+  801471:	48 83 c7 01          	add    $0x1,%rdi
+  801475:	0f b6 37             	movzbl (%rdi),%esi
+  801478:	40 80 fe 20          	cmp    $0x20,%sil
+  80147c:	74 f3                	je     801471 <strtol+0x12>
+  80147e:	40 80 fe 09          	cmp    $0x9,%sil
+  801482:	74 ed                	je     801471 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801484:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801487:	83 e0 fd             	and    $0xfffffffd,%eax
+  80148a:	3c 01                	cmp    $0x1,%al
+  80148c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801490:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801496:	75 0f                	jne    8014a7 <strtol+0x48>
+  801498:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80149b:	74 14                	je     8014b1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80149d:	85 d2                	test   %edx,%edx
+  80149f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8014a4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8014a7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8014ac:	4c 63 ca             	movslq %edx,%r9
+  8014af:	eb 36                	jmp    8014e7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8014b1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8014b5:	74 0f                	je     8014c6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8014b7:	85 d2                	test   %edx,%edx
+  8014b9:	75 ec                	jne    8014a7 <strtol+0x48>
+        s++;
+  8014bb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8014bf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8014c4:	eb e1                	jmp    8014a7 <strtol+0x48>
+        s += 2;
+  8014c6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8014ca:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8014cf:	eb d6                	jmp    8014a7 <strtol+0x48>
+            dig -= '0';
+  8014d1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8014d4:	44 0f b6 c1          	movzbl %cl,%r8d
+  8014d8:	41 39 d0             	cmp    %edx,%r8d
+  8014db:	7d 21                	jge    8014fe <strtol+0x9f>
+        val = val * base + dig;
+  8014dd:	49 0f af c1          	imul   %r9,%rax
+  8014e1:	0f b6 c9             	movzbl %cl,%ecx
+  8014e4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014e7:	48 83 c7 01          	add    $0x1,%rdi
+  8014eb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014ef:	80 f9 39             	cmp    $0x39,%cl
+  8014f2:	76 dd                	jbe    8014d1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014f4:	80 f9 7b             	cmp    $0x7b,%cl
+  8014f7:	77 05                	ja     8014fe <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014f9:	83 e9 57             	sub    $0x57,%ecx
+  8014fc:	eb d6                	jmp    8014d4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014fe:	4d 85 d2             	test   %r10,%r10
+  801501:	74 03                	je     801506 <strtol+0xa7>
+  801503:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801506:	48 89 c2             	mov    %rax,%rdx
+  801509:	48 f7 da             	neg    %rdx
+  80150c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801510:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801514:	c3                   	ret
+
+0000000000801515 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801515:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80151a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80152b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801531:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801533:	c3                   	ret
+
+0000000000801534 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801534:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801539:	bf 00 00 00 00       	mov    $0x0,%edi
+  80153e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801543:	ba 00 00 00 00       	mov    $0x0,%edx
+  801548:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80154e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801554:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80155a:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80155c:	c3                   	ret
+
+000000000080155d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80155d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801560:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801565:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80156f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801575:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80157b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801581:	0f 05                	syscall
+    if (check && ret > 0) {
+  801583:	48 85 c0             	test   %rax,%rax
+  801586:	7f 01                	jg     801589 <sys_env_destroy+0x2c>
+}
+  801588:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801589:	55                   	push   %rbp
+  80158a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158d:	49 89 c0             	mov    %rax,%r8
+  801590:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801595:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  80159c:	00 00 00 
+  80159f:	be 29 00 00 00       	mov    $0x29,%esi
+  8015a4:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  8015ab:	00 00 00 
+  8015ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b3:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  8015ba:	00 00 00 
+  8015bd:	41 ff d1             	call   *%r9
+
+00000000008015c0 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015c0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ca:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e6:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e8:	c3                   	ret
+
+00000000008015e9 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015e9:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015f3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801603:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801609:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80160f:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801611:	c3                   	ret
+
+0000000000801612 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801617:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80161e:	00 00 00 
+  801621:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80162d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801633:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801635:	c3                   	ret
+
+0000000000801636 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801636:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801639:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80163e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801644:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164a:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80164c:	c3                   	ret
+
+000000000080164d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80164d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801650:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801655:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801658:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80165e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801664:	0f 05                	syscall
+    if (check && ret > 0) {
+  801666:	48 85 c0             	test   %rax,%rax
+  801669:	7f 01                	jg     80166c <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80166b:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80166c:	55                   	push   %rbp
+  80166d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801670:	49 89 c0             	mov    %rax,%r8
+  801673:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801678:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  80167f:	00 00 00 
+  801682:	be 29 00 00 00       	mov    $0x29,%esi
+  801687:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  80168e:	00 00 00 
+  801691:	b8 00 00 00 00       	mov    $0x0,%eax
+  801696:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  80169d:	00 00 00 
+  8016a0:	41 ff d1             	call   *%r9
+
+00000000008016a3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016a3:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8016a6:	48 63 d2             	movslq %edx,%rdx
+  8016a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ac:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b1:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8016b4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016b6:	48 85 c0             	test   %rax,%rax
+  8016b9:	7f 01                	jg     8016bc <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8016bb:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016c0:	49 89 c0             	mov    %rax,%r8
+  8016c3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8016c8:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  8016cf:	00 00 00 
+  8016d2:	be 29 00 00 00       	mov    $0x29,%esi
+  8016d7:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  8016de:	00 00 00 
+  8016e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e6:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  8016ed:	00 00 00 
+  8016f0:	41 ff d1             	call   *%r9
+
+00000000008016f3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016f3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016f6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016fb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801701:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801707:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80170d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80170f:	48 85 c0             	test   %rax,%rax
+  801712:	7f 01                	jg     801715 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801714:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801715:	55                   	push   %rbp
+  801716:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801719:	49 89 c0             	mov    %rax,%r8
+  80171c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801721:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  801728:	00 00 00 
+  80172b:	be 29 00 00 00       	mov    $0x29,%esi
+  801730:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  801737:	00 00 00 
+  80173a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173f:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  801746:	00 00 00 
+  801749:	41 ff d1             	call   *%r9
+
+000000000080174c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80174c:	48 63 f6             	movslq %esi,%rsi
+  80174f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801752:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801762:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801768:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80176e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801770:	48 85 c0             	test   %rax,%rax
+  801773:	7f 01                	jg     801776 <sys_env_set_status+0x2a>
+}
+  801775:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801776:	55                   	push   %rbp
+  801777:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80177a:	49 89 c0             	mov    %rax,%r8
+  80177d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801782:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  801789:	00 00 00 
+  80178c:	be 29 00 00 00       	mov    $0x29,%esi
+  801791:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  801798:	00 00 00 
+  80179b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a0:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  8017a7:	00 00 00 
+  8017aa:	41 ff d1             	call   *%r9
+
+00000000008017ad <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8017ad:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017ba:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017cc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017ce:	48 85 c0             	test   %rax,%rax
+  8017d1:	7f 01                	jg     8017d4 <sys_env_set_trapframe+0x27>
+}
+  8017d3:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017d8:	49 89 c0             	mov    %rax,%r8
+  8017db:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8017e0:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  8017e7:	00 00 00 
+  8017ea:	be 29 00 00 00       	mov    $0x29,%esi
+  8017ef:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  8017f6:	00 00 00 
+  8017f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017fe:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  801805:	00 00 00 
+  801808:	41 ff d1             	call   *%r9
+
+000000000080180b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80180b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80180e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801813:	ba 00 00 00 00       	mov    $0x0,%edx
+  801818:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80181e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801824:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80182a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80182c:	48 85 c0             	test   %rax,%rax
+  80182f:	7f 01                	jg     801832 <sys_env_set_pgfault_upcall+0x27>
+}
+  801831:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801832:	55                   	push   %rbp
+  801833:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801836:	49 89 c0             	mov    %rax,%r8
+  801839:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80183e:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  801845:	00 00 00 
+  801848:	be 29 00 00 00       	mov    $0x29,%esi
+  80184d:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  801854:	00 00 00 
+  801857:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185c:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  801863:	00 00 00 
+  801866:	41 ff d1             	call   *%r9
+
+0000000000801869 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801869:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80186c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80186f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801874:	4d 63 c0             	movslq %r8d,%r8
+  801877:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80187d:	0f 05                	syscall
+}
+  80187f:	c3                   	ret
+
+0000000000801880 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801880:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801883:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801886:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80188b:	4d 63 c0             	movslq %r8d,%r8
+  80188e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801894:	0f 05                	syscall
+}
+  801896:	c3                   	ret
+
+0000000000801897 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801897:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80189c:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80189f:	45 89 c0             	mov    %r8d,%r8d
+  8018a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018a8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018aa:	48 85 c0             	test   %rax,%rax
+  8018ad:	7f 01                	jg     8018b0 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8018af:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8018b0:	55                   	push   %rbp
+  8018b1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b4:	49 89 c0             	mov    %rax,%r8
+  8018b7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8018bc:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  8018c3:	00 00 00 
+  8018c6:	be 29 00 00 00       	mov    $0x29,%esi
+  8018cb:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  8018d2:	00 00 00 
+  8018d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018da:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  8018e1:	00 00 00 
+  8018e4:	41 ff d1             	call   *%r9
+
+00000000008018e7 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8018e7:	55                   	push   %rbp
+  8018e8:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8018eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018fb:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+}
+  801907:	5d                   	pop    %rbp
+  801908:	c3                   	ret
+
+0000000000801909 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801909:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80190e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801913:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801918:	ba 00 00 00 00       	mov    $0x0,%edx
+  80191d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801923:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801929:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80192f:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801931:	c3                   	ret
+
+0000000000801932 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801932:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801937:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80193c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801941:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801947:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80194d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801953:	0f 05                	syscall
+    if (check && ret > 0) {
+  801955:	48 85 c0             	test   %rax,%rax
+  801958:	7f 01                	jg     80195b <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80195a:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80195b:	55                   	push   %rbp
+  80195c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80195f:	49 89 c0             	mov    %rax,%r8
+  801962:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801967:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  80196e:	00 00 00 
+  801971:	be 29 00 00 00       	mov    $0x29,%esi
+  801976:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  80197d:	00 00 00 
+  801980:	b8 00 00 00 00       	mov    $0x0,%eax
+  801985:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  80198c:	00 00 00 
+  80198f:	41 ff d1             	call   *%r9
+
+0000000000801992 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801992:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801997:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019b8:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8019ba:	c3                   	ret
+
+00000000008019bb <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8019bb:	89 d2                	mov    %edx,%edx
+  8019bd:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8019bf:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019d6:	0f 05                	syscall
+}
+  8019d8:	c3                   	ret
+
+00000000008019d9 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8019d9:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8019dc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019f8:	0f 05                	syscall
+}
+  8019fa:	c3                   	ret
+
+00000000008019fb <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8019fb:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8019fe:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a03:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a08:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a0e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a14:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a1a:	0f 05                	syscall
+}
+  801a1c:	c3                   	ret
+
+0000000000801a1d <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801a1d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a20:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a25:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a2a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a2f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a35:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a3b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a41:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a43:	48 85 c0             	test   %rax,%rax
+  801a46:	7f 01                	jg     801a49 <sys_irq_ack+0x2c>
+}
+  801a48:	c3                   	ret
+sys_irq_ack(int irq) {
+  801a49:	55                   	push   %rbp
+  801a4a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a4d:	49 89 c0             	mov    %rax,%r8
+  801a50:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801a55:	48 ba 18 60 80 00 00 	movabs $0x806018,%rdx
+  801a5c:	00 00 00 
+  801a5f:	be 29 00 00 00       	mov    $0x29,%esi
+  801a64:	48 bf 37 60 80 00 00 	movabs $0x806037,%rdi
+  801a6b:	00 00 00 
+  801a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a73:	49 b9 79 06 80 00 00 	movabs $0x800679,%r9
+  801a7a:	00 00 00 
+  801a7d:	41 ff d1             	call   *%r9
+
+0000000000801a80 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801a80:	55                   	push   %rbp
+  801a81:	48 89 e5             	mov    %rsp,%rbp
+  801a84:	41 54                	push   %r12
+  801a86:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801a87:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  801a8e:	00 00 00 
+  801a91:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801a93:	b8 08 00 00 00       	mov    $0x8,%eax
+  801a98:	0f 05                	syscall
+  801a9a:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 7e                	js     801b1f <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801aa1:	0f 84 80 00 00 00    	je     801b27 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801aa7:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801aad:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801ab4:	00 00 00 
+  801ab7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801abc:	89 c2                	mov    %eax,%edx
+  801abe:	be 00 00 00 00       	mov    $0x0,%esi
+  801ac3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac8:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  801acf:	00 00 00 
+  801ad2:	ff d0                	call   *%rax
+  801ad4:	85 c0                	test   %eax,%eax
+  801ad6:	0f 88 86 00 00 00    	js     801b62 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801adc:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  801ae3:	00 00 00 
+  801ae6:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801aed:	44 89 e7             	mov    %r12d,%edi
+  801af0:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 6a                	js     801b6a <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801b00:	be 02 00 00 00       	mov    $0x2,%esi
+  801b05:	44 89 e7             	mov    %r12d,%edi
+  801b08:	48 b8 4c 17 80 00 00 	movabs $0x80174c,%rax
+  801b0f:	00 00 00 
+  801b12:	ff d0                	call   *%rax
+		return -1;
+  801b14:	85 c0                	test   %eax,%eax
+  801b16:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801b1b:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801b1f:	44 89 e0             	mov    %r12d,%eax
+  801b22:	5b                   	pop    %rbx
+  801b23:	41 5c                	pop    %r12
+  801b25:	5d                   	pop    %rbp
+  801b26:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801b27:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  801b2e:	00 00 00 
+  801b31:	ff d0                	call   *%rax
+  801b33:	89 c2                	mov    %eax,%edx
+  801b35:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801b3b:	48 89 d0             	mov    %rdx,%rax
+  801b3e:	48 c1 e0 04          	shl    $0x4,%rax
+  801b42:	48 29 d0             	sub    %rdx,%rax
+  801b45:	48 c1 e0 05          	shl    $0x5,%rax
+  801b49:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801b50:	00 00 00 
+  801b53:	48 01 d0             	add    %rdx,%rax
+  801b56:	48 a3 00 30 85 00 00 	movabs %rax,0x853000
+  801b5d:	00 00 00 
+        return 0;
+  801b60:	eb bd                	jmp    801b1f <fork+0x9f>
+		return -1;
+  801b62:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b68:	eb b5                	jmp    801b1f <fork+0x9f>
+		return -1;
+  801b6a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801b70:	eb ad                	jmp    801b1f <fork+0x9f>
+
+0000000000801b72 <sfork>:
+
+envid_t
+sfork() {
+  801b72:	55                   	push   %rbp
+  801b73:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801b76:	48 ba 45 60 80 00 00 	movabs $0x806045,%rdx
+  801b7d:	00 00 00 
+  801b80:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801b85:	48 bf 60 60 80 00 00 	movabs $0x806060,%rdi
+  801b8c:	00 00 00 
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b94:	48 b9 79 06 80 00 00 	movabs $0x800679,%rcx
+  801b9b:	00 00 00 
+  801b9e:	ff d1                	call   *%rcx
+
+0000000000801ba0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ba0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ba7:	ff ff ff 
+  801baa:	48 01 f8             	add    %rdi,%rax
+  801bad:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801bb1:	c3                   	ret
+
+0000000000801bb2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bb2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bb9:	ff ff ff 
+  801bbc:	48 01 f8             	add    %rdi,%rax
+  801bbf:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bc3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801bc9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801bcd:	c3                   	ret
+
+0000000000801bce <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801bce:	55                   	push   %rbp
+  801bcf:	48 89 e5             	mov    %rsp,%rbp
+  801bd2:	41 57                	push   %r15
+  801bd4:	41 56                	push   %r14
+  801bd6:	41 55                	push   %r13
+  801bd8:	41 54                	push   %r12
+  801bda:	53                   	push   %rbx
+  801bdb:	48 83 ec 08          	sub    $0x8,%rsp
+  801bdf:	49 89 ff             	mov    %rdi,%r15
+  801be2:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801be7:	49 bd 16 4d 80 00 00 	movabs $0x804d16,%r13
+  801bee:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801bf1:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801bf7:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801bfa:	48 89 df             	mov    %rbx,%rdi
+  801bfd:	41 ff d5             	call   *%r13
+  801c00:	83 e0 04             	and    $0x4,%eax
+  801c03:	74 17                	je     801c1c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c05:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c0c:	4c 39 f3             	cmp    %r14,%rbx
+  801c0f:	75 e6                	jne    801bf7 <fd_alloc+0x29>
+  801c11:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c17:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c1c:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c1f:	48 83 c4 08          	add    $0x8,%rsp
+  801c23:	5b                   	pop    %rbx
+  801c24:	41 5c                	pop    %r12
+  801c26:	41 5d                	pop    %r13
+  801c28:	41 5e                	pop    %r14
+  801c2a:	41 5f                	pop    %r15
+  801c2c:	5d                   	pop    %rbp
+  801c2d:	c3                   	ret
+
+0000000000801c2e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c2e:	83 ff 1f             	cmp    $0x1f,%edi
+  801c31:	77 39                	ja     801c6c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c33:	55                   	push   %rbp
+  801c34:	48 89 e5             	mov    %rsp,%rbp
+  801c37:	41 54                	push   %r12
+  801c39:	53                   	push   %rbx
+  801c3a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c3d:	48 63 df             	movslq %edi,%rbx
+  801c40:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c47:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c4b:	48 89 df             	mov    %rbx,%rdi
+  801c4e:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  801c55:	00 00 00 
+  801c58:	ff d0                	call   *%rax
+  801c5a:	a8 04                	test   $0x4,%al
+  801c5c:	74 14                	je     801c72 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c5e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c62:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c67:	5b                   	pop    %rbx
+  801c68:	41 5c                	pop    %r12
+  801c6a:	5d                   	pop    %rbp
+  801c6b:	c3                   	ret
+        return -E_INVAL;
+  801c6c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c71:	c3                   	ret
+        return -E_INVAL;
+  801c72:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c77:	eb ee                	jmp    801c67 <fd_lookup+0x39>
+
+0000000000801c79 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c79:	55                   	push   %rbp
+  801c7a:	48 89 e5             	mov    %rsp,%rbp
+  801c7d:	41 54                	push   %r12
+  801c7f:	53                   	push   %rbx
+  801c80:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c83:	48 b8 00 61 80 00 00 	movabs $0x806100,%rax
+  801c8a:	00 00 00 
+  801c8d:	48 bb 20 70 80 00 00 	movabs $0x807020,%rbx
+  801c94:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801c97:	39 3b                	cmp    %edi,(%rbx)
+  801c99:	74 47                	je     801ce2 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801c9b:	48 83 c0 08          	add    $0x8,%rax
+  801c9f:	48 8b 18             	mov    (%rax),%rbx
+  801ca2:	48 85 db             	test   %rbx,%rbx
+  801ca5:	75 f0                	jne    801c97 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801ca7:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  801cae:	00 00 00 
+  801cb1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cb7:	89 fa                	mov    %edi,%edx
+  801cb9:	48 bf 70 60 80 00 00 	movabs $0x806070,%rdi
+  801cc0:	00 00 00 
+  801cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc8:	48 b9 c9 07 80 00 00 	movabs $0x8007c9,%rcx
+  801ccf:	00 00 00 
+  801cd2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801cd4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801cd9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801cdd:	5b                   	pop    %rbx
+  801cde:	41 5c                	pop    %r12
+  801ce0:	5d                   	pop    %rbp
+  801ce1:	c3                   	ret
+            return 0;
+  801ce2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ce7:	eb f0                	jmp    801cd9 <dev_lookup+0x60>
+
+0000000000801ce9 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801ce9:	55                   	push   %rbp
+  801cea:	48 89 e5             	mov    %rsp,%rbp
+  801ced:	41 55                	push   %r13
+  801cef:	41 54                	push   %r12
+  801cf1:	53                   	push   %rbx
+  801cf2:	48 83 ec 18          	sub    $0x18,%rsp
+  801cf6:	48 89 fb             	mov    %rdi,%rbx
+  801cf9:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801cfc:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d03:	ff ff ff 
+  801d06:	48 01 df             	add    %rbx,%rdi
+  801d09:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d0d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d11:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  801d18:	00 00 00 
+  801d1b:	ff d0                	call   *%rax
+  801d1d:	41 89 c5             	mov    %eax,%r13d
+  801d20:	85 c0                	test   %eax,%eax
+  801d22:	78 06                	js     801d2a <fd_close+0x41>
+  801d24:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d28:	74 1a                	je     801d44 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d2a:	45 84 e4             	test   %r12b,%r12b
+  801d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d32:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d36:	44 89 e8             	mov    %r13d,%eax
+  801d39:	48 83 c4 18          	add    $0x18,%rsp
+  801d3d:	5b                   	pop    %rbx
+  801d3e:	41 5c                	pop    %r12
+  801d40:	41 5d                	pop    %r13
+  801d42:	5d                   	pop    %rbp
+  801d43:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d44:	8b 3b                	mov    (%rbx),%edi
+  801d46:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d4a:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+  801d56:	41 89 c5             	mov    %eax,%r13d
+  801d59:	85 c0                	test   %eax,%eax
+  801d5b:	78 1b                	js     801d78 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d5d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d61:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d65:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d6b:	48 85 c0             	test   %rax,%rax
+  801d6e:	74 08                	je     801d78 <fd_close+0x8f>
+  801d70:	48 89 df             	mov    %rbx,%rdi
+  801d73:	ff d0                	call   *%rax
+  801d75:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d7d:	48 89 de             	mov    %rbx,%rsi
+  801d80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d85:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  801d8c:	00 00 00 
+  801d8f:	ff d0                	call   *%rax
+    return res;
+  801d91:	eb a3                	jmp    801d36 <fd_close+0x4d>
+
+0000000000801d93 <close>:
+
+int
+close(int fdnum) {
+  801d93:	55                   	push   %rbp
+  801d94:	48 89 e5             	mov    %rsp,%rbp
+  801d97:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801d9b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801d9f:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 15                	js     801dc4 <close+0x31>
+
+    return fd_close(fd, 1);
+  801daf:	be 01 00 00 00       	mov    $0x1,%esi
+  801db4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801db8:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  801dbf:	00 00 00 
+  801dc2:	ff d0                	call   *%rax
+}
+  801dc4:	c9                   	leave
+  801dc5:	c3                   	ret
+
+0000000000801dc6 <close_all>:
+
+void
+close_all(void) {
+  801dc6:	55                   	push   %rbp
+  801dc7:	48 89 e5             	mov    %rsp,%rbp
+  801dca:	41 54                	push   %r12
+  801dcc:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801dcd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801dd2:	49 bc 93 1d 80 00 00 	movabs $0x801d93,%r12
+  801dd9:	00 00 00 
+  801ddc:	89 df                	mov    %ebx,%edi
+  801dde:	41 ff d4             	call   *%r12
+  801de1:	83 c3 01             	add    $0x1,%ebx
+  801de4:	83 fb 20             	cmp    $0x20,%ebx
+  801de7:	75 f3                	jne    801ddc <close_all+0x16>
+}
+  801de9:	5b                   	pop    %rbx
+  801dea:	41 5c                	pop    %r12
+  801dec:	5d                   	pop    %rbp
+  801ded:	c3                   	ret
+
+0000000000801dee <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801dee:	55                   	push   %rbp
+  801def:	48 89 e5             	mov    %rsp,%rbp
+  801df2:	41 57                	push   %r15
+  801df4:	41 56                	push   %r14
+  801df6:	41 55                	push   %r13
+  801df8:	41 54                	push   %r12
+  801dfa:	53                   	push   %rbx
+  801dfb:	48 83 ec 18          	sub    $0x18,%rsp
+  801dff:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e02:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e06:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+  801e12:	89 c3                	mov    %eax,%ebx
+  801e14:	85 c0                	test   %eax,%eax
+  801e16:	0f 88 b8 00 00 00    	js     801ed4 <dup+0xe6>
+    close(newfdnum);
+  801e1c:	44 89 e7             	mov    %r12d,%edi
+  801e1f:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  801e26:	00 00 00 
+  801e29:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e2b:	4d 63 ec             	movslq %r12d,%r13
+  801e2e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e35:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e39:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e3d:	4c 89 ff             	mov    %r15,%rdi
+  801e40:	49 be b2 1b 80 00 00 	movabs $0x801bb2,%r14
+  801e47:	00 00 00 
+  801e4a:	41 ff d6             	call   *%r14
+  801e4d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e50:	4c 89 ef             	mov    %r13,%rdi
+  801e53:	41 ff d6             	call   *%r14
+  801e56:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e59:	48 89 df             	mov    %rbx,%rdi
+  801e5c:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  801e63:	00 00 00 
+  801e66:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e68:	a8 04                	test   $0x4,%al
+  801e6a:	74 2b                	je     801e97 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e6c:	41 89 c1             	mov    %eax,%r9d
+  801e6f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e75:	4c 89 f1             	mov    %r14,%rcx
+  801e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7d:	48 89 de             	mov    %rbx,%rsi
+  801e80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e85:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  801e8c:	00 00 00 
+  801e8f:	ff d0                	call   *%rax
+  801e91:	89 c3                	mov    %eax,%ebx
+  801e93:	85 c0                	test   %eax,%eax
+  801e95:	78 4e                	js     801ee5 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801e97:	4c 89 ff             	mov    %r15,%rdi
+  801e9a:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  801ea1:	00 00 00 
+  801ea4:	ff d0                	call   *%rax
+  801ea6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ea9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801eaf:	4c 89 e9             	mov    %r13,%rcx
+  801eb2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb7:	4c 89 fe             	mov    %r15,%rsi
+  801eba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebf:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	78 14                	js     801ee5 <dup+0xf7>
+
+    return newfdnum;
+  801ed1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ed4:	89 d8                	mov    %ebx,%eax
+  801ed6:	48 83 c4 18          	add    $0x18,%rsp
+  801eda:	5b                   	pop    %rbx
+  801edb:	41 5c                	pop    %r12
+  801edd:	41 5d                	pop    %r13
+  801edf:	41 5e                	pop    %r14
+  801ee1:	41 5f                	pop    %r15
+  801ee3:	5d                   	pop    %rbp
+  801ee4:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ee5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801eea:	4c 89 ee             	mov    %r13,%rsi
+  801eed:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ef2:	49 bc f3 16 80 00 00 	movabs $0x8016f3,%r12
+  801ef9:	00 00 00 
+  801efc:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801eff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f04:	4c 89 f6             	mov    %r14,%rsi
+  801f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0c:	41 ff d4             	call   *%r12
+    return res;
+  801f0f:	eb c3                	jmp    801ed4 <dup+0xe6>
+
+0000000000801f11 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f11:	55                   	push   %rbp
+  801f12:	48 89 e5             	mov    %rsp,%rbp
+  801f15:	41 56                	push   %r14
+  801f17:	41 55                	push   %r13
+  801f19:	41 54                	push   %r12
+  801f1b:	53                   	push   %rbx
+  801f1c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f20:	89 fb                	mov    %edi,%ebx
+  801f22:	49 89 f4             	mov    %rsi,%r12
+  801f25:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f28:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f2c:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  801f33:	00 00 00 
+  801f36:	ff d0                	call   *%rax
+  801f38:	85 c0                	test   %eax,%eax
+  801f3a:	78 4c                	js     801f88 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f3c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f40:	41 8b 3e             	mov    (%r14),%edi
+  801f43:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f47:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  801f4e:	00 00 00 
+  801f51:	ff d0                	call   *%rax
+  801f53:	85 c0                	test   %eax,%eax
+  801f55:	78 35                	js     801f8c <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f57:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f5b:	83 e0 03             	and    $0x3,%eax
+  801f5e:	83 f8 01             	cmp    $0x1,%eax
+  801f61:	74 2d                	je     801f90 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f63:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f67:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f6b:	48 85 c0             	test   %rax,%rax
+  801f6e:	74 56                	je     801fc6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f70:	4c 89 ea             	mov    %r13,%rdx
+  801f73:	4c 89 e6             	mov    %r12,%rsi
+  801f76:	4c 89 f7             	mov    %r14,%rdi
+  801f79:	ff d0                	call   *%rax
+}
+  801f7b:	48 83 c4 10          	add    $0x10,%rsp
+  801f7f:	5b                   	pop    %rbx
+  801f80:	41 5c                	pop    %r12
+  801f82:	41 5d                	pop    %r13
+  801f84:	41 5e                	pop    %r14
+  801f86:	5d                   	pop    %rbp
+  801f87:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f88:	48 98                	cltq
+  801f8a:	eb ef                	jmp    801f7b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f8c:	48 98                	cltq
+  801f8e:	eb eb                	jmp    801f7b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f90:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  801f97:	00 00 00 
+  801f9a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fa0:	89 da                	mov    %ebx,%edx
+  801fa2:	48 bf b1 60 80 00 00 	movabs $0x8060b1,%rdi
+  801fa9:	00 00 00 
+  801fac:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fb1:	48 b9 c9 07 80 00 00 	movabs $0x8007c9,%rcx
+  801fb8:	00 00 00 
+  801fbb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fbd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fc4:	eb b5                	jmp    801f7b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fc6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fcd:	eb ac                	jmp    801f7b <read+0x6a>
+
+0000000000801fcf <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fcf:	55                   	push   %rbp
+  801fd0:	48 89 e5             	mov    %rsp,%rbp
+  801fd3:	41 57                	push   %r15
+  801fd5:	41 56                	push   %r14
+  801fd7:	41 55                	push   %r13
+  801fd9:	41 54                	push   %r12
+  801fdb:	53                   	push   %rbx
+  801fdc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fe0:	48 85 d2             	test   %rdx,%rdx
+  801fe3:	74 54                	je     802039 <readn+0x6a>
+  801fe5:	41 89 fd             	mov    %edi,%r13d
+  801fe8:	49 89 f6             	mov    %rsi,%r14
+  801feb:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801fee:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ff3:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ff8:	49 bf 11 1f 80 00 00 	movabs $0x801f11,%r15
+  801fff:	00 00 00 
+  802002:	4c 89 e2             	mov    %r12,%rdx
+  802005:	48 29 f2             	sub    %rsi,%rdx
+  802008:	4c 01 f6             	add    %r14,%rsi
+  80200b:	44 89 ef             	mov    %r13d,%edi
+  80200e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 20                	js     802035 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802015:	01 c3                	add    %eax,%ebx
+  802017:	85 c0                	test   %eax,%eax
+  802019:	74 08                	je     802023 <readn+0x54>
+  80201b:	48 63 f3             	movslq %ebx,%rsi
+  80201e:	4c 39 e6             	cmp    %r12,%rsi
+  802021:	72 df                	jb     802002 <readn+0x33>
+    }
+    return res;
+  802023:	48 63 c3             	movslq %ebx,%rax
+}
+  802026:	48 83 c4 08          	add    $0x8,%rsp
+  80202a:	5b                   	pop    %rbx
+  80202b:	41 5c                	pop    %r12
+  80202d:	41 5d                	pop    %r13
+  80202f:	41 5e                	pop    %r14
+  802031:	41 5f                	pop    %r15
+  802033:	5d                   	pop    %rbp
+  802034:	c3                   	ret
+        if (inc < 0) return inc;
+  802035:	48 98                	cltq
+  802037:	eb ed                	jmp    802026 <readn+0x57>
+    int inc = 1, res = 0;
+  802039:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80203e:	eb e3                	jmp    802023 <readn+0x54>
+
+0000000000802040 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802040:	55                   	push   %rbp
+  802041:	48 89 e5             	mov    %rsp,%rbp
+  802044:	41 56                	push   %r14
+  802046:	41 55                	push   %r13
+  802048:	41 54                	push   %r12
+  80204a:	53                   	push   %rbx
+  80204b:	48 83 ec 10          	sub    $0x10,%rsp
+  80204f:	89 fb                	mov    %edi,%ebx
+  802051:	49 89 f4             	mov    %rsi,%r12
+  802054:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802057:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80205b:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  802062:	00 00 00 
+  802065:	ff d0                	call   *%rax
+  802067:	85 c0                	test   %eax,%eax
+  802069:	78 47                	js     8020b2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80206b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80206f:	41 8b 3e             	mov    (%r14),%edi
+  802072:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802076:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	85 c0                	test   %eax,%eax
+  802084:	78 30                	js     8020b6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802086:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  80208b:	74 2d                	je     8020ba <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  80208d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802091:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802095:	48 85 c0             	test   %rax,%rax
+  802098:	74 56                	je     8020f0 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  80209a:	4c 89 ea             	mov    %r13,%rdx
+  80209d:	4c 89 e6             	mov    %r12,%rsi
+  8020a0:	4c 89 f7             	mov    %r14,%rdi
+  8020a3:	ff d0                	call   *%rax
+}
+  8020a5:	48 83 c4 10          	add    $0x10,%rsp
+  8020a9:	5b                   	pop    %rbx
+  8020aa:	41 5c                	pop    %r12
+  8020ac:	41 5d                	pop    %r13
+  8020ae:	41 5e                	pop    %r14
+  8020b0:	5d                   	pop    %rbp
+  8020b1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020b2:	48 98                	cltq
+  8020b4:	eb ef                	jmp    8020a5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020b6:	48 98                	cltq
+  8020b8:	eb eb                	jmp    8020a5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020ba:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  8020c1:	00 00 00 
+  8020c4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020ca:	89 da                	mov    %ebx,%edx
+  8020cc:	48 bf cd 60 80 00 00 	movabs $0x8060cd,%rdi
+  8020d3:	00 00 00 
+  8020d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020db:	48 b9 c9 07 80 00 00 	movabs $0x8007c9,%rcx
+  8020e2:	00 00 00 
+  8020e5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020e7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020ee:	eb b5                	jmp    8020a5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020f0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8020f7:	eb ac                	jmp    8020a5 <write+0x65>
+
+00000000008020f9 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8020f9:	55                   	push   %rbp
+  8020fa:	48 89 e5             	mov    %rsp,%rbp
+  8020fd:	41 54                	push   %r12
+  8020ff:	53                   	push   %rbx
+  802100:	48 83 ec 10          	sub    $0x10,%rsp
+  802104:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802106:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80210a:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  802111:	00 00 00 
+  802114:	ff d0                	call   *%rax
+  802116:	85 c0                	test   %eax,%eax
+  802118:	78 3e                	js     802158 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80211a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80211e:	41 8b 3c 24          	mov    (%r12),%edi
+  802122:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802126:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+  802132:	85 c0                	test   %eax,%eax
+  802134:	78 22                	js     802158 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802136:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80213a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80213e:	48 85 c0             	test   %rax,%rax
+  802141:	74 0b                	je     80214e <seek+0x55>
+  802143:	89 de                	mov    %ebx,%esi
+  802145:	4c 89 e7             	mov    %r12,%rdi
+  802148:	ff d0                	call   *%rax
+  80214a:	85 c0                	test   %eax,%eax
+  80214c:	78 0a                	js     802158 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  80214e:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802153:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802158:	48 83 c4 10          	add    $0x10,%rsp
+  80215c:	5b                   	pop    %rbx
+  80215d:	41 5c                	pop    %r12
+  80215f:	5d                   	pop    %rbp
+  802160:	c3                   	ret
+
+0000000000802161 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802161:	55                   	push   %rbp
+  802162:	48 89 e5             	mov    %rsp,%rbp
+  802165:	41 55                	push   %r13
+  802167:	41 54                	push   %r12
+  802169:	53                   	push   %rbx
+  80216a:	48 83 ec 18          	sub    $0x18,%rsp
+  80216e:	89 fb                	mov    %edi,%ebx
+  802170:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802173:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802177:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	85 c0                	test   %eax,%eax
+  802185:	78 38                	js     8021bf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802187:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80218b:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80218f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802193:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  80219a:	00 00 00 
+  80219d:	ff d0                	call   *%rax
+  80219f:	85 c0                	test   %eax,%eax
+  8021a1:	78 1c                	js     8021bf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021a3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021a8:	74 20                	je     8021ca <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021aa:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021ae:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021b2:	48 85 c0             	test   %rax,%rax
+  8021b5:	74 47                	je     8021fe <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021b7:	44 89 e6             	mov    %r12d,%esi
+  8021ba:	4c 89 ef             	mov    %r13,%rdi
+  8021bd:	ff d0                	call   *%rax
+}
+  8021bf:	48 83 c4 18          	add    $0x18,%rsp
+  8021c3:	5b                   	pop    %rbx
+  8021c4:	41 5c                	pop    %r12
+  8021c6:	41 5d                	pop    %r13
+  8021c8:	5d                   	pop    %rbp
+  8021c9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021ca:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  8021d1:	00 00 00 
+  8021d4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021da:	89 da                	mov    %ebx,%edx
+  8021dc:	48 bf 90 60 80 00 00 	movabs $0x806090,%rdi
+  8021e3:	00 00 00 
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021eb:	48 b9 c9 07 80 00 00 	movabs $0x8007c9,%rcx
+  8021f2:	00 00 00 
+  8021f5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021fc:	eb c1                	jmp    8021bf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021fe:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802203:	eb ba                	jmp    8021bf <ftruncate+0x5e>
+
+0000000000802205 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	41 54                	push   %r12
+  80220b:	53                   	push   %rbx
+  80220c:	48 83 ec 10          	sub    $0x10,%rsp
+  802210:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802213:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802217:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  80221e:	00 00 00 
+  802221:	ff d0                	call   *%rax
+  802223:	85 c0                	test   %eax,%eax
+  802225:	78 4e                	js     802275 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802227:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80222b:	41 8b 3c 24          	mov    (%r12),%edi
+  80222f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802233:	48 b8 79 1c 80 00 00 	movabs $0x801c79,%rax
+  80223a:	00 00 00 
+  80223d:	ff d0                	call   *%rax
+  80223f:	85 c0                	test   %eax,%eax
+  802241:	78 32                	js     802275 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802243:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802247:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80224c:	74 30                	je     80227e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80224e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802251:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802258:	00 00 00 
+    stat->st_isdir = 0;
+  80225b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802262:	00 00 00 
+    stat->st_dev = dev;
+  802265:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80226c:	48 89 de             	mov    %rbx,%rsi
+  80226f:	4c 89 e7             	mov    %r12,%rdi
+  802272:	ff 50 28             	call   *0x28(%rax)
+}
+  802275:	48 83 c4 10          	add    $0x10,%rsp
+  802279:	5b                   	pop    %rbx
+  80227a:	41 5c                	pop    %r12
+  80227c:	5d                   	pop    %rbp
+  80227d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80227e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802283:	eb f0                	jmp    802275 <fstat+0x70>
+
+0000000000802285 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 54                	push   %r12
+  80228b:	53                   	push   %rbx
+  80228c:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80228f:	be 00 00 00 00       	mov    $0x0,%esi
+  802294:	48 b8 f3 33 80 00 00 	movabs $0x8033f3,%rax
+  80229b:	00 00 00 
+  80229e:	ff d0                	call   *%rax
+  8022a0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022a2:	85 c0                	test   %eax,%eax
+  8022a4:	78 25                	js     8022cb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022a6:	4c 89 e6             	mov    %r12,%rsi
+  8022a9:	89 c7                	mov    %eax,%edi
+  8022ab:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  8022b2:	00 00 00 
+  8022b5:	ff d0                	call   *%rax
+  8022b7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022ba:	89 df                	mov    %ebx,%edi
+  8022bc:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+
+    return res;
+  8022c8:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022cb:	89 d8                	mov    %ebx,%eax
+  8022cd:	5b                   	pop    %rbx
+  8022ce:	41 5c                	pop    %r12
+  8022d0:	5d                   	pop    %rbp
+  8022d1:	c3                   	ret
+
+00000000008022d2 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8022d2:	48 b8 08 00 86 00 00 	movabs $0x860008,%rax
+  8022d9:	00 00 00 
+  8022dc:	83 38 00             	cmpl   $0x0,(%rax)
+  8022df:	74 0a                	je     8022eb <fsenv+0x19>
+    return envid;
+}
+  8022e1:	a1 08 00 86 00 00 00 	movabs 0x860008,%eax
+  8022e8:	00 00 
+  8022ea:	c3                   	ret
+fsenv(void) {
+  8022eb:	55                   	push   %rbp
+  8022ec:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8022ef:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022f4:	48 b8 08 59 80 00 00 	movabs $0x805908,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	a3 08 00 86 00 00 00 	movabs %eax,0x860008
+  802307:	00 00 
+}
+  802309:	a1 08 00 86 00 00 00 	movabs 0x860008,%eax
+  802310:	00 00 
+  802312:	5d                   	pop    %rbp
+  802313:	c3                   	ret
+
+0000000000802314 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802314:	55                   	push   %rbp
+  802315:	48 89 e5             	mov    %rsp,%rbp
+  802318:	41 54                	push   %r12
+  80231a:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80231b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802320:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802325:	48 89 de             	mov    %rbx,%rsi
+  802328:	bf 00 00 00 00       	mov    $0x0,%edi
+  80232d:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802339:	48 b8 00 26 86 00 00 	movabs $0x862600,%rax
+  802340:	00 00 00 
+  802343:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802349:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80234e:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802353:	48 89 de             	mov    %rbx,%rsi
+  802356:	bf 00 00 00 00       	mov    $0x0,%edi
+  80235b:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802369:	85 c0                	test   %eax,%eax
+  80236b:	0f 88 a2 00 00 00    	js     802413 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802371:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  802378:	00 00 00 
+  80237b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802381:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802386:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802388:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80238d:	49 bc 6d 51 80 00 00 	movabs $0x80516d,%r12
+  802394:	00 00 00 
+  802397:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80239a:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  80239f:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8023a2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8023a9:	00 00 00 
+  8023ac:	ff d0                	call   *%rax
+  8023ae:	89 c7                	mov    %eax,%edi
+  8023b0:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8023b6:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8023bb:	48 89 da             	mov    %rbx,%rdx
+  8023be:	be 09 00 00 00       	mov    $0x9,%esi
+  8023c3:	48 b8 b2 58 80 00 00 	movabs $0x8058b2,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8023cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8023de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e3:	48 b8 8e 58 80 00 00 	movabs $0x80588e,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+  8023ef:	89 c3                	mov    %eax,%ebx
+  8023f1:	85 c0                	test   %eax,%eax
+  8023f3:	78 25                	js     80241a <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8023f5:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  8023fc:	00 00 00 
+  8023ff:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802405:	a3 00 26 86 00 00 00 	movabs %eax,0x862600
+  80240c:	00 00 
+    return 0;
+  80240e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802413:	89 d8                	mov    %ebx,%eax
+  802415:	5b                   	pop    %rbx
+  802416:	41 5c                	pop    %r12
+  802418:	5d                   	pop    %rbp
+  802419:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80241a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80241f:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802424:	bf 00 00 00 00       	mov    $0x0,%edi
+  802429:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+        return res;
+  802435:	eb dc                	jmp    802413 <fschan_setup+0xff>
+
+0000000000802437 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802437:	48 b8 04 26 86 00 00 	movabs $0x862604,%rax
+  80243e:	00 00 00 
+  802441:	80 38 00             	cmpb   $0x0,(%rax)
+  802444:	74 55                	je     80249b <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802446:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  80244d:	00 00 00 
+  802450:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802456:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80245b:	48 ba 00 26 86 00 00 	movabs $0x862600,%rdx
+  802462:	00 00 00 
+  802465:	3b 0a                	cmp    (%rdx),%ecx
+  802467:	75 01                	jne    80246a <fschan+0x33>
+}
+  802469:	c3                   	ret
+fschan(void) {
+  80246a:	55                   	push   %rbp
+  80246b:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80246e:	48 b8 14 23 80 00 00 	movabs $0x802314,%rax
+  802475:	00 00 00 
+  802478:	ff d0                	call   *%rax
+  80247a:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80247c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802481:	85 d2                	test   %edx,%edx
+  802483:	78 02                	js     802487 <fschan+0x50>
+}
+  802485:	5d                   	pop    %rbp
+  802486:	c3                   	ret
+        fschan_enabled = 0;
+  802487:	48 b8 04 26 86 00 00 	movabs $0x862604,%rax
+  80248e:	00 00 00 
+  802491:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802494:	b8 00 00 00 00       	mov    $0x0,%eax
+  802499:	eb ea                	jmp    802485 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80249b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a0:	c3                   	ret
+
+00000000008024a1 <fbuf>:
+fbuf(struct Fd *fd) {
+  8024a1:	55                   	push   %rbp
+  8024a2:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8024a5:	48 b8 a0 1b 80 00 00 	movabs $0x801ba0,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8024b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024b6:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024ba:	77 12                	ja     8024ce <fbuf+0x2d>
+  8024bc:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8024c0:	48 b8 00 23 86 00 00 	movabs $0x862300,%rax
+  8024c7:	00 00 00 
+  8024ca:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8024ce:	48 89 d0             	mov    %rdx,%rax
+  8024d1:	5d                   	pop    %rbp
+  8024d2:	c3                   	ret
+
+00000000008024d3 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8024d3:	55                   	push   %rbp
+  8024d4:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8024d7:	48 83 c7 40          	add    $0x40,%rdi
+  8024db:	48 b8 a7 51 80 00 00 	movabs $0x8051a7,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+  8024e7:	84 c0                	test   %al,%al
+  8024e9:	75 02                	jne    8024ed <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8024eb:	5d                   	pop    %rbp
+  8024ec:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8024ed:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8024f4:	00 00 00 
+  8024f7:	ff d0                	call   *%rax
+  8024f9:	89 c7                	mov    %eax,%edi
+  8024fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802501:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80250b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802510:	48 b8 b2 58 80 00 00 	movabs $0x8058b2,%rax
+  802517:	00 00 00 
+  80251a:	ff d0                	call   *%rax
+}
+  80251c:	eb cd                	jmp    8024eb <fschan_publish+0x18>
+
+000000000080251e <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80251e:	55                   	push   %rbp
+  80251f:	48 89 e5             	mov    %rsp,%rbp
+  802522:	41 57                	push   %r15
+  802524:	41 56                	push   %r14
+  802526:	41 55                	push   %r13
+  802528:	41 54                	push   %r12
+  80252a:	53                   	push   %rbx
+  80252b:	48 83 ec 48          	sub    $0x48,%rsp
+  80252f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802533:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802537:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80253a:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80253e:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802541:	48 ba 04 00 86 00 00 	movabs $0x860004,%rdx
+  802548:	00 00 00 
+  80254b:	8b 02                	mov    (%rdx),%eax
+  80254d:	83 c0 01             	add    $0x1,%eax
+  802550:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802555:	0f 44 c1             	cmove  %ecx,%eax
+  802558:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80255a:	4d 85 c0             	test   %r8,%r8
+  80255d:	74 2c                	je     80258b <fschan_rw+0x6d>
+  80255f:	45 89 ce             	mov    %r9d,%r14d
+  802562:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802569:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80256d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802573:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80257a:	00 
+  80257b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802581:	b8 01 00 00 00       	mov    $0x1,%eax
+  802586:	e9 41 01 00 00       	jmp    8026cc <fschan_rw+0x1ae>
+  80258b:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80258f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802593:	e9 9c 01 00 00       	jmp    802734 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802598:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80259c:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80259f:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8025a2:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8025a5:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8025a9:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8025ad:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8025b1:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8025b5:	48 89 da             	mov    %rbx,%rdx
+  8025b8:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  8025bf:	00 00 00 
+  8025c2:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8025c4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8025c8:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+            queued += blk;
+  8025d4:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8025d7:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8025db:	4d 39 fc             	cmp    %r15,%r12
+  8025de:	73 6b                	jae    80264b <fschan_rw+0x12d>
+  8025e0:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8025e4:	77 65                	ja     80264b <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025ea:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025ee:	48 b8 82 51 80 00 00 	movabs $0x805182,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8025fa:	4c 89 fb             	mov    %r15,%rbx
+  8025fd:	4c 29 e3             	sub    %r12,%rbx
+  802600:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802605:	48 39 d3             	cmp    %rdx,%rbx
+  802608:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80260c:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802610:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802614:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802618:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80261b:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80261d:	48 b9 04 00 86 00 00 	movabs $0x860004,%rcx
+  802624:	00 00 00 
+  802627:	8b 09                	mov    (%rcx),%ecx
+  802629:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80262c:	83 fe 03             	cmp    $0x3,%esi
+  80262f:	0f 85 63 ff ff ff    	jne    802598 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802635:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802639:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80263c:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80263f:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802642:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802646:	e9 79 ff ff ff       	jmp    8025c4 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80264b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80264f:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802656:	48 89 df             	mov    %rbx,%rdi
+  802659:	48 b8 45 52 80 00 00 	movabs $0x805245,%rax
+  802660:	00 00 00 
+  802663:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802665:	48 89 df             	mov    %rbx,%rdi
+  802668:	48 b8 d3 51 80 00 00 	movabs $0x8051d3,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+  802674:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802678:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80267c:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802680:	75 25                	jne    8026a7 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802682:	8b 40 04             	mov    0x4(%rax),%eax
+  802685:	85 c0                	test   %eax,%eax
+  802687:	0f 88 86 00 00 00    	js     802713 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80268d:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802691:	74 5b                	je     8026ee <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802693:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802697:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80269b:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80269f:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8026a3:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8026a7:	48 89 df             	mov    %rbx,%rdi
+  8026aa:	48 b8 fa 51 80 00 00 	movabs $0x8051fa,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8026b6:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8026ba:	83 f0 01             	xor    $0x1,%eax
+  8026bd:	4d 39 fc             	cmp    %r15,%r12
+  8026c0:	0f 92 c2             	setb   %dl
+  8026c3:	84 c2                	test   %al,%dl
+  8026c5:	75 05                	jne    8026cc <fschan_rw+0x1ae>
+  8026c7:	45 85 ed             	test   %r13d,%r13d
+  8026ca:	74 50                	je     80271c <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8026cc:	4d 39 fc             	cmp    %r15,%r12
+  8026cf:	0f 92 c1             	setb   %cl
+  8026d2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8026d6:	0f 96 c2             	setbe  %dl
+  8026d9:	84 d1                	test   %dl,%cl
+  8026db:	0f 84 6a ff ff ff    	je     80264b <fschan_rw+0x12d>
+  8026e1:	84 c0                	test   %al,%al
+  8026e3:	0f 85 fd fe ff ff    	jne    8025e6 <fschan_rw+0xc8>
+  8026e9:	e9 5d ff ff ff       	jmp    80264b <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8026ee:	48 63 d0             	movslq %eax,%rdx
+  8026f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026f5:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8026f9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8026fd:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802701:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802705:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  80270c:	00 00 00 
+  80270f:	ff d0                	call   *%rax
+  802711:	eb 80                	jmp    802693 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802713:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802716:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80271a:	eb 8b                	jmp    8026a7 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80271c:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802721:	0f 85 68 fe ff ff    	jne    80258f <fschan_rw+0x71>
+  802727:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80272a:	85 c0                	test   %eax,%eax
+  80272c:	0f 84 5d fe ff ff    	je     80258f <fschan_rw+0x71>
+  802732:	48 98                	cltq
+}
+  802734:	48 83 c4 48          	add    $0x48,%rsp
+  802738:	5b                   	pop    %rbx
+  802739:	41 5c                	pop    %r12
+  80273b:	41 5d                	pop    %r13
+  80273d:	41 5e                	pop    %r14
+  80273f:	41 5f                	pop    %r15
+  802741:	5d                   	pop    %rbp
+  802742:	c3                   	ret
+
+0000000000802743 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802743:	55                   	push   %rbp
+  802744:	48 89 e5             	mov    %rsp,%rbp
+  802747:	41 56                	push   %r14
+  802749:	41 55                	push   %r13
+  80274b:	41 54                	push   %r12
+  80274d:	53                   	push   %rbx
+  80274e:	48 83 ec 10          	sub    $0x10,%rsp
+  802752:	49 89 fe             	mov    %rdi,%r14
+  802755:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802758:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80275c:	48 29 f3             	sub    %rsi,%rbx
+  80275f:	48 39 d3             	cmp    %rdx,%rbx
+  802762:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802766:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80276d:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80276e:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802773:	49 bd 75 4d 80 00 00 	movabs $0x804d75,%r13
+  80277a:	00 00 00 
+  80277d:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802784:	76 1e                	jbe    8027a4 <mmap_fault+0x61>
+  802786:	4c 01 e7             	add    %r12,%rdi
+  802789:	41 ff d5             	call   *%r13
+  80278c:	84 c0                	test   %al,%al
+  80278e:	75 14                	jne    8027a4 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802790:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802794:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80279b:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80279f:	48 39 df             	cmp    %rbx,%rdi
+  8027a2:	72 e2                	jb     802786 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8027a4:	48 bb 00 10 86 00 00 	movabs $0x861000,%rbx
+  8027ab:	00 00 00 
+  8027ae:	48 ba 00 20 86 00 00 	movabs $0x862000,%rdx
+  8027b5:	00 00 00 
+  8027b8:	4c 89 f0             	mov    %r14,%rax
+  8027bb:	48 29 d0             	sub    %rdx,%rax
+  8027be:	48 c1 f8 03          	sar    $0x3,%rax
+  8027c2:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8027c9:	aa aa aa 
+  8027cc:	48 0f af c2          	imul   %rdx,%rax
+  8027d0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8027d4:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8027d9:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8027dd:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8027df:	44 89 e0             	mov    %r12d,%eax
+  8027e2:	41 03 46 10          	add    0x10(%r14),%eax
+  8027e6:	41 2b 06             	sub    (%r14),%eax
+  8027e9:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8027ec:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027f0:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8027f4:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8027f8:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8027fb:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  802802:	00 00 00 
+  802805:	ff d0                	call   *%rax
+  802807:	89 c7                	mov    %eax,%edi
+  802809:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80280f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802814:	48 89 da             	mov    %rbx,%rdx
+  802817:	be 0f 00 00 00       	mov    $0xf,%esi
+  80281c:	48 b8 b2 58 80 00 00 	movabs $0x8058b2,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802828:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80282d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802831:	4c 89 e6             	mov    %r12,%rsi
+  802834:	bf 00 00 00 00       	mov    $0x0,%edi
+  802839:	48 b8 8e 58 80 00 00 	movabs $0x80588e,%rax
+  802840:	00 00 00 
+  802843:	ff d0                	call   *%rax
+  802845:	48 98                	cltq
+}
+  802847:	48 83 c4 10          	add    $0x10,%rsp
+  80284b:	5b                   	pop    %rbx
+  80284c:	41 5c                	pop    %r12
+  80284e:	41 5d                	pop    %r13
+  802850:	41 5e                	pop    %r14
+  802852:	5d                   	pop    %rbp
+  802853:	c3                   	ret
+
+0000000000802854 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802854:	48 8b 37             	mov    (%rdi),%rsi
+  802857:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80285e:	48 ba 00 20 86 00 00 	movabs $0x862000,%rdx
+  802865:	00 00 00 
+  802868:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80286d:	eb 0f                	jmp    80287e <mmap_pgfault+0x2a>
+  80286f:	c3                   	ret
+  802870:	48 83 c1 01          	add    $0x1,%rcx
+  802874:	48 83 c2 18          	add    $0x18,%rdx
+  802878:	48 83 f9 20          	cmp    $0x20,%rcx
+  80287c:	74 6e                	je     8028ec <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80287e:	48 8b 02             	mov    (%rdx),%rax
+  802881:	48 83 e8 01          	sub    $0x1,%rax
+  802885:	48 39 f0             	cmp    %rsi,%rax
+  802888:	73 e6                	jae    802870 <mmap_pgfault+0x1c>
+  80288a:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80288e:	73 e0                	jae    802870 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802890:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802894:	b8 00 00 00 00       	mov    $0x0,%eax
+  802899:	f6 c2 01             	test   $0x1,%dl
+  80289c:	75 d1                	jne    80286f <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80289e:	f6 c2 02             	test   $0x2,%dl
+  8028a1:	74 1a                	je     8028bd <mmap_pgfault+0x69>
+  8028a3:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8028a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028ac:	48 bf 00 20 86 00 00 	movabs $0x862000,%rdi
+  8028b3:	00 00 00 
+  8028b6:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8028bb:	74 35                	je     8028f2 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8028bd:	55                   	push   %rbp
+  8028be:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8028c1:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8028c5:	48 b8 00 20 86 00 00 	movabs $0x862000,%rax
+  8028cc:	00 00 00 
+  8028cf:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8028d3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8028d8:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  8028df:	00 00 00 
+  8028e2:	ff d0                	call   *%rax
+  8028e4:	48 85 c0             	test   %rax,%rax
+  8028e7:	0f 9f c0             	setg   %al
+}
+  8028ea:	5d                   	pop    %rbp
+  8028eb:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8028ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028f1:	c3                   	ret
+}
+  8028f2:	c3                   	ret
+
+00000000008028f3 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8028f3:	55                   	push   %rbp
+  8028f4:	48 89 e5             	mov    %rsp,%rbp
+  8028f7:	41 54                	push   %r12
+  8028f9:	53                   	push   %rbx
+  8028fa:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8028fd:	48 b8 00 20 86 00 00 	movabs $0x862000,%rax
+  802904:	00 00 00 
+  802907:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80290c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802910:	74 15                	je     802927 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802912:	48 83 c3 01          	add    $0x1,%rbx
+  802916:	48 83 c0 18          	add    $0x18,%rax
+  80291a:	48 83 fb 20          	cmp    $0x20,%rbx
+  80291e:	75 ec                	jne    80290c <mmap_alloc+0x19>
+    return NULL;
+  802920:	b8 00 00 00 00       	mov    $0x0,%eax
+  802925:	eb 52                	jmp    802979 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802927:	4c 89 e7             	mov    %r12,%rdi
+  80292a:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  802931:	00 00 00 
+  802934:	ff d0                	call   *%rax
+  802936:	41 89 c1             	mov    %eax,%r9d
+  802939:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802940:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802944:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80294a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80294f:	4c 89 e6             	mov    %r12,%rsi
+  802952:	bf 00 00 00 00       	mov    $0x0,%edi
+  802957:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+  802963:	85 c0                	test   %eax,%eax
+  802965:	78 17                	js     80297e <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802967:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80296b:	48 b8 00 20 86 00 00 	movabs $0x862000,%rax
+  802972:	00 00 00 
+  802975:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802979:	5b                   	pop    %rbx
+  80297a:	41 5c                	pop    %r12
+  80297c:	5d                   	pop    %rbp
+  80297d:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80297e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802983:	eb f4                	jmp    802979 <mmap_alloc+0x86>
+
+0000000000802985 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802985:	55                   	push   %rbp
+  802986:	48 89 e5             	mov    %rsp,%rbp
+  802989:	41 56                	push   %r14
+  80298b:	41 55                	push   %r13
+  80298d:	41 54                	push   %r12
+  80298f:	53                   	push   %rbx
+  802990:	48 83 ec 10          	sub    $0x10,%rsp
+  802994:	41 89 fc             	mov    %edi,%r12d
+  802997:	49 89 f5             	mov    %rsi,%r13
+  80299a:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80299d:	48 89 f0             	mov    %rsi,%rax
+  8029a0:	48 09 d0             	or     %rdx,%rax
+  8029a3:	75 0d                	jne    8029b2 <fsipc+0x2d>
+  8029a5:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8029a8:	83 f8 04             	cmp    $0x4,%eax
+  8029ab:	76 7d                	jbe    802a2a <fsipc+0xa5>
+  8029ad:	83 ff 0d             	cmp    $0xd,%edi
+  8029b0:	74 78                	je     802a2a <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8029b2:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8029b9:	00 00 00 
+  8029bc:	ff d0                	call   *%rax
+  8029be:	89 c7                	mov    %eax,%edi
+  8029c0:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8029c7:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8029ce:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8029d5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029db:	48 ba 00 00 87 00 00 	movabs $0x870000,%rdx
+  8029e2:	00 00 00 
+  8029e5:	44 89 e6             	mov    %r12d,%esi
+  8029e8:	48 b8 b2 58 80 00 00 	movabs $0x8058b2,%rax
+  8029ef:	00 00 00 
+  8029f2:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8029f4:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8029fb:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8029fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a01:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802a05:	4c 89 ee             	mov    %r13,%rsi
+  802a08:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0d:	48 b8 8e 58 80 00 00 	movabs $0x80588e,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+  802a19:	89 c3                	mov    %eax,%ebx
+}
+  802a1b:	89 d8                	mov    %ebx,%eax
+  802a1d:	48 83 c4 10          	add    $0x10,%rsp
+  802a21:	5b                   	pop    %rbx
+  802a22:	41 5c                	pop    %r12
+  802a24:	41 5d                	pop    %r13
+  802a26:	41 5e                	pop    %r14
+  802a28:	5d                   	pop    %rbp
+  802a29:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802a2a:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+  802a36:	49 89 c6             	mov    %rax,%r14
+  802a39:	48 85 c0             	test   %rax,%rax
+  802a3c:	0f 84 70 ff ff ff    	je     8029b2 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802a42:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802a46:	48 b8 82 51 80 00 00 	movabs $0x805182,%rax
+  802a4d:	00 00 00 
+  802a50:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802a52:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802a55:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802a5c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802a60:	ba 10 00 00 00       	mov    $0x10,%edx
+  802a65:	48 be 00 00 87 00 00 	movabs $0x870000,%rsi
+  802a6c:	00 00 00 
+  802a6f:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802a76:	00 00 00 
+  802a79:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802a7b:	4c 89 f7             	mov    %r14,%rdi
+  802a7e:	48 b8 d3 24 80 00 00 	movabs $0x8024d3,%rax
+  802a85:	00 00 00 
+  802a88:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802a8a:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802a91:	4c 89 f7             	mov    %r14,%rdi
+  802a94:	48 b8 45 52 80 00 00 	movabs $0x805245,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802aa0:	4c 89 f7             	mov    %r14,%rdi
+  802aa3:	48 b8 d3 51 80 00 00 	movabs $0x8051d3,%rax
+  802aaa:	00 00 00 
+  802aad:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802aaf:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802ab2:	41 83 fc 05          	cmp    $0x5,%r12d
+  802ab6:	75 04                	jne    802abc <fsipc+0x137>
+  802ab8:	85 db                	test   %ebx,%ebx
+  802aba:	79 14                	jns    802ad0 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802abc:	4c 89 f7             	mov    %r14,%rdi
+  802abf:	48 b8 fa 51 80 00 00 	movabs $0x8051fa,%rax
+  802ac6:	00 00 00 
+  802ac9:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802acb:	e9 4b ff ff ff       	jmp    802a1b <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802ad0:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802ad4:	ba 88 00 00 00       	mov    $0x88,%edx
+  802ad9:	48 bf 00 00 87 00 00 	movabs $0x870000,%rdi
+  802ae0:	00 00 00 
+  802ae3:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802aea:	00 00 00 
+  802aed:	ff d0                	call   *%rax
+  802aef:	eb cb                	jmp    802abc <fsipc+0x137>
+
+0000000000802af1 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802af1:	55                   	push   %rbp
+  802af2:	48 89 e5             	mov    %rsp,%rbp
+  802af5:	41 57                	push   %r15
+  802af7:	41 56                	push   %r14
+  802af9:	41 55                	push   %r13
+  802afb:	41 54                	push   %r12
+  802afd:	53                   	push   %rbx
+  802afe:	48 83 ec 18          	sub    $0x18,%rsp
+  802b02:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802b06:	49 89 f6             	mov    %rsi,%r14
+  802b09:	49 89 d4             	mov    %rdx,%r12
+  802b0c:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802b0f:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802b1b:	48 85 c0             	test   %rax,%rax
+  802b1e:	0f 85 96 00 00 00    	jne    802bba <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802b24:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b2b:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b2c:	49 bf 00 00 87 00 00 	movabs $0x870000,%r15
+  802b33:	00 00 00 
+    while (n) {
+  802b36:	4d 85 e4             	test   %r12,%r12
+  802b39:	74 79                	je     802bb4 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b3b:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802b40:	49 39 dc             	cmp    %rbx,%r12
+  802b43:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802b47:	48 89 da             	mov    %rbx,%rdx
+  802b4a:	4c 89 f6             	mov    %r14,%rsi
+  802b4d:	48 bf 00 10 87 00 00 	movabs $0x871000,%rdi
+  802b54:	00 00 00 
+  802b57:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b63:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b67:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b6a:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802b6d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b70:	44 01 e8             	add    %r13d,%eax
+  802b73:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802b77:	41 0f 44 c5          	cmove  %r13d,%eax
+  802b7b:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802b7f:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802b83:	48 89 da             	mov    %rbx,%rdx
+  802b86:	be 00 00 00 00       	mov    $0x0,%esi
+  802b8b:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b90:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+        if (res < 0)
+  802b9c:	85 c0                	test   %eax,%eax
+  802b9e:	78 4a                	js     802bea <devfile_write_direct+0xf9>
+        buf += res;
+  802ba0:	48 98                	cltq
+  802ba2:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802ba5:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802ba9:	49 29 c4             	sub    %rax,%r12
+  802bac:	75 8d                	jne    802b3b <devfile_write_direct+0x4a>
+    return write;
+  802bae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bb2:	eb 27                	jmp    802bdb <devfile_write_direct+0xea>
+    size_t write = 0;
+  802bb4:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802bb8:	eb f4                	jmp    802bae <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802bba:	45 89 e9             	mov    %r13d,%r9d
+  802bbd:	4d 89 e0             	mov    %r12,%r8
+  802bc0:	4c 89 f1             	mov    %r14,%rcx
+  802bc3:	ba 04 00 00 00       	mov    $0x4,%edx
+  802bc8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bcc:	48 89 c7             	mov    %rax,%rdi
+  802bcf:	48 b8 1e 25 80 00 00 	movabs $0x80251e,%rax
+  802bd6:	00 00 00 
+  802bd9:	ff d0                	call   *%rax
+}
+  802bdb:	48 83 c4 18          	add    $0x18,%rsp
+  802bdf:	5b                   	pop    %rbx
+  802be0:	41 5c                	pop    %r12
+  802be2:	41 5d                	pop    %r13
+  802be4:	41 5e                	pop    %r14
+  802be6:	41 5f                	pop    %r15
+  802be8:	5d                   	pop    %rbp
+  802be9:	c3                   	ret
+            return res;
+  802bea:	48 98                	cltq
+  802bec:	eb ed                	jmp    802bdb <devfile_write_direct+0xea>
+
+0000000000802bee <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802bee:	55                   	push   %rbp
+  802bef:	48 89 e5             	mov    %rsp,%rbp
+  802bf2:	41 54                	push   %r12
+  802bf4:	53                   	push   %rbx
+  802bf5:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802bf8:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802bff:	00 00 00 
+  802c02:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802c04:	48 85 c0             	test   %rax,%rax
+  802c07:	74 71                	je     802c7a <fbuf_flush+0x8c>
+  802c09:	48 89 c3             	mov    %rax,%rbx
+  802c0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c11:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802c15:	75 05                	jne    802c1c <fbuf_flush+0x2e>
+}
+  802c17:	5b                   	pop    %rbx
+  802c18:	41 5c                	pop    %r12
+  802c1a:	5d                   	pop    %rbp
+  802c1b:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802c1c:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802c1f:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802c23:	48 b8 00 23 86 00 00 	movabs $0x862300,%rax
+  802c2a:	00 00 00 
+  802c2d:	48 89 de             	mov    %rbx,%rsi
+  802c30:	48 29 c6             	sub    %rax,%rsi
+  802c33:	48 c1 fe 03          	sar    $0x3,%rsi
+  802c37:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c3e:	aa aa aa 
+  802c41:	48 0f af f0          	imul   %rax,%rsi
+  802c45:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802c49:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c4e:	48 01 c6             	add    %rax,%rsi
+  802c51:	4c 89 e7             	mov    %r12,%rdi
+  802c54:	48 b8 f1 2a 80 00 00 	movabs $0x802af1,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802c60:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802c64:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802c6b:	00 
+    return res < 0 ? res : 0;
+  802c6c:	48 85 c0             	test   %rax,%rax
+  802c6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c74:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802c78:	eb 9d                	jmp    802c17 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802c7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c7f:	eb 96                	jmp    802c17 <fbuf_flush+0x29>
+
+0000000000802c81 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802c81:	55                   	push   %rbp
+  802c82:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802c85:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  802c8c:	00 00 00 
+  802c8f:	ff d0                	call   *%rax
+}
+  802c91:	5d                   	pop    %rbp
+  802c92:	c3                   	ret
+
+0000000000802c93 <devfile_write>:
+    if (!fd || !buf)
+  802c93:	48 85 ff             	test   %rdi,%rdi
+  802c96:	0f 84 d3 01 00 00    	je     802e6f <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802c9c:	55                   	push   %rbp
+  802c9d:	48 89 e5             	mov    %rsp,%rbp
+  802ca0:	41 57                	push   %r15
+  802ca2:	41 56                	push   %r14
+  802ca4:	41 55                	push   %r13
+  802ca6:	41 54                	push   %r12
+  802ca8:	53                   	push   %rbx
+  802ca9:	48 83 ec 08          	sub    $0x8,%rsp
+  802cad:	49 89 fc             	mov    %rdi,%r12
+  802cb0:	49 89 f6             	mov    %rsi,%r14
+  802cb3:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802cb6:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802cbb:	48 85 f6             	test   %rsi,%rsi
+  802cbe:	0f 84 9c 01 00 00    	je     802e60 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802cc4:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802ccb:	00 00 00 
+  802cce:	ff d0                	call   *%rax
+  802cd0:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802cd3:	48 85 c0             	test   %rax,%rax
+  802cd6:	0f 84 a2 00 00 00    	je     802d7e <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802cdc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ce1:	4c 89 e7             	mov    %r12,%rdi
+  802ce4:	48 b8 12 16 80 00 00 	movabs $0x801612,%rax
+  802ceb:	00 00 00 
+  802cee:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802cf0:	83 f8 02             	cmp    $0x2,%eax
+  802cf3:	0f 8f 85 00 00 00    	jg     802d7e <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802cf9:	48 b8 00 23 86 00 00 	movabs $0x862300,%rax
+  802d00:	00 00 00 
+  802d03:	4d 89 ef             	mov    %r13,%r15
+  802d06:	49 29 c7             	sub    %rax,%r15
+  802d09:	49 c1 ff 03          	sar    $0x3,%r15
+  802d0d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802d14:	aa aa aa 
+  802d17:	4c 0f af f8          	imul   %rax,%r15
+  802d1b:	49 c1 e7 0e          	shl    $0xe,%r15
+  802d1f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d24:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802d27:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802d2c:	0f 84 d7 00 00 00    	je     802e09 <devfile_write+0x176>
+  802d32:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802d36:	89 c2                	mov    %eax,%edx
+  802d38:	41 03 55 0c          	add    0xc(%r13),%edx
+  802d3c:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802d41:	75 0f                	jne    802d52 <devfile_write+0xbf>
+  802d43:	48 01 d8             	add    %rbx,%rax
+  802d46:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802d4c:	0f 86 92 00 00 00    	jbe    802de4 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802d52:	4c 89 e7             	mov    %r12,%rdi
+  802d55:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+  802d61:	85 c0                	test   %eax,%eax
+  802d63:	78 52                	js     802db7 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d65:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d6c:	77 7f                	ja     802ded <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802d6e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802d73:	0f 85 c2 00 00 00    	jne    802e3b <devfile_write+0x1a8>
+  802d79:	e9 94 00 00 00       	jmp    802e12 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802d7e:	4c 89 e7             	mov    %r12,%rdi
+  802d81:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  802d88:	00 00 00 
+  802d8b:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d8d:	85 c0                	test   %eax,%eax
+  802d8f:	79 07                	jns    802d98 <devfile_write+0x105>
+  802d91:	48 98                	cltq
+  802d93:	e9 c8 00 00 00       	jmp    802e60 <devfile_write+0x1cd>
+  802d98:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d9d:	48 89 da             	mov    %rbx,%rdx
+  802da0:	4c 89 f6             	mov    %r14,%rsi
+  802da3:	4c 89 e7             	mov    %r12,%rdi
+  802da6:	48 b8 f1 2a 80 00 00 	movabs $0x802af1,%rax
+  802dad:	00 00 00 
+  802db0:	ff d0                	call   *%rax
+  802db2:	e9 a9 00 00 00       	jmp    802e60 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802db7:	48 98                	cltq
+  802db9:	e9 a2 00 00 00       	jmp    802e60 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dbe:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802dc3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802dc8:	4c 89 fe             	mov    %r15,%rsi
+  802dcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd0:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  802dd7:	00 00 00 
+  802dda:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802ddc:	85 c0                	test   %eax,%eax
+  802dde:	79 45                	jns    802e25 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802de0:	48 98                	cltq
+  802de2:	eb 7c                	jmp    802e60 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802de4:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802deb:	76 4e                	jbe    802e3b <devfile_write+0x1a8>
+  802ded:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802df2:	48 89 da             	mov    %rbx,%rdx
+  802df5:	4c 89 f6             	mov    %r14,%rsi
+  802df8:	4c 89 e7             	mov    %r12,%rdi
+  802dfb:	48 b8 f1 2a 80 00 00 	movabs $0x802af1,%rax
+  802e02:	00 00 00 
+  802e05:	ff d0                	call   *%rax
+  802e07:	eb 57                	jmp    802e60 <devfile_write+0x1cd>
+  802e09:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802e10:	77 db                	ja     802ded <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802e12:	4c 89 ff             	mov    %r15,%rdi
+  802e15:	48 b8 75 4d 80 00 00 	movabs $0x804d75,%rax
+  802e1c:	00 00 00 
+  802e1f:	ff d0                	call   *%rax
+  802e21:	84 c0                	test   %al,%al
+  802e23:	74 99                	je     802dbe <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802e25:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802e2a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e2f:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802e33:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802e3a:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802e3b:	4c 89 ff             	mov    %r15,%rdi
+  802e3e:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802e42:	48 89 da             	mov    %rbx,%rdx
+  802e45:	4c 89 f6             	mov    %r14,%rsi
+  802e48:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802e54:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802e58:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802e5d:	48 89 d8             	mov    %rbx,%rax
+}
+  802e60:	48 83 c4 08          	add    $0x8,%rsp
+  802e64:	5b                   	pop    %rbx
+  802e65:	41 5c                	pop    %r12
+  802e67:	41 5d                	pop    %r13
+  802e69:	41 5e                	pop    %r14
+  802e6b:	41 5f                	pop    %r15
+  802e6d:	5d                   	pop    %rbp
+  802e6e:	c3                   	ret
+        return E_INVAL;
+  802e6f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e74:	c3                   	ret
+
+0000000000802e75 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e75:	55                   	push   %rbp
+  802e76:	48 89 e5             	mov    %rsp,%rbp
+  802e79:	41 54                	push   %r12
+  802e7b:	53                   	push   %rbx
+  802e7c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802e7f:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  802e86:	00 00 00 
+  802e89:	ff d0                	call   *%rax
+  802e8b:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802e8e:	48 89 df             	mov    %rbx,%rdi
+  802e91:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802e98:	00 00 00 
+  802e9b:	ff d0                	call   *%rax
+  802e9d:	48 85 c0             	test   %rax,%rax
+  802ea0:	74 17                	je     802eb9 <devfile_flush+0x44>
+  802ea2:	48 89 df             	mov    %rbx,%rdi
+  802ea5:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  802eac:	00 00 00 
+  802eaf:	ff d0                	call   *%rax
+  802eb1:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802eb8:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802eb9:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ebc:	a3 00 00 87 00 00 00 	movabs %eax,0x870000
+  802ec3:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802eca:	be 00 00 00 00       	mov    $0x0,%esi
+  802ecf:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ed4:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  802edb:	00 00 00 
+  802ede:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802ee0:	45 85 e4             	test   %r12d,%r12d
+  802ee3:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ee7:	5b                   	pop    %rbx
+  802ee8:	41 5c                	pop    %r12
+  802eea:	5d                   	pop    %rbp
+  802eeb:	c3                   	ret
+
+0000000000802eec <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	41 57                	push   %r15
+  802ef2:	41 56                	push   %r14
+  802ef4:	41 55                	push   %r13
+  802ef6:	41 54                	push   %r12
+  802ef8:	53                   	push   %rbx
+  802ef9:	48 83 ec 38          	sub    $0x38,%rsp
+  802efd:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802f01:	49 89 f7             	mov    %rsi,%r15
+  802f04:	48 89 d3             	mov    %rdx,%rbx
+  802f07:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802f0a:	48 b8 37 24 80 00 00 	movabs $0x802437,%rax
+  802f11:	00 00 00 
+  802f14:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f16:	48 85 c0             	test   %rax,%rax
+  802f19:	75 20                	jne    802f3b <devfile_read_direct+0x4f>
+    bool map = 1;
+  802f1b:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802f20:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802f27:	00 
+    while (n) {
+  802f28:	48 85 db             	test   %rbx,%rbx
+  802f2b:	0f 85 df 00 00 00    	jne    803010 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802f31:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802f35:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f39:	eb 21                	jmp    802f5c <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f3b:	45 89 f1             	mov    %r14d,%r9d
+  802f3e:	49 89 d8             	mov    %rbx,%r8
+  802f41:	4c 89 f9             	mov    %r15,%rcx
+  802f44:	ba 03 00 00 00       	mov    $0x3,%edx
+  802f49:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f4d:	48 89 c7             	mov    %rax,%rdi
+  802f50:	48 b8 1e 25 80 00 00 	movabs $0x80251e,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+}
+  802f5c:	48 83 c4 38          	add    $0x38,%rsp
+  802f60:	5b                   	pop    %rbx
+  802f61:	41 5c                	pop    %r12
+  802f63:	41 5d                	pop    %r13
+  802f65:	41 5e                	pop    %r14
+  802f67:	41 5f                	pop    %r15
+  802f69:	5d                   	pop    %rbp
+  802f6a:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f6b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802f6f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f75:	75 1e                	jne    802f95 <devfile_read_direct+0xa9>
+  802f77:	e9 e2 00 00 00       	jmp    80305e <devfile_read_direct+0x172>
+            if (!res) return read;
+  802f7c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f80:	eb da                	jmp    802f5c <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802f82:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802f86:	0f 85 d0 01 00 00    	jne    80315c <devfile_read_direct+0x270>
+            map = 0;
+  802f8c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f90:	eb 03                	jmp    802f95 <devfile_read_direct+0xa9>
+  802f92:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802f95:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802f9a:	48 39 d3             	cmp    %rdx,%rbx
+  802f9d:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802fa1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802fa5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fa8:	48 b9 00 00 87 00 00 	movabs $0x870000,%rcx
+  802faf:	00 00 00 
+  802fb2:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802fb4:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802fb8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802fbc:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc1:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fc6:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+        if (res <= 0)
+  802fd2:	85 c0                	test   %eax,%eax
+  802fd4:	0f 8e 63 01 00 00    	jle    80313d <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802fda:	4c 63 e0             	movslq %eax,%r12
+  802fdd:	4c 89 e2             	mov    %r12,%rdx
+  802fe0:	48 be 00 10 87 00 00 	movabs $0x871000,%rsi
+  802fe7:	00 00 00 
+  802fea:	4c 89 ff             	mov    %r15,%rdi
+  802fed:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  802ff4:	00 00 00 
+  802ff7:	ff d0                	call   *%rax
+        buf += res;
+  802ff9:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802ffc:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802fff:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  803003:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  803007:	48 85 db             	test   %rbx,%rbx
+  80300a:	0f 84 25 ff ff ff    	je     802f35 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  803010:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  803013:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  803017:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80301b:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80301f:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  803026:	0f 97 c2             	seta   %dl
+  803029:	20 c2                	and    %al,%dl
+  80302b:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  80302e:	0f 84 5e ff ff ff    	je     802f92 <devfile_read_direct+0xa6>
+  803034:	4c 89 fa             	mov    %r15,%rdx
+  803037:	4d 89 fd             	mov    %r15,%r13
+  80303a:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  803041:	0f 85 4e ff ff ff    	jne    802f95 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  803047:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80304b:	0f 84 1a ff ff ff    	je     802f6b <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803051:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803058:	0f 85 37 ff ff ff    	jne    802f95 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  80305e:	48 89 d8             	mov    %rbx,%rax
+  803061:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803067:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  80306c:	48 39 c8             	cmp    %rcx,%rax
+  80306f:	48 0f 47 c1          	cmova  %rcx,%rax
+  803073:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  803077:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  80307b:	49 89 d4             	mov    %rdx,%r12
+  80307e:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  803082:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+  80308e:	a8 40                	test   $0x40,%al
+  803090:	0f 85 b9 00 00 00    	jne    80314f <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  803096:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80309d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030a1:	49 39 c5             	cmp    %rax,%r13
+  8030a4:	72 d8                	jb     80307e <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8030a6:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8030aa:	48 ba 00 00 87 00 00 	movabs $0x870000,%rdx
+  8030b1:	00 00 00 
+  8030b4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8030b8:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8030bb:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8030bd:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8030c1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8030c5:	48 b8 d2 22 80 00 00 	movabs $0x8022d2,%rax
+  8030cc:	00 00 00 
+  8030cf:	ff d0                	call   *%rax
+  8030d1:	89 c7                	mov    %eax,%edi
+  8030d3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8030d9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030de:	48 ba 00 00 87 00 00 	movabs $0x870000,%rdx
+  8030e5:	00 00 00 
+  8030e8:	be 0e 00 00 00       	mov    $0xe,%esi
+  8030ed:	48 b8 b2 58 80 00 00 	movabs $0x8058b2,%rax
+  8030f4:	00 00 00 
+  8030f7:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8030f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8030fe:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803102:	4c 89 fe             	mov    %r15,%rsi
+  803105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80310a:	48 b8 8e 58 80 00 00 	movabs $0x80588e,%rax
+  803111:	00 00 00 
+  803114:	ff d0                	call   *%rax
+  803116:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803119:	48 85 d2             	test   %rdx,%rdx
+  80311c:	0f 84 5a fe ff ff    	je     802f7c <devfile_read_direct+0x90>
+            if (res > 0) {
+  803122:	0f 8e 5a fe ff ff    	jle    802f82 <devfile_read_direct+0x96>
+                buf += res;
+  803128:	48 98                	cltq
+  80312a:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  80312d:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803130:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803134:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803138:	e9 ca fe ff ff       	jmp    803007 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  80313d:	41 89 c5             	mov    %eax,%r13d
+  803140:	48 98                	cltq
+  803142:	45 85 ed             	test   %r13d,%r13d
+  803145:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80314a:	e9 0d fe ff ff       	jmp    802f5c <devfile_read_direct+0x70>
+            map = 0;
+  80314f:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803153:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803157:	e9 39 fe ff ff       	jmp    802f95 <devfile_read_direct+0xa9>
+  80315c:	48 89 d0             	mov    %rdx,%rax
+  80315f:	e9 f8 fd ff ff       	jmp    802f5c <devfile_read_direct+0x70>
+
+0000000000803164 <devfile_read>:
+    if (!fd || !buf)
+  803164:	48 85 ff             	test   %rdi,%rdi
+  803167:	0f 84 21 02 00 00    	je     80338e <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80316d:	55                   	push   %rbp
+  80316e:	48 89 e5             	mov    %rsp,%rbp
+  803171:	41 57                	push   %r15
+  803173:	41 56                	push   %r14
+  803175:	41 55                	push   %r13
+  803177:	41 54                	push   %r12
+  803179:	53                   	push   %rbx
+  80317a:	48 83 ec 28          	sub    $0x28,%rsp
+  80317e:	48 89 fb             	mov    %rdi,%rbx
+  803181:	49 89 f4             	mov    %rsi,%r12
+  803184:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803187:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80318c:	48 85 f6             	test   %rsi,%rsi
+  80318f:	74 4b                	je     8031dc <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803191:	48 b8 a1 24 80 00 00 	movabs $0x8024a1,%rax
+  803198:	00 00 00 
+  80319b:	ff d0                	call   *%rax
+  80319d:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8031a0:	48 85 c0             	test   %rax,%rax
+  8031a3:	74 22                	je     8031c7 <devfile_read+0x63>
+  8031a5:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8031ac:	77 19                	ja     8031c7 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8031ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031b3:	48 89 df             	mov    %rbx,%rdi
+  8031b6:	48 b8 12 16 80 00 00 	movabs $0x801612,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8031c2:	83 f8 02             	cmp    $0x2,%eax
+  8031c5:	7e 40                	jle    803207 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8031c7:	48 89 df             	mov    %rbx,%rdi
+  8031ca:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8031d6:	85 c0                	test   %eax,%eax
+  8031d8:	79 11                	jns    8031eb <devfile_read+0x87>
+  8031da:	48 98                	cltq
+}
+  8031dc:	48 83 c4 28          	add    $0x28,%rsp
+  8031e0:	5b                   	pop    %rbx
+  8031e1:	41 5c                	pop    %r12
+  8031e3:	41 5d                	pop    %r13
+  8031e5:	41 5e                	pop    %r14
+  8031e7:	41 5f                	pop    %r15
+  8031e9:	5d                   	pop    %rbp
+  8031ea:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8031eb:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8031f0:	4c 89 ea             	mov    %r13,%rdx
+  8031f3:	4c 89 e6             	mov    %r12,%rsi
+  8031f6:	48 89 df             	mov    %rbx,%rdi
+  8031f9:	48 b8 ec 2e 80 00 00 	movabs $0x802eec,%rax
+  803200:	00 00 00 
+  803203:	ff d0                	call   *%rax
+  803205:	eb d5                	jmp    8031dc <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803207:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80320b:	48 89 df             	mov    %rbx,%rdi
+  80320e:	48 b8 ee 2b 80 00 00 	movabs $0x802bee,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	0f 88 33 01 00 00    	js     803355 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803222:	48 ba 00 23 86 00 00 	movabs $0x862300,%rdx
+  803229:	00 00 00 
+  80322c:	4c 89 f0             	mov    %r14,%rax
+  80322f:	48 29 d0             	sub    %rdx,%rax
+  803232:	48 c1 f8 03          	sar    $0x3,%rax
+  803236:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80323d:	aa aa aa 
+  803240:	48 0f af c2          	imul   %rdx,%rax
+  803244:	48 c1 e0 0e          	shl    $0xe,%rax
+  803248:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80324c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80324f:	41 39 06             	cmp    %eax,(%r14)
+  803252:	75 0d                	jne    803261 <devfile_read+0xfd>
+  803254:	8b 43 10             	mov    0x10(%rbx),%eax
+  803257:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80325b:	0f 84 fb 00 00 00    	je     80335c <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803261:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803266:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80326a:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80326d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803271:	48 89 c7             	mov    %rax,%rdi
+  803274:	48 b8 75 4d 80 00 00 	movabs $0x804d75,%rax
+  80327b:	00 00 00 
+  80327e:	ff d0                	call   *%rax
+  803280:	84 c0                	test   %al,%al
+  803282:	75 27                	jne    8032ab <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803284:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803289:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80328e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803292:	bf 00 00 00 00       	mov    $0x0,%edi
+  803297:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  80329e:	00 00 00 
+  8032a1:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8032a3:	85 c0                	test   %eax,%eax
+  8032a5:	0f 88 dc 00 00 00    	js     803387 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8032ab:	44 89 f8             	mov    %r15d,%eax
+  8032ae:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8032b3:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8032b5:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8032bc:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8032bd:	8b 43 10             	mov    0x10(%rbx),%eax
+  8032c0:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8032c4:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8032c7:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8032cc:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032d0:	48 89 df             	mov    %rbx,%rdi
+  8032d3:	48 b8 ec 2e 80 00 00 	movabs $0x802eec,%rax
+  8032da:	00 00 00 
+  8032dd:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8032df:	48 85 c0             	test   %rax,%rax
+  8032e2:	0f 88 f4 fe ff ff    	js     8031dc <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8032e8:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8032eb:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8032ee:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8032f1:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8032f5:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8032f9:	48 63 d1             	movslq %ecx,%rdx
+  8032fc:	48 01 d0             	add    %rdx,%rax
+  8032ff:	4d 63 ff             	movslq %r15d,%r15
+  803302:	4c 29 f8             	sub    %r15,%rax
+  803305:	ba 00 00 00 00       	mov    $0x0,%edx
+  80330a:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80330e:	48 85 c0             	test   %rax,%rax
+  803311:	0f 8e c5 fe ff ff    	jle    8031dc <devfile_read+0x78>
+    n = MIN(n, res);
+  803317:	4c 39 e8             	cmp    %r13,%rax
+  80331a:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80331e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803321:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803325:	48 63 f6             	movslq %esi,%rsi
+  803328:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80332d:	48 01 c6             	add    %rax,%rsi
+  803330:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803334:	48 01 c6             	add    %rax,%rsi
+  803337:	4c 89 ea             	mov    %r13,%rdx
+  80333a:	4c 89 e7             	mov    %r12,%rdi
+  80333d:	48 b8 4f 13 80 00 00 	movabs $0x80134f,%rax
+  803344:	00 00 00 
+  803347:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803349:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80334d:	4c 89 e8             	mov    %r13,%rax
+  803350:	e9 87 fe ff ff       	jmp    8031dc <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803355:	48 98                	cltq
+  803357:	e9 80 fe ff ff       	jmp    8031dc <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80335c:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803360:	41 39 d7             	cmp    %edx,%r15d
+  803363:	0f 8c f8 fe ff ff    	jl     803261 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803369:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80336d:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803370:	41 39 cf             	cmp    %ecx,%r15d
+  803373:	0f 8d e8 fe ff ff    	jge    803261 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803379:	4d 63 ff             	movslq %r15d,%r15
+  80337c:	4c 29 f8             	sub    %r15,%rax
+  80337f:	48 63 d2             	movslq %edx,%rdx
+  803382:	48 01 d0             	add    %rdx,%rax
+  803385:	eb 87                	jmp    80330e <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803387:	48 98                	cltq
+  803389:	e9 4e fe ff ff       	jmp    8031dc <devfile_read+0x78>
+        return E_INVAL;
+  80338e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803393:	c3                   	ret
+
+0000000000803394 <fs_channel>:
+fs_channel(bool enable) {
+  803394:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803396:	a2 04 26 86 00 00 00 	movabs %al,0x862604
+  80339d:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  80339f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a4:	40 84 ff             	test   %dil,%dil
+  8033a7:	74 47                	je     8033f0 <fs_channel+0x5c>
+  8033a9:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  8033b0:	00 00 00 
+  8033b3:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8033b9:	48 b8 00 26 86 00 00 	movabs $0x862600,%rax
+  8033c0:	00 00 00 
+  8033c3:	3b 08                	cmp    (%rax),%ecx
+  8033c5:	74 29                	je     8033f0 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8033c7:	55                   	push   %rbp
+  8033c8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8033cb:	48 b8 14 23 80 00 00 	movabs $0x802314,%rax
+  8033d2:	00 00 00 
+  8033d5:	ff d0                	call   *%rax
+  8033d7:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8033d9:	85 c0                	test   %eax,%eax
+  8033db:	78 04                	js     8033e1 <fs_channel+0x4d>
+}
+  8033dd:	89 d0                	mov    %edx,%eax
+  8033df:	5d                   	pop    %rbp
+  8033e0:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8033e1:	48 b8 04 26 86 00 00 	movabs $0x862604,%rax
+  8033e8:	00 00 00 
+  8033eb:	c6 00 00             	movb   $0x0,(%rax)
+  8033ee:	eb ed                	jmp    8033dd <fs_channel+0x49>
+}
+  8033f0:	89 d0                	mov    %edx,%eax
+  8033f2:	c3                   	ret
+
+00000000008033f3 <open>:
+open(const char *path, int mode) {
+  8033f3:	55                   	push   %rbp
+  8033f4:	48 89 e5             	mov    %rsp,%rbp
+  8033f7:	41 55                	push   %r13
+  8033f9:	41 54                	push   %r12
+  8033fb:	53                   	push   %rbx
+  8033fc:	48 83 ec 18          	sub    $0x18,%rsp
+  803400:	49 89 fc             	mov    %rdi,%r12
+  803403:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803406:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+  803412:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803418:	0f 87 8f 00 00 00    	ja     8034ad <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80341e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803422:	48 b8 ce 1b 80 00 00 	movabs $0x801bce,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+  80342e:	89 c3                	mov    %eax,%ebx
+  803430:	85 c0                	test   %eax,%eax
+  803432:	78 55                	js     803489 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803434:	4c 89 e6             	mov    %r12,%rsi
+  803437:	48 bb 00 00 87 00 00 	movabs $0x870000,%rbx
+  80343e:	00 00 00 
+  803441:	48 89 df             	mov    %rbx,%rdi
+  803444:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803450:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803457:	ba 00 00 00 00       	mov    $0x0,%edx
+  80345c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803460:	bf 01 00 00 00       	mov    $0x1,%edi
+  803465:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  80346c:	00 00 00 
+  80346f:	ff d0                	call   *%rax
+  803471:	89 c3                	mov    %eax,%ebx
+  803473:	85 c0                	test   %eax,%eax
+  803475:	78 1f                	js     803496 <open+0xa3>
+    return fd2num(fd);
+  803477:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80347b:	48 b8 a0 1b 80 00 00 	movabs $0x801ba0,%rax
+  803482:	00 00 00 
+  803485:	ff d0                	call   *%rax
+  803487:	89 c3                	mov    %eax,%ebx
+}
+  803489:	89 d8                	mov    %ebx,%eax
+  80348b:	48 83 c4 18          	add    $0x18,%rsp
+  80348f:	5b                   	pop    %rbx
+  803490:	41 5c                	pop    %r12
+  803492:	41 5d                	pop    %r13
+  803494:	5d                   	pop    %rbp
+  803495:	c3                   	ret
+        fd_close(fd, 0);
+  803496:	be 00 00 00 00       	mov    $0x0,%esi
+  80349b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80349f:	48 b8 e9 1c 80 00 00 	movabs $0x801ce9,%rax
+  8034a6:	00 00 00 
+  8034a9:	ff d0                	call   *%rax
+        return res;
+  8034ab:	eb dc                	jmp    803489 <open+0x96>
+        return -E_BAD_PATH;
+  8034ad:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8034b2:	eb d5                	jmp    803489 <open+0x96>
+
+00000000008034b4 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8034b4:	55                   	push   %rbp
+  8034b5:	48 89 e5             	mov    %rsp,%rbp
+  8034b8:	41 56                	push   %r14
+  8034ba:	41 55                	push   %r13
+  8034bc:	41 54                	push   %r12
+  8034be:	53                   	push   %rbx
+  8034bf:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8034c3:	49 bc 08 23 86 00 00 	movabs $0x862308,%r12
+  8034ca:	00 00 00 
+  8034cd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8034d2:	49 bd 2e 1c 80 00 00 	movabs $0x801c2e,%r13
+  8034d9:	00 00 00 
+  8034dc:	49 be ee 2b 80 00 00 	movabs $0x802bee,%r14
+  8034e3:	00 00 00 
+  8034e6:	eb 0c                	jmp    8034f4 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8034e8:	83 c3 01             	add    $0x1,%ebx
+  8034eb:	49 83 c4 18          	add    $0x18,%r12
+  8034ef:	83 fb 20             	cmp    $0x20,%ebx
+  8034f2:	74 1d                	je     803511 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8034f4:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8034f9:	74 ed                	je     8034e8 <file_flush_buffers+0x34>
+  8034fb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8034ff:	89 df                	mov    %ebx,%edi
+  803501:	41 ff d5             	call   *%r13
+  803504:	85 c0                	test   %eax,%eax
+  803506:	78 e0                	js     8034e8 <file_flush_buffers+0x34>
+  803508:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80350c:	41 ff d6             	call   *%r14
+  80350f:	eb d7                	jmp    8034e8 <file_flush_buffers+0x34>
+}
+  803511:	48 83 c4 10          	add    $0x10,%rsp
+  803515:	5b                   	pop    %rbx
+  803516:	41 5c                	pop    %r12
+  803518:	41 5d                	pop    %r13
+  80351a:	41 5e                	pop    %r14
+  80351c:	5d                   	pop    %rbp
+  80351d:	c3                   	ret
+
+000000000080351e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80351e:	55                   	push   %rbp
+  80351f:	48 89 e5             	mov    %rsp,%rbp
+  803522:	41 54                	push   %r12
+  803524:	53                   	push   %rbx
+  803525:	49 89 fc             	mov    %rdi,%r12
+  803528:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80352a:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803531:	00 00 00 
+  803534:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803536:	48 b8 00 00 87 00 00 	movabs $0x870000,%rax
+  80353d:	00 00 00 
+  803540:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803545:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803547:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80354a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354f:	be 00 00 00 00       	mov    $0x0,%esi
+  803554:	bf 02 00 00 00       	mov    $0x2,%edi
+  803559:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  803560:	00 00 00 
+  803563:	ff d0                	call   *%rax
+}
+  803565:	5b                   	pop    %rbx
+  803566:	41 5c                	pop    %r12
+  803568:	5d                   	pop    %rbp
+  803569:	c3                   	ret
+
+000000000080356a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80356a:	55                   	push   %rbp
+  80356b:	48 89 e5             	mov    %rsp,%rbp
+  80356e:	41 54                	push   %r12
+  803570:	53                   	push   %rbx
+  803571:	49 89 fc             	mov    %rdi,%r12
+  803574:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803577:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  80357e:	00 00 00 
+  803581:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803583:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803588:	a3 00 00 87 00 00 00 	movabs %eax,0x870000
+  80358f:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803591:	ba 00 00 00 00       	mov    $0x0,%edx
+  803596:	be 00 00 00 00       	mov    $0x0,%esi
+  80359b:	bf 05 00 00 00       	mov    $0x5,%edi
+  8035a0:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  8035a7:	00 00 00 
+  8035aa:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035ac:	85 c0                	test   %eax,%eax
+  8035ae:	78 3d                	js     8035ed <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8035b0:	49 bc 00 00 87 00 00 	movabs $0x870000,%r12
+  8035b7:	00 00 00 
+  8035ba:	4c 89 e6             	mov    %r12,%rsi
+  8035bd:	48 89 df             	mov    %rbx,%rdi
+  8035c0:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  8035c7:	00 00 00 
+  8035ca:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8035cc:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8035d3:	00 
+  8035d4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8035da:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8035e1:	00 
+  8035e2:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8035e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ed:	5b                   	pop    %rbx
+  8035ee:	41 5c                	pop    %r12
+  8035f0:	5d                   	pop    %rbp
+  8035f1:	c3                   	ret
+
+00000000008035f2 <remove>:
+remove(const char *path) {
+  8035f2:	55                   	push   %rbp
+  8035f3:	48 89 e5             	mov    %rsp,%rbp
+  8035f6:	53                   	push   %rbx
+  8035f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8035fb:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8035fe:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  803605:	00 00 00 
+  803608:	ff d0                	call   *%rax
+  80360a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803610:	77 3a                	ja     80364c <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803612:	48 89 de             	mov    %rbx,%rsi
+  803615:	48 bf 00 00 87 00 00 	movabs $0x870000,%rdi
+  80361c:	00 00 00 
+  80361f:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80362b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803630:	be 00 00 00 00       	mov    $0x0,%esi
+  803635:	bf 07 00 00 00       	mov    $0x7,%edi
+  80363a:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+}
+  803646:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80364a:	c9                   	leave
+  80364b:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80364c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803651:	eb f3                	jmp    803646 <remove+0x54>
+
+0000000000803653 <sync>:
+sync(void) {
+  803653:	55                   	push   %rbp
+  803654:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803657:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  80365e:	00 00 00 
+  803661:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803663:	ba 00 00 00 00       	mov    $0x0,%edx
+  803668:	be 00 00 00 00       	mov    $0x0,%esi
+  80366d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803672:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  803679:	00 00 00 
+  80367c:	ff d0                	call   *%rax
+}
+  80367e:	5d                   	pop    %rbp
+  80367f:	c3                   	ret
+
+0000000000803680 <fsync>:
+fsync(int fdnum) {
+  803680:	55                   	push   %rbp
+  803681:	48 89 e5             	mov    %rsp,%rbp
+  803684:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803688:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80368c:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  803693:	00 00 00 
+  803696:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803698:	85 c0                	test   %eax,%eax
+  80369a:	78 4b                	js     8036e7 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80369c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036a0:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8036a7:	00 00 00 
+  8036aa:	8b 00                	mov    (%rax),%eax
+  8036ac:	39 02                	cmp    %eax,(%rdx)
+  8036ae:	75 39                	jne    8036e9 <fsync+0x69>
+    file_flush_buffers();
+  8036b0:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8036bc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036c0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8036c3:	a3 00 00 87 00 00 00 	movabs %eax,0x870000
+  8036ca:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8036cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8036db:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  8036e2:	00 00 00 
+  8036e5:	ff d0                	call   *%rax
+}
+  8036e7:	c9                   	leave
+  8036e8:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036e9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036ee:	eb f7                	jmp    8036e7 <fsync+0x67>
+
+00000000008036f0 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8036f0:	55                   	push   %rbp
+  8036f1:	48 89 e5             	mov    %rsp,%rbp
+  8036f4:	53                   	push   %rbx
+  8036f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8036f9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8036fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803701:	be 00 00 00 00       	mov    $0x0,%esi
+  803706:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80370b:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  803712:	00 00 00 
+  803715:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803717:	85 c0                	test   %eax,%eax
+  803719:	78 2d                	js     803748 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80371b:	48 b8 00 00 87 00 00 	movabs $0x870000,%rax
+  803722:	00 00 00 
+  803725:	48 8b 10             	mov    (%rax),%rdx
+  803728:	48 89 13             	mov    %rdx,(%rbx)
+  80372b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80372f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803733:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803737:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80373b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80373f:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803743:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803748:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80374c:	c9                   	leave
+  80374d:	c3                   	ret
+
+000000000080374e <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80374e:	55                   	push   %rbp
+  80374f:	48 89 e5             	mov    %rsp,%rbp
+  803752:	53                   	push   %rbx
+  803753:	48 83 ec 08          	sub    $0x8,%rsp
+  803757:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80375a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80375f:	be 00 00 00 00       	mov    $0x0,%esi
+  803764:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803769:	48 b8 85 29 80 00 00 	movabs $0x802985,%rax
+  803770:	00 00 00 
+  803773:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803775:	85 c0                	test   %eax,%eax
+  803777:	78 3d                	js     8037b6 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803779:	48 b8 00 00 87 00 00 	movabs $0x870000,%rax
+  803780:	00 00 00 
+  803783:	48 8b 10             	mov    (%rax),%rdx
+  803786:	48 89 13             	mov    %rdx,(%rbx)
+  803789:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80378d:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803791:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803795:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803799:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80379d:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8037a1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037a5:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8037a9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8037ad:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8037b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037b6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037ba:	c9                   	leave
+  8037bb:	c3                   	ret
+
+00000000008037bc <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8037bc:	55                   	push   %rbp
+  8037bd:	48 89 e5             	mov    %rsp,%rbp
+  8037c0:	41 57                	push   %r15
+  8037c2:	41 56                	push   %r14
+  8037c4:	41 55                	push   %r13
+  8037c6:	41 54                	push   %r12
+  8037c8:	53                   	push   %rbx
+  8037c9:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8037cd:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8037d4:	00 
+  8037d5:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8037dc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8037e2:	0f 85 43 01 00 00    	jne    80392b <munmap+0x16f>
+  8037e8:	49 89 ff             	mov    %rdi,%r15
+  8037eb:	4c 39 f7             	cmp    %r14,%rdi
+  8037ee:	0f 87 37 01 00 00    	ja     80392b <munmap+0x16f>
+  8037f4:	48 bb 00 20 86 00 00 	movabs $0x862000,%rbx
+  8037fb:	00 00 00 
+  8037fe:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803804:	eb 2c                	jmp    803832 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803806:	4c 39 f8             	cmp    %r15,%rax
+  803809:	0f 83 85 00 00 00    	jae    803894 <munmap+0xd8>
+            m->mm_end = start;
+  80380f:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803814:	48 83 c3 18          	add    $0x18,%rbx
+  803818:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80381f:	48 b8 00 23 86 00 00 	movabs $0x862300,%rax
+  803826:	00 00 00 
+  803829:	48 39 c3             	cmp    %rax,%rbx
+  80382c:	0f 84 d0 00 00 00    	je     803902 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803832:	49 89 dc             	mov    %rbx,%r12
+  803835:	48 8b 03             	mov    (%rbx),%rax
+  803838:	4c 39 f0             	cmp    %r14,%rax
+  80383b:	73 d7                	jae    803814 <munmap+0x58>
+  80383d:	48 85 c0             	test   %rax,%rax
+  803840:	74 d2                	je     803814 <munmap+0x58>
+  803842:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803846:	49 39 d7             	cmp    %rdx,%r15
+  803849:	73 c9                	jae    803814 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80384b:	49 39 d6             	cmp    %rdx,%r14
+  80384e:	73 b6                	jae    803806 <munmap+0x4a>
+  803850:	49 39 c7             	cmp    %rax,%r15
+  803853:	76 b1                	jbe    803806 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803855:	4c 89 ef             	mov    %r13,%rdi
+  803858:	48 b8 f3 28 80 00 00 	movabs $0x8028f3,%rax
+  80385f:	00 00 00 
+  803862:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803864:	48 85 c0             	test   %rax,%rax
+  803867:	0f 84 c5 00 00 00    	je     803932 <munmap+0x176>
+            *tail = *m;
+  80386d:	48 8b 13             	mov    (%rbx),%rdx
+  803870:	48 89 10             	mov    %rdx,(%rax)
+  803873:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803877:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80387b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80387f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803883:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803886:	44 89 f2             	mov    %r14d,%edx
+  803889:	2b 13                	sub    (%rbx),%edx
+  80388b:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80388e:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803892:	eb 80                	jmp    803814 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803894:	49 39 d6             	cmp    %rdx,%r14
+  803897:	73 18                	jae    8038b1 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803899:	44 89 f2             	mov    %r14d,%edx
+  80389c:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8038a1:	29 c2                	sub    %eax,%edx
+  8038a3:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8038a8:	4d 89 34 24          	mov    %r14,(%r12)
+  8038ac:	e9 63 ff ff ff       	jmp    803814 <munmap+0x58>
+    m->mm_start = 0;
+  8038b1:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8038b8:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8038b9:	4c 89 e6             	mov    %r12,%rsi
+  8038bc:	48 b8 00 20 86 00 00 	movabs $0x862000,%rax
+  8038c3:	00 00 00 
+  8038c6:	48 29 c6             	sub    %rax,%rsi
+  8038c9:	48 c1 fe 03          	sar    $0x3,%rsi
+  8038cd:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8038d4:	aa aa aa 
+  8038d7:	48 0f af f0          	imul   %rax,%rsi
+  8038db:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8038df:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8038e4:	48 01 c6             	add    %rax,%rsi
+  8038e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f1:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  8038f8:	00 00 00 
+  8038fb:	ff d0                	call   *%rax
+}
+  8038fd:	e9 12 ff ff ff       	jmp    803814 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803902:	4c 89 f2             	mov    %r14,%rdx
+  803905:	4c 29 fa             	sub    %r15,%rdx
+  803908:	4c 89 fe             	mov    %r15,%rsi
+  80390b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803910:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	48 83 c4 08          	add    $0x8,%rsp
+  803920:	5b                   	pop    %rbx
+  803921:	41 5c                	pop    %r12
+  803923:	41 5d                	pop    %r13
+  803925:	41 5e                	pop    %r14
+  803927:	41 5f                	pop    %r15
+  803929:	5d                   	pop    %rbp
+  80392a:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80392b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803930:	eb ea                	jmp    80391c <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803932:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803937:	eb e3                	jmp    80391c <munmap+0x160>
+
+0000000000803939 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803939:	55                   	push   %rbp
+  80393a:	48 89 e5             	mov    %rsp,%rbp
+  80393d:	41 57                	push   %r15
+  80393f:	41 56                	push   %r14
+  803941:	41 55                	push   %r13
+  803943:	41 54                	push   %r12
+  803945:	53                   	push   %rbx
+  803946:	48 83 ec 28          	sub    $0x28,%rsp
+  80394a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80394e:	49 89 f5             	mov    %rsi,%r13
+  803951:	41 89 d6             	mov    %edx,%r14d
+  803954:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803957:	41 89 cc             	mov    %ecx,%r12d
+  80395a:	44 89 c7             	mov    %r8d,%edi
+  80395d:	44 89 cb             	mov    %r9d,%ebx
+  803960:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803964:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803968:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  80396f:	00 00 00 
+  803972:	ff d0                	call   *%rax
+  803974:	41 89 c7             	mov    %eax,%r15d
+  803977:	85 c0                	test   %eax,%eax
+  803979:	0f 88 ae 01 00 00    	js     803b2d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80397f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803983:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80398a:	00 00 00 
+  80398d:	8b 32                	mov    (%rdx),%esi
+  80398f:	39 30                	cmp    %esi,(%rax)
+  803991:	0f 85 7a 02 00 00    	jne    803c11 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803997:	8b 40 08             	mov    0x8(%rax),%eax
+  80399a:	83 e0 03             	and    $0x3,%eax
+  80399d:	83 f8 01             	cmp    $0x1,%eax
+  8039a0:	0f 84 76 02 00 00    	je     803c1c <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039a6:	4d 85 ed             	test   %r13,%r13
+  8039a9:	0f 84 78 02 00 00    	je     803c27 <mmap+0x2ee>
+  8039af:	85 db                	test   %ebx,%ebx
+  8039b1:	0f 88 70 02 00 00    	js     803c27 <mmap+0x2ee>
+  8039b7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8039bd:	41 89 df             	mov    %ebx,%r15d
+  8039c0:	0f 85 6c 02 00 00    	jne    803c32 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8039c6:	44 89 f0             	mov    %r14d,%eax
+  8039c9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039cc:	83 f8 04             	cmp    $0x4,%eax
+  8039cf:	0f 85 68 02 00 00    	jne    803c3d <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8039d5:	44 89 e1             	mov    %r12d,%ecx
+  8039d8:	83 e1 01             	and    $0x1,%ecx
+  8039db:	0f 95 c2             	setne  %dl
+  8039de:	44 89 e0             	mov    %r12d,%eax
+  8039e1:	d1 e8                	shr    %eax
+  8039e3:	83 f0 01             	xor    $0x1,%eax
+  8039e6:	83 e0 01             	and    $0x1,%eax
+  8039e9:	38 c2                	cmp    %al,%dl
+  8039eb:	0f 85 57 02 00 00    	jne    803c48 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8039f1:	85 c9                	test   %ecx,%ecx
+  8039f3:	74 0a                	je     8039ff <mmap+0xc6>
+  8039f5:	41 f6 c6 02          	test   $0x2,%r14b
+  8039f9:	0f 85 54 02 00 00    	jne    803c53 <mmap+0x31a>
+    file_flush_buffers();
+  8039ff:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803a06:	00 00 00 
+  803a09:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803a0b:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803a12:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803a19:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a1d:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803a20:	41 f6 c4 04          	test   $0x4,%r12b
+  803a24:	0f 84 15 01 00 00    	je     803b3f <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803a2a:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a2d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803a33:	0f 85 25 02 00 00    	jne    803c5e <mmap+0x325>
+  803a39:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803a3d:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803a44:	00 00 00 
+  803a47:	48 39 c2             	cmp    %rax,%rdx
+  803a4a:	0f 82 19 02 00 00    	jb     803c69 <mmap+0x330>
+  803a50:	48 39 c7             	cmp    %rax,%rdi
+  803a53:	0f 87 10 02 00 00    	ja     803c69 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a59:	4c 89 ee             	mov    %r13,%rsi
+  803a5c:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803a63:	00 00 00 
+  803a66:	ff d0                	call   *%rax
+  803a68:	85 c0                	test   %eax,%eax
+  803a6a:	0f 88 04 02 00 00    	js     803c74 <mmap+0x33b>
+    if (!handler) {
+  803a70:	48 b8 00 00 86 00 00 	movabs $0x860000,%rax
+  803a77:	00 00 00 
+  803a7a:	80 38 00             	cmpb   $0x0,(%rax)
+  803a7d:	75 2b                	jne    803aaa <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a7f:	48 bf 54 28 80 00 00 	movabs $0x802854,%rdi
+  803a86:	00 00 00 
+  803a89:	48 b8 5d 55 80 00 00 	movabs $0x80555d,%rax
+  803a90:	00 00 00 
+  803a93:	ff d0                	call   *%rax
+  803a95:	85 c0                	test   %eax,%eax
+  803a97:	0f 88 ea 01 00 00    	js     803c87 <mmap+0x34e>
+        handler = 1;
+  803a9d:	48 b8 00 00 86 00 00 	movabs $0x860000,%rax
+  803aa4:	00 00 00 
+  803aa7:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803aaa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aae:	48 b8 f3 28 80 00 00 	movabs $0x8028f3,%rax
+  803ab5:	00 00 00 
+  803ab8:	ff d0                	call   *%rax
+  803aba:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803abd:	48 85 c0             	test   %rax,%rax
+  803ac0:	0f 84 c9 01 00 00    	je     803c8f <mmap+0x356>
+    m->mm_start = va;
+  803ac6:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803ac9:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803acd:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803ad1:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803ad4:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803ad8:	44 89 e0             	mov    %r12d,%eax
+  803adb:	c1 e0 06             	shl    $0x6,%eax
+  803ade:	25 80 00 00 00       	and    $0x80,%eax
+  803ae3:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803ae6:	09 f0                	or     %esi,%eax
+  803ae8:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803aec:	41 f6 c4 08          	test   $0x8,%r12b
+  803af0:	74 31                	je     803b23 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803af2:	48 39 d3             	cmp    %rdx,%rbx
+  803af5:	73 2c                	jae    803b23 <mmap+0x1ea>
+  803af7:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803afc:	48 89 de             	mov    %rbx,%rsi
+  803aff:	4c 89 f7             	mov    %r14,%rdi
+  803b02:	48 b8 43 27 80 00 00 	movabs $0x802743,%rax
+  803b09:	00 00 00 
+  803b0c:	ff d0                	call   *%rax
+  803b0e:	49 89 c4             	mov    %rax,%r12
+  803b11:	48 85 c0             	test   %rax,%rax
+  803b14:	0f 8e d7 00 00 00    	jle    803bf1 <mmap+0x2b8>
+            va += n;
+  803b1a:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803b1d:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803b21:	72 d4                	jb     803af7 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803b23:	49 8b 06             	mov    (%r14),%rax
+  803b26:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803b2a:	48 89 06             	mov    %rax,(%rsi)
+}
+  803b2d:	44 89 f8             	mov    %r15d,%eax
+  803b30:	48 83 c4 28          	add    $0x28,%rsp
+  803b34:	5b                   	pop    %rbx
+  803b35:	41 5c                	pop    %r12
+  803b37:	41 5d                	pop    %r13
+  803b39:	41 5e                	pop    %r14
+  803b3b:	41 5f                	pop    %r15
+  803b3d:	5d                   	pop    %rbp
+  803b3e:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b3f:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803b46:	00 00 00 
+  803b49:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803b4c:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803b53:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b56:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803b5b:	48 be 00 20 86 00 00 	movabs $0x862000,%rsi
+  803b62:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b65:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803b6c:	00 00 00 
+  803b6f:	48 39 d7             	cmp    %rdx,%rdi
+  803b72:	73 1c                	jae    803b90 <mmap+0x257>
+        return -E_NO_MEM;
+  803b74:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b7a:	eb b1                	jmp    803b2d <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b7c:	48 83 c0 01          	add    $0x1,%rax
+  803b80:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803b84:	77 3f                	ja     803bc5 <mmap+0x28c>
+  803b86:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803b8b:	48 39 d7             	cmp    %rdx,%rdi
+  803b8e:	72 2a                	jb     803bba <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803b90:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803b94:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803b98:	48 39 d1             	cmp    %rdx,%rcx
+  803b9b:	73 df                	jae    803b7c <mmap+0x243>
+  803b9d:	48 85 c9             	test   %rcx,%rcx
+  803ba0:	74 da                	je     803b7c <mmap+0x243>
+  803ba2:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803ba6:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803bab:	48 39 d3             	cmp    %rdx,%rbx
+  803bae:	73 cc                	jae    803b7c <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803bb0:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bb8:	eb cc                	jmp    803b86 <mmap+0x24d>
+        return -E_NO_MEM;
+  803bba:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803bc0:	e9 68 ff ff ff       	jmp    803b2d <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803bc5:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803bca:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803bd1:	00 00 00 
+  803bd4:	48 39 c2             	cmp    %rax,%rdx
+  803bd7:	0f 82 9f 00 00 00    	jb     803c7c <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803bdd:	48 85 db             	test   %rbx,%rbx
+  803be0:	0f 85 8a fe ff ff    	jne    803a70 <mmap+0x137>
+        return -E_NO_MEM;
+  803be6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803bec:	e9 3c ff ff ff       	jmp    803b2d <mmap+0x1f4>
+        if (n < 0) {
+  803bf1:	0f 89 2c ff ff ff    	jns    803b23 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803bf7:	49 8b 3e             	mov    (%r14),%rdi
+  803bfa:	4c 89 ee             	mov    %r13,%rsi
+  803bfd:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  803c04:	00 00 00 
+  803c07:	ff d0                	call   *%rax
+            return n;
+  803c09:	45 89 e7             	mov    %r12d,%r15d
+  803c0c:	e9 1c ff ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803c11:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c17:	e9 11 ff ff ff       	jmp    803b2d <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803c1c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c22:	e9 06 ff ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803c27:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c2d:	e9 fb fe ff ff       	jmp    803b2d <mmap+0x1f4>
+  803c32:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c38:	e9 f0 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803c3d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c43:	e9 e5 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803c48:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c4e:	e9 da fe ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803c53:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803c59:	e9 cf fe ff ff       	jmp    803b2d <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803c5e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c64:	e9 c4 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+  803c69:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c6f:	e9 b9 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803c74:	41 89 c7             	mov    %eax,%r15d
+  803c77:	e9 b1 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+        return -E_NO_MEM;
+  803c7c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c82:	e9 a6 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803c87:	41 89 c7             	mov    %eax,%r15d
+  803c8a:	e9 9e fe ff ff       	jmp    803b2d <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803c8f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c95:	e9 93 fe ff ff       	jmp    803b2d <mmap+0x1f4>
+
+0000000000803c9a <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803c9a:	55                   	push   %rbp
+  803c9b:	48 89 e5             	mov    %rsp,%rbp
+  803c9e:	41 55                	push   %r13
+  803ca0:	41 54                	push   %r12
+  803ca2:	53                   	push   %rbx
+  803ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  803ca7:	48 89 fb             	mov    %rdi,%rbx
+  803caa:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803cad:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803cb0:	48 b8 16 4d 80 00 00 	movabs $0x804d16,%rax
+  803cb7:	00 00 00 
+  803cba:	ff d0                	call   *%rax
+  803cbc:	41 89 c1             	mov    %eax,%r9d
+  803cbf:	4d 89 e0             	mov    %r12,%r8
+  803cc2:	49 29 d8             	sub    %rbx,%r8
+  803cc5:	48 89 d9             	mov    %rbx,%rcx
+  803cc8:	44 89 ea             	mov    %r13d,%edx
+  803ccb:	48 89 de             	mov    %rbx,%rsi
+  803cce:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd3:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+    return 0;
+}
+  803cdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ce4:	48 83 c4 08          	add    $0x8,%rsp
+  803ce8:	5b                   	pop    %rbx
+  803ce9:	41 5c                	pop    %r12
+  803ceb:	41 5d                	pop    %r13
+  803ced:	5d                   	pop    %rbp
+  803cee:	c3                   	ret
+
+0000000000803cef <spawn>:
+spawn(const char *prog, const char **argv) {
+  803cef:	55                   	push   %rbp
+  803cf0:	48 89 e5             	mov    %rsp,%rbp
+  803cf3:	41 57                	push   %r15
+  803cf5:	41 56                	push   %r14
+  803cf7:	41 55                	push   %r13
+  803cf9:	41 54                	push   %r12
+  803cfb:	53                   	push   %rbx
+  803cfc:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803d03:	48 89 fb             	mov    %rdi,%rbx
+  803d06:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803d09:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  803d15:	be 00 00 00 00       	mov    $0x0,%esi
+  803d1a:	48 89 df             	mov    %rbx,%rdi
+  803d1d:	48 b8 f3 33 80 00 00 	movabs $0x8033f3,%rax
+  803d24:	00 00 00 
+  803d27:	ff d0                	call   *%rax
+  803d29:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803d2f:	85 c0                	test   %eax,%eax
+  803d31:	0f 88 06 04 00 00    	js     80413d <spawn+0x44e>
+  803d37:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803d39:	ba 00 02 00 00       	mov    $0x200,%edx
+  803d3e:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803d45:	48 b8 cf 1f 80 00 00 	movabs $0x801fcf,%rax
+  803d4c:	00 00 00 
+  803d4f:	ff d0                	call   *%rax
+  803d51:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803d53:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803d58:	0f 85 93 02 00 00    	jne    803ff1 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803d5e:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803d65:	ff ff 00 
+  803d68:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803d6f:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803d76:	01 01 00 
+  803d79:	48 39 d0             	cmp    %rdx,%rax
+  803d7c:	0f 85 ab 02 00 00    	jne    80402d <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803d82:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803d89:	00 3e 00 
+  803d8c:	0f 85 9b 02 00 00    	jne    80402d <spawn+0x33e>
+  803d92:	b8 08 00 00 00       	mov    $0x8,%eax
+  803d97:	0f 05                	syscall
+  803d99:	41 89 c6             	mov    %eax,%r14d
+  803d9c:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803da2:	85 c0                	test   %eax,%eax
+  803da4:	0f 88 75 03 00 00    	js     80411f <spawn+0x430>
+    envid_t child = res;
+  803daa:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803db0:	89 c2                	mov    %eax,%edx
+  803db2:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803db8:	48 89 d0             	mov    %rdx,%rax
+  803dbb:	48 c1 e0 04          	shl    $0x4,%rax
+  803dbf:	48 29 d0             	sub    %rdx,%rax
+  803dc2:	48 c1 e0 05          	shl    $0x5,%rax
+  803dc6:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803dcd:	00 00 00 
+  803dd0:	48 01 c6             	add    %rax,%rsi
+  803dd3:	48 8b 06             	mov    (%rsi),%rax
+  803dd6:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803ddd:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803de4:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803deb:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803df2:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803df9:	48 29 ce             	sub    %rcx,%rsi
+  803dfc:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803e02:	c1 e9 03             	shr    $0x3,%ecx
+  803e05:	89 c9                	mov    %ecx,%ecx
+  803e07:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803e0a:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803e11:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e18:	49 8b 3c 24          	mov    (%r12),%rdi
+  803e1c:	48 85 ff             	test   %rdi,%rdi
+  803e1f:	0f 84 d6 05 00 00    	je     8043fb <spawn+0x70c>
+  803e25:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803e2b:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803e31:	48 bb b0 10 80 00 00 	movabs $0x8010b0,%rbx
+  803e38:	00 00 00 
+  803e3b:	ff d3                	call   *%rbx
+  803e3d:	4c 01 f8             	add    %r15,%rax
+  803e40:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e44:	4c 89 ea             	mov    %r13,%rdx
+  803e47:	49 83 c5 01          	add    $0x1,%r13
+  803e4b:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803e50:	48 85 ff             	test   %rdi,%rdi
+  803e53:	75 e6                	jne    803e3b <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803e55:	49 89 d5             	mov    %rdx,%r13
+  803e58:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803e5f:	48 f7 d0             	not    %rax
+  803e62:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803e69:	49 89 df             	mov    %rbx,%r15
+  803e6c:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803e70:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803e77:	89 d0                	mov    %edx,%eax
+  803e79:	83 c0 01             	add    $0x1,%eax
+  803e7c:	48 98                	cltq
+  803e7e:	48 c1 e0 03          	shl    $0x3,%rax
+  803e82:	49 29 c7             	sub    %rax,%r15
+  803e85:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803e8c:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803e90:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803e96:	0f 86 4f 05 00 00    	jbe    8043eb <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803e9c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803ea1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803ea6:	be 00 00 40 00       	mov    $0x400000,%esi
+  803eab:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  803eb2:	00 00 00 
+  803eb5:	ff d0                	call   *%rax
+  803eb7:	85 c0                	test   %eax,%eax
+  803eb9:	0f 88 31 05 00 00    	js     8043f0 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  803ebf:	4c 89 e8             	mov    %r13,%rax
+  803ec2:	45 85 ed             	test   %r13d,%r13d
+  803ec5:	7e 65                	jle    803f2c <spawn+0x23d>
+  803ec7:	4d 89 fd             	mov    %r15,%r13
+  803eca:	48 98                	cltq
+  803ecc:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803ed0:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803ed7:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803eda:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803ee1:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803ee4:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803eeb:	ff 
+  803eec:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803ef0:	49 8b 34 24          	mov    (%r12),%rsi
+  803ef4:	48 89 df             	mov    %rbx,%rdi
+  803ef7:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  803efe:	00 00 00 
+  803f01:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803f03:	49 8b 3c 24          	mov    (%r12),%rdi
+  803f07:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  803f0e:	00 00 00 
+  803f11:	ff d0                	call   *%rax
+  803f13:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803f18:	49 83 c5 08          	add    $0x8,%r13
+  803f1c:	49 83 c4 08          	add    $0x8,%r12
+  803f20:	4d 39 ee             	cmp    %r13,%r14
+  803f23:	75 bf                	jne    803ee4 <spawn+0x1f5>
+  803f25:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803f2c:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803f33:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803f3a:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803f3b:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803f42:	0f 85 2c 01 00 00    	jne    804074 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803f48:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803f4f:	00 00 00 
+  803f52:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803f59:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803f60:	ff 
+  803f61:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803f65:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803f6c:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803f70:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803f77:	00 00 00 
+  803f7a:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803f81:	ff 
+  803f82:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803f89:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803f8f:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803f95:	44 89 f2             	mov    %r14d,%edx
+  803f98:	be 00 00 40 00       	mov    $0x400000,%esi
+  803f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa2:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  803fa9:	00 00 00 
+  803fac:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803fae:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803fb3:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fbd:	48 b8 c4 50 80 00 00 	movabs $0x8050c4,%rax
+  803fc4:	00 00 00 
+  803fc7:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803fc9:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803fd0:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803fd7:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803fd8:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803fdf:	00 
+  803fe0:	0f 84 5d 03 00 00    	je     804343 <spawn+0x654>
+  803fe6:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803fec:	e9 1b 02 00 00       	jmp    80420c <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803ff1:	48 bf 20 61 80 00 00 	movabs $0x806120,%rdi
+  803ff8:	00 00 00 
+  803ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804000:	48 ba c9 07 80 00 00 	movabs $0x8007c9,%rdx
+  804007:	00 00 00 
+  80400a:	ff d2                	call   *%rdx
+        close(fd);
+  80400c:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804012:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  804019:	00 00 00 
+  80401c:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80401e:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  804025:	ff ff ff 
+  804028:	e9 10 01 00 00       	jmp    80413d <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  80402d:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804032:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  804038:	48 bf d7 61 80 00 00 	movabs $0x8061d7,%rdi
+  80403f:	00 00 00 
+  804042:	b8 00 00 00 00       	mov    $0x0,%eax
+  804047:	48 b9 c9 07 80 00 00 	movabs $0x8007c9,%rcx
+  80404e:	00 00 00 
+  804051:	ff d1                	call   *%rcx
+        close(fd);
+  804053:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804059:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  804060:	00 00 00 
+  804063:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804065:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  80406c:	ff ff ff 
+  80406f:	e9 c9 00 00 00       	jmp    80413d <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  804074:	48 b9 50 61 80 00 00 	movabs $0x806150,%rcx
+  80407b:	00 00 00 
+  80407e:	48 ba f1 61 80 00 00 	movabs $0x8061f1,%rdx
+  804085:	00 00 00 
+  804088:	be f9 00 00 00       	mov    $0xf9,%esi
+  80408d:	48 bf 06 62 80 00 00 	movabs $0x806206,%rdi
+  804094:	00 00 00 
+  804097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409c:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  8040a3:	00 00 00 
+  8040a6:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  8040a9:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  8040ad:	48 29 f2             	sub    %rsi,%rdx
+  8040b0:	89 d9                	mov    %ebx,%ecx
+  8040b2:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  8040b8:	48 b8 55 50 80 00 00 	movabs $0x805055,%rax
+  8040bf:	00 00 00 
+  8040c2:	ff d0                	call   *%rax
+  8040c4:	e9 f0 01 00 00       	jmp    8042b9 <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  8040c9:	89 c6                	mov    %eax,%esi
+  8040cb:	48 bf 80 61 80 00 00 	movabs $0x806180,%rdi
+  8040d2:	00 00 00 
+  8040d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040da:	48 ba c9 07 80 00 00 	movabs $0x8007c9,%rdx
+  8040e1:	00 00 00 
+  8040e4:	ff d2                	call   *%rdx
+    scring_discard();
+  8040e6:	48 b8 35 50 80 00 00 	movabs $0x805035,%rax
+  8040ed:	00 00 00 
+  8040f0:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  8040f2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8040f7:	be 00 00 40 00       	mov    $0x400000,%esi
+  8040fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804101:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  804108:	00 00 00 
+  80410b:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  80410d:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804113:	48 b8 5d 15 80 00 00 	movabs $0x80155d,%rax
+  80411a:	00 00 00 
+  80411d:	ff d0                	call   *%rax
+    close(fd);
+  80411f:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804125:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  80412c:	00 00 00 
+  80412f:	ff d0                	call   *%rax
+    return res;
+  804131:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  804137:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  80413d:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  804143:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  80414a:	5b                   	pop    %rbx
+  80414b:	41 5c                	pop    %r12
+  80414d:	41 5d                	pop    %r13
+  80414f:	41 5e                	pop    %r14
+  804151:	41 5f                	pop    %r15
+  804153:	5d                   	pop    %rbp
+  804154:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  804155:	89 c6                	mov    %eax,%esi
+  804157:	48 bf 12 62 80 00 00 	movabs $0x806212,%rdi
+  80415e:	00 00 00 
+  804161:	b8 00 00 00 00       	mov    $0x0,%eax
+  804166:	48 ba c9 07 80 00 00 	movabs $0x8007c9,%rdx
+  80416d:	00 00 00 
+  804170:	ff d2                	call   *%rdx
+        return res;
+  804172:	e9 6f ff ff ff       	jmp    8040e6 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  804177:	4c 89 e2             	mov    %r12,%rdx
+  80417a:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804181:	48 29 c2             	sub    %rax,%rdx
+  804184:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  80418b:	be 00 00 00 00       	mov    $0x0,%esi
+  804190:	48 b8 3a 12 80 00 00 	movabs $0x80123a,%rax
+  804197:	00 00 00 
+  80419a:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80419c:	80 cb 80             	or     $0x80,%bl
+  80419f:	41 89 d9             	mov    %ebx,%r9d
+  8041a2:	4d 89 e0             	mov    %r12,%r8
+  8041a5:	4c 89 f1             	mov    %r14,%rcx
+  8041a8:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  8041ae:	be 00 00 40 00       	mov    $0x400000,%esi
+  8041b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041b8:	48 b8 8b 50 80 00 00 	movabs $0x80508b,%rax
+  8041bf:	00 00 00 
+  8041c2:	ff d0                	call   *%rax
+    res = scring_submit();
+  8041c4:	48 b8 e9 4f 80 00 00 	movabs $0x804fe9,%rax
+  8041cb:	00 00 00 
+  8041ce:	ff d0                	call   *%rax
+  8041d0:	89 c3                	mov    %eax,%ebx
+  8041d2:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  8041d8:	4c 89 e6             	mov    %r12,%rsi
+  8041db:	bf 00 00 40 00       	mov    $0x400000,%edi
+  8041e0:	48 b8 bc 37 80 00 00 	movabs $0x8037bc,%rax
+  8041e7:	00 00 00 
+  8041ea:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8041ec:	85 db                	test   %ebx,%ebx
+  8041ee:	0f 88 f2 fe ff ff    	js     8040e6 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8041f4:	49 83 c7 01          	add    $0x1,%r15
+  8041f8:	49 83 c5 38          	add    $0x38,%r13
+  8041fc:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  804203:	49 39 c7             	cmp    %rax,%r15
+  804206:	0f 83 37 01 00 00    	jae    804343 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  80420c:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  804211:	75 e1                	jne    8041f4 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  804213:	41 8b 45 04          	mov    0x4(%r13),%eax
+  804217:	89 c3                	mov    %eax,%ebx
+  804219:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  80421c:	89 da                	mov    %ebx,%edx
+  80421e:	83 ca 04             	or     $0x4,%edx
+  804221:	a8 04                	test   $0x4,%al
+  804223:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  804226:	89 da                	mov    %ebx,%edx
+  804228:	83 ca 01             	or     $0x1,%edx
+  80422b:	a8 01                	test   $0x1,%al
+  80422d:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804230:	49 8b 45 08          	mov    0x8(%r13),%rax
+  804234:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  80423a:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  80423e:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  804245:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  804249:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804250:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  804254:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  80425a:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  804260:	44 89 f2             	mov    %r14d,%edx
+  804263:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804269:	74 22                	je     80428d <spawn+0x59e>
+        va -= res;
+  80426b:	48 63 ca             	movslq %edx,%rcx
+  80426e:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  804271:	48 01 cf             	add    %rcx,%rdi
+  804274:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  80427b:	48 01 ce             	add    %rcx,%rsi
+  80427e:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  804285:	29 d0                	sub    %edx,%eax
+  804287:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  80428d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804294:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  80429b:	00 
+  80429c:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8042a3:	49 89 f4             	mov    %rsi,%r12
+  8042a6:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  8042a9:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8042b0:	49 39 c4             	cmp    %rax,%r12
+  8042b3:	0f 82 f0 fd ff ff    	jb     8040a9 <spawn+0x3ba>
+    res = scring_submit();
+  8042b9:	48 b8 e9 4f 80 00 00 	movabs $0x804fe9,%rax
+  8042c0:	00 00 00 
+  8042c3:	ff d0                	call   *%rax
+  8042c5:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  8042cb:	85 c0                	test   %eax,%eax
+  8042cd:	0f 88 f6 fd ff ff    	js     8040c9 <spawn+0x3da>
+    if (!filesz) return 0;
+  8042d3:	4d 85 e4             	test   %r12,%r12
+  8042d6:	0f 84 18 ff ff ff    	je     8041f4 <spawn+0x505>
+    void *addr = UTEMP;
+  8042dc:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  8042e3:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  8042e7:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  8042ee:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  8042f5:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8042fa:	ba 06 00 00 00       	mov    $0x6,%edx
+  8042ff:	4c 89 e6             	mov    %r12,%rsi
+  804302:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  804309:	48 b8 39 39 80 00 00 	movabs $0x803939,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+  804315:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	0f 88 32 fe ff ff    	js     804155 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  804323:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  80432a:	49 39 c4             	cmp    %rax,%r12
+  80432d:	49 0f 46 c4          	cmovbe %r12,%rax
+  804331:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  804338:	0f 83 5e fe ff ff    	jae    80419c <spawn+0x4ad>
+  80433e:	e9 34 fe ff ff       	jmp    804177 <spawn+0x488>
+    close(fd);
+  804343:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804349:	48 b8 93 1d 80 00 00 	movabs $0x801d93,%rax
+  804350:	00 00 00 
+  804353:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  804355:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80435c:	48 bf 9a 3c 80 00 00 	movabs $0x803c9a,%rdi
+  804363:	00 00 00 
+  804366:	48 b8 8a 4d 80 00 00 	movabs $0x804d8a,%rax
+  80436d:	00 00 00 
+  804370:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  804372:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  804379:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80437f:	48 b8 35 51 80 00 00 	movabs $0x805135,%rax
+  804386:	00 00 00 
+  804389:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  80438b:	be 02 00 00 00       	mov    $0x2,%esi
+  804390:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804396:	48 b8 fd 50 80 00 00 	movabs $0x8050fd,%rax
+  80439d:	00 00 00 
+  8043a0:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  8043a2:	48 b8 e9 4f 80 00 00 	movabs $0x804fe9,%rax
+  8043a9:	00 00 00 
+  8043ac:	ff d0                	call   *%rax
+  8043ae:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8043b4:	85 c0                	test   %eax,%eax
+  8043b6:	78 11                	js     8043c9 <spawn+0x6da>
+    return child;
+  8043b8:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8043be:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  8043c4:	e9 74 fd ff ff       	jmp    80413d <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  8043c9:	89 c6                	mov    %eax,%esi
+  8043cb:	48 bf b0 61 80 00 00 	movabs $0x8061b0,%rdi
+  8043d2:	00 00 00 
+  8043d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043da:	48 ba c9 07 80 00 00 	movabs $0x8007c9,%rdx
+  8043e1:	00 00 00 
+  8043e4:	ff d2                	call   *%rdx
+        goto error;
+  8043e6:	e9 fb fc ff ff       	jmp    8040e6 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8043eb:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8043f0:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8043f6:	e9 eb fc ff ff       	jmp    8040e6 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8043fb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804400:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804405:	be 00 00 40 00       	mov    $0x400000,%esi
+  80440a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80440f:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+  80441b:	85 c0                	test   %eax,%eax
+  80441d:	78 d1                	js     8043f0 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  80441f:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804426:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80442a:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  804431:	f8 ff 40 00 
+  804435:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  80443c:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804440:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  804445:	e9 e2 fa ff ff       	jmp    803f2c <spawn+0x23d>
+
+000000000080444a <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  80444a:	55                   	push   %rbp
+  80444b:	48 89 e5             	mov    %rsp,%rbp
+  80444e:	48 83 ec 50          	sub    $0x50,%rsp
+  804452:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804456:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80445a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80445e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804462:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804469:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80446d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804471:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804475:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804479:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  80447e:	eb 15                	jmp    804495 <spawnl+0x4b>
+  804480:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804484:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804488:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80448c:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804490:	74 1c                	je     8044ae <spawnl+0x64>
+  804492:	83 c1 01             	add    $0x1,%ecx
+  804495:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804498:	83 f8 2f             	cmp    $0x2f,%eax
+  80449b:	77 e3                	ja     804480 <spawnl+0x36>
+  80449d:	89 c2                	mov    %eax,%edx
+  80449f:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8044a3:	4c 01 d2             	add    %r10,%rdx
+  8044a6:	83 c0 08             	add    $0x8,%eax
+  8044a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8044ac:	eb de                	jmp    80448c <spawnl+0x42>
+    const char *argv[argc + 2];
+  8044ae:	8d 41 02             	lea    0x2(%rcx),%eax
+  8044b1:	48 98                	cltq
+  8044b3:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8044ba:	00 
+  8044bb:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8044bf:	48 29 c4             	sub    %rax,%rsp
+  8044c2:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8044c7:	4c 89 c0             	mov    %r8,%rax
+  8044ca:	48 c1 e8 03          	shr    $0x3,%rax
+  8044ce:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8044d2:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8044d9:	00 
+    argv[argc + 1] = NULL;
+  8044da:	8d 41 01             	lea    0x1(%rcx),%eax
+  8044dd:	48 98                	cltq
+  8044df:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8044e6:	00 
+    va_start(vl, arg0);
+  8044e7:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044ee:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8044f6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8044fa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8044fe:	85 c9                	test   %ecx,%ecx
+  804500:	74 41                	je     804543 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804502:	49 89 c1             	mov    %rax,%r9
+  804505:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804509:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  80450c:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  804511:	eb 1b                	jmp    80452e <spawnl+0xe4>
+  804513:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804517:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  80451b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80451f:	48 8b 11             	mov    (%rcx),%rdx
+  804522:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804525:	48 83 c0 08          	add    $0x8,%rax
+  804529:	48 39 f0             	cmp    %rsi,%rax
+  80452c:	74 15                	je     804543 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80452e:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804531:	83 fa 2f             	cmp    $0x2f,%edx
+  804534:	77 dd                	ja     804513 <spawnl+0xc9>
+  804536:	89 d1                	mov    %edx,%ecx
+  804538:	4c 01 c9             	add    %r9,%rcx
+  80453b:	83 c2 08             	add    $0x8,%edx
+  80453e:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804541:	eb dc                	jmp    80451f <spawnl+0xd5>
+    return spawn(prog, argv);
+  804543:	4c 89 c6             	mov    %r8,%rsi
+  804546:	48 b8 ef 3c 80 00 00 	movabs $0x803cef,%rax
+  80454d:	00 00 00 
+  804550:	ff d0                	call   *%rax
+}
+  804552:	c9                   	leave
+  804553:	c3                   	ret
+
+0000000000804554 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804554:	55                   	push   %rbp
+  804555:	48 89 e5             	mov    %rsp,%rbp
+  804558:	41 54                	push   %r12
+  80455a:	53                   	push   %rbx
+  80455b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80455e:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804565:	00 00 00 
+  804568:	ff d0                	call   *%rax
+  80456a:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80456d:	48 be 2f 62 80 00 00 	movabs $0x80622f,%rsi
+  804574:	00 00 00 
+  804577:	48 89 df             	mov    %rbx,%rdi
+  80457a:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  804581:	00 00 00 
+  804584:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804586:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80458b:	41 2b 04 24          	sub    (%r12),%eax
+  80458f:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804595:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80459c:	00 00 00 
+    stat->st_dev = &devpipe;
+  80459f:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8045a6:	00 00 00 
+  8045a9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8045b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b5:	5b                   	pop    %rbx
+  8045b6:	41 5c                	pop    %r12
+  8045b8:	5d                   	pop    %rbp
+  8045b9:	c3                   	ret
+
+00000000008045ba <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045ba:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045bd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8045c3:	8b 17                	mov    (%rdi),%edx
+  8045c5:	85 d2                	test   %edx,%edx
+  8045c7:	75 01                	jne    8045ca <pipe_wakeup+0x10>
+  8045c9:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045ca:	55                   	push   %rbp
+  8045cb:	48 89 e5             	mov    %rsp,%rbp
+  8045ce:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8045d1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8045d7:	be 00 04 00 00       	mov    $0x400,%esi
+  8045dc:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  8045e3:	00 00 00 
+  8045e6:	ff d0                	call   *%rax
+}
+  8045e8:	5d                   	pop    %rbp
+  8045e9:	c3                   	ret
+
+00000000008045ea <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8045ea:	55                   	push   %rbp
+  8045eb:	48 89 e5             	mov    %rsp,%rbp
+  8045ee:	41 55                	push   %r13
+  8045f0:	41 54                	push   %r12
+  8045f2:	53                   	push   %rbx
+  8045f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045f7:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8045fa:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804601:	00 00 00 
+  804604:	ff d0                	call   *%rax
+  804606:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804609:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80460e:	4c 89 e6             	mov    %r12,%rsi
+  804611:	bf 00 00 00 00       	mov    $0x0,%edi
+  804616:	49 bc f3 16 80 00 00 	movabs $0x8016f3,%r12
+  80461d:	00 00 00 
+  804620:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804623:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804627:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80462b:	49 bd ba 45 80 00 00 	movabs $0x8045ba,%r13
+  804632:	00 00 00 
+  804635:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804638:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80463c:	48 89 de             	mov    %rbx,%rsi
+  80463f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804642:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804647:	48 89 de             	mov    %rbx,%rsi
+  80464a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80464f:	41 ff d4             	call   *%r12
+  804652:	48 83 c4 08          	add    $0x8,%rsp
+  804656:	5b                   	pop    %rbx
+  804657:	41 5c                	pop    %r12
+  804659:	41 5d                	pop    %r13
+  80465b:	5d                   	pop    %rbp
+  80465c:	c3                   	ret
+
+000000000080465d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80465d:	55                   	push   %rbp
+  80465e:	48 89 e5             	mov    %rsp,%rbp
+  804661:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804664:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804669:	be 00 10 00 00       	mov    $0x1000,%esi
+  80466e:	48 b8 36 16 80 00 00 	movabs $0x801636,%rax
+  804675:	00 00 00 
+  804678:	ff d0                	call   *%rax
+  80467a:	85 c0                	test   %eax,%eax
+  80467c:	0f 94 c0             	sete   %al
+  80467f:	0f b6 c0             	movzbl %al,%eax
+}
+  804682:	5d                   	pop    %rbp
+  804683:	c3                   	ret
+
+0000000000804684 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804684:	55                   	push   %rbp
+  804685:	48 89 e5             	mov    %rsp,%rbp
+  804688:	41 57                	push   %r15
+  80468a:	41 56                	push   %r14
+  80468c:	41 55                	push   %r13
+  80468e:	41 54                	push   %r12
+  804690:	53                   	push   %rbx
+  804691:	48 83 ec 38          	sub    $0x38,%rsp
+  804695:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804699:	49 89 f4             	mov    %rsi,%r12
+  80469c:	49 89 d7             	mov    %rdx,%r15
+  80469f:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046a3:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  8046aa:	00 00 00 
+  8046ad:	ff d0                	call   *%rax
+  8046af:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046b2:	4d 85 ff             	test   %r15,%r15
+  8046b5:	0f 84 f1 00 00 00    	je     8047ac <devpipe_write+0x128>
+  8046bb:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8046bf:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8046c3:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8046c7:	49 bd 5d 46 80 00 00 	movabs $0x80465d,%r13
+  8046ce:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8046d1:	49 bf ba 45 80 00 00 	movabs $0x8045ba,%r15
+  8046d8:	00 00 00 
+  8046db:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8046df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046e3:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8046e7:	8b 73 04             	mov    0x4(%rbx),%esi
+  8046ea:	48 63 ce             	movslq %esi,%rcx
+  8046ed:	48 63 03             	movslq (%rbx),%rax
+  8046f0:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8046f6:	48 39 c1             	cmp    %rax,%rcx
+  8046f9:	72 64                	jb     80475f <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046fb:	48 89 de             	mov    %rbx,%rsi
+  8046fe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804702:	41 ff d5             	call   *%r13
+  804705:	85 c0                	test   %eax,%eax
+  804707:	0f 85 b9 00 00 00    	jne    8047c6 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80470d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  804711:	4c 89 f7             	mov    %r14,%rdi
+  804714:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804717:	8b 43 04             	mov    0x4(%rbx),%eax
+  80471a:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804721:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804728:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80472e:	8b 03                	mov    (%rbx),%eax
+  804730:	41 39 c4             	cmp    %eax,%r12d
+  804733:	75 b2                	jne    8046e7 <devpipe_write+0x63>
+  804735:	48 89 de             	mov    %rbx,%rsi
+  804738:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80473c:	41 ff d5             	call   *%r13
+  80473f:	85 c0                	test   %eax,%eax
+  804741:	75 a0                	jne    8046e3 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804743:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804748:	44 89 e6             	mov    %r12d,%esi
+  80474b:	48 89 df             	mov    %rbx,%rdi
+  80474e:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  804755:	00 00 00 
+  804758:	ff d0                	call   *%rax
+  80475a:	e9 7c ff ff ff       	jmp    8046db <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80475f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804763:	41 0f b6 38          	movzbl (%r8),%edi
+  804767:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80476e:	80 80 80 
+  804771:	48 89 c8             	mov    %rcx,%rax
+  804774:	48 f7 e2             	mul    %rdx
+  804777:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80477b:	48 89 d0             	mov    %rdx,%rax
+  80477e:	48 c1 e0 08          	shl    $0x8,%rax
+  804782:	48 29 d0             	sub    %rdx,%rax
+  804785:	48 c1 e0 04          	shl    $0x4,%rax
+  804789:	48 29 c1             	sub    %rax,%rcx
+  80478c:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804791:	83 c6 01             	add    $0x1,%esi
+  804794:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804797:	49 83 c0 01          	add    $0x1,%r8
+  80479b:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80479f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047a3:	49 39 c0             	cmp    %rax,%r8
+  8047a6:	0f 85 2f ff ff ff    	jne    8046db <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8047ac:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8047b0:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8047b4:	48 b8 ba 45 80 00 00 	movabs $0x8045ba,%rax
+  8047bb:	00 00 00 
+  8047be:	ff d0                	call   *%rax
+    return n;
+  8047c0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047c4:	eb 05                	jmp    8047cb <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8047c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047cb:	48 83 c4 38          	add    $0x38,%rsp
+  8047cf:	5b                   	pop    %rbx
+  8047d0:	41 5c                	pop    %r12
+  8047d2:	41 5d                	pop    %r13
+  8047d4:	41 5e                	pop    %r14
+  8047d6:	41 5f                	pop    %r15
+  8047d8:	5d                   	pop    %rbp
+  8047d9:	c3                   	ret
+
+00000000008047da <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8047da:	55                   	push   %rbp
+  8047db:	48 89 e5             	mov    %rsp,%rbp
+  8047de:	41 57                	push   %r15
+  8047e0:	41 56                	push   %r14
+  8047e2:	41 55                	push   %r13
+  8047e4:	41 54                	push   %r12
+  8047e6:	53                   	push   %rbx
+  8047e7:	48 83 ec 28          	sub    $0x28,%rsp
+  8047eb:	49 89 fd             	mov    %rdi,%r13
+  8047ee:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8047f2:	49 89 d4             	mov    %rdx,%r12
+  8047f5:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8047f9:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804800:	00 00 00 
+  804803:	ff d0                	call   *%rax
+  804805:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804808:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80480e:	49 bf 5d 46 80 00 00 	movabs $0x80465d,%r15
+  804815:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804818:	4d 85 e4             	test   %r12,%r12
+  80481b:	0f 84 d5 00 00 00    	je     8048f6 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804821:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804825:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804829:	8b 03                	mov    (%rbx),%eax
+  80482b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80482e:	75 7a                	jne    8048aa <devpipe_read+0xd0>
+            if (i > 0) {
+  804830:	4d 85 f6             	test   %r14,%r14
+  804833:	75 50                	jne    804885 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804835:	48 89 de             	mov    %rbx,%rsi
+  804838:	4c 89 ef             	mov    %r13,%rdi
+  80483b:	41 ff d7             	call   *%r15
+  80483e:	85 c0                	test   %eax,%eax
+  804840:	0f 85 c9 00 00 00    	jne    80490f <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804846:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804849:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804850:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804856:	8b 43 04             	mov    0x4(%rbx),%eax
+  804859:	41 39 c4             	cmp    %eax,%r12d
+  80485c:	75 cb                	jne    804829 <devpipe_read+0x4f>
+  80485e:	48 89 de             	mov    %rbx,%rsi
+  804861:	4c 89 ef             	mov    %r13,%rdi
+  804864:	41 ff d7             	call   *%r15
+  804867:	85 c0                	test   %eax,%eax
+  804869:	75 be                	jne    804829 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80486b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804870:	44 89 e6             	mov    %r12d,%esi
+  804873:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804877:	48 b8 bb 19 80 00 00 	movabs $0x8019bb,%rax
+  80487e:	00 00 00 
+  804881:	ff d0                	call   *%rax
+  804883:	eb a4                	jmp    804829 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804885:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804889:	48 89 de             	mov    %rbx,%rsi
+  80488c:	48 b8 ba 45 80 00 00 	movabs $0x8045ba,%rax
+  804893:	00 00 00 
+  804896:	ff d0                	call   *%rax
+                return i;
+  804898:	4c 89 f0             	mov    %r14,%rax
+}
+  80489b:	48 83 c4 28          	add    $0x28,%rsp
+  80489f:	5b                   	pop    %rbx
+  8048a0:	41 5c                	pop    %r12
+  8048a2:	41 5d                	pop    %r13
+  8048a4:	41 5e                	pop    %r14
+  8048a6:	41 5f                	pop    %r15
+  8048a8:	5d                   	pop    %rbp
+  8048a9:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8048aa:	48 63 c8             	movslq %eax,%rcx
+  8048ad:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8048b4:	80 80 80 
+  8048b7:	48 89 c8             	mov    %rcx,%rax
+  8048ba:	48 f7 e2             	mul    %rdx
+  8048bd:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8048c1:	48 89 d0             	mov    %rdx,%rax
+  8048c4:	48 c1 e0 08          	shl    $0x8,%rax
+  8048c8:	48 29 d0             	sub    %rdx,%rax
+  8048cb:	48 c1 e0 04          	shl    $0x4,%rax
+  8048cf:	48 89 c2             	mov    %rax,%rdx
+  8048d2:	48 89 c8             	mov    %rcx,%rax
+  8048d5:	48 29 d0             	sub    %rdx,%rax
+  8048d8:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8048dd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8048e1:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8048e5:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8048e8:	49 83 c6 01          	add    $0x1,%r14
+  8048ec:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8048f0:	0f 85 2b ff ff ff    	jne    804821 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8048f6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8048fa:	48 89 de             	mov    %rbx,%rsi
+  8048fd:	48 b8 ba 45 80 00 00 	movabs $0x8045ba,%rax
+  804904:	00 00 00 
+  804907:	ff d0                	call   *%rax
+    return n;
+  804909:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80490d:	eb 8c                	jmp    80489b <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80490f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804914:	eb 85                	jmp    80489b <devpipe_read+0xc1>
+
+0000000000804916 <pipe>:
+pipe(int pfd[2]) {
+  804916:	55                   	push   %rbp
+  804917:	48 89 e5             	mov    %rsp,%rbp
+  80491a:	41 55                	push   %r13
+  80491c:	41 54                	push   %r12
+  80491e:	53                   	push   %rbx
+  80491f:	48 83 ec 18          	sub    $0x18,%rsp
+  804923:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804926:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80492a:	48 b8 ce 1b 80 00 00 	movabs $0x801bce,%rax
+  804931:	00 00 00 
+  804934:	ff d0                	call   *%rax
+  804936:	89 c3                	mov    %eax,%ebx
+  804938:	85 c0                	test   %eax,%eax
+  80493a:	0f 88 a0 01 00 00    	js     804ae0 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804940:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804945:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80494a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80494e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804953:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  80495a:	00 00 00 
+  80495d:	ff d0                	call   *%rax
+  80495f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804961:	85 c0                	test   %eax,%eax
+  804963:	0f 88 77 01 00 00    	js     804ae0 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804969:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80496d:	48 b8 ce 1b 80 00 00 	movabs $0x801bce,%rax
+  804974:	00 00 00 
+  804977:	ff d0                	call   *%rax
+  804979:	89 c3                	mov    %eax,%ebx
+  80497b:	85 c0                	test   %eax,%eax
+  80497d:	0f 88 43 01 00 00    	js     804ac6 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804983:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804988:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80498d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804991:	bf 00 00 00 00       	mov    $0x0,%edi
+  804996:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  80499d:	00 00 00 
+  8049a0:	ff d0                	call   *%rax
+  8049a2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049a4:	85 c0                	test   %eax,%eax
+  8049a6:	0f 88 1a 01 00 00    	js     804ac6 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8049ac:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8049b0:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  8049b7:	00 00 00 
+  8049ba:	ff d0                	call   *%rax
+  8049bc:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8049bf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049c4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049c9:	48 89 c6             	mov    %rax,%rsi
+  8049cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049d1:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8049d8:	00 00 00 
+  8049db:	ff d0                	call   *%rax
+  8049dd:	89 c3                	mov    %eax,%ebx
+  8049df:	85 c0                	test   %eax,%eax
+  8049e1:	0f 88 c5 00 00 00    	js     804aac <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8049e7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8049eb:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  8049f2:	00 00 00 
+  8049f5:	ff d0                	call   *%rax
+  8049f7:	48 89 c1             	mov    %rax,%rcx
+  8049fa:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804a00:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a06:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a0b:	4c 89 ee             	mov    %r13,%rsi
+  804a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a13:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  804a1a:	00 00 00 
+  804a1d:	ff d0                	call   *%rax
+  804a1f:	89 c3                	mov    %eax,%ebx
+  804a21:	85 c0                	test   %eax,%eax
+  804a23:	78 6e                	js     804a93 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804a25:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a2a:	4c 89 ef             	mov    %r13,%rdi
+  804a2d:	48 b8 12 16 80 00 00 	movabs $0x801612,%rax
+  804a34:	00 00 00 
+  804a37:	ff d0                	call   *%rax
+  804a39:	83 f8 02             	cmp    $0x2,%eax
+  804a3c:	0f 85 ab 00 00 00    	jne    804aed <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804a42:	a1 60 70 80 00 00 00 	movabs 0x807060,%eax
+  804a49:	00 00 
+  804a4b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a4f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804a51:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a55:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804a5c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804a60:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804a62:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a66:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804a6d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a71:	48 bb a0 1b 80 00 00 	movabs $0x801ba0,%rbx
+  804a78:	00 00 00 
+  804a7b:	ff d3                	call   *%rbx
+  804a7d:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804a81:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804a85:	ff d3                	call   *%rbx
+  804a87:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804a8c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a91:	eb 4d                	jmp    804ae0 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804a93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a98:	4c 89 ee             	mov    %r13,%rsi
+  804a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aa0:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  804aa7:	00 00 00 
+  804aaa:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804aac:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ab1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804ab5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aba:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  804ac1:	00 00 00 
+  804ac4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804ac6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804acb:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804acf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ad4:	48 b8 f3 16 80 00 00 	movabs $0x8016f3,%rax
+  804adb:	00 00 00 
+  804ade:	ff d0                	call   *%rax
+}
+  804ae0:	89 d8                	mov    %ebx,%eax
+  804ae2:	48 83 c4 18          	add    $0x18,%rsp
+  804ae6:	5b                   	pop    %rbx
+  804ae7:	41 5c                	pop    %r12
+  804ae9:	41 5d                	pop    %r13
+  804aeb:	5d                   	pop    %rbp
+  804aec:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804aed:	48 b9 48 62 80 00 00 	movabs $0x806248,%rcx
+  804af4:	00 00 00 
+  804af7:	48 ba f1 61 80 00 00 	movabs $0x8061f1,%rdx
+  804afe:	00 00 00 
+  804b01:	be 50 00 00 00       	mov    $0x50,%esi
+  804b06:	48 bf 36 62 80 00 00 	movabs $0x806236,%rdi
+  804b0d:	00 00 00 
+  804b10:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b15:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  804b1c:	00 00 00 
+  804b1f:	41 ff d0             	call   *%r8
+
+0000000000804b22 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804b22:	55                   	push   %rbp
+  804b23:	48 89 e5             	mov    %rsp,%rbp
+  804b26:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804b2a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804b2e:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  804b35:	00 00 00 
+  804b38:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b3a:	85 c0                	test   %eax,%eax
+  804b3c:	78 23                	js     804b61 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804b3e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b42:	48 b8 b2 1b 80 00 00 	movabs $0x801bb2,%rax
+  804b49:	00 00 00 
+  804b4c:	ff d0                	call   *%rax
+  804b4e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804b51:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b55:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  804b5c:	00 00 00 
+  804b5f:	ff d0                	call   *%rax
+}
+  804b61:	c9                   	leave
+  804b62:	c3                   	ret
+
+0000000000804b63 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804b63:	55                   	push   %rbp
+  804b64:	48 89 e5             	mov    %rsp,%rbp
+  804b67:	41 56                	push   %r14
+  804b69:	41 55                	push   %r13
+  804b6b:	41 54                	push   %r12
+  804b6d:	53                   	push   %rbx
+    assert(envid != 0);
+  804b6e:	85 ff                	test   %edi,%edi
+  804b70:	0f 84 b7 00 00 00    	je     804c2d <wait+0xca>
+  804b76:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804b79:	89 f9                	mov    %edi,%ecx
+  804b7b:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804b81:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804b88:	00 00 00 
+  804b8b:	45 89 e0             	mov    %r12d,%r8d
+  804b8e:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804b95:	4c 89 c0             	mov    %r8,%rax
+  804b98:	48 c1 e0 04          	shl    $0x4,%rax
+  804b9c:	48 89 c2             	mov    %rax,%rdx
+  804b9f:	4c 29 c2             	sub    %r8,%rdx
+  804ba2:	48 c1 e2 05          	shl    $0x5,%rdx
+  804ba6:	48 01 fa             	add    %rdi,%rdx
+  804ba9:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804baf:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804bb5:	41 39 c4             	cmp    %eax,%r12d
+  804bb8:	75 6a                	jne    804c24 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804bba:	48 63 d1             	movslq %ecx,%rdx
+  804bbd:	48 89 d0             	mov    %rdx,%rax
+  804bc0:	48 c1 e0 04          	shl    $0x4,%rax
+  804bc4:	48 29 d0             	sub    %rdx,%rax
+  804bc7:	48 c1 e0 05          	shl    $0x5,%rax
+  804bcb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804bd2:	00 00 00 
+  804bd5:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804bdc:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804bdd:	48 63 c9             	movslq %ecx,%rcx
+  804be0:	48 89 c8             	mov    %rcx,%rax
+  804be3:	48 c1 e0 04          	shl    $0x4,%rax
+  804be7:	48 29 c8             	sub    %rcx,%rax
+  804bea:	48 c1 e0 05          	shl    $0x5,%rax
+  804bee:	48 89 d3             	mov    %rdx,%rbx
+  804bf1:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804bf4:	49 bd bb 19 80 00 00 	movabs $0x8019bb,%r13
+  804bfb:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804bfe:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804c04:	85 c0                	test   %eax,%eax
+  804c06:	74 1c                	je     804c24 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804c08:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c0d:	4c 89 f7             	mov    %r14,%rdi
+  804c10:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  804c13:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804c19:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804c1f:	44 39 e0             	cmp    %r12d,%eax
+  804c22:	74 da                	je     804bfe <wait+0x9b>
+    }
+}
+  804c24:	5b                   	pop    %rbx
+  804c25:	41 5c                	pop    %r12
+  804c27:	41 5d                	pop    %r13
+  804c29:	41 5e                	pop    %r14
+  804c2b:	5d                   	pop    %rbp
+  804c2c:	c3                   	ret
+    assert(envid != 0);
+  804c2d:	48 b9 6c 62 80 00 00 	movabs $0x80626c,%rcx
+  804c34:	00 00 00 
+  804c37:	48 ba f1 61 80 00 00 	movabs $0x8061f1,%rdx
+  804c3e:	00 00 00 
+  804c41:	be 06 00 00 00       	mov    $0x6,%esi
+  804c46:	48 bf 77 62 80 00 00 	movabs $0x806277,%rdi
+  804c4d:	00 00 00 
+  804c50:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c55:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  804c5c:	00 00 00 
+  804c5f:	41 ff d0             	call   *%r8
+
+0000000000804c62 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804c62:	48 89 f8             	mov    %rdi,%rax
+  804c65:	48 c1 e8 27          	shr    $0x27,%rax
+  804c69:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804c70:	01 00 00 
+  804c73:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c77:	f6 c2 01             	test   $0x1,%dl
+  804c7a:	74 6d                	je     804ce9 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c7c:	48 89 f8             	mov    %rdi,%rax
+  804c7f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804c83:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c8a:	01 00 00 
+  804c8d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c91:	f6 c2 01             	test   $0x1,%dl
+  804c94:	74 62                	je     804cf8 <get_uvpt_entry+0x96>
+  804c96:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c9d:	01 00 00 
+  804ca0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ca4:	f6 c2 80             	test   $0x80,%dl
+  804ca7:	75 4f                	jne    804cf8 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804ca9:	48 89 f8             	mov    %rdi,%rax
+  804cac:	48 c1 e8 15          	shr    $0x15,%rax
+  804cb0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804cb7:	01 00 00 
+  804cba:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804cbe:	f6 c2 01             	test   $0x1,%dl
+  804cc1:	74 44                	je     804d07 <get_uvpt_entry+0xa5>
+  804cc3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804cca:	01 00 00 
+  804ccd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804cd1:	f6 c2 80             	test   $0x80,%dl
+  804cd4:	75 31                	jne    804d07 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804cd6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804cda:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804ce1:	01 00 00 
+  804ce4:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804ce8:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804ce9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804cf0:	01 00 00 
+  804cf3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804cf7:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804cf8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804cff:	01 00 00 
+  804d02:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804d06:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804d07:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804d0e:	01 00 00 
+  804d11:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804d15:	c3                   	ret
+
+0000000000804d16 <get_prot>:
+
+int
+get_prot(void *va) {
+  804d16:	55                   	push   %rbp
+  804d17:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d1a:	48 b8 62 4c 80 00 00 	movabs $0x804c62,%rax
+  804d21:	00 00 00 
+  804d24:	ff d0                	call   *%rax
+  804d26:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804d29:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804d2e:	89 c1                	mov    %eax,%ecx
+  804d30:	83 c9 04             	or     $0x4,%ecx
+  804d33:	f6 c2 01             	test   $0x1,%dl
+  804d36:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804d39:	89 c1                	mov    %eax,%ecx
+  804d3b:	83 c9 02             	or     $0x2,%ecx
+  804d3e:	f6 c2 02             	test   $0x2,%dl
+  804d41:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804d44:	89 c1                	mov    %eax,%ecx
+  804d46:	83 c9 01             	or     $0x1,%ecx
+  804d49:	48 85 d2             	test   %rdx,%rdx
+  804d4c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804d4f:	89 c1                	mov    %eax,%ecx
+  804d51:	83 c9 40             	or     $0x40,%ecx
+  804d54:	f6 c6 04             	test   $0x4,%dh
+  804d57:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804d5a:	5d                   	pop    %rbp
+  804d5b:	c3                   	ret
+
+0000000000804d5c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804d5c:	55                   	push   %rbp
+  804d5d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d60:	48 b8 62 4c 80 00 00 	movabs $0x804c62,%rax
+  804d67:	00 00 00 
+  804d6a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804d6c:	48 c1 e8 06          	shr    $0x6,%rax
+  804d70:	83 e0 01             	and    $0x1,%eax
+}
+  804d73:	5d                   	pop    %rbp
+  804d74:	c3                   	ret
+
+0000000000804d75 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804d75:	55                   	push   %rbp
+  804d76:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804d79:	48 b8 62 4c 80 00 00 	movabs $0x804c62,%rax
+  804d80:	00 00 00 
+  804d83:	ff d0                	call   *%rax
+  804d85:	83 e0 01             	and    $0x1,%eax
+}
+  804d88:	5d                   	pop    %rbp
+  804d89:	c3                   	ret
+
+0000000000804d8a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804d8a:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804d91:	01 00 00 
+  804d94:	a8 01                	test   $0x1,%al
+  804d96:	75 06                	jne    804d9e <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d9d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804d9e:	55                   	push   %rbp
+  804d9f:	48 89 e5             	mov    %rsp,%rbp
+  804da2:	41 57                	push   %r15
+  804da4:	41 56                	push   %r14
+  804da6:	41 55                	push   %r13
+  804da8:	41 54                	push   %r12
+  804daa:	53                   	push   %rbx
+  804dab:	48 83 ec 28          	sub    $0x28,%rsp
+  804daf:	49 89 fe             	mov    %rdi,%r14
+  804db2:	49 89 f7             	mov    %rsi,%r15
+  804db5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804dbc:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804dbd:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804dc4:	01 00 00 
+  804dc7:	e9 ae 00 00 00       	jmp    804e7a <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804dcc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804dd3:	49 83 ec 01          	sub    $0x1,%r12
+  804dd7:	74 2d                	je     804e06 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804dd9:	48 89 d8             	mov    %rbx,%rax
+  804ddc:	48 c1 e8 0c          	shr    $0xc,%rax
+  804de0:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804de5:	f6 c2 01             	test   $0x1,%dl
+  804de8:	74 e2                	je     804dcc <foreach_shared_region+0x42>
+  804dea:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804def:	f6 c4 04             	test   $0x4,%ah
+  804df2:	74 d8                	je     804dcc <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804df4:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804dfb:	4c 89 fa             	mov    %r15,%rdx
+  804dfe:	48 89 df             	mov    %rbx,%rdi
+  804e01:	41 ff d6             	call   *%r14
+  804e04:	eb c6                	jmp    804dcc <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804e06:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804e0d:	00 
+  804e0e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804e13:	74 4a                	je     804e5f <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804e15:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e19:	48 c1 e8 15          	shr    $0x15,%rax
+  804e1d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804e24:	01 00 00 
+  804e27:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e2b:	a8 01                	test   $0x1,%al
+  804e2d:	74 d7                	je     804e06 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804e2f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804e33:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804e3a:	48 39 c3             	cmp    %rax,%rbx
+  804e3d:	73 c7                	jae    804e06 <foreach_shared_region+0x7c>
+  804e3f:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804e46:	48 39 d0             	cmp    %rdx,%rax
+  804e49:	4d 19 e4             	sbb    %r12,%r12
+  804e4c:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804e53:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804e5a:	e9 7a ff ff ff       	jmp    804dd9 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804e5f:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804e66:	40 
+  804e67:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804e6b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e72:	00 00 00 
+  804e75:	48 39 c1             	cmp    %rax,%rcx
+  804e78:	74 50                	je     804eca <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804e7a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804e7e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804e82:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804e89:	01 00 00 
+  804e8c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e90:	a8 01                	test   $0x1,%al
+  804e92:	74 cb                	je     804e5f <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804e94:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804e98:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804e9f:	48 39 c1             	cmp    %rax,%rcx
+  804ea2:	73 bb                	jae    804e5f <foreach_shared_region+0xd5>
+  804ea4:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804eab:	48 39 d0             	cmp    %rdx,%rax
+  804eae:	48 19 c0             	sbb    %rax,%rax
+  804eb1:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804eb7:	48 05 00 02 00 00    	add    $0x200,%rax
+  804ebd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ec1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804ec5:	e9 4b ff ff ff       	jmp    804e15 <foreach_shared_region+0x8b>
+  804eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ecf:	48 83 c4 28          	add    $0x28,%rsp
+  804ed3:	5b                   	pop    %rbx
+  804ed4:	41 5c                	pop    %r12
+  804ed6:	41 5d                	pop    %r13
+  804ed8:	41 5e                	pop    %r14
+  804eda:	41 5f                	pop    %r15
+  804edc:	5d                   	pop    %rbp
+  804edd:	c3                   	ret
+
+0000000000804ede <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804ede:	55                   	push   %rbp
+  804edf:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804ee2:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  804ee9:	00 00 00 
+  804eec:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804ef3:	48 b8 40 10 88 00 00 	movabs $0x881040,%rax
+  804efa:	00 00 00 
+  804efd:	48 39 c2             	cmp    %rax,%rdx
+  804f00:	74 13                	je     804f15 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804f02:	48 89 c7             	mov    %rax,%rdi
+  804f05:	48 b8 32 19 80 00 00 	movabs $0x801932,%rax
+  804f0c:	00 00 00 
+  804f0f:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  804f11:	85 c0                	test   %eax,%eax
+  804f13:	78 0c                	js     804f21 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  804f15:	48 b8 92 19 80 00 00 	movabs $0x801992,%rax
+  804f1c:	00 00 00 
+  804f1f:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804f21:	48 ba 40 10 88 00 00 	movabs $0x881040,%rdx
+  804f28:	00 00 00 
+  804f2b:	8b 0a                	mov    (%rdx),%ecx
+  804f2d:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804f30:	5d                   	pop    %rbp
+  804f31:	c3                   	ret
+
+0000000000804f32 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  804f32:	55                   	push   %rbp
+  804f33:	48 89 e5             	mov    %rsp,%rbp
+  804f36:	41 57                	push   %r15
+  804f38:	41 56                	push   %r14
+  804f3a:	41 55                	push   %r13
+  804f3c:	41 54                	push   %r12
+  804f3e:	53                   	push   %rbx
+  804f3f:	48 83 ec 18          	sub    $0x18,%rsp
+  804f43:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804f47:	48 b8 00 10 88 00 00 	movabs $0x881000,%rax
+  804f4e:	00 00 00 
+  804f51:	83 38 00             	cmpl   $0x0,(%rax)
+  804f54:	75 69                	jne    804fbf <scring_push+0x8d>
+  804f56:	49 89 ff             	mov    %rdi,%r15
+  804f59:	49 89 f6             	mov    %rsi,%r14
+  804f5c:	49 89 d5             	mov    %rdx,%r13
+  804f5f:	49 89 cc             	mov    %rcx,%r12
+  804f62:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804f65:	48 ba 40 10 88 00 00 	movabs $0x881040,%rdx
+  804f6c:	00 00 00 
+  804f6f:	8b 42 04             	mov    0x4(%rdx),%eax
+  804f72:	8b 12                	mov    (%rdx),%edx
+  804f74:	29 d0                	sub    %edx,%eax
+  804f76:	83 f8 20             	cmp    $0x20,%eax
+  804f79:	74 53                	je     804fce <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804f7b:	48 ba 40 10 88 00 00 	movabs $0x881040,%rdx
+  804f82:	00 00 00 
+  804f85:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804f88:	83 e0 1f             	and    $0x1f,%eax
+  804f8b:	48 c1 e0 06          	shl    $0x6,%rax
+  804f8f:	48 01 d0             	add    %rdx,%rax
+  804f92:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804f96:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804f9a:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804f9e:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804fa2:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804fa6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804faa:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804fae:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804fb2:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804fb6:	8b 42 04             	mov    0x4(%rdx),%eax
+  804fb9:	83 c0 01             	add    $0x1,%eax
+  804fbc:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804fbf:	48 83 c4 18          	add    $0x18,%rsp
+  804fc3:	5b                   	pop    %rbx
+  804fc4:	41 5c                	pop    %r12
+  804fc6:	41 5d                	pop    %r13
+  804fc8:	41 5e                	pop    %r14
+  804fca:	41 5f                	pop    %r15
+  804fcc:	5d                   	pop    %rbp
+  804fcd:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804fce:	48 b8 de 4e 80 00 00 	movabs $0x804ede,%rax
+  804fd5:	00 00 00 
+  804fd8:	ff d0                	call   *%rax
+  804fda:	a3 00 10 88 00 00 00 	movabs %eax,0x881000
+  804fe1:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804fe3:	85 c0                	test   %eax,%eax
+  804fe5:	79 94                	jns    804f7b <scring_push+0x49>
+  804fe7:	eb d6                	jmp    804fbf <scring_push+0x8d>
+
+0000000000804fe9 <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804fe9:	48 ba 00 10 88 00 00 	movabs $0x881000,%rdx
+  804ff0:	00 00 00 
+  804ff3:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804ff5:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804ffb:	85 c0                	test   %eax,%eax
+  804ffd:	78 14                	js     805013 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804fff:	48 ba 40 10 88 00 00 	movabs $0x881040,%rdx
+  805006:	00 00 00 
+  805009:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  80500c:	8b 12                	mov    (%rdx),%edx
+  80500e:	39 d1                	cmp    %edx,%ecx
+  805010:	75 11                	jne    805023 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  805012:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  805013:	48 ba 40 10 88 00 00 	movabs $0x881040,%rdx
+  80501a:	00 00 00 
+  80501d:	8b 0a                	mov    (%rdx),%ecx
+  80501f:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  805022:	c3                   	ret
+scring_submit(void) {
+  805023:	55                   	push   %rbp
+  805024:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  805027:	48 b8 de 4e 80 00 00 	movabs $0x804ede,%rax
+  80502e:	00 00 00 
+  805031:	ff d0                	call   *%rax
+}
+  805033:	5d                   	pop    %rbp
+  805034:	c3                   	ret
+
+0000000000805035 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  805035:	48 b8 00 10 88 00 00 	movabs $0x881000,%rax
+  80503c:	00 00 00 
+  80503f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  805045:	48 b8 40 10 88 00 00 	movabs $0x881040,%rax
+  80504c:	00 00 00 
+  80504f:	8b 10                	mov    (%rax),%edx
+  805051:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  805054:	c3                   	ret
+
+0000000000805055 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  805055:	55                   	push   %rbp
+  805056:	48 89 e5             	mov    %rsp,%rbp
+  805059:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  80505c:	48 63 f7             	movslq %edi,%rsi
+  80505f:	48 83 ec 08          	sub    $0x8,%rsp
+  805063:	6a 00                	push   $0x0
+  805065:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80506b:	4c 63 c1             	movslq %ecx,%r8
+  80506e:	48 89 d1             	mov    %rdx,%rcx
+  805071:	48 89 c2             	mov    %rax,%rdx
+  805074:	bf 04 00 00 00       	mov    $0x4,%edi
+  805079:	48 b8 32 4f 80 00 00 	movabs $0x804f32,%rax
+  805080:	00 00 00 
+  805083:	ff d0                	call   *%rax
+}
+  805085:	48 83 c4 10          	add    $0x10,%rsp
+  805089:	c9                   	leave
+  80508a:	c3                   	ret
+
+000000000080508b <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80508b:	55                   	push   %rbp
+  80508c:	48 89 e5             	mov    %rsp,%rbp
+  80508f:	48 89 f0             	mov    %rsi,%rax
+  805092:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  805095:	48 63 ca             	movslq %edx,%rcx
+  805098:	48 63 f7             	movslq %edi,%rsi
+  80509b:	48 83 ec 08          	sub    $0x8,%rsp
+  80509f:	4d 63 c9             	movslq %r9d,%r9
+  8050a2:	41 51                	push   %r9
+  8050a4:	4d 89 c1             	mov    %r8,%r9
+  8050a7:	4d 89 d0             	mov    %r10,%r8
+  8050aa:	48 89 c2             	mov    %rax,%rdx
+  8050ad:	bf 05 00 00 00       	mov    $0x5,%edi
+  8050b2:	48 b8 32 4f 80 00 00 	movabs $0x804f32,%rax
+  8050b9:	00 00 00 
+  8050bc:	ff d0                	call   *%rax
+}
+  8050be:	48 83 c4 10          	add    $0x10,%rsp
+  8050c2:	c9                   	leave
+  8050c3:	c3                   	ret
+
+00000000008050c4 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  8050c4:	55                   	push   %rbp
+  8050c5:	48 89 e5             	mov    %rsp,%rbp
+  8050c8:	48 89 f0             	mov    %rsi,%rax
+  8050cb:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  8050ce:	48 63 f7             	movslq %edi,%rsi
+  8050d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8050d5:	6a 00                	push   $0x0
+  8050d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8050dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8050e3:	48 89 c2             	mov    %rax,%rdx
+  8050e6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8050eb:	48 b8 32 4f 80 00 00 	movabs $0x804f32,%rax
+  8050f2:	00 00 00 
+  8050f5:	ff d0                	call   *%rax
+}
+  8050f7:	48 83 c4 10          	add    $0x10,%rsp
+  8050fb:	c9                   	leave
+  8050fc:	c3                   	ret
+
+00000000008050fd <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  8050fd:	55                   	push   %rbp
+  8050fe:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  805101:	48 63 d6             	movslq %esi,%rdx
+  805104:	48 63 f7             	movslq %edi,%rsi
+  805107:	48 83 ec 08          	sub    $0x8,%rsp
+  80510b:	6a 00                	push   $0x0
+  80510d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805113:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805119:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80511e:	bf 09 00 00 00       	mov    $0x9,%edi
+  805123:	48 b8 32 4f 80 00 00 	movabs $0x804f32,%rax
+  80512a:	00 00 00 
+  80512d:	ff d0                	call   *%rax
+}
+  80512f:	48 83 c4 10          	add    $0x10,%rsp
+  805133:	c9                   	leave
+  805134:	c3                   	ret
+
+0000000000805135 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  805135:	55                   	push   %rbp
+  805136:	48 89 e5             	mov    %rsp,%rbp
+  805139:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80513c:	48 63 f7             	movslq %edi,%rsi
+  80513f:	48 83 ec 08          	sub    $0x8,%rsp
+  805143:	6a 00                	push   $0x0
+  805145:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80514b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805151:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805156:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80515b:	48 b8 32 4f 80 00 00 	movabs $0x804f32,%rax
+  805162:	00 00 00 
+  805165:	ff d0                	call   *%rax
+}
+  805167:	48 83 c4 10          	add    $0x10,%rsp
+  80516b:	c9                   	leave
+  80516c:	c3                   	ret
+
+000000000080516d <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80516d:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  805173:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80517a:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  805181:	c3                   	ret
+
+0000000000805182 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  805182:	8b 47 40             	mov    0x40(%rdi),%eax
+  805185:	8b 17                	mov    (%rdi),%edx
+  805187:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805189:	83 f8 0f             	cmp    $0xf,%eax
+  80518c:	77 13                	ja     8051a1 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80518e:	8b 47 40             	mov    0x40(%rdi),%eax
+  805191:	83 e0 0f             	and    $0xf,%eax
+  805194:	48 c1 e0 09          	shl    $0x9,%rax
+  805198:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80519f:	00 
+  8051a0:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8051a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051a6:	c3                   	ret
+
+00000000008051a7 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8051a7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8051aa:	83 c0 01             	add    $0x1,%eax
+  8051ad:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8051b0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8051b6:	8b 57 04             	mov    0x4(%rdi),%edx
+  8051b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051be:	85 d2                	test   %edx,%edx
+  8051c0:	75 04                	jne    8051c6 <chan_publish+0x1f>
+  8051c2:	83 e0 01             	and    $0x1,%eax
+}
+  8051c5:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8051c6:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8051c9:	85 c0                	test   %eax,%eax
+  8051cb:	0f 95 c0             	setne  %al
+  8051ce:	0f b6 c0             	movzbl %al,%eax
+  8051d1:	eb ef                	jmp    8051c2 <chan_publish+0x1b>
+
+00000000008051d3 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8051d3:	8b 47 40             	mov    0x40(%rdi),%eax
+  8051d6:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8051d8:	29 d0                	sub    %edx,%eax
+  8051da:	83 e8 01             	sub    $0x1,%eax
+  8051dd:	83 f8 0f             	cmp    $0xf,%eax
+  8051e0:	77 12                	ja     8051f4 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8051e2:	8b 07                	mov    (%rdi),%eax
+  8051e4:	83 e0 0f             	and    $0xf,%eax
+  8051e7:	48 c1 e0 09          	shl    $0x9,%rax
+  8051eb:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8051f2:	00 
+  8051f3:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8051f4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051f9:	c3                   	ret
+
+00000000008051fa <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8051fa:	8b 07                	mov    (%rdi),%eax
+  8051fc:	83 c0 01             	add    $0x1,%eax
+  8051ff:	89 07                	mov    %eax,(%rdi)
+}
+  805201:	c3                   	ret
+
+0000000000805202 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  805202:	55                   	push   %rbp
+  805203:	48 89 e5             	mov    %rsp,%rbp
+  805206:	53                   	push   %rbx
+  805207:	48 83 ec 08          	sub    $0x8,%rsp
+  80520b:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80520e:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805215:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80521b:	48 b8 d3 51 80 00 00 	movabs $0x8051d3,%rax
+  805222:	00 00 00 
+  805225:	ff d0                	call   *%rax
+  805227:	48 85 c0             	test   %rax,%rax
+  80522a:	74 12                	je     80523e <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80522c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  805233:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805238:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80523c:	c9                   	leave
+  80523d:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80523e:	b8 01 00 00 00       	mov    $0x1,%eax
+  805243:	eb f3                	jmp    805238 <chan_arm+0x36>
+
+0000000000805245 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  805245:	55                   	push   %rbp
+  805246:	48 89 e5             	mov    %rsp,%rbp
+  805249:	41 56                	push   %r14
+  80524b:	41 55                	push   %r13
+  80524d:	41 54                	push   %r12
+  80524f:	53                   	push   %rbx
+  805250:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  805253:	49 bc 02 52 80 00 00 	movabs $0x805202,%r12
+  80525a:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80525d:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  805261:	49 bd bb 19 80 00 00 	movabs $0x8019bb,%r13
+  805268:	00 00 00 
+    while (chan_arm(r))
+  80526b:	eb 0d                	jmp    80527a <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80526d:	8b 33                	mov    (%rbx),%esi
+  80526f:	ba 00 00 00 00       	mov    $0x0,%edx
+  805274:	4c 89 f7             	mov    %r14,%rdi
+  805277:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80527a:	48 89 df             	mov    %rbx,%rdi
+  80527d:	41 ff d4             	call   *%r12
+  805280:	84 c0                	test   %al,%al
+  805282:	75 e9                	jne    80526d <chan_wait+0x28>
+}
+  805284:	5b                   	pop    %rbx
+  805285:	41 5c                	pop    %r12
+  805287:	41 5d                	pop    %r13
+  805289:	41 5e                	pop    %r14
+  80528b:	5d                   	pop    %rbp
+  80528c:	c3                   	ret
+
+000000000080528d <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80528d:	55                   	push   %rbp
+  80528e:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  805291:	48 83 c7 40          	add    $0x40,%rdi
+  805295:	be 01 00 00 00       	mov    $0x1,%esi
+  80529a:	48 b8 d9 19 80 00 00 	movabs $0x8019d9,%rax
+  8052a1:	00 00 00 
+  8052a4:	ff d0                	call   *%rax
+}
+  8052a6:	5d                   	pop    %rbp
+  8052a7:	c3                   	ret
+
+00000000008052a8 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8052a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052ad:	c3                   	ret
+
+00000000008052ae <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8052ae:	55                   	push   %rbp
+  8052af:	48 89 e5             	mov    %rsp,%rbp
+  8052b2:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8052b5:	48 be 82 62 80 00 00 	movabs $0x806282,%rsi
+  8052bc:	00 00 00 
+  8052bf:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  8052c6:	00 00 00 
+  8052c9:	ff d0                	call   *%rax
+    return 0;
+}
+  8052cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052d0:	5d                   	pop    %rbp
+  8052d1:	c3                   	ret
+
+00000000008052d2 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8052d2:	55                   	push   %rbp
+  8052d3:	48 89 e5             	mov    %rsp,%rbp
+  8052d6:	41 57                	push   %r15
+  8052d8:	41 56                	push   %r14
+  8052da:	41 55                	push   %r13
+  8052dc:	41 54                	push   %r12
+  8052de:	53                   	push   %rbx
+  8052df:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8052e6:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8052ed:	48 85 d2             	test   %rdx,%rdx
+  8052f0:	74 7a                	je     80536c <devcons_write+0x9a>
+  8052f2:	49 89 d6             	mov    %rdx,%r14
+  8052f5:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8052fb:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  805300:	49 bf e8 12 80 00 00 	movabs $0x8012e8,%r15
+  805307:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80530a:	4c 89 f3             	mov    %r14,%rbx
+  80530d:	48 29 f3             	sub    %rsi,%rbx
+  805310:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  805315:	48 39 c3             	cmp    %rax,%rbx
+  805318:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80531c:	4c 63 eb             	movslq %ebx,%r13
+  80531f:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805326:	48 01 c6             	add    %rax,%rsi
+  805329:	4c 89 ea             	mov    %r13,%rdx
+  80532c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805333:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805336:	4c 89 ee             	mov    %r13,%rsi
+  805339:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805340:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  805347:	00 00 00 
+  80534a:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80534c:	41 01 dc             	add    %ebx,%r12d
+  80534f:	49 63 f4             	movslq %r12d,%rsi
+  805352:	4c 39 f6             	cmp    %r14,%rsi
+  805355:	72 b3                	jb     80530a <devcons_write+0x38>
+    return res;
+  805357:	49 63 c4             	movslq %r12d,%rax
+}
+  80535a:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805361:	5b                   	pop    %rbx
+  805362:	41 5c                	pop    %r12
+  805364:	41 5d                	pop    %r13
+  805366:	41 5e                	pop    %r14
+  805368:	41 5f                	pop    %r15
+  80536a:	5d                   	pop    %rbp
+  80536b:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80536c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805372:	eb e3                	jmp    805357 <devcons_write+0x85>
+
+0000000000805374 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805374:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80537c:	48 85 c0             	test   %rax,%rax
+  80537f:	74 55                	je     8053d6 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805381:	55                   	push   %rbp
+  805382:	48 89 e5             	mov    %rsp,%rbp
+  805385:	41 55                	push   %r13
+  805387:	41 54                	push   %r12
+  805389:	53                   	push   %rbx
+  80538a:	48 83 ec 08          	sub    $0x8,%rsp
+  80538e:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805391:	48 bb 34 15 80 00 00 	movabs $0x801534,%rbx
+  805398:	00 00 00 
+  80539b:	49 bc e9 15 80 00 00 	movabs $0x8015e9,%r12
+  8053a2:	00 00 00 
+  8053a5:	eb 03                	jmp    8053aa <devcons_read+0x36>
+  8053a7:	41 ff d4             	call   *%r12
+  8053aa:	ff d3                	call   *%rbx
+  8053ac:	85 c0                	test   %eax,%eax
+  8053ae:	74 f7                	je     8053a7 <devcons_read+0x33>
+    if (c < 0) return c;
+  8053b0:	48 63 d0             	movslq %eax,%rdx
+  8053b3:	78 13                	js     8053c8 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8053b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053ba:	83 f8 04             	cmp    $0x4,%eax
+  8053bd:	74 09                	je     8053c8 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8053bf:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8053c3:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8053c8:	48 89 d0             	mov    %rdx,%rax
+  8053cb:	48 83 c4 08          	add    $0x8,%rsp
+  8053cf:	5b                   	pop    %rbx
+  8053d0:	41 5c                	pop    %r12
+  8053d2:	41 5d                	pop    %r13
+  8053d4:	5d                   	pop    %rbp
+  8053d5:	c3                   	ret
+  8053d6:	48 89 d0             	mov    %rdx,%rax
+  8053d9:	c3                   	ret
+
+00000000008053da <cputchar>:
+cputchar(int ch) {
+  8053da:	55                   	push   %rbp
+  8053db:	48 89 e5             	mov    %rsp,%rbp
+  8053de:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8053e2:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8053e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8053eb:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8053ef:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8053f6:	00 00 00 
+  8053f9:	ff d0                	call   *%rax
+}
+  8053fb:	c9                   	leave
+  8053fc:	c3                   	ret
+
+00000000008053fd <getchar>:
+getchar(void) {
+  8053fd:	55                   	push   %rbp
+  8053fe:	48 89 e5             	mov    %rsp,%rbp
+  805401:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  805405:	ba 01 00 00 00       	mov    $0x1,%edx
+  80540a:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80540e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805413:	48 b8 11 1f 80 00 00 	movabs $0x801f11,%rax
+  80541a:	00 00 00 
+  80541d:	ff d0                	call   *%rax
+  80541f:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805421:	85 c0                	test   %eax,%eax
+  805423:	78 06                	js     80542b <getchar+0x2e>
+  805425:	74 08                	je     80542f <getchar+0x32>
+  805427:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80542b:	89 d0                	mov    %edx,%eax
+  80542d:	c9                   	leave
+  80542e:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80542f:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805434:	eb f5                	jmp    80542b <getchar+0x2e>
+
+0000000000805436 <iscons>:
+iscons(int fdnum) {
+  805436:	55                   	push   %rbp
+  805437:	48 89 e5             	mov    %rsp,%rbp
+  80543a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80543e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805442:	48 b8 2e 1c 80 00 00 	movabs $0x801c2e,%rax
+  805449:	00 00 00 
+  80544c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80544e:	85 c0                	test   %eax,%eax
+  805450:	78 18                	js     80546a <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805452:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805456:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  80545d:	00 00 00 
+  805460:	8b 00                	mov    (%rax),%eax
+  805462:	39 02                	cmp    %eax,(%rdx)
+  805464:	0f 94 c0             	sete   %al
+  805467:	0f b6 c0             	movzbl %al,%eax
+}
+  80546a:	c9                   	leave
+  80546b:	c3                   	ret
+
+000000000080546c <opencons>:
+opencons(void) {
+  80546c:	55                   	push   %rbp
+  80546d:	48 89 e5             	mov    %rsp,%rbp
+  805470:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805474:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805478:	48 b8 ce 1b 80 00 00 	movabs $0x801bce,%rax
+  80547f:	00 00 00 
+  805482:	ff d0                	call   *%rax
+  805484:	85 c0                	test   %eax,%eax
+  805486:	78 49                	js     8054d1 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805488:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80548d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805492:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805496:	bf 00 00 00 00       	mov    $0x0,%edi
+  80549b:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8054a2:	00 00 00 
+  8054a5:	ff d0                	call   *%rax
+  8054a7:	85 c0                	test   %eax,%eax
+  8054a9:	78 26                	js     8054d1 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8054ab:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054af:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  8054b6:	00 00 
+  8054b8:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8054ba:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8054be:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8054c5:	48 b8 a0 1b 80 00 00 	movabs $0x801ba0,%rax
+  8054cc:	00 00 00 
+  8054cf:	ff d0                	call   *%rax
+}
+  8054d1:	c9                   	leave
+  8054d2:	c3                   	ret
+
+00000000008054d3 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8054d3:	55                   	push   %rbp
+  8054d4:	48 89 e5             	mov    %rsp,%rbp
+  8054d7:	41 56                	push   %r14
+  8054d9:	41 55                	push   %r13
+  8054db:	41 54                	push   %r12
+  8054dd:	53                   	push   %rbx
+  8054de:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054e1:	48 b8 a8 18 88 00 00 	movabs $0x8818a8,%rax
+  8054e8:	00 00 00 
+  8054eb:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8054ef:	74 27                	je     805518 <_handle_vectored_pagefault+0x45>
+  8054f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8054f6:	49 bd 60 18 88 00 00 	movabs $0x881860,%r13
+  8054fd:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805500:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805503:	4c 89 e7             	mov    %r12,%rdi
+  805506:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80550b:	84 c0                	test   %al,%al
+  80550d:	75 45                	jne    805554 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80550f:	48 83 c3 01          	add    $0x1,%rbx
+  805513:	49 3b 1e             	cmp    (%r14),%rbx
+  805516:	72 eb                	jb     805503 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805518:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80551f:	00 
+  805520:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805525:	4d 8b 04 24          	mov    (%r12),%r8
+  805529:	48 ba 90 62 80 00 00 	movabs $0x806290,%rdx
+  805530:	00 00 00 
+  805533:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805538:	48 bf c0 62 80 00 00 	movabs $0x8062c0,%rdi
+  80553f:	00 00 00 
+  805542:	b8 00 00 00 00       	mov    $0x0,%eax
+  805547:	49 ba 79 06 80 00 00 	movabs $0x800679,%r10
+  80554e:	00 00 00 
+  805551:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805554:	5b                   	pop    %rbx
+  805555:	41 5c                	pop    %r12
+  805557:	41 5d                	pop    %r13
+  805559:	41 5e                	pop    %r14
+  80555b:	5d                   	pop    %rbp
+  80555c:	c3                   	ret
+
+000000000080555d <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80555d:	55                   	push   %rbp
+  80555e:	48 89 e5             	mov    %rsp,%rbp
+  805561:	53                   	push   %rbx
+  805562:	48 83 ec 08          	sub    $0x8,%rsp
+  805566:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  805569:	48 b8 a0 18 88 00 00 	movabs $0x8818a0,%rax
+  805570:	00 00 00 
+  805573:	80 38 00             	cmpb   $0x0,(%rax)
+  805576:	0f 84 84 00 00 00    	je     805600 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80557c:	48 b8 a8 18 88 00 00 	movabs $0x8818a8,%rax
+  805583:	00 00 00 
+  805586:	48 8b 10             	mov    (%rax),%rdx
+  805589:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80558e:	48 b9 60 18 88 00 00 	movabs $0x881860,%rcx
+  805595:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805598:	48 85 d2             	test   %rdx,%rdx
+  80559b:	74 19                	je     8055b6 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80559d:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8055a1:	0f 84 e8 00 00 00    	je     80568f <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8055a7:	48 83 c0 01          	add    $0x1,%rax
+  8055ab:	48 39 d0             	cmp    %rdx,%rax
+  8055ae:	75 ed                	jne    80559d <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8055b0:	48 83 fa 08          	cmp    $0x8,%rdx
+  8055b4:	74 1c                	je     8055d2 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8055b6:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8055ba:	48 a3 a8 18 88 00 00 	movabs %rax,0x8818a8
+  8055c1:	00 00 00 
+  8055c4:	48 b8 60 18 88 00 00 	movabs $0x881860,%rax
+  8055cb:	00 00 00 
+  8055ce:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8055d2:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  8055d9:	00 00 00 
+  8055dc:	ff d0                	call   *%rax
+  8055de:	89 c7                	mov    %eax,%edi
+  8055e0:	48 be 55 57 80 00 00 	movabs $0x805755,%rsi
+  8055e7:	00 00 00 
+  8055ea:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  8055f1:	00 00 00 
+  8055f4:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8055f6:	85 c0                	test   %eax,%eax
+  8055f8:	78 68                	js     805662 <add_pgfault_handler+0x105>
+    return res;
+}
+  8055fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8055fe:	c9                   	leave
+  8055ff:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  805600:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  805607:	00 00 00 
+  80560a:	ff d0                	call   *%rax
+  80560c:	89 c7                	mov    %eax,%edi
+  80560e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  805613:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805618:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80561f:	00 00 00 
+  805622:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  805629:	00 00 00 
+  80562c:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80562e:	48 ba a8 18 88 00 00 	movabs $0x8818a8,%rdx
+  805635:	00 00 00 
+  805638:	48 8b 02             	mov    (%rdx),%rax
+  80563b:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80563f:	48 89 0a             	mov    %rcx,(%rdx)
+  805642:	48 ba 60 18 88 00 00 	movabs $0x881860,%rdx
+  805649:	00 00 00 
+  80564c:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  805650:	48 b8 a0 18 88 00 00 	movabs $0x8818a0,%rax
+  805657:	00 00 00 
+  80565a:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80565d:	e9 70 ff ff ff       	jmp    8055d2 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805662:	89 c1                	mov    %eax,%ecx
+  805664:	48 ba ce 62 80 00 00 	movabs $0x8062ce,%rdx
+  80566b:	00 00 00 
+  80566e:	be 3d 00 00 00       	mov    $0x3d,%esi
+  805673:	48 bf c0 62 80 00 00 	movabs $0x8062c0,%rdi
+  80567a:	00 00 00 
+  80567d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805682:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  805689:	00 00 00 
+  80568c:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80568f:	b8 00 00 00 00       	mov    $0x0,%eax
+  805694:	e9 61 ff ff ff       	jmp    8055fa <add_pgfault_handler+0x9d>
+
+0000000000805699 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805699:	55                   	push   %rbp
+  80569a:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80569d:	48 b8 a0 18 88 00 00 	movabs $0x8818a0,%rax
+  8056a4:	00 00 00 
+  8056a7:	80 38 00             	cmpb   $0x0,(%rax)
+  8056aa:	74 33                	je     8056df <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056ac:	48 a1 a8 18 88 00 00 	movabs 0x8818a8,%rax
+  8056b3:	00 00 00 
+  8056b6:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8056bb:	48 ba 60 18 88 00 00 	movabs $0x881860,%rdx
+  8056c2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056c5:	48 85 c0             	test   %rax,%rax
+  8056c8:	0f 84 85 00 00 00    	je     805753 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8056ce:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8056d2:	74 40                	je     805714 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056d4:	48 83 c1 01          	add    $0x1,%rcx
+  8056d8:	48 39 c1             	cmp    %rax,%rcx
+  8056db:	75 f1                	jne    8056ce <remove_pgfault_handler+0x35>
+  8056dd:	eb 74                	jmp    805753 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8056df:	48 b9 e6 62 80 00 00 	movabs $0x8062e6,%rcx
+  8056e6:	00 00 00 
+  8056e9:	48 ba f1 61 80 00 00 	movabs $0x8061f1,%rdx
+  8056f0:	00 00 00 
+  8056f3:	be 43 00 00 00       	mov    $0x43,%esi
+  8056f8:	48 bf c0 62 80 00 00 	movabs $0x8062c0,%rdi
+  8056ff:	00 00 00 
+  805702:	b8 00 00 00 00       	mov    $0x0,%eax
+  805707:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  80570e:	00 00 00 
+  805711:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  805714:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80571b:	00 
+  80571c:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805720:	48 29 ca             	sub    %rcx,%rdx
+  805723:	48 b8 60 18 88 00 00 	movabs $0x881860,%rax
+  80572a:	00 00 00 
+  80572d:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805731:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805736:	48 89 ce             	mov    %rcx,%rsi
+  805739:	48 b8 e8 12 80 00 00 	movabs $0x8012e8,%rax
+  805740:	00 00 00 
+  805743:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805745:	48 b8 a8 18 88 00 00 	movabs $0x8818a8,%rax
+  80574c:	00 00 00 
+  80574f:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805753:	5d                   	pop    %rbp
+  805754:	c3                   	ret
+
+0000000000805755 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805755:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805758:	48 b8 d3 54 80 00 00 	movabs $0x8054d3,%rax
+  80575f:	00 00 00 
+    call *%rax
+  805762:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  805764:	41 5f                	pop    %r15
+	popq %r15
+  805766:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  805768:	41 5f                	pop    %r15
+	popq %r14
+  80576a:	41 5e                	pop    %r14
+	popq %r13
+  80576c:	41 5d                	pop    %r13
+	popq %r12
+  80576e:	41 5c                	pop    %r12
+	popq %r11
+  805770:	41 5b                	pop    %r11
+	popq %r10
+  805772:	41 5a                	pop    %r10
+	popq %r9
+  805774:	41 59                	pop    %r9
+	popq %r8
+  805776:	41 58                	pop    %r8
+	popq %rsi
+  805778:	5e                   	pop    %rsi
+	popq %rdi
+  805779:	5f                   	pop    %rdi
+	popq %rbp
+  80577a:	5d                   	pop    %rbp
+	popq %rdx
+  80577b:	5a                   	pop    %rdx
+	popq %rcx
+  80577c:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80577d:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805782:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805787:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80578b:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80578e:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  805793:	5b                   	pop    %rbx
+	popq %rax
+  805794:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  805795:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805799:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80579a:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80579f:	c3                   	ret
+
+00000000008057a0 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8057a0:	55                   	push   %rbp
+  8057a1:	48 89 e5             	mov    %rsp,%rbp
+  8057a4:	41 55                	push   %r13
+  8057a6:	41 54                	push   %r12
+  8057a8:	53                   	push   %rbx
+  8057a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8057ad:	49 89 fd             	mov    %rdi,%r13
+  8057b0:	48 89 f7             	mov    %rsi,%rdi
+  8057b3:	48 89 d3             	mov    %rdx,%rbx
+  8057b6:	49 89 cc             	mov    %rcx,%r12
+  8057b9:	4c 89 c2             	mov    %r8,%rdx
+  8057bc:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057bf:	48 85 f6             	test   %rsi,%rsi
+  8057c2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057c9:	00 00 00 
+  8057cc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8057d0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8057d5:	48 85 db             	test   %rbx,%rbx
+  8057d8:	74 03                	je     8057dd <ipc_recv_futex+0x3d>
+  8057da:	48 8b 33             	mov    (%rbx),%rsi
+  8057dd:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8057e1:	48 b8 97 18 80 00 00 	movabs $0x801897,%rax
+  8057e8:	00 00 00 
+  8057eb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057ed:	85 c0                	test   %eax,%eax
+  8057ef:	78 75                	js     805866 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8057f1:	4d 85 ed             	test   %r13,%r13
+  8057f4:	74 14                	je     80580a <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8057f6:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  8057fd:	00 00 00 
+  805800:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805806:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80580a:	4d 85 e4             	test   %r12,%r12
+  80580d:	74 14                	je     805823 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80580f:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  805816:	00 00 00 
+  805819:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80581f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  805823:	48 85 db             	test   %rbx,%rbx
+  805826:	74 23                	je     80584b <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805828:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  80582f:	00 00 00 
+  805832:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  805838:	ba 00 00 00 00       	mov    $0x0,%edx
+  80583d:	85 c9                	test   %ecx,%ecx
+  80583f:	74 07                	je     805848 <ipc_recv_futex+0xa8>
+  805841:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  805848:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80584b:	48 a1 00 30 85 00 00 	movabs 0x853000,%rax
+  805852:	00 00 00 
+  805855:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80585b:	48 83 c4 08          	add    $0x8,%rsp
+  80585f:	5b                   	pop    %rbx
+  805860:	41 5c                	pop    %r12
+  805862:	41 5d                	pop    %r13
+  805864:	5d                   	pop    %rbp
+  805865:	c3                   	ret
+        if (from_env_store != NULL) {
+  805866:	4d 85 ed             	test   %r13,%r13
+  805869:	74 08                	je     805873 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80586b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805872:	00 
+        if (perm_store != NULL) {
+  805873:	4d 85 e4             	test   %r12,%r12
+  805876:	74 08                	je     805880 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  805878:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80587f:	00 
+        if (size != NULL) {
+  805880:	48 85 db             	test   %rbx,%rbx
+  805883:	74 d6                	je     80585b <ipc_recv_futex+0xbb>
+            *size = 0;
+  805885:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80588c:	eb cd                	jmp    80585b <ipc_recv_futex+0xbb>
+
+000000000080588e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80588e:	55                   	push   %rbp
+  80588f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  805892:	48 83 ec 08          	sub    $0x8,%rsp
+  805896:	6a 00                	push   $0x0
+  805898:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80589e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8058a4:	48 b8 a0 57 80 00 00 	movabs $0x8057a0,%rax
+  8058ab:	00 00 00 
+  8058ae:	ff d0                	call   *%rax
+}
+  8058b0:	c9                   	leave
+  8058b1:	c3                   	ret
+
+00000000008058b2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8058b2:	55                   	push   %rbp
+  8058b3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8058b6:	48 85 d2             	test   %rdx,%rdx
+  8058b9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058c0:	00 00 00 
+  8058c3:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8058c7:	89 f6                	mov    %esi,%esi
+  8058c9:	48 b8 80 18 80 00 00 	movabs $0x801880,%rax
+  8058d0:	00 00 00 
+  8058d3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8058d5:	85 c0                	test   %eax,%eax
+  8058d7:	78 02                	js     8058db <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8058d9:	5d                   	pop    %rbp
+  8058da:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8058db:	89 c1                	mov    %eax,%ecx
+  8058dd:	48 ba 00 63 80 00 00 	movabs $0x806300,%rdx
+  8058e4:	00 00 00 
+  8058e7:	be 50 00 00 00       	mov    $0x50,%esi
+  8058ec:	48 bf 14 63 80 00 00 	movabs $0x806314,%rdi
+  8058f3:	00 00 00 
+  8058f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058fb:	49 b8 79 06 80 00 00 	movabs $0x800679,%r8
+  805902:	00 00 00 
+  805905:	41 ff d0             	call   *%r8
+
+0000000000805908 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805908:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80590d:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  805914:	00 00 00 
+  805917:	48 89 d0             	mov    %rdx,%rax
+  80591a:	48 c1 e0 04          	shl    $0x4,%rax
+  80591e:	48 29 d0             	sub    %rdx,%rax
+  805921:	48 c1 e0 05          	shl    $0x5,%rax
+  805925:	48 01 c8             	add    %rcx,%rax
+  805928:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80592e:	39 f8                	cmp    %edi,%eax
+  805930:	74 13                	je     805945 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  805932:	48 83 c2 01          	add    $0x1,%rdx
+  805936:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80593d:	75 d8                	jne    805917 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80593f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805944:	c3                   	ret
+            return envs[i].env_id;
+  805945:	48 89 d0             	mov    %rdx,%rax
+  805948:	48 c1 e0 04          	shl    $0x4,%rax
+  80594c:	48 29 d0             	sub    %rdx,%rax
+  80594f:	48 c1 e0 05          	shl    $0x5,%rax
+  805953:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80595a:	00 00 00 
+  80595d:	48 01 d0             	add    %rdx,%rax
+  805960:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805966:	c3                   	ret
+  805967:	90                   	nop
+
+0000000000805968 <__rodata_start>:
+  805968:	2f                   	(bad)
+  805969:	62                   	(bad)
+  80596a:	69 67 66 69 6c 65 00 	imul   $0x656c69,0x66(%rdi),%esp
+  805971:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805972:	70 65                	jo     8059d9 <__rodata_start+0x71>
+  805974:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805975:	20 2f                	and    %ch,(%rdi)
+  805977:	62                   	(bad)
+  805978:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  80597f:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f559ee <__bss_end+0x736d39ee>
+  805985:	65 72 2f             	gs jb  8059b7 <__rodata_start+0x4f>
+  805988:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80598b:	62 65 6e 63 68       	(bad)
+  805990:	2e 63 00             	cs movsxd (%rax),%eax
+  805993:	72 65                	jb     8059fa <__rodata_start+0x92>
+  805995:	61                   	(bad)
+  805996:	64 20 2f             	and    %ch,%fs:(%rdi)
+  805999:	62                   	(bad)
+  80599a:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  8059a1:	20 25 69 00 70 69    	and    %ah,0x69700069(%rip)        # 69f05a10 <__bss_end+0x69683a10>
+  8059a7:	70 65                	jo     805a0e <__rodata_start+0xa6>
+  8059a9:	3a 20                	cmp    (%rax),%ah
+  8059ab:	25 69 00 64 69       	and    $0x69640069,%eax
+  8059b0:	73 6b                	jae    805a1d <__rodata_start+0xb5>
+  8059b2:	5f                   	pop    %rdi
+  8059b3:	73 74                	jae    805a29 <__rodata_start+0xc1>
+  8059b5:	61                   	(bad)
+  8059b6:	74 3a                	je     8059f2 <__rodata_start+0x8a>
+  8059b8:	20 25 69 00 66 6f    	and    %ah,0x6f660069(%rip)        # 6fe65a27 <__bss_end+0x6f5e3a27>
+  8059be:	72 6b                	jb     805a2b <__rodata_start+0xc3>
+  8059c0:	3a 20                	cmp    (%rax),%ah
+  8059c2:	25 69 00 2f 63       	and    $0x632f0069,%eax
+  8059c7:	61                   	(bad)
+  8059c8:	74 00                	je     8059ca <__rodata_start+0x62>
+  8059ca:	73 70                	jae    805a3c <__rodata_start+0xd4>
+  8059cc:	61                   	(bad)
+  8059cd:	77 6e                	ja     805a3d <__rodata_start+0xd5>
+  8059cf:	20 63 61             	and    %ah,0x61(%rbx)
+  8059d2:	74 3a                	je     805a0e <__rodata_start+0xa6>
+  8059d4:	20 25 69 00 72 65    	and    %ah,0x65720069(%rip)        # 65f25a43 <__bss_end+0x656a3a43>
+  8059da:	61                   	(bad)
+  8059db:	64 3a 20             	cmp    %fs:(%rax),%ah
+  8059de:	25 69 00 63 6f       	and    $0x6f630069,%eax
+  8059e3:	70 69                	jo     805a4e <__rodata_start+0xe6>
+  8059e5:	65 64 00 6d 61       	gs add %ch,%fs:0x61(%rbp)
+  8059ea:	70 70                	jo     805a5c <__rodata_start+0xf4>
+  8059ec:	65 64 00 90 63 61 74 	gs add %dl,%fs:0x62746163(%rax)
+  8059f3:	62 
+  8059f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8059f6:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8059f9:	20 25 73 20 72 65    	and    %ah,0x65722073(%rip)        # 65f27a72 <__bss_end+0x656a5a72>
+  8059ff:	61                   	(bad)
+  805a00:	64 73 3a             	fs jae 805a3d <__rodata_start+0xd5>
+  805a03:	20 25 6c 75 20 4d    	and    %ah,0x4d20756c(%rip)        # 4da0cf75 <__bss_end+0x4d18af75>
+  805a09:	42 2f                	rex.X (bad)
+  805a0b:	73 2c                	jae    805a39 <__rodata_start+0xd1>
+  805a0d:	20 25 6c 75 2e 25    	and    %ah,0x252e756c(%rip)        # 25aecf7f <__bss_end+0x2526af7f>
+  805a13:	30 32                	xor    %dh,(%rdx)
+  805a15:	6c                   	insb   (%dx),%es:(%rdi)
+  805a16:	75 20                	jne    805a38 <__rodata_start+0xd0>
+  805a18:	63 79 63             	movsxd 0x63(%rcx),%edi
+  805a1b:	6c                   	insb   (%dx),%es:(%rdi)
+  805a1c:	65 73 20             	gs jae 805a3f <__rodata_start+0xd7>
+  805a1f:	70 65                	jo     805a86 <__rodata_start+0x11e>
+  805a21:	72 20                	jb     805a43 <__rodata_start+0xdb>
+  805a23:	62                   	(bad)
+  805a24:	79 74                	jns    805a9a <__rodata_start+0x132>
+  805a26:	65 0a 00             	or     %gs:(%rax),%al
+  805a29:	00 00                	add    %al,(%rax)
+  805a2b:	00 00                	add    %al,(%rax)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 63 61             	add    %ah,0x61(%rbx)
+  805a32:	74 62                	je     805a96 <__rodata_start+0x12e>
+  805a34:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805a36:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  805a39:	20 25 6c 75 20 4b    	and    %ah,0x4b20756c(%rip)        # 4ba0cfab <__bss_end+0x4b18afab>
+  805a3f:	42 2c 20             	rex.X sub $0x20,%al
+  805a42:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  805a47:	42 2f                	rex.X (bad)
+  805a49:	73 2c                	jae    805a77 <__rodata_start+0x10f>
+  805a4b:	20 25 6c 75 20 72    	and    %ah,0x7220756c(%rip)        # 72a0cfbd <__bss_end+0x7218afbd>
+  805a51:	65 61                	gs (bad)
+  805a53:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  805a57:	6d                   	insl   (%dx),%es:(%rdi)
+  805a58:	6d                   	insl   (%dx),%es:(%rdi)
+  805a59:	61                   	(bad)
+  805a5a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a5b:	64 73 20             	fs jae 805a7e <__rodata_start+0x116>
+  805a5e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805a60:	72 20                	jb     805a82 <__rodata_start+0x11a>
+  805a62:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  805a67:	6c                   	insb   (%dx),%es:(%rdi)
+  805a68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a69:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  805a6c:	0a 00                	or     (%rax),%al
+  805a6e:	00 00                	add    %al,(%rax)
+  805a70:	63 61 74             	movsxd 0x74(%rcx),%esp
+  805a73:	62 65 6e 63 68       	(bad)
+  805a78:	3a 20                	cmp    (%rax),%ah
+  805a7a:	25 6c 75 2e 25       	and    $0x252e756c,%eax
+  805a7f:	30 32                	xor    %dh,(%rdx)
+  805a81:	6c                   	insb   (%dx),%es:(%rdi)
+  805a82:	75 20                	jne    805aa4 <__rodata_start+0x13c>
+  805a84:	63 79 63             	movsxd 0x63(%rcx),%edi
+  805a87:	6c                   	insb   (%dx),%es:(%rdi)
+  805a88:	65 73 20             	gs jae 805aab <__rodata_start+0x143>
+  805a8b:	70 65                	jo     805af2 <__rodata_start+0x18a>
+  805a8d:	72 20                	jb     805aaf <__rodata_start+0x147>
+  805a8f:	62                   	(bad)
+  805a90:	79 74                	jns    805b06 <__rodata_start+0x19e>
+  805a92:	65 0a 00             	or     %gs:(%rax),%al
+  805a95:	3c 75                	cmp    $0x75,%al
+  805a97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a98:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  805a9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805a9d:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  805aa4:	78 5d                	js     805b03 <__rodata_start+0x19b>
+  805aa6:	20 75 73             	and    %dh,0x73(%rbp)
+  805aa9:	65 72 20             	gs jb  805acc <__rodata_start+0x164>
+  805aac:	70 61                	jo     805b0f <__rodata_start+0x1a7>
+  805aae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805aaf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805ab6:	73 20                	jae    805ad8 <__rodata_start+0x170>
+  805ab8:	61                   	(bad)
+  805ab9:	74 20                	je     805adb <__rodata_start+0x173>
+  805abb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805ac0:	3a 20                	cmp    (%rax),%ah
+  805ac2:	00 30                	add    %dh,(%rax)
+  805ac4:	31 32                	xor    %esi,(%rdx)
+  805ac6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805acd:	41                   	rex.B
+  805ace:	42                   	rex.X
+  805acf:	43                   	rex.XB
+  805ad0:	44                   	rex.R
+  805ad1:	45                   	rex.RB
+  805ad2:	46 00 30             	rex.RX add %r14b,(%rax)
+  805ad5:	31 32                	xor    %esi,(%rdx)
+  805ad7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805ade:	61                   	(bad)
+  805adf:	62 63 64 65 66       	(bad)
+  805ae4:	00 28                	add    %ch,(%rax)
+  805ae6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ae7:	75 6c                	jne    805b55 <__rodata_start+0x1ed>
+  805ae9:	6c                   	insb   (%dx),%es:(%rdi)
+  805aea:	29 00                	sub    %eax,(%rax)
+  805aec:	65 72 72             	gs jb  805b61 <__rodata_start+0x1f9>
+  805aef:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805af0:	72 20                	jb     805b12 <__rodata_start+0x1aa>
+  805af2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805af7:	73 70                	jae    805b69 <__rodata_start+0x201>
+  805af9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805afd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805b04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b05:	72 00                	jb     805b07 <__rodata_start+0x19f>
+  805b07:	62 61 64 20 65       	(bad)
+  805b0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b0d:	76 69                	jbe    805b78 <__rodata_start+0x210>
+  805b0f:	72 6f                	jb     805b80 <__rodata_start+0x218>
+  805b11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b12:	6d                   	insl   (%dx),%es:(%rdi)
+  805b13:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b15:	74 00                	je     805b17 <__rodata_start+0x1af>
+  805b17:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805b1e:	20 70 61             	and    %dh,0x61(%rax)
+  805b21:	72 61                	jb     805b84 <__rodata_start+0x21c>
+  805b23:	6d                   	insl   (%dx),%es:(%rdi)
+  805b24:	65 74 65             	gs je  805b8c <__rodata_start+0x224>
+  805b27:	72 00                	jb     805b29 <__rodata_start+0x1c1>
+  805b29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b2a:	75 74                	jne    805ba0 <__rodata_start+0x238>
+  805b2c:	20 6f 66             	and    %ch,0x66(%rdi)
+  805b2f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805b32:	6d                   	insl   (%dx),%es:(%rdi)
+  805b33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b34:	72 79                	jb     805baf <__rodata_start+0x247>
+  805b36:	00 6f 75             	add    %ch,0x75(%rdi)
+  805b39:	74 20                	je     805b5b <__rodata_start+0x1f3>
+  805b3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b3c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805b40:	76 69                	jbe    805bab <__rodata_start+0x243>
+  805b42:	72 6f                	jb     805bb3 <__rodata_start+0x24b>
+  805b44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b45:	6d                   	insl   (%dx),%es:(%rdi)
+  805b46:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b48:	74 73                	je     805bbd <__rodata_start+0x255>
+  805b4a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805b4d:	72 72                	jb     805bc1 <__rodata_start+0x259>
+  805b4f:	75 70                	jne    805bc1 <__rodata_start+0x259>
+  805b51:	74 65                	je     805bb8 <__rodata_start+0x250>
+  805b53:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805b58:	75 67                	jne    805bc1 <__rodata_start+0x259>
+  805b5a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805b5d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805b5f:	00 73 65             	add    %dh,0x65(%rbx)
+  805b62:	67 6d                	insl   (%dx),%es:(%edi)
+  805b64:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b66:	74 61                	je     805bc9 <__rodata_start+0x261>
+  805b68:	74 69                	je     805bd3 <__rodata_start+0x26b>
+  805b6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b6c:	20 66 61             	and    %ah,0x61(%rsi)
+  805b6f:	75 6c                	jne    805bdd <__rodata_start+0x275>
+  805b71:	74 00                	je     805b73 <__rodata_start+0x20b>
+  805b73:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805b7a:	20 45 4c             	and    %al,0x4c(%rbp)
+  805b7d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805b81:	61                   	(bad)
+  805b82:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805b87:	20 73 75             	and    %dh,0x75(%rbx)
+  805b8a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805b8d:	73 79                	jae    805c08 <__rodata_start+0x2a0>
+  805b8f:	73 74                	jae    805c05 <__rodata_start+0x29d>
+  805b91:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805b93:	20 63 61             	and    %ah,0x61(%rbx)
+  805b96:	6c                   	insb   (%dx),%es:(%rdi)
+  805b97:	6c                   	insb   (%dx),%es:(%rdi)
+  805b98:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805b9b:	74 72                	je     805c0f <__rodata_start+0x2a7>
+  805b9d:	79 20                	jns    805bbf <__rodata_start+0x257>
+  805b9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ba0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ba1:	74 20                	je     805bc3 <__rodata_start+0x25b>
+  805ba3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805ba5:	75 6e                	jne    805c15 <__rodata_start+0x2ad>
+  805ba7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805bab:	76 20                	jbe    805bcd <__rodata_start+0x265>
+  805bad:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805bb4:	72 65                	jb     805c1b <__rodata_start+0x2b3>
+  805bb6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805bb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805bbe:	65 78 70             	gs js  805c31 <__rodata_start+0x2c9>
+  805bc1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805bc6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805bc9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805bcd:	20 66 69             	and    %ah,0x69(%rsi)
+  805bd0:	6c                   	insb   (%dx),%es:(%rdi)
+  805bd1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805bd5:	20 66 72             	and    %ah,0x72(%rsi)
+  805bd8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805bdd:	61                   	(bad)
+  805bde:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805be1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805be2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805be3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805be7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805bea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805beb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bec:	20 6d 61             	and    %ch,0x61(%rbp)
+  805bef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bf0:	79 20                	jns    805c12 <__rodata_start+0x2aa>
+  805bf2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805bf9:	72 65                	jb     805c60 <__rodata_start+0x2f8>
+  805bfb:	20 6f 70             	and    %ch,0x70(%rdi)
+  805bfe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c00:	00 66 69             	add    %ah,0x69(%rsi)
+  805c03:	6c                   	insb   (%dx),%es:(%rdi)
+  805c04:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805c08:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805c0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c0c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805c0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c11:	74 20                	je     805c33 <__rodata_start+0x2cb>
+  805c13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805c15:	75 6e                	jne    805c85 <__rodata_start+0x31d>
+  805c17:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805c1b:	76 61                	jbe    805c7e <__rodata_start+0x316>
+  805c1d:	6c                   	insb   (%dx),%es:(%rdi)
+  805c1e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805c25:	00 
+  805c26:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805c2d:	72 65                	jb     805c94 <__rodata_start+0x32c>
+  805c2f:	61                   	(bad)
+  805c30:	64 79 20             	fs jns 805c53 <__rodata_start+0x2eb>
+  805c33:	65 78 69             	gs js  805c9f <__rodata_start+0x337>
+  805c36:	73 74                	jae    805cac <__rodata_start+0x344>
+  805c38:	73 00                	jae    805c3a <__rodata_start+0x2d2>
+  805c3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c3b:	70 65                	jo     805ca2 <__rodata_start+0x33a>
+  805c3d:	72 61                	jb     805ca0 <__rodata_start+0x338>
+  805c3f:	74 69                	je     805caa <__rodata_start+0x342>
+  805c41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c43:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805c46:	74 20                	je     805c68 <__rodata_start+0x300>
+  805c48:	73 75                	jae    805cbf <__rodata_start+0x357>
+  805c4a:	70 70                	jo     805cbc <__rodata_start+0x354>
+  805c4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c4d:	72 74                	jb     805cc3 <__rodata_start+0x35b>
+  805c4f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805c55:	20 61 67             	and    %ah,0x67(%rcx)
+  805c58:	61                   	(bad)
+  805c59:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805c60:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805c64:	74 00                	je     805c66 <__rodata_start+0x2fe>
+  805c66:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805c6d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805c70:	20 75 73             	and    %dh,0x73(%rbp)
+  805c73:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805c77:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805c7e:	00 
+  805c7f:	90                   	nop
+  805c80:	b6 09                	mov    $0x9,%dh
+  805c82:	80 00 00             	addb   $0x0,(%rax)
+  805c85:	00 00                	add    %al,(%rax)
+  805c87:	00 f7                	add    %dh,%bh
+  805c89:	0f 80 00 00 00 00    	jo     805c8f <__rodata_start+0x327>
+  805c8f:	00 e7                	add    %ah,%bh
+  805c91:	0f 80 00 00 00 00    	jo     805c97 <__rodata_start+0x32f>
+  805c97:	00 f7                	add    %dh,%bh
+  805c99:	0f 80 00 00 00 00    	jo     805c9f <__rodata_start+0x337>
+  805c9f:	00 f7                	add    %dh,%bh
+  805ca1:	0f 80 00 00 00 00    	jo     805ca7 <__rodata_start+0x33f>
+  805ca7:	00 f7                	add    %dh,%bh
+  805ca9:	0f 80 00 00 00 00    	jo     805caf <__rodata_start+0x347>
+  805caf:	00 f7                	add    %dh,%bh
+  805cb1:	0f 80 00 00 00 00    	jo     805cb7 <__rodata_start+0x34f>
+  805cb7:	00 d5                	add    %dl,%ch
+  805cb9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805cbf:	00 f7                	add    %dh,%bh
+  805cc1:	0f 80 00 00 00 00    	jo     805cc7 <__rodata_start+0x35f>
+  805cc7:	00 f7                	add    %dh,%bh
+  805cc9:	0f 80 00 00 00 00    	jo     805ccf <__rodata_start+0x367>
+  805ccf:	00 c9                	add    %cl,%cl
+  805cd1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805cd7:	00 43 0a             	add    %al,0xa(%rbx)
+  805cda:	80 00 00             	addb   $0x0,(%rax)
+  805cdd:	00 00                	add    %al,(%rax)
+  805cdf:	00 f7                	add    %dh,%bh
+  805ce1:	0f 80 00 00 00 00    	jo     805ce7 <__rodata_start+0x37f>
+  805ce7:	00 c9                	add    %cl,%cl
+  805ce9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805cef:	00 0f                	add    %cl,(%rdi)
+  805cf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805cf7:	00 0f                	add    %cl,(%rdi)
+  805cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805cff:	00 0f                	add    %cl,(%rdi)
+  805d01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d07:	00 0f                	add    %cl,(%rdi)
+  805d09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d0f:	00 0f                	add    %cl,(%rdi)
+  805d11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d17:	00 0f                	add    %cl,(%rdi)
+  805d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d1f:	00 0f                	add    %cl,(%rdi)
+  805d21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d27:	00 0f                	add    %cl,(%rdi)
+  805d29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d2f:	00 0f                	add    %cl,(%rdi)
+  805d31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d37:	00 f7                	add    %dh,%bh
+  805d39:	0f 80 00 00 00 00    	jo     805d3f <__rodata_start+0x3d7>
+  805d3f:	00 f7                	add    %dh,%bh
+  805d41:	0f 80 00 00 00 00    	jo     805d47 <__rodata_start+0x3df>
+  805d47:	00 f7                	add    %dh,%bh
+  805d49:	0f 80 00 00 00 00    	jo     805d4f <__rodata_start+0x3e7>
+  805d4f:	00 f7                	add    %dh,%bh
+  805d51:	0f 80 00 00 00 00    	jo     805d57 <__rodata_start+0x3ef>
+  805d57:	00 f7                	add    %dh,%bh
+  805d59:	0f 80 00 00 00 00    	jo     805d5f <__rodata_start+0x3f7>
+  805d5f:	00 f7                	add    %dh,%bh
+  805d61:	0f 80 00 00 00 00    	jo     805d67 <__rodata_start+0x3ff>
+  805d67:	00 f7                	add    %dh,%bh
+  805d69:	0f 80 00 00 00 00    	jo     805d6f <__rodata_start+0x407>
+  805d6f:	00 f7                	add    %dh,%bh
+  805d71:	0f 80 00 00 00 00    	jo     805d77 <__rodata_start+0x40f>
+  805d77:	00 f7                	add    %dh,%bh
+  805d79:	0f 80 00 00 00 00    	jo     805d7f <__rodata_start+0x417>
+  805d7f:	00 f7                	add    %dh,%bh
+  805d81:	0f 80 00 00 00 00    	jo     805d87 <__rodata_start+0x41f>
+  805d87:	00 f7                	add    %dh,%bh
+  805d89:	0f 80 00 00 00 00    	jo     805d8f <__rodata_start+0x427>
+  805d8f:	00 f7                	add    %dh,%bh
+  805d91:	0f 80 00 00 00 00    	jo     805d97 <__rodata_start+0x42f>
+  805d97:	00 f7                	add    %dh,%bh
+  805d99:	0f 80 00 00 00 00    	jo     805d9f <__rodata_start+0x437>
+  805d9f:	00 f7                	add    %dh,%bh
+  805da1:	0f 80 00 00 00 00    	jo     805da7 <__rodata_start+0x43f>
+  805da7:	00 f7                	add    %dh,%bh
+  805da9:	0f 80 00 00 00 00    	jo     805daf <__rodata_start+0x447>
+  805daf:	00 f7                	add    %dh,%bh
+  805db1:	0f 80 00 00 00 00    	jo     805db7 <__rodata_start+0x44f>
+  805db7:	00 f7                	add    %dh,%bh
+  805db9:	0f 80 00 00 00 00    	jo     805dbf <__rodata_start+0x457>
+  805dbf:	00 f7                	add    %dh,%bh
+  805dc1:	0f 80 00 00 00 00    	jo     805dc7 <__rodata_start+0x45f>
+  805dc7:	00 f7                	add    %dh,%bh
+  805dc9:	0f 80 00 00 00 00    	jo     805dcf <__rodata_start+0x467>
+  805dcf:	00 f7                	add    %dh,%bh
+  805dd1:	0f 80 00 00 00 00    	jo     805dd7 <__rodata_start+0x46f>
+  805dd7:	00 f7                	add    %dh,%bh
+  805dd9:	0f 80 00 00 00 00    	jo     805ddf <__rodata_start+0x477>
+  805ddf:	00 f7                	add    %dh,%bh
+  805de1:	0f 80 00 00 00 00    	jo     805de7 <__rodata_start+0x47f>
+  805de7:	00 f7                	add    %dh,%bh
+  805de9:	0f 80 00 00 00 00    	jo     805def <__rodata_start+0x487>
+  805def:	00 f7                	add    %dh,%bh
+  805df1:	0f 80 00 00 00 00    	jo     805df7 <__rodata_start+0x48f>
+  805df7:	00 f7                	add    %dh,%bh
+  805df9:	0f 80 00 00 00 00    	jo     805dff <__rodata_start+0x497>
+  805dff:	00 f7                	add    %dh,%bh
+  805e01:	0f 80 00 00 00 00    	jo     805e07 <__rodata_start+0x49f>
+  805e07:	00 f7                	add    %dh,%bh
+  805e09:	0f 80 00 00 00 00    	jo     805e0f <__rodata_start+0x4a7>
+  805e0f:	00 f7                	add    %dh,%bh
+  805e11:	0f 80 00 00 00 00    	jo     805e17 <__rodata_start+0x4af>
+  805e17:	00 f7                	add    %dh,%bh
+  805e19:	0f 80 00 00 00 00    	jo     805e1f <__rodata_start+0x4b7>
+  805e1f:	00 f7                	add    %dh,%bh
+  805e21:	0f 80 00 00 00 00    	jo     805e27 <__rodata_start+0x4bf>
+  805e27:	00 1a                	add    %bl,(%rdx)
+  805e29:	0f 80 00 00 00 00    	jo     805e2f <__rodata_start+0x4c7>
+  805e2f:	00 f7                	add    %dh,%bh
+  805e31:	0f 80 00 00 00 00    	jo     805e37 <__rodata_start+0x4cf>
+  805e37:	00 f7                	add    %dh,%bh
+  805e39:	0f 80 00 00 00 00    	jo     805e3f <__rodata_start+0x4d7>
+  805e3f:	00 f7                	add    %dh,%bh
+  805e41:	0f 80 00 00 00 00    	jo     805e47 <__rodata_start+0x4df>
+  805e47:	00 f7                	add    %dh,%bh
+  805e49:	0f 80 00 00 00 00    	jo     805e4f <__rodata_start+0x4e7>
+  805e4f:	00 f7                	add    %dh,%bh
+  805e51:	0f 80 00 00 00 00    	jo     805e57 <__rodata_start+0x4ef>
+  805e57:	00 f7                	add    %dh,%bh
+  805e59:	0f 80 00 00 00 00    	jo     805e5f <__rodata_start+0x4f7>
+  805e5f:	00 f7                	add    %dh,%bh
+  805e61:	0f 80 00 00 00 00    	jo     805e67 <__rodata_start+0x4ff>
+  805e67:	00 f7                	add    %dh,%bh
+  805e69:	0f 80 00 00 00 00    	jo     805e6f <__rodata_start+0x507>
+  805e6f:	00 f7                	add    %dh,%bh
+  805e71:	0f 80 00 00 00 00    	jo     805e77 <__rodata_start+0x50f>
+  805e77:	00 f7                	add    %dh,%bh
+  805e79:	0f 80 00 00 00 00    	jo     805e7f <__rodata_start+0x517>
+  805e7f:	00 66 0a             	add    %ah,0xa(%rsi)
+  805e82:	80 00 00             	addb   $0x0,(%rax)
+  805e85:	00 00                	add    %al,(%rax)
+  805e87:	00 35 0c 80 00 00    	add    %dh,0x800c(%rip)        # 80de99 <__ctors_end+0x6db9>
+  805e8d:	00 00                	add    %al,(%rax)
+  805e8f:	00 f7                	add    %dh,%bh
+  805e91:	0f 80 00 00 00 00    	jo     805e97 <__rodata_start+0x52f>
+  805e97:	00 f7                	add    %dh,%bh
+  805e99:	0f 80 00 00 00 00    	jo     805e9f <__rodata_start+0x537>
+  805e9f:	00 f7                	add    %dh,%bh
+  805ea1:	0f 80 00 00 00 00    	jo     805ea7 <__rodata_start+0x53f>
+  805ea7:	00 f7                	add    %dh,%bh
+  805ea9:	0f 80 00 00 00 00    	jo     805eaf <__rodata_start+0x547>
+  805eaf:	00 95 0a 80 00 00    	add    %dl,0x800a(%rbp)
+  805eb5:	00 00                	add    %al,(%rax)
+  805eb7:	00 f7                	add    %dh,%bh
+  805eb9:	0f 80 00 00 00 00    	jo     805ebf <__rodata_start+0x557>
+  805ebf:	00 f7                	add    %dh,%bh
+  805ec1:	0f 80 00 00 00 00    	jo     805ec7 <__rodata_start+0x55f>
+  805ec7:	00 5b 0a             	add    %bl,0xa(%rbx)
+  805eca:	80 00 00             	addb   $0x0,(%rax)
+  805ecd:	00 00                	add    %al,(%rax)
+  805ecf:	00 f7                	add    %dh,%bh
+  805ed1:	0f 80 00 00 00 00    	jo     805ed7 <__rodata_start+0x56f>
+  805ed7:	00 f7                	add    %dh,%bh
+  805ed9:	0f 80 00 00 00 00    	jo     805edf <__rodata_start+0x577>
+  805edf:	00 dd                	add    %bl,%ch
+  805ee1:	0d 80 00 00 00       	or     $0x80,%eax
+  805ee6:	00 00                	add    %al,(%rax)
+  805ee8:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  805ee9:	0e                   	(bad)
+  805eea:	80 00 00             	addb   $0x0,(%rax)
+  805eed:	00 00                	add    %al,(%rax)
+  805eef:	00 f7                	add    %dh,%bh
+  805ef1:	0f 80 00 00 00 00    	jo     805ef7 <__rodata_start+0x58f>
+  805ef7:	00 f7                	add    %dh,%bh
+  805ef9:	0f 80 00 00 00 00    	jo     805eff <__rodata_start+0x597>
+  805eff:	00 2c 0b             	add    %ch,(%rbx,%rcx,1)
+  805f02:	80 00 00             	addb   $0x0,(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 f7                	add    %dh,%bh
+  805f09:	0f 80 00 00 00 00    	jo     805f0f <__rodata_start+0x5a7>
+  805f0f:	00 09                	add    %cl,(%rcx)
+  805f11:	0d 80 00 00 00       	or     $0x80,%eax
+  805f16:	00 00                	add    %al,(%rax)
+  805f18:	f7 0f 80 00 00 00    	testl  $0x80,(%rdi)
+  805f1e:	00 00                	add    %al,(%rax)
+  805f20:	f7 0f 80 00 00 00    	testl  $0x80,(%rdi)
+  805f26:	00 00                	add    %al,(%rax)
+  805f28:	1a 0f                	sbb    (%rdi),%cl
+  805f2a:	80 00 00             	addb   $0x0,(%rax)
+  805f2d:	00 00                	add    %al,(%rax)
+  805f2f:	00 f7                	add    %dh,%bh
+  805f31:	0f 80 00 00 00 00    	jo     805f37 <__rodata_start+0x5cf>
+  805f37:	00 bf 09 80 00 00    	add    %bh,0x8009(%rdi)
+  805f3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805f40 <error_string>:
+	...
+  805f48:	f5 5a 80 00 00 00 00 00 07 5b 80 00 00 00 00 00     .Z.......[......
+  805f58:	17 5b 80 00 00 00 00 00 29 5b 80 00 00 00 00 00     .[......)[......
+  805f68:	37 5b 80 00 00 00 00 00 4b 5b 80 00 00 00 00 00     7[......K[......
+  805f78:	60 5b 80 00 00 00 00 00 73 5b 80 00 00 00 00 00     `[......s[......
+  805f88:	85 5b 80 00 00 00 00 00 99 5b 80 00 00 00 00 00     .[.......[......
+  805f98:	a9 5b 80 00 00 00 00 00 bc 5b 80 00 00 00 00 00     .[.......[......
+  805fa8:	d3 5b 80 00 00 00 00 00 e9 5b 80 00 00 00 00 00     .[.......[......
+  805fb8:	01 5c 80 00 00 00 00 00 19 5c 80 00 00 00 00 00     .\.......\......
+  805fc8:	26 5c 80 00 00 00 00 00 f8 5f 80 00 00 00 00 00     &\......._......
+  805fd8:	3a 5c 80 00 00 00 00 00 52 5c 80 00 00 00 00 00     :\......R\......
+  805fe8:	5c 5c 80 00 00 00 00 00 66 5c 80 00 00 00 00 00     \\......f\......
+  805ff8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  806008:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  806018:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806028:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806038:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  806048:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  806058:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  806068:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  806078:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806088:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806098:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8060a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8060b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8060c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8060d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8060e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8060f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000806100 <devtab>:
+  806100:	20 70 80 00 00 00 00 00 60 70 80 00 00 00 00 00      p......`p......
+  806110:	a0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806120:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806130:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  806140:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  806150:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  806160:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  806170:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  806180:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  806190:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  8061a0:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  8061b0:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  8061c0:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  8061d0:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  8061e0:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  8061f0:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  806200:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  806210:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  806220:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  806230:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  806240:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  806250:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806260:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806270:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806280:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 66 90     c.<cons>.cons.f.
+  806290:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8062a0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8062b0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8062c0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8062d0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8062e0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8062f0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806300:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  806310:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  806320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
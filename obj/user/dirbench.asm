@@ -0,0 +1,8659 @@
+
+obj/user/dirbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4a 03 00 00       	call   80036d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+            op, (unsigned long)(cycles / NFILES), (unsigned long)((fs->env_cycles - fs_start) / NFILES),
+            (unsigned long)((cs1.cs_hits + cs1.cs_misses - cs0->cs_hits - cs0->cs_misses) / NFILES));
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 81 ec 88 04 00 00 	sub    $0x488,%rsp
+    char path[MAXPATHLEN];
+    struct CacheStat cs;
+    int fd, res;
+
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+  800039:	bf 03 00 00 00       	mov    $0x3,%edi
+  80003e:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  800045:	00 00 00 
+  800048:	ff d0                	call   *%rax
+    if (!fsenv) panic("no file server");
+  80004a:	85 c0                	test   %eax,%eax
+  80004c:	74 29                	je     800077 <umain+0x52>
+    const volatile struct Env *fs = &envs[ENVX(fsenv)];
+
+    for (int op = 0; op < 3; op++) {
+  80004e:	c7 85 68 fb ff ff 00 	movl   $0x0,-0x498(%rbp)
+  800055:	00 00 00 
+        if ((res = cache_stat(&cs)) < 0) panic("cache_stat: %i", res);
+        uint64_t fs_start = fs->env_cycles;
+  800058:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80005d:	48 89 c2             	mov    %rax,%rdx
+  800060:	48 c1 e2 04          	shl    $0x4,%rdx
+  800064:	48 29 c2             	sub    %rax,%rdx
+  800067:	48 c1 e2 05          	shl    $0x5,%rdx
+  80006b:	48 89 95 60 fb ff ff 	mov    %rdx,-0x4a0(%rbp)
+  800072:	e9 23 02 00 00       	jmp    80029a <umain+0x275>
+    if (!fsenv) panic("no file server");
+  800077:	48 ba de 49 80 00 00 	movabs $0x8049de,%rdx
+  80007e:	00 00 00 
+  800081:	be 22 00 00 00       	mov    $0x22,%esi
+  800086:	48 bf ed 49 80 00 00 	movabs $0x8049ed,%rdi
+  80008d:	00 00 00 
+  800090:	48 b9 43 04 80 00 00 	movabs $0x800443,%rcx
+  800097:	00 00 00 
+  80009a:	ff d1                	call   *%rcx
+        if ((res = cache_stat(&cs)) < 0) panic("cache_stat: %i", res);
+  80009c:	89 c1                	mov    %eax,%ecx
+  80009e:	48 ba fd 49 80 00 00 	movabs $0x8049fd,%rdx
+  8000a5:	00 00 00 
+  8000a8:	be 26 00 00 00       	mov    $0x26,%esi
+  8000ad:	48 bf ed 49 80 00 00 	movabs $0x8049ed,%rdi
+  8000b4:	00 00 00 
+  8000b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bc:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  8000c3:	00 00 00 
+  8000c6:	41 ff d0             	call   *%r8
+        uint64_t start = read_tsc();
+
+        for (int i = 0; i < NFILES; i++) {
+            name(path, i);
+            if (op == 2) {
+                if ((res = remove(path)) < 0) panic("remove %s: %i", path, res);
+  8000c9:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  8000d0:	48 b8 63 34 80 00 00 	movabs $0x803463,%rax
+  8000d7:	00 00 00 
+  8000da:	ff d0                	call   *%rax
+  8000dc:	85 c0                	test   %eax,%eax
+  8000de:	79 38                	jns    800118 <umain+0xf3>
+  8000e0:	41 89 c0             	mov    %eax,%r8d
+  8000e3:	48 8d 8d d0 fb ff ff 	lea    -0x430(%rbp),%rcx
+  8000ea:	48 ba 1a 4a 80 00 00 	movabs $0x804a1a,%rdx
+  8000f1:	00 00 00 
+  8000f4:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8000f9:	48 bf ed 49 80 00 00 	movabs $0x8049ed,%rdi
+  800100:	00 00 00 
+  800103:	b8 00 00 00 00       	mov    $0x0,%eax
+  800108:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  80010f:	00 00 00 
+  800112:	41 ff d1             	call   *%r9
+                continue;
+            }
+            if ((fd = open(path, op ? O_RDONLY : O_RDWR | O_CREAT | O_EXCL)) < 0)
+                panic("open %s: %i", path, fd);
+            close(fd);
+  800115:	41 ff d6             	call   *%r14
+        for (int i = 0; i < NFILES; i++) {
+  800118:	83 c3 01             	add    $0x1,%ebx
+  80011b:	81 fb 10 27 00 00    	cmp    $0x2710,%ebx
+  800121:	74 71                	je     800194 <umain+0x16f>
+    snprintf(path, MAXPATHLEN, "/dirbench%05d", i);
+  800123:	89 d9                	mov    %ebx,%ecx
+  800125:	48 ba 0c 4a 80 00 00 	movabs $0x804a0c,%rdx
+  80012c:	00 00 00 
+  80012f:	be 00 04 00 00       	mov    $0x400,%esi
+  800134:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  80013b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800140:	41 ff d4             	call   *%r12
+            if (op == 2) {
+  800143:	41 83 fd 02          	cmp    $0x2,%r13d
+  800147:	74 80                	je     8000c9 <umain+0xa4>
+            if ((fd = open(path, op ? O_RDONLY : O_RDWR | O_CREAT | O_EXCL)) < 0)
+  800149:	8b b5 6c fb ff ff    	mov    -0x494(%rbp),%esi
+  80014f:	48 8d bd d0 fb ff ff 	lea    -0x430(%rbp),%rdi
+  800156:	41 ff d7             	call   *%r15
+  800159:	89 c7                	mov    %eax,%edi
+  80015b:	85 c0                	test   %eax,%eax
+  80015d:	79 b6                	jns    800115 <umain+0xf0>
+                panic("open %s: %i", path, fd);
+  80015f:	41 89 c0             	mov    %eax,%r8d
+  800162:	48 8d 8d d0 fb ff ff 	lea    -0x430(%rbp),%rcx
+  800169:	48 ba 28 4a 80 00 00 	movabs $0x804a28,%rdx
+  800170:	00 00 00 
+  800173:	be 31 00 00 00       	mov    $0x31,%esi
+  800178:	48 bf ed 49 80 00 00 	movabs $0x8049ed,%rdi
+  80017f:	00 00 00 
+  800182:	b8 00 00 00 00       	mov    $0x0,%eax
+  800187:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  80018e:	00 00 00 
+  800191:	41 ff d1             	call   *%r9
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800194:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800196:	48 c1 e2 20          	shl    $0x20,%rdx
+  80019a:	89 c0                	mov    %eax,%eax
+  80019c:	48 09 c2             	or     %rax,%rdx
+        }
+
+        report(op == 0 ? "create" : op == 1 ? "open" : "remove",
+  80019f:	48 8b 85 50 fb ff ff 	mov    -0x4b0(%rbp),%rax
+  8001a6:	48 29 c2             	sub    %rax,%rdx
+  8001a9:	48 89 d3             	mov    %rdx,%rbx
+  8001ac:	49 bc d7 49 80 00 00 	movabs $0x8049d7,%r12
+  8001b3:	00 00 00 
+  8001b6:	8b 85 68 fb ff ff    	mov    -0x498(%rbp),%eax
+  8001bc:	85 c0                	test   %eax,%eax
+  8001be:	74 1b                	je     8001db <umain+0x1b6>
+  8001c0:	83 f8 01             	cmp    $0x1,%eax
+  8001c3:	49 bc d0 49 80 00 00 	movabs $0x8049d0,%r12
+  8001ca:	00 00 00 
+  8001cd:	48 b8 f4 4b 80 00 00 	movabs $0x804bf4,%rax
+  8001d4:	00 00 00 
+  8001d7:	4c 0f 44 e0          	cmove  %rax,%r12
+    int res = cache_stat(&cs1);
+  8001db:	48 8d bd 70 fb ff ff 	lea    -0x490(%rbp),%rdi
+  8001e2:	48 b8 bf 35 80 00 00 	movabs $0x8035bf,%rax
+  8001e9:	00 00 00 
+  8001ec:	ff d0                	call   *%rax
+    if (res < 0) panic("cache_stat: %i", res);
+  8001ee:	85 c0                	test   %eax,%eax
+  8001f0:	0f 88 38 01 00 00    	js     80032e <umain+0x309>
+            op, (unsigned long)(cycles / NFILES), (unsigned long)((fs->env_cycles - fs_start) / NFILES),
+  8001f6:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8001fd:	00 00 00 
+  800200:	48 8b 8d 60 fb ff ff 	mov    -0x4a0(%rbp),%rcx
+  800207:	48 01 c8             	add    %rcx,%rax
+  80020a:	48 8b 88 d0 01 00 00 	mov    0x1d0(%rax),%rcx
+            (unsigned long)((cs1.cs_hits + cs1.cs_misses - cs0->cs_hits - cs0->cs_misses) / NFILES));
+  800211:	4c 8b 85 78 fb ff ff 	mov    -0x488(%rbp),%r8
+  800218:	4c 03 85 70 fb ff ff 	add    -0x490(%rbp),%r8
+  80021f:	4c 2b 85 a0 fb ff ff 	sub    -0x460(%rbp),%r8
+  800226:	4c 2b 85 a8 fb ff ff 	sub    -0x458(%rbp),%r8
+  80022d:	48 be 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rsi
+  800234:	c5 6d 34 
+  800237:	4c 89 c0             	mov    %r8,%rax
+  80023a:	48 f7 e6             	mul    %rsi
+  80023d:	49 89 d0             	mov    %rdx,%r8
+            op, (unsigned long)(cycles / NFILES), (unsigned long)((fs->env_cycles - fs_start) / NFILES),
+  800240:	48 8b 85 58 fb ff ff 	mov    -0x4a8(%rbp),%rax
+  800247:	48 29 c1             	sub    %rax,%rcx
+  80024a:	48 89 c8             	mov    %rcx,%rax
+  80024d:	48 f7 e6             	mul    %rsi
+  800250:	48 89 d1             	mov    %rdx,%rcx
+  800253:	48 c1 e9 0b          	shr    $0xb,%rcx
+  800257:	48 89 d8             	mov    %rbx,%rax
+  80025a:	48 f7 e6             	mul    %rsi
+  80025d:	48 c1 ea 0b          	shr    $0xb,%rdx
+    cprintf("dirbench: %s: %lu cycles per file, file server %lu, %lu block lookups per file\n",
+  800261:	49 c1 e8 0b          	shr    $0xb,%r8
+  800265:	4c 89 e6             	mov    %r12,%rsi
+  800268:	48 bf 38 4a 80 00 00 	movabs $0x804a38,%rdi
+  80026f:	00 00 00 
+  800272:	b8 00 00 00 00       	mov    $0x0,%eax
+  800277:	49 b9 93 05 80 00 00 	movabs $0x800593,%r9
+  80027e:	00 00 00 
+  800281:	41 ff d1             	call   *%r9
+    for (int op = 0; op < 3; op++) {
+  800284:	83 85 68 fb ff ff 01 	addl   $0x1,-0x498(%rbp)
+  80028b:	8b 85 68 fb ff ff    	mov    -0x498(%rbp),%eax
+  800291:	83 f8 03             	cmp    $0x3,%eax
+  800294:	0f 84 c1 00 00 00    	je     80035b <umain+0x336>
+        if ((res = cache_stat(&cs)) < 0) panic("cache_stat: %i", res);
+  80029a:	48 8d bd a0 fb ff ff 	lea    -0x460(%rbp),%rdi
+  8002a1:	48 b8 bf 35 80 00 00 	movabs $0x8035bf,%rax
+  8002a8:	00 00 00 
+  8002ab:	ff d0                	call   *%rax
+  8002ad:	85 c0                	test   %eax,%eax
+  8002af:	0f 88 e7 fd ff ff    	js     80009c <umain+0x77>
+        uint64_t fs_start = fs->env_cycles;
+  8002b5:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8002bc:	00 00 00 
+  8002bf:	48 8b 8d 60 fb ff ff 	mov    -0x4a0(%rbp),%rcx
+  8002c6:	48 01 c8             	add    %rcx,%rax
+  8002c9:	48 8b 80 d0 01 00 00 	mov    0x1d0(%rax),%rax
+  8002d0:	48 89 85 58 fb ff ff 	mov    %rax,-0x4a8(%rbp)
+    asm volatile("rdtsc"
+  8002d7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8002d9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8002dd:	89 c0                	mov    %eax,%eax
+  8002df:	48 09 c2             	or     %rax,%rdx
+  8002e2:	48 89 95 50 fb ff ff 	mov    %rdx,-0x4b0(%rbp)
+        for (int i = 0; i < NFILES; i++) {
+  8002e9:	8b 85 68 fb ff ff    	mov    -0x498(%rbp),%eax
+  8002ef:	83 f8 01             	cmp    $0x1,%eax
+  8002f2:	45 19 ed             	sbb    %r13d,%r13d
+  8002f5:	41 81 e5 02 05 00 00 	and    $0x502,%r13d
+  8002fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+    snprintf(path, MAXPATHLEN, "/dirbench%05d", i);
+  800301:	49 bc 3d 0e 80 00 00 	movabs $0x800e3d,%r12
+  800308:	00 00 00 
+            if ((fd = open(path, op ? O_RDONLY : O_RDWR | O_CREAT | O_EXCL)) < 0)
+  80030b:	49 bf 64 32 80 00 00 	movabs $0x803264,%r15
+  800312:	00 00 00 
+            close(fd);
+  800315:	49 be 04 1c 80 00 00 	movabs $0x801c04,%r14
+  80031c:	00 00 00 
+  80031f:	44 89 ad 6c fb ff ff 	mov    %r13d,-0x494(%rbp)
+  800326:	41 89 c5             	mov    %eax,%r13d
+  800329:	e9 f5 fd ff ff       	jmp    800123 <umain+0xfe>
+    if (res < 0) panic("cache_stat: %i", res);
+  80032e:	89 c1                	mov    %eax,%ecx
+  800330:	48 ba fd 49 80 00 00 	movabs $0x8049fd,%rdx
+  800337:	00 00 00 
+  80033a:	be 14 00 00 00       	mov    $0x14,%esi
+  80033f:	48 bf ed 49 80 00 00 	movabs $0x8049ed,%rdi
+  800346:	00 00 00 
+  800349:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034e:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  800355:	00 00 00 
+  800358:	41 ff d0             	call   *%r8
+               read_tsc() - start, fs, fs_start, &cs);
+    }
+}
+  80035b:	48 81 c4 88 04 00 00 	add    $0x488,%rsp
+  800362:	5b                   	pop    %rbx
+  800363:	41 5c                	pop    %r12
+  800365:	41 5d                	pop    %r13
+  800367:	41 5e                	pop    %r14
+  800369:	41 5f                	pop    %r15
+  80036b:	5d                   	pop    %rbp
+  80036c:	c3                   	ret
+
+000000000080036d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80036d:	55                   	push   %rbp
+  80036e:	48 89 e5             	mov    %rsp,%rbp
+  800371:	41 56                	push   %r14
+  800373:	41 55                	push   %r13
+  800375:	41 54                	push   %r12
+  800377:	53                   	push   %rbx
+  800378:	41 89 fd             	mov    %edi,%r13d
+  80037b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80037e:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800385:	00 00 00 
+  800388:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80038f:	00 00 00 
+  800392:	48 39 c2             	cmp    %rax,%rdx
+  800395:	73 17                	jae    8003ae <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800397:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80039a:	49 89 c4             	mov    %rax,%r12
+  80039d:	48 83 c3 08          	add    $0x8,%rbx
+  8003a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a6:	ff 53 f8             	call   *-0x8(%rbx)
+  8003a9:	4c 39 e3             	cmp    %r12,%rbx
+  8003ac:	72 ef                	jb     80039d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003ae:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  8003ba:	89 c2                	mov    %eax,%edx
+  8003bc:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003c2:	48 89 d0             	mov    %rdx,%rax
+  8003c5:	48 c1 e0 04          	shl    $0x4,%rax
+  8003c9:	48 29 d0             	sub    %rdx,%rax
+  8003cc:	48 c1 e0 05          	shl    $0x5,%rax
+  8003d0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003d7:	00 00 00 
+  8003da:	48 01 d0             	add    %rdx,%rax
+  8003dd:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8003e4:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003e7:	45 85 ed             	test   %r13d,%r13d
+  8003ea:	7e 0d                	jle    8003f9 <libmain+0x8c>
+  8003ec:	49 8b 06             	mov    (%r14),%rax
+  8003ef:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003f6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003f9:	4c 89 f6             	mov    %r14,%rsi
+  8003fc:	44 89 ef             	mov    %r13d,%edi
+  8003ff:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800406:	00 00 00 
+  800409:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80040b:	48 b8 20 04 80 00 00 	movabs $0x800420,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+#endif
+}
+  800417:	5b                   	pop    %rbx
+  800418:	41 5c                	pop    %r12
+  80041a:	41 5d                	pop    %r13
+  80041c:	41 5e                	pop    %r14
+  80041e:	5d                   	pop    %rbp
+  80041f:	c3                   	ret
+
+0000000000800420 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800420:	55                   	push   %rbp
+  800421:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800424:	48 b8 37 1c 80 00 00 	movabs $0x801c37,%rax
+  80042b:	00 00 00 
+  80042e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800430:	bf 00 00 00 00       	mov    $0x0,%edi
+  800435:	48 b8 27 13 80 00 00 	movabs $0x801327,%rax
+  80043c:	00 00 00 
+  80043f:	ff d0                	call   *%rax
+}
+  800441:	5d                   	pop    %rbp
+  800442:	c3                   	ret
+
+0000000000800443 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800443:	55                   	push   %rbp
+  800444:	48 89 e5             	mov    %rsp,%rbp
+  800447:	41 56                	push   %r14
+  800449:	41 55                	push   %r13
+  80044b:	41 54                	push   %r12
+  80044d:	53                   	push   %rbx
+  80044e:	48 83 ec 50          	sub    $0x50,%rsp
+  800452:	49 89 fc             	mov    %rdi,%r12
+  800455:	41 89 f5             	mov    %esi,%r13d
+  800458:	48 89 d3             	mov    %rdx,%rbx
+  80045b:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80045f:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800463:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800467:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80046e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800472:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800476:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80047a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80047e:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800485:	00 00 00 
+  800488:	4c 8b 30             	mov    (%rax),%r14
+  80048b:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  800492:	00 00 00 
+  800495:	ff d0                	call   *%rax
+  800497:	89 c6                	mov    %eax,%esi
+  800499:	45 89 e8             	mov    %r13d,%r8d
+  80049c:	4c 89 e1             	mov    %r12,%rcx
+  80049f:	4c 89 f2             	mov    %r14,%rdx
+  8004a2:	48 bf 98 4a 80 00 00 	movabs $0x804a98,%rdi
+  8004a9:	00 00 00 
+  8004ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b1:	49 bc 93 05 80 00 00 	movabs $0x800593,%r12
+  8004b8:	00 00 00 
+  8004bb:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004be:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004c2:	48 89 df             	mov    %rbx,%rdi
+  8004c5:	48 b8 2f 05 80 00 00 	movabs $0x80052f,%rax
+  8004cc:	00 00 00 
+  8004cf:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004d1:	48 bf c3 50 80 00 00 	movabs $0x8050c3,%rdi
+  8004d8:	00 00 00 
+  8004db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e0:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004e3:	cc                   	int3
+  8004e4:	eb fd                	jmp    8004e3 <_panic+0xa0>
+
+00000000008004e6 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004e6:	55                   	push   %rbp
+  8004e7:	48 89 e5             	mov    %rsp,%rbp
+  8004ea:	53                   	push   %rbx
+  8004eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ef:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004f2:	8b 06                	mov    (%rsi),%eax
+  8004f4:	8d 50 01             	lea    0x1(%rax),%edx
+  8004f7:	89 16                	mov    %edx,(%rsi)
+  8004f9:	48 98                	cltq
+  8004fb:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800500:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800506:	74 0a                	je     800512 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800508:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80050c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800510:	c9                   	leave
+  800511:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800512:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800516:	be ff 00 00 00       	mov    $0xff,%esi
+  80051b:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  800522:	00 00 00 
+  800525:	ff d0                	call   *%rax
+        state->offset = 0;
+  800527:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80052d:	eb d9                	jmp    800508 <putch+0x22>
+
+000000000080052f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80052f:	55                   	push   %rbp
+  800530:	48 89 e5             	mov    %rsp,%rbp
+  800533:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80053a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80053d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800544:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800549:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800551:	48 89 f1             	mov    %rsi,%rcx
+  800554:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80055b:	48 bf e6 04 80 00 00 	movabs $0x8004e6,%rdi
+  800562:	00 00 00 
+  800565:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  80056c:	00 00 00 
+  80056f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800571:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800578:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80057f:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  800586:	00 00 00 
+  800589:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80058b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800591:	c9                   	leave
+  800592:	c3                   	ret
+
+0000000000800593 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800593:	55                   	push   %rbp
+  800594:	48 89 e5             	mov    %rsp,%rbp
+  800597:	48 83 ec 50          	sub    $0x50,%rsp
+  80059b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80059f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005a3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005a7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005ab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005af:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005b6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005be:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005c2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005c6:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005ca:	48 b8 2f 05 80 00 00 	movabs $0x80052f,%rax
+  8005d1:	00 00 00 
+  8005d4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005d6:	c9                   	leave
+  8005d7:	c3                   	ret
+
+00000000008005d8 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005d8:	55                   	push   %rbp
+  8005d9:	48 89 e5             	mov    %rsp,%rbp
+  8005dc:	41 57                	push   %r15
+  8005de:	41 56                	push   %r14
+  8005e0:	41 55                	push   %r13
+  8005e2:	41 54                	push   %r12
+  8005e4:	53                   	push   %rbx
+  8005e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8005e9:	49 89 fc             	mov    %rdi,%r12
+  8005ec:	49 89 f5             	mov    %rsi,%r13
+  8005ef:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005f3:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005f6:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005f9:	41 89 cf             	mov    %ecx,%r15d
+  8005fc:	4c 39 fa             	cmp    %r15,%rdx
+  8005ff:	73 5b                	jae    80065c <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800601:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800605:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800609:	85 db                	test   %ebx,%ebx
+  80060b:	7e 0e                	jle    80061b <print_num+0x43>
+            putch(padc, put_arg);
+  80060d:	4c 89 ee             	mov    %r13,%rsi
+  800610:	44 89 f7             	mov    %r14d,%edi
+  800613:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800616:	83 eb 01             	sub    $0x1,%ebx
+  800619:	75 f2                	jne    80060d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80061b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80061f:	48 b9 cc 4a 80 00 00 	movabs $0x804acc,%rcx
+  800626:	00 00 00 
+  800629:	48 b8 bb 4a 80 00 00 	movabs $0x804abb,%rax
+  800630:	00 00 00 
+  800633:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800637:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80063b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800640:	49 f7 f7             	div    %r15
+  800643:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800647:	4c 89 ee             	mov    %r13,%rsi
+  80064a:	41 ff d4             	call   *%r12
+}
+  80064d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800651:	5b                   	pop    %rbx
+  800652:	41 5c                	pop    %r12
+  800654:	41 5d                	pop    %r13
+  800656:	41 5e                	pop    %r14
+  800658:	41 5f                	pop    %r15
+  80065a:	5d                   	pop    %rbp
+  80065b:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80065c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800660:	ba 00 00 00 00       	mov    $0x0,%edx
+  800665:	49 f7 f7             	div    %r15
+  800668:	48 83 ec 08          	sub    $0x8,%rsp
+  80066c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800670:	52                   	push   %rdx
+  800671:	45 0f be c9          	movsbl %r9b,%r9d
+  800675:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800679:	48 89 c2             	mov    %rax,%rdx
+  80067c:	48 b8 d8 05 80 00 00 	movabs $0x8005d8,%rax
+  800683:	00 00 00 
+  800686:	ff d0                	call   *%rax
+  800688:	48 83 c4 10          	add    $0x10,%rsp
+  80068c:	eb 8d                	jmp    80061b <print_num+0x43>
+
+000000000080068e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80068e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800692:	48 8b 06             	mov    (%rsi),%rax
+  800695:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800699:	73 0a                	jae    8006a5 <sprintputch+0x17>
+        *state->start++ = ch;
+  80069b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80069f:	48 89 16             	mov    %rdx,(%rsi)
+  8006a2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006a5:	c3                   	ret
+
+00000000008006a6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006a6:	55                   	push   %rbp
+  8006a7:	48 89 e5             	mov    %rsp,%rbp
+  8006aa:	48 83 ec 50          	sub    $0x50,%rsp
+  8006ae:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006b2:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006b6:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006ba:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006c1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006cd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006d1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006d5:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  8006dc:	00 00 00 
+  8006df:	ff d0                	call   *%rax
+}
+  8006e1:	c9                   	leave
+  8006e2:	c3                   	ret
+
+00000000008006e3 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006e3:	55                   	push   %rbp
+  8006e4:	48 89 e5             	mov    %rsp,%rbp
+  8006e7:	41 57                	push   %r15
+  8006e9:	41 56                	push   %r14
+  8006eb:	41 55                	push   %r13
+  8006ed:	41 54                	push   %r12
+  8006ef:	53                   	push   %rbx
+  8006f0:	48 83 ec 38          	sub    $0x38,%rsp
+  8006f4:	49 89 fe             	mov    %rdi,%r14
+  8006f7:	49 89 f5             	mov    %rsi,%r13
+  8006fa:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006fd:	48 8b 01             	mov    (%rcx),%rax
+  800700:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800704:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800708:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800710:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800714:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800718:	0f b6 3b             	movzbl (%rbx),%edi
+  80071b:	40 80 ff 25          	cmp    $0x25,%dil
+  80071f:	74 18                	je     800739 <vprintfmt+0x56>
+            if (!ch) return;
+  800721:	40 84 ff             	test   %dil,%dil
+  800724:	0f 84 b1 06 00 00    	je     800ddb <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80072a:	40 0f b6 ff          	movzbl %dil,%edi
+  80072e:	4c 89 ee             	mov    %r13,%rsi
+  800731:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800734:	4c 89 e3             	mov    %r12,%rbx
+  800737:	eb db                	jmp    800714 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800739:	be 00 00 00 00       	mov    $0x0,%esi
+  80073e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800742:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800747:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80074d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800754:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800758:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80075d:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800762:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800765:	83 e8 23             	sub    $0x23,%eax
+  800768:	3c 57                	cmp    $0x57,%al
+  80076a:	0f 87 51 06 00 00    	ja     800dc1 <vprintfmt+0x6de>
+  800770:	0f b6 c0             	movzbl %al,%eax
+  800773:	48 b9 80 4c 80 00 00 	movabs $0x804c80,%rcx
+  80077a:	00 00 00 
+  80077d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800780:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800783:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800787:	eb cf                	jmp    800758 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800789:	49 89 dc             	mov    %rbx,%r12
+  80078c:	be 01 00 00 00       	mov    $0x1,%esi
+  800791:	eb c5                	jmp    800758 <vprintfmt+0x75>
+            padc = ch;
+  800793:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800797:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80079a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80079d:	eb b9                	jmp    800758 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80079f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a5:	77 24                	ja     8007cb <vprintfmt+0xe8>
+  8007a7:	89 c1                	mov    %eax,%ecx
+  8007a9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007ad:	83 c0 08             	add    $0x8,%eax
+  8007b0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b3:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007b6:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007b9:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007bd:	79 99                	jns    800758 <vprintfmt+0x75>
+                width = precision;
+  8007bf:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007c3:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007c9:	eb 8d                	jmp    800758 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007cb:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007cf:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d7:	eb da                	jmp    8007b3 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007d9:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007de:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e2:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007e8:	3c 39                	cmp    $0x39,%al
+  8007ea:	77 1c                	ja     800808 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007ec:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007f0:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007f4:	0f b6 c0             	movzbl %al,%eax
+  8007f7:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007fc:	0f b6 03             	movzbl (%rbx),%eax
+  8007ff:	3c 39                	cmp    $0x39,%al
+  800801:	76 e9                	jbe    8007ec <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800803:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800806:	eb b1                	jmp    8007b9 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800808:	49 89 dc             	mov    %rbx,%r12
+  80080b:	eb ac                	jmp    8007b9 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80080d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800810:	85 c9                	test   %ecx,%ecx
+  800812:	b8 00 00 00 00       	mov    $0x0,%eax
+  800817:	0f 49 c1             	cmovns %ecx,%eax
+  80081a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80081d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800820:	e9 33 ff ff ff       	jmp    800758 <vprintfmt+0x75>
+            lflag++;
+  800825:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800828:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80082b:	e9 28 ff ff ff       	jmp    800758 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 19                	ja     800851 <vprintfmt+0x16e>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	8b 3a                	mov    (%rdx),%edi
+  800846:	4c 89 ee             	mov    %r13,%rsi
+  800849:	41 ff d6             	call   *%r14
+            break;
+  80084c:	e9 c3 fe ff ff       	jmp    800714 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800851:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800855:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800859:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085d:	eb e5                	jmp    800844 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	77 5a                	ja     8008c1 <vprintfmt+0x1de>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800873:	8b 02                	mov    (%rdx),%eax
+  800875:	89 c1                	mov    %eax,%ecx
+  800877:	f7 d9                	neg    %ecx
+  800879:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80087c:	83 f9 16             	cmp    $0x16,%ecx
+  80087f:	7f 4e                	jg     8008cf <vprintfmt+0x1ec>
+  800881:	48 63 c1             	movslq %ecx,%rax
+  800884:	48 ba 40 4f 80 00 00 	movabs $0x804f40,%rdx
+  80088b:	00 00 00 
+  80088e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800892:	48 85 c0             	test   %rax,%rax
+  800895:	74 38                	je     8008cf <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800897:	48 89 c1             	mov    %rax,%rcx
+  80089a:	48 ba 39 51 80 00 00 	movabs $0x805139,%rdx
+  8008a1:	00 00 00 
+  8008a4:	4c 89 ee             	mov    %r13,%rsi
+  8008a7:	4c 89 f7             	mov    %r14,%rdi
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	49 b8 a6 06 80 00 00 	movabs $0x8006a6,%r8
+  8008b6:	00 00 00 
+  8008b9:	41 ff d0             	call   *%r8
+  8008bc:	e9 53 fe ff ff       	jmp    800714 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cd:	eb a4                	jmp    800873 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008cf:	48 ba e4 4a 80 00 00 	movabs $0x804ae4,%rdx
+  8008d6:	00 00 00 
+  8008d9:	4c 89 ee             	mov    %r13,%rsi
+  8008dc:	4c 89 f7             	mov    %r14,%rdi
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	49 b8 a6 06 80 00 00 	movabs $0x8006a6,%r8
+  8008eb:	00 00 00 
+  8008ee:	41 ff d0             	call   *%r8
+  8008f1:	e9 1e fe ff ff       	jmp    800714 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fc:	77 6c                	ja     80096a <vprintfmt+0x287>
+  8008fe:	89 c2                	mov    %eax,%edx
+  800900:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800904:	83 c0 08             	add    $0x8,%eax
+  800907:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80090d:	48 85 d2             	test   %rdx,%rdx
+  800910:	48 b8 dd 4a 80 00 00 	movabs $0x804add,%rax
+  800917:	00 00 00 
+  80091a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80091e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800922:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800926:	7e 06                	jle    80092e <vprintfmt+0x24b>
+  800928:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80092c:	75 4a                	jne    800978 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80092e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800932:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800936:	0f b6 00             	movzbl (%rax),%eax
+  800939:	84 c0                	test   %al,%al
+  80093b:	0f 85 9a 00 00 00    	jne    8009db <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800941:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800944:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800948:	85 c0                	test   %eax,%eax
+  80094a:	0f 8e c4 fd ff ff    	jle    800714 <vprintfmt+0x31>
+  800950:	4c 89 ee             	mov    %r13,%rsi
+  800953:	bf 20 00 00 00       	mov    $0x20,%edi
+  800958:	41 ff d6             	call   *%r14
+  80095b:	41 83 ec 01          	sub    $0x1,%r12d
+  80095f:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800963:	75 eb                	jne    800950 <vprintfmt+0x26d>
+  800965:	e9 aa fd ff ff       	jmp    800714 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80096a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800972:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800976:	eb 92                	jmp    80090a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800978:	49 63 f7             	movslq %r15d,%rsi
+  80097b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80097f:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  800986:	00 00 00 
+  800989:	ff d0                	call   *%rax
+  80098b:	48 89 c2             	mov    %rax,%rdx
+  80098e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800991:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800993:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800996:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800999:	85 c0                	test   %eax,%eax
+  80099b:	7e 91                	jle    80092e <vprintfmt+0x24b>
+  80099d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009a2:	4c 89 ee             	mov    %r13,%rsi
+  8009a5:	44 89 e7             	mov    %r12d,%edi
+  8009a8:	41 ff d6             	call   *%r14
+  8009ab:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009af:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b2:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009b5:	75 eb                	jne    8009a2 <vprintfmt+0x2bf>
+  8009b7:	e9 72 ff ff ff       	jmp    80092e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009bc:	0f b6 f8             	movzbl %al,%edi
+  8009bf:	4c 89 ee             	mov    %r13,%rsi
+  8009c2:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009c9:	49 83 c4 01          	add    $0x1,%r12
+  8009cd:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009d3:	84 c0                	test   %al,%al
+  8009d5:	0f 84 66 ff ff ff    	je     800941 <vprintfmt+0x25e>
+  8009db:	45 85 ff             	test   %r15d,%r15d
+  8009de:	78 0a                	js     8009ea <vprintfmt+0x307>
+  8009e0:	41 83 ef 01          	sub    $0x1,%r15d
+  8009e4:	0f 88 57 ff ff ff    	js     800941 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009ea:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009ee:	74 cc                	je     8009bc <vprintfmt+0x2d9>
+  8009f0:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009f3:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009f8:	80 fa 5e             	cmp    $0x5e,%dl
+  8009fb:	77 c2                	ja     8009bf <vprintfmt+0x2dc>
+  8009fd:	eb bd                	jmp    8009bc <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009ff:	40 84 f6             	test   %sil,%sil
+  800a02:	75 26                	jne    800a2a <vprintfmt+0x347>
+    switch (lflag) {
+  800a04:	85 d2                	test   %edx,%edx
+  800a06:	74 59                	je     800a61 <vprintfmt+0x37e>
+  800a08:	83 fa 01             	cmp    $0x1,%edx
+  800a0b:	74 7b                	je     800a88 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a10:	83 f8 2f             	cmp    $0x2f,%eax
+  800a13:	0f 87 96 00 00 00    	ja     800aaf <vprintfmt+0x3cc>
+  800a19:	89 c2                	mov    %eax,%edx
+  800a1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a1f:	83 c0 08             	add    $0x8,%eax
+  800a22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a25:	4c 8b 22             	mov    (%rdx),%r12
+  800a28:	eb 17                	jmp    800a41 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a2a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a30:	77 21                	ja     800a53 <vprintfmt+0x370>
+  800a32:	89 c2                	mov    %eax,%edx
+  800a34:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a38:	83 c0 08             	add    $0x8,%eax
+  800a3b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a41:	4d 85 e4             	test   %r12,%r12
+  800a44:	78 7a                	js     800ac0 <vprintfmt+0x3dd>
+            num = i;
+  800a46:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a49:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a4e:	e9 50 02 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5f:	eb dd                	jmp    800a3e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a64:	83 f8 2f             	cmp    $0x2f,%eax
+  800a67:	77 11                	ja     800a7a <vprintfmt+0x397>
+  800a69:	89 c2                	mov    %eax,%edx
+  800a6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6f:	83 c0 08             	add    $0x8,%eax
+  800a72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a75:	4c 63 22             	movslq (%rdx),%r12
+  800a78:	eb c7                	jmp    800a41 <vprintfmt+0x35e>
+  800a7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a86:	eb ed                	jmp    800a75 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	77 11                	ja     800aa1 <vprintfmt+0x3be>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	4c 8b 22             	mov    (%rdx),%r12
+  800a9f:	eb a0                	jmp    800a41 <vprintfmt+0x35e>
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	eb ed                	jmp    800a9c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800aaf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abb:	e9 65 ff ff ff       	jmp    800a25 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ac0:	4c 89 ee             	mov    %r13,%rsi
+  800ac3:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ac8:	41 ff d6             	call   *%r14
+                i = -i;
+  800acb:	49 f7 dc             	neg    %r12
+  800ace:	e9 73 ff ff ff       	jmp    800a46 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad3:	40 84 f6             	test   %sil,%sil
+  800ad6:	75 32                	jne    800b0a <vprintfmt+0x427>
+    switch (lflag) {
+  800ad8:	85 d2                	test   %edx,%edx
+  800ada:	74 5d                	je     800b39 <vprintfmt+0x456>
+  800adc:	83 fa 01             	cmp    $0x1,%edx
+  800adf:	0f 84 82 00 00 00    	je     800b67 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ae5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aeb:	0f 87 a5 00 00 00    	ja     800b96 <vprintfmt+0x4b3>
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af7:	83 c0 08             	add    $0x8,%eax
+  800afa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b00:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b05:	e9 99 01 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b0a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b0d:	83 f8 2f             	cmp    $0x2f,%eax
+  800b10:	77 19                	ja     800b2b <vprintfmt+0x448>
+  800b12:	89 c2                	mov    %eax,%edx
+  800b14:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b18:	83 c0 08             	add    $0x8,%eax
+  800b1b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b21:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b26:	e9 78 01 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+  800b2b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b2f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b37:	eb e5                	jmp    800b1e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b3c:	83 f8 2f             	cmp    $0x2f,%eax
+  800b3f:	77 18                	ja     800b59 <vprintfmt+0x476>
+  800b41:	89 c2                	mov    %eax,%edx
+  800b43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b47:	83 c0 08             	add    $0x8,%eax
+  800b4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b4f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b54:	e9 4a 01 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+  800b59:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b5d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b61:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b65:	eb e6                	jmp    800b4d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b67:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b6a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b6d:	77 19                	ja     800b88 <vprintfmt+0x4a5>
+  800b6f:	89 c2                	mov    %eax,%edx
+  800b71:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b75:	83 c0 08             	add    $0x8,%eax
+  800b78:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b7b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b83:	e9 1b 01 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+  800b88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b94:	eb e5                	jmp    800b7b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b96:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b9a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba2:	e9 56 ff ff ff       	jmp    800afd <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba7:	40 84 f6             	test   %sil,%sil
+  800baa:	75 2e                	jne    800bda <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bac:	85 d2                	test   %edx,%edx
+  800bae:	74 59                	je     800c09 <vprintfmt+0x526>
+  800bb0:	83 fa 01             	cmp    $0x1,%edx
+  800bb3:	74 7f                	je     800c34 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bb5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bbb:	0f 87 9f 00 00 00    	ja     800c60 <vprintfmt+0x57d>
+  800bc1:	89 c2                	mov    %eax,%edx
+  800bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc7:	83 c0 08             	add    $0x8,%eax
+  800bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd5:	e9 c9 00 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bda:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdd:	83 f8 2f             	cmp    $0x2f,%eax
+  800be0:	77 19                	ja     800bfb <vprintfmt+0x518>
+  800be2:	89 c2                	mov    %eax,%edx
+  800be4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be8:	83 c0 08             	add    $0x8,%eax
+  800beb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bee:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf1:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf6:	e9 a8 00 00 00       	jmp    800ca3 <vprintfmt+0x5c0>
+  800bfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c07:	eb e5                	jmp    800bee <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0f:	77 15                	ja     800c26 <vprintfmt+0x543>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c17:	83 c0 08             	add    $0x8,%eax
+  800c1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c1f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c24:	eb 7d                	jmp    800ca3 <vprintfmt+0x5c0>
+  800c26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c32:	eb e9                	jmp    800c1d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c37:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3a:	77 16                	ja     800c52 <vprintfmt+0x56f>
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c42:	83 c0 08             	add    $0x8,%eax
+  800c45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c50:	eb 51                	jmp    800ca3 <vprintfmt+0x5c0>
+  800c52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5e:	eb e8                	jmp    800c48 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c60:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c64:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6c:	e9 5c ff ff ff       	jmp    800bcd <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c71:	4c 89 ee             	mov    %r13,%rsi
+  800c74:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c79:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c7c:	4c 89 ee             	mov    %r13,%rsi
+  800c7f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c84:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c87:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c8d:	77 47                	ja     800cd6 <vprintfmt+0x5f3>
+  800c8f:	89 c2                	mov    %eax,%edx
+  800c91:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c95:	83 c0 08             	add    $0x8,%eax
+  800c98:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c9e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ca3:	48 83 ec 08          	sub    $0x8,%rsp
+  800ca7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cab:	0f 94 c0             	sete   %al
+  800cae:	0f b6 c0             	movzbl %al,%eax
+  800cb1:	50                   	push   %rax
+  800cb2:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cb7:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cbb:	4c 89 ee             	mov    %r13,%rsi
+  800cbe:	4c 89 f7             	mov    %r14,%rdi
+  800cc1:	48 b8 d8 05 80 00 00 	movabs $0x8005d8,%rax
+  800cc8:	00 00 00 
+  800ccb:	ff d0                	call   *%rax
+            break;
+  800ccd:	48 83 c4 10          	add    $0x10,%rsp
+  800cd1:	e9 3e fa ff ff       	jmp    800714 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce2:	eb b7                	jmp    800c9b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800ce4:	40 84 f6             	test   %sil,%sil
+  800ce7:	75 2b                	jne    800d14 <vprintfmt+0x631>
+    switch (lflag) {
+  800ce9:	85 d2                	test   %edx,%edx
+  800ceb:	74 56                	je     800d43 <vprintfmt+0x660>
+  800ced:	83 fa 01             	cmp    $0x1,%edx
+  800cf0:	74 7f                	je     800d71 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cf2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cf5:	83 f8 2f             	cmp    $0x2f,%eax
+  800cf8:	0f 87 a2 00 00 00    	ja     800da0 <vprintfmt+0x6bd>
+  800cfe:	89 c2                	mov    %eax,%edx
+  800d00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d04:	83 c0 08             	add    $0x8,%eax
+  800d07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d12:	eb 8f                	jmp    800ca3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d17:	83 f8 2f             	cmp    $0x2f,%eax
+  800d1a:	77 19                	ja     800d35 <vprintfmt+0x652>
+  800d1c:	89 c2                	mov    %eax,%edx
+  800d1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d22:	83 c0 08             	add    $0x8,%eax
+  800d25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d30:	e9 6e ff ff ff       	jmp    800ca3 <vprintfmt+0x5c0>
+  800d35:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d39:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d3d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d41:	eb e5                	jmp    800d28 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d46:	83 f8 2f             	cmp    $0x2f,%eax
+  800d49:	77 18                	ja     800d63 <vprintfmt+0x680>
+  800d4b:	89 c2                	mov    %eax,%edx
+  800d4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d51:	83 c0 08             	add    $0x8,%eax
+  800d54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d57:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d59:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d5e:	e9 40 ff ff ff       	jmp    800ca3 <vprintfmt+0x5c0>
+  800d63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d6f:	eb e6                	jmp    800d57 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d74:	83 f8 2f             	cmp    $0x2f,%eax
+  800d77:	77 19                	ja     800d92 <vprintfmt+0x6af>
+  800d79:	89 c2                	mov    %eax,%edx
+  800d7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7f:	83 c0 08             	add    $0x8,%eax
+  800d82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d85:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d8d:	e9 11 ff ff ff       	jmp    800ca3 <vprintfmt+0x5c0>
+  800d92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9e:	eb e5                	jmp    800d85 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800da0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dac:	e9 59 ff ff ff       	jmp    800d0a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800db1:	4c 89 ee             	mov    %r13,%rsi
+  800db4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db9:	41 ff d6             	call   *%r14
+            break;
+  800dbc:	e9 53 f9 ff ff       	jmp    800714 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dc1:	4c 89 ee             	mov    %r13,%rsi
+  800dc4:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dc9:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dcc:	48 83 eb 01          	sub    $0x1,%rbx
+  800dd0:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dd4:	75 f6                	jne    800dcc <vprintfmt+0x6e9>
+  800dd6:	e9 39 f9 ff ff       	jmp    800714 <vprintfmt+0x31>
+}
+  800ddb:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ddf:	5b                   	pop    %rbx
+  800de0:	41 5c                	pop    %r12
+  800de2:	41 5d                	pop    %r13
+  800de4:	41 5e                	pop    %r14
+  800de6:	41 5f                	pop    %r15
+  800de8:	5d                   	pop    %rbp
+  800de9:	c3                   	ret
+
+0000000000800dea <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800df2:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800df6:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800dfb:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800dff:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e06:	48 85 ff             	test   %rdi,%rdi
+  800e09:	74 2b                	je     800e36 <vsnprintf+0x4c>
+  800e0b:	48 85 f6             	test   %rsi,%rsi
+  800e0e:	74 26                	je     800e36 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e10:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e14:	48 bf 8e 06 80 00 00 	movabs $0x80068e,%rdi
+  800e1b:	00 00 00 
+  800e1e:	48 b8 e3 06 80 00 00 	movabs $0x8006e3,%rax
+  800e25:	00 00 00 
+  800e28:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e2a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e2e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e31:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e34:	c9                   	leave
+  800e35:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e3b:	eb f7                	jmp    800e34 <vsnprintf+0x4a>
+
+0000000000800e3d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e3d:	55                   	push   %rbp
+  800e3e:	48 89 e5             	mov    %rsp,%rbp
+  800e41:	48 83 ec 50          	sub    $0x50,%rsp
+  800e45:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e49:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e4d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e51:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e58:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e60:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e68:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e6c:	48 b8 ea 0d 80 00 00 	movabs $0x800dea,%rax
+  800e73:	00 00 00 
+  800e76:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e78:	c9                   	leave
+  800e79:	c3                   	ret
+
+0000000000800e7a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e7a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e7d:	74 10                	je     800e8f <strlen+0x15>
+    size_t n = 0;
+  800e7f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e84:	48 83 c0 01          	add    $0x1,%rax
+  800e88:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e8c:	75 f6                	jne    800e84 <strlen+0xa>
+  800e8e:	c3                   	ret
+    size_t n = 0;
+  800e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e94:	c3                   	ret
+
+0000000000800e95 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e95:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e98:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e9d:	48 85 f6             	test   %rsi,%rsi
+  800ea0:	74 11                	je     800eb3 <strnlen+0x1e>
+  800ea2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ea6:	74 0c                	je     800eb4 <strnlen+0x1f>
+  800ea8:	48 83 c2 01          	add    $0x1,%rdx
+  800eac:	48 39 d0             	cmp    %rdx,%rax
+  800eaf:	75 f1                	jne    800ea2 <strnlen+0xd>
+  800eb1:	eb 04                	jmp    800eb7 <strnlen+0x22>
+  800eb3:	c3                   	ret
+  800eb4:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800eb7:	c3                   	ret
+
+0000000000800eb8 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800eb8:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec0:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ec4:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ec7:	48 83 c2 01          	add    $0x1,%rdx
+  800ecb:	84 c9                	test   %cl,%cl
+  800ecd:	75 f1                	jne    800ec0 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ecf:	c3                   	ret
+
+0000000000800ed0 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ed0:	55                   	push   %rbp
+  800ed1:	48 89 e5             	mov    %rsp,%rbp
+  800ed4:	41 54                	push   %r12
+  800ed6:	53                   	push   %rbx
+  800ed7:	48 89 fb             	mov    %rdi,%rbx
+  800eda:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800edd:	48 b8 7a 0e 80 00 00 	movabs $0x800e7a,%rax
+  800ee4:	00 00 00 
+  800ee7:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ee9:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800eed:	4c 89 e6             	mov    %r12,%rsi
+  800ef0:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  800ef7:	00 00 00 
+  800efa:	ff d0                	call   *%rax
+    return dst;
+}
+  800efc:	48 89 d8             	mov    %rbx,%rax
+  800eff:	5b                   	pop    %rbx
+  800f00:	41 5c                	pop    %r12
+  800f02:	5d                   	pop    %rbp
+  800f03:	c3                   	ret
+
+0000000000800f04 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f04:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f07:	48 85 d2             	test   %rdx,%rdx
+  800f0a:	74 1f                	je     800f2b <strncpy+0x27>
+  800f0c:	48 01 fa             	add    %rdi,%rdx
+  800f0f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f12:	48 83 c1 01          	add    $0x1,%rcx
+  800f16:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f1a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f1e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f22:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f26:	48 39 ca             	cmp    %rcx,%rdx
+  800f29:	75 e7                	jne    800f12 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f2b:	c3                   	ret
+
+0000000000800f2c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f2c:	48 89 f8             	mov    %rdi,%rax
+  800f2f:	48 85 d2             	test   %rdx,%rdx
+  800f32:	74 24                	je     800f58 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f34:	48 83 ea 01          	sub    $0x1,%rdx
+  800f38:	74 1b                	je     800f55 <strlcpy+0x29>
+  800f3a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f3e:	0f b6 16             	movzbl (%rsi),%edx
+  800f41:	84 d2                	test   %dl,%dl
+  800f43:	74 10                	je     800f55 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f45:	48 83 c6 01          	add    $0x1,%rsi
+  800f49:	48 83 c0 01          	add    $0x1,%rax
+  800f4d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f50:	48 39 c8             	cmp    %rcx,%rax
+  800f53:	75 e9                	jne    800f3e <strlcpy+0x12>
+        *dst = '\0';
+  800f55:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f58:	48 29 f8             	sub    %rdi,%rax
+}
+  800f5b:	c3                   	ret
+
+0000000000800f5c <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f5c:	0f b6 07             	movzbl (%rdi),%eax
+  800f5f:	84 c0                	test   %al,%al
+  800f61:	74 13                	je     800f76 <strcmp+0x1a>
+  800f63:	38 06                	cmp    %al,(%rsi)
+  800f65:	75 0f                	jne    800f76 <strcmp+0x1a>
+  800f67:	48 83 c7 01          	add    $0x1,%rdi
+  800f6b:	48 83 c6 01          	add    $0x1,%rsi
+  800f6f:	0f b6 07             	movzbl (%rdi),%eax
+  800f72:	84 c0                	test   %al,%al
+  800f74:	75 ed                	jne    800f63 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f76:	0f b6 c0             	movzbl %al,%eax
+  800f79:	0f b6 16             	movzbl (%rsi),%edx
+  800f7c:	29 d0                	sub    %edx,%eax
+}
+  800f7e:	c3                   	ret
+
+0000000000800f7f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f7f:	48 85 d2             	test   %rdx,%rdx
+  800f82:	74 1f                	je     800fa3 <strncmp+0x24>
+  800f84:	0f b6 07             	movzbl (%rdi),%eax
+  800f87:	84 c0                	test   %al,%al
+  800f89:	74 1e                	je     800fa9 <strncmp+0x2a>
+  800f8b:	3a 06                	cmp    (%rsi),%al
+  800f8d:	75 1a                	jne    800fa9 <strncmp+0x2a>
+  800f8f:	48 83 c7 01          	add    $0x1,%rdi
+  800f93:	48 83 c6 01          	add    $0x1,%rsi
+  800f97:	48 83 ea 01          	sub    $0x1,%rdx
+  800f9b:	75 e7                	jne    800f84 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa2:	c3                   	ret
+  800fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fa8:	c3                   	ret
+  800fa9:	48 85 d2             	test   %rdx,%rdx
+  800fac:	74 09                	je     800fb7 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fae:	0f b6 07             	movzbl (%rdi),%eax
+  800fb1:	0f b6 16             	movzbl (%rsi),%edx
+  800fb4:	29 d0                	sub    %edx,%eax
+  800fb6:	c3                   	ret
+    if (!n) return 0;
+  800fb7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fbc:	c3                   	ret
+
+0000000000800fbd <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fbd:	0f b6 17             	movzbl (%rdi),%edx
+  800fc0:	84 d2                	test   %dl,%dl
+  800fc2:	74 18                	je     800fdc <strchr+0x1f>
+        if (*str == c) {
+  800fc4:	0f be d2             	movsbl %dl,%edx
+  800fc7:	39 f2                	cmp    %esi,%edx
+  800fc9:	74 17                	je     800fe2 <strchr+0x25>
+    for (; *str; str++) {
+  800fcb:	48 83 c7 01          	add    $0x1,%rdi
+  800fcf:	0f b6 17             	movzbl (%rdi),%edx
+  800fd2:	84 d2                	test   %dl,%dl
+  800fd4:	75 ee                	jne    800fc4 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdb:	c3                   	ret
+  800fdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe1:	c3                   	ret
+  800fe2:	48 89 f8             	mov    %rdi,%rax
+}
+  800fe5:	c3                   	ret
+
+0000000000800fe6 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fe6:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fe9:	0f b6 17             	movzbl (%rdi),%edx
+  800fec:	84 d2                	test   %dl,%dl
+  800fee:	74 13                	je     801003 <strfind+0x1d>
+  800ff0:	0f be d2             	movsbl %dl,%edx
+  800ff3:	39 f2                	cmp    %esi,%edx
+  800ff5:	74 0b                	je     801002 <strfind+0x1c>
+  800ff7:	48 83 c0 01          	add    $0x1,%rax
+  800ffb:	0f b6 10             	movzbl (%rax),%edx
+  800ffe:	84 d2                	test   %dl,%dl
+  801000:	75 ee                	jne    800ff0 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801002:	c3                   	ret
+  801003:	c3                   	ret
+
+0000000000801004 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801004:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801007:	48 89 f8             	mov    %rdi,%rax
+  80100a:	48 f7 d8             	neg    %rax
+  80100d:	83 e0 07             	and    $0x7,%eax
+  801010:	49 89 d1             	mov    %rdx,%r9
+  801013:	49 29 c1             	sub    %rax,%r9
+  801016:	78 36                	js     80104e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801018:	40 0f b6 c6          	movzbl %sil,%eax
+  80101c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801023:	01 01 01 
+  801026:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80102a:	40 f6 c7 07          	test   $0x7,%dil
+  80102e:	75 38                	jne    801068 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801030:	4c 89 c9             	mov    %r9,%rcx
+  801033:	48 c1 f9 03          	sar    $0x3,%rcx
+  801037:	74 0c                	je     801045 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801039:	fc                   	cld
+  80103a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80103d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801041:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801045:	4d 85 c9             	test   %r9,%r9
+  801048:	75 45                	jne    80108f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80104a:	4c 89 c0             	mov    %r8,%rax
+  80104d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80104e:	48 85 d2             	test   %rdx,%rdx
+  801051:	74 f7                	je     80104a <memset+0x46>
+  801053:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801056:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801059:	48 83 c0 01          	add    $0x1,%rax
+  80105d:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801061:	48 39 c2             	cmp    %rax,%rdx
+  801064:	75 f3                	jne    801059 <memset+0x55>
+  801066:	eb e2                	jmp    80104a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801068:	40 f6 c7 01          	test   $0x1,%dil
+  80106c:	74 06                	je     801074 <memset+0x70>
+  80106e:	88 07                	mov    %al,(%rdi)
+  801070:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801074:	40 f6 c7 02          	test   $0x2,%dil
+  801078:	74 07                	je     801081 <memset+0x7d>
+  80107a:	66 89 07             	mov    %ax,(%rdi)
+  80107d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801081:	40 f6 c7 04          	test   $0x4,%dil
+  801085:	74 a9                	je     801030 <memset+0x2c>
+  801087:	89 07                	mov    %eax,(%rdi)
+  801089:	48 83 c7 04          	add    $0x4,%rdi
+  80108d:	eb a1                	jmp    801030 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80108f:	41 f6 c1 04          	test   $0x4,%r9b
+  801093:	74 06                	je     80109b <memset+0x97>
+  801095:	89 07                	mov    %eax,(%rdi)
+  801097:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80109b:	41 f6 c1 02          	test   $0x2,%r9b
+  80109f:	74 07                	je     8010a8 <memset+0xa4>
+  8010a1:	66 89 07             	mov    %ax,(%rdi)
+  8010a4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010a8:	41 f6 c1 01          	test   $0x1,%r9b
+  8010ac:	74 9c                	je     80104a <memset+0x46>
+  8010ae:	88 07                	mov    %al,(%rdi)
+  8010b0:	eb 98                	jmp    80104a <memset+0x46>
+
+00000000008010b2 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010b2:	48 89 f8             	mov    %rdi,%rax
+  8010b5:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010b8:	48 39 fe             	cmp    %rdi,%rsi
+  8010bb:	73 3b                	jae    8010f8 <memmove+0x46>
+  8010bd:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010c1:	48 39 d7             	cmp    %rdx,%rdi
+  8010c4:	73 32                	jae    8010f8 <memmove+0x46>
+        s += n;
+        d += n;
+  8010c6:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010ca:	48 89 d6             	mov    %rdx,%rsi
+  8010cd:	48 09 fe             	or     %rdi,%rsi
+  8010d0:	48 09 ce             	or     %rcx,%rsi
+  8010d3:	40 f6 c6 07          	test   $0x7,%sil
+  8010d7:	75 12                	jne    8010eb <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010d9:	48 83 ef 08          	sub    $0x8,%rdi
+  8010dd:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010e1:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010e5:	fd                   	std
+  8010e6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010e9:	fc                   	cld
+  8010ea:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010eb:	48 83 ef 01          	sub    $0x1,%rdi
+  8010ef:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010f3:	fd                   	std
+  8010f4:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010f6:	eb f1                	jmp    8010e9 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010f8:	48 89 f2             	mov    %rsi,%rdx
+  8010fb:	48 09 c2             	or     %rax,%rdx
+  8010fe:	48 09 ca             	or     %rcx,%rdx
+  801101:	f6 c2 07             	test   $0x7,%dl
+  801104:	75 0c                	jne    801112 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801106:	48 c1 e9 03          	shr    $0x3,%rcx
+  80110a:	48 89 c7             	mov    %rax,%rdi
+  80110d:	fc                   	cld
+  80110e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801111:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801112:	48 89 c7             	mov    %rax,%rdi
+  801115:	fc                   	cld
+  801116:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801118:	c3                   	ret
+
+0000000000801119 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801119:	55                   	push   %rbp
+  80111a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80111d:	48 b8 b2 10 80 00 00 	movabs $0x8010b2,%rax
+  801124:	00 00 00 
+  801127:	ff d0                	call   *%rax
+}
+  801129:	5d                   	pop    %rbp
+  80112a:	c3                   	ret
+
+000000000080112b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80112b:	55                   	push   %rbp
+  80112c:	48 89 e5             	mov    %rsp,%rbp
+  80112f:	41 57                	push   %r15
+  801131:	41 56                	push   %r14
+  801133:	41 55                	push   %r13
+  801135:	41 54                	push   %r12
+  801137:	53                   	push   %rbx
+  801138:	48 83 ec 08          	sub    $0x8,%rsp
+  80113c:	49 89 fe             	mov    %rdi,%r14
+  80113f:	49 89 f7             	mov    %rsi,%r15
+  801142:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801145:	48 89 f7             	mov    %rsi,%rdi
+  801148:	48 b8 7a 0e 80 00 00 	movabs $0x800e7a,%rax
+  80114f:	00 00 00 
+  801152:	ff d0                	call   *%rax
+  801154:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801157:	48 89 de             	mov    %rbx,%rsi
+  80115a:	4c 89 f7             	mov    %r14,%rdi
+  80115d:	48 b8 95 0e 80 00 00 	movabs $0x800e95,%rax
+  801164:	00 00 00 
+  801167:	ff d0                	call   *%rax
+  801169:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80116c:	48 39 c3             	cmp    %rax,%rbx
+  80116f:	74 36                	je     8011a7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801171:	48 89 d8             	mov    %rbx,%rax
+  801174:	4c 29 e8             	sub    %r13,%rax
+  801177:	49 39 c4             	cmp    %rax,%r12
+  80117a:	73 31                	jae    8011ad <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80117c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801181:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801185:	4c 89 fe             	mov    %r15,%rsi
+  801188:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  80118f:	00 00 00 
+  801192:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801194:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801198:	48 83 c4 08          	add    $0x8,%rsp
+  80119c:	5b                   	pop    %rbx
+  80119d:	41 5c                	pop    %r12
+  80119f:	41 5d                	pop    %r13
+  8011a1:	41 5e                	pop    %r14
+  8011a3:	41 5f                	pop    %r15
+  8011a5:	5d                   	pop    %rbp
+  8011a6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011a7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011ab:	eb eb                	jmp    801198 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011ad:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011b5:	48 89 da             	mov    %rbx,%rdx
+  8011b8:	4c 89 fe             	mov    %r15,%rsi
+  8011bb:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8011c2:	00 00 00 
+  8011c5:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011c7:	49 01 de             	add    %rbx,%r14
+  8011ca:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011cf:	eb c3                	jmp    801194 <strlcat+0x69>
+
+00000000008011d1 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011d1:	48 85 d2             	test   %rdx,%rdx
+  8011d4:	74 2d                	je     801203 <memcmp+0x32>
+  8011d6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011db:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011df:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011e4:	44 38 c1             	cmp    %r8b,%cl
+  8011e7:	75 0f                	jne    8011f8 <memcmp+0x27>
+    while (n-- > 0) {
+  8011e9:	48 83 c0 01          	add    $0x1,%rax
+  8011ed:	48 39 c2             	cmp    %rax,%rdx
+  8011f0:	75 e9                	jne    8011db <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f7:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011f8:	0f b6 c1             	movzbl %cl,%eax
+  8011fb:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011ff:	44 29 c0             	sub    %r8d,%eax
+  801202:	c3                   	ret
+    return 0;
+  801203:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801208:	c3                   	ret
+
+0000000000801209 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801209:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80120d:	48 39 c7             	cmp    %rax,%rdi
+  801210:	73 0f                	jae    801221 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801212:	40 38 37             	cmp    %sil,(%rdi)
+  801215:	74 0e                	je     801225 <memfind+0x1c>
+    for (; src < end; src++) {
+  801217:	48 83 c7 01          	add    $0x1,%rdi
+  80121b:	48 39 f8             	cmp    %rdi,%rax
+  80121e:	75 f2                	jne    801212 <memfind+0x9>
+  801220:	c3                   	ret
+  801221:	48 89 f8             	mov    %rdi,%rax
+  801224:	c3                   	ret
+  801225:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801228:	c3                   	ret
+
+0000000000801229 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801229:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80122c:	0f b6 37             	movzbl (%rdi),%esi
+  80122f:	40 80 fe 20          	cmp    $0x20,%sil
+  801233:	74 06                	je     80123b <strtol+0x12>
+  801235:	40 80 fe 09          	cmp    $0x9,%sil
+  801239:	75 13                	jne    80124e <strtol+0x25>
+  80123b:	48 83 c7 01          	add    $0x1,%rdi
+  80123f:	0f b6 37             	movzbl (%rdi),%esi
+  801242:	40 80 fe 20          	cmp    $0x20,%sil
+  801246:	74 f3                	je     80123b <strtol+0x12>
+  801248:	40 80 fe 09          	cmp    $0x9,%sil
+  80124c:	74 ed                	je     80123b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80124e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801251:	83 e0 fd             	and    $0xfffffffd,%eax
+  801254:	3c 01                	cmp    $0x1,%al
+  801256:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80125a:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801260:	75 0f                	jne    801271 <strtol+0x48>
+  801262:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801265:	74 14                	je     80127b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801267:	85 d2                	test   %edx,%edx
+  801269:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80126e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801271:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801276:	4c 63 ca             	movslq %edx,%r9
+  801279:	eb 36                	jmp    8012b1 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80127b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80127f:	74 0f                	je     801290 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801281:	85 d2                	test   %edx,%edx
+  801283:	75 ec                	jne    801271 <strtol+0x48>
+        s++;
+  801285:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801289:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80128e:	eb e1                	jmp    801271 <strtol+0x48>
+        s += 2;
+  801290:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801294:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801299:	eb d6                	jmp    801271 <strtol+0x48>
+            dig -= '0';
+  80129b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80129e:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012a2:	41 39 d0             	cmp    %edx,%r8d
+  8012a5:	7d 21                	jge    8012c8 <strtol+0x9f>
+        val = val * base + dig;
+  8012a7:	49 0f af c1          	imul   %r9,%rax
+  8012ab:	0f b6 c9             	movzbl %cl,%ecx
+  8012ae:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012b1:	48 83 c7 01          	add    $0x1,%rdi
+  8012b5:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012b9:	80 f9 39             	cmp    $0x39,%cl
+  8012bc:	76 dd                	jbe    80129b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012be:	80 f9 7b             	cmp    $0x7b,%cl
+  8012c1:	77 05                	ja     8012c8 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012c3:	83 e9 57             	sub    $0x57,%ecx
+  8012c6:	eb d6                	jmp    80129e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012c8:	4d 85 d2             	test   %r10,%r10
+  8012cb:	74 03                	je     8012d0 <strtol+0xa7>
+  8012cd:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012d0:	48 89 c2             	mov    %rax,%rdx
+  8012d3:	48 f7 da             	neg    %rdx
+  8012d6:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012da:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012de:	c3                   	ret
+
+00000000008012df <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8012df:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012e4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8012fb:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012fd:	c3                   	ret
+
+00000000008012fe <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012fe:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801303:	bf 00 00 00 00       	mov    $0x0,%edi
+  801308:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801312:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801318:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801324:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801326:	c3                   	ret
+
+0000000000801327 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801327:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80132a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80132f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801334:	ba 00 00 00 00       	mov    $0x0,%edx
+  801339:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80133f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801345:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80134d:	48 85 c0             	test   %rax,%rax
+  801350:	7f 01                	jg     801353 <sys_env_destroy+0x2c>
+}
+  801352:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801353:	55                   	push   %rbp
+  801354:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801357:	49 89 c0             	mov    %rax,%r8
+  80135a:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80135f:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801366:	00 00 00 
+  801369:	be 29 00 00 00       	mov    $0x29,%esi
+  80136e:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801375:	00 00 00 
+  801378:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137d:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801384:	00 00 00 
+  801387:	41 ff d1             	call   *%r9
+
+000000000080138a <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80138a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80138f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801394:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80139e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b0:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013b2:	c3                   	ret
+
+00000000008013b3 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013bd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d9:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013db:	c3                   	ret
+
+00000000008013dc <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013dc:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013e1:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8013e8:	00 00 00 
+  8013eb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013fd:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013ff:	c3                   	ret
+
+0000000000801400 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801400:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801403:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801408:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80140e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801414:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801416:	c3                   	ret
+
+0000000000801417 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801417:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80141a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801422:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801428:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801430:	48 85 c0             	test   %rax,%rax
+  801433:	7f 01                	jg     801436 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801435:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801436:	55                   	push   %rbp
+  801437:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143a:	49 89 c0             	mov    %rax,%r8
+  80143d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801442:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801449:	00 00 00 
+  80144c:	be 29 00 00 00       	mov    $0x29,%esi
+  801451:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801458:	00 00 00 
+  80145b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801460:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801467:	00 00 00 
+  80146a:	41 ff d1             	call   *%r9
+
+000000000080146d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80146d:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801470:	48 63 d2             	movslq %edx,%rdx
+  801473:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801476:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80147b:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80147e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801480:	48 85 c0             	test   %rax,%rax
+  801483:	7f 01                	jg     801486 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801485:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801486:	55                   	push   %rbp
+  801487:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148a:	49 89 c0             	mov    %rax,%r8
+  80148d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801492:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801499:	00 00 00 
+  80149c:	be 29 00 00 00       	mov    $0x29,%esi
+  8014a1:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8014a8:	00 00 00 
+  8014ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b0:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  8014b7:	00 00 00 
+  8014ba:	41 ff d1             	call   *%r9
+
+00000000008014bd <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014bd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c0:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014d7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014d9:	48 85 c0             	test   %rax,%rax
+  8014dc:	7f 01                	jg     8014df <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014de:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014df:	55                   	push   %rbp
+  8014e0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014e3:	49 89 c0             	mov    %rax,%r8
+  8014e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014eb:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8014f2:	00 00 00 
+  8014f5:	be 29 00 00 00       	mov    $0x29,%esi
+  8014fa:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801501:	00 00 00 
+  801504:	b8 00 00 00 00       	mov    $0x0,%eax
+  801509:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801510:	00 00 00 
+  801513:	41 ff d1             	call   *%r9
+
+0000000000801516 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801516:	48 63 f6             	movslq %esi,%rsi
+  801519:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80151c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801521:	ba 00 00 00 00       	mov    $0x0,%edx
+  801526:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801532:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801538:	0f 05                	syscall
+    if (check && ret > 0) {
+  80153a:	48 85 c0             	test   %rax,%rax
+  80153d:	7f 01                	jg     801540 <sys_env_set_status+0x2a>
+}
+  80153f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801540:	55                   	push   %rbp
+  801541:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801544:	49 89 c0             	mov    %rax,%r8
+  801547:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80154c:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801553:	00 00 00 
+  801556:	be 29 00 00 00       	mov    $0x29,%esi
+  80155b:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801562:	00 00 00 
+  801565:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156a:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801571:	00 00 00 
+  801574:	41 ff d1             	call   *%r9
+
+0000000000801577 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801577:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80157a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80157f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801584:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80158a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801590:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801596:	0f 05                	syscall
+    if (check && ret > 0) {
+  801598:	48 85 c0             	test   %rax,%rax
+  80159b:	7f 01                	jg     80159e <sys_env_set_trapframe+0x27>
+}
+  80159d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80159e:	55                   	push   %rbp
+  80159f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a2:	49 89 c0             	mov    %rax,%r8
+  8015a5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015aa:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8015b1:	00 00 00 
+  8015b4:	be 29 00 00 00       	mov    $0x29,%esi
+  8015b9:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8015c0:	00 00 00 
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  8015cf:	00 00 00 
+  8015d2:	41 ff d1             	call   *%r9
+
+00000000008015d5 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015d5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015d8:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015f6:	48 85 c0             	test   %rax,%rax
+  8015f9:	7f 01                	jg     8015fc <sys_env_set_pgfault_upcall+0x27>
+}
+  8015fb:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015fc:	55                   	push   %rbp
+  8015fd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801600:	49 89 c0             	mov    %rax,%r8
+  801603:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801608:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  80160f:	00 00 00 
+  801612:	be 29 00 00 00       	mov    $0x29,%esi
+  801617:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  80161e:	00 00 00 
+  801621:	b8 00 00 00 00       	mov    $0x0,%eax
+  801626:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  80162d:	00 00 00 
+  801630:	41 ff d1             	call   *%r9
+
+0000000000801633 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801633:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801636:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801639:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80163e:	4d 63 c0             	movslq %r8d,%r8
+  801641:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801647:	0f 05                	syscall
+}
+  801649:	c3                   	ret
+
+000000000080164a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80164a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80164d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801650:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801655:	4d 63 c0             	movslq %r8d,%r8
+  801658:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80165e:	0f 05                	syscall
+}
+  801660:	c3                   	ret
+
+0000000000801661 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801661:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801666:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801669:	45 89 c0             	mov    %r8d,%r8d
+  80166c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801672:	0f 05                	syscall
+    if (check && ret > 0) {
+  801674:	48 85 c0             	test   %rax,%rax
+  801677:	7f 01                	jg     80167a <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801679:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80167e:	49 89 c0             	mov    %rax,%r8
+  801681:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801686:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  80168d:	00 00 00 
+  801690:	be 29 00 00 00       	mov    $0x29,%esi
+  801695:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  80169c:	00 00 00 
+  80169f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a4:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  8016ab:	00 00 00 
+  8016ae:	41 ff d1             	call   *%r9
+
+00000000008016b1 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8016b1:	55                   	push   %rbp
+  8016b2:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8016b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016bb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c5:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  8016cc:	00 00 00 
+  8016cf:	ff d0                	call   *%rax
+}
+  8016d1:	5d                   	pop    %rbp
+  8016d2:	c3                   	ret
+
+00000000008016d3 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016d3:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016dd:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016f3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f9:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016fb:	c3                   	ret
+
+00000000008016fc <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016fc:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801701:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801706:	ba 00 00 00 00       	mov    $0x0,%edx
+  80170b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801711:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801717:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80171d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80171f:	48 85 c0             	test   %rax,%rax
+  801722:	7f 01                	jg     801725 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801724:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801725:	55                   	push   %rbp
+  801726:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801729:	49 89 c0             	mov    %rax,%r8
+  80172c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801731:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801738:	00 00 00 
+  80173b:	be 29 00 00 00       	mov    $0x29,%esi
+  801740:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801747:	00 00 00 
+  80174a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174f:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801756:	00 00 00 
+  801759:	41 ff d1             	call   *%r9
+
+000000000080175c <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80175c:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801761:	bf 00 00 00 00       	mov    $0x0,%edi
+  801766:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80176b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801770:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801776:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80177c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801782:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801784:	c3                   	ret
+
+0000000000801785 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801785:	89 d2                	mov    %edx,%edx
+  801787:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801789:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80178e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801794:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80179a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017a0:	0f 05                	syscall
+}
+  8017a2:	c3                   	ret
+
+00000000008017a3 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017a3:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017a6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017c2:	0f 05                	syscall
+}
+  8017c4:	c3                   	ret
+
+00000000008017c5 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8017c5:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017c8:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017d8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017e4:	0f 05                	syscall
+}
+  8017e6:	c3                   	ret
+
+00000000008017e7 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8017e7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017ea:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017ef:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017f9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801805:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80180b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80180d:	48 85 c0             	test   %rax,%rax
+  801810:	7f 01                	jg     801813 <sys_irq_ack+0x2c>
+}
+  801812:	c3                   	ret
+sys_irq_ack(int irq) {
+  801813:	55                   	push   %rbp
+  801814:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801817:	49 89 c0             	mov    %rax,%r8
+  80181a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80181f:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801826:	00 00 00 
+  801829:	be 29 00 00 00       	mov    $0x29,%esi
+  80182e:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801835:	00 00 00 
+  801838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80183d:	49 b9 43 04 80 00 00 	movabs $0x800443,%r9
+  801844:	00 00 00 
+  801847:	41 ff d1             	call   *%r9
+
+000000000080184a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80184a:	55                   	push   %rbp
+  80184b:	48 89 e5             	mov    %rsp,%rbp
+  80184e:	41 55                	push   %r13
+  801850:	41 54                	push   %r12
+  801852:	53                   	push   %rbx
+  801853:	48 83 ec 08          	sub    $0x8,%rsp
+  801857:	49 89 fd             	mov    %rdi,%r13
+  80185a:	48 89 f7             	mov    %rsi,%rdi
+  80185d:	48 89 d3             	mov    %rdx,%rbx
+  801860:	49 89 cc             	mov    %rcx,%r12
+  801863:	4c 89 c2             	mov    %r8,%rdx
+  801866:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801869:	48 85 f6             	test   %rsi,%rsi
+  80186c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801873:	00 00 00 
+  801876:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80187a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80187f:	48 85 db             	test   %rbx,%rbx
+  801882:	74 03                	je     801887 <ipc_recv_futex+0x3d>
+  801884:	48 8b 33             	mov    (%rbx),%rsi
+  801887:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80188b:	48 b8 61 16 80 00 00 	movabs $0x801661,%rax
+  801892:	00 00 00 
+  801895:	ff d0                	call   *%rax
+    if (res < 0) {
+  801897:	85 c0                	test   %eax,%eax
+  801899:	78 75                	js     801910 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80189b:	4d 85 ed             	test   %r13,%r13
+  80189e:	74 14                	je     8018b4 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8018a0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018a7:	00 00 00 
+  8018aa:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8018b0:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8018b4:	4d 85 e4             	test   %r12,%r12
+  8018b7:	74 14                	je     8018cd <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8018b9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018c0:	00 00 00 
+  8018c3:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8018c9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8018cd:	48 85 db             	test   %rbx,%rbx
+  8018d0:	74 23                	je     8018f5 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8018d2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018d9:	00 00 00 
+  8018dc:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8018e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e7:	85 c9                	test   %ecx,%ecx
+  8018e9:	74 07                	je     8018f2 <ipc_recv_futex+0xa8>
+  8018eb:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8018f2:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8018f5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018fc:	00 00 00 
+  8018ff:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801905:	48 83 c4 08          	add    $0x8,%rsp
+  801909:	5b                   	pop    %rbx
+  80190a:	41 5c                	pop    %r12
+  80190c:	41 5d                	pop    %r13
+  80190e:	5d                   	pop    %rbp
+  80190f:	c3                   	ret
+        if (from_env_store != NULL) {
+  801910:	4d 85 ed             	test   %r13,%r13
+  801913:	74 08                	je     80191d <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801915:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80191c:	00 
+        if (perm_store != NULL) {
+  80191d:	4d 85 e4             	test   %r12,%r12
+  801920:	74 08                	je     80192a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801922:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801929:	00 
+        if (size != NULL) {
+  80192a:	48 85 db             	test   %rbx,%rbx
+  80192d:	74 d6                	je     801905 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80192f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801936:	eb cd                	jmp    801905 <ipc_recv_futex+0xbb>
+
+0000000000801938 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801938:	55                   	push   %rbp
+  801939:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80193c:	48 83 ec 08          	sub    $0x8,%rsp
+  801940:	6a 00                	push   $0x0
+  801942:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801948:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80194e:	48 b8 4a 18 80 00 00 	movabs $0x80184a,%rax
+  801955:	00 00 00 
+  801958:	ff d0                	call   *%rax
+}
+  80195a:	c9                   	leave
+  80195b:	c3                   	ret
+
+000000000080195c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80195c:	55                   	push   %rbp
+  80195d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801960:	48 85 d2             	test   %rdx,%rdx
+  801963:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80196a:	00 00 00 
+  80196d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801971:	89 f6                	mov    %esi,%esi
+  801973:	48 b8 4a 16 80 00 00 	movabs $0x80164a,%rax
+  80197a:	00 00 00 
+  80197d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80197f:	85 c0                	test   %eax,%eax
+  801981:	78 02                	js     801985 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801983:	5d                   	pop    %rbp
+  801984:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801985:	89 c1                	mov    %eax,%ecx
+  801987:	48 ba 45 50 80 00 00 	movabs $0x805045,%rdx
+  80198e:	00 00 00 
+  801991:	be 50 00 00 00       	mov    $0x50,%esi
+  801996:	48 bf 59 50 80 00 00 	movabs $0x805059,%rdi
+  80199d:	00 00 00 
+  8019a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019a5:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  8019ac:	00 00 00 
+  8019af:	41 ff d0             	call   *%r8
+
+00000000008019b2 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8019b2:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8019b7:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8019be:	00 00 00 
+  8019c1:	48 89 d0             	mov    %rdx,%rax
+  8019c4:	48 c1 e0 04          	shl    $0x4,%rax
+  8019c8:	48 29 d0             	sub    %rdx,%rax
+  8019cb:	48 c1 e0 05          	shl    $0x5,%rax
+  8019cf:	48 01 c8             	add    %rcx,%rax
+  8019d2:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8019d8:	39 f8                	cmp    %edi,%eax
+  8019da:	74 13                	je     8019ef <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8019dc:	48 83 c2 01          	add    $0x1,%rdx
+  8019e0:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8019e7:	75 d8                	jne    8019c1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8019e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ee:	c3                   	ret
+            return envs[i].env_id;
+  8019ef:	48 89 d0             	mov    %rdx,%rax
+  8019f2:	48 c1 e0 04          	shl    $0x4,%rax
+  8019f6:	48 29 d0             	sub    %rdx,%rax
+  8019f9:	48 c1 e0 05          	shl    $0x5,%rax
+  8019fd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a04:	00 00 00 
+  801a07:	48 01 d0             	add    %rdx,%rax
+  801a0a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801a10:	c3                   	ret
+
+0000000000801a11 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a11:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a18:	ff ff ff 
+  801a1b:	48 01 f8             	add    %rdi,%rax
+  801a1e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a22:	c3                   	ret
+
+0000000000801a23 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a23:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a2a:	ff ff ff 
+  801a2d:	48 01 f8             	add    %rdi,%rax
+  801a30:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a34:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a3a:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a3e:	c3                   	ret
+
+0000000000801a3f <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a3f:	55                   	push   %rbp
+  801a40:	48 89 e5             	mov    %rsp,%rbp
+  801a43:	41 57                	push   %r15
+  801a45:	41 56                	push   %r14
+  801a47:	41 55                	push   %r13
+  801a49:	41 54                	push   %r12
+  801a4b:	53                   	push   %rbx
+  801a4c:	48 83 ec 08          	sub    $0x8,%rsp
+  801a50:	49 89 ff             	mov    %rdi,%r15
+  801a53:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a58:	49 bd ce 41 80 00 00 	movabs $0x8041ce,%r13
+  801a5f:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a62:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a68:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a6b:	48 89 df             	mov    %rbx,%rdi
+  801a6e:	41 ff d5             	call   *%r13
+  801a71:	83 e0 04             	and    $0x4,%eax
+  801a74:	74 17                	je     801a8d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a76:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a7d:	4c 39 f3             	cmp    %r14,%rbx
+  801a80:	75 e6                	jne    801a68 <fd_alloc+0x29>
+  801a82:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a88:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a8d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a90:	48 83 c4 08          	add    $0x8,%rsp
+  801a94:	5b                   	pop    %rbx
+  801a95:	41 5c                	pop    %r12
+  801a97:	41 5d                	pop    %r13
+  801a99:	41 5e                	pop    %r14
+  801a9b:	41 5f                	pop    %r15
+  801a9d:	5d                   	pop    %rbp
+  801a9e:	c3                   	ret
+
+0000000000801a9f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a9f:	83 ff 1f             	cmp    $0x1f,%edi
+  801aa2:	77 39                	ja     801add <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	41 54                	push   %r12
+  801aaa:	53                   	push   %rbx
+  801aab:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aae:	48 63 df             	movslq %edi,%rbx
+  801ab1:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ab8:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801abc:	48 89 df             	mov    %rbx,%rdi
+  801abf:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  801ac6:	00 00 00 
+  801ac9:	ff d0                	call   *%rax
+  801acb:	a8 04                	test   $0x4,%al
+  801acd:	74 14                	je     801ae3 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801acf:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ad3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ad8:	5b                   	pop    %rbx
+  801ad9:	41 5c                	pop    %r12
+  801adb:	5d                   	pop    %rbp
+  801adc:	c3                   	ret
+        return -E_INVAL;
+  801add:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ae2:	c3                   	ret
+        return -E_INVAL;
+  801ae3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae8:	eb ee                	jmp    801ad8 <fd_lookup+0x39>
+
+0000000000801aea <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801aea:	55                   	push   %rbp
+  801aeb:	48 89 e5             	mov    %rsp,%rbp
+  801aee:	41 54                	push   %r12
+  801af0:	53                   	push   %rbx
+  801af1:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801af4:	48 b8 00 51 80 00 00 	movabs $0x805100,%rax
+  801afb:	00 00 00 
+  801afe:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b05:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b08:	39 3b                	cmp    %edi,(%rbx)
+  801b0a:	74 47                	je     801b53 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b0c:	48 83 c0 08          	add    $0x8,%rax
+  801b10:	48 8b 18             	mov    (%rax),%rbx
+  801b13:	48 85 db             	test   %rbx,%rbx
+  801b16:	75 f0                	jne    801b08 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b18:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b1f:	00 00 00 
+  801b22:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b28:	89 fa                	mov    %edi,%edx
+  801b2a:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  801b31:	00 00 00 
+  801b34:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b39:	48 b9 93 05 80 00 00 	movabs $0x800593,%rcx
+  801b40:	00 00 00 
+  801b43:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b45:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b4a:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b4e:	5b                   	pop    %rbx
+  801b4f:	41 5c                	pop    %r12
+  801b51:	5d                   	pop    %rbp
+  801b52:	c3                   	ret
+            return 0;
+  801b53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b58:	eb f0                	jmp    801b4a <dev_lookup+0x60>
+
+0000000000801b5a <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b5a:	55                   	push   %rbp
+  801b5b:	48 89 e5             	mov    %rsp,%rbp
+  801b5e:	41 55                	push   %r13
+  801b60:	41 54                	push   %r12
+  801b62:	53                   	push   %rbx
+  801b63:	48 83 ec 18          	sub    $0x18,%rsp
+  801b67:	48 89 fb             	mov    %rdi,%rbx
+  801b6a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b6d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b74:	ff ff ff 
+  801b77:	48 01 df             	add    %rbx,%rdi
+  801b7a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b7e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b82:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	41 89 c5             	mov    %eax,%r13d
+  801b91:	85 c0                	test   %eax,%eax
+  801b93:	78 06                	js     801b9b <fd_close+0x41>
+  801b95:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b99:	74 1a                	je     801bb5 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b9b:	45 84 e4             	test   %r12b,%r12b
+  801b9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ba3:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ba7:	44 89 e8             	mov    %r13d,%eax
+  801baa:	48 83 c4 18          	add    $0x18,%rsp
+  801bae:	5b                   	pop    %rbx
+  801baf:	41 5c                	pop    %r12
+  801bb1:	41 5d                	pop    %r13
+  801bb3:	5d                   	pop    %rbp
+  801bb4:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bb5:	8b 3b                	mov    (%rbx),%edi
+  801bb7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bbb:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	41 89 c5             	mov    %eax,%r13d
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	78 1b                	js     801be9 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bce:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd2:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bd6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bdc:	48 85 c0             	test   %rax,%rax
+  801bdf:	74 08                	je     801be9 <fd_close+0x8f>
+  801be1:	48 89 df             	mov    %rbx,%rdi
+  801be4:	ff d0                	call   *%rax
+  801be6:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801be9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bee:	48 89 de             	mov    %rbx,%rsi
+  801bf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf6:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  801bfd:	00 00 00 
+  801c00:	ff d0                	call   *%rax
+    return res;
+  801c02:	eb a3                	jmp    801ba7 <fd_close+0x4d>
+
+0000000000801c04 <close>:
+
+int
+close(int fdnum) {
+  801c04:	55                   	push   %rbp
+  801c05:	48 89 e5             	mov    %rsp,%rbp
+  801c08:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c0c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c10:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801c17:	00 00 00 
+  801c1a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c1c:	85 c0                	test   %eax,%eax
+  801c1e:	78 15                	js     801c35 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c20:	be 01 00 00 00       	mov    $0x1,%esi
+  801c25:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c29:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  801c30:	00 00 00 
+  801c33:	ff d0                	call   *%rax
+}
+  801c35:	c9                   	leave
+  801c36:	c3                   	ret
+
+0000000000801c37 <close_all>:
+
+void
+close_all(void) {
+  801c37:	55                   	push   %rbp
+  801c38:	48 89 e5             	mov    %rsp,%rbp
+  801c3b:	41 54                	push   %r12
+  801c3d:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c3e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c43:	49 bc 04 1c 80 00 00 	movabs $0x801c04,%r12
+  801c4a:	00 00 00 
+  801c4d:	89 df                	mov    %ebx,%edi
+  801c4f:	41 ff d4             	call   *%r12
+  801c52:	83 c3 01             	add    $0x1,%ebx
+  801c55:	83 fb 20             	cmp    $0x20,%ebx
+  801c58:	75 f3                	jne    801c4d <close_all+0x16>
+}
+  801c5a:	5b                   	pop    %rbx
+  801c5b:	41 5c                	pop    %r12
+  801c5d:	5d                   	pop    %rbp
+  801c5e:	c3                   	ret
+
+0000000000801c5f <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c5f:	55                   	push   %rbp
+  801c60:	48 89 e5             	mov    %rsp,%rbp
+  801c63:	41 57                	push   %r15
+  801c65:	41 56                	push   %r14
+  801c67:	41 55                	push   %r13
+  801c69:	41 54                	push   %r12
+  801c6b:	53                   	push   %rbx
+  801c6c:	48 83 ec 18          	sub    $0x18,%rsp
+  801c70:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c73:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c77:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801c7e:	00 00 00 
+  801c81:	ff d0                	call   *%rax
+  801c83:	89 c3                	mov    %eax,%ebx
+  801c85:	85 c0                	test   %eax,%eax
+  801c87:	0f 88 b8 00 00 00    	js     801d45 <dup+0xe6>
+    close(newfdnum);
+  801c8d:	44 89 e7             	mov    %r12d,%edi
+  801c90:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c9c:	4d 63 ec             	movslq %r12d,%r13
+  801c9f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801ca6:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801caa:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cae:	4c 89 ff             	mov    %r15,%rdi
+  801cb1:	49 be 23 1a 80 00 00 	movabs $0x801a23,%r14
+  801cb8:	00 00 00 
+  801cbb:	41 ff d6             	call   *%r14
+  801cbe:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cc1:	4c 89 ef             	mov    %r13,%rdi
+  801cc4:	41 ff d6             	call   *%r14
+  801cc7:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cca:	48 89 df             	mov    %rbx,%rdi
+  801ccd:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  801cd4:	00 00 00 
+  801cd7:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cd9:	a8 04                	test   $0x4,%al
+  801cdb:	74 2b                	je     801d08 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801cdd:	41 89 c1             	mov    %eax,%r9d
+  801ce0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801ce6:	4c 89 f1             	mov    %r14,%rcx
+  801ce9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cee:	48 89 de             	mov    %rbx,%rsi
+  801cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cf6:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+  801d02:	89 c3                	mov    %eax,%ebx
+  801d04:	85 c0                	test   %eax,%eax
+  801d06:	78 4e                	js     801d56 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d08:	4c 89 ff             	mov    %r15,%rdi
+  801d0b:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  801d12:	00 00 00 
+  801d15:	ff d0                	call   *%rax
+  801d17:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d1a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d20:	4c 89 e9             	mov    %r13,%rcx
+  801d23:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d28:	4c 89 fe             	mov    %r15,%rsi
+  801d2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d30:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  801d37:	00 00 00 
+  801d3a:	ff d0                	call   *%rax
+  801d3c:	89 c3                	mov    %eax,%ebx
+  801d3e:	85 c0                	test   %eax,%eax
+  801d40:	78 14                	js     801d56 <dup+0xf7>
+
+    return newfdnum;
+  801d42:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d45:	89 d8                	mov    %ebx,%eax
+  801d47:	48 83 c4 18          	add    $0x18,%rsp
+  801d4b:	5b                   	pop    %rbx
+  801d4c:	41 5c                	pop    %r12
+  801d4e:	41 5d                	pop    %r13
+  801d50:	41 5e                	pop    %r14
+  801d52:	41 5f                	pop    %r15
+  801d54:	5d                   	pop    %rbp
+  801d55:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d56:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d5b:	4c 89 ee             	mov    %r13,%rsi
+  801d5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d63:	49 bc bd 14 80 00 00 	movabs $0x8014bd,%r12
+  801d6a:	00 00 00 
+  801d6d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d70:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d75:	4c 89 f6             	mov    %r14,%rsi
+  801d78:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7d:	41 ff d4             	call   *%r12
+    return res;
+  801d80:	eb c3                	jmp    801d45 <dup+0xe6>
+
+0000000000801d82 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d82:	55                   	push   %rbp
+  801d83:	48 89 e5             	mov    %rsp,%rbp
+  801d86:	41 56                	push   %r14
+  801d88:	41 55                	push   %r13
+  801d8a:	41 54                	push   %r12
+  801d8c:	53                   	push   %rbx
+  801d8d:	48 83 ec 10          	sub    $0x10,%rsp
+  801d91:	89 fb                	mov    %edi,%ebx
+  801d93:	49 89 f4             	mov    %rsi,%r12
+  801d96:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d99:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d9d:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801da4:	00 00 00 
+  801da7:	ff d0                	call   *%rax
+  801da9:	85 c0                	test   %eax,%eax
+  801dab:	78 4c                	js     801df9 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dad:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801db1:	41 8b 3e             	mov    (%r14),%edi
+  801db4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db8:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  801dbf:	00 00 00 
+  801dc2:	ff d0                	call   *%rax
+  801dc4:	85 c0                	test   %eax,%eax
+  801dc6:	78 35                	js     801dfd <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dc8:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dcc:	83 e0 03             	and    $0x3,%eax
+  801dcf:	83 f8 01             	cmp    $0x1,%eax
+  801dd2:	74 2d                	je     801e01 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dd4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd8:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ddc:	48 85 c0             	test   %rax,%rax
+  801ddf:	74 56                	je     801e37 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801de1:	4c 89 ea             	mov    %r13,%rdx
+  801de4:	4c 89 e6             	mov    %r12,%rsi
+  801de7:	4c 89 f7             	mov    %r14,%rdi
+  801dea:	ff d0                	call   *%rax
+}
+  801dec:	48 83 c4 10          	add    $0x10,%rsp
+  801df0:	5b                   	pop    %rbx
+  801df1:	41 5c                	pop    %r12
+  801df3:	41 5d                	pop    %r13
+  801df5:	41 5e                	pop    %r14
+  801df7:	5d                   	pop    %rbp
+  801df8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df9:	48 98                	cltq
+  801dfb:	eb ef                	jmp    801dec <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dfd:	48 98                	cltq
+  801dff:	eb eb                	jmp    801dec <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e01:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e08:	00 00 00 
+  801e0b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e11:	89 da                	mov    %ebx,%edx
+  801e13:	48 bf a9 50 80 00 00 	movabs $0x8050a9,%rdi
+  801e1a:	00 00 00 
+  801e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e22:	48 b9 93 05 80 00 00 	movabs $0x800593,%rcx
+  801e29:	00 00 00 
+  801e2c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e2e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e35:	eb b5                	jmp    801dec <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e37:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e3e:	eb ac                	jmp    801dec <read+0x6a>
+
+0000000000801e40 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e40:	55                   	push   %rbp
+  801e41:	48 89 e5             	mov    %rsp,%rbp
+  801e44:	41 57                	push   %r15
+  801e46:	41 56                	push   %r14
+  801e48:	41 55                	push   %r13
+  801e4a:	41 54                	push   %r12
+  801e4c:	53                   	push   %rbx
+  801e4d:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e51:	48 85 d2             	test   %rdx,%rdx
+  801e54:	74 54                	je     801eaa <readn+0x6a>
+  801e56:	41 89 fd             	mov    %edi,%r13d
+  801e59:	49 89 f6             	mov    %rsi,%r14
+  801e5c:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e5f:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e64:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e69:	49 bf 82 1d 80 00 00 	movabs $0x801d82,%r15
+  801e70:	00 00 00 
+  801e73:	4c 89 e2             	mov    %r12,%rdx
+  801e76:	48 29 f2             	sub    %rsi,%rdx
+  801e79:	4c 01 f6             	add    %r14,%rsi
+  801e7c:	44 89 ef             	mov    %r13d,%edi
+  801e7f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e82:	85 c0                	test   %eax,%eax
+  801e84:	78 20                	js     801ea6 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e86:	01 c3                	add    %eax,%ebx
+  801e88:	85 c0                	test   %eax,%eax
+  801e8a:	74 08                	je     801e94 <readn+0x54>
+  801e8c:	48 63 f3             	movslq %ebx,%rsi
+  801e8f:	4c 39 e6             	cmp    %r12,%rsi
+  801e92:	72 df                	jb     801e73 <readn+0x33>
+    }
+    return res;
+  801e94:	48 63 c3             	movslq %ebx,%rax
+}
+  801e97:	48 83 c4 08          	add    $0x8,%rsp
+  801e9b:	5b                   	pop    %rbx
+  801e9c:	41 5c                	pop    %r12
+  801e9e:	41 5d                	pop    %r13
+  801ea0:	41 5e                	pop    %r14
+  801ea2:	41 5f                	pop    %r15
+  801ea4:	5d                   	pop    %rbp
+  801ea5:	c3                   	ret
+        if (inc < 0) return inc;
+  801ea6:	48 98                	cltq
+  801ea8:	eb ed                	jmp    801e97 <readn+0x57>
+    int inc = 1, res = 0;
+  801eaa:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801eaf:	eb e3                	jmp    801e94 <readn+0x54>
+
+0000000000801eb1 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801eb1:	55                   	push   %rbp
+  801eb2:	48 89 e5             	mov    %rsp,%rbp
+  801eb5:	41 56                	push   %r14
+  801eb7:	41 55                	push   %r13
+  801eb9:	41 54                	push   %r12
+  801ebb:	53                   	push   %rbx
+  801ebc:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec0:	89 fb                	mov    %edi,%ebx
+  801ec2:	49 89 f4             	mov    %rsi,%r12
+  801ec5:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ec8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ecc:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 47                	js     801f23 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801edc:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ee0:	41 8b 3e             	mov    (%r14),%edi
+  801ee3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ee7:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  801eee:	00 00 00 
+  801ef1:	ff d0                	call   *%rax
+  801ef3:	85 c0                	test   %eax,%eax
+  801ef5:	78 30                	js     801f27 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ef7:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801efc:	74 2d                	je     801f2b <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801efe:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f02:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f06:	48 85 c0             	test   %rax,%rax
+  801f09:	74 56                	je     801f61 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f0b:	4c 89 ea             	mov    %r13,%rdx
+  801f0e:	4c 89 e6             	mov    %r12,%rsi
+  801f11:	4c 89 f7             	mov    %r14,%rdi
+  801f14:	ff d0                	call   *%rax
+}
+  801f16:	48 83 c4 10          	add    $0x10,%rsp
+  801f1a:	5b                   	pop    %rbx
+  801f1b:	41 5c                	pop    %r12
+  801f1d:	41 5d                	pop    %r13
+  801f1f:	41 5e                	pop    %r14
+  801f21:	5d                   	pop    %rbp
+  801f22:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f23:	48 98                	cltq
+  801f25:	eb ef                	jmp    801f16 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f27:	48 98                	cltq
+  801f29:	eb eb                	jmp    801f16 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f2b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f32:	00 00 00 
+  801f35:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f3b:	89 da                	mov    %ebx,%edx
+  801f3d:	48 bf c5 50 80 00 00 	movabs $0x8050c5,%rdi
+  801f44:	00 00 00 
+  801f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f4c:	48 b9 93 05 80 00 00 	movabs $0x800593,%rcx
+  801f53:	00 00 00 
+  801f56:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f58:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f5f:	eb b5                	jmp    801f16 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f61:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f68:	eb ac                	jmp    801f16 <write+0x65>
+
+0000000000801f6a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f6a:	55                   	push   %rbp
+  801f6b:	48 89 e5             	mov    %rsp,%rbp
+  801f6e:	41 54                	push   %r12
+  801f70:	53                   	push   %rbx
+  801f71:	48 83 ec 10          	sub    $0x10,%rsp
+  801f75:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f77:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f7b:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	85 c0                	test   %eax,%eax
+  801f89:	78 3e                	js     801fc9 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f8b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f8f:	41 8b 3c 24          	mov    (%r12),%edi
+  801f93:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f97:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+  801fa3:	85 c0                	test   %eax,%eax
+  801fa5:	78 22                	js     801fc9 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801fa7:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fab:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801faf:	48 85 c0             	test   %rax,%rax
+  801fb2:	74 0b                	je     801fbf <seek+0x55>
+  801fb4:	89 de                	mov    %ebx,%esi
+  801fb6:	4c 89 e7             	mov    %r12,%rdi
+  801fb9:	ff d0                	call   *%rax
+  801fbb:	85 c0                	test   %eax,%eax
+  801fbd:	78 0a                	js     801fc9 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801fbf:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fc9:	48 83 c4 10          	add    $0x10,%rsp
+  801fcd:	5b                   	pop    %rbx
+  801fce:	41 5c                	pop    %r12
+  801fd0:	5d                   	pop    %rbp
+  801fd1:	c3                   	ret
+
+0000000000801fd2 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fd2:	55                   	push   %rbp
+  801fd3:	48 89 e5             	mov    %rsp,%rbp
+  801fd6:	41 55                	push   %r13
+  801fd8:	41 54                	push   %r12
+  801fda:	53                   	push   %rbx
+  801fdb:	48 83 ec 18          	sub    $0x18,%rsp
+  801fdf:	89 fb                	mov    %edi,%ebx
+  801fe1:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe8:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801fef:	00 00 00 
+  801ff2:	ff d0                	call   *%rax
+  801ff4:	85 c0                	test   %eax,%eax
+  801ff6:	78 38                	js     802030 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff8:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ffc:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802000:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802004:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  80200b:	00 00 00 
+  80200e:	ff d0                	call   *%rax
+  802010:	85 c0                	test   %eax,%eax
+  802012:	78 1c                	js     802030 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802014:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802019:	74 20                	je     80203b <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80201b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80201f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802023:	48 85 c0             	test   %rax,%rax
+  802026:	74 47                	je     80206f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802028:	44 89 e6             	mov    %r12d,%esi
+  80202b:	4c 89 ef             	mov    %r13,%rdi
+  80202e:	ff d0                	call   *%rax
+}
+  802030:	48 83 c4 18          	add    $0x18,%rsp
+  802034:	5b                   	pop    %rbx
+  802035:	41 5c                	pop    %r12
+  802037:	41 5d                	pop    %r13
+  802039:	5d                   	pop    %rbp
+  80203a:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80203b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802042:	00 00 00 
+  802045:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80204b:	89 da                	mov    %ebx,%edx
+  80204d:	48 bf 88 50 80 00 00 	movabs $0x805088,%rdi
+  802054:	00 00 00 
+  802057:	b8 00 00 00 00       	mov    $0x0,%eax
+  80205c:	48 b9 93 05 80 00 00 	movabs $0x800593,%rcx
+  802063:	00 00 00 
+  802066:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802068:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80206d:	eb c1                	jmp    802030 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80206f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802074:	eb ba                	jmp    802030 <ftruncate+0x5e>
+
+0000000000802076 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802076:	55                   	push   %rbp
+  802077:	48 89 e5             	mov    %rsp,%rbp
+  80207a:	41 54                	push   %r12
+  80207c:	53                   	push   %rbx
+  80207d:	48 83 ec 10          	sub    $0x10,%rsp
+  802081:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802084:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802088:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  80208f:	00 00 00 
+  802092:	ff d0                	call   *%rax
+  802094:	85 c0                	test   %eax,%eax
+  802096:	78 4e                	js     8020e6 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802098:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80209c:	41 8b 3c 24          	mov    (%r12),%edi
+  8020a0:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020a4:	48 b8 ea 1a 80 00 00 	movabs $0x801aea,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+  8020b0:	85 c0                	test   %eax,%eax
+  8020b2:	78 32                	js     8020e6 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020b4:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020b8:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020bd:	74 30                	je     8020ef <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020bf:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020c2:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020c9:	00 00 00 
+    stat->st_isdir = 0;
+  8020cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020d3:	00 00 00 
+    stat->st_dev = dev;
+  8020d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020dd:	48 89 de             	mov    %rbx,%rsi
+  8020e0:	4c 89 e7             	mov    %r12,%rdi
+  8020e3:	ff 50 28             	call   *0x28(%rax)
+}
+  8020e6:	48 83 c4 10          	add    $0x10,%rsp
+  8020ea:	5b                   	pop    %rbx
+  8020eb:	41 5c                	pop    %r12
+  8020ed:	5d                   	pop    %rbp
+  8020ee:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f4:	eb f0                	jmp    8020e6 <fstat+0x70>
+
+00000000008020f6 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020f6:	55                   	push   %rbp
+  8020f7:	48 89 e5             	mov    %rsp,%rbp
+  8020fa:	41 54                	push   %r12
+  8020fc:	53                   	push   %rbx
+  8020fd:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802100:	be 00 00 00 00       	mov    $0x0,%esi
+  802105:	48 b8 64 32 80 00 00 	movabs $0x803264,%rax
+  80210c:	00 00 00 
+  80210f:	ff d0                	call   *%rax
+  802111:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802113:	85 c0                	test   %eax,%eax
+  802115:	78 25                	js     80213c <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802117:	4c 89 e6             	mov    %r12,%rsi
+  80211a:	89 c7                	mov    %eax,%edi
+  80211c:	48 b8 76 20 80 00 00 	movabs $0x802076,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80212b:	89 df                	mov    %ebx,%edi
+  80212d:	48 b8 04 1c 80 00 00 	movabs $0x801c04,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+
+    return res;
+  802139:	44 89 e3             	mov    %r12d,%ebx
+}
+  80213c:	89 d8                	mov    %ebx,%eax
+  80213e:	5b                   	pop    %rbx
+  80213f:	41 5c                	pop    %r12
+  802141:	5d                   	pop    %rbp
+  802142:	c3                   	ret
+
+0000000000802143 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802143:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80214a:	00 00 00 
+  80214d:	83 38 00             	cmpl   $0x0,(%rax)
+  802150:	74 0a                	je     80215c <fsenv+0x19>
+    return envid;
+}
+  802152:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802159:	00 00 
+  80215b:	c3                   	ret
+fsenv(void) {
+  80215c:	55                   	push   %rbp
+  80215d:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802160:	bf 03 00 00 00       	mov    $0x3,%edi
+  802165:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  80216c:	00 00 00 
+  80216f:	ff d0                	call   *%rax
+  802171:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802178:	00 00 
+}
+  80217a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802181:	00 00 
+  802183:	5d                   	pop    %rbp
+  802184:	c3                   	ret
+
+0000000000802185 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802185:	55                   	push   %rbp
+  802186:	48 89 e5             	mov    %rsp,%rbp
+  802189:	41 54                	push   %r12
+  80218b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80218c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802191:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802196:	48 89 de             	mov    %rbx,%rsi
+  802199:	bf 00 00 00 00       	mov    $0x0,%edi
+  80219e:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8021aa:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8021b1:	00 00 00 
+  8021b4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8021ba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8021bf:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021c4:	48 89 de             	mov    %rbx,%rsi
+  8021c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021cc:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+  8021d8:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8021da:	85 c0                	test   %eax,%eax
+  8021dc:	0f 88 a2 00 00 00    	js     802284 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8021e2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021e9:	00 00 00 
+  8021ec:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021f2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021f7:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8021f9:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8021fe:	49 bc 96 43 80 00 00 	movabs $0x804396,%r12
+  802205:	00 00 00 
+  802208:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80220b:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802210:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802213:	48 b8 43 21 80 00 00 	movabs $0x802143,%rax
+  80221a:	00 00 00 
+  80221d:	ff d0                	call   *%rax
+  80221f:	89 c7                	mov    %eax,%edi
+  802221:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802227:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80222c:	48 89 da             	mov    %rbx,%rdx
+  80222f:	be 09 00 00 00       	mov    $0x9,%esi
+  802234:	48 b8 5c 19 80 00 00 	movabs $0x80195c,%rax
+  80223b:	00 00 00 
+  80223e:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802240:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224a:	be 00 00 00 00       	mov    $0x0,%esi
+  80224f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802254:	48 b8 38 19 80 00 00 	movabs $0x801938,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+  802260:	89 c3                	mov    %eax,%ebx
+  802262:	85 c0                	test   %eax,%eax
+  802264:	78 25                	js     80228b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802266:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80226d:	00 00 00 
+  802270:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802276:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  80227d:	00 00 
+    return 0;
+  80227f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802284:	89 d8                	mov    %ebx,%eax
+  802286:	5b                   	pop    %rbx
+  802287:	41 5c                	pop    %r12
+  802289:	5d                   	pop    %rbp
+  80228a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80228b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802290:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802295:	bf 00 00 00 00       	mov    $0x0,%edi
+  80229a:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  8022a1:	00 00 00 
+  8022a4:	ff d0                	call   *%rax
+        return res;
+  8022a6:	eb dc                	jmp    802284 <fschan_setup+0xff>
+
+00000000008022a8 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8022a8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8022af:	00 00 00 
+  8022b2:	80 38 00             	cmpb   $0x0,(%rax)
+  8022b5:	74 55                	je     80230c <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022b7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8022be:	00 00 00 
+  8022c1:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8022c7:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022cc:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8022d3:	00 00 00 
+  8022d6:	3b 0a                	cmp    (%rdx),%ecx
+  8022d8:	75 01                	jne    8022db <fschan+0x33>
+}
+  8022da:	c3                   	ret
+fschan(void) {
+  8022db:	55                   	push   %rbp
+  8022dc:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022df:	48 b8 85 21 80 00 00 	movabs $0x802185,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+  8022eb:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8022ed:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022f2:	85 d2                	test   %edx,%edx
+  8022f4:	78 02                	js     8022f8 <fschan+0x50>
+}
+  8022f6:	5d                   	pop    %rbp
+  8022f7:	c3                   	ret
+        fschan_enabled = 0;
+  8022f8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8022ff:	00 00 00 
+  802302:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80230a:	eb ea                	jmp    8022f6 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80230c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802311:	c3                   	ret
+
+0000000000802312 <fbuf>:
+fbuf(struct Fd *fd) {
+  802312:	55                   	push   %rbp
+  802313:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802316:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802322:	ba 00 00 00 00       	mov    $0x0,%edx
+  802327:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80232b:	77 12                	ja     80233f <fbuf+0x2d>
+  80232d:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802331:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802338:	00 00 00 
+  80233b:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80233f:	48 89 d0             	mov    %rdx,%rax
+  802342:	5d                   	pop    %rbp
+  802343:	c3                   	ret
+
+0000000000802344 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802344:	55                   	push   %rbp
+  802345:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802348:	48 83 c7 40          	add    $0x40,%rdi
+  80234c:	48 b8 d0 43 80 00 00 	movabs $0x8043d0,%rax
+  802353:	00 00 00 
+  802356:	ff d0                	call   *%rax
+  802358:	84 c0                	test   %al,%al
+  80235a:	75 02                	jne    80235e <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80235c:	5d                   	pop    %rbp
+  80235d:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80235e:	48 b8 43 21 80 00 00 	movabs $0x802143,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+  80236a:	89 c7                	mov    %eax,%edi
+  80236c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802372:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802377:	ba 00 00 00 00       	mov    $0x0,%edx
+  80237c:	be 0a 00 00 00       	mov    $0xa,%esi
+  802381:	48 b8 5c 19 80 00 00 	movabs $0x80195c,%rax
+  802388:	00 00 00 
+  80238b:	ff d0                	call   *%rax
+}
+  80238d:	eb cd                	jmp    80235c <fschan_publish+0x18>
+
+000000000080238f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80238f:	55                   	push   %rbp
+  802390:	48 89 e5             	mov    %rsp,%rbp
+  802393:	41 57                	push   %r15
+  802395:	41 56                	push   %r14
+  802397:	41 55                	push   %r13
+  802399:	41 54                	push   %r12
+  80239b:	53                   	push   %rbx
+  80239c:	48 83 ec 48          	sub    $0x48,%rsp
+  8023a0:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023a4:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8023a8:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8023ab:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8023af:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8023b2:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8023b9:	00 00 00 
+  8023bc:	8b 02                	mov    (%rdx),%eax
+  8023be:	83 c0 01             	add    $0x1,%eax
+  8023c1:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023c6:	0f 44 c1             	cmove  %ecx,%eax
+  8023c9:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8023cb:	4d 85 c0             	test   %r8,%r8
+  8023ce:	74 2c                	je     8023fc <fschan_rw+0x6d>
+  8023d0:	45 89 ce             	mov    %r9d,%r14d
+  8023d3:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8023da:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8023de:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023e4:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8023eb:	00 
+  8023ec:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023f7:	e9 41 01 00 00       	jmp    80253d <fschan_rw+0x1ae>
+  8023fc:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802400:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802404:	e9 9c 01 00 00       	jmp    8025a5 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802409:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80240d:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802410:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802413:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802416:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80241a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80241e:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802422:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802426:	48 89 da             	mov    %rbx,%rdx
+  802429:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  802430:	00 00 00 
+  802433:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802435:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802439:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  802440:	00 00 00 
+  802443:	ff d0                	call   *%rax
+            queued += blk;
+  802445:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802448:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80244c:	4d 39 fc             	cmp    %r15,%r12
+  80244f:	73 6b                	jae    8024bc <fschan_rw+0x12d>
+  802451:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802455:	77 65                	ja     8024bc <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802457:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80245b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80245f:	48 b8 ab 43 80 00 00 	movabs $0x8043ab,%rax
+  802466:	00 00 00 
+  802469:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80246b:	4c 89 fb             	mov    %r15,%rbx
+  80246e:	4c 29 e3             	sub    %r12,%rbx
+  802471:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802476:	48 39 d3             	cmp    %rdx,%rbx
+  802479:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80247d:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802481:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802485:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802489:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80248c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80248e:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802495:	00 00 00 
+  802498:	8b 09                	mov    (%rcx),%ecx
+  80249a:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80249d:	83 fe 03             	cmp    $0x3,%esi
+  8024a0:	0f 85 63 ff ff ff    	jne    802409 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8024a6:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8024aa:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8024ad:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8024b0:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8024b3:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8024b7:	e9 79 ff ff ff       	jmp    802435 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8024bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024c0:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8024c7:	48 89 df             	mov    %rbx,%rdi
+  8024ca:	48 b8 6e 44 80 00 00 	movabs $0x80446e,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8024d6:	48 89 df             	mov    %rbx,%rdi
+  8024d9:	48 b8 fc 43 80 00 00 	movabs $0x8043fc,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8024e9:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8024ed:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8024f1:	75 25                	jne    802518 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8024f3:	8b 40 04             	mov    0x4(%rax),%eax
+  8024f6:	85 c0                	test   %eax,%eax
+  8024f8:	0f 88 86 00 00 00    	js     802584 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024fe:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802502:	74 5b                	je     80255f <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802504:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802508:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80250c:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802510:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802514:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802518:	48 89 df             	mov    %rbx,%rdi
+  80251b:	48 b8 23 44 80 00 00 	movabs $0x804423,%rax
+  802522:	00 00 00 
+  802525:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802527:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80252b:	83 f0 01             	xor    $0x1,%eax
+  80252e:	4d 39 fc             	cmp    %r15,%r12
+  802531:	0f 92 c2             	setb   %dl
+  802534:	84 c2                	test   %al,%dl
+  802536:	75 05                	jne    80253d <fschan_rw+0x1ae>
+  802538:	45 85 ed             	test   %r13d,%r13d
+  80253b:	74 50                	je     80258d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80253d:	4d 39 fc             	cmp    %r15,%r12
+  802540:	0f 92 c1             	setb   %cl
+  802543:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802547:	0f 96 c2             	setbe  %dl
+  80254a:	84 d1                	test   %dl,%cl
+  80254c:	0f 84 6a ff ff ff    	je     8024bc <fschan_rw+0x12d>
+  802552:	84 c0                	test   %al,%al
+  802554:	0f 85 fd fe ff ff    	jne    802457 <fschan_rw+0xc8>
+  80255a:	e9 5d ff ff ff       	jmp    8024bc <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80255f:	48 63 d0             	movslq %eax,%rdx
+  802562:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802566:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80256a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80256e:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802572:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802576:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  80257d:	00 00 00 
+  802580:	ff d0                	call   *%rax
+  802582:	eb 80                	jmp    802504 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802584:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802587:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80258b:	eb 8b                	jmp    802518 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80258d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802592:	0f 85 68 fe ff ff    	jne    802400 <fschan_rw+0x71>
+  802598:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80259b:	85 c0                	test   %eax,%eax
+  80259d:	0f 84 5d fe ff ff    	je     802400 <fschan_rw+0x71>
+  8025a3:	48 98                	cltq
+}
+  8025a5:	48 83 c4 48          	add    $0x48,%rsp
+  8025a9:	5b                   	pop    %rbx
+  8025aa:	41 5c                	pop    %r12
+  8025ac:	41 5d                	pop    %r13
+  8025ae:	41 5e                	pop    %r14
+  8025b0:	41 5f                	pop    %r15
+  8025b2:	5d                   	pop    %rbp
+  8025b3:	c3                   	ret
+
+00000000008025b4 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8025b4:	55                   	push   %rbp
+  8025b5:	48 89 e5             	mov    %rsp,%rbp
+  8025b8:	41 56                	push   %r14
+  8025ba:	41 55                	push   %r13
+  8025bc:	41 54                	push   %r12
+  8025be:	53                   	push   %rbx
+  8025bf:	48 83 ec 10          	sub    $0x10,%rsp
+  8025c3:	49 89 fe             	mov    %rdi,%r14
+  8025c6:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8025c9:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8025cd:	48 29 f3             	sub    %rsi,%rbx
+  8025d0:	48 39 d3             	cmp    %rdx,%rbx
+  8025d3:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8025d7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8025de:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8025df:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8025e4:	49 bd 2d 42 80 00 00 	movabs $0x80422d,%r13
+  8025eb:	00 00 00 
+  8025ee:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8025f5:	76 1e                	jbe    802615 <mmap_fault+0x61>
+  8025f7:	4c 01 e7             	add    %r12,%rdi
+  8025fa:	41 ff d5             	call   *%r13
+  8025fd:	84 c0                	test   %al,%al
+  8025ff:	75 14                	jne    802615 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802601:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802605:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80260c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802610:	48 39 df             	cmp    %rbx,%rdi
+  802613:	72 e2                	jb     8025f7 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802615:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80261c:	00 00 00 
+  80261f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802626:	00 00 00 
+  802629:	4c 89 f0             	mov    %r14,%rax
+  80262c:	48 29 d0             	sub    %rdx,%rax
+  80262f:	48 c1 f8 03          	sar    $0x3,%rax
+  802633:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80263a:	aa aa aa 
+  80263d:	48 0f af c2          	imul   %rdx,%rax
+  802641:	48 c1 e0 0c          	shl    $0xc,%rax
+  802645:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80264a:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80264e:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802650:	44 89 e0             	mov    %r12d,%eax
+  802653:	41 03 46 10          	add    0x10(%r14),%eax
+  802657:	41 2b 06             	sub    (%r14),%eax
+  80265a:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80265d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802661:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802665:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802669:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80266c:	48 b8 43 21 80 00 00 	movabs $0x802143,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+  802678:	89 c7                	mov    %eax,%edi
+  80267a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802680:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802685:	48 89 da             	mov    %rbx,%rdx
+  802688:	be 0f 00 00 00       	mov    $0xf,%esi
+  80268d:	48 b8 5c 19 80 00 00 	movabs $0x80195c,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802699:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80269e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026a2:	4c 89 e6             	mov    %r12,%rsi
+  8026a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026aa:	48 b8 38 19 80 00 00 	movabs $0x801938,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+  8026b6:	48 98                	cltq
+}
+  8026b8:	48 83 c4 10          	add    $0x10,%rsp
+  8026bc:	5b                   	pop    %rbx
+  8026bd:	41 5c                	pop    %r12
+  8026bf:	41 5d                	pop    %r13
+  8026c1:	41 5e                	pop    %r14
+  8026c3:	5d                   	pop    %rbp
+  8026c4:	c3                   	ret
+
+00000000008026c5 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8026c5:	48 8b 37             	mov    (%rdi),%rsi
+  8026c8:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8026cf:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8026d6:	00 00 00 
+  8026d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026de:	eb 0f                	jmp    8026ef <mmap_pgfault+0x2a>
+  8026e0:	c3                   	ret
+  8026e1:	48 83 c1 01          	add    $0x1,%rcx
+  8026e5:	48 83 c2 18          	add    $0x18,%rdx
+  8026e9:	48 83 f9 20          	cmp    $0x20,%rcx
+  8026ed:	74 6e                	je     80275d <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8026ef:	48 8b 02             	mov    (%rdx),%rax
+  8026f2:	48 83 e8 01          	sub    $0x1,%rax
+  8026f6:	48 39 f0             	cmp    %rsi,%rax
+  8026f9:	73 e6                	jae    8026e1 <mmap_pgfault+0x1c>
+  8026fb:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8026ff:	73 e0                	jae    8026e1 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802701:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802705:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270a:	f6 c2 01             	test   $0x1,%dl
+  80270d:	75 d1                	jne    8026e0 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80270f:	f6 c2 02             	test   $0x2,%dl
+  802712:	74 1a                	je     80272e <mmap_pgfault+0x69>
+  802714:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80271d:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802724:	00 00 00 
+  802727:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80272c:	74 35                	je     802763 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80272e:	55                   	push   %rbp
+  80272f:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802732:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802736:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80273d:	00 00 00 
+  802740:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802744:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802749:	48 b8 b4 25 80 00 00 	movabs $0x8025b4,%rax
+  802750:	00 00 00 
+  802753:	ff d0                	call   *%rax
+  802755:	48 85 c0             	test   %rax,%rax
+  802758:	0f 9f c0             	setg   %al
+}
+  80275b:	5d                   	pop    %rbp
+  80275c:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80275d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802762:	c3                   	ret
+}
+  802763:	c3                   	ret
+
+0000000000802764 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802764:	55                   	push   %rbp
+  802765:	48 89 e5             	mov    %rsp,%rbp
+  802768:	41 54                	push   %r12
+  80276a:	53                   	push   %rbx
+  80276b:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80276e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802775:	00 00 00 
+  802778:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80277d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802781:	74 15                	je     802798 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802783:	48 83 c3 01          	add    $0x1,%rbx
+  802787:	48 83 c0 18          	add    $0x18,%rax
+  80278b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80278f:	75 ec                	jne    80277d <mmap_alloc+0x19>
+    return NULL;
+  802791:	b8 00 00 00 00       	mov    $0x0,%eax
+  802796:	eb 52                	jmp    8027ea <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802798:	4c 89 e7             	mov    %r12,%rdi
+  80279b:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+  8027a7:	41 89 c1             	mov    %eax,%r9d
+  8027aa:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8027b1:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027b5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c0:	4c 89 e6             	mov    %r12,%rsi
+  8027c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c8:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  8027cf:	00 00 00 
+  8027d2:	ff d0                	call   *%rax
+  8027d4:	85 c0                	test   %eax,%eax
+  8027d6:	78 17                	js     8027ef <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8027d8:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8027dc:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027e3:	00 00 00 
+  8027e6:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8027ea:	5b                   	pop    %rbx
+  8027eb:	41 5c                	pop    %r12
+  8027ed:	5d                   	pop    %rbp
+  8027ee:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f4:	eb f4                	jmp    8027ea <mmap_alloc+0x86>
+
+00000000008027f6 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8027f6:	55                   	push   %rbp
+  8027f7:	48 89 e5             	mov    %rsp,%rbp
+  8027fa:	41 56                	push   %r14
+  8027fc:	41 55                	push   %r13
+  8027fe:	41 54                	push   %r12
+  802800:	53                   	push   %rbx
+  802801:	48 83 ec 10          	sub    $0x10,%rsp
+  802805:	41 89 fc             	mov    %edi,%r12d
+  802808:	49 89 f5             	mov    %rsi,%r13
+  80280b:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80280e:	48 89 f0             	mov    %rsi,%rax
+  802811:	48 09 d0             	or     %rdx,%rax
+  802814:	75 0d                	jne    802823 <fsipc+0x2d>
+  802816:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802819:	83 f8 04             	cmp    $0x4,%eax
+  80281c:	76 7d                	jbe    80289b <fsipc+0xa5>
+  80281e:	83 ff 0d             	cmp    $0xd,%edi
+  802821:	74 78                	je     80289b <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802823:	48 b8 43 21 80 00 00 	movabs $0x802143,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+  80282f:	89 c7                	mov    %eax,%edi
+  802831:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802838:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80283f:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802846:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80284c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802853:	00 00 00 
+  802856:	44 89 e6             	mov    %r12d,%esi
+  802859:	48 b8 5c 19 80 00 00 	movabs $0x80195c,%rax
+  802860:	00 00 00 
+  802863:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802865:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80286c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80286d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802872:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802876:	4c 89 ee             	mov    %r13,%rsi
+  802879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80287e:	48 b8 38 19 80 00 00 	movabs $0x801938,%rax
+  802885:	00 00 00 
+  802888:	ff d0                	call   *%rax
+  80288a:	89 c3                	mov    %eax,%ebx
+}
+  80288c:	89 d8                	mov    %ebx,%eax
+  80288e:	48 83 c4 10          	add    $0x10,%rsp
+  802892:	5b                   	pop    %rbx
+  802893:	41 5c                	pop    %r12
+  802895:	41 5d                	pop    %r13
+  802897:	41 5e                	pop    %r14
+  802899:	5d                   	pop    %rbp
+  80289a:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80289b:	48 b8 a8 22 80 00 00 	movabs $0x8022a8,%rax
+  8028a2:	00 00 00 
+  8028a5:	ff d0                	call   *%rax
+  8028a7:	49 89 c6             	mov    %rax,%r14
+  8028aa:	48 85 c0             	test   %rax,%rax
+  8028ad:	0f 84 70 ff ff ff    	je     802823 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8028b3:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8028b7:	48 b8 ab 43 80 00 00 	movabs $0x8043ab,%rax
+  8028be:	00 00 00 
+  8028c1:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8028c3:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8028c6:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8028cd:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8028d1:	ba 10 00 00 00       	mov    $0x10,%edx
+  8028d6:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8028dd:	00 00 00 
+  8028e0:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8028ec:	4c 89 f7             	mov    %r14,%rdi
+  8028ef:	48 b8 44 23 80 00 00 	movabs $0x802344,%rax
+  8028f6:	00 00 00 
+  8028f9:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8028fb:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802902:	4c 89 f7             	mov    %r14,%rdi
+  802905:	48 b8 6e 44 80 00 00 	movabs $0x80446e,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802911:	4c 89 f7             	mov    %r14,%rdi
+  802914:	48 b8 fc 43 80 00 00 	movabs $0x8043fc,%rax
+  80291b:	00 00 00 
+  80291e:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802920:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802923:	41 83 fc 05          	cmp    $0x5,%r12d
+  802927:	75 04                	jne    80292d <fsipc+0x137>
+  802929:	85 db                	test   %ebx,%ebx
+  80292b:	79 14                	jns    802941 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80292d:	4c 89 f7             	mov    %r14,%rdi
+  802930:	48 b8 23 44 80 00 00 	movabs $0x804423,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80293c:	e9 4b ff ff ff       	jmp    80288c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802941:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802945:	ba 88 00 00 00       	mov    $0x88,%edx
+  80294a:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802951:	00 00 00 
+  802954:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  80295b:	00 00 00 
+  80295e:	ff d0                	call   *%rax
+  802960:	eb cb                	jmp    80292d <fsipc+0x137>
+
+0000000000802962 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802962:	55                   	push   %rbp
+  802963:	48 89 e5             	mov    %rsp,%rbp
+  802966:	41 57                	push   %r15
+  802968:	41 56                	push   %r14
+  80296a:	41 55                	push   %r13
+  80296c:	41 54                	push   %r12
+  80296e:	53                   	push   %rbx
+  80296f:	48 83 ec 18          	sub    $0x18,%rsp
+  802973:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802977:	49 89 f6             	mov    %rsi,%r14
+  80297a:	49 89 d4             	mov    %rdx,%r12
+  80297d:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802980:	48 b8 a8 22 80 00 00 	movabs $0x8022a8,%rax
+  802987:	00 00 00 
+  80298a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80298c:	48 85 c0             	test   %rax,%rax
+  80298f:	0f 85 96 00 00 00    	jne    802a2b <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802995:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80299c:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80299d:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8029a4:	00 00 00 
+    while (n) {
+  8029a7:	4d 85 e4             	test   %r12,%r12
+  8029aa:	74 79                	je     802a25 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8029ac:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8029b1:	49 39 dc             	cmp    %rbx,%r12
+  8029b4:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8029b8:	48 89 da             	mov    %rbx,%rdx
+  8029bb:	4c 89 f6             	mov    %r14,%rsi
+  8029be:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8029c5:	00 00 00 
+  8029c8:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8029cf:	00 00 00 
+  8029d2:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029d4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8029d8:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029db:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8029de:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8029e1:	44 01 e8             	add    %r13d,%eax
+  8029e4:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8029e8:	41 0f 44 c5          	cmove  %r13d,%eax
+  8029ec:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8029f0:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8029f4:	48 89 da             	mov    %rbx,%rdx
+  8029f7:	be 00 00 00 00       	mov    $0x0,%esi
+  8029fc:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a01:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+        if (res < 0)
+  802a0d:	85 c0                	test   %eax,%eax
+  802a0f:	78 4a                	js     802a5b <devfile_write_direct+0xf9>
+        buf += res;
+  802a11:	48 98                	cltq
+  802a13:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a16:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a1a:	49 29 c4             	sub    %rax,%r12
+  802a1d:	75 8d                	jne    8029ac <devfile_write_direct+0x4a>
+    return write;
+  802a1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a23:	eb 27                	jmp    802a4c <devfile_write_direct+0xea>
+    size_t write = 0;
+  802a25:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802a29:	eb f4                	jmp    802a1f <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a2b:	45 89 e9             	mov    %r13d,%r9d
+  802a2e:	4d 89 e0             	mov    %r12,%r8
+  802a31:	4c 89 f1             	mov    %r14,%rcx
+  802a34:	ba 04 00 00 00       	mov    $0x4,%edx
+  802a39:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a3d:	48 89 c7             	mov    %rax,%rdi
+  802a40:	48 b8 8f 23 80 00 00 	movabs $0x80238f,%rax
+  802a47:	00 00 00 
+  802a4a:	ff d0                	call   *%rax
+}
+  802a4c:	48 83 c4 18          	add    $0x18,%rsp
+  802a50:	5b                   	pop    %rbx
+  802a51:	41 5c                	pop    %r12
+  802a53:	41 5d                	pop    %r13
+  802a55:	41 5e                	pop    %r14
+  802a57:	41 5f                	pop    %r15
+  802a59:	5d                   	pop    %rbp
+  802a5a:	c3                   	ret
+            return res;
+  802a5b:	48 98                	cltq
+  802a5d:	eb ed                	jmp    802a4c <devfile_write_direct+0xea>
+
+0000000000802a5f <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802a5f:	55                   	push   %rbp
+  802a60:	48 89 e5             	mov    %rsp,%rbp
+  802a63:	41 54                	push   %r12
+  802a65:	53                   	push   %rbx
+  802a66:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802a69:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802a75:	48 85 c0             	test   %rax,%rax
+  802a78:	74 71                	je     802aeb <fbuf_flush+0x8c>
+  802a7a:	48 89 c3             	mov    %rax,%rbx
+  802a7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a82:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802a86:	75 05                	jne    802a8d <fbuf_flush+0x2e>
+}
+  802a88:	5b                   	pop    %rbx
+  802a89:	41 5c                	pop    %r12
+  802a8b:	5d                   	pop    %rbp
+  802a8c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802a8d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802a90:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802a94:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a9b:	00 00 00 
+  802a9e:	48 89 de             	mov    %rbx,%rsi
+  802aa1:	48 29 c6             	sub    %rax,%rsi
+  802aa4:	48 c1 fe 03          	sar    $0x3,%rsi
+  802aa8:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802aaf:	aa aa aa 
+  802ab2:	48 0f af f0          	imul   %rax,%rsi
+  802ab6:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802aba:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802abf:	48 01 c6             	add    %rax,%rsi
+  802ac2:	4c 89 e7             	mov    %r12,%rdi
+  802ac5:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802acc:	00 00 00 
+  802acf:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802ad1:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802ad5:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802adc:	00 
+    return res < 0 ? res : 0;
+  802add:	48 85 c0             	test   %rax,%rax
+  802ae0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ae5:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802ae9:	eb 9d                	jmp    802a88 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802aeb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af0:	eb 96                	jmp    802a88 <fbuf_flush+0x29>
+
+0000000000802af2 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802af2:	55                   	push   %rbp
+  802af3:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802af6:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+}
+  802b02:	5d                   	pop    %rbp
+  802b03:	c3                   	ret
+
+0000000000802b04 <devfile_write>:
+    if (!fd || !buf)
+  802b04:	48 85 ff             	test   %rdi,%rdi
+  802b07:	0f 84 d3 01 00 00    	je     802ce0 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b0d:	55                   	push   %rbp
+  802b0e:	48 89 e5             	mov    %rsp,%rbp
+  802b11:	41 57                	push   %r15
+  802b13:	41 56                	push   %r14
+  802b15:	41 55                	push   %r13
+  802b17:	41 54                	push   %r12
+  802b19:	53                   	push   %rbx
+  802b1a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b1e:	49 89 fc             	mov    %rdi,%r12
+  802b21:	49 89 f6             	mov    %rsi,%r14
+  802b24:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802b27:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b2c:	48 85 f6             	test   %rsi,%rsi
+  802b2f:	0f 84 9c 01 00 00    	je     802cd1 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802b35:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  802b3c:	00 00 00 
+  802b3f:	ff d0                	call   *%rax
+  802b41:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802b44:	48 85 c0             	test   %rax,%rax
+  802b47:	0f 84 a2 00 00 00    	je     802bef <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b4d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b52:	4c 89 e7             	mov    %r12,%rdi
+  802b55:	48 b8 dc 13 80 00 00 	movabs $0x8013dc,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802b61:	83 f8 02             	cmp    $0x2,%eax
+  802b64:	0f 8f 85 00 00 00    	jg     802bef <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802b6a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802b71:	00 00 00 
+  802b74:	4d 89 ef             	mov    %r13,%r15
+  802b77:	49 29 c7             	sub    %rax,%r15
+  802b7a:	49 c1 ff 03          	sar    $0x3,%r15
+  802b7e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b85:	aa aa aa 
+  802b88:	4c 0f af f8          	imul   %rax,%r15
+  802b8c:	49 c1 e7 0e          	shl    $0xe,%r15
+  802b90:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b95:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802b98:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b9d:	0f 84 d7 00 00 00    	je     802c7a <devfile_write+0x176>
+  802ba3:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802ba7:	89 c2                	mov    %eax,%edx
+  802ba9:	41 03 55 0c          	add    0xc(%r13),%edx
+  802bad:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802bb2:	75 0f                	jne    802bc3 <devfile_write+0xbf>
+  802bb4:	48 01 d8             	add    %rbx,%rax
+  802bb7:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802bbd:	0f 86 92 00 00 00    	jbe    802c55 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802bc3:	4c 89 e7             	mov    %r12,%rdi
+  802bc6:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802bcd:	00 00 00 
+  802bd0:	ff d0                	call   *%rax
+  802bd2:	85 c0                	test   %eax,%eax
+  802bd4:	78 52                	js     802c28 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bd6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bdd:	77 7f                	ja     802c5e <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802bdf:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802be4:	0f 85 c2 00 00 00    	jne    802cac <devfile_write+0x1a8>
+  802bea:	e9 94 00 00 00       	jmp    802c83 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802bef:	4c 89 e7             	mov    %r12,%rdi
+  802bf2:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802bf9:	00 00 00 
+  802bfc:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	79 07                	jns    802c09 <devfile_write+0x105>
+  802c02:	48 98                	cltq
+  802c04:	e9 c8 00 00 00       	jmp    802cd1 <devfile_write+0x1cd>
+  802c09:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c0e:	48 89 da             	mov    %rbx,%rdx
+  802c11:	4c 89 f6             	mov    %r14,%rsi
+  802c14:	4c 89 e7             	mov    %r12,%rdi
+  802c17:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802c1e:	00 00 00 
+  802c21:	ff d0                	call   *%rax
+  802c23:	e9 a9 00 00 00       	jmp    802cd1 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c28:	48 98                	cltq
+  802c2a:	e9 a2 00 00 00       	jmp    802cd1 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c2f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c34:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c39:	4c 89 fe             	mov    %r15,%rsi
+  802c3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c41:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  802c48:	00 00 00 
+  802c4b:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802c4d:	85 c0                	test   %eax,%eax
+  802c4f:	79 45                	jns    802c96 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c51:	48 98                	cltq
+  802c53:	eb 7c                	jmp    802cd1 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c55:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c5c:	76 4e                	jbe    802cac <devfile_write+0x1a8>
+  802c5e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c63:	48 89 da             	mov    %rbx,%rdx
+  802c66:	4c 89 f6             	mov    %r14,%rsi
+  802c69:	4c 89 e7             	mov    %r12,%rdi
+  802c6c:	48 b8 62 29 80 00 00 	movabs $0x802962,%rax
+  802c73:	00 00 00 
+  802c76:	ff d0                	call   *%rax
+  802c78:	eb 57                	jmp    802cd1 <devfile_write+0x1cd>
+  802c7a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c81:	77 db                	ja     802c5e <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802c83:	4c 89 ff             	mov    %r15,%rdi
+  802c86:	48 b8 2d 42 80 00 00 	movabs $0x80422d,%rax
+  802c8d:	00 00 00 
+  802c90:	ff d0                	call   *%rax
+  802c92:	84 c0                	test   %al,%al
+  802c94:	74 99                	je     802c2f <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802c96:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802c9b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802ca0:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802ca4:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802cab:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802cac:	4c 89 ff             	mov    %r15,%rdi
+  802caf:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802cb3:	48 89 da             	mov    %rbx,%rdx
+  802cb6:	4c 89 f6             	mov    %r14,%rsi
+  802cb9:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  802cc0:	00 00 00 
+  802cc3:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802cc5:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802cc9:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802cce:	48 89 d8             	mov    %rbx,%rax
+}
+  802cd1:	48 83 c4 08          	add    $0x8,%rsp
+  802cd5:	5b                   	pop    %rbx
+  802cd6:	41 5c                	pop    %r12
+  802cd8:	41 5d                	pop    %r13
+  802cda:	41 5e                	pop    %r14
+  802cdc:	41 5f                	pop    %r15
+  802cde:	5d                   	pop    %rbp
+  802cdf:	c3                   	ret
+        return E_INVAL;
+  802ce0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ce5:	c3                   	ret
+
+0000000000802ce6 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802ce6:	55                   	push   %rbp
+  802ce7:	48 89 e5             	mov    %rsp,%rbp
+  802cea:	41 54                	push   %r12
+  802cec:	53                   	push   %rbx
+  802ced:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802cf0:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  802cf7:	00 00 00 
+  802cfa:	ff d0                	call   *%rax
+  802cfc:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802cff:	48 89 df             	mov    %rbx,%rdi
+  802d02:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  802d09:	00 00 00 
+  802d0c:	ff d0                	call   *%rax
+  802d0e:	48 85 c0             	test   %rax,%rax
+  802d11:	74 17                	je     802d2a <devfile_flush+0x44>
+  802d13:	48 89 df             	mov    %rbx,%rdi
+  802d16:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+  802d22:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802d29:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d2a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d2d:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802d34:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802d36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d40:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d45:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d51:	45 85 e4             	test   %r12d,%r12d
+  802d54:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d58:	5b                   	pop    %rbx
+  802d59:	41 5c                	pop    %r12
+  802d5b:	5d                   	pop    %rbp
+  802d5c:	c3                   	ret
+
+0000000000802d5d <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802d5d:	55                   	push   %rbp
+  802d5e:	48 89 e5             	mov    %rsp,%rbp
+  802d61:	41 57                	push   %r15
+  802d63:	41 56                	push   %r14
+  802d65:	41 55                	push   %r13
+  802d67:	41 54                	push   %r12
+  802d69:	53                   	push   %rbx
+  802d6a:	48 83 ec 38          	sub    $0x38,%rsp
+  802d6e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802d72:	49 89 f7             	mov    %rsi,%r15
+  802d75:	48 89 d3             	mov    %rdx,%rbx
+  802d78:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802d7b:	48 b8 a8 22 80 00 00 	movabs $0x8022a8,%rax
+  802d82:	00 00 00 
+  802d85:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d87:	48 85 c0             	test   %rax,%rax
+  802d8a:	75 20                	jne    802dac <devfile_read_direct+0x4f>
+    bool map = 1;
+  802d8c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802d91:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d98:	00 
+    while (n) {
+  802d99:	48 85 db             	test   %rbx,%rbx
+  802d9c:	0f 85 df 00 00 00    	jne    802e81 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802da2:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802da6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802daa:	eb 21                	jmp    802dcd <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802dac:	45 89 f1             	mov    %r14d,%r9d
+  802daf:	49 89 d8             	mov    %rbx,%r8
+  802db2:	4c 89 f9             	mov    %r15,%rcx
+  802db5:	ba 03 00 00 00       	mov    $0x3,%edx
+  802dba:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dbe:	48 89 c7             	mov    %rax,%rdi
+  802dc1:	48 b8 8f 23 80 00 00 	movabs $0x80238f,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+}
+  802dcd:	48 83 c4 38          	add    $0x38,%rsp
+  802dd1:	5b                   	pop    %rbx
+  802dd2:	41 5c                	pop    %r12
+  802dd4:	41 5d                	pop    %r13
+  802dd6:	41 5e                	pop    %r14
+  802dd8:	41 5f                	pop    %r15
+  802dda:	5d                   	pop    %rbp
+  802ddb:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ddc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802de0:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802de6:	75 1e                	jne    802e06 <devfile_read_direct+0xa9>
+  802de8:	e9 e2 00 00 00       	jmp    802ecf <devfile_read_direct+0x172>
+            if (!res) return read;
+  802ded:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802df1:	eb da                	jmp    802dcd <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802df3:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802df7:	0f 85 d0 01 00 00    	jne    802fcd <devfile_read_direct+0x270>
+            map = 0;
+  802dfd:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e01:	eb 03                	jmp    802e06 <devfile_read_direct+0xa9>
+  802e03:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e06:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e0b:	48 39 d3             	cmp    %rdx,%rbx
+  802e0e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e12:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e16:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e19:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802e20:	00 00 00 
+  802e23:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802e25:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802e29:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802e2d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e32:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e37:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  802e3e:	00 00 00 
+  802e41:	ff d0                	call   *%rax
+        if (res <= 0)
+  802e43:	85 c0                	test   %eax,%eax
+  802e45:	0f 8e 63 01 00 00    	jle    802fae <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802e4b:	4c 63 e0             	movslq %eax,%r12
+  802e4e:	4c 89 e2             	mov    %r12,%rdx
+  802e51:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802e58:	00 00 00 
+  802e5b:	4c 89 ff             	mov    %r15,%rdi
+  802e5e:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+        buf += res;
+  802e6a:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802e6d:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802e70:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802e74:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802e78:	48 85 db             	test   %rbx,%rbx
+  802e7b:	0f 84 25 ff ff ff    	je     802da6 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802e81:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802e84:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802e88:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802e8c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e90:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802e97:	0f 97 c2             	seta   %dl
+  802e9a:	20 c2                	and    %al,%dl
+  802e9c:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802e9f:	0f 84 5e ff ff ff    	je     802e03 <devfile_read_direct+0xa6>
+  802ea5:	4c 89 fa             	mov    %r15,%rdx
+  802ea8:	4d 89 fd             	mov    %r15,%r13
+  802eab:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802eb2:	0f 85 4e ff ff ff    	jne    802e06 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802eb8:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802ebc:	0f 84 1a ff ff ff    	je     802ddc <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ec2:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802ec9:	0f 85 37 ff ff ff    	jne    802e06 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802ecf:	48 89 d8             	mov    %rbx,%rax
+  802ed2:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ed8:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802edd:	48 39 c8             	cmp    %rcx,%rax
+  802ee0:	48 0f 47 c1          	cmova  %rcx,%rax
+  802ee4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ee8:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802eec:	49 89 d4             	mov    %rdx,%r12
+  802eef:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802ef3:	48 b8 ce 41 80 00 00 	movabs $0x8041ce,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+  802eff:	a8 40                	test   $0x40,%al
+  802f01:	0f 85 b9 00 00 00    	jne    802fc0 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f07:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802f0e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f12:	49 39 c5             	cmp    %rax,%r13
+  802f15:	72 d8                	jb     802eef <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f17:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f1b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f22:	00 00 00 
+  802f25:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f29:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802f2c:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802f2e:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802f32:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802f36:	48 b8 43 21 80 00 00 	movabs $0x802143,%rax
+  802f3d:	00 00 00 
+  802f40:	ff d0                	call   *%rax
+  802f42:	89 c7                	mov    %eax,%edi
+  802f44:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f4a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f4f:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f56:	00 00 00 
+  802f59:	be 0e 00 00 00       	mov    $0xe,%esi
+  802f5e:	48 b8 5c 19 80 00 00 	movabs $0x80195c,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802f6a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f6f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f73:	4c 89 fe             	mov    %r15,%rsi
+  802f76:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f7b:	48 b8 38 19 80 00 00 	movabs $0x801938,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+  802f87:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802f8a:	48 85 d2             	test   %rdx,%rdx
+  802f8d:	0f 84 5a fe ff ff    	je     802ded <devfile_read_direct+0x90>
+            if (res > 0) {
+  802f93:	0f 8e 5a fe ff ff    	jle    802df3 <devfile_read_direct+0x96>
+                buf += res;
+  802f99:	48 98                	cltq
+  802f9b:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802f9e:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802fa1:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802fa5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802fa9:	e9 ca fe ff ff       	jmp    802e78 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802fae:	41 89 c5             	mov    %eax,%r13d
+  802fb1:	48 98                	cltq
+  802fb3:	45 85 ed             	test   %r13d,%r13d
+  802fb6:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802fbb:	e9 0d fe ff ff       	jmp    802dcd <devfile_read_direct+0x70>
+            map = 0;
+  802fc0:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802fc4:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802fc8:	e9 39 fe ff ff       	jmp    802e06 <devfile_read_direct+0xa9>
+  802fcd:	48 89 d0             	mov    %rdx,%rax
+  802fd0:	e9 f8 fd ff ff       	jmp    802dcd <devfile_read_direct+0x70>
+
+0000000000802fd5 <devfile_read>:
+    if (!fd || !buf)
+  802fd5:	48 85 ff             	test   %rdi,%rdi
+  802fd8:	0f 84 21 02 00 00    	je     8031ff <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fde:	55                   	push   %rbp
+  802fdf:	48 89 e5             	mov    %rsp,%rbp
+  802fe2:	41 57                	push   %r15
+  802fe4:	41 56                	push   %r14
+  802fe6:	41 55                	push   %r13
+  802fe8:	41 54                	push   %r12
+  802fea:	53                   	push   %rbx
+  802feb:	48 83 ec 28          	sub    $0x28,%rsp
+  802fef:	48 89 fb             	mov    %rdi,%rbx
+  802ff2:	49 89 f4             	mov    %rsi,%r12
+  802ff5:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ff8:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ffd:	48 85 f6             	test   %rsi,%rsi
+  803000:	74 4b                	je     80304d <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803002:	48 b8 12 23 80 00 00 	movabs $0x802312,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+  80300e:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803011:	48 85 c0             	test   %rax,%rax
+  803014:	74 22                	je     803038 <devfile_read+0x63>
+  803016:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80301d:	77 19                	ja     803038 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80301f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803024:	48 89 df             	mov    %rbx,%rdi
+  803027:	48 b8 dc 13 80 00 00 	movabs $0x8013dc,%rax
+  80302e:	00 00 00 
+  803031:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803033:	83 f8 02             	cmp    $0x2,%eax
+  803036:	7e 40                	jle    803078 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803038:	48 89 df             	mov    %rbx,%rdi
+  80303b:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  803042:	00 00 00 
+  803045:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803047:	85 c0                	test   %eax,%eax
+  803049:	79 11                	jns    80305c <devfile_read+0x87>
+  80304b:	48 98                	cltq
+}
+  80304d:	48 83 c4 28          	add    $0x28,%rsp
+  803051:	5b                   	pop    %rbx
+  803052:	41 5c                	pop    %r12
+  803054:	41 5d                	pop    %r13
+  803056:	41 5e                	pop    %r14
+  803058:	41 5f                	pop    %r15
+  80305a:	5d                   	pop    %rbp
+  80305b:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80305c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803061:	4c 89 ea             	mov    %r13,%rdx
+  803064:	4c 89 e6             	mov    %r12,%rsi
+  803067:	48 89 df             	mov    %rbx,%rdi
+  80306a:	48 b8 5d 2d 80 00 00 	movabs $0x802d5d,%rax
+  803071:	00 00 00 
+  803074:	ff d0                	call   *%rax
+  803076:	eb d5                	jmp    80304d <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803078:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80307c:	48 89 df             	mov    %rbx,%rdi
+  80307f:	48 b8 5f 2a 80 00 00 	movabs $0x802a5f,%rax
+  803086:	00 00 00 
+  803089:	ff d0                	call   *%rax
+  80308b:	85 c0                	test   %eax,%eax
+  80308d:	0f 88 33 01 00 00    	js     8031c6 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803093:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  80309a:	00 00 00 
+  80309d:	4c 89 f0             	mov    %r14,%rax
+  8030a0:	48 29 d0             	sub    %rdx,%rax
+  8030a3:	48 c1 f8 03          	sar    $0x3,%rax
+  8030a7:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8030ae:	aa aa aa 
+  8030b1:	48 0f af c2          	imul   %rdx,%rax
+  8030b5:	48 c1 e0 0e          	shl    $0xe,%rax
+  8030b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030bd:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030c0:	41 39 06             	cmp    %eax,(%r14)
+  8030c3:	75 0d                	jne    8030d2 <devfile_read+0xfd>
+  8030c5:	8b 43 10             	mov    0x10(%rbx),%eax
+  8030c8:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8030cc:	0f 84 fb 00 00 00    	je     8031cd <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8030d2:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030d7:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030db:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8030de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030e2:	48 89 c7             	mov    %rax,%rdi
+  8030e5:	48 b8 2d 42 80 00 00 	movabs $0x80422d,%rax
+  8030ec:	00 00 00 
+  8030ef:	ff d0                	call   *%rax
+  8030f1:	84 c0                	test   %al,%al
+  8030f3:	75 27                	jne    80311c <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030f5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030fa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8030ff:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803103:	bf 00 00 00 00       	mov    $0x0,%edi
+  803108:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  80310f:	00 00 00 
+  803112:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803114:	85 c0                	test   %eax,%eax
+  803116:	0f 88 dc 00 00 00    	js     8031f8 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80311c:	44 89 f8             	mov    %r15d,%eax
+  80311f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803124:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803126:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80312d:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80312e:	8b 43 10             	mov    0x10(%rbx),%eax
+  803131:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803135:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803138:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80313d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803141:	48 89 df             	mov    %rbx,%rdi
+  803144:	48 b8 5d 2d 80 00 00 	movabs $0x802d5d,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803150:	48 85 c0             	test   %rax,%rax
+  803153:	0f 88 f4 fe ff ff    	js     80304d <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803159:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80315c:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80315f:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803162:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803166:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80316a:	48 63 d1             	movslq %ecx,%rdx
+  80316d:	48 01 d0             	add    %rdx,%rax
+  803170:	4d 63 ff             	movslq %r15d,%r15
+  803173:	4c 29 f8             	sub    %r15,%rax
+  803176:	ba 00 00 00 00       	mov    $0x0,%edx
+  80317b:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80317f:	48 85 c0             	test   %rax,%rax
+  803182:	0f 8e c5 fe ff ff    	jle    80304d <devfile_read+0x78>
+    n = MIN(n, res);
+  803188:	4c 39 e8             	cmp    %r13,%rax
+  80318b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80318f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803192:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803196:	48 63 f6             	movslq %esi,%rsi
+  803199:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80319e:	48 01 c6             	add    %rax,%rsi
+  8031a1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031a5:	48 01 c6             	add    %rax,%rsi
+  8031a8:	4c 89 ea             	mov    %r13,%rdx
+  8031ab:	4c 89 e7             	mov    %r12,%rdi
+  8031ae:	48 b8 19 11 80 00 00 	movabs $0x801119,%rax
+  8031b5:	00 00 00 
+  8031b8:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8031ba:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8031be:	4c 89 e8             	mov    %r13,%rax
+  8031c1:	e9 87 fe ff ff       	jmp    80304d <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8031c6:	48 98                	cltq
+  8031c8:	e9 80 fe ff ff       	jmp    80304d <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031cd:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8031d1:	41 39 d7             	cmp    %edx,%r15d
+  8031d4:	0f 8c f8 fe ff ff    	jl     8030d2 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031da:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8031de:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8031e1:	41 39 cf             	cmp    %ecx,%r15d
+  8031e4:	0f 8d e8 fe ff ff    	jge    8030d2 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8031ea:	4d 63 ff             	movslq %r15d,%r15
+  8031ed:	4c 29 f8             	sub    %r15,%rax
+  8031f0:	48 63 d2             	movslq %edx,%rdx
+  8031f3:	48 01 d0             	add    %rdx,%rax
+  8031f6:	eb 87                	jmp    80317f <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8031f8:	48 98                	cltq
+  8031fa:	e9 4e fe ff ff       	jmp    80304d <devfile_read+0x78>
+        return E_INVAL;
+  8031ff:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803204:	c3                   	ret
+
+0000000000803205 <fs_channel>:
+fs_channel(bool enable) {
+  803205:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803207:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80320e:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803210:	ba 00 00 00 00       	mov    $0x0,%edx
+  803215:	40 84 ff             	test   %dil,%dil
+  803218:	74 47                	je     803261 <fs_channel+0x5c>
+  80321a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803221:	00 00 00 
+  803224:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80322a:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803231:	00 00 00 
+  803234:	3b 08                	cmp    (%rax),%ecx
+  803236:	74 29                	je     803261 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803238:	55                   	push   %rbp
+  803239:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80323c:	48 b8 85 21 80 00 00 	movabs $0x802185,%rax
+  803243:	00 00 00 
+  803246:	ff d0                	call   *%rax
+  803248:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	78 04                	js     803252 <fs_channel+0x4d>
+}
+  80324e:	89 d0                	mov    %edx,%eax
+  803250:	5d                   	pop    %rbp
+  803251:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803252:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803259:	00 00 00 
+  80325c:	c6 00 00             	movb   $0x0,(%rax)
+  80325f:	eb ed                	jmp    80324e <fs_channel+0x49>
+}
+  803261:	89 d0                	mov    %edx,%eax
+  803263:	c3                   	ret
+
+0000000000803264 <open>:
+open(const char *path, int mode) {
+  803264:	55                   	push   %rbp
+  803265:	48 89 e5             	mov    %rsp,%rbp
+  803268:	41 55                	push   %r13
+  80326a:	41 54                	push   %r12
+  80326c:	53                   	push   %rbx
+  80326d:	48 83 ec 18          	sub    $0x18,%rsp
+  803271:	49 89 fc             	mov    %rdi,%r12
+  803274:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803277:	48 b8 7a 0e 80 00 00 	movabs $0x800e7a,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+  803283:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803289:	0f 87 8f 00 00 00    	ja     80331e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80328f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803293:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  80329a:	00 00 00 
+  80329d:	ff d0                	call   *%rax
+  80329f:	89 c3                	mov    %eax,%ebx
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	78 55                	js     8032fa <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8032a5:	4c 89 e6             	mov    %r12,%rsi
+  8032a8:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8032af:	00 00 00 
+  8032b2:	48 89 df             	mov    %rbx,%rdi
+  8032b5:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032c1:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8032c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032cd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032d1:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032d6:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  8032dd:	00 00 00 
+  8032e0:	ff d0                	call   *%rax
+  8032e2:	89 c3                	mov    %eax,%ebx
+  8032e4:	85 c0                	test   %eax,%eax
+  8032e6:	78 1f                	js     803307 <open+0xa3>
+    return fd2num(fd);
+  8032e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032ec:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  8032f3:	00 00 00 
+  8032f6:	ff d0                	call   *%rax
+  8032f8:	89 c3                	mov    %eax,%ebx
+}
+  8032fa:	89 d8                	mov    %ebx,%eax
+  8032fc:	48 83 c4 18          	add    $0x18,%rsp
+  803300:	5b                   	pop    %rbx
+  803301:	41 5c                	pop    %r12
+  803303:	41 5d                	pop    %r13
+  803305:	5d                   	pop    %rbp
+  803306:	c3                   	ret
+        fd_close(fd, 0);
+  803307:	be 00 00 00 00       	mov    $0x0,%esi
+  80330c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803310:	48 b8 5a 1b 80 00 00 	movabs $0x801b5a,%rax
+  803317:	00 00 00 
+  80331a:	ff d0                	call   *%rax
+        return res;
+  80331c:	eb dc                	jmp    8032fa <open+0x96>
+        return -E_BAD_PATH;
+  80331e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803323:	eb d5                	jmp    8032fa <open+0x96>
+
+0000000000803325 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803325:	55                   	push   %rbp
+  803326:	48 89 e5             	mov    %rsp,%rbp
+  803329:	41 56                	push   %r14
+  80332b:	41 55                	push   %r13
+  80332d:	41 54                	push   %r12
+  80332f:	53                   	push   %rbx
+  803330:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803334:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80333b:	00 00 00 
+  80333e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803343:	49 bd 9f 1a 80 00 00 	movabs $0x801a9f,%r13
+  80334a:	00 00 00 
+  80334d:	49 be 5f 2a 80 00 00 	movabs $0x802a5f,%r14
+  803354:	00 00 00 
+  803357:	eb 0c                	jmp    803365 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803359:	83 c3 01             	add    $0x1,%ebx
+  80335c:	49 83 c4 18          	add    $0x18,%r12
+  803360:	83 fb 20             	cmp    $0x20,%ebx
+  803363:	74 1d                	je     803382 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803365:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80336a:	74 ed                	je     803359 <file_flush_buffers+0x34>
+  80336c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803370:	89 df                	mov    %ebx,%edi
+  803372:	41 ff d5             	call   *%r13
+  803375:	85 c0                	test   %eax,%eax
+  803377:	78 e0                	js     803359 <file_flush_buffers+0x34>
+  803379:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80337d:	41 ff d6             	call   *%r14
+  803380:	eb d7                	jmp    803359 <file_flush_buffers+0x34>
+}
+  803382:	48 83 c4 10          	add    $0x10,%rsp
+  803386:	5b                   	pop    %rbx
+  803387:	41 5c                	pop    %r12
+  803389:	41 5d                	pop    %r13
+  80338b:	41 5e                	pop    %r14
+  80338d:	5d                   	pop    %rbp
+  80338e:	c3                   	ret
+
+000000000080338f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80338f:	55                   	push   %rbp
+  803390:	48 89 e5             	mov    %rsp,%rbp
+  803393:	41 54                	push   %r12
+  803395:	53                   	push   %rbx
+  803396:	49 89 fc             	mov    %rdi,%r12
+  803399:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80339b:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8033a7:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033ae:	00 00 00 
+  8033b1:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8033b6:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8033b8:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8033bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c0:	be 00 00 00 00       	mov    $0x0,%esi
+  8033c5:	bf 02 00 00 00       	mov    $0x2,%edi
+  8033ca:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+}
+  8033d6:	5b                   	pop    %rbx
+  8033d7:	41 5c                	pop    %r12
+  8033d9:	5d                   	pop    %rbp
+  8033da:	c3                   	ret
+
+00000000008033db <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8033db:	55                   	push   %rbp
+  8033dc:	48 89 e5             	mov    %rsp,%rbp
+  8033df:	41 54                	push   %r12
+  8033e1:	53                   	push   %rbx
+  8033e2:	49 89 fc             	mov    %rdi,%r12
+  8033e5:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8033e8:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  8033ef:	00 00 00 
+  8033f2:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8033f4:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8033f9:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803400:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803402:	ba 00 00 00 00       	mov    $0x0,%edx
+  803407:	be 00 00 00 00       	mov    $0x0,%esi
+  80340c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803411:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  803418:	00 00 00 
+  80341b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80341d:	85 c0                	test   %eax,%eax
+  80341f:	78 3d                	js     80345e <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803421:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803428:	00 00 00 
+  80342b:	4c 89 e6             	mov    %r12,%rsi
+  80342e:	48 89 df             	mov    %rbx,%rdi
+  803431:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  803438:	00 00 00 
+  80343b:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80343d:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803444:	00 
+  803445:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80344b:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803452:	00 
+  803453:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803459:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345e:	5b                   	pop    %rbx
+  80345f:	41 5c                	pop    %r12
+  803461:	5d                   	pop    %rbp
+  803462:	c3                   	ret
+
+0000000000803463 <remove>:
+remove(const char *path) {
+  803463:	55                   	push   %rbp
+  803464:	48 89 e5             	mov    %rsp,%rbp
+  803467:	53                   	push   %rbx
+  803468:	48 83 ec 08          	sub    $0x8,%rsp
+  80346c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80346f:	48 b8 7a 0e 80 00 00 	movabs $0x800e7a,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803481:	77 3a                	ja     8034bd <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803483:	48 89 de             	mov    %rbx,%rsi
+  803486:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80348d:	00 00 00 
+  803490:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80349c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a6:	bf 07 00 00 00       	mov    $0x7,%edi
+  8034ab:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  8034b2:	00 00 00 
+  8034b5:	ff d0                	call   *%rax
+}
+  8034b7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034bb:	c9                   	leave
+  8034bc:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034bd:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034c2:	eb f3                	jmp    8034b7 <remove+0x54>
+
+00000000008034c4 <sync>:
+sync(void) {
+  8034c4:	55                   	push   %rbp
+  8034c5:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8034c8:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  8034cf:	00 00 00 
+  8034d2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8034d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8034de:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034e3:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  8034ea:	00 00 00 
+  8034ed:	ff d0                	call   *%rax
+}
+  8034ef:	5d                   	pop    %rbp
+  8034f0:	c3                   	ret
+
+00000000008034f1 <fsync>:
+fsync(int fdnum) {
+  8034f1:	55                   	push   %rbp
+  8034f2:	48 89 e5             	mov    %rsp,%rbp
+  8034f5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034f9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034fd:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  803504:	00 00 00 
+  803507:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803509:	85 c0                	test   %eax,%eax
+  80350b:	78 4b                	js     803558 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80350d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803511:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803518:	00 00 00 
+  80351b:	8b 00                	mov    (%rax),%eax
+  80351d:	39 02                	cmp    %eax,(%rdx)
+  80351f:	75 39                	jne    80355a <fsync+0x69>
+    file_flush_buffers();
+  803521:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  803528:	00 00 00 
+  80352b:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80352d:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803531:	8b 40 0c             	mov    0xc(%rax),%eax
+  803534:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80353b:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80353d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803542:	be 00 00 00 00       	mov    $0x0,%esi
+  803547:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80354c:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  803553:	00 00 00 
+  803556:	ff d0                	call   *%rax
+}
+  803558:	c9                   	leave
+  803559:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80355a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80355f:	eb f7                	jmp    803558 <fsync+0x67>
+
+0000000000803561 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803561:	55                   	push   %rbp
+  803562:	48 89 e5             	mov    %rsp,%rbp
+  803565:	53                   	push   %rbx
+  803566:	48 83 ec 08          	sub    $0x8,%rsp
+  80356a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80356d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803572:	be 00 00 00 00       	mov    $0x0,%esi
+  803577:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80357c:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803588:	85 c0                	test   %eax,%eax
+  80358a:	78 2d                	js     8035b9 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80358c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803593:	00 00 00 
+  803596:	48 8b 10             	mov    (%rax),%rdx
+  803599:	48 89 13             	mov    %rdx,(%rbx)
+  80359c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035a0:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8035a4:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8035a8:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8035ac:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035b0:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8035b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035bd:	c9                   	leave
+  8035be:	c3                   	ret
+
+00000000008035bf <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8035bf:	55                   	push   %rbp
+  8035c0:	48 89 e5             	mov    %rsp,%rbp
+  8035c3:	53                   	push   %rbx
+  8035c4:	48 83 ec 08          	sub    $0x8,%rsp
+  8035c8:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8035cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d0:	be 00 00 00 00       	mov    $0x0,%esi
+  8035d5:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8035da:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  8035e1:	00 00 00 
+  8035e4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035e6:	85 c0                	test   %eax,%eax
+  8035e8:	78 3d                	js     803627 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8035ea:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8035f1:	00 00 00 
+  8035f4:	48 8b 10             	mov    (%rax),%rdx
+  8035f7:	48 89 13             	mov    %rdx,(%rbx)
+  8035fa:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035fe:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803602:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803606:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80360a:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80360e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803612:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803616:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80361a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80361e:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803622:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803627:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80362b:	c9                   	leave
+  80362c:	c3                   	ret
+
+000000000080362d <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80362d:	55                   	push   %rbp
+  80362e:	48 89 e5             	mov    %rsp,%rbp
+  803631:	41 57                	push   %r15
+  803633:	41 56                	push   %r14
+  803635:	41 55                	push   %r13
+  803637:	41 54                	push   %r12
+  803639:	53                   	push   %rbx
+  80363a:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80363e:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803645:	00 
+  803646:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80364d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803653:	0f 85 43 01 00 00    	jne    80379c <munmap+0x16f>
+  803659:	49 89 ff             	mov    %rdi,%r15
+  80365c:	4c 39 f7             	cmp    %r14,%rdi
+  80365f:	0f 87 37 01 00 00    	ja     80379c <munmap+0x16f>
+  803665:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80366c:	00 00 00 
+  80366f:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803675:	eb 2c                	jmp    8036a3 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803677:	4c 39 f8             	cmp    %r15,%rax
+  80367a:	0f 83 85 00 00 00    	jae    803705 <munmap+0xd8>
+            m->mm_end = start;
+  803680:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803685:	48 83 c3 18          	add    $0x18,%rbx
+  803689:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803690:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803697:	00 00 00 
+  80369a:	48 39 c3             	cmp    %rax,%rbx
+  80369d:	0f 84 d0 00 00 00    	je     803773 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8036a3:	49 89 dc             	mov    %rbx,%r12
+  8036a6:	48 8b 03             	mov    (%rbx),%rax
+  8036a9:	4c 39 f0             	cmp    %r14,%rax
+  8036ac:	73 d7                	jae    803685 <munmap+0x58>
+  8036ae:	48 85 c0             	test   %rax,%rax
+  8036b1:	74 d2                	je     803685 <munmap+0x58>
+  8036b3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036b7:	49 39 d7             	cmp    %rdx,%r15
+  8036ba:	73 c9                	jae    803685 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8036bc:	49 39 d6             	cmp    %rdx,%r14
+  8036bf:	73 b6                	jae    803677 <munmap+0x4a>
+  8036c1:	49 39 c7             	cmp    %rax,%r15
+  8036c4:	76 b1                	jbe    803677 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8036c6:	4c 89 ef             	mov    %r13,%rdi
+  8036c9:	48 b8 64 27 80 00 00 	movabs $0x802764,%rax
+  8036d0:	00 00 00 
+  8036d3:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8036d5:	48 85 c0             	test   %rax,%rax
+  8036d8:	0f 84 c5 00 00 00    	je     8037a3 <munmap+0x176>
+            *tail = *m;
+  8036de:	48 8b 13             	mov    (%rbx),%rdx
+  8036e1:	48 89 10             	mov    %rdx,(%rax)
+  8036e4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036e8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8036ec:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8036f0:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8036f4:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8036f7:	44 89 f2             	mov    %r14d,%edx
+  8036fa:	2b 13                	sub    (%rbx),%edx
+  8036fc:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8036ff:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803703:	eb 80                	jmp    803685 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803705:	49 39 d6             	cmp    %rdx,%r14
+  803708:	73 18                	jae    803722 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80370a:	44 89 f2             	mov    %r14d,%edx
+  80370d:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803712:	29 c2                	sub    %eax,%edx
+  803714:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803719:	4d 89 34 24          	mov    %r14,(%r12)
+  80371d:	e9 63 ff ff ff       	jmp    803685 <munmap+0x58>
+    m->mm_start = 0;
+  803722:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803729:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80372a:	4c 89 e6             	mov    %r12,%rsi
+  80372d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803734:	00 00 00 
+  803737:	48 29 c6             	sub    %rax,%rsi
+  80373a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80373e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803745:	aa aa aa 
+  803748:	48 0f af f0          	imul   %rax,%rsi
+  80374c:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803750:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803755:	48 01 c6             	add    %rax,%rsi
+  803758:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80375d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803762:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  803769:	00 00 00 
+  80376c:	ff d0                	call   *%rax
+}
+  80376e:	e9 12 ff ff ff       	jmp    803685 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803773:	4c 89 f2             	mov    %r14,%rdx
+  803776:	4c 29 fa             	sub    %r15,%rdx
+  803779:	4c 89 fe             	mov    %r15,%rsi
+  80377c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803781:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  803788:	00 00 00 
+  80378b:	ff d0                	call   *%rax
+}
+  80378d:	48 83 c4 08          	add    $0x8,%rsp
+  803791:	5b                   	pop    %rbx
+  803792:	41 5c                	pop    %r12
+  803794:	41 5d                	pop    %r13
+  803796:	41 5e                	pop    %r14
+  803798:	41 5f                	pop    %r15
+  80379a:	5d                   	pop    %rbp
+  80379b:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80379c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037a1:	eb ea                	jmp    80378d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8037a3:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8037a8:	eb e3                	jmp    80378d <munmap+0x160>
+
+00000000008037aa <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8037aa:	55                   	push   %rbp
+  8037ab:	48 89 e5             	mov    %rsp,%rbp
+  8037ae:	41 57                	push   %r15
+  8037b0:	41 56                	push   %r14
+  8037b2:	41 55                	push   %r13
+  8037b4:	41 54                	push   %r12
+  8037b6:	53                   	push   %rbx
+  8037b7:	48 83 ec 28          	sub    $0x28,%rsp
+  8037bb:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8037bf:	49 89 f5             	mov    %rsi,%r13
+  8037c2:	41 89 d6             	mov    %edx,%r14d
+  8037c5:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8037c8:	41 89 cc             	mov    %ecx,%r12d
+  8037cb:	44 89 c7             	mov    %r8d,%edi
+  8037ce:	44 89 cb             	mov    %r9d,%ebx
+  8037d1:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037d5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037d9:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+  8037e5:	41 89 c7             	mov    %eax,%r15d
+  8037e8:	85 c0                	test   %eax,%eax
+  8037ea:	0f 88 ae 01 00 00    	js     80399e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037f4:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8037fb:	00 00 00 
+  8037fe:	8b 32                	mov    (%rdx),%esi
+  803800:	39 30                	cmp    %esi,(%rax)
+  803802:	0f 85 7a 02 00 00    	jne    803a82 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803808:	8b 40 08             	mov    0x8(%rax),%eax
+  80380b:	83 e0 03             	and    $0x3,%eax
+  80380e:	83 f8 01             	cmp    $0x1,%eax
+  803811:	0f 84 76 02 00 00    	je     803a8d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803817:	4d 85 ed             	test   %r13,%r13
+  80381a:	0f 84 78 02 00 00    	je     803a98 <mmap+0x2ee>
+  803820:	85 db                	test   %ebx,%ebx
+  803822:	0f 88 70 02 00 00    	js     803a98 <mmap+0x2ee>
+  803828:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80382e:	41 89 df             	mov    %ebx,%r15d
+  803831:	0f 85 6c 02 00 00    	jne    803aa3 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803837:	44 89 f0             	mov    %r14d,%eax
+  80383a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80383d:	83 f8 04             	cmp    $0x4,%eax
+  803840:	0f 85 68 02 00 00    	jne    803aae <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803846:	44 89 e1             	mov    %r12d,%ecx
+  803849:	83 e1 01             	and    $0x1,%ecx
+  80384c:	0f 95 c2             	setne  %dl
+  80384f:	44 89 e0             	mov    %r12d,%eax
+  803852:	d1 e8                	shr    %eax
+  803854:	83 f0 01             	xor    $0x1,%eax
+  803857:	83 e0 01             	and    $0x1,%eax
+  80385a:	38 c2                	cmp    %al,%dl
+  80385c:	0f 85 57 02 00 00    	jne    803ab9 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803862:	85 c9                	test   %ecx,%ecx
+  803864:	74 0a                	je     803870 <mmap+0xc6>
+  803866:	41 f6 c6 02          	test   $0x2,%r14b
+  80386a:	0f 85 54 02 00 00    	jne    803ac4 <mmap+0x31a>
+    file_flush_buffers();
+  803870:	48 b8 25 33 80 00 00 	movabs $0x803325,%rax
+  803877:	00 00 00 
+  80387a:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80387c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803883:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80388a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80388e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803891:	41 f6 c4 04          	test   $0x4,%r12b
+  803895:	0f 84 15 01 00 00    	je     8039b0 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80389b:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80389e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8038a4:	0f 85 25 02 00 00    	jne    803acf <mmap+0x325>
+  8038aa:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8038ae:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8038b5:	00 00 00 
+  8038b8:	48 39 c2             	cmp    %rax,%rdx
+  8038bb:	0f 82 19 02 00 00    	jb     803ada <mmap+0x330>
+  8038c1:	48 39 c7             	cmp    %rax,%rdi
+  8038c4:	0f 87 10 02 00 00    	ja     803ada <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8038ca:	4c 89 ee             	mov    %r13,%rsi
+  8038cd:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  8038d4:	00 00 00 
+  8038d7:	ff d0                	call   *%rax
+  8038d9:	85 c0                	test   %eax,%eax
+  8038db:	0f 88 04 02 00 00    	js     803ae5 <mmap+0x33b>
+    if (!handler) {
+  8038e1:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8038e8:	00 00 00 
+  8038eb:	80 38 00             	cmpb   $0x0,(%rax)
+  8038ee:	75 2b                	jne    80391b <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038f0:	48 bf c5 26 80 00 00 	movabs $0x8026c5,%rdi
+  8038f7:	00 00 00 
+  8038fa:	48 b8 86 47 80 00 00 	movabs $0x804786,%rax
+  803901:	00 00 00 
+  803904:	ff d0                	call   *%rax
+  803906:	85 c0                	test   %eax,%eax
+  803908:	0f 88 ea 01 00 00    	js     803af8 <mmap+0x34e>
+        handler = 1;
+  80390e:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803915:	00 00 00 
+  803918:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80391b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80391f:	48 b8 64 27 80 00 00 	movabs $0x802764,%rax
+  803926:	00 00 00 
+  803929:	ff d0                	call   *%rax
+  80392b:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80392e:	48 85 c0             	test   %rax,%rax
+  803931:	0f 84 c9 01 00 00    	je     803b00 <mmap+0x356>
+    m->mm_start = va;
+  803937:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80393a:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80393e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803942:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803945:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803949:	44 89 e0             	mov    %r12d,%eax
+  80394c:	c1 e0 06             	shl    $0x6,%eax
+  80394f:	25 80 00 00 00       	and    $0x80,%eax
+  803954:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803957:	09 f0                	or     %esi,%eax
+  803959:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80395d:	41 f6 c4 08          	test   $0x8,%r12b
+  803961:	74 31                	je     803994 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803963:	48 39 d3             	cmp    %rdx,%rbx
+  803966:	73 2c                	jae    803994 <mmap+0x1ea>
+  803968:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80396d:	48 89 de             	mov    %rbx,%rsi
+  803970:	4c 89 f7             	mov    %r14,%rdi
+  803973:	48 b8 b4 25 80 00 00 	movabs $0x8025b4,%rax
+  80397a:	00 00 00 
+  80397d:	ff d0                	call   *%rax
+  80397f:	49 89 c4             	mov    %rax,%r12
+  803982:	48 85 c0             	test   %rax,%rax
+  803985:	0f 8e d7 00 00 00    	jle    803a62 <mmap+0x2b8>
+            va += n;
+  80398b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80398e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803992:	72 d4                	jb     803968 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803994:	49 8b 06             	mov    (%r14),%rax
+  803997:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80399b:	48 89 06             	mov    %rax,(%rsi)
+}
+  80399e:	44 89 f8             	mov    %r15d,%eax
+  8039a1:	48 83 c4 28          	add    $0x28,%rsp
+  8039a5:	5b                   	pop    %rbx
+  8039a6:	41 5c                	pop    %r12
+  8039a8:	41 5d                	pop    %r13
+  8039aa:	41 5e                	pop    %r14
+  8039ac:	41 5f                	pop    %r15
+  8039ae:	5d                   	pop    %rbp
+  8039af:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039b0:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8039b7:	00 00 00 
+  8039ba:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8039bd:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8039c4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039c7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039cc:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8039d3:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039d6:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8039dd:	00 00 00 
+  8039e0:	48 39 d7             	cmp    %rdx,%rdi
+  8039e3:	73 1c                	jae    803a01 <mmap+0x257>
+        return -E_NO_MEM;
+  8039e5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039eb:	eb b1                	jmp    80399e <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039ed:	48 83 c0 01          	add    $0x1,%rax
+  8039f1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8039f5:	77 3f                	ja     803a36 <mmap+0x28c>
+  8039f7:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8039fc:	48 39 d7             	cmp    %rdx,%rdi
+  8039ff:	72 2a                	jb     803a2b <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a01:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a05:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a09:	48 39 d1             	cmp    %rdx,%rcx
+  803a0c:	73 df                	jae    8039ed <mmap+0x243>
+  803a0e:	48 85 c9             	test   %rcx,%rcx
+  803a11:	74 da                	je     8039ed <mmap+0x243>
+  803a13:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a17:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a1c:	48 39 d3             	cmp    %rdx,%rbx
+  803a1f:	73 cc                	jae    8039ed <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803a21:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a29:	eb cc                	jmp    8039f7 <mmap+0x24d>
+        return -E_NO_MEM;
+  803a2b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a31:	e9 68 ff ff ff       	jmp    80399e <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803a36:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803a3b:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803a42:	00 00 00 
+  803a45:	48 39 c2             	cmp    %rax,%rdx
+  803a48:	0f 82 9f 00 00 00    	jb     803aed <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803a4e:	48 85 db             	test   %rbx,%rbx
+  803a51:	0f 85 8a fe ff ff    	jne    8038e1 <mmap+0x137>
+        return -E_NO_MEM;
+  803a57:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a5d:	e9 3c ff ff ff       	jmp    80399e <mmap+0x1f4>
+        if (n < 0) {
+  803a62:	0f 89 2c ff ff ff    	jns    803994 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803a68:	49 8b 3e             	mov    (%r14),%rdi
+  803a6b:	4c 89 ee             	mov    %r13,%rsi
+  803a6e:	48 b8 2d 36 80 00 00 	movabs $0x80362d,%rax
+  803a75:	00 00 00 
+  803a78:	ff d0                	call   *%rax
+            return n;
+  803a7a:	45 89 e7             	mov    %r12d,%r15d
+  803a7d:	e9 1c ff ff ff       	jmp    80399e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803a82:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a88:	e9 11 ff ff ff       	jmp    80399e <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803a8d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a93:	e9 06 ff ff ff       	jmp    80399e <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803a98:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a9e:	e9 fb fe ff ff       	jmp    80399e <mmap+0x1f4>
+  803aa3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803aa9:	e9 f0 fe ff ff       	jmp    80399e <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803aae:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ab4:	e9 e5 fe ff ff       	jmp    80399e <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803ab9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803abf:	e9 da fe ff ff       	jmp    80399e <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803ac4:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803aca:	e9 cf fe ff ff       	jmp    80399e <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803acf:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ad5:	e9 c4 fe ff ff       	jmp    80399e <mmap+0x1f4>
+  803ada:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ae0:	e9 b9 fe ff ff       	jmp    80399e <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803ae5:	41 89 c7             	mov    %eax,%r15d
+  803ae8:	e9 b1 fe ff ff       	jmp    80399e <mmap+0x1f4>
+        return -E_NO_MEM;
+  803aed:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803af3:	e9 a6 fe ff ff       	jmp    80399e <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803af8:	41 89 c7             	mov    %eax,%r15d
+  803afb:	e9 9e fe ff ff       	jmp    80399e <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b00:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b06:	e9 93 fe ff ff       	jmp    80399e <mmap+0x1f4>
+
+0000000000803b0b <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b0b:	55                   	push   %rbp
+  803b0c:	48 89 e5             	mov    %rsp,%rbp
+  803b0f:	41 54                	push   %r12
+  803b11:	53                   	push   %rbx
+  803b12:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b15:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803b1c:	00 00 00 
+  803b1f:	ff d0                	call   *%rax
+  803b21:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b24:	48 be 20 51 80 00 00 	movabs $0x805120,%rsi
+  803b2b:	00 00 00 
+  803b2e:	48 89 df             	mov    %rbx,%rdi
+  803b31:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  803b38:	00 00 00 
+  803b3b:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b3d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b42:	41 2b 04 24          	sub    (%r12),%eax
+  803b46:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b4c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b53:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b56:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b5d:	00 00 00 
+  803b60:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b6c:	5b                   	pop    %rbx
+  803b6d:	41 5c                	pop    %r12
+  803b6f:	5d                   	pop    %rbp
+  803b70:	c3                   	ret
+
+0000000000803b71 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b71:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b74:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803b7a:	8b 17                	mov    (%rdi),%edx
+  803b7c:	85 d2                	test   %edx,%edx
+  803b7e:	75 01                	jne    803b81 <pipe_wakeup+0x10>
+  803b80:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b81:	55                   	push   %rbp
+  803b82:	48 89 e5             	mov    %rsp,%rbp
+  803b85:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803b88:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803b8e:	be 00 04 00 00       	mov    $0x400,%esi
+  803b93:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  803b9a:	00 00 00 
+  803b9d:	ff d0                	call   *%rax
+}
+  803b9f:	5d                   	pop    %rbp
+  803ba0:	c3                   	ret
+
+0000000000803ba1 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803ba1:	55                   	push   %rbp
+  803ba2:	48 89 e5             	mov    %rsp,%rbp
+  803ba5:	41 55                	push   %r13
+  803ba7:	41 54                	push   %r12
+  803ba9:	53                   	push   %rbx
+  803baa:	48 83 ec 08          	sub    $0x8,%rsp
+  803bae:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bb1:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803bb8:	00 00 00 
+  803bbb:	ff d0                	call   *%rax
+  803bbd:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803bc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bc5:	4c 89 e6             	mov    %r12,%rsi
+  803bc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bcd:	49 bc bd 14 80 00 00 	movabs $0x8014bd,%r12
+  803bd4:	00 00 00 
+  803bd7:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803bda:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803bde:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803be2:	49 bd 71 3b 80 00 00 	movabs $0x803b71,%r13
+  803be9:	00 00 00 
+  803bec:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803bef:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bf3:	48 89 de             	mov    %rbx,%rsi
+  803bf6:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803bf9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bfe:	48 89 de             	mov    %rbx,%rsi
+  803c01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c06:	41 ff d4             	call   *%r12
+  803c09:	48 83 c4 08          	add    $0x8,%rsp
+  803c0d:	5b                   	pop    %rbx
+  803c0e:	41 5c                	pop    %r12
+  803c10:	41 5d                	pop    %r13
+  803c12:	5d                   	pop    %rbp
+  803c13:	c3                   	ret
+
+0000000000803c14 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c14:	55                   	push   %rbp
+  803c15:	48 89 e5             	mov    %rsp,%rbp
+  803c18:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c1b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c20:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c25:	48 b8 00 14 80 00 00 	movabs $0x801400,%rax
+  803c2c:	00 00 00 
+  803c2f:	ff d0                	call   *%rax
+  803c31:	85 c0                	test   %eax,%eax
+  803c33:	0f 94 c0             	sete   %al
+  803c36:	0f b6 c0             	movzbl %al,%eax
+}
+  803c39:	5d                   	pop    %rbp
+  803c3a:	c3                   	ret
+
+0000000000803c3b <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c3b:	55                   	push   %rbp
+  803c3c:	48 89 e5             	mov    %rsp,%rbp
+  803c3f:	41 57                	push   %r15
+  803c41:	41 56                	push   %r14
+  803c43:	41 55                	push   %r13
+  803c45:	41 54                	push   %r12
+  803c47:	53                   	push   %rbx
+  803c48:	48 83 ec 38          	sub    $0x38,%rsp
+  803c4c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c50:	49 89 f4             	mov    %rsi,%r12
+  803c53:	49 89 d7             	mov    %rdx,%r15
+  803c56:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c5a:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803c61:	00 00 00 
+  803c64:	ff d0                	call   *%rax
+  803c66:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c69:	4d 85 ff             	test   %r15,%r15
+  803c6c:	0f 84 f1 00 00 00    	je     803d63 <devpipe_write+0x128>
+  803c72:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803c76:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803c7a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803c7e:	49 bd 14 3c 80 00 00 	movabs $0x803c14,%r13
+  803c85:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c88:	49 bf 71 3b 80 00 00 	movabs $0x803b71,%r15
+  803c8f:	00 00 00 
+  803c92:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c9a:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803c9e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ca1:	48 63 ce             	movslq %esi,%rcx
+  803ca4:	48 63 03             	movslq (%rbx),%rax
+  803ca7:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803cad:	48 39 c1             	cmp    %rax,%rcx
+  803cb0:	72 64                	jb     803d16 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cb2:	48 89 de             	mov    %rbx,%rsi
+  803cb5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cb9:	41 ff d5             	call   *%r13
+  803cbc:	85 c0                	test   %eax,%eax
+  803cbe:	0f 85 b9 00 00 00    	jne    803d7d <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cc4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cc8:	4c 89 f7             	mov    %r14,%rdi
+  803ccb:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803cce:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cd1:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803cd8:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cdf:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ce5:	8b 03                	mov    (%rbx),%eax
+  803ce7:	41 39 c4             	cmp    %eax,%r12d
+  803cea:	75 b2                	jne    803c9e <devpipe_write+0x63>
+  803cec:	48 89 de             	mov    %rbx,%rsi
+  803cef:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cf3:	41 ff d5             	call   *%r13
+  803cf6:	85 c0                	test   %eax,%eax
+  803cf8:	75 a0                	jne    803c9a <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cfa:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cff:	44 89 e6             	mov    %r12d,%esi
+  803d02:	48 89 df             	mov    %rbx,%rdi
+  803d05:	48 b8 85 17 80 00 00 	movabs $0x801785,%rax
+  803d0c:	00 00 00 
+  803d0f:	ff d0                	call   *%rax
+  803d11:	e9 7c ff ff ff       	jmp    803c92 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d16:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803d1a:	41 0f b6 38          	movzbl (%r8),%edi
+  803d1e:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d25:	80 80 80 
+  803d28:	48 89 c8             	mov    %rcx,%rax
+  803d2b:	48 f7 e2             	mul    %rdx
+  803d2e:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d32:	48 89 d0             	mov    %rdx,%rax
+  803d35:	48 c1 e0 08          	shl    $0x8,%rax
+  803d39:	48 29 d0             	sub    %rdx,%rax
+  803d3c:	48 c1 e0 04          	shl    $0x4,%rax
+  803d40:	48 29 c1             	sub    %rax,%rcx
+  803d43:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d48:	83 c6 01             	add    $0x1,%esi
+  803d4b:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d4e:	49 83 c0 01          	add    $0x1,%r8
+  803d52:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803d56:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803d5a:	49 39 c0             	cmp    %rax,%r8
+  803d5d:	0f 85 2f ff ff ff    	jne    803c92 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d63:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803d67:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803d6b:	48 b8 71 3b 80 00 00 	movabs $0x803b71,%rax
+  803d72:	00 00 00 
+  803d75:	ff d0                	call   *%rax
+    return n;
+  803d77:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803d7b:	eb 05                	jmp    803d82 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d7d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d82:	48 83 c4 38          	add    $0x38,%rsp
+  803d86:	5b                   	pop    %rbx
+  803d87:	41 5c                	pop    %r12
+  803d89:	41 5d                	pop    %r13
+  803d8b:	41 5e                	pop    %r14
+  803d8d:	41 5f                	pop    %r15
+  803d8f:	5d                   	pop    %rbp
+  803d90:	c3                   	ret
+
+0000000000803d91 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d91:	55                   	push   %rbp
+  803d92:	48 89 e5             	mov    %rsp,%rbp
+  803d95:	41 57                	push   %r15
+  803d97:	41 56                	push   %r14
+  803d99:	41 55                	push   %r13
+  803d9b:	41 54                	push   %r12
+  803d9d:	53                   	push   %rbx
+  803d9e:	48 83 ec 28          	sub    $0x28,%rsp
+  803da2:	49 89 fd             	mov    %rdi,%r13
+  803da5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803da9:	49 89 d4             	mov    %rdx,%r12
+  803dac:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803db0:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803db7:	00 00 00 
+  803dba:	ff d0                	call   *%rax
+  803dbc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803dbf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803dc5:	49 bf 14 3c 80 00 00 	movabs $0x803c14,%r15
+  803dcc:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803dcf:	4d 85 e4             	test   %r12,%r12
+  803dd2:	0f 84 d5 00 00 00    	je     803ead <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803dd8:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803ddc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803de0:	8b 03                	mov    (%rbx),%eax
+  803de2:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803de5:	75 7a                	jne    803e61 <devpipe_read+0xd0>
+            if (i > 0) {
+  803de7:	4d 85 f6             	test   %r14,%r14
+  803dea:	75 50                	jne    803e3c <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803dec:	48 89 de             	mov    %rbx,%rsi
+  803def:	4c 89 ef             	mov    %r13,%rdi
+  803df2:	41 ff d7             	call   *%r15
+  803df5:	85 c0                	test   %eax,%eax
+  803df7:	0f 85 c9 00 00 00    	jne    803ec6 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803dfd:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803e00:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e07:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803e0d:	8b 43 04             	mov    0x4(%rbx),%eax
+  803e10:	41 39 c4             	cmp    %eax,%r12d
+  803e13:	75 cb                	jne    803de0 <devpipe_read+0x4f>
+  803e15:	48 89 de             	mov    %rbx,%rsi
+  803e18:	4c 89 ef             	mov    %r13,%rdi
+  803e1b:	41 ff d7             	call   *%r15
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	75 be                	jne    803de0 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803e22:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803e27:	44 89 e6             	mov    %r12d,%esi
+  803e2a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e2e:	48 b8 85 17 80 00 00 	movabs $0x801785,%rax
+  803e35:	00 00 00 
+  803e38:	ff d0                	call   *%rax
+  803e3a:	eb a4                	jmp    803de0 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e3c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e40:	48 89 de             	mov    %rbx,%rsi
+  803e43:	48 b8 71 3b 80 00 00 	movabs $0x803b71,%rax
+  803e4a:	00 00 00 
+  803e4d:	ff d0                	call   *%rax
+                return i;
+  803e4f:	4c 89 f0             	mov    %r14,%rax
+}
+  803e52:	48 83 c4 28          	add    $0x28,%rsp
+  803e56:	5b                   	pop    %rbx
+  803e57:	41 5c                	pop    %r12
+  803e59:	41 5d                	pop    %r13
+  803e5b:	41 5e                	pop    %r14
+  803e5d:	41 5f                	pop    %r15
+  803e5f:	5d                   	pop    %rbp
+  803e60:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e61:	48 63 c8             	movslq %eax,%rcx
+  803e64:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803e6b:	80 80 80 
+  803e6e:	48 89 c8             	mov    %rcx,%rax
+  803e71:	48 f7 e2             	mul    %rdx
+  803e74:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803e78:	48 89 d0             	mov    %rdx,%rax
+  803e7b:	48 c1 e0 08          	shl    $0x8,%rax
+  803e7f:	48 29 d0             	sub    %rdx,%rax
+  803e82:	48 c1 e0 04          	shl    $0x4,%rax
+  803e86:	48 89 c2             	mov    %rax,%rdx
+  803e89:	48 89 c8             	mov    %rcx,%rax
+  803e8c:	48 29 d0             	sub    %rdx,%rax
+  803e8f:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803e94:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e98:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803e9c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e9f:	49 83 c6 01          	add    $0x1,%r14
+  803ea3:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803ea7:	0f 85 2b ff ff ff    	jne    803dd8 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ead:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803eb1:	48 89 de             	mov    %rbx,%rsi
+  803eb4:	48 b8 71 3b 80 00 00 	movabs $0x803b71,%rax
+  803ebb:	00 00 00 
+  803ebe:	ff d0                	call   *%rax
+    return n;
+  803ec0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ec4:	eb 8c                	jmp    803e52 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecb:	eb 85                	jmp    803e52 <devpipe_read+0xc1>
+
+0000000000803ecd <pipe>:
+pipe(int pfd[2]) {
+  803ecd:	55                   	push   %rbp
+  803ece:	48 89 e5             	mov    %rsp,%rbp
+  803ed1:	41 55                	push   %r13
+  803ed3:	41 54                	push   %r12
+  803ed5:	53                   	push   %rbx
+  803ed6:	48 83 ec 18          	sub    $0x18,%rsp
+  803eda:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803edd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ee1:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  803ee8:	00 00 00 
+  803eeb:	ff d0                	call   *%rax
+  803eed:	89 c3                	mov    %eax,%ebx
+  803eef:	85 c0                	test   %eax,%eax
+  803ef1:	0f 88 a0 01 00 00    	js     804097 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ef7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803efc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f01:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f05:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0a:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  803f11:	00 00 00 
+  803f14:	ff d0                	call   *%rax
+  803f16:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f18:	85 c0                	test   %eax,%eax
+  803f1a:	0f 88 77 01 00 00    	js     804097 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f20:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f24:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  803f2b:	00 00 00 
+  803f2e:	ff d0                	call   *%rax
+  803f30:	89 c3                	mov    %eax,%ebx
+  803f32:	85 c0                	test   %eax,%eax
+  803f34:	0f 88 43 01 00 00    	js     80407d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f3a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f44:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f48:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f4d:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  803f54:	00 00 00 
+  803f57:	ff d0                	call   *%rax
+  803f59:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f5b:	85 c0                	test   %eax,%eax
+  803f5d:	0f 88 1a 01 00 00    	js     80407d <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f67:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803f6e:	00 00 00 
+  803f71:	ff d0                	call   *%rax
+  803f73:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f76:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f7b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f80:	48 89 c6             	mov    %rax,%rsi
+  803f83:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f88:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  803f8f:	00 00 00 
+  803f92:	ff d0                	call   *%rax
+  803f94:	89 c3                	mov    %eax,%ebx
+  803f96:	85 c0                	test   %eax,%eax
+  803f98:	0f 88 c5 00 00 00    	js     804063 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f9e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803fa2:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  803fa9:	00 00 00 
+  803fac:	ff d0                	call   *%rax
+  803fae:	48 89 c1             	mov    %rax,%rcx
+  803fb1:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803fb7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803fbd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fc2:	4c 89 ee             	mov    %r13,%rsi
+  803fc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fca:	48 b8 6d 14 80 00 00 	movabs $0x80146d,%rax
+  803fd1:	00 00 00 
+  803fd4:	ff d0                	call   *%rax
+  803fd6:	89 c3                	mov    %eax,%ebx
+  803fd8:	85 c0                	test   %eax,%eax
+  803fda:	78 6e                	js     80404a <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fdc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fe1:	4c 89 ef             	mov    %r13,%rdi
+  803fe4:	48 b8 dc 13 80 00 00 	movabs $0x8013dc,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+  803ff0:	83 f8 02             	cmp    $0x2,%eax
+  803ff3:	0f 85 ab 00 00 00    	jne    8040a4 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ff9:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804000:	00 00 
+  804002:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804006:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804008:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80400c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804013:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804017:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804019:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80401d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804024:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804028:	48 bb 11 1a 80 00 00 	movabs $0x801a11,%rbx
+  80402f:	00 00 00 
+  804032:	ff d3                	call   *%rbx
+  804034:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804038:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80403c:	ff d3                	call   *%rbx
+  80403e:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804048:	eb 4d                	jmp    804097 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80404a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80404f:	4c 89 ee             	mov    %r13,%rsi
+  804052:	bf 00 00 00 00       	mov    $0x0,%edi
+  804057:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804063:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804068:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80406c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804071:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  804078:	00 00 00 
+  80407b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80407d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804082:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804086:	bf 00 00 00 00       	mov    $0x0,%edi
+  80408b:	48 b8 bd 14 80 00 00 	movabs $0x8014bd,%rax
+  804092:	00 00 00 
+  804095:	ff d0                	call   *%rax
+}
+  804097:	89 d8                	mov    %ebx,%eax
+  804099:	48 83 c4 18          	add    $0x18,%rsp
+  80409d:	5b                   	pop    %rbx
+  80409e:	41 5c                	pop    %r12
+  8040a0:	41 5d                	pop    %r13
+  8040a2:	5d                   	pop    %rbp
+  8040a3:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040a4:	48 b9 50 51 80 00 00 	movabs $0x805150,%rcx
+  8040ab:	00 00 00 
+  8040ae:	48 ba 27 51 80 00 00 	movabs $0x805127,%rdx
+  8040b5:	00 00 00 
+  8040b8:	be 50 00 00 00       	mov    $0x50,%esi
+  8040bd:	48 bf 3c 51 80 00 00 	movabs $0x80513c,%rdi
+  8040c4:	00 00 00 
+  8040c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040cc:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  8040d3:	00 00 00 
+  8040d6:	41 ff d0             	call   *%r8
+
+00000000008040d9 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8040d9:	55                   	push   %rbp
+  8040da:	48 89 e5             	mov    %rsp,%rbp
+  8040dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040e1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040e5:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  8040ec:	00 00 00 
+  8040ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040f1:	85 c0                	test   %eax,%eax
+  8040f3:	78 23                	js     804118 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8040f5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040f9:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  804100:	00 00 00 
+  804103:	ff d0                	call   *%rax
+  804105:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804108:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80410c:	48 b8 14 3c 80 00 00 	movabs $0x803c14,%rax
+  804113:	00 00 00 
+  804116:	ff d0                	call   *%rax
+}
+  804118:	c9                   	leave
+  804119:	c3                   	ret
+
+000000000080411a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80411a:	48 89 f8             	mov    %rdi,%rax
+  80411d:	48 c1 e8 27          	shr    $0x27,%rax
+  804121:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804128:	01 00 00 
+  80412b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80412f:	f6 c2 01             	test   $0x1,%dl
+  804132:	74 6d                	je     8041a1 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804134:	48 89 f8             	mov    %rdi,%rax
+  804137:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80413b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804142:	01 00 00 
+  804145:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804149:	f6 c2 01             	test   $0x1,%dl
+  80414c:	74 62                	je     8041b0 <get_uvpt_entry+0x96>
+  80414e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804155:	01 00 00 
+  804158:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80415c:	f6 c2 80             	test   $0x80,%dl
+  80415f:	75 4f                	jne    8041b0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804161:	48 89 f8             	mov    %rdi,%rax
+  804164:	48 c1 e8 15          	shr    $0x15,%rax
+  804168:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80416f:	01 00 00 
+  804172:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804176:	f6 c2 01             	test   $0x1,%dl
+  804179:	74 44                	je     8041bf <get_uvpt_entry+0xa5>
+  80417b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804182:	01 00 00 
+  804185:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804189:	f6 c2 80             	test   $0x80,%dl
+  80418c:	75 31                	jne    8041bf <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80418e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804192:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804199:	01 00 00 
+  80419c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8041a0:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041a1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8041a8:	01 00 00 
+  8041ab:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041af:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8041b0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8041b7:	01 00 00 
+  8041ba:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041be:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8041bf:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8041c6:	01 00 00 
+  8041c9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041cd:	c3                   	ret
+
+00000000008041ce <get_prot>:
+
+int
+get_prot(void *va) {
+  8041ce:	55                   	push   %rbp
+  8041cf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041d2:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  8041d9:	00 00 00 
+  8041dc:	ff d0                	call   *%rax
+  8041de:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8041e1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8041e6:	89 c1                	mov    %eax,%ecx
+  8041e8:	83 c9 04             	or     $0x4,%ecx
+  8041eb:	f6 c2 01             	test   $0x1,%dl
+  8041ee:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8041f1:	89 c1                	mov    %eax,%ecx
+  8041f3:	83 c9 02             	or     $0x2,%ecx
+  8041f6:	f6 c2 02             	test   $0x2,%dl
+  8041f9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8041fc:	89 c1                	mov    %eax,%ecx
+  8041fe:	83 c9 01             	or     $0x1,%ecx
+  804201:	48 85 d2             	test   %rdx,%rdx
+  804204:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804207:	89 c1                	mov    %eax,%ecx
+  804209:	83 c9 40             	or     $0x40,%ecx
+  80420c:	f6 c6 04             	test   $0x4,%dh
+  80420f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804212:	5d                   	pop    %rbp
+  804213:	c3                   	ret
+
+0000000000804214 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804214:	55                   	push   %rbp
+  804215:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804218:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  80421f:	00 00 00 
+  804222:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804224:	48 c1 e8 06          	shr    $0x6,%rax
+  804228:	83 e0 01             	and    $0x1,%eax
+}
+  80422b:	5d                   	pop    %rbp
+  80422c:	c3                   	ret
+
+000000000080422d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80422d:	55                   	push   %rbp
+  80422e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804231:	48 b8 1a 41 80 00 00 	movabs $0x80411a,%rax
+  804238:	00 00 00 
+  80423b:	ff d0                	call   *%rax
+  80423d:	83 e0 01             	and    $0x1,%eax
+}
+  804240:	5d                   	pop    %rbp
+  804241:	c3                   	ret
+
+0000000000804242 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804242:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804249:	01 00 00 
+  80424c:	a8 01                	test   $0x1,%al
+  80424e:	75 06                	jne    804256 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804250:	b8 00 00 00 00       	mov    $0x0,%eax
+  804255:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804256:	55                   	push   %rbp
+  804257:	48 89 e5             	mov    %rsp,%rbp
+  80425a:	41 57                	push   %r15
+  80425c:	41 56                	push   %r14
+  80425e:	41 55                	push   %r13
+  804260:	41 54                	push   %r12
+  804262:	53                   	push   %rbx
+  804263:	48 83 ec 28          	sub    $0x28,%rsp
+  804267:	49 89 fe             	mov    %rdi,%r14
+  80426a:	49 89 f7             	mov    %rsi,%r15
+  80426d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804274:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804275:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80427c:	01 00 00 
+  80427f:	e9 ae 00 00 00       	jmp    804332 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804284:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80428b:	49 83 ec 01          	sub    $0x1,%r12
+  80428f:	74 2d                	je     8042be <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804291:	48 89 d8             	mov    %rbx,%rax
+  804294:	48 c1 e8 0c          	shr    $0xc,%rax
+  804298:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80429d:	f6 c2 01             	test   $0x1,%dl
+  8042a0:	74 e2                	je     804284 <foreach_shared_region+0x42>
+  8042a2:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8042a7:	f6 c4 04             	test   $0x4,%ah
+  8042aa:	74 d8                	je     804284 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8042ac:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8042b3:	4c 89 fa             	mov    %r15,%rdx
+  8042b6:	48 89 df             	mov    %rbx,%rdi
+  8042b9:	41 ff d6             	call   *%r14
+  8042bc:	eb c6                	jmp    804284 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8042be:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8042c5:	00 
+  8042c6:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8042cb:	74 4a                	je     804317 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8042cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042d1:	48 c1 e8 15          	shr    $0x15,%rax
+  8042d5:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8042dc:	01 00 00 
+  8042df:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042e3:	a8 01                	test   $0x1,%al
+  8042e5:	74 d7                	je     8042be <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8042e7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8042eb:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8042f2:	48 39 c3             	cmp    %rax,%rbx
+  8042f5:	73 c7                	jae    8042be <foreach_shared_region+0x7c>
+  8042f7:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8042fe:	48 39 d0             	cmp    %rdx,%rax
+  804301:	4d 19 e4             	sbb    %r12,%r12
+  804304:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80430b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804312:	e9 7a ff ff ff       	jmp    804291 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804317:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80431e:	40 
+  80431f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804323:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80432a:	00 00 00 
+  80432d:	48 39 c1             	cmp    %rax,%rcx
+  804330:	74 50                	je     804382 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804332:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804336:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80433a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804341:	01 00 00 
+  804344:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804348:	a8 01                	test   $0x1,%al
+  80434a:	74 cb                	je     804317 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80434c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804350:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804357:	48 39 c1             	cmp    %rax,%rcx
+  80435a:	73 bb                	jae    804317 <foreach_shared_region+0xd5>
+  80435c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804363:	48 39 d0             	cmp    %rdx,%rax
+  804366:	48 19 c0             	sbb    %rax,%rax
+  804369:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80436f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804375:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804379:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80437d:	e9 4b ff ff ff       	jmp    8042cd <foreach_shared_region+0x8b>
+  804382:	b8 00 00 00 00       	mov    $0x0,%eax
+  804387:	48 83 c4 28          	add    $0x28,%rsp
+  80438b:	5b                   	pop    %rbx
+  80438c:	41 5c                	pop    %r12
+  80438e:	41 5d                	pop    %r13
+  804390:	41 5e                	pop    %r14
+  804392:	41 5f                	pop    %r15
+  804394:	5d                   	pop    %rbp
+  804395:	c3                   	ret
+
+0000000000804396 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804396:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80439c:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8043a3:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8043aa:	c3                   	ret
+
+00000000008043ab <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8043ab:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043ae:	8b 17                	mov    (%rdi),%edx
+  8043b0:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8043b2:	83 f8 0f             	cmp    $0xf,%eax
+  8043b5:	77 13                	ja     8043ca <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8043b7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043ba:	83 e0 0f             	and    $0xf,%eax
+  8043bd:	48 c1 e0 09          	shl    $0x9,%rax
+  8043c1:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8043c8:	00 
+  8043c9:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8043ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043cf:	c3                   	ret
+
+00000000008043d0 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8043d0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043d3:	83 c0 01             	add    $0x1,%eax
+  8043d6:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8043d9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043df:	8b 57 04             	mov    0x4(%rdi),%edx
+  8043e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e7:	85 d2                	test   %edx,%edx
+  8043e9:	75 04                	jne    8043ef <chan_publish+0x1f>
+  8043eb:	83 e0 01             	and    $0x1,%eax
+}
+  8043ee:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043ef:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8043f2:	85 c0                	test   %eax,%eax
+  8043f4:	0f 95 c0             	setne  %al
+  8043f7:	0f b6 c0             	movzbl %al,%eax
+  8043fa:	eb ef                	jmp    8043eb <chan_publish+0x1b>
+
+00000000008043fc <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8043fc:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043ff:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804401:	29 d0                	sub    %edx,%eax
+  804403:	83 e8 01             	sub    $0x1,%eax
+  804406:	83 f8 0f             	cmp    $0xf,%eax
+  804409:	77 12                	ja     80441d <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80440b:	8b 07                	mov    (%rdi),%eax
+  80440d:	83 e0 0f             	and    $0xf,%eax
+  804410:	48 c1 e0 09          	shl    $0x9,%rax
+  804414:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80441b:	00 
+  80441c:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80441d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804422:	c3                   	ret
+
+0000000000804423 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804423:	8b 07                	mov    (%rdi),%eax
+  804425:	83 c0 01             	add    $0x1,%eax
+  804428:	89 07                	mov    %eax,(%rdi)
+}
+  80442a:	c3                   	ret
+
+000000000080442b <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80442b:	55                   	push   %rbp
+  80442c:	48 89 e5             	mov    %rsp,%rbp
+  80442f:	53                   	push   %rbx
+  804430:	48 83 ec 08          	sub    $0x8,%rsp
+  804434:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804437:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80443e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804444:	48 b8 fc 43 80 00 00 	movabs $0x8043fc,%rax
+  80444b:	00 00 00 
+  80444e:	ff d0                	call   *%rax
+  804450:	48 85 c0             	test   %rax,%rax
+  804453:	74 12                	je     804467 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804455:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80445c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804461:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804465:	c9                   	leave
+  804466:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804467:	b8 01 00 00 00       	mov    $0x1,%eax
+  80446c:	eb f3                	jmp    804461 <chan_arm+0x36>
+
+000000000080446e <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80446e:	55                   	push   %rbp
+  80446f:	48 89 e5             	mov    %rsp,%rbp
+  804472:	41 56                	push   %r14
+  804474:	41 55                	push   %r13
+  804476:	41 54                	push   %r12
+  804478:	53                   	push   %rbx
+  804479:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80447c:	49 bc 2b 44 80 00 00 	movabs $0x80442b,%r12
+  804483:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804486:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80448a:	49 bd 85 17 80 00 00 	movabs $0x801785,%r13
+  804491:	00 00 00 
+    while (chan_arm(r))
+  804494:	eb 0d                	jmp    8044a3 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804496:	8b 33                	mov    (%rbx),%esi
+  804498:	ba 00 00 00 00       	mov    $0x0,%edx
+  80449d:	4c 89 f7             	mov    %r14,%rdi
+  8044a0:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8044a3:	48 89 df             	mov    %rbx,%rdi
+  8044a6:	41 ff d4             	call   *%r12
+  8044a9:	84 c0                	test   %al,%al
+  8044ab:	75 e9                	jne    804496 <chan_wait+0x28>
+}
+  8044ad:	5b                   	pop    %rbx
+  8044ae:	41 5c                	pop    %r12
+  8044b0:	41 5d                	pop    %r13
+  8044b2:	41 5e                	pop    %r14
+  8044b4:	5d                   	pop    %rbp
+  8044b5:	c3                   	ret
+
+00000000008044b6 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8044b6:	55                   	push   %rbp
+  8044b7:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8044ba:	48 83 c7 40          	add    $0x40,%rdi
+  8044be:	be 01 00 00 00       	mov    $0x1,%esi
+  8044c3:	48 b8 a3 17 80 00 00 	movabs $0x8017a3,%rax
+  8044ca:	00 00 00 
+  8044cd:	ff d0                	call   *%rax
+}
+  8044cf:	5d                   	pop    %rbp
+  8044d0:	c3                   	ret
+
+00000000008044d1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8044d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d6:	c3                   	ret
+
+00000000008044d7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8044d7:	55                   	push   %rbp
+  8044d8:	48 89 e5             	mov    %rsp,%rbp
+  8044db:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8044de:	48 be 74 51 80 00 00 	movabs $0x805174,%rsi
+  8044e5:	00 00 00 
+  8044e8:	48 b8 b8 0e 80 00 00 	movabs $0x800eb8,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+    return 0;
+}
+  8044f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f9:	5d                   	pop    %rbp
+  8044fa:	c3                   	ret
+
+00000000008044fb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8044fb:	55                   	push   %rbp
+  8044fc:	48 89 e5             	mov    %rsp,%rbp
+  8044ff:	41 57                	push   %r15
+  804501:	41 56                	push   %r14
+  804503:	41 55                	push   %r13
+  804505:	41 54                	push   %r12
+  804507:	53                   	push   %rbx
+  804508:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80450f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804516:	48 85 d2             	test   %rdx,%rdx
+  804519:	74 7a                	je     804595 <devcons_write+0x9a>
+  80451b:	49 89 d6             	mov    %rdx,%r14
+  80451e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804524:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804529:	49 bf b2 10 80 00 00 	movabs $0x8010b2,%r15
+  804530:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804533:	4c 89 f3             	mov    %r14,%rbx
+  804536:	48 29 f3             	sub    %rsi,%rbx
+  804539:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80453e:	48 39 c3             	cmp    %rax,%rbx
+  804541:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804545:	4c 63 eb             	movslq %ebx,%r13
+  804548:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80454f:	48 01 c6             	add    %rax,%rsi
+  804552:	4c 89 ea             	mov    %r13,%rdx
+  804555:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80455c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80455f:	4c 89 ee             	mov    %r13,%rsi
+  804562:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804569:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804575:	41 01 dc             	add    %ebx,%r12d
+  804578:	49 63 f4             	movslq %r12d,%rsi
+  80457b:	4c 39 f6             	cmp    %r14,%rsi
+  80457e:	72 b3                	jb     804533 <devcons_write+0x38>
+    return res;
+  804580:	49 63 c4             	movslq %r12d,%rax
+}
+  804583:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80458a:	5b                   	pop    %rbx
+  80458b:	41 5c                	pop    %r12
+  80458d:	41 5d                	pop    %r13
+  80458f:	41 5e                	pop    %r14
+  804591:	41 5f                	pop    %r15
+  804593:	5d                   	pop    %rbp
+  804594:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804595:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80459b:	eb e3                	jmp    804580 <devcons_write+0x85>
+
+000000000080459d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80459d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8045a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a5:	48 85 c0             	test   %rax,%rax
+  8045a8:	74 55                	je     8045ff <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045aa:	55                   	push   %rbp
+  8045ab:	48 89 e5             	mov    %rsp,%rbp
+  8045ae:	41 55                	push   %r13
+  8045b0:	41 54                	push   %r12
+  8045b2:	53                   	push   %rbx
+  8045b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8045b7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8045ba:	48 bb fe 12 80 00 00 	movabs $0x8012fe,%rbx
+  8045c1:	00 00 00 
+  8045c4:	49 bc b3 13 80 00 00 	movabs $0x8013b3,%r12
+  8045cb:	00 00 00 
+  8045ce:	eb 03                	jmp    8045d3 <devcons_read+0x36>
+  8045d0:	41 ff d4             	call   *%r12
+  8045d3:	ff d3                	call   *%rbx
+  8045d5:	85 c0                	test   %eax,%eax
+  8045d7:	74 f7                	je     8045d0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8045d9:	48 63 d0             	movslq %eax,%rdx
+  8045dc:	78 13                	js     8045f1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8045de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045e3:	83 f8 04             	cmp    $0x4,%eax
+  8045e6:	74 09                	je     8045f1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8045e8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8045ec:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8045f1:	48 89 d0             	mov    %rdx,%rax
+  8045f4:	48 83 c4 08          	add    $0x8,%rsp
+  8045f8:	5b                   	pop    %rbx
+  8045f9:	41 5c                	pop    %r12
+  8045fb:	41 5d                	pop    %r13
+  8045fd:	5d                   	pop    %rbp
+  8045fe:	c3                   	ret
+  8045ff:	48 89 d0             	mov    %rdx,%rax
+  804602:	c3                   	ret
+
+0000000000804603 <cputchar>:
+cputchar(int ch) {
+  804603:	55                   	push   %rbp
+  804604:	48 89 e5             	mov    %rsp,%rbp
+  804607:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80460b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80460f:	be 01 00 00 00       	mov    $0x1,%esi
+  804614:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804618:	48 b8 df 12 80 00 00 	movabs $0x8012df,%rax
+  80461f:	00 00 00 
+  804622:	ff d0                	call   *%rax
+}
+  804624:	c9                   	leave
+  804625:	c3                   	ret
+
+0000000000804626 <getchar>:
+getchar(void) {
+  804626:	55                   	push   %rbp
+  804627:	48 89 e5             	mov    %rsp,%rbp
+  80462a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80462e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804633:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804637:	bf 00 00 00 00       	mov    $0x0,%edi
+  80463c:	48 b8 82 1d 80 00 00 	movabs $0x801d82,%rax
+  804643:	00 00 00 
+  804646:	ff d0                	call   *%rax
+  804648:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80464a:	85 c0                	test   %eax,%eax
+  80464c:	78 06                	js     804654 <getchar+0x2e>
+  80464e:	74 08                	je     804658 <getchar+0x32>
+  804650:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804654:	89 d0                	mov    %edx,%eax
+  804656:	c9                   	leave
+  804657:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804658:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80465d:	eb f5                	jmp    804654 <getchar+0x2e>
+
+000000000080465f <iscons>:
+iscons(int fdnum) {
+  80465f:	55                   	push   %rbp
+  804660:	48 89 e5             	mov    %rsp,%rbp
+  804663:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804667:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80466b:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804677:	85 c0                	test   %eax,%eax
+  804679:	78 18                	js     804693 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80467b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80467f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804686:	00 00 00 
+  804689:	8b 00                	mov    (%rax),%eax
+  80468b:	39 02                	cmp    %eax,(%rdx)
+  80468d:	0f 94 c0             	sete   %al
+  804690:	0f b6 c0             	movzbl %al,%eax
+}
+  804693:	c9                   	leave
+  804694:	c3                   	ret
+
+0000000000804695 <opencons>:
+opencons(void) {
+  804695:	55                   	push   %rbp
+  804696:	48 89 e5             	mov    %rsp,%rbp
+  804699:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80469d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8046a1:	48 b8 3f 1a 80 00 00 	movabs $0x801a3f,%rax
+  8046a8:	00 00 00 
+  8046ab:	ff d0                	call   *%rax
+  8046ad:	85 c0                	test   %eax,%eax
+  8046af:	78 49                	js     8046fa <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8046b1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8046b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046bb:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8046bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046c4:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  8046cb:	00 00 00 
+  8046ce:	ff d0                	call   *%rax
+  8046d0:	85 c0                	test   %eax,%eax
+  8046d2:	78 26                	js     8046fa <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8046d4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046d8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8046df:	00 00 
+  8046e1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8046e3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046e7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8046ee:	48 b8 11 1a 80 00 00 	movabs $0x801a11,%rax
+  8046f5:	00 00 00 
+  8046f8:	ff d0                	call   *%rax
+}
+  8046fa:	c9                   	leave
+  8046fb:	c3                   	ret
+
+00000000008046fc <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8046fc:	55                   	push   %rbp
+  8046fd:	48 89 e5             	mov    %rsp,%rbp
+  804700:	41 56                	push   %r14
+  804702:	41 55                	push   %r13
+  804704:	41 54                	push   %r12
+  804706:	53                   	push   %rbx
+  804707:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80470a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804711:	00 00 00 
+  804714:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804718:	74 27                	je     804741 <_handle_vectored_pagefault+0x45>
+  80471a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80471f:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804726:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804729:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80472c:	4c 89 e7             	mov    %r12,%rdi
+  80472f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804734:	84 c0                	test   %al,%al
+  804736:	75 45                	jne    80477d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804738:	48 83 c3 01          	add    $0x1,%rbx
+  80473c:	49 3b 1e             	cmp    (%r14),%rbx
+  80473f:	72 eb                	jb     80472c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804741:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804748:	00 
+  804749:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80474e:	4d 8b 04 24          	mov    (%r12),%r8
+  804752:	48 ba 80 51 80 00 00 	movabs $0x805180,%rdx
+  804759:	00 00 00 
+  80475c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804761:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  804768:	00 00 00 
+  80476b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804770:	49 ba 43 04 80 00 00 	movabs $0x800443,%r10
+  804777:	00 00 00 
+  80477a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80477d:	5b                   	pop    %rbx
+  80477e:	41 5c                	pop    %r12
+  804780:	41 5d                	pop    %r13
+  804782:	41 5e                	pop    %r14
+  804784:	5d                   	pop    %rbp
+  804785:	c3                   	ret
+
+0000000000804786 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804786:	55                   	push   %rbp
+  804787:	48 89 e5             	mov    %rsp,%rbp
+  80478a:	53                   	push   %rbx
+  80478b:	48 83 ec 08          	sub    $0x8,%rsp
+  80478f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804792:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804799:	00 00 00 
+  80479c:	80 38 00             	cmpb   $0x0,(%rax)
+  80479f:	0f 84 84 00 00 00    	je     804829 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047a5:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8047ac:	00 00 00 
+  8047af:	48 8b 10             	mov    (%rax),%rdx
+  8047b2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047b7:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8047be:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047c1:	48 85 d2             	test   %rdx,%rdx
+  8047c4:	74 19                	je     8047df <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047c6:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8047ca:	0f 84 e8 00 00 00    	je     8048b8 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047d0:	48 83 c0 01          	add    $0x1,%rax
+  8047d4:	48 39 d0             	cmp    %rdx,%rax
+  8047d7:	75 ed                	jne    8047c6 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8047d9:	48 83 fa 08          	cmp    $0x8,%rdx
+  8047dd:	74 1c                	je     8047fb <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047df:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047e3:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8047ea:	00 00 00 
+  8047ed:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8047f4:	00 00 00 
+  8047f7:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8047fb:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  804802:	00 00 00 
+  804805:	ff d0                	call   *%rax
+  804807:	89 c7                	mov    %eax,%edi
+  804809:	48 be 7e 49 80 00 00 	movabs $0x80497e,%rsi
+  804810:	00 00 00 
+  804813:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  80481a:	00 00 00 
+  80481d:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80481f:	85 c0                	test   %eax,%eax
+  804821:	78 68                	js     80488b <add_pgfault_handler+0x105>
+    return res;
+}
+  804823:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804827:	c9                   	leave
+  804828:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804829:	48 b8 8a 13 80 00 00 	movabs $0x80138a,%rax
+  804830:	00 00 00 
+  804833:	ff d0                	call   *%rax
+  804835:	89 c7                	mov    %eax,%edi
+  804837:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80483c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804841:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804848:	00 00 00 
+  80484b:	48 b8 17 14 80 00 00 	movabs $0x801417,%rax
+  804852:	00 00 00 
+  804855:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804857:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80485e:	00 00 00 
+  804861:	48 8b 02             	mov    (%rdx),%rax
+  804864:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804868:	48 89 0a             	mov    %rcx,(%rdx)
+  80486b:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804872:	00 00 00 
+  804875:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804879:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804880:	00 00 00 
+  804883:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804886:	e9 70 ff ff ff       	jmp    8047fb <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80488b:	89 c1                	mov    %eax,%ecx
+  80488d:	48 ba be 51 80 00 00 	movabs $0x8051be,%rdx
+  804894:	00 00 00 
+  804897:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80489c:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  8048a3:	00 00 00 
+  8048a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048ab:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  8048b2:	00 00 00 
+  8048b5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bd:	e9 61 ff ff ff       	jmp    804823 <add_pgfault_handler+0x9d>
+
+00000000008048c2 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8048c2:	55                   	push   %rbp
+  8048c3:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8048c6:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8048cd:	00 00 00 
+  8048d0:	80 38 00             	cmpb   $0x0,(%rax)
+  8048d3:	74 33                	je     804908 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048d5:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8048dc:	00 00 00 
+  8048df:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8048e4:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8048eb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048ee:	48 85 c0             	test   %rax,%rax
+  8048f1:	0f 84 85 00 00 00    	je     80497c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8048f7:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8048fb:	74 40                	je     80493d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048fd:	48 83 c1 01          	add    $0x1,%rcx
+  804901:	48 39 c1             	cmp    %rax,%rcx
+  804904:	75 f1                	jne    8048f7 <remove_pgfault_handler+0x35>
+  804906:	eb 74                	jmp    80497c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804908:	48 b9 d6 51 80 00 00 	movabs $0x8051d6,%rcx
+  80490f:	00 00 00 
+  804912:	48 ba 27 51 80 00 00 	movabs $0x805127,%rdx
+  804919:	00 00 00 
+  80491c:	be 43 00 00 00       	mov    $0x43,%esi
+  804921:	48 bf b0 51 80 00 00 	movabs $0x8051b0,%rdi
+  804928:	00 00 00 
+  80492b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804930:	49 b8 43 04 80 00 00 	movabs $0x800443,%r8
+  804937:	00 00 00 
+  80493a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80493d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804944:	00 
+  804945:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804949:	48 29 ca             	sub    %rcx,%rdx
+  80494c:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804953:	00 00 00 
+  804956:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80495a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80495f:	48 89 ce             	mov    %rcx,%rsi
+  804962:	48 b8 b2 10 80 00 00 	movabs $0x8010b2,%rax
+  804969:	00 00 00 
+  80496c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80496e:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804975:	00 00 00 
+  804978:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80497c:	5d                   	pop    %rbp
+  80497d:	c3                   	ret
+
+000000000080497e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80497e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804981:	48 b8 fc 46 80 00 00 	movabs $0x8046fc,%rax
+  804988:	00 00 00 
+    call *%rax
+  80498b:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80498d:	41 5f                	pop    %r15
+	popq %r15
+  80498f:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804991:	41 5f                	pop    %r15
+	popq %r14
+  804993:	41 5e                	pop    %r14
+	popq %r13
+  804995:	41 5d                	pop    %r13
+	popq %r12
+  804997:	41 5c                	pop    %r12
+	popq %r11
+  804999:	41 5b                	pop    %r11
+	popq %r10
+  80499b:	41 5a                	pop    %r10
+	popq %r9
+  80499d:	41 59                	pop    %r9
+	popq %r8
+  80499f:	41 58                	pop    %r8
+	popq %rsi
+  8049a1:	5e                   	pop    %rsi
+	popq %rdi
+  8049a2:	5f                   	pop    %rdi
+	popq %rbp
+  8049a3:	5d                   	pop    %rbp
+	popq %rdx
+  8049a4:	5a                   	pop    %rdx
+	popq %rcx
+  8049a5:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8049a6:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8049ab:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8049b0:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8049b4:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8049b7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8049bc:	5b                   	pop    %rbx
+	popq %rax
+  8049bd:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8049be:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8049c2:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8049c3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8049c8:	c3                   	ret
+  8049c9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008049d0 <__rodata_start>:
+  8049d0:	72 65                	jb     804a37 <__rodata_start+0x67>
+  8049d2:	6d                   	insl   (%dx),%es:(%rdi)
+  8049d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049d4:	76 65                	jbe    804a3b <__rodata_start+0x6b>
+  8049d6:	00 63 72             	add    %ah,0x72(%rbx)
+  8049d9:	65 61                	gs (bad)
+  8049db:	74 65                	je     804a42 <__rodata_start+0x72>
+  8049dd:	00 6e 6f             	add    %ch,0x6f(%rsi)
+  8049e0:	20 66 69             	and    %ah,0x69(%rsi)
+  8049e3:	6c                   	insb   (%dx),%es:(%rdi)
+  8049e4:	65 20 73 65          	and    %dh,%gs:0x65(%rbx)
+  8049e8:	72 76                	jb     804a60 <__rodata_start+0x90>
+  8049ea:	65 72 00             	gs jb  8049ed <__rodata_start+0x1d>
+  8049ed:	75 73                	jne    804a62 <__rodata_start+0x92>
+  8049ef:	65 72 2f             	gs jb  804a21 <__rodata_start+0x51>
+  8049f2:	64 69 72 62 65 6e 63 	imul   $0x68636e65,%fs:0x62(%rdx),%esi
+  8049f9:	68 
+  8049fa:	2e 63 00             	cs movsxd (%rax),%eax
+  8049fd:	63 61 63             	movsxd 0x63(%rcx),%esp
+  804a00:	68 65 5f 73 74       	push   $0x74735f65
+  804a05:	61                   	(bad)
+  804a06:	74 3a                	je     804a42 <__rodata_start+0x72>
+  804a08:	20 25 69 00 2f 64    	and    %ah,0x642f0069(%rip)        # 64af4a77 <__bss_end+0x642b2a77>
+  804a0e:	69 72 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdx),%esi
+  804a15:	25 30 35 64 00       	and    $0x643530,%eax
+  804a1a:	72 65                	jb     804a81 <__rodata_start+0xb1>
+  804a1c:	6d                   	insl   (%dx),%es:(%rdi)
+  804a1d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a1e:	76 65                	jbe    804a85 <__rodata_start+0xb5>
+  804a20:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a08499 <__bss_end+0x251c6499>
+  804a26:	69 00 6f 70 65 6e    	imul   $0x6e65706f,(%rax),%eax
+  804a2c:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a084a5 <__bss_end+0x251c64a5>
+  804a32:	69 00 0f 1f 40 00    	imul   $0x401f0f,(%rax),%eax
+  804a38:	64 69 72 62 65 6e 63 	imul   $0x68636e65,%fs:0x62(%rdx),%esi
+  804a3f:	68 
+  804a40:	3a 20                	cmp    (%rax),%ah
+  804a42:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  804a47:	6c                   	insb   (%dx),%es:(%rdi)
+  804a48:	75 20                	jne    804a6a <__rodata_start+0x9a>
+  804a4a:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804a4d:	6c                   	insb   (%dx),%es:(%rdi)
+  804a4e:	65 73 20             	gs jae 804a71 <__rodata_start+0xa1>
+  804a51:	70 65                	jo     804ab8 <__rodata_start+0xe8>
+  804a53:	72 20                	jb     804a75 <__rodata_start+0xa5>
+  804a55:	66 69 6c 65 2c 20 66 	imul   $0x6620,0x2c(%rbp,%riz,2),%bp
+  804a5c:	69 6c 65 20 73 65 72 	imul   $0x76726573,0x20(%rbp,%riz,2),%ebp
+  804a63:	76 
+  804a64:	65 72 20             	gs jb  804a87 <__rodata_start+0xb7>
+  804a67:	25 6c 75 2c 20       	and    $0x202c756c,%eax
+  804a6c:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  804a71:	6c                   	insb   (%dx),%es:(%rdi)
+  804a72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a73:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a76:	6c                   	insb   (%dx),%es:(%rdi)
+  804a77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a78:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a79:	6b 75 70 73          	imul   $0x73,0x70(%rbp),%esi
+  804a7d:	20 70 65             	and    %dh,0x65(%rax)
+  804a80:	72 20                	jb     804aa2 <__rodata_start+0xd2>
+  804a82:	66 69 6c 65 0a 00 3c 	imul   $0x3c00,0xa(%rbp,%riz,2),%bp
+  804a89:	75 6e                	jne    804af9 <__rodata_start+0x129>
+  804a8b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804a8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a90:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  804a94:	1f                   	(bad)
+  804a95:	44 00 00             	add    %r8b,(%rax)
+  804a98:	5b                   	pop    %rbx
+  804a99:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804a9e:	20 75 73             	and    %dh,0x73(%rbp)
+  804aa1:	65 72 20             	gs jb  804ac4 <__rodata_start+0xf4>
+  804aa4:	70 61                	jo     804b07 <__rodata_start+0x137>
+  804aa6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aa7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804aae:	73 20                	jae    804ad0 <__rodata_start+0x100>
+  804ab0:	61                   	(bad)
+  804ab1:	74 20                	je     804ad3 <__rodata_start+0x103>
+  804ab3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804ab8:	3a 20                	cmp    (%rax),%ah
+  804aba:	00 30                	add    %dh,(%rax)
+  804abc:	31 32                	xor    %esi,(%rdx)
+  804abe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ac5:	41                   	rex.B
+  804ac6:	42                   	rex.X
+  804ac7:	43                   	rex.XB
+  804ac8:	44                   	rex.R
+  804ac9:	45                   	rex.RB
+  804aca:	46 00 30             	rex.RX add %r14b,(%rax)
+  804acd:	31 32                	xor    %esi,(%rdx)
+  804acf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ad6:	61                   	(bad)
+  804ad7:	62 63 64 65 66       	(bad)
+  804adc:	00 28                	add    %ch,(%rax)
+  804ade:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804adf:	75 6c                	jne    804b4d <__rodata_start+0x17d>
+  804ae1:	6c                   	insb   (%dx),%es:(%rdi)
+  804ae2:	29 00                	sub    %eax,(%rax)
+  804ae4:	65 72 72             	gs jb  804b59 <__rodata_start+0x189>
+  804ae7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ae8:	72 20                	jb     804b0a <__rodata_start+0x13a>
+  804aea:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804aef:	73 70                	jae    804b61 <__rodata_start+0x191>
+  804af1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804af5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804afc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804afd:	72 00                	jb     804aff <__rodata_start+0x12f>
+  804aff:	62 61 64 20 65       	(bad)
+  804b04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b05:	76 69                	jbe    804b70 <__rodata_start+0x1a0>
+  804b07:	72 6f                	jb     804b78 <__rodata_start+0x1a8>
+  804b09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b0a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b0b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b0d:	74 00                	je     804b0f <__rodata_start+0x13f>
+  804b0f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b16:	20 70 61             	and    %dh,0x61(%rax)
+  804b19:	72 61                	jb     804b7c <__rodata_start+0x1ac>
+  804b1b:	6d                   	insl   (%dx),%es:(%rdi)
+  804b1c:	65 74 65             	gs je  804b84 <__rodata_start+0x1b4>
+  804b1f:	72 00                	jb     804b21 <__rodata_start+0x151>
+  804b21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b22:	75 74                	jne    804b98 <__rodata_start+0x1c8>
+  804b24:	20 6f 66             	and    %ch,0x66(%rdi)
+  804b27:	20 6d 65             	and    %ch,0x65(%rbp)
+  804b2a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b2c:	72 79                	jb     804ba7 <__rodata_start+0x1d7>
+  804b2e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804b31:	74 20                	je     804b53 <__rodata_start+0x183>
+  804b33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b34:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804b38:	76 69                	jbe    804ba3 <__rodata_start+0x1d3>
+  804b3a:	72 6f                	jb     804bab <__rodata_start+0x1db>
+  804b3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b3d:	6d                   	insl   (%dx),%es:(%rdi)
+  804b3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b40:	74 73                	je     804bb5 <__rodata_start+0x1e5>
+  804b42:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804b45:	72 72                	jb     804bb9 <__rodata_start+0x1e9>
+  804b47:	75 70                	jne    804bb9 <__rodata_start+0x1e9>
+  804b49:	74 65                	je     804bb0 <__rodata_start+0x1e0>
+  804b4b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804b50:	75 67                	jne    804bb9 <__rodata_start+0x1e9>
+  804b52:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804b55:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b57:	00 73 65             	add    %dh,0x65(%rbx)
+  804b5a:	67 6d                	insl   (%dx),%es:(%edi)
+  804b5c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b5e:	74 61                	je     804bc1 <__rodata_start+0x1f1>
+  804b60:	74 69                	je     804bcb <__rodata_start+0x1fb>
+  804b62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b64:	20 66 61             	and    %ah,0x61(%rsi)
+  804b67:	75 6c                	jne    804bd5 <__rodata_start+0x205>
+  804b69:	74 00                	je     804b6b <__rodata_start+0x19b>
+  804b6b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b72:	20 45 4c             	and    %al,0x4c(%rbp)
+  804b75:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804b79:	61                   	(bad)
+  804b7a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804b7f:	20 73 75             	and    %dh,0x75(%rbx)
+  804b82:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804b85:	73 79                	jae    804c00 <__rodata_start+0x230>
+  804b87:	73 74                	jae    804bfd <__rodata_start+0x22d>
+  804b89:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b8b:	20 63 61             	and    %ah,0x61(%rbx)
+  804b8e:	6c                   	insb   (%dx),%es:(%rdi)
+  804b8f:	6c                   	insb   (%dx),%es:(%rdi)
+  804b90:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804b93:	74 72                	je     804c07 <__rodata_start+0x237>
+  804b95:	79 20                	jns    804bb7 <__rodata_start+0x1e7>
+  804b97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b99:	74 20                	je     804bbb <__rodata_start+0x1eb>
+  804b9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b9d:	75 6e                	jne    804c0d <__rodata_start+0x23d>
+  804b9f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804ba3:	76 20                	jbe    804bc5 <__rodata_start+0x1f5>
+  804ba5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804bac:	72 65                	jb     804c13 <__rodata_start+0x243>
+  804bae:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804bb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bb2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804bb6:	65 78 70             	gs js  804c29 <__rodata_start+0x259>
+  804bb9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804bbe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804bc1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804bc5:	20 66 69             	and    %ah,0x69(%rsi)
+  804bc8:	6c                   	insb   (%dx),%es:(%rdi)
+  804bc9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804bcd:	20 66 72             	and    %ah,0x72(%rsi)
+  804bd0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804bd5:	61                   	(bad)
+  804bd6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804bd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bdb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804bdf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804be2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be4:	20 6d 61             	and    %ch,0x61(%rbp)
+  804be7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804be8:	79 20                	jns    804c0a <__rodata_start+0x23a>
+  804bea:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804bf1:	72 65                	jb     804c58 <__rodata_start+0x288>
+  804bf3:	20 6f 70             	and    %ch,0x70(%rdi)
+  804bf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bf8:	00 66 69             	add    %ah,0x69(%rsi)
+  804bfb:	6c                   	insb   (%dx),%es:(%rdi)
+  804bfc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804c00:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804c03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c04:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804c07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c09:	74 20                	je     804c2b <__rodata_start+0x25b>
+  804c0b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c0d:	75 6e                	jne    804c7d <__rodata_start+0x2ad>
+  804c0f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804c13:	76 61                	jbe    804c76 <__rodata_start+0x2a6>
+  804c15:	6c                   	insb   (%dx),%es:(%rdi)
+  804c16:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804c1d:	00 
+  804c1e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804c25:	72 65                	jb     804c8c <__rodata_start+0x2bc>
+  804c27:	61                   	(bad)
+  804c28:	64 79 20             	fs jns 804c4b <__rodata_start+0x27b>
+  804c2b:	65 78 69             	gs js  804c97 <__rodata_start+0x2c7>
+  804c2e:	73 74                	jae    804ca4 <__rodata_start+0x2d4>
+  804c30:	73 00                	jae    804c32 <__rodata_start+0x262>
+  804c32:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c33:	70 65                	jo     804c9a <__rodata_start+0x2ca>
+  804c35:	72 61                	jb     804c98 <__rodata_start+0x2c8>
+  804c37:	74 69                	je     804ca2 <__rodata_start+0x2d2>
+  804c39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c3b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804c3e:	74 20                	je     804c60 <__rodata_start+0x290>
+  804c40:	73 75                	jae    804cb7 <__rodata_start+0x2e7>
+  804c42:	70 70                	jo     804cb4 <__rodata_start+0x2e4>
+  804c44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c45:	72 74                	jb     804cbb <__rodata_start+0x2eb>
+  804c47:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804c4d:	20 61 67             	and    %ah,0x67(%rcx)
+  804c50:	61                   	(bad)
+  804c51:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804c58:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804c5c:	74 00                	je     804c5e <__rodata_start+0x28e>
+  804c5e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804c65:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c68:	20 75 73             	and    %dh,0x73(%rbp)
+  804c6b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804c6f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804c76:	00 
+  804c77:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804c7e:	00 00 
+  804c80:	80 07 80             	addb   $0x80,(%rdi)
+  804c83:	00 00                	add    %al,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 c1                	add    %al,%cl
+  804c89:	0d 80 00 00 00       	or     $0x80,%eax
+  804c8e:	00 00                	add    %al,(%rax)
+  804c90:	b1 0d                	mov    $0xd,%cl
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 c1                	add    %al,%cl
+  804c99:	0d 80 00 00 00       	or     $0x80,%eax
+  804c9e:	00 00                	add    %al,(%rax)
+  804ca0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804d27 <__rodata_start+0x357>
+  804ca7:	00 c1                	add    %al,%cl
+  804ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cae:	00 00                	add    %al,(%rax)
+  804cb0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804d37 <__rodata_start+0x367>
+  804cb7:	00 9f 07 80 00 00    	add    %bl,0x8007(%rdi)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 c1                	add    %al,%cl
+  804cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  804cc6:	00 00                	add    %al,(%rax)
+  804cc8:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804d4f <__rodata_start+0x37f>
+  804ccf:	00 93 07 80 00 00    	add    %dl,0x8007(%rbx)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 0d 08 80 00 00    	add    %cl,0x8008(%rip)        # 80cce5 <__ctors_end+0x6c05>
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 c1                	add    %al,%cl
+  804ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ce6:	00 00                	add    %al,(%rax)
+  804ce8:	93                   	xchg   %eax,%ebx
+  804ce9:	07                   	(bad)
+  804cea:	80 00 00             	addb   $0x0,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 d9                	add    %bl,%cl
+  804cf1:	07                   	(bad)
+  804cf2:	80 00 00             	addb   $0x0,(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 d9                	add    %bl,%cl
+  804cf9:	07                   	(bad)
+  804cfa:	80 00 00             	addb   $0x0,(%rax)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 d9                	add    %bl,%cl
+  804d01:	07                   	(bad)
+  804d02:	80 00 00             	addb   $0x0,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 d9                	add    %bl,%cl
+  804d09:	07                   	(bad)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 d9                	add    %bl,%cl
+  804d11:	07                   	(bad)
+  804d12:	80 00 00             	addb   $0x0,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 d9                	add    %bl,%cl
+  804d19:	07                   	(bad)
+  804d1a:	80 00 00             	addb   $0x0,(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 d9                	add    %bl,%cl
+  804d21:	07                   	(bad)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 d9                	add    %bl,%cl
+  804d29:	07                   	(bad)
+  804d2a:	80 00 00             	addb   $0x0,(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 d9                	add    %bl,%cl
+  804d31:	07                   	(bad)
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 c1                	add    %al,%cl
+  804d39:	0d 80 00 00 00       	or     $0x80,%eax
+  804d3e:	00 00                	add    %al,(%rax)
+  804d40:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804dc7 <__rodata_start+0x3f7>
+  804d47:	00 c1                	add    %al,%cl
+  804d49:	0d 80 00 00 00       	or     $0x80,%eax
+  804d4e:	00 00                	add    %al,(%rax)
+  804d50:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804dd7 <__rodata_start+0x407>
+  804d57:	00 c1                	add    %al,%cl
+  804d59:	0d 80 00 00 00       	or     $0x80,%eax
+  804d5e:	00 00                	add    %al,(%rax)
+  804d60:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804de7 <__rodata_start+0x417>
+  804d67:	00 c1                	add    %al,%cl
+  804d69:	0d 80 00 00 00       	or     $0x80,%eax
+  804d6e:	00 00                	add    %al,(%rax)
+  804d70:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804df7 <__rodata_start+0x427>
+  804d77:	00 c1                	add    %al,%cl
+  804d79:	0d 80 00 00 00       	or     $0x80,%eax
+  804d7e:	00 00                	add    %al,(%rax)
+  804d80:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e07 <__rodata_start+0x437>
+  804d87:	00 c1                	add    %al,%cl
+  804d89:	0d 80 00 00 00       	or     $0x80,%eax
+  804d8e:	00 00                	add    %al,(%rax)
+  804d90:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e17 <__rodata_start+0x447>
+  804d97:	00 c1                	add    %al,%cl
+  804d99:	0d 80 00 00 00       	or     $0x80,%eax
+  804d9e:	00 00                	add    %al,(%rax)
+  804da0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e27 <__rodata_start+0x457>
+  804da7:	00 c1                	add    %al,%cl
+  804da9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dae:	00 00                	add    %al,(%rax)
+  804db0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e37 <__rodata_start+0x467>
+  804db7:	00 c1                	add    %al,%cl
+  804db9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dbe:	00 00                	add    %al,(%rax)
+  804dc0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e47 <__rodata_start+0x477>
+  804dc7:	00 c1                	add    %al,%cl
+  804dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dce:	00 00                	add    %al,(%rax)
+  804dd0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e57 <__rodata_start+0x487>
+  804dd7:	00 c1                	add    %al,%cl
+  804dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dde:	00 00                	add    %al,(%rax)
+  804de0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e67 <__rodata_start+0x497>
+  804de7:	00 c1                	add    %al,%cl
+  804de9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dee:	00 00                	add    %al,(%rax)
+  804df0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e77 <__rodata_start+0x4a7>
+  804df7:	00 c1                	add    %al,%cl
+  804df9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dfe:	00 00                	add    %al,(%rax)
+  804e00:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e87 <__rodata_start+0x4b7>
+  804e07:	00 c1                	add    %al,%cl
+  804e09:	0d 80 00 00 00       	or     $0x80,%eax
+  804e0e:	00 00                	add    %al,(%rax)
+  804e10:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804e97 <__rodata_start+0x4c7>
+  804e17:	00 c1                	add    %al,%cl
+  804e19:	0d 80 00 00 00       	or     $0x80,%eax
+  804e1e:	00 00                	add    %al,(%rax)
+  804e20:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804ea7 <__rodata_start+0x4d7>
+  804e27:	00 e4                	add    %ah,%ah
+  804e29:	0c 80                	or     $0x80,%al
+  804e2b:	00 00                	add    %al,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 c1                	add    %al,%cl
+  804e31:	0d 80 00 00 00       	or     $0x80,%eax
+  804e36:	00 00                	add    %al,(%rax)
+  804e38:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804ebf <__rodata_start+0x4ef>
+  804e3f:	00 c1                	add    %al,%cl
+  804e41:	0d 80 00 00 00       	or     $0x80,%eax
+  804e46:	00 00                	add    %al,(%rax)
+  804e48:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804ecf <__rodata_start+0x4ff>
+  804e4f:	00 c1                	add    %al,%cl
+  804e51:	0d 80 00 00 00       	or     $0x80,%eax
+  804e56:	00 00                	add    %al,(%rax)
+  804e58:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804edf <__rodata_start+0x50f>
+  804e5f:	00 c1                	add    %al,%cl
+  804e61:	0d 80 00 00 00       	or     $0x80,%eax
+  804e66:	00 00                	add    %al,(%rax)
+  804e68:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804eef <__rodata_start+0x51f>
+  804e6f:	00 c1                	add    %al,%cl
+  804e71:	0d 80 00 00 00       	or     $0x80,%eax
+  804e76:	00 00                	add    %al,(%rax)
+  804e78:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804eff <__rodata_start+0x52f>
+  804e7f:	00 30                	add    %dh,(%rax)
+  804e81:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804e87:	00 ff                	add    %bh,%bh
+  804e89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804e8f:	00 c1                	add    %al,%cl
+  804e91:	0d 80 00 00 00       	or     $0x80,%eax
+  804e96:	00 00                	add    %al,(%rax)
+  804e98:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804f1f <__rodata_start+0x54f>
+  804e9f:	00 c1                	add    %al,%cl
+  804ea1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ea6:	00 00                	add    %al,(%rax)
+  804ea8:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804f2f <__rodata_start+0x55f>
+  804eaf:	00 5f 08             	add    %bl,0x8(%rdi)
+  804eb2:	80 00 00             	addb   $0x0,(%rax)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 c1                	add    %al,%cl
+  804eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  804ebe:	00 00                	add    %al,(%rax)
+  804ec0:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804f47 <error_string+0x7>
+  804ec7:	00 25 08 80 00 00    	add    %ah,0x8008(%rip)        # 80ced5 <__ctors_end+0x6df5>
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 c1                	add    %al,%cl
+  804ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ed6:	00 00                	add    %al,(%rax)
+  804ed8:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804f5f <error_string+0x1f>
+  804edf:	00 a7 0b 80 00 00    	add    %ah,0x800b(%rdi)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 71 0c             	add    %dh,0xc(%rcx)
+  804eea:	80 00 00             	addb   $0x0,(%rax)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 c1                	add    %al,%cl
+  804ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ef6:	00 00                	add    %al,(%rax)
+  804ef8:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804f7f <error_string+0x3f>
+  804eff:	00 f6                	add    %dh,%dh
+  804f01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804f07:	00 c1                	add    %al,%cl
+  804f09:	0d 80 00 00 00       	or     $0x80,%eax
+  804f0e:	00 00                	add    %al,(%rax)
+  804f10:	d3 0a                	rorl   %cl,(%rdx)
+  804f12:	80 00 00             	addb   $0x0,(%rax)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 c1                	add    %al,%cl
+  804f19:	0d 80 00 00 00       	or     $0x80,%eax
+  804f1e:	00 00                	add    %al,(%rax)
+  804f20:	c1 0d 80 00 00 00 00 	rorl   $0x0,0x80(%rip)        # 804fa7 <error_string+0x67>
+  804f27:	00 e4                	add    %ah,%ah
+  804f29:	0c 80                	or     $0x80,%al
+  804f2b:	00 00                	add    %al,(%rax)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 c1                	add    %al,%cl
+  804f31:	0d 80 00 00 00       	or     $0x80,%eax
+  804f36:	00 00                	add    %al,(%rax)
+  804f38:	89 07                	mov    %eax,(%rdi)
+  804f3a:	80 00 00             	addb   $0x0,(%rax)
+  804f3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804f40 <error_string>:
+	...
+  804f48:	ed 4a 80 00 00 00 00 00 ff 4a 80 00 00 00 00 00     .J.......J......
+  804f58:	0f 4b 80 00 00 00 00 00 21 4b 80 00 00 00 00 00     .K......!K......
+  804f68:	2f 4b 80 00 00 00 00 00 43 4b 80 00 00 00 00 00     /K......CK......
+  804f78:	58 4b 80 00 00 00 00 00 6b 4b 80 00 00 00 00 00     XK......kK......
+  804f88:	7d 4b 80 00 00 00 00 00 91 4b 80 00 00 00 00 00     }K.......K......
+  804f98:	a1 4b 80 00 00 00 00 00 b4 4b 80 00 00 00 00 00     .K.......K......
+  804fa8:	cb 4b 80 00 00 00 00 00 e1 4b 80 00 00 00 00 00     .K.......K......
+  804fb8:	f9 4b 80 00 00 00 00 00 11 4c 80 00 00 00 00 00     .K.......L......
+  804fc8:	1e 4c 80 00 00 00 00 00 f8 4f 80 00 00 00 00 00     .L.......O......
+  804fd8:	32 4c 80 00 00 00 00 00 4a 4c 80 00 00 00 00 00     2L......JL......
+  804fe8:	54 4c 80 00 00 00 00 00 5e 4c 80 00 00 00 00 00     TL......^L......
+  804ff8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805008:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805018:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805028:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805038:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  805048:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  805058:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  805068:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805078:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805088:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805098:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8050a8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8050b8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8050c8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8050d8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8050e8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050f8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805100 <devtab>:
+  805100:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805110:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805120:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805130:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805140:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805150:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805160:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805170:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805180:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805190:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8051a0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8051b0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8051c0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8051d0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8051e0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8051f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805200:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805210:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805220:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805230:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805240:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805250:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805260:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805270:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805280:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805290:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,8992 @@
+
+obj/user/diskbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 07 00 00       	call   800731 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+static char buf[FSIPC_DATA_SIZE];
+
+#define WRITE_SIZE (512 * 1024)
+
+static void
+bench(const char *name, const volatile struct Env *fs) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 68          	sub    $0x68,%rsp
+  800036:	48 89 7d 88          	mov    %rdi,-0x78(%rbp)
+  80003a:	49 89 f7             	mov    %rsi,%r15
+    int fd, res;
+    size_t total = 0;
+    struct DiskStat st0, st1;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  80003d:	be 00 00 00 00       	mov    $0x0,%esi
+  800042:	48 bf 90 4d 80 00 00 	movabs $0x804d90,%rdi
+  800049:	00 00 00 
+  80004c:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+  800058:	41 89 c4             	mov    %eax,%r12d
+  80005b:	85 c0                	test   %eax,%eax
+  80005d:	78 48                	js     8000a7 <bench+0x82>
+
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80005f:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  800063:	48 b8 25 39 80 00 00 	movabs $0x803925,%rax
+  80006a:	00 00 00 
+  80006d:	ff d0                	call   *%rax
+  80006f:	85 c0                	test   %eax,%eax
+  800071:	78 61                	js     8000d4 <bench+0xaf>
+    uint64_t fs_start = fs->env_cycles;
+  800073:	49 8b 87 d0 01 00 00 	mov    0x1d0(%r15),%rax
+  80007a:	48 89 45 80          	mov    %rax,-0x80(%rbp)
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80007e:	0f 31                	rdtsc
+  800080:	89 95 70 ff ff ff    	mov    %edx,-0x90(%rbp)
+  800086:	89 85 7c ff ff ff    	mov    %eax,-0x84(%rbp)
+    size_t total = 0;
+  80008c:	bb 00 00 00 00       	mov    $0x0,%ebx
+    uint64_t start = read_tsc();
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  800091:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  800098:	00 00 00 
+  80009b:	49 bd 46 21 80 00 00 	movabs $0x802146,%r13
+  8000a2:	00 00 00 
+  8000a5:	eb 60                	jmp    800107 <bench+0xe2>
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  8000a7:	89 c1                	mov    %eax,%ecx
+  8000a9:	48 ba 99 4d 80 00 00 	movabs $0x804d99,%rdx
+  8000b0:	00 00 00 
+  8000b3:	be 14 00 00 00       	mov    $0x14,%esi
+  8000b8:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8000bf:	00 00 00 
+  8000c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c7:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8000ce:	00 00 00 
+  8000d1:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  8000d4:	89 c1                	mov    %eax,%ecx
+  8000d6:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  8000dd:	00 00 00 
+  8000e0:	be 16 00 00 00       	mov    $0x16,%esi
+  8000e5:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8000ec:	00 00 00 
+  8000ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f4:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8000fb:	00 00 00 
+  8000fe:	41 ff d0             	call   *%r8
+        total += res;
+  800101:	48 63 c9             	movslq %ecx,%rcx
+  800104:	48 01 cb             	add    %rcx,%rbx
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  800107:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80010c:	4c 89 f6             	mov    %r14,%rsi
+  80010f:	44 89 e7             	mov    %r12d,%edi
+  800112:	41 ff d5             	call   *%r13
+  800115:	48 89 c1             	mov    %rax,%rcx
+  800118:	85 c0                	test   %eax,%eax
+  80011a:	7f e5                	jg     800101 <bench+0xdc>
+  80011c:	0f 31                	rdtsc
+  80011e:	41 89 d6             	mov    %edx,%r14d
+  800121:	89 85 78 ff ff ff    	mov    %eax,-0x88(%rbp)
+    uint64_t cycles = read_tsc() - start;
+    uint64_t fs_cycles = fs->env_cycles - fs_start;
+  800127:	4d 8b af d0 01 00 00 	mov    0x1d0(%r15),%r13
+
+    if (res < 0) panic("read /bigfile: %i", res);
+  80012e:	85 c9                	test   %ecx,%ecx
+  800130:	0f 88 0a 01 00 00    	js     800240 <bench+0x21b>
+    close(fd);
+  800136:	44 89 e7             	mov    %r12d,%edi
+  800139:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  800140:	00 00 00 
+  800143:	ff d0                	call   *%rax
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  800145:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+  800149:	48 b8 25 39 80 00 00 	movabs $0x803925,%rax
+  800150:	00 00 00 
+  800153:	ff d0                	call   *%rax
+  800155:	85 c0                	test   %eax,%eax
+  800157:	0f 88 0e 01 00 00    	js     80026b <bench+0x246>
+
+    uint64_t khz = vsys[VSYS_tsc_khz];
+  80015d:	a1 44 f0 bf 1f 80 00 	movabs 0x801fbff044,%eax
+  800164:	00 00 
+  800166:	48 63 c8             	movslq %eax,%rcx
+    size_t nblocks = total / BLKSIZE;
+    cprintf("diskbench: %s: %lu KB, %lu MB/s, file server %lu cycles per block\n",
+  800169:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016f:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  800176:	76 1c                	jbe    800194 <bench+0x16f>
+    uint64_t fs_cycles = fs->env_cycles - fs_start;
+  800178:	4c 89 e8             	mov    %r13,%rax
+  80017b:	48 8b 75 80          	mov    -0x80(%rbp),%rsi
+  80017f:	48 29 f0             	sub    %rsi,%rax
+    size_t nblocks = total / BLKSIZE;
+  800182:	48 89 de             	mov    %rbx,%rsi
+  800185:	48 c1 ee 0c          	shr    $0xc,%rsi
+    cprintf("diskbench: %s: %lu KB, %lu MB/s, file server %lu cycles per block\n",
+  800189:	ba 00 00 00 00       	mov    $0x0,%edx
+  80018e:	48 f7 f6             	div    %rsi
+  800191:	49 89 c0             	mov    %rax,%r8
+  800194:	48 85 c9             	test   %rcx,%rcx
+  800197:	74 4b                	je     8001e4 <bench+0x1bf>
+            name, (unsigned long)(total / 1024),
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+  800199:	48 89 c8             	mov    %rcx,%rax
+  80019c:	48 0f af c3          	imul   %rbx,%rax
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8001a0:	49 c1 e6 20          	shl    $0x20,%r14
+  8001a4:	8b 95 78 ff ff ff    	mov    -0x88(%rbp),%edx
+  8001aa:	49 09 d6             	or     %rdx,%r14
+  8001ad:	48 8b 95 70 ff ff ff 	mov    -0x90(%rbp),%rdx
+  8001b4:	48 c1 e2 20          	shl    $0x20,%rdx
+  8001b8:	8b 8d 7c ff ff ff    	mov    -0x84(%rbp),%ecx
+  8001be:	48 09 ca             	or     %rcx,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8001c1:	49 29 d6             	sub    %rdx,%r14
+            (unsigned long)(khz ? total * khz / cycles / 1000 : 0),
+  8001c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c9:	49 f7 f6             	div    %r14
+    cprintf("diskbench: %s: %lu KB, %lu MB/s, file server %lu cycles per block\n",
+  8001cc:	48 c1 e8 03          	shr    $0x3,%rax
+  8001d0:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  8001d7:	9b c4 20 
+  8001da:	48 f7 e2             	mul    %rdx
+  8001dd:	48 c1 ea 04          	shr    $0x4,%rdx
+  8001e1:	48 89 d1             	mov    %rdx,%rcx
+            name, (unsigned long)(total / 1024),
+  8001e4:	48 c1 eb 0a          	shr    $0xa,%rbx
+  8001e8:	48 89 da             	mov    %rbx,%rdx
+    cprintf("diskbench: %s: %lu KB, %lu MB/s, file server %lu cycles per block\n",
+  8001eb:	4c 8b 7d 88          	mov    -0x78(%rbp),%r15
+  8001ef:	4c 89 fe             	mov    %r15,%rsi
+  8001f2:	48 bf 50 4e 80 00 00 	movabs $0x804e50,%rdi
+  8001f9:	00 00 00 
+  8001fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800201:	48 bb 57 09 80 00 00 	movabs $0x800957,%rbx
+  800208:	00 00 00 
+  80020b:	ff d3                	call   *%rbx
+            (unsigned long)(nblocks ? fs_cycles / nblocks : 0));
+    cprintf("diskbench: %s: %lu read commands for %lu blocks\n", name,
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+            (unsigned long)(st1.ds_read_blocks - st0.ds_read_blocks));
+  80020d:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800211:	48 2b 4d b8          	sub    -0x48(%rbp),%rcx
+            (unsigned long)(st1.ds_reads - st0.ds_reads),
+  800215:	48 8b 55 90          	mov    -0x70(%rbp),%rdx
+  800219:	48 2b 55 b0          	sub    -0x50(%rbp),%rdx
+    cprintf("diskbench: %s: %lu read commands for %lu blocks\n", name,
+  80021d:	4c 89 fe             	mov    %r15,%rsi
+  800220:	48 bf 98 4e 80 00 00 	movabs $0x804e98,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	ff d3                	call   *%rbx
+}
+  800231:	48 83 c4 68          	add    $0x68,%rsp
+  800235:	5b                   	pop    %rbx
+  800236:	41 5c                	pop    %r12
+  800238:	41 5d                	pop    %r13
+  80023a:	41 5e                	pop    %r14
+  80023c:	41 5f                	pop    %r15
+  80023e:	5d                   	pop    %rbp
+  80023f:	c3                   	ret
+    if (res < 0) panic("read /bigfile: %i", res);
+  800240:	48 ba ca 4d 80 00 00 	movabs $0x804dca,%rdx
+  800247:	00 00 00 
+  80024a:	be 1e 00 00 00       	mov    $0x1e,%esi
+  80024f:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  800256:	00 00 00 
+  800259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025e:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800265:	00 00 00 
+  800268:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  80026b:	89 c1                	mov    %eax,%ecx
+  80026d:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  800274:	00 00 00 
+  800277:	be 20 00 00 00       	mov    $0x20,%esi
+  80027c:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  800283:	00 00 00 
+  800286:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028b:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800292:	00 00 00 
+  800295:	41 ff d0             	call   *%r8
+
+0000000000800298 <umain>:
+                (unsigned long)(st1.ds_write_blocks - st0.ds_write_blocks));
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800298:	55                   	push   %rbp
+  800299:	48 89 e5             	mov    %rsp,%rbp
+  80029c:	41 57                	push   %r15
+  80029e:	41 56                	push   %r14
+  8002a0:	41 55                	push   %r13
+  8002a2:	41 54                	push   %r12
+  8002a4:	53                   	push   %rbx
+  8002a5:	48 83 ec 78          	sub    $0x78,%rsp
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+  8002a9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8002ae:	48 b8 76 1d 80 00 00 	movabs $0x801d76,%rax
+  8002b5:	00 00 00 
+  8002b8:	ff d0                	call   *%rax
+    if (!fsenv) panic("no file server");
+  8002ba:	85 c0                	test   %eax,%eax
+  8002bc:	0f 84 b5 02 00 00    	je     800577 <umain+0x2df>
+
+    bench("disk", &envs[ENVX(fsenv)]);
+  8002c2:	25 ff 03 00 00       	and    $0x3ff,%eax
+  8002c7:	48 89 c3             	mov    %rax,%rbx
+  8002ca:	48 c1 e3 04          	shl    $0x4,%rbx
+  8002ce:	48 29 c3             	sub    %rax,%rbx
+  8002d1:	48 c1 e3 05          	shl    $0x5,%rbx
+  8002d5:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  8002dc:	00 00 00 
+  8002df:	48 01 c3             	add    %rax,%rbx
+  8002e2:	48 89 de             	mov    %rbx,%rsi
+  8002e5:	48 bf 04 51 80 00 00 	movabs $0x805104,%rdi
+  8002ec:	00 00 00 
+  8002ef:	49 bc 25 00 80 00 00 	movabs $0x800025,%r12
+  8002f6:	00 00 00 
+  8002f9:	41 ff d4             	call   *%r12
+    bench("cached", &envs[ENVX(fsenv)]);
+  8002fc:	48 89 de             	mov    %rbx,%rsi
+  8002ff:	48 bf eb 4d 80 00 00 	movabs $0x804deb,%rdi
+  800306:	00 00 00 
+  800309:	41 ff d4             	call   *%r12
+    if ((fd = open("/diskbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  80030c:	be 02 03 00 00       	mov    $0x302,%esi
+  800311:	48 bf f2 4d 80 00 00 	movabs $0x804df2,%rdi
+  800318:	00 00 00 
+  80031b:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  800322:	00 00 00 
+  800325:	ff d0                	call   *%rax
+  800327:	41 89 c4             	mov    %eax,%r12d
+  80032a:	85 c0                	test   %eax,%eax
+  80032c:	0f 88 6a 02 00 00    	js     80059c <umain+0x304>
+    memset(buf, 'x', sizeof(buf));
+  800332:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800337:	be 78 00 00 00       	mov    $0x78,%esi
+  80033c:	48 bf 00 00 81 00 00 	movabs $0x810000,%rdi
+  800343:	00 00 00 
+  800346:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  80034d:	00 00 00 
+  800350:	ff d0                	call   *%rax
+  800352:	bb 08 00 00 00       	mov    $0x8,%ebx
+        if ((res = write(fd, buf, sizeof(buf))) != sizeof(buf))
+  800357:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  80035e:	00 00 00 
+  800361:	49 bd 75 22 80 00 00 	movabs $0x802275,%r13
+  800368:	00 00 00 
+  80036b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800370:	4c 89 f6             	mov    %r14,%rsi
+  800373:	44 89 e7             	mov    %r12d,%edi
+  800376:	41 ff d5             	call   *%r13
+  800379:	89 c1                	mov    %eax,%ecx
+  80037b:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  800380:	0f 85 43 02 00 00    	jne    8005c9 <umain+0x331>
+    for (size_t n = 0; n < WRITE_SIZE; n += sizeof(buf))
+  800386:	48 83 eb 01          	sub    $0x1,%rbx
+  80038a:	75 df                	jne    80036b <umain+0xd3>
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80038c:	48 8d bd 60 ff ff ff 	lea    -0xa0(%rbp),%rdi
+  800393:	48 b8 25 39 80 00 00 	movabs $0x803925,%rax
+  80039a:	00 00 00 
+  80039d:	ff d0                	call   *%rax
+  80039f:	85 c0                	test   %eax,%eax
+  8003a1:	0f 88 4d 02 00 00    	js     8005f4 <umain+0x35c>
+    asm volatile("rdtsc"
+  8003a7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003ad:	89 c0                	mov    %eax,%eax
+  8003af:	48 09 c2             	or     %rax,%rdx
+  8003b2:	49 89 d5             	mov    %rdx,%r13
+    if ((res = fsync(fd)) < 0) panic("fsync: %i", res);
+  8003b5:	44 89 e7             	mov    %r12d,%edi
+  8003b8:	48 b8 b5 38 80 00 00 	movabs $0x8038b5,%rax
+  8003bf:	00 00 00 
+  8003c2:	ff d0                	call   *%rax
+  8003c4:	85 c0                	test   %eax,%eax
+  8003c6:	0f 88 55 02 00 00    	js     800621 <umain+0x389>
+    asm volatile("rdtsc"
+  8003cc:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003ce:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003d2:	89 c0                	mov    %eax,%eax
+  8003d4:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8003d7:	48 89 d3             	mov    %rdx,%rbx
+  8003da:	4c 29 eb             	sub    %r13,%rbx
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  8003dd:	48 8d 7d 80          	lea    -0x80(%rbp),%rdi
+  8003e1:	48 b8 25 39 80 00 00 	movabs $0x803925,%rax
+  8003e8:	00 00 00 
+  8003eb:	ff d0                	call   *%rax
+  8003ed:	85 c0                	test   %eax,%eax
+  8003ef:	0f 88 59 02 00 00    	js     80064e <umain+0x3b6>
+    close(fd);
+  8003f5:	44 89 e7             	mov    %r12d,%edi
+  8003f8:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8003ff:	00 00 00 
+  800402:	ff d0                	call   *%rax
+            (unsigned long)(st1.ds_write_blocks - st0.ds_write_blocks));
+  800404:	48 8b 4d 98          	mov    -0x68(%rbp),%rcx
+  800408:	48 2b 8d 78 ff ff ff 	sub    -0x88(%rbp),%rcx
+            (unsigned long)(st1.ds_writes - st0.ds_writes),
+  80040f:	48 8b 7d 90          	mov    -0x70(%rbp),%rdi
+  800413:	48 2b bd 70 ff ff ff 	sub    -0x90(%rbp),%rdi
+            (unsigned long)(cycles / 1000),
+  80041a:	48 c1 eb 03          	shr    $0x3,%rbx
+  80041e:	48 ba cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rdx
+  800425:	9b c4 20 
+  800428:	48 89 d8             	mov    %rbx,%rax
+  80042b:	48 f7 e2             	mul    %rdx
+  80042e:	48 89 d6             	mov    %rdx,%rsi
+  800431:	48 c1 ee 04          	shr    $0x4,%rsi
+    cprintf("diskbench: fsync: %lu Kcycles, %lu write commands for %lu blocks\n",
+  800435:	48 89 fa             	mov    %rdi,%rdx
+  800438:	48 bf d0 4e 80 00 00 	movabs $0x804ed0,%rdi
+  80043f:	00 00 00 
+  800442:	b8 00 00 00 00       	mov    $0x0,%eax
+  800447:	49 b8 57 09 80 00 00 	movabs $0x800957,%r8
+  80044e:	00 00 00 
+  800451:	41 ff d0             	call   *%r8
+    for (int i = 0; i < 2; i++) {
+  800454:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80045a:	49 be 25 39 80 00 00 	movabs $0x803925,%r14
+  800461:	00 00 00 
+        sync();
+  800464:	49 bf 88 38 80 00 00 	movabs $0x803888,%r15
+  80046b:	00 00 00 
+        if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80046e:	48 8d bd 60 ff ff ff 	lea    -0xa0(%rbp),%rdi
+  800475:	41 ff d6             	call   *%r14
+  800478:	85 c0                	test   %eax,%eax
+  80047a:	0f 88 fb 01 00 00    	js     80067b <umain+0x3e3>
+    asm volatile("rdtsc"
+  800480:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800482:	48 c1 e2 20          	shl    $0x20,%rdx
+  800486:	89 c0                	mov    %eax,%eax
+  800488:	48 09 c2             	or     %rax,%rdx
+  80048b:	49 89 d4             	mov    %rdx,%r12
+        sync();
+  80048e:	41 ff d7             	call   *%r15
+    asm volatile("rdtsc"
+  800491:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800493:	48 c1 e2 20          	shl    $0x20,%rdx
+  800497:	89 c0                	mov    %eax,%eax
+  800499:	48 09 c2             	or     %rax,%rdx
+        cycles = read_tsc() - start;
+  80049c:	48 89 d3             	mov    %rdx,%rbx
+  80049f:	4c 29 e3             	sub    %r12,%rbx
+        if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  8004a2:	48 8d 7d 80          	lea    -0x80(%rbp),%rdi
+  8004a6:	41 ff d6             	call   *%r14
+  8004a9:	85 c0                	test   %eax,%eax
+  8004ab:	0f 88 f7 01 00 00    	js     8006a8 <umain+0x410>
+                (unsigned long)(st1.ds_write_blocks - st0.ds_write_blocks));
+  8004b1:	4c 8b 45 98          	mov    -0x68(%rbp),%r8
+  8004b5:	4c 2b 85 78 ff ff ff 	sub    -0x88(%rbp),%r8
+                (unsigned long)(st1.ds_writes - st0.ds_writes),
+  8004bc:	48 8b 4d 90          	mov    -0x70(%rbp),%rcx
+  8004c0:	48 2b 8d 70 ff ff ff 	sub    -0x90(%rbp),%rcx
+                i ? "clean sync" : "sync", (unsigned long)(cycles / 1000),
+  8004c7:	48 c1 eb 03          	shr    $0x3,%rbx
+  8004cb:	48 b8 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rax
+  8004d2:	9b c4 20 
+  8004d5:	48 f7 e3             	mul    %rbx
+  8004d8:	48 c1 ea 04          	shr    $0x4,%rdx
+        cprintf("diskbench: %s: %lu Kcycles, %lu write commands for %lu blocks\n",
+  8004dc:	45 85 ed             	test   %r13d,%r13d
+  8004df:	0f 84 1d 02 00 00    	je     800702 <umain+0x46a>
+  8004e5:	48 be 30 4e 80 00 00 	movabs $0x804e30,%rsi
+  8004ec:	00 00 00 
+  8004ef:	48 bf 18 4f 80 00 00 	movabs $0x804f18,%rdi
+  8004f6:	00 00 00 
+  8004f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004fe:	49 b9 57 09 80 00 00 	movabs $0x800957,%r9
+  800505:	00 00 00 
+  800508:	41 ff d1             	call   *%r9
+    for (int i = 0; i < 2; i++) {
+  80050b:	41 83 c5 01          	add    $0x1,%r13d
+  80050f:	41 83 fd 02          	cmp    $0x2,%r13d
+  800513:	0f 85 55 ff ff ff    	jne    80046e <umain+0x1d6>
+    bench_sync();
+
+    struct CacheStat cs;
+    int res = cache_stat(&cs);
+  800519:	48 8d 7d a0          	lea    -0x60(%rbp),%rdi
+  80051d:	48 b8 83 39 80 00 00 	movabs $0x803983,%rax
+  800524:	00 00 00 
+  800527:	ff d0                	call   *%rax
+    if (res < 0) panic("cache_stat: %i", res);
+  800529:	85 c0                	test   %eax,%eax
+  80052b:	0f 88 a4 01 00 00    	js     8006d5 <umain+0x43d>
+    cprintf("diskbench: cache: %lu hits, %lu misses, %lu read ahead, %lu evictions, %lu/%lu blocks\n",
+  800531:	48 83 ec 08          	sub    $0x8,%rsp
+  800535:	ff 75 c8             	push   -0x38(%rbp)
+  800538:	4c 8b 4d c0          	mov    -0x40(%rbp),%r9
+  80053c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  800540:	48 8b 4d b0          	mov    -0x50(%rbp),%rcx
+  800544:	48 8b 55 a8          	mov    -0x58(%rbp),%rdx
+  800548:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80054c:	48 bf 58 4f 80 00 00 	movabs $0x804f58,%rdi
+  800553:	00 00 00 
+  800556:	b8 00 00 00 00       	mov    $0x0,%eax
+  80055b:	49 ba 57 09 80 00 00 	movabs $0x800957,%r10
+  800562:	00 00 00 
+  800565:	41 ff d2             	call   *%r10
+            (unsigned long)cs.cs_hits, (unsigned long)cs.cs_misses,
+            (unsigned long)cs.cs_readahead, (unsigned long)cs.cs_evictions,
+            (unsigned long)cs.cs_resident, (unsigned long)cs.cs_budget);
+}
+  800568:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80056c:	5b                   	pop    %rbx
+  80056d:	41 5c                	pop    %r12
+  80056f:	41 5d                	pop    %r13
+  800571:	41 5e                	pop    %r14
+  800573:	41 5f                	pop    %r15
+  800575:	5d                   	pop    %rbp
+  800576:	c3                   	ret
+    if (!fsenv) panic("no file server");
+  800577:	48 ba dc 4d 80 00 00 	movabs $0x804ddc,%rdx
+  80057e:	00 00 00 
+  800581:	be 58 00 00 00       	mov    $0x58,%esi
+  800586:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  80058d:	00 00 00 
+  800590:	48 b9 07 08 80 00 00 	movabs $0x800807,%rcx
+  800597:	00 00 00 
+  80059a:	ff d1                	call   *%rcx
+        panic("open /diskbench: %i", fd);
+  80059c:	89 c1                	mov    %eax,%ecx
+  80059e:	48 ba fd 4d 80 00 00 	movabs $0x804dfd,%rdx
+  8005a5:	00 00 00 
+  8005a8:	be 33 00 00 00       	mov    $0x33,%esi
+  8005ad:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8005b4:	00 00 00 
+  8005b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005bc:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8005c3:	00 00 00 
+  8005c6:	41 ff d0             	call   *%r8
+            panic("write /diskbench: %i", res);
+  8005c9:	48 ba 11 4e 80 00 00 	movabs $0x804e11,%rdx
+  8005d0:	00 00 00 
+  8005d3:	be 38 00 00 00       	mov    $0x38,%esi
+  8005d8:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8005df:	00 00 00 
+  8005e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e7:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8005ee:	00 00 00 
+  8005f1:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  8005f4:	89 c1                	mov    %eax,%ecx
+  8005f6:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  8005fd:	00 00 00 
+  800600:	be 3a 00 00 00       	mov    $0x3a,%esi
+  800605:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  80060c:	00 00 00 
+  80060f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800614:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  80061b:	00 00 00 
+  80061e:	41 ff d0             	call   *%r8
+    if ((res = fsync(fd)) < 0) panic("fsync: %i", res);
+  800621:	89 c1                	mov    %eax,%ecx
+  800623:	48 ba 26 4e 80 00 00 	movabs $0x804e26,%rdx
+  80062a:	00 00 00 
+  80062d:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800632:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  800639:	00 00 00 
+  80063c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800641:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800648:	00 00 00 
+  80064b:	41 ff d0             	call   *%r8
+    if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  80064e:	89 c1                	mov    %eax,%ecx
+  800650:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  800657:	00 00 00 
+  80065a:	be 3e 00 00 00       	mov    $0x3e,%esi
+  80065f:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  800666:	00 00 00 
+  800669:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066e:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  800675:	00 00 00 
+  800678:	41 ff d0             	call   *%r8
+        if ((res = disk_stat(&st0)) < 0) panic("disk_stat: %i", res);
+  80067b:	89 c1                	mov    %eax,%ecx
+  80067d:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  800684:	00 00 00 
+  800687:	be 48 00 00 00       	mov    $0x48,%esi
+  80068c:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  800693:	00 00 00 
+  800696:	b8 00 00 00 00       	mov    $0x0,%eax
+  80069b:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8006a2:	00 00 00 
+  8006a5:	41 ff d0             	call   *%r8
+        if ((res = disk_stat(&st1)) < 0) panic("disk_stat: %i", res);
+  8006a8:	89 c1                	mov    %eax,%ecx
+  8006aa:	48 ba bc 4d 80 00 00 	movabs $0x804dbc,%rdx
+  8006b1:	00 00 00 
+  8006b4:	be 4c 00 00 00       	mov    $0x4c,%esi
+  8006b9:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8006c0:	00 00 00 
+  8006c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c8:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8006cf:	00 00 00 
+  8006d2:	41 ff d0             	call   *%r8
+    if (res < 0) panic("cache_stat: %i", res);
+  8006d5:	89 c1                	mov    %eax,%ecx
+  8006d7:	48 ba 3b 4e 80 00 00 	movabs $0x804e3b,%rdx
+  8006de:	00 00 00 
+  8006e1:	be 60 00 00 00       	mov    $0x60,%esi
+  8006e6:	48 bf ab 4d 80 00 00 	movabs $0x804dab,%rdi
+  8006ed:	00 00 00 
+  8006f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f5:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  8006fc:	00 00 00 
+  8006ff:	41 ff d0             	call   *%r8
+        cprintf("diskbench: %s: %lu Kcycles, %lu write commands for %lu blocks\n",
+  800702:	48 be 36 4e 80 00 00 	movabs $0x804e36,%rsi
+  800709:	00 00 00 
+  80070c:	48 bf 18 4f 80 00 00 	movabs $0x804f18,%rdi
+  800713:	00 00 00 
+  800716:	b8 00 00 00 00       	mov    $0x0,%eax
+  80071b:	49 b9 57 09 80 00 00 	movabs $0x800957,%r9
+  800722:	00 00 00 
+  800725:	41 ff d1             	call   *%r9
+    for (int i = 0; i < 2; i++) {
+  800728:	41 83 c5 01          	add    $0x1,%r13d
+  80072c:	e9 3d fd ff ff       	jmp    80046e <umain+0x1d6>
+
+0000000000800731 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800731:	55                   	push   %rbp
+  800732:	48 89 e5             	mov    %rsp,%rbp
+  800735:	41 56                	push   %r14
+  800737:	41 55                	push   %r13
+  800739:	41 54                	push   %r12
+  80073b:	53                   	push   %rbx
+  80073c:	41 89 fd             	mov    %edi,%r13d
+  80073f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800742:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800749:	00 00 00 
+  80074c:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800753:	00 00 00 
+  800756:	48 39 c2             	cmp    %rax,%rdx
+  800759:	73 17                	jae    800772 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80075b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80075e:	49 89 c4             	mov    %rax,%r12
+  800761:	48 83 c3 08          	add    $0x8,%rbx
+  800765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80076a:	ff 53 f8             	call   *-0x8(%rbx)
+  80076d:	4c 39 e3             	cmp    %r12,%rbx
+  800770:	72 ef                	jb     800761 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800772:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  800779:	00 00 00 
+  80077c:	ff d0                	call   *%rax
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800786:	48 89 d0             	mov    %rdx,%rax
+  800789:	48 c1 e0 04          	shl    $0x4,%rax
+  80078d:	48 29 d0             	sub    %rdx,%rax
+  800790:	48 c1 e0 05          	shl    $0x5,%rax
+  800794:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80079b:	00 00 00 
+  80079e:	48 01 d0             	add    %rdx,%rax
+  8007a1:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  8007a8:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8007ab:	45 85 ed             	test   %r13d,%r13d
+  8007ae:	7e 0d                	jle    8007bd <libmain+0x8c>
+  8007b0:	49 8b 06             	mov    (%r14),%rax
+  8007b3:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8007ba:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8007bd:	4c 89 f6             	mov    %r14,%rsi
+  8007c0:	44 89 ef             	mov    %r13d,%edi
+  8007c3:	48 b8 98 02 80 00 00 	movabs $0x800298,%rax
+  8007ca:	00 00 00 
+  8007cd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8007cf:	48 b8 e4 07 80 00 00 	movabs $0x8007e4,%rax
+  8007d6:	00 00 00 
+  8007d9:	ff d0                	call   *%rax
+#endif
+}
+  8007db:	5b                   	pop    %rbx
+  8007dc:	41 5c                	pop    %r12
+  8007de:	41 5d                	pop    %r13
+  8007e0:	41 5e                	pop    %r14
+  8007e2:	5d                   	pop    %rbp
+  8007e3:	c3                   	ret
+
+00000000008007e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8007e4:	55                   	push   %rbp
+  8007e5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8007e8:	48 b8 fb 1f 80 00 00 	movabs $0x801ffb,%rax
+  8007ef:	00 00 00 
+  8007f2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8007f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007f9:	48 b8 eb 16 80 00 00 	movabs $0x8016eb,%rax
+  800800:	00 00 00 
+  800803:	ff d0                	call   *%rax
+}
+  800805:	5d                   	pop    %rbp
+  800806:	c3                   	ret
+
+0000000000800807 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800807:	55                   	push   %rbp
+  800808:	48 89 e5             	mov    %rsp,%rbp
+  80080b:	41 56                	push   %r14
+  80080d:	41 55                	push   %r13
+  80080f:	41 54                	push   %r12
+  800811:	53                   	push   %rbx
+  800812:	48 83 ec 50          	sub    $0x50,%rsp
+  800816:	49 89 fc             	mov    %rdi,%r12
+  800819:	41 89 f5             	mov    %esi,%r13d
+  80081c:	48 89 d3             	mov    %rdx,%rbx
+  80081f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800823:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800827:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80082b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800832:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800836:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80083a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80083e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800842:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800849:	00 00 00 
+  80084c:	4c 8b 30             	mov    (%rax),%r14
+  80084f:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  800856:	00 00 00 
+  800859:	ff d0                	call   *%rax
+  80085b:	89 c6                	mov    %eax,%esi
+  80085d:	45 89 e8             	mov    %r13d,%r8d
+  800860:	4c 89 e1             	mov    %r12,%rcx
+  800863:	4c 89 f2             	mov    %r14,%rdx
+  800866:	48 bf c0 4f 80 00 00 	movabs $0x804fc0,%rdi
+  80086d:	00 00 00 
+  800870:	b8 00 00 00 00       	mov    $0x0,%eax
+  800875:	49 bc 57 09 80 00 00 	movabs $0x800957,%r12
+  80087c:	00 00 00 
+  80087f:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800882:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800886:	48 89 df             	mov    %rbx,%rdi
+  800889:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  800890:	00 00 00 
+  800893:	ff d0                	call   *%rax
+    cprintf("\n");
+  800895:	48 bf e3 55 80 00 00 	movabs $0x8055e3,%rdi
+  80089c:	00 00 00 
+  80089f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008a4:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8008a7:	cc                   	int3
+  8008a8:	eb fd                	jmp    8008a7 <_panic+0xa0>
+
+00000000008008aa <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8008aa:	55                   	push   %rbp
+  8008ab:	48 89 e5             	mov    %rsp,%rbp
+  8008ae:	53                   	push   %rbx
+  8008af:	48 83 ec 08          	sub    $0x8,%rsp
+  8008b3:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8008b6:	8b 06                	mov    (%rsi),%eax
+  8008b8:	8d 50 01             	lea    0x1(%rax),%edx
+  8008bb:	89 16                	mov    %edx,(%rsi)
+  8008bd:	48 98                	cltq
+  8008bf:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8008c4:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8008ca:	74 0a                	je     8008d6 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8008cc:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8008d0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8008d4:	c9                   	leave
+  8008d5:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8008d6:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8008da:	be ff 00 00 00       	mov    $0xff,%esi
+  8008df:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  8008e6:	00 00 00 
+  8008e9:	ff d0                	call   *%rax
+        state->offset = 0;
+  8008eb:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8008f1:	eb d9                	jmp    8008cc <putch+0x22>
+
+00000000008008f3 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8008f3:	55                   	push   %rbp
+  8008f4:	48 89 e5             	mov    %rsp,%rbp
+  8008f7:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8008fe:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800901:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800908:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80090d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800912:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800915:	48 89 f1             	mov    %rsi,%rcx
+  800918:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80091f:	48 bf aa 08 80 00 00 	movabs $0x8008aa,%rdi
+  800926:	00 00 00 
+  800929:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800930:	00 00 00 
+  800933:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800935:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80093c:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800943:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  80094a:	00 00 00 
+  80094d:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80094f:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800955:	c9                   	leave
+  800956:	c3                   	ret
+
+0000000000800957 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800957:	55                   	push   %rbp
+  800958:	48 89 e5             	mov    %rsp,%rbp
+  80095b:	48 83 ec 50          	sub    $0x50,%rsp
+  80095f:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800963:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800967:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80096b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80096f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800973:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80097a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80097e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800982:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800986:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80098a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80098e:	48 b8 f3 08 80 00 00 	movabs $0x8008f3,%rax
+  800995:	00 00 00 
+  800998:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80099a:	c9                   	leave
+  80099b:	c3                   	ret
+
+000000000080099c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80099c:	55                   	push   %rbp
+  80099d:	48 89 e5             	mov    %rsp,%rbp
+  8009a0:	41 57                	push   %r15
+  8009a2:	41 56                	push   %r14
+  8009a4:	41 55                	push   %r13
+  8009a6:	41 54                	push   %r12
+  8009a8:	53                   	push   %rbx
+  8009a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8009ad:	49 89 fc             	mov    %rdi,%r12
+  8009b0:	49 89 f5             	mov    %rsi,%r13
+  8009b3:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8009b7:	8b 45 10             	mov    0x10(%rbp),%eax
+  8009ba:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8009bd:	41 89 cf             	mov    %ecx,%r15d
+  8009c0:	4c 39 fa             	cmp    %r15,%rdx
+  8009c3:	73 5b                	jae    800a20 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8009c5:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8009c9:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8009cd:	85 db                	test   %ebx,%ebx
+  8009cf:	7e 0e                	jle    8009df <print_num+0x43>
+            putch(padc, put_arg);
+  8009d1:	4c 89 ee             	mov    %r13,%rsi
+  8009d4:	44 89 f7             	mov    %r14d,%edi
+  8009d7:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8009da:	83 eb 01             	sub    $0x1,%ebx
+  8009dd:	75 f2                	jne    8009d1 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8009df:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8009e3:	48 b9 f4 4f 80 00 00 	movabs $0x804ff4,%rcx
+  8009ea:	00 00 00 
+  8009ed:	48 b8 e3 4f 80 00 00 	movabs $0x804fe3,%rax
+  8009f4:	00 00 00 
+  8009f7:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8009fb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a04:	49 f7 f7             	div    %r15
+  800a07:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800a0b:	4c 89 ee             	mov    %r13,%rsi
+  800a0e:	41 ff d4             	call   *%r12
+}
+  800a11:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a15:	5b                   	pop    %rbx
+  800a16:	41 5c                	pop    %r12
+  800a18:	41 5d                	pop    %r13
+  800a1a:	41 5e                	pop    %r14
+  800a1c:	41 5f                	pop    %r15
+  800a1e:	5d                   	pop    %rbp
+  800a1f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800a20:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800a24:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a29:	49 f7 f7             	div    %r15
+  800a2c:	48 83 ec 08          	sub    $0x8,%rsp
+  800a30:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800a34:	52                   	push   %rdx
+  800a35:	45 0f be c9          	movsbl %r9b,%r9d
+  800a39:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800a3d:	48 89 c2             	mov    %rax,%rdx
+  800a40:	48 b8 9c 09 80 00 00 	movabs $0x80099c,%rax
+  800a47:	00 00 00 
+  800a4a:	ff d0                	call   *%rax
+  800a4c:	48 83 c4 10          	add    $0x10,%rsp
+  800a50:	eb 8d                	jmp    8009df <print_num+0x43>
+
+0000000000800a52 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800a52:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800a56:	48 8b 06             	mov    (%rsi),%rax
+  800a59:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800a5d:	73 0a                	jae    800a69 <sprintputch+0x17>
+        *state->start++ = ch;
+  800a5f:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800a63:	48 89 16             	mov    %rdx,(%rsi)
+  800a66:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a69:	c3                   	ret
+
+0000000000800a6a <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a6a:	55                   	push   %rbp
+  800a6b:	48 89 e5             	mov    %rsp,%rbp
+  800a6e:	48 83 ec 50          	sub    $0x50,%rsp
+  800a72:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a76:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a7a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a7e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a85:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a95:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a99:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  800aa0:	00 00 00 
+  800aa3:	ff d0                	call   *%rax
+}
+  800aa5:	c9                   	leave
+  800aa6:	c3                   	ret
+
+0000000000800aa7 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800aa7:	55                   	push   %rbp
+  800aa8:	48 89 e5             	mov    %rsp,%rbp
+  800aab:	41 57                	push   %r15
+  800aad:	41 56                	push   %r14
+  800aaf:	41 55                	push   %r13
+  800ab1:	41 54                	push   %r12
+  800ab3:	53                   	push   %rbx
+  800ab4:	48 83 ec 38          	sub    $0x38,%rsp
+  800ab8:	49 89 fe             	mov    %rdi,%r14
+  800abb:	49 89 f5             	mov    %rsi,%r13
+  800abe:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800ac1:	48 8b 01             	mov    (%rcx),%rax
+  800ac4:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800ac8:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800acc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad0:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800ad4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800ad8:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800adc:	0f b6 3b             	movzbl (%rbx),%edi
+  800adf:	40 80 ff 25          	cmp    $0x25,%dil
+  800ae3:	74 18                	je     800afd <vprintfmt+0x56>
+            if (!ch) return;
+  800ae5:	40 84 ff             	test   %dil,%dil
+  800ae8:	0f 84 b1 06 00 00    	je     80119f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800aee:	40 0f b6 ff          	movzbl %dil,%edi
+  800af2:	4c 89 ee             	mov    %r13,%rsi
+  800af5:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800af8:	4c 89 e3             	mov    %r12,%rbx
+  800afb:	eb db                	jmp    800ad8 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800afd:	be 00 00 00 00       	mov    $0x0,%esi
+  800b02:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800b06:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800b0b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b11:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800b18:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b1c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800b21:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800b26:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800b29:	83 e8 23             	sub    $0x23,%eax
+  800b2c:	3c 57                	cmp    $0x57,%al
+  800b2e:	0f 87 51 06 00 00    	ja     801185 <vprintfmt+0x6de>
+  800b34:	0f b6 c0             	movzbl %al,%eax
+  800b37:	48 b9 a0 51 80 00 00 	movabs $0x8051a0,%rcx
+  800b3e:	00 00 00 
+  800b41:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800b44:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800b47:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800b4b:	eb cf                	jmp    800b1c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800b4d:	49 89 dc             	mov    %rbx,%r12
+  800b50:	be 01 00 00 00       	mov    $0x1,%esi
+  800b55:	eb c5                	jmp    800b1c <vprintfmt+0x75>
+            padc = ch;
+  800b57:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800b5b:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800b5e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b61:	eb b9                	jmp    800b1c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b66:	83 f8 2f             	cmp    $0x2f,%eax
+  800b69:	77 24                	ja     800b8f <vprintfmt+0xe8>
+  800b6b:	89 c1                	mov    %eax,%ecx
+  800b6d:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b71:	83 c0 08             	add    $0x8,%eax
+  800b74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b77:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b7a:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b7d:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b81:	79 99                	jns    800b1c <vprintfmt+0x75>
+                width = precision;
+  800b83:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b87:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b8d:	eb 8d                	jmp    800b1c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b8f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b93:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9b:	eb da                	jmp    800b77 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b9d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800ba2:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800ba6:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800bac:	3c 39                	cmp    $0x39,%al
+  800bae:	77 1c                	ja     800bcc <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800bb0:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800bb4:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800bb8:	0f b6 c0             	movzbl %al,%eax
+  800bbb:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800bc0:	0f b6 03             	movzbl (%rbx),%eax
+  800bc3:	3c 39                	cmp    $0x39,%al
+  800bc5:	76 e9                	jbe    800bb0 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800bc7:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800bca:	eb b1                	jmp    800b7d <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800bcc:	49 89 dc             	mov    %rbx,%r12
+  800bcf:	eb ac                	jmp    800b7d <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800bd1:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800bd4:	85 c9                	test   %ecx,%ecx
+  800bd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdb:	0f 49 c1             	cmovns %ecx,%eax
+  800bde:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800be1:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800be4:	e9 33 ff ff ff       	jmp    800b1c <vprintfmt+0x75>
+            lflag++;
+  800be9:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800bec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800bef:	e9 28 ff ff ff       	jmp    800b1c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800bf4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf7:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfa:	77 19                	ja     800c15 <vprintfmt+0x16e>
+  800bfc:	89 c2                	mov    %eax,%edx
+  800bfe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c02:	83 c0 08             	add    $0x8,%eax
+  800c05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c08:	8b 3a                	mov    (%rdx),%edi
+  800c0a:	4c 89 ee             	mov    %r13,%rsi
+  800c0d:	41 ff d6             	call   *%r14
+            break;
+  800c10:	e9 c3 fe ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800c15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c21:	eb e5                	jmp    800c08 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800c23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c26:	83 f8 2f             	cmp    $0x2f,%eax
+  800c29:	77 5a                	ja     800c85 <vprintfmt+0x1de>
+  800c2b:	89 c2                	mov    %eax,%edx
+  800c2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c31:	83 c0 08             	add    $0x8,%eax
+  800c34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800c37:	8b 02                	mov    (%rdx),%eax
+  800c39:	89 c1                	mov    %eax,%ecx
+  800c3b:	f7 d9                	neg    %ecx
+  800c3d:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800c40:	83 f9 16             	cmp    $0x16,%ecx
+  800c43:	7f 4e                	jg     800c93 <vprintfmt+0x1ec>
+  800c45:	48 63 c1             	movslq %ecx,%rax
+  800c48:	48 ba 60 54 80 00 00 	movabs $0x805460,%rdx
+  800c4f:	00 00 00 
+  800c52:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800c56:	48 85 c0             	test   %rax,%rax
+  800c59:	74 38                	je     800c93 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800c5b:	48 89 c1             	mov    %rax,%rcx
+  800c5e:	48 ba 59 56 80 00 00 	movabs $0x805659,%rdx
+  800c65:	00 00 00 
+  800c68:	4c 89 ee             	mov    %r13,%rsi
+  800c6b:	4c 89 f7             	mov    %r14,%rdi
+  800c6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c73:	49 b8 6a 0a 80 00 00 	movabs $0x800a6a,%r8
+  800c7a:	00 00 00 
+  800c7d:	41 ff d0             	call   *%r8
+  800c80:	e9 53 fe ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c91:	eb a4                	jmp    800c37 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c93:	48 ba 0c 50 80 00 00 	movabs $0x80500c,%rdx
+  800c9a:	00 00 00 
+  800c9d:	4c 89 ee             	mov    %r13,%rsi
+  800ca0:	4c 89 f7             	mov    %r14,%rdi
+  800ca3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ca8:	49 b8 6a 0a 80 00 00 	movabs $0x800a6a,%r8
+  800caf:	00 00 00 
+  800cb2:	41 ff d0             	call   *%r8
+  800cb5:	e9 1e fe ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbd:	83 f8 2f             	cmp    $0x2f,%eax
+  800cc0:	77 6c                	ja     800d2e <vprintfmt+0x287>
+  800cc2:	89 c2                	mov    %eax,%edx
+  800cc4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc8:	83 c0 08             	add    $0x8,%eax
+  800ccb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cce:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800cd1:	48 85 d2             	test   %rdx,%rdx
+  800cd4:	48 b8 05 50 80 00 00 	movabs $0x805005,%rax
+  800cdb:	00 00 00 
+  800cde:	48 0f 45 c2          	cmovne %rdx,%rax
+  800ce2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800ce6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800cea:	7e 06                	jle    800cf2 <vprintfmt+0x24b>
+  800cec:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800cf0:	75 4a                	jne    800d3c <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800cf2:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800cf6:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800cfa:	0f b6 00             	movzbl (%rax),%eax
+  800cfd:	84 c0                	test   %al,%al
+  800cff:	0f 85 9a 00 00 00    	jne    800d9f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800d05:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d08:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800d0c:	85 c0                	test   %eax,%eax
+  800d0e:	0f 8e c4 fd ff ff    	jle    800ad8 <vprintfmt+0x31>
+  800d14:	4c 89 ee             	mov    %r13,%rsi
+  800d17:	bf 20 00 00 00       	mov    $0x20,%edi
+  800d1c:	41 ff d6             	call   *%r14
+  800d1f:	41 83 ec 01          	sub    $0x1,%r12d
+  800d23:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800d27:	75 eb                	jne    800d14 <vprintfmt+0x26d>
+  800d29:	e9 aa fd ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800d2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d3a:	eb 92                	jmp    800cce <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800d3c:	49 63 f7             	movslq %r15d,%rsi
+  800d3f:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800d43:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  800d4a:	00 00 00 
+  800d4d:	ff d0                	call   *%rax
+  800d4f:	48 89 c2             	mov    %rax,%rdx
+  800d52:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d55:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800d57:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800d5a:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800d5d:	85 c0                	test   %eax,%eax
+  800d5f:	7e 91                	jle    800cf2 <vprintfmt+0x24b>
+  800d61:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d66:	4c 89 ee             	mov    %r13,%rsi
+  800d69:	44 89 e7             	mov    %r12d,%edi
+  800d6c:	41 ff d6             	call   *%r14
+  800d6f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d73:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d76:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d79:	75 eb                	jne    800d66 <vprintfmt+0x2bf>
+  800d7b:	e9 72 ff ff ff       	jmp    800cf2 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d80:	0f b6 f8             	movzbl %al,%edi
+  800d83:	4c 89 ee             	mov    %r13,%rsi
+  800d86:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d89:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d8d:	49 83 c4 01          	add    $0x1,%r12
+  800d91:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d97:	84 c0                	test   %al,%al
+  800d99:	0f 84 66 ff ff ff    	je     800d05 <vprintfmt+0x25e>
+  800d9f:	45 85 ff             	test   %r15d,%r15d
+  800da2:	78 0a                	js     800dae <vprintfmt+0x307>
+  800da4:	41 83 ef 01          	sub    $0x1,%r15d
+  800da8:	0f 88 57 ff ff ff    	js     800d05 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800dae:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800db2:	74 cc                	je     800d80 <vprintfmt+0x2d9>
+  800db4:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800db7:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800dbc:	80 fa 5e             	cmp    $0x5e,%dl
+  800dbf:	77 c2                	ja     800d83 <vprintfmt+0x2dc>
+  800dc1:	eb bd                	jmp    800d80 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800dc3:	40 84 f6             	test   %sil,%sil
+  800dc6:	75 26                	jne    800dee <vprintfmt+0x347>
+    switch (lflag) {
+  800dc8:	85 d2                	test   %edx,%edx
+  800dca:	74 59                	je     800e25 <vprintfmt+0x37e>
+  800dcc:	83 fa 01             	cmp    $0x1,%edx
+  800dcf:	74 7b                	je     800e4c <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800dd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd4:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd7:	0f 87 96 00 00 00    	ja     800e73 <vprintfmt+0x3cc>
+  800ddd:	89 c2                	mov    %eax,%edx
+  800ddf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de3:	83 c0 08             	add    $0x8,%eax
+  800de6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de9:	4c 8b 22             	mov    (%rdx),%r12
+  800dec:	eb 17                	jmp    800e05 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800dee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800df1:	83 f8 2f             	cmp    $0x2f,%eax
+  800df4:	77 21                	ja     800e17 <vprintfmt+0x370>
+  800df6:	89 c2                	mov    %eax,%edx
+  800df8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dfc:	83 c0 08             	add    $0x8,%eax
+  800dff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e02:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800e05:	4d 85 e4             	test   %r12,%r12
+  800e08:	78 7a                	js     800e84 <vprintfmt+0x3dd>
+            num = i;
+  800e0a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800e0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800e12:	e9 50 02 00 00       	jmp    801067 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e23:	eb dd                	jmp    800e02 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800e25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e28:	83 f8 2f             	cmp    $0x2f,%eax
+  800e2b:	77 11                	ja     800e3e <vprintfmt+0x397>
+  800e2d:	89 c2                	mov    %eax,%edx
+  800e2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e33:	83 c0 08             	add    $0x8,%eax
+  800e36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e39:	4c 63 22             	movslq (%rdx),%r12
+  800e3c:	eb c7                	jmp    800e05 <vprintfmt+0x35e>
+  800e3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4a:	eb ed                	jmp    800e39 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800e4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e52:	77 11                	ja     800e65 <vprintfmt+0x3be>
+  800e54:	89 c2                	mov    %eax,%edx
+  800e56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e5a:	83 c0 08             	add    $0x8,%eax
+  800e5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e60:	4c 8b 22             	mov    (%rdx),%r12
+  800e63:	eb a0                	jmp    800e05 <vprintfmt+0x35e>
+  800e65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e71:	eb ed                	jmp    800e60 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e7f:	e9 65 ff ff ff       	jmp    800de9 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800e84:	4c 89 ee             	mov    %r13,%rsi
+  800e87:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e8c:	41 ff d6             	call   *%r14
+                i = -i;
+  800e8f:	49 f7 dc             	neg    %r12
+  800e92:	e9 73 ff ff ff       	jmp    800e0a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800e97:	40 84 f6             	test   %sil,%sil
+  800e9a:	75 32                	jne    800ece <vprintfmt+0x427>
+    switch (lflag) {
+  800e9c:	85 d2                	test   %edx,%edx
+  800e9e:	74 5d                	je     800efd <vprintfmt+0x456>
+  800ea0:	83 fa 01             	cmp    $0x1,%edx
+  800ea3:	0f 84 82 00 00 00    	je     800f2b <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ea9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eac:	83 f8 2f             	cmp    $0x2f,%eax
+  800eaf:	0f 87 a5 00 00 00    	ja     800f5a <vprintfmt+0x4b3>
+  800eb5:	89 c2                	mov    %eax,%edx
+  800eb7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ebb:	83 c0 08             	add    $0x8,%eax
+  800ebe:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ec1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ec4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ec9:	e9 99 01 00 00       	jmp    801067 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ece:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ed1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ed4:	77 19                	ja     800eef <vprintfmt+0x448>
+  800ed6:	89 c2                	mov    %eax,%edx
+  800ed8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800edc:	83 c0 08             	add    $0x8,%eax
+  800edf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ee2:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ee5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800eea:	e9 78 01 00 00       	jmp    801067 <vprintfmt+0x5c0>
+  800eef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ef3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800efb:	eb e5                	jmp    800ee2 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800efd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f00:	83 f8 2f             	cmp    $0x2f,%eax
+  800f03:	77 18                	ja     800f1d <vprintfmt+0x476>
+  800f05:	89 c2                	mov    %eax,%edx
+  800f07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f0b:	83 c0 08             	add    $0x8,%eax
+  800f0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f11:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800f13:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800f18:	e9 4a 01 00 00       	jmp    801067 <vprintfmt+0x5c0>
+  800f1d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f21:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f29:	eb e6                	jmp    800f11 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800f2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f31:	77 19                	ja     800f4c <vprintfmt+0x4a5>
+  800f33:	89 c2                	mov    %eax,%edx
+  800f35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f39:	83 c0 08             	add    $0x8,%eax
+  800f3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f3f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800f42:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800f47:	e9 1b 01 00 00       	jmp    801067 <vprintfmt+0x5c0>
+  800f4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f58:	eb e5                	jmp    800f3f <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800f5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f66:	e9 56 ff ff ff       	jmp    800ec1 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f6b:	40 84 f6             	test   %sil,%sil
+  800f6e:	75 2e                	jne    800f9e <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f70:	85 d2                	test   %edx,%edx
+  800f72:	74 59                	je     800fcd <vprintfmt+0x526>
+  800f74:	83 fa 01             	cmp    $0x1,%edx
+  800f77:	74 7f                	je     800ff8 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7f:	0f 87 9f 00 00 00    	ja     801024 <vprintfmt+0x57d>
+  800f85:	89 c2                	mov    %eax,%edx
+  800f87:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f8b:	83 c0 08             	add    $0x8,%eax
+  800f8e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f91:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f94:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f99:	e9 c9 00 00 00       	jmp    801067 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f9e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa1:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa4:	77 19                	ja     800fbf <vprintfmt+0x518>
+  800fa6:	89 c2                	mov    %eax,%edx
+  800fa8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fac:	83 c0 08             	add    $0x8,%eax
+  800faf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fb2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fb5:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800fba:	e9 a8 00 00 00       	jmp    801067 <vprintfmt+0x5c0>
+  800fbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fcb:	eb e5                	jmp    800fb2 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800fcd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fd0:	83 f8 2f             	cmp    $0x2f,%eax
+  800fd3:	77 15                	ja     800fea <vprintfmt+0x543>
+  800fd5:	89 c2                	mov    %eax,%edx
+  800fd7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fdb:	83 c0 08             	add    $0x8,%eax
+  800fde:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fe1:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800fe3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800fe8:	eb 7d                	jmp    801067 <vprintfmt+0x5c0>
+  800fea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ff2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ff6:	eb e9                	jmp    800fe1 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ff8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ffb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ffe:	77 16                	ja     801016 <vprintfmt+0x56f>
+  801000:	89 c2                	mov    %eax,%edx
+  801002:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801006:	83 c0 08             	add    $0x8,%eax
+  801009:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80100c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80100f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801014:	eb 51                	jmp    801067 <vprintfmt+0x5c0>
+  801016:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80101a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80101e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801022:	eb e8                	jmp    80100c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  801024:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801028:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80102c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801030:	e9 5c ff ff ff       	jmp    800f91 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  801035:	4c 89 ee             	mov    %r13,%rsi
+  801038:	bf 30 00 00 00       	mov    $0x30,%edi
+  80103d:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  801040:	4c 89 ee             	mov    %r13,%rsi
+  801043:	bf 78 00 00 00       	mov    $0x78,%edi
+  801048:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80104b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80104e:	83 f8 2f             	cmp    $0x2f,%eax
+  801051:	77 47                	ja     80109a <vprintfmt+0x5f3>
+  801053:	89 c2                	mov    %eax,%edx
+  801055:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801059:	83 c0 08             	add    $0x8,%eax
+  80105c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80105f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801062:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801067:	48 83 ec 08          	sub    $0x8,%rsp
+  80106b:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80106f:	0f 94 c0             	sete   %al
+  801072:	0f b6 c0             	movzbl %al,%eax
+  801075:	50                   	push   %rax
+  801076:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80107b:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80107f:	4c 89 ee             	mov    %r13,%rsi
+  801082:	4c 89 f7             	mov    %r14,%rdi
+  801085:	48 b8 9c 09 80 00 00 	movabs $0x80099c,%rax
+  80108c:	00 00 00 
+  80108f:	ff d0                	call   *%rax
+            break;
+  801091:	48 83 c4 10          	add    $0x10,%rsp
+  801095:	e9 3e fa ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80109a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80109e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a6:	eb b7                	jmp    80105f <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8010a8:	40 84 f6             	test   %sil,%sil
+  8010ab:	75 2b                	jne    8010d8 <vprintfmt+0x631>
+    switch (lflag) {
+  8010ad:	85 d2                	test   %edx,%edx
+  8010af:	74 56                	je     801107 <vprintfmt+0x660>
+  8010b1:	83 fa 01             	cmp    $0x1,%edx
+  8010b4:	74 7f                	je     801135 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8010b6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010b9:	83 f8 2f             	cmp    $0x2f,%eax
+  8010bc:	0f 87 a2 00 00 00    	ja     801164 <vprintfmt+0x6bd>
+  8010c2:	89 c2                	mov    %eax,%edx
+  8010c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010c8:	83 c0 08             	add    $0x8,%eax
+  8010cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010ce:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010d1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  8010d6:	eb 8f                	jmp    801067 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8010d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010db:	83 f8 2f             	cmp    $0x2f,%eax
+  8010de:	77 19                	ja     8010f9 <vprintfmt+0x652>
+  8010e0:	89 c2                	mov    %eax,%edx
+  8010e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010e6:	83 c0 08             	add    $0x8,%eax
+  8010e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010ec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010ef:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8010f4:	e9 6e ff ff ff       	jmp    801067 <vprintfmt+0x5c0>
+  8010f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801101:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801105:	eb e5                	jmp    8010ec <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801107:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80110a:	83 f8 2f             	cmp    $0x2f,%eax
+  80110d:	77 18                	ja     801127 <vprintfmt+0x680>
+  80110f:	89 c2                	mov    %eax,%edx
+  801111:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801115:	83 c0 08             	add    $0x8,%eax
+  801118:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80111b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80111d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  801122:	e9 40 ff ff ff       	jmp    801067 <vprintfmt+0x5c0>
+  801127:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80112b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80112f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801133:	eb e6                	jmp    80111b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  801135:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801138:	83 f8 2f             	cmp    $0x2f,%eax
+  80113b:	77 19                	ja     801156 <vprintfmt+0x6af>
+  80113d:	89 c2                	mov    %eax,%edx
+  80113f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801143:	83 c0 08             	add    $0x8,%eax
+  801146:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801149:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80114c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  801151:	e9 11 ff ff ff       	jmp    801067 <vprintfmt+0x5c0>
+  801156:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80115a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80115e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801162:	eb e5                	jmp    801149 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801164:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801168:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80116c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801170:	e9 59 ff ff ff       	jmp    8010ce <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801175:	4c 89 ee             	mov    %r13,%rsi
+  801178:	bf 25 00 00 00       	mov    $0x25,%edi
+  80117d:	41 ff d6             	call   *%r14
+            break;
+  801180:	e9 53 f9 ff ff       	jmp    800ad8 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801185:	4c 89 ee             	mov    %r13,%rsi
+  801188:	bf 25 00 00 00       	mov    $0x25,%edi
+  80118d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801190:	48 83 eb 01          	sub    $0x1,%rbx
+  801194:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801198:	75 f6                	jne    801190 <vprintfmt+0x6e9>
+  80119a:	e9 39 f9 ff ff       	jmp    800ad8 <vprintfmt+0x31>
+}
+  80119f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8011a3:	5b                   	pop    %rbx
+  8011a4:	41 5c                	pop    %r12
+  8011a6:	41 5d                	pop    %r13
+  8011a8:	41 5e                	pop    %r14
+  8011aa:	41 5f                	pop    %r15
+  8011ac:	5d                   	pop    %rbp
+  8011ad:	c3                   	ret
+
+00000000008011ae <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  8011ae:	55                   	push   %rbp
+  8011af:	48 89 e5             	mov    %rsp,%rbp
+  8011b2:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  8011b6:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  8011ba:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  8011bf:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  8011c3:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  8011ca:	48 85 ff             	test   %rdi,%rdi
+  8011cd:	74 2b                	je     8011fa <vsnprintf+0x4c>
+  8011cf:	48 85 f6             	test   %rsi,%rsi
+  8011d2:	74 26                	je     8011fa <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  8011d4:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8011d8:	48 bf 52 0a 80 00 00 	movabs $0x800a52,%rdi
+  8011df:	00 00 00 
+  8011e2:	48 b8 a7 0a 80 00 00 	movabs $0x800aa7,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  8011ee:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  8011f2:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8011f5:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8011f8:	c9                   	leave
+  8011f9:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8011fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8011ff:	eb f7                	jmp    8011f8 <vsnprintf+0x4a>
+
+0000000000801201 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801201:	55                   	push   %rbp
+  801202:	48 89 e5             	mov    %rsp,%rbp
+  801205:	48 83 ec 50          	sub    $0x50,%rsp
+  801209:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80120d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801211:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801215:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80121c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801220:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801224:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  801228:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  80122c:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801230:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  801237:	00 00 00 
+  80123a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  80123c:	c9                   	leave
+  80123d:	c3                   	ret
+
+000000000080123e <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  80123e:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801241:	74 10                	je     801253 <strlen+0x15>
+    size_t n = 0;
+  801243:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  801248:	48 83 c0 01          	add    $0x1,%rax
+  80124c:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801250:	75 f6                	jne    801248 <strlen+0xa>
+  801252:	c3                   	ret
+    size_t n = 0;
+  801253:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801258:	c3                   	ret
+
+0000000000801259 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801259:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  80125c:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801261:	48 85 f6             	test   %rsi,%rsi
+  801264:	74 11                	je     801277 <strnlen+0x1e>
+  801266:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80126a:	74 0c                	je     801278 <strnlen+0x1f>
+  80126c:	48 83 c2 01          	add    $0x1,%rdx
+  801270:	48 39 d0             	cmp    %rdx,%rax
+  801273:	75 f1                	jne    801266 <strnlen+0xd>
+  801275:	eb 04                	jmp    80127b <strnlen+0x22>
+  801277:	c3                   	ret
+  801278:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  80127b:	c3                   	ret
+
+000000000080127c <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  80127c:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80127f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801284:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801288:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80128b:	48 83 c2 01          	add    $0x1,%rdx
+  80128f:	84 c9                	test   %cl,%cl
+  801291:	75 f1                	jne    801284 <strcpy+0x8>
+        ;
+    return res;
+}
+  801293:	c3                   	ret
+
+0000000000801294 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801294:	55                   	push   %rbp
+  801295:	48 89 e5             	mov    %rsp,%rbp
+  801298:	41 54                	push   %r12
+  80129a:	53                   	push   %rbx
+  80129b:	48 89 fb             	mov    %rdi,%rbx
+  80129e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8012a1:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  8012a8:	00 00 00 
+  8012ab:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8012ad:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8012b1:	4c 89 e6             	mov    %r12,%rsi
+  8012b4:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  8012bb:	00 00 00 
+  8012be:	ff d0                	call   *%rax
+    return dst;
+}
+  8012c0:	48 89 d8             	mov    %rbx,%rax
+  8012c3:	5b                   	pop    %rbx
+  8012c4:	41 5c                	pop    %r12
+  8012c6:	5d                   	pop    %rbp
+  8012c7:	c3                   	ret
+
+00000000008012c8 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8012c8:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8012cb:	48 85 d2             	test   %rdx,%rdx
+  8012ce:	74 1f                	je     8012ef <strncpy+0x27>
+  8012d0:	48 01 fa             	add    %rdi,%rdx
+  8012d3:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  8012d6:	48 83 c1 01          	add    $0x1,%rcx
+  8012da:	44 0f b6 06          	movzbl (%rsi),%r8d
+  8012de:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  8012e2:	41 80 f8 01          	cmp    $0x1,%r8b
+  8012e6:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  8012ea:	48 39 ca             	cmp    %rcx,%rdx
+  8012ed:	75 e7                	jne    8012d6 <strncpy+0xe>
+    }
+    return ret;
+}
+  8012ef:	c3                   	ret
+
+00000000008012f0 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  8012f0:	48 89 f8             	mov    %rdi,%rax
+  8012f3:	48 85 d2             	test   %rdx,%rdx
+  8012f6:	74 24                	je     80131c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8012f8:	48 83 ea 01          	sub    $0x1,%rdx
+  8012fc:	74 1b                	je     801319 <strlcpy+0x29>
+  8012fe:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801302:	0f b6 16             	movzbl (%rsi),%edx
+  801305:	84 d2                	test   %dl,%dl
+  801307:	74 10                	je     801319 <strlcpy+0x29>
+            *dst++ = *src++;
+  801309:	48 83 c6 01          	add    $0x1,%rsi
+  80130d:	48 83 c0 01          	add    $0x1,%rax
+  801311:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801314:	48 39 c8             	cmp    %rcx,%rax
+  801317:	75 e9                	jne    801302 <strlcpy+0x12>
+        *dst = '\0';
+  801319:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80131c:	48 29 f8             	sub    %rdi,%rax
+}
+  80131f:	c3                   	ret
+
+0000000000801320 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801320:	0f b6 07             	movzbl (%rdi),%eax
+  801323:	84 c0                	test   %al,%al
+  801325:	74 13                	je     80133a <strcmp+0x1a>
+  801327:	38 06                	cmp    %al,(%rsi)
+  801329:	75 0f                	jne    80133a <strcmp+0x1a>
+  80132b:	48 83 c7 01          	add    $0x1,%rdi
+  80132f:	48 83 c6 01          	add    $0x1,%rsi
+  801333:	0f b6 07             	movzbl (%rdi),%eax
+  801336:	84 c0                	test   %al,%al
+  801338:	75 ed                	jne    801327 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80133a:	0f b6 c0             	movzbl %al,%eax
+  80133d:	0f b6 16             	movzbl (%rsi),%edx
+  801340:	29 d0                	sub    %edx,%eax
+}
+  801342:	c3                   	ret
+
+0000000000801343 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801343:	48 85 d2             	test   %rdx,%rdx
+  801346:	74 1f                	je     801367 <strncmp+0x24>
+  801348:	0f b6 07             	movzbl (%rdi),%eax
+  80134b:	84 c0                	test   %al,%al
+  80134d:	74 1e                	je     80136d <strncmp+0x2a>
+  80134f:	3a 06                	cmp    (%rsi),%al
+  801351:	75 1a                	jne    80136d <strncmp+0x2a>
+  801353:	48 83 c7 01          	add    $0x1,%rdi
+  801357:	48 83 c6 01          	add    $0x1,%rsi
+  80135b:	48 83 ea 01          	sub    $0x1,%rdx
+  80135f:	75 e7                	jne    801348 <strncmp+0x5>
+
+    if (!n) return 0;
+  801361:	b8 00 00 00 00       	mov    $0x0,%eax
+  801366:	c3                   	ret
+  801367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136c:	c3                   	ret
+  80136d:	48 85 d2             	test   %rdx,%rdx
+  801370:	74 09                	je     80137b <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801372:	0f b6 07             	movzbl (%rdi),%eax
+  801375:	0f b6 16             	movzbl (%rsi),%edx
+  801378:	29 d0                	sub    %edx,%eax
+  80137a:	c3                   	ret
+    if (!n) return 0;
+  80137b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801380:	c3                   	ret
+
+0000000000801381 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801381:	0f b6 17             	movzbl (%rdi),%edx
+  801384:	84 d2                	test   %dl,%dl
+  801386:	74 18                	je     8013a0 <strchr+0x1f>
+        if (*str == c) {
+  801388:	0f be d2             	movsbl %dl,%edx
+  80138b:	39 f2                	cmp    %esi,%edx
+  80138d:	74 17                	je     8013a6 <strchr+0x25>
+    for (; *str; str++) {
+  80138f:	48 83 c7 01          	add    $0x1,%rdi
+  801393:	0f b6 17             	movzbl (%rdi),%edx
+  801396:	84 d2                	test   %dl,%dl
+  801398:	75 ee                	jne    801388 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80139a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139f:	c3                   	ret
+  8013a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a5:	c3                   	ret
+  8013a6:	48 89 f8             	mov    %rdi,%rax
+}
+  8013a9:	c3                   	ret
+
+00000000008013aa <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8013aa:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8013ad:	0f b6 17             	movzbl (%rdi),%edx
+  8013b0:	84 d2                	test   %dl,%dl
+  8013b2:	74 13                	je     8013c7 <strfind+0x1d>
+  8013b4:	0f be d2             	movsbl %dl,%edx
+  8013b7:	39 f2                	cmp    %esi,%edx
+  8013b9:	74 0b                	je     8013c6 <strfind+0x1c>
+  8013bb:	48 83 c0 01          	add    $0x1,%rax
+  8013bf:	0f b6 10             	movzbl (%rax),%edx
+  8013c2:	84 d2                	test   %dl,%dl
+  8013c4:	75 ee                	jne    8013b4 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8013c6:	c3                   	ret
+  8013c7:	c3                   	ret
+
+00000000008013c8 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8013c8:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8013cb:	48 89 f8             	mov    %rdi,%rax
+  8013ce:	48 f7 d8             	neg    %rax
+  8013d1:	83 e0 07             	and    $0x7,%eax
+  8013d4:	49 89 d1             	mov    %rdx,%r9
+  8013d7:	49 29 c1             	sub    %rax,%r9
+  8013da:	78 36                	js     801412 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8013dc:	40 0f b6 c6          	movzbl %sil,%eax
+  8013e0:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8013e7:	01 01 01 
+  8013ea:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8013ee:	40 f6 c7 07          	test   $0x7,%dil
+  8013f2:	75 38                	jne    80142c <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8013f4:	4c 89 c9             	mov    %r9,%rcx
+  8013f7:	48 c1 f9 03          	sar    $0x3,%rcx
+  8013fb:	74 0c                	je     801409 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8013fd:	fc                   	cld
+  8013fe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801401:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801405:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801409:	4d 85 c9             	test   %r9,%r9
+  80140c:	75 45                	jne    801453 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80140e:	4c 89 c0             	mov    %r8,%rax
+  801411:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801412:	48 85 d2             	test   %rdx,%rdx
+  801415:	74 f7                	je     80140e <memset+0x46>
+  801417:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80141a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80141d:	48 83 c0 01          	add    $0x1,%rax
+  801421:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801425:	48 39 c2             	cmp    %rax,%rdx
+  801428:	75 f3                	jne    80141d <memset+0x55>
+  80142a:	eb e2                	jmp    80140e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  80142c:	40 f6 c7 01          	test   $0x1,%dil
+  801430:	74 06                	je     801438 <memset+0x70>
+  801432:	88 07                	mov    %al,(%rdi)
+  801434:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801438:	40 f6 c7 02          	test   $0x2,%dil
+  80143c:	74 07                	je     801445 <memset+0x7d>
+  80143e:	66 89 07             	mov    %ax,(%rdi)
+  801441:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801445:	40 f6 c7 04          	test   $0x4,%dil
+  801449:	74 a9                	je     8013f4 <memset+0x2c>
+  80144b:	89 07                	mov    %eax,(%rdi)
+  80144d:	48 83 c7 04          	add    $0x4,%rdi
+  801451:	eb a1                	jmp    8013f4 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801453:	41 f6 c1 04          	test   $0x4,%r9b
+  801457:	74 06                	je     80145f <memset+0x97>
+  801459:	89 07                	mov    %eax,(%rdi)
+  80145b:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80145f:	41 f6 c1 02          	test   $0x2,%r9b
+  801463:	74 07                	je     80146c <memset+0xa4>
+  801465:	66 89 07             	mov    %ax,(%rdi)
+  801468:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80146c:	41 f6 c1 01          	test   $0x1,%r9b
+  801470:	74 9c                	je     80140e <memset+0x46>
+  801472:	88 07                	mov    %al,(%rdi)
+  801474:	eb 98                	jmp    80140e <memset+0x46>
+
+0000000000801476 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801476:	48 89 f8             	mov    %rdi,%rax
+  801479:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80147c:	48 39 fe             	cmp    %rdi,%rsi
+  80147f:	73 3b                	jae    8014bc <memmove+0x46>
+  801481:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801485:	48 39 d7             	cmp    %rdx,%rdi
+  801488:	73 32                	jae    8014bc <memmove+0x46>
+        s += n;
+        d += n;
+  80148a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80148e:	48 89 d6             	mov    %rdx,%rsi
+  801491:	48 09 fe             	or     %rdi,%rsi
+  801494:	48 09 ce             	or     %rcx,%rsi
+  801497:	40 f6 c6 07          	test   $0x7,%sil
+  80149b:	75 12                	jne    8014af <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80149d:	48 83 ef 08          	sub    $0x8,%rdi
+  8014a1:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8014a5:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014a9:	fd                   	std
+  8014aa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8014ad:	fc                   	cld
+  8014ae:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8014af:	48 83 ef 01          	sub    $0x1,%rdi
+  8014b3:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8014b7:	fd                   	std
+  8014b8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8014ba:	eb f1                	jmp    8014ad <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8014bc:	48 89 f2             	mov    %rsi,%rdx
+  8014bf:	48 09 c2             	or     %rax,%rdx
+  8014c2:	48 09 ca             	or     %rcx,%rdx
+  8014c5:	f6 c2 07             	test   $0x7,%dl
+  8014c8:	75 0c                	jne    8014d6 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8014ca:	48 c1 e9 03          	shr    $0x3,%rcx
+  8014ce:	48 89 c7             	mov    %rax,%rdi
+  8014d1:	fc                   	cld
+  8014d2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8014d5:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8014d6:	48 89 c7             	mov    %rax,%rdi
+  8014d9:	fc                   	cld
+  8014da:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8014dc:	c3                   	ret
+
+00000000008014dd <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8014dd:	55                   	push   %rbp
+  8014de:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8014e1:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  8014e8:	00 00 00 
+  8014eb:	ff d0                	call   *%rax
+}
+  8014ed:	5d                   	pop    %rbp
+  8014ee:	c3                   	ret
+
+00000000008014ef <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8014ef:	55                   	push   %rbp
+  8014f0:	48 89 e5             	mov    %rsp,%rbp
+  8014f3:	41 57                	push   %r15
+  8014f5:	41 56                	push   %r14
+  8014f7:	41 55                	push   %r13
+  8014f9:	41 54                	push   %r12
+  8014fb:	53                   	push   %rbx
+  8014fc:	48 83 ec 08          	sub    $0x8,%rsp
+  801500:	49 89 fe             	mov    %rdi,%r14
+  801503:	49 89 f7             	mov    %rsi,%r15
+  801506:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801509:	48 89 f7             	mov    %rsi,%rdi
+  80150c:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  801513:	00 00 00 
+  801516:	ff d0                	call   *%rax
+  801518:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80151b:	48 89 de             	mov    %rbx,%rsi
+  80151e:	4c 89 f7             	mov    %r14,%rdi
+  801521:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  801528:	00 00 00 
+  80152b:	ff d0                	call   *%rax
+  80152d:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801530:	48 39 c3             	cmp    %rax,%rbx
+  801533:	74 36                	je     80156b <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801535:	48 89 d8             	mov    %rbx,%rax
+  801538:	4c 29 e8             	sub    %r13,%rax
+  80153b:	49 39 c4             	cmp    %rax,%r12
+  80153e:	73 31                	jae    801571 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801540:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801545:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801549:	4c 89 fe             	mov    %r15,%rsi
+  80154c:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  801553:	00 00 00 
+  801556:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801558:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80155c:	48 83 c4 08          	add    $0x8,%rsp
+  801560:	5b                   	pop    %rbx
+  801561:	41 5c                	pop    %r12
+  801563:	41 5d                	pop    %r13
+  801565:	41 5e                	pop    %r14
+  801567:	41 5f                	pop    %r15
+  801569:	5d                   	pop    %rbp
+  80156a:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80156b:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80156f:	eb eb                	jmp    80155c <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801571:	48 83 eb 01          	sub    $0x1,%rbx
+  801575:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801579:	48 89 da             	mov    %rbx,%rdx
+  80157c:	4c 89 fe             	mov    %r15,%rsi
+  80157f:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  801586:	00 00 00 
+  801589:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80158b:	49 01 de             	add    %rbx,%r14
+  80158e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801593:	eb c3                	jmp    801558 <strlcat+0x69>
+
+0000000000801595 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801595:	48 85 d2             	test   %rdx,%rdx
+  801598:	74 2d                	je     8015c7 <memcmp+0x32>
+  80159a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80159f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8015a3:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8015a8:	44 38 c1             	cmp    %r8b,%cl
+  8015ab:	75 0f                	jne    8015bc <memcmp+0x27>
+    while (n-- > 0) {
+  8015ad:	48 83 c0 01          	add    $0x1,%rax
+  8015b1:	48 39 c2             	cmp    %rax,%rdx
+  8015b4:	75 e9                	jne    80159f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8015b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bb:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8015bc:	0f b6 c1             	movzbl %cl,%eax
+  8015bf:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8015c3:	44 29 c0             	sub    %r8d,%eax
+  8015c6:	c3                   	ret
+    return 0;
+  8015c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8015cc:	c3                   	ret
+
+00000000008015cd <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8015cd:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8015d1:	48 39 c7             	cmp    %rax,%rdi
+  8015d4:	73 0f                	jae    8015e5 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8015d6:	40 38 37             	cmp    %sil,(%rdi)
+  8015d9:	74 0e                	je     8015e9 <memfind+0x1c>
+    for (; src < end; src++) {
+  8015db:	48 83 c7 01          	add    $0x1,%rdi
+  8015df:	48 39 f8             	cmp    %rdi,%rax
+  8015e2:	75 f2                	jne    8015d6 <memfind+0x9>
+  8015e4:	c3                   	ret
+  8015e5:	48 89 f8             	mov    %rdi,%rax
+  8015e8:	c3                   	ret
+  8015e9:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8015ec:	c3                   	ret
+
+00000000008015ed <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8015ed:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8015f0:	0f b6 37             	movzbl (%rdi),%esi
+  8015f3:	40 80 fe 20          	cmp    $0x20,%sil
+  8015f7:	74 06                	je     8015ff <strtol+0x12>
+  8015f9:	40 80 fe 09          	cmp    $0x9,%sil
+  8015fd:	75 13                	jne    801612 <strtol+0x25>
+  8015ff:	48 83 c7 01          	add    $0x1,%rdi
+  801603:	0f b6 37             	movzbl (%rdi),%esi
+  801606:	40 80 fe 20          	cmp    $0x20,%sil
+  80160a:	74 f3                	je     8015ff <strtol+0x12>
+  80160c:	40 80 fe 09          	cmp    $0x9,%sil
+  801610:	74 ed                	je     8015ff <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801612:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801615:	83 e0 fd             	and    $0xfffffffd,%eax
+  801618:	3c 01                	cmp    $0x1,%al
+  80161a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80161e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801624:	75 0f                	jne    801635 <strtol+0x48>
+  801626:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801629:	74 14                	je     80163f <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80162b:	85 d2                	test   %edx,%edx
+  80162d:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801632:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80163a:	4c 63 ca             	movslq %edx,%r9
+  80163d:	eb 36                	jmp    801675 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80163f:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801643:	74 0f                	je     801654 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801645:	85 d2                	test   %edx,%edx
+  801647:	75 ec                	jne    801635 <strtol+0x48>
+        s++;
+  801649:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80164d:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801652:	eb e1                	jmp    801635 <strtol+0x48>
+        s += 2;
+  801654:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801658:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80165d:	eb d6                	jmp    801635 <strtol+0x48>
+            dig -= '0';
+  80165f:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801662:	44 0f b6 c1          	movzbl %cl,%r8d
+  801666:	41 39 d0             	cmp    %edx,%r8d
+  801669:	7d 21                	jge    80168c <strtol+0x9f>
+        val = val * base + dig;
+  80166b:	49 0f af c1          	imul   %r9,%rax
+  80166f:	0f b6 c9             	movzbl %cl,%ecx
+  801672:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801675:	48 83 c7 01          	add    $0x1,%rdi
+  801679:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80167d:	80 f9 39             	cmp    $0x39,%cl
+  801680:	76 dd                	jbe    80165f <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801682:	80 f9 7b             	cmp    $0x7b,%cl
+  801685:	77 05                	ja     80168c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801687:	83 e9 57             	sub    $0x57,%ecx
+  80168a:	eb d6                	jmp    801662 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80168c:	4d 85 d2             	test   %r10,%r10
+  80168f:	74 03                	je     801694 <strtol+0xa7>
+  801691:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801694:	48 89 c2             	mov    %rax,%rdx
+  801697:	48 f7 da             	neg    %rdx
+  80169a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80169e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8016a2:	c3                   	ret
+
+00000000008016a3 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8016bf:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8016c1:	c3                   	ret
+
+00000000008016c2 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016c2:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016cc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e8:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016ea:	c3                   	ret
+
+00000000008016eb <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8016eb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ee:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016f3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801703:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801709:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80170f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801711:	48 85 c0             	test   %rax,%rax
+  801714:	7f 01                	jg     801717 <sys_env_destroy+0x2c>
+}
+  801716:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801717:	55                   	push   %rbp
+  801718:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80171b:	49 89 c0             	mov    %rax,%r8
+  80171e:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801723:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  80172a:	00 00 00 
+  80172d:	be 29 00 00 00       	mov    $0x29,%esi
+  801732:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801739:	00 00 00 
+  80173c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801741:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801748:	00 00 00 
+  80174b:	41 ff d1             	call   *%r9
+
+000000000080174e <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80174e:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801753:	bf 00 00 00 00       	mov    $0x0,%edi
+  801758:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80175d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801762:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801768:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80176e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801774:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801776:	c3                   	ret
+
+0000000000801777 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801777:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80177c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801781:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801786:	ba 00 00 00 00       	mov    $0x0,%edx
+  80178b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801791:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801797:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80179d:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80179f:	c3                   	ret
+
+00000000008017a0 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017a0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017a5:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8017ac:	00 00 00 
+  8017af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017c1:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8017c3:	c3                   	ret
+
+00000000008017c4 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8017c4:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8017c7:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017d8:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8017da:	c3                   	ret
+
+00000000008017db <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8017db:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017de:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017e3:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017f2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017f4:	48 85 c0             	test   %rax,%rax
+  8017f7:	7f 01                	jg     8017fa <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8017f9:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8017fa:	55                   	push   %rbp
+  8017fb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017fe:	49 89 c0             	mov    %rax,%r8
+  801801:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801806:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  80180d:	00 00 00 
+  801810:	be 29 00 00 00       	mov    $0x29,%esi
+  801815:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  80181c:	00 00 00 
+  80181f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801824:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  80182b:	00 00 00 
+  80182e:	41 ff d1             	call   *%r9
+
+0000000000801831 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801831:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801834:	48 63 d2             	movslq %edx,%rdx
+  801837:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80183a:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80183f:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801842:	0f 05                	syscall
+    if (check && ret > 0) {
+  801844:	48 85 c0             	test   %rax,%rax
+  801847:	7f 01                	jg     80184a <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801849:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80184a:	55                   	push   %rbp
+  80184b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80184e:	49 89 c0             	mov    %rax,%r8
+  801851:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801856:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  80185d:	00 00 00 
+  801860:	be 29 00 00 00       	mov    $0x29,%esi
+  801865:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  80186c:	00 00 00 
+  80186f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801874:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  80187b:	00 00 00 
+  80187e:	41 ff d1             	call   *%r9
+
+0000000000801881 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801881:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801884:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801889:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80188f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801895:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80189b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80189d:	48 85 c0             	test   %rax,%rax
+  8018a0:	7f 01                	jg     8018a3 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8018a2:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8018a3:	55                   	push   %rbp
+  8018a4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a7:	49 89 c0             	mov    %rax,%r8
+  8018aa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018af:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  8018b6:	00 00 00 
+  8018b9:	be 29 00 00 00       	mov    $0x29,%esi
+  8018be:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  8018c5:	00 00 00 
+  8018c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018cd:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  8018d4:	00 00 00 
+  8018d7:	41 ff d1             	call   *%r9
+
+00000000008018da <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8018da:	48 63 f6             	movslq %esi,%rsi
+  8018dd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018e0:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018fc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018fe:	48 85 c0             	test   %rax,%rax
+  801901:	7f 01                	jg     801904 <sys_env_set_status+0x2a>
+}
+  801903:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801904:	55                   	push   %rbp
+  801905:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801908:	49 89 c0             	mov    %rax,%r8
+  80190b:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801910:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  801917:	00 00 00 
+  80191a:	be 29 00 00 00       	mov    $0x29,%esi
+  80191f:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801926:	00 00 00 
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801935:	00 00 00 
+  801938:	41 ff d1             	call   *%r9
+
+000000000080193b <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80193b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80193e:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801943:	ba 00 00 00 00       	mov    $0x0,%edx
+  801948:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80194e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801954:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80195a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80195c:	48 85 c0             	test   %rax,%rax
+  80195f:	7f 01                	jg     801962 <sys_env_set_trapframe+0x27>
+}
+  801961:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801962:	55                   	push   %rbp
+  801963:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801966:	49 89 c0             	mov    %rax,%r8
+  801969:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80196e:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  801975:	00 00 00 
+  801978:	be 29 00 00 00       	mov    $0x29,%esi
+  80197d:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801984:	00 00 00 
+  801987:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198c:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801993:	00 00 00 
+  801996:	41 ff d1             	call   *%r9
+
+0000000000801999 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801999:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80199c:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019b8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8019ba:	48 85 c0             	test   %rax,%rax
+  8019bd:	7f 01                	jg     8019c0 <sys_env_set_pgfault_upcall+0x27>
+}
+  8019bf:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8019c0:	55                   	push   %rbp
+  8019c1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019c4:	49 89 c0             	mov    %rax,%r8
+  8019c7:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8019cc:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  8019d3:	00 00 00 
+  8019d6:	be 29 00 00 00       	mov    $0x29,%esi
+  8019db:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  8019e2:	00 00 00 
+  8019e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019ea:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  8019f1:	00 00 00 
+  8019f4:	41 ff d1             	call   *%r9
+
+00000000008019f7 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019f7:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019fa:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019fd:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a02:	4d 63 c0             	movslq %r8d,%r8
+  801a05:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a0b:	0f 05                	syscall
+}
+  801a0d:	c3                   	ret
+
+0000000000801a0e <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801a0e:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801a11:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801a14:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a19:	4d 63 c0             	movslq %r8d,%r8
+  801a1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a22:	0f 05                	syscall
+}
+  801a24:	c3                   	ret
+
+0000000000801a25 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a25:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a2a:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a2d:	45 89 c0             	mov    %r8d,%r8d
+  801a30:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a36:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a38:	48 85 c0             	test   %rax,%rax
+  801a3b:	7f 01                	jg     801a3e <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801a3d:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801a3e:	55                   	push   %rbp
+  801a3f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a42:	49 89 c0             	mov    %rax,%r8
+  801a45:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801a4a:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  801a51:	00 00 00 
+  801a54:	be 29 00 00 00       	mov    $0x29,%esi
+  801a59:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801a60:	00 00 00 
+  801a63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a68:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801a6f:	00 00 00 
+  801a72:	41 ff d1             	call   *%r9
+
+0000000000801a75 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801a75:	55                   	push   %rbp
+  801a76:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801a79:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a7f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a89:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801a90:	00 00 00 
+  801a93:	ff d0                	call   *%rax
+}
+  801a95:	5d                   	pop    %rbp
+  801a96:	c3                   	ret
+
+0000000000801a97 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a97:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801aa6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801aab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ab1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ab7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801abd:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801abf:	c3                   	ret
+
+0000000000801ac0 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801ac0:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801ac5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801aca:	ba 00 00 00 00       	mov    $0x0,%edx
+  801acf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ad5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801adb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ae1:	0f 05                	syscall
+    if (check && ret > 0) {
+  801ae3:	48 85 c0             	test   %rax,%rax
+  801ae6:	7f 01                	jg     801ae9 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801ae8:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801ae9:	55                   	push   %rbp
+  801aea:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801aed:	49 89 c0             	mov    %rax,%r8
+  801af0:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801af5:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  801afc:	00 00 00 
+  801aff:	be 29 00 00 00       	mov    $0x29,%esi
+  801b04:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801b0b:	00 00 00 
+  801b0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b13:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801b1a:	00 00 00 
+  801b1d:	41 ff d1             	call   *%r9
+
+0000000000801b20 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801b20:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801b25:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b34:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b3a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b40:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b46:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801b48:	c3                   	ret
+
+0000000000801b49 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801b49:	89 d2                	mov    %edx,%edx
+  801b4b:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801b4d:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b52:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b64:	0f 05                	syscall
+}
+  801b66:	c3                   	ret
+
+0000000000801b67 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b67:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b6a:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b6f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b74:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b7a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b80:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b86:	0f 05                	syscall
+}
+  801b88:	c3                   	ret
+
+0000000000801b89 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801b89:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b8c:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b96:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ba2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ba8:	0f 05                	syscall
+}
+  801baa:	c3                   	ret
+
+0000000000801bab <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801bab:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801bae:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801bb3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801bb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bbd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801bc3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801bc9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801bcf:	0f 05                	syscall
+    if (check && ret > 0) {
+  801bd1:	48 85 c0             	test   %rax,%rax
+  801bd4:	7f 01                	jg     801bd7 <sys_irq_ack+0x2c>
+}
+  801bd6:	c3                   	ret
+sys_irq_ack(int irq) {
+  801bd7:	55                   	push   %rbp
+  801bd8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801bdb:	49 89 c0             	mov    %rax,%r8
+  801bde:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801be3:	48 ba 38 55 80 00 00 	movabs $0x805538,%rdx
+  801bea:	00 00 00 
+  801bed:	be 29 00 00 00       	mov    $0x29,%esi
+  801bf2:	48 bf 57 55 80 00 00 	movabs $0x805557,%rdi
+  801bf9:	00 00 00 
+  801bfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c01:	49 b9 07 08 80 00 00 	movabs $0x800807,%r9
+  801c08:	00 00 00 
+  801c0b:	41 ff d1             	call   *%r9
+
+0000000000801c0e <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801c0e:	55                   	push   %rbp
+  801c0f:	48 89 e5             	mov    %rsp,%rbp
+  801c12:	41 55                	push   %r13
+  801c14:	41 54                	push   %r12
+  801c16:	53                   	push   %rbx
+  801c17:	48 83 ec 08          	sub    $0x8,%rsp
+  801c1b:	49 89 fd             	mov    %rdi,%r13
+  801c1e:	48 89 f7             	mov    %rsi,%rdi
+  801c21:	48 89 d3             	mov    %rdx,%rbx
+  801c24:	49 89 cc             	mov    %rcx,%r12
+  801c27:	4c 89 c2             	mov    %r8,%rdx
+  801c2a:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801c2d:	48 85 f6             	test   %rsi,%rsi
+  801c30:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801c37:	00 00 00 
+  801c3a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  801c3e:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c43:	48 85 db             	test   %rbx,%rbx
+  801c46:	74 03                	je     801c4b <ipc_recv_futex+0x3d>
+  801c48:	48 8b 33             	mov    (%rbx),%rsi
+  801c4b:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  801c4f:	48 b8 25 1a 80 00 00 	movabs $0x801a25,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+    if (res < 0) {
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 75                	js     801cd4 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  801c5f:	4d 85 ed             	test   %r13,%r13
+  801c62:	74 14                	je     801c78 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  801c64:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801c6b:	00 00 00 
+  801c6e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801c74:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801c78:	4d 85 e4             	test   %r12,%r12
+  801c7b:	74 14                	je     801c91 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  801c7d:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801c84:	00 00 00 
+  801c87:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  801c8d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  801c91:	48 85 db             	test   %rbx,%rbx
+  801c94:	74 23                	je     801cb9 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801c96:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801c9d:	00 00 00 
+  801ca0:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801ca6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cab:	85 c9                	test   %ecx,%ecx
+  801cad:	74 07                	je     801cb6 <ipc_recv_futex+0xa8>
+  801caf:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801cb6:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801cb9:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801cc0:	00 00 00 
+  801cc3:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801cc9:	48 83 c4 08          	add    $0x8,%rsp
+  801ccd:	5b                   	pop    %rbx
+  801cce:	41 5c                	pop    %r12
+  801cd0:	41 5d                	pop    %r13
+  801cd2:	5d                   	pop    %rbp
+  801cd3:	c3                   	ret
+        if (from_env_store != NULL) {
+  801cd4:	4d 85 ed             	test   %r13,%r13
+  801cd7:	74 08                	je     801ce1 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801cd9:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801ce0:	00 
+        if (perm_store != NULL) {
+  801ce1:	4d 85 e4             	test   %r12,%r12
+  801ce4:	74 08                	je     801cee <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801ce6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801ced:	00 
+        if (size != NULL) {
+  801cee:	48 85 db             	test   %rbx,%rbx
+  801cf1:	74 d6                	je     801cc9 <ipc_recv_futex+0xbb>
+            *size = 0;
+  801cf3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801cfa:	eb cd                	jmp    801cc9 <ipc_recv_futex+0xbb>
+
+0000000000801cfc <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801cfc:	55                   	push   %rbp
+  801cfd:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  801d00:	48 83 ec 08          	sub    $0x8,%rsp
+  801d04:	6a 00                	push   $0x0
+  801d06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801d0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d12:	48 b8 0e 1c 80 00 00 	movabs $0x801c0e,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+}
+  801d1e:	c9                   	leave
+  801d1f:	c3                   	ret
+
+0000000000801d20 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801d20:	55                   	push   %rbp
+  801d21:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801d24:	48 85 d2             	test   %rdx,%rdx
+  801d27:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801d2e:	00 00 00 
+  801d31:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801d35:	89 f6                	mov    %esi,%esi
+  801d37:	48 b8 0e 1a 80 00 00 	movabs $0x801a0e,%rax
+  801d3e:	00 00 00 
+  801d41:	ff d0                	call   *%rax
+    if (res < 0) {
+  801d43:	85 c0                	test   %eax,%eax
+  801d45:	78 02                	js     801d49 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801d47:	5d                   	pop    %rbp
+  801d48:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801d49:	89 c1                	mov    %eax,%ecx
+  801d4b:	48 ba 65 55 80 00 00 	movabs $0x805565,%rdx
+  801d52:	00 00 00 
+  801d55:	be 50 00 00 00       	mov    $0x50,%esi
+  801d5a:	48 bf 79 55 80 00 00 	movabs $0x805579,%rdi
+  801d61:	00 00 00 
+  801d64:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d69:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  801d70:	00 00 00 
+  801d73:	41 ff d0             	call   *%r8
+
+0000000000801d76 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801d76:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801d7b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801d82:	00 00 00 
+  801d85:	48 89 d0             	mov    %rdx,%rax
+  801d88:	48 c1 e0 04          	shl    $0x4,%rax
+  801d8c:	48 29 d0             	sub    %rdx,%rax
+  801d8f:	48 c1 e0 05          	shl    $0x5,%rax
+  801d93:	48 01 c8             	add    %rcx,%rax
+  801d96:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801d9c:	39 f8                	cmp    %edi,%eax
+  801d9e:	74 13                	je     801db3 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  801da0:	48 83 c2 01          	add    $0x1,%rdx
+  801da4:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801dab:	75 d8                	jne    801d85 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801dad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801db2:	c3                   	ret
+            return envs[i].env_id;
+  801db3:	48 89 d0             	mov    %rdx,%rax
+  801db6:	48 c1 e0 04          	shl    $0x4,%rax
+  801dba:	48 29 d0             	sub    %rdx,%rax
+  801dbd:	48 c1 e0 05          	shl    $0x5,%rax
+  801dc1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801dc8:	00 00 00 
+  801dcb:	48 01 d0             	add    %rdx,%rax
+  801dce:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801dd4:	c3                   	ret
+
+0000000000801dd5 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801dd5:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801ddc:	ff ff ff 
+  801ddf:	48 01 f8             	add    %rdi,%rax
+  801de2:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801de6:	c3                   	ret
+
+0000000000801de7 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801de7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801dee:	ff ff ff 
+  801df1:	48 01 f8             	add    %rdi,%rax
+  801df4:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801df8:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801dfe:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801e02:	c3                   	ret
+
+0000000000801e03 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801e03:	55                   	push   %rbp
+  801e04:	48 89 e5             	mov    %rsp,%rbp
+  801e07:	41 57                	push   %r15
+  801e09:	41 56                	push   %r14
+  801e0b:	41 55                	push   %r13
+  801e0d:	41 54                	push   %r12
+  801e0f:	53                   	push   %rbx
+  801e10:	48 83 ec 08          	sub    $0x8,%rsp
+  801e14:	49 89 ff             	mov    %rdi,%r15
+  801e17:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801e1c:	49 bd 92 45 80 00 00 	movabs $0x804592,%r13
+  801e23:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801e26:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801e2c:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801e2f:	48 89 df             	mov    %rbx,%rdi
+  801e32:	41 ff d5             	call   *%r13
+  801e35:	83 e0 04             	and    $0x4,%eax
+  801e38:	74 17                	je     801e51 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801e3a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801e41:	4c 39 f3             	cmp    %r14,%rbx
+  801e44:	75 e6                	jne    801e2c <fd_alloc+0x29>
+  801e46:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801e4c:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801e51:	4d 89 27             	mov    %r12,(%r15)
+}
+  801e54:	48 83 c4 08          	add    $0x8,%rsp
+  801e58:	5b                   	pop    %rbx
+  801e59:	41 5c                	pop    %r12
+  801e5b:	41 5d                	pop    %r13
+  801e5d:	41 5e                	pop    %r14
+  801e5f:	41 5f                	pop    %r15
+  801e61:	5d                   	pop    %rbp
+  801e62:	c3                   	ret
+
+0000000000801e63 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801e63:	83 ff 1f             	cmp    $0x1f,%edi
+  801e66:	77 39                	ja     801ea1 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801e68:	55                   	push   %rbp
+  801e69:	48 89 e5             	mov    %rsp,%rbp
+  801e6c:	41 54                	push   %r12
+  801e6e:	53                   	push   %rbx
+  801e6f:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801e72:	48 63 df             	movslq %edi,%rbx
+  801e75:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801e7c:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801e80:	48 89 df             	mov    %rbx,%rdi
+  801e83:	48 b8 92 45 80 00 00 	movabs $0x804592,%rax
+  801e8a:	00 00 00 
+  801e8d:	ff d0                	call   *%rax
+  801e8f:	a8 04                	test   $0x4,%al
+  801e91:	74 14                	je     801ea7 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801e93:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9c:	5b                   	pop    %rbx
+  801e9d:	41 5c                	pop    %r12
+  801e9f:	5d                   	pop    %rbp
+  801ea0:	c3                   	ret
+        return -E_INVAL;
+  801ea1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ea6:	c3                   	ret
+        return -E_INVAL;
+  801ea7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eac:	eb ee                	jmp    801e9c <fd_lookup+0x39>
+
+0000000000801eae <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801eae:	55                   	push   %rbp
+  801eaf:	48 89 e5             	mov    %rsp,%rbp
+  801eb2:	41 54                	push   %r12
+  801eb4:	53                   	push   %rbx
+  801eb5:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801eb8:	48 b8 20 56 80 00 00 	movabs $0x805620,%rax
+  801ebf:	00 00 00 
+  801ec2:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801ec9:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ecc:	39 3b                	cmp    %edi,(%rbx)
+  801ece:	74 47                	je     801f17 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ed0:	48 83 c0 08          	add    $0x8,%rax
+  801ed4:	48 8b 18             	mov    (%rax),%rbx
+  801ed7:	48 85 db             	test   %rbx,%rbx
+  801eda:	75 f0                	jne    801ecc <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801edc:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801ee3:	00 00 00 
+  801ee6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801eec:	89 fa                	mov    %edi,%edx
+  801eee:	48 bf 88 55 80 00 00 	movabs $0x805588,%rdi
+  801ef5:	00 00 00 
+  801ef8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efd:	48 b9 57 09 80 00 00 	movabs $0x800957,%rcx
+  801f04:	00 00 00 
+  801f07:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801f09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801f0e:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801f12:	5b                   	pop    %rbx
+  801f13:	41 5c                	pop    %r12
+  801f15:	5d                   	pop    %rbp
+  801f16:	c3                   	ret
+            return 0;
+  801f17:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f1c:	eb f0                	jmp    801f0e <dev_lookup+0x60>
+
+0000000000801f1e <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801f1e:	55                   	push   %rbp
+  801f1f:	48 89 e5             	mov    %rsp,%rbp
+  801f22:	41 55                	push   %r13
+  801f24:	41 54                	push   %r12
+  801f26:	53                   	push   %rbx
+  801f27:	48 83 ec 18          	sub    $0x18,%rsp
+  801f2b:	48 89 fb             	mov    %rdi,%rbx
+  801f2e:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801f31:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801f38:	ff ff ff 
+  801f3b:	48 01 df             	add    %rbx,%rdi
+  801f3e:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801f42:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f46:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  801f4d:	00 00 00 
+  801f50:	ff d0                	call   *%rax
+  801f52:	41 89 c5             	mov    %eax,%r13d
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 06                	js     801f5f <fd_close+0x41>
+  801f59:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801f5d:	74 1a                	je     801f79 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801f5f:	45 84 e4             	test   %r12b,%r12b
+  801f62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f67:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801f6b:	44 89 e8             	mov    %r13d,%eax
+  801f6e:	48 83 c4 18          	add    $0x18,%rsp
+  801f72:	5b                   	pop    %rbx
+  801f73:	41 5c                	pop    %r12
+  801f75:	41 5d                	pop    %r13
+  801f77:	5d                   	pop    %rbp
+  801f78:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801f79:	8b 3b                	mov    (%rbx),%edi
+  801f7b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f7f:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+  801f8b:	41 89 c5             	mov    %eax,%r13d
+  801f8e:	85 c0                	test   %eax,%eax
+  801f90:	78 1b                	js     801fad <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801f92:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f96:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801f9a:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801fa0:	48 85 c0             	test   %rax,%rax
+  801fa3:	74 08                	je     801fad <fd_close+0x8f>
+  801fa5:	48 89 df             	mov    %rbx,%rdi
+  801fa8:	ff d0                	call   *%rax
+  801faa:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801fad:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801fb2:	48 89 de             	mov    %rbx,%rsi
+  801fb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fba:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  801fc1:	00 00 00 
+  801fc4:	ff d0                	call   *%rax
+    return res;
+  801fc6:	eb a3                	jmp    801f6b <fd_close+0x4d>
+
+0000000000801fc8 <close>:
+
+int
+close(int fdnum) {
+  801fc8:	55                   	push   %rbp
+  801fc9:	48 89 e5             	mov    %rsp,%rbp
+  801fcc:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801fd0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801fd4:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  801fdb:	00 00 00 
+  801fde:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801fe0:	85 c0                	test   %eax,%eax
+  801fe2:	78 15                	js     801ff9 <close+0x31>
+
+    return fd_close(fd, 1);
+  801fe4:	be 01 00 00 00       	mov    $0x1,%esi
+  801fe9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801fed:	48 b8 1e 1f 80 00 00 	movabs $0x801f1e,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+}
+  801ff9:	c9                   	leave
+  801ffa:	c3                   	ret
+
+0000000000801ffb <close_all>:
+
+void
+close_all(void) {
+  801ffb:	55                   	push   %rbp
+  801ffc:	48 89 e5             	mov    %rsp,%rbp
+  801fff:	41 54                	push   %r12
+  802001:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  802002:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802007:	49 bc c8 1f 80 00 00 	movabs $0x801fc8,%r12
+  80200e:	00 00 00 
+  802011:	89 df                	mov    %ebx,%edi
+  802013:	41 ff d4             	call   *%r12
+  802016:	83 c3 01             	add    $0x1,%ebx
+  802019:	83 fb 20             	cmp    $0x20,%ebx
+  80201c:	75 f3                	jne    802011 <close_all+0x16>
+}
+  80201e:	5b                   	pop    %rbx
+  80201f:	41 5c                	pop    %r12
+  802021:	5d                   	pop    %rbp
+  802022:	c3                   	ret
+
+0000000000802023 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+  802027:	41 57                	push   %r15
+  802029:	41 56                	push   %r14
+  80202b:	41 55                	push   %r13
+  80202d:	41 54                	push   %r12
+  80202f:	53                   	push   %rbx
+  802030:	48 83 ec 18          	sub    $0x18,%rsp
+  802034:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802037:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80203b:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	89 c3                	mov    %eax,%ebx
+  802049:	85 c0                	test   %eax,%eax
+  80204b:	0f 88 b8 00 00 00    	js     802109 <dup+0xe6>
+    close(newfdnum);
+  802051:	44 89 e7             	mov    %r12d,%edi
+  802054:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802060:	4d 63 ec             	movslq %r12d,%r13
+  802063:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80206a:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80206e:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802072:	4c 89 ff             	mov    %r15,%rdi
+  802075:	49 be e7 1d 80 00 00 	movabs $0x801de7,%r14
+  80207c:	00 00 00 
+  80207f:	41 ff d6             	call   *%r14
+  802082:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802085:	4c 89 ef             	mov    %r13,%rdi
+  802088:	41 ff d6             	call   *%r14
+  80208b:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80208e:	48 89 df             	mov    %rbx,%rdi
+  802091:	48 b8 92 45 80 00 00 	movabs $0x804592,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80209d:	a8 04                	test   $0x4,%al
+  80209f:	74 2b                	je     8020cc <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8020a1:	41 89 c1             	mov    %eax,%r9d
+  8020a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020aa:	4c 89 f1             	mov    %r14,%rcx
+  8020ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b2:	48 89 de             	mov    %rbx,%rsi
+  8020b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ba:	48 b8 31 18 80 00 00 	movabs $0x801831,%rax
+  8020c1:	00 00 00 
+  8020c4:	ff d0                	call   *%rax
+  8020c6:	89 c3                	mov    %eax,%ebx
+  8020c8:	85 c0                	test   %eax,%eax
+  8020ca:	78 4e                	js     80211a <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8020cc:	4c 89 ff             	mov    %r15,%rdi
+  8020cf:	48 b8 92 45 80 00 00 	movabs $0x804592,%rax
+  8020d6:	00 00 00 
+  8020d9:	ff d0                	call   *%rax
+  8020db:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8020de:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8020e4:	4c 89 e9             	mov    %r13,%rcx
+  8020e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ec:	4c 89 fe             	mov    %r15,%rsi
+  8020ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f4:	48 b8 31 18 80 00 00 	movabs $0x801831,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	89 c3                	mov    %eax,%ebx
+  802102:	85 c0                	test   %eax,%eax
+  802104:	78 14                	js     80211a <dup+0xf7>
+
+    return newfdnum;
+  802106:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  802109:	89 d8                	mov    %ebx,%eax
+  80210b:	48 83 c4 18          	add    $0x18,%rsp
+  80210f:	5b                   	pop    %rbx
+  802110:	41 5c                	pop    %r12
+  802112:	41 5d                	pop    %r13
+  802114:	41 5e                	pop    %r14
+  802116:	41 5f                	pop    %r15
+  802118:	5d                   	pop    %rbp
+  802119:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  80211a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80211f:	4c 89 ee             	mov    %r13,%rsi
+  802122:	bf 00 00 00 00       	mov    $0x0,%edi
+  802127:	49 bc 81 18 80 00 00 	movabs $0x801881,%r12
+  80212e:	00 00 00 
+  802131:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  802134:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802139:	4c 89 f6             	mov    %r14,%rsi
+  80213c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802141:	41 ff d4             	call   *%r12
+    return res;
+  802144:	eb c3                	jmp    802109 <dup+0xe6>
+
+0000000000802146 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802146:	55                   	push   %rbp
+  802147:	48 89 e5             	mov    %rsp,%rbp
+  80214a:	41 56                	push   %r14
+  80214c:	41 55                	push   %r13
+  80214e:	41 54                	push   %r12
+  802150:	53                   	push   %rbx
+  802151:	48 83 ec 10          	sub    $0x10,%rsp
+  802155:	89 fb                	mov    %edi,%ebx
+  802157:	49 89 f4             	mov    %rsi,%r12
+  80215a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80215d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802161:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  802168:	00 00 00 
+  80216b:	ff d0                	call   *%rax
+  80216d:	85 c0                	test   %eax,%eax
+  80216f:	78 4c                	js     8021bd <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802171:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802175:	41 8b 3e             	mov    (%r14),%edi
+  802178:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80217c:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802183:	00 00 00 
+  802186:	ff d0                	call   *%rax
+  802188:	85 c0                	test   %eax,%eax
+  80218a:	78 35                	js     8021c1 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80218c:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802190:	83 e0 03             	and    $0x3,%eax
+  802193:	83 f8 01             	cmp    $0x1,%eax
+  802196:	74 2d                	je     8021c5 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802198:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80219c:	48 8b 40 10          	mov    0x10(%rax),%rax
+  8021a0:	48 85 c0             	test   %rax,%rax
+  8021a3:	74 56                	je     8021fb <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  8021a5:	4c 89 ea             	mov    %r13,%rdx
+  8021a8:	4c 89 e6             	mov    %r12,%rsi
+  8021ab:	4c 89 f7             	mov    %r14,%rdi
+  8021ae:	ff d0                	call   *%rax
+}
+  8021b0:	48 83 c4 10          	add    $0x10,%rsp
+  8021b4:	5b                   	pop    %rbx
+  8021b5:	41 5c                	pop    %r12
+  8021b7:	41 5d                	pop    %r13
+  8021b9:	41 5e                	pop    %r14
+  8021bb:	5d                   	pop    %rbp
+  8021bc:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8021bd:	48 98                	cltq
+  8021bf:	eb ef                	jmp    8021b0 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8021c1:	48 98                	cltq
+  8021c3:	eb eb                	jmp    8021b0 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  8021c5:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8021cc:	00 00 00 
+  8021cf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8021d5:	89 da                	mov    %ebx,%edx
+  8021d7:	48 bf c9 55 80 00 00 	movabs $0x8055c9,%rdi
+  8021de:	00 00 00 
+  8021e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e6:	48 b9 57 09 80 00 00 	movabs $0x800957,%rcx
+  8021ed:	00 00 00 
+  8021f0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8021f2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8021f9:	eb b5                	jmp    8021b0 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8021fb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802202:	eb ac                	jmp    8021b0 <read+0x6a>
+
+0000000000802204 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802204:	55                   	push   %rbp
+  802205:	48 89 e5             	mov    %rsp,%rbp
+  802208:	41 57                	push   %r15
+  80220a:	41 56                	push   %r14
+  80220c:	41 55                	push   %r13
+  80220e:	41 54                	push   %r12
+  802210:	53                   	push   %rbx
+  802211:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802215:	48 85 d2             	test   %rdx,%rdx
+  802218:	74 54                	je     80226e <readn+0x6a>
+  80221a:	41 89 fd             	mov    %edi,%r13d
+  80221d:	49 89 f6             	mov    %rsi,%r14
+  802220:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802223:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802228:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  80222d:	49 bf 46 21 80 00 00 	movabs $0x802146,%r15
+  802234:	00 00 00 
+  802237:	4c 89 e2             	mov    %r12,%rdx
+  80223a:	48 29 f2             	sub    %rsi,%rdx
+  80223d:	4c 01 f6             	add    %r14,%rsi
+  802240:	44 89 ef             	mov    %r13d,%edi
+  802243:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802246:	85 c0                	test   %eax,%eax
+  802248:	78 20                	js     80226a <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80224a:	01 c3                	add    %eax,%ebx
+  80224c:	85 c0                	test   %eax,%eax
+  80224e:	74 08                	je     802258 <readn+0x54>
+  802250:	48 63 f3             	movslq %ebx,%rsi
+  802253:	4c 39 e6             	cmp    %r12,%rsi
+  802256:	72 df                	jb     802237 <readn+0x33>
+    }
+    return res;
+  802258:	48 63 c3             	movslq %ebx,%rax
+}
+  80225b:	48 83 c4 08          	add    $0x8,%rsp
+  80225f:	5b                   	pop    %rbx
+  802260:	41 5c                	pop    %r12
+  802262:	41 5d                	pop    %r13
+  802264:	41 5e                	pop    %r14
+  802266:	41 5f                	pop    %r15
+  802268:	5d                   	pop    %rbp
+  802269:	c3                   	ret
+        if (inc < 0) return inc;
+  80226a:	48 98                	cltq
+  80226c:	eb ed                	jmp    80225b <readn+0x57>
+    int inc = 1, res = 0;
+  80226e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802273:	eb e3                	jmp    802258 <readn+0x54>
+
+0000000000802275 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802275:	55                   	push   %rbp
+  802276:	48 89 e5             	mov    %rsp,%rbp
+  802279:	41 56                	push   %r14
+  80227b:	41 55                	push   %r13
+  80227d:	41 54                	push   %r12
+  80227f:	53                   	push   %rbx
+  802280:	48 83 ec 10          	sub    $0x10,%rsp
+  802284:	89 fb                	mov    %edi,%ebx
+  802286:	49 89 f4             	mov    %rsi,%r12
+  802289:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80228c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802290:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  802297:	00 00 00 
+  80229a:	ff d0                	call   *%rax
+  80229c:	85 c0                	test   %eax,%eax
+  80229e:	78 47                	js     8022e7 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022a0:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  8022a4:	41 8b 3e             	mov    (%r14),%edi
+  8022a7:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8022ab:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8022b2:	00 00 00 
+  8022b5:	ff d0                	call   *%rax
+  8022b7:	85 c0                	test   %eax,%eax
+  8022b9:	78 30                	js     8022eb <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8022bb:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8022c0:	74 2d                	je     8022ef <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8022c2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8022c6:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8022ca:	48 85 c0             	test   %rax,%rax
+  8022cd:	74 56                	je     802325 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8022cf:	4c 89 ea             	mov    %r13,%rdx
+  8022d2:	4c 89 e6             	mov    %r12,%rsi
+  8022d5:	4c 89 f7             	mov    %r14,%rdi
+  8022d8:	ff d0                	call   *%rax
+}
+  8022da:	48 83 c4 10          	add    $0x10,%rsp
+  8022de:	5b                   	pop    %rbx
+  8022df:	41 5c                	pop    %r12
+  8022e1:	41 5d                	pop    %r13
+  8022e3:	41 5e                	pop    %r14
+  8022e5:	5d                   	pop    %rbp
+  8022e6:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8022e7:	48 98                	cltq
+  8022e9:	eb ef                	jmp    8022da <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8022eb:	48 98                	cltq
+  8022ed:	eb eb                	jmp    8022da <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8022ef:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8022f6:	00 00 00 
+  8022f9:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8022ff:	89 da                	mov    %ebx,%edx
+  802301:	48 bf e5 55 80 00 00 	movabs $0x8055e5,%rdi
+  802308:	00 00 00 
+  80230b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802310:	48 b9 57 09 80 00 00 	movabs $0x800957,%rcx
+  802317:	00 00 00 
+  80231a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80231c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802323:	eb b5                	jmp    8022da <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802325:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  80232c:	eb ac                	jmp    8022da <write+0x65>
+
+000000000080232e <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  80232e:	55                   	push   %rbp
+  80232f:	48 89 e5             	mov    %rsp,%rbp
+  802332:	41 54                	push   %r12
+  802334:	53                   	push   %rbx
+  802335:	48 83 ec 10          	sub    $0x10,%rsp
+  802339:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80233b:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80233f:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+  80234b:	85 c0                	test   %eax,%eax
+  80234d:	78 3e                	js     80238d <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80234f:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802353:	41 8b 3c 24          	mov    (%r12),%edi
+  802357:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80235b:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	85 c0                	test   %eax,%eax
+  802369:	78 22                	js     80238d <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  80236b:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80236f:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802373:	48 85 c0             	test   %rax,%rax
+  802376:	74 0b                	je     802383 <seek+0x55>
+  802378:	89 de                	mov    %ebx,%esi
+  80237a:	4c 89 e7             	mov    %r12,%rdi
+  80237d:	ff d0                	call   *%rax
+  80237f:	85 c0                	test   %eax,%eax
+  802381:	78 0a                	js     80238d <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802383:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802388:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80238d:	48 83 c4 10          	add    $0x10,%rsp
+  802391:	5b                   	pop    %rbx
+  802392:	41 5c                	pop    %r12
+  802394:	5d                   	pop    %rbp
+  802395:	c3                   	ret
+
+0000000000802396 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802396:	55                   	push   %rbp
+  802397:	48 89 e5             	mov    %rsp,%rbp
+  80239a:	41 55                	push   %r13
+  80239c:	41 54                	push   %r12
+  80239e:	53                   	push   %rbx
+  80239f:	48 83 ec 18          	sub    $0x18,%rsp
+  8023a3:	89 fb                	mov    %edi,%ebx
+  8023a5:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8023a8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8023ac:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+  8023b8:	85 c0                	test   %eax,%eax
+  8023ba:	78 38                	js     8023f4 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8023bc:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8023c0:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8023c4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8023c8:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	85 c0                	test   %eax,%eax
+  8023d6:	78 1c                	js     8023f4 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8023d8:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8023dd:	74 20                	je     8023ff <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8023df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8023e3:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8023e7:	48 85 c0             	test   %rax,%rax
+  8023ea:	74 47                	je     802433 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8023ec:	44 89 e6             	mov    %r12d,%esi
+  8023ef:	4c 89 ef             	mov    %r13,%rdi
+  8023f2:	ff d0                	call   *%rax
+}
+  8023f4:	48 83 c4 18          	add    $0x18,%rsp
+  8023f8:	5b                   	pop    %rbx
+  8023f9:	41 5c                	pop    %r12
+  8023fb:	41 5d                	pop    %r13
+  8023fd:	5d                   	pop    %rbp
+  8023fe:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8023ff:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802406:	00 00 00 
+  802409:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80240f:	89 da                	mov    %ebx,%edx
+  802411:	48 bf a8 55 80 00 00 	movabs $0x8055a8,%rdi
+  802418:	00 00 00 
+  80241b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802420:	48 b9 57 09 80 00 00 	movabs $0x800957,%rcx
+  802427:	00 00 00 
+  80242a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  80242c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802431:	eb c1                	jmp    8023f4 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802433:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802438:	eb ba                	jmp    8023f4 <ftruncate+0x5e>
+
+000000000080243a <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80243a:	55                   	push   %rbp
+  80243b:	48 89 e5             	mov    %rsp,%rbp
+  80243e:	41 54                	push   %r12
+  802440:	53                   	push   %rbx
+  802441:	48 83 ec 10          	sub    $0x10,%rsp
+  802445:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802448:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80244c:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	78 4e                	js     8024aa <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80245c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802460:	41 8b 3c 24          	mov    (%r12),%edi
+  802464:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802468:	48 b8 ae 1e 80 00 00 	movabs $0x801eae,%rax
+  80246f:	00 00 00 
+  802472:	ff d0                	call   *%rax
+  802474:	85 c0                	test   %eax,%eax
+  802476:	78 32                	js     8024aa <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802478:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80247c:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802481:	74 30                	je     8024b3 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802483:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802486:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80248d:	00 00 00 
+    stat->st_isdir = 0;
+  802490:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802497:	00 00 00 
+    stat->st_dev = dev;
+  80249a:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8024a1:	48 89 de             	mov    %rbx,%rsi
+  8024a4:	4c 89 e7             	mov    %r12,%rdi
+  8024a7:	ff 50 28             	call   *0x28(%rax)
+}
+  8024aa:	48 83 c4 10          	add    $0x10,%rsp
+  8024ae:	5b                   	pop    %rbx
+  8024af:	41 5c                	pop    %r12
+  8024b1:	5d                   	pop    %rbp
+  8024b2:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8024b3:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8024b8:	eb f0                	jmp    8024aa <fstat+0x70>
+
+00000000008024ba <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8024ba:	55                   	push   %rbp
+  8024bb:	48 89 e5             	mov    %rsp,%rbp
+  8024be:	41 54                	push   %r12
+  8024c0:	53                   	push   %rbx
+  8024c1:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8024c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8024c9:	48 b8 28 36 80 00 00 	movabs $0x803628,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+  8024d5:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8024d7:	85 c0                	test   %eax,%eax
+  8024d9:	78 25                	js     802500 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8024db:	4c 89 e6             	mov    %r12,%rsi
+  8024de:	89 c7                	mov    %eax,%edi
+  8024e0:	48 b8 3a 24 80 00 00 	movabs $0x80243a,%rax
+  8024e7:	00 00 00 
+  8024ea:	ff d0                	call   *%rax
+  8024ec:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8024ef:	89 df                	mov    %ebx,%edi
+  8024f1:	48 b8 c8 1f 80 00 00 	movabs $0x801fc8,%rax
+  8024f8:	00 00 00 
+  8024fb:	ff d0                	call   *%rax
+
+    return res;
+  8024fd:	44 89 e3             	mov    %r12d,%ebx
+}
+  802500:	89 d8                	mov    %ebx,%eax
+  802502:	5b                   	pop    %rbx
+  802503:	41 5c                	pop    %r12
+  802505:	5d                   	pop    %rbp
+  802506:	c3                   	ret
+
+0000000000802507 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802507:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  80250e:	00 00 00 
+  802511:	83 38 00             	cmpl   $0x0,(%rax)
+  802514:	74 0a                	je     802520 <fsenv+0x19>
+    return envid;
+}
+  802516:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  80251d:	00 00 
+  80251f:	c3                   	ret
+fsenv(void) {
+  802520:	55                   	push   %rbp
+  802521:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802524:	bf 03 00 00 00       	mov    $0x3,%edi
+  802529:	48 b8 76 1d 80 00 00 	movabs $0x801d76,%rax
+  802530:	00 00 00 
+  802533:	ff d0                	call   *%rax
+  802535:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  80253c:	00 00 
+}
+  80253e:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  802545:	00 00 
+  802547:	5d                   	pop    %rbp
+  802548:	c3                   	ret
+
+0000000000802549 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802549:	55                   	push   %rbp
+  80254a:	48 89 e5             	mov    %rsp,%rbp
+  80254d:	41 54                	push   %r12
+  80254f:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802550:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802555:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80255a:	48 89 de             	mov    %rbx,%rsi
+  80255d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802562:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  802569:	00 00 00 
+  80256c:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80256e:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  802575:	00 00 00 
+  802578:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80257e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802583:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802588:	48 89 de             	mov    %rbx,%rsi
+  80258b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802590:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  802597:	00 00 00 
+  80259a:	ff d0                	call   *%rax
+  80259c:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80259e:	85 c0                	test   %eax,%eax
+  8025a0:	0f 88 a2 00 00 00    	js     802648 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8025a6:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8025ad:	00 00 00 
+  8025b0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8025b6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8025bb:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8025bd:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8025c2:	49 bc 5a 47 80 00 00 	movabs $0x80475a,%r12
+  8025c9:	00 00 00 
+  8025cc:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8025cf:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8025d4:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8025d7:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  8025de:	00 00 00 
+  8025e1:	ff d0                	call   *%rax
+  8025e3:	89 c7                	mov    %eax,%edi
+  8025e5:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8025eb:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8025f0:	48 89 da             	mov    %rbx,%rdx
+  8025f3:	be 09 00 00 00       	mov    $0x9,%esi
+  8025f8:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802604:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802609:	ba 00 00 00 00       	mov    $0x0,%edx
+  80260e:	be 00 00 00 00       	mov    $0x0,%esi
+  802613:	bf 00 00 00 00       	mov    $0x0,%edi
+  802618:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  80261f:	00 00 00 
+  802622:	ff d0                	call   *%rax
+  802624:	89 c3                	mov    %eax,%ebx
+  802626:	85 c0                	test   %eax,%eax
+  802628:	78 25                	js     80264f <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80262a:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802631:	00 00 00 
+  802634:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80263a:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  802641:	00 00 
+    return 0;
+  802643:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802648:	89 d8                	mov    %ebx,%eax
+  80264a:	5b                   	pop    %rbx
+  80264b:	41 5c                	pop    %r12
+  80264d:	5d                   	pop    %rbp
+  80264e:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80264f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802654:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802659:	bf 00 00 00 00       	mov    $0x0,%edi
+  80265e:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  802665:	00 00 00 
+  802668:	ff d0                	call   *%rax
+        return res;
+  80266a:	eb dc                	jmp    802648 <fschan_setup+0xff>
+
+000000000080266c <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80266c:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  802673:	00 00 00 
+  802676:	80 38 00             	cmpb   $0x0,(%rax)
+  802679:	74 55                	je     8026d0 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80267b:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802682:	00 00 00 
+  802685:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80268b:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802690:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  802697:	00 00 00 
+  80269a:	3b 0a                	cmp    (%rdx),%ecx
+  80269c:	75 01                	jne    80269f <fschan+0x33>
+}
+  80269e:	c3                   	ret
+fschan(void) {
+  80269f:	55                   	push   %rbp
+  8026a0:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8026a3:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  8026aa:	00 00 00 
+  8026ad:	ff d0                	call   *%rax
+  8026af:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8026b1:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8026b6:	85 d2                	test   %edx,%edx
+  8026b8:	78 02                	js     8026bc <fschan+0x50>
+}
+  8026ba:	5d                   	pop    %rbp
+  8026bb:	c3                   	ret
+        fschan_enabled = 0;
+  8026bc:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8026c3:	00 00 00 
+  8026c6:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8026c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ce:	eb ea                	jmp    8026ba <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8026d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d5:	c3                   	ret
+
+00000000008026d6 <fbuf>:
+fbuf(struct Fd *fd) {
+  8026d6:	55                   	push   %rbp
+  8026d7:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8026da:	48 b8 d5 1d 80 00 00 	movabs $0x801dd5,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8026e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026eb:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8026ef:	77 12                	ja     802703 <fbuf+0x2d>
+  8026f1:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8026f5:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  8026fc:	00 00 00 
+  8026ff:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802703:	48 89 d0             	mov    %rdx,%rax
+  802706:	5d                   	pop    %rbp
+  802707:	c3                   	ret
+
+0000000000802708 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802708:	55                   	push   %rbp
+  802709:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80270c:	48 83 c7 40          	add    $0x40,%rdi
+  802710:	48 b8 94 47 80 00 00 	movabs $0x804794,%rax
+  802717:	00 00 00 
+  80271a:	ff d0                	call   *%rax
+  80271c:	84 c0                	test   %al,%al
+  80271e:	75 02                	jne    802722 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802720:	5d                   	pop    %rbp
+  802721:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802722:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802729:	00 00 00 
+  80272c:	ff d0                	call   *%rax
+  80272e:	89 c7                	mov    %eax,%edi
+  802730:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802736:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802740:	be 0a 00 00 00       	mov    $0xa,%esi
+  802745:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  80274c:	00 00 00 
+  80274f:	ff d0                	call   *%rax
+}
+  802751:	eb cd                	jmp    802720 <fschan_publish+0x18>
+
+0000000000802753 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802753:	55                   	push   %rbp
+  802754:	48 89 e5             	mov    %rsp,%rbp
+  802757:	41 57                	push   %r15
+  802759:	41 56                	push   %r14
+  80275b:	41 55                	push   %r13
+  80275d:	41 54                	push   %r12
+  80275f:	53                   	push   %rbx
+  802760:	48 83 ec 48          	sub    $0x48,%rsp
+  802764:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802768:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80276c:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80276f:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802773:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802776:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  80277d:	00 00 00 
+  802780:	8b 02                	mov    (%rdx),%eax
+  802782:	83 c0 01             	add    $0x1,%eax
+  802785:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80278a:	0f 44 c1             	cmove  %ecx,%eax
+  80278d:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80278f:	4d 85 c0             	test   %r8,%r8
+  802792:	74 2c                	je     8027c0 <fschan_rw+0x6d>
+  802794:	45 89 ce             	mov    %r9d,%r14d
+  802797:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80279e:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8027a2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8027a8:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8027af:	00 
+  8027b0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8027b6:	b8 01 00 00 00       	mov    $0x1,%eax
+  8027bb:	e9 41 01 00 00       	jmp    802901 <fschan_rw+0x1ae>
+  8027c0:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8027c4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8027c8:	e9 9c 01 00 00       	jmp    802969 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8027cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8027d1:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8027d4:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8027d7:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8027da:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8027de:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8027e2:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8027e6:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8027ea:	48 89 da             	mov    %rbx,%rdx
+  8027ed:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  8027f4:	00 00 00 
+  8027f7:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8027f9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8027fd:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+            queued += blk;
+  802809:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80280c:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802810:	4d 39 fc             	cmp    %r15,%r12
+  802813:	73 6b                	jae    802880 <fschan_rw+0x12d>
+  802815:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802819:	77 65                	ja     802880 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80281b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80281f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802823:	48 b8 6f 47 80 00 00 	movabs $0x80476f,%rax
+  80282a:	00 00 00 
+  80282d:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80282f:	4c 89 fb             	mov    %r15,%rbx
+  802832:	4c 29 e3             	sub    %r12,%rbx
+  802835:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80283a:	48 39 d3             	cmp    %rdx,%rbx
+  80283d:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802841:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802845:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802849:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80284d:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802850:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802852:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  802859:	00 00 00 
+  80285c:	8b 09                	mov    (%rcx),%ecx
+  80285e:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802861:	83 fe 03             	cmp    $0x3,%esi
+  802864:	0f 85 63 ff ff ff    	jne    8027cd <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80286a:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80286e:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802871:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802874:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802877:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80287b:	e9 79 ff ff ff       	jmp    8027f9 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802880:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802884:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80288b:	48 89 df             	mov    %rbx,%rdi
+  80288e:	48 b8 32 48 80 00 00 	movabs $0x804832,%rax
+  802895:	00 00 00 
+  802898:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80289a:	48 89 df             	mov    %rbx,%rdi
+  80289d:	48 b8 c0 47 80 00 00 	movabs $0x8047c0,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+  8028a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8028ad:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8028b1:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8028b5:	75 25                	jne    8028dc <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8028b7:	8b 40 04             	mov    0x4(%rax),%eax
+  8028ba:	85 c0                	test   %eax,%eax
+  8028bc:	0f 88 86 00 00 00    	js     802948 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8028c2:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8028c6:	74 5b                	je     802923 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8028c8:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8028cc:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8028d0:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8028d4:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8028d8:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8028dc:	48 89 df             	mov    %rbx,%rdi
+  8028df:	48 b8 e7 47 80 00 00 	movabs $0x8047e7,%rax
+  8028e6:	00 00 00 
+  8028e9:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8028eb:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8028ef:	83 f0 01             	xor    $0x1,%eax
+  8028f2:	4d 39 fc             	cmp    %r15,%r12
+  8028f5:	0f 92 c2             	setb   %dl
+  8028f8:	84 c2                	test   %al,%dl
+  8028fa:	75 05                	jne    802901 <fschan_rw+0x1ae>
+  8028fc:	45 85 ed             	test   %r13d,%r13d
+  8028ff:	74 50                	je     802951 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802901:	4d 39 fc             	cmp    %r15,%r12
+  802904:	0f 92 c1             	setb   %cl
+  802907:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80290b:	0f 96 c2             	setbe  %dl
+  80290e:	84 d1                	test   %dl,%cl
+  802910:	0f 84 6a ff ff ff    	je     802880 <fschan_rw+0x12d>
+  802916:	84 c0                	test   %al,%al
+  802918:	0f 85 fd fe ff ff    	jne    80281b <fschan_rw+0xc8>
+  80291e:	e9 5d ff ff ff       	jmp    802880 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802923:	48 63 d0             	movslq %eax,%rdx
+  802926:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80292a:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80292e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802932:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802936:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80293a:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  802941:	00 00 00 
+  802944:	ff d0                	call   *%rax
+  802946:	eb 80                	jmp    8028c8 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802948:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80294b:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80294f:	eb 8b                	jmp    8028dc <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802951:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802956:	0f 85 68 fe ff ff    	jne    8027c4 <fschan_rw+0x71>
+  80295c:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80295f:	85 c0                	test   %eax,%eax
+  802961:	0f 84 5d fe ff ff    	je     8027c4 <fschan_rw+0x71>
+  802967:	48 98                	cltq
+}
+  802969:	48 83 c4 48          	add    $0x48,%rsp
+  80296d:	5b                   	pop    %rbx
+  80296e:	41 5c                	pop    %r12
+  802970:	41 5d                	pop    %r13
+  802972:	41 5e                	pop    %r14
+  802974:	41 5f                	pop    %r15
+  802976:	5d                   	pop    %rbp
+  802977:	c3                   	ret
+
+0000000000802978 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802978:	55                   	push   %rbp
+  802979:	48 89 e5             	mov    %rsp,%rbp
+  80297c:	41 56                	push   %r14
+  80297e:	41 55                	push   %r13
+  802980:	41 54                	push   %r12
+  802982:	53                   	push   %rbx
+  802983:	48 83 ec 10          	sub    $0x10,%rsp
+  802987:	49 89 fe             	mov    %rdi,%r14
+  80298a:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80298d:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802991:	48 29 f3             	sub    %rsi,%rbx
+  802994:	48 39 d3             	cmp    %rdx,%rbx
+  802997:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80299b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8029a2:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8029a3:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8029a8:	49 bd f1 45 80 00 00 	movabs $0x8045f1,%r13
+  8029af:	00 00 00 
+  8029b2:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8029b9:	76 1e                	jbe    8029d9 <mmap_fault+0x61>
+  8029bb:	4c 01 e7             	add    %r12,%rdi
+  8029be:	41 ff d5             	call   *%r13
+  8029c1:	84 c0                	test   %al,%al
+  8029c3:	75 14                	jne    8029d9 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8029c5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8029c9:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8029d0:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8029d4:	48 39 df             	cmp    %rbx,%rdi
+  8029d7:	72 e2                	jb     8029bb <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8029d9:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  8029e0:	00 00 00 
+  8029e3:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8029ea:	00 00 00 
+  8029ed:	4c 89 f0             	mov    %r14,%rax
+  8029f0:	48 29 d0             	sub    %rdx,%rax
+  8029f3:	48 c1 f8 03          	sar    $0x3,%rax
+  8029f7:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8029fe:	aa aa aa 
+  802a01:	48 0f af c2          	imul   %rdx,%rax
+  802a05:	48 c1 e0 0c          	shl    $0xc,%rax
+  802a09:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802a0e:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802a12:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802a14:	44 89 e0             	mov    %r12d,%eax
+  802a17:	41 03 46 10          	add    0x10(%r14),%eax
+  802a1b:	41 2b 06             	sub    (%r14),%eax
+  802a1e:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802a21:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802a25:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802a29:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802a2d:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802a30:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	89 c7                	mov    %eax,%edi
+  802a3e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802a44:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802a49:	48 89 da             	mov    %rbx,%rdx
+  802a4c:	be 0f 00 00 00       	mov    $0xf,%esi
+  802a51:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  802a58:	00 00 00 
+  802a5b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802a5d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a62:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802a66:	4c 89 e6             	mov    %r12,%rsi
+  802a69:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a6e:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802a75:	00 00 00 
+  802a78:	ff d0                	call   *%rax
+  802a7a:	48 98                	cltq
+}
+  802a7c:	48 83 c4 10          	add    $0x10,%rsp
+  802a80:	5b                   	pop    %rbx
+  802a81:	41 5c                	pop    %r12
+  802a83:	41 5d                	pop    %r13
+  802a85:	41 5e                	pop    %r14
+  802a87:	5d                   	pop    %rbp
+  802a88:	c3                   	ret
+
+0000000000802a89 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802a89:	48 8b 37             	mov    (%rdi),%rsi
+  802a8c:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802a93:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  802a9a:	00 00 00 
+  802a9d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802aa2:	eb 0f                	jmp    802ab3 <mmap_pgfault+0x2a>
+  802aa4:	c3                   	ret
+  802aa5:	48 83 c1 01          	add    $0x1,%rcx
+  802aa9:	48 83 c2 18          	add    $0x18,%rdx
+  802aad:	48 83 f9 20          	cmp    $0x20,%rcx
+  802ab1:	74 6e                	je     802b21 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802ab3:	48 8b 02             	mov    (%rdx),%rax
+  802ab6:	48 83 e8 01          	sub    $0x1,%rax
+  802aba:	48 39 f0             	cmp    %rsi,%rax
+  802abd:	73 e6                	jae    802aa5 <mmap_pgfault+0x1c>
+  802abf:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802ac3:	73 e0                	jae    802aa5 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802ac5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ace:	f6 c2 01             	test   $0x1,%dl
+  802ad1:	75 d1                	jne    802aa4 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802ad3:	f6 c2 02             	test   $0x2,%dl
+  802ad6:	74 1a                	je     802af2 <mmap_pgfault+0x69>
+  802ad8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae1:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  802ae8:	00 00 00 
+  802aeb:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802af0:	74 35                	je     802b27 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802af2:	55                   	push   %rbp
+  802af3:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802af6:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802afa:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802b01:	00 00 00 
+  802b04:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802b08:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b0d:	48 b8 78 29 80 00 00 	movabs $0x802978,%rax
+  802b14:	00 00 00 
+  802b17:	ff d0                	call   *%rax
+  802b19:	48 85 c0             	test   %rax,%rax
+  802b1c:	0f 9f c0             	setg   %al
+}
+  802b1f:	5d                   	pop    %rbp
+  802b20:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802b21:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b26:	c3                   	ret
+}
+  802b27:	c3                   	ret
+
+0000000000802b28 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802b28:	55                   	push   %rbp
+  802b29:	48 89 e5             	mov    %rsp,%rbp
+  802b2c:	41 54                	push   %r12
+  802b2e:	53                   	push   %rbx
+  802b2f:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b32:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802b39:	00 00 00 
+  802b3c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802b41:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802b45:	74 15                	je     802b5c <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802b47:	48 83 c3 01          	add    $0x1,%rbx
+  802b4b:	48 83 c0 18          	add    $0x18,%rax
+  802b4f:	48 83 fb 20          	cmp    $0x20,%rbx
+  802b53:	75 ec                	jne    802b41 <mmap_alloc+0x19>
+    return NULL;
+  802b55:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b5a:	eb 52                	jmp    802bae <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802b5c:	4c 89 e7             	mov    %r12,%rdi
+  802b5f:	48 b8 92 45 80 00 00 	movabs $0x804592,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+  802b6b:	41 89 c1             	mov    %eax,%r9d
+  802b6e:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802b75:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802b79:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802b7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b84:	4c 89 e6             	mov    %r12,%rsi
+  802b87:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8c:	48 b8 31 18 80 00 00 	movabs $0x801831,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	78 17                	js     802bb3 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802b9c:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802ba0:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802ba7:	00 00 00 
+  802baa:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802bae:	5b                   	pop    %rbx
+  802baf:	41 5c                	pop    %r12
+  802bb1:	5d                   	pop    %rbp
+  802bb2:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802bb3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bb8:	eb f4                	jmp    802bae <mmap_alloc+0x86>
+
+0000000000802bba <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802bba:	55                   	push   %rbp
+  802bbb:	48 89 e5             	mov    %rsp,%rbp
+  802bbe:	41 56                	push   %r14
+  802bc0:	41 55                	push   %r13
+  802bc2:	41 54                	push   %r12
+  802bc4:	53                   	push   %rbx
+  802bc5:	48 83 ec 10          	sub    $0x10,%rsp
+  802bc9:	41 89 fc             	mov    %edi,%r12d
+  802bcc:	49 89 f5             	mov    %rsi,%r13
+  802bcf:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802bd2:	48 89 f0             	mov    %rsi,%rax
+  802bd5:	48 09 d0             	or     %rdx,%rax
+  802bd8:	75 0d                	jne    802be7 <fsipc+0x2d>
+  802bda:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802bdd:	83 f8 04             	cmp    $0x4,%eax
+  802be0:	76 7d                	jbe    802c5f <fsipc+0xa5>
+  802be2:	83 ff 0d             	cmp    $0xd,%edi
+  802be5:	74 78                	je     802c5f <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802be7:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+  802bf3:	89 c7                	mov    %eax,%edi
+  802bf5:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802bfc:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802c03:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802c0a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c10:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802c17:	00 00 00 
+  802c1a:	44 89 e6             	mov    %r12d,%esi
+  802c1d:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  802c24:	00 00 00 
+  802c27:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802c29:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802c30:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802c31:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c36:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802c3a:	4c 89 ee             	mov    %r13,%rsi
+  802c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c42:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+  802c4e:	89 c3                	mov    %eax,%ebx
+}
+  802c50:	89 d8                	mov    %ebx,%eax
+  802c52:	48 83 c4 10          	add    $0x10,%rsp
+  802c56:	5b                   	pop    %rbx
+  802c57:	41 5c                	pop    %r12
+  802c59:	41 5d                	pop    %r13
+  802c5b:	41 5e                	pop    %r14
+  802c5d:	5d                   	pop    %rbp
+  802c5e:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802c5f:	48 b8 6c 26 80 00 00 	movabs $0x80266c,%rax
+  802c66:	00 00 00 
+  802c69:	ff d0                	call   *%rax
+  802c6b:	49 89 c6             	mov    %rax,%r14
+  802c6e:	48 85 c0             	test   %rax,%rax
+  802c71:	0f 84 70 ff ff ff    	je     802be7 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802c77:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802c7b:	48 b8 6f 47 80 00 00 	movabs $0x80476f,%rax
+  802c82:	00 00 00 
+  802c85:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802c87:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802c8a:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802c91:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802c95:	ba 10 00 00 00       	mov    $0x10,%edx
+  802c9a:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  802ca1:	00 00 00 
+  802ca4:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  802cab:	00 00 00 
+  802cae:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802cb0:	4c 89 f7             	mov    %r14,%rdi
+  802cb3:	48 b8 08 27 80 00 00 	movabs $0x802708,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802cbf:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802cc6:	4c 89 f7             	mov    %r14,%rdi
+  802cc9:	48 b8 32 48 80 00 00 	movabs $0x804832,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802cd5:	4c 89 f7             	mov    %r14,%rdi
+  802cd8:	48 b8 c0 47 80 00 00 	movabs $0x8047c0,%rax
+  802cdf:	00 00 00 
+  802ce2:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802ce4:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802ce7:	41 83 fc 05          	cmp    $0x5,%r12d
+  802ceb:	75 04                	jne    802cf1 <fsipc+0x137>
+  802ced:	85 db                	test   %ebx,%ebx
+  802cef:	79 14                	jns    802d05 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802cf1:	4c 89 f7             	mov    %r14,%rdi
+  802cf4:	48 b8 e7 47 80 00 00 	movabs $0x8047e7,%rax
+  802cfb:	00 00 00 
+  802cfe:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802d00:	e9 4b ff ff ff       	jmp    802c50 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802d05:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802d09:	ba 88 00 00 00       	mov    $0x88,%edx
+  802d0e:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802d15:	00 00 00 
+  802d18:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  802d1f:	00 00 00 
+  802d22:	ff d0                	call   *%rax
+  802d24:	eb cb                	jmp    802cf1 <fsipc+0x137>
+
+0000000000802d26 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802d26:	55                   	push   %rbp
+  802d27:	48 89 e5             	mov    %rsp,%rbp
+  802d2a:	41 57                	push   %r15
+  802d2c:	41 56                	push   %r14
+  802d2e:	41 55                	push   %r13
+  802d30:	41 54                	push   %r12
+  802d32:	53                   	push   %rbx
+  802d33:	48 83 ec 18          	sub    $0x18,%rsp
+  802d37:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802d3b:	49 89 f6             	mov    %rsi,%r14
+  802d3e:	49 89 d4             	mov    %rdx,%r12
+  802d41:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802d44:	48 b8 6c 26 80 00 00 	movabs $0x80266c,%rax
+  802d4b:	00 00 00 
+  802d4e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802d50:	48 85 c0             	test   %rax,%rax
+  802d53:	0f 85 96 00 00 00    	jne    802def <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802d59:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802d60:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d61:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802d68:	00 00 00 
+    while (n) {
+  802d6b:	4d 85 e4             	test   %r12,%r12
+  802d6e:	74 79                	je     802de9 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802d70:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802d75:	49 39 dc             	cmp    %rbx,%r12
+  802d78:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802d7c:	48 89 da             	mov    %rbx,%rdx
+  802d7f:	4c 89 f6             	mov    %r14,%rsi
+  802d82:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  802d89:	00 00 00 
+  802d8c:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802d98:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802d9c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d9f:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802da2:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802da5:	44 01 e8             	add    %r13d,%eax
+  802da8:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802dac:	41 0f 44 c5          	cmove  %r13d,%eax
+  802db0:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802db4:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802db8:	48 89 da             	mov    %rbx,%rdx
+  802dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc0:	bf 04 00 00 00       	mov    $0x4,%edi
+  802dc5:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  802dcc:	00 00 00 
+  802dcf:	ff d0                	call   *%rax
+        if (res < 0)
+  802dd1:	85 c0                	test   %eax,%eax
+  802dd3:	78 4a                	js     802e1f <devfile_write_direct+0xf9>
+        buf += res;
+  802dd5:	48 98                	cltq
+  802dd7:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802dda:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802dde:	49 29 c4             	sub    %rax,%r12
+  802de1:	75 8d                	jne    802d70 <devfile_write_direct+0x4a>
+    return write;
+  802de3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802de7:	eb 27                	jmp    802e10 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802de9:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802ded:	eb f4                	jmp    802de3 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802def:	45 89 e9             	mov    %r13d,%r9d
+  802df2:	4d 89 e0             	mov    %r12,%r8
+  802df5:	4c 89 f1             	mov    %r14,%rcx
+  802df8:	ba 04 00 00 00       	mov    $0x4,%edx
+  802dfd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e01:	48 89 c7             	mov    %rax,%rdi
+  802e04:	48 b8 53 27 80 00 00 	movabs $0x802753,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+}
+  802e10:	48 83 c4 18          	add    $0x18,%rsp
+  802e14:	5b                   	pop    %rbx
+  802e15:	41 5c                	pop    %r12
+  802e17:	41 5d                	pop    %r13
+  802e19:	41 5e                	pop    %r14
+  802e1b:	41 5f                	pop    %r15
+  802e1d:	5d                   	pop    %rbp
+  802e1e:	c3                   	ret
+            return res;
+  802e1f:	48 98                	cltq
+  802e21:	eb ed                	jmp    802e10 <devfile_write_direct+0xea>
+
+0000000000802e23 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802e23:	55                   	push   %rbp
+  802e24:	48 89 e5             	mov    %rsp,%rbp
+  802e27:	41 54                	push   %r12
+  802e29:	53                   	push   %rbx
+  802e2a:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802e2d:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  802e34:	00 00 00 
+  802e37:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802e39:	48 85 c0             	test   %rax,%rax
+  802e3c:	74 71                	je     802eaf <fbuf_flush+0x8c>
+  802e3e:	48 89 c3             	mov    %rax,%rbx
+  802e41:	b8 00 00 00 00       	mov    $0x0,%eax
+  802e46:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802e4a:	75 05                	jne    802e51 <fbuf_flush+0x2e>
+}
+  802e4c:	5b                   	pop    %rbx
+  802e4d:	41 5c                	pop    %r12
+  802e4f:	5d                   	pop    %rbp
+  802e50:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802e51:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802e54:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802e58:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802e5f:	00 00 00 
+  802e62:	48 89 de             	mov    %rbx,%rsi
+  802e65:	48 29 c6             	sub    %rax,%rsi
+  802e68:	48 c1 fe 03          	sar    $0x3,%rsi
+  802e6c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802e73:	aa aa aa 
+  802e76:	48 0f af f0          	imul   %rax,%rsi
+  802e7a:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802e7e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e83:	48 01 c6             	add    %rax,%rsi
+  802e86:	4c 89 e7             	mov    %r12,%rdi
+  802e89:	48 b8 26 2d 80 00 00 	movabs $0x802d26,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802e95:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802e99:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ea0:	00 
+    return res < 0 ? res : 0;
+  802ea1:	48 85 c0             	test   %rax,%rax
+  802ea4:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea9:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802ead:	eb 9d                	jmp    802e4c <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802eaf:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb4:	eb 96                	jmp    802e4c <fbuf_flush+0x29>
+
+0000000000802eb6 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802eb6:	55                   	push   %rbp
+  802eb7:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802eba:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  802ec1:	00 00 00 
+  802ec4:	ff d0                	call   *%rax
+}
+  802ec6:	5d                   	pop    %rbp
+  802ec7:	c3                   	ret
+
+0000000000802ec8 <devfile_write>:
+    if (!fd || !buf)
+  802ec8:	48 85 ff             	test   %rdi,%rdi
+  802ecb:	0f 84 d3 01 00 00    	je     8030a4 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ed1:	55                   	push   %rbp
+  802ed2:	48 89 e5             	mov    %rsp,%rbp
+  802ed5:	41 57                	push   %r15
+  802ed7:	41 56                	push   %r14
+  802ed9:	41 55                	push   %r13
+  802edb:	41 54                	push   %r12
+  802edd:	53                   	push   %rbx
+  802ede:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee2:	49 89 fc             	mov    %rdi,%r12
+  802ee5:	49 89 f6             	mov    %rsi,%r14
+  802ee8:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802eeb:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ef0:	48 85 f6             	test   %rsi,%rsi
+  802ef3:	0f 84 9c 01 00 00    	je     803095 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802ef9:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  802f00:	00 00 00 
+  802f03:	ff d0                	call   *%rax
+  802f05:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802f08:	48 85 c0             	test   %rax,%rax
+  802f0b:	0f 84 a2 00 00 00    	je     802fb3 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802f11:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f16:	4c 89 e7             	mov    %r12,%rdi
+  802f19:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802f25:	83 f8 02             	cmp    $0x2,%eax
+  802f28:	0f 8f 85 00 00 00    	jg     802fb3 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802f2e:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802f35:	00 00 00 
+  802f38:	4d 89 ef             	mov    %r13,%r15
+  802f3b:	49 29 c7             	sub    %rax,%r15
+  802f3e:	49 c1 ff 03          	sar    $0x3,%r15
+  802f42:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802f49:	aa aa aa 
+  802f4c:	4c 0f af f8          	imul   %rax,%r15
+  802f50:	49 c1 e7 0e          	shl    $0xe,%r15
+  802f54:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f59:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802f5c:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802f61:	0f 84 d7 00 00 00    	je     80303e <devfile_write+0x176>
+  802f67:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802f6b:	89 c2                	mov    %eax,%edx
+  802f6d:	41 03 55 0c          	add    0xc(%r13),%edx
+  802f71:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802f76:	75 0f                	jne    802f87 <devfile_write+0xbf>
+  802f78:	48 01 d8             	add    %rbx,%rax
+  802f7b:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802f81:	0f 86 92 00 00 00    	jbe    803019 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802f87:	4c 89 e7             	mov    %r12,%rdi
+  802f8a:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  802f91:	00 00 00 
+  802f94:	ff d0                	call   *%rax
+  802f96:	85 c0                	test   %eax,%eax
+  802f98:	78 52                	js     802fec <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f9a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802fa1:	77 7f                	ja     803022 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802fa3:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802fa8:	0f 85 c2 00 00 00    	jne    803070 <devfile_write+0x1a8>
+  802fae:	e9 94 00 00 00       	jmp    803047 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802fb3:	4c 89 e7             	mov    %r12,%rdi
+  802fb6:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  802fbd:	00 00 00 
+  802fc0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fc2:	85 c0                	test   %eax,%eax
+  802fc4:	79 07                	jns    802fcd <devfile_write+0x105>
+  802fc6:	48 98                	cltq
+  802fc8:	e9 c8 00 00 00       	jmp    803095 <devfile_write+0x1cd>
+  802fcd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802fd2:	48 89 da             	mov    %rbx,%rdx
+  802fd5:	4c 89 f6             	mov    %r14,%rsi
+  802fd8:	4c 89 e7             	mov    %r12,%rdi
+  802fdb:	48 b8 26 2d 80 00 00 	movabs $0x802d26,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	e9 a9 00 00 00       	jmp    803095 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802fec:	48 98                	cltq
+  802fee:	e9 a2 00 00 00       	jmp    803095 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ff3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ff8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802ffd:	4c 89 fe             	mov    %r15,%rsi
+  803000:	bf 00 00 00 00       	mov    $0x0,%edi
+  803005:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  803011:	85 c0                	test   %eax,%eax
+  803013:	79 45                	jns    80305a <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803015:	48 98                	cltq
+  803017:	eb 7c                	jmp    803095 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803019:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  803020:	76 4e                	jbe    803070 <devfile_write+0x1a8>
+  803022:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803027:	48 89 da             	mov    %rbx,%rdx
+  80302a:	4c 89 f6             	mov    %r14,%rsi
+  80302d:	4c 89 e7             	mov    %r12,%rdi
+  803030:	48 b8 26 2d 80 00 00 	movabs $0x802d26,%rax
+  803037:	00 00 00 
+  80303a:	ff d0                	call   *%rax
+  80303c:	eb 57                	jmp    803095 <devfile_write+0x1cd>
+  80303e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  803045:	77 db                	ja     803022 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  803047:	4c 89 ff             	mov    %r15,%rdi
+  80304a:	48 b8 f1 45 80 00 00 	movabs $0x8045f1,%rax
+  803051:	00 00 00 
+  803054:	ff d0                	call   *%rax
+  803056:	84 c0                	test   %al,%al
+  803058:	74 99                	je     802ff3 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80305a:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80305f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803064:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  803068:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80306f:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  803070:	4c 89 ff             	mov    %r15,%rdi
+  803073:	49 03 7d 10          	add    0x10(%r13),%rdi
+  803077:	48 89 da             	mov    %rbx,%rdx
+  80307a:	4c 89 f6             	mov    %r14,%rsi
+  80307d:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  803084:	00 00 00 
+  803087:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  803089:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80308d:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  803092:	48 89 d8             	mov    %rbx,%rax
+}
+  803095:	48 83 c4 08          	add    $0x8,%rsp
+  803099:	5b                   	pop    %rbx
+  80309a:	41 5c                	pop    %r12
+  80309c:	41 5d                	pop    %r13
+  80309e:	41 5e                	pop    %r14
+  8030a0:	41 5f                	pop    %r15
+  8030a2:	5d                   	pop    %rbp
+  8030a3:	c3                   	ret
+        return E_INVAL;
+  8030a4:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030a9:	c3                   	ret
+
+00000000008030aa <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	41 54                	push   %r12
+  8030b0:	53                   	push   %rbx
+  8030b1:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8030b4:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  8030bb:	00 00 00 
+  8030be:	ff d0                	call   *%rax
+  8030c0:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8030c3:	48 89 df             	mov    %rbx,%rdi
+  8030c6:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+  8030d2:	48 85 c0             	test   %rax,%rax
+  8030d5:	74 17                	je     8030ee <devfile_flush+0x44>
+  8030d7:	48 89 df             	mov    %rbx,%rdi
+  8030da:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+  8030e6:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8030ed:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8030ee:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030f1:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8030f8:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8030fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030ff:	be 00 00 00 00       	mov    $0x0,%esi
+  803104:	bf 06 00 00 00       	mov    $0x6,%edi
+  803109:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803110:	00 00 00 
+  803113:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  803115:	45 85 e4             	test   %r12d,%r12d
+  803118:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  80311c:	5b                   	pop    %rbx
+  80311d:	41 5c                	pop    %r12
+  80311f:	5d                   	pop    %rbp
+  803120:	c3                   	ret
+
+0000000000803121 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  803121:	55                   	push   %rbp
+  803122:	48 89 e5             	mov    %rsp,%rbp
+  803125:	41 57                	push   %r15
+  803127:	41 56                	push   %r14
+  803129:	41 55                	push   %r13
+  80312b:	41 54                	push   %r12
+  80312d:	53                   	push   %rbx
+  80312e:	48 83 ec 38          	sub    $0x38,%rsp
+  803132:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  803136:	49 89 f7             	mov    %rsi,%r15
+  803139:	48 89 d3             	mov    %rdx,%rbx
+  80313c:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  80313f:	48 b8 6c 26 80 00 00 	movabs $0x80266c,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  80314b:	48 85 c0             	test   %rax,%rax
+  80314e:	75 20                	jne    803170 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803150:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  803155:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80315c:	00 
+    while (n) {
+  80315d:	48 85 db             	test   %rbx,%rbx
+  803160:	0f 85 df 00 00 00    	jne    803245 <devfile_read_direct+0x124>
+    size_t read = 0;
+  803166:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80316a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80316e:	eb 21                	jmp    803191 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803170:	45 89 f1             	mov    %r14d,%r9d
+  803173:	49 89 d8             	mov    %rbx,%r8
+  803176:	4c 89 f9             	mov    %r15,%rcx
+  803179:	ba 03 00 00 00       	mov    $0x3,%edx
+  80317e:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803182:	48 89 c7             	mov    %rax,%rdi
+  803185:	48 b8 53 27 80 00 00 	movabs $0x802753,%rax
+  80318c:	00 00 00 
+  80318f:	ff d0                	call   *%rax
+}
+  803191:	48 83 c4 38          	add    $0x38,%rsp
+  803195:	5b                   	pop    %rbx
+  803196:	41 5c                	pop    %r12
+  803198:	41 5d                	pop    %r13
+  80319a:	41 5e                	pop    %r14
+  80319c:	41 5f                	pop    %r15
+  80319e:	5d                   	pop    %rbp
+  80319f:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  8031a0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8031a4:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  8031aa:	75 1e                	jne    8031ca <devfile_read_direct+0xa9>
+  8031ac:	e9 e2 00 00 00       	jmp    803293 <devfile_read_direct+0x172>
+            if (!res) return read;
+  8031b1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031b5:	eb da                	jmp    803191 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  8031b7:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  8031bb:	0f 85 d0 01 00 00    	jne    803391 <devfile_read_direct+0x270>
+            map = 0;
+  8031c1:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  8031c5:	eb 03                	jmp    8031ca <devfile_read_direct+0xa9>
+  8031c7:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8031ca:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8031cf:	48 39 d3             	cmp    %rdx,%rbx
+  8031d2:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8031d6:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8031da:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031dd:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  8031e4:	00 00 00 
+  8031e7:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8031e9:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8031ed:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8031f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f6:	bf 03 00 00 00       	mov    $0x3,%edi
+  8031fb:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803202:	00 00 00 
+  803205:	ff d0                	call   *%rax
+        if (res <= 0)
+  803207:	85 c0                	test   %eax,%eax
+  803209:	0f 8e 63 01 00 00    	jle    803372 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  80320f:	4c 63 e0             	movslq %eax,%r12
+  803212:	4c 89 e2             	mov    %r12,%rdx
+  803215:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  80321c:	00 00 00 
+  80321f:	4c 89 ff             	mov    %r15,%rdi
+  803222:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  803229:	00 00 00 
+  80322c:	ff d0                	call   *%rax
+        buf += res;
+  80322e:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  803231:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  803234:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  803238:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  80323c:	48 85 db             	test   %rbx,%rbx
+  80323f:	0f 84 25 ff ff ff    	je     80316a <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  803245:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  803248:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  80324c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803250:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803254:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80325b:	0f 97 c2             	seta   %dl
+  80325e:	20 c2                	and    %al,%dl
+  803260:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803263:	0f 84 5e ff ff ff    	je     8031c7 <devfile_read_direct+0xa6>
+  803269:	4c 89 fa             	mov    %r15,%rdx
+  80326c:	4d 89 fd             	mov    %r15,%r13
+  80326f:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  803276:	0f 85 4e ff ff ff    	jne    8031ca <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80327c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803280:	0f 84 1a ff ff ff    	je     8031a0 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803286:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80328d:	0f 85 37 ff ff ff    	jne    8031ca <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  803293:	48 89 d8             	mov    %rbx,%rax
+  803296:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80329c:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  8032a1:	48 39 c8             	cmp    %rcx,%rax
+  8032a4:	48 0f 47 c1          	cmova  %rcx,%rax
+  8032a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  8032ac:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  8032b0:	49 89 d4             	mov    %rdx,%r12
+  8032b3:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  8032b7:	48 b8 92 45 80 00 00 	movabs $0x804592,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+  8032c3:	a8 40                	test   $0x40,%al
+  8032c5:	0f 85 b9 00 00 00    	jne    803384 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8032cb:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8032d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8032d6:	49 39 c5             	cmp    %rax,%r13
+  8032d9:	72 d8                	jb     8032b3 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8032db:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8032df:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  8032e6:	00 00 00 
+  8032e9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8032ed:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8032f0:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8032f2:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8032f6:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8032fa:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  803301:	00 00 00 
+  803304:	ff d0                	call   *%rax
+  803306:	89 c7                	mov    %eax,%edi
+  803308:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80330e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803313:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  80331a:	00 00 00 
+  80331d:	be 0e 00 00 00       	mov    $0xe,%esi
+  803322:	48 b8 20 1d 80 00 00 	movabs $0x801d20,%rax
+  803329:	00 00 00 
+  80332c:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  80332e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803333:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803337:	4c 89 fe             	mov    %r15,%rsi
+  80333a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333f:	48 b8 fc 1c 80 00 00 	movabs $0x801cfc,%rax
+  803346:	00 00 00 
+  803349:	ff d0                	call   *%rax
+  80334b:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80334e:	48 85 d2             	test   %rdx,%rdx
+  803351:	0f 84 5a fe ff ff    	je     8031b1 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803357:	0f 8e 5a fe ff ff    	jle    8031b7 <devfile_read_direct+0x96>
+                buf += res;
+  80335d:	48 98                	cltq
+  80335f:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803362:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803365:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803369:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80336d:	e9 ca fe ff ff       	jmp    80323c <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803372:	41 89 c5             	mov    %eax,%r13d
+  803375:	48 98                	cltq
+  803377:	45 85 ed             	test   %r13d,%r13d
+  80337a:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80337f:	e9 0d fe ff ff       	jmp    803191 <devfile_read_direct+0x70>
+            map = 0;
+  803384:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803388:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80338c:	e9 39 fe ff ff       	jmp    8031ca <devfile_read_direct+0xa9>
+  803391:	48 89 d0             	mov    %rdx,%rax
+  803394:	e9 f8 fd ff ff       	jmp    803191 <devfile_read_direct+0x70>
+
+0000000000803399 <devfile_read>:
+    if (!fd || !buf)
+  803399:	48 85 ff             	test   %rdi,%rdi
+  80339c:	0f 84 21 02 00 00    	je     8035c3 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  8033a2:	55                   	push   %rbp
+  8033a3:	48 89 e5             	mov    %rsp,%rbp
+  8033a6:	41 57                	push   %r15
+  8033a8:	41 56                	push   %r14
+  8033aa:	41 55                	push   %r13
+  8033ac:	41 54                	push   %r12
+  8033ae:	53                   	push   %rbx
+  8033af:	48 83 ec 28          	sub    $0x28,%rsp
+  8033b3:	48 89 fb             	mov    %rdi,%rbx
+  8033b6:	49 89 f4             	mov    %rsi,%r12
+  8033b9:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  8033bc:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8033c1:	48 85 f6             	test   %rsi,%rsi
+  8033c4:	74 4b                	je     803411 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  8033c6:	48 b8 d6 26 80 00 00 	movabs $0x8026d6,%rax
+  8033cd:	00 00 00 
+  8033d0:	ff d0                	call   *%rax
+  8033d2:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8033d5:	48 85 c0             	test   %rax,%rax
+  8033d8:	74 22                	je     8033fc <devfile_read+0x63>
+  8033da:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8033e1:	77 19                	ja     8033fc <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8033e3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8033e8:	48 89 df             	mov    %rbx,%rdi
+  8033eb:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  8033f2:	00 00 00 
+  8033f5:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8033f7:	83 f8 02             	cmp    $0x2,%eax
+  8033fa:	7e 40                	jle    80343c <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8033fc:	48 89 df             	mov    %rbx,%rdi
+  8033ff:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  803406:	00 00 00 
+  803409:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80340b:	85 c0                	test   %eax,%eax
+  80340d:	79 11                	jns    803420 <devfile_read+0x87>
+  80340f:	48 98                	cltq
+}
+  803411:	48 83 c4 28          	add    $0x28,%rsp
+  803415:	5b                   	pop    %rbx
+  803416:	41 5c                	pop    %r12
+  803418:	41 5d                	pop    %r13
+  80341a:	41 5e                	pop    %r14
+  80341c:	41 5f                	pop    %r15
+  80341e:	5d                   	pop    %rbp
+  80341f:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803420:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803425:	4c 89 ea             	mov    %r13,%rdx
+  803428:	4c 89 e6             	mov    %r12,%rsi
+  80342b:	48 89 df             	mov    %rbx,%rdi
+  80342e:	48 b8 21 31 80 00 00 	movabs $0x803121,%rax
+  803435:	00 00 00 
+  803438:	ff d0                	call   *%rax
+  80343a:	eb d5                	jmp    803411 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  80343c:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803440:	48 89 df             	mov    %rbx,%rdi
+  803443:	48 b8 23 2e 80 00 00 	movabs $0x802e23,%rax
+  80344a:	00 00 00 
+  80344d:	ff d0                	call   *%rax
+  80344f:	85 c0                	test   %eax,%eax
+  803451:	0f 88 33 01 00 00    	js     80358a <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803457:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  80345e:	00 00 00 
+  803461:	4c 89 f0             	mov    %r14,%rax
+  803464:	48 29 d0             	sub    %rdx,%rax
+  803467:	48 c1 f8 03          	sar    $0x3,%rax
+  80346b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803472:	aa aa aa 
+  803475:	48 0f af c2          	imul   %rdx,%rax
+  803479:	48 c1 e0 0e          	shl    $0xe,%rax
+  80347d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803481:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803484:	41 39 06             	cmp    %eax,(%r14)
+  803487:	75 0d                	jne    803496 <devfile_read+0xfd>
+  803489:	8b 43 10             	mov    0x10(%rbx),%eax
+  80348c:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803490:	0f 84 fb 00 00 00    	je     803591 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803496:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80349b:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80349f:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8034a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034a6:	48 89 c7             	mov    %rax,%rdi
+  8034a9:	48 b8 f1 45 80 00 00 	movabs $0x8045f1,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+  8034b5:	84 c0                	test   %al,%al
+  8034b7:	75 27                	jne    8034e0 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8034b9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8034be:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8034c3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034cc:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  8034d3:	00 00 00 
+  8034d6:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8034d8:	85 c0                	test   %eax,%eax
+  8034da:	0f 88 dc 00 00 00    	js     8035bc <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8034e0:	44 89 f8             	mov    %r15d,%eax
+  8034e3:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8034e8:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8034ea:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8034f1:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8034f2:	8b 43 10             	mov    0x10(%rbx),%eax
+  8034f5:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8034f9:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8034fc:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803501:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803505:	48 89 df             	mov    %rbx,%rdi
+  803508:	48 b8 21 31 80 00 00 	movabs $0x803121,%rax
+  80350f:	00 00 00 
+  803512:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803514:	48 85 c0             	test   %rax,%rax
+  803517:	0f 88 f4 fe ff ff    	js     803411 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80351d:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803520:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803523:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803526:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80352a:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80352e:	48 63 d1             	movslq %ecx,%rdx
+  803531:	48 01 d0             	add    %rdx,%rax
+  803534:	4d 63 ff             	movslq %r15d,%r15
+  803537:	4c 29 f8             	sub    %r15,%rax
+  80353a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80353f:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803543:	48 85 c0             	test   %rax,%rax
+  803546:	0f 8e c5 fe ff ff    	jle    803411 <devfile_read+0x78>
+    n = MIN(n, res);
+  80354c:	4c 39 e8             	cmp    %r13,%rax
+  80354f:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803553:	8b 73 04             	mov    0x4(%rbx),%esi
+  803556:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80355a:	48 63 f6             	movslq %esi,%rsi
+  80355d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803562:	48 01 c6             	add    %rax,%rsi
+  803565:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803569:	48 01 c6             	add    %rax,%rsi
+  80356c:	4c 89 ea             	mov    %r13,%rdx
+  80356f:	4c 89 e7             	mov    %r12,%rdi
+  803572:	48 b8 dd 14 80 00 00 	movabs $0x8014dd,%rax
+  803579:	00 00 00 
+  80357c:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80357e:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803582:	4c 89 e8             	mov    %r13,%rax
+  803585:	e9 87 fe ff ff       	jmp    803411 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80358a:	48 98                	cltq
+  80358c:	e9 80 fe ff ff       	jmp    803411 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803591:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803595:	41 39 d7             	cmp    %edx,%r15d
+  803598:	0f 8c f8 fe ff ff    	jl     803496 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80359e:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8035a2:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8035a5:	41 39 cf             	cmp    %ecx,%r15d
+  8035a8:	0f 8d e8 fe ff ff    	jge    803496 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8035ae:	4d 63 ff             	movslq %r15d,%r15
+  8035b1:	4c 29 f8             	sub    %r15,%rax
+  8035b4:	48 63 d2             	movslq %edx,%rdx
+  8035b7:	48 01 d0             	add    %rdx,%rax
+  8035ba:	eb 87                	jmp    803543 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8035bc:	48 98                	cltq
+  8035be:	e9 4e fe ff ff       	jmp    803411 <devfile_read+0x78>
+        return E_INVAL;
+  8035c3:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8035c8:	c3                   	ret
+
+00000000008035c9 <fs_channel>:
+fs_channel(bool enable) {
+  8035c9:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8035cb:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  8035d2:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8035d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035d9:	40 84 ff             	test   %dil,%dil
+  8035dc:	74 47                	je     803625 <fs_channel+0x5c>
+  8035de:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8035e5:	00 00 00 
+  8035e8:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8035ee:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  8035f5:	00 00 00 
+  8035f8:	3b 08                	cmp    (%rax),%ecx
+  8035fa:	74 29                	je     803625 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803600:	48 b8 49 25 80 00 00 	movabs $0x802549,%rax
+  803607:	00 00 00 
+  80360a:	ff d0                	call   *%rax
+  80360c:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80360e:	85 c0                	test   %eax,%eax
+  803610:	78 04                	js     803616 <fs_channel+0x4d>
+}
+  803612:	89 d0                	mov    %edx,%eax
+  803614:	5d                   	pop    %rbp
+  803615:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803616:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  80361d:	00 00 00 
+  803620:	c6 00 00             	movb   $0x0,(%rax)
+  803623:	eb ed                	jmp    803612 <fs_channel+0x49>
+}
+  803625:	89 d0                	mov    %edx,%eax
+  803627:	c3                   	ret
+
+0000000000803628 <open>:
+open(const char *path, int mode) {
+  803628:	55                   	push   %rbp
+  803629:	48 89 e5             	mov    %rsp,%rbp
+  80362c:	41 55                	push   %r13
+  80362e:	41 54                	push   %r12
+  803630:	53                   	push   %rbx
+  803631:	48 83 ec 18          	sub    $0x18,%rsp
+  803635:	49 89 fc             	mov    %rdi,%r12
+  803638:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80363b:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  803642:	00 00 00 
+  803645:	ff d0                	call   *%rax
+  803647:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80364d:	0f 87 8f 00 00 00    	ja     8036e2 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803653:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803657:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  80365e:	00 00 00 
+  803661:	ff d0                	call   *%rax
+  803663:	89 c3                	mov    %eax,%ebx
+  803665:	85 c0                	test   %eax,%eax
+  803667:	78 55                	js     8036be <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803669:	4c 89 e6             	mov    %r12,%rsi
+  80366c:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  803673:	00 00 00 
+  803676:	48 89 df             	mov    %rbx,%rdi
+  803679:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  803680:	00 00 00 
+  803683:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803685:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80368c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803691:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803695:	bf 01 00 00 00       	mov    $0x1,%edi
+  80369a:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  8036a1:	00 00 00 
+  8036a4:	ff d0                	call   *%rax
+  8036a6:	89 c3                	mov    %eax,%ebx
+  8036a8:	85 c0                	test   %eax,%eax
+  8036aa:	78 1f                	js     8036cb <open+0xa3>
+    return fd2num(fd);
+  8036ac:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036b0:	48 b8 d5 1d 80 00 00 	movabs $0x801dd5,%rax
+  8036b7:	00 00 00 
+  8036ba:	ff d0                	call   *%rax
+  8036bc:	89 c3                	mov    %eax,%ebx
+}
+  8036be:	89 d8                	mov    %ebx,%eax
+  8036c0:	48 83 c4 18          	add    $0x18,%rsp
+  8036c4:	5b                   	pop    %rbx
+  8036c5:	41 5c                	pop    %r12
+  8036c7:	41 5d                	pop    %r13
+  8036c9:	5d                   	pop    %rbp
+  8036ca:	c3                   	ret
+        fd_close(fd, 0);
+  8036cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8036d0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8036d4:	48 b8 1e 1f 80 00 00 	movabs $0x801f1e,%rax
+  8036db:	00 00 00 
+  8036de:	ff d0                	call   *%rax
+        return res;
+  8036e0:	eb dc                	jmp    8036be <open+0x96>
+        return -E_BAD_PATH;
+  8036e2:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8036e7:	eb d5                	jmp    8036be <open+0x96>
+
+00000000008036e9 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8036e9:	55                   	push   %rbp
+  8036ea:	48 89 e5             	mov    %rsp,%rbp
+  8036ed:	41 56                	push   %r14
+  8036ef:	41 55                	push   %r13
+  8036f1:	41 54                	push   %r12
+  8036f3:	53                   	push   %rbx
+  8036f4:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8036f8:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  8036ff:	00 00 00 
+  803702:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803707:	49 bd 63 1e 80 00 00 	movabs $0x801e63,%r13
+  80370e:	00 00 00 
+  803711:	49 be 23 2e 80 00 00 	movabs $0x802e23,%r14
+  803718:	00 00 00 
+  80371b:	eb 0c                	jmp    803729 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80371d:	83 c3 01             	add    $0x1,%ebx
+  803720:	49 83 c4 18          	add    $0x18,%r12
+  803724:	83 fb 20             	cmp    $0x20,%ebx
+  803727:	74 1d                	je     803746 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803729:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80372e:	74 ed                	je     80371d <file_flush_buffers+0x34>
+  803730:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803734:	89 df                	mov    %ebx,%edi
+  803736:	41 ff d5             	call   *%r13
+  803739:	85 c0                	test   %eax,%eax
+  80373b:	78 e0                	js     80371d <file_flush_buffers+0x34>
+  80373d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803741:	41 ff d6             	call   *%r14
+  803744:	eb d7                	jmp    80371d <file_flush_buffers+0x34>
+}
+  803746:	48 83 c4 10          	add    $0x10,%rsp
+  80374a:	5b                   	pop    %rbx
+  80374b:	41 5c                	pop    %r12
+  80374d:	41 5d                	pop    %r13
+  80374f:	41 5e                	pop    %r14
+  803751:	5d                   	pop    %rbp
+  803752:	c3                   	ret
+
+0000000000803753 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803753:	55                   	push   %rbp
+  803754:	48 89 e5             	mov    %rsp,%rbp
+  803757:	41 54                	push   %r12
+  803759:	53                   	push   %rbx
+  80375a:	49 89 fc             	mov    %rdi,%r12
+  80375d:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80375f:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  803766:	00 00 00 
+  803769:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80376b:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803772:	00 00 00 
+  803775:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80377a:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80377c:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80377f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803784:	be 00 00 00 00       	mov    $0x0,%esi
+  803789:	bf 02 00 00 00       	mov    $0x2,%edi
+  80378e:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803795:	00 00 00 
+  803798:	ff d0                	call   *%rax
+}
+  80379a:	5b                   	pop    %rbx
+  80379b:	41 5c                	pop    %r12
+  80379d:	5d                   	pop    %rbp
+  80379e:	c3                   	ret
+
+000000000080379f <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80379f:	55                   	push   %rbp
+  8037a0:	48 89 e5             	mov    %rsp,%rbp
+  8037a3:	41 54                	push   %r12
+  8037a5:	53                   	push   %rbx
+  8037a6:	49 89 fc             	mov    %rdi,%r12
+  8037a9:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8037ac:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  8037b3:	00 00 00 
+  8037b6:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8037b8:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8037bd:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8037c4:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8037c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037cb:	be 00 00 00 00       	mov    $0x0,%esi
+  8037d0:	bf 05 00 00 00       	mov    $0x5,%edi
+  8037d5:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  8037dc:	00 00 00 
+  8037df:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8037e1:	85 c0                	test   %eax,%eax
+  8037e3:	78 3d                	js     803822 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8037e5:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  8037ec:	00 00 00 
+  8037ef:	4c 89 e6             	mov    %r12,%rsi
+  8037f2:	48 89 df             	mov    %rbx,%rdi
+  8037f5:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  8037fc:	00 00 00 
+  8037ff:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803801:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803808:	00 
+  803809:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80380f:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803816:	00 
+  803817:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80381d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803822:	5b                   	pop    %rbx
+  803823:	41 5c                	pop    %r12
+  803825:	5d                   	pop    %rbp
+  803826:	c3                   	ret
+
+0000000000803827 <remove>:
+remove(const char *path) {
+  803827:	55                   	push   %rbp
+  803828:	48 89 e5             	mov    %rsp,%rbp
+  80382b:	53                   	push   %rbx
+  80382c:	48 83 ec 08          	sub    $0x8,%rsp
+  803830:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803833:	48 b8 3e 12 80 00 00 	movabs $0x80123e,%rax
+  80383a:	00 00 00 
+  80383d:	ff d0                	call   *%rax
+  80383f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803845:	77 3a                	ja     803881 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803847:	48 89 de             	mov    %rbx,%rsi
+  80384a:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  803851:	00 00 00 
+  803854:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  80385b:	00 00 00 
+  80385e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803860:	ba 00 00 00 00       	mov    $0x0,%edx
+  803865:	be 00 00 00 00       	mov    $0x0,%esi
+  80386a:	bf 07 00 00 00       	mov    $0x7,%edi
+  80386f:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803876:	00 00 00 
+  803879:	ff d0                	call   *%rax
+}
+  80387b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80387f:	c9                   	leave
+  803880:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803881:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803886:	eb f3                	jmp    80387b <remove+0x54>
+
+0000000000803888 <sync>:
+sync(void) {
+  803888:	55                   	push   %rbp
+  803889:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80388c:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  803893:	00 00 00 
+  803896:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803898:	ba 00 00 00 00       	mov    $0x0,%edx
+  80389d:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a2:	bf 08 00 00 00       	mov    $0x8,%edi
+  8038a7:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  8038ae:	00 00 00 
+  8038b1:	ff d0                	call   *%rax
+}
+  8038b3:	5d                   	pop    %rbp
+  8038b4:	c3                   	ret
+
+00000000008038b5 <fsync>:
+fsync(int fdnum) {
+  8038b5:	55                   	push   %rbp
+  8038b6:	48 89 e5             	mov    %rsp,%rbp
+  8038b9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8038bd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8038c1:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  8038c8:	00 00 00 
+  8038cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	78 4b                	js     80391c <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8038d1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8038d5:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8038dc:	00 00 00 
+  8038df:	8b 00                	mov    (%rax),%eax
+  8038e1:	39 02                	cmp    %eax,(%rdx)
+  8038e3:	75 39                	jne    80391e <fsync+0x69>
+    file_flush_buffers();
+  8038e5:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  8038ec:	00 00 00 
+  8038ef:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8038f1:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8038f5:	8b 40 0c             	mov    0xc(%rax),%eax
+  8038f8:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8038ff:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803901:	ba 00 00 00 00       	mov    $0x0,%edx
+  803906:	be 00 00 00 00       	mov    $0x0,%esi
+  80390b:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803910:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+}
+  80391c:	c9                   	leave
+  80391d:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80391e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803923:	eb f7                	jmp    80391c <fsync+0x67>
+
+0000000000803925 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803925:	55                   	push   %rbp
+  803926:	48 89 e5             	mov    %rsp,%rbp
+  803929:	53                   	push   %rbx
+  80392a:	48 83 ec 08          	sub    $0x8,%rsp
+  80392e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803931:	ba 00 00 00 00       	mov    $0x0,%edx
+  803936:	be 00 00 00 00       	mov    $0x0,%esi
+  80393b:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803940:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  803947:	00 00 00 
+  80394a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80394c:	85 c0                	test   %eax,%eax
+  80394e:	78 2d                	js     80397d <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803950:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803957:	00 00 00 
+  80395a:	48 8b 10             	mov    (%rax),%rdx
+  80395d:	48 89 13             	mov    %rdx,(%rbx)
+  803960:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803964:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803968:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80396c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803970:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803974:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803978:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80397d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803981:	c9                   	leave
+  803982:	c3                   	ret
+
+0000000000803983 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803983:	55                   	push   %rbp
+  803984:	48 89 e5             	mov    %rsp,%rbp
+  803987:	53                   	push   %rbx
+  803988:	48 83 ec 08          	sub    $0x8,%rsp
+  80398c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80398f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803994:	be 00 00 00 00       	mov    $0x0,%esi
+  803999:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80399e:	48 b8 ba 2b 80 00 00 	movabs $0x802bba,%rax
+  8039a5:	00 00 00 
+  8039a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8039aa:	85 c0                	test   %eax,%eax
+  8039ac:	78 3d                	js     8039eb <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8039ae:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  8039b5:	00 00 00 
+  8039b8:	48 8b 10             	mov    (%rax),%rdx
+  8039bb:	48 89 13             	mov    %rdx,(%rbx)
+  8039be:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8039c2:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8039c6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8039ca:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8039ce:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8039d2:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8039d6:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8039da:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8039de:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8039e2:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8039e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039eb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8039ef:	c9                   	leave
+  8039f0:	c3                   	ret
+
+00000000008039f1 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8039f1:	55                   	push   %rbp
+  8039f2:	48 89 e5             	mov    %rsp,%rbp
+  8039f5:	41 57                	push   %r15
+  8039f7:	41 56                	push   %r14
+  8039f9:	41 55                	push   %r13
+  8039fb:	41 54                	push   %r12
+  8039fd:	53                   	push   %rbx
+  8039fe:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803a02:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803a09:	00 
+  803a0a:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803a11:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803a17:	0f 85 43 01 00 00    	jne    803b60 <munmap+0x16f>
+  803a1d:	49 89 ff             	mov    %rdi,%r15
+  803a20:	4c 39 f7             	cmp    %r14,%rdi
+  803a23:	0f 87 37 01 00 00    	ja     803b60 <munmap+0x16f>
+  803a29:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  803a30:	00 00 00 
+  803a33:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803a39:	eb 2c                	jmp    803a67 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803a3b:	4c 39 f8             	cmp    %r15,%rax
+  803a3e:	0f 83 85 00 00 00    	jae    803ac9 <munmap+0xd8>
+            m->mm_end = start;
+  803a44:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803a49:	48 83 c3 18          	add    $0x18,%rbx
+  803a4d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803a54:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803a5b:	00 00 00 
+  803a5e:	48 39 c3             	cmp    %rax,%rbx
+  803a61:	0f 84 d0 00 00 00    	je     803b37 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803a67:	49 89 dc             	mov    %rbx,%r12
+  803a6a:	48 8b 03             	mov    (%rbx),%rax
+  803a6d:	4c 39 f0             	cmp    %r14,%rax
+  803a70:	73 d7                	jae    803a49 <munmap+0x58>
+  803a72:	48 85 c0             	test   %rax,%rax
+  803a75:	74 d2                	je     803a49 <munmap+0x58>
+  803a77:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803a7b:	49 39 d7             	cmp    %rdx,%r15
+  803a7e:	73 c9                	jae    803a49 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803a80:	49 39 d6             	cmp    %rdx,%r14
+  803a83:	73 b6                	jae    803a3b <munmap+0x4a>
+  803a85:	49 39 c7             	cmp    %rax,%r15
+  803a88:	76 b1                	jbe    803a3b <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803a8a:	4c 89 ef             	mov    %r13,%rdi
+  803a8d:	48 b8 28 2b 80 00 00 	movabs $0x802b28,%rax
+  803a94:	00 00 00 
+  803a97:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803a99:	48 85 c0             	test   %rax,%rax
+  803a9c:	0f 84 c5 00 00 00    	je     803b67 <munmap+0x176>
+            *tail = *m;
+  803aa2:	48 8b 13             	mov    (%rbx),%rdx
+  803aa5:	48 89 10             	mov    %rdx,(%rax)
+  803aa8:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803aac:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803ab0:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803ab4:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803ab8:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803abb:	44 89 f2             	mov    %r14d,%edx
+  803abe:	2b 13                	sub    (%rbx),%edx
+  803ac0:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803ac3:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803ac7:	eb 80                	jmp    803a49 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803ac9:	49 39 d6             	cmp    %rdx,%r14
+  803acc:	73 18                	jae    803ae6 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803ace:	44 89 f2             	mov    %r14d,%edx
+  803ad1:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803ad6:	29 c2                	sub    %eax,%edx
+  803ad8:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803add:	4d 89 34 24          	mov    %r14,(%r12)
+  803ae1:	e9 63 ff ff ff       	jmp    803a49 <munmap+0x58>
+    m->mm_start = 0;
+  803ae6:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803aed:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803aee:	4c 89 e6             	mov    %r12,%rsi
+  803af1:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  803af8:	00 00 00 
+  803afb:	48 29 c6             	sub    %rax,%rsi
+  803afe:	48 c1 fe 03          	sar    $0x3,%rsi
+  803b02:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803b09:	aa aa aa 
+  803b0c:	48 0f af f0          	imul   %rax,%rsi
+  803b10:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803b14:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803b19:	48 01 c6             	add    %rax,%rsi
+  803b1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b21:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b26:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  803b2d:	00 00 00 
+  803b30:	ff d0                	call   *%rax
+}
+  803b32:	e9 12 ff ff ff       	jmp    803a49 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803b37:	4c 89 f2             	mov    %r14,%rdx
+  803b3a:	4c 29 fa             	sub    %r15,%rdx
+  803b3d:	4c 89 fe             	mov    %r15,%rsi
+  803b40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b45:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  803b4c:	00 00 00 
+  803b4f:	ff d0                	call   *%rax
+}
+  803b51:	48 83 c4 08          	add    $0x8,%rsp
+  803b55:	5b                   	pop    %rbx
+  803b56:	41 5c                	pop    %r12
+  803b58:	41 5d                	pop    %r13
+  803b5a:	41 5e                	pop    %r14
+  803b5c:	41 5f                	pop    %r15
+  803b5e:	5d                   	pop    %rbp
+  803b5f:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803b60:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803b65:	eb ea                	jmp    803b51 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803b67:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803b6c:	eb e3                	jmp    803b51 <munmap+0x160>
+
+0000000000803b6e <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803b6e:	55                   	push   %rbp
+  803b6f:	48 89 e5             	mov    %rsp,%rbp
+  803b72:	41 57                	push   %r15
+  803b74:	41 56                	push   %r14
+  803b76:	41 55                	push   %r13
+  803b78:	41 54                	push   %r12
+  803b7a:	53                   	push   %rbx
+  803b7b:	48 83 ec 28          	sub    $0x28,%rsp
+  803b7f:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803b83:	49 89 f5             	mov    %rsi,%r13
+  803b86:	41 89 d6             	mov    %edx,%r14d
+  803b89:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803b8c:	41 89 cc             	mov    %ecx,%r12d
+  803b8f:	44 89 c7             	mov    %r8d,%edi
+  803b92:	44 89 cb             	mov    %r9d,%ebx
+  803b95:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803b99:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803b9d:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  803ba4:	00 00 00 
+  803ba7:	ff d0                	call   *%rax
+  803ba9:	41 89 c7             	mov    %eax,%r15d
+  803bac:	85 c0                	test   %eax,%eax
+  803bae:	0f 88 ae 01 00 00    	js     803d62 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803bb4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803bb8:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803bbf:	00 00 00 
+  803bc2:	8b 32                	mov    (%rdx),%esi
+  803bc4:	39 30                	cmp    %esi,(%rax)
+  803bc6:	0f 85 7a 02 00 00    	jne    803e46 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803bcc:	8b 40 08             	mov    0x8(%rax),%eax
+  803bcf:	83 e0 03             	and    $0x3,%eax
+  803bd2:	83 f8 01             	cmp    $0x1,%eax
+  803bd5:	0f 84 76 02 00 00    	je     803e51 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803bdb:	4d 85 ed             	test   %r13,%r13
+  803bde:	0f 84 78 02 00 00    	je     803e5c <mmap+0x2ee>
+  803be4:	85 db                	test   %ebx,%ebx
+  803be6:	0f 88 70 02 00 00    	js     803e5c <mmap+0x2ee>
+  803bec:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803bf2:	41 89 df             	mov    %ebx,%r15d
+  803bf5:	0f 85 6c 02 00 00    	jne    803e67 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803bfb:	44 89 f0             	mov    %r14d,%eax
+  803bfe:	83 e0 fd             	and    $0xfffffffd,%eax
+  803c01:	83 f8 04             	cmp    $0x4,%eax
+  803c04:	0f 85 68 02 00 00    	jne    803e72 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803c0a:	44 89 e1             	mov    %r12d,%ecx
+  803c0d:	83 e1 01             	and    $0x1,%ecx
+  803c10:	0f 95 c2             	setne  %dl
+  803c13:	44 89 e0             	mov    %r12d,%eax
+  803c16:	d1 e8                	shr    %eax
+  803c18:	83 f0 01             	xor    $0x1,%eax
+  803c1b:	83 e0 01             	and    $0x1,%eax
+  803c1e:	38 c2                	cmp    %al,%dl
+  803c20:	0f 85 57 02 00 00    	jne    803e7d <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803c26:	85 c9                	test   %ecx,%ecx
+  803c28:	74 0a                	je     803c34 <mmap+0xc6>
+  803c2a:	41 f6 c6 02          	test   $0x2,%r14b
+  803c2e:	0f 85 54 02 00 00    	jne    803e88 <mmap+0x31a>
+    file_flush_buffers();
+  803c34:	48 b8 e9 36 80 00 00 	movabs $0x8036e9,%rax
+  803c3b:	00 00 00 
+  803c3e:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803c40:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803c47:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803c4e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803c52:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803c55:	41 f6 c4 04          	test   $0x4,%r12b
+  803c59:	0f 84 15 01 00 00    	je     803d74 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803c5f:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803c62:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803c68:	0f 85 25 02 00 00    	jne    803e93 <mmap+0x325>
+  803c6e:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803c72:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803c79:	00 00 00 
+  803c7c:	48 39 c2             	cmp    %rax,%rdx
+  803c7f:	0f 82 19 02 00 00    	jb     803e9e <mmap+0x330>
+  803c85:	48 39 c7             	cmp    %rax,%rdi
+  803c88:	0f 87 10 02 00 00    	ja     803e9e <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803c8e:	4c 89 ee             	mov    %r13,%rsi
+  803c91:	48 b8 f1 39 80 00 00 	movabs $0x8039f1,%rax
+  803c98:	00 00 00 
+  803c9b:	ff d0                	call   *%rax
+  803c9d:	85 c0                	test   %eax,%eax
+  803c9f:	0f 88 04 02 00 00    	js     803ea9 <mmap+0x33b>
+    if (!handler) {
+  803ca5:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803cac:	00 00 00 
+  803caf:	80 38 00             	cmpb   $0x0,(%rax)
+  803cb2:	75 2b                	jne    803cdf <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803cb4:	48 bf 89 2a 80 00 00 	movabs $0x802a89,%rdi
+  803cbb:	00 00 00 
+  803cbe:	48 b8 4a 4b 80 00 00 	movabs $0x804b4a,%rax
+  803cc5:	00 00 00 
+  803cc8:	ff d0                	call   *%rax
+  803cca:	85 c0                	test   %eax,%eax
+  803ccc:	0f 88 ea 01 00 00    	js     803ebc <mmap+0x34e>
+        handler = 1;
+  803cd2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803cd9:	00 00 00 
+  803cdc:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803cdf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ce3:	48 b8 28 2b 80 00 00 	movabs $0x802b28,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+  803cef:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803cf2:	48 85 c0             	test   %rax,%rax
+  803cf5:	0f 84 c9 01 00 00    	je     803ec4 <mmap+0x356>
+    m->mm_start = va;
+  803cfb:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803cfe:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803d02:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803d06:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803d09:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803d0d:	44 89 e0             	mov    %r12d,%eax
+  803d10:	c1 e0 06             	shl    $0x6,%eax
+  803d13:	25 80 00 00 00       	and    $0x80,%eax
+  803d18:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803d1b:	09 f0                	or     %esi,%eax
+  803d1d:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803d21:	41 f6 c4 08          	test   $0x8,%r12b
+  803d25:	74 31                	je     803d58 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803d27:	48 39 d3             	cmp    %rdx,%rbx
+  803d2a:	73 2c                	jae    803d58 <mmap+0x1ea>
+  803d2c:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803d31:	48 89 de             	mov    %rbx,%rsi
+  803d34:	4c 89 f7             	mov    %r14,%rdi
+  803d37:	48 b8 78 29 80 00 00 	movabs $0x802978,%rax
+  803d3e:	00 00 00 
+  803d41:	ff d0                	call   *%rax
+  803d43:	49 89 c4             	mov    %rax,%r12
+  803d46:	48 85 c0             	test   %rax,%rax
+  803d49:	0f 8e d7 00 00 00    	jle    803e26 <mmap+0x2b8>
+            va += n;
+  803d4f:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803d52:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803d56:	72 d4                	jb     803d2c <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803d58:	49 8b 06             	mov    (%r14),%rax
+  803d5b:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803d5f:	48 89 06             	mov    %rax,(%rsi)
+}
+  803d62:	44 89 f8             	mov    %r15d,%eax
+  803d65:	48 83 c4 28          	add    $0x28,%rsp
+  803d69:	5b                   	pop    %rbx
+  803d6a:	41 5c                	pop    %r12
+  803d6c:	41 5d                	pop    %r13
+  803d6e:	41 5e                	pop    %r14
+  803d70:	41 5f                	pop    %r15
+  803d72:	5d                   	pop    %rbp
+  803d73:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803d74:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803d7b:	00 00 00 
+  803d7e:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803d81:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803d88:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803d90:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  803d97:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803d9a:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803da1:	00 00 00 
+  803da4:	48 39 d7             	cmp    %rdx,%rdi
+  803da7:	73 1c                	jae    803dc5 <mmap+0x257>
+        return -E_NO_MEM;
+  803da9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803daf:	eb b1                	jmp    803d62 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803db1:	48 83 c0 01          	add    $0x1,%rax
+  803db5:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803db9:	77 3f                	ja     803dfa <mmap+0x28c>
+  803dbb:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803dc0:	48 39 d7             	cmp    %rdx,%rdi
+  803dc3:	72 2a                	jb     803def <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803dc5:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803dc9:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803dcd:	48 39 d1             	cmp    %rdx,%rcx
+  803dd0:	73 df                	jae    803db1 <mmap+0x243>
+  803dd2:	48 85 c9             	test   %rcx,%rcx
+  803dd5:	74 da                	je     803db1 <mmap+0x243>
+  803dd7:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803ddb:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803de0:	48 39 d3             	cmp    %rdx,%rbx
+  803de3:	73 cc                	jae    803db1 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803de5:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803de8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ded:	eb cc                	jmp    803dbb <mmap+0x24d>
+        return -E_NO_MEM;
+  803def:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803df5:	e9 68 ff ff ff       	jmp    803d62 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803dfa:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803dff:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803e06:	00 00 00 
+  803e09:	48 39 c2             	cmp    %rax,%rdx
+  803e0c:	0f 82 9f 00 00 00    	jb     803eb1 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803e12:	48 85 db             	test   %rbx,%rbx
+  803e15:	0f 85 8a fe ff ff    	jne    803ca5 <mmap+0x137>
+        return -E_NO_MEM;
+  803e1b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803e21:	e9 3c ff ff ff       	jmp    803d62 <mmap+0x1f4>
+        if (n < 0) {
+  803e26:	0f 89 2c ff ff ff    	jns    803d58 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803e2c:	49 8b 3e             	mov    (%r14),%rdi
+  803e2f:	4c 89 ee             	mov    %r13,%rsi
+  803e32:	48 b8 f1 39 80 00 00 	movabs $0x8039f1,%rax
+  803e39:	00 00 00 
+  803e3c:	ff d0                	call   *%rax
+            return n;
+  803e3e:	45 89 e7             	mov    %r12d,%r15d
+  803e41:	e9 1c ff ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803e46:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e4c:	e9 11 ff ff ff       	jmp    803d62 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803e51:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e57:	e9 06 ff ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803e5c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e62:	e9 fb fe ff ff       	jmp    803d62 <mmap+0x1f4>
+  803e67:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e6d:	e9 f0 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803e72:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e78:	e9 e5 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803e7d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e83:	e9 da fe ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803e88:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803e8e:	e9 cf fe ff ff       	jmp    803d62 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803e93:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803e99:	e9 c4 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+  803e9e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ea4:	e9 b9 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803ea9:	41 89 c7             	mov    %eax,%r15d
+  803eac:	e9 b1 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803eb1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803eb7:	e9 a6 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803ebc:	41 89 c7             	mov    %eax,%r15d
+  803ebf:	e9 9e fe ff ff       	jmp    803d62 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803ec4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803eca:	e9 93 fe ff ff       	jmp    803d62 <mmap+0x1f4>
+
+0000000000803ecf <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803ecf:	55                   	push   %rbp
+  803ed0:	48 89 e5             	mov    %rsp,%rbp
+  803ed3:	41 54                	push   %r12
+  803ed5:	53                   	push   %rbx
+  803ed6:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ed9:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  803ee0:	00 00 00 
+  803ee3:	ff d0                	call   *%rax
+  803ee5:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803ee8:	48 be 40 56 80 00 00 	movabs $0x805640,%rsi
+  803eef:	00 00 00 
+  803ef2:	48 89 df             	mov    %rbx,%rdi
+  803ef5:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803f01:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803f06:	41 2b 04 24          	sub    (%r12),%eax
+  803f0a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803f10:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803f17:	00 00 00 
+    stat->st_dev = &devpipe;
+  803f1a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803f21:	00 00 00 
+  803f24:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803f2b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f30:	5b                   	pop    %rbx
+  803f31:	41 5c                	pop    %r12
+  803f33:	5d                   	pop    %rbp
+  803f34:	c3                   	ret
+
+0000000000803f35 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803f35:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803f38:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803f3e:	8b 17                	mov    (%rdi),%edx
+  803f40:	85 d2                	test   %edx,%edx
+  803f42:	75 01                	jne    803f45 <pipe_wakeup+0x10>
+  803f44:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803f45:	55                   	push   %rbp
+  803f46:	48 89 e5             	mov    %rsp,%rbp
+  803f49:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803f4c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803f52:	be 00 04 00 00       	mov    $0x400,%esi
+  803f57:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  803f5e:	00 00 00 
+  803f61:	ff d0                	call   *%rax
+}
+  803f63:	5d                   	pop    %rbp
+  803f64:	c3                   	ret
+
+0000000000803f65 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803f65:	55                   	push   %rbp
+  803f66:	48 89 e5             	mov    %rsp,%rbp
+  803f69:	41 55                	push   %r13
+  803f6b:	41 54                	push   %r12
+  803f6d:	53                   	push   %rbx
+  803f6e:	48 83 ec 08          	sub    $0x8,%rsp
+  803f72:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803f75:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  803f7c:	00 00 00 
+  803f7f:	ff d0                	call   *%rax
+  803f81:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803f84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f89:	4c 89 e6             	mov    %r12,%rsi
+  803f8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f91:	49 bc 81 18 80 00 00 	movabs $0x801881,%r12
+  803f98:	00 00 00 
+  803f9b:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803f9e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803fa2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803fa6:	49 bd 35 3f 80 00 00 	movabs $0x803f35,%r13
+  803fad:	00 00 00 
+  803fb0:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803fb3:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803fb7:	48 89 de             	mov    %rbx,%rsi
+  803fba:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803fbd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc2:	48 89 de             	mov    %rbx,%rsi
+  803fc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fca:	41 ff d4             	call   *%r12
+  803fcd:	48 83 c4 08          	add    $0x8,%rsp
+  803fd1:	5b                   	pop    %rbx
+  803fd2:	41 5c                	pop    %r12
+  803fd4:	41 5d                	pop    %r13
+  803fd6:	5d                   	pop    %rbp
+  803fd7:	c3                   	ret
+
+0000000000803fd8 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803fd8:	55                   	push   %rbp
+  803fd9:	48 89 e5             	mov    %rsp,%rbp
+  803fdc:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803fdf:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803fe4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fe9:	48 b8 c4 17 80 00 00 	movabs $0x8017c4,%rax
+  803ff0:	00 00 00 
+  803ff3:	ff d0                	call   *%rax
+  803ff5:	85 c0                	test   %eax,%eax
+  803ff7:	0f 94 c0             	sete   %al
+  803ffa:	0f b6 c0             	movzbl %al,%eax
+}
+  803ffd:	5d                   	pop    %rbp
+  803ffe:	c3                   	ret
+
+0000000000803fff <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803fff:	55                   	push   %rbp
+  804000:	48 89 e5             	mov    %rsp,%rbp
+  804003:	41 57                	push   %r15
+  804005:	41 56                	push   %r14
+  804007:	41 55                	push   %r13
+  804009:	41 54                	push   %r12
+  80400b:	53                   	push   %rbx
+  80400c:	48 83 ec 38          	sub    $0x38,%rsp
+  804010:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  804014:	49 89 f4             	mov    %rsi,%r12
+  804017:	49 89 d7             	mov    %rdx,%r15
+  80401a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80401e:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  804025:	00 00 00 
+  804028:	ff d0                	call   *%rax
+  80402a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80402d:	4d 85 ff             	test   %r15,%r15
+  804030:	0f 84 f1 00 00 00    	je     804127 <devpipe_write+0x128>
+  804036:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80403a:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80403e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  804042:	49 bd d8 3f 80 00 00 	movabs $0x803fd8,%r13
+  804049:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80404c:	49 bf 35 3f 80 00 00 	movabs $0x803f35,%r15
+  804053:	00 00 00 
+  804056:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80405a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80405e:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804062:	8b 73 04             	mov    0x4(%rbx),%esi
+  804065:	48 63 ce             	movslq %esi,%rcx
+  804068:	48 63 03             	movslq (%rbx),%rax
+  80406b:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804071:	48 39 c1             	cmp    %rax,%rcx
+  804074:	72 64                	jb     8040da <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  804076:	48 89 de             	mov    %rbx,%rsi
+  804079:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80407d:	41 ff d5             	call   *%r13
+  804080:	85 c0                	test   %eax,%eax
+  804082:	0f 85 b9 00 00 00    	jne    804141 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804088:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80408c:	4c 89 f7             	mov    %r14,%rdi
+  80408f:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804092:	8b 43 04             	mov    0x4(%rbx),%eax
+  804095:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80409c:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040a3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8040a9:	8b 03                	mov    (%rbx),%eax
+  8040ab:	41 39 c4             	cmp    %eax,%r12d
+  8040ae:	75 b2                	jne    804062 <devpipe_write+0x63>
+  8040b0:	48 89 de             	mov    %rbx,%rsi
+  8040b3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8040b7:	41 ff d5             	call   *%r13
+  8040ba:	85 c0                	test   %eax,%eax
+  8040bc:	75 a0                	jne    80405e <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8040be:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8040c3:	44 89 e6             	mov    %r12d,%esi
+  8040c6:	48 89 df             	mov    %rbx,%rdi
+  8040c9:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  8040d0:	00 00 00 
+  8040d3:	ff d0                	call   *%rax
+  8040d5:	e9 7c ff ff ff       	jmp    804056 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8040da:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8040de:	41 0f b6 38          	movzbl (%r8),%edi
+  8040e2:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8040e9:	80 80 80 
+  8040ec:	48 89 c8             	mov    %rcx,%rax
+  8040ef:	48 f7 e2             	mul    %rdx
+  8040f2:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8040f6:	48 89 d0             	mov    %rdx,%rax
+  8040f9:	48 c1 e0 08          	shl    $0x8,%rax
+  8040fd:	48 29 d0             	sub    %rdx,%rax
+  804100:	48 c1 e0 04          	shl    $0x4,%rax
+  804104:	48 29 c1             	sub    %rax,%rcx
+  804107:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80410c:	83 c6 01             	add    $0x1,%esi
+  80410f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804112:	49 83 c0 01          	add    $0x1,%r8
+  804116:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  80411a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80411e:	49 39 c0             	cmp    %rax,%r8
+  804121:	0f 85 2f ff ff ff    	jne    804056 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804127:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80412b:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80412f:	48 b8 35 3f 80 00 00 	movabs $0x803f35,%rax
+  804136:	00 00 00 
+  804139:	ff d0                	call   *%rax
+    return n;
+  80413b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80413f:	eb 05                	jmp    804146 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  804141:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804146:	48 83 c4 38          	add    $0x38,%rsp
+  80414a:	5b                   	pop    %rbx
+  80414b:	41 5c                	pop    %r12
+  80414d:	41 5d                	pop    %r13
+  80414f:	41 5e                	pop    %r14
+  804151:	41 5f                	pop    %r15
+  804153:	5d                   	pop    %rbp
+  804154:	c3                   	ret
+
+0000000000804155 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804155:	55                   	push   %rbp
+  804156:	48 89 e5             	mov    %rsp,%rbp
+  804159:	41 57                	push   %r15
+  80415b:	41 56                	push   %r14
+  80415d:	41 55                	push   %r13
+  80415f:	41 54                	push   %r12
+  804161:	53                   	push   %rbx
+  804162:	48 83 ec 28          	sub    $0x28,%rsp
+  804166:	49 89 fd             	mov    %rdi,%r13
+  804169:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80416d:	49 89 d4             	mov    %rdx,%r12
+  804170:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804174:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  80417b:	00 00 00 
+  80417e:	ff d0                	call   *%rax
+  804180:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804183:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  804189:	49 bf d8 3f 80 00 00 	movabs $0x803fd8,%r15
+  804190:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804193:	4d 85 e4             	test   %r12,%r12
+  804196:	0f 84 d5 00 00 00    	je     804271 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80419c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8041a0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8041a4:	8b 03                	mov    (%rbx),%eax
+  8041a6:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8041a9:	75 7a                	jne    804225 <devpipe_read+0xd0>
+            if (i > 0) {
+  8041ab:	4d 85 f6             	test   %r14,%r14
+  8041ae:	75 50                	jne    804200 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8041b0:	48 89 de             	mov    %rbx,%rsi
+  8041b3:	4c 89 ef             	mov    %r13,%rdi
+  8041b6:	41 ff d7             	call   *%r15
+  8041b9:	85 c0                	test   %eax,%eax
+  8041bb:	0f 85 c9 00 00 00    	jne    80428a <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8041c1:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  8041c4:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8041cb:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8041d1:	8b 43 04             	mov    0x4(%rbx),%eax
+  8041d4:	41 39 c4             	cmp    %eax,%r12d
+  8041d7:	75 cb                	jne    8041a4 <devpipe_read+0x4f>
+  8041d9:	48 89 de             	mov    %rbx,%rsi
+  8041dc:	4c 89 ef             	mov    %r13,%rdi
+  8041df:	41 ff d7             	call   *%r15
+  8041e2:	85 c0                	test   %eax,%eax
+  8041e4:	75 be                	jne    8041a4 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8041e6:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8041eb:	44 89 e6             	mov    %r12d,%esi
+  8041ee:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8041f2:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  8041f9:	00 00 00 
+  8041fc:	ff d0                	call   *%rax
+  8041fe:	eb a4                	jmp    8041a4 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804200:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804204:	48 89 de             	mov    %rbx,%rsi
+  804207:	48 b8 35 3f 80 00 00 	movabs $0x803f35,%rax
+  80420e:	00 00 00 
+  804211:	ff d0                	call   *%rax
+                return i;
+  804213:	4c 89 f0             	mov    %r14,%rax
+}
+  804216:	48 83 c4 28          	add    $0x28,%rsp
+  80421a:	5b                   	pop    %rbx
+  80421b:	41 5c                	pop    %r12
+  80421d:	41 5d                	pop    %r13
+  80421f:	41 5e                	pop    %r14
+  804221:	41 5f                	pop    %r15
+  804223:	5d                   	pop    %rbp
+  804224:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804225:	48 63 c8             	movslq %eax,%rcx
+  804228:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80422f:	80 80 80 
+  804232:	48 89 c8             	mov    %rcx,%rax
+  804235:	48 f7 e2             	mul    %rdx
+  804238:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80423c:	48 89 d0             	mov    %rdx,%rax
+  80423f:	48 c1 e0 08          	shl    $0x8,%rax
+  804243:	48 29 d0             	sub    %rdx,%rax
+  804246:	48 c1 e0 04          	shl    $0x4,%rax
+  80424a:	48 89 c2             	mov    %rax,%rdx
+  80424d:	48 89 c8             	mov    %rcx,%rax
+  804250:	48 29 d0             	sub    %rdx,%rax
+  804253:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  804258:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80425c:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804260:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804263:	49 83 c6 01          	add    $0x1,%r14
+  804267:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80426b:	0f 85 2b ff ff ff    	jne    80419c <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804271:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804275:	48 89 de             	mov    %rbx,%rsi
+  804278:	48 b8 35 3f 80 00 00 	movabs $0x803f35,%rax
+  80427f:	00 00 00 
+  804282:	ff d0                	call   *%rax
+    return n;
+  804284:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804288:	eb 8c                	jmp    804216 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80428a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428f:	eb 85                	jmp    804216 <devpipe_read+0xc1>
+
+0000000000804291 <pipe>:
+pipe(int pfd[2]) {
+  804291:	55                   	push   %rbp
+  804292:	48 89 e5             	mov    %rsp,%rbp
+  804295:	41 55                	push   %r13
+  804297:	41 54                	push   %r12
+  804299:	53                   	push   %rbx
+  80429a:	48 83 ec 18          	sub    $0x18,%rsp
+  80429e:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8042a1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8042a5:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  8042ac:	00 00 00 
+  8042af:	ff d0                	call   *%rax
+  8042b1:	89 c3                	mov    %eax,%ebx
+  8042b3:	85 c0                	test   %eax,%eax
+  8042b5:	0f 88 a0 01 00 00    	js     80445b <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8042bb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8042c0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042c5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8042c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042ce:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  8042d5:	00 00 00 
+  8042d8:	ff d0                	call   *%rax
+  8042da:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8042dc:	85 c0                	test   %eax,%eax
+  8042de:	0f 88 77 01 00 00    	js     80445b <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8042e4:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8042e8:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  8042ef:	00 00 00 
+  8042f2:	ff d0                	call   *%rax
+  8042f4:	89 c3                	mov    %eax,%ebx
+  8042f6:	85 c0                	test   %eax,%eax
+  8042f8:	0f 88 43 01 00 00    	js     804441 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8042fe:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804303:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804308:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80430c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804311:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  804318:	00 00 00 
+  80431b:	ff d0                	call   *%rax
+  80431d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80431f:	85 c0                	test   %eax,%eax
+  804321:	0f 88 1a 01 00 00    	js     804441 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804327:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80432b:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  804332:	00 00 00 
+  804335:	ff d0                	call   *%rax
+  804337:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80433a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80433f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804344:	48 89 c6             	mov    %rax,%rsi
+  804347:	bf 00 00 00 00       	mov    $0x0,%edi
+  80434c:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  804353:	00 00 00 
+  804356:	ff d0                	call   *%rax
+  804358:	89 c3                	mov    %eax,%ebx
+  80435a:	85 c0                	test   %eax,%eax
+  80435c:	0f 88 c5 00 00 00    	js     804427 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804362:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804366:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  80436d:	00 00 00 
+  804370:	ff d0                	call   *%rax
+  804372:	48 89 c1             	mov    %rax,%rcx
+  804375:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80437b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804381:	ba 00 00 00 00       	mov    $0x0,%edx
+  804386:	4c 89 ee             	mov    %r13,%rsi
+  804389:	bf 00 00 00 00       	mov    $0x0,%edi
+  80438e:	48 b8 31 18 80 00 00 	movabs $0x801831,%rax
+  804395:	00 00 00 
+  804398:	ff d0                	call   *%rax
+  80439a:	89 c3                	mov    %eax,%ebx
+  80439c:	85 c0                	test   %eax,%eax
+  80439e:	78 6e                	js     80440e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8043a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8043a5:	4c 89 ef             	mov    %r13,%rdi
+  8043a8:	48 b8 a0 17 80 00 00 	movabs $0x8017a0,%rax
+  8043af:	00 00 00 
+  8043b2:	ff d0                	call   *%rax
+  8043b4:	83 f8 02             	cmp    $0x2,%eax
+  8043b7:	0f 85 ab 00 00 00    	jne    804468 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8043bd:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  8043c4:	00 00 
+  8043c6:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8043ca:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8043cc:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8043d0:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8043d7:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8043db:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8043dd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8043e1:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8043e8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8043ec:	48 bb d5 1d 80 00 00 	movabs $0x801dd5,%rbx
+  8043f3:	00 00 00 
+  8043f6:	ff d3                	call   *%rbx
+  8043f8:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8043fc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804400:	ff d3                	call   *%rbx
+  804402:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804407:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80440c:	eb 4d                	jmp    80445b <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80440e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804413:	4c 89 ee             	mov    %r13,%rsi
+  804416:	bf 00 00 00 00       	mov    $0x0,%edi
+  80441b:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  804422:	00 00 00 
+  804425:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804427:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80442c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804430:	bf 00 00 00 00       	mov    $0x0,%edi
+  804435:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  80443c:	00 00 00 
+  80443f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804441:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804446:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80444a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80444f:	48 b8 81 18 80 00 00 	movabs $0x801881,%rax
+  804456:	00 00 00 
+  804459:	ff d0                	call   *%rax
+}
+  80445b:	89 d8                	mov    %ebx,%eax
+  80445d:	48 83 c4 18          	add    $0x18,%rsp
+  804461:	5b                   	pop    %rbx
+  804462:	41 5c                	pop    %r12
+  804464:	41 5d                	pop    %r13
+  804466:	5d                   	pop    %rbp
+  804467:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804468:	48 b9 70 56 80 00 00 	movabs $0x805670,%rcx
+  80446f:	00 00 00 
+  804472:	48 ba 47 56 80 00 00 	movabs $0x805647,%rdx
+  804479:	00 00 00 
+  80447c:	be 50 00 00 00       	mov    $0x50,%esi
+  804481:	48 bf 5c 56 80 00 00 	movabs $0x80565c,%rdi
+  804488:	00 00 00 
+  80448b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804490:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  804497:	00 00 00 
+  80449a:	41 ff d0             	call   *%r8
+
+000000000080449d <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80449d:	55                   	push   %rbp
+  80449e:	48 89 e5             	mov    %rsp,%rbp
+  8044a1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8044a9:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  8044b0:	00 00 00 
+  8044b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044b5:	85 c0                	test   %eax,%eax
+  8044b7:	78 23                	js     8044dc <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8044b9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044bd:	48 b8 e7 1d 80 00 00 	movabs $0x801de7,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+  8044c9:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8044cc:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8044d0:	48 b8 d8 3f 80 00 00 	movabs $0x803fd8,%rax
+  8044d7:	00 00 00 
+  8044da:	ff d0                	call   *%rax
+}
+  8044dc:	c9                   	leave
+  8044dd:	c3                   	ret
+
+00000000008044de <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8044de:	48 89 f8             	mov    %rdi,%rax
+  8044e1:	48 c1 e8 27          	shr    $0x27,%rax
+  8044e5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8044ec:	01 00 00 
+  8044ef:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8044f3:	f6 c2 01             	test   $0x1,%dl
+  8044f6:	74 6d                	je     804565 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8044f8:	48 89 f8             	mov    %rdi,%rax
+  8044fb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8044ff:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804506:	01 00 00 
+  804509:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80450d:	f6 c2 01             	test   $0x1,%dl
+  804510:	74 62                	je     804574 <get_uvpt_entry+0x96>
+  804512:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804519:	01 00 00 
+  80451c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804520:	f6 c2 80             	test   $0x80,%dl
+  804523:	75 4f                	jne    804574 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804525:	48 89 f8             	mov    %rdi,%rax
+  804528:	48 c1 e8 15          	shr    $0x15,%rax
+  80452c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804533:	01 00 00 
+  804536:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80453a:	f6 c2 01             	test   $0x1,%dl
+  80453d:	74 44                	je     804583 <get_uvpt_entry+0xa5>
+  80453f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804546:	01 00 00 
+  804549:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80454d:	f6 c2 80             	test   $0x80,%dl
+  804550:	75 31                	jne    804583 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804552:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804556:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80455d:	01 00 00 
+  804560:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804564:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804565:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80456c:	01 00 00 
+  80456f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804573:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804574:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80457b:	01 00 00 
+  80457e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804582:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804583:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80458a:	01 00 00 
+  80458d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804591:	c3                   	ret
+
+0000000000804592 <get_prot>:
+
+int
+get_prot(void *va) {
+  804592:	55                   	push   %rbp
+  804593:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804596:	48 b8 de 44 80 00 00 	movabs $0x8044de,%rax
+  80459d:	00 00 00 
+  8045a0:	ff d0                	call   *%rax
+  8045a2:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8045a5:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8045aa:	89 c1                	mov    %eax,%ecx
+  8045ac:	83 c9 04             	or     $0x4,%ecx
+  8045af:	f6 c2 01             	test   $0x1,%dl
+  8045b2:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8045b5:	89 c1                	mov    %eax,%ecx
+  8045b7:	83 c9 02             	or     $0x2,%ecx
+  8045ba:	f6 c2 02             	test   $0x2,%dl
+  8045bd:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8045c0:	89 c1                	mov    %eax,%ecx
+  8045c2:	83 c9 01             	or     $0x1,%ecx
+  8045c5:	48 85 d2             	test   %rdx,%rdx
+  8045c8:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8045cb:	89 c1                	mov    %eax,%ecx
+  8045cd:	83 c9 40             	or     $0x40,%ecx
+  8045d0:	f6 c6 04             	test   $0x4,%dh
+  8045d3:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8045d6:	5d                   	pop    %rbp
+  8045d7:	c3                   	ret
+
+00000000008045d8 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8045d8:	55                   	push   %rbp
+  8045d9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8045dc:	48 b8 de 44 80 00 00 	movabs $0x8044de,%rax
+  8045e3:	00 00 00 
+  8045e6:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8045e8:	48 c1 e8 06          	shr    $0x6,%rax
+  8045ec:	83 e0 01             	and    $0x1,%eax
+}
+  8045ef:	5d                   	pop    %rbp
+  8045f0:	c3                   	ret
+
+00000000008045f1 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8045f1:	55                   	push   %rbp
+  8045f2:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8045f5:	48 b8 de 44 80 00 00 	movabs $0x8044de,%rax
+  8045fc:	00 00 00 
+  8045ff:	ff d0                	call   *%rax
+  804601:	83 e0 01             	and    $0x1,%eax
+}
+  804604:	5d                   	pop    %rbp
+  804605:	c3                   	ret
+
+0000000000804606 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804606:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80460d:	01 00 00 
+  804610:	a8 01                	test   $0x1,%al
+  804612:	75 06                	jne    80461a <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804614:	b8 00 00 00 00       	mov    $0x0,%eax
+  804619:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80461a:	55                   	push   %rbp
+  80461b:	48 89 e5             	mov    %rsp,%rbp
+  80461e:	41 57                	push   %r15
+  804620:	41 56                	push   %r14
+  804622:	41 55                	push   %r13
+  804624:	41 54                	push   %r12
+  804626:	53                   	push   %rbx
+  804627:	48 83 ec 28          	sub    $0x28,%rsp
+  80462b:	49 89 fe             	mov    %rdi,%r14
+  80462e:	49 89 f7             	mov    %rsi,%r15
+  804631:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804638:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804639:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804640:	01 00 00 
+  804643:	e9 ae 00 00 00       	jmp    8046f6 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804648:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80464f:	49 83 ec 01          	sub    $0x1,%r12
+  804653:	74 2d                	je     804682 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804655:	48 89 d8             	mov    %rbx,%rax
+  804658:	48 c1 e8 0c          	shr    $0xc,%rax
+  80465c:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804661:	f6 c2 01             	test   $0x1,%dl
+  804664:	74 e2                	je     804648 <foreach_shared_region+0x42>
+  804666:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80466b:	f6 c4 04             	test   $0x4,%ah
+  80466e:	74 d8                	je     804648 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804670:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804677:	4c 89 fa             	mov    %r15,%rdx
+  80467a:	48 89 df             	mov    %rbx,%rdi
+  80467d:	41 ff d6             	call   *%r14
+  804680:	eb c6                	jmp    804648 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804682:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804689:	00 
+  80468a:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80468f:	74 4a                	je     8046db <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804691:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804695:	48 c1 e8 15          	shr    $0x15,%rax
+  804699:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8046a0:	01 00 00 
+  8046a3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8046a7:	a8 01                	test   $0x1,%al
+  8046a9:	74 d7                	je     804682 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8046ab:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8046af:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8046b6:	48 39 c3             	cmp    %rax,%rbx
+  8046b9:	73 c7                	jae    804682 <foreach_shared_region+0x7c>
+  8046bb:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8046c2:	48 39 d0             	cmp    %rdx,%rax
+  8046c5:	4d 19 e4             	sbb    %r12,%r12
+  8046c8:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8046cf:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8046d6:	e9 7a ff ff ff       	jmp    804655 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8046db:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8046e2:	40 
+  8046e3:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8046e7:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046ee:	00 00 00 
+  8046f1:	48 39 c1             	cmp    %rax,%rcx
+  8046f4:	74 50                	je     804746 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8046f6:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8046fa:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046fe:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804705:	01 00 00 
+  804708:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80470c:	a8 01                	test   $0x1,%al
+  80470e:	74 cb                	je     8046db <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804710:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804714:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80471b:	48 39 c1             	cmp    %rax,%rcx
+  80471e:	73 bb                	jae    8046db <foreach_shared_region+0xd5>
+  804720:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804727:	48 39 d0             	cmp    %rdx,%rax
+  80472a:	48 19 c0             	sbb    %rax,%rax
+  80472d:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804733:	48 05 00 02 00 00    	add    $0x200,%rax
+  804739:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80473d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804741:	e9 4b ff ff ff       	jmp    804691 <foreach_shared_region+0x8b>
+  804746:	b8 00 00 00 00       	mov    $0x0,%eax
+  80474b:	48 83 c4 28          	add    $0x28,%rsp
+  80474f:	5b                   	pop    %rbx
+  804750:	41 5c                	pop    %r12
+  804752:	41 5d                	pop    %r13
+  804754:	41 5e                	pop    %r14
+  804756:	41 5f                	pop    %r15
+  804758:	5d                   	pop    %rbp
+  804759:	c3                   	ret
+
+000000000080475a <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80475a:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804760:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804767:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80476e:	c3                   	ret
+
+000000000080476f <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80476f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804772:	8b 17                	mov    (%rdi),%edx
+  804774:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804776:	83 f8 0f             	cmp    $0xf,%eax
+  804779:	77 13                	ja     80478e <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80477b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80477e:	83 e0 0f             	and    $0xf,%eax
+  804781:	48 c1 e0 09          	shl    $0x9,%rax
+  804785:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80478c:	00 
+  80478d:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80478e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804793:	c3                   	ret
+
+0000000000804794 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804794:	8b 47 40             	mov    0x40(%rdi),%eax
+  804797:	83 c0 01             	add    $0x1,%eax
+  80479a:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80479d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8047a3:	8b 57 04             	mov    0x4(%rdi),%edx
+  8047a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ab:	85 d2                	test   %edx,%edx
+  8047ad:	75 04                	jne    8047b3 <chan_publish+0x1f>
+  8047af:	83 e0 01             	and    $0x1,%eax
+}
+  8047b2:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8047b3:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8047b6:	85 c0                	test   %eax,%eax
+  8047b8:	0f 95 c0             	setne  %al
+  8047bb:	0f b6 c0             	movzbl %al,%eax
+  8047be:	eb ef                	jmp    8047af <chan_publish+0x1b>
+
+00000000008047c0 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8047c0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8047c3:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8047c5:	29 d0                	sub    %edx,%eax
+  8047c7:	83 e8 01             	sub    $0x1,%eax
+  8047ca:	83 f8 0f             	cmp    $0xf,%eax
+  8047cd:	77 12                	ja     8047e1 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8047cf:	8b 07                	mov    (%rdi),%eax
+  8047d1:	83 e0 0f             	and    $0xf,%eax
+  8047d4:	48 c1 e0 09          	shl    $0x9,%rax
+  8047d8:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8047df:	00 
+  8047e0:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8047e1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047e6:	c3                   	ret
+
+00000000008047e7 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8047e7:	8b 07                	mov    (%rdi),%eax
+  8047e9:	83 c0 01             	add    $0x1,%eax
+  8047ec:	89 07                	mov    %eax,(%rdi)
+}
+  8047ee:	c3                   	ret
+
+00000000008047ef <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8047ef:	55                   	push   %rbp
+  8047f0:	48 89 e5             	mov    %rsp,%rbp
+  8047f3:	53                   	push   %rbx
+  8047f4:	48 83 ec 08          	sub    $0x8,%rsp
+  8047f8:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8047fb:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804802:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804808:	48 b8 c0 47 80 00 00 	movabs $0x8047c0,%rax
+  80480f:	00 00 00 
+  804812:	ff d0                	call   *%rax
+  804814:	48 85 c0             	test   %rax,%rax
+  804817:	74 12                	je     80482b <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804819:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804820:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804825:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804829:	c9                   	leave
+  80482a:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80482b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804830:	eb f3                	jmp    804825 <chan_arm+0x36>
+
+0000000000804832 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804832:	55                   	push   %rbp
+  804833:	48 89 e5             	mov    %rsp,%rbp
+  804836:	41 56                	push   %r14
+  804838:	41 55                	push   %r13
+  80483a:	41 54                	push   %r12
+  80483c:	53                   	push   %rbx
+  80483d:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804840:	49 bc ef 47 80 00 00 	movabs $0x8047ef,%r12
+  804847:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80484a:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80484e:	49 bd 49 1b 80 00 00 	movabs $0x801b49,%r13
+  804855:	00 00 00 
+    while (chan_arm(r))
+  804858:	eb 0d                	jmp    804867 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80485a:	8b 33                	mov    (%rbx),%esi
+  80485c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804861:	4c 89 f7             	mov    %r14,%rdi
+  804864:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804867:	48 89 df             	mov    %rbx,%rdi
+  80486a:	41 ff d4             	call   *%r12
+  80486d:	84 c0                	test   %al,%al
+  80486f:	75 e9                	jne    80485a <chan_wait+0x28>
+}
+  804871:	5b                   	pop    %rbx
+  804872:	41 5c                	pop    %r12
+  804874:	41 5d                	pop    %r13
+  804876:	41 5e                	pop    %r14
+  804878:	5d                   	pop    %rbp
+  804879:	c3                   	ret
+
+000000000080487a <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80487a:	55                   	push   %rbp
+  80487b:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80487e:	48 83 c7 40          	add    $0x40,%rdi
+  804882:	be 01 00 00 00       	mov    $0x1,%esi
+  804887:	48 b8 67 1b 80 00 00 	movabs $0x801b67,%rax
+  80488e:	00 00 00 
+  804891:	ff d0                	call   *%rax
+}
+  804893:	5d                   	pop    %rbp
+  804894:	c3                   	ret
+
+0000000000804895 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804895:	b8 00 00 00 00       	mov    $0x0,%eax
+  80489a:	c3                   	ret
+
+000000000080489b <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80489b:	55                   	push   %rbp
+  80489c:	48 89 e5             	mov    %rsp,%rbp
+  80489f:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8048a2:	48 be 94 56 80 00 00 	movabs $0x805694,%rsi
+  8048a9:	00 00 00 
+  8048ac:	48 b8 7c 12 80 00 00 	movabs $0x80127c,%rax
+  8048b3:	00 00 00 
+  8048b6:	ff d0                	call   *%rax
+    return 0;
+}
+  8048b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048bd:	5d                   	pop    %rbp
+  8048be:	c3                   	ret
+
+00000000008048bf <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8048bf:	55                   	push   %rbp
+  8048c0:	48 89 e5             	mov    %rsp,%rbp
+  8048c3:	41 57                	push   %r15
+  8048c5:	41 56                	push   %r14
+  8048c7:	41 55                	push   %r13
+  8048c9:	41 54                	push   %r12
+  8048cb:	53                   	push   %rbx
+  8048cc:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8048d3:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8048da:	48 85 d2             	test   %rdx,%rdx
+  8048dd:	74 7a                	je     804959 <devcons_write+0x9a>
+  8048df:	49 89 d6             	mov    %rdx,%r14
+  8048e2:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8048e8:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8048ed:	49 bf 76 14 80 00 00 	movabs $0x801476,%r15
+  8048f4:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8048f7:	4c 89 f3             	mov    %r14,%rbx
+  8048fa:	48 29 f3             	sub    %rsi,%rbx
+  8048fd:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804902:	48 39 c3             	cmp    %rax,%rbx
+  804905:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804909:	4c 63 eb             	movslq %ebx,%r13
+  80490c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804913:	48 01 c6             	add    %rax,%rsi
+  804916:	4c 89 ea             	mov    %r13,%rdx
+  804919:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804920:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804923:	4c 89 ee             	mov    %r13,%rsi
+  804926:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80492d:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  804934:	00 00 00 
+  804937:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804939:	41 01 dc             	add    %ebx,%r12d
+  80493c:	49 63 f4             	movslq %r12d,%rsi
+  80493f:	4c 39 f6             	cmp    %r14,%rsi
+  804942:	72 b3                	jb     8048f7 <devcons_write+0x38>
+    return res;
+  804944:	49 63 c4             	movslq %r12d,%rax
+}
+  804947:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80494e:	5b                   	pop    %rbx
+  80494f:	41 5c                	pop    %r12
+  804951:	41 5d                	pop    %r13
+  804953:	41 5e                	pop    %r14
+  804955:	41 5f                	pop    %r15
+  804957:	5d                   	pop    %rbp
+  804958:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804959:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80495f:	eb e3                	jmp    804944 <devcons_write+0x85>
+
+0000000000804961 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804961:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804964:	ba 00 00 00 00       	mov    $0x0,%edx
+  804969:	48 85 c0             	test   %rax,%rax
+  80496c:	74 55                	je     8049c3 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80496e:	55                   	push   %rbp
+  80496f:	48 89 e5             	mov    %rsp,%rbp
+  804972:	41 55                	push   %r13
+  804974:	41 54                	push   %r12
+  804976:	53                   	push   %rbx
+  804977:	48 83 ec 08          	sub    $0x8,%rsp
+  80497b:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80497e:	48 bb c2 16 80 00 00 	movabs $0x8016c2,%rbx
+  804985:	00 00 00 
+  804988:	49 bc 77 17 80 00 00 	movabs $0x801777,%r12
+  80498f:	00 00 00 
+  804992:	eb 03                	jmp    804997 <devcons_read+0x36>
+  804994:	41 ff d4             	call   *%r12
+  804997:	ff d3                	call   *%rbx
+  804999:	85 c0                	test   %eax,%eax
+  80499b:	74 f7                	je     804994 <devcons_read+0x33>
+    if (c < 0) return c;
+  80499d:	48 63 d0             	movslq %eax,%rdx
+  8049a0:	78 13                	js     8049b5 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8049a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049a7:	83 f8 04             	cmp    $0x4,%eax
+  8049aa:	74 09                	je     8049b5 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8049ac:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8049b0:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8049b5:	48 89 d0             	mov    %rdx,%rax
+  8049b8:	48 83 c4 08          	add    $0x8,%rsp
+  8049bc:	5b                   	pop    %rbx
+  8049bd:	41 5c                	pop    %r12
+  8049bf:	41 5d                	pop    %r13
+  8049c1:	5d                   	pop    %rbp
+  8049c2:	c3                   	ret
+  8049c3:	48 89 d0             	mov    %rdx,%rax
+  8049c6:	c3                   	ret
+
+00000000008049c7 <cputchar>:
+cputchar(int ch) {
+  8049c7:	55                   	push   %rbp
+  8049c8:	48 89 e5             	mov    %rsp,%rbp
+  8049cb:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8049cf:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8049d3:	be 01 00 00 00       	mov    $0x1,%esi
+  8049d8:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8049dc:	48 b8 a3 16 80 00 00 	movabs $0x8016a3,%rax
+  8049e3:	00 00 00 
+  8049e6:	ff d0                	call   *%rax
+}
+  8049e8:	c9                   	leave
+  8049e9:	c3                   	ret
+
+00000000008049ea <getchar>:
+getchar(void) {
+  8049ea:	55                   	push   %rbp
+  8049eb:	48 89 e5             	mov    %rsp,%rbp
+  8049ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8049f2:	ba 01 00 00 00       	mov    $0x1,%edx
+  8049f7:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8049fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a00:	48 b8 46 21 80 00 00 	movabs $0x802146,%rax
+  804a07:	00 00 00 
+  804a0a:	ff d0                	call   *%rax
+  804a0c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804a0e:	85 c0                	test   %eax,%eax
+  804a10:	78 06                	js     804a18 <getchar+0x2e>
+  804a12:	74 08                	je     804a1c <getchar+0x32>
+  804a14:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804a18:	89 d0                	mov    %edx,%eax
+  804a1a:	c9                   	leave
+  804a1b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804a1c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804a21:	eb f5                	jmp    804a18 <getchar+0x2e>
+
+0000000000804a23 <iscons>:
+iscons(int fdnum) {
+  804a23:	55                   	push   %rbp
+  804a24:	48 89 e5             	mov    %rsp,%rbp
+  804a27:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804a2b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804a2f:	48 b8 63 1e 80 00 00 	movabs $0x801e63,%rax
+  804a36:	00 00 00 
+  804a39:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804a3b:	85 c0                	test   %eax,%eax
+  804a3d:	78 18                	js     804a57 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804a3f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a43:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804a4a:	00 00 00 
+  804a4d:	8b 00                	mov    (%rax),%eax
+  804a4f:	39 02                	cmp    %eax,(%rdx)
+  804a51:	0f 94 c0             	sete   %al
+  804a54:	0f b6 c0             	movzbl %al,%eax
+}
+  804a57:	c9                   	leave
+  804a58:	c3                   	ret
+
+0000000000804a59 <opencons>:
+opencons(void) {
+  804a59:	55                   	push   %rbp
+  804a5a:	48 89 e5             	mov    %rsp,%rbp
+  804a5d:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804a61:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804a65:	48 b8 03 1e 80 00 00 	movabs $0x801e03,%rax
+  804a6c:	00 00 00 
+  804a6f:	ff d0                	call   *%rax
+  804a71:	85 c0                	test   %eax,%eax
+  804a73:	78 49                	js     804abe <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804a75:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804a7a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a7f:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804a83:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a88:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  804a8f:	00 00 00 
+  804a92:	ff d0                	call   *%rax
+  804a94:	85 c0                	test   %eax,%eax
+  804a96:	78 26                	js     804abe <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804a98:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804a9c:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804aa3:	00 00 
+  804aa5:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804aa7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804aab:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804ab2:	48 b8 d5 1d 80 00 00 	movabs $0x801dd5,%rax
+  804ab9:	00 00 00 
+  804abc:	ff d0                	call   *%rax
+}
+  804abe:	c9                   	leave
+  804abf:	c3                   	ret
+
+0000000000804ac0 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804ac0:	55                   	push   %rbp
+  804ac1:	48 89 e5             	mov    %rsp,%rbp
+  804ac4:	41 56                	push   %r14
+  804ac6:	41 55                	push   %r13
+  804ac8:	41 54                	push   %r12
+  804aca:	53                   	push   %rbx
+  804acb:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804ace:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804ad5:	00 00 00 
+  804ad8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804adc:	74 27                	je     804b05 <_handle_vectored_pagefault+0x45>
+  804ade:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804ae3:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  804aea:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804aed:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804af0:	4c 89 e7             	mov    %r12,%rdi
+  804af3:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804af8:	84 c0                	test   %al,%al
+  804afa:	75 45                	jne    804b41 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804afc:	48 83 c3 01          	add    $0x1,%rbx
+  804b00:	49 3b 1e             	cmp    (%r14),%rbx
+  804b03:	72 eb                	jb     804af0 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804b05:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804b0c:	00 
+  804b0d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804b12:	4d 8b 04 24          	mov    (%r12),%r8
+  804b16:	48 ba a0 56 80 00 00 	movabs $0x8056a0,%rdx
+  804b1d:	00 00 00 
+  804b20:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804b25:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  804b2c:	00 00 00 
+  804b2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b34:	49 ba 07 08 80 00 00 	movabs $0x800807,%r10
+  804b3b:	00 00 00 
+  804b3e:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804b41:	5b                   	pop    %rbx
+  804b42:	41 5c                	pop    %r12
+  804b44:	41 5d                	pop    %r13
+  804b46:	41 5e                	pop    %r14
+  804b48:	5d                   	pop    %rbp
+  804b49:	c3                   	ret
+
+0000000000804b4a <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804b4a:	55                   	push   %rbp
+  804b4b:	48 89 e5             	mov    %rsp,%rbp
+  804b4e:	53                   	push   %rbx
+  804b4f:	48 83 ec 08          	sub    $0x8,%rsp
+  804b53:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804b56:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804b5d:	00 00 00 
+  804b60:	80 38 00             	cmpb   $0x0,(%rax)
+  804b63:	0f 84 84 00 00 00    	je     804bed <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804b69:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804b70:	00 00 00 
+  804b73:	48 8b 10             	mov    (%rax),%rdx
+  804b76:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804b7b:	48 b9 00 10 85 00 00 	movabs $0x851000,%rcx
+  804b82:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804b85:	48 85 d2             	test   %rdx,%rdx
+  804b88:	74 19                	je     804ba3 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804b8a:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804b8e:	0f 84 e8 00 00 00    	je     804c7c <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804b94:	48 83 c0 01          	add    $0x1,%rax
+  804b98:	48 39 d0             	cmp    %rdx,%rax
+  804b9b:	75 ed                	jne    804b8a <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804b9d:	48 83 fa 08          	cmp    $0x8,%rdx
+  804ba1:	74 1c                	je     804bbf <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804ba3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804ba7:	48 a3 48 10 85 00 00 	movabs %rax,0x851048
+  804bae:	00 00 00 
+  804bb1:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804bb8:	00 00 00 
+  804bbb:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804bbf:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  804bc6:	00 00 00 
+  804bc9:	ff d0                	call   *%rax
+  804bcb:	89 c7                	mov    %eax,%edi
+  804bcd:	48 be 42 4d 80 00 00 	movabs $0x804d42,%rsi
+  804bd4:	00 00 00 
+  804bd7:	48 b8 99 19 80 00 00 	movabs $0x801999,%rax
+  804bde:	00 00 00 
+  804be1:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804be3:	85 c0                	test   %eax,%eax
+  804be5:	78 68                	js     804c4f <add_pgfault_handler+0x105>
+    return res;
+}
+  804be7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804beb:	c9                   	leave
+  804bec:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804bed:	48 b8 4e 17 80 00 00 	movabs $0x80174e,%rax
+  804bf4:	00 00 00 
+  804bf7:	ff d0                	call   *%rax
+  804bf9:	89 c7                	mov    %eax,%edi
+  804bfb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804c00:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804c05:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804c0c:	00 00 00 
+  804c0f:	48 b8 db 17 80 00 00 	movabs $0x8017db,%rax
+  804c16:	00 00 00 
+  804c19:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804c1b:	48 ba 48 10 85 00 00 	movabs $0x851048,%rdx
+  804c22:	00 00 00 
+  804c25:	48 8b 02             	mov    (%rdx),%rax
+  804c28:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804c2c:	48 89 0a             	mov    %rcx,(%rdx)
+  804c2f:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804c36:	00 00 00 
+  804c39:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804c3d:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804c44:	00 00 00 
+  804c47:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804c4a:	e9 70 ff ff ff       	jmp    804bbf <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804c4f:	89 c1                	mov    %eax,%ecx
+  804c51:	48 ba de 56 80 00 00 	movabs $0x8056de,%rdx
+  804c58:	00 00 00 
+  804c5b:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804c60:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  804c67:	00 00 00 
+  804c6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c6f:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  804c76:	00 00 00 
+  804c79:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c81:	e9 61 ff ff ff       	jmp    804be7 <add_pgfault_handler+0x9d>
+
+0000000000804c86 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804c86:	55                   	push   %rbp
+  804c87:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804c8a:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804c91:	00 00 00 
+  804c94:	80 38 00             	cmpb   $0x0,(%rax)
+  804c97:	74 33                	je     804ccc <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804c99:	48 a1 48 10 85 00 00 	movabs 0x851048,%rax
+  804ca0:	00 00 00 
+  804ca3:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804ca8:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804caf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804cb2:	48 85 c0             	test   %rax,%rax
+  804cb5:	0f 84 85 00 00 00    	je     804d40 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804cbb:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804cbf:	74 40                	je     804d01 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804cc1:	48 83 c1 01          	add    $0x1,%rcx
+  804cc5:	48 39 c1             	cmp    %rax,%rcx
+  804cc8:	75 f1                	jne    804cbb <remove_pgfault_handler+0x35>
+  804cca:	eb 74                	jmp    804d40 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804ccc:	48 b9 f6 56 80 00 00 	movabs $0x8056f6,%rcx
+  804cd3:	00 00 00 
+  804cd6:	48 ba 47 56 80 00 00 	movabs $0x805647,%rdx
+  804cdd:	00 00 00 
+  804ce0:	be 43 00 00 00       	mov    $0x43,%esi
+  804ce5:	48 bf d0 56 80 00 00 	movabs $0x8056d0,%rdi
+  804cec:	00 00 00 
+  804cef:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cf4:	49 b8 07 08 80 00 00 	movabs $0x800807,%r8
+  804cfb:	00 00 00 
+  804cfe:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804d01:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804d08:	00 
+  804d09:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804d0d:	48 29 ca             	sub    %rcx,%rdx
+  804d10:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804d17:	00 00 00 
+  804d1a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804d1e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804d23:	48 89 ce             	mov    %rcx,%rsi
+  804d26:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  804d2d:	00 00 00 
+  804d30:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804d32:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804d39:	00 00 00 
+  804d3c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804d40:	5d                   	pop    %rbp
+  804d41:	c3                   	ret
+
+0000000000804d42 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804d42:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804d45:	48 b8 c0 4a 80 00 00 	movabs $0x804ac0,%rax
+  804d4c:	00 00 00 
+    call *%rax
+  804d4f:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804d51:	41 5f                	pop    %r15
+	popq %r15
+  804d53:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804d55:	41 5f                	pop    %r15
+	popq %r14
+  804d57:	41 5e                	pop    %r14
+	popq %r13
+  804d59:	41 5d                	pop    %r13
+	popq %r12
+  804d5b:	41 5c                	pop    %r12
+	popq %r11
+  804d5d:	41 5b                	pop    %r11
+	popq %r10
+  804d5f:	41 5a                	pop    %r10
+	popq %r9
+  804d61:	41 59                	pop    %r9
+	popq %r8
+  804d63:	41 58                	pop    %r8
+	popq %rsi
+  804d65:	5e                   	pop    %rsi
+	popq %rdi
+  804d66:	5f                   	pop    %rdi
+	popq %rbp
+  804d67:	5d                   	pop    %rbp
+	popq %rdx
+  804d68:	5a                   	pop    %rdx
+	popq %rcx
+  804d69:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804d6a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804d6f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804d74:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804d78:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804d7b:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804d80:	5b                   	pop    %rbx
+	popq %rax
+  804d81:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804d82:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804d86:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804d87:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804d8c:	c3                   	ret
+  804d8d:	0f 1f 00             	nopl   (%rax)
+
+0000000000804d90 <__rodata_start>:
+  804d90:	2f                   	(bad)
+  804d91:	62                   	(bad)
+  804d92:	69 67 66 69 6c 65 00 	imul   $0x656c69,0x66(%rdi),%esp
+  804d99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d9a:	70 65                	jo     804e01 <__rodata_start+0x71>
+  804d9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d9d:	20 2f                	and    %ch,(%rdi)
+  804d9f:	62                   	(bad)
+  804da0:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804da7:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f54e16 <__bss_end+0x73702e16>
+  804dad:	65 72 2f             	gs jb  804ddf <__rodata_start+0x4f>
+  804db0:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804db7:	63 
+  804db8:	68 2e 63 00 64       	push   $0x6400632e
+  804dbd:	69 73 6b 5f 73 74 61 	imul   $0x6174735f,0x6b(%rbx),%esi
+  804dc4:	74 3a                	je     804e00 <__rodata_start+0x70>
+  804dc6:	20 25 69 00 72 65    	and    %ah,0x65720069(%rip)        # 65f24e35 <__bss_end+0x656d2e35>
+  804dcc:	61                   	(bad)
+  804dcd:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804dd0:	62                   	(bad)
+  804dd1:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804dd8:	20 25 69 00 6e 6f    	and    %ah,0x6f6e0069(%rip)        # 6fee4e47 <__bss_end+0x6f692e47>
+  804dde:	20 66 69             	and    %ah,0x69(%rsi)
+  804de1:	6c                   	insb   (%dx),%es:(%rdi)
+  804de2:	65 20 73 65          	and    %dh,%gs:0x65(%rbx)
+  804de6:	72 76                	jb     804e5e <__rodata_start+0xce>
+  804de8:	65 72 00             	gs jb  804deb <__rodata_start+0x5b>
+  804deb:	63 61 63             	movsxd 0x63(%rcx),%esp
+  804dee:	68 65 64 00 2f       	push   $0x2f006465
+  804df3:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804dfa:	63 
+  804dfb:	68 00 6f 70 65       	push   $0x65706f00
+  804e00:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e01:	20 2f                	and    %ch,(%rdi)
+  804e03:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804e0a:	63 
+  804e0b:	68 3a 20 25 69       	push   $0x6925203a
+  804e10:	00 77 72             	add    %dh,0x72(%rdi)
+  804e13:	69 74 65 20 2f 64 69 	imul   $0x7369642f,0x20(%rbp,%riz,2),%esi
+  804e1a:	73 
+  804e1b:	6b 62 65 6e          	imul   $0x6e,0x65(%rdx),%esp
+  804e1f:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804e22:	20 25 69 00 66 73    	and    %ah,0x73660069(%rip)        # 73e64e91 <__bss_end+0x73612e91>
+  804e28:	79 6e                	jns    804e98 <__rodata_start+0x108>
+  804e2a:	63 3a                	movsxd (%rdx),%edi
+  804e2c:	20 25 69 00 63 6c    	and    %ah,0x6c630069(%rip)        # 6ce34e9b <__bss_end+0x6c5e2e9b>
+  804e32:	65 61                	gs (bad)
+  804e34:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e35:	20 73 79             	and    %dh,0x79(%rbx)
+  804e38:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e39:	63 00                	movsxd (%rax),%eax
+  804e3b:	63 61 63             	movsxd 0x63(%rcx),%esp
+  804e3e:	68 65 5f 73 74       	push   $0x74735f65
+  804e43:	61                   	(bad)
+  804e44:	74 3a                	je     804e80 <__rodata_start+0xf0>
+  804e46:	20 25 69 00 66 0f    	and    %ah,0xf660069(%rip)        # fe64eb5 <__bss_end+0xf612eb5>
+  804e4c:	1f                   	(bad)
+  804e4d:	44 00 00             	add    %r8b,(%rax)
+  804e50:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804e57:	63 
+  804e58:	68 3a 20 25 73       	push   $0x7325203a
+  804e5d:	3a 20                	cmp    (%rax),%ah
+  804e5f:	25 6c 75 20 4b       	and    $0x4b20756c,%eax
+  804e64:	42 2c 20             	rex.X sub $0x20,%al
+  804e67:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  804e6c:	42 2f                	rex.X (bad)
+  804e6e:	73 2c                	jae    804e9c <__rodata_start+0x10c>
+  804e70:	20 66 69             	and    %ah,0x69(%rsi)
+  804e73:	6c                   	insb   (%dx),%es:(%rdi)
+  804e74:	65 20 73 65          	and    %dh,%gs:0x65(%rbx)
+  804e78:	72 76                	jb     804ef0 <__rodata_start+0x160>
+  804e7a:	65 72 20             	gs jb  804e9d <__rodata_start+0x10d>
+  804e7d:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  804e82:	79 63                	jns    804ee7 <__rodata_start+0x157>
+  804e84:	6c                   	insb   (%dx),%es:(%rdi)
+  804e85:	65 73 20             	gs jae 804ea8 <__rodata_start+0x118>
+  804e88:	70 65                	jo     804eef <__rodata_start+0x15f>
+  804e8a:	72 20                	jb     804eac <__rodata_start+0x11c>
+  804e8c:	62                   	(bad)
+  804e8d:	6c                   	insb   (%dx),%es:(%rdi)
+  804e8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e8f:	63 6b 0a             	movsxd 0xa(%rbx),%ebp
+  804e92:	00 00                	add    %al,(%rax)
+  804e94:	00 00                	add    %al,(%rax)
+  804e96:	00 00                	add    %al,(%rax)
+  804e98:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804e9f:	63 
+  804ea0:	68 3a 20 25 73       	push   $0x7325203a
+  804ea5:	3a 20                	cmp    (%rax),%ah
+  804ea7:	25 6c 75 20 72       	and    $0x7220756c,%eax
+  804eac:	65 61                	gs (bad)
+  804eae:	64 20 63 6f          	and    %ah,%fs:0x6f(%rbx)
+  804eb2:	6d                   	insl   (%dx),%es:(%rdi)
+  804eb3:	6d                   	insl   (%dx),%es:(%rdi)
+  804eb4:	61                   	(bad)
+  804eb5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eb6:	64 73 20             	fs jae 804ed9 <__rodata_start+0x149>
+  804eb9:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ebb:	72 20                	jb     804edd <__rodata_start+0x14d>
+  804ebd:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  804ec2:	6c                   	insb   (%dx),%es:(%rdi)
+  804ec3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ec4:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  804ec7:	0a 00                	or     (%rax),%al
+  804ec9:	00 00                	add    %al,(%rax)
+  804ecb:	00 00                	add    %al,(%rax)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 64 69 73          	add    %ah,0x73(%rcx,%rbp,2)
+  804ed3:	6b 62 65 6e          	imul   $0x6e,0x65(%rdx),%esp
+  804ed7:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804eda:	20 66 73             	and    %ah,0x73(%rsi)
+  804edd:	79 6e                	jns    804f4d <__rodata_start+0x1bd>
+  804edf:	63 3a                	movsxd (%rdx),%edi
+  804ee1:	20 25 6c 75 20 4b    	and    %ah,0x4b20756c(%rip)        # 4ba0c453 <__bss_end+0x4b1ba453>
+  804ee7:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804eea:	6c                   	insb   (%dx),%es:(%rdi)
+  804eeb:	65 73 2c             	gs jae 804f1a <__rodata_start+0x18a>
+  804eee:	20 25 6c 75 20 77    	and    %ah,0x7720756c(%rip)        # 77a0c460 <__bss_end+0x771ba460>
+  804ef4:	72 69                	jb     804f5f <__rodata_start+0x1cf>
+  804ef6:	74 65                	je     804f5d <__rodata_start+0x1cd>
+  804ef8:	20 63 6f             	and    %ah,0x6f(%rbx)
+  804efb:	6d                   	insl   (%dx),%es:(%rdi)
+  804efc:	6d                   	insl   (%dx),%es:(%rdi)
+  804efd:	61                   	(bad)
+  804efe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eff:	64 73 20             	fs jae 804f22 <__rodata_start+0x192>
+  804f02:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f04:	72 20                	jb     804f26 <__rodata_start+0x196>
+  804f06:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  804f0b:	6c                   	insb   (%dx),%es:(%rdi)
+  804f0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f0d:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  804f10:	0a 00                	or     (%rax),%al
+  804f12:	00 00                	add    %al,(%rax)
+  804f14:	00 00                	add    %al,(%rax)
+  804f16:	00 00                	add    %al,(%rax)
+  804f18:	64 69 73 6b 62 65 6e 	imul   $0x636e6562,%fs:0x6b(%rbx),%esi
+  804f1f:	63 
+  804f20:	68 3a 20 25 73       	push   $0x7325203a
+  804f25:	3a 20                	cmp    (%rax),%ah
+  804f27:	25 6c 75 20 4b       	and    $0x4b20756c,%eax
+  804f2c:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804f2f:	6c                   	insb   (%dx),%es:(%rdi)
+  804f30:	65 73 2c             	gs jae 804f5f <__rodata_start+0x1cf>
+  804f33:	20 25 6c 75 20 77    	and    %ah,0x7720756c(%rip)        # 77a0c4a5 <__bss_end+0x771ba4a5>
+  804f39:	72 69                	jb     804fa4 <__rodata_start+0x214>
+  804f3b:	74 65                	je     804fa2 <__rodata_start+0x212>
+  804f3d:	20 63 6f             	and    %ah,0x6f(%rbx)
+  804f40:	6d                   	insl   (%dx),%es:(%rdi)
+  804f41:	6d                   	insl   (%dx),%es:(%rdi)
+  804f42:	61                   	(bad)
+  804f43:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f44:	64 73 20             	fs jae 804f67 <__rodata_start+0x1d7>
+  804f47:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f49:	72 20                	jb     804f6b <__rodata_start+0x1db>
+  804f4b:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  804f50:	6c                   	insb   (%dx),%es:(%rdi)
+  804f51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f52:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  804f55:	0a 00                	or     (%rax),%al
+  804f57:	00 64 69 73          	add    %ah,0x73(%rcx,%rbp,2)
+  804f5b:	6b 62 65 6e          	imul   $0x6e,0x65(%rdx),%esp
+  804f5f:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804f62:	20 63 61             	and    %ah,0x61(%rbx)
+  804f65:	63 68 65             	movsxd 0x65(%rax),%ebp
+  804f68:	3a 20                	cmp    (%rax),%ah
+  804f6a:	25 6c 75 20 68       	and    $0x6820756c,%eax
+  804f6f:	69 74 73 2c 20 25 6c 	imul   $0x756c2520,0x2c(%rbx,%rsi,2),%esi
+  804f76:	75 
+  804f77:	20 6d 69             	and    %ch,0x69(%rbp)
+  804f7a:	73 73                	jae    804fef <__rodata_start+0x25f>
+  804f7c:	65 73 2c             	gs jae 804fab <__rodata_start+0x21b>
+  804f7f:	20 25 6c 75 20 72    	and    %ah,0x7220756c(%rip)        # 72a0c4f1 <__bss_end+0x721ba4f1>
+  804f85:	65 61                	gs (bad)
+  804f87:	64 20 61 68          	and    %ah,%fs:0x68(%rcx)
+  804f8b:	65 61                	gs (bad)
+  804f8d:	64 2c 20             	fs sub $0x20,%al
+  804f90:	25 6c 75 20 65       	and    $0x6520756c,%eax
+  804f95:	76 69                	jbe    805000 <__rodata_start+0x270>
+  804f97:	63 74 69 6f          	movsxd 0x6f(%rcx,%rbp,2),%esi
+  804f9b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f9c:	73 2c                	jae    804fca <__rodata_start+0x23a>
+  804f9e:	20 25 6c 75 2f 25    	and    %ah,0x252f756c(%rip)        # 25afc510 <__bss_end+0x252aa510>
+  804fa4:	6c                   	insb   (%dx),%es:(%rdi)
+  804fa5:	75 20                	jne    804fc7 <__rodata_start+0x237>
+  804fa7:	62                   	(bad)
+  804fa8:	6c                   	insb   (%dx),%es:(%rdi)
+  804fa9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804faa:	63 6b 73             	movsxd 0x73(%rbx),%ebp
+  804fad:	0a 00                	or     (%rax),%al
+  804faf:	3c 75                	cmp    $0x75,%al
+  804fb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fb2:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804fb6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fb7:	3e 00 0f             	ds add %cl,(%rdi)
+  804fba:	1f                   	(bad)
+  804fbb:	80 00 00             	addb   $0x0,(%rax)
+  804fbe:	00 00                	add    %al,(%rax)
+  804fc0:	5b                   	pop    %rbx
+  804fc1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804fc6:	20 75 73             	and    %dh,0x73(%rbp)
+  804fc9:	65 72 20             	gs jb  804fec <__rodata_start+0x25c>
+  804fcc:	70 61                	jo     80502f <__rodata_start+0x29f>
+  804fce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fcf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804fd6:	73 20                	jae    804ff8 <__rodata_start+0x268>
+  804fd8:	61                   	(bad)
+  804fd9:	74 20                	je     804ffb <__rodata_start+0x26b>
+  804fdb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804fe0:	3a 20                	cmp    (%rax),%ah
+  804fe2:	00 30                	add    %dh,(%rax)
+  804fe4:	31 32                	xor    %esi,(%rdx)
+  804fe6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804fed:	41                   	rex.B
+  804fee:	42                   	rex.X
+  804fef:	43                   	rex.XB
+  804ff0:	44                   	rex.R
+  804ff1:	45                   	rex.RB
+  804ff2:	46 00 30             	rex.RX add %r14b,(%rax)
+  804ff5:	31 32                	xor    %esi,(%rdx)
+  804ff7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ffe:	61                   	(bad)
+  804fff:	62 63 64 65 66       	(bad)
+  805004:	00 28                	add    %ch,(%rax)
+  805006:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805007:	75 6c                	jne    805075 <__rodata_start+0x2e5>
+  805009:	6c                   	insb   (%dx),%es:(%rdi)
+  80500a:	29 00                	sub    %eax,(%rax)
+  80500c:	65 72 72             	gs jb  805081 <__rodata_start+0x2f1>
+  80500f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805010:	72 20                	jb     805032 <__rodata_start+0x2a2>
+  805012:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805017:	73 70                	jae    805089 <__rodata_start+0x2f9>
+  805019:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80501d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805024:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805025:	72 00                	jb     805027 <__rodata_start+0x297>
+  805027:	62 61 64 20 65       	(bad)
+  80502c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80502d:	76 69                	jbe    805098 <__rodata_start+0x308>
+  80502f:	72 6f                	jb     8050a0 <__rodata_start+0x310>
+  805031:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805032:	6d                   	insl   (%dx),%es:(%rdi)
+  805033:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805035:	74 00                	je     805037 <__rodata_start+0x2a7>
+  805037:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80503e:	20 70 61             	and    %dh,0x61(%rax)
+  805041:	72 61                	jb     8050a4 <__rodata_start+0x314>
+  805043:	6d                   	insl   (%dx),%es:(%rdi)
+  805044:	65 74 65             	gs je  8050ac <__rodata_start+0x31c>
+  805047:	72 00                	jb     805049 <__rodata_start+0x2b9>
+  805049:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80504a:	75 74                	jne    8050c0 <__rodata_start+0x330>
+  80504c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80504f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805052:	6d                   	insl   (%dx),%es:(%rdi)
+  805053:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805054:	72 79                	jb     8050cf <__rodata_start+0x33f>
+  805056:	00 6f 75             	add    %ch,0x75(%rdi)
+  805059:	74 20                	je     80507b <__rodata_start+0x2eb>
+  80505b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80505c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805060:	76 69                	jbe    8050cb <__rodata_start+0x33b>
+  805062:	72 6f                	jb     8050d3 <__rodata_start+0x343>
+  805064:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805065:	6d                   	insl   (%dx),%es:(%rdi)
+  805066:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805068:	74 73                	je     8050dd <__rodata_start+0x34d>
+  80506a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80506d:	72 72                	jb     8050e1 <__rodata_start+0x351>
+  80506f:	75 70                	jne    8050e1 <__rodata_start+0x351>
+  805071:	74 65                	je     8050d8 <__rodata_start+0x348>
+  805073:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805078:	75 67                	jne    8050e1 <__rodata_start+0x351>
+  80507a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80507d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80507f:	00 73 65             	add    %dh,0x65(%rbx)
+  805082:	67 6d                	insl   (%dx),%es:(%edi)
+  805084:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805086:	74 61                	je     8050e9 <__rodata_start+0x359>
+  805088:	74 69                	je     8050f3 <__rodata_start+0x363>
+  80508a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80508b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80508c:	20 66 61             	and    %ah,0x61(%rsi)
+  80508f:	75 6c                	jne    8050fd <__rodata_start+0x36d>
+  805091:	74 00                	je     805093 <__rodata_start+0x303>
+  805093:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80509a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80509d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8050a1:	61                   	(bad)
+  8050a2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8050a7:	20 73 75             	and    %dh,0x75(%rbx)
+  8050aa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8050ad:	73 79                	jae    805128 <__rodata_start+0x398>
+  8050af:	73 74                	jae    805125 <__rodata_start+0x395>
+  8050b1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8050b3:	20 63 61             	and    %ah,0x61(%rbx)
+  8050b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8050b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8050b8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8050bb:	74 72                	je     80512f <__rodata_start+0x39f>
+  8050bd:	79 20                	jns    8050df <__rodata_start+0x34f>
+  8050bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8050c1:	74 20                	je     8050e3 <__rodata_start+0x353>
+  8050c3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8050c5:	75 6e                	jne    805135 <__rodata_start+0x3a5>
+  8050c7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8050cb:	76 20                	jbe    8050ed <__rodata_start+0x35d>
+  8050cd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8050d4:	72 65                	jb     80513b <__rodata_start+0x3ab>
+  8050d6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8050d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8050da:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8050de:	65 78 70             	gs js  805151 <__rodata_start+0x3c1>
+  8050e1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8050e6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8050e9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8050ed:	20 66 69             	and    %ah,0x69(%rsi)
+  8050f0:	6c                   	insb   (%dx),%es:(%rdi)
+  8050f1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8050f5:	20 66 72             	and    %ah,0x72(%rsi)
+  8050f8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8050fd:	61                   	(bad)
+  8050fe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805101:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805102:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805103:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805107:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80510a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80510b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80510c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80510f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805110:	79 20                	jns    805132 <__rodata_start+0x3a2>
+  805112:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805119:	72 65                	jb     805180 <__rodata_start+0x3f0>
+  80511b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80511e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805120:	00 66 69             	add    %ah,0x69(%rsi)
+  805123:	6c                   	insb   (%dx),%es:(%rdi)
+  805124:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805128:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80512b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80512c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80512f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805130:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805131:	74 20                	je     805153 <__rodata_start+0x3c3>
+  805133:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805135:	75 6e                	jne    8051a5 <__rodata_start+0x415>
+  805137:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80513b:	76 61                	jbe    80519e <__rodata_start+0x40e>
+  80513d:	6c                   	insb   (%dx),%es:(%rdi)
+  80513e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805145:	00 
+  805146:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80514d:	72 65                	jb     8051b4 <__rodata_start+0x424>
+  80514f:	61                   	(bad)
+  805150:	64 79 20             	fs jns 805173 <__rodata_start+0x3e3>
+  805153:	65 78 69             	gs js  8051bf <__rodata_start+0x42f>
+  805156:	73 74                	jae    8051cc <__rodata_start+0x43c>
+  805158:	73 00                	jae    80515a <__rodata_start+0x3ca>
+  80515a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80515b:	70 65                	jo     8051c2 <__rodata_start+0x432>
+  80515d:	72 61                	jb     8051c0 <__rodata_start+0x430>
+  80515f:	74 69                	je     8051ca <__rodata_start+0x43a>
+  805161:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805162:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805163:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805166:	74 20                	je     805188 <__rodata_start+0x3f8>
+  805168:	73 75                	jae    8051df <__rodata_start+0x44f>
+  80516a:	70 70                	jo     8051dc <__rodata_start+0x44c>
+  80516c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80516d:	72 74                	jb     8051e3 <__rodata_start+0x453>
+  80516f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805175:	20 61 67             	and    %ah,0x67(%rcx)
+  805178:	61                   	(bad)
+  805179:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805180:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805184:	74 00                	je     805186 <__rodata_start+0x3f6>
+  805186:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80518d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805190:	20 75 73             	and    %dh,0x73(%rbp)
+  805193:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805197:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80519e:	00 
+  80519f:	90                   	nop
+  8051a0:	44 0b 80 00 00 00 00 	or     0x0(%rax),%r8d
+  8051a7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051ad:	00 00                	add    %al,(%rax)
+  8051af:	00 75 11             	add    %dh,0x11(%rbp)
+  8051b2:	80 00 00             	addb   $0x0,(%rax)
+  8051b5:	00 00                	add    %al,(%rax)
+  8051b7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051bd:	00 00                	add    %al,(%rax)
+  8051bf:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051c5:	00 00                	add    %al,(%rax)
+  8051c7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051cd:	00 00                	add    %al,(%rax)
+  8051cf:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051d5:	00 00                	add    %al,(%rax)
+  8051d7:	00 63 0b             	add    %ah,0xb(%rbx)
+  8051da:	80 00 00             	addb   $0x0,(%rax)
+  8051dd:	00 00                	add    %al,(%rax)
+  8051df:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051e5:	00 00                	add    %al,(%rax)
+  8051e7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8051ed:	00 00                	add    %al,(%rax)
+  8051ef:	00 57 0b             	add    %dl,0xb(%rdi)
+  8051f2:	80 00 00             	addb   $0x0,(%rax)
+  8051f5:	00 00                	add    %al,(%rax)
+  8051f7:	00 d1                	add    %dl,%cl
+  8051f9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8051ff:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 57 0b             	add    %dl,0xb(%rdi)
+  80520a:	80 00 00             	addb   $0x0,(%rax)
+  80520d:	00 00                	add    %al,(%rax)
+  80520f:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  80521d:	00 00                	add    %al,(%rax)
+  80521f:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  80522d:	00 00                	add    %al,(%rax)
+  80522f:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  80523d:	00 00                	add    %al,(%rax)
+  80523f:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  805245:	00 00                	add    %al,(%rax)
+  805247:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  80524d:	00 00                	add    %al,(%rax)
+  80524f:	00 9d 0b 80 00 00    	add    %bl,0x800b(%rbp)
+  805255:	00 00                	add    %al,(%rax)
+  805257:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80525d:	00 00                	add    %al,(%rax)
+  80525f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805265:	00 00                	add    %al,(%rax)
+  805267:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80526d:	00 00                	add    %al,(%rax)
+  80526f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805275:	00 00                	add    %al,(%rax)
+  805277:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80527d:	00 00                	add    %al,(%rax)
+  80527f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805285:	00 00                	add    %al,(%rax)
+  805287:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80528d:	00 00                	add    %al,(%rax)
+  80528f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805295:	00 00                	add    %al,(%rax)
+  805297:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80529d:	00 00                	add    %al,(%rax)
+  80529f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052a5:	00 00                	add    %al,(%rax)
+  8052a7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052ad:	00 00                	add    %al,(%rax)
+  8052af:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052b5:	00 00                	add    %al,(%rax)
+  8052b7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052bd:	00 00                	add    %al,(%rax)
+  8052bf:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052c5:	00 00                	add    %al,(%rax)
+  8052c7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052cd:	00 00                	add    %al,(%rax)
+  8052cf:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052d5:	00 00                	add    %al,(%rax)
+  8052d7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052dd:	00 00                	add    %al,(%rax)
+  8052df:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052e5:	00 00                	add    %al,(%rax)
+  8052e7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052ed:	00 00                	add    %al,(%rax)
+  8052ef:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052f5:	00 00                	add    %al,(%rax)
+  8052f7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8052fd:	00 00                	add    %al,(%rax)
+  8052ff:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805305:	00 00                	add    %al,(%rax)
+  805307:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80530d:	00 00                	add    %al,(%rax)
+  80530f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805315:	00 00                	add    %al,(%rax)
+  805317:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80531d:	00 00                	add    %al,(%rax)
+  80531f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805325:	00 00                	add    %al,(%rax)
+  805327:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80532d:	00 00                	add    %al,(%rax)
+  80532f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805335:	00 00                	add    %al,(%rax)
+  805337:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80533d:	00 00                	add    %al,(%rax)
+  80533f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805345:	00 00                	add    %al,(%rax)
+  805347:	00 a8 10 80 00 00    	add    %ch,0x8010(%rax)
+  80534d:	00 00                	add    %al,(%rax)
+  80534f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805355:	00 00                	add    %al,(%rax)
+  805357:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80535d:	00 00                	add    %al,(%rax)
+  80535f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805365:	00 00                	add    %al,(%rax)
+  805367:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80536d:	00 00                	add    %al,(%rax)
+  80536f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805375:	00 00                	add    %al,(%rax)
+  805377:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80537d:	00 00                	add    %al,(%rax)
+  80537f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805385:	00 00                	add    %al,(%rax)
+  805387:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80538d:	00 00                	add    %al,(%rax)
+  80538f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805395:	00 00                	add    %al,(%rax)
+  805397:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80539d:	00 00                	add    %al,(%rax)
+  80539f:	00 f4                	add    %dh,%ah
+  8053a1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8053a7:	00 c3                	add    %al,%bl
+  8053a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8053ae:	00 00                	add    %al,(%rax)
+  8053b0:	85 11                	test   %edx,(%rcx)
+  8053b2:	80 00 00             	addb   $0x0,(%rax)
+  8053b5:	00 00                	add    %al,(%rax)
+  8053b7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053bd:	00 00                	add    %al,(%rax)
+  8053bf:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053c5:	00 00                	add    %al,(%rax)
+  8053c7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053cd:	00 00                	add    %al,(%rax)
+  8053cf:	00 23                	add    %ah,(%rbx)
+  8053d1:	0c 80                	or     $0x80,%al
+  8053d3:	00 00                	add    %al,(%rax)
+  8053d5:	00 00                	add    %al,(%rax)
+  8053d7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053dd:	00 00                	add    %al,(%rax)
+  8053df:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053e5:	00 00                	add    %al,(%rax)
+  8053e7:	00 e9                	add    %ch,%cl
+  8053e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8053ef:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053f5:	00 00                	add    %al,(%rax)
+  8053f7:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  8053fd:	00 00                	add    %al,(%rax)
+  8053ff:	00 6b 0f             	add    %ch,0xf(%rbx)
+  805402:	80 00 00             	addb   $0x0,(%rax)
+  805405:	00 00                	add    %al,(%rax)
+  805407:	00 35 10 80 00 00    	add    %dh,0x8010(%rip)        # 80d41d <__ctors_end+0x733d>
+  80540d:	00 00                	add    %al,(%rax)
+  80540f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805415:	00 00                	add    %al,(%rax)
+  805417:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80541d:	00 00                	add    %al,(%rax)
+  80541f:	00 ba 0c 80 00 00    	add    %bh,0x800c(%rdx)
+  805425:	00 00                	add    %al,(%rax)
+  805427:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80542d:	00 00                	add    %al,(%rax)
+  80542f:	00 97 0e 80 00 00    	add    %dl,0x800e(%rdi)
+  805435:	00 00                	add    %al,(%rax)
+  805437:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  80543d:	00 00                	add    %al,(%rax)
+  80543f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805445:	00 00                	add    %al,(%rax)
+  805447:	00 a8 10 80 00 00    	add    %ch,0x8010(%rax)
+  80544d:	00 00                	add    %al,(%rax)
+  80544f:	00 85 11 80 00 00    	add    %al,0x8011(%rbp)
+  805455:	00 00                	add    %al,(%rax)
+  805457:	00 4d 0b             	add    %cl,0xb(%rbp)
+  80545a:	80 00 00             	addb   $0x0,(%rax)
+  80545d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805460 <error_string>:
+	...
+  805468:	15 50 80 00 00 00 00 00 27 50 80 00 00 00 00 00     .P......'P......
+  805478:	37 50 80 00 00 00 00 00 49 50 80 00 00 00 00 00     7P......IP......
+  805488:	57 50 80 00 00 00 00 00 6b 50 80 00 00 00 00 00     WP......kP......
+  805498:	80 50 80 00 00 00 00 00 93 50 80 00 00 00 00 00     .P.......P......
+  8054a8:	a5 50 80 00 00 00 00 00 b9 50 80 00 00 00 00 00     .P.......P......
+  8054b8:	c9 50 80 00 00 00 00 00 dc 50 80 00 00 00 00 00     .P.......P......
+  8054c8:	f3 50 80 00 00 00 00 00 09 51 80 00 00 00 00 00     .P.......Q......
+  8054d8:	21 51 80 00 00 00 00 00 39 51 80 00 00 00 00 00     !Q......9Q......
+  8054e8:	46 51 80 00 00 00 00 00 18 55 80 00 00 00 00 00     FQ.......U......
+  8054f8:	5a 51 80 00 00 00 00 00 72 51 80 00 00 00 00 00     ZQ......rQ......
+  805508:	7c 51 80 00 00 00 00 00 86 51 80 00 00 00 00 00     |Q.......Q......
+  805518:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805528:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805538:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805548:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805558:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  805568:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  805578:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  805588:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805598:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8055a8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8055b8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  8055c8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  8055d8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8055e8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8055f8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805608:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805618:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805620 <devtab>:
+  805620:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805630:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805640:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805650:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805660:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805670:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805680:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805690:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8056a0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8056b0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8056c0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8056d0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8056e0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8056f0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805700:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
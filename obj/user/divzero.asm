@@ -0,0 +1,8154 @@
+
+obj/user/divzero:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 3d 00 00 00       	call   800060 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+volatile int zero;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("1337/0 is %08x!\n", 1337 / zero);
+  800029:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  800030:	00 00 00 
+  800033:	8b 08                	mov    (%rax),%ecx
+  800035:	b8 39 05 00 00       	mov    $0x539,%eax
+  80003a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80003f:	f7 f9                	idiv   %ecx
+  800041:	89 c6                	mov    %eax,%esi
+  800043:	48 bf c0 46 80 00 00 	movabs $0x8046c0,%rdi
+  80004a:	00 00 00 
+  80004d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800052:	48 ba e3 01 80 00 00 	movabs $0x8001e3,%rdx
+  800059:	00 00 00 
+  80005c:	ff d2                	call   *%rdx
+}
+  80005e:	5d                   	pop    %rbp
+  80005f:	c3                   	ret
+
+0000000000800060 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800060:	55                   	push   %rbp
+  800061:	48 89 e5             	mov    %rsp,%rbp
+  800064:	41 56                	push   %r14
+  800066:	41 55                	push   %r13
+  800068:	41 54                	push   %r12
+  80006a:	53                   	push   %rbx
+  80006b:	41 89 fd             	mov    %edi,%r13d
+  80006e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800071:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800078:	00 00 00 
+  80007b:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800082:	00 00 00 
+  800085:	48 39 c2             	cmp    %rax,%rdx
+  800088:	73 17                	jae    8000a1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80008a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80008d:	49 89 c4             	mov    %rax,%r12
+  800090:	48 83 c3 08          	add    $0x8,%rbx
+  800094:	b8 00 00 00 00       	mov    $0x0,%eax
+  800099:	ff 53 f8             	call   *-0x8(%rbx)
+  80009c:	4c 39 e3             	cmp    %r12,%rbx
+  80009f:	72 ef                	jb     800090 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000a1:	48 b8 da 0f 80 00 00 	movabs $0x800fda,%rax
+  8000a8:	00 00 00 
+  8000ab:	ff d0                	call   *%rax
+  8000ad:	89 c2                	mov    %eax,%edx
+  8000af:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000b5:	48 89 d0             	mov    %rdx,%rax
+  8000b8:	48 c1 e0 04          	shl    $0x4,%rax
+  8000bc:	48 29 d0             	sub    %rdx,%rax
+  8000bf:	48 c1 e0 05          	shl    $0x5,%rax
+  8000c3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ca:	00 00 00 
+  8000cd:	48 01 d0             	add    %rdx,%rax
+  8000d0:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  8000d7:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000da:	45 85 ed             	test   %r13d,%r13d
+  8000dd:	7e 0d                	jle    8000ec <libmain+0x8c>
+  8000df:	49 8b 06             	mov    (%r14),%rax
+  8000e2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000e9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000ec:	4c 89 f6             	mov    %r14,%rsi
+  8000ef:	44 89 ef             	mov    %r13d,%edi
+  8000f2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f9:	00 00 00 
+  8000fc:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000fe:	48 b8 13 01 80 00 00 	movabs $0x800113,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+#endif
+}
+  80010a:	5b                   	pop    %rbx
+  80010b:	41 5c                	pop    %r12
+  80010d:	41 5d                	pop    %r13
+  80010f:	41 5e                	pop    %r14
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800117:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  80011e:	00 00 00 
+  800121:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800123:	bf 00 00 00 00       	mov    $0x0,%edi
+  800128:	48 b8 77 0f 80 00 00 	movabs $0x800f77,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+}
+  800134:	5d                   	pop    %rbp
+  800135:	c3                   	ret
+
+0000000000800136 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	53                   	push   %rbx
+  80013b:	48 83 ec 08          	sub    $0x8,%rsp
+  80013f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800142:	8b 06                	mov    (%rsi),%eax
+  800144:	8d 50 01             	lea    0x1(%rax),%edx
+  800147:	89 16                	mov    %edx,(%rsi)
+  800149:	48 98                	cltq
+  80014b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800150:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800156:	74 0a                	je     800162 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800158:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80015c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800160:	c9                   	leave
+  800161:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800162:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800166:	be ff 00 00 00       	mov    $0xff,%esi
+  80016b:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  800172:	00 00 00 
+  800175:	ff d0                	call   *%rax
+        state->offset = 0;
+  800177:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80017d:	eb d9                	jmp    800158 <putch+0x22>
+
+000000000080017f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80017f:	55                   	push   %rbp
+  800180:	48 89 e5             	mov    %rsp,%rbp
+  800183:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80018a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80018d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800194:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800199:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001a1:	48 89 f1             	mov    %rsi,%rcx
+  8001a4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001ab:	48 bf 36 01 80 00 00 	movabs $0x800136,%rdi
+  8001b2:	00 00 00 
+  8001b5:	48 b8 33 03 80 00 00 	movabs $0x800333,%rax
+  8001bc:	00 00 00 
+  8001bf:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001c1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001c8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001cf:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  8001d6:	00 00 00 
+  8001d9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001db:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001e1:	c9                   	leave
+  8001e2:	c3                   	ret
+
+00000000008001e3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001e3:	55                   	push   %rbp
+  8001e4:	48 89 e5             	mov    %rsp,%rbp
+  8001e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8001eb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001ef:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001f3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001f7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001fb:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001ff:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800206:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80020a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80020e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800212:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800216:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80021a:	48 b8 7f 01 80 00 00 	movabs $0x80017f,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800226:	c9                   	leave
+  800227:	c3                   	ret
+
+0000000000800228 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800228:	55                   	push   %rbp
+  800229:	48 89 e5             	mov    %rsp,%rbp
+  80022c:	41 57                	push   %r15
+  80022e:	41 56                	push   %r14
+  800230:	41 55                	push   %r13
+  800232:	41 54                	push   %r12
+  800234:	53                   	push   %rbx
+  800235:	48 83 ec 18          	sub    $0x18,%rsp
+  800239:	49 89 fc             	mov    %rdi,%r12
+  80023c:	49 89 f5             	mov    %rsi,%r13
+  80023f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800243:	8b 45 10             	mov    0x10(%rbp),%eax
+  800246:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800249:	41 89 cf             	mov    %ecx,%r15d
+  80024c:	4c 39 fa             	cmp    %r15,%rdx
+  80024f:	73 5b                	jae    8002ac <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800251:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800255:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800259:	85 db                	test   %ebx,%ebx
+  80025b:	7e 0e                	jle    80026b <print_num+0x43>
+            putch(padc, put_arg);
+  80025d:	4c 89 ee             	mov    %r13,%rsi
+  800260:	44 89 f7             	mov    %r14d,%edi
+  800263:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800266:	83 eb 01             	sub    $0x1,%ebx
+  800269:	75 f2                	jne    80025d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80026b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80026f:	48 b9 ec 46 80 00 00 	movabs $0x8046ec,%rcx
+  800276:	00 00 00 
+  800279:	48 b8 db 46 80 00 00 	movabs $0x8046db,%rax
+  800280:	00 00 00 
+  800283:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800287:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80028b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800290:	49 f7 f7             	div    %r15
+  800293:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800297:	4c 89 ee             	mov    %r13,%rsi
+  80029a:	41 ff d4             	call   *%r12
+}
+  80029d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002a1:	5b                   	pop    %rbx
+  8002a2:	41 5c                	pop    %r12
+  8002a4:	41 5d                	pop    %r13
+  8002a6:	41 5e                	pop    %r14
+  8002a8:	41 5f                	pop    %r15
+  8002aa:	5d                   	pop    %rbp
+  8002ab:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002b5:	49 f7 f7             	div    %r15
+  8002b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002bc:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002c0:	52                   	push   %rdx
+  8002c1:	45 0f be c9          	movsbl %r9b,%r9d
+  8002c5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002c9:	48 89 c2             	mov    %rax,%rdx
+  8002cc:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+  8002d8:	48 83 c4 10          	add    $0x10,%rsp
+  8002dc:	eb 8d                	jmp    80026b <print_num+0x43>
+
+00000000008002de <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002de:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002e2:	48 8b 06             	mov    (%rsi),%rax
+  8002e5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002e9:	73 0a                	jae    8002f5 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002eb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ef:	48 89 16             	mov    %rdx,(%rsi)
+  8002f2:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002f5:	c3                   	ret
+
+00000000008002f6 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002f6:	55                   	push   %rbp
+  8002f7:	48 89 e5             	mov    %rsp,%rbp
+  8002fa:	48 83 ec 50          	sub    $0x50,%rsp
+  8002fe:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800302:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800306:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80030a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800311:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800315:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800319:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80031d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800321:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800325:	48 b8 33 03 80 00 00 	movabs $0x800333,%rax
+  80032c:	00 00 00 
+  80032f:	ff d0                	call   *%rax
+}
+  800331:	c9                   	leave
+  800332:	c3                   	ret
+
+0000000000800333 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800333:	55                   	push   %rbp
+  800334:	48 89 e5             	mov    %rsp,%rbp
+  800337:	41 57                	push   %r15
+  800339:	41 56                	push   %r14
+  80033b:	41 55                	push   %r13
+  80033d:	41 54                	push   %r12
+  80033f:	53                   	push   %rbx
+  800340:	48 83 ec 38          	sub    $0x38,%rsp
+  800344:	49 89 fe             	mov    %rdi,%r14
+  800347:	49 89 f5             	mov    %rsi,%r13
+  80034a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80034d:	48 8b 01             	mov    (%rcx),%rax
+  800350:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800354:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800358:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80035c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800360:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800364:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800368:	0f b6 3b             	movzbl (%rbx),%edi
+  80036b:	40 80 ff 25          	cmp    $0x25,%dil
+  80036f:	74 18                	je     800389 <vprintfmt+0x56>
+            if (!ch) return;
+  800371:	40 84 ff             	test   %dil,%dil
+  800374:	0f 84 b1 06 00 00    	je     800a2b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80037a:	40 0f b6 ff          	movzbl %dil,%edi
+  80037e:	4c 89 ee             	mov    %r13,%rsi
+  800381:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800384:	4c 89 e3             	mov    %r12,%rbx
+  800387:	eb db                	jmp    800364 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800389:	be 00 00 00 00       	mov    $0x0,%esi
+  80038e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800392:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800397:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80039d:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003a4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003a8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003ad:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003b2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003b5:	83 e8 23             	sub    $0x23,%eax
+  8003b8:	3c 57                	cmp    $0x57,%al
+  8003ba:	0f 87 51 06 00 00    	ja     800a11 <vprintfmt+0x6de>
+  8003c0:	0f b6 c0             	movzbl %al,%eax
+  8003c3:	48 b9 a0 48 80 00 00 	movabs $0x8048a0,%rcx
+  8003ca:	00 00 00 
+  8003cd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003d0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003d3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003d7:	eb cf                	jmp    8003a8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003d9:	49 89 dc             	mov    %rbx,%r12
+  8003dc:	be 01 00 00 00       	mov    $0x1,%esi
+  8003e1:	eb c5                	jmp    8003a8 <vprintfmt+0x75>
+            padc = ch;
+  8003e3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003e7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003ea:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003ed:	eb b9                	jmp    8003a8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003ef:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003f2:	83 f8 2f             	cmp    $0x2f,%eax
+  8003f5:	77 24                	ja     80041b <vprintfmt+0xe8>
+  8003f7:	89 c1                	mov    %eax,%ecx
+  8003f9:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003fd:	83 c0 08             	add    $0x8,%eax
+  800400:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800403:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800406:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800409:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80040d:	79 99                	jns    8003a8 <vprintfmt+0x75>
+                width = precision;
+  80040f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800413:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800419:	eb 8d                	jmp    8003a8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80041b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80041f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800423:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800427:	eb da                	jmp    800403 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800429:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80042e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800432:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800438:	3c 39                	cmp    $0x39,%al
+  80043a:	77 1c                	ja     800458 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80043c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800440:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800444:	0f b6 c0             	movzbl %al,%eax
+  800447:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80044c:	0f b6 03             	movzbl (%rbx),%eax
+  80044f:	3c 39                	cmp    $0x39,%al
+  800451:	76 e9                	jbe    80043c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800453:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800456:	eb b1                	jmp    800409 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800458:	49 89 dc             	mov    %rbx,%r12
+  80045b:	eb ac                	jmp    800409 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80045d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800460:	85 c9                	test   %ecx,%ecx
+  800462:	b8 00 00 00 00       	mov    $0x0,%eax
+  800467:	0f 49 c1             	cmovns %ecx,%eax
+  80046a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80046d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800470:	e9 33 ff ff ff       	jmp    8003a8 <vprintfmt+0x75>
+            lflag++;
+  800475:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800478:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80047b:	e9 28 ff ff ff       	jmp    8003a8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800480:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800483:	83 f8 2f             	cmp    $0x2f,%eax
+  800486:	77 19                	ja     8004a1 <vprintfmt+0x16e>
+  800488:	89 c2                	mov    %eax,%edx
+  80048a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80048e:	83 c0 08             	add    $0x8,%eax
+  800491:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800494:	8b 3a                	mov    (%rdx),%edi
+  800496:	4c 89 ee             	mov    %r13,%rsi
+  800499:	41 ff d6             	call   *%r14
+            break;
+  80049c:	e9 c3 fe ff ff       	jmp    800364 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004a1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004a5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ad:	eb e5                	jmp    800494 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b5:	77 5a                	ja     800511 <vprintfmt+0x1de>
+  8004b7:	89 c2                	mov    %eax,%edx
+  8004b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004bd:	83 c0 08             	add    $0x8,%eax
+  8004c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004c3:	8b 02                	mov    (%rdx),%eax
+  8004c5:	89 c1                	mov    %eax,%ecx
+  8004c7:	f7 d9                	neg    %ecx
+  8004c9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004cc:	83 f9 16             	cmp    $0x16,%ecx
+  8004cf:	7f 4e                	jg     80051f <vprintfmt+0x1ec>
+  8004d1:	48 63 c1             	movslq %ecx,%rax
+  8004d4:	48 ba 60 4b 80 00 00 	movabs $0x804b60,%rdx
+  8004db:	00 00 00 
+  8004de:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004e2:	48 85 c0             	test   %rax,%rax
+  8004e5:	74 38                	je     80051f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004e7:	48 89 c1             	mov    %rax,%rcx
+  8004ea:	48 ba 39 4d 80 00 00 	movabs $0x804d39,%rdx
+  8004f1:	00 00 00 
+  8004f4:	4c 89 ee             	mov    %r13,%rsi
+  8004f7:	4c 89 f7             	mov    %r14,%rdi
+  8004fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ff:	49 b8 f6 02 80 00 00 	movabs $0x8002f6,%r8
+  800506:	00 00 00 
+  800509:	41 ff d0             	call   *%r8
+  80050c:	e9 53 fe ff ff       	jmp    800364 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800511:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800515:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800519:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80051d:	eb a4                	jmp    8004c3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80051f:	48 ba 04 47 80 00 00 	movabs $0x804704,%rdx
+  800526:	00 00 00 
+  800529:	4c 89 ee             	mov    %r13,%rsi
+  80052c:	4c 89 f7             	mov    %r14,%rdi
+  80052f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800534:	49 b8 f6 02 80 00 00 	movabs $0x8002f6,%r8
+  80053b:	00 00 00 
+  80053e:	41 ff d0             	call   *%r8
+  800541:	e9 1e fe ff ff       	jmp    800364 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800546:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800549:	83 f8 2f             	cmp    $0x2f,%eax
+  80054c:	77 6c                	ja     8005ba <vprintfmt+0x287>
+  80054e:	89 c2                	mov    %eax,%edx
+  800550:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800554:	83 c0 08             	add    $0x8,%eax
+  800557:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80055a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80055d:	48 85 d2             	test   %rdx,%rdx
+  800560:	48 b8 fd 46 80 00 00 	movabs $0x8046fd,%rax
+  800567:	00 00 00 
+  80056a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80056e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800572:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800576:	7e 06                	jle    80057e <vprintfmt+0x24b>
+  800578:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80057c:	75 4a                	jne    8005c8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80057e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800582:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800586:	0f b6 00             	movzbl (%rax),%eax
+  800589:	84 c0                	test   %al,%al
+  80058b:	0f 85 9a 00 00 00    	jne    80062b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800591:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800594:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800598:	85 c0                	test   %eax,%eax
+  80059a:	0f 8e c4 fd ff ff    	jle    800364 <vprintfmt+0x31>
+  8005a0:	4c 89 ee             	mov    %r13,%rsi
+  8005a3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005a8:	41 ff d6             	call   *%r14
+  8005ab:	41 83 ec 01          	sub    $0x1,%r12d
+  8005af:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005b3:	75 eb                	jne    8005a0 <vprintfmt+0x26d>
+  8005b5:	e9 aa fd ff ff       	jmp    800364 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c6:	eb 92                	jmp    80055a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005c8:	49 63 f7             	movslq %r15d,%rsi
+  8005cb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005cf:	48 b8 e5 0a 80 00 00 	movabs $0x800ae5,%rax
+  8005d6:	00 00 00 
+  8005d9:	ff d0                	call   *%rax
+  8005db:	48 89 c2             	mov    %rax,%rdx
+  8005de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005e1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005e3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005e6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005e9:	85 c0                	test   %eax,%eax
+  8005eb:	7e 91                	jle    80057e <vprintfmt+0x24b>
+  8005ed:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005f2:	4c 89 ee             	mov    %r13,%rsi
+  8005f5:	44 89 e7             	mov    %r12d,%edi
+  8005f8:	41 ff d6             	call   *%r14
+  8005fb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ff:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800602:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800605:	75 eb                	jne    8005f2 <vprintfmt+0x2bf>
+  800607:	e9 72 ff ff ff       	jmp    80057e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80060c:	0f b6 f8             	movzbl %al,%edi
+  80060f:	4c 89 ee             	mov    %r13,%rsi
+  800612:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800615:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800619:	49 83 c4 01          	add    $0x1,%r12
+  80061d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800623:	84 c0                	test   %al,%al
+  800625:	0f 84 66 ff ff ff    	je     800591 <vprintfmt+0x25e>
+  80062b:	45 85 ff             	test   %r15d,%r15d
+  80062e:	78 0a                	js     80063a <vprintfmt+0x307>
+  800630:	41 83 ef 01          	sub    $0x1,%r15d
+  800634:	0f 88 57 ff ff ff    	js     800591 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80063a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80063e:	74 cc                	je     80060c <vprintfmt+0x2d9>
+  800640:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800643:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800648:	80 fa 5e             	cmp    $0x5e,%dl
+  80064b:	77 c2                	ja     80060f <vprintfmt+0x2dc>
+  80064d:	eb bd                	jmp    80060c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80064f:	40 84 f6             	test   %sil,%sil
+  800652:	75 26                	jne    80067a <vprintfmt+0x347>
+    switch (lflag) {
+  800654:	85 d2                	test   %edx,%edx
+  800656:	74 59                	je     8006b1 <vprintfmt+0x37e>
+  800658:	83 fa 01             	cmp    $0x1,%edx
+  80065b:	74 7b                	je     8006d8 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80065d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800660:	83 f8 2f             	cmp    $0x2f,%eax
+  800663:	0f 87 96 00 00 00    	ja     8006ff <vprintfmt+0x3cc>
+  800669:	89 c2                	mov    %eax,%edx
+  80066b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80066f:	83 c0 08             	add    $0x8,%eax
+  800672:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800675:	4c 8b 22             	mov    (%rdx),%r12
+  800678:	eb 17                	jmp    800691 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80067a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80067d:	83 f8 2f             	cmp    $0x2f,%eax
+  800680:	77 21                	ja     8006a3 <vprintfmt+0x370>
+  800682:	89 c2                	mov    %eax,%edx
+  800684:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800688:	83 c0 08             	add    $0x8,%eax
+  80068b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800691:	4d 85 e4             	test   %r12,%r12
+  800694:	78 7a                	js     800710 <vprintfmt+0x3dd>
+            num = i;
+  800696:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800699:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80069e:	e9 50 02 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006af:	eb dd                	jmp    80068e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b7:	77 11                	ja     8006ca <vprintfmt+0x397>
+  8006b9:	89 c2                	mov    %eax,%edx
+  8006bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bf:	83 c0 08             	add    $0x8,%eax
+  8006c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c5:	4c 63 22             	movslq (%rdx),%r12
+  8006c8:	eb c7                	jmp    800691 <vprintfmt+0x35e>
+  8006ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d6:	eb ed                	jmp    8006c5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006db:	83 f8 2f             	cmp    $0x2f,%eax
+  8006de:	77 11                	ja     8006f1 <vprintfmt+0x3be>
+  8006e0:	89 c2                	mov    %eax,%edx
+  8006e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006e6:	83 c0 08             	add    $0x8,%eax
+  8006e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006ec:	4c 8b 22             	mov    (%rdx),%r12
+  8006ef:	eb a0                	jmp    800691 <vprintfmt+0x35e>
+  8006f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fd:	eb ed                	jmp    8006ec <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800703:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800707:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070b:	e9 65 ff ff ff       	jmp    800675 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800710:	4c 89 ee             	mov    %r13,%rsi
+  800713:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800718:	41 ff d6             	call   *%r14
+                i = -i;
+  80071b:	49 f7 dc             	neg    %r12
+  80071e:	e9 73 ff ff ff       	jmp    800696 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800723:	40 84 f6             	test   %sil,%sil
+  800726:	75 32                	jne    80075a <vprintfmt+0x427>
+    switch (lflag) {
+  800728:	85 d2                	test   %edx,%edx
+  80072a:	74 5d                	je     800789 <vprintfmt+0x456>
+  80072c:	83 fa 01             	cmp    $0x1,%edx
+  80072f:	0f 84 82 00 00 00    	je     8007b7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800735:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800738:	83 f8 2f             	cmp    $0x2f,%eax
+  80073b:	0f 87 a5 00 00 00    	ja     8007e6 <vprintfmt+0x4b3>
+  800741:	89 c2                	mov    %eax,%edx
+  800743:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800747:	83 c0 08             	add    $0x8,%eax
+  80074a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800750:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800755:	e9 99 01 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80075a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075d:	83 f8 2f             	cmp    $0x2f,%eax
+  800760:	77 19                	ja     80077b <vprintfmt+0x448>
+  800762:	89 c2                	mov    %eax,%edx
+  800764:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800768:	83 c0 08             	add    $0x8,%eax
+  80076b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80076e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800771:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800776:	e9 78 01 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+  80077b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800783:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800787:	eb e5                	jmp    80076e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800789:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078c:	83 f8 2f             	cmp    $0x2f,%eax
+  80078f:	77 18                	ja     8007a9 <vprintfmt+0x476>
+  800791:	89 c2                	mov    %eax,%edx
+  800793:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800797:	83 c0 08             	add    $0x8,%eax
+  80079a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079d:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80079f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007a4:	e9 4a 01 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+  8007a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b5:	eb e6                	jmp    80079d <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8007bd:	77 19                	ja     8007d8 <vprintfmt+0x4a5>
+  8007bf:	89 c2                	mov    %eax,%edx
+  8007c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c5:	83 c0 08             	add    $0x8,%eax
+  8007c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007cb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007d3:	e9 1b 01 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+  8007d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e4:	eb e5                	jmp    8007cb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f2:	e9 56 ff ff ff       	jmp    80074d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f7:	40 84 f6             	test   %sil,%sil
+  8007fa:	75 2e                	jne    80082a <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007fc:	85 d2                	test   %edx,%edx
+  8007fe:	74 59                	je     800859 <vprintfmt+0x526>
+  800800:	83 fa 01             	cmp    $0x1,%edx
+  800803:	74 7f                	je     800884 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800805:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800808:	83 f8 2f             	cmp    $0x2f,%eax
+  80080b:	0f 87 9f 00 00 00    	ja     8008b0 <vprintfmt+0x57d>
+  800811:	89 c2                	mov    %eax,%edx
+  800813:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800817:	83 c0 08             	add    $0x8,%eax
+  80081a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800820:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800825:	e9 c9 00 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80082a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082d:	83 f8 2f             	cmp    $0x2f,%eax
+  800830:	77 19                	ja     80084b <vprintfmt+0x518>
+  800832:	89 c2                	mov    %eax,%edx
+  800834:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800838:	83 c0 08             	add    $0x8,%eax
+  80083b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800841:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800846:	e9 a8 00 00 00       	jmp    8008f3 <vprintfmt+0x5c0>
+  80084b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800853:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800857:	eb e5                	jmp    80083e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800859:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80085c:	83 f8 2f             	cmp    $0x2f,%eax
+  80085f:	77 15                	ja     800876 <vprintfmt+0x543>
+  800861:	89 c2                	mov    %eax,%edx
+  800863:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800867:	83 c0 08             	add    $0x8,%eax
+  80086a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80086f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800874:	eb 7d                	jmp    8008f3 <vprintfmt+0x5c0>
+  800876:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800882:	eb e9                	jmp    80086d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800884:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800887:	83 f8 2f             	cmp    $0x2f,%eax
+  80088a:	77 16                	ja     8008a2 <vprintfmt+0x56f>
+  80088c:	89 c2                	mov    %eax,%edx
+  80088e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800892:	83 c0 08             	add    $0x8,%eax
+  800895:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800898:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80089b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a0:	eb 51                	jmp    8008f3 <vprintfmt+0x5c0>
+  8008a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ae:	eb e8                	jmp    800898 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008bc:	e9 5c ff ff ff       	jmp    80081d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008c1:	4c 89 ee             	mov    %r13,%rsi
+  8008c4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008c9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008cc:	4c 89 ee             	mov    %r13,%rsi
+  8008cf:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008d4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008da:	83 f8 2f             	cmp    $0x2f,%eax
+  8008dd:	77 47                	ja     800926 <vprintfmt+0x5f3>
+  8008df:	89 c2                	mov    %eax,%edx
+  8008e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e5:	83 c0 08             	add    $0x8,%eax
+  8008e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8008f7:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008fb:	0f 94 c0             	sete   %al
+  8008fe:	0f b6 c0             	movzbl %al,%eax
+  800901:	50                   	push   %rax
+  800902:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800907:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80090b:	4c 89 ee             	mov    %r13,%rsi
+  80090e:	4c 89 f7             	mov    %r14,%rdi
+  800911:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  800918:	00 00 00 
+  80091b:	ff d0                	call   *%rax
+            break;
+  80091d:	48 83 c4 10          	add    $0x10,%rsp
+  800921:	e9 3e fa ff ff       	jmp    800364 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800926:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800932:	eb b7                	jmp    8008eb <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800934:	40 84 f6             	test   %sil,%sil
+  800937:	75 2b                	jne    800964 <vprintfmt+0x631>
+    switch (lflag) {
+  800939:	85 d2                	test   %edx,%edx
+  80093b:	74 56                	je     800993 <vprintfmt+0x660>
+  80093d:	83 fa 01             	cmp    $0x1,%edx
+  800940:	74 7f                	je     8009c1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800942:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800945:	83 f8 2f             	cmp    $0x2f,%eax
+  800948:	0f 87 a2 00 00 00    	ja     8009f0 <vprintfmt+0x6bd>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80095d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800962:	eb 8f                	jmp    8008f3 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800964:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800967:	83 f8 2f             	cmp    $0x2f,%eax
+  80096a:	77 19                	ja     800985 <vprintfmt+0x652>
+  80096c:	89 c2                	mov    %eax,%edx
+  80096e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800972:	83 c0 08             	add    $0x8,%eax
+  800975:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800978:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80097b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800980:	e9 6e ff ff ff       	jmp    8008f3 <vprintfmt+0x5c0>
+  800985:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800989:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800991:	eb e5                	jmp    800978 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800993:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800996:	83 f8 2f             	cmp    $0x2f,%eax
+  800999:	77 18                	ja     8009b3 <vprintfmt+0x680>
+  80099b:	89 c2                	mov    %eax,%edx
+  80099d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a1:	83 c0 08             	add    $0x8,%eax
+  8009a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009a9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009ae:	e9 40 ff ff ff       	jmp    8008f3 <vprintfmt+0x5c0>
+  8009b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bf:	eb e6                	jmp    8009a7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c7:	77 19                	ja     8009e2 <vprintfmt+0x6af>
+  8009c9:	89 c2                	mov    %eax,%edx
+  8009cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009cf:	83 c0 08             	add    $0x8,%eax
+  8009d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009dd:	e9 11 ff ff ff       	jmp    8008f3 <vprintfmt+0x5c0>
+  8009e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ee:	eb e5                	jmp    8009d5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	e9 59 ff ff ff       	jmp    80095a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a01:	4c 89 ee             	mov    %r13,%rsi
+  800a04:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a09:	41 ff d6             	call   *%r14
+            break;
+  800a0c:	e9 53 f9 ff ff       	jmp    800364 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a11:	4c 89 ee             	mov    %r13,%rsi
+  800a14:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a19:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a1c:	48 83 eb 01          	sub    $0x1,%rbx
+  800a20:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a24:	75 f6                	jne    800a1c <vprintfmt+0x6e9>
+  800a26:	e9 39 f9 ff ff       	jmp    800364 <vprintfmt+0x31>
+}
+  800a2b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a2f:	5b                   	pop    %rbx
+  800a30:	41 5c                	pop    %r12
+  800a32:	41 5d                	pop    %r13
+  800a34:	41 5e                	pop    %r14
+  800a36:	41 5f                	pop    %r15
+  800a38:	5d                   	pop    %rbp
+  800a39:	c3                   	ret
+
+0000000000800a3a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a3a:	55                   	push   %rbp
+  800a3b:	48 89 e5             	mov    %rsp,%rbp
+  800a3e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a42:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a46:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a4b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a4f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a56:	48 85 ff             	test   %rdi,%rdi
+  800a59:	74 2b                	je     800a86 <vsnprintf+0x4c>
+  800a5b:	48 85 f6             	test   %rsi,%rsi
+  800a5e:	74 26                	je     800a86 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a60:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a64:	48 bf de 02 80 00 00 	movabs $0x8002de,%rdi
+  800a6b:	00 00 00 
+  800a6e:	48 b8 33 03 80 00 00 	movabs $0x800333,%rax
+  800a75:	00 00 00 
+  800a78:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a7a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a7e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a81:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a84:	c9                   	leave
+  800a85:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a86:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a8b:	eb f7                	jmp    800a84 <vsnprintf+0x4a>
+
+0000000000800a8d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a8d:	55                   	push   %rbp
+  800a8e:	48 89 e5             	mov    %rsp,%rbp
+  800a91:	48 83 ec 50          	sub    $0x50,%rsp
+  800a95:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a99:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a9d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800aa1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800aa8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ab4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ab8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800abc:	48 b8 3a 0a 80 00 00 	movabs $0x800a3a,%rax
+  800ac3:	00 00 00 
+  800ac6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ac8:	c9                   	leave
+  800ac9:	c3                   	ret
+
+0000000000800aca <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aca:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800acd:	74 10                	je     800adf <strlen+0x15>
+    size_t n = 0;
+  800acf:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ad4:	48 83 c0 01          	add    $0x1,%rax
+  800ad8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800adc:	75 f6                	jne    800ad4 <strlen+0xa>
+  800ade:	c3                   	ret
+    size_t n = 0;
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ae4:	c3                   	ret
+
+0000000000800ae5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ae5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ae8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800aed:	48 85 f6             	test   %rsi,%rsi
+  800af0:	74 11                	je     800b03 <strnlen+0x1e>
+  800af2:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800af6:	74 0c                	je     800b04 <strnlen+0x1f>
+  800af8:	48 83 c2 01          	add    $0x1,%rdx
+  800afc:	48 39 d0             	cmp    %rdx,%rax
+  800aff:	75 f1                	jne    800af2 <strnlen+0xd>
+  800b01:	eb 04                	jmp    800b07 <strnlen+0x22>
+  800b03:	c3                   	ret
+  800b04:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b07:	c3                   	ret
+
+0000000000800b08 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b08:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b10:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b14:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b17:	48 83 c2 01          	add    $0x1,%rdx
+  800b1b:	84 c9                	test   %cl,%cl
+  800b1d:	75 f1                	jne    800b10 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b1f:	c3                   	ret
+
+0000000000800b20 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b20:	55                   	push   %rbp
+  800b21:	48 89 e5             	mov    %rsp,%rbp
+  800b24:	41 54                	push   %r12
+  800b26:	53                   	push   %rbx
+  800b27:	48 89 fb             	mov    %rdi,%rbx
+  800b2a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b2d:	48 b8 ca 0a 80 00 00 	movabs $0x800aca,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b39:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b3d:	4c 89 e6             	mov    %r12,%rsi
+  800b40:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+    return dst;
+}
+  800b4c:	48 89 d8             	mov    %rbx,%rax
+  800b4f:	5b                   	pop    %rbx
+  800b50:	41 5c                	pop    %r12
+  800b52:	5d                   	pop    %rbp
+  800b53:	c3                   	ret
+
+0000000000800b54 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b54:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b57:	48 85 d2             	test   %rdx,%rdx
+  800b5a:	74 1f                	je     800b7b <strncpy+0x27>
+  800b5c:	48 01 fa             	add    %rdi,%rdx
+  800b5f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b62:	48 83 c1 01          	add    $0x1,%rcx
+  800b66:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b6a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b6e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b72:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b76:	48 39 ca             	cmp    %rcx,%rdx
+  800b79:	75 e7                	jne    800b62 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b7b:	c3                   	ret
+
+0000000000800b7c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b7c:	48 89 f8             	mov    %rdi,%rax
+  800b7f:	48 85 d2             	test   %rdx,%rdx
+  800b82:	74 24                	je     800ba8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b84:	48 83 ea 01          	sub    $0x1,%rdx
+  800b88:	74 1b                	je     800ba5 <strlcpy+0x29>
+  800b8a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b8e:	0f b6 16             	movzbl (%rsi),%edx
+  800b91:	84 d2                	test   %dl,%dl
+  800b93:	74 10                	je     800ba5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b95:	48 83 c6 01          	add    $0x1,%rsi
+  800b99:	48 83 c0 01          	add    $0x1,%rax
+  800b9d:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ba0:	48 39 c8             	cmp    %rcx,%rax
+  800ba3:	75 e9                	jne    800b8e <strlcpy+0x12>
+        *dst = '\0';
+  800ba5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ba8:	48 29 f8             	sub    %rdi,%rax
+}
+  800bab:	c3                   	ret
+
+0000000000800bac <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bac:	0f b6 07             	movzbl (%rdi),%eax
+  800baf:	84 c0                	test   %al,%al
+  800bb1:	74 13                	je     800bc6 <strcmp+0x1a>
+  800bb3:	38 06                	cmp    %al,(%rsi)
+  800bb5:	75 0f                	jne    800bc6 <strcmp+0x1a>
+  800bb7:	48 83 c7 01          	add    $0x1,%rdi
+  800bbb:	48 83 c6 01          	add    $0x1,%rsi
+  800bbf:	0f b6 07             	movzbl (%rdi),%eax
+  800bc2:	84 c0                	test   %al,%al
+  800bc4:	75 ed                	jne    800bb3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bc6:	0f b6 c0             	movzbl %al,%eax
+  800bc9:	0f b6 16             	movzbl (%rsi),%edx
+  800bcc:	29 d0                	sub    %edx,%eax
+}
+  800bce:	c3                   	ret
+
+0000000000800bcf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bcf:	48 85 d2             	test   %rdx,%rdx
+  800bd2:	74 1f                	je     800bf3 <strncmp+0x24>
+  800bd4:	0f b6 07             	movzbl (%rdi),%eax
+  800bd7:	84 c0                	test   %al,%al
+  800bd9:	74 1e                	je     800bf9 <strncmp+0x2a>
+  800bdb:	3a 06                	cmp    (%rsi),%al
+  800bdd:	75 1a                	jne    800bf9 <strncmp+0x2a>
+  800bdf:	48 83 c7 01          	add    $0x1,%rdi
+  800be3:	48 83 c6 01          	add    $0x1,%rsi
+  800be7:	48 83 ea 01          	sub    $0x1,%rdx
+  800beb:	75 e7                	jne    800bd4 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf2:	c3                   	ret
+  800bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf8:	c3                   	ret
+  800bf9:	48 85 d2             	test   %rdx,%rdx
+  800bfc:	74 09                	je     800c07 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfe:	0f b6 07             	movzbl (%rdi),%eax
+  800c01:	0f b6 16             	movzbl (%rsi),%edx
+  800c04:	29 d0                	sub    %edx,%eax
+  800c06:	c3                   	ret
+    if (!n) return 0;
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c0c:	c3                   	ret
+
+0000000000800c0d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c0d:	0f b6 17             	movzbl (%rdi),%edx
+  800c10:	84 d2                	test   %dl,%dl
+  800c12:	74 18                	je     800c2c <strchr+0x1f>
+        if (*str == c) {
+  800c14:	0f be d2             	movsbl %dl,%edx
+  800c17:	39 f2                	cmp    %esi,%edx
+  800c19:	74 17                	je     800c32 <strchr+0x25>
+    for (; *str; str++) {
+  800c1b:	48 83 c7 01          	add    $0x1,%rdi
+  800c1f:	0f b6 17             	movzbl (%rdi),%edx
+  800c22:	84 d2                	test   %dl,%dl
+  800c24:	75 ee                	jne    800c14 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c26:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2b:	c3                   	ret
+  800c2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c31:	c3                   	ret
+  800c32:	48 89 f8             	mov    %rdi,%rax
+}
+  800c35:	c3                   	ret
+
+0000000000800c36 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c36:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c39:	0f b6 17             	movzbl (%rdi),%edx
+  800c3c:	84 d2                	test   %dl,%dl
+  800c3e:	74 13                	je     800c53 <strfind+0x1d>
+  800c40:	0f be d2             	movsbl %dl,%edx
+  800c43:	39 f2                	cmp    %esi,%edx
+  800c45:	74 0b                	je     800c52 <strfind+0x1c>
+  800c47:	48 83 c0 01          	add    $0x1,%rax
+  800c4b:	0f b6 10             	movzbl (%rax),%edx
+  800c4e:	84 d2                	test   %dl,%dl
+  800c50:	75 ee                	jne    800c40 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c52:	c3                   	ret
+  800c53:	c3                   	ret
+
+0000000000800c54 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c54:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c57:	48 89 f8             	mov    %rdi,%rax
+  800c5a:	48 f7 d8             	neg    %rax
+  800c5d:	83 e0 07             	and    $0x7,%eax
+  800c60:	49 89 d1             	mov    %rdx,%r9
+  800c63:	49 29 c1             	sub    %rax,%r9
+  800c66:	78 36                	js     800c9e <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c68:	40 0f b6 c6          	movzbl %sil,%eax
+  800c6c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c73:	01 01 01 
+  800c76:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c7a:	40 f6 c7 07          	test   $0x7,%dil
+  800c7e:	75 38                	jne    800cb8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c80:	4c 89 c9             	mov    %r9,%rcx
+  800c83:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c87:	74 0c                	je     800c95 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c89:	fc                   	cld
+  800c8a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c8d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c91:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c95:	4d 85 c9             	test   %r9,%r9
+  800c98:	75 45                	jne    800cdf <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c9a:	4c 89 c0             	mov    %r8,%rax
+  800c9d:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c9e:	48 85 d2             	test   %rdx,%rdx
+  800ca1:	74 f7                	je     800c9a <memset+0x46>
+  800ca3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ca6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ca9:	48 83 c0 01          	add    $0x1,%rax
+  800cad:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cb1:	48 39 c2             	cmp    %rax,%rdx
+  800cb4:	75 f3                	jne    800ca9 <memset+0x55>
+  800cb6:	eb e2                	jmp    800c9a <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cb8:	40 f6 c7 01          	test   $0x1,%dil
+  800cbc:	74 06                	je     800cc4 <memset+0x70>
+  800cbe:	88 07                	mov    %al,(%rdi)
+  800cc0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cc4:	40 f6 c7 02          	test   $0x2,%dil
+  800cc8:	74 07                	je     800cd1 <memset+0x7d>
+  800cca:	66 89 07             	mov    %ax,(%rdi)
+  800ccd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd1:	40 f6 c7 04          	test   $0x4,%dil
+  800cd5:	74 a9                	je     800c80 <memset+0x2c>
+  800cd7:	89 07                	mov    %eax,(%rdi)
+  800cd9:	48 83 c7 04          	add    $0x4,%rdi
+  800cdd:	eb a1                	jmp    800c80 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cdf:	41 f6 c1 04          	test   $0x4,%r9b
+  800ce3:	74 06                	je     800ceb <memset+0x97>
+  800ce5:	89 07                	mov    %eax,(%rdi)
+  800ce7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ceb:	41 f6 c1 02          	test   $0x2,%r9b
+  800cef:	74 07                	je     800cf8 <memset+0xa4>
+  800cf1:	66 89 07             	mov    %ax,(%rdi)
+  800cf4:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cf8:	41 f6 c1 01          	test   $0x1,%r9b
+  800cfc:	74 9c                	je     800c9a <memset+0x46>
+  800cfe:	88 07                	mov    %al,(%rdi)
+  800d00:	eb 98                	jmp    800c9a <memset+0x46>
+
+0000000000800d02 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d02:	48 89 f8             	mov    %rdi,%rax
+  800d05:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d08:	48 39 fe             	cmp    %rdi,%rsi
+  800d0b:	73 3b                	jae    800d48 <memmove+0x46>
+  800d0d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d11:	48 39 d7             	cmp    %rdx,%rdi
+  800d14:	73 32                	jae    800d48 <memmove+0x46>
+        s += n;
+        d += n;
+  800d16:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d1a:	48 89 d6             	mov    %rdx,%rsi
+  800d1d:	48 09 fe             	or     %rdi,%rsi
+  800d20:	48 09 ce             	or     %rcx,%rsi
+  800d23:	40 f6 c6 07          	test   $0x7,%sil
+  800d27:	75 12                	jne    800d3b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d29:	48 83 ef 08          	sub    $0x8,%rdi
+  800d2d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d31:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d35:	fd                   	std
+  800d36:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d39:	fc                   	cld
+  800d3a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d3b:	48 83 ef 01          	sub    $0x1,%rdi
+  800d3f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d43:	fd                   	std
+  800d44:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d46:	eb f1                	jmp    800d39 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d48:	48 89 f2             	mov    %rsi,%rdx
+  800d4b:	48 09 c2             	or     %rax,%rdx
+  800d4e:	48 09 ca             	or     %rcx,%rdx
+  800d51:	f6 c2 07             	test   $0x7,%dl
+  800d54:	75 0c                	jne    800d62 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d56:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d5a:	48 89 c7             	mov    %rax,%rdi
+  800d5d:	fc                   	cld
+  800d5e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d61:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d62:	48 89 c7             	mov    %rax,%rdi
+  800d65:	fc                   	cld
+  800d66:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d68:	c3                   	ret
+
+0000000000800d69 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d69:	55                   	push   %rbp
+  800d6a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d6d:	48 b8 02 0d 80 00 00 	movabs $0x800d02,%rax
+  800d74:	00 00 00 
+  800d77:	ff d0                	call   *%rax
+}
+  800d79:	5d                   	pop    %rbp
+  800d7a:	c3                   	ret
+
+0000000000800d7b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d7b:	55                   	push   %rbp
+  800d7c:	48 89 e5             	mov    %rsp,%rbp
+  800d7f:	41 57                	push   %r15
+  800d81:	41 56                	push   %r14
+  800d83:	41 55                	push   %r13
+  800d85:	41 54                	push   %r12
+  800d87:	53                   	push   %rbx
+  800d88:	48 83 ec 08          	sub    $0x8,%rsp
+  800d8c:	49 89 fe             	mov    %rdi,%r14
+  800d8f:	49 89 f7             	mov    %rsi,%r15
+  800d92:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d95:	48 89 f7             	mov    %rsi,%rdi
+  800d98:	48 b8 ca 0a 80 00 00 	movabs $0x800aca,%rax
+  800d9f:	00 00 00 
+  800da2:	ff d0                	call   *%rax
+  800da4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800da7:	48 89 de             	mov    %rbx,%rsi
+  800daa:	4c 89 f7             	mov    %r14,%rdi
+  800dad:	48 b8 e5 0a 80 00 00 	movabs $0x800ae5,%rax
+  800db4:	00 00 00 
+  800db7:	ff d0                	call   *%rax
+  800db9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dbc:	48 39 c3             	cmp    %rax,%rbx
+  800dbf:	74 36                	je     800df7 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dc1:	48 89 d8             	mov    %rbx,%rax
+  800dc4:	4c 29 e8             	sub    %r13,%rax
+  800dc7:	49 39 c4             	cmp    %rax,%r12
+  800dca:	73 31                	jae    800dfd <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dcc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dd1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dd5:	4c 89 fe             	mov    %r15,%rsi
+  800dd8:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800ddf:	00 00 00 
+  800de2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800de4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800de8:	48 83 c4 08          	add    $0x8,%rsp
+  800dec:	5b                   	pop    %rbx
+  800ded:	41 5c                	pop    %r12
+  800def:	41 5d                	pop    %r13
+  800df1:	41 5e                	pop    %r14
+  800df3:	41 5f                	pop    %r15
+  800df5:	5d                   	pop    %rbp
+  800df6:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df7:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800dfb:	eb eb                	jmp    800de8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dfd:	48 83 eb 01          	sub    $0x1,%rbx
+  800e01:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e05:	48 89 da             	mov    %rbx,%rdx
+  800e08:	4c 89 fe             	mov    %r15,%rsi
+  800e0b:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  800e12:	00 00 00 
+  800e15:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e17:	49 01 de             	add    %rbx,%r14
+  800e1a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e1f:	eb c3                	jmp    800de4 <strlcat+0x69>
+
+0000000000800e21 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e21:	48 85 d2             	test   %rdx,%rdx
+  800e24:	74 2d                	je     800e53 <memcmp+0x32>
+  800e26:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e2b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e2f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e34:	44 38 c1             	cmp    %r8b,%cl
+  800e37:	75 0f                	jne    800e48 <memcmp+0x27>
+    while (n-- > 0) {
+  800e39:	48 83 c0 01          	add    $0x1,%rax
+  800e3d:	48 39 c2             	cmp    %rax,%rdx
+  800e40:	75 e9                	jne    800e2b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e42:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e47:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e48:	0f b6 c1             	movzbl %cl,%eax
+  800e4b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e4f:	44 29 c0             	sub    %r8d,%eax
+  800e52:	c3                   	ret
+    return 0;
+  800e53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e58:	c3                   	ret
+
+0000000000800e59 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e59:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e5d:	48 39 c7             	cmp    %rax,%rdi
+  800e60:	73 0f                	jae    800e71 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e62:	40 38 37             	cmp    %sil,(%rdi)
+  800e65:	74 0e                	je     800e75 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e67:	48 83 c7 01          	add    $0x1,%rdi
+  800e6b:	48 39 f8             	cmp    %rdi,%rax
+  800e6e:	75 f2                	jne    800e62 <memfind+0x9>
+  800e70:	c3                   	ret
+  800e71:	48 89 f8             	mov    %rdi,%rax
+  800e74:	c3                   	ret
+  800e75:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e78:	c3                   	ret
+
+0000000000800e79 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e79:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e7c:	0f b6 37             	movzbl (%rdi),%esi
+  800e7f:	40 80 fe 20          	cmp    $0x20,%sil
+  800e83:	74 06                	je     800e8b <strtol+0x12>
+  800e85:	40 80 fe 09          	cmp    $0x9,%sil
+  800e89:	75 13                	jne    800e9e <strtol+0x25>
+  800e8b:	48 83 c7 01          	add    $0x1,%rdi
+  800e8f:	0f b6 37             	movzbl (%rdi),%esi
+  800e92:	40 80 fe 20          	cmp    $0x20,%sil
+  800e96:	74 f3                	je     800e8b <strtol+0x12>
+  800e98:	40 80 fe 09          	cmp    $0x9,%sil
+  800e9c:	74 ed                	je     800e8b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e9e:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ea1:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ea4:	3c 01                	cmp    $0x1,%al
+  800ea6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eaa:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800eb0:	75 0f                	jne    800ec1 <strtol+0x48>
+  800eb2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eb5:	74 14                	je     800ecb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eb7:	85 d2                	test   %edx,%edx
+  800eb9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ebe:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ec1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ec6:	4c 63 ca             	movslq %edx,%r9
+  800ec9:	eb 36                	jmp    800f01 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ecb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ecf:	74 0f                	je     800ee0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ed1:	85 d2                	test   %edx,%edx
+  800ed3:	75 ec                	jne    800ec1 <strtol+0x48>
+        s++;
+  800ed5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ed9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ede:	eb e1                	jmp    800ec1 <strtol+0x48>
+        s += 2;
+  800ee0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ee4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ee9:	eb d6                	jmp    800ec1 <strtol+0x48>
+            dig -= '0';
+  800eeb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800eee:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ef2:	41 39 d0             	cmp    %edx,%r8d
+  800ef5:	7d 21                	jge    800f18 <strtol+0x9f>
+        val = val * base + dig;
+  800ef7:	49 0f af c1          	imul   %r9,%rax
+  800efb:	0f b6 c9             	movzbl %cl,%ecx
+  800efe:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f01:	48 83 c7 01          	add    $0x1,%rdi
+  800f05:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f09:	80 f9 39             	cmp    $0x39,%cl
+  800f0c:	76 dd                	jbe    800eeb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f0e:	80 f9 7b             	cmp    $0x7b,%cl
+  800f11:	77 05                	ja     800f18 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f13:	83 e9 57             	sub    $0x57,%ecx
+  800f16:	eb d6                	jmp    800eee <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f18:	4d 85 d2             	test   %r10,%r10
+  800f1b:	74 03                	je     800f20 <strtol+0xa7>
+  800f1d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f20:	48 89 c2             	mov    %rax,%rdx
+  800f23:	48 f7 da             	neg    %rdx
+  800f26:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f2a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f2f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f39:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f3f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f45:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f4b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f4d:	c3                   	ret
+
+0000000000800f4e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f4e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f53:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f58:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f62:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f68:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f6e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f74:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f76:	c3                   	ret
+
+0000000000800f77 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f77:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f7a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f7f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f84:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f89:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f8f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f95:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f9b:	0f 05                	syscall
+    if (check && ret > 0) {
+  800f9d:	48 85 c0             	test   %rax,%rax
+  800fa0:	7f 01                	jg     800fa3 <sys_env_destroy+0x2c>
+}
+  800fa2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800fa3:	55                   	push   %rbp
+  800fa4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fa7:	49 89 c0             	mov    %rax,%r8
+  800faa:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800faf:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  800fb6:	00 00 00 
+  800fb9:	be 29 00 00 00       	mov    $0x29,%esi
+  800fbe:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  800fc5:	00 00 00 
+  800fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcd:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  800fd4:	00 00 00 
+  800fd7:	41 ff d1             	call   *%r9
+
+0000000000800fda <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fda:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fe4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fe9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800ff4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ffa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801000:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801002:	c3                   	ret
+
+0000000000801003 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801003:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801008:	bf 00 00 00 00       	mov    $0x0,%edi
+  80100d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801012:	ba 00 00 00 00       	mov    $0x0,%edx
+  801017:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80101d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801023:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801029:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80102b:	c3                   	ret
+
+000000000080102c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80102c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801031:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801038:	00 00 00 
+  80103b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801041:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801047:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80104d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80104f:	c3                   	ret
+
+0000000000801050 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801050:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801053:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801058:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80105e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801064:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801066:	c3                   	ret
+
+0000000000801067 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801067:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80106a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80106f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801072:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801078:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80107e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801080:	48 85 c0             	test   %rax,%rax
+  801083:	7f 01                	jg     801086 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801085:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801086:	55                   	push   %rbp
+  801087:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80108a:	49 89 c0             	mov    %rax,%r8
+  80108d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801092:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801099:	00 00 00 
+  80109c:	be 29 00 00 00       	mov    $0x29,%esi
+  8010a1:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8010a8:	00 00 00 
+  8010ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010b0:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  8010b7:	00 00 00 
+  8010ba:	41 ff d1             	call   *%r9
+
+00000000008010bd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010bd:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010c0:	48 63 d2             	movslq %edx,%rdx
+  8010c3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010c6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010cb:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010ce:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010d0:	48 85 c0             	test   %rax,%rax
+  8010d3:	7f 01                	jg     8010d6 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010d5:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010d6:	55                   	push   %rbp
+  8010d7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010da:	49 89 c0             	mov    %rax,%r8
+  8010dd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010e2:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8010e9:	00 00 00 
+  8010ec:	be 29 00 00 00       	mov    $0x29,%esi
+  8010f1:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8010f8:	00 00 00 
+  8010fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801100:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  801107:	00 00 00 
+  80110a:	41 ff d1             	call   *%r9
+
+000000000080110d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80110d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801110:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801115:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80111b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801121:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801127:	0f 05                	syscall
+    if (check && ret > 0) {
+  801129:	48 85 c0             	test   %rax,%rax
+  80112c:	7f 01                	jg     80112f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80112e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80112f:	55                   	push   %rbp
+  801130:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801133:	49 89 c0             	mov    %rax,%r8
+  801136:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80113b:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801142:	00 00 00 
+  801145:	be 29 00 00 00       	mov    $0x29,%esi
+  80114a:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801151:	00 00 00 
+  801154:	b8 00 00 00 00       	mov    $0x0,%eax
+  801159:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  801160:	00 00 00 
+  801163:	41 ff d1             	call   *%r9
+
+0000000000801166 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801166:	48 63 f6             	movslq %esi,%rsi
+  801169:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80116c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801171:	ba 00 00 00 00       	mov    $0x0,%edx
+  801176:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80117c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801182:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801188:	0f 05                	syscall
+    if (check && ret > 0) {
+  80118a:	48 85 c0             	test   %rax,%rax
+  80118d:	7f 01                	jg     801190 <sys_env_set_status+0x2a>
+}
+  80118f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801190:	55                   	push   %rbp
+  801191:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801194:	49 89 c0             	mov    %rax,%r8
+  801197:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80119c:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8011a3:	00 00 00 
+  8011a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8011ab:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8011b2:	00 00 00 
+  8011b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ba:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  8011c1:	00 00 00 
+  8011c4:	41 ff d1             	call   *%r9
+
+00000000008011c7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011c7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011ca:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011e8:	48 85 c0             	test   %rax,%rax
+  8011eb:	7f 01                	jg     8011ee <sys_env_set_trapframe+0x27>
+}
+  8011ed:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011ee:	55                   	push   %rbp
+  8011ef:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f2:	49 89 c0             	mov    %rax,%r8
+  8011f5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8011fa:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801201:	00 00 00 
+  801204:	be 29 00 00 00       	mov    $0x29,%esi
+  801209:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801210:	00 00 00 
+  801213:	b8 00 00 00 00       	mov    $0x0,%eax
+  801218:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  80121f:	00 00 00 
+  801222:	41 ff d1             	call   *%r9
+
+0000000000801225 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801225:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801228:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80122d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801232:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80123e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801244:	0f 05                	syscall
+    if (check && ret > 0) {
+  801246:	48 85 c0             	test   %rax,%rax
+  801249:	7f 01                	jg     80124c <sys_env_set_pgfault_upcall+0x27>
+}
+  80124b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80124c:	55                   	push   %rbp
+  80124d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801250:	49 89 c0             	mov    %rax,%r8
+  801253:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801258:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  80125f:	00 00 00 
+  801262:	be 29 00 00 00       	mov    $0x29,%esi
+  801267:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  80126e:	00 00 00 
+  801271:	b8 00 00 00 00       	mov    $0x0,%eax
+  801276:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  80127d:	00 00 00 
+  801280:	41 ff d1             	call   *%r9
+
+0000000000801283 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801283:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801286:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801289:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128e:	4d 63 c0             	movslq %r8d,%r8
+  801291:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801297:	0f 05                	syscall
+}
+  801299:	c3                   	ret
+
+000000000080129a <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80129a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80129d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a5:	4d 63 c0             	movslq %r8d,%r8
+  8012a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012ae:	0f 05                	syscall
+}
+  8012b0:	c3                   	ret
+
+00000000008012b1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012b1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b9:	45 89 c0             	mov    %r8d,%r8d
+  8012bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c4:	48 85 c0             	test   %rax,%rax
+  8012c7:	7f 01                	jg     8012ca <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012c9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012ca:	55                   	push   %rbp
+  8012cb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ce:	49 89 c0             	mov    %rax,%r8
+  8012d1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012d6:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8012dd:	00 00 00 
+  8012e0:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e5:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8012ec:	00 00 00 
+  8012ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f4:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  8012fb:	00 00 00 
+  8012fe:	41 ff d1             	call   *%r9
+
+0000000000801301 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801301:	55                   	push   %rbp
+  801302:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801305:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80130b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801310:	ba 00 00 00 00       	mov    $0x0,%edx
+  801315:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80131c:	00 00 00 
+  80131f:	ff d0                	call   *%rax
+}
+  801321:	5d                   	pop    %rbp
+  801322:	c3                   	ret
+
+0000000000801323 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801323:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801328:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801332:	ba 00 00 00 00       	mov    $0x0,%edx
+  801337:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80133d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801343:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801349:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80134b:	c3                   	ret
+
+000000000080134c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80134c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801351:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801361:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801367:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80136d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80136f:	48 85 c0             	test   %rax,%rax
+  801372:	7f 01                	jg     801375 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801374:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801375:	55                   	push   %rbp
+  801376:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801379:	49 89 c0             	mov    %rax,%r8
+  80137c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801381:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801388:	00 00 00 
+  80138b:	be 29 00 00 00       	mov    $0x29,%esi
+  801390:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801397:	00 00 00 
+  80139a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139f:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  8013a6:	00 00 00 
+  8013a9:	41 ff d1             	call   *%r9
+
+00000000008013ac <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013b6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d2:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013d4:	c3                   	ret
+
+00000000008013d5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013d5:	89 d2                	mov    %edx,%edx
+  8013d7:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013de:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f0:	0f 05                	syscall
+}
+  8013f2:	c3                   	ret
+
+00000000008013f3 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8013f3:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801400:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80140c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801412:	0f 05                	syscall
+}
+  801414:	c3                   	ret
+
+0000000000801415 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801415:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801418:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801422:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801428:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80142e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801434:	0f 05                	syscall
+}
+  801436:	c3                   	ret
+
+0000000000801437 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801437:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80143a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80143f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801444:	ba 00 00 00 00       	mov    $0x0,%edx
+  801449:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801455:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80145b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80145d:	48 85 c0             	test   %rax,%rax
+  801460:	7f 01                	jg     801463 <sys_irq_ack+0x2c>
+}
+  801462:	c3                   	ret
+sys_irq_ack(int irq) {
+  801463:	55                   	push   %rbp
+  801464:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801467:	49 89 c0             	mov    %rax,%r8
+  80146a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80146f:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801476:	00 00 00 
+  801479:	be 29 00 00 00       	mov    $0x29,%esi
+  80147e:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801485:	00 00 00 
+  801488:	b8 00 00 00 00       	mov    $0x0,%eax
+  80148d:	49 b9 85 41 80 00 00 	movabs $0x804185,%r9
+  801494:	00 00 00 
+  801497:	41 ff d1             	call   *%r9
+
+000000000080149a <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80149a:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014a1:	ff ff ff 
+  8014a4:	48 01 f8             	add    %rdi,%rax
+  8014a7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014ab:	c3                   	ret
+
+00000000008014ac <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014ac:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014b3:	ff ff ff 
+  8014b6:	48 01 f8             	add    %rdi,%rax
+  8014b9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014bd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014c3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014c7:	c3                   	ret
+
+00000000008014c8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014c8:	55                   	push   %rbp
+  8014c9:	48 89 e5             	mov    %rsp,%rbp
+  8014cc:	41 57                	push   %r15
+  8014ce:	41 56                	push   %r14
+  8014d0:	41 55                	push   %r13
+  8014d2:	41 54                	push   %r12
+  8014d4:	53                   	push   %rbx
+  8014d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014d9:	49 89 ff             	mov    %rdi,%r15
+  8014dc:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014e1:	49 bd 57 3c 80 00 00 	movabs $0x803c57,%r13
+  8014e8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014eb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8014f1:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8014f4:	48 89 df             	mov    %rbx,%rdi
+  8014f7:	41 ff d5             	call   *%r13
+  8014fa:	83 e0 04             	and    $0x4,%eax
+  8014fd:	74 17                	je     801516 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8014ff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801506:	4c 39 f3             	cmp    %r14,%rbx
+  801509:	75 e6                	jne    8014f1 <fd_alloc+0x29>
+  80150b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801511:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801516:	4d 89 27             	mov    %r12,(%r15)
+}
+  801519:	48 83 c4 08          	add    $0x8,%rsp
+  80151d:	5b                   	pop    %rbx
+  80151e:	41 5c                	pop    %r12
+  801520:	41 5d                	pop    %r13
+  801522:	41 5e                	pop    %r14
+  801524:	41 5f                	pop    %r15
+  801526:	5d                   	pop    %rbp
+  801527:	c3                   	ret
+
+0000000000801528 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801528:	83 ff 1f             	cmp    $0x1f,%edi
+  80152b:	77 39                	ja     801566 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80152d:	55                   	push   %rbp
+  80152e:	48 89 e5             	mov    %rsp,%rbp
+  801531:	41 54                	push   %r12
+  801533:	53                   	push   %rbx
+  801534:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801537:	48 63 df             	movslq %edi,%rbx
+  80153a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801541:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801545:	48 89 df             	mov    %rbx,%rdi
+  801548:	48 b8 57 3c 80 00 00 	movabs $0x803c57,%rax
+  80154f:	00 00 00 
+  801552:	ff d0                	call   *%rax
+  801554:	a8 04                	test   $0x4,%al
+  801556:	74 14                	je     80156c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801558:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80155c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801561:	5b                   	pop    %rbx
+  801562:	41 5c                	pop    %r12
+  801564:	5d                   	pop    %rbp
+  801565:	c3                   	ret
+        return -E_INVAL;
+  801566:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80156b:	c3                   	ret
+        return -E_INVAL;
+  80156c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801571:	eb ee                	jmp    801561 <fd_lookup+0x39>
+
+0000000000801573 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801573:	55                   	push   %rbp
+  801574:	48 89 e5             	mov    %rsp,%rbp
+  801577:	41 54                	push   %r12
+  801579:	53                   	push   %rbx
+  80157a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80157d:	48 b8 00 4d 80 00 00 	movabs $0x804d00,%rax
+  801584:	00 00 00 
+  801587:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80158e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801591:	39 3b                	cmp    %edi,(%rbx)
+  801593:	74 47                	je     8015dc <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801595:	48 83 c0 08          	add    $0x8,%rax
+  801599:	48 8b 18             	mov    (%rax),%rbx
+  80159c:	48 85 db             	test   %rbx,%rbx
+  80159f:	75 f0                	jne    801591 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015a1:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8015a8:	00 00 00 
+  8015ab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8015b1:	89 fa                	mov    %edi,%edx
+  8015b3:	48 bf 68 4c 80 00 00 	movabs $0x804c68,%rdi
+  8015ba:	00 00 00 
+  8015bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c2:	48 b9 e3 01 80 00 00 	movabs $0x8001e3,%rcx
+  8015c9:	00 00 00 
+  8015cc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015ce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015d3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015d7:	5b                   	pop    %rbx
+  8015d8:	41 5c                	pop    %r12
+  8015da:	5d                   	pop    %rbp
+  8015db:	c3                   	ret
+            return 0;
+  8015dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015e1:	eb f0                	jmp    8015d3 <dev_lookup+0x60>
+
+00000000008015e3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015e3:	55                   	push   %rbp
+  8015e4:	48 89 e5             	mov    %rsp,%rbp
+  8015e7:	41 55                	push   %r13
+  8015e9:	41 54                	push   %r12
+  8015eb:	53                   	push   %rbx
+  8015ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8015f0:	48 89 fb             	mov    %rdi,%rbx
+  8015f3:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015f6:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8015fd:	ff ff ff 
+  801600:	48 01 df             	add    %rbx,%rdi
+  801603:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801607:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80160b:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  801612:	00 00 00 
+  801615:	ff d0                	call   *%rax
+  801617:	41 89 c5             	mov    %eax,%r13d
+  80161a:	85 c0                	test   %eax,%eax
+  80161c:	78 06                	js     801624 <fd_close+0x41>
+  80161e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801622:	74 1a                	je     80163e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801624:	45 84 e4             	test   %r12b,%r12b
+  801627:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801630:	44 89 e8             	mov    %r13d,%eax
+  801633:	48 83 c4 18          	add    $0x18,%rsp
+  801637:	5b                   	pop    %rbx
+  801638:	41 5c                	pop    %r12
+  80163a:	41 5d                	pop    %r13
+  80163c:	5d                   	pop    %rbp
+  80163d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80163e:	8b 3b                	mov    (%rbx),%edi
+  801640:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801644:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  80164b:	00 00 00 
+  80164e:	ff d0                	call   *%rax
+  801650:	41 89 c5             	mov    %eax,%r13d
+  801653:	85 c0                	test   %eax,%eax
+  801655:	78 1b                	js     801672 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801657:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80165b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80165f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801665:	48 85 c0             	test   %rax,%rax
+  801668:	74 08                	je     801672 <fd_close+0x8f>
+  80166a:	48 89 df             	mov    %rbx,%rdi
+  80166d:	ff d0                	call   *%rax
+  80166f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801672:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801677:	48 89 de             	mov    %rbx,%rsi
+  80167a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80167f:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  801686:	00 00 00 
+  801689:	ff d0                	call   *%rax
+    return res;
+  80168b:	eb a3                	jmp    801630 <fd_close+0x4d>
+
+000000000080168d <close>:
+
+int
+close(int fdnum) {
+  80168d:	55                   	push   %rbp
+  80168e:	48 89 e5             	mov    %rsp,%rbp
+  801691:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801695:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801699:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  8016a0:	00 00 00 
+  8016a3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016a5:	85 c0                	test   %eax,%eax
+  8016a7:	78 15                	js     8016be <close+0x31>
+
+    return fd_close(fd, 1);
+  8016a9:	be 01 00 00 00       	mov    $0x1,%esi
+  8016ae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016b2:	48 b8 e3 15 80 00 00 	movabs $0x8015e3,%rax
+  8016b9:	00 00 00 
+  8016bc:	ff d0                	call   *%rax
+}
+  8016be:	c9                   	leave
+  8016bf:	c3                   	ret
+
+00000000008016c0 <close_all>:
+
+void
+close_all(void) {
+  8016c0:	55                   	push   %rbp
+  8016c1:	48 89 e5             	mov    %rsp,%rbp
+  8016c4:	41 54                	push   %r12
+  8016c6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016c7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016cc:	49 bc 8d 16 80 00 00 	movabs $0x80168d,%r12
+  8016d3:	00 00 00 
+  8016d6:	89 df                	mov    %ebx,%edi
+  8016d8:	41 ff d4             	call   *%r12
+  8016db:	83 c3 01             	add    $0x1,%ebx
+  8016de:	83 fb 20             	cmp    $0x20,%ebx
+  8016e1:	75 f3                	jne    8016d6 <close_all+0x16>
+}
+  8016e3:	5b                   	pop    %rbx
+  8016e4:	41 5c                	pop    %r12
+  8016e6:	5d                   	pop    %rbp
+  8016e7:	c3                   	ret
+
+00000000008016e8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016e8:	55                   	push   %rbp
+  8016e9:	48 89 e5             	mov    %rsp,%rbp
+  8016ec:	41 57                	push   %r15
+  8016ee:	41 56                	push   %r14
+  8016f0:	41 55                	push   %r13
+  8016f2:	41 54                	push   %r12
+  8016f4:	53                   	push   %rbx
+  8016f5:	48 83 ec 18          	sub    $0x18,%rsp
+  8016f9:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8016fc:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801700:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  801707:	00 00 00 
+  80170a:	ff d0                	call   *%rax
+  80170c:	89 c3                	mov    %eax,%ebx
+  80170e:	85 c0                	test   %eax,%eax
+  801710:	0f 88 b8 00 00 00    	js     8017ce <dup+0xe6>
+    close(newfdnum);
+  801716:	44 89 e7             	mov    %r12d,%edi
+  801719:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  801720:	00 00 00 
+  801723:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801725:	4d 63 ec             	movslq %r12d,%r13
+  801728:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80172f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801733:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801737:	4c 89 ff             	mov    %r15,%rdi
+  80173a:	49 be ac 14 80 00 00 	movabs $0x8014ac,%r14
+  801741:	00 00 00 
+  801744:	41 ff d6             	call   *%r14
+  801747:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80174a:	4c 89 ef             	mov    %r13,%rdi
+  80174d:	41 ff d6             	call   *%r14
+  801750:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801753:	48 89 df             	mov    %rbx,%rdi
+  801756:	48 b8 57 3c 80 00 00 	movabs $0x803c57,%rax
+  80175d:	00 00 00 
+  801760:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801762:	a8 04                	test   $0x4,%al
+  801764:	74 2b                	je     801791 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801766:	41 89 c1             	mov    %eax,%r9d
+  801769:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80176f:	4c 89 f1             	mov    %r14,%rcx
+  801772:	ba 00 00 00 00       	mov    $0x0,%edx
+  801777:	48 89 de             	mov    %rbx,%rsi
+  80177a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80177f:	48 b8 bd 10 80 00 00 	movabs $0x8010bd,%rax
+  801786:	00 00 00 
+  801789:	ff d0                	call   *%rax
+  80178b:	89 c3                	mov    %eax,%ebx
+  80178d:	85 c0                	test   %eax,%eax
+  80178f:	78 4e                	js     8017df <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801791:	4c 89 ff             	mov    %r15,%rdi
+  801794:	48 b8 57 3c 80 00 00 	movabs $0x803c57,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+  8017a0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8017a3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017a9:	4c 89 e9             	mov    %r13,%rcx
+  8017ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b1:	4c 89 fe             	mov    %r15,%rsi
+  8017b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017b9:	48 b8 bd 10 80 00 00 	movabs $0x8010bd,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+  8017c5:	89 c3                	mov    %eax,%ebx
+  8017c7:	85 c0                	test   %eax,%eax
+  8017c9:	78 14                	js     8017df <dup+0xf7>
+
+    return newfdnum;
+  8017cb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017ce:	89 d8                	mov    %ebx,%eax
+  8017d0:	48 83 c4 18          	add    $0x18,%rsp
+  8017d4:	5b                   	pop    %rbx
+  8017d5:	41 5c                	pop    %r12
+  8017d7:	41 5d                	pop    %r13
+  8017d9:	41 5e                	pop    %r14
+  8017db:	41 5f                	pop    %r15
+  8017dd:	5d                   	pop    %rbp
+  8017de:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017df:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017e4:	4c 89 ee             	mov    %r13,%rsi
+  8017e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ec:	49 bc 0d 11 80 00 00 	movabs $0x80110d,%r12
+  8017f3:	00 00 00 
+  8017f6:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8017f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017fe:	4c 89 f6             	mov    %r14,%rsi
+  801801:	bf 00 00 00 00       	mov    $0x0,%edi
+  801806:	41 ff d4             	call   *%r12
+    return res;
+  801809:	eb c3                	jmp    8017ce <dup+0xe6>
+
+000000000080180b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80180b:	55                   	push   %rbp
+  80180c:	48 89 e5             	mov    %rsp,%rbp
+  80180f:	41 56                	push   %r14
+  801811:	41 55                	push   %r13
+  801813:	41 54                	push   %r12
+  801815:	53                   	push   %rbx
+  801816:	48 83 ec 10          	sub    $0x10,%rsp
+  80181a:	89 fb                	mov    %edi,%ebx
+  80181c:	49 89 f4             	mov    %rsi,%r12
+  80181f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801822:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801826:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+  801832:	85 c0                	test   %eax,%eax
+  801834:	78 4c                	js     801882 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801836:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80183a:	41 8b 3e             	mov    (%r14),%edi
+  80183d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801841:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  801848:	00 00 00 
+  80184b:	ff d0                	call   *%rax
+  80184d:	85 c0                	test   %eax,%eax
+  80184f:	78 35                	js     801886 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801851:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801855:	83 e0 03             	and    $0x3,%eax
+  801858:	83 f8 01             	cmp    $0x1,%eax
+  80185b:	74 2d                	je     80188a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80185d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801861:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801865:	48 85 c0             	test   %rax,%rax
+  801868:	74 56                	je     8018c0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80186a:	4c 89 ea             	mov    %r13,%rdx
+  80186d:	4c 89 e6             	mov    %r12,%rsi
+  801870:	4c 89 f7             	mov    %r14,%rdi
+  801873:	ff d0                	call   *%rax
+}
+  801875:	48 83 c4 10          	add    $0x10,%rsp
+  801879:	5b                   	pop    %rbx
+  80187a:	41 5c                	pop    %r12
+  80187c:	41 5d                	pop    %r13
+  80187e:	41 5e                	pop    %r14
+  801880:	5d                   	pop    %rbp
+  801881:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801882:	48 98                	cltq
+  801884:	eb ef                	jmp    801875 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801886:	48 98                	cltq
+  801888:	eb eb                	jmp    801875 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80188a:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801891:	00 00 00 
+  801894:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80189a:	89 da                	mov    %ebx,%edx
+  80189c:	48 bf a9 4c 80 00 00 	movabs $0x804ca9,%rdi
+  8018a3:	00 00 00 
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	48 b9 e3 01 80 00 00 	movabs $0x8001e3,%rcx
+  8018b2:	00 00 00 
+  8018b5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018b7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018be:	eb b5                	jmp    801875 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018c0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018c7:	eb ac                	jmp    801875 <read+0x6a>
+
+00000000008018c9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018c9:	55                   	push   %rbp
+  8018ca:	48 89 e5             	mov    %rsp,%rbp
+  8018cd:	41 57                	push   %r15
+  8018cf:	41 56                	push   %r14
+  8018d1:	41 55                	push   %r13
+  8018d3:	41 54                	push   %r12
+  8018d5:	53                   	push   %rbx
+  8018d6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018da:	48 85 d2             	test   %rdx,%rdx
+  8018dd:	74 54                	je     801933 <readn+0x6a>
+  8018df:	41 89 fd             	mov    %edi,%r13d
+  8018e2:	49 89 f6             	mov    %rsi,%r14
+  8018e5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018e8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018ed:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8018f2:	49 bf 0b 18 80 00 00 	movabs $0x80180b,%r15
+  8018f9:	00 00 00 
+  8018fc:	4c 89 e2             	mov    %r12,%rdx
+  8018ff:	48 29 f2             	sub    %rsi,%rdx
+  801902:	4c 01 f6             	add    %r14,%rsi
+  801905:	44 89 ef             	mov    %r13d,%edi
+  801908:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 20                	js     80192f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80190f:	01 c3                	add    %eax,%ebx
+  801911:	85 c0                	test   %eax,%eax
+  801913:	74 08                	je     80191d <readn+0x54>
+  801915:	48 63 f3             	movslq %ebx,%rsi
+  801918:	4c 39 e6             	cmp    %r12,%rsi
+  80191b:	72 df                	jb     8018fc <readn+0x33>
+    }
+    return res;
+  80191d:	48 63 c3             	movslq %ebx,%rax
+}
+  801920:	48 83 c4 08          	add    $0x8,%rsp
+  801924:	5b                   	pop    %rbx
+  801925:	41 5c                	pop    %r12
+  801927:	41 5d                	pop    %r13
+  801929:	41 5e                	pop    %r14
+  80192b:	41 5f                	pop    %r15
+  80192d:	5d                   	pop    %rbp
+  80192e:	c3                   	ret
+        if (inc < 0) return inc;
+  80192f:	48 98                	cltq
+  801931:	eb ed                	jmp    801920 <readn+0x57>
+    int inc = 1, res = 0;
+  801933:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801938:	eb e3                	jmp    80191d <readn+0x54>
+
+000000000080193a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80193a:	55                   	push   %rbp
+  80193b:	48 89 e5             	mov    %rsp,%rbp
+  80193e:	41 56                	push   %r14
+  801940:	41 55                	push   %r13
+  801942:	41 54                	push   %r12
+  801944:	53                   	push   %rbx
+  801945:	48 83 ec 10          	sub    $0x10,%rsp
+  801949:	89 fb                	mov    %edi,%ebx
+  80194b:	49 89 f4             	mov    %rsi,%r12
+  80194e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801951:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801955:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  80195c:	00 00 00 
+  80195f:	ff d0                	call   *%rax
+  801961:	85 c0                	test   %eax,%eax
+  801963:	78 47                	js     8019ac <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801965:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801969:	41 8b 3e             	mov    (%r14),%edi
+  80196c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801970:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 30                	js     8019b0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801980:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801985:	74 2d                	je     8019b4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801987:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80198b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80198f:	48 85 c0             	test   %rax,%rax
+  801992:	74 56                	je     8019ea <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801994:	4c 89 ea             	mov    %r13,%rdx
+  801997:	4c 89 e6             	mov    %r12,%rsi
+  80199a:	4c 89 f7             	mov    %r14,%rdi
+  80199d:	ff d0                	call   *%rax
+}
+  80199f:	48 83 c4 10          	add    $0x10,%rsp
+  8019a3:	5b                   	pop    %rbx
+  8019a4:	41 5c                	pop    %r12
+  8019a6:	41 5d                	pop    %r13
+  8019a8:	41 5e                	pop    %r14
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019ac:	48 98                	cltq
+  8019ae:	eb ef                	jmp    80199f <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019b0:	48 98                	cltq
+  8019b2:	eb eb                	jmp    80199f <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019b4:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8019bb:	00 00 00 
+  8019be:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019c4:	89 da                	mov    %ebx,%edx
+  8019c6:	48 bf c5 4c 80 00 00 	movabs $0x804cc5,%rdi
+  8019cd:	00 00 00 
+  8019d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d5:	48 b9 e3 01 80 00 00 	movabs $0x8001e3,%rcx
+  8019dc:	00 00 00 
+  8019df:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019e1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019e8:	eb b5                	jmp    80199f <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019ea:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019f1:	eb ac                	jmp    80199f <write+0x65>
+
+00000000008019f3 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8019f3:	55                   	push   %rbp
+  8019f4:	48 89 e5             	mov    %rsp,%rbp
+  8019f7:	41 54                	push   %r12
+  8019f9:	53                   	push   %rbx
+  8019fa:	48 83 ec 10          	sub    $0x10,%rsp
+  8019fe:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a00:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a04:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  801a0b:	00 00 00 
+  801a0e:	ff d0                	call   *%rax
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	78 3e                	js     801a52 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a14:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a18:	41 8b 3c 24          	mov    (%r12),%edi
+  801a1c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a20:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+  801a2c:	85 c0                	test   %eax,%eax
+  801a2e:	78 22                	js     801a52 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a30:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a34:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a38:	48 85 c0             	test   %rax,%rax
+  801a3b:	74 0b                	je     801a48 <seek+0x55>
+  801a3d:	89 de                	mov    %ebx,%esi
+  801a3f:	4c 89 e7             	mov    %r12,%rdi
+  801a42:	ff d0                	call   *%rax
+  801a44:	85 c0                	test   %eax,%eax
+  801a46:	78 0a                	js     801a52 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a48:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a4d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a52:	48 83 c4 10          	add    $0x10,%rsp
+  801a56:	5b                   	pop    %rbx
+  801a57:	41 5c                	pop    %r12
+  801a59:	5d                   	pop    %rbp
+  801a5a:	c3                   	ret
+
+0000000000801a5b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a5b:	55                   	push   %rbp
+  801a5c:	48 89 e5             	mov    %rsp,%rbp
+  801a5f:	41 55                	push   %r13
+  801a61:	41 54                	push   %r12
+  801a63:	53                   	push   %rbx
+  801a64:	48 83 ec 18          	sub    $0x18,%rsp
+  801a68:	89 fb                	mov    %edi,%ebx
+  801a6a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a6d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a71:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  801a78:	00 00 00 
+  801a7b:	ff d0                	call   *%rax
+  801a7d:	85 c0                	test   %eax,%eax
+  801a7f:	78 38                	js     801ab9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a81:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a85:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a89:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a8d:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+  801a99:	85 c0                	test   %eax,%eax
+  801a9b:	78 1c                	js     801ab9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a9d:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801aa2:	74 20                	je     801ac4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aa4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801aac:	48 85 c0             	test   %rax,%rax
+  801aaf:	74 47                	je     801af8 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ab1:	44 89 e6             	mov    %r12d,%esi
+  801ab4:	4c 89 ef             	mov    %r13,%rdi
+  801ab7:	ff d0                	call   *%rax
+}
+  801ab9:	48 83 c4 18          	add    $0x18,%rsp
+  801abd:	5b                   	pop    %rbx
+  801abe:	41 5c                	pop    %r12
+  801ac0:	41 5d                	pop    %r13
+  801ac2:	5d                   	pop    %rbp
+  801ac3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ac4:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801acb:	00 00 00 
+  801ace:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ad4:	89 da                	mov    %ebx,%edx
+  801ad6:	48 bf 88 4c 80 00 00 	movabs $0x804c88,%rdi
+  801add:	00 00 00 
+  801ae0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae5:	48 b9 e3 01 80 00 00 	movabs $0x8001e3,%rcx
+  801aec:	00 00 00 
+  801aef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801af1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af6:	eb c1                	jmp    801ab9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801af8:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801afd:	eb ba                	jmp    801ab9 <ftruncate+0x5e>
+
+0000000000801aff <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	41 54                	push   %r12
+  801b05:	53                   	push   %rbx
+  801b06:	48 83 ec 10          	sub    $0x10,%rsp
+  801b0a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b0d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b11:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  801b18:	00 00 00 
+  801b1b:	ff d0                	call   *%rax
+  801b1d:	85 c0                	test   %eax,%eax
+  801b1f:	78 4e                	js     801b6f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b21:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b25:	41 8b 3c 24          	mov    (%r12),%edi
+  801b29:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b2d:	48 b8 73 15 80 00 00 	movabs $0x801573,%rax
+  801b34:	00 00 00 
+  801b37:	ff d0                	call   *%rax
+  801b39:	85 c0                	test   %eax,%eax
+  801b3b:	78 32                	js     801b6f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b3d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b41:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b46:	74 30                	je     801b78 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b48:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b4b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b52:	00 00 00 
+    stat->st_isdir = 0;
+  801b55:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b5c:	00 00 00 
+    stat->st_dev = dev;
+  801b5f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b66:	48 89 de             	mov    %rbx,%rsi
+  801b69:	4c 89 e7             	mov    %r12,%rdi
+  801b6c:	ff 50 28             	call   *0x28(%rax)
+}
+  801b6f:	48 83 c4 10          	add    $0x10,%rsp
+  801b73:	5b                   	pop    %rbx
+  801b74:	41 5c                	pop    %r12
+  801b76:	5d                   	pop    %rbp
+  801b77:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b78:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b7d:	eb f0                	jmp    801b6f <fstat+0x70>
+
+0000000000801b7f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b7f:	55                   	push   %rbp
+  801b80:	48 89 e5             	mov    %rsp,%rbp
+  801b83:	41 54                	push   %r12
+  801b85:	53                   	push   %rbx
+  801b86:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b89:	be 00 00 00 00       	mov    $0x0,%esi
+  801b8e:	48 b8 ed 2c 80 00 00 	movabs $0x802ced,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b9c:	85 c0                	test   %eax,%eax
+  801b9e:	78 25                	js     801bc5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ba0:	4c 89 e6             	mov    %r12,%rsi
+  801ba3:	89 c7                	mov    %eax,%edi
+  801ba5:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  801bac:	00 00 00 
+  801baf:	ff d0                	call   *%rax
+  801bb1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bb4:	89 df                	mov    %ebx,%edi
+  801bb6:	48 b8 8d 16 80 00 00 	movabs $0x80168d,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+
+    return res;
+  801bc2:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bc5:	89 d8                	mov    %ebx,%eax
+  801bc7:	5b                   	pop    %rbx
+  801bc8:	41 5c                	pop    %r12
+  801bca:	5d                   	pop    %rbp
+  801bcb:	c3                   	ret
+
+0000000000801bcc <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bcc:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801bd3:	00 00 00 
+  801bd6:	83 38 00             	cmpl   $0x0,(%rax)
+  801bd9:	74 0a                	je     801be5 <fsenv+0x19>
+    return envid;
+}
+  801bdb:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801be2:	00 00 
+  801be4:	c3                   	ret
+fsenv(void) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801be9:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bee:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  801bf5:	00 00 00 
+  801bf8:	ff d0                	call   *%rax
+  801bfa:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801c01:	00 00 
+}
+  801c03:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801c0a:	00 00 
+  801c0c:	5d                   	pop    %rbp
+  801c0d:	c3                   	ret
+
+0000000000801c0e <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801c0e:	55                   	push   %rbp
+  801c0f:	48 89 e5             	mov    %rsp,%rbp
+  801c12:	41 54                	push   %r12
+  801c14:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c15:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c1a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c1f:	48 89 de             	mov    %rbx,%rsi
+  801c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c27:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c33:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c3a:	00 00 00 
+  801c3d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c43:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c48:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c4d:	48 89 de             	mov    %rbx,%rsi
+  801c50:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c55:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  801c5c:	00 00 00 
+  801c5f:	ff d0                	call   *%rax
+  801c61:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	0f 88 a2 00 00 00    	js     801d0d <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c6b:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801c72:	00 00 00 
+  801c75:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c7b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c80:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c82:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c87:	49 bc 1f 3e 80 00 00 	movabs $0x803e1f,%r12
+  801c8e:	00 00 00 
+  801c91:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801c94:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801c99:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c9c:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+  801ca8:	89 c7                	mov    %eax,%edi
+  801caa:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801cb0:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801cb5:	48 89 da             	mov    %rbx,%rdx
+  801cb8:	be 09 00 00 00       	mov    $0x9,%esi
+  801cbd:	48 b8 07 46 80 00 00 	movabs $0x804607,%rax
+  801cc4:	00 00 00 
+  801cc7:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cc9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cdd:	48 b8 e3 45 80 00 00 	movabs $0x8045e3,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	89 c3                	mov    %eax,%ebx
+  801ceb:	85 c0                	test   %eax,%eax
+  801ced:	78 25                	js     801d14 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801cef:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801cf6:	00 00 00 
+  801cf9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801cff:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801d06:	00 00 
+    return 0;
+  801d08:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801d0d:	89 d8                	mov    %ebx,%eax
+  801d0f:	5b                   	pop    %rbx
+  801d10:	41 5c                	pop    %r12
+  801d12:	5d                   	pop    %rbp
+  801d13:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d14:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d19:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d23:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  801d2a:	00 00 00 
+  801d2d:	ff d0                	call   *%rax
+        return res;
+  801d2f:	eb dc                	jmp    801d0d <fschan_setup+0xff>
+
+0000000000801d31 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d31:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d38:	00 00 00 
+  801d3b:	80 38 00             	cmpb   $0x0,(%rax)
+  801d3e:	74 55                	je     801d95 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d40:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801d47:	00 00 00 
+  801d4a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d50:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d55:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d5c:	00 00 00 
+  801d5f:	3b 0a                	cmp    (%rdx),%ecx
+  801d61:	75 01                	jne    801d64 <fschan+0x33>
+}
+  801d63:	c3                   	ret
+fschan(void) {
+  801d64:	55                   	push   %rbp
+  801d65:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d68:	48 b8 0e 1c 80 00 00 	movabs $0x801c0e,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d76:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d7b:	85 d2                	test   %edx,%edx
+  801d7d:	78 02                	js     801d81 <fschan+0x50>
+}
+  801d7f:	5d                   	pop    %rbp
+  801d80:	c3                   	ret
+        fschan_enabled = 0;
+  801d81:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d88:	00 00 00 
+  801d8b:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d93:	eb ea                	jmp    801d7f <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801d95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9a:	c3                   	ret
+
+0000000000801d9b <fbuf>:
+fbuf(struct Fd *fd) {
+  801d9b:	55                   	push   %rbp
+  801d9c:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801d9f:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801dab:	ba 00 00 00 00       	mov    $0x0,%edx
+  801db0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801db4:	77 12                	ja     801dc8 <fbuf+0x2d>
+  801db6:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801dba:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801dc1:	00 00 00 
+  801dc4:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801dc8:	48 89 d0             	mov    %rdx,%rax
+  801dcb:	5d                   	pop    %rbp
+  801dcc:	c3                   	ret
+
+0000000000801dcd <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801dcd:	55                   	push   %rbp
+  801dce:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801dd1:	48 83 c7 40          	add    $0x40,%rdi
+  801dd5:	48 b8 59 3e 80 00 00 	movabs $0x803e59,%rax
+  801ddc:	00 00 00 
+  801ddf:	ff d0                	call   *%rax
+  801de1:	84 c0                	test   %al,%al
+  801de3:	75 02                	jne    801de7 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801de5:	5d                   	pop    %rbp
+  801de6:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801de7:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801dee:	00 00 00 
+  801df1:	ff d0                	call   *%rax
+  801df3:	89 c7                	mov    %eax,%edi
+  801df5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801dfb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e00:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e05:	be 0a 00 00 00       	mov    $0xa,%esi
+  801e0a:	48 b8 07 46 80 00 00 	movabs $0x804607,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+}
+  801e16:	eb cd                	jmp    801de5 <fschan_publish+0x18>
+
+0000000000801e18 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e18:	55                   	push   %rbp
+  801e19:	48 89 e5             	mov    %rsp,%rbp
+  801e1c:	41 57                	push   %r15
+  801e1e:	41 56                	push   %r14
+  801e20:	41 55                	push   %r13
+  801e22:	41 54                	push   %r12
+  801e24:	53                   	push   %rbx
+  801e25:	48 83 ec 48          	sub    $0x48,%rsp
+  801e29:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e2d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e31:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e34:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e38:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e3b:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e42:	00 00 00 
+  801e45:	8b 02                	mov    (%rdx),%eax
+  801e47:	83 c0 01             	add    $0x1,%eax
+  801e4a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e4f:	0f 44 c1             	cmove  %ecx,%eax
+  801e52:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e54:	4d 85 c0             	test   %r8,%r8
+  801e57:	74 2c                	je     801e85 <fschan_rw+0x6d>
+  801e59:	45 89 ce             	mov    %r9d,%r14d
+  801e5c:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e63:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e67:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e6d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e74:	00 
+  801e75:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e7b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e80:	e9 41 01 00 00       	jmp    801fc6 <fschan_rw+0x1ae>
+  801e85:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e89:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e8d:	e9 9c 01 00 00       	jmp    80202e <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801e92:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801e96:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801e99:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801e9c:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801e9f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801ea3:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801ea7:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801eab:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801eaf:	48 89 da             	mov    %rbx,%rdx
+  801eb2:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801ebe:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801ec2:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+            queued += blk;
+  801ece:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ed1:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ed5:	4d 39 fc             	cmp    %r15,%r12
+  801ed8:	73 6b                	jae    801f45 <fschan_rw+0x12d>
+  801eda:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801ede:	77 65                	ja     801f45 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801ee0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ee4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801ee8:	48 b8 34 3e 80 00 00 	movabs $0x803e34,%rax
+  801eef:	00 00 00 
+  801ef2:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801ef4:	4c 89 fb             	mov    %r15,%rbx
+  801ef7:	4c 29 e3             	sub    %r12,%rbx
+  801efa:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801eff:	48 39 d3             	cmp    %rdx,%rbx
+  801f02:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801f06:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801f0a:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801f0e:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801f12:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f15:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f17:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f1e:	00 00 00 
+  801f21:	8b 09                	mov    (%rcx),%ecx
+  801f23:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f26:	83 fe 03             	cmp    $0x3,%esi
+  801f29:	0f 85 63 ff ff ff    	jne    801e92 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f2f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f33:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f36:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f39:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f3c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f40:	e9 79 ff ff ff       	jmp    801ebe <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f45:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f49:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f50:	48 89 df             	mov    %rbx,%rdi
+  801f53:	48 b8 f7 3e 80 00 00 	movabs $0x803ef7,%rax
+  801f5a:	00 00 00 
+  801f5d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f5f:	48 89 df             	mov    %rbx,%rdi
+  801f62:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f72:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f76:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f7a:	75 25                	jne    801fa1 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f7c:	8b 40 04             	mov    0x4(%rax),%eax
+  801f7f:	85 c0                	test   %eax,%eax
+  801f81:	0f 88 86 00 00 00    	js     80200d <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f87:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f8b:	74 5b                	je     801fe8 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f8d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f91:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801f95:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801f99:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801f9d:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801fa1:	48 89 df             	mov    %rbx,%rdi
+  801fa4:	48 b8 ac 3e 80 00 00 	movabs $0x803eac,%rax
+  801fab:	00 00 00 
+  801fae:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801fb0:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801fb4:	83 f0 01             	xor    $0x1,%eax
+  801fb7:	4d 39 fc             	cmp    %r15,%r12
+  801fba:	0f 92 c2             	setb   %dl
+  801fbd:	84 c2                	test   %al,%dl
+  801fbf:	75 05                	jne    801fc6 <fschan_rw+0x1ae>
+  801fc1:	45 85 ed             	test   %r13d,%r13d
+  801fc4:	74 50                	je     802016 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fc6:	4d 39 fc             	cmp    %r15,%r12
+  801fc9:	0f 92 c1             	setb   %cl
+  801fcc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fd0:	0f 96 c2             	setbe  %dl
+  801fd3:	84 d1                	test   %dl,%cl
+  801fd5:	0f 84 6a ff ff ff    	je     801f45 <fschan_rw+0x12d>
+  801fdb:	84 c0                	test   %al,%al
+  801fdd:	0f 85 fd fe ff ff    	jne    801ee0 <fschan_rw+0xc8>
+  801fe3:	e9 5d ff ff ff       	jmp    801f45 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801fe8:	48 63 d0             	movslq %eax,%rdx
+  801feb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fef:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801ff3:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801ff7:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801ffb:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801fff:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  802006:	00 00 00 
+  802009:	ff d0                	call   *%rax
+  80200b:	eb 80                	jmp    801f8d <fschan_rw+0x175>
+                err = msg->fm_res;
+  80200d:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802010:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802014:	eb 8b                	jmp    801fa1 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802016:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80201b:	0f 85 68 fe ff ff    	jne    801e89 <fschan_rw+0x71>
+  802021:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802024:	85 c0                	test   %eax,%eax
+  802026:	0f 84 5d fe ff ff    	je     801e89 <fschan_rw+0x71>
+  80202c:	48 98                	cltq
+}
+  80202e:	48 83 c4 48          	add    $0x48,%rsp
+  802032:	5b                   	pop    %rbx
+  802033:	41 5c                	pop    %r12
+  802035:	41 5d                	pop    %r13
+  802037:	41 5e                	pop    %r14
+  802039:	41 5f                	pop    %r15
+  80203b:	5d                   	pop    %rbp
+  80203c:	c3                   	ret
+
+000000000080203d <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80203d:	55                   	push   %rbp
+  80203e:	48 89 e5             	mov    %rsp,%rbp
+  802041:	41 56                	push   %r14
+  802043:	41 55                	push   %r13
+  802045:	41 54                	push   %r12
+  802047:	53                   	push   %rbx
+  802048:	48 83 ec 10          	sub    $0x10,%rsp
+  80204c:	49 89 fe             	mov    %rdi,%r14
+  80204f:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802052:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802056:	48 29 f3             	sub    %rsi,%rbx
+  802059:	48 39 d3             	cmp    %rdx,%rbx
+  80205c:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802060:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802067:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802068:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80206d:	49 bd b6 3c 80 00 00 	movabs $0x803cb6,%r13
+  802074:	00 00 00 
+  802077:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80207e:	76 1e                	jbe    80209e <mmap_fault+0x61>
+  802080:	4c 01 e7             	add    %r12,%rdi
+  802083:	41 ff d5             	call   *%r13
+  802086:	84 c0                	test   %al,%al
+  802088:	75 14                	jne    80209e <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80208a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80208e:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802095:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802099:	48 39 df             	cmp    %rbx,%rdi
+  80209c:	72 e2                	jb     802080 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80209e:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8020a5:	00 00 00 
+  8020a8:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8020af:	00 00 00 
+  8020b2:	4c 89 f0             	mov    %r14,%rax
+  8020b5:	48 29 d0             	sub    %rdx,%rax
+  8020b8:	48 c1 f8 03          	sar    $0x3,%rax
+  8020bc:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020c3:	aa aa aa 
+  8020c6:	48 0f af c2          	imul   %rdx,%rax
+  8020ca:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020ce:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020d3:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020d7:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020d9:	44 89 e0             	mov    %r12d,%eax
+  8020dc:	41 03 46 10          	add    0x10(%r14),%eax
+  8020e0:	41 2b 06             	sub    (%r14),%eax
+  8020e3:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020e6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020ea:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020ee:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8020f2:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8020f5:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  8020fc:	00 00 00 
+  8020ff:	ff d0                	call   *%rax
+  802101:	89 c7                	mov    %eax,%edi
+  802103:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802109:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80210e:	48 89 da             	mov    %rbx,%rdx
+  802111:	be 0f 00 00 00       	mov    $0xf,%esi
+  802116:	48 b8 07 46 80 00 00 	movabs $0x804607,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802122:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802127:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80212b:	4c 89 e6             	mov    %r12,%rsi
+  80212e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802133:	48 b8 e3 45 80 00 00 	movabs $0x8045e3,%rax
+  80213a:	00 00 00 
+  80213d:	ff d0                	call   *%rax
+  80213f:	48 98                	cltq
+}
+  802141:	48 83 c4 10          	add    $0x10,%rsp
+  802145:	5b                   	pop    %rbx
+  802146:	41 5c                	pop    %r12
+  802148:	41 5d                	pop    %r13
+  80214a:	41 5e                	pop    %r14
+  80214c:	5d                   	pop    %rbp
+  80214d:	c3                   	ret
+
+000000000080214e <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80214e:	48 8b 37             	mov    (%rdi),%rsi
+  802151:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802158:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80215f:	00 00 00 
+  802162:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802167:	eb 0f                	jmp    802178 <mmap_pgfault+0x2a>
+  802169:	c3                   	ret
+  80216a:	48 83 c1 01          	add    $0x1,%rcx
+  80216e:	48 83 c2 18          	add    $0x18,%rdx
+  802172:	48 83 f9 20          	cmp    $0x20,%rcx
+  802176:	74 6e                	je     8021e6 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802178:	48 8b 02             	mov    (%rdx),%rax
+  80217b:	48 83 e8 01          	sub    $0x1,%rax
+  80217f:	48 39 f0             	cmp    %rsi,%rax
+  802182:	73 e6                	jae    80216a <mmap_pgfault+0x1c>
+  802184:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802188:	73 e0                	jae    80216a <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80218a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80218e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802193:	f6 c2 01             	test   $0x1,%dl
+  802196:	75 d1                	jne    802169 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802198:	f6 c2 02             	test   $0x2,%dl
+  80219b:	74 1a                	je     8021b7 <mmap_pgfault+0x69>
+  80219d:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a6:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8021ad:	00 00 00 
+  8021b0:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021b5:	74 35                	je     8021ec <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021b7:	55                   	push   %rbp
+  8021b8:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021bb:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021bf:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021c6:	00 00 00 
+  8021c9:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021cd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021d2:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  8021d9:	00 00 00 
+  8021dc:	ff d0                	call   *%rax
+  8021de:	48 85 c0             	test   %rax,%rax
+  8021e1:	0f 9f c0             	setg   %al
+}
+  8021e4:	5d                   	pop    %rbp
+  8021e5:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021eb:	c3                   	ret
+}
+  8021ec:	c3                   	ret
+
+00000000008021ed <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021ed:	55                   	push   %rbp
+  8021ee:	48 89 e5             	mov    %rsp,%rbp
+  8021f1:	41 54                	push   %r12
+  8021f3:	53                   	push   %rbx
+  8021f4:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021fe:	00 00 00 
+  802201:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802206:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80220a:	74 15                	je     802221 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80220c:	48 83 c3 01          	add    $0x1,%rbx
+  802210:	48 83 c0 18          	add    $0x18,%rax
+  802214:	48 83 fb 20          	cmp    $0x20,%rbx
+  802218:	75 ec                	jne    802206 <mmap_alloc+0x19>
+    return NULL;
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80221f:	eb 52                	jmp    802273 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802221:	4c 89 e7             	mov    %r12,%rdi
+  802224:	48 b8 57 3c 80 00 00 	movabs $0x803c57,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	41 89 c1             	mov    %eax,%r9d
+  802233:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80223a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80223e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802244:	ba 00 00 00 00       	mov    $0x0,%edx
+  802249:	4c 89 e6             	mov    %r12,%rsi
+  80224c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802251:	48 b8 bd 10 80 00 00 	movabs $0x8010bd,%rax
+  802258:	00 00 00 
+  80225b:	ff d0                	call   *%rax
+  80225d:	85 c0                	test   %eax,%eax
+  80225f:	78 17                	js     802278 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802261:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802265:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80226c:	00 00 00 
+  80226f:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802273:	5b                   	pop    %rbx
+  802274:	41 5c                	pop    %r12
+  802276:	5d                   	pop    %rbp
+  802277:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802278:	b8 00 00 00 00       	mov    $0x0,%eax
+  80227d:	eb f4                	jmp    802273 <mmap_alloc+0x86>
+
+000000000080227f <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80227f:	55                   	push   %rbp
+  802280:	48 89 e5             	mov    %rsp,%rbp
+  802283:	41 56                	push   %r14
+  802285:	41 55                	push   %r13
+  802287:	41 54                	push   %r12
+  802289:	53                   	push   %rbx
+  80228a:	48 83 ec 10          	sub    $0x10,%rsp
+  80228e:	41 89 fc             	mov    %edi,%r12d
+  802291:	49 89 f5             	mov    %rsi,%r13
+  802294:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802297:	48 89 f0             	mov    %rsi,%rax
+  80229a:	48 09 d0             	or     %rdx,%rax
+  80229d:	75 0d                	jne    8022ac <fsipc+0x2d>
+  80229f:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8022a2:	83 f8 04             	cmp    $0x4,%eax
+  8022a5:	76 7d                	jbe    802324 <fsipc+0xa5>
+  8022a7:	83 ff 0d             	cmp    $0xd,%edi
+  8022aa:	74 78                	je     802324 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8022ac:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  8022b3:	00 00 00 
+  8022b6:	ff d0                	call   *%rax
+  8022b8:	89 c7                	mov    %eax,%edi
+  8022ba:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022c1:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022c8:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022cf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022d5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022dc:	00 00 00 
+  8022df:	44 89 e6             	mov    %r12d,%esi
+  8022e2:	48 b8 07 46 80 00 00 	movabs $0x804607,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022ee:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022f5:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022f6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022fb:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022ff:	4c 89 ee             	mov    %r13,%rsi
+  802302:	bf 00 00 00 00       	mov    $0x0,%edi
+  802307:	48 b8 e3 45 80 00 00 	movabs $0x8045e3,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+  802313:	89 c3                	mov    %eax,%ebx
+}
+  802315:	89 d8                	mov    %ebx,%eax
+  802317:	48 83 c4 10          	add    $0x10,%rsp
+  80231b:	5b                   	pop    %rbx
+  80231c:	41 5c                	pop    %r12
+  80231e:	41 5d                	pop    %r13
+  802320:	41 5e                	pop    %r14
+  802322:	5d                   	pop    %rbp
+  802323:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802324:	48 b8 31 1d 80 00 00 	movabs $0x801d31,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	49 89 c6             	mov    %rax,%r14
+  802333:	48 85 c0             	test   %rax,%rax
+  802336:	0f 84 70 ff ff ff    	je     8022ac <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80233c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802340:	48 b8 34 3e 80 00 00 	movabs $0x803e34,%rax
+  802347:	00 00 00 
+  80234a:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80234c:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80234f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802356:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80235a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80235f:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802366:	00 00 00 
+  802369:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  802370:	00 00 00 
+  802373:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802375:	4c 89 f7             	mov    %r14,%rdi
+  802378:	48 b8 cd 1d 80 00 00 	movabs $0x801dcd,%rax
+  80237f:	00 00 00 
+  802382:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802384:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80238b:	4c 89 f7             	mov    %r14,%rdi
+  80238e:	48 b8 f7 3e 80 00 00 	movabs $0x803ef7,%rax
+  802395:	00 00 00 
+  802398:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80239a:	4c 89 f7             	mov    %r14,%rdi
+  80239d:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8023a9:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8023ac:	41 83 fc 05          	cmp    $0x5,%r12d
+  8023b0:	75 04                	jne    8023b6 <fsipc+0x137>
+  8023b2:	85 db                	test   %ebx,%ebx
+  8023b4:	79 14                	jns    8023ca <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023b6:	4c 89 f7             	mov    %r14,%rdi
+  8023b9:	48 b8 ac 3e 80 00 00 	movabs $0x803eac,%rax
+  8023c0:	00 00 00 
+  8023c3:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023c5:	e9 4b ff ff ff       	jmp    802315 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023ca:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023ce:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023d3:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023da:	00 00 00 
+  8023dd:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8023e4:	00 00 00 
+  8023e7:	ff d0                	call   *%rax
+  8023e9:	eb cb                	jmp    8023b6 <fsipc+0x137>
+
+00000000008023eb <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023eb:	55                   	push   %rbp
+  8023ec:	48 89 e5             	mov    %rsp,%rbp
+  8023ef:	41 57                	push   %r15
+  8023f1:	41 56                	push   %r14
+  8023f3:	41 55                	push   %r13
+  8023f5:	41 54                	push   %r12
+  8023f7:	53                   	push   %rbx
+  8023f8:	48 83 ec 18          	sub    $0x18,%rsp
+  8023fc:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802400:	49 89 f6             	mov    %rsi,%r14
+  802403:	49 89 d4             	mov    %rdx,%r12
+  802406:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802409:	48 b8 31 1d 80 00 00 	movabs $0x801d31,%rax
+  802410:	00 00 00 
+  802413:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802415:	48 85 c0             	test   %rax,%rax
+  802418:	0f 85 96 00 00 00    	jne    8024b4 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80241e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802425:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802426:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80242d:	00 00 00 
+    while (n) {
+  802430:	4d 85 e4             	test   %r12,%r12
+  802433:	74 79                	je     8024ae <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802435:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80243a:	49 39 dc             	cmp    %rbx,%r12
+  80243d:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802441:	48 89 da             	mov    %rbx,%rdx
+  802444:	4c 89 f6             	mov    %r14,%rsi
+  802447:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80244e:	00 00 00 
+  802451:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80245d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802461:	8b 40 0c             	mov    0xc(%rax),%eax
+  802464:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802467:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80246a:	44 01 e8             	add    %r13d,%eax
+  80246d:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802471:	41 0f 44 c5          	cmove  %r13d,%eax
+  802475:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802479:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80247d:	48 89 da             	mov    %rbx,%rdx
+  802480:	be 00 00 00 00       	mov    $0x0,%esi
+  802485:	bf 04 00 00 00       	mov    $0x4,%edi
+  80248a:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+        if (res < 0)
+  802496:	85 c0                	test   %eax,%eax
+  802498:	78 4a                	js     8024e4 <devfile_write_direct+0xf9>
+        buf += res;
+  80249a:	48 98                	cltq
+  80249c:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80249f:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8024a3:	49 29 c4             	sub    %rax,%r12
+  8024a6:	75 8d                	jne    802435 <devfile_write_direct+0x4a>
+    return write;
+  8024a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024ac:	eb 27                	jmp    8024d5 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8024ae:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8024b2:	eb f4                	jmp    8024a8 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8024b4:	45 89 e9             	mov    %r13d,%r9d
+  8024b7:	4d 89 e0             	mov    %r12,%r8
+  8024ba:	4c 89 f1             	mov    %r14,%rcx
+  8024bd:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024c2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024c6:	48 89 c7             	mov    %rax,%rdi
+  8024c9:	48 b8 18 1e 80 00 00 	movabs $0x801e18,%rax
+  8024d0:	00 00 00 
+  8024d3:	ff d0                	call   *%rax
+}
+  8024d5:	48 83 c4 18          	add    $0x18,%rsp
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	41 5d                	pop    %r13
+  8024de:	41 5e                	pop    %r14
+  8024e0:	41 5f                	pop    %r15
+  8024e2:	5d                   	pop    %rbp
+  8024e3:	c3                   	ret
+            return res;
+  8024e4:	48 98                	cltq
+  8024e6:	eb ed                	jmp    8024d5 <devfile_write_direct+0xea>
+
+00000000008024e8 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024e8:	55                   	push   %rbp
+  8024e9:	48 89 e5             	mov    %rsp,%rbp
+  8024ec:	41 54                	push   %r12
+  8024ee:	53                   	push   %rbx
+  8024ef:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8024f2:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  8024f9:	00 00 00 
+  8024fc:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8024fe:	48 85 c0             	test   %rax,%rax
+  802501:	74 71                	je     802574 <fbuf_flush+0x8c>
+  802503:	48 89 c3             	mov    %rax,%rbx
+  802506:	b8 00 00 00 00       	mov    $0x0,%eax
+  80250b:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80250f:	75 05                	jne    802516 <fbuf_flush+0x2e>
+}
+  802511:	5b                   	pop    %rbx
+  802512:	41 5c                	pop    %r12
+  802514:	5d                   	pop    %rbp
+  802515:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802516:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802519:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80251d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802524:	00 00 00 
+  802527:	48 89 de             	mov    %rbx,%rsi
+  80252a:	48 29 c6             	sub    %rax,%rsi
+  80252d:	48 c1 fe 03          	sar    $0x3,%rsi
+  802531:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802538:	aa aa aa 
+  80253b:	48 0f af f0          	imul   %rax,%rsi
+  80253f:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802543:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802548:	48 01 c6             	add    %rax,%rsi
+  80254b:	4c 89 e7             	mov    %r12,%rdi
+  80254e:	48 b8 eb 23 80 00 00 	movabs $0x8023eb,%rax
+  802555:	00 00 00 
+  802558:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80255a:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80255e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802565:	00 
+    return res < 0 ? res : 0;
+  802566:	48 85 c0             	test   %rax,%rax
+  802569:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802572:	eb 9d                	jmp    802511 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802574:	b8 00 00 00 00       	mov    $0x0,%eax
+  802579:	eb 96                	jmp    802511 <fbuf_flush+0x29>
+
+000000000080257b <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80257b:	55                   	push   %rbp
+  80257c:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80257f:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+}
+  80258b:	5d                   	pop    %rbp
+  80258c:	c3                   	ret
+
+000000000080258d <devfile_write>:
+    if (!fd || !buf)
+  80258d:	48 85 ff             	test   %rdi,%rdi
+  802590:	0f 84 d3 01 00 00    	je     802769 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802596:	55                   	push   %rbp
+  802597:	48 89 e5             	mov    %rsp,%rbp
+  80259a:	41 57                	push   %r15
+  80259c:	41 56                	push   %r14
+  80259e:	41 55                	push   %r13
+  8025a0:	41 54                	push   %r12
+  8025a2:	53                   	push   %rbx
+  8025a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8025a7:	49 89 fc             	mov    %rdi,%r12
+  8025aa:	49 89 f6             	mov    %rsi,%r14
+  8025ad:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8025b0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025b5:	48 85 f6             	test   %rsi,%rsi
+  8025b8:	0f 84 9c 01 00 00    	je     80275a <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025be:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  8025c5:	00 00 00 
+  8025c8:	ff d0                	call   *%rax
+  8025ca:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025cd:	48 85 c0             	test   %rax,%rax
+  8025d0:	0f 84 a2 00 00 00    	je     802678 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025d6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025db:	4c 89 e7             	mov    %r12,%rdi
+  8025de:	48 b8 2c 10 80 00 00 	movabs $0x80102c,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025ea:	83 f8 02             	cmp    $0x2,%eax
+  8025ed:	0f 8f 85 00 00 00    	jg     802678 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8025f3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025fa:	00 00 00 
+  8025fd:	4d 89 ef             	mov    %r13,%r15
+  802600:	49 29 c7             	sub    %rax,%r15
+  802603:	49 c1 ff 03          	sar    $0x3,%r15
+  802607:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80260e:	aa aa aa 
+  802611:	4c 0f af f8          	imul   %rax,%r15
+  802615:	49 c1 e7 0e          	shl    $0xe,%r15
+  802619:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80261e:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802621:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802626:	0f 84 d7 00 00 00    	je     802703 <devfile_write+0x176>
+  80262c:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802630:	89 c2                	mov    %eax,%edx
+  802632:	41 03 55 0c          	add    0xc(%r13),%edx
+  802636:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80263b:	75 0f                	jne    80264c <devfile_write+0xbf>
+  80263d:	48 01 d8             	add    %rbx,%rax
+  802640:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802646:	0f 86 92 00 00 00    	jbe    8026de <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80264c:	4c 89 e7             	mov    %r12,%rdi
+  80264f:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802656:	00 00 00 
+  802659:	ff d0                	call   *%rax
+  80265b:	85 c0                	test   %eax,%eax
+  80265d:	78 52                	js     8026b1 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80265f:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802666:	77 7f                	ja     8026e7 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802668:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80266d:	0f 85 c2 00 00 00    	jne    802735 <devfile_write+0x1a8>
+  802673:	e9 94 00 00 00       	jmp    80270c <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802678:	4c 89 e7             	mov    %r12,%rdi
+  80267b:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802687:	85 c0                	test   %eax,%eax
+  802689:	79 07                	jns    802692 <devfile_write+0x105>
+  80268b:	48 98                	cltq
+  80268d:	e9 c8 00 00 00       	jmp    80275a <devfile_write+0x1cd>
+  802692:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802697:	48 89 da             	mov    %rbx,%rdx
+  80269a:	4c 89 f6             	mov    %r14,%rsi
+  80269d:	4c 89 e7             	mov    %r12,%rdi
+  8026a0:	48 b8 eb 23 80 00 00 	movabs $0x8023eb,%rax
+  8026a7:	00 00 00 
+  8026aa:	ff d0                	call   *%rax
+  8026ac:	e9 a9 00 00 00       	jmp    80275a <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8026b1:	48 98                	cltq
+  8026b3:	e9 a2 00 00 00       	jmp    80275a <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026b8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026bd:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026c2:	4c 89 fe             	mov    %r15,%rsi
+  8026c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026ca:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  8026d1:	00 00 00 
+  8026d4:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026d6:	85 c0                	test   %eax,%eax
+  8026d8:	79 45                	jns    80271f <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026da:	48 98                	cltq
+  8026dc:	eb 7c                	jmp    80275a <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026de:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026e5:	76 4e                	jbe    802735 <devfile_write+0x1a8>
+  8026e7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026ec:	48 89 da             	mov    %rbx,%rdx
+  8026ef:	4c 89 f6             	mov    %r14,%rsi
+  8026f2:	4c 89 e7             	mov    %r12,%rdi
+  8026f5:	48 b8 eb 23 80 00 00 	movabs $0x8023eb,%rax
+  8026fc:	00 00 00 
+  8026ff:	ff d0                	call   *%rax
+  802701:	eb 57                	jmp    80275a <devfile_write+0x1cd>
+  802703:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80270a:	77 db                	ja     8026e7 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80270c:	4c 89 ff             	mov    %r15,%rdi
+  80270f:	48 b8 b6 3c 80 00 00 	movabs $0x803cb6,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+  80271b:	84 c0                	test   %al,%al
+  80271d:	74 99                	je     8026b8 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80271f:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802724:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802729:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80272d:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802734:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802735:	4c 89 ff             	mov    %r15,%rdi
+  802738:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80273c:	48 89 da             	mov    %rbx,%rdx
+  80273f:	4c 89 f6             	mov    %r14,%rsi
+  802742:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  802749:	00 00 00 
+  80274c:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80274e:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802752:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802757:	48 89 d8             	mov    %rbx,%rax
+}
+  80275a:	48 83 c4 08          	add    $0x8,%rsp
+  80275e:	5b                   	pop    %rbx
+  80275f:	41 5c                	pop    %r12
+  802761:	41 5d                	pop    %r13
+  802763:	41 5e                	pop    %r14
+  802765:	41 5f                	pop    %r15
+  802767:	5d                   	pop    %rbp
+  802768:	c3                   	ret
+        return E_INVAL;
+  802769:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80276e:	c3                   	ret
+
+000000000080276f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80276f:	55                   	push   %rbp
+  802770:	48 89 e5             	mov    %rsp,%rbp
+  802773:	41 54                	push   %r12
+  802775:	53                   	push   %rbx
+  802776:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802779:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802780:	00 00 00 
+  802783:	ff d0                	call   *%rax
+  802785:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802788:	48 89 df             	mov    %rbx,%rdi
+  80278b:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+  802797:	48 85 c0             	test   %rax,%rax
+  80279a:	74 17                	je     8027b3 <devfile_flush+0x44>
+  80279c:	48 89 df             	mov    %rbx,%rdi
+  80279f:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  8027a6:	00 00 00 
+  8027a9:	ff d0                	call   *%rax
+  8027ab:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8027b2:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027b3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027b6:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027bd:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027c9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027ce:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8027d5:	00 00 00 
+  8027d8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027da:	45 85 e4             	test   %r12d,%r12d
+  8027dd:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027e1:	5b                   	pop    %rbx
+  8027e2:	41 5c                	pop    %r12
+  8027e4:	5d                   	pop    %rbp
+  8027e5:	c3                   	ret
+
+00000000008027e6 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027e6:	55                   	push   %rbp
+  8027e7:	48 89 e5             	mov    %rsp,%rbp
+  8027ea:	41 57                	push   %r15
+  8027ec:	41 56                	push   %r14
+  8027ee:	41 55                	push   %r13
+  8027f0:	41 54                	push   %r12
+  8027f2:	53                   	push   %rbx
+  8027f3:	48 83 ec 38          	sub    $0x38,%rsp
+  8027f7:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027fb:	49 89 f7             	mov    %rsi,%r15
+  8027fe:	48 89 d3             	mov    %rdx,%rbx
+  802801:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802804:	48 b8 31 1d 80 00 00 	movabs $0x801d31,%rax
+  80280b:	00 00 00 
+  80280e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802810:	48 85 c0             	test   %rax,%rax
+  802813:	75 20                	jne    802835 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802815:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  80281a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802821:	00 
+    while (n) {
+  802822:	48 85 db             	test   %rbx,%rbx
+  802825:	0f 85 df 00 00 00    	jne    80290a <devfile_read_direct+0x124>
+    size_t read = 0;
+  80282b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80282f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802833:	eb 21                	jmp    802856 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802835:	45 89 f1             	mov    %r14d,%r9d
+  802838:	49 89 d8             	mov    %rbx,%r8
+  80283b:	4c 89 f9             	mov    %r15,%rcx
+  80283e:	ba 03 00 00 00       	mov    $0x3,%edx
+  802843:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802847:	48 89 c7             	mov    %rax,%rdi
+  80284a:	48 b8 18 1e 80 00 00 	movabs $0x801e18,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+}
+  802856:	48 83 c4 38          	add    $0x38,%rsp
+  80285a:	5b                   	pop    %rbx
+  80285b:	41 5c                	pop    %r12
+  80285d:	41 5d                	pop    %r13
+  80285f:	41 5e                	pop    %r14
+  802861:	41 5f                	pop    %r15
+  802863:	5d                   	pop    %rbp
+  802864:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802865:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802869:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80286f:	75 1e                	jne    80288f <devfile_read_direct+0xa9>
+  802871:	e9 e2 00 00 00       	jmp    802958 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802876:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80287a:	eb da                	jmp    802856 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  80287c:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802880:	0f 85 d0 01 00 00    	jne    802a56 <devfile_read_direct+0x270>
+            map = 0;
+  802886:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80288a:	eb 03                	jmp    80288f <devfile_read_direct+0xa9>
+  80288c:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80288f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802894:	48 39 d3             	cmp    %rdx,%rbx
+  802897:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80289b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80289f:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028a2:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  8028a9:	00 00 00 
+  8028ac:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8028ae:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8028b2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028bb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028c0:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028cc:	85 c0                	test   %eax,%eax
+  8028ce:	0f 8e 63 01 00 00    	jle    802a37 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028d4:	4c 63 e0             	movslq %eax,%r12
+  8028d7:	4c 89 e2             	mov    %r12,%rdx
+  8028da:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028e1:	00 00 00 
+  8028e4:	4c 89 ff             	mov    %r15,%rdi
+  8028e7:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  8028ee:	00 00 00 
+  8028f1:	ff d0                	call   *%rax
+        buf += res;
+  8028f3:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8028f6:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8028f9:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8028fd:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802901:	48 85 db             	test   %rbx,%rbx
+  802904:	0f 84 25 ff ff ff    	je     80282f <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80290a:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80290d:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802911:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802915:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802919:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802920:	0f 97 c2             	seta   %dl
+  802923:	20 c2                	and    %al,%dl
+  802925:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802928:	0f 84 5e ff ff ff    	je     80288c <devfile_read_direct+0xa6>
+  80292e:	4c 89 fa             	mov    %r15,%rdx
+  802931:	4d 89 fd             	mov    %r15,%r13
+  802934:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80293b:	0f 85 4e ff ff ff    	jne    80288f <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802941:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802945:	0f 84 1a ff ff ff    	je     802865 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80294b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802952:	0f 85 37 ff ff ff    	jne    80288f <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802958:	48 89 d8             	mov    %rbx,%rax
+  80295b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802961:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802966:	48 39 c8             	cmp    %rcx,%rax
+  802969:	48 0f 47 c1          	cmova  %rcx,%rax
+  80296d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802971:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802975:	49 89 d4             	mov    %rdx,%r12
+  802978:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80297c:	48 b8 57 3c 80 00 00 	movabs $0x803c57,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	a8 40                	test   $0x40,%al
+  80298a:	0f 85 b9 00 00 00    	jne    802a49 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802990:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802997:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80299b:	49 39 c5             	cmp    %rax,%r13
+  80299e:	72 d8                	jb     802978 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029a0:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8029a4:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029ab:	00 00 00 
+  8029ae:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029b2:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029b5:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029b7:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029bb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029bf:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+  8029cb:	89 c7                	mov    %eax,%edi
+  8029cd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029d3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029d8:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029df:	00 00 00 
+  8029e2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029e7:	48 b8 07 46 80 00 00 	movabs $0x804607,%rax
+  8029ee:	00 00 00 
+  8029f1:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8029f3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029f8:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029fc:	4c 89 fe             	mov    %r15,%rsi
+  8029ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a04:	48 b8 e3 45 80 00 00 	movabs $0x8045e3,%rax
+  802a0b:	00 00 00 
+  802a0e:	ff d0                	call   *%rax
+  802a10:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a13:	48 85 d2             	test   %rdx,%rdx
+  802a16:	0f 84 5a fe ff ff    	je     802876 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a1c:	0f 8e 5a fe ff ff    	jle    80287c <devfile_read_direct+0x96>
+                buf += res;
+  802a22:	48 98                	cltq
+  802a24:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a27:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a2a:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a2e:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a32:	e9 ca fe ff ff       	jmp    802901 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a37:	41 89 c5             	mov    %eax,%r13d
+  802a3a:	48 98                	cltq
+  802a3c:	45 85 ed             	test   %r13d,%r13d
+  802a3f:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a44:	e9 0d fe ff ff       	jmp    802856 <devfile_read_direct+0x70>
+            map = 0;
+  802a49:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a4d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a51:	e9 39 fe ff ff       	jmp    80288f <devfile_read_direct+0xa9>
+  802a56:	48 89 d0             	mov    %rdx,%rax
+  802a59:	e9 f8 fd ff ff       	jmp    802856 <devfile_read_direct+0x70>
+
+0000000000802a5e <devfile_read>:
+    if (!fd || !buf)
+  802a5e:	48 85 ff             	test   %rdi,%rdi
+  802a61:	0f 84 21 02 00 00    	je     802c88 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a67:	55                   	push   %rbp
+  802a68:	48 89 e5             	mov    %rsp,%rbp
+  802a6b:	41 57                	push   %r15
+  802a6d:	41 56                	push   %r14
+  802a6f:	41 55                	push   %r13
+  802a71:	41 54                	push   %r12
+  802a73:	53                   	push   %rbx
+  802a74:	48 83 ec 28          	sub    $0x28,%rsp
+  802a78:	48 89 fb             	mov    %rdi,%rbx
+  802a7b:	49 89 f4             	mov    %rsi,%r12
+  802a7e:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a81:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a86:	48 85 f6             	test   %rsi,%rsi
+  802a89:	74 4b                	je     802ad6 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a8b:	48 b8 9b 1d 80 00 00 	movabs $0x801d9b,%rax
+  802a92:	00 00 00 
+  802a95:	ff d0                	call   *%rax
+  802a97:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802a9a:	48 85 c0             	test   %rax,%rax
+  802a9d:	74 22                	je     802ac1 <devfile_read+0x63>
+  802a9f:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802aa6:	77 19                	ja     802ac1 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802aa8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802aad:	48 89 df             	mov    %rbx,%rdi
+  802ab0:	48 b8 2c 10 80 00 00 	movabs $0x80102c,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802abc:	83 f8 02             	cmp    $0x2,%eax
+  802abf:	7e 40                	jle    802b01 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ac1:	48 89 df             	mov    %rbx,%rdi
+  802ac4:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802acb:	00 00 00 
+  802ace:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ad0:	85 c0                	test   %eax,%eax
+  802ad2:	79 11                	jns    802ae5 <devfile_read+0x87>
+  802ad4:	48 98                	cltq
+}
+  802ad6:	48 83 c4 28          	add    $0x28,%rsp
+  802ada:	5b                   	pop    %rbx
+  802adb:	41 5c                	pop    %r12
+  802add:	41 5d                	pop    %r13
+  802adf:	41 5e                	pop    %r14
+  802ae1:	41 5f                	pop    %r15
+  802ae3:	5d                   	pop    %rbp
+  802ae4:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ae5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802aea:	4c 89 ea             	mov    %r13,%rdx
+  802aed:	4c 89 e6             	mov    %r12,%rsi
+  802af0:	48 89 df             	mov    %rbx,%rdi
+  802af3:	48 b8 e6 27 80 00 00 	movabs $0x8027e6,%rax
+  802afa:	00 00 00 
+  802afd:	ff d0                	call   *%rax
+  802aff:	eb d5                	jmp    802ad6 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802b01:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802b05:	48 89 df             	mov    %rbx,%rdi
+  802b08:	48 b8 e8 24 80 00 00 	movabs $0x8024e8,%rax
+  802b0f:	00 00 00 
+  802b12:	ff d0                	call   *%rax
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	0f 88 33 01 00 00    	js     802c4f <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b1c:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b23:	00 00 00 
+  802b26:	4c 89 f0             	mov    %r14,%rax
+  802b29:	48 29 d0             	sub    %rdx,%rax
+  802b2c:	48 c1 f8 03          	sar    $0x3,%rax
+  802b30:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b37:	aa aa aa 
+  802b3a:	48 0f af c2          	imul   %rdx,%rax
+  802b3e:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b42:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b46:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b49:	41 39 06             	cmp    %eax,(%r14)
+  802b4c:	75 0d                	jne    802b5b <devfile_read+0xfd>
+  802b4e:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b51:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b55:	0f 84 fb 00 00 00    	je     802c56 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b5b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b60:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b64:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b6b:	48 89 c7             	mov    %rax,%rdi
+  802b6e:	48 b8 b6 3c 80 00 00 	movabs $0x803cb6,%rax
+  802b75:	00 00 00 
+  802b78:	ff d0                	call   *%rax
+  802b7a:	84 c0                	test   %al,%al
+  802b7c:	75 27                	jne    802ba5 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b7e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b83:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b88:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b91:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  802b98:	00 00 00 
+  802b9b:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802b9d:	85 c0                	test   %eax,%eax
+  802b9f:	0f 88 dc 00 00 00    	js     802c81 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ba5:	44 89 f8             	mov    %r15d,%eax
+  802ba8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802bad:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802baf:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802bb6:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802bb7:	8b 43 10             	mov    0x10(%rbx),%eax
+  802bba:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802bbe:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bc1:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bc6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bca:	48 89 df             	mov    %rbx,%rdi
+  802bcd:	48 b8 e6 27 80 00 00 	movabs $0x8027e6,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802bd9:	48 85 c0             	test   %rax,%rax
+  802bdc:	0f 88 f4 fe ff ff    	js     802ad6 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802be2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802be5:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802be8:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802beb:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802bef:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802bf3:	48 63 d1             	movslq %ecx,%rdx
+  802bf6:	48 01 d0             	add    %rdx,%rax
+  802bf9:	4d 63 ff             	movslq %r15d,%r15
+  802bfc:	4c 29 f8             	sub    %r15,%rax
+  802bff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c04:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802c08:	48 85 c0             	test   %rax,%rax
+  802c0b:	0f 8e c5 fe ff ff    	jle    802ad6 <devfile_read+0x78>
+    n = MIN(n, res);
+  802c11:	4c 39 e8             	cmp    %r13,%rax
+  802c14:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c18:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c1b:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c1f:	48 63 f6             	movslq %esi,%rsi
+  802c22:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c27:	48 01 c6             	add    %rax,%rsi
+  802c2a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c2e:	48 01 c6             	add    %rax,%rsi
+  802c31:	4c 89 ea             	mov    %r13,%rdx
+  802c34:	4c 89 e7             	mov    %r12,%rdi
+  802c37:	48 b8 69 0d 80 00 00 	movabs $0x800d69,%rax
+  802c3e:	00 00 00 
+  802c41:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c43:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c47:	4c 89 e8             	mov    %r13,%rax
+  802c4a:	e9 87 fe ff ff       	jmp    802ad6 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c4f:	48 98                	cltq
+  802c51:	e9 80 fe ff ff       	jmp    802ad6 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c56:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c5a:	41 39 d7             	cmp    %edx,%r15d
+  802c5d:	0f 8c f8 fe ff ff    	jl     802b5b <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c63:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c67:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c6a:	41 39 cf             	cmp    %ecx,%r15d
+  802c6d:	0f 8d e8 fe ff ff    	jge    802b5b <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c73:	4d 63 ff             	movslq %r15d,%r15
+  802c76:	4c 29 f8             	sub    %r15,%rax
+  802c79:	48 63 d2             	movslq %edx,%rdx
+  802c7c:	48 01 d0             	add    %rdx,%rax
+  802c7f:	eb 87                	jmp    802c08 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c81:	48 98                	cltq
+  802c83:	e9 4e fe ff ff       	jmp    802ad6 <devfile_read+0x78>
+        return E_INVAL;
+  802c88:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c8d:	c3                   	ret
+
+0000000000802c8e <fs_channel>:
+fs_channel(bool enable) {
+  802c8e:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802c90:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802c97:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9e:	40 84 ff             	test   %dil,%dil
+  802ca1:	74 47                	je     802cea <fs_channel+0x5c>
+  802ca3:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  802caa:	00 00 00 
+  802cad:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802cb3:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802cba:	00 00 00 
+  802cbd:	3b 08                	cmp    (%rax),%ecx
+  802cbf:	74 29                	je     802cea <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cc1:	55                   	push   %rbp
+  802cc2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cc5:	48 b8 0e 1c 80 00 00 	movabs $0x801c0e,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+  802cd1:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802cd3:	85 c0                	test   %eax,%eax
+  802cd5:	78 04                	js     802cdb <fs_channel+0x4d>
+}
+  802cd7:	89 d0                	mov    %edx,%eax
+  802cd9:	5d                   	pop    %rbp
+  802cda:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802cdb:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802ce2:	00 00 00 
+  802ce5:	c6 00 00             	movb   $0x0,(%rax)
+  802ce8:	eb ed                	jmp    802cd7 <fs_channel+0x49>
+}
+  802cea:	89 d0                	mov    %edx,%eax
+  802cec:	c3                   	ret
+
+0000000000802ced <open>:
+open(const char *path, int mode) {
+  802ced:	55                   	push   %rbp
+  802cee:	48 89 e5             	mov    %rsp,%rbp
+  802cf1:	41 55                	push   %r13
+  802cf3:	41 54                	push   %r12
+  802cf5:	53                   	push   %rbx
+  802cf6:	48 83 ec 18          	sub    $0x18,%rsp
+  802cfa:	49 89 fc             	mov    %rdi,%r12
+  802cfd:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d00:	48 b8 ca 0a 80 00 00 	movabs $0x800aca,%rax
+  802d07:	00 00 00 
+  802d0a:	ff d0                	call   *%rax
+  802d0c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d12:	0f 87 8f 00 00 00    	ja     802da7 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d18:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d1c:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  802d23:	00 00 00 
+  802d26:	ff d0                	call   *%rax
+  802d28:	89 c3                	mov    %eax,%ebx
+  802d2a:	85 c0                	test   %eax,%eax
+  802d2c:	78 55                	js     802d83 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d2e:	4c 89 e6             	mov    %r12,%rsi
+  802d31:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d38:	00 00 00 
+  802d3b:	48 89 df             	mov    %rbx,%rdi
+  802d3e:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  802d45:	00 00 00 
+  802d48:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d4a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d51:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d56:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d5a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d5f:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	89 c3                	mov    %eax,%ebx
+  802d6d:	85 c0                	test   %eax,%eax
+  802d6f:	78 1f                	js     802d90 <open+0xa3>
+    return fd2num(fd);
+  802d71:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d75:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  802d7c:	00 00 00 
+  802d7f:	ff d0                	call   *%rax
+  802d81:	89 c3                	mov    %eax,%ebx
+}
+  802d83:	89 d8                	mov    %ebx,%eax
+  802d85:	48 83 c4 18          	add    $0x18,%rsp
+  802d89:	5b                   	pop    %rbx
+  802d8a:	41 5c                	pop    %r12
+  802d8c:	41 5d                	pop    %r13
+  802d8e:	5d                   	pop    %rbp
+  802d8f:	c3                   	ret
+        fd_close(fd, 0);
+  802d90:	be 00 00 00 00       	mov    $0x0,%esi
+  802d95:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d99:	48 b8 e3 15 80 00 00 	movabs $0x8015e3,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+        return res;
+  802da5:	eb dc                	jmp    802d83 <open+0x96>
+        return -E_BAD_PATH;
+  802da7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802dac:	eb d5                	jmp    802d83 <open+0x96>
+
+0000000000802dae <file_flush_buffers>:
+file_flush_buffers(void) {
+  802dae:	55                   	push   %rbp
+  802daf:	48 89 e5             	mov    %rsp,%rbp
+  802db2:	41 56                	push   %r14
+  802db4:	41 55                	push   %r13
+  802db6:	41 54                	push   %r12
+  802db8:	53                   	push   %rbx
+  802db9:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802dbd:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802dc4:	00 00 00 
+  802dc7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dcc:	49 bd 28 15 80 00 00 	movabs $0x801528,%r13
+  802dd3:	00 00 00 
+  802dd6:	49 be e8 24 80 00 00 	movabs $0x8024e8,%r14
+  802ddd:	00 00 00 
+  802de0:	eb 0c                	jmp    802dee <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802de2:	83 c3 01             	add    $0x1,%ebx
+  802de5:	49 83 c4 18          	add    $0x18,%r12
+  802de9:	83 fb 20             	cmp    $0x20,%ebx
+  802dec:	74 1d                	je     802e0b <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dee:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802df3:	74 ed                	je     802de2 <file_flush_buffers+0x34>
+  802df5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802df9:	89 df                	mov    %ebx,%edi
+  802dfb:	41 ff d5             	call   *%r13
+  802dfe:	85 c0                	test   %eax,%eax
+  802e00:	78 e0                	js     802de2 <file_flush_buffers+0x34>
+  802e02:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e06:	41 ff d6             	call   *%r14
+  802e09:	eb d7                	jmp    802de2 <file_flush_buffers+0x34>
+}
+  802e0b:	48 83 c4 10          	add    $0x10,%rsp
+  802e0f:	5b                   	pop    %rbx
+  802e10:	41 5c                	pop    %r12
+  802e12:	41 5d                	pop    %r13
+  802e14:	41 5e                	pop    %r14
+  802e16:	5d                   	pop    %rbp
+  802e17:	c3                   	ret
+
+0000000000802e18 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e18:	55                   	push   %rbp
+  802e19:	48 89 e5             	mov    %rsp,%rbp
+  802e1c:	41 54                	push   %r12
+  802e1e:	53                   	push   %rbx
+  802e1f:	49 89 fc             	mov    %rdi,%r12
+  802e22:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e24:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802e2b:	00 00 00 
+  802e2e:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e30:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e37:	00 00 00 
+  802e3a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e3f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e41:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e44:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e49:	be 00 00 00 00       	mov    $0x0,%esi
+  802e4e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e53:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802e5a:	00 00 00 
+  802e5d:	ff d0                	call   *%rax
+}
+  802e5f:	5b                   	pop    %rbx
+  802e60:	41 5c                	pop    %r12
+  802e62:	5d                   	pop    %rbp
+  802e63:	c3                   	ret
+
+0000000000802e64 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e64:	55                   	push   %rbp
+  802e65:	48 89 e5             	mov    %rsp,%rbp
+  802e68:	41 54                	push   %r12
+  802e6a:	53                   	push   %rbx
+  802e6b:	49 89 fc             	mov    %rdi,%r12
+  802e6e:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e71:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802e78:	00 00 00 
+  802e7b:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e7d:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e82:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e89:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e90:	be 00 00 00 00       	mov    $0x0,%esi
+  802e95:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e9a:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802ea1:	00 00 00 
+  802ea4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ea6:	85 c0                	test   %eax,%eax
+  802ea8:	78 3d                	js     802ee7 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802eaa:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802eb1:	00 00 00 
+  802eb4:	4c 89 e6             	mov    %r12,%rsi
+  802eb7:	48 89 df             	mov    %rbx,%rdi
+  802eba:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  802ec1:	00 00 00 
+  802ec4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ec6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ecd:	00 
+  802ece:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ed4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802edb:	00 
+  802edc:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ee7:	5b                   	pop    %rbx
+  802ee8:	41 5c                	pop    %r12
+  802eea:	5d                   	pop    %rbp
+  802eeb:	c3                   	ret
+
+0000000000802eec <remove>:
+remove(const char *path) {
+  802eec:	55                   	push   %rbp
+  802eed:	48 89 e5             	mov    %rsp,%rbp
+  802ef0:	53                   	push   %rbx
+  802ef1:	48 83 ec 08          	sub    $0x8,%rsp
+  802ef5:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802ef8:	48 b8 ca 0a 80 00 00 	movabs $0x800aca,%rax
+  802eff:	00 00 00 
+  802f02:	ff d0                	call   *%rax
+  802f04:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f0a:	77 3a                	ja     802f46 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802f0c:	48 89 de             	mov    %rbx,%rsi
+  802f0f:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f16:	00 00 00 
+  802f19:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  802f20:	00 00 00 
+  802f23:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f2f:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f34:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802f3b:	00 00 00 
+  802f3e:	ff d0                	call   *%rax
+}
+  802f40:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f44:	c9                   	leave
+  802f45:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f46:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f4b:	eb f3                	jmp    802f40 <remove+0x54>
+
+0000000000802f4d <sync>:
+sync(void) {
+  802f4d:	55                   	push   %rbp
+  802f4e:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f51:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802f58:	00 00 00 
+  802f5b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f62:	be 00 00 00 00       	mov    $0x0,%esi
+  802f67:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f6c:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+}
+  802f78:	5d                   	pop    %rbp
+  802f79:	c3                   	ret
+
+0000000000802f7a <fsync>:
+fsync(int fdnum) {
+  802f7a:	55                   	push   %rbp
+  802f7b:	48 89 e5             	mov    %rsp,%rbp
+  802f7e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f82:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f86:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f92:	85 c0                	test   %eax,%eax
+  802f94:	78 4b                	js     802fe1 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f96:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f9a:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802fa1:	00 00 00 
+  802fa4:	8b 00                	mov    (%rax),%eax
+  802fa6:	39 02                	cmp    %eax,(%rdx)
+  802fa8:	75 39                	jne    802fe3 <fsync+0x69>
+    file_flush_buffers();
+  802faa:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  802fb1:	00 00 00 
+  802fb4:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fb6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fba:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fbd:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802fc4:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fc6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fcb:	be 00 00 00 00       	mov    $0x0,%esi
+  802fd0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fd5:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  802fdc:	00 00 00 
+  802fdf:	ff d0                	call   *%rax
+}
+  802fe1:	c9                   	leave
+  802fe2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fe3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fe8:	eb f7                	jmp    802fe1 <fsync+0x67>
+
+0000000000802fea <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802fea:	55                   	push   %rbp
+  802feb:	48 89 e5             	mov    %rsp,%rbp
+  802fee:	53                   	push   %rbx
+  802fef:	48 83 ec 08          	sub    $0x8,%rsp
+  802ff3:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ffb:	be 00 00 00 00       	mov    $0x0,%esi
+  803000:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803005:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80300c:	00 00 00 
+  80300f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803011:	85 c0                	test   %eax,%eax
+  803013:	78 2d                	js     803042 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803015:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80301c:	00 00 00 
+  80301f:	48 8b 10             	mov    (%rax),%rdx
+  803022:	48 89 13             	mov    %rdx,(%rbx)
+  803025:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803029:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80302d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803031:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803035:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803039:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80303d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803042:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803046:	c9                   	leave
+  803047:	c3                   	ret
+
+0000000000803048 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803048:	55                   	push   %rbp
+  803049:	48 89 e5             	mov    %rsp,%rbp
+  80304c:	53                   	push   %rbx
+  80304d:	48 83 ec 08          	sub    $0x8,%rsp
+  803051:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803054:	ba 00 00 00 00       	mov    $0x0,%edx
+  803059:	be 00 00 00 00       	mov    $0x0,%esi
+  80305e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803063:	48 b8 7f 22 80 00 00 	movabs $0x80227f,%rax
+  80306a:	00 00 00 
+  80306d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	78 3d                	js     8030b0 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803073:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80307a:	00 00 00 
+  80307d:	48 8b 10             	mov    (%rax),%rdx
+  803080:	48 89 13             	mov    %rdx,(%rbx)
+  803083:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803087:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80308b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80308f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803093:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803097:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80309b:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80309f:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8030a3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8030a7:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8030ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030b4:	c9                   	leave
+  8030b5:	c3                   	ret
+
+00000000008030b6 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030b6:	55                   	push   %rbp
+  8030b7:	48 89 e5             	mov    %rsp,%rbp
+  8030ba:	41 57                	push   %r15
+  8030bc:	41 56                	push   %r14
+  8030be:	41 55                	push   %r13
+  8030c0:	41 54                	push   %r12
+  8030c2:	53                   	push   %rbx
+  8030c3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030c7:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030ce:	00 
+  8030cf:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030d6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030dc:	0f 85 43 01 00 00    	jne    803225 <munmap+0x16f>
+  8030e2:	49 89 ff             	mov    %rdi,%r15
+  8030e5:	4c 39 f7             	cmp    %r14,%rdi
+  8030e8:	0f 87 37 01 00 00    	ja     803225 <munmap+0x16f>
+  8030ee:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8030f5:	00 00 00 
+  8030f8:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8030fe:	eb 2c                	jmp    80312c <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803100:	4c 39 f8             	cmp    %r15,%rax
+  803103:	0f 83 85 00 00 00    	jae    80318e <munmap+0xd8>
+            m->mm_end = start;
+  803109:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80310e:	48 83 c3 18          	add    $0x18,%rbx
+  803112:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803119:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803120:	00 00 00 
+  803123:	48 39 c3             	cmp    %rax,%rbx
+  803126:	0f 84 d0 00 00 00    	je     8031fc <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80312c:	49 89 dc             	mov    %rbx,%r12
+  80312f:	48 8b 03             	mov    (%rbx),%rax
+  803132:	4c 39 f0             	cmp    %r14,%rax
+  803135:	73 d7                	jae    80310e <munmap+0x58>
+  803137:	48 85 c0             	test   %rax,%rax
+  80313a:	74 d2                	je     80310e <munmap+0x58>
+  80313c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803140:	49 39 d7             	cmp    %rdx,%r15
+  803143:	73 c9                	jae    80310e <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803145:	49 39 d6             	cmp    %rdx,%r14
+  803148:	73 b6                	jae    803100 <munmap+0x4a>
+  80314a:	49 39 c7             	cmp    %rax,%r15
+  80314d:	76 b1                	jbe    803100 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80314f:	4c 89 ef             	mov    %r13,%rdi
+  803152:	48 b8 ed 21 80 00 00 	movabs $0x8021ed,%rax
+  803159:	00 00 00 
+  80315c:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80315e:	48 85 c0             	test   %rax,%rax
+  803161:	0f 84 c5 00 00 00    	je     80322c <munmap+0x176>
+            *tail = *m;
+  803167:	48 8b 13             	mov    (%rbx),%rdx
+  80316a:	48 89 10             	mov    %rdx,(%rax)
+  80316d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803171:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803175:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803179:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80317d:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803180:	44 89 f2             	mov    %r14d,%edx
+  803183:	2b 13                	sub    (%rbx),%edx
+  803185:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803188:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80318c:	eb 80                	jmp    80310e <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80318e:	49 39 d6             	cmp    %rdx,%r14
+  803191:	73 18                	jae    8031ab <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803193:	44 89 f2             	mov    %r14d,%edx
+  803196:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80319b:	29 c2                	sub    %eax,%edx
+  80319d:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8031a2:	4d 89 34 24          	mov    %r14,(%r12)
+  8031a6:	e9 63 ff ff ff       	jmp    80310e <munmap+0x58>
+    m->mm_start = 0;
+  8031ab:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8031b2:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8031b3:	4c 89 e6             	mov    %r12,%rsi
+  8031b6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031bd:	00 00 00 
+  8031c0:	48 29 c6             	sub    %rax,%rsi
+  8031c3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031c7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031ce:	aa aa aa 
+  8031d1:	48 0f af f0          	imul   %rax,%rsi
+  8031d5:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031d9:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031de:	48 01 c6             	add    %rax,%rsi
+  8031e1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031eb:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  8031f2:	00 00 00 
+  8031f5:	ff d0                	call   *%rax
+}
+  8031f7:	e9 12 ff ff ff       	jmp    80310e <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8031fc:	4c 89 f2             	mov    %r14,%rdx
+  8031ff:	4c 29 fa             	sub    %r15,%rdx
+  803202:	4c 89 fe             	mov    %r15,%rsi
+  803205:	bf 00 00 00 00       	mov    $0x0,%edi
+  80320a:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803211:	00 00 00 
+  803214:	ff d0                	call   *%rax
+}
+  803216:	48 83 c4 08          	add    $0x8,%rsp
+  80321a:	5b                   	pop    %rbx
+  80321b:	41 5c                	pop    %r12
+  80321d:	41 5d                	pop    %r13
+  80321f:	41 5e                	pop    %r14
+  803221:	41 5f                	pop    %r15
+  803223:	5d                   	pop    %rbp
+  803224:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803225:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80322a:	eb ea                	jmp    803216 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80322c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803231:	eb e3                	jmp    803216 <munmap+0x160>
+
+0000000000803233 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803233:	55                   	push   %rbp
+  803234:	48 89 e5             	mov    %rsp,%rbp
+  803237:	41 57                	push   %r15
+  803239:	41 56                	push   %r14
+  80323b:	41 55                	push   %r13
+  80323d:	41 54                	push   %r12
+  80323f:	53                   	push   %rbx
+  803240:	48 83 ec 28          	sub    $0x28,%rsp
+  803244:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803248:	49 89 f5             	mov    %rsi,%r13
+  80324b:	41 89 d6             	mov    %edx,%r14d
+  80324e:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803251:	41 89 cc             	mov    %ecx,%r12d
+  803254:	44 89 c7             	mov    %r8d,%edi
+  803257:	44 89 cb             	mov    %r9d,%ebx
+  80325a:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80325e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803262:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  803269:	00 00 00 
+  80326c:	ff d0                	call   *%rax
+  80326e:	41 89 c7             	mov    %eax,%r15d
+  803271:	85 c0                	test   %eax,%eax
+  803273:	0f 88 ae 01 00 00    	js     803427 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803279:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80327d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803284:	00 00 00 
+  803287:	8b 32                	mov    (%rdx),%esi
+  803289:	39 30                	cmp    %esi,(%rax)
+  80328b:	0f 85 7a 02 00 00    	jne    80350b <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803291:	8b 40 08             	mov    0x8(%rax),%eax
+  803294:	83 e0 03             	and    $0x3,%eax
+  803297:	83 f8 01             	cmp    $0x1,%eax
+  80329a:	0f 84 76 02 00 00    	je     803516 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8032a0:	4d 85 ed             	test   %r13,%r13
+  8032a3:	0f 84 78 02 00 00    	je     803521 <mmap+0x2ee>
+  8032a9:	85 db                	test   %ebx,%ebx
+  8032ab:	0f 88 70 02 00 00    	js     803521 <mmap+0x2ee>
+  8032b1:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032b7:	41 89 df             	mov    %ebx,%r15d
+  8032ba:	0f 85 6c 02 00 00    	jne    80352c <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032c0:	44 89 f0             	mov    %r14d,%eax
+  8032c3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032c6:	83 f8 04             	cmp    $0x4,%eax
+  8032c9:	0f 85 68 02 00 00    	jne    803537 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032cf:	44 89 e1             	mov    %r12d,%ecx
+  8032d2:	83 e1 01             	and    $0x1,%ecx
+  8032d5:	0f 95 c2             	setne  %dl
+  8032d8:	44 89 e0             	mov    %r12d,%eax
+  8032db:	d1 e8                	shr    %eax
+  8032dd:	83 f0 01             	xor    $0x1,%eax
+  8032e0:	83 e0 01             	and    $0x1,%eax
+  8032e3:	38 c2                	cmp    %al,%dl
+  8032e5:	0f 85 57 02 00 00    	jne    803542 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032eb:	85 c9                	test   %ecx,%ecx
+  8032ed:	74 0a                	je     8032f9 <mmap+0xc6>
+  8032ef:	41 f6 c6 02          	test   $0x2,%r14b
+  8032f3:	0f 85 54 02 00 00    	jne    80354d <mmap+0x31a>
+    file_flush_buffers();
+  8032f9:	48 b8 ae 2d 80 00 00 	movabs $0x802dae,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803305:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80330c:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803313:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803317:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80331a:	41 f6 c4 04          	test   $0x4,%r12b
+  80331e:	0f 84 15 01 00 00    	je     803439 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803324:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803327:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80332d:	0f 85 25 02 00 00    	jne    803558 <mmap+0x325>
+  803333:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803337:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80333e:	00 00 00 
+  803341:	48 39 c2             	cmp    %rax,%rdx
+  803344:	0f 82 19 02 00 00    	jb     803563 <mmap+0x330>
+  80334a:	48 39 c7             	cmp    %rax,%rdi
+  80334d:	0f 87 10 02 00 00    	ja     803563 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803353:	4c 89 ee             	mov    %r13,%rsi
+  803356:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	85 c0                	test   %eax,%eax
+  803364:	0f 88 04 02 00 00    	js     80356e <mmap+0x33b>
+    if (!handler) {
+  80336a:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803371:	00 00 00 
+  803374:	80 38 00             	cmpb   $0x0,(%rax)
+  803377:	75 2b                	jne    8033a4 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803379:	48 bf 4e 21 80 00 00 	movabs $0x80214e,%rdi
+  803380:	00 00 00 
+  803383:	48 b8 b2 42 80 00 00 	movabs $0x8042b2,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+  80338f:	85 c0                	test   %eax,%eax
+  803391:	0f 88 ea 01 00 00    	js     803581 <mmap+0x34e>
+        handler = 1;
+  803397:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80339e:	00 00 00 
+  8033a1:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8033a4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033a8:	48 b8 ed 21 80 00 00 	movabs $0x8021ed,%rax
+  8033af:	00 00 00 
+  8033b2:	ff d0                	call   *%rax
+  8033b4:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033b7:	48 85 c0             	test   %rax,%rax
+  8033ba:	0f 84 c9 01 00 00    	je     803589 <mmap+0x356>
+    m->mm_start = va;
+  8033c0:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033c3:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033c7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033cb:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033ce:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033d2:	44 89 e0             	mov    %r12d,%eax
+  8033d5:	c1 e0 06             	shl    $0x6,%eax
+  8033d8:	25 80 00 00 00       	and    $0x80,%eax
+  8033dd:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033e0:	09 f0                	or     %esi,%eax
+  8033e2:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033e6:	41 f6 c4 08          	test   $0x8,%r12b
+  8033ea:	74 31                	je     80341d <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033ec:	48 39 d3             	cmp    %rdx,%rbx
+  8033ef:	73 2c                	jae    80341d <mmap+0x1ea>
+  8033f1:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8033f6:	48 89 de             	mov    %rbx,%rsi
+  8033f9:	4c 89 f7             	mov    %r14,%rdi
+  8033fc:	48 b8 3d 20 80 00 00 	movabs $0x80203d,%rax
+  803403:	00 00 00 
+  803406:	ff d0                	call   *%rax
+  803408:	49 89 c4             	mov    %rax,%r12
+  80340b:	48 85 c0             	test   %rax,%rax
+  80340e:	0f 8e d7 00 00 00    	jle    8034eb <mmap+0x2b8>
+            va += n;
+  803414:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803417:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80341b:	72 d4                	jb     8033f1 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80341d:	49 8b 06             	mov    (%r14),%rax
+  803420:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803424:	48 89 06             	mov    %rax,(%rsi)
+}
+  803427:	44 89 f8             	mov    %r15d,%eax
+  80342a:	48 83 c4 28          	add    $0x28,%rsp
+  80342e:	5b                   	pop    %rbx
+  80342f:	41 5c                	pop    %r12
+  803431:	41 5d                	pop    %r13
+  803433:	41 5e                	pop    %r14
+  803435:	41 5f                	pop    %r15
+  803437:	5d                   	pop    %rbp
+  803438:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803439:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803440:	00 00 00 
+  803443:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803446:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80344d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803450:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803455:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80345c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80345f:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803466:	00 00 00 
+  803469:	48 39 d7             	cmp    %rdx,%rdi
+  80346c:	73 1c                	jae    80348a <mmap+0x257>
+        return -E_NO_MEM;
+  80346e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803474:	eb b1                	jmp    803427 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803476:	48 83 c0 01          	add    $0x1,%rax
+  80347a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80347e:	77 3f                	ja     8034bf <mmap+0x28c>
+  803480:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803485:	48 39 d7             	cmp    %rdx,%rdi
+  803488:	72 2a                	jb     8034b4 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80348a:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80348e:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803492:	48 39 d1             	cmp    %rdx,%rcx
+  803495:	73 df                	jae    803476 <mmap+0x243>
+  803497:	48 85 c9             	test   %rcx,%rcx
+  80349a:	74 da                	je     803476 <mmap+0x243>
+  80349c:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8034a0:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8034a5:	48 39 d3             	cmp    %rdx,%rbx
+  8034a8:	73 cc                	jae    803476 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8034aa:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034b2:	eb cc                	jmp    803480 <mmap+0x24d>
+        return -E_NO_MEM;
+  8034b4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034ba:	e9 68 ff ff ff       	jmp    803427 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034bf:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034c4:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034cb:	00 00 00 
+  8034ce:	48 39 c2             	cmp    %rax,%rdx
+  8034d1:	0f 82 9f 00 00 00    	jb     803576 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034d7:	48 85 db             	test   %rbx,%rbx
+  8034da:	0f 85 8a fe ff ff    	jne    80336a <mmap+0x137>
+        return -E_NO_MEM;
+  8034e0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034e6:	e9 3c ff ff ff       	jmp    803427 <mmap+0x1f4>
+        if (n < 0) {
+  8034eb:	0f 89 2c ff ff ff    	jns    80341d <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8034f1:	49 8b 3e             	mov    (%r14),%rdi
+  8034f4:	4c 89 ee             	mov    %r13,%rsi
+  8034f7:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  8034fe:	00 00 00 
+  803501:	ff d0                	call   *%rax
+            return n;
+  803503:	45 89 e7             	mov    %r12d,%r15d
+  803506:	e9 1c ff ff ff       	jmp    803427 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80350b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803511:	e9 11 ff ff ff       	jmp    803427 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803516:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80351c:	e9 06 ff ff ff       	jmp    803427 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803521:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803527:	e9 fb fe ff ff       	jmp    803427 <mmap+0x1f4>
+  80352c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803532:	e9 f0 fe ff ff       	jmp    803427 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803537:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80353d:	e9 e5 fe ff ff       	jmp    803427 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803542:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803548:	e9 da fe ff ff       	jmp    803427 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80354d:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803553:	e9 cf fe ff ff       	jmp    803427 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803558:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80355e:	e9 c4 fe ff ff       	jmp    803427 <mmap+0x1f4>
+  803563:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803569:	e9 b9 fe ff ff       	jmp    803427 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80356e:	41 89 c7             	mov    %eax,%r15d
+  803571:	e9 b1 fe ff ff       	jmp    803427 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803576:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80357c:	e9 a6 fe ff ff       	jmp    803427 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803581:	41 89 c7             	mov    %eax,%r15d
+  803584:	e9 9e fe ff ff       	jmp    803427 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803589:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80358f:	e9 93 fe ff ff       	jmp    803427 <mmap+0x1f4>
+
+0000000000803594 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803594:	55                   	push   %rbp
+  803595:	48 89 e5             	mov    %rsp,%rbp
+  803598:	41 54                	push   %r12
+  80359a:	53                   	push   %rbx
+  80359b:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80359e:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+  8035aa:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8035ad:	48 be 20 4d 80 00 00 	movabs $0x804d20,%rsi
+  8035b4:	00 00 00 
+  8035b7:	48 89 df             	mov    %rbx,%rdi
+  8035ba:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  8035c1:	00 00 00 
+  8035c4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035c6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035cb:	41 2b 04 24          	sub    (%r12),%eax
+  8035cf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035d5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035dc:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035df:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035e6:	00 00 00 
+  8035e9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035f5:	5b                   	pop    %rbx
+  8035f6:	41 5c                	pop    %r12
+  8035f8:	5d                   	pop    %rbp
+  8035f9:	c3                   	ret
+
+00000000008035fa <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035fa:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035fd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803603:	8b 17                	mov    (%rdi),%edx
+  803605:	85 d2                	test   %edx,%edx
+  803607:	75 01                	jne    80360a <pipe_wakeup+0x10>
+  803609:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80360a:	55                   	push   %rbp
+  80360b:	48 89 e5             	mov    %rsp,%rbp
+  80360e:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803611:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803617:	be 00 04 00 00       	mov    $0x400,%esi
+  80361c:	48 b8 f3 13 80 00 00 	movabs $0x8013f3,%rax
+  803623:	00 00 00 
+  803626:	ff d0                	call   *%rax
+}
+  803628:	5d                   	pop    %rbp
+  803629:	c3                   	ret
+
+000000000080362a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80362a:	55                   	push   %rbp
+  80362b:	48 89 e5             	mov    %rsp,%rbp
+  80362e:	41 55                	push   %r13
+  803630:	41 54                	push   %r12
+  803632:	53                   	push   %rbx
+  803633:	48 83 ec 08          	sub    $0x8,%rsp
+  803637:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80363a:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  803641:	00 00 00 
+  803644:	ff d0                	call   *%rax
+  803646:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803649:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80364e:	4c 89 e6             	mov    %r12,%rsi
+  803651:	bf 00 00 00 00       	mov    $0x0,%edi
+  803656:	49 bc 0d 11 80 00 00 	movabs $0x80110d,%r12
+  80365d:	00 00 00 
+  803660:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803663:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803667:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80366b:	49 bd fa 35 80 00 00 	movabs $0x8035fa,%r13
+  803672:	00 00 00 
+  803675:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803678:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80367c:	48 89 de             	mov    %rbx,%rsi
+  80367f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803682:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803687:	48 89 de             	mov    %rbx,%rsi
+  80368a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80368f:	41 ff d4             	call   *%r12
+  803692:	48 83 c4 08          	add    $0x8,%rsp
+  803696:	5b                   	pop    %rbx
+  803697:	41 5c                	pop    %r12
+  803699:	41 5d                	pop    %r13
+  80369b:	5d                   	pop    %rbp
+  80369c:	c3                   	ret
+
+000000000080369d <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80369d:	55                   	push   %rbp
+  80369e:	48 89 e5             	mov    %rsp,%rbp
+  8036a1:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036a4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036a9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036ae:	48 b8 50 10 80 00 00 	movabs $0x801050,%rax
+  8036b5:	00 00 00 
+  8036b8:	ff d0                	call   *%rax
+  8036ba:	85 c0                	test   %eax,%eax
+  8036bc:	0f 94 c0             	sete   %al
+  8036bf:	0f b6 c0             	movzbl %al,%eax
+}
+  8036c2:	5d                   	pop    %rbp
+  8036c3:	c3                   	ret
+
+00000000008036c4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036c4:	55                   	push   %rbp
+  8036c5:	48 89 e5             	mov    %rsp,%rbp
+  8036c8:	41 57                	push   %r15
+  8036ca:	41 56                	push   %r14
+  8036cc:	41 55                	push   %r13
+  8036ce:	41 54                	push   %r12
+  8036d0:	53                   	push   %rbx
+  8036d1:	48 83 ec 38          	sub    $0x38,%rsp
+  8036d5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036d9:	49 89 f4             	mov    %rsi,%r12
+  8036dc:	49 89 d7             	mov    %rdx,%r15
+  8036df:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036e3:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  8036ea:	00 00 00 
+  8036ed:	ff d0                	call   *%rax
+  8036ef:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036f2:	4d 85 ff             	test   %r15,%r15
+  8036f5:	0f 84 f1 00 00 00    	je     8037ec <devpipe_write+0x128>
+  8036fb:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8036ff:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803703:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803707:	49 bd 9d 36 80 00 00 	movabs $0x80369d,%r13
+  80370e:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803711:	49 bf fa 35 80 00 00 	movabs $0x8035fa,%r15
+  803718:	00 00 00 
+  80371b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80371f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803723:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803727:	8b 73 04             	mov    0x4(%rbx),%esi
+  80372a:	48 63 ce             	movslq %esi,%rcx
+  80372d:	48 63 03             	movslq (%rbx),%rax
+  803730:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803736:	48 39 c1             	cmp    %rax,%rcx
+  803739:	72 64                	jb     80379f <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80373b:	48 89 de             	mov    %rbx,%rsi
+  80373e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803742:	41 ff d5             	call   *%r13
+  803745:	85 c0                	test   %eax,%eax
+  803747:	0f 85 b9 00 00 00    	jne    803806 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80374d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803751:	4c 89 f7             	mov    %r14,%rdi
+  803754:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803757:	8b 43 04             	mov    0x4(%rbx),%eax
+  80375a:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803761:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803768:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80376e:	8b 03                	mov    (%rbx),%eax
+  803770:	41 39 c4             	cmp    %eax,%r12d
+  803773:	75 b2                	jne    803727 <devpipe_write+0x63>
+  803775:	48 89 de             	mov    %rbx,%rsi
+  803778:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80377c:	41 ff d5             	call   *%r13
+  80377f:	85 c0                	test   %eax,%eax
+  803781:	75 a0                	jne    803723 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803783:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803788:	44 89 e6             	mov    %r12d,%esi
+  80378b:	48 89 df             	mov    %rbx,%rdi
+  80378e:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  803795:	00 00 00 
+  803798:	ff d0                	call   *%rax
+  80379a:	e9 7c ff ff ff       	jmp    80371b <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80379f:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8037a3:	41 0f b6 38          	movzbl (%r8),%edi
+  8037a7:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8037ae:	80 80 80 
+  8037b1:	48 89 c8             	mov    %rcx,%rax
+  8037b4:	48 f7 e2             	mul    %rdx
+  8037b7:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037bb:	48 89 d0             	mov    %rdx,%rax
+  8037be:	48 c1 e0 08          	shl    $0x8,%rax
+  8037c2:	48 29 d0             	sub    %rdx,%rax
+  8037c5:	48 c1 e0 04          	shl    $0x4,%rax
+  8037c9:	48 29 c1             	sub    %rax,%rcx
+  8037cc:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037d1:	83 c6 01             	add    $0x1,%esi
+  8037d4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037d7:	49 83 c0 01          	add    $0x1,%r8
+  8037db:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037df:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037e3:	49 39 c0             	cmp    %rax,%r8
+  8037e6:	0f 85 2f ff ff ff    	jne    80371b <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037ec:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037f0:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037f4:	48 b8 fa 35 80 00 00 	movabs $0x8035fa,%rax
+  8037fb:	00 00 00 
+  8037fe:	ff d0                	call   *%rax
+    return n;
+  803800:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803804:	eb 05                	jmp    80380b <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803806:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80380b:	48 83 c4 38          	add    $0x38,%rsp
+  80380f:	5b                   	pop    %rbx
+  803810:	41 5c                	pop    %r12
+  803812:	41 5d                	pop    %r13
+  803814:	41 5e                	pop    %r14
+  803816:	41 5f                	pop    %r15
+  803818:	5d                   	pop    %rbp
+  803819:	c3                   	ret
+
+000000000080381a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80381a:	55                   	push   %rbp
+  80381b:	48 89 e5             	mov    %rsp,%rbp
+  80381e:	41 57                	push   %r15
+  803820:	41 56                	push   %r14
+  803822:	41 55                	push   %r13
+  803824:	41 54                	push   %r12
+  803826:	53                   	push   %rbx
+  803827:	48 83 ec 28          	sub    $0x28,%rsp
+  80382b:	49 89 fd             	mov    %rdi,%r13
+  80382e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803832:	49 89 d4             	mov    %rdx,%r12
+  803835:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803839:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+  803845:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803848:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80384e:	49 bf 9d 36 80 00 00 	movabs $0x80369d,%r15
+  803855:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803858:	4d 85 e4             	test   %r12,%r12
+  80385b:	0f 84 d5 00 00 00    	je     803936 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803861:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803865:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803869:	8b 03                	mov    (%rbx),%eax
+  80386b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80386e:	75 7a                	jne    8038ea <devpipe_read+0xd0>
+            if (i > 0) {
+  803870:	4d 85 f6             	test   %r14,%r14
+  803873:	75 50                	jne    8038c5 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803875:	48 89 de             	mov    %rbx,%rsi
+  803878:	4c 89 ef             	mov    %r13,%rdi
+  80387b:	41 ff d7             	call   *%r15
+  80387e:	85 c0                	test   %eax,%eax
+  803880:	0f 85 c9 00 00 00    	jne    80394f <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803886:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803889:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803890:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803896:	8b 43 04             	mov    0x4(%rbx),%eax
+  803899:	41 39 c4             	cmp    %eax,%r12d
+  80389c:	75 cb                	jne    803869 <devpipe_read+0x4f>
+  80389e:	48 89 de             	mov    %rbx,%rsi
+  8038a1:	4c 89 ef             	mov    %r13,%rdi
+  8038a4:	41 ff d7             	call   *%r15
+  8038a7:	85 c0                	test   %eax,%eax
+  8038a9:	75 be                	jne    803869 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8038ab:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8038b0:	44 89 e6             	mov    %r12d,%esi
+  8038b3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038b7:	48 b8 d5 13 80 00 00 	movabs $0x8013d5,%rax
+  8038be:	00 00 00 
+  8038c1:	ff d0                	call   *%rax
+  8038c3:	eb a4                	jmp    803869 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038c5:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038c9:	48 89 de             	mov    %rbx,%rsi
+  8038cc:	48 b8 fa 35 80 00 00 	movabs $0x8035fa,%rax
+  8038d3:	00 00 00 
+  8038d6:	ff d0                	call   *%rax
+                return i;
+  8038d8:	4c 89 f0             	mov    %r14,%rax
+}
+  8038db:	48 83 c4 28          	add    $0x28,%rsp
+  8038df:	5b                   	pop    %rbx
+  8038e0:	41 5c                	pop    %r12
+  8038e2:	41 5d                	pop    %r13
+  8038e4:	41 5e                	pop    %r14
+  8038e6:	41 5f                	pop    %r15
+  8038e8:	5d                   	pop    %rbp
+  8038e9:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038ea:	48 63 c8             	movslq %eax,%rcx
+  8038ed:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8038f4:	80 80 80 
+  8038f7:	48 89 c8             	mov    %rcx,%rax
+  8038fa:	48 f7 e2             	mul    %rdx
+  8038fd:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803901:	48 89 d0             	mov    %rdx,%rax
+  803904:	48 c1 e0 08          	shl    $0x8,%rax
+  803908:	48 29 d0             	sub    %rdx,%rax
+  80390b:	48 c1 e0 04          	shl    $0x4,%rax
+  80390f:	48 89 c2             	mov    %rax,%rdx
+  803912:	48 89 c8             	mov    %rcx,%rax
+  803915:	48 29 d0             	sub    %rdx,%rax
+  803918:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80391d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803921:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803925:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803928:	49 83 c6 01          	add    $0x1,%r14
+  80392c:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803930:	0f 85 2b ff ff ff    	jne    803861 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803936:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80393a:	48 89 de             	mov    %rbx,%rsi
+  80393d:	48 b8 fa 35 80 00 00 	movabs $0x8035fa,%rax
+  803944:	00 00 00 
+  803947:	ff d0                	call   *%rax
+    return n;
+  803949:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80394d:	eb 8c                	jmp    8038db <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80394f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803954:	eb 85                	jmp    8038db <devpipe_read+0xc1>
+
+0000000000803956 <pipe>:
+pipe(int pfd[2]) {
+  803956:	55                   	push   %rbp
+  803957:	48 89 e5             	mov    %rsp,%rbp
+  80395a:	41 55                	push   %r13
+  80395c:	41 54                	push   %r12
+  80395e:	53                   	push   %rbx
+  80395f:	48 83 ec 18          	sub    $0x18,%rsp
+  803963:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803966:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80396a:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  803971:	00 00 00 
+  803974:	ff d0                	call   *%rax
+  803976:	89 c3                	mov    %eax,%ebx
+  803978:	85 c0                	test   %eax,%eax
+  80397a:	0f 88 a0 01 00 00    	js     803b20 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803980:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803985:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80398a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80398e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803993:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  80399a:	00 00 00 
+  80399d:	ff d0                	call   *%rax
+  80399f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039a1:	85 c0                	test   %eax,%eax
+  8039a3:	0f 88 77 01 00 00    	js     803b20 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039a9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8039ad:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  8039b4:	00 00 00 
+  8039b7:	ff d0                	call   *%rax
+  8039b9:	89 c3                	mov    %eax,%ebx
+  8039bb:	85 c0                	test   %eax,%eax
+  8039bd:	0f 88 43 01 00 00    	js     803b06 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039c3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039cd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039d6:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  8039dd:	00 00 00 
+  8039e0:	ff d0                	call   *%rax
+  8039e2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039e4:	85 c0                	test   %eax,%eax
+  8039e6:	0f 88 1a 01 00 00    	js     803b06 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039ec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039f0:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  8039f7:	00 00 00 
+  8039fa:	ff d0                	call   *%rax
+  8039fc:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a09:	48 89 c6             	mov    %rax,%rsi
+  803a0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a11:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  803a18:	00 00 00 
+  803a1b:	ff d0                	call   *%rax
+  803a1d:	89 c3                	mov    %eax,%ebx
+  803a1f:	85 c0                	test   %eax,%eax
+  803a21:	0f 88 c5 00 00 00    	js     803aec <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a27:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a2b:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  803a32:	00 00 00 
+  803a35:	ff d0                	call   *%rax
+  803a37:	48 89 c1             	mov    %rax,%rcx
+  803a3a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a40:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a46:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a4b:	4c 89 ee             	mov    %r13,%rsi
+  803a4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a53:	48 b8 bd 10 80 00 00 	movabs $0x8010bd,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+  803a5f:	89 c3                	mov    %eax,%ebx
+  803a61:	85 c0                	test   %eax,%eax
+  803a63:	78 6e                	js     803ad3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a65:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a6a:	4c 89 ef             	mov    %r13,%rdi
+  803a6d:	48 b8 2c 10 80 00 00 	movabs $0x80102c,%rax
+  803a74:	00 00 00 
+  803a77:	ff d0                	call   *%rax
+  803a79:	83 f8 02             	cmp    $0x2,%eax
+  803a7c:	0f 85 ab 00 00 00    	jne    803b2d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a82:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a89:	00 00 
+  803a8b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a8f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a91:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a95:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a9c:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803aa0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803aa2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803aa6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803aad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ab1:	48 bb 9a 14 80 00 00 	movabs $0x80149a,%rbx
+  803ab8:	00 00 00 
+  803abb:	ff d3                	call   *%rbx
+  803abd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ac1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ac5:	ff d3                	call   *%rbx
+  803ac7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803acc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ad1:	eb 4d                	jmp    803b20 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ad3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ad8:	4c 89 ee             	mov    %r13,%rsi
+  803adb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae0:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803aec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af1:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803af5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803afa:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b0b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b14:	48 b8 0d 11 80 00 00 	movabs $0x80110d,%rax
+  803b1b:	00 00 00 
+  803b1e:	ff d0                	call   *%rax
+}
+  803b20:	89 d8                	mov    %ebx,%eax
+  803b22:	48 83 c4 18          	add    $0x18,%rsp
+  803b26:	5b                   	pop    %rbx
+  803b27:	41 5c                	pop    %r12
+  803b29:	41 5d                	pop    %r13
+  803b2b:	5d                   	pop    %rbp
+  803b2c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b2d:	48 b9 50 4d 80 00 00 	movabs $0x804d50,%rcx
+  803b34:	00 00 00 
+  803b37:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  803b3e:	00 00 00 
+  803b41:	be 50 00 00 00       	mov    $0x50,%esi
+  803b46:	48 bf 3c 4d 80 00 00 	movabs $0x804d3c,%rdi
+  803b4d:	00 00 00 
+  803b50:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b55:	49 b8 85 41 80 00 00 	movabs $0x804185,%r8
+  803b5c:	00 00 00 
+  803b5f:	41 ff d0             	call   *%r8
+
+0000000000803b62 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b62:	55                   	push   %rbp
+  803b63:	48 89 e5             	mov    %rsp,%rbp
+  803b66:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b6a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b6e:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  803b75:	00 00 00 
+  803b78:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b7a:	85 c0                	test   %eax,%eax
+  803b7c:	78 23                	js     803ba1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b7e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b82:	48 b8 ac 14 80 00 00 	movabs $0x8014ac,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+  803b8e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b91:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b95:	48 b8 9d 36 80 00 00 	movabs $0x80369d,%rax
+  803b9c:	00 00 00 
+  803b9f:	ff d0                	call   *%rax
+}
+  803ba1:	c9                   	leave
+  803ba2:	c3                   	ret
+
+0000000000803ba3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ba3:	48 89 f8             	mov    %rdi,%rax
+  803ba6:	48 c1 e8 27          	shr    $0x27,%rax
+  803baa:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803bb1:	01 00 00 
+  803bb4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bb8:	f6 c2 01             	test   $0x1,%dl
+  803bbb:	74 6d                	je     803c2a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bbd:	48 89 f8             	mov    %rdi,%rax
+  803bc0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bc4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bcb:	01 00 00 
+  803bce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bd2:	f6 c2 01             	test   $0x1,%dl
+  803bd5:	74 62                	je     803c39 <get_uvpt_entry+0x96>
+  803bd7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bde:	01 00 00 
+  803be1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803be5:	f6 c2 80             	test   $0x80,%dl
+  803be8:	75 4f                	jne    803c39 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bea:	48 89 f8             	mov    %rdi,%rax
+  803bed:	48 c1 e8 15          	shr    $0x15,%rax
+  803bf1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bf8:	01 00 00 
+  803bfb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bff:	f6 c2 01             	test   $0x1,%dl
+  803c02:	74 44                	je     803c48 <get_uvpt_entry+0xa5>
+  803c04:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c0b:	01 00 00 
+  803c0e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c12:	f6 c2 80             	test   $0x80,%dl
+  803c15:	75 31                	jne    803c48 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c17:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c1b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c22:	01 00 00 
+  803c25:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c29:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c2a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c31:	01 00 00 
+  803c34:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c38:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c39:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c40:	01 00 00 
+  803c43:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c47:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c48:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c4f:	01 00 00 
+  803c52:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c56:	c3                   	ret
+
+0000000000803c57 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c57:	55                   	push   %rbp
+  803c58:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c5b:	48 b8 a3 3b 80 00 00 	movabs $0x803ba3,%rax
+  803c62:	00 00 00 
+  803c65:	ff d0                	call   *%rax
+  803c67:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c6a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c6f:	89 c1                	mov    %eax,%ecx
+  803c71:	83 c9 04             	or     $0x4,%ecx
+  803c74:	f6 c2 01             	test   $0x1,%dl
+  803c77:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c7a:	89 c1                	mov    %eax,%ecx
+  803c7c:	83 c9 02             	or     $0x2,%ecx
+  803c7f:	f6 c2 02             	test   $0x2,%dl
+  803c82:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c85:	89 c1                	mov    %eax,%ecx
+  803c87:	83 c9 01             	or     $0x1,%ecx
+  803c8a:	48 85 d2             	test   %rdx,%rdx
+  803c8d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c90:	89 c1                	mov    %eax,%ecx
+  803c92:	83 c9 40             	or     $0x40,%ecx
+  803c95:	f6 c6 04             	test   $0x4,%dh
+  803c98:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c9b:	5d                   	pop    %rbp
+  803c9c:	c3                   	ret
+
+0000000000803c9d <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c9d:	55                   	push   %rbp
+  803c9e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ca1:	48 b8 a3 3b 80 00 00 	movabs $0x803ba3,%rax
+  803ca8:	00 00 00 
+  803cab:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803cad:	48 c1 e8 06          	shr    $0x6,%rax
+  803cb1:	83 e0 01             	and    $0x1,%eax
+}
+  803cb4:	5d                   	pop    %rbp
+  803cb5:	c3                   	ret
+
+0000000000803cb6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803cb6:	55                   	push   %rbp
+  803cb7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803cba:	48 b8 a3 3b 80 00 00 	movabs $0x803ba3,%rax
+  803cc1:	00 00 00 
+  803cc4:	ff d0                	call   *%rax
+  803cc6:	83 e0 01             	and    $0x1,%eax
+}
+  803cc9:	5d                   	pop    %rbp
+  803cca:	c3                   	ret
+
+0000000000803ccb <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803ccb:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803cd2:	01 00 00 
+  803cd5:	a8 01                	test   $0x1,%al
+  803cd7:	75 06                	jne    803cdf <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803cd9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cde:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cdf:	55                   	push   %rbp
+  803ce0:	48 89 e5             	mov    %rsp,%rbp
+  803ce3:	41 57                	push   %r15
+  803ce5:	41 56                	push   %r14
+  803ce7:	41 55                	push   %r13
+  803ce9:	41 54                	push   %r12
+  803ceb:	53                   	push   %rbx
+  803cec:	48 83 ec 28          	sub    $0x28,%rsp
+  803cf0:	49 89 fe             	mov    %rdi,%r14
+  803cf3:	49 89 f7             	mov    %rsi,%r15
+  803cf6:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803cfd:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803cfe:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803d05:	01 00 00 
+  803d08:	e9 ae 00 00 00       	jmp    803dbb <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d0d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d14:	49 83 ec 01          	sub    $0x1,%r12
+  803d18:	74 2d                	je     803d47 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d1a:	48 89 d8             	mov    %rbx,%rax
+  803d1d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d21:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d26:	f6 c2 01             	test   $0x1,%dl
+  803d29:	74 e2                	je     803d0d <foreach_shared_region+0x42>
+  803d2b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d30:	f6 c4 04             	test   $0x4,%ah
+  803d33:	74 d8                	je     803d0d <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d35:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d3c:	4c 89 fa             	mov    %r15,%rdx
+  803d3f:	48 89 df             	mov    %rbx,%rdi
+  803d42:	41 ff d6             	call   *%r14
+  803d45:	eb c6                	jmp    803d0d <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d47:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d4e:	00 
+  803d4f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d54:	74 4a                	je     803da0 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d56:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d5a:	48 c1 e8 15          	shr    $0x15,%rax
+  803d5e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d65:	01 00 00 
+  803d68:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d6c:	a8 01                	test   $0x1,%al
+  803d6e:	74 d7                	je     803d47 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d70:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d74:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d7b:	48 39 c3             	cmp    %rax,%rbx
+  803d7e:	73 c7                	jae    803d47 <foreach_shared_region+0x7c>
+  803d80:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d87:	48 39 d0             	cmp    %rdx,%rax
+  803d8a:	4d 19 e4             	sbb    %r12,%r12
+  803d8d:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d94:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d9b:	e9 7a ff ff ff       	jmp    803d1a <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803da0:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803da7:	40 
+  803da8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dac:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803db3:	00 00 00 
+  803db6:	48 39 c1             	cmp    %rax,%rcx
+  803db9:	74 50                	je     803e0b <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803dbb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803dbf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dc3:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803dca:	01 00 00 
+  803dcd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803dd1:	a8 01                	test   $0x1,%al
+  803dd3:	74 cb                	je     803da0 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dd5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dd9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803de0:	48 39 c1             	cmp    %rax,%rcx
+  803de3:	73 bb                	jae    803da0 <foreach_shared_region+0xd5>
+  803de5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803dec:	48 39 d0             	cmp    %rdx,%rax
+  803def:	48 19 c0             	sbb    %rax,%rax
+  803df2:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803df8:	48 05 00 02 00 00    	add    $0x200,%rax
+  803dfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e02:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e06:	e9 4b ff ff ff       	jmp    803d56 <foreach_shared_region+0x8b>
+  803e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e10:	48 83 c4 28          	add    $0x28,%rsp
+  803e14:	5b                   	pop    %rbx
+  803e15:	41 5c                	pop    %r12
+  803e17:	41 5d                	pop    %r13
+  803e19:	41 5e                	pop    %r14
+  803e1b:	41 5f                	pop    %r15
+  803e1d:	5d                   	pop    %rbp
+  803e1e:	c3                   	ret
+
+0000000000803e1f <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e1f:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e25:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e2c:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e33:	c3                   	ret
+
+0000000000803e34 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e34:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e37:	8b 17                	mov    (%rdi),%edx
+  803e39:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e3b:	83 f8 0f             	cmp    $0xf,%eax
+  803e3e:	77 13                	ja     803e53 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e40:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e43:	83 e0 0f             	and    $0xf,%eax
+  803e46:	48 c1 e0 09          	shl    $0x9,%rax
+  803e4a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e51:	00 
+  803e52:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e58:	c3                   	ret
+
+0000000000803e59 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e59:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e5c:	83 c0 01             	add    $0x1,%eax
+  803e5f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e62:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e68:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e70:	85 d2                	test   %edx,%edx
+  803e72:	75 04                	jne    803e78 <chan_publish+0x1f>
+  803e74:	83 e0 01             	and    $0x1,%eax
+}
+  803e77:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e78:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e7b:	85 c0                	test   %eax,%eax
+  803e7d:	0f 95 c0             	setne  %al
+  803e80:	0f b6 c0             	movzbl %al,%eax
+  803e83:	eb ef                	jmp    803e74 <chan_publish+0x1b>
+
+0000000000803e85 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e85:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e88:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e8a:	29 d0                	sub    %edx,%eax
+  803e8c:	83 e8 01             	sub    $0x1,%eax
+  803e8f:	83 f8 0f             	cmp    $0xf,%eax
+  803e92:	77 12                	ja     803ea6 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803e94:	8b 07                	mov    (%rdi),%eax
+  803e96:	83 e0 0f             	and    $0xf,%eax
+  803e99:	48 c1 e0 09          	shl    $0x9,%rax
+  803e9d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803ea4:	00 
+  803ea5:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803ea6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eab:	c3                   	ret
+
+0000000000803eac <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803eac:	8b 07                	mov    (%rdi),%eax
+  803eae:	83 c0 01             	add    $0x1,%eax
+  803eb1:	89 07                	mov    %eax,(%rdi)
+}
+  803eb3:	c3                   	ret
+
+0000000000803eb4 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803eb4:	55                   	push   %rbp
+  803eb5:	48 89 e5             	mov    %rsp,%rbp
+  803eb8:	53                   	push   %rbx
+  803eb9:	48 83 ec 08          	sub    $0x8,%rsp
+  803ebd:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803ec0:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ec7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803ecd:	48 b8 85 3e 80 00 00 	movabs $0x803e85,%rax
+  803ed4:	00 00 00 
+  803ed7:	ff d0                	call   *%rax
+  803ed9:	48 85 c0             	test   %rax,%rax
+  803edc:	74 12                	je     803ef0 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803ede:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ee5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803eee:	c9                   	leave
+  803eef:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803ef0:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ef5:	eb f3                	jmp    803eea <chan_arm+0x36>
+
+0000000000803ef7 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803ef7:	55                   	push   %rbp
+  803ef8:	48 89 e5             	mov    %rsp,%rbp
+  803efb:	41 56                	push   %r14
+  803efd:	41 55                	push   %r13
+  803eff:	41 54                	push   %r12
+  803f01:	53                   	push   %rbx
+  803f02:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803f05:	49 bc b4 3e 80 00 00 	movabs $0x803eb4,%r12
+  803f0c:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f0f:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f13:	49 bd d5 13 80 00 00 	movabs $0x8013d5,%r13
+  803f1a:	00 00 00 
+    while (chan_arm(r))
+  803f1d:	eb 0d                	jmp    803f2c <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f1f:	8b 33                	mov    (%rbx),%esi
+  803f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f26:	4c 89 f7             	mov    %r14,%rdi
+  803f29:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f2c:	48 89 df             	mov    %rbx,%rdi
+  803f2f:	41 ff d4             	call   *%r12
+  803f32:	84 c0                	test   %al,%al
+  803f34:	75 e9                	jne    803f1f <chan_wait+0x28>
+}
+  803f36:	5b                   	pop    %rbx
+  803f37:	41 5c                	pop    %r12
+  803f39:	41 5d                	pop    %r13
+  803f3b:	41 5e                	pop    %r14
+  803f3d:	5d                   	pop    %rbp
+  803f3e:	c3                   	ret
+
+0000000000803f3f <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f3f:	55                   	push   %rbp
+  803f40:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f43:	48 83 c7 40          	add    $0x40,%rdi
+  803f47:	be 01 00 00 00       	mov    $0x1,%esi
+  803f4c:	48 b8 f3 13 80 00 00 	movabs $0x8013f3,%rax
+  803f53:	00 00 00 
+  803f56:	ff d0                	call   *%rax
+}
+  803f58:	5d                   	pop    %rbp
+  803f59:	c3                   	ret
+
+0000000000803f5a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f5f:	c3                   	ret
+
+0000000000803f60 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f60:	55                   	push   %rbp
+  803f61:	48 89 e5             	mov    %rsp,%rbp
+  803f64:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f67:	48 be 74 4d 80 00 00 	movabs $0x804d74,%rsi
+  803f6e:	00 00 00 
+  803f71:	48 b8 08 0b 80 00 00 	movabs $0x800b08,%rax
+  803f78:	00 00 00 
+  803f7b:	ff d0                	call   *%rax
+    return 0;
+}
+  803f7d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f82:	5d                   	pop    %rbp
+  803f83:	c3                   	ret
+
+0000000000803f84 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f84:	55                   	push   %rbp
+  803f85:	48 89 e5             	mov    %rsp,%rbp
+  803f88:	41 57                	push   %r15
+  803f8a:	41 56                	push   %r14
+  803f8c:	41 55                	push   %r13
+  803f8e:	41 54                	push   %r12
+  803f90:	53                   	push   %rbx
+  803f91:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f98:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f9f:	48 85 d2             	test   %rdx,%rdx
+  803fa2:	74 7a                	je     80401e <devcons_write+0x9a>
+  803fa4:	49 89 d6             	mov    %rdx,%r14
+  803fa7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fad:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803fb2:	49 bf 02 0d 80 00 00 	movabs $0x800d02,%r15
+  803fb9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fbc:	4c 89 f3             	mov    %r14,%rbx
+  803fbf:	48 29 f3             	sub    %rsi,%rbx
+  803fc2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fc7:	48 39 c3             	cmp    %rax,%rbx
+  803fca:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fce:	4c 63 eb             	movslq %ebx,%r13
+  803fd1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fd8:	48 01 c6             	add    %rax,%rsi
+  803fdb:	4c 89 ea             	mov    %r13,%rdx
+  803fde:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fe5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fe8:	4c 89 ee             	mov    %r13,%rsi
+  803feb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ff2:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803ffe:	41 01 dc             	add    %ebx,%r12d
+  804001:	49 63 f4             	movslq %r12d,%rsi
+  804004:	4c 39 f6             	cmp    %r14,%rsi
+  804007:	72 b3                	jb     803fbc <devcons_write+0x38>
+    return res;
+  804009:	49 63 c4             	movslq %r12d,%rax
+}
+  80400c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804013:	5b                   	pop    %rbx
+  804014:	41 5c                	pop    %r12
+  804016:	41 5d                	pop    %r13
+  804018:	41 5e                	pop    %r14
+  80401a:	41 5f                	pop    %r15
+  80401c:	5d                   	pop    %rbp
+  80401d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80401e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804024:	eb e3                	jmp    804009 <devcons_write+0x85>
+
+0000000000804026 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804026:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804029:	ba 00 00 00 00       	mov    $0x0,%edx
+  80402e:	48 85 c0             	test   %rax,%rax
+  804031:	74 55                	je     804088 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804033:	55                   	push   %rbp
+  804034:	48 89 e5             	mov    %rsp,%rbp
+  804037:	41 55                	push   %r13
+  804039:	41 54                	push   %r12
+  80403b:	53                   	push   %rbx
+  80403c:	48 83 ec 08          	sub    $0x8,%rsp
+  804040:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804043:	48 bb 4e 0f 80 00 00 	movabs $0x800f4e,%rbx
+  80404a:	00 00 00 
+  80404d:	49 bc 03 10 80 00 00 	movabs $0x801003,%r12
+  804054:	00 00 00 
+  804057:	eb 03                	jmp    80405c <devcons_read+0x36>
+  804059:	41 ff d4             	call   *%r12
+  80405c:	ff d3                	call   *%rbx
+  80405e:	85 c0                	test   %eax,%eax
+  804060:	74 f7                	je     804059 <devcons_read+0x33>
+    if (c < 0) return c;
+  804062:	48 63 d0             	movslq %eax,%rdx
+  804065:	78 13                	js     80407a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804067:	ba 00 00 00 00       	mov    $0x0,%edx
+  80406c:	83 f8 04             	cmp    $0x4,%eax
+  80406f:	74 09                	je     80407a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804071:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804075:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80407a:	48 89 d0             	mov    %rdx,%rax
+  80407d:	48 83 c4 08          	add    $0x8,%rsp
+  804081:	5b                   	pop    %rbx
+  804082:	41 5c                	pop    %r12
+  804084:	41 5d                	pop    %r13
+  804086:	5d                   	pop    %rbp
+  804087:	c3                   	ret
+  804088:	48 89 d0             	mov    %rdx,%rax
+  80408b:	c3                   	ret
+
+000000000080408c <cputchar>:
+cputchar(int ch) {
+  80408c:	55                   	push   %rbp
+  80408d:	48 89 e5             	mov    %rsp,%rbp
+  804090:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804094:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804098:	be 01 00 00 00       	mov    $0x1,%esi
+  80409d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8040a1:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  8040a8:	00 00 00 
+  8040ab:	ff d0                	call   *%rax
+}
+  8040ad:	c9                   	leave
+  8040ae:	c3                   	ret
+
+00000000008040af <getchar>:
+getchar(void) {
+  8040af:	55                   	push   %rbp
+  8040b0:	48 89 e5             	mov    %rsp,%rbp
+  8040b3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040b7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040bc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040c5:	48 b8 0b 18 80 00 00 	movabs $0x80180b,%rax
+  8040cc:	00 00 00 
+  8040cf:	ff d0                	call   *%rax
+  8040d1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040d3:	85 c0                	test   %eax,%eax
+  8040d5:	78 06                	js     8040dd <getchar+0x2e>
+  8040d7:	74 08                	je     8040e1 <getchar+0x32>
+  8040d9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040dd:	89 d0                	mov    %edx,%eax
+  8040df:	c9                   	leave
+  8040e0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040e1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040e6:	eb f5                	jmp    8040dd <getchar+0x2e>
+
+00000000008040e8 <iscons>:
+iscons(int fdnum) {
+  8040e8:	55                   	push   %rbp
+  8040e9:	48 89 e5             	mov    %rsp,%rbp
+  8040ec:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040f0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040f4:	48 b8 28 15 80 00 00 	movabs $0x801528,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804100:	85 c0                	test   %eax,%eax
+  804102:	78 18                	js     80411c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804104:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804108:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80410f:	00 00 00 
+  804112:	8b 00                	mov    (%rax),%eax
+  804114:	39 02                	cmp    %eax,(%rdx)
+  804116:	0f 94 c0             	sete   %al
+  804119:	0f b6 c0             	movzbl %al,%eax
+}
+  80411c:	c9                   	leave
+  80411d:	c3                   	ret
+
+000000000080411e <opencons>:
+opencons(void) {
+  80411e:	55                   	push   %rbp
+  80411f:	48 89 e5             	mov    %rsp,%rbp
+  804122:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804126:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80412a:	48 b8 c8 14 80 00 00 	movabs $0x8014c8,%rax
+  804131:	00 00 00 
+  804134:	ff d0                	call   *%rax
+  804136:	85 c0                	test   %eax,%eax
+  804138:	78 49                	js     804183 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80413a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80413f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804144:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804148:	bf 00 00 00 00       	mov    $0x0,%edi
+  80414d:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  804154:	00 00 00 
+  804157:	ff d0                	call   *%rax
+  804159:	85 c0                	test   %eax,%eax
+  80415b:	78 26                	js     804183 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80415d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804161:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804168:	00 00 
+  80416a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80416c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804170:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804177:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  80417e:	00 00 00 
+  804181:	ff d0                	call   *%rax
+}
+  804183:	c9                   	leave
+  804184:	c3                   	ret
+
+0000000000804185 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804185:	55                   	push   %rbp
+  804186:	48 89 e5             	mov    %rsp,%rbp
+  804189:	41 56                	push   %r14
+  80418b:	41 55                	push   %r13
+  80418d:	41 54                	push   %r12
+  80418f:	53                   	push   %rbx
+  804190:	48 83 ec 50          	sub    $0x50,%rsp
+  804194:	49 89 fc             	mov    %rdi,%r12
+  804197:	41 89 f5             	mov    %esi,%r13d
+  80419a:	48 89 d3             	mov    %rdx,%rbx
+  80419d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041a1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8041a5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8041a9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8041b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041b4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041b8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041bc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041c0:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041c7:	00 00 00 
+  8041ca:	4c 8b 30             	mov    (%rax),%r14
+  8041cd:	48 b8 da 0f 80 00 00 	movabs $0x800fda,%rax
+  8041d4:	00 00 00 
+  8041d7:	ff d0                	call   *%rax
+  8041d9:	89 c6                	mov    %eax,%esi
+  8041db:	45 89 e8             	mov    %r13d,%r8d
+  8041de:	4c 89 e1             	mov    %r12,%rcx
+  8041e1:	4c 89 f2             	mov    %r14,%rdx
+  8041e4:	48 bf 80 4d 80 00 00 	movabs $0x804d80,%rdi
+  8041eb:	00 00 00 
+  8041ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041f3:	49 bc e3 01 80 00 00 	movabs $0x8001e3,%r12
+  8041fa:	00 00 00 
+  8041fd:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804200:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804204:	48 89 df             	mov    %rbx,%rdi
+  804207:	48 b8 7f 01 80 00 00 	movabs $0x80017f,%rax
+  80420e:	00 00 00 
+  804211:	ff d0                	call   *%rax
+    cprintf("\n");
+  804213:	48 bf cf 46 80 00 00 	movabs $0x8046cf,%rdi
+  80421a:	00 00 00 
+  80421d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804222:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804225:	cc                   	int3
+  804226:	eb fd                	jmp    804225 <_panic+0xa0>
+
+0000000000804228 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804228:	55                   	push   %rbp
+  804229:	48 89 e5             	mov    %rsp,%rbp
+  80422c:	41 56                	push   %r14
+  80422e:	41 55                	push   %r13
+  804230:	41 54                	push   %r12
+  804232:	53                   	push   %rbx
+  804233:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804236:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80423d:	00 00 00 
+  804240:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804244:	74 27                	je     80426d <_handle_vectored_pagefault+0x45>
+  804246:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80424b:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804252:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804255:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804258:	4c 89 e7             	mov    %r12,%rdi
+  80425b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804260:	84 c0                	test   %al,%al
+  804262:	75 45                	jne    8042a9 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804264:	48 83 c3 01          	add    $0x1,%rbx
+  804268:	49 3b 1e             	cmp    (%r14),%rbx
+  80426b:	72 eb                	jb     804258 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80426d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804274:	00 
+  804275:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80427a:	4d 8b 04 24          	mov    (%r12),%r8
+  80427e:	48 ba a8 4d 80 00 00 	movabs $0x804da8,%rdx
+  804285:	00 00 00 
+  804288:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80428d:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804294:	00 00 00 
+  804297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429c:	49 ba 85 41 80 00 00 	movabs $0x804185,%r10
+  8042a3:	00 00 00 
+  8042a6:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8042a9:	5b                   	pop    %rbx
+  8042aa:	41 5c                	pop    %r12
+  8042ac:	41 5d                	pop    %r13
+  8042ae:	41 5e                	pop    %r14
+  8042b0:	5d                   	pop    %rbp
+  8042b1:	c3                   	ret
+
+00000000008042b2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042b2:	55                   	push   %rbp
+  8042b3:	48 89 e5             	mov    %rsp,%rbp
+  8042b6:	53                   	push   %rbx
+  8042b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8042bb:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042be:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042c5:	00 00 00 
+  8042c8:	80 38 00             	cmpb   $0x0,(%rax)
+  8042cb:	0f 84 84 00 00 00    	je     804355 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042d1:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042d8:	00 00 00 
+  8042db:	48 8b 10             	mov    (%rax),%rdx
+  8042de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042e3:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042ea:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ed:	48 85 d2             	test   %rdx,%rdx
+  8042f0:	74 19                	je     80430b <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042f2:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042f6:	0f 84 e8 00 00 00    	je     8043e4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042fc:	48 83 c0 01          	add    $0x1,%rax
+  804300:	48 39 d0             	cmp    %rdx,%rax
+  804303:	75 ed                	jne    8042f2 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804305:	48 83 fa 08          	cmp    $0x8,%rdx
+  804309:	74 1c                	je     804327 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80430b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80430f:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804316:	00 00 00 
+  804319:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804320:	00 00 00 
+  804323:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804327:	48 b8 da 0f 80 00 00 	movabs $0x800fda,%rax
+  80432e:	00 00 00 
+  804331:	ff d0                	call   *%rax
+  804333:	89 c7                	mov    %eax,%edi
+  804335:	48 be aa 44 80 00 00 	movabs $0x8044aa,%rsi
+  80433c:	00 00 00 
+  80433f:	48 b8 25 12 80 00 00 	movabs $0x801225,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80434b:	85 c0                	test   %eax,%eax
+  80434d:	78 68                	js     8043b7 <add_pgfault_handler+0x105>
+    return res;
+}
+  80434f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804353:	c9                   	leave
+  804354:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804355:	48 b8 da 0f 80 00 00 	movabs $0x800fda,%rax
+  80435c:	00 00 00 
+  80435f:	ff d0                	call   *%rax
+  804361:	89 c7                	mov    %eax,%edi
+  804363:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804368:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80436d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804374:	00 00 00 
+  804377:	48 b8 67 10 80 00 00 	movabs $0x801067,%rax
+  80437e:	00 00 00 
+  804381:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804383:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80438a:	00 00 00 
+  80438d:	48 8b 02             	mov    (%rdx),%rax
+  804390:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804394:	48 89 0a             	mov    %rcx,(%rdx)
+  804397:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80439e:	00 00 00 
+  8043a1:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8043a5:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043ac:	00 00 00 
+  8043af:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043b2:	e9 70 ff ff ff       	jmp    804327 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043b7:	89 c1                	mov    %eax,%ecx
+  8043b9:	48 ba e6 4d 80 00 00 	movabs $0x804de6,%rdx
+  8043c0:	00 00 00 
+  8043c3:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043c8:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  8043cf:	00 00 00 
+  8043d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d7:	49 b8 85 41 80 00 00 	movabs $0x804185,%r8
+  8043de:	00 00 00 
+  8043e1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e9:	e9 61 ff ff ff       	jmp    80434f <add_pgfault_handler+0x9d>
+
+00000000008043ee <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043ee:	55                   	push   %rbp
+  8043ef:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043f2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043f9:	00 00 00 
+  8043fc:	80 38 00             	cmpb   $0x0,(%rax)
+  8043ff:	74 33                	je     804434 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804401:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804408:	00 00 00 
+  80440b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804410:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804417:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80441a:	48 85 c0             	test   %rax,%rax
+  80441d:	0f 84 85 00 00 00    	je     8044a8 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804423:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804427:	74 40                	je     804469 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804429:	48 83 c1 01          	add    $0x1,%rcx
+  80442d:	48 39 c1             	cmp    %rax,%rcx
+  804430:	75 f1                	jne    804423 <remove_pgfault_handler+0x35>
+  804432:	eb 74                	jmp    8044a8 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804434:	48 b9 fe 4d 80 00 00 	movabs $0x804dfe,%rcx
+  80443b:	00 00 00 
+  80443e:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  804445:	00 00 00 
+  804448:	be 43 00 00 00       	mov    $0x43,%esi
+  80444d:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804454:	00 00 00 
+  804457:	b8 00 00 00 00       	mov    $0x0,%eax
+  80445c:	49 b8 85 41 80 00 00 	movabs $0x804185,%r8
+  804463:	00 00 00 
+  804466:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804469:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804470:	00 
+  804471:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804475:	48 29 ca             	sub    %rcx,%rdx
+  804478:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80447f:	00 00 00 
+  804482:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804486:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80448b:	48 89 ce             	mov    %rcx,%rsi
+  80448e:	48 b8 02 0d 80 00 00 	movabs $0x800d02,%rax
+  804495:	00 00 00 
+  804498:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80449a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044a1:	00 00 00 
+  8044a4:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8044a8:	5d                   	pop    %rbp
+  8044a9:	c3                   	ret
+
+00000000008044aa <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8044aa:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8044ad:	48 b8 28 42 80 00 00 	movabs $0x804228,%rax
+  8044b4:	00 00 00 
+    call *%rax
+  8044b7:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044b9:	41 5f                	pop    %r15
+	popq %r15
+  8044bb:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044bd:	41 5f                	pop    %r15
+	popq %r14
+  8044bf:	41 5e                	pop    %r14
+	popq %r13
+  8044c1:	41 5d                	pop    %r13
+	popq %r12
+  8044c3:	41 5c                	pop    %r12
+	popq %r11
+  8044c5:	41 5b                	pop    %r11
+	popq %r10
+  8044c7:	41 5a                	pop    %r10
+	popq %r9
+  8044c9:	41 59                	pop    %r9
+	popq %r8
+  8044cb:	41 58                	pop    %r8
+	popq %rsi
+  8044cd:	5e                   	pop    %rsi
+	popq %rdi
+  8044ce:	5f                   	pop    %rdi
+	popq %rbp
+  8044cf:	5d                   	pop    %rbp
+	popq %rdx
+  8044d0:	5a                   	pop    %rdx
+	popq %rcx
+  8044d1:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044d2:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044d7:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044dc:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044e0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044e3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044e8:	5b                   	pop    %rbx
+	popq %rax
+  8044e9:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044ea:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044ee:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044ef:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044f4:	c3                   	ret
+
+00000000008044f5 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044f5:	55                   	push   %rbp
+  8044f6:	48 89 e5             	mov    %rsp,%rbp
+  8044f9:	41 55                	push   %r13
+  8044fb:	41 54                	push   %r12
+  8044fd:	53                   	push   %rbx
+  8044fe:	48 83 ec 08          	sub    $0x8,%rsp
+  804502:	49 89 fd             	mov    %rdi,%r13
+  804505:	48 89 f7             	mov    %rsi,%rdi
+  804508:	48 89 d3             	mov    %rdx,%rbx
+  80450b:	49 89 cc             	mov    %rcx,%r12
+  80450e:	4c 89 c2             	mov    %r8,%rdx
+  804511:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804514:	48 85 f6             	test   %rsi,%rsi
+  804517:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80451e:	00 00 00 
+  804521:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804525:	be 00 10 00 00       	mov    $0x1000,%esi
+  80452a:	48 85 db             	test   %rbx,%rbx
+  80452d:	74 03                	je     804532 <ipc_recv_futex+0x3d>
+  80452f:	48 8b 33             	mov    (%rbx),%rsi
+  804532:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804536:	48 b8 b1 12 80 00 00 	movabs $0x8012b1,%rax
+  80453d:	00 00 00 
+  804540:	ff d0                	call   *%rax
+    if (res < 0) {
+  804542:	85 c0                	test   %eax,%eax
+  804544:	78 75                	js     8045bb <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804546:	4d 85 ed             	test   %r13,%r13
+  804549:	74 14                	je     80455f <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80454b:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804552:	00 00 00 
+  804555:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80455b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80455f:	4d 85 e4             	test   %r12,%r12
+  804562:	74 14                	je     804578 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804564:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80456b:	00 00 00 
+  80456e:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804574:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804578:	48 85 db             	test   %rbx,%rbx
+  80457b:	74 23                	je     8045a0 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80457d:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804584:	00 00 00 
+  804587:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80458d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804592:	85 c9                	test   %ecx,%ecx
+  804594:	74 07                	je     80459d <ipc_recv_futex+0xa8>
+  804596:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80459d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8045a0:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8045a7:	00 00 00 
+  8045aa:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045b0:	48 83 c4 08          	add    $0x8,%rsp
+  8045b4:	5b                   	pop    %rbx
+  8045b5:	41 5c                	pop    %r12
+  8045b7:	41 5d                	pop    %r13
+  8045b9:	5d                   	pop    %rbp
+  8045ba:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045bb:	4d 85 ed             	test   %r13,%r13
+  8045be:	74 08                	je     8045c8 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045c0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045c7:	00 
+        if (perm_store != NULL) {
+  8045c8:	4d 85 e4             	test   %r12,%r12
+  8045cb:	74 08                	je     8045d5 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045cd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045d4:	00 
+        if (size != NULL) {
+  8045d5:	48 85 db             	test   %rbx,%rbx
+  8045d8:	74 d6                	je     8045b0 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045da:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045e1:	eb cd                	jmp    8045b0 <ipc_recv_futex+0xbb>
+
+00000000008045e3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045e3:	55                   	push   %rbp
+  8045e4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8045eb:	6a 00                	push   $0x0
+  8045ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045f9:	48 b8 f5 44 80 00 00 	movabs $0x8044f5,%rax
+  804600:	00 00 00 
+  804603:	ff d0                	call   *%rax
+}
+  804605:	c9                   	leave
+  804606:	c3                   	ret
+
+0000000000804607 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804607:	55                   	push   %rbp
+  804608:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80460b:	48 85 d2             	test   %rdx,%rdx
+  80460e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804615:	00 00 00 
+  804618:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80461c:	89 f6                	mov    %esi,%esi
+  80461e:	48 b8 9a 12 80 00 00 	movabs $0x80129a,%rax
+  804625:	00 00 00 
+  804628:	ff d0                	call   *%rax
+    if (res < 0) {
+  80462a:	85 c0                	test   %eax,%eax
+  80462c:	78 02                	js     804630 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80462e:	5d                   	pop    %rbp
+  80462f:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804630:	89 c1                	mov    %eax,%ecx
+  804632:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  804639:	00 00 00 
+  80463c:	be 50 00 00 00       	mov    $0x50,%esi
+  804641:	48 bf 2c 4e 80 00 00 	movabs $0x804e2c,%rdi
+  804648:	00 00 00 
+  80464b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804650:	49 b8 85 41 80 00 00 	movabs $0x804185,%r8
+  804657:	00 00 00 
+  80465a:	41 ff d0             	call   *%r8
+
+000000000080465d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80465d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804662:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804669:	00 00 00 
+  80466c:	48 89 d0             	mov    %rdx,%rax
+  80466f:	48 c1 e0 04          	shl    $0x4,%rax
+  804673:	48 29 d0             	sub    %rdx,%rax
+  804676:	48 c1 e0 05          	shl    $0x5,%rax
+  80467a:	48 01 c8             	add    %rcx,%rax
+  80467d:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804683:	39 f8                	cmp    %edi,%eax
+  804685:	74 13                	je     80469a <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804687:	48 83 c2 01          	add    $0x1,%rdx
+  80468b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804692:	75 d8                	jne    80466c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804694:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804699:	c3                   	ret
+            return envs[i].env_id;
+  80469a:	48 89 d0             	mov    %rdx,%rax
+  80469d:	48 c1 e0 04          	shl    $0x4,%rax
+  8046a1:	48 29 d0             	sub    %rdx,%rax
+  8046a4:	48 c1 e0 05          	shl    $0x5,%rax
+  8046a8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046af:	00 00 00 
+  8046b2:	48 01 d0             	add    %rdx,%rax
+  8046b5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046bb:	c3                   	ret
+  8046bc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008046c0 <__rodata_start>:
+  8046c0:	31 33                	xor    %esi,(%rbx)
+  8046c2:	33 37                	xor    (%rdi),%esi
+  8046c4:	2f                   	(bad)
+  8046c5:	30 20                	xor    %ah,(%rax)
+  8046c7:	69 73 20 25 30 38 78 	imul   $0x78383025,0x20(%rbx),%esi
+  8046ce:	21 0a                	and    %ecx,(%rdx)
+  8046d0:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8046d7:	77 6e                	ja     804747 <__rodata_start+0x87>
+  8046d9:	3e 00 30             	ds add %dh,(%rax)
+  8046dc:	31 32                	xor    %esi,(%rdx)
+  8046de:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046e5:	41                   	rex.B
+  8046e6:	42                   	rex.X
+  8046e7:	43                   	rex.XB
+  8046e8:	44                   	rex.R
+  8046e9:	45                   	rex.RB
+  8046ea:	46 00 30             	rex.RX add %r14b,(%rax)
+  8046ed:	31 32                	xor    %esi,(%rdx)
+  8046ef:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046f6:	61                   	(bad)
+  8046f7:	62 63 64 65 66       	(bad)
+  8046fc:	00 28                	add    %ch,(%rax)
+  8046fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046ff:	75 6c                	jne    80476d <__rodata_start+0xad>
+  804701:	6c                   	insb   (%dx),%es:(%rdi)
+  804702:	29 00                	sub    %eax,(%rax)
+  804704:	65 72 72             	gs jb  804779 <__rodata_start+0xb9>
+  804707:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804708:	72 20                	jb     80472a <__rodata_start+0x6a>
+  80470a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80470f:	73 70                	jae    804781 <__rodata_start+0xc1>
+  804711:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804715:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80471c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80471d:	72 00                	jb     80471f <__rodata_start+0x5f>
+  80471f:	62 61 64 20 65       	(bad)
+  804724:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804725:	76 69                	jbe    804790 <__rodata_start+0xd0>
+  804727:	72 6f                	jb     804798 <__rodata_start+0xd8>
+  804729:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80472a:	6d                   	insl   (%dx),%es:(%rdi)
+  80472b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80472d:	74 00                	je     80472f <__rodata_start+0x6f>
+  80472f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804736:	20 70 61             	and    %dh,0x61(%rax)
+  804739:	72 61                	jb     80479c <__rodata_start+0xdc>
+  80473b:	6d                   	insl   (%dx),%es:(%rdi)
+  80473c:	65 74 65             	gs je  8047a4 <__rodata_start+0xe4>
+  80473f:	72 00                	jb     804741 <__rodata_start+0x81>
+  804741:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804742:	75 74                	jne    8047b8 <__rodata_start+0xf8>
+  804744:	20 6f 66             	and    %ch,0x66(%rdi)
+  804747:	20 6d 65             	and    %ch,0x65(%rbp)
+  80474a:	6d                   	insl   (%dx),%es:(%rdi)
+  80474b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80474c:	72 79                	jb     8047c7 <__rodata_start+0x107>
+  80474e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804751:	74 20                	je     804773 <__rodata_start+0xb3>
+  804753:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804754:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804758:	76 69                	jbe    8047c3 <__rodata_start+0x103>
+  80475a:	72 6f                	jb     8047cb <__rodata_start+0x10b>
+  80475c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80475d:	6d                   	insl   (%dx),%es:(%rdi)
+  80475e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804760:	74 73                	je     8047d5 <__rodata_start+0x115>
+  804762:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804765:	72 72                	jb     8047d9 <__rodata_start+0x119>
+  804767:	75 70                	jne    8047d9 <__rodata_start+0x119>
+  804769:	74 65                	je     8047d0 <__rodata_start+0x110>
+  80476b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804770:	75 67                	jne    8047d9 <__rodata_start+0x119>
+  804772:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804775:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804777:	00 73 65             	add    %dh,0x65(%rbx)
+  80477a:	67 6d                	insl   (%dx),%es:(%edi)
+  80477c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80477e:	74 61                	je     8047e1 <__rodata_start+0x121>
+  804780:	74 69                	je     8047eb <__rodata_start+0x12b>
+  804782:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804783:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804784:	20 66 61             	and    %ah,0x61(%rsi)
+  804787:	75 6c                	jne    8047f5 <__rodata_start+0x135>
+  804789:	74 00                	je     80478b <__rodata_start+0xcb>
+  80478b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804792:	20 45 4c             	and    %al,0x4c(%rbp)
+  804795:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804799:	61                   	(bad)
+  80479a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80479f:	20 73 75             	and    %dh,0x75(%rbx)
+  8047a2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8047a5:	73 79                	jae    804820 <__rodata_start+0x160>
+  8047a7:	73 74                	jae    80481d <__rodata_start+0x15d>
+  8047a9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8047ab:	20 63 61             	and    %ah,0x61(%rbx)
+  8047ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8047af:	6c                   	insb   (%dx),%es:(%rdi)
+  8047b0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047b3:	74 72                	je     804827 <__rodata_start+0x167>
+  8047b5:	79 20                	jns    8047d7 <__rodata_start+0x117>
+  8047b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047b8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047b9:	74 20                	je     8047db <__rodata_start+0x11b>
+  8047bb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047bd:	75 6e                	jne    80482d <__rodata_start+0x16d>
+  8047bf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8047c3:	76 20                	jbe    8047e5 <__rodata_start+0x125>
+  8047c5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047cc:	72 65                	jb     804833 <__rodata_start+0x173>
+  8047ce:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047d1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047d2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047d6:	65 78 70             	gs js  804849 <__rodata_start+0x189>
+  8047d9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8047de:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047e1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8047e5:	20 66 69             	and    %ah,0x69(%rsi)
+  8047e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8047e9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8047ed:	20 66 72             	and    %ah,0x72(%rsi)
+  8047f0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8047f5:	61                   	(bad)
+  8047f6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8047f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047fb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8047ff:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804802:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804803:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804804:	20 6d 61             	and    %ch,0x61(%rbp)
+  804807:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804808:	79 20                	jns    80482a <__rodata_start+0x16a>
+  80480a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804811:	72 65                	jb     804878 <__rodata_start+0x1b8>
+  804813:	20 6f 70             	and    %ch,0x70(%rdi)
+  804816:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804818:	00 66 69             	add    %ah,0x69(%rsi)
+  80481b:	6c                   	insb   (%dx),%es:(%rdi)
+  80481c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804820:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804823:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804824:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804827:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804828:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804829:	74 20                	je     80484b <__rodata_start+0x18b>
+  80482b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80482d:	75 6e                	jne    80489d <__rodata_start+0x1dd>
+  80482f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804833:	76 61                	jbe    804896 <__rodata_start+0x1d6>
+  804835:	6c                   	insb   (%dx),%es:(%rdi)
+  804836:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80483d:	00 
+  80483e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804845:	72 65                	jb     8048ac <__rodata_start+0x1ec>
+  804847:	61                   	(bad)
+  804848:	64 79 20             	fs jns 80486b <__rodata_start+0x1ab>
+  80484b:	65 78 69             	gs js  8048b7 <__rodata_start+0x1f7>
+  80484e:	73 74                	jae    8048c4 <__rodata_start+0x204>
+  804850:	73 00                	jae    804852 <__rodata_start+0x192>
+  804852:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804853:	70 65                	jo     8048ba <__rodata_start+0x1fa>
+  804855:	72 61                	jb     8048b8 <__rodata_start+0x1f8>
+  804857:	74 69                	je     8048c2 <__rodata_start+0x202>
+  804859:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80485a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80485b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80485e:	74 20                	je     804880 <__rodata_start+0x1c0>
+  804860:	73 75                	jae    8048d7 <__rodata_start+0x217>
+  804862:	70 70                	jo     8048d4 <__rodata_start+0x214>
+  804864:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804865:	72 74                	jb     8048db <__rodata_start+0x21b>
+  804867:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  80486d:	20 61 67             	and    %ah,0x67(%rcx)
+  804870:	61                   	(bad)
+  804871:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804878:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  80487c:	74 00                	je     80487e <__rodata_start+0x1be>
+  80487e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804885:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804888:	20 75 73             	and    %dh,0x73(%rbp)
+  80488b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80488f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804896:	00 
+  804897:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  80489e:	00 00 
+  8048a0:	d0 03                	rolb   (%rbx)
+  8048a2:	80 00 00             	addb   $0x0,(%rax)
+  8048a5:	00 00                	add    %al,(%rax)
+  8048a7:	00 11                	add    %dl,(%rcx)
+  8048a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048af:	00 01                	add    %al,(%rcx)
+  8048b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048b7:	00 11                	add    %dl,(%rcx)
+  8048b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048bf:	00 11                	add    %dl,(%rcx)
+  8048c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048c7:	00 11                	add    %dl,(%rcx)
+  8048c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048cf:	00 11                	add    %dl,(%rcx)
+  8048d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048d7:	00 ef                	add    %ch,%bh
+  8048d9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048df:	00 11                	add    %dl,(%rcx)
+  8048e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048e7:	00 11                	add    %dl,(%rcx)
+  8048e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048ef:	00 e3                	add    %ah,%bl
+  8048f1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048f7:	00 5d 04             	add    %bl,0x4(%rbp)
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 11                	add    %dl,(%rcx)
+  804901:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804907:	00 e3                	add    %ah,%bl
+  804909:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80490f:	00 29                	add    %ch,(%rcx)
+  804911:	04 80                	add    $0x80,%al
+  804913:	00 00                	add    %al,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 29                	add    %ch,(%rcx)
+  804919:	04 80                	add    $0x80,%al
+  80491b:	00 00                	add    %al,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 29                	add    %ch,(%rcx)
+  804921:	04 80                	add    $0x80,%al
+  804923:	00 00                	add    %al,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 29                	add    %ch,(%rcx)
+  804929:	04 80                	add    $0x80,%al
+  80492b:	00 00                	add    %al,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 29                	add    %ch,(%rcx)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 29                	add    %ch,(%rcx)
+  804939:	04 80                	add    $0x80,%al
+  80493b:	00 00                	add    %al,(%rax)
+  80493d:	00 00                	add    %al,(%rax)
+  80493f:	00 29                	add    %ch,(%rcx)
+  804941:	04 80                	add    $0x80,%al
+  804943:	00 00                	add    %al,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 29                	add    %ch,(%rcx)
+  804949:	04 80                	add    $0x80,%al
+  80494b:	00 00                	add    %al,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 29                	add    %ch,(%rcx)
+  804951:	04 80                	add    $0x80,%al
+  804953:	00 00                	add    %al,(%rax)
+  804955:	00 00                	add    %al,(%rax)
+  804957:	00 11                	add    %dl,(%rcx)
+  804959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80495f:	00 11                	add    %dl,(%rcx)
+  804961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804967:	00 11                	add    %dl,(%rcx)
+  804969:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80496f:	00 11                	add    %dl,(%rcx)
+  804971:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804977:	00 11                	add    %dl,(%rcx)
+  804979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80497f:	00 11                	add    %dl,(%rcx)
+  804981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804987:	00 11                	add    %dl,(%rcx)
+  804989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80498f:	00 11                	add    %dl,(%rcx)
+  804991:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804997:	00 11                	add    %dl,(%rcx)
+  804999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80499f:	00 11                	add    %dl,(%rcx)
+  8049a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049a7:	00 11                	add    %dl,(%rcx)
+  8049a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049af:	00 11                	add    %dl,(%rcx)
+  8049b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049b7:	00 11                	add    %dl,(%rcx)
+  8049b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049bf:	00 11                	add    %dl,(%rcx)
+  8049c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049c7:	00 11                	add    %dl,(%rcx)
+  8049c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049cf:	00 11                	add    %dl,(%rcx)
+  8049d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049d7:	00 11                	add    %dl,(%rcx)
+  8049d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049df:	00 11                	add    %dl,(%rcx)
+  8049e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049e7:	00 11                	add    %dl,(%rcx)
+  8049e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ef:	00 11                	add    %dl,(%rcx)
+  8049f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049f7:	00 11                	add    %dl,(%rcx)
+  8049f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ff:	00 11                	add    %dl,(%rcx)
+  804a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a07:	00 11                	add    %dl,(%rcx)
+  804a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a0f:	00 11                	add    %dl,(%rcx)
+  804a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a17:	00 11                	add    %dl,(%rcx)
+  804a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a1f:	00 11                	add    %dl,(%rcx)
+  804a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a27:	00 11                	add    %dl,(%rcx)
+  804a29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a2f:	00 11                	add    %dl,(%rcx)
+  804a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a37:	00 11                	add    %dl,(%rcx)
+  804a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a3f:	00 11                	add    %dl,(%rcx)
+  804a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a47:	00 34 09             	add    %dh,(%rcx,%rcx,1)
+  804a4a:	80 00 00             	addb   $0x0,(%rax)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 11                	add    %dl,(%rcx)
+  804a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a57:	00 11                	add    %dl,(%rcx)
+  804a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a5f:	00 11                	add    %dl,(%rcx)
+  804a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a67:	00 11                	add    %dl,(%rcx)
+  804a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a6f:	00 11                	add    %dl,(%rcx)
+  804a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a77:	00 11                	add    %dl,(%rcx)
+  804a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a7f:	00 11                	add    %dl,(%rcx)
+  804a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a87:	00 11                	add    %dl,(%rcx)
+  804a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a8f:	00 11                	add    %dl,(%rcx)
+  804a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a97:	00 11                	add    %dl,(%rcx)
+  804a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a9f:	00 80 04 80 00 00    	add    %al,0x8004(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 4f 06             	add    %cl,0x6(%rdi)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 11                	add    %dl,(%rcx)
+  804ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ab7:	00 11                	add    %dl,(%rcx)
+  804ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804abf:	00 11                	add    %dl,(%rcx)
+  804ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ac7:	00 11                	add    %dl,(%rcx)
+  804ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804acf:	00 af 04 80 00 00    	add    %ch,0x8004(%rdi)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 11                	add    %dl,(%rcx)
+  804ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804adf:	00 11                	add    %dl,(%rcx)
+  804ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ae7:	00 75 04             	add    %dh,0x4(%rbp)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 11                	add    %dl,(%rcx)
+  804af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804af7:	00 11                	add    %dl,(%rcx)
+  804af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aff:	00 f7                	add    %dh,%bh
+  804b01:	07                   	(bad)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 c1                	add    %al,%cl
+  804b09:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804b0f:	00 11                	add    %dl,(%rcx)
+  804b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b17:	00 11                	add    %dl,(%rcx)
+  804b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b1f:	00 46 05             	add    %al,0x5(%rsi)
+  804b22:	80 00 00             	addb   $0x0,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 11                	add    %dl,(%rcx)
+  804b29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b2f:	00 23                	add    %ah,(%rbx)
+  804b31:	07                   	(bad)
+  804b32:	80 00 00             	addb   $0x0,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 11                	add    %dl,(%rcx)
+  804b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b3f:	00 11                	add    %dl,(%rcx)
+  804b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b47:	00 34 09             	add    %dh,(%rcx,%rcx,1)
+  804b4a:	80 00 00             	addb   $0x0,(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 11                	add    %dl,(%rcx)
+  804b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b57:	00 d9                	add    %bl,%cl
+  804b59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b60 <error_string>:
+	...
+  804b68:	0d 47 80 00 00 00 00 00 1f 47 80 00 00 00 00 00     .G.......G......
+  804b78:	2f 47 80 00 00 00 00 00 41 47 80 00 00 00 00 00     /G......AG......
+  804b88:	4f 47 80 00 00 00 00 00 63 47 80 00 00 00 00 00     OG......cG......
+  804b98:	78 47 80 00 00 00 00 00 8b 47 80 00 00 00 00 00     xG.......G......
+  804ba8:	9d 47 80 00 00 00 00 00 b1 47 80 00 00 00 00 00     .G.......G......
+  804bb8:	c1 47 80 00 00 00 00 00 d4 47 80 00 00 00 00 00     .G.......G......
+  804bc8:	eb 47 80 00 00 00 00 00 01 48 80 00 00 00 00 00     .G.......H......
+  804bd8:	19 48 80 00 00 00 00 00 31 48 80 00 00 00 00 00     .H......1H......
+  804be8:	3e 48 80 00 00 00 00 00 18 4c 80 00 00 00 00 00     >H.......L......
+  804bf8:	52 48 80 00 00 00 00 00 6a 48 80 00 00 00 00 00     RH......jH......
+  804c08:	74 48 80 00 00 00 00 00 7e 48 80 00 00 00 00 00     tH......~H......
+  804c18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c38:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c48:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c58:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c68:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c78:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804c88:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804c98:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804ca8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804cb8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804cc8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cd8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804d00 <devtab>:
+  804d00:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804d10:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804d80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804d90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804da0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804db0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804dc0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804dd0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804de0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804df0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804e00:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804e10:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e20:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e30:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
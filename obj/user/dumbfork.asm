@@ -0,0 +1,8423 @@
+
+obj/user/dumbfork:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8b 01 00 00       	call   8001ae <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <dumbfork>:
+        sys_yield();
+    }
+}
+
+envid_t
+dumbfork(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80002e:	b8 08 00 00 00       	mov    $0x8,%eax
+  800033:	0f 05                	syscall
+  800035:	89 c3                	mov    %eax,%ebx
+     * The kernel will initialize it with a copy of our register state,
+     * so that the child will appear to have called sys_exofork() too -
+     * except that in the child, this "fake" call to sys_exofork()
+     * will return 0 instead of the envid of the child. */
+    envid = sys_exofork();
+    if (envid < 0)
+  800037:	85 c0                	test   %eax,%eax
+  800039:	78 4e                	js     800089 <dumbfork+0x64>
+        panic("sys_exofork: %i", envid);
+    if (envid == 0) {
+  80003b:	74 79                	je     8000b6 <dumbfork+0x91>
+        return 0;
+    }
+
+    /* We're the parent.
+     * Eagerly lazily copy our entire address space into the child. */
+    sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE);
+  80003d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  800043:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80004a:	00 00 00 
+  80004d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800052:	89 c2                	mov    %eax,%edx
+  800054:	be 00 00 00 00       	mov    $0x0,%esi
+  800059:	bf 00 00 00 00       	mov    $0x0,%edi
+  80005e:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  800065:	00 00 00 
+  800068:	ff d0                	call   *%rax
+
+    /* Start the child environment running */
+    if ((r = sys_env_set_status(envid, ENV_RUNNABLE)) < 0)
+  80006a:	be 02 00 00 00       	mov    $0x2,%esi
+  80006f:	89 df                	mov    %ebx,%edi
+  800071:	48 b8 57 13 80 00 00 	movabs $0x801357,%rax
+  800078:	00 00 00 
+  80007b:	ff d0                	call   *%rax
+  80007d:	85 c0                	test   %eax,%eax
+  80007f:	78 70                	js     8000f1 <dumbfork+0xcc>
+        panic("sys_env_set_status: %i", r);
+
+    return envid;
+}
+  800081:	89 d8                	mov    %ebx,%eax
+  800083:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800087:	c9                   	leave
+  800088:	c3                   	ret
+        panic("sys_exofork: %i", envid);
+  800089:	89 c1                	mov    %eax,%ecx
+  80008b:	48 ba 10 48 80 00 00 	movabs $0x804810,%rdx
+  800092:	00 00 00 
+  800095:	be 23 00 00 00       	mov    $0x23,%esi
+  80009a:	48 bf 20 48 80 00 00 	movabs $0x804820,%rdi
+  8000a1:	00 00 00 
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  8000b0:	00 00 00 
+  8000b3:	41 ff d0             	call   *%r8
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8000b6:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8000bd:	00 00 00 
+  8000c0:	ff d0                	call   *%rax
+  8000c2:	89 c2                	mov    %eax,%edx
+  8000c4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000ca:	48 89 d0             	mov    %rdx,%rax
+  8000cd:	48 c1 e0 04          	shl    $0x4,%rax
+  8000d1:	48 29 d0             	sub    %rdx,%rax
+  8000d4:	48 c1 e0 05          	shl    $0x5,%rax
+  8000d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000df:	00 00 00 
+  8000e2:	48 01 d0             	add    %rdx,%rax
+  8000e5:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000ec:	00 00 00 
+        return 0;
+  8000ef:	eb 90                	jmp    800081 <dumbfork+0x5c>
+        panic("sys_env_set_status: %i", r);
+  8000f1:	89 c1                	mov    %eax,%ecx
+  8000f3:	48 ba 30 48 80 00 00 	movabs $0x804830,%rdx
+  8000fa:	00 00 00 
+  8000fd:	be 33 00 00 00       	mov    $0x33,%esi
+  800102:	48 bf 20 48 80 00 00 	movabs $0x804820,%rdi
+  800109:	00 00 00 
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800111:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  800118:	00 00 00 
+  80011b:	41 ff d0             	call   *%r8
+
+000000000080011e <umain>:
+umain(int argc, char **argv) {
+  80011e:	55                   	push   %rbp
+  80011f:	48 89 e5             	mov    %rsp,%rbp
+  800122:	41 57                	push   %r15
+  800124:	41 56                	push   %r14
+  800126:	41 55                	push   %r13
+  800128:	41 54                	push   %r12
+  80012a:	53                   	push   %rbx
+  80012b:	48 83 ec 08          	sub    $0x8,%rsp
+    who = dumbfork();
+  80012f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800136:	00 00 00 
+  800139:	ff d0                	call   *%rax
+  80013b:	41 89 c4             	mov    %eax,%r12d
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  80013e:	85 c0                	test   %eax,%eax
+  800140:	49 bd 47 48 80 00 00 	movabs $0x804847,%r13
+  800147:	00 00 00 
+  80014a:	48 b8 4e 48 80 00 00 	movabs $0x80484e,%rax
+  800151:	00 00 00 
+  800154:	4c 0f 44 e8          	cmove  %rax,%r13
+  800158:	bb 00 00 00 00       	mov    $0x0,%ebx
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  80015d:	49 bf d4 03 80 00 00 	movabs $0x8003d4,%r15
+  800164:	00 00 00 
+        sys_yield();
+  800167:	49 be f4 11 80 00 00 	movabs $0x8011f4,%r14
+  80016e:	00 00 00 
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800171:	eb 22                	jmp    800195 <umain+0x77>
+  800173:	83 fb 13             	cmp    $0x13,%ebx
+  800176:	7f 27                	jg     80019f <umain+0x81>
+        cprintf("%d: I am the %s!\n", i, who ? "parent" : "child");
+  800178:	4c 89 ea             	mov    %r13,%rdx
+  80017b:	89 de                	mov    %ebx,%esi
+  80017d:	48 bf 54 48 80 00 00 	movabs $0x804854,%rdi
+  800184:	00 00 00 
+  800187:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018c:	41 ff d7             	call   *%r15
+        sys_yield();
+  80018f:	41 ff d6             	call   *%r14
+    for (int i = 0; i < (who ? 10 : 20); i++) {
+  800192:	83 c3 01             	add    $0x1,%ebx
+  800195:	45 85 e4             	test   %r12d,%r12d
+  800198:	74 d9                	je     800173 <umain+0x55>
+  80019a:	83 fb 09             	cmp    $0x9,%ebx
+  80019d:	7e d9                	jle    800178 <umain+0x5a>
+}
+  80019f:	48 83 c4 08          	add    $0x8,%rsp
+  8001a3:	5b                   	pop    %rbx
+  8001a4:	41 5c                	pop    %r12
+  8001a6:	41 5d                	pop    %r13
+  8001a8:	41 5e                	pop    %r14
+  8001aa:	41 5f                	pop    %r15
+  8001ac:	5d                   	pop    %rbp
+  8001ad:	c3                   	ret
+
+00000000008001ae <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ae:	55                   	push   %rbp
+  8001af:	48 89 e5             	mov    %rsp,%rbp
+  8001b2:	41 56                	push   %r14
+  8001b4:	41 55                	push   %r13
+  8001b6:	41 54                	push   %r12
+  8001b8:	53                   	push   %rbx
+  8001b9:	41 89 fd             	mov    %edi,%r13d
+  8001bc:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bf:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  8001c6:	00 00 00 
+  8001c9:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  8001d0:	00 00 00 
+  8001d3:	48 39 c2             	cmp    %rax,%rdx
+  8001d6:	73 17                	jae    8001ef <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001d8:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001db:	49 89 c4             	mov    %rax,%r12
+  8001de:	48 83 c3 08          	add    $0x8,%rbx
+  8001e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001ea:	4c 39 e3             	cmp    %r12,%rbx
+  8001ed:	72 ef                	jb     8001de <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001ef:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8001f6:	00 00 00 
+  8001f9:	ff d0                	call   *%rax
+  8001fb:	89 c2                	mov    %eax,%edx
+  8001fd:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800203:	48 89 d0             	mov    %rdx,%rax
+  800206:	48 c1 e0 04          	shl    $0x4,%rax
+  80020a:	48 29 d0             	sub    %rdx,%rax
+  80020d:	48 c1 e0 05          	shl    $0x5,%rax
+  800211:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800218:	00 00 00 
+  80021b:	48 01 d0             	add    %rdx,%rax
+  80021e:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800225:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800228:	45 85 ed             	test   %r13d,%r13d
+  80022b:	7e 0d                	jle    80023a <libmain+0x8c>
+  80022d:	49 8b 06             	mov    (%r14),%rax
+  800230:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800237:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80023a:	4c 89 f6             	mov    %r14,%rsi
+  80023d:	44 89 ef             	mov    %r13d,%edi
+  800240:	48 b8 1e 01 80 00 00 	movabs $0x80011e,%rax
+  800247:	00 00 00 
+  80024a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80024c:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+#endif
+}
+  800258:	5b                   	pop    %rbx
+  800259:	41 5c                	pop    %r12
+  80025b:	41 5d                	pop    %r13
+  80025d:	41 5e                	pop    %r14
+  80025f:	5d                   	pop    %rbp
+  800260:	c3                   	ret
+
+0000000000800261 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800261:	55                   	push   %rbp
+  800262:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800265:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  80026c:	00 00 00 
+  80026f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800271:	bf 00 00 00 00       	mov    $0x0,%edi
+  800276:	48 b8 68 11 80 00 00 	movabs $0x801168,%rax
+  80027d:	00 00 00 
+  800280:	ff d0                	call   *%rax
+}
+  800282:	5d                   	pop    %rbp
+  800283:	c3                   	ret
+
+0000000000800284 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800284:	55                   	push   %rbp
+  800285:	48 89 e5             	mov    %rsp,%rbp
+  800288:	41 56                	push   %r14
+  80028a:	41 55                	push   %r13
+  80028c:	41 54                	push   %r12
+  80028e:	53                   	push   %rbx
+  80028f:	48 83 ec 50          	sub    $0x50,%rsp
+  800293:	49 89 fc             	mov    %rdi,%r12
+  800296:	41 89 f5             	mov    %esi,%r13d
+  800299:	48 89 d3             	mov    %rdx,%rbx
+  80029c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002a0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002a4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002a8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002af:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002b3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002b7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002bb:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002bf:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8002c6:	00 00 00 
+  8002c9:	4c 8b 30             	mov    (%rax),%r14
+  8002cc:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8002d3:	00 00 00 
+  8002d6:	ff d0                	call   *%rax
+  8002d8:	89 c6                	mov    %eax,%esi
+  8002da:	45 89 e8             	mov    %r13d,%r8d
+  8002dd:	4c 89 e1             	mov    %r12,%rcx
+  8002e0:	4c 89 f2             	mov    %r14,%rdx
+  8002e3:	48 bf 70 48 80 00 00 	movabs $0x804870,%rdi
+  8002ea:	00 00 00 
+  8002ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f2:	49 bc d4 03 80 00 00 	movabs $0x8003d4,%r12
+  8002f9:	00 00 00 
+  8002fc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002ff:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800303:	48 89 df             	mov    %rbx,%rdi
+  800306:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  80030d:	00 00 00 
+  800310:	ff d0                	call   *%rax
+    cprintf("\n");
+  800312:	48 bf 64 48 80 00 00 	movabs $0x804864,%rdi
+  800319:	00 00 00 
+  80031c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800321:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800324:	cc                   	int3
+  800325:	eb fd                	jmp    800324 <_panic+0xa0>
+
+0000000000800327 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+  80032b:	53                   	push   %rbx
+  80032c:	48 83 ec 08          	sub    $0x8,%rsp
+  800330:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800333:	8b 06                	mov    (%rsi),%eax
+  800335:	8d 50 01             	lea    0x1(%rax),%edx
+  800338:	89 16                	mov    %edx,(%rsi)
+  80033a:	48 98                	cltq
+  80033c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800341:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800347:	74 0a                	je     800353 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800349:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80034d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800351:	c9                   	leave
+  800352:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800353:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800357:	be ff 00 00 00       	mov    $0xff,%esi
+  80035c:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  800363:	00 00 00 
+  800366:	ff d0                	call   *%rax
+        state->offset = 0;
+  800368:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80036e:	eb d9                	jmp    800349 <putch+0x22>
+
+0000000000800370 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800370:	55                   	push   %rbp
+  800371:	48 89 e5             	mov    %rsp,%rbp
+  800374:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80037b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80037e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800385:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80038a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800392:	48 89 f1             	mov    %rsi,%rcx
+  800395:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80039c:	48 bf 27 03 80 00 00 	movabs $0x800327,%rdi
+  8003a3:	00 00 00 
+  8003a6:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  8003ad:	00 00 00 
+  8003b0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003b2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003b9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003c0:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  8003c7:	00 00 00 
+  8003ca:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003cc:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003d2:	c9                   	leave
+  8003d3:	c3                   	ret
+
+00000000008003d4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003d4:	55                   	push   %rbp
+  8003d5:	48 89 e5             	mov    %rsp,%rbp
+  8003d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8003dc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003e0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003e4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003ec:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003f0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003f7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ff:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800403:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800407:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80040b:	48 b8 70 03 80 00 00 	movabs $0x800370,%rax
+  800412:	00 00 00 
+  800415:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800417:	c9                   	leave
+  800418:	c3                   	ret
+
+0000000000800419 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800419:	55                   	push   %rbp
+  80041a:	48 89 e5             	mov    %rsp,%rbp
+  80041d:	41 57                	push   %r15
+  80041f:	41 56                	push   %r14
+  800421:	41 55                	push   %r13
+  800423:	41 54                	push   %r12
+  800425:	53                   	push   %rbx
+  800426:	48 83 ec 18          	sub    $0x18,%rsp
+  80042a:	49 89 fc             	mov    %rdi,%r12
+  80042d:	49 89 f5             	mov    %rsi,%r13
+  800430:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800434:	8b 45 10             	mov    0x10(%rbp),%eax
+  800437:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80043a:	41 89 cf             	mov    %ecx,%r15d
+  80043d:	4c 39 fa             	cmp    %r15,%rdx
+  800440:	73 5b                	jae    80049d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800442:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800446:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80044a:	85 db                	test   %ebx,%ebx
+  80044c:	7e 0e                	jle    80045c <print_num+0x43>
+            putch(padc, put_arg);
+  80044e:	4c 89 ee             	mov    %r13,%rsi
+  800451:	44 89 f7             	mov    %r14d,%edi
+  800454:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800457:	83 eb 01             	sub    $0x1,%ebx
+  80045a:	75 f2                	jne    80044e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80045c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800460:	48 b9 a4 48 80 00 00 	movabs $0x8048a4,%rcx
+  800467:	00 00 00 
+  80046a:	48 b8 93 48 80 00 00 	movabs $0x804893,%rax
+  800471:	00 00 00 
+  800474:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800478:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80047c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800481:	49 f7 f7             	div    %r15
+  800484:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800488:	4c 89 ee             	mov    %r13,%rsi
+  80048b:	41 ff d4             	call   *%r12
+}
+  80048e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800492:	5b                   	pop    %rbx
+  800493:	41 5c                	pop    %r12
+  800495:	41 5d                	pop    %r13
+  800497:	41 5e                	pop    %r14
+  800499:	41 5f                	pop    %r15
+  80049b:	5d                   	pop    %rbp
+  80049c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80049d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004a6:	49 f7 f7             	div    %r15
+  8004a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ad:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004b1:	52                   	push   %rdx
+  8004b2:	45 0f be c9          	movsbl %r9b,%r9d
+  8004b6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004ba:	48 89 c2             	mov    %rax,%rdx
+  8004bd:	48 b8 19 04 80 00 00 	movabs $0x800419,%rax
+  8004c4:	00 00 00 
+  8004c7:	ff d0                	call   *%rax
+  8004c9:	48 83 c4 10          	add    $0x10,%rsp
+  8004cd:	eb 8d                	jmp    80045c <print_num+0x43>
+
+00000000008004cf <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004cf:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004d3:	48 8b 06             	mov    (%rsi),%rax
+  8004d6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004da:	73 0a                	jae    8004e6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004dc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004e0:	48 89 16             	mov    %rdx,(%rsi)
+  8004e3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004e6:	c3                   	ret
+
+00000000008004e7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004e7:	55                   	push   %rbp
+  8004e8:	48 89 e5             	mov    %rsp,%rbp
+  8004eb:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ef:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004f3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004f7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004fb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800502:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80050e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800512:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800516:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  80051d:	00 00 00 
+  800520:	ff d0                	call   *%rax
+}
+  800522:	c9                   	leave
+  800523:	c3                   	ret
+
+0000000000800524 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800524:	55                   	push   %rbp
+  800525:	48 89 e5             	mov    %rsp,%rbp
+  800528:	41 57                	push   %r15
+  80052a:	41 56                	push   %r14
+  80052c:	41 55                	push   %r13
+  80052e:	41 54                	push   %r12
+  800530:	53                   	push   %rbx
+  800531:	48 83 ec 38          	sub    $0x38,%rsp
+  800535:	49 89 fe             	mov    %rdi,%r14
+  800538:	49 89 f5             	mov    %rsi,%r13
+  80053b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80053e:	48 8b 01             	mov    (%rcx),%rax
+  800541:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800545:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800549:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800551:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800555:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800559:	0f b6 3b             	movzbl (%rbx),%edi
+  80055c:	40 80 ff 25          	cmp    $0x25,%dil
+  800560:	74 18                	je     80057a <vprintfmt+0x56>
+            if (!ch) return;
+  800562:	40 84 ff             	test   %dil,%dil
+  800565:	0f 84 b1 06 00 00    	je     800c1c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80056b:	40 0f b6 ff          	movzbl %dil,%edi
+  80056f:	4c 89 ee             	mov    %r13,%rsi
+  800572:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800575:	4c 89 e3             	mov    %r12,%rbx
+  800578:	eb db                	jmp    800555 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80057a:	be 00 00 00 00       	mov    $0x0,%esi
+  80057f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800583:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800588:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80058e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800595:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800599:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80059e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005a3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005a6:	83 e8 23             	sub    $0x23,%eax
+  8005a9:	3c 57                	cmp    $0x57,%al
+  8005ab:	0f 87 51 06 00 00    	ja     800c02 <vprintfmt+0x6de>
+  8005b1:	0f b6 c0             	movzbl %al,%eax
+  8005b4:	48 b9 60 4a 80 00 00 	movabs $0x804a60,%rcx
+  8005bb:	00 00 00 
+  8005be:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005c1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005c4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005c8:	eb cf                	jmp    800599 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005ca:	49 89 dc             	mov    %rbx,%r12
+  8005cd:	be 01 00 00 00       	mov    $0x1,%esi
+  8005d2:	eb c5                	jmp    800599 <vprintfmt+0x75>
+            padc = ch;
+  8005d4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005d8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005db:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005de:	eb b9                	jmp    800599 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e6:	77 24                	ja     80060c <vprintfmt+0xe8>
+  8005e8:	89 c1                	mov    %eax,%ecx
+  8005ea:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005ee:	83 c0 08             	add    $0x8,%eax
+  8005f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005f7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005fa:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005fe:	79 99                	jns    800599 <vprintfmt+0x75>
+                width = precision;
+  800600:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800604:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80060a:	eb 8d                	jmp    800599 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80060c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800610:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800614:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800618:	eb da                	jmp    8005f4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80061a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80061f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800623:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800629:	3c 39                	cmp    $0x39,%al
+  80062b:	77 1c                	ja     800649 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80062d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800631:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800635:	0f b6 c0             	movzbl %al,%eax
+  800638:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80063d:	0f b6 03             	movzbl (%rbx),%eax
+  800640:	3c 39                	cmp    $0x39,%al
+  800642:	76 e9                	jbe    80062d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800644:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800647:	eb b1                	jmp    8005fa <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800649:	49 89 dc             	mov    %rbx,%r12
+  80064c:	eb ac                	jmp    8005fa <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80064e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800651:	85 c9                	test   %ecx,%ecx
+  800653:	b8 00 00 00 00       	mov    $0x0,%eax
+  800658:	0f 49 c1             	cmovns %ecx,%eax
+  80065b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80065e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800661:	e9 33 ff ff ff       	jmp    800599 <vprintfmt+0x75>
+            lflag++;
+  800666:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800669:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80066c:	e9 28 ff ff ff       	jmp    800599 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800671:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800674:	83 f8 2f             	cmp    $0x2f,%eax
+  800677:	77 19                	ja     800692 <vprintfmt+0x16e>
+  800679:	89 c2                	mov    %eax,%edx
+  80067b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067f:	83 c0 08             	add    $0x8,%eax
+  800682:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800685:	8b 3a                	mov    (%rdx),%edi
+  800687:	4c 89 ee             	mov    %r13,%rsi
+  80068a:	41 ff d6             	call   *%r14
+            break;
+  80068d:	e9 c3 fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800692:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800696:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069e:	eb e5                	jmp    800685 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a6:	77 5a                	ja     800702 <vprintfmt+0x1de>
+  8006a8:	89 c2                	mov    %eax,%edx
+  8006aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ae:	83 c0 08             	add    $0x8,%eax
+  8006b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006b4:	8b 02                	mov    (%rdx),%eax
+  8006b6:	89 c1                	mov    %eax,%ecx
+  8006b8:	f7 d9                	neg    %ecx
+  8006ba:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006bd:	83 f9 16             	cmp    $0x16,%ecx
+  8006c0:	7f 4e                	jg     800710 <vprintfmt+0x1ec>
+  8006c2:	48 63 c1             	movslq %ecx,%rax
+  8006c5:	48 ba 20 4d 80 00 00 	movabs $0x804d20,%rdx
+  8006cc:	00 00 00 
+  8006cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006d3:	48 85 c0             	test   %rax,%rax
+  8006d6:	74 38                	je     800710 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006d8:	48 89 c1             	mov    %rax,%rcx
+  8006db:	48 ba f9 4e 80 00 00 	movabs $0x804ef9,%rdx
+  8006e2:	00 00 00 
+  8006e5:	4c 89 ee             	mov    %r13,%rsi
+  8006e8:	4c 89 f7             	mov    %r14,%rdi
+  8006eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f0:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  8006f7:	00 00 00 
+  8006fa:	41 ff d0             	call   *%r8
+  8006fd:	e9 53 fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800702:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800706:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80070a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070e:	eb a4                	jmp    8006b4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800710:	48 ba bc 48 80 00 00 	movabs $0x8048bc,%rdx
+  800717:	00 00 00 
+  80071a:	4c 89 ee             	mov    %r13,%rsi
+  80071d:	4c 89 f7             	mov    %r14,%rdi
+  800720:	b8 00 00 00 00       	mov    $0x0,%eax
+  800725:	49 b8 e7 04 80 00 00 	movabs $0x8004e7,%r8
+  80072c:	00 00 00 
+  80072f:	41 ff d0             	call   *%r8
+  800732:	e9 1e fe ff ff       	jmp    800555 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800737:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073a:	83 f8 2f             	cmp    $0x2f,%eax
+  80073d:	77 6c                	ja     8007ab <vprintfmt+0x287>
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800745:	83 c0 08             	add    $0x8,%eax
+  800748:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80074e:	48 85 d2             	test   %rdx,%rdx
+  800751:	48 b8 b5 48 80 00 00 	movabs $0x8048b5,%rax
+  800758:	00 00 00 
+  80075b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80075f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800763:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800767:	7e 06                	jle    80076f <vprintfmt+0x24b>
+  800769:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80076d:	75 4a                	jne    8007b9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80076f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800773:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800777:	0f b6 00             	movzbl (%rax),%eax
+  80077a:	84 c0                	test   %al,%al
+  80077c:	0f 85 9a 00 00 00    	jne    80081c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800782:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800785:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800789:	85 c0                	test   %eax,%eax
+  80078b:	0f 8e c4 fd ff ff    	jle    800555 <vprintfmt+0x31>
+  800791:	4c 89 ee             	mov    %r13,%rsi
+  800794:	bf 20 00 00 00       	mov    $0x20,%edi
+  800799:	41 ff d6             	call   *%r14
+  80079c:	41 83 ec 01          	sub    $0x1,%r12d
+  8007a0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007a4:	75 eb                	jne    800791 <vprintfmt+0x26d>
+  8007a6:	e9 aa fd ff ff       	jmp    800555 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b7:	eb 92                	jmp    80074b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007b9:	49 63 f7             	movslq %r15d,%rsi
+  8007bc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007c0:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  8007c7:	00 00 00 
+  8007ca:	ff d0                	call   *%rax
+  8007cc:	48 89 c2             	mov    %rax,%rdx
+  8007cf:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007d4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007d7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007da:	85 c0                	test   %eax,%eax
+  8007dc:	7e 91                	jle    80076f <vprintfmt+0x24b>
+  8007de:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007e3:	4c 89 ee             	mov    %r13,%rsi
+  8007e6:	44 89 e7             	mov    %r12d,%edi
+  8007e9:	41 ff d6             	call   *%r14
+  8007ec:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007f0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007f3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007f6:	75 eb                	jne    8007e3 <vprintfmt+0x2bf>
+  8007f8:	e9 72 ff ff ff       	jmp    80076f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007fd:	0f b6 f8             	movzbl %al,%edi
+  800800:	4c 89 ee             	mov    %r13,%rsi
+  800803:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800806:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80080a:	49 83 c4 01          	add    $0x1,%r12
+  80080e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800814:	84 c0                	test   %al,%al
+  800816:	0f 84 66 ff ff ff    	je     800782 <vprintfmt+0x25e>
+  80081c:	45 85 ff             	test   %r15d,%r15d
+  80081f:	78 0a                	js     80082b <vprintfmt+0x307>
+  800821:	41 83 ef 01          	sub    $0x1,%r15d
+  800825:	0f 88 57 ff ff ff    	js     800782 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80082b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80082f:	74 cc                	je     8007fd <vprintfmt+0x2d9>
+  800831:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800834:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800839:	80 fa 5e             	cmp    $0x5e,%dl
+  80083c:	77 c2                	ja     800800 <vprintfmt+0x2dc>
+  80083e:	eb bd                	jmp    8007fd <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800840:	40 84 f6             	test   %sil,%sil
+  800843:	75 26                	jne    80086b <vprintfmt+0x347>
+    switch (lflag) {
+  800845:	85 d2                	test   %edx,%edx
+  800847:	74 59                	je     8008a2 <vprintfmt+0x37e>
+  800849:	83 fa 01             	cmp    $0x1,%edx
+  80084c:	74 7b                	je     8008c9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80084e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800851:	83 f8 2f             	cmp    $0x2f,%eax
+  800854:	0f 87 96 00 00 00    	ja     8008f0 <vprintfmt+0x3cc>
+  80085a:	89 c2                	mov    %eax,%edx
+  80085c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800860:	83 c0 08             	add    $0x8,%eax
+  800863:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800866:	4c 8b 22             	mov    (%rdx),%r12
+  800869:	eb 17                	jmp    800882 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80086b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086e:	83 f8 2f             	cmp    $0x2f,%eax
+  800871:	77 21                	ja     800894 <vprintfmt+0x370>
+  800873:	89 c2                	mov    %eax,%edx
+  800875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800879:	83 c0 08             	add    $0x8,%eax
+  80087c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800882:	4d 85 e4             	test   %r12,%r12
+  800885:	78 7a                	js     800901 <vprintfmt+0x3dd>
+            num = i;
+  800887:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80088a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80088f:	e9 50 02 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a0:	eb dd                	jmp    80087f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 11                	ja     8008bb <vprintfmt+0x397>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b6:	4c 63 22             	movslq (%rdx),%r12
+  8008b9:	eb c7                	jmp    800882 <vprintfmt+0x35e>
+  8008bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c7:	eb ed                	jmp    8008b6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cf:	77 11                	ja     8008e2 <vprintfmt+0x3be>
+  8008d1:	89 c2                	mov    %eax,%edx
+  8008d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d7:	83 c0 08             	add    $0x8,%eax
+  8008da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dd:	4c 8b 22             	mov    (%rdx),%r12
+  8008e0:	eb a0                	jmp    800882 <vprintfmt+0x35e>
+  8008e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ee:	eb ed                	jmp    8008dd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008fc:	e9 65 ff ff ff       	jmp    800866 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800901:	4c 89 ee             	mov    %r13,%rsi
+  800904:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800909:	41 ff d6             	call   *%r14
+                i = -i;
+  80090c:	49 f7 dc             	neg    %r12
+  80090f:	e9 73 ff ff ff       	jmp    800887 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800914:	40 84 f6             	test   %sil,%sil
+  800917:	75 32                	jne    80094b <vprintfmt+0x427>
+    switch (lflag) {
+  800919:	85 d2                	test   %edx,%edx
+  80091b:	74 5d                	je     80097a <vprintfmt+0x456>
+  80091d:	83 fa 01             	cmp    $0x1,%edx
+  800920:	0f 84 82 00 00 00    	je     8009a8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800926:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800929:	83 f8 2f             	cmp    $0x2f,%eax
+  80092c:	0f 87 a5 00 00 00    	ja     8009d7 <vprintfmt+0x4b3>
+  800932:	89 c2                	mov    %eax,%edx
+  800934:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800938:	83 c0 08             	add    $0x8,%eax
+  80093b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800941:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800946:	e9 99 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80094b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80094e:	83 f8 2f             	cmp    $0x2f,%eax
+  800951:	77 19                	ja     80096c <vprintfmt+0x448>
+  800953:	89 c2                	mov    %eax,%edx
+  800955:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800959:	83 c0 08             	add    $0x8,%eax
+  80095c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800962:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800967:	e9 78 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  80096c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800970:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800974:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800978:	eb e5                	jmp    80095f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	77 18                	ja     80099a <vprintfmt+0x476>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800990:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800995:	e9 4a 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  80099a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a6:	eb e6                	jmp    80098e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ae:	77 19                	ja     8009c9 <vprintfmt+0x4a5>
+  8009b0:	89 c2                	mov    %eax,%edx
+  8009b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b6:	83 c0 08             	add    $0x8,%eax
+  8009b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c4:	e9 1b 01 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  8009c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d5:	eb e5                	jmp    8009bc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e3:	e9 56 ff ff ff       	jmp    80093e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009e8:	40 84 f6             	test   %sil,%sil
+  8009eb:	75 2e                	jne    800a1b <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009ed:	85 d2                	test   %edx,%edx
+  8009ef:	74 59                	je     800a4a <vprintfmt+0x526>
+  8009f1:	83 fa 01             	cmp    $0x1,%edx
+  8009f4:	74 7f                	je     800a75 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	0f 87 9f 00 00 00    	ja     800aa1 <vprintfmt+0x57d>
+  800a02:	89 c2                	mov    %eax,%edx
+  800a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a08:	83 c0 08             	add    $0x8,%eax
+  800a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a11:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a16:	e9 c9 00 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a21:	77 19                	ja     800a3c <vprintfmt+0x518>
+  800a23:	89 c2                	mov    %eax,%edx
+  800a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a29:	83 c0 08             	add    $0x8,%eax
+  800a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a32:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a37:	e9 a8 00 00 00       	jmp    800ae4 <vprintfmt+0x5c0>
+  800a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a48:	eb e5                	jmp    800a2f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a50:	77 15                	ja     800a67 <vprintfmt+0x543>
+  800a52:	89 c2                	mov    %eax,%edx
+  800a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a58:	83 c0 08             	add    $0x8,%eax
+  800a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a60:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a65:	eb 7d                	jmp    800ae4 <vprintfmt+0x5c0>
+  800a67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a73:	eb e9                	jmp    800a5e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a78:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7b:	77 16                	ja     800a93 <vprintfmt+0x56f>
+  800a7d:	89 c2                	mov    %eax,%edx
+  800a7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a83:	83 c0 08             	add    $0x8,%eax
+  800a86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a8c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a91:	eb 51                	jmp    800ae4 <vprintfmt+0x5c0>
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e8                	jmp    800a89 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	e9 5c ff ff ff       	jmp    800a0e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ab2:	4c 89 ee             	mov    %r13,%rsi
+  800ab5:	bf 30 00 00 00       	mov    $0x30,%edi
+  800aba:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800abd:	4c 89 ee             	mov    %r13,%rsi
+  800ac0:	bf 78 00 00 00       	mov    $0x78,%edi
+  800ac5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800ac8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800acb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ace:	77 47                	ja     800b17 <vprintfmt+0x5f3>
+  800ad0:	89 c2                	mov    %eax,%edx
+  800ad2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad6:	83 c0 08             	add    $0x8,%eax
+  800ad9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800adc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800adf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ae4:	48 83 ec 08          	sub    $0x8,%rsp
+  800ae8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800aec:	0f 94 c0             	sete   %al
+  800aef:	0f b6 c0             	movzbl %al,%eax
+  800af2:	50                   	push   %rax
+  800af3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800af8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800afc:	4c 89 ee             	mov    %r13,%rsi
+  800aff:	4c 89 f7             	mov    %r14,%rdi
+  800b02:	48 b8 19 04 80 00 00 	movabs $0x800419,%rax
+  800b09:	00 00 00 
+  800b0c:	ff d0                	call   *%rax
+            break;
+  800b0e:	48 83 c4 10          	add    $0x10,%rsp
+  800b12:	e9 3e fa ff ff       	jmp    800555 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b23:	eb b7                	jmp    800adc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b25:	40 84 f6             	test   %sil,%sil
+  800b28:	75 2b                	jne    800b55 <vprintfmt+0x631>
+    switch (lflag) {
+  800b2a:	85 d2                	test   %edx,%edx
+  800b2c:	74 56                	je     800b84 <vprintfmt+0x660>
+  800b2e:	83 fa 01             	cmp    $0x1,%edx
+  800b31:	74 7f                	je     800bb2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b36:	83 f8 2f             	cmp    $0x2f,%eax
+  800b39:	0f 87 a2 00 00 00    	ja     800be1 <vprintfmt+0x6bd>
+  800b3f:	89 c2                	mov    %eax,%edx
+  800b41:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b45:	83 c0 08             	add    $0x8,%eax
+  800b48:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b4b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b53:	eb 8f                	jmp    800ae4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 19                	ja     800b76 <vprintfmt+0x652>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b71:	e9 6e ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800b76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b82:	eb e5                	jmp    800b69 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b87:	83 f8 2f             	cmp    $0x2f,%eax
+  800b8a:	77 18                	ja     800ba4 <vprintfmt+0x680>
+  800b8c:	89 c2                	mov    %eax,%edx
+  800b8e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b92:	83 c0 08             	add    $0x8,%eax
+  800b95:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b98:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9f:	e9 40 ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800ba4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb0:	eb e6                	jmp    800b98 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb8:	77 19                	ja     800bd3 <vprintfmt+0x6af>
+  800bba:	89 c2                	mov    %eax,%edx
+  800bbc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc0:	83 c0 08             	add    $0x8,%eax
+  800bc3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bc6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bc9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bce:	e9 11 ff ff ff       	jmp    800ae4 <vprintfmt+0x5c0>
+  800bd3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bd7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bdf:	eb e5                	jmp    800bc6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800be1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800be9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bed:	e9 59 ff ff ff       	jmp    800b4b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bf2:	4c 89 ee             	mov    %r13,%rsi
+  800bf5:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bfa:	41 ff d6             	call   *%r14
+            break;
+  800bfd:	e9 53 f9 ff ff       	jmp    800555 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c02:	4c 89 ee             	mov    %r13,%rsi
+  800c05:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c0a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c0d:	48 83 eb 01          	sub    $0x1,%rbx
+  800c11:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c15:	75 f6                	jne    800c0d <vprintfmt+0x6e9>
+  800c17:	e9 39 f9 ff ff       	jmp    800555 <vprintfmt+0x31>
+}
+  800c1c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c20:	5b                   	pop    %rbx
+  800c21:	41 5c                	pop    %r12
+  800c23:	41 5d                	pop    %r13
+  800c25:	41 5e                	pop    %r14
+  800c27:	41 5f                	pop    %r15
+  800c29:	5d                   	pop    %rbp
+  800c2a:	c3                   	ret
+
+0000000000800c2b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c2b:	55                   	push   %rbp
+  800c2c:	48 89 e5             	mov    %rsp,%rbp
+  800c2f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c33:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c37:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c3c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c40:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c47:	48 85 ff             	test   %rdi,%rdi
+  800c4a:	74 2b                	je     800c77 <vsnprintf+0x4c>
+  800c4c:	48 85 f6             	test   %rsi,%rsi
+  800c4f:	74 26                	je     800c77 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c51:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c55:	48 bf cf 04 80 00 00 	movabs $0x8004cf,%rdi
+  800c5c:	00 00 00 
+  800c5f:	48 b8 24 05 80 00 00 	movabs $0x800524,%rax
+  800c66:	00 00 00 
+  800c69:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c6b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c6f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c72:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c75:	c9                   	leave
+  800c76:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c77:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c7c:	eb f7                	jmp    800c75 <vsnprintf+0x4a>
+
+0000000000800c7e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c7e:	55                   	push   %rbp
+  800c7f:	48 89 e5             	mov    %rsp,%rbp
+  800c82:	48 83 ec 50          	sub    $0x50,%rsp
+  800c86:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c8a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c8e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c92:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c99:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ca5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ca9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800cad:	48 b8 2b 0c 80 00 00 	movabs $0x800c2b,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cb9:	c9                   	leave
+  800cba:	c3                   	ret
+
+0000000000800cbb <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cbb:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cbe:	74 10                	je     800cd0 <strlen+0x15>
+    size_t n = 0;
+  800cc0:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800cc5:	48 83 c0 01          	add    $0x1,%rax
+  800cc9:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ccd:	75 f6                	jne    800cc5 <strlen+0xa>
+  800ccf:	c3                   	ret
+    size_t n = 0;
+  800cd0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cd6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cde:	48 85 f6             	test   %rsi,%rsi
+  800ce1:	74 11                	je     800cf4 <strnlen+0x1e>
+  800ce3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ce7:	74 0c                	je     800cf5 <strnlen+0x1f>
+  800ce9:	48 83 c2 01          	add    $0x1,%rdx
+  800ced:	48 39 d0             	cmp    %rdx,%rax
+  800cf0:	75 f1                	jne    800ce3 <strnlen+0xd>
+  800cf2:	eb 04                	jmp    800cf8 <strnlen+0x22>
+  800cf4:	c3                   	ret
+  800cf5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cf9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cfc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d01:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d05:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d08:	48 83 c2 01          	add    $0x1,%rdx
+  800d0c:	84 c9                	test   %cl,%cl
+  800d0e:	75 f1                	jne    800d01 <strcpy+0x8>
+        ;
+    return res;
+}
+  800d10:	c3                   	ret
+
+0000000000800d11 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d11:	55                   	push   %rbp
+  800d12:	48 89 e5             	mov    %rsp,%rbp
+  800d15:	41 54                	push   %r12
+  800d17:	53                   	push   %rbx
+  800d18:	48 89 fb             	mov    %rdi,%rbx
+  800d1b:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d1e:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d2a:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d2e:	4c 89 e6             	mov    %r12,%rsi
+  800d31:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  800d38:	00 00 00 
+  800d3b:	ff d0                	call   *%rax
+    return dst;
+}
+  800d3d:	48 89 d8             	mov    %rbx,%rax
+  800d40:	5b                   	pop    %rbx
+  800d41:	41 5c                	pop    %r12
+  800d43:	5d                   	pop    %rbp
+  800d44:	c3                   	ret
+
+0000000000800d45 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d45:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d48:	48 85 d2             	test   %rdx,%rdx
+  800d4b:	74 1f                	je     800d6c <strncpy+0x27>
+  800d4d:	48 01 fa             	add    %rdi,%rdx
+  800d50:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d53:	48 83 c1 01          	add    $0x1,%rcx
+  800d57:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d5b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d5f:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d63:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d67:	48 39 ca             	cmp    %rcx,%rdx
+  800d6a:	75 e7                	jne    800d53 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d6c:	c3                   	ret
+
+0000000000800d6d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d6d:	48 89 f8             	mov    %rdi,%rax
+  800d70:	48 85 d2             	test   %rdx,%rdx
+  800d73:	74 24                	je     800d99 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d75:	48 83 ea 01          	sub    $0x1,%rdx
+  800d79:	74 1b                	je     800d96 <strlcpy+0x29>
+  800d7b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d7f:	0f b6 16             	movzbl (%rsi),%edx
+  800d82:	84 d2                	test   %dl,%dl
+  800d84:	74 10                	je     800d96 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d86:	48 83 c6 01          	add    $0x1,%rsi
+  800d8a:	48 83 c0 01          	add    $0x1,%rax
+  800d8e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d91:	48 39 c8             	cmp    %rcx,%rax
+  800d94:	75 e9                	jne    800d7f <strlcpy+0x12>
+        *dst = '\0';
+  800d96:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d99:	48 29 f8             	sub    %rdi,%rax
+}
+  800d9c:	c3                   	ret
+
+0000000000800d9d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d9d:	0f b6 07             	movzbl (%rdi),%eax
+  800da0:	84 c0                	test   %al,%al
+  800da2:	74 13                	je     800db7 <strcmp+0x1a>
+  800da4:	38 06                	cmp    %al,(%rsi)
+  800da6:	75 0f                	jne    800db7 <strcmp+0x1a>
+  800da8:	48 83 c7 01          	add    $0x1,%rdi
+  800dac:	48 83 c6 01          	add    $0x1,%rsi
+  800db0:	0f b6 07             	movzbl (%rdi),%eax
+  800db3:	84 c0                	test   %al,%al
+  800db5:	75 ed                	jne    800da4 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800db7:	0f b6 c0             	movzbl %al,%eax
+  800dba:	0f b6 16             	movzbl (%rsi),%edx
+  800dbd:	29 d0                	sub    %edx,%eax
+}
+  800dbf:	c3                   	ret
+
+0000000000800dc0 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dc0:	48 85 d2             	test   %rdx,%rdx
+  800dc3:	74 1f                	je     800de4 <strncmp+0x24>
+  800dc5:	0f b6 07             	movzbl (%rdi),%eax
+  800dc8:	84 c0                	test   %al,%al
+  800dca:	74 1e                	je     800dea <strncmp+0x2a>
+  800dcc:	3a 06                	cmp    (%rsi),%al
+  800dce:	75 1a                	jne    800dea <strncmp+0x2a>
+  800dd0:	48 83 c7 01          	add    $0x1,%rdi
+  800dd4:	48 83 c6 01          	add    $0x1,%rsi
+  800dd8:	48 83 ea 01          	sub    $0x1,%rdx
+  800ddc:	75 e7                	jne    800dc5 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de3:	c3                   	ret
+  800de4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800de9:	c3                   	ret
+  800dea:	48 85 d2             	test   %rdx,%rdx
+  800ded:	74 09                	je     800df8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800def:	0f b6 07             	movzbl (%rdi),%eax
+  800df2:	0f b6 16             	movzbl (%rsi),%edx
+  800df5:	29 d0                	sub    %edx,%eax
+  800df7:	c3                   	ret
+    if (!n) return 0;
+  800df8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dfd:	c3                   	ret
+
+0000000000800dfe <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800dfe:	0f b6 17             	movzbl (%rdi),%edx
+  800e01:	84 d2                	test   %dl,%dl
+  800e03:	74 18                	je     800e1d <strchr+0x1f>
+        if (*str == c) {
+  800e05:	0f be d2             	movsbl %dl,%edx
+  800e08:	39 f2                	cmp    %esi,%edx
+  800e0a:	74 17                	je     800e23 <strchr+0x25>
+    for (; *str; str++) {
+  800e0c:	48 83 c7 01          	add    $0x1,%rdi
+  800e10:	0f b6 17             	movzbl (%rdi),%edx
+  800e13:	84 d2                	test   %dl,%dl
+  800e15:	75 ee                	jne    800e05 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e17:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e1c:	c3                   	ret
+  800e1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e22:	c3                   	ret
+  800e23:	48 89 f8             	mov    %rdi,%rax
+}
+  800e26:	c3                   	ret
+
+0000000000800e27 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e27:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e2a:	0f b6 17             	movzbl (%rdi),%edx
+  800e2d:	84 d2                	test   %dl,%dl
+  800e2f:	74 13                	je     800e44 <strfind+0x1d>
+  800e31:	0f be d2             	movsbl %dl,%edx
+  800e34:	39 f2                	cmp    %esi,%edx
+  800e36:	74 0b                	je     800e43 <strfind+0x1c>
+  800e38:	48 83 c0 01          	add    $0x1,%rax
+  800e3c:	0f b6 10             	movzbl (%rax),%edx
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	75 ee                	jne    800e31 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e43:	c3                   	ret
+  800e44:	c3                   	ret
+
+0000000000800e45 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e45:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e48:	48 89 f8             	mov    %rdi,%rax
+  800e4b:	48 f7 d8             	neg    %rax
+  800e4e:	83 e0 07             	and    $0x7,%eax
+  800e51:	49 89 d1             	mov    %rdx,%r9
+  800e54:	49 29 c1             	sub    %rax,%r9
+  800e57:	78 36                	js     800e8f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e59:	40 0f b6 c6          	movzbl %sil,%eax
+  800e5d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e64:	01 01 01 
+  800e67:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e6b:	40 f6 c7 07          	test   $0x7,%dil
+  800e6f:	75 38                	jne    800ea9 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e71:	4c 89 c9             	mov    %r9,%rcx
+  800e74:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e78:	74 0c                	je     800e86 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e7a:	fc                   	cld
+  800e7b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e7e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e82:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e86:	4d 85 c9             	test   %r9,%r9
+  800e89:	75 45                	jne    800ed0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e8b:	4c 89 c0             	mov    %r8,%rax
+  800e8e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e8f:	48 85 d2             	test   %rdx,%rdx
+  800e92:	74 f7                	je     800e8b <memset+0x46>
+  800e94:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e97:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e9a:	48 83 c0 01          	add    $0x1,%rax
+  800e9e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ea2:	48 39 c2             	cmp    %rax,%rdx
+  800ea5:	75 f3                	jne    800e9a <memset+0x55>
+  800ea7:	eb e2                	jmp    800e8b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ea9:	40 f6 c7 01          	test   $0x1,%dil
+  800ead:	74 06                	je     800eb5 <memset+0x70>
+  800eaf:	88 07                	mov    %al,(%rdi)
+  800eb1:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb5:	40 f6 c7 02          	test   $0x2,%dil
+  800eb9:	74 07                	je     800ec2 <memset+0x7d>
+  800ebb:	66 89 07             	mov    %ax,(%rdi)
+  800ebe:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ec2:	40 f6 c7 04          	test   $0x4,%dil
+  800ec6:	74 a9                	je     800e71 <memset+0x2c>
+  800ec8:	89 07                	mov    %eax,(%rdi)
+  800eca:	48 83 c7 04          	add    $0x4,%rdi
+  800ece:	eb a1                	jmp    800e71 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ed0:	41 f6 c1 04          	test   $0x4,%r9b
+  800ed4:	74 06                	je     800edc <memset+0x97>
+  800ed6:	89 07                	mov    %eax,(%rdi)
+  800ed8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800edc:	41 f6 c1 02          	test   $0x2,%r9b
+  800ee0:	74 07                	je     800ee9 <memset+0xa4>
+  800ee2:	66 89 07             	mov    %ax,(%rdi)
+  800ee5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ee9:	41 f6 c1 01          	test   $0x1,%r9b
+  800eed:	74 9c                	je     800e8b <memset+0x46>
+  800eef:	88 07                	mov    %al,(%rdi)
+  800ef1:	eb 98                	jmp    800e8b <memset+0x46>
+
+0000000000800ef3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ef3:	48 89 f8             	mov    %rdi,%rax
+  800ef6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ef9:	48 39 fe             	cmp    %rdi,%rsi
+  800efc:	73 3b                	jae    800f39 <memmove+0x46>
+  800efe:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f02:	48 39 d7             	cmp    %rdx,%rdi
+  800f05:	73 32                	jae    800f39 <memmove+0x46>
+        s += n;
+        d += n;
+  800f07:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f0b:	48 89 d6             	mov    %rdx,%rsi
+  800f0e:	48 09 fe             	or     %rdi,%rsi
+  800f11:	48 09 ce             	or     %rcx,%rsi
+  800f14:	40 f6 c6 07          	test   $0x7,%sil
+  800f18:	75 12                	jne    800f2c <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f1a:	48 83 ef 08          	sub    $0x8,%rdi
+  800f1e:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f22:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f26:	fd                   	std
+  800f27:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f2a:	fc                   	cld
+  800f2b:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f2c:	48 83 ef 01          	sub    $0x1,%rdi
+  800f30:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f34:	fd                   	std
+  800f35:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f37:	eb f1                	jmp    800f2a <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f39:	48 89 f2             	mov    %rsi,%rdx
+  800f3c:	48 09 c2             	or     %rax,%rdx
+  800f3f:	48 09 ca             	or     %rcx,%rdx
+  800f42:	f6 c2 07             	test   $0x7,%dl
+  800f45:	75 0c                	jne    800f53 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f47:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f4b:	48 89 c7             	mov    %rax,%rdi
+  800f4e:	fc                   	cld
+  800f4f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f52:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f53:	48 89 c7             	mov    %rax,%rdi
+  800f56:	fc                   	cld
+  800f57:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f59:	c3                   	ret
+
+0000000000800f5a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f5a:	55                   	push   %rbp
+  800f5b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f5e:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  800f65:	00 00 00 
+  800f68:	ff d0                	call   *%rax
+}
+  800f6a:	5d                   	pop    %rbp
+  800f6b:	c3                   	ret
+
+0000000000800f6c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f6c:	55                   	push   %rbp
+  800f6d:	48 89 e5             	mov    %rsp,%rbp
+  800f70:	41 57                	push   %r15
+  800f72:	41 56                	push   %r14
+  800f74:	41 55                	push   %r13
+  800f76:	41 54                	push   %r12
+  800f78:	53                   	push   %rbx
+  800f79:	48 83 ec 08          	sub    $0x8,%rsp
+  800f7d:	49 89 fe             	mov    %rdi,%r14
+  800f80:	49 89 f7             	mov    %rsi,%r15
+  800f83:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f86:	48 89 f7             	mov    %rsi,%rdi
+  800f89:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  800f90:	00 00 00 
+  800f93:	ff d0                	call   *%rax
+  800f95:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f98:	48 89 de             	mov    %rbx,%rsi
+  800f9b:	4c 89 f7             	mov    %r14,%rdi
+  800f9e:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800fa5:	00 00 00 
+  800fa8:	ff d0                	call   *%rax
+  800faa:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fad:	48 39 c3             	cmp    %rax,%rbx
+  800fb0:	74 36                	je     800fe8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800fb2:	48 89 d8             	mov    %rbx,%rax
+  800fb5:	4c 29 e8             	sub    %r13,%rax
+  800fb8:	49 39 c4             	cmp    %rax,%r12
+  800fbb:	73 31                	jae    800fee <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800fbd:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800fc2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fc6:	4c 89 fe             	mov    %r15,%rsi
+  800fc9:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  800fd0:	00 00 00 
+  800fd3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fd5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fd9:	48 83 c4 08          	add    $0x8,%rsp
+  800fdd:	5b                   	pop    %rbx
+  800fde:	41 5c                	pop    %r12
+  800fe0:	41 5d                	pop    %r13
+  800fe2:	41 5e                	pop    %r14
+  800fe4:	41 5f                	pop    %r15
+  800fe6:	5d                   	pop    %rbp
+  800fe7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fe8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fec:	eb eb                	jmp    800fd9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fee:	48 83 eb 01          	sub    $0x1,%rbx
+  800ff2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ff6:	48 89 da             	mov    %rbx,%rdx
+  800ff9:	4c 89 fe             	mov    %r15,%rsi
+  800ffc:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  801003:	00 00 00 
+  801006:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801008:	49 01 de             	add    %rbx,%r14
+  80100b:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801010:	eb c3                	jmp    800fd5 <strlcat+0x69>
+
+0000000000801012 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801012:	48 85 d2             	test   %rdx,%rdx
+  801015:	74 2d                	je     801044 <memcmp+0x32>
+  801017:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80101c:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801020:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801025:	44 38 c1             	cmp    %r8b,%cl
+  801028:	75 0f                	jne    801039 <memcmp+0x27>
+    while (n-- > 0) {
+  80102a:	48 83 c0 01          	add    $0x1,%rax
+  80102e:	48 39 c2             	cmp    %rax,%rdx
+  801031:	75 e9                	jne    80101c <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801033:	b8 00 00 00 00       	mov    $0x0,%eax
+  801038:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801039:	0f b6 c1             	movzbl %cl,%eax
+  80103c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801040:	44 29 c0             	sub    %r8d,%eax
+  801043:	c3                   	ret
+    return 0;
+  801044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801049:	c3                   	ret
+
+000000000080104a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80104a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80104e:	48 39 c7             	cmp    %rax,%rdi
+  801051:	73 0f                	jae    801062 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801053:	40 38 37             	cmp    %sil,(%rdi)
+  801056:	74 0e                	je     801066 <memfind+0x1c>
+    for (; src < end; src++) {
+  801058:	48 83 c7 01          	add    $0x1,%rdi
+  80105c:	48 39 f8             	cmp    %rdi,%rax
+  80105f:	75 f2                	jne    801053 <memfind+0x9>
+  801061:	c3                   	ret
+  801062:	48 89 f8             	mov    %rdi,%rax
+  801065:	c3                   	ret
+  801066:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801069:	c3                   	ret
+
+000000000080106a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80106a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80106d:	0f b6 37             	movzbl (%rdi),%esi
+  801070:	40 80 fe 20          	cmp    $0x20,%sil
+  801074:	74 06                	je     80107c <strtol+0x12>
+  801076:	40 80 fe 09          	cmp    $0x9,%sil
+  80107a:	75 13                	jne    80108f <strtol+0x25>
+  80107c:	48 83 c7 01          	add    $0x1,%rdi
+  801080:	0f b6 37             	movzbl (%rdi),%esi
+  801083:	40 80 fe 20          	cmp    $0x20,%sil
+  801087:	74 f3                	je     80107c <strtol+0x12>
+  801089:	40 80 fe 09          	cmp    $0x9,%sil
+  80108d:	74 ed                	je     80107c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80108f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801092:	83 e0 fd             	and    $0xfffffffd,%eax
+  801095:	3c 01                	cmp    $0x1,%al
+  801097:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80109b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010a1:	75 0f                	jne    8010b2 <strtol+0x48>
+  8010a3:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010a6:	74 14                	je     8010bc <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010a8:	85 d2                	test   %edx,%edx
+  8010aa:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010af:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010b2:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010b7:	4c 63 ca             	movslq %edx,%r9
+  8010ba:	eb 36                	jmp    8010f2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010bc:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010c0:	74 0f                	je     8010d1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8010c2:	85 d2                	test   %edx,%edx
+  8010c4:	75 ec                	jne    8010b2 <strtol+0x48>
+        s++;
+  8010c6:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010ca:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010cf:	eb e1                	jmp    8010b2 <strtol+0x48>
+        s += 2;
+  8010d1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010d5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010da:	eb d6                	jmp    8010b2 <strtol+0x48>
+            dig -= '0';
+  8010dc:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010df:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010e3:	41 39 d0             	cmp    %edx,%r8d
+  8010e6:	7d 21                	jge    801109 <strtol+0x9f>
+        val = val * base + dig;
+  8010e8:	49 0f af c1          	imul   %r9,%rax
+  8010ec:	0f b6 c9             	movzbl %cl,%ecx
+  8010ef:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010f2:	48 83 c7 01          	add    $0x1,%rdi
+  8010f6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010fa:	80 f9 39             	cmp    $0x39,%cl
+  8010fd:	76 dd                	jbe    8010dc <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010ff:	80 f9 7b             	cmp    $0x7b,%cl
+  801102:	77 05                	ja     801109 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801104:	83 e9 57             	sub    $0x57,%ecx
+  801107:	eb d6                	jmp    8010df <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801109:	4d 85 d2             	test   %r10,%r10
+  80110c:	74 03                	je     801111 <strtol+0xa7>
+  80110e:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801111:	48 89 c2             	mov    %rax,%rdx
+  801114:	48 f7 da             	neg    %rdx
+  801117:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80111b:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80111f:	c3                   	ret
+
+0000000000801120 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801120:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801125:	ba 00 00 00 00       	mov    $0x0,%edx
+  80112a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801130:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801136:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80113c:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80113e:	c3                   	ret
+
+000000000080113f <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80113f:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801144:	bf 00 00 00 00       	mov    $0x0,%edi
+  801149:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80114e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801153:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801159:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80115f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801165:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801167:	c3                   	ret
+
+0000000000801168 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801168:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80116b:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801170:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80117a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80118c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80118e:	48 85 c0             	test   %rax,%rax
+  801191:	7f 01                	jg     801194 <sys_env_destroy+0x2c>
+}
+  801193:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801198:	49 89 c0             	mov    %rax,%r8
+  80119b:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011a0:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8011a7:	00 00 00 
+  8011aa:	be 29 00 00 00       	mov    $0x29,%esi
+  8011af:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8011b6:	00 00 00 
+  8011b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011be:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8011c5:	00 00 00 
+  8011c8:	41 ff d1             	call   *%r9
+
+00000000008011cb <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011cb:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f1:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f3:	c3                   	ret
+
+00000000008011f4 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011f4:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011fe:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801203:	ba 00 00 00 00       	mov    $0x0,%edx
+  801208:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80121a:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80121c:	c3                   	ret
+
+000000000080121d <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80121d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801222:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801229:	00 00 00 
+  80122c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801232:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801238:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80123e:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801240:	c3                   	ret
+
+0000000000801241 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801241:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801244:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801249:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80124f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801255:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801257:	c3                   	ret
+
+0000000000801258 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801258:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801260:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801263:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801269:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80126f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801271:	48 85 c0             	test   %rax,%rax
+  801274:	7f 01                	jg     801277 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801276:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801277:	55                   	push   %rbp
+  801278:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80127b:	49 89 c0             	mov    %rax,%r8
+  80127e:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801283:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  80128a:	00 00 00 
+  80128d:	be 29 00 00 00       	mov    $0x29,%esi
+  801292:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801299:	00 00 00 
+  80129c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a1:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8012a8:	00 00 00 
+  8012ab:	41 ff d1             	call   *%r9
+
+00000000008012ae <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ae:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012b1:	48 63 d2             	movslq %edx,%rdx
+  8012b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012b7:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012bc:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8012bf:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c1:	48 85 c0             	test   %rax,%rax
+  8012c4:	7f 01                	jg     8012c7 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012c6:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012c7:	55                   	push   %rbp
+  8012c8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cb:	49 89 c0             	mov    %rax,%r8
+  8012ce:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012d3:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8012da:	00 00 00 
+  8012dd:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e2:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8012e9:	00 00 00 
+  8012ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f1:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8012f8:	00 00 00 
+  8012fb:	41 ff d1             	call   *%r9
+
+00000000008012fe <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012fe:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801301:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801306:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80130c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801312:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801318:	0f 05                	syscall
+    if (check && ret > 0) {
+  80131a:	48 85 c0             	test   %rax,%rax
+  80131d:	7f 01                	jg     801320 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80131f:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801320:	55                   	push   %rbp
+  801321:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801324:	49 89 c0             	mov    %rax,%r8
+  801327:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80132c:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801333:	00 00 00 
+  801336:	be 29 00 00 00       	mov    $0x29,%esi
+  80133b:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801342:	00 00 00 
+  801345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134a:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801351:	00 00 00 
+  801354:	41 ff d1             	call   *%r9
+
+0000000000801357 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801357:	48 63 f6             	movslq %esi,%rsi
+  80135a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80135d:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801362:	ba 00 00 00 00       	mov    $0x0,%edx
+  801367:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80136d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801373:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801379:	0f 05                	syscall
+    if (check && ret > 0) {
+  80137b:	48 85 c0             	test   %rax,%rax
+  80137e:	7f 01                	jg     801381 <sys_env_set_status+0x2a>
+}
+  801380:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801381:	55                   	push   %rbp
+  801382:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801385:	49 89 c0             	mov    %rax,%r8
+  801388:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80138d:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801394:	00 00 00 
+  801397:	be 29 00 00 00       	mov    $0x29,%esi
+  80139c:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8013a3:	00 00 00 
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ab:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8013b2:	00 00 00 
+  8013b5:	41 ff d1             	call   *%r9
+
+00000000008013b8 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013b8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013d9:	48 85 c0             	test   %rax,%rax
+  8013dc:	7f 01                	jg     8013df <sys_env_set_trapframe+0x27>
+}
+  8013de:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013df:	55                   	push   %rbp
+  8013e0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013e3:	49 89 c0             	mov    %rax,%r8
+  8013e6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013eb:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8013f2:	00 00 00 
+  8013f5:	be 29 00 00 00       	mov    $0x29,%esi
+  8013fa:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801401:	00 00 00 
+  801404:	b8 00 00 00 00       	mov    $0x0,%eax
+  801409:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801410:	00 00 00 
+  801413:	41 ff d1             	call   *%r9
+
+0000000000801416 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801416:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801419:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80141e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801423:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801429:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80142f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801435:	0f 05                	syscall
+    if (check && ret > 0) {
+  801437:	48 85 c0             	test   %rax,%rax
+  80143a:	7f 01                	jg     80143d <sys_env_set_pgfault_upcall+0x27>
+}
+  80143c:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80143d:	55                   	push   %rbp
+  80143e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801441:	49 89 c0             	mov    %rax,%r8
+  801444:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801449:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801450:	00 00 00 
+  801453:	be 29 00 00 00       	mov    $0x29,%esi
+  801458:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  80145f:	00 00 00 
+  801462:	b8 00 00 00 00       	mov    $0x0,%eax
+  801467:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  80146e:	00 00 00 
+  801471:	41 ff d1             	call   *%r9
+
+0000000000801474 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801474:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801477:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80147a:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80147f:	4d 63 c0             	movslq %r8d,%r8
+  801482:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801488:	0f 05                	syscall
+}
+  80148a:	c3                   	ret
+
+000000000080148b <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80148b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80148e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801491:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801496:	4d 63 c0             	movslq %r8d,%r8
+  801499:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80149f:	0f 05                	syscall
+}
+  8014a1:	c3                   	ret
+
+00000000008014a2 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014a2:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a7:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014aa:	45 89 c0             	mov    %r8d,%r8d
+  8014ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014b5:	48 85 c0             	test   %rax,%rax
+  8014b8:	7f 01                	jg     8014bb <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014ba:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8014bb:	55                   	push   %rbp
+  8014bc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014bf:	49 89 c0             	mov    %rax,%r8
+  8014c2:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014c7:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  8014ce:	00 00 00 
+  8014d1:	be 29 00 00 00       	mov    $0x29,%esi
+  8014d6:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  8014dd:	00 00 00 
+  8014e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e5:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  8014ec:	00 00 00 
+  8014ef:	41 ff d1             	call   *%r9
+
+00000000008014f2 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8014f2:	55                   	push   %rbp
+  8014f3:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8014f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014fc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801501:	ba 00 00 00 00       	mov    $0x0,%edx
+  801506:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  80150d:	00 00 00 
+  801510:	ff d0                	call   *%rax
+}
+  801512:	5d                   	pop    %rbp
+  801513:	c3                   	ret
+
+0000000000801514 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801514:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801519:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801523:	ba 00 00 00 00       	mov    $0x0,%edx
+  801528:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801534:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80153a:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80153c:	c3                   	ret
+
+000000000080153d <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80153d:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801542:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801547:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801552:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80155e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 01                	jg     801566 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801565:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156a:	49 89 c0             	mov    %rax,%r8
+  80156d:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801572:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801579:	00 00 00 
+  80157c:	be 29 00 00 00       	mov    $0x29,%esi
+  801581:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801588:	00 00 00 
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801590:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801597:	00 00 00 
+  80159a:	41 ff d1             	call   *%r9
+
+000000000080159d <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80159d:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015c3:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015c5:	c3                   	ret
+
+00000000008015c6 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8015c6:	89 d2                	mov    %edx,%edx
+  8015c8:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ca:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e1:	0f 05                	syscall
+}
+  8015e3:	c3                   	ret
+
+00000000008015e4 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8015e4:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e7:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801603:	0f 05                	syscall
+}
+  801605:	c3                   	ret
+
+0000000000801606 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801606:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801609:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80160e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801613:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801619:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80161f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801625:	0f 05                	syscall
+}
+  801627:	c3                   	ret
+
+0000000000801628 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801628:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80162b:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801630:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801646:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80164e:	48 85 c0             	test   %rax,%rax
+  801651:	7f 01                	jg     801654 <sys_irq_ack+0x2c>
+}
+  801653:	c3                   	ret
+sys_irq_ack(int irq) {
+  801654:	55                   	push   %rbp
+  801655:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801658:	49 89 c0             	mov    %rax,%r8
+  80165b:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801660:	48 ba f8 4d 80 00 00 	movabs $0x804df8,%rdx
+  801667:	00 00 00 
+  80166a:	be 29 00 00 00       	mov    $0x29,%esi
+  80166f:	48 bf 17 4e 80 00 00 	movabs $0x804e17,%rdi
+  801676:	00 00 00 
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	49 b9 84 02 80 00 00 	movabs $0x800284,%r9
+  801685:	00 00 00 
+  801688:	41 ff d1             	call   *%r9
+
+000000000080168b <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80168b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801692:	ff ff ff 
+  801695:	48 01 f8             	add    %rdi,%rax
+  801698:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80169c:	c3                   	ret
+
+000000000080169d <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80169d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016a4:	ff ff ff 
+  8016a7:	48 01 f8             	add    %rdi,%rax
+  8016aa:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016ae:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016b4:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016b8:	c3                   	ret
+
+00000000008016b9 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+  8016bd:	41 57                	push   %r15
+  8016bf:	41 56                	push   %r14
+  8016c1:	41 55                	push   %r13
+  8016c3:	41 54                	push   %r12
+  8016c5:	53                   	push   %rbx
+  8016c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8016ca:	49 89 ff             	mov    %rdi,%r15
+  8016cd:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016d2:	49 bd 48 3e 80 00 00 	movabs $0x803e48,%r13
+  8016d9:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8016dc:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016e2:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016e5:	48 89 df             	mov    %rbx,%rdi
+  8016e8:	41 ff d5             	call   *%r13
+  8016eb:	83 e0 04             	and    $0x4,%eax
+  8016ee:	74 17                	je     801707 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016f0:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016f7:	4c 39 f3             	cmp    %r14,%rbx
+  8016fa:	75 e6                	jne    8016e2 <fd_alloc+0x29>
+  8016fc:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801702:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801707:	4d 89 27             	mov    %r12,(%r15)
+}
+  80170a:	48 83 c4 08          	add    $0x8,%rsp
+  80170e:	5b                   	pop    %rbx
+  80170f:	41 5c                	pop    %r12
+  801711:	41 5d                	pop    %r13
+  801713:	41 5e                	pop    %r14
+  801715:	41 5f                	pop    %r15
+  801717:	5d                   	pop    %rbp
+  801718:	c3                   	ret
+
+0000000000801719 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801719:	83 ff 1f             	cmp    $0x1f,%edi
+  80171c:	77 39                	ja     801757 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80171e:	55                   	push   %rbp
+  80171f:	48 89 e5             	mov    %rsp,%rbp
+  801722:	41 54                	push   %r12
+  801724:	53                   	push   %rbx
+  801725:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801728:	48 63 df             	movslq %edi,%rbx
+  80172b:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801732:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801736:	48 89 df             	mov    %rbx,%rdi
+  801739:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  801740:	00 00 00 
+  801743:	ff d0                	call   *%rax
+  801745:	a8 04                	test   $0x4,%al
+  801747:	74 14                	je     80175d <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801749:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80174d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801752:	5b                   	pop    %rbx
+  801753:	41 5c                	pop    %r12
+  801755:	5d                   	pop    %rbp
+  801756:	c3                   	ret
+        return -E_INVAL;
+  801757:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80175c:	c3                   	ret
+        return -E_INVAL;
+  80175d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801762:	eb ee                	jmp    801752 <fd_lookup+0x39>
+
+0000000000801764 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801764:	55                   	push   %rbp
+  801765:	48 89 e5             	mov    %rsp,%rbp
+  801768:	41 54                	push   %r12
+  80176a:	53                   	push   %rbx
+  80176b:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80176e:	48 b8 c0 4e 80 00 00 	movabs $0x804ec0,%rax
+  801775:	00 00 00 
+  801778:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80177f:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801782:	39 3b                	cmp    %edi,(%rbx)
+  801784:	74 47                	je     8017cd <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801786:	48 83 c0 08          	add    $0x8,%rax
+  80178a:	48 8b 18             	mov    (%rax),%rbx
+  80178d:	48 85 db             	test   %rbx,%rbx
+  801790:	75 f0                	jne    801782 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801792:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801799:	00 00 00 
+  80179c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017a2:	89 fa                	mov    %edi,%edx
+  8017a4:	48 bf 28 4e 80 00 00 	movabs $0x804e28,%rdi
+  8017ab:	00 00 00 
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b3:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  8017ba:	00 00 00 
+  8017bd:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017bf:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8017c4:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8017c8:	5b                   	pop    %rbx
+  8017c9:	41 5c                	pop    %r12
+  8017cb:	5d                   	pop    %rbp
+  8017cc:	c3                   	ret
+            return 0;
+  8017cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017d2:	eb f0                	jmp    8017c4 <dev_lookup+0x60>
+
+00000000008017d4 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8017d4:	55                   	push   %rbp
+  8017d5:	48 89 e5             	mov    %rsp,%rbp
+  8017d8:	41 55                	push   %r13
+  8017da:	41 54                	push   %r12
+  8017dc:	53                   	push   %rbx
+  8017dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8017e1:	48 89 fb             	mov    %rdi,%rbx
+  8017e4:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017e7:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017ee:	ff ff ff 
+  8017f1:	48 01 df             	add    %rbx,%rdi
+  8017f4:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017f8:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017fc:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801803:	00 00 00 
+  801806:	ff d0                	call   *%rax
+  801808:	41 89 c5             	mov    %eax,%r13d
+  80180b:	85 c0                	test   %eax,%eax
+  80180d:	78 06                	js     801815 <fd_close+0x41>
+  80180f:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801813:	74 1a                	je     80182f <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801815:	45 84 e4             	test   %r12b,%r12b
+  801818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181d:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801821:	44 89 e8             	mov    %r13d,%eax
+  801824:	48 83 c4 18          	add    $0x18,%rsp
+  801828:	5b                   	pop    %rbx
+  801829:	41 5c                	pop    %r12
+  80182b:	41 5d                	pop    %r13
+  80182d:	5d                   	pop    %rbp
+  80182e:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80182f:	8b 3b                	mov    (%rbx),%edi
+  801831:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801835:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+  801841:	41 89 c5             	mov    %eax,%r13d
+  801844:	85 c0                	test   %eax,%eax
+  801846:	78 1b                	js     801863 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801848:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80184c:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801850:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801856:	48 85 c0             	test   %rax,%rax
+  801859:	74 08                	je     801863 <fd_close+0x8f>
+  80185b:	48 89 df             	mov    %rbx,%rdi
+  80185e:	ff d0                	call   *%rax
+  801860:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801863:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801868:	48 89 de             	mov    %rbx,%rsi
+  80186b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801870:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801877:	00 00 00 
+  80187a:	ff d0                	call   *%rax
+    return res;
+  80187c:	eb a3                	jmp    801821 <fd_close+0x4d>
+
+000000000080187e <close>:
+
+int
+close(int fdnum) {
+  80187e:	55                   	push   %rbp
+  80187f:	48 89 e5             	mov    %rsp,%rbp
+  801882:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801886:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80188a:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801896:	85 c0                	test   %eax,%eax
+  801898:	78 15                	js     8018af <close+0x31>
+
+    return fd_close(fd, 1);
+  80189a:	be 01 00 00 00       	mov    $0x1,%esi
+  80189f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018a3:	48 b8 d4 17 80 00 00 	movabs $0x8017d4,%rax
+  8018aa:	00 00 00 
+  8018ad:	ff d0                	call   *%rax
+}
+  8018af:	c9                   	leave
+  8018b0:	c3                   	ret
+
+00000000008018b1 <close_all>:
+
+void
+close_all(void) {
+  8018b1:	55                   	push   %rbp
+  8018b2:	48 89 e5             	mov    %rsp,%rbp
+  8018b5:	41 54                	push   %r12
+  8018b7:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018b8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018bd:	49 bc 7e 18 80 00 00 	movabs $0x80187e,%r12
+  8018c4:	00 00 00 
+  8018c7:	89 df                	mov    %ebx,%edi
+  8018c9:	41 ff d4             	call   *%r12
+  8018cc:	83 c3 01             	add    $0x1,%ebx
+  8018cf:	83 fb 20             	cmp    $0x20,%ebx
+  8018d2:	75 f3                	jne    8018c7 <close_all+0x16>
+}
+  8018d4:	5b                   	pop    %rbx
+  8018d5:	41 5c                	pop    %r12
+  8018d7:	5d                   	pop    %rbp
+  8018d8:	c3                   	ret
+
+00000000008018d9 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8018d9:	55                   	push   %rbp
+  8018da:	48 89 e5             	mov    %rsp,%rbp
+  8018dd:	41 57                	push   %r15
+  8018df:	41 56                	push   %r14
+  8018e1:	41 55                	push   %r13
+  8018e3:	41 54                	push   %r12
+  8018e5:	53                   	push   %rbx
+  8018e6:	48 83 ec 18          	sub    $0x18,%rsp
+  8018ea:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018ed:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018f1:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+  8018fd:	89 c3                	mov    %eax,%ebx
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	0f 88 b8 00 00 00    	js     8019bf <dup+0xe6>
+    close(newfdnum);
+  801907:	44 89 e7             	mov    %r12d,%edi
+  80190a:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  801911:	00 00 00 
+  801914:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801916:	4d 63 ec             	movslq %r12d,%r13
+  801919:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801920:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801924:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801928:	4c 89 ff             	mov    %r15,%rdi
+  80192b:	49 be 9d 16 80 00 00 	movabs $0x80169d,%r14
+  801932:	00 00 00 
+  801935:	41 ff d6             	call   *%r14
+  801938:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80193b:	4c 89 ef             	mov    %r13,%rdi
+  80193e:	41 ff d6             	call   *%r14
+  801941:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801944:	48 89 df             	mov    %rbx,%rdi
+  801947:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801953:	a8 04                	test   $0x4,%al
+  801955:	74 2b                	je     801982 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801957:	41 89 c1             	mov    %eax,%r9d
+  80195a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801960:	4c 89 f1             	mov    %r14,%rcx
+  801963:	ba 00 00 00 00       	mov    $0x0,%edx
+  801968:	48 89 de             	mov    %rbx,%rsi
+  80196b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801970:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+  80197c:	89 c3                	mov    %eax,%ebx
+  80197e:	85 c0                	test   %eax,%eax
+  801980:	78 4e                	js     8019d0 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801982:	4c 89 ff             	mov    %r15,%rdi
+  801985:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+  801991:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801994:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80199a:	4c 89 e9             	mov    %r13,%rcx
+  80199d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a2:	4c 89 fe             	mov    %r15,%rsi
+  8019a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019aa:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  8019b1:	00 00 00 
+  8019b4:	ff d0                	call   *%rax
+  8019b6:	89 c3                	mov    %eax,%ebx
+  8019b8:	85 c0                	test   %eax,%eax
+  8019ba:	78 14                	js     8019d0 <dup+0xf7>
+
+    return newfdnum;
+  8019bc:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019bf:	89 d8                	mov    %ebx,%eax
+  8019c1:	48 83 c4 18          	add    $0x18,%rsp
+  8019c5:	5b                   	pop    %rbx
+  8019c6:	41 5c                	pop    %r12
+  8019c8:	41 5d                	pop    %r13
+  8019ca:	41 5e                	pop    %r14
+  8019cc:	41 5f                	pop    %r15
+  8019ce:	5d                   	pop    %rbp
+  8019cf:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019d0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019d5:	4c 89 ee             	mov    %r13,%rsi
+  8019d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019dd:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  8019e4:	00 00 00 
+  8019e7:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019ea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019ef:	4c 89 f6             	mov    %r14,%rsi
+  8019f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019f7:	41 ff d4             	call   *%r12
+    return res;
+  8019fa:	eb c3                	jmp    8019bf <dup+0xe6>
+
+00000000008019fc <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019fc:	55                   	push   %rbp
+  8019fd:	48 89 e5             	mov    %rsp,%rbp
+  801a00:	41 56                	push   %r14
+  801a02:	41 55                	push   %r13
+  801a04:	41 54                	push   %r12
+  801a06:	53                   	push   %rbx
+  801a07:	48 83 ec 10          	sub    $0x10,%rsp
+  801a0b:	89 fb                	mov    %edi,%ebx
+  801a0d:	49 89 f4             	mov    %rsi,%r12
+  801a10:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a13:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a17:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801a1e:	00 00 00 
+  801a21:	ff d0                	call   *%rax
+  801a23:	85 c0                	test   %eax,%eax
+  801a25:	78 4c                	js     801a73 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a27:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a2b:	41 8b 3e             	mov    (%r14),%edi
+  801a2e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a32:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  801a39:	00 00 00 
+  801a3c:	ff d0                	call   *%rax
+  801a3e:	85 c0                	test   %eax,%eax
+  801a40:	78 35                	js     801a77 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a42:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a46:	83 e0 03             	and    $0x3,%eax
+  801a49:	83 f8 01             	cmp    $0x1,%eax
+  801a4c:	74 2d                	je     801a7b <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a52:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a56:	48 85 c0             	test   %rax,%rax
+  801a59:	74 56                	je     801ab1 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a5b:	4c 89 ea             	mov    %r13,%rdx
+  801a5e:	4c 89 e6             	mov    %r12,%rsi
+  801a61:	4c 89 f7             	mov    %r14,%rdi
+  801a64:	ff d0                	call   *%rax
+}
+  801a66:	48 83 c4 10          	add    $0x10,%rsp
+  801a6a:	5b                   	pop    %rbx
+  801a6b:	41 5c                	pop    %r12
+  801a6d:	41 5d                	pop    %r13
+  801a6f:	41 5e                	pop    %r14
+  801a71:	5d                   	pop    %rbp
+  801a72:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a73:	48 98                	cltq
+  801a75:	eb ef                	jmp    801a66 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a77:	48 98                	cltq
+  801a79:	eb eb                	jmp    801a66 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a7b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a82:	00 00 00 
+  801a85:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a8b:	89 da                	mov    %ebx,%edx
+  801a8d:	48 bf 69 4e 80 00 00 	movabs $0x804e69,%rdi
+  801a94:	00 00 00 
+  801a97:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9c:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801aa3:	00 00 00 
+  801aa6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801aa8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801aaf:	eb b5                	jmp    801a66 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ab1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ab8:	eb ac                	jmp    801a66 <read+0x6a>
+
+0000000000801aba <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801aba:	55                   	push   %rbp
+  801abb:	48 89 e5             	mov    %rsp,%rbp
+  801abe:	41 57                	push   %r15
+  801ac0:	41 56                	push   %r14
+  801ac2:	41 55                	push   %r13
+  801ac4:	41 54                	push   %r12
+  801ac6:	53                   	push   %rbx
+  801ac7:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801acb:	48 85 d2             	test   %rdx,%rdx
+  801ace:	74 54                	je     801b24 <readn+0x6a>
+  801ad0:	41 89 fd             	mov    %edi,%r13d
+  801ad3:	49 89 f6             	mov    %rsi,%r14
+  801ad6:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ad9:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ade:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ae3:	49 bf fc 19 80 00 00 	movabs $0x8019fc,%r15
+  801aea:	00 00 00 
+  801aed:	4c 89 e2             	mov    %r12,%rdx
+  801af0:	48 29 f2             	sub    %rsi,%rdx
+  801af3:	4c 01 f6             	add    %r14,%rsi
+  801af6:	44 89 ef             	mov    %r13d,%edi
+  801af9:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801afc:	85 c0                	test   %eax,%eax
+  801afe:	78 20                	js     801b20 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b00:	01 c3                	add    %eax,%ebx
+  801b02:	85 c0                	test   %eax,%eax
+  801b04:	74 08                	je     801b0e <readn+0x54>
+  801b06:	48 63 f3             	movslq %ebx,%rsi
+  801b09:	4c 39 e6             	cmp    %r12,%rsi
+  801b0c:	72 df                	jb     801aed <readn+0x33>
+    }
+    return res;
+  801b0e:	48 63 c3             	movslq %ebx,%rax
+}
+  801b11:	48 83 c4 08          	add    $0x8,%rsp
+  801b15:	5b                   	pop    %rbx
+  801b16:	41 5c                	pop    %r12
+  801b18:	41 5d                	pop    %r13
+  801b1a:	41 5e                	pop    %r14
+  801b1c:	41 5f                	pop    %r15
+  801b1e:	5d                   	pop    %rbp
+  801b1f:	c3                   	ret
+        if (inc < 0) return inc;
+  801b20:	48 98                	cltq
+  801b22:	eb ed                	jmp    801b11 <readn+0x57>
+    int inc = 1, res = 0;
+  801b24:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b29:	eb e3                	jmp    801b0e <readn+0x54>
+
+0000000000801b2b <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b2b:	55                   	push   %rbp
+  801b2c:	48 89 e5             	mov    %rsp,%rbp
+  801b2f:	41 56                	push   %r14
+  801b31:	41 55                	push   %r13
+  801b33:	41 54                	push   %r12
+  801b35:	53                   	push   %rbx
+  801b36:	48 83 ec 10          	sub    $0x10,%rsp
+  801b3a:	89 fb                	mov    %edi,%ebx
+  801b3c:	49 89 f4             	mov    %rsi,%r12
+  801b3f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b42:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b46:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801b4d:	00 00 00 
+  801b50:	ff d0                	call   *%rax
+  801b52:	85 c0                	test   %eax,%eax
+  801b54:	78 47                	js     801b9d <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b56:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b5a:	41 8b 3e             	mov    (%r14),%edi
+  801b5d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b61:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  801b68:	00 00 00 
+  801b6b:	ff d0                	call   *%rax
+  801b6d:	85 c0                	test   %eax,%eax
+  801b6f:	78 30                	js     801ba1 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b71:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b76:	74 2d                	je     801ba5 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b78:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b7c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b80:	48 85 c0             	test   %rax,%rax
+  801b83:	74 56                	je     801bdb <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b85:	4c 89 ea             	mov    %r13,%rdx
+  801b88:	4c 89 e6             	mov    %r12,%rsi
+  801b8b:	4c 89 f7             	mov    %r14,%rdi
+  801b8e:	ff d0                	call   *%rax
+}
+  801b90:	48 83 c4 10          	add    $0x10,%rsp
+  801b94:	5b                   	pop    %rbx
+  801b95:	41 5c                	pop    %r12
+  801b97:	41 5d                	pop    %r13
+  801b99:	41 5e                	pop    %r14
+  801b9b:	5d                   	pop    %rbp
+  801b9c:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b9d:	48 98                	cltq
+  801b9f:	eb ef                	jmp    801b90 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ba1:	48 98                	cltq
+  801ba3:	eb eb                	jmp    801b90 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ba5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801bac:	00 00 00 
+  801baf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bb5:	89 da                	mov    %ebx,%edx
+  801bb7:	48 bf 85 4e 80 00 00 	movabs $0x804e85,%rdi
+  801bbe:	00 00 00 
+  801bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bc6:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801bcd:	00 00 00 
+  801bd0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bd2:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bd9:	eb b5                	jmp    801b90 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bdb:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801be2:	eb ac                	jmp    801b90 <write+0x65>
+
+0000000000801be4 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801be4:	55                   	push   %rbp
+  801be5:	48 89 e5             	mov    %rsp,%rbp
+  801be8:	41 54                	push   %r12
+  801bea:	53                   	push   %rbx
+  801beb:	48 83 ec 10          	sub    $0x10,%rsp
+  801bef:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf1:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801bf5:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801bfc:	00 00 00 
+  801bff:	ff d0                	call   *%rax
+  801c01:	85 c0                	test   %eax,%eax
+  801c03:	78 3e                	js     801c43 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c05:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c09:	41 8b 3c 24          	mov    (%r12),%edi
+  801c0d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c11:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+  801c1d:	85 c0                	test   %eax,%eax
+  801c1f:	78 22                	js     801c43 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c21:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c25:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c29:	48 85 c0             	test   %rax,%rax
+  801c2c:	74 0b                	je     801c39 <seek+0x55>
+  801c2e:	89 de                	mov    %ebx,%esi
+  801c30:	4c 89 e7             	mov    %r12,%rdi
+  801c33:	ff d0                	call   *%rax
+  801c35:	85 c0                	test   %eax,%eax
+  801c37:	78 0a                	js     801c43 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801c39:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801c3e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c43:	48 83 c4 10          	add    $0x10,%rsp
+  801c47:	5b                   	pop    %rbx
+  801c48:	41 5c                	pop    %r12
+  801c4a:	5d                   	pop    %rbp
+  801c4b:	c3                   	ret
+
+0000000000801c4c <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c4c:	55                   	push   %rbp
+  801c4d:	48 89 e5             	mov    %rsp,%rbp
+  801c50:	41 55                	push   %r13
+  801c52:	41 54                	push   %r12
+  801c54:	53                   	push   %rbx
+  801c55:	48 83 ec 18          	sub    $0x18,%rsp
+  801c59:	89 fb                	mov    %edi,%ebx
+  801c5b:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c5e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c62:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801c69:	00 00 00 
+  801c6c:	ff d0                	call   *%rax
+  801c6e:	85 c0                	test   %eax,%eax
+  801c70:	78 38                	js     801caa <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c72:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c76:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c7a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c7e:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  801c85:	00 00 00 
+  801c88:	ff d0                	call   *%rax
+  801c8a:	85 c0                	test   %eax,%eax
+  801c8c:	78 1c                	js     801caa <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c8e:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c93:	74 20                	je     801cb5 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c95:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c99:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c9d:	48 85 c0             	test   %rax,%rax
+  801ca0:	74 47                	je     801ce9 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ca2:	44 89 e6             	mov    %r12d,%esi
+  801ca5:	4c 89 ef             	mov    %r13,%rdi
+  801ca8:	ff d0                	call   *%rax
+}
+  801caa:	48 83 c4 18          	add    $0x18,%rsp
+  801cae:	5b                   	pop    %rbx
+  801caf:	41 5c                	pop    %r12
+  801cb1:	41 5d                	pop    %r13
+  801cb3:	5d                   	pop    %rbp
+  801cb4:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cb5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cbc:	00 00 00 
+  801cbf:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cc5:	89 da                	mov    %ebx,%edx
+  801cc7:	48 bf 48 4e 80 00 00 	movabs $0x804e48,%rdi
+  801cce:	00 00 00 
+  801cd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd6:	48 b9 d4 03 80 00 00 	movabs $0x8003d4,%rcx
+  801cdd:	00 00 00 
+  801ce0:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ce2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ce7:	eb c1                	jmp    801caa <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ce9:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cee:	eb ba                	jmp    801caa <ftruncate+0x5e>
+
+0000000000801cf0 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801cf0:	55                   	push   %rbp
+  801cf1:	48 89 e5             	mov    %rsp,%rbp
+  801cf4:	41 54                	push   %r12
+  801cf6:	53                   	push   %rbx
+  801cf7:	48 83 ec 10          	sub    $0x10,%rsp
+  801cfb:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfe:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d02:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+  801d0e:	85 c0                	test   %eax,%eax
+  801d10:	78 4e                	js     801d60 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d12:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d16:	41 8b 3c 24          	mov    (%r12),%edi
+  801d1a:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d1e:	48 b8 64 17 80 00 00 	movabs $0x801764,%rax
+  801d25:	00 00 00 
+  801d28:	ff d0                	call   *%rax
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 32                	js     801d60 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d2e:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d32:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d37:	74 30                	je     801d69 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d39:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d3c:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d43:	00 00 00 
+    stat->st_isdir = 0;
+  801d46:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d4d:	00 00 00 
+    stat->st_dev = dev;
+  801d50:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d57:	48 89 de             	mov    %rbx,%rsi
+  801d5a:	4c 89 e7             	mov    %r12,%rdi
+  801d5d:	ff 50 28             	call   *0x28(%rax)
+}
+  801d60:	48 83 c4 10          	add    $0x10,%rsp
+  801d64:	5b                   	pop    %rbx
+  801d65:	41 5c                	pop    %r12
+  801d67:	5d                   	pop    %rbp
+  801d68:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d69:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d6e:	eb f0                	jmp    801d60 <fstat+0x70>
+
+0000000000801d70 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d70:	55                   	push   %rbp
+  801d71:	48 89 e5             	mov    %rsp,%rbp
+  801d74:	41 54                	push   %r12
+  801d76:	53                   	push   %rbx
+  801d77:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d7a:	be 00 00 00 00       	mov    $0x0,%esi
+  801d7f:	48 b8 de 2e 80 00 00 	movabs $0x802ede,%rax
+  801d86:	00 00 00 
+  801d89:	ff d0                	call   *%rax
+  801d8b:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d8d:	85 c0                	test   %eax,%eax
+  801d8f:	78 25                	js     801db6 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d91:	4c 89 e6             	mov    %r12,%rsi
+  801d94:	89 c7                	mov    %eax,%edi
+  801d96:	48 b8 f0 1c 80 00 00 	movabs $0x801cf0,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801da5:	89 df                	mov    %ebx,%edi
+  801da7:	48 b8 7e 18 80 00 00 	movabs $0x80187e,%rax
+  801dae:	00 00 00 
+  801db1:	ff d0                	call   *%rax
+
+    return res;
+  801db3:	44 89 e3             	mov    %r12d,%ebx
+}
+  801db6:	89 d8                	mov    %ebx,%eax
+  801db8:	5b                   	pop    %rbx
+  801db9:	41 5c                	pop    %r12
+  801dbb:	5d                   	pop    %rbp
+  801dbc:	c3                   	ret
+
+0000000000801dbd <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dbd:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801dc4:	00 00 00 
+  801dc7:	83 38 00             	cmpl   $0x0,(%rax)
+  801dca:	74 0a                	je     801dd6 <fsenv+0x19>
+    return envid;
+}
+  801dcc:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801dd3:	00 00 
+  801dd5:	c3                   	ret
+fsenv(void) {
+  801dd6:	55                   	push   %rbp
+  801dd7:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dda:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ddf:	48 b8 ab 47 80 00 00 	movabs $0x8047ab,%rax
+  801de6:	00 00 00 
+  801de9:	ff d0                	call   *%rax
+  801deb:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801df2:	00 00 
+}
+  801df4:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801dfb:	00 00 
+  801dfd:	5d                   	pop    %rbp
+  801dfe:	c3                   	ret
+
+0000000000801dff <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801dff:	55                   	push   %rbp
+  801e00:	48 89 e5             	mov    %rsp,%rbp
+  801e03:	41 54                	push   %r12
+  801e05:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e06:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e0b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e10:	48 89 de             	mov    %rbx,%rsi
+  801e13:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e18:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801e1f:	00 00 00 
+  801e22:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e24:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e2b:	00 00 00 
+  801e2e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e34:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801e39:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e3e:	48 89 de             	mov    %rbx,%rsi
+  801e41:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e46:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  801e4d:	00 00 00 
+  801e50:	ff d0                	call   *%rax
+  801e52:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	0f 88 a2 00 00 00    	js     801efe <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e5c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e63:	00 00 00 
+  801e66:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e6c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e71:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e73:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e78:	49 bc 10 40 80 00 00 	movabs $0x804010,%r12
+  801e7f:	00 00 00 
+  801e82:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e85:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e8a:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e8d:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  801e94:	00 00 00 
+  801e97:	ff d0                	call   *%rax
+  801e99:	89 c7                	mov    %eax,%edi
+  801e9b:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801ea1:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ea6:	48 89 da             	mov    %rbx,%rdx
+  801ea9:	be 09 00 00 00       	mov    $0x9,%esi
+  801eae:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  801eb5:	00 00 00 
+  801eb8:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801eba:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ebf:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec4:	be 00 00 00 00       	mov    $0x0,%esi
+  801ec9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ece:	48 b8 31 47 80 00 00 	movabs $0x804731,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+  801eda:	89 c3                	mov    %eax,%ebx
+  801edc:	85 c0                	test   %eax,%eax
+  801ede:	78 25                	js     801f05 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801ee0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ee7:	00 00 00 
+  801eea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ef0:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801ef7:	00 00 
+    return 0;
+  801ef9:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801efe:	89 d8                	mov    %ebx,%eax
+  801f00:	5b                   	pop    %rbx
+  801f01:	41 5c                	pop    %r12
+  801f03:	5d                   	pop    %rbp
+  801f04:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f05:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f0a:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f14:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+        return res;
+  801f20:	eb dc                	jmp    801efe <fschan_setup+0xff>
+
+0000000000801f22 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f22:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f29:	00 00 00 
+  801f2c:	80 38 00             	cmpb   $0x0,(%rax)
+  801f2f:	74 55                	je     801f86 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f31:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f38:	00 00 00 
+  801f3b:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801f41:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f46:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801f4d:	00 00 00 
+  801f50:	3b 0a                	cmp    (%rdx),%ecx
+  801f52:	75 01                	jne    801f55 <fschan+0x33>
+}
+  801f54:	c3                   	ret
+fschan(void) {
+  801f55:	55                   	push   %rbp
+  801f56:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f59:	48 b8 ff 1d 80 00 00 	movabs $0x801dff,%rax
+  801f60:	00 00 00 
+  801f63:	ff d0                	call   *%rax
+  801f65:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f67:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f6c:	85 d2                	test   %edx,%edx
+  801f6e:	78 02                	js     801f72 <fschan+0x50>
+}
+  801f70:	5d                   	pop    %rbp
+  801f71:	c3                   	ret
+        fschan_enabled = 0;
+  801f72:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f79:	00 00 00 
+  801f7c:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f7f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f84:	eb ea                	jmp    801f70 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f86:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f8b:	c3                   	ret
+
+0000000000801f8c <fbuf>:
+fbuf(struct Fd *fd) {
+  801f8c:	55                   	push   %rbp
+  801f8d:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f90:	48 b8 8b 16 80 00 00 	movabs $0x80168b,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fa1:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801fa5:	77 12                	ja     801fb9 <fbuf+0x2d>
+  801fa7:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801fab:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801fb2:	00 00 00 
+  801fb5:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801fb9:	48 89 d0             	mov    %rdx,%rax
+  801fbc:	5d                   	pop    %rbp
+  801fbd:	c3                   	ret
+
+0000000000801fbe <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801fc2:	48 83 c7 40          	add    $0x40,%rdi
+  801fc6:	48 b8 4a 40 80 00 00 	movabs $0x80404a,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+  801fd2:	84 c0                	test   %al,%al
+  801fd4:	75 02                	jne    801fd8 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801fd6:	5d                   	pop    %rbp
+  801fd7:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801fd8:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	89 c7                	mov    %eax,%edi
+  801fe6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fec:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff6:	be 0a 00 00 00       	mov    $0xa,%esi
+  801ffb:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  802002:	00 00 00 
+  802005:	ff d0                	call   *%rax
+}
+  802007:	eb cd                	jmp    801fd6 <fschan_publish+0x18>
+
+0000000000802009 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802009:	55                   	push   %rbp
+  80200a:	48 89 e5             	mov    %rsp,%rbp
+  80200d:	41 57                	push   %r15
+  80200f:	41 56                	push   %r14
+  802011:	41 55                	push   %r13
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	48 83 ec 48          	sub    $0x48,%rsp
+  80201a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80201e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802022:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802025:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802029:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80202c:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802033:	00 00 00 
+  802036:	8b 02                	mov    (%rdx),%eax
+  802038:	83 c0 01             	add    $0x1,%eax
+  80203b:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802040:	0f 44 c1             	cmove  %ecx,%eax
+  802043:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802045:	4d 85 c0             	test   %r8,%r8
+  802048:	74 2c                	je     802076 <fschan_rw+0x6d>
+  80204a:	45 89 ce             	mov    %r9d,%r14d
+  80204d:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802054:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802058:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80205e:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802065:	00 
+  802066:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80206c:	b8 01 00 00 00       	mov    $0x1,%eax
+  802071:	e9 41 01 00 00       	jmp    8021b7 <fschan_rw+0x1ae>
+  802076:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80207a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80207e:	e9 9c 01 00 00       	jmp    80221f <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802083:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802087:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80208a:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80208d:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802090:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802094:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802098:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80209c:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8020a0:	48 89 da             	mov    %rbx,%rdx
+  8020a3:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8020af:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020b3:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+            queued += blk;
+  8020bf:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8020c2:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8020c6:	4d 39 fc             	cmp    %r15,%r12
+  8020c9:	73 6b                	jae    802136 <fschan_rw+0x12d>
+  8020cb:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8020cf:	77 65                	ja     802136 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8020d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020d5:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8020d9:	48 b8 25 40 80 00 00 	movabs $0x804025,%rax
+  8020e0:	00 00 00 
+  8020e3:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8020e5:	4c 89 fb             	mov    %r15,%rbx
+  8020e8:	4c 29 e3             	sub    %r12,%rbx
+  8020eb:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8020f0:	48 39 d3             	cmp    %rdx,%rbx
+  8020f3:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8020f7:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8020fb:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8020ff:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802103:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802106:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802108:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80210f:	00 00 00 
+  802112:	8b 09                	mov    (%rcx),%ecx
+  802114:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802117:	83 fe 03             	cmp    $0x3,%esi
+  80211a:	0f 85 63 ff ff ff    	jne    802083 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802120:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802124:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802127:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80212a:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80212d:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802131:	e9 79 ff ff ff       	jmp    8020af <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802136:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80213a:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802141:	48 89 df             	mov    %rbx,%rdi
+  802144:	48 b8 e8 40 80 00 00 	movabs $0x8040e8,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802150:	48 89 df             	mov    %rbx,%rdi
+  802153:	48 b8 76 40 80 00 00 	movabs $0x804076,%rax
+  80215a:	00 00 00 
+  80215d:	ff d0                	call   *%rax
+  80215f:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802163:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802167:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80216b:	75 25                	jne    802192 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80216d:	8b 40 04             	mov    0x4(%rax),%eax
+  802170:	85 c0                	test   %eax,%eax
+  802172:	0f 88 86 00 00 00    	js     8021fe <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802178:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80217c:	74 5b                	je     8021d9 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80217e:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802182:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802186:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80218a:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80218e:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802192:	48 89 df             	mov    %rbx,%rdi
+  802195:	48 b8 9d 40 80 00 00 	movabs $0x80409d,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8021a1:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8021a5:	83 f0 01             	xor    $0x1,%eax
+  8021a8:	4d 39 fc             	cmp    %r15,%r12
+  8021ab:	0f 92 c2             	setb   %dl
+  8021ae:	84 c2                	test   %al,%dl
+  8021b0:	75 05                	jne    8021b7 <fschan_rw+0x1ae>
+  8021b2:	45 85 ed             	test   %r13d,%r13d
+  8021b5:	74 50                	je     802207 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021b7:	4d 39 fc             	cmp    %r15,%r12
+  8021ba:	0f 92 c1             	setb   %cl
+  8021bd:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8021c1:	0f 96 c2             	setbe  %dl
+  8021c4:	84 d1                	test   %dl,%cl
+  8021c6:	0f 84 6a ff ff ff    	je     802136 <fschan_rw+0x12d>
+  8021cc:	84 c0                	test   %al,%al
+  8021ce:	0f 85 fd fe ff ff    	jne    8020d1 <fschan_rw+0xc8>
+  8021d4:	e9 5d ff ff ff       	jmp    802136 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021d9:	48 63 d0             	movslq %eax,%rdx
+  8021dc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8021e0:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8021e4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021e8:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8021ec:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8021f0:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  8021f7:	00 00 00 
+  8021fa:	ff d0                	call   *%rax
+  8021fc:	eb 80                	jmp    80217e <fschan_rw+0x175>
+                err = msg->fm_res;
+  8021fe:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802201:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802205:	eb 8b                	jmp    802192 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802207:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80220c:	0f 85 68 fe ff ff    	jne    80207a <fschan_rw+0x71>
+  802212:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802215:	85 c0                	test   %eax,%eax
+  802217:	0f 84 5d fe ff ff    	je     80207a <fschan_rw+0x71>
+  80221d:	48 98                	cltq
+}
+  80221f:	48 83 c4 48          	add    $0x48,%rsp
+  802223:	5b                   	pop    %rbx
+  802224:	41 5c                	pop    %r12
+  802226:	41 5d                	pop    %r13
+  802228:	41 5e                	pop    %r14
+  80222a:	41 5f                	pop    %r15
+  80222c:	5d                   	pop    %rbp
+  80222d:	c3                   	ret
+
+000000000080222e <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80222e:	55                   	push   %rbp
+  80222f:	48 89 e5             	mov    %rsp,%rbp
+  802232:	41 56                	push   %r14
+  802234:	41 55                	push   %r13
+  802236:	41 54                	push   %r12
+  802238:	53                   	push   %rbx
+  802239:	48 83 ec 10          	sub    $0x10,%rsp
+  80223d:	49 89 fe             	mov    %rdi,%r14
+  802240:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802243:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802247:	48 29 f3             	sub    %rsi,%rbx
+  80224a:	48 39 d3             	cmp    %rdx,%rbx
+  80224d:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802251:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802258:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802259:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80225e:	49 bd a7 3e 80 00 00 	movabs $0x803ea7,%r13
+  802265:	00 00 00 
+  802268:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80226f:	76 1e                	jbe    80228f <mmap_fault+0x61>
+  802271:	4c 01 e7             	add    %r12,%rdi
+  802274:	41 ff d5             	call   *%r13
+  802277:	84 c0                	test   %al,%al
+  802279:	75 14                	jne    80228f <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80227b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80227f:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802286:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80228a:	48 39 df             	cmp    %rbx,%rdi
+  80228d:	72 e2                	jb     802271 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80228f:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802296:	00 00 00 
+  802299:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022a0:	00 00 00 
+  8022a3:	4c 89 f0             	mov    %r14,%rax
+  8022a6:	48 29 d0             	sub    %rdx,%rax
+  8022a9:	48 c1 f8 03          	sar    $0x3,%rax
+  8022ad:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8022b4:	aa aa aa 
+  8022b7:	48 0f af c2          	imul   %rdx,%rax
+  8022bb:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022bf:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8022c4:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8022c8:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8022ca:	44 89 e0             	mov    %r12d,%eax
+  8022cd:	41 03 46 10          	add    0x10(%r14),%eax
+  8022d1:	41 2b 06             	sub    (%r14),%eax
+  8022d4:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8022d7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022db:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8022df:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8022e3:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8022e6:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  8022ed:	00 00 00 
+  8022f0:	ff d0                	call   *%rax
+  8022f2:	89 c7                	mov    %eax,%edi
+  8022f4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022fa:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022ff:	48 89 da             	mov    %rbx,%rdx
+  802302:	be 0f 00 00 00       	mov    $0xf,%esi
+  802307:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802313:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802318:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80231c:	4c 89 e6             	mov    %r12,%rsi
+  80231f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802324:	48 b8 31 47 80 00 00 	movabs $0x804731,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	48 98                	cltq
+}
+  802332:	48 83 c4 10          	add    $0x10,%rsp
+  802336:	5b                   	pop    %rbx
+  802337:	41 5c                	pop    %r12
+  802339:	41 5d                	pop    %r13
+  80233b:	41 5e                	pop    %r14
+  80233d:	5d                   	pop    %rbp
+  80233e:	c3                   	ret
+
+000000000080233f <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80233f:	48 8b 37             	mov    (%rdi),%rsi
+  802342:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802349:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802350:	00 00 00 
+  802353:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802358:	eb 0f                	jmp    802369 <mmap_pgfault+0x2a>
+  80235a:	c3                   	ret
+  80235b:	48 83 c1 01          	add    $0x1,%rcx
+  80235f:	48 83 c2 18          	add    $0x18,%rdx
+  802363:	48 83 f9 20          	cmp    $0x20,%rcx
+  802367:	74 6e                	je     8023d7 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802369:	48 8b 02             	mov    (%rdx),%rax
+  80236c:	48 83 e8 01          	sub    $0x1,%rax
+  802370:	48 39 f0             	cmp    %rsi,%rax
+  802373:	73 e6                	jae    80235b <mmap_pgfault+0x1c>
+  802375:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802379:	73 e0                	jae    80235b <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80237b:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80237f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802384:	f6 c2 01             	test   $0x1,%dl
+  802387:	75 d1                	jne    80235a <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802389:	f6 c2 02             	test   $0x2,%dl
+  80238c:	74 1a                	je     8023a8 <mmap_pgfault+0x69>
+  80238e:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802392:	b8 00 00 00 00       	mov    $0x0,%eax
+  802397:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80239e:	00 00 00 
+  8023a1:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8023a6:	74 35                	je     8023dd <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8023a8:	55                   	push   %rbp
+  8023a9:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023ac:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023b0:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023b7:	00 00 00 
+  8023ba:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8023be:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8023c3:	48 b8 2e 22 80 00 00 	movabs $0x80222e,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+  8023cf:	48 85 c0             	test   %rax,%rax
+  8023d2:	0f 9f c0             	setg   %al
+}
+  8023d5:	5d                   	pop    %rbp
+  8023d6:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023dc:	c3                   	ret
+}
+  8023dd:	c3                   	ret
+
+00000000008023de <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8023de:	55                   	push   %rbp
+  8023df:	48 89 e5             	mov    %rsp,%rbp
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023e8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023ef:	00 00 00 
+  8023f2:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8023f7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8023fb:	74 15                	je     802412 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023fd:	48 83 c3 01          	add    $0x1,%rbx
+  802401:	48 83 c0 18          	add    $0x18,%rax
+  802405:	48 83 fb 20          	cmp    $0x20,%rbx
+  802409:	75 ec                	jne    8023f7 <mmap_alloc+0x19>
+    return NULL;
+  80240b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802410:	eb 52                	jmp    802464 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802412:	4c 89 e7             	mov    %r12,%rdi
+  802415:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  80241c:	00 00 00 
+  80241f:	ff d0                	call   *%rax
+  802421:	41 89 c1             	mov    %eax,%r9d
+  802424:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80242b:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80242f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80243a:	4c 89 e6             	mov    %r12,%rsi
+  80243d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802442:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  802449:	00 00 00 
+  80244c:	ff d0                	call   *%rax
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	78 17                	js     802469 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802452:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802456:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80245d:	00 00 00 
+  802460:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802464:	5b                   	pop    %rbx
+  802465:	41 5c                	pop    %r12
+  802467:	5d                   	pop    %rbp
+  802468:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246e:	eb f4                	jmp    802464 <mmap_alloc+0x86>
+
+0000000000802470 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802470:	55                   	push   %rbp
+  802471:	48 89 e5             	mov    %rsp,%rbp
+  802474:	41 56                	push   %r14
+  802476:	41 55                	push   %r13
+  802478:	41 54                	push   %r12
+  80247a:	53                   	push   %rbx
+  80247b:	48 83 ec 10          	sub    $0x10,%rsp
+  80247f:	41 89 fc             	mov    %edi,%r12d
+  802482:	49 89 f5             	mov    %rsi,%r13
+  802485:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802488:	48 89 f0             	mov    %rsi,%rax
+  80248b:	48 09 d0             	or     %rdx,%rax
+  80248e:	75 0d                	jne    80249d <fsipc+0x2d>
+  802490:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802493:	83 f8 04             	cmp    $0x4,%eax
+  802496:	76 7d                	jbe    802515 <fsipc+0xa5>
+  802498:	83 ff 0d             	cmp    $0xd,%edi
+  80249b:	74 78                	je     802515 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80249d:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  8024a4:	00 00 00 
+  8024a7:	ff d0                	call   *%rax
+  8024a9:	89 c7                	mov    %eax,%edi
+  8024ab:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8024b2:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8024b9:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8024c0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024c6:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8024cd:	00 00 00 
+  8024d0:	44 89 e6             	mov    %r12d,%esi
+  8024d3:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8024df:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024e6:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8024e7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024ec:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8024f0:	4c 89 ee             	mov    %r13,%rsi
+  8024f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f8:	48 b8 31 47 80 00 00 	movabs $0x804731,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+  802504:	89 c3                	mov    %eax,%ebx
+}
+  802506:	89 d8                	mov    %ebx,%eax
+  802508:	48 83 c4 10          	add    $0x10,%rsp
+  80250c:	5b                   	pop    %rbx
+  80250d:	41 5c                	pop    %r12
+  80250f:	41 5d                	pop    %r13
+  802511:	41 5e                	pop    %r14
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802515:	48 b8 22 1f 80 00 00 	movabs $0x801f22,%rax
+  80251c:	00 00 00 
+  80251f:	ff d0                	call   *%rax
+  802521:	49 89 c6             	mov    %rax,%r14
+  802524:	48 85 c0             	test   %rax,%rax
+  802527:	0f 84 70 ff ff ff    	je     80249d <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80252d:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802531:	48 b8 25 40 80 00 00 	movabs $0x804025,%rax
+  802538:	00 00 00 
+  80253b:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80253d:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802540:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802547:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80254b:	ba 10 00 00 00       	mov    $0x10,%edx
+  802550:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802557:	00 00 00 
+  80255a:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802566:	4c 89 f7             	mov    %r14,%rdi
+  802569:	48 b8 be 1f 80 00 00 	movabs $0x801fbe,%rax
+  802570:	00 00 00 
+  802573:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802575:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80257c:	4c 89 f7             	mov    %r14,%rdi
+  80257f:	48 b8 e8 40 80 00 00 	movabs $0x8040e8,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80258b:	4c 89 f7             	mov    %r14,%rdi
+  80258e:	48 b8 76 40 80 00 00 	movabs $0x804076,%rax
+  802595:	00 00 00 
+  802598:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80259a:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80259d:	41 83 fc 05          	cmp    $0x5,%r12d
+  8025a1:	75 04                	jne    8025a7 <fsipc+0x137>
+  8025a3:	85 db                	test   %ebx,%ebx
+  8025a5:	79 14                	jns    8025bb <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8025a7:	4c 89 f7             	mov    %r14,%rdi
+  8025aa:	48 b8 9d 40 80 00 00 	movabs $0x80409d,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8025b6:	e9 4b ff ff ff       	jmp    802506 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8025bb:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025bf:	ba 88 00 00 00       	mov    $0x88,%edx
+  8025c4:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8025cb:	00 00 00 
+  8025ce:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	eb cb                	jmp    8025a7 <fsipc+0x137>
+
+00000000008025dc <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8025dc:	55                   	push   %rbp
+  8025dd:	48 89 e5             	mov    %rsp,%rbp
+  8025e0:	41 57                	push   %r15
+  8025e2:	41 56                	push   %r14
+  8025e4:	41 55                	push   %r13
+  8025e6:	41 54                	push   %r12
+  8025e8:	53                   	push   %rbx
+  8025e9:	48 83 ec 18          	sub    $0x18,%rsp
+  8025ed:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8025f1:	49 89 f6             	mov    %rsi,%r14
+  8025f4:	49 89 d4             	mov    %rdx,%r12
+  8025f7:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8025fa:	48 b8 22 1f 80 00 00 	movabs $0x801f22,%rax
+  802601:	00 00 00 
+  802604:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802606:	48 85 c0             	test   %rax,%rax
+  802609:	0f 85 96 00 00 00    	jne    8026a5 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80260f:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802616:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802617:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80261e:	00 00 00 
+    while (n) {
+  802621:	4d 85 e4             	test   %r12,%r12
+  802624:	74 79                	je     80269f <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802626:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80262b:	49 39 dc             	cmp    %rbx,%r12
+  80262e:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802632:	48 89 da             	mov    %rbx,%rdx
+  802635:	4c 89 f6             	mov    %r14,%rsi
+  802638:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80263f:	00 00 00 
+  802642:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80264e:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802652:	8b 40 0c             	mov    0xc(%rax),%eax
+  802655:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802658:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80265b:	44 01 e8             	add    %r13d,%eax
+  80265e:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802662:	41 0f 44 c5          	cmove  %r13d,%eax
+  802666:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80266a:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80266e:	48 89 da             	mov    %rbx,%rdx
+  802671:	be 00 00 00 00       	mov    $0x0,%esi
+  802676:	bf 04 00 00 00       	mov    $0x4,%edi
+  80267b:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  802682:	00 00 00 
+  802685:	ff d0                	call   *%rax
+        if (res < 0)
+  802687:	85 c0                	test   %eax,%eax
+  802689:	78 4a                	js     8026d5 <devfile_write_direct+0xf9>
+        buf += res;
+  80268b:	48 98                	cltq
+  80268d:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802690:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802694:	49 29 c4             	sub    %rax,%r12
+  802697:	75 8d                	jne    802626 <devfile_write_direct+0x4a>
+    return write;
+  802699:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80269d:	eb 27                	jmp    8026c6 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80269f:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8026a3:	eb f4                	jmp    802699 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8026a5:	45 89 e9             	mov    %r13d,%r9d
+  8026a8:	4d 89 e0             	mov    %r12,%r8
+  8026ab:	4c 89 f1             	mov    %r14,%rcx
+  8026ae:	ba 04 00 00 00       	mov    $0x4,%edx
+  8026b3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026b7:	48 89 c7             	mov    %rax,%rdi
+  8026ba:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  8026c1:	00 00 00 
+  8026c4:	ff d0                	call   *%rax
+}
+  8026c6:	48 83 c4 18          	add    $0x18,%rsp
+  8026ca:	5b                   	pop    %rbx
+  8026cb:	41 5c                	pop    %r12
+  8026cd:	41 5d                	pop    %r13
+  8026cf:	41 5e                	pop    %r14
+  8026d1:	41 5f                	pop    %r15
+  8026d3:	5d                   	pop    %rbp
+  8026d4:	c3                   	ret
+            return res;
+  8026d5:	48 98                	cltq
+  8026d7:	eb ed                	jmp    8026c6 <devfile_write_direct+0xea>
+
+00000000008026d9 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8026d9:	55                   	push   %rbp
+  8026da:	48 89 e5             	mov    %rsp,%rbp
+  8026dd:	41 54                	push   %r12
+  8026df:	53                   	push   %rbx
+  8026e0:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8026e3:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  8026ea:	00 00 00 
+  8026ed:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8026ef:	48 85 c0             	test   %rax,%rax
+  8026f2:	74 71                	je     802765 <fbuf_flush+0x8c>
+  8026f4:	48 89 c3             	mov    %rax,%rbx
+  8026f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fc:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802700:	75 05                	jne    802707 <fbuf_flush+0x2e>
+}
+  802702:	5b                   	pop    %rbx
+  802703:	41 5c                	pop    %r12
+  802705:	5d                   	pop    %rbp
+  802706:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802707:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80270a:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80270e:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802715:	00 00 00 
+  802718:	48 89 de             	mov    %rbx,%rsi
+  80271b:	48 29 c6             	sub    %rax,%rsi
+  80271e:	48 c1 fe 03          	sar    $0x3,%rsi
+  802722:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802729:	aa aa aa 
+  80272c:	48 0f af f0          	imul   %rax,%rsi
+  802730:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802734:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802739:	48 01 c6             	add    %rax,%rsi
+  80273c:	4c 89 e7             	mov    %r12,%rdi
+  80273f:	48 b8 dc 25 80 00 00 	movabs $0x8025dc,%rax
+  802746:	00 00 00 
+  802749:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80274b:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80274f:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802756:	00 
+    return res < 0 ? res : 0;
+  802757:	48 85 c0             	test   %rax,%rax
+  80275a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80275f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802763:	eb 9d                	jmp    802702 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802765:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276a:	eb 96                	jmp    802702 <fbuf_flush+0x29>
+
+000000000080276c <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802770:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802777:	00 00 00 
+  80277a:	ff d0                	call   *%rax
+}
+  80277c:	5d                   	pop    %rbp
+  80277d:	c3                   	ret
+
+000000000080277e <devfile_write>:
+    if (!fd || !buf)
+  80277e:	48 85 ff             	test   %rdi,%rdi
+  802781:	0f 84 d3 01 00 00    	je     80295a <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802787:	55                   	push   %rbp
+  802788:	48 89 e5             	mov    %rsp,%rbp
+  80278b:	41 57                	push   %r15
+  80278d:	41 56                	push   %r14
+  80278f:	41 55                	push   %r13
+  802791:	41 54                	push   %r12
+  802793:	53                   	push   %rbx
+  802794:	48 83 ec 08          	sub    $0x8,%rsp
+  802798:	49 89 fc             	mov    %rdi,%r12
+  80279b:	49 89 f6             	mov    %rsi,%r14
+  80279e:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8027a1:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8027a6:	48 85 f6             	test   %rsi,%rsi
+  8027a9:	0f 84 9c 01 00 00    	je     80294b <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8027af:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  8027b6:	00 00 00 
+  8027b9:	ff d0                	call   *%rax
+  8027bb:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8027be:	48 85 c0             	test   %rax,%rax
+  8027c1:	0f 84 a2 00 00 00    	je     802869 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8027c7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027cc:	4c 89 e7             	mov    %r12,%rdi
+  8027cf:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  8027d6:	00 00 00 
+  8027d9:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8027db:	83 f8 02             	cmp    $0x2,%eax
+  8027de:	0f 8f 85 00 00 00    	jg     802869 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8027e4:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8027eb:	00 00 00 
+  8027ee:	4d 89 ef             	mov    %r13,%r15
+  8027f1:	49 29 c7             	sub    %rax,%r15
+  8027f4:	49 c1 ff 03          	sar    $0x3,%r15
+  8027f8:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027ff:	aa aa aa 
+  802802:	4c 0f af f8          	imul   %rax,%r15
+  802806:	49 c1 e7 0e          	shl    $0xe,%r15
+  80280a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80280f:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802812:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802817:	0f 84 d7 00 00 00    	je     8028f4 <devfile_write+0x176>
+  80281d:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802821:	89 c2                	mov    %eax,%edx
+  802823:	41 03 55 0c          	add    0xc(%r13),%edx
+  802827:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80282c:	75 0f                	jne    80283d <devfile_write+0xbf>
+  80282e:	48 01 d8             	add    %rbx,%rax
+  802831:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802837:	0f 86 92 00 00 00    	jbe    8028cf <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80283d:	4c 89 e7             	mov    %r12,%rdi
+  802840:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802847:	00 00 00 
+  80284a:	ff d0                	call   *%rax
+  80284c:	85 c0                	test   %eax,%eax
+  80284e:	78 52                	js     8028a2 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802850:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802857:	77 7f                	ja     8028d8 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802859:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80285e:	0f 85 c2 00 00 00    	jne    802926 <devfile_write+0x1a8>
+  802864:	e9 94 00 00 00       	jmp    8028fd <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802869:	4c 89 e7             	mov    %r12,%rdi
+  80286c:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802873:	00 00 00 
+  802876:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802878:	85 c0                	test   %eax,%eax
+  80287a:	79 07                	jns    802883 <devfile_write+0x105>
+  80287c:	48 98                	cltq
+  80287e:	e9 c8 00 00 00       	jmp    80294b <devfile_write+0x1cd>
+  802883:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802888:	48 89 da             	mov    %rbx,%rdx
+  80288b:	4c 89 f6             	mov    %r14,%rsi
+  80288e:	4c 89 e7             	mov    %r12,%rdi
+  802891:	48 b8 dc 25 80 00 00 	movabs $0x8025dc,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+  80289d:	e9 a9 00 00 00       	jmp    80294b <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028a2:	48 98                	cltq
+  8028a4:	e9 a2 00 00 00       	jmp    80294b <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028a9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028ae:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8028b3:	4c 89 fe             	mov    %r15,%rsi
+  8028b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028bb:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8028c7:	85 c0                	test   %eax,%eax
+  8028c9:	79 45                	jns    802910 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028cb:	48 98                	cltq
+  8028cd:	eb 7c                	jmp    80294b <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028cf:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028d6:	76 4e                	jbe    802926 <devfile_write+0x1a8>
+  8028d8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028dd:	48 89 da             	mov    %rbx,%rdx
+  8028e0:	4c 89 f6             	mov    %r14,%rsi
+  8028e3:	4c 89 e7             	mov    %r12,%rdi
+  8028e6:	48 b8 dc 25 80 00 00 	movabs $0x8025dc,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+  8028f2:	eb 57                	jmp    80294b <devfile_write+0x1cd>
+  8028f4:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028fb:	77 db                	ja     8028d8 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8028fd:	4c 89 ff             	mov    %r15,%rdi
+  802900:	48 b8 a7 3e 80 00 00 	movabs $0x803ea7,%rax
+  802907:	00 00 00 
+  80290a:	ff d0                	call   *%rax
+  80290c:	84 c0                	test   %al,%al
+  80290e:	74 99                	je     8028a9 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802910:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802915:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80291a:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80291e:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802925:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802926:	4c 89 ff             	mov    %r15,%rdi
+  802929:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80292d:	48 89 da             	mov    %rbx,%rdx
+  802930:	4c 89 f6             	mov    %r14,%rsi
+  802933:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  80293a:	00 00 00 
+  80293d:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80293f:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802943:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802948:	48 89 d8             	mov    %rbx,%rax
+}
+  80294b:	48 83 c4 08          	add    $0x8,%rsp
+  80294f:	5b                   	pop    %rbx
+  802950:	41 5c                	pop    %r12
+  802952:	41 5d                	pop    %r13
+  802954:	41 5e                	pop    %r14
+  802956:	41 5f                	pop    %r15
+  802958:	5d                   	pop    %rbp
+  802959:	c3                   	ret
+        return E_INVAL;
+  80295a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80295f:	c3                   	ret
+
+0000000000802960 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802960:	55                   	push   %rbp
+  802961:	48 89 e5             	mov    %rsp,%rbp
+  802964:	41 54                	push   %r12
+  802966:	53                   	push   %rbx
+  802967:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80296a:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802971:	00 00 00 
+  802974:	ff d0                	call   *%rax
+  802976:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802979:	48 89 df             	mov    %rbx,%rdi
+  80297c:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  802983:	00 00 00 
+  802986:	ff d0                	call   *%rax
+  802988:	48 85 c0             	test   %rax,%rax
+  80298b:	74 17                	je     8029a4 <devfile_flush+0x44>
+  80298d:	48 89 df             	mov    %rbx,%rdi
+  802990:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  802997:	00 00 00 
+  80299a:	ff d0                	call   *%rax
+  80299c:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8029a3:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029a4:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029a7:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8029ae:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8029b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b5:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ba:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029bf:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  8029c6:	00 00 00 
+  8029c9:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029cb:	45 85 e4             	test   %r12d,%r12d
+  8029ce:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029d2:	5b                   	pop    %rbx
+  8029d3:	41 5c                	pop    %r12
+  8029d5:	5d                   	pop    %rbp
+  8029d6:	c3                   	ret
+
+00000000008029d7 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8029d7:	55                   	push   %rbp
+  8029d8:	48 89 e5             	mov    %rsp,%rbp
+  8029db:	41 57                	push   %r15
+  8029dd:	41 56                	push   %r14
+  8029df:	41 55                	push   %r13
+  8029e1:	41 54                	push   %r12
+  8029e3:	53                   	push   %rbx
+  8029e4:	48 83 ec 38          	sub    $0x38,%rsp
+  8029e8:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8029ec:	49 89 f7             	mov    %rsi,%r15
+  8029ef:	48 89 d3             	mov    %rdx,%rbx
+  8029f2:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8029f5:	48 b8 22 1f 80 00 00 	movabs $0x801f22,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a01:	48 85 c0             	test   %rax,%rax
+  802a04:	75 20                	jne    802a26 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a06:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a0b:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a12:	00 
+    while (n) {
+  802a13:	48 85 db             	test   %rbx,%rbx
+  802a16:	0f 85 df 00 00 00    	jne    802afb <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a1c:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a20:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a24:	eb 21                	jmp    802a47 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a26:	45 89 f1             	mov    %r14d,%r9d
+  802a29:	49 89 d8             	mov    %rbx,%r8
+  802a2c:	4c 89 f9             	mov    %r15,%rcx
+  802a2f:	ba 03 00 00 00       	mov    $0x3,%edx
+  802a34:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a38:	48 89 c7             	mov    %rax,%rdi
+  802a3b:	48 b8 09 20 80 00 00 	movabs $0x802009,%rax
+  802a42:	00 00 00 
+  802a45:	ff d0                	call   *%rax
+}
+  802a47:	48 83 c4 38          	add    $0x38,%rsp
+  802a4b:	5b                   	pop    %rbx
+  802a4c:	41 5c                	pop    %r12
+  802a4e:	41 5d                	pop    %r13
+  802a50:	41 5e                	pop    %r14
+  802a52:	41 5f                	pop    %r15
+  802a54:	5d                   	pop    %rbp
+  802a55:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a56:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a5a:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a60:	75 1e                	jne    802a80 <devfile_read_direct+0xa9>
+  802a62:	e9 e2 00 00 00       	jmp    802b49 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a67:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a6b:	eb da                	jmp    802a47 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a6d:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a71:	0f 85 d0 01 00 00    	jne    802c47 <devfile_read_direct+0x270>
+            map = 0;
+  802a77:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a7b:	eb 03                	jmp    802a80 <devfile_read_direct+0xa9>
+  802a7d:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a80:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a85:	48 39 d3             	cmp    %rdx,%rbx
+  802a88:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a8c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a90:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a93:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802a9a:	00 00 00 
+  802a9d:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a9f:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802aa3:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802aa7:	be 00 00 00 00       	mov    $0x0,%esi
+  802aac:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ab1:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  802ab8:	00 00 00 
+  802abb:	ff d0                	call   *%rax
+        if (res <= 0)
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	0f 8e 63 01 00 00    	jle    802c28 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ac5:	4c 63 e0             	movslq %eax,%r12
+  802ac8:	4c 89 e2             	mov    %r12,%rdx
+  802acb:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802ad2:	00 00 00 
+  802ad5:	4c 89 ff             	mov    %r15,%rdi
+  802ad8:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+        buf += res;
+  802ae4:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802ae7:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802aea:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802aee:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802af2:	48 85 db             	test   %rbx,%rbx
+  802af5:	0f 84 25 ff ff ff    	je     802a20 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802afb:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802afe:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b02:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b06:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b0a:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b11:	0f 97 c2             	seta   %dl
+  802b14:	20 c2                	and    %al,%dl
+  802b16:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b19:	0f 84 5e ff ff ff    	je     802a7d <devfile_read_direct+0xa6>
+  802b1f:	4c 89 fa             	mov    %r15,%rdx
+  802b22:	4d 89 fd             	mov    %r15,%r13
+  802b25:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802b2c:	0f 85 4e ff ff ff    	jne    802a80 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802b32:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b36:	0f 84 1a ff ff ff    	je     802a56 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b3c:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b43:	0f 85 37 ff ff ff    	jne    802a80 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802b49:	48 89 d8             	mov    %rbx,%rax
+  802b4c:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b52:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b57:	48 39 c8             	cmp    %rcx,%rax
+  802b5a:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b5e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b62:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b66:	49 89 d4             	mov    %rdx,%r12
+  802b69:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b6d:	48 b8 48 3e 80 00 00 	movabs $0x803e48,%rax
+  802b74:	00 00 00 
+  802b77:	ff d0                	call   *%rax
+  802b79:	a8 40                	test   $0x40,%al
+  802b7b:	0f 85 b9 00 00 00    	jne    802c3a <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b81:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b88:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b8c:	49 39 c5             	cmp    %rax,%r13
+  802b8f:	72 d8                	jb     802b69 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b91:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b95:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b9c:	00 00 00 
+  802b9f:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ba3:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802ba6:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802ba8:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802bac:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802bb0:	48 b8 bd 1d 80 00 00 	movabs $0x801dbd,%rax
+  802bb7:	00 00 00 
+  802bba:	ff d0                	call   *%rax
+  802bbc:	89 c7                	mov    %eax,%edi
+  802bbe:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bc4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bc9:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802bd0:	00 00 00 
+  802bd3:	be 0e 00 00 00       	mov    $0xe,%esi
+  802bd8:	48 b8 55 47 80 00 00 	movabs $0x804755,%rax
+  802bdf:	00 00 00 
+  802be2:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802be4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802be9:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802bed:	4c 89 fe             	mov    %r15,%rsi
+  802bf0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bf5:	48 b8 31 47 80 00 00 	movabs $0x804731,%rax
+  802bfc:	00 00 00 
+  802bff:	ff d0                	call   *%rax
+  802c01:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c04:	48 85 d2             	test   %rdx,%rdx
+  802c07:	0f 84 5a fe ff ff    	je     802a67 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c0d:	0f 8e 5a fe ff ff    	jle    802a6d <devfile_read_direct+0x96>
+                buf += res;
+  802c13:	48 98                	cltq
+  802c15:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c18:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c1b:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c1f:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c23:	e9 ca fe ff ff       	jmp    802af2 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c28:	41 89 c5             	mov    %eax,%r13d
+  802c2b:	48 98                	cltq
+  802c2d:	45 85 ed             	test   %r13d,%r13d
+  802c30:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802c35:	e9 0d fe ff ff       	jmp    802a47 <devfile_read_direct+0x70>
+            map = 0;
+  802c3a:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c3e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c42:	e9 39 fe ff ff       	jmp    802a80 <devfile_read_direct+0xa9>
+  802c47:	48 89 d0             	mov    %rdx,%rax
+  802c4a:	e9 f8 fd ff ff       	jmp    802a47 <devfile_read_direct+0x70>
+
+0000000000802c4f <devfile_read>:
+    if (!fd || !buf)
+  802c4f:	48 85 ff             	test   %rdi,%rdi
+  802c52:	0f 84 21 02 00 00    	je     802e79 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c58:	55                   	push   %rbp
+  802c59:	48 89 e5             	mov    %rsp,%rbp
+  802c5c:	41 57                	push   %r15
+  802c5e:	41 56                	push   %r14
+  802c60:	41 55                	push   %r13
+  802c62:	41 54                	push   %r12
+  802c64:	53                   	push   %rbx
+  802c65:	48 83 ec 28          	sub    $0x28,%rsp
+  802c69:	48 89 fb             	mov    %rdi,%rbx
+  802c6c:	49 89 f4             	mov    %rsi,%r12
+  802c6f:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c72:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c77:	48 85 f6             	test   %rsi,%rsi
+  802c7a:	74 4b                	je     802cc7 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c7c:	48 b8 8c 1f 80 00 00 	movabs $0x801f8c,%rax
+  802c83:	00 00 00 
+  802c86:	ff d0                	call   *%rax
+  802c88:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c8b:	48 85 c0             	test   %rax,%rax
+  802c8e:	74 22                	je     802cb2 <devfile_read+0x63>
+  802c90:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c97:	77 19                	ja     802cb2 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c99:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c9e:	48 89 df             	mov    %rbx,%rdi
+  802ca1:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  802ca8:	00 00 00 
+  802cab:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802cad:	83 f8 02             	cmp    $0x2,%eax
+  802cb0:	7e 40                	jle    802cf2 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802cb2:	48 89 df             	mov    %rbx,%rdi
+  802cb5:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802cbc:	00 00 00 
+  802cbf:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cc1:	85 c0                	test   %eax,%eax
+  802cc3:	79 11                	jns    802cd6 <devfile_read+0x87>
+  802cc5:	48 98                	cltq
+}
+  802cc7:	48 83 c4 28          	add    $0x28,%rsp
+  802ccb:	5b                   	pop    %rbx
+  802ccc:	41 5c                	pop    %r12
+  802cce:	41 5d                	pop    %r13
+  802cd0:	41 5e                	pop    %r14
+  802cd2:	41 5f                	pop    %r15
+  802cd4:	5d                   	pop    %rbp
+  802cd5:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cd6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802cdb:	4c 89 ea             	mov    %r13,%rdx
+  802cde:	4c 89 e6             	mov    %r12,%rsi
+  802ce1:	48 89 df             	mov    %rbx,%rdi
+  802ce4:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  802ceb:	00 00 00 
+  802cee:	ff d0                	call   *%rax
+  802cf0:	eb d5                	jmp    802cc7 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802cf2:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802cf6:	48 89 df             	mov    %rbx,%rdi
+  802cf9:	48 b8 d9 26 80 00 00 	movabs $0x8026d9,%rax
+  802d00:	00 00 00 
+  802d03:	ff d0                	call   *%rax
+  802d05:	85 c0                	test   %eax,%eax
+  802d07:	0f 88 33 01 00 00    	js     802e40 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d0d:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d14:	00 00 00 
+  802d17:	4c 89 f0             	mov    %r14,%rax
+  802d1a:	48 29 d0             	sub    %rdx,%rax
+  802d1d:	48 c1 f8 03          	sar    $0x3,%rax
+  802d21:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d28:	aa aa aa 
+  802d2b:	48 0f af c2          	imul   %rdx,%rax
+  802d2f:	48 c1 e0 0e          	shl    $0xe,%rax
+  802d33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d37:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d3a:	41 39 06             	cmp    %eax,(%r14)
+  802d3d:	75 0d                	jne    802d4c <devfile_read+0xfd>
+  802d3f:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d42:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802d46:	0f 84 fb 00 00 00    	je     802e47 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802d4c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d51:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d55:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d58:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d5c:	48 89 c7             	mov    %rax,%rdi
+  802d5f:	48 b8 a7 3e 80 00 00 	movabs $0x803ea7,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	84 c0                	test   %al,%al
+  802d6d:	75 27                	jne    802d96 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d6f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d74:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d79:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d82:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d8e:	85 c0                	test   %eax,%eax
+  802d90:	0f 88 dc 00 00 00    	js     802e72 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d96:	44 89 f8             	mov    %r15d,%eax
+  802d99:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d9e:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802da0:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802da7:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802da8:	8b 43 10             	mov    0x10(%rbx),%eax
+  802dab:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802daf:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802db2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802db7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802dbb:	48 89 df             	mov    %rbx,%rdi
+  802dbe:	48 b8 d7 29 80 00 00 	movabs $0x8029d7,%rax
+  802dc5:	00 00 00 
+  802dc8:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802dca:	48 85 c0             	test   %rax,%rax
+  802dcd:	0f 88 f4 fe ff ff    	js     802cc7 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802dd3:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802dd6:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802dd9:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802ddc:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802de0:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802de4:	48 63 d1             	movslq %ecx,%rdx
+  802de7:	48 01 d0             	add    %rdx,%rax
+  802dea:	4d 63 ff             	movslq %r15d,%r15
+  802ded:	4c 29 f8             	sub    %r15,%rax
+  802df0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df5:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802df9:	48 85 c0             	test   %rax,%rax
+  802dfc:	0f 8e c5 fe ff ff    	jle    802cc7 <devfile_read+0x78>
+    n = MIN(n, res);
+  802e02:	4c 39 e8             	cmp    %r13,%rax
+  802e05:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e09:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e0c:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e10:	48 63 f6             	movslq %esi,%rsi
+  802e13:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e18:	48 01 c6             	add    %rax,%rsi
+  802e1b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e1f:	48 01 c6             	add    %rax,%rsi
+  802e22:	4c 89 ea             	mov    %r13,%rdx
+  802e25:	4c 89 e7             	mov    %r12,%rdi
+  802e28:	48 b8 5a 0f 80 00 00 	movabs $0x800f5a,%rax
+  802e2f:	00 00 00 
+  802e32:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802e34:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802e38:	4c 89 e8             	mov    %r13,%rax
+  802e3b:	e9 87 fe ff ff       	jmp    802cc7 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e40:	48 98                	cltq
+  802e42:	e9 80 fe ff ff       	jmp    802cc7 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e47:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e4b:	41 39 d7             	cmp    %edx,%r15d
+  802e4e:	0f 8c f8 fe ff ff    	jl     802d4c <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e54:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e58:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e5b:	41 39 cf             	cmp    %ecx,%r15d
+  802e5e:	0f 8d e8 fe ff ff    	jge    802d4c <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e64:	4d 63 ff             	movslq %r15d,%r15
+  802e67:	4c 29 f8             	sub    %r15,%rax
+  802e6a:	48 63 d2             	movslq %edx,%rdx
+  802e6d:	48 01 d0             	add    %rdx,%rax
+  802e70:	eb 87                	jmp    802df9 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e72:	48 98                	cltq
+  802e74:	e9 4e fe ff ff       	jmp    802cc7 <devfile_read+0x78>
+        return E_INVAL;
+  802e79:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e7e:	c3                   	ret
+
+0000000000802e7f <fs_channel>:
+fs_channel(bool enable) {
+  802e7f:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e81:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802e88:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8f:	40 84 ff             	test   %dil,%dil
+  802e92:	74 47                	je     802edb <fs_channel+0x5c>
+  802e94:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802e9b:	00 00 00 
+  802e9e:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802ea4:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802eab:	00 00 00 
+  802eae:	3b 08                	cmp    (%rax),%ecx
+  802eb0:	74 29                	je     802edb <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802eb2:	55                   	push   %rbp
+  802eb3:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802eb6:	48 b8 ff 1d 80 00 00 	movabs $0x801dff,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+  802ec2:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802ec4:	85 c0                	test   %eax,%eax
+  802ec6:	78 04                	js     802ecc <fs_channel+0x4d>
+}
+  802ec8:	89 d0                	mov    %edx,%eax
+  802eca:	5d                   	pop    %rbp
+  802ecb:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ecc:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802ed3:	00 00 00 
+  802ed6:	c6 00 00             	movb   $0x0,(%rax)
+  802ed9:	eb ed                	jmp    802ec8 <fs_channel+0x49>
+}
+  802edb:	89 d0                	mov    %edx,%eax
+  802edd:	c3                   	ret
+
+0000000000802ede <open>:
+open(const char *path, int mode) {
+  802ede:	55                   	push   %rbp
+  802edf:	48 89 e5             	mov    %rsp,%rbp
+  802ee2:	41 55                	push   %r13
+  802ee4:	41 54                	push   %r12
+  802ee6:	53                   	push   %rbx
+  802ee7:	48 83 ec 18          	sub    $0x18,%rsp
+  802eeb:	49 89 fc             	mov    %rdi,%r12
+  802eee:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ef1:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  802ef8:	00 00 00 
+  802efb:	ff d0                	call   *%rax
+  802efd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f03:	0f 87 8f 00 00 00    	ja     802f98 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f09:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f0d:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+  802f19:	89 c3                	mov    %eax,%ebx
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	78 55                	js     802f74 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f1f:	4c 89 e6             	mov    %r12,%rsi
+  802f22:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f29:	00 00 00 
+  802f2c:	48 89 df             	mov    %rbx,%rdi
+  802f2f:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f3b:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802f42:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f4b:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f50:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  802f57:	00 00 00 
+  802f5a:	ff d0                	call   *%rax
+  802f5c:	89 c3                	mov    %eax,%ebx
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	78 1f                	js     802f81 <open+0xa3>
+    return fd2num(fd);
+  802f62:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f66:	48 b8 8b 16 80 00 00 	movabs $0x80168b,%rax
+  802f6d:	00 00 00 
+  802f70:	ff d0                	call   *%rax
+  802f72:	89 c3                	mov    %eax,%ebx
+}
+  802f74:	89 d8                	mov    %ebx,%eax
+  802f76:	48 83 c4 18          	add    $0x18,%rsp
+  802f7a:	5b                   	pop    %rbx
+  802f7b:	41 5c                	pop    %r12
+  802f7d:	41 5d                	pop    %r13
+  802f7f:	5d                   	pop    %rbp
+  802f80:	c3                   	ret
+        fd_close(fd, 0);
+  802f81:	be 00 00 00 00       	mov    $0x0,%esi
+  802f86:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f8a:	48 b8 d4 17 80 00 00 	movabs $0x8017d4,%rax
+  802f91:	00 00 00 
+  802f94:	ff d0                	call   *%rax
+        return res;
+  802f96:	eb dc                	jmp    802f74 <open+0x96>
+        return -E_BAD_PATH;
+  802f98:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f9d:	eb d5                	jmp    802f74 <open+0x96>
+
+0000000000802f9f <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f9f:	55                   	push   %rbp
+  802fa0:	48 89 e5             	mov    %rsp,%rbp
+  802fa3:	41 56                	push   %r14
+  802fa5:	41 55                	push   %r13
+  802fa7:	41 54                	push   %r12
+  802fa9:	53                   	push   %rbx
+  802faa:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802fae:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802fb5:	00 00 00 
+  802fb8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802fbd:	49 bd 19 17 80 00 00 	movabs $0x801719,%r13
+  802fc4:	00 00 00 
+  802fc7:	49 be d9 26 80 00 00 	movabs $0x8026d9,%r14
+  802fce:	00 00 00 
+  802fd1:	eb 0c                	jmp    802fdf <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802fd3:	83 c3 01             	add    $0x1,%ebx
+  802fd6:	49 83 c4 18          	add    $0x18,%r12
+  802fda:	83 fb 20             	cmp    $0x20,%ebx
+  802fdd:	74 1d                	je     802ffc <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802fdf:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802fe4:	74 ed                	je     802fd3 <file_flush_buffers+0x34>
+  802fe6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fea:	89 df                	mov    %ebx,%edi
+  802fec:	41 ff d5             	call   *%r13
+  802fef:	85 c0                	test   %eax,%eax
+  802ff1:	78 e0                	js     802fd3 <file_flush_buffers+0x34>
+  802ff3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ff7:	41 ff d6             	call   *%r14
+  802ffa:	eb d7                	jmp    802fd3 <file_flush_buffers+0x34>
+}
+  802ffc:	48 83 c4 10          	add    $0x10,%rsp
+  803000:	5b                   	pop    %rbx
+  803001:	41 5c                	pop    %r12
+  803003:	41 5d                	pop    %r13
+  803005:	41 5e                	pop    %r14
+  803007:	5d                   	pop    %rbp
+  803008:	c3                   	ret
+
+0000000000803009 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803009:	55                   	push   %rbp
+  80300a:	48 89 e5             	mov    %rsp,%rbp
+  80300d:	41 54                	push   %r12
+  80300f:	53                   	push   %rbx
+  803010:	49 89 fc             	mov    %rdi,%r12
+  803013:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803015:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803021:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803028:	00 00 00 
+  80302b:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803030:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803032:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803035:	ba 00 00 00 00       	mov    $0x0,%edx
+  80303a:	be 00 00 00 00       	mov    $0x0,%esi
+  80303f:	bf 02 00 00 00       	mov    $0x2,%edi
+  803044:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  80304b:	00 00 00 
+  80304e:	ff d0                	call   *%rax
+}
+  803050:	5b                   	pop    %rbx
+  803051:	41 5c                	pop    %r12
+  803053:	5d                   	pop    %rbp
+  803054:	c3                   	ret
+
+0000000000803055 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803055:	55                   	push   %rbp
+  803056:	48 89 e5             	mov    %rsp,%rbp
+  803059:	41 54                	push   %r12
+  80305b:	53                   	push   %rbx
+  80305c:	49 89 fc             	mov    %rdi,%r12
+  80305f:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803062:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  803069:	00 00 00 
+  80306c:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80306e:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803073:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80307a:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80307c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803081:	be 00 00 00 00       	mov    $0x0,%esi
+  803086:	bf 05 00 00 00       	mov    $0x5,%edi
+  80308b:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  803092:	00 00 00 
+  803095:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803097:	85 c0                	test   %eax,%eax
+  803099:	78 3d                	js     8030d8 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80309b:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8030a2:	00 00 00 
+  8030a5:	4c 89 e6             	mov    %r12,%rsi
+  8030a8:	48 89 df             	mov    %rbx,%rdi
+  8030ab:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  8030b2:	00 00 00 
+  8030b5:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8030b7:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8030be:	00 
+  8030bf:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8030c5:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8030cc:	00 
+  8030cd:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8030d3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d8:	5b                   	pop    %rbx
+  8030d9:	41 5c                	pop    %r12
+  8030db:	5d                   	pop    %rbp
+  8030dc:	c3                   	ret
+
+00000000008030dd <remove>:
+remove(const char *path) {
+  8030dd:	55                   	push   %rbp
+  8030de:	48 89 e5             	mov    %rsp,%rbp
+  8030e1:	53                   	push   %rbx
+  8030e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8030e6:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030e9:	48 b8 bb 0c 80 00 00 	movabs $0x800cbb,%rax
+  8030f0:	00 00 00 
+  8030f3:	ff d0                	call   *%rax
+  8030f5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030fb:	77 3a                	ja     803137 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8030fd:	48 89 de             	mov    %rbx,%rsi
+  803100:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803107:	00 00 00 
+  80310a:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  803111:	00 00 00 
+  803114:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803116:	ba 00 00 00 00       	mov    $0x0,%edx
+  80311b:	be 00 00 00 00       	mov    $0x0,%esi
+  803120:	bf 07 00 00 00       	mov    $0x7,%edi
+  803125:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  80312c:	00 00 00 
+  80312f:	ff d0                	call   *%rax
+}
+  803131:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803135:	c9                   	leave
+  803136:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803137:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80313c:	eb f3                	jmp    803131 <remove+0x54>
+
+000000000080313e <sync>:
+sync(void) {
+  80313e:	55                   	push   %rbp
+  80313f:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803142:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  803149:	00 00 00 
+  80314c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80314e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803153:	be 00 00 00 00       	mov    $0x0,%esi
+  803158:	bf 08 00 00 00       	mov    $0x8,%edi
+  80315d:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  803164:	00 00 00 
+  803167:	ff d0                	call   *%rax
+}
+  803169:	5d                   	pop    %rbp
+  80316a:	c3                   	ret
+
+000000000080316b <fsync>:
+fsync(int fdnum) {
+  80316b:	55                   	push   %rbp
+  80316c:	48 89 e5             	mov    %rsp,%rbp
+  80316f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803173:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803177:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  80317e:	00 00 00 
+  803181:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803183:	85 c0                	test   %eax,%eax
+  803185:	78 4b                	js     8031d2 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803187:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80318b:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  803192:	00 00 00 
+  803195:	8b 00                	mov    (%rax),%eax
+  803197:	39 02                	cmp    %eax,(%rdx)
+  803199:	75 39                	jne    8031d4 <fsync+0x69>
+    file_flush_buffers();
+  80319b:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8031a7:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031ab:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031ae:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8031b5:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8031b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8031c1:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8031c6:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  8031cd:	00 00 00 
+  8031d0:	ff d0                	call   *%rax
+}
+  8031d2:	c9                   	leave
+  8031d3:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031d4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031d9:	eb f7                	jmp    8031d2 <fsync+0x67>
+
+00000000008031db <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8031db:	55                   	push   %rbp
+  8031dc:	48 89 e5             	mov    %rsp,%rbp
+  8031df:	53                   	push   %rbx
+  8031e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8031e4:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8031e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ec:	be 00 00 00 00       	mov    $0x0,%esi
+  8031f1:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8031f6:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  8031fd:	00 00 00 
+  803200:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 2d                	js     803233 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803206:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80320d:	00 00 00 
+  803210:	48 8b 10             	mov    (%rax),%rdx
+  803213:	48 89 13             	mov    %rdx,(%rbx)
+  803216:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80321a:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80321e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803222:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803226:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80322a:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80322e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803233:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803237:	c9                   	leave
+  803238:	c3                   	ret
+
+0000000000803239 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803239:	55                   	push   %rbp
+  80323a:	48 89 e5             	mov    %rsp,%rbp
+  80323d:	53                   	push   %rbx
+  80323e:	48 83 ec 08          	sub    $0x8,%rsp
+  803242:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324a:	be 00 00 00 00       	mov    $0x0,%esi
+  80324f:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803254:	48 b8 70 24 80 00 00 	movabs $0x802470,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803260:	85 c0                	test   %eax,%eax
+  803262:	78 3d                	js     8032a1 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803264:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80326b:	00 00 00 
+  80326e:	48 8b 10             	mov    (%rax),%rdx
+  803271:	48 89 13             	mov    %rdx,(%rbx)
+  803274:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803278:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80327c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803280:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803284:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803288:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80328c:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803290:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803294:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803298:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80329c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032a5:	c9                   	leave
+  8032a6:	c3                   	ret
+
+00000000008032a7 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8032a7:	55                   	push   %rbp
+  8032a8:	48 89 e5             	mov    %rsp,%rbp
+  8032ab:	41 57                	push   %r15
+  8032ad:	41 56                	push   %r14
+  8032af:	41 55                	push   %r13
+  8032b1:	41 54                	push   %r12
+  8032b3:	53                   	push   %rbx
+  8032b4:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8032b8:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8032bf:	00 
+  8032c0:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8032c7:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8032cd:	0f 85 43 01 00 00    	jne    803416 <munmap+0x16f>
+  8032d3:	49 89 ff             	mov    %rdi,%r15
+  8032d6:	4c 39 f7             	cmp    %r14,%rdi
+  8032d9:	0f 87 37 01 00 00    	ja     803416 <munmap+0x16f>
+  8032df:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8032e6:	00 00 00 
+  8032e9:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8032ef:	eb 2c                	jmp    80331d <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8032f1:	4c 39 f8             	cmp    %r15,%rax
+  8032f4:	0f 83 85 00 00 00    	jae    80337f <munmap+0xd8>
+            m->mm_end = start;
+  8032fa:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032ff:	48 83 c3 18          	add    $0x18,%rbx
+  803303:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80330a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803311:	00 00 00 
+  803314:	48 39 c3             	cmp    %rax,%rbx
+  803317:	0f 84 d0 00 00 00    	je     8033ed <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80331d:	49 89 dc             	mov    %rbx,%r12
+  803320:	48 8b 03             	mov    (%rbx),%rax
+  803323:	4c 39 f0             	cmp    %r14,%rax
+  803326:	73 d7                	jae    8032ff <munmap+0x58>
+  803328:	48 85 c0             	test   %rax,%rax
+  80332b:	74 d2                	je     8032ff <munmap+0x58>
+  80332d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803331:	49 39 d7             	cmp    %rdx,%r15
+  803334:	73 c9                	jae    8032ff <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803336:	49 39 d6             	cmp    %rdx,%r14
+  803339:	73 b6                	jae    8032f1 <munmap+0x4a>
+  80333b:	49 39 c7             	cmp    %rax,%r15
+  80333e:	76 b1                	jbe    8032f1 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803340:	4c 89 ef             	mov    %r13,%rdi
+  803343:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80334f:	48 85 c0             	test   %rax,%rax
+  803352:	0f 84 c5 00 00 00    	je     80341d <munmap+0x176>
+            *tail = *m;
+  803358:	48 8b 13             	mov    (%rbx),%rdx
+  80335b:	48 89 10             	mov    %rdx,(%rax)
+  80335e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803362:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803366:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80336a:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80336e:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803371:	44 89 f2             	mov    %r14d,%edx
+  803374:	2b 13                	sub    (%rbx),%edx
+  803376:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803379:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80337d:	eb 80                	jmp    8032ff <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80337f:	49 39 d6             	cmp    %rdx,%r14
+  803382:	73 18                	jae    80339c <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803384:	44 89 f2             	mov    %r14d,%edx
+  803387:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80338c:	29 c2                	sub    %eax,%edx
+  80338e:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803393:	4d 89 34 24          	mov    %r14,(%r12)
+  803397:	e9 63 ff ff ff       	jmp    8032ff <munmap+0x58>
+    m->mm_start = 0;
+  80339c:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8033a3:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8033a4:	4c 89 e6             	mov    %r12,%rsi
+  8033a7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8033ae:	00 00 00 
+  8033b1:	48 29 c6             	sub    %rax,%rsi
+  8033b4:	48 c1 fe 03          	sar    $0x3,%rsi
+  8033b8:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8033bf:	aa aa aa 
+  8033c2:	48 0f af f0          	imul   %rax,%rsi
+  8033c6:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8033ca:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8033cf:	48 01 c6             	add    %rax,%rsi
+  8033d2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033dc:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  8033e3:	00 00 00 
+  8033e6:	ff d0                	call   *%rax
+}
+  8033e8:	e9 12 ff ff ff       	jmp    8032ff <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8033ed:	4c 89 f2             	mov    %r14,%rdx
+  8033f0:	4c 29 fa             	sub    %r15,%rdx
+  8033f3:	4c 89 fe             	mov    %r15,%rsi
+  8033f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033fb:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803402:	00 00 00 
+  803405:	ff d0                	call   *%rax
+}
+  803407:	48 83 c4 08          	add    $0x8,%rsp
+  80340b:	5b                   	pop    %rbx
+  80340c:	41 5c                	pop    %r12
+  80340e:	41 5d                	pop    %r13
+  803410:	41 5e                	pop    %r14
+  803412:	41 5f                	pop    %r15
+  803414:	5d                   	pop    %rbp
+  803415:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803416:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80341b:	eb ea                	jmp    803407 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80341d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803422:	eb e3                	jmp    803407 <munmap+0x160>
+
+0000000000803424 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803424:	55                   	push   %rbp
+  803425:	48 89 e5             	mov    %rsp,%rbp
+  803428:	41 57                	push   %r15
+  80342a:	41 56                	push   %r14
+  80342c:	41 55                	push   %r13
+  80342e:	41 54                	push   %r12
+  803430:	53                   	push   %rbx
+  803431:	48 83 ec 28          	sub    $0x28,%rsp
+  803435:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803439:	49 89 f5             	mov    %rsi,%r13
+  80343c:	41 89 d6             	mov    %edx,%r14d
+  80343f:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803442:	41 89 cc             	mov    %ecx,%r12d
+  803445:	44 89 c7             	mov    %r8d,%edi
+  803448:	44 89 cb             	mov    %r9d,%ebx
+  80344b:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80344f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803453:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  80345a:	00 00 00 
+  80345d:	ff d0                	call   *%rax
+  80345f:	41 89 c7             	mov    %eax,%r15d
+  803462:	85 c0                	test   %eax,%eax
+  803464:	0f 88 ae 01 00 00    	js     803618 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80346a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80346e:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803475:	00 00 00 
+  803478:	8b 32                	mov    (%rdx),%esi
+  80347a:	39 30                	cmp    %esi,(%rax)
+  80347c:	0f 85 7a 02 00 00    	jne    8036fc <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803482:	8b 40 08             	mov    0x8(%rax),%eax
+  803485:	83 e0 03             	and    $0x3,%eax
+  803488:	83 f8 01             	cmp    $0x1,%eax
+  80348b:	0f 84 76 02 00 00    	je     803707 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803491:	4d 85 ed             	test   %r13,%r13
+  803494:	0f 84 78 02 00 00    	je     803712 <mmap+0x2ee>
+  80349a:	85 db                	test   %ebx,%ebx
+  80349c:	0f 88 70 02 00 00    	js     803712 <mmap+0x2ee>
+  8034a2:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8034a8:	41 89 df             	mov    %ebx,%r15d
+  8034ab:	0f 85 6c 02 00 00    	jne    80371d <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8034b1:	44 89 f0             	mov    %r14d,%eax
+  8034b4:	83 e0 fd             	and    $0xfffffffd,%eax
+  8034b7:	83 f8 04             	cmp    $0x4,%eax
+  8034ba:	0f 85 68 02 00 00    	jne    803728 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8034c0:	44 89 e1             	mov    %r12d,%ecx
+  8034c3:	83 e1 01             	and    $0x1,%ecx
+  8034c6:	0f 95 c2             	setne  %dl
+  8034c9:	44 89 e0             	mov    %r12d,%eax
+  8034cc:	d1 e8                	shr    %eax
+  8034ce:	83 f0 01             	xor    $0x1,%eax
+  8034d1:	83 e0 01             	and    $0x1,%eax
+  8034d4:	38 c2                	cmp    %al,%dl
+  8034d6:	0f 85 57 02 00 00    	jne    803733 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8034dc:	85 c9                	test   %ecx,%ecx
+  8034de:	74 0a                	je     8034ea <mmap+0xc6>
+  8034e0:	41 f6 c6 02          	test   $0x2,%r14b
+  8034e4:	0f 85 54 02 00 00    	jne    80373e <mmap+0x31a>
+    file_flush_buffers();
+  8034ea:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8034f1:	00 00 00 
+  8034f4:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8034f6:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034fd:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803504:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803508:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80350b:	41 f6 c4 04          	test   $0x4,%r12b
+  80350f:	0f 84 15 01 00 00    	je     80362a <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803515:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803518:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80351e:	0f 85 25 02 00 00    	jne    803749 <mmap+0x325>
+  803524:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803528:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80352f:	00 00 00 
+  803532:	48 39 c2             	cmp    %rax,%rdx
+  803535:	0f 82 19 02 00 00    	jb     803754 <mmap+0x330>
+  80353b:	48 39 c7             	cmp    %rax,%rdi
+  80353e:	0f 87 10 02 00 00    	ja     803754 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803544:	4c 89 ee             	mov    %r13,%rsi
+  803547:	48 b8 a7 32 80 00 00 	movabs $0x8032a7,%rax
+  80354e:	00 00 00 
+  803551:	ff d0                	call   *%rax
+  803553:	85 c0                	test   %eax,%eax
+  803555:	0f 88 04 02 00 00    	js     80375f <mmap+0x33b>
+    if (!handler) {
+  80355b:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803562:	00 00 00 
+  803565:	80 38 00             	cmpb   $0x0,(%rax)
+  803568:	75 2b                	jne    803595 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80356a:	48 bf 3f 23 80 00 00 	movabs $0x80233f,%rdi
+  803571:	00 00 00 
+  803574:	48 b8 00 44 80 00 00 	movabs $0x804400,%rax
+  80357b:	00 00 00 
+  80357e:	ff d0                	call   *%rax
+  803580:	85 c0                	test   %eax,%eax
+  803582:	0f 88 ea 01 00 00    	js     803772 <mmap+0x34e>
+        handler = 1;
+  803588:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80358f:	00 00 00 
+  803592:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803595:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803599:	48 b8 de 23 80 00 00 	movabs $0x8023de,%rax
+  8035a0:	00 00 00 
+  8035a3:	ff d0                	call   *%rax
+  8035a5:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8035a8:	48 85 c0             	test   %rax,%rax
+  8035ab:	0f 84 c9 01 00 00    	je     80377a <mmap+0x356>
+    m->mm_start = va;
+  8035b1:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8035b4:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8035b8:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8035bc:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8035bf:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8035c3:	44 89 e0             	mov    %r12d,%eax
+  8035c6:	c1 e0 06             	shl    $0x6,%eax
+  8035c9:	25 80 00 00 00       	and    $0x80,%eax
+  8035ce:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8035d1:	09 f0                	or     %esi,%eax
+  8035d3:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8035d7:	41 f6 c4 08          	test   $0x8,%r12b
+  8035db:	74 31                	je     80360e <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035dd:	48 39 d3             	cmp    %rdx,%rbx
+  8035e0:	73 2c                	jae    80360e <mmap+0x1ea>
+  8035e2:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8035e7:	48 89 de             	mov    %rbx,%rsi
+  8035ea:	4c 89 f7             	mov    %r14,%rdi
+  8035ed:	48 b8 2e 22 80 00 00 	movabs $0x80222e,%rax
+  8035f4:	00 00 00 
+  8035f7:	ff d0                	call   *%rax
+  8035f9:	49 89 c4             	mov    %rax,%r12
+  8035fc:	48 85 c0             	test   %rax,%rax
+  8035ff:	0f 8e d7 00 00 00    	jle    8036dc <mmap+0x2b8>
+            va += n;
+  803605:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803608:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80360c:	72 d4                	jb     8035e2 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80360e:	49 8b 06             	mov    (%r14),%rax
+  803611:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803615:	48 89 06             	mov    %rax,(%rsi)
+}
+  803618:	44 89 f8             	mov    %r15d,%eax
+  80361b:	48 83 c4 28          	add    $0x28,%rsp
+  80361f:	5b                   	pop    %rbx
+  803620:	41 5c                	pop    %r12
+  803622:	41 5d                	pop    %r13
+  803624:	41 5e                	pop    %r14
+  803626:	41 5f                	pop    %r15
+  803628:	5d                   	pop    %rbp
+  803629:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80362a:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803631:	00 00 00 
+  803634:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803637:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80363e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803641:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803646:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80364d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803650:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803657:	00 00 00 
+  80365a:	48 39 d7             	cmp    %rdx,%rdi
+  80365d:	73 1c                	jae    80367b <mmap+0x257>
+        return -E_NO_MEM;
+  80365f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803665:	eb b1                	jmp    803618 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803667:	48 83 c0 01          	add    $0x1,%rax
+  80366b:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80366f:	77 3f                	ja     8036b0 <mmap+0x28c>
+  803671:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803676:	48 39 d7             	cmp    %rdx,%rdi
+  803679:	72 2a                	jb     8036a5 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80367b:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80367f:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803683:	48 39 d1             	cmp    %rdx,%rcx
+  803686:	73 df                	jae    803667 <mmap+0x243>
+  803688:	48 85 c9             	test   %rcx,%rcx
+  80368b:	74 da                	je     803667 <mmap+0x243>
+  80368d:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803691:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803696:	48 39 d3             	cmp    %rdx,%rbx
+  803699:	73 cc                	jae    803667 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80369b:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80369e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a3:	eb cc                	jmp    803671 <mmap+0x24d>
+        return -E_NO_MEM;
+  8036a5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036ab:	e9 68 ff ff ff       	jmp    803618 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8036b0:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8036b5:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8036bc:	00 00 00 
+  8036bf:	48 39 c2             	cmp    %rax,%rdx
+  8036c2:	0f 82 9f 00 00 00    	jb     803767 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8036c8:	48 85 db             	test   %rbx,%rbx
+  8036cb:	0f 85 8a fe ff ff    	jne    80355b <mmap+0x137>
+        return -E_NO_MEM;
+  8036d1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036d7:	e9 3c ff ff ff       	jmp    803618 <mmap+0x1f4>
+        if (n < 0) {
+  8036dc:	0f 89 2c ff ff ff    	jns    80360e <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8036e2:	49 8b 3e             	mov    (%r14),%rdi
+  8036e5:	4c 89 ee             	mov    %r13,%rsi
+  8036e8:	48 b8 a7 32 80 00 00 	movabs $0x8032a7,%rax
+  8036ef:	00 00 00 
+  8036f2:	ff d0                	call   *%rax
+            return n;
+  8036f4:	45 89 e7             	mov    %r12d,%r15d
+  8036f7:	e9 1c ff ff ff       	jmp    803618 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036fc:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803702:	e9 11 ff ff ff       	jmp    803618 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803707:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80370d:	e9 06 ff ff ff       	jmp    803618 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803712:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803718:	e9 fb fe ff ff       	jmp    803618 <mmap+0x1f4>
+  80371d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803723:	e9 f0 fe ff ff       	jmp    803618 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803728:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80372e:	e9 e5 fe ff ff       	jmp    803618 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803733:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803739:	e9 da fe ff ff       	jmp    803618 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80373e:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803744:	e9 cf fe ff ff       	jmp    803618 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803749:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80374f:	e9 c4 fe ff ff       	jmp    803618 <mmap+0x1f4>
+  803754:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80375a:	e9 b9 fe ff ff       	jmp    803618 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80375f:	41 89 c7             	mov    %eax,%r15d
+  803762:	e9 b1 fe ff ff       	jmp    803618 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803767:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80376d:	e9 a6 fe ff ff       	jmp    803618 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803772:	41 89 c7             	mov    %eax,%r15d
+  803775:	e9 9e fe ff ff       	jmp    803618 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80377a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803780:	e9 93 fe ff ff       	jmp    803618 <mmap+0x1f4>
+
+0000000000803785 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803785:	55                   	push   %rbp
+  803786:	48 89 e5             	mov    %rsp,%rbp
+  803789:	41 54                	push   %r12
+  80378b:	53                   	push   %rbx
+  80378c:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80378f:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803796:	00 00 00 
+  803799:	ff d0                	call   *%rax
+  80379b:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80379e:	48 be e0 4e 80 00 00 	movabs $0x804ee0,%rsi
+  8037a5:	00 00 00 
+  8037a8:	48 89 df             	mov    %rbx,%rdi
+  8037ab:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  8037b2:	00 00 00 
+  8037b5:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8037b7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8037bc:	41 2b 04 24          	sub    (%r12),%eax
+  8037c0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8037c6:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037cd:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037d0:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8037d7:	00 00 00 
+  8037da:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e6:	5b                   	pop    %rbx
+  8037e7:	41 5c                	pop    %r12
+  8037e9:	5d                   	pop    %rbp
+  8037ea:	c3                   	ret
+
+00000000008037eb <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037eb:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8037ee:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8037f4:	8b 17                	mov    (%rdi),%edx
+  8037f6:	85 d2                	test   %edx,%edx
+  8037f8:	75 01                	jne    8037fb <pipe_wakeup+0x10>
+  8037fa:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037fb:	55                   	push   %rbp
+  8037fc:	48 89 e5             	mov    %rsp,%rbp
+  8037ff:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803802:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803808:	be 00 04 00 00       	mov    $0x400,%esi
+  80380d:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  803814:	00 00 00 
+  803817:	ff d0                	call   *%rax
+}
+  803819:	5d                   	pop    %rbp
+  80381a:	c3                   	ret
+
+000000000080381b <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80381b:	55                   	push   %rbp
+  80381c:	48 89 e5             	mov    %rsp,%rbp
+  80381f:	41 55                	push   %r13
+  803821:	41 54                	push   %r12
+  803823:	53                   	push   %rbx
+  803824:	48 83 ec 08          	sub    $0x8,%rsp
+  803828:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80382b:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803832:	00 00 00 
+  803835:	ff d0                	call   *%rax
+  803837:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80383a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80383f:	4c 89 e6             	mov    %r12,%rsi
+  803842:	bf 00 00 00 00       	mov    $0x0,%edi
+  803847:	49 bc fe 12 80 00 00 	movabs $0x8012fe,%r12
+  80384e:	00 00 00 
+  803851:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803854:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803858:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80385c:	49 bd eb 37 80 00 00 	movabs $0x8037eb,%r13
+  803863:	00 00 00 
+  803866:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803869:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80386d:	48 89 de             	mov    %rbx,%rsi
+  803870:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803873:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803878:	48 89 de             	mov    %rbx,%rsi
+  80387b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803880:	41 ff d4             	call   *%r12
+  803883:	48 83 c4 08          	add    $0x8,%rsp
+  803887:	5b                   	pop    %rbx
+  803888:	41 5c                	pop    %r12
+  80388a:	41 5d                	pop    %r13
+  80388c:	5d                   	pop    %rbp
+  80388d:	c3                   	ret
+
+000000000080388e <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80388e:	55                   	push   %rbp
+  80388f:	48 89 e5             	mov    %rsp,%rbp
+  803892:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803895:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80389a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80389f:	48 b8 41 12 80 00 00 	movabs $0x801241,%rax
+  8038a6:	00 00 00 
+  8038a9:	ff d0                	call   *%rax
+  8038ab:	85 c0                	test   %eax,%eax
+  8038ad:	0f 94 c0             	sete   %al
+  8038b0:	0f b6 c0             	movzbl %al,%eax
+}
+  8038b3:	5d                   	pop    %rbp
+  8038b4:	c3                   	ret
+
+00000000008038b5 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038b5:	55                   	push   %rbp
+  8038b6:	48 89 e5             	mov    %rsp,%rbp
+  8038b9:	41 57                	push   %r15
+  8038bb:	41 56                	push   %r14
+  8038bd:	41 55                	push   %r13
+  8038bf:	41 54                	push   %r12
+  8038c1:	53                   	push   %rbx
+  8038c2:	48 83 ec 38          	sub    $0x38,%rsp
+  8038c6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038ca:	49 89 f4             	mov    %rsi,%r12
+  8038cd:	49 89 d7             	mov    %rdx,%r15
+  8038d0:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038d4:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  8038db:	00 00 00 
+  8038de:	ff d0                	call   *%rax
+  8038e0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8038e3:	4d 85 ff             	test   %r15,%r15
+  8038e6:	0f 84 f1 00 00 00    	je     8039dd <devpipe_write+0x128>
+  8038ec:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8038f0:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8038f4:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8038f8:	49 bd 8e 38 80 00 00 	movabs $0x80388e,%r13
+  8038ff:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803902:	49 bf eb 37 80 00 00 	movabs $0x8037eb,%r15
+  803909:	00 00 00 
+  80390c:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803914:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803918:	8b 73 04             	mov    0x4(%rbx),%esi
+  80391b:	48 63 ce             	movslq %esi,%rcx
+  80391e:	48 63 03             	movslq (%rbx),%rax
+  803921:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803927:	48 39 c1             	cmp    %rax,%rcx
+  80392a:	72 64                	jb     803990 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80392c:	48 89 de             	mov    %rbx,%rsi
+  80392f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803933:	41 ff d5             	call   *%r13
+  803936:	85 c0                	test   %eax,%eax
+  803938:	0f 85 b9 00 00 00    	jne    8039f7 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80393e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803942:	4c 89 f7             	mov    %r14,%rdi
+  803945:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803948:	8b 43 04             	mov    0x4(%rbx),%eax
+  80394b:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803952:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803959:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80395f:	8b 03                	mov    (%rbx),%eax
+  803961:	41 39 c4             	cmp    %eax,%r12d
+  803964:	75 b2                	jne    803918 <devpipe_write+0x63>
+  803966:	48 89 de             	mov    %rbx,%rsi
+  803969:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80396d:	41 ff d5             	call   *%r13
+  803970:	85 c0                	test   %eax,%eax
+  803972:	75 a0                	jne    803914 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803974:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803979:	44 89 e6             	mov    %r12d,%esi
+  80397c:	48 89 df             	mov    %rbx,%rdi
+  80397f:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+  80398b:	e9 7c ff ff ff       	jmp    80390c <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803990:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803994:	41 0f b6 38          	movzbl (%r8),%edi
+  803998:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80399f:	80 80 80 
+  8039a2:	48 89 c8             	mov    %rcx,%rax
+  8039a5:	48 f7 e2             	mul    %rdx
+  8039a8:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8039ac:	48 89 d0             	mov    %rdx,%rax
+  8039af:	48 c1 e0 08          	shl    $0x8,%rax
+  8039b3:	48 29 d0             	sub    %rdx,%rax
+  8039b6:	48 c1 e0 04          	shl    $0x4,%rax
+  8039ba:	48 29 c1             	sub    %rax,%rcx
+  8039bd:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8039c2:	83 c6 01             	add    $0x1,%esi
+  8039c5:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8039c8:	49 83 c0 01          	add    $0x1,%r8
+  8039cc:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8039d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039d4:	49 39 c0             	cmp    %rax,%r8
+  8039d7:	0f 85 2f ff ff ff    	jne    80390c <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8039dd:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8039e1:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8039e5:	48 b8 eb 37 80 00 00 	movabs $0x8037eb,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+    return n;
+  8039f1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039f5:	eb 05                	jmp    8039fc <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039f7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039fc:	48 83 c4 38          	add    $0x38,%rsp
+  803a00:	5b                   	pop    %rbx
+  803a01:	41 5c                	pop    %r12
+  803a03:	41 5d                	pop    %r13
+  803a05:	41 5e                	pop    %r14
+  803a07:	41 5f                	pop    %r15
+  803a09:	5d                   	pop    %rbp
+  803a0a:	c3                   	ret
+
+0000000000803a0b <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a0b:	55                   	push   %rbp
+  803a0c:	48 89 e5             	mov    %rsp,%rbp
+  803a0f:	41 57                	push   %r15
+  803a11:	41 56                	push   %r14
+  803a13:	41 55                	push   %r13
+  803a15:	41 54                	push   %r12
+  803a17:	53                   	push   %rbx
+  803a18:	48 83 ec 28          	sub    $0x28,%rsp
+  803a1c:	49 89 fd             	mov    %rdi,%r13
+  803a1f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a23:	49 89 d4             	mov    %rdx,%r12
+  803a26:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a2a:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803a31:	00 00 00 
+  803a34:	ff d0                	call   *%rax
+  803a36:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a39:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803a3f:	49 bf 8e 38 80 00 00 	movabs $0x80388e,%r15
+  803a46:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803a49:	4d 85 e4             	test   %r12,%r12
+  803a4c:	0f 84 d5 00 00 00    	je     803b27 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a52:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a56:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a5a:	8b 03                	mov    (%rbx),%eax
+  803a5c:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a5f:	75 7a                	jne    803adb <devpipe_read+0xd0>
+            if (i > 0) {
+  803a61:	4d 85 f6             	test   %r14,%r14
+  803a64:	75 50                	jne    803ab6 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a66:	48 89 de             	mov    %rbx,%rsi
+  803a69:	4c 89 ef             	mov    %r13,%rdi
+  803a6c:	41 ff d7             	call   *%r15
+  803a6f:	85 c0                	test   %eax,%eax
+  803a71:	0f 85 c9 00 00 00    	jne    803b40 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a77:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803a7a:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a81:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a87:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a8a:	41 39 c4             	cmp    %eax,%r12d
+  803a8d:	75 cb                	jne    803a5a <devpipe_read+0x4f>
+  803a8f:	48 89 de             	mov    %rbx,%rsi
+  803a92:	4c 89 ef             	mov    %r13,%rdi
+  803a95:	41 ff d7             	call   *%r15
+  803a98:	85 c0                	test   %eax,%eax
+  803a9a:	75 be                	jne    803a5a <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a9c:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803aa1:	44 89 e6             	mov    %r12d,%esi
+  803aa4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aa8:	48 b8 c6 15 80 00 00 	movabs $0x8015c6,%rax
+  803aaf:	00 00 00 
+  803ab2:	ff d0                	call   *%rax
+  803ab4:	eb a4                	jmp    803a5a <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ab6:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803aba:	48 89 de             	mov    %rbx,%rsi
+  803abd:	48 b8 eb 37 80 00 00 	movabs $0x8037eb,%rax
+  803ac4:	00 00 00 
+  803ac7:	ff d0                	call   *%rax
+                return i;
+  803ac9:	4c 89 f0             	mov    %r14,%rax
+}
+  803acc:	48 83 c4 28          	add    $0x28,%rsp
+  803ad0:	5b                   	pop    %rbx
+  803ad1:	41 5c                	pop    %r12
+  803ad3:	41 5d                	pop    %r13
+  803ad5:	41 5e                	pop    %r14
+  803ad7:	41 5f                	pop    %r15
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803adb:	48 63 c8             	movslq %eax,%rcx
+  803ade:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ae5:	80 80 80 
+  803ae8:	48 89 c8             	mov    %rcx,%rax
+  803aeb:	48 f7 e2             	mul    %rdx
+  803aee:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803af2:	48 89 d0             	mov    %rdx,%rax
+  803af5:	48 c1 e0 08          	shl    $0x8,%rax
+  803af9:	48 29 d0             	sub    %rdx,%rax
+  803afc:	48 c1 e0 04          	shl    $0x4,%rax
+  803b00:	48 89 c2             	mov    %rax,%rdx
+  803b03:	48 89 c8             	mov    %rcx,%rax
+  803b06:	48 29 d0             	sub    %rdx,%rax
+  803b09:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803b0e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b12:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803b16:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b19:	49 83 c6 01          	add    $0x1,%r14
+  803b1d:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803b21:	0f 85 2b ff ff ff    	jne    803a52 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b27:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b2b:	48 89 de             	mov    %rbx,%rsi
+  803b2e:	48 b8 eb 37 80 00 00 	movabs $0x8037eb,%rax
+  803b35:	00 00 00 
+  803b38:	ff d0                	call   *%rax
+    return n;
+  803b3a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b3e:	eb 8c                	jmp    803acc <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b45:	eb 85                	jmp    803acc <devpipe_read+0xc1>
+
+0000000000803b47 <pipe>:
+pipe(int pfd[2]) {
+  803b47:	55                   	push   %rbp
+  803b48:	48 89 e5             	mov    %rsp,%rbp
+  803b4b:	41 55                	push   %r13
+  803b4d:	41 54                	push   %r12
+  803b4f:	53                   	push   %rbx
+  803b50:	48 83 ec 18          	sub    $0x18,%rsp
+  803b54:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b57:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b5b:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+  803b67:	89 c3                	mov    %eax,%ebx
+  803b69:	85 c0                	test   %eax,%eax
+  803b6b:	0f 88 a0 01 00 00    	js     803d11 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b71:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b76:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b7b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b84:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+  803b90:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b92:	85 c0                	test   %eax,%eax
+  803b94:	0f 88 77 01 00 00    	js     803d11 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b9a:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b9e:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  803ba5:	00 00 00 
+  803ba8:	ff d0                	call   *%rax
+  803baa:	89 c3                	mov    %eax,%ebx
+  803bac:	85 c0                	test   %eax,%eax
+  803bae:	0f 88 43 01 00 00    	js     803cf7 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803bb4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bbe:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803bc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bc7:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803bce:	00 00 00 
+  803bd1:	ff d0                	call   *%rax
+  803bd3:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bd5:	85 c0                	test   %eax,%eax
+  803bd7:	0f 88 1a 01 00 00    	js     803cf7 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803bdd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803be1:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803be8:	00 00 00 
+  803beb:	ff d0                	call   *%rax
+  803bed:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803bf0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bf5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bfa:	48 89 c6             	mov    %rax,%rsi
+  803bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c02:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+  803c0e:	89 c3                	mov    %eax,%ebx
+  803c10:	85 c0                	test   %eax,%eax
+  803c12:	0f 88 c5 00 00 00    	js     803cdd <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c18:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c1c:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803c23:	00 00 00 
+  803c26:	ff d0                	call   *%rax
+  803c28:	48 89 c1             	mov    %rax,%rcx
+  803c2b:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c31:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c37:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c3c:	4c 89 ee             	mov    %r13,%rsi
+  803c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c44:	48 b8 ae 12 80 00 00 	movabs $0x8012ae,%rax
+  803c4b:	00 00 00 
+  803c4e:	ff d0                	call   *%rax
+  803c50:	89 c3                	mov    %eax,%ebx
+  803c52:	85 c0                	test   %eax,%eax
+  803c54:	78 6e                	js     803cc4 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c56:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c5b:	4c 89 ef             	mov    %r13,%rdi
+  803c5e:	48 b8 1d 12 80 00 00 	movabs $0x80121d,%rax
+  803c65:	00 00 00 
+  803c68:	ff d0                	call   *%rax
+  803c6a:	83 f8 02             	cmp    $0x2,%eax
+  803c6d:	0f 85 ab 00 00 00    	jne    803d1e <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c73:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803c7a:	00 00 
+  803c7c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c80:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c82:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c86:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c8d:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c91:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c93:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c97:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c9e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ca2:	48 bb 8b 16 80 00 00 	movabs $0x80168b,%rbx
+  803ca9:	00 00 00 
+  803cac:	ff d3                	call   *%rbx
+  803cae:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803cb2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803cb6:	ff d3                	call   *%rbx
+  803cb8:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803cbd:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cc2:	eb 4d                	jmp    803d11 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803cc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cc9:	4c 89 ee             	mov    %r13,%rsi
+  803ccc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd1:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803cd8:	00 00 00 
+  803cdb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cdd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ce2:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ce6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ceb:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803cf2:	00 00 00 
+  803cf5:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803cf7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cfc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d00:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d05:	48 b8 fe 12 80 00 00 	movabs $0x8012fe,%rax
+  803d0c:	00 00 00 
+  803d0f:	ff d0                	call   *%rax
+}
+  803d11:	89 d8                	mov    %ebx,%eax
+  803d13:	48 83 c4 18          	add    $0x18,%rsp
+  803d17:	5b                   	pop    %rbx
+  803d18:	41 5c                	pop    %r12
+  803d1a:	41 5d                	pop    %r13
+  803d1c:	5d                   	pop    %rbp
+  803d1d:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d1e:	48 b9 10 4f 80 00 00 	movabs $0x804f10,%rcx
+  803d25:	00 00 00 
+  803d28:	48 ba e7 4e 80 00 00 	movabs $0x804ee7,%rdx
+  803d2f:	00 00 00 
+  803d32:	be 50 00 00 00       	mov    $0x50,%esi
+  803d37:	48 bf fc 4e 80 00 00 	movabs $0x804efc,%rdi
+  803d3e:	00 00 00 
+  803d41:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d46:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  803d4d:	00 00 00 
+  803d50:	41 ff d0             	call   *%r8
+
+0000000000803d53 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d53:	55                   	push   %rbp
+  803d54:	48 89 e5             	mov    %rsp,%rbp
+  803d57:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d5b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d5f:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  803d66:	00 00 00 
+  803d69:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d6b:	85 c0                	test   %eax,%eax
+  803d6d:	78 23                	js     803d92 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d6f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d73:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  803d7a:	00 00 00 
+  803d7d:	ff d0                	call   *%rax
+  803d7f:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d82:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d86:	48 b8 8e 38 80 00 00 	movabs $0x80388e,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+}
+  803d92:	c9                   	leave
+  803d93:	c3                   	ret
+
+0000000000803d94 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d94:	48 89 f8             	mov    %rdi,%rax
+  803d97:	48 c1 e8 27          	shr    $0x27,%rax
+  803d9b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803da2:	01 00 00 
+  803da5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803da9:	f6 c2 01             	test   $0x1,%dl
+  803dac:	74 6d                	je     803e1b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803dae:	48 89 f8             	mov    %rdi,%rax
+  803db1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803db5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dbc:	01 00 00 
+  803dbf:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dc3:	f6 c2 01             	test   $0x1,%dl
+  803dc6:	74 62                	je     803e2a <get_uvpt_entry+0x96>
+  803dc8:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dcf:	01 00 00 
+  803dd2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dd6:	f6 c2 80             	test   $0x80,%dl
+  803dd9:	75 4f                	jne    803e2a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803ddb:	48 89 f8             	mov    %rdi,%rax
+  803dde:	48 c1 e8 15          	shr    $0x15,%rax
+  803de2:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803de9:	01 00 00 
+  803dec:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df0:	f6 c2 01             	test   $0x1,%dl
+  803df3:	74 44                	je     803e39 <get_uvpt_entry+0xa5>
+  803df5:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803dfc:	01 00 00 
+  803dff:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e03:	f6 c2 80             	test   $0x80,%dl
+  803e06:	75 31                	jne    803e39 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e08:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e0c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e13:	01 00 00 
+  803e16:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e1a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e1b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e22:	01 00 00 
+  803e25:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e29:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e2a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e31:	01 00 00 
+  803e34:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e38:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e39:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e40:	01 00 00 
+  803e43:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e47:	c3                   	ret
+
+0000000000803e48 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e48:	55                   	push   %rbp
+  803e49:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e4c:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  803e53:	00 00 00 
+  803e56:	ff d0                	call   *%rax
+  803e58:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e5b:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e60:	89 c1                	mov    %eax,%ecx
+  803e62:	83 c9 04             	or     $0x4,%ecx
+  803e65:	f6 c2 01             	test   $0x1,%dl
+  803e68:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e6b:	89 c1                	mov    %eax,%ecx
+  803e6d:	83 c9 02             	or     $0x2,%ecx
+  803e70:	f6 c2 02             	test   $0x2,%dl
+  803e73:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e76:	89 c1                	mov    %eax,%ecx
+  803e78:	83 c9 01             	or     $0x1,%ecx
+  803e7b:	48 85 d2             	test   %rdx,%rdx
+  803e7e:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e81:	89 c1                	mov    %eax,%ecx
+  803e83:	83 c9 40             	or     $0x40,%ecx
+  803e86:	f6 c6 04             	test   $0x4,%dh
+  803e89:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e8c:	5d                   	pop    %rbp
+  803e8d:	c3                   	ret
+
+0000000000803e8e <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e8e:	55                   	push   %rbp
+  803e8f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e92:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  803e99:	00 00 00 
+  803e9c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e9e:	48 c1 e8 06          	shr    $0x6,%rax
+  803ea2:	83 e0 01             	and    $0x1,%eax
+}
+  803ea5:	5d                   	pop    %rbp
+  803ea6:	c3                   	ret
+
+0000000000803ea7 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ea7:	55                   	push   %rbp
+  803ea8:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803eab:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  803eb2:	00 00 00 
+  803eb5:	ff d0                	call   *%rax
+  803eb7:	83 e0 01             	and    $0x1,%eax
+}
+  803eba:	5d                   	pop    %rbp
+  803ebb:	c3                   	ret
+
+0000000000803ebc <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803ebc:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803ec3:	01 00 00 
+  803ec6:	a8 01                	test   $0x1,%al
+  803ec8:	75 06                	jne    803ed0 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803eca:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ecf:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ed0:	55                   	push   %rbp
+  803ed1:	48 89 e5             	mov    %rsp,%rbp
+  803ed4:	41 57                	push   %r15
+  803ed6:	41 56                	push   %r14
+  803ed8:	41 55                	push   %r13
+  803eda:	41 54                	push   %r12
+  803edc:	53                   	push   %rbx
+  803edd:	48 83 ec 28          	sub    $0x28,%rsp
+  803ee1:	49 89 fe             	mov    %rdi,%r14
+  803ee4:	49 89 f7             	mov    %rsi,%r15
+  803ee7:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803eee:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803eef:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803ef6:	01 00 00 
+  803ef9:	e9 ae 00 00 00       	jmp    803fac <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803efe:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f05:	49 83 ec 01          	sub    $0x1,%r12
+  803f09:	74 2d                	je     803f38 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803f0b:	48 89 d8             	mov    %rbx,%rax
+  803f0e:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f12:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803f17:	f6 c2 01             	test   $0x1,%dl
+  803f1a:	74 e2                	je     803efe <foreach_shared_region+0x42>
+  803f1c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f21:	f6 c4 04             	test   $0x4,%ah
+  803f24:	74 d8                	je     803efe <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803f26:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f2d:	4c 89 fa             	mov    %r15,%rdx
+  803f30:	48 89 df             	mov    %rbx,%rdi
+  803f33:	41 ff d6             	call   *%r14
+  803f36:	eb c6                	jmp    803efe <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f38:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803f3f:	00 
+  803f40:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803f45:	74 4a                	je     803f91 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803f47:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f4b:	48 c1 e8 15          	shr    $0x15,%rax
+  803f4f:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803f56:	01 00 00 
+  803f59:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f5d:	a8 01                	test   $0x1,%al
+  803f5f:	74 d7                	je     803f38 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f61:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803f65:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803f6c:	48 39 c3             	cmp    %rax,%rbx
+  803f6f:	73 c7                	jae    803f38 <foreach_shared_region+0x7c>
+  803f71:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803f78:	48 39 d0             	cmp    %rdx,%rax
+  803f7b:	4d 19 e4             	sbb    %r12,%r12
+  803f7e:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f85:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f8c:	e9 7a ff ff ff       	jmp    803f0b <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803f91:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f98:	40 
+  803f99:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f9d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803fa4:	00 00 00 
+  803fa7:	48 39 c1             	cmp    %rax,%rcx
+  803faa:	74 50                	je     803ffc <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803fac:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803fb0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fb4:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803fbb:	01 00 00 
+  803fbe:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fc2:	a8 01                	test   $0x1,%al
+  803fc4:	74 cb                	je     803f91 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803fc6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803fca:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803fd1:	48 39 c1             	cmp    %rax,%rcx
+  803fd4:	73 bb                	jae    803f91 <foreach_shared_region+0xd5>
+  803fd6:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803fdd:	48 39 d0             	cmp    %rdx,%rax
+  803fe0:	48 19 c0             	sbb    %rax,%rax
+  803fe3:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803fe9:	48 05 00 02 00 00    	add    $0x200,%rax
+  803fef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ff3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803ff7:	e9 4b ff ff ff       	jmp    803f47 <foreach_shared_region+0x8b>
+  803ffc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804001:	48 83 c4 28          	add    $0x28,%rsp
+  804005:	5b                   	pop    %rbx
+  804006:	41 5c                	pop    %r12
+  804008:	41 5d                	pop    %r13
+  80400a:	41 5e                	pop    %r14
+  80400c:	41 5f                	pop    %r15
+  80400e:	5d                   	pop    %rbp
+  80400f:	c3                   	ret
+
+0000000000804010 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804010:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804016:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80401d:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804024:	c3                   	ret
+
+0000000000804025 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804025:	8b 47 40             	mov    0x40(%rdi),%eax
+  804028:	8b 17                	mov    (%rdi),%edx
+  80402a:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80402c:	83 f8 0f             	cmp    $0xf,%eax
+  80402f:	77 13                	ja     804044 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804031:	8b 47 40             	mov    0x40(%rdi),%eax
+  804034:	83 e0 0f             	and    $0xf,%eax
+  804037:	48 c1 e0 09          	shl    $0x9,%rax
+  80403b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804042:	00 
+  804043:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804049:	c3                   	ret
+
+000000000080404a <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80404a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80404d:	83 c0 01             	add    $0x1,%eax
+  804050:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804053:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804059:	8b 57 04             	mov    0x4(%rdi),%edx
+  80405c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804061:	85 d2                	test   %edx,%edx
+  804063:	75 04                	jne    804069 <chan_publish+0x1f>
+  804065:	83 e0 01             	and    $0x1,%eax
+}
+  804068:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804069:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80406c:	85 c0                	test   %eax,%eax
+  80406e:	0f 95 c0             	setne  %al
+  804071:	0f b6 c0             	movzbl %al,%eax
+  804074:	eb ef                	jmp    804065 <chan_publish+0x1b>
+
+0000000000804076 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804076:	8b 47 40             	mov    0x40(%rdi),%eax
+  804079:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80407b:	29 d0                	sub    %edx,%eax
+  80407d:	83 e8 01             	sub    $0x1,%eax
+  804080:	83 f8 0f             	cmp    $0xf,%eax
+  804083:	77 12                	ja     804097 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804085:	8b 07                	mov    (%rdi),%eax
+  804087:	83 e0 0f             	and    $0xf,%eax
+  80408a:	48 c1 e0 09          	shl    $0x9,%rax
+  80408e:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804095:	00 
+  804096:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804097:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80409c:	c3                   	ret
+
+000000000080409d <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80409d:	8b 07                	mov    (%rdi),%eax
+  80409f:	83 c0 01             	add    $0x1,%eax
+  8040a2:	89 07                	mov    %eax,(%rdi)
+}
+  8040a4:	c3                   	ret
+
+00000000008040a5 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8040a5:	55                   	push   %rbp
+  8040a6:	48 89 e5             	mov    %rsp,%rbp
+  8040a9:	53                   	push   %rbx
+  8040aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8040ae:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8040b1:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040b8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8040be:	48 b8 76 40 80 00 00 	movabs $0x804076,%rax
+  8040c5:	00 00 00 
+  8040c8:	ff d0                	call   *%rax
+  8040ca:	48 85 c0             	test   %rax,%rax
+  8040cd:	74 12                	je     8040e1 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8040cf:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8040d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040df:	c9                   	leave
+  8040e0:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8040e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040e6:	eb f3                	jmp    8040db <chan_arm+0x36>
+
+00000000008040e8 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8040e8:	55                   	push   %rbp
+  8040e9:	48 89 e5             	mov    %rsp,%rbp
+  8040ec:	41 56                	push   %r14
+  8040ee:	41 55                	push   %r13
+  8040f0:	41 54                	push   %r12
+  8040f2:	53                   	push   %rbx
+  8040f3:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8040f6:	49 bc a5 40 80 00 00 	movabs $0x8040a5,%r12
+  8040fd:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804100:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804104:	49 bd c6 15 80 00 00 	movabs $0x8015c6,%r13
+  80410b:	00 00 00 
+    while (chan_arm(r))
+  80410e:	eb 0d                	jmp    80411d <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804110:	8b 33                	mov    (%rbx),%esi
+  804112:	ba 00 00 00 00       	mov    $0x0,%edx
+  804117:	4c 89 f7             	mov    %r14,%rdi
+  80411a:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80411d:	48 89 df             	mov    %rbx,%rdi
+  804120:	41 ff d4             	call   *%r12
+  804123:	84 c0                	test   %al,%al
+  804125:	75 e9                	jne    804110 <chan_wait+0x28>
+}
+  804127:	5b                   	pop    %rbx
+  804128:	41 5c                	pop    %r12
+  80412a:	41 5d                	pop    %r13
+  80412c:	41 5e                	pop    %r14
+  80412e:	5d                   	pop    %rbp
+  80412f:	c3                   	ret
+
+0000000000804130 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804130:	55                   	push   %rbp
+  804131:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804134:	48 83 c7 40          	add    $0x40,%rdi
+  804138:	be 01 00 00 00       	mov    $0x1,%esi
+  80413d:	48 b8 e4 15 80 00 00 	movabs $0x8015e4,%rax
+  804144:	00 00 00 
+  804147:	ff d0                	call   *%rax
+}
+  804149:	5d                   	pop    %rbp
+  80414a:	c3                   	ret
+
+000000000080414b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80414b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804150:	c3                   	ret
+
+0000000000804151 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804151:	55                   	push   %rbp
+  804152:	48 89 e5             	mov    %rsp,%rbp
+  804155:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804158:	48 be 34 4f 80 00 00 	movabs $0x804f34,%rsi
+  80415f:	00 00 00 
+  804162:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  804169:	00 00 00 
+  80416c:	ff d0                	call   *%rax
+    return 0;
+}
+  80416e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804173:	5d                   	pop    %rbp
+  804174:	c3                   	ret
+
+0000000000804175 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804175:	55                   	push   %rbp
+  804176:	48 89 e5             	mov    %rsp,%rbp
+  804179:	41 57                	push   %r15
+  80417b:	41 56                	push   %r14
+  80417d:	41 55                	push   %r13
+  80417f:	41 54                	push   %r12
+  804181:	53                   	push   %rbx
+  804182:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804189:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804190:	48 85 d2             	test   %rdx,%rdx
+  804193:	74 7a                	je     80420f <devcons_write+0x9a>
+  804195:	49 89 d6             	mov    %rdx,%r14
+  804198:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80419e:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041a3:	49 bf f3 0e 80 00 00 	movabs $0x800ef3,%r15
+  8041aa:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8041ad:	4c 89 f3             	mov    %r14,%rbx
+  8041b0:	48 29 f3             	sub    %rsi,%rbx
+  8041b3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041b8:	48 39 c3             	cmp    %rax,%rbx
+  8041bb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041bf:	4c 63 eb             	movslq %ebx,%r13
+  8041c2:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041c9:	48 01 c6             	add    %rax,%rsi
+  8041cc:	4c 89 ea             	mov    %r13,%rdx
+  8041cf:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041d6:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041d9:	4c 89 ee             	mov    %r13,%rsi
+  8041dc:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041e3:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  8041ea:	00 00 00 
+  8041ed:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041ef:	41 01 dc             	add    %ebx,%r12d
+  8041f2:	49 63 f4             	movslq %r12d,%rsi
+  8041f5:	4c 39 f6             	cmp    %r14,%rsi
+  8041f8:	72 b3                	jb     8041ad <devcons_write+0x38>
+    return res;
+  8041fa:	49 63 c4             	movslq %r12d,%rax
+}
+  8041fd:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804204:	5b                   	pop    %rbx
+  804205:	41 5c                	pop    %r12
+  804207:	41 5d                	pop    %r13
+  804209:	41 5e                	pop    %r14
+  80420b:	41 5f                	pop    %r15
+  80420d:	5d                   	pop    %rbp
+  80420e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80420f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804215:	eb e3                	jmp    8041fa <devcons_write+0x85>
+
+0000000000804217 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804217:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80421a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80421f:	48 85 c0             	test   %rax,%rax
+  804222:	74 55                	je     804279 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804224:	55                   	push   %rbp
+  804225:	48 89 e5             	mov    %rsp,%rbp
+  804228:	41 55                	push   %r13
+  80422a:	41 54                	push   %r12
+  80422c:	53                   	push   %rbx
+  80422d:	48 83 ec 08          	sub    $0x8,%rsp
+  804231:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804234:	48 bb 3f 11 80 00 00 	movabs $0x80113f,%rbx
+  80423b:	00 00 00 
+  80423e:	49 bc f4 11 80 00 00 	movabs $0x8011f4,%r12
+  804245:	00 00 00 
+  804248:	eb 03                	jmp    80424d <devcons_read+0x36>
+  80424a:	41 ff d4             	call   *%r12
+  80424d:	ff d3                	call   *%rbx
+  80424f:	85 c0                	test   %eax,%eax
+  804251:	74 f7                	je     80424a <devcons_read+0x33>
+    if (c < 0) return c;
+  804253:	48 63 d0             	movslq %eax,%rdx
+  804256:	78 13                	js     80426b <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80425d:	83 f8 04             	cmp    $0x4,%eax
+  804260:	74 09                	je     80426b <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804262:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804266:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80426b:	48 89 d0             	mov    %rdx,%rax
+  80426e:	48 83 c4 08          	add    $0x8,%rsp
+  804272:	5b                   	pop    %rbx
+  804273:	41 5c                	pop    %r12
+  804275:	41 5d                	pop    %r13
+  804277:	5d                   	pop    %rbp
+  804278:	c3                   	ret
+  804279:	48 89 d0             	mov    %rdx,%rax
+  80427c:	c3                   	ret
+
+000000000080427d <cputchar>:
+cputchar(int ch) {
+  80427d:	55                   	push   %rbp
+  80427e:	48 89 e5             	mov    %rsp,%rbp
+  804281:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804285:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804289:	be 01 00 00 00       	mov    $0x1,%esi
+  80428e:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804292:	48 b8 20 11 80 00 00 	movabs $0x801120,%rax
+  804299:	00 00 00 
+  80429c:	ff d0                	call   *%rax
+}
+  80429e:	c9                   	leave
+  80429f:	c3                   	ret
+
+00000000008042a0 <getchar>:
+getchar(void) {
+  8042a0:	55                   	push   %rbp
+  8042a1:	48 89 e5             	mov    %rsp,%rbp
+  8042a4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042a8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8042ad:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b6:	48 b8 fc 19 80 00 00 	movabs $0x8019fc,%rax
+  8042bd:	00 00 00 
+  8042c0:	ff d0                	call   *%rax
+  8042c2:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042c4:	85 c0                	test   %eax,%eax
+  8042c6:	78 06                	js     8042ce <getchar+0x2e>
+  8042c8:	74 08                	je     8042d2 <getchar+0x32>
+  8042ca:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042ce:	89 d0                	mov    %edx,%eax
+  8042d0:	c9                   	leave
+  8042d1:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042d2:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042d7:	eb f5                	jmp    8042ce <getchar+0x2e>
+
+00000000008042d9 <iscons>:
+iscons(int fdnum) {
+  8042d9:	55                   	push   %rbp
+  8042da:	48 89 e5             	mov    %rsp,%rbp
+  8042dd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042e1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042e5:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8042ec:	00 00 00 
+  8042ef:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042f1:	85 c0                	test   %eax,%eax
+  8042f3:	78 18                	js     80430d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042f5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042f9:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  804300:	00 00 00 
+  804303:	8b 00                	mov    (%rax),%eax
+  804305:	39 02                	cmp    %eax,(%rdx)
+  804307:	0f 94 c0             	sete   %al
+  80430a:	0f b6 c0             	movzbl %al,%eax
+}
+  80430d:	c9                   	leave
+  80430e:	c3                   	ret
+
+000000000080430f <opencons>:
+opencons(void) {
+  80430f:	55                   	push   %rbp
+  804310:	48 89 e5             	mov    %rsp,%rbp
+  804313:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804317:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80431b:	48 b8 b9 16 80 00 00 	movabs $0x8016b9,%rax
+  804322:	00 00 00 
+  804325:	ff d0                	call   *%rax
+  804327:	85 c0                	test   %eax,%eax
+  804329:	78 49                	js     804374 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80432b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804330:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804335:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804339:	bf 00 00 00 00       	mov    $0x0,%edi
+  80433e:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  804345:	00 00 00 
+  804348:	ff d0                	call   *%rax
+  80434a:	85 c0                	test   %eax,%eax
+  80434c:	78 26                	js     804374 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80434e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804352:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804359:	00 00 
+  80435b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80435d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804361:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804368:	48 b8 8b 16 80 00 00 	movabs $0x80168b,%rax
+  80436f:	00 00 00 
+  804372:	ff d0                	call   *%rax
+}
+  804374:	c9                   	leave
+  804375:	c3                   	ret
+
+0000000000804376 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804376:	55                   	push   %rbp
+  804377:	48 89 e5             	mov    %rsp,%rbp
+  80437a:	41 56                	push   %r14
+  80437c:	41 55                	push   %r13
+  80437e:	41 54                	push   %r12
+  804380:	53                   	push   %rbx
+  804381:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804384:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80438b:	00 00 00 
+  80438e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804392:	74 27                	je     8043bb <_handle_vectored_pagefault+0x45>
+  804394:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804399:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8043a0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043a3:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8043a6:	4c 89 e7             	mov    %r12,%rdi
+  8043a9:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8043ae:	84 c0                	test   %al,%al
+  8043b0:	75 45                	jne    8043f7 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043b2:	48 83 c3 01          	add    $0x1,%rbx
+  8043b6:	49 3b 1e             	cmp    (%r14),%rbx
+  8043b9:	72 eb                	jb     8043a6 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8043bb:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8043c2:	00 
+  8043c3:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8043c8:	4d 8b 04 24          	mov    (%r12),%r8
+  8043cc:	48 ba 40 4f 80 00 00 	movabs $0x804f40,%rdx
+  8043d3:	00 00 00 
+  8043d6:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8043db:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  8043e2:	00 00 00 
+  8043e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ea:	49 ba 84 02 80 00 00 	movabs $0x800284,%r10
+  8043f1:	00 00 00 
+  8043f4:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8043f7:	5b                   	pop    %rbx
+  8043f8:	41 5c                	pop    %r12
+  8043fa:	41 5d                	pop    %r13
+  8043fc:	41 5e                	pop    %r14
+  8043fe:	5d                   	pop    %rbp
+  8043ff:	c3                   	ret
+
+0000000000804400 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804400:	55                   	push   %rbp
+  804401:	48 89 e5             	mov    %rsp,%rbp
+  804404:	53                   	push   %rbx
+  804405:	48 83 ec 08          	sub    $0x8,%rsp
+  804409:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80440c:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804413:	00 00 00 
+  804416:	80 38 00             	cmpb   $0x0,(%rax)
+  804419:	0f 84 84 00 00 00    	je     8044a3 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80441f:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804426:	00 00 00 
+  804429:	48 8b 10             	mov    (%rax),%rdx
+  80442c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804431:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804438:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80443b:	48 85 d2             	test   %rdx,%rdx
+  80443e:	74 19                	je     804459 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804440:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804444:	0f 84 e8 00 00 00    	je     804532 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80444a:	48 83 c0 01          	add    $0x1,%rax
+  80444e:	48 39 d0             	cmp    %rdx,%rax
+  804451:	75 ed                	jne    804440 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804453:	48 83 fa 08          	cmp    $0x8,%rdx
+  804457:	74 1c                	je     804475 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804459:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80445d:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804464:	00 00 00 
+  804467:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80446e:	00 00 00 
+  804471:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804475:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  80447c:	00 00 00 
+  80447f:	ff d0                	call   *%rax
+  804481:	89 c7                	mov    %eax,%edi
+  804483:	48 be f8 45 80 00 00 	movabs $0x8045f8,%rsi
+  80448a:	00 00 00 
+  80448d:	48 b8 16 14 80 00 00 	movabs $0x801416,%rax
+  804494:	00 00 00 
+  804497:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804499:	85 c0                	test   %eax,%eax
+  80449b:	78 68                	js     804505 <add_pgfault_handler+0x105>
+    return res;
+}
+  80449d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8044a1:	c9                   	leave
+  8044a2:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8044a3:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8044aa:	00 00 00 
+  8044ad:	ff d0                	call   *%rax
+  8044af:	89 c7                	mov    %eax,%edi
+  8044b1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8044b6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044bb:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8044c2:	00 00 00 
+  8044c5:	48 b8 58 12 80 00 00 	movabs $0x801258,%rax
+  8044cc:	00 00 00 
+  8044cf:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8044d1:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8044d8:	00 00 00 
+  8044db:	48 8b 02             	mov    (%rdx),%rax
+  8044de:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8044e2:	48 89 0a             	mov    %rcx,(%rdx)
+  8044e5:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8044ec:	00 00 00 
+  8044ef:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8044f3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8044fa:	00 00 00 
+  8044fd:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804500:	e9 70 ff ff ff       	jmp    804475 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804505:	89 c1                	mov    %eax,%ecx
+  804507:	48 ba 7e 4f 80 00 00 	movabs $0x804f7e,%rdx
+  80450e:	00 00 00 
+  804511:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804516:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  80451d:	00 00 00 
+  804520:	b8 00 00 00 00       	mov    $0x0,%eax
+  804525:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  80452c:	00 00 00 
+  80452f:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804532:	b8 00 00 00 00       	mov    $0x0,%eax
+  804537:	e9 61 ff ff ff       	jmp    80449d <add_pgfault_handler+0x9d>
+
+000000000080453c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80453c:	55                   	push   %rbp
+  80453d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804540:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804547:	00 00 00 
+  80454a:	80 38 00             	cmpb   $0x0,(%rax)
+  80454d:	74 33                	je     804582 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80454f:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804556:	00 00 00 
+  804559:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80455e:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804565:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804568:	48 85 c0             	test   %rax,%rax
+  80456b:	0f 84 85 00 00 00    	je     8045f6 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804571:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804575:	74 40                	je     8045b7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804577:	48 83 c1 01          	add    $0x1,%rcx
+  80457b:	48 39 c1             	cmp    %rax,%rcx
+  80457e:	75 f1                	jne    804571 <remove_pgfault_handler+0x35>
+  804580:	eb 74                	jmp    8045f6 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804582:	48 b9 96 4f 80 00 00 	movabs $0x804f96,%rcx
+  804589:	00 00 00 
+  80458c:	48 ba e7 4e 80 00 00 	movabs $0x804ee7,%rdx
+  804593:	00 00 00 
+  804596:	be 43 00 00 00       	mov    $0x43,%esi
+  80459b:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  8045a2:	00 00 00 
+  8045a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045aa:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  8045b1:	00 00 00 
+  8045b4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8045b7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8045be:	00 
+  8045bf:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8045c3:	48 29 ca             	sub    %rcx,%rdx
+  8045c6:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8045cd:	00 00 00 
+  8045d0:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8045d4:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8045d9:	48 89 ce             	mov    %rcx,%rsi
+  8045dc:	48 b8 f3 0e 80 00 00 	movabs $0x800ef3,%rax
+  8045e3:	00 00 00 
+  8045e6:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8045e8:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045ef:	00 00 00 
+  8045f2:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8045f6:	5d                   	pop    %rbp
+  8045f7:	c3                   	ret
+
+00000000008045f8 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8045f8:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8045fb:	48 b8 76 43 80 00 00 	movabs $0x804376,%rax
+  804602:	00 00 00 
+    call *%rax
+  804605:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804607:	41 5f                	pop    %r15
+	popq %r15
+  804609:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80460b:	41 5f                	pop    %r15
+	popq %r14
+  80460d:	41 5e                	pop    %r14
+	popq %r13
+  80460f:	41 5d                	pop    %r13
+	popq %r12
+  804611:	41 5c                	pop    %r12
+	popq %r11
+  804613:	41 5b                	pop    %r11
+	popq %r10
+  804615:	41 5a                	pop    %r10
+	popq %r9
+  804617:	41 59                	pop    %r9
+	popq %r8
+  804619:	41 58                	pop    %r8
+	popq %rsi
+  80461b:	5e                   	pop    %rsi
+	popq %rdi
+  80461c:	5f                   	pop    %rdi
+	popq %rbp
+  80461d:	5d                   	pop    %rbp
+	popq %rdx
+  80461e:	5a                   	pop    %rdx
+	popq %rcx
+  80461f:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804620:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804625:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80462a:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80462e:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804631:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804636:	5b                   	pop    %rbx
+	popq %rax
+  804637:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804638:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80463c:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80463d:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804642:	c3                   	ret
+
+0000000000804643 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804643:	55                   	push   %rbp
+  804644:	48 89 e5             	mov    %rsp,%rbp
+  804647:	41 55                	push   %r13
+  804649:	41 54                	push   %r12
+  80464b:	53                   	push   %rbx
+  80464c:	48 83 ec 08          	sub    $0x8,%rsp
+  804650:	49 89 fd             	mov    %rdi,%r13
+  804653:	48 89 f7             	mov    %rsi,%rdi
+  804656:	48 89 d3             	mov    %rdx,%rbx
+  804659:	49 89 cc             	mov    %rcx,%r12
+  80465c:	4c 89 c2             	mov    %r8,%rdx
+  80465f:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804662:	48 85 f6             	test   %rsi,%rsi
+  804665:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80466c:	00 00 00 
+  80466f:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804673:	be 00 10 00 00       	mov    $0x1000,%esi
+  804678:	48 85 db             	test   %rbx,%rbx
+  80467b:	74 03                	je     804680 <ipc_recv_futex+0x3d>
+  80467d:	48 8b 33             	mov    (%rbx),%rsi
+  804680:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804684:	48 b8 a2 14 80 00 00 	movabs $0x8014a2,%rax
+  80468b:	00 00 00 
+  80468e:	ff d0                	call   *%rax
+    if (res < 0) {
+  804690:	85 c0                	test   %eax,%eax
+  804692:	78 75                	js     804709 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804694:	4d 85 ed             	test   %r13,%r13
+  804697:	74 14                	je     8046ad <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804699:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8046a0:	00 00 00 
+  8046a3:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8046a9:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8046ad:	4d 85 e4             	test   %r12,%r12
+  8046b0:	74 14                	je     8046c6 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8046b2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8046b9:	00 00 00 
+  8046bc:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8046c2:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8046c6:	48 85 db             	test   %rbx,%rbx
+  8046c9:	74 23                	je     8046ee <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8046cb:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8046d2:	00 00 00 
+  8046d5:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8046db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046e0:	85 c9                	test   %ecx,%ecx
+  8046e2:	74 07                	je     8046eb <ipc_recv_futex+0xa8>
+  8046e4:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8046eb:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8046ee:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8046f5:	00 00 00 
+  8046f8:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8046fe:	48 83 c4 08          	add    $0x8,%rsp
+  804702:	5b                   	pop    %rbx
+  804703:	41 5c                	pop    %r12
+  804705:	41 5d                	pop    %r13
+  804707:	5d                   	pop    %rbp
+  804708:	c3                   	ret
+        if (from_env_store != NULL) {
+  804709:	4d 85 ed             	test   %r13,%r13
+  80470c:	74 08                	je     804716 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80470e:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804715:	00 
+        if (perm_store != NULL) {
+  804716:	4d 85 e4             	test   %r12,%r12
+  804719:	74 08                	je     804723 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80471b:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804722:	00 
+        if (size != NULL) {
+  804723:	48 85 db             	test   %rbx,%rbx
+  804726:	74 d6                	je     8046fe <ipc_recv_futex+0xbb>
+            *size = 0;
+  804728:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80472f:	eb cd                	jmp    8046fe <ipc_recv_futex+0xbb>
+
+0000000000804731 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804731:	55                   	push   %rbp
+  804732:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804735:	48 83 ec 08          	sub    $0x8,%rsp
+  804739:	6a 00                	push   $0x0
+  80473b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804741:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804747:	48 b8 43 46 80 00 00 	movabs $0x804643,%rax
+  80474e:	00 00 00 
+  804751:	ff d0                	call   *%rax
+}
+  804753:	c9                   	leave
+  804754:	c3                   	ret
+
+0000000000804755 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804755:	55                   	push   %rbp
+  804756:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804759:	48 85 d2             	test   %rdx,%rdx
+  80475c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804763:	00 00 00 
+  804766:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80476a:	89 f6                	mov    %esi,%esi
+  80476c:	48 b8 8b 14 80 00 00 	movabs $0x80148b,%rax
+  804773:	00 00 00 
+  804776:	ff d0                	call   *%rax
+    if (res < 0) {
+  804778:	85 c0                	test   %eax,%eax
+  80477a:	78 02                	js     80477e <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80477c:	5d                   	pop    %rbp
+  80477d:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80477e:	89 c1                	mov    %eax,%ecx
+  804780:	48 ba b0 4f 80 00 00 	movabs $0x804fb0,%rdx
+  804787:	00 00 00 
+  80478a:	be 50 00 00 00       	mov    $0x50,%esi
+  80478f:	48 bf c4 4f 80 00 00 	movabs $0x804fc4,%rdi
+  804796:	00 00 00 
+  804799:	b8 00 00 00 00       	mov    $0x0,%eax
+  80479e:	49 b8 84 02 80 00 00 	movabs $0x800284,%r8
+  8047a5:	00 00 00 
+  8047a8:	41 ff d0             	call   *%r8
+
+00000000008047ab <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8047ab:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8047b0:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8047b7:	00 00 00 
+  8047ba:	48 89 d0             	mov    %rdx,%rax
+  8047bd:	48 c1 e0 04          	shl    $0x4,%rax
+  8047c1:	48 29 d0             	sub    %rdx,%rax
+  8047c4:	48 c1 e0 05          	shl    $0x5,%rax
+  8047c8:	48 01 c8             	add    %rcx,%rax
+  8047cb:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8047d1:	39 f8                	cmp    %edi,%eax
+  8047d3:	74 13                	je     8047e8 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8047d5:	48 83 c2 01          	add    $0x1,%rdx
+  8047d9:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8047e0:	75 d8                	jne    8047ba <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8047e2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047e7:	c3                   	ret
+            return envs[i].env_id;
+  8047e8:	48 89 d0             	mov    %rdx,%rax
+  8047eb:	48 c1 e0 04          	shl    $0x4,%rax
+  8047ef:	48 29 d0             	sub    %rdx,%rax
+  8047f2:	48 c1 e0 05          	shl    $0x5,%rax
+  8047f6:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8047fd:	00 00 00 
+  804800:	48 01 d0             	add    %rdx,%rax
+  804803:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804809:	c3                   	ret
+  80480a:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804810 <__rodata_start>:
+  804810:	73 79                	jae    80488b <__rodata_start+0x7b>
+  804812:	73 5f                	jae    804873 <__rodata_start+0x63>
+  804814:	65 78 6f             	gs js  804886 <__rodata_start+0x76>
+  804817:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804819:	72 6b                	jb     804886 <__rodata_start+0x76>
+  80481b:	3a 20                	cmp    (%rax),%ah
+  80481d:	25 69 00 75 73       	and    $0x73750069,%eax
+  804822:	65 72 2f             	gs jb  804854 <__rodata_start+0x44>
+  804825:	64 75 6d             	fs jne 804895 <__rodata_start+0x85>
+  804828:	62 66 6f 72 6b       	(bad)
+  80482d:	2e 63 00             	cs movsxd (%rax),%eax
+  804830:	73 79                	jae    8048ab <__rodata_start+0x9b>
+  804832:	73 5f                	jae    804893 <__rodata_start+0x83>
+  804834:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804836:	76 5f                	jbe    804897 <__rodata_start+0x87>
+  804838:	73 65                	jae    80489f <__rodata_start+0x8f>
+  80483a:	74 5f                	je     80489b <__rodata_start+0x8b>
+  80483c:	73 74                	jae    8048b2 <__rodata_start+0xa2>
+  80483e:	61                   	(bad)
+  80483f:	74 75                	je     8048b6 <__rodata_start+0xa6>
+  804841:	73 3a                	jae    80487d <__rodata_start+0x6d>
+  804843:	20 25 69 00 70 61    	and    %ah,0x61700069(%rip)        # 61f048b2 <__bss_end+0x616c28b2>
+  804849:	72 65                	jb     8048b0 <__rodata_start+0xa0>
+  80484b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80484c:	74 00                	je     80484e <__rodata_start+0x3e>
+  80484e:	63 68 69             	movsxd 0x69(%rax),%ebp
+  804851:	6c                   	insb   (%dx),%es:(%rdi)
+  804852:	64 00 25 64 3a 20 49 	add    %ah,%fs:0x49203a64(%rip)        # 49a082bd <__bss_end+0x491c62bd>
+  804859:	20 61 6d             	and    %ah,0x6d(%rcx)
+  80485c:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  804860:	20 25 73 21 0a 00    	and    %ah,0xa2173(%rip)        # 8a69d9 <__bss_end+0x649d9>
+  804866:	3c 75                	cmp    $0x75,%al
+  804868:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804869:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80486d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80486e:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  804872:	30 38                	xor    %bh,(%rax)
+  804874:	78 5d                	js     8048d3 <__rodata_start+0xc3>
+  804876:	20 75 73             	and    %dh,0x73(%rbp)
+  804879:	65 72 20             	gs jb  80489c <__rodata_start+0x8c>
+  80487c:	70 61                	jo     8048df <__rodata_start+0xcf>
+  80487e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80487f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804886:	73 20                	jae    8048a8 <__rodata_start+0x98>
+  804888:	61                   	(bad)
+  804889:	74 20                	je     8048ab <__rodata_start+0x9b>
+  80488b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804890:	3a 20                	cmp    (%rax),%ah
+  804892:	00 30                	add    %dh,(%rax)
+  804894:	31 32                	xor    %esi,(%rdx)
+  804896:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80489d:	41                   	rex.B
+  80489e:	42                   	rex.X
+  80489f:	43                   	rex.XB
+  8048a0:	44                   	rex.R
+  8048a1:	45                   	rex.RB
+  8048a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8048a5:	31 32                	xor    %esi,(%rdx)
+  8048a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048ae:	61                   	(bad)
+  8048af:	62 63 64 65 66       	(bad)
+  8048b4:	00 28                	add    %ch,(%rax)
+  8048b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048b7:	75 6c                	jne    804925 <__rodata_start+0x115>
+  8048b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8048ba:	29 00                	sub    %eax,(%rax)
+  8048bc:	65 72 72             	gs jb  804931 <__rodata_start+0x121>
+  8048bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048c0:	72 20                	jb     8048e2 <__rodata_start+0xd2>
+  8048c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8048c7:	73 70                	jae    804939 <__rodata_start+0x129>
+  8048c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8048cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8048d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048d5:	72 00                	jb     8048d7 <__rodata_start+0xc7>
+  8048d7:	62 61 64 20 65       	(bad)
+  8048dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048dd:	76 69                	jbe    804948 <__rodata_start+0x138>
+  8048df:	72 6f                	jb     804950 <__rodata_start+0x140>
+  8048e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8048e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048e5:	74 00                	je     8048e7 <__rodata_start+0xd7>
+  8048e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048ee:	20 70 61             	and    %dh,0x61(%rax)
+  8048f1:	72 61                	jb     804954 <__rodata_start+0x144>
+  8048f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8048f4:	65 74 65             	gs je  80495c <__rodata_start+0x14c>
+  8048f7:	72 00                	jb     8048f9 <__rodata_start+0xe9>
+  8048f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048fa:	75 74                	jne    804970 <__rodata_start+0x160>
+  8048fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8048ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  804902:	6d                   	insl   (%dx),%es:(%rdi)
+  804903:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804904:	72 79                	jb     80497f <__rodata_start+0x16f>
+  804906:	00 6f 75             	add    %ch,0x75(%rdi)
+  804909:	74 20                	je     80492b <__rodata_start+0x11b>
+  80490b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804910:	76 69                	jbe    80497b <__rodata_start+0x16b>
+  804912:	72 6f                	jb     804983 <__rodata_start+0x173>
+  804914:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804915:	6d                   	insl   (%dx),%es:(%rdi)
+  804916:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804918:	74 73                	je     80498d <__rodata_start+0x17d>
+  80491a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80491d:	72 72                	jb     804991 <__rodata_start+0x181>
+  80491f:	75 70                	jne    804991 <__rodata_start+0x181>
+  804921:	74 65                	je     804988 <__rodata_start+0x178>
+  804923:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804928:	75 67                	jne    804991 <__rodata_start+0x181>
+  80492a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80492d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80492f:	00 73 65             	add    %dh,0x65(%rbx)
+  804932:	67 6d                	insl   (%dx),%es:(%edi)
+  804934:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804936:	74 61                	je     804999 <__rodata_start+0x189>
+  804938:	74 69                	je     8049a3 <__rodata_start+0x193>
+  80493a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80493b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80493c:	20 66 61             	and    %ah,0x61(%rsi)
+  80493f:	75 6c                	jne    8049ad <__rodata_start+0x19d>
+  804941:	74 00                	je     804943 <__rodata_start+0x133>
+  804943:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80494a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80494d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804951:	61                   	(bad)
+  804952:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804957:	20 73 75             	and    %dh,0x75(%rbx)
+  80495a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80495d:	73 79                	jae    8049d8 <__rodata_start+0x1c8>
+  80495f:	73 74                	jae    8049d5 <__rodata_start+0x1c5>
+  804961:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804963:	20 63 61             	and    %ah,0x61(%rbx)
+  804966:	6c                   	insb   (%dx),%es:(%rdi)
+  804967:	6c                   	insb   (%dx),%es:(%rdi)
+  804968:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80496b:	74 72                	je     8049df <__rodata_start+0x1cf>
+  80496d:	79 20                	jns    80498f <__rodata_start+0x17f>
+  80496f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804970:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804971:	74 20                	je     804993 <__rodata_start+0x183>
+  804973:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804975:	75 6e                	jne    8049e5 <__rodata_start+0x1d5>
+  804977:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80497b:	76 20                	jbe    80499d <__rodata_start+0x18d>
+  80497d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804984:	72 65                	jb     8049eb <__rodata_start+0x1db>
+  804986:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804989:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80498a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80498e:	65 78 70             	gs js  804a01 <__rodata_start+0x1f1>
+  804991:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804996:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804999:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80499d:	20 66 69             	and    %ah,0x69(%rsi)
+  8049a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8049a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8049a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8049a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8049ad:	61                   	(bad)
+  8049ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8049b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8049b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8049ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8049bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049c0:	79 20                	jns    8049e2 <__rodata_start+0x1d2>
+  8049c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8049c9:	72 65                	jb     804a30 <__rodata_start+0x220>
+  8049cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8049ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8049d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8049d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8049d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8049db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8049df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e1:	74 20                	je     804a03 <__rodata_start+0x1f3>
+  8049e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049e5:	75 6e                	jne    804a55 <__rodata_start+0x245>
+  8049e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8049eb:	76 61                	jbe    804a4e <__rodata_start+0x23e>
+  8049ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8049ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8049f5:	00 
+  8049f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8049fd:	72 65                	jb     804a64 <__rodata_start+0x254>
+  8049ff:	61                   	(bad)
+  804a00:	64 79 20             	fs jns 804a23 <__rodata_start+0x213>
+  804a03:	65 78 69             	gs js  804a6f <__rodata_start+0x25f>
+  804a06:	73 74                	jae    804a7c <__rodata_start+0x26c>
+  804a08:	73 00                	jae    804a0a <__rodata_start+0x1fa>
+  804a0a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a0b:	70 65                	jo     804a72 <__rodata_start+0x262>
+  804a0d:	72 61                	jb     804a70 <__rodata_start+0x260>
+  804a0f:	74 69                	je     804a7a <__rodata_start+0x26a>
+  804a11:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a12:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a13:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a16:	74 20                	je     804a38 <__rodata_start+0x228>
+  804a18:	73 75                	jae    804a8f <__rodata_start+0x27f>
+  804a1a:	70 70                	jo     804a8c <__rodata_start+0x27c>
+  804a1c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a1d:	72 74                	jb     804a93 <__rodata_start+0x283>
+  804a1f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a25:	20 61 67             	and    %ah,0x67(%rcx)
+  804a28:	61                   	(bad)
+  804a29:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804a30:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804a34:	74 00                	je     804a36 <__rodata_start+0x226>
+  804a36:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804a3d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a40:	20 75 73             	and    %dh,0x73(%rbp)
+  804a43:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804a47:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804a4e:	00 
+  804a4f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804a56:	00 00 00 
+  804a59:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  804a60:	c1 05 80 00 00 00 00 	roll   $0x0,0x80(%rip)        # 804ae7 <__rodata_start+0x2d7>
+  804a67:	00 02                	add    %al,(%rdx)
+  804a69:	0c 80                	or     $0x80,%al
+  804a6b:	00 00                	add    %al,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 f2                	add    %dh,%dl
+  804a71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a77:	00 02                	add    %al,(%rdx)
+  804a79:	0c 80                	or     $0x80,%al
+  804a7b:	00 00                	add    %al,(%rax)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 02                	add    %al,(%rdx)
+  804a81:	0c 80                	or     $0x80,%al
+  804a83:	00 00                	add    %al,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 02                	add    %al,(%rdx)
+  804a89:	0c 80                	or     $0x80,%al
+  804a8b:	00 00                	add    %al,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 02                	add    %al,(%rdx)
+  804a91:	0c 80                	or     $0x80,%al
+  804a93:	00 00                	add    %al,(%rax)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 e0                	add    %ah,%al
+  804a99:	05 80 00 00 00       	add    $0x80,%eax
+  804a9e:	00 00                	add    %al,(%rax)
+  804aa0:	02 0c 80             	add    (%rax,%rax,4),%cl
+  804aa3:	00 00                	add    %al,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 02                	add    %al,(%rdx)
+  804aa9:	0c 80                	or     $0x80,%al
+  804aab:	00 00                	add    %al,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 d4                	add    %dl,%ah
+  804ab1:	05 80 00 00 00       	add    $0x80,%eax
+  804ab6:	00 00                	add    %al,(%rax)
+  804ab8:	4e 06                	rex.WRX (bad)
+  804aba:	80 00 00             	addb   $0x0,(%rax)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 02                	add    %al,(%rdx)
+  804ac1:	0c 80                	or     $0x80,%al
+  804ac3:	00 00                	add    %al,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 d4                	add    %dl,%ah
+  804ac9:	05 80 00 00 00       	add    $0x80,%eax
+  804ace:	00 00                	add    %al,(%rax)
+  804ad0:	1a 06                	sbb    (%rsi),%al
+  804ad2:	80 00 00             	addb   $0x0,(%rax)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 1a                	add    %bl,(%rdx)
+  804ad9:	06                   	(bad)
+  804ada:	80 00 00             	addb   $0x0,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 1a                	add    %bl,(%rdx)
+  804ae1:	06                   	(bad)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 1a                	add    %bl,(%rdx)
+  804ae9:	06                   	(bad)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 1a                	add    %bl,(%rdx)
+  804af1:	06                   	(bad)
+  804af2:	80 00 00             	addb   $0x0,(%rax)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 1a                	add    %bl,(%rdx)
+  804af9:	06                   	(bad)
+  804afa:	80 00 00             	addb   $0x0,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 1a                	add    %bl,(%rdx)
+  804b01:	06                   	(bad)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 1a                	add    %bl,(%rdx)
+  804b09:	06                   	(bad)
+  804b0a:	80 00 00             	addb   $0x0,(%rax)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 1a                	add    %bl,(%rdx)
+  804b11:	06                   	(bad)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 02                	add    %al,(%rdx)
+  804b19:	0c 80                	or     $0x80,%al
+  804b1b:	00 00                	add    %al,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 02                	add    %al,(%rdx)
+  804b21:	0c 80                	or     $0x80,%al
+  804b23:	00 00                	add    %al,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 02                	add    %al,(%rdx)
+  804b29:	0c 80                	or     $0x80,%al
+  804b2b:	00 00                	add    %al,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 02                	add    %al,(%rdx)
+  804b31:	0c 80                	or     $0x80,%al
+  804b33:	00 00                	add    %al,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 02                	add    %al,(%rdx)
+  804b39:	0c 80                	or     $0x80,%al
+  804b3b:	00 00                	add    %al,(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 02                	add    %al,(%rdx)
+  804b41:	0c 80                	or     $0x80,%al
+  804b43:	00 00                	add    %al,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 02                	add    %al,(%rdx)
+  804b49:	0c 80                	or     $0x80,%al
+  804b4b:	00 00                	add    %al,(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 02                	add    %al,(%rdx)
+  804b51:	0c 80                	or     $0x80,%al
+  804b53:	00 00                	add    %al,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 02                	add    %al,(%rdx)
+  804b59:	0c 80                	or     $0x80,%al
+  804b5b:	00 00                	add    %al,(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 02                	add    %al,(%rdx)
+  804b61:	0c 80                	or     $0x80,%al
+  804b63:	00 00                	add    %al,(%rax)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 02                	add    %al,(%rdx)
+  804b69:	0c 80                	or     $0x80,%al
+  804b6b:	00 00                	add    %al,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 02                	add    %al,(%rdx)
+  804b71:	0c 80                	or     $0x80,%al
+  804b73:	00 00                	add    %al,(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 02                	add    %al,(%rdx)
+  804b79:	0c 80                	or     $0x80,%al
+  804b7b:	00 00                	add    %al,(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 02                	add    %al,(%rdx)
+  804b81:	0c 80                	or     $0x80,%al
+  804b83:	00 00                	add    %al,(%rax)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 02                	add    %al,(%rdx)
+  804b89:	0c 80                	or     $0x80,%al
+  804b8b:	00 00                	add    %al,(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 02                	add    %al,(%rdx)
+  804b91:	0c 80                	or     $0x80,%al
+  804b93:	00 00                	add    %al,(%rax)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 02                	add    %al,(%rdx)
+  804b99:	0c 80                	or     $0x80,%al
+  804b9b:	00 00                	add    %al,(%rax)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 02                	add    %al,(%rdx)
+  804ba1:	0c 80                	or     $0x80,%al
+  804ba3:	00 00                	add    %al,(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 02                	add    %al,(%rdx)
+  804ba9:	0c 80                	or     $0x80,%al
+  804bab:	00 00                	add    %al,(%rax)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 02                	add    %al,(%rdx)
+  804bb1:	0c 80                	or     $0x80,%al
+  804bb3:	00 00                	add    %al,(%rax)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 02                	add    %al,(%rdx)
+  804bb9:	0c 80                	or     $0x80,%al
+  804bbb:	00 00                	add    %al,(%rax)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 02                	add    %al,(%rdx)
+  804bc1:	0c 80                	or     $0x80,%al
+  804bc3:	00 00                	add    %al,(%rax)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 02                	add    %al,(%rdx)
+  804bc9:	0c 80                	or     $0x80,%al
+  804bcb:	00 00                	add    %al,(%rax)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 02                	add    %al,(%rdx)
+  804bd1:	0c 80                	or     $0x80,%al
+  804bd3:	00 00                	add    %al,(%rax)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 02                	add    %al,(%rdx)
+  804bd9:	0c 80                	or     $0x80,%al
+  804bdb:	00 00                	add    %al,(%rax)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 02                	add    %al,(%rdx)
+  804be1:	0c 80                	or     $0x80,%al
+  804be3:	00 00                	add    %al,(%rax)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 02                	add    %al,(%rdx)
+  804be9:	0c 80                	or     $0x80,%al
+  804beb:	00 00                	add    %al,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 02                	add    %al,(%rdx)
+  804bf1:	0c 80                	or     $0x80,%al
+  804bf3:	00 00                	add    %al,(%rax)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 02                	add    %al,(%rdx)
+  804bf9:	0c 80                	or     $0x80,%al
+  804bfb:	00 00                	add    %al,(%rax)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 02                	add    %al,(%rdx)
+  804c01:	0c 80                	or     $0x80,%al
+  804c03:	00 00                	add    %al,(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 25 0b 80 00 00    	add    %ah,0x800b(%rip)        # 80cc18 <__ctors_end+0x7b38>
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 02                	add    %al,(%rdx)
+  804c11:	0c 80                	or     $0x80,%al
+  804c13:	00 00                	add    %al,(%rax)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 02                	add    %al,(%rdx)
+  804c19:	0c 80                	or     $0x80,%al
+  804c1b:	00 00                	add    %al,(%rax)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 02                	add    %al,(%rdx)
+  804c21:	0c 80                	or     $0x80,%al
+  804c23:	00 00                	add    %al,(%rax)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 02                	add    %al,(%rdx)
+  804c29:	0c 80                	or     $0x80,%al
+  804c2b:	00 00                	add    %al,(%rax)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 02                	add    %al,(%rdx)
+  804c31:	0c 80                	or     $0x80,%al
+  804c33:	00 00                	add    %al,(%rax)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 02                	add    %al,(%rdx)
+  804c39:	0c 80                	or     $0x80,%al
+  804c3b:	00 00                	add    %al,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 02                	add    %al,(%rdx)
+  804c41:	0c 80                	or     $0x80,%al
+  804c43:	00 00                	add    %al,(%rax)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 02                	add    %al,(%rdx)
+  804c49:	0c 80                	or     $0x80,%al
+  804c4b:	00 00                	add    %al,(%rax)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 02                	add    %al,(%rdx)
+  804c51:	0c 80                	or     $0x80,%al
+  804c53:	00 00                	add    %al,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 02                	add    %al,(%rdx)
+  804c59:	0c 80                	or     $0x80,%al
+  804c5b:	00 00                	add    %al,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 71 06             	add    %dh,0x6(%rcx)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 40 08             	add    %al,0x8(%rax)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 02                	add    %al,(%rdx)
+  804c71:	0c 80                	or     $0x80,%al
+  804c73:	00 00                	add    %al,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 02                	add    %al,(%rdx)
+  804c79:	0c 80                	or     $0x80,%al
+  804c7b:	00 00                	add    %al,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 02                	add    %al,(%rdx)
+  804c81:	0c 80                	or     $0x80,%al
+  804c83:	00 00                	add    %al,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 02                	add    %al,(%rdx)
+  804c89:	0c 80                	or     $0x80,%al
+  804c8b:	00 00                	add    %al,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 a0 06 80 00 00    	add    %ah,0x8006(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 02                	add    %al,(%rdx)
+  804c99:	0c 80                	or     $0x80,%al
+  804c9b:	00 00                	add    %al,(%rax)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 02                	add    %al,(%rdx)
+  804ca1:	0c 80                	or     $0x80,%al
+  804ca3:	00 00                	add    %al,(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 66 06             	add    %ah,0x6(%rsi)
+  804caa:	80 00 00             	addb   $0x0,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 02                	add    %al,(%rdx)
+  804cb1:	0c 80                	or     $0x80,%al
+  804cb3:	00 00                	add    %al,(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 02                	add    %al,(%rdx)
+  804cb9:	0c 80                	or     $0x80,%al
+  804cbb:	00 00                	add    %al,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 e8                	add    %ch,%al
+  804cc1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804cc7:	00 b2 0a 80 00 00    	add    %dh,0x800a(%rdx)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 02                	add    %al,(%rdx)
+  804cd1:	0c 80                	or     $0x80,%al
+  804cd3:	00 00                	add    %al,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 02                	add    %al,(%rdx)
+  804cd9:	0c 80                	or     $0x80,%al
+  804cdb:	00 00                	add    %al,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 37                	add    %dh,(%rdi)
+  804ce1:	07                   	(bad)
+  804ce2:	80 00 00             	addb   $0x0,(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 02                	add    %al,(%rdx)
+  804ce9:	0c 80                	or     $0x80,%al
+  804ceb:	00 00                	add    %al,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 14 09             	add    %dl,(%rcx,%rcx,1)
+  804cf2:	80 00 00             	addb   $0x0,(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 02                	add    %al,(%rdx)
+  804cf9:	0c 80                	or     $0x80,%al
+  804cfb:	00 00                	add    %al,(%rax)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 02                	add    %al,(%rdx)
+  804d01:	0c 80                	or     $0x80,%al
+  804d03:	00 00                	add    %al,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 25 0b 80 00 00    	add    %ah,0x800b(%rip)        # 80cd18 <__ctors_end+0x7c38>
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 02                	add    %al,(%rdx)
+  804d11:	0c 80                	or     $0x80,%al
+  804d13:	00 00                	add    %al,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 ca                	add    %cl,%dl
+  804d19:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804d20 <error_string>:
+	...
+  804d28:	c5 48 80 00 00 00 00 00 d7 48 80 00 00 00 00 00     .H.......H......
+  804d38:	e7 48 80 00 00 00 00 00 f9 48 80 00 00 00 00 00     .H.......H......
+  804d48:	07 49 80 00 00 00 00 00 1b 49 80 00 00 00 00 00     .I.......I......
+  804d58:	30 49 80 00 00 00 00 00 43 49 80 00 00 00 00 00     0I......CI......
+  804d68:	55 49 80 00 00 00 00 00 69 49 80 00 00 00 00 00     UI......iI......
+  804d78:	79 49 80 00 00 00 00 00 8c 49 80 00 00 00 00 00     yI.......I......
+  804d88:	a3 49 80 00 00 00 00 00 b9 49 80 00 00 00 00 00     .I.......I......
+  804d98:	d1 49 80 00 00 00 00 00 e9 49 80 00 00 00 00 00     .I.......I......
+  804da8:	f6 49 80 00 00 00 00 00 d8 4d 80 00 00 00 00 00     .I.......M......
+  804db8:	0a 4a 80 00 00 00 00 00 22 4a 80 00 00 00 00 00     .J......"J......
+  804dc8:	2c 4a 80 00 00 00 00 00 36 4a 80 00 00 00 00 00     ,J......6J......
+  804dd8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804de8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804df8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804e28:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804e38:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804e48:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804e58:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804e68:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804e78:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804e88:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804e98:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ea8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804ec0 <devtab>:
+  804ec0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804ed0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804ee0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804ef0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804f00:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804f10:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804f20:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804f30:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804f40:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804f50:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804f60:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804f70:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804f80:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804f90:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804fa0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804fb0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804fc0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
@@ -0,0 +1,7947 @@
+
+obj/user/echo:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 f0 00 00 00       	call   800113 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, nflag;
+
+    nflag = 0;
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800036:	83 ff 01             	cmp    $0x1,%edi
+  800039:	7f 25                	jg     800060 <umain+0x3b>
+        if (i > 1)
+            write(1, " ", 1);
+        write(1, argv[i], strlen(argv[i]));
+    }
+    if (!nflag)
+        write(1, "\n", 1);
+  80003b:	ba 01 00 00 00       	mov    $0x1,%edx
+  800040:	48 be 0b 48 80 00 00 	movabs $0x80480b,%rsi
+  800047:	00 00 00 
+  80004a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80004f:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  800056:	00 00 00 
+  800059:	ff d0                	call   *%rax
+}
+  80005b:	e9 a4 00 00 00       	jmp    800104 <umain+0xdf>
+  800060:	41 89 fe             	mov    %edi,%r14d
+  800063:	49 89 f4             	mov    %rsi,%r12
+    if (argc > 1 && strcmp(argv[1], "-n") == 0) {
+  800066:	48 8b 7e 08          	mov    0x8(%rsi),%rdi
+  80006a:	48 be 70 47 80 00 00 	movabs $0x804770,%rsi
+  800071:	00 00 00 
+  800074:	48 b8 cb 02 80 00 00 	movabs $0x8002cb,%rax
+  80007b:	00 00 00 
+  80007e:	ff d0                	call   *%rax
+  800080:	85 c0                	test   %eax,%eax
+  800082:	75 30                	jne    8000b4 <umain+0x8f>
+        argc--;
+  800084:	41 83 ee 01          	sub    $0x1,%r14d
+        argv++;
+  800088:	49 83 c4 08          	add    $0x8,%r12
+    for (i = 1; i < argc; i++) {
+  80008c:	41 83 fe 01          	cmp    $0x1,%r14d
+  800090:	7e 72                	jle    800104 <umain+0xdf>
+        nflag = 1;
+  800092:	c7 45 cc 01 00 00 00 	movl   $0x1,-0x34(%rbp)
+  800099:	bb 01 00 00 00       	mov    $0x1,%ebx
+            write(1, " ", 1);
+  80009e:	49 bd 59 10 80 00 00 	movabs $0x801059,%r13
+  8000a5:	00 00 00 
+        write(1, argv[i], strlen(argv[i]));
+  8000a8:	49 bf e9 01 80 00 00 	movabs $0x8001e9,%r15
+  8000af:	00 00 00 
+  8000b2:	eb 28                	jmp    8000dc <umain+0xb7>
+    nflag = 0;
+  8000b4:	c7 45 cc 00 00 00 00 	movl   $0x0,-0x34(%rbp)
+  8000bb:	eb dc                	jmp    800099 <umain+0x74>
+        write(1, argv[i], strlen(argv[i]));
+  8000bd:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8000c1:	41 ff d7             	call   *%r15
+  8000c4:	48 89 c2             	mov    %rax,%rdx
+  8000c7:	49 8b 34 dc          	mov    (%r12,%rbx,8),%rsi
+  8000cb:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000d0:	41 ff d5             	call   *%r13
+    for (i = 1; i < argc; i++) {
+  8000d3:	48 83 c3 01          	add    $0x1,%rbx
+  8000d7:	41 39 de             	cmp    %ebx,%r14d
+  8000da:	7e 1e                	jle    8000fa <umain+0xd5>
+        if (i > 1)
+  8000dc:	83 fb 01             	cmp    $0x1,%ebx
+  8000df:	7e dc                	jle    8000bd <umain+0x98>
+            write(1, " ", 1);
+  8000e1:	ba 01 00 00 00       	mov    $0x1,%edx
+  8000e6:	48 be 73 47 80 00 00 	movabs $0x804773,%rsi
+  8000ed:	00 00 00 
+  8000f0:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000f5:	41 ff d5             	call   *%r13
+  8000f8:	eb c3                	jmp    8000bd <umain+0x98>
+    if (!nflag)
+  8000fa:	83 7d cc 00          	cmpl   $0x0,-0x34(%rbp)
+  8000fe:	0f 84 37 ff ff ff    	je     80003b <umain+0x16>
+}
+  800104:	48 83 c4 18          	add    $0x18,%rsp
+  800108:	5b                   	pop    %rbx
+  800109:	41 5c                	pop    %r12
+  80010b:	41 5d                	pop    %r13
+  80010d:	41 5e                	pop    %r14
+  80010f:	41 5f                	pop    %r15
+  800111:	5d                   	pop    %rbp
+  800112:	c3                   	ret
+
+0000000000800113 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800113:	55                   	push   %rbp
+  800114:	48 89 e5             	mov    %rsp,%rbp
+  800117:	41 56                	push   %r14
+  800119:	41 55                	push   %r13
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+  80011e:	41 89 fd             	mov    %edi,%r13d
+  800121:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800124:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  80012b:	00 00 00 
+  80012e:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800135:	00 00 00 
+  800138:	48 39 c2             	cmp    %rax,%rdx
+  80013b:	73 17                	jae    800154 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80013d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	49 89 c4             	mov    %rax,%r12
+  800143:	48 83 c3 08          	add    $0x8,%rbx
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	ff 53 f8             	call   *-0x8(%rbx)
+  80014f:	4c 39 e3             	cmp    %r12,%rbx
+  800152:	72 ef                	jb     800143 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800154:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+  800160:	89 c2                	mov    %eax,%edx
+  800162:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800168:	48 89 d0             	mov    %rdx,%rax
+  80016b:	48 c1 e0 04          	shl    $0x4,%rax
+  80016f:	48 29 d0             	sub    %rdx,%rax
+  800172:	48 c1 e0 05          	shl    $0x5,%rax
+  800176:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80017d:	00 00 00 
+  800180:	48 01 d0             	add    %rdx,%rax
+  800183:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80018a:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80018d:	45 85 ed             	test   %r13d,%r13d
+  800190:	7e 0d                	jle    80019f <libmain+0x8c>
+  800192:	49 8b 06             	mov    (%r14),%rax
+  800195:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80019c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80019f:	4c 89 f6             	mov    %r14,%rsi
+  8001a2:	44 89 ef             	mov    %r13d,%edi
+  8001a5:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001ac:	00 00 00 
+  8001af:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001b1:	48 b8 c6 01 80 00 00 	movabs $0x8001c6,%rax
+  8001b8:	00 00 00 
+  8001bb:	ff d0                	call   *%rax
+#endif
+}
+  8001bd:	5b                   	pop    %rbx
+  8001be:	41 5c                	pop    %r12
+  8001c0:	41 5d                	pop    %r13
+  8001c2:	41 5e                	pop    %r14
+  8001c4:	5d                   	pop    %rbp
+  8001c5:	c3                   	ret
+
+00000000008001c6 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c6:	55                   	push   %rbp
+  8001c7:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ca:	48 b8 df 0d 80 00 00 	movabs $0x800ddf,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001db:	48 b8 96 06 80 00 00 	movabs $0x800696,%rax
+  8001e2:	00 00 00 
+  8001e5:	ff d0                	call   *%rax
+}
+  8001e7:	5d                   	pop    %rbp
+  8001e8:	c3                   	ret
+
+00000000008001e9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8001e9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8001ec:	74 10                	je     8001fe <strlen+0x15>
+    size_t n = 0;
+  8001ee:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8001f3:	48 83 c0 01          	add    $0x1,%rax
+  8001f7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8001fb:	75 f6                	jne    8001f3 <strlen+0xa>
+  8001fd:	c3                   	ret
+    size_t n = 0;
+  8001fe:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800203:	c3                   	ret
+
+0000000000800204 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800204:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800207:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80020c:	48 85 f6             	test   %rsi,%rsi
+  80020f:	74 11                	je     800222 <strnlen+0x1e>
+  800211:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800215:	74 0c                	je     800223 <strnlen+0x1f>
+  800217:	48 83 c2 01          	add    $0x1,%rdx
+  80021b:	48 39 d0             	cmp    %rdx,%rax
+  80021e:	75 f1                	jne    800211 <strnlen+0xd>
+  800220:	eb 04                	jmp    800226 <strnlen+0x22>
+  800222:	c3                   	ret
+  800223:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800226:	c3                   	ret
+
+0000000000800227 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800227:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80022a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800233:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800236:	48 83 c2 01          	add    $0x1,%rdx
+  80023a:	84 c9                	test   %cl,%cl
+  80023c:	75 f1                	jne    80022f <strcpy+0x8>
+        ;
+    return res;
+}
+  80023e:	c3                   	ret
+
+000000000080023f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  80023f:	55                   	push   %rbp
+  800240:	48 89 e5             	mov    %rsp,%rbp
+  800243:	41 54                	push   %r12
+  800245:	53                   	push   %rbx
+  800246:	48 89 fb             	mov    %rdi,%rbx
+  800249:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80024c:	48 b8 e9 01 80 00 00 	movabs $0x8001e9,%rax
+  800253:	00 00 00 
+  800256:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800258:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80025c:	4c 89 e6             	mov    %r12,%rsi
+  80025f:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  800266:	00 00 00 
+  800269:	ff d0                	call   *%rax
+    return dst;
+}
+  80026b:	48 89 d8             	mov    %rbx,%rax
+  80026e:	5b                   	pop    %rbx
+  80026f:	41 5c                	pop    %r12
+  800271:	5d                   	pop    %rbp
+  800272:	c3                   	ret
+
+0000000000800273 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800273:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800276:	48 85 d2             	test   %rdx,%rdx
+  800279:	74 1f                	je     80029a <strncpy+0x27>
+  80027b:	48 01 fa             	add    %rdi,%rdx
+  80027e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800281:	48 83 c1 01          	add    $0x1,%rcx
+  800285:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800289:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80028d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800291:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800295:	48 39 ca             	cmp    %rcx,%rdx
+  800298:	75 e7                	jne    800281 <strncpy+0xe>
+    }
+    return ret;
+}
+  80029a:	c3                   	ret
+
+000000000080029b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80029b:	48 89 f8             	mov    %rdi,%rax
+  80029e:	48 85 d2             	test   %rdx,%rdx
+  8002a1:	74 24                	je     8002c7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8002a3:	48 83 ea 01          	sub    $0x1,%rdx
+  8002a7:	74 1b                	je     8002c4 <strlcpy+0x29>
+  8002a9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8002ad:	0f b6 16             	movzbl (%rsi),%edx
+  8002b0:	84 d2                	test   %dl,%dl
+  8002b2:	74 10                	je     8002c4 <strlcpy+0x29>
+            *dst++ = *src++;
+  8002b4:	48 83 c6 01          	add    $0x1,%rsi
+  8002b8:	48 83 c0 01          	add    $0x1,%rax
+  8002bc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8002bf:	48 39 c8             	cmp    %rcx,%rax
+  8002c2:	75 e9                	jne    8002ad <strlcpy+0x12>
+        *dst = '\0';
+  8002c4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8002c7:	48 29 f8             	sub    %rdi,%rax
+}
+  8002ca:	c3                   	ret
+
+00000000008002cb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8002cb:	0f b6 07             	movzbl (%rdi),%eax
+  8002ce:	84 c0                	test   %al,%al
+  8002d0:	74 13                	je     8002e5 <strcmp+0x1a>
+  8002d2:	38 06                	cmp    %al,(%rsi)
+  8002d4:	75 0f                	jne    8002e5 <strcmp+0x1a>
+  8002d6:	48 83 c7 01          	add    $0x1,%rdi
+  8002da:	48 83 c6 01          	add    $0x1,%rsi
+  8002de:	0f b6 07             	movzbl (%rdi),%eax
+  8002e1:	84 c0                	test   %al,%al
+  8002e3:	75 ed                	jne    8002d2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8002e5:	0f b6 c0             	movzbl %al,%eax
+  8002e8:	0f b6 16             	movzbl (%rsi),%edx
+  8002eb:	29 d0                	sub    %edx,%eax
+}
+  8002ed:	c3                   	ret
+
+00000000008002ee <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8002ee:	48 85 d2             	test   %rdx,%rdx
+  8002f1:	74 1f                	je     800312 <strncmp+0x24>
+  8002f3:	0f b6 07             	movzbl (%rdi),%eax
+  8002f6:	84 c0                	test   %al,%al
+  8002f8:	74 1e                	je     800318 <strncmp+0x2a>
+  8002fa:	3a 06                	cmp    (%rsi),%al
+  8002fc:	75 1a                	jne    800318 <strncmp+0x2a>
+  8002fe:	48 83 c7 01          	add    $0x1,%rdi
+  800302:	48 83 c6 01          	add    $0x1,%rsi
+  800306:	48 83 ea 01          	sub    $0x1,%rdx
+  80030a:	75 e7                	jne    8002f3 <strncmp+0x5>
+
+    if (!n) return 0;
+  80030c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800311:	c3                   	ret
+  800312:	b8 00 00 00 00       	mov    $0x0,%eax
+  800317:	c3                   	ret
+  800318:	48 85 d2             	test   %rdx,%rdx
+  80031b:	74 09                	je     800326 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80031d:	0f b6 07             	movzbl (%rdi),%eax
+  800320:	0f b6 16             	movzbl (%rsi),%edx
+  800323:	29 d0                	sub    %edx,%eax
+  800325:	c3                   	ret
+    if (!n) return 0;
+  800326:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80032b:	c3                   	ret
+
+000000000080032c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80032c:	0f b6 17             	movzbl (%rdi),%edx
+  80032f:	84 d2                	test   %dl,%dl
+  800331:	74 18                	je     80034b <strchr+0x1f>
+        if (*str == c) {
+  800333:	0f be d2             	movsbl %dl,%edx
+  800336:	39 f2                	cmp    %esi,%edx
+  800338:	74 17                	je     800351 <strchr+0x25>
+    for (; *str; str++) {
+  80033a:	48 83 c7 01          	add    $0x1,%rdi
+  80033e:	0f b6 17             	movzbl (%rdi),%edx
+  800341:	84 d2                	test   %dl,%dl
+  800343:	75 ee                	jne    800333 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	c3                   	ret
+  80034b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800350:	c3                   	ret
+  800351:	48 89 f8             	mov    %rdi,%rax
+}
+  800354:	c3                   	ret
+
+0000000000800355 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800355:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800358:	0f b6 17             	movzbl (%rdi),%edx
+  80035b:	84 d2                	test   %dl,%dl
+  80035d:	74 13                	je     800372 <strfind+0x1d>
+  80035f:	0f be d2             	movsbl %dl,%edx
+  800362:	39 f2                	cmp    %esi,%edx
+  800364:	74 0b                	je     800371 <strfind+0x1c>
+  800366:	48 83 c0 01          	add    $0x1,%rax
+  80036a:	0f b6 10             	movzbl (%rax),%edx
+  80036d:	84 d2                	test   %dl,%dl
+  80036f:	75 ee                	jne    80035f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800371:	c3                   	ret
+  800372:	c3                   	ret
+
+0000000000800373 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800373:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800376:	48 89 f8             	mov    %rdi,%rax
+  800379:	48 f7 d8             	neg    %rax
+  80037c:	83 e0 07             	and    $0x7,%eax
+  80037f:	49 89 d1             	mov    %rdx,%r9
+  800382:	49 29 c1             	sub    %rax,%r9
+  800385:	78 36                	js     8003bd <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800387:	40 0f b6 c6          	movzbl %sil,%eax
+  80038b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800392:	01 01 01 
+  800395:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800399:	40 f6 c7 07          	test   $0x7,%dil
+  80039d:	75 38                	jne    8003d7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80039f:	4c 89 c9             	mov    %r9,%rcx
+  8003a2:	48 c1 f9 03          	sar    $0x3,%rcx
+  8003a6:	74 0c                	je     8003b4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8003a8:	fc                   	cld
+  8003a9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8003ac:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8003b0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8003b4:	4d 85 c9             	test   %r9,%r9
+  8003b7:	75 45                	jne    8003fe <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8003b9:	4c 89 c0             	mov    %r8,%rax
+  8003bc:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8003bd:	48 85 d2             	test   %rdx,%rdx
+  8003c0:	74 f7                	je     8003b9 <memset+0x46>
+  8003c2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8003c5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8003c8:	48 83 c0 01          	add    $0x1,%rax
+  8003cc:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8003d0:	48 39 c2             	cmp    %rax,%rdx
+  8003d3:	75 f3                	jne    8003c8 <memset+0x55>
+  8003d5:	eb e2                	jmp    8003b9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8003d7:	40 f6 c7 01          	test   $0x1,%dil
+  8003db:	74 06                	je     8003e3 <memset+0x70>
+  8003dd:	88 07                	mov    %al,(%rdi)
+  8003df:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8003e3:	40 f6 c7 02          	test   $0x2,%dil
+  8003e7:	74 07                	je     8003f0 <memset+0x7d>
+  8003e9:	66 89 07             	mov    %ax,(%rdi)
+  8003ec:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003f0:	40 f6 c7 04          	test   $0x4,%dil
+  8003f4:	74 a9                	je     80039f <memset+0x2c>
+  8003f6:	89 07                	mov    %eax,(%rdi)
+  8003f8:	48 83 c7 04          	add    $0x4,%rdi
+  8003fc:	eb a1                	jmp    80039f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8003fe:	41 f6 c1 04          	test   $0x4,%r9b
+  800402:	74 06                	je     80040a <memset+0x97>
+  800404:	89 07                	mov    %eax,(%rdi)
+  800406:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80040a:	41 f6 c1 02          	test   $0x2,%r9b
+  80040e:	74 07                	je     800417 <memset+0xa4>
+  800410:	66 89 07             	mov    %ax,(%rdi)
+  800413:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800417:	41 f6 c1 01          	test   $0x1,%r9b
+  80041b:	74 9c                	je     8003b9 <memset+0x46>
+  80041d:	88 07                	mov    %al,(%rdi)
+  80041f:	eb 98                	jmp    8003b9 <memset+0x46>
+
+0000000000800421 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800421:	48 89 f8             	mov    %rdi,%rax
+  800424:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800427:	48 39 fe             	cmp    %rdi,%rsi
+  80042a:	73 3b                	jae    800467 <memmove+0x46>
+  80042c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800430:	48 39 d7             	cmp    %rdx,%rdi
+  800433:	73 32                	jae    800467 <memmove+0x46>
+        s += n;
+        d += n;
+  800435:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800439:	48 89 d6             	mov    %rdx,%rsi
+  80043c:	48 09 fe             	or     %rdi,%rsi
+  80043f:	48 09 ce             	or     %rcx,%rsi
+  800442:	40 f6 c6 07          	test   $0x7,%sil
+  800446:	75 12                	jne    80045a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800448:	48 83 ef 08          	sub    $0x8,%rdi
+  80044c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800450:	48 c1 e9 03          	shr    $0x3,%rcx
+  800454:	fd                   	std
+  800455:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800458:	fc                   	cld
+  800459:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80045a:	48 83 ef 01          	sub    $0x1,%rdi
+  80045e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800462:	fd                   	std
+  800463:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800465:	eb f1                	jmp    800458 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800467:	48 89 f2             	mov    %rsi,%rdx
+  80046a:	48 09 c2             	or     %rax,%rdx
+  80046d:	48 09 ca             	or     %rcx,%rdx
+  800470:	f6 c2 07             	test   $0x7,%dl
+  800473:	75 0c                	jne    800481 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800475:	48 c1 e9 03          	shr    $0x3,%rcx
+  800479:	48 89 c7             	mov    %rax,%rdi
+  80047c:	fc                   	cld
+  80047d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800480:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800481:	48 89 c7             	mov    %rax,%rdi
+  800484:	fc                   	cld
+  800485:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800487:	c3                   	ret
+
+0000000000800488 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800488:	55                   	push   %rbp
+  800489:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80048c:	48 b8 21 04 80 00 00 	movabs $0x800421,%rax
+  800493:	00 00 00 
+  800496:	ff d0                	call   *%rax
+}
+  800498:	5d                   	pop    %rbp
+  800499:	c3                   	ret
+
+000000000080049a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80049a:	55                   	push   %rbp
+  80049b:	48 89 e5             	mov    %rsp,%rbp
+  80049e:	41 57                	push   %r15
+  8004a0:	41 56                	push   %r14
+  8004a2:	41 55                	push   %r13
+  8004a4:	41 54                	push   %r12
+  8004a6:	53                   	push   %rbx
+  8004a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004ab:	49 89 fe             	mov    %rdi,%r14
+  8004ae:	49 89 f7             	mov    %rsi,%r15
+  8004b1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8004b4:	48 89 f7             	mov    %rsi,%rdi
+  8004b7:	48 b8 e9 01 80 00 00 	movabs $0x8001e9,%rax
+  8004be:	00 00 00 
+  8004c1:	ff d0                	call   *%rax
+  8004c3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8004c6:	48 89 de             	mov    %rbx,%rsi
+  8004c9:	4c 89 f7             	mov    %r14,%rdi
+  8004cc:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+  8004d8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8004db:	48 39 c3             	cmp    %rax,%rbx
+  8004de:	74 36                	je     800516 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8004e0:	48 89 d8             	mov    %rbx,%rax
+  8004e3:	4c 29 e8             	sub    %r13,%rax
+  8004e6:	49 39 c4             	cmp    %rax,%r12
+  8004e9:	73 31                	jae    80051c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8004eb:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8004f0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8004f4:	4c 89 fe             	mov    %r15,%rsi
+  8004f7:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  8004fe:	00 00 00 
+  800501:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800503:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800507:	48 83 c4 08          	add    $0x8,%rsp
+  80050b:	5b                   	pop    %rbx
+  80050c:	41 5c                	pop    %r12
+  80050e:	41 5d                	pop    %r13
+  800510:	41 5e                	pop    %r14
+  800512:	41 5f                	pop    %r15
+  800514:	5d                   	pop    %rbp
+  800515:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800516:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80051a:	eb eb                	jmp    800507 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80051c:	48 83 eb 01          	sub    $0x1,%rbx
+  800520:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800524:	48 89 da             	mov    %rbx,%rdx
+  800527:	4c 89 fe             	mov    %r15,%rsi
+  80052a:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  800531:	00 00 00 
+  800534:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800536:	49 01 de             	add    %rbx,%r14
+  800539:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80053e:	eb c3                	jmp    800503 <strlcat+0x69>
+
+0000000000800540 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800540:	48 85 d2             	test   %rdx,%rdx
+  800543:	74 2d                	je     800572 <memcmp+0x32>
+  800545:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80054a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80054e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800553:	44 38 c1             	cmp    %r8b,%cl
+  800556:	75 0f                	jne    800567 <memcmp+0x27>
+    while (n-- > 0) {
+  800558:	48 83 c0 01          	add    $0x1,%rax
+  80055c:	48 39 c2             	cmp    %rax,%rdx
+  80055f:	75 e9                	jne    80054a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800561:	b8 00 00 00 00       	mov    $0x0,%eax
+  800566:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800567:	0f b6 c1             	movzbl %cl,%eax
+  80056a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80056e:	44 29 c0             	sub    %r8d,%eax
+  800571:	c3                   	ret
+    return 0;
+  800572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800577:	c3                   	ret
+
+0000000000800578 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800578:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80057c:	48 39 c7             	cmp    %rax,%rdi
+  80057f:	73 0f                	jae    800590 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800581:	40 38 37             	cmp    %sil,(%rdi)
+  800584:	74 0e                	je     800594 <memfind+0x1c>
+    for (; src < end; src++) {
+  800586:	48 83 c7 01          	add    $0x1,%rdi
+  80058a:	48 39 f8             	cmp    %rdi,%rax
+  80058d:	75 f2                	jne    800581 <memfind+0x9>
+  80058f:	c3                   	ret
+  800590:	48 89 f8             	mov    %rdi,%rax
+  800593:	c3                   	ret
+  800594:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800597:	c3                   	ret
+
+0000000000800598 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800598:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80059b:	0f b6 37             	movzbl (%rdi),%esi
+  80059e:	40 80 fe 20          	cmp    $0x20,%sil
+  8005a2:	74 06                	je     8005aa <strtol+0x12>
+  8005a4:	40 80 fe 09          	cmp    $0x9,%sil
+  8005a8:	75 13                	jne    8005bd <strtol+0x25>
+  8005aa:	48 83 c7 01          	add    $0x1,%rdi
+  8005ae:	0f b6 37             	movzbl (%rdi),%esi
+  8005b1:	40 80 fe 20          	cmp    $0x20,%sil
+  8005b5:	74 f3                	je     8005aa <strtol+0x12>
+  8005b7:	40 80 fe 09          	cmp    $0x9,%sil
+  8005bb:	74 ed                	je     8005aa <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8005bd:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8005c0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8005c3:	3c 01                	cmp    $0x1,%al
+  8005c5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005c9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8005cf:	75 0f                	jne    8005e0 <strtol+0x48>
+  8005d1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8005d4:	74 14                	je     8005ea <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8005d6:	85 d2                	test   %edx,%edx
+  8005d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8005dd:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8005e0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8005e5:	4c 63 ca             	movslq %edx,%r9
+  8005e8:	eb 36                	jmp    800620 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8005ea:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8005ee:	74 0f                	je     8005ff <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8005f0:	85 d2                	test   %edx,%edx
+  8005f2:	75 ec                	jne    8005e0 <strtol+0x48>
+        s++;
+  8005f4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8005f8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8005fd:	eb e1                	jmp    8005e0 <strtol+0x48>
+        s += 2;
+  8005ff:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800603:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800608:	eb d6                	jmp    8005e0 <strtol+0x48>
+            dig -= '0';
+  80060a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80060d:	44 0f b6 c1          	movzbl %cl,%r8d
+  800611:	41 39 d0             	cmp    %edx,%r8d
+  800614:	7d 21                	jge    800637 <strtol+0x9f>
+        val = val * base + dig;
+  800616:	49 0f af c1          	imul   %r9,%rax
+  80061a:	0f b6 c9             	movzbl %cl,%ecx
+  80061d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800620:	48 83 c7 01          	add    $0x1,%rdi
+  800624:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800628:	80 f9 39             	cmp    $0x39,%cl
+  80062b:	76 dd                	jbe    80060a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80062d:	80 f9 7b             	cmp    $0x7b,%cl
+  800630:	77 05                	ja     800637 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800632:	83 e9 57             	sub    $0x57,%ecx
+  800635:	eb d6                	jmp    80060d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800637:	4d 85 d2             	test   %r10,%r10
+  80063a:	74 03                	je     80063f <strtol+0xa7>
+  80063c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80063f:	48 89 c2             	mov    %rax,%rdx
+  800642:	48 f7 da             	neg    %rdx
+  800645:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800649:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80064d:	c3                   	ret
+
+000000000080064e <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80064e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800653:	ba 00 00 00 00       	mov    $0x0,%edx
+  800658:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80065e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800664:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80066a:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80066c:	c3                   	ret
+
+000000000080066d <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80066d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800672:	bf 00 00 00 00       	mov    $0x0,%edi
+  800677:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80067c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800681:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80068d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800693:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800695:	c3                   	ret
+
+0000000000800696 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800696:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800699:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80069e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8006a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8006ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8006b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8006ba:	0f 05                	syscall
+    if (check && ret > 0) {
+  8006bc:	48 85 c0             	test   %rax,%rax
+  8006bf:	7f 01                	jg     8006c2 <sys_env_destroy+0x2c>
+}
+  8006c1:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8006c2:	55                   	push   %rbp
+  8006c3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8006c6:	49 89 c0             	mov    %rax,%r8
+  8006c9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8006ce:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  8006d5:	00 00 00 
+  8006d8:	be 29 00 00 00       	mov    $0x29,%esi
+  8006dd:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  8006e4:	00 00 00 
+  8006e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006ec:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  8006f3:	00 00 00 
+  8006f6:	41 ff d1             	call   *%r9
+
+00000000008006f9 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8006f9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8006fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800703:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80070d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800713:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800719:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80071f:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800721:	c3                   	ret
+
+0000000000800722 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  800722:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80072c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800731:	ba 00 00 00 00       	mov    $0x0,%edx
+  800736:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80073c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800742:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800748:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80074a:	c3                   	ret
+
+000000000080074b <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80074b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800750:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800757:	00 00 00 
+  80075a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800760:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800766:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80076c:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80076e:	c3                   	ret
+
+000000000080076f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80076f:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800772:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800777:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80077d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800783:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800785:	c3                   	ret
+
+0000000000800786 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800786:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800789:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80078e:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800791:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800797:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80079d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80079f:	48 85 c0             	test   %rax,%rax
+  8007a2:	7f 01                	jg     8007a5 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8007a4:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8007a5:	55                   	push   %rbp
+  8007a6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007a9:	49 89 c0             	mov    %rax,%r8
+  8007ac:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8007b1:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  8007b8:	00 00 00 
+  8007bb:	be 29 00 00 00       	mov    $0x29,%esi
+  8007c0:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  8007c7:	00 00 00 
+  8007ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007cf:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  8007d6:	00 00 00 
+  8007d9:	41 ff d1             	call   *%r9
+
+00000000008007dc <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8007dc:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8007df:	48 63 d2             	movslq %edx,%rdx
+  8007e2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8007e5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8007ea:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8007ed:	0f 05                	syscall
+    if (check && ret > 0) {
+  8007ef:	48 85 c0             	test   %rax,%rax
+  8007f2:	7f 01                	jg     8007f5 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8007f4:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8007f5:	55                   	push   %rbp
+  8007f6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8007f9:	49 89 c0             	mov    %rax,%r8
+  8007fc:	b9 05 00 00 00       	mov    $0x5,%ecx
+  800801:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  800808:	00 00 00 
+  80080b:	be 29 00 00 00       	mov    $0x29,%esi
+  800810:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  800817:	00 00 00 
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  800826:	00 00 00 
+  800829:	41 ff d1             	call   *%r9
+
+000000000080082c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80082c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80082f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800834:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80083a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800840:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800846:	0f 05                	syscall
+    if (check && ret > 0) {
+  800848:	48 85 c0             	test   %rax,%rax
+  80084b:	7f 01                	jg     80084e <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80084d:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80084e:	55                   	push   %rbp
+  80084f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800852:	49 89 c0             	mov    %rax,%r8
+  800855:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80085a:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  800861:	00 00 00 
+  800864:	be 29 00 00 00       	mov    $0x29,%esi
+  800869:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  800870:	00 00 00 
+  800873:	b8 00 00 00 00       	mov    $0x0,%eax
+  800878:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  80087f:	00 00 00 
+  800882:	41 ff d1             	call   *%r9
+
+0000000000800885 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800885:	48 63 f6             	movslq %esi,%rsi
+  800888:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80088b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800890:	ba 00 00 00 00       	mov    $0x0,%edx
+  800895:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80089b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8008a7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8008a9:	48 85 c0             	test   %rax,%rax
+  8008ac:	7f 01                	jg     8008af <sys_env_set_status+0x2a>
+}
+  8008ae:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8008af:	55                   	push   %rbp
+  8008b0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8008b3:	49 89 c0             	mov    %rax,%r8
+  8008b6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8008bb:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  8008c2:	00 00 00 
+  8008c5:	be 29 00 00 00       	mov    $0x29,%esi
+  8008ca:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  8008d1:	00 00 00 
+  8008d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d9:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  8008e0:	00 00 00 
+  8008e3:	41 ff d1             	call   *%r9
+
+00000000008008e6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8008e6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8008e9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8008ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8008f3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8008f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8008ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800905:	0f 05                	syscall
+    if (check && ret > 0) {
+  800907:	48 85 c0             	test   %rax,%rax
+  80090a:	7f 01                	jg     80090d <sys_env_set_trapframe+0x27>
+}
+  80090c:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80090d:	55                   	push   %rbp
+  80090e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800911:	49 89 c0             	mov    %rax,%r8
+  800914:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800919:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  800920:	00 00 00 
+  800923:	be 29 00 00 00       	mov    $0x29,%esi
+  800928:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  80092f:	00 00 00 
+  800932:	b8 00 00 00 00       	mov    $0x0,%eax
+  800937:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  80093e:	00 00 00 
+  800941:	41 ff d1             	call   *%r9
+
+0000000000800944 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800944:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800947:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80094c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800951:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800957:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80095d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800963:	0f 05                	syscall
+    if (check && ret > 0) {
+  800965:	48 85 c0             	test   %rax,%rax
+  800968:	7f 01                	jg     80096b <sys_env_set_pgfault_upcall+0x27>
+}
+  80096a:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80096b:	55                   	push   %rbp
+  80096c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80096f:	49 89 c0             	mov    %rax,%r8
+  800972:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800977:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  80097e:	00 00 00 
+  800981:	be 29 00 00 00       	mov    $0x29,%esi
+  800986:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  80098d:	00 00 00 
+  800990:	b8 00 00 00 00       	mov    $0x0,%eax
+  800995:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  80099c:	00 00 00 
+  80099f:	41 ff d1             	call   *%r9
+
+00000000008009a2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8009a2:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8009a5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8009a8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8009ad:	4d 63 c0             	movslq %r8d,%r8
+  8009b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8009b6:	0f 05                	syscall
+}
+  8009b8:	c3                   	ret
+
+00000000008009b9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8009b9:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8009bc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8009bf:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8009c4:	4d 63 c0             	movslq %r8d,%r8
+  8009c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8009cd:	0f 05                	syscall
+}
+  8009cf:	c3                   	ret
+
+00000000008009d0 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8009d0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8009d5:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8009d8:	45 89 c0             	mov    %r8d,%r8d
+  8009db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8009e1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8009e3:	48 85 c0             	test   %rax,%rax
+  8009e6:	7f 01                	jg     8009e9 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8009e8:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8009e9:	55                   	push   %rbp
+  8009ea:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8009ed:	49 89 c0             	mov    %rax,%r8
+  8009f0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8009f5:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  8009fc:	00 00 00 
+  8009ff:	be 29 00 00 00       	mov    $0x29,%esi
+  800a04:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  800a0b:	00 00 00 
+  800a0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a13:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  800a1a:	00 00 00 
+  800a1d:	41 ff d1             	call   *%r9
+
+0000000000800a20 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800a20:	55                   	push   %rbp
+  800a21:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  800a24:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a2a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800a2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a34:	48 b8 d0 09 80 00 00 	movabs $0x8009d0,%rax
+  800a3b:	00 00 00 
+  800a3e:	ff d0                	call   *%rax
+}
+  800a40:	5d                   	pop    %rbp
+  800a41:	c3                   	ret
+
+0000000000800a42 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  800a42:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a4c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800a51:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a56:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800a5c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a62:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800a68:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800a6a:	c3                   	ret
+
+0000000000800a6b <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800a6b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800a70:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800a75:	ba 00 00 00 00       	mov    $0x0,%edx
+  800a7a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800a80:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800a86:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800a8c:	0f 05                	syscall
+    if (check && ret > 0) {
+  800a8e:	48 85 c0             	test   %rax,%rax
+  800a91:	7f 01                	jg     800a94 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800a93:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800a94:	55                   	push   %rbp
+  800a95:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800a98:	49 89 c0             	mov    %rax,%r8
+  800a9b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800aa0:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  800aa7:	00 00 00 
+  800aaa:	be 29 00 00 00       	mov    $0x29,%esi
+  800aaf:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  800ab6:	00 00 00 
+  800ab9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800abe:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  800ac5:	00 00 00 
+  800ac8:	41 ff d1             	call   *%r9
+
+0000000000800acb <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  800acb:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800ad0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ad5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800ada:	ba 00 00 00 00       	mov    $0x0,%edx
+  800adf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800ae5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800aeb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800af1:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  800af3:	c3                   	ret
+
+0000000000800af4 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  800af4:	89 d2                	mov    %edx,%edx
+  800af6:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  800af8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800afd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800b03:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b09:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800b0f:	0f 05                	syscall
+}
+  800b11:	c3                   	ret
+
+0000000000800b12 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  800b12:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800b15:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800b1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b1f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800b25:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b2b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800b31:	0f 05                	syscall
+}
+  800b33:	c3                   	ret
+
+0000000000800b34 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  800b34:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800b37:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800b3c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b41:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800b47:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b4d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800b53:	0f 05                	syscall
+}
+  800b55:	c3                   	ret
+
+0000000000800b56 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800b56:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800b59:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800b5e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800b63:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b68:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800b6e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800b74:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800b7a:	0f 05                	syscall
+    if (check && ret > 0) {
+  800b7c:	48 85 c0             	test   %rax,%rax
+  800b7f:	7f 01                	jg     800b82 <sys_irq_ack+0x2c>
+}
+  800b81:	c3                   	ret
+sys_irq_ack(int irq) {
+  800b82:	55                   	push   %rbp
+  800b83:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800b86:	49 89 c0             	mov    %rax,%r8
+  800b89:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800b8e:	48 ba 80 47 80 00 00 	movabs $0x804780,%rdx
+  800b95:	00 00 00 
+  800b98:	be 29 00 00 00       	mov    $0x29,%esi
+  800b9d:	48 bf 9f 47 80 00 00 	movabs $0x80479f,%rdi
+  800ba4:	00 00 00 
+  800ba7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bac:	49 b9 a4 38 80 00 00 	movabs $0x8038a4,%r9
+  800bb3:	00 00 00 
+  800bb6:	41 ff d1             	call   *%r9
+
+0000000000800bb9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800bb9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800bc0:	ff ff ff 
+  800bc3:	48 01 f8             	add    %rdi,%rax
+  800bc6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800bca:	c3                   	ret
+
+0000000000800bcb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800bcb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800bd2:	ff ff ff 
+  800bd5:	48 01 f8             	add    %rdi,%rax
+  800bd8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800bdc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800be2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800be6:	c3                   	ret
+
+0000000000800be7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800be7:	55                   	push   %rbp
+  800be8:	48 89 e5             	mov    %rsp,%rbp
+  800beb:	41 57                	push   %r15
+  800bed:	41 56                	push   %r14
+  800bef:	41 55                	push   %r13
+  800bf1:	41 54                	push   %r12
+  800bf3:	53                   	push   %rbx
+  800bf4:	48 83 ec 08          	sub    $0x8,%rsp
+  800bf8:	49 89 ff             	mov    %rdi,%r15
+  800bfb:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800c00:	49 bd 76 33 80 00 00 	movabs $0x803376,%r13
+  800c07:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800c0a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800c10:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800c13:	48 89 df             	mov    %rbx,%rdi
+  800c16:	41 ff d5             	call   *%r13
+  800c19:	83 e0 04             	and    $0x4,%eax
+  800c1c:	74 17                	je     800c35 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800c1e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800c25:	4c 39 f3             	cmp    %r14,%rbx
+  800c28:	75 e6                	jne    800c10 <fd_alloc+0x29>
+  800c2a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800c30:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800c35:	4d 89 27             	mov    %r12,(%r15)
+}
+  800c38:	48 83 c4 08          	add    $0x8,%rsp
+  800c3c:	5b                   	pop    %rbx
+  800c3d:	41 5c                	pop    %r12
+  800c3f:	41 5d                	pop    %r13
+  800c41:	41 5e                	pop    %r14
+  800c43:	41 5f                	pop    %r15
+  800c45:	5d                   	pop    %rbp
+  800c46:	c3                   	ret
+
+0000000000800c47 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800c47:	83 ff 1f             	cmp    $0x1f,%edi
+  800c4a:	77 39                	ja     800c85 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800c4c:	55                   	push   %rbp
+  800c4d:	48 89 e5             	mov    %rsp,%rbp
+  800c50:	41 54                	push   %r12
+  800c52:	53                   	push   %rbx
+  800c53:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800c56:	48 63 df             	movslq %edi,%rbx
+  800c59:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800c60:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800c64:	48 89 df             	mov    %rbx,%rdi
+  800c67:	48 b8 76 33 80 00 00 	movabs $0x803376,%rax
+  800c6e:	00 00 00 
+  800c71:	ff d0                	call   *%rax
+  800c73:	a8 04                	test   $0x4,%al
+  800c75:	74 14                	je     800c8b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800c77:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c80:	5b                   	pop    %rbx
+  800c81:	41 5c                	pop    %r12
+  800c83:	5d                   	pop    %rbp
+  800c84:	c3                   	ret
+        return -E_INVAL;
+  800c85:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800c8a:	c3                   	ret
+        return -E_INVAL;
+  800c8b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c90:	eb ee                	jmp    800c80 <fd_lookup+0x39>
+
+0000000000800c92 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800c92:	55                   	push   %rbp
+  800c93:	48 89 e5             	mov    %rsp,%rbp
+  800c96:	41 54                	push   %r12
+  800c98:	53                   	push   %rbx
+  800c99:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800c9c:	48 b8 40 48 80 00 00 	movabs $0x804840,%rax
+  800ca3:	00 00 00 
+  800ca6:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800cad:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800cb0:	39 3b                	cmp    %edi,(%rbx)
+  800cb2:	74 47                	je     800cfb <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800cb4:	48 83 c0 08          	add    $0x8,%rax
+  800cb8:	48 8b 18             	mov    (%rax),%rbx
+  800cbb:	48 85 db             	test   %rbx,%rbx
+  800cbe:	75 f0                	jne    800cb0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800cc0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800cc7:	00 00 00 
+  800cca:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800cd0:	89 fa                	mov    %edi,%edx
+  800cd2:	48 bf b0 47 80 00 00 	movabs $0x8047b0,%rdi
+  800cd9:	00 00 00 
+  800cdc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ce1:	48 b9 f4 39 80 00 00 	movabs $0x8039f4,%rcx
+  800ce8:	00 00 00 
+  800ceb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800ced:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800cf2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  800cf6:	5b                   	pop    %rbx
+  800cf7:	41 5c                	pop    %r12
+  800cf9:	5d                   	pop    %rbp
+  800cfa:	c3                   	ret
+            return 0;
+  800cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d00:	eb f0                	jmp    800cf2 <dev_lookup+0x60>
+
+0000000000800d02 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800d02:	55                   	push   %rbp
+  800d03:	48 89 e5             	mov    %rsp,%rbp
+  800d06:	41 55                	push   %r13
+  800d08:	41 54                	push   %r12
+  800d0a:	53                   	push   %rbx
+  800d0b:	48 83 ec 18          	sub    $0x18,%rsp
+  800d0f:	48 89 fb             	mov    %rdi,%rbx
+  800d12:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800d15:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800d1c:	ff ff ff 
+  800d1f:	48 01 df             	add    %rbx,%rdi
+  800d22:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  800d26:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800d2a:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  800d31:	00 00 00 
+  800d34:	ff d0                	call   *%rax
+  800d36:	41 89 c5             	mov    %eax,%r13d
+  800d39:	85 c0                	test   %eax,%eax
+  800d3b:	78 06                	js     800d43 <fd_close+0x41>
+  800d3d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800d41:	74 1a                	je     800d5d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800d43:	45 84 e4             	test   %r12b,%r12b
+  800d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d4b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800d4f:	44 89 e8             	mov    %r13d,%eax
+  800d52:	48 83 c4 18          	add    $0x18,%rsp
+  800d56:	5b                   	pop    %rbx
+  800d57:	41 5c                	pop    %r12
+  800d59:	41 5d                	pop    %r13
+  800d5b:	5d                   	pop    %rbp
+  800d5c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800d5d:	8b 3b                	mov    (%rbx),%edi
+  800d5f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800d63:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  800d6a:	00 00 00 
+  800d6d:	ff d0                	call   *%rax
+  800d6f:	41 89 c5             	mov    %eax,%r13d
+  800d72:	85 c0                	test   %eax,%eax
+  800d74:	78 1b                	js     800d91 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800d76:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800d7a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800d7e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800d84:	48 85 c0             	test   %rax,%rax
+  800d87:	74 08                	je     800d91 <fd_close+0x8f>
+  800d89:	48 89 df             	mov    %rbx,%rdi
+  800d8c:	ff d0                	call   *%rax
+  800d8e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800d91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800d96:	48 89 de             	mov    %rbx,%rsi
+  800d99:	bf 00 00 00 00       	mov    $0x0,%edi
+  800d9e:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  800da5:	00 00 00 
+  800da8:	ff d0                	call   *%rax
+    return res;
+  800daa:	eb a3                	jmp    800d4f <fd_close+0x4d>
+
+0000000000800dac <close>:
+
+int
+close(int fdnum) {
+  800dac:	55                   	push   %rbp
+  800dad:	48 89 e5             	mov    %rsp,%rbp
+  800db0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800db4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800db8:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  800dbf:	00 00 00 
+  800dc2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800dc4:	85 c0                	test   %eax,%eax
+  800dc6:	78 15                	js     800ddd <close+0x31>
+
+    return fd_close(fd, 1);
+  800dc8:	be 01 00 00 00       	mov    $0x1,%esi
+  800dcd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800dd1:	48 b8 02 0d 80 00 00 	movabs $0x800d02,%rax
+  800dd8:	00 00 00 
+  800ddb:	ff d0                	call   *%rax
+}
+  800ddd:	c9                   	leave
+  800dde:	c3                   	ret
+
+0000000000800ddf <close_all>:
+
+void
+close_all(void) {
+  800ddf:	55                   	push   %rbp
+  800de0:	48 89 e5             	mov    %rsp,%rbp
+  800de3:	41 54                	push   %r12
+  800de5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800de6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800deb:	49 bc ac 0d 80 00 00 	movabs $0x800dac,%r12
+  800df2:	00 00 00 
+  800df5:	89 df                	mov    %ebx,%edi
+  800df7:	41 ff d4             	call   *%r12
+  800dfa:	83 c3 01             	add    $0x1,%ebx
+  800dfd:	83 fb 20             	cmp    $0x20,%ebx
+  800e00:	75 f3                	jne    800df5 <close_all+0x16>
+}
+  800e02:	5b                   	pop    %rbx
+  800e03:	41 5c                	pop    %r12
+  800e05:	5d                   	pop    %rbp
+  800e06:	c3                   	ret
+
+0000000000800e07 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800e07:	55                   	push   %rbp
+  800e08:	48 89 e5             	mov    %rsp,%rbp
+  800e0b:	41 57                	push   %r15
+  800e0d:	41 56                	push   %r14
+  800e0f:	41 55                	push   %r13
+  800e11:	41 54                	push   %r12
+  800e13:	53                   	push   %rbx
+  800e14:	48 83 ec 18          	sub    $0x18,%rsp
+  800e18:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800e1b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800e1f:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  800e26:	00 00 00 
+  800e29:	ff d0                	call   *%rax
+  800e2b:	89 c3                	mov    %eax,%ebx
+  800e2d:	85 c0                	test   %eax,%eax
+  800e2f:	0f 88 b8 00 00 00    	js     800eed <dup+0xe6>
+    close(newfdnum);
+  800e35:	44 89 e7             	mov    %r12d,%edi
+  800e38:	48 b8 ac 0d 80 00 00 	movabs $0x800dac,%rax
+  800e3f:	00 00 00 
+  800e42:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800e44:	4d 63 ec             	movslq %r12d,%r13
+  800e47:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800e4e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800e52:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800e56:	4c 89 ff             	mov    %r15,%rdi
+  800e59:	49 be cb 0b 80 00 00 	movabs $0x800bcb,%r14
+  800e60:	00 00 00 
+  800e63:	41 ff d6             	call   *%r14
+  800e66:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800e69:	4c 89 ef             	mov    %r13,%rdi
+  800e6c:	41 ff d6             	call   *%r14
+  800e6f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800e72:	48 89 df             	mov    %rbx,%rdi
+  800e75:	48 b8 76 33 80 00 00 	movabs $0x803376,%rax
+  800e7c:	00 00 00 
+  800e7f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800e81:	a8 04                	test   $0x4,%al
+  800e83:	74 2b                	je     800eb0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800e85:	41 89 c1             	mov    %eax,%r9d
+  800e88:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800e8e:	4c 89 f1             	mov    %r14,%rcx
+  800e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e96:	48 89 de             	mov    %rbx,%rsi
+  800e99:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e9e:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  800ea5:	00 00 00 
+  800ea8:	ff d0                	call   *%rax
+  800eaa:	89 c3                	mov    %eax,%ebx
+  800eac:	85 c0                	test   %eax,%eax
+  800eae:	78 4e                	js     800efe <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800eb0:	4c 89 ff             	mov    %r15,%rdi
+  800eb3:	48 b8 76 33 80 00 00 	movabs $0x803376,%rax
+  800eba:	00 00 00 
+  800ebd:	ff d0                	call   *%rax
+  800ebf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800ec2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800ec8:	4c 89 e9             	mov    %r13,%rcx
+  800ecb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ed0:	4c 89 fe             	mov    %r15,%rsi
+  800ed3:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed8:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  800edf:	00 00 00 
+  800ee2:	ff d0                	call   *%rax
+  800ee4:	89 c3                	mov    %eax,%ebx
+  800ee6:	85 c0                	test   %eax,%eax
+  800ee8:	78 14                	js     800efe <dup+0xf7>
+
+    return newfdnum;
+  800eea:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800eed:	89 d8                	mov    %ebx,%eax
+  800eef:	48 83 c4 18          	add    $0x18,%rsp
+  800ef3:	5b                   	pop    %rbx
+  800ef4:	41 5c                	pop    %r12
+  800ef6:	41 5d                	pop    %r13
+  800ef8:	41 5e                	pop    %r14
+  800efa:	41 5f                	pop    %r15
+  800efc:	5d                   	pop    %rbp
+  800efd:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800efe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800f03:	4c 89 ee             	mov    %r13,%rsi
+  800f06:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f0b:	49 bc 2c 08 80 00 00 	movabs $0x80082c,%r12
+  800f12:	00 00 00 
+  800f15:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800f18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800f1d:	4c 89 f6             	mov    %r14,%rsi
+  800f20:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f25:	41 ff d4             	call   *%r12
+    return res;
+  800f28:	eb c3                	jmp    800eed <dup+0xe6>
+
+0000000000800f2a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800f2a:	55                   	push   %rbp
+  800f2b:	48 89 e5             	mov    %rsp,%rbp
+  800f2e:	41 56                	push   %r14
+  800f30:	41 55                	push   %r13
+  800f32:	41 54                	push   %r12
+  800f34:	53                   	push   %rbx
+  800f35:	48 83 ec 10          	sub    $0x10,%rsp
+  800f39:	89 fb                	mov    %edi,%ebx
+  800f3b:	49 89 f4             	mov    %rsi,%r12
+  800f3e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800f41:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800f45:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  800f4c:	00 00 00 
+  800f4f:	ff d0                	call   *%rax
+  800f51:	85 c0                	test   %eax,%eax
+  800f53:	78 4c                	js     800fa1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800f55:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800f59:	41 8b 3e             	mov    (%r14),%edi
+  800f5c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800f60:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  800f67:	00 00 00 
+  800f6a:	ff d0                	call   *%rax
+  800f6c:	85 c0                	test   %eax,%eax
+  800f6e:	78 35                	js     800fa5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800f70:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800f74:	83 e0 03             	and    $0x3,%eax
+  800f77:	83 f8 01             	cmp    $0x1,%eax
+  800f7a:	74 2d                	je     800fa9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800f80:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800f84:	48 85 c0             	test   %rax,%rax
+  800f87:	74 56                	je     800fdf <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800f89:	4c 89 ea             	mov    %r13,%rdx
+  800f8c:	4c 89 e6             	mov    %r12,%rsi
+  800f8f:	4c 89 f7             	mov    %r14,%rdi
+  800f92:	ff d0                	call   *%rax
+}
+  800f94:	48 83 c4 10          	add    $0x10,%rsp
+  800f98:	5b                   	pop    %rbx
+  800f99:	41 5c                	pop    %r12
+  800f9b:	41 5d                	pop    %r13
+  800f9d:	41 5e                	pop    %r14
+  800f9f:	5d                   	pop    %rbp
+  800fa0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800fa1:	48 98                	cltq
+  800fa3:	eb ef                	jmp    800f94 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800fa5:	48 98                	cltq
+  800fa7:	eb eb                	jmp    800f94 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800fa9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800fb0:	00 00 00 
+  800fb3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800fb9:	89 da                	mov    %ebx,%edx
+  800fbb:	48 bf f1 47 80 00 00 	movabs $0x8047f1,%rdi
+  800fc2:	00 00 00 
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fca:	48 b9 f4 39 80 00 00 	movabs $0x8039f4,%rcx
+  800fd1:	00 00 00 
+  800fd4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800fd6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800fdd:	eb b5                	jmp    800f94 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800fdf:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800fe6:	eb ac                	jmp    800f94 <read+0x6a>
+
+0000000000800fe8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800fe8:	55                   	push   %rbp
+  800fe9:	48 89 e5             	mov    %rsp,%rbp
+  800fec:	41 57                	push   %r15
+  800fee:	41 56                	push   %r14
+  800ff0:	41 55                	push   %r13
+  800ff2:	41 54                	push   %r12
+  800ff4:	53                   	push   %rbx
+  800ff5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ff9:	48 85 d2             	test   %rdx,%rdx
+  800ffc:	74 54                	je     801052 <readn+0x6a>
+  800ffe:	41 89 fd             	mov    %edi,%r13d
+  801001:	49 89 f6             	mov    %rsi,%r14
+  801004:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801007:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  80100c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801011:	49 bf 2a 0f 80 00 00 	movabs $0x800f2a,%r15
+  801018:	00 00 00 
+  80101b:	4c 89 e2             	mov    %r12,%rdx
+  80101e:	48 29 f2             	sub    %rsi,%rdx
+  801021:	4c 01 f6             	add    %r14,%rsi
+  801024:	44 89 ef             	mov    %r13d,%edi
+  801027:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80102a:	85 c0                	test   %eax,%eax
+  80102c:	78 20                	js     80104e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80102e:	01 c3                	add    %eax,%ebx
+  801030:	85 c0                	test   %eax,%eax
+  801032:	74 08                	je     80103c <readn+0x54>
+  801034:	48 63 f3             	movslq %ebx,%rsi
+  801037:	4c 39 e6             	cmp    %r12,%rsi
+  80103a:	72 df                	jb     80101b <readn+0x33>
+    }
+    return res;
+  80103c:	48 63 c3             	movslq %ebx,%rax
+}
+  80103f:	48 83 c4 08          	add    $0x8,%rsp
+  801043:	5b                   	pop    %rbx
+  801044:	41 5c                	pop    %r12
+  801046:	41 5d                	pop    %r13
+  801048:	41 5e                	pop    %r14
+  80104a:	41 5f                	pop    %r15
+  80104c:	5d                   	pop    %rbp
+  80104d:	c3                   	ret
+        if (inc < 0) return inc;
+  80104e:	48 98                	cltq
+  801050:	eb ed                	jmp    80103f <readn+0x57>
+    int inc = 1, res = 0;
+  801052:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801057:	eb e3                	jmp    80103c <readn+0x54>
+
+0000000000801059 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801059:	55                   	push   %rbp
+  80105a:	48 89 e5             	mov    %rsp,%rbp
+  80105d:	41 56                	push   %r14
+  80105f:	41 55                	push   %r13
+  801061:	41 54                	push   %r12
+  801063:	53                   	push   %rbx
+  801064:	48 83 ec 10          	sub    $0x10,%rsp
+  801068:	89 fb                	mov    %edi,%ebx
+  80106a:	49 89 f4             	mov    %rsi,%r12
+  80106d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801070:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801074:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+  801080:	85 c0                	test   %eax,%eax
+  801082:	78 47                	js     8010cb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801084:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801088:	41 8b 3e             	mov    (%r14),%edi
+  80108b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80108f:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  801096:	00 00 00 
+  801099:	ff d0                	call   *%rax
+  80109b:	85 c0                	test   %eax,%eax
+  80109d:	78 30                	js     8010cf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80109f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  8010a4:	74 2d                	je     8010d3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8010a6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8010aa:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8010ae:	48 85 c0             	test   %rax,%rax
+  8010b1:	74 56                	je     801109 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8010b3:	4c 89 ea             	mov    %r13,%rdx
+  8010b6:	4c 89 e6             	mov    %r12,%rsi
+  8010b9:	4c 89 f7             	mov    %r14,%rdi
+  8010bc:	ff d0                	call   *%rax
+}
+  8010be:	48 83 c4 10          	add    $0x10,%rsp
+  8010c2:	5b                   	pop    %rbx
+  8010c3:	41 5c                	pop    %r12
+  8010c5:	41 5d                	pop    %r13
+  8010c7:	41 5e                	pop    %r14
+  8010c9:	5d                   	pop    %rbp
+  8010ca:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8010cb:	48 98                	cltq
+  8010cd:	eb ef                	jmp    8010be <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8010cf:	48 98                	cltq
+  8010d1:	eb eb                	jmp    8010be <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8010d3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8010da:	00 00 00 
+  8010dd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8010e3:	89 da                	mov    %ebx,%edx
+  8010e5:	48 bf 0d 48 80 00 00 	movabs $0x80480d,%rdi
+  8010ec:	00 00 00 
+  8010ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f4:	48 b9 f4 39 80 00 00 	movabs $0x8039f4,%rcx
+  8010fb:	00 00 00 
+  8010fe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801100:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801107:	eb b5                	jmp    8010be <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801109:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801110:	eb ac                	jmp    8010be <write+0x65>
+
+0000000000801112 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801112:	55                   	push   %rbp
+  801113:	48 89 e5             	mov    %rsp,%rbp
+  801116:	41 54                	push   %r12
+  801118:	53                   	push   %rbx
+  801119:	48 83 ec 10          	sub    $0x10,%rsp
+  80111d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80111f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801123:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  80112a:	00 00 00 
+  80112d:	ff d0                	call   *%rax
+  80112f:	85 c0                	test   %eax,%eax
+  801131:	78 3e                	js     801171 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801133:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801137:	41 8b 3c 24          	mov    (%r12),%edi
+  80113b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80113f:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+  80114b:	85 c0                	test   %eax,%eax
+  80114d:	78 22                	js     801171 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  80114f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801153:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801157:	48 85 c0             	test   %rax,%rax
+  80115a:	74 0b                	je     801167 <seek+0x55>
+  80115c:	89 de                	mov    %ebx,%esi
+  80115e:	4c 89 e7             	mov    %r12,%rdi
+  801161:	ff d0                	call   *%rax
+  801163:	85 c0                	test   %eax,%eax
+  801165:	78 0a                	js     801171 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801167:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  80116c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801171:	48 83 c4 10          	add    $0x10,%rsp
+  801175:	5b                   	pop    %rbx
+  801176:	41 5c                	pop    %r12
+  801178:	5d                   	pop    %rbp
+  801179:	c3                   	ret
+
+000000000080117a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80117a:	55                   	push   %rbp
+  80117b:	48 89 e5             	mov    %rsp,%rbp
+  80117e:	41 55                	push   %r13
+  801180:	41 54                	push   %r12
+  801182:	53                   	push   %rbx
+  801183:	48 83 ec 18          	sub    $0x18,%rsp
+  801187:	89 fb                	mov    %edi,%ebx
+  801189:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80118c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801190:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  801197:	00 00 00 
+  80119a:	ff d0                	call   *%rax
+  80119c:	85 c0                	test   %eax,%eax
+  80119e:	78 38                	js     8011d8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8011a0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  8011a4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  8011a8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8011ac:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  8011b3:	00 00 00 
+  8011b6:	ff d0                	call   *%rax
+  8011b8:	85 c0                	test   %eax,%eax
+  8011ba:	78 1c                	js     8011d8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8011bc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8011c1:	74 20                	je     8011e3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8011c3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8011c7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8011cb:	48 85 c0             	test   %rax,%rax
+  8011ce:	74 47                	je     801217 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8011d0:	44 89 e6             	mov    %r12d,%esi
+  8011d3:	4c 89 ef             	mov    %r13,%rdi
+  8011d6:	ff d0                	call   *%rax
+}
+  8011d8:	48 83 c4 18          	add    $0x18,%rsp
+  8011dc:	5b                   	pop    %rbx
+  8011dd:	41 5c                	pop    %r12
+  8011df:	41 5d                	pop    %r13
+  8011e1:	5d                   	pop    %rbp
+  8011e2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8011e3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8011ea:	00 00 00 
+  8011ed:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8011f3:	89 da                	mov    %ebx,%edx
+  8011f5:	48 bf d0 47 80 00 00 	movabs $0x8047d0,%rdi
+  8011fc:	00 00 00 
+  8011ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801204:	48 b9 f4 39 80 00 00 	movabs $0x8039f4,%rcx
+  80120b:	00 00 00 
+  80120e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801210:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801215:	eb c1                	jmp    8011d8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801217:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80121c:	eb ba                	jmp    8011d8 <ftruncate+0x5e>
+
+000000000080121e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80121e:	55                   	push   %rbp
+  80121f:	48 89 e5             	mov    %rsp,%rbp
+  801222:	41 54                	push   %r12
+  801224:	53                   	push   %rbx
+  801225:	48 83 ec 10          	sub    $0x10,%rsp
+  801229:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80122c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801230:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  801237:	00 00 00 
+  80123a:	ff d0                	call   *%rax
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	78 4e                	js     80128e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801240:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801244:	41 8b 3c 24          	mov    (%r12),%edi
+  801248:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80124c:	48 b8 92 0c 80 00 00 	movabs $0x800c92,%rax
+  801253:	00 00 00 
+  801256:	ff d0                	call   *%rax
+  801258:	85 c0                	test   %eax,%eax
+  80125a:	78 32                	js     80128e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80125c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801260:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801265:	74 30                	je     801297 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801267:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80126a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801271:	00 00 00 
+    stat->st_isdir = 0;
+  801274:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80127b:	00 00 00 
+    stat->st_dev = dev;
+  80127e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801285:	48 89 de             	mov    %rbx,%rsi
+  801288:	4c 89 e7             	mov    %r12,%rdi
+  80128b:	ff 50 28             	call   *0x28(%rax)
+}
+  80128e:	48 83 c4 10          	add    $0x10,%rsp
+  801292:	5b                   	pop    %rbx
+  801293:	41 5c                	pop    %r12
+  801295:	5d                   	pop    %rbp
+  801296:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801297:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80129c:	eb f0                	jmp    80128e <fstat+0x70>
+
+000000000080129e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+  8012a2:	41 54                	push   %r12
+  8012a4:	53                   	push   %rbx
+  8012a5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8012a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8012ad:	48 b8 0c 24 80 00 00 	movabs $0x80240c,%rax
+  8012b4:	00 00 00 
+  8012b7:	ff d0                	call   *%rax
+  8012b9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8012bb:	85 c0                	test   %eax,%eax
+  8012bd:	78 25                	js     8012e4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8012bf:	4c 89 e6             	mov    %r12,%rsi
+  8012c2:	89 c7                	mov    %eax,%edi
+  8012c4:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  8012cb:	00 00 00 
+  8012ce:	ff d0                	call   *%rax
+  8012d0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8012d3:	89 df                	mov    %ebx,%edi
+  8012d5:	48 b8 ac 0d 80 00 00 	movabs $0x800dac,%rax
+  8012dc:	00 00 00 
+  8012df:	ff d0                	call   *%rax
+
+    return res;
+  8012e1:	44 89 e3             	mov    %r12d,%ebx
+}
+  8012e4:	89 d8                	mov    %ebx,%eax
+  8012e6:	5b                   	pop    %rbx
+  8012e7:	41 5c                	pop    %r12
+  8012e9:	5d                   	pop    %rbp
+  8012ea:	c3                   	ret
+
+00000000008012eb <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8012eb:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8012f2:	00 00 00 
+  8012f5:	83 38 00             	cmpl   $0x0,(%rax)
+  8012f8:	74 0a                	je     801304 <fsenv+0x19>
+    return envid;
+}
+  8012fa:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801301:	00 00 
+  801303:	c3                   	ret
+fsenv(void) {
+  801304:	55                   	push   %rbp
+  801305:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801308:	bf 03 00 00 00       	mov    $0x3,%edi
+  80130d:	48 b8 10 47 80 00 00 	movabs $0x804710,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+  801319:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801320:	00 00 
+}
+  801322:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801329:	00 00 
+  80132b:	5d                   	pop    %rbp
+  80132c:	c3                   	ret
+
+000000000080132d <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  80132d:	55                   	push   %rbp
+  80132e:	48 89 e5             	mov    %rsp,%rbp
+  801331:	41 54                	push   %r12
+  801333:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801334:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801339:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80133e:	48 89 de             	mov    %rbx,%rsi
+  801341:	bf 00 00 00 00       	mov    $0x0,%edi
+  801346:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  80134d:	00 00 00 
+  801350:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801352:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801359:	00 00 00 
+  80135c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801362:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801367:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80136c:	48 89 de             	mov    %rbx,%rsi
+  80136f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801374:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  80137b:	00 00 00 
+  80137e:	ff d0                	call   *%rax
+  801380:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801382:	85 c0                	test   %eax,%eax
+  801384:	0f 88 a2 00 00 00    	js     80142c <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  80138a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801391:	00 00 00 
+  801394:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80139a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80139f:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8013a1:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8013a6:	49 bc 3e 35 80 00 00 	movabs $0x80353e,%r12
+  8013ad:	00 00 00 
+  8013b0:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8013b3:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8013b8:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8013bb:	48 b8 eb 12 80 00 00 	movabs $0x8012eb,%rax
+  8013c2:	00 00 00 
+  8013c5:	ff d0                	call   *%rax
+  8013c7:	89 c7                	mov    %eax,%edi
+  8013c9:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8013cf:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8013d4:	48 89 da             	mov    %rbx,%rdx
+  8013d7:	be 09 00 00 00       	mov    $0x9,%esi
+  8013dc:	48 b8 ba 46 80 00 00 	movabs $0x8046ba,%rax
+  8013e3:	00 00 00 
+  8013e6:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8013e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8013f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013fc:	48 b8 96 46 80 00 00 	movabs $0x804696,%rax
+  801403:	00 00 00 
+  801406:	ff d0                	call   *%rax
+  801408:	89 c3                	mov    %eax,%ebx
+  80140a:	85 c0                	test   %eax,%eax
+  80140c:	78 25                	js     801433 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80140e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801415:	00 00 00 
+  801418:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80141e:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801425:	00 00 
+    return 0;
+  801427:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80142c:	89 d8                	mov    %ebx,%eax
+  80142e:	5b                   	pop    %rbx
+  80142f:	41 5c                	pop    %r12
+  801431:	5d                   	pop    %rbp
+  801432:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801433:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801438:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  80143d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801442:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  801449:	00 00 00 
+  80144c:	ff d0                	call   *%rax
+        return res;
+  80144e:	eb dc                	jmp    80142c <fschan_setup+0xff>
+
+0000000000801450 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801450:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801457:	00 00 00 
+  80145a:	80 38 00             	cmpb   $0x0,(%rax)
+  80145d:	74 55                	je     8014b4 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80145f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801466:	00 00 00 
+  801469:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80146f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801474:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  80147b:	00 00 00 
+  80147e:	3b 0a                	cmp    (%rdx),%ecx
+  801480:	75 01                	jne    801483 <fschan+0x33>
+}
+  801482:	c3                   	ret
+fschan(void) {
+  801483:	55                   	push   %rbp
+  801484:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801487:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  80148e:	00 00 00 
+  801491:	ff d0                	call   *%rax
+  801493:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801495:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80149a:	85 d2                	test   %edx,%edx
+  80149c:	78 02                	js     8014a0 <fschan+0x50>
+}
+  80149e:	5d                   	pop    %rbp
+  80149f:	c3                   	ret
+        fschan_enabled = 0;
+  8014a0:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8014a7:	00 00 00 
+  8014aa:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8014ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b2:	eb ea                	jmp    80149e <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8014b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b9:	c3                   	ret
+
+00000000008014ba <fbuf>:
+fbuf(struct Fd *fd) {
+  8014ba:	55                   	push   %rbp
+  8014bb:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8014be:	48 b8 b9 0b 80 00 00 	movabs $0x800bb9,%rax
+  8014c5:	00 00 00 
+  8014c8:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8014ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cf:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8014d3:	77 12                	ja     8014e7 <fbuf+0x2d>
+  8014d5:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8014d9:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8014e0:	00 00 00 
+  8014e3:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8014e7:	48 89 d0             	mov    %rdx,%rax
+  8014ea:	5d                   	pop    %rbp
+  8014eb:	c3                   	ret
+
+00000000008014ec <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8014ec:	55                   	push   %rbp
+  8014ed:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8014f0:	48 83 c7 40          	add    $0x40,%rdi
+  8014f4:	48 b8 78 35 80 00 00 	movabs $0x803578,%rax
+  8014fb:	00 00 00 
+  8014fe:	ff d0                	call   *%rax
+  801500:	84 c0                	test   %al,%al
+  801502:	75 02                	jne    801506 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801504:	5d                   	pop    %rbp
+  801505:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801506:	48 b8 eb 12 80 00 00 	movabs $0x8012eb,%rax
+  80150d:	00 00 00 
+  801510:	ff d0                	call   *%rax
+  801512:	89 c7                	mov    %eax,%edi
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80151f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801524:	be 0a 00 00 00       	mov    $0xa,%esi
+  801529:	48 b8 ba 46 80 00 00 	movabs $0x8046ba,%rax
+  801530:	00 00 00 
+  801533:	ff d0                	call   *%rax
+}
+  801535:	eb cd                	jmp    801504 <fschan_publish+0x18>
+
+0000000000801537 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801537:	55                   	push   %rbp
+  801538:	48 89 e5             	mov    %rsp,%rbp
+  80153b:	41 57                	push   %r15
+  80153d:	41 56                	push   %r14
+  80153f:	41 55                	push   %r13
+  801541:	41 54                	push   %r12
+  801543:	53                   	push   %rbx
+  801544:	48 83 ec 48          	sub    $0x48,%rsp
+  801548:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80154c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801550:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801553:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801557:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80155a:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801561:	00 00 00 
+  801564:	8b 02                	mov    (%rdx),%eax
+  801566:	83 c0 01             	add    $0x1,%eax
+  801569:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80156e:	0f 44 c1             	cmove  %ecx,%eax
+  801571:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801573:	4d 85 c0             	test   %r8,%r8
+  801576:	74 2c                	je     8015a4 <fschan_rw+0x6d>
+  801578:	45 89 ce             	mov    %r9d,%r14d
+  80157b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801582:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801586:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80158c:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801593:	00 
+  801594:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80159a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80159f:	e9 41 01 00 00       	jmp    8016e5 <fschan_rw+0x1ae>
+  8015a4:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8015a8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8015ac:	e9 9c 01 00 00       	jmp    80174d <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8015b1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8015b5:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8015b8:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8015bb:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8015be:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8015c2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8015c6:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8015ca:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8015ce:	48 89 da             	mov    %rbx,%rdx
+  8015d1:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8015dd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8015e1:	48 b8 ec 14 80 00 00 	movabs $0x8014ec,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+            queued += blk;
+  8015ed:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8015f0:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8015f4:	4d 39 fc             	cmp    %r15,%r12
+  8015f7:	73 6b                	jae    801664 <fschan_rw+0x12d>
+  8015f9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8015fd:	77 65                	ja     801664 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8015ff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801603:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801607:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  80160e:	00 00 00 
+  801611:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801613:	4c 89 fb             	mov    %r15,%rbx
+  801616:	4c 29 e3             	sub    %r12,%rbx
+  801619:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80161e:	48 39 d3             	cmp    %rdx,%rbx
+  801621:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801625:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801629:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80162d:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801631:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801634:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801636:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80163d:	00 00 00 
+  801640:	8b 09                	mov    (%rcx),%ecx
+  801642:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801645:	83 fe 03             	cmp    $0x3,%esi
+  801648:	0f 85 63 ff ff ff    	jne    8015b1 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80164e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801652:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801655:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801658:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80165b:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80165f:	e9 79 ff ff ff       	jmp    8015dd <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801664:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801668:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80166f:	48 89 df             	mov    %rbx,%rdi
+  801672:	48 b8 16 36 80 00 00 	movabs $0x803616,%rax
+  801679:	00 00 00 
+  80167c:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80167e:	48 89 df             	mov    %rbx,%rdi
+  801681:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  801688:	00 00 00 
+  80168b:	ff d0                	call   *%rax
+  80168d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801691:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801695:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801699:	75 25                	jne    8016c0 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80169b:	8b 40 04             	mov    0x4(%rax),%eax
+  80169e:	85 c0                	test   %eax,%eax
+  8016a0:	0f 88 86 00 00 00    	js     80172c <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8016a6:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8016aa:	74 5b                	je     801707 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8016ac:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8016b0:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8016b4:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8016b8:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8016bc:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8016c0:	48 89 df             	mov    %rbx,%rdi
+  8016c3:	48 b8 cb 35 80 00 00 	movabs $0x8035cb,%rax
+  8016ca:	00 00 00 
+  8016cd:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8016cf:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8016d3:	83 f0 01             	xor    $0x1,%eax
+  8016d6:	4d 39 fc             	cmp    %r15,%r12
+  8016d9:	0f 92 c2             	setb   %dl
+  8016dc:	84 c2                	test   %al,%dl
+  8016de:	75 05                	jne    8016e5 <fschan_rw+0x1ae>
+  8016e0:	45 85 ed             	test   %r13d,%r13d
+  8016e3:	74 50                	je     801735 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8016e5:	4d 39 fc             	cmp    %r15,%r12
+  8016e8:	0f 92 c1             	setb   %cl
+  8016eb:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8016ef:	0f 96 c2             	setbe  %dl
+  8016f2:	84 d1                	test   %dl,%cl
+  8016f4:	0f 84 6a ff ff ff    	je     801664 <fschan_rw+0x12d>
+  8016fa:	84 c0                	test   %al,%al
+  8016fc:	0f 85 fd fe ff ff    	jne    8015ff <fschan_rw+0xc8>
+  801702:	e9 5d ff ff ff       	jmp    801664 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801707:	48 63 d0             	movslq %eax,%rdx
+  80170a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80170e:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801712:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801716:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80171a:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80171e:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  801725:	00 00 00 
+  801728:	ff d0                	call   *%rax
+  80172a:	eb 80                	jmp    8016ac <fschan_rw+0x175>
+                err = msg->fm_res;
+  80172c:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80172f:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  801733:	eb 8b                	jmp    8016c0 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  801735:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80173a:	0f 85 68 fe ff ff    	jne    8015a8 <fschan_rw+0x71>
+  801740:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  801743:	85 c0                	test   %eax,%eax
+  801745:	0f 84 5d fe ff ff    	je     8015a8 <fschan_rw+0x71>
+  80174b:	48 98                	cltq
+}
+  80174d:	48 83 c4 48          	add    $0x48,%rsp
+  801751:	5b                   	pop    %rbx
+  801752:	41 5c                	pop    %r12
+  801754:	41 5d                	pop    %r13
+  801756:	41 5e                	pop    %r14
+  801758:	41 5f                	pop    %r15
+  80175a:	5d                   	pop    %rbp
+  80175b:	c3                   	ret
+
+000000000080175c <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80175c:	55                   	push   %rbp
+  80175d:	48 89 e5             	mov    %rsp,%rbp
+  801760:	41 56                	push   %r14
+  801762:	41 55                	push   %r13
+  801764:	41 54                	push   %r12
+  801766:	53                   	push   %rbx
+  801767:	48 83 ec 10          	sub    $0x10,%rsp
+  80176b:	49 89 fe             	mov    %rdi,%r14
+  80176e:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801771:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801775:	48 29 f3             	sub    %rsi,%rbx
+  801778:	48 39 d3             	cmp    %rdx,%rbx
+  80177b:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80177f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801786:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801787:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80178c:	49 bd d5 33 80 00 00 	movabs $0x8033d5,%r13
+  801793:	00 00 00 
+  801796:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80179d:	76 1e                	jbe    8017bd <mmap_fault+0x61>
+  80179f:	4c 01 e7             	add    %r12,%rdi
+  8017a2:	41 ff d5             	call   *%r13
+  8017a5:	84 c0                	test   %al,%al
+  8017a7:	75 14                	jne    8017bd <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8017a9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8017ad:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8017b4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8017b8:	48 39 df             	cmp    %rbx,%rdi
+  8017bb:	72 e2                	jb     80179f <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8017bd:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8017c4:	00 00 00 
+  8017c7:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8017ce:	00 00 00 
+  8017d1:	4c 89 f0             	mov    %r14,%rax
+  8017d4:	48 29 d0             	sub    %rdx,%rax
+  8017d7:	48 c1 f8 03          	sar    $0x3,%rax
+  8017db:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8017e2:	aa aa aa 
+  8017e5:	48 0f af c2          	imul   %rdx,%rax
+  8017e9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8017ed:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8017f2:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8017f6:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8017f8:	44 89 e0             	mov    %r12d,%eax
+  8017fb:	41 03 46 10          	add    0x10(%r14),%eax
+  8017ff:	41 2b 06             	sub    (%r14),%eax
+  801802:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  801805:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801809:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80180d:	41 8b 46 14          	mov    0x14(%r14),%eax
+  801811:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  801814:	48 b8 eb 12 80 00 00 	movabs $0x8012eb,%rax
+  80181b:	00 00 00 
+  80181e:	ff d0                	call   *%rax
+  801820:	89 c7                	mov    %eax,%edi
+  801822:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801828:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80182d:	48 89 da             	mov    %rbx,%rdx
+  801830:	be 0f 00 00 00       	mov    $0xf,%esi
+  801835:	48 b8 ba 46 80 00 00 	movabs $0x8046ba,%rax
+  80183c:	00 00 00 
+  80183f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  801841:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801846:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80184a:	4c 89 e6             	mov    %r12,%rsi
+  80184d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801852:	48 b8 96 46 80 00 00 	movabs $0x804696,%rax
+  801859:	00 00 00 
+  80185c:	ff d0                	call   *%rax
+  80185e:	48 98                	cltq
+}
+  801860:	48 83 c4 10          	add    $0x10,%rsp
+  801864:	5b                   	pop    %rbx
+  801865:	41 5c                	pop    %r12
+  801867:	41 5d                	pop    %r13
+  801869:	41 5e                	pop    %r14
+  80186b:	5d                   	pop    %rbp
+  80186c:	c3                   	ret
+
+000000000080186d <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80186d:	48 8b 37             	mov    (%rdi),%rsi
+  801870:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801877:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80187e:	00 00 00 
+  801881:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801886:	eb 0f                	jmp    801897 <mmap_pgfault+0x2a>
+  801888:	c3                   	ret
+  801889:	48 83 c1 01          	add    $0x1,%rcx
+  80188d:	48 83 c2 18          	add    $0x18,%rdx
+  801891:	48 83 f9 20          	cmp    $0x20,%rcx
+  801895:	74 6e                	je     801905 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801897:	48 8b 02             	mov    (%rdx),%rax
+  80189a:	48 83 e8 01          	sub    $0x1,%rax
+  80189e:	48 39 f0             	cmp    %rsi,%rax
+  8018a1:	73 e6                	jae    801889 <mmap_pgfault+0x1c>
+  8018a3:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8018a7:	73 e0                	jae    801889 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8018a9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8018ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b2:	f6 c2 01             	test   $0x1,%dl
+  8018b5:	75 d1                	jne    801888 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8018b7:	f6 c2 02             	test   $0x2,%dl
+  8018ba:	74 1a                	je     8018d6 <mmap_pgfault+0x69>
+  8018bc:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8018c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c5:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8018cc:	00 00 00 
+  8018cf:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8018d4:	74 35                	je     80190b <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8018d6:	55                   	push   %rbp
+  8018d7:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8018da:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8018de:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8018e5:	00 00 00 
+  8018e8:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8018ec:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8018f1:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  8018f8:	00 00 00 
+  8018fb:	ff d0                	call   *%rax
+  8018fd:	48 85 c0             	test   %rax,%rax
+  801900:	0f 9f c0             	setg   %al
+}
+  801903:	5d                   	pop    %rbp
+  801904:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190a:	c3                   	ret
+}
+  80190b:	c3                   	ret
+
+000000000080190c <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	41 54                	push   %r12
+  801912:	53                   	push   %rbx
+  801913:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801916:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80191d:	00 00 00 
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  801925:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801929:	74 15                	je     801940 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80192b:	48 83 c3 01          	add    $0x1,%rbx
+  80192f:	48 83 c0 18          	add    $0x18,%rax
+  801933:	48 83 fb 20          	cmp    $0x20,%rbx
+  801937:	75 ec                	jne    801925 <mmap_alloc+0x19>
+    return NULL;
+  801939:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193e:	eb 52                	jmp    801992 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801940:	4c 89 e7             	mov    %r12,%rdi
+  801943:	48 b8 76 33 80 00 00 	movabs $0x803376,%rax
+  80194a:	00 00 00 
+  80194d:	ff d0                	call   *%rax
+  80194f:	41 89 c1             	mov    %eax,%r9d
+  801952:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801959:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80195d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801963:	ba 00 00 00 00       	mov    $0x0,%edx
+  801968:	4c 89 e6             	mov    %r12,%rsi
+  80196b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801970:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+  80197c:	85 c0                	test   %eax,%eax
+  80197e:	78 17                	js     801997 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801980:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801984:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80198b:	00 00 00 
+  80198e:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801992:	5b                   	pop    %rbx
+  801993:	41 5c                	pop    %r12
+  801995:	5d                   	pop    %rbp
+  801996:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801997:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199c:	eb f4                	jmp    801992 <mmap_alloc+0x86>
+
+000000000080199e <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80199e:	55                   	push   %rbp
+  80199f:	48 89 e5             	mov    %rsp,%rbp
+  8019a2:	41 56                	push   %r14
+  8019a4:	41 55                	push   %r13
+  8019a6:	41 54                	push   %r12
+  8019a8:	53                   	push   %rbx
+  8019a9:	48 83 ec 10          	sub    $0x10,%rsp
+  8019ad:	41 89 fc             	mov    %edi,%r12d
+  8019b0:	49 89 f5             	mov    %rsi,%r13
+  8019b3:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8019b6:	48 89 f0             	mov    %rsi,%rax
+  8019b9:	48 09 d0             	or     %rdx,%rax
+  8019bc:	75 0d                	jne    8019cb <fsipc+0x2d>
+  8019be:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8019c1:	83 f8 04             	cmp    $0x4,%eax
+  8019c4:	76 7d                	jbe    801a43 <fsipc+0xa5>
+  8019c6:	83 ff 0d             	cmp    $0xd,%edi
+  8019c9:	74 78                	je     801a43 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8019cb:	48 b8 eb 12 80 00 00 	movabs $0x8012eb,%rax
+  8019d2:	00 00 00 
+  8019d5:	ff d0                	call   *%rax
+  8019d7:	89 c7                	mov    %eax,%edi
+  8019d9:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8019e0:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8019e7:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8019ee:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8019f4:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8019fb:	00 00 00 
+  8019fe:	44 89 e6             	mov    %r12d,%esi
+  801a01:	48 b8 ba 46 80 00 00 	movabs $0x8046ba,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801a0d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801a14:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801a15:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a1a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801a1e:	4c 89 ee             	mov    %r13,%rsi
+  801a21:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a26:	48 b8 96 46 80 00 00 	movabs $0x804696,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+  801a32:	89 c3                	mov    %eax,%ebx
+}
+  801a34:	89 d8                	mov    %ebx,%eax
+  801a36:	48 83 c4 10          	add    $0x10,%rsp
+  801a3a:	5b                   	pop    %rbx
+  801a3b:	41 5c                	pop    %r12
+  801a3d:	41 5d                	pop    %r13
+  801a3f:	41 5e                	pop    %r14
+  801a41:	5d                   	pop    %rbp
+  801a42:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801a43:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  801a4a:	00 00 00 
+  801a4d:	ff d0                	call   *%rax
+  801a4f:	49 89 c6             	mov    %rax,%r14
+  801a52:	48 85 c0             	test   %rax,%rax
+  801a55:	0f 84 70 ff ff ff    	je     8019cb <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801a5b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801a5f:	48 b8 53 35 80 00 00 	movabs $0x803553,%rax
+  801a66:	00 00 00 
+  801a69:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801a6b:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801a6e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801a75:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801a79:	ba 10 00 00 00       	mov    $0x10,%edx
+  801a7e:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801a85:	00 00 00 
+  801a88:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  801a8f:	00 00 00 
+  801a92:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801a94:	4c 89 f7             	mov    %r14,%rdi
+  801a97:	48 b8 ec 14 80 00 00 	movabs $0x8014ec,%rax
+  801a9e:	00 00 00 
+  801aa1:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801aa3:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801aaa:	4c 89 f7             	mov    %r14,%rdi
+  801aad:	48 b8 16 36 80 00 00 	movabs $0x803616,%rax
+  801ab4:	00 00 00 
+  801ab7:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801ab9:	4c 89 f7             	mov    %r14,%rdi
+  801abc:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  801ac3:	00 00 00 
+  801ac6:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801ac8:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  801acb:	41 83 fc 05          	cmp    $0x5,%r12d
+  801acf:	75 04                	jne    801ad5 <fsipc+0x137>
+  801ad1:	85 db                	test   %ebx,%ebx
+  801ad3:	79 14                	jns    801ae9 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  801ad5:	4c 89 f7             	mov    %r14,%rdi
+  801ad8:	48 b8 cb 35 80 00 00 	movabs $0x8035cb,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  801ae4:	e9 4b ff ff ff       	jmp    801a34 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  801ae9:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801aed:	ba 88 00 00 00       	mov    $0x88,%edx
+  801af2:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  801af9:	00 00 00 
+  801afc:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+  801b08:	eb cb                	jmp    801ad5 <fsipc+0x137>
+
+0000000000801b0a <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801b0a:	55                   	push   %rbp
+  801b0b:	48 89 e5             	mov    %rsp,%rbp
+  801b0e:	41 57                	push   %r15
+  801b10:	41 56                	push   %r14
+  801b12:	41 55                	push   %r13
+  801b14:	41 54                	push   %r12
+  801b16:	53                   	push   %rbx
+  801b17:	48 83 ec 18          	sub    $0x18,%rsp
+  801b1b:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  801b1f:	49 89 f6             	mov    %rsi,%r14
+  801b22:	49 89 d4             	mov    %rdx,%r12
+  801b25:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  801b28:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801b34:	48 85 c0             	test   %rax,%rax
+  801b37:	0f 85 96 00 00 00    	jne    801bd3 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  801b3d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801b44:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b45:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801b4c:	00 00 00 
+    while (n) {
+  801b4f:	4d 85 e4             	test   %r12,%r12
+  801b52:	74 79                	je     801bcd <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801b54:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801b59:	49 39 dc             	cmp    %rbx,%r12
+  801b5c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801b60:	48 89 da             	mov    %rbx,%rdx
+  801b63:	4c 89 f6             	mov    %r14,%rsi
+  801b66:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801b6d:	00 00 00 
+  801b70:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  801b77:	00 00 00 
+  801b7a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801b7c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801b80:	8b 40 0c             	mov    0xc(%rax),%eax
+  801b83:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801b86:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801b89:	44 01 e8             	add    %r13d,%eax
+  801b8c:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801b90:	41 0f 44 c5          	cmove  %r13d,%eax
+  801b94:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801b98:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801b9c:	48 89 da             	mov    %rbx,%rdx
+  801b9f:	be 00 00 00 00       	mov    $0x0,%esi
+  801ba4:	bf 04 00 00 00       	mov    $0x4,%edi
+  801ba9:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  801bb0:	00 00 00 
+  801bb3:	ff d0                	call   *%rax
+        if (res < 0)
+  801bb5:	85 c0                	test   %eax,%eax
+  801bb7:	78 4a                	js     801c03 <devfile_write_direct+0xf9>
+        buf += res;
+  801bb9:	48 98                	cltq
+  801bbb:	49 01 c6             	add    %rax,%r14
+        write += res;
+  801bbe:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801bc2:	49 29 c4             	sub    %rax,%r12
+  801bc5:	75 8d                	jne    801b54 <devfile_write_direct+0x4a>
+    return write;
+  801bc7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bcb:	eb 27                	jmp    801bf4 <devfile_write_direct+0xea>
+    size_t write = 0;
+  801bcd:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  801bd1:	eb f4                	jmp    801bc7 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801bd3:	45 89 e9             	mov    %r13d,%r9d
+  801bd6:	4d 89 e0             	mov    %r12,%r8
+  801bd9:	4c 89 f1             	mov    %r14,%rcx
+  801bdc:	ba 04 00 00 00       	mov    $0x4,%edx
+  801be1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801be5:	48 89 c7             	mov    %rax,%rdi
+  801be8:	48 b8 37 15 80 00 00 	movabs $0x801537,%rax
+  801bef:	00 00 00 
+  801bf2:	ff d0                	call   *%rax
+}
+  801bf4:	48 83 c4 18          	add    $0x18,%rsp
+  801bf8:	5b                   	pop    %rbx
+  801bf9:	41 5c                	pop    %r12
+  801bfb:	41 5d                	pop    %r13
+  801bfd:	41 5e                	pop    %r14
+  801bff:	41 5f                	pop    %r15
+  801c01:	5d                   	pop    %rbp
+  801c02:	c3                   	ret
+            return res;
+  801c03:	48 98                	cltq
+  801c05:	eb ed                	jmp    801bf4 <devfile_write_direct+0xea>
+
+0000000000801c07 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  801c07:	55                   	push   %rbp
+  801c08:	48 89 e5             	mov    %rsp,%rbp
+  801c0b:	41 54                	push   %r12
+  801c0d:	53                   	push   %rbx
+  801c0e:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  801c11:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  801c18:	00 00 00 
+  801c1b:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  801c1d:	48 85 c0             	test   %rax,%rax
+  801c20:	74 71                	je     801c93 <fbuf_flush+0x8c>
+  801c22:	48 89 c3             	mov    %rax,%rbx
+  801c25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c2a:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  801c2e:	75 05                	jne    801c35 <fbuf_flush+0x2e>
+}
+  801c30:	5b                   	pop    %rbx
+  801c31:	41 5c                	pop    %r12
+  801c33:	5d                   	pop    %rbp
+  801c34:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  801c35:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801c38:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  801c3c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801c43:	00 00 00 
+  801c46:	48 89 de             	mov    %rbx,%rsi
+  801c49:	48 29 c6             	sub    %rax,%rsi
+  801c4c:	48 c1 fe 03          	sar    $0x3,%rsi
+  801c50:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801c57:	aa aa aa 
+  801c5a:	48 0f af f0          	imul   %rax,%rsi
+  801c5e:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801c62:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801c67:	48 01 c6             	add    %rax,%rsi
+  801c6a:	4c 89 e7             	mov    %r12,%rdi
+  801c6d:	48 b8 0a 1b 80 00 00 	movabs $0x801b0a,%rax
+  801c74:	00 00 00 
+  801c77:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801c79:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801c7d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801c84:	00 
+    return res < 0 ? res : 0;
+  801c85:	48 85 c0             	test   %rax,%rax
+  801c88:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c8d:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801c91:	eb 9d                	jmp    801c30 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801c93:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c98:	eb 96                	jmp    801c30 <fbuf_flush+0x29>
+
+0000000000801c9a <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801c9a:	55                   	push   %rbp
+  801c9b:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801c9e:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  801ca5:	00 00 00 
+  801ca8:	ff d0                	call   *%rax
+}
+  801caa:	5d                   	pop    %rbp
+  801cab:	c3                   	ret
+
+0000000000801cac <devfile_write>:
+    if (!fd || !buf)
+  801cac:	48 85 ff             	test   %rdi,%rdi
+  801caf:	0f 84 d3 01 00 00    	je     801e88 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801cb5:	55                   	push   %rbp
+  801cb6:	48 89 e5             	mov    %rsp,%rbp
+  801cb9:	41 57                	push   %r15
+  801cbb:	41 56                	push   %r14
+  801cbd:	41 55                	push   %r13
+  801cbf:	41 54                	push   %r12
+  801cc1:	53                   	push   %rbx
+  801cc2:	48 83 ec 08          	sub    $0x8,%rsp
+  801cc6:	49 89 fc             	mov    %rdi,%r12
+  801cc9:	49 89 f6             	mov    %rsi,%r14
+  801ccc:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  801ccf:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801cd4:	48 85 f6             	test   %rsi,%rsi
+  801cd7:	0f 84 9c 01 00 00    	je     801e79 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  801cdd:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  801ce4:	00 00 00 
+  801ce7:	ff d0                	call   *%rax
+  801ce9:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  801cec:	48 85 c0             	test   %rax,%rax
+  801cef:	0f 84 a2 00 00 00    	je     801d97 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801cf5:	be 00 10 00 00       	mov    $0x1000,%esi
+  801cfa:	4c 89 e7             	mov    %r12,%rdi
+  801cfd:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  801d09:	83 f8 02             	cmp    $0x2,%eax
+  801d0c:	0f 8f 85 00 00 00    	jg     801d97 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  801d12:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801d19:	00 00 00 
+  801d1c:	4d 89 ef             	mov    %r13,%r15
+  801d1f:	49 29 c7             	sub    %rax,%r15
+  801d22:	49 c1 ff 03          	sar    $0x3,%r15
+  801d26:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801d2d:	aa aa aa 
+  801d30:	4c 0f af f8          	imul   %rax,%r15
+  801d34:	49 c1 e7 0e          	shl    $0xe,%r15
+  801d38:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d3d:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801d40:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801d45:	0f 84 d7 00 00 00    	je     801e22 <devfile_write+0x176>
+  801d4b:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801d4f:	89 c2                	mov    %eax,%edx
+  801d51:	41 03 55 0c          	add    0xc(%r13),%edx
+  801d55:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801d5a:	75 0f                	jne    801d6b <devfile_write+0xbf>
+  801d5c:	48 01 d8             	add    %rbx,%rax
+  801d5f:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801d65:	0f 86 92 00 00 00    	jbe    801dfd <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801d6b:	4c 89 e7             	mov    %r12,%rdi
+  801d6e:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  801d75:	00 00 00 
+  801d78:	ff d0                	call   *%rax
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	78 52                	js     801dd0 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801d7e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801d85:	77 7f                	ja     801e06 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801d87:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801d8c:	0f 85 c2 00 00 00    	jne    801e54 <devfile_write+0x1a8>
+  801d92:	e9 94 00 00 00       	jmp    801e2b <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801d97:	4c 89 e7             	mov    %r12,%rdi
+  801d9a:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  801da1:	00 00 00 
+  801da4:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801da6:	85 c0                	test   %eax,%eax
+  801da8:	79 07                	jns    801db1 <devfile_write+0x105>
+  801daa:	48 98                	cltq
+  801dac:	e9 c8 00 00 00       	jmp    801e79 <devfile_write+0x1cd>
+  801db1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801db6:	48 89 da             	mov    %rbx,%rdx
+  801db9:	4c 89 f6             	mov    %r14,%rsi
+  801dbc:	4c 89 e7             	mov    %r12,%rdi
+  801dbf:	48 b8 0a 1b 80 00 00 	movabs $0x801b0a,%rax
+  801dc6:	00 00 00 
+  801dc9:	ff d0                	call   *%rax
+  801dcb:	e9 a9 00 00 00       	jmp    801e79 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801dd0:	48 98                	cltq
+  801dd2:	e9 a2 00 00 00       	jmp    801e79 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801dd7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801ddc:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801de1:	4c 89 fe             	mov    %r15,%rsi
+  801de4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de9:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	79 45                	jns    801e3e <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801df9:	48 98                	cltq
+  801dfb:	eb 7c                	jmp    801e79 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801dfd:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801e04:	76 4e                	jbe    801e54 <devfile_write+0x1a8>
+  801e06:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801e0b:	48 89 da             	mov    %rbx,%rdx
+  801e0e:	4c 89 f6             	mov    %r14,%rsi
+  801e11:	4c 89 e7             	mov    %r12,%rdi
+  801e14:	48 b8 0a 1b 80 00 00 	movabs $0x801b0a,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+  801e20:	eb 57                	jmp    801e79 <devfile_write+0x1cd>
+  801e22:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801e29:	77 db                	ja     801e06 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  801e2b:	4c 89 ff             	mov    %r15,%rdi
+  801e2e:	48 b8 d5 33 80 00 00 	movabs $0x8033d5,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+  801e3a:	84 c0                	test   %al,%al
+  801e3c:	74 99                	je     801dd7 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  801e3e:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  801e43:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801e48:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801e4c:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801e53:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801e54:	4c 89 ff             	mov    %r15,%rdi
+  801e57:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801e5b:	48 89 da             	mov    %rbx,%rdx
+  801e5e:	4c 89 f6             	mov    %r14,%rsi
+  801e61:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  801e68:	00 00 00 
+  801e6b:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801e6d:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801e71:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801e76:	48 89 d8             	mov    %rbx,%rax
+}
+  801e79:	48 83 c4 08          	add    $0x8,%rsp
+  801e7d:	5b                   	pop    %rbx
+  801e7e:	41 5c                	pop    %r12
+  801e80:	41 5d                	pop    %r13
+  801e82:	41 5e                	pop    %r14
+  801e84:	41 5f                	pop    %r15
+  801e86:	5d                   	pop    %rbp
+  801e87:	c3                   	ret
+        return E_INVAL;
+  801e88:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e8d:	c3                   	ret
+
+0000000000801e8e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801e8e:	55                   	push   %rbp
+  801e8f:	48 89 e5             	mov    %rsp,%rbp
+  801e92:	41 54                	push   %r12
+  801e94:	53                   	push   %rbx
+  801e95:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801e98:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  801e9f:	00 00 00 
+  801ea2:	ff d0                	call   *%rax
+  801ea4:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801ea7:	48 89 df             	mov    %rbx,%rdi
+  801eaa:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+  801eb6:	48 85 c0             	test   %rax,%rax
+  801eb9:	74 17                	je     801ed2 <devfile_flush+0x44>
+  801ebb:	48 89 df             	mov    %rbx,%rdi
+  801ebe:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  801ec5:	00 00 00 
+  801ec8:	ff d0                	call   *%rax
+  801eca:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801ed1:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801ed2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801ed5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  801edc:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  801ede:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ee8:	bf 06 00 00 00       	mov    $0x6,%edi
+  801eed:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  801ef9:	45 85 e4             	test   %r12d,%r12d
+  801efc:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  801f00:	5b                   	pop    %rbx
+  801f01:	41 5c                	pop    %r12
+  801f03:	5d                   	pop    %rbp
+  801f04:	c3                   	ret
+
+0000000000801f05 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	41 57                	push   %r15
+  801f0b:	41 56                	push   %r14
+  801f0d:	41 55                	push   %r13
+  801f0f:	41 54                	push   %r12
+  801f11:	53                   	push   %rbx
+  801f12:	48 83 ec 38          	sub    $0x38,%rsp
+  801f16:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801f1a:	49 89 f7             	mov    %rsi,%r15
+  801f1d:	48 89 d3             	mov    %rdx,%rbx
+  801f20:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  801f23:	48 b8 50 14 80 00 00 	movabs $0x801450,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801f2f:	48 85 c0             	test   %rax,%rax
+  801f32:	75 20                	jne    801f54 <devfile_read_direct+0x4f>
+    bool map = 1;
+  801f34:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801f39:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801f40:	00 
+    while (n) {
+  801f41:	48 85 db             	test   %rbx,%rbx
+  801f44:	0f 85 df 00 00 00    	jne    802029 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801f4a:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801f4e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801f52:	eb 21                	jmp    801f75 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801f54:	45 89 f1             	mov    %r14d,%r9d
+  801f57:	49 89 d8             	mov    %rbx,%r8
+  801f5a:	4c 89 f9             	mov    %r15,%rcx
+  801f5d:	ba 03 00 00 00       	mov    $0x3,%edx
+  801f62:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801f66:	48 89 c7             	mov    %rax,%rdi
+  801f69:	48 b8 37 15 80 00 00 	movabs $0x801537,%rax
+  801f70:	00 00 00 
+  801f73:	ff d0                	call   *%rax
+}
+  801f75:	48 83 c4 38          	add    $0x38,%rsp
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	41 5d                	pop    %r13
+  801f7e:	41 5e                	pop    %r14
+  801f80:	41 5f                	pop    %r15
+  801f82:	5d                   	pop    %rbp
+  801f83:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801f84:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801f88:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801f8e:	75 1e                	jne    801fae <devfile_read_direct+0xa9>
+  801f90:	e9 e2 00 00 00       	jmp    802077 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801f95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801f99:	eb da                	jmp    801f75 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801f9b:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801f9f:	0f 85 d0 01 00 00    	jne    802175 <devfile_read_direct+0x270>
+            map = 0;
+  801fa5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801fa9:	eb 03                	jmp    801fae <devfile_read_direct+0xa9>
+  801fab:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801fae:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801fb3:	48 39 d3             	cmp    %rdx,%rbx
+  801fb6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801fba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fbe:	8b 40 0c             	mov    0xc(%rax),%eax
+  801fc1:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801fc8:	00 00 00 
+  801fcb:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801fcd:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801fd1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fda:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fdf:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+        if (res <= 0)
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	0f 8e 63 01 00 00    	jle    802156 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801ff3:	4c 63 e0             	movslq %eax,%r12
+  801ff6:	4c 89 e2             	mov    %r12,%rdx
+  801ff9:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802000:	00 00 00 
+  802003:	4c 89 ff             	mov    %r15,%rdi
+  802006:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  80200d:	00 00 00 
+  802010:	ff d0                	call   *%rax
+        buf += res;
+  802012:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802015:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802018:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  80201c:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802020:	48 85 db             	test   %rbx,%rbx
+  802023:	0f 84 25 ff ff ff    	je     801f4e <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802029:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80202c:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802030:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802034:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802038:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80203f:	0f 97 c2             	seta   %dl
+  802042:	20 c2                	and    %al,%dl
+  802044:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802047:	0f 84 5e ff ff ff    	je     801fab <devfile_read_direct+0xa6>
+  80204d:	4c 89 fa             	mov    %r15,%rdx
+  802050:	4d 89 fd             	mov    %r15,%r13
+  802053:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80205a:	0f 85 4e ff ff ff    	jne    801fae <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802060:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802064:	0f 84 1a ff ff ff    	je     801f84 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80206a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802071:	0f 85 37 ff ff ff    	jne    801fae <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802077:	48 89 d8             	mov    %rbx,%rax
+  80207a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802080:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802085:	48 39 c8             	cmp    %rcx,%rax
+  802088:	48 0f 47 c1          	cmova  %rcx,%rax
+  80208c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802090:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802094:	49 89 d4             	mov    %rdx,%r12
+  802097:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80209b:	48 b8 76 33 80 00 00 	movabs $0x803376,%rax
+  8020a2:	00 00 00 
+  8020a5:	ff d0                	call   *%rax
+  8020a7:	a8 40                	test   $0x40,%al
+  8020a9:	0f 85 b9 00 00 00    	jne    802168 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8020af:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8020b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020ba:	49 39 c5             	cmp    %rax,%r13
+  8020bd:	72 d8                	jb     802097 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8020bf:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8020c3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8020ca:	00 00 00 
+  8020cd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8020d1:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8020d4:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8020d6:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8020da:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8020de:	48 b8 eb 12 80 00 00 	movabs $0x8012eb,%rax
+  8020e5:	00 00 00 
+  8020e8:	ff d0                	call   *%rax
+  8020ea:	89 c7                	mov    %eax,%edi
+  8020ec:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020f7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8020fe:	00 00 00 
+  802101:	be 0e 00 00 00       	mov    $0xe,%esi
+  802106:	48 b8 ba 46 80 00 00 	movabs $0x8046ba,%rax
+  80210d:	00 00 00 
+  802110:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802112:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802117:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80211b:	4c 89 fe             	mov    %r15,%rsi
+  80211e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802123:	48 b8 96 46 80 00 00 	movabs $0x804696,%rax
+  80212a:	00 00 00 
+  80212d:	ff d0                	call   *%rax
+  80212f:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802132:	48 85 d2             	test   %rdx,%rdx
+  802135:	0f 84 5a fe ff ff    	je     801f95 <devfile_read_direct+0x90>
+            if (res > 0) {
+  80213b:	0f 8e 5a fe ff ff    	jle    801f9b <devfile_read_direct+0x96>
+                buf += res;
+  802141:	48 98                	cltq
+  802143:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802146:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802149:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  80214d:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802151:	e9 ca fe ff ff       	jmp    802020 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802156:	41 89 c5             	mov    %eax,%r13d
+  802159:	48 98                	cltq
+  80215b:	45 85 ed             	test   %r13d,%r13d
+  80215e:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802163:	e9 0d fe ff ff       	jmp    801f75 <devfile_read_direct+0x70>
+            map = 0;
+  802168:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80216c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802170:	e9 39 fe ff ff       	jmp    801fae <devfile_read_direct+0xa9>
+  802175:	48 89 d0             	mov    %rdx,%rax
+  802178:	e9 f8 fd ff ff       	jmp    801f75 <devfile_read_direct+0x70>
+
+000000000080217d <devfile_read>:
+    if (!fd || !buf)
+  80217d:	48 85 ff             	test   %rdi,%rdi
+  802180:	0f 84 21 02 00 00    	je     8023a7 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802186:	55                   	push   %rbp
+  802187:	48 89 e5             	mov    %rsp,%rbp
+  80218a:	41 57                	push   %r15
+  80218c:	41 56                	push   %r14
+  80218e:	41 55                	push   %r13
+  802190:	41 54                	push   %r12
+  802192:	53                   	push   %rbx
+  802193:	48 83 ec 28          	sub    $0x28,%rsp
+  802197:	48 89 fb             	mov    %rdi,%rbx
+  80219a:	49 89 f4             	mov    %rsi,%r12
+  80219d:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  8021a0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8021a5:	48 85 f6             	test   %rsi,%rsi
+  8021a8:	74 4b                	je     8021f5 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  8021aa:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+  8021b6:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8021b9:	48 85 c0             	test   %rax,%rax
+  8021bc:	74 22                	je     8021e0 <devfile_read+0x63>
+  8021be:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8021c5:	77 19                	ja     8021e0 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8021c7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8021cc:	48 89 df             	mov    %rbx,%rdi
+  8021cf:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8021db:	83 f8 02             	cmp    $0x2,%eax
+  8021de:	7e 40                	jle    802220 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8021e0:	48 89 df             	mov    %rbx,%rdi
+  8021e3:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  8021ea:	00 00 00 
+  8021ed:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8021ef:	85 c0                	test   %eax,%eax
+  8021f1:	79 11                	jns    802204 <devfile_read+0x87>
+  8021f3:	48 98                	cltq
+}
+  8021f5:	48 83 c4 28          	add    $0x28,%rsp
+  8021f9:	5b                   	pop    %rbx
+  8021fa:	41 5c                	pop    %r12
+  8021fc:	41 5d                	pop    %r13
+  8021fe:	41 5e                	pop    %r14
+  802200:	41 5f                	pop    %r15
+  802202:	5d                   	pop    %rbp
+  802203:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802204:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802209:	4c 89 ea             	mov    %r13,%rdx
+  80220c:	4c 89 e6             	mov    %r12,%rsi
+  80220f:	48 89 df             	mov    %rbx,%rdi
+  802212:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  802219:	00 00 00 
+  80221c:	ff d0                	call   *%rax
+  80221e:	eb d5                	jmp    8021f5 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802220:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802224:	48 89 df             	mov    %rbx,%rdi
+  802227:	48 b8 07 1c 80 00 00 	movabs $0x801c07,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+  802233:	85 c0                	test   %eax,%eax
+  802235:	0f 88 33 01 00 00    	js     80236e <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  80223b:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802242:	00 00 00 
+  802245:	4c 89 f0             	mov    %r14,%rax
+  802248:	48 29 d0             	sub    %rdx,%rax
+  80224b:	48 c1 f8 03          	sar    $0x3,%rax
+  80224f:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802256:	aa aa aa 
+  802259:	48 0f af c2          	imul   %rdx,%rax
+  80225d:	48 c1 e0 0e          	shl    $0xe,%rax
+  802261:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802265:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802268:	41 39 06             	cmp    %eax,(%r14)
+  80226b:	75 0d                	jne    80227a <devfile_read+0xfd>
+  80226d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802270:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802274:	0f 84 fb 00 00 00    	je     802375 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  80227a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80227f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802283:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802286:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80228a:	48 89 c7             	mov    %rax,%rdi
+  80228d:	48 b8 d5 33 80 00 00 	movabs $0x8033d5,%rax
+  802294:	00 00 00 
+  802297:	ff d0                	call   *%rax
+  802299:	84 c0                	test   %al,%al
+  80229b:	75 27                	jne    8022c4 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80229d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8022a2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8022a7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022b0:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  8022b7:	00 00 00 
+  8022ba:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8022bc:	85 c0                	test   %eax,%eax
+  8022be:	0f 88 dc 00 00 00    	js     8023a0 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8022c4:	44 89 f8             	mov    %r15d,%eax
+  8022c7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8022cc:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8022ce:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8022d5:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8022d6:	8b 43 10             	mov    0x10(%rbx),%eax
+  8022d9:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8022dd:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8022e0:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8022e5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8022e9:	48 89 df             	mov    %rbx,%rdi
+  8022ec:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  8022f3:	00 00 00 
+  8022f6:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8022f8:	48 85 c0             	test   %rax,%rax
+  8022fb:	0f 88 f4 fe ff ff    	js     8021f5 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802301:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802304:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802307:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80230a:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80230e:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802312:	48 63 d1             	movslq %ecx,%rdx
+  802315:	48 01 d0             	add    %rdx,%rax
+  802318:	4d 63 ff             	movslq %r15d,%r15
+  80231b:	4c 29 f8             	sub    %r15,%rax
+  80231e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802323:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802327:	48 85 c0             	test   %rax,%rax
+  80232a:	0f 8e c5 fe ff ff    	jle    8021f5 <devfile_read+0x78>
+    n = MIN(n, res);
+  802330:	4c 39 e8             	cmp    %r13,%rax
+  802333:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802337:	8b 73 04             	mov    0x4(%rbx),%esi
+  80233a:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80233e:	48 63 f6             	movslq %esi,%rsi
+  802341:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802346:	48 01 c6             	add    %rax,%rsi
+  802349:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80234d:	48 01 c6             	add    %rax,%rsi
+  802350:	4c 89 ea             	mov    %r13,%rdx
+  802353:	4c 89 e7             	mov    %r12,%rdi
+  802356:	48 b8 88 04 80 00 00 	movabs $0x800488,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802362:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802366:	4c 89 e8             	mov    %r13,%rax
+  802369:	e9 87 fe ff ff       	jmp    8021f5 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80236e:	48 98                	cltq
+  802370:	e9 80 fe ff ff       	jmp    8021f5 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802375:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802379:	41 39 d7             	cmp    %edx,%r15d
+  80237c:	0f 8c f8 fe ff ff    	jl     80227a <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802382:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802386:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802389:	41 39 cf             	cmp    %ecx,%r15d
+  80238c:	0f 8d e8 fe ff ff    	jge    80227a <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802392:	4d 63 ff             	movslq %r15d,%r15
+  802395:	4c 29 f8             	sub    %r15,%rax
+  802398:	48 63 d2             	movslq %edx,%rdx
+  80239b:	48 01 d0             	add    %rdx,%rax
+  80239e:	eb 87                	jmp    802327 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8023a0:	48 98                	cltq
+  8023a2:	e9 4e fe ff ff       	jmp    8021f5 <devfile_read+0x78>
+        return E_INVAL;
+  8023a7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8023ac:	c3                   	ret
+
+00000000008023ad <fs_channel>:
+fs_channel(bool enable) {
+  8023ad:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8023af:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8023b6:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8023b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023bd:	40 84 ff             	test   %dil,%dil
+  8023c0:	74 47                	je     802409 <fs_channel+0x5c>
+  8023c2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8023c9:	00 00 00 
+  8023cc:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8023d2:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8023d9:	00 00 00 
+  8023dc:	3b 08                	cmp    (%rax),%ecx
+  8023de:	74 29                	je     802409 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8023e0:	55                   	push   %rbp
+  8023e1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8023e4:	48 b8 2d 13 80 00 00 	movabs $0x80132d,%rax
+  8023eb:	00 00 00 
+  8023ee:	ff d0                	call   *%rax
+  8023f0:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8023f2:	85 c0                	test   %eax,%eax
+  8023f4:	78 04                	js     8023fa <fs_channel+0x4d>
+}
+  8023f6:	89 d0                	mov    %edx,%eax
+  8023f8:	5d                   	pop    %rbp
+  8023f9:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8023fa:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802401:	00 00 00 
+  802404:	c6 00 00             	movb   $0x0,(%rax)
+  802407:	eb ed                	jmp    8023f6 <fs_channel+0x49>
+}
+  802409:	89 d0                	mov    %edx,%eax
+  80240b:	c3                   	ret
+
+000000000080240c <open>:
+open(const char *path, int mode) {
+  80240c:	55                   	push   %rbp
+  80240d:	48 89 e5             	mov    %rsp,%rbp
+  802410:	41 55                	push   %r13
+  802412:	41 54                	push   %r12
+  802414:	53                   	push   %rbx
+  802415:	48 83 ec 18          	sub    $0x18,%rsp
+  802419:	49 89 fc             	mov    %rdi,%r12
+  80241c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80241f:	48 b8 e9 01 80 00 00 	movabs $0x8001e9,%rax
+  802426:	00 00 00 
+  802429:	ff d0                	call   *%rax
+  80242b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802431:	0f 87 8f 00 00 00    	ja     8024c6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802437:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80243b:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  802442:	00 00 00 
+  802445:	ff d0                	call   *%rax
+  802447:	89 c3                	mov    %eax,%ebx
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	78 55                	js     8024a2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80244d:	4c 89 e6             	mov    %r12,%rsi
+  802450:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802457:	00 00 00 
+  80245a:	48 89 df             	mov    %rbx,%rdi
+  80245d:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  802464:	00 00 00 
+  802467:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802469:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802470:	ba 00 00 00 00       	mov    $0x0,%edx
+  802475:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802479:	bf 01 00 00 00       	mov    $0x1,%edi
+  80247e:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802485:	00 00 00 
+  802488:	ff d0                	call   *%rax
+  80248a:	89 c3                	mov    %eax,%ebx
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 1f                	js     8024af <open+0xa3>
+    return fd2num(fd);
+  802490:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802494:	48 b8 b9 0b 80 00 00 	movabs $0x800bb9,%rax
+  80249b:	00 00 00 
+  80249e:	ff d0                	call   *%rax
+  8024a0:	89 c3                	mov    %eax,%ebx
+}
+  8024a2:	89 d8                	mov    %ebx,%eax
+  8024a4:	48 83 c4 18          	add    $0x18,%rsp
+  8024a8:	5b                   	pop    %rbx
+  8024a9:	41 5c                	pop    %r12
+  8024ab:	41 5d                	pop    %r13
+  8024ad:	5d                   	pop    %rbp
+  8024ae:	c3                   	ret
+        fd_close(fd, 0);
+  8024af:	be 00 00 00 00       	mov    $0x0,%esi
+  8024b4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8024b8:	48 b8 02 0d 80 00 00 	movabs $0x800d02,%rax
+  8024bf:	00 00 00 
+  8024c2:	ff d0                	call   *%rax
+        return res;
+  8024c4:	eb dc                	jmp    8024a2 <open+0x96>
+        return -E_BAD_PATH;
+  8024c6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8024cb:	eb d5                	jmp    8024a2 <open+0x96>
+
+00000000008024cd <file_flush_buffers>:
+file_flush_buffers(void) {
+  8024cd:	55                   	push   %rbp
+  8024ce:	48 89 e5             	mov    %rsp,%rbp
+  8024d1:	41 56                	push   %r14
+  8024d3:	41 55                	push   %r13
+  8024d5:	41 54                	push   %r12
+  8024d7:	53                   	push   %rbx
+  8024d8:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8024dc:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8024e3:	00 00 00 
+  8024e6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8024eb:	49 bd 47 0c 80 00 00 	movabs $0x800c47,%r13
+  8024f2:	00 00 00 
+  8024f5:	49 be 07 1c 80 00 00 	movabs $0x801c07,%r14
+  8024fc:	00 00 00 
+  8024ff:	eb 0c                	jmp    80250d <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802501:	83 c3 01             	add    $0x1,%ebx
+  802504:	49 83 c4 18          	add    $0x18,%r12
+  802508:	83 fb 20             	cmp    $0x20,%ebx
+  80250b:	74 1d                	je     80252a <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80250d:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802512:	74 ed                	je     802501 <file_flush_buffers+0x34>
+  802514:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802518:	89 df                	mov    %ebx,%edi
+  80251a:	41 ff d5             	call   *%r13
+  80251d:	85 c0                	test   %eax,%eax
+  80251f:	78 e0                	js     802501 <file_flush_buffers+0x34>
+  802521:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802525:	41 ff d6             	call   *%r14
+  802528:	eb d7                	jmp    802501 <file_flush_buffers+0x34>
+}
+  80252a:	48 83 c4 10          	add    $0x10,%rsp
+  80252e:	5b                   	pop    %rbx
+  80252f:	41 5c                	pop    %r12
+  802531:	41 5d                	pop    %r13
+  802533:	41 5e                	pop    %r14
+  802535:	5d                   	pop    %rbp
+  802536:	c3                   	ret
+
+0000000000802537 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802537:	55                   	push   %rbp
+  802538:	48 89 e5             	mov    %rsp,%rbp
+  80253b:	41 54                	push   %r12
+  80253d:	53                   	push   %rbx
+  80253e:	49 89 fc             	mov    %rdi,%r12
+  802541:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802543:	48 b8 cd 24 80 00 00 	movabs $0x8024cd,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80254f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802556:	00 00 00 
+  802559:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80255e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802560:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802563:	ba 00 00 00 00       	mov    $0x0,%edx
+  802568:	be 00 00 00 00       	mov    $0x0,%esi
+  80256d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802572:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802579:	00 00 00 
+  80257c:	ff d0                	call   *%rax
+}
+  80257e:	5b                   	pop    %rbx
+  80257f:	41 5c                	pop    %r12
+  802581:	5d                   	pop    %rbp
+  802582:	c3                   	ret
+
+0000000000802583 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802583:	55                   	push   %rbp
+  802584:	48 89 e5             	mov    %rsp,%rbp
+  802587:	41 54                	push   %r12
+  802589:	53                   	push   %rbx
+  80258a:	49 89 fc             	mov    %rdi,%r12
+  80258d:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802590:	48 b8 cd 24 80 00 00 	movabs $0x8024cd,%rax
+  802597:	00 00 00 
+  80259a:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80259c:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8025a1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8025a8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8025aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8025af:	be 00 00 00 00       	mov    $0x0,%esi
+  8025b4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8025b9:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  8025c0:	00 00 00 
+  8025c3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8025c5:	85 c0                	test   %eax,%eax
+  8025c7:	78 3d                	js     802606 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8025c9:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8025d0:	00 00 00 
+  8025d3:	4c 89 e6             	mov    %r12,%rsi
+  8025d6:	48 89 df             	mov    %rbx,%rdi
+  8025d9:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8025e5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8025ec:	00 
+  8025ed:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8025f3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8025fa:	00 
+  8025fb:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802601:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802606:	5b                   	pop    %rbx
+  802607:	41 5c                	pop    %r12
+  802609:	5d                   	pop    %rbp
+  80260a:	c3                   	ret
+
+000000000080260b <remove>:
+remove(const char *path) {
+  80260b:	55                   	push   %rbp
+  80260c:	48 89 e5             	mov    %rsp,%rbp
+  80260f:	53                   	push   %rbx
+  802610:	48 83 ec 08          	sub    $0x8,%rsp
+  802614:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802617:	48 b8 e9 01 80 00 00 	movabs $0x8001e9,%rax
+  80261e:	00 00 00 
+  802621:	ff d0                	call   *%rax
+  802623:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802629:	77 3a                	ja     802665 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80262b:	48 89 de             	mov    %rbx,%rsi
+  80262e:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802635:	00 00 00 
+  802638:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802644:	ba 00 00 00 00       	mov    $0x0,%edx
+  802649:	be 00 00 00 00       	mov    $0x0,%esi
+  80264e:	bf 07 00 00 00       	mov    $0x7,%edi
+  802653:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  80265a:	00 00 00 
+  80265d:	ff d0                	call   *%rax
+}
+  80265f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802663:	c9                   	leave
+  802664:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802665:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80266a:	eb f3                	jmp    80265f <remove+0x54>
+
+000000000080266c <sync>:
+sync(void) {
+  80266c:	55                   	push   %rbp
+  80266d:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802670:	48 b8 cd 24 80 00 00 	movabs $0x8024cd,%rax
+  802677:	00 00 00 
+  80267a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80267c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802681:	be 00 00 00 00       	mov    $0x0,%esi
+  802686:	bf 08 00 00 00       	mov    $0x8,%edi
+  80268b:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+}
+  802697:	5d                   	pop    %rbp
+  802698:	c3                   	ret
+
+0000000000802699 <fsync>:
+fsync(int fdnum) {
+  802699:	55                   	push   %rbp
+  80269a:	48 89 e5             	mov    %rsp,%rbp
+  80269d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8026a1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8026a5:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  8026ac:	00 00 00 
+  8026af:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8026b1:	85 c0                	test   %eax,%eax
+  8026b3:	78 4b                	js     802700 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8026b9:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8026c0:	00 00 00 
+  8026c3:	8b 00                	mov    (%rax),%eax
+  8026c5:	39 02                	cmp    %eax,(%rdx)
+  8026c7:	75 39                	jne    802702 <fsync+0x69>
+    file_flush_buffers();
+  8026c9:	48 b8 cd 24 80 00 00 	movabs $0x8024cd,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8026d5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8026d9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8026dc:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8026e3:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8026e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8026ef:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8026f4:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  8026fb:	00 00 00 
+  8026fe:	ff d0                	call   *%rax
+}
+  802700:	c9                   	leave
+  802701:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802702:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802707:	eb f7                	jmp    802700 <fsync+0x67>
+
+0000000000802709 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802709:	55                   	push   %rbp
+  80270a:	48 89 e5             	mov    %rsp,%rbp
+  80270d:	53                   	push   %rbx
+  80270e:	48 83 ec 08          	sub    $0x8,%rsp
+  802712:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802715:	ba 00 00 00 00       	mov    $0x0,%edx
+  80271a:	be 00 00 00 00       	mov    $0x0,%esi
+  80271f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802724:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802730:	85 c0                	test   %eax,%eax
+  802732:	78 2d                	js     802761 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  802734:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80273b:	00 00 00 
+  80273e:	48 8b 10             	mov    (%rax),%rdx
+  802741:	48 89 13             	mov    %rdx,(%rbx)
+  802744:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802748:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80274c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802750:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802754:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802758:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80275c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802761:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802765:	c9                   	leave
+  802766:	c3                   	ret
+
+0000000000802767 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	53                   	push   %rbx
+  80276c:	48 83 ec 08          	sub    $0x8,%rsp
+  802770:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802773:	ba 00 00 00 00       	mov    $0x0,%edx
+  802778:	be 00 00 00 00       	mov    $0x0,%esi
+  80277d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802782:	48 b8 9e 19 80 00 00 	movabs $0x80199e,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80278e:	85 c0                	test   %eax,%eax
+  802790:	78 3d                	js     8027cf <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802792:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802799:	00 00 00 
+  80279c:	48 8b 10             	mov    (%rax),%rdx
+  80279f:	48 89 13             	mov    %rdx,(%rbx)
+  8027a2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8027a6:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8027aa:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8027ae:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8027b2:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8027b6:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8027ba:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8027be:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8027c2:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8027c6:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8027ca:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8027cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8027d3:	c9                   	leave
+  8027d4:	c3                   	ret
+
+00000000008027d5 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8027d5:	55                   	push   %rbp
+  8027d6:	48 89 e5             	mov    %rsp,%rbp
+  8027d9:	41 57                	push   %r15
+  8027db:	41 56                	push   %r14
+  8027dd:	41 55                	push   %r13
+  8027df:	41 54                	push   %r12
+  8027e1:	53                   	push   %rbx
+  8027e2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8027e6:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8027ed:	00 
+  8027ee:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8027f5:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8027fb:	0f 85 43 01 00 00    	jne    802944 <munmap+0x16f>
+  802801:	49 89 ff             	mov    %rdi,%r15
+  802804:	4c 39 f7             	cmp    %r14,%rdi
+  802807:	0f 87 37 01 00 00    	ja     802944 <munmap+0x16f>
+  80280d:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  802814:	00 00 00 
+  802817:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80281d:	eb 2c                	jmp    80284b <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80281f:	4c 39 f8             	cmp    %r15,%rax
+  802822:	0f 83 85 00 00 00    	jae    8028ad <munmap+0xd8>
+            m->mm_end = start;
+  802828:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80282d:	48 83 c3 18          	add    $0x18,%rbx
+  802831:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802838:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80283f:	00 00 00 
+  802842:	48 39 c3             	cmp    %rax,%rbx
+  802845:	0f 84 d0 00 00 00    	je     80291b <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80284b:	49 89 dc             	mov    %rbx,%r12
+  80284e:	48 8b 03             	mov    (%rbx),%rax
+  802851:	4c 39 f0             	cmp    %r14,%rax
+  802854:	73 d7                	jae    80282d <munmap+0x58>
+  802856:	48 85 c0             	test   %rax,%rax
+  802859:	74 d2                	je     80282d <munmap+0x58>
+  80285b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80285f:	49 39 d7             	cmp    %rdx,%r15
+  802862:	73 c9                	jae    80282d <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802864:	49 39 d6             	cmp    %rdx,%r14
+  802867:	73 b6                	jae    80281f <munmap+0x4a>
+  802869:	49 39 c7             	cmp    %rax,%r15
+  80286c:	76 b1                	jbe    80281f <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80286e:	4c 89 ef             	mov    %r13,%rdi
+  802871:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  802878:	00 00 00 
+  80287b:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80287d:	48 85 c0             	test   %rax,%rax
+  802880:	0f 84 c5 00 00 00    	je     80294b <munmap+0x176>
+            *tail = *m;
+  802886:	48 8b 13             	mov    (%rbx),%rdx
+  802889:	48 89 10             	mov    %rdx,(%rax)
+  80288c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802890:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802894:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802898:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80289c:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80289f:	44 89 f2             	mov    %r14d,%edx
+  8028a2:	2b 13                	sub    (%rbx),%edx
+  8028a4:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8028a7:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8028ab:	eb 80                	jmp    80282d <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8028ad:	49 39 d6             	cmp    %rdx,%r14
+  8028b0:	73 18                	jae    8028ca <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8028b2:	44 89 f2             	mov    %r14d,%edx
+  8028b5:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8028ba:	29 c2                	sub    %eax,%edx
+  8028bc:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8028c1:	4d 89 34 24          	mov    %r14,(%r12)
+  8028c5:	e9 63 ff ff ff       	jmp    80282d <munmap+0x58>
+    m->mm_start = 0;
+  8028ca:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8028d1:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8028d2:	4c 89 e6             	mov    %r12,%rsi
+  8028d5:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8028dc:	00 00 00 
+  8028df:	48 29 c6             	sub    %rax,%rsi
+  8028e2:	48 c1 fe 03          	sar    $0x3,%rsi
+  8028e6:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8028ed:	aa aa aa 
+  8028f0:	48 0f af f0          	imul   %rax,%rsi
+  8028f4:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8028f8:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8028fd:	48 01 c6             	add    %rax,%rsi
+  802900:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802905:	bf 00 00 00 00       	mov    $0x0,%edi
+  80290a:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  802911:	00 00 00 
+  802914:	ff d0                	call   *%rax
+}
+  802916:	e9 12 ff ff ff       	jmp    80282d <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80291b:	4c 89 f2             	mov    %r14,%rdx
+  80291e:	4c 29 fa             	sub    %r15,%rdx
+  802921:	4c 89 fe             	mov    %r15,%rsi
+  802924:	bf 00 00 00 00       	mov    $0x0,%edi
+  802929:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+}
+  802935:	48 83 c4 08          	add    $0x8,%rsp
+  802939:	5b                   	pop    %rbx
+  80293a:	41 5c                	pop    %r12
+  80293c:	41 5d                	pop    %r13
+  80293e:	41 5e                	pop    %r14
+  802940:	41 5f                	pop    %r15
+  802942:	5d                   	pop    %rbp
+  802943:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802944:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802949:	eb ea                	jmp    802935 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80294b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802950:	eb e3                	jmp    802935 <munmap+0x160>
+
+0000000000802952 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802952:	55                   	push   %rbp
+  802953:	48 89 e5             	mov    %rsp,%rbp
+  802956:	41 57                	push   %r15
+  802958:	41 56                	push   %r14
+  80295a:	41 55                	push   %r13
+  80295c:	41 54                	push   %r12
+  80295e:	53                   	push   %rbx
+  80295f:	48 83 ec 28          	sub    $0x28,%rsp
+  802963:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802967:	49 89 f5             	mov    %rsi,%r13
+  80296a:	41 89 d6             	mov    %edx,%r14d
+  80296d:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802970:	41 89 cc             	mov    %ecx,%r12d
+  802973:	44 89 c7             	mov    %r8d,%edi
+  802976:	44 89 cb             	mov    %r9d,%ebx
+  802979:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80297d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802981:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+  80298d:	41 89 c7             	mov    %eax,%r15d
+  802990:	85 c0                	test   %eax,%eax
+  802992:	0f 88 ae 01 00 00    	js     802b46 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802998:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80299c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8029a3:	00 00 00 
+  8029a6:	8b 32                	mov    (%rdx),%esi
+  8029a8:	39 30                	cmp    %esi,(%rax)
+  8029aa:	0f 85 7a 02 00 00    	jne    802c2a <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8029b0:	8b 40 08             	mov    0x8(%rax),%eax
+  8029b3:	83 e0 03             	and    $0x3,%eax
+  8029b6:	83 f8 01             	cmp    $0x1,%eax
+  8029b9:	0f 84 76 02 00 00    	je     802c35 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8029bf:	4d 85 ed             	test   %r13,%r13
+  8029c2:	0f 84 78 02 00 00    	je     802c40 <mmap+0x2ee>
+  8029c8:	85 db                	test   %ebx,%ebx
+  8029ca:	0f 88 70 02 00 00    	js     802c40 <mmap+0x2ee>
+  8029d0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8029d6:	41 89 df             	mov    %ebx,%r15d
+  8029d9:	0f 85 6c 02 00 00    	jne    802c4b <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8029df:	44 89 f0             	mov    %r14d,%eax
+  8029e2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8029e5:	83 f8 04             	cmp    $0x4,%eax
+  8029e8:	0f 85 68 02 00 00    	jne    802c56 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8029ee:	44 89 e1             	mov    %r12d,%ecx
+  8029f1:	83 e1 01             	and    $0x1,%ecx
+  8029f4:	0f 95 c2             	setne  %dl
+  8029f7:	44 89 e0             	mov    %r12d,%eax
+  8029fa:	d1 e8                	shr    %eax
+  8029fc:	83 f0 01             	xor    $0x1,%eax
+  8029ff:	83 e0 01             	and    $0x1,%eax
+  802a02:	38 c2                	cmp    %al,%dl
+  802a04:	0f 85 57 02 00 00    	jne    802c61 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802a0a:	85 c9                	test   %ecx,%ecx
+  802a0c:	74 0a                	je     802a18 <mmap+0xc6>
+  802a0e:	41 f6 c6 02          	test   $0x2,%r14b
+  802a12:	0f 85 54 02 00 00    	jne    802c6c <mmap+0x31a>
+    file_flush_buffers();
+  802a18:	48 b8 cd 24 80 00 00 	movabs $0x8024cd,%rax
+  802a1f:	00 00 00 
+  802a22:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  802a24:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802a2b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  802a32:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802a36:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  802a39:	41 f6 c4 04          	test   $0x4,%r12b
+  802a3d:	0f 84 15 01 00 00    	je     802b58 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  802a43:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802a46:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802a4c:	0f 85 25 02 00 00    	jne    802c77 <mmap+0x325>
+  802a52:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802a56:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802a5d:	00 00 00 
+  802a60:	48 39 c2             	cmp    %rax,%rdx
+  802a63:	0f 82 19 02 00 00    	jb     802c82 <mmap+0x330>
+  802a69:	48 39 c7             	cmp    %rax,%rdi
+  802a6c:	0f 87 10 02 00 00    	ja     802c82 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802a72:	4c 89 ee             	mov    %r13,%rsi
+  802a75:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+  802a81:	85 c0                	test   %eax,%eax
+  802a83:	0f 88 04 02 00 00    	js     802c8d <mmap+0x33b>
+    if (!handler) {
+  802a89:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802a90:	00 00 00 
+  802a93:	80 38 00             	cmpb   $0x0,(%rax)
+  802a96:	75 2b                	jne    802ac3 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802a98:	48 bf 6d 18 80 00 00 	movabs $0x80186d,%rdi
+  802a9f:	00 00 00 
+  802aa2:	48 b8 65 43 80 00 00 	movabs $0x804365,%rax
+  802aa9:	00 00 00 
+  802aac:	ff d0                	call   *%rax
+  802aae:	85 c0                	test   %eax,%eax
+  802ab0:	0f 88 ea 01 00 00    	js     802ca0 <mmap+0x34e>
+        handler = 1;
+  802ab6:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802abd:	00 00 00 
+  802ac0:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802ac3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802ac7:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  802ace:	00 00 00 
+  802ad1:	ff d0                	call   *%rax
+  802ad3:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  802ad6:	48 85 c0             	test   %rax,%rax
+  802ad9:	0f 84 c9 01 00 00    	je     802ca8 <mmap+0x356>
+    m->mm_start = va;
+  802adf:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  802ae2:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  802ae6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  802aea:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  802aed:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  802af1:	44 89 e0             	mov    %r12d,%eax
+  802af4:	c1 e0 06             	shl    $0x6,%eax
+  802af7:	25 80 00 00 00       	and    $0x80,%eax
+  802afc:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  802aff:	09 f0                	or     %esi,%eax
+  802b01:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  802b05:	41 f6 c4 08          	test   $0x8,%r12b
+  802b09:	74 31                	je     802b3c <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  802b0b:	48 39 d3             	cmp    %rdx,%rbx
+  802b0e:	73 2c                	jae    802b3c <mmap+0x1ea>
+  802b10:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802b15:	48 89 de             	mov    %rbx,%rsi
+  802b18:	4c 89 f7             	mov    %r14,%rdi
+  802b1b:	48 b8 5c 17 80 00 00 	movabs $0x80175c,%rax
+  802b22:	00 00 00 
+  802b25:	ff d0                	call   *%rax
+  802b27:	49 89 c4             	mov    %rax,%r12
+  802b2a:	48 85 c0             	test   %rax,%rax
+  802b2d:	0f 8e d7 00 00 00    	jle    802c0a <mmap+0x2b8>
+            va += n;
+  802b33:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  802b36:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  802b3a:	72 d4                	jb     802b10 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  802b3c:	49 8b 06             	mov    (%r14),%rax
+  802b3f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802b43:	48 89 06             	mov    %rax,(%rsi)
+}
+  802b46:	44 89 f8             	mov    %r15d,%eax
+  802b49:	48 83 c4 28          	add    $0x28,%rsp
+  802b4d:	5b                   	pop    %rbx
+  802b4e:	41 5c                	pop    %r12
+  802b50:	41 5d                	pop    %r13
+  802b52:	41 5e                	pop    %r14
+  802b54:	41 5f                	pop    %r15
+  802b56:	5d                   	pop    %rbp
+  802b57:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802b58:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802b5f:	00 00 00 
+  802b62:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802b65:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802b6c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802b6f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802b74:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802b7b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802b7e:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802b85:	00 00 00 
+  802b88:	48 39 d7             	cmp    %rdx,%rdi
+  802b8b:	73 1c                	jae    802ba9 <mmap+0x257>
+        return -E_NO_MEM;
+  802b8d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802b93:	eb b1                	jmp    802b46 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802b95:	48 83 c0 01          	add    $0x1,%rax
+  802b99:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802b9d:	77 3f                	ja     802bde <mmap+0x28c>
+  802b9f:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802ba4:	48 39 d7             	cmp    %rdx,%rdi
+  802ba7:	72 2a                	jb     802bd3 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802ba9:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  802bad:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802bb1:	48 39 d1             	cmp    %rdx,%rcx
+  802bb4:	73 df                	jae    802b95 <mmap+0x243>
+  802bb6:	48 85 c9             	test   %rcx,%rcx
+  802bb9:	74 da                	je     802b95 <mmap+0x243>
+  802bbb:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802bbf:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802bc4:	48 39 d3             	cmp    %rdx,%rbx
+  802bc7:	73 cc                	jae    802b95 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802bc9:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd1:	eb cc                	jmp    802b9f <mmap+0x24d>
+        return -E_NO_MEM;
+  802bd3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802bd9:	e9 68 ff ff ff       	jmp    802b46 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  802bde:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  802be3:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  802bea:	00 00 00 
+  802bed:	48 39 c2             	cmp    %rax,%rdx
+  802bf0:	0f 82 9f 00 00 00    	jb     802c95 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  802bf6:	48 85 db             	test   %rbx,%rbx
+  802bf9:	0f 85 8a fe ff ff    	jne    802a89 <mmap+0x137>
+        return -E_NO_MEM;
+  802bff:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802c05:	e9 3c ff ff ff       	jmp    802b46 <mmap+0x1f4>
+        if (n < 0) {
+  802c0a:	0f 89 2c ff ff ff    	jns    802b3c <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  802c10:	49 8b 3e             	mov    (%r14),%rdi
+  802c13:	4c 89 ee             	mov    %r13,%rsi
+  802c16:	48 b8 d5 27 80 00 00 	movabs $0x8027d5,%rax
+  802c1d:	00 00 00 
+  802c20:	ff d0                	call   *%rax
+            return n;
+  802c22:	45 89 e7             	mov    %r12d,%r15d
+  802c25:	e9 1c ff ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802c2a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c30:	e9 11 ff ff ff       	jmp    802b46 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802c35:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c3b:	e9 06 ff ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802c40:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c46:	e9 fb fe ff ff       	jmp    802b46 <mmap+0x1f4>
+  802c4b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c51:	e9 f0 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802c56:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c5c:	e9 e5 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802c61:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c67:	e9 da fe ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802c6c:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802c72:	e9 cf fe ff ff       	jmp    802b46 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802c77:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c7d:	e9 c4 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+  802c82:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802c88:	e9 b9 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802c8d:	41 89 c7             	mov    %eax,%r15d
+  802c90:	e9 b1 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802c95:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802c9b:	e9 a6 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802ca0:	41 89 c7             	mov    %eax,%r15d
+  802ca3:	e9 9e fe ff ff       	jmp    802b46 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802ca8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802cae:	e9 93 fe ff ff       	jmp    802b46 <mmap+0x1f4>
+
+0000000000802cb3 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+  802cb7:	41 54                	push   %r12
+  802cb9:	53                   	push   %rbx
+  802cba:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802cbd:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+  802cc9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802ccc:	48 be 60 48 80 00 00 	movabs $0x804860,%rsi
+  802cd3:	00 00 00 
+  802cd6:	48 89 df             	mov    %rbx,%rdi
+  802cd9:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  802ce0:	00 00 00 
+  802ce3:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802ce5:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cea:	41 2b 04 24          	sub    (%r12),%eax
+  802cee:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802cf4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802cfb:	00 00 00 
+    stat->st_dev = &devpipe;
+  802cfe:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802d05:	00 00 00 
+  802d08:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d14:	5b                   	pop    %rbx
+  802d15:	41 5c                	pop    %r12
+  802d17:	5d                   	pop    %rbp
+  802d18:	c3                   	ret
+
+0000000000802d19 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  802d19:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802d1c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  802d22:	8b 17                	mov    (%rdi),%edx
+  802d24:	85 d2                	test   %edx,%edx
+  802d26:	75 01                	jne    802d29 <pipe_wakeup+0x10>
+  802d28:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  802d29:	55                   	push   %rbp
+  802d2a:	48 89 e5             	mov    %rsp,%rbp
+  802d2d:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  802d30:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  802d36:	be 00 04 00 00       	mov    $0x400,%esi
+  802d3b:	48 b8 12 0b 80 00 00 	movabs $0x800b12,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+}
+  802d47:	5d                   	pop    %rbp
+  802d48:	c3                   	ret
+
+0000000000802d49 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802d49:	55                   	push   %rbp
+  802d4a:	48 89 e5             	mov    %rsp,%rbp
+  802d4d:	41 55                	push   %r13
+  802d4f:	41 54                	push   %r12
+  802d51:	53                   	push   %rbx
+  802d52:	48 83 ec 08          	sub    $0x8,%rsp
+  802d56:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802d59:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  802d60:	00 00 00 
+  802d63:	ff d0                	call   *%rax
+  802d65:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802d68:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d6d:	4c 89 e6             	mov    %r12,%rsi
+  802d70:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d75:	49 bc 2c 08 80 00 00 	movabs $0x80082c,%r12
+  802d7c:	00 00 00 
+  802d7f:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802d82:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802d86:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802d8a:	49 bd 19 2d 80 00 00 	movabs $0x802d19,%r13
+  802d91:	00 00 00 
+  802d94:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802d97:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802d9b:	48 89 de             	mov    %rbx,%rsi
+  802d9e:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802da1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802da6:	48 89 de             	mov    %rbx,%rsi
+  802da9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dae:	41 ff d4             	call   *%r12
+  802db1:	48 83 c4 08          	add    $0x8,%rsp
+  802db5:	5b                   	pop    %rbx
+  802db6:	41 5c                	pop    %r12
+  802db8:	41 5d                	pop    %r13
+  802dba:	5d                   	pop    %rbp
+  802dbb:	c3                   	ret
+
+0000000000802dbc <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802dbc:	55                   	push   %rbp
+  802dbd:	48 89 e5             	mov    %rsp,%rbp
+  802dc0:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802dc3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802dc8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dcd:	48 b8 6f 07 80 00 00 	movabs $0x80076f,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+  802dd9:	85 c0                	test   %eax,%eax
+  802ddb:	0f 94 c0             	sete   %al
+  802dde:	0f b6 c0             	movzbl %al,%eax
+}
+  802de1:	5d                   	pop    %rbp
+  802de2:	c3                   	ret
+
+0000000000802de3 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802de3:	55                   	push   %rbp
+  802de4:	48 89 e5             	mov    %rsp,%rbp
+  802de7:	41 57                	push   %r15
+  802de9:	41 56                	push   %r14
+  802deb:	41 55                	push   %r13
+  802ded:	41 54                	push   %r12
+  802def:	53                   	push   %rbx
+  802df0:	48 83 ec 38          	sub    $0x38,%rsp
+  802df4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802df8:	49 89 f4             	mov    %rsi,%r12
+  802dfb:	49 89 d7             	mov    %rdx,%r15
+  802dfe:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802e02:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  802e09:	00 00 00 
+  802e0c:	ff d0                	call   *%rax
+  802e0e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802e11:	4d 85 ff             	test   %r15,%r15
+  802e14:	0f 84 f1 00 00 00    	je     802f0b <devpipe_write+0x128>
+  802e1a:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  802e1e:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  802e22:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  802e26:	49 bd bc 2d 80 00 00 	movabs $0x802dbc,%r13
+  802e2d:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802e30:	49 bf 19 2d 80 00 00 	movabs $0x802d19,%r15
+  802e37:	00 00 00 
+  802e3a:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802e3e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e42:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802e46:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e49:	48 63 ce             	movslq %esi,%rcx
+  802e4c:	48 63 03             	movslq (%rbx),%rax
+  802e4f:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802e55:	48 39 c1             	cmp    %rax,%rcx
+  802e58:	72 64                	jb     802ebe <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802e5a:	48 89 de             	mov    %rbx,%rsi
+  802e5d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e61:	41 ff d5             	call   *%r13
+  802e64:	85 c0                	test   %eax,%eax
+  802e66:	0f 85 b9 00 00 00    	jne    802f25 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802e6c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e70:	4c 89 f7             	mov    %r14,%rdi
+  802e73:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802e76:	8b 43 04             	mov    0x4(%rbx),%eax
+  802e79:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802e80:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802e87:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802e8d:	8b 03                	mov    (%rbx),%eax
+  802e8f:	41 39 c4             	cmp    %eax,%r12d
+  802e92:	75 b2                	jne    802e46 <devpipe_write+0x63>
+  802e94:	48 89 de             	mov    %rbx,%rsi
+  802e97:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802e9b:	41 ff d5             	call   *%r13
+  802e9e:	85 c0                	test   %eax,%eax
+  802ea0:	75 a0                	jne    802e42 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802ea2:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802ea7:	44 89 e6             	mov    %r12d,%esi
+  802eaa:	48 89 df             	mov    %rbx,%rdi
+  802ead:	48 b8 f4 0a 80 00 00 	movabs $0x800af4,%rax
+  802eb4:	00 00 00 
+  802eb7:	ff d0                	call   *%rax
+  802eb9:	e9 7c ff ff ff       	jmp    802e3a <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802ebe:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802ec2:	41 0f b6 38          	movzbl (%r8),%edi
+  802ec6:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ecd:	80 80 80 
+  802ed0:	48 89 c8             	mov    %rcx,%rax
+  802ed3:	48 f7 e2             	mul    %rdx
+  802ed6:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802eda:	48 89 d0             	mov    %rdx,%rax
+  802edd:	48 c1 e0 08          	shl    $0x8,%rax
+  802ee1:	48 29 d0             	sub    %rdx,%rax
+  802ee4:	48 c1 e0 04          	shl    $0x4,%rax
+  802ee8:	48 29 c1             	sub    %rax,%rcx
+  802eeb:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  802ef0:	83 c6 01             	add    $0x1,%esi
+  802ef3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802ef6:	49 83 c0 01          	add    $0x1,%r8
+  802efa:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802efe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f02:	49 39 c0             	cmp    %rax,%r8
+  802f05:	0f 85 2f ff ff ff    	jne    802e3a <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802f0b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802f0f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802f13:	48 b8 19 2d 80 00 00 	movabs $0x802d19,%rax
+  802f1a:	00 00 00 
+  802f1d:	ff d0                	call   *%rax
+    return n;
+  802f1f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802f23:	eb 05                	jmp    802f2a <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802f2a:	48 83 c4 38          	add    $0x38,%rsp
+  802f2e:	5b                   	pop    %rbx
+  802f2f:	41 5c                	pop    %r12
+  802f31:	41 5d                	pop    %r13
+  802f33:	41 5e                	pop    %r14
+  802f35:	41 5f                	pop    %r15
+  802f37:	5d                   	pop    %rbp
+  802f38:	c3                   	ret
+
+0000000000802f39 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802f39:	55                   	push   %rbp
+  802f3a:	48 89 e5             	mov    %rsp,%rbp
+  802f3d:	41 57                	push   %r15
+  802f3f:	41 56                	push   %r14
+  802f41:	41 55                	push   %r13
+  802f43:	41 54                	push   %r12
+  802f45:	53                   	push   %rbx
+  802f46:	48 83 ec 28          	sub    $0x28,%rsp
+  802f4a:	49 89 fd             	mov    %rdi,%r13
+  802f4d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802f51:	49 89 d4             	mov    %rdx,%r12
+  802f54:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802f58:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  802f5f:	00 00 00 
+  802f62:	ff d0                	call   *%rax
+  802f64:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802f67:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802f6d:	49 bf bc 2d 80 00 00 	movabs $0x802dbc,%r15
+  802f74:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802f77:	4d 85 e4             	test   %r12,%r12
+  802f7a:	0f 84 d5 00 00 00    	je     803055 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802f80:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802f84:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802f88:	8b 03                	mov    (%rbx),%eax
+  802f8a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802f8d:	75 7a                	jne    803009 <devpipe_read+0xd0>
+            if (i > 0) {
+  802f8f:	4d 85 f6             	test   %r14,%r14
+  802f92:	75 50                	jne    802fe4 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802f94:	48 89 de             	mov    %rbx,%rsi
+  802f97:	4c 89 ef             	mov    %r13,%rdi
+  802f9a:	41 ff d7             	call   *%r15
+  802f9d:	85 c0                	test   %eax,%eax
+  802f9f:	0f 85 c9 00 00 00    	jne    80306e <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802fa5:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802fa8:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802faf:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802fb5:	8b 43 04             	mov    0x4(%rbx),%eax
+  802fb8:	41 39 c4             	cmp    %eax,%r12d
+  802fbb:	75 cb                	jne    802f88 <devpipe_read+0x4f>
+  802fbd:	48 89 de             	mov    %rbx,%rsi
+  802fc0:	4c 89 ef             	mov    %r13,%rdi
+  802fc3:	41 ff d7             	call   *%r15
+  802fc6:	85 c0                	test   %eax,%eax
+  802fc8:	75 be                	jne    802f88 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802fca:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802fcf:	44 89 e6             	mov    %r12d,%esi
+  802fd2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802fd6:	48 b8 f4 0a 80 00 00 	movabs $0x800af4,%rax
+  802fdd:	00 00 00 
+  802fe0:	ff d0                	call   *%rax
+  802fe2:	eb a4                	jmp    802f88 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802fe4:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802fe8:	48 89 de             	mov    %rbx,%rsi
+  802feb:	48 b8 19 2d 80 00 00 	movabs $0x802d19,%rax
+  802ff2:	00 00 00 
+  802ff5:	ff d0                	call   *%rax
+                return i;
+  802ff7:	4c 89 f0             	mov    %r14,%rax
+}
+  802ffa:	48 83 c4 28          	add    $0x28,%rsp
+  802ffe:	5b                   	pop    %rbx
+  802fff:	41 5c                	pop    %r12
+  803001:	41 5d                	pop    %r13
+  803003:	41 5e                	pop    %r14
+  803005:	41 5f                	pop    %r15
+  803007:	5d                   	pop    %rbp
+  803008:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803009:	48 63 c8             	movslq %eax,%rcx
+  80300c:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803013:	80 80 80 
+  803016:	48 89 c8             	mov    %rcx,%rax
+  803019:	48 f7 e2             	mul    %rdx
+  80301c:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803020:	48 89 d0             	mov    %rdx,%rax
+  803023:	48 c1 e0 08          	shl    $0x8,%rax
+  803027:	48 29 d0             	sub    %rdx,%rax
+  80302a:	48 c1 e0 04          	shl    $0x4,%rax
+  80302e:	48 89 c2             	mov    %rax,%rdx
+  803031:	48 89 c8             	mov    %rcx,%rax
+  803034:	48 29 d0             	sub    %rdx,%rax
+  803037:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80303c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803040:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803044:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803047:	49 83 c6 01          	add    $0x1,%r14
+  80304b:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80304f:	0f 85 2b ff ff ff    	jne    802f80 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803055:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803059:	48 89 de             	mov    %rbx,%rsi
+  80305c:	48 b8 19 2d 80 00 00 	movabs $0x802d19,%rax
+  803063:	00 00 00 
+  803066:	ff d0                	call   *%rax
+    return n;
+  803068:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80306c:	eb 8c                	jmp    802ffa <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80306e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803073:	eb 85                	jmp    802ffa <devpipe_read+0xc1>
+
+0000000000803075 <pipe>:
+pipe(int pfd[2]) {
+  803075:	55                   	push   %rbp
+  803076:	48 89 e5             	mov    %rsp,%rbp
+  803079:	41 55                	push   %r13
+  80307b:	41 54                	push   %r12
+  80307d:	53                   	push   %rbx
+  80307e:	48 83 ec 18          	sub    $0x18,%rsp
+  803082:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803085:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803089:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  803090:	00 00 00 
+  803093:	ff d0                	call   *%rax
+  803095:	89 c3                	mov    %eax,%ebx
+  803097:	85 c0                	test   %eax,%eax
+  803099:	0f 88 a0 01 00 00    	js     80323f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80309f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030a9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8030ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030b2:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  8030b9:	00 00 00 
+  8030bc:	ff d0                	call   *%rax
+  8030be:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8030c0:	85 c0                	test   %eax,%eax
+  8030c2:	0f 88 77 01 00 00    	js     80323f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8030c8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8030cc:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  8030d3:	00 00 00 
+  8030d6:	ff d0                	call   *%rax
+  8030d8:	89 c3                	mov    %eax,%ebx
+  8030da:	85 c0                	test   %eax,%eax
+  8030dc:	0f 88 43 01 00 00    	js     803225 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8030e2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8030e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8030ec:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8030f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f5:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  8030fc:	00 00 00 
+  8030ff:	ff d0                	call   *%rax
+  803101:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803103:	85 c0                	test   %eax,%eax
+  803105:	0f 88 1a 01 00 00    	js     803225 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80310b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80310f:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+  80311b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80311e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803123:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803128:	48 89 c6             	mov    %rax,%rsi
+  80312b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803130:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  803137:	00 00 00 
+  80313a:	ff d0                	call   *%rax
+  80313c:	89 c3                	mov    %eax,%ebx
+  80313e:	85 c0                	test   %eax,%eax
+  803140:	0f 88 c5 00 00 00    	js     80320b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803146:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80314a:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  803151:	00 00 00 
+  803154:	ff d0                	call   *%rax
+  803156:	48 89 c1             	mov    %rax,%rcx
+  803159:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  80315f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803165:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316a:	4c 89 ee             	mov    %r13,%rsi
+  80316d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803172:	48 b8 dc 07 80 00 00 	movabs $0x8007dc,%rax
+  803179:	00 00 00 
+  80317c:	ff d0                	call   *%rax
+  80317e:	89 c3                	mov    %eax,%ebx
+  803180:	85 c0                	test   %eax,%eax
+  803182:	78 6e                	js     8031f2 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803184:	be 00 10 00 00       	mov    $0x1000,%esi
+  803189:	4c 89 ef             	mov    %r13,%rdi
+  80318c:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+  803198:	83 f8 02             	cmp    $0x2,%eax
+  80319b:	0f 85 ab 00 00 00    	jne    80324c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8031a1:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  8031a8:	00 00 
+  8031aa:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031ae:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8031b0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8031b4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8031bb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  8031bf:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  8031c1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8031c5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  8031cc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031d0:	48 bb b9 0b 80 00 00 	movabs $0x800bb9,%rbx
+  8031d7:	00 00 00 
+  8031da:	ff d3                	call   *%rbx
+  8031dc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8031e0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8031e4:	ff d3                	call   *%rbx
+  8031e6:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8031eb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8031f0:	eb 4d                	jmp    80323f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8031f2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031f7:	4c 89 ee             	mov    %r13,%rsi
+  8031fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031ff:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  803206:	00 00 00 
+  803209:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80320b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803210:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803214:	bf 00 00 00 00       	mov    $0x0,%edi
+  803219:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  803220:	00 00 00 
+  803223:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803225:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80322a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80322e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803233:	48 b8 2c 08 80 00 00 	movabs $0x80082c,%rax
+  80323a:	00 00 00 
+  80323d:	ff d0                	call   *%rax
+}
+  80323f:	89 d8                	mov    %ebx,%eax
+  803241:	48 83 c4 18          	add    $0x18,%rsp
+  803245:	5b                   	pop    %rbx
+  803246:	41 5c                	pop    %r12
+  803248:	41 5d                	pop    %r13
+  80324a:	5d                   	pop    %rbp
+  80324b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80324c:	48 b9 90 48 80 00 00 	movabs $0x804890,%rcx
+  803253:	00 00 00 
+  803256:	48 ba 67 48 80 00 00 	movabs $0x804867,%rdx
+  80325d:	00 00 00 
+  803260:	be 50 00 00 00       	mov    $0x50,%esi
+  803265:	48 bf 7c 48 80 00 00 	movabs $0x80487c,%rdi
+  80326c:	00 00 00 
+  80326f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803274:	49 b8 a4 38 80 00 00 	movabs $0x8038a4,%r8
+  80327b:	00 00 00 
+  80327e:	41 ff d0             	call   *%r8
+
+0000000000803281 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803281:	55                   	push   %rbp
+  803282:	48 89 e5             	mov    %rsp,%rbp
+  803285:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803289:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80328d:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  803294:	00 00 00 
+  803297:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	78 23                	js     8032c0 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80329d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032a1:	48 b8 cb 0b 80 00 00 	movabs $0x800bcb,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+  8032ad:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8032b0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8032b4:	48 b8 bc 2d 80 00 00 	movabs $0x802dbc,%rax
+  8032bb:	00 00 00 
+  8032be:	ff d0                	call   *%rax
+}
+  8032c0:	c9                   	leave
+  8032c1:	c3                   	ret
+
+00000000008032c2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8032c2:	48 89 f8             	mov    %rdi,%rax
+  8032c5:	48 c1 e8 27          	shr    $0x27,%rax
+  8032c9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8032d0:	01 00 00 
+  8032d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032d7:	f6 c2 01             	test   $0x1,%dl
+  8032da:	74 6d                	je     803349 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8032dc:	48 89 f8             	mov    %rdi,%rax
+  8032df:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8032e3:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032ea:	01 00 00 
+  8032ed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8032f1:	f6 c2 01             	test   $0x1,%dl
+  8032f4:	74 62                	je     803358 <get_uvpt_entry+0x96>
+  8032f6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8032fd:	01 00 00 
+  803300:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803304:	f6 c2 80             	test   $0x80,%dl
+  803307:	75 4f                	jne    803358 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803309:	48 89 f8             	mov    %rdi,%rax
+  80330c:	48 c1 e8 15          	shr    $0x15,%rax
+  803310:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803317:	01 00 00 
+  80331a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80331e:	f6 c2 01             	test   $0x1,%dl
+  803321:	74 44                	je     803367 <get_uvpt_entry+0xa5>
+  803323:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80332a:	01 00 00 
+  80332d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803331:	f6 c2 80             	test   $0x80,%dl
+  803334:	75 31                	jne    803367 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803336:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80333a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803341:	01 00 00 
+  803344:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803348:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803349:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803350:	01 00 00 
+  803353:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803357:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803358:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80335f:	01 00 00 
+  803362:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803366:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803367:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80336e:	01 00 00 
+  803371:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803375:	c3                   	ret
+
+0000000000803376 <get_prot>:
+
+int
+get_prot(void *va) {
+  803376:	55                   	push   %rbp
+  803377:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80337a:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  803381:	00 00 00 
+  803384:	ff d0                	call   *%rax
+  803386:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803389:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80338e:	89 c1                	mov    %eax,%ecx
+  803390:	83 c9 04             	or     $0x4,%ecx
+  803393:	f6 c2 01             	test   $0x1,%dl
+  803396:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803399:	89 c1                	mov    %eax,%ecx
+  80339b:	83 c9 02             	or     $0x2,%ecx
+  80339e:	f6 c2 02             	test   $0x2,%dl
+  8033a1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8033a4:	89 c1                	mov    %eax,%ecx
+  8033a6:	83 c9 01             	or     $0x1,%ecx
+  8033a9:	48 85 d2             	test   %rdx,%rdx
+  8033ac:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8033af:	89 c1                	mov    %eax,%ecx
+  8033b1:	83 c9 40             	or     $0x40,%ecx
+  8033b4:	f6 c6 04             	test   $0x4,%dh
+  8033b7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8033ba:	5d                   	pop    %rbp
+  8033bb:	c3                   	ret
+
+00000000008033bc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8033bc:	55                   	push   %rbp
+  8033bd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8033c0:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  8033c7:	00 00 00 
+  8033ca:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8033cc:	48 c1 e8 06          	shr    $0x6,%rax
+  8033d0:	83 e0 01             	and    $0x1,%eax
+}
+  8033d3:	5d                   	pop    %rbp
+  8033d4:	c3                   	ret
+
+00000000008033d5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8033d5:	55                   	push   %rbp
+  8033d6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8033d9:	48 b8 c2 32 80 00 00 	movabs $0x8032c2,%rax
+  8033e0:	00 00 00 
+  8033e3:	ff d0                	call   *%rax
+  8033e5:	83 e0 01             	and    $0x1,%eax
+}
+  8033e8:	5d                   	pop    %rbp
+  8033e9:	c3                   	ret
+
+00000000008033ea <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8033ea:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8033f1:	01 00 00 
+  8033f4:	a8 01                	test   $0x1,%al
+  8033f6:	75 06                	jne    8033fe <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8033f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fd:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8033fe:	55                   	push   %rbp
+  8033ff:	48 89 e5             	mov    %rsp,%rbp
+  803402:	41 57                	push   %r15
+  803404:	41 56                	push   %r14
+  803406:	41 55                	push   %r13
+  803408:	41 54                	push   %r12
+  80340a:	53                   	push   %rbx
+  80340b:	48 83 ec 28          	sub    $0x28,%rsp
+  80340f:	49 89 fe             	mov    %rdi,%r14
+  803412:	49 89 f7             	mov    %rsi,%r15
+  803415:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80341c:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80341d:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803424:	01 00 00 
+  803427:	e9 ae 00 00 00       	jmp    8034da <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80342c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803433:	49 83 ec 01          	sub    $0x1,%r12
+  803437:	74 2d                	je     803466 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803439:	48 89 d8             	mov    %rbx,%rax
+  80343c:	48 c1 e8 0c          	shr    $0xc,%rax
+  803440:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803445:	f6 c2 01             	test   $0x1,%dl
+  803448:	74 e2                	je     80342c <foreach_shared_region+0x42>
+  80344a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80344f:	f6 c4 04             	test   $0x4,%ah
+  803452:	74 d8                	je     80342c <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803454:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80345b:	4c 89 fa             	mov    %r15,%rdx
+  80345e:	48 89 df             	mov    %rbx,%rdi
+  803461:	41 ff d6             	call   *%r14
+  803464:	eb c6                	jmp    80342c <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803466:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80346d:	00 
+  80346e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803473:	74 4a                	je     8034bf <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803475:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803479:	48 c1 e8 15          	shr    $0x15,%rax
+  80347d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803484:	01 00 00 
+  803487:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80348b:	a8 01                	test   $0x1,%al
+  80348d:	74 d7                	je     803466 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80348f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803493:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80349a:	48 39 c3             	cmp    %rax,%rbx
+  80349d:	73 c7                	jae    803466 <foreach_shared_region+0x7c>
+  80349f:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8034a6:	48 39 d0             	cmp    %rdx,%rax
+  8034a9:	4d 19 e4             	sbb    %r12,%r12
+  8034ac:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8034b3:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8034ba:	e9 7a ff ff ff       	jmp    803439 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8034bf:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8034c6:	40 
+  8034c7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8034cb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8034d2:	00 00 00 
+  8034d5:	48 39 c1             	cmp    %rax,%rcx
+  8034d8:	74 50                	je     80352a <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8034da:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034de:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8034e2:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8034e9:	01 00 00 
+  8034ec:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8034f0:	a8 01                	test   $0x1,%al
+  8034f2:	74 cb                	je     8034bf <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8034f4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8034f8:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8034ff:	48 39 c1             	cmp    %rax,%rcx
+  803502:	73 bb                	jae    8034bf <foreach_shared_region+0xd5>
+  803504:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80350b:	48 39 d0             	cmp    %rdx,%rax
+  80350e:	48 19 c0             	sbb    %rax,%rax
+  803511:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803517:	48 05 00 02 00 00    	add    $0x200,%rax
+  80351d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803521:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803525:	e9 4b ff ff ff       	jmp    803475 <foreach_shared_region+0x8b>
+  80352a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80352f:	48 83 c4 28          	add    $0x28,%rsp
+  803533:	5b                   	pop    %rbx
+  803534:	41 5c                	pop    %r12
+  803536:	41 5d                	pop    %r13
+  803538:	41 5e                	pop    %r14
+  80353a:	41 5f                	pop    %r15
+  80353c:	5d                   	pop    %rbp
+  80353d:	c3                   	ret
+
+000000000080353e <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80353e:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803544:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80354b:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803552:	c3                   	ret
+
+0000000000803553 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803553:	8b 47 40             	mov    0x40(%rdi),%eax
+  803556:	8b 17                	mov    (%rdi),%edx
+  803558:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80355a:	83 f8 0f             	cmp    $0xf,%eax
+  80355d:	77 13                	ja     803572 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80355f:	8b 47 40             	mov    0x40(%rdi),%eax
+  803562:	83 e0 0f             	and    $0xf,%eax
+  803565:	48 c1 e0 09          	shl    $0x9,%rax
+  803569:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803570:	00 
+  803571:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803572:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803577:	c3                   	ret
+
+0000000000803578 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803578:	8b 47 40             	mov    0x40(%rdi),%eax
+  80357b:	83 c0 01             	add    $0x1,%eax
+  80357e:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803581:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803587:	8b 57 04             	mov    0x4(%rdi),%edx
+  80358a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80358f:	85 d2                	test   %edx,%edx
+  803591:	75 04                	jne    803597 <chan_publish+0x1f>
+  803593:	83 e0 01             	and    $0x1,%eax
+}
+  803596:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803597:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80359a:	85 c0                	test   %eax,%eax
+  80359c:	0f 95 c0             	setne  %al
+  80359f:	0f b6 c0             	movzbl %al,%eax
+  8035a2:	eb ef                	jmp    803593 <chan_publish+0x1b>
+
+00000000008035a4 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8035a4:	8b 47 40             	mov    0x40(%rdi),%eax
+  8035a7:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8035a9:	29 d0                	sub    %edx,%eax
+  8035ab:	83 e8 01             	sub    $0x1,%eax
+  8035ae:	83 f8 0f             	cmp    $0xf,%eax
+  8035b1:	77 12                	ja     8035c5 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8035b3:	8b 07                	mov    (%rdi),%eax
+  8035b5:	83 e0 0f             	and    $0xf,%eax
+  8035b8:	48 c1 e0 09          	shl    $0x9,%rax
+  8035bc:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8035c3:	00 
+  8035c4:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8035c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ca:	c3                   	ret
+
+00000000008035cb <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8035cb:	8b 07                	mov    (%rdi),%eax
+  8035cd:	83 c0 01             	add    $0x1,%eax
+  8035d0:	89 07                	mov    %eax,(%rdi)
+}
+  8035d2:	c3                   	ret
+
+00000000008035d3 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8035d3:	55                   	push   %rbp
+  8035d4:	48 89 e5             	mov    %rsp,%rbp
+  8035d7:	53                   	push   %rbx
+  8035d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8035dc:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8035df:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035e6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8035ec:	48 b8 a4 35 80 00 00 	movabs $0x8035a4,%rax
+  8035f3:	00 00 00 
+  8035f6:	ff d0                	call   *%rax
+  8035f8:	48 85 c0             	test   %rax,%rax
+  8035fb:	74 12                	je     80360f <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8035fd:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803604:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803609:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80360d:	c9                   	leave
+  80360e:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80360f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803614:	eb f3                	jmp    803609 <chan_arm+0x36>
+
+0000000000803616 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803616:	55                   	push   %rbp
+  803617:	48 89 e5             	mov    %rsp,%rbp
+  80361a:	41 56                	push   %r14
+  80361c:	41 55                	push   %r13
+  80361e:	41 54                	push   %r12
+  803620:	53                   	push   %rbx
+  803621:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803624:	49 bc d3 35 80 00 00 	movabs $0x8035d3,%r12
+  80362b:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80362e:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803632:	49 bd f4 0a 80 00 00 	movabs $0x800af4,%r13
+  803639:	00 00 00 
+    while (chan_arm(r))
+  80363c:	eb 0d                	jmp    80364b <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80363e:	8b 33                	mov    (%rbx),%esi
+  803640:	ba 00 00 00 00       	mov    $0x0,%edx
+  803645:	4c 89 f7             	mov    %r14,%rdi
+  803648:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80364b:	48 89 df             	mov    %rbx,%rdi
+  80364e:	41 ff d4             	call   *%r12
+  803651:	84 c0                	test   %al,%al
+  803653:	75 e9                	jne    80363e <chan_wait+0x28>
+}
+  803655:	5b                   	pop    %rbx
+  803656:	41 5c                	pop    %r12
+  803658:	41 5d                	pop    %r13
+  80365a:	41 5e                	pop    %r14
+  80365c:	5d                   	pop    %rbp
+  80365d:	c3                   	ret
+
+000000000080365e <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80365e:	55                   	push   %rbp
+  80365f:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803662:	48 83 c7 40          	add    $0x40,%rdi
+  803666:	be 01 00 00 00       	mov    $0x1,%esi
+  80366b:	48 b8 12 0b 80 00 00 	movabs $0x800b12,%rax
+  803672:	00 00 00 
+  803675:	ff d0                	call   *%rax
+}
+  803677:	5d                   	pop    %rbp
+  803678:	c3                   	ret
+
+0000000000803679 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80367e:	c3                   	ret
+
+000000000080367f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80367f:	55                   	push   %rbp
+  803680:	48 89 e5             	mov    %rsp,%rbp
+  803683:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803686:	48 be b4 48 80 00 00 	movabs $0x8048b4,%rsi
+  80368d:	00 00 00 
+  803690:	48 b8 27 02 80 00 00 	movabs $0x800227,%rax
+  803697:	00 00 00 
+  80369a:	ff d0                	call   *%rax
+    return 0;
+}
+  80369c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036a1:	5d                   	pop    %rbp
+  8036a2:	c3                   	ret
+
+00000000008036a3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036a3:	55                   	push   %rbp
+  8036a4:	48 89 e5             	mov    %rsp,%rbp
+  8036a7:	41 57                	push   %r15
+  8036a9:	41 56                	push   %r14
+  8036ab:	41 55                	push   %r13
+  8036ad:	41 54                	push   %r12
+  8036af:	53                   	push   %rbx
+  8036b0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8036b7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8036be:	48 85 d2             	test   %rdx,%rdx
+  8036c1:	74 7a                	je     80373d <devcons_write+0x9a>
+  8036c3:	49 89 d6             	mov    %rdx,%r14
+  8036c6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8036cc:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8036d1:	49 bf 21 04 80 00 00 	movabs $0x800421,%r15
+  8036d8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8036db:	4c 89 f3             	mov    %r14,%rbx
+  8036de:	48 29 f3             	sub    %rsi,%rbx
+  8036e1:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8036e6:	48 39 c3             	cmp    %rax,%rbx
+  8036e9:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8036ed:	4c 63 eb             	movslq %ebx,%r13
+  8036f0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8036f7:	48 01 c6             	add    %rax,%rsi
+  8036fa:	4c 89 ea             	mov    %r13,%rdx
+  8036fd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803704:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803707:	4c 89 ee             	mov    %r13,%rsi
+  80370a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803711:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  803718:	00 00 00 
+  80371b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80371d:	41 01 dc             	add    %ebx,%r12d
+  803720:	49 63 f4             	movslq %r12d,%rsi
+  803723:	4c 39 f6             	cmp    %r14,%rsi
+  803726:	72 b3                	jb     8036db <devcons_write+0x38>
+    return res;
+  803728:	49 63 c4             	movslq %r12d,%rax
+}
+  80372b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803732:	5b                   	pop    %rbx
+  803733:	41 5c                	pop    %r12
+  803735:	41 5d                	pop    %r13
+  803737:	41 5e                	pop    %r14
+  803739:	41 5f                	pop    %r15
+  80373b:	5d                   	pop    %rbp
+  80373c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80373d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803743:	eb e3                	jmp    803728 <devcons_write+0x85>
+
+0000000000803745 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803745:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803748:	ba 00 00 00 00       	mov    $0x0,%edx
+  80374d:	48 85 c0             	test   %rax,%rax
+  803750:	74 55                	je     8037a7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803752:	55                   	push   %rbp
+  803753:	48 89 e5             	mov    %rsp,%rbp
+  803756:	41 55                	push   %r13
+  803758:	41 54                	push   %r12
+  80375a:	53                   	push   %rbx
+  80375b:	48 83 ec 08          	sub    $0x8,%rsp
+  80375f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803762:	48 bb 6d 06 80 00 00 	movabs $0x80066d,%rbx
+  803769:	00 00 00 
+  80376c:	49 bc 22 07 80 00 00 	movabs $0x800722,%r12
+  803773:	00 00 00 
+  803776:	eb 03                	jmp    80377b <devcons_read+0x36>
+  803778:	41 ff d4             	call   *%r12
+  80377b:	ff d3                	call   *%rbx
+  80377d:	85 c0                	test   %eax,%eax
+  80377f:	74 f7                	je     803778 <devcons_read+0x33>
+    if (c < 0) return c;
+  803781:	48 63 d0             	movslq %eax,%rdx
+  803784:	78 13                	js     803799 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803786:	ba 00 00 00 00       	mov    $0x0,%edx
+  80378b:	83 f8 04             	cmp    $0x4,%eax
+  80378e:	74 09                	je     803799 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803790:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803794:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803799:	48 89 d0             	mov    %rdx,%rax
+  80379c:	48 83 c4 08          	add    $0x8,%rsp
+  8037a0:	5b                   	pop    %rbx
+  8037a1:	41 5c                	pop    %r12
+  8037a3:	41 5d                	pop    %r13
+  8037a5:	5d                   	pop    %rbp
+  8037a6:	c3                   	ret
+  8037a7:	48 89 d0             	mov    %rdx,%rax
+  8037aa:	c3                   	ret
+
+00000000008037ab <cputchar>:
+cputchar(int ch) {
+  8037ab:	55                   	push   %rbp
+  8037ac:	48 89 e5             	mov    %rsp,%rbp
+  8037af:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8037b3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8037b7:	be 01 00 00 00       	mov    $0x1,%esi
+  8037bc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8037c0:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  8037c7:	00 00 00 
+  8037ca:	ff d0                	call   *%rax
+}
+  8037cc:	c9                   	leave
+  8037cd:	c3                   	ret
+
+00000000008037ce <getchar>:
+getchar(void) {
+  8037ce:	55                   	push   %rbp
+  8037cf:	48 89 e5             	mov    %rsp,%rbp
+  8037d2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8037d6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8037db:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8037df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e4:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  8037eb:	00 00 00 
+  8037ee:	ff d0                	call   *%rax
+  8037f0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8037f2:	85 c0                	test   %eax,%eax
+  8037f4:	78 06                	js     8037fc <getchar+0x2e>
+  8037f6:	74 08                	je     803800 <getchar+0x32>
+  8037f8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8037fc:	89 d0                	mov    %edx,%eax
+  8037fe:	c9                   	leave
+  8037ff:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803800:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803805:	eb f5                	jmp    8037fc <getchar+0x2e>
+
+0000000000803807 <iscons>:
+iscons(int fdnum) {
+  803807:	55                   	push   %rbp
+  803808:	48 89 e5             	mov    %rsp,%rbp
+  80380b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80380f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803813:	48 b8 47 0c 80 00 00 	movabs $0x800c47,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80381f:	85 c0                	test   %eax,%eax
+  803821:	78 18                	js     80383b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803823:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803827:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80382e:	00 00 00 
+  803831:	8b 00                	mov    (%rax),%eax
+  803833:	39 02                	cmp    %eax,(%rdx)
+  803835:	0f 94 c0             	sete   %al
+  803838:	0f b6 c0             	movzbl %al,%eax
+}
+  80383b:	c9                   	leave
+  80383c:	c3                   	ret
+
+000000000080383d <opencons>:
+opencons(void) {
+  80383d:	55                   	push   %rbp
+  80383e:	48 89 e5             	mov    %rsp,%rbp
+  803841:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803845:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803849:	48 b8 e7 0b 80 00 00 	movabs $0x800be7,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+  803855:	85 c0                	test   %eax,%eax
+  803857:	78 49                	js     8038a2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803859:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80385e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803863:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80386c:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  803873:	00 00 00 
+  803876:	ff d0                	call   *%rax
+  803878:	85 c0                	test   %eax,%eax
+  80387a:	78 26                	js     8038a2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80387c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803880:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803887:	00 00 
+  803889:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80388b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80388f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803896:	48 b8 b9 0b 80 00 00 	movabs $0x800bb9,%rax
+  80389d:	00 00 00 
+  8038a0:	ff d0                	call   *%rax
+}
+  8038a2:	c9                   	leave
+  8038a3:	c3                   	ret
+
+00000000008038a4 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8038a4:	55                   	push   %rbp
+  8038a5:	48 89 e5             	mov    %rsp,%rbp
+  8038a8:	41 56                	push   %r14
+  8038aa:	41 55                	push   %r13
+  8038ac:	41 54                	push   %r12
+  8038ae:	53                   	push   %rbx
+  8038af:	48 83 ec 50          	sub    $0x50,%rsp
+  8038b3:	49 89 fc             	mov    %rdi,%r12
+  8038b6:	41 89 f5             	mov    %esi,%r13d
+  8038b9:	48 89 d3             	mov    %rdx,%rbx
+  8038bc:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8038c0:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8038c4:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8038c8:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8038cf:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8038d3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8038d7:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8038db:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8038df:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8038e6:	00 00 00 
+  8038e9:	4c 8b 30             	mov    (%rax),%r14
+  8038ec:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8038f3:	00 00 00 
+  8038f6:	ff d0                	call   *%rax
+  8038f8:	89 c6                	mov    %eax,%esi
+  8038fa:	45 89 e8             	mov    %r13d,%r8d
+  8038fd:	4c 89 e1             	mov    %r12,%rcx
+  803900:	4c 89 f2             	mov    %r14,%rdx
+  803903:	48 bf c0 48 80 00 00 	movabs $0x8048c0,%rdi
+  80390a:	00 00 00 
+  80390d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803912:	49 bc f4 39 80 00 00 	movabs $0x8039f4,%r12
+  803919:	00 00 00 
+  80391c:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80391f:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803923:	48 89 df             	mov    %rbx,%rdi
+  803926:	48 b8 90 39 80 00 00 	movabs $0x803990,%rax
+  80392d:	00 00 00 
+  803930:	ff d0                	call   *%rax
+    cprintf("\n");
+  803932:	48 bf 0b 48 80 00 00 	movabs $0x80480b,%rdi
+  803939:	00 00 00 
+  80393c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803941:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803944:	cc                   	int3
+  803945:	eb fd                	jmp    803944 <_panic+0xa0>
+
+0000000000803947 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803947:	55                   	push   %rbp
+  803948:	48 89 e5             	mov    %rsp,%rbp
+  80394b:	53                   	push   %rbx
+  80394c:	48 83 ec 08          	sub    $0x8,%rsp
+  803950:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803953:	8b 06                	mov    (%rsi),%eax
+  803955:	8d 50 01             	lea    0x1(%rax),%edx
+  803958:	89 16                	mov    %edx,(%rsi)
+  80395a:	48 98                	cltq
+  80395c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803961:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803967:	74 0a                	je     803973 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803969:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80396d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803971:	c9                   	leave
+  803972:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803973:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803977:	be ff 00 00 00       	mov    $0xff,%esi
+  80397c:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  803983:	00 00 00 
+  803986:	ff d0                	call   *%rax
+        state->offset = 0;
+  803988:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80398e:	eb d9                	jmp    803969 <putch+0x22>
+
+0000000000803990 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803990:	55                   	push   %rbp
+  803991:	48 89 e5             	mov    %rsp,%rbp
+  803994:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80399b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80399e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8039a5:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8039aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039af:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8039b2:	48 89 f1             	mov    %rsi,%rcx
+  8039b5:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8039bc:	48 bf 47 39 80 00 00 	movabs $0x803947,%rdi
+  8039c3:	00 00 00 
+  8039c6:	48 b8 44 3b 80 00 00 	movabs $0x803b44,%rax
+  8039cd:	00 00 00 
+  8039d0:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8039d2:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8039d9:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8039e0:	48 b8 4e 06 80 00 00 	movabs $0x80064e,%rax
+  8039e7:	00 00 00 
+  8039ea:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8039ec:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8039f2:	c9                   	leave
+  8039f3:	c3                   	ret
+
+00000000008039f4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8039f4:	55                   	push   %rbp
+  8039f5:	48 89 e5             	mov    %rsp,%rbp
+  8039f8:	48 83 ec 50          	sub    $0x50,%rsp
+  8039fc:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803a00:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803a04:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803a08:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803a0c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803a10:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803a17:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803a1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a1f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803a23:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803a27:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803a2b:	48 b8 90 39 80 00 00 	movabs $0x803990,%rax
+  803a32:	00 00 00 
+  803a35:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803a37:	c9                   	leave
+  803a38:	c3                   	ret
+
+0000000000803a39 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803a39:	55                   	push   %rbp
+  803a3a:	48 89 e5             	mov    %rsp,%rbp
+  803a3d:	41 57                	push   %r15
+  803a3f:	41 56                	push   %r14
+  803a41:	41 55                	push   %r13
+  803a43:	41 54                	push   %r12
+  803a45:	53                   	push   %rbx
+  803a46:	48 83 ec 18          	sub    $0x18,%rsp
+  803a4a:	49 89 fc             	mov    %rdi,%r12
+  803a4d:	49 89 f5             	mov    %rsi,%r13
+  803a50:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803a54:	8b 45 10             	mov    0x10(%rbp),%eax
+  803a57:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803a5a:	41 89 cf             	mov    %ecx,%r15d
+  803a5d:	4c 39 fa             	cmp    %r15,%rdx
+  803a60:	73 5b                	jae    803abd <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803a62:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803a66:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803a6a:	85 db                	test   %ebx,%ebx
+  803a6c:	7e 0e                	jle    803a7c <print_num+0x43>
+            putch(padc, put_arg);
+  803a6e:	4c 89 ee             	mov    %r13,%rsi
+  803a71:	44 89 f7             	mov    %r14d,%edi
+  803a74:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803a77:	83 eb 01             	sub    $0x1,%ebx
+  803a7a:	75 f2                	jne    803a6e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803a7c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803a80:	48 b9 f4 48 80 00 00 	movabs $0x8048f4,%rcx
+  803a87:	00 00 00 
+  803a8a:	48 b8 e3 48 80 00 00 	movabs $0x8048e3,%rax
+  803a91:	00 00 00 
+  803a94:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803a98:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803a9c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803aa1:	49 f7 f7             	div    %r15
+  803aa4:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803aa8:	4c 89 ee             	mov    %r13,%rsi
+  803aab:	41 ff d4             	call   *%r12
+}
+  803aae:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803ab2:	5b                   	pop    %rbx
+  803ab3:	41 5c                	pop    %r12
+  803ab5:	41 5d                	pop    %r13
+  803ab7:	41 5e                	pop    %r14
+  803ab9:	41 5f                	pop    %r15
+  803abb:	5d                   	pop    %rbp
+  803abc:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803abd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ac6:	49 f7 f7             	div    %r15
+  803ac9:	48 83 ec 08          	sub    $0x8,%rsp
+  803acd:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803ad1:	52                   	push   %rdx
+  803ad2:	45 0f be c9          	movsbl %r9b,%r9d
+  803ad6:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803ada:	48 89 c2             	mov    %rax,%rdx
+  803add:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  803ae4:	00 00 00 
+  803ae7:	ff d0                	call   *%rax
+  803ae9:	48 83 c4 10          	add    $0x10,%rsp
+  803aed:	eb 8d                	jmp    803a7c <print_num+0x43>
+
+0000000000803aef <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803aef:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803af3:	48 8b 06             	mov    (%rsi),%rax
+  803af6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  803afa:	73 0a                	jae    803b06 <sprintputch+0x17>
+        *state->start++ = ch;
+  803afc:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803b00:	48 89 16             	mov    %rdx,(%rsi)
+  803b03:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  803b06:	c3                   	ret
+
+0000000000803b07 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803b07:	55                   	push   %rbp
+  803b08:	48 89 e5             	mov    %rsp,%rbp
+  803b0b:	48 83 ec 50          	sub    $0x50,%rsp
+  803b0f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803b13:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803b17:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803b1b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803b22:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803b26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b2a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803b2e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803b32:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803b36:	48 b8 44 3b 80 00 00 	movabs $0x803b44,%rax
+  803b3d:	00 00 00 
+  803b40:	ff d0                	call   *%rax
+}
+  803b42:	c9                   	leave
+  803b43:	c3                   	ret
+
+0000000000803b44 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803b44:	55                   	push   %rbp
+  803b45:	48 89 e5             	mov    %rsp,%rbp
+  803b48:	41 57                	push   %r15
+  803b4a:	41 56                	push   %r14
+  803b4c:	41 55                	push   %r13
+  803b4e:	41 54                	push   %r12
+  803b50:	53                   	push   %rbx
+  803b51:	48 83 ec 38          	sub    $0x38,%rsp
+  803b55:	49 89 fe             	mov    %rdi,%r14
+  803b58:	49 89 f5             	mov    %rsi,%r13
+  803b5b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803b5e:	48 8b 01             	mov    (%rcx),%rax
+  803b61:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803b65:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803b71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803b75:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803b79:	0f b6 3b             	movzbl (%rbx),%edi
+  803b7c:	40 80 ff 25          	cmp    $0x25,%dil
+  803b80:	74 18                	je     803b9a <vprintfmt+0x56>
+            if (!ch) return;
+  803b82:	40 84 ff             	test   %dil,%dil
+  803b85:	0f 84 b1 06 00 00    	je     80423c <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803b8b:	40 0f b6 ff          	movzbl %dil,%edi
+  803b8f:	4c 89 ee             	mov    %r13,%rsi
+  803b92:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803b95:	4c 89 e3             	mov    %r12,%rbx
+  803b98:	eb db                	jmp    803b75 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803b9a:	be 00 00 00 00       	mov    $0x0,%esi
+  803b9f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803ba3:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803ba8:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803bae:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803bb5:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803bb9:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803bbe:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803bc3:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803bc6:	83 e8 23             	sub    $0x23,%eax
+  803bc9:	3c 57                	cmp    $0x57,%al
+  803bcb:	0f 87 51 06 00 00    	ja     804222 <vprintfmt+0x6de>
+  803bd1:	0f b6 c0             	movzbl %al,%eax
+  803bd4:	48 b9 a0 4a 80 00 00 	movabs $0x804aa0,%rcx
+  803bdb:	00 00 00 
+  803bde:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803be1:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803be4:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803be8:	eb cf                	jmp    803bb9 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  803bea:	49 89 dc             	mov    %rbx,%r12
+  803bed:	be 01 00 00 00       	mov    $0x1,%esi
+  803bf2:	eb c5                	jmp    803bb9 <vprintfmt+0x75>
+            padc = ch;
+  803bf4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  803bf8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803bfb:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803bfe:	eb b9                	jmp    803bb9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c03:	83 f8 2f             	cmp    $0x2f,%eax
+  803c06:	77 24                	ja     803c2c <vprintfmt+0xe8>
+  803c08:	89 c1                	mov    %eax,%ecx
+  803c0a:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803c0e:	83 c0 08             	add    $0x8,%eax
+  803c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c14:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803c17:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803c1a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803c1e:	79 99                	jns    803bb9 <vprintfmt+0x75>
+                width = precision;
+  803c20:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  803c24:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803c2a:	eb 8d                	jmp    803bb9 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803c2c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803c30:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803c34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c38:	eb da                	jmp    803c14 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803c3a:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803c3f:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803c43:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803c49:	3c 39                	cmp    $0x39,%al
+  803c4b:	77 1c                	ja     803c69 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803c4d:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803c51:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803c55:	0f b6 c0             	movzbl %al,%eax
+  803c58:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803c5d:	0f b6 03             	movzbl (%rbx),%eax
+  803c60:	3c 39                	cmp    $0x39,%al
+  803c62:	76 e9                	jbe    803c4d <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803c64:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803c67:	eb b1                	jmp    803c1a <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803c69:	49 89 dc             	mov    %rbx,%r12
+  803c6c:	eb ac                	jmp    803c1a <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803c6e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803c71:	85 c9                	test   %ecx,%ecx
+  803c73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c78:	0f 49 c1             	cmovns %ecx,%eax
+  803c7b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803c7e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803c81:	e9 33 ff ff ff       	jmp    803bb9 <vprintfmt+0x75>
+            lflag++;
+  803c86:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803c89:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803c8c:	e9 28 ff ff ff       	jmp    803bb9 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803c91:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c94:	83 f8 2f             	cmp    $0x2f,%eax
+  803c97:	77 19                	ja     803cb2 <vprintfmt+0x16e>
+  803c99:	89 c2                	mov    %eax,%edx
+  803c9b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c9f:	83 c0 08             	add    $0x8,%eax
+  803ca2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ca5:	8b 3a                	mov    (%rdx),%edi
+  803ca7:	4c 89 ee             	mov    %r13,%rsi
+  803caa:	41 ff d6             	call   *%r14
+            break;
+  803cad:	e9 c3 fe ff ff       	jmp    803b75 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803cb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbe:	eb e5                	jmp    803ca5 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803cc0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803cc3:	83 f8 2f             	cmp    $0x2f,%eax
+  803cc6:	77 5a                	ja     803d22 <vprintfmt+0x1de>
+  803cc8:	89 c2                	mov    %eax,%edx
+  803cca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cce:	83 c0 08             	add    $0x8,%eax
+  803cd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803cd4:	8b 02                	mov    (%rdx),%eax
+  803cd6:	89 c1                	mov    %eax,%ecx
+  803cd8:	f7 d9                	neg    %ecx
+  803cda:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803cdd:	83 f9 16             	cmp    $0x16,%ecx
+  803ce0:	7f 4e                	jg     803d30 <vprintfmt+0x1ec>
+  803ce2:	48 63 c1             	movslq %ecx,%rax
+  803ce5:	48 ba 60 4d 80 00 00 	movabs $0x804d60,%rdx
+  803cec:	00 00 00 
+  803cef:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803cf3:	48 85 c0             	test   %rax,%rax
+  803cf6:	74 38                	je     803d30 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  803cf8:	48 89 c1             	mov    %rax,%rcx
+  803cfb:	48 ba 79 48 80 00 00 	movabs $0x804879,%rdx
+  803d02:	00 00 00 
+  803d05:	4c 89 ee             	mov    %r13,%rsi
+  803d08:	4c 89 f7             	mov    %r14,%rdi
+  803d0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d10:	49 b8 07 3b 80 00 00 	movabs $0x803b07,%r8
+  803d17:	00 00 00 
+  803d1a:	41 ff d0             	call   *%r8
+  803d1d:	e9 53 fe ff ff       	jmp    803b75 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803d22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d2e:	eb a4                	jmp    803cd4 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803d30:	48 ba 0c 49 80 00 00 	movabs $0x80490c,%rdx
+  803d37:	00 00 00 
+  803d3a:	4c 89 ee             	mov    %r13,%rsi
+  803d3d:	4c 89 f7             	mov    %r14,%rdi
+  803d40:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d45:	49 b8 07 3b 80 00 00 	movabs $0x803b07,%r8
+  803d4c:	00 00 00 
+  803d4f:	41 ff d0             	call   *%r8
+  803d52:	e9 1e fe ff ff       	jmp    803b75 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803d57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803d5a:	83 f8 2f             	cmp    $0x2f,%eax
+  803d5d:	77 6c                	ja     803dcb <vprintfmt+0x287>
+  803d5f:	89 c2                	mov    %eax,%edx
+  803d61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803d65:	83 c0 08             	add    $0x8,%eax
+  803d68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803d6b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803d6e:	48 85 d2             	test   %rdx,%rdx
+  803d71:	48 b8 05 49 80 00 00 	movabs $0x804905,%rax
+  803d78:	00 00 00 
+  803d7b:	48 0f 45 c2          	cmovne %rdx,%rax
+  803d7f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803d83:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803d87:	7e 06                	jle    803d8f <vprintfmt+0x24b>
+  803d89:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803d8d:	75 4a                	jne    803dd9 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803d8f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803d93:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803d97:	0f b6 00             	movzbl (%rax),%eax
+  803d9a:	84 c0                	test   %al,%al
+  803d9c:	0f 85 9a 00 00 00    	jne    803e3c <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803da2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803da5:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803da9:	85 c0                	test   %eax,%eax
+  803dab:	0f 8e c4 fd ff ff    	jle    803b75 <vprintfmt+0x31>
+  803db1:	4c 89 ee             	mov    %r13,%rsi
+  803db4:	bf 20 00 00 00       	mov    $0x20,%edi
+  803db9:	41 ff d6             	call   *%r14
+  803dbc:	41 83 ec 01          	sub    $0x1,%r12d
+  803dc0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803dc4:	75 eb                	jne    803db1 <vprintfmt+0x26d>
+  803dc6:	e9 aa fd ff ff       	jmp    803b75 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803dcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803dcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803dd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dd7:	eb 92                	jmp    803d6b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803dd9:	49 63 f7             	movslq %r15d,%rsi
+  803ddc:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803de0:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  803de7:	00 00 00 
+  803dea:	ff d0                	call   *%rax
+  803dec:	48 89 c2             	mov    %rax,%rdx
+  803def:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803df2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803df4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  803df7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  803dfa:	85 c0                	test   %eax,%eax
+  803dfc:	7e 91                	jle    803d8f <vprintfmt+0x24b>
+  803dfe:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803e03:	4c 89 ee             	mov    %r13,%rsi
+  803e06:	44 89 e7             	mov    %r12d,%edi
+  803e09:	41 ff d6             	call   *%r14
+  803e0c:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803e10:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803e13:	83 f8 ff             	cmp    $0xffffffff,%eax
+  803e16:	75 eb                	jne    803e03 <vprintfmt+0x2bf>
+  803e18:	e9 72 ff ff ff       	jmp    803d8f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803e1d:	0f b6 f8             	movzbl %al,%edi
+  803e20:	4c 89 ee             	mov    %r13,%rsi
+  803e23:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803e26:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803e2a:	49 83 c4 01          	add    $0x1,%r12
+  803e2e:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803e34:	84 c0                	test   %al,%al
+  803e36:	0f 84 66 ff ff ff    	je     803da2 <vprintfmt+0x25e>
+  803e3c:	45 85 ff             	test   %r15d,%r15d
+  803e3f:	78 0a                	js     803e4b <vprintfmt+0x307>
+  803e41:	41 83 ef 01          	sub    $0x1,%r15d
+  803e45:	0f 88 57 ff ff ff    	js     803da2 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803e4b:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803e4f:	74 cc                	je     803e1d <vprintfmt+0x2d9>
+  803e51:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803e54:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803e59:	80 fa 5e             	cmp    $0x5e,%dl
+  803e5c:	77 c2                	ja     803e20 <vprintfmt+0x2dc>
+  803e5e:	eb bd                	jmp    803e1d <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803e60:	40 84 f6             	test   %sil,%sil
+  803e63:	75 26                	jne    803e8b <vprintfmt+0x347>
+    switch (lflag) {
+  803e65:	85 d2                	test   %edx,%edx
+  803e67:	74 59                	je     803ec2 <vprintfmt+0x37e>
+  803e69:	83 fa 01             	cmp    $0x1,%edx
+  803e6c:	74 7b                	je     803ee9 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803e6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803e71:	83 f8 2f             	cmp    $0x2f,%eax
+  803e74:	0f 87 96 00 00 00    	ja     803f10 <vprintfmt+0x3cc>
+  803e7a:	89 c2                	mov    %eax,%edx
+  803e7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803e80:	83 c0 08             	add    $0x8,%eax
+  803e83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803e86:	4c 8b 22             	mov    (%rdx),%r12
+  803e89:	eb 17                	jmp    803ea2 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803e8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803e8e:	83 f8 2f             	cmp    $0x2f,%eax
+  803e91:	77 21                	ja     803eb4 <vprintfmt+0x370>
+  803e93:	89 c2                	mov    %eax,%edx
+  803e95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803e99:	83 c0 08             	add    $0x8,%eax
+  803e9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803e9f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803ea2:	4d 85 e4             	test   %r12,%r12
+  803ea5:	78 7a                	js     803f21 <vprintfmt+0x3dd>
+            num = i;
+  803ea7:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803eaa:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803eaf:	e9 50 02 00 00       	jmp    804104 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803eb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803eb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ebc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ec0:	eb dd                	jmp    803e9f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803ec2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ec5:	83 f8 2f             	cmp    $0x2f,%eax
+  803ec8:	77 11                	ja     803edb <vprintfmt+0x397>
+  803eca:	89 c2                	mov    %eax,%edx
+  803ecc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ed0:	83 c0 08             	add    $0x8,%eax
+  803ed3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ed6:	4c 63 22             	movslq (%rdx),%r12
+  803ed9:	eb c7                	jmp    803ea2 <vprintfmt+0x35e>
+  803edb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803edf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ee3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ee7:	eb ed                	jmp    803ed6 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803ee9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803eec:	83 f8 2f             	cmp    $0x2f,%eax
+  803eef:	77 11                	ja     803f02 <vprintfmt+0x3be>
+  803ef1:	89 c2                	mov    %eax,%edx
+  803ef3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ef7:	83 c0 08             	add    $0x8,%eax
+  803efa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803efd:	4c 8b 22             	mov    (%rdx),%r12
+  803f00:	eb a0                	jmp    803ea2 <vprintfmt+0x35e>
+  803f02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f0e:	eb ed                	jmp    803efd <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803f10:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f14:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f18:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f1c:	e9 65 ff ff ff       	jmp    803e86 <vprintfmt+0x342>
+                putch('-', put_arg);
+  803f21:	4c 89 ee             	mov    %r13,%rsi
+  803f24:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803f29:	41 ff d6             	call   *%r14
+                i = -i;
+  803f2c:	49 f7 dc             	neg    %r12
+  803f2f:	e9 73 ff ff ff       	jmp    803ea7 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803f34:	40 84 f6             	test   %sil,%sil
+  803f37:	75 32                	jne    803f6b <vprintfmt+0x427>
+    switch (lflag) {
+  803f39:	85 d2                	test   %edx,%edx
+  803f3b:	74 5d                	je     803f9a <vprintfmt+0x456>
+  803f3d:	83 fa 01             	cmp    $0x1,%edx
+  803f40:	0f 84 82 00 00 00    	je     803fc8 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803f46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f49:	83 f8 2f             	cmp    $0x2f,%eax
+  803f4c:	0f 87 a5 00 00 00    	ja     803ff7 <vprintfmt+0x4b3>
+  803f52:	89 c2                	mov    %eax,%edx
+  803f54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803f58:	83 c0 08             	add    $0x8,%eax
+  803f5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f5e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803f61:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803f66:	e9 99 01 00 00       	jmp    804104 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803f6b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f6e:	83 f8 2f             	cmp    $0x2f,%eax
+  803f71:	77 19                	ja     803f8c <vprintfmt+0x448>
+  803f73:	89 c2                	mov    %eax,%edx
+  803f75:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803f79:	83 c0 08             	add    $0x8,%eax
+  803f7c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803f7f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803f82:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803f87:	e9 78 01 00 00       	jmp    804104 <vprintfmt+0x5c0>
+  803f8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803f90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803f94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f98:	eb e5                	jmp    803f7f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803f9a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803f9d:	83 f8 2f             	cmp    $0x2f,%eax
+  803fa0:	77 18                	ja     803fba <vprintfmt+0x476>
+  803fa2:	89 c2                	mov    %eax,%edx
+  803fa4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803fa8:	83 c0 08             	add    $0x8,%eax
+  803fab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803fae:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803fb0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803fb5:	e9 4a 01 00 00       	jmp    804104 <vprintfmt+0x5c0>
+  803fba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803fc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fc6:	eb e6                	jmp    803fae <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803fc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803fcb:	83 f8 2f             	cmp    $0x2f,%eax
+  803fce:	77 19                	ja     803fe9 <vprintfmt+0x4a5>
+  803fd0:	89 c2                	mov    %eax,%edx
+  803fd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803fd6:	83 c0 08             	add    $0x8,%eax
+  803fd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803fdc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803fdf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803fe4:	e9 1b 01 00 00       	jmp    804104 <vprintfmt+0x5c0>
+  803fe9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ff1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ff5:	eb e5                	jmp    803fdc <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ff7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ffb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803fff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804003:	e9 56 ff ff ff       	jmp    803f5e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  804008:	40 84 f6             	test   %sil,%sil
+  80400b:	75 2e                	jne    80403b <vprintfmt+0x4f7>
+    switch (lflag) {
+  80400d:	85 d2                	test   %edx,%edx
+  80400f:	74 59                	je     80406a <vprintfmt+0x526>
+  804011:	83 fa 01             	cmp    $0x1,%edx
+  804014:	74 7f                	je     804095 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  804016:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804019:	83 f8 2f             	cmp    $0x2f,%eax
+  80401c:	0f 87 9f 00 00 00    	ja     8040c1 <vprintfmt+0x57d>
+  804022:	89 c2                	mov    %eax,%edx
+  804024:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804028:	83 c0 08             	add    $0x8,%eax
+  80402b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80402e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  804031:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  804036:	e9 c9 00 00 00       	jmp    804104 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80403b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80403e:	83 f8 2f             	cmp    $0x2f,%eax
+  804041:	77 19                	ja     80405c <vprintfmt+0x518>
+  804043:	89 c2                	mov    %eax,%edx
+  804045:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804049:	83 c0 08             	add    $0x8,%eax
+  80404c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80404f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  804052:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  804057:	e9 a8 00 00 00       	jmp    804104 <vprintfmt+0x5c0>
+  80405c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804060:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804064:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804068:	eb e5                	jmp    80404f <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80406a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80406d:	83 f8 2f             	cmp    $0x2f,%eax
+  804070:	77 15                	ja     804087 <vprintfmt+0x543>
+  804072:	89 c2                	mov    %eax,%edx
+  804074:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804078:	83 c0 08             	add    $0x8,%eax
+  80407b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80407e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  804080:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  804085:	eb 7d                	jmp    804104 <vprintfmt+0x5c0>
+  804087:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80408b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80408f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804093:	eb e9                	jmp    80407e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  804095:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804098:	83 f8 2f             	cmp    $0x2f,%eax
+  80409b:	77 16                	ja     8040b3 <vprintfmt+0x56f>
+  80409d:	89 c2                	mov    %eax,%edx
+  80409f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8040a3:	83 c0 08             	add    $0x8,%eax
+  8040a6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8040a9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8040ac:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8040b1:	eb 51                	jmp    804104 <vprintfmt+0x5c0>
+  8040b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8040bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040bf:	eb e8                	jmp    8040a9 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8040c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8040c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8040c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8040cd:	e9 5c ff ff ff       	jmp    80402e <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8040d2:	4c 89 ee             	mov    %r13,%rsi
+  8040d5:	bf 30 00 00 00       	mov    $0x30,%edi
+  8040da:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8040dd:	4c 89 ee             	mov    %r13,%rsi
+  8040e0:	bf 78 00 00 00       	mov    $0x78,%edi
+  8040e5:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8040e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8040eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8040ee:	77 47                	ja     804137 <vprintfmt+0x5f3>
+  8040f0:	89 c2                	mov    %eax,%edx
+  8040f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8040f6:	83 c0 08             	add    $0x8,%eax
+  8040f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8040fc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8040ff:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  804104:	48 83 ec 08          	sub    $0x8,%rsp
+  804108:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80410c:	0f 94 c0             	sete   %al
+  80410f:	0f b6 c0             	movzbl %al,%eax
+  804112:	50                   	push   %rax
+  804113:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  804118:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80411c:	4c 89 ee             	mov    %r13,%rsi
+  80411f:	4c 89 f7             	mov    %r14,%rdi
+  804122:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  804129:	00 00 00 
+  80412c:	ff d0                	call   *%rax
+            break;
+  80412e:	48 83 c4 10          	add    $0x10,%rsp
+  804132:	e9 3e fa ff ff       	jmp    803b75 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  804137:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80413b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80413f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804143:	eb b7                	jmp    8040fc <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  804145:	40 84 f6             	test   %sil,%sil
+  804148:	75 2b                	jne    804175 <vprintfmt+0x631>
+    switch (lflag) {
+  80414a:	85 d2                	test   %edx,%edx
+  80414c:	74 56                	je     8041a4 <vprintfmt+0x660>
+  80414e:	83 fa 01             	cmp    $0x1,%edx
+  804151:	74 7f                	je     8041d2 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  804153:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804156:	83 f8 2f             	cmp    $0x2f,%eax
+  804159:	0f 87 a2 00 00 00    	ja     804201 <vprintfmt+0x6bd>
+  80415f:	89 c2                	mov    %eax,%edx
+  804161:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804165:	83 c0 08             	add    $0x8,%eax
+  804168:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80416b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80416e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  804173:	eb 8f                	jmp    804104 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  804175:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  804178:	83 f8 2f             	cmp    $0x2f,%eax
+  80417b:	77 19                	ja     804196 <vprintfmt+0x652>
+  80417d:	89 c2                	mov    %eax,%edx
+  80417f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  804183:	83 c0 08             	add    $0x8,%eax
+  804186:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  804189:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80418c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  804191:	e9 6e ff ff ff       	jmp    804104 <vprintfmt+0x5c0>
+  804196:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80419a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80419e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041a2:	eb e5                	jmp    804189 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8041a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8041aa:	77 18                	ja     8041c4 <vprintfmt+0x680>
+  8041ac:	89 c2                	mov    %eax,%edx
+  8041ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8041b2:	83 c0 08             	add    $0x8,%eax
+  8041b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8041b8:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8041ba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8041bf:	e9 40 ff ff ff       	jmp    804104 <vprintfmt+0x5c0>
+  8041c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8041c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8041cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041d0:	eb e6                	jmp    8041b8 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8041d2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8041d5:	83 f8 2f             	cmp    $0x2f,%eax
+  8041d8:	77 19                	ja     8041f3 <vprintfmt+0x6af>
+  8041da:	89 c2                	mov    %eax,%edx
+  8041dc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8041e0:	83 c0 08             	add    $0x8,%eax
+  8041e3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8041e6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8041e9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8041ee:	e9 11 ff ff ff       	jmp    804104 <vprintfmt+0x5c0>
+  8041f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8041f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8041fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041ff:	eb e5                	jmp    8041e6 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  804201:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804205:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804209:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80420d:	e9 59 ff ff ff       	jmp    80416b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  804212:	4c 89 ee             	mov    %r13,%rsi
+  804215:	bf 25 00 00 00       	mov    $0x25,%edi
+  80421a:	41 ff d6             	call   *%r14
+            break;
+  80421d:	e9 53 f9 ff ff       	jmp    803b75 <vprintfmt+0x31>
+            putch('%', put_arg);
+  804222:	4c 89 ee             	mov    %r13,%rsi
+  804225:	bf 25 00 00 00       	mov    $0x25,%edi
+  80422a:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80422d:	48 83 eb 01          	sub    $0x1,%rbx
+  804231:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  804235:	75 f6                	jne    80422d <vprintfmt+0x6e9>
+  804237:	e9 39 f9 ff ff       	jmp    803b75 <vprintfmt+0x31>
+}
+  80423c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  804240:	5b                   	pop    %rbx
+  804241:	41 5c                	pop    %r12
+  804243:	41 5d                	pop    %r13
+  804245:	41 5e                	pop    %r14
+  804247:	41 5f                	pop    %r15
+  804249:	5d                   	pop    %rbp
+  80424a:	c3                   	ret
+
+000000000080424b <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80424b:	55                   	push   %rbp
+  80424c:	48 89 e5             	mov    %rsp,%rbp
+  80424f:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  804253:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  804257:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80425c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  804260:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  804267:	48 85 ff             	test   %rdi,%rdi
+  80426a:	74 2b                	je     804297 <vsnprintf+0x4c>
+  80426c:	48 85 f6             	test   %rsi,%rsi
+  80426f:	74 26                	je     804297 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  804271:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  804275:	48 bf ef 3a 80 00 00 	movabs $0x803aef,%rdi
+  80427c:	00 00 00 
+  80427f:	48 b8 44 3b 80 00 00 	movabs $0x803b44,%rax
+  804286:	00 00 00 
+  804289:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80428b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80428f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  804292:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  804295:	c9                   	leave
+  804296:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  804297:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80429c:	eb f7                	jmp    804295 <vsnprintf+0x4a>
+
+000000000080429e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80429e:	55                   	push   %rbp
+  80429f:	48 89 e5             	mov    %rsp,%rbp
+  8042a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8042a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8042ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8042b2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8042b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8042bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8042c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8042c9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8042cd:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  8042d4:	00 00 00 
+  8042d7:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8042d9:	c9                   	leave
+  8042da:	c3                   	ret
+
+00000000008042db <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8042db:	55                   	push   %rbp
+  8042dc:	48 89 e5             	mov    %rsp,%rbp
+  8042df:	41 56                	push   %r14
+  8042e1:	41 55                	push   %r13
+  8042e3:	41 54                	push   %r12
+  8042e5:	53                   	push   %rbx
+  8042e6:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e9:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042f0:	00 00 00 
+  8042f3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8042f7:	74 27                	je     804320 <_handle_vectored_pagefault+0x45>
+  8042f9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8042fe:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804305:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804308:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80430b:	4c 89 e7             	mov    %r12,%rdi
+  80430e:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804313:	84 c0                	test   %al,%al
+  804315:	75 45                	jne    80435c <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804317:	48 83 c3 01          	add    $0x1,%rbx
+  80431b:	49 3b 1e             	cmp    (%r14),%rbx
+  80431e:	72 eb                	jb     80430b <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804320:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804327:	00 
+  804328:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80432d:	4d 8b 04 24          	mov    (%r12),%r8
+  804331:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  804338:	00 00 00 
+  80433b:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804340:	48 bf 68 4e 80 00 00 	movabs $0x804e68,%rdi
+  804347:	00 00 00 
+  80434a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434f:	49 ba a4 38 80 00 00 	movabs $0x8038a4,%r10
+  804356:	00 00 00 
+  804359:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80435c:	5b                   	pop    %rbx
+  80435d:	41 5c                	pop    %r12
+  80435f:	41 5d                	pop    %r13
+  804361:	41 5e                	pop    %r14
+  804363:	5d                   	pop    %rbp
+  804364:	c3                   	ret
+
+0000000000804365 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804365:	55                   	push   %rbp
+  804366:	48 89 e5             	mov    %rsp,%rbp
+  804369:	53                   	push   %rbx
+  80436a:	48 83 ec 08          	sub    $0x8,%rsp
+  80436e:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804371:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804378:	00 00 00 
+  80437b:	80 38 00             	cmpb   $0x0,(%rax)
+  80437e:	0f 84 84 00 00 00    	je     804408 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804384:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80438b:	00 00 00 
+  80438e:	48 8b 10             	mov    (%rax),%rdx
+  804391:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804396:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80439d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043a0:	48 85 d2             	test   %rdx,%rdx
+  8043a3:	74 19                	je     8043be <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043a5:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8043a9:	0f 84 e8 00 00 00    	je     804497 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8043af:	48 83 c0 01          	add    $0x1,%rax
+  8043b3:	48 39 d0             	cmp    %rdx,%rax
+  8043b6:	75 ed                	jne    8043a5 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8043b8:	48 83 fa 08          	cmp    $0x8,%rdx
+  8043bc:	74 1c                	je     8043da <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8043be:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8043c2:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8043c9:	00 00 00 
+  8043cc:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8043d3:	00 00 00 
+  8043d6:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8043da:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  8043e1:	00 00 00 
+  8043e4:	ff d0                	call   *%rax
+  8043e6:	89 c7                	mov    %eax,%edi
+  8043e8:	48 be 5d 45 80 00 00 	movabs $0x80455d,%rsi
+  8043ef:	00 00 00 
+  8043f2:	48 b8 44 09 80 00 00 	movabs $0x800944,%rax
+  8043f9:	00 00 00 
+  8043fc:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043fe:	85 c0                	test   %eax,%eax
+  804400:	78 68                	js     80446a <add_pgfault_handler+0x105>
+    return res;
+}
+  804402:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804406:	c9                   	leave
+  804407:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804408:	48 b8 f9 06 80 00 00 	movabs $0x8006f9,%rax
+  80440f:	00 00 00 
+  804412:	ff d0                	call   *%rax
+  804414:	89 c7                	mov    %eax,%edi
+  804416:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80441b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804420:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804427:	00 00 00 
+  80442a:	48 b8 86 07 80 00 00 	movabs $0x800786,%rax
+  804431:	00 00 00 
+  804434:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804436:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80443d:	00 00 00 
+  804440:	48 8b 02             	mov    (%rdx),%rax
+  804443:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804447:	48 89 0a             	mov    %rcx,(%rdx)
+  80444a:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804451:	00 00 00 
+  804454:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804458:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80445f:	00 00 00 
+  804462:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804465:	e9 70 ff ff ff       	jmp    8043da <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80446a:	89 c1                	mov    %eax,%ecx
+  80446c:	48 ba 76 4e 80 00 00 	movabs $0x804e76,%rdx
+  804473:	00 00 00 
+  804476:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80447b:	48 bf 68 4e 80 00 00 	movabs $0x804e68,%rdi
+  804482:	00 00 00 
+  804485:	b8 00 00 00 00       	mov    $0x0,%eax
+  80448a:	49 b8 a4 38 80 00 00 	movabs $0x8038a4,%r8
+  804491:	00 00 00 
+  804494:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449c:	e9 61 ff ff ff       	jmp    804402 <add_pgfault_handler+0x9d>
+
+00000000008044a1 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8044a1:	55                   	push   %rbp
+  8044a2:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8044a5:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8044ac:	00 00 00 
+  8044af:	80 38 00             	cmpb   $0x0,(%rax)
+  8044b2:	74 33                	je     8044e7 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044b4:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8044bb:	00 00 00 
+  8044be:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8044c3:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8044ca:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044cd:	48 85 c0             	test   %rax,%rax
+  8044d0:	0f 84 85 00 00 00    	je     80455b <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8044d6:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8044da:	74 40                	je     80451c <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8044dc:	48 83 c1 01          	add    $0x1,%rcx
+  8044e0:	48 39 c1             	cmp    %rax,%rcx
+  8044e3:	75 f1                	jne    8044d6 <remove_pgfault_handler+0x35>
+  8044e5:	eb 74                	jmp    80455b <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8044e7:	48 b9 8e 4e 80 00 00 	movabs $0x804e8e,%rcx
+  8044ee:	00 00 00 
+  8044f1:	48 ba 67 48 80 00 00 	movabs $0x804867,%rdx
+  8044f8:	00 00 00 
+  8044fb:	be 43 00 00 00       	mov    $0x43,%esi
+  804500:	48 bf 68 4e 80 00 00 	movabs $0x804e68,%rdi
+  804507:	00 00 00 
+  80450a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80450f:	49 b8 a4 38 80 00 00 	movabs $0x8038a4,%r8
+  804516:	00 00 00 
+  804519:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80451c:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804523:	00 
+  804524:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804528:	48 29 ca             	sub    %rcx,%rdx
+  80452b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804532:	00 00 00 
+  804535:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804539:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80453e:	48 89 ce             	mov    %rcx,%rsi
+  804541:	48 b8 21 04 80 00 00 	movabs $0x800421,%rax
+  804548:	00 00 00 
+  80454b:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80454d:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804554:	00 00 00 
+  804557:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80455b:	5d                   	pop    %rbp
+  80455c:	c3                   	ret
+
+000000000080455d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80455d:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804560:	48 b8 db 42 80 00 00 	movabs $0x8042db,%rax
+  804567:	00 00 00 
+    call *%rax
+  80456a:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80456c:	41 5f                	pop    %r15
+	popq %r15
+  80456e:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804570:	41 5f                	pop    %r15
+	popq %r14
+  804572:	41 5e                	pop    %r14
+	popq %r13
+  804574:	41 5d                	pop    %r13
+	popq %r12
+  804576:	41 5c                	pop    %r12
+	popq %r11
+  804578:	41 5b                	pop    %r11
+	popq %r10
+  80457a:	41 5a                	pop    %r10
+	popq %r9
+  80457c:	41 59                	pop    %r9
+	popq %r8
+  80457e:	41 58                	pop    %r8
+	popq %rsi
+  804580:	5e                   	pop    %rsi
+	popq %rdi
+  804581:	5f                   	pop    %rdi
+	popq %rbp
+  804582:	5d                   	pop    %rbp
+	popq %rdx
+  804583:	5a                   	pop    %rdx
+	popq %rcx
+  804584:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804585:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80458a:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80458f:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804593:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804596:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80459b:	5b                   	pop    %rbx
+	popq %rax
+  80459c:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80459d:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8045a1:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8045a2:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8045a7:	c3                   	ret
+
+00000000008045a8 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8045a8:	55                   	push   %rbp
+  8045a9:	48 89 e5             	mov    %rsp,%rbp
+  8045ac:	41 55                	push   %r13
+  8045ae:	41 54                	push   %r12
+  8045b0:	53                   	push   %rbx
+  8045b1:	48 83 ec 08          	sub    $0x8,%rsp
+  8045b5:	49 89 fd             	mov    %rdi,%r13
+  8045b8:	48 89 f7             	mov    %rsi,%rdi
+  8045bb:	48 89 d3             	mov    %rdx,%rbx
+  8045be:	49 89 cc             	mov    %rcx,%r12
+  8045c1:	4c 89 c2             	mov    %r8,%rdx
+  8045c4:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045c7:	48 85 f6             	test   %rsi,%rsi
+  8045ca:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045d1:	00 00 00 
+  8045d4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8045d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045dd:	48 85 db             	test   %rbx,%rbx
+  8045e0:	74 03                	je     8045e5 <ipc_recv_futex+0x3d>
+  8045e2:	48 8b 33             	mov    (%rbx),%rsi
+  8045e5:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8045e9:	48 b8 d0 09 80 00 00 	movabs $0x8009d0,%rax
+  8045f0:	00 00 00 
+  8045f3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045f5:	85 c0                	test   %eax,%eax
+  8045f7:	78 75                	js     80466e <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8045f9:	4d 85 ed             	test   %r13,%r13
+  8045fc:	74 14                	je     804612 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8045fe:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804605:	00 00 00 
+  804608:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80460e:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804612:	4d 85 e4             	test   %r12,%r12
+  804615:	74 14                	je     80462b <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804617:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80461e:	00 00 00 
+  804621:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804627:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80462b:	48 85 db             	test   %rbx,%rbx
+  80462e:	74 23                	je     804653 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804630:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804637:	00 00 00 
+  80463a:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804640:	ba 00 00 00 00       	mov    $0x0,%edx
+  804645:	85 c9                	test   %ecx,%ecx
+  804647:	74 07                	je     804650 <ipc_recv_futex+0xa8>
+  804649:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804650:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804653:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80465a:	00 00 00 
+  80465d:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804663:	48 83 c4 08          	add    $0x8,%rsp
+  804667:	5b                   	pop    %rbx
+  804668:	41 5c                	pop    %r12
+  80466a:	41 5d                	pop    %r13
+  80466c:	5d                   	pop    %rbp
+  80466d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80466e:	4d 85 ed             	test   %r13,%r13
+  804671:	74 08                	je     80467b <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804673:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80467a:	00 
+        if (perm_store != NULL) {
+  80467b:	4d 85 e4             	test   %r12,%r12
+  80467e:	74 08                	je     804688 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804680:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804687:	00 
+        if (size != NULL) {
+  804688:	48 85 db             	test   %rbx,%rbx
+  80468b:	74 d6                	je     804663 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80468d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804694:	eb cd                	jmp    804663 <ipc_recv_futex+0xbb>
+
+0000000000804696 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804696:	55                   	push   %rbp
+  804697:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80469a:	48 83 ec 08          	sub    $0x8,%rsp
+  80469e:	6a 00                	push   $0x0
+  8046a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046ac:	48 b8 a8 45 80 00 00 	movabs $0x8045a8,%rax
+  8046b3:	00 00 00 
+  8046b6:	ff d0                	call   *%rax
+}
+  8046b8:	c9                   	leave
+  8046b9:	c3                   	ret
+
+00000000008046ba <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046ba:	55                   	push   %rbp
+  8046bb:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046be:	48 85 d2             	test   %rdx,%rdx
+  8046c1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046c8:	00 00 00 
+  8046cb:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8046cf:	89 f6                	mov    %esi,%esi
+  8046d1:	48 b8 b9 09 80 00 00 	movabs $0x8009b9,%rax
+  8046d8:	00 00 00 
+  8046db:	ff d0                	call   *%rax
+    if (res < 0) {
+  8046dd:	85 c0                	test   %eax,%eax
+  8046df:	78 02                	js     8046e3 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8046e1:	5d                   	pop    %rbp
+  8046e2:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8046e3:	89 c1                	mov    %eax,%ecx
+  8046e5:	48 ba a8 4e 80 00 00 	movabs $0x804ea8,%rdx
+  8046ec:	00 00 00 
+  8046ef:	be 50 00 00 00       	mov    $0x50,%esi
+  8046f4:	48 bf bc 4e 80 00 00 	movabs $0x804ebc,%rdi
+  8046fb:	00 00 00 
+  8046fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804703:	49 b8 a4 38 80 00 00 	movabs $0x8038a4,%r8
+  80470a:	00 00 00 
+  80470d:	41 ff d0             	call   *%r8
+
+0000000000804710 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804710:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804715:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80471c:	00 00 00 
+  80471f:	48 89 d0             	mov    %rdx,%rax
+  804722:	48 c1 e0 04          	shl    $0x4,%rax
+  804726:	48 29 d0             	sub    %rdx,%rax
+  804729:	48 c1 e0 05          	shl    $0x5,%rax
+  80472d:	48 01 c8             	add    %rcx,%rax
+  804730:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804736:	39 f8                	cmp    %edi,%eax
+  804738:	74 13                	je     80474d <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80473a:	48 83 c2 01          	add    $0x1,%rdx
+  80473e:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804745:	75 d8                	jne    80471f <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804747:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80474c:	c3                   	ret
+            return envs[i].env_id;
+  80474d:	48 89 d0             	mov    %rdx,%rax
+  804750:	48 c1 e0 04          	shl    $0x4,%rax
+  804754:	48 29 d0             	sub    %rdx,%rax
+  804757:	48 c1 e0 05          	shl    $0x5,%rax
+  80475b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804762:	00 00 00 
+  804765:	48 01 d0             	add    %rdx,%rax
+  804768:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80476e:	c3                   	ret
+  80476f:	90                   	nop
+
+0000000000804770 <__rodata_start>:
+  804770:	2d 6e 00 20 00       	sub    $0x20006e,%eax
+  804775:	3c 75                	cmp    $0x75,%al
+  804777:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804778:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80477c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80477d:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  804784:	61                   	(bad)
+  804785:	6c                   	insb   (%dx),%es:(%rdi)
+  804786:	6c                   	insb   (%dx),%es:(%rdi)
+  804787:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ac07 <__bss_end+0x721c8c07>
+  80478d:	65 74 75             	gs je  804805 <__rodata_start+0x95>
+  804790:	72 6e                	jb     804800 <__rodata_start+0x90>
+  804792:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ac14 <__bss_end+0x281c8c14>
+  804799:	28 
+  80479a:	3e 20 30             	ds and %dh,(%rax)
+  80479d:	29 00                	sub    %eax,(%rax)
+  80479f:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8047a7:	61                   	(bad)
+  8047a8:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a9:	6c                   	insb   (%dx),%es:(%rdi)
+  8047aa:	2e 63 00             	cs movsxd (%rax),%eax
+  8047ad:	0f 1f 00             	nopl   (%rax)
+  8047b0:	5b                   	pop    %rbx
+  8047b1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8047b6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8047b9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8047bd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047be:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8047c2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8047c9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805234 <__ctors_end+0x154>
+  8047d0:	5b                   	pop    %rbx
+  8047d1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8047d6:	20 66 74             	and    %ah,0x74(%rsi)
+  8047d9:	72 75                	jb     804850 <devtab+0x10>
+  8047db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047dc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8047df:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad684a <__bss_end+0x2d29484a>
+  8047e6:	20 62 61             	and    %ah,0x61(%rdx)
+  8047e9:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  8047ed:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  8047f1:	5b                   	pop    %rbx
+  8047f2:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8047f7:	20 72 65             	and    %dh,0x65(%rdx)
+  8047fa:	61                   	(bad)
+  8047fb:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad6866 <__bss_end+0x2d294866>
+  804802:	20 62 61             	and    %ah,0x61(%rdx)
+  804805:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804809:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80480d:	5b                   	pop    %rbx
+  80480e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804813:	20 77 72             	and    %dh,0x72(%rdi)
+  804816:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80481d:	2d 
+  80481e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804823:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804826:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80482a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804831:	00 00 00 
+  804834:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80483b:	00 00 00 
+  80483e:	66 90                	xchg   %ax,%ax
+
+0000000000804840 <devtab>:
+  804840:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804850:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804860:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804870:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804880:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804890:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8048a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8048b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8048c0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8048d0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  8048e0:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  8048f0:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804900:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804910:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804920:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804930:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804940:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804950:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804960:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804970:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  804980:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  804990:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8049a0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8049b0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8049c0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8049d0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  8049e0:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  8049f0:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804a00:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804a10:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804a20:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804a30:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804a40:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804a50:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804a60:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804a70:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  804a80:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  804a90:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  804aa0:	e1 3b 80 00 00 00 00 00 22 42 80 00 00 00 00 00     .;......"B......
+  804ab0:	12 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     .B......"B......
+  804ac0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804ad0:	22 42 80 00 00 00 00 00 00 3c 80 00 00 00 00 00     "B.......<......
+  804ae0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804af0:	f4 3b 80 00 00 00 00 00 6e 3c 80 00 00 00 00 00     .;......n<......
+  804b00:	22 42 80 00 00 00 00 00 f4 3b 80 00 00 00 00 00     "B.......;......
+  804b10:	3a 3c 80 00 00 00 00 00 3a 3c 80 00 00 00 00 00     :<......:<......
+  804b20:	3a 3c 80 00 00 00 00 00 3a 3c 80 00 00 00 00 00     :<......:<......
+  804b30:	3a 3c 80 00 00 00 00 00 3a 3c 80 00 00 00 00 00     :<......:<......
+  804b40:	3a 3c 80 00 00 00 00 00 3a 3c 80 00 00 00 00 00     :<......:<......
+  804b50:	3a 3c 80 00 00 00 00 00 22 42 80 00 00 00 00 00     :<......"B......
+  804b60:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804b70:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804b80:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804b90:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804ba0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804bb0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804bc0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804bd0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804be0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804bf0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c00:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c10:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c20:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c30:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c40:	22 42 80 00 00 00 00 00 45 41 80 00 00 00 00 00     "B......EA......
+  804c50:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c60:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c70:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c80:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804c90:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804ca0:	91 3c 80 00 00 00 00 00 60 3e 80 00 00 00 00 00     .<......`>......
+  804cb0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804cc0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804cd0:	c0 3c 80 00 00 00 00 00 22 42 80 00 00 00 00 00     .<......"B......
+  804ce0:	22 42 80 00 00 00 00 00 86 3c 80 00 00 00 00 00     "B.......<......
+  804cf0:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804d00:	08 40 80 00 00 00 00 00 d2 40 80 00 00 00 00 00     .@.......@......
+  804d10:	22 42 80 00 00 00 00 00 22 42 80 00 00 00 00 00     "B......"B......
+  804d20:	57 3d 80 00 00 00 00 00 22 42 80 00 00 00 00 00     W=......"B......
+  804d30:	34 3f 80 00 00 00 00 00 22 42 80 00 00 00 00 00     4?......"B......
+  804d40:	22 42 80 00 00 00 00 00 45 41 80 00 00 00 00 00     "B......EA......
+  804d50:	22 42 80 00 00 00 00 00 ea 3b 80 00 00 00 00 00     "B.......;......
+
+0000000000804d60 <error_string>:
+	...
+  804d68:	15 49 80 00 00 00 00 00 27 49 80 00 00 00 00 00     .I......'I......
+  804d78:	37 49 80 00 00 00 00 00 49 49 80 00 00 00 00 00     7I......II......
+  804d88:	57 49 80 00 00 00 00 00 6b 49 80 00 00 00 00 00     WI......kI......
+  804d98:	80 49 80 00 00 00 00 00 93 49 80 00 00 00 00 00     .I.......I......
+  804da8:	a5 49 80 00 00 00 00 00 b9 49 80 00 00 00 00 00     .I.......I......
+  804db8:	c9 49 80 00 00 00 00 00 dc 49 80 00 00 00 00 00     .I.......I......
+  804dc8:	f3 49 80 00 00 00 00 00 09 4a 80 00 00 00 00 00     .I.......J......
+  804dd8:	21 4a 80 00 00 00 00 00 39 4a 80 00 00 00 00 00     !J......9J......
+  804de8:	46 4a 80 00 00 00 00 00 18 4e 80 00 00 00 00 00     FJ.......N......
+  804df8:	5a 4a 80 00 00 00 00 00 72 4a 80 00 00 00 00 00     ZJ......rJ......
+  804e08:	7c 4a 80 00 00 00 00 00 86 4a 80 00 00 00 00 00     |J.......J......
+  804e18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e38:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804e48:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804e58:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804e68:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804e78:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804e88:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804e98:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804ea8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804eb8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804ec8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff8:	00 00 00 00 0f 1f 40 00                             ......@.
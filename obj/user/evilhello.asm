@@ -0,0 +1,7885 @@
+
+obj/user/evilhello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 23 00 00 00       	call   800046 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * kernel should destroy user environment in response */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    /* try to print the kernel entry point as a string!  mua ha ha! */
+    sys_cputs((char *)0x804020000c, 100);
+  800029:	be 64 00 00 00       	mov    $0x64,%esi
+  80002e:	48 bf 0c 00 20 40 80 	movabs $0x804020000c,%rdi
+  800035:	00 00 00 
+  800038:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+}
+  800044:	5d                   	pop    %rbp
+  800045:	c3                   	ret
+
+0000000000800046 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800046:	55                   	push   %rbp
+  800047:	48 89 e5             	mov    %rsp,%rbp
+  80004a:	41 56                	push   %r14
+  80004c:	41 55                	push   %r13
+  80004e:	41 54                	push   %r12
+  800050:	53                   	push   %rbx
+  800051:	41 89 fd             	mov    %edi,%r13d
+  800054:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800057:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  80005e:	00 00 00 
+  800061:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800068:	00 00 00 
+  80006b:	48 39 c2             	cmp    %rax,%rdx
+  80006e:	73 17                	jae    800087 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800070:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800073:	49 89 c4             	mov    %rax,%r12
+  800076:	48 83 c3 08          	add    $0x8,%rbx
+  80007a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007f:	ff 53 f8             	call   *-0x8(%rbx)
+  800082:	4c 39 e3             	cmp    %r12,%rbx
+  800085:	72 ef                	jb     800076 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800087:	48 b8 c7 01 80 00 00 	movabs $0x8001c7,%rax
+  80008e:	00 00 00 
+  800091:	ff d0                	call   *%rax
+  800093:	89 c2                	mov    %eax,%edx
+  800095:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80009b:	48 89 d0             	mov    %rdx,%rax
+  80009e:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a2:	48 29 d0             	sub    %rdx,%rax
+  8000a5:	48 c1 e0 05          	shl    $0x5,%rax
+  8000a9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b0:	00 00 00 
+  8000b3:	48 01 d0             	add    %rdx,%rax
+  8000b6:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000bd:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c0:	45 85 ed             	test   %r13d,%r13d
+  8000c3:	7e 0d                	jle    8000d2 <libmain+0x8c>
+  8000c5:	49 8b 06             	mov    (%r14),%rax
+  8000c8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000cf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d2:	4c 89 f6             	mov    %r14,%rsi
+  8000d5:	44 89 ef             	mov    %r13d,%edi
+  8000d8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000e4:	48 b8 f9 00 80 00 00 	movabs $0x8000f9,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+#endif
+}
+  8000f0:	5b                   	pop    %rbx
+  8000f1:	41 5c                	pop    %r12
+  8000f3:	41 5d                	pop    %r13
+  8000f5:	41 5e                	pop    %r14
+  8000f7:	5d                   	pop    %rbp
+  8000f8:	c3                   	ret
+
+00000000008000f9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000f9:	55                   	push   %rbp
+  8000fa:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000fd:	48 b8 ad 08 80 00 00 	movabs $0x8008ad,%rax
+  800104:	00 00 00 
+  800107:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800109:	bf 00 00 00 00       	mov    $0x0,%edi
+  80010e:	48 b8 64 01 80 00 00 	movabs $0x800164,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+}
+  80011a:	5d                   	pop    %rbp
+  80011b:	c3                   	ret
+
+000000000080011c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80011c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800121:	ba 00 00 00 00       	mov    $0x0,%edx
+  800126:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80012c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800132:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800138:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80013a:	c3                   	ret
+
+000000000080013b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80013b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800140:	bf 00 00 00 00       	mov    $0x0,%edi
+  800145:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80014a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80014f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800155:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80015b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800161:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800163:	c3                   	ret
+
+0000000000800164 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800164:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800167:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80016c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800171:	ba 00 00 00 00       	mov    $0x0,%edx
+  800176:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80017c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800182:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800188:	0f 05                	syscall
+    if (check && ret > 0) {
+  80018a:	48 85 c0             	test   %rax,%rax
+  80018d:	7f 01                	jg     800190 <sys_env_destroy+0x2c>
+}
+  80018f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800194:	49 89 c0             	mov    %rax,%r8
+  800197:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80019c:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  8001a3:	00 00 00 
+  8001a6:	be 29 00 00 00       	mov    $0x29,%esi
+  8001ab:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  8001b2:	00 00 00 
+  8001b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ba:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  8001c1:	00 00 00 
+  8001c4:	41 ff d1             	call   *%r9
+
+00000000008001c7 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001c7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001db:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001e1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001e7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001ed:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001ef:	c3                   	ret
+
+00000000008001f0 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001f0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fa:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  800204:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80020a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800210:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800216:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800218:	c3                   	ret
+
+0000000000800219 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800219:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80021e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800225:	00 00 00 
+  800228:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80022e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800234:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80023a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80023c:	c3                   	ret
+
+000000000080023d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80023d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800240:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800245:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80024b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800251:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800253:	c3                   	ret
+
+0000000000800254 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800254:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800257:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80025c:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80025f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800265:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80026b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80026d:	48 85 c0             	test   %rax,%rax
+  800270:	7f 01                	jg     800273 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800272:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800273:	55                   	push   %rbp
+  800274:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800277:	49 89 c0             	mov    %rax,%r8
+  80027a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80027f:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  800286:	00 00 00 
+  800289:	be 29 00 00 00       	mov    $0x29,%esi
+  80028e:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  800295:	00 00 00 
+  800298:	b8 00 00 00 00       	mov    $0x0,%eax
+  80029d:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  8002a4:	00 00 00 
+  8002a7:	41 ff d1             	call   *%r9
+
+00000000008002aa <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002aa:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002ad:	48 63 d2             	movslq %edx,%rdx
+  8002b0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002b3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002b8:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002bb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002bd:	48 85 c0             	test   %rax,%rax
+  8002c0:	7f 01                	jg     8002c3 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002c2:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002c3:	55                   	push   %rbp
+  8002c4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002c7:	49 89 c0             	mov    %rax,%r8
+  8002ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002cf:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  8002d6:	00 00 00 
+  8002d9:	be 29 00 00 00       	mov    $0x29,%esi
+  8002de:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  8002e5:	00 00 00 
+  8002e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ed:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  8002f4:	00 00 00 
+  8002f7:	41 ff d1             	call   *%r9
+
+00000000008002fa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002fa:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002fd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800302:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800308:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80030e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800314:	0f 05                	syscall
+    if (check && ret > 0) {
+  800316:	48 85 c0             	test   %rax,%rax
+  800319:	7f 01                	jg     80031c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80031b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80031c:	55                   	push   %rbp
+  80031d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800320:	49 89 c0             	mov    %rax,%r8
+  800323:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800328:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  80032f:	00 00 00 
+  800332:	be 29 00 00 00       	mov    $0x29,%esi
+  800337:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  80033e:	00 00 00 
+  800341:	b8 00 00 00 00       	mov    $0x0,%eax
+  800346:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  80034d:	00 00 00 
+  800350:	41 ff d1             	call   *%r9
+
+0000000000800353 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800353:	48 63 f6             	movslq %esi,%rsi
+  800356:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800359:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80035e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800363:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800369:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80036f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800375:	0f 05                	syscall
+    if (check && ret > 0) {
+  800377:	48 85 c0             	test   %rax,%rax
+  80037a:	7f 01                	jg     80037d <sys_env_set_status+0x2a>
+}
+  80037c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80037d:	55                   	push   %rbp
+  80037e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800381:	49 89 c0             	mov    %rax,%r8
+  800384:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800389:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  800390:	00 00 00 
+  800393:	be 29 00 00 00       	mov    $0x29,%esi
+  800398:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  80039f:	00 00 00 
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  8003ae:	00 00 00 
+  8003b1:	41 ff d1             	call   *%r9
+
+00000000008003b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003d3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003d5:	48 85 c0             	test   %rax,%rax
+  8003d8:	7f 01                	jg     8003db <sys_env_set_trapframe+0x27>
+}
+  8003da:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003db:	55                   	push   %rbp
+  8003dc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003df:	49 89 c0             	mov    %rax,%r8
+  8003e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003e7:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  8003ee:	00 00 00 
+  8003f1:	be 29 00 00 00       	mov    $0x29,%esi
+  8003f6:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  8003fd:	00 00 00 
+  800400:	b8 00 00 00 00       	mov    $0x0,%eax
+  800405:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  80040c:	00 00 00 
+  80040f:	41 ff d1             	call   *%r9
+
+0000000000800412 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800412:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800415:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80041a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80041f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800425:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80042b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800431:	0f 05                	syscall
+    if (check && ret > 0) {
+  800433:	48 85 c0             	test   %rax,%rax
+  800436:	7f 01                	jg     800439 <sys_env_set_pgfault_upcall+0x27>
+}
+  800438:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800439:	55                   	push   %rbp
+  80043a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80043d:	49 89 c0             	mov    %rax,%r8
+  800440:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800445:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  80044c:	00 00 00 
+  80044f:	be 29 00 00 00       	mov    $0x29,%esi
+  800454:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  80045b:	00 00 00 
+  80045e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800463:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  80046a:	00 00 00 
+  80046d:	41 ff d1             	call   *%r9
+
+0000000000800470 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800470:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800473:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800476:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80047b:	4d 63 c0             	movslq %r8d,%r8
+  80047e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800484:	0f 05                	syscall
+}
+  800486:	c3                   	ret
+
+0000000000800487 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800487:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80048a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80048d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800492:	4d 63 c0             	movslq %r8d,%r8
+  800495:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80049b:	0f 05                	syscall
+}
+  80049d:	c3                   	ret
+
+000000000080049e <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80049e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8004a3:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004a6:	45 89 c0             	mov    %r8d,%r8d
+  8004a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004af:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004b1:	48 85 c0             	test   %rax,%rax
+  8004b4:	7f 01                	jg     8004b7 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004b6:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004b7:	55                   	push   %rbp
+  8004b8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004bb:	49 89 c0             	mov    %rax,%r8
+  8004be:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004c3:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  8004ca:	00 00 00 
+  8004cd:	be 29 00 00 00       	mov    $0x29,%esi
+  8004d2:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  8004d9:	00 00 00 
+  8004dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e1:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  8004e8:	00 00 00 
+  8004eb:	41 ff d1             	call   *%r9
+
+00000000008004ee <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800502:	48 b8 9e 04 80 00 00 	movabs $0x80049e,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+}
+  80050e:	5d                   	pop    %rbp
+  80050f:	c3                   	ret
+
+0000000000800510 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  800510:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800515:	bf 00 00 00 00       	mov    $0x0,%edi
+  80051a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80051f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800524:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80052a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800530:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800536:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800538:	c3                   	ret
+
+0000000000800539 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800539:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80053e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800543:	ba 00 00 00 00       	mov    $0x0,%edx
+  800548:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80054e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800554:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80055a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80055c:	48 85 c0             	test   %rax,%rax
+  80055f:	7f 01                	jg     800562 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800561:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800566:	49 89 c0             	mov    %rax,%r8
+  800569:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80056e:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  800575:	00 00 00 
+  800578:	be 29 00 00 00       	mov    $0x29,%esi
+  80057d:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  800584:	00 00 00 
+  800587:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058c:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  800593:	00 00 00 
+  800596:	41 ff d1             	call   *%r9
+
+0000000000800599 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  800599:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80059e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005bf:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005c1:	c3                   	ret
+
+00000000008005c2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005c2:	89 d2                	mov    %edx,%edx
+  8005c4:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005dd:	0f 05                	syscall
+}
+  8005df:	c3                   	ret
+
+00000000008005e0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005e0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005e3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ff:	0f 05                	syscall
+}
+  800601:	c3                   	ret
+
+0000000000800602 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  800602:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800605:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80060a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80060f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800615:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80061b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800621:	0f 05                	syscall
+}
+  800623:	c3                   	ret
+
+0000000000800624 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800624:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800627:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80062c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800631:	ba 00 00 00 00       	mov    $0x0,%edx
+  800636:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80063c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800642:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800648:	0f 05                	syscall
+    if (check && ret > 0) {
+  80064a:	48 85 c0             	test   %rax,%rax
+  80064d:	7f 01                	jg     800650 <sys_irq_ack+0x2c>
+}
+  80064f:	c3                   	ret
+sys_irq_ack(int irq) {
+  800650:	55                   	push   %rbp
+  800651:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800654:	49 89 c0             	mov    %rax,%r8
+  800657:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80065c:	48 ba b8 46 80 00 00 	movabs $0x8046b8,%rdx
+  800663:	00 00 00 
+  800666:	be 29 00 00 00       	mov    $0x29,%esi
+  80066b:	48 bf d7 46 80 00 00 	movabs $0x8046d7,%rdi
+  800672:	00 00 00 
+  800675:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067a:	49 b9 72 33 80 00 00 	movabs $0x803372,%r9
+  800681:	00 00 00 
+  800684:	41 ff d1             	call   *%r9
+
+0000000000800687 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800687:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80068e:	ff ff ff 
+  800691:	48 01 f8             	add    %rdi,%rax
+  800694:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800698:	c3                   	ret
+
+0000000000800699 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800699:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006a0:	ff ff ff 
+  8006a3:	48 01 f8             	add    %rdi,%rax
+  8006a6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006aa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006b0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006b4:	c3                   	ret
+
+00000000008006b5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006b5:	55                   	push   %rbp
+  8006b6:	48 89 e5             	mov    %rsp,%rbp
+  8006b9:	41 57                	push   %r15
+  8006bb:	41 56                	push   %r14
+  8006bd:	41 55                	push   %r13
+  8006bf:	41 54                	push   %r12
+  8006c1:	53                   	push   %rbx
+  8006c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006c6:	49 89 ff             	mov    %rdi,%r15
+  8006c9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006ce:	49 bd 44 2e 80 00 00 	movabs $0x802e44,%r13
+  8006d5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006d8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006de:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006e1:	48 89 df             	mov    %rbx,%rdi
+  8006e4:	41 ff d5             	call   *%r13
+  8006e7:	83 e0 04             	and    $0x4,%eax
+  8006ea:	74 17                	je     800703 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006f3:	4c 39 f3             	cmp    %r14,%rbx
+  8006f6:	75 e6                	jne    8006de <fd_alloc+0x29>
+  8006f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006fe:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800703:	4d 89 27             	mov    %r12,(%r15)
+}
+  800706:	48 83 c4 08          	add    $0x8,%rsp
+  80070a:	5b                   	pop    %rbx
+  80070b:	41 5c                	pop    %r12
+  80070d:	41 5d                	pop    %r13
+  80070f:	41 5e                	pop    %r14
+  800711:	41 5f                	pop    %r15
+  800713:	5d                   	pop    %rbp
+  800714:	c3                   	ret
+
+0000000000800715 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800715:	83 ff 1f             	cmp    $0x1f,%edi
+  800718:	77 39                	ja     800753 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80071a:	55                   	push   %rbp
+  80071b:	48 89 e5             	mov    %rsp,%rbp
+  80071e:	41 54                	push   %r12
+  800720:	53                   	push   %rbx
+  800721:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800724:	48 63 df             	movslq %edi,%rbx
+  800727:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80072e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800732:	48 89 df             	mov    %rbx,%rdi
+  800735:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  80073c:	00 00 00 
+  80073f:	ff d0                	call   *%rax
+  800741:	a8 04                	test   $0x4,%al
+  800743:	74 14                	je     800759 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800745:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800749:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80074e:	5b                   	pop    %rbx
+  80074f:	41 5c                	pop    %r12
+  800751:	5d                   	pop    %rbp
+  800752:	c3                   	ret
+        return -E_INVAL;
+  800753:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800758:	c3                   	ret
+        return -E_INVAL;
+  800759:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80075e:	eb ee                	jmp    80074e <fd_lookup+0x39>
+
+0000000000800760 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800760:	55                   	push   %rbp
+  800761:	48 89 e5             	mov    %rsp,%rbp
+  800764:	41 54                	push   %r12
+  800766:	53                   	push   %rbx
+  800767:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80076a:	48 b8 80 47 80 00 00 	movabs $0x804780,%rax
+  800771:	00 00 00 
+  800774:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80077b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80077e:	39 3b                	cmp    %edi,(%rbx)
+  800780:	74 47                	je     8007c9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800782:	48 83 c0 08          	add    $0x8,%rax
+  800786:	48 8b 18             	mov    (%rax),%rbx
+  800789:	48 85 db             	test   %rbx,%rbx
+  80078c:	75 f0                	jne    80077e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80078e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800795:	00 00 00 
+  800798:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80079e:	89 fa                	mov    %edi,%edx
+  8007a0:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  8007a7:	00 00 00 
+  8007aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007af:	48 b9 c2 34 80 00 00 	movabs $0x8034c2,%rcx
+  8007b6:	00 00 00 
+  8007b9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007c0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007c4:	5b                   	pop    %rbx
+  8007c5:	41 5c                	pop    %r12
+  8007c7:	5d                   	pop    %rbp
+  8007c8:	c3                   	ret
+            return 0;
+  8007c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ce:	eb f0                	jmp    8007c0 <dev_lookup+0x60>
+
+00000000008007d0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007d0:	55                   	push   %rbp
+  8007d1:	48 89 e5             	mov    %rsp,%rbp
+  8007d4:	41 55                	push   %r13
+  8007d6:	41 54                	push   %r12
+  8007d8:	53                   	push   %rbx
+  8007d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8007dd:	48 89 fb             	mov    %rdi,%rbx
+  8007e0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007e3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007ea:	ff ff ff 
+  8007ed:	48 01 df             	add    %rbx,%rdi
+  8007f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007f8:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  8007ff:	00 00 00 
+  800802:	ff d0                	call   *%rax
+  800804:	41 89 c5             	mov    %eax,%r13d
+  800807:	85 c0                	test   %eax,%eax
+  800809:	78 06                	js     800811 <fd_close+0x41>
+  80080b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80080f:	74 1a                	je     80082b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800811:	45 84 e4             	test   %r12b,%r12b
+  800814:	b8 00 00 00 00       	mov    $0x0,%eax
+  800819:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80081d:	44 89 e8             	mov    %r13d,%eax
+  800820:	48 83 c4 18          	add    $0x18,%rsp
+  800824:	5b                   	pop    %rbx
+  800825:	41 5c                	pop    %r12
+  800827:	41 5d                	pop    %r13
+  800829:	5d                   	pop    %rbp
+  80082a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80082b:	8b 3b                	mov    (%rbx),%edi
+  80082d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800831:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800838:	00 00 00 
+  80083b:	ff d0                	call   *%rax
+  80083d:	41 89 c5             	mov    %eax,%r13d
+  800840:	85 c0                	test   %eax,%eax
+  800842:	78 1b                	js     80085f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800844:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800848:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80084c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800852:	48 85 c0             	test   %rax,%rax
+  800855:	74 08                	je     80085f <fd_close+0x8f>
+  800857:	48 89 df             	mov    %rbx,%rdi
+  80085a:	ff d0                	call   *%rax
+  80085c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80085f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800864:	48 89 de             	mov    %rbx,%rsi
+  800867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80086c:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  800873:	00 00 00 
+  800876:	ff d0                	call   *%rax
+    return res;
+  800878:	eb a3                	jmp    80081d <fd_close+0x4d>
+
+000000000080087a <close>:
+
+int
+close(int fdnum) {
+  80087a:	55                   	push   %rbp
+  80087b:	48 89 e5             	mov    %rsp,%rbp
+  80087e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800882:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800886:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  80088d:	00 00 00 
+  800890:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800892:	85 c0                	test   %eax,%eax
+  800894:	78 15                	js     8008ab <close+0x31>
+
+    return fd_close(fd, 1);
+  800896:	be 01 00 00 00       	mov    $0x1,%esi
+  80089b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80089f:	48 b8 d0 07 80 00 00 	movabs $0x8007d0,%rax
+  8008a6:	00 00 00 
+  8008a9:	ff d0                	call   *%rax
+}
+  8008ab:	c9                   	leave
+  8008ac:	c3                   	ret
+
+00000000008008ad <close_all>:
+
+void
+close_all(void) {
+  8008ad:	55                   	push   %rbp
+  8008ae:	48 89 e5             	mov    %rsp,%rbp
+  8008b1:	41 54                	push   %r12
+  8008b3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008b9:	49 bc 7a 08 80 00 00 	movabs $0x80087a,%r12
+  8008c0:	00 00 00 
+  8008c3:	89 df                	mov    %ebx,%edi
+  8008c5:	41 ff d4             	call   *%r12
+  8008c8:	83 c3 01             	add    $0x1,%ebx
+  8008cb:	83 fb 20             	cmp    $0x20,%ebx
+  8008ce:	75 f3                	jne    8008c3 <close_all+0x16>
+}
+  8008d0:	5b                   	pop    %rbx
+  8008d1:	41 5c                	pop    %r12
+  8008d3:	5d                   	pop    %rbp
+  8008d4:	c3                   	ret
+
+00000000008008d5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008d5:	55                   	push   %rbp
+  8008d6:	48 89 e5             	mov    %rsp,%rbp
+  8008d9:	41 57                	push   %r15
+  8008db:	41 56                	push   %r14
+  8008dd:	41 55                	push   %r13
+  8008df:	41 54                	push   %r12
+  8008e1:	53                   	push   %rbx
+  8008e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8008e6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008e9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008ed:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  8008f4:	00 00 00 
+  8008f7:	ff d0                	call   *%rax
+  8008f9:	89 c3                	mov    %eax,%ebx
+  8008fb:	85 c0                	test   %eax,%eax
+  8008fd:	0f 88 b8 00 00 00    	js     8009bb <dup+0xe6>
+    close(newfdnum);
+  800903:	44 89 e7             	mov    %r12d,%edi
+  800906:	48 b8 7a 08 80 00 00 	movabs $0x80087a,%rax
+  80090d:	00 00 00 
+  800910:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800912:	4d 63 ec             	movslq %r12d,%r13
+  800915:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80091c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800920:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800924:	4c 89 ff             	mov    %r15,%rdi
+  800927:	49 be 99 06 80 00 00 	movabs $0x800699,%r14
+  80092e:	00 00 00 
+  800931:	41 ff d6             	call   *%r14
+  800934:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800937:	4c 89 ef             	mov    %r13,%rdi
+  80093a:	41 ff d6             	call   *%r14
+  80093d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800940:	48 89 df             	mov    %rbx,%rdi
+  800943:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  80094a:	00 00 00 
+  80094d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80094f:	a8 04                	test   $0x4,%al
+  800951:	74 2b                	je     80097e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800953:	41 89 c1             	mov    %eax,%r9d
+  800956:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80095c:	4c 89 f1             	mov    %r14,%rcx
+  80095f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800964:	48 89 de             	mov    %rbx,%rsi
+  800967:	bf 00 00 00 00       	mov    $0x0,%edi
+  80096c:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  800973:	00 00 00 
+  800976:	ff d0                	call   *%rax
+  800978:	89 c3                	mov    %eax,%ebx
+  80097a:	85 c0                	test   %eax,%eax
+  80097c:	78 4e                	js     8009cc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80097e:	4c 89 ff             	mov    %r15,%rdi
+  800981:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  800988:	00 00 00 
+  80098b:	ff d0                	call   *%rax
+  80098d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800990:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800996:	4c 89 e9             	mov    %r13,%rcx
+  800999:	ba 00 00 00 00       	mov    $0x0,%edx
+  80099e:	4c 89 fe             	mov    %r15,%rsi
+  8009a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009a6:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  8009ad:	00 00 00 
+  8009b0:	ff d0                	call   *%rax
+  8009b2:	89 c3                	mov    %eax,%ebx
+  8009b4:	85 c0                	test   %eax,%eax
+  8009b6:	78 14                	js     8009cc <dup+0xf7>
+
+    return newfdnum;
+  8009b8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009bb:	89 d8                	mov    %ebx,%eax
+  8009bd:	48 83 c4 18          	add    $0x18,%rsp
+  8009c1:	5b                   	pop    %rbx
+  8009c2:	41 5c                	pop    %r12
+  8009c4:	41 5d                	pop    %r13
+  8009c6:	41 5e                	pop    %r14
+  8009c8:	41 5f                	pop    %r15
+  8009ca:	5d                   	pop    %rbp
+  8009cb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d1:	4c 89 ee             	mov    %r13,%rsi
+  8009d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d9:	49 bc fa 02 80 00 00 	movabs $0x8002fa,%r12
+  8009e0:	00 00 00 
+  8009e3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009eb:	4c 89 f6             	mov    %r14,%rsi
+  8009ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f3:	41 ff d4             	call   *%r12
+    return res;
+  8009f6:	eb c3                	jmp    8009bb <dup+0xe6>
+
+00000000008009f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009f8:	55                   	push   %rbp
+  8009f9:	48 89 e5             	mov    %rsp,%rbp
+  8009fc:	41 56                	push   %r14
+  8009fe:	41 55                	push   %r13
+  800a00:	41 54                	push   %r12
+  800a02:	53                   	push   %rbx
+  800a03:	48 83 ec 10          	sub    $0x10,%rsp
+  800a07:	89 fb                	mov    %edi,%ebx
+  800a09:	49 89 f4             	mov    %rsi,%r12
+  800a0c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a0f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a13:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800a1a:	00 00 00 
+  800a1d:	ff d0                	call   *%rax
+  800a1f:	85 c0                	test   %eax,%eax
+  800a21:	78 4c                	js     800a6f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a23:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a27:	41 8b 3e             	mov    (%r14),%edi
+  800a2a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a2e:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800a35:	00 00 00 
+  800a38:	ff d0                	call   *%rax
+  800a3a:	85 c0                	test   %eax,%eax
+  800a3c:	78 35                	js     800a73 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a3e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a42:	83 e0 03             	and    $0x3,%eax
+  800a45:	83 f8 01             	cmp    $0x1,%eax
+  800a48:	74 2d                	je     800a77 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a4a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a4e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a52:	48 85 c0             	test   %rax,%rax
+  800a55:	74 56                	je     800aad <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a57:	4c 89 ea             	mov    %r13,%rdx
+  800a5a:	4c 89 e6             	mov    %r12,%rsi
+  800a5d:	4c 89 f7             	mov    %r14,%rdi
+  800a60:	ff d0                	call   *%rax
+}
+  800a62:	48 83 c4 10          	add    $0x10,%rsp
+  800a66:	5b                   	pop    %rbx
+  800a67:	41 5c                	pop    %r12
+  800a69:	41 5d                	pop    %r13
+  800a6b:	41 5e                	pop    %r14
+  800a6d:	5d                   	pop    %rbp
+  800a6e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a6f:	48 98                	cltq
+  800a71:	eb ef                	jmp    800a62 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a73:	48 98                	cltq
+  800a75:	eb eb                	jmp    800a62 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a77:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a7e:	00 00 00 
+  800a81:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a87:	89 da                	mov    %ebx,%edx
+  800a89:	48 bf 29 47 80 00 00 	movabs $0x804729,%rdi
+  800a90:	00 00 00 
+  800a93:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a98:	48 b9 c2 34 80 00 00 	movabs $0x8034c2,%rcx
+  800a9f:	00 00 00 
+  800aa2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800aa4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800aab:	eb b5                	jmp    800a62 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aad:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800ab4:	eb ac                	jmp    800a62 <read+0x6a>
+
+0000000000800ab6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ab6:	55                   	push   %rbp
+  800ab7:	48 89 e5             	mov    %rsp,%rbp
+  800aba:	41 57                	push   %r15
+  800abc:	41 56                	push   %r14
+  800abe:	41 55                	push   %r13
+  800ac0:	41 54                	push   %r12
+  800ac2:	53                   	push   %rbx
+  800ac3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ac7:	48 85 d2             	test   %rdx,%rdx
+  800aca:	74 54                	je     800b20 <readn+0x6a>
+  800acc:	41 89 fd             	mov    %edi,%r13d
+  800acf:	49 89 f6             	mov    %rsi,%r14
+  800ad2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ad5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ada:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800adf:	49 bf f8 09 80 00 00 	movabs $0x8009f8,%r15
+  800ae6:	00 00 00 
+  800ae9:	4c 89 e2             	mov    %r12,%rdx
+  800aec:	48 29 f2             	sub    %rsi,%rdx
+  800aef:	4c 01 f6             	add    %r14,%rsi
+  800af2:	44 89 ef             	mov    %r13d,%edi
+  800af5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800af8:	85 c0                	test   %eax,%eax
+  800afa:	78 20                	js     800b1c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800afc:	01 c3                	add    %eax,%ebx
+  800afe:	85 c0                	test   %eax,%eax
+  800b00:	74 08                	je     800b0a <readn+0x54>
+  800b02:	48 63 f3             	movslq %ebx,%rsi
+  800b05:	4c 39 e6             	cmp    %r12,%rsi
+  800b08:	72 df                	jb     800ae9 <readn+0x33>
+    }
+    return res;
+  800b0a:	48 63 c3             	movslq %ebx,%rax
+}
+  800b0d:	48 83 c4 08          	add    $0x8,%rsp
+  800b11:	5b                   	pop    %rbx
+  800b12:	41 5c                	pop    %r12
+  800b14:	41 5d                	pop    %r13
+  800b16:	41 5e                	pop    %r14
+  800b18:	41 5f                	pop    %r15
+  800b1a:	5d                   	pop    %rbp
+  800b1b:	c3                   	ret
+        if (inc < 0) return inc;
+  800b1c:	48 98                	cltq
+  800b1e:	eb ed                	jmp    800b0d <readn+0x57>
+    int inc = 1, res = 0;
+  800b20:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b25:	eb e3                	jmp    800b0a <readn+0x54>
+
+0000000000800b27 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b27:	55                   	push   %rbp
+  800b28:	48 89 e5             	mov    %rsp,%rbp
+  800b2b:	41 56                	push   %r14
+  800b2d:	41 55                	push   %r13
+  800b2f:	41 54                	push   %r12
+  800b31:	53                   	push   %rbx
+  800b32:	48 83 ec 10          	sub    $0x10,%rsp
+  800b36:	89 fb                	mov    %edi,%ebx
+  800b38:	49 89 f4             	mov    %rsi,%r12
+  800b3b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b3e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b42:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800b49:	00 00 00 
+  800b4c:	ff d0                	call   *%rax
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	78 47                	js     800b99 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b52:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b56:	41 8b 3e             	mov    (%r14),%edi
+  800b59:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b5d:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800b64:	00 00 00 
+  800b67:	ff d0                	call   *%rax
+  800b69:	85 c0                	test   %eax,%eax
+  800b6b:	78 30                	js     800b9d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b6d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b72:	74 2d                	je     800ba1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b78:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b7c:	48 85 c0             	test   %rax,%rax
+  800b7f:	74 56                	je     800bd7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b81:	4c 89 ea             	mov    %r13,%rdx
+  800b84:	4c 89 e6             	mov    %r12,%rsi
+  800b87:	4c 89 f7             	mov    %r14,%rdi
+  800b8a:	ff d0                	call   *%rax
+}
+  800b8c:	48 83 c4 10          	add    $0x10,%rsp
+  800b90:	5b                   	pop    %rbx
+  800b91:	41 5c                	pop    %r12
+  800b93:	41 5d                	pop    %r13
+  800b95:	41 5e                	pop    %r14
+  800b97:	5d                   	pop    %rbp
+  800b98:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b99:	48 98                	cltq
+  800b9b:	eb ef                	jmp    800b8c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b9d:	48 98                	cltq
+  800b9f:	eb eb                	jmp    800b8c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800ba1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ba8:	00 00 00 
+  800bab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800bb1:	89 da                	mov    %ebx,%edx
+  800bb3:	48 bf 45 47 80 00 00 	movabs $0x804745,%rdi
+  800bba:	00 00 00 
+  800bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bc2:	48 b9 c2 34 80 00 00 	movabs $0x8034c2,%rcx
+  800bc9:	00 00 00 
+  800bcc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bd5:	eb b5                	jmp    800b8c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bd7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bde:	eb ac                	jmp    800b8c <write+0x65>
+
+0000000000800be0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800be0:	55                   	push   %rbp
+  800be1:	48 89 e5             	mov    %rsp,%rbp
+  800be4:	41 54                	push   %r12
+  800be6:	53                   	push   %rbx
+  800be7:	48 83 ec 10          	sub    $0x10,%rsp
+  800beb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bf1:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800bf8:	00 00 00 
+  800bfb:	ff d0                	call   *%rax
+  800bfd:	85 c0                	test   %eax,%eax
+  800bff:	78 3e                	js     800c3f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c01:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c05:	41 8b 3c 24          	mov    (%r12),%edi
+  800c09:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c0d:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800c14:	00 00 00 
+  800c17:	ff d0                	call   *%rax
+  800c19:	85 c0                	test   %eax,%eax
+  800c1b:	78 22                	js     800c3f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c21:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c25:	48 85 c0             	test   %rax,%rax
+  800c28:	74 0b                	je     800c35 <seek+0x55>
+  800c2a:	89 de                	mov    %ebx,%esi
+  800c2c:	4c 89 e7             	mov    %r12,%rdi
+  800c2f:	ff d0                	call   *%rax
+  800c31:	85 c0                	test   %eax,%eax
+  800c33:	78 0a                	js     800c3f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c35:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c3f:	48 83 c4 10          	add    $0x10,%rsp
+  800c43:	5b                   	pop    %rbx
+  800c44:	41 5c                	pop    %r12
+  800c46:	5d                   	pop    %rbp
+  800c47:	c3                   	ret
+
+0000000000800c48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	41 55                	push   %r13
+  800c4e:	41 54                	push   %r12
+  800c50:	53                   	push   %rbx
+  800c51:	48 83 ec 18          	sub    $0x18,%rsp
+  800c55:	89 fb                	mov    %edi,%ebx
+  800c57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c5e:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800c65:	00 00 00 
+  800c68:	ff d0                	call   *%rax
+  800c6a:	85 c0                	test   %eax,%eax
+  800c6c:	78 38                	js     800ca6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c7a:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800c81:	00 00 00 
+  800c84:	ff d0                	call   *%rax
+  800c86:	85 c0                	test   %eax,%eax
+  800c88:	78 1c                	js     800ca6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c8f:	74 20                	je     800cb1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c95:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c99:	48 85 c0             	test   %rax,%rax
+  800c9c:	74 47                	je     800ce5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c9e:	44 89 e6             	mov    %r12d,%esi
+  800ca1:	4c 89 ef             	mov    %r13,%rdi
+  800ca4:	ff d0                	call   *%rax
+}
+  800ca6:	48 83 c4 18          	add    $0x18,%rsp
+  800caa:	5b                   	pop    %rbx
+  800cab:	41 5c                	pop    %r12
+  800cad:	41 5d                	pop    %r13
+  800caf:	5d                   	pop    %rbp
+  800cb0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cb1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800cb8:	00 00 00 
+  800cbb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cc1:	89 da                	mov    %ebx,%edx
+  800cc3:	48 bf 08 47 80 00 00 	movabs $0x804708,%rdi
+  800cca:	00 00 00 
+  800ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd2:	48 b9 c2 34 80 00 00 	movabs $0x8034c2,%rcx
+  800cd9:	00 00 00 
+  800cdc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ce3:	eb c1                	jmp    800ca6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ce5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800cea:	eb ba                	jmp    800ca6 <ftruncate+0x5e>
+
+0000000000800cec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cec:	55                   	push   %rbp
+  800ced:	48 89 e5             	mov    %rsp,%rbp
+  800cf0:	41 54                	push   %r12
+  800cf2:	53                   	push   %rbx
+  800cf3:	48 83 ec 10          	sub    $0x10,%rsp
+  800cf7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cfa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cfe:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  800d05:	00 00 00 
+  800d08:	ff d0                	call   *%rax
+  800d0a:	85 c0                	test   %eax,%eax
+  800d0c:	78 4e                	js     800d5c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d0e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d12:	41 8b 3c 24          	mov    (%r12),%edi
+  800d16:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d1a:	48 b8 60 07 80 00 00 	movabs $0x800760,%rax
+  800d21:	00 00 00 
+  800d24:	ff d0                	call   *%rax
+  800d26:	85 c0                	test   %eax,%eax
+  800d28:	78 32                	js     800d5c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d2e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d33:	74 30                	je     800d65 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d35:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d3f:	00 00 00 
+    stat->st_isdir = 0;
+  800d42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d49:	00 00 00 
+    stat->st_dev = dev;
+  800d4c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d53:	48 89 de             	mov    %rbx,%rsi
+  800d56:	4c 89 e7             	mov    %r12,%rdi
+  800d59:	ff 50 28             	call   *0x28(%rax)
+}
+  800d5c:	48 83 c4 10          	add    $0x10,%rsp
+  800d60:	5b                   	pop    %rbx
+  800d61:	41 5c                	pop    %r12
+  800d63:	5d                   	pop    %rbp
+  800d64:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d6a:	eb f0                	jmp    800d5c <fstat+0x70>
+
+0000000000800d6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d6c:	55                   	push   %rbp
+  800d6d:	48 89 e5             	mov    %rsp,%rbp
+  800d70:	41 54                	push   %r12
+  800d72:	53                   	push   %rbx
+  800d73:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d76:	be 00 00 00 00       	mov    $0x0,%esi
+  800d7b:	48 b8 da 1e 80 00 00 	movabs $0x801eda,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+  800d87:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d89:	85 c0                	test   %eax,%eax
+  800d8b:	78 25                	js     800db2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d8d:	4c 89 e6             	mov    %r12,%rsi
+  800d90:	89 c7                	mov    %eax,%edi
+  800d92:	48 b8 ec 0c 80 00 00 	movabs $0x800cec,%rax
+  800d99:	00 00 00 
+  800d9c:	ff d0                	call   *%rax
+  800d9e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800da1:	89 df                	mov    %ebx,%edi
+  800da3:	48 b8 7a 08 80 00 00 	movabs $0x80087a,%rax
+  800daa:	00 00 00 
+  800dad:	ff d0                	call   *%rax
+
+    return res;
+  800daf:	44 89 e3             	mov    %r12d,%ebx
+}
+  800db2:	89 d8                	mov    %ebx,%eax
+  800db4:	5b                   	pop    %rbx
+  800db5:	41 5c                	pop    %r12
+  800db7:	5d                   	pop    %rbp
+  800db8:	c3                   	ret
+
+0000000000800db9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800db9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800dc0:	00 00 00 
+  800dc3:	83 38 00             	cmpl   $0x0,(%rax)
+  800dc6:	74 0a                	je     800dd2 <fsenv+0x19>
+    return envid;
+}
+  800dc8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dcf:	00 00 
+  800dd1:	c3                   	ret
+fsenv(void) {
+  800dd2:	55                   	push   %rbp
+  800dd3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dd6:	bf 03 00 00 00       	mov    $0x3,%edi
+  800ddb:	48 b8 43 46 80 00 00 	movabs $0x804643,%rax
+  800de2:	00 00 00 
+  800de5:	ff d0                	call   *%rax
+  800de7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dee:	00 00 
+}
+  800df0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800df7:	00 00 
+  800df9:	5d                   	pop    %rbp
+  800dfa:	c3                   	ret
+
+0000000000800dfb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800dfb:	55                   	push   %rbp
+  800dfc:	48 89 e5             	mov    %rsp,%rbp
+  800dff:	41 54                	push   %r12
+  800e01:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800e02:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e07:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e0c:	48 89 de             	mov    %rbx,%rsi
+  800e0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e14:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  800e1b:	00 00 00 
+  800e1e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e20:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e27:	00 00 00 
+  800e2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e35:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e3a:	48 89 de             	mov    %rbx,%rsi
+  800e3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e42:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  800e49:	00 00 00 
+  800e4c:	ff d0                	call   *%rax
+  800e4e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e50:	85 c0                	test   %eax,%eax
+  800e52:	0f 88 a2 00 00 00    	js     800efa <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e58:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e5f:	00 00 00 
+  800e62:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e68:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e6d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e6f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e74:	49 bc 0c 30 80 00 00 	movabs $0x80300c,%r12
+  800e7b:	00 00 00 
+  800e7e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e81:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e86:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e89:	48 b8 b9 0d 80 00 00 	movabs $0x800db9,%rax
+  800e90:	00 00 00 
+  800e93:	ff d0                	call   *%rax
+  800e95:	89 c7                	mov    %eax,%edi
+  800e97:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e9d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800ea2:	48 89 da             	mov    %rbx,%rdx
+  800ea5:	be 09 00 00 00       	mov    $0x9,%esi
+  800eaa:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800eb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ebb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec0:	be 00 00 00 00       	mov    $0x0,%esi
+  800ec5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eca:	48 b8 c9 45 80 00 00 	movabs $0x8045c9,%rax
+  800ed1:	00 00 00 
+  800ed4:	ff d0                	call   *%rax
+  800ed6:	89 c3                	mov    %eax,%ebx
+  800ed8:	85 c0                	test   %eax,%eax
+  800eda:	78 25                	js     800f01 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800edc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ee3:	00 00 00 
+  800ee6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800eec:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ef3:	00 00 
+    return 0;
+  800ef5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800efa:	89 d8                	mov    %ebx,%eax
+  800efc:	5b                   	pop    %rbx
+  800efd:	41 5c                	pop    %r12
+  800eff:	5d                   	pop    %rbp
+  800f00:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800f01:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f06:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f10:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  800f17:	00 00 00 
+  800f1a:	ff d0                	call   *%rax
+        return res;
+  800f1c:	eb dc                	jmp    800efa <fschan_setup+0xff>
+
+0000000000800f1e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f1e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f25:	00 00 00 
+  800f28:	80 38 00             	cmpb   $0x0,(%rax)
+  800f2b:	74 55                	je     800f82 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f2d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f34:	00 00 00 
+  800f37:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f3d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f42:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f49:	00 00 00 
+  800f4c:	3b 0a                	cmp    (%rdx),%ecx
+  800f4e:	75 01                	jne    800f51 <fschan+0x33>
+}
+  800f50:	c3                   	ret
+fschan(void) {
+  800f51:	55                   	push   %rbp
+  800f52:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f55:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  800f5c:	00 00 00 
+  800f5f:	ff d0                	call   *%rax
+  800f61:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f63:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f68:	85 d2                	test   %edx,%edx
+  800f6a:	78 02                	js     800f6e <fschan+0x50>
+}
+  800f6c:	5d                   	pop    %rbp
+  800f6d:	c3                   	ret
+        fschan_enabled = 0;
+  800f6e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f75:	00 00 00 
+  800f78:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f80:	eb ea                	jmp    800f6c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f82:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f87:	c3                   	ret
+
+0000000000800f88 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f88:	55                   	push   %rbp
+  800f89:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f8c:	48 b8 87 06 80 00 00 	movabs $0x800687,%rax
+  800f93:	00 00 00 
+  800f96:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f98:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f9d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800fa1:	77 12                	ja     800fb5 <fbuf+0x2d>
+  800fa3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800fa7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800fae:	00 00 00 
+  800fb1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fb5:	48 89 d0             	mov    %rdx,%rax
+  800fb8:	5d                   	pop    %rbp
+  800fb9:	c3                   	ret
+
+0000000000800fba <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fba:	55                   	push   %rbp
+  800fbb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fbe:	48 83 c7 40          	add    $0x40,%rdi
+  800fc2:	48 b8 46 30 80 00 00 	movabs $0x803046,%rax
+  800fc9:	00 00 00 
+  800fcc:	ff d0                	call   *%rax
+  800fce:	84 c0                	test   %al,%al
+  800fd0:	75 02                	jne    800fd4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fd2:	5d                   	pop    %rbp
+  800fd3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fd4:	48 b8 b9 0d 80 00 00 	movabs $0x800db9,%rax
+  800fdb:	00 00 00 
+  800fde:	ff d0                	call   *%rax
+  800fe0:	89 c7                	mov    %eax,%edi
+  800fe2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff2:	be 0a 00 00 00       	mov    $0xa,%esi
+  800ff7:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  800ffe:	00 00 00 
+  801001:	ff d0                	call   *%rax
+}
+  801003:	eb cd                	jmp    800fd2 <fschan_publish+0x18>
+
+0000000000801005 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801005:	55                   	push   %rbp
+  801006:	48 89 e5             	mov    %rsp,%rbp
+  801009:	41 57                	push   %r15
+  80100b:	41 56                	push   %r14
+  80100d:	41 55                	push   %r13
+  80100f:	41 54                	push   %r12
+  801011:	53                   	push   %rbx
+  801012:	48 83 ec 48          	sub    $0x48,%rsp
+  801016:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80101a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80101e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801021:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801025:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801028:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80102f:	00 00 00 
+  801032:	8b 02                	mov    (%rdx),%eax
+  801034:	83 c0 01             	add    $0x1,%eax
+  801037:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80103c:	0f 44 c1             	cmove  %ecx,%eax
+  80103f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801041:	4d 85 c0             	test   %r8,%r8
+  801044:	74 2c                	je     801072 <fschan_rw+0x6d>
+  801046:	45 89 ce             	mov    %r9d,%r14d
+  801049:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801050:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801054:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80105a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801061:	00 
+  801062:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801068:	b8 01 00 00 00       	mov    $0x1,%eax
+  80106d:	e9 41 01 00 00       	jmp    8011b3 <fschan_rw+0x1ae>
+  801072:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801076:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80107a:	e9 9c 01 00 00       	jmp    80121b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80107f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801083:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801086:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801089:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80108c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801090:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801094:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801098:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80109c:	48 89 da             	mov    %rbx,%rdx
+  80109f:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  8010a6:	00 00 00 
+  8010a9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8010ab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8010af:	48 b8 ba 0f 80 00 00 	movabs $0x800fba,%rax
+  8010b6:	00 00 00 
+  8010b9:	ff d0                	call   *%rax
+            queued += blk;
+  8010bb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010be:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010c2:	4d 39 fc             	cmp    %r15,%r12
+  8010c5:	73 6b                	jae    801132 <fschan_rw+0x12d>
+  8010c7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010cb:	77 65                	ja     801132 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010d1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010d5:	48 b8 21 30 80 00 00 	movabs $0x803021,%rax
+  8010dc:	00 00 00 
+  8010df:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010e1:	4c 89 fb             	mov    %r15,%rbx
+  8010e4:	4c 29 e3             	sub    %r12,%rbx
+  8010e7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010ec:	48 39 d3             	cmp    %rdx,%rbx
+  8010ef:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010f3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010f7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010fb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010ff:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801102:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801104:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80110b:	00 00 00 
+  80110e:	8b 09                	mov    (%rcx),%ecx
+  801110:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801113:	83 fe 03             	cmp    $0x3,%esi
+  801116:	0f 85 63 ff ff ff    	jne    80107f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80111c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801120:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801123:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801126:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801129:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80112d:	e9 79 ff ff ff       	jmp    8010ab <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801132:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801136:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80113d:	48 89 df             	mov    %rbx,%rdi
+  801140:	48 b8 e4 30 80 00 00 	movabs $0x8030e4,%rax
+  801147:	00 00 00 
+  80114a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80114c:	48 89 df             	mov    %rbx,%rdi
+  80114f:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  801156:	00 00 00 
+  801159:	ff d0                	call   *%rax
+  80115b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80115f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801163:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801167:	75 25                	jne    80118e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801169:	8b 40 04             	mov    0x4(%rax),%eax
+  80116c:	85 c0                	test   %eax,%eax
+  80116e:	0f 88 86 00 00 00    	js     8011fa <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801174:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801178:	74 5b                	je     8011d5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80117a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80117e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801182:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801186:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80118a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80118e:	48 89 df             	mov    %rbx,%rdi
+  801191:	48 b8 99 30 80 00 00 	movabs $0x803099,%rax
+  801198:	00 00 00 
+  80119b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80119d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8011a1:	83 f0 01             	xor    $0x1,%eax
+  8011a4:	4d 39 fc             	cmp    %r15,%r12
+  8011a7:	0f 92 c2             	setb   %dl
+  8011aa:	84 c2                	test   %al,%dl
+  8011ac:	75 05                	jne    8011b3 <fschan_rw+0x1ae>
+  8011ae:	45 85 ed             	test   %r13d,%r13d
+  8011b1:	74 50                	je     801203 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011b3:	4d 39 fc             	cmp    %r15,%r12
+  8011b6:	0f 92 c1             	setb   %cl
+  8011b9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011bd:	0f 96 c2             	setbe  %dl
+  8011c0:	84 d1                	test   %dl,%cl
+  8011c2:	0f 84 6a ff ff ff    	je     801132 <fschan_rw+0x12d>
+  8011c8:	84 c0                	test   %al,%al
+  8011ca:	0f 85 fd fe ff ff    	jne    8010cd <fschan_rw+0xc8>
+  8011d0:	e9 5d ff ff ff       	jmp    801132 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011d5:	48 63 d0             	movslq %eax,%rdx
+  8011d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011dc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011e0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011e4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011e8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011ec:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  8011f3:	00 00 00 
+  8011f6:	ff d0                	call   *%rax
+  8011f8:	eb 80                	jmp    80117a <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011fa:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011fd:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  801201:	eb 8b                	jmp    80118e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  801203:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  801208:	0f 85 68 fe ff ff    	jne    801076 <fschan_rw+0x71>
+  80120e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  801211:	85 c0                	test   %eax,%eax
+  801213:	0f 84 5d fe ff ff    	je     801076 <fschan_rw+0x71>
+  801219:	48 98                	cltq
+}
+  80121b:	48 83 c4 48          	add    $0x48,%rsp
+  80121f:	5b                   	pop    %rbx
+  801220:	41 5c                	pop    %r12
+  801222:	41 5d                	pop    %r13
+  801224:	41 5e                	pop    %r14
+  801226:	41 5f                	pop    %r15
+  801228:	5d                   	pop    %rbp
+  801229:	c3                   	ret
+
+000000000080122a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80122a:	55                   	push   %rbp
+  80122b:	48 89 e5             	mov    %rsp,%rbp
+  80122e:	41 56                	push   %r14
+  801230:	41 55                	push   %r13
+  801232:	41 54                	push   %r12
+  801234:	53                   	push   %rbx
+  801235:	48 83 ec 10          	sub    $0x10,%rsp
+  801239:	49 89 fe             	mov    %rdi,%r14
+  80123c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80123f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801243:	48 29 f3             	sub    %rsi,%rbx
+  801246:	48 39 d3             	cmp    %rdx,%rbx
+  801249:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80124d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801254:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801255:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80125a:	49 bd a3 2e 80 00 00 	movabs $0x802ea3,%r13
+  801261:	00 00 00 
+  801264:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80126b:	76 1e                	jbe    80128b <mmap_fault+0x61>
+  80126d:	4c 01 e7             	add    %r12,%rdi
+  801270:	41 ff d5             	call   *%r13
+  801273:	84 c0                	test   %al,%al
+  801275:	75 14                	jne    80128b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801277:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80127b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801282:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801286:	48 39 df             	cmp    %rbx,%rdi
+  801289:	72 e2                	jb     80126d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80128b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801292:	00 00 00 
+  801295:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80129c:	00 00 00 
+  80129f:	4c 89 f0             	mov    %r14,%rax
+  8012a2:	48 29 d0             	sub    %rdx,%rax
+  8012a5:	48 c1 f8 03          	sar    $0x3,%rax
+  8012a9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012b0:	aa aa aa 
+  8012b3:	48 0f af c2          	imul   %rdx,%rax
+  8012b7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012bb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012c0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012c4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012c6:	44 89 e0             	mov    %r12d,%eax
+  8012c9:	41 03 46 10          	add    0x10(%r14),%eax
+  8012cd:	41 2b 06             	sub    (%r14),%eax
+  8012d0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012d7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012db:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012df:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012e2:	48 b8 b9 0d 80 00 00 	movabs $0x800db9,%rax
+  8012e9:	00 00 00 
+  8012ec:	ff d0                	call   *%rax
+  8012ee:	89 c7                	mov    %eax,%edi
+  8012f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012fb:	48 89 da             	mov    %rbx,%rdx
+  8012fe:	be 0f 00 00 00       	mov    $0xf,%esi
+  801303:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  80130a:	00 00 00 
+  80130d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80130f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801314:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801318:	4c 89 e6             	mov    %r12,%rsi
+  80131b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801320:	48 b8 c9 45 80 00 00 	movabs $0x8045c9,%rax
+  801327:	00 00 00 
+  80132a:	ff d0                	call   *%rax
+  80132c:	48 98                	cltq
+}
+  80132e:	48 83 c4 10          	add    $0x10,%rsp
+  801332:	5b                   	pop    %rbx
+  801333:	41 5c                	pop    %r12
+  801335:	41 5d                	pop    %r13
+  801337:	41 5e                	pop    %r14
+  801339:	5d                   	pop    %rbp
+  80133a:	c3                   	ret
+
+000000000080133b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80133b:	48 8b 37             	mov    (%rdi),%rsi
+  80133e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801345:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80134c:	00 00 00 
+  80134f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801354:	eb 0f                	jmp    801365 <mmap_pgfault+0x2a>
+  801356:	c3                   	ret
+  801357:	48 83 c1 01          	add    $0x1,%rcx
+  80135b:	48 83 c2 18          	add    $0x18,%rdx
+  80135f:	48 83 f9 20          	cmp    $0x20,%rcx
+  801363:	74 6e                	je     8013d3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801365:	48 8b 02             	mov    (%rdx),%rax
+  801368:	48 83 e8 01          	sub    $0x1,%rax
+  80136c:	48 39 f0             	cmp    %rsi,%rax
+  80136f:	73 e6                	jae    801357 <mmap_pgfault+0x1c>
+  801371:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801375:	73 e0                	jae    801357 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801377:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80137b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801380:	f6 c2 01             	test   $0x1,%dl
+  801383:	75 d1                	jne    801356 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801385:	f6 c2 02             	test   $0x2,%dl
+  801388:	74 1a                	je     8013a4 <mmap_pgfault+0x69>
+  80138a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80138e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801393:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80139a:	00 00 00 
+  80139d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8013a2:	74 35                	je     8013d9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8013a4:	55                   	push   %rbp
+  8013a5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013a8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013ac:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013b3:	00 00 00 
+  8013b6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013ba:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013bf:	48 b8 2a 12 80 00 00 	movabs $0x80122a,%rax
+  8013c6:	00 00 00 
+  8013c9:	ff d0                	call   *%rax
+  8013cb:	48 85 c0             	test   %rax,%rax
+  8013ce:	0f 9f c0             	setg   %al
+}
+  8013d1:	5d                   	pop    %rbp
+  8013d2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d8:	c3                   	ret
+}
+  8013d9:	c3                   	ret
+
+00000000008013da <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013da:	55                   	push   %rbp
+  8013db:	48 89 e5             	mov    %rsp,%rbp
+  8013de:	41 54                	push   %r12
+  8013e0:	53                   	push   %rbx
+  8013e1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013e4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013eb:	00 00 00 
+  8013ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013f3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013f7:	74 15                	je     80140e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013f9:	48 83 c3 01          	add    $0x1,%rbx
+  8013fd:	48 83 c0 18          	add    $0x18,%rax
+  801401:	48 83 fb 20          	cmp    $0x20,%rbx
+  801405:	75 ec                	jne    8013f3 <mmap_alloc+0x19>
+    return NULL;
+  801407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80140c:	eb 52                	jmp    801460 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80140e:	4c 89 e7             	mov    %r12,%rdi
+  801411:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  801418:	00 00 00 
+  80141b:	ff d0                	call   *%rax
+  80141d:	41 89 c1             	mov    %eax,%r9d
+  801420:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801427:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80142b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801431:	ba 00 00 00 00       	mov    $0x0,%edx
+  801436:	4c 89 e6             	mov    %r12,%rsi
+  801439:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143e:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  801445:	00 00 00 
+  801448:	ff d0                	call   *%rax
+  80144a:	85 c0                	test   %eax,%eax
+  80144c:	78 17                	js     801465 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80144e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801452:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801459:	00 00 00 
+  80145c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801460:	5b                   	pop    %rbx
+  801461:	41 5c                	pop    %r12
+  801463:	5d                   	pop    %rbp
+  801464:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80146a:	eb f4                	jmp    801460 <mmap_alloc+0x86>
+
+000000000080146c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80146c:	55                   	push   %rbp
+  80146d:	48 89 e5             	mov    %rsp,%rbp
+  801470:	41 56                	push   %r14
+  801472:	41 55                	push   %r13
+  801474:	41 54                	push   %r12
+  801476:	53                   	push   %rbx
+  801477:	48 83 ec 10          	sub    $0x10,%rsp
+  80147b:	41 89 fc             	mov    %edi,%r12d
+  80147e:	49 89 f5             	mov    %rsi,%r13
+  801481:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801484:	48 89 f0             	mov    %rsi,%rax
+  801487:	48 09 d0             	or     %rdx,%rax
+  80148a:	75 0d                	jne    801499 <fsipc+0x2d>
+  80148c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80148f:	83 f8 04             	cmp    $0x4,%eax
+  801492:	76 7d                	jbe    801511 <fsipc+0xa5>
+  801494:	83 ff 0d             	cmp    $0xd,%edi
+  801497:	74 78                	je     801511 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  801499:	48 b8 b9 0d 80 00 00 	movabs $0x800db9,%rax
+  8014a0:	00 00 00 
+  8014a3:	ff d0                	call   *%rax
+  8014a5:	89 c7                	mov    %eax,%edi
+  8014a7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8014ae:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014b5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014c2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014c9:	00 00 00 
+  8014cc:	44 89 e6             	mov    %r12d,%esi
+  8014cf:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  8014d6:	00 00 00 
+  8014d9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014db:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014e2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014e8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014ec:	4c 89 ee             	mov    %r13,%rsi
+  8014ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014f4:	48 b8 c9 45 80 00 00 	movabs $0x8045c9,%rax
+  8014fb:	00 00 00 
+  8014fe:	ff d0                	call   *%rax
+  801500:	89 c3                	mov    %eax,%ebx
+}
+  801502:	89 d8                	mov    %ebx,%eax
+  801504:	48 83 c4 10          	add    $0x10,%rsp
+  801508:	5b                   	pop    %rbx
+  801509:	41 5c                	pop    %r12
+  80150b:	41 5d                	pop    %r13
+  80150d:	41 5e                	pop    %r14
+  80150f:	5d                   	pop    %rbp
+  801510:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801511:	48 b8 1e 0f 80 00 00 	movabs $0x800f1e,%rax
+  801518:	00 00 00 
+  80151b:	ff d0                	call   *%rax
+  80151d:	49 89 c6             	mov    %rax,%r14
+  801520:	48 85 c0             	test   %rax,%rax
+  801523:	0f 84 70 ff ff ff    	je     801499 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801529:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80152d:	48 b8 21 30 80 00 00 	movabs $0x803021,%rax
+  801534:	00 00 00 
+  801537:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801539:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80153c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801543:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801547:	ba 10 00 00 00       	mov    $0x10,%edx
+  80154c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801553:	00 00 00 
+  801556:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  80155d:	00 00 00 
+  801560:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801562:	4c 89 f7             	mov    %r14,%rdi
+  801565:	48 b8 ba 0f 80 00 00 	movabs $0x800fba,%rax
+  80156c:	00 00 00 
+  80156f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801571:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801578:	4c 89 f7             	mov    %r14,%rdi
+  80157b:	48 b8 e4 30 80 00 00 	movabs $0x8030e4,%rax
+  801582:	00 00 00 
+  801585:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801587:	4c 89 f7             	mov    %r14,%rdi
+  80158a:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  801591:	00 00 00 
+  801594:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801596:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  801599:	41 83 fc 05          	cmp    $0x5,%r12d
+  80159d:	75 04                	jne    8015a3 <fsipc+0x137>
+  80159f:	85 db                	test   %ebx,%ebx
+  8015a1:	79 14                	jns    8015b7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8015a3:	4c 89 f7             	mov    %r14,%rdi
+  8015a6:	48 b8 99 30 80 00 00 	movabs $0x803099,%rax
+  8015ad:	00 00 00 
+  8015b0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015b2:	e9 4b ff ff ff       	jmp    801502 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015b7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015bb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015c0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015c7:	00 00 00 
+  8015ca:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  8015d1:	00 00 00 
+  8015d4:	ff d0                	call   *%rax
+  8015d6:	eb cb                	jmp    8015a3 <fsipc+0x137>
+
+00000000008015d8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015d8:	55                   	push   %rbp
+  8015d9:	48 89 e5             	mov    %rsp,%rbp
+  8015dc:	41 57                	push   %r15
+  8015de:	41 56                	push   %r14
+  8015e0:	41 55                	push   %r13
+  8015e2:	41 54                	push   %r12
+  8015e4:	53                   	push   %rbx
+  8015e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8015e9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015ed:	49 89 f6             	mov    %rsi,%r14
+  8015f0:	49 89 d4             	mov    %rdx,%r12
+  8015f3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015f6:	48 b8 1e 0f 80 00 00 	movabs $0x800f1e,%rax
+  8015fd:	00 00 00 
+  801600:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801602:	48 85 c0             	test   %rax,%rax
+  801605:	0f 85 96 00 00 00    	jne    8016a1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80160b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801612:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801613:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80161a:	00 00 00 
+    while (n) {
+  80161d:	4d 85 e4             	test   %r12,%r12
+  801620:	74 79                	je     80169b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801622:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801627:	49 39 dc             	cmp    %rbx,%r12
+  80162a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80162e:	48 89 da             	mov    %rbx,%rdx
+  801631:	4c 89 f6             	mov    %r14,%rsi
+  801634:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80163b:	00 00 00 
+  80163e:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  801645:	00 00 00 
+  801648:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80164a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80164e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801651:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801654:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801657:	44 01 e8             	add    %r13d,%eax
+  80165a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80165e:	41 0f 44 c5          	cmove  %r13d,%eax
+  801662:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801666:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80166a:	48 89 da             	mov    %rbx,%rdx
+  80166d:	be 00 00 00 00       	mov    $0x0,%esi
+  801672:	bf 04 00 00 00       	mov    $0x4,%edi
+  801677:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  80167e:	00 00 00 
+  801681:	ff d0                	call   *%rax
+        if (res < 0)
+  801683:	85 c0                	test   %eax,%eax
+  801685:	78 4a                	js     8016d1 <devfile_write_direct+0xf9>
+        buf += res;
+  801687:	48 98                	cltq
+  801689:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80168c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801690:	49 29 c4             	sub    %rax,%r12
+  801693:	75 8d                	jne    801622 <devfile_write_direct+0x4a>
+    return write;
+  801695:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801699:	eb 27                	jmp    8016c2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80169b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80169f:	eb f4                	jmp    801695 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8016a1:	45 89 e9             	mov    %r13d,%r9d
+  8016a4:	4d 89 e0             	mov    %r12,%r8
+  8016a7:	4c 89 f1             	mov    %r14,%rcx
+  8016aa:	ba 04 00 00 00       	mov    $0x4,%edx
+  8016af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016b3:	48 89 c7             	mov    %rax,%rdi
+  8016b6:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8016bd:	00 00 00 
+  8016c0:	ff d0                	call   *%rax
+}
+  8016c2:	48 83 c4 18          	add    $0x18,%rsp
+  8016c6:	5b                   	pop    %rbx
+  8016c7:	41 5c                	pop    %r12
+  8016c9:	41 5d                	pop    %r13
+  8016cb:	41 5e                	pop    %r14
+  8016cd:	41 5f                	pop    %r15
+  8016cf:	5d                   	pop    %rbp
+  8016d0:	c3                   	ret
+            return res;
+  8016d1:	48 98                	cltq
+  8016d3:	eb ed                	jmp    8016c2 <devfile_write_direct+0xea>
+
+00000000008016d5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016d5:	55                   	push   %rbp
+  8016d6:	48 89 e5             	mov    %rsp,%rbp
+  8016d9:	41 54                	push   %r12
+  8016db:	53                   	push   %rbx
+  8016dc:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016df:	48 b8 88 0f 80 00 00 	movabs $0x800f88,%rax
+  8016e6:	00 00 00 
+  8016e9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016eb:	48 85 c0             	test   %rax,%rax
+  8016ee:	74 71                	je     801761 <fbuf_flush+0x8c>
+  8016f0:	48 89 c3             	mov    %rax,%rbx
+  8016f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016fc:	75 05                	jne    801703 <fbuf_flush+0x2e>
+}
+  8016fe:	5b                   	pop    %rbx
+  8016ff:	41 5c                	pop    %r12
+  801701:	5d                   	pop    %rbp
+  801702:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  801703:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801706:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80170a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801711:	00 00 00 
+  801714:	48 89 de             	mov    %rbx,%rsi
+  801717:	48 29 c6             	sub    %rax,%rsi
+  80171a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80171e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801725:	aa aa aa 
+  801728:	48 0f af f0          	imul   %rax,%rsi
+  80172c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801730:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801735:	48 01 c6             	add    %rax,%rsi
+  801738:	4c 89 e7             	mov    %r12,%rdi
+  80173b:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801742:	00 00 00 
+  801745:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801747:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80174b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801752:	00 
+    return res < 0 ? res : 0;
+  801753:	48 85 c0             	test   %rax,%rax
+  801756:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80175f:	eb 9d                	jmp    8016fe <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801761:	b8 00 00 00 00       	mov    $0x0,%eax
+  801766:	eb 96                	jmp    8016fe <fbuf_flush+0x29>
+
+0000000000801768 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801768:	55                   	push   %rbp
+  801769:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80176c:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+}
+  801778:	5d                   	pop    %rbp
+  801779:	c3                   	ret
+
+000000000080177a <devfile_write>:
+    if (!fd || !buf)
+  80177a:	48 85 ff             	test   %rdi,%rdi
+  80177d:	0f 84 d3 01 00 00    	je     801956 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801783:	55                   	push   %rbp
+  801784:	48 89 e5             	mov    %rsp,%rbp
+  801787:	41 57                	push   %r15
+  801789:	41 56                	push   %r14
+  80178b:	41 55                	push   %r13
+  80178d:	41 54                	push   %r12
+  80178f:	53                   	push   %rbx
+  801790:	48 83 ec 08          	sub    $0x8,%rsp
+  801794:	49 89 fc             	mov    %rdi,%r12
+  801797:	49 89 f6             	mov    %rsi,%r14
+  80179a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80179d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8017a2:	48 85 f6             	test   %rsi,%rsi
+  8017a5:	0f 84 9c 01 00 00    	je     801947 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8017ab:	48 b8 88 0f 80 00 00 	movabs $0x800f88,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+  8017b7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017ba:	48 85 c0             	test   %rax,%rax
+  8017bd:	0f 84 a2 00 00 00    	je     801865 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017c8:	4c 89 e7             	mov    %r12,%rdi
+  8017cb:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  8017d2:	00 00 00 
+  8017d5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017d7:	83 f8 02             	cmp    $0x2,%eax
+  8017da:	0f 8f 85 00 00 00    	jg     801865 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017e0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017e7:	00 00 00 
+  8017ea:	4d 89 ef             	mov    %r13,%r15
+  8017ed:	49 29 c7             	sub    %rax,%r15
+  8017f0:	49 c1 ff 03          	sar    $0x3,%r15
+  8017f4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017fb:	aa aa aa 
+  8017fe:	4c 0f af f8          	imul   %rax,%r15
+  801802:	49 c1 e7 0e          	shl    $0xe,%r15
+  801806:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80180b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80180e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801813:	0f 84 d7 00 00 00    	je     8018f0 <devfile_write+0x176>
+  801819:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80181d:	89 c2                	mov    %eax,%edx
+  80181f:	41 03 55 0c          	add    0xc(%r13),%edx
+  801823:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801828:	75 0f                	jne    801839 <devfile_write+0xbf>
+  80182a:	48 01 d8             	add    %rbx,%rax
+  80182d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801833:	0f 86 92 00 00 00    	jbe    8018cb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801839:	4c 89 e7             	mov    %r12,%rdi
+  80183c:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  801843:	00 00 00 
+  801846:	ff d0                	call   *%rax
+  801848:	85 c0                	test   %eax,%eax
+  80184a:	78 52                	js     80189e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80184c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801853:	77 7f                	ja     8018d4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801855:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80185a:	0f 85 c2 00 00 00    	jne    801922 <devfile_write+0x1a8>
+  801860:	e9 94 00 00 00       	jmp    8018f9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801865:	4c 89 e7             	mov    %r12,%rdi
+  801868:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  80186f:	00 00 00 
+  801872:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801874:	85 c0                	test   %eax,%eax
+  801876:	79 07                	jns    80187f <devfile_write+0x105>
+  801878:	48 98                	cltq
+  80187a:	e9 c8 00 00 00       	jmp    801947 <devfile_write+0x1cd>
+  80187f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801884:	48 89 da             	mov    %rbx,%rdx
+  801887:	4c 89 f6             	mov    %r14,%rsi
+  80188a:	4c 89 e7             	mov    %r12,%rdi
+  80188d:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  801894:	00 00 00 
+  801897:	ff d0                	call   *%rax
+  801899:	e9 a9 00 00 00       	jmp    801947 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80189e:	48 98                	cltq
+  8018a0:	e9 a2 00 00 00       	jmp    801947 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018a5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018aa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8018af:	4c 89 fe             	mov    %r15,%rsi
+  8018b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018b7:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  8018be:	00 00 00 
+  8018c1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018c3:	85 c0                	test   %eax,%eax
+  8018c5:	79 45                	jns    80190c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018c7:	48 98                	cltq
+  8018c9:	eb 7c                	jmp    801947 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018cb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018d2:	76 4e                	jbe    801922 <devfile_write+0x1a8>
+  8018d4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018d9:	48 89 da             	mov    %rbx,%rdx
+  8018dc:	4c 89 f6             	mov    %r14,%rsi
+  8018df:	4c 89 e7             	mov    %r12,%rdi
+  8018e2:	48 b8 d8 15 80 00 00 	movabs $0x8015d8,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	eb 57                	jmp    801947 <devfile_write+0x1cd>
+  8018f0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018f7:	77 db                	ja     8018d4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018f9:	4c 89 ff             	mov    %r15,%rdi
+  8018fc:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  801903:	00 00 00 
+  801906:	ff d0                	call   *%rax
+  801908:	84 c0                	test   %al,%al
+  80190a:	74 99                	je     8018a5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80190c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  801911:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801916:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80191a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801921:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801922:	4c 89 ff             	mov    %r15,%rdi
+  801925:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801929:	48 89 da             	mov    %rbx,%rdx
+  80192c:	4c 89 f6             	mov    %r14,%rsi
+  80192f:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80193b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80193f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801944:	48 89 d8             	mov    %rbx,%rax
+}
+  801947:	48 83 c4 08          	add    $0x8,%rsp
+  80194b:	5b                   	pop    %rbx
+  80194c:	41 5c                	pop    %r12
+  80194e:	41 5d                	pop    %r13
+  801950:	41 5e                	pop    %r14
+  801952:	41 5f                	pop    %r15
+  801954:	5d                   	pop    %rbp
+  801955:	c3                   	ret
+        return E_INVAL;
+  801956:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80195b:	c3                   	ret
+
+000000000080195c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80195c:	55                   	push   %rbp
+  80195d:	48 89 e5             	mov    %rsp,%rbp
+  801960:	41 54                	push   %r12
+  801962:	53                   	push   %rbx
+  801963:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801966:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  80196d:	00 00 00 
+  801970:	ff d0                	call   *%rax
+  801972:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801975:	48 89 df             	mov    %rbx,%rdi
+  801978:	48 b8 88 0f 80 00 00 	movabs $0x800f88,%rax
+  80197f:	00 00 00 
+  801982:	ff d0                	call   *%rax
+  801984:	48 85 c0             	test   %rax,%rax
+  801987:	74 17                	je     8019a0 <devfile_flush+0x44>
+  801989:	48 89 df             	mov    %rbx,%rdi
+  80198c:	48 b8 88 0f 80 00 00 	movabs $0x800f88,%rax
+  801993:	00 00 00 
+  801996:	ff d0                	call   *%rax
+  801998:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80199f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019a0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019a3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8019aa:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8019ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019bb:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  8019c2:	00 00 00 
+  8019c5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019c7:	45 85 e4             	test   %r12d,%r12d
+  8019ca:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019ce:	5b                   	pop    %rbx
+  8019cf:	41 5c                	pop    %r12
+  8019d1:	5d                   	pop    %rbp
+  8019d2:	c3                   	ret
+
+00000000008019d3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019d3:	55                   	push   %rbp
+  8019d4:	48 89 e5             	mov    %rsp,%rbp
+  8019d7:	41 57                	push   %r15
+  8019d9:	41 56                	push   %r14
+  8019db:	41 55                	push   %r13
+  8019dd:	41 54                	push   %r12
+  8019df:	53                   	push   %rbx
+  8019e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8019e4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019e8:	49 89 f7             	mov    %rsi,%r15
+  8019eb:	48 89 d3             	mov    %rdx,%rbx
+  8019ee:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019f1:	48 b8 1e 0f 80 00 00 	movabs $0x800f1e,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019fd:	48 85 c0             	test   %rax,%rax
+  801a00:	75 20                	jne    801a22 <devfile_read_direct+0x4f>
+    bool map = 1;
+  801a02:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a07:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a0e:	00 
+    while (n) {
+  801a0f:	48 85 db             	test   %rbx,%rbx
+  801a12:	0f 85 df 00 00 00    	jne    801af7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a18:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a1c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a20:	eb 21                	jmp    801a43 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a22:	45 89 f1             	mov    %r14d,%r9d
+  801a25:	49 89 d8             	mov    %rbx,%r8
+  801a28:	4c 89 f9             	mov    %r15,%rcx
+  801a2b:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a30:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a34:	48 89 c7             	mov    %rax,%rdi
+  801a37:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  801a3e:	00 00 00 
+  801a41:	ff d0                	call   *%rax
+}
+  801a43:	48 83 c4 38          	add    $0x38,%rsp
+  801a47:	5b                   	pop    %rbx
+  801a48:	41 5c                	pop    %r12
+  801a4a:	41 5d                	pop    %r13
+  801a4c:	41 5e                	pop    %r14
+  801a4e:	41 5f                	pop    %r15
+  801a50:	5d                   	pop    %rbp
+  801a51:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a52:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a56:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a5c:	75 1e                	jne    801a7c <devfile_read_direct+0xa9>
+  801a5e:	e9 e2 00 00 00       	jmp    801b45 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a63:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a67:	eb da                	jmp    801a43 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a69:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a6d:	0f 85 d0 01 00 00    	jne    801c43 <devfile_read_direct+0x270>
+            map = 0;
+  801a73:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a77:	eb 03                	jmp    801a7c <devfile_read_direct+0xa9>
+  801a79:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a7c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a81:	48 39 d3             	cmp    %rdx,%rbx
+  801a84:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a88:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a8c:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a8f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a96:	00 00 00 
+  801a99:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a9b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a9f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801aa3:	be 00 00 00 00       	mov    $0x0,%esi
+  801aa8:	bf 03 00 00 00       	mov    $0x3,%edi
+  801aad:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801ab4:	00 00 00 
+  801ab7:	ff d0                	call   *%rax
+        if (res <= 0)
+  801ab9:	85 c0                	test   %eax,%eax
+  801abb:	0f 8e 63 01 00 00    	jle    801c24 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801ac1:	4c 63 e0             	movslq %eax,%r12
+  801ac4:	4c 89 e2             	mov    %r12,%rdx
+  801ac7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ace:	00 00 00 
+  801ad1:	4c 89 ff             	mov    %r15,%rdi
+  801ad4:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  801adb:	00 00 00 
+  801ade:	ff d0                	call   *%rax
+        buf += res;
+  801ae0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ae3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ae6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801aea:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801aee:	48 85 db             	test   %rbx,%rbx
+  801af1:	0f 84 25 ff ff ff    	je     801a1c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801af7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801afa:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801afe:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801b02:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b06:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b0d:	0f 97 c2             	seta   %dl
+  801b10:	20 c2                	and    %al,%dl
+  801b12:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b15:	0f 84 5e ff ff ff    	je     801a79 <devfile_read_direct+0xa6>
+  801b1b:	4c 89 fa             	mov    %r15,%rdx
+  801b1e:	4d 89 fd             	mov    %r15,%r13
+  801b21:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b28:	0f 85 4e ff ff ff    	jne    801a7c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b2e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b32:	0f 84 1a ff ff ff    	je     801a52 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b38:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b3f:	0f 85 37 ff ff ff    	jne    801a7c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b45:	48 89 d8             	mov    %rbx,%rax
+  801b48:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b4e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b53:	48 39 c8             	cmp    %rcx,%rax
+  801b56:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b5a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b5e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b62:	49 89 d4             	mov    %rdx,%r12
+  801b65:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b69:	48 b8 44 2e 80 00 00 	movabs $0x802e44,%rax
+  801b70:	00 00 00 
+  801b73:	ff d0                	call   *%rax
+  801b75:	a8 40                	test   $0x40,%al
+  801b77:	0f 85 b9 00 00 00    	jne    801c36 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b7d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b84:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b88:	49 39 c5             	cmp    %rax,%r13
+  801b8b:	72 d8                	jb     801b65 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b8d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b91:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b98:	00 00 00 
+  801b9b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b9f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801ba2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801ba4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801ba8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801bac:	48 b8 b9 0d 80 00 00 	movabs $0x800db9,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+  801bb8:	89 c7                	mov    %eax,%edi
+  801bba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bc0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bc5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bcc:	00 00 00 
+  801bcf:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bd4:	48 b8 ed 45 80 00 00 	movabs $0x8045ed,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801be0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801be5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801be9:	4c 89 fe             	mov    %r15,%rsi
+  801bec:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf1:	48 b8 c9 45 80 00 00 	movabs $0x8045c9,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+  801bfd:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801c00:	48 85 d2             	test   %rdx,%rdx
+  801c03:	0f 84 5a fe ff ff    	je     801a63 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c09:	0f 8e 5a fe ff ff    	jle    801a69 <devfile_read_direct+0x96>
+                buf += res;
+  801c0f:	48 98                	cltq
+  801c11:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c14:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c17:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c1b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c1f:	e9 ca fe ff ff       	jmp    801aee <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c24:	41 89 c5             	mov    %eax,%r13d
+  801c27:	48 98                	cltq
+  801c29:	45 85 ed             	test   %r13d,%r13d
+  801c2c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c31:	e9 0d fe ff ff       	jmp    801a43 <devfile_read_direct+0x70>
+            map = 0;
+  801c36:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c3a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c3e:	e9 39 fe ff ff       	jmp    801a7c <devfile_read_direct+0xa9>
+  801c43:	48 89 d0             	mov    %rdx,%rax
+  801c46:	e9 f8 fd ff ff       	jmp    801a43 <devfile_read_direct+0x70>
+
+0000000000801c4b <devfile_read>:
+    if (!fd || !buf)
+  801c4b:	48 85 ff             	test   %rdi,%rdi
+  801c4e:	0f 84 21 02 00 00    	je     801e75 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c54:	55                   	push   %rbp
+  801c55:	48 89 e5             	mov    %rsp,%rbp
+  801c58:	41 57                	push   %r15
+  801c5a:	41 56                	push   %r14
+  801c5c:	41 55                	push   %r13
+  801c5e:	41 54                	push   %r12
+  801c60:	53                   	push   %rbx
+  801c61:	48 83 ec 28          	sub    $0x28,%rsp
+  801c65:	48 89 fb             	mov    %rdi,%rbx
+  801c68:	49 89 f4             	mov    %rsi,%r12
+  801c6b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c6e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c73:	48 85 f6             	test   %rsi,%rsi
+  801c76:	74 4b                	je     801cc3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c78:	48 b8 88 0f 80 00 00 	movabs $0x800f88,%rax
+  801c7f:	00 00 00 
+  801c82:	ff d0                	call   *%rax
+  801c84:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c87:	48 85 c0             	test   %rax,%rax
+  801c8a:	74 22                	je     801cae <devfile_read+0x63>
+  801c8c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c93:	77 19                	ja     801cae <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c95:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c9a:	48 89 df             	mov    %rbx,%rdi
+  801c9d:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  801ca4:	00 00 00 
+  801ca7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801ca9:	83 f8 02             	cmp    $0x2,%eax
+  801cac:	7e 40                	jle    801cee <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801cae:	48 89 df             	mov    %rbx,%rdi
+  801cb1:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  801cb8:	00 00 00 
+  801cbb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cbd:	85 c0                	test   %eax,%eax
+  801cbf:	79 11                	jns    801cd2 <devfile_read+0x87>
+  801cc1:	48 98                	cltq
+}
+  801cc3:	48 83 c4 28          	add    $0x28,%rsp
+  801cc7:	5b                   	pop    %rbx
+  801cc8:	41 5c                	pop    %r12
+  801cca:	41 5d                	pop    %r13
+  801ccc:	41 5e                	pop    %r14
+  801cce:	41 5f                	pop    %r15
+  801cd0:	5d                   	pop    %rbp
+  801cd1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cd2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cd7:	4c 89 ea             	mov    %r13,%rdx
+  801cda:	4c 89 e6             	mov    %r12,%rsi
+  801cdd:	48 89 df             	mov    %rbx,%rdi
+  801ce0:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  801ce7:	00 00 00 
+  801cea:	ff d0                	call   *%rax
+  801cec:	eb d5                	jmp    801cc3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cee:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cf2:	48 89 df             	mov    %rbx,%rdi
+  801cf5:	48 b8 d5 16 80 00 00 	movabs $0x8016d5,%rax
+  801cfc:	00 00 00 
+  801cff:	ff d0                	call   *%rax
+  801d01:	85 c0                	test   %eax,%eax
+  801d03:	0f 88 33 01 00 00    	js     801e3c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d09:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d10:	00 00 00 
+  801d13:	4c 89 f0             	mov    %r14,%rax
+  801d16:	48 29 d0             	sub    %rdx,%rax
+  801d19:	48 c1 f8 03          	sar    $0x3,%rax
+  801d1d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d24:	aa aa aa 
+  801d27:	48 0f af c2          	imul   %rdx,%rax
+  801d2b:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d33:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d36:	41 39 06             	cmp    %eax,(%r14)
+  801d39:	75 0d                	jne    801d48 <devfile_read+0xfd>
+  801d3b:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d3e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d42:	0f 84 fb 00 00 00    	je     801e43 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d48:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d4d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d51:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d58:	48 89 c7             	mov    %rax,%rdi
+  801d5b:	48 b8 a3 2e 80 00 00 	movabs $0x802ea3,%rax
+  801d62:	00 00 00 
+  801d65:	ff d0                	call   *%rax
+  801d67:	84 c0                	test   %al,%al
+  801d69:	75 27                	jne    801d92 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d6b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d70:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d75:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d79:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d7e:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  801d85:	00 00 00 
+  801d88:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d8a:	85 c0                	test   %eax,%eax
+  801d8c:	0f 88 dc 00 00 00    	js     801e6e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d92:	44 89 f8             	mov    %r15d,%eax
+  801d95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d9a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d9c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801da3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801da4:	8b 43 10             	mov    0x10(%rbx),%eax
+  801da7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801dab:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801dae:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801db3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801db7:	48 89 df             	mov    %rbx,%rdi
+  801dba:	48 b8 d3 19 80 00 00 	movabs $0x8019d3,%rax
+  801dc1:	00 00 00 
+  801dc4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801dc6:	48 85 c0             	test   %rax,%rax
+  801dc9:	0f 88 f4 fe ff ff    	js     801cc3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dcf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dd2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dd5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dd8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801ddc:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801de0:	48 63 d1             	movslq %ecx,%rdx
+  801de3:	48 01 d0             	add    %rdx,%rax
+  801de6:	4d 63 ff             	movslq %r15d,%r15
+  801de9:	4c 29 f8             	sub    %r15,%rax
+  801dec:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801df5:	48 85 c0             	test   %rax,%rax
+  801df8:	0f 8e c5 fe ff ff    	jle    801cc3 <devfile_read+0x78>
+    n = MIN(n, res);
+  801dfe:	4c 39 e8             	cmp    %r13,%rax
+  801e01:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e05:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e08:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e0c:	48 63 f6             	movslq %esi,%rsi
+  801e0f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e14:	48 01 c6             	add    %rax,%rsi
+  801e17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e1b:	48 01 c6             	add    %rax,%rsi
+  801e1e:	4c 89 ea             	mov    %r13,%rdx
+  801e21:	4c 89 e7             	mov    %r12,%rdi
+  801e24:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  801e2b:	00 00 00 
+  801e2e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e30:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e34:	4c 89 e8             	mov    %r13,%rax
+  801e37:	e9 87 fe ff ff       	jmp    801cc3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e3c:	48 98                	cltq
+  801e3e:	e9 80 fe ff ff       	jmp    801cc3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e43:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e47:	41 39 d7             	cmp    %edx,%r15d
+  801e4a:	0f 8c f8 fe ff ff    	jl     801d48 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e50:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e54:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e57:	41 39 cf             	cmp    %ecx,%r15d
+  801e5a:	0f 8d e8 fe ff ff    	jge    801d48 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e60:	4d 63 ff             	movslq %r15d,%r15
+  801e63:	4c 29 f8             	sub    %r15,%rax
+  801e66:	48 63 d2             	movslq %edx,%rdx
+  801e69:	48 01 d0             	add    %rdx,%rax
+  801e6c:	eb 87                	jmp    801df5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e6e:	48 98                	cltq
+  801e70:	e9 4e fe ff ff       	jmp    801cc3 <devfile_read+0x78>
+        return E_INVAL;
+  801e75:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e7a:	c3                   	ret
+
+0000000000801e7b <fs_channel>:
+fs_channel(bool enable) {
+  801e7b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e7d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e84:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e86:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e8b:	40 84 ff             	test   %dil,%dil
+  801e8e:	74 47                	je     801ed7 <fs_channel+0x5c>
+  801e90:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e97:	00 00 00 
+  801e9a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801ea0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ea7:	00 00 00 
+  801eaa:	3b 08                	cmp    (%rax),%ecx
+  801eac:	74 29                	je     801ed7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801eae:	55                   	push   %rbp
+  801eaf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801eb2:	48 b8 fb 0d 80 00 00 	movabs $0x800dfb,%rax
+  801eb9:	00 00 00 
+  801ebc:	ff d0                	call   *%rax
+  801ebe:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ec0:	85 c0                	test   %eax,%eax
+  801ec2:	78 04                	js     801ec8 <fs_channel+0x4d>
+}
+  801ec4:	89 d0                	mov    %edx,%eax
+  801ec6:	5d                   	pop    %rbp
+  801ec7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ec8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801ecf:	00 00 00 
+  801ed2:	c6 00 00             	movb   $0x0,(%rax)
+  801ed5:	eb ed                	jmp    801ec4 <fs_channel+0x49>
+}
+  801ed7:	89 d0                	mov    %edx,%eax
+  801ed9:	c3                   	ret
+
+0000000000801eda <open>:
+open(const char *path, int mode) {
+  801eda:	55                   	push   %rbp
+  801edb:	48 89 e5             	mov    %rsp,%rbp
+  801ede:	41 55                	push   %r13
+  801ee0:	41 54                	push   %r12
+  801ee2:	53                   	push   %rbx
+  801ee3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ee7:	49 89 fc             	mov    %rdi,%r12
+  801eea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801eed:	48 b8 a9 3d 80 00 00 	movabs $0x803da9,%rax
+  801ef4:	00 00 00 
+  801ef7:	ff d0                	call   *%rax
+  801ef9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801eff:	0f 87 8f 00 00 00    	ja     801f94 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f09:	48 b8 b5 06 80 00 00 	movabs $0x8006b5,%rax
+  801f10:	00 00 00 
+  801f13:	ff d0                	call   *%rax
+  801f15:	89 c3                	mov    %eax,%ebx
+  801f17:	85 c0                	test   %eax,%eax
+  801f19:	78 55                	js     801f70 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f1b:	4c 89 e6             	mov    %r12,%rsi
+  801f1e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f25:	00 00 00 
+  801f28:	48 89 df             	mov    %rbx,%rdi
+  801f2b:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  801f32:	00 00 00 
+  801f35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f47:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f4c:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  801f53:	00 00 00 
+  801f56:	ff d0                	call   *%rax
+  801f58:	89 c3                	mov    %eax,%ebx
+  801f5a:	85 c0                	test   %eax,%eax
+  801f5c:	78 1f                	js     801f7d <open+0xa3>
+    return fd2num(fd);
+  801f5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f62:	48 b8 87 06 80 00 00 	movabs $0x800687,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	89 c3                	mov    %eax,%ebx
+}
+  801f70:	89 d8                	mov    %ebx,%eax
+  801f72:	48 83 c4 18          	add    $0x18,%rsp
+  801f76:	5b                   	pop    %rbx
+  801f77:	41 5c                	pop    %r12
+  801f79:	41 5d                	pop    %r13
+  801f7b:	5d                   	pop    %rbp
+  801f7c:	c3                   	ret
+        fd_close(fd, 0);
+  801f7d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f86:	48 b8 d0 07 80 00 00 	movabs $0x8007d0,%rax
+  801f8d:	00 00 00 
+  801f90:	ff d0                	call   *%rax
+        return res;
+  801f92:	eb dc                	jmp    801f70 <open+0x96>
+        return -E_BAD_PATH;
+  801f94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f99:	eb d5                	jmp    801f70 <open+0x96>
+
+0000000000801f9b <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	41 56                	push   %r14
+  801fa1:	41 55                	push   %r13
+  801fa3:	41 54                	push   %r12
+  801fa5:	53                   	push   %rbx
+  801fa6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801faa:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fb1:	00 00 00 
+  801fb4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fb9:	49 bd 15 07 80 00 00 	movabs $0x800715,%r13
+  801fc0:	00 00 00 
+  801fc3:	49 be d5 16 80 00 00 	movabs $0x8016d5,%r14
+  801fca:	00 00 00 
+  801fcd:	eb 0c                	jmp    801fdb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fcf:	83 c3 01             	add    $0x1,%ebx
+  801fd2:	49 83 c4 18          	add    $0x18,%r12
+  801fd6:	83 fb 20             	cmp    $0x20,%ebx
+  801fd9:	74 1d                	je     801ff8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fdb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fe0:	74 ed                	je     801fcf <file_flush_buffers+0x34>
+  801fe2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fe6:	89 df                	mov    %ebx,%edi
+  801fe8:	41 ff d5             	call   *%r13
+  801feb:	85 c0                	test   %eax,%eax
+  801fed:	78 e0                	js     801fcf <file_flush_buffers+0x34>
+  801fef:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ff3:	41 ff d6             	call   *%r14
+  801ff6:	eb d7                	jmp    801fcf <file_flush_buffers+0x34>
+}
+  801ff8:	48 83 c4 10          	add    $0x10,%rsp
+  801ffc:	5b                   	pop    %rbx
+  801ffd:	41 5c                	pop    %r12
+  801fff:	41 5d                	pop    %r13
+  802001:	41 5e                	pop    %r14
+  802003:	5d                   	pop    %rbp
+  802004:	c3                   	ret
+
+0000000000802005 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802005:	55                   	push   %rbp
+  802006:	48 89 e5             	mov    %rsp,%rbp
+  802009:	41 54                	push   %r12
+  80200b:	53                   	push   %rbx
+  80200c:	49 89 fc             	mov    %rdi,%r12
+  80200f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802011:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  802018:	00 00 00 
+  80201b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80201d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802024:	00 00 00 
+  802027:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80202c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80202e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802031:	ba 00 00 00 00       	mov    $0x0,%edx
+  802036:	be 00 00 00 00       	mov    $0x0,%esi
+  80203b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802040:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+}
+  80204c:	5b                   	pop    %rbx
+  80204d:	41 5c                	pop    %r12
+  80204f:	5d                   	pop    %rbp
+  802050:	c3                   	ret
+
+0000000000802051 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802051:	55                   	push   %rbp
+  802052:	48 89 e5             	mov    %rsp,%rbp
+  802055:	41 54                	push   %r12
+  802057:	53                   	push   %rbx
+  802058:	49 89 fc             	mov    %rdi,%r12
+  80205b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80205e:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  802065:	00 00 00 
+  802068:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80206a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80206f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802076:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802078:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207d:	be 00 00 00 00       	mov    $0x0,%esi
+  802082:	bf 05 00 00 00       	mov    $0x5,%edi
+  802087:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  80208e:	00 00 00 
+  802091:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802093:	85 c0                	test   %eax,%eax
+  802095:	78 3d                	js     8020d4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802097:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80209e:	00 00 00 
+  8020a1:	4c 89 e6             	mov    %r12,%rsi
+  8020a4:	48 89 df             	mov    %rbx,%rdi
+  8020a7:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  8020ae:	00 00 00 
+  8020b1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020b3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020ba:	00 
+  8020bb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020c1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020c8:	00 
+  8020c9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020cf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020d4:	5b                   	pop    %rbx
+  8020d5:	41 5c                	pop    %r12
+  8020d7:	5d                   	pop    %rbp
+  8020d8:	c3                   	ret
+
+00000000008020d9 <remove>:
+remove(const char *path) {
+  8020d9:	55                   	push   %rbp
+  8020da:	48 89 e5             	mov    %rsp,%rbp
+  8020dd:	53                   	push   %rbx
+  8020de:	48 83 ec 08          	sub    $0x8,%rsp
+  8020e2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020e5:	48 b8 a9 3d 80 00 00 	movabs $0x803da9,%rax
+  8020ec:	00 00 00 
+  8020ef:	ff d0                	call   *%rax
+  8020f1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020f7:	77 3a                	ja     802133 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020f9:	48 89 de             	mov    %rbx,%rsi
+  8020fc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802103:	00 00 00 
+  802106:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  80210d:	00 00 00 
+  802110:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802112:	ba 00 00 00 00       	mov    $0x0,%edx
+  802117:	be 00 00 00 00       	mov    $0x0,%esi
+  80211c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802121:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  802128:	00 00 00 
+  80212b:	ff d0                	call   *%rax
+}
+  80212d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802131:	c9                   	leave
+  802132:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802133:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802138:	eb f3                	jmp    80212d <remove+0x54>
+
+000000000080213a <sync>:
+sync(void) {
+  80213a:	55                   	push   %rbp
+  80213b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80213e:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  802145:	00 00 00 
+  802148:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80214a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80214f:	be 00 00 00 00       	mov    $0x0,%esi
+  802154:	bf 08 00 00 00       	mov    $0x8,%edi
+  802159:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  802160:	00 00 00 
+  802163:	ff d0                	call   *%rax
+}
+  802165:	5d                   	pop    %rbp
+  802166:	c3                   	ret
+
+0000000000802167 <fsync>:
+fsync(int fdnum) {
+  802167:	55                   	push   %rbp
+  802168:	48 89 e5             	mov    %rsp,%rbp
+  80216b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80216f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802173:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  80217a:	00 00 00 
+  80217d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80217f:	85 c0                	test   %eax,%eax
+  802181:	78 4b                	js     8021ce <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802183:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802187:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80218e:	00 00 00 
+  802191:	8b 00                	mov    (%rax),%eax
+  802193:	39 02                	cmp    %eax,(%rdx)
+  802195:	75 39                	jne    8021d0 <fsync+0x69>
+    file_flush_buffers();
+  802197:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  80219e:	00 00 00 
+  8021a1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8021a3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021a7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021aa:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021b1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021bd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021c2:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+}
+  8021ce:	c9                   	leave
+  8021cf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021d5:	eb f7                	jmp    8021ce <fsync+0x67>
+
+00000000008021d7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021d7:	55                   	push   %rbp
+  8021d8:	48 89 e5             	mov    %rsp,%rbp
+  8021db:	53                   	push   %rbx
+  8021dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8021e0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021f2:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	78 2d                	js     80222f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  802202:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802209:	00 00 00 
+  80220c:	48 8b 10             	mov    (%rax),%rdx
+  80220f:	48 89 13             	mov    %rdx,(%rbx)
+  802212:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802216:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80221a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80221e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802222:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802226:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80222f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802233:	c9                   	leave
+  802234:	c3                   	ret
+
+0000000000802235 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	53                   	push   %rbx
+  80223a:	48 83 ec 08          	sub    $0x8,%rsp
+  80223e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802241:	ba 00 00 00 00       	mov    $0x0,%edx
+  802246:	be 00 00 00 00       	mov    $0x0,%esi
+  80224b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802250:	48 b8 6c 14 80 00 00 	movabs $0x80146c,%rax
+  802257:	00 00 00 
+  80225a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80225c:	85 c0                	test   %eax,%eax
+  80225e:	78 3d                	js     80229d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802260:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802267:	00 00 00 
+  80226a:	48 8b 10             	mov    (%rax),%rdx
+  80226d:	48 89 13             	mov    %rdx,(%rbx)
+  802270:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802274:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802278:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80227c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802280:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802284:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802288:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80228c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802290:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802294:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  802298:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80229d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022a1:	c9                   	leave
+  8022a2:	c3                   	ret
+
+00000000008022a3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8022a3:	55                   	push   %rbp
+  8022a4:	48 89 e5             	mov    %rsp,%rbp
+  8022a7:	41 57                	push   %r15
+  8022a9:	41 56                	push   %r14
+  8022ab:	41 55                	push   %r13
+  8022ad:	41 54                	push   %r12
+  8022af:	53                   	push   %rbx
+  8022b0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022b4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022bb:	00 
+  8022bc:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022c3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022c9:	0f 85 43 01 00 00    	jne    802412 <munmap+0x16f>
+  8022cf:	49 89 ff             	mov    %rdi,%r15
+  8022d2:	4c 39 f7             	cmp    %r14,%rdi
+  8022d5:	0f 87 37 01 00 00    	ja     802412 <munmap+0x16f>
+  8022db:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022e2:	00 00 00 
+  8022e5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022eb:	eb 2c                	jmp    802319 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022ed:	4c 39 f8             	cmp    %r15,%rax
+  8022f0:	0f 83 85 00 00 00    	jae    80237b <munmap+0xd8>
+            m->mm_end = start;
+  8022f6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022fb:	48 83 c3 18          	add    $0x18,%rbx
+  8022ff:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802306:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80230d:	00 00 00 
+  802310:	48 39 c3             	cmp    %rax,%rbx
+  802313:	0f 84 d0 00 00 00    	je     8023e9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802319:	49 89 dc             	mov    %rbx,%r12
+  80231c:	48 8b 03             	mov    (%rbx),%rax
+  80231f:	4c 39 f0             	cmp    %r14,%rax
+  802322:	73 d7                	jae    8022fb <munmap+0x58>
+  802324:	48 85 c0             	test   %rax,%rax
+  802327:	74 d2                	je     8022fb <munmap+0x58>
+  802329:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80232d:	49 39 d7             	cmp    %rdx,%r15
+  802330:	73 c9                	jae    8022fb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802332:	49 39 d6             	cmp    %rdx,%r14
+  802335:	73 b6                	jae    8022ed <munmap+0x4a>
+  802337:	49 39 c7             	cmp    %rax,%r15
+  80233a:	76 b1                	jbe    8022ed <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80233c:	4c 89 ef             	mov    %r13,%rdi
+  80233f:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  802346:	00 00 00 
+  802349:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80234b:	48 85 c0             	test   %rax,%rax
+  80234e:	0f 84 c5 00 00 00    	je     802419 <munmap+0x176>
+            *tail = *m;
+  802354:	48 8b 13             	mov    (%rbx),%rdx
+  802357:	48 89 10             	mov    %rdx,(%rax)
+  80235a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80235e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802362:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802366:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80236a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80236d:	44 89 f2             	mov    %r14d,%edx
+  802370:	2b 13                	sub    (%rbx),%edx
+  802372:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802375:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  802379:	eb 80                	jmp    8022fb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80237b:	49 39 d6             	cmp    %rdx,%r14
+  80237e:	73 18                	jae    802398 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802380:	44 89 f2             	mov    %r14d,%edx
+  802383:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802388:	29 c2                	sub    %eax,%edx
+  80238a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80238f:	4d 89 34 24          	mov    %r14,(%r12)
+  802393:	e9 63 ff ff ff       	jmp    8022fb <munmap+0x58>
+    m->mm_start = 0;
+  802398:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80239f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8023a0:	4c 89 e6             	mov    %r12,%rsi
+  8023a3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023aa:	00 00 00 
+  8023ad:	48 29 c6             	sub    %rax,%rsi
+  8023b0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023b4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023bb:	aa aa aa 
+  8023be:	48 0f af f0          	imul   %rax,%rsi
+  8023c2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023c6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023cb:	48 01 c6             	add    %rax,%rsi
+  8023ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d8:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  8023df:	00 00 00 
+  8023e2:	ff d0                	call   *%rax
+}
+  8023e4:	e9 12 ff ff ff       	jmp    8022fb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023e9:	4c 89 f2             	mov    %r14,%rdx
+  8023ec:	4c 29 fa             	sub    %r15,%rdx
+  8023ef:	4c 89 fe             	mov    %r15,%rsi
+  8023f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023f7:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+}
+  802403:	48 83 c4 08          	add    $0x8,%rsp
+  802407:	5b                   	pop    %rbx
+  802408:	41 5c                	pop    %r12
+  80240a:	41 5d                	pop    %r13
+  80240c:	41 5e                	pop    %r14
+  80240e:	41 5f                	pop    %r15
+  802410:	5d                   	pop    %rbp
+  802411:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802412:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802417:	eb ea                	jmp    802403 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802419:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80241e:	eb e3                	jmp    802403 <munmap+0x160>
+
+0000000000802420 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802420:	55                   	push   %rbp
+  802421:	48 89 e5             	mov    %rsp,%rbp
+  802424:	41 57                	push   %r15
+  802426:	41 56                	push   %r14
+  802428:	41 55                	push   %r13
+  80242a:	41 54                	push   %r12
+  80242c:	53                   	push   %rbx
+  80242d:	48 83 ec 28          	sub    $0x28,%rsp
+  802431:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802435:	49 89 f5             	mov    %rsi,%r13
+  802438:	41 89 d6             	mov    %edx,%r14d
+  80243b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80243e:	41 89 cc             	mov    %ecx,%r12d
+  802441:	44 89 c7             	mov    %r8d,%edi
+  802444:	44 89 cb             	mov    %r9d,%ebx
+  802447:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80244b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80244f:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  802456:	00 00 00 
+  802459:	ff d0                	call   *%rax
+  80245b:	41 89 c7             	mov    %eax,%r15d
+  80245e:	85 c0                	test   %eax,%eax
+  802460:	0f 88 ae 01 00 00    	js     802614 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802466:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80246a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802471:	00 00 00 
+  802474:	8b 32                	mov    (%rdx),%esi
+  802476:	39 30                	cmp    %esi,(%rax)
+  802478:	0f 85 7a 02 00 00    	jne    8026f8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80247e:	8b 40 08             	mov    0x8(%rax),%eax
+  802481:	83 e0 03             	and    $0x3,%eax
+  802484:	83 f8 01             	cmp    $0x1,%eax
+  802487:	0f 84 76 02 00 00    	je     802703 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80248d:	4d 85 ed             	test   %r13,%r13
+  802490:	0f 84 78 02 00 00    	je     80270e <mmap+0x2ee>
+  802496:	85 db                	test   %ebx,%ebx
+  802498:	0f 88 70 02 00 00    	js     80270e <mmap+0x2ee>
+  80249e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8024a4:	41 89 df             	mov    %ebx,%r15d
+  8024a7:	0f 85 6c 02 00 00    	jne    802719 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8024ad:	44 89 f0             	mov    %r14d,%eax
+  8024b0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024b3:	83 f8 04             	cmp    $0x4,%eax
+  8024b6:	0f 85 68 02 00 00    	jne    802724 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024bc:	44 89 e1             	mov    %r12d,%ecx
+  8024bf:	83 e1 01             	and    $0x1,%ecx
+  8024c2:	0f 95 c2             	setne  %dl
+  8024c5:	44 89 e0             	mov    %r12d,%eax
+  8024c8:	d1 e8                	shr    %eax
+  8024ca:	83 f0 01             	xor    $0x1,%eax
+  8024cd:	83 e0 01             	and    $0x1,%eax
+  8024d0:	38 c2                	cmp    %al,%dl
+  8024d2:	0f 85 57 02 00 00    	jne    80272f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024d8:	85 c9                	test   %ecx,%ecx
+  8024da:	74 0a                	je     8024e6 <mmap+0xc6>
+  8024dc:	41 f6 c6 02          	test   $0x2,%r14b
+  8024e0:	0f 85 54 02 00 00    	jne    80273a <mmap+0x31a>
+    file_flush_buffers();
+  8024e6:	48 b8 9b 1f 80 00 00 	movabs $0x801f9b,%rax
+  8024ed:	00 00 00 
+  8024f0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024f2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024f9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  802500:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802504:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  802507:	41 f6 c4 04          	test   $0x4,%r12b
+  80250b:	0f 84 15 01 00 00    	je     802626 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  802511:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802514:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80251a:	0f 85 25 02 00 00    	jne    802745 <mmap+0x325>
+  802520:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802524:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80252b:	00 00 00 
+  80252e:	48 39 c2             	cmp    %rax,%rdx
+  802531:	0f 82 19 02 00 00    	jb     802750 <mmap+0x330>
+  802537:	48 39 c7             	cmp    %rax,%rdi
+  80253a:	0f 87 10 02 00 00    	ja     802750 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802540:	4c 89 ee             	mov    %r13,%rsi
+  802543:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  80254a:	00 00 00 
+  80254d:	ff d0                	call   *%rax
+  80254f:	85 c0                	test   %eax,%eax
+  802551:	0f 88 04 02 00 00    	js     80275b <mmap+0x33b>
+    if (!handler) {
+  802557:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80255e:	00 00 00 
+  802561:	80 38 00             	cmpb   $0x0,(%rax)
+  802564:	75 2b                	jne    802591 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802566:	48 bf 3b 13 80 00 00 	movabs $0x80133b,%rdi
+  80256d:	00 00 00 
+  802570:	48 b8 98 42 80 00 00 	movabs $0x804298,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+  80257c:	85 c0                	test   %eax,%eax
+  80257e:	0f 88 ea 01 00 00    	js     80276e <mmap+0x34e>
+        handler = 1;
+  802584:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80258b:	00 00 00 
+  80258e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802591:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802595:	48 b8 da 13 80 00 00 	movabs $0x8013da,%rax
+  80259c:	00 00 00 
+  80259f:	ff d0                	call   *%rax
+  8025a1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8025a4:	48 85 c0             	test   %rax,%rax
+  8025a7:	0f 84 c9 01 00 00    	je     802776 <mmap+0x356>
+    m->mm_start = va;
+  8025ad:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025b0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025b8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025bb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025bf:	44 89 e0             	mov    %r12d,%eax
+  8025c2:	c1 e0 06             	shl    $0x6,%eax
+  8025c5:	25 80 00 00 00       	and    $0x80,%eax
+  8025ca:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025cd:	09 f0                	or     %esi,%eax
+  8025cf:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025d3:	41 f6 c4 08          	test   $0x8,%r12b
+  8025d7:	74 31                	je     80260a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025d9:	48 39 d3             	cmp    %rdx,%rbx
+  8025dc:	73 2c                	jae    80260a <mmap+0x1ea>
+  8025de:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025e3:	48 89 de             	mov    %rbx,%rsi
+  8025e6:	4c 89 f7             	mov    %r14,%rdi
+  8025e9:	48 b8 2a 12 80 00 00 	movabs $0x80122a,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	49 89 c4             	mov    %rax,%r12
+  8025f8:	48 85 c0             	test   %rax,%rax
+  8025fb:	0f 8e d7 00 00 00    	jle    8026d8 <mmap+0x2b8>
+            va += n;
+  802601:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  802604:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  802608:	72 d4                	jb     8025de <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80260a:	49 8b 06             	mov    (%r14),%rax
+  80260d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802611:	48 89 06             	mov    %rax,(%rsi)
+}
+  802614:	44 89 f8             	mov    %r15d,%eax
+  802617:	48 83 c4 28          	add    $0x28,%rsp
+  80261b:	5b                   	pop    %rbx
+  80261c:	41 5c                	pop    %r12
+  80261e:	41 5d                	pop    %r13
+  802620:	41 5e                	pop    %r14
+  802622:	41 5f                	pop    %r15
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802626:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80262d:	00 00 00 
+  802630:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802633:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80263a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80263d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802642:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802649:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80264c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802653:	00 00 00 
+  802656:	48 39 d7             	cmp    %rdx,%rdi
+  802659:	73 1c                	jae    802677 <mmap+0x257>
+        return -E_NO_MEM;
+  80265b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802661:	eb b1                	jmp    802614 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802663:	48 83 c0 01          	add    $0x1,%rax
+  802667:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80266b:	77 3f                	ja     8026ac <mmap+0x28c>
+  80266d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802672:	48 39 d7             	cmp    %rdx,%rdi
+  802675:	72 2a                	jb     8026a1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802677:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80267b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80267f:	48 39 d1             	cmp    %rdx,%rcx
+  802682:	73 df                	jae    802663 <mmap+0x243>
+  802684:	48 85 c9             	test   %rcx,%rcx
+  802687:	74 da                	je     802663 <mmap+0x243>
+  802689:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80268d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802692:	48 39 d3             	cmp    %rdx,%rbx
+  802695:	73 cc                	jae    802663 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802697:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80269a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269f:	eb cc                	jmp    80266d <mmap+0x24d>
+        return -E_NO_MEM;
+  8026a1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026a7:	e9 68 ff ff ff       	jmp    802614 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8026ac:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026b1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026b8:	00 00 00 
+  8026bb:	48 39 c2             	cmp    %rax,%rdx
+  8026be:	0f 82 9f 00 00 00    	jb     802763 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026c4:	48 85 db             	test   %rbx,%rbx
+  8026c7:	0f 85 8a fe ff ff    	jne    802557 <mmap+0x137>
+        return -E_NO_MEM;
+  8026cd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026d3:	e9 3c ff ff ff       	jmp    802614 <mmap+0x1f4>
+        if (n < 0) {
+  8026d8:	0f 89 2c ff ff ff    	jns    80260a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026de:	49 8b 3e             	mov    (%r14),%rdi
+  8026e1:	4c 89 ee             	mov    %r13,%rsi
+  8026e4:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  8026eb:	00 00 00 
+  8026ee:	ff d0                	call   *%rax
+            return n;
+  8026f0:	45 89 e7             	mov    %r12d,%r15d
+  8026f3:	e9 1c ff ff ff       	jmp    802614 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026fe:	e9 11 ff ff ff       	jmp    802614 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802703:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802709:	e9 06 ff ff ff       	jmp    802614 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80270e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802714:	e9 fb fe ff ff       	jmp    802614 <mmap+0x1f4>
+  802719:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80271f:	e9 f0 fe ff ff       	jmp    802614 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802724:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80272a:	e9 e5 fe ff ff       	jmp    802614 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80272f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802735:	e9 da fe ff ff       	jmp    802614 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80273a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802740:	e9 cf fe ff ff       	jmp    802614 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802745:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80274b:	e9 c4 fe ff ff       	jmp    802614 <mmap+0x1f4>
+  802750:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802756:	e9 b9 fe ff ff       	jmp    802614 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80275b:	41 89 c7             	mov    %eax,%r15d
+  80275e:	e9 b1 fe ff ff       	jmp    802614 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802763:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802769:	e9 a6 fe ff ff       	jmp    802614 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80276e:	41 89 c7             	mov    %eax,%r15d
+  802771:	e9 9e fe ff ff       	jmp    802614 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802776:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80277c:	e9 93 fe ff ff       	jmp    802614 <mmap+0x1f4>
+
+0000000000802781 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802781:	55                   	push   %rbp
+  802782:	48 89 e5             	mov    %rsp,%rbp
+  802785:	41 54                	push   %r12
+  802787:	53                   	push   %rbx
+  802788:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80278b:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  802792:	00 00 00 
+  802795:	ff d0                	call   *%rax
+  802797:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80279a:	48 be a0 47 80 00 00 	movabs $0x8047a0,%rsi
+  8027a1:	00 00 00 
+  8027a4:	48 89 df             	mov    %rbx,%rdi
+  8027a7:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  8027ae:	00 00 00 
+  8027b1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027b3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027b8:	41 2b 04 24          	sub    (%r12),%eax
+  8027bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027c9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027cc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027d3:	00 00 00 
+  8027d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e2:	5b                   	pop    %rbx
+  8027e3:	41 5c                	pop    %r12
+  8027e5:	5d                   	pop    %rbp
+  8027e6:	c3                   	ret
+
+00000000008027e7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027e7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027ea:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027f0:	8b 17                	mov    (%rdi),%edx
+  8027f2:	85 d2                	test   %edx,%edx
+  8027f4:	75 01                	jne    8027f7 <pipe_wakeup+0x10>
+  8027f6:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027f7:	55                   	push   %rbp
+  8027f8:	48 89 e5             	mov    %rsp,%rbp
+  8027fb:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027fe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  802804:	be 00 04 00 00       	mov    $0x400,%esi
+  802809:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+}
+  802815:	5d                   	pop    %rbp
+  802816:	c3                   	ret
+
+0000000000802817 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802817:	55                   	push   %rbp
+  802818:	48 89 e5             	mov    %rsp,%rbp
+  80281b:	41 55                	push   %r13
+  80281d:	41 54                	push   %r12
+  80281f:	53                   	push   %rbx
+  802820:	48 83 ec 08          	sub    $0x8,%rsp
+  802824:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802827:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802836:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80283b:	4c 89 e6             	mov    %r12,%rsi
+  80283e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802843:	49 bc fa 02 80 00 00 	movabs $0x8002fa,%r12
+  80284a:	00 00 00 
+  80284d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802850:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802854:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802858:	49 bd e7 27 80 00 00 	movabs $0x8027e7,%r13
+  80285f:	00 00 00 
+  802862:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802865:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802869:	48 89 de             	mov    %rbx,%rsi
+  80286c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80286f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802874:	48 89 de             	mov    %rbx,%rsi
+  802877:	bf 00 00 00 00       	mov    $0x0,%edi
+  80287c:	41 ff d4             	call   *%r12
+  80287f:	48 83 c4 08          	add    $0x8,%rsp
+  802883:	5b                   	pop    %rbx
+  802884:	41 5c                	pop    %r12
+  802886:	41 5d                	pop    %r13
+  802888:	5d                   	pop    %rbp
+  802889:	c3                   	ret
+
+000000000080288a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80288a:	55                   	push   %rbp
+  80288b:	48 89 e5             	mov    %rsp,%rbp
+  80288e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802891:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802896:	be 00 10 00 00       	mov    $0x1000,%esi
+  80289b:	48 b8 3d 02 80 00 00 	movabs $0x80023d,%rax
+  8028a2:	00 00 00 
+  8028a5:	ff d0                	call   *%rax
+  8028a7:	85 c0                	test   %eax,%eax
+  8028a9:	0f 94 c0             	sete   %al
+  8028ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8028af:	5d                   	pop    %rbp
+  8028b0:	c3                   	ret
+
+00000000008028b1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028b1:	55                   	push   %rbp
+  8028b2:	48 89 e5             	mov    %rsp,%rbp
+  8028b5:	41 57                	push   %r15
+  8028b7:	41 56                	push   %r14
+  8028b9:	41 55                	push   %r13
+  8028bb:	41 54                	push   %r12
+  8028bd:	53                   	push   %rbx
+  8028be:	48 83 ec 38          	sub    $0x38,%rsp
+  8028c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028c6:	49 89 f4             	mov    %rsi,%r12
+  8028c9:	49 89 d7             	mov    %rdx,%r15
+  8028cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028d0:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+  8028dc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028df:	4d 85 ff             	test   %r15,%r15
+  8028e2:	0f 84 f1 00 00 00    	je     8029d9 <devpipe_write+0x128>
+  8028e8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028ec:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028f0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028f4:	49 bd 8a 28 80 00 00 	movabs $0x80288a,%r13
+  8028fb:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028fe:	49 bf e7 27 80 00 00 	movabs $0x8027e7,%r15
+  802905:	00 00 00 
+  802908:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80290c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802910:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802914:	8b 73 04             	mov    0x4(%rbx),%esi
+  802917:	48 63 ce             	movslq %esi,%rcx
+  80291a:	48 63 03             	movslq (%rbx),%rax
+  80291d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802923:	48 39 c1             	cmp    %rax,%rcx
+  802926:	72 64                	jb     80298c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802928:	48 89 de             	mov    %rbx,%rsi
+  80292b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80292f:	41 ff d5             	call   *%r13
+  802932:	85 c0                	test   %eax,%eax
+  802934:	0f 85 b9 00 00 00    	jne    8029f3 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80293a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80293e:	4c 89 f7             	mov    %r14,%rdi
+  802941:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802944:	8b 43 04             	mov    0x4(%rbx),%eax
+  802947:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80294e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802955:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80295b:	8b 03                	mov    (%rbx),%eax
+  80295d:	41 39 c4             	cmp    %eax,%r12d
+  802960:	75 b2                	jne    802914 <devpipe_write+0x63>
+  802962:	48 89 de             	mov    %rbx,%rsi
+  802965:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802969:	41 ff d5             	call   *%r13
+  80296c:	85 c0                	test   %eax,%eax
+  80296e:	75 a0                	jne    802910 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802970:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802975:	44 89 e6             	mov    %r12d,%esi
+  802978:	48 89 df             	mov    %rbx,%rdi
+  80297b:	48 b8 c2 05 80 00 00 	movabs $0x8005c2,%rax
+  802982:	00 00 00 
+  802985:	ff d0                	call   *%rax
+  802987:	e9 7c ff ff ff       	jmp    802908 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80298c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802990:	41 0f b6 38          	movzbl (%r8),%edi
+  802994:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80299b:	80 80 80 
+  80299e:	48 89 c8             	mov    %rcx,%rax
+  8029a1:	48 f7 e2             	mul    %rdx
+  8029a4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029a8:	48 89 d0             	mov    %rdx,%rax
+  8029ab:	48 c1 e0 08          	shl    $0x8,%rax
+  8029af:	48 29 d0             	sub    %rdx,%rax
+  8029b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8029b6:	48 29 c1             	sub    %rax,%rcx
+  8029b9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029be:	83 c6 01             	add    $0x1,%esi
+  8029c1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029c4:	49 83 c0 01          	add    $0x1,%r8
+  8029c8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029cc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029d0:	49 39 c0             	cmp    %rax,%r8
+  8029d3:	0f 85 2f ff ff ff    	jne    802908 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029d9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029dd:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029e1:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8029e8:	00 00 00 
+  8029eb:	ff d0                	call   *%rax
+    return n;
+  8029ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029f1:	eb 05                	jmp    8029f8 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029f8:	48 83 c4 38          	add    $0x38,%rsp
+  8029fc:	5b                   	pop    %rbx
+  8029fd:	41 5c                	pop    %r12
+  8029ff:	41 5d                	pop    %r13
+  802a01:	41 5e                	pop    %r14
+  802a03:	41 5f                	pop    %r15
+  802a05:	5d                   	pop    %rbp
+  802a06:	c3                   	ret
+
+0000000000802a07 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a07:	55                   	push   %rbp
+  802a08:	48 89 e5             	mov    %rsp,%rbp
+  802a0b:	41 57                	push   %r15
+  802a0d:	41 56                	push   %r14
+  802a0f:	41 55                	push   %r13
+  802a11:	41 54                	push   %r12
+  802a13:	53                   	push   %rbx
+  802a14:	48 83 ec 28          	sub    $0x28,%rsp
+  802a18:	49 89 fd             	mov    %rdi,%r13
+  802a1b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a1f:	49 89 d4             	mov    %rdx,%r12
+  802a22:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a26:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+  802a32:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a35:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a3b:	49 bf 8a 28 80 00 00 	movabs $0x80288a,%r15
+  802a42:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a45:	4d 85 e4             	test   %r12,%r12
+  802a48:	0f 84 d5 00 00 00    	je     802b23 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a4e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a56:	8b 03                	mov    (%rbx),%eax
+  802a58:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a5b:	75 7a                	jne    802ad7 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a5d:	4d 85 f6             	test   %r14,%r14
+  802a60:	75 50                	jne    802ab2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a62:	48 89 de             	mov    %rbx,%rsi
+  802a65:	4c 89 ef             	mov    %r13,%rdi
+  802a68:	41 ff d7             	call   *%r15
+  802a6b:	85 c0                	test   %eax,%eax
+  802a6d:	0f 85 c9 00 00 00    	jne    802b3c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a73:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a76:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a7d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a83:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a86:	41 39 c4             	cmp    %eax,%r12d
+  802a89:	75 cb                	jne    802a56 <devpipe_read+0x4f>
+  802a8b:	48 89 de             	mov    %rbx,%rsi
+  802a8e:	4c 89 ef             	mov    %r13,%rdi
+  802a91:	41 ff d7             	call   *%r15
+  802a94:	85 c0                	test   %eax,%eax
+  802a96:	75 be                	jne    802a56 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a98:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a9d:	44 89 e6             	mov    %r12d,%esi
+  802aa0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802aa4:	48 b8 c2 05 80 00 00 	movabs $0x8005c2,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+  802ab0:	eb a4                	jmp    802a56 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802ab2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802ab6:	48 89 de             	mov    %rbx,%rsi
+  802ab9:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  802ac0:	00 00 00 
+  802ac3:	ff d0                	call   *%rax
+                return i;
+  802ac5:	4c 89 f0             	mov    %r14,%rax
+}
+  802ac8:	48 83 c4 28          	add    $0x28,%rsp
+  802acc:	5b                   	pop    %rbx
+  802acd:	41 5c                	pop    %r12
+  802acf:	41 5d                	pop    %r13
+  802ad1:	41 5e                	pop    %r14
+  802ad3:	41 5f                	pop    %r15
+  802ad5:	5d                   	pop    %rbp
+  802ad6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ad7:	48 63 c8             	movslq %eax,%rcx
+  802ada:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ae1:	80 80 80 
+  802ae4:	48 89 c8             	mov    %rcx,%rax
+  802ae7:	48 f7 e2             	mul    %rdx
+  802aea:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802aee:	48 89 d0             	mov    %rdx,%rax
+  802af1:	48 c1 e0 08          	shl    $0x8,%rax
+  802af5:	48 29 d0             	sub    %rdx,%rax
+  802af8:	48 c1 e0 04          	shl    $0x4,%rax
+  802afc:	48 89 c2             	mov    %rax,%rdx
+  802aff:	48 89 c8             	mov    %rcx,%rax
+  802b02:	48 29 d0             	sub    %rdx,%rax
+  802b05:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b0a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b0e:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b12:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b15:	49 83 c6 01          	add    $0x1,%r14
+  802b19:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b1d:	0f 85 2b ff ff ff    	jne    802a4e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b23:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b27:	48 89 de             	mov    %rbx,%rsi
+  802b2a:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+    return n;
+  802b36:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b3a:	eb 8c                	jmp    802ac8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b41:	eb 85                	jmp    802ac8 <devpipe_read+0xc1>
+
+0000000000802b43 <pipe>:
+pipe(int pfd[2]) {
+  802b43:	55                   	push   %rbp
+  802b44:	48 89 e5             	mov    %rsp,%rbp
+  802b47:	41 55                	push   %r13
+  802b49:	41 54                	push   %r12
+  802b4b:	53                   	push   %rbx
+  802b4c:	48 83 ec 18          	sub    $0x18,%rsp
+  802b50:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b53:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b57:	48 b8 b5 06 80 00 00 	movabs $0x8006b5,%rax
+  802b5e:	00 00 00 
+  802b61:	ff d0                	call   *%rax
+  802b63:	89 c3                	mov    %eax,%ebx
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	0f 88 a0 01 00 00    	js     802d0d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b6d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b72:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b77:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b7b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b80:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  802b87:	00 00 00 
+  802b8a:	ff d0                	call   *%rax
+  802b8c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b8e:	85 c0                	test   %eax,%eax
+  802b90:	0f 88 77 01 00 00    	js     802d0d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b96:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b9a:	48 b8 b5 06 80 00 00 	movabs $0x8006b5,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+  802ba6:	89 c3                	mov    %eax,%ebx
+  802ba8:	85 c0                	test   %eax,%eax
+  802baa:	0f 88 43 01 00 00    	js     802cf3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802bb0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bba:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bc3:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+  802bcf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bd1:	85 c0                	test   %eax,%eax
+  802bd3:	0f 88 1a 01 00 00    	js     802cf3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bd9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bdd:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+  802be9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bf1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bf6:	48 89 c6             	mov    %rax,%rsi
+  802bf9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bfe:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+  802c0a:	89 c3                	mov    %eax,%ebx
+  802c0c:	85 c0                	test   %eax,%eax
+  802c0e:	0f 88 c5 00 00 00    	js     802cd9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c14:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c18:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  802c1f:	00 00 00 
+  802c22:	ff d0                	call   *%rax
+  802c24:	48 89 c1             	mov    %rax,%rcx
+  802c27:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c2d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c38:	4c 89 ee             	mov    %r13,%rsi
+  802c3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c40:	48 b8 aa 02 80 00 00 	movabs $0x8002aa,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+  802c4c:	89 c3                	mov    %eax,%ebx
+  802c4e:	85 c0                	test   %eax,%eax
+  802c50:	78 6e                	js     802cc0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c52:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c57:	4c 89 ef             	mov    %r13,%rdi
+  802c5a:	48 b8 19 02 80 00 00 	movabs $0x800219,%rax
+  802c61:	00 00 00 
+  802c64:	ff d0                	call   *%rax
+  802c66:	83 f8 02             	cmp    $0x2,%eax
+  802c69:	0f 85 ab 00 00 00    	jne    802d1a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c6f:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c76:	00 00 
+  802c78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c7c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c7e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c89:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c8d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c9a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c9e:	48 bb 87 06 80 00 00 	movabs $0x800687,%rbx
+  802ca5:	00 00 00 
+  802ca8:	ff d3                	call   *%rbx
+  802caa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802cae:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cb2:	ff d3                	call   *%rbx
+  802cb4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802cb9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cbe:	eb 4d                	jmp    802d0d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cc0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc5:	4c 89 ee             	mov    %r13,%rsi
+  802cc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ccd:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  802cd4:	00 00 00 
+  802cd7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cd9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cde:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce7:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  802cee:	00 00 00 
+  802cf1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cf3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cf8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cfc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d01:	48 b8 fa 02 80 00 00 	movabs $0x8002fa,%rax
+  802d08:	00 00 00 
+  802d0b:	ff d0                	call   *%rax
+}
+  802d0d:	89 d8                	mov    %ebx,%eax
+  802d0f:	48 83 c4 18          	add    $0x18,%rsp
+  802d13:	5b                   	pop    %rbx
+  802d14:	41 5c                	pop    %r12
+  802d16:	41 5d                	pop    %r13
+  802d18:	5d                   	pop    %rbp
+  802d19:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d1a:	48 b9 d0 47 80 00 00 	movabs $0x8047d0,%rcx
+  802d21:	00 00 00 
+  802d24:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  802d2b:	00 00 00 
+  802d2e:	be 50 00 00 00       	mov    $0x50,%esi
+  802d33:	48 bf bc 47 80 00 00 	movabs $0x8047bc,%rdi
+  802d3a:	00 00 00 
+  802d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d42:	49 b8 72 33 80 00 00 	movabs $0x803372,%r8
+  802d49:	00 00 00 
+  802d4c:	41 ff d0             	call   *%r8
+
+0000000000802d4f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d4f:	55                   	push   %rbp
+  802d50:	48 89 e5             	mov    %rsp,%rbp
+  802d53:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d5b:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  802d62:	00 00 00 
+  802d65:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d67:	85 c0                	test   %eax,%eax
+  802d69:	78 23                	js     802d8e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d6b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d6f:	48 b8 99 06 80 00 00 	movabs $0x800699,%rax
+  802d76:	00 00 00 
+  802d79:	ff d0                	call   *%rax
+  802d7b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d7e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d82:	48 b8 8a 28 80 00 00 	movabs $0x80288a,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+}
+  802d8e:	c9                   	leave
+  802d8f:	c3                   	ret
+
+0000000000802d90 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d90:	48 89 f8             	mov    %rdi,%rax
+  802d93:	48 c1 e8 27          	shr    $0x27,%rax
+  802d97:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d9e:	01 00 00 
+  802da1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da5:	f6 c2 01             	test   $0x1,%dl
+  802da8:	74 6d                	je     802e17 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802daa:	48 89 f8             	mov    %rdi,%rax
+  802dad:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802db1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802db8:	01 00 00 
+  802dbb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dbf:	f6 c2 01             	test   $0x1,%dl
+  802dc2:	74 62                	je     802e26 <get_uvpt_entry+0x96>
+  802dc4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dcb:	01 00 00 
+  802dce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dd2:	f6 c2 80             	test   $0x80,%dl
+  802dd5:	75 4f                	jne    802e26 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dd7:	48 89 f8             	mov    %rdi,%rax
+  802dda:	48 c1 e8 15          	shr    $0x15,%rax
+  802dde:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802de5:	01 00 00 
+  802de8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dec:	f6 c2 01             	test   $0x1,%dl
+  802def:	74 44                	je     802e35 <get_uvpt_entry+0xa5>
+  802df1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802df8:	01 00 00 
+  802dfb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dff:	f6 c2 80             	test   $0x80,%dl
+  802e02:	75 31                	jne    802e35 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802e04:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e08:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e0f:	01 00 00 
+  802e12:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e16:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e17:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e1e:	01 00 00 
+  802e21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e25:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e26:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e2d:	01 00 00 
+  802e30:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e34:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e35:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e3c:	01 00 00 
+  802e3f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e43:	c3                   	ret
+
+0000000000802e44 <get_prot>:
+
+int
+get_prot(void *va) {
+  802e44:	55                   	push   %rbp
+  802e45:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e48:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+  802e54:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e57:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e5c:	89 c1                	mov    %eax,%ecx
+  802e5e:	83 c9 04             	or     $0x4,%ecx
+  802e61:	f6 c2 01             	test   $0x1,%dl
+  802e64:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e67:	89 c1                	mov    %eax,%ecx
+  802e69:	83 c9 02             	or     $0x2,%ecx
+  802e6c:	f6 c2 02             	test   $0x2,%dl
+  802e6f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e72:	89 c1                	mov    %eax,%ecx
+  802e74:	83 c9 01             	or     $0x1,%ecx
+  802e77:	48 85 d2             	test   %rdx,%rdx
+  802e7a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e7d:	89 c1                	mov    %eax,%ecx
+  802e7f:	83 c9 40             	or     $0x40,%ecx
+  802e82:	f6 c6 04             	test   $0x4,%dh
+  802e85:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e88:	5d                   	pop    %rbp
+  802e89:	c3                   	ret
+
+0000000000802e8a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e8a:	55                   	push   %rbp
+  802e8b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e8e:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  802e95:	00 00 00 
+  802e98:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e9a:	48 c1 e8 06          	shr    $0x6,%rax
+  802e9e:	83 e0 01             	and    $0x1,%eax
+}
+  802ea1:	5d                   	pop    %rbp
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ea7:	48 b8 90 2d 80 00 00 	movabs $0x802d90,%rax
+  802eae:	00 00 00 
+  802eb1:	ff d0                	call   *%rax
+  802eb3:	83 e0 01             	and    $0x1,%eax
+}
+  802eb6:	5d                   	pop    %rbp
+  802eb7:	c3                   	ret
+
+0000000000802eb8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802eb8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ebf:	01 00 00 
+  802ec2:	a8 01                	test   $0x1,%al
+  802ec4:	75 06                	jne    802ecc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ec6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ecb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ecc:	55                   	push   %rbp
+  802ecd:	48 89 e5             	mov    %rsp,%rbp
+  802ed0:	41 57                	push   %r15
+  802ed2:	41 56                	push   %r14
+  802ed4:	41 55                	push   %r13
+  802ed6:	41 54                	push   %r12
+  802ed8:	53                   	push   %rbx
+  802ed9:	48 83 ec 28          	sub    $0x28,%rsp
+  802edd:	49 89 fe             	mov    %rdi,%r14
+  802ee0:	49 89 f7             	mov    %rsi,%r15
+  802ee3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802eea:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802eeb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ef2:	01 00 00 
+  802ef5:	e9 ae 00 00 00       	jmp    802fa8 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802efa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f01:	49 83 ec 01          	sub    $0x1,%r12
+  802f05:	74 2d                	je     802f34 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f07:	48 89 d8             	mov    %rbx,%rax
+  802f0a:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f0e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f13:	f6 c2 01             	test   $0x1,%dl
+  802f16:	74 e2                	je     802efa <foreach_shared_region+0x42>
+  802f18:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f1d:	f6 c4 04             	test   $0x4,%ah
+  802f20:	74 d8                	je     802efa <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f22:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f29:	4c 89 fa             	mov    %r15,%rdx
+  802f2c:	48 89 df             	mov    %rbx,%rdi
+  802f2f:	41 ff d6             	call   *%r14
+  802f32:	eb c6                	jmp    802efa <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f34:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f3b:	00 
+  802f3c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f41:	74 4a                	je     802f8d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f47:	48 c1 e8 15          	shr    $0x15,%rax
+  802f4b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f52:	01 00 00 
+  802f55:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f59:	a8 01                	test   $0x1,%al
+  802f5b:	74 d7                	je     802f34 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f5d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f61:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f68:	48 39 c3             	cmp    %rax,%rbx
+  802f6b:	73 c7                	jae    802f34 <foreach_shared_region+0x7c>
+  802f6d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f74:	48 39 d0             	cmp    %rdx,%rax
+  802f77:	4d 19 e4             	sbb    %r12,%r12
+  802f7a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f81:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f88:	e9 7a ff ff ff       	jmp    802f07 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f8d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f94:	40 
+  802f95:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f99:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fa0:	00 00 00 
+  802fa3:	48 39 c1             	cmp    %rax,%rcx
+  802fa6:	74 50                	je     802ff8 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802fa8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fb0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fb7:	01 00 00 
+  802fba:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fbe:	a8 01                	test   $0x1,%al
+  802fc0:	74 cb                	je     802f8d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fc2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fc6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fcd:	48 39 c1             	cmp    %rax,%rcx
+  802fd0:	73 bb                	jae    802f8d <foreach_shared_region+0xd5>
+  802fd2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fd9:	48 39 d0             	cmp    %rdx,%rax
+  802fdc:	48 19 c0             	sbb    %rax,%rax
+  802fdf:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fe5:	48 05 00 02 00 00    	add    $0x200,%rax
+  802feb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fef:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ff3:	e9 4b ff ff ff       	jmp    802f43 <foreach_shared_region+0x8b>
+  802ff8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ffd:	48 83 c4 28          	add    $0x28,%rsp
+  803001:	5b                   	pop    %rbx
+  803002:	41 5c                	pop    %r12
+  803004:	41 5d                	pop    %r13
+  803006:	41 5e                	pop    %r14
+  803008:	41 5f                	pop    %r15
+  80300a:	5d                   	pop    %rbp
+  80300b:	c3                   	ret
+
+000000000080300c <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80300c:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803012:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803019:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803020:	c3                   	ret
+
+0000000000803021 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803021:	8b 47 40             	mov    0x40(%rdi),%eax
+  803024:	8b 17                	mov    (%rdi),%edx
+  803026:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803028:	83 f8 0f             	cmp    $0xf,%eax
+  80302b:	77 13                	ja     803040 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80302d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803030:	83 e0 0f             	and    $0xf,%eax
+  803033:	48 c1 e0 09          	shl    $0x9,%rax
+  803037:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80303e:	00 
+  80303f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803040:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803045:	c3                   	ret
+
+0000000000803046 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803046:	8b 47 40             	mov    0x40(%rdi),%eax
+  803049:	83 c0 01             	add    $0x1,%eax
+  80304c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80304f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803055:	8b 57 04             	mov    0x4(%rdi),%edx
+  803058:	b8 00 00 00 00       	mov    $0x0,%eax
+  80305d:	85 d2                	test   %edx,%edx
+  80305f:	75 04                	jne    803065 <chan_publish+0x1f>
+  803061:	83 e0 01             	and    $0x1,%eax
+}
+  803064:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803065:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803068:	85 c0                	test   %eax,%eax
+  80306a:	0f 95 c0             	setne  %al
+  80306d:	0f b6 c0             	movzbl %al,%eax
+  803070:	eb ef                	jmp    803061 <chan_publish+0x1b>
+
+0000000000803072 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803072:	8b 47 40             	mov    0x40(%rdi),%eax
+  803075:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803077:	29 d0                	sub    %edx,%eax
+  803079:	83 e8 01             	sub    $0x1,%eax
+  80307c:	83 f8 0f             	cmp    $0xf,%eax
+  80307f:	77 12                	ja     803093 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803081:	8b 07                	mov    (%rdi),%eax
+  803083:	83 e0 0f             	and    $0xf,%eax
+  803086:	48 c1 e0 09          	shl    $0x9,%rax
+  80308a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803091:	00 
+  803092:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803093:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803098:	c3                   	ret
+
+0000000000803099 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803099:	8b 07                	mov    (%rdi),%eax
+  80309b:	83 c0 01             	add    $0x1,%eax
+  80309e:	89 07                	mov    %eax,(%rdi)
+}
+  8030a0:	c3                   	ret
+
+00000000008030a1 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8030a1:	55                   	push   %rbp
+  8030a2:	48 89 e5             	mov    %rsp,%rbp
+  8030a5:	53                   	push   %rbx
+  8030a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8030aa:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8030ad:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030b4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030ba:	48 b8 72 30 80 00 00 	movabs $0x803072,%rax
+  8030c1:	00 00 00 
+  8030c4:	ff d0                	call   *%rax
+  8030c6:	48 85 c0             	test   %rax,%rax
+  8030c9:	74 12                	je     8030dd <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030cb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030d7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030db:	c9                   	leave
+  8030dc:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030dd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030e2:	eb f3                	jmp    8030d7 <chan_arm+0x36>
+
+00000000008030e4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030e4:	55                   	push   %rbp
+  8030e5:	48 89 e5             	mov    %rsp,%rbp
+  8030e8:	41 56                	push   %r14
+  8030ea:	41 55                	push   %r13
+  8030ec:	41 54                	push   %r12
+  8030ee:	53                   	push   %rbx
+  8030ef:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030f2:	49 bc a1 30 80 00 00 	movabs $0x8030a1,%r12
+  8030f9:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030fc:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803100:	49 bd c2 05 80 00 00 	movabs $0x8005c2,%r13
+  803107:	00 00 00 
+    while (chan_arm(r))
+  80310a:	eb 0d                	jmp    803119 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80310c:	8b 33                	mov    (%rbx),%esi
+  80310e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803113:	4c 89 f7             	mov    %r14,%rdi
+  803116:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803119:	48 89 df             	mov    %rbx,%rdi
+  80311c:	41 ff d4             	call   *%r12
+  80311f:	84 c0                	test   %al,%al
+  803121:	75 e9                	jne    80310c <chan_wait+0x28>
+}
+  803123:	5b                   	pop    %rbx
+  803124:	41 5c                	pop    %r12
+  803126:	41 5d                	pop    %r13
+  803128:	41 5e                	pop    %r14
+  80312a:	5d                   	pop    %rbp
+  80312b:	c3                   	ret
+
+000000000080312c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80312c:	55                   	push   %rbp
+  80312d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803130:	48 83 c7 40          	add    $0x40,%rdi
+  803134:	be 01 00 00 00       	mov    $0x1,%esi
+  803139:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+}
+  803145:	5d                   	pop    %rbp
+  803146:	c3                   	ret
+
+0000000000803147 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80314c:	c3                   	ret
+
+000000000080314d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80314d:	55                   	push   %rbp
+  80314e:	48 89 e5             	mov    %rsp,%rbp
+  803151:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803154:	48 be f4 47 80 00 00 	movabs $0x8047f4,%rsi
+  80315b:	00 00 00 
+  80315e:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  803165:	00 00 00 
+  803168:	ff d0                	call   *%rax
+    return 0;
+}
+  80316a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80316f:	5d                   	pop    %rbp
+  803170:	c3                   	ret
+
+0000000000803171 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803171:	55                   	push   %rbp
+  803172:	48 89 e5             	mov    %rsp,%rbp
+  803175:	41 57                	push   %r15
+  803177:	41 56                	push   %r14
+  803179:	41 55                	push   %r13
+  80317b:	41 54                	push   %r12
+  80317d:	53                   	push   %rbx
+  80317e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803185:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80318c:	48 85 d2             	test   %rdx,%rdx
+  80318f:	74 7a                	je     80320b <devcons_write+0x9a>
+  803191:	49 89 d6             	mov    %rdx,%r14
+  803194:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80319a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80319f:	49 bf e1 3f 80 00 00 	movabs $0x803fe1,%r15
+  8031a6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031a9:	4c 89 f3             	mov    %r14,%rbx
+  8031ac:	48 29 f3             	sub    %rsi,%rbx
+  8031af:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031b4:	48 39 c3             	cmp    %rax,%rbx
+  8031b7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031bb:	4c 63 eb             	movslq %ebx,%r13
+  8031be:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031c5:	48 01 c6             	add    %rax,%rsi
+  8031c8:	4c 89 ea             	mov    %r13,%rdx
+  8031cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031d2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031d5:	4c 89 ee             	mov    %r13,%rsi
+  8031d8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031df:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  8031e6:	00 00 00 
+  8031e9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031eb:	41 01 dc             	add    %ebx,%r12d
+  8031ee:	49 63 f4             	movslq %r12d,%rsi
+  8031f1:	4c 39 f6             	cmp    %r14,%rsi
+  8031f4:	72 b3                	jb     8031a9 <devcons_write+0x38>
+    return res;
+  8031f6:	49 63 c4             	movslq %r12d,%rax
+}
+  8031f9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803200:	5b                   	pop    %rbx
+  803201:	41 5c                	pop    %r12
+  803203:	41 5d                	pop    %r13
+  803205:	41 5e                	pop    %r14
+  803207:	41 5f                	pop    %r15
+  803209:	5d                   	pop    %rbp
+  80320a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80320b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803211:	eb e3                	jmp    8031f6 <devcons_write+0x85>
+
+0000000000803213 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803213:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803216:	ba 00 00 00 00       	mov    $0x0,%edx
+  80321b:	48 85 c0             	test   %rax,%rax
+  80321e:	74 55                	je     803275 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803220:	55                   	push   %rbp
+  803221:	48 89 e5             	mov    %rsp,%rbp
+  803224:	41 55                	push   %r13
+  803226:	41 54                	push   %r12
+  803228:	53                   	push   %rbx
+  803229:	48 83 ec 08          	sub    $0x8,%rsp
+  80322d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803230:	48 bb 3b 01 80 00 00 	movabs $0x80013b,%rbx
+  803237:	00 00 00 
+  80323a:	49 bc f0 01 80 00 00 	movabs $0x8001f0,%r12
+  803241:	00 00 00 
+  803244:	eb 03                	jmp    803249 <devcons_read+0x36>
+  803246:	41 ff d4             	call   *%r12
+  803249:	ff d3                	call   *%rbx
+  80324b:	85 c0                	test   %eax,%eax
+  80324d:	74 f7                	je     803246 <devcons_read+0x33>
+    if (c < 0) return c;
+  80324f:	48 63 d0             	movslq %eax,%rdx
+  803252:	78 13                	js     803267 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803254:	ba 00 00 00 00       	mov    $0x0,%edx
+  803259:	83 f8 04             	cmp    $0x4,%eax
+  80325c:	74 09                	je     803267 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80325e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803262:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803267:	48 89 d0             	mov    %rdx,%rax
+  80326a:	48 83 c4 08          	add    $0x8,%rsp
+  80326e:	5b                   	pop    %rbx
+  80326f:	41 5c                	pop    %r12
+  803271:	41 5d                	pop    %r13
+  803273:	5d                   	pop    %rbp
+  803274:	c3                   	ret
+  803275:	48 89 d0             	mov    %rdx,%rax
+  803278:	c3                   	ret
+
+0000000000803279 <cputchar>:
+cputchar(int ch) {
+  803279:	55                   	push   %rbp
+  80327a:	48 89 e5             	mov    %rsp,%rbp
+  80327d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803281:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803285:	be 01 00 00 00       	mov    $0x1,%esi
+  80328a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80328e:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  803295:	00 00 00 
+  803298:	ff d0                	call   *%rax
+}
+  80329a:	c9                   	leave
+  80329b:	c3                   	ret
+
+000000000080329c <getchar>:
+getchar(void) {
+  80329c:	55                   	push   %rbp
+  80329d:	48 89 e5             	mov    %rsp,%rbp
+  8032a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032a9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032b2:	48 b8 f8 09 80 00 00 	movabs $0x8009f8,%rax
+  8032b9:	00 00 00 
+  8032bc:	ff d0                	call   *%rax
+  8032be:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032c0:	85 c0                	test   %eax,%eax
+  8032c2:	78 06                	js     8032ca <getchar+0x2e>
+  8032c4:	74 08                	je     8032ce <getchar+0x32>
+  8032c6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032ca:	89 d0                	mov    %edx,%eax
+  8032cc:	c9                   	leave
+  8032cd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032ce:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032d3:	eb f5                	jmp    8032ca <getchar+0x2e>
+
+00000000008032d5 <iscons>:
+iscons(int fdnum) {
+  8032d5:	55                   	push   %rbp
+  8032d6:	48 89 e5             	mov    %rsp,%rbp
+  8032d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032e1:	48 b8 15 07 80 00 00 	movabs $0x800715,%rax
+  8032e8:	00 00 00 
+  8032eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032ed:	85 c0                	test   %eax,%eax
+  8032ef:	78 18                	js     803309 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032f5:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032fc:	00 00 00 
+  8032ff:	8b 00                	mov    (%rax),%eax
+  803301:	39 02                	cmp    %eax,(%rdx)
+  803303:	0f 94 c0             	sete   %al
+  803306:	0f b6 c0             	movzbl %al,%eax
+}
+  803309:	c9                   	leave
+  80330a:	c3                   	ret
+
+000000000080330b <opencons>:
+opencons(void) {
+  80330b:	55                   	push   %rbp
+  80330c:	48 89 e5             	mov    %rsp,%rbp
+  80330f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803313:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803317:	48 b8 b5 06 80 00 00 	movabs $0x8006b5,%rax
+  80331e:	00 00 00 
+  803321:	ff d0                	call   *%rax
+  803323:	85 c0                	test   %eax,%eax
+  803325:	78 49                	js     803370 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803327:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80332c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803331:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803335:	bf 00 00 00 00       	mov    $0x0,%edi
+  80333a:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  803341:	00 00 00 
+  803344:	ff d0                	call   *%rax
+  803346:	85 c0                	test   %eax,%eax
+  803348:	78 26                	js     803370 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80334a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80334e:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803355:	00 00 
+  803357:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803359:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80335d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803364:	48 b8 87 06 80 00 00 	movabs $0x800687,%rax
+  80336b:	00 00 00 
+  80336e:	ff d0                	call   *%rax
+}
+  803370:	c9                   	leave
+  803371:	c3                   	ret
+
+0000000000803372 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803372:	55                   	push   %rbp
+  803373:	48 89 e5             	mov    %rsp,%rbp
+  803376:	41 56                	push   %r14
+  803378:	41 55                	push   %r13
+  80337a:	41 54                	push   %r12
+  80337c:	53                   	push   %rbx
+  80337d:	48 83 ec 50          	sub    $0x50,%rsp
+  803381:	49 89 fc             	mov    %rdi,%r12
+  803384:	41 89 f5             	mov    %esi,%r13d
+  803387:	48 89 d3             	mov    %rdx,%rbx
+  80338a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80338e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803392:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803396:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80339d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033a1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033a5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033ad:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8033b4:	00 00 00 
+  8033b7:	4c 8b 30             	mov    (%rax),%r14
+  8033ba:	48 b8 c7 01 80 00 00 	movabs $0x8001c7,%rax
+  8033c1:	00 00 00 
+  8033c4:	ff d0                	call   *%rax
+  8033c6:	89 c6                	mov    %eax,%esi
+  8033c8:	45 89 e8             	mov    %r13d,%r8d
+  8033cb:	4c 89 e1             	mov    %r12,%rcx
+  8033ce:	4c 89 f2             	mov    %r14,%rdx
+  8033d1:	48 bf 00 48 80 00 00 	movabs $0x804800,%rdi
+  8033d8:	00 00 00 
+  8033db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033e0:	49 bc c2 34 80 00 00 	movabs $0x8034c2,%r12
+  8033e7:	00 00 00 
+  8033ea:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033ed:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033f1:	48 89 df             	mov    %rbx,%rdi
+  8033f4:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+    cprintf("\n");
+  803400:	48 bf 43 47 80 00 00 	movabs $0x804743,%rdi
+  803407:	00 00 00 
+  80340a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803412:	cc                   	int3
+  803413:	eb fd                	jmp    803412 <_panic+0xa0>
+
+0000000000803415 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+  803419:	53                   	push   %rbx
+  80341a:	48 83 ec 08          	sub    $0x8,%rsp
+  80341e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803421:	8b 06                	mov    (%rsi),%eax
+  803423:	8d 50 01             	lea    0x1(%rax),%edx
+  803426:	89 16                	mov    %edx,(%rsi)
+  803428:	48 98                	cltq
+  80342a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80342f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803435:	74 0a                	je     803441 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803437:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80343b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80343f:	c9                   	leave
+  803440:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803441:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803445:	be ff 00 00 00       	mov    $0xff,%esi
+  80344a:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+        state->offset = 0;
+  803456:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80345c:	eb d9                	jmp    803437 <putch+0x22>
+
+000000000080345e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80345e:	55                   	push   %rbp
+  80345f:	48 89 e5             	mov    %rsp,%rbp
+  803462:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803469:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80346c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803473:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803478:	b8 00 00 00 00       	mov    $0x0,%eax
+  80347d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803480:	48 89 f1             	mov    %rsi,%rcx
+  803483:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80348a:	48 bf 15 34 80 00 00 	movabs $0x803415,%rdi
+  803491:	00 00 00 
+  803494:	48 b8 12 36 80 00 00 	movabs $0x803612,%rax
+  80349b:	00 00 00 
+  80349e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8034a0:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034a7:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8034ae:	48 b8 1c 01 80 00 00 	movabs $0x80011c,%rax
+  8034b5:	00 00 00 
+  8034b8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034ba:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034c0:	c9                   	leave
+  8034c1:	c3                   	ret
+
+00000000008034c2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034c2:	55                   	push   %rbp
+  8034c3:	48 89 e5             	mov    %rsp,%rbp
+  8034c6:	48 83 ec 50          	sub    $0x50,%rsp
+  8034ca:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034ce:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034d2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034d6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034da:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034de:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034e5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034ed:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034f1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034f5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034f9:	48 b8 5e 34 80 00 00 	movabs $0x80345e,%rax
+  803500:	00 00 00 
+  803503:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803505:	c9                   	leave
+  803506:	c3                   	ret
+
+0000000000803507 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803507:	55                   	push   %rbp
+  803508:	48 89 e5             	mov    %rsp,%rbp
+  80350b:	41 57                	push   %r15
+  80350d:	41 56                	push   %r14
+  80350f:	41 55                	push   %r13
+  803511:	41 54                	push   %r12
+  803513:	53                   	push   %rbx
+  803514:	48 83 ec 18          	sub    $0x18,%rsp
+  803518:	49 89 fc             	mov    %rdi,%r12
+  80351b:	49 89 f5             	mov    %rsi,%r13
+  80351e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803522:	8b 45 10             	mov    0x10(%rbp),%eax
+  803525:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803528:	41 89 cf             	mov    %ecx,%r15d
+  80352b:	4c 39 fa             	cmp    %r15,%rdx
+  80352e:	73 5b                	jae    80358b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803530:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803534:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803538:	85 db                	test   %ebx,%ebx
+  80353a:	7e 0e                	jle    80354a <print_num+0x43>
+            putch(padc, put_arg);
+  80353c:	4c 89 ee             	mov    %r13,%rsi
+  80353f:	44 89 f7             	mov    %r14d,%edi
+  803542:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803545:	83 eb 01             	sub    $0x1,%ebx
+  803548:	75 f2                	jne    80353c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80354a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80354e:	48 b9 34 48 80 00 00 	movabs $0x804834,%rcx
+  803555:	00 00 00 
+  803558:	48 b8 23 48 80 00 00 	movabs $0x804823,%rax
+  80355f:	00 00 00 
+  803562:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803566:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80356a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80356f:	49 f7 f7             	div    %r15
+  803572:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803576:	4c 89 ee             	mov    %r13,%rsi
+  803579:	41 ff d4             	call   *%r12
+}
+  80357c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803580:	5b                   	pop    %rbx
+  803581:	41 5c                	pop    %r12
+  803583:	41 5d                	pop    %r13
+  803585:	41 5e                	pop    %r14
+  803587:	41 5f                	pop    %r15
+  803589:	5d                   	pop    %rbp
+  80358a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80358b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80358f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803594:	49 f7 f7             	div    %r15
+  803597:	48 83 ec 08          	sub    $0x8,%rsp
+  80359b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80359f:	52                   	push   %rdx
+  8035a0:	45 0f be c9          	movsbl %r9b,%r9d
+  8035a4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035a8:	48 89 c2             	mov    %rax,%rdx
+  8035ab:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+  8035b7:	48 83 c4 10          	add    $0x10,%rsp
+  8035bb:	eb 8d                	jmp    80354a <print_num+0x43>
+
+00000000008035bd <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035bd:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035c1:	48 8b 06             	mov    (%rsi),%rax
+  8035c4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035c8:	73 0a                	jae    8035d4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8035ca:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035ce:	48 89 16             	mov    %rdx,(%rsi)
+  8035d1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035d4:	c3                   	ret
+
+00000000008035d5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035d5:	55                   	push   %rbp
+  8035d6:	48 89 e5             	mov    %rsp,%rbp
+  8035d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8035dd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035e1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035e5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035e9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035f0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035f8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803600:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803604:	48 b8 12 36 80 00 00 	movabs $0x803612,%rax
+  80360b:	00 00 00 
+  80360e:	ff d0                	call   *%rax
+}
+  803610:	c9                   	leave
+  803611:	c3                   	ret
+
+0000000000803612 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803612:	55                   	push   %rbp
+  803613:	48 89 e5             	mov    %rsp,%rbp
+  803616:	41 57                	push   %r15
+  803618:	41 56                	push   %r14
+  80361a:	41 55                	push   %r13
+  80361c:	41 54                	push   %r12
+  80361e:	53                   	push   %rbx
+  80361f:	48 83 ec 38          	sub    $0x38,%rsp
+  803623:	49 89 fe             	mov    %rdi,%r14
+  803626:	49 89 f5             	mov    %rsi,%r13
+  803629:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80362c:	48 8b 01             	mov    (%rcx),%rax
+  80362f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803633:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803637:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80363b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80363f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803643:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803647:	0f b6 3b             	movzbl (%rbx),%edi
+  80364a:	40 80 ff 25          	cmp    $0x25,%dil
+  80364e:	74 18                	je     803668 <vprintfmt+0x56>
+            if (!ch) return;
+  803650:	40 84 ff             	test   %dil,%dil
+  803653:	0f 84 b1 06 00 00    	je     803d0a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803659:	40 0f b6 ff          	movzbl %dil,%edi
+  80365d:	4c 89 ee             	mov    %r13,%rsi
+  803660:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803663:	4c 89 e3             	mov    %r12,%rbx
+  803666:	eb db                	jmp    803643 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803668:	be 00 00 00 00       	mov    $0x0,%esi
+  80366d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803671:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803676:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80367c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803683:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803687:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80368c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803691:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803694:	83 e8 23             	sub    $0x23,%eax
+  803697:	3c 57                	cmp    $0x57,%al
+  803699:	0f 87 51 06 00 00    	ja     803cf0 <vprintfmt+0x6de>
+  80369f:	0f b6 c0             	movzbl %al,%eax
+  8036a2:	48 b9 e0 49 80 00 00 	movabs $0x8049e0,%rcx
+  8036a9:	00 00 00 
+  8036ac:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8036af:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036b2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036b6:	eb cf                	jmp    803687 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036b8:	49 89 dc             	mov    %rbx,%r12
+  8036bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8036c0:	eb c5                	jmp    803687 <vprintfmt+0x75>
+            padc = ch;
+  8036c2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036c6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036c9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036cc:	eb b9                	jmp    803687 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036ce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036d1:	83 f8 2f             	cmp    $0x2f,%eax
+  8036d4:	77 24                	ja     8036fa <vprintfmt+0xe8>
+  8036d6:	89 c1                	mov    %eax,%ecx
+  8036d8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036dc:	83 c0 08             	add    $0x8,%eax
+  8036df:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036e2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036e5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036e8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036ec:	79 99                	jns    803687 <vprintfmt+0x75>
+                width = precision;
+  8036ee:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036f2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036f8:	eb 8d                	jmp    803687 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036fa:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036fe:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803702:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803706:	eb da                	jmp    8036e2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803708:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80370d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803711:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803717:	3c 39                	cmp    $0x39,%al
+  803719:	77 1c                	ja     803737 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80371b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80371f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803723:	0f b6 c0             	movzbl %al,%eax
+  803726:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80372b:	0f b6 03             	movzbl (%rbx),%eax
+  80372e:	3c 39                	cmp    $0x39,%al
+  803730:	76 e9                	jbe    80371b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803732:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803735:	eb b1                	jmp    8036e8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803737:	49 89 dc             	mov    %rbx,%r12
+  80373a:	eb ac                	jmp    8036e8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80373c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80373f:	85 c9                	test   %ecx,%ecx
+  803741:	b8 00 00 00 00       	mov    $0x0,%eax
+  803746:	0f 49 c1             	cmovns %ecx,%eax
+  803749:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80374c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80374f:	e9 33 ff ff ff       	jmp    803687 <vprintfmt+0x75>
+            lflag++;
+  803754:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803757:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80375a:	e9 28 ff ff ff       	jmp    803687 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80375f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803762:	83 f8 2f             	cmp    $0x2f,%eax
+  803765:	77 19                	ja     803780 <vprintfmt+0x16e>
+  803767:	89 c2                	mov    %eax,%edx
+  803769:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80376d:	83 c0 08             	add    $0x8,%eax
+  803770:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803773:	8b 3a                	mov    (%rdx),%edi
+  803775:	4c 89 ee             	mov    %r13,%rsi
+  803778:	41 ff d6             	call   *%r14
+            break;
+  80377b:	e9 c3 fe ff ff       	jmp    803643 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803780:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803784:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803788:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80378c:	eb e5                	jmp    803773 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80378e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803791:	83 f8 2f             	cmp    $0x2f,%eax
+  803794:	77 5a                	ja     8037f0 <vprintfmt+0x1de>
+  803796:	89 c2                	mov    %eax,%edx
+  803798:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80379c:	83 c0 08             	add    $0x8,%eax
+  80379f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8037a2:	8b 02                	mov    (%rdx),%eax
+  8037a4:	89 c1                	mov    %eax,%ecx
+  8037a6:	f7 d9                	neg    %ecx
+  8037a8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8037ab:	83 f9 16             	cmp    $0x16,%ecx
+  8037ae:	7f 4e                	jg     8037fe <vprintfmt+0x1ec>
+  8037b0:	48 63 c1             	movslq %ecx,%rax
+  8037b3:	48 ba a0 4c 80 00 00 	movabs $0x804ca0,%rdx
+  8037ba:	00 00 00 
+  8037bd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037c1:	48 85 c0             	test   %rax,%rax
+  8037c4:	74 38                	je     8037fe <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037c6:	48 89 c1             	mov    %rax,%rcx
+  8037c9:	48 ba b9 47 80 00 00 	movabs $0x8047b9,%rdx
+  8037d0:	00 00 00 
+  8037d3:	4c 89 ee             	mov    %r13,%rsi
+  8037d6:	4c 89 f7             	mov    %r14,%rdi
+  8037d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037de:	49 b8 d5 35 80 00 00 	movabs $0x8035d5,%r8
+  8037e5:	00 00 00 
+  8037e8:	41 ff d0             	call   *%r8
+  8037eb:	e9 53 fe ff ff       	jmp    803643 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037fc:	eb a4                	jmp    8037a2 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037fe:	48 ba 4c 48 80 00 00 	movabs $0x80484c,%rdx
+  803805:	00 00 00 
+  803808:	4c 89 ee             	mov    %r13,%rsi
+  80380b:	4c 89 f7             	mov    %r14,%rdi
+  80380e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803813:	49 b8 d5 35 80 00 00 	movabs $0x8035d5,%r8
+  80381a:	00 00 00 
+  80381d:	41 ff d0             	call   *%r8
+  803820:	e9 1e fe ff ff       	jmp    803643 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803825:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803828:	83 f8 2f             	cmp    $0x2f,%eax
+  80382b:	77 6c                	ja     803899 <vprintfmt+0x287>
+  80382d:	89 c2                	mov    %eax,%edx
+  80382f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803833:	83 c0 08             	add    $0x8,%eax
+  803836:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803839:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80383c:	48 85 d2             	test   %rdx,%rdx
+  80383f:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  803846:	00 00 00 
+  803849:	48 0f 45 c2          	cmovne %rdx,%rax
+  80384d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803851:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803855:	7e 06                	jle    80385d <vprintfmt+0x24b>
+  803857:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80385b:	75 4a                	jne    8038a7 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80385d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803861:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803865:	0f b6 00             	movzbl (%rax),%eax
+  803868:	84 c0                	test   %al,%al
+  80386a:	0f 85 9a 00 00 00    	jne    80390a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803870:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803873:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803877:	85 c0                	test   %eax,%eax
+  803879:	0f 8e c4 fd ff ff    	jle    803643 <vprintfmt+0x31>
+  80387f:	4c 89 ee             	mov    %r13,%rsi
+  803882:	bf 20 00 00 00       	mov    $0x20,%edi
+  803887:	41 ff d6             	call   *%r14
+  80388a:	41 83 ec 01          	sub    $0x1,%r12d
+  80388e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803892:	75 eb                	jne    80387f <vprintfmt+0x26d>
+  803894:	e9 aa fd ff ff       	jmp    803643 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803899:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80389d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038a5:	eb 92                	jmp    803839 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038a7:	49 63 f7             	movslq %r15d,%rsi
+  8038aa:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8038ae:	48 b8 c4 3d 80 00 00 	movabs $0x803dc4,%rax
+  8038b5:	00 00 00 
+  8038b8:	ff d0                	call   *%rax
+  8038ba:	48 89 c2             	mov    %rax,%rdx
+  8038bd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038c2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038c5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038c8:	85 c0                	test   %eax,%eax
+  8038ca:	7e 91                	jle    80385d <vprintfmt+0x24b>
+  8038cc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038d1:	4c 89 ee             	mov    %r13,%rsi
+  8038d4:	44 89 e7             	mov    %r12d,%edi
+  8038d7:	41 ff d6             	call   *%r14
+  8038da:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038de:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038e1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038e4:	75 eb                	jne    8038d1 <vprintfmt+0x2bf>
+  8038e6:	e9 72 ff ff ff       	jmp    80385d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038eb:	0f b6 f8             	movzbl %al,%edi
+  8038ee:	4c 89 ee             	mov    %r13,%rsi
+  8038f1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038f4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038f8:	49 83 c4 01          	add    $0x1,%r12
+  8038fc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803902:	84 c0                	test   %al,%al
+  803904:	0f 84 66 ff ff ff    	je     803870 <vprintfmt+0x25e>
+  80390a:	45 85 ff             	test   %r15d,%r15d
+  80390d:	78 0a                	js     803919 <vprintfmt+0x307>
+  80390f:	41 83 ef 01          	sub    $0x1,%r15d
+  803913:	0f 88 57 ff ff ff    	js     803870 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803919:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80391d:	74 cc                	je     8038eb <vprintfmt+0x2d9>
+  80391f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803922:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803927:	80 fa 5e             	cmp    $0x5e,%dl
+  80392a:	77 c2                	ja     8038ee <vprintfmt+0x2dc>
+  80392c:	eb bd                	jmp    8038eb <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80392e:	40 84 f6             	test   %sil,%sil
+  803931:	75 26                	jne    803959 <vprintfmt+0x347>
+    switch (lflag) {
+  803933:	85 d2                	test   %edx,%edx
+  803935:	74 59                	je     803990 <vprintfmt+0x37e>
+  803937:	83 fa 01             	cmp    $0x1,%edx
+  80393a:	74 7b                	je     8039b7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80393c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393f:	83 f8 2f             	cmp    $0x2f,%eax
+  803942:	0f 87 96 00 00 00    	ja     8039de <vprintfmt+0x3cc>
+  803948:	89 c2                	mov    %eax,%edx
+  80394a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80394e:	83 c0 08             	add    $0x8,%eax
+  803951:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803954:	4c 8b 22             	mov    (%rdx),%r12
+  803957:	eb 17                	jmp    803970 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803959:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80395c:	83 f8 2f             	cmp    $0x2f,%eax
+  80395f:	77 21                	ja     803982 <vprintfmt+0x370>
+  803961:	89 c2                	mov    %eax,%edx
+  803963:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803967:	83 c0 08             	add    $0x8,%eax
+  80396a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80396d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803970:	4d 85 e4             	test   %r12,%r12
+  803973:	78 7a                	js     8039ef <vprintfmt+0x3dd>
+            num = i;
+  803975:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803978:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80397d:	e9 50 02 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803982:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803986:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80398a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80398e:	eb dd                	jmp    80396d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803993:	83 f8 2f             	cmp    $0x2f,%eax
+  803996:	77 11                	ja     8039a9 <vprintfmt+0x397>
+  803998:	89 c2                	mov    %eax,%edx
+  80399a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80399e:	83 c0 08             	add    $0x8,%eax
+  8039a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039a4:	4c 63 22             	movslq (%rdx),%r12
+  8039a7:	eb c7                	jmp    803970 <vprintfmt+0x35e>
+  8039a9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039ad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b5:	eb ed                	jmp    8039a4 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039b7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039ba:	83 f8 2f             	cmp    $0x2f,%eax
+  8039bd:	77 11                	ja     8039d0 <vprintfmt+0x3be>
+  8039bf:	89 c2                	mov    %eax,%edx
+  8039c1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039c5:	83 c0 08             	add    $0x8,%eax
+  8039c8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039cb:	4c 8b 22             	mov    (%rdx),%r12
+  8039ce:	eb a0                	jmp    803970 <vprintfmt+0x35e>
+  8039d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039dc:	eb ed                	jmp    8039cb <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039ea:	e9 65 ff ff ff       	jmp    803954 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039ef:	4c 89 ee             	mov    %r13,%rsi
+  8039f2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039f7:	41 ff d6             	call   *%r14
+                i = -i;
+  8039fa:	49 f7 dc             	neg    %r12
+  8039fd:	e9 73 ff ff ff       	jmp    803975 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803a02:	40 84 f6             	test   %sil,%sil
+  803a05:	75 32                	jne    803a39 <vprintfmt+0x427>
+    switch (lflag) {
+  803a07:	85 d2                	test   %edx,%edx
+  803a09:	74 5d                	je     803a68 <vprintfmt+0x456>
+  803a0b:	83 fa 01             	cmp    $0x1,%edx
+  803a0e:	0f 84 82 00 00 00    	je     803a96 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a14:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a17:	83 f8 2f             	cmp    $0x2f,%eax
+  803a1a:	0f 87 a5 00 00 00    	ja     803ac5 <vprintfmt+0x4b3>
+  803a20:	89 c2                	mov    %eax,%edx
+  803a22:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a26:	83 c0 08             	add    $0x8,%eax
+  803a29:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a2c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a2f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a34:	e9 99 01 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a39:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a3c:	83 f8 2f             	cmp    $0x2f,%eax
+  803a3f:	77 19                	ja     803a5a <vprintfmt+0x448>
+  803a41:	89 c2                	mov    %eax,%edx
+  803a43:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a47:	83 c0 08             	add    $0x8,%eax
+  803a4a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a4d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a50:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a55:	e9 78 01 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+  803a5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a66:	eb e5                	jmp    803a4d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a6b:	83 f8 2f             	cmp    $0x2f,%eax
+  803a6e:	77 18                	ja     803a88 <vprintfmt+0x476>
+  803a70:	89 c2                	mov    %eax,%edx
+  803a72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a76:	83 c0 08             	add    $0x8,%eax
+  803a79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a7c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a7e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a83:	e9 4a 01 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+  803a88:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a8c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a90:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a94:	eb e6                	jmp    803a7c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a96:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a99:	83 f8 2f             	cmp    $0x2f,%eax
+  803a9c:	77 19                	ja     803ab7 <vprintfmt+0x4a5>
+  803a9e:	89 c2                	mov    %eax,%edx
+  803aa0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803aa4:	83 c0 08             	add    $0x8,%eax
+  803aa7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aaa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803aad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803ab2:	e9 1b 01 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+  803ab7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803abb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803abf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ac3:	eb e5                	jmp    803aaa <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ad1:	e9 56 ff ff ff       	jmp    803a2c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ad6:	40 84 f6             	test   %sil,%sil
+  803ad9:	75 2e                	jne    803b09 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803adb:	85 d2                	test   %edx,%edx
+  803add:	74 59                	je     803b38 <vprintfmt+0x526>
+  803adf:	83 fa 01             	cmp    $0x1,%edx
+  803ae2:	74 7f                	je     803b63 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803ae4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ae7:	83 f8 2f             	cmp    $0x2f,%eax
+  803aea:	0f 87 9f 00 00 00    	ja     803b8f <vprintfmt+0x57d>
+  803af0:	89 c2                	mov    %eax,%edx
+  803af2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803af6:	83 c0 08             	add    $0x8,%eax
+  803af9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803afc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803aff:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803b04:	e9 c9 00 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b0c:	83 f8 2f             	cmp    $0x2f,%eax
+  803b0f:	77 19                	ja     803b2a <vprintfmt+0x518>
+  803b11:	89 c2                	mov    %eax,%edx
+  803b13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b17:	83 c0 08             	add    $0x8,%eax
+  803b1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b20:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b25:	e9 a8 00 00 00       	jmp    803bd2 <vprintfmt+0x5c0>
+  803b2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b36:	eb e5                	jmp    803b1d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b38:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b3b:	83 f8 2f             	cmp    $0x2f,%eax
+  803b3e:	77 15                	ja     803b55 <vprintfmt+0x543>
+  803b40:	89 c2                	mov    %eax,%edx
+  803b42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b46:	83 c0 08             	add    $0x8,%eax
+  803b49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b4c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b4e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b53:	eb 7d                	jmp    803bd2 <vprintfmt+0x5c0>
+  803b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b61:	eb e9                	jmp    803b4c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b66:	83 f8 2f             	cmp    $0x2f,%eax
+  803b69:	77 16                	ja     803b81 <vprintfmt+0x56f>
+  803b6b:	89 c2                	mov    %eax,%edx
+  803b6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b71:	83 c0 08             	add    $0x8,%eax
+  803b74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b77:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b7a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b7f:	eb 51                	jmp    803bd2 <vprintfmt+0x5c0>
+  803b81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b8d:	eb e8                	jmp    803b77 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b9b:	e9 5c ff ff ff       	jmp    803afc <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803ba0:	4c 89 ee             	mov    %r13,%rsi
+  803ba3:	bf 30 00 00 00       	mov    $0x30,%edi
+  803ba8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803bab:	4c 89 ee             	mov    %r13,%rsi
+  803bae:	bf 78 00 00 00       	mov    $0x78,%edi
+  803bb3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803bb6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bb9:	83 f8 2f             	cmp    $0x2f,%eax
+  803bbc:	77 47                	ja     803c05 <vprintfmt+0x5f3>
+  803bbe:	89 c2                	mov    %eax,%edx
+  803bc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bc4:	83 c0 08             	add    $0x8,%eax
+  803bc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bca:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bcd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bd2:	48 83 ec 08          	sub    $0x8,%rsp
+  803bd6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bda:	0f 94 c0             	sete   %al
+  803bdd:	0f b6 c0             	movzbl %al,%eax
+  803be0:	50                   	push   %rax
+  803be1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803be6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bea:	4c 89 ee             	mov    %r13,%rsi
+  803bed:	4c 89 f7             	mov    %r14,%rdi
+  803bf0:	48 b8 07 35 80 00 00 	movabs $0x803507,%rax
+  803bf7:	00 00 00 
+  803bfa:	ff d0                	call   *%rax
+            break;
+  803bfc:	48 83 c4 10          	add    $0x10,%rsp
+  803c00:	e9 3e fa ff ff       	jmp    803643 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c05:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c09:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c0d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c11:	eb b7                	jmp    803bca <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c13:	40 84 f6             	test   %sil,%sil
+  803c16:	75 2b                	jne    803c43 <vprintfmt+0x631>
+    switch (lflag) {
+  803c18:	85 d2                	test   %edx,%edx
+  803c1a:	74 56                	je     803c72 <vprintfmt+0x660>
+  803c1c:	83 fa 01             	cmp    $0x1,%edx
+  803c1f:	74 7f                	je     803ca0 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c24:	83 f8 2f             	cmp    $0x2f,%eax
+  803c27:	0f 87 a2 00 00 00    	ja     803ccf <vprintfmt+0x6bd>
+  803c2d:	89 c2                	mov    %eax,%edx
+  803c2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c33:	83 c0 08             	add    $0x8,%eax
+  803c36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c41:	eb 8f                	jmp    803bd2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c46:	83 f8 2f             	cmp    $0x2f,%eax
+  803c49:	77 19                	ja     803c64 <vprintfmt+0x652>
+  803c4b:	89 c2                	mov    %eax,%edx
+  803c4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c51:	83 c0 08             	add    $0x8,%eax
+  803c54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c57:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c5a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c5f:	e9 6e ff ff ff       	jmp    803bd2 <vprintfmt+0x5c0>
+  803c64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c70:	eb e5                	jmp    803c57 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c75:	83 f8 2f             	cmp    $0x2f,%eax
+  803c78:	77 18                	ja     803c92 <vprintfmt+0x680>
+  803c7a:	89 c2                	mov    %eax,%edx
+  803c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c80:	83 c0 08             	add    $0x8,%eax
+  803c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c86:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c88:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c8d:	e9 40 ff ff ff       	jmp    803bd2 <vprintfmt+0x5c0>
+  803c92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c9e:	eb e6                	jmp    803c86 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803ca0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ca3:	83 f8 2f             	cmp    $0x2f,%eax
+  803ca6:	77 19                	ja     803cc1 <vprintfmt+0x6af>
+  803ca8:	89 c2                	mov    %eax,%edx
+  803caa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cae:	83 c0 08             	add    $0x8,%eax
+  803cb1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cb4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803cb7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803cbc:	e9 11 ff ff ff       	jmp    803bd2 <vprintfmt+0x5c0>
+  803cc1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ccd:	eb e5                	jmp    803cb4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803ccf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cdb:	e9 59 ff ff ff       	jmp    803c39 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803ce0:	4c 89 ee             	mov    %r13,%rsi
+  803ce3:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ce8:	41 ff d6             	call   *%r14
+            break;
+  803ceb:	e9 53 f9 ff ff       	jmp    803643 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cf0:	4c 89 ee             	mov    %r13,%rsi
+  803cf3:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cf8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803cfb:	48 83 eb 01          	sub    $0x1,%rbx
+  803cff:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803d03:	75 f6                	jne    803cfb <vprintfmt+0x6e9>
+  803d05:	e9 39 f9 ff ff       	jmp    803643 <vprintfmt+0x31>
+}
+  803d0a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d0e:	5b                   	pop    %rbx
+  803d0f:	41 5c                	pop    %r12
+  803d11:	41 5d                	pop    %r13
+  803d13:	41 5e                	pop    %r14
+  803d15:	41 5f                	pop    %r15
+  803d17:	5d                   	pop    %rbp
+  803d18:	c3                   	ret
+
+0000000000803d19 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d19:	55                   	push   %rbp
+  803d1a:	48 89 e5             	mov    %rsp,%rbp
+  803d1d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d21:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d25:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d2a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d2e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d35:	48 85 ff             	test   %rdi,%rdi
+  803d38:	74 2b                	je     803d65 <vsnprintf+0x4c>
+  803d3a:	48 85 f6             	test   %rsi,%rsi
+  803d3d:	74 26                	je     803d65 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d3f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d43:	48 bf bd 35 80 00 00 	movabs $0x8035bd,%rdi
+  803d4a:	00 00 00 
+  803d4d:	48 b8 12 36 80 00 00 	movabs $0x803612,%rax
+  803d54:	00 00 00 
+  803d57:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d59:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d5d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d60:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d63:	c9                   	leave
+  803d64:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d65:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d6a:	eb f7                	jmp    803d63 <vsnprintf+0x4a>
+
+0000000000803d6c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d6c:	55                   	push   %rbp
+  803d6d:	48 89 e5             	mov    %rsp,%rbp
+  803d70:	48 83 ec 50          	sub    $0x50,%rsp
+  803d74:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d78:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d7c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d80:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d87:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d8b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d8f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d97:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d9b:	48 b8 19 3d 80 00 00 	movabs $0x803d19,%rax
+  803da2:	00 00 00 
+  803da5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803da7:	c9                   	leave
+  803da8:	c3                   	ret
+
+0000000000803da9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803da9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803dac:	74 10                	je     803dbe <strlen+0x15>
+    size_t n = 0;
+  803dae:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803db3:	48 83 c0 01          	add    $0x1,%rax
+  803db7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803dbb:	75 f6                	jne    803db3 <strlen+0xa>
+  803dbd:	c3                   	ret
+    size_t n = 0;
+  803dbe:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dc3:	c3                   	ret
+
+0000000000803dc4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803dc4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803dc7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dcc:	48 85 f6             	test   %rsi,%rsi
+  803dcf:	74 11                	je     803de2 <strnlen+0x1e>
+  803dd1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dd5:	74 0c                	je     803de3 <strnlen+0x1f>
+  803dd7:	48 83 c2 01          	add    $0x1,%rdx
+  803ddb:	48 39 d0             	cmp    %rdx,%rax
+  803dde:	75 f1                	jne    803dd1 <strnlen+0xd>
+  803de0:	eb 04                	jmp    803de6 <strnlen+0x22>
+  803de2:	c3                   	ret
+  803de3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803de6:	c3                   	ret
+
+0000000000803de7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803de7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dea:	ba 00 00 00 00       	mov    $0x0,%edx
+  803def:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803df3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803df6:	48 83 c2 01          	add    $0x1,%rdx
+  803dfa:	84 c9                	test   %cl,%cl
+  803dfc:	75 f1                	jne    803def <strcpy+0x8>
+        ;
+    return res;
+}
+  803dfe:	c3                   	ret
+
+0000000000803dff <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803dff:	55                   	push   %rbp
+  803e00:	48 89 e5             	mov    %rsp,%rbp
+  803e03:	41 54                	push   %r12
+  803e05:	53                   	push   %rbx
+  803e06:	48 89 fb             	mov    %rdi,%rbx
+  803e09:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e0c:	48 b8 a9 3d 80 00 00 	movabs $0x803da9,%rax
+  803e13:	00 00 00 
+  803e16:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e18:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e1c:	4c 89 e6             	mov    %r12,%rsi
+  803e1f:	48 b8 e7 3d 80 00 00 	movabs $0x803de7,%rax
+  803e26:	00 00 00 
+  803e29:	ff d0                	call   *%rax
+    return dst;
+}
+  803e2b:	48 89 d8             	mov    %rbx,%rax
+  803e2e:	5b                   	pop    %rbx
+  803e2f:	41 5c                	pop    %r12
+  803e31:	5d                   	pop    %rbp
+  803e32:	c3                   	ret
+
+0000000000803e33 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e33:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e36:	48 85 d2             	test   %rdx,%rdx
+  803e39:	74 1f                	je     803e5a <strncpy+0x27>
+  803e3b:	48 01 fa             	add    %rdi,%rdx
+  803e3e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e41:	48 83 c1 01          	add    $0x1,%rcx
+  803e45:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e49:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e4d:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e51:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e55:	48 39 ca             	cmp    %rcx,%rdx
+  803e58:	75 e7                	jne    803e41 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e5a:	c3                   	ret
+
+0000000000803e5b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e5b:	48 89 f8             	mov    %rdi,%rax
+  803e5e:	48 85 d2             	test   %rdx,%rdx
+  803e61:	74 24                	je     803e87 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e63:	48 83 ea 01          	sub    $0x1,%rdx
+  803e67:	74 1b                	je     803e84 <strlcpy+0x29>
+  803e69:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e6d:	0f b6 16             	movzbl (%rsi),%edx
+  803e70:	84 d2                	test   %dl,%dl
+  803e72:	74 10                	je     803e84 <strlcpy+0x29>
+            *dst++ = *src++;
+  803e74:	48 83 c6 01          	add    $0x1,%rsi
+  803e78:	48 83 c0 01          	add    $0x1,%rax
+  803e7c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e7f:	48 39 c8             	cmp    %rcx,%rax
+  803e82:	75 e9                	jne    803e6d <strlcpy+0x12>
+        *dst = '\0';
+  803e84:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e87:	48 29 f8             	sub    %rdi,%rax
+}
+  803e8a:	c3                   	ret
+
+0000000000803e8b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e8b:	0f b6 07             	movzbl (%rdi),%eax
+  803e8e:	84 c0                	test   %al,%al
+  803e90:	74 13                	je     803ea5 <strcmp+0x1a>
+  803e92:	38 06                	cmp    %al,(%rsi)
+  803e94:	75 0f                	jne    803ea5 <strcmp+0x1a>
+  803e96:	48 83 c7 01          	add    $0x1,%rdi
+  803e9a:	48 83 c6 01          	add    $0x1,%rsi
+  803e9e:	0f b6 07             	movzbl (%rdi),%eax
+  803ea1:	84 c0                	test   %al,%al
+  803ea3:	75 ed                	jne    803e92 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ea5:	0f b6 c0             	movzbl %al,%eax
+  803ea8:	0f b6 16             	movzbl (%rsi),%edx
+  803eab:	29 d0                	sub    %edx,%eax
+}
+  803ead:	c3                   	ret
+
+0000000000803eae <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803eae:	48 85 d2             	test   %rdx,%rdx
+  803eb1:	74 1f                	je     803ed2 <strncmp+0x24>
+  803eb3:	0f b6 07             	movzbl (%rdi),%eax
+  803eb6:	84 c0                	test   %al,%al
+  803eb8:	74 1e                	je     803ed8 <strncmp+0x2a>
+  803eba:	3a 06                	cmp    (%rsi),%al
+  803ebc:	75 1a                	jne    803ed8 <strncmp+0x2a>
+  803ebe:	48 83 c7 01          	add    $0x1,%rdi
+  803ec2:	48 83 c6 01          	add    $0x1,%rsi
+  803ec6:	48 83 ea 01          	sub    $0x1,%rdx
+  803eca:	75 e7                	jne    803eb3 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ecc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed1:	c3                   	ret
+  803ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed7:	c3                   	ret
+  803ed8:	48 85 d2             	test   %rdx,%rdx
+  803edb:	74 09                	je     803ee6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803edd:	0f b6 07             	movzbl (%rdi),%eax
+  803ee0:	0f b6 16             	movzbl (%rsi),%edx
+  803ee3:	29 d0                	sub    %edx,%eax
+  803ee5:	c3                   	ret
+    if (!n) return 0;
+  803ee6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803eeb:	c3                   	ret
+
+0000000000803eec <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803eec:	0f b6 17             	movzbl (%rdi),%edx
+  803eef:	84 d2                	test   %dl,%dl
+  803ef1:	74 18                	je     803f0b <strchr+0x1f>
+        if (*str == c) {
+  803ef3:	0f be d2             	movsbl %dl,%edx
+  803ef6:	39 f2                	cmp    %esi,%edx
+  803ef8:	74 17                	je     803f11 <strchr+0x25>
+    for (; *str; str++) {
+  803efa:	48 83 c7 01          	add    $0x1,%rdi
+  803efe:	0f b6 17             	movzbl (%rdi),%edx
+  803f01:	84 d2                	test   %dl,%dl
+  803f03:	75 ee                	jne    803ef3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f05:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f0a:	c3                   	ret
+  803f0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f10:	c3                   	ret
+  803f11:	48 89 f8             	mov    %rdi,%rax
+}
+  803f14:	c3                   	ret
+
+0000000000803f15 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f15:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f18:	0f b6 17             	movzbl (%rdi),%edx
+  803f1b:	84 d2                	test   %dl,%dl
+  803f1d:	74 13                	je     803f32 <strfind+0x1d>
+  803f1f:	0f be d2             	movsbl %dl,%edx
+  803f22:	39 f2                	cmp    %esi,%edx
+  803f24:	74 0b                	je     803f31 <strfind+0x1c>
+  803f26:	48 83 c0 01          	add    $0x1,%rax
+  803f2a:	0f b6 10             	movzbl (%rax),%edx
+  803f2d:	84 d2                	test   %dl,%dl
+  803f2f:	75 ee                	jne    803f1f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f31:	c3                   	ret
+  803f32:	c3                   	ret
+
+0000000000803f33 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f33:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f36:	48 89 f8             	mov    %rdi,%rax
+  803f39:	48 f7 d8             	neg    %rax
+  803f3c:	83 e0 07             	and    $0x7,%eax
+  803f3f:	49 89 d1             	mov    %rdx,%r9
+  803f42:	49 29 c1             	sub    %rax,%r9
+  803f45:	78 36                	js     803f7d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f47:	40 0f b6 c6          	movzbl %sil,%eax
+  803f4b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f52:	01 01 01 
+  803f55:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f59:	40 f6 c7 07          	test   $0x7,%dil
+  803f5d:	75 38                	jne    803f97 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f5f:	4c 89 c9             	mov    %r9,%rcx
+  803f62:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f66:	74 0c                	je     803f74 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f68:	fc                   	cld
+  803f69:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f6c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f70:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f74:	4d 85 c9             	test   %r9,%r9
+  803f77:	75 45                	jne    803fbe <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f79:	4c 89 c0             	mov    %r8,%rax
+  803f7c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f7d:	48 85 d2             	test   %rdx,%rdx
+  803f80:	74 f7                	je     803f79 <memset+0x46>
+  803f82:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f85:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f88:	48 83 c0 01          	add    $0x1,%rax
+  803f8c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f90:	48 39 c2             	cmp    %rax,%rdx
+  803f93:	75 f3                	jne    803f88 <memset+0x55>
+  803f95:	eb e2                	jmp    803f79 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f97:	40 f6 c7 01          	test   $0x1,%dil
+  803f9b:	74 06                	je     803fa3 <memset+0x70>
+  803f9d:	88 07                	mov    %al,(%rdi)
+  803f9f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fa3:	40 f6 c7 02          	test   $0x2,%dil
+  803fa7:	74 07                	je     803fb0 <memset+0x7d>
+  803fa9:	66 89 07             	mov    %ax,(%rdi)
+  803fac:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fb0:	40 f6 c7 04          	test   $0x4,%dil
+  803fb4:	74 a9                	je     803f5f <memset+0x2c>
+  803fb6:	89 07                	mov    %eax,(%rdi)
+  803fb8:	48 83 c7 04          	add    $0x4,%rdi
+  803fbc:	eb a1                	jmp    803f5f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fbe:	41 f6 c1 04          	test   $0x4,%r9b
+  803fc2:	74 06                	je     803fca <memset+0x97>
+  803fc4:	89 07                	mov    %eax,(%rdi)
+  803fc6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fca:	41 f6 c1 02          	test   $0x2,%r9b
+  803fce:	74 07                	je     803fd7 <memset+0xa4>
+  803fd0:	66 89 07             	mov    %ax,(%rdi)
+  803fd3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fd7:	41 f6 c1 01          	test   $0x1,%r9b
+  803fdb:	74 9c                	je     803f79 <memset+0x46>
+  803fdd:	88 07                	mov    %al,(%rdi)
+  803fdf:	eb 98                	jmp    803f79 <memset+0x46>
+
+0000000000803fe1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fe1:	48 89 f8             	mov    %rdi,%rax
+  803fe4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fe7:	48 39 fe             	cmp    %rdi,%rsi
+  803fea:	73 3b                	jae    804027 <memmove+0x46>
+  803fec:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803ff0:	48 39 d7             	cmp    %rdx,%rdi
+  803ff3:	73 32                	jae    804027 <memmove+0x46>
+        s += n;
+        d += n;
+  803ff5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803ff9:	48 89 d6             	mov    %rdx,%rsi
+  803ffc:	48 09 fe             	or     %rdi,%rsi
+  803fff:	48 09 ce             	or     %rcx,%rsi
+  804002:	40 f6 c6 07          	test   $0x7,%sil
+  804006:	75 12                	jne    80401a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  804008:	48 83 ef 08          	sub    $0x8,%rdi
+  80400c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  804010:	48 c1 e9 03          	shr    $0x3,%rcx
+  804014:	fd                   	std
+  804015:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804018:	fc                   	cld
+  804019:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80401a:	48 83 ef 01          	sub    $0x1,%rdi
+  80401e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804022:	fd                   	std
+  804023:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804025:	eb f1                	jmp    804018 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804027:	48 89 f2             	mov    %rsi,%rdx
+  80402a:	48 09 c2             	or     %rax,%rdx
+  80402d:	48 09 ca             	or     %rcx,%rdx
+  804030:	f6 c2 07             	test   $0x7,%dl
+  804033:	75 0c                	jne    804041 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804035:	48 c1 e9 03          	shr    $0x3,%rcx
+  804039:	48 89 c7             	mov    %rax,%rdi
+  80403c:	fc                   	cld
+  80403d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804040:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804041:	48 89 c7             	mov    %rax,%rdi
+  804044:	fc                   	cld
+  804045:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804047:	c3                   	ret
+
+0000000000804048 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804048:	55                   	push   %rbp
+  804049:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80404c:	48 b8 e1 3f 80 00 00 	movabs $0x803fe1,%rax
+  804053:	00 00 00 
+  804056:	ff d0                	call   *%rax
+}
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+
+000000000080405a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+  80405e:	41 57                	push   %r15
+  804060:	41 56                	push   %r14
+  804062:	41 55                	push   %r13
+  804064:	41 54                	push   %r12
+  804066:	53                   	push   %rbx
+  804067:	48 83 ec 08          	sub    $0x8,%rsp
+  80406b:	49 89 fe             	mov    %rdi,%r14
+  80406e:	49 89 f7             	mov    %rsi,%r15
+  804071:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  804074:	48 89 f7             	mov    %rsi,%rdi
+  804077:	48 b8 a9 3d 80 00 00 	movabs $0x803da9,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804086:	48 89 de             	mov    %rbx,%rsi
+  804089:	4c 89 f7             	mov    %r14,%rdi
+  80408c:	48 b8 c4 3d 80 00 00 	movabs $0x803dc4,%rax
+  804093:	00 00 00 
+  804096:	ff d0                	call   *%rax
+  804098:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80409b:	48 39 c3             	cmp    %rax,%rbx
+  80409e:	74 36                	je     8040d6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8040a0:	48 89 d8             	mov    %rbx,%rax
+  8040a3:	4c 29 e8             	sub    %r13,%rax
+  8040a6:	49 39 c4             	cmp    %rax,%r12
+  8040a9:	73 31                	jae    8040dc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8040ab:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040b0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040b4:	4c 89 fe             	mov    %r15,%rsi
+  8040b7:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040c3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040c7:	48 83 c4 08          	add    $0x8,%rsp
+  8040cb:	5b                   	pop    %rbx
+  8040cc:	41 5c                	pop    %r12
+  8040ce:	41 5d                	pop    %r13
+  8040d0:	41 5e                	pop    %r14
+  8040d2:	41 5f                	pop    %r15
+  8040d4:	5d                   	pop    %rbp
+  8040d5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040d6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040da:	eb eb                	jmp    8040c7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040dc:	48 83 eb 01          	sub    $0x1,%rbx
+  8040e0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040e4:	48 89 da             	mov    %rbx,%rdx
+  8040e7:	4c 89 fe             	mov    %r15,%rsi
+  8040ea:	48 b8 48 40 80 00 00 	movabs $0x804048,%rax
+  8040f1:	00 00 00 
+  8040f4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040f6:	49 01 de             	add    %rbx,%r14
+  8040f9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040fe:	eb c3                	jmp    8040c3 <strlcat+0x69>
+
+0000000000804100 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  804100:	48 85 d2             	test   %rdx,%rdx
+  804103:	74 2d                	je     804132 <memcmp+0x32>
+  804105:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80410a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80410e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  804113:	44 38 c1             	cmp    %r8b,%cl
+  804116:	75 0f                	jne    804127 <memcmp+0x27>
+    while (n-- > 0) {
+  804118:	48 83 c0 01          	add    $0x1,%rax
+  80411c:	48 39 c2             	cmp    %rax,%rdx
+  80411f:	75 e9                	jne    80410a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804121:	b8 00 00 00 00       	mov    $0x0,%eax
+  804126:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804127:	0f b6 c1             	movzbl %cl,%eax
+  80412a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80412e:	44 29 c0             	sub    %r8d,%eax
+  804131:	c3                   	ret
+    return 0;
+  804132:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804137:	c3                   	ret
+
+0000000000804138 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804138:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80413c:	48 39 c7             	cmp    %rax,%rdi
+  80413f:	73 0f                	jae    804150 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804141:	40 38 37             	cmp    %sil,(%rdi)
+  804144:	74 0e                	je     804154 <memfind+0x1c>
+    for (; src < end; src++) {
+  804146:	48 83 c7 01          	add    $0x1,%rdi
+  80414a:	48 39 f8             	cmp    %rdi,%rax
+  80414d:	75 f2                	jne    804141 <memfind+0x9>
+  80414f:	c3                   	ret
+  804150:	48 89 f8             	mov    %rdi,%rax
+  804153:	c3                   	ret
+  804154:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804157:	c3                   	ret
+
+0000000000804158 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804158:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80415b:	0f b6 37             	movzbl (%rdi),%esi
+  80415e:	40 80 fe 20          	cmp    $0x20,%sil
+  804162:	74 06                	je     80416a <strtol+0x12>
+  804164:	40 80 fe 09          	cmp    $0x9,%sil
+  804168:	75 13                	jne    80417d <strtol+0x25>
+  80416a:	48 83 c7 01          	add    $0x1,%rdi
+  80416e:	0f b6 37             	movzbl (%rdi),%esi
+  804171:	40 80 fe 20          	cmp    $0x20,%sil
+  804175:	74 f3                	je     80416a <strtol+0x12>
+  804177:	40 80 fe 09          	cmp    $0x9,%sil
+  80417b:	74 ed                	je     80416a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80417d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804180:	83 e0 fd             	and    $0xfffffffd,%eax
+  804183:	3c 01                	cmp    $0x1,%al
+  804185:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804189:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80418f:	75 0f                	jne    8041a0 <strtol+0x48>
+  804191:	80 3f 30             	cmpb   $0x30,(%rdi)
+  804194:	74 14                	je     8041aa <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804196:	85 d2                	test   %edx,%edx
+  804198:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80419d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8041a0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041a5:	4c 63 ca             	movslq %edx,%r9
+  8041a8:	eb 36                	jmp    8041e0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041aa:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8041ae:	74 0f                	je     8041bf <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041b0:	85 d2                	test   %edx,%edx
+  8041b2:	75 ec                	jne    8041a0 <strtol+0x48>
+        s++;
+  8041b4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041b8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041bd:	eb e1                	jmp    8041a0 <strtol+0x48>
+        s += 2;
+  8041bf:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041c3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041c8:	eb d6                	jmp    8041a0 <strtol+0x48>
+            dig -= '0';
+  8041ca:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041cd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041d1:	41 39 d0             	cmp    %edx,%r8d
+  8041d4:	7d 21                	jge    8041f7 <strtol+0x9f>
+        val = val * base + dig;
+  8041d6:	49 0f af c1          	imul   %r9,%rax
+  8041da:	0f b6 c9             	movzbl %cl,%ecx
+  8041dd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041e0:	48 83 c7 01          	add    $0x1,%rdi
+  8041e4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041e8:	80 f9 39             	cmp    $0x39,%cl
+  8041eb:	76 dd                	jbe    8041ca <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041ed:	80 f9 7b             	cmp    $0x7b,%cl
+  8041f0:	77 05                	ja     8041f7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041f2:	83 e9 57             	sub    $0x57,%ecx
+  8041f5:	eb d6                	jmp    8041cd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041f7:	4d 85 d2             	test   %r10,%r10
+  8041fa:	74 03                	je     8041ff <strtol+0xa7>
+  8041fc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041ff:	48 89 c2             	mov    %rax,%rdx
+  804202:	48 f7 da             	neg    %rdx
+  804205:	40 80 fe 2d          	cmp    $0x2d,%sil
+  804209:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80420d:	c3                   	ret
+
+000000000080420e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80420e:	55                   	push   %rbp
+  80420f:	48 89 e5             	mov    %rsp,%rbp
+  804212:	41 56                	push   %r14
+  804214:	41 55                	push   %r13
+  804216:	41 54                	push   %r12
+  804218:	53                   	push   %rbx
+  804219:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80421c:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804223:	00 00 00 
+  804226:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80422a:	74 27                	je     804253 <_handle_vectored_pagefault+0x45>
+  80422c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804231:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804238:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80423b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80423e:	4c 89 e7             	mov    %r12,%rdi
+  804241:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804246:	84 c0                	test   %al,%al
+  804248:	75 45                	jne    80428f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80424a:	48 83 c3 01          	add    $0x1,%rbx
+  80424e:	49 3b 1e             	cmp    (%r14),%rbx
+  804251:	72 eb                	jb     80423e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804253:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80425a:	00 
+  80425b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804260:	4d 8b 04 24          	mov    (%r12),%r8
+  804264:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  80426b:	00 00 00 
+  80426e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804273:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  80427a:	00 00 00 
+  80427d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804282:	49 ba 72 33 80 00 00 	movabs $0x803372,%r10
+  804289:	00 00 00 
+  80428c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80428f:	5b                   	pop    %rbx
+  804290:	41 5c                	pop    %r12
+  804292:	41 5d                	pop    %r13
+  804294:	41 5e                	pop    %r14
+  804296:	5d                   	pop    %rbp
+  804297:	c3                   	ret
+
+0000000000804298 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804298:	55                   	push   %rbp
+  804299:	48 89 e5             	mov    %rsp,%rbp
+  80429c:	53                   	push   %rbx
+  80429d:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a1:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042a4:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042ab:	00 00 00 
+  8042ae:	80 38 00             	cmpb   $0x0,(%rax)
+  8042b1:	0f 84 84 00 00 00    	je     80433b <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042b7:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042be:	00 00 00 
+  8042c1:	48 8b 10             	mov    (%rax),%rdx
+  8042c4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042c9:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042d0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042d3:	48 85 d2             	test   %rdx,%rdx
+  8042d6:	74 19                	je     8042f1 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042d8:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042dc:	0f 84 e8 00 00 00    	je     8043ca <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e2:	48 83 c0 01          	add    $0x1,%rax
+  8042e6:	48 39 d0             	cmp    %rdx,%rax
+  8042e9:	75 ed                	jne    8042d8 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042eb:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042ef:	74 1c                	je     80430d <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042f1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042f5:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042fc:	00 00 00 
+  8042ff:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804306:	00 00 00 
+  804309:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80430d:	48 b8 c7 01 80 00 00 	movabs $0x8001c7,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+  804319:	89 c7                	mov    %eax,%edi
+  80431b:	48 be 90 44 80 00 00 	movabs $0x804490,%rsi
+  804322:	00 00 00 
+  804325:	48 b8 12 04 80 00 00 	movabs $0x800412,%rax
+  80432c:	00 00 00 
+  80432f:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804331:	85 c0                	test   %eax,%eax
+  804333:	78 68                	js     80439d <add_pgfault_handler+0x105>
+    return res;
+}
+  804335:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804339:	c9                   	leave
+  80433a:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80433b:	48 b8 c7 01 80 00 00 	movabs $0x8001c7,%rax
+  804342:	00 00 00 
+  804345:	ff d0                	call   *%rax
+  804347:	89 c7                	mov    %eax,%edi
+  804349:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80434e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804353:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80435a:	00 00 00 
+  80435d:	48 b8 54 02 80 00 00 	movabs $0x800254,%rax
+  804364:	00 00 00 
+  804367:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804369:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804370:	00 00 00 
+  804373:	48 8b 02             	mov    (%rdx),%rax
+  804376:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80437a:	48 89 0a             	mov    %rcx,(%rdx)
+  80437d:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804384:	00 00 00 
+  804387:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80438b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804392:	00 00 00 
+  804395:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804398:	e9 70 ff ff ff       	jmp    80430d <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80439d:	89 c1                	mov    %eax,%ecx
+  80439f:	48 ba b6 4d 80 00 00 	movabs $0x804db6,%rdx
+  8043a6:	00 00 00 
+  8043a9:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043ae:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  8043b5:	00 00 00 
+  8043b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bd:	49 b8 72 33 80 00 00 	movabs $0x803372,%r8
+  8043c4:	00 00 00 
+  8043c7:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043cf:	e9 61 ff ff ff       	jmp    804335 <add_pgfault_handler+0x9d>
+
+00000000008043d4 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043d4:	55                   	push   %rbp
+  8043d5:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043d8:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043df:	00 00 00 
+  8043e2:	80 38 00             	cmpb   $0x0,(%rax)
+  8043e5:	74 33                	je     80441a <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043e7:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043ee:	00 00 00 
+  8043f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043f6:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043fd:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804400:	48 85 c0             	test   %rax,%rax
+  804403:	0f 84 85 00 00 00    	je     80448e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804409:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80440d:	74 40                	je     80444f <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80440f:	48 83 c1 01          	add    $0x1,%rcx
+  804413:	48 39 c1             	cmp    %rax,%rcx
+  804416:	75 f1                	jne    804409 <remove_pgfault_handler+0x35>
+  804418:	eb 74                	jmp    80448e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80441a:	48 b9 ce 4d 80 00 00 	movabs $0x804dce,%rcx
+  804421:	00 00 00 
+  804424:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  80442b:	00 00 00 
+  80442e:	be 43 00 00 00       	mov    $0x43,%esi
+  804433:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  80443a:	00 00 00 
+  80443d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804442:	49 b8 72 33 80 00 00 	movabs $0x803372,%r8
+  804449:	00 00 00 
+  80444c:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80444f:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804456:	00 
+  804457:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80445b:	48 29 ca             	sub    %rcx,%rdx
+  80445e:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804465:	00 00 00 
+  804468:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80446c:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804471:	48 89 ce             	mov    %rcx,%rsi
+  804474:	48 b8 e1 3f 80 00 00 	movabs $0x803fe1,%rax
+  80447b:	00 00 00 
+  80447e:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804480:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804487:	00 00 00 
+  80448a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80448e:	5d                   	pop    %rbp
+  80448f:	c3                   	ret
+
+0000000000804490 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804490:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804493:	48 b8 0e 42 80 00 00 	movabs $0x80420e,%rax
+  80449a:	00 00 00 
+    call *%rax
+  80449d:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80449f:	41 5f                	pop    %r15
+	popq %r15
+  8044a1:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044a3:	41 5f                	pop    %r15
+	popq %r14
+  8044a5:	41 5e                	pop    %r14
+	popq %r13
+  8044a7:	41 5d                	pop    %r13
+	popq %r12
+  8044a9:	41 5c                	pop    %r12
+	popq %r11
+  8044ab:	41 5b                	pop    %r11
+	popq %r10
+  8044ad:	41 5a                	pop    %r10
+	popq %r9
+  8044af:	41 59                	pop    %r9
+	popq %r8
+  8044b1:	41 58                	pop    %r8
+	popq %rsi
+  8044b3:	5e                   	pop    %rsi
+	popq %rdi
+  8044b4:	5f                   	pop    %rdi
+	popq %rbp
+  8044b5:	5d                   	pop    %rbp
+	popq %rdx
+  8044b6:	5a                   	pop    %rdx
+	popq %rcx
+  8044b7:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044b8:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044bd:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044c2:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044c6:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044c9:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044ce:	5b                   	pop    %rbx
+	popq %rax
+  8044cf:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044d0:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044d4:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044d5:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044da:	c3                   	ret
+
+00000000008044db <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044db:	55                   	push   %rbp
+  8044dc:	48 89 e5             	mov    %rsp,%rbp
+  8044df:	41 55                	push   %r13
+  8044e1:	41 54                	push   %r12
+  8044e3:	53                   	push   %rbx
+  8044e4:	48 83 ec 08          	sub    $0x8,%rsp
+  8044e8:	49 89 fd             	mov    %rdi,%r13
+  8044eb:	48 89 f7             	mov    %rsi,%rdi
+  8044ee:	48 89 d3             	mov    %rdx,%rbx
+  8044f1:	49 89 cc             	mov    %rcx,%r12
+  8044f4:	4c 89 c2             	mov    %r8,%rdx
+  8044f7:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044fa:	48 85 f6             	test   %rsi,%rsi
+  8044fd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804504:	00 00 00 
+  804507:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80450b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804510:	48 85 db             	test   %rbx,%rbx
+  804513:	74 03                	je     804518 <ipc_recv_futex+0x3d>
+  804515:	48 8b 33             	mov    (%rbx),%rsi
+  804518:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80451c:	48 b8 9e 04 80 00 00 	movabs $0x80049e,%rax
+  804523:	00 00 00 
+  804526:	ff d0                	call   *%rax
+    if (res < 0) {
+  804528:	85 c0                	test   %eax,%eax
+  80452a:	78 75                	js     8045a1 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80452c:	4d 85 ed             	test   %r13,%r13
+  80452f:	74 14                	je     804545 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804531:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804538:	00 00 00 
+  80453b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804541:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804545:	4d 85 e4             	test   %r12,%r12
+  804548:	74 14                	je     80455e <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80454a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804551:	00 00 00 
+  804554:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80455a:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80455e:	48 85 db             	test   %rbx,%rbx
+  804561:	74 23                	je     804586 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804563:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80456a:	00 00 00 
+  80456d:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804573:	ba 00 00 00 00       	mov    $0x0,%edx
+  804578:	85 c9                	test   %ecx,%ecx
+  80457a:	74 07                	je     804583 <ipc_recv_futex+0xa8>
+  80457c:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804583:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804586:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80458d:	00 00 00 
+  804590:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804596:	48 83 c4 08          	add    $0x8,%rsp
+  80459a:	5b                   	pop    %rbx
+  80459b:	41 5c                	pop    %r12
+  80459d:	41 5d                	pop    %r13
+  80459f:	5d                   	pop    %rbp
+  8045a0:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045a1:	4d 85 ed             	test   %r13,%r13
+  8045a4:	74 08                	je     8045ae <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045a6:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045ad:	00 
+        if (perm_store != NULL) {
+  8045ae:	4d 85 e4             	test   %r12,%r12
+  8045b1:	74 08                	je     8045bb <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045b3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045ba:	00 
+        if (size != NULL) {
+  8045bb:	48 85 db             	test   %rbx,%rbx
+  8045be:	74 d6                	je     804596 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045c0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045c7:	eb cd                	jmp    804596 <ipc_recv_futex+0xbb>
+
+00000000008045c9 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045c9:	55                   	push   %rbp
+  8045ca:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d1:	6a 00                	push   $0x0
+  8045d3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045df:	48 b8 db 44 80 00 00 	movabs $0x8044db,%rax
+  8045e6:	00 00 00 
+  8045e9:	ff d0                	call   *%rax
+}
+  8045eb:	c9                   	leave
+  8045ec:	c3                   	ret
+
+00000000008045ed <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045ed:	55                   	push   %rbp
+  8045ee:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045f1:	48 85 d2             	test   %rdx,%rdx
+  8045f4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045fb:	00 00 00 
+  8045fe:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804602:	89 f6                	mov    %esi,%esi
+  804604:	48 b8 87 04 80 00 00 	movabs $0x800487,%rax
+  80460b:	00 00 00 
+  80460e:	ff d0                	call   *%rax
+    if (res < 0) {
+  804610:	85 c0                	test   %eax,%eax
+  804612:	78 02                	js     804616 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804614:	5d                   	pop    %rbp
+  804615:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804616:	89 c1                	mov    %eax,%ecx
+  804618:	48 ba e8 4d 80 00 00 	movabs $0x804de8,%rdx
+  80461f:	00 00 00 
+  804622:	be 50 00 00 00       	mov    $0x50,%esi
+  804627:	48 bf fc 4d 80 00 00 	movabs $0x804dfc,%rdi
+  80462e:	00 00 00 
+  804631:	b8 00 00 00 00       	mov    $0x0,%eax
+  804636:	49 b8 72 33 80 00 00 	movabs $0x803372,%r8
+  80463d:	00 00 00 
+  804640:	41 ff d0             	call   *%r8
+
+0000000000804643 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804643:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804648:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80464f:	00 00 00 
+  804652:	48 89 d0             	mov    %rdx,%rax
+  804655:	48 c1 e0 04          	shl    $0x4,%rax
+  804659:	48 29 d0             	sub    %rdx,%rax
+  80465c:	48 c1 e0 05          	shl    $0x5,%rax
+  804660:	48 01 c8             	add    %rcx,%rax
+  804663:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804669:	39 f8                	cmp    %edi,%eax
+  80466b:	74 13                	je     804680 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80466d:	48 83 c2 01          	add    $0x1,%rdx
+  804671:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804678:	75 d8                	jne    804652 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80467a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80467f:	c3                   	ret
+            return envs[i].env_id;
+  804680:	48 89 d0             	mov    %rdx,%rax
+  804683:	48 c1 e0 04          	shl    $0x4,%rax
+  804687:	48 29 d0             	sub    %rdx,%rax
+  80468a:	48 c1 e0 05          	shl    $0x5,%rax
+  80468e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804695:	00 00 00 
+  804698:	48 01 d0             	add    %rdx,%rax
+  80469b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046a1:	c3                   	ret
+  8046a2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008046a8 <__rodata_start>:
+  8046a8:	3c 75                	cmp    $0x75,%al
+  8046aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046ab:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046b0:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8046b4:	1f                   	(bad)
+  8046b5:	44 00 00             	add    %r8b,(%rax)
+  8046b8:	73 79                	jae    804733 <__rodata_start+0x8b>
+  8046ba:	73 63                	jae    80471f <__rodata_start+0x77>
+  8046bc:	61                   	(bad)
+  8046bd:	6c                   	insb   (%dx),%es:(%rdi)
+  8046be:	6c                   	insb   (%dx),%es:(%rdi)
+  8046bf:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab3f <__bss_end+0x721c8b3f>
+  8046c5:	65 74 75             	gs je  80473d <__rodata_start+0x95>
+  8046c8:	72 6e                	jb     804738 <__rodata_start+0x90>
+  8046ca:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab4c <__bss_end+0x281c8b4c>
+  8046d1:	28 
+  8046d2:	3e 20 30             	ds and %dh,(%rax)
+  8046d5:	29 00                	sub    %eax,(%rax)
+  8046d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8046d8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046df:	61                   	(bad)
+  8046e0:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e1:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e2:	2e 63 00             	cs movsxd (%rax),%eax
+  8046e5:	0f 1f 00             	nopl   (%rax)
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ee:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046f1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046f5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046f6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046fa:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  804701:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80516c <__ctors_end+0x8c>
+  804708:	5b                   	pop    %rbx
+  804709:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80470e:	20 66 74             	and    %ah,0x74(%rsi)
+  804711:	72 75                	jb     804788 <devtab+0x8>
+  804713:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804714:	63 61 74             	movsxd 0x74(%rcx),%esp
+  804717:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad6782 <__bss_end+0x2d294782>
+  80471e:	20 62 61             	and    %ah,0x61(%rdx)
+  804721:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804725:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804729:	5b                   	pop    %rbx
+  80472a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80472f:	20 72 65             	and    %dh,0x65(%rdx)
+  804732:	61                   	(bad)
+  804733:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad679e <__bss_end+0x2d29479e>
+  80473a:	20 62 61             	and    %ah,0x61(%rdx)
+  80473d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804741:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804745:	5b                   	pop    %rbx
+  804746:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80474b:	20 77 72             	and    %dh,0x72(%rdi)
+  80474e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  804755:	2d 
+  804756:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80475b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80475e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804762:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804769:	00 00 00 
+  80476c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804773:	00 00 00 
+  804776:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477d:	00 00 00 
+
+0000000000804780 <devtab>:
+  804780:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804790:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8047b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8048a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8048b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8049a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8049b0:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049c0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049d0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049e0:	af 36 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .6.......<......
+  8049f0:	e0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804a00:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	f0 3c 80 00 00 00 00 00 ce 36 80 00 00 00 00 00     .<.......6......
+  804a20:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804a30:	c2 36 80 00 00 00 00 00 3c 37 80 00 00 00 00 00     .6......<7......
+  804a40:	f0 3c 80 00 00 00 00 00 c2 36 80 00 00 00 00 00     .<.......6......
+  804a50:	08 37 80 00 00 00 00 00 08 37 80 00 00 00 00 00     .7.......7......
+  804a60:	08 37 80 00 00 00 00 00 08 37 80 00 00 00 00 00     .7.......7......
+  804a70:	08 37 80 00 00 00 00 00 08 37 80 00 00 00 00 00     .7.......7......
+  804a80:	08 37 80 00 00 00 00 00 08 37 80 00 00 00 00 00     .7.......7......
+  804a90:	08 37 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .7.......<......
+  804aa0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b70:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	f0 3c 80 00 00 00 00 00 13 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804bd0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	5f 37 80 00 00 00 00 00 2e 39 80 00 00 00 00 00     _7.......9......
+  804bf0:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804c00:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804c10:	8e 37 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .7.......<......
+  804c20:	f0 3c 80 00 00 00 00 00 54 37 80 00 00 00 00 00     .<......T7......
+  804c30:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	d6 3a 80 00 00 00 00 00 a0 3b 80 00 00 00 00 00     .:.......;......
+  804c50:	f0 3c 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .<.......<......
+  804c60:	25 38 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     %8.......<......
+  804c70:	02 3a 80 00 00 00 00 00 f0 3c 80 00 00 00 00 00     .:.......<......
+  804c80:	f0 3c 80 00 00 00 00 00 13 3c 80 00 00 00 00 00     .<.......<......
+  804c90:	f0 3c 80 00 00 00 00 00 b8 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804ca0 <error_string>:
+	...
+  804ca8:	55 48 80 00 00 00 00 00 67 48 80 00 00 00 00 00     UH......gH......
+  804cb8:	77 48 80 00 00 00 00 00 89 48 80 00 00 00 00 00     wH.......H......
+  804cc8:	97 48 80 00 00 00 00 00 ab 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	c0 48 80 00 00 00 00 00 d3 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	e5 48 80 00 00 00 00 00 f9 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	09 49 80 00 00 00 00 00 1c 49 80 00 00 00 00 00     .I.......I......
+  804d08:	33 49 80 00 00 00 00 00 49 49 80 00 00 00 00 00     3I......II......
+  804d18:	61 49 80 00 00 00 00 00 79 49 80 00 00 00 00 00     aI......yI......
+  804d28:	86 49 80 00 00 00 00 00 58 4d 80 00 00 00 00 00     .I......XM......
+  804d38:	9a 49 80 00 00 00 00 00 b2 49 80 00 00 00 00 00     .I.......I......
+  804d48:	bc 49 80 00 00 00 00 00 c6 49 80 00 00 00 00 00     .I.......I......
+  804d58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d78:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d88:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d98:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804da8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804db8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804dc8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804dd8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804de8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804df8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
@@ -0,0 +1,8214 @@
+
+obj/user/fairness:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 dc 00 00 00       	call   8000ff <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * (user/idle is env 0). */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t who, id;
+
+    id = sys_getenvid();
+  800034:	48 b8 79 10 80 00 00 	movabs $0x801079,%rax
+  80003b:	00 00 00 
+  80003e:	ff d0                	call   *%rax
+  800040:	89 c3                	mov    %eax,%ebx
+
+    if (thisenv == &envs[1]) {
+  800042:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 e0 01 c0 1f 80 	movabs $0x801fc001e0,%rax
+  800053:	00 00 00 
+  800056:	48 39 02             	cmp    %rax,(%rdx)
+  800059:	74 5e                	je     8000b9 <umain+0x94>
+        while (1) {
+            ipc_recv(&who, NULL, NULL, NULL);
+            cprintf("%x recv from %x\n", id, who);
+        }
+    } else {
+        cprintf("%x loop sending to %x\n", id, envs[1].env_id);
+  80005b:	48 b8 a8 02 c0 1f 80 	movabs $0x801fc002a8,%rax
+  800062:	00 00 00 
+  800065:	8b 10                	mov    (%rax),%edx
+  800067:	89 de                	mov    %ebx,%esi
+  800069:	48 bf 71 47 80 00 00 	movabs $0x804771,%rdi
+  800070:	00 00 00 
+  800073:	b8 00 00 00 00       	mov    $0x0,%eax
+  800078:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  80007f:	00 00 00 
+  800082:	ff d1                	call   *%rcx
+        while (1)
+            ipc_send(envs[1].env_id, 0, NULL, 0, 0);
+  800084:	49 bc 00 00 c0 1f 80 	movabs $0x801fc00000,%r12
+  80008b:	00 00 00 
+  80008e:	48 bb 4b 16 80 00 00 	movabs $0x80164b,%rbx
+  800095:	00 00 00 
+  800098:	41 8b bc 24 a8 02 00 	mov    0x2a8(%r12),%edi
+  80009f:	00 
+  8000a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000a6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8000b5:	ff d3                	call   *%rbx
+        while (1)
+  8000b7:	eb df                	jmp    800098 <umain+0x73>
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000b9:	49 be 27 16 80 00 00 	movabs $0x801627,%r14
+  8000c0:	00 00 00 
+            cprintf("%x recv from %x\n", id, who);
+  8000c3:	49 bd 60 47 80 00 00 	movabs $0x804760,%r13
+  8000ca:	00 00 00 
+  8000cd:	49 bc 82 02 80 00 00 	movabs $0x800282,%r12
+  8000d4:	00 00 00 
+            ipc_recv(&who, NULL, NULL, NULL);
+  8000d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e6:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  8000ea:	41 ff d6             	call   *%r14
+            cprintf("%x recv from %x\n", id, who);
+  8000ed:	8b 55 dc             	mov    -0x24(%rbp),%edx
+  8000f0:	89 de                	mov    %ebx,%esi
+  8000f2:	4c 89 ef             	mov    %r13,%rdi
+  8000f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fa:	41 ff d4             	call   *%r12
+        while (1) {
+  8000fd:	eb d8                	jmp    8000d7 <umain+0xb2>
+
+00000000008000ff <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8000ff:	55                   	push   %rbp
+  800100:	48 89 e5             	mov    %rsp,%rbp
+  800103:	41 56                	push   %r14
+  800105:	41 55                	push   %r13
+  800107:	41 54                	push   %r12
+  800109:	53                   	push   %rbx
+  80010a:	41 89 fd             	mov    %edi,%r13d
+  80010d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800110:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800117:	00 00 00 
+  80011a:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800121:	00 00 00 
+  800124:	48 39 c2             	cmp    %rax,%rdx
+  800127:	73 17                	jae    800140 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800129:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80012c:	49 89 c4             	mov    %rax,%r12
+  80012f:	48 83 c3 08          	add    $0x8,%rbx
+  800133:	b8 00 00 00 00       	mov    $0x0,%eax
+  800138:	ff 53 f8             	call   *-0x8(%rbx)
+  80013b:	4c 39 e3             	cmp    %r12,%rbx
+  80013e:	72 ef                	jb     80012f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800140:	48 b8 79 10 80 00 00 	movabs $0x801079,%rax
+  800147:	00 00 00 
+  80014a:	ff d0                	call   *%rax
+  80014c:	89 c2                	mov    %eax,%edx
+  80014e:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800154:	48 89 d0             	mov    %rdx,%rax
+  800157:	48 c1 e0 04          	shl    $0x4,%rax
+  80015b:	48 29 d0             	sub    %rdx,%rax
+  80015e:	48 c1 e0 05          	shl    $0x5,%rax
+  800162:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800169:	00 00 00 
+  80016c:	48 01 d0             	add    %rdx,%rax
+  80016f:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800176:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800179:	45 85 ed             	test   %r13d,%r13d
+  80017c:	7e 0d                	jle    80018b <libmain+0x8c>
+  80017e:	49 8b 06             	mov    (%r14),%rax
+  800181:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800188:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80018b:	4c 89 f6             	mov    %r14,%rsi
+  80018e:	44 89 ef             	mov    %r13d,%edi
+  800191:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800198:	00 00 00 
+  80019b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80019d:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  8001a4:	00 00 00 
+  8001a7:	ff d0                	call   *%rax
+#endif
+}
+  8001a9:	5b                   	pop    %rbx
+  8001aa:	41 5c                	pop    %r12
+  8001ac:	41 5d                	pop    %r13
+  8001ae:	41 5e                	pop    %r14
+  8001b0:	5d                   	pop    %rbp
+  8001b1:	c3                   	ret
+
+00000000008001b2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001b2:	55                   	push   %rbp
+  8001b3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001b6:	48 b8 26 19 80 00 00 	movabs $0x801926,%rax
+  8001bd:	00 00 00 
+  8001c0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c7:	48 b8 16 10 80 00 00 	movabs $0x801016,%rax
+  8001ce:	00 00 00 
+  8001d1:	ff d0                	call   *%rax
+}
+  8001d3:	5d                   	pop    %rbp
+  8001d4:	c3                   	ret
+
+00000000008001d5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001d5:	55                   	push   %rbp
+  8001d6:	48 89 e5             	mov    %rsp,%rbp
+  8001d9:	53                   	push   %rbx
+  8001da:	48 83 ec 08          	sub    $0x8,%rsp
+  8001de:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8001e1:	8b 06                	mov    (%rsi),%eax
+  8001e3:	8d 50 01             	lea    0x1(%rax),%edx
+  8001e6:	89 16                	mov    %edx,(%rsi)
+  8001e8:	48 98                	cltq
+  8001ea:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8001ef:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8001f5:	74 0a                	je     800201 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8001f7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8001fb:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8001ff:	c9                   	leave
+  800200:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800201:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800205:	be ff 00 00 00       	mov    $0xff,%esi
+  80020a:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+        state->offset = 0;
+  800216:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80021c:	eb d9                	jmp    8001f7 <putch+0x22>
+
+000000000080021e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80021e:	55                   	push   %rbp
+  80021f:	48 89 e5             	mov    %rsp,%rbp
+  800222:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800229:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80022c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800233:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800238:	b8 00 00 00 00       	mov    $0x0,%eax
+  80023d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800240:	48 89 f1             	mov    %rsi,%rcx
+  800243:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80024a:	48 bf d5 01 80 00 00 	movabs $0x8001d5,%rdi
+  800251:	00 00 00 
+  800254:	48 b8 d2 03 80 00 00 	movabs $0x8003d2,%rax
+  80025b:	00 00 00 
+  80025e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800260:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800267:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80026e:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  800275:	00 00 00 
+  800278:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80027a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800280:	c9                   	leave
+  800281:	c3                   	ret
+
+0000000000800282 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800282:	55                   	push   %rbp
+  800283:	48 89 e5             	mov    %rsp,%rbp
+  800286:	48 83 ec 50          	sub    $0x50,%rsp
+  80028a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80028e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800292:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800296:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80029a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80029e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002a5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002a9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002ad:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002b1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002b5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002b9:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002c5:	c9                   	leave
+  8002c6:	c3                   	ret
+
+00000000008002c7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002c7:	55                   	push   %rbp
+  8002c8:	48 89 e5             	mov    %rsp,%rbp
+  8002cb:	41 57                	push   %r15
+  8002cd:	41 56                	push   %r14
+  8002cf:	41 55                	push   %r13
+  8002d1:	41 54                	push   %r12
+  8002d3:	53                   	push   %rbx
+  8002d4:	48 83 ec 18          	sub    $0x18,%rsp
+  8002d8:	49 89 fc             	mov    %rdi,%r12
+  8002db:	49 89 f5             	mov    %rsi,%r13
+  8002de:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8002e2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8002e5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8002e8:	41 89 cf             	mov    %ecx,%r15d
+  8002eb:	4c 39 fa             	cmp    %r15,%rdx
+  8002ee:	73 5b                	jae    80034b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8002f0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8002f4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8002f8:	85 db                	test   %ebx,%ebx
+  8002fa:	7e 0e                	jle    80030a <print_num+0x43>
+            putch(padc, put_arg);
+  8002fc:	4c 89 ee             	mov    %r13,%rsi
+  8002ff:	44 89 f7             	mov    %r14d,%edi
+  800302:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800305:	83 eb 01             	sub    $0x1,%ebx
+  800308:	75 f2                	jne    8002fc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80030a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80030e:	48 b9 a3 47 80 00 00 	movabs $0x8047a3,%rcx
+  800315:	00 00 00 
+  800318:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  80031f:	00 00 00 
+  800322:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800326:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80032a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80032f:	49 f7 f7             	div    %r15
+  800332:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800336:	4c 89 ee             	mov    %r13,%rsi
+  800339:	41 ff d4             	call   *%r12
+}
+  80033c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800340:	5b                   	pop    %rbx
+  800341:	41 5c                	pop    %r12
+  800343:	41 5d                	pop    %r13
+  800345:	41 5e                	pop    %r14
+  800347:	41 5f                	pop    %r15
+  800349:	5d                   	pop    %rbp
+  80034a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80034b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80034f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800354:	49 f7 f7             	div    %r15
+  800357:	48 83 ec 08          	sub    $0x8,%rsp
+  80035b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80035f:	52                   	push   %rdx
+  800360:	45 0f be c9          	movsbl %r9b,%r9d
+  800364:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800368:	48 89 c2             	mov    %rax,%rdx
+  80036b:	48 b8 c7 02 80 00 00 	movabs $0x8002c7,%rax
+  800372:	00 00 00 
+  800375:	ff d0                	call   *%rax
+  800377:	48 83 c4 10          	add    $0x10,%rsp
+  80037b:	eb 8d                	jmp    80030a <print_num+0x43>
+
+000000000080037d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80037d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800381:	48 8b 06             	mov    (%rsi),%rax
+  800384:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800388:	73 0a                	jae    800394 <sprintputch+0x17>
+        *state->start++ = ch;
+  80038a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80038e:	48 89 16             	mov    %rdx,(%rsi)
+  800391:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800394:	c3                   	ret
+
+0000000000800395 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800395:	55                   	push   %rbp
+  800396:	48 89 e5             	mov    %rsp,%rbp
+  800399:	48 83 ec 50          	sub    $0x50,%rsp
+  80039d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003a1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003a5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003a9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003b0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003b8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003bc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003c0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003c4:	48 b8 d2 03 80 00 00 	movabs $0x8003d2,%rax
+  8003cb:	00 00 00 
+  8003ce:	ff d0                	call   *%rax
+}
+  8003d0:	c9                   	leave
+  8003d1:	c3                   	ret
+
+00000000008003d2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003d2:	55                   	push   %rbp
+  8003d3:	48 89 e5             	mov    %rsp,%rbp
+  8003d6:	41 57                	push   %r15
+  8003d8:	41 56                	push   %r14
+  8003da:	41 55                	push   %r13
+  8003dc:	41 54                	push   %r12
+  8003de:	53                   	push   %rbx
+  8003df:	48 83 ec 38          	sub    $0x38,%rsp
+  8003e3:	49 89 fe             	mov    %rdi,%r14
+  8003e6:	49 89 f5             	mov    %rsi,%r13
+  8003e9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8003ec:	48 8b 01             	mov    (%rcx),%rax
+  8003ef:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8003f3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8003f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fb:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8003ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800403:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800407:	0f b6 3b             	movzbl (%rbx),%edi
+  80040a:	40 80 ff 25          	cmp    $0x25,%dil
+  80040e:	74 18                	je     800428 <vprintfmt+0x56>
+            if (!ch) return;
+  800410:	40 84 ff             	test   %dil,%dil
+  800413:	0f 84 b1 06 00 00    	je     800aca <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800419:	40 0f b6 ff          	movzbl %dil,%edi
+  80041d:	4c 89 ee             	mov    %r13,%rsi
+  800420:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800423:	4c 89 e3             	mov    %r12,%rbx
+  800426:	eb db                	jmp    800403 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800428:	be 00 00 00 00       	mov    $0x0,%esi
+  80042d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800431:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800436:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80043c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800443:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800447:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80044c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800451:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800454:	83 e8 23             	sub    $0x23,%eax
+  800457:	3c 57                	cmp    $0x57,%al
+  800459:	0f 87 51 06 00 00    	ja     800ab0 <vprintfmt+0x6de>
+  80045f:	0f b6 c0             	movzbl %al,%eax
+  800462:	48 b9 60 49 80 00 00 	movabs $0x804960,%rcx
+  800469:	00 00 00 
+  80046c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80046f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800472:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800476:	eb cf                	jmp    800447 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800478:	49 89 dc             	mov    %rbx,%r12
+  80047b:	be 01 00 00 00       	mov    $0x1,%esi
+  800480:	eb c5                	jmp    800447 <vprintfmt+0x75>
+            padc = ch;
+  800482:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800486:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800489:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80048c:	eb b9                	jmp    800447 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80048e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800491:	83 f8 2f             	cmp    $0x2f,%eax
+  800494:	77 24                	ja     8004ba <vprintfmt+0xe8>
+  800496:	89 c1                	mov    %eax,%ecx
+  800498:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80049c:	83 c0 08             	add    $0x8,%eax
+  80049f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004a2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004a5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004a8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ac:	79 99                	jns    800447 <vprintfmt+0x75>
+                width = precision;
+  8004ae:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004b2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004b8:	eb 8d                	jmp    800447 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004ba:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004be:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004c6:	eb da                	jmp    8004a2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004c8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004cd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004d1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004d7:	3c 39                	cmp    $0x39,%al
+  8004d9:	77 1c                	ja     8004f7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004db:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8004df:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8004e3:	0f b6 c0             	movzbl %al,%eax
+  8004e6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004eb:	0f b6 03             	movzbl (%rbx),%eax
+  8004ee:	3c 39                	cmp    $0x39,%al
+  8004f0:	76 e9                	jbe    8004db <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8004f2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8004f5:	eb b1                	jmp    8004a8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8004f7:	49 89 dc             	mov    %rbx,%r12
+  8004fa:	eb ac                	jmp    8004a8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8004fc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8004ff:	85 c9                	test   %ecx,%ecx
+  800501:	b8 00 00 00 00       	mov    $0x0,%eax
+  800506:	0f 49 c1             	cmovns %ecx,%eax
+  800509:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80050c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80050f:	e9 33 ff ff ff       	jmp    800447 <vprintfmt+0x75>
+            lflag++;
+  800514:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800517:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80051a:	e9 28 ff ff ff       	jmp    800447 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80051f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800522:	83 f8 2f             	cmp    $0x2f,%eax
+  800525:	77 19                	ja     800540 <vprintfmt+0x16e>
+  800527:	89 c2                	mov    %eax,%edx
+  800529:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80052d:	83 c0 08             	add    $0x8,%eax
+  800530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800533:	8b 3a                	mov    (%rdx),%edi
+  800535:	4c 89 ee             	mov    %r13,%rsi
+  800538:	41 ff d6             	call   *%r14
+            break;
+  80053b:	e9 c3 fe ff ff       	jmp    800403 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800540:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800544:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800548:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054c:	eb e5                	jmp    800533 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80054e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800551:	83 f8 2f             	cmp    $0x2f,%eax
+  800554:	77 5a                	ja     8005b0 <vprintfmt+0x1de>
+  800556:	89 c2                	mov    %eax,%edx
+  800558:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80055c:	83 c0 08             	add    $0x8,%eax
+  80055f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800562:	8b 02                	mov    (%rdx),%eax
+  800564:	89 c1                	mov    %eax,%ecx
+  800566:	f7 d9                	neg    %ecx
+  800568:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80056b:	83 f9 16             	cmp    $0x16,%ecx
+  80056e:	7f 4e                	jg     8005be <vprintfmt+0x1ec>
+  800570:	48 63 c1             	movslq %ecx,%rax
+  800573:	48 ba 20 4c 80 00 00 	movabs $0x804c20,%rdx
+  80057a:	00 00 00 
+  80057d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800581:	48 85 c0             	test   %rax,%rax
+  800584:	74 38                	je     8005be <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800586:	48 89 c1             	mov    %rax,%rcx
+  800589:	48 ba 19 4e 80 00 00 	movabs $0x804e19,%rdx
+  800590:	00 00 00 
+  800593:	4c 89 ee             	mov    %r13,%rsi
+  800596:	4c 89 f7             	mov    %r14,%rdi
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	49 b8 95 03 80 00 00 	movabs $0x800395,%r8
+  8005a5:	00 00 00 
+  8005a8:	41 ff d0             	call   *%r8
+  8005ab:	e9 53 fe ff ff       	jmp    800403 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bc:	eb a4                	jmp    800562 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005be:	48 ba bb 47 80 00 00 	movabs $0x8047bb,%rdx
+  8005c5:	00 00 00 
+  8005c8:	4c 89 ee             	mov    %r13,%rsi
+  8005cb:	4c 89 f7             	mov    %r14,%rdi
+  8005ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d3:	49 b8 95 03 80 00 00 	movabs $0x800395,%r8
+  8005da:	00 00 00 
+  8005dd:	41 ff d0             	call   *%r8
+  8005e0:	e9 1e fe ff ff       	jmp    800403 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8005eb:	77 6c                	ja     800659 <vprintfmt+0x287>
+  8005ed:	89 c2                	mov    %eax,%edx
+  8005ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005f3:	83 c0 08             	add    $0x8,%eax
+  8005f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005f9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8005fc:	48 85 d2             	test   %rdx,%rdx
+  8005ff:	48 b8 b4 47 80 00 00 	movabs $0x8047b4,%rax
+  800606:	00 00 00 
+  800609:	48 0f 45 c2          	cmovne %rdx,%rax
+  80060d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800611:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800615:	7e 06                	jle    80061d <vprintfmt+0x24b>
+  800617:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80061b:	75 4a                	jne    800667 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80061d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800621:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800625:	0f b6 00             	movzbl (%rax),%eax
+  800628:	84 c0                	test   %al,%al
+  80062a:	0f 85 9a 00 00 00    	jne    8006ca <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800630:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800633:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800637:	85 c0                	test   %eax,%eax
+  800639:	0f 8e c4 fd ff ff    	jle    800403 <vprintfmt+0x31>
+  80063f:	4c 89 ee             	mov    %r13,%rsi
+  800642:	bf 20 00 00 00       	mov    $0x20,%edi
+  800647:	41 ff d6             	call   *%r14
+  80064a:	41 83 ec 01          	sub    $0x1,%r12d
+  80064e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800652:	75 eb                	jne    80063f <vprintfmt+0x26d>
+  800654:	e9 aa fd ff ff       	jmp    800403 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800659:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80065d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800661:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800665:	eb 92                	jmp    8005f9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800667:	49 63 f7             	movslq %r15d,%rsi
+  80066a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80066e:	48 b8 84 0b 80 00 00 	movabs $0x800b84,%rax
+  800675:	00 00 00 
+  800678:	ff d0                	call   *%rax
+  80067a:	48 89 c2             	mov    %rax,%rdx
+  80067d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800680:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800682:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800685:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800688:	85 c0                	test   %eax,%eax
+  80068a:	7e 91                	jle    80061d <vprintfmt+0x24b>
+  80068c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800691:	4c 89 ee             	mov    %r13,%rsi
+  800694:	44 89 e7             	mov    %r12d,%edi
+  800697:	41 ff d6             	call   *%r14
+  80069a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80069e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006a4:	75 eb                	jne    800691 <vprintfmt+0x2bf>
+  8006a6:	e9 72 ff ff ff       	jmp    80061d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ab:	0f b6 f8             	movzbl %al,%edi
+  8006ae:	4c 89 ee             	mov    %r13,%rsi
+  8006b1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006b4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006b8:	49 83 c4 01          	add    $0x1,%r12
+  8006bc:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006c2:	84 c0                	test   %al,%al
+  8006c4:	0f 84 66 ff ff ff    	je     800630 <vprintfmt+0x25e>
+  8006ca:	45 85 ff             	test   %r15d,%r15d
+  8006cd:	78 0a                	js     8006d9 <vprintfmt+0x307>
+  8006cf:	41 83 ef 01          	sub    $0x1,%r15d
+  8006d3:	0f 88 57 ff ff ff    	js     800630 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006d9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8006dd:	74 cc                	je     8006ab <vprintfmt+0x2d9>
+  8006df:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8006e2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8006e7:	80 fa 5e             	cmp    $0x5e,%dl
+  8006ea:	77 c2                	ja     8006ae <vprintfmt+0x2dc>
+  8006ec:	eb bd                	jmp    8006ab <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8006ee:	40 84 f6             	test   %sil,%sil
+  8006f1:	75 26                	jne    800719 <vprintfmt+0x347>
+    switch (lflag) {
+  8006f3:	85 d2                	test   %edx,%edx
+  8006f5:	74 59                	je     800750 <vprintfmt+0x37e>
+  8006f7:	83 fa 01             	cmp    $0x1,%edx
+  8006fa:	74 7b                	je     800777 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8006fc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006ff:	83 f8 2f             	cmp    $0x2f,%eax
+  800702:	0f 87 96 00 00 00    	ja     80079e <vprintfmt+0x3cc>
+  800708:	89 c2                	mov    %eax,%edx
+  80070a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070e:	83 c0 08             	add    $0x8,%eax
+  800711:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800714:	4c 8b 22             	mov    (%rdx),%r12
+  800717:	eb 17                	jmp    800730 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800719:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071c:	83 f8 2f             	cmp    $0x2f,%eax
+  80071f:	77 21                	ja     800742 <vprintfmt+0x370>
+  800721:	89 c2                	mov    %eax,%edx
+  800723:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800727:	83 c0 08             	add    $0x8,%eax
+  80072a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80072d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800730:	4d 85 e4             	test   %r12,%r12
+  800733:	78 7a                	js     8007af <vprintfmt+0x3dd>
+            num = i;
+  800735:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800738:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80073d:	e9 50 02 00 00       	jmp    800992 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800742:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800746:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80074a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074e:	eb dd                	jmp    80072d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800753:	83 f8 2f             	cmp    $0x2f,%eax
+  800756:	77 11                	ja     800769 <vprintfmt+0x397>
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075e:	83 c0 08             	add    $0x8,%eax
+  800761:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800764:	4c 63 22             	movslq (%rdx),%r12
+  800767:	eb c7                	jmp    800730 <vprintfmt+0x35e>
+  800769:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800771:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800775:	eb ed                	jmp    800764 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800777:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077a:	83 f8 2f             	cmp    $0x2f,%eax
+  80077d:	77 11                	ja     800790 <vprintfmt+0x3be>
+  80077f:	89 c2                	mov    %eax,%edx
+  800781:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800785:	83 c0 08             	add    $0x8,%eax
+  800788:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078b:	4c 8b 22             	mov    (%rdx),%r12
+  80078e:	eb a0                	jmp    800730 <vprintfmt+0x35e>
+  800790:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800794:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800798:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079c:	eb ed                	jmp    80078b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80079e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007aa:	e9 65 ff ff ff       	jmp    800714 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007af:	4c 89 ee             	mov    %r13,%rsi
+  8007b2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007b7:	41 ff d6             	call   *%r14
+                i = -i;
+  8007ba:	49 f7 dc             	neg    %r12
+  8007bd:	e9 73 ff ff ff       	jmp    800735 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c2:	40 84 f6             	test   %sil,%sil
+  8007c5:	75 32                	jne    8007f9 <vprintfmt+0x427>
+    switch (lflag) {
+  8007c7:	85 d2                	test   %edx,%edx
+  8007c9:	74 5d                	je     800828 <vprintfmt+0x456>
+  8007cb:	83 fa 01             	cmp    $0x1,%edx
+  8007ce:	0f 84 82 00 00 00    	je     800856 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007da:	0f 87 a5 00 00 00    	ja     800885 <vprintfmt+0x4b3>
+  8007e0:	89 c2                	mov    %eax,%edx
+  8007e2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e6:	83 c0 08             	add    $0x8,%eax
+  8007e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ec:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8007f4:	e9 99 01 00 00       	jmp    800992 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ff:	77 19                	ja     80081a <vprintfmt+0x448>
+  800801:	89 c2                	mov    %eax,%edx
+  800803:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800807:	83 c0 08             	add    $0x8,%eax
+  80080a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800810:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800815:	e9 78 01 00 00       	jmp    800992 <vprintfmt+0x5c0>
+  80081a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800822:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800826:	eb e5                	jmp    80080d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800828:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082b:	83 f8 2f             	cmp    $0x2f,%eax
+  80082e:	77 18                	ja     800848 <vprintfmt+0x476>
+  800830:	89 c2                	mov    %eax,%edx
+  800832:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800836:	83 c0 08             	add    $0x8,%eax
+  800839:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80083e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800843:	e9 4a 01 00 00       	jmp    800992 <vprintfmt+0x5c0>
+  800848:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80084c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800850:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800854:	eb e6                	jmp    80083c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800856:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800859:	83 f8 2f             	cmp    $0x2f,%eax
+  80085c:	77 19                	ja     800877 <vprintfmt+0x4a5>
+  80085e:	89 c2                	mov    %eax,%edx
+  800860:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800864:	83 c0 08             	add    $0x8,%eax
+  800867:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80086a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80086d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800872:	e9 1b 01 00 00       	jmp    800992 <vprintfmt+0x5c0>
+  800877:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80087b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80087f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800883:	eb e5                	jmp    80086a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800885:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800889:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800891:	e9 56 ff ff ff       	jmp    8007ec <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800896:	40 84 f6             	test   %sil,%sil
+  800899:	75 2e                	jne    8008c9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80089b:	85 d2                	test   %edx,%edx
+  80089d:	74 59                	je     8008f8 <vprintfmt+0x526>
+  80089f:	83 fa 01             	cmp    $0x1,%edx
+  8008a2:	74 7f                	je     800923 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008aa:	0f 87 9f 00 00 00    	ja     80094f <vprintfmt+0x57d>
+  8008b0:	89 c2                	mov    %eax,%edx
+  8008b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b6:	83 c0 08             	add    $0x8,%eax
+  8008b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008bf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c4:	e9 c9 00 00 00       	jmp    800992 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cf:	77 19                	ja     8008ea <vprintfmt+0x518>
+  8008d1:	89 c2                	mov    %eax,%edx
+  8008d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d7:	83 c0 08             	add    $0x8,%eax
+  8008da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008e0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e5:	e9 a8 00 00 00       	jmp    800992 <vprintfmt+0x5c0>
+  8008ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f6:	eb e5                	jmp    8008dd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8008f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fe:	77 15                	ja     800915 <vprintfmt+0x543>
+  800900:	89 c2                	mov    %eax,%edx
+  800902:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800906:	83 c0 08             	add    $0x8,%eax
+  800909:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80090e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800913:	eb 7d                	jmp    800992 <vprintfmt+0x5c0>
+  800915:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800919:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800921:	eb e9                	jmp    80090c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800923:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800926:	83 f8 2f             	cmp    $0x2f,%eax
+  800929:	77 16                	ja     800941 <vprintfmt+0x56f>
+  80092b:	89 c2                	mov    %eax,%edx
+  80092d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800931:	83 c0 08             	add    $0x8,%eax
+  800934:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800937:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80093a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80093f:	eb 51                	jmp    800992 <vprintfmt+0x5c0>
+  800941:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800945:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800949:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094d:	eb e8                	jmp    800937 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80094f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800953:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800957:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80095b:	e9 5c ff ff ff       	jmp    8008bc <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800960:	4c 89 ee             	mov    %r13,%rsi
+  800963:	bf 30 00 00 00       	mov    $0x30,%edi
+  800968:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80096b:	4c 89 ee             	mov    %r13,%rsi
+  80096e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800973:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800976:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800979:	83 f8 2f             	cmp    $0x2f,%eax
+  80097c:	77 47                	ja     8009c5 <vprintfmt+0x5f3>
+  80097e:	89 c2                	mov    %eax,%edx
+  800980:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800984:	83 c0 08             	add    $0x8,%eax
+  800987:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80098d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800992:	48 83 ec 08          	sub    $0x8,%rsp
+  800996:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80099a:	0f 94 c0             	sete   %al
+  80099d:	0f b6 c0             	movzbl %al,%eax
+  8009a0:	50                   	push   %rax
+  8009a1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009a6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009aa:	4c 89 ee             	mov    %r13,%rsi
+  8009ad:	4c 89 f7             	mov    %r14,%rdi
+  8009b0:	48 b8 c7 02 80 00 00 	movabs $0x8002c7,%rax
+  8009b7:	00 00 00 
+  8009ba:	ff d0                	call   *%rax
+            break;
+  8009bc:	48 83 c4 10          	add    $0x10,%rsp
+  8009c0:	e9 3e fa ff ff       	jmp    800403 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d1:	eb b7                	jmp    80098a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d3:	40 84 f6             	test   %sil,%sil
+  8009d6:	75 2b                	jne    800a03 <vprintfmt+0x631>
+    switch (lflag) {
+  8009d8:	85 d2                	test   %edx,%edx
+  8009da:	74 56                	je     800a32 <vprintfmt+0x660>
+  8009dc:	83 fa 01             	cmp    $0x1,%edx
+  8009df:	74 7f                	je     800a60 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  8009e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009e7:	0f 87 a2 00 00 00    	ja     800a8f <vprintfmt+0x6bd>
+  8009ed:	89 c2                	mov    %eax,%edx
+  8009ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f3:	83 c0 08             	add    $0x8,%eax
+  8009f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a01:	eb 8f                	jmp    800992 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a06:	83 f8 2f             	cmp    $0x2f,%eax
+  800a09:	77 19                	ja     800a24 <vprintfmt+0x652>
+  800a0b:	89 c2                	mov    %eax,%edx
+  800a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a11:	83 c0 08             	add    $0x8,%eax
+  800a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a1f:	e9 6e ff ff ff       	jmp    800992 <vprintfmt+0x5c0>
+  800a24:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a28:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a30:	eb e5                	jmp    800a17 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 18                	ja     800a52 <vprintfmt+0x680>
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a40:	83 c0 08             	add    $0x8,%eax
+  800a43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a46:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a48:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a4d:	e9 40 ff ff ff       	jmp    800992 <vprintfmt+0x5c0>
+  800a52:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a56:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5e:	eb e6                	jmp    800a46 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a60:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a63:	83 f8 2f             	cmp    $0x2f,%eax
+  800a66:	77 19                	ja     800a81 <vprintfmt+0x6af>
+  800a68:	89 c2                	mov    %eax,%edx
+  800a6a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6e:	83 c0 08             	add    $0x8,%eax
+  800a71:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a74:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a77:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a7c:	e9 11 ff ff ff       	jmp    800992 <vprintfmt+0x5c0>
+  800a81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8d:	eb e5                	jmp    800a74 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9b:	e9 59 ff ff ff       	jmp    8009f9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800aa0:	4c 89 ee             	mov    %r13,%rsi
+  800aa3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aa8:	41 ff d6             	call   *%r14
+            break;
+  800aab:	e9 53 f9 ff ff       	jmp    800403 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ab0:	4c 89 ee             	mov    %r13,%rsi
+  800ab3:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ab8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800abb:	48 83 eb 01          	sub    $0x1,%rbx
+  800abf:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ac3:	75 f6                	jne    800abb <vprintfmt+0x6e9>
+  800ac5:	e9 39 f9 ff ff       	jmp    800403 <vprintfmt+0x31>
+}
+  800aca:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ace:	5b                   	pop    %rbx
+  800acf:	41 5c                	pop    %r12
+  800ad1:	41 5d                	pop    %r13
+  800ad3:	41 5e                	pop    %r14
+  800ad5:	41 5f                	pop    %r15
+  800ad7:	5d                   	pop    %rbp
+  800ad8:	c3                   	ret
+
+0000000000800ad9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800ad9:	55                   	push   %rbp
+  800ada:	48 89 e5             	mov    %rsp,%rbp
+  800add:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ae1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ae5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800aea:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800aee:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800af5:	48 85 ff             	test   %rdi,%rdi
+  800af8:	74 2b                	je     800b25 <vsnprintf+0x4c>
+  800afa:	48 85 f6             	test   %rsi,%rsi
+  800afd:	74 26                	je     800b25 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800aff:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b03:	48 bf 7d 03 80 00 00 	movabs $0x80037d,%rdi
+  800b0a:	00 00 00 
+  800b0d:	48 b8 d2 03 80 00 00 	movabs $0x8003d2,%rax
+  800b14:	00 00 00 
+  800b17:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b19:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b1d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b20:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b23:	c9                   	leave
+  800b24:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b25:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b2a:	eb f7                	jmp    800b23 <vsnprintf+0x4a>
+
+0000000000800b2c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b2c:	55                   	push   %rbp
+  800b2d:	48 89 e5             	mov    %rsp,%rbp
+  800b30:	48 83 ec 50          	sub    $0x50,%rsp
+  800b34:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b38:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b3c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b40:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b47:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b53:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b57:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b5b:	48 b8 d9 0a 80 00 00 	movabs $0x800ad9,%rax
+  800b62:	00 00 00 
+  800b65:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b67:	c9                   	leave
+  800b68:	c3                   	ret
+
+0000000000800b69 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b69:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b6c:	74 10                	je     800b7e <strlen+0x15>
+    size_t n = 0;
+  800b6e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b73:	48 83 c0 01          	add    $0x1,%rax
+  800b77:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b7b:	75 f6                	jne    800b73 <strlen+0xa>
+  800b7d:	c3                   	ret
+    size_t n = 0;
+  800b7e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b83:	c3                   	ret
+
+0000000000800b84 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b84:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b87:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b8c:	48 85 f6             	test   %rsi,%rsi
+  800b8f:	74 11                	je     800ba2 <strnlen+0x1e>
+  800b91:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b95:	74 0c                	je     800ba3 <strnlen+0x1f>
+  800b97:	48 83 c2 01          	add    $0x1,%rdx
+  800b9b:	48 39 d0             	cmp    %rdx,%rax
+  800b9e:	75 f1                	jne    800b91 <strnlen+0xd>
+  800ba0:	eb 04                	jmp    800ba6 <strnlen+0x22>
+  800ba2:	c3                   	ret
+  800ba3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ba6:	c3                   	ret
+
+0000000000800ba7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ba7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800baa:	ba 00 00 00 00       	mov    $0x0,%edx
+  800baf:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bb3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bb6:	48 83 c2 01          	add    $0x1,%rdx
+  800bba:	84 c9                	test   %cl,%cl
+  800bbc:	75 f1                	jne    800baf <strcpy+0x8>
+        ;
+    return res;
+}
+  800bbe:	c3                   	ret
+
+0000000000800bbf <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bbf:	55                   	push   %rbp
+  800bc0:	48 89 e5             	mov    %rsp,%rbp
+  800bc3:	41 54                	push   %r12
+  800bc5:	53                   	push   %rbx
+  800bc6:	48 89 fb             	mov    %rdi,%rbx
+  800bc9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bcc:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  800bd3:	00 00 00 
+  800bd6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bd8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bdc:	4c 89 e6             	mov    %r12,%rsi
+  800bdf:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  800be6:	00 00 00 
+  800be9:	ff d0                	call   *%rax
+    return dst;
+}
+  800beb:	48 89 d8             	mov    %rbx,%rax
+  800bee:	5b                   	pop    %rbx
+  800bef:	41 5c                	pop    %r12
+  800bf1:	5d                   	pop    %rbp
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800bf3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800bf6:	48 85 d2             	test   %rdx,%rdx
+  800bf9:	74 1f                	je     800c1a <strncpy+0x27>
+  800bfb:	48 01 fa             	add    %rdi,%rdx
+  800bfe:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c01:	48 83 c1 01          	add    $0x1,%rcx
+  800c05:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c09:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c0d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c11:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c15:	48 39 ca             	cmp    %rcx,%rdx
+  800c18:	75 e7                	jne    800c01 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c1a:	c3                   	ret
+
+0000000000800c1b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c1b:	48 89 f8             	mov    %rdi,%rax
+  800c1e:	48 85 d2             	test   %rdx,%rdx
+  800c21:	74 24                	je     800c47 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c23:	48 83 ea 01          	sub    $0x1,%rdx
+  800c27:	74 1b                	je     800c44 <strlcpy+0x29>
+  800c29:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c2d:	0f b6 16             	movzbl (%rsi),%edx
+  800c30:	84 d2                	test   %dl,%dl
+  800c32:	74 10                	je     800c44 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c34:	48 83 c6 01          	add    $0x1,%rsi
+  800c38:	48 83 c0 01          	add    $0x1,%rax
+  800c3c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c3f:	48 39 c8             	cmp    %rcx,%rax
+  800c42:	75 e9                	jne    800c2d <strlcpy+0x12>
+        *dst = '\0';
+  800c44:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c47:	48 29 f8             	sub    %rdi,%rax
+}
+  800c4a:	c3                   	ret
+
+0000000000800c4b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c4b:	0f b6 07             	movzbl (%rdi),%eax
+  800c4e:	84 c0                	test   %al,%al
+  800c50:	74 13                	je     800c65 <strcmp+0x1a>
+  800c52:	38 06                	cmp    %al,(%rsi)
+  800c54:	75 0f                	jne    800c65 <strcmp+0x1a>
+  800c56:	48 83 c7 01          	add    $0x1,%rdi
+  800c5a:	48 83 c6 01          	add    $0x1,%rsi
+  800c5e:	0f b6 07             	movzbl (%rdi),%eax
+  800c61:	84 c0                	test   %al,%al
+  800c63:	75 ed                	jne    800c52 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c65:	0f b6 c0             	movzbl %al,%eax
+  800c68:	0f b6 16             	movzbl (%rsi),%edx
+  800c6b:	29 d0                	sub    %edx,%eax
+}
+  800c6d:	c3                   	ret
+
+0000000000800c6e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c6e:	48 85 d2             	test   %rdx,%rdx
+  800c71:	74 1f                	je     800c92 <strncmp+0x24>
+  800c73:	0f b6 07             	movzbl (%rdi),%eax
+  800c76:	84 c0                	test   %al,%al
+  800c78:	74 1e                	je     800c98 <strncmp+0x2a>
+  800c7a:	3a 06                	cmp    (%rsi),%al
+  800c7c:	75 1a                	jne    800c98 <strncmp+0x2a>
+  800c7e:	48 83 c7 01          	add    $0x1,%rdi
+  800c82:	48 83 c6 01          	add    $0x1,%rsi
+  800c86:	48 83 ea 01          	sub    $0x1,%rdx
+  800c8a:	75 e7                	jne    800c73 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c91:	c3                   	ret
+  800c92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c97:	c3                   	ret
+  800c98:	48 85 d2             	test   %rdx,%rdx
+  800c9b:	74 09                	je     800ca6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c9d:	0f b6 07             	movzbl (%rdi),%eax
+  800ca0:	0f b6 16             	movzbl (%rsi),%edx
+  800ca3:	29 d0                	sub    %edx,%eax
+  800ca5:	c3                   	ret
+    if (!n) return 0;
+  800ca6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cab:	c3                   	ret
+
+0000000000800cac <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cac:	0f b6 17             	movzbl (%rdi),%edx
+  800caf:	84 d2                	test   %dl,%dl
+  800cb1:	74 18                	je     800ccb <strchr+0x1f>
+        if (*str == c) {
+  800cb3:	0f be d2             	movsbl %dl,%edx
+  800cb6:	39 f2                	cmp    %esi,%edx
+  800cb8:	74 17                	je     800cd1 <strchr+0x25>
+    for (; *str; str++) {
+  800cba:	48 83 c7 01          	add    $0x1,%rdi
+  800cbe:	0f b6 17             	movzbl (%rdi),%edx
+  800cc1:	84 d2                	test   %dl,%dl
+  800cc3:	75 ee                	jne    800cb3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cca:	c3                   	ret
+  800ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd0:	c3                   	ret
+  800cd1:	48 89 f8             	mov    %rdi,%rax
+}
+  800cd4:	c3                   	ret
+
+0000000000800cd5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cd5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cd8:	0f b6 17             	movzbl (%rdi),%edx
+  800cdb:	84 d2                	test   %dl,%dl
+  800cdd:	74 13                	je     800cf2 <strfind+0x1d>
+  800cdf:	0f be d2             	movsbl %dl,%edx
+  800ce2:	39 f2                	cmp    %esi,%edx
+  800ce4:	74 0b                	je     800cf1 <strfind+0x1c>
+  800ce6:	48 83 c0 01          	add    $0x1,%rax
+  800cea:	0f b6 10             	movzbl (%rax),%edx
+  800ced:	84 d2                	test   %dl,%dl
+  800cef:	75 ee                	jne    800cdf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800cf1:	c3                   	ret
+  800cf2:	c3                   	ret
+
+0000000000800cf3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800cf3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800cf6:	48 89 f8             	mov    %rdi,%rax
+  800cf9:	48 f7 d8             	neg    %rax
+  800cfc:	83 e0 07             	and    $0x7,%eax
+  800cff:	49 89 d1             	mov    %rdx,%r9
+  800d02:	49 29 c1             	sub    %rax,%r9
+  800d05:	78 36                	js     800d3d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d07:	40 0f b6 c6          	movzbl %sil,%eax
+  800d0b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d12:	01 01 01 
+  800d15:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d19:	40 f6 c7 07          	test   $0x7,%dil
+  800d1d:	75 38                	jne    800d57 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d1f:	4c 89 c9             	mov    %r9,%rcx
+  800d22:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d26:	74 0c                	je     800d34 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d28:	fc                   	cld
+  800d29:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d2c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d30:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d34:	4d 85 c9             	test   %r9,%r9
+  800d37:	75 45                	jne    800d7e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d39:	4c 89 c0             	mov    %r8,%rax
+  800d3c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d3d:	48 85 d2             	test   %rdx,%rdx
+  800d40:	74 f7                	je     800d39 <memset+0x46>
+  800d42:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d45:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d48:	48 83 c0 01          	add    $0x1,%rax
+  800d4c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d50:	48 39 c2             	cmp    %rax,%rdx
+  800d53:	75 f3                	jne    800d48 <memset+0x55>
+  800d55:	eb e2                	jmp    800d39 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d57:	40 f6 c7 01          	test   $0x1,%dil
+  800d5b:	74 06                	je     800d63 <memset+0x70>
+  800d5d:	88 07                	mov    %al,(%rdi)
+  800d5f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d63:	40 f6 c7 02          	test   $0x2,%dil
+  800d67:	74 07                	je     800d70 <memset+0x7d>
+  800d69:	66 89 07             	mov    %ax,(%rdi)
+  800d6c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d70:	40 f6 c7 04          	test   $0x4,%dil
+  800d74:	74 a9                	je     800d1f <memset+0x2c>
+  800d76:	89 07                	mov    %eax,(%rdi)
+  800d78:	48 83 c7 04          	add    $0x4,%rdi
+  800d7c:	eb a1                	jmp    800d1f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d7e:	41 f6 c1 04          	test   $0x4,%r9b
+  800d82:	74 06                	je     800d8a <memset+0x97>
+  800d84:	89 07                	mov    %eax,(%rdi)
+  800d86:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d8a:	41 f6 c1 02          	test   $0x2,%r9b
+  800d8e:	74 07                	je     800d97 <memset+0xa4>
+  800d90:	66 89 07             	mov    %ax,(%rdi)
+  800d93:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d97:	41 f6 c1 01          	test   $0x1,%r9b
+  800d9b:	74 9c                	je     800d39 <memset+0x46>
+  800d9d:	88 07                	mov    %al,(%rdi)
+  800d9f:	eb 98                	jmp    800d39 <memset+0x46>
+
+0000000000800da1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800da1:	48 89 f8             	mov    %rdi,%rax
+  800da4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800da7:	48 39 fe             	cmp    %rdi,%rsi
+  800daa:	73 3b                	jae    800de7 <memmove+0x46>
+  800dac:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800db0:	48 39 d7             	cmp    %rdx,%rdi
+  800db3:	73 32                	jae    800de7 <memmove+0x46>
+        s += n;
+        d += n;
+  800db5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800db9:	48 89 d6             	mov    %rdx,%rsi
+  800dbc:	48 09 fe             	or     %rdi,%rsi
+  800dbf:	48 09 ce             	or     %rcx,%rsi
+  800dc2:	40 f6 c6 07          	test   $0x7,%sil
+  800dc6:	75 12                	jne    800dda <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dc8:	48 83 ef 08          	sub    $0x8,%rdi
+  800dcc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800dd0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800dd4:	fd                   	std
+  800dd5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dd8:	fc                   	cld
+  800dd9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dda:	48 83 ef 01          	sub    $0x1,%rdi
+  800dde:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800de2:	fd                   	std
+  800de3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800de5:	eb f1                	jmp    800dd8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800de7:	48 89 f2             	mov    %rsi,%rdx
+  800dea:	48 09 c2             	or     %rax,%rdx
+  800ded:	48 09 ca             	or     %rcx,%rdx
+  800df0:	f6 c2 07             	test   $0x7,%dl
+  800df3:	75 0c                	jne    800e01 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800df5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df9:	48 89 c7             	mov    %rax,%rdi
+  800dfc:	fc                   	cld
+  800dfd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e00:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e01:	48 89 c7             	mov    %rax,%rdi
+  800e04:	fc                   	cld
+  800e05:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e07:	c3                   	ret
+
+0000000000800e08 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e08:	55                   	push   %rbp
+  800e09:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e0c:	48 b8 a1 0d 80 00 00 	movabs $0x800da1,%rax
+  800e13:	00 00 00 
+  800e16:	ff d0                	call   *%rax
+}
+  800e18:	5d                   	pop    %rbp
+  800e19:	c3                   	ret
+
+0000000000800e1a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e1a:	55                   	push   %rbp
+  800e1b:	48 89 e5             	mov    %rsp,%rbp
+  800e1e:	41 57                	push   %r15
+  800e20:	41 56                	push   %r14
+  800e22:	41 55                	push   %r13
+  800e24:	41 54                	push   %r12
+  800e26:	53                   	push   %rbx
+  800e27:	48 83 ec 08          	sub    $0x8,%rsp
+  800e2b:	49 89 fe             	mov    %rdi,%r14
+  800e2e:	49 89 f7             	mov    %rsi,%r15
+  800e31:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e34:	48 89 f7             	mov    %rsi,%rdi
+  800e37:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  800e3e:	00 00 00 
+  800e41:	ff d0                	call   *%rax
+  800e43:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e46:	48 89 de             	mov    %rbx,%rsi
+  800e49:	4c 89 f7             	mov    %r14,%rdi
+  800e4c:	48 b8 84 0b 80 00 00 	movabs $0x800b84,%rax
+  800e53:	00 00 00 
+  800e56:	ff d0                	call   *%rax
+  800e58:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e5b:	48 39 c3             	cmp    %rax,%rbx
+  800e5e:	74 36                	je     800e96 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e60:	48 89 d8             	mov    %rbx,%rax
+  800e63:	4c 29 e8             	sub    %r13,%rax
+  800e66:	49 39 c4             	cmp    %rax,%r12
+  800e69:	73 31                	jae    800e9c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e6b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e70:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e74:	4c 89 fe             	mov    %r15,%rsi
+  800e77:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  800e7e:	00 00 00 
+  800e81:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e83:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e87:	48 83 c4 08          	add    $0x8,%rsp
+  800e8b:	5b                   	pop    %rbx
+  800e8c:	41 5c                	pop    %r12
+  800e8e:	41 5d                	pop    %r13
+  800e90:	41 5e                	pop    %r14
+  800e92:	41 5f                	pop    %r15
+  800e94:	5d                   	pop    %rbp
+  800e95:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e96:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e9a:	eb eb                	jmp    800e87 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e9c:	48 83 eb 01          	sub    $0x1,%rbx
+  800ea0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ea4:	48 89 da             	mov    %rbx,%rdx
+  800ea7:	4c 89 fe             	mov    %r15,%rsi
+  800eaa:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  800eb1:	00 00 00 
+  800eb4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eb6:	49 01 de             	add    %rbx,%r14
+  800eb9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ebe:	eb c3                	jmp    800e83 <strlcat+0x69>
+
+0000000000800ec0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ec0:	48 85 d2             	test   %rdx,%rdx
+  800ec3:	74 2d                	je     800ef2 <memcmp+0x32>
+  800ec5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eca:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ece:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ed3:	44 38 c1             	cmp    %r8b,%cl
+  800ed6:	75 0f                	jne    800ee7 <memcmp+0x27>
+    while (n-- > 0) {
+  800ed8:	48 83 c0 01          	add    $0x1,%rax
+  800edc:	48 39 c2             	cmp    %rax,%rdx
+  800edf:	75 e9                	jne    800eca <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800ee1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ee6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800ee7:	0f b6 c1             	movzbl %cl,%eax
+  800eea:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800eee:	44 29 c0             	sub    %r8d,%eax
+  800ef1:	c3                   	ret
+    return 0;
+  800ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ef7:	c3                   	ret
+
+0000000000800ef8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800ef8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800efc:	48 39 c7             	cmp    %rax,%rdi
+  800eff:	73 0f                	jae    800f10 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f01:	40 38 37             	cmp    %sil,(%rdi)
+  800f04:	74 0e                	je     800f14 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f06:	48 83 c7 01          	add    $0x1,%rdi
+  800f0a:	48 39 f8             	cmp    %rdi,%rax
+  800f0d:	75 f2                	jne    800f01 <memfind+0x9>
+  800f0f:	c3                   	ret
+  800f10:	48 89 f8             	mov    %rdi,%rax
+  800f13:	c3                   	ret
+  800f14:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f17:	c3                   	ret
+
+0000000000800f18 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f18:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f1b:	0f b6 37             	movzbl (%rdi),%esi
+  800f1e:	40 80 fe 20          	cmp    $0x20,%sil
+  800f22:	74 06                	je     800f2a <strtol+0x12>
+  800f24:	40 80 fe 09          	cmp    $0x9,%sil
+  800f28:	75 13                	jne    800f3d <strtol+0x25>
+  800f2a:	48 83 c7 01          	add    $0x1,%rdi
+  800f2e:	0f b6 37             	movzbl (%rdi),%esi
+  800f31:	40 80 fe 20          	cmp    $0x20,%sil
+  800f35:	74 f3                	je     800f2a <strtol+0x12>
+  800f37:	40 80 fe 09          	cmp    $0x9,%sil
+  800f3b:	74 ed                	je     800f2a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f3d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f40:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f43:	3c 01                	cmp    $0x1,%al
+  800f45:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f49:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f4f:	75 0f                	jne    800f60 <strtol+0x48>
+  800f51:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f54:	74 14                	je     800f6a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f56:	85 d2                	test   %edx,%edx
+  800f58:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f5d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f60:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f65:	4c 63 ca             	movslq %edx,%r9
+  800f68:	eb 36                	jmp    800fa0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f6a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f6e:	74 0f                	je     800f7f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f70:	85 d2                	test   %edx,%edx
+  800f72:	75 ec                	jne    800f60 <strtol+0x48>
+        s++;
+  800f74:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f78:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f7d:	eb e1                	jmp    800f60 <strtol+0x48>
+        s += 2;
+  800f7f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f83:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f88:	eb d6                	jmp    800f60 <strtol+0x48>
+            dig -= '0';
+  800f8a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f8d:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f91:	41 39 d0             	cmp    %edx,%r8d
+  800f94:	7d 21                	jge    800fb7 <strtol+0x9f>
+        val = val * base + dig;
+  800f96:	49 0f af c1          	imul   %r9,%rax
+  800f9a:	0f b6 c9             	movzbl %cl,%ecx
+  800f9d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fa0:	48 83 c7 01          	add    $0x1,%rdi
+  800fa4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fa8:	80 f9 39             	cmp    $0x39,%cl
+  800fab:	76 dd                	jbe    800f8a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fad:	80 f9 7b             	cmp    $0x7b,%cl
+  800fb0:	77 05                	ja     800fb7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fb2:	83 e9 57             	sub    $0x57,%ecx
+  800fb5:	eb d6                	jmp    800f8d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fb7:	4d 85 d2             	test   %r10,%r10
+  800fba:	74 03                	je     800fbf <strtol+0xa7>
+  800fbc:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fbf:	48 89 c2             	mov    %rax,%rdx
+  800fc2:	48 f7 da             	neg    %rdx
+  800fc5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fc9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800fcd:	c3                   	ret
+
+0000000000800fce <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800fce:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fd3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fde:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800fea:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800fec:	c3                   	ret
+
+0000000000800fed <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fed:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800ff2:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800ffc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801001:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801007:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80100d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801013:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801015:	c3                   	ret
+
+0000000000801016 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801016:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801019:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80101e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801023:	ba 00 00 00 00       	mov    $0x0,%edx
+  801028:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801034:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80103a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80103c:	48 85 c0             	test   %rax,%rax
+  80103f:	7f 01                	jg     801042 <sys_env_destroy+0x2c>
+}
+  801041:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801042:	55                   	push   %rbp
+  801043:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801046:	49 89 c0             	mov    %rax,%r8
+  801049:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80104e:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801055:	00 00 00 
+  801058:	be 29 00 00 00       	mov    $0x29,%esi
+  80105d:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801064:	00 00 00 
+  801067:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106c:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  801073:	00 00 00 
+  801076:	41 ff d1             	call   *%r9
+
+0000000000801079 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801079:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80107e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801083:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801093:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801099:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80109f:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010a1:	c3                   	ret
+
+00000000008010a2 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010a2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ac:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010c8:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ca:	c3                   	ret
+
+00000000008010cb <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010cb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010d0:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8010d7:	00 00 00 
+  8010da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010ec:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8010ee:	c3                   	ret
+
+00000000008010ef <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8010ef:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8010f2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801103:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801105:	c3                   	ret
+
+0000000000801106 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801106:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801109:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80110e:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801111:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801117:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80111d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80111f:	48 85 c0             	test   %rax,%rax
+  801122:	7f 01                	jg     801125 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801124:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801125:	55                   	push   %rbp
+  801126:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801129:	49 89 c0             	mov    %rax,%r8
+  80112c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801131:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801138:	00 00 00 
+  80113b:	be 29 00 00 00       	mov    $0x29,%esi
+  801140:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801147:	00 00 00 
+  80114a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114f:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  801156:	00 00 00 
+  801159:	41 ff d1             	call   *%r9
+
+000000000080115c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80115c:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80115f:	48 63 d2             	movslq %edx,%rdx
+  801162:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801165:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80116a:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80116d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80116f:	48 85 c0             	test   %rax,%rax
+  801172:	7f 01                	jg     801175 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801174:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801175:	55                   	push   %rbp
+  801176:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801179:	49 89 c0             	mov    %rax,%r8
+  80117c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801181:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801188:	00 00 00 
+  80118b:	be 29 00 00 00       	mov    $0x29,%esi
+  801190:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801197:	00 00 00 
+  80119a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119f:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  8011a6:	00 00 00 
+  8011a9:	41 ff d1             	call   *%r9
+
+00000000008011ac <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011ac:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011af:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011b4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011c6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011c8:	48 85 c0             	test   %rax,%rax
+  8011cb:	7f 01                	jg     8011ce <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011cd:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011ce:	55                   	push   %rbp
+  8011cf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011d2:	49 89 c0             	mov    %rax,%r8
+  8011d5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011da:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  8011e1:	00 00 00 
+  8011e4:	be 29 00 00 00       	mov    $0x29,%esi
+  8011e9:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  8011f0:	00 00 00 
+  8011f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011f8:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  8011ff:	00 00 00 
+  801202:	41 ff d1             	call   *%r9
+
+0000000000801205 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801205:	48 63 f6             	movslq %esi,%rsi
+  801208:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80120b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801210:	ba 00 00 00 00       	mov    $0x0,%edx
+  801215:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80121b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801221:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801227:	0f 05                	syscall
+    if (check && ret > 0) {
+  801229:	48 85 c0             	test   %rax,%rax
+  80122c:	7f 01                	jg     80122f <sys_env_set_status+0x2a>
+}
+  80122e:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80122f:	55                   	push   %rbp
+  801230:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801233:	49 89 c0             	mov    %rax,%r8
+  801236:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80123b:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801242:	00 00 00 
+  801245:	be 29 00 00 00       	mov    $0x29,%esi
+  80124a:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801251:	00 00 00 
+  801254:	b8 00 00 00 00       	mov    $0x0,%eax
+  801259:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  801260:	00 00 00 
+  801263:	41 ff d1             	call   *%r9
+
+0000000000801266 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801266:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801269:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80126e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801273:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801279:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80127f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801285:	0f 05                	syscall
+    if (check && ret > 0) {
+  801287:	48 85 c0             	test   %rax,%rax
+  80128a:	7f 01                	jg     80128d <sys_env_set_trapframe+0x27>
+}
+  80128c:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80128d:	55                   	push   %rbp
+  80128e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801291:	49 89 c0             	mov    %rax,%r8
+  801294:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801299:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  8012a0:	00 00 00 
+  8012a3:	be 29 00 00 00       	mov    $0x29,%esi
+  8012a8:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  8012af:	00 00 00 
+  8012b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012b7:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  8012be:	00 00 00 
+  8012c1:	41 ff d1             	call   *%r9
+
+00000000008012c4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8012c4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012c7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012e5:	48 85 c0             	test   %rax,%rax
+  8012e8:	7f 01                	jg     8012eb <sys_env_set_pgfault_upcall+0x27>
+}
+  8012ea:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8012eb:	55                   	push   %rbp
+  8012ec:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012ef:	49 89 c0             	mov    %rax,%r8
+  8012f2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8012f7:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  8012fe:	00 00 00 
+  801301:	be 29 00 00 00       	mov    $0x29,%esi
+  801306:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  80130d:	00 00 00 
+  801310:	b8 00 00 00 00       	mov    $0x0,%eax
+  801315:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  80131c:	00 00 00 
+  80131f:	41 ff d1             	call   *%r9
+
+0000000000801322 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801322:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801325:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801328:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132d:	4d 63 c0             	movslq %r8d,%r8
+  801330:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801336:	0f 05                	syscall
+}
+  801338:	c3                   	ret
+
+0000000000801339 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801339:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80133c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801344:	4d 63 c0             	movslq %r8d,%r8
+  801347:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134d:	0f 05                	syscall
+}
+  80134f:	c3                   	ret
+
+0000000000801350 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801350:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801355:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801358:	45 89 c0             	mov    %r8d,%r8d
+  80135b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801361:	0f 05                	syscall
+    if (check && ret > 0) {
+  801363:	48 85 c0             	test   %rax,%rax
+  801366:	7f 01                	jg     801369 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801368:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801369:	55                   	push   %rbp
+  80136a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136d:	49 89 c0             	mov    %rax,%r8
+  801370:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801375:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  80137c:	00 00 00 
+  80137f:	be 29 00 00 00       	mov    $0x29,%esi
+  801384:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  80138b:	00 00 00 
+  80138e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801393:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  80139a:	00 00 00 
+  80139d:	41 ff d1             	call   *%r9
+
+00000000008013a0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8013a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b4:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  8013bb:	00 00 00 
+  8013be:	ff d0                	call   *%rax
+}
+  8013c0:	5d                   	pop    %rbp
+  8013c1:	c3                   	ret
+
+00000000008013c2 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013c2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013cc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e8:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ea:	c3                   	ret
+
+00000000008013eb <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013eb:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013f0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801400:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801406:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80140c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80140e:	48 85 c0             	test   %rax,%rax
+  801411:	7f 01                	jg     801414 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801413:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801414:	55                   	push   %rbp
+  801415:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801418:	49 89 c0             	mov    %rax,%r8
+  80141b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801420:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801427:	00 00 00 
+  80142a:	be 29 00 00 00       	mov    $0x29,%esi
+  80142f:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801436:	00 00 00 
+  801439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80143e:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  801445:	00 00 00 
+  801448:	41 ff d1             	call   *%r9
+
+000000000080144b <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80145a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801471:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801473:	c3                   	ret
+
+0000000000801474 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801474:	89 d2                	mov    %edx,%edx
+  801476:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801478:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80147d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801483:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801489:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80148f:	0f 05                	syscall
+}
+  801491:	c3                   	ret
+
+0000000000801492 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801492:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801495:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80149a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b1:	0f 05                	syscall
+}
+  8014b3:	c3                   	ret
+
+00000000008014b4 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8014b4:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b7:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014d3:	0f 05                	syscall
+}
+  8014d5:	c3                   	ret
+
+00000000008014d6 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8014d6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014d9:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014fa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014fc:	48 85 c0             	test   %rax,%rax
+  8014ff:	7f 01                	jg     801502 <sys_irq_ack+0x2c>
+}
+  801501:	c3                   	ret
+sys_irq_ack(int irq) {
+  801502:	55                   	push   %rbp
+  801503:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801506:	49 89 c0             	mov    %rax,%r8
+  801509:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80150e:	48 ba f8 4c 80 00 00 	movabs $0x804cf8,%rdx
+  801515:	00 00 00 
+  801518:	be 29 00 00 00       	mov    $0x29,%esi
+  80151d:	48 bf 17 4d 80 00 00 	movabs $0x804d17,%rdi
+  801524:	00 00 00 
+  801527:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152c:	49 b9 eb 43 80 00 00 	movabs $0x8043eb,%r9
+  801533:	00 00 00 
+  801536:	41 ff d1             	call   *%r9
+
+0000000000801539 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+  80153d:	41 55                	push   %r13
+  80153f:	41 54                	push   %r12
+  801541:	53                   	push   %rbx
+  801542:	48 83 ec 08          	sub    $0x8,%rsp
+  801546:	49 89 fd             	mov    %rdi,%r13
+  801549:	48 89 f7             	mov    %rsi,%rdi
+  80154c:	48 89 d3             	mov    %rdx,%rbx
+  80154f:	49 89 cc             	mov    %rcx,%r12
+  801552:	4c 89 c2             	mov    %r8,%rdx
+  801555:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801558:	48 85 f6             	test   %rsi,%rsi
+  80155b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801562:	00 00 00 
+  801565:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  801569:	be 00 10 00 00       	mov    $0x1000,%esi
+  80156e:	48 85 db             	test   %rbx,%rbx
+  801571:	74 03                	je     801576 <ipc_recv_futex+0x3d>
+  801573:	48 8b 33             	mov    (%rbx),%rsi
+  801576:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80157a:	48 b8 50 13 80 00 00 	movabs $0x801350,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+    if (res < 0) {
+  801586:	85 c0                	test   %eax,%eax
+  801588:	78 75                	js     8015ff <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80158a:	4d 85 ed             	test   %r13,%r13
+  80158d:	74 14                	je     8015a3 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80158f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801596:	00 00 00 
+  801599:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80159f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8015a3:	4d 85 e4             	test   %r12,%r12
+  8015a6:	74 14                	je     8015bc <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8015a8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015af:	00 00 00 
+  8015b2:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8015b8:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8015bc:	48 85 db             	test   %rbx,%rbx
+  8015bf:	74 23                	je     8015e4 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8015c1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015c8:	00 00 00 
+  8015cb:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8015d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d6:	85 c9                	test   %ecx,%ecx
+  8015d8:	74 07                	je     8015e1 <ipc_recv_futex+0xa8>
+  8015da:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8015e1:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8015e4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015eb:	00 00 00 
+  8015ee:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8015f4:	48 83 c4 08          	add    $0x8,%rsp
+  8015f8:	5b                   	pop    %rbx
+  8015f9:	41 5c                	pop    %r12
+  8015fb:	41 5d                	pop    %r13
+  8015fd:	5d                   	pop    %rbp
+  8015fe:	c3                   	ret
+        if (from_env_store != NULL) {
+  8015ff:	4d 85 ed             	test   %r13,%r13
+  801602:	74 08                	je     80160c <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801604:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80160b:	00 
+        if (perm_store != NULL) {
+  80160c:	4d 85 e4             	test   %r12,%r12
+  80160f:	74 08                	je     801619 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801611:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801618:	00 
+        if (size != NULL) {
+  801619:	48 85 db             	test   %rbx,%rbx
+  80161c:	74 d6                	je     8015f4 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80161e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801625:	eb cd                	jmp    8015f4 <ipc_recv_futex+0xbb>
+
+0000000000801627 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801627:	55                   	push   %rbp
+  801628:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80162b:	48 83 ec 08          	sub    $0x8,%rsp
+  80162f:	6a 00                	push   $0x0
+  801631:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801637:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80163d:	48 b8 39 15 80 00 00 	movabs $0x801539,%rax
+  801644:	00 00 00 
+  801647:	ff d0                	call   *%rax
+}
+  801649:	c9                   	leave
+  80164a:	c3                   	ret
+
+000000000080164b <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80164b:	55                   	push   %rbp
+  80164c:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80164f:	48 85 d2             	test   %rdx,%rdx
+  801652:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801659:	00 00 00 
+  80165c:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801660:	89 f6                	mov    %esi,%esi
+  801662:	48 b8 39 13 80 00 00 	movabs $0x801339,%rax
+  801669:	00 00 00 
+  80166c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 02                	js     801674 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801672:	5d                   	pop    %rbp
+  801673:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801674:	89 c1                	mov    %eax,%ecx
+  801676:	48 ba 25 4d 80 00 00 	movabs $0x804d25,%rdx
+  80167d:	00 00 00 
+  801680:	be 50 00 00 00       	mov    $0x50,%esi
+  801685:	48 bf 39 4d 80 00 00 	movabs $0x804d39,%rdi
+  80168c:	00 00 00 
+  80168f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801694:	49 b8 eb 43 80 00 00 	movabs $0x8043eb,%r8
+  80169b:	00 00 00 
+  80169e:	41 ff d0             	call   *%r8
+
+00000000008016a1 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8016a1:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8016a6:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8016ad:	00 00 00 
+  8016b0:	48 89 d0             	mov    %rdx,%rax
+  8016b3:	48 c1 e0 04          	shl    $0x4,%rax
+  8016b7:	48 29 d0             	sub    %rdx,%rax
+  8016ba:	48 c1 e0 05          	shl    $0x5,%rax
+  8016be:	48 01 c8             	add    %rcx,%rax
+  8016c1:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8016c7:	39 f8                	cmp    %edi,%eax
+  8016c9:	74 13                	je     8016de <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8016cb:	48 83 c2 01          	add    $0x1,%rdx
+  8016cf:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8016d6:	75 d8                	jne    8016b0 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8016dd:	c3                   	ret
+            return envs[i].env_id;
+  8016de:	48 89 d0             	mov    %rdx,%rax
+  8016e1:	48 c1 e0 04          	shl    $0x4,%rax
+  8016e5:	48 29 d0             	sub    %rdx,%rax
+  8016e8:	48 c1 e0 05          	shl    $0x5,%rax
+  8016ec:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8016f3:	00 00 00 
+  8016f6:	48 01 d0             	add    %rdx,%rax
+  8016f9:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8016ff:	c3                   	ret
+
+0000000000801700 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801700:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801707:	ff ff ff 
+  80170a:	48 01 f8             	add    %rdi,%rax
+  80170d:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801711:	c3                   	ret
+
+0000000000801712 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801712:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801719:	ff ff ff 
+  80171c:	48 01 f8             	add    %rdi,%rax
+  80171f:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801723:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801729:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80172d:	c3                   	ret
+
+000000000080172e <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80172e:	55                   	push   %rbp
+  80172f:	48 89 e5             	mov    %rsp,%rbp
+  801732:	41 57                	push   %r15
+  801734:	41 56                	push   %r14
+  801736:	41 55                	push   %r13
+  801738:	41 54                	push   %r12
+  80173a:	53                   	push   %rbx
+  80173b:	48 83 ec 08          	sub    $0x8,%rsp
+  80173f:	49 89 ff             	mov    %rdi,%r15
+  801742:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801747:	49 bd bd 3e 80 00 00 	movabs $0x803ebd,%r13
+  80174e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801751:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801757:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80175a:	48 89 df             	mov    %rbx,%rdi
+  80175d:	41 ff d5             	call   *%r13
+  801760:	83 e0 04             	and    $0x4,%eax
+  801763:	74 17                	je     80177c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801765:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80176c:	4c 39 f3             	cmp    %r14,%rbx
+  80176f:	75 e6                	jne    801757 <fd_alloc+0x29>
+  801771:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801777:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80177c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80177f:	48 83 c4 08          	add    $0x8,%rsp
+  801783:	5b                   	pop    %rbx
+  801784:	41 5c                	pop    %r12
+  801786:	41 5d                	pop    %r13
+  801788:	41 5e                	pop    %r14
+  80178a:	41 5f                	pop    %r15
+  80178c:	5d                   	pop    %rbp
+  80178d:	c3                   	ret
+
+000000000080178e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80178e:	83 ff 1f             	cmp    $0x1f,%edi
+  801791:	77 39                	ja     8017cc <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801793:	55                   	push   %rbp
+  801794:	48 89 e5             	mov    %rsp,%rbp
+  801797:	41 54                	push   %r12
+  801799:	53                   	push   %rbx
+  80179a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80179d:	48 63 df             	movslq %edi,%rbx
+  8017a0:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017a7:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017ab:	48 89 df             	mov    %rbx,%rdi
+  8017ae:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  8017b5:	00 00 00 
+  8017b8:	ff d0                	call   *%rax
+  8017ba:	a8 04                	test   $0x4,%al
+  8017bc:	74 14                	je     8017d2 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017be:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017c7:	5b                   	pop    %rbx
+  8017c8:	41 5c                	pop    %r12
+  8017ca:	5d                   	pop    %rbp
+  8017cb:	c3                   	ret
+        return -E_INVAL;
+  8017cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017d1:	c3                   	ret
+        return -E_INVAL;
+  8017d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017d7:	eb ee                	jmp    8017c7 <fd_lookup+0x39>
+
+00000000008017d9 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	41 54                	push   %r12
+  8017df:	53                   	push   %rbx
+  8017e0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017e3:	48 b8 e0 4d 80 00 00 	movabs $0x804de0,%rax
+  8017ea:	00 00 00 
+  8017ed:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8017f4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017f7:	39 3b                	cmp    %edi,(%rbx)
+  8017f9:	74 47                	je     801842 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017fb:	48 83 c0 08          	add    $0x8,%rax
+  8017ff:	48 8b 18             	mov    (%rax),%rbx
+  801802:	48 85 db             	test   %rbx,%rbx
+  801805:	75 f0                	jne    8017f7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801807:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80180e:	00 00 00 
+  801811:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801817:	89 fa                	mov    %edi,%edx
+  801819:	48 bf 48 4d 80 00 00 	movabs $0x804d48,%rdi
+  801820:	00 00 00 
+  801823:	b8 00 00 00 00       	mov    $0x0,%eax
+  801828:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  80182f:	00 00 00 
+  801832:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801834:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801839:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80183d:	5b                   	pop    %rbx
+  80183e:	41 5c                	pop    %r12
+  801840:	5d                   	pop    %rbp
+  801841:	c3                   	ret
+            return 0;
+  801842:	b8 00 00 00 00       	mov    $0x0,%eax
+  801847:	eb f0                	jmp    801839 <dev_lookup+0x60>
+
+0000000000801849 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801849:	55                   	push   %rbp
+  80184a:	48 89 e5             	mov    %rsp,%rbp
+  80184d:	41 55                	push   %r13
+  80184f:	41 54                	push   %r12
+  801851:	53                   	push   %rbx
+  801852:	48 83 ec 18          	sub    $0x18,%rsp
+  801856:	48 89 fb             	mov    %rdi,%rbx
+  801859:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80185c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801863:	ff ff ff 
+  801866:	48 01 df             	add    %rbx,%rdi
+  801869:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80186d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801871:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801878:	00 00 00 
+  80187b:	ff d0                	call   *%rax
+  80187d:	41 89 c5             	mov    %eax,%r13d
+  801880:	85 c0                	test   %eax,%eax
+  801882:	78 06                	js     80188a <fd_close+0x41>
+  801884:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801888:	74 1a                	je     8018a4 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80188a:	45 84 e4             	test   %r12b,%r12b
+  80188d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801892:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801896:	44 89 e8             	mov    %r13d,%eax
+  801899:	48 83 c4 18          	add    $0x18,%rsp
+  80189d:	5b                   	pop    %rbx
+  80189e:	41 5c                	pop    %r12
+  8018a0:	41 5d                	pop    %r13
+  8018a2:	5d                   	pop    %rbp
+  8018a3:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018a4:	8b 3b                	mov    (%rbx),%edi
+  8018a6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018aa:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  8018b1:	00 00 00 
+  8018b4:	ff d0                	call   *%rax
+  8018b6:	41 89 c5             	mov    %eax,%r13d
+  8018b9:	85 c0                	test   %eax,%eax
+  8018bb:	78 1b                	js     8018d8 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018bd:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018c1:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018c5:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018cb:	48 85 c0             	test   %rax,%rax
+  8018ce:	74 08                	je     8018d8 <fd_close+0x8f>
+  8018d0:	48 89 df             	mov    %rbx,%rdi
+  8018d3:	ff d0                	call   *%rax
+  8018d5:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018dd:	48 89 de             	mov    %rbx,%rsi
+  8018e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e5:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  8018ec:	00 00 00 
+  8018ef:	ff d0                	call   *%rax
+    return res;
+  8018f1:	eb a3                	jmp    801896 <fd_close+0x4d>
+
+00000000008018f3 <close>:
+
+int
+close(int fdnum) {
+  8018f3:	55                   	push   %rbp
+  8018f4:	48 89 e5             	mov    %rsp,%rbp
+  8018f7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018fb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018ff:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801906:	00 00 00 
+  801909:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80190b:	85 c0                	test   %eax,%eax
+  80190d:	78 15                	js     801924 <close+0x31>
+
+    return fd_close(fd, 1);
+  80190f:	be 01 00 00 00       	mov    $0x1,%esi
+  801914:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801918:	48 b8 49 18 80 00 00 	movabs $0x801849,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+}
+  801924:	c9                   	leave
+  801925:	c3                   	ret
+
+0000000000801926 <close_all>:
+
+void
+close_all(void) {
+  801926:	55                   	push   %rbp
+  801927:	48 89 e5             	mov    %rsp,%rbp
+  80192a:	41 54                	push   %r12
+  80192c:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80192d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801932:	49 bc f3 18 80 00 00 	movabs $0x8018f3,%r12
+  801939:	00 00 00 
+  80193c:	89 df                	mov    %ebx,%edi
+  80193e:	41 ff d4             	call   *%r12
+  801941:	83 c3 01             	add    $0x1,%ebx
+  801944:	83 fb 20             	cmp    $0x20,%ebx
+  801947:	75 f3                	jne    80193c <close_all+0x16>
+}
+  801949:	5b                   	pop    %rbx
+  80194a:	41 5c                	pop    %r12
+  80194c:	5d                   	pop    %rbp
+  80194d:	c3                   	ret
+
+000000000080194e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80194e:	55                   	push   %rbp
+  80194f:	48 89 e5             	mov    %rsp,%rbp
+  801952:	41 57                	push   %r15
+  801954:	41 56                	push   %r14
+  801956:	41 55                	push   %r13
+  801958:	41 54                	push   %r12
+  80195a:	53                   	push   %rbx
+  80195b:	48 83 ec 18          	sub    $0x18,%rsp
+  80195f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801962:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801966:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  80196d:	00 00 00 
+  801970:	ff d0                	call   *%rax
+  801972:	89 c3                	mov    %eax,%ebx
+  801974:	85 c0                	test   %eax,%eax
+  801976:	0f 88 b8 00 00 00    	js     801a34 <dup+0xe6>
+    close(newfdnum);
+  80197c:	44 89 e7             	mov    %r12d,%edi
+  80197f:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80198b:	4d 63 ec             	movslq %r12d,%r13
+  80198e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801995:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801999:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80199d:	4c 89 ff             	mov    %r15,%rdi
+  8019a0:	49 be 12 17 80 00 00 	movabs $0x801712,%r14
+  8019a7:	00 00 00 
+  8019aa:	41 ff d6             	call   *%r14
+  8019ad:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019b0:	4c 89 ef             	mov    %r13,%rdi
+  8019b3:	41 ff d6             	call   *%r14
+  8019b6:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019b9:	48 89 df             	mov    %rbx,%rdi
+  8019bc:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019c8:	a8 04                	test   $0x4,%al
+  8019ca:	74 2b                	je     8019f7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019cc:	41 89 c1             	mov    %eax,%r9d
+  8019cf:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019d5:	4c 89 f1             	mov    %r14,%rcx
+  8019d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019dd:	48 89 de             	mov    %rbx,%rsi
+  8019e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e5:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8019ec:	00 00 00 
+  8019ef:	ff d0                	call   *%rax
+  8019f1:	89 c3                	mov    %eax,%ebx
+  8019f3:	85 c0                	test   %eax,%eax
+  8019f5:	78 4e                	js     801a45 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019f7:	4c 89 ff             	mov    %r15,%rdi
+  8019fa:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  801a01:	00 00 00 
+  801a04:	ff d0                	call   *%rax
+  801a06:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a09:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a0f:	4c 89 e9             	mov    %r13,%rcx
+  801a12:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a17:	4c 89 fe             	mov    %r15,%rsi
+  801a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1f:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  801a26:	00 00 00 
+  801a29:	ff d0                	call   *%rax
+  801a2b:	89 c3                	mov    %eax,%ebx
+  801a2d:	85 c0                	test   %eax,%eax
+  801a2f:	78 14                	js     801a45 <dup+0xf7>
+
+    return newfdnum;
+  801a31:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a34:	89 d8                	mov    %ebx,%eax
+  801a36:	48 83 c4 18          	add    $0x18,%rsp
+  801a3a:	5b                   	pop    %rbx
+  801a3b:	41 5c                	pop    %r12
+  801a3d:	41 5d                	pop    %r13
+  801a3f:	41 5e                	pop    %r14
+  801a41:	41 5f                	pop    %r15
+  801a43:	5d                   	pop    %rbp
+  801a44:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a4a:	4c 89 ee             	mov    %r13,%rsi
+  801a4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a52:	49 bc ac 11 80 00 00 	movabs $0x8011ac,%r12
+  801a59:	00 00 00 
+  801a5c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a5f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a64:	4c 89 f6             	mov    %r14,%rsi
+  801a67:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6c:	41 ff d4             	call   *%r12
+    return res;
+  801a6f:	eb c3                	jmp    801a34 <dup+0xe6>
+
+0000000000801a71 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a71:	55                   	push   %rbp
+  801a72:	48 89 e5             	mov    %rsp,%rbp
+  801a75:	41 56                	push   %r14
+  801a77:	41 55                	push   %r13
+  801a79:	41 54                	push   %r12
+  801a7b:	53                   	push   %rbx
+  801a7c:	48 83 ec 10          	sub    $0x10,%rsp
+  801a80:	89 fb                	mov    %edi,%ebx
+  801a82:	49 89 f4             	mov    %rsi,%r12
+  801a85:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a88:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a8c:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801a93:	00 00 00 
+  801a96:	ff d0                	call   *%rax
+  801a98:	85 c0                	test   %eax,%eax
+  801a9a:	78 4c                	js     801ae8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a9c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801aa0:	41 8b 3e             	mov    (%r14),%edi
+  801aa3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801aa7:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801aae:	00 00 00 
+  801ab1:	ff d0                	call   *%rax
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 35                	js     801aec <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ab7:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801abb:	83 e0 03             	and    $0x3,%eax
+  801abe:	83 f8 01             	cmp    $0x1,%eax
+  801ac1:	74 2d                	je     801af0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ac3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ac7:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801acb:	48 85 c0             	test   %rax,%rax
+  801ace:	74 56                	je     801b26 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ad0:	4c 89 ea             	mov    %r13,%rdx
+  801ad3:	4c 89 e6             	mov    %r12,%rsi
+  801ad6:	4c 89 f7             	mov    %r14,%rdi
+  801ad9:	ff d0                	call   *%rax
+}
+  801adb:	48 83 c4 10          	add    $0x10,%rsp
+  801adf:	5b                   	pop    %rbx
+  801ae0:	41 5c                	pop    %r12
+  801ae2:	41 5d                	pop    %r13
+  801ae4:	41 5e                	pop    %r14
+  801ae6:	5d                   	pop    %rbp
+  801ae7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ae8:	48 98                	cltq
+  801aea:	eb ef                	jmp    801adb <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801aec:	48 98                	cltq
+  801aee:	eb eb                	jmp    801adb <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801af0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801af7:	00 00 00 
+  801afa:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b00:	89 da                	mov    %ebx,%edx
+  801b02:	48 bf 89 4d 80 00 00 	movabs $0x804d89,%rdi
+  801b09:	00 00 00 
+  801b0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b11:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  801b18:	00 00 00 
+  801b1b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b1d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b24:	eb b5                	jmp    801adb <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b26:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b2d:	eb ac                	jmp    801adb <read+0x6a>
+
+0000000000801b2f <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b2f:	55                   	push   %rbp
+  801b30:	48 89 e5             	mov    %rsp,%rbp
+  801b33:	41 57                	push   %r15
+  801b35:	41 56                	push   %r14
+  801b37:	41 55                	push   %r13
+  801b39:	41 54                	push   %r12
+  801b3b:	53                   	push   %rbx
+  801b3c:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b40:	48 85 d2             	test   %rdx,%rdx
+  801b43:	74 54                	je     801b99 <readn+0x6a>
+  801b45:	41 89 fd             	mov    %edi,%r13d
+  801b48:	49 89 f6             	mov    %rsi,%r14
+  801b4b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b4e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b53:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b58:	49 bf 71 1a 80 00 00 	movabs $0x801a71,%r15
+  801b5f:	00 00 00 
+  801b62:	4c 89 e2             	mov    %r12,%rdx
+  801b65:	48 29 f2             	sub    %rsi,%rdx
+  801b68:	4c 01 f6             	add    %r14,%rsi
+  801b6b:	44 89 ef             	mov    %r13d,%edi
+  801b6e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b71:	85 c0                	test   %eax,%eax
+  801b73:	78 20                	js     801b95 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b75:	01 c3                	add    %eax,%ebx
+  801b77:	85 c0                	test   %eax,%eax
+  801b79:	74 08                	je     801b83 <readn+0x54>
+  801b7b:	48 63 f3             	movslq %ebx,%rsi
+  801b7e:	4c 39 e6             	cmp    %r12,%rsi
+  801b81:	72 df                	jb     801b62 <readn+0x33>
+    }
+    return res;
+  801b83:	48 63 c3             	movslq %ebx,%rax
+}
+  801b86:	48 83 c4 08          	add    $0x8,%rsp
+  801b8a:	5b                   	pop    %rbx
+  801b8b:	41 5c                	pop    %r12
+  801b8d:	41 5d                	pop    %r13
+  801b8f:	41 5e                	pop    %r14
+  801b91:	41 5f                	pop    %r15
+  801b93:	5d                   	pop    %rbp
+  801b94:	c3                   	ret
+        if (inc < 0) return inc;
+  801b95:	48 98                	cltq
+  801b97:	eb ed                	jmp    801b86 <readn+0x57>
+    int inc = 1, res = 0;
+  801b99:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b9e:	eb e3                	jmp    801b83 <readn+0x54>
+
+0000000000801ba0 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ba0:	55                   	push   %rbp
+  801ba1:	48 89 e5             	mov    %rsp,%rbp
+  801ba4:	41 56                	push   %r14
+  801ba6:	41 55                	push   %r13
+  801ba8:	41 54                	push   %r12
+  801baa:	53                   	push   %rbx
+  801bab:	48 83 ec 10          	sub    $0x10,%rsp
+  801baf:	89 fb                	mov    %edi,%ebx
+  801bb1:	49 89 f4             	mov    %rsi,%r12
+  801bb4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bb7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bbb:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801bc2:	00 00 00 
+  801bc5:	ff d0                	call   *%rax
+  801bc7:	85 c0                	test   %eax,%eax
+  801bc9:	78 47                	js     801c12 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bcb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bcf:	41 8b 3e             	mov    (%r14),%edi
+  801bd2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bd6:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	85 c0                	test   %eax,%eax
+  801be4:	78 30                	js     801c16 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801be6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801beb:	74 2d                	je     801c1a <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bed:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bf1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bf5:	48 85 c0             	test   %rax,%rax
+  801bf8:	74 56                	je     801c50 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bfa:	4c 89 ea             	mov    %r13,%rdx
+  801bfd:	4c 89 e6             	mov    %r12,%rsi
+  801c00:	4c 89 f7             	mov    %r14,%rdi
+  801c03:	ff d0                	call   *%rax
+}
+  801c05:	48 83 c4 10          	add    $0x10,%rsp
+  801c09:	5b                   	pop    %rbx
+  801c0a:	41 5c                	pop    %r12
+  801c0c:	41 5d                	pop    %r13
+  801c0e:	41 5e                	pop    %r14
+  801c10:	5d                   	pop    %rbp
+  801c11:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c12:	48 98                	cltq
+  801c14:	eb ef                	jmp    801c05 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c16:	48 98                	cltq
+  801c18:	eb eb                	jmp    801c05 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c1a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c21:	00 00 00 
+  801c24:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c2a:	89 da                	mov    %ebx,%edx
+  801c2c:	48 bf a5 4d 80 00 00 	movabs $0x804da5,%rdi
+  801c33:	00 00 00 
+  801c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c3b:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  801c42:	00 00 00 
+  801c45:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c47:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c4e:	eb b5                	jmp    801c05 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c50:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c57:	eb ac                	jmp    801c05 <write+0x65>
+
+0000000000801c59 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c59:	55                   	push   %rbp
+  801c5a:	48 89 e5             	mov    %rsp,%rbp
+  801c5d:	41 54                	push   %r12
+  801c5f:	53                   	push   %rbx
+  801c60:	48 83 ec 10          	sub    $0x10,%rsp
+  801c64:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c66:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c6a:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801c71:	00 00 00 
+  801c74:	ff d0                	call   *%rax
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	78 3e                	js     801cb8 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c7a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c7e:	41 8b 3c 24          	mov    (%r12),%edi
+  801c82:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c86:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801c8d:	00 00 00 
+  801c90:	ff d0                	call   *%rax
+  801c92:	85 c0                	test   %eax,%eax
+  801c94:	78 22                	js     801cb8 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c96:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c9a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c9e:	48 85 c0             	test   %rax,%rax
+  801ca1:	74 0b                	je     801cae <seek+0x55>
+  801ca3:	89 de                	mov    %ebx,%esi
+  801ca5:	4c 89 e7             	mov    %r12,%rdi
+  801ca8:	ff d0                	call   *%rax
+  801caa:	85 c0                	test   %eax,%eax
+  801cac:	78 0a                	js     801cb8 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801cae:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801cb3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cb8:	48 83 c4 10          	add    $0x10,%rsp
+  801cbc:	5b                   	pop    %rbx
+  801cbd:	41 5c                	pop    %r12
+  801cbf:	5d                   	pop    %rbp
+  801cc0:	c3                   	ret
+
+0000000000801cc1 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801cc1:	55                   	push   %rbp
+  801cc2:	48 89 e5             	mov    %rsp,%rbp
+  801cc5:	41 55                	push   %r13
+  801cc7:	41 54                	push   %r12
+  801cc9:	53                   	push   %rbx
+  801cca:	48 83 ec 18          	sub    $0x18,%rsp
+  801cce:	89 fb                	mov    %edi,%ebx
+  801cd0:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cd7:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801cde:	00 00 00 
+  801ce1:	ff d0                	call   *%rax
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	78 38                	js     801d1f <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ce7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ceb:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cf3:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	78 1c                	js     801d1f <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d03:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d08:	74 20                	je     801d2a <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d0e:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d12:	48 85 c0             	test   %rax,%rax
+  801d15:	74 47                	je     801d5e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d17:	44 89 e6             	mov    %r12d,%esi
+  801d1a:	4c 89 ef             	mov    %r13,%rdi
+  801d1d:	ff d0                	call   *%rax
+}
+  801d1f:	48 83 c4 18          	add    $0x18,%rsp
+  801d23:	5b                   	pop    %rbx
+  801d24:	41 5c                	pop    %r12
+  801d26:	41 5d                	pop    %r13
+  801d28:	5d                   	pop    %rbp
+  801d29:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d2a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d31:	00 00 00 
+  801d34:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d3a:	89 da                	mov    %ebx,%edx
+  801d3c:	48 bf 68 4d 80 00 00 	movabs $0x804d68,%rdi
+  801d43:	00 00 00 
+  801d46:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d4b:	48 b9 82 02 80 00 00 	movabs $0x800282,%rcx
+  801d52:	00 00 00 
+  801d55:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d57:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d5c:	eb c1                	jmp    801d1f <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d5e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d63:	eb ba                	jmp    801d1f <ftruncate+0x5e>
+
+0000000000801d65 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d65:	55                   	push   %rbp
+  801d66:	48 89 e5             	mov    %rsp,%rbp
+  801d69:	41 54                	push   %r12
+  801d6b:	53                   	push   %rbx
+  801d6c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d70:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d73:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d77:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  801d7e:	00 00 00 
+  801d81:	ff d0                	call   *%rax
+  801d83:	85 c0                	test   %eax,%eax
+  801d85:	78 4e                	js     801dd5 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d87:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d8b:	41 8b 3c 24          	mov    (%r12),%edi
+  801d8f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d93:	48 b8 d9 17 80 00 00 	movabs $0x8017d9,%rax
+  801d9a:	00 00 00 
+  801d9d:	ff d0                	call   *%rax
+  801d9f:	85 c0                	test   %eax,%eax
+  801da1:	78 32                	js     801dd5 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801da3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801da7:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801dac:	74 30                	je     801dde <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dae:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801db1:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801db8:	00 00 00 
+    stat->st_isdir = 0;
+  801dbb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801dc2:	00 00 00 
+    stat->st_dev = dev;
+  801dc5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dcc:	48 89 de             	mov    %rbx,%rsi
+  801dcf:	4c 89 e7             	mov    %r12,%rdi
+  801dd2:	ff 50 28             	call   *0x28(%rax)
+}
+  801dd5:	48 83 c4 10          	add    $0x10,%rsp
+  801dd9:	5b                   	pop    %rbx
+  801dda:	41 5c                	pop    %r12
+  801ddc:	5d                   	pop    %rbp
+  801ddd:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dde:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801de3:	eb f0                	jmp    801dd5 <fstat+0x70>
+
+0000000000801de5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801de5:	55                   	push   %rbp
+  801de6:	48 89 e5             	mov    %rsp,%rbp
+  801de9:	41 54                	push   %r12
+  801deb:	53                   	push   %rbx
+  801dec:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801def:	be 00 00 00 00       	mov    $0x0,%esi
+  801df4:	48 b8 53 2f 80 00 00 	movabs $0x802f53,%rax
+  801dfb:	00 00 00 
+  801dfe:	ff d0                	call   *%rax
+  801e00:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e02:	85 c0                	test   %eax,%eax
+  801e04:	78 25                	js     801e2b <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e06:	4c 89 e6             	mov    %r12,%rsi
+  801e09:	89 c7                	mov    %eax,%edi
+  801e0b:	48 b8 65 1d 80 00 00 	movabs $0x801d65,%rax
+  801e12:	00 00 00 
+  801e15:	ff d0                	call   *%rax
+  801e17:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e1a:	89 df                	mov    %ebx,%edi
+  801e1c:	48 b8 f3 18 80 00 00 	movabs $0x8018f3,%rax
+  801e23:	00 00 00 
+  801e26:	ff d0                	call   *%rax
+
+    return res;
+  801e28:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e2b:	89 d8                	mov    %ebx,%eax
+  801e2d:	5b                   	pop    %rbx
+  801e2e:	41 5c                	pop    %r12
+  801e30:	5d                   	pop    %rbp
+  801e31:	c3                   	ret
+
+0000000000801e32 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e32:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e39:	00 00 00 
+  801e3c:	83 38 00             	cmpl   $0x0,(%rax)
+  801e3f:	74 0a                	je     801e4b <fsenv+0x19>
+    return envid;
+}
+  801e41:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e48:	00 00 
+  801e4a:	c3                   	ret
+fsenv(void) {
+  801e4b:	55                   	push   %rbp
+  801e4c:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e4f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e54:	48 b8 a1 16 80 00 00 	movabs $0x8016a1,%rax
+  801e5b:	00 00 00 
+  801e5e:	ff d0                	call   *%rax
+  801e60:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e67:	00 00 
+}
+  801e69:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e70:	00 00 
+  801e72:	5d                   	pop    %rbp
+  801e73:	c3                   	ret
+
+0000000000801e74 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e74:	55                   	push   %rbp
+  801e75:	48 89 e5             	mov    %rsp,%rbp
+  801e78:	41 54                	push   %r12
+  801e7a:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e7b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e80:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e85:	48 89 de             	mov    %rbx,%rsi
+  801e88:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8d:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  801e94:	00 00 00 
+  801e97:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e99:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ea0:	00 00 00 
+  801ea3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ea9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801eae:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801eb3:	48 89 de             	mov    %rbx,%rsi
+  801eb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebb:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  801ec7:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	0f 88 a2 00 00 00    	js     801f73 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801ed1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ed8:	00 00 00 
+  801edb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ee1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ee6:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801ee8:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801eed:	49 bc 85 40 80 00 00 	movabs $0x804085,%r12
+  801ef4:	00 00 00 
+  801ef7:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801efa:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801eff:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f02:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  801f09:	00 00 00 
+  801f0c:	ff d0                	call   *%rax
+  801f0e:	89 c7                	mov    %eax,%edi
+  801f10:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801f16:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801f1b:	48 89 da             	mov    %rbx,%rdx
+  801f1e:	be 09 00 00 00       	mov    $0x9,%esi
+  801f23:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  801f2a:	00 00 00 
+  801f2d:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801f2f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f39:	be 00 00 00 00       	mov    $0x0,%esi
+  801f3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f43:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+  801f4f:	89 c3                	mov    %eax,%ebx
+  801f51:	85 c0                	test   %eax,%eax
+  801f53:	78 25                	js     801f7a <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801f55:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f5c:	00 00 00 
+  801f5f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f65:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f6c:	00 00 
+    return 0;
+  801f6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f73:	89 d8                	mov    %ebx,%eax
+  801f75:	5b                   	pop    %rbx
+  801f76:	41 5c                	pop    %r12
+  801f78:	5d                   	pop    %rbp
+  801f79:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f7a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f7f:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f84:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f89:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  801f90:	00 00 00 
+  801f93:	ff d0                	call   *%rax
+        return res;
+  801f95:	eb dc                	jmp    801f73 <fschan_setup+0xff>
+
+0000000000801f97 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f97:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f9e:	00 00 00 
+  801fa1:	80 38 00             	cmpb   $0x0,(%rax)
+  801fa4:	74 55                	je     801ffb <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fa6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fad:	00 00 00 
+  801fb0:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801fb6:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fbb:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801fc2:	00 00 00 
+  801fc5:	3b 0a                	cmp    (%rdx),%ecx
+  801fc7:	75 01                	jne    801fca <fschan+0x33>
+}
+  801fc9:	c3                   	ret
+fschan(void) {
+  801fca:	55                   	push   %rbp
+  801fcb:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fce:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+  801fda:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801fdc:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fe1:	85 d2                	test   %edx,%edx
+  801fe3:	78 02                	js     801fe7 <fschan+0x50>
+}
+  801fe5:	5d                   	pop    %rbp
+  801fe6:	c3                   	ret
+        fschan_enabled = 0;
+  801fe7:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fee:	00 00 00 
+  801ff1:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ff9:	eb ea                	jmp    801fe5 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801ffb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802000:	c3                   	ret
+
+0000000000802001 <fbuf>:
+fbuf(struct Fd *fd) {
+  802001:	55                   	push   %rbp
+  802002:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802005:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802011:	ba 00 00 00 00       	mov    $0x0,%edx
+  802016:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80201a:	77 12                	ja     80202e <fbuf+0x2d>
+  80201c:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802020:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802027:	00 00 00 
+  80202a:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80202e:	48 89 d0             	mov    %rdx,%rax
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+
+0000000000802033 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802037:	48 83 c7 40          	add    $0x40,%rdi
+  80203b:	48 b8 bf 40 80 00 00 	movabs $0x8040bf,%rax
+  802042:	00 00 00 
+  802045:	ff d0                	call   *%rax
+  802047:	84 c0                	test   %al,%al
+  802049:	75 02                	jne    80204d <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80204b:	5d                   	pop    %rbp
+  80204c:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80204d:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802054:	00 00 00 
+  802057:	ff d0                	call   *%rax
+  802059:	89 c7                	mov    %eax,%edi
+  80205b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802061:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802070:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802077:	00 00 00 
+  80207a:	ff d0                	call   *%rax
+}
+  80207c:	eb cd                	jmp    80204b <fschan_publish+0x18>
+
+000000000080207e <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80207e:	55                   	push   %rbp
+  80207f:	48 89 e5             	mov    %rsp,%rbp
+  802082:	41 57                	push   %r15
+  802084:	41 56                	push   %r14
+  802086:	41 55                	push   %r13
+  802088:	41 54                	push   %r12
+  80208a:	53                   	push   %rbx
+  80208b:	48 83 ec 48          	sub    $0x48,%rsp
+  80208f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802093:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802097:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80209a:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80209e:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8020a1:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8020a8:	00 00 00 
+  8020ab:	8b 02                	mov    (%rdx),%eax
+  8020ad:	83 c0 01             	add    $0x1,%eax
+  8020b0:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020b5:	0f 44 c1             	cmove  %ecx,%eax
+  8020b8:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8020ba:	4d 85 c0             	test   %r8,%r8
+  8020bd:	74 2c                	je     8020eb <fschan_rw+0x6d>
+  8020bf:	45 89 ce             	mov    %r9d,%r14d
+  8020c2:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8020c9:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8020cd:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8020d3:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8020da:	00 
+  8020db:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020e1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020e6:	e9 41 01 00 00       	jmp    80222c <fschan_rw+0x1ae>
+  8020eb:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8020ef:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020f3:	e9 9c 01 00 00       	jmp    802294 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8020f8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8020fc:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8020ff:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802102:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802105:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802109:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80210d:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802111:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802115:	48 89 da             	mov    %rbx,%rdx
+  802118:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  80211f:	00 00 00 
+  802122:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802124:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802128:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+            queued += blk;
+  802134:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802137:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80213b:	4d 39 fc             	cmp    %r15,%r12
+  80213e:	73 6b                	jae    8021ab <fschan_rw+0x12d>
+  802140:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802144:	77 65                	ja     8021ab <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802146:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80214a:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80214e:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  802155:	00 00 00 
+  802158:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80215a:	4c 89 fb             	mov    %r15,%rbx
+  80215d:	4c 29 e3             	sub    %r12,%rbx
+  802160:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802165:	48 39 d3             	cmp    %rdx,%rbx
+  802168:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80216c:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802170:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802174:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802178:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80217b:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80217d:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802184:	00 00 00 
+  802187:	8b 09                	mov    (%rcx),%ecx
+  802189:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80218c:	83 fe 03             	cmp    $0x3,%esi
+  80218f:	0f 85 63 ff ff ff    	jne    8020f8 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802195:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802199:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80219c:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80219f:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8021a2:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8021a6:	e9 79 ff ff ff       	jmp    802124 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8021ab:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021af:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8021b6:	48 89 df             	mov    %rbx,%rdi
+  8021b9:	48 b8 5d 41 80 00 00 	movabs $0x80415d,%rax
+  8021c0:	00 00 00 
+  8021c3:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8021c5:	48 89 df             	mov    %rbx,%rdi
+  8021c8:	48 b8 eb 40 80 00 00 	movabs $0x8040eb,%rax
+  8021cf:	00 00 00 
+  8021d2:	ff d0                	call   *%rax
+  8021d4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8021d8:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8021dc:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8021e0:	75 25                	jne    802207 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8021e2:	8b 40 04             	mov    0x4(%rax),%eax
+  8021e5:	85 c0                	test   %eax,%eax
+  8021e7:	0f 88 86 00 00 00    	js     802273 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021ed:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8021f1:	74 5b                	je     80224e <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8021f3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021f7:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8021fb:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8021ff:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802203:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802207:	48 89 df             	mov    %rbx,%rdi
+  80220a:	48 b8 12 41 80 00 00 	movabs $0x804112,%rax
+  802211:	00 00 00 
+  802214:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802216:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80221a:	83 f0 01             	xor    $0x1,%eax
+  80221d:	4d 39 fc             	cmp    %r15,%r12
+  802220:	0f 92 c2             	setb   %dl
+  802223:	84 c2                	test   %al,%dl
+  802225:	75 05                	jne    80222c <fschan_rw+0x1ae>
+  802227:	45 85 ed             	test   %r13d,%r13d
+  80222a:	74 50                	je     80227c <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80222c:	4d 39 fc             	cmp    %r15,%r12
+  80222f:	0f 92 c1             	setb   %cl
+  802232:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802236:	0f 96 c2             	setbe  %dl
+  802239:	84 d1                	test   %dl,%cl
+  80223b:	0f 84 6a ff ff ff    	je     8021ab <fschan_rw+0x12d>
+  802241:	84 c0                	test   %al,%al
+  802243:	0f 85 fd fe ff ff    	jne    802146 <fschan_rw+0xc8>
+  802249:	e9 5d ff ff ff       	jmp    8021ab <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80224e:	48 63 d0             	movslq %eax,%rdx
+  802251:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802255:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802259:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80225d:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802261:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802265:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+  802271:	eb 80                	jmp    8021f3 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802273:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802276:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80227a:	eb 8b                	jmp    802207 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80227c:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802281:	0f 85 68 fe ff ff    	jne    8020ef <fschan_rw+0x71>
+  802287:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80228a:	85 c0                	test   %eax,%eax
+  80228c:	0f 84 5d fe ff ff    	je     8020ef <fschan_rw+0x71>
+  802292:	48 98                	cltq
+}
+  802294:	48 83 c4 48          	add    $0x48,%rsp
+  802298:	5b                   	pop    %rbx
+  802299:	41 5c                	pop    %r12
+  80229b:	41 5d                	pop    %r13
+  80229d:	41 5e                	pop    %r14
+  80229f:	41 5f                	pop    %r15
+  8022a1:	5d                   	pop    %rbp
+  8022a2:	c3                   	ret
+
+00000000008022a3 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8022a3:	55                   	push   %rbp
+  8022a4:	48 89 e5             	mov    %rsp,%rbp
+  8022a7:	41 56                	push   %r14
+  8022a9:	41 55                	push   %r13
+  8022ab:	41 54                	push   %r12
+  8022ad:	53                   	push   %rbx
+  8022ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8022b2:	49 89 fe             	mov    %rdi,%r14
+  8022b5:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8022b8:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8022bc:	48 29 f3             	sub    %rsi,%rbx
+  8022bf:	48 39 d3             	cmp    %rdx,%rbx
+  8022c2:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8022c6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022cd:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8022ce:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8022d3:	49 bd 1c 3f 80 00 00 	movabs $0x803f1c,%r13
+  8022da:	00 00 00 
+  8022dd:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8022e4:	76 1e                	jbe    802304 <mmap_fault+0x61>
+  8022e6:	4c 01 e7             	add    %r12,%rdi
+  8022e9:	41 ff d5             	call   *%r13
+  8022ec:	84 c0                	test   %al,%al
+  8022ee:	75 14                	jne    802304 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8022f0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022f4:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8022fb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8022ff:	48 39 df             	cmp    %rbx,%rdi
+  802302:	72 e2                	jb     8022e6 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802304:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80230b:	00 00 00 
+  80230e:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802315:	00 00 00 
+  802318:	4c 89 f0             	mov    %r14,%rax
+  80231b:	48 29 d0             	sub    %rdx,%rax
+  80231e:	48 c1 f8 03          	sar    $0x3,%rax
+  802322:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802329:	aa aa aa 
+  80232c:	48 0f af c2          	imul   %rdx,%rax
+  802330:	48 c1 e0 0c          	shl    $0xc,%rax
+  802334:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802339:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80233d:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80233f:	44 89 e0             	mov    %r12d,%eax
+  802342:	41 03 46 10          	add    0x10(%r14),%eax
+  802346:	41 2b 06             	sub    (%r14),%eax
+  802349:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80234c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802350:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802354:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802358:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80235b:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+  802367:	89 c7                	mov    %eax,%edi
+  802369:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80236f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802374:	48 89 da             	mov    %rbx,%rdx
+  802377:	be 0f 00 00 00       	mov    $0xf,%esi
+  80237c:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802383:	00 00 00 
+  802386:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802388:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80238d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802391:	4c 89 e6             	mov    %r12,%rsi
+  802394:	bf 00 00 00 00       	mov    $0x0,%edi
+  802399:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  8023a0:	00 00 00 
+  8023a3:	ff d0                	call   *%rax
+  8023a5:	48 98                	cltq
+}
+  8023a7:	48 83 c4 10          	add    $0x10,%rsp
+  8023ab:	5b                   	pop    %rbx
+  8023ac:	41 5c                	pop    %r12
+  8023ae:	41 5d                	pop    %r13
+  8023b0:	41 5e                	pop    %r14
+  8023b2:	5d                   	pop    %rbp
+  8023b3:	c3                   	ret
+
+00000000008023b4 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8023b4:	48 8b 37             	mov    (%rdi),%rsi
+  8023b7:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8023be:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023c5:	00 00 00 
+  8023c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023cd:	eb 0f                	jmp    8023de <mmap_pgfault+0x2a>
+  8023cf:	c3                   	ret
+  8023d0:	48 83 c1 01          	add    $0x1,%rcx
+  8023d4:	48 83 c2 18          	add    $0x18,%rdx
+  8023d8:	48 83 f9 20          	cmp    $0x20,%rcx
+  8023dc:	74 6e                	je     80244c <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023de:	48 8b 02             	mov    (%rdx),%rax
+  8023e1:	48 83 e8 01          	sub    $0x1,%rax
+  8023e5:	48 39 f0             	cmp    %rsi,%rax
+  8023e8:	73 e6                	jae    8023d0 <mmap_pgfault+0x1c>
+  8023ea:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8023ee:	73 e0                	jae    8023d0 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023f0:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8023f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f9:	f6 c2 01             	test   $0x1,%dl
+  8023fc:	75 d1                	jne    8023cf <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8023fe:	f6 c2 02             	test   $0x2,%dl
+  802401:	74 1a                	je     80241d <mmap_pgfault+0x69>
+  802403:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802407:	b8 00 00 00 00       	mov    $0x0,%eax
+  80240c:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802413:	00 00 00 
+  802416:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80241b:	74 35                	je     802452 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80241d:	55                   	push   %rbp
+  80241e:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802421:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802425:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80242c:	00 00 00 
+  80242f:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802433:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802438:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  80243f:	00 00 00 
+  802442:	ff d0                	call   *%rax
+  802444:	48 85 c0             	test   %rax,%rax
+  802447:	0f 9f c0             	setg   %al
+}
+  80244a:	5d                   	pop    %rbp
+  80244b:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80244c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802451:	c3                   	ret
+}
+  802452:	c3                   	ret
+
+0000000000802453 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802453:	55                   	push   %rbp
+  802454:	48 89 e5             	mov    %rsp,%rbp
+  802457:	41 54                	push   %r12
+  802459:	53                   	push   %rbx
+  80245a:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80245d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802464:	00 00 00 
+  802467:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80246c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802470:	74 15                	je     802487 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802472:	48 83 c3 01          	add    $0x1,%rbx
+  802476:	48 83 c0 18          	add    $0x18,%rax
+  80247a:	48 83 fb 20          	cmp    $0x20,%rbx
+  80247e:	75 ec                	jne    80246c <mmap_alloc+0x19>
+    return NULL;
+  802480:	b8 00 00 00 00       	mov    $0x0,%eax
+  802485:	eb 52                	jmp    8024d9 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802487:	4c 89 e7             	mov    %r12,%rdi
+  80248a:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  802491:	00 00 00 
+  802494:	ff d0                	call   *%rax
+  802496:	41 89 c1             	mov    %eax,%r9d
+  802499:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8024a0:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024a4:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024af:	4c 89 e6             	mov    %r12,%rsi
+  8024b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024b7:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8024be:	00 00 00 
+  8024c1:	ff d0                	call   *%rax
+  8024c3:	85 c0                	test   %eax,%eax
+  8024c5:	78 17                	js     8024de <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8024c7:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8024cb:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024d2:	00 00 00 
+  8024d5:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8024d9:	5b                   	pop    %rbx
+  8024da:	41 5c                	pop    %r12
+  8024dc:	5d                   	pop    %rbp
+  8024dd:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024e3:	eb f4                	jmp    8024d9 <mmap_alloc+0x86>
+
+00000000008024e5 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8024e5:	55                   	push   %rbp
+  8024e6:	48 89 e5             	mov    %rsp,%rbp
+  8024e9:	41 56                	push   %r14
+  8024eb:	41 55                	push   %r13
+  8024ed:	41 54                	push   %r12
+  8024ef:	53                   	push   %rbx
+  8024f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8024f4:	41 89 fc             	mov    %edi,%r12d
+  8024f7:	49 89 f5             	mov    %rsi,%r13
+  8024fa:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024fd:	48 89 f0             	mov    %rsi,%rax
+  802500:	48 09 d0             	or     %rdx,%rax
+  802503:	75 0d                	jne    802512 <fsipc+0x2d>
+  802505:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802508:	83 f8 04             	cmp    $0x4,%eax
+  80250b:	76 7d                	jbe    80258a <fsipc+0xa5>
+  80250d:	83 ff 0d             	cmp    $0xd,%edi
+  802510:	74 78                	je     80258a <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802512:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+  80251e:	89 c7                	mov    %eax,%edi
+  802520:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802527:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80252e:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802535:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80253b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802542:	00 00 00 
+  802545:	44 89 e6             	mov    %r12d,%esi
+  802548:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  80254f:	00 00 00 
+  802552:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802554:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80255b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80255c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802561:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802565:	4c 89 ee             	mov    %r13,%rsi
+  802568:	bf 00 00 00 00       	mov    $0x0,%edi
+  80256d:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  802574:	00 00 00 
+  802577:	ff d0                	call   *%rax
+  802579:	89 c3                	mov    %eax,%ebx
+}
+  80257b:	89 d8                	mov    %ebx,%eax
+  80257d:	48 83 c4 10          	add    $0x10,%rsp
+  802581:	5b                   	pop    %rbx
+  802582:	41 5c                	pop    %r12
+  802584:	41 5d                	pop    %r13
+  802586:	41 5e                	pop    %r14
+  802588:	5d                   	pop    %rbp
+  802589:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80258a:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802591:	00 00 00 
+  802594:	ff d0                	call   *%rax
+  802596:	49 89 c6             	mov    %rax,%r14
+  802599:	48 85 c0             	test   %rax,%rax
+  80259c:	0f 84 70 ff ff ff    	je     802512 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025a2:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025a6:	48 b8 9a 40 80 00 00 	movabs $0x80409a,%rax
+  8025ad:	00 00 00 
+  8025b0:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8025b2:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8025b5:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8025bc:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8025c0:	ba 10 00 00 00       	mov    $0x10,%edx
+  8025c5:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8025cc:	00 00 00 
+  8025cf:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  8025d6:	00 00 00 
+  8025d9:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8025db:	4c 89 f7             	mov    %r14,%rdi
+  8025de:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  8025e5:	00 00 00 
+  8025e8:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8025ea:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8025f1:	4c 89 f7             	mov    %r14,%rdi
+  8025f4:	48 b8 5d 41 80 00 00 	movabs $0x80415d,%rax
+  8025fb:	00 00 00 
+  8025fe:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802600:	4c 89 f7             	mov    %r14,%rdi
+  802603:	48 b8 eb 40 80 00 00 	movabs $0x8040eb,%rax
+  80260a:	00 00 00 
+  80260d:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80260f:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802612:	41 83 fc 05          	cmp    $0x5,%r12d
+  802616:	75 04                	jne    80261c <fsipc+0x137>
+  802618:	85 db                	test   %ebx,%ebx
+  80261a:	79 14                	jns    802630 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80261c:	4c 89 f7             	mov    %r14,%rdi
+  80261f:	48 b8 12 41 80 00 00 	movabs $0x804112,%rax
+  802626:	00 00 00 
+  802629:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80262b:	e9 4b ff ff ff       	jmp    80257b <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802630:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802634:	ba 88 00 00 00       	mov    $0x88,%edx
+  802639:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802640:	00 00 00 
+  802643:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  80264a:	00 00 00 
+  80264d:	ff d0                	call   *%rax
+  80264f:	eb cb                	jmp    80261c <fsipc+0x137>
+
+0000000000802651 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802651:	55                   	push   %rbp
+  802652:	48 89 e5             	mov    %rsp,%rbp
+  802655:	41 57                	push   %r15
+  802657:	41 56                	push   %r14
+  802659:	41 55                	push   %r13
+  80265b:	41 54                	push   %r12
+  80265d:	53                   	push   %rbx
+  80265e:	48 83 ec 18          	sub    $0x18,%rsp
+  802662:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802666:	49 89 f6             	mov    %rsi,%r14
+  802669:	49 89 d4             	mov    %rdx,%r12
+  80266c:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80266f:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802676:	00 00 00 
+  802679:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80267b:	48 85 c0             	test   %rax,%rax
+  80267e:	0f 85 96 00 00 00    	jne    80271a <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802684:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80268b:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80268c:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802693:	00 00 00 
+    while (n) {
+  802696:	4d 85 e4             	test   %r12,%r12
+  802699:	74 79                	je     802714 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80269b:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8026a0:	49 39 dc             	cmp    %rbx,%r12
+  8026a3:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8026a7:	48 89 da             	mov    %rbx,%rdx
+  8026aa:	4c 89 f6             	mov    %r14,%rsi
+  8026ad:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8026b4:	00 00 00 
+  8026b7:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026c3:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026c7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8026ca:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8026cd:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8026d0:	44 01 e8             	add    %r13d,%eax
+  8026d3:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8026d7:	41 0f 44 c5          	cmove  %r13d,%eax
+  8026db:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8026df:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8026e3:	48 89 da             	mov    %rbx,%rdx
+  8026e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8026eb:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026f0:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  8026f7:	00 00 00 
+  8026fa:	ff d0                	call   *%rax
+        if (res < 0)
+  8026fc:	85 c0                	test   %eax,%eax
+  8026fe:	78 4a                	js     80274a <devfile_write_direct+0xf9>
+        buf += res;
+  802700:	48 98                	cltq
+  802702:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802705:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802709:	49 29 c4             	sub    %rax,%r12
+  80270c:	75 8d                	jne    80269b <devfile_write_direct+0x4a>
+    return write;
+  80270e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802712:	eb 27                	jmp    80273b <devfile_write_direct+0xea>
+    size_t write = 0;
+  802714:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802718:	eb f4                	jmp    80270e <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80271a:	45 89 e9             	mov    %r13d,%r9d
+  80271d:	4d 89 e0             	mov    %r12,%r8
+  802720:	4c 89 f1             	mov    %r14,%rcx
+  802723:	ba 04 00 00 00       	mov    $0x4,%edx
+  802728:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80272c:	48 89 c7             	mov    %rax,%rdi
+  80272f:	48 b8 7e 20 80 00 00 	movabs $0x80207e,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+}
+  80273b:	48 83 c4 18          	add    $0x18,%rsp
+  80273f:	5b                   	pop    %rbx
+  802740:	41 5c                	pop    %r12
+  802742:	41 5d                	pop    %r13
+  802744:	41 5e                	pop    %r14
+  802746:	41 5f                	pop    %r15
+  802748:	5d                   	pop    %rbp
+  802749:	c3                   	ret
+            return res;
+  80274a:	48 98                	cltq
+  80274c:	eb ed                	jmp    80273b <devfile_write_direct+0xea>
+
+000000000080274e <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80274e:	55                   	push   %rbp
+  80274f:	48 89 e5             	mov    %rsp,%rbp
+  802752:	41 54                	push   %r12
+  802754:	53                   	push   %rbx
+  802755:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802758:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  80275f:	00 00 00 
+  802762:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802764:	48 85 c0             	test   %rax,%rax
+  802767:	74 71                	je     8027da <fbuf_flush+0x8c>
+  802769:	48 89 c3             	mov    %rax,%rbx
+  80276c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802771:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802775:	75 05                	jne    80277c <fbuf_flush+0x2e>
+}
+  802777:	5b                   	pop    %rbx
+  802778:	41 5c                	pop    %r12
+  80277a:	5d                   	pop    %rbp
+  80277b:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80277c:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80277f:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802783:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80278a:	00 00 00 
+  80278d:	48 89 de             	mov    %rbx,%rsi
+  802790:	48 29 c6             	sub    %rax,%rsi
+  802793:	48 c1 fe 03          	sar    $0x3,%rsi
+  802797:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80279e:	aa aa aa 
+  8027a1:	48 0f af f0          	imul   %rax,%rsi
+  8027a5:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8027a9:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027ae:	48 01 c6             	add    %rax,%rsi
+  8027b1:	4c 89 e7             	mov    %r12,%rdi
+  8027b4:	48 b8 51 26 80 00 00 	movabs $0x802651,%rax
+  8027bb:	00 00 00 
+  8027be:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8027c0:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8027c4:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8027cb:	00 
+    return res < 0 ? res : 0;
+  8027cc:	48 85 c0             	test   %rax,%rax
+  8027cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d4:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8027d8:	eb 9d                	jmp    802777 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8027da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027df:	eb 96                	jmp    802777 <fbuf_flush+0x29>
+
+00000000008027e1 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8027e1:	55                   	push   %rbp
+  8027e2:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8027e5:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  8027ec:	00 00 00 
+  8027ef:	ff d0                	call   *%rax
+}
+  8027f1:	5d                   	pop    %rbp
+  8027f2:	c3                   	ret
+
+00000000008027f3 <devfile_write>:
+    if (!fd || !buf)
+  8027f3:	48 85 ff             	test   %rdi,%rdi
+  8027f6:	0f 84 d3 01 00 00    	je     8029cf <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8027fc:	55                   	push   %rbp
+  8027fd:	48 89 e5             	mov    %rsp,%rbp
+  802800:	41 57                	push   %r15
+  802802:	41 56                	push   %r14
+  802804:	41 55                	push   %r13
+  802806:	41 54                	push   %r12
+  802808:	53                   	push   %rbx
+  802809:	48 83 ec 08          	sub    $0x8,%rsp
+  80280d:	49 89 fc             	mov    %rdi,%r12
+  802810:	49 89 f6             	mov    %rsi,%r14
+  802813:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802816:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80281b:	48 85 f6             	test   %rsi,%rsi
+  80281e:	0f 84 9c 01 00 00    	je     8029c0 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802824:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  80282b:	00 00 00 
+  80282e:	ff d0                	call   *%rax
+  802830:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802833:	48 85 c0             	test   %rax,%rax
+  802836:	0f 84 a2 00 00 00    	je     8028de <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80283c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802841:	4c 89 e7             	mov    %r12,%rdi
+  802844:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  80284b:	00 00 00 
+  80284e:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802850:	83 f8 02             	cmp    $0x2,%eax
+  802853:	0f 8f 85 00 00 00    	jg     8028de <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802859:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802860:	00 00 00 
+  802863:	4d 89 ef             	mov    %r13,%r15
+  802866:	49 29 c7             	sub    %rax,%r15
+  802869:	49 c1 ff 03          	sar    $0x3,%r15
+  80286d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802874:	aa aa aa 
+  802877:	4c 0f af f8          	imul   %rax,%r15
+  80287b:	49 c1 e7 0e          	shl    $0xe,%r15
+  80287f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802884:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802887:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80288c:	0f 84 d7 00 00 00    	je     802969 <devfile_write+0x176>
+  802892:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802896:	89 c2                	mov    %eax,%edx
+  802898:	41 03 55 0c          	add    0xc(%r13),%edx
+  80289c:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8028a1:	75 0f                	jne    8028b2 <devfile_write+0xbf>
+  8028a3:	48 01 d8             	add    %rbx,%rax
+  8028a6:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8028ac:	0f 86 92 00 00 00    	jbe    802944 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028b2:	4c 89 e7             	mov    %r12,%rdi
+  8028b5:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  8028bc:	00 00 00 
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	85 c0                	test   %eax,%eax
+  8028c3:	78 52                	js     802917 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028c5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028cc:	77 7f                	ja     80294d <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8028ce:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028d3:	0f 85 c2 00 00 00    	jne    80299b <devfile_write+0x1a8>
+  8028d9:	e9 94 00 00 00       	jmp    802972 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8028de:	4c 89 e7             	mov    %r12,%rdi
+  8028e1:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028ed:	85 c0                	test   %eax,%eax
+  8028ef:	79 07                	jns    8028f8 <devfile_write+0x105>
+  8028f1:	48 98                	cltq
+  8028f3:	e9 c8 00 00 00       	jmp    8029c0 <devfile_write+0x1cd>
+  8028f8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028fd:	48 89 da             	mov    %rbx,%rdx
+  802900:	4c 89 f6             	mov    %r14,%rsi
+  802903:	4c 89 e7             	mov    %r12,%rdi
+  802906:	48 b8 51 26 80 00 00 	movabs $0x802651,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+  802912:	e9 a9 00 00 00       	jmp    8029c0 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802917:	48 98                	cltq
+  802919:	e9 a2 00 00 00       	jmp    8029c0 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80291e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802923:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802928:	4c 89 fe             	mov    %r15,%rsi
+  80292b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802930:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  802937:	00 00 00 
+  80293a:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	79 45                	jns    802985 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802940:	48 98                	cltq
+  802942:	eb 7c                	jmp    8029c0 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802944:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80294b:	76 4e                	jbe    80299b <devfile_write+0x1a8>
+  80294d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802952:	48 89 da             	mov    %rbx,%rdx
+  802955:	4c 89 f6             	mov    %r14,%rsi
+  802958:	4c 89 e7             	mov    %r12,%rdi
+  80295b:	48 b8 51 26 80 00 00 	movabs $0x802651,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	eb 57                	jmp    8029c0 <devfile_write+0x1cd>
+  802969:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802970:	77 db                	ja     80294d <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802972:	4c 89 ff             	mov    %r15,%rdi
+  802975:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  80297c:	00 00 00 
+  80297f:	ff d0                	call   *%rax
+  802981:	84 c0                	test   %al,%al
+  802983:	74 99                	je     80291e <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802985:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80298a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80298f:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802993:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80299a:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80299b:	4c 89 ff             	mov    %r15,%rdi
+  80299e:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8029a2:	48 89 da             	mov    %rbx,%rdx
+  8029a5:	4c 89 f6             	mov    %r14,%rsi
+  8029a8:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8029b4:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8029b8:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8029bd:	48 89 d8             	mov    %rbx,%rax
+}
+  8029c0:	48 83 c4 08          	add    $0x8,%rsp
+  8029c4:	5b                   	pop    %rbx
+  8029c5:	41 5c                	pop    %r12
+  8029c7:	41 5d                	pop    %r13
+  8029c9:	41 5e                	pop    %r14
+  8029cb:	41 5f                	pop    %r15
+  8029cd:	5d                   	pop    %rbp
+  8029ce:	c3                   	ret
+        return E_INVAL;
+  8029cf:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029d4:	c3                   	ret
+
+00000000008029d5 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 54                	push   %r12
+  8029db:	53                   	push   %rbx
+  8029dc:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8029df:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  8029e6:	00 00 00 
+  8029e9:	ff d0                	call   *%rax
+  8029eb:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8029ee:	48 89 df             	mov    %rbx,%rdi
+  8029f1:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	48 85 c0             	test   %rax,%rax
+  802a00:	74 17                	je     802a19 <devfile_flush+0x44>
+  802a02:	48 89 df             	mov    %rbx,%rdi
+  802a05:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  802a0c:	00 00 00 
+  802a0f:	ff d0                	call   *%rax
+  802a11:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802a18:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a19:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a1c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802a23:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2a:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2f:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a34:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a40:	45 85 e4             	test   %r12d,%r12d
+  802a43:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a47:	5b                   	pop    %rbx
+  802a48:	41 5c                	pop    %r12
+  802a4a:	5d                   	pop    %rbp
+  802a4b:	c3                   	ret
+
+0000000000802a4c <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a4c:	55                   	push   %rbp
+  802a4d:	48 89 e5             	mov    %rsp,%rbp
+  802a50:	41 57                	push   %r15
+  802a52:	41 56                	push   %r14
+  802a54:	41 55                	push   %r13
+  802a56:	41 54                	push   %r12
+  802a58:	53                   	push   %rbx
+  802a59:	48 83 ec 38          	sub    $0x38,%rsp
+  802a5d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a61:	49 89 f7             	mov    %rsi,%r15
+  802a64:	48 89 d3             	mov    %rdx,%rbx
+  802a67:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a6a:	48 b8 97 1f 80 00 00 	movabs $0x801f97,%rax
+  802a71:	00 00 00 
+  802a74:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a76:	48 85 c0             	test   %rax,%rax
+  802a79:	75 20                	jne    802a9b <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a7b:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a80:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a87:	00 
+    while (n) {
+  802a88:	48 85 db             	test   %rbx,%rbx
+  802a8b:	0f 85 df 00 00 00    	jne    802b70 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a91:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a95:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a99:	eb 21                	jmp    802abc <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a9b:	45 89 f1             	mov    %r14d,%r9d
+  802a9e:	49 89 d8             	mov    %rbx,%r8
+  802aa1:	4c 89 f9             	mov    %r15,%rcx
+  802aa4:	ba 03 00 00 00       	mov    $0x3,%edx
+  802aa9:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802aad:	48 89 c7             	mov    %rax,%rdi
+  802ab0:	48 b8 7e 20 80 00 00 	movabs $0x80207e,%rax
+  802ab7:	00 00 00 
+  802aba:	ff d0                	call   *%rax
+}
+  802abc:	48 83 c4 38          	add    $0x38,%rsp
+  802ac0:	5b                   	pop    %rbx
+  802ac1:	41 5c                	pop    %r12
+  802ac3:	41 5d                	pop    %r13
+  802ac5:	41 5e                	pop    %r14
+  802ac7:	41 5f                	pop    %r15
+  802ac9:	5d                   	pop    %rbp
+  802aca:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802acb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802acf:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ad5:	75 1e                	jne    802af5 <devfile_read_direct+0xa9>
+  802ad7:	e9 e2 00 00 00       	jmp    802bbe <devfile_read_direct+0x172>
+            if (!res) return read;
+  802adc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ae0:	eb da                	jmp    802abc <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802ae2:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802ae6:	0f 85 d0 01 00 00    	jne    802cbc <devfile_read_direct+0x270>
+            map = 0;
+  802aec:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802af0:	eb 03                	jmp    802af5 <devfile_read_direct+0xa9>
+  802af2:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802af5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802afa:	48 39 d3             	cmp    %rdx,%rbx
+  802afd:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b01:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b05:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b08:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802b0f:	00 00 00 
+  802b12:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802b14:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802b18:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802b1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802b21:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b26:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+        if (res <= 0)
+  802b32:	85 c0                	test   %eax,%eax
+  802b34:	0f 8e 63 01 00 00    	jle    802c9d <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b3a:	4c 63 e0             	movslq %eax,%r12
+  802b3d:	4c 89 e2             	mov    %r12,%rdx
+  802b40:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b47:	00 00 00 
+  802b4a:	4c 89 ff             	mov    %r15,%rdi
+  802b4d:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  802b54:	00 00 00 
+  802b57:	ff d0                	call   *%rax
+        buf += res;
+  802b59:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b5c:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b5f:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b63:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b67:	48 85 db             	test   %rbx,%rbx
+  802b6a:	0f 84 25 ff ff ff    	je     802a95 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b70:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b73:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b77:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b7b:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b7f:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b86:	0f 97 c2             	seta   %dl
+  802b89:	20 c2                	and    %al,%dl
+  802b8b:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b8e:	0f 84 5e ff ff ff    	je     802af2 <devfile_read_direct+0xa6>
+  802b94:	4c 89 fa             	mov    %r15,%rdx
+  802b97:	4d 89 fd             	mov    %r15,%r13
+  802b9a:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ba1:	0f 85 4e ff ff ff    	jne    802af5 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ba7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802bab:	0f 84 1a ff ff ff    	je     802acb <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802bb1:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802bb8:	0f 85 37 ff ff ff    	jne    802af5 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802bbe:	48 89 d8             	mov    %rbx,%rax
+  802bc1:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802bc7:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802bcc:	48 39 c8             	cmp    %rcx,%rax
+  802bcf:	48 0f 47 c1          	cmova  %rcx,%rax
+  802bd3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802bd7:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802bdb:	49 89 d4             	mov    %rdx,%r12
+  802bde:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802be2:	48 b8 bd 3e 80 00 00 	movabs $0x803ebd,%rax
+  802be9:	00 00 00 
+  802bec:	ff d0                	call   *%rax
+  802bee:	a8 40                	test   $0x40,%al
+  802bf0:	0f 85 b9 00 00 00    	jne    802caf <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802bf6:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802bfd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c01:	49 39 c5             	cmp    %rax,%r13
+  802c04:	72 d8                	jb     802bde <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c06:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c0a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c11:	00 00 00 
+  802c14:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c18:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802c1b:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802c1d:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802c21:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802c25:	48 b8 32 1e 80 00 00 	movabs $0x801e32,%rax
+  802c2c:	00 00 00 
+  802c2f:	ff d0                	call   *%rax
+  802c31:	89 c7                	mov    %eax,%edi
+  802c33:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c39:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c3e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c45:	00 00 00 
+  802c48:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c4d:	48 b8 4b 16 80 00 00 	movabs $0x80164b,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802c59:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c5e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c62:	4c 89 fe             	mov    %r15,%rsi
+  802c65:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6a:	48 b8 27 16 80 00 00 	movabs $0x801627,%rax
+  802c71:	00 00 00 
+  802c74:	ff d0                	call   *%rax
+  802c76:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c79:	48 85 d2             	test   %rdx,%rdx
+  802c7c:	0f 84 5a fe ff ff    	je     802adc <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c82:	0f 8e 5a fe ff ff    	jle    802ae2 <devfile_read_direct+0x96>
+                buf += res;
+  802c88:	48 98                	cltq
+  802c8a:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c8d:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c90:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c94:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c98:	e9 ca fe ff ff       	jmp    802b67 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c9d:	41 89 c5             	mov    %eax,%r13d
+  802ca0:	48 98                	cltq
+  802ca2:	45 85 ed             	test   %r13d,%r13d
+  802ca5:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802caa:	e9 0d fe ff ff       	jmp    802abc <devfile_read_direct+0x70>
+            map = 0;
+  802caf:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802cb3:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cb7:	e9 39 fe ff ff       	jmp    802af5 <devfile_read_direct+0xa9>
+  802cbc:	48 89 d0             	mov    %rdx,%rax
+  802cbf:	e9 f8 fd ff ff       	jmp    802abc <devfile_read_direct+0x70>
+
+0000000000802cc4 <devfile_read>:
+    if (!fd || !buf)
+  802cc4:	48 85 ff             	test   %rdi,%rdi
+  802cc7:	0f 84 21 02 00 00    	je     802eee <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802ccd:	55                   	push   %rbp
+  802cce:	48 89 e5             	mov    %rsp,%rbp
+  802cd1:	41 57                	push   %r15
+  802cd3:	41 56                	push   %r14
+  802cd5:	41 55                	push   %r13
+  802cd7:	41 54                	push   %r12
+  802cd9:	53                   	push   %rbx
+  802cda:	48 83 ec 28          	sub    $0x28,%rsp
+  802cde:	48 89 fb             	mov    %rdi,%rbx
+  802ce1:	49 89 f4             	mov    %rsi,%r12
+  802ce4:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ce7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802cec:	48 85 f6             	test   %rsi,%rsi
+  802cef:	74 4b                	je     802d3c <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802cf1:	48 b8 01 20 80 00 00 	movabs $0x802001,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+  802cfd:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d00:	48 85 c0             	test   %rax,%rax
+  802d03:	74 22                	je     802d27 <devfile_read+0x63>
+  802d05:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802d0c:	77 19                	ja     802d27 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802d0e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d13:	48 89 df             	mov    %rbx,%rdi
+  802d16:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  802d1d:	00 00 00 
+  802d20:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d22:	83 f8 02             	cmp    $0x2,%eax
+  802d25:	7e 40                	jle    802d67 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802d27:	48 89 df             	mov    %rbx,%rdi
+  802d2a:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  802d31:	00 00 00 
+  802d34:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d36:	85 c0                	test   %eax,%eax
+  802d38:	79 11                	jns    802d4b <devfile_read+0x87>
+  802d3a:	48 98                	cltq
+}
+  802d3c:	48 83 c4 28          	add    $0x28,%rsp
+  802d40:	5b                   	pop    %rbx
+  802d41:	41 5c                	pop    %r12
+  802d43:	41 5d                	pop    %r13
+  802d45:	41 5e                	pop    %r14
+  802d47:	41 5f                	pop    %r15
+  802d49:	5d                   	pop    %rbp
+  802d4a:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d4b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d50:	4c 89 ea             	mov    %r13,%rdx
+  802d53:	4c 89 e6             	mov    %r12,%rsi
+  802d56:	48 89 df             	mov    %rbx,%rdi
+  802d59:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  802d60:	00 00 00 
+  802d63:	ff d0                	call   *%rax
+  802d65:	eb d5                	jmp    802d3c <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d67:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d6b:	48 89 df             	mov    %rbx,%rdi
+  802d6e:	48 b8 4e 27 80 00 00 	movabs $0x80274e,%rax
+  802d75:	00 00 00 
+  802d78:	ff d0                	call   *%rax
+  802d7a:	85 c0                	test   %eax,%eax
+  802d7c:	0f 88 33 01 00 00    	js     802eb5 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d82:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d89:	00 00 00 
+  802d8c:	4c 89 f0             	mov    %r14,%rax
+  802d8f:	48 29 d0             	sub    %rdx,%rax
+  802d92:	48 c1 f8 03          	sar    $0x3,%rax
+  802d96:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d9d:	aa aa aa 
+  802da0:	48 0f af c2          	imul   %rdx,%rax
+  802da4:	48 c1 e0 0e          	shl    $0xe,%rax
+  802da8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dac:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802daf:	41 39 06             	cmp    %eax,(%r14)
+  802db2:	75 0d                	jne    802dc1 <devfile_read+0xfd>
+  802db4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802db7:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802dbb:	0f 84 fb 00 00 00    	je     802ebc <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802dc1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802dc6:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802dca:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802dcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dd1:	48 89 c7             	mov    %rax,%rdi
+  802dd4:	48 b8 1c 3f 80 00 00 	movabs $0x803f1c,%rax
+  802ddb:	00 00 00 
+  802dde:	ff d0                	call   *%rax
+  802de0:	84 c0                	test   %al,%al
+  802de2:	75 27                	jne    802e0b <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802de4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802de9:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802dee:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802df2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802df7:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  802dfe:	00 00 00 
+  802e01:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802e03:	85 c0                	test   %eax,%eax
+  802e05:	0f 88 dc 00 00 00    	js     802ee7 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802e0b:	44 89 f8             	mov    %r15d,%eax
+  802e0e:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e13:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802e15:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802e1c:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802e1d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e20:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802e24:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802e27:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e2c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e30:	48 89 df             	mov    %rbx,%rdi
+  802e33:	48 b8 4c 2a 80 00 00 	movabs $0x802a4c,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e3f:	48 85 c0             	test   %rax,%rax
+  802e42:	0f 88 f4 fe ff ff    	js     802d3c <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e48:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e4b:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e4e:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802e51:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802e55:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802e59:	48 63 d1             	movslq %ecx,%rdx
+  802e5c:	48 01 d0             	add    %rdx,%rax
+  802e5f:	4d 63 ff             	movslq %r15d,%r15
+  802e62:	4c 29 f8             	sub    %r15,%rax
+  802e65:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e6a:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e6e:	48 85 c0             	test   %rax,%rax
+  802e71:	0f 8e c5 fe ff ff    	jle    802d3c <devfile_read+0x78>
+    n = MIN(n, res);
+  802e77:	4c 39 e8             	cmp    %r13,%rax
+  802e7a:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e7e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e81:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e85:	48 63 f6             	movslq %esi,%rsi
+  802e88:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e8d:	48 01 c6             	add    %rax,%rsi
+  802e90:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e94:	48 01 c6             	add    %rax,%rsi
+  802e97:	4c 89 ea             	mov    %r13,%rdx
+  802e9a:	4c 89 e7             	mov    %r12,%rdi
+  802e9d:	48 b8 08 0e 80 00 00 	movabs $0x800e08,%rax
+  802ea4:	00 00 00 
+  802ea7:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802ea9:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802ead:	4c 89 e8             	mov    %r13,%rax
+  802eb0:	e9 87 fe ff ff       	jmp    802d3c <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802eb5:	48 98                	cltq
+  802eb7:	e9 80 fe ff ff       	jmp    802d3c <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802ebc:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ec0:	41 39 d7             	cmp    %edx,%r15d
+  802ec3:	0f 8c f8 fe ff ff    	jl     802dc1 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802ec9:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802ecd:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802ed0:	41 39 cf             	cmp    %ecx,%r15d
+  802ed3:	0f 8d e8 fe ff ff    	jge    802dc1 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802ed9:	4d 63 ff             	movslq %r15d,%r15
+  802edc:	4c 29 f8             	sub    %r15,%rax
+  802edf:	48 63 d2             	movslq %edx,%rdx
+  802ee2:	48 01 d0             	add    %rdx,%rax
+  802ee5:	eb 87                	jmp    802e6e <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ee7:	48 98                	cltq
+  802ee9:	e9 4e fe ff ff       	jmp    802d3c <devfile_read+0x78>
+        return E_INVAL;
+  802eee:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ef3:	c3                   	ret
+
+0000000000802ef4 <fs_channel>:
+fs_channel(bool enable) {
+  802ef4:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802ef6:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802efd:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802eff:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f04:	40 84 ff             	test   %dil,%dil
+  802f07:	74 47                	je     802f50 <fs_channel+0x5c>
+  802f09:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802f10:	00 00 00 
+  802f13:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802f19:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802f20:	00 00 00 
+  802f23:	3b 08                	cmp    (%rax),%ecx
+  802f25:	74 29                	je     802f50 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802f27:	55                   	push   %rbp
+  802f28:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802f2b:	48 b8 74 1e 80 00 00 	movabs $0x801e74,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+  802f37:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f39:	85 c0                	test   %eax,%eax
+  802f3b:	78 04                	js     802f41 <fs_channel+0x4d>
+}
+  802f3d:	89 d0                	mov    %edx,%eax
+  802f3f:	5d                   	pop    %rbp
+  802f40:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f41:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f48:	00 00 00 
+  802f4b:	c6 00 00             	movb   $0x0,(%rax)
+  802f4e:	eb ed                	jmp    802f3d <fs_channel+0x49>
+}
+  802f50:	89 d0                	mov    %edx,%eax
+  802f52:	c3                   	ret
+
+0000000000802f53 <open>:
+open(const char *path, int mode) {
+  802f53:	55                   	push   %rbp
+  802f54:	48 89 e5             	mov    %rsp,%rbp
+  802f57:	41 55                	push   %r13
+  802f59:	41 54                	push   %r12
+  802f5b:	53                   	push   %rbx
+  802f5c:	48 83 ec 18          	sub    $0x18,%rsp
+  802f60:	49 89 fc             	mov    %rdi,%r12
+  802f63:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f66:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  802f6d:	00 00 00 
+  802f70:	ff d0                	call   *%rax
+  802f72:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f78:	0f 87 8f 00 00 00    	ja     80300d <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f7e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f82:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  802f89:	00 00 00 
+  802f8c:	ff d0                	call   *%rax
+  802f8e:	89 c3                	mov    %eax,%ebx
+  802f90:	85 c0                	test   %eax,%eax
+  802f92:	78 55                	js     802fe9 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f94:	4c 89 e6             	mov    %r12,%rsi
+  802f97:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f9e:	00 00 00 
+  802fa1:	48 89 df             	mov    %rbx,%rdi
+  802fa4:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802fb0:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802fb7:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fbc:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fc0:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fc5:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  802fcc:	00 00 00 
+  802fcf:	ff d0                	call   *%rax
+  802fd1:	89 c3                	mov    %eax,%ebx
+  802fd3:	85 c0                	test   %eax,%eax
+  802fd5:	78 1f                	js     802ff6 <open+0xa3>
+    return fd2num(fd);
+  802fd7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fdb:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+  802fe7:	89 c3                	mov    %eax,%ebx
+}
+  802fe9:	89 d8                	mov    %ebx,%eax
+  802feb:	48 83 c4 18          	add    $0x18,%rsp
+  802fef:	5b                   	pop    %rbx
+  802ff0:	41 5c                	pop    %r12
+  802ff2:	41 5d                	pop    %r13
+  802ff4:	5d                   	pop    %rbp
+  802ff5:	c3                   	ret
+        fd_close(fd, 0);
+  802ff6:	be 00 00 00 00       	mov    $0x0,%esi
+  802ffb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fff:	48 b8 49 18 80 00 00 	movabs $0x801849,%rax
+  803006:	00 00 00 
+  803009:	ff d0                	call   *%rax
+        return res;
+  80300b:	eb dc                	jmp    802fe9 <open+0x96>
+        return -E_BAD_PATH;
+  80300d:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803012:	eb d5                	jmp    802fe9 <open+0x96>
+
+0000000000803014 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803014:	55                   	push   %rbp
+  803015:	48 89 e5             	mov    %rsp,%rbp
+  803018:	41 56                	push   %r14
+  80301a:	41 55                	push   %r13
+  80301c:	41 54                	push   %r12
+  80301e:	53                   	push   %rbx
+  80301f:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803023:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80302a:	00 00 00 
+  80302d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803032:	49 bd 8e 17 80 00 00 	movabs $0x80178e,%r13
+  803039:	00 00 00 
+  80303c:	49 be 4e 27 80 00 00 	movabs $0x80274e,%r14
+  803043:	00 00 00 
+  803046:	eb 0c                	jmp    803054 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803048:	83 c3 01             	add    $0x1,%ebx
+  80304b:	49 83 c4 18          	add    $0x18,%r12
+  80304f:	83 fb 20             	cmp    $0x20,%ebx
+  803052:	74 1d                	je     803071 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803054:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803059:	74 ed                	je     803048 <file_flush_buffers+0x34>
+  80305b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80305f:	89 df                	mov    %ebx,%edi
+  803061:	41 ff d5             	call   *%r13
+  803064:	85 c0                	test   %eax,%eax
+  803066:	78 e0                	js     803048 <file_flush_buffers+0x34>
+  803068:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80306c:	41 ff d6             	call   *%r14
+  80306f:	eb d7                	jmp    803048 <file_flush_buffers+0x34>
+}
+  803071:	48 83 c4 10          	add    $0x10,%rsp
+  803075:	5b                   	pop    %rbx
+  803076:	41 5c                	pop    %r12
+  803078:	41 5d                	pop    %r13
+  80307a:	41 5e                	pop    %r14
+  80307c:	5d                   	pop    %rbp
+  80307d:	c3                   	ret
+
+000000000080307e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80307e:	55                   	push   %rbp
+  80307f:	48 89 e5             	mov    %rsp,%rbp
+  803082:	41 54                	push   %r12
+  803084:	53                   	push   %rbx
+  803085:	49 89 fc             	mov    %rdi,%r12
+  803088:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80308a:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  803091:	00 00 00 
+  803094:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803096:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80309d:	00 00 00 
+  8030a0:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8030a5:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030a7:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8030aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030af:	be 00 00 00 00       	mov    $0x0,%esi
+  8030b4:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030b9:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+}
+  8030c5:	5b                   	pop    %rbx
+  8030c6:	41 5c                	pop    %r12
+  8030c8:	5d                   	pop    %rbp
+  8030c9:	c3                   	ret
+
+00000000008030ca <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8030ca:	55                   	push   %rbp
+  8030cb:	48 89 e5             	mov    %rsp,%rbp
+  8030ce:	41 54                	push   %r12
+  8030d0:	53                   	push   %rbx
+  8030d1:	49 89 fc             	mov    %rdi,%r12
+  8030d4:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8030d7:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  8030de:	00 00 00 
+  8030e1:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8030e3:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8030e8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8030ef:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8030f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030fb:	bf 05 00 00 00       	mov    $0x5,%edi
+  803100:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  803107:	00 00 00 
+  80310a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80310c:	85 c0                	test   %eax,%eax
+  80310e:	78 3d                	js     80314d <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803110:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803117:	00 00 00 
+  80311a:	4c 89 e6             	mov    %r12,%rsi
+  80311d:	48 89 df             	mov    %rbx,%rdi
+  803120:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  803127:	00 00 00 
+  80312a:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80312c:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803133:	00 
+  803134:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80313a:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803141:	00 
+  803142:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803148:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80314d:	5b                   	pop    %rbx
+  80314e:	41 5c                	pop    %r12
+  803150:	5d                   	pop    %rbp
+  803151:	c3                   	ret
+
+0000000000803152 <remove>:
+remove(const char *path) {
+  803152:	55                   	push   %rbp
+  803153:	48 89 e5             	mov    %rsp,%rbp
+  803156:	53                   	push   %rbx
+  803157:	48 83 ec 08          	sub    $0x8,%rsp
+  80315b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80315e:	48 b8 69 0b 80 00 00 	movabs $0x800b69,%rax
+  803165:	00 00 00 
+  803168:	ff d0                	call   *%rax
+  80316a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803170:	77 3a                	ja     8031ac <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803172:	48 89 de             	mov    %rbx,%rsi
+  803175:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80317c:	00 00 00 
+  80317f:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  803186:	00 00 00 
+  803189:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80318b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803190:	be 00 00 00 00       	mov    $0x0,%esi
+  803195:	bf 07 00 00 00       	mov    $0x7,%edi
+  80319a:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  8031a1:	00 00 00 
+  8031a4:	ff d0                	call   *%rax
+}
+  8031a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031aa:	c9                   	leave
+  8031ab:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031ac:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031b1:	eb f3                	jmp    8031a6 <remove+0x54>
+
+00000000008031b3 <sync>:
+sync(void) {
+  8031b3:	55                   	push   %rbp
+  8031b4:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8031b7:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  8031be:	00 00 00 
+  8031c1:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8031c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8031cd:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031d2:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  8031d9:	00 00 00 
+  8031dc:	ff d0                	call   *%rax
+}
+  8031de:	5d                   	pop    %rbp
+  8031df:	c3                   	ret
+
+00000000008031e0 <fsync>:
+fsync(int fdnum) {
+  8031e0:	55                   	push   %rbp
+  8031e1:	48 89 e5             	mov    %rsp,%rbp
+  8031e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031e8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031ec:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  8031f3:	00 00 00 
+  8031f6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031f8:	85 c0                	test   %eax,%eax
+  8031fa:	78 4b                	js     803247 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031fc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803200:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  803207:	00 00 00 
+  80320a:	8b 00                	mov    (%rax),%eax
+  80320c:	39 02                	cmp    %eax,(%rdx)
+  80320e:	75 39                	jne    803249 <fsync+0x69>
+    file_flush_buffers();
+  803210:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  803217:	00 00 00 
+  80321a:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80321c:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803220:	8b 40 0c             	mov    0xc(%rax),%eax
+  803223:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80322a:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80322c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803231:	be 00 00 00 00       	mov    $0x0,%esi
+  803236:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80323b:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+}
+  803247:	c9                   	leave
+  803248:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803249:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80324e:	eb f7                	jmp    803247 <fsync+0x67>
+
+0000000000803250 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803250:	55                   	push   %rbp
+  803251:	48 89 e5             	mov    %rsp,%rbp
+  803254:	53                   	push   %rbx
+  803255:	48 83 ec 08          	sub    $0x8,%rsp
+  803259:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80325c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803261:	be 00 00 00 00       	mov    $0x0,%esi
+  803266:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80326b:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  803272:	00 00 00 
+  803275:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803277:	85 c0                	test   %eax,%eax
+  803279:	78 2d                	js     8032a8 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80327b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803282:	00 00 00 
+  803285:	48 8b 10             	mov    (%rax),%rdx
+  803288:	48 89 13             	mov    %rdx,(%rbx)
+  80328b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80328f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803293:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803297:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80329b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80329f:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8032a3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032ac:	c9                   	leave
+  8032ad:	c3                   	ret
+
+00000000008032ae <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8032ae:	55                   	push   %rbp
+  8032af:	48 89 e5             	mov    %rsp,%rbp
+  8032b2:	53                   	push   %rbx
+  8032b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8032b7:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8032ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8032c4:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8032c9:	48 b8 e5 24 80 00 00 	movabs $0x8024e5,%rax
+  8032d0:	00 00 00 
+  8032d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032d5:	85 c0                	test   %eax,%eax
+  8032d7:	78 3d                	js     803316 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8032d9:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032e0:	00 00 00 
+  8032e3:	48 8b 10             	mov    (%rax),%rdx
+  8032e6:	48 89 13             	mov    %rdx,(%rbx)
+  8032e9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032ed:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032f1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032f5:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032f9:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8032fd:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803301:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803305:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803309:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80330d:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803311:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803316:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80331a:	c9                   	leave
+  80331b:	c3                   	ret
+
+000000000080331c <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80331c:	55                   	push   %rbp
+  80331d:	48 89 e5             	mov    %rsp,%rbp
+  803320:	41 57                	push   %r15
+  803322:	41 56                	push   %r14
+  803324:	41 55                	push   %r13
+  803326:	41 54                	push   %r12
+  803328:	53                   	push   %rbx
+  803329:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80332d:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803334:	00 
+  803335:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80333c:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803342:	0f 85 43 01 00 00    	jne    80348b <munmap+0x16f>
+  803348:	49 89 ff             	mov    %rdi,%r15
+  80334b:	4c 39 f7             	cmp    %r14,%rdi
+  80334e:	0f 87 37 01 00 00    	ja     80348b <munmap+0x16f>
+  803354:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80335b:	00 00 00 
+  80335e:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803364:	eb 2c                	jmp    803392 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803366:	4c 39 f8             	cmp    %r15,%rax
+  803369:	0f 83 85 00 00 00    	jae    8033f4 <munmap+0xd8>
+            m->mm_end = start;
+  80336f:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803374:	48 83 c3 18          	add    $0x18,%rbx
+  803378:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80337f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803386:	00 00 00 
+  803389:	48 39 c3             	cmp    %rax,%rbx
+  80338c:	0f 84 d0 00 00 00    	je     803462 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803392:	49 89 dc             	mov    %rbx,%r12
+  803395:	48 8b 03             	mov    (%rbx),%rax
+  803398:	4c 39 f0             	cmp    %r14,%rax
+  80339b:	73 d7                	jae    803374 <munmap+0x58>
+  80339d:	48 85 c0             	test   %rax,%rax
+  8033a0:	74 d2                	je     803374 <munmap+0x58>
+  8033a2:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033a6:	49 39 d7             	cmp    %rdx,%r15
+  8033a9:	73 c9                	jae    803374 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8033ab:	49 39 d6             	cmp    %rdx,%r14
+  8033ae:	73 b6                	jae    803366 <munmap+0x4a>
+  8033b0:	49 39 c7             	cmp    %rax,%r15
+  8033b3:	76 b1                	jbe    803366 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8033b5:	4c 89 ef             	mov    %r13,%rdi
+  8033b8:	48 b8 53 24 80 00 00 	movabs $0x802453,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8033c4:	48 85 c0             	test   %rax,%rax
+  8033c7:	0f 84 c5 00 00 00    	je     803492 <munmap+0x176>
+            *tail = *m;
+  8033cd:	48 8b 13             	mov    (%rbx),%rdx
+  8033d0:	48 89 10             	mov    %rdx,(%rax)
+  8033d3:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033d7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8033db:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8033df:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8033e3:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8033e6:	44 89 f2             	mov    %r14d,%edx
+  8033e9:	2b 13                	sub    (%rbx),%edx
+  8033eb:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8033ee:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8033f2:	eb 80                	jmp    803374 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8033f4:	49 39 d6             	cmp    %rdx,%r14
+  8033f7:	73 18                	jae    803411 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8033f9:	44 89 f2             	mov    %r14d,%edx
+  8033fc:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803401:	29 c2                	sub    %eax,%edx
+  803403:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803408:	4d 89 34 24          	mov    %r14,(%r12)
+  80340c:	e9 63 ff ff ff       	jmp    803374 <munmap+0x58>
+    m->mm_start = 0;
+  803411:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803418:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803419:	4c 89 e6             	mov    %r12,%rsi
+  80341c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803423:	00 00 00 
+  803426:	48 29 c6             	sub    %rax,%rsi
+  803429:	48 c1 fe 03          	sar    $0x3,%rsi
+  80342d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803434:	aa aa aa 
+  803437:	48 0f af f0          	imul   %rax,%rsi
+  80343b:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80343f:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803444:	48 01 c6             	add    %rax,%rsi
+  803447:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80344c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803451:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  803458:	00 00 00 
+  80345b:	ff d0                	call   *%rax
+}
+  80345d:	e9 12 ff ff ff       	jmp    803374 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803462:	4c 89 f2             	mov    %r14,%rdx
+  803465:	4c 29 fa             	sub    %r15,%rdx
+  803468:	4c 89 fe             	mov    %r15,%rsi
+  80346b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803470:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  803477:	00 00 00 
+  80347a:	ff d0                	call   *%rax
+}
+  80347c:	48 83 c4 08          	add    $0x8,%rsp
+  803480:	5b                   	pop    %rbx
+  803481:	41 5c                	pop    %r12
+  803483:	41 5d                	pop    %r13
+  803485:	41 5e                	pop    %r14
+  803487:	41 5f                	pop    %r15
+  803489:	5d                   	pop    %rbp
+  80348a:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80348b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803490:	eb ea                	jmp    80347c <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803492:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803497:	eb e3                	jmp    80347c <munmap+0x160>
+
+0000000000803499 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803499:	55                   	push   %rbp
+  80349a:	48 89 e5             	mov    %rsp,%rbp
+  80349d:	41 57                	push   %r15
+  80349f:	41 56                	push   %r14
+  8034a1:	41 55                	push   %r13
+  8034a3:	41 54                	push   %r12
+  8034a5:	53                   	push   %rbx
+  8034a6:	48 83 ec 28          	sub    $0x28,%rsp
+  8034aa:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8034ae:	49 89 f5             	mov    %rsi,%r13
+  8034b1:	41 89 d6             	mov    %edx,%r14d
+  8034b4:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8034b7:	41 89 cc             	mov    %ecx,%r12d
+  8034ba:	44 89 c7             	mov    %r8d,%edi
+  8034bd:	44 89 cb             	mov    %r9d,%ebx
+  8034c0:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034c4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034c8:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  8034cf:	00 00 00 
+  8034d2:	ff d0                	call   *%rax
+  8034d4:	41 89 c7             	mov    %eax,%r15d
+  8034d7:	85 c0                	test   %eax,%eax
+  8034d9:	0f 88 ae 01 00 00    	js     80368d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034e3:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8034ea:	00 00 00 
+  8034ed:	8b 32                	mov    (%rdx),%esi
+  8034ef:	39 30                	cmp    %esi,(%rax)
+  8034f1:	0f 85 7a 02 00 00    	jne    803771 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8034f7:	8b 40 08             	mov    0x8(%rax),%eax
+  8034fa:	83 e0 03             	and    $0x3,%eax
+  8034fd:	83 f8 01             	cmp    $0x1,%eax
+  803500:	0f 84 76 02 00 00    	je     80377c <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803506:	4d 85 ed             	test   %r13,%r13
+  803509:	0f 84 78 02 00 00    	je     803787 <mmap+0x2ee>
+  80350f:	85 db                	test   %ebx,%ebx
+  803511:	0f 88 70 02 00 00    	js     803787 <mmap+0x2ee>
+  803517:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80351d:	41 89 df             	mov    %ebx,%r15d
+  803520:	0f 85 6c 02 00 00    	jne    803792 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803526:	44 89 f0             	mov    %r14d,%eax
+  803529:	83 e0 fd             	and    $0xfffffffd,%eax
+  80352c:	83 f8 04             	cmp    $0x4,%eax
+  80352f:	0f 85 68 02 00 00    	jne    80379d <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803535:	44 89 e1             	mov    %r12d,%ecx
+  803538:	83 e1 01             	and    $0x1,%ecx
+  80353b:	0f 95 c2             	setne  %dl
+  80353e:	44 89 e0             	mov    %r12d,%eax
+  803541:	d1 e8                	shr    %eax
+  803543:	83 f0 01             	xor    $0x1,%eax
+  803546:	83 e0 01             	and    $0x1,%eax
+  803549:	38 c2                	cmp    %al,%dl
+  80354b:	0f 85 57 02 00 00    	jne    8037a8 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803551:	85 c9                	test   %ecx,%ecx
+  803553:	74 0a                	je     80355f <mmap+0xc6>
+  803555:	41 f6 c6 02          	test   $0x2,%r14b
+  803559:	0f 85 54 02 00 00    	jne    8037b3 <mmap+0x31a>
+    file_flush_buffers();
+  80355f:	48 b8 14 30 80 00 00 	movabs $0x803014,%rax
+  803566:	00 00 00 
+  803569:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80356b:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803572:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803579:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80357d:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803580:	41 f6 c4 04          	test   $0x4,%r12b
+  803584:	0f 84 15 01 00 00    	je     80369f <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80358a:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80358d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803593:	0f 85 25 02 00 00    	jne    8037be <mmap+0x325>
+  803599:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80359d:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8035a4:	00 00 00 
+  8035a7:	48 39 c2             	cmp    %rax,%rdx
+  8035aa:	0f 82 19 02 00 00    	jb     8037c9 <mmap+0x330>
+  8035b0:	48 39 c7             	cmp    %rax,%rdi
+  8035b3:	0f 87 10 02 00 00    	ja     8037c9 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8035b9:	4c 89 ee             	mov    %r13,%rsi
+  8035bc:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  8035c3:	00 00 00 
+  8035c6:	ff d0                	call   *%rax
+  8035c8:	85 c0                	test   %eax,%eax
+  8035ca:	0f 88 04 02 00 00    	js     8037d4 <mmap+0x33b>
+    if (!handler) {
+  8035d0:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035d7:	00 00 00 
+  8035da:	80 38 00             	cmpb   $0x0,(%rax)
+  8035dd:	75 2b                	jne    80360a <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8035df:	48 bf b4 23 80 00 00 	movabs $0x8023b4,%rdi
+  8035e6:	00 00 00 
+  8035e9:	48 b8 18 45 80 00 00 	movabs $0x804518,%rax
+  8035f0:	00 00 00 
+  8035f3:	ff d0                	call   *%rax
+  8035f5:	85 c0                	test   %eax,%eax
+  8035f7:	0f 88 ea 01 00 00    	js     8037e7 <mmap+0x34e>
+        handler = 1;
+  8035fd:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803604:	00 00 00 
+  803607:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80360a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80360e:	48 b8 53 24 80 00 00 	movabs $0x802453,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+  80361a:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80361d:	48 85 c0             	test   %rax,%rax
+  803620:	0f 84 c9 01 00 00    	je     8037ef <mmap+0x356>
+    m->mm_start = va;
+  803626:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803629:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80362d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803631:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803634:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803638:	44 89 e0             	mov    %r12d,%eax
+  80363b:	c1 e0 06             	shl    $0x6,%eax
+  80363e:	25 80 00 00 00       	and    $0x80,%eax
+  803643:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803646:	09 f0                	or     %esi,%eax
+  803648:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80364c:	41 f6 c4 08          	test   $0x8,%r12b
+  803650:	74 31                	je     803683 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803652:	48 39 d3             	cmp    %rdx,%rbx
+  803655:	73 2c                	jae    803683 <mmap+0x1ea>
+  803657:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80365c:	48 89 de             	mov    %rbx,%rsi
+  80365f:	4c 89 f7             	mov    %r14,%rdi
+  803662:	48 b8 a3 22 80 00 00 	movabs $0x8022a3,%rax
+  803669:	00 00 00 
+  80366c:	ff d0                	call   *%rax
+  80366e:	49 89 c4             	mov    %rax,%r12
+  803671:	48 85 c0             	test   %rax,%rax
+  803674:	0f 8e d7 00 00 00    	jle    803751 <mmap+0x2b8>
+            va += n;
+  80367a:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80367d:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803681:	72 d4                	jb     803657 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803683:	49 8b 06             	mov    (%r14),%rax
+  803686:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80368a:	48 89 06             	mov    %rax,(%rsi)
+}
+  80368d:	44 89 f8             	mov    %r15d,%eax
+  803690:	48 83 c4 28          	add    $0x28,%rsp
+  803694:	5b                   	pop    %rbx
+  803695:	41 5c                	pop    %r12
+  803697:	41 5d                	pop    %r13
+  803699:	41 5e                	pop    %r14
+  80369b:	41 5f                	pop    %r15
+  80369d:	5d                   	pop    %rbp
+  80369e:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80369f:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8036a6:	00 00 00 
+  8036a9:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8036ac:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8036b3:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036b6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036bb:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8036c2:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036c5:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8036cc:	00 00 00 
+  8036cf:	48 39 d7             	cmp    %rdx,%rdi
+  8036d2:	73 1c                	jae    8036f0 <mmap+0x257>
+        return -E_NO_MEM;
+  8036d4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036da:	eb b1                	jmp    80368d <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036dc:	48 83 c0 01          	add    $0x1,%rax
+  8036e0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8036e4:	77 3f                	ja     803725 <mmap+0x28c>
+  8036e6:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8036eb:	48 39 d7             	cmp    %rdx,%rdi
+  8036ee:	72 2a                	jb     80371a <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036f0:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8036f4:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8036f8:	48 39 d1             	cmp    %rdx,%rcx
+  8036fb:	73 df                	jae    8036dc <mmap+0x243>
+  8036fd:	48 85 c9             	test   %rcx,%rcx
+  803700:	74 da                	je     8036dc <mmap+0x243>
+  803702:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803706:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80370b:	48 39 d3             	cmp    %rdx,%rbx
+  80370e:	73 cc                	jae    8036dc <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803710:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803713:	b8 00 00 00 00       	mov    $0x0,%eax
+  803718:	eb cc                	jmp    8036e6 <mmap+0x24d>
+        return -E_NO_MEM;
+  80371a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803720:	e9 68 ff ff ff       	jmp    80368d <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803725:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80372a:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803731:	00 00 00 
+  803734:	48 39 c2             	cmp    %rax,%rdx
+  803737:	0f 82 9f 00 00 00    	jb     8037dc <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80373d:	48 85 db             	test   %rbx,%rbx
+  803740:	0f 85 8a fe ff ff    	jne    8035d0 <mmap+0x137>
+        return -E_NO_MEM;
+  803746:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80374c:	e9 3c ff ff ff       	jmp    80368d <mmap+0x1f4>
+        if (n < 0) {
+  803751:	0f 89 2c ff ff ff    	jns    803683 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803757:	49 8b 3e             	mov    (%r14),%rdi
+  80375a:	4c 89 ee             	mov    %r13,%rsi
+  80375d:	48 b8 1c 33 80 00 00 	movabs $0x80331c,%rax
+  803764:	00 00 00 
+  803767:	ff d0                	call   *%rax
+            return n;
+  803769:	45 89 e7             	mov    %r12d,%r15d
+  80376c:	e9 1c ff ff ff       	jmp    80368d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803771:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803777:	e9 11 ff ff ff       	jmp    80368d <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80377c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803782:	e9 06 ff ff ff       	jmp    80368d <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803787:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80378d:	e9 fb fe ff ff       	jmp    80368d <mmap+0x1f4>
+  803792:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803798:	e9 f0 fe ff ff       	jmp    80368d <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80379d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037a3:	e9 e5 fe ff ff       	jmp    80368d <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037a8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037ae:	e9 da fe ff ff       	jmp    80368d <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037b3:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8037b9:	e9 cf fe ff ff       	jmp    80368d <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037be:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037c4:	e9 c4 fe ff ff       	jmp    80368d <mmap+0x1f4>
+  8037c9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037cf:	e9 b9 fe ff ff       	jmp    80368d <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8037d4:	41 89 c7             	mov    %eax,%r15d
+  8037d7:	e9 b1 fe ff ff       	jmp    80368d <mmap+0x1f4>
+        return -E_NO_MEM;
+  8037dc:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037e2:	e9 a6 fe ff ff       	jmp    80368d <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037e7:	41 89 c7             	mov    %eax,%r15d
+  8037ea:	e9 9e fe ff ff       	jmp    80368d <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8037ef:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037f5:	e9 93 fe ff ff       	jmp    80368d <mmap+0x1f4>
+
+00000000008037fa <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8037fa:	55                   	push   %rbp
+  8037fb:	48 89 e5             	mov    %rsp,%rbp
+  8037fe:	41 54                	push   %r12
+  803800:	53                   	push   %rbx
+  803801:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803804:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  80380b:	00 00 00 
+  80380e:	ff d0                	call   *%rax
+  803810:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803813:	48 be 00 4e 80 00 00 	movabs $0x804e00,%rsi
+  80381a:	00 00 00 
+  80381d:	48 89 df             	mov    %rbx,%rdi
+  803820:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  803827:	00 00 00 
+  80382a:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80382c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803831:	41 2b 04 24          	sub    (%r12),%eax
+  803835:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80383b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803842:	00 00 00 
+    stat->st_dev = &devpipe;
+  803845:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  80384c:	00 00 00 
+  80384f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80385b:	5b                   	pop    %rbx
+  80385c:	41 5c                	pop    %r12
+  80385e:	5d                   	pop    %rbp
+  80385f:	c3                   	ret
+
+0000000000803860 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803860:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803863:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803869:	8b 17                	mov    (%rdi),%edx
+  80386b:	85 d2                	test   %edx,%edx
+  80386d:	75 01                	jne    803870 <pipe_wakeup+0x10>
+  80386f:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803870:	55                   	push   %rbp
+  803871:	48 89 e5             	mov    %rsp,%rbp
+  803874:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803877:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80387d:	be 00 04 00 00       	mov    $0x400,%esi
+  803882:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  803889:	00 00 00 
+  80388c:	ff d0                	call   *%rax
+}
+  80388e:	5d                   	pop    %rbp
+  80388f:	c3                   	ret
+
+0000000000803890 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803890:	55                   	push   %rbp
+  803891:	48 89 e5             	mov    %rsp,%rbp
+  803894:	41 55                	push   %r13
+  803896:	41 54                	push   %r12
+  803898:	53                   	push   %rbx
+  803899:	48 83 ec 08          	sub    $0x8,%rsp
+  80389d:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038a0:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  8038a7:	00 00 00 
+  8038aa:	ff d0                	call   *%rax
+  8038ac:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8038af:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038b4:	4c 89 e6             	mov    %r12,%rsi
+  8038b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038bc:	49 bc ac 11 80 00 00 	movabs $0x8011ac,%r12
+  8038c3:	00 00 00 
+  8038c6:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038c9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8038cd:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8038d1:	49 bd 60 38 80 00 00 	movabs $0x803860,%r13
+  8038d8:	00 00 00 
+  8038db:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038de:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038e2:	48 89 de             	mov    %rbx,%rsi
+  8038e5:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8038e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038ed:	48 89 de             	mov    %rbx,%rsi
+  8038f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038f5:	41 ff d4             	call   *%r12
+  8038f8:	48 83 c4 08          	add    $0x8,%rsp
+  8038fc:	5b                   	pop    %rbx
+  8038fd:	41 5c                	pop    %r12
+  8038ff:	41 5d                	pop    %r13
+  803901:	5d                   	pop    %rbp
+  803902:	c3                   	ret
+
+0000000000803903 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803903:	55                   	push   %rbp
+  803904:	48 89 e5             	mov    %rsp,%rbp
+  803907:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80390a:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80390f:	be 00 10 00 00       	mov    $0x1000,%esi
+  803914:	48 b8 ef 10 80 00 00 	movabs $0x8010ef,%rax
+  80391b:	00 00 00 
+  80391e:	ff d0                	call   *%rax
+  803920:	85 c0                	test   %eax,%eax
+  803922:	0f 94 c0             	sete   %al
+  803925:	0f b6 c0             	movzbl %al,%eax
+}
+  803928:	5d                   	pop    %rbp
+  803929:	c3                   	ret
+
+000000000080392a <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80392a:	55                   	push   %rbp
+  80392b:	48 89 e5             	mov    %rsp,%rbp
+  80392e:	41 57                	push   %r15
+  803930:	41 56                	push   %r14
+  803932:	41 55                	push   %r13
+  803934:	41 54                	push   %r12
+  803936:	53                   	push   %rbx
+  803937:	48 83 ec 38          	sub    $0x38,%rsp
+  80393b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80393f:	49 89 f4             	mov    %rsi,%r12
+  803942:	49 89 d7             	mov    %rdx,%r15
+  803945:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803949:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  803950:	00 00 00 
+  803953:	ff d0                	call   *%rax
+  803955:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803958:	4d 85 ff             	test   %r15,%r15
+  80395b:	0f 84 f1 00 00 00    	je     803a52 <devpipe_write+0x128>
+  803961:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803965:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803969:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80396d:	49 bd 03 39 80 00 00 	movabs $0x803903,%r13
+  803974:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803977:	49 bf 60 38 80 00 00 	movabs $0x803860,%r15
+  80397e:	00 00 00 
+  803981:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803985:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803989:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80398d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803990:	48 63 ce             	movslq %esi,%rcx
+  803993:	48 63 03             	movslq (%rbx),%rax
+  803996:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80399c:	48 39 c1             	cmp    %rax,%rcx
+  80399f:	72 64                	jb     803a05 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039a1:	48 89 de             	mov    %rbx,%rsi
+  8039a4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039a8:	41 ff d5             	call   *%r13
+  8039ab:	85 c0                	test   %eax,%eax
+  8039ad:	0f 85 b9 00 00 00    	jne    803a6c <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8039b3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8039b7:	4c 89 f7             	mov    %r14,%rdi
+  8039ba:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8039bd:	8b 43 04             	mov    0x4(%rbx),%eax
+  8039c0:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8039c7:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8039ce:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8039d4:	8b 03                	mov    (%rbx),%eax
+  8039d6:	41 39 c4             	cmp    %eax,%r12d
+  8039d9:	75 b2                	jne    80398d <devpipe_write+0x63>
+  8039db:	48 89 de             	mov    %rbx,%rsi
+  8039de:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039e2:	41 ff d5             	call   *%r13
+  8039e5:	85 c0                	test   %eax,%eax
+  8039e7:	75 a0                	jne    803989 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8039e9:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8039ee:	44 89 e6             	mov    %r12d,%esi
+  8039f1:	48 89 df             	mov    %rbx,%rdi
+  8039f4:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  8039fb:	00 00 00 
+  8039fe:	ff d0                	call   *%rax
+  803a00:	e9 7c ff ff ff       	jmp    803981 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803a05:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803a09:	41 0f b6 38          	movzbl (%r8),%edi
+  803a0d:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803a14:	80 80 80 
+  803a17:	48 89 c8             	mov    %rcx,%rax
+  803a1a:	48 f7 e2             	mul    %rdx
+  803a1d:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803a21:	48 89 d0             	mov    %rdx,%rax
+  803a24:	48 c1 e0 08          	shl    $0x8,%rax
+  803a28:	48 29 d0             	sub    %rdx,%rax
+  803a2b:	48 c1 e0 04          	shl    $0x4,%rax
+  803a2f:	48 29 c1             	sub    %rax,%rcx
+  803a32:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a37:	83 c6 01             	add    $0x1,%esi
+  803a3a:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a3d:	49 83 c0 01          	add    $0x1,%r8
+  803a41:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803a45:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a49:	49 39 c0             	cmp    %rax,%r8
+  803a4c:	0f 85 2f ff ff ff    	jne    803981 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a52:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a56:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a5a:	48 b8 60 38 80 00 00 	movabs $0x803860,%rax
+  803a61:	00 00 00 
+  803a64:	ff d0                	call   *%rax
+    return n;
+  803a66:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a6a:	eb 05                	jmp    803a71 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a71:	48 83 c4 38          	add    $0x38,%rsp
+  803a75:	5b                   	pop    %rbx
+  803a76:	41 5c                	pop    %r12
+  803a78:	41 5d                	pop    %r13
+  803a7a:	41 5e                	pop    %r14
+  803a7c:	41 5f                	pop    %r15
+  803a7e:	5d                   	pop    %rbp
+  803a7f:	c3                   	ret
+
+0000000000803a80 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a80:	55                   	push   %rbp
+  803a81:	48 89 e5             	mov    %rsp,%rbp
+  803a84:	41 57                	push   %r15
+  803a86:	41 56                	push   %r14
+  803a88:	41 55                	push   %r13
+  803a8a:	41 54                	push   %r12
+  803a8c:	53                   	push   %rbx
+  803a8d:	48 83 ec 28          	sub    $0x28,%rsp
+  803a91:	49 89 fd             	mov    %rdi,%r13
+  803a94:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a98:	49 89 d4             	mov    %rdx,%r12
+  803a9b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a9f:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+  803aab:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803aae:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803ab4:	49 bf 03 39 80 00 00 	movabs $0x803903,%r15
+  803abb:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803abe:	4d 85 e4             	test   %r12,%r12
+  803ac1:	0f 84 d5 00 00 00    	je     803b9c <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ac7:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803acb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803acf:	8b 03                	mov    (%rbx),%eax
+  803ad1:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ad4:	75 7a                	jne    803b50 <devpipe_read+0xd0>
+            if (i > 0) {
+  803ad6:	4d 85 f6             	test   %r14,%r14
+  803ad9:	75 50                	jne    803b2b <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803adb:	48 89 de             	mov    %rbx,%rsi
+  803ade:	4c 89 ef             	mov    %r13,%rdi
+  803ae1:	41 ff d7             	call   *%r15
+  803ae4:	85 c0                	test   %eax,%eax
+  803ae6:	0f 85 c9 00 00 00    	jne    803bb5 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803aec:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803aef:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803af6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803afc:	8b 43 04             	mov    0x4(%rbx),%eax
+  803aff:	41 39 c4             	cmp    %eax,%r12d
+  803b02:	75 cb                	jne    803acf <devpipe_read+0x4f>
+  803b04:	48 89 de             	mov    %rbx,%rsi
+  803b07:	4c 89 ef             	mov    %r13,%rdi
+  803b0a:	41 ff d7             	call   *%r15
+  803b0d:	85 c0                	test   %eax,%eax
+  803b0f:	75 be                	jne    803acf <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b11:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b16:	44 89 e6             	mov    %r12d,%esi
+  803b19:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b1d:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  803b24:	00 00 00 
+  803b27:	ff d0                	call   *%rax
+  803b29:	eb a4                	jmp    803acf <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b2b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b2f:	48 89 de             	mov    %rbx,%rsi
+  803b32:	48 b8 60 38 80 00 00 	movabs $0x803860,%rax
+  803b39:	00 00 00 
+  803b3c:	ff d0                	call   *%rax
+                return i;
+  803b3e:	4c 89 f0             	mov    %r14,%rax
+}
+  803b41:	48 83 c4 28          	add    $0x28,%rsp
+  803b45:	5b                   	pop    %rbx
+  803b46:	41 5c                	pop    %r12
+  803b48:	41 5d                	pop    %r13
+  803b4a:	41 5e                	pop    %r14
+  803b4c:	41 5f                	pop    %r15
+  803b4e:	5d                   	pop    %rbp
+  803b4f:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b50:	48 63 c8             	movslq %eax,%rcx
+  803b53:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803b5a:	80 80 80 
+  803b5d:	48 89 c8             	mov    %rcx,%rax
+  803b60:	48 f7 e2             	mul    %rdx
+  803b63:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803b67:	48 89 d0             	mov    %rdx,%rax
+  803b6a:	48 c1 e0 08          	shl    $0x8,%rax
+  803b6e:	48 29 d0             	sub    %rdx,%rax
+  803b71:	48 c1 e0 04          	shl    $0x4,%rax
+  803b75:	48 89 c2             	mov    %rax,%rdx
+  803b78:	48 89 c8             	mov    %rcx,%rax
+  803b7b:	48 29 d0             	sub    %rdx,%rax
+  803b7e:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803b83:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b87:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803b8b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b8e:	49 83 c6 01          	add    $0x1,%r14
+  803b92:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803b96:	0f 85 2b ff ff ff    	jne    803ac7 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b9c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ba0:	48 89 de             	mov    %rbx,%rsi
+  803ba3:	48 b8 60 38 80 00 00 	movabs $0x803860,%rax
+  803baa:	00 00 00 
+  803bad:	ff d0                	call   *%rax
+    return n;
+  803baf:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803bb3:	eb 8c                	jmp    803b41 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bba:	eb 85                	jmp    803b41 <devpipe_read+0xc1>
+
+0000000000803bbc <pipe>:
+pipe(int pfd[2]) {
+  803bbc:	55                   	push   %rbp
+  803bbd:	48 89 e5             	mov    %rsp,%rbp
+  803bc0:	41 55                	push   %r13
+  803bc2:	41 54                	push   %r12
+  803bc4:	53                   	push   %rbx
+  803bc5:	48 83 ec 18          	sub    $0x18,%rsp
+  803bc9:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bcc:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bd0:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  803bd7:	00 00 00 
+  803bda:	ff d0                	call   *%rax
+  803bdc:	89 c3                	mov    %eax,%ebx
+  803bde:	85 c0                	test   %eax,%eax
+  803be0:	0f 88 a0 01 00 00    	js     803d86 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803be6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803beb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bf0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bf4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf9:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  803c00:	00 00 00 
+  803c03:	ff d0                	call   *%rax
+  803c05:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c07:	85 c0                	test   %eax,%eax
+  803c09:	0f 88 77 01 00 00    	js     803d86 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c0f:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803c13:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  803c1a:	00 00 00 
+  803c1d:	ff d0                	call   *%rax
+  803c1f:	89 c3                	mov    %eax,%ebx
+  803c21:	85 c0                	test   %eax,%eax
+  803c23:	0f 88 43 01 00 00    	js     803d6c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c29:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c33:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c37:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c3c:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  803c43:	00 00 00 
+  803c46:	ff d0                	call   *%rax
+  803c48:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c4a:	85 c0                	test   %eax,%eax
+  803c4c:	0f 88 1a 01 00 00    	js     803d6c <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c52:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c56:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  803c5d:	00 00 00 
+  803c60:	ff d0                	call   *%rax
+  803c62:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c65:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c6a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c6f:	48 89 c6             	mov    %rax,%rsi
+  803c72:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c77:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  803c7e:	00 00 00 
+  803c81:	ff d0                	call   *%rax
+  803c83:	89 c3                	mov    %eax,%ebx
+  803c85:	85 c0                	test   %eax,%eax
+  803c87:	0f 88 c5 00 00 00    	js     803d52 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c8d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c91:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  803c98:	00 00 00 
+  803c9b:	ff d0                	call   *%rax
+  803c9d:	48 89 c1             	mov    %rax,%rcx
+  803ca0:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ca6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803cac:	ba 00 00 00 00       	mov    $0x0,%edx
+  803cb1:	4c 89 ee             	mov    %r13,%rsi
+  803cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb9:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  803cc0:	00 00 00 
+  803cc3:	ff d0                	call   *%rax
+  803cc5:	89 c3                	mov    %eax,%ebx
+  803cc7:	85 c0                	test   %eax,%eax
+  803cc9:	78 6e                	js     803d39 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ccb:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cd0:	4c 89 ef             	mov    %r13,%rdi
+  803cd3:	48 b8 cb 10 80 00 00 	movabs $0x8010cb,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+  803cdf:	83 f8 02             	cmp    $0x2,%eax
+  803ce2:	0f 85 ab 00 00 00    	jne    803d93 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ce8:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803cef:	00 00 
+  803cf1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cf5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cf7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cfb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d02:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803d06:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803d08:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803d0c:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803d13:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d17:	48 bb 00 17 80 00 00 	movabs $0x801700,%rbx
+  803d1e:	00 00 00 
+  803d21:	ff d3                	call   *%rbx
+  803d23:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d27:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d2b:	ff d3                	call   *%rbx
+  803d2d:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d37:	eb 4d                	jmp    803d86 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d39:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d3e:	4c 89 ee             	mov    %r13,%rsi
+  803d41:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d46:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  803d4d:	00 00 00 
+  803d50:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d52:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d57:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d60:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  803d67:	00 00 00 
+  803d6a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d71:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d75:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d7a:	48 b8 ac 11 80 00 00 	movabs $0x8011ac,%rax
+  803d81:	00 00 00 
+  803d84:	ff d0                	call   *%rax
+}
+  803d86:	89 d8                	mov    %ebx,%eax
+  803d88:	48 83 c4 18          	add    $0x18,%rsp
+  803d8c:	5b                   	pop    %rbx
+  803d8d:	41 5c                	pop    %r12
+  803d8f:	41 5d                	pop    %r13
+  803d91:	5d                   	pop    %rbp
+  803d92:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d93:	48 b9 30 4e 80 00 00 	movabs $0x804e30,%rcx
+  803d9a:	00 00 00 
+  803d9d:	48 ba 07 4e 80 00 00 	movabs $0x804e07,%rdx
+  803da4:	00 00 00 
+  803da7:	be 50 00 00 00       	mov    $0x50,%esi
+  803dac:	48 bf 1c 4e 80 00 00 	movabs $0x804e1c,%rdi
+  803db3:	00 00 00 
+  803db6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dbb:	49 b8 eb 43 80 00 00 	movabs $0x8043eb,%r8
+  803dc2:	00 00 00 
+  803dc5:	41 ff d0             	call   *%r8
+
+0000000000803dc8 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803dc8:	55                   	push   %rbp
+  803dc9:	48 89 e5             	mov    %rsp,%rbp
+  803dcc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803dd0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803dd4:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  803ddb:	00 00 00 
+  803dde:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803de0:	85 c0                	test   %eax,%eax
+  803de2:	78 23                	js     803e07 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803de4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803de8:	48 b8 12 17 80 00 00 	movabs $0x801712,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+  803df4:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803df7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dfb:	48 b8 03 39 80 00 00 	movabs $0x803903,%rax
+  803e02:	00 00 00 
+  803e05:	ff d0                	call   *%rax
+}
+  803e07:	c9                   	leave
+  803e08:	c3                   	ret
+
+0000000000803e09 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e09:	48 89 f8             	mov    %rdi,%rax
+  803e0c:	48 c1 e8 27          	shr    $0x27,%rax
+  803e10:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e17:	01 00 00 
+  803e1a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e1e:	f6 c2 01             	test   $0x1,%dl
+  803e21:	74 6d                	je     803e90 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e23:	48 89 f8             	mov    %rdi,%rax
+  803e26:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e2a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e31:	01 00 00 
+  803e34:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e38:	f6 c2 01             	test   $0x1,%dl
+  803e3b:	74 62                	je     803e9f <get_uvpt_entry+0x96>
+  803e3d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e44:	01 00 00 
+  803e47:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e4b:	f6 c2 80             	test   $0x80,%dl
+  803e4e:	75 4f                	jne    803e9f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e50:	48 89 f8             	mov    %rdi,%rax
+  803e53:	48 c1 e8 15          	shr    $0x15,%rax
+  803e57:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e5e:	01 00 00 
+  803e61:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e65:	f6 c2 01             	test   $0x1,%dl
+  803e68:	74 44                	je     803eae <get_uvpt_entry+0xa5>
+  803e6a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e71:	01 00 00 
+  803e74:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e78:	f6 c2 80             	test   $0x80,%dl
+  803e7b:	75 31                	jne    803eae <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e7d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e81:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e88:	01 00 00 
+  803e8b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e8f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e90:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e97:	01 00 00 
+  803e9a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e9e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e9f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ea6:	01 00 00 
+  803ea9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ead:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803eae:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803eb5:	01 00 00 
+  803eb8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ebc:	c3                   	ret
+
+0000000000803ebd <get_prot>:
+
+int
+get_prot(void *va) {
+  803ebd:	55                   	push   %rbp
+  803ebe:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ec1:	48 b8 09 3e 80 00 00 	movabs $0x803e09,%rax
+  803ec8:	00 00 00 
+  803ecb:	ff d0                	call   *%rax
+  803ecd:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803ed0:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803ed5:	89 c1                	mov    %eax,%ecx
+  803ed7:	83 c9 04             	or     $0x4,%ecx
+  803eda:	f6 c2 01             	test   $0x1,%dl
+  803edd:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ee0:	89 c1                	mov    %eax,%ecx
+  803ee2:	83 c9 02             	or     $0x2,%ecx
+  803ee5:	f6 c2 02             	test   $0x2,%dl
+  803ee8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803eeb:	89 c1                	mov    %eax,%ecx
+  803eed:	83 c9 01             	or     $0x1,%ecx
+  803ef0:	48 85 d2             	test   %rdx,%rdx
+  803ef3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803ef6:	89 c1                	mov    %eax,%ecx
+  803ef8:	83 c9 40             	or     $0x40,%ecx
+  803efb:	f6 c6 04             	test   $0x4,%dh
+  803efe:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f01:	5d                   	pop    %rbp
+  803f02:	c3                   	ret
+
+0000000000803f03 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f03:	55                   	push   %rbp
+  803f04:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f07:	48 b8 09 3e 80 00 00 	movabs $0x803e09,%rax
+  803f0e:	00 00 00 
+  803f11:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803f13:	48 c1 e8 06          	shr    $0x6,%rax
+  803f17:	83 e0 01             	and    $0x1,%eax
+}
+  803f1a:	5d                   	pop    %rbp
+  803f1b:	c3                   	ret
+
+0000000000803f1c <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803f1c:	55                   	push   %rbp
+  803f1d:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f20:	48 b8 09 3e 80 00 00 	movabs $0x803e09,%rax
+  803f27:	00 00 00 
+  803f2a:	ff d0                	call   *%rax
+  803f2c:	83 e0 01             	and    $0x1,%eax
+}
+  803f2f:	5d                   	pop    %rbp
+  803f30:	c3                   	ret
+
+0000000000803f31 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803f31:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803f38:	01 00 00 
+  803f3b:	a8 01                	test   $0x1,%al
+  803f3d:	75 06                	jne    803f45 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f44:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f45:	55                   	push   %rbp
+  803f46:	48 89 e5             	mov    %rsp,%rbp
+  803f49:	41 57                	push   %r15
+  803f4b:	41 56                	push   %r14
+  803f4d:	41 55                	push   %r13
+  803f4f:	41 54                	push   %r12
+  803f51:	53                   	push   %rbx
+  803f52:	48 83 ec 28          	sub    $0x28,%rsp
+  803f56:	49 89 fe             	mov    %rdi,%r14
+  803f59:	49 89 f7             	mov    %rsi,%r15
+  803f5c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803f63:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803f64:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803f6b:	01 00 00 
+  803f6e:	e9 ae 00 00 00       	jmp    804021 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f73:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f7a:	49 83 ec 01          	sub    $0x1,%r12
+  803f7e:	74 2d                	je     803fad <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803f80:	48 89 d8             	mov    %rbx,%rax
+  803f83:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f87:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803f8c:	f6 c2 01             	test   $0x1,%dl
+  803f8f:	74 e2                	je     803f73 <foreach_shared_region+0x42>
+  803f91:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f96:	f6 c4 04             	test   $0x4,%ah
+  803f99:	74 d8                	je     803f73 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803f9b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803fa2:	4c 89 fa             	mov    %r15,%rdx
+  803fa5:	48 89 df             	mov    %rbx,%rdi
+  803fa8:	41 ff d6             	call   *%r14
+  803fab:	eb c6                	jmp    803f73 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803fad:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803fb4:	00 
+  803fb5:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803fba:	74 4a                	je     804006 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803fbc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fc0:	48 c1 e8 15          	shr    $0x15,%rax
+  803fc4:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803fcb:	01 00 00 
+  803fce:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fd2:	a8 01                	test   $0x1,%al
+  803fd4:	74 d7                	je     803fad <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803fd6:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803fda:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803fe1:	48 39 c3             	cmp    %rax,%rbx
+  803fe4:	73 c7                	jae    803fad <foreach_shared_region+0x7c>
+  803fe6:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803fed:	48 39 d0             	cmp    %rdx,%rax
+  803ff0:	4d 19 e4             	sbb    %r12,%r12
+  803ff3:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803ffa:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804001:	e9 7a ff ff ff       	jmp    803f80 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804006:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80400d:	40 
+  80400e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804012:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804019:	00 00 00 
+  80401c:	48 39 c1             	cmp    %rax,%rcx
+  80401f:	74 50                	je     804071 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804021:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804025:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804029:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804030:	01 00 00 
+  804033:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804037:	a8 01                	test   $0x1,%al
+  804039:	74 cb                	je     804006 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80403b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80403f:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804046:	48 39 c1             	cmp    %rax,%rcx
+  804049:	73 bb                	jae    804006 <foreach_shared_region+0xd5>
+  80404b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804052:	48 39 d0             	cmp    %rdx,%rax
+  804055:	48 19 c0             	sbb    %rax,%rax
+  804058:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80405e:	48 05 00 02 00 00    	add    $0x200,%rax
+  804064:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804068:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80406c:	e9 4b ff ff ff       	jmp    803fbc <foreach_shared_region+0x8b>
+  804071:	b8 00 00 00 00       	mov    $0x0,%eax
+  804076:	48 83 c4 28          	add    $0x28,%rsp
+  80407a:	5b                   	pop    %rbx
+  80407b:	41 5c                	pop    %r12
+  80407d:	41 5d                	pop    %r13
+  80407f:	41 5e                	pop    %r14
+  804081:	41 5f                	pop    %r15
+  804083:	5d                   	pop    %rbp
+  804084:	c3                   	ret
+
+0000000000804085 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804085:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80408b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804092:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804099:	c3                   	ret
+
+000000000080409a <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80409a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80409d:	8b 17                	mov    (%rdi),%edx
+  80409f:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8040a1:	83 f8 0f             	cmp    $0xf,%eax
+  8040a4:	77 13                	ja     8040b9 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8040a6:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040a9:	83 e0 0f             	and    $0xf,%eax
+  8040ac:	48 c1 e0 09          	shl    $0x9,%rax
+  8040b0:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8040b7:	00 
+  8040b8:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8040b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040be:	c3                   	ret
+
+00000000008040bf <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8040bf:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040c2:	83 c0 01             	add    $0x1,%eax
+  8040c5:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040c8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8040ce:	8b 57 04             	mov    0x4(%rdi),%edx
+  8040d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d6:	85 d2                	test   %edx,%edx
+  8040d8:	75 04                	jne    8040de <chan_publish+0x1f>
+  8040da:	83 e0 01             	and    $0x1,%eax
+}
+  8040dd:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8040de:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8040e1:	85 c0                	test   %eax,%eax
+  8040e3:	0f 95 c0             	setne  %al
+  8040e6:	0f b6 c0             	movzbl %al,%eax
+  8040e9:	eb ef                	jmp    8040da <chan_publish+0x1b>
+
+00000000008040eb <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8040eb:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040ee:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8040f0:	29 d0                	sub    %edx,%eax
+  8040f2:	83 e8 01             	sub    $0x1,%eax
+  8040f5:	83 f8 0f             	cmp    $0xf,%eax
+  8040f8:	77 12                	ja     80410c <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8040fa:	8b 07                	mov    (%rdi),%eax
+  8040fc:	83 e0 0f             	and    $0xf,%eax
+  8040ff:	48 c1 e0 09          	shl    $0x9,%rax
+  804103:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80410a:	00 
+  80410b:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80410c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804111:	c3                   	ret
+
+0000000000804112 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804112:	8b 07                	mov    (%rdi),%eax
+  804114:	83 c0 01             	add    $0x1,%eax
+  804117:	89 07                	mov    %eax,(%rdi)
+}
+  804119:	c3                   	ret
+
+000000000080411a <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80411a:	55                   	push   %rbp
+  80411b:	48 89 e5             	mov    %rsp,%rbp
+  80411e:	53                   	push   %rbx
+  80411f:	48 83 ec 08          	sub    $0x8,%rsp
+  804123:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804126:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80412d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804133:	48 b8 eb 40 80 00 00 	movabs $0x8040eb,%rax
+  80413a:	00 00 00 
+  80413d:	ff d0                	call   *%rax
+  80413f:	48 85 c0             	test   %rax,%rax
+  804142:	74 12                	je     804156 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804144:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80414b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804150:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804154:	c9                   	leave
+  804155:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804156:	b8 01 00 00 00       	mov    $0x1,%eax
+  80415b:	eb f3                	jmp    804150 <chan_arm+0x36>
+
+000000000080415d <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80415d:	55                   	push   %rbp
+  80415e:	48 89 e5             	mov    %rsp,%rbp
+  804161:	41 56                	push   %r14
+  804163:	41 55                	push   %r13
+  804165:	41 54                	push   %r12
+  804167:	53                   	push   %rbx
+  804168:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80416b:	49 bc 1a 41 80 00 00 	movabs $0x80411a,%r12
+  804172:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804175:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804179:	49 bd 74 14 80 00 00 	movabs $0x801474,%r13
+  804180:	00 00 00 
+    while (chan_arm(r))
+  804183:	eb 0d                	jmp    804192 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804185:	8b 33                	mov    (%rbx),%esi
+  804187:	ba 00 00 00 00       	mov    $0x0,%edx
+  80418c:	4c 89 f7             	mov    %r14,%rdi
+  80418f:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804192:	48 89 df             	mov    %rbx,%rdi
+  804195:	41 ff d4             	call   *%r12
+  804198:	84 c0                	test   %al,%al
+  80419a:	75 e9                	jne    804185 <chan_wait+0x28>
+}
+  80419c:	5b                   	pop    %rbx
+  80419d:	41 5c                	pop    %r12
+  80419f:	41 5d                	pop    %r13
+  8041a1:	41 5e                	pop    %r14
+  8041a3:	5d                   	pop    %rbp
+  8041a4:	c3                   	ret
+
+00000000008041a5 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8041a5:	55                   	push   %rbp
+  8041a6:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8041a9:	48 83 c7 40          	add    $0x40,%rdi
+  8041ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8041b2:	48 b8 92 14 80 00 00 	movabs $0x801492,%rax
+  8041b9:	00 00 00 
+  8041bc:	ff d0                	call   *%rax
+}
+  8041be:	5d                   	pop    %rbp
+  8041bf:	c3                   	ret
+
+00000000008041c0 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041c5:	c3                   	ret
+
+00000000008041c6 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041c6:	55                   	push   %rbp
+  8041c7:	48 89 e5             	mov    %rsp,%rbp
+  8041ca:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041cd:	48 be 54 4e 80 00 00 	movabs $0x804e54,%rsi
+  8041d4:	00 00 00 
+  8041d7:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  8041de:	00 00 00 
+  8041e1:	ff d0                	call   *%rax
+    return 0;
+}
+  8041e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e8:	5d                   	pop    %rbp
+  8041e9:	c3                   	ret
+
+00000000008041ea <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041ea:	55                   	push   %rbp
+  8041eb:	48 89 e5             	mov    %rsp,%rbp
+  8041ee:	41 57                	push   %r15
+  8041f0:	41 56                	push   %r14
+  8041f2:	41 55                	push   %r13
+  8041f4:	41 54                	push   %r12
+  8041f6:	53                   	push   %rbx
+  8041f7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041fe:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804205:	48 85 d2             	test   %rdx,%rdx
+  804208:	74 7a                	je     804284 <devcons_write+0x9a>
+  80420a:	49 89 d6             	mov    %rdx,%r14
+  80420d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804213:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804218:	49 bf a1 0d 80 00 00 	movabs $0x800da1,%r15
+  80421f:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804222:	4c 89 f3             	mov    %r14,%rbx
+  804225:	48 29 f3             	sub    %rsi,%rbx
+  804228:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80422d:	48 39 c3             	cmp    %rax,%rbx
+  804230:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804234:	4c 63 eb             	movslq %ebx,%r13
+  804237:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80423e:	48 01 c6             	add    %rax,%rsi
+  804241:	4c 89 ea             	mov    %r13,%rdx
+  804244:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80424b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80424e:	4c 89 ee             	mov    %r13,%rsi
+  804251:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804258:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  80425f:	00 00 00 
+  804262:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804264:	41 01 dc             	add    %ebx,%r12d
+  804267:	49 63 f4             	movslq %r12d,%rsi
+  80426a:	4c 39 f6             	cmp    %r14,%rsi
+  80426d:	72 b3                	jb     804222 <devcons_write+0x38>
+    return res;
+  80426f:	49 63 c4             	movslq %r12d,%rax
+}
+  804272:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804279:	5b                   	pop    %rbx
+  80427a:	41 5c                	pop    %r12
+  80427c:	41 5d                	pop    %r13
+  80427e:	41 5e                	pop    %r14
+  804280:	41 5f                	pop    %r15
+  804282:	5d                   	pop    %rbp
+  804283:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804284:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80428a:	eb e3                	jmp    80426f <devcons_write+0x85>
+
+000000000080428c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80428c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80428f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804294:	48 85 c0             	test   %rax,%rax
+  804297:	74 55                	je     8042ee <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804299:	55                   	push   %rbp
+  80429a:	48 89 e5             	mov    %rsp,%rbp
+  80429d:	41 55                	push   %r13
+  80429f:	41 54                	push   %r12
+  8042a1:	53                   	push   %rbx
+  8042a2:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a6:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8042a9:	48 bb ed 0f 80 00 00 	movabs $0x800fed,%rbx
+  8042b0:	00 00 00 
+  8042b3:	49 bc a2 10 80 00 00 	movabs $0x8010a2,%r12
+  8042ba:	00 00 00 
+  8042bd:	eb 03                	jmp    8042c2 <devcons_read+0x36>
+  8042bf:	41 ff d4             	call   *%r12
+  8042c2:	ff d3                	call   *%rbx
+  8042c4:	85 c0                	test   %eax,%eax
+  8042c6:	74 f7                	je     8042bf <devcons_read+0x33>
+    if (c < 0) return c;
+  8042c8:	48 63 d0             	movslq %eax,%rdx
+  8042cb:	78 13                	js     8042e0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042d2:	83 f8 04             	cmp    $0x4,%eax
+  8042d5:	74 09                	je     8042e0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042d7:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042db:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042e0:	48 89 d0             	mov    %rdx,%rax
+  8042e3:	48 83 c4 08          	add    $0x8,%rsp
+  8042e7:	5b                   	pop    %rbx
+  8042e8:	41 5c                	pop    %r12
+  8042ea:	41 5d                	pop    %r13
+  8042ec:	5d                   	pop    %rbp
+  8042ed:	c3                   	ret
+  8042ee:	48 89 d0             	mov    %rdx,%rax
+  8042f1:	c3                   	ret
+
+00000000008042f2 <cputchar>:
+cputchar(int ch) {
+  8042f2:	55                   	push   %rbp
+  8042f3:	48 89 e5             	mov    %rsp,%rbp
+  8042f6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042fa:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042fe:	be 01 00 00 00       	mov    $0x1,%esi
+  804303:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804307:	48 b8 ce 0f 80 00 00 	movabs $0x800fce,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+}
+  804313:	c9                   	leave
+  804314:	c3                   	ret
+
+0000000000804315 <getchar>:
+getchar(void) {
+  804315:	55                   	push   %rbp
+  804316:	48 89 e5             	mov    %rsp,%rbp
+  804319:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80431d:	ba 01 00 00 00       	mov    $0x1,%edx
+  804322:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804326:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432b:	48 b8 71 1a 80 00 00 	movabs $0x801a71,%rax
+  804332:	00 00 00 
+  804335:	ff d0                	call   *%rax
+  804337:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804339:	85 c0                	test   %eax,%eax
+  80433b:	78 06                	js     804343 <getchar+0x2e>
+  80433d:	74 08                	je     804347 <getchar+0x32>
+  80433f:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804343:	89 d0                	mov    %edx,%eax
+  804345:	c9                   	leave
+  804346:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804347:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80434c:	eb f5                	jmp    804343 <getchar+0x2e>
+
+000000000080434e <iscons>:
+iscons(int fdnum) {
+  80434e:	55                   	push   %rbp
+  80434f:	48 89 e5             	mov    %rsp,%rbp
+  804352:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804356:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80435a:	48 b8 8e 17 80 00 00 	movabs $0x80178e,%rax
+  804361:	00 00 00 
+  804364:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804366:	85 c0                	test   %eax,%eax
+  804368:	78 18                	js     804382 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80436a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80436e:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  804375:	00 00 00 
+  804378:	8b 00                	mov    (%rax),%eax
+  80437a:	39 02                	cmp    %eax,(%rdx)
+  80437c:	0f 94 c0             	sete   %al
+  80437f:	0f b6 c0             	movzbl %al,%eax
+}
+  804382:	c9                   	leave
+  804383:	c3                   	ret
+
+0000000000804384 <opencons>:
+opencons(void) {
+  804384:	55                   	push   %rbp
+  804385:	48 89 e5             	mov    %rsp,%rbp
+  804388:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80438c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804390:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  804397:	00 00 00 
+  80439a:	ff d0                	call   *%rax
+  80439c:	85 c0                	test   %eax,%eax
+  80439e:	78 49                	js     8043e9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8043a0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8043a5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043aa:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8043ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043b3:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  8043ba:	00 00 00 
+  8043bd:	ff d0                	call   *%rax
+  8043bf:	85 c0                	test   %eax,%eax
+  8043c1:	78 26                	js     8043e9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043c3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043c7:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8043ce:	00 00 
+  8043d0:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043d2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043d6:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043dd:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  8043e4:	00 00 00 
+  8043e7:	ff d0                	call   *%rax
+}
+  8043e9:	c9                   	leave
+  8043ea:	c3                   	ret
+
+00000000008043eb <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8043eb:	55                   	push   %rbp
+  8043ec:	48 89 e5             	mov    %rsp,%rbp
+  8043ef:	41 56                	push   %r14
+  8043f1:	41 55                	push   %r13
+  8043f3:	41 54                	push   %r12
+  8043f5:	53                   	push   %rbx
+  8043f6:	48 83 ec 50          	sub    $0x50,%rsp
+  8043fa:	49 89 fc             	mov    %rdi,%r12
+  8043fd:	41 89 f5             	mov    %esi,%r13d
+  804400:	48 89 d3             	mov    %rdx,%rbx
+  804403:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804407:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80440b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80440f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804416:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80441a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80441e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804422:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804426:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80442d:	00 00 00 
+  804430:	4c 8b 30             	mov    (%rax),%r14
+  804433:	48 b8 79 10 80 00 00 	movabs $0x801079,%rax
+  80443a:	00 00 00 
+  80443d:	ff d0                	call   *%rax
+  80443f:	89 c6                	mov    %eax,%esi
+  804441:	45 89 e8             	mov    %r13d,%r8d
+  804444:	4c 89 e1             	mov    %r12,%rcx
+  804447:	4c 89 f2             	mov    %r14,%rdx
+  80444a:	48 bf 60 4e 80 00 00 	movabs $0x804e60,%rdi
+  804451:	00 00 00 
+  804454:	b8 00 00 00 00       	mov    $0x0,%eax
+  804459:	49 bc 82 02 80 00 00 	movabs $0x800282,%r12
+  804460:	00 00 00 
+  804463:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804466:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80446a:	48 89 df             	mov    %rbx,%rdi
+  80446d:	48 b8 1e 02 80 00 00 	movabs $0x80021e,%rax
+  804474:	00 00 00 
+  804477:	ff d0                	call   *%rax
+    cprintf("\n");
+  804479:	48 bf a3 4d 80 00 00 	movabs $0x804da3,%rdi
+  804480:	00 00 00 
+  804483:	b8 00 00 00 00       	mov    $0x0,%eax
+  804488:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80448b:	cc                   	int3
+  80448c:	eb fd                	jmp    80448b <_panic+0xa0>
+
+000000000080448e <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80448e:	55                   	push   %rbp
+  80448f:	48 89 e5             	mov    %rsp,%rbp
+  804492:	41 56                	push   %r14
+  804494:	41 55                	push   %r13
+  804496:	41 54                	push   %r12
+  804498:	53                   	push   %rbx
+  804499:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80449c:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044a3:	00 00 00 
+  8044a6:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8044aa:	74 27                	je     8044d3 <_handle_vectored_pagefault+0x45>
+  8044ac:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8044b1:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8044b8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044bb:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8044be:	4c 89 e7             	mov    %r12,%rdi
+  8044c1:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8044c6:	84 c0                	test   %al,%al
+  8044c8:	75 45                	jne    80450f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044ca:	48 83 c3 01          	add    $0x1,%rbx
+  8044ce:	49 3b 1e             	cmp    (%r14),%rbx
+  8044d1:	72 eb                	jb     8044be <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8044d3:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8044da:	00 
+  8044db:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8044e0:	4d 8b 04 24          	mov    (%r12),%r8
+  8044e4:	48 ba 88 4e 80 00 00 	movabs $0x804e88,%rdx
+  8044eb:	00 00 00 
+  8044ee:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8044f3:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  8044fa:	00 00 00 
+  8044fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804502:	49 ba eb 43 80 00 00 	movabs $0x8043eb,%r10
+  804509:	00 00 00 
+  80450c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80450f:	5b                   	pop    %rbx
+  804510:	41 5c                	pop    %r12
+  804512:	41 5d                	pop    %r13
+  804514:	41 5e                	pop    %r14
+  804516:	5d                   	pop    %rbp
+  804517:	c3                   	ret
+
+0000000000804518 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804518:	55                   	push   %rbp
+  804519:	48 89 e5             	mov    %rsp,%rbp
+  80451c:	53                   	push   %rbx
+  80451d:	48 83 ec 08          	sub    $0x8,%rsp
+  804521:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804524:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80452b:	00 00 00 
+  80452e:	80 38 00             	cmpb   $0x0,(%rax)
+  804531:	0f 84 84 00 00 00    	je     8045bb <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804537:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80453e:	00 00 00 
+  804541:	48 8b 10             	mov    (%rax),%rdx
+  804544:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804549:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804550:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804553:	48 85 d2             	test   %rdx,%rdx
+  804556:	74 19                	je     804571 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804558:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80455c:	0f 84 e8 00 00 00    	je     80464a <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804562:	48 83 c0 01          	add    $0x1,%rax
+  804566:	48 39 d0             	cmp    %rdx,%rax
+  804569:	75 ed                	jne    804558 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80456b:	48 83 fa 08          	cmp    $0x8,%rdx
+  80456f:	74 1c                	je     80458d <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804571:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804575:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80457c:	00 00 00 
+  80457f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804586:	00 00 00 
+  804589:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80458d:	48 b8 79 10 80 00 00 	movabs $0x801079,%rax
+  804594:	00 00 00 
+  804597:	ff d0                	call   *%rax
+  804599:	89 c7                	mov    %eax,%edi
+  80459b:	48 be 10 47 80 00 00 	movabs $0x804710,%rsi
+  8045a2:	00 00 00 
+  8045a5:	48 b8 c4 12 80 00 00 	movabs $0x8012c4,%rax
+  8045ac:	00 00 00 
+  8045af:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8045b1:	85 c0                	test   %eax,%eax
+  8045b3:	78 68                	js     80461d <add_pgfault_handler+0x105>
+    return res;
+}
+  8045b5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045b9:	c9                   	leave
+  8045ba:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8045bb:	48 b8 79 10 80 00 00 	movabs $0x801079,%rax
+  8045c2:	00 00 00 
+  8045c5:	ff d0                	call   *%rax
+  8045c7:	89 c7                	mov    %eax,%edi
+  8045c9:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8045ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045d3:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8045da:	00 00 00 
+  8045dd:	48 b8 06 11 80 00 00 	movabs $0x801106,%rax
+  8045e4:	00 00 00 
+  8045e7:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8045e9:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8045f0:	00 00 00 
+  8045f3:	48 8b 02             	mov    (%rdx),%rax
+  8045f6:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8045fa:	48 89 0a             	mov    %rcx,(%rdx)
+  8045fd:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804604:	00 00 00 
+  804607:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80460b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804612:	00 00 00 
+  804615:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804618:	e9 70 ff ff ff       	jmp    80458d <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80461d:	89 c1                	mov    %eax,%ecx
+  80461f:	48 ba c6 4e 80 00 00 	movabs $0x804ec6,%rdx
+  804626:	00 00 00 
+  804629:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80462e:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  804635:	00 00 00 
+  804638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463d:	49 b8 eb 43 80 00 00 	movabs $0x8043eb,%r8
+  804644:	00 00 00 
+  804647:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80464a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464f:	e9 61 ff ff ff       	jmp    8045b5 <add_pgfault_handler+0x9d>
+
+0000000000804654 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804654:	55                   	push   %rbp
+  804655:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804658:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80465f:	00 00 00 
+  804662:	80 38 00             	cmpb   $0x0,(%rax)
+  804665:	74 33                	je     80469a <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804667:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80466e:	00 00 00 
+  804671:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804676:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80467d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804680:	48 85 c0             	test   %rax,%rax
+  804683:	0f 84 85 00 00 00    	je     80470e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804689:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80468d:	74 40                	je     8046cf <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80468f:	48 83 c1 01          	add    $0x1,%rcx
+  804693:	48 39 c1             	cmp    %rax,%rcx
+  804696:	75 f1                	jne    804689 <remove_pgfault_handler+0x35>
+  804698:	eb 74                	jmp    80470e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80469a:	48 b9 de 4e 80 00 00 	movabs $0x804ede,%rcx
+  8046a1:	00 00 00 
+  8046a4:	48 ba 07 4e 80 00 00 	movabs $0x804e07,%rdx
+  8046ab:	00 00 00 
+  8046ae:	be 43 00 00 00       	mov    $0x43,%esi
+  8046b3:	48 bf b8 4e 80 00 00 	movabs $0x804eb8,%rdi
+  8046ba:	00 00 00 
+  8046bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c2:	49 b8 eb 43 80 00 00 	movabs $0x8043eb,%r8
+  8046c9:	00 00 00 
+  8046cc:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8046cf:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8046d6:	00 
+  8046d7:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046db:	48 29 ca             	sub    %rcx,%rdx
+  8046de:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046e5:	00 00 00 
+  8046e8:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8046ec:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8046f1:	48 89 ce             	mov    %rcx,%rsi
+  8046f4:	48 b8 a1 0d 80 00 00 	movabs $0x800da1,%rax
+  8046fb:	00 00 00 
+  8046fe:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804700:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804707:	00 00 00 
+  80470a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80470e:	5d                   	pop    %rbp
+  80470f:	c3                   	ret
+
+0000000000804710 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804710:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804713:	48 b8 8e 44 80 00 00 	movabs $0x80448e,%rax
+  80471a:	00 00 00 
+    call *%rax
+  80471d:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80471f:	41 5f                	pop    %r15
+	popq %r15
+  804721:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804723:	41 5f                	pop    %r15
+	popq %r14
+  804725:	41 5e                	pop    %r14
+	popq %r13
+  804727:	41 5d                	pop    %r13
+	popq %r12
+  804729:	41 5c                	pop    %r12
+	popq %r11
+  80472b:	41 5b                	pop    %r11
+	popq %r10
+  80472d:	41 5a                	pop    %r10
+	popq %r9
+  80472f:	41 59                	pop    %r9
+	popq %r8
+  804731:	41 58                	pop    %r8
+	popq %rsi
+  804733:	5e                   	pop    %rsi
+	popq %rdi
+  804734:	5f                   	pop    %rdi
+	popq %rbp
+  804735:	5d                   	pop    %rbp
+	popq %rdx
+  804736:	5a                   	pop    %rdx
+	popq %rcx
+  804737:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804738:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80473d:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804742:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804746:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804749:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80474e:	5b                   	pop    %rbx
+	popq %rax
+  80474f:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804750:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804754:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804755:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80475a:	c3                   	ret
+  80475b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804760 <__rodata_start>:
+  804760:	25 78 20 72 65       	and    $0x65722078,%eax
+  804765:	63 76 20             	movsxd 0x20(%rsi),%esi
+  804768:	66 72 6f             	data16 jb 8047da <__rodata_start+0x7a>
+  80476b:	6d                   	insl   (%dx),%es:(%rdi)
+  80476c:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258051ea <__bss_end+0x24fc31ea>
+  804772:	78 20                	js     804794 <__rodata_start+0x34>
+  804774:	6c                   	insb   (%dx),%es:(%rdi)
+  804775:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804776:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804777:	70 20                	jo     804799 <__rodata_start+0x39>
+  804779:	73 65                	jae    8047e0 <__rodata_start+0x80>
+  80477b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80477c:	64 69 6e 67 20 74 6f 	imul   $0x206f7420,%fs:0x67(%rsi),%ebp
+  804783:	20 
+  804784:	25 78 0a 00 3c       	and    $0x3c000a78,%eax
+  804789:	75 6e                	jne    8047f9 <__rodata_start+0x99>
+  80478b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80478f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804790:	3e 00 30             	ds add %dh,(%rax)
+  804793:	31 32                	xor    %esi,(%rdx)
+  804795:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80479c:	41                   	rex.B
+  80479d:	42                   	rex.X
+  80479e:	43                   	rex.XB
+  80479f:	44                   	rex.R
+  8047a0:	45                   	rex.RB
+  8047a1:	46 00 30             	rex.RX add %r14b,(%rax)
+  8047a4:	31 32                	xor    %esi,(%rdx)
+  8047a6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8047ad:	61                   	(bad)
+  8047ae:	62 63 64 65 66       	(bad)
+  8047b3:	00 28                	add    %ch,(%rax)
+  8047b5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047b6:	75 6c                	jne    804824 <__rodata_start+0xc4>
+  8047b8:	6c                   	insb   (%dx),%es:(%rdi)
+  8047b9:	29 00                	sub    %eax,(%rax)
+  8047bb:	65 72 72             	gs jb  804830 <__rodata_start+0xd0>
+  8047be:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047bf:	72 20                	jb     8047e1 <__rodata_start+0x81>
+  8047c1:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8047c6:	73 70                	jae    804838 <__rodata_start+0xd8>
+  8047c8:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8047cc:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8047d3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047d4:	72 00                	jb     8047d6 <__rodata_start+0x76>
+  8047d6:	62 61 64 20 65       	(bad)
+  8047db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047dc:	76 69                	jbe    804847 <__rodata_start+0xe7>
+  8047de:	72 6f                	jb     80484f <__rodata_start+0xef>
+  8047e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047e1:	6d                   	insl   (%dx),%es:(%rdi)
+  8047e2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047e4:	74 00                	je     8047e6 <__rodata_start+0x86>
+  8047e6:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8047ed:	20 70 61             	and    %dh,0x61(%rax)
+  8047f0:	72 61                	jb     804853 <__rodata_start+0xf3>
+  8047f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8047f3:	65 74 65             	gs je  80485b <__rodata_start+0xfb>
+  8047f6:	72 00                	jb     8047f8 <__rodata_start+0x98>
+  8047f8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047f9:	75 74                	jne    80486f <__rodata_start+0x10f>
+  8047fb:	20 6f 66             	and    %ch,0x66(%rdi)
+  8047fe:	20 6d 65             	and    %ch,0x65(%rbp)
+  804801:	6d                   	insl   (%dx),%es:(%rdi)
+  804802:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804803:	72 79                	jb     80487e <__rodata_start+0x11e>
+  804805:	00 6f 75             	add    %ch,0x75(%rdi)
+  804808:	74 20                	je     80482a <__rodata_start+0xca>
+  80480a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80480b:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80480f:	76 69                	jbe    80487a <__rodata_start+0x11a>
+  804811:	72 6f                	jb     804882 <__rodata_start+0x122>
+  804813:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804814:	6d                   	insl   (%dx),%es:(%rdi)
+  804815:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804817:	74 73                	je     80488c <__rodata_start+0x12c>
+  804819:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80481c:	72 72                	jb     804890 <__rodata_start+0x130>
+  80481e:	75 70                	jne    804890 <__rodata_start+0x130>
+  804820:	74 65                	je     804887 <__rodata_start+0x127>
+  804822:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804827:	75 67                	jne    804890 <__rodata_start+0x130>
+  804829:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80482c:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80482e:	00 73 65             	add    %dh,0x65(%rbx)
+  804831:	67 6d                	insl   (%dx),%es:(%edi)
+  804833:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804835:	74 61                	je     804898 <__rodata_start+0x138>
+  804837:	74 69                	je     8048a2 <__rodata_start+0x142>
+  804839:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80483a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80483b:	20 66 61             	and    %ah,0x61(%rsi)
+  80483e:	75 6c                	jne    8048ac <__rodata_start+0x14c>
+  804840:	74 00                	je     804842 <__rodata_start+0xe2>
+  804842:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804849:	20 45 4c             	and    %al,0x4c(%rbp)
+  80484c:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804850:	61                   	(bad)
+  804851:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804856:	20 73 75             	and    %dh,0x75(%rbx)
+  804859:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80485c:	73 79                	jae    8048d7 <__rodata_start+0x177>
+  80485e:	73 74                	jae    8048d4 <__rodata_start+0x174>
+  804860:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804862:	20 63 61             	and    %ah,0x61(%rbx)
+  804865:	6c                   	insb   (%dx),%es:(%rdi)
+  804866:	6c                   	insb   (%dx),%es:(%rdi)
+  804867:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80486a:	74 72                	je     8048de <__rodata_start+0x17e>
+  80486c:	79 20                	jns    80488e <__rodata_start+0x12e>
+  80486e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80486f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804870:	74 20                	je     804892 <__rodata_start+0x132>
+  804872:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804874:	75 6e                	jne    8048e4 <__rodata_start+0x184>
+  804876:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80487a:	76 20                	jbe    80489c <__rodata_start+0x13c>
+  80487c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804883:	72 65                	jb     8048ea <__rodata_start+0x18a>
+  804885:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804888:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804889:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80488d:	65 78 70             	gs js  804900 <__rodata_start+0x1a0>
+  804890:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804895:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804898:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80489c:	20 66 69             	and    %ah,0x69(%rsi)
+  80489f:	6c                   	insb   (%dx),%es:(%rdi)
+  8048a0:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8048a4:	20 66 72             	and    %ah,0x72(%rsi)
+  8048a7:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8048ac:	61                   	(bad)
+  8048ad:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8048b0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048b1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048b2:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8048b6:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8048b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048bb:	20 6d 61             	and    %ch,0x61(%rbp)
+  8048be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048bf:	79 20                	jns    8048e1 <__rodata_start+0x181>
+  8048c1:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8048c8:	72 65                	jb     80492f <__rodata_start+0x1cf>
+  8048ca:	20 6f 70             	and    %ch,0x70(%rdi)
+  8048cd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048cf:	00 66 69             	add    %ah,0x69(%rsi)
+  8048d2:	6c                   	insb   (%dx),%es:(%rdi)
+  8048d3:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8048d7:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8048da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048db:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8048de:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048df:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e0:	74 20                	je     804902 <__rodata_start+0x1a2>
+  8048e2:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048e4:	75 6e                	jne    804954 <__rodata_start+0x1f4>
+  8048e6:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8048ea:	76 61                	jbe    80494d <__rodata_start+0x1ed>
+  8048ec:	6c                   	insb   (%dx),%es:(%rdi)
+  8048ed:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8048f4:	00 
+  8048f5:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8048fc:	72 65                	jb     804963 <__rodata_start+0x203>
+  8048fe:	61                   	(bad)
+  8048ff:	64 79 20             	fs jns 804922 <__rodata_start+0x1c2>
+  804902:	65 78 69             	gs js  80496e <__rodata_start+0x20e>
+  804905:	73 74                	jae    80497b <__rodata_start+0x21b>
+  804907:	73 00                	jae    804909 <__rodata_start+0x1a9>
+  804909:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490a:	70 65                	jo     804971 <__rodata_start+0x211>
+  80490c:	72 61                	jb     80496f <__rodata_start+0x20f>
+  80490e:	74 69                	je     804979 <__rodata_start+0x219>
+  804910:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804911:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804912:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804915:	74 20                	je     804937 <__rodata_start+0x1d7>
+  804917:	73 75                	jae    80498e <__rodata_start+0x22e>
+  804919:	70 70                	jo     80498b <__rodata_start+0x22b>
+  80491b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80491c:	72 74                	jb     804992 <__rodata_start+0x232>
+  80491e:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804924:	20 61 67             	and    %ah,0x67(%rcx)
+  804927:	61                   	(bad)
+  804928:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  80492f:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804933:	74 00                	je     804935 <__rodata_start+0x1d5>
+  804935:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80493c:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80493f:	20 75 73             	and    %dh,0x73(%rbp)
+  804942:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804946:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80494d:	00 
+  80494e:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804955:	00 00 00 
+  804958:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80495f:	00 
+  804960:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804961:	04 80                	add    $0x80,%al
+  804963:	00 00                	add    %al,(%rax)
+  804965:	00 00                	add    %al,(%rax)
+  804967:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  80496d:	00 00                	add    %al,(%rax)
+  80496f:	00 a0 0a 80 00 00    	add    %ah,0x800a(%rax)
+  804975:	00 00                	add    %al,(%rax)
+  804977:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  80497d:	00 00                	add    %al,(%rax)
+  80497f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804985:	00 00                	add    %al,(%rax)
+  804987:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  80498d:	00 00                	add    %al,(%rax)
+  80498f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804995:	00 00                	add    %al,(%rax)
+  804997:	00 8e 04 80 00 00    	add    %cl,0x8004(%rsi)
+  80499d:	00 00                	add    %al,(%rax)
+  80499f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  8049a5:	00 00                	add    %al,(%rax)
+  8049a7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  8049ad:	00 00                	add    %al,(%rax)
+  8049af:	00 82 04 80 00 00    	add    %al,0x8004(%rdx)
+  8049b5:	00 00                	add    %al,(%rax)
+  8049b7:	00 fc                	add    %bh,%ah
+  8049b9:	04 80                	add    $0x80,%al
+  8049bb:	00 00                	add    %al,(%rax)
+  8049bd:	00 00                	add    %al,(%rax)
+  8049bf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  8049c5:	00 00                	add    %al,(%rax)
+  8049c7:	00 82 04 80 00 00    	add    %al,0x8004(%rdx)
+  8049cd:	00 00                	add    %al,(%rax)
+  8049cf:	00 c8                	add    %cl,%al
+  8049d1:	04 80                	add    $0x80,%al
+  8049d3:	00 00                	add    %al,(%rax)
+  8049d5:	00 00                	add    %al,(%rax)
+  8049d7:	00 c8                	add    %cl,%al
+  8049d9:	04 80                	add    $0x80,%al
+  8049db:	00 00                	add    %al,(%rax)
+  8049dd:	00 00                	add    %al,(%rax)
+  8049df:	00 c8                	add    %cl,%al
+  8049e1:	04 80                	add    $0x80,%al
+  8049e3:	00 00                	add    %al,(%rax)
+  8049e5:	00 00                	add    %al,(%rax)
+  8049e7:	00 c8                	add    %cl,%al
+  8049e9:	04 80                	add    $0x80,%al
+  8049eb:	00 00                	add    %al,(%rax)
+  8049ed:	00 00                	add    %al,(%rax)
+  8049ef:	00 c8                	add    %cl,%al
+  8049f1:	04 80                	add    $0x80,%al
+  8049f3:	00 00                	add    %al,(%rax)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 c8                	add    %cl,%al
+  8049f9:	04 80                	add    $0x80,%al
+  8049fb:	00 00                	add    %al,(%rax)
+  8049fd:	00 00                	add    %al,(%rax)
+  8049ff:	00 c8                	add    %cl,%al
+  804a01:	04 80                	add    $0x80,%al
+  804a03:	00 00                	add    %al,(%rax)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 c8                	add    %cl,%al
+  804a09:	04 80                	add    $0x80,%al
+  804a0b:	00 00                	add    %al,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 c8                	add    %cl,%al
+  804a11:	04 80                	add    $0x80,%al
+  804a13:	00 00                	add    %al,(%rax)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 d3                	add    %dl,%bl
+  804b09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b0f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 1f                	add    %bl,(%rdi)
+  804b61:	05 80 00 00 00       	add    $0x80,%eax
+  804b66:	00 00                	add    %al,(%rax)
+  804b68:	ee                   	out    %al,(%dx)
+  804b69:	06                   	(bad)
+  804b6a:	80 00 00             	addb   $0x0,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 4e 05             	add    %cl,0x5(%rsi)
+  804b92:	80 00 00             	addb   $0x0,(%rax)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 14 05 80 00 00 00 	add    %dl,0x80(,%rax,1)
+  804bae:	00 00                	add    %al,(%rax)
+  804bb0:	b0 0a                	mov    $0xa,%al
+  804bb2:	80 00 00             	addb   $0x0,(%rax)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 96 08 80 00 00    	add    %dl,0x8008(%rsi)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 60 09             	add    %ah,0x9(%rax)
+  804bca:	80 00 00             	addb   $0x0,(%rax)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 e5                	add    %ah,%ch
+  804be1:	05 80 00 00 00       	add    $0x80,%eax
+  804be6:	00 00                	add    %al,(%rax)
+  804be8:	b0 0a                	mov    $0xa,%al
+  804bea:	80 00 00             	addb   $0x0,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 c2                	add    %al,%dl
+  804bf1:	07                   	(bad)
+  804bf2:	80 00 00             	addb   $0x0,(%rax)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 d3                	add    %dl,%bl
+  804c09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804c0f:	00 b0 0a 80 00 00    	add    %dh,0x800a(%rax)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 78 04             	add    %bh,0x4(%rax)
+  804c1a:	80 00 00             	addb   $0x0,(%rax)
+  804c1d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804c20 <error_string>:
+	...
+  804c28:	c4 47 80 00 00 00 00 00 d6 47 80 00 00 00 00 00     .G.......G......
+  804c38:	e6 47 80 00 00 00 00 00 f8 47 80 00 00 00 00 00     .G.......G......
+  804c48:	06 48 80 00 00 00 00 00 1a 48 80 00 00 00 00 00     .H.......H......
+  804c58:	2f 48 80 00 00 00 00 00 42 48 80 00 00 00 00 00     /H......BH......
+  804c68:	54 48 80 00 00 00 00 00 68 48 80 00 00 00 00 00     TH......hH......
+  804c78:	78 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     xH.......H......
+  804c88:	a2 48 80 00 00 00 00 00 b8 48 80 00 00 00 00 00     .H.......H......
+  804c98:	d0 48 80 00 00 00 00 00 e8 48 80 00 00 00 00 00     .H.......H......
+  804ca8:	f5 48 80 00 00 00 00 00 d8 4c 80 00 00 00 00 00     .H.......L......
+  804cb8:	09 49 80 00 00 00 00 00 21 49 80 00 00 00 00 00     .I......!I......
+  804cc8:	2b 49 80 00 00 00 00 00 35 49 80 00 00 00 00 00     +I......5I......
+  804cd8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804ce8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804cf8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804d08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804d18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  804d28:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  804d38:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  804d48:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804d58:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804d68:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804d78:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804d88:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804d98:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804da8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804db8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804dc8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804dd8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804de0 <devtab>:
+  804de0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804df0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804e00:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804e10:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804e20:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804e30:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804e40:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804e50:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804e60:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804e70:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804e80:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804e90:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804ea0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804eb0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804ec0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804ed0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804ee0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804ef0:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  804f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,8245 @@
+
+obj/user/faultalloc:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0c 01 00 00       	call   80012f <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- alloc pages to fix faults */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 90 47 80 00 00 	movabs $0x804790,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 55 03 80 00 00 	movabs $0x800355,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba e8 47 80 00 00 	movabs $0x8047e8,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 ff 0b 80 00 00 	movabs $0x800bff,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba b8 47 80 00 00 	movabs $0x8047b8,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0d 00 00 00       	mov    $0xd,%esi
+  8000bf:	48 bf 9b 47 80 00 00 	movabs $0x80479b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+  8000df:	41 54                	push   %r12
+  8000e1:	53                   	push   %rbx
+    add_pgfault_handler(handler);
+  8000e2:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e9:	00 00 00 
+  8000ec:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+    cprintf("%s\n", (char *)0xBeefDead);
+  8000f8:	be ad de ef be       	mov    $0xbeefdead,%esi
+  8000fd:	49 bc ad 47 80 00 00 	movabs $0x8047ad,%r12
+  800104:	00 00 00 
+  800107:	4c 89 e7             	mov    %r12,%rdi
+  80010a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010f:	48 bb 55 03 80 00 00 	movabs $0x800355,%rbx
+  800116:	00 00 00 
+  800119:	ff d3                	call   *%rbx
+    cprintf("%s\n", (char *)0xCafeBffe);
+  80011b:	be fe bf fe ca       	mov    $0xcafebffe,%esi
+  800120:	4c 89 e7             	mov    %r12,%rdi
+  800123:	b8 00 00 00 00       	mov    $0x0,%eax
+  800128:	ff d3                	call   *%rbx
+}
+  80012a:	5b                   	pop    %rbx
+  80012b:	41 5c                	pop    %r12
+  80012d:	5d                   	pop    %rbp
+  80012e:	c3                   	ret
+
+000000000080012f <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80012f:	55                   	push   %rbp
+  800130:	48 89 e5             	mov    %rsp,%rbp
+  800133:	41 56                	push   %r14
+  800135:	41 55                	push   %r13
+  800137:	41 54                	push   %r12
+  800139:	53                   	push   %rbx
+  80013a:	41 89 fd             	mov    %edi,%r13d
+  80013d:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800140:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800147:	00 00 00 
+  80014a:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800151:	00 00 00 
+  800154:	48 39 c2             	cmp    %rax,%rdx
+  800157:	73 17                	jae    800170 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800159:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80015c:	49 89 c4             	mov    %rax,%r12
+  80015f:	48 83 c3 08          	add    $0x8,%rbx
+  800163:	b8 00 00 00 00       	mov    $0x0,%eax
+  800168:	ff 53 f8             	call   *-0x8(%rbx)
+  80016b:	4c 39 e3             	cmp    %r12,%rbx
+  80016e:	72 ef                	jb     80015f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800170:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	89 c2                	mov    %eax,%edx
+  80017e:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800184:	48 89 d0             	mov    %rdx,%rax
+  800187:	48 c1 e0 04          	shl    $0x4,%rax
+  80018b:	48 29 d0             	sub    %rdx,%rax
+  80018e:	48 c1 e0 05          	shl    $0x5,%rax
+  800192:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800199:	00 00 00 
+  80019c:	48 01 d0             	add    %rdx,%rax
+  80019f:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001a6:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001a9:	45 85 ed             	test   %r13d,%r13d
+  8001ac:	7e 0d                	jle    8001bb <libmain+0x8c>
+  8001ae:	49 8b 06             	mov    (%r14),%rax
+  8001b1:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8001b8:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001bb:	4c 89 f6             	mov    %r14,%rsi
+  8001be:	44 89 ef             	mov    %r13d,%edi
+  8001c1:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001cd:	48 b8 e2 01 80 00 00 	movabs $0x8001e2,%rax
+  8001d4:	00 00 00 
+  8001d7:	ff d0                	call   *%rax
+#endif
+}
+  8001d9:	5b                   	pop    %rbx
+  8001da:	41 5c                	pop    %r12
+  8001dc:	41 5d                	pop    %r13
+  8001de:	41 5e                	pop    %r14
+  8001e0:	5d                   	pop    %rbp
+  8001e1:	c3                   	ret
+
+00000000008001e2 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001e2:	55                   	push   %rbp
+  8001e3:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001e6:	48 b8 ff 1a 80 00 00 	movabs $0x801aff,%rax
+  8001ed:	00 00 00 
+  8001f0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001f7:	48 b8 e9 10 80 00 00 	movabs $0x8010e9,%rax
+  8001fe:	00 00 00 
+  800201:	ff d0                	call   *%rax
+}
+  800203:	5d                   	pop    %rbp
+  800204:	c3                   	ret
+
+0000000000800205 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800205:	55                   	push   %rbp
+  800206:	48 89 e5             	mov    %rsp,%rbp
+  800209:	41 56                	push   %r14
+  80020b:	41 55                	push   %r13
+  80020d:	41 54                	push   %r12
+  80020f:	53                   	push   %rbx
+  800210:	48 83 ec 50          	sub    $0x50,%rsp
+  800214:	49 89 fc             	mov    %rdi,%r12
+  800217:	41 89 f5             	mov    %esi,%r13d
+  80021a:	48 89 d3             	mov    %rdx,%rbx
+  80021d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800221:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800225:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800229:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800230:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800234:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800238:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80023c:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800240:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800247:	00 00 00 
+  80024a:	4c 8b 30             	mov    (%rax),%r14
+  80024d:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+  800259:	89 c6                	mov    %eax,%esi
+  80025b:	45 89 e8             	mov    %r13d,%r8d
+  80025e:	4c 89 e1             	mov    %r12,%rcx
+  800261:	4c 89 f2             	mov    %r14,%rdx
+  800264:	48 bf 18 48 80 00 00 	movabs $0x804818,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 bc 55 03 80 00 00 	movabs $0x800355,%r12
+  80027a:	00 00 00 
+  80027d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800280:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800284:	48 89 df             	mov    %rbx,%rdi
+  800287:	48 b8 f1 02 80 00 00 	movabs $0x8002f1,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+    cprintf("\n");
+  800293:	48 bf ab 4e 80 00 00 	movabs $0x804eab,%rdi
+  80029a:	00 00 00 
+  80029d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a2:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8002a5:	cc                   	int3
+  8002a6:	eb fd                	jmp    8002a5 <_panic+0xa0>
+
+00000000008002a8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8002a8:	55                   	push   %rbp
+  8002a9:	48 89 e5             	mov    %rsp,%rbp
+  8002ac:	53                   	push   %rbx
+  8002ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8002b1:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8002b4:	8b 06                	mov    (%rsi),%eax
+  8002b6:	8d 50 01             	lea    0x1(%rax),%edx
+  8002b9:	89 16                	mov    %edx,(%rsi)
+  8002bb:	48 98                	cltq
+  8002bd:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002c2:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002c8:	74 0a                	je     8002d4 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002ca:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ce:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002d2:	c9                   	leave
+  8002d3:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002d4:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002d8:	be ff 00 00 00       	mov    $0xff,%esi
+  8002dd:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002e9:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002ef:	eb d9                	jmp    8002ca <putch+0x22>
+
+00000000008002f1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002f1:	55                   	push   %rbp
+  8002f2:	48 89 e5             	mov    %rsp,%rbp
+  8002f5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002fc:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002ff:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800306:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800313:	48 89 f1             	mov    %rsi,%rcx
+  800316:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80031d:	48 bf a8 02 80 00 00 	movabs $0x8002a8,%rdi
+  800324:	00 00 00 
+  800327:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  80032e:	00 00 00 
+  800331:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800333:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80033a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800341:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  800348:	00 00 00 
+  80034b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80034d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800353:	c9                   	leave
+  800354:	c3                   	ret
+
+0000000000800355 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800355:	55                   	push   %rbp
+  800356:	48 89 e5             	mov    %rsp,%rbp
+  800359:	48 83 ec 50          	sub    $0x50,%rsp
+  80035d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800361:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800365:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800369:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80036d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800371:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800378:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80037c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800380:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800384:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800388:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80038c:	48 b8 f1 02 80 00 00 	movabs $0x8002f1,%rax
+  800393:	00 00 00 
+  800396:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800398:	c9                   	leave
+  800399:	c3                   	ret
+
+000000000080039a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80039a:	55                   	push   %rbp
+  80039b:	48 89 e5             	mov    %rsp,%rbp
+  80039e:	41 57                	push   %r15
+  8003a0:	41 56                	push   %r14
+  8003a2:	41 55                	push   %r13
+  8003a4:	41 54                	push   %r12
+  8003a6:	53                   	push   %rbx
+  8003a7:	48 83 ec 18          	sub    $0x18,%rsp
+  8003ab:	49 89 fc             	mov    %rdi,%r12
+  8003ae:	49 89 f5             	mov    %rsi,%r13
+  8003b1:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8003b5:	8b 45 10             	mov    0x10(%rbp),%eax
+  8003b8:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8003bb:	41 89 cf             	mov    %ecx,%r15d
+  8003be:	4c 39 fa             	cmp    %r15,%rdx
+  8003c1:	73 5b                	jae    80041e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003c3:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003c7:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003cb:	85 db                	test   %ebx,%ebx
+  8003cd:	7e 0e                	jle    8003dd <print_num+0x43>
+            putch(padc, put_arg);
+  8003cf:	4c 89 ee             	mov    %r13,%rsi
+  8003d2:	44 89 f7             	mov    %r14d,%edi
+  8003d5:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003d8:	83 eb 01             	sub    $0x1,%ebx
+  8003db:	75 f2                	jne    8003cf <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003dd:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003e1:	48 b9 4c 48 80 00 00 	movabs $0x80484c,%rcx
+  8003e8:	00 00 00 
+  8003eb:	48 b8 3b 48 80 00 00 	movabs $0x80483b,%rax
+  8003f2:	00 00 00 
+  8003f5:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003f9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800402:	49 f7 f7             	div    %r15
+  800405:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800409:	4c 89 ee             	mov    %r13,%rsi
+  80040c:	41 ff d4             	call   *%r12
+}
+  80040f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800413:	5b                   	pop    %rbx
+  800414:	41 5c                	pop    %r12
+  800416:	41 5d                	pop    %r13
+  800418:	41 5e                	pop    %r14
+  80041a:	41 5f                	pop    %r15
+  80041c:	5d                   	pop    %rbp
+  80041d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80041e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800422:	ba 00 00 00 00       	mov    $0x0,%edx
+  800427:	49 f7 f7             	div    %r15
+  80042a:	48 83 ec 08          	sub    $0x8,%rsp
+  80042e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800432:	52                   	push   %rdx
+  800433:	45 0f be c9          	movsbl %r9b,%r9d
+  800437:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80043b:	48 89 c2             	mov    %rax,%rdx
+  80043e:	48 b8 9a 03 80 00 00 	movabs $0x80039a,%rax
+  800445:	00 00 00 
+  800448:	ff d0                	call   *%rax
+  80044a:	48 83 c4 10          	add    $0x10,%rsp
+  80044e:	eb 8d                	jmp    8003dd <print_num+0x43>
+
+0000000000800450 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800450:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800454:	48 8b 06             	mov    (%rsi),%rax
+  800457:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80045b:	73 0a                	jae    800467 <sprintputch+0x17>
+        *state->start++ = ch;
+  80045d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800461:	48 89 16             	mov    %rdx,(%rsi)
+  800464:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800467:	c3                   	ret
+
+0000000000800468 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800468:	55                   	push   %rbp
+  800469:	48 89 e5             	mov    %rsp,%rbp
+  80046c:	48 83 ec 50          	sub    $0x50,%rsp
+  800470:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800474:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800478:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80047c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800483:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800487:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80048f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800493:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800497:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+}
+  8004a3:	c9                   	leave
+  8004a4:	c3                   	ret
+
+00000000008004a5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	41 57                	push   %r15
+  8004ab:	41 56                	push   %r14
+  8004ad:	41 55                	push   %r13
+  8004af:	41 54                	push   %r12
+  8004b1:	53                   	push   %rbx
+  8004b2:	48 83 ec 38          	sub    $0x38,%rsp
+  8004b6:	49 89 fe             	mov    %rdi,%r14
+  8004b9:	49 89 f5             	mov    %rsi,%r13
+  8004bc:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8004bf:	48 8b 01             	mov    (%rcx),%rax
+  8004c2:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004c6:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ce:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004d2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004d6:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004da:	0f b6 3b             	movzbl (%rbx),%edi
+  8004dd:	40 80 ff 25          	cmp    $0x25,%dil
+  8004e1:	74 18                	je     8004fb <vprintfmt+0x56>
+            if (!ch) return;
+  8004e3:	40 84 ff             	test   %dil,%dil
+  8004e6:	0f 84 b1 06 00 00    	je     800b9d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004ec:	40 0f b6 ff          	movzbl %dil,%edi
+  8004f0:	4c 89 ee             	mov    %r13,%rsi
+  8004f3:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004f6:	4c 89 e3             	mov    %r12,%rbx
+  8004f9:	eb db                	jmp    8004d6 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004fb:	be 00 00 00 00       	mov    $0x0,%esi
+  800500:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800504:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800509:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80050f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800516:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80051a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80051f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800524:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800527:	83 e8 23             	sub    $0x23,%eax
+  80052a:	3c 57                	cmp    $0x57,%al
+  80052c:	0f 87 51 06 00 00    	ja     800b83 <vprintfmt+0x6de>
+  800532:	0f b6 c0             	movzbl %al,%eax
+  800535:	48 b9 00 4a 80 00 00 	movabs $0x804a00,%rcx
+  80053c:	00 00 00 
+  80053f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800542:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800545:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800549:	eb cf                	jmp    80051a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80054b:	49 89 dc             	mov    %rbx,%r12
+  80054e:	be 01 00 00 00       	mov    $0x1,%esi
+  800553:	eb c5                	jmp    80051a <vprintfmt+0x75>
+            padc = ch;
+  800555:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800559:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80055c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055f:	eb b9                	jmp    80051a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800561:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800564:	83 f8 2f             	cmp    $0x2f,%eax
+  800567:	77 24                	ja     80058d <vprintfmt+0xe8>
+  800569:	89 c1                	mov    %eax,%ecx
+  80056b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80056f:	83 c0 08             	add    $0x8,%eax
+  800572:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800575:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800578:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80057b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80057f:	79 99                	jns    80051a <vprintfmt+0x75>
+                width = precision;
+  800581:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800585:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80058b:	eb 8d                	jmp    80051a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80058d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800591:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800595:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800599:	eb da                	jmp    800575 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80059b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005a0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005a4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8005aa:	3c 39                	cmp    $0x39,%al
+  8005ac:	77 1c                	ja     8005ca <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8005ae:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8005b2:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8005b6:	0f b6 c0             	movzbl %al,%eax
+  8005b9:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8005be:	0f b6 03             	movzbl (%rbx),%eax
+  8005c1:	3c 39                	cmp    $0x39,%al
+  8005c3:	76 e9                	jbe    8005ae <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005c5:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005c8:	eb b1                	jmp    80057b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005ca:	49 89 dc             	mov    %rbx,%r12
+  8005cd:	eb ac                	jmp    80057b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005cf:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005d2:	85 c9                	test   %ecx,%ecx
+  8005d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d9:	0f 49 c1             	cmovns %ecx,%eax
+  8005dc:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005df:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005e2:	e9 33 ff ff ff       	jmp    80051a <vprintfmt+0x75>
+            lflag++;
+  8005e7:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005ea:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ed:	e9 28 ff ff ff       	jmp    80051a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8005f8:	77 19                	ja     800613 <vprintfmt+0x16e>
+  8005fa:	89 c2                	mov    %eax,%edx
+  8005fc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800600:	83 c0 08             	add    $0x8,%eax
+  800603:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800606:	8b 3a                	mov    (%rdx),%edi
+  800608:	4c 89 ee             	mov    %r13,%rsi
+  80060b:	41 ff d6             	call   *%r14
+            break;
+  80060e:	e9 c3 fe ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800613:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800617:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80061b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80061f:	eb e5                	jmp    800606 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800621:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800624:	83 f8 2f             	cmp    $0x2f,%eax
+  800627:	77 5a                	ja     800683 <vprintfmt+0x1de>
+  800629:	89 c2                	mov    %eax,%edx
+  80062b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80062f:	83 c0 08             	add    $0x8,%eax
+  800632:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800635:	8b 02                	mov    (%rdx),%eax
+  800637:	89 c1                	mov    %eax,%ecx
+  800639:	f7 d9                	neg    %ecx
+  80063b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80063e:	83 f9 16             	cmp    $0x16,%ecx
+  800641:	7f 4e                	jg     800691 <vprintfmt+0x1ec>
+  800643:	48 63 c1             	movslq %ecx,%rax
+  800646:	48 ba c0 4c 80 00 00 	movabs $0x804cc0,%rdx
+  80064d:	00 00 00 
+  800650:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800654:	48 85 c0             	test   %rax,%rax
+  800657:	74 38                	je     800691 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800659:	48 89 c1             	mov    %rax,%rcx
+  80065c:	48 ba 4a 4e 80 00 00 	movabs $0x804e4a,%rdx
+  800663:	00 00 00 
+  800666:	4c 89 ee             	mov    %r13,%rsi
+  800669:	4c 89 f7             	mov    %r14,%rdi
+  80066c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800671:	49 b8 68 04 80 00 00 	movabs $0x800468,%r8
+  800678:	00 00 00 
+  80067b:	41 ff d0             	call   *%r8
+  80067e:	e9 53 fe ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800683:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800687:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80068b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068f:	eb a4                	jmp    800635 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800691:	48 ba 64 48 80 00 00 	movabs $0x804864,%rdx
+  800698:	00 00 00 
+  80069b:	4c 89 ee             	mov    %r13,%rsi
+  80069e:	4c 89 f7             	mov    %r14,%rdi
+  8006a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a6:	49 b8 68 04 80 00 00 	movabs $0x800468,%r8
+  8006ad:	00 00 00 
+  8006b0:	41 ff d0             	call   *%r8
+  8006b3:	e9 1e fe ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006be:	77 6c                	ja     80072c <vprintfmt+0x287>
+  8006c0:	89 c2                	mov    %eax,%edx
+  8006c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006c6:	83 c0 08             	add    $0x8,%eax
+  8006c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006cc:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006cf:	48 85 d2             	test   %rdx,%rdx
+  8006d2:	48 b8 5d 48 80 00 00 	movabs $0x80485d,%rax
+  8006d9:	00 00 00 
+  8006dc:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006e0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006e4:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006e8:	7e 06                	jle    8006f0 <vprintfmt+0x24b>
+  8006ea:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006ee:	75 4a                	jne    80073a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006f0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006f4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006f8:	0f b6 00             	movzbl (%rax),%eax
+  8006fb:	84 c0                	test   %al,%al
+  8006fd:	0f 85 9a 00 00 00    	jne    80079d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800703:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800706:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80070a:	85 c0                	test   %eax,%eax
+  80070c:	0f 8e c4 fd ff ff    	jle    8004d6 <vprintfmt+0x31>
+  800712:	4c 89 ee             	mov    %r13,%rsi
+  800715:	bf 20 00 00 00       	mov    $0x20,%edi
+  80071a:	41 ff d6             	call   *%r14
+  80071d:	41 83 ec 01          	sub    $0x1,%r12d
+  800721:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800725:	75 eb                	jne    800712 <vprintfmt+0x26d>
+  800727:	e9 aa fd ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80072c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800730:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800734:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800738:	eb 92                	jmp    8006cc <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80073a:	49 63 f7             	movslq %r15d,%rsi
+  80073d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800741:	48 b8 57 0c 80 00 00 	movabs $0x800c57,%rax
+  800748:	00 00 00 
+  80074b:	ff d0                	call   *%rax
+  80074d:	48 89 c2             	mov    %rax,%rdx
+  800750:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800753:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800755:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800758:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80075b:	85 c0                	test   %eax,%eax
+  80075d:	7e 91                	jle    8006f0 <vprintfmt+0x24b>
+  80075f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800764:	4c 89 ee             	mov    %r13,%rsi
+  800767:	44 89 e7             	mov    %r12d,%edi
+  80076a:	41 ff d6             	call   *%r14
+  80076d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800771:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800774:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800777:	75 eb                	jne    800764 <vprintfmt+0x2bf>
+  800779:	e9 72 ff ff ff       	jmp    8006f0 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80077e:	0f b6 f8             	movzbl %al,%edi
+  800781:	4c 89 ee             	mov    %r13,%rsi
+  800784:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800787:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80078b:	49 83 c4 01          	add    $0x1,%r12
+  80078f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800795:	84 c0                	test   %al,%al
+  800797:	0f 84 66 ff ff ff    	je     800703 <vprintfmt+0x25e>
+  80079d:	45 85 ff             	test   %r15d,%r15d
+  8007a0:	78 0a                	js     8007ac <vprintfmt+0x307>
+  8007a2:	41 83 ef 01          	sub    $0x1,%r15d
+  8007a6:	0f 88 57 ff ff ff    	js     800703 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007ac:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8007b0:	74 cc                	je     80077e <vprintfmt+0x2d9>
+  8007b2:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8007b5:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8007ba:	80 fa 5e             	cmp    $0x5e,%dl
+  8007bd:	77 c2                	ja     800781 <vprintfmt+0x2dc>
+  8007bf:	eb bd                	jmp    80077e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8007c1:	40 84 f6             	test   %sil,%sil
+  8007c4:	75 26                	jne    8007ec <vprintfmt+0x347>
+    switch (lflag) {
+  8007c6:	85 d2                	test   %edx,%edx
+  8007c8:	74 59                	je     800823 <vprintfmt+0x37e>
+  8007ca:	83 fa 01             	cmp    $0x1,%edx
+  8007cd:	74 7b                	je     80084a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d5:	0f 87 96 00 00 00    	ja     800871 <vprintfmt+0x3cc>
+  8007db:	89 c2                	mov    %eax,%edx
+  8007dd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e1:	83 c0 08             	add    $0x8,%eax
+  8007e4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007e7:	4c 8b 22             	mov    (%rdx),%r12
+  8007ea:	eb 17                	jmp    800803 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f2:	77 21                	ja     800815 <vprintfmt+0x370>
+  8007f4:	89 c2                	mov    %eax,%edx
+  8007f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fa:	83 c0 08             	add    $0x8,%eax
+  8007fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800800:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800803:	4d 85 e4             	test   %r12,%r12
+  800806:	78 7a                	js     800882 <vprintfmt+0x3dd>
+            num = i;
+  800808:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80080b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800810:	e9 50 02 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800815:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800819:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80081d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800821:	eb dd                	jmp    800800 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800823:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800826:	83 f8 2f             	cmp    $0x2f,%eax
+  800829:	77 11                	ja     80083c <vprintfmt+0x397>
+  80082b:	89 c2                	mov    %eax,%edx
+  80082d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800831:	83 c0 08             	add    $0x8,%eax
+  800834:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800837:	4c 63 22             	movslq (%rdx),%r12
+  80083a:	eb c7                	jmp    800803 <vprintfmt+0x35e>
+  80083c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800840:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800844:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800848:	eb ed                	jmp    800837 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80084a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084d:	83 f8 2f             	cmp    $0x2f,%eax
+  800850:	77 11                	ja     800863 <vprintfmt+0x3be>
+  800852:	89 c2                	mov    %eax,%edx
+  800854:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800858:	83 c0 08             	add    $0x8,%eax
+  80085b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085e:	4c 8b 22             	mov    (%rdx),%r12
+  800861:	eb a0                	jmp    800803 <vprintfmt+0x35e>
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb ed                	jmp    80085e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800871:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800875:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800879:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087d:	e9 65 ff ff ff       	jmp    8007e7 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800882:	4c 89 ee             	mov    %r13,%rsi
+  800885:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80088a:	41 ff d6             	call   *%r14
+                i = -i;
+  80088d:	49 f7 dc             	neg    %r12
+  800890:	e9 73 ff ff ff       	jmp    800808 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800895:	40 84 f6             	test   %sil,%sil
+  800898:	75 32                	jne    8008cc <vprintfmt+0x427>
+    switch (lflag) {
+  80089a:	85 d2                	test   %edx,%edx
+  80089c:	74 5d                	je     8008fb <vprintfmt+0x456>
+  80089e:	83 fa 01             	cmp    $0x1,%edx
+  8008a1:	0f 84 82 00 00 00    	je     800929 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8008a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ad:	0f 87 a5 00 00 00    	ja     800958 <vprintfmt+0x4b3>
+  8008b3:	89 c2                	mov    %eax,%edx
+  8008b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b9:	83 c0 08             	add    $0x8,%eax
+  8008bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008c7:	e9 99 01 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d2:	77 19                	ja     8008ed <vprintfmt+0x448>
+  8008d4:	89 c2                	mov    %eax,%edx
+  8008d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008da:	83 c0 08             	add    $0x8,%eax
+  8008dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008e0:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008e3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008e8:	e9 78 01 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+  8008ed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f9:	eb e5                	jmp    8008e0 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008fb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fe:	83 f8 2f             	cmp    $0x2f,%eax
+  800901:	77 18                	ja     80091b <vprintfmt+0x476>
+  800903:	89 c2                	mov    %eax,%edx
+  800905:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800909:	83 c0 08             	add    $0x8,%eax
+  80090c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800911:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800916:	e9 4a 01 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+  80091b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800923:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800927:	eb e6                	jmp    80090f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800929:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092c:	83 f8 2f             	cmp    $0x2f,%eax
+  80092f:	77 19                	ja     80094a <vprintfmt+0x4a5>
+  800931:	89 c2                	mov    %eax,%edx
+  800933:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800937:	83 c0 08             	add    $0x8,%eax
+  80093a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800940:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800945:	e9 1b 01 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+  80094a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800952:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800956:	eb e5                	jmp    80093d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	e9 56 ff ff ff       	jmp    8008bf <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800969:	40 84 f6             	test   %sil,%sil
+  80096c:	75 2e                	jne    80099c <vprintfmt+0x4f7>
+    switch (lflag) {
+  80096e:	85 d2                	test   %edx,%edx
+  800970:	74 59                	je     8009cb <vprintfmt+0x526>
+  800972:	83 fa 01             	cmp    $0x1,%edx
+  800975:	74 7f                	je     8009f6 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	0f 87 9f 00 00 00    	ja     800a22 <vprintfmt+0x57d>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800992:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800997:	e9 c9 00 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80099c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099f:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a2:	77 19                	ja     8009bd <vprintfmt+0x518>
+  8009a4:	89 c2                	mov    %eax,%edx
+  8009a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009aa:	83 c0 08             	add    $0x8,%eax
+  8009ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009b3:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b8:	e9 a8 00 00 00       	jmp    800a65 <vprintfmt+0x5c0>
+  8009bd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c9:	eb e5                	jmp    8009b0 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d1:	77 15                	ja     8009e8 <vprintfmt+0x543>
+  8009d3:	89 c2                	mov    %eax,%edx
+  8009d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d9:	83 c0 08             	add    $0x8,%eax
+  8009dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009df:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009e1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e6:	eb 7d                	jmp    800a65 <vprintfmt+0x5c0>
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	eb e9                	jmp    8009df <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	77 16                	ja     800a14 <vprintfmt+0x56f>
+  8009fe:	89 c2                	mov    %eax,%edx
+  800a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a04:	83 c0 08             	add    $0x8,%eax
+  800a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a0d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a12:	eb 51                	jmp    800a65 <vprintfmt+0x5c0>
+  800a14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a20:	eb e8                	jmp    800a0a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a2e:	e9 5c ff ff ff       	jmp    80098f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a33:	4c 89 ee             	mov    %r13,%rsi
+  800a36:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a3b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a3e:	4c 89 ee             	mov    %r13,%rsi
+  800a41:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a46:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a49:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a4c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4f:	77 47                	ja     800a98 <vprintfmt+0x5f3>
+  800a51:	89 c2                	mov    %eax,%edx
+  800a53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a57:	83 c0 08             	add    $0x8,%eax
+  800a5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a60:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a65:	48 83 ec 08          	sub    $0x8,%rsp
+  800a69:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a6d:	0f 94 c0             	sete   %al
+  800a70:	0f b6 c0             	movzbl %al,%eax
+  800a73:	50                   	push   %rax
+  800a74:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a79:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a7d:	4c 89 ee             	mov    %r13,%rsi
+  800a80:	4c 89 f7             	mov    %r14,%rdi
+  800a83:	48 b8 9a 03 80 00 00 	movabs $0x80039a,%rax
+  800a8a:	00 00 00 
+  800a8d:	ff d0                	call   *%rax
+            break;
+  800a8f:	48 83 c4 10          	add    $0x10,%rsp
+  800a93:	e9 3e fa ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa4:	eb b7                	jmp    800a5d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa6:	40 84 f6             	test   %sil,%sil
+  800aa9:	75 2b                	jne    800ad6 <vprintfmt+0x631>
+    switch (lflag) {
+  800aab:	85 d2                	test   %edx,%edx
+  800aad:	74 56                	je     800b05 <vprintfmt+0x660>
+  800aaf:	83 fa 01             	cmp    $0x1,%edx
+  800ab2:	74 7f                	je     800b33 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800ab4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aba:	0f 87 a2 00 00 00    	ja     800b62 <vprintfmt+0x6bd>
+  800ac0:	89 c2                	mov    %eax,%edx
+  800ac2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac6:	83 c0 08             	add    $0x8,%eax
+  800ac9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acc:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800acf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ad4:	eb 8f                	jmp    800a65 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ad6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad9:	83 f8 2f             	cmp    $0x2f,%eax
+  800adc:	77 19                	ja     800af7 <vprintfmt+0x652>
+  800ade:	89 c2                	mov    %eax,%edx
+  800ae0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae4:	83 c0 08             	add    $0x8,%eax
+  800ae7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aea:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aed:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800af2:	e9 6e ff ff ff       	jmp    800a65 <vprintfmt+0x5c0>
+  800af7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800afb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aff:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b03:	eb e5                	jmp    800aea <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b08:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0b:	77 18                	ja     800b25 <vprintfmt+0x680>
+  800b0d:	89 c2                	mov    %eax,%edx
+  800b0f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b13:	83 c0 08             	add    $0x8,%eax
+  800b16:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b19:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b1b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b20:	e9 40 ff ff ff       	jmp    800a65 <vprintfmt+0x5c0>
+  800b25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b31:	eb e6                	jmp    800b19 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b36:	83 f8 2f             	cmp    $0x2f,%eax
+  800b39:	77 19                	ja     800b54 <vprintfmt+0x6af>
+  800b3b:	89 c2                	mov    %eax,%edx
+  800b3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b41:	83 c0 08             	add    $0x8,%eax
+  800b44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b4f:	e9 11 ff ff ff       	jmp    800a65 <vprintfmt+0x5c0>
+  800b54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b60:	eb e5                	jmp    800b47 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6e:	e9 59 ff ff ff       	jmp    800acc <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b73:	4c 89 ee             	mov    %r13,%rsi
+  800b76:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b7b:	41 ff d6             	call   *%r14
+            break;
+  800b7e:	e9 53 f9 ff ff       	jmp    8004d6 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b83:	4c 89 ee             	mov    %r13,%rsi
+  800b86:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b8b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b8e:	48 83 eb 01          	sub    $0x1,%rbx
+  800b92:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b96:	75 f6                	jne    800b8e <vprintfmt+0x6e9>
+  800b98:	e9 39 f9 ff ff       	jmp    8004d6 <vprintfmt+0x31>
+}
+  800b9d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ba1:	5b                   	pop    %rbx
+  800ba2:	41 5c                	pop    %r12
+  800ba4:	41 5d                	pop    %r13
+  800ba6:	41 5e                	pop    %r14
+  800ba8:	41 5f                	pop    %r15
+  800baa:	5d                   	pop    %rbp
+  800bab:	c3                   	ret
+
+0000000000800bac <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800bac:	55                   	push   %rbp
+  800bad:	48 89 e5             	mov    %rsp,%rbp
+  800bb0:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800bb4:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800bb8:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800bbd:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800bc1:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800bc8:	48 85 ff             	test   %rdi,%rdi
+  800bcb:	74 2b                	je     800bf8 <vsnprintf+0x4c>
+  800bcd:	48 85 f6             	test   %rsi,%rsi
+  800bd0:	74 26                	je     800bf8 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bd2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd6:	48 bf 50 04 80 00 00 	movabs $0x800450,%rdi
+  800bdd:	00 00 00 
+  800be0:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  800be7:	00 00 00 
+  800bea:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bec:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bf0:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bf3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bf6:	c9                   	leave
+  800bf7:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bf8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bfd:	eb f7                	jmp    800bf6 <vsnprintf+0x4a>
+
+0000000000800bff <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bff:	55                   	push   %rbp
+  800c00:	48 89 e5             	mov    %rsp,%rbp
+  800c03:	48 83 ec 50          	sub    $0x50,%rsp
+  800c07:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c0b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c0f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c13:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c1a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c22:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c26:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c2a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c2e:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  800c35:	00 00 00 
+  800c38:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c3a:	c9                   	leave
+  800c3b:	c3                   	ret
+
+0000000000800c3c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c3c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c3f:	74 10                	je     800c51 <strlen+0x15>
+    size_t n = 0;
+  800c41:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c46:	48 83 c0 01          	add    $0x1,%rax
+  800c4a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c4e:	75 f6                	jne    800c46 <strlen+0xa>
+  800c50:	c3                   	ret
+    size_t n = 0;
+  800c51:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c56:	c3                   	ret
+
+0000000000800c57 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c57:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c5a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c5f:	48 85 f6             	test   %rsi,%rsi
+  800c62:	74 11                	je     800c75 <strnlen+0x1e>
+  800c64:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c68:	74 0c                	je     800c76 <strnlen+0x1f>
+  800c6a:	48 83 c2 01          	add    $0x1,%rdx
+  800c6e:	48 39 d0             	cmp    %rdx,%rax
+  800c71:	75 f1                	jne    800c64 <strnlen+0xd>
+  800c73:	eb 04                	jmp    800c79 <strnlen+0x22>
+  800c75:	c3                   	ret
+  800c76:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c79:	c3                   	ret
+
+0000000000800c7a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c7a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c82:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c86:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c89:	48 83 c2 01          	add    $0x1,%rdx
+  800c8d:	84 c9                	test   %cl,%cl
+  800c8f:	75 f1                	jne    800c82 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c91:	c3                   	ret
+
+0000000000800c92 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c92:	55                   	push   %rbp
+  800c93:	48 89 e5             	mov    %rsp,%rbp
+  800c96:	41 54                	push   %r12
+  800c98:	53                   	push   %rbx
+  800c99:	48 89 fb             	mov    %rdi,%rbx
+  800c9c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c9f:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  800ca6:	00 00 00 
+  800ca9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800cab:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800caf:	4c 89 e6             	mov    %r12,%rsi
+  800cb2:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+    return dst;
+}
+  800cbe:	48 89 d8             	mov    %rbx,%rax
+  800cc1:	5b                   	pop    %rbx
+  800cc2:	41 5c                	pop    %r12
+  800cc4:	5d                   	pop    %rbp
+  800cc5:	c3                   	ret
+
+0000000000800cc6 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800cc6:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800cc9:	48 85 d2             	test   %rdx,%rdx
+  800ccc:	74 1f                	je     800ced <strncpy+0x27>
+  800cce:	48 01 fa             	add    %rdi,%rdx
+  800cd1:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cd4:	48 83 c1 01          	add    $0x1,%rcx
+  800cd8:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cdc:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ce0:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ce4:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ce8:	48 39 ca             	cmp    %rcx,%rdx
+  800ceb:	75 e7                	jne    800cd4 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cee:	48 89 f8             	mov    %rdi,%rax
+  800cf1:	48 85 d2             	test   %rdx,%rdx
+  800cf4:	74 24                	je     800d1a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cf6:	48 83 ea 01          	sub    $0x1,%rdx
+  800cfa:	74 1b                	je     800d17 <strlcpy+0x29>
+  800cfc:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d00:	0f b6 16             	movzbl (%rsi),%edx
+  800d03:	84 d2                	test   %dl,%dl
+  800d05:	74 10                	je     800d17 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d07:	48 83 c6 01          	add    $0x1,%rsi
+  800d0b:	48 83 c0 01          	add    $0x1,%rax
+  800d0f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d12:	48 39 c8             	cmp    %rcx,%rax
+  800d15:	75 e9                	jne    800d00 <strlcpy+0x12>
+        *dst = '\0';
+  800d17:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d1a:	48 29 f8             	sub    %rdi,%rax
+}
+  800d1d:	c3                   	ret
+
+0000000000800d1e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d1e:	0f b6 07             	movzbl (%rdi),%eax
+  800d21:	84 c0                	test   %al,%al
+  800d23:	74 13                	je     800d38 <strcmp+0x1a>
+  800d25:	38 06                	cmp    %al,(%rsi)
+  800d27:	75 0f                	jne    800d38 <strcmp+0x1a>
+  800d29:	48 83 c7 01          	add    $0x1,%rdi
+  800d2d:	48 83 c6 01          	add    $0x1,%rsi
+  800d31:	0f b6 07             	movzbl (%rdi),%eax
+  800d34:	84 c0                	test   %al,%al
+  800d36:	75 ed                	jne    800d25 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d38:	0f b6 c0             	movzbl %al,%eax
+  800d3b:	0f b6 16             	movzbl (%rsi),%edx
+  800d3e:	29 d0                	sub    %edx,%eax
+}
+  800d40:	c3                   	ret
+
+0000000000800d41 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d41:	48 85 d2             	test   %rdx,%rdx
+  800d44:	74 1f                	je     800d65 <strncmp+0x24>
+  800d46:	0f b6 07             	movzbl (%rdi),%eax
+  800d49:	84 c0                	test   %al,%al
+  800d4b:	74 1e                	je     800d6b <strncmp+0x2a>
+  800d4d:	3a 06                	cmp    (%rsi),%al
+  800d4f:	75 1a                	jne    800d6b <strncmp+0x2a>
+  800d51:	48 83 c7 01          	add    $0x1,%rdi
+  800d55:	48 83 c6 01          	add    $0x1,%rsi
+  800d59:	48 83 ea 01          	sub    $0x1,%rdx
+  800d5d:	75 e7                	jne    800d46 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d64:	c3                   	ret
+  800d65:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d6a:	c3                   	ret
+  800d6b:	48 85 d2             	test   %rdx,%rdx
+  800d6e:	74 09                	je     800d79 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d70:	0f b6 07             	movzbl (%rdi),%eax
+  800d73:	0f b6 16             	movzbl (%rsi),%edx
+  800d76:	29 d0                	sub    %edx,%eax
+  800d78:	c3                   	ret
+    if (!n) return 0;
+  800d79:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d7e:	c3                   	ret
+
+0000000000800d7f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d7f:	0f b6 17             	movzbl (%rdi),%edx
+  800d82:	84 d2                	test   %dl,%dl
+  800d84:	74 18                	je     800d9e <strchr+0x1f>
+        if (*str == c) {
+  800d86:	0f be d2             	movsbl %dl,%edx
+  800d89:	39 f2                	cmp    %esi,%edx
+  800d8b:	74 17                	je     800da4 <strchr+0x25>
+    for (; *str; str++) {
+  800d8d:	48 83 c7 01          	add    $0x1,%rdi
+  800d91:	0f b6 17             	movzbl (%rdi),%edx
+  800d94:	84 d2                	test   %dl,%dl
+  800d96:	75 ee                	jne    800d86 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d9d:	c3                   	ret
+  800d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800da3:	c3                   	ret
+  800da4:	48 89 f8             	mov    %rdi,%rax
+}
+  800da7:	c3                   	ret
+
+0000000000800da8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800da8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800dab:	0f b6 17             	movzbl (%rdi),%edx
+  800dae:	84 d2                	test   %dl,%dl
+  800db0:	74 13                	je     800dc5 <strfind+0x1d>
+  800db2:	0f be d2             	movsbl %dl,%edx
+  800db5:	39 f2                	cmp    %esi,%edx
+  800db7:	74 0b                	je     800dc4 <strfind+0x1c>
+  800db9:	48 83 c0 01          	add    $0x1,%rax
+  800dbd:	0f b6 10             	movzbl (%rax),%edx
+  800dc0:	84 d2                	test   %dl,%dl
+  800dc2:	75 ee                	jne    800db2 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800dc4:	c3                   	ret
+  800dc5:	c3                   	ret
+
+0000000000800dc6 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800dc6:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800dc9:	48 89 f8             	mov    %rdi,%rax
+  800dcc:	48 f7 d8             	neg    %rax
+  800dcf:	83 e0 07             	and    $0x7,%eax
+  800dd2:	49 89 d1             	mov    %rdx,%r9
+  800dd5:	49 29 c1             	sub    %rax,%r9
+  800dd8:	78 36                	js     800e10 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800dda:	40 0f b6 c6          	movzbl %sil,%eax
+  800dde:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800de5:	01 01 01 
+  800de8:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dec:	40 f6 c7 07          	test   $0x7,%dil
+  800df0:	75 38                	jne    800e2a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800df2:	4c 89 c9             	mov    %r9,%rcx
+  800df5:	48 c1 f9 03          	sar    $0x3,%rcx
+  800df9:	74 0c                	je     800e07 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dfb:	fc                   	cld
+  800dfc:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dff:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e03:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e07:	4d 85 c9             	test   %r9,%r9
+  800e0a:	75 45                	jne    800e51 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e0c:	4c 89 c0             	mov    %r8,%rax
+  800e0f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e10:	48 85 d2             	test   %rdx,%rdx
+  800e13:	74 f7                	je     800e0c <memset+0x46>
+  800e15:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e18:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e1b:	48 83 c0 01          	add    $0x1,%rax
+  800e1f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e23:	48 39 c2             	cmp    %rax,%rdx
+  800e26:	75 f3                	jne    800e1b <memset+0x55>
+  800e28:	eb e2                	jmp    800e0c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e2a:	40 f6 c7 01          	test   $0x1,%dil
+  800e2e:	74 06                	je     800e36 <memset+0x70>
+  800e30:	88 07                	mov    %al,(%rdi)
+  800e32:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e36:	40 f6 c7 02          	test   $0x2,%dil
+  800e3a:	74 07                	je     800e43 <memset+0x7d>
+  800e3c:	66 89 07             	mov    %ax,(%rdi)
+  800e3f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e43:	40 f6 c7 04          	test   $0x4,%dil
+  800e47:	74 a9                	je     800df2 <memset+0x2c>
+  800e49:	89 07                	mov    %eax,(%rdi)
+  800e4b:	48 83 c7 04          	add    $0x4,%rdi
+  800e4f:	eb a1                	jmp    800df2 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e51:	41 f6 c1 04          	test   $0x4,%r9b
+  800e55:	74 06                	je     800e5d <memset+0x97>
+  800e57:	89 07                	mov    %eax,(%rdi)
+  800e59:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e5d:	41 f6 c1 02          	test   $0x2,%r9b
+  800e61:	74 07                	je     800e6a <memset+0xa4>
+  800e63:	66 89 07             	mov    %ax,(%rdi)
+  800e66:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e6a:	41 f6 c1 01          	test   $0x1,%r9b
+  800e6e:	74 9c                	je     800e0c <memset+0x46>
+  800e70:	88 07                	mov    %al,(%rdi)
+  800e72:	eb 98                	jmp    800e0c <memset+0x46>
+
+0000000000800e74 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e74:	48 89 f8             	mov    %rdi,%rax
+  800e77:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e7a:	48 39 fe             	cmp    %rdi,%rsi
+  800e7d:	73 3b                	jae    800eba <memmove+0x46>
+  800e7f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e83:	48 39 d7             	cmp    %rdx,%rdi
+  800e86:	73 32                	jae    800eba <memmove+0x46>
+        s += n;
+        d += n;
+  800e88:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e8c:	48 89 d6             	mov    %rdx,%rsi
+  800e8f:	48 09 fe             	or     %rdi,%rsi
+  800e92:	48 09 ce             	or     %rcx,%rsi
+  800e95:	40 f6 c6 07          	test   $0x7,%sil
+  800e99:	75 12                	jne    800ead <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e9b:	48 83 ef 08          	sub    $0x8,%rdi
+  800e9f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800ea3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ea7:	fd                   	std
+  800ea8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800eab:	fc                   	cld
+  800eac:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800ead:	48 83 ef 01          	sub    $0x1,%rdi
+  800eb1:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800eb5:	fd                   	std
+  800eb6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800eb8:	eb f1                	jmp    800eab <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800eba:	48 89 f2             	mov    %rsi,%rdx
+  800ebd:	48 09 c2             	or     %rax,%rdx
+  800ec0:	48 09 ca             	or     %rcx,%rdx
+  800ec3:	f6 c2 07             	test   $0x7,%dl
+  800ec6:	75 0c                	jne    800ed4 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ec8:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ecc:	48 89 c7             	mov    %rax,%rdi
+  800ecf:	fc                   	cld
+  800ed0:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ed3:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ed4:	48 89 c7             	mov    %rax,%rdi
+  800ed7:	fc                   	cld
+  800ed8:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eda:	c3                   	ret
+
+0000000000800edb <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800edb:	55                   	push   %rbp
+  800edc:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800edf:	48 b8 74 0e 80 00 00 	movabs $0x800e74,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+}
+  800eeb:	5d                   	pop    %rbp
+  800eec:	c3                   	ret
+
+0000000000800eed <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800eed:	55                   	push   %rbp
+  800eee:	48 89 e5             	mov    %rsp,%rbp
+  800ef1:	41 57                	push   %r15
+  800ef3:	41 56                	push   %r14
+  800ef5:	41 55                	push   %r13
+  800ef7:	41 54                	push   %r12
+  800ef9:	53                   	push   %rbx
+  800efa:	48 83 ec 08          	sub    $0x8,%rsp
+  800efe:	49 89 fe             	mov    %rdi,%r14
+  800f01:	49 89 f7             	mov    %rsi,%r15
+  800f04:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f07:	48 89 f7             	mov    %rsi,%rdi
+  800f0a:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  800f11:	00 00 00 
+  800f14:	ff d0                	call   *%rax
+  800f16:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f19:	48 89 de             	mov    %rbx,%rsi
+  800f1c:	4c 89 f7             	mov    %r14,%rdi
+  800f1f:	48 b8 57 0c 80 00 00 	movabs $0x800c57,%rax
+  800f26:	00 00 00 
+  800f29:	ff d0                	call   *%rax
+  800f2b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f2e:	48 39 c3             	cmp    %rax,%rbx
+  800f31:	74 36                	je     800f69 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f33:	48 89 d8             	mov    %rbx,%rax
+  800f36:	4c 29 e8             	sub    %r13,%rax
+  800f39:	49 39 c4             	cmp    %rax,%r12
+  800f3c:	73 31                	jae    800f6f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f3e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f43:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f47:	4c 89 fe             	mov    %r15,%rsi
+  800f4a:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  800f51:	00 00 00 
+  800f54:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f56:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f5a:	48 83 c4 08          	add    $0x8,%rsp
+  800f5e:	5b                   	pop    %rbx
+  800f5f:	41 5c                	pop    %r12
+  800f61:	41 5d                	pop    %r13
+  800f63:	41 5e                	pop    %r14
+  800f65:	41 5f                	pop    %r15
+  800f67:	5d                   	pop    %rbp
+  800f68:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f69:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f6d:	eb eb                	jmp    800f5a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f6f:	48 83 eb 01          	sub    $0x1,%rbx
+  800f73:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f77:	48 89 da             	mov    %rbx,%rdx
+  800f7a:	4c 89 fe             	mov    %r15,%rsi
+  800f7d:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  800f84:	00 00 00 
+  800f87:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f89:	49 01 de             	add    %rbx,%r14
+  800f8c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f91:	eb c3                	jmp    800f56 <strlcat+0x69>
+
+0000000000800f93 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f93:	48 85 d2             	test   %rdx,%rdx
+  800f96:	74 2d                	je     800fc5 <memcmp+0x32>
+  800f98:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f9d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800fa1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800fa6:	44 38 c1             	cmp    %r8b,%cl
+  800fa9:	75 0f                	jne    800fba <memcmp+0x27>
+    while (n-- > 0) {
+  800fab:	48 83 c0 01          	add    $0x1,%rax
+  800faf:	48 39 c2             	cmp    %rax,%rdx
+  800fb2:	75 e9                	jne    800f9d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800fb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb9:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800fba:	0f b6 c1             	movzbl %cl,%eax
+  800fbd:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800fc1:	44 29 c0             	sub    %r8d,%eax
+  800fc4:	c3                   	ret
+    return 0;
+  800fc5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fca:	c3                   	ret
+
+0000000000800fcb <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fcb:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fcf:	48 39 c7             	cmp    %rax,%rdi
+  800fd2:	73 0f                	jae    800fe3 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fd4:	40 38 37             	cmp    %sil,(%rdi)
+  800fd7:	74 0e                	je     800fe7 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fd9:	48 83 c7 01          	add    $0x1,%rdi
+  800fdd:	48 39 f8             	cmp    %rdi,%rax
+  800fe0:	75 f2                	jne    800fd4 <memfind+0x9>
+  800fe2:	c3                   	ret
+  800fe3:	48 89 f8             	mov    %rdi,%rax
+  800fe6:	c3                   	ret
+  800fe7:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fea:	c3                   	ret
+
+0000000000800feb <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800feb:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fee:	0f b6 37             	movzbl (%rdi),%esi
+  800ff1:	40 80 fe 20          	cmp    $0x20,%sil
+  800ff5:	74 06                	je     800ffd <strtol+0x12>
+  800ff7:	40 80 fe 09          	cmp    $0x9,%sil
+  800ffb:	75 13                	jne    801010 <strtol+0x25>
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+  801001:	0f b6 37             	movzbl (%rdi),%esi
+  801004:	40 80 fe 20          	cmp    $0x20,%sil
+  801008:	74 f3                	je     800ffd <strtol+0x12>
+  80100a:	40 80 fe 09          	cmp    $0x9,%sil
+  80100e:	74 ed                	je     800ffd <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801010:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801013:	83 e0 fd             	and    $0xfffffffd,%eax
+  801016:	3c 01                	cmp    $0x1,%al
+  801018:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80101c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801022:	75 0f                	jne    801033 <strtol+0x48>
+  801024:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801027:	74 14                	je     80103d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801029:	85 d2                	test   %edx,%edx
+  80102b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801030:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801033:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801038:	4c 63 ca             	movslq %edx,%r9
+  80103b:	eb 36                	jmp    801073 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80103d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801041:	74 0f                	je     801052 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801043:	85 d2                	test   %edx,%edx
+  801045:	75 ec                	jne    801033 <strtol+0x48>
+        s++;
+  801047:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80104b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801050:	eb e1                	jmp    801033 <strtol+0x48>
+        s += 2;
+  801052:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801056:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80105b:	eb d6                	jmp    801033 <strtol+0x48>
+            dig -= '0';
+  80105d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801060:	44 0f b6 c1          	movzbl %cl,%r8d
+  801064:	41 39 d0             	cmp    %edx,%r8d
+  801067:	7d 21                	jge    80108a <strtol+0x9f>
+        val = val * base + dig;
+  801069:	49 0f af c1          	imul   %r9,%rax
+  80106d:	0f b6 c9             	movzbl %cl,%ecx
+  801070:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801073:	48 83 c7 01          	add    $0x1,%rdi
+  801077:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80107b:	80 f9 39             	cmp    $0x39,%cl
+  80107e:	76 dd                	jbe    80105d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801080:	80 f9 7b             	cmp    $0x7b,%cl
+  801083:	77 05                	ja     80108a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801085:	83 e9 57             	sub    $0x57,%ecx
+  801088:	eb d6                	jmp    801060 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80108a:	4d 85 d2             	test   %r10,%r10
+  80108d:	74 03                	je     801092 <strtol+0xa7>
+  80108f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801092:	48 89 c2             	mov    %rax,%rdx
+  801095:	48 f7 da             	neg    %rdx
+  801098:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80109c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010a0:	c3                   	ret
+
+00000000008010a1 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010a1:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8010bd:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8010bf:	c3                   	ret
+
+00000000008010c0 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010c0:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010c5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ca:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010da:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010e6:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e8:	c3                   	ret
+
+00000000008010e9 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010e9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010ec:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010f1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801101:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801107:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80110f:	48 85 c0             	test   %rax,%rax
+  801112:	7f 01                	jg     801115 <sys_env_destroy+0x2c>
+}
+  801114:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801115:	55                   	push   %rbp
+  801116:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801119:	49 89 c0             	mov    %rax,%r8
+  80111c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801121:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  801128:	00 00 00 
+  80112b:	be 29 00 00 00       	mov    $0x29,%esi
+  801130:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  801137:	00 00 00 
+  80113a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80113f:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801146:	00 00 00 
+  801149:	41 ff d1             	call   *%r9
+
+000000000080114c <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80114c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801151:	bf 00 00 00 00       	mov    $0x0,%edi
+  801156:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80115b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801160:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80116c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801172:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801174:	c3                   	ret
+
+0000000000801175 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801175:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80117a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80117f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801184:	ba 00 00 00 00       	mov    $0x0,%edx
+  801189:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801195:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80119b:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80119d:	c3                   	ret
+
+000000000080119e <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80119e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011a3:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8011aa:	00 00 00 
+  8011ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011bf:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8011c1:	c3                   	ret
+
+00000000008011c2 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011c2:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011c5:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011d6:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011d8:	c3                   	ret
+
+00000000008011d9 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011d9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011dc:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011e1:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ea:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011f2:	48 85 c0             	test   %rax,%rax
+  8011f5:	7f 01                	jg     8011f8 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011f7:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011fc:	49 89 c0             	mov    %rax,%r8
+  8011ff:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801204:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  80120b:	00 00 00 
+  80120e:	be 29 00 00 00       	mov    $0x29,%esi
+  801213:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  80121a:	00 00 00 
+  80121d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801222:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801229:	00 00 00 
+  80122c:	41 ff d1             	call   *%r9
+
+000000000080122f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80122f:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801232:	48 63 d2             	movslq %edx,%rdx
+  801235:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80123d:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801240:	0f 05                	syscall
+    if (check && ret > 0) {
+  801242:	48 85 c0             	test   %rax,%rax
+  801245:	7f 01                	jg     801248 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801247:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801248:	55                   	push   %rbp
+  801249:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80124c:	49 89 c0             	mov    %rax,%r8
+  80124f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801254:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  80125b:	00 00 00 
+  80125e:	be 29 00 00 00       	mov    $0x29,%esi
+  801263:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  80126a:	00 00 00 
+  80126d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801272:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801279:	00 00 00 
+  80127c:	41 ff d1             	call   *%r9
+
+000000000080127f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80127f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801282:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801287:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801293:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801299:	0f 05                	syscall
+    if (check && ret > 0) {
+  80129b:	48 85 c0             	test   %rax,%rax
+  80129e:	7f 01                	jg     8012a1 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012a0:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012a1:	55                   	push   %rbp
+  8012a2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a5:	49 89 c0             	mov    %rax,%r8
+  8012a8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8012ad:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  8012b4:	00 00 00 
+  8012b7:	be 29 00 00 00       	mov    $0x29,%esi
+  8012bc:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  8012c3:	00 00 00 
+  8012c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012cb:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  8012d2:	00 00 00 
+  8012d5:	41 ff d1             	call   *%r9
+
+00000000008012d8 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012d8:	48 63 f6             	movslq %esi,%rsi
+  8012db:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012fa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012fc:	48 85 c0             	test   %rax,%rax
+  8012ff:	7f 01                	jg     801302 <sys_env_set_status+0x2a>
+}
+  801301:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801302:	55                   	push   %rbp
+  801303:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801306:	49 89 c0             	mov    %rax,%r8
+  801309:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80130e:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  801315:	00 00 00 
+  801318:	be 29 00 00 00       	mov    $0x29,%esi
+  80131d:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  801324:	00 00 00 
+  801327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132c:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801333:	00 00 00 
+  801336:	41 ff d1             	call   *%r9
+
+0000000000801339 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801339:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80133c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801341:	ba 00 00 00 00       	mov    $0x0,%edx
+  801346:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801352:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801358:	0f 05                	syscall
+    if (check && ret > 0) {
+  80135a:	48 85 c0             	test   %rax,%rax
+  80135d:	7f 01                	jg     801360 <sys_env_set_trapframe+0x27>
+}
+  80135f:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801360:	55                   	push   %rbp
+  801361:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801364:	49 89 c0             	mov    %rax,%r8
+  801367:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80136c:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  801373:	00 00 00 
+  801376:	be 29 00 00 00       	mov    $0x29,%esi
+  80137b:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  801382:	00 00 00 
+  801385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138a:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801391:	00 00 00 
+  801394:	41 ff d1             	call   *%r9
+
+0000000000801397 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801397:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80139a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80139f:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013b8:	48 85 c0             	test   %rax,%rax
+  8013bb:	7f 01                	jg     8013be <sys_env_set_pgfault_upcall+0x27>
+}
+  8013bd:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8013be:	55                   	push   %rbp
+  8013bf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c2:	49 89 c0             	mov    %rax,%r8
+  8013c5:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013ca:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  8013d1:	00 00 00 
+  8013d4:	be 29 00 00 00       	mov    $0x29,%esi
+  8013d9:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  8013e0:	00 00 00 
+  8013e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e8:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  8013ef:	00 00 00 
+  8013f2:	41 ff d1             	call   *%r9
+
+00000000008013f5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013f5:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801400:	4d 63 c0             	movslq %r8d,%r8
+  801403:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801409:	0f 05                	syscall
+}
+  80140b:	c3                   	ret
+
+000000000080140c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80140c:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80140f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801412:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801417:	4d 63 c0             	movslq %r8d,%r8
+  80141a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801420:	0f 05                	syscall
+}
+  801422:	c3                   	ret
+
+0000000000801423 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801423:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801428:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80142b:	45 89 c0             	mov    %r8d,%r8d
+  80142e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801434:	0f 05                	syscall
+    if (check && ret > 0) {
+  801436:	48 85 c0             	test   %rax,%rax
+  801439:	7f 01                	jg     80143c <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80143b:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80143c:	55                   	push   %rbp
+  80143d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801440:	49 89 c0             	mov    %rax,%r8
+  801443:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801448:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  80144f:	00 00 00 
+  801452:	be 29 00 00 00       	mov    $0x29,%esi
+  801457:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  80145e:	00 00 00 
+  801461:	b8 00 00 00 00       	mov    $0x0,%eax
+  801466:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  80146d:	00 00 00 
+  801470:	41 ff d1             	call   *%r9
+
+0000000000801473 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801473:	55                   	push   %rbp
+  801474:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801477:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80147d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801482:	ba 00 00 00 00       	mov    $0x0,%edx
+  801487:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  80148e:	00 00 00 
+  801491:	ff d0                	call   *%rax
+}
+  801493:	5d                   	pop    %rbp
+  801494:	c3                   	ret
+
+0000000000801495 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801495:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80149a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80149f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014af:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014bb:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014bd:	c3                   	ret
+
+00000000008014be <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014be:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014c3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014df:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014e1:	48 85 c0             	test   %rax,%rax
+  8014e4:	7f 01                	jg     8014e7 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8014e6:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8014e7:	55                   	push   %rbp
+  8014e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014eb:	49 89 c0             	mov    %rax,%r8
+  8014ee:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014f3:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  8014fa:	00 00 00 
+  8014fd:	be 29 00 00 00       	mov    $0x29,%esi
+  801502:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  801509:	00 00 00 
+  80150c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801511:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801518:	00 00 00 
+  80151b:	41 ff d1             	call   *%r9
+
+000000000080151e <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80151e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801523:	bf 00 00 00 00       	mov    $0x0,%edi
+  801528:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80152d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801532:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801538:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801544:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801546:	c3                   	ret
+
+0000000000801547 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801547:	89 d2                	mov    %edx,%edx
+  801549:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80154b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801550:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801556:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80155c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801562:	0f 05                	syscall
+}
+  801564:	c3                   	ret
+
+0000000000801565 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801565:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801568:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801572:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80157e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801584:	0f 05                	syscall
+}
+  801586:	c3                   	ret
+
+0000000000801587 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801587:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80158a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80158f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801594:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a6:	0f 05                	syscall
+}
+  8015a8:	c3                   	ret
+
+00000000008015a9 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8015a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ac:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015b1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015cd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015cf:	48 85 c0             	test   %rax,%rax
+  8015d2:	7f 01                	jg     8015d5 <sys_irq_ack+0x2c>
+}
+  8015d4:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015d9:	49 89 c0             	mov    %rax,%r8
+  8015dc:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8015e1:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  8015e8:	00 00 00 
+  8015eb:	be 29 00 00 00       	mov    $0x29,%esi
+  8015f0:	48 bf b7 4d 80 00 00 	movabs $0x804db7,%rdi
+  8015f7:	00 00 00 
+  8015fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ff:	49 b9 05 02 80 00 00 	movabs $0x800205,%r9
+  801606:	00 00 00 
+  801609:	41 ff d1             	call   *%r9
+
+000000000080160c <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80160c:	55                   	push   %rbp
+  80160d:	48 89 e5             	mov    %rsp,%rbp
+  801610:	41 56                	push   %r14
+  801612:	41 55                	push   %r13
+  801614:	41 54                	push   %r12
+  801616:	53                   	push   %rbx
+  801617:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80161a:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  801621:	00 00 00 
+  801624:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801628:	74 27                	je     801651 <_handle_vectored_pagefault+0x45>
+  80162a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80162f:	49 bd 20 00 81 00 00 	movabs $0x810020,%r13
+  801636:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801639:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80163c:	4c 89 e7             	mov    %r12,%rdi
+  80163f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801644:	84 c0                	test   %al,%al
+  801646:	75 45                	jne    80168d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801648:	48 83 c3 01          	add    $0x1,%rbx
+  80164c:	49 3b 1e             	cmp    (%r14),%rbx
+  80164f:	72 eb                	jb     80163c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801651:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801658:	00 
+  801659:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80165e:	4d 8b 04 24          	mov    (%r12),%r8
+  801662:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  801669:	00 00 00 
+  80166c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801671:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  801678:	00 00 00 
+  80167b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801680:	49 ba 05 02 80 00 00 	movabs $0x800205,%r10
+  801687:	00 00 00 
+  80168a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80168d:	5b                   	pop    %rbx
+  80168e:	41 5c                	pop    %r12
+  801690:	41 5d                	pop    %r13
+  801692:	41 5e                	pop    %r14
+  801694:	5d                   	pop    %rbp
+  801695:	c3                   	ret
+
+0000000000801696 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801696:	55                   	push   %rbp
+  801697:	48 89 e5             	mov    %rsp,%rbp
+  80169a:	53                   	push   %rbx
+  80169b:	48 83 ec 08          	sub    $0x8,%rsp
+  80169f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8016a2:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8016a9:	00 00 00 
+  8016ac:	80 38 00             	cmpb   $0x0,(%rax)
+  8016af:	0f 84 84 00 00 00    	je     801739 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016b5:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  8016bc:	00 00 00 
+  8016bf:	48 8b 10             	mov    (%rax),%rdx
+  8016c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016c7:	48 b9 20 00 81 00 00 	movabs $0x810020,%rcx
+  8016ce:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016d1:	48 85 d2             	test   %rdx,%rdx
+  8016d4:	74 19                	je     8016ef <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016d6:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8016da:	0f 84 e8 00 00 00    	je     8017c8 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016e0:	48 83 c0 01          	add    $0x1,%rax
+  8016e4:	48 39 d0             	cmp    %rdx,%rax
+  8016e7:	75 ed                	jne    8016d6 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8016e9:	48 83 fa 08          	cmp    $0x8,%rdx
+  8016ed:	74 1c                	je     80170b <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8016ef:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016f3:	48 a3 68 00 81 00 00 	movabs %rax,0x810068
+  8016fa:	00 00 00 
+  8016fd:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801704:	00 00 00 
+  801707:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80170b:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+  801717:	89 c7                	mov    %eax,%edi
+  801719:	48 be 8e 18 80 00 00 	movabs $0x80188e,%rsi
+  801720:	00 00 00 
+  801723:	48 b8 97 13 80 00 00 	movabs $0x801397,%rax
+  80172a:	00 00 00 
+  80172d:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80172f:	85 c0                	test   %eax,%eax
+  801731:	78 68                	js     80179b <add_pgfault_handler+0x105>
+    return res;
+}
+  801733:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801737:	c9                   	leave
+  801738:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801739:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  801740:	00 00 00 
+  801743:	ff d0                	call   *%rax
+  801745:	89 c7                	mov    %eax,%edi
+  801747:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80174c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801751:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801758:	00 00 00 
+  80175b:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  801762:	00 00 00 
+  801765:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801767:	48 ba 68 00 81 00 00 	movabs $0x810068,%rdx
+  80176e:	00 00 00 
+  801771:	48 8b 02             	mov    (%rdx),%rax
+  801774:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801778:	48 89 0a             	mov    %rcx,(%rdx)
+  80177b:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  801782:	00 00 00 
+  801785:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801789:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  801790:	00 00 00 
+  801793:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  801796:	e9 70 ff ff ff       	jmp    80170b <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80179b:	89 c1                	mov    %eax,%ecx
+  80179d:	48 ba 06 4e 80 00 00 	movabs $0x804e06,%rdx
+  8017a4:	00 00 00 
+  8017a7:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8017ac:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  8017b3:	00 00 00 
+  8017b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bb:	49 b8 05 02 80 00 00 	movabs $0x800205,%r8
+  8017c2:	00 00 00 
+  8017c5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8017c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017cd:	e9 61 ff ff ff       	jmp    801733 <add_pgfault_handler+0x9d>
+
+00000000008017d2 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8017d2:	55                   	push   %rbp
+  8017d3:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8017d6:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8017dd:	00 00 00 
+  8017e0:	80 38 00             	cmpb   $0x0,(%rax)
+  8017e3:	74 33                	je     801818 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8017e5:	48 a1 68 00 81 00 00 	movabs 0x810068,%rax
+  8017ec:	00 00 00 
+  8017ef:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8017f4:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  8017fb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8017fe:	48 85 c0             	test   %rax,%rax
+  801801:	0f 84 85 00 00 00    	je     80188c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  801807:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80180b:	74 40                	je     80184d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80180d:	48 83 c1 01          	add    $0x1,%rcx
+  801811:	48 39 c1             	cmp    %rax,%rcx
+  801814:	75 f1                	jne    801807 <remove_pgfault_handler+0x35>
+  801816:	eb 74                	jmp    80188c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  801818:	48 b9 1e 4e 80 00 00 	movabs $0x804e1e,%rcx
+  80181f:	00 00 00 
+  801822:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  801829:	00 00 00 
+  80182c:	be 43 00 00 00       	mov    $0x43,%esi
+  801831:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  801838:	00 00 00 
+  80183b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801840:	49 b8 05 02 80 00 00 	movabs $0x800205,%r8
+  801847:	00 00 00 
+  80184a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80184d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801854:	00 
+  801855:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801859:	48 29 ca             	sub    %rcx,%rdx
+  80185c:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801863:	00 00 00 
+  801866:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80186a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80186f:	48 89 ce             	mov    %rcx,%rsi
+  801872:	48 b8 74 0e 80 00 00 	movabs $0x800e74,%rax
+  801879:	00 00 00 
+  80187c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80187e:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  801885:	00 00 00 
+  801888:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80188c:	5d                   	pop    %rbp
+  80188d:	c3                   	ret
+
+000000000080188e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80188e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801891:	48 b8 0c 16 80 00 00 	movabs $0x80160c,%rax
+  801898:	00 00 00 
+    call *%rax
+  80189b:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80189d:	41 5f                	pop    %r15
+	popq %r15
+  80189f:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8018a1:	41 5f                	pop    %r15
+	popq %r14
+  8018a3:	41 5e                	pop    %r14
+	popq %r13
+  8018a5:	41 5d                	pop    %r13
+	popq %r12
+  8018a7:	41 5c                	pop    %r12
+	popq %r11
+  8018a9:	41 5b                	pop    %r11
+	popq %r10
+  8018ab:	41 5a                	pop    %r10
+	popq %r9
+  8018ad:	41 59                	pop    %r9
+	popq %r8
+  8018af:	41 58                	pop    %r8
+	popq %rsi
+  8018b1:	5e                   	pop    %rsi
+	popq %rdi
+  8018b2:	5f                   	pop    %rdi
+	popq %rbp
+  8018b3:	5d                   	pop    %rbp
+	popq %rdx
+  8018b4:	5a                   	pop    %rdx
+	popq %rcx
+  8018b5:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8018b6:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8018bb:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8018c0:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8018c4:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8018c7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8018cc:	5b                   	pop    %rbx
+	popq %rax
+  8018cd:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8018ce:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8018d2:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8018d3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8018d8:	c3                   	ret
+
+00000000008018d9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018d9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018e0:	ff ff ff 
+  8018e3:	48 01 f8             	add    %rdi,%rax
+  8018e6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018ea:	c3                   	ret
+
+00000000008018eb <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018eb:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018f2:	ff ff ff 
+  8018f5:	48 01 f8             	add    %rdi,%rax
+  8018f8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018fc:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801902:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801906:	c3                   	ret
+
+0000000000801907 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801907:	55                   	push   %rbp
+  801908:	48 89 e5             	mov    %rsp,%rbp
+  80190b:	41 57                	push   %r15
+  80190d:	41 56                	push   %r14
+  80190f:	41 55                	push   %r13
+  801911:	41 54                	push   %r12
+  801913:	53                   	push   %rbx
+  801914:	48 83 ec 08          	sub    $0x8,%rsp
+  801918:	49 89 ff             	mov    %rdi,%r15
+  80191b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801920:	49 bd 96 40 80 00 00 	movabs $0x804096,%r13
+  801927:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80192a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801930:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801933:	48 89 df             	mov    %rbx,%rdi
+  801936:	41 ff d5             	call   *%r13
+  801939:	83 e0 04             	and    $0x4,%eax
+  80193c:	74 17                	je     801955 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80193e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801945:	4c 39 f3             	cmp    %r14,%rbx
+  801948:	75 e6                	jne    801930 <fd_alloc+0x29>
+  80194a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801950:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801955:	4d 89 27             	mov    %r12,(%r15)
+}
+  801958:	48 83 c4 08          	add    $0x8,%rsp
+  80195c:	5b                   	pop    %rbx
+  80195d:	41 5c                	pop    %r12
+  80195f:	41 5d                	pop    %r13
+  801961:	41 5e                	pop    %r14
+  801963:	41 5f                	pop    %r15
+  801965:	5d                   	pop    %rbp
+  801966:	c3                   	ret
+
+0000000000801967 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801967:	83 ff 1f             	cmp    $0x1f,%edi
+  80196a:	77 39                	ja     8019a5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80196c:	55                   	push   %rbp
+  80196d:	48 89 e5             	mov    %rsp,%rbp
+  801970:	41 54                	push   %r12
+  801972:	53                   	push   %rbx
+  801973:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801976:	48 63 df             	movslq %edi,%rbx
+  801979:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801980:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801984:	48 89 df             	mov    %rbx,%rdi
+  801987:	48 b8 96 40 80 00 00 	movabs $0x804096,%rax
+  80198e:	00 00 00 
+  801991:	ff d0                	call   *%rax
+  801993:	a8 04                	test   $0x4,%al
+  801995:	74 14                	je     8019ab <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801997:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80199b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019a0:	5b                   	pop    %rbx
+  8019a1:	41 5c                	pop    %r12
+  8019a3:	5d                   	pop    %rbp
+  8019a4:	c3                   	ret
+        return -E_INVAL;
+  8019a5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019aa:	c3                   	ret
+        return -E_INVAL;
+  8019ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019b0:	eb ee                	jmp    8019a0 <fd_lookup+0x39>
+
+00000000008019b2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019b2:	55                   	push   %rbp
+  8019b3:	48 89 e5             	mov    %rsp,%rbp
+  8019b6:	41 54                	push   %r12
+  8019b8:	53                   	push   %rbx
+  8019b9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019bc:	48 b8 e0 4e 80 00 00 	movabs $0x804ee0,%rax
+  8019c3:	00 00 00 
+  8019c6:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8019cd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019d0:	39 3b                	cmp    %edi,(%rbx)
+  8019d2:	74 47                	je     801a1b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019d4:	48 83 c0 08          	add    $0x8,%rax
+  8019d8:	48 8b 18             	mov    (%rax),%rbx
+  8019db:	48 85 db             	test   %rbx,%rbx
+  8019de:	75 f0                	jne    8019d0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019e0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019e7:	00 00 00 
+  8019ea:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019f0:	89 fa                	mov    %edi,%edx
+  8019f2:	48 bf 50 4e 80 00 00 	movabs $0x804e50,%rdi
+  8019f9:	00 00 00 
+  8019fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a01:	48 b9 55 03 80 00 00 	movabs $0x800355,%rcx
+  801a08:	00 00 00 
+  801a0b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a0d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a12:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a16:	5b                   	pop    %rbx
+  801a17:	41 5c                	pop    %r12
+  801a19:	5d                   	pop    %rbp
+  801a1a:	c3                   	ret
+            return 0;
+  801a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a20:	eb f0                	jmp    801a12 <dev_lookup+0x60>
+
+0000000000801a22 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a22:	55                   	push   %rbp
+  801a23:	48 89 e5             	mov    %rsp,%rbp
+  801a26:	41 55                	push   %r13
+  801a28:	41 54                	push   %r12
+  801a2a:	53                   	push   %rbx
+  801a2b:	48 83 ec 18          	sub    $0x18,%rsp
+  801a2f:	48 89 fb             	mov    %rdi,%rbx
+  801a32:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a35:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a3c:	ff ff ff 
+  801a3f:	48 01 df             	add    %rbx,%rdi
+  801a42:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a46:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a4a:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801a51:	00 00 00 
+  801a54:	ff d0                	call   *%rax
+  801a56:	41 89 c5             	mov    %eax,%r13d
+  801a59:	85 c0                	test   %eax,%eax
+  801a5b:	78 06                	js     801a63 <fd_close+0x41>
+  801a5d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a61:	74 1a                	je     801a7d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a63:	45 84 e4             	test   %r12b,%r12b
+  801a66:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a6b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a6f:	44 89 e8             	mov    %r13d,%eax
+  801a72:	48 83 c4 18          	add    $0x18,%rsp
+  801a76:	5b                   	pop    %rbx
+  801a77:	41 5c                	pop    %r12
+  801a79:	41 5d                	pop    %r13
+  801a7b:	5d                   	pop    %rbp
+  801a7c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a7d:	8b 3b                	mov    (%rbx),%edi
+  801a7f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a83:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801a8a:	00 00 00 
+  801a8d:	ff d0                	call   *%rax
+  801a8f:	41 89 c5             	mov    %eax,%r13d
+  801a92:	85 c0                	test   %eax,%eax
+  801a94:	78 1b                	js     801ab1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a9a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a9e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aa4:	48 85 c0             	test   %rax,%rax
+  801aa7:	74 08                	je     801ab1 <fd_close+0x8f>
+  801aa9:	48 89 df             	mov    %rbx,%rdi
+  801aac:	ff d0                	call   *%rax
+  801aae:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801ab1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ab6:	48 89 de             	mov    %rbx,%rsi
+  801ab9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abe:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  801ac5:	00 00 00 
+  801ac8:	ff d0                	call   *%rax
+    return res;
+  801aca:	eb a3                	jmp    801a6f <fd_close+0x4d>
+
+0000000000801acc <close>:
+
+int
+close(int fdnum) {
+  801acc:	55                   	push   %rbp
+  801acd:	48 89 e5             	mov    %rsp,%rbp
+  801ad0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ad4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ad8:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	78 15                	js     801afd <close+0x31>
+
+    return fd_close(fd, 1);
+  801ae8:	be 01 00 00 00       	mov    $0x1,%esi
+  801aed:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801af1:	48 b8 22 1a 80 00 00 	movabs $0x801a22,%rax
+  801af8:	00 00 00 
+  801afb:	ff d0                	call   *%rax
+}
+  801afd:	c9                   	leave
+  801afe:	c3                   	ret
+
+0000000000801aff <close_all>:
+
+void
+close_all(void) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	41 54                	push   %r12
+  801b05:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b06:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b0b:	49 bc cc 1a 80 00 00 	movabs $0x801acc,%r12
+  801b12:	00 00 00 
+  801b15:	89 df                	mov    %ebx,%edi
+  801b17:	41 ff d4             	call   *%r12
+  801b1a:	83 c3 01             	add    $0x1,%ebx
+  801b1d:	83 fb 20             	cmp    $0x20,%ebx
+  801b20:	75 f3                	jne    801b15 <close_all+0x16>
+}
+  801b22:	5b                   	pop    %rbx
+  801b23:	41 5c                	pop    %r12
+  801b25:	5d                   	pop    %rbp
+  801b26:	c3                   	ret
+
+0000000000801b27 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b27:	55                   	push   %rbp
+  801b28:	48 89 e5             	mov    %rsp,%rbp
+  801b2b:	41 57                	push   %r15
+  801b2d:	41 56                	push   %r14
+  801b2f:	41 55                	push   %r13
+  801b31:	41 54                	push   %r12
+  801b33:	53                   	push   %rbx
+  801b34:	48 83 ec 18          	sub    $0x18,%rsp
+  801b38:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b3b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b3f:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+  801b4b:	89 c3                	mov    %eax,%ebx
+  801b4d:	85 c0                	test   %eax,%eax
+  801b4f:	0f 88 b8 00 00 00    	js     801c0d <dup+0xe6>
+    close(newfdnum);
+  801b55:	44 89 e7             	mov    %r12d,%edi
+  801b58:	48 b8 cc 1a 80 00 00 	movabs $0x801acc,%rax
+  801b5f:	00 00 00 
+  801b62:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b64:	4d 63 ec             	movslq %r12d,%r13
+  801b67:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b6e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b72:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b76:	4c 89 ff             	mov    %r15,%rdi
+  801b79:	49 be eb 18 80 00 00 	movabs $0x8018eb,%r14
+  801b80:	00 00 00 
+  801b83:	41 ff d6             	call   *%r14
+  801b86:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b89:	4c 89 ef             	mov    %r13,%rdi
+  801b8c:	41 ff d6             	call   *%r14
+  801b8f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b92:	48 89 df             	mov    %rbx,%rdi
+  801b95:	48 b8 96 40 80 00 00 	movabs $0x804096,%rax
+  801b9c:	00 00 00 
+  801b9f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ba1:	a8 04                	test   $0x4,%al
+  801ba3:	74 2b                	je     801bd0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ba5:	41 89 c1             	mov    %eax,%r9d
+  801ba8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bae:	4c 89 f1             	mov    %r14,%rcx
+  801bb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bb6:	48 89 de             	mov    %rbx,%rsi
+  801bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bbe:	48 b8 2f 12 80 00 00 	movabs $0x80122f,%rax
+  801bc5:	00 00 00 
+  801bc8:	ff d0                	call   *%rax
+  801bca:	89 c3                	mov    %eax,%ebx
+  801bcc:	85 c0                	test   %eax,%eax
+  801bce:	78 4e                	js     801c1e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bd0:	4c 89 ff             	mov    %r15,%rdi
+  801bd3:	48 b8 96 40 80 00 00 	movabs $0x804096,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801be2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801be8:	4c 89 e9             	mov    %r13,%rcx
+  801beb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bf0:	4c 89 fe             	mov    %r15,%rsi
+  801bf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bf8:	48 b8 2f 12 80 00 00 	movabs $0x80122f,%rax
+  801bff:	00 00 00 
+  801c02:	ff d0                	call   *%rax
+  801c04:	89 c3                	mov    %eax,%ebx
+  801c06:	85 c0                	test   %eax,%eax
+  801c08:	78 14                	js     801c1e <dup+0xf7>
+
+    return newfdnum;
+  801c0a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c0d:	89 d8                	mov    %ebx,%eax
+  801c0f:	48 83 c4 18          	add    $0x18,%rsp
+  801c13:	5b                   	pop    %rbx
+  801c14:	41 5c                	pop    %r12
+  801c16:	41 5d                	pop    %r13
+  801c18:	41 5e                	pop    %r14
+  801c1a:	41 5f                	pop    %r15
+  801c1c:	5d                   	pop    %rbp
+  801c1d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c23:	4c 89 ee             	mov    %r13,%rsi
+  801c26:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c2b:	49 bc 7f 12 80 00 00 	movabs $0x80127f,%r12
+  801c32:	00 00 00 
+  801c35:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c38:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c3d:	4c 89 f6             	mov    %r14,%rsi
+  801c40:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c45:	41 ff d4             	call   *%r12
+    return res;
+  801c48:	eb c3                	jmp    801c0d <dup+0xe6>
+
+0000000000801c4a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c4a:	55                   	push   %rbp
+  801c4b:	48 89 e5             	mov    %rsp,%rbp
+  801c4e:	41 56                	push   %r14
+  801c50:	41 55                	push   %r13
+  801c52:	41 54                	push   %r12
+  801c54:	53                   	push   %rbx
+  801c55:	48 83 ec 10          	sub    $0x10,%rsp
+  801c59:	89 fb                	mov    %edi,%ebx
+  801c5b:	49 89 f4             	mov    %rsi,%r12
+  801c5e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c61:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c65:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+  801c71:	85 c0                	test   %eax,%eax
+  801c73:	78 4c                	js     801cc1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c75:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c79:	41 8b 3e             	mov    (%r14),%edi
+  801c7c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c80:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801c87:	00 00 00 
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 35                	js     801cc5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c90:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c94:	83 e0 03             	and    $0x3,%eax
+  801c97:	83 f8 01             	cmp    $0x1,%eax
+  801c9a:	74 2d                	je     801cc9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c9c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ca0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ca4:	48 85 c0             	test   %rax,%rax
+  801ca7:	74 56                	je     801cff <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ca9:	4c 89 ea             	mov    %r13,%rdx
+  801cac:	4c 89 e6             	mov    %r12,%rsi
+  801caf:	4c 89 f7             	mov    %r14,%rdi
+  801cb2:	ff d0                	call   *%rax
+}
+  801cb4:	48 83 c4 10          	add    $0x10,%rsp
+  801cb8:	5b                   	pop    %rbx
+  801cb9:	41 5c                	pop    %r12
+  801cbb:	41 5d                	pop    %r13
+  801cbd:	41 5e                	pop    %r14
+  801cbf:	5d                   	pop    %rbp
+  801cc0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cc1:	48 98                	cltq
+  801cc3:	eb ef                	jmp    801cb4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc5:	48 98                	cltq
+  801cc7:	eb eb                	jmp    801cb4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cc9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cd0:	00 00 00 
+  801cd3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cd9:	89 da                	mov    %ebx,%edx
+  801cdb:	48 bf 91 4e 80 00 00 	movabs $0x804e91,%rdi
+  801ce2:	00 00 00 
+  801ce5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cea:	48 b9 55 03 80 00 00 	movabs $0x800355,%rcx
+  801cf1:	00 00 00 
+  801cf4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cf6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cfd:	eb b5                	jmp    801cb4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cff:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d06:	eb ac                	jmp    801cb4 <read+0x6a>
+
+0000000000801d08 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d08:	55                   	push   %rbp
+  801d09:	48 89 e5             	mov    %rsp,%rbp
+  801d0c:	41 57                	push   %r15
+  801d0e:	41 56                	push   %r14
+  801d10:	41 55                	push   %r13
+  801d12:	41 54                	push   %r12
+  801d14:	53                   	push   %rbx
+  801d15:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d19:	48 85 d2             	test   %rdx,%rdx
+  801d1c:	74 54                	je     801d72 <readn+0x6a>
+  801d1e:	41 89 fd             	mov    %edi,%r13d
+  801d21:	49 89 f6             	mov    %rsi,%r14
+  801d24:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d27:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d2c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d31:	49 bf 4a 1c 80 00 00 	movabs $0x801c4a,%r15
+  801d38:	00 00 00 
+  801d3b:	4c 89 e2             	mov    %r12,%rdx
+  801d3e:	48 29 f2             	sub    %rsi,%rdx
+  801d41:	4c 01 f6             	add    %r14,%rsi
+  801d44:	44 89 ef             	mov    %r13d,%edi
+  801d47:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 20                	js     801d6e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d4e:	01 c3                	add    %eax,%ebx
+  801d50:	85 c0                	test   %eax,%eax
+  801d52:	74 08                	je     801d5c <readn+0x54>
+  801d54:	48 63 f3             	movslq %ebx,%rsi
+  801d57:	4c 39 e6             	cmp    %r12,%rsi
+  801d5a:	72 df                	jb     801d3b <readn+0x33>
+    }
+    return res;
+  801d5c:	48 63 c3             	movslq %ebx,%rax
+}
+  801d5f:	48 83 c4 08          	add    $0x8,%rsp
+  801d63:	5b                   	pop    %rbx
+  801d64:	41 5c                	pop    %r12
+  801d66:	41 5d                	pop    %r13
+  801d68:	41 5e                	pop    %r14
+  801d6a:	41 5f                	pop    %r15
+  801d6c:	5d                   	pop    %rbp
+  801d6d:	c3                   	ret
+        if (inc < 0) return inc;
+  801d6e:	48 98                	cltq
+  801d70:	eb ed                	jmp    801d5f <readn+0x57>
+    int inc = 1, res = 0;
+  801d72:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d77:	eb e3                	jmp    801d5c <readn+0x54>
+
+0000000000801d79 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d79:	55                   	push   %rbp
+  801d7a:	48 89 e5             	mov    %rsp,%rbp
+  801d7d:	41 56                	push   %r14
+  801d7f:	41 55                	push   %r13
+  801d81:	41 54                	push   %r12
+  801d83:	53                   	push   %rbx
+  801d84:	48 83 ec 10          	sub    $0x10,%rsp
+  801d88:	89 fb                	mov    %edi,%ebx
+  801d8a:	49 89 f4             	mov    %rsi,%r12
+  801d8d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d90:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d94:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801d9b:	00 00 00 
+  801d9e:	ff d0                	call   *%rax
+  801da0:	85 c0                	test   %eax,%eax
+  801da2:	78 47                	js     801deb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da8:	41 8b 3e             	mov    (%r14),%edi
+  801dab:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801daf:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+  801dbb:	85 c0                	test   %eax,%eax
+  801dbd:	78 30                	js     801def <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dbf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dc4:	74 2d                	je     801df3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dc6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dca:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dce:	48 85 c0             	test   %rax,%rax
+  801dd1:	74 56                	je     801e29 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dd3:	4c 89 ea             	mov    %r13,%rdx
+  801dd6:	4c 89 e6             	mov    %r12,%rsi
+  801dd9:	4c 89 f7             	mov    %r14,%rdi
+  801ddc:	ff d0                	call   *%rax
+}
+  801dde:	48 83 c4 10          	add    $0x10,%rsp
+  801de2:	5b                   	pop    %rbx
+  801de3:	41 5c                	pop    %r12
+  801de5:	41 5d                	pop    %r13
+  801de7:	41 5e                	pop    %r14
+  801de9:	5d                   	pop    %rbp
+  801dea:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801deb:	48 98                	cltq
+  801ded:	eb ef                	jmp    801dde <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801def:	48 98                	cltq
+  801df1:	eb eb                	jmp    801dde <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801dfa:	00 00 00 
+  801dfd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e03:	89 da                	mov    %ebx,%edx
+  801e05:	48 bf ad 4e 80 00 00 	movabs $0x804ead,%rdi
+  801e0c:	00 00 00 
+  801e0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e14:	48 b9 55 03 80 00 00 	movabs $0x800355,%rcx
+  801e1b:	00 00 00 
+  801e1e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e20:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e27:	eb b5                	jmp    801dde <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e29:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e30:	eb ac                	jmp    801dde <write+0x65>
+
+0000000000801e32 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e32:	55                   	push   %rbp
+  801e33:	48 89 e5             	mov    %rsp,%rbp
+  801e36:	41 54                	push   %r12
+  801e38:	53                   	push   %rbx
+  801e39:	48 83 ec 10          	sub    $0x10,%rsp
+  801e3d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e3f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e43:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801e4a:	00 00 00 
+  801e4d:	ff d0                	call   *%rax
+  801e4f:	85 c0                	test   %eax,%eax
+  801e51:	78 3e                	js     801e91 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e53:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e57:	41 8b 3c 24          	mov    (%r12),%edi
+  801e5b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e5f:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801e66:	00 00 00 
+  801e69:	ff d0                	call   *%rax
+  801e6b:	85 c0                	test   %eax,%eax
+  801e6d:	78 22                	js     801e91 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e6f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e73:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e77:	48 85 c0             	test   %rax,%rax
+  801e7a:	74 0b                	je     801e87 <seek+0x55>
+  801e7c:	89 de                	mov    %ebx,%esi
+  801e7e:	4c 89 e7             	mov    %r12,%rdi
+  801e81:	ff d0                	call   *%rax
+  801e83:	85 c0                	test   %eax,%eax
+  801e85:	78 0a                	js     801e91 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e87:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e91:	48 83 c4 10          	add    $0x10,%rsp
+  801e95:	5b                   	pop    %rbx
+  801e96:	41 5c                	pop    %r12
+  801e98:	5d                   	pop    %rbp
+  801e99:	c3                   	ret
+
+0000000000801e9a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e9a:	55                   	push   %rbp
+  801e9b:	48 89 e5             	mov    %rsp,%rbp
+  801e9e:	41 55                	push   %r13
+  801ea0:	41 54                	push   %r12
+  801ea2:	53                   	push   %rbx
+  801ea3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ea7:	89 fb                	mov    %edi,%ebx
+  801ea9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eac:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801eb0:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801eb7:	00 00 00 
+  801eba:	ff d0                	call   *%rax
+  801ebc:	85 c0                	test   %eax,%eax
+  801ebe:	78 38                	js     801ef8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ec4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ec8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ecc:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801ed3:	00 00 00 
+  801ed6:	ff d0                	call   *%rax
+  801ed8:	85 c0                	test   %eax,%eax
+  801eda:	78 1c                	js     801ef8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801edc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ee1:	74 20                	je     801f03 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ee3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ee7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801eeb:	48 85 c0             	test   %rax,%rax
+  801eee:	74 47                	je     801f37 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ef0:	44 89 e6             	mov    %r12d,%esi
+  801ef3:	4c 89 ef             	mov    %r13,%rdi
+  801ef6:	ff d0                	call   *%rax
+}
+  801ef8:	48 83 c4 18          	add    $0x18,%rsp
+  801efc:	5b                   	pop    %rbx
+  801efd:	41 5c                	pop    %r12
+  801eff:	41 5d                	pop    %r13
+  801f01:	5d                   	pop    %rbp
+  801f02:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f03:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f0a:	00 00 00 
+  801f0d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f13:	89 da                	mov    %ebx,%edx
+  801f15:	48 bf 70 4e 80 00 00 	movabs $0x804e70,%rdi
+  801f1c:	00 00 00 
+  801f1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f24:	48 b9 55 03 80 00 00 	movabs $0x800355,%rcx
+  801f2b:	00 00 00 
+  801f2e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f30:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f35:	eb c1                	jmp    801ef8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f37:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f3c:	eb ba                	jmp    801ef8 <ftruncate+0x5e>
+
+0000000000801f3e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f3e:	55                   	push   %rbp
+  801f3f:	48 89 e5             	mov    %rsp,%rbp
+  801f42:	41 54                	push   %r12
+  801f44:	53                   	push   %rbx
+  801f45:	48 83 ec 10          	sub    $0x10,%rsp
+  801f49:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f4c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f50:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  801f57:	00 00 00 
+  801f5a:	ff d0                	call   *%rax
+  801f5c:	85 c0                	test   %eax,%eax
+  801f5e:	78 4e                	js     801fae <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f60:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f64:	41 8b 3c 24          	mov    (%r12),%edi
+  801f68:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f6c:	48 b8 b2 19 80 00 00 	movabs $0x8019b2,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 32                	js     801fae <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f7c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f80:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f85:	74 30                	je     801fb7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f87:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f8a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f91:	00 00 00 
+    stat->st_isdir = 0;
+  801f94:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f9b:	00 00 00 
+    stat->st_dev = dev;
+  801f9e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fa5:	48 89 de             	mov    %rbx,%rsi
+  801fa8:	4c 89 e7             	mov    %r12,%rdi
+  801fab:	ff 50 28             	call   *0x28(%rax)
+}
+  801fae:	48 83 c4 10          	add    $0x10,%rsp
+  801fb2:	5b                   	pop    %rbx
+  801fb3:	41 5c                	pop    %r12
+  801fb5:	5d                   	pop    %rbp
+  801fb6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fb7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fbc:	eb f0                	jmp    801fae <fstat+0x70>
+
+0000000000801fbe <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fbe:	55                   	push   %rbp
+  801fbf:	48 89 e5             	mov    %rsp,%rbp
+  801fc2:	41 54                	push   %r12
+  801fc4:	53                   	push   %rbx
+  801fc5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fc8:	be 00 00 00 00       	mov    $0x0,%esi
+  801fcd:	48 b8 2c 31 80 00 00 	movabs $0x80312c,%rax
+  801fd4:	00 00 00 
+  801fd7:	ff d0                	call   *%rax
+  801fd9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 25                	js     802004 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fdf:	4c 89 e6             	mov    %r12,%rsi
+  801fe2:	89 c7                	mov    %eax,%edi
+  801fe4:	48 b8 3e 1f 80 00 00 	movabs $0x801f3e,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+  801ff0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ff3:	89 df                	mov    %ebx,%edi
+  801ff5:	48 b8 cc 1a 80 00 00 	movabs $0x801acc,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+
+    return res;
+  802001:	44 89 e3             	mov    %r12d,%ebx
+}
+  802004:	89 d8                	mov    %ebx,%eax
+  802006:	5b                   	pop    %rbx
+  802007:	41 5c                	pop    %r12
+  802009:	5d                   	pop    %rbp
+  80200a:	c3                   	ret
+
+000000000080200b <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80200b:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802012:	00 00 00 
+  802015:	83 38 00             	cmpl   $0x0,(%rax)
+  802018:	74 0a                	je     802024 <fsenv+0x19>
+    return envid;
+}
+  80201a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802021:	00 00 
+  802023:	c3                   	ret
+fsenv(void) {
+  802024:	55                   	push   %rbp
+  802025:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802028:	bf 03 00 00 00       	mov    $0x3,%edi
+  80202d:	48 b8 2c 47 80 00 00 	movabs $0x80472c,%rax
+  802034:	00 00 00 
+  802037:	ff d0                	call   *%rax
+  802039:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802040:	00 00 
+}
+  802042:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802049:	00 00 
+  80204b:	5d                   	pop    %rbp
+  80204c:	c3                   	ret
+
+000000000080204d <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  80204d:	55                   	push   %rbp
+  80204e:	48 89 e5             	mov    %rsp,%rbp
+  802051:	41 54                	push   %r12
+  802053:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802054:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802059:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80205e:	48 89 de             	mov    %rbx,%rsi
+  802061:	bf 00 00 00 00       	mov    $0x0,%edi
+  802066:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802072:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802079:	00 00 00 
+  80207c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802082:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802087:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80208c:	48 89 de             	mov    %rbx,%rsi
+  80208f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802094:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8020a2:	85 c0                	test   %eax,%eax
+  8020a4:	0f 88 a2 00 00 00    	js     80214c <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8020aa:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020b1:	00 00 00 
+  8020b4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020ba:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020bf:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8020c1:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8020c6:	49 bc 5e 42 80 00 00 	movabs $0x80425e,%r12
+  8020cd:	00 00 00 
+  8020d0:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020d3:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020d8:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020db:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  8020e2:	00 00 00 
+  8020e5:	ff d0                	call   *%rax
+  8020e7:	89 c7                	mov    %eax,%edi
+  8020e9:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8020ef:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8020f4:	48 89 da             	mov    %rbx,%rdx
+  8020f7:	be 09 00 00 00       	mov    $0x9,%esi
+  8020fc:	48 b8 d6 46 80 00 00 	movabs $0x8046d6,%rax
+  802103:	00 00 00 
+  802106:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802108:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80210d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802112:	be 00 00 00 00       	mov    $0x0,%esi
+  802117:	bf 00 00 00 00       	mov    $0x0,%edi
+  80211c:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  802123:	00 00 00 
+  802126:	ff d0                	call   *%rax
+  802128:	89 c3                	mov    %eax,%ebx
+  80212a:	85 c0                	test   %eax,%eax
+  80212c:	78 25                	js     802153 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80212e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802135:	00 00 00 
+  802138:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80213e:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802145:	00 00 
+    return 0;
+  802147:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80214c:	89 d8                	mov    %ebx,%eax
+  80214e:	5b                   	pop    %rbx
+  80214f:	41 5c                	pop    %r12
+  802151:	5d                   	pop    %rbp
+  802152:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802153:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802158:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  80215d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802162:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  802169:	00 00 00 
+  80216c:	ff d0                	call   *%rax
+        return res;
+  80216e:	eb dc                	jmp    80214c <fschan_setup+0xff>
+
+0000000000802170 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802170:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802177:	00 00 00 
+  80217a:	80 38 00             	cmpb   $0x0,(%rax)
+  80217d:	74 55                	je     8021d4 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80217f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802186:	00 00 00 
+  802189:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80218f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802194:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  80219b:	00 00 00 
+  80219e:	3b 0a                	cmp    (%rdx),%ecx
+  8021a0:	75 01                	jne    8021a3 <fschan+0x33>
+}
+  8021a2:	c3                   	ret
+fschan(void) {
+  8021a3:	55                   	push   %rbp
+  8021a4:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021a7:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8021ae:	00 00 00 
+  8021b1:	ff d0                	call   *%rax
+  8021b3:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8021b5:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021ba:	85 d2                	test   %edx,%edx
+  8021bc:	78 02                	js     8021c0 <fschan+0x50>
+}
+  8021be:	5d                   	pop    %rbp
+  8021bf:	c3                   	ret
+        fschan_enabled = 0;
+  8021c0:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021c7:	00 00 00 
+  8021ca:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d2:	eb ea                	jmp    8021be <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d9:	c3                   	ret
+
+00000000008021da <fbuf>:
+fbuf(struct Fd *fd) {
+  8021da:	55                   	push   %rbp
+  8021db:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021de:	48 b8 d9 18 80 00 00 	movabs $0x8018d9,%rax
+  8021e5:	00 00 00 
+  8021e8:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8021ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ef:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8021f3:	77 12                	ja     802207 <fbuf+0x2d>
+  8021f5:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8021f9:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802200:	00 00 00 
+  802203:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802207:	48 89 d0             	mov    %rdx,%rax
+  80220a:	5d                   	pop    %rbp
+  80220b:	c3                   	ret
+
+000000000080220c <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  80220c:	55                   	push   %rbp
+  80220d:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802210:	48 83 c7 40          	add    $0x40,%rdi
+  802214:	48 b8 98 42 80 00 00 	movabs $0x804298,%rax
+  80221b:	00 00 00 
+  80221e:	ff d0                	call   *%rax
+  802220:	84 c0                	test   %al,%al
+  802222:	75 02                	jne    802226 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802224:	5d                   	pop    %rbp
+  802225:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802226:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  80222d:	00 00 00 
+  802230:	ff d0                	call   *%rax
+  802232:	89 c7                	mov    %eax,%edi
+  802234:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80223a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80223f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802244:	be 0a 00 00 00       	mov    $0xa,%esi
+  802249:	48 b8 d6 46 80 00 00 	movabs $0x8046d6,%rax
+  802250:	00 00 00 
+  802253:	ff d0                	call   *%rax
+}
+  802255:	eb cd                	jmp    802224 <fschan_publish+0x18>
+
+0000000000802257 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802257:	55                   	push   %rbp
+  802258:	48 89 e5             	mov    %rsp,%rbp
+  80225b:	41 57                	push   %r15
+  80225d:	41 56                	push   %r14
+  80225f:	41 55                	push   %r13
+  802261:	41 54                	push   %r12
+  802263:	53                   	push   %rbx
+  802264:	48 83 ec 48          	sub    $0x48,%rsp
+  802268:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80226c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802270:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802273:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802277:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80227a:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802281:	00 00 00 
+  802284:	8b 02                	mov    (%rdx),%eax
+  802286:	83 c0 01             	add    $0x1,%eax
+  802289:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80228e:	0f 44 c1             	cmove  %ecx,%eax
+  802291:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802293:	4d 85 c0             	test   %r8,%r8
+  802296:	74 2c                	je     8022c4 <fschan_rw+0x6d>
+  802298:	45 89 ce             	mov    %r9d,%r14d
+  80229b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8022a2:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8022a6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022ac:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8022b3:	00 
+  8022b4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022ba:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022bf:	e9 41 01 00 00       	jmp    802405 <fschan_rw+0x1ae>
+  8022c4:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022cc:	e9 9c 01 00 00       	jmp    80246d <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022d1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022d5:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022d8:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022db:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022de:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022e2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022e6:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8022ea:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8022ee:	48 89 da             	mov    %rbx,%rdx
+  8022f1:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  8022f8:	00 00 00 
+  8022fb:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8022fd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802301:	48 b8 0c 22 80 00 00 	movabs $0x80220c,%rax
+  802308:	00 00 00 
+  80230b:	ff d0                	call   *%rax
+            queued += blk;
+  80230d:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802310:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802314:	4d 39 fc             	cmp    %r15,%r12
+  802317:	73 6b                	jae    802384 <fschan_rw+0x12d>
+  802319:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80231d:	77 65                	ja     802384 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80231f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802323:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802327:	48 b8 73 42 80 00 00 	movabs $0x804273,%rax
+  80232e:	00 00 00 
+  802331:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802333:	4c 89 fb             	mov    %r15,%rbx
+  802336:	4c 29 e3             	sub    %r12,%rbx
+  802339:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80233e:	48 39 d3             	cmp    %rdx,%rbx
+  802341:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802345:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802349:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80234d:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802351:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802354:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802356:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80235d:	00 00 00 
+  802360:	8b 09                	mov    (%rcx),%ecx
+  802362:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802365:	83 fe 03             	cmp    $0x3,%esi
+  802368:	0f 85 63 ff ff ff    	jne    8022d1 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80236e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802372:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802375:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802378:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80237b:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80237f:	e9 79 ff ff ff       	jmp    8022fd <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802384:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802388:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80238f:	48 89 df             	mov    %rbx,%rdi
+  802392:	48 b8 36 43 80 00 00 	movabs $0x804336,%rax
+  802399:	00 00 00 
+  80239c:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80239e:	48 89 df             	mov    %rbx,%rdi
+  8023a1:	48 b8 c4 42 80 00 00 	movabs $0x8042c4,%rax
+  8023a8:	00 00 00 
+  8023ab:	ff d0                	call   *%rax
+  8023ad:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8023b1:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8023b5:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8023b9:	75 25                	jne    8023e0 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8023bb:	8b 40 04             	mov    0x4(%rax),%eax
+  8023be:	85 c0                	test   %eax,%eax
+  8023c0:	0f 88 86 00 00 00    	js     80244c <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023c6:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023ca:	74 5b                	je     802427 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023cc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023d0:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023d4:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023d8:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023dc:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023e0:	48 89 df             	mov    %rbx,%rdi
+  8023e3:	48 b8 eb 42 80 00 00 	movabs $0x8042eb,%rax
+  8023ea:	00 00 00 
+  8023ed:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8023ef:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8023f3:	83 f0 01             	xor    $0x1,%eax
+  8023f6:	4d 39 fc             	cmp    %r15,%r12
+  8023f9:	0f 92 c2             	setb   %dl
+  8023fc:	84 c2                	test   %al,%dl
+  8023fe:	75 05                	jne    802405 <fschan_rw+0x1ae>
+  802400:	45 85 ed             	test   %r13d,%r13d
+  802403:	74 50                	je     802455 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802405:	4d 39 fc             	cmp    %r15,%r12
+  802408:	0f 92 c1             	setb   %cl
+  80240b:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80240f:	0f 96 c2             	setbe  %dl
+  802412:	84 d1                	test   %dl,%cl
+  802414:	0f 84 6a ff ff ff    	je     802384 <fschan_rw+0x12d>
+  80241a:	84 c0                	test   %al,%al
+  80241c:	0f 85 fd fe ff ff    	jne    80231f <fschan_rw+0xc8>
+  802422:	e9 5d ff ff ff       	jmp    802384 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802427:	48 63 d0             	movslq %eax,%rdx
+  80242a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80242e:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802432:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802436:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80243a:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80243e:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  802445:	00 00 00 
+  802448:	ff d0                	call   *%rax
+  80244a:	eb 80                	jmp    8023cc <fschan_rw+0x175>
+                err = msg->fm_res;
+  80244c:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80244f:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802453:	eb 8b                	jmp    8023e0 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802455:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80245a:	0f 85 68 fe ff ff    	jne    8022c8 <fschan_rw+0x71>
+  802460:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802463:	85 c0                	test   %eax,%eax
+  802465:	0f 84 5d fe ff ff    	je     8022c8 <fschan_rw+0x71>
+  80246b:	48 98                	cltq
+}
+  80246d:	48 83 c4 48          	add    $0x48,%rsp
+  802471:	5b                   	pop    %rbx
+  802472:	41 5c                	pop    %r12
+  802474:	41 5d                	pop    %r13
+  802476:	41 5e                	pop    %r14
+  802478:	41 5f                	pop    %r15
+  80247a:	5d                   	pop    %rbp
+  80247b:	c3                   	ret
+
+000000000080247c <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80247c:	55                   	push   %rbp
+  80247d:	48 89 e5             	mov    %rsp,%rbp
+  802480:	41 56                	push   %r14
+  802482:	41 55                	push   %r13
+  802484:	41 54                	push   %r12
+  802486:	53                   	push   %rbx
+  802487:	48 83 ec 10          	sub    $0x10,%rsp
+  80248b:	49 89 fe             	mov    %rdi,%r14
+  80248e:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802491:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802495:	48 29 f3             	sub    %rsi,%rbx
+  802498:	48 39 d3             	cmp    %rdx,%rbx
+  80249b:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80249f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024a6:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8024a7:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8024ac:	49 bd f5 40 80 00 00 	movabs $0x8040f5,%r13
+  8024b3:	00 00 00 
+  8024b6:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8024bd:	76 1e                	jbe    8024dd <mmap_fault+0x61>
+  8024bf:	4c 01 e7             	add    %r12,%rdi
+  8024c2:	41 ff d5             	call   *%r13
+  8024c5:	84 c0                	test   %al,%al
+  8024c7:	75 14                	jne    8024dd <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024c9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024cd:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024d4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024d8:	48 39 df             	cmp    %rbx,%rdi
+  8024db:	72 e2                	jb     8024bf <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024dd:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024e4:	00 00 00 
+  8024e7:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8024ee:	00 00 00 
+  8024f1:	4c 89 f0             	mov    %r14,%rax
+  8024f4:	48 29 d0             	sub    %rdx,%rax
+  8024f7:	48 c1 f8 03          	sar    $0x3,%rax
+  8024fb:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802502:	aa aa aa 
+  802505:	48 0f af c2          	imul   %rdx,%rax
+  802509:	48 c1 e0 0c          	shl    $0xc,%rax
+  80250d:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802512:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802516:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802518:	44 89 e0             	mov    %r12d,%eax
+  80251b:	41 03 46 10          	add    0x10(%r14),%eax
+  80251f:	41 2b 06             	sub    (%r14),%eax
+  802522:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802525:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802529:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80252d:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802531:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802534:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	89 c7                	mov    %eax,%edi
+  802542:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802548:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80254d:	48 89 da             	mov    %rbx,%rdx
+  802550:	be 0f 00 00 00       	mov    $0xf,%esi
+  802555:	48 b8 d6 46 80 00 00 	movabs $0x8046d6,%rax
+  80255c:	00 00 00 
+  80255f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802561:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802566:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80256a:	4c 89 e6             	mov    %r12,%rsi
+  80256d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802572:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  802579:	00 00 00 
+  80257c:	ff d0                	call   *%rax
+  80257e:	48 98                	cltq
+}
+  802580:	48 83 c4 10          	add    $0x10,%rsp
+  802584:	5b                   	pop    %rbx
+  802585:	41 5c                	pop    %r12
+  802587:	41 5d                	pop    %r13
+  802589:	41 5e                	pop    %r14
+  80258b:	5d                   	pop    %rbp
+  80258c:	c3                   	ret
+
+000000000080258d <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80258d:	48 8b 37             	mov    (%rdi),%rsi
+  802590:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802597:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80259e:	00 00 00 
+  8025a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025a6:	eb 0f                	jmp    8025b7 <mmap_pgfault+0x2a>
+  8025a8:	c3                   	ret
+  8025a9:	48 83 c1 01          	add    $0x1,%rcx
+  8025ad:	48 83 c2 18          	add    $0x18,%rdx
+  8025b1:	48 83 f9 20          	cmp    $0x20,%rcx
+  8025b5:	74 6e                	je     802625 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025b7:	48 8b 02             	mov    (%rdx),%rax
+  8025ba:	48 83 e8 01          	sub    $0x1,%rax
+  8025be:	48 39 f0             	cmp    %rsi,%rax
+  8025c1:	73 e6                	jae    8025a9 <mmap_pgfault+0x1c>
+  8025c3:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8025c7:	73 e0                	jae    8025a9 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025c9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025d2:	f6 c2 01             	test   $0x1,%dl
+  8025d5:	75 d1                	jne    8025a8 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025d7:	f6 c2 02             	test   $0x2,%dl
+  8025da:	74 1a                	je     8025f6 <mmap_pgfault+0x69>
+  8025dc:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e5:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8025ec:	00 00 00 
+  8025ef:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8025f4:	74 35                	je     80262b <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8025f6:	55                   	push   %rbp
+  8025f7:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025fa:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025fe:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802605:	00 00 00 
+  802608:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80260c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802611:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  802618:	00 00 00 
+  80261b:	ff d0                	call   *%rax
+  80261d:	48 85 c0             	test   %rax,%rax
+  802620:	0f 9f c0             	setg   %al
+}
+  802623:	5d                   	pop    %rbp
+  802624:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802625:	b8 00 00 00 00       	mov    $0x0,%eax
+  80262a:	c3                   	ret
+}
+  80262b:	c3                   	ret
+
+000000000080262c <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80262c:	55                   	push   %rbp
+  80262d:	48 89 e5             	mov    %rsp,%rbp
+  802630:	41 54                	push   %r12
+  802632:	53                   	push   %rbx
+  802633:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802636:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80263d:	00 00 00 
+  802640:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802645:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802649:	74 15                	je     802660 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80264b:	48 83 c3 01          	add    $0x1,%rbx
+  80264f:	48 83 c0 18          	add    $0x18,%rax
+  802653:	48 83 fb 20          	cmp    $0x20,%rbx
+  802657:	75 ec                	jne    802645 <mmap_alloc+0x19>
+    return NULL;
+  802659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265e:	eb 52                	jmp    8026b2 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802660:	4c 89 e7             	mov    %r12,%rdi
+  802663:	48 b8 96 40 80 00 00 	movabs $0x804096,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+  80266f:	41 89 c1             	mov    %eax,%r9d
+  802672:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802679:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80267d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802683:	ba 00 00 00 00       	mov    $0x0,%edx
+  802688:	4c 89 e6             	mov    %r12,%rsi
+  80268b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802690:	48 b8 2f 12 80 00 00 	movabs $0x80122f,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+  80269c:	85 c0                	test   %eax,%eax
+  80269e:	78 17                	js     8026b7 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8026a0:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8026a4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026ab:	00 00 00 
+  8026ae:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8026b2:	5b                   	pop    %rbx
+  8026b3:	41 5c                	pop    %r12
+  8026b5:	5d                   	pop    %rbp
+  8026b6:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026bc:	eb f4                	jmp    8026b2 <mmap_alloc+0x86>
+
+00000000008026be <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8026be:	55                   	push   %rbp
+  8026bf:	48 89 e5             	mov    %rsp,%rbp
+  8026c2:	41 56                	push   %r14
+  8026c4:	41 55                	push   %r13
+  8026c6:	41 54                	push   %r12
+  8026c8:	53                   	push   %rbx
+  8026c9:	48 83 ec 10          	sub    $0x10,%rsp
+  8026cd:	41 89 fc             	mov    %edi,%r12d
+  8026d0:	49 89 f5             	mov    %rsi,%r13
+  8026d3:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026d6:	48 89 f0             	mov    %rsi,%rax
+  8026d9:	48 09 d0             	or     %rdx,%rax
+  8026dc:	75 0d                	jne    8026eb <fsipc+0x2d>
+  8026de:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026e1:	83 f8 04             	cmp    $0x4,%eax
+  8026e4:	76 7d                	jbe    802763 <fsipc+0xa5>
+  8026e6:	83 ff 0d             	cmp    $0xd,%edi
+  8026e9:	74 78                	je     802763 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8026eb:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  8026f2:	00 00 00 
+  8026f5:	ff d0                	call   *%rax
+  8026f7:	89 c7                	mov    %eax,%edi
+  8026f9:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802700:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802707:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80270e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802714:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80271b:	00 00 00 
+  80271e:	44 89 e6             	mov    %r12d,%esi
+  802721:	48 b8 d6 46 80 00 00 	movabs $0x8046d6,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80272d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802734:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802735:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80273a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80273e:	4c 89 ee             	mov    %r13,%rsi
+  802741:	bf 00 00 00 00       	mov    $0x0,%edi
+  802746:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  80274d:	00 00 00 
+  802750:	ff d0                	call   *%rax
+  802752:	89 c3                	mov    %eax,%ebx
+}
+  802754:	89 d8                	mov    %ebx,%eax
+  802756:	48 83 c4 10          	add    $0x10,%rsp
+  80275a:	5b                   	pop    %rbx
+  80275b:	41 5c                	pop    %r12
+  80275d:	41 5d                	pop    %r13
+  80275f:	41 5e                	pop    %r14
+  802761:	5d                   	pop    %rbp
+  802762:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802763:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  80276a:	00 00 00 
+  80276d:	ff d0                	call   *%rax
+  80276f:	49 89 c6             	mov    %rax,%r14
+  802772:	48 85 c0             	test   %rax,%rax
+  802775:	0f 84 70 ff ff ff    	je     8026eb <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80277b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80277f:	48 b8 73 42 80 00 00 	movabs $0x804273,%rax
+  802786:	00 00 00 
+  802789:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80278b:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80278e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802795:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802799:	ba 10 00 00 00       	mov    $0x10,%edx
+  80279e:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8027a5:	00 00 00 
+  8027a8:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  8027af:	00 00 00 
+  8027b2:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8027b4:	4c 89 f7             	mov    %r14,%rdi
+  8027b7:	48 b8 0c 22 80 00 00 	movabs $0x80220c,%rax
+  8027be:	00 00 00 
+  8027c1:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8027c3:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027ca:	4c 89 f7             	mov    %r14,%rdi
+  8027cd:	48 b8 36 43 80 00 00 	movabs $0x804336,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027d9:	4c 89 f7             	mov    %r14,%rdi
+  8027dc:	48 b8 c4 42 80 00 00 	movabs $0x8042c4,%rax
+  8027e3:	00 00 00 
+  8027e6:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027e8:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8027eb:	41 83 fc 05          	cmp    $0x5,%r12d
+  8027ef:	75 04                	jne    8027f5 <fsipc+0x137>
+  8027f1:	85 db                	test   %ebx,%ebx
+  8027f3:	79 14                	jns    802809 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8027f5:	4c 89 f7             	mov    %r14,%rdi
+  8027f8:	48 b8 eb 42 80 00 00 	movabs $0x8042eb,%rax
+  8027ff:	00 00 00 
+  802802:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802804:	e9 4b ff ff ff       	jmp    802754 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802809:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80280d:	ba 88 00 00 00       	mov    $0x88,%edx
+  802812:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802819:	00 00 00 
+  80281c:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  802823:	00 00 00 
+  802826:	ff d0                	call   *%rax
+  802828:	eb cb                	jmp    8027f5 <fsipc+0x137>
+
+000000000080282a <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80282a:	55                   	push   %rbp
+  80282b:	48 89 e5             	mov    %rsp,%rbp
+  80282e:	41 57                	push   %r15
+  802830:	41 56                	push   %r14
+  802832:	41 55                	push   %r13
+  802834:	41 54                	push   %r12
+  802836:	53                   	push   %rbx
+  802837:	48 83 ec 18          	sub    $0x18,%rsp
+  80283b:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80283f:	49 89 f6             	mov    %rsi,%r14
+  802842:	49 89 d4             	mov    %rdx,%r12
+  802845:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802848:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802854:	48 85 c0             	test   %rax,%rax
+  802857:	0f 85 96 00 00 00    	jne    8028f3 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80285d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802864:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802865:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80286c:	00 00 00 
+    while (n) {
+  80286f:	4d 85 e4             	test   %r12,%r12
+  802872:	74 79                	je     8028ed <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802874:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802879:	49 39 dc             	cmp    %rbx,%r12
+  80287c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802880:	48 89 da             	mov    %rbx,%rdx
+  802883:	4c 89 f6             	mov    %r14,%rsi
+  802886:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80288d:	00 00 00 
+  802890:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  802897:	00 00 00 
+  80289a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80289c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028a0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028a3:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8028a6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8028a9:	44 01 e8             	add    %r13d,%eax
+  8028ac:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8028b0:	41 0f 44 c5          	cmove  %r13d,%eax
+  8028b4:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8028b8:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8028bc:	48 89 da             	mov    %rbx,%rdx
+  8028bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8028c4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028c9:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8028d0:	00 00 00 
+  8028d3:	ff d0                	call   *%rax
+        if (res < 0)
+  8028d5:	85 c0                	test   %eax,%eax
+  8028d7:	78 4a                	js     802923 <devfile_write_direct+0xf9>
+        buf += res;
+  8028d9:	48 98                	cltq
+  8028db:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028de:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028e2:	49 29 c4             	sub    %rax,%r12
+  8028e5:	75 8d                	jne    802874 <devfile_write_direct+0x4a>
+    return write;
+  8028e7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028eb:	eb 27                	jmp    802914 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8028ed:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8028f1:	eb f4                	jmp    8028e7 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028f3:	45 89 e9             	mov    %r13d,%r9d
+  8028f6:	4d 89 e0             	mov    %r12,%r8
+  8028f9:	4c 89 f1             	mov    %r14,%rcx
+  8028fc:	ba 04 00 00 00       	mov    $0x4,%edx
+  802901:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802905:	48 89 c7             	mov    %rax,%rdi
+  802908:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  80290f:	00 00 00 
+  802912:	ff d0                	call   *%rax
+}
+  802914:	48 83 c4 18          	add    $0x18,%rsp
+  802918:	5b                   	pop    %rbx
+  802919:	41 5c                	pop    %r12
+  80291b:	41 5d                	pop    %r13
+  80291d:	41 5e                	pop    %r14
+  80291f:	41 5f                	pop    %r15
+  802921:	5d                   	pop    %rbp
+  802922:	c3                   	ret
+            return res;
+  802923:	48 98                	cltq
+  802925:	eb ed                	jmp    802914 <devfile_write_direct+0xea>
+
+0000000000802927 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802927:	55                   	push   %rbp
+  802928:	48 89 e5             	mov    %rsp,%rbp
+  80292b:	41 54                	push   %r12
+  80292d:	53                   	push   %rbx
+  80292e:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802931:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  802938:	00 00 00 
+  80293b:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80293d:	48 85 c0             	test   %rax,%rax
+  802940:	74 71                	je     8029b3 <fbuf_flush+0x8c>
+  802942:	48 89 c3             	mov    %rax,%rbx
+  802945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80294a:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80294e:	75 05                	jne    802955 <fbuf_flush+0x2e>
+}
+  802950:	5b                   	pop    %rbx
+  802951:	41 5c                	pop    %r12
+  802953:	5d                   	pop    %rbp
+  802954:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802955:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802958:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80295c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802963:	00 00 00 
+  802966:	48 89 de             	mov    %rbx,%rsi
+  802969:	48 29 c6             	sub    %rax,%rsi
+  80296c:	48 c1 fe 03          	sar    $0x3,%rsi
+  802970:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802977:	aa aa aa 
+  80297a:	48 0f af f0          	imul   %rax,%rsi
+  80297e:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802982:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802987:	48 01 c6             	add    %rax,%rsi
+  80298a:	4c 89 e7             	mov    %r12,%rdi
+  80298d:	48 b8 2a 28 80 00 00 	movabs $0x80282a,%rax
+  802994:	00 00 00 
+  802997:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802999:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80299d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8029a4:	00 
+    return res < 0 ? res : 0;
+  8029a5:	48 85 c0             	test   %rax,%rax
+  8029a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029ad:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8029b1:	eb 9d                	jmp    802950 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8029b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029b8:	eb 96                	jmp    802950 <fbuf_flush+0x29>
+
+00000000008029ba <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8029ba:	55                   	push   %rbp
+  8029bb:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8029be:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  8029c5:	00 00 00 
+  8029c8:	ff d0                	call   *%rax
+}
+  8029ca:	5d                   	pop    %rbp
+  8029cb:	c3                   	ret
+
+00000000008029cc <devfile_write>:
+    if (!fd || !buf)
+  8029cc:	48 85 ff             	test   %rdi,%rdi
+  8029cf:	0f 84 d3 01 00 00    	je     802ba8 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029d5:	55                   	push   %rbp
+  8029d6:	48 89 e5             	mov    %rsp,%rbp
+  8029d9:	41 57                	push   %r15
+  8029db:	41 56                	push   %r14
+  8029dd:	41 55                	push   %r13
+  8029df:	41 54                	push   %r12
+  8029e1:	53                   	push   %rbx
+  8029e2:	48 83 ec 08          	sub    $0x8,%rsp
+  8029e6:	49 89 fc             	mov    %rdi,%r12
+  8029e9:	49 89 f6             	mov    %rsi,%r14
+  8029ec:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8029ef:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8029f4:	48 85 f6             	test   %rsi,%rsi
+  8029f7:	0f 84 9c 01 00 00    	je     802b99 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8029fd:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+  802a09:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a0c:	48 85 c0             	test   %rax,%rax
+  802a0f:	0f 84 a2 00 00 00    	je     802ab7 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a15:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a1a:	4c 89 e7             	mov    %r12,%rdi
+  802a1d:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  802a24:	00 00 00 
+  802a27:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a29:	83 f8 02             	cmp    $0x2,%eax
+  802a2c:	0f 8f 85 00 00 00    	jg     802ab7 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a32:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a39:	00 00 00 
+  802a3c:	4d 89 ef             	mov    %r13,%r15
+  802a3f:	49 29 c7             	sub    %rax,%r15
+  802a42:	49 c1 ff 03          	sar    $0x3,%r15
+  802a46:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a4d:	aa aa aa 
+  802a50:	4c 0f af f8          	imul   %rax,%r15
+  802a54:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a58:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a5d:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a60:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a65:	0f 84 d7 00 00 00    	je     802b42 <devfile_write+0x176>
+  802a6b:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a6f:	89 c2                	mov    %eax,%edx
+  802a71:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a75:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a7a:	75 0f                	jne    802a8b <devfile_write+0xbf>
+  802a7c:	48 01 d8             	add    %rbx,%rax
+  802a7f:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a85:	0f 86 92 00 00 00    	jbe    802b1d <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a8b:	4c 89 e7             	mov    %r12,%rdi
+  802a8e:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  802a95:	00 00 00 
+  802a98:	ff d0                	call   *%rax
+  802a9a:	85 c0                	test   %eax,%eax
+  802a9c:	78 52                	js     802af0 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a9e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802aa5:	77 7f                	ja     802b26 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802aa7:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802aac:	0f 85 c2 00 00 00    	jne    802b74 <devfile_write+0x1a8>
+  802ab2:	e9 94 00 00 00       	jmp    802b4b <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802ab7:	4c 89 e7             	mov    %r12,%rdi
+  802aba:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  802ac1:	00 00 00 
+  802ac4:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ac6:	85 c0                	test   %eax,%eax
+  802ac8:	79 07                	jns    802ad1 <devfile_write+0x105>
+  802aca:	48 98                	cltq
+  802acc:	e9 c8 00 00 00       	jmp    802b99 <devfile_write+0x1cd>
+  802ad1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ad6:	48 89 da             	mov    %rbx,%rdx
+  802ad9:	4c 89 f6             	mov    %r14,%rsi
+  802adc:	4c 89 e7             	mov    %r12,%rdi
+  802adf:	48 b8 2a 28 80 00 00 	movabs $0x80282a,%rax
+  802ae6:	00 00 00 
+  802ae9:	ff d0                	call   *%rax
+  802aeb:	e9 a9 00 00 00       	jmp    802b99 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802af0:	48 98                	cltq
+  802af2:	e9 a2 00 00 00       	jmp    802b99 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802af7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802afc:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b01:	4c 89 fe             	mov    %r15,%rsi
+  802b04:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b09:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  802b10:	00 00 00 
+  802b13:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	79 45                	jns    802b5e <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b19:	48 98                	cltq
+  802b1b:	eb 7c                	jmp    802b99 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b1d:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b24:	76 4e                	jbe    802b74 <devfile_write+0x1a8>
+  802b26:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b2b:	48 89 da             	mov    %rbx,%rdx
+  802b2e:	4c 89 f6             	mov    %r14,%rsi
+  802b31:	4c 89 e7             	mov    %r12,%rdi
+  802b34:	48 b8 2a 28 80 00 00 	movabs $0x80282a,%rax
+  802b3b:	00 00 00 
+  802b3e:	ff d0                	call   *%rax
+  802b40:	eb 57                	jmp    802b99 <devfile_write+0x1cd>
+  802b42:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b49:	77 db                	ja     802b26 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b4b:	4c 89 ff             	mov    %r15,%rdi
+  802b4e:	48 b8 f5 40 80 00 00 	movabs $0x8040f5,%rax
+  802b55:	00 00 00 
+  802b58:	ff d0                	call   *%rax
+  802b5a:	84 c0                	test   %al,%al
+  802b5c:	74 99                	je     802af7 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b5e:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b63:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b68:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b6c:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b73:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b74:	4c 89 ff             	mov    %r15,%rdi
+  802b77:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b7b:	48 89 da             	mov    %rbx,%rdx
+  802b7e:	4c 89 f6             	mov    %r14,%rsi
+  802b81:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  802b88:	00 00 00 
+  802b8b:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b8d:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b91:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b96:	48 89 d8             	mov    %rbx,%rax
+}
+  802b99:	48 83 c4 08          	add    $0x8,%rsp
+  802b9d:	5b                   	pop    %rbx
+  802b9e:	41 5c                	pop    %r12
+  802ba0:	41 5d                	pop    %r13
+  802ba2:	41 5e                	pop    %r14
+  802ba4:	41 5f                	pop    %r15
+  802ba6:	5d                   	pop    %rbp
+  802ba7:	c3                   	ret
+        return E_INVAL;
+  802ba8:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802bad:	c3                   	ret
+
+0000000000802bae <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802bae:	55                   	push   %rbp
+  802baf:	48 89 e5             	mov    %rsp,%rbp
+  802bb2:	41 54                	push   %r12
+  802bb4:	53                   	push   %rbx
+  802bb5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802bb8:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  802bbf:	00 00 00 
+  802bc2:	ff d0                	call   *%rax
+  802bc4:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802bc7:	48 89 df             	mov    %rbx,%rdi
+  802bca:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  802bd1:	00 00 00 
+  802bd4:	ff d0                	call   *%rax
+  802bd6:	48 85 c0             	test   %rax,%rax
+  802bd9:	74 17                	je     802bf2 <devfile_flush+0x44>
+  802bdb:	48 89 df             	mov    %rbx,%rdi
+  802bde:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  802be5:	00 00 00 
+  802be8:	ff d0                	call   *%rax
+  802bea:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802bf1:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bf2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bf5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802bfc:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802bfe:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c03:	be 00 00 00 00       	mov    $0x0,%esi
+  802c08:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c0d:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  802c14:	00 00 00 
+  802c17:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c19:	45 85 e4             	test   %r12d,%r12d
+  802c1c:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c20:	5b                   	pop    %rbx
+  802c21:	41 5c                	pop    %r12
+  802c23:	5d                   	pop    %rbp
+  802c24:	c3                   	ret
+
+0000000000802c25 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c25:	55                   	push   %rbp
+  802c26:	48 89 e5             	mov    %rsp,%rbp
+  802c29:	41 57                	push   %r15
+  802c2b:	41 56                	push   %r14
+  802c2d:	41 55                	push   %r13
+  802c2f:	41 54                	push   %r12
+  802c31:	53                   	push   %rbx
+  802c32:	48 83 ec 38          	sub    $0x38,%rsp
+  802c36:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c3a:	49 89 f7             	mov    %rsi,%r15
+  802c3d:	48 89 d3             	mov    %rdx,%rbx
+  802c40:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c43:	48 b8 70 21 80 00 00 	movabs $0x802170,%rax
+  802c4a:	00 00 00 
+  802c4d:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c4f:	48 85 c0             	test   %rax,%rax
+  802c52:	75 20                	jne    802c74 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c54:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c59:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c60:	00 
+    while (n) {
+  802c61:	48 85 db             	test   %rbx,%rbx
+  802c64:	0f 85 df 00 00 00    	jne    802d49 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c6a:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c6e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c72:	eb 21                	jmp    802c95 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c74:	45 89 f1             	mov    %r14d,%r9d
+  802c77:	49 89 d8             	mov    %rbx,%r8
+  802c7a:	4c 89 f9             	mov    %r15,%rcx
+  802c7d:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c82:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c86:	48 89 c7             	mov    %rax,%rdi
+  802c89:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+}
+  802c95:	48 83 c4 38          	add    $0x38,%rsp
+  802c99:	5b                   	pop    %rbx
+  802c9a:	41 5c                	pop    %r12
+  802c9c:	41 5d                	pop    %r13
+  802c9e:	41 5e                	pop    %r14
+  802ca0:	41 5f                	pop    %r15
+  802ca2:	5d                   	pop    %rbp
+  802ca3:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ca4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ca8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cae:	75 1e                	jne    802cce <devfile_read_direct+0xa9>
+  802cb0:	e9 e2 00 00 00       	jmp    802d97 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802cb5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cb9:	eb da                	jmp    802c95 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802cbb:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802cbf:	0f 85 d0 01 00 00    	jne    802e95 <devfile_read_direct+0x270>
+            map = 0;
+  802cc5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cc9:	eb 03                	jmp    802cce <devfile_read_direct+0xa9>
+  802ccb:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802cce:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cd3:	48 39 d3             	cmp    %rdx,%rbx
+  802cd6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cda:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cde:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ce1:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802ce8:	00 00 00 
+  802ceb:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802ced:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802cf1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802cf5:	be 00 00 00 00       	mov    $0x0,%esi
+  802cfa:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cff:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  802d06:	00 00 00 
+  802d09:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d0b:	85 c0                	test   %eax,%eax
+  802d0d:	0f 8e 63 01 00 00    	jle    802e76 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d13:	4c 63 e0             	movslq %eax,%r12
+  802d16:	4c 89 e2             	mov    %r12,%rdx
+  802d19:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d20:	00 00 00 
+  802d23:	4c 89 ff             	mov    %r15,%rdi
+  802d26:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  802d2d:	00 00 00 
+  802d30:	ff d0                	call   *%rax
+        buf += res;
+  802d32:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d35:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d38:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d3c:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d40:	48 85 db             	test   %rbx,%rbx
+  802d43:	0f 84 25 ff ff ff    	je     802c6e <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d49:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d4c:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d50:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d54:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d58:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d5f:	0f 97 c2             	seta   %dl
+  802d62:	20 c2                	and    %al,%dl
+  802d64:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d67:	0f 84 5e ff ff ff    	je     802ccb <devfile_read_direct+0xa6>
+  802d6d:	4c 89 fa             	mov    %r15,%rdx
+  802d70:	4d 89 fd             	mov    %r15,%r13
+  802d73:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d7a:	0f 85 4e ff ff ff    	jne    802cce <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d80:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d84:	0f 84 1a ff ff ff    	je     802ca4 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d8a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d91:	0f 85 37 ff ff ff    	jne    802cce <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d97:	48 89 d8             	mov    %rbx,%rax
+  802d9a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802da0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802da5:	48 39 c8             	cmp    %rcx,%rax
+  802da8:	48 0f 47 c1          	cmova  %rcx,%rax
+  802dac:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802db0:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802db4:	49 89 d4             	mov    %rdx,%r12
+  802db7:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802dbb:	48 b8 96 40 80 00 00 	movabs $0x804096,%rax
+  802dc2:	00 00 00 
+  802dc5:	ff d0                	call   *%rax
+  802dc7:	a8 40                	test   $0x40,%al
+  802dc9:	0f 85 b9 00 00 00    	jne    802e88 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802dcf:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802dd6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802dda:	49 39 c5             	cmp    %rax,%r13
+  802ddd:	72 d8                	jb     802db7 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ddf:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802de3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802dea:	00 00 00 
+  802ded:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802df1:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802df4:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802df6:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802dfa:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802dfe:	48 b8 0b 20 80 00 00 	movabs $0x80200b,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+  802e0a:	89 c7                	mov    %eax,%edi
+  802e0c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e12:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e17:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e1e:	00 00 00 
+  802e21:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e26:	48 b8 d6 46 80 00 00 	movabs $0x8046d6,%rax
+  802e2d:	00 00 00 
+  802e30:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e32:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e37:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e3b:	4c 89 fe             	mov    %r15,%rsi
+  802e3e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e43:	48 b8 b2 46 80 00 00 	movabs $0x8046b2,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+  802e4f:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e52:	48 85 d2             	test   %rdx,%rdx
+  802e55:	0f 84 5a fe ff ff    	je     802cb5 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e5b:	0f 8e 5a fe ff ff    	jle    802cbb <devfile_read_direct+0x96>
+                buf += res;
+  802e61:	48 98                	cltq
+  802e63:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e66:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e69:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e6d:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e71:	e9 ca fe ff ff       	jmp    802d40 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e76:	41 89 c5             	mov    %eax,%r13d
+  802e79:	48 98                	cltq
+  802e7b:	45 85 ed             	test   %r13d,%r13d
+  802e7e:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e83:	e9 0d fe ff ff       	jmp    802c95 <devfile_read_direct+0x70>
+            map = 0;
+  802e88:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e8c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e90:	e9 39 fe ff ff       	jmp    802cce <devfile_read_direct+0xa9>
+  802e95:	48 89 d0             	mov    %rdx,%rax
+  802e98:	e9 f8 fd ff ff       	jmp    802c95 <devfile_read_direct+0x70>
+
+0000000000802e9d <devfile_read>:
+    if (!fd || !buf)
+  802e9d:	48 85 ff             	test   %rdi,%rdi
+  802ea0:	0f 84 21 02 00 00    	je     8030c7 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802ea6:	55                   	push   %rbp
+  802ea7:	48 89 e5             	mov    %rsp,%rbp
+  802eaa:	41 57                	push   %r15
+  802eac:	41 56                	push   %r14
+  802eae:	41 55                	push   %r13
+  802eb0:	41 54                	push   %r12
+  802eb2:	53                   	push   %rbx
+  802eb3:	48 83 ec 28          	sub    $0x28,%rsp
+  802eb7:	48 89 fb             	mov    %rdi,%rbx
+  802eba:	49 89 f4             	mov    %rsi,%r12
+  802ebd:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ec0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ec5:	48 85 f6             	test   %rsi,%rsi
+  802ec8:	74 4b                	je     802f15 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802eca:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+  802ed6:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ed9:	48 85 c0             	test   %rax,%rax
+  802edc:	74 22                	je     802f00 <devfile_read+0x63>
+  802ede:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ee5:	77 19                	ja     802f00 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ee7:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eec:	48 89 df             	mov    %rbx,%rdi
+  802eef:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  802ef6:	00 00 00 
+  802ef9:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802efb:	83 f8 02             	cmp    $0x2,%eax
+  802efe:	7e 40                	jle    802f40 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f00:	48 89 df             	mov    %rbx,%rdi
+  802f03:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  802f0a:	00 00 00 
+  802f0d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f0f:	85 c0                	test   %eax,%eax
+  802f11:	79 11                	jns    802f24 <devfile_read+0x87>
+  802f13:	48 98                	cltq
+}
+  802f15:	48 83 c4 28          	add    $0x28,%rsp
+  802f19:	5b                   	pop    %rbx
+  802f1a:	41 5c                	pop    %r12
+  802f1c:	41 5d                	pop    %r13
+  802f1e:	41 5e                	pop    %r14
+  802f20:	41 5f                	pop    %r15
+  802f22:	5d                   	pop    %rbp
+  802f23:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f24:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f29:	4c 89 ea             	mov    %r13,%rdx
+  802f2c:	4c 89 e6             	mov    %r12,%rsi
+  802f2f:	48 89 df             	mov    %rbx,%rdi
+  802f32:	48 b8 25 2c 80 00 00 	movabs $0x802c25,%rax
+  802f39:	00 00 00 
+  802f3c:	ff d0                	call   *%rax
+  802f3e:	eb d5                	jmp    802f15 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f40:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f44:	48 89 df             	mov    %rbx,%rdi
+  802f47:	48 b8 27 29 80 00 00 	movabs $0x802927,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	85 c0                	test   %eax,%eax
+  802f55:	0f 88 33 01 00 00    	js     80308e <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f5b:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f62:	00 00 00 
+  802f65:	4c 89 f0             	mov    %r14,%rax
+  802f68:	48 29 d0             	sub    %rdx,%rax
+  802f6b:	48 c1 f8 03          	sar    $0x3,%rax
+  802f6f:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f76:	aa aa aa 
+  802f79:	48 0f af c2          	imul   %rdx,%rax
+  802f7d:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f81:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f85:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f88:	41 39 06             	cmp    %eax,(%r14)
+  802f8b:	75 0d                	jne    802f9a <devfile_read+0xfd>
+  802f8d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f90:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f94:	0f 84 fb 00 00 00    	je     803095 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f9a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f9f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802fa3:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802fa6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802faa:	48 89 c7             	mov    %rax,%rdi
+  802fad:	48 b8 f5 40 80 00 00 	movabs $0x8040f5,%rax
+  802fb4:	00 00 00 
+  802fb7:	ff d0                	call   *%rax
+  802fb9:	84 c0                	test   %al,%al
+  802fbb:	75 27                	jne    802fe4 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fbd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802fc2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fc7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fd0:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  802fd7:	00 00 00 
+  802fda:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	0f 88 dc 00 00 00    	js     8030c0 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802fe4:	44 89 f8             	mov    %r15d,%eax
+  802fe7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802fec:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802fee:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ff5:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ff6:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ff9:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ffd:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803000:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803005:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803009:	48 89 df             	mov    %rbx,%rdi
+  80300c:	48 b8 25 2c 80 00 00 	movabs $0x802c25,%rax
+  803013:	00 00 00 
+  803016:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803018:	48 85 c0             	test   %rax,%rax
+  80301b:	0f 88 f4 fe ff ff    	js     802f15 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803021:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803024:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803027:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80302a:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80302e:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803032:	48 63 d1             	movslq %ecx,%rdx
+  803035:	48 01 d0             	add    %rdx,%rax
+  803038:	4d 63 ff             	movslq %r15d,%r15
+  80303b:	4c 29 f8             	sub    %r15,%rax
+  80303e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803043:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803047:	48 85 c0             	test   %rax,%rax
+  80304a:	0f 8e c5 fe ff ff    	jle    802f15 <devfile_read+0x78>
+    n = MIN(n, res);
+  803050:	4c 39 e8             	cmp    %r13,%rax
+  803053:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803057:	8b 73 04             	mov    0x4(%rbx),%esi
+  80305a:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80305e:	48 63 f6             	movslq %esi,%rsi
+  803061:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803066:	48 01 c6             	add    %rax,%rsi
+  803069:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80306d:	48 01 c6             	add    %rax,%rsi
+  803070:	4c 89 ea             	mov    %r13,%rdx
+  803073:	4c 89 e7             	mov    %r12,%rdi
+  803076:	48 b8 db 0e 80 00 00 	movabs $0x800edb,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803082:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803086:	4c 89 e8             	mov    %r13,%rax
+  803089:	e9 87 fe ff ff       	jmp    802f15 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80308e:	48 98                	cltq
+  803090:	e9 80 fe ff ff       	jmp    802f15 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803095:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803099:	41 39 d7             	cmp    %edx,%r15d
+  80309c:	0f 8c f8 fe ff ff    	jl     802f9a <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030a2:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8030a6:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8030a9:	41 39 cf             	cmp    %ecx,%r15d
+  8030ac:	0f 8d e8 fe ff ff    	jge    802f9a <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8030b2:	4d 63 ff             	movslq %r15d,%r15
+  8030b5:	4c 29 f8             	sub    %r15,%rax
+  8030b8:	48 63 d2             	movslq %edx,%rdx
+  8030bb:	48 01 d0             	add    %rdx,%rax
+  8030be:	eb 87                	jmp    803047 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030c0:	48 98                	cltq
+  8030c2:	e9 4e fe ff ff       	jmp    802f15 <devfile_read+0x78>
+        return E_INVAL;
+  8030c7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030cc:	c3                   	ret
+
+00000000008030cd <fs_channel>:
+fs_channel(bool enable) {
+  8030cd:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030cf:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030d6:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030dd:	40 84 ff             	test   %dil,%dil
+  8030e0:	74 47                	je     803129 <fs_channel+0x5c>
+  8030e2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8030e9:	00 00 00 
+  8030ec:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8030f2:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8030f9:	00 00 00 
+  8030fc:	3b 08                	cmp    (%rax),%ecx
+  8030fe:	74 29                	je     803129 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803100:	55                   	push   %rbp
+  803101:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803104:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  80310b:	00 00 00 
+  80310e:	ff d0                	call   *%rax
+  803110:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803112:	85 c0                	test   %eax,%eax
+  803114:	78 04                	js     80311a <fs_channel+0x4d>
+}
+  803116:	89 d0                	mov    %edx,%eax
+  803118:	5d                   	pop    %rbp
+  803119:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  80311a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803121:	00 00 00 
+  803124:	c6 00 00             	movb   $0x0,(%rax)
+  803127:	eb ed                	jmp    803116 <fs_channel+0x49>
+}
+  803129:	89 d0                	mov    %edx,%eax
+  80312b:	c3                   	ret
+
+000000000080312c <open>:
+open(const char *path, int mode) {
+  80312c:	55                   	push   %rbp
+  80312d:	48 89 e5             	mov    %rsp,%rbp
+  803130:	41 55                	push   %r13
+  803132:	41 54                	push   %r12
+  803134:	53                   	push   %rbx
+  803135:	48 83 ec 18          	sub    $0x18,%rsp
+  803139:	49 89 fc             	mov    %rdi,%r12
+  80313c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80313f:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+  80314b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803151:	0f 87 8f 00 00 00    	ja     8031e6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803157:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80315b:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  803162:	00 00 00 
+  803165:	ff d0                	call   *%rax
+  803167:	89 c3                	mov    %eax,%ebx
+  803169:	85 c0                	test   %eax,%eax
+  80316b:	78 55                	js     8031c2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80316d:	4c 89 e6             	mov    %r12,%rsi
+  803170:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803177:	00 00 00 
+  80317a:	48 89 df             	mov    %rbx,%rdi
+  80317d:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  803184:	00 00 00 
+  803187:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803189:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803190:	ba 00 00 00 00       	mov    $0x0,%edx
+  803195:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803199:	bf 01 00 00 00       	mov    $0x1,%edi
+  80319e:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8031a5:	00 00 00 
+  8031a8:	ff d0                	call   *%rax
+  8031aa:	89 c3                	mov    %eax,%ebx
+  8031ac:	85 c0                	test   %eax,%eax
+  8031ae:	78 1f                	js     8031cf <open+0xa3>
+    return fd2num(fd);
+  8031b0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031b4:	48 b8 d9 18 80 00 00 	movabs $0x8018d9,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+  8031c0:	89 c3                	mov    %eax,%ebx
+}
+  8031c2:	89 d8                	mov    %ebx,%eax
+  8031c4:	48 83 c4 18          	add    $0x18,%rsp
+  8031c8:	5b                   	pop    %rbx
+  8031c9:	41 5c                	pop    %r12
+  8031cb:	41 5d                	pop    %r13
+  8031cd:	5d                   	pop    %rbp
+  8031ce:	c3                   	ret
+        fd_close(fd, 0);
+  8031cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8031d4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031d8:	48 b8 22 1a 80 00 00 	movabs $0x801a22,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+        return res;
+  8031e4:	eb dc                	jmp    8031c2 <open+0x96>
+        return -E_BAD_PATH;
+  8031e6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031eb:	eb d5                	jmp    8031c2 <open+0x96>
+
+00000000008031ed <file_flush_buffers>:
+file_flush_buffers(void) {
+  8031ed:	55                   	push   %rbp
+  8031ee:	48 89 e5             	mov    %rsp,%rbp
+  8031f1:	41 56                	push   %r14
+  8031f3:	41 55                	push   %r13
+  8031f5:	41 54                	push   %r12
+  8031f7:	53                   	push   %rbx
+  8031f8:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8031fc:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803203:	00 00 00 
+  803206:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80320b:	49 bd 67 19 80 00 00 	movabs $0x801967,%r13
+  803212:	00 00 00 
+  803215:	49 be 27 29 80 00 00 	movabs $0x802927,%r14
+  80321c:	00 00 00 
+  80321f:	eb 0c                	jmp    80322d <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803221:	83 c3 01             	add    $0x1,%ebx
+  803224:	49 83 c4 18          	add    $0x18,%r12
+  803228:	83 fb 20             	cmp    $0x20,%ebx
+  80322b:	74 1d                	je     80324a <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80322d:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803232:	74 ed                	je     803221 <file_flush_buffers+0x34>
+  803234:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803238:	89 df                	mov    %ebx,%edi
+  80323a:	41 ff d5             	call   *%r13
+  80323d:	85 c0                	test   %eax,%eax
+  80323f:	78 e0                	js     803221 <file_flush_buffers+0x34>
+  803241:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803245:	41 ff d6             	call   *%r14
+  803248:	eb d7                	jmp    803221 <file_flush_buffers+0x34>
+}
+  80324a:	48 83 c4 10          	add    $0x10,%rsp
+  80324e:	5b                   	pop    %rbx
+  80324f:	41 5c                	pop    %r12
+  803251:	41 5d                	pop    %r13
+  803253:	41 5e                	pop    %r14
+  803255:	5d                   	pop    %rbp
+  803256:	c3                   	ret
+
+0000000000803257 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803257:	55                   	push   %rbp
+  803258:	48 89 e5             	mov    %rsp,%rbp
+  80325b:	41 54                	push   %r12
+  80325d:	53                   	push   %rbx
+  80325e:	49 89 fc             	mov    %rdi,%r12
+  803261:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803263:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80326f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803276:	00 00 00 
+  803279:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80327e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803280:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803283:	ba 00 00 00 00       	mov    $0x0,%edx
+  803288:	be 00 00 00 00       	mov    $0x0,%esi
+  80328d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803292:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  803299:	00 00 00 
+  80329c:	ff d0                	call   *%rax
+}
+  80329e:	5b                   	pop    %rbx
+  80329f:	41 5c                	pop    %r12
+  8032a1:	5d                   	pop    %rbp
+  8032a2:	c3                   	ret
+
+00000000008032a3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8032a3:	55                   	push   %rbp
+  8032a4:	48 89 e5             	mov    %rsp,%rbp
+  8032a7:	41 54                	push   %r12
+  8032a9:	53                   	push   %rbx
+  8032aa:	49 89 fc             	mov    %rdi,%r12
+  8032ad:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8032b0:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  8032b7:	00 00 00 
+  8032ba:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8032bc:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8032c1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032c8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032d9:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8032e0:	00 00 00 
+  8032e3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032e5:	85 c0                	test   %eax,%eax
+  8032e7:	78 3d                	js     803326 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032e9:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8032f0:	00 00 00 
+  8032f3:	4c 89 e6             	mov    %r12,%rsi
+  8032f6:	48 89 df             	mov    %rbx,%rdi
+  8032f9:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803305:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80330c:	00 
+  80330d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803313:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80331a:	00 
+  80331b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803321:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803326:	5b                   	pop    %rbx
+  803327:	41 5c                	pop    %r12
+  803329:	5d                   	pop    %rbp
+  80332a:	c3                   	ret
+
+000000000080332b <remove>:
+remove(const char *path) {
+  80332b:	55                   	push   %rbp
+  80332c:	48 89 e5             	mov    %rsp,%rbp
+  80332f:	53                   	push   %rbx
+  803330:	48 83 ec 08          	sub    $0x8,%rsp
+  803334:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803337:	48 b8 3c 0c 80 00 00 	movabs $0x800c3c,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+  803343:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803349:	77 3a                	ja     803385 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80334b:	48 89 de             	mov    %rbx,%rsi
+  80334e:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803355:	00 00 00 
+  803358:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  80335f:	00 00 00 
+  803362:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803364:	ba 00 00 00 00       	mov    $0x0,%edx
+  803369:	be 00 00 00 00       	mov    $0x0,%esi
+  80336e:	bf 07 00 00 00       	mov    $0x7,%edi
+  803373:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  80337a:	00 00 00 
+  80337d:	ff d0                	call   *%rax
+}
+  80337f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803383:	c9                   	leave
+  803384:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803385:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80338a:	eb f3                	jmp    80337f <remove+0x54>
+
+000000000080338c <sync>:
+sync(void) {
+  80338c:	55                   	push   %rbp
+  80338d:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803390:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  803397:	00 00 00 
+  80339a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80339c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8033a6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8033ab:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8033b2:	00 00 00 
+  8033b5:	ff d0                	call   *%rax
+}
+  8033b7:	5d                   	pop    %rbp
+  8033b8:	c3                   	ret
+
+00000000008033b9 <fsync>:
+fsync(int fdnum) {
+  8033b9:	55                   	push   %rbp
+  8033ba:	48 89 e5             	mov    %rsp,%rbp
+  8033bd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033c1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033c5:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  8033cc:	00 00 00 
+  8033cf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033d1:	85 c0                	test   %eax,%eax
+  8033d3:	78 4b                	js     803420 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033d5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033d9:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8033e0:	00 00 00 
+  8033e3:	8b 00                	mov    (%rax),%eax
+  8033e5:	39 02                	cmp    %eax,(%rdx)
+  8033e7:	75 39                	jne    803422 <fsync+0x69>
+    file_flush_buffers();
+  8033e9:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8033f5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033f9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033fc:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803403:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803405:	ba 00 00 00 00       	mov    $0x0,%edx
+  80340a:	be 00 00 00 00       	mov    $0x0,%esi
+  80340f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803414:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  80341b:	00 00 00 
+  80341e:	ff d0                	call   *%rax
+}
+  803420:	c9                   	leave
+  803421:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803422:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803427:	eb f7                	jmp    803420 <fsync+0x67>
+
+0000000000803429 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803429:	55                   	push   %rbp
+  80342a:	48 89 e5             	mov    %rsp,%rbp
+  80342d:	53                   	push   %rbx
+  80342e:	48 83 ec 08          	sub    $0x8,%rsp
+  803432:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80343a:	be 00 00 00 00       	mov    $0x0,%esi
+  80343f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803444:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803450:	85 c0                	test   %eax,%eax
+  803452:	78 2d                	js     803481 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803454:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80345b:	00 00 00 
+  80345e:	48 8b 10             	mov    (%rax),%rdx
+  803461:	48 89 13             	mov    %rdx,(%rbx)
+  803464:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803468:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80346c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803470:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803474:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803478:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80347c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803481:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803485:	c9                   	leave
+  803486:	c3                   	ret
+
+0000000000803487 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803487:	55                   	push   %rbp
+  803488:	48 89 e5             	mov    %rsp,%rbp
+  80348b:	53                   	push   %rbx
+  80348c:	48 83 ec 08          	sub    $0x8,%rsp
+  803490:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803493:	ba 00 00 00 00       	mov    $0x0,%edx
+  803498:	be 00 00 00 00       	mov    $0x0,%esi
+  80349d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8034a2:	48 b8 be 26 80 00 00 	movabs $0x8026be,%rax
+  8034a9:	00 00 00 
+  8034ac:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034ae:	85 c0                	test   %eax,%eax
+  8034b0:	78 3d                	js     8034ef <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8034b2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034b9:	00 00 00 
+  8034bc:	48 8b 10             	mov    (%rax),%rdx
+  8034bf:	48 89 13             	mov    %rdx,(%rbx)
+  8034c2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034c6:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034ca:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034ce:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034d2:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034d6:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034da:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034de:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034e2:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034e6:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8034ea:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034ef:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034f3:	c9                   	leave
+  8034f4:	c3                   	ret
+
+00000000008034f5 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8034f5:	55                   	push   %rbp
+  8034f6:	48 89 e5             	mov    %rsp,%rbp
+  8034f9:	41 57                	push   %r15
+  8034fb:	41 56                	push   %r14
+  8034fd:	41 55                	push   %r13
+  8034ff:	41 54                	push   %r12
+  803501:	53                   	push   %rbx
+  803502:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803506:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80350d:	00 
+  80350e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803515:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80351b:	0f 85 43 01 00 00    	jne    803664 <munmap+0x16f>
+  803521:	49 89 ff             	mov    %rdi,%r15
+  803524:	4c 39 f7             	cmp    %r14,%rdi
+  803527:	0f 87 37 01 00 00    	ja     803664 <munmap+0x16f>
+  80352d:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803534:	00 00 00 
+  803537:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80353d:	eb 2c                	jmp    80356b <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80353f:	4c 39 f8             	cmp    %r15,%rax
+  803542:	0f 83 85 00 00 00    	jae    8035cd <munmap+0xd8>
+            m->mm_end = start;
+  803548:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80354d:	48 83 c3 18          	add    $0x18,%rbx
+  803551:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803558:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80355f:	00 00 00 
+  803562:	48 39 c3             	cmp    %rax,%rbx
+  803565:	0f 84 d0 00 00 00    	je     80363b <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80356b:	49 89 dc             	mov    %rbx,%r12
+  80356e:	48 8b 03             	mov    (%rbx),%rax
+  803571:	4c 39 f0             	cmp    %r14,%rax
+  803574:	73 d7                	jae    80354d <munmap+0x58>
+  803576:	48 85 c0             	test   %rax,%rax
+  803579:	74 d2                	je     80354d <munmap+0x58>
+  80357b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80357f:	49 39 d7             	cmp    %rdx,%r15
+  803582:	73 c9                	jae    80354d <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803584:	49 39 d6             	cmp    %rdx,%r14
+  803587:	73 b6                	jae    80353f <munmap+0x4a>
+  803589:	49 39 c7             	cmp    %rax,%r15
+  80358c:	76 b1                	jbe    80353f <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80358e:	4c 89 ef             	mov    %r13,%rdi
+  803591:	48 b8 2c 26 80 00 00 	movabs $0x80262c,%rax
+  803598:	00 00 00 
+  80359b:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80359d:	48 85 c0             	test   %rax,%rax
+  8035a0:	0f 84 c5 00 00 00    	je     80366b <munmap+0x176>
+            *tail = *m;
+  8035a6:	48 8b 13             	mov    (%rbx),%rdx
+  8035a9:	48 89 10             	mov    %rdx,(%rax)
+  8035ac:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035b0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8035b4:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8035b8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8035bc:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8035bf:	44 89 f2             	mov    %r14d,%edx
+  8035c2:	2b 13                	sub    (%rbx),%edx
+  8035c4:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8035c7:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035cb:	eb 80                	jmp    80354d <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035cd:	49 39 d6             	cmp    %rdx,%r14
+  8035d0:	73 18                	jae    8035ea <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035d2:	44 89 f2             	mov    %r14d,%edx
+  8035d5:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035da:	29 c2                	sub    %eax,%edx
+  8035dc:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035e1:	4d 89 34 24          	mov    %r14,(%r12)
+  8035e5:	e9 63 ff ff ff       	jmp    80354d <munmap+0x58>
+    m->mm_start = 0;
+  8035ea:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8035f1:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8035f2:	4c 89 e6             	mov    %r12,%rsi
+  8035f5:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8035fc:	00 00 00 
+  8035ff:	48 29 c6             	sub    %rax,%rsi
+  803602:	48 c1 fe 03          	sar    $0x3,%rsi
+  803606:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80360d:	aa aa aa 
+  803610:	48 0f af f0          	imul   %rax,%rsi
+  803614:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803618:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80361d:	48 01 c6             	add    %rax,%rsi
+  803620:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803625:	bf 00 00 00 00       	mov    $0x0,%edi
+  80362a:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  803631:	00 00 00 
+  803634:	ff d0                	call   *%rax
+}
+  803636:	e9 12 ff ff ff       	jmp    80354d <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80363b:	4c 89 f2             	mov    %r14,%rdx
+  80363e:	4c 29 fa             	sub    %r15,%rdx
+  803641:	4c 89 fe             	mov    %r15,%rsi
+  803644:	bf 00 00 00 00       	mov    $0x0,%edi
+  803649:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  803650:	00 00 00 
+  803653:	ff d0                	call   *%rax
+}
+  803655:	48 83 c4 08          	add    $0x8,%rsp
+  803659:	5b                   	pop    %rbx
+  80365a:	41 5c                	pop    %r12
+  80365c:	41 5d                	pop    %r13
+  80365e:	41 5e                	pop    %r14
+  803660:	41 5f                	pop    %r15
+  803662:	5d                   	pop    %rbp
+  803663:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803664:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803669:	eb ea                	jmp    803655 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80366b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803670:	eb e3                	jmp    803655 <munmap+0x160>
+
+0000000000803672 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803672:	55                   	push   %rbp
+  803673:	48 89 e5             	mov    %rsp,%rbp
+  803676:	41 57                	push   %r15
+  803678:	41 56                	push   %r14
+  80367a:	41 55                	push   %r13
+  80367c:	41 54                	push   %r12
+  80367e:	53                   	push   %rbx
+  80367f:	48 83 ec 28          	sub    $0x28,%rsp
+  803683:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803687:	49 89 f5             	mov    %rsi,%r13
+  80368a:	41 89 d6             	mov    %edx,%r14d
+  80368d:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803690:	41 89 cc             	mov    %ecx,%r12d
+  803693:	44 89 c7             	mov    %r8d,%edi
+  803696:	44 89 cb             	mov    %r9d,%ebx
+  803699:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80369d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036a1:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  8036a8:	00 00 00 
+  8036ab:	ff d0                	call   *%rax
+  8036ad:	41 89 c7             	mov    %eax,%r15d
+  8036b0:	85 c0                	test   %eax,%eax
+  8036b2:	0f 88 ae 01 00 00    	js     803866 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036bc:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8036c3:	00 00 00 
+  8036c6:	8b 32                	mov    (%rdx),%esi
+  8036c8:	39 30                	cmp    %esi,(%rax)
+  8036ca:	0f 85 7a 02 00 00    	jne    80394a <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036d0:	8b 40 08             	mov    0x8(%rax),%eax
+  8036d3:	83 e0 03             	and    $0x3,%eax
+  8036d6:	83 f8 01             	cmp    $0x1,%eax
+  8036d9:	0f 84 76 02 00 00    	je     803955 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036df:	4d 85 ed             	test   %r13,%r13
+  8036e2:	0f 84 78 02 00 00    	je     803960 <mmap+0x2ee>
+  8036e8:	85 db                	test   %ebx,%ebx
+  8036ea:	0f 88 70 02 00 00    	js     803960 <mmap+0x2ee>
+  8036f0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8036f6:	41 89 df             	mov    %ebx,%r15d
+  8036f9:	0f 85 6c 02 00 00    	jne    80396b <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036ff:	44 89 f0             	mov    %r14d,%eax
+  803702:	83 e0 fd             	and    $0xfffffffd,%eax
+  803705:	83 f8 04             	cmp    $0x4,%eax
+  803708:	0f 85 68 02 00 00    	jne    803976 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80370e:	44 89 e1             	mov    %r12d,%ecx
+  803711:	83 e1 01             	and    $0x1,%ecx
+  803714:	0f 95 c2             	setne  %dl
+  803717:	44 89 e0             	mov    %r12d,%eax
+  80371a:	d1 e8                	shr    %eax
+  80371c:	83 f0 01             	xor    $0x1,%eax
+  80371f:	83 e0 01             	and    $0x1,%eax
+  803722:	38 c2                	cmp    %al,%dl
+  803724:	0f 85 57 02 00 00    	jne    803981 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80372a:	85 c9                	test   %ecx,%ecx
+  80372c:	74 0a                	je     803738 <mmap+0xc6>
+  80372e:	41 f6 c6 02          	test   $0x2,%r14b
+  803732:	0f 85 54 02 00 00    	jne    80398c <mmap+0x31a>
+    file_flush_buffers();
+  803738:	48 b8 ed 31 80 00 00 	movabs $0x8031ed,%rax
+  80373f:	00 00 00 
+  803742:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803744:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80374b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803752:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803756:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803759:	41 f6 c4 04          	test   $0x4,%r12b
+  80375d:	0f 84 15 01 00 00    	je     803878 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803763:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803766:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80376c:	0f 85 25 02 00 00    	jne    803997 <mmap+0x325>
+  803772:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803776:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80377d:	00 00 00 
+  803780:	48 39 c2             	cmp    %rax,%rdx
+  803783:	0f 82 19 02 00 00    	jb     8039a2 <mmap+0x330>
+  803789:	48 39 c7             	cmp    %rax,%rdi
+  80378c:	0f 87 10 02 00 00    	ja     8039a2 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803792:	4c 89 ee             	mov    %r13,%rsi
+  803795:	48 b8 f5 34 80 00 00 	movabs $0x8034f5,%rax
+  80379c:	00 00 00 
+  80379f:	ff d0                	call   *%rax
+  8037a1:	85 c0                	test   %eax,%eax
+  8037a3:	0f 88 04 02 00 00    	js     8039ad <mmap+0x33b>
+    if (!handler) {
+  8037a9:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037b0:	00 00 00 
+  8037b3:	80 38 00             	cmpb   $0x0,(%rax)
+  8037b6:	75 2b                	jne    8037e3 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037b8:	48 bf 8d 25 80 00 00 	movabs $0x80258d,%rdi
+  8037bf:	00 00 00 
+  8037c2:	48 b8 96 16 80 00 00 	movabs $0x801696,%rax
+  8037c9:	00 00 00 
+  8037cc:	ff d0                	call   *%rax
+  8037ce:	85 c0                	test   %eax,%eax
+  8037d0:	0f 88 ea 01 00 00    	js     8039c0 <mmap+0x34e>
+        handler = 1;
+  8037d6:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037dd:	00 00 00 
+  8037e0:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037e3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037e7:	48 b8 2c 26 80 00 00 	movabs $0x80262c,%rax
+  8037ee:	00 00 00 
+  8037f1:	ff d0                	call   *%rax
+  8037f3:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8037f6:	48 85 c0             	test   %rax,%rax
+  8037f9:	0f 84 c9 01 00 00    	je     8039c8 <mmap+0x356>
+    m->mm_start = va;
+  8037ff:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803802:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803806:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80380a:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80380d:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803811:	44 89 e0             	mov    %r12d,%eax
+  803814:	c1 e0 06             	shl    $0x6,%eax
+  803817:	25 80 00 00 00       	and    $0x80,%eax
+  80381c:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80381f:	09 f0                	or     %esi,%eax
+  803821:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803825:	41 f6 c4 08          	test   $0x8,%r12b
+  803829:	74 31                	je     80385c <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80382b:	48 39 d3             	cmp    %rdx,%rbx
+  80382e:	73 2c                	jae    80385c <mmap+0x1ea>
+  803830:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803835:	48 89 de             	mov    %rbx,%rsi
+  803838:	4c 89 f7             	mov    %r14,%rdi
+  80383b:	48 b8 7c 24 80 00 00 	movabs $0x80247c,%rax
+  803842:	00 00 00 
+  803845:	ff d0                	call   *%rax
+  803847:	49 89 c4             	mov    %rax,%r12
+  80384a:	48 85 c0             	test   %rax,%rax
+  80384d:	0f 8e d7 00 00 00    	jle    80392a <mmap+0x2b8>
+            va += n;
+  803853:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803856:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80385a:	72 d4                	jb     803830 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80385c:	49 8b 06             	mov    (%r14),%rax
+  80385f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803863:	48 89 06             	mov    %rax,(%rsi)
+}
+  803866:	44 89 f8             	mov    %r15d,%eax
+  803869:	48 83 c4 28          	add    $0x28,%rsp
+  80386d:	5b                   	pop    %rbx
+  80386e:	41 5c                	pop    %r12
+  803870:	41 5d                	pop    %r13
+  803872:	41 5e                	pop    %r14
+  803874:	41 5f                	pop    %r15
+  803876:	5d                   	pop    %rbp
+  803877:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803878:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80387f:	00 00 00 
+  803882:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803885:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80388c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80388f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803894:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80389b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80389e:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8038a5:	00 00 00 
+  8038a8:	48 39 d7             	cmp    %rdx,%rdi
+  8038ab:	73 1c                	jae    8038c9 <mmap+0x257>
+        return -E_NO_MEM;
+  8038ad:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038b3:	eb b1                	jmp    803866 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038b5:	48 83 c0 01          	add    $0x1,%rax
+  8038b9:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8038bd:	77 3f                	ja     8038fe <mmap+0x28c>
+  8038bf:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8038c4:	48 39 d7             	cmp    %rdx,%rdi
+  8038c7:	72 2a                	jb     8038f3 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038c9:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038cd:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038d1:	48 39 d1             	cmp    %rdx,%rcx
+  8038d4:	73 df                	jae    8038b5 <mmap+0x243>
+  8038d6:	48 85 c9             	test   %rcx,%rcx
+  8038d9:	74 da                	je     8038b5 <mmap+0x243>
+  8038db:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038df:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038e4:	48 39 d3             	cmp    %rdx,%rbx
+  8038e7:	73 cc                	jae    8038b5 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038e9:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f1:	eb cc                	jmp    8038bf <mmap+0x24d>
+        return -E_NO_MEM;
+  8038f3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038f9:	e9 68 ff ff ff       	jmp    803866 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8038fe:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803903:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80390a:	00 00 00 
+  80390d:	48 39 c2             	cmp    %rax,%rdx
+  803910:	0f 82 9f 00 00 00    	jb     8039b5 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803916:	48 85 db             	test   %rbx,%rbx
+  803919:	0f 85 8a fe ff ff    	jne    8037a9 <mmap+0x137>
+        return -E_NO_MEM;
+  80391f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803925:	e9 3c ff ff ff       	jmp    803866 <mmap+0x1f4>
+        if (n < 0) {
+  80392a:	0f 89 2c ff ff ff    	jns    80385c <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803930:	49 8b 3e             	mov    (%r14),%rdi
+  803933:	4c 89 ee             	mov    %r13,%rsi
+  803936:	48 b8 f5 34 80 00 00 	movabs $0x8034f5,%rax
+  80393d:	00 00 00 
+  803940:	ff d0                	call   *%rax
+            return n;
+  803942:	45 89 e7             	mov    %r12d,%r15d
+  803945:	e9 1c ff ff ff       	jmp    803866 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80394a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803950:	e9 11 ff ff ff       	jmp    803866 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803955:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80395b:	e9 06 ff ff ff       	jmp    803866 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803960:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803966:	e9 fb fe ff ff       	jmp    803866 <mmap+0x1f4>
+  80396b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803971:	e9 f0 fe ff ff       	jmp    803866 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803976:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80397c:	e9 e5 fe ff ff       	jmp    803866 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803981:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803987:	e9 da fe ff ff       	jmp    803866 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80398c:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803992:	e9 cf fe ff ff       	jmp    803866 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803997:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80399d:	e9 c4 fe ff ff       	jmp    803866 <mmap+0x1f4>
+  8039a2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039a8:	e9 b9 fe ff ff       	jmp    803866 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8039ad:	41 89 c7             	mov    %eax,%r15d
+  8039b0:	e9 b1 fe ff ff       	jmp    803866 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8039b5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039bb:	e9 a6 fe ff ff       	jmp    803866 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8039c0:	41 89 c7             	mov    %eax,%r15d
+  8039c3:	e9 9e fe ff ff       	jmp    803866 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039c8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039ce:	e9 93 fe ff ff       	jmp    803866 <mmap+0x1f4>
+
+00000000008039d3 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039d3:	55                   	push   %rbp
+  8039d4:	48 89 e5             	mov    %rsp,%rbp
+  8039d7:	41 54                	push   %r12
+  8039d9:	53                   	push   %rbx
+  8039da:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039dd:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  8039e4:	00 00 00 
+  8039e7:	ff d0                	call   *%rax
+  8039e9:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039ec:	48 be 00 4f 80 00 00 	movabs $0x804f00,%rsi
+  8039f3:	00 00 00 
+  8039f6:	48 89 df             	mov    %rbx,%rdi
+  8039f9:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  803a00:	00 00 00 
+  803a03:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a05:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a0a:	41 2b 04 24          	sub    (%r12),%eax
+  803a0e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a14:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a1b:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a1e:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  803a25:	00 00 00 
+  803a28:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a34:	5b                   	pop    %rbx
+  803a35:	41 5c                	pop    %r12
+  803a37:	5d                   	pop    %rbp
+  803a38:	c3                   	ret
+
+0000000000803a39 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a39:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a3c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a42:	8b 17                	mov    (%rdi),%edx
+  803a44:	85 d2                	test   %edx,%edx
+  803a46:	75 01                	jne    803a49 <pipe_wakeup+0x10>
+  803a48:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a49:	55                   	push   %rbp
+  803a4a:	48 89 e5             	mov    %rsp,%rbp
+  803a4d:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a50:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a56:	be 00 04 00 00       	mov    $0x400,%esi
+  803a5b:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  803a62:	00 00 00 
+  803a65:	ff d0                	call   *%rax
+}
+  803a67:	5d                   	pop    %rbp
+  803a68:	c3                   	ret
+
+0000000000803a69 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a69:	55                   	push   %rbp
+  803a6a:	48 89 e5             	mov    %rsp,%rbp
+  803a6d:	41 55                	push   %r13
+  803a6f:	41 54                	push   %r12
+  803a71:	53                   	push   %rbx
+  803a72:	48 83 ec 08          	sub    $0x8,%rsp
+  803a76:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a79:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803a80:	00 00 00 
+  803a83:	ff d0                	call   *%rax
+  803a85:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a8d:	4c 89 e6             	mov    %r12,%rsi
+  803a90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a95:	49 bc 7f 12 80 00 00 	movabs $0x80127f,%r12
+  803a9c:	00 00 00 
+  803a9f:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803aa2:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803aa6:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803aaa:	49 bd 39 3a 80 00 00 	movabs $0x803a39,%r13
+  803ab1:	00 00 00 
+  803ab4:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ab7:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803abb:	48 89 de             	mov    %rbx,%rsi
+  803abe:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803ac1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac6:	48 89 de             	mov    %rbx,%rsi
+  803ac9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ace:	41 ff d4             	call   *%r12
+  803ad1:	48 83 c4 08          	add    $0x8,%rsp
+  803ad5:	5b                   	pop    %rbx
+  803ad6:	41 5c                	pop    %r12
+  803ad8:	41 5d                	pop    %r13
+  803ada:	5d                   	pop    %rbp
+  803adb:	c3                   	ret
+
+0000000000803adc <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803adc:	55                   	push   %rbp
+  803add:	48 89 e5             	mov    %rsp,%rbp
+  803ae0:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ae3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ae8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803aed:	48 b8 c2 11 80 00 00 	movabs $0x8011c2,%rax
+  803af4:	00 00 00 
+  803af7:	ff d0                	call   *%rax
+  803af9:	85 c0                	test   %eax,%eax
+  803afb:	0f 94 c0             	sete   %al
+  803afe:	0f b6 c0             	movzbl %al,%eax
+}
+  803b01:	5d                   	pop    %rbp
+  803b02:	c3                   	ret
+
+0000000000803b03 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b03:	55                   	push   %rbp
+  803b04:	48 89 e5             	mov    %rsp,%rbp
+  803b07:	41 57                	push   %r15
+  803b09:	41 56                	push   %r14
+  803b0b:	41 55                	push   %r13
+  803b0d:	41 54                	push   %r12
+  803b0f:	53                   	push   %rbx
+  803b10:	48 83 ec 38          	sub    $0x38,%rsp
+  803b14:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b18:	49 89 f4             	mov    %rsi,%r12
+  803b1b:	49 89 d7             	mov    %rdx,%r15
+  803b1e:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b22:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+  803b2e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b31:	4d 85 ff             	test   %r15,%r15
+  803b34:	0f 84 f1 00 00 00    	je     803c2b <devpipe_write+0x128>
+  803b3a:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b3e:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b42:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b46:	49 bd dc 3a 80 00 00 	movabs $0x803adc,%r13
+  803b4d:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b50:	49 bf 39 3a 80 00 00 	movabs $0x803a39,%r15
+  803b57:	00 00 00 
+  803b5a:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b62:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b66:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b69:	48 63 ce             	movslq %esi,%rcx
+  803b6c:	48 63 03             	movslq (%rbx),%rax
+  803b6f:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b75:	48 39 c1             	cmp    %rax,%rcx
+  803b78:	72 64                	jb     803bde <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b7a:	48 89 de             	mov    %rbx,%rsi
+  803b7d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b81:	41 ff d5             	call   *%r13
+  803b84:	85 c0                	test   %eax,%eax
+  803b86:	0f 85 b9 00 00 00    	jne    803c45 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b8c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b90:	4c 89 f7             	mov    %r14,%rdi
+  803b93:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b96:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b99:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803ba0:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ba7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bad:	8b 03                	mov    (%rbx),%eax
+  803baf:	41 39 c4             	cmp    %eax,%r12d
+  803bb2:	75 b2                	jne    803b66 <devpipe_write+0x63>
+  803bb4:	48 89 de             	mov    %rbx,%rsi
+  803bb7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bbb:	41 ff d5             	call   *%r13
+  803bbe:	85 c0                	test   %eax,%eax
+  803bc0:	75 a0                	jne    803b62 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bc2:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bc7:	44 89 e6             	mov    %r12d,%esi
+  803bca:	48 89 df             	mov    %rbx,%rdi
+  803bcd:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  803bd4:	00 00 00 
+  803bd7:	ff d0                	call   *%rax
+  803bd9:	e9 7c ff ff ff       	jmp    803b5a <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bde:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803be2:	41 0f b6 38          	movzbl (%r8),%edi
+  803be6:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bed:	80 80 80 
+  803bf0:	48 89 c8             	mov    %rcx,%rax
+  803bf3:	48 f7 e2             	mul    %rdx
+  803bf6:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bfa:	48 89 d0             	mov    %rdx,%rax
+  803bfd:	48 c1 e0 08          	shl    $0x8,%rax
+  803c01:	48 29 d0             	sub    %rdx,%rax
+  803c04:	48 c1 e0 04          	shl    $0x4,%rax
+  803c08:	48 29 c1             	sub    %rax,%rcx
+  803c0b:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c10:	83 c6 01             	add    $0x1,%esi
+  803c13:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c16:	49 83 c0 01          	add    $0x1,%r8
+  803c1a:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c1e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c22:	49 39 c0             	cmp    %rax,%r8
+  803c25:	0f 85 2f ff ff ff    	jne    803b5a <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c2b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c2f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c33:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  803c3a:	00 00 00 
+  803c3d:	ff d0                	call   *%rax
+    return n;
+  803c3f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c43:	eb 05                	jmp    803c4a <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c4a:	48 83 c4 38          	add    $0x38,%rsp
+  803c4e:	5b                   	pop    %rbx
+  803c4f:	41 5c                	pop    %r12
+  803c51:	41 5d                	pop    %r13
+  803c53:	41 5e                	pop    %r14
+  803c55:	41 5f                	pop    %r15
+  803c57:	5d                   	pop    %rbp
+  803c58:	c3                   	ret
+
+0000000000803c59 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c59:	55                   	push   %rbp
+  803c5a:	48 89 e5             	mov    %rsp,%rbp
+  803c5d:	41 57                	push   %r15
+  803c5f:	41 56                	push   %r14
+  803c61:	41 55                	push   %r13
+  803c63:	41 54                	push   %r12
+  803c65:	53                   	push   %rbx
+  803c66:	48 83 ec 28          	sub    $0x28,%rsp
+  803c6a:	49 89 fd             	mov    %rdi,%r13
+  803c6d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c71:	49 89 d4             	mov    %rdx,%r12
+  803c74:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c78:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803c7f:	00 00 00 
+  803c82:	ff d0                	call   *%rax
+  803c84:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c87:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c8d:	49 bf dc 3a 80 00 00 	movabs $0x803adc,%r15
+  803c94:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c97:	4d 85 e4             	test   %r12,%r12
+  803c9a:	0f 84 d5 00 00 00    	je     803d75 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ca0:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803ca4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ca8:	8b 03                	mov    (%rbx),%eax
+  803caa:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cad:	75 7a                	jne    803d29 <devpipe_read+0xd0>
+            if (i > 0) {
+  803caf:	4d 85 f6             	test   %r14,%r14
+  803cb2:	75 50                	jne    803d04 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cb4:	48 89 de             	mov    %rbx,%rsi
+  803cb7:	4c 89 ef             	mov    %r13,%rdi
+  803cba:	41 ff d7             	call   *%r15
+  803cbd:	85 c0                	test   %eax,%eax
+  803cbf:	0f 85 c9 00 00 00    	jne    803d8e <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cc5:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803cc8:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ccf:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cd5:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cd8:	41 39 c4             	cmp    %eax,%r12d
+  803cdb:	75 cb                	jne    803ca8 <devpipe_read+0x4f>
+  803cdd:	48 89 de             	mov    %rbx,%rsi
+  803ce0:	4c 89 ef             	mov    %r13,%rdi
+  803ce3:	41 ff d7             	call   *%r15
+  803ce6:	85 c0                	test   %eax,%eax
+  803ce8:	75 be                	jne    803ca8 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cea:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cef:	44 89 e6             	mov    %r12d,%esi
+  803cf2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cf6:	48 b8 47 15 80 00 00 	movabs $0x801547,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+  803d02:	eb a4                	jmp    803ca8 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d04:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d08:	48 89 de             	mov    %rbx,%rsi
+  803d0b:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  803d12:	00 00 00 
+  803d15:	ff d0                	call   *%rax
+                return i;
+  803d17:	4c 89 f0             	mov    %r14,%rax
+}
+  803d1a:	48 83 c4 28          	add    $0x28,%rsp
+  803d1e:	5b                   	pop    %rbx
+  803d1f:	41 5c                	pop    %r12
+  803d21:	41 5d                	pop    %r13
+  803d23:	41 5e                	pop    %r14
+  803d25:	41 5f                	pop    %r15
+  803d27:	5d                   	pop    %rbp
+  803d28:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d29:	48 63 c8             	movslq %eax,%rcx
+  803d2c:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d33:	80 80 80 
+  803d36:	48 89 c8             	mov    %rcx,%rax
+  803d39:	48 f7 e2             	mul    %rdx
+  803d3c:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d40:	48 89 d0             	mov    %rdx,%rax
+  803d43:	48 c1 e0 08          	shl    $0x8,%rax
+  803d47:	48 29 d0             	sub    %rdx,%rax
+  803d4a:	48 c1 e0 04          	shl    $0x4,%rax
+  803d4e:	48 89 c2             	mov    %rax,%rdx
+  803d51:	48 89 c8             	mov    %rcx,%rax
+  803d54:	48 29 d0             	sub    %rdx,%rax
+  803d57:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d5c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d60:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d64:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d67:	49 83 c6 01          	add    $0x1,%r14
+  803d6b:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d6f:	0f 85 2b ff ff ff    	jne    803ca0 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d75:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d79:	48 89 de             	mov    %rbx,%rsi
+  803d7c:	48 b8 39 3a 80 00 00 	movabs $0x803a39,%rax
+  803d83:	00 00 00 
+  803d86:	ff d0                	call   *%rax
+    return n;
+  803d88:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d8c:	eb 8c                	jmp    803d1a <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d8e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d93:	eb 85                	jmp    803d1a <devpipe_read+0xc1>
+
+0000000000803d95 <pipe>:
+pipe(int pfd[2]) {
+  803d95:	55                   	push   %rbp
+  803d96:	48 89 e5             	mov    %rsp,%rbp
+  803d99:	41 55                	push   %r13
+  803d9b:	41 54                	push   %r12
+  803d9d:	53                   	push   %rbx
+  803d9e:	48 83 ec 18          	sub    $0x18,%rsp
+  803da2:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803da5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803da9:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  803db0:	00 00 00 
+  803db3:	ff d0                	call   *%rax
+  803db5:	89 c3                	mov    %eax,%ebx
+  803db7:	85 c0                	test   %eax,%eax
+  803db9:	0f 88 a0 01 00 00    	js     803f5f <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803dbf:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dd2:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  803dd9:	00 00 00 
+  803ddc:	ff d0                	call   *%rax
+  803dde:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803de0:	85 c0                	test   %eax,%eax
+  803de2:	0f 88 77 01 00 00    	js     803f5f <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803de8:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dec:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  803df3:	00 00 00 
+  803df6:	ff d0                	call   *%rax
+  803df8:	89 c3                	mov    %eax,%ebx
+  803dfa:	85 c0                	test   %eax,%eax
+  803dfc:	0f 88 43 01 00 00    	js     803f45 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e02:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e07:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e0c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e10:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e15:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+  803e21:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e23:	85 c0                	test   %eax,%eax
+  803e25:	0f 88 1a 01 00 00    	js     803f45 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e2b:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e2f:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803e36:	00 00 00 
+  803e39:	ff d0                	call   *%rax
+  803e3b:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e3e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e48:	48 89 c6             	mov    %rax,%rsi
+  803e4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e50:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  803e57:	00 00 00 
+  803e5a:	ff d0                	call   *%rax
+  803e5c:	89 c3                	mov    %eax,%ebx
+  803e5e:	85 c0                	test   %eax,%eax
+  803e60:	0f 88 c5 00 00 00    	js     803f2b <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e66:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e6a:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803e71:	00 00 00 
+  803e74:	ff d0                	call   *%rax
+  803e76:	48 89 c1             	mov    %rax,%rcx
+  803e79:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e7f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e85:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e8a:	4c 89 ee             	mov    %r13,%rsi
+  803e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e92:	48 b8 2f 12 80 00 00 	movabs $0x80122f,%rax
+  803e99:	00 00 00 
+  803e9c:	ff d0                	call   *%rax
+  803e9e:	89 c3                	mov    %eax,%ebx
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	78 6e                	js     803f12 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ea4:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ea9:	4c 89 ef             	mov    %r13,%rdi
+  803eac:	48 b8 9e 11 80 00 00 	movabs $0x80119e,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	83 f8 02             	cmp    $0x2,%eax
+  803ebb:	0f 85 ab 00 00 00    	jne    803f6c <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ec1:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803ec8:	00 00 
+  803eca:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ece:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ed0:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ed4:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803edb:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803edf:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ee1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ee5:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803eec:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ef0:	48 bb d9 18 80 00 00 	movabs $0x8018d9,%rbx
+  803ef7:	00 00 00 
+  803efa:	ff d3                	call   *%rbx
+  803efc:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f00:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f04:	ff d3                	call   *%rbx
+  803f06:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f10:	eb 4d                	jmp    803f5f <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f17:	4c 89 ee             	mov    %r13,%rsi
+  803f1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f1f:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  803f26:	00 00 00 
+  803f29:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f2b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f30:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f34:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f39:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  803f40:	00 00 00 
+  803f43:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f45:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f4a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f4e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f53:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  803f5a:	00 00 00 
+  803f5d:	ff d0                	call   *%rax
+}
+  803f5f:	89 d8                	mov    %ebx,%eax
+  803f61:	48 83 c4 18          	add    $0x18,%rsp
+  803f65:	5b                   	pop    %rbx
+  803f66:	41 5c                	pop    %r12
+  803f68:	41 5d                	pop    %r13
+  803f6a:	5d                   	pop    %rbp
+  803f6b:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f6c:	48 b9 18 4f 80 00 00 	movabs $0x804f18,%rcx
+  803f73:	00 00 00 
+  803f76:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  803f7d:	00 00 00 
+  803f80:	be 50 00 00 00       	mov    $0x50,%esi
+  803f85:	48 bf 07 4f 80 00 00 	movabs $0x804f07,%rdi
+  803f8c:	00 00 00 
+  803f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f94:	49 b8 05 02 80 00 00 	movabs $0x800205,%r8
+  803f9b:	00 00 00 
+  803f9e:	41 ff d0             	call   *%r8
+
+0000000000803fa1 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803fa1:	55                   	push   %rbp
+  803fa2:	48 89 e5             	mov    %rsp,%rbp
+  803fa5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803fa9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fad:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  803fb4:	00 00 00 
+  803fb7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fb9:	85 c0                	test   %eax,%eax
+  803fbb:	78 23                	js     803fe0 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fbd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fc1:	48 b8 eb 18 80 00 00 	movabs $0x8018eb,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+  803fcd:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fd0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fd4:	48 b8 dc 3a 80 00 00 	movabs $0x803adc,%rax
+  803fdb:	00 00 00 
+  803fde:	ff d0                	call   *%rax
+}
+  803fe0:	c9                   	leave
+  803fe1:	c3                   	ret
+
+0000000000803fe2 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fe2:	48 89 f8             	mov    %rdi,%rax
+  803fe5:	48 c1 e8 27          	shr    $0x27,%rax
+  803fe9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ff0:	01 00 00 
+  803ff3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ff7:	f6 c2 01             	test   $0x1,%dl
+  803ffa:	74 6d                	je     804069 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ffc:	48 89 f8             	mov    %rdi,%rax
+  803fff:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804003:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80400a:	01 00 00 
+  80400d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804011:	f6 c2 01             	test   $0x1,%dl
+  804014:	74 62                	je     804078 <get_uvpt_entry+0x96>
+  804016:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80401d:	01 00 00 
+  804020:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804024:	f6 c2 80             	test   $0x80,%dl
+  804027:	75 4f                	jne    804078 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804029:	48 89 f8             	mov    %rdi,%rax
+  80402c:	48 c1 e8 15          	shr    $0x15,%rax
+  804030:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804037:	01 00 00 
+  80403a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80403e:	f6 c2 01             	test   $0x1,%dl
+  804041:	74 44                	je     804087 <get_uvpt_entry+0xa5>
+  804043:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80404a:	01 00 00 
+  80404d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804051:	f6 c2 80             	test   $0x80,%dl
+  804054:	75 31                	jne    804087 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804056:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80405a:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804061:	01 00 00 
+  804064:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804068:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804069:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804070:	01 00 00 
+  804073:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804077:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804078:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80407f:	01 00 00 
+  804082:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804086:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804087:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80408e:	01 00 00 
+  804091:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804095:	c3                   	ret
+
+0000000000804096 <get_prot>:
+
+int
+get_prot(void *va) {
+  804096:	55                   	push   %rbp
+  804097:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80409a:	48 b8 e2 3f 80 00 00 	movabs $0x803fe2,%rax
+  8040a1:	00 00 00 
+  8040a4:	ff d0                	call   *%rax
+  8040a6:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040a9:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040ae:	89 c1                	mov    %eax,%ecx
+  8040b0:	83 c9 04             	or     $0x4,%ecx
+  8040b3:	f6 c2 01             	test   $0x1,%dl
+  8040b6:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040b9:	89 c1                	mov    %eax,%ecx
+  8040bb:	83 c9 02             	or     $0x2,%ecx
+  8040be:	f6 c2 02             	test   $0x2,%dl
+  8040c1:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040c4:	89 c1                	mov    %eax,%ecx
+  8040c6:	83 c9 01             	or     $0x1,%ecx
+  8040c9:	48 85 d2             	test   %rdx,%rdx
+  8040cc:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040cf:	89 c1                	mov    %eax,%ecx
+  8040d1:	83 c9 40             	or     $0x40,%ecx
+  8040d4:	f6 c6 04             	test   $0x4,%dh
+  8040d7:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040da:	5d                   	pop    %rbp
+  8040db:	c3                   	ret
+
+00000000008040dc <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040dc:	55                   	push   %rbp
+  8040dd:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040e0:	48 b8 e2 3f 80 00 00 	movabs $0x803fe2,%rax
+  8040e7:	00 00 00 
+  8040ea:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040ec:	48 c1 e8 06          	shr    $0x6,%rax
+  8040f0:	83 e0 01             	and    $0x1,%eax
+}
+  8040f3:	5d                   	pop    %rbp
+  8040f4:	c3                   	ret
+
+00000000008040f5 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040f5:	55                   	push   %rbp
+  8040f6:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040f9:	48 b8 e2 3f 80 00 00 	movabs $0x803fe2,%rax
+  804100:	00 00 00 
+  804103:	ff d0                	call   *%rax
+  804105:	83 e0 01             	and    $0x1,%eax
+}
+  804108:	5d                   	pop    %rbp
+  804109:	c3                   	ret
+
+000000000080410a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80410a:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804111:	01 00 00 
+  804114:	a8 01                	test   $0x1,%al
+  804116:	75 06                	jne    80411e <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80411d:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80411e:	55                   	push   %rbp
+  80411f:	48 89 e5             	mov    %rsp,%rbp
+  804122:	41 57                	push   %r15
+  804124:	41 56                	push   %r14
+  804126:	41 55                	push   %r13
+  804128:	41 54                	push   %r12
+  80412a:	53                   	push   %rbx
+  80412b:	48 83 ec 28          	sub    $0x28,%rsp
+  80412f:	49 89 fe             	mov    %rdi,%r14
+  804132:	49 89 f7             	mov    %rsi,%r15
+  804135:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80413c:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80413d:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804144:	01 00 00 
+  804147:	e9 ae 00 00 00       	jmp    8041fa <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80414c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804153:	49 83 ec 01          	sub    $0x1,%r12
+  804157:	74 2d                	je     804186 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804159:	48 89 d8             	mov    %rbx,%rax
+  80415c:	48 c1 e8 0c          	shr    $0xc,%rax
+  804160:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804165:	f6 c2 01             	test   $0x1,%dl
+  804168:	74 e2                	je     80414c <foreach_shared_region+0x42>
+  80416a:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80416f:	f6 c4 04             	test   $0x4,%ah
+  804172:	74 d8                	je     80414c <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804174:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80417b:	4c 89 fa             	mov    %r15,%rdx
+  80417e:	48 89 df             	mov    %rbx,%rdi
+  804181:	41 ff d6             	call   *%r14
+  804184:	eb c6                	jmp    80414c <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804186:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80418d:	00 
+  80418e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804193:	74 4a                	je     8041df <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804195:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804199:	48 c1 e8 15          	shr    $0x15,%rax
+  80419d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8041a4:	01 00 00 
+  8041a7:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041ab:	a8 01                	test   $0x1,%al
+  8041ad:	74 d7                	je     804186 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041af:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8041b3:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8041ba:	48 39 c3             	cmp    %rax,%rbx
+  8041bd:	73 c7                	jae    804186 <foreach_shared_region+0x7c>
+  8041bf:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041c6:	48 39 d0             	cmp    %rdx,%rax
+  8041c9:	4d 19 e4             	sbb    %r12,%r12
+  8041cc:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041d3:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041da:	e9 7a ff ff ff       	jmp    804159 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041df:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041e6:	40 
+  8041e7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041eb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041f2:	00 00 00 
+  8041f5:	48 39 c1             	cmp    %rax,%rcx
+  8041f8:	74 50                	je     80424a <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041fa:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041fe:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804202:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804209:	01 00 00 
+  80420c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804210:	a8 01                	test   $0x1,%al
+  804212:	74 cb                	je     8041df <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804214:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804218:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80421f:	48 39 c1             	cmp    %rax,%rcx
+  804222:	73 bb                	jae    8041df <foreach_shared_region+0xd5>
+  804224:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80422b:	48 39 d0             	cmp    %rdx,%rax
+  80422e:	48 19 c0             	sbb    %rax,%rax
+  804231:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804237:	48 05 00 02 00 00    	add    $0x200,%rax
+  80423d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804241:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804245:	e9 4b ff ff ff       	jmp    804195 <foreach_shared_region+0x8b>
+  80424a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80424f:	48 83 c4 28          	add    $0x28,%rsp
+  804253:	5b                   	pop    %rbx
+  804254:	41 5c                	pop    %r12
+  804256:	41 5d                	pop    %r13
+  804258:	41 5e                	pop    %r14
+  80425a:	41 5f                	pop    %r15
+  80425c:	5d                   	pop    %rbp
+  80425d:	c3                   	ret
+
+000000000080425e <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80425e:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804264:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80426b:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804272:	c3                   	ret
+
+0000000000804273 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804273:	8b 47 40             	mov    0x40(%rdi),%eax
+  804276:	8b 17                	mov    (%rdi),%edx
+  804278:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80427a:	83 f8 0f             	cmp    $0xf,%eax
+  80427d:	77 13                	ja     804292 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80427f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804282:	83 e0 0f             	and    $0xf,%eax
+  804285:	48 c1 e0 09          	shl    $0x9,%rax
+  804289:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804290:	00 
+  804291:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804292:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804297:	c3                   	ret
+
+0000000000804298 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804298:	8b 47 40             	mov    0x40(%rdi),%eax
+  80429b:	83 c0 01             	add    $0x1,%eax
+  80429e:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042a1:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042a7:	8b 57 04             	mov    0x4(%rdi),%edx
+  8042aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042af:	85 d2                	test   %edx,%edx
+  8042b1:	75 04                	jne    8042b7 <chan_publish+0x1f>
+  8042b3:	83 e0 01             	and    $0x1,%eax
+}
+  8042b6:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042b7:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8042ba:	85 c0                	test   %eax,%eax
+  8042bc:	0f 95 c0             	setne  %al
+  8042bf:	0f b6 c0             	movzbl %al,%eax
+  8042c2:	eb ef                	jmp    8042b3 <chan_publish+0x1b>
+
+00000000008042c4 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042c4:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042c7:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042c9:	29 d0                	sub    %edx,%eax
+  8042cb:	83 e8 01             	sub    $0x1,%eax
+  8042ce:	83 f8 0f             	cmp    $0xf,%eax
+  8042d1:	77 12                	ja     8042e5 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042d3:	8b 07                	mov    (%rdi),%eax
+  8042d5:	83 e0 0f             	and    $0xf,%eax
+  8042d8:	48 c1 e0 09          	shl    $0x9,%rax
+  8042dc:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042e3:	00 
+  8042e4:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042ea:	c3                   	ret
+
+00000000008042eb <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042eb:	8b 07                	mov    (%rdi),%eax
+  8042ed:	83 c0 01             	add    $0x1,%eax
+  8042f0:	89 07                	mov    %eax,(%rdi)
+}
+  8042f2:	c3                   	ret
+
+00000000008042f3 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042f3:	55                   	push   %rbp
+  8042f4:	48 89 e5             	mov    %rsp,%rbp
+  8042f7:	53                   	push   %rbx
+  8042f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8042fc:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8042ff:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804306:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80430c:	48 b8 c4 42 80 00 00 	movabs $0x8042c4,%rax
+  804313:	00 00 00 
+  804316:	ff d0                	call   *%rax
+  804318:	48 85 c0             	test   %rax,%rax
+  80431b:	74 12                	je     80432f <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80431d:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804324:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804329:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80432d:	c9                   	leave
+  80432e:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80432f:	b8 01 00 00 00       	mov    $0x1,%eax
+  804334:	eb f3                	jmp    804329 <chan_arm+0x36>
+
+0000000000804336 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804336:	55                   	push   %rbp
+  804337:	48 89 e5             	mov    %rsp,%rbp
+  80433a:	41 56                	push   %r14
+  80433c:	41 55                	push   %r13
+  80433e:	41 54                	push   %r12
+  804340:	53                   	push   %rbx
+  804341:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804344:	49 bc f3 42 80 00 00 	movabs $0x8042f3,%r12
+  80434b:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80434e:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804352:	49 bd 47 15 80 00 00 	movabs $0x801547,%r13
+  804359:	00 00 00 
+    while (chan_arm(r))
+  80435c:	eb 0d                	jmp    80436b <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80435e:	8b 33                	mov    (%rbx),%esi
+  804360:	ba 00 00 00 00       	mov    $0x0,%edx
+  804365:	4c 89 f7             	mov    %r14,%rdi
+  804368:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80436b:	48 89 df             	mov    %rbx,%rdi
+  80436e:	41 ff d4             	call   *%r12
+  804371:	84 c0                	test   %al,%al
+  804373:	75 e9                	jne    80435e <chan_wait+0x28>
+}
+  804375:	5b                   	pop    %rbx
+  804376:	41 5c                	pop    %r12
+  804378:	41 5d                	pop    %r13
+  80437a:	41 5e                	pop    %r14
+  80437c:	5d                   	pop    %rbp
+  80437d:	c3                   	ret
+
+000000000080437e <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80437e:	55                   	push   %rbp
+  80437f:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804382:	48 83 c7 40          	add    $0x40,%rdi
+  804386:	be 01 00 00 00       	mov    $0x1,%esi
+  80438b:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  804392:	00 00 00 
+  804395:	ff d0                	call   *%rax
+}
+  804397:	5d                   	pop    %rbp
+  804398:	c3                   	ret
+
+0000000000804399 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439e:	c3                   	ret
+
+000000000080439f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80439f:	55                   	push   %rbp
+  8043a0:	48 89 e5             	mov    %rsp,%rbp
+  8043a3:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8043a6:	48 be 3c 4f 80 00 00 	movabs $0x804f3c,%rsi
+  8043ad:	00 00 00 
+  8043b0:	48 b8 7a 0c 80 00 00 	movabs $0x800c7a,%rax
+  8043b7:	00 00 00 
+  8043ba:	ff d0                	call   *%rax
+    return 0;
+}
+  8043bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c1:	5d                   	pop    %rbp
+  8043c2:	c3                   	ret
+
+00000000008043c3 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043c3:	55                   	push   %rbp
+  8043c4:	48 89 e5             	mov    %rsp,%rbp
+  8043c7:	41 57                	push   %r15
+  8043c9:	41 56                	push   %r14
+  8043cb:	41 55                	push   %r13
+  8043cd:	41 54                	push   %r12
+  8043cf:	53                   	push   %rbx
+  8043d0:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043d7:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043de:	48 85 d2             	test   %rdx,%rdx
+  8043e1:	74 7a                	je     80445d <devcons_write+0x9a>
+  8043e3:	49 89 d6             	mov    %rdx,%r14
+  8043e6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043ec:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043f1:	49 bf 74 0e 80 00 00 	movabs $0x800e74,%r15
+  8043f8:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043fb:	4c 89 f3             	mov    %r14,%rbx
+  8043fe:	48 29 f3             	sub    %rsi,%rbx
+  804401:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804406:	48 39 c3             	cmp    %rax,%rbx
+  804409:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80440d:	4c 63 eb             	movslq %ebx,%r13
+  804410:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804417:	48 01 c6             	add    %rax,%rsi
+  80441a:	4c 89 ea             	mov    %r13,%rdx
+  80441d:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804424:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804427:	4c 89 ee             	mov    %r13,%rsi
+  80442a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804431:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  804438:	00 00 00 
+  80443b:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80443d:	41 01 dc             	add    %ebx,%r12d
+  804440:	49 63 f4             	movslq %r12d,%rsi
+  804443:	4c 39 f6             	cmp    %r14,%rsi
+  804446:	72 b3                	jb     8043fb <devcons_write+0x38>
+    return res;
+  804448:	49 63 c4             	movslq %r12d,%rax
+}
+  80444b:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804452:	5b                   	pop    %rbx
+  804453:	41 5c                	pop    %r12
+  804455:	41 5d                	pop    %r13
+  804457:	41 5e                	pop    %r14
+  804459:	41 5f                	pop    %r15
+  80445b:	5d                   	pop    %rbp
+  80445c:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80445d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804463:	eb e3                	jmp    804448 <devcons_write+0x85>
+
+0000000000804465 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804465:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804468:	ba 00 00 00 00       	mov    $0x0,%edx
+  80446d:	48 85 c0             	test   %rax,%rax
+  804470:	74 55                	je     8044c7 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804472:	55                   	push   %rbp
+  804473:	48 89 e5             	mov    %rsp,%rbp
+  804476:	41 55                	push   %r13
+  804478:	41 54                	push   %r12
+  80447a:	53                   	push   %rbx
+  80447b:	48 83 ec 08          	sub    $0x8,%rsp
+  80447f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804482:	48 bb c0 10 80 00 00 	movabs $0x8010c0,%rbx
+  804489:	00 00 00 
+  80448c:	49 bc 75 11 80 00 00 	movabs $0x801175,%r12
+  804493:	00 00 00 
+  804496:	eb 03                	jmp    80449b <devcons_read+0x36>
+  804498:	41 ff d4             	call   *%r12
+  80449b:	ff d3                	call   *%rbx
+  80449d:	85 c0                	test   %eax,%eax
+  80449f:	74 f7                	je     804498 <devcons_read+0x33>
+    if (c < 0) return c;
+  8044a1:	48 63 d0             	movslq %eax,%rdx
+  8044a4:	78 13                	js     8044b9 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8044a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044ab:	83 f8 04             	cmp    $0x4,%eax
+  8044ae:	74 09                	je     8044b9 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8044b0:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044b4:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044b9:	48 89 d0             	mov    %rdx,%rax
+  8044bc:	48 83 c4 08          	add    $0x8,%rsp
+  8044c0:	5b                   	pop    %rbx
+  8044c1:	41 5c                	pop    %r12
+  8044c3:	41 5d                	pop    %r13
+  8044c5:	5d                   	pop    %rbp
+  8044c6:	c3                   	ret
+  8044c7:	48 89 d0             	mov    %rdx,%rax
+  8044ca:	c3                   	ret
+
+00000000008044cb <cputchar>:
+cputchar(int ch) {
+  8044cb:	55                   	push   %rbp
+  8044cc:	48 89 e5             	mov    %rsp,%rbp
+  8044cf:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044d3:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044d7:	be 01 00 00 00       	mov    $0x1,%esi
+  8044dc:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044e0:	48 b8 a1 10 80 00 00 	movabs $0x8010a1,%rax
+  8044e7:	00 00 00 
+  8044ea:	ff d0                	call   *%rax
+}
+  8044ec:	c9                   	leave
+  8044ed:	c3                   	ret
+
+00000000008044ee <getchar>:
+getchar(void) {
+  8044ee:	55                   	push   %rbp
+  8044ef:	48 89 e5             	mov    %rsp,%rbp
+  8044f2:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044f6:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044fb:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  804504:	48 b8 4a 1c 80 00 00 	movabs $0x801c4a,%rax
+  80450b:	00 00 00 
+  80450e:	ff d0                	call   *%rax
+  804510:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804512:	85 c0                	test   %eax,%eax
+  804514:	78 06                	js     80451c <getchar+0x2e>
+  804516:	74 08                	je     804520 <getchar+0x32>
+  804518:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80451c:	89 d0                	mov    %edx,%eax
+  80451e:	c9                   	leave
+  80451f:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804520:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804525:	eb f5                	jmp    80451c <getchar+0x2e>
+
+0000000000804527 <iscons>:
+iscons(int fdnum) {
+  804527:	55                   	push   %rbp
+  804528:	48 89 e5             	mov    %rsp,%rbp
+  80452b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80452f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804533:	48 b8 67 19 80 00 00 	movabs $0x801967,%rax
+  80453a:	00 00 00 
+  80453d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80453f:	85 c0                	test   %eax,%eax
+  804541:	78 18                	js     80455b <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804543:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804547:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80454e:	00 00 00 
+  804551:	8b 00                	mov    (%rax),%eax
+  804553:	39 02                	cmp    %eax,(%rdx)
+  804555:	0f 94 c0             	sete   %al
+  804558:	0f b6 c0             	movzbl %al,%eax
+}
+  80455b:	c9                   	leave
+  80455c:	c3                   	ret
+
+000000000080455d <opencons>:
+opencons(void) {
+  80455d:	55                   	push   %rbp
+  80455e:	48 89 e5             	mov    %rsp,%rbp
+  804561:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804565:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804569:	48 b8 07 19 80 00 00 	movabs $0x801907,%rax
+  804570:	00 00 00 
+  804573:	ff d0                	call   *%rax
+  804575:	85 c0                	test   %eax,%eax
+  804577:	78 49                	js     8045c2 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804579:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80457e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804583:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804587:	bf 00 00 00 00       	mov    $0x0,%edi
+  80458c:	48 b8 d9 11 80 00 00 	movabs $0x8011d9,%rax
+  804593:	00 00 00 
+  804596:	ff d0                	call   *%rax
+  804598:	85 c0                	test   %eax,%eax
+  80459a:	78 26                	js     8045c2 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80459c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045a0:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8045a7:	00 00 
+  8045a9:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045ab:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045af:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045b6:	48 b8 d9 18 80 00 00 	movabs $0x8018d9,%rax
+  8045bd:	00 00 00 
+  8045c0:	ff d0                	call   *%rax
+}
+  8045c2:	c9                   	leave
+  8045c3:	c3                   	ret
+
+00000000008045c4 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8045c4:	55                   	push   %rbp
+  8045c5:	48 89 e5             	mov    %rsp,%rbp
+  8045c8:	41 55                	push   %r13
+  8045ca:	41 54                	push   %r12
+  8045cc:	53                   	push   %rbx
+  8045cd:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d1:	49 89 fd             	mov    %rdi,%r13
+  8045d4:	48 89 f7             	mov    %rsi,%rdi
+  8045d7:	48 89 d3             	mov    %rdx,%rbx
+  8045da:	49 89 cc             	mov    %rcx,%r12
+  8045dd:	4c 89 c2             	mov    %r8,%rdx
+  8045e0:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045e3:	48 85 f6             	test   %rsi,%rsi
+  8045e6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045ed:	00 00 00 
+  8045f0:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8045f4:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045f9:	48 85 db             	test   %rbx,%rbx
+  8045fc:	74 03                	je     804601 <ipc_recv_futex+0x3d>
+  8045fe:	48 8b 33             	mov    (%rbx),%rsi
+  804601:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804605:	48 b8 23 14 80 00 00 	movabs $0x801423,%rax
+  80460c:	00 00 00 
+  80460f:	ff d0                	call   *%rax
+    if (res < 0) {
+  804611:	85 c0                	test   %eax,%eax
+  804613:	78 75                	js     80468a <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804615:	4d 85 ed             	test   %r13,%r13
+  804618:	74 14                	je     80462e <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80461a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804621:	00 00 00 
+  804624:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80462a:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80462e:	4d 85 e4             	test   %r12,%r12
+  804631:	74 14                	je     804647 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804633:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80463a:	00 00 00 
+  80463d:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804643:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804647:	48 85 db             	test   %rbx,%rbx
+  80464a:	74 23                	je     80466f <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80464c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804653:	00 00 00 
+  804656:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80465c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804661:	85 c9                	test   %ecx,%ecx
+  804663:	74 07                	je     80466c <ipc_recv_futex+0xa8>
+  804665:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80466c:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80466f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804676:	00 00 00 
+  804679:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80467f:	48 83 c4 08          	add    $0x8,%rsp
+  804683:	5b                   	pop    %rbx
+  804684:	41 5c                	pop    %r12
+  804686:	41 5d                	pop    %r13
+  804688:	5d                   	pop    %rbp
+  804689:	c3                   	ret
+        if (from_env_store != NULL) {
+  80468a:	4d 85 ed             	test   %r13,%r13
+  80468d:	74 08                	je     804697 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80468f:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804696:	00 
+        if (perm_store != NULL) {
+  804697:	4d 85 e4             	test   %r12,%r12
+  80469a:	74 08                	je     8046a4 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80469c:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8046a3:	00 
+        if (size != NULL) {
+  8046a4:	48 85 db             	test   %rbx,%rbx
+  8046a7:	74 d6                	je     80467f <ipc_recv_futex+0xbb>
+            *size = 0;
+  8046a9:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8046b0:	eb cd                	jmp    80467f <ipc_recv_futex+0xbb>
+
+00000000008046b2 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8046b2:	55                   	push   %rbp
+  8046b3:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8046b6:	48 83 ec 08          	sub    $0x8,%rsp
+  8046ba:	6a 00                	push   $0x0
+  8046bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046c8:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8046cf:	00 00 00 
+  8046d2:	ff d0                	call   *%rax
+}
+  8046d4:	c9                   	leave
+  8046d5:	c3                   	ret
+
+00000000008046d6 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046d6:	55                   	push   %rbp
+  8046d7:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046da:	48 85 d2             	test   %rdx,%rdx
+  8046dd:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046e4:	00 00 00 
+  8046e7:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8046eb:	89 f6                	mov    %esi,%esi
+  8046ed:	48 b8 0c 14 80 00 00 	movabs $0x80140c,%rax
+  8046f4:	00 00 00 
+  8046f7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8046f9:	85 c0                	test   %eax,%eax
+  8046fb:	78 02                	js     8046ff <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8046fd:	5d                   	pop    %rbp
+  8046fe:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8046ff:	89 c1                	mov    %eax,%ecx
+  804701:	48 ba 48 4f 80 00 00 	movabs $0x804f48,%rdx
+  804708:	00 00 00 
+  80470b:	be 50 00 00 00       	mov    $0x50,%esi
+  804710:	48 bf 5c 4f 80 00 00 	movabs $0x804f5c,%rdi
+  804717:	00 00 00 
+  80471a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80471f:	49 b8 05 02 80 00 00 	movabs $0x800205,%r8
+  804726:	00 00 00 
+  804729:	41 ff d0             	call   *%r8
+
+000000000080472c <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80472c:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804731:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804738:	00 00 00 
+  80473b:	48 89 d0             	mov    %rdx,%rax
+  80473e:	48 c1 e0 04          	shl    $0x4,%rax
+  804742:	48 29 d0             	sub    %rdx,%rax
+  804745:	48 c1 e0 05          	shl    $0x5,%rax
+  804749:	48 01 c8             	add    %rcx,%rax
+  80474c:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804752:	39 f8                	cmp    %edi,%eax
+  804754:	74 13                	je     804769 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804756:	48 83 c2 01          	add    $0x1,%rdx
+  80475a:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804761:	75 d8                	jne    80473b <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804763:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804768:	c3                   	ret
+            return envs[i].env_id;
+  804769:	48 89 d0             	mov    %rdx,%rax
+  80476c:	48 c1 e0 04          	shl    $0x4,%rax
+  804770:	48 29 d0             	sub    %rdx,%rax
+  804773:	48 c1 e0 05          	shl    $0x5,%rax
+  804777:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80477e:	00 00 00 
+  804781:	48 01 d0             	add    %rdx,%rax
+  804784:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80478a:	c3                   	ret
+  80478b:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804790 <__rodata_start>:
+  804790:	66 61                	data16 (bad)
+  804792:	75 6c                	jne    804800 <__rodata_start+0x70>
+  804794:	74 20                	je     8047b6 <__rodata_start+0x26>
+  804796:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  80479b:	75 73                	jne    804810 <__rodata_start+0x80>
+  80479d:	65 72 2f             	gs jb  8047cf <__rodata_start+0x3f>
+  8047a0:	66 61                	data16 (bad)
+  8047a2:	75 6c                	jne    804810 <__rodata_start+0x80>
+  8047a4:	74 61                	je     804807 <__rodata_start+0x77>
+  8047a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a7:	6c                   	insb   (%dx),%es:(%rdi)
+  8047a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047a9:	63 2e                	movsxd (%rsi),%ebp
+  8047ab:	63 00                	movsxd (%rax),%eax
+  8047ad:	25 73 0a 00 0f       	and    $0xf000a73,%eax
+  8047b2:	1f                   	(bad)
+  8047b3:	80 00 00             	addb   $0x0,(%rax)
+  8047b6:	00 00                	add    %al,(%rax)
+  8047b8:	61                   	(bad)
+  8047b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8047ba:	6c                   	insb   (%dx),%es:(%rdi)
+  8047bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047bc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8047bf:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  8047c6:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  8047cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047cc:	20 70 61             	and    %dh,0x61(%rax)
+  8047cf:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  8047d4:	75 6c                	jne    804842 <__rodata_start+0xb2>
+  8047d6:	74 20                	je     8047f8 <__rodata_start+0x68>
+  8047d8:	68 61 6e 64 6c       	push   $0x6c646e61
+  8047dd:	65 72 3a             	gs jb  80481a <__rodata_start+0x8a>
+  8047e0:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 80484f <__rodata_start+0xbf>
+  8047e6:	00 00                	add    %al,(%rax)
+  8047e8:	74 68                	je     804852 <__rodata_start+0xc2>
+  8047ea:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  8047f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047f2:	67 20 77 61          	and    %dh,0x61(%edi)
+  8047f6:	73 20                	jae    804818 <__rodata_start+0x88>
+  8047f8:	66 61                	data16 (bad)
+  8047fa:	75 6c                	jne    804868 <__rodata_start+0xd8>
+  8047fc:	74 65                	je     804863 <__rodata_start+0xd3>
+  8047fe:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804802:	20 61 74             	and    %ah,0x74(%rcx)
+  804805:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80c077 <__bss_end+0x3bfcb077>
+  80480b:	75 6e                	jne    80487b <__rodata_start+0xeb>
+  80480d:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804811:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804812:	3e 00 0f             	ds add %cl,(%rdi)
+  804815:	1f                   	(bad)
+  804816:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  80481a:	30 38                	xor    %bh,(%rax)
+  80481c:	78 5d                	js     80487b <__rodata_start+0xeb>
+  80481e:	20 75 73             	and    %dh,0x73(%rbp)
+  804821:	65 72 20             	gs jb  804844 <__rodata_start+0xb4>
+  804824:	70 61                	jo     804887 <__rodata_start+0xf7>
+  804826:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804827:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  80482e:	73 20                	jae    804850 <__rodata_start+0xc0>
+  804830:	61                   	(bad)
+  804831:	74 20                	je     804853 <__rodata_start+0xc3>
+  804833:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804838:	3a 20                	cmp    (%rax),%ah
+  80483a:	00 30                	add    %dh,(%rax)
+  80483c:	31 32                	xor    %esi,(%rdx)
+  80483e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804845:	41                   	rex.B
+  804846:	42                   	rex.X
+  804847:	43                   	rex.XB
+  804848:	44                   	rex.R
+  804849:	45                   	rex.RB
+  80484a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80484d:	31 32                	xor    %esi,(%rdx)
+  80484f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804856:	61                   	(bad)
+  804857:	62 63 64 65 66       	(bad)
+  80485c:	00 28                	add    %ch,(%rax)
+  80485e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80485f:	75 6c                	jne    8048cd <__rodata_start+0x13d>
+  804861:	6c                   	insb   (%dx),%es:(%rdi)
+  804862:	29 00                	sub    %eax,(%rax)
+  804864:	65 72 72             	gs jb  8048d9 <__rodata_start+0x149>
+  804867:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804868:	72 20                	jb     80488a <__rodata_start+0xfa>
+  80486a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80486f:	73 70                	jae    8048e1 <__rodata_start+0x151>
+  804871:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804875:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80487c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80487d:	72 00                	jb     80487f <__rodata_start+0xef>
+  80487f:	62 61 64 20 65       	(bad)
+  804884:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804885:	76 69                	jbe    8048f0 <__rodata_start+0x160>
+  804887:	72 6f                	jb     8048f8 <__rodata_start+0x168>
+  804889:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80488a:	6d                   	insl   (%dx),%es:(%rdi)
+  80488b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80488d:	74 00                	je     80488f <__rodata_start+0xff>
+  80488f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804896:	20 70 61             	and    %dh,0x61(%rax)
+  804899:	72 61                	jb     8048fc <__rodata_start+0x16c>
+  80489b:	6d                   	insl   (%dx),%es:(%rdi)
+  80489c:	65 74 65             	gs je  804904 <__rodata_start+0x174>
+  80489f:	72 00                	jb     8048a1 <__rodata_start+0x111>
+  8048a1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048a2:	75 74                	jne    804918 <__rodata_start+0x188>
+  8048a4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8048a7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8048aa:	6d                   	insl   (%dx),%es:(%rdi)
+  8048ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048ac:	72 79                	jb     804927 <__rodata_start+0x197>
+  8048ae:	00 6f 75             	add    %ch,0x75(%rdi)
+  8048b1:	74 20                	je     8048d3 <__rodata_start+0x143>
+  8048b3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048b4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8048b8:	76 69                	jbe    804923 <__rodata_start+0x193>
+  8048ba:	72 6f                	jb     80492b <__rodata_start+0x19b>
+  8048bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048bd:	6d                   	insl   (%dx),%es:(%rdi)
+  8048be:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048c0:	74 73                	je     804935 <__rodata_start+0x1a5>
+  8048c2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8048c5:	72 72                	jb     804939 <__rodata_start+0x1a9>
+  8048c7:	75 70                	jne    804939 <__rodata_start+0x1a9>
+  8048c9:	74 65                	je     804930 <__rodata_start+0x1a0>
+  8048cb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8048d0:	75 67                	jne    804939 <__rodata_start+0x1a9>
+  8048d2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8048d5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048d7:	00 73 65             	add    %dh,0x65(%rbx)
+  8048da:	67 6d                	insl   (%dx),%es:(%edi)
+  8048dc:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048de:	74 61                	je     804941 <__rodata_start+0x1b1>
+  8048e0:	74 69                	je     80494b <__rodata_start+0x1bb>
+  8048e2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e4:	20 66 61             	and    %ah,0x61(%rsi)
+  8048e7:	75 6c                	jne    804955 <__rodata_start+0x1c5>
+  8048e9:	74 00                	je     8048eb <__rodata_start+0x15b>
+  8048eb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048f2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8048f5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8048f9:	61                   	(bad)
+  8048fa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8048ff:	20 73 75             	and    %dh,0x75(%rbx)
+  804902:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804905:	73 79                	jae    804980 <__rodata_start+0x1f0>
+  804907:	73 74                	jae    80497d <__rodata_start+0x1ed>
+  804909:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80490b:	20 63 61             	and    %ah,0x61(%rbx)
+  80490e:	6c                   	insb   (%dx),%es:(%rdi)
+  80490f:	6c                   	insb   (%dx),%es:(%rdi)
+  804910:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804913:	74 72                	je     804987 <__rodata_start+0x1f7>
+  804915:	79 20                	jns    804937 <__rodata_start+0x1a7>
+  804917:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804918:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804919:	74 20                	je     80493b <__rodata_start+0x1ab>
+  80491b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80491d:	75 6e                	jne    80498d <__rodata_start+0x1fd>
+  80491f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804923:	76 20                	jbe    804945 <__rodata_start+0x1b5>
+  804925:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  80492c:	72 65                	jb     804993 <__rodata_start+0x203>
+  80492e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804931:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804932:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804936:	65 78 70             	gs js  8049a9 <__rodata_start+0x219>
+  804939:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  80493e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804941:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804945:	20 66 69             	and    %ah,0x69(%rsi)
+  804948:	6c                   	insb   (%dx),%es:(%rdi)
+  804949:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80494d:	20 66 72             	and    %ah,0x72(%rsi)
+  804950:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804955:	61                   	(bad)
+  804956:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804959:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80495a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80495b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80495f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804962:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804963:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804964:	20 6d 61             	and    %ch,0x61(%rbp)
+  804967:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804968:	79 20                	jns    80498a <__rodata_start+0x1fa>
+  80496a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804971:	72 65                	jb     8049d8 <__rodata_start+0x248>
+  804973:	20 6f 70             	and    %ch,0x70(%rdi)
+  804976:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804978:	00 66 69             	add    %ah,0x69(%rsi)
+  80497b:	6c                   	insb   (%dx),%es:(%rdi)
+  80497c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804980:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804983:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804984:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804987:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804988:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804989:	74 20                	je     8049ab <__rodata_start+0x21b>
+  80498b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80498d:	75 6e                	jne    8049fd <__rodata_start+0x26d>
+  80498f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804993:	76 61                	jbe    8049f6 <__rodata_start+0x266>
+  804995:	6c                   	insb   (%dx),%es:(%rdi)
+  804996:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80499d:	00 
+  80499e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8049a5:	72 65                	jb     804a0c <__rodata_start+0x27c>
+  8049a7:	61                   	(bad)
+  8049a8:	64 79 20             	fs jns 8049cb <__rodata_start+0x23b>
+  8049ab:	65 78 69             	gs js  804a17 <__rodata_start+0x287>
+  8049ae:	73 74                	jae    804a24 <__rodata_start+0x294>
+  8049b0:	73 00                	jae    8049b2 <__rodata_start+0x222>
+  8049b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b3:	70 65                	jo     804a1a <__rodata_start+0x28a>
+  8049b5:	72 61                	jb     804a18 <__rodata_start+0x288>
+  8049b7:	74 69                	je     804a22 <__rodata_start+0x292>
+  8049b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049bb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8049be:	74 20                	je     8049e0 <__rodata_start+0x250>
+  8049c0:	73 75                	jae    804a37 <__rodata_start+0x2a7>
+  8049c2:	70 70                	jo     804a34 <__rodata_start+0x2a4>
+  8049c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049c5:	72 74                	jb     804a3b <__rodata_start+0x2ab>
+  8049c7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8049cd:	20 61 67             	and    %ah,0x67(%rcx)
+  8049d0:	61                   	(bad)
+  8049d1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8049d8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8049dc:	74 00                	je     8049de <__rodata_start+0x24e>
+  8049de:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8049e5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049e8:	20 75 73             	and    %dh,0x73(%rbp)
+  8049eb:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8049ef:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8049f6:	00 
+  8049f7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  8049fe:	00 00 
+  804a00:	42 05 80 00 00 00    	rex.X add $0x80,%eax
+  804a06:	00 00                	add    %al,(%rax)
+  804a08:	83 0b 80             	orl    $0xffffff80,(%rbx)
+  804a0b:	00 00                	add    %al,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 73 0b             	add    %dh,0xb(%rbx)
+  804a12:	80 00 00             	addb   $0x0,(%rax)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 61 05             	add    %ah,0x5(%rcx)
+  804a3a:	80 00 00             	addb   $0x0,(%rax)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 55 05             	add    %dl,0x5(%rbp)
+  804a52:	80 00 00             	addb   $0x0,(%rax)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 cf                	add    %cl,%bh
+  804a59:	05 80 00 00 00       	add    $0x80,%eax
+  804a5e:	00 00                	add    %al,(%rax)
+  804a60:	83 0b 80             	orl    $0xffffff80,(%rbx)
+  804a63:	00 00                	add    %al,(%rax)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 55 05             	add    %dl,0x5(%rbp)
+  804a6a:	80 00 00             	addb   $0x0,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 9b 05 80 00 00    	add    %bl,0x8005(%rbx)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 f2                	add    %dh,%dl
+  804c01:	05 80 00 00 00       	add    $0x80,%eax
+  804c06:	00 00                	add    %al,(%rax)
+  804c08:	c1 07 80             	roll   $0x80,(%rdi)
+  804c0b:	00 00                	add    %al,(%rax)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 21                	add    %ah,(%rcx)
+  804c31:	06                   	(bad)
+  804c32:	80 00 00             	addb   $0x0,(%rax)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 e7                	add    %ah,%bh
+  804c49:	05 80 00 00 00       	add    $0x80,%eax
+  804c4e:	00 00                	add    %al,(%rax)
+  804c50:	83 0b 80             	orl    $0xffffff80,(%rbx)
+  804c53:	00 00                	add    %al,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 69 09             	add    %ch,0x9(%rcx)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 33                	add    %dh,(%rbx)
+  804c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c6f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 b8 06 80 00 00    	add    %bh,0x8006(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 95 08 80 00 00    	add    %dl,0x8008(%rbp)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 a6 0a 80 00 00    	add    %ah,0x800a(%rsi)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 83 0b 80 00 00    	add    %al,0x800b(%rbx)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 4b 05             	add    %cl,0x5(%rbx)
+  804cba:	80 00 00             	addb   $0x0,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804cc0 <error_string>:
+	...
+  804cc8:	6d 48 80 00 00 00 00 00 7f 48 80 00 00 00 00 00     mH.......H......
+  804cd8:	8f 48 80 00 00 00 00 00 a1 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	af 48 80 00 00 00 00 00 c3 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	d8 48 80 00 00 00 00 00 eb 48 80 00 00 00 00 00     .H.......H......
+  804d08:	fd 48 80 00 00 00 00 00 11 49 80 00 00 00 00 00     .H.......I......
+  804d18:	21 49 80 00 00 00 00 00 34 49 80 00 00 00 00 00     !I......4I......
+  804d28:	4b 49 80 00 00 00 00 00 61 49 80 00 00 00 00 00     KI......aI......
+  804d38:	79 49 80 00 00 00 00 00 91 49 80 00 00 00 00 00     yI.......I......
+  804d48:	9e 49 80 00 00 00 00 00 78 4d 80 00 00 00 00 00     .I......xM......
+  804d58:	b2 49 80 00 00 00 00 00 ca 49 80 00 00 00 00 00     .I.......I......
+  804d68:	d4 49 80 00 00 00 00 00 de 49 80 00 00 00 00 00     .I.......I......
+  804d78:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d88:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d98:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804da8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804db8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804dc8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804dd8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804de8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804df8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804e08:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804e18:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804e28:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804e38:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  804e48:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  804e58:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804e68:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804e78:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804e88:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804e98:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804ea8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804eb8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804ec8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804ee0 <devtab>:
+  804ee0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804ef0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804f00:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804f10:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804f20:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804f30:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804f40:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  804f50:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804f60:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,8293 @@
+
+obj/user/faultallocbad:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ea 00 00 00       	call   80010d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+ * doesn't work because we sys_cputs instead of cprintf (exercise: why?) */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    int r;
+    void *addr = (void *)utf->utf_fault_va;
+  80002e:	48 8b 1f             	mov    (%rdi),%rbx
+
+    cprintf("fault %lx\n", (unsigned long)addr);
+  800031:	48 89 de             	mov    %rbx,%rsi
+  800034:	48 bf 70 47 80 00 00 	movabs $0x804770,%rdi
+  80003b:	00 00 00 
+  80003e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800043:	48 ba 33 03 80 00 00 	movabs $0x800333,%rdx
+  80004a:	00 00 00 
+  80004d:	ff d2                	call   *%rdx
+    if ((r = sys_alloc_region(0, ROUNDDOWN(addr, PAGE_SIZE),
+  80004f:	48 89 de             	mov    %rbx,%rsi
+  800052:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  800059:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80005e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800063:	bf 00 00 00 00       	mov    $0x0,%edi
+  800068:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  80006f:	00 00 00 
+  800072:	ff d0                	call   *%rax
+  800074:	85 c0                	test   %eax,%eax
+  800076:	78 32                	js     8000aa <handler+0x85>
+                              PAGE_SIZE, PROT_RW)) < 0)
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+    snprintf((char *)addr, 100, "this string was faulted in at %lx", (unsigned long)addr);
+  800078:	48 89 d9             	mov    %rbx,%rcx
+  80007b:	48 ba c0 47 80 00 00 	movabs $0x8047c0,%rdx
+  800082:	00 00 00 
+  800085:	be 64 00 00 00       	mov    $0x64,%esi
+  80008a:	48 89 df             	mov    %rbx,%rdi
+  80008d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800092:	49 b8 dd 0b 80 00 00 	movabs $0x800bdd,%r8
+  800099:	00 00 00 
+  80009c:	41 ff d0             	call   *%r8
+    return 1;
+}
+  80009f:	b8 01 00 00 00       	mov    $0x1,%eax
+  8000a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8000a8:	c9                   	leave
+  8000a9:	c3                   	ret
+        panic("allocating at %lx in page fault handler: %i", (unsigned long)addr, r);
+  8000aa:	41 89 c0             	mov    %eax,%r8d
+  8000ad:	48 89 d9             	mov    %rbx,%rcx
+  8000b0:	48 ba 90 47 80 00 00 	movabs $0x804790,%rdx
+  8000b7:	00 00 00 
+  8000ba:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000bf:	48 bf 7b 47 80 00 00 	movabs $0x80477b,%rdi
+  8000c6:	00 00 00 
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  8000d5:	00 00 00 
+  8000d8:	41 ff d1             	call   *%r9
+
+00000000008000db <umain>:
+
+void
+umain(int argc, char **argv) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  8000df:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  8000e6:	00 00 00 
+  8000e9:	48 b8 74 16 80 00 00 	movabs $0x801674,%rax
+  8000f0:	00 00 00 
+  8000f3:	ff d0                	call   *%rax
+    sys_cputs((char *)0xDEADBEEF, 4);
+  8000f5:	be 04 00 00 00       	mov    $0x4,%esi
+  8000fa:	bf ef be ad de       	mov    $0xdeadbeef,%edi
+  8000ff:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  800106:	00 00 00 
+  800109:	ff d0                	call   *%rax
+}
+  80010b:	5d                   	pop    %rbp
+  80010c:	c3                   	ret
+
+000000000080010d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80010d:	55                   	push   %rbp
+  80010e:	48 89 e5             	mov    %rsp,%rbp
+  800111:	41 56                	push   %r14
+  800113:	41 55                	push   %r13
+  800115:	41 54                	push   %r12
+  800117:	53                   	push   %rbx
+  800118:	41 89 fd             	mov    %edi,%r13d
+  80011b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80011e:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800125:	00 00 00 
+  800128:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80012f:	00 00 00 
+  800132:	48 39 c2             	cmp    %rax,%rdx
+  800135:	73 17                	jae    80014e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800137:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80013a:	49 89 c4             	mov    %rax,%r12
+  80013d:	48 83 c3 08          	add    $0x8,%rbx
+  800141:	b8 00 00 00 00       	mov    $0x0,%eax
+  800146:	ff 53 f8             	call   *-0x8(%rbx)
+  800149:	4c 39 e3             	cmp    %r12,%rbx
+  80014c:	72 ef                	jb     80013d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80014e:	48 b8 2a 11 80 00 00 	movabs $0x80112a,%rax
+  800155:	00 00 00 
+  800158:	ff d0                	call   *%rax
+  80015a:	89 c2                	mov    %eax,%edx
+  80015c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800162:	48 89 d0             	mov    %rdx,%rax
+  800165:	48 c1 e0 04          	shl    $0x4,%rax
+  800169:	48 29 d0             	sub    %rdx,%rax
+  80016c:	48 c1 e0 05          	shl    $0x5,%rax
+  800170:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800177:	00 00 00 
+  80017a:	48 01 d0             	add    %rdx,%rax
+  80017d:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800184:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800187:	45 85 ed             	test   %r13d,%r13d
+  80018a:	7e 0d                	jle    800199 <libmain+0x8c>
+  80018c:	49 8b 06             	mov    (%r14),%rax
+  80018f:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  800196:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800199:	4c 89 f6             	mov    %r14,%rsi
+  80019c:	44 89 ef             	mov    %r13d,%edi
+  80019f:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8001a6:	00 00 00 
+  8001a9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001ab:	48 b8 c0 01 80 00 00 	movabs $0x8001c0,%rax
+  8001b2:	00 00 00 
+  8001b5:	ff d0                	call   *%rax
+#endif
+}
+  8001b7:	5b                   	pop    %rbx
+  8001b8:	41 5c                	pop    %r12
+  8001ba:	41 5d                	pop    %r13
+  8001bc:	41 5e                	pop    %r14
+  8001be:	5d                   	pop    %rbp
+  8001bf:	c3                   	ret
+
+00000000008001c0 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001c0:	55                   	push   %rbp
+  8001c1:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001c4:	48 b8 dd 1a 80 00 00 	movabs $0x801add,%rax
+  8001cb:	00 00 00 
+  8001ce:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001d5:	48 b8 c7 10 80 00 00 	movabs $0x8010c7,%rax
+  8001dc:	00 00 00 
+  8001df:	ff d0                	call   *%rax
+}
+  8001e1:	5d                   	pop    %rbp
+  8001e2:	c3                   	ret
+
+00000000008001e3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8001e3:	55                   	push   %rbp
+  8001e4:	48 89 e5             	mov    %rsp,%rbp
+  8001e7:	41 56                	push   %r14
+  8001e9:	41 55                	push   %r13
+  8001eb:	41 54                	push   %r12
+  8001ed:	53                   	push   %rbx
+  8001ee:	48 83 ec 50          	sub    $0x50,%rsp
+  8001f2:	49 89 fc             	mov    %rdi,%r12
+  8001f5:	41 89 f5             	mov    %esi,%r13d
+  8001f8:	48 89 d3             	mov    %rdx,%rbx
+  8001fb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8001ff:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800203:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800207:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80020e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800212:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800216:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80021a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80021e:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  800225:	00 00 00 
+  800228:	4c 8b 30             	mov    (%rax),%r14
+  80022b:	48 b8 2a 11 80 00 00 	movabs $0x80112a,%rax
+  800232:	00 00 00 
+  800235:	ff d0                	call   *%rax
+  800237:	89 c6                	mov    %eax,%esi
+  800239:	45 89 e8             	mov    %r13d,%r8d
+  80023c:	4c 89 e1             	mov    %r12,%rcx
+  80023f:	4c 89 f2             	mov    %r14,%rdx
+  800242:	48 bf f0 47 80 00 00 	movabs $0x8047f0,%rdi
+  800249:	00 00 00 
+  80024c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800251:	49 bc 33 03 80 00 00 	movabs $0x800333,%r12
+  800258:	00 00 00 
+  80025b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80025e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800262:	48 89 df             	mov    %rbx,%rdi
+  800265:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  80026c:	00 00 00 
+  80026f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800271:	48 bf 8b 4e 80 00 00 	movabs $0x804e8b,%rdi
+  800278:	00 00 00 
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800283:	cc                   	int3
+  800284:	eb fd                	jmp    800283 <_panic+0xa0>
+
+0000000000800286 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800286:	55                   	push   %rbp
+  800287:	48 89 e5             	mov    %rsp,%rbp
+  80028a:	53                   	push   %rbx
+  80028b:	48 83 ec 08          	sub    $0x8,%rsp
+  80028f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800292:	8b 06                	mov    (%rsi),%eax
+  800294:	8d 50 01             	lea    0x1(%rax),%edx
+  800297:	89 16                	mov    %edx,(%rsi)
+  800299:	48 98                	cltq
+  80029b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8002a0:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8002a6:	74 0a                	je     8002b2 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8002a8:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8002ac:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8002b0:	c9                   	leave
+  8002b1:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8002b2:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8002b6:	be ff 00 00 00       	mov    $0xff,%esi
+  8002bb:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  8002c2:	00 00 00 
+  8002c5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002c7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002cd:	eb d9                	jmp    8002a8 <putch+0x22>
+
+00000000008002cf <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002cf:	55                   	push   %rbp
+  8002d0:	48 89 e5             	mov    %rsp,%rbp
+  8002d3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002da:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002dd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002e4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ee:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002f1:	48 89 f1             	mov    %rsi,%rcx
+  8002f4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002fb:	48 bf 86 02 80 00 00 	movabs $0x800286,%rdi
+  800302:	00 00 00 
+  800305:	48 b8 83 04 80 00 00 	movabs $0x800483,%rax
+  80030c:	00 00 00 
+  80030f:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800311:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800318:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80031f:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  800326:	00 00 00 
+  800329:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80032b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800331:	c9                   	leave
+  800332:	c3                   	ret
+
+0000000000800333 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800333:	55                   	push   %rbp
+  800334:	48 89 e5             	mov    %rsp,%rbp
+  800337:	48 83 ec 50          	sub    $0x50,%rsp
+  80033b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80033f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800343:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800347:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80034b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80034f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800356:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80035a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80035e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800362:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800366:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80036a:	48 b8 cf 02 80 00 00 	movabs $0x8002cf,%rax
+  800371:	00 00 00 
+  800374:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800376:	c9                   	leave
+  800377:	c3                   	ret
+
+0000000000800378 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800378:	55                   	push   %rbp
+  800379:	48 89 e5             	mov    %rsp,%rbp
+  80037c:	41 57                	push   %r15
+  80037e:	41 56                	push   %r14
+  800380:	41 55                	push   %r13
+  800382:	41 54                	push   %r12
+  800384:	53                   	push   %rbx
+  800385:	48 83 ec 18          	sub    $0x18,%rsp
+  800389:	49 89 fc             	mov    %rdi,%r12
+  80038c:	49 89 f5             	mov    %rsi,%r13
+  80038f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800393:	8b 45 10             	mov    0x10(%rbp),%eax
+  800396:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800399:	41 89 cf             	mov    %ecx,%r15d
+  80039c:	4c 39 fa             	cmp    %r15,%rdx
+  80039f:	73 5b                	jae    8003fc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8003a1:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8003a5:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8003a9:	85 db                	test   %ebx,%ebx
+  8003ab:	7e 0e                	jle    8003bb <print_num+0x43>
+            putch(padc, put_arg);
+  8003ad:	4c 89 ee             	mov    %r13,%rsi
+  8003b0:	44 89 f7             	mov    %r14d,%edi
+  8003b3:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8003b6:	83 eb 01             	sub    $0x1,%ebx
+  8003b9:	75 f2                	jne    8003ad <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8003bb:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8003bf:	48 b9 24 48 80 00 00 	movabs $0x804824,%rcx
+  8003c6:	00 00 00 
+  8003c9:	48 b8 13 48 80 00 00 	movabs $0x804813,%rax
+  8003d0:	00 00 00 
+  8003d3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e0:	49 f7 f7             	div    %r15
+  8003e3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003e7:	4c 89 ee             	mov    %r13,%rsi
+  8003ea:	41 ff d4             	call   *%r12
+}
+  8003ed:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003f1:	5b                   	pop    %rbx
+  8003f2:	41 5c                	pop    %r12
+  8003f4:	41 5d                	pop    %r13
+  8003f6:	41 5e                	pop    %r14
+  8003f8:	41 5f                	pop    %r15
+  8003fa:	5d                   	pop    %rbp
+  8003fb:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800400:	ba 00 00 00 00       	mov    $0x0,%edx
+  800405:	49 f7 f7             	div    %r15
+  800408:	48 83 ec 08          	sub    $0x8,%rsp
+  80040c:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800410:	52                   	push   %rdx
+  800411:	45 0f be c9          	movsbl %r9b,%r9d
+  800415:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800419:	48 89 c2             	mov    %rax,%rdx
+  80041c:	48 b8 78 03 80 00 00 	movabs $0x800378,%rax
+  800423:	00 00 00 
+  800426:	ff d0                	call   *%rax
+  800428:	48 83 c4 10          	add    $0x10,%rsp
+  80042c:	eb 8d                	jmp    8003bb <print_num+0x43>
+
+000000000080042e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80042e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800432:	48 8b 06             	mov    (%rsi),%rax
+  800435:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800439:	73 0a                	jae    800445 <sprintputch+0x17>
+        *state->start++ = ch;
+  80043b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80043f:	48 89 16             	mov    %rdx,(%rsi)
+  800442:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800445:	c3                   	ret
+
+0000000000800446 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800446:	55                   	push   %rbp
+  800447:	48 89 e5             	mov    %rsp,%rbp
+  80044a:	48 83 ec 50          	sub    $0x50,%rsp
+  80044e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800452:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800456:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80045a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800461:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800465:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800469:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80046d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800471:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800475:	48 b8 83 04 80 00 00 	movabs $0x800483,%rax
+  80047c:	00 00 00 
+  80047f:	ff d0                	call   *%rax
+}
+  800481:	c9                   	leave
+  800482:	c3                   	ret
+
+0000000000800483 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800483:	55                   	push   %rbp
+  800484:	48 89 e5             	mov    %rsp,%rbp
+  800487:	41 57                	push   %r15
+  800489:	41 56                	push   %r14
+  80048b:	41 55                	push   %r13
+  80048d:	41 54                	push   %r12
+  80048f:	53                   	push   %rbx
+  800490:	48 83 ec 38          	sub    $0x38,%rsp
+  800494:	49 89 fe             	mov    %rdi,%r14
+  800497:	49 89 f5             	mov    %rsi,%r13
+  80049a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80049d:	48 8b 01             	mov    (%rcx),%rax
+  8004a0:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8004a4:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8004a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004ac:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8004b0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8004b4:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8004b8:	0f b6 3b             	movzbl (%rbx),%edi
+  8004bb:	40 80 ff 25          	cmp    $0x25,%dil
+  8004bf:	74 18                	je     8004d9 <vprintfmt+0x56>
+            if (!ch) return;
+  8004c1:	40 84 ff             	test   %dil,%dil
+  8004c4:	0f 84 b1 06 00 00    	je     800b7b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004ca:	40 0f b6 ff          	movzbl %dil,%edi
+  8004ce:	4c 89 ee             	mov    %r13,%rsi
+  8004d1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004d4:	4c 89 e3             	mov    %r12,%rbx
+  8004d7:	eb db                	jmp    8004b4 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004d9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004de:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004e2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004e7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ed:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004f4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004fd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800502:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800505:	83 e8 23             	sub    $0x23,%eax
+  800508:	3c 57                	cmp    $0x57,%al
+  80050a:	0f 87 51 06 00 00    	ja     800b61 <vprintfmt+0x6de>
+  800510:	0f b6 c0             	movzbl %al,%eax
+  800513:	48 b9 e0 49 80 00 00 	movabs $0x8049e0,%rcx
+  80051a:	00 00 00 
+  80051d:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800520:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800523:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800527:	eb cf                	jmp    8004f8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800529:	49 89 dc             	mov    %rbx,%r12
+  80052c:	be 01 00 00 00       	mov    $0x1,%esi
+  800531:	eb c5                	jmp    8004f8 <vprintfmt+0x75>
+            padc = ch;
+  800533:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800537:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80053a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053d:	eb b9                	jmp    8004f8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80053f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800542:	83 f8 2f             	cmp    $0x2f,%eax
+  800545:	77 24                	ja     80056b <vprintfmt+0xe8>
+  800547:	89 c1                	mov    %eax,%ecx
+  800549:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80054d:	83 c0 08             	add    $0x8,%eax
+  800550:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800553:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800556:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800559:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80055d:	79 99                	jns    8004f8 <vprintfmt+0x75>
+                width = precision;
+  80055f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800563:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800569:	eb 8d                	jmp    8004f8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80056b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80056f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800573:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800577:	eb da                	jmp    800553 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800579:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80057e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800582:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800588:	3c 39                	cmp    $0x39,%al
+  80058a:	77 1c                	ja     8005a8 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80058c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800590:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800594:	0f b6 c0             	movzbl %al,%eax
+  800597:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80059c:	0f b6 03             	movzbl (%rbx),%eax
+  80059f:	3c 39                	cmp    $0x39,%al
+  8005a1:	76 e9                	jbe    80058c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8005a3:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8005a6:	eb b1                	jmp    800559 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8005a8:	49 89 dc             	mov    %rbx,%r12
+  8005ab:	eb ac                	jmp    800559 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8005ad:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8005b0:	85 c9                	test   %ecx,%ecx
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	0f 49 c1             	cmovns %ecx,%eax
+  8005ba:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8005bd:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005c0:	e9 33 ff ff ff       	jmp    8004f8 <vprintfmt+0x75>
+            lflag++;
+  8005c5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005c8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005cb:	e9 28 ff ff ff       	jmp    8004f8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005d0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005d3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005d6:	77 19                	ja     8005f1 <vprintfmt+0x16e>
+  8005d8:	89 c2                	mov    %eax,%edx
+  8005da:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005de:	83 c0 08             	add    $0x8,%eax
+  8005e1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005e4:	8b 3a                	mov    (%rdx),%edi
+  8005e6:	4c 89 ee             	mov    %r13,%rsi
+  8005e9:	41 ff d6             	call   *%r14
+            break;
+  8005ec:	e9 c3 fe ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fd:	eb e5                	jmp    8005e4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800602:	83 f8 2f             	cmp    $0x2f,%eax
+  800605:	77 5a                	ja     800661 <vprintfmt+0x1de>
+  800607:	89 c2                	mov    %eax,%edx
+  800609:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80060d:	83 c0 08             	add    $0x8,%eax
+  800610:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800613:	8b 02                	mov    (%rdx),%eax
+  800615:	89 c1                	mov    %eax,%ecx
+  800617:	f7 d9                	neg    %ecx
+  800619:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80061c:	83 f9 16             	cmp    $0x16,%ecx
+  80061f:	7f 4e                	jg     80066f <vprintfmt+0x1ec>
+  800621:	48 63 c1             	movslq %ecx,%rax
+  800624:	48 ba a0 4c 80 00 00 	movabs $0x804ca0,%rdx
+  80062b:	00 00 00 
+  80062e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800632:	48 85 c0             	test   %rax,%rax
+  800635:	74 38                	je     80066f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800637:	48 89 c1             	mov    %rax,%rcx
+  80063a:	48 ba 2a 4e 80 00 00 	movabs $0x804e2a,%rdx
+  800641:	00 00 00 
+  800644:	4c 89 ee             	mov    %r13,%rsi
+  800647:	4c 89 f7             	mov    %r14,%rdi
+  80064a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064f:	49 b8 46 04 80 00 00 	movabs $0x800446,%r8
+  800656:	00 00 00 
+  800659:	41 ff d0             	call   *%r8
+  80065c:	e9 53 fe ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800661:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800665:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800669:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80066d:	eb a4                	jmp    800613 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80066f:	48 ba 3c 48 80 00 00 	movabs $0x80483c,%rdx
+  800676:	00 00 00 
+  800679:	4c 89 ee             	mov    %r13,%rsi
+  80067c:	4c 89 f7             	mov    %r14,%rdi
+  80067f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800684:	49 b8 46 04 80 00 00 	movabs $0x800446,%r8
+  80068b:	00 00 00 
+  80068e:	41 ff d0             	call   *%r8
+  800691:	e9 1e fe ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800696:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800699:	83 f8 2f             	cmp    $0x2f,%eax
+  80069c:	77 6c                	ja     80070a <vprintfmt+0x287>
+  80069e:	89 c2                	mov    %eax,%edx
+  8006a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a4:	83 c0 08             	add    $0x8,%eax
+  8006a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006aa:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8006ad:	48 85 d2             	test   %rdx,%rdx
+  8006b0:	48 b8 35 48 80 00 00 	movabs $0x804835,%rax
+  8006b7:	00 00 00 
+  8006ba:	48 0f 45 c2          	cmovne %rdx,%rax
+  8006be:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006c2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006c6:	7e 06                	jle    8006ce <vprintfmt+0x24b>
+  8006c8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006cc:	75 4a                	jne    800718 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006ce:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006d2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006d6:	0f b6 00             	movzbl (%rax),%eax
+  8006d9:	84 c0                	test   %al,%al
+  8006db:	0f 85 9a 00 00 00    	jne    80077b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006e1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006e8:	85 c0                	test   %eax,%eax
+  8006ea:	0f 8e c4 fd ff ff    	jle    8004b4 <vprintfmt+0x31>
+  8006f0:	4c 89 ee             	mov    %r13,%rsi
+  8006f3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006f8:	41 ff d6             	call   *%r14
+  8006fb:	41 83 ec 01          	sub    $0x1,%r12d
+  8006ff:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800703:	75 eb                	jne    8006f0 <vprintfmt+0x26d>
+  800705:	e9 aa fd ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80070a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80070e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800712:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800716:	eb 92                	jmp    8006aa <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800718:	49 63 f7             	movslq %r15d,%rsi
+  80071b:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80071f:	48 b8 35 0c 80 00 00 	movabs $0x800c35,%rax
+  800726:	00 00 00 
+  800729:	ff d0                	call   *%rax
+  80072b:	48 89 c2             	mov    %rax,%rdx
+  80072e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800731:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800733:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800736:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800739:	85 c0                	test   %eax,%eax
+  80073b:	7e 91                	jle    8006ce <vprintfmt+0x24b>
+  80073d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800742:	4c 89 ee             	mov    %r13,%rsi
+  800745:	44 89 e7             	mov    %r12d,%edi
+  800748:	41 ff d6             	call   *%r14
+  80074b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80074f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800752:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800755:	75 eb                	jne    800742 <vprintfmt+0x2bf>
+  800757:	e9 72 ff ff ff       	jmp    8006ce <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80075c:	0f b6 f8             	movzbl %al,%edi
+  80075f:	4c 89 ee             	mov    %r13,%rsi
+  800762:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800765:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800769:	49 83 c4 01          	add    $0x1,%r12
+  80076d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800773:	84 c0                	test   %al,%al
+  800775:	0f 84 66 ff ff ff    	je     8006e1 <vprintfmt+0x25e>
+  80077b:	45 85 ff             	test   %r15d,%r15d
+  80077e:	78 0a                	js     80078a <vprintfmt+0x307>
+  800780:	41 83 ef 01          	sub    $0x1,%r15d
+  800784:	0f 88 57 ff ff ff    	js     8006e1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80078a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80078e:	74 cc                	je     80075c <vprintfmt+0x2d9>
+  800790:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800793:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800798:	80 fa 5e             	cmp    $0x5e,%dl
+  80079b:	77 c2                	ja     80075f <vprintfmt+0x2dc>
+  80079d:	eb bd                	jmp    80075c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80079f:	40 84 f6             	test   %sil,%sil
+  8007a2:	75 26                	jne    8007ca <vprintfmt+0x347>
+    switch (lflag) {
+  8007a4:	85 d2                	test   %edx,%edx
+  8007a6:	74 59                	je     800801 <vprintfmt+0x37e>
+  8007a8:	83 fa 01             	cmp    $0x1,%edx
+  8007ab:	74 7b                	je     800828 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8007ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b3:	0f 87 96 00 00 00    	ja     80084f <vprintfmt+0x3cc>
+  8007b9:	89 c2                	mov    %eax,%edx
+  8007bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bf:	83 c0 08             	add    $0x8,%eax
+  8007c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c5:	4c 8b 22             	mov    (%rdx),%r12
+  8007c8:	eb 17                	jmp    8007e1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007d0:	77 21                	ja     8007f3 <vprintfmt+0x370>
+  8007d2:	89 c2                	mov    %eax,%edx
+  8007d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d8:	83 c0 08             	add    $0x8,%eax
+  8007db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007de:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007e1:	4d 85 e4             	test   %r12,%r12
+  8007e4:	78 7a                	js     800860 <vprintfmt+0x3dd>
+            num = i;
+  8007e6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007e9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007ee:	e9 50 02 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ff:	eb dd                	jmp    8007de <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800801:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800804:	83 f8 2f             	cmp    $0x2f,%eax
+  800807:	77 11                	ja     80081a <vprintfmt+0x397>
+  800809:	89 c2                	mov    %eax,%edx
+  80080b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080f:	83 c0 08             	add    $0x8,%eax
+  800812:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800815:	4c 63 22             	movslq (%rdx),%r12
+  800818:	eb c7                	jmp    8007e1 <vprintfmt+0x35e>
+  80081a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800822:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800826:	eb ed                	jmp    800815 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800828:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082b:	83 f8 2f             	cmp    $0x2f,%eax
+  80082e:	77 11                	ja     800841 <vprintfmt+0x3be>
+  800830:	89 c2                	mov    %eax,%edx
+  800832:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800836:	83 c0 08             	add    $0x8,%eax
+  800839:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80083c:	4c 8b 22             	mov    (%rdx),%r12
+  80083f:	eb a0                	jmp    8007e1 <vprintfmt+0x35e>
+  800841:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800845:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800849:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80084d:	eb ed                	jmp    80083c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80084f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800853:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800857:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085b:	e9 65 ff ff ff       	jmp    8007c5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800860:	4c 89 ee             	mov    %r13,%rsi
+  800863:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800868:	41 ff d6             	call   *%r14
+                i = -i;
+  80086b:	49 f7 dc             	neg    %r12
+  80086e:	e9 73 ff ff ff       	jmp    8007e6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800873:	40 84 f6             	test   %sil,%sil
+  800876:	75 32                	jne    8008aa <vprintfmt+0x427>
+    switch (lflag) {
+  800878:	85 d2                	test   %edx,%edx
+  80087a:	74 5d                	je     8008d9 <vprintfmt+0x456>
+  80087c:	83 fa 01             	cmp    $0x1,%edx
+  80087f:	0f 84 82 00 00 00    	je     800907 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800885:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800888:	83 f8 2f             	cmp    $0x2f,%eax
+  80088b:	0f 87 a5 00 00 00    	ja     800936 <vprintfmt+0x4b3>
+  800891:	89 c2                	mov    %eax,%edx
+  800893:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800897:	83 c0 08             	add    $0x8,%eax
+  80089a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008a5:	e9 99 01 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b0:	77 19                	ja     8008cb <vprintfmt+0x448>
+  8008b2:	89 c2                	mov    %eax,%edx
+  8008b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b8:	83 c0 08             	add    $0x8,%eax
+  8008bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008be:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008c1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008c6:	e9 78 01 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+  8008cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d7:	eb e5                	jmp    8008be <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008df:	77 18                	ja     8008f9 <vprintfmt+0x476>
+  8008e1:	89 c2                	mov    %eax,%edx
+  8008e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008e7:	83 c0 08             	add    $0x8,%eax
+  8008ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ed:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008ef:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008f4:	e9 4a 01 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb e6                	jmp    8008ed <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 19                	ja     800928 <vprintfmt+0x4a5>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800923:	e9 1b 01 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+  800928:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80092c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800930:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800934:	eb e5                	jmp    80091b <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800936:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800942:	e9 56 ff ff ff       	jmp    80089d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800947:	40 84 f6             	test   %sil,%sil
+  80094a:	75 2e                	jne    80097a <vprintfmt+0x4f7>
+    switch (lflag) {
+  80094c:	85 d2                	test   %edx,%edx
+  80094e:	74 59                	je     8009a9 <vprintfmt+0x526>
+  800950:	83 fa 01             	cmp    $0x1,%edx
+  800953:	74 7f                	je     8009d4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800955:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800958:	83 f8 2f             	cmp    $0x2f,%eax
+  80095b:	0f 87 9f 00 00 00    	ja     800a00 <vprintfmt+0x57d>
+  800961:	89 c2                	mov    %eax,%edx
+  800963:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800967:	83 c0 08             	add    $0x8,%eax
+  80096a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800970:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800975:	e9 c9 00 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80097a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097d:	83 f8 2f             	cmp    $0x2f,%eax
+  800980:	77 19                	ja     80099b <vprintfmt+0x518>
+  800982:	89 c2                	mov    %eax,%edx
+  800984:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800988:	83 c0 08             	add    $0x8,%eax
+  80098b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800991:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800996:	e9 a8 00 00 00       	jmp    800a43 <vprintfmt+0x5c0>
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	eb e5                	jmp    80098e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  8009a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8009af:	77 15                	ja     8009c6 <vprintfmt+0x543>
+  8009b1:	89 c2                	mov    %eax,%edx
+  8009b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b7:	83 c0 08             	add    $0x8,%eax
+  8009ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009bd:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8009bf:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009c4:	eb 7d                	jmp    800a43 <vprintfmt+0x5c0>
+  8009c6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ce:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d2:	eb e9                	jmp    8009bd <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009d4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009da:	77 16                	ja     8009f2 <vprintfmt+0x56f>
+  8009dc:	89 c2                	mov    %eax,%edx
+  8009de:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e2:	83 c0 08             	add    $0x8,%eax
+  8009e5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009eb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009f0:	eb 51                	jmp    800a43 <vprintfmt+0x5c0>
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	eb e8                	jmp    8009e8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	e9 5c ff ff ff       	jmp    80096d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a11:	4c 89 ee             	mov    %r13,%rsi
+  800a14:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a19:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a1c:	4c 89 ee             	mov    %r13,%rsi
+  800a1f:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a24:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 47                	ja     800a76 <vprintfmt+0x5f3>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a43:	48 83 ec 08          	sub    $0x8,%rsp
+  800a47:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a4b:	0f 94 c0             	sete   %al
+  800a4e:	0f b6 c0             	movzbl %al,%eax
+  800a51:	50                   	push   %rax
+  800a52:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a57:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a5b:	4c 89 ee             	mov    %r13,%rsi
+  800a5e:	4c 89 f7             	mov    %r14,%rdi
+  800a61:	48 b8 78 03 80 00 00 	movabs $0x800378,%rax
+  800a68:	00 00 00 
+  800a6b:	ff d0                	call   *%rax
+            break;
+  800a6d:	48 83 c4 10          	add    $0x10,%rsp
+  800a71:	e9 3e fa ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a76:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a82:	eb b7                	jmp    800a3b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a84:	40 84 f6             	test   %sil,%sil
+  800a87:	75 2b                	jne    800ab4 <vprintfmt+0x631>
+    switch (lflag) {
+  800a89:	85 d2                	test   %edx,%edx
+  800a8b:	74 56                	je     800ae3 <vprintfmt+0x660>
+  800a8d:	83 fa 01             	cmp    $0x1,%edx
+  800a90:	74 7f                	je     800b11 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a92:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a95:	83 f8 2f             	cmp    $0x2f,%eax
+  800a98:	0f 87 a2 00 00 00    	ja     800b40 <vprintfmt+0x6bd>
+  800a9e:	89 c2                	mov    %eax,%edx
+  800aa0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa4:	83 c0 08             	add    $0x8,%eax
+  800aa7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aaa:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aad:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ab2:	eb 8f                	jmp    800a43 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ab4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aba:	77 19                	ja     800ad5 <vprintfmt+0x652>
+  800abc:	89 c2                	mov    %eax,%edx
+  800abe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac2:	83 c0 08             	add    $0x8,%eax
+  800ac5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800acb:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ad0:	e9 6e ff ff ff       	jmp    800a43 <vprintfmt+0x5c0>
+  800ad5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800add:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae1:	eb e5                	jmp    800ac8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ae3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae9:	77 18                	ja     800b03 <vprintfmt+0x680>
+  800aeb:	89 c2                	mov    %eax,%edx
+  800aed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af1:	83 c0 08             	add    $0x8,%eax
+  800af4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800af9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800afe:	e9 40 ff ff ff       	jmp    800a43 <vprintfmt+0x5c0>
+  800b03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0f:	eb e6                	jmp    800af7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b14:	83 f8 2f             	cmp    $0x2f,%eax
+  800b17:	77 19                	ja     800b32 <vprintfmt+0x6af>
+  800b19:	89 c2                	mov    %eax,%edx
+  800b1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b1f:	83 c0 08             	add    $0x8,%eax
+  800b22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b25:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b2d:	e9 11 ff ff ff       	jmp    800a43 <vprintfmt+0x5c0>
+  800b32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3e:	eb e5                	jmp    800b25 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4c:	e9 59 ff ff ff       	jmp    800aaa <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b51:	4c 89 ee             	mov    %r13,%rsi
+  800b54:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b59:	41 ff d6             	call   *%r14
+            break;
+  800b5c:	e9 53 f9 ff ff       	jmp    8004b4 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b61:	4c 89 ee             	mov    %r13,%rsi
+  800b64:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b69:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b6c:	48 83 eb 01          	sub    $0x1,%rbx
+  800b70:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b74:	75 f6                	jne    800b6c <vprintfmt+0x6e9>
+  800b76:	e9 39 f9 ff ff       	jmp    8004b4 <vprintfmt+0x31>
+}
+  800b7b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b7f:	5b                   	pop    %rbx
+  800b80:	41 5c                	pop    %r12
+  800b82:	41 5d                	pop    %r13
+  800b84:	41 5e                	pop    %r14
+  800b86:	41 5f                	pop    %r15
+  800b88:	5d                   	pop    %rbp
+  800b89:	c3                   	ret
+
+0000000000800b8a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b8a:	55                   	push   %rbp
+  800b8b:	48 89 e5             	mov    %rsp,%rbp
+  800b8e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b92:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b96:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b9b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b9f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ba6:	48 85 ff             	test   %rdi,%rdi
+  800ba9:	74 2b                	je     800bd6 <vsnprintf+0x4c>
+  800bab:	48 85 f6             	test   %rsi,%rsi
+  800bae:	74 26                	je     800bd6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800bb0:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bb4:	48 bf 2e 04 80 00 00 	movabs $0x80042e,%rdi
+  800bbb:	00 00 00 
+  800bbe:	48 b8 83 04 80 00 00 	movabs $0x800483,%rax
+  800bc5:	00 00 00 
+  800bc8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800bca:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bce:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bd1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bd4:	c9                   	leave
+  800bd5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bd6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bdb:	eb f7                	jmp    800bd4 <vsnprintf+0x4a>
+
+0000000000800bdd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bdd:	55                   	push   %rbp
+  800bde:	48 89 e5             	mov    %rsp,%rbp
+  800be1:	48 83 ec 50          	sub    $0x50,%rsp
+  800be5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800be9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bf1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bf8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bfc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c00:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c04:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c08:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c0c:	48 b8 8a 0b 80 00 00 	movabs $0x800b8a,%rax
+  800c13:	00 00 00 
+  800c16:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c18:	c9                   	leave
+  800c19:	c3                   	ret
+
+0000000000800c1a <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c1a:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c1d:	74 10                	je     800c2f <strlen+0x15>
+    size_t n = 0;
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c24:	48 83 c0 01          	add    $0x1,%rax
+  800c28:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c2c:	75 f6                	jne    800c24 <strlen+0xa>
+  800c2e:	c3                   	ret
+    size_t n = 0;
+  800c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c34:	c3                   	ret
+
+0000000000800c35 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c35:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c38:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c3d:	48 85 f6             	test   %rsi,%rsi
+  800c40:	74 11                	je     800c53 <strnlen+0x1e>
+  800c42:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c46:	74 0c                	je     800c54 <strnlen+0x1f>
+  800c48:	48 83 c2 01          	add    $0x1,%rdx
+  800c4c:	48 39 d0             	cmp    %rdx,%rax
+  800c4f:	75 f1                	jne    800c42 <strnlen+0xd>
+  800c51:	eb 04                	jmp    800c57 <strnlen+0x22>
+  800c53:	c3                   	ret
+  800c54:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c57:	c3                   	ret
+
+0000000000800c58 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c58:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c60:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c64:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c67:	48 83 c2 01          	add    $0x1,%rdx
+  800c6b:	84 c9                	test   %cl,%cl
+  800c6d:	75 f1                	jne    800c60 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c6f:	c3                   	ret
+
+0000000000800c70 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c70:	55                   	push   %rbp
+  800c71:	48 89 e5             	mov    %rsp,%rbp
+  800c74:	41 54                	push   %r12
+  800c76:	53                   	push   %rbx
+  800c77:	48 89 fb             	mov    %rdi,%rbx
+  800c7a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c7d:	48 b8 1a 0c 80 00 00 	movabs $0x800c1a,%rax
+  800c84:	00 00 00 
+  800c87:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c89:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c8d:	4c 89 e6             	mov    %r12,%rsi
+  800c90:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  800c97:	00 00 00 
+  800c9a:	ff d0                	call   *%rax
+    return dst;
+}
+  800c9c:	48 89 d8             	mov    %rbx,%rax
+  800c9f:	5b                   	pop    %rbx
+  800ca0:	41 5c                	pop    %r12
+  800ca2:	5d                   	pop    %rbp
+  800ca3:	c3                   	ret
+
+0000000000800ca4 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ca4:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ca7:	48 85 d2             	test   %rdx,%rdx
+  800caa:	74 1f                	je     800ccb <strncpy+0x27>
+  800cac:	48 01 fa             	add    %rdi,%rdx
+  800caf:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800cb2:	48 83 c1 01          	add    $0x1,%rcx
+  800cb6:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800cba:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800cbe:	41 80 f8 01          	cmp    $0x1,%r8b
+  800cc2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800cc6:	48 39 ca             	cmp    %rcx,%rdx
+  800cc9:	75 e7                	jne    800cb2 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ccb:	c3                   	ret
+
+0000000000800ccc <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ccc:	48 89 f8             	mov    %rdi,%rax
+  800ccf:	48 85 d2             	test   %rdx,%rdx
+  800cd2:	74 24                	je     800cf8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cd4:	48 83 ea 01          	sub    $0x1,%rdx
+  800cd8:	74 1b                	je     800cf5 <strlcpy+0x29>
+  800cda:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cde:	0f b6 16             	movzbl (%rsi),%edx
+  800ce1:	84 d2                	test   %dl,%dl
+  800ce3:	74 10                	je     800cf5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ce5:	48 83 c6 01          	add    $0x1,%rsi
+  800ce9:	48 83 c0 01          	add    $0x1,%rax
+  800ced:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cf0:	48 39 c8             	cmp    %rcx,%rax
+  800cf3:	75 e9                	jne    800cde <strlcpy+0x12>
+        *dst = '\0';
+  800cf5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cf8:	48 29 f8             	sub    %rdi,%rax
+}
+  800cfb:	c3                   	ret
+
+0000000000800cfc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cfc:	0f b6 07             	movzbl (%rdi),%eax
+  800cff:	84 c0                	test   %al,%al
+  800d01:	74 13                	je     800d16 <strcmp+0x1a>
+  800d03:	38 06                	cmp    %al,(%rsi)
+  800d05:	75 0f                	jne    800d16 <strcmp+0x1a>
+  800d07:	48 83 c7 01          	add    $0x1,%rdi
+  800d0b:	48 83 c6 01          	add    $0x1,%rsi
+  800d0f:	0f b6 07             	movzbl (%rdi),%eax
+  800d12:	84 c0                	test   %al,%al
+  800d14:	75 ed                	jne    800d03 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d16:	0f b6 c0             	movzbl %al,%eax
+  800d19:	0f b6 16             	movzbl (%rsi),%edx
+  800d1c:	29 d0                	sub    %edx,%eax
+}
+  800d1e:	c3                   	ret
+
+0000000000800d1f <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d1f:	48 85 d2             	test   %rdx,%rdx
+  800d22:	74 1f                	je     800d43 <strncmp+0x24>
+  800d24:	0f b6 07             	movzbl (%rdi),%eax
+  800d27:	84 c0                	test   %al,%al
+  800d29:	74 1e                	je     800d49 <strncmp+0x2a>
+  800d2b:	3a 06                	cmp    (%rsi),%al
+  800d2d:	75 1a                	jne    800d49 <strncmp+0x2a>
+  800d2f:	48 83 c7 01          	add    $0x1,%rdi
+  800d33:	48 83 c6 01          	add    $0x1,%rsi
+  800d37:	48 83 ea 01          	sub    $0x1,%rdx
+  800d3b:	75 e7                	jne    800d24 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d42:	c3                   	ret
+  800d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d48:	c3                   	ret
+  800d49:	48 85 d2             	test   %rdx,%rdx
+  800d4c:	74 09                	je     800d57 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d4e:	0f b6 07             	movzbl (%rdi),%eax
+  800d51:	0f b6 16             	movzbl (%rsi),%edx
+  800d54:	29 d0                	sub    %edx,%eax
+  800d56:	c3                   	ret
+    if (!n) return 0;
+  800d57:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d5c:	c3                   	ret
+
+0000000000800d5d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d5d:	0f b6 17             	movzbl (%rdi),%edx
+  800d60:	84 d2                	test   %dl,%dl
+  800d62:	74 18                	je     800d7c <strchr+0x1f>
+        if (*str == c) {
+  800d64:	0f be d2             	movsbl %dl,%edx
+  800d67:	39 f2                	cmp    %esi,%edx
+  800d69:	74 17                	je     800d82 <strchr+0x25>
+    for (; *str; str++) {
+  800d6b:	48 83 c7 01          	add    $0x1,%rdi
+  800d6f:	0f b6 17             	movzbl (%rdi),%edx
+  800d72:	84 d2                	test   %dl,%dl
+  800d74:	75 ee                	jne    800d64 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d76:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d7b:	c3                   	ret
+  800d7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d81:	c3                   	ret
+  800d82:	48 89 f8             	mov    %rdi,%rax
+}
+  800d85:	c3                   	ret
+
+0000000000800d86 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d86:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d89:	0f b6 17             	movzbl (%rdi),%edx
+  800d8c:	84 d2                	test   %dl,%dl
+  800d8e:	74 13                	je     800da3 <strfind+0x1d>
+  800d90:	0f be d2             	movsbl %dl,%edx
+  800d93:	39 f2                	cmp    %esi,%edx
+  800d95:	74 0b                	je     800da2 <strfind+0x1c>
+  800d97:	48 83 c0 01          	add    $0x1,%rax
+  800d9b:	0f b6 10             	movzbl (%rax),%edx
+  800d9e:	84 d2                	test   %dl,%dl
+  800da0:	75 ee                	jne    800d90 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800da2:	c3                   	ret
+  800da3:	c3                   	ret
+
+0000000000800da4 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800da4:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800da7:	48 89 f8             	mov    %rdi,%rax
+  800daa:	48 f7 d8             	neg    %rax
+  800dad:	83 e0 07             	and    $0x7,%eax
+  800db0:	49 89 d1             	mov    %rdx,%r9
+  800db3:	49 29 c1             	sub    %rax,%r9
+  800db6:	78 36                	js     800dee <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800db8:	40 0f b6 c6          	movzbl %sil,%eax
+  800dbc:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800dc3:	01 01 01 
+  800dc6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800dca:	40 f6 c7 07          	test   $0x7,%dil
+  800dce:	75 38                	jne    800e08 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800dd0:	4c 89 c9             	mov    %r9,%rcx
+  800dd3:	48 c1 f9 03          	sar    $0x3,%rcx
+  800dd7:	74 0c                	je     800de5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800dd9:	fc                   	cld
+  800dda:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ddd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800de1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800de5:	4d 85 c9             	test   %r9,%r9
+  800de8:	75 45                	jne    800e2f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dea:	4c 89 c0             	mov    %r8,%rax
+  800ded:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dee:	48 85 d2             	test   %rdx,%rdx
+  800df1:	74 f7                	je     800dea <memset+0x46>
+  800df3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800df6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800df9:	48 83 c0 01          	add    $0x1,%rax
+  800dfd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e01:	48 39 c2             	cmp    %rax,%rdx
+  800e04:	75 f3                	jne    800df9 <memset+0x55>
+  800e06:	eb e2                	jmp    800dea <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e08:	40 f6 c7 01          	test   $0x1,%dil
+  800e0c:	74 06                	je     800e14 <memset+0x70>
+  800e0e:	88 07                	mov    %al,(%rdi)
+  800e10:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e14:	40 f6 c7 02          	test   $0x2,%dil
+  800e18:	74 07                	je     800e21 <memset+0x7d>
+  800e1a:	66 89 07             	mov    %ax,(%rdi)
+  800e1d:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e21:	40 f6 c7 04          	test   $0x4,%dil
+  800e25:	74 a9                	je     800dd0 <memset+0x2c>
+  800e27:	89 07                	mov    %eax,(%rdi)
+  800e29:	48 83 c7 04          	add    $0x4,%rdi
+  800e2d:	eb a1                	jmp    800dd0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e2f:	41 f6 c1 04          	test   $0x4,%r9b
+  800e33:	74 06                	je     800e3b <memset+0x97>
+  800e35:	89 07                	mov    %eax,(%rdi)
+  800e37:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e3b:	41 f6 c1 02          	test   $0x2,%r9b
+  800e3f:	74 07                	je     800e48 <memset+0xa4>
+  800e41:	66 89 07             	mov    %ax,(%rdi)
+  800e44:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e48:	41 f6 c1 01          	test   $0x1,%r9b
+  800e4c:	74 9c                	je     800dea <memset+0x46>
+  800e4e:	88 07                	mov    %al,(%rdi)
+  800e50:	eb 98                	jmp    800dea <memset+0x46>
+
+0000000000800e52 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e52:	48 89 f8             	mov    %rdi,%rax
+  800e55:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e58:	48 39 fe             	cmp    %rdi,%rsi
+  800e5b:	73 3b                	jae    800e98 <memmove+0x46>
+  800e5d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e61:	48 39 d7             	cmp    %rdx,%rdi
+  800e64:	73 32                	jae    800e98 <memmove+0x46>
+        s += n;
+        d += n;
+  800e66:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e6a:	48 89 d6             	mov    %rdx,%rsi
+  800e6d:	48 09 fe             	or     %rdi,%rsi
+  800e70:	48 09 ce             	or     %rcx,%rsi
+  800e73:	40 f6 c6 07          	test   $0x7,%sil
+  800e77:	75 12                	jne    800e8b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e79:	48 83 ef 08          	sub    $0x8,%rdi
+  800e7d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e81:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e85:	fd                   	std
+  800e86:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e89:	fc                   	cld
+  800e8a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e8b:	48 83 ef 01          	sub    $0x1,%rdi
+  800e8f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e93:	fd                   	std
+  800e94:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e96:	eb f1                	jmp    800e89 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e98:	48 89 f2             	mov    %rsi,%rdx
+  800e9b:	48 09 c2             	or     %rax,%rdx
+  800e9e:	48 09 ca             	or     %rcx,%rdx
+  800ea1:	f6 c2 07             	test   $0x7,%dl
+  800ea4:	75 0c                	jne    800eb2 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ea6:	48 c1 e9 03          	shr    $0x3,%rcx
+  800eaa:	48 89 c7             	mov    %rax,%rdi
+  800ead:	fc                   	cld
+  800eae:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800eb1:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800eb2:	48 89 c7             	mov    %rax,%rdi
+  800eb5:	fc                   	cld
+  800eb6:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800eb8:	c3                   	ret
+
+0000000000800eb9 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800eb9:	55                   	push   %rbp
+  800eba:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800ebd:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  800ec4:	00 00 00 
+  800ec7:	ff d0                	call   *%rax
+}
+  800ec9:	5d                   	pop    %rbp
+  800eca:	c3                   	ret
+
+0000000000800ecb <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ecb:	55                   	push   %rbp
+  800ecc:	48 89 e5             	mov    %rsp,%rbp
+  800ecf:	41 57                	push   %r15
+  800ed1:	41 56                	push   %r14
+  800ed3:	41 55                	push   %r13
+  800ed5:	41 54                	push   %r12
+  800ed7:	53                   	push   %rbx
+  800ed8:	48 83 ec 08          	sub    $0x8,%rsp
+  800edc:	49 89 fe             	mov    %rdi,%r14
+  800edf:	49 89 f7             	mov    %rsi,%r15
+  800ee2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ee5:	48 89 f7             	mov    %rsi,%rdi
+  800ee8:	48 b8 1a 0c 80 00 00 	movabs $0x800c1a,%rax
+  800eef:	00 00 00 
+  800ef2:	ff d0                	call   *%rax
+  800ef4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ef7:	48 89 de             	mov    %rbx,%rsi
+  800efa:	4c 89 f7             	mov    %r14,%rdi
+  800efd:	48 b8 35 0c 80 00 00 	movabs $0x800c35,%rax
+  800f04:	00 00 00 
+  800f07:	ff d0                	call   *%rax
+  800f09:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f0c:	48 39 c3             	cmp    %rax,%rbx
+  800f0f:	74 36                	je     800f47 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f11:	48 89 d8             	mov    %rbx,%rax
+  800f14:	4c 29 e8             	sub    %r13,%rax
+  800f17:	49 39 c4             	cmp    %rax,%r12
+  800f1a:	73 31                	jae    800f4d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f1c:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f21:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f25:	4c 89 fe             	mov    %r15,%rsi
+  800f28:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  800f2f:	00 00 00 
+  800f32:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f34:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f38:	48 83 c4 08          	add    $0x8,%rsp
+  800f3c:	5b                   	pop    %rbx
+  800f3d:	41 5c                	pop    %r12
+  800f3f:	41 5d                	pop    %r13
+  800f41:	41 5e                	pop    %r14
+  800f43:	41 5f                	pop    %r15
+  800f45:	5d                   	pop    %rbp
+  800f46:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f47:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f4b:	eb eb                	jmp    800f38 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f4d:	48 83 eb 01          	sub    $0x1,%rbx
+  800f51:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f55:	48 89 da             	mov    %rbx,%rdx
+  800f58:	4c 89 fe             	mov    %r15,%rsi
+  800f5b:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  800f62:	00 00 00 
+  800f65:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f67:	49 01 de             	add    %rbx,%r14
+  800f6a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f6f:	eb c3                	jmp    800f34 <strlcat+0x69>
+
+0000000000800f71 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f71:	48 85 d2             	test   %rdx,%rdx
+  800f74:	74 2d                	je     800fa3 <memcmp+0x32>
+  800f76:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f7b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f7f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f84:	44 38 c1             	cmp    %r8b,%cl
+  800f87:	75 0f                	jne    800f98 <memcmp+0x27>
+    while (n-- > 0) {
+  800f89:	48 83 c0 01          	add    $0x1,%rax
+  800f8d:	48 39 c2             	cmp    %rax,%rdx
+  800f90:	75 e9                	jne    800f7b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f97:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f98:	0f b6 c1             	movzbl %cl,%eax
+  800f9b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f9f:	44 29 c0             	sub    %r8d,%eax
+  800fa2:	c3                   	ret
+    return 0;
+  800fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800fa9:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800fad:	48 39 c7             	cmp    %rax,%rdi
+  800fb0:	73 0f                	jae    800fc1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800fb2:	40 38 37             	cmp    %sil,(%rdi)
+  800fb5:	74 0e                	je     800fc5 <memfind+0x1c>
+    for (; src < end; src++) {
+  800fb7:	48 83 c7 01          	add    $0x1,%rdi
+  800fbb:	48 39 f8             	cmp    %rdi,%rax
+  800fbe:	75 f2                	jne    800fb2 <memfind+0x9>
+  800fc0:	c3                   	ret
+  800fc1:	48 89 f8             	mov    %rdi,%rax
+  800fc4:	c3                   	ret
+  800fc5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fc8:	c3                   	ret
+
+0000000000800fc9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fc9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fcc:	0f b6 37             	movzbl (%rdi),%esi
+  800fcf:	40 80 fe 20          	cmp    $0x20,%sil
+  800fd3:	74 06                	je     800fdb <strtol+0x12>
+  800fd5:	40 80 fe 09          	cmp    $0x9,%sil
+  800fd9:	75 13                	jne    800fee <strtol+0x25>
+  800fdb:	48 83 c7 01          	add    $0x1,%rdi
+  800fdf:	0f b6 37             	movzbl (%rdi),%esi
+  800fe2:	40 80 fe 20          	cmp    $0x20,%sil
+  800fe6:	74 f3                	je     800fdb <strtol+0x12>
+  800fe8:	40 80 fe 09          	cmp    $0x9,%sil
+  800fec:	74 ed                	je     800fdb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fee:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ff1:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ff4:	3c 01                	cmp    $0x1,%al
+  800ff6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ffa:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801000:	75 0f                	jne    801011 <strtol+0x48>
+  801002:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801005:	74 14                	je     80101b <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801007:	85 d2                	test   %edx,%edx
+  801009:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80100e:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801016:	4c 63 ca             	movslq %edx,%r9
+  801019:	eb 36                	jmp    801051 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80101b:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80101f:	74 0f                	je     801030 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801021:	85 d2                	test   %edx,%edx
+  801023:	75 ec                	jne    801011 <strtol+0x48>
+        s++;
+  801025:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801029:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80102e:	eb e1                	jmp    801011 <strtol+0x48>
+        s += 2;
+  801030:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801034:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801039:	eb d6                	jmp    801011 <strtol+0x48>
+            dig -= '0';
+  80103b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80103e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801042:	41 39 d0             	cmp    %edx,%r8d
+  801045:	7d 21                	jge    801068 <strtol+0x9f>
+        val = val * base + dig;
+  801047:	49 0f af c1          	imul   %r9,%rax
+  80104b:	0f b6 c9             	movzbl %cl,%ecx
+  80104e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801051:	48 83 c7 01          	add    $0x1,%rdi
+  801055:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801059:	80 f9 39             	cmp    $0x39,%cl
+  80105c:	76 dd                	jbe    80103b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80105e:	80 f9 7b             	cmp    $0x7b,%cl
+  801061:	77 05                	ja     801068 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801063:	83 e9 57             	sub    $0x57,%ecx
+  801066:	eb d6                	jmp    80103e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801068:	4d 85 d2             	test   %r10,%r10
+  80106b:	74 03                	je     801070 <strtol+0xa7>
+  80106d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801070:	48 89 c2             	mov    %rax,%rdx
+  801073:	48 f7 da             	neg    %rdx
+  801076:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80107a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80107e:	c3                   	ret
+
+000000000080107f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80107f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801084:	ba 00 00 00 00       	mov    $0x0,%edx
+  801089:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80108f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801095:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80109b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80109d:	c3                   	ret
+
+000000000080109e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80109e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010a8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010c4:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010c6:	c3                   	ret
+
+00000000008010c7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010c7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010ca:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010cf:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010eb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010ed:	48 85 c0             	test   %rax,%rax
+  8010f0:	7f 01                	jg     8010f3 <sys_env_destroy+0x2c>
+}
+  8010f2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8010f3:	55                   	push   %rbp
+  8010f4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010f7:	49 89 c0             	mov    %rax,%r8
+  8010fa:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010ff:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  801106:	00 00 00 
+  801109:	be 29 00 00 00       	mov    $0x29,%esi
+  80110e:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  801115:	00 00 00 
+  801118:	b8 00 00 00 00       	mov    $0x0,%eax
+  80111d:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  801124:	00 00 00 
+  801127:	41 ff d1             	call   *%r9
+
+000000000080112a <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80112a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80112f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801134:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80114a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801150:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801152:	c3                   	ret
+
+0000000000801153 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801153:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80115d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801162:	ba 00 00 00 00       	mov    $0x0,%edx
+  801167:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80116d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801173:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801179:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80117b:	c3                   	ret
+
+000000000080117c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80117c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801181:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801188:	00 00 00 
+  80118b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801191:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801197:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80119d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80119f:	c3                   	ret
+
+00000000008011a0 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8011a0:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8011a3:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011b4:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8011b6:	c3                   	ret
+
+00000000008011b7 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8011b7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011ba:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011bf:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ce:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011d0:	48 85 c0             	test   %rax,%rax
+  8011d3:	7f 01                	jg     8011d6 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011d5:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011d6:	55                   	push   %rbp
+  8011d7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011da:	49 89 c0             	mov    %rax,%r8
+  8011dd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011e2:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8011e9:	00 00 00 
+  8011ec:	be 29 00 00 00       	mov    $0x29,%esi
+  8011f1:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  8011f8:	00 00 00 
+  8011fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801200:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  801207:	00 00 00 
+  80120a:	41 ff d1             	call   *%r9
+
+000000000080120d <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80120d:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801210:	48 63 d2             	movslq %edx,%rdx
+  801213:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801216:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80121b:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80121e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801220:	48 85 c0             	test   %rax,%rax
+  801223:	7f 01                	jg     801226 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801225:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801226:	55                   	push   %rbp
+  801227:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80122a:	49 89 c0             	mov    %rax,%r8
+  80122d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801232:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  801239:	00 00 00 
+  80123c:	be 29 00 00 00       	mov    $0x29,%esi
+  801241:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  801248:	00 00 00 
+  80124b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801250:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  801257:	00 00 00 
+  80125a:	41 ff d1             	call   *%r9
+
+000000000080125d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80125d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801260:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801265:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80126b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801271:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801277:	0f 05                	syscall
+    if (check && ret > 0) {
+  801279:	48 85 c0             	test   %rax,%rax
+  80127c:	7f 01                	jg     80127f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80127e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80127f:	55                   	push   %rbp
+  801280:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801283:	49 89 c0             	mov    %rax,%r8
+  801286:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80128b:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  801292:	00 00 00 
+  801295:	be 29 00 00 00       	mov    $0x29,%esi
+  80129a:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  8012a1:	00 00 00 
+  8012a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012a9:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  8012b0:	00 00 00 
+  8012b3:	41 ff d1             	call   *%r9
+
+00000000008012b6 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8012b6:	48 63 f6             	movslq %esi,%rsi
+  8012b9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012bc:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012d8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012da:	48 85 c0             	test   %rax,%rax
+  8012dd:	7f 01                	jg     8012e0 <sys_env_set_status+0x2a>
+}
+  8012df:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8012e0:	55                   	push   %rbp
+  8012e1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012e4:	49 89 c0             	mov    %rax,%r8
+  8012e7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012ec:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8012f3:	00 00 00 
+  8012f6:	be 29 00 00 00       	mov    $0x29,%esi
+  8012fb:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  801302:	00 00 00 
+  801305:	b8 00 00 00 00       	mov    $0x0,%eax
+  80130a:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  801311:	00 00 00 
+  801314:	41 ff d1             	call   *%r9
+
+0000000000801317 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801317:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80131a:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80131f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801324:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801330:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801336:	0f 05                	syscall
+    if (check && ret > 0) {
+  801338:	48 85 c0             	test   %rax,%rax
+  80133b:	7f 01                	jg     80133e <sys_env_set_trapframe+0x27>
+}
+  80133d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80133e:	55                   	push   %rbp
+  80133f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801342:	49 89 c0             	mov    %rax,%r8
+  801345:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80134a:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  801351:	00 00 00 
+  801354:	be 29 00 00 00       	mov    $0x29,%esi
+  801359:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  801360:	00 00 00 
+  801363:	b8 00 00 00 00       	mov    $0x0,%eax
+  801368:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  80136f:	00 00 00 
+  801372:	41 ff d1             	call   *%r9
+
+0000000000801375 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801375:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801378:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80137d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801382:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801388:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80138e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801394:	0f 05                	syscall
+    if (check && ret > 0) {
+  801396:	48 85 c0             	test   %rax,%rax
+  801399:	7f 01                	jg     80139c <sys_env_set_pgfault_upcall+0x27>
+}
+  80139b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80139c:	55                   	push   %rbp
+  80139d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a0:	49 89 c0             	mov    %rax,%r8
+  8013a3:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8013a8:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8013af:	00 00 00 
+  8013b2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013b7:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  8013be:	00 00 00 
+  8013c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c6:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  8013cd:	00 00 00 
+  8013d0:	41 ff d1             	call   *%r9
+
+00000000008013d3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013d3:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013d6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013de:	4d 63 c0             	movslq %r8d,%r8
+  8013e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e7:	0f 05                	syscall
+}
+  8013e9:	c3                   	ret
+
+00000000008013ea <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ea:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013ed:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f5:	4d 63 c0             	movslq %r8d,%r8
+  8013f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013fe:	0f 05                	syscall
+}
+  801400:	c3                   	ret
+
+0000000000801401 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801401:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801406:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801409:	45 89 c0             	mov    %r8d,%r8d
+  80140c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801412:	0f 05                	syscall
+    if (check && ret > 0) {
+  801414:	48 85 c0             	test   %rax,%rax
+  801417:	7f 01                	jg     80141a <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801419:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141e:	49 89 c0             	mov    %rax,%r8
+  801421:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801426:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  80142d:	00 00 00 
+  801430:	be 29 00 00 00       	mov    $0x29,%esi
+  801435:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  80143c:	00 00 00 
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  80144b:	00 00 00 
+  80144e:	41 ff d1             	call   *%r9
+
+0000000000801451 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801451:	55                   	push   %rbp
+  801452:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801455:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80145b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801460:	ba 00 00 00 00       	mov    $0x0,%edx
+  801465:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  80146c:	00 00 00 
+  80146f:	ff d0                	call   *%rax
+}
+  801471:	5d                   	pop    %rbp
+  801472:	c3                   	ret
+
+0000000000801473 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801473:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801478:	bf 00 00 00 00       	mov    $0x0,%edi
+  80147d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801482:	ba 00 00 00 00       	mov    $0x0,%edx
+  801487:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80148d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801493:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801499:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80149b:	c3                   	ret
+
+000000000080149c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80149c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014a1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014bf:	48 85 c0             	test   %rax,%rax
+  8014c2:	7f 01                	jg     8014c5 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8014c4:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8014c5:	55                   	push   %rbp
+  8014c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014c9:	49 89 c0             	mov    %rax,%r8
+  8014cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014d1:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8014d8:	00 00 00 
+  8014db:	be 29 00 00 00       	mov    $0x29,%esi
+  8014e0:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  8014e7:	00 00 00 
+  8014ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ef:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  8014f6:	00 00 00 
+  8014f9:	41 ff d1             	call   *%r9
+
+00000000008014fc <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014fc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801501:	bf 00 00 00 00       	mov    $0x0,%edi
+  801506:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80150b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801510:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801516:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801522:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801524:	c3                   	ret
+
+0000000000801525 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801525:	89 d2                	mov    %edx,%edx
+  801527:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801529:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80152e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801540:	0f 05                	syscall
+}
+  801542:	c3                   	ret
+
+0000000000801543 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801543:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801546:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80154b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801550:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801556:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80155c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801562:	0f 05                	syscall
+}
+  801564:	c3                   	ret
+
+0000000000801565 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801565:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801568:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801572:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801578:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80157e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801584:	0f 05                	syscall
+}
+  801586:	c3                   	ret
+
+0000000000801587 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801587:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80158a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80158f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801594:	ba 00 00 00 00       	mov    $0x0,%edx
+  801599:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ab:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015ad:	48 85 c0             	test   %rax,%rax
+  8015b0:	7f 01                	jg     8015b3 <sys_irq_ack+0x2c>
+}
+  8015b2:	c3                   	ret
+sys_irq_ack(int irq) {
+  8015b3:	55                   	push   %rbp
+  8015b4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b7:	49 89 c0             	mov    %rax,%r8
+  8015ba:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8015bf:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8015c6:	00 00 00 
+  8015c9:	be 29 00 00 00       	mov    $0x29,%esi
+  8015ce:	48 bf 97 4d 80 00 00 	movabs $0x804d97,%rdi
+  8015d5:	00 00 00 
+  8015d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dd:	49 b9 e3 01 80 00 00 	movabs $0x8001e3,%r9
+  8015e4:	00 00 00 
+  8015e7:	41 ff d1             	call   *%r9
+
+00000000008015ea <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8015ea:	55                   	push   %rbp
+  8015eb:	48 89 e5             	mov    %rsp,%rbp
+  8015ee:	41 56                	push   %r14
+  8015f0:	41 55                	push   %r13
+  8015f2:	41 54                	push   %r12
+  8015f4:	53                   	push   %rbx
+  8015f5:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015f8:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  8015ff:	00 00 00 
+  801602:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801606:	74 27                	je     80162f <_handle_vectored_pagefault+0x45>
+  801608:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80160d:	49 bd 20 00 81 00 00 	movabs $0x810020,%r13
+  801614:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801617:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80161a:	4c 89 e7             	mov    %r12,%rdi
+  80161d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801622:	84 c0                	test   %al,%al
+  801624:	75 45                	jne    80166b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801626:	48 83 c3 01          	add    $0x1,%rbx
+  80162a:	49 3b 1e             	cmp    (%r14),%rbx
+  80162d:	72 eb                	jb     80161a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80162f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  801636:	00 
+  801637:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80163c:	4d 8b 04 24          	mov    (%r12),%r8
+  801640:	48 ba a8 4d 80 00 00 	movabs $0x804da8,%rdx
+  801647:	00 00 00 
+  80164a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80164f:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  801656:	00 00 00 
+  801659:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165e:	49 ba e3 01 80 00 00 	movabs $0x8001e3,%r10
+  801665:	00 00 00 
+  801668:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80166b:	5b                   	pop    %rbx
+  80166c:	41 5c                	pop    %r12
+  80166e:	41 5d                	pop    %r13
+  801670:	41 5e                	pop    %r14
+  801672:	5d                   	pop    %rbp
+  801673:	c3                   	ret
+
+0000000000801674 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801674:	55                   	push   %rbp
+  801675:	48 89 e5             	mov    %rsp,%rbp
+  801678:	53                   	push   %rbx
+  801679:	48 83 ec 08          	sub    $0x8,%rsp
+  80167d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801680:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  801687:	00 00 00 
+  80168a:	80 38 00             	cmpb   $0x0,(%rax)
+  80168d:	0f 84 84 00 00 00    	je     801717 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801693:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  80169a:	00 00 00 
+  80169d:	48 8b 10             	mov    (%rax),%rdx
+  8016a0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016a5:	48 b9 20 00 81 00 00 	movabs $0x810020,%rcx
+  8016ac:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016af:	48 85 d2             	test   %rdx,%rdx
+  8016b2:	74 19                	je     8016cd <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8016b4:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8016b8:	0f 84 e8 00 00 00    	je     8017a6 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8016be:	48 83 c0 01          	add    $0x1,%rax
+  8016c2:	48 39 d0             	cmp    %rdx,%rax
+  8016c5:	75 ed                	jne    8016b4 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8016c7:	48 83 fa 08          	cmp    $0x8,%rdx
+  8016cb:	74 1c                	je     8016e9 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8016cd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8016d1:	48 a3 68 00 81 00 00 	movabs %rax,0x810068
+  8016d8:	00 00 00 
+  8016db:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  8016e2:	00 00 00 
+  8016e5:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8016e9:	48 b8 2a 11 80 00 00 	movabs $0x80112a,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+  8016f5:	89 c7                	mov    %eax,%edi
+  8016f7:	48 be 6c 18 80 00 00 	movabs $0x80186c,%rsi
+  8016fe:	00 00 00 
+  801701:	48 b8 75 13 80 00 00 	movabs $0x801375,%rax
+  801708:	00 00 00 
+  80170b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80170d:	85 c0                	test   %eax,%eax
+  80170f:	78 68                	js     801779 <add_pgfault_handler+0x105>
+    return res;
+}
+  801711:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801715:	c9                   	leave
+  801716:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  801717:	48 b8 2a 11 80 00 00 	movabs $0x80112a,%rax
+  80171e:	00 00 00 
+  801721:	ff d0                	call   *%rax
+  801723:	89 c7                	mov    %eax,%edi
+  801725:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80172a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80172f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  801736:	00 00 00 
+  801739:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  801740:	00 00 00 
+  801743:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  801745:	48 ba 68 00 81 00 00 	movabs $0x810068,%rdx
+  80174c:	00 00 00 
+  80174f:	48 8b 02             	mov    (%rdx),%rax
+  801752:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  801756:	48 89 0a             	mov    %rcx,(%rdx)
+  801759:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  801760:	00 00 00 
+  801763:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  801767:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  80176e:	00 00 00 
+  801771:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  801774:	e9 70 ff ff ff       	jmp    8016e9 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  801779:	89 c1                	mov    %eax,%ecx
+  80177b:	48 ba e6 4d 80 00 00 	movabs $0x804de6,%rdx
+  801782:	00 00 00 
+  801785:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80178a:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  801791:	00 00 00 
+  801794:	b8 00 00 00 00       	mov    $0x0,%eax
+  801799:	49 b8 e3 01 80 00 00 	movabs $0x8001e3,%r8
+  8017a0:	00 00 00 
+  8017a3:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8017a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017ab:	e9 61 ff ff ff       	jmp    801711 <add_pgfault_handler+0x9d>
+
+00000000008017b0 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8017b0:	55                   	push   %rbp
+  8017b1:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8017b4:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8017bb:	00 00 00 
+  8017be:	80 38 00             	cmpb   $0x0,(%rax)
+  8017c1:	74 33                	je     8017f6 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8017c3:	48 a1 68 00 81 00 00 	movabs 0x810068,%rax
+  8017ca:	00 00 00 
+  8017cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8017d2:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  8017d9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8017dc:	48 85 c0             	test   %rax,%rax
+  8017df:	0f 84 85 00 00 00    	je     80186a <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8017e5:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8017e9:	74 40                	je     80182b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8017eb:	48 83 c1 01          	add    $0x1,%rcx
+  8017ef:	48 39 c1             	cmp    %rax,%rcx
+  8017f2:	75 f1                	jne    8017e5 <remove_pgfault_handler+0x35>
+  8017f4:	eb 74                	jmp    80186a <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8017f6:	48 b9 fe 4d 80 00 00 	movabs $0x804dfe,%rcx
+  8017fd:	00 00 00 
+  801800:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801807:	00 00 00 
+  80180a:	be 43 00 00 00       	mov    $0x43,%esi
+  80180f:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  801816:	00 00 00 
+  801819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181e:	49 b8 e3 01 80 00 00 	movabs $0x8001e3,%r8
+  801825:	00 00 00 
+  801828:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80182b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801832:	00 
+  801833:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  801837:	48 29 ca             	sub    %rcx,%rdx
+  80183a:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801841:	00 00 00 
+  801844:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  801848:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80184d:	48 89 ce             	mov    %rcx,%rsi
+  801850:	48 b8 52 0e 80 00 00 	movabs $0x800e52,%rax
+  801857:	00 00 00 
+  80185a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80185c:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  801863:	00 00 00 
+  801866:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80186a:	5d                   	pop    %rbp
+  80186b:	c3                   	ret
+
+000000000080186c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80186c:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80186f:	48 b8 ea 15 80 00 00 	movabs $0x8015ea,%rax
+  801876:	00 00 00 
+    call *%rax
+  801879:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80187b:	41 5f                	pop    %r15
+	popq %r15
+  80187d:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80187f:	41 5f                	pop    %r15
+	popq %r14
+  801881:	41 5e                	pop    %r14
+	popq %r13
+  801883:	41 5d                	pop    %r13
+	popq %r12
+  801885:	41 5c                	pop    %r12
+	popq %r11
+  801887:	41 5b                	pop    %r11
+	popq %r10
+  801889:	41 5a                	pop    %r10
+	popq %r9
+  80188b:	41 59                	pop    %r9
+	popq %r8
+  80188d:	41 58                	pop    %r8
+	popq %rsi
+  80188f:	5e                   	pop    %rsi
+	popq %rdi
+  801890:	5f                   	pop    %rdi
+	popq %rbp
+  801891:	5d                   	pop    %rbp
+	popq %rdx
+  801892:	5a                   	pop    %rdx
+	popq %rcx
+  801893:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  801894:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  801899:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80189e:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8018a2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8018a5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8018aa:	5b                   	pop    %rbx
+	popq %rax
+  8018ab:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8018ac:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8018b0:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8018b1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8018b6:	c3                   	ret
+
+00000000008018b7 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018b7:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018be:	ff ff ff 
+  8018c1:	48 01 f8             	add    %rdi,%rax
+  8018c4:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018c8:	c3                   	ret
+
+00000000008018c9 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018c9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018d0:	ff ff ff 
+  8018d3:	48 01 f8             	add    %rdi,%rax
+  8018d6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018da:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018e0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018e4:	c3                   	ret
+
+00000000008018e5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	41 57                	push   %r15
+  8018eb:	41 56                	push   %r14
+  8018ed:	41 55                	push   %r13
+  8018ef:	41 54                	push   %r12
+  8018f1:	53                   	push   %rbx
+  8018f2:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f6:	49 89 ff             	mov    %rdi,%r15
+  8018f9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018fe:	49 bd 74 40 80 00 00 	movabs $0x804074,%r13
+  801905:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801908:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80190e:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801911:	48 89 df             	mov    %rbx,%rdi
+  801914:	41 ff d5             	call   *%r13
+  801917:	83 e0 04             	and    $0x4,%eax
+  80191a:	74 17                	je     801933 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80191c:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801923:	4c 39 f3             	cmp    %r14,%rbx
+  801926:	75 e6                	jne    80190e <fd_alloc+0x29>
+  801928:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80192e:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801933:	4d 89 27             	mov    %r12,(%r15)
+}
+  801936:	48 83 c4 08          	add    $0x8,%rsp
+  80193a:	5b                   	pop    %rbx
+  80193b:	41 5c                	pop    %r12
+  80193d:	41 5d                	pop    %r13
+  80193f:	41 5e                	pop    %r14
+  801941:	41 5f                	pop    %r15
+  801943:	5d                   	pop    %rbp
+  801944:	c3                   	ret
+
+0000000000801945 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801945:	83 ff 1f             	cmp    $0x1f,%edi
+  801948:	77 39                	ja     801983 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	41 54                	push   %r12
+  801950:	53                   	push   %rbx
+  801951:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801954:	48 63 df             	movslq %edi,%rbx
+  801957:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80195e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801962:	48 89 df             	mov    %rbx,%rdi
+  801965:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  80196c:	00 00 00 
+  80196f:	ff d0                	call   *%rax
+  801971:	a8 04                	test   $0x4,%al
+  801973:	74 14                	je     801989 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801975:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801979:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80197e:	5b                   	pop    %rbx
+  80197f:	41 5c                	pop    %r12
+  801981:	5d                   	pop    %rbp
+  801982:	c3                   	ret
+        return -E_INVAL;
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801988:	c3                   	ret
+        return -E_INVAL;
+  801989:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80198e:	eb ee                	jmp    80197e <fd_lookup+0x39>
+
+0000000000801990 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801990:	55                   	push   %rbp
+  801991:	48 89 e5             	mov    %rsp,%rbp
+  801994:	41 54                	push   %r12
+  801996:	53                   	push   %rbx
+  801997:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80199a:	48 b8 c0 4e 80 00 00 	movabs $0x804ec0,%rax
+  8019a1:	00 00 00 
+  8019a4:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8019ab:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019ae:	39 3b                	cmp    %edi,(%rbx)
+  8019b0:	74 47                	je     8019f9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019b2:	48 83 c0 08          	add    $0x8,%rax
+  8019b6:	48 8b 18             	mov    (%rax),%rbx
+  8019b9:	48 85 db             	test   %rbx,%rbx
+  8019bc:	75 f0                	jne    8019ae <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019be:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019c5:	00 00 00 
+  8019c8:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019ce:	89 fa                	mov    %edi,%edx
+  8019d0:	48 bf 30 4e 80 00 00 	movabs $0x804e30,%rdi
+  8019d7:	00 00 00 
+  8019da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019df:	48 b9 33 03 80 00 00 	movabs $0x800333,%rcx
+  8019e6:	00 00 00 
+  8019e9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019f0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019f4:	5b                   	pop    %rbx
+  8019f5:	41 5c                	pop    %r12
+  8019f7:	5d                   	pop    %rbp
+  8019f8:	c3                   	ret
+            return 0;
+  8019f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019fe:	eb f0                	jmp    8019f0 <dev_lookup+0x60>
+
+0000000000801a00 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a00:	55                   	push   %rbp
+  801a01:	48 89 e5             	mov    %rsp,%rbp
+  801a04:	41 55                	push   %r13
+  801a06:	41 54                	push   %r12
+  801a08:	53                   	push   %rbx
+  801a09:	48 83 ec 18          	sub    $0x18,%rsp
+  801a0d:	48 89 fb             	mov    %rdi,%rbx
+  801a10:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a13:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a1a:	ff ff ff 
+  801a1d:	48 01 df             	add    %rbx,%rdi
+  801a20:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a28:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801a2f:	00 00 00 
+  801a32:	ff d0                	call   *%rax
+  801a34:	41 89 c5             	mov    %eax,%r13d
+  801a37:	85 c0                	test   %eax,%eax
+  801a39:	78 06                	js     801a41 <fd_close+0x41>
+  801a3b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a3f:	74 1a                	je     801a5b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a41:	45 84 e4             	test   %r12b,%r12b
+  801a44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a49:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a4d:	44 89 e8             	mov    %r13d,%eax
+  801a50:	48 83 c4 18          	add    $0x18,%rsp
+  801a54:	5b                   	pop    %rbx
+  801a55:	41 5c                	pop    %r12
+  801a57:	41 5d                	pop    %r13
+  801a59:	5d                   	pop    %rbp
+  801a5a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a5b:	8b 3b                	mov    (%rbx),%edi
+  801a5d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a61:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801a68:	00 00 00 
+  801a6b:	ff d0                	call   *%rax
+  801a6d:	41 89 c5             	mov    %eax,%r13d
+  801a70:	85 c0                	test   %eax,%eax
+  801a72:	78 1b                	js     801a8f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a78:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a7c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a82:	48 85 c0             	test   %rax,%rax
+  801a85:	74 08                	je     801a8f <fd_close+0x8f>
+  801a87:	48 89 df             	mov    %rbx,%rdi
+  801a8a:	ff d0                	call   *%rax
+  801a8c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a94:	48 89 de             	mov    %rbx,%rsi
+  801a97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a9c:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  801aa3:	00 00 00 
+  801aa6:	ff d0                	call   *%rax
+    return res;
+  801aa8:	eb a3                	jmp    801a4d <fd_close+0x4d>
+
+0000000000801aaa <close>:
+
+int
+close(int fdnum) {
+  801aaa:	55                   	push   %rbp
+  801aab:	48 89 e5             	mov    %rsp,%rbp
+  801aae:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801ab2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ab6:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801ac2:	85 c0                	test   %eax,%eax
+  801ac4:	78 15                	js     801adb <close+0x31>
+
+    return fd_close(fd, 1);
+  801ac6:	be 01 00 00 00       	mov    $0x1,%esi
+  801acb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801acf:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801ad6:	00 00 00 
+  801ad9:	ff d0                	call   *%rax
+}
+  801adb:	c9                   	leave
+  801adc:	c3                   	ret
+
+0000000000801add <close_all>:
+
+void
+close_all(void) {
+  801add:	55                   	push   %rbp
+  801ade:	48 89 e5             	mov    %rsp,%rbp
+  801ae1:	41 54                	push   %r12
+  801ae3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ae4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae9:	49 bc aa 1a 80 00 00 	movabs $0x801aaa,%r12
+  801af0:	00 00 00 
+  801af3:	89 df                	mov    %ebx,%edi
+  801af5:	41 ff d4             	call   *%r12
+  801af8:	83 c3 01             	add    $0x1,%ebx
+  801afb:	83 fb 20             	cmp    $0x20,%ebx
+  801afe:	75 f3                	jne    801af3 <close_all+0x16>
+}
+  801b00:	5b                   	pop    %rbx
+  801b01:	41 5c                	pop    %r12
+  801b03:	5d                   	pop    %rbp
+  801b04:	c3                   	ret
+
+0000000000801b05 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b05:	55                   	push   %rbp
+  801b06:	48 89 e5             	mov    %rsp,%rbp
+  801b09:	41 57                	push   %r15
+  801b0b:	41 56                	push   %r14
+  801b0d:	41 55                	push   %r13
+  801b0f:	41 54                	push   %r12
+  801b11:	53                   	push   %rbx
+  801b12:	48 83 ec 18          	sub    $0x18,%rsp
+  801b16:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b19:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b1d:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801b24:	00 00 00 
+  801b27:	ff d0                	call   *%rax
+  801b29:	89 c3                	mov    %eax,%ebx
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	0f 88 b8 00 00 00    	js     801beb <dup+0xe6>
+    close(newfdnum);
+  801b33:	44 89 e7             	mov    %r12d,%edi
+  801b36:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801b3d:	00 00 00 
+  801b40:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b42:	4d 63 ec             	movslq %r12d,%r13
+  801b45:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b4c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b50:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b54:	4c 89 ff             	mov    %r15,%rdi
+  801b57:	49 be c9 18 80 00 00 	movabs $0x8018c9,%r14
+  801b5e:	00 00 00 
+  801b61:	41 ff d6             	call   *%r14
+  801b64:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b67:	4c 89 ef             	mov    %r13,%rdi
+  801b6a:	41 ff d6             	call   *%r14
+  801b6d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b70:	48 89 df             	mov    %rbx,%rdi
+  801b73:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b7f:	a8 04                	test   $0x4,%al
+  801b81:	74 2b                	je     801bae <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b83:	41 89 c1             	mov    %eax,%r9d
+  801b86:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b8c:	4c 89 f1             	mov    %r14,%rcx
+  801b8f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b94:	48 89 de             	mov    %rbx,%rsi
+  801b97:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b9c:	48 b8 0d 12 80 00 00 	movabs $0x80120d,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	89 c3                	mov    %eax,%ebx
+  801baa:	85 c0                	test   %eax,%eax
+  801bac:	78 4e                	js     801bfc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bae:	4c 89 ff             	mov    %r15,%rdi
+  801bb1:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  801bb8:	00 00 00 
+  801bbb:	ff d0                	call   *%rax
+  801bbd:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bc0:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bc6:	4c 89 e9             	mov    %r13,%rcx
+  801bc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bce:	4c 89 fe             	mov    %r15,%rsi
+  801bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd6:	48 b8 0d 12 80 00 00 	movabs $0x80120d,%rax
+  801bdd:	00 00 00 
+  801be0:	ff d0                	call   *%rax
+  801be2:	89 c3                	mov    %eax,%ebx
+  801be4:	85 c0                	test   %eax,%eax
+  801be6:	78 14                	js     801bfc <dup+0xf7>
+
+    return newfdnum;
+  801be8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801beb:	89 d8                	mov    %ebx,%eax
+  801bed:	48 83 c4 18          	add    $0x18,%rsp
+  801bf1:	5b                   	pop    %rbx
+  801bf2:	41 5c                	pop    %r12
+  801bf4:	41 5d                	pop    %r13
+  801bf6:	41 5e                	pop    %r14
+  801bf8:	41 5f                	pop    %r15
+  801bfa:	5d                   	pop    %rbp
+  801bfb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bfc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c01:	4c 89 ee             	mov    %r13,%rsi
+  801c04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c09:	49 bc 5d 12 80 00 00 	movabs $0x80125d,%r12
+  801c10:	00 00 00 
+  801c13:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c1b:	4c 89 f6             	mov    %r14,%rsi
+  801c1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c23:	41 ff d4             	call   *%r12
+    return res;
+  801c26:	eb c3                	jmp    801beb <dup+0xe6>
+
+0000000000801c28 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c28:	55                   	push   %rbp
+  801c29:	48 89 e5             	mov    %rsp,%rbp
+  801c2c:	41 56                	push   %r14
+  801c2e:	41 55                	push   %r13
+  801c30:	41 54                	push   %r12
+  801c32:	53                   	push   %rbx
+  801c33:	48 83 ec 10          	sub    $0x10,%rsp
+  801c37:	89 fb                	mov    %edi,%ebx
+  801c39:	49 89 f4             	mov    %rsi,%r12
+  801c3c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c3f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c43:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801c4a:	00 00 00 
+  801c4d:	ff d0                	call   *%rax
+  801c4f:	85 c0                	test   %eax,%eax
+  801c51:	78 4c                	js     801c9f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c53:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c57:	41 8b 3e             	mov    (%r14),%edi
+  801c5a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c5e:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801c65:	00 00 00 
+  801c68:	ff d0                	call   *%rax
+  801c6a:	85 c0                	test   %eax,%eax
+  801c6c:	78 35                	js     801ca3 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c6e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c72:	83 e0 03             	and    $0x3,%eax
+  801c75:	83 f8 01             	cmp    $0x1,%eax
+  801c78:	74 2d                	je     801ca7 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c7e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c82:	48 85 c0             	test   %rax,%rax
+  801c85:	74 56                	je     801cdd <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c87:	4c 89 ea             	mov    %r13,%rdx
+  801c8a:	4c 89 e6             	mov    %r12,%rsi
+  801c8d:	4c 89 f7             	mov    %r14,%rdi
+  801c90:	ff d0                	call   *%rax
+}
+  801c92:	48 83 c4 10          	add    $0x10,%rsp
+  801c96:	5b                   	pop    %rbx
+  801c97:	41 5c                	pop    %r12
+  801c99:	41 5d                	pop    %r13
+  801c9b:	41 5e                	pop    %r14
+  801c9d:	5d                   	pop    %rbp
+  801c9e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9f:	48 98                	cltq
+  801ca1:	eb ef                	jmp    801c92 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ca3:	48 98                	cltq
+  801ca5:	eb eb                	jmp    801c92 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ca7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cae:	00 00 00 
+  801cb1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cb7:	89 da                	mov    %ebx,%edx
+  801cb9:	48 bf 71 4e 80 00 00 	movabs $0x804e71,%rdi
+  801cc0:	00 00 00 
+  801cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc8:	48 b9 33 03 80 00 00 	movabs $0x800333,%rcx
+  801ccf:	00 00 00 
+  801cd2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cd4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cdb:	eb b5                	jmp    801c92 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cdd:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ce4:	eb ac                	jmp    801c92 <read+0x6a>
+
+0000000000801ce6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ce6:	55                   	push   %rbp
+  801ce7:	48 89 e5             	mov    %rsp,%rbp
+  801cea:	41 57                	push   %r15
+  801cec:	41 56                	push   %r14
+  801cee:	41 55                	push   %r13
+  801cf0:	41 54                	push   %r12
+  801cf2:	53                   	push   %rbx
+  801cf3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cf7:	48 85 d2             	test   %rdx,%rdx
+  801cfa:	74 54                	je     801d50 <readn+0x6a>
+  801cfc:	41 89 fd             	mov    %edi,%r13d
+  801cff:	49 89 f6             	mov    %rsi,%r14
+  801d02:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d05:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d0a:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d0f:	49 bf 28 1c 80 00 00 	movabs $0x801c28,%r15
+  801d16:	00 00 00 
+  801d19:	4c 89 e2             	mov    %r12,%rdx
+  801d1c:	48 29 f2             	sub    %rsi,%rdx
+  801d1f:	4c 01 f6             	add    %r14,%rsi
+  801d22:	44 89 ef             	mov    %r13d,%edi
+  801d25:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	78 20                	js     801d4c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d2c:	01 c3                	add    %eax,%ebx
+  801d2e:	85 c0                	test   %eax,%eax
+  801d30:	74 08                	je     801d3a <readn+0x54>
+  801d32:	48 63 f3             	movslq %ebx,%rsi
+  801d35:	4c 39 e6             	cmp    %r12,%rsi
+  801d38:	72 df                	jb     801d19 <readn+0x33>
+    }
+    return res;
+  801d3a:	48 63 c3             	movslq %ebx,%rax
+}
+  801d3d:	48 83 c4 08          	add    $0x8,%rsp
+  801d41:	5b                   	pop    %rbx
+  801d42:	41 5c                	pop    %r12
+  801d44:	41 5d                	pop    %r13
+  801d46:	41 5e                	pop    %r14
+  801d48:	41 5f                	pop    %r15
+  801d4a:	5d                   	pop    %rbp
+  801d4b:	c3                   	ret
+        if (inc < 0) return inc;
+  801d4c:	48 98                	cltq
+  801d4e:	eb ed                	jmp    801d3d <readn+0x57>
+    int inc = 1, res = 0;
+  801d50:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d55:	eb e3                	jmp    801d3a <readn+0x54>
+
+0000000000801d57 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d57:	55                   	push   %rbp
+  801d58:	48 89 e5             	mov    %rsp,%rbp
+  801d5b:	41 56                	push   %r14
+  801d5d:	41 55                	push   %r13
+  801d5f:	41 54                	push   %r12
+  801d61:	53                   	push   %rbx
+  801d62:	48 83 ec 10          	sub    $0x10,%rsp
+  801d66:	89 fb                	mov    %edi,%ebx
+  801d68:	49 89 f4             	mov    %rsi,%r12
+  801d6b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d72:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801d79:	00 00 00 
+  801d7c:	ff d0                	call   *%rax
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 47                	js     801dc9 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d82:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d86:	41 8b 3e             	mov    (%r14),%edi
+  801d89:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d8d:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801d94:	00 00 00 
+  801d97:	ff d0                	call   *%rax
+  801d99:	85 c0                	test   %eax,%eax
+  801d9b:	78 30                	js     801dcd <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801da2:	74 2d                	je     801dd1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801da4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dac:	48 85 c0             	test   %rax,%rax
+  801daf:	74 56                	je     801e07 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801db1:	4c 89 ea             	mov    %r13,%rdx
+  801db4:	4c 89 e6             	mov    %r12,%rsi
+  801db7:	4c 89 f7             	mov    %r14,%rdi
+  801dba:	ff d0                	call   *%rax
+}
+  801dbc:	48 83 c4 10          	add    $0x10,%rsp
+  801dc0:	5b                   	pop    %rbx
+  801dc1:	41 5c                	pop    %r12
+  801dc3:	41 5d                	pop    %r13
+  801dc5:	41 5e                	pop    %r14
+  801dc7:	5d                   	pop    %rbp
+  801dc8:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc9:	48 98                	cltq
+  801dcb:	eb ef                	jmp    801dbc <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dcd:	48 98                	cltq
+  801dcf:	eb eb                	jmp    801dbc <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dd1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801dd8:	00 00 00 
+  801ddb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801de1:	89 da                	mov    %ebx,%edx
+  801de3:	48 bf 8d 4e 80 00 00 	movabs $0x804e8d,%rdi
+  801dea:	00 00 00 
+  801ded:	b8 00 00 00 00       	mov    $0x0,%eax
+  801df2:	48 b9 33 03 80 00 00 	movabs $0x800333,%rcx
+  801df9:	00 00 00 
+  801dfc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801dfe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e05:	eb b5                	jmp    801dbc <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e07:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e0e:	eb ac                	jmp    801dbc <write+0x65>
+
+0000000000801e10 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e10:	55                   	push   %rbp
+  801e11:	48 89 e5             	mov    %rsp,%rbp
+  801e14:	41 54                	push   %r12
+  801e16:	53                   	push   %rbx
+  801e17:	48 83 ec 10          	sub    $0x10,%rsp
+  801e1b:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e1d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e21:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801e28:	00 00 00 
+  801e2b:	ff d0                	call   *%rax
+  801e2d:	85 c0                	test   %eax,%eax
+  801e2f:	78 3e                	js     801e6f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e31:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e35:	41 8b 3c 24          	mov    (%r12),%edi
+  801e39:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e3d:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801e44:	00 00 00 
+  801e47:	ff d0                	call   *%rax
+  801e49:	85 c0                	test   %eax,%eax
+  801e4b:	78 22                	js     801e6f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e51:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e55:	48 85 c0             	test   %rax,%rax
+  801e58:	74 0b                	je     801e65 <seek+0x55>
+  801e5a:	89 de                	mov    %ebx,%esi
+  801e5c:	4c 89 e7             	mov    %r12,%rdi
+  801e5f:	ff d0                	call   *%rax
+  801e61:	85 c0                	test   %eax,%eax
+  801e63:	78 0a                	js     801e6f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e65:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e6a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e6f:	48 83 c4 10          	add    $0x10,%rsp
+  801e73:	5b                   	pop    %rbx
+  801e74:	41 5c                	pop    %r12
+  801e76:	5d                   	pop    %rbp
+  801e77:	c3                   	ret
+
+0000000000801e78 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e78:	55                   	push   %rbp
+  801e79:	48 89 e5             	mov    %rsp,%rbp
+  801e7c:	41 55                	push   %r13
+  801e7e:	41 54                	push   %r12
+  801e80:	53                   	push   %rbx
+  801e81:	48 83 ec 18          	sub    $0x18,%rsp
+  801e85:	89 fb                	mov    %edi,%ebx
+  801e87:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e8e:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801e95:	00 00 00 
+  801e98:	ff d0                	call   *%rax
+  801e9a:	85 c0                	test   %eax,%eax
+  801e9c:	78 38                	js     801ed6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e9e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ea2:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ea6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801eaa:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801eb1:	00 00 00 
+  801eb4:	ff d0                	call   *%rax
+  801eb6:	85 c0                	test   %eax,%eax
+  801eb8:	78 1c                	js     801ed6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eba:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ebf:	74 20                	je     801ee1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ec1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ec5:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ec9:	48 85 c0             	test   %rax,%rax
+  801ecc:	74 47                	je     801f15 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ece:	44 89 e6             	mov    %r12d,%esi
+  801ed1:	4c 89 ef             	mov    %r13,%rdi
+  801ed4:	ff d0                	call   *%rax
+}
+  801ed6:	48 83 c4 18          	add    $0x18,%rsp
+  801eda:	5b                   	pop    %rbx
+  801edb:	41 5c                	pop    %r12
+  801edd:	41 5d                	pop    %r13
+  801edf:	5d                   	pop    %rbp
+  801ee0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ee1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ee8:	00 00 00 
+  801eeb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ef1:	89 da                	mov    %ebx,%edx
+  801ef3:	48 bf 50 4e 80 00 00 	movabs $0x804e50,%rdi
+  801efa:	00 00 00 
+  801efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f02:	48 b9 33 03 80 00 00 	movabs $0x800333,%rcx
+  801f09:	00 00 00 
+  801f0c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f13:	eb c1                	jmp    801ed6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f15:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f1a:	eb ba                	jmp    801ed6 <ftruncate+0x5e>
+
+0000000000801f1c <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f1c:	55                   	push   %rbp
+  801f1d:	48 89 e5             	mov    %rsp,%rbp
+  801f20:	41 54                	push   %r12
+  801f22:	53                   	push   %rbx
+  801f23:	48 83 ec 10          	sub    $0x10,%rsp
+  801f27:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f2a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f2e:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+  801f3a:	85 c0                	test   %eax,%eax
+  801f3c:	78 4e                	js     801f8c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f3e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f42:	41 8b 3c 24          	mov    (%r12),%edi
+  801f46:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f4a:	48 b8 90 19 80 00 00 	movabs $0x801990,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  801f56:	85 c0                	test   %eax,%eax
+  801f58:	78 32                	js     801f8c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f5a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f5e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f63:	74 30                	je     801f95 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f65:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f68:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f6f:	00 00 00 
+    stat->st_isdir = 0;
+  801f72:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f79:	00 00 00 
+    stat->st_dev = dev;
+  801f7c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f83:	48 89 de             	mov    %rbx,%rsi
+  801f86:	4c 89 e7             	mov    %r12,%rdi
+  801f89:	ff 50 28             	call   *0x28(%rax)
+}
+  801f8c:	48 83 c4 10          	add    $0x10,%rsp
+  801f90:	5b                   	pop    %rbx
+  801f91:	41 5c                	pop    %r12
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f95:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f9a:	eb f0                	jmp    801f8c <fstat+0x70>
+
+0000000000801f9c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f9c:	55                   	push   %rbp
+  801f9d:	48 89 e5             	mov    %rsp,%rbp
+  801fa0:	41 54                	push   %r12
+  801fa2:	53                   	push   %rbx
+  801fa3:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fa6:	be 00 00 00 00       	mov    $0x0,%esi
+  801fab:	48 b8 0a 31 80 00 00 	movabs $0x80310a,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fb9:	85 c0                	test   %eax,%eax
+  801fbb:	78 25                	js     801fe2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fbd:	4c 89 e6             	mov    %r12,%rsi
+  801fc0:	89 c7                	mov    %eax,%edi
+  801fc2:	48 b8 1c 1f 80 00 00 	movabs $0x801f1c,%rax
+  801fc9:	00 00 00 
+  801fcc:	ff d0                	call   *%rax
+  801fce:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fd1:	89 df                	mov    %ebx,%edi
+  801fd3:	48 b8 aa 1a 80 00 00 	movabs $0x801aaa,%rax
+  801fda:	00 00 00 
+  801fdd:	ff d0                	call   *%rax
+
+    return res;
+  801fdf:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fe2:	89 d8                	mov    %ebx,%eax
+  801fe4:	5b                   	pop    %rbx
+  801fe5:	41 5c                	pop    %r12
+  801fe7:	5d                   	pop    %rbp
+  801fe8:	c3                   	ret
+
+0000000000801fe9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fe9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801ff0:	00 00 00 
+  801ff3:	83 38 00             	cmpl   $0x0,(%rax)
+  801ff6:	74 0a                	je     802002 <fsenv+0x19>
+    return envid;
+}
+  801ff8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fff:	00 00 
+  802001:	c3                   	ret
+fsenv(void) {
+  802002:	55                   	push   %rbp
+  802003:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802006:	bf 03 00 00 00       	mov    $0x3,%edi
+  80200b:	48 b8 0a 47 80 00 00 	movabs $0x80470a,%rax
+  802012:	00 00 00 
+  802015:	ff d0                	call   *%rax
+  802017:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  80201e:	00 00 
+}
+  802020:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802027:	00 00 
+  802029:	5d                   	pop    %rbp
+  80202a:	c3                   	ret
+
+000000000080202b <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  80202b:	55                   	push   %rbp
+  80202c:	48 89 e5             	mov    %rsp,%rbp
+  80202f:	41 54                	push   %r12
+  802031:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802032:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802037:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80203c:	48 89 de             	mov    %rbx,%rsi
+  80203f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802044:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  80204b:	00 00 00 
+  80204e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802050:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802057:	00 00 00 
+  80205a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802060:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802065:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80206a:	48 89 de             	mov    %rbx,%rsi
+  80206d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802072:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+  80207e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802080:	85 c0                	test   %eax,%eax
+  802082:	0f 88 a2 00 00 00    	js     80212a <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802088:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80208f:	00 00 00 
+  802092:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802098:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80209d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80209f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8020a4:	49 bc 3c 42 80 00 00 	movabs $0x80423c,%r12
+  8020ab:	00 00 00 
+  8020ae:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020b1:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020b6:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020b9:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	89 c7                	mov    %eax,%edi
+  8020c7:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8020cd:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8020d2:	48 89 da             	mov    %rbx,%rdx
+  8020d5:	be 09 00 00 00       	mov    $0x9,%esi
+  8020da:	48 b8 b4 46 80 00 00 	movabs $0x8046b4,%rax
+  8020e1:	00 00 00 
+  8020e4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8020e6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f0:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020fa:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	89 c3                	mov    %eax,%ebx
+  802108:	85 c0                	test   %eax,%eax
+  80210a:	78 25                	js     802131 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  80210c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802113:	00 00 00 
+  802116:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80211c:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802123:	00 00 
+    return 0;
+  802125:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80212a:	89 d8                	mov    %ebx,%eax
+  80212c:	5b                   	pop    %rbx
+  80212d:	41 5c                	pop    %r12
+  80212f:	5d                   	pop    %rbp
+  802130:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802131:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802136:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  80213b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802140:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  802147:	00 00 00 
+  80214a:	ff d0                	call   *%rax
+        return res;
+  80214c:	eb dc                	jmp    80212a <fschan_setup+0xff>
+
+000000000080214e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80214e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802155:	00 00 00 
+  802158:	80 38 00             	cmpb   $0x0,(%rax)
+  80215b:	74 55                	je     8021b2 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80215d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802164:	00 00 00 
+  802167:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80216d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802172:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802179:	00 00 00 
+  80217c:	3b 0a                	cmp    (%rdx),%ecx
+  80217e:	75 01                	jne    802181 <fschan+0x33>
+}
+  802180:	c3                   	ret
+fschan(void) {
+  802181:	55                   	push   %rbp
+  802182:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802185:	48 b8 2b 20 80 00 00 	movabs $0x80202b,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802193:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802198:	85 d2                	test   %edx,%edx
+  80219a:	78 02                	js     80219e <fschan+0x50>
+}
+  80219c:	5d                   	pop    %rbp
+  80219d:	c3                   	ret
+        fschan_enabled = 0;
+  80219e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021a5:	00 00 00 
+  8021a8:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b0:	eb ea                	jmp    80219c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b7:	c3                   	ret
+
+00000000008021b8 <fbuf>:
+fbuf(struct Fd *fd) {
+  8021b8:	55                   	push   %rbp
+  8021b9:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021bc:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  8021c3:	00 00 00 
+  8021c6:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8021c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021cd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8021d1:	77 12                	ja     8021e5 <fbuf+0x2d>
+  8021d3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8021d7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8021de:	00 00 00 
+  8021e1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8021e5:	48 89 d0             	mov    %rdx,%rax
+  8021e8:	5d                   	pop    %rbp
+  8021e9:	c3                   	ret
+
+00000000008021ea <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8021ea:	55                   	push   %rbp
+  8021eb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8021ee:	48 83 c7 40          	add    $0x40,%rdi
+  8021f2:	48 b8 76 42 80 00 00 	movabs $0x804276,%rax
+  8021f9:	00 00 00 
+  8021fc:	ff d0                	call   *%rax
+  8021fe:	84 c0                	test   %al,%al
+  802200:	75 02                	jne    802204 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802202:	5d                   	pop    %rbp
+  802203:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802204:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  80220b:	00 00 00 
+  80220e:	ff d0                	call   *%rax
+  802210:	89 c7                	mov    %eax,%edi
+  802212:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802218:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80221d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802222:	be 0a 00 00 00       	mov    $0xa,%esi
+  802227:	48 b8 b4 46 80 00 00 	movabs $0x8046b4,%rax
+  80222e:	00 00 00 
+  802231:	ff d0                	call   *%rax
+}
+  802233:	eb cd                	jmp    802202 <fschan_publish+0x18>
+
+0000000000802235 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802235:	55                   	push   %rbp
+  802236:	48 89 e5             	mov    %rsp,%rbp
+  802239:	41 57                	push   %r15
+  80223b:	41 56                	push   %r14
+  80223d:	41 55                	push   %r13
+  80223f:	41 54                	push   %r12
+  802241:	53                   	push   %rbx
+  802242:	48 83 ec 48          	sub    $0x48,%rsp
+  802246:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80224a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80224e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802251:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802255:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802258:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80225f:	00 00 00 
+  802262:	8b 02                	mov    (%rdx),%eax
+  802264:	83 c0 01             	add    $0x1,%eax
+  802267:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80226c:	0f 44 c1             	cmove  %ecx,%eax
+  80226f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802271:	4d 85 c0             	test   %r8,%r8
+  802274:	74 2c                	je     8022a2 <fschan_rw+0x6d>
+  802276:	45 89 ce             	mov    %r9d,%r14d
+  802279:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802280:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802284:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80228a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802291:	00 
+  802292:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802298:	b8 01 00 00 00       	mov    $0x1,%eax
+  80229d:	e9 41 01 00 00       	jmp    8023e3 <fschan_rw+0x1ae>
+  8022a2:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022a6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022aa:	e9 9c 01 00 00       	jmp    80244b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022af:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022b3:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022b6:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022b9:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022bc:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022c0:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022c4:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8022c8:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8022cc:	48 89 da             	mov    %rbx,%rdx
+  8022cf:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8022db:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8022df:	48 b8 ea 21 80 00 00 	movabs $0x8021ea,%rax
+  8022e6:	00 00 00 
+  8022e9:	ff d0                	call   *%rax
+            queued += blk;
+  8022eb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8022ee:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022f2:	4d 39 fc             	cmp    %r15,%r12
+  8022f5:	73 6b                	jae    802362 <fschan_rw+0x12d>
+  8022f7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022fb:	77 65                	ja     802362 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8022fd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802301:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802305:	48 b8 51 42 80 00 00 	movabs $0x804251,%rax
+  80230c:	00 00 00 
+  80230f:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802311:	4c 89 fb             	mov    %r15,%rbx
+  802314:	4c 29 e3             	sub    %r12,%rbx
+  802317:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80231c:	48 39 d3             	cmp    %rdx,%rbx
+  80231f:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802323:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802327:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80232b:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80232f:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802332:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802334:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80233b:	00 00 00 
+  80233e:	8b 09                	mov    (%rcx),%ecx
+  802340:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802343:	83 fe 03             	cmp    $0x3,%esi
+  802346:	0f 85 63 ff ff ff    	jne    8022af <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80234c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802350:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802353:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802356:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802359:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80235d:	e9 79 ff ff ff       	jmp    8022db <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802362:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802366:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80236d:	48 89 df             	mov    %rbx,%rdi
+  802370:	48 b8 14 43 80 00 00 	movabs $0x804314,%rax
+  802377:	00 00 00 
+  80237a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80237c:	48 89 df             	mov    %rbx,%rdi
+  80237f:	48 b8 a2 42 80 00 00 	movabs $0x8042a2,%rax
+  802386:	00 00 00 
+  802389:	ff d0                	call   *%rax
+  80238b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80238f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802393:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802397:	75 25                	jne    8023be <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802399:	8b 40 04             	mov    0x4(%rax),%eax
+  80239c:	85 c0                	test   %eax,%eax
+  80239e:	0f 88 86 00 00 00    	js     80242a <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023a4:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023a8:	74 5b                	je     802405 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023aa:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023ae:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023b2:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023b6:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023ba:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023be:	48 89 df             	mov    %rbx,%rdi
+  8023c1:	48 b8 c9 42 80 00 00 	movabs $0x8042c9,%rax
+  8023c8:	00 00 00 
+  8023cb:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8023cd:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8023d1:	83 f0 01             	xor    $0x1,%eax
+  8023d4:	4d 39 fc             	cmp    %r15,%r12
+  8023d7:	0f 92 c2             	setb   %dl
+  8023da:	84 c2                	test   %al,%dl
+  8023dc:	75 05                	jne    8023e3 <fschan_rw+0x1ae>
+  8023de:	45 85 ed             	test   %r13d,%r13d
+  8023e1:	74 50                	je     802433 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8023e3:	4d 39 fc             	cmp    %r15,%r12
+  8023e6:	0f 92 c1             	setb   %cl
+  8023e9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8023ed:	0f 96 c2             	setbe  %dl
+  8023f0:	84 d1                	test   %dl,%cl
+  8023f2:	0f 84 6a ff ff ff    	je     802362 <fschan_rw+0x12d>
+  8023f8:	84 c0                	test   %al,%al
+  8023fa:	0f 85 fd fe ff ff    	jne    8022fd <fschan_rw+0xc8>
+  802400:	e9 5d ff ff ff       	jmp    802362 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802405:	48 63 d0             	movslq %eax,%rdx
+  802408:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80240c:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802410:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802414:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802418:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80241c:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  802423:	00 00 00 
+  802426:	ff d0                	call   *%rax
+  802428:	eb 80                	jmp    8023aa <fschan_rw+0x175>
+                err = msg->fm_res;
+  80242a:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80242d:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802431:	eb 8b                	jmp    8023be <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802433:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802438:	0f 85 68 fe ff ff    	jne    8022a6 <fschan_rw+0x71>
+  80243e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802441:	85 c0                	test   %eax,%eax
+  802443:	0f 84 5d fe ff ff    	je     8022a6 <fschan_rw+0x71>
+  802449:	48 98                	cltq
+}
+  80244b:	48 83 c4 48          	add    $0x48,%rsp
+  80244f:	5b                   	pop    %rbx
+  802450:	41 5c                	pop    %r12
+  802452:	41 5d                	pop    %r13
+  802454:	41 5e                	pop    %r14
+  802456:	41 5f                	pop    %r15
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+
+000000000080245a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80245a:	55                   	push   %rbp
+  80245b:	48 89 e5             	mov    %rsp,%rbp
+  80245e:	41 56                	push   %r14
+  802460:	41 55                	push   %r13
+  802462:	41 54                	push   %r12
+  802464:	53                   	push   %rbx
+  802465:	48 83 ec 10          	sub    $0x10,%rsp
+  802469:	49 89 fe             	mov    %rdi,%r14
+  80246c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80246f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802473:	48 29 f3             	sub    %rsi,%rbx
+  802476:	48 39 d3             	cmp    %rdx,%rbx
+  802479:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80247d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802484:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802485:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80248a:	49 bd d3 40 80 00 00 	movabs $0x8040d3,%r13
+  802491:	00 00 00 
+  802494:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80249b:	76 1e                	jbe    8024bb <mmap_fault+0x61>
+  80249d:	4c 01 e7             	add    %r12,%rdi
+  8024a0:	41 ff d5             	call   *%r13
+  8024a3:	84 c0                	test   %al,%al
+  8024a5:	75 14                	jne    8024bb <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024a7:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024ab:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024b2:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024b6:	48 39 df             	cmp    %rbx,%rdi
+  8024b9:	72 e2                	jb     80249d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024bb:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024c2:	00 00 00 
+  8024c5:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8024cc:	00 00 00 
+  8024cf:	4c 89 f0             	mov    %r14,%rax
+  8024d2:	48 29 d0             	sub    %rdx,%rax
+  8024d5:	48 c1 f8 03          	sar    $0x3,%rax
+  8024d9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8024e0:	aa aa aa 
+  8024e3:	48 0f af c2          	imul   %rdx,%rax
+  8024e7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024eb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8024f0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8024f4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8024f6:	44 89 e0             	mov    %r12d,%eax
+  8024f9:	41 03 46 10          	add    0x10(%r14),%eax
+  8024fd:	41 2b 06             	sub    (%r14),%eax
+  802500:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802503:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802507:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80250b:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80250f:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802512:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802519:	00 00 00 
+  80251c:	ff d0                	call   *%rax
+  80251e:	89 c7                	mov    %eax,%edi
+  802520:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802526:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80252b:	48 89 da             	mov    %rbx,%rdx
+  80252e:	be 0f 00 00 00       	mov    $0xf,%esi
+  802533:	48 b8 b4 46 80 00 00 	movabs $0x8046b4,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80253f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802544:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802548:	4c 89 e6             	mov    %r12,%rsi
+  80254b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802550:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  802557:	00 00 00 
+  80255a:	ff d0                	call   *%rax
+  80255c:	48 98                	cltq
+}
+  80255e:	48 83 c4 10          	add    $0x10,%rsp
+  802562:	5b                   	pop    %rbx
+  802563:	41 5c                	pop    %r12
+  802565:	41 5d                	pop    %r13
+  802567:	41 5e                	pop    %r14
+  802569:	5d                   	pop    %rbp
+  80256a:	c3                   	ret
+
+000000000080256b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80256b:	48 8b 37             	mov    (%rdi),%rsi
+  80256e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802575:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80257c:	00 00 00 
+  80257f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802584:	eb 0f                	jmp    802595 <mmap_pgfault+0x2a>
+  802586:	c3                   	ret
+  802587:	48 83 c1 01          	add    $0x1,%rcx
+  80258b:	48 83 c2 18          	add    $0x18,%rdx
+  80258f:	48 83 f9 20          	cmp    $0x20,%rcx
+  802593:	74 6e                	je     802603 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802595:	48 8b 02             	mov    (%rdx),%rax
+  802598:	48 83 e8 01          	sub    $0x1,%rax
+  80259c:	48 39 f0             	cmp    %rsi,%rax
+  80259f:	73 e6                	jae    802587 <mmap_pgfault+0x1c>
+  8025a1:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8025a5:	73 e0                	jae    802587 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025a7:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b0:	f6 c2 01             	test   $0x1,%dl
+  8025b3:	75 d1                	jne    802586 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025b5:	f6 c2 02             	test   $0x2,%dl
+  8025b8:	74 1a                	je     8025d4 <mmap_pgfault+0x69>
+  8025ba:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025c3:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8025ca:	00 00 00 
+  8025cd:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8025d2:	74 35                	je     802609 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8025d4:	55                   	push   %rbp
+  8025d5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025d8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025dc:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025e3:	00 00 00 
+  8025e6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8025ea:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8025ef:	48 b8 5a 24 80 00 00 	movabs $0x80245a,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	48 85 c0             	test   %rax,%rax
+  8025fe:	0f 9f c0             	setg   %al
+}
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802603:	b8 00 00 00 00       	mov    $0x0,%eax
+  802608:	c3                   	ret
+}
+  802609:	c3                   	ret
+
+000000000080260a <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80260a:	55                   	push   %rbp
+  80260b:	48 89 e5             	mov    %rsp,%rbp
+  80260e:	41 54                	push   %r12
+  802610:	53                   	push   %rbx
+  802611:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802614:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80261b:	00 00 00 
+  80261e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802623:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802627:	74 15                	je     80263e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802629:	48 83 c3 01          	add    $0x1,%rbx
+  80262d:	48 83 c0 18          	add    $0x18,%rax
+  802631:	48 83 fb 20          	cmp    $0x20,%rbx
+  802635:	75 ec                	jne    802623 <mmap_alloc+0x19>
+    return NULL;
+  802637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263c:	eb 52                	jmp    802690 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80263e:	4c 89 e7             	mov    %r12,%rdi
+  802641:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+  80264d:	41 89 c1             	mov    %eax,%r9d
+  802650:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802657:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80265b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802661:	ba 00 00 00 00       	mov    $0x0,%edx
+  802666:	4c 89 e6             	mov    %r12,%rsi
+  802669:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266e:	48 b8 0d 12 80 00 00 	movabs $0x80120d,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	85 c0                	test   %eax,%eax
+  80267c:	78 17                	js     802695 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80267e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802682:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802689:	00 00 00 
+  80268c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802690:	5b                   	pop    %rbx
+  802691:	41 5c                	pop    %r12
+  802693:	5d                   	pop    %rbp
+  802694:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802695:	b8 00 00 00 00       	mov    $0x0,%eax
+  80269a:	eb f4                	jmp    802690 <mmap_alloc+0x86>
+
+000000000080269c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80269c:	55                   	push   %rbp
+  80269d:	48 89 e5             	mov    %rsp,%rbp
+  8026a0:	41 56                	push   %r14
+  8026a2:	41 55                	push   %r13
+  8026a4:	41 54                	push   %r12
+  8026a6:	53                   	push   %rbx
+  8026a7:	48 83 ec 10          	sub    $0x10,%rsp
+  8026ab:	41 89 fc             	mov    %edi,%r12d
+  8026ae:	49 89 f5             	mov    %rsi,%r13
+  8026b1:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026b4:	48 89 f0             	mov    %rsi,%rax
+  8026b7:	48 09 d0             	or     %rdx,%rax
+  8026ba:	75 0d                	jne    8026c9 <fsipc+0x2d>
+  8026bc:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026bf:	83 f8 04             	cmp    $0x4,%eax
+  8026c2:	76 7d                	jbe    802741 <fsipc+0xa5>
+  8026c4:	83 ff 0d             	cmp    $0xd,%edi
+  8026c7:	74 78                	je     802741 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8026c9:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  8026d0:	00 00 00 
+  8026d3:	ff d0                	call   *%rax
+  8026d5:	89 c7                	mov    %eax,%edi
+  8026d7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8026de:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8026e5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8026ec:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026f2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8026f9:	00 00 00 
+  8026fc:	44 89 e6             	mov    %r12d,%esi
+  8026ff:	48 b8 b4 46 80 00 00 	movabs $0x8046b4,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80270b:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802712:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802713:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802718:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80271c:	4c 89 ee             	mov    %r13,%rsi
+  80271f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802724:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  80272b:	00 00 00 
+  80272e:	ff d0                	call   *%rax
+  802730:	89 c3                	mov    %eax,%ebx
+}
+  802732:	89 d8                	mov    %ebx,%eax
+  802734:	48 83 c4 10          	add    $0x10,%rsp
+  802738:	5b                   	pop    %rbx
+  802739:	41 5c                	pop    %r12
+  80273b:	41 5d                	pop    %r13
+  80273d:	41 5e                	pop    %r14
+  80273f:	5d                   	pop    %rbp
+  802740:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802741:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802748:	00 00 00 
+  80274b:	ff d0                	call   *%rax
+  80274d:	49 89 c6             	mov    %rax,%r14
+  802750:	48 85 c0             	test   %rax,%rax
+  802753:	0f 84 70 ff ff ff    	je     8026c9 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802759:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80275d:	48 b8 51 42 80 00 00 	movabs $0x804251,%rax
+  802764:	00 00 00 
+  802767:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802769:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80276c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802773:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802777:	ba 10 00 00 00       	mov    $0x10,%edx
+  80277c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802783:	00 00 00 
+  802786:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  80278d:	00 00 00 
+  802790:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802792:	4c 89 f7             	mov    %r14,%rdi
+  802795:	48 b8 ea 21 80 00 00 	movabs $0x8021ea,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8027a1:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027a8:	4c 89 f7             	mov    %r14,%rdi
+  8027ab:	48 b8 14 43 80 00 00 	movabs $0x804314,%rax
+  8027b2:	00 00 00 
+  8027b5:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027b7:	4c 89 f7             	mov    %r14,%rdi
+  8027ba:	48 b8 a2 42 80 00 00 	movabs $0x8042a2,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027c6:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8027c9:	41 83 fc 05          	cmp    $0x5,%r12d
+  8027cd:	75 04                	jne    8027d3 <fsipc+0x137>
+  8027cf:	85 db                	test   %ebx,%ebx
+  8027d1:	79 14                	jns    8027e7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8027d3:	4c 89 f7             	mov    %r14,%rdi
+  8027d6:	48 b8 c9 42 80 00 00 	movabs $0x8042c9,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8027e2:	e9 4b ff ff ff       	jmp    802732 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8027e7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8027eb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8027f0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8027f7:	00 00 00 
+  8027fa:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  802801:	00 00 00 
+  802804:	ff d0                	call   *%rax
+  802806:	eb cb                	jmp    8027d3 <fsipc+0x137>
+
+0000000000802808 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802808:	55                   	push   %rbp
+  802809:	48 89 e5             	mov    %rsp,%rbp
+  80280c:	41 57                	push   %r15
+  80280e:	41 56                	push   %r14
+  802810:	41 55                	push   %r13
+  802812:	41 54                	push   %r12
+  802814:	53                   	push   %rbx
+  802815:	48 83 ec 18          	sub    $0x18,%rsp
+  802819:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80281d:	49 89 f6             	mov    %rsi,%r14
+  802820:	49 89 d4             	mov    %rdx,%r12
+  802823:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802826:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802832:	48 85 c0             	test   %rax,%rax
+  802835:	0f 85 96 00 00 00    	jne    8028d1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80283b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802842:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802843:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80284a:	00 00 00 
+    while (n) {
+  80284d:	4d 85 e4             	test   %r12,%r12
+  802850:	74 79                	je     8028cb <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802852:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802857:	49 39 dc             	cmp    %rbx,%r12
+  80285a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80285e:	48 89 da             	mov    %rbx,%rdx
+  802861:	4c 89 f6             	mov    %r14,%rsi
+  802864:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80286b:	00 00 00 
+  80286e:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  802875:	00 00 00 
+  802878:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80287a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80287e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802881:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802884:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802887:	44 01 e8             	add    %r13d,%eax
+  80288a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80288e:	41 0f 44 c5          	cmove  %r13d,%eax
+  802892:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802896:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80289a:	48 89 da             	mov    %rbx,%rdx
+  80289d:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a2:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028a7:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8028ae:	00 00 00 
+  8028b1:	ff d0                	call   *%rax
+        if (res < 0)
+  8028b3:	85 c0                	test   %eax,%eax
+  8028b5:	78 4a                	js     802901 <devfile_write_direct+0xf9>
+        buf += res;
+  8028b7:	48 98                	cltq
+  8028b9:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028bc:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028c0:	49 29 c4             	sub    %rax,%r12
+  8028c3:	75 8d                	jne    802852 <devfile_write_direct+0x4a>
+    return write;
+  8028c5:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c9:	eb 27                	jmp    8028f2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8028cb:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8028cf:	eb f4                	jmp    8028c5 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028d1:	45 89 e9             	mov    %r13d,%r9d
+  8028d4:	4d 89 e0             	mov    %r12,%r8
+  8028d7:	4c 89 f1             	mov    %r14,%rcx
+  8028da:	ba 04 00 00 00       	mov    $0x4,%edx
+  8028df:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8028e3:	48 89 c7             	mov    %rax,%rdi
+  8028e6:	48 b8 35 22 80 00 00 	movabs $0x802235,%rax
+  8028ed:	00 00 00 
+  8028f0:	ff d0                	call   *%rax
+}
+  8028f2:	48 83 c4 18          	add    $0x18,%rsp
+  8028f6:	5b                   	pop    %rbx
+  8028f7:	41 5c                	pop    %r12
+  8028f9:	41 5d                	pop    %r13
+  8028fb:	41 5e                	pop    %r14
+  8028fd:	41 5f                	pop    %r15
+  8028ff:	5d                   	pop    %rbp
+  802900:	c3                   	ret
+            return res;
+  802901:	48 98                	cltq
+  802903:	eb ed                	jmp    8028f2 <devfile_write_direct+0xea>
+
+0000000000802905 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802905:	55                   	push   %rbp
+  802906:	48 89 e5             	mov    %rsp,%rbp
+  802909:	41 54                	push   %r12
+  80290b:	53                   	push   %rbx
+  80290c:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80290f:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802916:	00 00 00 
+  802919:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80291b:	48 85 c0             	test   %rax,%rax
+  80291e:	74 71                	je     802991 <fbuf_flush+0x8c>
+  802920:	48 89 c3             	mov    %rax,%rbx
+  802923:	b8 00 00 00 00       	mov    $0x0,%eax
+  802928:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80292c:	75 05                	jne    802933 <fbuf_flush+0x2e>
+}
+  80292e:	5b                   	pop    %rbx
+  80292f:	41 5c                	pop    %r12
+  802931:	5d                   	pop    %rbp
+  802932:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802933:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802936:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80293a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802941:	00 00 00 
+  802944:	48 89 de             	mov    %rbx,%rsi
+  802947:	48 29 c6             	sub    %rax,%rsi
+  80294a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80294e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802955:	aa aa aa 
+  802958:	48 0f af f0          	imul   %rax,%rsi
+  80295c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802960:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802965:	48 01 c6             	add    %rax,%rsi
+  802968:	4c 89 e7             	mov    %r12,%rdi
+  80296b:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802977:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80297b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802982:	00 
+    return res < 0 ? res : 0;
+  802983:	48 85 c0             	test   %rax,%rax
+  802986:	ba 00 00 00 00       	mov    $0x0,%edx
+  80298b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80298f:	eb 9d                	jmp    80292e <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802991:	b8 00 00 00 00       	mov    $0x0,%eax
+  802996:	eb 96                	jmp    80292e <fbuf_flush+0x29>
+
+0000000000802998 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802998:	55                   	push   %rbp
+  802999:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80299c:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  8029a3:	00 00 00 
+  8029a6:	ff d0                	call   *%rax
+}
+  8029a8:	5d                   	pop    %rbp
+  8029a9:	c3                   	ret
+
+00000000008029aa <devfile_write>:
+    if (!fd || !buf)
+  8029aa:	48 85 ff             	test   %rdi,%rdi
+  8029ad:	0f 84 d3 01 00 00    	je     802b86 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029b3:	55                   	push   %rbp
+  8029b4:	48 89 e5             	mov    %rsp,%rbp
+  8029b7:	41 57                	push   %r15
+  8029b9:	41 56                	push   %r14
+  8029bb:	41 55                	push   %r13
+  8029bd:	41 54                	push   %r12
+  8029bf:	53                   	push   %rbx
+  8029c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8029c4:	49 89 fc             	mov    %rdi,%r12
+  8029c7:	49 89 f6             	mov    %rsi,%r14
+  8029ca:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8029cd:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8029d2:	48 85 f6             	test   %rsi,%rsi
+  8029d5:	0f 84 9c 01 00 00    	je     802b77 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8029db:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  8029e2:	00 00 00 
+  8029e5:	ff d0                	call   *%rax
+  8029e7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8029ea:	48 85 c0             	test   %rax,%rax
+  8029ed:	0f 84 a2 00 00 00    	je     802a95 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8029f3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029f8:	4c 89 e7             	mov    %r12,%rdi
+  8029fb:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  802a02:	00 00 00 
+  802a05:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a07:	83 f8 02             	cmp    $0x2,%eax
+  802a0a:	0f 8f 85 00 00 00    	jg     802a95 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a10:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a17:	00 00 00 
+  802a1a:	4d 89 ef             	mov    %r13,%r15
+  802a1d:	49 29 c7             	sub    %rax,%r15
+  802a20:	49 c1 ff 03          	sar    $0x3,%r15
+  802a24:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a2b:	aa aa aa 
+  802a2e:	4c 0f af f8          	imul   %rax,%r15
+  802a32:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a36:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a3b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a3e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a43:	0f 84 d7 00 00 00    	je     802b20 <devfile_write+0x176>
+  802a49:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a4d:	89 c2                	mov    %eax,%edx
+  802a4f:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a53:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a58:	75 0f                	jne    802a69 <devfile_write+0xbf>
+  802a5a:	48 01 d8             	add    %rbx,%rax
+  802a5d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a63:	0f 86 92 00 00 00    	jbe    802afb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a69:	4c 89 e7             	mov    %r12,%rdi
+  802a6c:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  802a73:	00 00 00 
+  802a76:	ff d0                	call   *%rax
+  802a78:	85 c0                	test   %eax,%eax
+  802a7a:	78 52                	js     802ace <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a7c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a83:	77 7f                	ja     802b04 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802a85:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a8a:	0f 85 c2 00 00 00    	jne    802b52 <devfile_write+0x1a8>
+  802a90:	e9 94 00 00 00       	jmp    802b29 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802a95:	4c 89 e7             	mov    %r12,%rdi
+  802a98:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  802a9f:	00 00 00 
+  802aa2:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802aa4:	85 c0                	test   %eax,%eax
+  802aa6:	79 07                	jns    802aaf <devfile_write+0x105>
+  802aa8:	48 98                	cltq
+  802aaa:	e9 c8 00 00 00       	jmp    802b77 <devfile_write+0x1cd>
+  802aaf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ab4:	48 89 da             	mov    %rbx,%rdx
+  802ab7:	4c 89 f6             	mov    %r14,%rsi
+  802aba:	4c 89 e7             	mov    %r12,%rdi
+  802abd:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  802ac4:	00 00 00 
+  802ac7:	ff d0                	call   *%rax
+  802ac9:	e9 a9 00 00 00       	jmp    802b77 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802ace:	48 98                	cltq
+  802ad0:	e9 a2 00 00 00       	jmp    802b77 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ad5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ada:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802adf:	4c 89 fe             	mov    %r15,%rsi
+  802ae2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ae7:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802af3:	85 c0                	test   %eax,%eax
+  802af5:	79 45                	jns    802b3c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802af7:	48 98                	cltq
+  802af9:	eb 7c                	jmp    802b77 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802afb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b02:	76 4e                	jbe    802b52 <devfile_write+0x1a8>
+  802b04:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b09:	48 89 da             	mov    %rbx,%rdx
+  802b0c:	4c 89 f6             	mov    %r14,%rsi
+  802b0f:	4c 89 e7             	mov    %r12,%rdi
+  802b12:	48 b8 08 28 80 00 00 	movabs $0x802808,%rax
+  802b19:	00 00 00 
+  802b1c:	ff d0                	call   *%rax
+  802b1e:	eb 57                	jmp    802b77 <devfile_write+0x1cd>
+  802b20:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b27:	77 db                	ja     802b04 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b29:	4c 89 ff             	mov    %r15,%rdi
+  802b2c:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  802b33:	00 00 00 
+  802b36:	ff d0                	call   *%rax
+  802b38:	84 c0                	test   %al,%al
+  802b3a:	74 99                	je     802ad5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b3c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b41:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b46:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b4a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b51:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b52:	4c 89 ff             	mov    %r15,%rdi
+  802b55:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b59:	48 89 da             	mov    %rbx,%rdx
+  802b5c:	4c 89 f6             	mov    %r14,%rsi
+  802b5f:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  802b66:	00 00 00 
+  802b69:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b6b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b6f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b74:	48 89 d8             	mov    %rbx,%rax
+}
+  802b77:	48 83 c4 08          	add    $0x8,%rsp
+  802b7b:	5b                   	pop    %rbx
+  802b7c:	41 5c                	pop    %r12
+  802b7e:	41 5d                	pop    %r13
+  802b80:	41 5e                	pop    %r14
+  802b82:	41 5f                	pop    %r15
+  802b84:	5d                   	pop    %rbp
+  802b85:	c3                   	ret
+        return E_INVAL;
+  802b86:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802b8b:	c3                   	ret
+
+0000000000802b8c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b8c:	55                   	push   %rbp
+  802b8d:	48 89 e5             	mov    %rsp,%rbp
+  802b90:	41 54                	push   %r12
+  802b92:	53                   	push   %rbx
+  802b93:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802b96:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  802b9d:	00 00 00 
+  802ba0:	ff d0                	call   *%rax
+  802ba2:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802ba5:	48 89 df             	mov    %rbx,%rdi
+  802ba8:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802baf:	00 00 00 
+  802bb2:	ff d0                	call   *%rax
+  802bb4:	48 85 c0             	test   %rax,%rax
+  802bb7:	74 17                	je     802bd0 <devfile_flush+0x44>
+  802bb9:	48 89 df             	mov    %rbx,%rdi
+  802bbc:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802bc3:	00 00 00 
+  802bc6:	ff d0                	call   *%rax
+  802bc8:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802bcf:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bd0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bd3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802bda:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802bdc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802be1:	be 00 00 00 00       	mov    $0x0,%esi
+  802be6:	bf 06 00 00 00       	mov    $0x6,%edi
+  802beb:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  802bf2:	00 00 00 
+  802bf5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bf7:	45 85 e4             	test   %r12d,%r12d
+  802bfa:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802bfe:	5b                   	pop    %rbx
+  802bff:	41 5c                	pop    %r12
+  802c01:	5d                   	pop    %rbp
+  802c02:	c3                   	ret
+
+0000000000802c03 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c03:	55                   	push   %rbp
+  802c04:	48 89 e5             	mov    %rsp,%rbp
+  802c07:	41 57                	push   %r15
+  802c09:	41 56                	push   %r14
+  802c0b:	41 55                	push   %r13
+  802c0d:	41 54                	push   %r12
+  802c0f:	53                   	push   %rbx
+  802c10:	48 83 ec 38          	sub    $0x38,%rsp
+  802c14:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c18:	49 89 f7             	mov    %rsi,%r15
+  802c1b:	48 89 d3             	mov    %rdx,%rbx
+  802c1e:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c21:	48 b8 4e 21 80 00 00 	movabs $0x80214e,%rax
+  802c28:	00 00 00 
+  802c2b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c2d:	48 85 c0             	test   %rax,%rax
+  802c30:	75 20                	jne    802c52 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c32:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c37:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c3e:	00 
+    while (n) {
+  802c3f:	48 85 db             	test   %rbx,%rbx
+  802c42:	0f 85 df 00 00 00    	jne    802d27 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c48:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c4c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c50:	eb 21                	jmp    802c73 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c52:	45 89 f1             	mov    %r14d,%r9d
+  802c55:	49 89 d8             	mov    %rbx,%r8
+  802c58:	4c 89 f9             	mov    %r15,%rcx
+  802c5b:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c60:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c64:	48 89 c7             	mov    %rax,%rdi
+  802c67:	48 b8 35 22 80 00 00 	movabs $0x802235,%rax
+  802c6e:	00 00 00 
+  802c71:	ff d0                	call   *%rax
+}
+  802c73:	48 83 c4 38          	add    $0x38,%rsp
+  802c77:	5b                   	pop    %rbx
+  802c78:	41 5c                	pop    %r12
+  802c7a:	41 5d                	pop    %r13
+  802c7c:	41 5e                	pop    %r14
+  802c7e:	41 5f                	pop    %r15
+  802c80:	5d                   	pop    %rbp
+  802c81:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c82:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c86:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c8c:	75 1e                	jne    802cac <devfile_read_direct+0xa9>
+  802c8e:	e9 e2 00 00 00       	jmp    802d75 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802c93:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c97:	eb da                	jmp    802c73 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802c99:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802c9d:	0f 85 d0 01 00 00    	jne    802e73 <devfile_read_direct+0x270>
+            map = 0;
+  802ca3:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ca7:	eb 03                	jmp    802cac <devfile_read_direct+0xa9>
+  802ca9:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802cac:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cb1:	48 39 d3             	cmp    %rdx,%rbx
+  802cb4:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cb8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cbc:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cbf:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802cc6:	00 00 00 
+  802cc9:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802ccb:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802ccf:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802cd3:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd8:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cdd:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  802ce4:	00 00 00 
+  802ce7:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ce9:	85 c0                	test   %eax,%eax
+  802ceb:	0f 8e 63 01 00 00    	jle    802e54 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802cf1:	4c 63 e0             	movslq %eax,%r12
+  802cf4:	4c 89 e2             	mov    %r12,%rdx
+  802cf7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802cfe:	00 00 00 
+  802d01:	4c 89 ff             	mov    %r15,%rdi
+  802d04:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  802d0b:	00 00 00 
+  802d0e:	ff d0                	call   *%rax
+        buf += res;
+  802d10:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d13:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d16:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d1a:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d1e:	48 85 db             	test   %rbx,%rbx
+  802d21:	0f 84 25 ff ff ff    	je     802c4c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d27:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d2a:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d2e:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d32:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d36:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d3d:	0f 97 c2             	seta   %dl
+  802d40:	20 c2                	and    %al,%dl
+  802d42:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d45:	0f 84 5e ff ff ff    	je     802ca9 <devfile_read_direct+0xa6>
+  802d4b:	4c 89 fa             	mov    %r15,%rdx
+  802d4e:	4d 89 fd             	mov    %r15,%r13
+  802d51:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d58:	0f 85 4e ff ff ff    	jne    802cac <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d5e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d62:	0f 84 1a ff ff ff    	je     802c82 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d68:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d6f:	0f 85 37 ff ff ff    	jne    802cac <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d75:	48 89 d8             	mov    %rbx,%rax
+  802d78:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d7e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d83:	48 39 c8             	cmp    %rcx,%rax
+  802d86:	48 0f 47 c1          	cmova  %rcx,%rax
+  802d8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802d8e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802d92:	49 89 d4             	mov    %rdx,%r12
+  802d95:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802d99:	48 b8 74 40 80 00 00 	movabs $0x804074,%rax
+  802da0:	00 00 00 
+  802da3:	ff d0                	call   *%rax
+  802da5:	a8 40                	test   $0x40,%al
+  802da7:	0f 85 b9 00 00 00    	jne    802e66 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802dad:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802db4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802db8:	49 39 c5             	cmp    %rax,%r13
+  802dbb:	72 d8                	jb     802d95 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802dbd:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802dc1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802dc8:	00 00 00 
+  802dcb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dcf:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802dd2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802dd4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802dd8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802ddc:	48 b8 e9 1f 80 00 00 	movabs $0x801fe9,%rax
+  802de3:	00 00 00 
+  802de6:	ff d0                	call   *%rax
+  802de8:	89 c7                	mov    %eax,%edi
+  802dea:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802df0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802df5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802dfc:	00 00 00 
+  802dff:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e04:	48 b8 b4 46 80 00 00 	movabs $0x8046b4,%rax
+  802e0b:	00 00 00 
+  802e0e:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e10:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e15:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e19:	4c 89 fe             	mov    %r15,%rsi
+  802e1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e21:	48 b8 90 46 80 00 00 	movabs $0x804690,%rax
+  802e28:	00 00 00 
+  802e2b:	ff d0                	call   *%rax
+  802e2d:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e30:	48 85 d2             	test   %rdx,%rdx
+  802e33:	0f 84 5a fe ff ff    	je     802c93 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e39:	0f 8e 5a fe ff ff    	jle    802c99 <devfile_read_direct+0x96>
+                buf += res;
+  802e3f:	48 98                	cltq
+  802e41:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e44:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e47:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e4b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e4f:	e9 ca fe ff ff       	jmp    802d1e <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e54:	41 89 c5             	mov    %eax,%r13d
+  802e57:	48 98                	cltq
+  802e59:	45 85 ed             	test   %r13d,%r13d
+  802e5c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e61:	e9 0d fe ff ff       	jmp    802c73 <devfile_read_direct+0x70>
+            map = 0;
+  802e66:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e6a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e6e:	e9 39 fe ff ff       	jmp    802cac <devfile_read_direct+0xa9>
+  802e73:	48 89 d0             	mov    %rdx,%rax
+  802e76:	e9 f8 fd ff ff       	jmp    802c73 <devfile_read_direct+0x70>
+
+0000000000802e7b <devfile_read>:
+    if (!fd || !buf)
+  802e7b:	48 85 ff             	test   %rdi,%rdi
+  802e7e:	0f 84 21 02 00 00    	je     8030a5 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e84:	55                   	push   %rbp
+  802e85:	48 89 e5             	mov    %rsp,%rbp
+  802e88:	41 57                	push   %r15
+  802e8a:	41 56                	push   %r14
+  802e8c:	41 55                	push   %r13
+  802e8e:	41 54                	push   %r12
+  802e90:	53                   	push   %rbx
+  802e91:	48 83 ec 28          	sub    $0x28,%rsp
+  802e95:	48 89 fb             	mov    %rdi,%rbx
+  802e98:	49 89 f4             	mov    %rsi,%r12
+  802e9b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802e9e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ea3:	48 85 f6             	test   %rsi,%rsi
+  802ea6:	74 4b                	je     802ef3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ea8:	48 b8 b8 21 80 00 00 	movabs $0x8021b8,%rax
+  802eaf:	00 00 00 
+  802eb2:	ff d0                	call   *%rax
+  802eb4:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802eb7:	48 85 c0             	test   %rax,%rax
+  802eba:	74 22                	je     802ede <devfile_read+0x63>
+  802ebc:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ec3:	77 19                	ja     802ede <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ec5:	be 00 10 00 00       	mov    $0x1000,%esi
+  802eca:	48 89 df             	mov    %rbx,%rdi
+  802ecd:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  802ed4:	00 00 00 
+  802ed7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ed9:	83 f8 02             	cmp    $0x2,%eax
+  802edc:	7e 40                	jle    802f1e <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ede:	48 89 df             	mov    %rbx,%rdi
+  802ee1:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802eed:	85 c0                	test   %eax,%eax
+  802eef:	79 11                	jns    802f02 <devfile_read+0x87>
+  802ef1:	48 98                	cltq
+}
+  802ef3:	48 83 c4 28          	add    $0x28,%rsp
+  802ef7:	5b                   	pop    %rbx
+  802ef8:	41 5c                	pop    %r12
+  802efa:	41 5d                	pop    %r13
+  802efc:	41 5e                	pop    %r14
+  802efe:	41 5f                	pop    %r15
+  802f00:	5d                   	pop    %rbp
+  802f01:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f02:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f07:	4c 89 ea             	mov    %r13,%rdx
+  802f0a:	4c 89 e6             	mov    %r12,%rsi
+  802f0d:	48 89 df             	mov    %rbx,%rdi
+  802f10:	48 b8 03 2c 80 00 00 	movabs $0x802c03,%rax
+  802f17:	00 00 00 
+  802f1a:	ff d0                	call   *%rax
+  802f1c:	eb d5                	jmp    802ef3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f1e:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f22:	48 89 df             	mov    %rbx,%rdi
+  802f25:	48 b8 05 29 80 00 00 	movabs $0x802905,%rax
+  802f2c:	00 00 00 
+  802f2f:	ff d0                	call   *%rax
+  802f31:	85 c0                	test   %eax,%eax
+  802f33:	0f 88 33 01 00 00    	js     80306c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f39:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f40:	00 00 00 
+  802f43:	4c 89 f0             	mov    %r14,%rax
+  802f46:	48 29 d0             	sub    %rdx,%rax
+  802f49:	48 c1 f8 03          	sar    $0x3,%rax
+  802f4d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f54:	aa aa aa 
+  802f57:	48 0f af c2          	imul   %rdx,%rax
+  802f5b:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f5f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f63:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f66:	41 39 06             	cmp    %eax,(%r14)
+  802f69:	75 0d                	jne    802f78 <devfile_read+0xfd>
+  802f6b:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f6e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f72:	0f 84 fb 00 00 00    	je     803073 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f78:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f7d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f81:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802f84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f88:	48 89 c7             	mov    %rax,%rdi
+  802f8b:	48 b8 d3 40 80 00 00 	movabs $0x8040d3,%rax
+  802f92:	00 00 00 
+  802f95:	ff d0                	call   *%rax
+  802f97:	84 c0                	test   %al,%al
+  802f99:	75 27                	jne    802fc2 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f9b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802fa0:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fa5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fa9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fae:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  802fb5:	00 00 00 
+  802fb8:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802fba:	85 c0                	test   %eax,%eax
+  802fbc:	0f 88 dc 00 00 00    	js     80309e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802fc2:	44 89 f8             	mov    %r15d,%eax
+  802fc5:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802fca:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802fcc:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802fd3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802fd4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802fd7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802fdb:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802fde:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fe3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fe7:	48 89 df             	mov    %rbx,%rdi
+  802fea:	48 b8 03 2c 80 00 00 	movabs $0x802c03,%rax
+  802ff1:	00 00 00 
+  802ff4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802ff6:	48 85 c0             	test   %rax,%rax
+  802ff9:	0f 88 f4 fe ff ff    	js     802ef3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802fff:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803002:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803005:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803008:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  80300c:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803010:	48 63 d1             	movslq %ecx,%rdx
+  803013:	48 01 d0             	add    %rdx,%rax
+  803016:	4d 63 ff             	movslq %r15d,%r15
+  803019:	4c 29 f8             	sub    %r15,%rax
+  80301c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803021:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803025:	48 85 c0             	test   %rax,%rax
+  803028:	0f 8e c5 fe ff ff    	jle    802ef3 <devfile_read+0x78>
+    n = MIN(n, res);
+  80302e:	4c 39 e8             	cmp    %r13,%rax
+  803031:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803035:	8b 73 04             	mov    0x4(%rbx),%esi
+  803038:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80303c:	48 63 f6             	movslq %esi,%rsi
+  80303f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803044:	48 01 c6             	add    %rax,%rsi
+  803047:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80304b:	48 01 c6             	add    %rax,%rsi
+  80304e:	4c 89 ea             	mov    %r13,%rdx
+  803051:	4c 89 e7             	mov    %r12,%rdi
+  803054:	48 b8 b9 0e 80 00 00 	movabs $0x800eb9,%rax
+  80305b:	00 00 00 
+  80305e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803060:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803064:	4c 89 e8             	mov    %r13,%rax
+  803067:	e9 87 fe ff ff       	jmp    802ef3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80306c:	48 98                	cltq
+  80306e:	e9 80 fe ff ff       	jmp    802ef3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803073:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803077:	41 39 d7             	cmp    %edx,%r15d
+  80307a:	0f 8c f8 fe ff ff    	jl     802f78 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803080:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803084:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803087:	41 39 cf             	cmp    %ecx,%r15d
+  80308a:	0f 8d e8 fe ff ff    	jge    802f78 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803090:	4d 63 ff             	movslq %r15d,%r15
+  803093:	4c 29 f8             	sub    %r15,%rax
+  803096:	48 63 d2             	movslq %edx,%rdx
+  803099:	48 01 d0             	add    %rdx,%rax
+  80309c:	eb 87                	jmp    803025 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80309e:	48 98                	cltq
+  8030a0:	e9 4e fe ff ff       	jmp    802ef3 <devfile_read+0x78>
+        return E_INVAL;
+  8030a5:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030aa:	c3                   	ret
+
+00000000008030ab <fs_channel>:
+fs_channel(bool enable) {
+  8030ab:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030ad:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030b4:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030bb:	40 84 ff             	test   %dil,%dil
+  8030be:	74 47                	je     803107 <fs_channel+0x5c>
+  8030c0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8030c7:	00 00 00 
+  8030ca:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8030d0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8030d7:	00 00 00 
+  8030da:	3b 08                	cmp    (%rax),%ecx
+  8030dc:	74 29                	je     803107 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8030de:	55                   	push   %rbp
+  8030df:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8030e2:	48 b8 2b 20 80 00 00 	movabs $0x80202b,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+  8030ee:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8030f0:	85 c0                	test   %eax,%eax
+  8030f2:	78 04                	js     8030f8 <fs_channel+0x4d>
+}
+  8030f4:	89 d0                	mov    %edx,%eax
+  8030f6:	5d                   	pop    %rbp
+  8030f7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8030f8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8030ff:	00 00 00 
+  803102:	c6 00 00             	movb   $0x0,(%rax)
+  803105:	eb ed                	jmp    8030f4 <fs_channel+0x49>
+}
+  803107:	89 d0                	mov    %edx,%eax
+  803109:	c3                   	ret
+
+000000000080310a <open>:
+open(const char *path, int mode) {
+  80310a:	55                   	push   %rbp
+  80310b:	48 89 e5             	mov    %rsp,%rbp
+  80310e:	41 55                	push   %r13
+  803110:	41 54                	push   %r12
+  803112:	53                   	push   %rbx
+  803113:	48 83 ec 18          	sub    $0x18,%rsp
+  803117:	49 89 fc             	mov    %rdi,%r12
+  80311a:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80311d:	48 b8 1a 0c 80 00 00 	movabs $0x800c1a,%rax
+  803124:	00 00 00 
+  803127:	ff d0                	call   *%rax
+  803129:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80312f:	0f 87 8f 00 00 00    	ja     8031c4 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803135:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803139:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+  803145:	89 c3                	mov    %eax,%ebx
+  803147:	85 c0                	test   %eax,%eax
+  803149:	78 55                	js     8031a0 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80314b:	4c 89 e6             	mov    %r12,%rsi
+  80314e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803155:	00 00 00 
+  803158:	48 89 df             	mov    %rbx,%rdi
+  80315b:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  803162:	00 00 00 
+  803165:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803167:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80316e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803173:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803177:	bf 01 00 00 00       	mov    $0x1,%edi
+  80317c:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+  803188:	89 c3                	mov    %eax,%ebx
+  80318a:	85 c0                	test   %eax,%eax
+  80318c:	78 1f                	js     8031ad <open+0xa3>
+    return fd2num(fd);
+  80318e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803192:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  803199:	00 00 00 
+  80319c:	ff d0                	call   *%rax
+  80319e:	89 c3                	mov    %eax,%ebx
+}
+  8031a0:	89 d8                	mov    %ebx,%eax
+  8031a2:	48 83 c4 18          	add    $0x18,%rsp
+  8031a6:	5b                   	pop    %rbx
+  8031a7:	41 5c                	pop    %r12
+  8031a9:	41 5d                	pop    %r13
+  8031ab:	5d                   	pop    %rbp
+  8031ac:	c3                   	ret
+        fd_close(fd, 0);
+  8031ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b2:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031b6:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+        return res;
+  8031c2:	eb dc                	jmp    8031a0 <open+0x96>
+        return -E_BAD_PATH;
+  8031c4:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031c9:	eb d5                	jmp    8031a0 <open+0x96>
+
+00000000008031cb <file_flush_buffers>:
+file_flush_buffers(void) {
+  8031cb:	55                   	push   %rbp
+  8031cc:	48 89 e5             	mov    %rsp,%rbp
+  8031cf:	41 56                	push   %r14
+  8031d1:	41 55                	push   %r13
+  8031d3:	41 54                	push   %r12
+  8031d5:	53                   	push   %rbx
+  8031d6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8031da:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8031e1:	00 00 00 
+  8031e4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031e9:	49 bd 45 19 80 00 00 	movabs $0x801945,%r13
+  8031f0:	00 00 00 
+  8031f3:	49 be 05 29 80 00 00 	movabs $0x802905,%r14
+  8031fa:	00 00 00 
+  8031fd:	eb 0c                	jmp    80320b <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8031ff:	83 c3 01             	add    $0x1,%ebx
+  803202:	49 83 c4 18          	add    $0x18,%r12
+  803206:	83 fb 20             	cmp    $0x20,%ebx
+  803209:	74 1d                	je     803228 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80320b:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803210:	74 ed                	je     8031ff <file_flush_buffers+0x34>
+  803212:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803216:	89 df                	mov    %ebx,%edi
+  803218:	41 ff d5             	call   *%r13
+  80321b:	85 c0                	test   %eax,%eax
+  80321d:	78 e0                	js     8031ff <file_flush_buffers+0x34>
+  80321f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803223:	41 ff d6             	call   *%r14
+  803226:	eb d7                	jmp    8031ff <file_flush_buffers+0x34>
+}
+  803228:	48 83 c4 10          	add    $0x10,%rsp
+  80322c:	5b                   	pop    %rbx
+  80322d:	41 5c                	pop    %r12
+  80322f:	41 5d                	pop    %r13
+  803231:	41 5e                	pop    %r14
+  803233:	5d                   	pop    %rbp
+  803234:	c3                   	ret
+
+0000000000803235 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803235:	55                   	push   %rbp
+  803236:	48 89 e5             	mov    %rsp,%rbp
+  803239:	41 54                	push   %r12
+  80323b:	53                   	push   %rbx
+  80323c:	49 89 fc             	mov    %rdi,%r12
+  80323f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803241:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  803248:	00 00 00 
+  80324b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80324d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803254:	00 00 00 
+  803257:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80325c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80325e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803261:	ba 00 00 00 00       	mov    $0x0,%edx
+  803266:	be 00 00 00 00       	mov    $0x0,%esi
+  80326b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803270:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+}
+  80327c:	5b                   	pop    %rbx
+  80327d:	41 5c                	pop    %r12
+  80327f:	5d                   	pop    %rbp
+  803280:	c3                   	ret
+
+0000000000803281 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803281:	55                   	push   %rbp
+  803282:	48 89 e5             	mov    %rsp,%rbp
+  803285:	41 54                	push   %r12
+  803287:	53                   	push   %rbx
+  803288:	49 89 fc             	mov    %rdi,%r12
+  80328b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80328e:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  803295:	00 00 00 
+  803298:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80329a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80329f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032a6:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8032b2:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032b7:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8032be:	00 00 00 
+  8032c1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032c3:	85 c0                	test   %eax,%eax
+  8032c5:	78 3d                	js     803304 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032c7:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8032ce:	00 00 00 
+  8032d1:	4c 89 e6             	mov    %r12,%rsi
+  8032d4:	48 89 df             	mov    %rbx,%rdi
+  8032d7:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8032e3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8032ea:	00 
+  8032eb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8032f1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8032f8:	00 
+  8032f9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8032ff:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803304:	5b                   	pop    %rbx
+  803305:	41 5c                	pop    %r12
+  803307:	5d                   	pop    %rbp
+  803308:	c3                   	ret
+
+0000000000803309 <remove>:
+remove(const char *path) {
+  803309:	55                   	push   %rbp
+  80330a:	48 89 e5             	mov    %rsp,%rbp
+  80330d:	53                   	push   %rbx
+  80330e:	48 83 ec 08          	sub    $0x8,%rsp
+  803312:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803315:	48 b8 1a 0c 80 00 00 	movabs $0x800c1a,%rax
+  80331c:	00 00 00 
+  80331f:	ff d0                	call   *%rax
+  803321:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803327:	77 3a                	ja     803363 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803329:	48 89 de             	mov    %rbx,%rsi
+  80332c:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803333:	00 00 00 
+  803336:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  80333d:	00 00 00 
+  803340:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803342:	ba 00 00 00 00       	mov    $0x0,%edx
+  803347:	be 00 00 00 00       	mov    $0x0,%esi
+  80334c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803351:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803358:	00 00 00 
+  80335b:	ff d0                	call   *%rax
+}
+  80335d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803361:	c9                   	leave
+  803362:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803363:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803368:	eb f3                	jmp    80335d <remove+0x54>
+
+000000000080336a <sync>:
+sync(void) {
+  80336a:	55                   	push   %rbp
+  80336b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80336e:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80337a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337f:	be 00 00 00 00       	mov    $0x0,%esi
+  803384:	bf 08 00 00 00       	mov    $0x8,%edi
+  803389:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+}
+  803395:	5d                   	pop    %rbp
+  803396:	c3                   	ret
+
+0000000000803397 <fsync>:
+fsync(int fdnum) {
+  803397:	55                   	push   %rbp
+  803398:	48 89 e5             	mov    %rsp,%rbp
+  80339b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80339f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033a3:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  8033aa:	00 00 00 
+  8033ad:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033af:	85 c0                	test   %eax,%eax
+  8033b1:	78 4b                	js     8033fe <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033b3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b7:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8033be:	00 00 00 
+  8033c1:	8b 00                	mov    (%rax),%eax
+  8033c3:	39 02                	cmp    %eax,(%rdx)
+  8033c5:	75 39                	jne    803400 <fsync+0x69>
+    file_flush_buffers();
+  8033c7:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  8033ce:	00 00 00 
+  8033d1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8033d3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d7:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033da:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8033e1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8033e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8033ed:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8033f2:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  8033f9:	00 00 00 
+  8033fc:	ff d0                	call   *%rax
+}
+  8033fe:	c9                   	leave
+  8033ff:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803400:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803405:	eb f7                	jmp    8033fe <fsync+0x67>
+
+0000000000803407 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803407:	55                   	push   %rbp
+  803408:	48 89 e5             	mov    %rsp,%rbp
+  80340b:	53                   	push   %rbx
+  80340c:	48 83 ec 08          	sub    $0x8,%rsp
+  803410:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803413:	ba 00 00 00 00       	mov    $0x0,%edx
+  803418:	be 00 00 00 00       	mov    $0x0,%esi
+  80341d:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803422:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80342e:	85 c0                	test   %eax,%eax
+  803430:	78 2d                	js     80345f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803432:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803439:	00 00 00 
+  80343c:	48 8b 10             	mov    (%rax),%rdx
+  80343f:	48 89 13             	mov    %rdx,(%rbx)
+  803442:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803446:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80344a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80344e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803452:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803456:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80345a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80345f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803463:	c9                   	leave
+  803464:	c3                   	ret
+
+0000000000803465 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803465:	55                   	push   %rbp
+  803466:	48 89 e5             	mov    %rsp,%rbp
+  803469:	53                   	push   %rbx
+  80346a:	48 83 ec 08          	sub    $0x8,%rsp
+  80346e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803471:	ba 00 00 00 00       	mov    $0x0,%edx
+  803476:	be 00 00 00 00       	mov    $0x0,%esi
+  80347b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803480:	48 b8 9c 26 80 00 00 	movabs $0x80269c,%rax
+  803487:	00 00 00 
+  80348a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80348c:	85 c0                	test   %eax,%eax
+  80348e:	78 3d                	js     8034cd <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803490:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803497:	00 00 00 
+  80349a:	48 8b 10             	mov    (%rax),%rdx
+  80349d:	48 89 13             	mov    %rdx,(%rbx)
+  8034a0:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034a4:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034a8:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034ac:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034b0:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034b4:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034b8:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034bc:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034c0:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034c4:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8034c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034d1:	c9                   	leave
+  8034d2:	c3                   	ret
+
+00000000008034d3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8034d3:	55                   	push   %rbp
+  8034d4:	48 89 e5             	mov    %rsp,%rbp
+  8034d7:	41 57                	push   %r15
+  8034d9:	41 56                	push   %r14
+  8034db:	41 55                	push   %r13
+  8034dd:	41 54                	push   %r12
+  8034df:	53                   	push   %rbx
+  8034e0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8034e4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8034eb:	00 
+  8034ec:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034f3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034f9:	0f 85 43 01 00 00    	jne    803642 <munmap+0x16f>
+  8034ff:	49 89 ff             	mov    %rdi,%r15
+  803502:	4c 39 f7             	cmp    %r14,%rdi
+  803505:	0f 87 37 01 00 00    	ja     803642 <munmap+0x16f>
+  80350b:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803512:	00 00 00 
+  803515:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80351b:	eb 2c                	jmp    803549 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80351d:	4c 39 f8             	cmp    %r15,%rax
+  803520:	0f 83 85 00 00 00    	jae    8035ab <munmap+0xd8>
+            m->mm_end = start;
+  803526:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80352b:	48 83 c3 18          	add    $0x18,%rbx
+  80352f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803536:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80353d:	00 00 00 
+  803540:	48 39 c3             	cmp    %rax,%rbx
+  803543:	0f 84 d0 00 00 00    	je     803619 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803549:	49 89 dc             	mov    %rbx,%r12
+  80354c:	48 8b 03             	mov    (%rbx),%rax
+  80354f:	4c 39 f0             	cmp    %r14,%rax
+  803552:	73 d7                	jae    80352b <munmap+0x58>
+  803554:	48 85 c0             	test   %rax,%rax
+  803557:	74 d2                	je     80352b <munmap+0x58>
+  803559:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80355d:	49 39 d7             	cmp    %rdx,%r15
+  803560:	73 c9                	jae    80352b <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803562:	49 39 d6             	cmp    %rdx,%r14
+  803565:	73 b6                	jae    80351d <munmap+0x4a>
+  803567:	49 39 c7             	cmp    %rax,%r15
+  80356a:	76 b1                	jbe    80351d <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80356c:	4c 89 ef             	mov    %r13,%rdi
+  80356f:	48 b8 0a 26 80 00 00 	movabs $0x80260a,%rax
+  803576:	00 00 00 
+  803579:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80357b:	48 85 c0             	test   %rax,%rax
+  80357e:	0f 84 c5 00 00 00    	je     803649 <munmap+0x176>
+            *tail = *m;
+  803584:	48 8b 13             	mov    (%rbx),%rdx
+  803587:	48 89 10             	mov    %rdx,(%rax)
+  80358a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80358e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803592:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803596:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80359a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80359d:	44 89 f2             	mov    %r14d,%edx
+  8035a0:	2b 13                	sub    (%rbx),%edx
+  8035a2:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8035a5:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035a9:	eb 80                	jmp    80352b <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035ab:	49 39 d6             	cmp    %rdx,%r14
+  8035ae:	73 18                	jae    8035c8 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035b0:	44 89 f2             	mov    %r14d,%edx
+  8035b3:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035b8:	29 c2                	sub    %eax,%edx
+  8035ba:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035bf:	4d 89 34 24          	mov    %r14,(%r12)
+  8035c3:	e9 63 ff ff ff       	jmp    80352b <munmap+0x58>
+    m->mm_start = 0;
+  8035c8:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8035cf:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8035d0:	4c 89 e6             	mov    %r12,%rsi
+  8035d3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8035da:	00 00 00 
+  8035dd:	48 29 c6             	sub    %rax,%rsi
+  8035e0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8035e4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8035eb:	aa aa aa 
+  8035ee:	48 0f af f0          	imul   %rax,%rsi
+  8035f2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8035f6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8035fb:	48 01 c6             	add    %rax,%rsi
+  8035fe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803603:	bf 00 00 00 00       	mov    $0x0,%edi
+  803608:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+}
+  803614:	e9 12 ff ff ff       	jmp    80352b <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803619:	4c 89 f2             	mov    %r14,%rdx
+  80361c:	4c 29 fa             	sub    %r15,%rdx
+  80361f:	4c 89 fe             	mov    %r15,%rsi
+  803622:	bf 00 00 00 00       	mov    $0x0,%edi
+  803627:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+}
+  803633:	48 83 c4 08          	add    $0x8,%rsp
+  803637:	5b                   	pop    %rbx
+  803638:	41 5c                	pop    %r12
+  80363a:	41 5d                	pop    %r13
+  80363c:	41 5e                	pop    %r14
+  80363e:	41 5f                	pop    %r15
+  803640:	5d                   	pop    %rbp
+  803641:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803642:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803647:	eb ea                	jmp    803633 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803649:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80364e:	eb e3                	jmp    803633 <munmap+0x160>
+
+0000000000803650 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803650:	55                   	push   %rbp
+  803651:	48 89 e5             	mov    %rsp,%rbp
+  803654:	41 57                	push   %r15
+  803656:	41 56                	push   %r14
+  803658:	41 55                	push   %r13
+  80365a:	41 54                	push   %r12
+  80365c:	53                   	push   %rbx
+  80365d:	48 83 ec 28          	sub    $0x28,%rsp
+  803661:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803665:	49 89 f5             	mov    %rsi,%r13
+  803668:	41 89 d6             	mov    %edx,%r14d
+  80366b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80366e:	41 89 cc             	mov    %ecx,%r12d
+  803671:	44 89 c7             	mov    %r8d,%edi
+  803674:	44 89 cb             	mov    %r9d,%ebx
+  803677:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80367b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80367f:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  803686:	00 00 00 
+  803689:	ff d0                	call   *%rax
+  80368b:	41 89 c7             	mov    %eax,%r15d
+  80368e:	85 c0                	test   %eax,%eax
+  803690:	0f 88 ae 01 00 00    	js     803844 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803696:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80369a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8036a1:	00 00 00 
+  8036a4:	8b 32                	mov    (%rdx),%esi
+  8036a6:	39 30                	cmp    %esi,(%rax)
+  8036a8:	0f 85 7a 02 00 00    	jne    803928 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036ae:	8b 40 08             	mov    0x8(%rax),%eax
+  8036b1:	83 e0 03             	and    $0x3,%eax
+  8036b4:	83 f8 01             	cmp    $0x1,%eax
+  8036b7:	0f 84 76 02 00 00    	je     803933 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036bd:	4d 85 ed             	test   %r13,%r13
+  8036c0:	0f 84 78 02 00 00    	je     80393e <mmap+0x2ee>
+  8036c6:	85 db                	test   %ebx,%ebx
+  8036c8:	0f 88 70 02 00 00    	js     80393e <mmap+0x2ee>
+  8036ce:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8036d4:	41 89 df             	mov    %ebx,%r15d
+  8036d7:	0f 85 6c 02 00 00    	jne    803949 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036dd:	44 89 f0             	mov    %r14d,%eax
+  8036e0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8036e3:	83 f8 04             	cmp    $0x4,%eax
+  8036e6:	0f 85 68 02 00 00    	jne    803954 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036ec:	44 89 e1             	mov    %r12d,%ecx
+  8036ef:	83 e1 01             	and    $0x1,%ecx
+  8036f2:	0f 95 c2             	setne  %dl
+  8036f5:	44 89 e0             	mov    %r12d,%eax
+  8036f8:	d1 e8                	shr    %eax
+  8036fa:	83 f0 01             	xor    $0x1,%eax
+  8036fd:	83 e0 01             	and    $0x1,%eax
+  803700:	38 c2                	cmp    %al,%dl
+  803702:	0f 85 57 02 00 00    	jne    80395f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803708:	85 c9                	test   %ecx,%ecx
+  80370a:	74 0a                	je     803716 <mmap+0xc6>
+  80370c:	41 f6 c6 02          	test   $0x2,%r14b
+  803710:	0f 85 54 02 00 00    	jne    80396a <mmap+0x31a>
+    file_flush_buffers();
+  803716:	48 b8 cb 31 80 00 00 	movabs $0x8031cb,%rax
+  80371d:	00 00 00 
+  803720:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803722:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803729:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803730:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803734:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803737:	41 f6 c4 04          	test   $0x4,%r12b
+  80373b:	0f 84 15 01 00 00    	je     803856 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803741:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803744:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80374a:	0f 85 25 02 00 00    	jne    803975 <mmap+0x325>
+  803750:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803754:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80375b:	00 00 00 
+  80375e:	48 39 c2             	cmp    %rax,%rdx
+  803761:	0f 82 19 02 00 00    	jb     803980 <mmap+0x330>
+  803767:	48 39 c7             	cmp    %rax,%rdi
+  80376a:	0f 87 10 02 00 00    	ja     803980 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803770:	4c 89 ee             	mov    %r13,%rsi
+  803773:	48 b8 d3 34 80 00 00 	movabs $0x8034d3,%rax
+  80377a:	00 00 00 
+  80377d:	ff d0                	call   *%rax
+  80377f:	85 c0                	test   %eax,%eax
+  803781:	0f 88 04 02 00 00    	js     80398b <mmap+0x33b>
+    if (!handler) {
+  803787:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80378e:	00 00 00 
+  803791:	80 38 00             	cmpb   $0x0,(%rax)
+  803794:	75 2b                	jne    8037c1 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803796:	48 bf 6b 25 80 00 00 	movabs $0x80256b,%rdi
+  80379d:	00 00 00 
+  8037a0:	48 b8 74 16 80 00 00 	movabs $0x801674,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	85 c0                	test   %eax,%eax
+  8037ae:	0f 88 ea 01 00 00    	js     80399e <mmap+0x34e>
+        handler = 1;
+  8037b4:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037bb:	00 00 00 
+  8037be:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037c1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037c5:	48 b8 0a 26 80 00 00 	movabs $0x80260a,%rax
+  8037cc:	00 00 00 
+  8037cf:	ff d0                	call   *%rax
+  8037d1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8037d4:	48 85 c0             	test   %rax,%rax
+  8037d7:	0f 84 c9 01 00 00    	je     8039a6 <mmap+0x356>
+    m->mm_start = va;
+  8037dd:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8037e0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8037e4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8037e8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8037eb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8037ef:	44 89 e0             	mov    %r12d,%eax
+  8037f2:	c1 e0 06             	shl    $0x6,%eax
+  8037f5:	25 80 00 00 00       	and    $0x80,%eax
+  8037fa:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8037fd:	09 f0                	or     %esi,%eax
+  8037ff:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803803:	41 f6 c4 08          	test   $0x8,%r12b
+  803807:	74 31                	je     80383a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803809:	48 39 d3             	cmp    %rdx,%rbx
+  80380c:	73 2c                	jae    80383a <mmap+0x1ea>
+  80380e:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803813:	48 89 de             	mov    %rbx,%rsi
+  803816:	4c 89 f7             	mov    %r14,%rdi
+  803819:	48 b8 5a 24 80 00 00 	movabs $0x80245a,%rax
+  803820:	00 00 00 
+  803823:	ff d0                	call   *%rax
+  803825:	49 89 c4             	mov    %rax,%r12
+  803828:	48 85 c0             	test   %rax,%rax
+  80382b:	0f 8e d7 00 00 00    	jle    803908 <mmap+0x2b8>
+            va += n;
+  803831:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803834:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803838:	72 d4                	jb     80380e <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80383a:	49 8b 06             	mov    (%r14),%rax
+  80383d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803841:	48 89 06             	mov    %rax,(%rsi)
+}
+  803844:	44 89 f8             	mov    %r15d,%eax
+  803847:	48 83 c4 28          	add    $0x28,%rsp
+  80384b:	5b                   	pop    %rbx
+  80384c:	41 5c                	pop    %r12
+  80384e:	41 5d                	pop    %r13
+  803850:	41 5e                	pop    %r14
+  803852:	41 5f                	pop    %r15
+  803854:	5d                   	pop    %rbp
+  803855:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803856:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80385d:	00 00 00 
+  803860:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803863:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80386a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80386d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803872:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803879:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80387c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803883:	00 00 00 
+  803886:	48 39 d7             	cmp    %rdx,%rdi
+  803889:	73 1c                	jae    8038a7 <mmap+0x257>
+        return -E_NO_MEM;
+  80388b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803891:	eb b1                	jmp    803844 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803893:	48 83 c0 01          	add    $0x1,%rax
+  803897:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80389b:	77 3f                	ja     8038dc <mmap+0x28c>
+  80389d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8038a2:	48 39 d7             	cmp    %rdx,%rdi
+  8038a5:	72 2a                	jb     8038d1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038a7:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038ab:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038af:	48 39 d1             	cmp    %rdx,%rcx
+  8038b2:	73 df                	jae    803893 <mmap+0x243>
+  8038b4:	48 85 c9             	test   %rcx,%rcx
+  8038b7:	74 da                	je     803893 <mmap+0x243>
+  8038b9:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038bd:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038c2:	48 39 d3             	cmp    %rdx,%rbx
+  8038c5:	73 cc                	jae    803893 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038c7:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038cf:	eb cc                	jmp    80389d <mmap+0x24d>
+        return -E_NO_MEM;
+  8038d1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038d7:	e9 68 ff ff ff       	jmp    803844 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8038dc:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8038e1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8038e8:	00 00 00 
+  8038eb:	48 39 c2             	cmp    %rax,%rdx
+  8038ee:	0f 82 9f 00 00 00    	jb     803993 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8038f4:	48 85 db             	test   %rbx,%rbx
+  8038f7:	0f 85 8a fe ff ff    	jne    803787 <mmap+0x137>
+        return -E_NO_MEM;
+  8038fd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803903:	e9 3c ff ff ff       	jmp    803844 <mmap+0x1f4>
+        if (n < 0) {
+  803908:	0f 89 2c ff ff ff    	jns    80383a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80390e:	49 8b 3e             	mov    (%r14),%rdi
+  803911:	4c 89 ee             	mov    %r13,%rsi
+  803914:	48 b8 d3 34 80 00 00 	movabs $0x8034d3,%rax
+  80391b:	00 00 00 
+  80391e:	ff d0                	call   *%rax
+            return n;
+  803920:	45 89 e7             	mov    %r12d,%r15d
+  803923:	e9 1c ff ff ff       	jmp    803844 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803928:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80392e:	e9 11 ff ff ff       	jmp    803844 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803933:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803939:	e9 06 ff ff ff       	jmp    803844 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80393e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803944:	e9 fb fe ff ff       	jmp    803844 <mmap+0x1f4>
+  803949:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80394f:	e9 f0 fe ff ff       	jmp    803844 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803954:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80395a:	e9 e5 fe ff ff       	jmp    803844 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80395f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803965:	e9 da fe ff ff       	jmp    803844 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80396a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803970:	e9 cf fe ff ff       	jmp    803844 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803975:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80397b:	e9 c4 fe ff ff       	jmp    803844 <mmap+0x1f4>
+  803980:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803986:	e9 b9 fe ff ff       	jmp    803844 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80398b:	41 89 c7             	mov    %eax,%r15d
+  80398e:	e9 b1 fe ff ff       	jmp    803844 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803993:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803999:	e9 a6 fe ff ff       	jmp    803844 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80399e:	41 89 c7             	mov    %eax,%r15d
+  8039a1:	e9 9e fe ff ff       	jmp    803844 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039a6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039ac:	e9 93 fe ff ff       	jmp    803844 <mmap+0x1f4>
+
+00000000008039b1 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039b1:	55                   	push   %rbp
+  8039b2:	48 89 e5             	mov    %rsp,%rbp
+  8039b5:	41 54                	push   %r12
+  8039b7:	53                   	push   %rbx
+  8039b8:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039bb:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  8039c2:	00 00 00 
+  8039c5:	ff d0                	call   *%rax
+  8039c7:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039ca:	48 be e0 4e 80 00 00 	movabs $0x804ee0,%rsi
+  8039d1:	00 00 00 
+  8039d4:	48 89 df             	mov    %rbx,%rdi
+  8039d7:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  8039de:	00 00 00 
+  8039e1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039e3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039e8:	41 2b 04 24          	sub    (%r12),%eax
+  8039ec:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039f2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039f9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039fc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  803a03:	00 00 00 
+  803a06:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a12:	5b                   	pop    %rbx
+  803a13:	41 5c                	pop    %r12
+  803a15:	5d                   	pop    %rbp
+  803a16:	c3                   	ret
+
+0000000000803a17 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a17:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a1a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a20:	8b 17                	mov    (%rdi),%edx
+  803a22:	85 d2                	test   %edx,%edx
+  803a24:	75 01                	jne    803a27 <pipe_wakeup+0x10>
+  803a26:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a27:	55                   	push   %rbp
+  803a28:	48 89 e5             	mov    %rsp,%rbp
+  803a2b:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a2e:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a34:	be 00 04 00 00       	mov    $0x400,%esi
+  803a39:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  803a40:	00 00 00 
+  803a43:	ff d0                	call   *%rax
+}
+  803a45:	5d                   	pop    %rbp
+  803a46:	c3                   	ret
+
+0000000000803a47 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a47:	55                   	push   %rbp
+  803a48:	48 89 e5             	mov    %rsp,%rbp
+  803a4b:	41 55                	push   %r13
+  803a4d:	41 54                	push   %r12
+  803a4f:	53                   	push   %rbx
+  803a50:	48 83 ec 08          	sub    $0x8,%rsp
+  803a54:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a57:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803a5e:	00 00 00 
+  803a61:	ff d0                	call   *%rax
+  803a63:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a66:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a6b:	4c 89 e6             	mov    %r12,%rsi
+  803a6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a73:	49 bc 5d 12 80 00 00 	movabs $0x80125d,%r12
+  803a7a:	00 00 00 
+  803a7d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a80:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a84:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a88:	49 bd 17 3a 80 00 00 	movabs $0x803a17,%r13
+  803a8f:	00 00 00 
+  803a92:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a95:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a99:	48 89 de             	mov    %rbx,%rsi
+  803a9c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803a9f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aa4:	48 89 de             	mov    %rbx,%rsi
+  803aa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aac:	41 ff d4             	call   *%r12
+  803aaf:	48 83 c4 08          	add    $0x8,%rsp
+  803ab3:	5b                   	pop    %rbx
+  803ab4:	41 5c                	pop    %r12
+  803ab6:	41 5d                	pop    %r13
+  803ab8:	5d                   	pop    %rbp
+  803ab9:	c3                   	ret
+
+0000000000803aba <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803aba:	55                   	push   %rbp
+  803abb:	48 89 e5             	mov    %rsp,%rbp
+  803abe:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ac1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ac6:	be 00 10 00 00       	mov    $0x1000,%esi
+  803acb:	48 b8 a0 11 80 00 00 	movabs $0x8011a0,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+  803ad7:	85 c0                	test   %eax,%eax
+  803ad9:	0f 94 c0             	sete   %al
+  803adc:	0f b6 c0             	movzbl %al,%eax
+}
+  803adf:	5d                   	pop    %rbp
+  803ae0:	c3                   	ret
+
+0000000000803ae1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ae1:	55                   	push   %rbp
+  803ae2:	48 89 e5             	mov    %rsp,%rbp
+  803ae5:	41 57                	push   %r15
+  803ae7:	41 56                	push   %r14
+  803ae9:	41 55                	push   %r13
+  803aeb:	41 54                	push   %r12
+  803aed:	53                   	push   %rbx
+  803aee:	48 83 ec 38          	sub    $0x38,%rsp
+  803af2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803af6:	49 89 f4             	mov    %rsi,%r12
+  803af9:	49 89 d7             	mov    %rdx,%r15
+  803afc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b00:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803b07:	00 00 00 
+  803b0a:	ff d0                	call   *%rax
+  803b0c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b0f:	4d 85 ff             	test   %r15,%r15
+  803b12:	0f 84 f1 00 00 00    	je     803c09 <devpipe_write+0x128>
+  803b18:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b1c:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b20:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b24:	49 bd ba 3a 80 00 00 	movabs $0x803aba,%r13
+  803b2b:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b2e:	49 bf 17 3a 80 00 00 	movabs $0x803a17,%r15
+  803b35:	00 00 00 
+  803b38:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b40:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b44:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b47:	48 63 ce             	movslq %esi,%rcx
+  803b4a:	48 63 03             	movslq (%rbx),%rax
+  803b4d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b53:	48 39 c1             	cmp    %rax,%rcx
+  803b56:	72 64                	jb     803bbc <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b58:	48 89 de             	mov    %rbx,%rsi
+  803b5b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b5f:	41 ff d5             	call   *%r13
+  803b62:	85 c0                	test   %eax,%eax
+  803b64:	0f 85 b9 00 00 00    	jne    803c23 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b6a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b6e:	4c 89 f7             	mov    %r14,%rdi
+  803b71:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b74:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b77:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b7e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b85:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b8b:	8b 03                	mov    (%rbx),%eax
+  803b8d:	41 39 c4             	cmp    %eax,%r12d
+  803b90:	75 b2                	jne    803b44 <devpipe_write+0x63>
+  803b92:	48 89 de             	mov    %rbx,%rsi
+  803b95:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b99:	41 ff d5             	call   *%r13
+  803b9c:	85 c0                	test   %eax,%eax
+  803b9e:	75 a0                	jne    803b40 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803ba0:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803ba5:	44 89 e6             	mov    %r12d,%esi
+  803ba8:	48 89 df             	mov    %rbx,%rdi
+  803bab:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+  803bb7:	e9 7c ff ff ff       	jmp    803b38 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bbc:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bc0:	41 0f b6 38          	movzbl (%r8),%edi
+  803bc4:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bcb:	80 80 80 
+  803bce:	48 89 c8             	mov    %rcx,%rax
+  803bd1:	48 f7 e2             	mul    %rdx
+  803bd4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bd8:	48 89 d0             	mov    %rdx,%rax
+  803bdb:	48 c1 e0 08          	shl    $0x8,%rax
+  803bdf:	48 29 d0             	sub    %rdx,%rax
+  803be2:	48 c1 e0 04          	shl    $0x4,%rax
+  803be6:	48 29 c1             	sub    %rax,%rcx
+  803be9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803bee:	83 c6 01             	add    $0x1,%esi
+  803bf1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bf4:	49 83 c0 01          	add    $0x1,%r8
+  803bf8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803bfc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c00:	49 39 c0             	cmp    %rax,%r8
+  803c03:	0f 85 2f ff ff ff    	jne    803b38 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c09:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c0d:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c11:	48 b8 17 3a 80 00 00 	movabs $0x803a17,%rax
+  803c18:	00 00 00 
+  803c1b:	ff d0                	call   *%rax
+    return n;
+  803c1d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c21:	eb 05                	jmp    803c28 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c23:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c28:	48 83 c4 38          	add    $0x38,%rsp
+  803c2c:	5b                   	pop    %rbx
+  803c2d:	41 5c                	pop    %r12
+  803c2f:	41 5d                	pop    %r13
+  803c31:	41 5e                	pop    %r14
+  803c33:	41 5f                	pop    %r15
+  803c35:	5d                   	pop    %rbp
+  803c36:	c3                   	ret
+
+0000000000803c37 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c37:	55                   	push   %rbp
+  803c38:	48 89 e5             	mov    %rsp,%rbp
+  803c3b:	41 57                	push   %r15
+  803c3d:	41 56                	push   %r14
+  803c3f:	41 55                	push   %r13
+  803c41:	41 54                	push   %r12
+  803c43:	53                   	push   %rbx
+  803c44:	48 83 ec 28          	sub    $0x28,%rsp
+  803c48:	49 89 fd             	mov    %rdi,%r13
+  803c4b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c4f:	49 89 d4             	mov    %rdx,%r12
+  803c52:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c56:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803c5d:	00 00 00 
+  803c60:	ff d0                	call   *%rax
+  803c62:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c65:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c6b:	49 bf ba 3a 80 00 00 	movabs $0x803aba,%r15
+  803c72:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c75:	4d 85 e4             	test   %r12,%r12
+  803c78:	0f 84 d5 00 00 00    	je     803d53 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c7e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c82:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c86:	8b 03                	mov    (%rbx),%eax
+  803c88:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c8b:	75 7a                	jne    803d07 <devpipe_read+0xd0>
+            if (i > 0) {
+  803c8d:	4d 85 f6             	test   %r14,%r14
+  803c90:	75 50                	jne    803ce2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c92:	48 89 de             	mov    %rbx,%rsi
+  803c95:	4c 89 ef             	mov    %r13,%rdi
+  803c98:	41 ff d7             	call   *%r15
+  803c9b:	85 c0                	test   %eax,%eax
+  803c9d:	0f 85 c9 00 00 00    	jne    803d6c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ca3:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803ca6:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cad:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cb3:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cb6:	41 39 c4             	cmp    %eax,%r12d
+  803cb9:	75 cb                	jne    803c86 <devpipe_read+0x4f>
+  803cbb:	48 89 de             	mov    %rbx,%rsi
+  803cbe:	4c 89 ef             	mov    %r13,%rdi
+  803cc1:	41 ff d7             	call   *%r15
+  803cc4:	85 c0                	test   %eax,%eax
+  803cc6:	75 be                	jne    803c86 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cc8:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803ccd:	44 89 e6             	mov    %r12d,%esi
+  803cd0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cd4:	48 b8 25 15 80 00 00 	movabs $0x801525,%rax
+  803cdb:	00 00 00 
+  803cde:	ff d0                	call   *%rax
+  803ce0:	eb a4                	jmp    803c86 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ce2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ce6:	48 89 de             	mov    %rbx,%rsi
+  803ce9:	48 b8 17 3a 80 00 00 	movabs $0x803a17,%rax
+  803cf0:	00 00 00 
+  803cf3:	ff d0                	call   *%rax
+                return i;
+  803cf5:	4c 89 f0             	mov    %r14,%rax
+}
+  803cf8:	48 83 c4 28          	add    $0x28,%rsp
+  803cfc:	5b                   	pop    %rbx
+  803cfd:	41 5c                	pop    %r12
+  803cff:	41 5d                	pop    %r13
+  803d01:	41 5e                	pop    %r14
+  803d03:	41 5f                	pop    %r15
+  803d05:	5d                   	pop    %rbp
+  803d06:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d07:	48 63 c8             	movslq %eax,%rcx
+  803d0a:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d11:	80 80 80 
+  803d14:	48 89 c8             	mov    %rcx,%rax
+  803d17:	48 f7 e2             	mul    %rdx
+  803d1a:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d1e:	48 89 d0             	mov    %rdx,%rax
+  803d21:	48 c1 e0 08          	shl    $0x8,%rax
+  803d25:	48 29 d0             	sub    %rdx,%rax
+  803d28:	48 c1 e0 04          	shl    $0x4,%rax
+  803d2c:	48 89 c2             	mov    %rax,%rdx
+  803d2f:	48 89 c8             	mov    %rcx,%rax
+  803d32:	48 29 d0             	sub    %rdx,%rax
+  803d35:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d3a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d3e:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d42:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d45:	49 83 c6 01          	add    $0x1,%r14
+  803d49:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d4d:	0f 85 2b ff ff ff    	jne    803c7e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d53:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d57:	48 89 de             	mov    %rbx,%rsi
+  803d5a:	48 b8 17 3a 80 00 00 	movabs $0x803a17,%rax
+  803d61:	00 00 00 
+  803d64:	ff d0                	call   *%rax
+    return n;
+  803d66:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d6a:	eb 8c                	jmp    803cf8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d71:	eb 85                	jmp    803cf8 <devpipe_read+0xc1>
+
+0000000000803d73 <pipe>:
+pipe(int pfd[2]) {
+  803d73:	55                   	push   %rbp
+  803d74:	48 89 e5             	mov    %rsp,%rbp
+  803d77:	41 55                	push   %r13
+  803d79:	41 54                	push   %r12
+  803d7b:	53                   	push   %rbx
+  803d7c:	48 83 ec 18          	sub    $0x18,%rsp
+  803d80:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d83:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d87:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+  803d93:	89 c3                	mov    %eax,%ebx
+  803d95:	85 c0                	test   %eax,%eax
+  803d97:	0f 88 a0 01 00 00    	js     803f3d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d9d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803da2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dab:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db0:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  803db7:	00 00 00 
+  803dba:	ff d0                	call   *%rax
+  803dbc:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803dbe:	85 c0                	test   %eax,%eax
+  803dc0:	0f 88 77 01 00 00    	js     803f3d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dc6:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dca:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  803dd1:	00 00 00 
+  803dd4:	ff d0                	call   *%rax
+  803dd6:	89 c3                	mov    %eax,%ebx
+  803dd8:	85 c0                	test   %eax,%eax
+  803dda:	0f 88 43 01 00 00    	js     803f23 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803de0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803de5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dea:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803dee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df3:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  803dfa:	00 00 00 
+  803dfd:	ff d0                	call   *%rax
+  803dff:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e01:	85 c0                	test   %eax,%eax
+  803e03:	0f 88 1a 01 00 00    	js     803f23 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e09:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e0d:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803e14:	00 00 00 
+  803e17:	ff d0                	call   *%rax
+  803e19:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e1c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e26:	48 89 c6             	mov    %rax,%rsi
+  803e29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e2e:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  803e35:	00 00 00 
+  803e38:	ff d0                	call   *%rax
+  803e3a:	89 c3                	mov    %eax,%ebx
+  803e3c:	85 c0                	test   %eax,%eax
+  803e3e:	0f 88 c5 00 00 00    	js     803f09 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e44:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e48:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803e4f:	00 00 00 
+  803e52:	ff d0                	call   *%rax
+  803e54:	48 89 c1             	mov    %rax,%rcx
+  803e57:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e5d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e63:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e68:	4c 89 ee             	mov    %r13,%rsi
+  803e6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e70:	48 b8 0d 12 80 00 00 	movabs $0x80120d,%rax
+  803e77:	00 00 00 
+  803e7a:	ff d0                	call   *%rax
+  803e7c:	89 c3                	mov    %eax,%ebx
+  803e7e:	85 c0                	test   %eax,%eax
+  803e80:	78 6e                	js     803ef0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e82:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e87:	4c 89 ef             	mov    %r13,%rdi
+  803e8a:	48 b8 7c 11 80 00 00 	movabs $0x80117c,%rax
+  803e91:	00 00 00 
+  803e94:	ff d0                	call   *%rax
+  803e96:	83 f8 02             	cmp    $0x2,%eax
+  803e99:	0f 85 ab 00 00 00    	jne    803f4a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e9f:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803ea6:	00 00 
+  803ea8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eac:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803eae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eb2:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803eb9:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ebd:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ebf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ec3:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803eca:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ece:	48 bb b7 18 80 00 00 	movabs $0x8018b7,%rbx
+  803ed5:	00 00 00 
+  803ed8:	ff d3                	call   *%rbx
+  803eda:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ede:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ee2:	ff d3                	call   *%rbx
+  803ee4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ee9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803eee:	eb 4d                	jmp    803f3d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ef0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ef5:	4c 89 ee             	mov    %r13,%rsi
+  803ef8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803efd:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  803f04:	00 00 00 
+  803f07:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f0e:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f12:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f17:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  803f1e:	00 00 00 
+  803f21:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f23:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f28:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f2c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f31:	48 b8 5d 12 80 00 00 	movabs $0x80125d,%rax
+  803f38:	00 00 00 
+  803f3b:	ff d0                	call   *%rax
+}
+  803f3d:	89 d8                	mov    %ebx,%eax
+  803f3f:	48 83 c4 18          	add    $0x18,%rsp
+  803f43:	5b                   	pop    %rbx
+  803f44:	41 5c                	pop    %r12
+  803f46:	41 5d                	pop    %r13
+  803f48:	5d                   	pop    %rbp
+  803f49:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f4a:	48 b9 f8 4e 80 00 00 	movabs $0x804ef8,%rcx
+  803f51:	00 00 00 
+  803f54:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  803f5b:	00 00 00 
+  803f5e:	be 50 00 00 00       	mov    $0x50,%esi
+  803f63:	48 bf e7 4e 80 00 00 	movabs $0x804ee7,%rdi
+  803f6a:	00 00 00 
+  803f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f72:	49 b8 e3 01 80 00 00 	movabs $0x8001e3,%r8
+  803f79:	00 00 00 
+  803f7c:	41 ff d0             	call   *%r8
+
+0000000000803f7f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f7f:	55                   	push   %rbp
+  803f80:	48 89 e5             	mov    %rsp,%rbp
+  803f83:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f87:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f8b:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  803f92:	00 00 00 
+  803f95:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f97:	85 c0                	test   %eax,%eax
+  803f99:	78 23                	js     803fbe <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f9b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f9f:	48 b8 c9 18 80 00 00 	movabs $0x8018c9,%rax
+  803fa6:	00 00 00 
+  803fa9:	ff d0                	call   *%rax
+  803fab:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fae:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fb2:	48 b8 ba 3a 80 00 00 	movabs $0x803aba,%rax
+  803fb9:	00 00 00 
+  803fbc:	ff d0                	call   *%rax
+}
+  803fbe:	c9                   	leave
+  803fbf:	c3                   	ret
+
+0000000000803fc0 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fc0:	48 89 f8             	mov    %rdi,%rax
+  803fc3:	48 c1 e8 27          	shr    $0x27,%rax
+  803fc7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fce:	01 00 00 
+  803fd1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fd5:	f6 c2 01             	test   $0x1,%dl
+  803fd8:	74 6d                	je     804047 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fda:	48 89 f8             	mov    %rdi,%rax
+  803fdd:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fe1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fe8:	01 00 00 
+  803feb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fef:	f6 c2 01             	test   $0x1,%dl
+  803ff2:	74 62                	je     804056 <get_uvpt_entry+0x96>
+  803ff4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ffb:	01 00 00 
+  803ffe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804002:	f6 c2 80             	test   $0x80,%dl
+  804005:	75 4f                	jne    804056 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804007:	48 89 f8             	mov    %rdi,%rax
+  80400a:	48 c1 e8 15          	shr    $0x15,%rax
+  80400e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804015:	01 00 00 
+  804018:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80401c:	f6 c2 01             	test   $0x1,%dl
+  80401f:	74 44                	je     804065 <get_uvpt_entry+0xa5>
+  804021:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804028:	01 00 00 
+  80402b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80402f:	f6 c2 80             	test   $0x80,%dl
+  804032:	75 31                	jne    804065 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804034:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804038:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80403f:	01 00 00 
+  804042:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804046:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804047:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80404e:	01 00 00 
+  804051:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804055:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804056:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80405d:	01 00 00 
+  804060:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804064:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804065:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80406c:	01 00 00 
+  80406f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804073:	c3                   	ret
+
+0000000000804074 <get_prot>:
+
+int
+get_prot(void *va) {
+  804074:	55                   	push   %rbp
+  804075:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804078:	48 b8 c0 3f 80 00 00 	movabs $0x803fc0,%rax
+  80407f:	00 00 00 
+  804082:	ff d0                	call   *%rax
+  804084:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804087:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80408c:	89 c1                	mov    %eax,%ecx
+  80408e:	83 c9 04             	or     $0x4,%ecx
+  804091:	f6 c2 01             	test   $0x1,%dl
+  804094:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804097:	89 c1                	mov    %eax,%ecx
+  804099:	83 c9 02             	or     $0x2,%ecx
+  80409c:	f6 c2 02             	test   $0x2,%dl
+  80409f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040a2:	89 c1                	mov    %eax,%ecx
+  8040a4:	83 c9 01             	or     $0x1,%ecx
+  8040a7:	48 85 d2             	test   %rdx,%rdx
+  8040aa:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040ad:	89 c1                	mov    %eax,%ecx
+  8040af:	83 c9 40             	or     $0x40,%ecx
+  8040b2:	f6 c6 04             	test   $0x4,%dh
+  8040b5:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040b8:	5d                   	pop    %rbp
+  8040b9:	c3                   	ret
+
+00000000008040ba <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040ba:	55                   	push   %rbp
+  8040bb:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040be:	48 b8 c0 3f 80 00 00 	movabs $0x803fc0,%rax
+  8040c5:	00 00 00 
+  8040c8:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040ca:	48 c1 e8 06          	shr    $0x6,%rax
+  8040ce:	83 e0 01             	and    $0x1,%eax
+}
+  8040d1:	5d                   	pop    %rbp
+  8040d2:	c3                   	ret
+
+00000000008040d3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040d3:	55                   	push   %rbp
+  8040d4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040d7:	48 b8 c0 3f 80 00 00 	movabs $0x803fc0,%rax
+  8040de:	00 00 00 
+  8040e1:	ff d0                	call   *%rax
+  8040e3:	83 e0 01             	and    $0x1,%eax
+}
+  8040e6:	5d                   	pop    %rbp
+  8040e7:	c3                   	ret
+
+00000000008040e8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8040e8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8040ef:	01 00 00 
+  8040f2:	a8 01                	test   $0x1,%al
+  8040f4:	75 06                	jne    8040fc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8040f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040fb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040fc:	55                   	push   %rbp
+  8040fd:	48 89 e5             	mov    %rsp,%rbp
+  804100:	41 57                	push   %r15
+  804102:	41 56                	push   %r14
+  804104:	41 55                	push   %r13
+  804106:	41 54                	push   %r12
+  804108:	53                   	push   %rbx
+  804109:	48 83 ec 28          	sub    $0x28,%rsp
+  80410d:	49 89 fe             	mov    %rdi,%r14
+  804110:	49 89 f7             	mov    %rsi,%r15
+  804113:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  80411a:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80411b:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804122:	01 00 00 
+  804125:	e9 ae 00 00 00       	jmp    8041d8 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80412a:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804131:	49 83 ec 01          	sub    $0x1,%r12
+  804135:	74 2d                	je     804164 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804137:	48 89 d8             	mov    %rbx,%rax
+  80413a:	48 c1 e8 0c          	shr    $0xc,%rax
+  80413e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804143:	f6 c2 01             	test   $0x1,%dl
+  804146:	74 e2                	je     80412a <foreach_shared_region+0x42>
+  804148:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80414d:	f6 c4 04             	test   $0x4,%ah
+  804150:	74 d8                	je     80412a <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804152:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804159:	4c 89 fa             	mov    %r15,%rdx
+  80415c:	48 89 df             	mov    %rbx,%rdi
+  80415f:	41 ff d6             	call   *%r14
+  804162:	eb c6                	jmp    80412a <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804164:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80416b:	00 
+  80416c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804171:	74 4a                	je     8041bd <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804173:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804177:	48 c1 e8 15          	shr    $0x15,%rax
+  80417b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804182:	01 00 00 
+  804185:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804189:	a8 01                	test   $0x1,%al
+  80418b:	74 d7                	je     804164 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80418d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804191:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804198:	48 39 c3             	cmp    %rax,%rbx
+  80419b:	73 c7                	jae    804164 <foreach_shared_region+0x7c>
+  80419d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041a4:	48 39 d0             	cmp    %rdx,%rax
+  8041a7:	4d 19 e4             	sbb    %r12,%r12
+  8041aa:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041b1:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041b8:	e9 7a ff ff ff       	jmp    804137 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041bd:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041c4:	40 
+  8041c5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041c9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041d0:	00 00 00 
+  8041d3:	48 39 c1             	cmp    %rax,%rcx
+  8041d6:	74 50                	je     804228 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041d8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041dc:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041e0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8041e7:	01 00 00 
+  8041ea:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041ee:	a8 01                	test   $0x1,%al
+  8041f0:	74 cb                	je     8041bd <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8041f2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041f6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8041fd:	48 39 c1             	cmp    %rax,%rcx
+  804200:	73 bb                	jae    8041bd <foreach_shared_region+0xd5>
+  804202:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804209:	48 39 d0             	cmp    %rdx,%rax
+  80420c:	48 19 c0             	sbb    %rax,%rax
+  80420f:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804215:	48 05 00 02 00 00    	add    $0x200,%rax
+  80421b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80421f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804223:	e9 4b ff ff ff       	jmp    804173 <foreach_shared_region+0x8b>
+  804228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422d:	48 83 c4 28          	add    $0x28,%rsp
+  804231:	5b                   	pop    %rbx
+  804232:	41 5c                	pop    %r12
+  804234:	41 5d                	pop    %r13
+  804236:	41 5e                	pop    %r14
+  804238:	41 5f                	pop    %r15
+  80423a:	5d                   	pop    %rbp
+  80423b:	c3                   	ret
+
+000000000080423c <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80423c:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804242:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804249:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804250:	c3                   	ret
+
+0000000000804251 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804251:	8b 47 40             	mov    0x40(%rdi),%eax
+  804254:	8b 17                	mov    (%rdi),%edx
+  804256:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804258:	83 f8 0f             	cmp    $0xf,%eax
+  80425b:	77 13                	ja     804270 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80425d:	8b 47 40             	mov    0x40(%rdi),%eax
+  804260:	83 e0 0f             	and    $0xf,%eax
+  804263:	48 c1 e0 09          	shl    $0x9,%rax
+  804267:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80426e:	00 
+  80426f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804270:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804275:	c3                   	ret
+
+0000000000804276 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804276:	8b 47 40             	mov    0x40(%rdi),%eax
+  804279:	83 c0 01             	add    $0x1,%eax
+  80427c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80427f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804285:	8b 57 04             	mov    0x4(%rdi),%edx
+  804288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428d:	85 d2                	test   %edx,%edx
+  80428f:	75 04                	jne    804295 <chan_publish+0x1f>
+  804291:	83 e0 01             	and    $0x1,%eax
+}
+  804294:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804295:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804298:	85 c0                	test   %eax,%eax
+  80429a:	0f 95 c0             	setne  %al
+  80429d:	0f b6 c0             	movzbl %al,%eax
+  8042a0:	eb ef                	jmp    804291 <chan_publish+0x1b>
+
+00000000008042a2 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042a2:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042a5:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042a7:	29 d0                	sub    %edx,%eax
+  8042a9:	83 e8 01             	sub    $0x1,%eax
+  8042ac:	83 f8 0f             	cmp    $0xf,%eax
+  8042af:	77 12                	ja     8042c3 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042b1:	8b 07                	mov    (%rdi),%eax
+  8042b3:	83 e0 0f             	and    $0xf,%eax
+  8042b6:	48 c1 e0 09          	shl    $0x9,%rax
+  8042ba:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042c1:	00 
+  8042c2:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042c8:	c3                   	ret
+
+00000000008042c9 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042c9:	8b 07                	mov    (%rdi),%eax
+  8042cb:	83 c0 01             	add    $0x1,%eax
+  8042ce:	89 07                	mov    %eax,(%rdi)
+}
+  8042d0:	c3                   	ret
+
+00000000008042d1 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042d1:	55                   	push   %rbp
+  8042d2:	48 89 e5             	mov    %rsp,%rbp
+  8042d5:	53                   	push   %rbx
+  8042d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8042da:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8042dd:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042e4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8042ea:	48 b8 a2 42 80 00 00 	movabs $0x8042a2,%rax
+  8042f1:	00 00 00 
+  8042f4:	ff d0                	call   *%rax
+  8042f6:	48 85 c0             	test   %rax,%rax
+  8042f9:	74 12                	je     80430d <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8042fb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804302:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804307:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80430b:	c9                   	leave
+  80430c:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80430d:	b8 01 00 00 00       	mov    $0x1,%eax
+  804312:	eb f3                	jmp    804307 <chan_arm+0x36>
+
+0000000000804314 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804314:	55                   	push   %rbp
+  804315:	48 89 e5             	mov    %rsp,%rbp
+  804318:	41 56                	push   %r14
+  80431a:	41 55                	push   %r13
+  80431c:	41 54                	push   %r12
+  80431e:	53                   	push   %rbx
+  80431f:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804322:	49 bc d1 42 80 00 00 	movabs $0x8042d1,%r12
+  804329:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80432c:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804330:	49 bd 25 15 80 00 00 	movabs $0x801525,%r13
+  804337:	00 00 00 
+    while (chan_arm(r))
+  80433a:	eb 0d                	jmp    804349 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80433c:	8b 33                	mov    (%rbx),%esi
+  80433e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804343:	4c 89 f7             	mov    %r14,%rdi
+  804346:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804349:	48 89 df             	mov    %rbx,%rdi
+  80434c:	41 ff d4             	call   *%r12
+  80434f:	84 c0                	test   %al,%al
+  804351:	75 e9                	jne    80433c <chan_wait+0x28>
+}
+  804353:	5b                   	pop    %rbx
+  804354:	41 5c                	pop    %r12
+  804356:	41 5d                	pop    %r13
+  804358:	41 5e                	pop    %r14
+  80435a:	5d                   	pop    %rbp
+  80435b:	c3                   	ret
+
+000000000080435c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80435c:	55                   	push   %rbp
+  80435d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804360:	48 83 c7 40          	add    $0x40,%rdi
+  804364:	be 01 00 00 00       	mov    $0x1,%esi
+  804369:	48 b8 43 15 80 00 00 	movabs $0x801543,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+}
+  804375:	5d                   	pop    %rbp
+  804376:	c3                   	ret
+
+0000000000804377 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80437c:	c3                   	ret
+
+000000000080437d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80437d:	55                   	push   %rbp
+  80437e:	48 89 e5             	mov    %rsp,%rbp
+  804381:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804384:	48 be 1c 4f 80 00 00 	movabs $0x804f1c,%rsi
+  80438b:	00 00 00 
+  80438e:	48 b8 58 0c 80 00 00 	movabs $0x800c58,%rax
+  804395:	00 00 00 
+  804398:	ff d0                	call   *%rax
+    return 0;
+}
+  80439a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439f:	5d                   	pop    %rbp
+  8043a0:	c3                   	ret
+
+00000000008043a1 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043a1:	55                   	push   %rbp
+  8043a2:	48 89 e5             	mov    %rsp,%rbp
+  8043a5:	41 57                	push   %r15
+  8043a7:	41 56                	push   %r14
+  8043a9:	41 55                	push   %r13
+  8043ab:	41 54                	push   %r12
+  8043ad:	53                   	push   %rbx
+  8043ae:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043b5:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043bc:	48 85 d2             	test   %rdx,%rdx
+  8043bf:	74 7a                	je     80443b <devcons_write+0x9a>
+  8043c1:	49 89 d6             	mov    %rdx,%r14
+  8043c4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043ca:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043cf:	49 bf 52 0e 80 00 00 	movabs $0x800e52,%r15
+  8043d6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043d9:	4c 89 f3             	mov    %r14,%rbx
+  8043dc:	48 29 f3             	sub    %rsi,%rbx
+  8043df:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043e4:	48 39 c3             	cmp    %rax,%rbx
+  8043e7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8043eb:	4c 63 eb             	movslq %ebx,%r13
+  8043ee:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8043f5:	48 01 c6             	add    %rax,%rsi
+  8043f8:	4c 89 ea             	mov    %r13,%rdx
+  8043fb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804402:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804405:	4c 89 ee             	mov    %r13,%rsi
+  804408:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80440f:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  804416:	00 00 00 
+  804419:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80441b:	41 01 dc             	add    %ebx,%r12d
+  80441e:	49 63 f4             	movslq %r12d,%rsi
+  804421:	4c 39 f6             	cmp    %r14,%rsi
+  804424:	72 b3                	jb     8043d9 <devcons_write+0x38>
+    return res;
+  804426:	49 63 c4             	movslq %r12d,%rax
+}
+  804429:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804430:	5b                   	pop    %rbx
+  804431:	41 5c                	pop    %r12
+  804433:	41 5d                	pop    %r13
+  804435:	41 5e                	pop    %r14
+  804437:	41 5f                	pop    %r15
+  804439:	5d                   	pop    %rbp
+  80443a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80443b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804441:	eb e3                	jmp    804426 <devcons_write+0x85>
+
+0000000000804443 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804443:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804446:	ba 00 00 00 00       	mov    $0x0,%edx
+  80444b:	48 85 c0             	test   %rax,%rax
+  80444e:	74 55                	je     8044a5 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804450:	55                   	push   %rbp
+  804451:	48 89 e5             	mov    %rsp,%rbp
+  804454:	41 55                	push   %r13
+  804456:	41 54                	push   %r12
+  804458:	53                   	push   %rbx
+  804459:	48 83 ec 08          	sub    $0x8,%rsp
+  80445d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804460:	48 bb 9e 10 80 00 00 	movabs $0x80109e,%rbx
+  804467:	00 00 00 
+  80446a:	49 bc 53 11 80 00 00 	movabs $0x801153,%r12
+  804471:	00 00 00 
+  804474:	eb 03                	jmp    804479 <devcons_read+0x36>
+  804476:	41 ff d4             	call   *%r12
+  804479:	ff d3                	call   *%rbx
+  80447b:	85 c0                	test   %eax,%eax
+  80447d:	74 f7                	je     804476 <devcons_read+0x33>
+    if (c < 0) return c;
+  80447f:	48 63 d0             	movslq %eax,%rdx
+  804482:	78 13                	js     804497 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804484:	ba 00 00 00 00       	mov    $0x0,%edx
+  804489:	83 f8 04             	cmp    $0x4,%eax
+  80448c:	74 09                	je     804497 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80448e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804492:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804497:	48 89 d0             	mov    %rdx,%rax
+  80449a:	48 83 c4 08          	add    $0x8,%rsp
+  80449e:	5b                   	pop    %rbx
+  80449f:	41 5c                	pop    %r12
+  8044a1:	41 5d                	pop    %r13
+  8044a3:	5d                   	pop    %rbp
+  8044a4:	c3                   	ret
+  8044a5:	48 89 d0             	mov    %rdx,%rax
+  8044a8:	c3                   	ret
+
+00000000008044a9 <cputchar>:
+cputchar(int ch) {
+  8044a9:	55                   	push   %rbp
+  8044aa:	48 89 e5             	mov    %rsp,%rbp
+  8044ad:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044b1:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044b5:	be 01 00 00 00       	mov    $0x1,%esi
+  8044ba:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044be:	48 b8 7f 10 80 00 00 	movabs $0x80107f,%rax
+  8044c5:	00 00 00 
+  8044c8:	ff d0                	call   *%rax
+}
+  8044ca:	c9                   	leave
+  8044cb:	c3                   	ret
+
+00000000008044cc <getchar>:
+getchar(void) {
+  8044cc:	55                   	push   %rbp
+  8044cd:	48 89 e5             	mov    %rsp,%rbp
+  8044d0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044d4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044d9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044e2:	48 b8 28 1c 80 00 00 	movabs $0x801c28,%rax
+  8044e9:	00 00 00 
+  8044ec:	ff d0                	call   *%rax
+  8044ee:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8044f0:	85 c0                	test   %eax,%eax
+  8044f2:	78 06                	js     8044fa <getchar+0x2e>
+  8044f4:	74 08                	je     8044fe <getchar+0x32>
+  8044f6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8044fa:	89 d0                	mov    %edx,%eax
+  8044fc:	c9                   	leave
+  8044fd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8044fe:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804503:	eb f5                	jmp    8044fa <getchar+0x2e>
+
+0000000000804505 <iscons>:
+iscons(int fdnum) {
+  804505:	55                   	push   %rbp
+  804506:	48 89 e5             	mov    %rsp,%rbp
+  804509:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80450d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804511:	48 b8 45 19 80 00 00 	movabs $0x801945,%rax
+  804518:	00 00 00 
+  80451b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80451d:	85 c0                	test   %eax,%eax
+  80451f:	78 18                	js     804539 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804521:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804525:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80452c:	00 00 00 
+  80452f:	8b 00                	mov    (%rax),%eax
+  804531:	39 02                	cmp    %eax,(%rdx)
+  804533:	0f 94 c0             	sete   %al
+  804536:	0f b6 c0             	movzbl %al,%eax
+}
+  804539:	c9                   	leave
+  80453a:	c3                   	ret
+
+000000000080453b <opencons>:
+opencons(void) {
+  80453b:	55                   	push   %rbp
+  80453c:	48 89 e5             	mov    %rsp,%rbp
+  80453f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804543:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804547:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  80454e:	00 00 00 
+  804551:	ff d0                	call   *%rax
+  804553:	85 c0                	test   %eax,%eax
+  804555:	78 49                	js     8045a0 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804557:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80455c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804561:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804565:	bf 00 00 00 00       	mov    $0x0,%edi
+  80456a:	48 b8 b7 11 80 00 00 	movabs $0x8011b7,%rax
+  804571:	00 00 00 
+  804574:	ff d0                	call   *%rax
+  804576:	85 c0                	test   %eax,%eax
+  804578:	78 26                	js     8045a0 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80457a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80457e:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804585:	00 00 
+  804587:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804589:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80458d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804594:	48 b8 b7 18 80 00 00 	movabs $0x8018b7,%rax
+  80459b:	00 00 00 
+  80459e:	ff d0                	call   *%rax
+}
+  8045a0:	c9                   	leave
+  8045a1:	c3                   	ret
+
+00000000008045a2 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8045a2:	55                   	push   %rbp
+  8045a3:	48 89 e5             	mov    %rsp,%rbp
+  8045a6:	41 55                	push   %r13
+  8045a8:	41 54                	push   %r12
+  8045aa:	53                   	push   %rbx
+  8045ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8045af:	49 89 fd             	mov    %rdi,%r13
+  8045b2:	48 89 f7             	mov    %rsi,%rdi
+  8045b5:	48 89 d3             	mov    %rdx,%rbx
+  8045b8:	49 89 cc             	mov    %rcx,%r12
+  8045bb:	4c 89 c2             	mov    %r8,%rdx
+  8045be:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045c1:	48 85 f6             	test   %rsi,%rsi
+  8045c4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045cb:	00 00 00 
+  8045ce:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8045d2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8045d7:	48 85 db             	test   %rbx,%rbx
+  8045da:	74 03                	je     8045df <ipc_recv_futex+0x3d>
+  8045dc:	48 8b 33             	mov    (%rbx),%rsi
+  8045df:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8045e3:	48 b8 01 14 80 00 00 	movabs $0x801401,%rax
+  8045ea:	00 00 00 
+  8045ed:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045ef:	85 c0                	test   %eax,%eax
+  8045f1:	78 75                	js     804668 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8045f3:	4d 85 ed             	test   %r13,%r13
+  8045f6:	74 14                	je     80460c <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8045f8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045ff:	00 00 00 
+  804602:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804608:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80460c:	4d 85 e4             	test   %r12,%r12
+  80460f:	74 14                	je     804625 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804611:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804618:	00 00 00 
+  80461b:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804621:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804625:	48 85 db             	test   %rbx,%rbx
+  804628:	74 23                	je     80464d <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80462a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804631:	00 00 00 
+  804634:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80463a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80463f:	85 c9                	test   %ecx,%ecx
+  804641:	74 07                	je     80464a <ipc_recv_futex+0xa8>
+  804643:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80464a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80464d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804654:	00 00 00 
+  804657:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80465d:	48 83 c4 08          	add    $0x8,%rsp
+  804661:	5b                   	pop    %rbx
+  804662:	41 5c                	pop    %r12
+  804664:	41 5d                	pop    %r13
+  804666:	5d                   	pop    %rbp
+  804667:	c3                   	ret
+        if (from_env_store != NULL) {
+  804668:	4d 85 ed             	test   %r13,%r13
+  80466b:	74 08                	je     804675 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80466d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804674:	00 
+        if (perm_store != NULL) {
+  804675:	4d 85 e4             	test   %r12,%r12
+  804678:	74 08                	je     804682 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80467a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804681:	00 
+        if (size != NULL) {
+  804682:	48 85 db             	test   %rbx,%rbx
+  804685:	74 d6                	je     80465d <ipc_recv_futex+0xbb>
+            *size = 0;
+  804687:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80468e:	eb cd                	jmp    80465d <ipc_recv_futex+0xbb>
+
+0000000000804690 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804690:	55                   	push   %rbp
+  804691:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804694:	48 83 ec 08          	sub    $0x8,%rsp
+  804698:	6a 00                	push   $0x0
+  80469a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8046a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8046a6:	48 b8 a2 45 80 00 00 	movabs $0x8045a2,%rax
+  8046ad:	00 00 00 
+  8046b0:	ff d0                	call   *%rax
+}
+  8046b2:	c9                   	leave
+  8046b3:	c3                   	ret
+
+00000000008046b4 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8046b4:	55                   	push   %rbp
+  8046b5:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046b8:	48 85 d2             	test   %rdx,%rdx
+  8046bb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8046c2:	00 00 00 
+  8046c5:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8046c9:	89 f6                	mov    %esi,%esi
+  8046cb:	48 b8 ea 13 80 00 00 	movabs $0x8013ea,%rax
+  8046d2:	00 00 00 
+  8046d5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8046d7:	85 c0                	test   %eax,%eax
+  8046d9:	78 02                	js     8046dd <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8046db:	5d                   	pop    %rbp
+  8046dc:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8046dd:	89 c1                	mov    %eax,%ecx
+  8046df:	48 ba 28 4f 80 00 00 	movabs $0x804f28,%rdx
+  8046e6:	00 00 00 
+  8046e9:	be 50 00 00 00       	mov    $0x50,%esi
+  8046ee:	48 bf 3c 4f 80 00 00 	movabs $0x804f3c,%rdi
+  8046f5:	00 00 00 
+  8046f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fd:	49 b8 e3 01 80 00 00 	movabs $0x8001e3,%r8
+  804704:	00 00 00 
+  804707:	41 ff d0             	call   *%r8
+
+000000000080470a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80470a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80470f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804716:	00 00 00 
+  804719:	48 89 d0             	mov    %rdx,%rax
+  80471c:	48 c1 e0 04          	shl    $0x4,%rax
+  804720:	48 29 d0             	sub    %rdx,%rax
+  804723:	48 c1 e0 05          	shl    $0x5,%rax
+  804727:	48 01 c8             	add    %rcx,%rax
+  80472a:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804730:	39 f8                	cmp    %edi,%eax
+  804732:	74 13                	je     804747 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804734:	48 83 c2 01          	add    $0x1,%rdx
+  804738:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80473f:	75 d8                	jne    804719 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804741:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804746:	c3                   	ret
+            return envs[i].env_id;
+  804747:	48 89 d0             	mov    %rdx,%rax
+  80474a:	48 c1 e0 04          	shl    $0x4,%rax
+  80474e:	48 29 d0             	sub    %rdx,%rax
+  804751:	48 c1 e0 05          	shl    $0x5,%rax
+  804755:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80475c:	00 00 00 
+  80475f:	48 01 d0             	add    %rdx,%rax
+  804762:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804768:	c3                   	ret
+  804769:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804770 <__rodata_start>:
+  804770:	66 61                	data16 (bad)
+  804772:	75 6c                	jne    8047e0 <__rodata_start+0x70>
+  804774:	74 20                	je     804796 <__rodata_start+0x26>
+  804776:	25 6c 78 0a 00       	and    $0xa786c,%eax
+  80477b:	75 73                	jne    8047f0 <__rodata_start+0x80>
+  80477d:	65 72 2f             	gs jb  8047af <__rodata_start+0x3f>
+  804780:	66 61                	data16 (bad)
+  804782:	75 6c                	jne    8047f0 <__rodata_start+0x80>
+  804784:	74 61                	je     8047e7 <__rodata_start+0x77>
+  804786:	6c                   	insb   (%dx),%es:(%rdi)
+  804787:	6c                   	insb   (%dx),%es:(%rdi)
+  804788:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804789:	63 62 61             	movsxd 0x61(%rdx),%esp
+  80478c:	64 2e 63 00          	fs movsxd %fs:(%rax),%eax
+  804790:	61                   	(bad)
+  804791:	6c                   	insb   (%dx),%es:(%rdi)
+  804792:	6c                   	insb   (%dx),%es:(%rdi)
+  804793:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804794:	63 61 74             	movsxd 0x74(%rcx),%esp
+  804797:	69 6e 67 20 61 74 20 	imul   $0x20746120,0x67(%rsi),%ebp
+  80479e:	25 6c 78 20 69       	and    $0x6920786c,%eax
+  8047a3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047a4:	20 70 61             	and    %dh,0x61(%rax)
+  8047a7:	67 65 20 66 61       	and    %ah,%gs:0x61(%esi)
+  8047ac:	75 6c                	jne    80481a <__rodata_start+0xaa>
+  8047ae:	74 20                	je     8047d0 <__rodata_start+0x60>
+  8047b0:	68 61 6e 64 6c       	push   $0x6c646e61
+  8047b5:	65 72 3a             	gs jb  8047f2 <__rodata_start+0x82>
+  8047b8:	20 25 69 00 00 00    	and    %ah,0x69(%rip)        # 804827 <__rodata_start+0xb7>
+  8047be:	00 00                	add    %al,(%rax)
+  8047c0:	74 68                	je     80482a <__rodata_start+0xba>
+  8047c2:	69 73 20 73 74 72 69 	imul   $0x69727473,0x20(%rbx),%esi
+  8047c9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ca:	67 20 77 61          	and    %dh,0x61(%edi)
+  8047ce:	73 20                	jae    8047f0 <__rodata_start+0x80>
+  8047d0:	66 61                	data16 (bad)
+  8047d2:	75 6c                	jne    804840 <__rodata_start+0xd0>
+  8047d4:	74 65                	je     80483b <__rodata_start+0xcb>
+  8047d6:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  8047da:	20 61 74             	and    %ah,0x74(%rcx)
+  8047dd:	20 25 6c 78 00 3c    	and    %ah,0x3c00786c(%rip)        # 3c80c04f <__bss_end+0x3bfcb04f>
+  8047e3:	75 6e                	jne    804853 <__rodata_start+0xe3>
+  8047e5:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8047e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ea:	3e 00 0f             	ds add %cl,(%rdi)
+  8047ed:	1f                   	(bad)
+  8047ee:	40 00 5b 25          	rex add %bl,0x25(%rbx)
+  8047f2:	30 38                	xor    %bh,(%rax)
+  8047f4:	78 5d                	js     804853 <__rodata_start+0xe3>
+  8047f6:	20 75 73             	and    %dh,0x73(%rbp)
+  8047f9:	65 72 20             	gs jb  80481c <__rodata_start+0xac>
+  8047fc:	70 61                	jo     80485f <__rodata_start+0xef>
+  8047fe:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047ff:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804806:	73 20                	jae    804828 <__rodata_start+0xb8>
+  804808:	61                   	(bad)
+  804809:	74 20                	je     80482b <__rodata_start+0xbb>
+  80480b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804810:	3a 20                	cmp    (%rax),%ah
+  804812:	00 30                	add    %dh,(%rax)
+  804814:	31 32                	xor    %esi,(%rdx)
+  804816:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80481d:	41                   	rex.B
+  80481e:	42                   	rex.X
+  80481f:	43                   	rex.XB
+  804820:	44                   	rex.R
+  804821:	45                   	rex.RB
+  804822:	46 00 30             	rex.RX add %r14b,(%rax)
+  804825:	31 32                	xor    %esi,(%rdx)
+  804827:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80482e:	61                   	(bad)
+  80482f:	62 63 64 65 66       	(bad)
+  804834:	00 28                	add    %ch,(%rax)
+  804836:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804837:	75 6c                	jne    8048a5 <__rodata_start+0x135>
+  804839:	6c                   	insb   (%dx),%es:(%rdi)
+  80483a:	29 00                	sub    %eax,(%rax)
+  80483c:	65 72 72             	gs jb  8048b1 <__rodata_start+0x141>
+  80483f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804840:	72 20                	jb     804862 <__rodata_start+0xf2>
+  804842:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804847:	73 70                	jae    8048b9 <__rodata_start+0x149>
+  804849:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80484d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804854:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804855:	72 00                	jb     804857 <__rodata_start+0xe7>
+  804857:	62 61 64 20 65       	(bad)
+  80485c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80485d:	76 69                	jbe    8048c8 <__rodata_start+0x158>
+  80485f:	72 6f                	jb     8048d0 <__rodata_start+0x160>
+  804861:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804862:	6d                   	insl   (%dx),%es:(%rdi)
+  804863:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804865:	74 00                	je     804867 <__rodata_start+0xf7>
+  804867:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80486e:	20 70 61             	and    %dh,0x61(%rax)
+  804871:	72 61                	jb     8048d4 <__rodata_start+0x164>
+  804873:	6d                   	insl   (%dx),%es:(%rdi)
+  804874:	65 74 65             	gs je  8048dc <__rodata_start+0x16c>
+  804877:	72 00                	jb     804879 <__rodata_start+0x109>
+  804879:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80487a:	75 74                	jne    8048f0 <__rodata_start+0x180>
+  80487c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80487f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804882:	6d                   	insl   (%dx),%es:(%rdi)
+  804883:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804884:	72 79                	jb     8048ff <__rodata_start+0x18f>
+  804886:	00 6f 75             	add    %ch,0x75(%rdi)
+  804889:	74 20                	je     8048ab <__rodata_start+0x13b>
+  80488b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80488c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804890:	76 69                	jbe    8048fb <__rodata_start+0x18b>
+  804892:	72 6f                	jb     804903 <__rodata_start+0x193>
+  804894:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804895:	6d                   	insl   (%dx),%es:(%rdi)
+  804896:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804898:	74 73                	je     80490d <__rodata_start+0x19d>
+  80489a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80489d:	72 72                	jb     804911 <__rodata_start+0x1a1>
+  80489f:	75 70                	jne    804911 <__rodata_start+0x1a1>
+  8048a1:	74 65                	je     804908 <__rodata_start+0x198>
+  8048a3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8048a8:	75 67                	jne    804911 <__rodata_start+0x1a1>
+  8048aa:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8048ad:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048af:	00 73 65             	add    %dh,0x65(%rbx)
+  8048b2:	67 6d                	insl   (%dx),%es:(%edi)
+  8048b4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8048b6:	74 61                	je     804919 <__rodata_start+0x1a9>
+  8048b8:	74 69                	je     804923 <__rodata_start+0x1b3>
+  8048ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048bb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048bc:	20 66 61             	and    %ah,0x61(%rsi)
+  8048bf:	75 6c                	jne    80492d <__rodata_start+0x1bd>
+  8048c1:	74 00                	je     8048c3 <__rodata_start+0x153>
+  8048c3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8048ca:	20 45 4c             	and    %al,0x4c(%rbp)
+  8048cd:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8048d1:	61                   	(bad)
+  8048d2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8048d7:	20 73 75             	and    %dh,0x75(%rbx)
+  8048da:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8048dd:	73 79                	jae    804958 <__rodata_start+0x1e8>
+  8048df:	73 74                	jae    804955 <__rodata_start+0x1e5>
+  8048e1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8048e3:	20 63 61             	and    %ah,0x61(%rbx)
+  8048e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8048e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8048e8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8048eb:	74 72                	je     80495f <__rodata_start+0x1ef>
+  8048ed:	79 20                	jns    80490f <__rodata_start+0x19f>
+  8048ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048f0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048f1:	74 20                	je     804913 <__rodata_start+0x1a3>
+  8048f3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8048f5:	75 6e                	jne    804965 <__rodata_start+0x1f5>
+  8048f7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8048fb:	76 20                	jbe    80491d <__rodata_start+0x1ad>
+  8048fd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804904:	72 65                	jb     80496b <__rodata_start+0x1fb>
+  804906:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804909:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80490e:	65 78 70             	gs js  804981 <__rodata_start+0x211>
+  804911:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804916:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804919:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80491d:	20 66 69             	and    %ah,0x69(%rsi)
+  804920:	6c                   	insb   (%dx),%es:(%rdi)
+  804921:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804925:	20 66 72             	and    %ah,0x72(%rsi)
+  804928:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80492d:	61                   	(bad)
+  80492e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804931:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804932:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804933:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804937:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80493a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80493b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80493c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80493f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804940:	79 20                	jns    804962 <__rodata_start+0x1f2>
+  804942:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804949:	72 65                	jb     8049b0 <__rodata_start+0x240>
+  80494b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80494e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804950:	00 66 69             	add    %ah,0x69(%rsi)
+  804953:	6c                   	insb   (%dx),%es:(%rdi)
+  804954:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804958:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80495b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80495c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80495f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804960:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804961:	74 20                	je     804983 <__rodata_start+0x213>
+  804963:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804965:	75 6e                	jne    8049d5 <__rodata_start+0x265>
+  804967:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80496b:	76 61                	jbe    8049ce <__rodata_start+0x25e>
+  80496d:	6c                   	insb   (%dx),%es:(%rdi)
+  80496e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804975:	00 
+  804976:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80497d:	72 65                	jb     8049e4 <__rodata_start+0x274>
+  80497f:	61                   	(bad)
+  804980:	64 79 20             	fs jns 8049a3 <__rodata_start+0x233>
+  804983:	65 78 69             	gs js  8049ef <__rodata_start+0x27f>
+  804986:	73 74                	jae    8049fc <__rodata_start+0x28c>
+  804988:	73 00                	jae    80498a <__rodata_start+0x21a>
+  80498a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80498b:	70 65                	jo     8049f2 <__rodata_start+0x282>
+  80498d:	72 61                	jb     8049f0 <__rodata_start+0x280>
+  80498f:	74 69                	je     8049fa <__rodata_start+0x28a>
+  804991:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804992:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804993:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804996:	74 20                	je     8049b8 <__rodata_start+0x248>
+  804998:	73 75                	jae    804a0f <__rodata_start+0x29f>
+  80499a:	70 70                	jo     804a0c <__rodata_start+0x29c>
+  80499c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80499d:	72 74                	jb     804a13 <__rodata_start+0x2a3>
+  80499f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8049a5:	20 61 67             	and    %ah,0x67(%rcx)
+  8049a8:	61                   	(bad)
+  8049a9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8049b0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8049b4:	74 00                	je     8049b6 <__rodata_start+0x246>
+  8049b6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8049bd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049c0:	20 75 73             	and    %dh,0x73(%rbp)
+  8049c3:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8049c7:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8049ce:	00 
+  8049cf:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  8049d6:	00 00 00 
+  8049d9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  8049e0:	20 05 80 00 00 00    	and    %al,0x80(%rip)        # 804a66 <__rodata_start+0x2f6>
+  8049e6:	00 00                	add    %al,(%rax)
+  8049e8:	61                   	(bad)
+  8049e9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  8049ef:	00 51 0b             	add    %dl,0xb(%rcx)
+  8049f2:	80 00 00             	addb   $0x0,(%rax)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 61 0b             	add    %ah,0xb(%rcx)
+  8049fa:	80 00 00             	addb   $0x0,(%rax)
+  8049fd:	00 00                	add    %al,(%rax)
+  8049ff:	00 61 0b             	add    %ah,0xb(%rcx)
+  804a02:	80 00 00             	addb   $0x0,(%rax)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 61 0b             	add    %ah,0xb(%rcx)
+  804a0a:	80 00 00             	addb   $0x0,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804a12:	80 00 00             	addb   $0x0,(%rax)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 3f                	add    %bh,(%rdi)
+  804a19:	05 80 00 00 00       	add    $0x80,%eax
+  804a1e:	00 00                	add    %al,(%rax)
+  804a20:	61                   	(bad)
+  804a21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a27:	00 61 0b             	add    %ah,0xb(%rcx)
+  804a2a:	80 00 00             	addb   $0x0,(%rax)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 33                	add    %dh,(%rbx)
+  804a31:	05 80 00 00 00       	add    $0x80,%eax
+  804a36:	00 00                	add    %al,(%rax)
+  804a38:	ad                   	lods   %ds:(%rsi),%eax
+  804a39:	05 80 00 00 00       	add    $0x80,%eax
+  804a3e:	00 00                	add    %al,(%rax)
+  804a40:	61                   	(bad)
+  804a41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804a47:	00 33                	add    %dh,(%rbx)
+  804a49:	05 80 00 00 00       	add    $0x80,%eax
+  804a4e:	00 00                	add    %al,(%rax)
+  804a50:	79 05                	jns    804a57 <__rodata_start+0x2e7>
+  804a52:	80 00 00             	addb   $0x0,(%rax)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 79 05             	add    %bh,0x5(%rcx)
+  804a5a:	80 00 00             	addb   $0x0,(%rax)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 79 05             	add    %bh,0x5(%rcx)
+  804a62:	80 00 00             	addb   $0x0,(%rax)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 79 05             	add    %bh,0x5(%rcx)
+  804a6a:	80 00 00             	addb   $0x0,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 79 05             	add    %bh,0x5(%rcx)
+  804a72:	80 00 00             	addb   $0x0,(%rax)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 79 05             	add    %bh,0x5(%rcx)
+  804a7a:	80 00 00             	addb   $0x0,(%rax)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 79 05             	add    %bh,0x5(%rcx)
+  804a82:	80 00 00             	addb   $0x0,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 79 05             	add    %bh,0x5(%rcx)
+  804a8a:	80 00 00             	addb   $0x0,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 79 05             	add    %bh,0x5(%rcx)
+  804a92:	80 00 00             	addb   $0x0,(%rax)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 61 0b             	add    %ah,0xb(%rcx)
+  804a9a:	80 00 00             	addb   $0x0,(%rax)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804aa2:	80 00 00             	addb   $0x0,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ab2:	80 00 00             	addb   $0x0,(%rax)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804aba:	80 00 00             	addb   $0x0,(%rax)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ac2:	80 00 00             	addb   $0x0,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ad2:	80 00 00             	addb   $0x0,(%rax)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ada:	80 00 00             	addb   $0x0,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 61 0b             	add    %ah,0xb(%rcx)
+  804af2:	80 00 00             	addb   $0x0,(%rax)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804afa:	80 00 00             	addb   $0x0,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b0a:	80 00 00             	addb   $0x0,(%rax)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b12:	80 00 00             	addb   $0x0,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b1a:	80 00 00             	addb   $0x0,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b22:	80 00 00             	addb   $0x0,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b32:	80 00 00             	addb   $0x0,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b3a:	80 00 00             	addb   $0x0,(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b42:	80 00 00             	addb   $0x0,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b4a:	80 00 00             	addb   $0x0,(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b52:	80 00 00             	addb   $0x0,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b5a:	80 00 00             	addb   $0x0,(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b62:	80 00 00             	addb   $0x0,(%rax)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b6a:	80 00 00             	addb   $0x0,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b72:	80 00 00             	addb   $0x0,(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b7a:	80 00 00             	addb   $0x0,(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b82:	80 00 00             	addb   $0x0,(%rax)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 84 0a 80 00 00 00 	add    %al,0x80(%rdx,%rcx,1)
+  804b8e:	00 00                	add    %al,(%rax)
+  804b90:	61                   	(bad)
+  804b91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b97:	00 61 0b             	add    %ah,0xb(%rcx)
+  804b9a:	80 00 00             	addb   $0x0,(%rax)
+  804b9d:	00 00                	add    %al,(%rax)
+  804b9f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804ba2:	80 00 00             	addb   $0x0,(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804baa:	80 00 00             	addb   $0x0,(%rax)
+  804bad:	00 00                	add    %al,(%rax)
+  804baf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bb2:	80 00 00             	addb   $0x0,(%rax)
+  804bb5:	00 00                	add    %al,(%rax)
+  804bb7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bba:	80 00 00             	addb   $0x0,(%rax)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bc2:	80 00 00             	addb   $0x0,(%rax)
+  804bc5:	00 00                	add    %al,(%rax)
+  804bc7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bca:	80 00 00             	addb   $0x0,(%rax)
+  804bcd:	00 00                	add    %al,(%rax)
+  804bcf:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bd2:	80 00 00             	addb   $0x0,(%rax)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bda:	80 00 00             	addb   $0x0,(%rax)
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 d0                	add    %dl,%al
+  804be1:	05 80 00 00 00       	add    $0x80,%eax
+  804be6:	00 00                	add    %al,(%rax)
+  804be8:	9f                   	lahf
+  804be9:	07                   	(bad)
+  804bea:	80 00 00             	addb   $0x0,(%rax)
+  804bed:	00 00                	add    %al,(%rax)
+  804bef:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bf2:	80 00 00             	addb   $0x0,(%rax)
+  804bf5:	00 00                	add    %al,(%rax)
+  804bf7:	00 61 0b             	add    %ah,0xb(%rcx)
+  804bfa:	80 00 00             	addb   $0x0,(%rax)
+  804bfd:	00 00                	add    %al,(%rax)
+  804bff:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c02:	80 00 00             	addb   $0x0,(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c0a:	80 00 00             	addb   $0x0,(%rax)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 ff                	add    %bh,%bh
+  804c11:	05 80 00 00 00       	add    $0x80,%eax
+  804c16:	00 00                	add    %al,(%rax)
+  804c18:	61                   	(bad)
+  804c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c1f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c22:	80 00 00             	addb   $0x0,(%rax)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 c5                	add    %al,%ch
+  804c29:	05 80 00 00 00       	add    $0x80,%eax
+  804c2e:	00 00                	add    %al,(%rax)
+  804c30:	61                   	(bad)
+  804c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c37:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c3a:	80 00 00             	addb   $0x0,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 47 09             	add    %al,0x9(%rdi)
+  804c42:	80 00 00             	addb   $0x0,(%rax)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 11                	add    %dl,(%rcx)
+  804c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c4f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c52:	80 00 00             	addb   $0x0,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 96 06 80 00 00    	add    %dl,0x8006(%rsi)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 73 08             	add    %dh,0x8(%rbx)
+  804c72:	80 00 00             	addb   $0x0,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c7a:	80 00 00             	addb   $0x0,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 61 0b             	add    %ah,0xb(%rcx)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 84 0a 80 00 00 00 	add    %al,0x80(%rdx,%rcx,1)
+  804c8e:	00 00                	add    %al,(%rax)
+  804c90:	61                   	(bad)
+  804c91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c97:	00 29                	add    %ch,(%rcx)
+  804c99:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804ca0 <error_string>:
+	...
+  804ca8:	45 48 80 00 00 00 00 00 57 48 80 00 00 00 00 00     EH......WH......
+  804cb8:	67 48 80 00 00 00 00 00 79 48 80 00 00 00 00 00     gH......yH......
+  804cc8:	87 48 80 00 00 00 00 00 9b 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	b0 48 80 00 00 00 00 00 c3 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	d5 48 80 00 00 00 00 00 e9 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	f9 48 80 00 00 00 00 00 0c 49 80 00 00 00 00 00     .H.......I......
+  804d08:	23 49 80 00 00 00 00 00 39 49 80 00 00 00 00 00     #I......9I......
+  804d18:	51 49 80 00 00 00 00 00 69 49 80 00 00 00 00 00     QI......iI......
+  804d28:	76 49 80 00 00 00 00 00 58 4d 80 00 00 00 00 00     vI......XM......
+  804d38:	8a 49 80 00 00 00 00 00 a2 49 80 00 00 00 00 00     .I.......I......
+  804d48:	ac 49 80 00 00 00 00 00 b6 49 80 00 00 00 00 00     .I.......I......
+  804d58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804d88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804d98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804da8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804db8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804dc8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804dd8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804de8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804df8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804e08:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804e18:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  804e28:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  804e38:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804e48:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804e58:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804e68:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804e78:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804e88:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804e98:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804ea8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804eb8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804ec0 <devtab>:
+  804ec0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804ed0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804ee0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804ef0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804f00:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804f10:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804f20:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  804f30:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804f40:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
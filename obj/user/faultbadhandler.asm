@@ -0,0 +1,7894 @@
+
+obj/user/faultbadhandler:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4e 00 00 00       	call   800071 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * we outrun the stack with invocations of the user-level handler */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_alloc_region(0, (void *)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  800029:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80002e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800033:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80003a:	00 00 00 
+  80003d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800042:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  800049:	00 00 00 
+  80004c:	ff d0                	call   *%rax
+    sys_env_set_pgfault_upcall(0, (void *)0xDEADBEEF);
+  80004e:	be ef be ad de       	mov    $0xdeadbeef,%esi
+  800053:	bf 00 00 00 00       	mov    $0x0,%edi
+  800058:	48 b8 3d 04 80 00 00 	movabs $0x80043d,%rax
+  80005f:	00 00 00 
+  800062:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800064:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80006b:	00 00 00 00 
+#endif
+}
+  80006f:	5d                   	pop    %rbp
+  800070:	c3                   	ret
+
+0000000000800071 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800071:	55                   	push   %rbp
+  800072:	48 89 e5             	mov    %rsp,%rbp
+  800075:	41 56                	push   %r14
+  800077:	41 55                	push   %r13
+  800079:	41 54                	push   %r12
+  80007b:	53                   	push   %rbx
+  80007c:	41 89 fd             	mov    %edi,%r13d
+  80007f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800082:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800089:	00 00 00 
+  80008c:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800093:	00 00 00 
+  800096:	48 39 c2             	cmp    %rax,%rdx
+  800099:	73 17                	jae    8000b2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009e:	49 89 c4             	mov    %rax,%r12
+  8000a1:	48 83 c3 08          	add    $0x8,%rbx
+  8000a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000aa:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ad:	4c 39 e3             	cmp    %r12,%rbx
+  8000b0:	72 ef                	jb     8000a1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000b2:	48 b8 f2 01 80 00 00 	movabs $0x8001f2,%rax
+  8000b9:	00 00 00 
+  8000bc:	ff d0                	call   *%rax
+  8000be:	89 c2                	mov    %eax,%edx
+  8000c0:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000c6:	48 89 d0             	mov    %rdx,%rax
+  8000c9:	48 c1 e0 04          	shl    $0x4,%rax
+  8000cd:	48 29 d0             	sub    %rdx,%rax
+  8000d0:	48 c1 e0 05          	shl    $0x5,%rax
+  8000d4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000db:	00 00 00 
+  8000de:	48 01 d0             	add    %rdx,%rax
+  8000e1:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000e8:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000eb:	45 85 ed             	test   %r13d,%r13d
+  8000ee:	7e 0d                	jle    8000fd <libmain+0x8c>
+  8000f0:	49 8b 06             	mov    (%r14),%rax
+  8000f3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000fa:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000fd:	4c 89 f6             	mov    %r14,%rsi
+  800100:	44 89 ef             	mov    %r13d,%edi
+  800103:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80010a:	00 00 00 
+  80010d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80010f:	48 b8 24 01 80 00 00 	movabs $0x800124,%rax
+  800116:	00 00 00 
+  800119:	ff d0                	call   *%rax
+#endif
+}
+  80011b:	5b                   	pop    %rbx
+  80011c:	41 5c                	pop    %r12
+  80011e:	41 5d                	pop    %r13
+  800120:	41 5e                	pop    %r14
+  800122:	5d                   	pop    %rbp
+  800123:	c3                   	ret
+
+0000000000800124 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800124:	55                   	push   %rbp
+  800125:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800128:	48 b8 d8 08 80 00 00 	movabs $0x8008d8,%rax
+  80012f:	00 00 00 
+  800132:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800134:	bf 00 00 00 00       	mov    $0x0,%edi
+  800139:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  800140:	00 00 00 
+  800143:	ff d0                	call   *%rax
+}
+  800145:	5d                   	pop    %rbp
+  800146:	c3                   	ret
+
+0000000000800147 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80014c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800151:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800157:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80015d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800163:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800165:	c3                   	ret
+
+0000000000800166 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800166:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80016b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800170:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80017a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80018c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80018e:	c3                   	ret
+
+000000000080018f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80018f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800192:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800197:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80019c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001a1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001b3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8001b5:	48 85 c0             	test   %rax,%rax
+  8001b8:	7f 01                	jg     8001bb <sys_env_destroy+0x2c>
+}
+  8001ba:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8001bb:	55                   	push   %rbp
+  8001bc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8001bf:	49 89 c0             	mov    %rax,%r8
+  8001c2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001c7:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  8001ce:	00 00 00 
+  8001d1:	be 29 00 00 00       	mov    $0x29,%esi
+  8001d6:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  8001dd:	00 00 00 
+  8001e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e5:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  8001ec:	00 00 00 
+  8001ef:	41 ff d1             	call   *%r9
+
+00000000008001f2 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001f2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800201:	ba 00 00 00 00       	mov    $0x0,%edx
+  800206:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80020c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800212:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800218:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80021a:	c3                   	ret
+
+000000000080021b <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80021b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800220:	bf 00 00 00 00       	mov    $0x0,%edi
+  800225:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80022a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80022f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800241:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800243:	c3                   	ret
+
+0000000000800244 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800244:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800249:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800250:	00 00 00 
+  800253:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800259:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80025f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800265:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800267:	c3                   	ret
+
+0000000000800268 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800268:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80026b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800276:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80027c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80027e:	c3                   	ret
+
+000000000080027f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80027f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800282:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800287:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80028a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800290:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800296:	0f 05                	syscall
+    if (check && ret > 0) {
+  800298:	48 85 c0             	test   %rax,%rax
+  80029b:	7f 01                	jg     80029e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80029d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80029e:	55                   	push   %rbp
+  80029f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002a2:	49 89 c0             	mov    %rax,%r8
+  8002a5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8002aa:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  8002b1:	00 00 00 
+  8002b4:	be 29 00 00 00       	mov    $0x29,%esi
+  8002b9:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  8002c0:	00 00 00 
+  8002c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c8:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  8002cf:	00 00 00 
+  8002d2:	41 ff d1             	call   *%r9
+
+00000000008002d5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002d5:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002d8:	48 63 d2             	movslq %edx,%rdx
+  8002db:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002de:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002e3:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002e6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002e8:	48 85 c0             	test   %rax,%rax
+  8002eb:	7f 01                	jg     8002ee <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002ed:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ee:	55                   	push   %rbp
+  8002ef:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002f2:	49 89 c0             	mov    %rax,%r8
+  8002f5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002fa:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  800301:	00 00 00 
+  800304:	be 29 00 00 00       	mov    $0x29,%esi
+  800309:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  800310:	00 00 00 
+  800313:	b8 00 00 00 00       	mov    $0x0,%eax
+  800318:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  80031f:	00 00 00 
+  800322:	41 ff d1             	call   *%r9
+
+0000000000800325 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800325:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800328:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80032d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800333:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800339:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80033f:	0f 05                	syscall
+    if (check && ret > 0) {
+  800341:	48 85 c0             	test   %rax,%rax
+  800344:	7f 01                	jg     800347 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800346:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800347:	55                   	push   %rbp
+  800348:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80034b:	49 89 c0             	mov    %rax,%r8
+  80034e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800353:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  80035a:	00 00 00 
+  80035d:	be 29 00 00 00       	mov    $0x29,%esi
+  800362:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  800369:	00 00 00 
+  80036c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800371:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  800378:	00 00 00 
+  80037b:	41 ff d1             	call   *%r9
+
+000000000080037e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80037e:	48 63 f6             	movslq %esi,%rsi
+  800381:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800384:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800389:	ba 00 00 00 00       	mov    $0x0,%edx
+  80038e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800394:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80039a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003a0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003a2:	48 85 c0             	test   %rax,%rax
+  8003a5:	7f 01                	jg     8003a8 <sys_env_set_status+0x2a>
+}
+  8003a7:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8003a8:	55                   	push   %rbp
+  8003a9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ac:	49 89 c0             	mov    %rax,%r8
+  8003af:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8003b4:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  8003bb:	00 00 00 
+  8003be:	be 29 00 00 00       	mov    $0x29,%esi
+  8003c3:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  8003ca:	00 00 00 
+  8003cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d2:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  8003d9:	00 00 00 
+  8003dc:	41 ff d1             	call   *%r9
+
+00000000008003df <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003df:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003e2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003e7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ec:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003fe:	0f 05                	syscall
+    if (check && ret > 0) {
+  800400:	48 85 c0             	test   %rax,%rax
+  800403:	7f 01                	jg     800406 <sys_env_set_trapframe+0x27>
+}
+  800405:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  800406:	55                   	push   %rbp
+  800407:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80040a:	49 89 c0             	mov    %rax,%r8
+  80040d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  800412:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  800419:	00 00 00 
+  80041c:	be 29 00 00 00       	mov    $0x29,%esi
+  800421:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  800428:	00 00 00 
+  80042b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800430:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  800437:	00 00 00 
+  80043a:	41 ff d1             	call   *%r9
+
+000000000080043d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80043d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800440:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800445:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800450:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800456:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80045c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80045e:	48 85 c0             	test   %rax,%rax
+  800461:	7f 01                	jg     800464 <sys_env_set_pgfault_upcall+0x27>
+}
+  800463:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800464:	55                   	push   %rbp
+  800465:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800468:	49 89 c0             	mov    %rax,%r8
+  80046b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800470:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  800477:	00 00 00 
+  80047a:	be 29 00 00 00       	mov    $0x29,%esi
+  80047f:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  800486:	00 00 00 
+  800489:	b8 00 00 00 00       	mov    $0x0,%eax
+  80048e:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  800495:	00 00 00 
+  800498:	41 ff d1             	call   *%r9
+
+000000000080049b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80049b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80049e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8004a1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004a6:	4d 63 c0             	movslq %r8d,%r8
+  8004a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004af:	0f 05                	syscall
+}
+  8004b1:	c3                   	ret
+
+00000000008004b2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8004b2:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8004b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8004b8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004bd:	4d 63 c0             	movslq %r8d,%r8
+  8004c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004c6:	0f 05                	syscall
+}
+  8004c8:	c3                   	ret
+
+00000000008004c9 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004c9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8004ce:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004d1:	45 89 c0             	mov    %r8d,%r8d
+  8004d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004da:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004dc:	48 85 c0             	test   %rax,%rax
+  8004df:	7f 01                	jg     8004e2 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004e1:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004e2:	55                   	push   %rbp
+  8004e3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004e6:	49 89 c0             	mov    %rax,%r8
+  8004e9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004ee:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  8004f5:	00 00 00 
+  8004f8:	be 29 00 00 00       	mov    $0x29,%esi
+  8004fd:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  800504:	00 00 00 
+  800507:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050c:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  800513:	00 00 00 
+  800516:	41 ff d1             	call   *%r9
+
+0000000000800519 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  800519:	55                   	push   %rbp
+  80051a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80051d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800523:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800528:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052d:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+}
+  800539:	5d                   	pop    %rbp
+  80053a:	c3                   	ret
+
+000000000080053b <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80053b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800540:	bf 00 00 00 00       	mov    $0x0,%edi
+  800545:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80054a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80054f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800555:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80055b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800561:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800563:	c3                   	ret
+
+0000000000800564 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800564:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800569:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80056e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800573:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800579:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80057f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800585:	0f 05                	syscall
+    if (check && ret > 0) {
+  800587:	48 85 c0             	test   %rax,%rax
+  80058a:	7f 01                	jg     80058d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80058c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80058d:	55                   	push   %rbp
+  80058e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800591:	49 89 c0             	mov    %rax,%r8
+  800594:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800599:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  8005a0:	00 00 00 
+  8005a3:	be 29 00 00 00       	mov    $0x29,%esi
+  8005a8:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  8005af:	00 00 00 
+  8005b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b7:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  8005be:	00 00 00 
+  8005c1:	41 ff d1             	call   *%r9
+
+00000000008005c4 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8005c4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8005c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ce:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ea:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005ec:	c3                   	ret
+
+00000000008005ed <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005ed:	89 d2                	mov    %edx,%edx
+  8005ef:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005f1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800602:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800608:	0f 05                	syscall
+}
+  80060a:	c3                   	ret
+
+000000000080060b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80060b:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80060e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800613:	ba 00 00 00 00       	mov    $0x0,%edx
+  800618:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80061e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800624:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80062a:	0f 05                	syscall
+}
+  80062c:	c3                   	ret
+
+000000000080062d <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80062d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800630:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80063a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800640:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800646:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80064c:	0f 05                	syscall
+}
+  80064e:	c3                   	ret
+
+000000000080064f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80064f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800652:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800657:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80065c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800661:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800667:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80066d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800673:	0f 05                	syscall
+    if (check && ret > 0) {
+  800675:	48 85 c0             	test   %rax,%rax
+  800678:	7f 01                	jg     80067b <sys_irq_ack+0x2c>
+}
+  80067a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80067b:	55                   	push   %rbp
+  80067c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80067f:	49 89 c0             	mov    %rax,%r8
+  800682:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800687:	48 ba e0 46 80 00 00 	movabs $0x8046e0,%rdx
+  80068e:	00 00 00 
+  800691:	be 29 00 00 00       	mov    $0x29,%esi
+  800696:	48 bf ff 46 80 00 00 	movabs $0x8046ff,%rdi
+  80069d:	00 00 00 
+  8006a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a5:	49 b9 9d 33 80 00 00 	movabs $0x80339d,%r9
+  8006ac:	00 00 00 
+  8006af:	41 ff d1             	call   *%r9
+
+00000000008006b2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006b2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006b9:	ff ff ff 
+  8006bc:	48 01 f8             	add    %rdi,%rax
+  8006bf:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006c3:	c3                   	ret
+
+00000000008006c4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006c4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006cb:	ff ff ff 
+  8006ce:	48 01 f8             	add    %rdi,%rax
+  8006d1:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006d5:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006db:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006df:	c3                   	ret
+
+00000000008006e0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006e0:	55                   	push   %rbp
+  8006e1:	48 89 e5             	mov    %rsp,%rbp
+  8006e4:	41 57                	push   %r15
+  8006e6:	41 56                	push   %r14
+  8006e8:	41 55                	push   %r13
+  8006ea:	41 54                	push   %r12
+  8006ec:	53                   	push   %rbx
+  8006ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8006f1:	49 89 ff             	mov    %rdi,%r15
+  8006f4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006f9:	49 bd 6f 2e 80 00 00 	movabs $0x802e6f,%r13
+  800700:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  800703:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800709:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80070c:	48 89 df             	mov    %rbx,%rdi
+  80070f:	41 ff d5             	call   *%r13
+  800712:	83 e0 04             	and    $0x4,%eax
+  800715:	74 17                	je     80072e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800717:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80071e:	4c 39 f3             	cmp    %r14,%rbx
+  800721:	75 e6                	jne    800709 <fd_alloc+0x29>
+  800723:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800729:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80072e:	4d 89 27             	mov    %r12,(%r15)
+}
+  800731:	48 83 c4 08          	add    $0x8,%rsp
+  800735:	5b                   	pop    %rbx
+  800736:	41 5c                	pop    %r12
+  800738:	41 5d                	pop    %r13
+  80073a:	41 5e                	pop    %r14
+  80073c:	41 5f                	pop    %r15
+  80073e:	5d                   	pop    %rbp
+  80073f:	c3                   	ret
+
+0000000000800740 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800740:	83 ff 1f             	cmp    $0x1f,%edi
+  800743:	77 39                	ja     80077e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800745:	55                   	push   %rbp
+  800746:	48 89 e5             	mov    %rsp,%rbp
+  800749:	41 54                	push   %r12
+  80074b:	53                   	push   %rbx
+  80074c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80074f:	48 63 df             	movslq %edi,%rbx
+  800752:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800759:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80075d:	48 89 df             	mov    %rbx,%rdi
+  800760:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  800767:	00 00 00 
+  80076a:	ff d0                	call   *%rax
+  80076c:	a8 04                	test   $0x4,%al
+  80076e:	74 14                	je     800784 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800770:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800774:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800779:	5b                   	pop    %rbx
+  80077a:	41 5c                	pop    %r12
+  80077c:	5d                   	pop    %rbp
+  80077d:	c3                   	ret
+        return -E_INVAL;
+  80077e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800783:	c3                   	ret
+        return -E_INVAL;
+  800784:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800789:	eb ee                	jmp    800779 <fd_lookup+0x39>
+
+000000000080078b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80078b:	55                   	push   %rbp
+  80078c:	48 89 e5             	mov    %rsp,%rbp
+  80078f:	41 54                	push   %r12
+  800791:	53                   	push   %rbx
+  800792:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800795:	48 b8 a0 47 80 00 00 	movabs $0x8047a0,%rax
+  80079c:	00 00 00 
+  80079f:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8007a6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007a9:	39 3b                	cmp    %edi,(%rbx)
+  8007ab:	74 47                	je     8007f4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007ad:	48 83 c0 08          	add    $0x8,%rax
+  8007b1:	48 8b 18             	mov    (%rax),%rbx
+  8007b4:	48 85 db             	test   %rbx,%rbx
+  8007b7:	75 f0                	jne    8007a9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007b9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8007c0:	00 00 00 
+  8007c3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007c9:	89 fa                	mov    %edi,%edx
+  8007cb:	48 bf 10 47 80 00 00 	movabs $0x804710,%rdi
+  8007d2:	00 00 00 
+  8007d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007da:	48 b9 ed 34 80 00 00 	movabs $0x8034ed,%rcx
+  8007e1:	00 00 00 
+  8007e4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007e6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007eb:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007ef:	5b                   	pop    %rbx
+  8007f0:	41 5c                	pop    %r12
+  8007f2:	5d                   	pop    %rbp
+  8007f3:	c3                   	ret
+            return 0;
+  8007f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f9:	eb f0                	jmp    8007eb <dev_lookup+0x60>
+
+00000000008007fb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007fb:	55                   	push   %rbp
+  8007fc:	48 89 e5             	mov    %rsp,%rbp
+  8007ff:	41 55                	push   %r13
+  800801:	41 54                	push   %r12
+  800803:	53                   	push   %rbx
+  800804:	48 83 ec 18          	sub    $0x18,%rsp
+  800808:	48 89 fb             	mov    %rdi,%rbx
+  80080b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80080e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800815:	ff ff ff 
+  800818:	48 01 df             	add    %rbx,%rdi
+  80081b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80081f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800823:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  80082a:	00 00 00 
+  80082d:	ff d0                	call   *%rax
+  80082f:	41 89 c5             	mov    %eax,%r13d
+  800832:	85 c0                	test   %eax,%eax
+  800834:	78 06                	js     80083c <fd_close+0x41>
+  800836:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80083a:	74 1a                	je     800856 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80083c:	45 84 e4             	test   %r12b,%r12b
+  80083f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800844:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800848:	44 89 e8             	mov    %r13d,%eax
+  80084b:	48 83 c4 18          	add    $0x18,%rsp
+  80084f:	5b                   	pop    %rbx
+  800850:	41 5c                	pop    %r12
+  800852:	41 5d                	pop    %r13
+  800854:	5d                   	pop    %rbp
+  800855:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800856:	8b 3b                	mov    (%rbx),%edi
+  800858:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80085c:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800863:	00 00 00 
+  800866:	ff d0                	call   *%rax
+  800868:	41 89 c5             	mov    %eax,%r13d
+  80086b:	85 c0                	test   %eax,%eax
+  80086d:	78 1b                	js     80088a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80086f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800873:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800877:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80087d:	48 85 c0             	test   %rax,%rax
+  800880:	74 08                	je     80088a <fd_close+0x8f>
+  800882:	48 89 df             	mov    %rbx,%rdi
+  800885:	ff d0                	call   *%rax
+  800887:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80088a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80088f:	48 89 de             	mov    %rbx,%rsi
+  800892:	bf 00 00 00 00       	mov    $0x0,%edi
+  800897:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  80089e:	00 00 00 
+  8008a1:	ff d0                	call   *%rax
+    return res;
+  8008a3:	eb a3                	jmp    800848 <fd_close+0x4d>
+
+00000000008008a5 <close>:
+
+int
+close(int fdnum) {
+  8008a5:	55                   	push   %rbp
+  8008a6:	48 89 e5             	mov    %rsp,%rbp
+  8008a9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008ad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008b1:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  8008b8:	00 00 00 
+  8008bb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008bd:	85 c0                	test   %eax,%eax
+  8008bf:	78 15                	js     8008d6 <close+0x31>
+
+    return fd_close(fd, 1);
+  8008c1:	be 01 00 00 00       	mov    $0x1,%esi
+  8008c6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008ca:	48 b8 fb 07 80 00 00 	movabs $0x8007fb,%rax
+  8008d1:	00 00 00 
+  8008d4:	ff d0                	call   *%rax
+}
+  8008d6:	c9                   	leave
+  8008d7:	c3                   	ret
+
+00000000008008d8 <close_all>:
+
+void
+close_all(void) {
+  8008d8:	55                   	push   %rbp
+  8008d9:	48 89 e5             	mov    %rsp,%rbp
+  8008dc:	41 54                	push   %r12
+  8008de:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008df:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008e4:	49 bc a5 08 80 00 00 	movabs $0x8008a5,%r12
+  8008eb:	00 00 00 
+  8008ee:	89 df                	mov    %ebx,%edi
+  8008f0:	41 ff d4             	call   *%r12
+  8008f3:	83 c3 01             	add    $0x1,%ebx
+  8008f6:	83 fb 20             	cmp    $0x20,%ebx
+  8008f9:	75 f3                	jne    8008ee <close_all+0x16>
+}
+  8008fb:	5b                   	pop    %rbx
+  8008fc:	41 5c                	pop    %r12
+  8008fe:	5d                   	pop    %rbp
+  8008ff:	c3                   	ret
+
+0000000000800900 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  800900:	55                   	push   %rbp
+  800901:	48 89 e5             	mov    %rsp,%rbp
+  800904:	41 57                	push   %r15
+  800906:	41 56                	push   %r14
+  800908:	41 55                	push   %r13
+  80090a:	41 54                	push   %r12
+  80090c:	53                   	push   %rbx
+  80090d:	48 83 ec 18          	sub    $0x18,%rsp
+  800911:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  800914:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800918:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  80091f:	00 00 00 
+  800922:	ff d0                	call   *%rax
+  800924:	89 c3                	mov    %eax,%ebx
+  800926:	85 c0                	test   %eax,%eax
+  800928:	0f 88 b8 00 00 00    	js     8009e6 <dup+0xe6>
+    close(newfdnum);
+  80092e:	44 89 e7             	mov    %r12d,%edi
+  800931:	48 b8 a5 08 80 00 00 	movabs $0x8008a5,%rax
+  800938:	00 00 00 
+  80093b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80093d:	4d 63 ec             	movslq %r12d,%r13
+  800940:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800947:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80094b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80094f:	4c 89 ff             	mov    %r15,%rdi
+  800952:	49 be c4 06 80 00 00 	movabs $0x8006c4,%r14
+  800959:	00 00 00 
+  80095c:	41 ff d6             	call   *%r14
+  80095f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800962:	4c 89 ef             	mov    %r13,%rdi
+  800965:	41 ff d6             	call   *%r14
+  800968:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80096b:	48 89 df             	mov    %rbx,%rdi
+  80096e:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  800975:	00 00 00 
+  800978:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80097a:	a8 04                	test   $0x4,%al
+  80097c:	74 2b                	je     8009a9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80097e:	41 89 c1             	mov    %eax,%r9d
+  800981:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800987:	4c 89 f1             	mov    %r14,%rcx
+  80098a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098f:	48 89 de             	mov    %rbx,%rsi
+  800992:	bf 00 00 00 00       	mov    $0x0,%edi
+  800997:	48 b8 d5 02 80 00 00 	movabs $0x8002d5,%rax
+  80099e:	00 00 00 
+  8009a1:	ff d0                	call   *%rax
+  8009a3:	89 c3                	mov    %eax,%ebx
+  8009a5:	85 c0                	test   %eax,%eax
+  8009a7:	78 4e                	js     8009f7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009a9:	4c 89 ff             	mov    %r15,%rdi
+  8009ac:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  8009b3:	00 00 00 
+  8009b6:	ff d0                	call   *%rax
+  8009b8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009bb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009c1:	4c 89 e9             	mov    %r13,%rcx
+  8009c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c9:	4c 89 fe             	mov    %r15,%rsi
+  8009cc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d1:	48 b8 d5 02 80 00 00 	movabs $0x8002d5,%rax
+  8009d8:	00 00 00 
+  8009db:	ff d0                	call   *%rax
+  8009dd:	89 c3                	mov    %eax,%ebx
+  8009df:	85 c0                	test   %eax,%eax
+  8009e1:	78 14                	js     8009f7 <dup+0xf7>
+
+    return newfdnum;
+  8009e3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009e6:	89 d8                	mov    %ebx,%eax
+  8009e8:	48 83 c4 18          	add    $0x18,%rsp
+  8009ec:	5b                   	pop    %rbx
+  8009ed:	41 5c                	pop    %r12
+  8009ef:	41 5d                	pop    %r13
+  8009f1:	41 5e                	pop    %r14
+  8009f3:	41 5f                	pop    %r15
+  8009f5:	5d                   	pop    %rbp
+  8009f6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009f7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009fc:	4c 89 ee             	mov    %r13,%rsi
+  8009ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a04:	49 bc 25 03 80 00 00 	movabs $0x800325,%r12
+  800a0b:	00 00 00 
+  800a0e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a11:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a16:	4c 89 f6             	mov    %r14,%rsi
+  800a19:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a1e:	41 ff d4             	call   *%r12
+    return res;
+  800a21:	eb c3                	jmp    8009e6 <dup+0xe6>
+
+0000000000800a23 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a23:	55                   	push   %rbp
+  800a24:	48 89 e5             	mov    %rsp,%rbp
+  800a27:	41 56                	push   %r14
+  800a29:	41 55                	push   %r13
+  800a2b:	41 54                	push   %r12
+  800a2d:	53                   	push   %rbx
+  800a2e:	48 83 ec 10          	sub    $0x10,%rsp
+  800a32:	89 fb                	mov    %edi,%ebx
+  800a34:	49 89 f4             	mov    %rsi,%r12
+  800a37:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a3e:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800a45:	00 00 00 
+  800a48:	ff d0                	call   *%rax
+  800a4a:	85 c0                	test   %eax,%eax
+  800a4c:	78 4c                	js     800a9a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a4e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a52:	41 8b 3e             	mov    (%r14),%edi
+  800a55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a59:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800a60:	00 00 00 
+  800a63:	ff d0                	call   *%rax
+  800a65:	85 c0                	test   %eax,%eax
+  800a67:	78 35                	js     800a9e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a69:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a6d:	83 e0 03             	and    $0x3,%eax
+  800a70:	83 f8 01             	cmp    $0x1,%eax
+  800a73:	74 2d                	je     800aa2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a75:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a79:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a7d:	48 85 c0             	test   %rax,%rax
+  800a80:	74 56                	je     800ad8 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a82:	4c 89 ea             	mov    %r13,%rdx
+  800a85:	4c 89 e6             	mov    %r12,%rsi
+  800a88:	4c 89 f7             	mov    %r14,%rdi
+  800a8b:	ff d0                	call   *%rax
+}
+  800a8d:	48 83 c4 10          	add    $0x10,%rsp
+  800a91:	5b                   	pop    %rbx
+  800a92:	41 5c                	pop    %r12
+  800a94:	41 5d                	pop    %r13
+  800a96:	41 5e                	pop    %r14
+  800a98:	5d                   	pop    %rbp
+  800a99:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a9a:	48 98                	cltq
+  800a9c:	eb ef                	jmp    800a8d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a9e:	48 98                	cltq
+  800aa0:	eb eb                	jmp    800a8d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800aa2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800aa9:	00 00 00 
+  800aac:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800ab2:	89 da                	mov    %ebx,%edx
+  800ab4:	48 bf 51 47 80 00 00 	movabs $0x804751,%rdi
+  800abb:	00 00 00 
+  800abe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ac3:	48 b9 ed 34 80 00 00 	movabs $0x8034ed,%rcx
+  800aca:	00 00 00 
+  800acd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800acf:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800ad6:	eb b5                	jmp    800a8d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ad8:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800adf:	eb ac                	jmp    800a8d <read+0x6a>
+
+0000000000800ae1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ae1:	55                   	push   %rbp
+  800ae2:	48 89 e5             	mov    %rsp,%rbp
+  800ae5:	41 57                	push   %r15
+  800ae7:	41 56                	push   %r14
+  800ae9:	41 55                	push   %r13
+  800aeb:	41 54                	push   %r12
+  800aed:	53                   	push   %rbx
+  800aee:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800af2:	48 85 d2             	test   %rdx,%rdx
+  800af5:	74 54                	je     800b4b <readn+0x6a>
+  800af7:	41 89 fd             	mov    %edi,%r13d
+  800afa:	49 89 f6             	mov    %rsi,%r14
+  800afd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b00:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b05:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b0a:	49 bf 23 0a 80 00 00 	movabs $0x800a23,%r15
+  800b11:	00 00 00 
+  800b14:	4c 89 e2             	mov    %r12,%rdx
+  800b17:	48 29 f2             	sub    %rsi,%rdx
+  800b1a:	4c 01 f6             	add    %r14,%rsi
+  800b1d:	44 89 ef             	mov    %r13d,%edi
+  800b20:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b23:	85 c0                	test   %eax,%eax
+  800b25:	78 20                	js     800b47 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b27:	01 c3                	add    %eax,%ebx
+  800b29:	85 c0                	test   %eax,%eax
+  800b2b:	74 08                	je     800b35 <readn+0x54>
+  800b2d:	48 63 f3             	movslq %ebx,%rsi
+  800b30:	4c 39 e6             	cmp    %r12,%rsi
+  800b33:	72 df                	jb     800b14 <readn+0x33>
+    }
+    return res;
+  800b35:	48 63 c3             	movslq %ebx,%rax
+}
+  800b38:	48 83 c4 08          	add    $0x8,%rsp
+  800b3c:	5b                   	pop    %rbx
+  800b3d:	41 5c                	pop    %r12
+  800b3f:	41 5d                	pop    %r13
+  800b41:	41 5e                	pop    %r14
+  800b43:	41 5f                	pop    %r15
+  800b45:	5d                   	pop    %rbp
+  800b46:	c3                   	ret
+        if (inc < 0) return inc;
+  800b47:	48 98                	cltq
+  800b49:	eb ed                	jmp    800b38 <readn+0x57>
+    int inc = 1, res = 0;
+  800b4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b50:	eb e3                	jmp    800b35 <readn+0x54>
+
+0000000000800b52 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b52:	55                   	push   %rbp
+  800b53:	48 89 e5             	mov    %rsp,%rbp
+  800b56:	41 56                	push   %r14
+  800b58:	41 55                	push   %r13
+  800b5a:	41 54                	push   %r12
+  800b5c:	53                   	push   %rbx
+  800b5d:	48 83 ec 10          	sub    $0x10,%rsp
+  800b61:	89 fb                	mov    %edi,%ebx
+  800b63:	49 89 f4             	mov    %rsi,%r12
+  800b66:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b69:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b6d:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800b74:	00 00 00 
+  800b77:	ff d0                	call   *%rax
+  800b79:	85 c0                	test   %eax,%eax
+  800b7b:	78 47                	js     800bc4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b7d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b81:	41 8b 3e             	mov    (%r14),%edi
+  800b84:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b88:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800b8f:	00 00 00 
+  800b92:	ff d0                	call   *%rax
+  800b94:	85 c0                	test   %eax,%eax
+  800b96:	78 30                	js     800bc8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b98:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b9d:	74 2d                	je     800bcc <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b9f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ba3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800ba7:	48 85 c0             	test   %rax,%rax
+  800baa:	74 56                	je     800c02 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800bac:	4c 89 ea             	mov    %r13,%rdx
+  800baf:	4c 89 e6             	mov    %r12,%rsi
+  800bb2:	4c 89 f7             	mov    %r14,%rdi
+  800bb5:	ff d0                	call   *%rax
+}
+  800bb7:	48 83 c4 10          	add    $0x10,%rsp
+  800bbb:	5b                   	pop    %rbx
+  800bbc:	41 5c                	pop    %r12
+  800bbe:	41 5d                	pop    %r13
+  800bc0:	41 5e                	pop    %r14
+  800bc2:	5d                   	pop    %rbp
+  800bc3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bc4:	48 98                	cltq
+  800bc6:	eb ef                	jmp    800bb7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bc8:	48 98                	cltq
+  800bca:	eb eb                	jmp    800bb7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800bcc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800bd3:	00 00 00 
+  800bd6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800bdc:	89 da                	mov    %ebx,%edx
+  800bde:	48 bf 6d 47 80 00 00 	movabs $0x80476d,%rdi
+  800be5:	00 00 00 
+  800be8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bed:	48 b9 ed 34 80 00 00 	movabs $0x8034ed,%rcx
+  800bf4:	00 00 00 
+  800bf7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bf9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c00:	eb b5                	jmp    800bb7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c02:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c09:	eb ac                	jmp    800bb7 <write+0x65>
+
+0000000000800c0b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c0b:	55                   	push   %rbp
+  800c0c:	48 89 e5             	mov    %rsp,%rbp
+  800c0f:	41 54                	push   %r12
+  800c11:	53                   	push   %rbx
+  800c12:	48 83 ec 10          	sub    $0x10,%rsp
+  800c16:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c18:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c1c:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800c23:	00 00 00 
+  800c26:	ff d0                	call   *%rax
+  800c28:	85 c0                	test   %eax,%eax
+  800c2a:	78 3e                	js     800c6a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c2c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c30:	41 8b 3c 24          	mov    (%r12),%edi
+  800c34:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c38:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800c3f:	00 00 00 
+  800c42:	ff d0                	call   *%rax
+  800c44:	85 c0                	test   %eax,%eax
+  800c46:	78 22                	js     800c6a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c48:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c4c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c50:	48 85 c0             	test   %rax,%rax
+  800c53:	74 0b                	je     800c60 <seek+0x55>
+  800c55:	89 de                	mov    %ebx,%esi
+  800c57:	4c 89 e7             	mov    %r12,%rdi
+  800c5a:	ff d0                	call   *%rax
+  800c5c:	85 c0                	test   %eax,%eax
+  800c5e:	78 0a                	js     800c6a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c60:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c65:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c6a:	48 83 c4 10          	add    $0x10,%rsp
+  800c6e:	5b                   	pop    %rbx
+  800c6f:	41 5c                	pop    %r12
+  800c71:	5d                   	pop    %rbp
+  800c72:	c3                   	ret
+
+0000000000800c73 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c73:	55                   	push   %rbp
+  800c74:	48 89 e5             	mov    %rsp,%rbp
+  800c77:	41 55                	push   %r13
+  800c79:	41 54                	push   %r12
+  800c7b:	53                   	push   %rbx
+  800c7c:	48 83 ec 18          	sub    $0x18,%rsp
+  800c80:	89 fb                	mov    %edi,%ebx
+  800c82:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c85:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c89:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800c90:	00 00 00 
+  800c93:	ff d0                	call   *%rax
+  800c95:	85 c0                	test   %eax,%eax
+  800c97:	78 38                	js     800cd1 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c99:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c9d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ca1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800ca5:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800cac:	00 00 00 
+  800caf:	ff d0                	call   *%rax
+  800cb1:	85 c0                	test   %eax,%eax
+  800cb3:	78 1c                	js     800cd1 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800cb5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800cba:	74 20                	je     800cdc <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cbc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800cc0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cc4:	48 85 c0             	test   %rax,%rax
+  800cc7:	74 47                	je     800d10 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cc9:	44 89 e6             	mov    %r12d,%esi
+  800ccc:	4c 89 ef             	mov    %r13,%rdi
+  800ccf:	ff d0                	call   *%rax
+}
+  800cd1:	48 83 c4 18          	add    $0x18,%rsp
+  800cd5:	5b                   	pop    %rbx
+  800cd6:	41 5c                	pop    %r12
+  800cd8:	41 5d                	pop    %r13
+  800cda:	5d                   	pop    %rbp
+  800cdb:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cdc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ce3:	00 00 00 
+  800ce6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cec:	89 da                	mov    %ebx,%edx
+  800cee:	48 bf 30 47 80 00 00 	movabs $0x804730,%rdi
+  800cf5:	00 00 00 
+  800cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cfd:	48 b9 ed 34 80 00 00 	movabs $0x8034ed,%rcx
+  800d04:	00 00 00 
+  800d07:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d09:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d0e:	eb c1                	jmp    800cd1 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d10:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d15:	eb ba                	jmp    800cd1 <ftruncate+0x5e>
+
+0000000000800d17 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d17:	55                   	push   %rbp
+  800d18:	48 89 e5             	mov    %rsp,%rbp
+  800d1b:	41 54                	push   %r12
+  800d1d:	53                   	push   %rbx
+  800d1e:	48 83 ec 10          	sub    $0x10,%rsp
+  800d22:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d25:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d29:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  800d30:	00 00 00 
+  800d33:	ff d0                	call   *%rax
+  800d35:	85 c0                	test   %eax,%eax
+  800d37:	78 4e                	js     800d87 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d39:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d3d:	41 8b 3c 24          	mov    (%r12),%edi
+  800d41:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d45:	48 b8 8b 07 80 00 00 	movabs $0x80078b,%rax
+  800d4c:	00 00 00 
+  800d4f:	ff d0                	call   *%rax
+  800d51:	85 c0                	test   %eax,%eax
+  800d53:	78 32                	js     800d87 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d55:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d59:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d5e:	74 30                	je     800d90 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d60:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d63:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d6a:	00 00 00 
+    stat->st_isdir = 0;
+  800d6d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d74:	00 00 00 
+    stat->st_dev = dev;
+  800d77:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d7e:	48 89 de             	mov    %rbx,%rsi
+  800d81:	4c 89 e7             	mov    %r12,%rdi
+  800d84:	ff 50 28             	call   *0x28(%rax)
+}
+  800d87:	48 83 c4 10          	add    $0x10,%rsp
+  800d8b:	5b                   	pop    %rbx
+  800d8c:	41 5c                	pop    %r12
+  800d8e:	5d                   	pop    %rbp
+  800d8f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d90:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d95:	eb f0                	jmp    800d87 <fstat+0x70>
+
+0000000000800d97 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d97:	55                   	push   %rbp
+  800d98:	48 89 e5             	mov    %rsp,%rbp
+  800d9b:	41 54                	push   %r12
+  800d9d:	53                   	push   %rbx
+  800d9e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800da1:	be 00 00 00 00       	mov    $0x0,%esi
+  800da6:	48 b8 05 1f 80 00 00 	movabs $0x801f05,%rax
+  800dad:	00 00 00 
+  800db0:	ff d0                	call   *%rax
+  800db2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800db4:	85 c0                	test   %eax,%eax
+  800db6:	78 25                	js     800ddd <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800db8:	4c 89 e6             	mov    %r12,%rsi
+  800dbb:	89 c7                	mov    %eax,%edi
+  800dbd:	48 b8 17 0d 80 00 00 	movabs $0x800d17,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dcc:	89 df                	mov    %ebx,%edi
+  800dce:	48 b8 a5 08 80 00 00 	movabs $0x8008a5,%rax
+  800dd5:	00 00 00 
+  800dd8:	ff d0                	call   *%rax
+
+    return res;
+  800dda:	44 89 e3             	mov    %r12d,%ebx
+}
+  800ddd:	89 d8                	mov    %ebx,%eax
+  800ddf:	5b                   	pop    %rbx
+  800de0:	41 5c                	pop    %r12
+  800de2:	5d                   	pop    %rbp
+  800de3:	c3                   	ret
+
+0000000000800de4 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800de4:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800deb:	00 00 00 
+  800dee:	83 38 00             	cmpl   $0x0,(%rax)
+  800df1:	74 0a                	je     800dfd <fsenv+0x19>
+    return envid;
+}
+  800df3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dfa:	00 00 
+  800dfc:	c3                   	ret
+fsenv(void) {
+  800dfd:	55                   	push   %rbp
+  800dfe:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800e01:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e06:	48 b8 6e 46 80 00 00 	movabs $0x80466e,%rax
+  800e0d:	00 00 00 
+  800e10:	ff d0                	call   *%rax
+  800e12:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800e19:	00 00 
+}
+  800e1b:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800e22:	00 00 
+  800e24:	5d                   	pop    %rbp
+  800e25:	c3                   	ret
+
+0000000000800e26 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800e26:	55                   	push   %rbp
+  800e27:	48 89 e5             	mov    %rsp,%rbp
+  800e2a:	41 54                	push   %r12
+  800e2c:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800e2d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e32:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e37:	48 89 de             	mov    %rbx,%rsi
+  800e3a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e3f:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  800e46:	00 00 00 
+  800e49:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e4b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e52:	00 00 00 
+  800e55:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e5b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e60:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e65:	48 89 de             	mov    %rbx,%rsi
+  800e68:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e6d:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  800e74:	00 00 00 
+  800e77:	ff d0                	call   *%rax
+  800e79:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e7b:	85 c0                	test   %eax,%eax
+  800e7d:	0f 88 a2 00 00 00    	js     800f25 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e83:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e8a:	00 00 00 
+  800e8d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e93:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e98:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e9a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e9f:	49 bc 37 30 80 00 00 	movabs $0x803037,%r12
+  800ea6:	00 00 00 
+  800ea9:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800eac:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800eb1:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800eb4:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  800ebb:	00 00 00 
+  800ebe:	ff d0                	call   *%rax
+  800ec0:	89 c7                	mov    %eax,%edi
+  800ec2:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800ec8:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800ecd:	48 89 da             	mov    %rbx,%rdx
+  800ed0:	be 09 00 00 00       	mov    $0x9,%esi
+  800ed5:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800ee1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ee6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eeb:	be 00 00 00 00       	mov    $0x0,%esi
+  800ef0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef5:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  800efc:	00 00 00 
+  800eff:	ff d0                	call   *%rax
+  800f01:	89 c3                	mov    %eax,%ebx
+  800f03:	85 c0                	test   %eax,%eax
+  800f05:	78 25                	js     800f2c <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800f07:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f0e:	00 00 00 
+  800f11:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800f17:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800f1e:	00 00 
+    return 0;
+  800f20:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800f25:	89 d8                	mov    %ebx,%eax
+  800f27:	5b                   	pop    %rbx
+  800f28:	41 5c                	pop    %r12
+  800f2a:	5d                   	pop    %rbp
+  800f2b:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800f2c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f31:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f36:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f3b:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  800f42:	00 00 00 
+  800f45:	ff d0                	call   *%rax
+        return res;
+  800f47:	eb dc                	jmp    800f25 <fschan_setup+0xff>
+
+0000000000800f49 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f49:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f50:	00 00 00 
+  800f53:	80 38 00             	cmpb   $0x0,(%rax)
+  800f56:	74 55                	je     800fad <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f58:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f5f:	00 00 00 
+  800f62:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f68:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f6d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f74:	00 00 00 
+  800f77:	3b 0a                	cmp    (%rdx),%ecx
+  800f79:	75 01                	jne    800f7c <fschan+0x33>
+}
+  800f7b:	c3                   	ret
+fschan(void) {
+  800f7c:	55                   	push   %rbp
+  800f7d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f80:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  800f87:	00 00 00 
+  800f8a:	ff d0                	call   *%rax
+  800f8c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f8e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f93:	85 d2                	test   %edx,%edx
+  800f95:	78 02                	js     800f99 <fschan+0x50>
+}
+  800f97:	5d                   	pop    %rbp
+  800f98:	c3                   	ret
+        fschan_enabled = 0;
+  800f99:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800fa0:	00 00 00 
+  800fa3:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800fa6:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fab:	eb ea                	jmp    800f97 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800fad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb2:	c3                   	ret
+
+0000000000800fb3 <fbuf>:
+fbuf(struct Fd *fd) {
+  800fb3:	55                   	push   %rbp
+  800fb4:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800fb7:	48 b8 b2 06 80 00 00 	movabs $0x8006b2,%rax
+  800fbe:	00 00 00 
+  800fc1:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800fc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fc8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800fcc:	77 12                	ja     800fe0 <fbuf+0x2d>
+  800fce:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800fd2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800fd9:	00 00 00 
+  800fdc:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fe0:	48 89 d0             	mov    %rdx,%rax
+  800fe3:	5d                   	pop    %rbp
+  800fe4:	c3                   	ret
+
+0000000000800fe5 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fe5:	55                   	push   %rbp
+  800fe6:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fe9:	48 83 c7 40          	add    $0x40,%rdi
+  800fed:	48 b8 71 30 80 00 00 	movabs $0x803071,%rax
+  800ff4:	00 00 00 
+  800ff7:	ff d0                	call   *%rax
+  800ff9:	84 c0                	test   %al,%al
+  800ffb:	75 02                	jne    800fff <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800ffd:	5d                   	pop    %rbp
+  800ffe:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fff:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  801006:	00 00 00 
+  801009:	ff d0                	call   *%rax
+  80100b:	89 c7                	mov    %eax,%edi
+  80100d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801013:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801018:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101d:	be 0a 00 00 00       	mov    $0xa,%esi
+  801022:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  801029:	00 00 00 
+  80102c:	ff d0                	call   *%rax
+}
+  80102e:	eb cd                	jmp    800ffd <fschan_publish+0x18>
+
+0000000000801030 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801030:	55                   	push   %rbp
+  801031:	48 89 e5             	mov    %rsp,%rbp
+  801034:	41 57                	push   %r15
+  801036:	41 56                	push   %r14
+  801038:	41 55                	push   %r13
+  80103a:	41 54                	push   %r12
+  80103c:	53                   	push   %rbx
+  80103d:	48 83 ec 48          	sub    $0x48,%rsp
+  801041:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801045:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801049:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80104c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801050:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801053:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80105a:	00 00 00 
+  80105d:	8b 02                	mov    (%rdx),%eax
+  80105f:	83 c0 01             	add    $0x1,%eax
+  801062:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801067:	0f 44 c1             	cmove  %ecx,%eax
+  80106a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80106c:	4d 85 c0             	test   %r8,%r8
+  80106f:	74 2c                	je     80109d <fschan_rw+0x6d>
+  801071:	45 89 ce             	mov    %r9d,%r14d
+  801074:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80107b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80107f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801085:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80108c:	00 
+  80108d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801093:	b8 01 00 00 00       	mov    $0x1,%eax
+  801098:	e9 41 01 00 00       	jmp    8011de <fschan_rw+0x1ae>
+  80109d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8010a1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010a5:	e9 9c 01 00 00       	jmp    801246 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8010aa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8010ae:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8010b1:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8010b4:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8010b7:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8010bb:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8010bf:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8010c3:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8010c7:	48 89 da             	mov    %rbx,%rdx
+  8010ca:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  8010d1:	00 00 00 
+  8010d4:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8010d6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8010da:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  8010e1:	00 00 00 
+  8010e4:	ff d0                	call   *%rax
+            queued += blk;
+  8010e6:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010e9:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010ed:	4d 39 fc             	cmp    %r15,%r12
+  8010f0:	73 6b                	jae    80115d <fschan_rw+0x12d>
+  8010f2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010f6:	77 65                	ja     80115d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010fc:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801100:	48 b8 4c 30 80 00 00 	movabs $0x80304c,%rax
+  801107:	00 00 00 
+  80110a:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80110c:	4c 89 fb             	mov    %r15,%rbx
+  80110f:	4c 29 e3             	sub    %r12,%rbx
+  801112:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801117:	48 39 d3             	cmp    %rdx,%rbx
+  80111a:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80111e:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801122:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801126:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80112a:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80112d:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80112f:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801136:	00 00 00 
+  801139:	8b 09                	mov    (%rcx),%ecx
+  80113b:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80113e:	83 fe 03             	cmp    $0x3,%esi
+  801141:	0f 85 63 ff ff ff    	jne    8010aa <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801147:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80114b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80114e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801151:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801154:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801158:	e9 79 ff ff ff       	jmp    8010d6 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80115d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801161:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801168:	48 89 df             	mov    %rbx,%rdi
+  80116b:	48 b8 0f 31 80 00 00 	movabs $0x80310f,%rax
+  801172:	00 00 00 
+  801175:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801177:	48 89 df             	mov    %rbx,%rdi
+  80117a:	48 b8 9d 30 80 00 00 	movabs $0x80309d,%rax
+  801181:	00 00 00 
+  801184:	ff d0                	call   *%rax
+  801186:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80118a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80118e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801192:	75 25                	jne    8011b9 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801194:	8b 40 04             	mov    0x4(%rax),%eax
+  801197:	85 c0                	test   %eax,%eax
+  801199:	0f 88 86 00 00 00    	js     801225 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80119f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8011a3:	74 5b                	je     801200 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8011a5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8011a9:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8011ad:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8011b1:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8011b5:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8011b9:	48 89 df             	mov    %rbx,%rdi
+  8011bc:	48 b8 c4 30 80 00 00 	movabs $0x8030c4,%rax
+  8011c3:	00 00 00 
+  8011c6:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8011c8:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8011cc:	83 f0 01             	xor    $0x1,%eax
+  8011cf:	4d 39 fc             	cmp    %r15,%r12
+  8011d2:	0f 92 c2             	setb   %dl
+  8011d5:	84 c2                	test   %al,%dl
+  8011d7:	75 05                	jne    8011de <fschan_rw+0x1ae>
+  8011d9:	45 85 ed             	test   %r13d,%r13d
+  8011dc:	74 50                	je     80122e <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011de:	4d 39 fc             	cmp    %r15,%r12
+  8011e1:	0f 92 c1             	setb   %cl
+  8011e4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011e8:	0f 96 c2             	setbe  %dl
+  8011eb:	84 d1                	test   %dl,%cl
+  8011ed:	0f 84 6a ff ff ff    	je     80115d <fschan_rw+0x12d>
+  8011f3:	84 c0                	test   %al,%al
+  8011f5:	0f 85 fd fe ff ff    	jne    8010f8 <fschan_rw+0xc8>
+  8011fb:	e9 5d ff ff ff       	jmp    80115d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801200:	48 63 d0             	movslq %eax,%rdx
+  801203:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801207:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80120b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80120f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801213:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801217:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  80121e:	00 00 00 
+  801221:	ff d0                	call   *%rax
+  801223:	eb 80                	jmp    8011a5 <fschan_rw+0x175>
+                err = msg->fm_res;
+  801225:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801228:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80122c:	eb 8b                	jmp    8011b9 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80122e:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  801233:	0f 85 68 fe ff ff    	jne    8010a1 <fschan_rw+0x71>
+  801239:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80123c:	85 c0                	test   %eax,%eax
+  80123e:	0f 84 5d fe ff ff    	je     8010a1 <fschan_rw+0x71>
+  801244:	48 98                	cltq
+}
+  801246:	48 83 c4 48          	add    $0x48,%rsp
+  80124a:	5b                   	pop    %rbx
+  80124b:	41 5c                	pop    %r12
+  80124d:	41 5d                	pop    %r13
+  80124f:	41 5e                	pop    %r14
+  801251:	41 5f                	pop    %r15
+  801253:	5d                   	pop    %rbp
+  801254:	c3                   	ret
+
+0000000000801255 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801255:	55                   	push   %rbp
+  801256:	48 89 e5             	mov    %rsp,%rbp
+  801259:	41 56                	push   %r14
+  80125b:	41 55                	push   %r13
+  80125d:	41 54                	push   %r12
+  80125f:	53                   	push   %rbx
+  801260:	48 83 ec 10          	sub    $0x10,%rsp
+  801264:	49 89 fe             	mov    %rdi,%r14
+  801267:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80126a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80126e:	48 29 f3             	sub    %rsi,%rbx
+  801271:	48 39 d3             	cmp    %rdx,%rbx
+  801274:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801278:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80127f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801280:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801285:	49 bd ce 2e 80 00 00 	movabs $0x802ece,%r13
+  80128c:	00 00 00 
+  80128f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801296:	76 1e                	jbe    8012b6 <mmap_fault+0x61>
+  801298:	4c 01 e7             	add    %r12,%rdi
+  80129b:	41 ff d5             	call   *%r13
+  80129e:	84 c0                	test   %al,%al
+  8012a0:	75 14                	jne    8012b6 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8012a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012a6:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8012ad:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8012b1:	48 39 df             	cmp    %rbx,%rdi
+  8012b4:	72 e2                	jb     801298 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8012b6:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8012bd:	00 00 00 
+  8012c0:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8012c7:	00 00 00 
+  8012ca:	4c 89 f0             	mov    %r14,%rax
+  8012cd:	48 29 d0             	sub    %rdx,%rax
+  8012d0:	48 c1 f8 03          	sar    $0x3,%rax
+  8012d4:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012db:	aa aa aa 
+  8012de:	48 0f af c2          	imul   %rdx,%rax
+  8012e2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012e6:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012eb:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012ef:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012f1:	44 89 e0             	mov    %r12d,%eax
+  8012f4:	41 03 46 10          	add    0x10(%r14),%eax
+  8012f8:	41 2b 06             	sub    (%r14),%eax
+  8012fb:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012fe:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801302:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  801306:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80130a:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80130d:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+  801319:	89 c7                	mov    %eax,%edi
+  80131b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801321:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801326:	48 89 da             	mov    %rbx,%rdx
+  801329:	be 0f 00 00 00       	mov    $0xf,%esi
+  80132e:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  801335:	00 00 00 
+  801338:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80133a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801343:	4c 89 e6             	mov    %r12,%rsi
+  801346:	bf 00 00 00 00       	mov    $0x0,%edi
+  80134b:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  801352:	00 00 00 
+  801355:	ff d0                	call   *%rax
+  801357:	48 98                	cltq
+}
+  801359:	48 83 c4 10          	add    $0x10,%rsp
+  80135d:	5b                   	pop    %rbx
+  80135e:	41 5c                	pop    %r12
+  801360:	41 5d                	pop    %r13
+  801362:	41 5e                	pop    %r14
+  801364:	5d                   	pop    %rbp
+  801365:	c3                   	ret
+
+0000000000801366 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801366:	48 8b 37             	mov    (%rdi),%rsi
+  801369:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801370:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801377:	00 00 00 
+  80137a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80137f:	eb 0f                	jmp    801390 <mmap_pgfault+0x2a>
+  801381:	c3                   	ret
+  801382:	48 83 c1 01          	add    $0x1,%rcx
+  801386:	48 83 c2 18          	add    $0x18,%rdx
+  80138a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80138e:	74 6e                	je     8013fe <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801390:	48 8b 02             	mov    (%rdx),%rax
+  801393:	48 83 e8 01          	sub    $0x1,%rax
+  801397:	48 39 f0             	cmp    %rsi,%rax
+  80139a:	73 e6                	jae    801382 <mmap_pgfault+0x1c>
+  80139c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8013a0:	73 e0                	jae    801382 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013a2:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8013a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ab:	f6 c2 01             	test   $0x1,%dl
+  8013ae:	75 d1                	jne    801381 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8013b0:	f6 c2 02             	test   $0x2,%dl
+  8013b3:	74 1a                	je     8013cf <mmap_pgfault+0x69>
+  8013b5:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013be:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8013c5:	00 00 00 
+  8013c8:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8013cd:	74 35                	je     801404 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8013cf:	55                   	push   %rbp
+  8013d0:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013d3:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013d7:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013de:	00 00 00 
+  8013e1:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013e5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013ea:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  8013f1:	00 00 00 
+  8013f4:	ff d0                	call   *%rax
+  8013f6:	48 85 c0             	test   %rax,%rax
+  8013f9:	0f 9f c0             	setg   %al
+}
+  8013fc:	5d                   	pop    %rbp
+  8013fd:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801403:	c3                   	ret
+}
+  801404:	c3                   	ret
+
+0000000000801405 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  801405:	55                   	push   %rbp
+  801406:	48 89 e5             	mov    %rsp,%rbp
+  801409:	41 54                	push   %r12
+  80140b:	53                   	push   %rbx
+  80140c:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80140f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801416:	00 00 00 
+  801419:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80141e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801422:	74 15                	je     801439 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801424:	48 83 c3 01          	add    $0x1,%rbx
+  801428:	48 83 c0 18          	add    $0x18,%rax
+  80142c:	48 83 fb 20          	cmp    $0x20,%rbx
+  801430:	75 ec                	jne    80141e <mmap_alloc+0x19>
+    return NULL;
+  801432:	b8 00 00 00 00       	mov    $0x0,%eax
+  801437:	eb 52                	jmp    80148b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801439:	4c 89 e7             	mov    %r12,%rdi
+  80143c:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  801443:	00 00 00 
+  801446:	ff d0                	call   *%rax
+  801448:	41 89 c1             	mov    %eax,%r9d
+  80144b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801452:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801456:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80145c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801461:	4c 89 e6             	mov    %r12,%rsi
+  801464:	bf 00 00 00 00       	mov    $0x0,%edi
+  801469:	48 b8 d5 02 80 00 00 	movabs $0x8002d5,%rax
+  801470:	00 00 00 
+  801473:	ff d0                	call   *%rax
+  801475:	85 c0                	test   %eax,%eax
+  801477:	78 17                	js     801490 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801479:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80147d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801484:	00 00 00 
+  801487:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80148b:	5b                   	pop    %rbx
+  80148c:	41 5c                	pop    %r12
+  80148e:	5d                   	pop    %rbp
+  80148f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801490:	b8 00 00 00 00       	mov    $0x0,%eax
+  801495:	eb f4                	jmp    80148b <mmap_alloc+0x86>
+
+0000000000801497 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  801497:	55                   	push   %rbp
+  801498:	48 89 e5             	mov    %rsp,%rbp
+  80149b:	41 56                	push   %r14
+  80149d:	41 55                	push   %r13
+  80149f:	41 54                	push   %r12
+  8014a1:	53                   	push   %rbx
+  8014a2:	48 83 ec 10          	sub    $0x10,%rsp
+  8014a6:	41 89 fc             	mov    %edi,%r12d
+  8014a9:	49 89 f5             	mov    %rsi,%r13
+  8014ac:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014af:	48 89 f0             	mov    %rsi,%rax
+  8014b2:	48 09 d0             	or     %rdx,%rax
+  8014b5:	75 0d                	jne    8014c4 <fsipc+0x2d>
+  8014b7:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8014ba:	83 f8 04             	cmp    $0x4,%eax
+  8014bd:	76 7d                	jbe    80153c <fsipc+0xa5>
+  8014bf:	83 ff 0d             	cmp    $0xd,%edi
+  8014c2:	74 78                	je     80153c <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8014c4:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  8014cb:	00 00 00 
+  8014ce:	ff d0                	call   *%rax
+  8014d0:	89 c7                	mov    %eax,%edi
+  8014d2:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8014d9:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014e0:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014e7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014ed:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014f4:	00 00 00 
+  8014f7:	44 89 e6             	mov    %r12d,%esi
+  8014fa:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  801501:	00 00 00 
+  801504:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801506:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80150d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80150e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801513:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801517:	4c 89 ee             	mov    %r13,%rsi
+  80151a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80151f:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  801526:	00 00 00 
+  801529:	ff d0                	call   *%rax
+  80152b:	89 c3                	mov    %eax,%ebx
+}
+  80152d:	89 d8                	mov    %ebx,%eax
+  80152f:	48 83 c4 10          	add    $0x10,%rsp
+  801533:	5b                   	pop    %rbx
+  801534:	41 5c                	pop    %r12
+  801536:	41 5d                	pop    %r13
+  801538:	41 5e                	pop    %r14
+  80153a:	5d                   	pop    %rbp
+  80153b:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80153c:	48 b8 49 0f 80 00 00 	movabs $0x800f49,%rax
+  801543:	00 00 00 
+  801546:	ff d0                	call   *%rax
+  801548:	49 89 c6             	mov    %rax,%r14
+  80154b:	48 85 c0             	test   %rax,%rax
+  80154e:	0f 84 70 ff ff ff    	je     8014c4 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801554:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801558:	48 b8 4c 30 80 00 00 	movabs $0x80304c,%rax
+  80155f:	00 00 00 
+  801562:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801564:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801567:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80156e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801572:	ba 10 00 00 00       	mov    $0x10,%edx
+  801577:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80157e:	00 00 00 
+  801581:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  801588:	00 00 00 
+  80158b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80158d:	4c 89 f7             	mov    %r14,%rdi
+  801590:	48 b8 e5 0f 80 00 00 	movabs $0x800fe5,%rax
+  801597:	00 00 00 
+  80159a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80159c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8015a3:	4c 89 f7             	mov    %r14,%rdi
+  8015a6:	48 b8 0f 31 80 00 00 	movabs $0x80310f,%rax
+  8015ad:	00 00 00 
+  8015b0:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8015b2:	4c 89 f7             	mov    %r14,%rdi
+  8015b5:	48 b8 9d 30 80 00 00 	movabs $0x80309d,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8015c1:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8015c4:	41 83 fc 05          	cmp    $0x5,%r12d
+  8015c8:	75 04                	jne    8015ce <fsipc+0x137>
+  8015ca:	85 db                	test   %ebx,%ebx
+  8015cc:	79 14                	jns    8015e2 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8015ce:	4c 89 f7             	mov    %r14,%rdi
+  8015d1:	48 b8 c4 30 80 00 00 	movabs $0x8030c4,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015dd:	e9 4b ff ff ff       	jmp    80152d <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015e2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015e6:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015eb:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015f2:	00 00 00 
+  8015f5:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  8015fc:	00 00 00 
+  8015ff:	ff d0                	call   *%rax
+  801601:	eb cb                	jmp    8015ce <fsipc+0x137>
+
+0000000000801603 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  801603:	55                   	push   %rbp
+  801604:	48 89 e5             	mov    %rsp,%rbp
+  801607:	41 57                	push   %r15
+  801609:	41 56                	push   %r14
+  80160b:	41 55                	push   %r13
+  80160d:	41 54                	push   %r12
+  80160f:	53                   	push   %rbx
+  801610:	48 83 ec 18          	sub    $0x18,%rsp
+  801614:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  801618:	49 89 f6             	mov    %rsi,%r14
+  80161b:	49 89 d4             	mov    %rdx,%r12
+  80161e:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  801621:	48 b8 49 0f 80 00 00 	movabs $0x800f49,%rax
+  801628:	00 00 00 
+  80162b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80162d:	48 85 c0             	test   %rax,%rax
+  801630:	0f 85 96 00 00 00    	jne    8016cc <devfile_write_direct+0xc9>
+    size_t write = 0;
+  801636:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80163d:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80163e:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801645:	00 00 00 
+    while (n) {
+  801648:	4d 85 e4             	test   %r12,%r12
+  80164b:	74 79                	je     8016c6 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80164d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801652:	49 39 dc             	cmp    %rbx,%r12
+  801655:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801659:	48 89 da             	mov    %rbx,%rdx
+  80165c:	4c 89 f6             	mov    %r14,%rsi
+  80165f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801666:	00 00 00 
+  801669:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  801670:	00 00 00 
+  801673:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801675:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801679:	8b 40 0c             	mov    0xc(%rax),%eax
+  80167c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80167f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801682:	44 01 e8             	add    %r13d,%eax
+  801685:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801689:	41 0f 44 c5          	cmove  %r13d,%eax
+  80168d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801691:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801695:	48 89 da             	mov    %rbx,%rdx
+  801698:	be 00 00 00 00       	mov    $0x0,%esi
+  80169d:	bf 04 00 00 00       	mov    $0x4,%edi
+  8016a2:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8016a9:	00 00 00 
+  8016ac:	ff d0                	call   *%rax
+        if (res < 0)
+  8016ae:	85 c0                	test   %eax,%eax
+  8016b0:	78 4a                	js     8016fc <devfile_write_direct+0xf9>
+        buf += res;
+  8016b2:	48 98                	cltq
+  8016b4:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8016b7:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8016bb:	49 29 c4             	sub    %rax,%r12
+  8016be:	75 8d                	jne    80164d <devfile_write_direct+0x4a>
+    return write;
+  8016c0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016c4:	eb 27                	jmp    8016ed <devfile_write_direct+0xea>
+    size_t write = 0;
+  8016c6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8016ca:	eb f4                	jmp    8016c0 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8016cc:	45 89 e9             	mov    %r13d,%r9d
+  8016cf:	4d 89 e0             	mov    %r12,%r8
+  8016d2:	4c 89 f1             	mov    %r14,%rcx
+  8016d5:	ba 04 00 00 00       	mov    $0x4,%edx
+  8016da:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016de:	48 89 c7             	mov    %rax,%rdi
+  8016e1:	48 b8 30 10 80 00 00 	movabs $0x801030,%rax
+  8016e8:	00 00 00 
+  8016eb:	ff d0                	call   *%rax
+}
+  8016ed:	48 83 c4 18          	add    $0x18,%rsp
+  8016f1:	5b                   	pop    %rbx
+  8016f2:	41 5c                	pop    %r12
+  8016f4:	41 5d                	pop    %r13
+  8016f6:	41 5e                	pop    %r14
+  8016f8:	41 5f                	pop    %r15
+  8016fa:	5d                   	pop    %rbp
+  8016fb:	c3                   	ret
+            return res;
+  8016fc:	48 98                	cltq
+  8016fe:	eb ed                	jmp    8016ed <devfile_write_direct+0xea>
+
+0000000000801700 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  801700:	55                   	push   %rbp
+  801701:	48 89 e5             	mov    %rsp,%rbp
+  801704:	41 54                	push   %r12
+  801706:	53                   	push   %rbx
+  801707:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80170a:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  801711:	00 00 00 
+  801714:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  801716:	48 85 c0             	test   %rax,%rax
+  801719:	74 71                	je     80178c <fbuf_flush+0x8c>
+  80171b:	48 89 c3             	mov    %rax,%rbx
+  80171e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801723:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  801727:	75 05                	jne    80172e <fbuf_flush+0x2e>
+}
+  801729:	5b                   	pop    %rbx
+  80172a:	41 5c                	pop    %r12
+  80172c:	5d                   	pop    %rbp
+  80172d:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80172e:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801731:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  801735:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80173c:	00 00 00 
+  80173f:	48 89 de             	mov    %rbx,%rsi
+  801742:	48 29 c6             	sub    %rax,%rsi
+  801745:	48 c1 fe 03          	sar    $0x3,%rsi
+  801749:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801750:	aa aa aa 
+  801753:	48 0f af f0          	imul   %rax,%rsi
+  801757:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80175b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801760:	48 01 c6             	add    %rax,%rsi
+  801763:	4c 89 e7             	mov    %r12,%rdi
+  801766:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801772:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801776:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80177d:	00 
+    return res < 0 ? res : 0;
+  80177e:	48 85 c0             	test   %rax,%rax
+  801781:	ba 00 00 00 00       	mov    $0x0,%edx
+  801786:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80178a:	eb 9d                	jmp    801729 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80178c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801791:	eb 96                	jmp    801729 <fbuf_flush+0x29>
+
+0000000000801793 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801793:	55                   	push   %rbp
+  801794:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801797:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80179e:	00 00 00 
+  8017a1:	ff d0                	call   *%rax
+}
+  8017a3:	5d                   	pop    %rbp
+  8017a4:	c3                   	ret
+
+00000000008017a5 <devfile_write>:
+    if (!fd || !buf)
+  8017a5:	48 85 ff             	test   %rdi,%rdi
+  8017a8:	0f 84 d3 01 00 00    	je     801981 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+  8017b2:	41 57                	push   %r15
+  8017b4:	41 56                	push   %r14
+  8017b6:	41 55                	push   %r13
+  8017b8:	41 54                	push   %r12
+  8017ba:	53                   	push   %rbx
+  8017bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8017bf:	49 89 fc             	mov    %rdi,%r12
+  8017c2:	49 89 f6             	mov    %rsi,%r14
+  8017c5:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8017c8:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8017cd:	48 85 f6             	test   %rsi,%rsi
+  8017d0:	0f 84 9c 01 00 00    	je     801972 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8017d6:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  8017dd:	00 00 00 
+  8017e0:	ff d0                	call   *%rax
+  8017e2:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017e5:	48 85 c0             	test   %rax,%rax
+  8017e8:	0f 84 a2 00 00 00    	je     801890 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017ee:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017f3:	4c 89 e7             	mov    %r12,%rdi
+  8017f6:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  8017fd:	00 00 00 
+  801800:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  801802:	83 f8 02             	cmp    $0x2,%eax
+  801805:	0f 8f 85 00 00 00    	jg     801890 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  80180b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801812:	00 00 00 
+  801815:	4d 89 ef             	mov    %r13,%r15
+  801818:	49 29 c7             	sub    %rax,%r15
+  80181b:	49 c1 ff 03          	sar    $0x3,%r15
+  80181f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801826:	aa aa aa 
+  801829:	4c 0f af f8          	imul   %rax,%r15
+  80182d:	49 c1 e7 0e          	shl    $0xe,%r15
+  801831:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801836:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801839:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80183e:	0f 84 d7 00 00 00    	je     80191b <devfile_write+0x176>
+  801844:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801848:	89 c2                	mov    %eax,%edx
+  80184a:	41 03 55 0c          	add    0xc(%r13),%edx
+  80184e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801853:	75 0f                	jne    801864 <devfile_write+0xbf>
+  801855:	48 01 d8             	add    %rbx,%rax
+  801858:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80185e:	0f 86 92 00 00 00    	jbe    8018f6 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801864:	4c 89 e7             	mov    %r12,%rdi
+  801867:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80186e:	00 00 00 
+  801871:	ff d0                	call   *%rax
+  801873:	85 c0                	test   %eax,%eax
+  801875:	78 52                	js     8018c9 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801877:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80187e:	77 7f                	ja     8018ff <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801880:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801885:	0f 85 c2 00 00 00    	jne    80194d <devfile_write+0x1a8>
+  80188b:	e9 94 00 00 00       	jmp    801924 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801890:	4c 89 e7             	mov    %r12,%rdi
+  801893:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  80189a:	00 00 00 
+  80189d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80189f:	85 c0                	test   %eax,%eax
+  8018a1:	79 07                	jns    8018aa <devfile_write+0x105>
+  8018a3:	48 98                	cltq
+  8018a5:	e9 c8 00 00 00       	jmp    801972 <devfile_write+0x1cd>
+  8018aa:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018af:	48 89 da             	mov    %rbx,%rdx
+  8018b2:	4c 89 f6             	mov    %r14,%rsi
+  8018b5:	4c 89 e7             	mov    %r12,%rdi
+  8018b8:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  8018bf:	00 00 00 
+  8018c2:	ff d0                	call   *%rax
+  8018c4:	e9 a9 00 00 00       	jmp    801972 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8018c9:	48 98                	cltq
+  8018cb:	e9 a2 00 00 00       	jmp    801972 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018d0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018d5:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8018da:	4c 89 fe             	mov    %r15,%rsi
+  8018dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018e2:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018ee:	85 c0                	test   %eax,%eax
+  8018f0:	79 45                	jns    801937 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018f2:	48 98                	cltq
+  8018f4:	eb 7c                	jmp    801972 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018f6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018fd:	76 4e                	jbe    80194d <devfile_write+0x1a8>
+  8018ff:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801904:	48 89 da             	mov    %rbx,%rdx
+  801907:	4c 89 f6             	mov    %r14,%rsi
+  80190a:	4c 89 e7             	mov    %r12,%rdi
+  80190d:	48 b8 03 16 80 00 00 	movabs $0x801603,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+  801919:	eb 57                	jmp    801972 <devfile_write+0x1cd>
+  80191b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801922:	77 db                	ja     8018ff <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  801924:	4c 89 ff             	mov    %r15,%rdi
+  801927:	48 b8 ce 2e 80 00 00 	movabs $0x802ece,%rax
+  80192e:	00 00 00 
+  801931:	ff d0                	call   *%rax
+  801933:	84 c0                	test   %al,%al
+  801935:	74 99                	je     8018d0 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  801937:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80193c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801941:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801945:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80194c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80194d:	4c 89 ff             	mov    %r15,%rdi
+  801950:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801954:	48 89 da             	mov    %rbx,%rdx
+  801957:	4c 89 f6             	mov    %r14,%rsi
+  80195a:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801966:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80196a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80196f:	48 89 d8             	mov    %rbx,%rax
+}
+  801972:	48 83 c4 08          	add    $0x8,%rsp
+  801976:	5b                   	pop    %rbx
+  801977:	41 5c                	pop    %r12
+  801979:	41 5d                	pop    %r13
+  80197b:	41 5e                	pop    %r14
+  80197d:	41 5f                	pop    %r15
+  80197f:	5d                   	pop    %rbp
+  801980:	c3                   	ret
+        return E_INVAL;
+  801981:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801986:	c3                   	ret
+
+0000000000801987 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801987:	55                   	push   %rbp
+  801988:	48 89 e5             	mov    %rsp,%rbp
+  80198b:	41 54                	push   %r12
+  80198d:	53                   	push   %rbx
+  80198e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801991:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  801998:	00 00 00 
+  80199b:	ff d0                	call   *%rax
+  80199d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8019a0:	48 89 df             	mov    %rbx,%rdi
+  8019a3:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  8019aa:	00 00 00 
+  8019ad:	ff d0                	call   *%rax
+  8019af:	48 85 c0             	test   %rax,%rax
+  8019b2:	74 17                	je     8019cb <devfile_flush+0x44>
+  8019b4:	48 89 df             	mov    %rbx,%rdi
+  8019b7:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  8019be:	00 00 00 
+  8019c1:	ff d0                	call   *%rax
+  8019c3:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019ca:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019cb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019ce:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8019d5:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8019d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8019e1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019e6:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8019ed:	00 00 00 
+  8019f0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019f2:	45 85 e4             	test   %r12d,%r12d
+  8019f5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019f9:	5b                   	pop    %rbx
+  8019fa:	41 5c                	pop    %r12
+  8019fc:	5d                   	pop    %rbp
+  8019fd:	c3                   	ret
+
+00000000008019fe <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019fe:	55                   	push   %rbp
+  8019ff:	48 89 e5             	mov    %rsp,%rbp
+  801a02:	41 57                	push   %r15
+  801a04:	41 56                	push   %r14
+  801a06:	41 55                	push   %r13
+  801a08:	41 54                	push   %r12
+  801a0a:	53                   	push   %rbx
+  801a0b:	48 83 ec 38          	sub    $0x38,%rsp
+  801a0f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801a13:	49 89 f7             	mov    %rsi,%r15
+  801a16:	48 89 d3             	mov    %rdx,%rbx
+  801a19:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  801a1c:	48 b8 49 0f 80 00 00 	movabs $0x800f49,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a28:	48 85 c0             	test   %rax,%rax
+  801a2b:	75 20                	jne    801a4d <devfile_read_direct+0x4f>
+    bool map = 1;
+  801a2d:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a32:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a39:	00 
+    while (n) {
+  801a3a:	48 85 db             	test   %rbx,%rbx
+  801a3d:	0f 85 df 00 00 00    	jne    801b22 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a43:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a4b:	eb 21                	jmp    801a6e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a4d:	45 89 f1             	mov    %r14d,%r9d
+  801a50:	49 89 d8             	mov    %rbx,%r8
+  801a53:	4c 89 f9             	mov    %r15,%rcx
+  801a56:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a5b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a5f:	48 89 c7             	mov    %rax,%rdi
+  801a62:	48 b8 30 10 80 00 00 	movabs $0x801030,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+}
+  801a6e:	48 83 c4 38          	add    $0x38,%rsp
+  801a72:	5b                   	pop    %rbx
+  801a73:	41 5c                	pop    %r12
+  801a75:	41 5d                	pop    %r13
+  801a77:	41 5e                	pop    %r14
+  801a79:	41 5f                	pop    %r15
+  801a7b:	5d                   	pop    %rbp
+  801a7c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a7d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a81:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a87:	75 1e                	jne    801aa7 <devfile_read_direct+0xa9>
+  801a89:	e9 e2 00 00 00       	jmp    801b70 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a8e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a92:	eb da                	jmp    801a6e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a94:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a98:	0f 85 d0 01 00 00    	jne    801c6e <devfile_read_direct+0x270>
+            map = 0;
+  801a9e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801aa2:	eb 03                	jmp    801aa7 <devfile_read_direct+0xa9>
+  801aa4:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801aa7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801aac:	48 39 d3             	cmp    %rdx,%rbx
+  801aaf:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ab3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ab7:	8b 40 0c             	mov    0xc(%rax),%eax
+  801aba:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801ac1:	00 00 00 
+  801ac4:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801ac6:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801aca:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801ace:	be 00 00 00 00       	mov    $0x0,%esi
+  801ad3:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ad8:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  801adf:	00 00 00 
+  801ae2:	ff d0                	call   *%rax
+        if (res <= 0)
+  801ae4:	85 c0                	test   %eax,%eax
+  801ae6:	0f 8e 63 01 00 00    	jle    801c4f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801aec:	4c 63 e0             	movslq %eax,%r12
+  801aef:	4c 89 e2             	mov    %r12,%rdx
+  801af2:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801af9:	00 00 00 
+  801afc:	4c 89 ff             	mov    %r15,%rdi
+  801aff:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  801b06:	00 00 00 
+  801b09:	ff d0                	call   *%rax
+        buf += res;
+  801b0b:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801b0e:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801b11:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801b15:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801b19:	48 85 db             	test   %rbx,%rbx
+  801b1c:	0f 84 25 ff ff ff    	je     801a47 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801b22:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801b25:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801b29:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801b2d:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b31:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b38:	0f 97 c2             	seta   %dl
+  801b3b:	20 c2                	and    %al,%dl
+  801b3d:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b40:	0f 84 5e ff ff ff    	je     801aa4 <devfile_read_direct+0xa6>
+  801b46:	4c 89 fa             	mov    %r15,%rdx
+  801b49:	4d 89 fd             	mov    %r15,%r13
+  801b4c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b53:	0f 85 4e ff ff ff    	jne    801aa7 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b59:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b5d:	0f 84 1a ff ff ff    	je     801a7d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b63:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b6a:	0f 85 37 ff ff ff    	jne    801aa7 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b70:	48 89 d8             	mov    %rbx,%rax
+  801b73:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b79:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b7e:	48 39 c8             	cmp    %rcx,%rax
+  801b81:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b89:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b8d:	49 89 d4             	mov    %rdx,%r12
+  801b90:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b94:	48 b8 6f 2e 80 00 00 	movabs $0x802e6f,%rax
+  801b9b:	00 00 00 
+  801b9e:	ff d0                	call   *%rax
+  801ba0:	a8 40                	test   $0x40,%al
+  801ba2:	0f 85 b9 00 00 00    	jne    801c61 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801ba8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801baf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bb3:	49 39 c5             	cmp    %rax,%r13
+  801bb6:	72 d8                	jb     801b90 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801bb8:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801bbc:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bc3:	00 00 00 
+  801bc6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bca:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801bcd:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801bcf:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801bd3:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801bd7:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  801bde:	00 00 00 
+  801be1:	ff d0                	call   *%rax
+  801be3:	89 c7                	mov    %eax,%edi
+  801be5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801beb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bf0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bf7:	00 00 00 
+  801bfa:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bff:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  801c06:	00 00 00 
+  801c09:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801c0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c10:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801c14:	4c 89 fe             	mov    %r15,%rsi
+  801c17:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1c:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  801c23:	00 00 00 
+  801c26:	ff d0                	call   *%rax
+  801c28:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801c2b:	48 85 d2             	test   %rdx,%rdx
+  801c2e:	0f 84 5a fe ff ff    	je     801a8e <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c34:	0f 8e 5a fe ff ff    	jle    801a94 <devfile_read_direct+0x96>
+                buf += res;
+  801c3a:	48 98                	cltq
+  801c3c:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c3f:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c42:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c46:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c4a:	e9 ca fe ff ff       	jmp    801b19 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c4f:	41 89 c5             	mov    %eax,%r13d
+  801c52:	48 98                	cltq
+  801c54:	45 85 ed             	test   %r13d,%r13d
+  801c57:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c5c:	e9 0d fe ff ff       	jmp    801a6e <devfile_read_direct+0x70>
+            map = 0;
+  801c61:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c65:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c69:	e9 39 fe ff ff       	jmp    801aa7 <devfile_read_direct+0xa9>
+  801c6e:	48 89 d0             	mov    %rdx,%rax
+  801c71:	e9 f8 fd ff ff       	jmp    801a6e <devfile_read_direct+0x70>
+
+0000000000801c76 <devfile_read>:
+    if (!fd || !buf)
+  801c76:	48 85 ff             	test   %rdi,%rdi
+  801c79:	0f 84 21 02 00 00    	je     801ea0 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c7f:	55                   	push   %rbp
+  801c80:	48 89 e5             	mov    %rsp,%rbp
+  801c83:	41 57                	push   %r15
+  801c85:	41 56                	push   %r14
+  801c87:	41 55                	push   %r13
+  801c89:	41 54                	push   %r12
+  801c8b:	53                   	push   %rbx
+  801c8c:	48 83 ec 28          	sub    $0x28,%rsp
+  801c90:	48 89 fb             	mov    %rdi,%rbx
+  801c93:	49 89 f4             	mov    %rsi,%r12
+  801c96:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c99:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c9e:	48 85 f6             	test   %rsi,%rsi
+  801ca1:	74 4b                	je     801cee <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801ca3:	48 b8 b3 0f 80 00 00 	movabs $0x800fb3,%rax
+  801caa:	00 00 00 
+  801cad:	ff d0                	call   *%rax
+  801caf:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cb2:	48 85 c0             	test   %rax,%rax
+  801cb5:	74 22                	je     801cd9 <devfile_read+0x63>
+  801cb7:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801cbe:	77 19                	ja     801cd9 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801cc0:	be 00 10 00 00       	mov    $0x1000,%esi
+  801cc5:	48 89 df             	mov    %rbx,%rdi
+  801cc8:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  801ccf:	00 00 00 
+  801cd2:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cd4:	83 f8 02             	cmp    $0x2,%eax
+  801cd7:	7e 40                	jle    801d19 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801cd9:	48 89 df             	mov    %rbx,%rdi
+  801cdc:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  801ce3:	00 00 00 
+  801ce6:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801ce8:	85 c0                	test   %eax,%eax
+  801cea:	79 11                	jns    801cfd <devfile_read+0x87>
+  801cec:	48 98                	cltq
+}
+  801cee:	48 83 c4 28          	add    $0x28,%rsp
+  801cf2:	5b                   	pop    %rbx
+  801cf3:	41 5c                	pop    %r12
+  801cf5:	41 5d                	pop    %r13
+  801cf7:	41 5e                	pop    %r14
+  801cf9:	41 5f                	pop    %r15
+  801cfb:	5d                   	pop    %rbp
+  801cfc:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cfd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801d02:	4c 89 ea             	mov    %r13,%rdx
+  801d05:	4c 89 e6             	mov    %r12,%rsi
+  801d08:	48 89 df             	mov    %rbx,%rdi
+  801d0b:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801d12:	00 00 00 
+  801d15:	ff d0                	call   *%rax
+  801d17:	eb d5                	jmp    801cee <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801d19:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801d1d:	48 89 df             	mov    %rbx,%rdi
+  801d20:	48 b8 00 17 80 00 00 	movabs $0x801700,%rax
+  801d27:	00 00 00 
+  801d2a:	ff d0                	call   *%rax
+  801d2c:	85 c0                	test   %eax,%eax
+  801d2e:	0f 88 33 01 00 00    	js     801e67 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d34:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d3b:	00 00 00 
+  801d3e:	4c 89 f0             	mov    %r14,%rax
+  801d41:	48 29 d0             	sub    %rdx,%rax
+  801d44:	48 c1 f8 03          	sar    $0x3,%rax
+  801d48:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d4f:	aa aa aa 
+  801d52:	48 0f af c2          	imul   %rdx,%rax
+  801d56:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d5a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d5e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d61:	41 39 06             	cmp    %eax,(%r14)
+  801d64:	75 0d                	jne    801d73 <devfile_read+0xfd>
+  801d66:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d69:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d6d:	0f 84 fb 00 00 00    	je     801e6e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d73:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d78:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d7c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d7f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d83:	48 89 c7             	mov    %rax,%rdi
+  801d86:	48 b8 ce 2e 80 00 00 	movabs $0x802ece,%rax
+  801d8d:	00 00 00 
+  801d90:	ff d0                	call   *%rax
+  801d92:	84 c0                	test   %al,%al
+  801d94:	75 27                	jne    801dbd <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d96:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d9b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801da0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801da4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da9:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	0f 88 dc 00 00 00    	js     801e99 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801dbd:	44 89 f8             	mov    %r15d,%eax
+  801dc0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801dc5:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801dc7:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801dce:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801dcf:	8b 43 10             	mov    0x10(%rbx),%eax
+  801dd2:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801dd6:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801dd9:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801dde:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801de2:	48 89 df             	mov    %rbx,%rdi
+  801de5:	48 b8 fe 19 80 00 00 	movabs $0x8019fe,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801df1:	48 85 c0             	test   %rax,%rax
+  801df4:	0f 88 f4 fe ff ff    	js     801cee <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dfa:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dfd:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801e00:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801e03:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801e07:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801e0b:	48 63 d1             	movslq %ecx,%rdx
+  801e0e:	48 01 d0             	add    %rdx,%rax
+  801e11:	4d 63 ff             	movslq %r15d,%r15
+  801e14:	4c 29 f8             	sub    %r15,%rax
+  801e17:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e1c:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801e20:	48 85 c0             	test   %rax,%rax
+  801e23:	0f 8e c5 fe ff ff    	jle    801cee <devfile_read+0x78>
+    n = MIN(n, res);
+  801e29:	4c 39 e8             	cmp    %r13,%rax
+  801e2c:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e30:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e33:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e37:	48 63 f6             	movslq %esi,%rsi
+  801e3a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e3f:	48 01 c6             	add    %rax,%rsi
+  801e42:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e46:	48 01 c6             	add    %rax,%rsi
+  801e49:	4c 89 ea             	mov    %r13,%rdx
+  801e4c:	4c 89 e7             	mov    %r12,%rdi
+  801e4f:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  801e56:	00 00 00 
+  801e59:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e5b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e5f:	4c 89 e8             	mov    %r13,%rax
+  801e62:	e9 87 fe ff ff       	jmp    801cee <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e67:	48 98                	cltq
+  801e69:	e9 80 fe ff ff       	jmp    801cee <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e6e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e72:	41 39 d7             	cmp    %edx,%r15d
+  801e75:	0f 8c f8 fe ff ff    	jl     801d73 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e7b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e7f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e82:	41 39 cf             	cmp    %ecx,%r15d
+  801e85:	0f 8d e8 fe ff ff    	jge    801d73 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e8b:	4d 63 ff             	movslq %r15d,%r15
+  801e8e:	4c 29 f8             	sub    %r15,%rax
+  801e91:	48 63 d2             	movslq %edx,%rdx
+  801e94:	48 01 d0             	add    %rdx,%rax
+  801e97:	eb 87                	jmp    801e20 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e99:	48 98                	cltq
+  801e9b:	e9 4e fe ff ff       	jmp    801cee <devfile_read+0x78>
+        return E_INVAL;
+  801ea0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801ea5:	c3                   	ret
+
+0000000000801ea6 <fs_channel>:
+fs_channel(bool enable) {
+  801ea6:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801ea8:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801eaf:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801eb1:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb6:	40 84 ff             	test   %dil,%dil
+  801eb9:	74 47                	je     801f02 <fs_channel+0x5c>
+  801ebb:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ec2:	00 00 00 
+  801ec5:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801ecb:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ed2:	00 00 00 
+  801ed5:	3b 08                	cmp    (%rax),%ecx
+  801ed7:	74 29                	je     801f02 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801ed9:	55                   	push   %rbp
+  801eda:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801edd:	48 b8 26 0e 80 00 00 	movabs $0x800e26,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801eeb:	85 c0                	test   %eax,%eax
+  801eed:	78 04                	js     801ef3 <fs_channel+0x4d>
+}
+  801eef:	89 d0                	mov    %edx,%eax
+  801ef1:	5d                   	pop    %rbp
+  801ef2:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ef3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801efa:	00 00 00 
+  801efd:	c6 00 00             	movb   $0x0,(%rax)
+  801f00:	eb ed                	jmp    801eef <fs_channel+0x49>
+}
+  801f02:	89 d0                	mov    %edx,%eax
+  801f04:	c3                   	ret
+
+0000000000801f05 <open>:
+open(const char *path, int mode) {
+  801f05:	55                   	push   %rbp
+  801f06:	48 89 e5             	mov    %rsp,%rbp
+  801f09:	41 55                	push   %r13
+  801f0b:	41 54                	push   %r12
+  801f0d:	53                   	push   %rbx
+  801f0e:	48 83 ec 18          	sub    $0x18,%rsp
+  801f12:	49 89 fc             	mov    %rdi,%r12
+  801f15:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f18:	48 b8 d4 3d 80 00 00 	movabs $0x803dd4,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f2a:	0f 87 8f 00 00 00    	ja     801fbf <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f30:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f34:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  801f3b:	00 00 00 
+  801f3e:	ff d0                	call   *%rax
+  801f40:	89 c3                	mov    %eax,%ebx
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 55                	js     801f9b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f46:	4c 89 e6             	mov    %r12,%rsi
+  801f49:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f50:	00 00 00 
+  801f53:	48 89 df             	mov    %rbx,%rdi
+  801f56:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f62:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f6e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f72:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f77:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	89 c3                	mov    %eax,%ebx
+  801f85:	85 c0                	test   %eax,%eax
+  801f87:	78 1f                	js     801fa8 <open+0xa3>
+    return fd2num(fd);
+  801f89:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f8d:	48 b8 b2 06 80 00 00 	movabs $0x8006b2,%rax
+  801f94:	00 00 00 
+  801f97:	ff d0                	call   *%rax
+  801f99:	89 c3                	mov    %eax,%ebx
+}
+  801f9b:	89 d8                	mov    %ebx,%eax
+  801f9d:	48 83 c4 18          	add    $0x18,%rsp
+  801fa1:	5b                   	pop    %rbx
+  801fa2:	41 5c                	pop    %r12
+  801fa4:	41 5d                	pop    %r13
+  801fa6:	5d                   	pop    %rbp
+  801fa7:	c3                   	ret
+        fd_close(fd, 0);
+  801fa8:	be 00 00 00 00       	mov    $0x0,%esi
+  801fad:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fb1:	48 b8 fb 07 80 00 00 	movabs $0x8007fb,%rax
+  801fb8:	00 00 00 
+  801fbb:	ff d0                	call   *%rax
+        return res;
+  801fbd:	eb dc                	jmp    801f9b <open+0x96>
+        return -E_BAD_PATH;
+  801fbf:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801fc4:	eb d5                	jmp    801f9b <open+0x96>
+
+0000000000801fc6 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801fc6:	55                   	push   %rbp
+  801fc7:	48 89 e5             	mov    %rsp,%rbp
+  801fca:	41 56                	push   %r14
+  801fcc:	41 55                	push   %r13
+  801fce:	41 54                	push   %r12
+  801fd0:	53                   	push   %rbx
+  801fd1:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801fd5:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fdc:	00 00 00 
+  801fdf:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fe4:	49 bd 40 07 80 00 00 	movabs $0x800740,%r13
+  801feb:	00 00 00 
+  801fee:	49 be 00 17 80 00 00 	movabs $0x801700,%r14
+  801ff5:	00 00 00 
+  801ff8:	eb 0c                	jmp    802006 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801ffa:	83 c3 01             	add    $0x1,%ebx
+  801ffd:	49 83 c4 18          	add    $0x18,%r12
+  802001:	83 fb 20             	cmp    $0x20,%ebx
+  802004:	74 1d                	je     802023 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802006:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80200b:	74 ed                	je     801ffa <file_flush_buffers+0x34>
+  80200d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802011:	89 df                	mov    %ebx,%edi
+  802013:	41 ff d5             	call   *%r13
+  802016:	85 c0                	test   %eax,%eax
+  802018:	78 e0                	js     801ffa <file_flush_buffers+0x34>
+  80201a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80201e:	41 ff d6             	call   *%r14
+  802021:	eb d7                	jmp    801ffa <file_flush_buffers+0x34>
+}
+  802023:	48 83 c4 10          	add    $0x10,%rsp
+  802027:	5b                   	pop    %rbx
+  802028:	41 5c                	pop    %r12
+  80202a:	41 5d                	pop    %r13
+  80202c:	41 5e                	pop    %r14
+  80202e:	5d                   	pop    %rbp
+  80202f:	c3                   	ret
+
+0000000000802030 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802030:	55                   	push   %rbp
+  802031:	48 89 e5             	mov    %rsp,%rbp
+  802034:	41 54                	push   %r12
+  802036:	53                   	push   %rbx
+  802037:	49 89 fc             	mov    %rdi,%r12
+  80203a:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80203c:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  802043:	00 00 00 
+  802046:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802048:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80204f:	00 00 00 
+  802052:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802057:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802059:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80205c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802061:	be 00 00 00 00       	mov    $0x0,%esi
+  802066:	bf 02 00 00 00       	mov    $0x2,%edi
+  80206b:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+}
+  802077:	5b                   	pop    %rbx
+  802078:	41 5c                	pop    %r12
+  80207a:	5d                   	pop    %rbp
+  80207b:	c3                   	ret
+
+000000000080207c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80207c:	55                   	push   %rbp
+  80207d:	48 89 e5             	mov    %rsp,%rbp
+  802080:	41 54                	push   %r12
+  802082:	53                   	push   %rbx
+  802083:	49 89 fc             	mov    %rdi,%r12
+  802086:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802089:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802095:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80209a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8020a1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8020a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ad:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020b2:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8020b9:	00 00 00 
+  8020bc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020be:	85 c0                	test   %eax,%eax
+  8020c0:	78 3d                	js     8020ff <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020c2:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8020c9:	00 00 00 
+  8020cc:	4c 89 e6             	mov    %r12,%rsi
+  8020cf:	48 89 df             	mov    %rbx,%rdi
+  8020d2:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  8020d9:	00 00 00 
+  8020dc:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020de:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020e5:	00 
+  8020e6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020ec:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020f3:	00 
+  8020f4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020ff:	5b                   	pop    %rbx
+  802100:	41 5c                	pop    %r12
+  802102:	5d                   	pop    %rbp
+  802103:	c3                   	ret
+
+0000000000802104 <remove>:
+remove(const char *path) {
+  802104:	55                   	push   %rbp
+  802105:	48 89 e5             	mov    %rsp,%rbp
+  802108:	53                   	push   %rbx
+  802109:	48 83 ec 08          	sub    $0x8,%rsp
+  80210d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802110:	48 b8 d4 3d 80 00 00 	movabs $0x803dd4,%rax
+  802117:	00 00 00 
+  80211a:	ff d0                	call   *%rax
+  80211c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802122:	77 3a                	ja     80215e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802124:	48 89 de             	mov    %rbx,%rsi
+  802127:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80212e:	00 00 00 
+  802131:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80213d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802142:	be 00 00 00 00       	mov    $0x0,%esi
+  802147:	bf 07 00 00 00       	mov    $0x7,%edi
+  80214c:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  802153:	00 00 00 
+  802156:	ff d0                	call   *%rax
+}
+  802158:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80215c:	c9                   	leave
+  80215d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80215e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802163:	eb f3                	jmp    802158 <remove+0x54>
+
+0000000000802165 <sync>:
+sync(void) {
+  802165:	55                   	push   %rbp
+  802166:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802169:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  802170:	00 00 00 
+  802173:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802175:	ba 00 00 00 00       	mov    $0x0,%edx
+  80217a:	be 00 00 00 00       	mov    $0x0,%esi
+  80217f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802184:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  80218b:	00 00 00 
+  80218e:	ff d0                	call   *%rax
+}
+  802190:	5d                   	pop    %rbp
+  802191:	c3                   	ret
+
+0000000000802192 <fsync>:
+fsync(int fdnum) {
+  802192:	55                   	push   %rbp
+  802193:	48 89 e5             	mov    %rsp,%rbp
+  802196:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80219a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80219e:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021aa:	85 c0                	test   %eax,%eax
+  8021ac:	78 4b                	js     8021f9 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021ae:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021b2:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8021b9:	00 00 00 
+  8021bc:	8b 00                	mov    (%rax),%eax
+  8021be:	39 02                	cmp    %eax,(%rdx)
+  8021c0:	75 39                	jne    8021fb <fsync+0x69>
+    file_flush_buffers();
+  8021c2:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  8021c9:	00 00 00 
+  8021cc:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8021ce:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021d2:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021d5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021dc:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021e8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021ed:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+}
+  8021f9:	c9                   	leave
+  8021fa:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021fb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802200:	eb f7                	jmp    8021f9 <fsync+0x67>
+
+0000000000802202 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802202:	55                   	push   %rbp
+  802203:	48 89 e5             	mov    %rsp,%rbp
+  802206:	53                   	push   %rbx
+  802207:	48 83 ec 08          	sub    $0x8,%rsp
+  80220b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80220e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802213:	be 00 00 00 00       	mov    $0x0,%esi
+  802218:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80221d:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  802224:	00 00 00 
+  802227:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802229:	85 c0                	test   %eax,%eax
+  80222b:	78 2d                	js     80225a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80222d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802234:	00 00 00 
+  802237:	48 8b 10             	mov    (%rax),%rdx
+  80223a:	48 89 13             	mov    %rdx,(%rbx)
+  80223d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802241:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802245:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802249:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80224d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802251:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802255:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80225a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80225e:	c9                   	leave
+  80225f:	c3                   	ret
+
+0000000000802260 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802260:	55                   	push   %rbp
+  802261:	48 89 e5             	mov    %rsp,%rbp
+  802264:	53                   	push   %rbx
+  802265:	48 83 ec 08          	sub    $0x8,%rsp
+  802269:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80226c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802271:	be 00 00 00 00       	mov    $0x0,%esi
+  802276:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80227b:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  802282:	00 00 00 
+  802285:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802287:	85 c0                	test   %eax,%eax
+  802289:	78 3d                	js     8022c8 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80228b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802292:	00 00 00 
+  802295:	48 8b 10             	mov    (%rax),%rdx
+  802298:	48 89 13             	mov    %rdx,(%rbx)
+  80229b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80229f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8022a3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8022a7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8022ab:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8022af:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8022b3:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8022b7:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8022bb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8022bf:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8022c3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022cc:	c9                   	leave
+  8022cd:	c3                   	ret
+
+00000000008022ce <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8022ce:	55                   	push   %rbp
+  8022cf:	48 89 e5             	mov    %rsp,%rbp
+  8022d2:	41 57                	push   %r15
+  8022d4:	41 56                	push   %r14
+  8022d6:	41 55                	push   %r13
+  8022d8:	41 54                	push   %r12
+  8022da:	53                   	push   %rbx
+  8022db:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022df:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022e6:	00 
+  8022e7:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022ee:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022f4:	0f 85 43 01 00 00    	jne    80243d <munmap+0x16f>
+  8022fa:	49 89 ff             	mov    %rdi,%r15
+  8022fd:	4c 39 f7             	cmp    %r14,%rdi
+  802300:	0f 87 37 01 00 00    	ja     80243d <munmap+0x16f>
+  802306:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80230d:	00 00 00 
+  802310:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  802316:	eb 2c                	jmp    802344 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  802318:	4c 39 f8             	cmp    %r15,%rax
+  80231b:	0f 83 85 00 00 00    	jae    8023a6 <munmap+0xd8>
+            m->mm_end = start;
+  802321:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802326:	48 83 c3 18          	add    $0x18,%rbx
+  80232a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802331:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802338:	00 00 00 
+  80233b:	48 39 c3             	cmp    %rax,%rbx
+  80233e:	0f 84 d0 00 00 00    	je     802414 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802344:	49 89 dc             	mov    %rbx,%r12
+  802347:	48 8b 03             	mov    (%rbx),%rax
+  80234a:	4c 39 f0             	cmp    %r14,%rax
+  80234d:	73 d7                	jae    802326 <munmap+0x58>
+  80234f:	48 85 c0             	test   %rax,%rax
+  802352:	74 d2                	je     802326 <munmap+0x58>
+  802354:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802358:	49 39 d7             	cmp    %rdx,%r15
+  80235b:	73 c9                	jae    802326 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80235d:	49 39 d6             	cmp    %rdx,%r14
+  802360:	73 b6                	jae    802318 <munmap+0x4a>
+  802362:	49 39 c7             	cmp    %rax,%r15
+  802365:	76 b1                	jbe    802318 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802367:	4c 89 ef             	mov    %r13,%rdi
+  80236a:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  802376:	48 85 c0             	test   %rax,%rax
+  802379:	0f 84 c5 00 00 00    	je     802444 <munmap+0x176>
+            *tail = *m;
+  80237f:	48 8b 13             	mov    (%rbx),%rdx
+  802382:	48 89 10             	mov    %rdx,(%rax)
+  802385:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802389:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80238d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802391:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  802395:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802398:	44 89 f2             	mov    %r14d,%edx
+  80239b:	2b 13                	sub    (%rbx),%edx
+  80239d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8023a0:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8023a4:	eb 80                	jmp    802326 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8023a6:	49 39 d6             	cmp    %rdx,%r14
+  8023a9:	73 18                	jae    8023c3 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8023ab:	44 89 f2             	mov    %r14d,%edx
+  8023ae:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8023b3:	29 c2                	sub    %eax,%edx
+  8023b5:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8023ba:	4d 89 34 24          	mov    %r14,(%r12)
+  8023be:	e9 63 ff ff ff       	jmp    802326 <munmap+0x58>
+    m->mm_start = 0;
+  8023c3:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8023ca:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8023cb:	4c 89 e6             	mov    %r12,%rsi
+  8023ce:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023d5:	00 00 00 
+  8023d8:	48 29 c6             	sub    %rax,%rsi
+  8023db:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023df:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023e6:	aa aa aa 
+  8023e9:	48 0f af f0          	imul   %rax,%rsi
+  8023ed:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023f1:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023f6:	48 01 c6             	add    %rax,%rsi
+  8023f9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802403:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  80240a:	00 00 00 
+  80240d:	ff d0                	call   *%rax
+}
+  80240f:	e9 12 ff ff ff       	jmp    802326 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  802414:	4c 89 f2             	mov    %r14,%rdx
+  802417:	4c 29 fa             	sub    %r15,%rdx
+  80241a:	4c 89 fe             	mov    %r15,%rsi
+  80241d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802422:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  802429:	00 00 00 
+  80242c:	ff d0                	call   *%rax
+}
+  80242e:	48 83 c4 08          	add    $0x8,%rsp
+  802432:	5b                   	pop    %rbx
+  802433:	41 5c                	pop    %r12
+  802435:	41 5d                	pop    %r13
+  802437:	41 5e                	pop    %r14
+  802439:	41 5f                	pop    %r15
+  80243b:	5d                   	pop    %rbp
+  80243c:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80243d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802442:	eb ea                	jmp    80242e <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802444:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802449:	eb e3                	jmp    80242e <munmap+0x160>
+
+000000000080244b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80244b:	55                   	push   %rbp
+  80244c:	48 89 e5             	mov    %rsp,%rbp
+  80244f:	41 57                	push   %r15
+  802451:	41 56                	push   %r14
+  802453:	41 55                	push   %r13
+  802455:	41 54                	push   %r12
+  802457:	53                   	push   %rbx
+  802458:	48 83 ec 28          	sub    $0x28,%rsp
+  80245c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802460:	49 89 f5             	mov    %rsi,%r13
+  802463:	41 89 d6             	mov    %edx,%r14d
+  802466:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802469:	41 89 cc             	mov    %ecx,%r12d
+  80246c:	44 89 c7             	mov    %r8d,%edi
+  80246f:	44 89 cb             	mov    %r9d,%ebx
+  802472:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802476:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80247a:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  802481:	00 00 00 
+  802484:	ff d0                	call   *%rax
+  802486:	41 89 c7             	mov    %eax,%r15d
+  802489:	85 c0                	test   %eax,%eax
+  80248b:	0f 88 ae 01 00 00    	js     80263f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802491:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802495:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80249c:	00 00 00 
+  80249f:	8b 32                	mov    (%rdx),%esi
+  8024a1:	39 30                	cmp    %esi,(%rax)
+  8024a3:	0f 85 7a 02 00 00    	jne    802723 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8024a9:	8b 40 08             	mov    0x8(%rax),%eax
+  8024ac:	83 e0 03             	and    $0x3,%eax
+  8024af:	83 f8 01             	cmp    $0x1,%eax
+  8024b2:	0f 84 76 02 00 00    	je     80272e <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8024b8:	4d 85 ed             	test   %r13,%r13
+  8024bb:	0f 84 78 02 00 00    	je     802739 <mmap+0x2ee>
+  8024c1:	85 db                	test   %ebx,%ebx
+  8024c3:	0f 88 70 02 00 00    	js     802739 <mmap+0x2ee>
+  8024c9:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8024cf:	41 89 df             	mov    %ebx,%r15d
+  8024d2:	0f 85 6c 02 00 00    	jne    802744 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8024d8:	44 89 f0             	mov    %r14d,%eax
+  8024db:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024de:	83 f8 04             	cmp    $0x4,%eax
+  8024e1:	0f 85 68 02 00 00    	jne    80274f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024e7:	44 89 e1             	mov    %r12d,%ecx
+  8024ea:	83 e1 01             	and    $0x1,%ecx
+  8024ed:	0f 95 c2             	setne  %dl
+  8024f0:	44 89 e0             	mov    %r12d,%eax
+  8024f3:	d1 e8                	shr    %eax
+  8024f5:	83 f0 01             	xor    $0x1,%eax
+  8024f8:	83 e0 01             	and    $0x1,%eax
+  8024fb:	38 c2                	cmp    %al,%dl
+  8024fd:	0f 85 57 02 00 00    	jne    80275a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802503:	85 c9                	test   %ecx,%ecx
+  802505:	74 0a                	je     802511 <mmap+0xc6>
+  802507:	41 f6 c6 02          	test   $0x2,%r14b
+  80250b:	0f 85 54 02 00 00    	jne    802765 <mmap+0x31a>
+    file_flush_buffers();
+  802511:	48 b8 c6 1f 80 00 00 	movabs $0x801fc6,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80251d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802524:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80252b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80252f:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  802532:	41 f6 c4 04          	test   $0x4,%r12b
+  802536:	0f 84 15 01 00 00    	je     802651 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80253c:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80253f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802545:	0f 85 25 02 00 00    	jne    802770 <mmap+0x325>
+  80254b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80254f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802556:	00 00 00 
+  802559:	48 39 c2             	cmp    %rax,%rdx
+  80255c:	0f 82 19 02 00 00    	jb     80277b <mmap+0x330>
+  802562:	48 39 c7             	cmp    %rax,%rdi
+  802565:	0f 87 10 02 00 00    	ja     80277b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80256b:	4c 89 ee             	mov    %r13,%rsi
+  80256e:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  802575:	00 00 00 
+  802578:	ff d0                	call   *%rax
+  80257a:	85 c0                	test   %eax,%eax
+  80257c:	0f 88 04 02 00 00    	js     802786 <mmap+0x33b>
+    if (!handler) {
+  802582:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802589:	00 00 00 
+  80258c:	80 38 00             	cmpb   $0x0,(%rax)
+  80258f:	75 2b                	jne    8025bc <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802591:	48 bf 66 13 80 00 00 	movabs $0x801366,%rdi
+  802598:	00 00 00 
+  80259b:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	0f 88 ea 01 00 00    	js     802799 <mmap+0x34e>
+        handler = 1;
+  8025af:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8025b6:	00 00 00 
+  8025b9:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8025bc:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8025c0:	48 b8 05 14 80 00 00 	movabs $0x801405,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+  8025cc:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8025cf:	48 85 c0             	test   %rax,%rax
+  8025d2:	0f 84 c9 01 00 00    	je     8027a1 <mmap+0x356>
+    m->mm_start = va;
+  8025d8:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025db:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025df:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025e3:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025e6:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025ea:	44 89 e0             	mov    %r12d,%eax
+  8025ed:	c1 e0 06             	shl    $0x6,%eax
+  8025f0:	25 80 00 00 00       	and    $0x80,%eax
+  8025f5:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025f8:	09 f0                	or     %esi,%eax
+  8025fa:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025fe:	41 f6 c4 08          	test   $0x8,%r12b
+  802602:	74 31                	je     802635 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  802604:	48 39 d3             	cmp    %rdx,%rbx
+  802607:	73 2c                	jae    802635 <mmap+0x1ea>
+  802609:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80260e:	48 89 de             	mov    %rbx,%rsi
+  802611:	4c 89 f7             	mov    %r14,%rdi
+  802614:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  80261b:	00 00 00 
+  80261e:	ff d0                	call   *%rax
+  802620:	49 89 c4             	mov    %rax,%r12
+  802623:	48 85 c0             	test   %rax,%rax
+  802626:	0f 8e d7 00 00 00    	jle    802703 <mmap+0x2b8>
+            va += n;
+  80262c:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80262f:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  802633:	72 d4                	jb     802609 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  802635:	49 8b 06             	mov    (%r14),%rax
+  802638:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80263c:	48 89 06             	mov    %rax,(%rsi)
+}
+  80263f:	44 89 f8             	mov    %r15d,%eax
+  802642:	48 83 c4 28          	add    $0x28,%rsp
+  802646:	5b                   	pop    %rbx
+  802647:	41 5c                	pop    %r12
+  802649:	41 5d                	pop    %r13
+  80264b:	41 5e                	pop    %r14
+  80264d:	41 5f                	pop    %r15
+  80264f:	5d                   	pop    %rbp
+  802650:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802651:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802658:	00 00 00 
+  80265b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80265e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802665:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802668:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80266d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802674:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802677:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80267e:	00 00 00 
+  802681:	48 39 d7             	cmp    %rdx,%rdi
+  802684:	73 1c                	jae    8026a2 <mmap+0x257>
+        return -E_NO_MEM;
+  802686:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80268c:	eb b1                	jmp    80263f <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80268e:	48 83 c0 01          	add    $0x1,%rax
+  802692:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802696:	77 3f                	ja     8026d7 <mmap+0x28c>
+  802698:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80269d:	48 39 d7             	cmp    %rdx,%rdi
+  8026a0:	72 2a                	jb     8026cc <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8026a2:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8026a6:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8026aa:	48 39 d1             	cmp    %rdx,%rcx
+  8026ad:	73 df                	jae    80268e <mmap+0x243>
+  8026af:	48 85 c9             	test   %rcx,%rcx
+  8026b2:	74 da                	je     80268e <mmap+0x243>
+  8026b4:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8026b8:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8026bd:	48 39 d3             	cmp    %rdx,%rbx
+  8026c0:	73 cc                	jae    80268e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8026c2:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8026c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ca:	eb cc                	jmp    802698 <mmap+0x24d>
+        return -E_NO_MEM;
+  8026cc:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026d2:	e9 68 ff ff ff       	jmp    80263f <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8026d7:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026dc:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026e3:	00 00 00 
+  8026e6:	48 39 c2             	cmp    %rax,%rdx
+  8026e9:	0f 82 9f 00 00 00    	jb     80278e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026ef:	48 85 db             	test   %rbx,%rbx
+  8026f2:	0f 85 8a fe ff ff    	jne    802582 <mmap+0x137>
+        return -E_NO_MEM;
+  8026f8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026fe:	e9 3c ff ff ff       	jmp    80263f <mmap+0x1f4>
+        if (n < 0) {
+  802703:	0f 89 2c ff ff ff    	jns    802635 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  802709:	49 8b 3e             	mov    (%r14),%rdi
+  80270c:	4c 89 ee             	mov    %r13,%rsi
+  80270f:	48 b8 ce 22 80 00 00 	movabs $0x8022ce,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+            return n;
+  80271b:	45 89 e7             	mov    %r12d,%r15d
+  80271e:	e9 1c ff ff ff       	jmp    80263f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802723:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802729:	e9 11 ff ff ff       	jmp    80263f <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80272e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802734:	e9 06 ff ff ff       	jmp    80263f <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802739:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80273f:	e9 fb fe ff ff       	jmp    80263f <mmap+0x1f4>
+  802744:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80274a:	e9 f0 fe ff ff       	jmp    80263f <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80274f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802755:	e9 e5 fe ff ff       	jmp    80263f <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80275a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802760:	e9 da fe ff ff       	jmp    80263f <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802765:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80276b:	e9 cf fe ff ff       	jmp    80263f <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802770:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802776:	e9 c4 fe ff ff       	jmp    80263f <mmap+0x1f4>
+  80277b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802781:	e9 b9 fe ff ff       	jmp    80263f <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802786:	41 89 c7             	mov    %eax,%r15d
+  802789:	e9 b1 fe ff ff       	jmp    80263f <mmap+0x1f4>
+        return -E_NO_MEM;
+  80278e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802794:	e9 a6 fe ff ff       	jmp    80263f <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802799:	41 89 c7             	mov    %eax,%r15d
+  80279c:	e9 9e fe ff ff       	jmp    80263f <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8027a1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8027a7:	e9 93 fe ff ff       	jmp    80263f <mmap+0x1f4>
+
+00000000008027ac <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8027ac:	55                   	push   %rbp
+  8027ad:	48 89 e5             	mov    %rsp,%rbp
+  8027b0:	41 54                	push   %r12
+  8027b2:	53                   	push   %rbx
+  8027b3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027b6:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  8027bd:	00 00 00 
+  8027c0:	ff d0                	call   *%rax
+  8027c2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8027c5:	48 be c0 47 80 00 00 	movabs $0x8047c0,%rsi
+  8027cc:	00 00 00 
+  8027cf:	48 89 df             	mov    %rbx,%rdi
+  8027d2:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027de:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027e3:	41 2b 04 24          	sub    (%r12),%eax
+  8027e7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027ed:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027f4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027f7:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027fe:	00 00 00 
+  802801:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280d:	5b                   	pop    %rbx
+  80280e:	41 5c                	pop    %r12
+  802810:	5d                   	pop    %rbp
+  802811:	c3                   	ret
+
+0000000000802812 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  802812:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802815:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  80281b:	8b 17                	mov    (%rdi),%edx
+  80281d:	85 d2                	test   %edx,%edx
+  80281f:	75 01                	jne    802822 <pipe_wakeup+0x10>
+  802821:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  802822:	55                   	push   %rbp
+  802823:	48 89 e5             	mov    %rsp,%rbp
+  802826:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  802829:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80282f:	be 00 04 00 00       	mov    $0x400,%esi
+  802834:	48 b8 0b 06 80 00 00 	movabs $0x80060b,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+}
+  802840:	5d                   	pop    %rbp
+  802841:	c3                   	ret
+
+0000000000802842 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802842:	55                   	push   %rbp
+  802843:	48 89 e5             	mov    %rsp,%rbp
+  802846:	41 55                	push   %r13
+  802848:	41 54                	push   %r12
+  80284a:	53                   	push   %rbx
+  80284b:	48 83 ec 08          	sub    $0x8,%rsp
+  80284f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802852:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+  80285e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802861:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802866:	4c 89 e6             	mov    %r12,%rsi
+  802869:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286e:	49 bc 25 03 80 00 00 	movabs $0x800325,%r12
+  802875:	00 00 00 
+  802878:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80287b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80287f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802883:	49 bd 12 28 80 00 00 	movabs $0x802812,%r13
+  80288a:	00 00 00 
+  80288d:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802890:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802894:	48 89 de             	mov    %rbx,%rsi
+  802897:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80289a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80289f:	48 89 de             	mov    %rbx,%rsi
+  8028a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028a7:	41 ff d4             	call   *%r12
+  8028aa:	48 83 c4 08          	add    $0x8,%rsp
+  8028ae:	5b                   	pop    %rbx
+  8028af:	41 5c                	pop    %r12
+  8028b1:	41 5d                	pop    %r13
+  8028b3:	5d                   	pop    %rbp
+  8028b4:	c3                   	ret
+
+00000000008028b5 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8028b5:	55                   	push   %rbp
+  8028b6:	48 89 e5             	mov    %rsp,%rbp
+  8028b9:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028bc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028c1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028c6:	48 b8 68 02 80 00 00 	movabs $0x800268,%rax
+  8028cd:	00 00 00 
+  8028d0:	ff d0                	call   *%rax
+  8028d2:	85 c0                	test   %eax,%eax
+  8028d4:	0f 94 c0             	sete   %al
+  8028d7:	0f b6 c0             	movzbl %al,%eax
+}
+  8028da:	5d                   	pop    %rbp
+  8028db:	c3                   	ret
+
+00000000008028dc <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028dc:	55                   	push   %rbp
+  8028dd:	48 89 e5             	mov    %rsp,%rbp
+  8028e0:	41 57                	push   %r15
+  8028e2:	41 56                	push   %r14
+  8028e4:	41 55                	push   %r13
+  8028e6:	41 54                	push   %r12
+  8028e8:	53                   	push   %rbx
+  8028e9:	48 83 ec 38          	sub    $0x38,%rsp
+  8028ed:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028f1:	49 89 f4             	mov    %rsi,%r12
+  8028f4:	49 89 d7             	mov    %rdx,%r15
+  8028f7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028fb:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+  802907:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80290a:	4d 85 ff             	test   %r15,%r15
+  80290d:	0f 84 f1 00 00 00    	je     802a04 <devpipe_write+0x128>
+  802913:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  802917:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80291b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80291f:	49 bd b5 28 80 00 00 	movabs $0x8028b5,%r13
+  802926:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802929:	49 bf 12 28 80 00 00 	movabs $0x802812,%r15
+  802930:	00 00 00 
+  802933:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802937:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80293b:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80293f:	8b 73 04             	mov    0x4(%rbx),%esi
+  802942:	48 63 ce             	movslq %esi,%rcx
+  802945:	48 63 03             	movslq (%rbx),%rax
+  802948:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80294e:	48 39 c1             	cmp    %rax,%rcx
+  802951:	72 64                	jb     8029b7 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802953:	48 89 de             	mov    %rbx,%rsi
+  802956:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80295a:	41 ff d5             	call   *%r13
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	0f 85 b9 00 00 00    	jne    802a1e <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802965:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802969:	4c 89 f7             	mov    %r14,%rdi
+  80296c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80296f:	8b 43 04             	mov    0x4(%rbx),%eax
+  802972:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802979:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802980:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802986:	8b 03                	mov    (%rbx),%eax
+  802988:	41 39 c4             	cmp    %eax,%r12d
+  80298b:	75 b2                	jne    80293f <devpipe_write+0x63>
+  80298d:	48 89 de             	mov    %rbx,%rsi
+  802990:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802994:	41 ff d5             	call   *%r13
+  802997:	85 c0                	test   %eax,%eax
+  802999:	75 a0                	jne    80293b <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80299b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8029a0:	44 89 e6             	mov    %r12d,%esi
+  8029a3:	48 89 df             	mov    %rbx,%rdi
+  8029a6:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  8029ad:	00 00 00 
+  8029b0:	ff d0                	call   *%rax
+  8029b2:	e9 7c ff ff ff       	jmp    802933 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029b7:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8029bb:	41 0f b6 38          	movzbl (%r8),%edi
+  8029bf:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8029c6:	80 80 80 
+  8029c9:	48 89 c8             	mov    %rcx,%rax
+  8029cc:	48 f7 e2             	mul    %rdx
+  8029cf:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029d3:	48 89 d0             	mov    %rdx,%rax
+  8029d6:	48 c1 e0 08          	shl    $0x8,%rax
+  8029da:	48 29 d0             	sub    %rdx,%rax
+  8029dd:	48 c1 e0 04          	shl    $0x4,%rax
+  8029e1:	48 29 c1             	sub    %rax,%rcx
+  8029e4:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029e9:	83 c6 01             	add    $0x1,%esi
+  8029ec:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029ef:	49 83 c0 01          	add    $0x1,%r8
+  8029f3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029f7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029fb:	49 39 c0             	cmp    %rax,%r8
+  8029fe:	0f 85 2f ff ff ff    	jne    802933 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802a04:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802a08:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802a0c:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+    return n;
+  802a18:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a1c:	eb 05                	jmp    802a23 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a23:	48 83 c4 38          	add    $0x38,%rsp
+  802a27:	5b                   	pop    %rbx
+  802a28:	41 5c                	pop    %r12
+  802a2a:	41 5d                	pop    %r13
+  802a2c:	41 5e                	pop    %r14
+  802a2e:	41 5f                	pop    %r15
+  802a30:	5d                   	pop    %rbp
+  802a31:	c3                   	ret
+
+0000000000802a32 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a32:	55                   	push   %rbp
+  802a33:	48 89 e5             	mov    %rsp,%rbp
+  802a36:	41 57                	push   %r15
+  802a38:	41 56                	push   %r14
+  802a3a:	41 55                	push   %r13
+  802a3c:	41 54                	push   %r12
+  802a3e:	53                   	push   %rbx
+  802a3f:	48 83 ec 28          	sub    $0x28,%rsp
+  802a43:	49 89 fd             	mov    %rdi,%r13
+  802a46:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a4a:	49 89 d4             	mov    %rdx,%r12
+  802a4d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a51:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802a58:	00 00 00 
+  802a5b:	ff d0                	call   *%rax
+  802a5d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a60:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a66:	49 bf b5 28 80 00 00 	movabs $0x8028b5,%r15
+  802a6d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a70:	4d 85 e4             	test   %r12,%r12
+  802a73:	0f 84 d5 00 00 00    	je     802b4e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a79:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a7d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a81:	8b 03                	mov    (%rbx),%eax
+  802a83:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a86:	75 7a                	jne    802b02 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a88:	4d 85 f6             	test   %r14,%r14
+  802a8b:	75 50                	jne    802add <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a8d:	48 89 de             	mov    %rbx,%rsi
+  802a90:	4c 89 ef             	mov    %r13,%rdi
+  802a93:	41 ff d7             	call   *%r15
+  802a96:	85 c0                	test   %eax,%eax
+  802a98:	0f 85 c9 00 00 00    	jne    802b67 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a9e:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802aa1:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802aa8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802aae:	8b 43 04             	mov    0x4(%rbx),%eax
+  802ab1:	41 39 c4             	cmp    %eax,%r12d
+  802ab4:	75 cb                	jne    802a81 <devpipe_read+0x4f>
+  802ab6:	48 89 de             	mov    %rbx,%rsi
+  802ab9:	4c 89 ef             	mov    %r13,%rdi
+  802abc:	41 ff d7             	call   *%r15
+  802abf:	85 c0                	test   %eax,%eax
+  802ac1:	75 be                	jne    802a81 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802ac3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802ac8:	44 89 e6             	mov    %r12d,%esi
+  802acb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802acf:	48 b8 ed 05 80 00 00 	movabs $0x8005ed,%rax
+  802ad6:	00 00 00 
+  802ad9:	ff d0                	call   *%rax
+  802adb:	eb a4                	jmp    802a81 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802add:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802ae1:	48 89 de             	mov    %rbx,%rsi
+  802ae4:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802aeb:	00 00 00 
+  802aee:	ff d0                	call   *%rax
+                return i;
+  802af0:	4c 89 f0             	mov    %r14,%rax
+}
+  802af3:	48 83 c4 28          	add    $0x28,%rsp
+  802af7:	5b                   	pop    %rbx
+  802af8:	41 5c                	pop    %r12
+  802afa:	41 5d                	pop    %r13
+  802afc:	41 5e                	pop    %r14
+  802afe:	41 5f                	pop    %r15
+  802b00:	5d                   	pop    %rbp
+  802b01:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b02:	48 63 c8             	movslq %eax,%rcx
+  802b05:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802b0c:	80 80 80 
+  802b0f:	48 89 c8             	mov    %rcx,%rax
+  802b12:	48 f7 e2             	mul    %rdx
+  802b15:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802b19:	48 89 d0             	mov    %rdx,%rax
+  802b1c:	48 c1 e0 08          	shl    $0x8,%rax
+  802b20:	48 29 d0             	sub    %rdx,%rax
+  802b23:	48 c1 e0 04          	shl    $0x4,%rax
+  802b27:	48 89 c2             	mov    %rax,%rdx
+  802b2a:	48 89 c8             	mov    %rcx,%rax
+  802b2d:	48 29 d0             	sub    %rdx,%rax
+  802b30:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b35:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b39:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b3d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b40:	49 83 c6 01          	add    $0x1,%r14
+  802b44:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b48:	0f 85 2b ff ff ff    	jne    802a79 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b4e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b52:	48 89 de             	mov    %rbx,%rsi
+  802b55:	48 b8 12 28 80 00 00 	movabs $0x802812,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+    return n;
+  802b61:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b65:	eb 8c                	jmp    802af3 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b67:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b6c:	eb 85                	jmp    802af3 <devpipe_read+0xc1>
+
+0000000000802b6e <pipe>:
+pipe(int pfd[2]) {
+  802b6e:	55                   	push   %rbp
+  802b6f:	48 89 e5             	mov    %rsp,%rbp
+  802b72:	41 55                	push   %r13
+  802b74:	41 54                	push   %r12
+  802b76:	53                   	push   %rbx
+  802b77:	48 83 ec 18          	sub    $0x18,%rsp
+  802b7b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b7e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b82:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  802b89:	00 00 00 
+  802b8c:	ff d0                	call   *%rax
+  802b8e:	89 c3                	mov    %eax,%ebx
+  802b90:	85 c0                	test   %eax,%eax
+  802b92:	0f 88 a0 01 00 00    	js     802d38 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b98:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ba6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bab:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  802bb2:	00 00 00 
+  802bb5:	ff d0                	call   *%rax
+  802bb7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802bb9:	85 c0                	test   %eax,%eax
+  802bbb:	0f 88 77 01 00 00    	js     802d38 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bc1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802bc5:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  802bcc:	00 00 00 
+  802bcf:	ff d0                	call   *%rax
+  802bd1:	89 c3                	mov    %eax,%ebx
+  802bd3:	85 c0                	test   %eax,%eax
+  802bd5:	0f 88 43 01 00 00    	js     802d1e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802bdb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802be0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bee:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+  802bfa:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	0f 88 1a 01 00 00    	js     802d1e <pipe+0x1b0>
+    va = fd2data(fd0);
+  802c04:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c08:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802c17:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c1c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c21:	48 89 c6             	mov    %rax,%rsi
+  802c24:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c29:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  802c30:	00 00 00 
+  802c33:	ff d0                	call   *%rax
+  802c35:	89 c3                	mov    %eax,%ebx
+  802c37:	85 c0                	test   %eax,%eax
+  802c39:	0f 88 c5 00 00 00    	js     802d04 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c3f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c43:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802c4a:	00 00 00 
+  802c4d:	ff d0                	call   *%rax
+  802c4f:	48 89 c1             	mov    %rax,%rcx
+  802c52:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c58:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c5e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c63:	4c 89 ee             	mov    %r13,%rsi
+  802c66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c6b:	48 b8 d5 02 80 00 00 	movabs $0x8002d5,%rax
+  802c72:	00 00 00 
+  802c75:	ff d0                	call   *%rax
+  802c77:	89 c3                	mov    %eax,%ebx
+  802c79:	85 c0                	test   %eax,%eax
+  802c7b:	78 6e                	js     802ceb <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c7d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c82:	4c 89 ef             	mov    %r13,%rdi
+  802c85:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  802c8c:	00 00 00 
+  802c8f:	ff d0                	call   *%rax
+  802c91:	83 f8 02             	cmp    $0x2,%eax
+  802c94:	0f 85 ab 00 00 00    	jne    802d45 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c9a:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802ca1:	00 00 
+  802ca3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802ca7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802ca9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cad:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802cb4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802cb8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802cba:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cbe:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802cc5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802cc9:	48 bb b2 06 80 00 00 	movabs $0x8006b2,%rbx
+  802cd0:	00 00 00 
+  802cd3:	ff d3                	call   *%rbx
+  802cd5:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802cd9:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cdd:	ff d3                	call   *%rbx
+  802cdf:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802ce4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ce9:	eb 4d                	jmp    802d38 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802ceb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cf0:	4c 89 ee             	mov    %r13,%rsi
+  802cf3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf8:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802d04:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d09:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802d0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d12:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  802d19:	00 00 00 
+  802d1c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802d1e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d23:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d27:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2c:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+}
+  802d38:	89 d8                	mov    %ebx,%eax
+  802d3a:	48 83 c4 18          	add    $0x18,%rsp
+  802d3e:	5b                   	pop    %rbx
+  802d3f:	41 5c                	pop    %r12
+  802d41:	41 5d                	pop    %r13
+  802d43:	5d                   	pop    %rbp
+  802d44:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d45:	48 b9 f0 47 80 00 00 	movabs $0x8047f0,%rcx
+  802d4c:	00 00 00 
+  802d4f:	48 ba c7 47 80 00 00 	movabs $0x8047c7,%rdx
+  802d56:	00 00 00 
+  802d59:	be 50 00 00 00       	mov    $0x50,%esi
+  802d5e:	48 bf dc 47 80 00 00 	movabs $0x8047dc,%rdi
+  802d65:	00 00 00 
+  802d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d6d:	49 b8 9d 33 80 00 00 	movabs $0x80339d,%r8
+  802d74:	00 00 00 
+  802d77:	41 ff d0             	call   *%r8
+
+0000000000802d7a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d7a:	55                   	push   %rbp
+  802d7b:	48 89 e5             	mov    %rsp,%rbp
+  802d7e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d82:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d86:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d92:	85 c0                	test   %eax,%eax
+  802d94:	78 23                	js     802db9 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d96:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d9a:	48 b8 c4 06 80 00 00 	movabs $0x8006c4,%rax
+  802da1:	00 00 00 
+  802da4:	ff d0                	call   *%rax
+  802da6:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802da9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802dad:	48 b8 b5 28 80 00 00 	movabs $0x8028b5,%rax
+  802db4:	00 00 00 
+  802db7:	ff d0                	call   *%rax
+}
+  802db9:	c9                   	leave
+  802dba:	c3                   	ret
+
+0000000000802dbb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802dbb:	48 89 f8             	mov    %rdi,%rax
+  802dbe:	48 c1 e8 27          	shr    $0x27,%rax
+  802dc2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802dc9:	01 00 00 
+  802dcc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dd0:	f6 c2 01             	test   $0x1,%dl
+  802dd3:	74 6d                	je     802e42 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802dd5:	48 89 f8             	mov    %rdi,%rax
+  802dd8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802ddc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802de3:	01 00 00 
+  802de6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dea:	f6 c2 01             	test   $0x1,%dl
+  802ded:	74 62                	je     802e51 <get_uvpt_entry+0x96>
+  802def:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802df6:	01 00 00 
+  802df9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dfd:	f6 c2 80             	test   $0x80,%dl
+  802e00:	75 4f                	jne    802e51 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e02:	48 89 f8             	mov    %rdi,%rax
+  802e05:	48 c1 e8 15          	shr    $0x15,%rax
+  802e09:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e10:	01 00 00 
+  802e13:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e17:	f6 c2 01             	test   $0x1,%dl
+  802e1a:	74 44                	je     802e60 <get_uvpt_entry+0xa5>
+  802e1c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e23:	01 00 00 
+  802e26:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e2a:	f6 c2 80             	test   $0x80,%dl
+  802e2d:	75 31                	jne    802e60 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802e2f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e33:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e3a:	01 00 00 
+  802e3d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e41:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e42:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e49:	01 00 00 
+  802e4c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e50:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e51:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e58:	01 00 00 
+  802e5b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e5f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e60:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e67:	01 00 00 
+  802e6a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e6e:	c3                   	ret
+
+0000000000802e6f <get_prot>:
+
+int
+get_prot(void *va) {
+  802e6f:	55                   	push   %rbp
+  802e70:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e73:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802e7a:	00 00 00 
+  802e7d:	ff d0                	call   *%rax
+  802e7f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e82:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e87:	89 c1                	mov    %eax,%ecx
+  802e89:	83 c9 04             	or     $0x4,%ecx
+  802e8c:	f6 c2 01             	test   $0x1,%dl
+  802e8f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e92:	89 c1                	mov    %eax,%ecx
+  802e94:	83 c9 02             	or     $0x2,%ecx
+  802e97:	f6 c2 02             	test   $0x2,%dl
+  802e9a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e9d:	89 c1                	mov    %eax,%ecx
+  802e9f:	83 c9 01             	or     $0x1,%ecx
+  802ea2:	48 85 d2             	test   %rdx,%rdx
+  802ea5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ea8:	89 c1                	mov    %eax,%ecx
+  802eaa:	83 c9 40             	or     $0x40,%ecx
+  802ead:	f6 c6 04             	test   $0x4,%dh
+  802eb0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802eb3:	5d                   	pop    %rbp
+  802eb4:	c3                   	ret
+
+0000000000802eb5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802eb5:	55                   	push   %rbp
+  802eb6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802eb9:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ec5:	48 c1 e8 06          	shr    $0x6,%rax
+  802ec9:	83 e0 01             	and    $0x1,%eax
+}
+  802ecc:	5d                   	pop    %rbp
+  802ecd:	c3                   	ret
+
+0000000000802ece <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ece:	55                   	push   %rbp
+  802ecf:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802ed2:	48 b8 bb 2d 80 00 00 	movabs $0x802dbb,%rax
+  802ed9:	00 00 00 
+  802edc:	ff d0                	call   *%rax
+  802ede:	83 e0 01             	and    $0x1,%eax
+}
+  802ee1:	5d                   	pop    %rbp
+  802ee2:	c3                   	ret
+
+0000000000802ee3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802ee3:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802eea:	01 00 00 
+  802eed:	a8 01                	test   $0x1,%al
+  802eef:	75 06                	jne    802ef7 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ef6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ef7:	55                   	push   %rbp
+  802ef8:	48 89 e5             	mov    %rsp,%rbp
+  802efb:	41 57                	push   %r15
+  802efd:	41 56                	push   %r14
+  802eff:	41 55                	push   %r13
+  802f01:	41 54                	push   %r12
+  802f03:	53                   	push   %rbx
+  802f04:	48 83 ec 28          	sub    $0x28,%rsp
+  802f08:	49 89 fe             	mov    %rdi,%r14
+  802f0b:	49 89 f7             	mov    %rsi,%r15
+  802f0e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802f15:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f16:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802f1d:	01 00 00 
+  802f20:	e9 ae 00 00 00       	jmp    802fd3 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f25:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f2c:	49 83 ec 01          	sub    $0x1,%r12
+  802f30:	74 2d                	je     802f5f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f32:	48 89 d8             	mov    %rbx,%rax
+  802f35:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f39:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f3e:	f6 c2 01             	test   $0x1,%dl
+  802f41:	74 e2                	je     802f25 <foreach_shared_region+0x42>
+  802f43:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f48:	f6 c4 04             	test   $0x4,%ah
+  802f4b:	74 d8                	je     802f25 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f4d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f54:	4c 89 fa             	mov    %r15,%rdx
+  802f57:	48 89 df             	mov    %rbx,%rdi
+  802f5a:	41 ff d6             	call   *%r14
+  802f5d:	eb c6                	jmp    802f25 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f5f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f66:	00 
+  802f67:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f6c:	74 4a                	je     802fb8 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f6e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f72:	48 c1 e8 15          	shr    $0x15,%rax
+  802f76:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f7d:	01 00 00 
+  802f80:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f84:	a8 01                	test   $0x1,%al
+  802f86:	74 d7                	je     802f5f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f88:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f8c:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f93:	48 39 c3             	cmp    %rax,%rbx
+  802f96:	73 c7                	jae    802f5f <foreach_shared_region+0x7c>
+  802f98:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f9f:	48 39 d0             	cmp    %rdx,%rax
+  802fa2:	4d 19 e4             	sbb    %r12,%r12
+  802fa5:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802fac:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802fb3:	e9 7a ff ff ff       	jmp    802f32 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802fb8:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802fbf:	40 
+  802fc0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fc4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802fcb:	00 00 00 
+  802fce:	48 39 c1             	cmp    %rax,%rcx
+  802fd1:	74 50                	je     803023 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802fd3:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fd7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fdb:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fe2:	01 00 00 
+  802fe5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fe9:	a8 01                	test   $0x1,%al
+  802feb:	74 cb                	je     802fb8 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fed:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802ff1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802ff8:	48 39 c1             	cmp    %rax,%rcx
+  802ffb:	73 bb                	jae    802fb8 <foreach_shared_region+0xd5>
+  802ffd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803004:	48 39 d0             	cmp    %rdx,%rax
+  803007:	48 19 c0             	sbb    %rax,%rax
+  80300a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803010:	48 05 00 02 00 00    	add    $0x200,%rax
+  803016:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80301a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80301e:	e9 4b ff ff ff       	jmp    802f6e <foreach_shared_region+0x8b>
+  803023:	b8 00 00 00 00       	mov    $0x0,%eax
+  803028:	48 83 c4 28          	add    $0x28,%rsp
+  80302c:	5b                   	pop    %rbx
+  80302d:	41 5c                	pop    %r12
+  80302f:	41 5d                	pop    %r13
+  803031:	41 5e                	pop    %r14
+  803033:	41 5f                	pop    %r15
+  803035:	5d                   	pop    %rbp
+  803036:	c3                   	ret
+
+0000000000803037 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803037:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80303d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803044:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80304b:	c3                   	ret
+
+000000000080304c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80304c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80304f:	8b 17                	mov    (%rdi),%edx
+  803051:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803053:	83 f8 0f             	cmp    $0xf,%eax
+  803056:	77 13                	ja     80306b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803058:	8b 47 40             	mov    0x40(%rdi),%eax
+  80305b:	83 e0 0f             	and    $0xf,%eax
+  80305e:	48 c1 e0 09          	shl    $0x9,%rax
+  803062:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803069:	00 
+  80306a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80306b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803070:	c3                   	ret
+
+0000000000803071 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803071:	8b 47 40             	mov    0x40(%rdi),%eax
+  803074:	83 c0 01             	add    $0x1,%eax
+  803077:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80307a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803080:	8b 57 04             	mov    0x4(%rdi),%edx
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+  803088:	85 d2                	test   %edx,%edx
+  80308a:	75 04                	jne    803090 <chan_publish+0x1f>
+  80308c:	83 e0 01             	and    $0x1,%eax
+}
+  80308f:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803090:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803093:	85 c0                	test   %eax,%eax
+  803095:	0f 95 c0             	setne  %al
+  803098:	0f b6 c0             	movzbl %al,%eax
+  80309b:	eb ef                	jmp    80308c <chan_publish+0x1b>
+
+000000000080309d <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80309d:	8b 47 40             	mov    0x40(%rdi),%eax
+  8030a0:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8030a2:	29 d0                	sub    %edx,%eax
+  8030a4:	83 e8 01             	sub    $0x1,%eax
+  8030a7:	83 f8 0f             	cmp    $0xf,%eax
+  8030aa:	77 12                	ja     8030be <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8030ac:	8b 07                	mov    (%rdi),%eax
+  8030ae:	83 e0 0f             	and    $0xf,%eax
+  8030b1:	48 c1 e0 09          	shl    $0x9,%rax
+  8030b5:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8030bc:	00 
+  8030bd:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8030be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c3:	c3                   	ret
+
+00000000008030c4 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8030c4:	8b 07                	mov    (%rdi),%eax
+  8030c6:	83 c0 01             	add    $0x1,%eax
+  8030c9:	89 07                	mov    %eax,(%rdi)
+}
+  8030cb:	c3                   	ret
+
+00000000008030cc <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8030cc:	55                   	push   %rbp
+  8030cd:	48 89 e5             	mov    %rsp,%rbp
+  8030d0:	53                   	push   %rbx
+  8030d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8030d5:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8030d8:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030df:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030e5:	48 b8 9d 30 80 00 00 	movabs $0x80309d,%rax
+  8030ec:	00 00 00 
+  8030ef:	ff d0                	call   *%rax
+  8030f1:	48 85 c0             	test   %rax,%rax
+  8030f4:	74 12                	je     803108 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030f6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803102:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803106:	c9                   	leave
+  803107:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803108:	b8 01 00 00 00       	mov    $0x1,%eax
+  80310d:	eb f3                	jmp    803102 <chan_arm+0x36>
+
+000000000080310f <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80310f:	55                   	push   %rbp
+  803110:	48 89 e5             	mov    %rsp,%rbp
+  803113:	41 56                	push   %r14
+  803115:	41 55                	push   %r13
+  803117:	41 54                	push   %r12
+  803119:	53                   	push   %rbx
+  80311a:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80311d:	49 bc cc 30 80 00 00 	movabs $0x8030cc,%r12
+  803124:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803127:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80312b:	49 bd ed 05 80 00 00 	movabs $0x8005ed,%r13
+  803132:	00 00 00 
+    while (chan_arm(r))
+  803135:	eb 0d                	jmp    803144 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803137:	8b 33                	mov    (%rbx),%esi
+  803139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80313e:	4c 89 f7             	mov    %r14,%rdi
+  803141:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803144:	48 89 df             	mov    %rbx,%rdi
+  803147:	41 ff d4             	call   *%r12
+  80314a:	84 c0                	test   %al,%al
+  80314c:	75 e9                	jne    803137 <chan_wait+0x28>
+}
+  80314e:	5b                   	pop    %rbx
+  80314f:	41 5c                	pop    %r12
+  803151:	41 5d                	pop    %r13
+  803153:	41 5e                	pop    %r14
+  803155:	5d                   	pop    %rbp
+  803156:	c3                   	ret
+
+0000000000803157 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803157:	55                   	push   %rbp
+  803158:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80315b:	48 83 c7 40          	add    $0x40,%rdi
+  80315f:	be 01 00 00 00       	mov    $0x1,%esi
+  803164:	48 b8 0b 06 80 00 00 	movabs $0x80060b,%rax
+  80316b:	00 00 00 
+  80316e:	ff d0                	call   *%rax
+}
+  803170:	5d                   	pop    %rbp
+  803171:	c3                   	ret
+
+0000000000803172 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803172:	b8 00 00 00 00       	mov    $0x0,%eax
+  803177:	c3                   	ret
+
+0000000000803178 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803178:	55                   	push   %rbp
+  803179:	48 89 e5             	mov    %rsp,%rbp
+  80317c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80317f:	48 be 14 48 80 00 00 	movabs $0x804814,%rsi
+  803186:	00 00 00 
+  803189:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  803190:	00 00 00 
+  803193:	ff d0                	call   *%rax
+    return 0;
+}
+  803195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80319a:	5d                   	pop    %rbp
+  80319b:	c3                   	ret
+
+000000000080319c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80319c:	55                   	push   %rbp
+  80319d:	48 89 e5             	mov    %rsp,%rbp
+  8031a0:	41 57                	push   %r15
+  8031a2:	41 56                	push   %r14
+  8031a4:	41 55                	push   %r13
+  8031a6:	41 54                	push   %r12
+  8031a8:	53                   	push   %rbx
+  8031a9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031b0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031b7:	48 85 d2             	test   %rdx,%rdx
+  8031ba:	74 7a                	je     803236 <devcons_write+0x9a>
+  8031bc:	49 89 d6             	mov    %rdx,%r14
+  8031bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031c5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8031ca:	49 bf 0c 40 80 00 00 	movabs $0x80400c,%r15
+  8031d1:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031d4:	4c 89 f3             	mov    %r14,%rbx
+  8031d7:	48 29 f3             	sub    %rsi,%rbx
+  8031da:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031df:	48 39 c3             	cmp    %rax,%rbx
+  8031e2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031e6:	4c 63 eb             	movslq %ebx,%r13
+  8031e9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031f0:	48 01 c6             	add    %rax,%rsi
+  8031f3:	4c 89 ea             	mov    %r13,%rdx
+  8031f6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031fd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803200:	4c 89 ee             	mov    %r13,%rsi
+  803203:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80320a:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  803211:	00 00 00 
+  803214:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803216:	41 01 dc             	add    %ebx,%r12d
+  803219:	49 63 f4             	movslq %r12d,%rsi
+  80321c:	4c 39 f6             	cmp    %r14,%rsi
+  80321f:	72 b3                	jb     8031d4 <devcons_write+0x38>
+    return res;
+  803221:	49 63 c4             	movslq %r12d,%rax
+}
+  803224:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80322b:	5b                   	pop    %rbx
+  80322c:	41 5c                	pop    %r12
+  80322e:	41 5d                	pop    %r13
+  803230:	41 5e                	pop    %r14
+  803232:	41 5f                	pop    %r15
+  803234:	5d                   	pop    %rbp
+  803235:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803236:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80323c:	eb e3                	jmp    803221 <devcons_write+0x85>
+
+000000000080323e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80323e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803241:	ba 00 00 00 00       	mov    $0x0,%edx
+  803246:	48 85 c0             	test   %rax,%rax
+  803249:	74 55                	je     8032a0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80324b:	55                   	push   %rbp
+  80324c:	48 89 e5             	mov    %rsp,%rbp
+  80324f:	41 55                	push   %r13
+  803251:	41 54                	push   %r12
+  803253:	53                   	push   %rbx
+  803254:	48 83 ec 08          	sub    $0x8,%rsp
+  803258:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80325b:	48 bb 66 01 80 00 00 	movabs $0x800166,%rbx
+  803262:	00 00 00 
+  803265:	49 bc 1b 02 80 00 00 	movabs $0x80021b,%r12
+  80326c:	00 00 00 
+  80326f:	eb 03                	jmp    803274 <devcons_read+0x36>
+  803271:	41 ff d4             	call   *%r12
+  803274:	ff d3                	call   *%rbx
+  803276:	85 c0                	test   %eax,%eax
+  803278:	74 f7                	je     803271 <devcons_read+0x33>
+    if (c < 0) return c;
+  80327a:	48 63 d0             	movslq %eax,%rdx
+  80327d:	78 13                	js     803292 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80327f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803284:	83 f8 04             	cmp    $0x4,%eax
+  803287:	74 09                	je     803292 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803289:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80328d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803292:	48 89 d0             	mov    %rdx,%rax
+  803295:	48 83 c4 08          	add    $0x8,%rsp
+  803299:	5b                   	pop    %rbx
+  80329a:	41 5c                	pop    %r12
+  80329c:	41 5d                	pop    %r13
+  80329e:	5d                   	pop    %rbp
+  80329f:	c3                   	ret
+  8032a0:	48 89 d0             	mov    %rdx,%rax
+  8032a3:	c3                   	ret
+
+00000000008032a4 <cputchar>:
+cputchar(int ch) {
+  8032a4:	55                   	push   %rbp
+  8032a5:	48 89 e5             	mov    %rsp,%rbp
+  8032a8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032ac:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032b0:	be 01 00 00 00       	mov    $0x1,%esi
+  8032b5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032b9:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  8032c0:	00 00 00 
+  8032c3:	ff d0                	call   *%rax
+}
+  8032c5:	c9                   	leave
+  8032c6:	c3                   	ret
+
+00000000008032c7 <getchar>:
+getchar(void) {
+  8032c7:	55                   	push   %rbp
+  8032c8:	48 89 e5             	mov    %rsp,%rbp
+  8032cb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032cf:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032d4:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032dd:	48 b8 23 0a 80 00 00 	movabs $0x800a23,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032eb:	85 c0                	test   %eax,%eax
+  8032ed:	78 06                	js     8032f5 <getchar+0x2e>
+  8032ef:	74 08                	je     8032f9 <getchar+0x32>
+  8032f1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032f5:	89 d0                	mov    %edx,%eax
+  8032f7:	c9                   	leave
+  8032f8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032f9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032fe:	eb f5                	jmp    8032f5 <getchar+0x2e>
+
+0000000000803300 <iscons>:
+iscons(int fdnum) {
+  803300:	55                   	push   %rbp
+  803301:	48 89 e5             	mov    %rsp,%rbp
+  803304:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803308:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80330c:	48 b8 40 07 80 00 00 	movabs $0x800740,%rax
+  803313:	00 00 00 
+  803316:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803318:	85 c0                	test   %eax,%eax
+  80331a:	78 18                	js     803334 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80331c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803320:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803327:	00 00 00 
+  80332a:	8b 00                	mov    (%rax),%eax
+  80332c:	39 02                	cmp    %eax,(%rdx)
+  80332e:	0f 94 c0             	sete   %al
+  803331:	0f b6 c0             	movzbl %al,%eax
+}
+  803334:	c9                   	leave
+  803335:	c3                   	ret
+
+0000000000803336 <opencons>:
+opencons(void) {
+  803336:	55                   	push   %rbp
+  803337:	48 89 e5             	mov    %rsp,%rbp
+  80333a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80333e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803342:	48 b8 e0 06 80 00 00 	movabs $0x8006e0,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+  80334e:	85 c0                	test   %eax,%eax
+  803350:	78 49                	js     80339b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803352:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803357:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80335c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803360:	bf 00 00 00 00       	mov    $0x0,%edi
+  803365:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+  803371:	85 c0                	test   %eax,%eax
+  803373:	78 26                	js     80339b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803375:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803379:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803380:	00 00 
+  803382:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803384:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803388:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80338f:	48 b8 b2 06 80 00 00 	movabs $0x8006b2,%rax
+  803396:	00 00 00 
+  803399:	ff d0                	call   *%rax
+}
+  80339b:	c9                   	leave
+  80339c:	c3                   	ret
+
+000000000080339d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80339d:	55                   	push   %rbp
+  80339e:	48 89 e5             	mov    %rsp,%rbp
+  8033a1:	41 56                	push   %r14
+  8033a3:	41 55                	push   %r13
+  8033a5:	41 54                	push   %r12
+  8033a7:	53                   	push   %rbx
+  8033a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8033ac:	49 89 fc             	mov    %rdi,%r12
+  8033af:	41 89 f5             	mov    %esi,%r13d
+  8033b2:	48 89 d3             	mov    %rdx,%rbx
+  8033b5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033b9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8033bd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8033c1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8033c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033cc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033d0:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033d4:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033d8:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8033df:	00 00 00 
+  8033e2:	4c 8b 30             	mov    (%rax),%r14
+  8033e5:	48 b8 f2 01 80 00 00 	movabs $0x8001f2,%rax
+  8033ec:	00 00 00 
+  8033ef:	ff d0                	call   *%rax
+  8033f1:	89 c6                	mov    %eax,%esi
+  8033f3:	45 89 e8             	mov    %r13d,%r8d
+  8033f6:	4c 89 e1             	mov    %r12,%rcx
+  8033f9:	4c 89 f2             	mov    %r14,%rdx
+  8033fc:	48 bf 20 48 80 00 00 	movabs $0x804820,%rdi
+  803403:	00 00 00 
+  803406:	b8 00 00 00 00       	mov    $0x0,%eax
+  80340b:	49 bc ed 34 80 00 00 	movabs $0x8034ed,%r12
+  803412:	00 00 00 
+  803415:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803418:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80341c:	48 89 df             	mov    %rbx,%rdi
+  80341f:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  803426:	00 00 00 
+  803429:	ff d0                	call   *%rax
+    cprintf("\n");
+  80342b:	48 bf 6b 47 80 00 00 	movabs $0x80476b,%rdi
+  803432:	00 00 00 
+  803435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80343a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80343d:	cc                   	int3
+  80343e:	eb fd                	jmp    80343d <_panic+0xa0>
+
+0000000000803440 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803440:	55                   	push   %rbp
+  803441:	48 89 e5             	mov    %rsp,%rbp
+  803444:	53                   	push   %rbx
+  803445:	48 83 ec 08          	sub    $0x8,%rsp
+  803449:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80344c:	8b 06                	mov    (%rsi),%eax
+  80344e:	8d 50 01             	lea    0x1(%rax),%edx
+  803451:	89 16                	mov    %edx,(%rsi)
+  803453:	48 98                	cltq
+  803455:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80345a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803460:	74 0a                	je     80346c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803462:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803466:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80346a:	c9                   	leave
+  80346b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80346c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803470:	be ff 00 00 00       	mov    $0xff,%esi
+  803475:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  80347c:	00 00 00 
+  80347f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803481:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803487:	eb d9                	jmp    803462 <putch+0x22>
+
+0000000000803489 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803489:	55                   	push   %rbp
+  80348a:	48 89 e5             	mov    %rsp,%rbp
+  80348d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803494:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803497:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80349e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8034a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8034ab:	48 89 f1             	mov    %rsi,%rcx
+  8034ae:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8034b5:	48 bf 40 34 80 00 00 	movabs $0x803440,%rdi
+  8034bc:	00 00 00 
+  8034bf:	48 b8 3d 36 80 00 00 	movabs $0x80363d,%rax
+  8034c6:	00 00 00 
+  8034c9:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8034cb:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034d2:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8034d9:	48 b8 47 01 80 00 00 	movabs $0x800147,%rax
+  8034e0:	00 00 00 
+  8034e3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034e5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034eb:	c9                   	leave
+  8034ec:	c3                   	ret
+
+00000000008034ed <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034ed:	55                   	push   %rbp
+  8034ee:	48 89 e5             	mov    %rsp,%rbp
+  8034f1:	48 83 ec 50          	sub    $0x50,%rsp
+  8034f5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034f9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034fd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803501:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803505:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803509:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803510:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803514:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803518:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80351c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  803520:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803524:	48 b8 89 34 80 00 00 	movabs $0x803489,%rax
+  80352b:	00 00 00 
+  80352e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  803530:	c9                   	leave
+  803531:	c3                   	ret
+
+0000000000803532 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803532:	55                   	push   %rbp
+  803533:	48 89 e5             	mov    %rsp,%rbp
+  803536:	41 57                	push   %r15
+  803538:	41 56                	push   %r14
+  80353a:	41 55                	push   %r13
+  80353c:	41 54                	push   %r12
+  80353e:	53                   	push   %rbx
+  80353f:	48 83 ec 18          	sub    $0x18,%rsp
+  803543:	49 89 fc             	mov    %rdi,%r12
+  803546:	49 89 f5             	mov    %rsi,%r13
+  803549:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80354d:	8b 45 10             	mov    0x10(%rbp),%eax
+  803550:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803553:	41 89 cf             	mov    %ecx,%r15d
+  803556:	4c 39 fa             	cmp    %r15,%rdx
+  803559:	73 5b                	jae    8035b6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80355b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80355f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803563:	85 db                	test   %ebx,%ebx
+  803565:	7e 0e                	jle    803575 <print_num+0x43>
+            putch(padc, put_arg);
+  803567:	4c 89 ee             	mov    %r13,%rsi
+  80356a:	44 89 f7             	mov    %r14d,%edi
+  80356d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803570:	83 eb 01             	sub    $0x1,%ebx
+  803573:	75 f2                	jne    803567 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803575:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803579:	48 b9 54 48 80 00 00 	movabs $0x804854,%rcx
+  803580:	00 00 00 
+  803583:	48 b8 43 48 80 00 00 	movabs $0x804843,%rax
+  80358a:	00 00 00 
+  80358d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803591:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803595:	ba 00 00 00 00       	mov    $0x0,%edx
+  80359a:	49 f7 f7             	div    %r15
+  80359d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8035a1:	4c 89 ee             	mov    %r13,%rsi
+  8035a4:	41 ff d4             	call   *%r12
+}
+  8035a7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8035ab:	5b                   	pop    %rbx
+  8035ac:	41 5c                	pop    %r12
+  8035ae:	41 5d                	pop    %r13
+  8035b0:	41 5e                	pop    %r14
+  8035b2:	41 5f                	pop    %r15
+  8035b4:	5d                   	pop    %rbp
+  8035b5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8035b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035bf:	49 f7 f7             	div    %r15
+  8035c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8035c6:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8035ca:	52                   	push   %rdx
+  8035cb:	45 0f be c9          	movsbl %r9b,%r9d
+  8035cf:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035d3:	48 89 c2             	mov    %rax,%rdx
+  8035d6:	48 b8 32 35 80 00 00 	movabs $0x803532,%rax
+  8035dd:	00 00 00 
+  8035e0:	ff d0                	call   *%rax
+  8035e2:	48 83 c4 10          	add    $0x10,%rsp
+  8035e6:	eb 8d                	jmp    803575 <print_num+0x43>
+
+00000000008035e8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035e8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035ec:	48 8b 06             	mov    (%rsi),%rax
+  8035ef:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035f3:	73 0a                	jae    8035ff <sprintputch+0x17>
+        *state->start++ = ch;
+  8035f5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035f9:	48 89 16             	mov    %rdx,(%rsi)
+  8035fc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035ff:	c3                   	ret
+
+0000000000803600 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  803600:	55                   	push   %rbp
+  803601:	48 89 e5             	mov    %rsp,%rbp
+  803604:	48 83 ec 50          	sub    $0x50,%rsp
+  803608:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80360c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803610:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  803614:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80361b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80361f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803623:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803627:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80362b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80362f:	48 b8 3d 36 80 00 00 	movabs $0x80363d,%rax
+  803636:	00 00 00 
+  803639:	ff d0                	call   *%rax
+}
+  80363b:	c9                   	leave
+  80363c:	c3                   	ret
+
+000000000080363d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80363d:	55                   	push   %rbp
+  80363e:	48 89 e5             	mov    %rsp,%rbp
+  803641:	41 57                	push   %r15
+  803643:	41 56                	push   %r14
+  803645:	41 55                	push   %r13
+  803647:	41 54                	push   %r12
+  803649:	53                   	push   %rbx
+  80364a:	48 83 ec 38          	sub    $0x38,%rsp
+  80364e:	49 89 fe             	mov    %rdi,%r14
+  803651:	49 89 f5             	mov    %rsi,%r13
+  803654:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803657:	48 8b 01             	mov    (%rcx),%rax
+  80365a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80365e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803662:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803666:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80366a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80366e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803672:	0f b6 3b             	movzbl (%rbx),%edi
+  803675:	40 80 ff 25          	cmp    $0x25,%dil
+  803679:	74 18                	je     803693 <vprintfmt+0x56>
+            if (!ch) return;
+  80367b:	40 84 ff             	test   %dil,%dil
+  80367e:	0f 84 b1 06 00 00    	je     803d35 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803684:	40 0f b6 ff          	movzbl %dil,%edi
+  803688:	4c 89 ee             	mov    %r13,%rsi
+  80368b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80368e:	4c 89 e3             	mov    %r12,%rbx
+  803691:	eb db                	jmp    80366e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803693:	be 00 00 00 00       	mov    $0x0,%esi
+  803698:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80369c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8036a1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036a7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8036ae:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036b2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8036b7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8036bc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8036bf:	83 e8 23             	sub    $0x23,%eax
+  8036c2:	3c 57                	cmp    $0x57,%al
+  8036c4:	0f 87 51 06 00 00    	ja     803d1b <vprintfmt+0x6de>
+  8036ca:	0f b6 c0             	movzbl %al,%eax
+  8036cd:	48 b9 00 4a 80 00 00 	movabs $0x804a00,%rcx
+  8036d4:	00 00 00 
+  8036d7:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8036da:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036dd:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036e1:	eb cf                	jmp    8036b2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036e3:	49 89 dc             	mov    %rbx,%r12
+  8036e6:	be 01 00 00 00       	mov    $0x1,%esi
+  8036eb:	eb c5                	jmp    8036b2 <vprintfmt+0x75>
+            padc = ch;
+  8036ed:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036f1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036f4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036f7:	eb b9                	jmp    8036b2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8036ff:	77 24                	ja     803725 <vprintfmt+0xe8>
+  803701:	89 c1                	mov    %eax,%ecx
+  803703:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803707:	83 c0 08             	add    $0x8,%eax
+  80370a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80370d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  803710:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  803713:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803717:	79 99                	jns    8036b2 <vprintfmt+0x75>
+                width = precision;
+  803719:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80371d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803723:	eb 8d                	jmp    8036b2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803725:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803729:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80372d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803731:	eb da                	jmp    80370d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803733:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803738:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80373c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803742:	3c 39                	cmp    $0x39,%al
+  803744:	77 1c                	ja     803762 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803746:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80374a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80374e:	0f b6 c0             	movzbl %al,%eax
+  803751:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803756:	0f b6 03             	movzbl (%rbx),%eax
+  803759:	3c 39                	cmp    $0x39,%al
+  80375b:	76 e9                	jbe    803746 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80375d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803760:	eb b1                	jmp    803713 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803762:	49 89 dc             	mov    %rbx,%r12
+  803765:	eb ac                	jmp    803713 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803767:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80376a:	85 c9                	test   %ecx,%ecx
+  80376c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803771:	0f 49 c1             	cmovns %ecx,%eax
+  803774:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803777:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80377a:	e9 33 ff ff ff       	jmp    8036b2 <vprintfmt+0x75>
+            lflag++;
+  80377f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803782:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803785:	e9 28 ff ff ff       	jmp    8036b2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80378a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80378d:	83 f8 2f             	cmp    $0x2f,%eax
+  803790:	77 19                	ja     8037ab <vprintfmt+0x16e>
+  803792:	89 c2                	mov    %eax,%edx
+  803794:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803798:	83 c0 08             	add    $0x8,%eax
+  80379b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80379e:	8b 3a                	mov    (%rdx),%edi
+  8037a0:	4c 89 ee             	mov    %r13,%rsi
+  8037a3:	41 ff d6             	call   *%r14
+            break;
+  8037a6:	e9 c3 fe ff ff       	jmp    80366e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8037ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037b7:	eb e5                	jmp    80379e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8037b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8037bf:	77 5a                	ja     80381b <vprintfmt+0x1de>
+  8037c1:	89 c2                	mov    %eax,%edx
+  8037c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c7:	83 c0 08             	add    $0x8,%eax
+  8037ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8037cd:	8b 02                	mov    (%rdx),%eax
+  8037cf:	89 c1                	mov    %eax,%ecx
+  8037d1:	f7 d9                	neg    %ecx
+  8037d3:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8037d6:	83 f9 16             	cmp    $0x16,%ecx
+  8037d9:	7f 4e                	jg     803829 <vprintfmt+0x1ec>
+  8037db:	48 63 c1             	movslq %ecx,%rax
+  8037de:	48 ba c0 4c 80 00 00 	movabs $0x804cc0,%rdx
+  8037e5:	00 00 00 
+  8037e8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037ec:	48 85 c0             	test   %rax,%rax
+  8037ef:	74 38                	je     803829 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037f1:	48 89 c1             	mov    %rax,%rcx
+  8037f4:	48 ba d9 47 80 00 00 	movabs $0x8047d9,%rdx
+  8037fb:	00 00 00 
+  8037fe:	4c 89 ee             	mov    %r13,%rsi
+  803801:	4c 89 f7             	mov    %r14,%rdi
+  803804:	b8 00 00 00 00       	mov    $0x0,%eax
+  803809:	49 b8 00 36 80 00 00 	movabs $0x803600,%r8
+  803810:	00 00 00 
+  803813:	41 ff d0             	call   *%r8
+  803816:	e9 53 fe ff ff       	jmp    80366e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80381b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80381f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803827:	eb a4                	jmp    8037cd <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803829:	48 ba 6c 48 80 00 00 	movabs $0x80486c,%rdx
+  803830:	00 00 00 
+  803833:	4c 89 ee             	mov    %r13,%rsi
+  803836:	4c 89 f7             	mov    %r14,%rdi
+  803839:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383e:	49 b8 00 36 80 00 00 	movabs $0x803600,%r8
+  803845:	00 00 00 
+  803848:	41 ff d0             	call   *%r8
+  80384b:	e9 1e fe ff ff       	jmp    80366e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803850:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803853:	83 f8 2f             	cmp    $0x2f,%eax
+  803856:	77 6c                	ja     8038c4 <vprintfmt+0x287>
+  803858:	89 c2                	mov    %eax,%edx
+  80385a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80385e:	83 c0 08             	add    $0x8,%eax
+  803861:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803864:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803867:	48 85 d2             	test   %rdx,%rdx
+  80386a:	48 b8 65 48 80 00 00 	movabs $0x804865,%rax
+  803871:	00 00 00 
+  803874:	48 0f 45 c2          	cmovne %rdx,%rax
+  803878:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80387c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803880:	7e 06                	jle    803888 <vprintfmt+0x24b>
+  803882:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803886:	75 4a                	jne    8038d2 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803888:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80388c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803890:	0f b6 00             	movzbl (%rax),%eax
+  803893:	84 c0                	test   %al,%al
+  803895:	0f 85 9a 00 00 00    	jne    803935 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80389b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80389e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8038a2:	85 c0                	test   %eax,%eax
+  8038a4:	0f 8e c4 fd ff ff    	jle    80366e <vprintfmt+0x31>
+  8038aa:	4c 89 ee             	mov    %r13,%rsi
+  8038ad:	bf 20 00 00 00       	mov    $0x20,%edi
+  8038b2:	41 ff d6             	call   *%r14
+  8038b5:	41 83 ec 01          	sub    $0x1,%r12d
+  8038b9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8038bd:	75 eb                	jne    8038aa <vprintfmt+0x26d>
+  8038bf:	e9 aa fd ff ff       	jmp    80366e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8038c4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038c8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038d0:	eb 92                	jmp    803864 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038d2:	49 63 f7             	movslq %r15d,%rsi
+  8038d5:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8038d9:	48 b8 ef 3d 80 00 00 	movabs $0x803def,%rax
+  8038e0:	00 00 00 
+  8038e3:	ff d0                	call   *%rax
+  8038e5:	48 89 c2             	mov    %rax,%rdx
+  8038e8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038eb:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038ed:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038f0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038f3:	85 c0                	test   %eax,%eax
+  8038f5:	7e 91                	jle    803888 <vprintfmt+0x24b>
+  8038f7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038fc:	4c 89 ee             	mov    %r13,%rsi
+  8038ff:	44 89 e7             	mov    %r12d,%edi
+  803902:	41 ff d6             	call   *%r14
+  803905:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803909:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80390c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80390f:	75 eb                	jne    8038fc <vprintfmt+0x2bf>
+  803911:	e9 72 ff ff ff       	jmp    803888 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803916:	0f b6 f8             	movzbl %al,%edi
+  803919:	4c 89 ee             	mov    %r13,%rsi
+  80391c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80391f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803923:	49 83 c4 01          	add    $0x1,%r12
+  803927:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80392d:	84 c0                	test   %al,%al
+  80392f:	0f 84 66 ff ff ff    	je     80389b <vprintfmt+0x25e>
+  803935:	45 85 ff             	test   %r15d,%r15d
+  803938:	78 0a                	js     803944 <vprintfmt+0x307>
+  80393a:	41 83 ef 01          	sub    $0x1,%r15d
+  80393e:	0f 88 57 ff ff ff    	js     80389b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803944:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803948:	74 cc                	je     803916 <vprintfmt+0x2d9>
+  80394a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80394d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803952:	80 fa 5e             	cmp    $0x5e,%dl
+  803955:	77 c2                	ja     803919 <vprintfmt+0x2dc>
+  803957:	eb bd                	jmp    803916 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803959:	40 84 f6             	test   %sil,%sil
+  80395c:	75 26                	jne    803984 <vprintfmt+0x347>
+    switch (lflag) {
+  80395e:	85 d2                	test   %edx,%edx
+  803960:	74 59                	je     8039bb <vprintfmt+0x37e>
+  803962:	83 fa 01             	cmp    $0x1,%edx
+  803965:	74 7b                	je     8039e2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803967:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80396a:	83 f8 2f             	cmp    $0x2f,%eax
+  80396d:	0f 87 96 00 00 00    	ja     803a09 <vprintfmt+0x3cc>
+  803973:	89 c2                	mov    %eax,%edx
+  803975:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803979:	83 c0 08             	add    $0x8,%eax
+  80397c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80397f:	4c 8b 22             	mov    (%rdx),%r12
+  803982:	eb 17                	jmp    80399b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803984:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803987:	83 f8 2f             	cmp    $0x2f,%eax
+  80398a:	77 21                	ja     8039ad <vprintfmt+0x370>
+  80398c:	89 c2                	mov    %eax,%edx
+  80398e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803992:	83 c0 08             	add    $0x8,%eax
+  803995:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803998:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80399b:	4d 85 e4             	test   %r12,%r12
+  80399e:	78 7a                	js     803a1a <vprintfmt+0x3dd>
+            num = i;
+  8039a0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8039a3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8039a8:	e9 50 02 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8039ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039b9:	eb dd                	jmp    803998 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8039bb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039be:	83 f8 2f             	cmp    $0x2f,%eax
+  8039c1:	77 11                	ja     8039d4 <vprintfmt+0x397>
+  8039c3:	89 c2                	mov    %eax,%edx
+  8039c5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039c9:	83 c0 08             	add    $0x8,%eax
+  8039cc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039cf:	4c 63 22             	movslq (%rdx),%r12
+  8039d2:	eb c7                	jmp    80399b <vprintfmt+0x35e>
+  8039d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039e0:	eb ed                	jmp    8039cf <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8039e8:	77 11                	ja     8039fb <vprintfmt+0x3be>
+  8039ea:	89 c2                	mov    %eax,%edx
+  8039ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039f0:	83 c0 08             	add    $0x8,%eax
+  8039f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039f6:	4c 8b 22             	mov    (%rdx),%r12
+  8039f9:	eb a0                	jmp    80399b <vprintfmt+0x35e>
+  8039fb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039ff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a07:	eb ed                	jmp    8039f6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803a09:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a0d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a11:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a15:	e9 65 ff ff ff       	jmp    80397f <vprintfmt+0x342>
+                putch('-', put_arg);
+  803a1a:	4c 89 ee             	mov    %r13,%rsi
+  803a1d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803a22:	41 ff d6             	call   *%r14
+                i = -i;
+  803a25:	49 f7 dc             	neg    %r12
+  803a28:	e9 73 ff ff ff       	jmp    8039a0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803a2d:	40 84 f6             	test   %sil,%sil
+  803a30:	75 32                	jne    803a64 <vprintfmt+0x427>
+    switch (lflag) {
+  803a32:	85 d2                	test   %edx,%edx
+  803a34:	74 5d                	je     803a93 <vprintfmt+0x456>
+  803a36:	83 fa 01             	cmp    $0x1,%edx
+  803a39:	0f 84 82 00 00 00    	je     803ac1 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a3f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a42:	83 f8 2f             	cmp    $0x2f,%eax
+  803a45:	0f 87 a5 00 00 00    	ja     803af0 <vprintfmt+0x4b3>
+  803a4b:	89 c2                	mov    %eax,%edx
+  803a4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a51:	83 c0 08             	add    $0x8,%eax
+  803a54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a57:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a5f:	e9 99 01 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a67:	83 f8 2f             	cmp    $0x2f,%eax
+  803a6a:	77 19                	ja     803a85 <vprintfmt+0x448>
+  803a6c:	89 c2                	mov    %eax,%edx
+  803a6e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a72:	83 c0 08             	add    $0x8,%eax
+  803a75:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a78:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a7b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a80:	e9 78 01 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+  803a85:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a89:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a91:	eb e5                	jmp    803a78 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a96:	83 f8 2f             	cmp    $0x2f,%eax
+  803a99:	77 18                	ja     803ab3 <vprintfmt+0x476>
+  803a9b:	89 c2                	mov    %eax,%edx
+  803a9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803aa1:	83 c0 08             	add    $0x8,%eax
+  803aa4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aa7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803aa9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803aae:	e9 4a 01 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+  803ab3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ab7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803abb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803abf:	eb e6                	jmp    803aa7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803ac1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ac4:	83 f8 2f             	cmp    $0x2f,%eax
+  803ac7:	77 19                	ja     803ae2 <vprintfmt+0x4a5>
+  803ac9:	89 c2                	mov    %eax,%edx
+  803acb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803acf:	83 c0 08             	add    $0x8,%eax
+  803ad2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ad5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803ad8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803add:	e9 1b 01 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+  803ae2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ae6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aee:	eb e5                	jmp    803ad5 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803af0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803af4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803af8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803afc:	e9 56 ff ff ff       	jmp    803a57 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803b01:	40 84 f6             	test   %sil,%sil
+  803b04:	75 2e                	jne    803b34 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803b06:	85 d2                	test   %edx,%edx
+  803b08:	74 59                	je     803b63 <vprintfmt+0x526>
+  803b0a:	83 fa 01             	cmp    $0x1,%edx
+  803b0d:	74 7f                	je     803b8e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803b0f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b12:	83 f8 2f             	cmp    $0x2f,%eax
+  803b15:	0f 87 9f 00 00 00    	ja     803bba <vprintfmt+0x57d>
+  803b1b:	89 c2                	mov    %eax,%edx
+  803b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b21:	83 c0 08             	add    $0x8,%eax
+  803b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803b2f:	e9 c9 00 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b37:	83 f8 2f             	cmp    $0x2f,%eax
+  803b3a:	77 19                	ja     803b55 <vprintfmt+0x518>
+  803b3c:	89 c2                	mov    %eax,%edx
+  803b3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b42:	83 c0 08             	add    $0x8,%eax
+  803b45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b48:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b4b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b50:	e9 a8 00 00 00       	jmp    803bfd <vprintfmt+0x5c0>
+  803b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b61:	eb e5                	jmp    803b48 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b63:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b66:	83 f8 2f             	cmp    $0x2f,%eax
+  803b69:	77 15                	ja     803b80 <vprintfmt+0x543>
+  803b6b:	89 c2                	mov    %eax,%edx
+  803b6d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b71:	83 c0 08             	add    $0x8,%eax
+  803b74:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b77:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b79:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b7e:	eb 7d                	jmp    803bfd <vprintfmt+0x5c0>
+  803b80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b8c:	eb e9                	jmp    803b77 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b91:	83 f8 2f             	cmp    $0x2f,%eax
+  803b94:	77 16                	ja     803bac <vprintfmt+0x56f>
+  803b96:	89 c2                	mov    %eax,%edx
+  803b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b9c:	83 c0 08             	add    $0x8,%eax
+  803b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ba2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803ba5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803baa:	eb 51                	jmp    803bfd <vprintfmt+0x5c0>
+  803bac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bb8:	eb e8                	jmp    803ba2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803bba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bc6:	e9 5c ff ff ff       	jmp    803b27 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803bcb:	4c 89 ee             	mov    %r13,%rsi
+  803bce:	bf 30 00 00 00       	mov    $0x30,%edi
+  803bd3:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803bd6:	4c 89 ee             	mov    %r13,%rsi
+  803bd9:	bf 78 00 00 00       	mov    $0x78,%edi
+  803bde:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803be1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803be4:	83 f8 2f             	cmp    $0x2f,%eax
+  803be7:	77 47                	ja     803c30 <vprintfmt+0x5f3>
+  803be9:	89 c2                	mov    %eax,%edx
+  803beb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bef:	83 c0 08             	add    $0x8,%eax
+  803bf2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bf5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bf8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bfd:	48 83 ec 08          	sub    $0x8,%rsp
+  803c01:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803c05:	0f 94 c0             	sete   %al
+  803c08:	0f b6 c0             	movzbl %al,%eax
+  803c0b:	50                   	push   %rax
+  803c0c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803c11:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803c15:	4c 89 ee             	mov    %r13,%rsi
+  803c18:	4c 89 f7             	mov    %r14,%rdi
+  803c1b:	48 b8 32 35 80 00 00 	movabs $0x803532,%rax
+  803c22:	00 00 00 
+  803c25:	ff d0                	call   *%rax
+            break;
+  803c27:	48 83 c4 10          	add    $0x10,%rsp
+  803c2b:	e9 3e fa ff ff       	jmp    80366e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c3c:	eb b7                	jmp    803bf5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c3e:	40 84 f6             	test   %sil,%sil
+  803c41:	75 2b                	jne    803c6e <vprintfmt+0x631>
+    switch (lflag) {
+  803c43:	85 d2                	test   %edx,%edx
+  803c45:	74 56                	je     803c9d <vprintfmt+0x660>
+  803c47:	83 fa 01             	cmp    $0x1,%edx
+  803c4a:	74 7f                	je     803ccb <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c4f:	83 f8 2f             	cmp    $0x2f,%eax
+  803c52:	0f 87 a2 00 00 00    	ja     803cfa <vprintfmt+0x6bd>
+  803c58:	89 c2                	mov    %eax,%edx
+  803c5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c5e:	83 c0 08             	add    $0x8,%eax
+  803c61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c67:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c6c:	eb 8f                	jmp    803bfd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c6e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c71:	83 f8 2f             	cmp    $0x2f,%eax
+  803c74:	77 19                	ja     803c8f <vprintfmt+0x652>
+  803c76:	89 c2                	mov    %eax,%edx
+  803c78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c7c:	83 c0 08             	add    $0x8,%eax
+  803c7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c85:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c8a:	e9 6e ff ff ff       	jmp    803bfd <vprintfmt+0x5c0>
+  803c8f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c93:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c97:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c9b:	eb e5                	jmp    803c82 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c9d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ca0:	83 f8 2f             	cmp    $0x2f,%eax
+  803ca3:	77 18                	ja     803cbd <vprintfmt+0x680>
+  803ca5:	89 c2                	mov    %eax,%edx
+  803ca7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cab:	83 c0 08             	add    $0x8,%eax
+  803cae:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cb1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803cb3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803cb8:	e9 40 ff ff ff       	jmp    803bfd <vprintfmt+0x5c0>
+  803cbd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc9:	eb e6                	jmp    803cb1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803ccb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803cce:	83 f8 2f             	cmp    $0x2f,%eax
+  803cd1:	77 19                	ja     803cec <vprintfmt+0x6af>
+  803cd3:	89 c2                	mov    %eax,%edx
+  803cd5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cd9:	83 c0 08             	add    $0x8,%eax
+  803cdc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cdf:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803ce2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803ce7:	e9 11 ff ff ff       	jmp    803bfd <vprintfmt+0x5c0>
+  803cec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cf8:	eb e5                	jmp    803cdf <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d06:	e9 59 ff ff ff       	jmp    803c64 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803d0b:	4c 89 ee             	mov    %r13,%rsi
+  803d0e:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d13:	41 ff d6             	call   *%r14
+            break;
+  803d16:	e9 53 f9 ff ff       	jmp    80366e <vprintfmt+0x31>
+            putch('%', put_arg);
+  803d1b:	4c 89 ee             	mov    %r13,%rsi
+  803d1e:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d23:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803d26:	48 83 eb 01          	sub    $0x1,%rbx
+  803d2a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803d2e:	75 f6                	jne    803d26 <vprintfmt+0x6e9>
+  803d30:	e9 39 f9 ff ff       	jmp    80366e <vprintfmt+0x31>
+}
+  803d35:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d39:	5b                   	pop    %rbx
+  803d3a:	41 5c                	pop    %r12
+  803d3c:	41 5d                	pop    %r13
+  803d3e:	41 5e                	pop    %r14
+  803d40:	41 5f                	pop    %r15
+  803d42:	5d                   	pop    %rbp
+  803d43:	c3                   	ret
+
+0000000000803d44 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d44:	55                   	push   %rbp
+  803d45:	48 89 e5             	mov    %rsp,%rbp
+  803d48:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d4c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d50:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d55:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d59:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d60:	48 85 ff             	test   %rdi,%rdi
+  803d63:	74 2b                	je     803d90 <vsnprintf+0x4c>
+  803d65:	48 85 f6             	test   %rsi,%rsi
+  803d68:	74 26                	je     803d90 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d6a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d6e:	48 bf e8 35 80 00 00 	movabs $0x8035e8,%rdi
+  803d75:	00 00 00 
+  803d78:	48 b8 3d 36 80 00 00 	movabs $0x80363d,%rax
+  803d7f:	00 00 00 
+  803d82:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d84:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d88:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d8b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d8e:	c9                   	leave
+  803d8f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d90:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d95:	eb f7                	jmp    803d8e <vsnprintf+0x4a>
+
+0000000000803d97 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d97:	55                   	push   %rbp
+  803d98:	48 89 e5             	mov    %rsp,%rbp
+  803d9b:	48 83 ec 50          	sub    $0x50,%rsp
+  803d9f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803da3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803da7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803dab:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803db2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803db6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803dba:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803dbe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803dc2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803dc6:	48 b8 44 3d 80 00 00 	movabs $0x803d44,%rax
+  803dcd:	00 00 00 
+  803dd0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803dd2:	c9                   	leave
+  803dd3:	c3                   	ret
+
+0000000000803dd4 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803dd4:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803dd7:	74 10                	je     803de9 <strlen+0x15>
+    size_t n = 0;
+  803dd9:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803dde:	48 83 c0 01          	add    $0x1,%rax
+  803de2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803de6:	75 f6                	jne    803dde <strlen+0xa>
+  803de8:	c3                   	ret
+    size_t n = 0;
+  803de9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dee:	c3                   	ret
+
+0000000000803def <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803def:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803df2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803df7:	48 85 f6             	test   %rsi,%rsi
+  803dfa:	74 11                	je     803e0d <strnlen+0x1e>
+  803dfc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803e00:	74 0c                	je     803e0e <strnlen+0x1f>
+  803e02:	48 83 c2 01          	add    $0x1,%rdx
+  803e06:	48 39 d0             	cmp    %rdx,%rax
+  803e09:	75 f1                	jne    803dfc <strnlen+0xd>
+  803e0b:	eb 04                	jmp    803e11 <strnlen+0x22>
+  803e0d:	c3                   	ret
+  803e0e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803e11:	c3                   	ret
+
+0000000000803e12 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803e12:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803e15:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e1a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803e1e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803e21:	48 83 c2 01          	add    $0x1,%rdx
+  803e25:	84 c9                	test   %cl,%cl
+  803e27:	75 f1                	jne    803e1a <strcpy+0x8>
+        ;
+    return res;
+}
+  803e29:	c3                   	ret
+
+0000000000803e2a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803e2a:	55                   	push   %rbp
+  803e2b:	48 89 e5             	mov    %rsp,%rbp
+  803e2e:	41 54                	push   %r12
+  803e30:	53                   	push   %rbx
+  803e31:	48 89 fb             	mov    %rdi,%rbx
+  803e34:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e37:	48 b8 d4 3d 80 00 00 	movabs $0x803dd4,%rax
+  803e3e:	00 00 00 
+  803e41:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e43:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e47:	4c 89 e6             	mov    %r12,%rsi
+  803e4a:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  803e51:	00 00 00 
+  803e54:	ff d0                	call   *%rax
+    return dst;
+}
+  803e56:	48 89 d8             	mov    %rbx,%rax
+  803e59:	5b                   	pop    %rbx
+  803e5a:	41 5c                	pop    %r12
+  803e5c:	5d                   	pop    %rbp
+  803e5d:	c3                   	ret
+
+0000000000803e5e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e5e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e61:	48 85 d2             	test   %rdx,%rdx
+  803e64:	74 1f                	je     803e85 <strncpy+0x27>
+  803e66:	48 01 fa             	add    %rdi,%rdx
+  803e69:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e6c:	48 83 c1 01          	add    $0x1,%rcx
+  803e70:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e74:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e78:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e7c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e80:	48 39 ca             	cmp    %rcx,%rdx
+  803e83:	75 e7                	jne    803e6c <strncpy+0xe>
+    }
+    return ret;
+}
+  803e85:	c3                   	ret
+
+0000000000803e86 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e86:	48 89 f8             	mov    %rdi,%rax
+  803e89:	48 85 d2             	test   %rdx,%rdx
+  803e8c:	74 24                	je     803eb2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e8e:	48 83 ea 01          	sub    $0x1,%rdx
+  803e92:	74 1b                	je     803eaf <strlcpy+0x29>
+  803e94:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e98:	0f b6 16             	movzbl (%rsi),%edx
+  803e9b:	84 d2                	test   %dl,%dl
+  803e9d:	74 10                	je     803eaf <strlcpy+0x29>
+            *dst++ = *src++;
+  803e9f:	48 83 c6 01          	add    $0x1,%rsi
+  803ea3:	48 83 c0 01          	add    $0x1,%rax
+  803ea7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803eaa:	48 39 c8             	cmp    %rcx,%rax
+  803ead:	75 e9                	jne    803e98 <strlcpy+0x12>
+        *dst = '\0';
+  803eaf:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803eb2:	48 29 f8             	sub    %rdi,%rax
+}
+  803eb5:	c3                   	ret
+
+0000000000803eb6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803eb6:	0f b6 07             	movzbl (%rdi),%eax
+  803eb9:	84 c0                	test   %al,%al
+  803ebb:	74 13                	je     803ed0 <strcmp+0x1a>
+  803ebd:	38 06                	cmp    %al,(%rsi)
+  803ebf:	75 0f                	jne    803ed0 <strcmp+0x1a>
+  803ec1:	48 83 c7 01          	add    $0x1,%rdi
+  803ec5:	48 83 c6 01          	add    $0x1,%rsi
+  803ec9:	0f b6 07             	movzbl (%rdi),%eax
+  803ecc:	84 c0                	test   %al,%al
+  803ece:	75 ed                	jne    803ebd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ed0:	0f b6 c0             	movzbl %al,%eax
+  803ed3:	0f b6 16             	movzbl (%rsi),%edx
+  803ed6:	29 d0                	sub    %edx,%eax
+}
+  803ed8:	c3                   	ret
+
+0000000000803ed9 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803ed9:	48 85 d2             	test   %rdx,%rdx
+  803edc:	74 1f                	je     803efd <strncmp+0x24>
+  803ede:	0f b6 07             	movzbl (%rdi),%eax
+  803ee1:	84 c0                	test   %al,%al
+  803ee3:	74 1e                	je     803f03 <strncmp+0x2a>
+  803ee5:	3a 06                	cmp    (%rsi),%al
+  803ee7:	75 1a                	jne    803f03 <strncmp+0x2a>
+  803ee9:	48 83 c7 01          	add    $0x1,%rdi
+  803eed:	48 83 c6 01          	add    $0x1,%rsi
+  803ef1:	48 83 ea 01          	sub    $0x1,%rdx
+  803ef5:	75 e7                	jne    803ede <strncmp+0x5>
+
+    if (!n) return 0;
+  803ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efc:	c3                   	ret
+  803efd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f02:	c3                   	ret
+  803f03:	48 85 d2             	test   %rdx,%rdx
+  803f06:	74 09                	je     803f11 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803f08:	0f b6 07             	movzbl (%rdi),%eax
+  803f0b:	0f b6 16             	movzbl (%rsi),%edx
+  803f0e:	29 d0                	sub    %edx,%eax
+  803f10:	c3                   	ret
+    if (!n) return 0;
+  803f11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f16:	c3                   	ret
+
+0000000000803f17 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803f17:	0f b6 17             	movzbl (%rdi),%edx
+  803f1a:	84 d2                	test   %dl,%dl
+  803f1c:	74 18                	je     803f36 <strchr+0x1f>
+        if (*str == c) {
+  803f1e:	0f be d2             	movsbl %dl,%edx
+  803f21:	39 f2                	cmp    %esi,%edx
+  803f23:	74 17                	je     803f3c <strchr+0x25>
+    for (; *str; str++) {
+  803f25:	48 83 c7 01          	add    $0x1,%rdi
+  803f29:	0f b6 17             	movzbl (%rdi),%edx
+  803f2c:	84 d2                	test   %dl,%dl
+  803f2e:	75 ee                	jne    803f1e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f35:	c3                   	ret
+  803f36:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3b:	c3                   	ret
+  803f3c:	48 89 f8             	mov    %rdi,%rax
+}
+  803f3f:	c3                   	ret
+
+0000000000803f40 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f40:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f43:	0f b6 17             	movzbl (%rdi),%edx
+  803f46:	84 d2                	test   %dl,%dl
+  803f48:	74 13                	je     803f5d <strfind+0x1d>
+  803f4a:	0f be d2             	movsbl %dl,%edx
+  803f4d:	39 f2                	cmp    %esi,%edx
+  803f4f:	74 0b                	je     803f5c <strfind+0x1c>
+  803f51:	48 83 c0 01          	add    $0x1,%rax
+  803f55:	0f b6 10             	movzbl (%rax),%edx
+  803f58:	84 d2                	test   %dl,%dl
+  803f5a:	75 ee                	jne    803f4a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f5c:	c3                   	ret
+  803f5d:	c3                   	ret
+
+0000000000803f5e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f5e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f61:	48 89 f8             	mov    %rdi,%rax
+  803f64:	48 f7 d8             	neg    %rax
+  803f67:	83 e0 07             	and    $0x7,%eax
+  803f6a:	49 89 d1             	mov    %rdx,%r9
+  803f6d:	49 29 c1             	sub    %rax,%r9
+  803f70:	78 36                	js     803fa8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f72:	40 0f b6 c6          	movzbl %sil,%eax
+  803f76:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f7d:	01 01 01 
+  803f80:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f84:	40 f6 c7 07          	test   $0x7,%dil
+  803f88:	75 38                	jne    803fc2 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f8a:	4c 89 c9             	mov    %r9,%rcx
+  803f8d:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f91:	74 0c                	je     803f9f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f93:	fc                   	cld
+  803f94:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f97:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f9b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f9f:	4d 85 c9             	test   %r9,%r9
+  803fa2:	75 45                	jne    803fe9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803fa4:	4c 89 c0             	mov    %r8,%rax
+  803fa7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803fa8:	48 85 d2             	test   %rdx,%rdx
+  803fab:	74 f7                	je     803fa4 <memset+0x46>
+  803fad:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803fb0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803fb3:	48 83 c0 01          	add    $0x1,%rax
+  803fb7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803fbb:	48 39 c2             	cmp    %rax,%rdx
+  803fbe:	75 f3                	jne    803fb3 <memset+0x55>
+  803fc0:	eb e2                	jmp    803fa4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803fc2:	40 f6 c7 01          	test   $0x1,%dil
+  803fc6:	74 06                	je     803fce <memset+0x70>
+  803fc8:	88 07                	mov    %al,(%rdi)
+  803fca:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fce:	40 f6 c7 02          	test   $0x2,%dil
+  803fd2:	74 07                	je     803fdb <memset+0x7d>
+  803fd4:	66 89 07             	mov    %ax,(%rdi)
+  803fd7:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fdb:	40 f6 c7 04          	test   $0x4,%dil
+  803fdf:	74 a9                	je     803f8a <memset+0x2c>
+  803fe1:	89 07                	mov    %eax,(%rdi)
+  803fe3:	48 83 c7 04          	add    $0x4,%rdi
+  803fe7:	eb a1                	jmp    803f8a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fe9:	41 f6 c1 04          	test   $0x4,%r9b
+  803fed:	74 06                	je     803ff5 <memset+0x97>
+  803fef:	89 07                	mov    %eax,(%rdi)
+  803ff1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803ff5:	41 f6 c1 02          	test   $0x2,%r9b
+  803ff9:	74 07                	je     804002 <memset+0xa4>
+  803ffb:	66 89 07             	mov    %ax,(%rdi)
+  803ffe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  804002:	41 f6 c1 01          	test   $0x1,%r9b
+  804006:	74 9c                	je     803fa4 <memset+0x46>
+  804008:	88 07                	mov    %al,(%rdi)
+  80400a:	eb 98                	jmp    803fa4 <memset+0x46>
+
+000000000080400c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80400c:	48 89 f8             	mov    %rdi,%rax
+  80400f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  804012:	48 39 fe             	cmp    %rdi,%rsi
+  804015:	73 3b                	jae    804052 <memmove+0x46>
+  804017:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80401b:	48 39 d7             	cmp    %rdx,%rdi
+  80401e:	73 32                	jae    804052 <memmove+0x46>
+        s += n;
+        d += n;
+  804020:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804024:	48 89 d6             	mov    %rdx,%rsi
+  804027:	48 09 fe             	or     %rdi,%rsi
+  80402a:	48 09 ce             	or     %rcx,%rsi
+  80402d:	40 f6 c6 07          	test   $0x7,%sil
+  804031:	75 12                	jne    804045 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  804033:	48 83 ef 08          	sub    $0x8,%rdi
+  804037:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80403b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80403f:	fd                   	std
+  804040:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804043:	fc                   	cld
+  804044:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804045:	48 83 ef 01          	sub    $0x1,%rdi
+  804049:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80404d:	fd                   	std
+  80404e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804050:	eb f1                	jmp    804043 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804052:	48 89 f2             	mov    %rsi,%rdx
+  804055:	48 09 c2             	or     %rax,%rdx
+  804058:	48 09 ca             	or     %rcx,%rdx
+  80405b:	f6 c2 07             	test   $0x7,%dl
+  80405e:	75 0c                	jne    80406c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804060:	48 c1 e9 03          	shr    $0x3,%rcx
+  804064:	48 89 c7             	mov    %rax,%rdi
+  804067:	fc                   	cld
+  804068:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80406b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80406c:	48 89 c7             	mov    %rax,%rdi
+  80406f:	fc                   	cld
+  804070:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804072:	c3                   	ret
+
+0000000000804073 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804073:	55                   	push   %rbp
+  804074:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  804077:	48 b8 0c 40 80 00 00 	movabs $0x80400c,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+}
+  804083:	5d                   	pop    %rbp
+  804084:	c3                   	ret
+
+0000000000804085 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804085:	55                   	push   %rbp
+  804086:	48 89 e5             	mov    %rsp,%rbp
+  804089:	41 57                	push   %r15
+  80408b:	41 56                	push   %r14
+  80408d:	41 55                	push   %r13
+  80408f:	41 54                	push   %r12
+  804091:	53                   	push   %rbx
+  804092:	48 83 ec 08          	sub    $0x8,%rsp
+  804096:	49 89 fe             	mov    %rdi,%r14
+  804099:	49 89 f7             	mov    %rsi,%r15
+  80409c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80409f:	48 89 f7             	mov    %rsi,%rdi
+  8040a2:	48 b8 d4 3d 80 00 00 	movabs $0x803dd4,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+  8040ae:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8040b1:	48 89 de             	mov    %rbx,%rsi
+  8040b4:	4c 89 f7             	mov    %r14,%rdi
+  8040b7:	48 b8 ef 3d 80 00 00 	movabs $0x803def,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+  8040c3:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040c6:	48 39 c3             	cmp    %rax,%rbx
+  8040c9:	74 36                	je     804101 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8040cb:	48 89 d8             	mov    %rbx,%rax
+  8040ce:	4c 29 e8             	sub    %r13,%rax
+  8040d1:	49 39 c4             	cmp    %rax,%r12
+  8040d4:	73 31                	jae    804107 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8040d6:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040db:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040df:	4c 89 fe             	mov    %r15,%rsi
+  8040e2:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  8040e9:	00 00 00 
+  8040ec:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040ee:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040f2:	48 83 c4 08          	add    $0x8,%rsp
+  8040f6:	5b                   	pop    %rbx
+  8040f7:	41 5c                	pop    %r12
+  8040f9:	41 5d                	pop    %r13
+  8040fb:	41 5e                	pop    %r14
+  8040fd:	41 5f                	pop    %r15
+  8040ff:	5d                   	pop    %rbp
+  804100:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  804101:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804105:	eb eb                	jmp    8040f2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  804107:	48 83 eb 01          	sub    $0x1,%rbx
+  80410b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80410f:	48 89 da             	mov    %rbx,%rdx
+  804112:	4c 89 fe             	mov    %r15,%rsi
+  804115:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  804121:	49 01 de             	add    %rbx,%r14
+  804124:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  804129:	eb c3                	jmp    8040ee <strlcat+0x69>
+
+000000000080412b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80412b:	48 85 d2             	test   %rdx,%rdx
+  80412e:	74 2d                	je     80415d <memcmp+0x32>
+  804130:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  804135:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  804139:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80413e:	44 38 c1             	cmp    %r8b,%cl
+  804141:	75 0f                	jne    804152 <memcmp+0x27>
+    while (n-- > 0) {
+  804143:	48 83 c0 01          	add    $0x1,%rax
+  804147:	48 39 c2             	cmp    %rax,%rdx
+  80414a:	75 e9                	jne    804135 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80414c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804151:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804152:	0f b6 c1             	movzbl %cl,%eax
+  804155:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804159:	44 29 c0             	sub    %r8d,%eax
+  80415c:	c3                   	ret
+    return 0;
+  80415d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804162:	c3                   	ret
+
+0000000000804163 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804163:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804167:	48 39 c7             	cmp    %rax,%rdi
+  80416a:	73 0f                	jae    80417b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80416c:	40 38 37             	cmp    %sil,(%rdi)
+  80416f:	74 0e                	je     80417f <memfind+0x1c>
+    for (; src < end; src++) {
+  804171:	48 83 c7 01          	add    $0x1,%rdi
+  804175:	48 39 f8             	cmp    %rdi,%rax
+  804178:	75 f2                	jne    80416c <memfind+0x9>
+  80417a:	c3                   	ret
+  80417b:	48 89 f8             	mov    %rdi,%rax
+  80417e:	c3                   	ret
+  80417f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804182:	c3                   	ret
+
+0000000000804183 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804183:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  804186:	0f b6 37             	movzbl (%rdi),%esi
+  804189:	40 80 fe 20          	cmp    $0x20,%sil
+  80418d:	74 06                	je     804195 <strtol+0x12>
+  80418f:	40 80 fe 09          	cmp    $0x9,%sil
+  804193:	75 13                	jne    8041a8 <strtol+0x25>
+  804195:	48 83 c7 01          	add    $0x1,%rdi
+  804199:	0f b6 37             	movzbl (%rdi),%esi
+  80419c:	40 80 fe 20          	cmp    $0x20,%sil
+  8041a0:	74 f3                	je     804195 <strtol+0x12>
+  8041a2:	40 80 fe 09          	cmp    $0x9,%sil
+  8041a6:	74 ed                	je     804195 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8041a8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8041ab:	83 e0 fd             	and    $0xfffffffd,%eax
+  8041ae:	3c 01                	cmp    $0x1,%al
+  8041b0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041b4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8041ba:	75 0f                	jne    8041cb <strtol+0x48>
+  8041bc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8041bf:	74 14                	je     8041d5 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8041c1:	85 d2                	test   %edx,%edx
+  8041c3:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8041c8:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8041cb:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041d0:	4c 63 ca             	movslq %edx,%r9
+  8041d3:	eb 36                	jmp    80420b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041d5:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8041d9:	74 0f                	je     8041ea <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041db:	85 d2                	test   %edx,%edx
+  8041dd:	75 ec                	jne    8041cb <strtol+0x48>
+        s++;
+  8041df:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041e3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041e8:	eb e1                	jmp    8041cb <strtol+0x48>
+        s += 2;
+  8041ea:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041ee:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041f3:	eb d6                	jmp    8041cb <strtol+0x48>
+            dig -= '0';
+  8041f5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041f8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041fc:	41 39 d0             	cmp    %edx,%r8d
+  8041ff:	7d 21                	jge    804222 <strtol+0x9f>
+        val = val * base + dig;
+  804201:	49 0f af c1          	imul   %r9,%rax
+  804205:	0f b6 c9             	movzbl %cl,%ecx
+  804208:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80420b:	48 83 c7 01          	add    $0x1,%rdi
+  80420f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  804213:	80 f9 39             	cmp    $0x39,%cl
+  804216:	76 dd                	jbe    8041f5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  804218:	80 f9 7b             	cmp    $0x7b,%cl
+  80421b:	77 05                	ja     804222 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80421d:	83 e9 57             	sub    $0x57,%ecx
+  804220:	eb d6                	jmp    8041f8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  804222:	4d 85 d2             	test   %r10,%r10
+  804225:	74 03                	je     80422a <strtol+0xa7>
+  804227:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80422a:	48 89 c2             	mov    %rax,%rdx
+  80422d:	48 f7 da             	neg    %rdx
+  804230:	40 80 fe 2d          	cmp    $0x2d,%sil
+  804234:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804238:	c3                   	ret
+
+0000000000804239 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804239:	55                   	push   %rbp
+  80423a:	48 89 e5             	mov    %rsp,%rbp
+  80423d:	41 56                	push   %r14
+  80423f:	41 55                	push   %r13
+  804241:	41 54                	push   %r12
+  804243:	53                   	push   %rbx
+  804244:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804247:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80424e:	00 00 00 
+  804251:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804255:	74 27                	je     80427e <_handle_vectored_pagefault+0x45>
+  804257:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80425c:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804263:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804266:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804269:	4c 89 e7             	mov    %r12,%rdi
+  80426c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804271:	84 c0                	test   %al,%al
+  804273:	75 45                	jne    8042ba <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804275:	48 83 c3 01          	add    $0x1,%rbx
+  804279:	49 3b 1e             	cmp    (%r14),%rbx
+  80427c:	72 eb                	jb     804269 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80427e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804285:	00 
+  804286:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80428b:	4d 8b 04 24          	mov    (%r12),%r8
+  80428f:	48 ba 98 4d 80 00 00 	movabs $0x804d98,%rdx
+  804296:	00 00 00 
+  804299:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80429e:	48 bf c8 4d 80 00 00 	movabs $0x804dc8,%rdi
+  8042a5:	00 00 00 
+  8042a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ad:	49 ba 9d 33 80 00 00 	movabs $0x80339d,%r10
+  8042b4:	00 00 00 
+  8042b7:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8042ba:	5b                   	pop    %rbx
+  8042bb:	41 5c                	pop    %r12
+  8042bd:	41 5d                	pop    %r13
+  8042bf:	41 5e                	pop    %r14
+  8042c1:	5d                   	pop    %rbp
+  8042c2:	c3                   	ret
+
+00000000008042c3 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042c3:	55                   	push   %rbp
+  8042c4:	48 89 e5             	mov    %rsp,%rbp
+  8042c7:	53                   	push   %rbx
+  8042c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8042cc:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042cf:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042d6:	00 00 00 
+  8042d9:	80 38 00             	cmpb   $0x0,(%rax)
+  8042dc:	0f 84 84 00 00 00    	je     804366 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e2:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042e9:	00 00 00 
+  8042ec:	48 8b 10             	mov    (%rax),%rdx
+  8042ef:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042f4:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042fb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042fe:	48 85 d2             	test   %rdx,%rdx
+  804301:	74 19                	je     80431c <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804303:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804307:	0f 84 e8 00 00 00    	je     8043f5 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80430d:	48 83 c0 01          	add    $0x1,%rax
+  804311:	48 39 d0             	cmp    %rdx,%rax
+  804314:	75 ed                	jne    804303 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804316:	48 83 fa 08          	cmp    $0x8,%rdx
+  80431a:	74 1c                	je     804338 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80431c:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804320:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804327:	00 00 00 
+  80432a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804331:	00 00 00 
+  804334:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804338:	48 b8 f2 01 80 00 00 	movabs $0x8001f2,%rax
+  80433f:	00 00 00 
+  804342:	ff d0                	call   *%rax
+  804344:	89 c7                	mov    %eax,%edi
+  804346:	48 be bb 44 80 00 00 	movabs $0x8044bb,%rsi
+  80434d:	00 00 00 
+  804350:	48 b8 3d 04 80 00 00 	movabs $0x80043d,%rax
+  804357:	00 00 00 
+  80435a:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80435c:	85 c0                	test   %eax,%eax
+  80435e:	78 68                	js     8043c8 <add_pgfault_handler+0x105>
+    return res;
+}
+  804360:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804364:	c9                   	leave
+  804365:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804366:	48 b8 f2 01 80 00 00 	movabs $0x8001f2,%rax
+  80436d:	00 00 00 
+  804370:	ff d0                	call   *%rax
+  804372:	89 c7                	mov    %eax,%edi
+  804374:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804379:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437e:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804385:	00 00 00 
+  804388:	48 b8 7f 02 80 00 00 	movabs $0x80027f,%rax
+  80438f:	00 00 00 
+  804392:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804394:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80439b:	00 00 00 
+  80439e:	48 8b 02             	mov    (%rdx),%rax
+  8043a1:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8043a5:	48 89 0a             	mov    %rcx,(%rdx)
+  8043a8:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043af:	00 00 00 
+  8043b2:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8043b6:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043bd:	00 00 00 
+  8043c0:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043c3:	e9 70 ff ff ff       	jmp    804338 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043c8:	89 c1                	mov    %eax,%ecx
+  8043ca:	48 ba d6 4d 80 00 00 	movabs $0x804dd6,%rdx
+  8043d1:	00 00 00 
+  8043d4:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043d9:	48 bf c8 4d 80 00 00 	movabs $0x804dc8,%rdi
+  8043e0:	00 00 00 
+  8043e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e8:	49 b8 9d 33 80 00 00 	movabs $0x80339d,%r8
+  8043ef:	00 00 00 
+  8043f2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043fa:	e9 61 ff ff ff       	jmp    804360 <add_pgfault_handler+0x9d>
+
+00000000008043ff <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043ff:	55                   	push   %rbp
+  804400:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804403:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80440a:	00 00 00 
+  80440d:	80 38 00             	cmpb   $0x0,(%rax)
+  804410:	74 33                	je     804445 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804412:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804419:	00 00 00 
+  80441c:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804421:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804428:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80442b:	48 85 c0             	test   %rax,%rax
+  80442e:	0f 84 85 00 00 00    	je     8044b9 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804434:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804438:	74 40                	je     80447a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80443a:	48 83 c1 01          	add    $0x1,%rcx
+  80443e:	48 39 c1             	cmp    %rax,%rcx
+  804441:	75 f1                	jne    804434 <remove_pgfault_handler+0x35>
+  804443:	eb 74                	jmp    8044b9 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804445:	48 b9 ee 4d 80 00 00 	movabs $0x804dee,%rcx
+  80444c:	00 00 00 
+  80444f:	48 ba c7 47 80 00 00 	movabs $0x8047c7,%rdx
+  804456:	00 00 00 
+  804459:	be 43 00 00 00       	mov    $0x43,%esi
+  80445e:	48 bf c8 4d 80 00 00 	movabs $0x804dc8,%rdi
+  804465:	00 00 00 
+  804468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446d:	49 b8 9d 33 80 00 00 	movabs $0x80339d,%r8
+  804474:	00 00 00 
+  804477:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80447a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804481:	00 
+  804482:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804486:	48 29 ca             	sub    %rcx,%rdx
+  804489:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804490:	00 00 00 
+  804493:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804497:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80449c:	48 89 ce             	mov    %rcx,%rsi
+  80449f:	48 b8 0c 40 80 00 00 	movabs $0x80400c,%rax
+  8044a6:	00 00 00 
+  8044a9:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8044ab:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044b2:	00 00 00 
+  8044b5:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8044b9:	5d                   	pop    %rbp
+  8044ba:	c3                   	ret
+
+00000000008044bb <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8044bb:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8044be:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  8044c5:	00 00 00 
+    call *%rax
+  8044c8:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044ca:	41 5f                	pop    %r15
+	popq %r15
+  8044cc:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044ce:	41 5f                	pop    %r15
+	popq %r14
+  8044d0:	41 5e                	pop    %r14
+	popq %r13
+  8044d2:	41 5d                	pop    %r13
+	popq %r12
+  8044d4:	41 5c                	pop    %r12
+	popq %r11
+  8044d6:	41 5b                	pop    %r11
+	popq %r10
+  8044d8:	41 5a                	pop    %r10
+	popq %r9
+  8044da:	41 59                	pop    %r9
+	popq %r8
+  8044dc:	41 58                	pop    %r8
+	popq %rsi
+  8044de:	5e                   	pop    %rsi
+	popq %rdi
+  8044df:	5f                   	pop    %rdi
+	popq %rbp
+  8044e0:	5d                   	pop    %rbp
+	popq %rdx
+  8044e1:	5a                   	pop    %rdx
+	popq %rcx
+  8044e2:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044e3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044e8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044ed:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044f1:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044f4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044f9:	5b                   	pop    %rbx
+	popq %rax
+  8044fa:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044fb:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044ff:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804500:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804505:	c3                   	ret
+
+0000000000804506 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804506:	55                   	push   %rbp
+  804507:	48 89 e5             	mov    %rsp,%rbp
+  80450a:	41 55                	push   %r13
+  80450c:	41 54                	push   %r12
+  80450e:	53                   	push   %rbx
+  80450f:	48 83 ec 08          	sub    $0x8,%rsp
+  804513:	49 89 fd             	mov    %rdi,%r13
+  804516:	48 89 f7             	mov    %rsi,%rdi
+  804519:	48 89 d3             	mov    %rdx,%rbx
+  80451c:	49 89 cc             	mov    %rcx,%r12
+  80451f:	4c 89 c2             	mov    %r8,%rdx
+  804522:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804525:	48 85 f6             	test   %rsi,%rsi
+  804528:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80452f:	00 00 00 
+  804532:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804536:	be 00 10 00 00       	mov    $0x1000,%esi
+  80453b:	48 85 db             	test   %rbx,%rbx
+  80453e:	74 03                	je     804543 <ipc_recv_futex+0x3d>
+  804540:	48 8b 33             	mov    (%rbx),%rsi
+  804543:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804547:	48 b8 c9 04 80 00 00 	movabs $0x8004c9,%rax
+  80454e:	00 00 00 
+  804551:	ff d0                	call   *%rax
+    if (res < 0) {
+  804553:	85 c0                	test   %eax,%eax
+  804555:	78 75                	js     8045cc <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804557:	4d 85 ed             	test   %r13,%r13
+  80455a:	74 14                	je     804570 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80455c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804563:	00 00 00 
+  804566:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80456c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804570:	4d 85 e4             	test   %r12,%r12
+  804573:	74 14                	je     804589 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804575:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80457c:	00 00 00 
+  80457f:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804585:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804589:	48 85 db             	test   %rbx,%rbx
+  80458c:	74 23                	je     8045b1 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80458e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804595:	00 00 00 
+  804598:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80459e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a3:	85 c9                	test   %ecx,%ecx
+  8045a5:	74 07                	je     8045ae <ipc_recv_futex+0xa8>
+  8045a7:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8045ae:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8045b1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045b8:	00 00 00 
+  8045bb:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045c1:	48 83 c4 08          	add    $0x8,%rsp
+  8045c5:	5b                   	pop    %rbx
+  8045c6:	41 5c                	pop    %r12
+  8045c8:	41 5d                	pop    %r13
+  8045ca:	5d                   	pop    %rbp
+  8045cb:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045cc:	4d 85 ed             	test   %r13,%r13
+  8045cf:	74 08                	je     8045d9 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045d1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045d8:	00 
+        if (perm_store != NULL) {
+  8045d9:	4d 85 e4             	test   %r12,%r12
+  8045dc:	74 08                	je     8045e6 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045de:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045e5:	00 
+        if (size != NULL) {
+  8045e6:	48 85 db             	test   %rbx,%rbx
+  8045e9:	74 d6                	je     8045c1 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045eb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045f2:	eb cd                	jmp    8045c1 <ipc_recv_futex+0xbb>
+
+00000000008045f4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045f4:	55                   	push   %rbp
+  8045f5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8045fc:	6a 00                	push   $0x0
+  8045fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804604:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80460a:	48 b8 06 45 80 00 00 	movabs $0x804506,%rax
+  804611:	00 00 00 
+  804614:	ff d0                	call   *%rax
+}
+  804616:	c9                   	leave
+  804617:	c3                   	ret
+
+0000000000804618 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804618:	55                   	push   %rbp
+  804619:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80461c:	48 85 d2             	test   %rdx,%rdx
+  80461f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804626:	00 00 00 
+  804629:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80462d:	89 f6                	mov    %esi,%esi
+  80462f:	48 b8 b2 04 80 00 00 	movabs $0x8004b2,%rax
+  804636:	00 00 00 
+  804639:	ff d0                	call   *%rax
+    if (res < 0) {
+  80463b:	85 c0                	test   %eax,%eax
+  80463d:	78 02                	js     804641 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80463f:	5d                   	pop    %rbp
+  804640:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804641:	89 c1                	mov    %eax,%ecx
+  804643:	48 ba 08 4e 80 00 00 	movabs $0x804e08,%rdx
+  80464a:	00 00 00 
+  80464d:	be 50 00 00 00       	mov    $0x50,%esi
+  804652:	48 bf 1c 4e 80 00 00 	movabs $0x804e1c,%rdi
+  804659:	00 00 00 
+  80465c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804661:	49 b8 9d 33 80 00 00 	movabs $0x80339d,%r8
+  804668:	00 00 00 
+  80466b:	41 ff d0             	call   *%r8
+
+000000000080466e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80466e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804673:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80467a:	00 00 00 
+  80467d:	48 89 d0             	mov    %rdx,%rax
+  804680:	48 c1 e0 04          	shl    $0x4,%rax
+  804684:	48 29 d0             	sub    %rdx,%rax
+  804687:	48 c1 e0 05          	shl    $0x5,%rax
+  80468b:	48 01 c8             	add    %rcx,%rax
+  80468e:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804694:	39 f8                	cmp    %edi,%eax
+  804696:	74 13                	je     8046ab <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804698:	48 83 c2 01          	add    $0x1,%rdx
+  80469c:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8046a3:	75 d8                	jne    80467d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046aa:	c3                   	ret
+            return envs[i].env_id;
+  8046ab:	48 89 d0             	mov    %rdx,%rax
+  8046ae:	48 c1 e0 04          	shl    $0x4,%rax
+  8046b2:	48 29 d0             	sub    %rdx,%rax
+  8046b5:	48 c1 e0 05          	shl    $0x5,%rax
+  8046b9:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046c0:	00 00 00 
+  8046c3:	48 01 d0             	add    %rdx,%rax
+  8046c6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046cc:	c3                   	ret
+  8046cd:	0f 1f 00             	nopl   (%rax)
+
+00000000008046d0 <__rodata_start>:
+  8046d0:	3c 75                	cmp    $0x75,%al
+  8046d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046d3:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046d8:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8046dc:	1f                   	(bad)
+  8046dd:	44 00 00             	add    %r8b,(%rax)
+  8046e0:	73 79                	jae    80475b <__rodata_start+0x8b>
+  8046e2:	73 63                	jae    804747 <__rodata_start+0x77>
+  8046e4:	61                   	(bad)
+  8046e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab67 <__bss_end+0x721c8b67>
+  8046ed:	65 74 75             	gs je  804765 <__rodata_start+0x95>
+  8046f0:	72 6e                	jb     804760 <__rodata_start+0x90>
+  8046f2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab74 <__bss_end+0x281c8b74>
+  8046f9:	28 
+  8046fa:	3e 20 30             	ds and %dh,(%rax)
+  8046fd:	29 00                	sub    %eax,(%rax)
+  8046ff:	6c                   	insb   (%dx),%es:(%rdi)
+  804700:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  804707:	61                   	(bad)
+  804708:	6c                   	insb   (%dx),%es:(%rdi)
+  804709:	6c                   	insb   (%dx),%es:(%rdi)
+  80470a:	2e 63 00             	cs movsxd (%rax),%eax
+  80470d:	0f 1f 00             	nopl   (%rax)
+  804710:	5b                   	pop    %rbx
+  804711:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804716:	20 75 6e             	and    %dh,0x6e(%rbp)
+  804719:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80471d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471e:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  804722:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  804729:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805194 <__ctors_end+0xb4>
+  804730:	5b                   	pop    %rbx
+  804731:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804736:	20 66 74             	and    %ah,0x74(%rsi)
+  804739:	72 75                	jb     8047b0 <devtab+0x10>
+  80473b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80473c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80473f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad67aa <__bss_end+0x2d2947aa>
+  804746:	20 62 61             	and    %ah,0x61(%rdx)
+  804749:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80474d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804751:	5b                   	pop    %rbx
+  804752:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804757:	20 72 65             	and    %dh,0x65(%rdx)
+  80475a:	61                   	(bad)
+  80475b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad67c6 <__bss_end+0x2d2947c6>
+  804762:	20 62 61             	and    %ah,0x61(%rdx)
+  804765:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804769:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80476d:	5b                   	pop    %rbx
+  80476e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804773:	20 77 72             	and    %dh,0x72(%rdi)
+  804776:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80477d:	2d 
+  80477e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804783:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804786:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80478a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804791:	00 00 00 
+  804794:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80479b:	00 00 00 
+  80479e:	66 90                	xchg   %ax,%ax
+
+00000000008047a0 <devtab>:
+  8047a0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  8047b0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8047d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804800:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804810:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804820:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804830:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804840:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804850:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804860:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804870:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804880:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804890:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  8048a0:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  8048b0:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8048c0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8048d0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048e0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048f0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  804900:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  804910:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804920:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804930:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804940:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804950:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804960:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804970:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804980:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804990:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  8049a0:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  8049b0:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8049c0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8049d0:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049e0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049f0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  804a00:	da 36 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .6.......=......
+  804a10:	0b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804a20:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804a30:	1b 3d 80 00 00 00 00 00 f9 36 80 00 00 00 00 00     .=.......6......
+  804a40:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804a50:	ed 36 80 00 00 00 00 00 67 37 80 00 00 00 00 00     .6......g7......
+  804a60:	1b 3d 80 00 00 00 00 00 ed 36 80 00 00 00 00 00     .=.......6......
+  804a70:	33 37 80 00 00 00 00 00 33 37 80 00 00 00 00 00     37......37......
+  804a80:	33 37 80 00 00 00 00 00 33 37 80 00 00 00 00 00     37......37......
+  804a90:	33 37 80 00 00 00 00 00 33 37 80 00 00 00 00 00     37......37......
+  804aa0:	33 37 80 00 00 00 00 00 33 37 80 00 00 00 00 00     37......37......
+  804ab0:	33 37 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     37.......=......
+  804ac0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804ad0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804ae0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804af0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b00:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b10:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b20:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b30:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b40:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b50:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b60:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b70:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b80:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804b90:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804ba0:	1b 3d 80 00 00 00 00 00 3e 3c 80 00 00 00 00 00     .=......><......
+  804bb0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804bc0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804bd0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804be0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804bf0:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804c00:	8a 37 80 00 00 00 00 00 59 39 80 00 00 00 00 00     .7......Y9......
+  804c10:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804c20:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804c30:	b9 37 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .7.......=......
+  804c40:	1b 3d 80 00 00 00 00 00 7f 37 80 00 00 00 00 00     .=.......7......
+  804c50:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804c60:	01 3b 80 00 00 00 00 00 cb 3b 80 00 00 00 00 00     .;.......;......
+  804c70:	1b 3d 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     .=.......=......
+  804c80:	50 38 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     P8.......=......
+  804c90:	2d 3a 80 00 00 00 00 00 1b 3d 80 00 00 00 00 00     -:.......=......
+  804ca0:	1b 3d 80 00 00 00 00 00 3e 3c 80 00 00 00 00 00     .=......><......
+  804cb0:	1b 3d 80 00 00 00 00 00 e3 36 80 00 00 00 00 00     .=.......6......
+
+0000000000804cc0 <error_string>:
+	...
+  804cc8:	75 48 80 00 00 00 00 00 87 48 80 00 00 00 00 00     uH.......H......
+  804cd8:	97 48 80 00 00 00 00 00 a9 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	b7 48 80 00 00 00 00 00 cb 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	e0 48 80 00 00 00 00 00 f3 48 80 00 00 00 00 00     .H.......H......
+  804d08:	05 49 80 00 00 00 00 00 19 49 80 00 00 00 00 00     .I.......I......
+  804d18:	29 49 80 00 00 00 00 00 3c 49 80 00 00 00 00 00     )I......<I......
+  804d28:	53 49 80 00 00 00 00 00 69 49 80 00 00 00 00 00     SI......iI......
+  804d38:	81 49 80 00 00 00 00 00 99 49 80 00 00 00 00 00     .I.......I......
+  804d48:	a6 49 80 00 00 00 00 00 78 4d 80 00 00 00 00 00     .I......xM......
+  804d58:	ba 49 80 00 00 00 00 00 d2 49 80 00 00 00 00 00     .I.......I......
+  804d68:	dc 49 80 00 00 00 00 00 e6 49 80 00 00 00 00 00     .I.......I......
+  804d78:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d88:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d98:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804da8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804db8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804dc8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804dd8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804de8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804df8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804e08:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804e18:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804e28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ea8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804eb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ec8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ed8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ee8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ef8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f18:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f28:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f38:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f48:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f58:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f68:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f78:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f88:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f98:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fb8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fc8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fe8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ff8:	00 00 00 00 0f 1f 40 00                             ......@.
@@ -0,0 +1,8233 @@
+
+obj/user/faultdie:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 72 00 00 00       	call   800095 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <handler>:
+/* Test user-level fault handler -- just exit when we fault */
+
+#include <inc/lib.h>
+
+bool
+handler(struct UTrapframe *utf) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    void *addr = (void *)utf->utf_fault_va;
+    uint64_t err = utf->utf_err;
+    cprintf("i faulted at va %lx, err %x\n",
+  800029:	8b 57 08             	mov    0x8(%rdi),%edx
+  80002c:	83 e2 07             	and    $0x7,%edx
+  80002f:	48 8b 37             	mov    (%rdi),%rsi
+  800032:	48 bf f8 46 80 00 00 	movabs $0x8046f8,%rdi
+  800039:	00 00 00 
+  80003c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800041:	48 b9 18 02 80 00 00 	movabs $0x800218,%rcx
+  800048:	00 00 00 
+  80004b:	ff d1                	call   *%rcx
+            (unsigned long)addr, (unsigned)(err & 7));
+    sys_env_destroy(sys_getenvid());
+  80004d:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  800054:	00 00 00 
+  800057:	ff d0                	call   *%rax
+  800059:	89 c7                	mov    %eax,%edi
+  80005b:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  800062:	00 00 00 
+  800065:	ff d0                	call   *%rax
+    return 1;
+}
+  800067:	b8 01 00 00 00       	mov    $0x1,%eax
+  80006c:	5d                   	pop    %rbp
+  80006d:	c3                   	ret
+
+000000000080006e <umain>:
+
+void
+umain(int argc, char **argv) {
+  80006e:	55                   	push   %rbp
+  80006f:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(handler);
+  800072:	48 bf 25 00 80 00 00 	movabs $0x800025,%rdi
+  800079:	00 00 00 
+  80007c:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  800083:	00 00 00 
+  800086:	ff d0                	call   *%rax
+    *(volatile int *)0xDEADBEEF = 0;
+  800088:	b8 ef be ad de       	mov    $0xdeadbeef,%eax
+  80008d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800093:	5d                   	pop    %rbp
+  800094:	c3                   	ret
+
+0000000000800095 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800095:	55                   	push   %rbp
+  800096:	48 89 e5             	mov    %rsp,%rbp
+  800099:	41 56                	push   %r14
+  80009b:	41 55                	push   %r13
+  80009d:	41 54                	push   %r12
+  80009f:	53                   	push   %rbx
+  8000a0:	41 89 fd             	mov    %edi,%r13d
+  8000a3:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000a6:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  8000ad:	00 00 00 
+  8000b0:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  8000b7:	00 00 00 
+  8000ba:	48 39 c2             	cmp    %rax,%rdx
+  8000bd:	73 17                	jae    8000d6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8000bf:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8000c2:	49 89 c4             	mov    %rax,%r12
+  8000c5:	48 83 c3 08          	add    $0x8,%rbx
+  8000c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ce:	ff 53 f8             	call   *-0x8(%rbx)
+  8000d1:	4c 39 e3             	cmp    %r12,%rbx
+  8000d4:	72 ef                	jb     8000c5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000d6:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  8000dd:	00 00 00 
+  8000e0:	ff d0                	call   *%rax
+  8000e2:	89 c2                	mov    %eax,%edx
+  8000e4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000ea:	48 89 d0             	mov    %rdx,%rax
+  8000ed:	48 c1 e0 04          	shl    $0x4,%rax
+  8000f1:	48 29 d0             	sub    %rdx,%rax
+  8000f4:	48 c1 e0 05          	shl    $0x5,%rax
+  8000f8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ff:	00 00 00 
+  800102:	48 01 d0             	add    %rdx,%rax
+  800105:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80010c:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80010f:	45 85 ed             	test   %r13d,%r13d
+  800112:	7e 0d                	jle    800121 <libmain+0x8c>
+  800114:	49 8b 06             	mov    (%r14),%rax
+  800117:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80011e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800121:	4c 89 f6             	mov    %r14,%rsi
+  800124:	44 89 ef             	mov    %r13d,%edi
+  800127:	48 b8 6e 00 80 00 00 	movabs $0x80006e,%rax
+  80012e:	00 00 00 
+  800131:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800133:	48 b8 48 01 80 00 00 	movabs $0x800148,%rax
+  80013a:	00 00 00 
+  80013d:	ff d0                	call   *%rax
+#endif
+}
+  80013f:	5b                   	pop    %rbx
+  800140:	41 5c                	pop    %r12
+  800142:	41 5d                	pop    %r13
+  800144:	41 5e                	pop    %r14
+  800146:	5d                   	pop    %rbp
+  800147:	c3                   	ret
+
+0000000000800148 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800148:	55                   	push   %rbp
+  800149:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80014c:	48 b8 c2 19 80 00 00 	movabs $0x8019c2,%rax
+  800153:	00 00 00 
+  800156:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80015d:	48 b8 ac 0f 80 00 00 	movabs $0x800fac,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+}
+  800169:	5d                   	pop    %rbp
+  80016a:	c3                   	ret
+
+000000000080016b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80016b:	55                   	push   %rbp
+  80016c:	48 89 e5             	mov    %rsp,%rbp
+  80016f:	53                   	push   %rbx
+  800170:	48 83 ec 08          	sub    $0x8,%rsp
+  800174:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800177:	8b 06                	mov    (%rsi),%eax
+  800179:	8d 50 01             	lea    0x1(%rax),%edx
+  80017c:	89 16                	mov    %edx,(%rsi)
+  80017e:	48 98                	cltq
+  800180:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800185:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80018b:	74 0a                	je     800197 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80018d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800191:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800195:	c9                   	leave
+  800196:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800197:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80019b:	be ff 00 00 00       	mov    $0xff,%esi
+  8001a0:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  8001a7:	00 00 00 
+  8001aa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8001ac:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8001b2:	eb d9                	jmp    80018d <putch+0x22>
+
+00000000008001b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8001b4:	55                   	push   %rbp
+  8001b5:	48 89 e5             	mov    %rsp,%rbp
+  8001b8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8001bf:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8001c2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001c9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001d6:	48 89 f1             	mov    %rsi,%rcx
+  8001d9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001e0:	48 bf 6b 01 80 00 00 	movabs $0x80016b,%rdi
+  8001e7:	00 00 00 
+  8001ea:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001f6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001fd:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800204:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  80020b:	00 00 00 
+  80020e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800210:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800216:	c9                   	leave
+  800217:	c3                   	ret
+
+0000000000800218 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800218:	55                   	push   %rbp
+  800219:	48 89 e5             	mov    %rsp,%rbp
+  80021c:	48 83 ec 50          	sub    $0x50,%rsp
+  800220:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800224:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800228:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80022c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800230:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800234:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80023b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80023f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800243:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800247:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80024b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80024f:	48 b8 b4 01 80 00 00 	movabs $0x8001b4,%rax
+  800256:	00 00 00 
+  800259:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80025b:	c9                   	leave
+  80025c:	c3                   	ret
+
+000000000080025d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80025d:	55                   	push   %rbp
+  80025e:	48 89 e5             	mov    %rsp,%rbp
+  800261:	41 57                	push   %r15
+  800263:	41 56                	push   %r14
+  800265:	41 55                	push   %r13
+  800267:	41 54                	push   %r12
+  800269:	53                   	push   %rbx
+  80026a:	48 83 ec 18          	sub    $0x18,%rsp
+  80026e:	49 89 fc             	mov    %rdi,%r12
+  800271:	49 89 f5             	mov    %rsi,%r13
+  800274:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800278:	8b 45 10             	mov    0x10(%rbp),%eax
+  80027b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80027e:	41 89 cf             	mov    %ecx,%r15d
+  800281:	4c 39 fa             	cmp    %r15,%rdx
+  800284:	73 5b                	jae    8002e1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800286:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80028a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80028e:	85 db                	test   %ebx,%ebx
+  800290:	7e 0e                	jle    8002a0 <print_num+0x43>
+            putch(padc, put_arg);
+  800292:	4c 89 ee             	mov    %r13,%rsi
+  800295:	44 89 f7             	mov    %r14d,%edi
+  800298:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80029b:	83 eb 01             	sub    $0x1,%ebx
+  80029e:	75 f2                	jne    800292 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8002a0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8002a4:	48 b9 30 47 80 00 00 	movabs $0x804730,%rcx
+  8002ab:	00 00 00 
+  8002ae:	48 b8 1f 47 80 00 00 	movabs $0x80471f,%rax
+  8002b5:	00 00 00 
+  8002b8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8002bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c5:	49 f7 f7             	div    %r15
+  8002c8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002cc:	4c 89 ee             	mov    %r13,%rsi
+  8002cf:	41 ff d4             	call   *%r12
+}
+  8002d2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002d6:	5b                   	pop    %rbx
+  8002d7:	41 5c                	pop    %r12
+  8002d9:	41 5d                	pop    %r13
+  8002db:	41 5e                	pop    %r14
+  8002dd:	41 5f                	pop    %r15
+  8002df:	5d                   	pop    %rbp
+  8002e0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002ea:	49 f7 f7             	div    %r15
+  8002ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8002f1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002f5:	52                   	push   %rdx
+  8002f6:	45 0f be c9          	movsbl %r9b,%r9d
+  8002fa:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002fe:	48 89 c2             	mov    %rax,%rdx
+  800301:	48 b8 5d 02 80 00 00 	movabs $0x80025d,%rax
+  800308:	00 00 00 
+  80030b:	ff d0                	call   *%rax
+  80030d:	48 83 c4 10          	add    $0x10,%rsp
+  800311:	eb 8d                	jmp    8002a0 <print_num+0x43>
+
+0000000000800313 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800313:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800317:	48 8b 06             	mov    (%rsi),%rax
+  80031a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80031e:	73 0a                	jae    80032a <sprintputch+0x17>
+        *state->start++ = ch;
+  800320:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800324:	48 89 16             	mov    %rdx,(%rsi)
+  800327:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80032a:	c3                   	ret
+
+000000000080032b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80032b:	55                   	push   %rbp
+  80032c:	48 89 e5             	mov    %rsp,%rbp
+  80032f:	48 83 ec 50          	sub    $0x50,%rsp
+  800333:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800337:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80033b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80033f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800346:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80034a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800352:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800356:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80035a:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+}
+  800366:	c9                   	leave
+  800367:	c3                   	ret
+
+0000000000800368 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800368:	55                   	push   %rbp
+  800369:	48 89 e5             	mov    %rsp,%rbp
+  80036c:	41 57                	push   %r15
+  80036e:	41 56                	push   %r14
+  800370:	41 55                	push   %r13
+  800372:	41 54                	push   %r12
+  800374:	53                   	push   %rbx
+  800375:	48 83 ec 38          	sub    $0x38,%rsp
+  800379:	49 89 fe             	mov    %rdi,%r14
+  80037c:	49 89 f5             	mov    %rsi,%r13
+  80037f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800382:	48 8b 01             	mov    (%rcx),%rax
+  800385:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800389:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80038d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800391:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800395:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800399:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80039d:	0f b6 3b             	movzbl (%rbx),%edi
+  8003a0:	40 80 ff 25          	cmp    $0x25,%dil
+  8003a4:	74 18                	je     8003be <vprintfmt+0x56>
+            if (!ch) return;
+  8003a6:	40 84 ff             	test   %dil,%dil
+  8003a9:	0f 84 b1 06 00 00    	je     800a60 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8003af:	40 0f b6 ff          	movzbl %dil,%edi
+  8003b3:	4c 89 ee             	mov    %r13,%rsi
+  8003b6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8003b9:	4c 89 e3             	mov    %r12,%rbx
+  8003bc:	eb db                	jmp    800399 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8003be:	be 00 00 00 00       	mov    $0x0,%esi
+  8003c3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003c7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003d2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003d9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003dd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003e2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003e7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003ea:	83 e8 23             	sub    $0x23,%eax
+  8003ed:	3c 57                	cmp    $0x57,%al
+  8003ef:	0f 87 51 06 00 00    	ja     800a46 <vprintfmt+0x6de>
+  8003f5:	0f b6 c0             	movzbl %al,%eax
+  8003f8:	48 b9 e0 48 80 00 00 	movabs $0x8048e0,%rcx
+  8003ff:	00 00 00 
+  800402:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800405:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800408:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80040c:	eb cf                	jmp    8003dd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80040e:	49 89 dc             	mov    %rbx,%r12
+  800411:	be 01 00 00 00       	mov    $0x1,%esi
+  800416:	eb c5                	jmp    8003dd <vprintfmt+0x75>
+            padc = ch;
+  800418:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80041c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80041f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800422:	eb b9                	jmp    8003dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800424:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800427:	83 f8 2f             	cmp    $0x2f,%eax
+  80042a:	77 24                	ja     800450 <vprintfmt+0xe8>
+  80042c:	89 c1                	mov    %eax,%ecx
+  80042e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800432:	83 c0 08             	add    $0x8,%eax
+  800435:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800438:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80043b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80043e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800442:	79 99                	jns    8003dd <vprintfmt+0x75>
+                width = precision;
+  800444:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800448:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80044e:	eb 8d                	jmp    8003dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800450:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800454:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800458:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80045c:	eb da                	jmp    800438 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80045e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800463:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800467:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80046d:	3c 39                	cmp    $0x39,%al
+  80046f:	77 1c                	ja     80048d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800471:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800475:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800479:	0f b6 c0             	movzbl %al,%eax
+  80047c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800481:	0f b6 03             	movzbl (%rbx),%eax
+  800484:	3c 39                	cmp    $0x39,%al
+  800486:	76 e9                	jbe    800471 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800488:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80048b:	eb b1                	jmp    80043e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80048d:	49 89 dc             	mov    %rbx,%r12
+  800490:	eb ac                	jmp    80043e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800492:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800495:	85 c9                	test   %ecx,%ecx
+  800497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049c:	0f 49 c1             	cmovns %ecx,%eax
+  80049f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8004a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004a5:	e9 33 ff ff ff       	jmp    8003dd <vprintfmt+0x75>
+            lflag++;
+  8004aa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8004ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004b0:	e9 28 ff ff ff       	jmp    8003dd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8004b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004bb:	77 19                	ja     8004d6 <vprintfmt+0x16e>
+  8004bd:	89 c2                	mov    %eax,%edx
+  8004bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004c3:	83 c0 08             	add    $0x8,%eax
+  8004c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c9:	8b 3a                	mov    (%rdx),%edi
+  8004cb:	4c 89 ee             	mov    %r13,%rsi
+  8004ce:	41 ff d6             	call   *%r14
+            break;
+  8004d1:	e9 c3 fe ff ff       	jmp    800399 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e2:	eb e5                	jmp    8004c9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8004ea:	77 5a                	ja     800546 <vprintfmt+0x1de>
+  8004ec:	89 c2                	mov    %eax,%edx
+  8004ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004f2:	83 c0 08             	add    $0x8,%eax
+  8004f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004f8:	8b 02                	mov    (%rdx),%eax
+  8004fa:	89 c1                	mov    %eax,%ecx
+  8004fc:	f7 d9                	neg    %ecx
+  8004fe:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800501:	83 f9 16             	cmp    $0x16,%ecx
+  800504:	7f 4e                	jg     800554 <vprintfmt+0x1ec>
+  800506:	48 63 c1             	movslq %ecx,%rax
+  800509:	48 ba a0 4b 80 00 00 	movabs $0x804ba0,%rdx
+  800510:	00 00 00 
+  800513:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800517:	48 85 c0             	test   %rax,%rax
+  80051a:	74 38                	je     800554 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80051c:	48 89 c1             	mov    %rax,%rcx
+  80051f:	48 ba 2a 4d 80 00 00 	movabs $0x804d2a,%rdx
+  800526:	00 00 00 
+  800529:	4c 89 ee             	mov    %r13,%rsi
+  80052c:	4c 89 f7             	mov    %r14,%rdi
+  80052f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800534:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  80053b:	00 00 00 
+  80053e:	41 ff d0             	call   *%r8
+  800541:	e9 53 fe ff ff       	jmp    800399 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800546:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80054a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80054e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800552:	eb a4                	jmp    8004f8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800554:	48 ba 48 47 80 00 00 	movabs $0x804748,%rdx
+  80055b:	00 00 00 
+  80055e:	4c 89 ee             	mov    %r13,%rsi
+  800561:	4c 89 f7             	mov    %r14,%rdi
+  800564:	b8 00 00 00 00       	mov    $0x0,%eax
+  800569:	49 b8 2b 03 80 00 00 	movabs $0x80032b,%r8
+  800570:	00 00 00 
+  800573:	41 ff d0             	call   *%r8
+  800576:	e9 1e fe ff ff       	jmp    800399 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80057b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80057e:	83 f8 2f             	cmp    $0x2f,%eax
+  800581:	77 6c                	ja     8005ef <vprintfmt+0x287>
+  800583:	89 c2                	mov    %eax,%edx
+  800585:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800589:	83 c0 08             	add    $0x8,%eax
+  80058c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80058f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800592:	48 85 d2             	test   %rdx,%rdx
+  800595:	48 b8 41 47 80 00 00 	movabs $0x804741,%rax
+  80059c:	00 00 00 
+  80059f:	48 0f 45 c2          	cmovne %rdx,%rax
+  8005a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8005a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005ab:	7e 06                	jle    8005b3 <vprintfmt+0x24b>
+  8005ad:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8005b1:	75 4a                	jne    8005fd <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8005b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8005b7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8005bb:	0f b6 00             	movzbl (%rax),%eax
+  8005be:	84 c0                	test   %al,%al
+  8005c0:	0f 85 9a 00 00 00    	jne    800660 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005c9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005cd:	85 c0                	test   %eax,%eax
+  8005cf:	0f 8e c4 fd ff ff    	jle    800399 <vprintfmt+0x31>
+  8005d5:	4c 89 ee             	mov    %r13,%rsi
+  8005d8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005dd:	41 ff d6             	call   *%r14
+  8005e0:	41 83 ec 01          	sub    $0x1,%r12d
+  8005e4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005e8:	75 eb                	jne    8005d5 <vprintfmt+0x26d>
+  8005ea:	e9 aa fd ff ff       	jmp    800399 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005fb:	eb 92                	jmp    80058f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005fd:	49 63 f7             	movslq %r15d,%rsi
+  800600:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800604:	48 b8 1a 0b 80 00 00 	movabs $0x800b1a,%rax
+  80060b:	00 00 00 
+  80060e:	ff d0                	call   *%rax
+  800610:	48 89 c2             	mov    %rax,%rdx
+  800613:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800616:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800618:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80061b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80061e:	85 c0                	test   %eax,%eax
+  800620:	7e 91                	jle    8005b3 <vprintfmt+0x24b>
+  800622:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800627:	4c 89 ee             	mov    %r13,%rsi
+  80062a:	44 89 e7             	mov    %r12d,%edi
+  80062d:	41 ff d6             	call   *%r14
+  800630:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800634:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800637:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80063a:	75 eb                	jne    800627 <vprintfmt+0x2bf>
+  80063c:	e9 72 ff ff ff       	jmp    8005b3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800641:	0f b6 f8             	movzbl %al,%edi
+  800644:	4c 89 ee             	mov    %r13,%rsi
+  800647:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80064a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80064e:	49 83 c4 01          	add    $0x1,%r12
+  800652:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800658:	84 c0                	test   %al,%al
+  80065a:	0f 84 66 ff ff ff    	je     8005c6 <vprintfmt+0x25e>
+  800660:	45 85 ff             	test   %r15d,%r15d
+  800663:	78 0a                	js     80066f <vprintfmt+0x307>
+  800665:	41 83 ef 01          	sub    $0x1,%r15d
+  800669:	0f 88 57 ff ff ff    	js     8005c6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80066f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800673:	74 cc                	je     800641 <vprintfmt+0x2d9>
+  800675:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800678:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80067d:	80 fa 5e             	cmp    $0x5e,%dl
+  800680:	77 c2                	ja     800644 <vprintfmt+0x2dc>
+  800682:	eb bd                	jmp    800641 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800684:	40 84 f6             	test   %sil,%sil
+  800687:	75 26                	jne    8006af <vprintfmt+0x347>
+    switch (lflag) {
+  800689:	85 d2                	test   %edx,%edx
+  80068b:	74 59                	je     8006e6 <vprintfmt+0x37e>
+  80068d:	83 fa 01             	cmp    $0x1,%edx
+  800690:	74 7b                	je     80070d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800692:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800695:	83 f8 2f             	cmp    $0x2f,%eax
+  800698:	0f 87 96 00 00 00    	ja     800734 <vprintfmt+0x3cc>
+  80069e:	89 c2                	mov    %eax,%edx
+  8006a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006a4:	83 c0 08             	add    $0x8,%eax
+  8006a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006aa:	4c 8b 22             	mov    (%rdx),%r12
+  8006ad:	eb 17                	jmp    8006c6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8006af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b5:	77 21                	ja     8006d8 <vprintfmt+0x370>
+  8006b7:	89 c2                	mov    %eax,%edx
+  8006b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bd:	83 c0 08             	add    $0x8,%eax
+  8006c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006c6:	4d 85 e4             	test   %r12,%r12
+  8006c9:	78 7a                	js     800745 <vprintfmt+0x3dd>
+            num = i;
+  8006cb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006d3:	e9 50 02 00 00       	jmp    800928 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e4:	eb dd                	jmp    8006c3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ec:	77 11                	ja     8006ff <vprintfmt+0x397>
+  8006ee:	89 c2                	mov    %eax,%edx
+  8006f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f4:	83 c0 08             	add    $0x8,%eax
+  8006f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fa:	4c 63 22             	movslq (%rdx),%r12
+  8006fd:	eb c7                	jmp    8006c6 <vprintfmt+0x35e>
+  8006ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800703:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800707:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070b:	eb ed                	jmp    8006fa <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80070d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800710:	83 f8 2f             	cmp    $0x2f,%eax
+  800713:	77 11                	ja     800726 <vprintfmt+0x3be>
+  800715:	89 c2                	mov    %eax,%edx
+  800717:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80071b:	83 c0 08             	add    $0x8,%eax
+  80071e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800721:	4c 8b 22             	mov    (%rdx),%r12
+  800724:	eb a0                	jmp    8006c6 <vprintfmt+0x35e>
+  800726:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80072a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80072e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800732:	eb ed                	jmp    800721 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800734:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800738:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80073c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800740:	e9 65 ff ff ff       	jmp    8006aa <vprintfmt+0x342>
+                putch('-', put_arg);
+  800745:	4c 89 ee             	mov    %r13,%rsi
+  800748:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80074d:	41 ff d6             	call   *%r14
+                i = -i;
+  800750:	49 f7 dc             	neg    %r12
+  800753:	e9 73 ff ff ff       	jmp    8006cb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800758:	40 84 f6             	test   %sil,%sil
+  80075b:	75 32                	jne    80078f <vprintfmt+0x427>
+    switch (lflag) {
+  80075d:	85 d2                	test   %edx,%edx
+  80075f:	74 5d                	je     8007be <vprintfmt+0x456>
+  800761:	83 fa 01             	cmp    $0x1,%edx
+  800764:	0f 84 82 00 00 00    	je     8007ec <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	0f 87 a5 00 00 00    	ja     80081b <vprintfmt+0x4b3>
+  800776:	89 c2                	mov    %eax,%edx
+  800778:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077c:	83 c0 08             	add    $0x8,%eax
+  80077f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800782:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800785:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80078a:	e9 99 01 00 00       	jmp    800928 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80078f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800792:	83 f8 2f             	cmp    $0x2f,%eax
+  800795:	77 19                	ja     8007b0 <vprintfmt+0x448>
+  800797:	89 c2                	mov    %eax,%edx
+  800799:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079d:	83 c0 08             	add    $0x8,%eax
+  8007a0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007a6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8007ab:	e9 78 01 00 00       	jmp    800928 <vprintfmt+0x5c0>
+  8007b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bc:	eb e5                	jmp    8007a3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8007be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c4:	77 18                	ja     8007de <vprintfmt+0x476>
+  8007c6:	89 c2                	mov    %eax,%edx
+  8007c8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cc:	83 c0 08             	add    $0x8,%eax
+  8007cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007d4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007d9:	e9 4a 01 00 00       	jmp    800928 <vprintfmt+0x5c0>
+  8007de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ea:	eb e6                	jmp    8007d2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f2:	77 19                	ja     80080d <vprintfmt+0x4a5>
+  8007f4:	89 c2                	mov    %eax,%edx
+  8007f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007fa:	83 c0 08             	add    $0x8,%eax
+  8007fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800800:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800803:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800808:	e9 1b 01 00 00       	jmp    800928 <vprintfmt+0x5c0>
+  80080d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800811:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800819:	eb e5                	jmp    800800 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80081b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800823:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800827:	e9 56 ff ff ff       	jmp    800782 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80082c:	40 84 f6             	test   %sil,%sil
+  80082f:	75 2e                	jne    80085f <vprintfmt+0x4f7>
+    switch (lflag) {
+  800831:	85 d2                	test   %edx,%edx
+  800833:	74 59                	je     80088e <vprintfmt+0x526>
+  800835:	83 fa 01             	cmp    $0x1,%edx
+  800838:	74 7f                	je     8008b9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	0f 87 9f 00 00 00    	ja     8008e5 <vprintfmt+0x57d>
+  800846:	89 c2                	mov    %eax,%edx
+  800848:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084c:	83 c0 08             	add    $0x8,%eax
+  80084f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800852:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800855:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80085a:	e9 c9 00 00 00       	jmp    800928 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	77 19                	ja     800880 <vprintfmt+0x518>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800873:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800876:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80087b:	e9 a8 00 00 00       	jmp    800928 <vprintfmt+0x5c0>
+  800880:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800884:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800888:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088c:	eb e5                	jmp    800873 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80088e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800891:	83 f8 2f             	cmp    $0x2f,%eax
+  800894:	77 15                	ja     8008ab <vprintfmt+0x543>
+  800896:	89 c2                	mov    %eax,%edx
+  800898:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089c:	83 c0 08             	add    $0x8,%eax
+  80089f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  8008a4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8008a9:	eb 7d                	jmp    800928 <vprintfmt+0x5c0>
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	eb e9                	jmp    8008a2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8008b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bf:	77 16                	ja     8008d7 <vprintfmt+0x56f>
+  8008c1:	89 c2                	mov    %eax,%edx
+  8008c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c7:	83 c0 08             	add    $0x8,%eax
+  8008ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008d0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008d5:	eb 51                	jmp    800928 <vprintfmt+0x5c0>
+  8008d7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008db:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e3:	eb e8                	jmp    8008cd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f1:	e9 5c ff ff ff       	jmp    800852 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008f6:	4c 89 ee             	mov    %r13,%rsi
+  8008f9:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008fe:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800901:	4c 89 ee             	mov    %r13,%rsi
+  800904:	bf 78 00 00 00       	mov    $0x78,%edi
+  800909:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  80090c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090f:	83 f8 2f             	cmp    $0x2f,%eax
+  800912:	77 47                	ja     80095b <vprintfmt+0x5f3>
+  800914:	89 c2                	mov    %eax,%edx
+  800916:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091a:	83 c0 08             	add    $0x8,%eax
+  80091d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800920:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800923:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800928:	48 83 ec 08          	sub    $0x8,%rsp
+  80092c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800930:	0f 94 c0             	sete   %al
+  800933:	0f b6 c0             	movzbl %al,%eax
+  800936:	50                   	push   %rax
+  800937:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  80093c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800940:	4c 89 ee             	mov    %r13,%rsi
+  800943:	4c 89 f7             	mov    %r14,%rdi
+  800946:	48 b8 5d 02 80 00 00 	movabs $0x80025d,%rax
+  80094d:	00 00 00 
+  800950:	ff d0                	call   *%rax
+            break;
+  800952:	48 83 c4 10          	add    $0x10,%rsp
+  800956:	e9 3e fa ff ff       	jmp    800399 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80095b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800963:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800967:	eb b7                	jmp    800920 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800969:	40 84 f6             	test   %sil,%sil
+  80096c:	75 2b                	jne    800999 <vprintfmt+0x631>
+    switch (lflag) {
+  80096e:	85 d2                	test   %edx,%edx
+  800970:	74 56                	je     8009c8 <vprintfmt+0x660>
+  800972:	83 fa 01             	cmp    $0x1,%edx
+  800975:	74 7f                	je     8009f6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800977:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80097a:	83 f8 2f             	cmp    $0x2f,%eax
+  80097d:	0f 87 a2 00 00 00    	ja     800a25 <vprintfmt+0x6bd>
+  800983:	89 c2                	mov    %eax,%edx
+  800985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800989:	83 c0 08             	add    $0x8,%eax
+  80098c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80098f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800992:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800997:	eb 8f                	jmp    800928 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099c:	83 f8 2f             	cmp    $0x2f,%eax
+  80099f:	77 19                	ja     8009ba <vprintfmt+0x652>
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a7:	83 c0 08             	add    $0x8,%eax
+  8009aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009b5:	e9 6e ff ff ff       	jmp    800928 <vprintfmt+0x5c0>
+  8009ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c6:	eb e5                	jmp    8009ad <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ce:	77 18                	ja     8009e8 <vprintfmt+0x680>
+  8009d0:	89 c2                	mov    %eax,%edx
+  8009d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d6:	83 c0 08             	add    $0x8,%eax
+  8009d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009dc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009de:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009e3:	e9 40 ff ff ff       	jmp    800928 <vprintfmt+0x5c0>
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	eb e6                	jmp    8009dc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	77 19                	ja     800a17 <vprintfmt+0x6af>
+  8009fe:	89 c2                	mov    %eax,%edx
+  800a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a04:	83 c0 08             	add    $0x8,%eax
+  800a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a12:	e9 11 ff ff ff       	jmp    800928 <vprintfmt+0x5c0>
+  800a17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a23:	eb e5                	jmp    800a0a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a31:	e9 59 ff ff ff       	jmp    80098f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a36:	4c 89 ee             	mov    %r13,%rsi
+  800a39:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a3e:	41 ff d6             	call   *%r14
+            break;
+  800a41:	e9 53 f9 ff ff       	jmp    800399 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a46:	4c 89 ee             	mov    %r13,%rsi
+  800a49:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a4e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a51:	48 83 eb 01          	sub    $0x1,%rbx
+  800a55:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a59:	75 f6                	jne    800a51 <vprintfmt+0x6e9>
+  800a5b:	e9 39 f9 ff ff       	jmp    800399 <vprintfmt+0x31>
+}
+  800a60:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a64:	5b                   	pop    %rbx
+  800a65:	41 5c                	pop    %r12
+  800a67:	41 5d                	pop    %r13
+  800a69:	41 5e                	pop    %r14
+  800a6b:	41 5f                	pop    %r15
+  800a6d:	5d                   	pop    %rbp
+  800a6e:	c3                   	ret
+
+0000000000800a6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a6f:	55                   	push   %rbp
+  800a70:	48 89 e5             	mov    %rsp,%rbp
+  800a73:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a7b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a84:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a8b:	48 85 ff             	test   %rdi,%rdi
+  800a8e:	74 2b                	je     800abb <vsnprintf+0x4c>
+  800a90:	48 85 f6             	test   %rsi,%rsi
+  800a93:	74 26                	je     800abb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a99:	48 bf 13 03 80 00 00 	movabs $0x800313,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 68 03 80 00 00 	movabs $0x800368,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800aaf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ab3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ab6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ab9:	c9                   	leave
+  800aba:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800abb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ac0:	eb f7                	jmp    800ab9 <vsnprintf+0x4a>
+
+0000000000800ac2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ac2:	55                   	push   %rbp
+  800ac3:	48 89 e5             	mov    %rsp,%rbp
+  800ac6:	48 83 ec 50          	sub    $0x50,%rsp
+  800aca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ace:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ad2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ad6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800add:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ae1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ae9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aed:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800af1:	48 b8 6f 0a 80 00 00 	movabs $0x800a6f,%rax
+  800af8:	00 00 00 
+  800afb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800afd:	c9                   	leave
+  800afe:	c3                   	ret
+
+0000000000800aff <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800aff:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b02:	74 10                	je     800b14 <strlen+0x15>
+    size_t n = 0;
+  800b04:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b09:	48 83 c0 01          	add    $0x1,%rax
+  800b0d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b11:	75 f6                	jne    800b09 <strlen+0xa>
+  800b13:	c3                   	ret
+    size_t n = 0;
+  800b14:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800b19:	c3                   	ret
+
+0000000000800b1a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800b1a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800b1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800b22:	48 85 f6             	test   %rsi,%rsi
+  800b25:	74 11                	je     800b38 <strnlen+0x1e>
+  800b27:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b2b:	74 0c                	je     800b39 <strnlen+0x1f>
+  800b2d:	48 83 c2 01          	add    $0x1,%rdx
+  800b31:	48 39 d0             	cmp    %rdx,%rax
+  800b34:	75 f1                	jne    800b27 <strnlen+0xd>
+  800b36:	eb 04                	jmp    800b3c <strnlen+0x22>
+  800b38:	c3                   	ret
+  800b39:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b3c:	c3                   	ret
+
+0000000000800b3d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b3d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b40:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b45:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b49:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b4c:	48 83 c2 01          	add    $0x1,%rdx
+  800b50:	84 c9                	test   %cl,%cl
+  800b52:	75 f1                	jne    800b45 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b54:	c3                   	ret
+
+0000000000800b55 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b55:	55                   	push   %rbp
+  800b56:	48 89 e5             	mov    %rsp,%rbp
+  800b59:	41 54                	push   %r12
+  800b5b:	53                   	push   %rbx
+  800b5c:	48 89 fb             	mov    %rdi,%rbx
+  800b5f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b62:	48 b8 ff 0a 80 00 00 	movabs $0x800aff,%rax
+  800b69:	00 00 00 
+  800b6c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b6e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b72:	4c 89 e6             	mov    %r12,%rsi
+  800b75:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  800b7c:	00 00 00 
+  800b7f:	ff d0                	call   *%rax
+    return dst;
+}
+  800b81:	48 89 d8             	mov    %rbx,%rax
+  800b84:	5b                   	pop    %rbx
+  800b85:	41 5c                	pop    %r12
+  800b87:	5d                   	pop    %rbp
+  800b88:	c3                   	ret
+
+0000000000800b89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b89:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b8c:	48 85 d2             	test   %rdx,%rdx
+  800b8f:	74 1f                	je     800bb0 <strncpy+0x27>
+  800b91:	48 01 fa             	add    %rdi,%rdx
+  800b94:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b97:	48 83 c1 01          	add    $0x1,%rcx
+  800b9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ba3:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ba7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800bab:	48 39 ca             	cmp    %rcx,%rdx
+  800bae:	75 e7                	jne    800b97 <strncpy+0xe>
+    }
+    return ret;
+}
+  800bb0:	c3                   	ret
+
+0000000000800bb1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800bb1:	48 89 f8             	mov    %rdi,%rax
+  800bb4:	48 85 d2             	test   %rdx,%rdx
+  800bb7:	74 24                	je     800bdd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800bb9:	48 83 ea 01          	sub    $0x1,%rdx
+  800bbd:	74 1b                	je     800bda <strlcpy+0x29>
+  800bbf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800bc3:	0f b6 16             	movzbl (%rsi),%edx
+  800bc6:	84 d2                	test   %dl,%dl
+  800bc8:	74 10                	je     800bda <strlcpy+0x29>
+            *dst++ = *src++;
+  800bca:	48 83 c6 01          	add    $0x1,%rsi
+  800bce:	48 83 c0 01          	add    $0x1,%rax
+  800bd2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bd5:	48 39 c8             	cmp    %rcx,%rax
+  800bd8:	75 e9                	jne    800bc3 <strlcpy+0x12>
+        *dst = '\0';
+  800bda:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bdd:	48 29 f8             	sub    %rdi,%rax
+}
+  800be0:	c3                   	ret
+
+0000000000800be1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800be1:	0f b6 07             	movzbl (%rdi),%eax
+  800be4:	84 c0                	test   %al,%al
+  800be6:	74 13                	je     800bfb <strcmp+0x1a>
+  800be8:	38 06                	cmp    %al,(%rsi)
+  800bea:	75 0f                	jne    800bfb <strcmp+0x1a>
+  800bec:	48 83 c7 01          	add    $0x1,%rdi
+  800bf0:	48 83 c6 01          	add    $0x1,%rsi
+  800bf4:	0f b6 07             	movzbl (%rdi),%eax
+  800bf7:	84 c0                	test   %al,%al
+  800bf9:	75 ed                	jne    800be8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bfb:	0f b6 c0             	movzbl %al,%eax
+  800bfe:	0f b6 16             	movzbl (%rsi),%edx
+  800c01:	29 d0                	sub    %edx,%eax
+}
+  800c03:	c3                   	ret
+
+0000000000800c04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c04:	48 85 d2             	test   %rdx,%rdx
+  800c07:	74 1f                	je     800c28 <strncmp+0x24>
+  800c09:	0f b6 07             	movzbl (%rdi),%eax
+  800c0c:	84 c0                	test   %al,%al
+  800c0e:	74 1e                	je     800c2e <strncmp+0x2a>
+  800c10:	3a 06                	cmp    (%rsi),%al
+  800c12:	75 1a                	jne    800c2e <strncmp+0x2a>
+  800c14:	48 83 c7 01          	add    $0x1,%rdi
+  800c18:	48 83 c6 01          	add    $0x1,%rsi
+  800c1c:	48 83 ea 01          	sub    $0x1,%rdx
+  800c20:	75 e7                	jne    800c09 <strncmp+0x5>
+
+    if (!n) return 0;
+  800c22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c27:	c3                   	ret
+  800c28:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c2d:	c3                   	ret
+  800c2e:	48 85 d2             	test   %rdx,%rdx
+  800c31:	74 09                	je     800c3c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c33:	0f b6 07             	movzbl (%rdi),%eax
+  800c36:	0f b6 16             	movzbl (%rsi),%edx
+  800c39:	29 d0                	sub    %edx,%eax
+  800c3b:	c3                   	ret
+    if (!n) return 0;
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c41:	c3                   	ret
+
+0000000000800c42 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c42:	0f b6 17             	movzbl (%rdi),%edx
+  800c45:	84 d2                	test   %dl,%dl
+  800c47:	74 18                	je     800c61 <strchr+0x1f>
+        if (*str == c) {
+  800c49:	0f be d2             	movsbl %dl,%edx
+  800c4c:	39 f2                	cmp    %esi,%edx
+  800c4e:	74 17                	je     800c67 <strchr+0x25>
+    for (; *str; str++) {
+  800c50:	48 83 c7 01          	add    $0x1,%rdi
+  800c54:	0f b6 17             	movzbl (%rdi),%edx
+  800c57:	84 d2                	test   %dl,%dl
+  800c59:	75 ee                	jne    800c49 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c60:	c3                   	ret
+  800c61:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c66:	c3                   	ret
+  800c67:	48 89 f8             	mov    %rdi,%rax
+}
+  800c6a:	c3                   	ret
+
+0000000000800c6b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c6b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c6e:	0f b6 17             	movzbl (%rdi),%edx
+  800c71:	84 d2                	test   %dl,%dl
+  800c73:	74 13                	je     800c88 <strfind+0x1d>
+  800c75:	0f be d2             	movsbl %dl,%edx
+  800c78:	39 f2                	cmp    %esi,%edx
+  800c7a:	74 0b                	je     800c87 <strfind+0x1c>
+  800c7c:	48 83 c0 01          	add    $0x1,%rax
+  800c80:	0f b6 10             	movzbl (%rax),%edx
+  800c83:	84 d2                	test   %dl,%dl
+  800c85:	75 ee                	jne    800c75 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c87:	c3                   	ret
+  800c88:	c3                   	ret
+
+0000000000800c89 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c89:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c8c:	48 89 f8             	mov    %rdi,%rax
+  800c8f:	48 f7 d8             	neg    %rax
+  800c92:	83 e0 07             	and    $0x7,%eax
+  800c95:	49 89 d1             	mov    %rdx,%r9
+  800c98:	49 29 c1             	sub    %rax,%r9
+  800c9b:	78 36                	js     800cd3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c9d:	40 0f b6 c6          	movzbl %sil,%eax
+  800ca1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ca8:	01 01 01 
+  800cab:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800caf:	40 f6 c7 07          	test   $0x7,%dil
+  800cb3:	75 38                	jne    800ced <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800cb5:	4c 89 c9             	mov    %r9,%rcx
+  800cb8:	48 c1 f9 03          	sar    $0x3,%rcx
+  800cbc:	74 0c                	je     800cca <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800cbe:	fc                   	cld
+  800cbf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800cc2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800cc6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800cca:	4d 85 c9             	test   %r9,%r9
+  800ccd:	75 45                	jne    800d14 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ccf:	4c 89 c0             	mov    %r8,%rax
+  800cd2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cd3:	48 85 d2             	test   %rdx,%rdx
+  800cd6:	74 f7                	je     800ccf <memset+0x46>
+  800cd8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cdb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cde:	48 83 c0 01          	add    $0x1,%rax
+  800ce2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ce6:	48 39 c2             	cmp    %rax,%rdx
+  800ce9:	75 f3                	jne    800cde <memset+0x55>
+  800ceb:	eb e2                	jmp    800ccf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ced:	40 f6 c7 01          	test   $0x1,%dil
+  800cf1:	74 06                	je     800cf9 <memset+0x70>
+  800cf3:	88 07                	mov    %al,(%rdi)
+  800cf5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cf9:	40 f6 c7 02          	test   $0x2,%dil
+  800cfd:	74 07                	je     800d06 <memset+0x7d>
+  800cff:	66 89 07             	mov    %ax,(%rdi)
+  800d02:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d06:	40 f6 c7 04          	test   $0x4,%dil
+  800d0a:	74 a9                	je     800cb5 <memset+0x2c>
+  800d0c:	89 07                	mov    %eax,(%rdi)
+  800d0e:	48 83 c7 04          	add    $0x4,%rdi
+  800d12:	eb a1                	jmp    800cb5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d14:	41 f6 c1 04          	test   $0x4,%r9b
+  800d18:	74 06                	je     800d20 <memset+0x97>
+  800d1a:	89 07                	mov    %eax,(%rdi)
+  800d1c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d20:	41 f6 c1 02          	test   $0x2,%r9b
+  800d24:	74 07                	je     800d2d <memset+0xa4>
+  800d26:	66 89 07             	mov    %ax,(%rdi)
+  800d29:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d2d:	41 f6 c1 01          	test   $0x1,%r9b
+  800d31:	74 9c                	je     800ccf <memset+0x46>
+  800d33:	88 07                	mov    %al,(%rdi)
+  800d35:	eb 98                	jmp    800ccf <memset+0x46>
+
+0000000000800d37 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d37:	48 89 f8             	mov    %rdi,%rax
+  800d3a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d3d:	48 39 fe             	cmp    %rdi,%rsi
+  800d40:	73 3b                	jae    800d7d <memmove+0x46>
+  800d42:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d46:	48 39 d7             	cmp    %rdx,%rdi
+  800d49:	73 32                	jae    800d7d <memmove+0x46>
+        s += n;
+        d += n;
+  800d4b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d4f:	48 89 d6             	mov    %rdx,%rsi
+  800d52:	48 09 fe             	or     %rdi,%rsi
+  800d55:	48 09 ce             	or     %rcx,%rsi
+  800d58:	40 f6 c6 07          	test   $0x7,%sil
+  800d5c:	75 12                	jne    800d70 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d5e:	48 83 ef 08          	sub    $0x8,%rdi
+  800d62:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d66:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d6a:	fd                   	std
+  800d6b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d6e:	fc                   	cld
+  800d6f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d70:	48 83 ef 01          	sub    $0x1,%rdi
+  800d74:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d78:	fd                   	std
+  800d79:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d7b:	eb f1                	jmp    800d6e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d7d:	48 89 f2             	mov    %rsi,%rdx
+  800d80:	48 09 c2             	or     %rax,%rdx
+  800d83:	48 09 ca             	or     %rcx,%rdx
+  800d86:	f6 c2 07             	test   $0x7,%dl
+  800d89:	75 0c                	jne    800d97 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d8b:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d8f:	48 89 c7             	mov    %rax,%rdi
+  800d92:	fc                   	cld
+  800d93:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d96:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d97:	48 89 c7             	mov    %rax,%rdi
+  800d9a:	fc                   	cld
+  800d9b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d9d:	c3                   	ret
+
+0000000000800d9e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d9e:	55                   	push   %rbp
+  800d9f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800da2:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  800da9:	00 00 00 
+  800dac:	ff d0                	call   *%rax
+}
+  800dae:	5d                   	pop    %rbp
+  800daf:	c3                   	ret
+
+0000000000800db0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800db0:	55                   	push   %rbp
+  800db1:	48 89 e5             	mov    %rsp,%rbp
+  800db4:	41 57                	push   %r15
+  800db6:	41 56                	push   %r14
+  800db8:	41 55                	push   %r13
+  800dba:	41 54                	push   %r12
+  800dbc:	53                   	push   %rbx
+  800dbd:	48 83 ec 08          	sub    $0x8,%rsp
+  800dc1:	49 89 fe             	mov    %rdi,%r14
+  800dc4:	49 89 f7             	mov    %rsi,%r15
+  800dc7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800dca:	48 89 f7             	mov    %rsi,%rdi
+  800dcd:	48 b8 ff 0a 80 00 00 	movabs $0x800aff,%rax
+  800dd4:	00 00 00 
+  800dd7:	ff d0                	call   *%rax
+  800dd9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ddc:	48 89 de             	mov    %rbx,%rsi
+  800ddf:	4c 89 f7             	mov    %r14,%rdi
+  800de2:	48 b8 1a 0b 80 00 00 	movabs $0x800b1a,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+  800dee:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800df1:	48 39 c3             	cmp    %rax,%rbx
+  800df4:	74 36                	je     800e2c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800df6:	48 89 d8             	mov    %rbx,%rax
+  800df9:	4c 29 e8             	sub    %r13,%rax
+  800dfc:	49 39 c4             	cmp    %rax,%r12
+  800dff:	73 31                	jae    800e32 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e01:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e06:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e0a:	4c 89 fe             	mov    %r15,%rsi
+  800e0d:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  800e14:	00 00 00 
+  800e17:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800e19:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800e1d:	48 83 c4 08          	add    $0x8,%rsp
+  800e21:	5b                   	pop    %rbx
+  800e22:	41 5c                	pop    %r12
+  800e24:	41 5d                	pop    %r13
+  800e26:	41 5e                	pop    %r14
+  800e28:	41 5f                	pop    %r15
+  800e2a:	5d                   	pop    %rbp
+  800e2b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e2c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e30:	eb eb                	jmp    800e1d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e32:	48 83 eb 01          	sub    $0x1,%rbx
+  800e36:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e3a:	48 89 da             	mov    %rbx,%rdx
+  800e3d:	4c 89 fe             	mov    %r15,%rsi
+  800e40:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  800e47:	00 00 00 
+  800e4a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e4c:	49 01 de             	add    %rbx,%r14
+  800e4f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e54:	eb c3                	jmp    800e19 <strlcat+0x69>
+
+0000000000800e56 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e56:	48 85 d2             	test   %rdx,%rdx
+  800e59:	74 2d                	je     800e88 <memcmp+0x32>
+  800e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e60:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e64:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e69:	44 38 c1             	cmp    %r8b,%cl
+  800e6c:	75 0f                	jne    800e7d <memcmp+0x27>
+    while (n-- > 0) {
+  800e6e:	48 83 c0 01          	add    $0x1,%rax
+  800e72:	48 39 c2             	cmp    %rax,%rdx
+  800e75:	75 e9                	jne    800e60 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e77:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e7c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e7d:	0f b6 c1             	movzbl %cl,%eax
+  800e80:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e84:	44 29 c0             	sub    %r8d,%eax
+  800e87:	c3                   	ret
+    return 0;
+  800e88:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e8d:	c3                   	ret
+
+0000000000800e8e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e8e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e92:	48 39 c7             	cmp    %rax,%rdi
+  800e95:	73 0f                	jae    800ea6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e97:	40 38 37             	cmp    %sil,(%rdi)
+  800e9a:	74 0e                	je     800eaa <memfind+0x1c>
+    for (; src < end; src++) {
+  800e9c:	48 83 c7 01          	add    $0x1,%rdi
+  800ea0:	48 39 f8             	cmp    %rdi,%rax
+  800ea3:	75 f2                	jne    800e97 <memfind+0x9>
+  800ea5:	c3                   	ret
+  800ea6:	48 89 f8             	mov    %rdi,%rax
+  800ea9:	c3                   	ret
+  800eaa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800ead:	c3                   	ret
+
+0000000000800eae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800eae:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800eb1:	0f b6 37             	movzbl (%rdi),%esi
+  800eb4:	40 80 fe 20          	cmp    $0x20,%sil
+  800eb8:	74 06                	je     800ec0 <strtol+0x12>
+  800eba:	40 80 fe 09          	cmp    $0x9,%sil
+  800ebe:	75 13                	jne    800ed3 <strtol+0x25>
+  800ec0:	48 83 c7 01          	add    $0x1,%rdi
+  800ec4:	0f b6 37             	movzbl (%rdi),%esi
+  800ec7:	40 80 fe 20          	cmp    $0x20,%sil
+  800ecb:	74 f3                	je     800ec0 <strtol+0x12>
+  800ecd:	40 80 fe 09          	cmp    $0x9,%sil
+  800ed1:	74 ed                	je     800ec0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800ed3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800ed6:	83 e0 fd             	and    $0xfffffffd,%eax
+  800ed9:	3c 01                	cmp    $0x1,%al
+  800edb:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800edf:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ee5:	75 0f                	jne    800ef6 <strtol+0x48>
+  800ee7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800eea:	74 14                	je     800f00 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800eec:	85 d2                	test   %edx,%edx
+  800eee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ef3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800efb:	4c 63 ca             	movslq %edx,%r9
+  800efe:	eb 36                	jmp    800f36 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f00:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f04:	74 0f                	je     800f15 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f06:	85 d2                	test   %edx,%edx
+  800f08:	75 ec                	jne    800ef6 <strtol+0x48>
+        s++;
+  800f0a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f0e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800f13:	eb e1                	jmp    800ef6 <strtol+0x48>
+        s += 2;
+  800f15:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800f19:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800f1e:	eb d6                	jmp    800ef6 <strtol+0x48>
+            dig -= '0';
+  800f20:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800f23:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f27:	41 39 d0             	cmp    %edx,%r8d
+  800f2a:	7d 21                	jge    800f4d <strtol+0x9f>
+        val = val * base + dig;
+  800f2c:	49 0f af c1          	imul   %r9,%rax
+  800f30:	0f b6 c9             	movzbl %cl,%ecx
+  800f33:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f36:	48 83 c7 01          	add    $0x1,%rdi
+  800f3a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f3e:	80 f9 39             	cmp    $0x39,%cl
+  800f41:	76 dd                	jbe    800f20 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f43:	80 f9 7b             	cmp    $0x7b,%cl
+  800f46:	77 05                	ja     800f4d <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f48:	83 e9 57             	sub    $0x57,%ecx
+  800f4b:	eb d6                	jmp    800f23 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f4d:	4d 85 d2             	test   %r10,%r10
+  800f50:	74 03                	je     800f55 <strtol+0xa7>
+  800f52:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f55:	48 89 c2             	mov    %rax,%rdx
+  800f58:	48 f7 da             	neg    %rdx
+  800f5b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f5f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f63:	c3                   	ret
+
+0000000000800f64 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f64:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f69:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f6e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f74:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f7a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f80:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f82:	c3                   	ret
+
+0000000000800f83 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f83:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f88:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f8d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f92:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f97:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f9d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fa3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800fa9:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fab:	c3                   	ret
+
+0000000000800fac <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800fac:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800faf:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fb4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fb9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fbe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800fd0:	0f 05                	syscall
+    if (check && ret > 0) {
+  800fd2:	48 85 c0             	test   %rax,%rax
+  800fd5:	7f 01                	jg     800fd8 <sys_env_destroy+0x2c>
+}
+  800fd7:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800fd8:	55                   	push   %rbp
+  800fd9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fdc:	49 89 c0             	mov    %rax,%r8
+  800fdf:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fe4:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  800feb:	00 00 00 
+  800fee:	be 29 00 00 00       	mov    $0x29,%esi
+  800ff3:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  800ffa:	00 00 00 
+  800ffd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801002:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  801009:	00 00 00 
+  80100c:	41 ff d1             	call   *%r9
+
+000000000080100f <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80100f:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801014:	bf 00 00 00 00       	mov    $0x0,%edi
+  801019:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80101e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801023:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801029:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80102f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801035:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801037:	c3                   	ret
+
+0000000000801038 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801038:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80103d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801042:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801047:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801052:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801058:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80105e:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801060:	c3                   	ret
+
+0000000000801061 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801061:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801066:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80106d:	00 00 00 
+  801070:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801076:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80107c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801082:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801084:	c3                   	ret
+
+0000000000801085 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801085:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801088:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80108d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801093:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801099:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80109b:	c3                   	ret
+
+000000000080109c <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80109c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80109f:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010a4:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010b3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010b5:	48 85 c0             	test   %rax,%rax
+  8010b8:	7f 01                	jg     8010bb <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8010ba:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8010bb:	55                   	push   %rbp
+  8010bc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010bf:	49 89 c0             	mov    %rax,%r8
+  8010c2:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010c7:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  8010ce:	00 00 00 
+  8010d1:	be 29 00 00 00       	mov    $0x29,%esi
+  8010d6:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  8010dd:	00 00 00 
+  8010e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e5:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  8010ec:	00 00 00 
+  8010ef:	41 ff d1             	call   *%r9
+
+00000000008010f2 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010f2:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010f5:	48 63 d2             	movslq %edx,%rdx
+  8010f8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010fb:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801100:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801103:	0f 05                	syscall
+    if (check && ret > 0) {
+  801105:	48 85 c0             	test   %rax,%rax
+  801108:	7f 01                	jg     80110b <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80110a:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80110b:	55                   	push   %rbp
+  80110c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80110f:	49 89 c0             	mov    %rax,%r8
+  801112:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801117:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  80111e:	00 00 00 
+  801121:	be 29 00 00 00       	mov    $0x29,%esi
+  801126:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  80112d:	00 00 00 
+  801130:	b8 00 00 00 00       	mov    $0x0,%eax
+  801135:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  80113c:	00 00 00 
+  80113f:	41 ff d1             	call   *%r9
+
+0000000000801142 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801142:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801145:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80114a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801150:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801156:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80115c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80115e:	48 85 c0             	test   %rax,%rax
+  801161:	7f 01                	jg     801164 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801163:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801164:	55                   	push   %rbp
+  801165:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801168:	49 89 c0             	mov    %rax,%r8
+  80116b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801170:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  801177:	00 00 00 
+  80117a:	be 29 00 00 00       	mov    $0x29,%esi
+  80117f:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  801186:	00 00 00 
+  801189:	b8 00 00 00 00       	mov    $0x0,%eax
+  80118e:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  801195:	00 00 00 
+  801198:	41 ff d1             	call   *%r9
+
+000000000080119b <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80119b:	48 63 f6             	movslq %esi,%rsi
+  80119e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011a1:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011bf:	48 85 c0             	test   %rax,%rax
+  8011c2:	7f 01                	jg     8011c5 <sys_env_set_status+0x2a>
+}
+  8011c4:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011c9:	49 89 c0             	mov    %rax,%r8
+  8011cc:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011d1:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  8011d8:	00 00 00 
+  8011db:	be 29 00 00 00       	mov    $0x29,%esi
+  8011e0:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  8011e7:	00 00 00 
+  8011ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ef:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  8011f6:	00 00 00 
+  8011f9:	41 ff d1             	call   *%r9
+
+00000000008011fc <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011fc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011ff:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801204:	ba 00 00 00 00       	mov    $0x0,%edx
+  801209:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801215:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80121b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80121d:	48 85 c0             	test   %rax,%rax
+  801220:	7f 01                	jg     801223 <sys_env_set_trapframe+0x27>
+}
+  801222:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801223:	55                   	push   %rbp
+  801224:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801227:	49 89 c0             	mov    %rax,%r8
+  80122a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80122f:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  801236:	00 00 00 
+  801239:	be 29 00 00 00       	mov    $0x29,%esi
+  80123e:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  801245:	00 00 00 
+  801248:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124d:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  801254:	00 00 00 
+  801257:	41 ff d1             	call   *%r9
+
+000000000080125a <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80125a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80125d:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801262:	ba 00 00 00 00       	mov    $0x0,%edx
+  801267:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80126d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801273:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801279:	0f 05                	syscall
+    if (check && ret > 0) {
+  80127b:	48 85 c0             	test   %rax,%rax
+  80127e:	7f 01                	jg     801281 <sys_env_set_pgfault_upcall+0x27>
+}
+  801280:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801281:	55                   	push   %rbp
+  801282:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801285:	49 89 c0             	mov    %rax,%r8
+  801288:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80128d:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  801294:	00 00 00 
+  801297:	be 29 00 00 00       	mov    $0x29,%esi
+  80129c:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  8012a3:	00 00 00 
+  8012a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ab:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  8012b2:	00 00 00 
+  8012b5:	41 ff d1             	call   *%r9
+
+00000000008012b8 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8012b8:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8012bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012be:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c3:	4d 63 c0             	movslq %r8d,%r8
+  8012c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012cc:	0f 05                	syscall
+}
+  8012ce:	c3                   	ret
+
+00000000008012cf <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8012cf:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8012d2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012d5:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012da:	4d 63 c0             	movslq %r8d,%r8
+  8012dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e3:	0f 05                	syscall
+}
+  8012e5:	c3                   	ret
+
+00000000008012e6 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012e6:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012eb:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ee:	45 89 c0             	mov    %r8d,%r8d
+  8012f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012f7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012f9:	48 85 c0             	test   %rax,%rax
+  8012fc:	7f 01                	jg     8012ff <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012fe:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012ff:	55                   	push   %rbp
+  801300:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801303:	49 89 c0             	mov    %rax,%r8
+  801306:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80130b:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  801312:	00 00 00 
+  801315:	be 29 00 00 00       	mov    $0x29,%esi
+  80131a:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  801321:	00 00 00 
+  801324:	b8 00 00 00 00       	mov    $0x0,%eax
+  801329:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  801330:	00 00 00 
+  801333:	41 ff d1             	call   *%r9
+
+0000000000801336 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801336:	55                   	push   %rbp
+  801337:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80133a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801340:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801345:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134a:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  801351:	00 00 00 
+  801354:	ff d0                	call   *%rax
+}
+  801356:	5d                   	pop    %rbp
+  801357:	c3                   	ret
+
+0000000000801358 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801358:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80135d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801362:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801367:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801372:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801378:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80137e:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801380:	c3                   	ret
+
+0000000000801381 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801381:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801386:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80138b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801390:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801396:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80139c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a4:	48 85 c0             	test   %rax,%rax
+  8013a7:	7f 01                	jg     8013aa <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8013a9:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8013aa:	55                   	push   %rbp
+  8013ab:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ae:	49 89 c0             	mov    %rax,%r8
+  8013b1:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8013b6:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  8013bd:	00 00 00 
+  8013c0:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c5:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  8013cc:	00 00 00 
+  8013cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d4:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  8013db:	00 00 00 
+  8013de:	41 ff d1             	call   *%r9
+
+00000000008013e1 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013e1:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013eb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801401:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801407:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801409:	c3                   	ret
+
+000000000080140a <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80140a:	89 d2                	mov    %edx,%edx
+  80140c:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801413:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801419:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80141f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801425:	0f 05                	syscall
+}
+  801427:	c3                   	ret
+
+0000000000801428 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801428:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80142b:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801430:	ba 00 00 00 00       	mov    $0x0,%edx
+  801435:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801441:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801447:	0f 05                	syscall
+}
+  801449:	c3                   	ret
+
+000000000080144a <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80144a:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80144d:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801452:	ba 00 00 00 00       	mov    $0x0,%edx
+  801457:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80145d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801463:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801469:	0f 05                	syscall
+}
+  80146b:	c3                   	ret
+
+000000000080146c <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80146c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80146f:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801474:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801479:	ba 00 00 00 00       	mov    $0x0,%edx
+  80147e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801484:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80148a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801490:	0f 05                	syscall
+    if (check && ret > 0) {
+  801492:	48 85 c0             	test   %rax,%rax
+  801495:	7f 01                	jg     801498 <sys_irq_ack+0x2c>
+}
+  801497:	c3                   	ret
+sys_irq_ack(int irq) {
+  801498:	55                   	push   %rbp
+  801499:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149c:	49 89 c0             	mov    %rax,%r8
+  80149f:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8014a4:	48 ba 78 4c 80 00 00 	movabs $0x804c78,%rdx
+  8014ab:	00 00 00 
+  8014ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8014b3:	48 bf 97 4c 80 00 00 	movabs $0x804c97,%rdi
+  8014ba:	00 00 00 
+  8014bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c2:	49 b9 87 44 80 00 00 	movabs $0x804487,%r9
+  8014c9:	00 00 00 
+  8014cc:	41 ff d1             	call   *%r9
+
+00000000008014cf <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+  8014d3:	41 56                	push   %r14
+  8014d5:	41 55                	push   %r13
+  8014d7:	41 54                	push   %r12
+  8014d9:	53                   	push   %rbx
+  8014da:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8014dd:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  8014e4:	00 00 00 
+  8014e7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8014eb:	74 27                	je     801514 <_handle_vectored_pagefault+0x45>
+  8014ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8014f2:	49 bd 20 00 81 00 00 	movabs $0x810020,%r13
+  8014f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8014fc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8014ff:	4c 89 e7             	mov    %r12,%rdi
+  801502:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  801507:	84 c0                	test   %al,%al
+  801509:	75 45                	jne    801550 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80150b:	48 83 c3 01          	add    $0x1,%rbx
+  80150f:	49 3b 1e             	cmp    (%r14),%rbx
+  801512:	72 eb                	jb     8014ff <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  801514:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80151b:	00 
+  80151c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  801521:	4d 8b 04 24          	mov    (%r12),%r8
+  801525:	48 ba a8 4c 80 00 00 	movabs $0x804ca8,%rdx
+  80152c:	00 00 00 
+  80152f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  801534:	48 bf d8 4c 80 00 00 	movabs $0x804cd8,%rdi
+  80153b:	00 00 00 
+  80153e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801543:	49 ba 87 44 80 00 00 	movabs $0x804487,%r10
+  80154a:	00 00 00 
+  80154d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  801550:	5b                   	pop    %rbx
+  801551:	41 5c                	pop    %r12
+  801553:	41 5d                	pop    %r13
+  801555:	41 5e                	pop    %r14
+  801557:	5d                   	pop    %rbp
+  801558:	c3                   	ret
+
+0000000000801559 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  801559:	55                   	push   %rbp
+  80155a:	48 89 e5             	mov    %rsp,%rbp
+  80155d:	53                   	push   %rbx
+  80155e:	48 83 ec 08          	sub    $0x8,%rsp
+  801562:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  801565:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  80156c:	00 00 00 
+  80156f:	80 38 00             	cmpb   $0x0,(%rax)
+  801572:	0f 84 84 00 00 00    	je     8015fc <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801578:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  80157f:	00 00 00 
+  801582:	48 8b 10             	mov    (%rax),%rdx
+  801585:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80158a:	48 b9 20 00 81 00 00 	movabs $0x810020,%rcx
+  801591:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  801594:	48 85 d2             	test   %rdx,%rdx
+  801597:	74 19                	je     8015b2 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  801599:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80159d:	0f 84 e8 00 00 00    	je     80168b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8015a3:	48 83 c0 01          	add    $0x1,%rax
+  8015a7:	48 39 d0             	cmp    %rdx,%rax
+  8015aa:	75 ed                	jne    801599 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8015ac:	48 83 fa 08          	cmp    $0x8,%rdx
+  8015b0:	74 1c                	je     8015ce <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8015b2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8015b6:	48 a3 68 00 81 00 00 	movabs %rax,0x810068
+  8015bd:	00 00 00 
+  8015c0:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  8015c7:	00 00 00 
+  8015ca:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8015ce:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  8015d5:	00 00 00 
+  8015d8:	ff d0                	call   *%rax
+  8015da:	89 c7                	mov    %eax,%edi
+  8015dc:	48 be 51 17 80 00 00 	movabs $0x801751,%rsi
+  8015e3:	00 00 00 
+  8015e6:	48 b8 5a 12 80 00 00 	movabs $0x80125a,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8015f2:	85 c0                	test   %eax,%eax
+  8015f4:	78 68                	js     80165e <add_pgfault_handler+0x105>
+    return res;
+}
+  8015f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8015fa:	c9                   	leave
+  8015fb:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8015fc:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  801603:	00 00 00 
+  801606:	ff d0                	call   *%rax
+  801608:	89 c7                	mov    %eax,%edi
+  80160a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80160f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801614:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80161b:	00 00 00 
+  80161e:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  801625:	00 00 00 
+  801628:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80162a:	48 ba 68 00 81 00 00 	movabs $0x810068,%rdx
+  801631:	00 00 00 
+  801634:	48 8b 02             	mov    (%rdx),%rax
+  801637:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80163b:	48 89 0a             	mov    %rcx,(%rdx)
+  80163e:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  801645:	00 00 00 
+  801648:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80164c:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  801653:	00 00 00 
+  801656:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  801659:	e9 70 ff ff ff       	jmp    8015ce <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80165e:	89 c1                	mov    %eax,%ecx
+  801660:	48 ba e6 4c 80 00 00 	movabs $0x804ce6,%rdx
+  801667:	00 00 00 
+  80166a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80166f:	48 bf d8 4c 80 00 00 	movabs $0x804cd8,%rdi
+  801676:	00 00 00 
+  801679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80167e:	49 b8 87 44 80 00 00 	movabs $0x804487,%r8
+  801685:	00 00 00 
+  801688:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	e9 61 ff ff ff       	jmp    8015f6 <add_pgfault_handler+0x9d>
+
+0000000000801695 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  801695:	55                   	push   %rbp
+  801696:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  801699:	48 b8 60 00 81 00 00 	movabs $0x810060,%rax
+  8016a0:	00 00 00 
+  8016a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8016a6:	74 33                	je     8016db <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8016a8:	48 a1 68 00 81 00 00 	movabs 0x810068,%rax
+  8016af:	00 00 00 
+  8016b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8016b7:	48 ba 20 00 81 00 00 	movabs $0x810020,%rdx
+  8016be:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8016c1:	48 85 c0             	test   %rax,%rax
+  8016c4:	0f 84 85 00 00 00    	je     80174f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8016ca:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8016ce:	74 40                	je     801710 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8016d0:	48 83 c1 01          	add    $0x1,%rcx
+  8016d4:	48 39 c1             	cmp    %rax,%rcx
+  8016d7:	75 f1                	jne    8016ca <remove_pgfault_handler+0x35>
+  8016d9:	eb 74                	jmp    80174f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8016db:	48 b9 fe 4c 80 00 00 	movabs $0x804cfe,%rcx
+  8016e2:	00 00 00 
+  8016e5:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  8016ec:	00 00 00 
+  8016ef:	be 43 00 00 00       	mov    $0x43,%esi
+  8016f4:	48 bf d8 4c 80 00 00 	movabs $0x804cd8,%rdi
+  8016fb:	00 00 00 
+  8016fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  801703:	49 b8 87 44 80 00 00 	movabs $0x804487,%r8
+  80170a:	00 00 00 
+  80170d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  801710:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  801717:	00 
+  801718:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80171c:	48 29 ca             	sub    %rcx,%rdx
+  80171f:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801726:	00 00 00 
+  801729:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80172d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  801732:	48 89 ce             	mov    %rcx,%rsi
+  801735:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  801741:	48 b8 68 00 81 00 00 	movabs $0x810068,%rax
+  801748:	00 00 00 
+  80174b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80174f:	5d                   	pop    %rbp
+  801750:	c3                   	ret
+
+0000000000801751 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  801751:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  801754:	48 b8 cf 14 80 00 00 	movabs $0x8014cf,%rax
+  80175b:	00 00 00 
+    call *%rax
+  80175e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  801760:	41 5f                	pop    %r15
+	popq %r15
+  801762:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  801764:	41 5f                	pop    %r15
+	popq %r14
+  801766:	41 5e                	pop    %r14
+	popq %r13
+  801768:	41 5d                	pop    %r13
+	popq %r12
+  80176a:	41 5c                	pop    %r12
+	popq %r11
+  80176c:	41 5b                	pop    %r11
+	popq %r10
+  80176e:	41 5a                	pop    %r10
+	popq %r9
+  801770:	41 59                	pop    %r9
+	popq %r8
+  801772:	41 58                	pop    %r8
+	popq %rsi
+  801774:	5e                   	pop    %rsi
+	popq %rdi
+  801775:	5f                   	pop    %rdi
+	popq %rbp
+  801776:	5d                   	pop    %rbp
+	popq %rdx
+  801777:	5a                   	pop    %rdx
+	popq %rcx
+  801778:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  801779:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80177e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  801783:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  801787:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80178a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80178f:	5b                   	pop    %rbx
+	popq %rax
+  801790:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  801791:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  801795:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  801796:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80179b:	c3                   	ret
+
+000000000080179c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80179c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017a3:	ff ff ff 
+  8017a6:	48 01 f8             	add    %rdi,%rax
+  8017a9:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017ad:	c3                   	ret
+
+00000000008017ae <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017ae:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017b5:	ff ff ff 
+  8017b8:	48 01 f8             	add    %rdi,%rax
+  8017bb:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017bf:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017c5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017c9:	c3                   	ret
+
+00000000008017ca <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8017ca:	55                   	push   %rbp
+  8017cb:	48 89 e5             	mov    %rsp,%rbp
+  8017ce:	41 57                	push   %r15
+  8017d0:	41 56                	push   %r14
+  8017d2:	41 55                	push   %r13
+  8017d4:	41 54                	push   %r12
+  8017d6:	53                   	push   %rbx
+  8017d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8017db:	49 89 ff             	mov    %rdi,%r15
+  8017de:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8017e3:	49 bd 59 3f 80 00 00 	movabs $0x803f59,%r13
+  8017ea:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8017ed:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8017f3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8017f6:	48 89 df             	mov    %rbx,%rdi
+  8017f9:	41 ff d5             	call   *%r13
+  8017fc:	83 e0 04             	and    $0x4,%eax
+  8017ff:	74 17                	je     801818 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801801:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801808:	4c 39 f3             	cmp    %r14,%rbx
+  80180b:	75 e6                	jne    8017f3 <fd_alloc+0x29>
+  80180d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801813:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801818:	4d 89 27             	mov    %r12,(%r15)
+}
+  80181b:	48 83 c4 08          	add    $0x8,%rsp
+  80181f:	5b                   	pop    %rbx
+  801820:	41 5c                	pop    %r12
+  801822:	41 5d                	pop    %r13
+  801824:	41 5e                	pop    %r14
+  801826:	41 5f                	pop    %r15
+  801828:	5d                   	pop    %rbp
+  801829:	c3                   	ret
+
+000000000080182a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80182a:	83 ff 1f             	cmp    $0x1f,%edi
+  80182d:	77 39                	ja     801868 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80182f:	55                   	push   %rbp
+  801830:	48 89 e5             	mov    %rsp,%rbp
+  801833:	41 54                	push   %r12
+  801835:	53                   	push   %rbx
+  801836:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801839:	48 63 df             	movslq %edi,%rbx
+  80183c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801843:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801847:	48 89 df             	mov    %rbx,%rdi
+  80184a:	48 b8 59 3f 80 00 00 	movabs $0x803f59,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+  801856:	a8 04                	test   $0x4,%al
+  801858:	74 14                	je     80186e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80185a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80185e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801863:	5b                   	pop    %rbx
+  801864:	41 5c                	pop    %r12
+  801866:	5d                   	pop    %rbp
+  801867:	c3                   	ret
+        return -E_INVAL;
+  801868:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80186d:	c3                   	ret
+        return -E_INVAL;
+  80186e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801873:	eb ee                	jmp    801863 <fd_lookup+0x39>
+
+0000000000801875 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801875:	55                   	push   %rbp
+  801876:	48 89 e5             	mov    %rsp,%rbp
+  801879:	41 54                	push   %r12
+  80187b:	53                   	push   %rbx
+  80187c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80187f:	48 b8 c0 4d 80 00 00 	movabs $0x804dc0,%rax
+  801886:	00 00 00 
+  801889:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801890:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801893:	39 3b                	cmp    %edi,(%rbx)
+  801895:	74 47                	je     8018de <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801897:	48 83 c0 08          	add    $0x8,%rax
+  80189b:	48 8b 18             	mov    (%rax),%rbx
+  80189e:	48 85 db             	test   %rbx,%rbx
+  8018a1:	75 f0                	jne    801893 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018a3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018aa:	00 00 00 
+  8018ad:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018b3:	89 fa                	mov    %edi,%edx
+  8018b5:	48 bf 30 4d 80 00 00 	movabs $0x804d30,%rdi
+  8018bc:	00 00 00 
+  8018bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018c4:	48 b9 18 02 80 00 00 	movabs $0x800218,%rcx
+  8018cb:	00 00 00 
+  8018ce:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018d0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018d5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018d9:	5b                   	pop    %rbx
+  8018da:	41 5c                	pop    %r12
+  8018dc:	5d                   	pop    %rbp
+  8018dd:	c3                   	ret
+            return 0;
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	eb f0                	jmp    8018d5 <dev_lookup+0x60>
+
+00000000008018e5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8018e5:	55                   	push   %rbp
+  8018e6:	48 89 e5             	mov    %rsp,%rbp
+  8018e9:	41 55                	push   %r13
+  8018eb:	41 54                	push   %r12
+  8018ed:	53                   	push   %rbx
+  8018ee:	48 83 ec 18          	sub    $0x18,%rsp
+  8018f2:	48 89 fb             	mov    %rdi,%rbx
+  8018f5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018f8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8018ff:	ff ff ff 
+  801902:	48 01 df             	add    %rbx,%rdi
+  801905:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801909:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80190d:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+  801919:	41 89 c5             	mov    %eax,%r13d
+  80191c:	85 c0                	test   %eax,%eax
+  80191e:	78 06                	js     801926 <fd_close+0x41>
+  801920:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801924:	74 1a                	je     801940 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801926:	45 84 e4             	test   %r12b,%r12b
+  801929:	b8 00 00 00 00       	mov    $0x0,%eax
+  80192e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801932:	44 89 e8             	mov    %r13d,%eax
+  801935:	48 83 c4 18          	add    $0x18,%rsp
+  801939:	5b                   	pop    %rbx
+  80193a:	41 5c                	pop    %r12
+  80193c:	41 5d                	pop    %r13
+  80193e:	5d                   	pop    %rbp
+  80193f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801940:	8b 3b                	mov    (%rbx),%edi
+  801942:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801946:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  80194d:	00 00 00 
+  801950:	ff d0                	call   *%rax
+  801952:	41 89 c5             	mov    %eax,%r13d
+  801955:	85 c0                	test   %eax,%eax
+  801957:	78 1b                	js     801974 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801959:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80195d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801961:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801967:	48 85 c0             	test   %rax,%rax
+  80196a:	74 08                	je     801974 <fd_close+0x8f>
+  80196c:	48 89 df             	mov    %rbx,%rdi
+  80196f:	ff d0                	call   *%rax
+  801971:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801974:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801979:	48 89 de             	mov    %rbx,%rsi
+  80197c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801981:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  801988:	00 00 00 
+  80198b:	ff d0                	call   *%rax
+    return res;
+  80198d:	eb a3                	jmp    801932 <fd_close+0x4d>
+
+000000000080198f <close>:
+
+int
+close(int fdnum) {
+  80198f:	55                   	push   %rbp
+  801990:	48 89 e5             	mov    %rsp,%rbp
+  801993:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801997:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80199b:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019a7:	85 c0                	test   %eax,%eax
+  8019a9:	78 15                	js     8019c0 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8019b0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019b4:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  8019bb:	00 00 00 
+  8019be:	ff d0                	call   *%rax
+}
+  8019c0:	c9                   	leave
+  8019c1:	c3                   	ret
+
+00000000008019c2 <close_all>:
+
+void
+close_all(void) {
+  8019c2:	55                   	push   %rbp
+  8019c3:	48 89 e5             	mov    %rsp,%rbp
+  8019c6:	41 54                	push   %r12
+  8019c8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019ce:	49 bc 8f 19 80 00 00 	movabs $0x80198f,%r12
+  8019d5:	00 00 00 
+  8019d8:	89 df                	mov    %ebx,%edi
+  8019da:	41 ff d4             	call   *%r12
+  8019dd:	83 c3 01             	add    $0x1,%ebx
+  8019e0:	83 fb 20             	cmp    $0x20,%ebx
+  8019e3:	75 f3                	jne    8019d8 <close_all+0x16>
+}
+  8019e5:	5b                   	pop    %rbx
+  8019e6:	41 5c                	pop    %r12
+  8019e8:	5d                   	pop    %rbp
+  8019e9:	c3                   	ret
+
+00000000008019ea <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8019ea:	55                   	push   %rbp
+  8019eb:	48 89 e5             	mov    %rsp,%rbp
+  8019ee:	41 57                	push   %r15
+  8019f0:	41 56                	push   %r14
+  8019f2:	41 55                	push   %r13
+  8019f4:	41 54                	push   %r12
+  8019f6:	53                   	push   %rbx
+  8019f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8019fb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8019fe:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a02:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801a09:	00 00 00 
+  801a0c:	ff d0                	call   *%rax
+  801a0e:	89 c3                	mov    %eax,%ebx
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	0f 88 b8 00 00 00    	js     801ad0 <dup+0xe6>
+    close(newfdnum);
+  801a18:	44 89 e7             	mov    %r12d,%edi
+  801a1b:	48 b8 8f 19 80 00 00 	movabs $0x80198f,%rax
+  801a22:	00 00 00 
+  801a25:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a27:	4d 63 ec             	movslq %r12d,%r13
+  801a2a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a31:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a35:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a39:	4c 89 ff             	mov    %r15,%rdi
+  801a3c:	49 be ae 17 80 00 00 	movabs $0x8017ae,%r14
+  801a43:	00 00 00 
+  801a46:	41 ff d6             	call   *%r14
+  801a49:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a4c:	4c 89 ef             	mov    %r13,%rdi
+  801a4f:	41 ff d6             	call   *%r14
+  801a52:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a55:	48 89 df             	mov    %rbx,%rdi
+  801a58:	48 b8 59 3f 80 00 00 	movabs $0x803f59,%rax
+  801a5f:	00 00 00 
+  801a62:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a64:	a8 04                	test   $0x4,%al
+  801a66:	74 2b                	je     801a93 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a68:	41 89 c1             	mov    %eax,%r9d
+  801a6b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a71:	4c 89 f1             	mov    %r14,%rcx
+  801a74:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a79:	48 89 de             	mov    %rbx,%rsi
+  801a7c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a81:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+  801a8d:	89 c3                	mov    %eax,%ebx
+  801a8f:	85 c0                	test   %eax,%eax
+  801a91:	78 4e                	js     801ae1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a93:	4c 89 ff             	mov    %r15,%rdi
+  801a96:	48 b8 59 3f 80 00 00 	movabs $0x803f59,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+  801aa2:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801aa5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801aab:	4c 89 e9             	mov    %r13,%rcx
+  801aae:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ab3:	4c 89 fe             	mov    %r15,%rsi
+  801ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801abb:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  801ac2:	00 00 00 
+  801ac5:	ff d0                	call   *%rax
+  801ac7:	89 c3                	mov    %eax,%ebx
+  801ac9:	85 c0                	test   %eax,%eax
+  801acb:	78 14                	js     801ae1 <dup+0xf7>
+
+    return newfdnum;
+  801acd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ad0:	89 d8                	mov    %ebx,%eax
+  801ad2:	48 83 c4 18          	add    $0x18,%rsp
+  801ad6:	5b                   	pop    %rbx
+  801ad7:	41 5c                	pop    %r12
+  801ad9:	41 5d                	pop    %r13
+  801adb:	41 5e                	pop    %r14
+  801add:	41 5f                	pop    %r15
+  801adf:	5d                   	pop    %rbp
+  801ae0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ae1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ae6:	4c 89 ee             	mov    %r13,%rsi
+  801ae9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aee:	49 bc 42 11 80 00 00 	movabs $0x801142,%r12
+  801af5:	00 00 00 
+  801af8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801afb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b00:	4c 89 f6             	mov    %r14,%rsi
+  801b03:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b08:	41 ff d4             	call   *%r12
+    return res;
+  801b0b:	eb c3                	jmp    801ad0 <dup+0xe6>
+
+0000000000801b0d <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b0d:	55                   	push   %rbp
+  801b0e:	48 89 e5             	mov    %rsp,%rbp
+  801b11:	41 56                	push   %r14
+  801b13:	41 55                	push   %r13
+  801b15:	41 54                	push   %r12
+  801b17:	53                   	push   %rbx
+  801b18:	48 83 ec 10          	sub    $0x10,%rsp
+  801b1c:	89 fb                	mov    %edi,%ebx
+  801b1e:	49 89 f4             	mov    %rsi,%r12
+  801b21:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b24:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b28:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801b2f:	00 00 00 
+  801b32:	ff d0                	call   *%rax
+  801b34:	85 c0                	test   %eax,%eax
+  801b36:	78 4c                	js     801b84 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b38:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b3c:	41 8b 3e             	mov    (%r14),%edi
+  801b3f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b43:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801b4a:	00 00 00 
+  801b4d:	ff d0                	call   *%rax
+  801b4f:	85 c0                	test   %eax,%eax
+  801b51:	78 35                	js     801b88 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b53:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b57:	83 e0 03             	and    $0x3,%eax
+  801b5a:	83 f8 01             	cmp    $0x1,%eax
+  801b5d:	74 2d                	je     801b8c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b63:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b67:	48 85 c0             	test   %rax,%rax
+  801b6a:	74 56                	je     801bc2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b6c:	4c 89 ea             	mov    %r13,%rdx
+  801b6f:	4c 89 e6             	mov    %r12,%rsi
+  801b72:	4c 89 f7             	mov    %r14,%rdi
+  801b75:	ff d0                	call   *%rax
+}
+  801b77:	48 83 c4 10          	add    $0x10,%rsp
+  801b7b:	5b                   	pop    %rbx
+  801b7c:	41 5c                	pop    %r12
+  801b7e:	41 5d                	pop    %r13
+  801b80:	41 5e                	pop    %r14
+  801b82:	5d                   	pop    %rbp
+  801b83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b84:	48 98                	cltq
+  801b86:	eb ef                	jmp    801b77 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b88:	48 98                	cltq
+  801b8a:	eb eb                	jmp    801b77 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b8c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b93:	00 00 00 
+  801b96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b9c:	89 da                	mov    %ebx,%edx
+  801b9e:	48 bf 71 4d 80 00 00 	movabs $0x804d71,%rdi
+  801ba5:	00 00 00 
+  801ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bad:	48 b9 18 02 80 00 00 	movabs $0x800218,%rcx
+  801bb4:	00 00 00 
+  801bb7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bb9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bc0:	eb b5                	jmp    801b77 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801bc2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bc9:	eb ac                	jmp    801b77 <read+0x6a>
+
+0000000000801bcb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bcb:	55                   	push   %rbp
+  801bcc:	48 89 e5             	mov    %rsp,%rbp
+  801bcf:	41 57                	push   %r15
+  801bd1:	41 56                	push   %r14
+  801bd3:	41 55                	push   %r13
+  801bd5:	41 54                	push   %r12
+  801bd7:	53                   	push   %rbx
+  801bd8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801bdc:	48 85 d2             	test   %rdx,%rdx
+  801bdf:	74 54                	je     801c35 <readn+0x6a>
+  801be1:	41 89 fd             	mov    %edi,%r13d
+  801be4:	49 89 f6             	mov    %rsi,%r14
+  801be7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801bea:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801bef:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801bf4:	49 bf 0d 1b 80 00 00 	movabs $0x801b0d,%r15
+  801bfb:	00 00 00 
+  801bfe:	4c 89 e2             	mov    %r12,%rdx
+  801c01:	48 29 f2             	sub    %rsi,%rdx
+  801c04:	4c 01 f6             	add    %r14,%rsi
+  801c07:	44 89 ef             	mov    %r13d,%edi
+  801c0a:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 20                	js     801c31 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c11:	01 c3                	add    %eax,%ebx
+  801c13:	85 c0                	test   %eax,%eax
+  801c15:	74 08                	je     801c1f <readn+0x54>
+  801c17:	48 63 f3             	movslq %ebx,%rsi
+  801c1a:	4c 39 e6             	cmp    %r12,%rsi
+  801c1d:	72 df                	jb     801bfe <readn+0x33>
+    }
+    return res;
+  801c1f:	48 63 c3             	movslq %ebx,%rax
+}
+  801c22:	48 83 c4 08          	add    $0x8,%rsp
+  801c26:	5b                   	pop    %rbx
+  801c27:	41 5c                	pop    %r12
+  801c29:	41 5d                	pop    %r13
+  801c2b:	41 5e                	pop    %r14
+  801c2d:	41 5f                	pop    %r15
+  801c2f:	5d                   	pop    %rbp
+  801c30:	c3                   	ret
+        if (inc < 0) return inc;
+  801c31:	48 98                	cltq
+  801c33:	eb ed                	jmp    801c22 <readn+0x57>
+    int inc = 1, res = 0;
+  801c35:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c3a:	eb e3                	jmp    801c1f <readn+0x54>
+
+0000000000801c3c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c3c:	55                   	push   %rbp
+  801c3d:	48 89 e5             	mov    %rsp,%rbp
+  801c40:	41 56                	push   %r14
+  801c42:	41 55                	push   %r13
+  801c44:	41 54                	push   %r12
+  801c46:	53                   	push   %rbx
+  801c47:	48 83 ec 10          	sub    $0x10,%rsp
+  801c4b:	89 fb                	mov    %edi,%ebx
+  801c4d:	49 89 f4             	mov    %rsi,%r12
+  801c50:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c53:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c57:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	85 c0                	test   %eax,%eax
+  801c65:	78 47                	js     801cae <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c67:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c6b:	41 8b 3e             	mov    (%r14),%edi
+  801c6e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c72:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801c79:	00 00 00 
+  801c7c:	ff d0                	call   *%rax
+  801c7e:	85 c0                	test   %eax,%eax
+  801c80:	78 30                	js     801cb2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c82:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c87:	74 2d                	je     801cb6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c89:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c91:	48 85 c0             	test   %rax,%rax
+  801c94:	74 56                	je     801cec <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c96:	4c 89 ea             	mov    %r13,%rdx
+  801c99:	4c 89 e6             	mov    %r12,%rsi
+  801c9c:	4c 89 f7             	mov    %r14,%rdi
+  801c9f:	ff d0                	call   *%rax
+}
+  801ca1:	48 83 c4 10          	add    $0x10,%rsp
+  801ca5:	5b                   	pop    %rbx
+  801ca6:	41 5c                	pop    %r12
+  801ca8:	41 5d                	pop    %r13
+  801caa:	41 5e                	pop    %r14
+  801cac:	5d                   	pop    %rbp
+  801cad:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cae:	48 98                	cltq
+  801cb0:	eb ef                	jmp    801ca1 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb2:	48 98                	cltq
+  801cb4:	eb eb                	jmp    801ca1 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cb6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cbd:	00 00 00 
+  801cc0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cc6:	89 da                	mov    %ebx,%edx
+  801cc8:	48 bf 8d 4d 80 00 00 	movabs $0x804d8d,%rdi
+  801ccf:	00 00 00 
+  801cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd7:	48 b9 18 02 80 00 00 	movabs $0x800218,%rcx
+  801cde:	00 00 00 
+  801ce1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ce3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cea:	eb b5                	jmp    801ca1 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cec:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cf3:	eb ac                	jmp    801ca1 <write+0x65>
+
+0000000000801cf5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801cf5:	55                   	push   %rbp
+  801cf6:	48 89 e5             	mov    %rsp,%rbp
+  801cf9:	41 54                	push   %r12
+  801cfb:	53                   	push   %rbx
+  801cfc:	48 83 ec 10          	sub    $0x10,%rsp
+  801d00:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d02:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d06:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801d0d:	00 00 00 
+  801d10:	ff d0                	call   *%rax
+  801d12:	85 c0                	test   %eax,%eax
+  801d14:	78 3e                	js     801d54 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d16:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d1a:	41 8b 3c 24          	mov    (%r12),%edi
+  801d1e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d22:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801d29:	00 00 00 
+  801d2c:	ff d0                	call   *%rax
+  801d2e:	85 c0                	test   %eax,%eax
+  801d30:	78 22                	js     801d54 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801d32:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d36:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801d3a:	48 85 c0             	test   %rax,%rax
+  801d3d:	74 0b                	je     801d4a <seek+0x55>
+  801d3f:	89 de                	mov    %ebx,%esi
+  801d41:	4c 89 e7             	mov    %r12,%rdi
+  801d44:	ff d0                	call   *%rax
+  801d46:	85 c0                	test   %eax,%eax
+  801d48:	78 0a                	js     801d54 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801d4a:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801d4f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d54:	48 83 c4 10          	add    $0x10,%rsp
+  801d58:	5b                   	pop    %rbx
+  801d59:	41 5c                	pop    %r12
+  801d5b:	5d                   	pop    %rbp
+  801d5c:	c3                   	ret
+
+0000000000801d5d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d5d:	55                   	push   %rbp
+  801d5e:	48 89 e5             	mov    %rsp,%rbp
+  801d61:	41 55                	push   %r13
+  801d63:	41 54                	push   %r12
+  801d65:	53                   	push   %rbx
+  801d66:	48 83 ec 18          	sub    $0x18,%rsp
+  801d6a:	89 fb                	mov    %edi,%ebx
+  801d6c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d73:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801d7a:	00 00 00 
+  801d7d:	ff d0                	call   *%rax
+  801d7f:	85 c0                	test   %eax,%eax
+  801d81:	78 38                	js     801dbb <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d83:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d87:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d8b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d8f:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801d96:	00 00 00 
+  801d99:	ff d0                	call   *%rax
+  801d9b:	85 c0                	test   %eax,%eax
+  801d9d:	78 1c                	js     801dbb <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d9f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801da4:	74 20                	je     801dc6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801da6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801daa:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801dae:	48 85 c0             	test   %rax,%rax
+  801db1:	74 47                	je     801dfa <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801db3:	44 89 e6             	mov    %r12d,%esi
+  801db6:	4c 89 ef             	mov    %r13,%rdi
+  801db9:	ff d0                	call   *%rax
+}
+  801dbb:	48 83 c4 18          	add    $0x18,%rsp
+  801dbf:	5b                   	pop    %rbx
+  801dc0:	41 5c                	pop    %r12
+  801dc2:	41 5d                	pop    %r13
+  801dc4:	5d                   	pop    %rbp
+  801dc5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dc6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801dcd:	00 00 00 
+  801dd0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dd6:	89 da                	mov    %ebx,%edx
+  801dd8:	48 bf 50 4d 80 00 00 	movabs $0x804d50,%rdi
+  801ddf:	00 00 00 
+  801de2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801de7:	48 b9 18 02 80 00 00 	movabs $0x800218,%rcx
+  801dee:	00 00 00 
+  801df1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801df8:	eb c1                	jmp    801dbb <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dfa:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dff:	eb ba                	jmp    801dbb <ftruncate+0x5e>
+
+0000000000801e01 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e01:	55                   	push   %rbp
+  801e02:	48 89 e5             	mov    %rsp,%rbp
+  801e05:	41 54                	push   %r12
+  801e07:	53                   	push   %rbx
+  801e08:	48 83 ec 10          	sub    $0x10,%rsp
+  801e0c:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e13:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  801e1a:	00 00 00 
+  801e1d:	ff d0                	call   *%rax
+  801e1f:	85 c0                	test   %eax,%eax
+  801e21:	78 4e                	js     801e71 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e23:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e27:	41 8b 3c 24          	mov    (%r12),%edi
+  801e2b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e2f:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  801e36:	00 00 00 
+  801e39:	ff d0                	call   *%rax
+  801e3b:	85 c0                	test   %eax,%eax
+  801e3d:	78 32                	js     801e71 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e3f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e43:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e48:	74 30                	je     801e7a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e4a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e4d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e54:	00 00 00 
+    stat->st_isdir = 0;
+  801e57:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e5e:	00 00 00 
+    stat->st_dev = dev;
+  801e61:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e68:	48 89 de             	mov    %rbx,%rsi
+  801e6b:	4c 89 e7             	mov    %r12,%rdi
+  801e6e:	ff 50 28             	call   *0x28(%rax)
+}
+  801e71:	48 83 c4 10          	add    $0x10,%rsp
+  801e75:	5b                   	pop    %rbx
+  801e76:	41 5c                	pop    %r12
+  801e78:	5d                   	pop    %rbp
+  801e79:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e7a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e7f:	eb f0                	jmp    801e71 <fstat+0x70>
+
+0000000000801e81 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e81:	55                   	push   %rbp
+  801e82:	48 89 e5             	mov    %rsp,%rbp
+  801e85:	41 54                	push   %r12
+  801e87:	53                   	push   %rbx
+  801e88:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e8b:	be 00 00 00 00       	mov    $0x0,%esi
+  801e90:	48 b8 ef 2f 80 00 00 	movabs $0x802fef,%rax
+  801e97:	00 00 00 
+  801e9a:	ff d0                	call   *%rax
+  801e9c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e9e:	85 c0                	test   %eax,%eax
+  801ea0:	78 25                	js     801ec7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ea2:	4c 89 e6             	mov    %r12,%rsi
+  801ea5:	89 c7                	mov    %eax,%edi
+  801ea7:	48 b8 01 1e 80 00 00 	movabs $0x801e01,%rax
+  801eae:	00 00 00 
+  801eb1:	ff d0                	call   *%rax
+  801eb3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801eb6:	89 df                	mov    %ebx,%edi
+  801eb8:	48 b8 8f 19 80 00 00 	movabs $0x80198f,%rax
+  801ebf:	00 00 00 
+  801ec2:	ff d0                	call   *%rax
+
+    return res;
+  801ec4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801ec7:	89 d8                	mov    %ebx,%eax
+  801ec9:	5b                   	pop    %rbx
+  801eca:	41 5c                	pop    %r12
+  801ecc:	5d                   	pop    %rbp
+  801ecd:	c3                   	ret
+
+0000000000801ece <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801ece:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801ed5:	00 00 00 
+  801ed8:	83 38 00             	cmpl   $0x0,(%rax)
+  801edb:	74 0a                	je     801ee7 <fsenv+0x19>
+    return envid;
+}
+  801edd:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801ee4:	00 00 
+  801ee6:	c3                   	ret
+fsenv(void) {
+  801ee7:	55                   	push   %rbp
+  801ee8:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801eeb:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ef0:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  801ef7:	00 00 00 
+  801efa:	ff d0                	call   *%rax
+  801efc:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801f03:	00 00 
+}
+  801f05:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801f0c:	00 00 
+  801f0e:	5d                   	pop    %rbp
+  801f0f:	c3                   	ret
+
+0000000000801f10 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	41 54                	push   %r12
+  801f16:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f17:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f1c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f21:	48 89 de             	mov    %rbx,%rsi
+  801f24:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f29:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  801f30:	00 00 00 
+  801f33:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801f35:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801f3c:	00 00 00 
+  801f3f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f45:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f4a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f4f:	48 89 de             	mov    %rbx,%rsi
+  801f52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f57:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	0f 88 a2 00 00 00    	js     80200f <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801f6d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f74:	00 00 00 
+  801f77:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f7d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f82:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801f84:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801f89:	49 bc 21 41 80 00 00 	movabs $0x804121,%r12
+  801f90:	00 00 00 
+  801f93:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801f96:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801f9b:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f9e:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  801fa5:	00 00 00 
+  801fa8:	ff d0                	call   *%rax
+  801faa:	89 c7                	mov    %eax,%edi
+  801fac:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801fb2:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801fb7:	48 89 da             	mov    %rbx,%rdx
+  801fba:	be 09 00 00 00       	mov    $0x9,%esi
+  801fbf:	48 b8 3c 46 80 00 00 	movabs $0x80463c,%rax
+  801fc6:	00 00 00 
+  801fc9:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801fcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fd5:	be 00 00 00 00       	mov    $0x0,%esi
+  801fda:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fdf:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  801fe6:	00 00 00 
+  801fe9:	ff d0                	call   *%rax
+  801feb:	89 c3                	mov    %eax,%ebx
+  801fed:	85 c0                	test   %eax,%eax
+  801fef:	78 25                	js     802016 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801ff1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ff8:	00 00 00 
+  801ffb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802001:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802008:	00 00 
+    return 0;
+  80200a:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80200f:	89 d8                	mov    %ebx,%eax
+  802011:	5b                   	pop    %rbx
+  802012:	41 5c                	pop    %r12
+  802014:	5d                   	pop    %rbp
+  802015:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802016:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80201b:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802020:	bf 00 00 00 00       	mov    $0x0,%edi
+  802025:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  80202c:	00 00 00 
+  80202f:	ff d0                	call   *%rax
+        return res;
+  802031:	eb dc                	jmp    80200f <fschan_setup+0xff>
+
+0000000000802033 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802033:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80203a:	00 00 00 
+  80203d:	80 38 00             	cmpb   $0x0,(%rax)
+  802040:	74 55                	je     802097 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802042:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802049:	00 00 00 
+  80204c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802052:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802057:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  80205e:	00 00 00 
+  802061:	3b 0a                	cmp    (%rdx),%ecx
+  802063:	75 01                	jne    802066 <fschan+0x33>
+}
+  802065:	c3                   	ret
+fschan(void) {
+  802066:	55                   	push   %rbp
+  802067:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80206a:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  802071:	00 00 00 
+  802074:	ff d0                	call   *%rax
+  802076:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802078:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80207d:	85 d2                	test   %edx,%edx
+  80207f:	78 02                	js     802083 <fschan+0x50>
+}
+  802081:	5d                   	pop    %rbp
+  802082:	c3                   	ret
+        fschan_enabled = 0;
+  802083:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80208a:	00 00 00 
+  80208d:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802090:	b8 00 00 00 00       	mov    $0x0,%eax
+  802095:	eb ea                	jmp    802081 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802097:	b8 00 00 00 00       	mov    $0x0,%eax
+  80209c:	c3                   	ret
+
+000000000080209d <fbuf>:
+fbuf(struct Fd *fd) {
+  80209d:	55                   	push   %rbp
+  80209e:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8020a1:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  8020a8:	00 00 00 
+  8020ab:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8020ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020b2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8020b6:	77 12                	ja     8020ca <fbuf+0x2d>
+  8020b8:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8020bc:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8020c3:	00 00 00 
+  8020c6:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8020ca:	48 89 d0             	mov    %rdx,%rax
+  8020cd:	5d                   	pop    %rbp
+  8020ce:	c3                   	ret
+
+00000000008020cf <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8020cf:	55                   	push   %rbp
+  8020d0:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8020d3:	48 83 c7 40          	add    $0x40,%rdi
+  8020d7:	48 b8 5b 41 80 00 00 	movabs $0x80415b,%rax
+  8020de:	00 00 00 
+  8020e1:	ff d0                	call   *%rax
+  8020e3:	84 c0                	test   %al,%al
+  8020e5:	75 02                	jne    8020e9 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8020e7:	5d                   	pop    %rbp
+  8020e8:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8020e9:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8020f0:	00 00 00 
+  8020f3:	ff d0                	call   *%rax
+  8020f5:	89 c7                	mov    %eax,%edi
+  8020f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802102:	ba 00 00 00 00       	mov    $0x0,%edx
+  802107:	be 0a 00 00 00       	mov    $0xa,%esi
+  80210c:	48 b8 3c 46 80 00 00 	movabs $0x80463c,%rax
+  802113:	00 00 00 
+  802116:	ff d0                	call   *%rax
+}
+  802118:	eb cd                	jmp    8020e7 <fschan_publish+0x18>
+
+000000000080211a <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80211a:	55                   	push   %rbp
+  80211b:	48 89 e5             	mov    %rsp,%rbp
+  80211e:	41 57                	push   %r15
+  802120:	41 56                	push   %r14
+  802122:	41 55                	push   %r13
+  802124:	41 54                	push   %r12
+  802126:	53                   	push   %rbx
+  802127:	48 83 ec 48          	sub    $0x48,%rsp
+  80212b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80212f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802133:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802136:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80213a:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80213d:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802144:	00 00 00 
+  802147:	8b 02                	mov    (%rdx),%eax
+  802149:	83 c0 01             	add    $0x1,%eax
+  80214c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802151:	0f 44 c1             	cmove  %ecx,%eax
+  802154:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802156:	4d 85 c0             	test   %r8,%r8
+  802159:	74 2c                	je     802187 <fschan_rw+0x6d>
+  80215b:	45 89 ce             	mov    %r9d,%r14d
+  80215e:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802165:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802169:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80216f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802176:	00 
+  802177:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80217d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802182:	e9 41 01 00 00       	jmp    8022c8 <fschan_rw+0x1ae>
+  802187:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80218b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80218f:	e9 9c 01 00 00       	jmp    802330 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802194:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802198:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80219b:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80219e:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8021a1:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8021a5:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021a9:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8021ad:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8021b1:	48 89 da             	mov    %rbx,%rdx
+  8021b4:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  8021bb:	00 00 00 
+  8021be:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8021c0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021c4:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+            queued += blk;
+  8021d0:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8021d3:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021d7:	4d 39 fc             	cmp    %r15,%r12
+  8021da:	73 6b                	jae    802247 <fschan_rw+0x12d>
+  8021dc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8021e0:	77 65                	ja     802247 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8021e2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021e6:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8021ea:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  8021f1:	00 00 00 
+  8021f4:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8021f6:	4c 89 fb             	mov    %r15,%rbx
+  8021f9:	4c 29 e3             	sub    %r12,%rbx
+  8021fc:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802201:	48 39 d3             	cmp    %rdx,%rbx
+  802204:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802208:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80220c:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802210:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802214:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802217:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802219:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802220:	00 00 00 
+  802223:	8b 09                	mov    (%rcx),%ecx
+  802225:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802228:	83 fe 03             	cmp    $0x3,%esi
+  80222b:	0f 85 63 ff ff ff    	jne    802194 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802231:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802235:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802238:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80223b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80223e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802242:	e9 79 ff ff ff       	jmp    8021c0 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802247:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80224b:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802252:	48 89 df             	mov    %rbx,%rdi
+  802255:	48 b8 f9 41 80 00 00 	movabs $0x8041f9,%rax
+  80225c:	00 00 00 
+  80225f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802261:	48 89 df             	mov    %rbx,%rdi
+  802264:	48 b8 87 41 80 00 00 	movabs $0x804187,%rax
+  80226b:	00 00 00 
+  80226e:	ff d0                	call   *%rax
+  802270:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802274:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802278:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80227c:	75 25                	jne    8022a3 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80227e:	8b 40 04             	mov    0x4(%rax),%eax
+  802281:	85 c0                	test   %eax,%eax
+  802283:	0f 88 86 00 00 00    	js     80230f <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802289:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80228d:	74 5b                	je     8022ea <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80228f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802293:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802297:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80229b:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80229f:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8022a3:	48 89 df             	mov    %rbx,%rdi
+  8022a6:	48 b8 ae 41 80 00 00 	movabs $0x8041ae,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8022b2:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8022b6:	83 f0 01             	xor    $0x1,%eax
+  8022b9:	4d 39 fc             	cmp    %r15,%r12
+  8022bc:	0f 92 c2             	setb   %dl
+  8022bf:	84 c2                	test   %al,%dl
+  8022c1:	75 05                	jne    8022c8 <fschan_rw+0x1ae>
+  8022c3:	45 85 ed             	test   %r13d,%r13d
+  8022c6:	74 50                	je     802318 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022c8:	4d 39 fc             	cmp    %r15,%r12
+  8022cb:	0f 92 c1             	setb   %cl
+  8022ce:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022d2:	0f 96 c2             	setbe  %dl
+  8022d5:	84 d1                	test   %dl,%cl
+  8022d7:	0f 84 6a ff ff ff    	je     802247 <fschan_rw+0x12d>
+  8022dd:	84 c0                	test   %al,%al
+  8022df:	0f 85 fd fe ff ff    	jne    8021e2 <fschan_rw+0xc8>
+  8022e5:	e9 5d ff ff ff       	jmp    802247 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8022ea:	48 63 d0             	movslq %eax,%rdx
+  8022ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8022f1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8022f5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8022f9:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8022fd:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802301:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  802308:	00 00 00 
+  80230b:	ff d0                	call   *%rax
+  80230d:	eb 80                	jmp    80228f <fschan_rw+0x175>
+                err = msg->fm_res;
+  80230f:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802312:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802316:	eb 8b                	jmp    8022a3 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802318:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80231d:	0f 85 68 fe ff ff    	jne    80218b <fschan_rw+0x71>
+  802323:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802326:	85 c0                	test   %eax,%eax
+  802328:	0f 84 5d fe ff ff    	je     80218b <fschan_rw+0x71>
+  80232e:	48 98                	cltq
+}
+  802330:	48 83 c4 48          	add    $0x48,%rsp
+  802334:	5b                   	pop    %rbx
+  802335:	41 5c                	pop    %r12
+  802337:	41 5d                	pop    %r13
+  802339:	41 5e                	pop    %r14
+  80233b:	41 5f                	pop    %r15
+  80233d:	5d                   	pop    %rbp
+  80233e:	c3                   	ret
+
+000000000080233f <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80233f:	55                   	push   %rbp
+  802340:	48 89 e5             	mov    %rsp,%rbp
+  802343:	41 56                	push   %r14
+  802345:	41 55                	push   %r13
+  802347:	41 54                	push   %r12
+  802349:	53                   	push   %rbx
+  80234a:	48 83 ec 10          	sub    $0x10,%rsp
+  80234e:	49 89 fe             	mov    %rdi,%r14
+  802351:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802354:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802358:	48 29 f3             	sub    %rsi,%rbx
+  80235b:	48 39 d3             	cmp    %rdx,%rbx
+  80235e:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802362:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802369:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80236a:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80236f:	49 bd b8 3f 80 00 00 	movabs $0x803fb8,%r13
+  802376:	00 00 00 
+  802379:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802380:	76 1e                	jbe    8023a0 <mmap_fault+0x61>
+  802382:	4c 01 e7             	add    %r12,%rdi
+  802385:	41 ff d5             	call   *%r13
+  802388:	84 c0                	test   %al,%al
+  80238a:	75 14                	jne    8023a0 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80238c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802390:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802397:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80239b:	48 39 df             	cmp    %rbx,%rdi
+  80239e:	72 e2                	jb     802382 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8023a0:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8023a7:	00 00 00 
+  8023aa:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023b1:	00 00 00 
+  8023b4:	4c 89 f0             	mov    %r14,%rax
+  8023b7:	48 29 d0             	sub    %rdx,%rax
+  8023ba:	48 c1 f8 03          	sar    $0x3,%rax
+  8023be:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8023c5:	aa aa aa 
+  8023c8:	48 0f af c2          	imul   %rdx,%rax
+  8023cc:	48 c1 e0 0c          	shl    $0xc,%rax
+  8023d0:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8023d5:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8023d9:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8023db:	44 89 e0             	mov    %r12d,%eax
+  8023de:	41 03 46 10          	add    0x10(%r14),%eax
+  8023e2:	41 2b 06             	sub    (%r14),%eax
+  8023e5:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8023e8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023ec:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8023f0:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8023f4:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8023f7:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8023fe:	00 00 00 
+  802401:	ff d0                	call   *%rax
+  802403:	89 c7                	mov    %eax,%edi
+  802405:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80240b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802410:	48 89 da             	mov    %rbx,%rdx
+  802413:	be 0f 00 00 00       	mov    $0xf,%esi
+  802418:	48 b8 3c 46 80 00 00 	movabs $0x80463c,%rax
+  80241f:	00 00 00 
+  802422:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802424:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802429:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80242d:	4c 89 e6             	mov    %r12,%rsi
+  802430:	bf 00 00 00 00       	mov    $0x0,%edi
+  802435:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+  802441:	48 98                	cltq
+}
+  802443:	48 83 c4 10          	add    $0x10,%rsp
+  802447:	5b                   	pop    %rbx
+  802448:	41 5c                	pop    %r12
+  80244a:	41 5d                	pop    %r13
+  80244c:	41 5e                	pop    %r14
+  80244e:	5d                   	pop    %rbp
+  80244f:	c3                   	ret
+
+0000000000802450 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802450:	48 8b 37             	mov    (%rdi),%rsi
+  802453:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80245a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802461:	00 00 00 
+  802464:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802469:	eb 0f                	jmp    80247a <mmap_pgfault+0x2a>
+  80246b:	c3                   	ret
+  80246c:	48 83 c1 01          	add    $0x1,%rcx
+  802470:	48 83 c2 18          	add    $0x18,%rdx
+  802474:	48 83 f9 20          	cmp    $0x20,%rcx
+  802478:	74 6e                	je     8024e8 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80247a:	48 8b 02             	mov    (%rdx),%rax
+  80247d:	48 83 e8 01          	sub    $0x1,%rax
+  802481:	48 39 f0             	cmp    %rsi,%rax
+  802484:	73 e6                	jae    80246c <mmap_pgfault+0x1c>
+  802486:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80248a:	73 e0                	jae    80246c <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80248c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802490:	b8 00 00 00 00       	mov    $0x0,%eax
+  802495:	f6 c2 01             	test   $0x1,%dl
+  802498:	75 d1                	jne    80246b <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80249a:	f6 c2 02             	test   $0x2,%dl
+  80249d:	74 1a                	je     8024b9 <mmap_pgfault+0x69>
+  80249f:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a8:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8024af:	00 00 00 
+  8024b2:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8024b7:	74 35                	je     8024ee <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8024b9:	55                   	push   %rbp
+  8024ba:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8024bd:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024c1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024c8:	00 00 00 
+  8024cb:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8024cf:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8024d4:	48 b8 3f 23 80 00 00 	movabs $0x80233f,%rax
+  8024db:	00 00 00 
+  8024de:	ff d0                	call   *%rax
+  8024e0:	48 85 c0             	test   %rax,%rax
+  8024e3:	0f 9f c0             	setg   %al
+}
+  8024e6:	5d                   	pop    %rbp
+  8024e7:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8024e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ed:	c3                   	ret
+}
+  8024ee:	c3                   	ret
+
+00000000008024ef <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8024ef:	55                   	push   %rbp
+  8024f0:	48 89 e5             	mov    %rsp,%rbp
+  8024f3:	41 54                	push   %r12
+  8024f5:	53                   	push   %rbx
+  8024f6:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8024f9:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802500:	00 00 00 
+  802503:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802508:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80250c:	74 15                	je     802523 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80250e:	48 83 c3 01          	add    $0x1,%rbx
+  802512:	48 83 c0 18          	add    $0x18,%rax
+  802516:	48 83 fb 20          	cmp    $0x20,%rbx
+  80251a:	75 ec                	jne    802508 <mmap_alloc+0x19>
+    return NULL;
+  80251c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802521:	eb 52                	jmp    802575 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802523:	4c 89 e7             	mov    %r12,%rdi
+  802526:	48 b8 59 3f 80 00 00 	movabs $0x803f59,%rax
+  80252d:	00 00 00 
+  802530:	ff d0                	call   *%rax
+  802532:	41 89 c1             	mov    %eax,%r9d
+  802535:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80253c:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802540:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80254b:	4c 89 e6             	mov    %r12,%rsi
+  80254e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802553:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+  80255f:	85 c0                	test   %eax,%eax
+  802561:	78 17                	js     80257a <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802563:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802567:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80256e:	00 00 00 
+  802571:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802575:	5b                   	pop    %rbx
+  802576:	41 5c                	pop    %r12
+  802578:	5d                   	pop    %rbp
+  802579:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80257a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80257f:	eb f4                	jmp    802575 <mmap_alloc+0x86>
+
+0000000000802581 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802581:	55                   	push   %rbp
+  802582:	48 89 e5             	mov    %rsp,%rbp
+  802585:	41 56                	push   %r14
+  802587:	41 55                	push   %r13
+  802589:	41 54                	push   %r12
+  80258b:	53                   	push   %rbx
+  80258c:	48 83 ec 10          	sub    $0x10,%rsp
+  802590:	41 89 fc             	mov    %edi,%r12d
+  802593:	49 89 f5             	mov    %rsi,%r13
+  802596:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802599:	48 89 f0             	mov    %rsi,%rax
+  80259c:	48 09 d0             	or     %rdx,%rax
+  80259f:	75 0d                	jne    8025ae <fsipc+0x2d>
+  8025a1:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8025a4:	83 f8 04             	cmp    $0x4,%eax
+  8025a7:	76 7d                	jbe    802626 <fsipc+0xa5>
+  8025a9:	83 ff 0d             	cmp    $0xd,%edi
+  8025ac:	74 78                	je     802626 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8025ae:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+  8025ba:	89 c7                	mov    %eax,%edi
+  8025bc:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8025c3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8025ca:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8025d1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025d7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8025de:	00 00 00 
+  8025e1:	44 89 e6             	mov    %r12d,%esi
+  8025e4:	48 b8 3c 46 80 00 00 	movabs $0x80463c,%rax
+  8025eb:	00 00 00 
+  8025ee:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8025f0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8025f7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8025f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025fd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802601:	4c 89 ee             	mov    %r13,%rsi
+  802604:	bf 00 00 00 00       	mov    $0x0,%edi
+  802609:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  802610:	00 00 00 
+  802613:	ff d0                	call   *%rax
+  802615:	89 c3                	mov    %eax,%ebx
+}
+  802617:	89 d8                	mov    %ebx,%eax
+  802619:	48 83 c4 10          	add    $0x10,%rsp
+  80261d:	5b                   	pop    %rbx
+  80261e:	41 5c                	pop    %r12
+  802620:	41 5d                	pop    %r13
+  802622:	41 5e                	pop    %r14
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802626:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  80262d:	00 00 00 
+  802630:	ff d0                	call   *%rax
+  802632:	49 89 c6             	mov    %rax,%r14
+  802635:	48 85 c0             	test   %rax,%rax
+  802638:	0f 84 70 ff ff ff    	je     8025ae <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80263e:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802642:	48 b8 36 41 80 00 00 	movabs $0x804136,%rax
+  802649:	00 00 00 
+  80264c:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80264e:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802651:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802658:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80265c:	ba 10 00 00 00       	mov    $0x10,%edx
+  802661:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802668:	00 00 00 
+  80266b:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  802672:	00 00 00 
+  802675:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802677:	4c 89 f7             	mov    %r14,%rdi
+  80267a:	48 b8 cf 20 80 00 00 	movabs $0x8020cf,%rax
+  802681:	00 00 00 
+  802684:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802686:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80268d:	4c 89 f7             	mov    %r14,%rdi
+  802690:	48 b8 f9 41 80 00 00 	movabs $0x8041f9,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80269c:	4c 89 f7             	mov    %r14,%rdi
+  80269f:	48 b8 87 41 80 00 00 	movabs $0x804187,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8026ab:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8026ae:	41 83 fc 05          	cmp    $0x5,%r12d
+  8026b2:	75 04                	jne    8026b8 <fsipc+0x137>
+  8026b4:	85 db                	test   %ebx,%ebx
+  8026b6:	79 14                	jns    8026cc <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8026b8:	4c 89 f7             	mov    %r14,%rdi
+  8026bb:	48 b8 ae 41 80 00 00 	movabs $0x8041ae,%rax
+  8026c2:	00 00 00 
+  8026c5:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8026c7:	e9 4b ff ff ff       	jmp    802617 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8026cc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8026d0:	ba 88 00 00 00       	mov    $0x88,%edx
+  8026d5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8026dc:	00 00 00 
+  8026df:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+  8026eb:	eb cb                	jmp    8026b8 <fsipc+0x137>
+
+00000000008026ed <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8026ed:	55                   	push   %rbp
+  8026ee:	48 89 e5             	mov    %rsp,%rbp
+  8026f1:	41 57                	push   %r15
+  8026f3:	41 56                	push   %r14
+  8026f5:	41 55                	push   %r13
+  8026f7:	41 54                	push   %r12
+  8026f9:	53                   	push   %rbx
+  8026fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8026fe:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802702:	49 89 f6             	mov    %rsi,%r14
+  802705:	49 89 d4             	mov    %rdx,%r12
+  802708:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80270b:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  802712:	00 00 00 
+  802715:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802717:	48 85 c0             	test   %rax,%rax
+  80271a:	0f 85 96 00 00 00    	jne    8027b6 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802720:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802727:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802728:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80272f:	00 00 00 
+    while (n) {
+  802732:	4d 85 e4             	test   %r12,%r12
+  802735:	74 79                	je     8027b0 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802737:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80273c:	49 39 dc             	cmp    %rbx,%r12
+  80273f:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802743:	48 89 da             	mov    %rbx,%rdx
+  802746:	4c 89 f6             	mov    %r14,%rsi
+  802749:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802750:	00 00 00 
+  802753:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  80275a:	00 00 00 
+  80275d:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80275f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802763:	8b 40 0c             	mov    0xc(%rax),%eax
+  802766:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802769:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80276c:	44 01 e8             	add    %r13d,%eax
+  80276f:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802773:	41 0f 44 c5          	cmove  %r13d,%eax
+  802777:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80277b:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80277f:	48 89 da             	mov    %rbx,%rdx
+  802782:	be 00 00 00 00       	mov    $0x0,%esi
+  802787:	bf 04 00 00 00       	mov    $0x4,%edi
+  80278c:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+        if (res < 0)
+  802798:	85 c0                	test   %eax,%eax
+  80279a:	78 4a                	js     8027e6 <devfile_write_direct+0xf9>
+        buf += res;
+  80279c:	48 98                	cltq
+  80279e:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8027a1:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8027a5:	49 29 c4             	sub    %rax,%r12
+  8027a8:	75 8d                	jne    802737 <devfile_write_direct+0x4a>
+    return write;
+  8027aa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027ae:	eb 27                	jmp    8027d7 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8027b0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8027b4:	eb f4                	jmp    8027aa <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027b6:	45 89 e9             	mov    %r13d,%r9d
+  8027b9:	4d 89 e0             	mov    %r12,%r8
+  8027bc:	4c 89 f1             	mov    %r14,%rcx
+  8027bf:	ba 04 00 00 00       	mov    $0x4,%edx
+  8027c4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8027c8:	48 89 c7             	mov    %rax,%rdi
+  8027cb:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  8027d2:	00 00 00 
+  8027d5:	ff d0                	call   *%rax
+}
+  8027d7:	48 83 c4 18          	add    $0x18,%rsp
+  8027db:	5b                   	pop    %rbx
+  8027dc:	41 5c                	pop    %r12
+  8027de:	41 5d                	pop    %r13
+  8027e0:	41 5e                	pop    %r14
+  8027e2:	41 5f                	pop    %r15
+  8027e4:	5d                   	pop    %rbp
+  8027e5:	c3                   	ret
+            return res;
+  8027e6:	48 98                	cltq
+  8027e8:	eb ed                	jmp    8027d7 <devfile_write_direct+0xea>
+
+00000000008027ea <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8027ea:	55                   	push   %rbp
+  8027eb:	48 89 e5             	mov    %rsp,%rbp
+  8027ee:	41 54                	push   %r12
+  8027f0:	53                   	push   %rbx
+  8027f1:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8027f4:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802800:	48 85 c0             	test   %rax,%rax
+  802803:	74 71                	je     802876 <fbuf_flush+0x8c>
+  802805:	48 89 c3             	mov    %rax,%rbx
+  802808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80280d:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802811:	75 05                	jne    802818 <fbuf_flush+0x2e>
+}
+  802813:	5b                   	pop    %rbx
+  802814:	41 5c                	pop    %r12
+  802816:	5d                   	pop    %rbp
+  802817:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802818:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80281b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80281f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802826:	00 00 00 
+  802829:	48 89 de             	mov    %rbx,%rsi
+  80282c:	48 29 c6             	sub    %rax,%rsi
+  80282f:	48 c1 fe 03          	sar    $0x3,%rsi
+  802833:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80283a:	aa aa aa 
+  80283d:	48 0f af f0          	imul   %rax,%rsi
+  802841:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802845:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80284a:	48 01 c6             	add    %rax,%rsi
+  80284d:	4c 89 e7             	mov    %r12,%rdi
+  802850:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80285c:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802860:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802867:	00 
+    return res < 0 ? res : 0;
+  802868:	48 85 c0             	test   %rax,%rax
+  80286b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802870:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802874:	eb 9d                	jmp    802813 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80287b:	eb 96                	jmp    802813 <fbuf_flush+0x29>
+
+000000000080287d <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80287d:	55                   	push   %rbp
+  80287e:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802881:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802888:	00 00 00 
+  80288b:	ff d0                	call   *%rax
+}
+  80288d:	5d                   	pop    %rbp
+  80288e:	c3                   	ret
+
+000000000080288f <devfile_write>:
+    if (!fd || !buf)
+  80288f:	48 85 ff             	test   %rdi,%rdi
+  802892:	0f 84 d3 01 00 00    	je     802a6b <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802898:	55                   	push   %rbp
+  802899:	48 89 e5             	mov    %rsp,%rbp
+  80289c:	41 57                	push   %r15
+  80289e:	41 56                	push   %r14
+  8028a0:	41 55                	push   %r13
+  8028a2:	41 54                	push   %r12
+  8028a4:	53                   	push   %rbx
+  8028a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8028a9:	49 89 fc             	mov    %rdi,%r12
+  8028ac:	49 89 f6             	mov    %rsi,%r14
+  8028af:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8028b2:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8028b7:	48 85 f6             	test   %rsi,%rsi
+  8028ba:	0f 84 9c 01 00 00    	je     802a5c <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8028c0:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+  8028cc:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8028cf:	48 85 c0             	test   %rax,%rax
+  8028d2:	0f 84 a2 00 00 00    	je     80297a <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8028d8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028dd:	4c 89 e7             	mov    %r12,%rdi
+  8028e0:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8028ec:	83 f8 02             	cmp    $0x2,%eax
+  8028ef:	0f 8f 85 00 00 00    	jg     80297a <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8028f5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8028fc:	00 00 00 
+  8028ff:	4d 89 ef             	mov    %r13,%r15
+  802902:	49 29 c7             	sub    %rax,%r15
+  802905:	49 c1 ff 03          	sar    $0x3,%r15
+  802909:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802910:	aa aa aa 
+  802913:	4c 0f af f8          	imul   %rax,%r15
+  802917:	49 c1 e7 0e          	shl    $0xe,%r15
+  80291b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802920:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802923:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802928:	0f 84 d7 00 00 00    	je     802a05 <devfile_write+0x176>
+  80292e:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802932:	89 c2                	mov    %eax,%edx
+  802934:	41 03 55 0c          	add    0xc(%r13),%edx
+  802938:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80293d:	75 0f                	jne    80294e <devfile_write+0xbf>
+  80293f:	48 01 d8             	add    %rbx,%rax
+  802942:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802948:	0f 86 92 00 00 00    	jbe    8029e0 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80294e:	4c 89 e7             	mov    %r12,%rdi
+  802951:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802958:	00 00 00 
+  80295b:	ff d0                	call   *%rax
+  80295d:	85 c0                	test   %eax,%eax
+  80295f:	78 52                	js     8029b3 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802961:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802968:	77 7f                	ja     8029e9 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80296a:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80296f:	0f 85 c2 00 00 00    	jne    802a37 <devfile_write+0x1a8>
+  802975:	e9 94 00 00 00       	jmp    802a0e <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80297a:	4c 89 e7             	mov    %r12,%rdi
+  80297d:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802989:	85 c0                	test   %eax,%eax
+  80298b:	79 07                	jns    802994 <devfile_write+0x105>
+  80298d:	48 98                	cltq
+  80298f:	e9 c8 00 00 00       	jmp    802a5c <devfile_write+0x1cd>
+  802994:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802999:	48 89 da             	mov    %rbx,%rdx
+  80299c:	4c 89 f6             	mov    %r14,%rsi
+  80299f:	4c 89 e7             	mov    %r12,%rdi
+  8029a2:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  8029a9:	00 00 00 
+  8029ac:	ff d0                	call   *%rax
+  8029ae:	e9 a9 00 00 00       	jmp    802a5c <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8029b3:	48 98                	cltq
+  8029b5:	e9 a2 00 00 00       	jmp    802a5c <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8029ba:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029bf:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8029c4:	4c 89 fe             	mov    %r15,%rsi
+  8029c7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029cc:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8029d8:	85 c0                	test   %eax,%eax
+  8029da:	79 45                	jns    802a21 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8029dc:	48 98                	cltq
+  8029de:	eb 7c                	jmp    802a5c <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8029e0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8029e7:	76 4e                	jbe    802a37 <devfile_write+0x1a8>
+  8029e9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8029ee:	48 89 da             	mov    %rbx,%rdx
+  8029f1:	4c 89 f6             	mov    %r14,%rsi
+  8029f4:	4c 89 e7             	mov    %r12,%rdi
+  8029f7:	48 b8 ed 26 80 00 00 	movabs $0x8026ed,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+  802a03:	eb 57                	jmp    802a5c <devfile_write+0x1cd>
+  802a05:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a0c:	77 db                	ja     8029e9 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802a0e:	4c 89 ff             	mov    %r15,%rdi
+  802a11:	48 b8 b8 3f 80 00 00 	movabs $0x803fb8,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+  802a1d:	84 c0                	test   %al,%al
+  802a1f:	74 99                	je     8029ba <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802a21:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802a26:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802a2b:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802a2f:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802a36:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802a37:	4c 89 ff             	mov    %r15,%rdi
+  802a3a:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802a3e:	48 89 da             	mov    %rbx,%rdx
+  802a41:	4c 89 f6             	mov    %r14,%rsi
+  802a44:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  802a4b:	00 00 00 
+  802a4e:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802a50:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802a54:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802a59:	48 89 d8             	mov    %rbx,%rax
+}
+  802a5c:	48 83 c4 08          	add    $0x8,%rsp
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	41 5d                	pop    %r13
+  802a65:	41 5e                	pop    %r14
+  802a67:	41 5f                	pop    %r15
+  802a69:	5d                   	pop    %rbp
+  802a6a:	c3                   	ret
+        return E_INVAL;
+  802a6b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a70:	c3                   	ret
+
+0000000000802a71 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a71:	55                   	push   %rbp
+  802a72:	48 89 e5             	mov    %rsp,%rbp
+  802a75:	41 54                	push   %r12
+  802a77:	53                   	push   %rbx
+  802a78:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802a7b:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802a82:	00 00 00 
+  802a85:	ff d0                	call   *%rax
+  802a87:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802a8a:	48 89 df             	mov    %rbx,%rdi
+  802a8d:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  802a94:	00 00 00 
+  802a97:	ff d0                	call   *%rax
+  802a99:	48 85 c0             	test   %rax,%rax
+  802a9c:	74 17                	je     802ab5 <devfile_flush+0x44>
+  802a9e:	48 89 df             	mov    %rbx,%rdi
+  802aa1:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  802aa8:	00 00 00 
+  802aab:	ff d0                	call   *%rax
+  802aad:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ab4:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ab5:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ab8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802abf:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802ac1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ac6:	be 00 00 00 00       	mov    $0x0,%esi
+  802acb:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ad0:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  802ad7:	00 00 00 
+  802ada:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802adc:	45 85 e4             	test   %r12d,%r12d
+  802adf:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ae3:	5b                   	pop    %rbx
+  802ae4:	41 5c                	pop    %r12
+  802ae6:	5d                   	pop    %rbp
+  802ae7:	c3                   	ret
+
+0000000000802ae8 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802ae8:	55                   	push   %rbp
+  802ae9:	48 89 e5             	mov    %rsp,%rbp
+  802aec:	41 57                	push   %r15
+  802aee:	41 56                	push   %r14
+  802af0:	41 55                	push   %r13
+  802af2:	41 54                	push   %r12
+  802af4:	53                   	push   %rbx
+  802af5:	48 83 ec 38          	sub    $0x38,%rsp
+  802af9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802afd:	49 89 f7             	mov    %rsi,%r15
+  802b00:	48 89 d3             	mov    %rdx,%rbx
+  802b03:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802b06:	48 b8 33 20 80 00 00 	movabs $0x802033,%rax
+  802b0d:	00 00 00 
+  802b10:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b12:	48 85 c0             	test   %rax,%rax
+  802b15:	75 20                	jne    802b37 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802b17:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802b1c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b23:	00 
+    while (n) {
+  802b24:	48 85 db             	test   %rbx,%rbx
+  802b27:	0f 85 df 00 00 00    	jne    802c0c <devfile_read_direct+0x124>
+    size_t read = 0;
+  802b2d:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802b31:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b35:	eb 21                	jmp    802b58 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b37:	45 89 f1             	mov    %r14d,%r9d
+  802b3a:	49 89 d8             	mov    %rbx,%r8
+  802b3d:	4c 89 f9             	mov    %r15,%rcx
+  802b40:	ba 03 00 00 00       	mov    $0x3,%edx
+  802b45:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b49:	48 89 c7             	mov    %rax,%rdi
+  802b4c:	48 b8 1a 21 80 00 00 	movabs $0x80211a,%rax
+  802b53:	00 00 00 
+  802b56:	ff d0                	call   *%rax
+}
+  802b58:	48 83 c4 38          	add    $0x38,%rsp
+  802b5c:	5b                   	pop    %rbx
+  802b5d:	41 5c                	pop    %r12
+  802b5f:	41 5d                	pop    %r13
+  802b61:	41 5e                	pop    %r14
+  802b63:	41 5f                	pop    %r15
+  802b65:	5d                   	pop    %rbp
+  802b66:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b67:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b6b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b71:	75 1e                	jne    802b91 <devfile_read_direct+0xa9>
+  802b73:	e9 e2 00 00 00       	jmp    802c5a <devfile_read_direct+0x172>
+            if (!res) return read;
+  802b78:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b7c:	eb da                	jmp    802b58 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802b7e:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802b82:	0f 85 d0 01 00 00    	jne    802d58 <devfile_read_direct+0x270>
+            map = 0;
+  802b88:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802b8c:	eb 03                	jmp    802b91 <devfile_read_direct+0xa9>
+  802b8e:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b91:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b96:	48 39 d3             	cmp    %rdx,%rbx
+  802b99:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b9d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ba1:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ba4:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802bab:	00 00 00 
+  802bae:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802bb0:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802bb4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802bb8:	be 00 00 00 00       	mov    $0x0,%esi
+  802bbd:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bc2:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  802bc9:	00 00 00 
+  802bcc:	ff d0                	call   *%rax
+        if (res <= 0)
+  802bce:	85 c0                	test   %eax,%eax
+  802bd0:	0f 8e 63 01 00 00    	jle    802d39 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802bd6:	4c 63 e0             	movslq %eax,%r12
+  802bd9:	4c 89 e2             	mov    %r12,%rdx
+  802bdc:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802be3:	00 00 00 
+  802be6:	4c 89 ff             	mov    %r15,%rdi
+  802be9:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+        buf += res;
+  802bf5:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802bf8:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802bfb:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802bff:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802c03:	48 85 db             	test   %rbx,%rbx
+  802c06:	0f 84 25 ff ff ff    	je     802b31 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802c0c:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802c0f:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802c13:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802c17:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c1b:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802c22:	0f 97 c2             	seta   %dl
+  802c25:	20 c2                	and    %al,%dl
+  802c27:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802c2a:	0f 84 5e ff ff ff    	je     802b8e <devfile_read_direct+0xa6>
+  802c30:	4c 89 fa             	mov    %r15,%rdx
+  802c33:	4d 89 fd             	mov    %r15,%r13
+  802c36:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802c3d:	0f 85 4e ff ff ff    	jne    802b91 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802c43:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802c47:	0f 84 1a ff ff ff    	je     802b67 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c4d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c54:	0f 85 37 ff ff ff    	jne    802b91 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802c5a:	48 89 d8             	mov    %rbx,%rax
+  802c5d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c63:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c68:	48 39 c8             	cmp    %rcx,%rax
+  802c6b:	48 0f 47 c1          	cmova  %rcx,%rax
+  802c6f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802c73:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802c77:	49 89 d4             	mov    %rdx,%r12
+  802c7a:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802c7e:	48 b8 59 3f 80 00 00 	movabs $0x803f59,%rax
+  802c85:	00 00 00 
+  802c88:	ff d0                	call   *%rax
+  802c8a:	a8 40                	test   $0x40,%al
+  802c8c:	0f 85 b9 00 00 00    	jne    802d4b <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802c92:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802c99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c9d:	49 39 c5             	cmp    %rax,%r13
+  802ca0:	72 d8                	jb     802c7a <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ca2:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802ca6:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802cad:	00 00 00 
+  802cb0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cb4:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802cb7:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802cb9:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802cbd:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802cc1:	48 b8 ce 1e 80 00 00 	movabs $0x801ece,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+  802ccd:	89 c7                	mov    %eax,%edi
+  802ccf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802cd5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cda:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802ce1:	00 00 00 
+  802ce4:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ce9:	48 b8 3c 46 80 00 00 	movabs $0x80463c,%rax
+  802cf0:	00 00 00 
+  802cf3:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802cf5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cfa:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802cfe:	4c 89 fe             	mov    %r15,%rsi
+  802d01:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d06:	48 b8 18 46 80 00 00 	movabs $0x804618,%rax
+  802d0d:	00 00 00 
+  802d10:	ff d0                	call   *%rax
+  802d12:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802d15:	48 85 d2             	test   %rdx,%rdx
+  802d18:	0f 84 5a fe ff ff    	je     802b78 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802d1e:	0f 8e 5a fe ff ff    	jle    802b7e <devfile_read_direct+0x96>
+                buf += res;
+  802d24:	48 98                	cltq
+  802d26:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802d29:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802d2c:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802d30:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802d34:	e9 ca fe ff ff       	jmp    802c03 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802d39:	41 89 c5             	mov    %eax,%r13d
+  802d3c:	48 98                	cltq
+  802d3e:	45 85 ed             	test   %r13d,%r13d
+  802d41:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802d46:	e9 0d fe ff ff       	jmp    802b58 <devfile_read_direct+0x70>
+            map = 0;
+  802d4b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d4f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d53:	e9 39 fe ff ff       	jmp    802b91 <devfile_read_direct+0xa9>
+  802d58:	48 89 d0             	mov    %rdx,%rax
+  802d5b:	e9 f8 fd ff ff       	jmp    802b58 <devfile_read_direct+0x70>
+
+0000000000802d60 <devfile_read>:
+    if (!fd || !buf)
+  802d60:	48 85 ff             	test   %rdi,%rdi
+  802d63:	0f 84 21 02 00 00    	je     802f8a <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d69:	55                   	push   %rbp
+  802d6a:	48 89 e5             	mov    %rsp,%rbp
+  802d6d:	41 57                	push   %r15
+  802d6f:	41 56                	push   %r14
+  802d71:	41 55                	push   %r13
+  802d73:	41 54                	push   %r12
+  802d75:	53                   	push   %rbx
+  802d76:	48 83 ec 28          	sub    $0x28,%rsp
+  802d7a:	48 89 fb             	mov    %rdi,%rbx
+  802d7d:	49 89 f4             	mov    %rsi,%r12
+  802d80:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802d83:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802d88:	48 85 f6             	test   %rsi,%rsi
+  802d8b:	74 4b                	je     802dd8 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802d8d:	48 b8 9d 20 80 00 00 	movabs $0x80209d,%rax
+  802d94:	00 00 00 
+  802d97:	ff d0                	call   *%rax
+  802d99:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d9c:	48 85 c0             	test   %rax,%rax
+  802d9f:	74 22                	je     802dc3 <devfile_read+0x63>
+  802da1:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802da8:	77 19                	ja     802dc3 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802daa:	be 00 10 00 00       	mov    $0x1000,%esi
+  802daf:	48 89 df             	mov    %rbx,%rdi
+  802db2:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802dbe:	83 f8 02             	cmp    $0x2,%eax
+  802dc1:	7e 40                	jle    802e03 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802dc3:	48 89 df             	mov    %rbx,%rdi
+  802dc6:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802dcd:	00 00 00 
+  802dd0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802dd2:	85 c0                	test   %eax,%eax
+  802dd4:	79 11                	jns    802de7 <devfile_read+0x87>
+  802dd6:	48 98                	cltq
+}
+  802dd8:	48 83 c4 28          	add    $0x28,%rsp
+  802ddc:	5b                   	pop    %rbx
+  802ddd:	41 5c                	pop    %r12
+  802ddf:	41 5d                	pop    %r13
+  802de1:	41 5e                	pop    %r14
+  802de3:	41 5f                	pop    %r15
+  802de5:	5d                   	pop    %rbp
+  802de6:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802de7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802dec:	4c 89 ea             	mov    %r13,%rdx
+  802def:	4c 89 e6             	mov    %r12,%rsi
+  802df2:	48 89 df             	mov    %rbx,%rdi
+  802df5:	48 b8 e8 2a 80 00 00 	movabs $0x802ae8,%rax
+  802dfc:	00 00 00 
+  802dff:	ff d0                	call   *%rax
+  802e01:	eb d5                	jmp    802dd8 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802e03:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e07:	48 89 df             	mov    %rbx,%rdi
+  802e0a:	48 b8 ea 27 80 00 00 	movabs $0x8027ea,%rax
+  802e11:	00 00 00 
+  802e14:	ff d0                	call   *%rax
+  802e16:	85 c0                	test   %eax,%eax
+  802e18:	0f 88 33 01 00 00    	js     802f51 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802e1e:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802e25:	00 00 00 
+  802e28:	4c 89 f0             	mov    %r14,%rax
+  802e2b:	48 29 d0             	sub    %rdx,%rax
+  802e2e:	48 c1 f8 03          	sar    $0x3,%rax
+  802e32:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802e39:	aa aa aa 
+  802e3c:	48 0f af c2          	imul   %rdx,%rax
+  802e40:	48 c1 e0 0e          	shl    $0xe,%rax
+  802e44:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e48:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e4b:	41 39 06             	cmp    %eax,(%r14)
+  802e4e:	75 0d                	jne    802e5d <devfile_read+0xfd>
+  802e50:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e53:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802e57:	0f 84 fb 00 00 00    	je     802f58 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802e5d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e62:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e66:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802e69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e6d:	48 89 c7             	mov    %rax,%rdi
+  802e70:	48 b8 b8 3f 80 00 00 	movabs $0x803fb8,%rax
+  802e77:	00 00 00 
+  802e7a:	ff d0                	call   *%rax
+  802e7c:	84 c0                	test   %al,%al
+  802e7e:	75 27                	jne    802ea7 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e80:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e85:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e8a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e93:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  802e9a:	00 00 00 
+  802e9d:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802e9f:	85 c0                	test   %eax,%eax
+  802ea1:	0f 88 dc 00 00 00    	js     802f83 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ea7:	44 89 f8             	mov    %r15d,%eax
+  802eaa:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802eaf:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802eb1:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802eb8:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802eb9:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ebc:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ec0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802ec3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802ec8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ecc:	48 89 df             	mov    %rbx,%rdi
+  802ecf:	48 b8 e8 2a 80 00 00 	movabs $0x802ae8,%rax
+  802ed6:	00 00 00 
+  802ed9:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802edb:	48 85 c0             	test   %rax,%rax
+  802ede:	0f 88 f4 fe ff ff    	js     802dd8 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802ee4:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ee7:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802eea:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802eed:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802ef1:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802ef5:	48 63 d1             	movslq %ecx,%rdx
+  802ef8:	48 01 d0             	add    %rdx,%rax
+  802efb:	4d 63 ff             	movslq %r15d,%r15
+  802efe:	4c 29 f8             	sub    %r15,%rax
+  802f01:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f06:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802f0a:	48 85 c0             	test   %rax,%rax
+  802f0d:	0f 8e c5 fe ff ff    	jle    802dd8 <devfile_read+0x78>
+    n = MIN(n, res);
+  802f13:	4c 39 e8             	cmp    %r13,%rax
+  802f16:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802f1a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f1d:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802f21:	48 63 f6             	movslq %esi,%rsi
+  802f24:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f29:	48 01 c6             	add    %rax,%rsi
+  802f2c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f30:	48 01 c6             	add    %rax,%rsi
+  802f33:	4c 89 ea             	mov    %r13,%rdx
+  802f36:	4c 89 e7             	mov    %r12,%rdi
+  802f39:	48 b8 9e 0d 80 00 00 	movabs $0x800d9e,%rax
+  802f40:	00 00 00 
+  802f43:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802f45:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802f49:	4c 89 e8             	mov    %r13,%rax
+  802f4c:	e9 87 fe ff ff       	jmp    802dd8 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f51:	48 98                	cltq
+  802f53:	e9 80 fe ff ff       	jmp    802dd8 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f58:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f5c:	41 39 d7             	cmp    %edx,%r15d
+  802f5f:	0f 8c f8 fe ff ff    	jl     802e5d <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f65:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802f69:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802f6c:	41 39 cf             	cmp    %ecx,%r15d
+  802f6f:	0f 8d e8 fe ff ff    	jge    802e5d <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802f75:	4d 63 ff             	movslq %r15d,%r15
+  802f78:	4c 29 f8             	sub    %r15,%rax
+  802f7b:	48 63 d2             	movslq %edx,%rdx
+  802f7e:	48 01 d0             	add    %rdx,%rax
+  802f81:	eb 87                	jmp    802f0a <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f83:	48 98                	cltq
+  802f85:	e9 4e fe ff ff       	jmp    802dd8 <devfile_read+0x78>
+        return E_INVAL;
+  802f8a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802f8f:	c3                   	ret
+
+0000000000802f90 <fs_channel>:
+fs_channel(bool enable) {
+  802f90:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802f92:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802f99:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802f9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fa0:	40 84 ff             	test   %dil,%dil
+  802fa3:	74 47                	je     802fec <fs_channel+0x5c>
+  802fa5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802fac:	00 00 00 
+  802faf:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802fb5:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802fbc:	00 00 00 
+  802fbf:	3b 08                	cmp    (%rax),%ecx
+  802fc1:	74 29                	je     802fec <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802fc3:	55                   	push   %rbp
+  802fc4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802fc7:	48 b8 10 1f 80 00 00 	movabs $0x801f10,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+  802fd3:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802fd5:	85 c0                	test   %eax,%eax
+  802fd7:	78 04                	js     802fdd <fs_channel+0x4d>
+}
+  802fd9:	89 d0                	mov    %edx,%eax
+  802fdb:	5d                   	pop    %rbp
+  802fdc:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802fdd:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802fe4:	00 00 00 
+  802fe7:	c6 00 00             	movb   $0x0,(%rax)
+  802fea:	eb ed                	jmp    802fd9 <fs_channel+0x49>
+}
+  802fec:	89 d0                	mov    %edx,%eax
+  802fee:	c3                   	ret
+
+0000000000802fef <open>:
+open(const char *path, int mode) {
+  802fef:	55                   	push   %rbp
+  802ff0:	48 89 e5             	mov    %rsp,%rbp
+  802ff3:	41 55                	push   %r13
+  802ff5:	41 54                	push   %r12
+  802ff7:	53                   	push   %rbx
+  802ff8:	48 83 ec 18          	sub    $0x18,%rsp
+  802ffc:	49 89 fc             	mov    %rdi,%r12
+  802fff:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803002:	48 b8 ff 0a 80 00 00 	movabs $0x800aff,%rax
+  803009:	00 00 00 
+  80300c:	ff d0                	call   *%rax
+  80300e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803014:	0f 87 8f 00 00 00    	ja     8030a9 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80301a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80301e:	48 b8 ca 17 80 00 00 	movabs $0x8017ca,%rax
+  803025:	00 00 00 
+  803028:	ff d0                	call   *%rax
+  80302a:	89 c3                	mov    %eax,%ebx
+  80302c:	85 c0                	test   %eax,%eax
+  80302e:	78 55                	js     803085 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803030:	4c 89 e6             	mov    %r12,%rsi
+  803033:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80303a:	00 00 00 
+  80303d:	48 89 df             	mov    %rbx,%rdi
+  803040:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  803047:	00 00 00 
+  80304a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80304c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803053:	ba 00 00 00 00       	mov    $0x0,%edx
+  803058:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80305c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803061:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  803068:	00 00 00 
+  80306b:	ff d0                	call   *%rax
+  80306d:	89 c3                	mov    %eax,%ebx
+  80306f:	85 c0                	test   %eax,%eax
+  803071:	78 1f                	js     803092 <open+0xa3>
+    return fd2num(fd);
+  803073:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803077:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  80307e:	00 00 00 
+  803081:	ff d0                	call   *%rax
+  803083:	89 c3                	mov    %eax,%ebx
+}
+  803085:	89 d8                	mov    %ebx,%eax
+  803087:	48 83 c4 18          	add    $0x18,%rsp
+  80308b:	5b                   	pop    %rbx
+  80308c:	41 5c                	pop    %r12
+  80308e:	41 5d                	pop    %r13
+  803090:	5d                   	pop    %rbp
+  803091:	c3                   	ret
+        fd_close(fd, 0);
+  803092:	be 00 00 00 00       	mov    $0x0,%esi
+  803097:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80309b:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+        return res;
+  8030a7:	eb dc                	jmp    803085 <open+0x96>
+        return -E_BAD_PATH;
+  8030a9:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030ae:	eb d5                	jmp    803085 <open+0x96>
+
+00000000008030b0 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8030b0:	55                   	push   %rbp
+  8030b1:	48 89 e5             	mov    %rsp,%rbp
+  8030b4:	41 56                	push   %r14
+  8030b6:	41 55                	push   %r13
+  8030b8:	41 54                	push   %r12
+  8030ba:	53                   	push   %rbx
+  8030bb:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8030bf:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8030c6:	00 00 00 
+  8030c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8030ce:	49 bd 2a 18 80 00 00 	movabs $0x80182a,%r13
+  8030d5:	00 00 00 
+  8030d8:	49 be ea 27 80 00 00 	movabs $0x8027ea,%r14
+  8030df:	00 00 00 
+  8030e2:	eb 0c                	jmp    8030f0 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8030e4:	83 c3 01             	add    $0x1,%ebx
+  8030e7:	49 83 c4 18          	add    $0x18,%r12
+  8030eb:	83 fb 20             	cmp    $0x20,%ebx
+  8030ee:	74 1d                	je     80310d <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8030f0:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8030f5:	74 ed                	je     8030e4 <file_flush_buffers+0x34>
+  8030f7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8030fb:	89 df                	mov    %ebx,%edi
+  8030fd:	41 ff d5             	call   *%r13
+  803100:	85 c0                	test   %eax,%eax
+  803102:	78 e0                	js     8030e4 <file_flush_buffers+0x34>
+  803104:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803108:	41 ff d6             	call   *%r14
+  80310b:	eb d7                	jmp    8030e4 <file_flush_buffers+0x34>
+}
+  80310d:	48 83 c4 10          	add    $0x10,%rsp
+  803111:	5b                   	pop    %rbx
+  803112:	41 5c                	pop    %r12
+  803114:	41 5d                	pop    %r13
+  803116:	41 5e                	pop    %r14
+  803118:	5d                   	pop    %rbp
+  803119:	c3                   	ret
+
+000000000080311a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80311a:	55                   	push   %rbp
+  80311b:	48 89 e5             	mov    %rsp,%rbp
+  80311e:	41 54                	push   %r12
+  803120:	53                   	push   %rbx
+  803121:	49 89 fc             	mov    %rdi,%r12
+  803124:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803126:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  80312d:	00 00 00 
+  803130:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803132:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803139:	00 00 00 
+  80313c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803141:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803143:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803146:	ba 00 00 00 00       	mov    $0x0,%edx
+  80314b:	be 00 00 00 00       	mov    $0x0,%esi
+  803150:	bf 02 00 00 00       	mov    $0x2,%edi
+  803155:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+}
+  803161:	5b                   	pop    %rbx
+  803162:	41 5c                	pop    %r12
+  803164:	5d                   	pop    %rbp
+  803165:	c3                   	ret
+
+0000000000803166 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803166:	55                   	push   %rbp
+  803167:	48 89 e5             	mov    %rsp,%rbp
+  80316a:	41 54                	push   %r12
+  80316c:	53                   	push   %rbx
+  80316d:	49 89 fc             	mov    %rdi,%r12
+  803170:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803173:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  80317a:	00 00 00 
+  80317d:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80317f:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803184:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80318b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80318d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803192:	be 00 00 00 00       	mov    $0x0,%esi
+  803197:	bf 05 00 00 00       	mov    $0x5,%edi
+  80319c:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  8031a3:	00 00 00 
+  8031a6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031a8:	85 c0                	test   %eax,%eax
+  8031aa:	78 3d                	js     8031e9 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8031ac:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8031b3:	00 00 00 
+  8031b6:	4c 89 e6             	mov    %r12,%rsi
+  8031b9:	48 89 df             	mov    %rbx,%rdi
+  8031bc:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8031c8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8031cf:	00 
+  8031d0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8031d6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8031dd:	00 
+  8031de:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8031e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8031e9:	5b                   	pop    %rbx
+  8031ea:	41 5c                	pop    %r12
+  8031ec:	5d                   	pop    %rbp
+  8031ed:	c3                   	ret
+
+00000000008031ee <remove>:
+remove(const char *path) {
+  8031ee:	55                   	push   %rbp
+  8031ef:	48 89 e5             	mov    %rsp,%rbp
+  8031f2:	53                   	push   %rbx
+  8031f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8031f7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031fa:	48 b8 ff 0a 80 00 00 	movabs $0x800aff,%rax
+  803201:	00 00 00 
+  803204:	ff d0                	call   *%rax
+  803206:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80320c:	77 3a                	ja     803248 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80320e:	48 89 de             	mov    %rbx,%rsi
+  803211:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803218:	00 00 00 
+  80321b:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  803222:	00 00 00 
+  803225:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803227:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322c:	be 00 00 00 00       	mov    $0x0,%esi
+  803231:	bf 07 00 00 00       	mov    $0x7,%edi
+  803236:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80323d:	00 00 00 
+  803240:	ff d0                	call   *%rax
+}
+  803242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803246:	c9                   	leave
+  803247:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803248:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80324d:	eb f3                	jmp    803242 <remove+0x54>
+
+000000000080324f <sync>:
+sync(void) {
+  80324f:	55                   	push   %rbp
+  803250:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803253:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  80325a:	00 00 00 
+  80325d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80325f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803264:	be 00 00 00 00       	mov    $0x0,%esi
+  803269:	bf 08 00 00 00       	mov    $0x8,%edi
+  80326e:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+}
+  80327a:	5d                   	pop    %rbp
+  80327b:	c3                   	ret
+
+000000000080327c <fsync>:
+fsync(int fdnum) {
+  80327c:	55                   	push   %rbp
+  80327d:	48 89 e5             	mov    %rsp,%rbp
+  803280:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803284:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803288:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  80328f:	00 00 00 
+  803292:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803294:	85 c0                	test   %eax,%eax
+  803296:	78 4b                	js     8032e3 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803298:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80329c:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8032a3:	00 00 00 
+  8032a6:	8b 00                	mov    (%rax),%eax
+  8032a8:	39 02                	cmp    %eax,(%rdx)
+  8032aa:	75 39                	jne    8032e5 <fsync+0x69>
+    file_flush_buffers();
+  8032ac:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8032b8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032bc:	8b 40 0c             	mov    0xc(%rax),%eax
+  8032bf:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032c6:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8032c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032cd:	be 00 00 00 00       	mov    $0x0,%esi
+  8032d2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8032d7:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  8032de:	00 00 00 
+  8032e1:	ff d0                	call   *%rax
+}
+  8032e3:	c9                   	leave
+  8032e4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8032e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8032ea:	eb f7                	jmp    8032e3 <fsync+0x67>
+
+00000000008032ec <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8032ec:	55                   	push   %rbp
+  8032ed:	48 89 e5             	mov    %rsp,%rbp
+  8032f0:	53                   	push   %rbx
+  8032f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8032f5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8032f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032fd:	be 00 00 00 00       	mov    $0x0,%esi
+  803302:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803307:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 2d                	js     803344 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803317:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80331e:	00 00 00 
+  803321:	48 8b 10             	mov    (%rax),%rdx
+  803324:	48 89 13             	mov    %rdx,(%rbx)
+  803327:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80332b:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80332f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803333:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803337:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80333b:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80333f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803344:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803348:	c9                   	leave
+  803349:	c3                   	ret
+
+000000000080334a <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80334a:	55                   	push   %rbp
+  80334b:	48 89 e5             	mov    %rsp,%rbp
+  80334e:	53                   	push   %rbx
+  80334f:	48 83 ec 08          	sub    $0x8,%rsp
+  803353:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80335b:	be 00 00 00 00       	mov    $0x0,%esi
+  803360:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803365:	48 b8 81 25 80 00 00 	movabs $0x802581,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803371:	85 c0                	test   %eax,%eax
+  803373:	78 3d                	js     8033b2 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803375:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80337c:	00 00 00 
+  80337f:	48 8b 10             	mov    (%rax),%rdx
+  803382:	48 89 13             	mov    %rdx,(%rbx)
+  803385:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803389:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80338d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803391:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803395:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803399:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80339d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8033a1:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8033a5:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8033a9:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8033ad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033b2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033b6:	c9                   	leave
+  8033b7:	c3                   	ret
+
+00000000008033b8 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8033b8:	55                   	push   %rbp
+  8033b9:	48 89 e5             	mov    %rsp,%rbp
+  8033bc:	41 57                	push   %r15
+  8033be:	41 56                	push   %r14
+  8033c0:	41 55                	push   %r13
+  8033c2:	41 54                	push   %r12
+  8033c4:	53                   	push   %rbx
+  8033c5:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8033c9:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8033d0:	00 
+  8033d1:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033d8:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8033de:	0f 85 43 01 00 00    	jne    803527 <munmap+0x16f>
+  8033e4:	49 89 ff             	mov    %rdi,%r15
+  8033e7:	4c 39 f7             	cmp    %r14,%rdi
+  8033ea:	0f 87 37 01 00 00    	ja     803527 <munmap+0x16f>
+  8033f0:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8033f7:	00 00 00 
+  8033fa:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803400:	eb 2c                	jmp    80342e <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803402:	4c 39 f8             	cmp    %r15,%rax
+  803405:	0f 83 85 00 00 00    	jae    803490 <munmap+0xd8>
+            m->mm_end = start;
+  80340b:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803410:	48 83 c3 18          	add    $0x18,%rbx
+  803414:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80341b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803422:	00 00 00 
+  803425:	48 39 c3             	cmp    %rax,%rbx
+  803428:	0f 84 d0 00 00 00    	je     8034fe <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80342e:	49 89 dc             	mov    %rbx,%r12
+  803431:	48 8b 03             	mov    (%rbx),%rax
+  803434:	4c 39 f0             	cmp    %r14,%rax
+  803437:	73 d7                	jae    803410 <munmap+0x58>
+  803439:	48 85 c0             	test   %rax,%rax
+  80343c:	74 d2                	je     803410 <munmap+0x58>
+  80343e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803442:	49 39 d7             	cmp    %rdx,%r15
+  803445:	73 c9                	jae    803410 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803447:	49 39 d6             	cmp    %rdx,%r14
+  80344a:	73 b6                	jae    803402 <munmap+0x4a>
+  80344c:	49 39 c7             	cmp    %rax,%r15
+  80344f:	76 b1                	jbe    803402 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803451:	4c 89 ef             	mov    %r13,%rdi
+  803454:	48 b8 ef 24 80 00 00 	movabs $0x8024ef,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803460:	48 85 c0             	test   %rax,%rax
+  803463:	0f 84 c5 00 00 00    	je     80352e <munmap+0x176>
+            *tail = *m;
+  803469:	48 8b 13             	mov    (%rbx),%rdx
+  80346c:	48 89 10             	mov    %rdx,(%rax)
+  80346f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803473:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803477:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80347b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80347f:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803482:	44 89 f2             	mov    %r14d,%edx
+  803485:	2b 13                	sub    (%rbx),%edx
+  803487:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80348a:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80348e:	eb 80                	jmp    803410 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803490:	49 39 d6             	cmp    %rdx,%r14
+  803493:	73 18                	jae    8034ad <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803495:	44 89 f2             	mov    %r14d,%edx
+  803498:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80349d:	29 c2                	sub    %eax,%edx
+  80349f:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8034a4:	4d 89 34 24          	mov    %r14,(%r12)
+  8034a8:	e9 63 ff ff ff       	jmp    803410 <munmap+0x58>
+    m->mm_start = 0;
+  8034ad:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8034b4:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8034b5:	4c 89 e6             	mov    %r12,%rsi
+  8034b8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8034bf:	00 00 00 
+  8034c2:	48 29 c6             	sub    %rax,%rsi
+  8034c5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8034c9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8034d0:	aa aa aa 
+  8034d3:	48 0f af f0          	imul   %rax,%rsi
+  8034d7:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8034db:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8034e0:	48 01 c6             	add    %rax,%rsi
+  8034e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8034e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8034ed:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  8034f4:	00 00 00 
+  8034f7:	ff d0                	call   *%rax
+}
+  8034f9:	e9 12 ff ff ff       	jmp    803410 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8034fe:	4c 89 f2             	mov    %r14,%rdx
+  803501:	4c 29 fa             	sub    %r15,%rdx
+  803504:	4c 89 fe             	mov    %r15,%rsi
+  803507:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350c:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  803513:	00 00 00 
+  803516:	ff d0                	call   *%rax
+}
+  803518:	48 83 c4 08          	add    $0x8,%rsp
+  80351c:	5b                   	pop    %rbx
+  80351d:	41 5c                	pop    %r12
+  80351f:	41 5d                	pop    %r13
+  803521:	41 5e                	pop    %r14
+  803523:	41 5f                	pop    %r15
+  803525:	5d                   	pop    %rbp
+  803526:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803527:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80352c:	eb ea                	jmp    803518 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80352e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803533:	eb e3                	jmp    803518 <munmap+0x160>
+
+0000000000803535 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803535:	55                   	push   %rbp
+  803536:	48 89 e5             	mov    %rsp,%rbp
+  803539:	41 57                	push   %r15
+  80353b:	41 56                	push   %r14
+  80353d:	41 55                	push   %r13
+  80353f:	41 54                	push   %r12
+  803541:	53                   	push   %rbx
+  803542:	48 83 ec 28          	sub    $0x28,%rsp
+  803546:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80354a:	49 89 f5             	mov    %rsi,%r13
+  80354d:	41 89 d6             	mov    %edx,%r14d
+  803550:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803553:	41 89 cc             	mov    %ecx,%r12d
+  803556:	44 89 c7             	mov    %r8d,%edi
+  803559:	44 89 cb             	mov    %r9d,%ebx
+  80355c:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803560:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803564:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  80356b:	00 00 00 
+  80356e:	ff d0                	call   *%rax
+  803570:	41 89 c7             	mov    %eax,%r15d
+  803573:	85 c0                	test   %eax,%eax
+  803575:	0f 88 ae 01 00 00    	js     803729 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80357b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80357f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803586:	00 00 00 
+  803589:	8b 32                	mov    (%rdx),%esi
+  80358b:	39 30                	cmp    %esi,(%rax)
+  80358d:	0f 85 7a 02 00 00    	jne    80380d <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803593:	8b 40 08             	mov    0x8(%rax),%eax
+  803596:	83 e0 03             	and    $0x3,%eax
+  803599:	83 f8 01             	cmp    $0x1,%eax
+  80359c:	0f 84 76 02 00 00    	je     803818 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8035a2:	4d 85 ed             	test   %r13,%r13
+  8035a5:	0f 84 78 02 00 00    	je     803823 <mmap+0x2ee>
+  8035ab:	85 db                	test   %ebx,%ebx
+  8035ad:	0f 88 70 02 00 00    	js     803823 <mmap+0x2ee>
+  8035b3:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035b9:	41 89 df             	mov    %ebx,%r15d
+  8035bc:	0f 85 6c 02 00 00    	jne    80382e <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8035c2:	44 89 f0             	mov    %r14d,%eax
+  8035c5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8035c8:	83 f8 04             	cmp    $0x4,%eax
+  8035cb:	0f 85 68 02 00 00    	jne    803839 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8035d1:	44 89 e1             	mov    %r12d,%ecx
+  8035d4:	83 e1 01             	and    $0x1,%ecx
+  8035d7:	0f 95 c2             	setne  %dl
+  8035da:	44 89 e0             	mov    %r12d,%eax
+  8035dd:	d1 e8                	shr    %eax
+  8035df:	83 f0 01             	xor    $0x1,%eax
+  8035e2:	83 e0 01             	and    $0x1,%eax
+  8035e5:	38 c2                	cmp    %al,%dl
+  8035e7:	0f 85 57 02 00 00    	jne    803844 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8035ed:	85 c9                	test   %ecx,%ecx
+  8035ef:	74 0a                	je     8035fb <mmap+0xc6>
+  8035f1:	41 f6 c6 02          	test   $0x2,%r14b
+  8035f5:	0f 85 54 02 00 00    	jne    80384f <mmap+0x31a>
+    file_flush_buffers();
+  8035fb:	48 b8 b0 30 80 00 00 	movabs $0x8030b0,%rax
+  803602:	00 00 00 
+  803605:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803607:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80360e:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803615:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803619:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80361c:	41 f6 c4 04          	test   $0x4,%r12b
+  803620:	0f 84 15 01 00 00    	je     80373b <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803626:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803629:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80362f:	0f 85 25 02 00 00    	jne    80385a <mmap+0x325>
+  803635:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803639:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803640:	00 00 00 
+  803643:	48 39 c2             	cmp    %rax,%rdx
+  803646:	0f 82 19 02 00 00    	jb     803865 <mmap+0x330>
+  80364c:	48 39 c7             	cmp    %rax,%rdi
+  80364f:	0f 87 10 02 00 00    	ja     803865 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803655:	4c 89 ee             	mov    %r13,%rsi
+  803658:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  80365f:	00 00 00 
+  803662:	ff d0                	call   *%rax
+  803664:	85 c0                	test   %eax,%eax
+  803666:	0f 88 04 02 00 00    	js     803870 <mmap+0x33b>
+    if (!handler) {
+  80366c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803673:	00 00 00 
+  803676:	80 38 00             	cmpb   $0x0,(%rax)
+  803679:	75 2b                	jne    8036a6 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80367b:	48 bf 50 24 80 00 00 	movabs $0x802450,%rdi
+  803682:	00 00 00 
+  803685:	48 b8 59 15 80 00 00 	movabs $0x801559,%rax
+  80368c:	00 00 00 
+  80368f:	ff d0                	call   *%rax
+  803691:	85 c0                	test   %eax,%eax
+  803693:	0f 88 ea 01 00 00    	js     803883 <mmap+0x34e>
+        handler = 1;
+  803699:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8036a0:	00 00 00 
+  8036a3:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8036a6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036aa:	48 b8 ef 24 80 00 00 	movabs $0x8024ef,%rax
+  8036b1:	00 00 00 
+  8036b4:	ff d0                	call   *%rax
+  8036b6:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8036b9:	48 85 c0             	test   %rax,%rax
+  8036bc:	0f 84 c9 01 00 00    	je     80388b <mmap+0x356>
+    m->mm_start = va;
+  8036c2:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8036c5:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8036c9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8036cd:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8036d0:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8036d4:	44 89 e0             	mov    %r12d,%eax
+  8036d7:	c1 e0 06             	shl    $0x6,%eax
+  8036da:	25 80 00 00 00       	and    $0x80,%eax
+  8036df:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8036e2:	09 f0                	or     %esi,%eax
+  8036e4:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8036e8:	41 f6 c4 08          	test   $0x8,%r12b
+  8036ec:	74 31                	je     80371f <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8036ee:	48 39 d3             	cmp    %rdx,%rbx
+  8036f1:	73 2c                	jae    80371f <mmap+0x1ea>
+  8036f3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8036f8:	48 89 de             	mov    %rbx,%rsi
+  8036fb:	4c 89 f7             	mov    %r14,%rdi
+  8036fe:	48 b8 3f 23 80 00 00 	movabs $0x80233f,%rax
+  803705:	00 00 00 
+  803708:	ff d0                	call   *%rax
+  80370a:	49 89 c4             	mov    %rax,%r12
+  80370d:	48 85 c0             	test   %rax,%rax
+  803710:	0f 8e d7 00 00 00    	jle    8037ed <mmap+0x2b8>
+            va += n;
+  803716:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803719:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80371d:	72 d4                	jb     8036f3 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80371f:	49 8b 06             	mov    (%r14),%rax
+  803722:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803726:	48 89 06             	mov    %rax,(%rsi)
+}
+  803729:	44 89 f8             	mov    %r15d,%eax
+  80372c:	48 83 c4 28          	add    $0x28,%rsp
+  803730:	5b                   	pop    %rbx
+  803731:	41 5c                	pop    %r12
+  803733:	41 5d                	pop    %r13
+  803735:	41 5e                	pop    %r14
+  803737:	41 5f                	pop    %r15
+  803739:	5d                   	pop    %rbp
+  80373a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80373b:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803742:	00 00 00 
+  803745:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803748:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80374f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803752:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803757:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80375e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803761:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803768:	00 00 00 
+  80376b:	48 39 d7             	cmp    %rdx,%rdi
+  80376e:	73 1c                	jae    80378c <mmap+0x257>
+        return -E_NO_MEM;
+  803770:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803776:	eb b1                	jmp    803729 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803778:	48 83 c0 01          	add    $0x1,%rax
+  80377c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803780:	77 3f                	ja     8037c1 <mmap+0x28c>
+  803782:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803787:	48 39 d7             	cmp    %rdx,%rdi
+  80378a:	72 2a                	jb     8037b6 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80378c:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803790:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803794:	48 39 d1             	cmp    %rdx,%rcx
+  803797:	73 df                	jae    803778 <mmap+0x243>
+  803799:	48 85 c9             	test   %rcx,%rcx
+  80379c:	74 da                	je     803778 <mmap+0x243>
+  80379e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8037a2:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8037a7:	48 39 d3             	cmp    %rdx,%rbx
+  8037aa:	73 cc                	jae    803778 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8037ac:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8037af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037b4:	eb cc                	jmp    803782 <mmap+0x24d>
+        return -E_NO_MEM;
+  8037b6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037bc:	e9 68 ff ff ff       	jmp    803729 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8037c1:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8037c6:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8037cd:	00 00 00 
+  8037d0:	48 39 c2             	cmp    %rax,%rdx
+  8037d3:	0f 82 9f 00 00 00    	jb     803878 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8037d9:	48 85 db             	test   %rbx,%rbx
+  8037dc:	0f 85 8a fe ff ff    	jne    80366c <mmap+0x137>
+        return -E_NO_MEM;
+  8037e2:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037e8:	e9 3c ff ff ff       	jmp    803729 <mmap+0x1f4>
+        if (n < 0) {
+  8037ed:	0f 89 2c ff ff ff    	jns    80371f <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8037f3:	49 8b 3e             	mov    (%r14),%rdi
+  8037f6:	4c 89 ee             	mov    %r13,%rsi
+  8037f9:	48 b8 b8 33 80 00 00 	movabs $0x8033b8,%rax
+  803800:	00 00 00 
+  803803:	ff d0                	call   *%rax
+            return n;
+  803805:	45 89 e7             	mov    %r12d,%r15d
+  803808:	e9 1c ff ff ff       	jmp    803729 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80380d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803813:	e9 11 ff ff ff       	jmp    803729 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803818:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80381e:	e9 06 ff ff ff       	jmp    803729 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803823:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803829:	e9 fb fe ff ff       	jmp    803729 <mmap+0x1f4>
+  80382e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803834:	e9 f0 fe ff ff       	jmp    803729 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803839:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80383f:	e9 e5 fe ff ff       	jmp    803729 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803844:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80384a:	e9 da fe ff ff       	jmp    803729 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80384f:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803855:	e9 cf fe ff ff       	jmp    803729 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80385a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803860:	e9 c4 fe ff ff       	jmp    803729 <mmap+0x1f4>
+  803865:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80386b:	e9 b9 fe ff ff       	jmp    803729 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803870:	41 89 c7             	mov    %eax,%r15d
+  803873:	e9 b1 fe ff ff       	jmp    803729 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803878:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80387e:	e9 a6 fe ff ff       	jmp    803729 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803883:	41 89 c7             	mov    %eax,%r15d
+  803886:	e9 9e fe ff ff       	jmp    803729 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80388b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803891:	e9 93 fe ff ff       	jmp    803729 <mmap+0x1f4>
+
+0000000000803896 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803896:	55                   	push   %rbp
+  803897:	48 89 e5             	mov    %rsp,%rbp
+  80389a:	41 54                	push   %r12
+  80389c:	53                   	push   %rbx
+  80389d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038a0:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8038a7:	00 00 00 
+  8038aa:	ff d0                	call   *%rax
+  8038ac:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8038af:	48 be e0 4d 80 00 00 	movabs $0x804de0,%rsi
+  8038b6:	00 00 00 
+  8038b9:	48 89 df             	mov    %rbx,%rdi
+  8038bc:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  8038c3:	00 00 00 
+  8038c6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8038c8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8038cd:	41 2b 04 24          	sub    (%r12),%eax
+  8038d1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8038d7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8038de:	00 00 00 
+    stat->st_dev = &devpipe;
+  8038e1:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8038e8:	00 00 00 
+  8038eb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8038f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038f7:	5b                   	pop    %rbx
+  8038f8:	41 5c                	pop    %r12
+  8038fa:	5d                   	pop    %rbp
+  8038fb:	c3                   	ret
+
+00000000008038fc <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8038fc:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8038ff:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803905:	8b 17                	mov    (%rdi),%edx
+  803907:	85 d2                	test   %edx,%edx
+  803909:	75 01                	jne    80390c <pipe_wakeup+0x10>
+  80390b:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803913:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803919:	be 00 04 00 00       	mov    $0x400,%esi
+  80391e:	48 b8 28 14 80 00 00 	movabs $0x801428,%rax
+  803925:	00 00 00 
+  803928:	ff d0                	call   *%rax
+}
+  80392a:	5d                   	pop    %rbp
+  80392b:	c3                   	ret
+
+000000000080392c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80392c:	55                   	push   %rbp
+  80392d:	48 89 e5             	mov    %rsp,%rbp
+  803930:	41 55                	push   %r13
+  803932:	41 54                	push   %r12
+  803934:	53                   	push   %rbx
+  803935:	48 83 ec 08          	sub    $0x8,%rsp
+  803939:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80393c:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  803943:	00 00 00 
+  803946:	ff d0                	call   *%rax
+  803948:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80394b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803950:	4c 89 e6             	mov    %r12,%rsi
+  803953:	bf 00 00 00 00       	mov    $0x0,%edi
+  803958:	49 bc 42 11 80 00 00 	movabs $0x801142,%r12
+  80395f:	00 00 00 
+  803962:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803965:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803969:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80396d:	49 bd fc 38 80 00 00 	movabs $0x8038fc,%r13
+  803974:	00 00 00 
+  803977:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80397a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80397e:	48 89 de             	mov    %rbx,%rsi
+  803981:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803984:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803989:	48 89 de             	mov    %rbx,%rsi
+  80398c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803991:	41 ff d4             	call   *%r12
+  803994:	48 83 c4 08          	add    $0x8,%rsp
+  803998:	5b                   	pop    %rbx
+  803999:	41 5c                	pop    %r12
+  80399b:	41 5d                	pop    %r13
+  80399d:	5d                   	pop    %rbp
+  80399e:	c3                   	ret
+
+000000000080399f <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80399f:	55                   	push   %rbp
+  8039a0:	48 89 e5             	mov    %rsp,%rbp
+  8039a3:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039a6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039ab:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039b0:	48 b8 85 10 80 00 00 	movabs $0x801085,%rax
+  8039b7:	00 00 00 
+  8039ba:	ff d0                	call   *%rax
+  8039bc:	85 c0                	test   %eax,%eax
+  8039be:	0f 94 c0             	sete   %al
+  8039c1:	0f b6 c0             	movzbl %al,%eax
+}
+  8039c4:	5d                   	pop    %rbp
+  8039c5:	c3                   	ret
+
+00000000008039c6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039c6:	55                   	push   %rbp
+  8039c7:	48 89 e5             	mov    %rsp,%rbp
+  8039ca:	41 57                	push   %r15
+  8039cc:	41 56                	push   %r14
+  8039ce:	41 55                	push   %r13
+  8039d0:	41 54                	push   %r12
+  8039d2:	53                   	push   %rbx
+  8039d3:	48 83 ec 38          	sub    $0x38,%rsp
+  8039d7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039db:	49 89 f4             	mov    %rsi,%r12
+  8039de:	49 89 d7             	mov    %rdx,%r15
+  8039e1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039e5:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+  8039f1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8039f4:	4d 85 ff             	test   %r15,%r15
+  8039f7:	0f 84 f1 00 00 00    	je     803aee <devpipe_write+0x128>
+  8039fd:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803a01:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803a05:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803a09:	49 bd 9f 39 80 00 00 	movabs $0x80399f,%r13
+  803a10:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a13:	49 bf fc 38 80 00 00 	movabs $0x8038fc,%r15
+  803a1a:	00 00 00 
+  803a1d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a25:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a29:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a2c:	48 63 ce             	movslq %esi,%rcx
+  803a2f:	48 63 03             	movslq (%rbx),%rax
+  803a32:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803a38:	48 39 c1             	cmp    %rax,%rcx
+  803a3b:	72 64                	jb     803aa1 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a3d:	48 89 de             	mov    %rbx,%rsi
+  803a40:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a44:	41 ff d5             	call   *%r13
+  803a47:	85 c0                	test   %eax,%eax
+  803a49:	0f 85 b9 00 00 00    	jne    803b08 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a4f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a53:	4c 89 f7             	mov    %r14,%rdi
+  803a56:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803a59:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a5c:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803a63:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a6a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a70:	8b 03                	mov    (%rbx),%eax
+  803a72:	41 39 c4             	cmp    %eax,%r12d
+  803a75:	75 b2                	jne    803a29 <devpipe_write+0x63>
+  803a77:	48 89 de             	mov    %rbx,%rsi
+  803a7a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a7e:	41 ff d5             	call   *%r13
+  803a81:	85 c0                	test   %eax,%eax
+  803a83:	75 a0                	jne    803a25 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a85:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a8a:	44 89 e6             	mov    %r12d,%esi
+  803a8d:	48 89 df             	mov    %rbx,%rdi
+  803a90:	48 b8 0a 14 80 00 00 	movabs $0x80140a,%rax
+  803a97:	00 00 00 
+  803a9a:	ff d0                	call   *%rax
+  803a9c:	e9 7c ff ff ff       	jmp    803a1d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803aa1:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803aa5:	41 0f b6 38          	movzbl (%r8),%edi
+  803aa9:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ab0:	80 80 80 
+  803ab3:	48 89 c8             	mov    %rcx,%rax
+  803ab6:	48 f7 e2             	mul    %rdx
+  803ab9:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803abd:	48 89 d0             	mov    %rdx,%rax
+  803ac0:	48 c1 e0 08          	shl    $0x8,%rax
+  803ac4:	48 29 d0             	sub    %rdx,%rax
+  803ac7:	48 c1 e0 04          	shl    $0x4,%rax
+  803acb:	48 29 c1             	sub    %rax,%rcx
+  803ace:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ad3:	83 c6 01             	add    $0x1,%esi
+  803ad6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ad9:	49 83 c0 01          	add    $0x1,%r8
+  803add:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803ae1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ae5:	49 39 c0             	cmp    %rax,%r8
+  803ae8:	0f 85 2f ff ff ff    	jne    803a1d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803aee:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803af2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803af6:	48 b8 fc 38 80 00 00 	movabs $0x8038fc,%rax
+  803afd:	00 00 00 
+  803b00:	ff d0                	call   *%rax
+    return n;
+  803b02:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803b06:	eb 05                	jmp    803b0d <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b08:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b0d:	48 83 c4 38          	add    $0x38,%rsp
+  803b11:	5b                   	pop    %rbx
+  803b12:	41 5c                	pop    %r12
+  803b14:	41 5d                	pop    %r13
+  803b16:	41 5e                	pop    %r14
+  803b18:	41 5f                	pop    %r15
+  803b1a:	5d                   	pop    %rbp
+  803b1b:	c3                   	ret
+
+0000000000803b1c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b1c:	55                   	push   %rbp
+  803b1d:	48 89 e5             	mov    %rsp,%rbp
+  803b20:	41 57                	push   %r15
+  803b22:	41 56                	push   %r14
+  803b24:	41 55                	push   %r13
+  803b26:	41 54                	push   %r12
+  803b28:	53                   	push   %rbx
+  803b29:	48 83 ec 28          	sub    $0x28,%rsp
+  803b2d:	49 89 fd             	mov    %rdi,%r13
+  803b30:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803b34:	49 89 d4             	mov    %rdx,%r12
+  803b37:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b3b:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+  803b47:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b4a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803b50:	49 bf 9f 39 80 00 00 	movabs $0x80399f,%r15
+  803b57:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b5a:	4d 85 e4             	test   %r12,%r12
+  803b5d:	0f 84 d5 00 00 00    	je     803c38 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b63:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b67:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b6b:	8b 03                	mov    (%rbx),%eax
+  803b6d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b70:	75 7a                	jne    803bec <devpipe_read+0xd0>
+            if (i > 0) {
+  803b72:	4d 85 f6             	test   %r14,%r14
+  803b75:	75 50                	jne    803bc7 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b77:	48 89 de             	mov    %rbx,%rsi
+  803b7a:	4c 89 ef             	mov    %r13,%rdi
+  803b7d:	41 ff d7             	call   *%r15
+  803b80:	85 c0                	test   %eax,%eax
+  803b82:	0f 85 c9 00 00 00    	jne    803c51 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b88:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803b8b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b92:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b98:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b9b:	41 39 c4             	cmp    %eax,%r12d
+  803b9e:	75 cb                	jne    803b6b <devpipe_read+0x4f>
+  803ba0:	48 89 de             	mov    %rbx,%rsi
+  803ba3:	4c 89 ef             	mov    %r13,%rdi
+  803ba6:	41 ff d7             	call   *%r15
+  803ba9:	85 c0                	test   %eax,%eax
+  803bab:	75 be                	jne    803b6b <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bad:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bb2:	44 89 e6             	mov    %r12d,%esi
+  803bb5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bb9:	48 b8 0a 14 80 00 00 	movabs $0x80140a,%rax
+  803bc0:	00 00 00 
+  803bc3:	ff d0                	call   *%rax
+  803bc5:	eb a4                	jmp    803b6b <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803bc7:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bcb:	48 89 de             	mov    %rbx,%rsi
+  803bce:	48 b8 fc 38 80 00 00 	movabs $0x8038fc,%rax
+  803bd5:	00 00 00 
+  803bd8:	ff d0                	call   *%rax
+                return i;
+  803bda:	4c 89 f0             	mov    %r14,%rax
+}
+  803bdd:	48 83 c4 28          	add    $0x28,%rsp
+  803be1:	5b                   	pop    %rbx
+  803be2:	41 5c                	pop    %r12
+  803be4:	41 5d                	pop    %r13
+  803be6:	41 5e                	pop    %r14
+  803be8:	41 5f                	pop    %r15
+  803bea:	5d                   	pop    %rbp
+  803beb:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803bec:	48 63 c8             	movslq %eax,%rcx
+  803bef:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bf6:	80 80 80 
+  803bf9:	48 89 c8             	mov    %rcx,%rax
+  803bfc:	48 f7 e2             	mul    %rdx
+  803bff:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c03:	48 89 d0             	mov    %rdx,%rax
+  803c06:	48 c1 e0 08          	shl    $0x8,%rax
+  803c0a:	48 29 d0             	sub    %rdx,%rax
+  803c0d:	48 c1 e0 04          	shl    $0x4,%rax
+  803c11:	48 89 c2             	mov    %rax,%rdx
+  803c14:	48 89 c8             	mov    %rcx,%rax
+  803c17:	48 29 d0             	sub    %rdx,%rax
+  803c1a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803c1f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803c23:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803c27:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c2a:	49 83 c6 01          	add    $0x1,%r14
+  803c2e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803c32:	0f 85 2b ff ff ff    	jne    803b63 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c38:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c3c:	48 89 de             	mov    %rbx,%rsi
+  803c3f:	48 b8 fc 38 80 00 00 	movabs $0x8038fc,%rax
+  803c46:	00 00 00 
+  803c49:	ff d0                	call   *%rax
+    return n;
+  803c4b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c4f:	eb 8c                	jmp    803bdd <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c51:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c56:	eb 85                	jmp    803bdd <devpipe_read+0xc1>
+
+0000000000803c58 <pipe>:
+pipe(int pfd[2]) {
+  803c58:	55                   	push   %rbp
+  803c59:	48 89 e5             	mov    %rsp,%rbp
+  803c5c:	41 55                	push   %r13
+  803c5e:	41 54                	push   %r12
+  803c60:	53                   	push   %rbx
+  803c61:	48 83 ec 18          	sub    $0x18,%rsp
+  803c65:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c68:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c6c:	48 b8 ca 17 80 00 00 	movabs $0x8017ca,%rax
+  803c73:	00 00 00 
+  803c76:	ff d0                	call   *%rax
+  803c78:	89 c3                	mov    %eax,%ebx
+  803c7a:	85 c0                	test   %eax,%eax
+  803c7c:	0f 88 a0 01 00 00    	js     803e22 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803c82:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c8c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803c90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c95:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+  803ca1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ca3:	85 c0                	test   %eax,%eax
+  803ca5:	0f 88 77 01 00 00    	js     803e22 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803cab:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803caf:	48 b8 ca 17 80 00 00 	movabs $0x8017ca,%rax
+  803cb6:	00 00 00 
+  803cb9:	ff d0                	call   *%rax
+  803cbb:	89 c3                	mov    %eax,%ebx
+  803cbd:	85 c0                	test   %eax,%eax
+  803cbf:	0f 88 43 01 00 00    	js     803e08 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803cc5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ccf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cd3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cd8:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  803cdf:	00 00 00 
+  803ce2:	ff d0                	call   *%rax
+  803ce4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ce6:	85 c0                	test   %eax,%eax
+  803ce8:	0f 88 1a 01 00 00    	js     803e08 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803cee:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cf2:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  803cf9:	00 00 00 
+  803cfc:	ff d0                	call   *%rax
+  803cfe:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803d01:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d0b:	48 89 c6             	mov    %rax,%rsi
+  803d0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d13:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+  803d1f:	89 c3                	mov    %eax,%ebx
+  803d21:	85 c0                	test   %eax,%eax
+  803d23:	0f 88 c5 00 00 00    	js     803dee <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d29:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d2d:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  803d34:	00 00 00 
+  803d37:	ff d0                	call   *%rax
+  803d39:	48 89 c1             	mov    %rax,%rcx
+  803d3c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d42:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d48:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d4d:	4c 89 ee             	mov    %r13,%rsi
+  803d50:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d55:	48 b8 f2 10 80 00 00 	movabs $0x8010f2,%rax
+  803d5c:	00 00 00 
+  803d5f:	ff d0                	call   *%rax
+  803d61:	89 c3                	mov    %eax,%ebx
+  803d63:	85 c0                	test   %eax,%eax
+  803d65:	78 6e                	js     803dd5 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d67:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d6c:	4c 89 ef             	mov    %r13,%rdi
+  803d6f:	48 b8 61 10 80 00 00 	movabs $0x801061,%rax
+  803d76:	00 00 00 
+  803d79:	ff d0                	call   *%rax
+  803d7b:	83 f8 02             	cmp    $0x2,%eax
+  803d7e:	0f 85 ab 00 00 00    	jne    803e2f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803d84:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803d8b:	00 00 
+  803d8d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d91:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803d93:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803d97:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803d9e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803da2:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803da4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803da8:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803daf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803db3:	48 bb 9c 17 80 00 00 	movabs $0x80179c,%rbx
+  803dba:	00 00 00 
+  803dbd:	ff d3                	call   *%rbx
+  803dbf:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803dc3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803dc7:	ff d3                	call   *%rbx
+  803dc9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803dce:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803dd3:	eb 4d                	jmp    803e22 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803dd5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dda:	4c 89 ee             	mov    %r13,%rsi
+  803ddd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803de2:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  803de9:	00 00 00 
+  803dec:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803dee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803df7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dfc:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  803e03:	00 00 00 
+  803e06:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803e08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e0d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e16:	48 b8 42 11 80 00 00 	movabs $0x801142,%rax
+  803e1d:	00 00 00 
+  803e20:	ff d0                	call   *%rax
+}
+  803e22:	89 d8                	mov    %ebx,%eax
+  803e24:	48 83 c4 18          	add    $0x18,%rsp
+  803e28:	5b                   	pop    %rbx
+  803e29:	41 5c                	pop    %r12
+  803e2b:	41 5d                	pop    %r13
+  803e2d:	5d                   	pop    %rbp
+  803e2e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e2f:	48 b9 f8 4d 80 00 00 	movabs $0x804df8,%rcx
+  803e36:	00 00 00 
+  803e39:	48 ba 18 4d 80 00 00 	movabs $0x804d18,%rdx
+  803e40:	00 00 00 
+  803e43:	be 50 00 00 00       	mov    $0x50,%esi
+  803e48:	48 bf e7 4d 80 00 00 	movabs $0x804de7,%rdi
+  803e4f:	00 00 00 
+  803e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e57:	49 b8 87 44 80 00 00 	movabs $0x804487,%r8
+  803e5e:	00 00 00 
+  803e61:	41 ff d0             	call   *%r8
+
+0000000000803e64 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e64:	55                   	push   %rbp
+  803e65:	48 89 e5             	mov    %rsp,%rbp
+  803e68:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e6c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e70:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  803e77:	00 00 00 
+  803e7a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e7c:	85 c0                	test   %eax,%eax
+  803e7e:	78 23                	js     803ea3 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803e80:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e84:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  803e8b:	00 00 00 
+  803e8e:	ff d0                	call   *%rax
+  803e90:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803e93:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803e97:	48 b8 9f 39 80 00 00 	movabs $0x80399f,%rax
+  803e9e:	00 00 00 
+  803ea1:	ff d0                	call   *%rax
+}
+  803ea3:	c9                   	leave
+  803ea4:	c3                   	ret
+
+0000000000803ea5 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ea5:	48 89 f8             	mov    %rdi,%rax
+  803ea8:	48 c1 e8 27          	shr    $0x27,%rax
+  803eac:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803eb3:	01 00 00 
+  803eb6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803eba:	f6 c2 01             	test   $0x1,%dl
+  803ebd:	74 6d                	je     803f2c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ebf:	48 89 f8             	mov    %rdi,%rax
+  803ec2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ec6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ecd:	01 00 00 
+  803ed0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ed4:	f6 c2 01             	test   $0x1,%dl
+  803ed7:	74 62                	je     803f3b <get_uvpt_entry+0x96>
+  803ed9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ee0:	01 00 00 
+  803ee3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ee7:	f6 c2 80             	test   $0x80,%dl
+  803eea:	75 4f                	jne    803f3b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803eec:	48 89 f8             	mov    %rdi,%rax
+  803eef:	48 c1 e8 15          	shr    $0x15,%rax
+  803ef3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803efa:	01 00 00 
+  803efd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f01:	f6 c2 01             	test   $0x1,%dl
+  803f04:	74 44                	je     803f4a <get_uvpt_entry+0xa5>
+  803f06:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f0d:	01 00 00 
+  803f10:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f14:	f6 c2 80             	test   $0x80,%dl
+  803f17:	75 31                	jne    803f4a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f19:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f1d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803f24:	01 00 00 
+  803f27:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f2b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f2c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f33:	01 00 00 
+  803f36:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f3a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f3b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f42:	01 00 00 
+  803f45:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f49:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f4a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f51:	01 00 00 
+  803f54:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f58:	c3                   	ret
+
+0000000000803f59 <get_prot>:
+
+int
+get_prot(void *va) {
+  803f59:	55                   	push   %rbp
+  803f5a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f5d:	48 b8 a5 3e 80 00 00 	movabs $0x803ea5,%rax
+  803f64:	00 00 00 
+  803f67:	ff d0                	call   *%rax
+  803f69:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f6c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f71:	89 c1                	mov    %eax,%ecx
+  803f73:	83 c9 04             	or     $0x4,%ecx
+  803f76:	f6 c2 01             	test   $0x1,%dl
+  803f79:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803f7c:	89 c1                	mov    %eax,%ecx
+  803f7e:	83 c9 02             	or     $0x2,%ecx
+  803f81:	f6 c2 02             	test   $0x2,%dl
+  803f84:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803f87:	89 c1                	mov    %eax,%ecx
+  803f89:	83 c9 01             	or     $0x1,%ecx
+  803f8c:	48 85 d2             	test   %rdx,%rdx
+  803f8f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803f92:	89 c1                	mov    %eax,%ecx
+  803f94:	83 c9 40             	or     $0x40,%ecx
+  803f97:	f6 c6 04             	test   $0x4,%dh
+  803f9a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803f9d:	5d                   	pop    %rbp
+  803f9e:	c3                   	ret
+
+0000000000803f9f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803f9f:	55                   	push   %rbp
+  803fa0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fa3:	48 b8 a5 3e 80 00 00 	movabs $0x803ea5,%rax
+  803faa:	00 00 00 
+  803fad:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803faf:	48 c1 e8 06          	shr    $0x6,%rax
+  803fb3:	83 e0 01             	and    $0x1,%eax
+}
+  803fb6:	5d                   	pop    %rbp
+  803fb7:	c3                   	ret
+
+0000000000803fb8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fb8:	55                   	push   %rbp
+  803fb9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fbc:	48 b8 a5 3e 80 00 00 	movabs $0x803ea5,%rax
+  803fc3:	00 00 00 
+  803fc6:	ff d0                	call   *%rax
+  803fc8:	83 e0 01             	and    $0x1,%eax
+}
+  803fcb:	5d                   	pop    %rbp
+  803fcc:	c3                   	ret
+
+0000000000803fcd <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803fcd:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803fd4:	01 00 00 
+  803fd7:	a8 01                	test   $0x1,%al
+  803fd9:	75 06                	jne    803fe1 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803fdb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fe0:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803fe1:	55                   	push   %rbp
+  803fe2:	48 89 e5             	mov    %rsp,%rbp
+  803fe5:	41 57                	push   %r15
+  803fe7:	41 56                	push   %r14
+  803fe9:	41 55                	push   %r13
+  803feb:	41 54                	push   %r12
+  803fed:	53                   	push   %rbx
+  803fee:	48 83 ec 28          	sub    $0x28,%rsp
+  803ff2:	49 89 fe             	mov    %rdi,%r14
+  803ff5:	49 89 f7             	mov    %rsi,%r15
+  803ff8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803fff:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804000:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804007:	01 00 00 
+  80400a:	e9 ae 00 00 00       	jmp    8040bd <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80400f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804016:	49 83 ec 01          	sub    $0x1,%r12
+  80401a:	74 2d                	je     804049 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80401c:	48 89 d8             	mov    %rbx,%rax
+  80401f:	48 c1 e8 0c          	shr    $0xc,%rax
+  804023:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804028:	f6 c2 01             	test   $0x1,%dl
+  80402b:	74 e2                	je     80400f <foreach_shared_region+0x42>
+  80402d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804032:	f6 c4 04             	test   $0x4,%ah
+  804035:	74 d8                	je     80400f <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804037:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80403e:	4c 89 fa             	mov    %r15,%rdx
+  804041:	48 89 df             	mov    %rbx,%rdi
+  804044:	41 ff d6             	call   *%r14
+  804047:	eb c6                	jmp    80400f <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804049:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804050:	00 
+  804051:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804056:	74 4a                	je     8040a2 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804058:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80405c:	48 c1 e8 15          	shr    $0x15,%rax
+  804060:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804067:	01 00 00 
+  80406a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80406e:	a8 01                	test   $0x1,%al
+  804070:	74 d7                	je     804049 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804072:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804076:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80407d:	48 39 c3             	cmp    %rax,%rbx
+  804080:	73 c7                	jae    804049 <foreach_shared_region+0x7c>
+  804082:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804089:	48 39 d0             	cmp    %rdx,%rax
+  80408c:	4d 19 e4             	sbb    %r12,%r12
+  80408f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804096:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80409d:	e9 7a ff ff ff       	jmp    80401c <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8040a2:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8040a9:	40 
+  8040aa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040ae:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040b5:	00 00 00 
+  8040b8:	48 39 c1             	cmp    %rax,%rcx
+  8040bb:	74 50                	je     80410d <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8040bd:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8040c1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040c5:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8040cc:	01 00 00 
+  8040cf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040d3:	a8 01                	test   $0x1,%al
+  8040d5:	74 cb                	je     8040a2 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8040d7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040db:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8040e2:	48 39 c1             	cmp    %rax,%rcx
+  8040e5:	73 bb                	jae    8040a2 <foreach_shared_region+0xd5>
+  8040e7:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8040ee:	48 39 d0             	cmp    %rdx,%rax
+  8040f1:	48 19 c0             	sbb    %rax,%rax
+  8040f4:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8040fa:	48 05 00 02 00 00    	add    $0x200,%rax
+  804100:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804104:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804108:	e9 4b ff ff ff       	jmp    804058 <foreach_shared_region+0x8b>
+  80410d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804112:	48 83 c4 28          	add    $0x28,%rsp
+  804116:	5b                   	pop    %rbx
+  804117:	41 5c                	pop    %r12
+  804119:	41 5d                	pop    %r13
+  80411b:	41 5e                	pop    %r14
+  80411d:	41 5f                	pop    %r15
+  80411f:	5d                   	pop    %rbp
+  804120:	c3                   	ret
+
+0000000000804121 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804121:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804127:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80412e:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804135:	c3                   	ret
+
+0000000000804136 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804136:	8b 47 40             	mov    0x40(%rdi),%eax
+  804139:	8b 17                	mov    (%rdi),%edx
+  80413b:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80413d:	83 f8 0f             	cmp    $0xf,%eax
+  804140:	77 13                	ja     804155 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804142:	8b 47 40             	mov    0x40(%rdi),%eax
+  804145:	83 e0 0f             	and    $0xf,%eax
+  804148:	48 c1 e0 09          	shl    $0x9,%rax
+  80414c:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804153:	00 
+  804154:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804155:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80415a:	c3                   	ret
+
+000000000080415b <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80415b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80415e:	83 c0 01             	add    $0x1,%eax
+  804161:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804164:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80416a:	8b 57 04             	mov    0x4(%rdi),%edx
+  80416d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804172:	85 d2                	test   %edx,%edx
+  804174:	75 04                	jne    80417a <chan_publish+0x1f>
+  804176:	83 e0 01             	and    $0x1,%eax
+}
+  804179:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80417a:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80417d:	85 c0                	test   %eax,%eax
+  80417f:	0f 95 c0             	setne  %al
+  804182:	0f b6 c0             	movzbl %al,%eax
+  804185:	eb ef                	jmp    804176 <chan_publish+0x1b>
+
+0000000000804187 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804187:	8b 47 40             	mov    0x40(%rdi),%eax
+  80418a:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80418c:	29 d0                	sub    %edx,%eax
+  80418e:	83 e8 01             	sub    $0x1,%eax
+  804191:	83 f8 0f             	cmp    $0xf,%eax
+  804194:	77 12                	ja     8041a8 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804196:	8b 07                	mov    (%rdi),%eax
+  804198:	83 e0 0f             	and    $0xf,%eax
+  80419b:	48 c1 e0 09          	shl    $0x9,%rax
+  80419f:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8041a6:	00 
+  8041a7:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8041a8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041ad:	c3                   	ret
+
+00000000008041ae <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8041ae:	8b 07                	mov    (%rdi),%eax
+  8041b0:	83 c0 01             	add    $0x1,%eax
+  8041b3:	89 07                	mov    %eax,(%rdi)
+}
+  8041b5:	c3                   	ret
+
+00000000008041b6 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8041b6:	55                   	push   %rbp
+  8041b7:	48 89 e5             	mov    %rsp,%rbp
+  8041ba:	53                   	push   %rbx
+  8041bb:	48 83 ec 08          	sub    $0x8,%rsp
+  8041bf:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8041c2:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8041c9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8041cf:	48 b8 87 41 80 00 00 	movabs $0x804187,%rax
+  8041d6:	00 00 00 
+  8041d9:	ff d0                	call   *%rax
+  8041db:	48 85 c0             	test   %rax,%rax
+  8041de:	74 12                	je     8041f2 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8041e0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8041e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041ec:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8041f0:	c9                   	leave
+  8041f1:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8041f2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8041f7:	eb f3                	jmp    8041ec <chan_arm+0x36>
+
+00000000008041f9 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8041f9:	55                   	push   %rbp
+  8041fa:	48 89 e5             	mov    %rsp,%rbp
+  8041fd:	41 56                	push   %r14
+  8041ff:	41 55                	push   %r13
+  804201:	41 54                	push   %r12
+  804203:	53                   	push   %rbx
+  804204:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804207:	49 bc b6 41 80 00 00 	movabs $0x8041b6,%r12
+  80420e:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804211:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804215:	49 bd 0a 14 80 00 00 	movabs $0x80140a,%r13
+  80421c:	00 00 00 
+    while (chan_arm(r))
+  80421f:	eb 0d                	jmp    80422e <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804221:	8b 33                	mov    (%rbx),%esi
+  804223:	ba 00 00 00 00       	mov    $0x0,%edx
+  804228:	4c 89 f7             	mov    %r14,%rdi
+  80422b:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80422e:	48 89 df             	mov    %rbx,%rdi
+  804231:	41 ff d4             	call   *%r12
+  804234:	84 c0                	test   %al,%al
+  804236:	75 e9                	jne    804221 <chan_wait+0x28>
+}
+  804238:	5b                   	pop    %rbx
+  804239:	41 5c                	pop    %r12
+  80423b:	41 5d                	pop    %r13
+  80423d:	41 5e                	pop    %r14
+  80423f:	5d                   	pop    %rbp
+  804240:	c3                   	ret
+
+0000000000804241 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804241:	55                   	push   %rbp
+  804242:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804245:	48 83 c7 40          	add    $0x40,%rdi
+  804249:	be 01 00 00 00       	mov    $0x1,%esi
+  80424e:	48 b8 28 14 80 00 00 	movabs $0x801428,%rax
+  804255:	00 00 00 
+  804258:	ff d0                	call   *%rax
+}
+  80425a:	5d                   	pop    %rbp
+  80425b:	c3                   	ret
+
+000000000080425c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80425c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804261:	c3                   	ret
+
+0000000000804262 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804262:	55                   	push   %rbp
+  804263:	48 89 e5             	mov    %rsp,%rbp
+  804266:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804269:	48 be 1c 4e 80 00 00 	movabs $0x804e1c,%rsi
+  804270:	00 00 00 
+  804273:	48 b8 3d 0b 80 00 00 	movabs $0x800b3d,%rax
+  80427a:	00 00 00 
+  80427d:	ff d0                	call   *%rax
+    return 0;
+}
+  80427f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804284:	5d                   	pop    %rbp
+  804285:	c3                   	ret
+
+0000000000804286 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804286:	55                   	push   %rbp
+  804287:	48 89 e5             	mov    %rsp,%rbp
+  80428a:	41 57                	push   %r15
+  80428c:	41 56                	push   %r14
+  80428e:	41 55                	push   %r13
+  804290:	41 54                	push   %r12
+  804292:	53                   	push   %rbx
+  804293:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80429a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042a1:	48 85 d2             	test   %rdx,%rdx
+  8042a4:	74 7a                	je     804320 <devcons_write+0x9a>
+  8042a6:	49 89 d6             	mov    %rdx,%r14
+  8042a9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042af:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042b4:	49 bf 37 0d 80 00 00 	movabs $0x800d37,%r15
+  8042bb:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042be:	4c 89 f3             	mov    %r14,%rbx
+  8042c1:	48 29 f3             	sub    %rsi,%rbx
+  8042c4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042c9:	48 39 c3             	cmp    %rax,%rbx
+  8042cc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042d0:	4c 63 eb             	movslq %ebx,%r13
+  8042d3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042da:	48 01 c6             	add    %rax,%rsi
+  8042dd:	4c 89 ea             	mov    %r13,%rdx
+  8042e0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042e7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8042ea:	4c 89 ee             	mov    %r13,%rsi
+  8042ed:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8042f4:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  8042fb:	00 00 00 
+  8042fe:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804300:	41 01 dc             	add    %ebx,%r12d
+  804303:	49 63 f4             	movslq %r12d,%rsi
+  804306:	4c 39 f6             	cmp    %r14,%rsi
+  804309:	72 b3                	jb     8042be <devcons_write+0x38>
+    return res;
+  80430b:	49 63 c4             	movslq %r12d,%rax
+}
+  80430e:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804315:	5b                   	pop    %rbx
+  804316:	41 5c                	pop    %r12
+  804318:	41 5d                	pop    %r13
+  80431a:	41 5e                	pop    %r14
+  80431c:	41 5f                	pop    %r15
+  80431e:	5d                   	pop    %rbp
+  80431f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804320:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804326:	eb e3                	jmp    80430b <devcons_write+0x85>
+
+0000000000804328 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804328:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80432b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804330:	48 85 c0             	test   %rax,%rax
+  804333:	74 55                	je     80438a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804335:	55                   	push   %rbp
+  804336:	48 89 e5             	mov    %rsp,%rbp
+  804339:	41 55                	push   %r13
+  80433b:	41 54                	push   %r12
+  80433d:	53                   	push   %rbx
+  80433e:	48 83 ec 08          	sub    $0x8,%rsp
+  804342:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804345:	48 bb 83 0f 80 00 00 	movabs $0x800f83,%rbx
+  80434c:	00 00 00 
+  80434f:	49 bc 38 10 80 00 00 	movabs $0x801038,%r12
+  804356:	00 00 00 
+  804359:	eb 03                	jmp    80435e <devcons_read+0x36>
+  80435b:	41 ff d4             	call   *%r12
+  80435e:	ff d3                	call   *%rbx
+  804360:	85 c0                	test   %eax,%eax
+  804362:	74 f7                	je     80435b <devcons_read+0x33>
+    if (c < 0) return c;
+  804364:	48 63 d0             	movslq %eax,%rdx
+  804367:	78 13                	js     80437c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80436e:	83 f8 04             	cmp    $0x4,%eax
+  804371:	74 09                	je     80437c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804373:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804377:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80437c:	48 89 d0             	mov    %rdx,%rax
+  80437f:	48 83 c4 08          	add    $0x8,%rsp
+  804383:	5b                   	pop    %rbx
+  804384:	41 5c                	pop    %r12
+  804386:	41 5d                	pop    %r13
+  804388:	5d                   	pop    %rbp
+  804389:	c3                   	ret
+  80438a:	48 89 d0             	mov    %rdx,%rax
+  80438d:	c3                   	ret
+
+000000000080438e <cputchar>:
+cputchar(int ch) {
+  80438e:	55                   	push   %rbp
+  80438f:	48 89 e5             	mov    %rsp,%rbp
+  804392:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804396:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80439a:	be 01 00 00 00       	mov    $0x1,%esi
+  80439f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043a3:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  8043aa:	00 00 00 
+  8043ad:	ff d0                	call   *%rax
+}
+  8043af:	c9                   	leave
+  8043b0:	c3                   	ret
+
+00000000008043b1 <getchar>:
+getchar(void) {
+  8043b1:	55                   	push   %rbp
+  8043b2:	48 89 e5             	mov    %rsp,%rbp
+  8043b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043b9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043be:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043c7:	48 b8 0d 1b 80 00 00 	movabs $0x801b0d,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+  8043d3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043d5:	85 c0                	test   %eax,%eax
+  8043d7:	78 06                	js     8043df <getchar+0x2e>
+  8043d9:	74 08                	je     8043e3 <getchar+0x32>
+  8043db:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8043df:	89 d0                	mov    %edx,%eax
+  8043e1:	c9                   	leave
+  8043e2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8043e3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8043e8:	eb f5                	jmp    8043df <getchar+0x2e>
+
+00000000008043ea <iscons>:
+iscons(int fdnum) {
+  8043ea:	55                   	push   %rbp
+  8043eb:	48 89 e5             	mov    %rsp,%rbp
+  8043ee:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8043f2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8043f6:	48 b8 2a 18 80 00 00 	movabs $0x80182a,%rax
+  8043fd:	00 00 00 
+  804400:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804402:	85 c0                	test   %eax,%eax
+  804404:	78 18                	js     80441e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804406:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80440a:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  804411:	00 00 00 
+  804414:	8b 00                	mov    (%rax),%eax
+  804416:	39 02                	cmp    %eax,(%rdx)
+  804418:	0f 94 c0             	sete   %al
+  80441b:	0f b6 c0             	movzbl %al,%eax
+}
+  80441e:	c9                   	leave
+  80441f:	c3                   	ret
+
+0000000000804420 <opencons>:
+opencons(void) {
+  804420:	55                   	push   %rbp
+  804421:	48 89 e5             	mov    %rsp,%rbp
+  804424:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804428:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80442c:	48 b8 ca 17 80 00 00 	movabs $0x8017ca,%rax
+  804433:	00 00 00 
+  804436:	ff d0                	call   *%rax
+  804438:	85 c0                	test   %eax,%eax
+  80443a:	78 49                	js     804485 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80443c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804441:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804446:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80444a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80444f:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  804456:	00 00 00 
+  804459:	ff d0                	call   *%rax
+  80445b:	85 c0                	test   %eax,%eax
+  80445d:	78 26                	js     804485 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80445f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804463:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80446a:	00 00 
+  80446c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80446e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804472:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804479:	48 b8 9c 17 80 00 00 	movabs $0x80179c,%rax
+  804480:	00 00 00 
+  804483:	ff d0                	call   *%rax
+}
+  804485:	c9                   	leave
+  804486:	c3                   	ret
+
+0000000000804487 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804487:	55                   	push   %rbp
+  804488:	48 89 e5             	mov    %rsp,%rbp
+  80448b:	41 56                	push   %r14
+  80448d:	41 55                	push   %r13
+  80448f:	41 54                	push   %r12
+  804491:	53                   	push   %rbx
+  804492:	48 83 ec 50          	sub    $0x50,%rsp
+  804496:	49 89 fc             	mov    %rdi,%r12
+  804499:	41 89 f5             	mov    %esi,%r13d
+  80449c:	48 89 d3             	mov    %rdx,%rbx
+  80449f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8044a3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8044a7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8044ab:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8044b2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8044ba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8044be:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8044c2:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8044c9:	00 00 00 
+  8044cc:	4c 8b 30             	mov    (%rax),%r14
+  8044cf:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+  8044db:	89 c6                	mov    %eax,%esi
+  8044dd:	45 89 e8             	mov    %r13d,%r8d
+  8044e0:	4c 89 e1             	mov    %r12,%rcx
+  8044e3:	4c 89 f2             	mov    %r14,%rdx
+  8044e6:	48 bf 28 4e 80 00 00 	movabs $0x804e28,%rdi
+  8044ed:	00 00 00 
+  8044f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044f5:	49 bc 18 02 80 00 00 	movabs $0x800218,%r12
+  8044fc:	00 00 00 
+  8044ff:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804502:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804506:	48 89 df             	mov    %rbx,%rdi
+  804509:	48 b8 b4 01 80 00 00 	movabs $0x8001b4,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+    cprintf("\n");
+  804515:	48 bf 8b 4d 80 00 00 	movabs $0x804d8b,%rdi
+  80451c:	00 00 00 
+  80451f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804524:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804527:	cc                   	int3
+  804528:	eb fd                	jmp    804527 <_panic+0xa0>
+
+000000000080452a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80452a:	55                   	push   %rbp
+  80452b:	48 89 e5             	mov    %rsp,%rbp
+  80452e:	41 55                	push   %r13
+  804530:	41 54                	push   %r12
+  804532:	53                   	push   %rbx
+  804533:	48 83 ec 08          	sub    $0x8,%rsp
+  804537:	49 89 fd             	mov    %rdi,%r13
+  80453a:	48 89 f7             	mov    %rsi,%rdi
+  80453d:	48 89 d3             	mov    %rdx,%rbx
+  804540:	49 89 cc             	mov    %rcx,%r12
+  804543:	4c 89 c2             	mov    %r8,%rdx
+  804546:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804549:	48 85 f6             	test   %rsi,%rsi
+  80454c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804553:	00 00 00 
+  804556:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80455a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80455f:	48 85 db             	test   %rbx,%rbx
+  804562:	74 03                	je     804567 <ipc_recv_futex+0x3d>
+  804564:	48 8b 33             	mov    (%rbx),%rsi
+  804567:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80456b:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  804572:	00 00 00 
+  804575:	ff d0                	call   *%rax
+    if (res < 0) {
+  804577:	85 c0                	test   %eax,%eax
+  804579:	78 75                	js     8045f0 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80457b:	4d 85 ed             	test   %r13,%r13
+  80457e:	74 14                	je     804594 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804580:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804587:	00 00 00 
+  80458a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804590:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804594:	4d 85 e4             	test   %r12,%r12
+  804597:	74 14                	je     8045ad <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804599:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045a0:	00 00 00 
+  8045a3:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8045a9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8045ad:	48 85 db             	test   %rbx,%rbx
+  8045b0:	74 23                	je     8045d5 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8045b2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045b9:	00 00 00 
+  8045bc:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8045c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045c7:	85 c9                	test   %ecx,%ecx
+  8045c9:	74 07                	je     8045d2 <ipc_recv_futex+0xa8>
+  8045cb:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8045d2:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8045d5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045dc:	00 00 00 
+  8045df:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045e5:	48 83 c4 08          	add    $0x8,%rsp
+  8045e9:	5b                   	pop    %rbx
+  8045ea:	41 5c                	pop    %r12
+  8045ec:	41 5d                	pop    %r13
+  8045ee:	5d                   	pop    %rbp
+  8045ef:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045f0:	4d 85 ed             	test   %r13,%r13
+  8045f3:	74 08                	je     8045fd <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045f5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045fc:	00 
+        if (perm_store != NULL) {
+  8045fd:	4d 85 e4             	test   %r12,%r12
+  804600:	74 08                	je     80460a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804602:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804609:	00 
+        if (size != NULL) {
+  80460a:	48 85 db             	test   %rbx,%rbx
+  80460d:	74 d6                	je     8045e5 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80460f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804616:	eb cd                	jmp    8045e5 <ipc_recv_futex+0xbb>
+
+0000000000804618 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804618:	55                   	push   %rbp
+  804619:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80461c:	48 83 ec 08          	sub    $0x8,%rsp
+  804620:	6a 00                	push   $0x0
+  804622:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804628:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80462e:	48 b8 2a 45 80 00 00 	movabs $0x80452a,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+}
+  80463a:	c9                   	leave
+  80463b:	c3                   	ret
+
+000000000080463c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80463c:	55                   	push   %rbp
+  80463d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804640:	48 85 d2             	test   %rdx,%rdx
+  804643:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80464a:	00 00 00 
+  80464d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804651:	89 f6                	mov    %esi,%esi
+  804653:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  80465a:	00 00 00 
+  80465d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80465f:	85 c0                	test   %eax,%eax
+  804661:	78 02                	js     804665 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804663:	5d                   	pop    %rbp
+  804664:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804665:	89 c1                	mov    %eax,%ecx
+  804667:	48 ba 4b 4e 80 00 00 	movabs $0x804e4b,%rdx
+  80466e:	00 00 00 
+  804671:	be 50 00 00 00       	mov    $0x50,%esi
+  804676:	48 bf 5f 4e 80 00 00 	movabs $0x804e5f,%rdi
+  80467d:	00 00 00 
+  804680:	b8 00 00 00 00       	mov    $0x0,%eax
+  804685:	49 b8 87 44 80 00 00 	movabs $0x804487,%r8
+  80468c:	00 00 00 
+  80468f:	41 ff d0             	call   *%r8
+
+0000000000804692 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804692:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804697:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80469e:	00 00 00 
+  8046a1:	48 89 d0             	mov    %rdx,%rax
+  8046a4:	48 c1 e0 04          	shl    $0x4,%rax
+  8046a8:	48 29 d0             	sub    %rdx,%rax
+  8046ab:	48 c1 e0 05          	shl    $0x5,%rax
+  8046af:	48 01 c8             	add    %rcx,%rax
+  8046b2:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8046b8:	39 f8                	cmp    %edi,%eax
+  8046ba:	74 13                	je     8046cf <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8046bc:	48 83 c2 01          	add    $0x1,%rdx
+  8046c0:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8046c7:	75 d8                	jne    8046a1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046ce:	c3                   	ret
+            return envs[i].env_id;
+  8046cf:	48 89 d0             	mov    %rdx,%rax
+  8046d2:	48 c1 e0 04          	shl    $0x4,%rax
+  8046d6:	48 29 d0             	sub    %rdx,%rax
+  8046d9:	48 c1 e0 05          	shl    $0x5,%rax
+  8046dd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046e4:	00 00 00 
+  8046e7:	48 01 d0             	add    %rdx,%rax
+  8046ea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046f0:	c3                   	ret
+  8046f1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008046f8 <__rodata_start>:
+  8046f8:	69 20 66 61 75 6c    	imul   $0x6c756166,(%rax),%esp
+  8046fe:	74 65                	je     804765 <__rodata_start+0x6d>
+  804700:	64 20 61 74          	and    %ah,%fs:0x74(%rcx)
+  804704:	20 76 61             	and    %dh,0x61(%rsi)
+  804707:	20 25 6c 78 2c 20    	and    %ah,0x202c786c(%rip)        # 20acbf79 <__bss_end+0x2028af79>
+  80470d:	65 72 72             	gs jb  804782 <__rodata_start+0x8a>
+  804710:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c80518e <__bss_end+0x3bfc418e>
+  804716:	75 6e                	jne    804786 <__rodata_start+0x8e>
+  804718:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80471c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471d:	3e 00 30             	ds add %dh,(%rax)
+  804720:	31 32                	xor    %esi,(%rdx)
+  804722:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804729:	41                   	rex.B
+  80472a:	42                   	rex.X
+  80472b:	43                   	rex.XB
+  80472c:	44                   	rex.R
+  80472d:	45                   	rex.RB
+  80472e:	46 00 30             	rex.RX add %r14b,(%rax)
+  804731:	31 32                	xor    %esi,(%rdx)
+  804733:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80473a:	61                   	(bad)
+  80473b:	62 63 64 65 66       	(bad)
+  804740:	00 28                	add    %ch,(%rax)
+  804742:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804743:	75 6c                	jne    8047b1 <__rodata_start+0xb9>
+  804745:	6c                   	insb   (%dx),%es:(%rdi)
+  804746:	29 00                	sub    %eax,(%rax)
+  804748:	65 72 72             	gs jb  8047bd <__rodata_start+0xc5>
+  80474b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80474c:	72 20                	jb     80476e <__rodata_start+0x76>
+  80474e:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804753:	73 70                	jae    8047c5 <__rodata_start+0xcd>
+  804755:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804759:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804760:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804761:	72 00                	jb     804763 <__rodata_start+0x6b>
+  804763:	62 61 64 20 65       	(bad)
+  804768:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804769:	76 69                	jbe    8047d4 <__rodata_start+0xdc>
+  80476b:	72 6f                	jb     8047dc <__rodata_start+0xe4>
+  80476d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80476e:	6d                   	insl   (%dx),%es:(%rdi)
+  80476f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804771:	74 00                	je     804773 <__rodata_start+0x7b>
+  804773:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80477a:	20 70 61             	and    %dh,0x61(%rax)
+  80477d:	72 61                	jb     8047e0 <__rodata_start+0xe8>
+  80477f:	6d                   	insl   (%dx),%es:(%rdi)
+  804780:	65 74 65             	gs je  8047e8 <__rodata_start+0xf0>
+  804783:	72 00                	jb     804785 <__rodata_start+0x8d>
+  804785:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804786:	75 74                	jne    8047fc <__rodata_start+0x104>
+  804788:	20 6f 66             	and    %ch,0x66(%rdi)
+  80478b:	20 6d 65             	and    %ch,0x65(%rbp)
+  80478e:	6d                   	insl   (%dx),%es:(%rdi)
+  80478f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804790:	72 79                	jb     80480b <__rodata_start+0x113>
+  804792:	00 6f 75             	add    %ch,0x75(%rdi)
+  804795:	74 20                	je     8047b7 <__rodata_start+0xbf>
+  804797:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804798:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80479c:	76 69                	jbe    804807 <__rodata_start+0x10f>
+  80479e:	72 6f                	jb     80480f <__rodata_start+0x117>
+  8047a0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047a1:	6d                   	insl   (%dx),%es:(%rdi)
+  8047a2:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047a4:	74 73                	je     804819 <__rodata_start+0x121>
+  8047a6:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8047a9:	72 72                	jb     80481d <__rodata_start+0x125>
+  8047ab:	75 70                	jne    80481d <__rodata_start+0x125>
+  8047ad:	74 65                	je     804814 <__rodata_start+0x11c>
+  8047af:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8047b4:	75 67                	jne    80481d <__rodata_start+0x125>
+  8047b6:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8047b9:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047bb:	00 73 65             	add    %dh,0x65(%rbx)
+  8047be:	67 6d                	insl   (%dx),%es:(%edi)
+  8047c0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047c2:	74 61                	je     804825 <__rodata_start+0x12d>
+  8047c4:	74 69                	je     80482f <__rodata_start+0x137>
+  8047c6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047c8:	20 66 61             	and    %ah,0x61(%rsi)
+  8047cb:	75 6c                	jne    804839 <__rodata_start+0x141>
+  8047cd:	74 00                	je     8047cf <__rodata_start+0xd7>
+  8047cf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8047d6:	20 45 4c             	and    %al,0x4c(%rbp)
+  8047d9:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8047dd:	61                   	(bad)
+  8047de:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8047e3:	20 73 75             	and    %dh,0x75(%rbx)
+  8047e6:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8047e9:	73 79                	jae    804864 <__rodata_start+0x16c>
+  8047eb:	73 74                	jae    804861 <__rodata_start+0x169>
+  8047ed:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8047ef:	20 63 61             	and    %ah,0x61(%rbx)
+  8047f2:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f3:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f4:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047f7:	74 72                	je     80486b <__rodata_start+0x173>
+  8047f9:	79 20                	jns    80481b <__rodata_start+0x123>
+  8047fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047fc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047fd:	74 20                	je     80481f <__rodata_start+0x127>
+  8047ff:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804801:	75 6e                	jne    804871 <__rodata_start+0x179>
+  804803:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804807:	76 20                	jbe    804829 <__rodata_start+0x131>
+  804809:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804810:	72 65                	jb     804877 <__rodata_start+0x17f>
+  804812:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804815:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804816:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80481a:	65 78 70             	gs js  80488d <__rodata_start+0x195>
+  80481d:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804822:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804825:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804829:	20 66 69             	and    %ah,0x69(%rsi)
+  80482c:	6c                   	insb   (%dx),%es:(%rdi)
+  80482d:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804831:	20 66 72             	and    %ah,0x72(%rsi)
+  804834:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804839:	61                   	(bad)
+  80483a:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80483d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80483e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80483f:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804843:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804846:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804847:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804848:	20 6d 61             	and    %ch,0x61(%rbp)
+  80484b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80484c:	79 20                	jns    80486e <__rodata_start+0x176>
+  80484e:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804855:	72 65                	jb     8048bc <__rodata_start+0x1c4>
+  804857:	20 6f 70             	and    %ch,0x70(%rdi)
+  80485a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80485c:	00 66 69             	add    %ah,0x69(%rsi)
+  80485f:	6c                   	insb   (%dx),%es:(%rdi)
+  804860:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804864:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804867:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804868:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80486b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80486c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80486d:	74 20                	je     80488f <__rodata_start+0x197>
+  80486f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804871:	75 6e                	jne    8048e1 <__rodata_start+0x1e9>
+  804873:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804877:	76 61                	jbe    8048da <__rodata_start+0x1e2>
+  804879:	6c                   	insb   (%dx),%es:(%rdi)
+  80487a:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804881:	00 
+  804882:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804889:	72 65                	jb     8048f0 <__rodata_start+0x1f8>
+  80488b:	61                   	(bad)
+  80488c:	64 79 20             	fs jns 8048af <__rodata_start+0x1b7>
+  80488f:	65 78 69             	gs js  8048fb <__rodata_start+0x203>
+  804892:	73 74                	jae    804908 <__rodata_start+0x210>
+  804894:	73 00                	jae    804896 <__rodata_start+0x19e>
+  804896:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804897:	70 65                	jo     8048fe <__rodata_start+0x206>
+  804899:	72 61                	jb     8048fc <__rodata_start+0x204>
+  80489b:	74 69                	je     804906 <__rodata_start+0x20e>
+  80489d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80489e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80489f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8048a2:	74 20                	je     8048c4 <__rodata_start+0x1cc>
+  8048a4:	73 75                	jae    80491b <__rodata_start+0x223>
+  8048a6:	70 70                	jo     804918 <__rodata_start+0x220>
+  8048a8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048a9:	72 74                	jb     80491f <__rodata_start+0x227>
+  8048ab:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8048b1:	20 61 67             	and    %ah,0x67(%rcx)
+  8048b4:	61                   	(bad)
+  8048b5:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8048bc:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8048c0:	74 00                	je     8048c2 <__rodata_start+0x1ca>
+  8048c2:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8048c9:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8048cc:	20 75 73             	and    %dh,0x73(%rbp)
+  8048cf:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8048d3:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8048da:	00 
+  8048db:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  8048e0:	05 04 80 00 00       	add    $0x8004,%eax
+  8048e5:	00 00                	add    %al,(%rax)
+  8048e7:	00 46 0a             	add    %al,0xa(%rsi)
+  8048ea:	80 00 00             	addb   $0x0,(%rax)
+  8048ed:	00 00                	add    %al,(%rax)
+  8048ef:	00 36                	add    %dh,(%rsi)
+  8048f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048f7:	00 46 0a             	add    %al,0xa(%rsi)
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 46 0a             	add    %al,0xa(%rsi)
+  804902:	80 00 00             	addb   $0x0,(%rax)
+  804905:	00 00                	add    %al,(%rax)
+  804907:	00 46 0a             	add    %al,0xa(%rsi)
+  80490a:	80 00 00             	addb   $0x0,(%rax)
+  80490d:	00 00                	add    %al,(%rax)
+  80490f:	00 46 0a             	add    %al,0xa(%rsi)
+  804912:	80 00 00             	addb   $0x0,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 24 04             	add    %ah,(%rsp,%rax,1)
+  80491a:	80 00 00             	addb   $0x0,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 46 0a             	add    %al,0xa(%rsi)
+  804922:	80 00 00             	addb   $0x0,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 46 0a             	add    %al,0xa(%rsi)
+  80492a:	80 00 00             	addb   $0x0,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 18                	add    %bl,(%rax)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 92 04 80 00 00    	add    %dl,0x8004(%rdx)
+  80493d:	00 00                	add    %al,(%rax)
+  80493f:	00 46 0a             	add    %al,0xa(%rsi)
+  804942:	80 00 00             	addb   $0x0,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 18                	add    %bl,(%rax)
+  804949:	04 80                	add    $0x80,%al
+  80494b:	00 00                	add    %al,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 5e 04             	add    %bl,0x4(%rsi)
+  804952:	80 00 00             	addb   $0x0,(%rax)
+  804955:	00 00                	add    %al,(%rax)
+  804957:	00 5e 04             	add    %bl,0x4(%rsi)
+  80495a:	80 00 00             	addb   $0x0,(%rax)
+  80495d:	00 00                	add    %al,(%rax)
+  80495f:	00 5e 04             	add    %bl,0x4(%rsi)
+  804962:	80 00 00             	addb   $0x0,(%rax)
+  804965:	00 00                	add    %al,(%rax)
+  804967:	00 5e 04             	add    %bl,0x4(%rsi)
+  80496a:	80 00 00             	addb   $0x0,(%rax)
+  80496d:	00 00                	add    %al,(%rax)
+  80496f:	00 5e 04             	add    %bl,0x4(%rsi)
+  804972:	80 00 00             	addb   $0x0,(%rax)
+  804975:	00 00                	add    %al,(%rax)
+  804977:	00 5e 04             	add    %bl,0x4(%rsi)
+  80497a:	80 00 00             	addb   $0x0,(%rax)
+  80497d:	00 00                	add    %al,(%rax)
+  80497f:	00 5e 04             	add    %bl,0x4(%rsi)
+  804982:	80 00 00             	addb   $0x0,(%rax)
+  804985:	00 00                	add    %al,(%rax)
+  804987:	00 5e 04             	add    %bl,0x4(%rsi)
+  80498a:	80 00 00             	addb   $0x0,(%rax)
+  80498d:	00 00                	add    %al,(%rax)
+  80498f:	00 5e 04             	add    %bl,0x4(%rsi)
+  804992:	80 00 00             	addb   $0x0,(%rax)
+  804995:	00 00                	add    %al,(%rax)
+  804997:	00 46 0a             	add    %al,0xa(%rsi)
+  80499a:	80 00 00             	addb   $0x0,(%rax)
+  80499d:	00 00                	add    %al,(%rax)
+  80499f:	00 46 0a             	add    %al,0xa(%rsi)
+  8049a2:	80 00 00             	addb   $0x0,(%rax)
+  8049a5:	00 00                	add    %al,(%rax)
+  8049a7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049aa:	80 00 00             	addb   $0x0,(%rax)
+  8049ad:	00 00                	add    %al,(%rax)
+  8049af:	00 46 0a             	add    %al,0xa(%rsi)
+  8049b2:	80 00 00             	addb   $0x0,(%rax)
+  8049b5:	00 00                	add    %al,(%rax)
+  8049b7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049ba:	80 00 00             	addb   $0x0,(%rax)
+  8049bd:	00 00                	add    %al,(%rax)
+  8049bf:	00 46 0a             	add    %al,0xa(%rsi)
+  8049c2:	80 00 00             	addb   $0x0,(%rax)
+  8049c5:	00 00                	add    %al,(%rax)
+  8049c7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049ca:	80 00 00             	addb   $0x0,(%rax)
+  8049cd:	00 00                	add    %al,(%rax)
+  8049cf:	00 46 0a             	add    %al,0xa(%rsi)
+  8049d2:	80 00 00             	addb   $0x0,(%rax)
+  8049d5:	00 00                	add    %al,(%rax)
+  8049d7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049da:	80 00 00             	addb   $0x0,(%rax)
+  8049dd:	00 00                	add    %al,(%rax)
+  8049df:	00 46 0a             	add    %al,0xa(%rsi)
+  8049e2:	80 00 00             	addb   $0x0,(%rax)
+  8049e5:	00 00                	add    %al,(%rax)
+  8049e7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049ea:	80 00 00             	addb   $0x0,(%rax)
+  8049ed:	00 00                	add    %al,(%rax)
+  8049ef:	00 46 0a             	add    %al,0xa(%rsi)
+  8049f2:	80 00 00             	addb   $0x0,(%rax)
+  8049f5:	00 00                	add    %al,(%rax)
+  8049f7:	00 46 0a             	add    %al,0xa(%rsi)
+  8049fa:	80 00 00             	addb   $0x0,(%rax)
+  8049fd:	00 00                	add    %al,(%rax)
+  8049ff:	00 46 0a             	add    %al,0xa(%rsi)
+  804a02:	80 00 00             	addb   $0x0,(%rax)
+  804a05:	00 00                	add    %al,(%rax)
+  804a07:	00 46 0a             	add    %al,0xa(%rsi)
+  804a0a:	80 00 00             	addb   $0x0,(%rax)
+  804a0d:	00 00                	add    %al,(%rax)
+  804a0f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a12:	80 00 00             	addb   $0x0,(%rax)
+  804a15:	00 00                	add    %al,(%rax)
+  804a17:	00 46 0a             	add    %al,0xa(%rsi)
+  804a1a:	80 00 00             	addb   $0x0,(%rax)
+  804a1d:	00 00                	add    %al,(%rax)
+  804a1f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a22:	80 00 00             	addb   $0x0,(%rax)
+  804a25:	00 00                	add    %al,(%rax)
+  804a27:	00 46 0a             	add    %al,0xa(%rsi)
+  804a2a:	80 00 00             	addb   $0x0,(%rax)
+  804a2d:	00 00                	add    %al,(%rax)
+  804a2f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a32:	80 00 00             	addb   $0x0,(%rax)
+  804a35:	00 00                	add    %al,(%rax)
+  804a37:	00 46 0a             	add    %al,0xa(%rsi)
+  804a3a:	80 00 00             	addb   $0x0,(%rax)
+  804a3d:	00 00                	add    %al,(%rax)
+  804a3f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a42:	80 00 00             	addb   $0x0,(%rax)
+  804a45:	00 00                	add    %al,(%rax)
+  804a47:	00 46 0a             	add    %al,0xa(%rsi)
+  804a4a:	80 00 00             	addb   $0x0,(%rax)
+  804a4d:	00 00                	add    %al,(%rax)
+  804a4f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a52:	80 00 00             	addb   $0x0,(%rax)
+  804a55:	00 00                	add    %al,(%rax)
+  804a57:	00 46 0a             	add    %al,0xa(%rsi)
+  804a5a:	80 00 00             	addb   $0x0,(%rax)
+  804a5d:	00 00                	add    %al,(%rax)
+  804a5f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a62:	80 00 00             	addb   $0x0,(%rax)
+  804a65:	00 00                	add    %al,(%rax)
+  804a67:	00 46 0a             	add    %al,0xa(%rsi)
+  804a6a:	80 00 00             	addb   $0x0,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a72:	80 00 00             	addb   $0x0,(%rax)
+  804a75:	00 00                	add    %al,(%rax)
+  804a77:	00 46 0a             	add    %al,0xa(%rsi)
+  804a7a:	80 00 00             	addb   $0x0,(%rax)
+  804a7d:	00 00                	add    %al,(%rax)
+  804a7f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a82:	80 00 00             	addb   $0x0,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 69 09             	add    %ch,0x9(%rcx)
+  804a8a:	80 00 00             	addb   $0x0,(%rax)
+  804a8d:	00 00                	add    %al,(%rax)
+  804a8f:	00 46 0a             	add    %al,0xa(%rsi)
+  804a92:	80 00 00             	addb   $0x0,(%rax)
+  804a95:	00 00                	add    %al,(%rax)
+  804a97:	00 46 0a             	add    %al,0xa(%rsi)
+  804a9a:	80 00 00             	addb   $0x0,(%rax)
+  804a9d:	00 00                	add    %al,(%rax)
+  804a9f:	00 46 0a             	add    %al,0xa(%rsi)
+  804aa2:	80 00 00             	addb   $0x0,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 46 0a             	add    %al,0xa(%rsi)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 46 0a             	add    %al,0xa(%rsi)
+  804ab2:	80 00 00             	addb   $0x0,(%rax)
+  804ab5:	00 00                	add    %al,(%rax)
+  804ab7:	00 46 0a             	add    %al,0xa(%rsi)
+  804aba:	80 00 00             	addb   $0x0,(%rax)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 46 0a             	add    %al,0xa(%rsi)
+  804ac2:	80 00 00             	addb   $0x0,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 46 0a             	add    %al,0xa(%rsi)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 46 0a             	add    %al,0xa(%rsi)
+  804ad2:	80 00 00             	addb   $0x0,(%rax)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 46 0a             	add    %al,0xa(%rsi)
+  804ada:	80 00 00             	addb   $0x0,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 b5 04 80 00 00    	add    %dh,0x8004(%rbp)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 84 06 80 00 00 00 	add    %al,0x80(%rsi,%rax,1)
+  804aee:	00 00                	add    %al,(%rax)
+  804af0:	46 0a 80 00 00 00 00 	rex.RX or 0x0(%rax),%r8b
+  804af7:	00 46 0a             	add    %al,0xa(%rsi)
+  804afa:	80 00 00             	addb   $0x0,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 46 0a             	add    %al,0xa(%rsi)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 46 0a             	add    %al,0xa(%rsi)
+  804b0a:	80 00 00             	addb   $0x0,(%rax)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 e4                	add    %ah,%ah
+  804b11:	04 80                	add    $0x80,%al
+  804b13:	00 00                	add    %al,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 46 0a             	add    %al,0xa(%rsi)
+  804b1a:	80 00 00             	addb   $0x0,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 46 0a             	add    %al,0xa(%rsi)
+  804b22:	80 00 00             	addb   $0x0,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 aa 04 80 00 00    	add    %ch,0x8004(%rdx)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 46 0a             	add    %al,0xa(%rsi)
+  804b32:	80 00 00             	addb   $0x0,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 46 0a             	add    %al,0xa(%rsi)
+  804b3a:	80 00 00             	addb   $0x0,(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 2c 08             	add    %ch,(%rax,%rcx,1)
+  804b42:	80 00 00             	addb   $0x0,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 f6                	add    %dh,%dh
+  804b49:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804b4f:	00 46 0a             	add    %al,0xa(%rsi)
+  804b52:	80 00 00             	addb   $0x0,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 46 0a             	add    %al,0xa(%rsi)
+  804b5a:	80 00 00             	addb   $0x0,(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 7b 05             	add    %bh,0x5(%rbx)
+  804b62:	80 00 00             	addb   $0x0,(%rax)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 46 0a             	add    %al,0xa(%rsi)
+  804b6a:	80 00 00             	addb   $0x0,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 58 07             	add    %bl,0x7(%rax)
+  804b72:	80 00 00             	addb   $0x0,(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 46 0a             	add    %al,0xa(%rsi)
+  804b7a:	80 00 00             	addb   $0x0,(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 46 0a             	add    %al,0xa(%rsi)
+  804b82:	80 00 00             	addb   $0x0,(%rax)
+  804b85:	00 00                	add    %al,(%rax)
+  804b87:	00 69 09             	add    %ch,0x9(%rcx)
+  804b8a:	80 00 00             	addb   $0x0,(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 46 0a             	add    %al,0xa(%rsi)
+  804b92:	80 00 00             	addb   $0x0,(%rax)
+  804b95:	00 00                	add    %al,(%rax)
+  804b97:	00 0e                	add    %cl,(%rsi)
+  804b99:	04 80                	add    $0x80,%al
+  804b9b:	00 00                	add    %al,(%rax)
+  804b9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804ba0 <error_string>:
+	...
+  804ba8:	51 47 80 00 00 00 00 00 63 47 80 00 00 00 00 00     QG......cG......
+  804bb8:	73 47 80 00 00 00 00 00 85 47 80 00 00 00 00 00     sG.......G......
+  804bc8:	93 47 80 00 00 00 00 00 a7 47 80 00 00 00 00 00     .G.......G......
+  804bd8:	bc 47 80 00 00 00 00 00 cf 47 80 00 00 00 00 00     .G.......G......
+  804be8:	e1 47 80 00 00 00 00 00 f5 47 80 00 00 00 00 00     .G.......G......
+  804bf8:	05 48 80 00 00 00 00 00 18 48 80 00 00 00 00 00     .H.......H......
+  804c08:	2f 48 80 00 00 00 00 00 45 48 80 00 00 00 00 00     /H......EH......
+  804c18:	5d 48 80 00 00 00 00 00 75 48 80 00 00 00 00 00     ]H......uH......
+  804c28:	82 48 80 00 00 00 00 00 58 4c 80 00 00 00 00 00     .H......XL......
+  804c38:	96 48 80 00 00 00 00 00 ae 48 80 00 00 00 00 00     .H.......H......
+  804c48:	b8 48 80 00 00 00 00 00 c2 48 80 00 00 00 00 00     .H.......H......
+  804c58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804ca8:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804cb8:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804cc8:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804cd8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804ce8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804cf8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804d08:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804d18:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  804d28:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  804d38:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804d48:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804d58:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804d68:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804d78:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804d88:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804d98:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804da8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804db8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804dc0 <devtab>:
+  804dc0:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804dd0:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804de0:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  804df0:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  804e00:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  804e10:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  804e20:	73 3e 00 63 6f 6e 73 00 5b 25 30 38 78 5d 20 75     s>.cons.[%08x] u
+  804e30:	73 65 72 20 70 61 6e 69 63 20 69 6e 20 25 73 20     ser panic in %s 
+  804e40:	61 74 20 25 73 3a 25 64 3a 20 00 69 70 63 5f 73     at %s:%d: .ipc_s
+  804e50:	65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 6c     end error: %i..l
+  804e60:	69 62 2f 69 70 63 2e 63 00 66 2e 0f 1f 84 00 00     ib/ipc.c.f......
+  804e70:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804e80:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804e90:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ea0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804eb0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804ec0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804ed0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804ee0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804ef0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f00:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f10:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f20:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f30:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f40:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804f50:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804f60:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804f70:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804f80:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804f90:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804fa0:	2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00     .........f......
+  804fb0:	00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f     ...f.........f..
+  804fc0:	1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00     .......f........
+  804fd0:	00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84     .f.........f....
+  804fe0:	00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66     .....f.........f
+  804ff0:	2e 0f 1f 84 00 00 00 00 00 0f 1f 80 00 00 00 00     ................
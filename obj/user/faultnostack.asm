@@ -0,0 +1,7888 @@
+
+obj/user/faultnostack:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2e 00 00 00       	call   800051 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void _pgfault_upcall();
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    sys_env_set_pgfault_upcall(0, (void *)_pgfault_upcall);
+  800029:	48 be 92 06 80 00 00 	movabs $0x800692,%rsi
+  800030:	00 00 00 
+  800033:	bf 00 00 00 00       	mov    $0x0,%edi
+  800038:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  80003f:	00 00 00 
+  800042:	ff d0                	call   *%rax
+    *(volatile int *)0 = 0;
+  800044:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80004b:	00 00 00 00 
+#endif
+}
+  80004f:	5d                   	pop    %rbp
+  800050:	c3                   	ret
+
+0000000000800051 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800051:	55                   	push   %rbp
+  800052:	48 89 e5             	mov    %rsp,%rbp
+  800055:	41 56                	push   %r14
+  800057:	41 55                	push   %r13
+  800059:	41 54                	push   %r12
+  80005b:	53                   	push   %rbx
+  80005c:	41 89 fd             	mov    %edi,%r13d
+  80005f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800062:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800069:	00 00 00 
+  80006c:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800073:	00 00 00 
+  800076:	48 39 c2             	cmp    %rax,%rdx
+  800079:	73 17                	jae    800092 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007e:	49 89 c4             	mov    %rax,%r12
+  800081:	48 83 c3 08          	add    $0x8,%rbx
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	ff 53 f8             	call   *-0x8(%rbx)
+  80008d:	4c 39 e3             	cmp    %r12,%rbx
+  800090:	72 ef                	jb     800081 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800092:	48 b8 d2 01 80 00 00 	movabs $0x8001d2,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c2                	mov    %eax,%edx
+  8000a0:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000a6:	48 89 d0             	mov    %rdx,%rax
+  8000a9:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ad:	48 29 d0             	sub    %rdx,%rax
+  8000b0:	48 c1 e0 05          	shl    $0x5,%rax
+  8000b4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bb:	00 00 00 
+  8000be:	48 01 d0             	add    %rdx,%rax
+  8000c1:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c8:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000cb:	45 85 ed             	test   %r13d,%r13d
+  8000ce:	7e 0d                	jle    8000dd <libmain+0x8c>
+  8000d0:	49 8b 06             	mov    (%r14),%rax
+  8000d3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000da:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000dd:	4c 89 f6             	mov    %r14,%rsi
+  8000e0:	44 89 ef             	mov    %r13d,%edi
+  8000e3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ea:	00 00 00 
+  8000ed:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ef:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  8000f6:	00 00 00 
+  8000f9:	ff d0                	call   *%rax
+#endif
+}
+  8000fb:	5b                   	pop    %rbx
+  8000fc:	41 5c                	pop    %r12
+  8000fe:	41 5d                	pop    %r13
+  800100:	41 5e                	pop    %r14
+  800102:	5d                   	pop    %rbp
+  800103:	c3                   	ret
+
+0000000000800104 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800108:	48 b8 03 09 80 00 00 	movabs $0x800903,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800114:	bf 00 00 00 00       	mov    $0x0,%edi
+  800119:	48 b8 6f 01 80 00 00 	movabs $0x80016f,%rax
+  800120:	00 00 00 
+  800123:	ff d0                	call   *%rax
+}
+  800125:	5d                   	pop    %rbp
+  800126:	c3                   	ret
+
+0000000000800127 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80012c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800131:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800137:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800143:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800145:	c3                   	ret
+
+0000000000800146 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800146:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80014b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800150:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800155:	ba 00 00 00 00       	mov    $0x0,%edx
+  80015a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800160:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800166:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80016c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016e:	c3                   	ret
+
+000000000080016f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80016f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800172:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80017c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800181:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800187:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80018d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800193:	0f 05                	syscall
+    if (check && ret > 0) {
+  800195:	48 85 c0             	test   %rax,%rax
+  800198:	7f 01                	jg     80019b <sys_env_destroy+0x2c>
+}
+  80019a:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80019b:	55                   	push   %rbp
+  80019c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80019f:	49 89 c0             	mov    %rax,%r8
+  8001a2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a7:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8001ae:	00 00 00 
+  8001b1:	be 29 00 00 00       	mov    $0x29,%esi
+  8001b6:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8001bd:	00 00 00 
+  8001c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c5:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  8001cc:	00 00 00 
+  8001cf:	41 ff d1             	call   *%r9
+
+00000000008001d2 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001d2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001dc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001f8:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001fa:	c3                   	ret
+
+00000000008001fb <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001fb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800200:	bf 00 00 00 00       	mov    $0x0,%edi
+  800205:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80020a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800215:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800221:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800223:	c3                   	ret
+
+0000000000800224 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800224:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800229:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800230:	00 00 00 
+  800233:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800239:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800245:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800247:	c3                   	ret
+
+0000000000800248 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800248:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80024b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800250:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800256:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80025c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80025e:	c3                   	ret
+
+000000000080025f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80025f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800262:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800267:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80026a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800270:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800276:	0f 05                	syscall
+    if (check && ret > 0) {
+  800278:	48 85 c0             	test   %rax,%rax
+  80027b:	7f 01                	jg     80027e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80027d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027e:	55                   	push   %rbp
+  80027f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800282:	49 89 c0             	mov    %rax,%r8
+  800285:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80028a:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800291:	00 00 00 
+  800294:	be 29 00 00 00       	mov    $0x29,%esi
+  800299:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8002a0:	00 00 00 
+  8002a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a8:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  8002af:	00 00 00 
+  8002b2:	41 ff d1             	call   *%r9
+
+00000000008002b5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002b5:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002b8:	48 63 d2             	movslq %edx,%rdx
+  8002bb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002be:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002c3:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002c6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002c8:	48 85 c0             	test   %rax,%rax
+  8002cb:	7f 01                	jg     8002ce <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002cd:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ce:	55                   	push   %rbp
+  8002cf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d2:	49 89 c0             	mov    %rax,%r8
+  8002d5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002da:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8002e1:	00 00 00 
+  8002e4:	be 29 00 00 00       	mov    $0x29,%esi
+  8002e9:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8002f0:	00 00 00 
+  8002f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f8:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  8002ff:	00 00 00 
+  800302:	41 ff d1             	call   *%r9
+
+0000000000800305 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800305:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800308:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80030d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800313:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800319:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80031f:	0f 05                	syscall
+    if (check && ret > 0) {
+  800321:	48 85 c0             	test   %rax,%rax
+  800324:	7f 01                	jg     800327 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800326:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800327:	55                   	push   %rbp
+  800328:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80032b:	49 89 c0             	mov    %rax,%r8
+  80032e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800333:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80033a:	00 00 00 
+  80033d:	be 29 00 00 00       	mov    $0x29,%esi
+  800342:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800349:	00 00 00 
+  80034c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800351:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  800358:	00 00 00 
+  80035b:	41 ff d1             	call   *%r9
+
+000000000080035e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80035e:	48 63 f6             	movslq %esi,%rsi
+  800361:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800364:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800369:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800374:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80037a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800380:	0f 05                	syscall
+    if (check && ret > 0) {
+  800382:	48 85 c0             	test   %rax,%rax
+  800385:	7f 01                	jg     800388 <sys_env_set_status+0x2a>
+}
+  800387:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800388:	55                   	push   %rbp
+  800389:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80038c:	49 89 c0             	mov    %rax,%r8
+  80038f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800394:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80039b:	00 00 00 
+  80039e:	be 29 00 00 00       	mov    $0x29,%esi
+  8003a3:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8003aa:	00 00 00 
+  8003ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b2:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  8003b9:	00 00 00 
+  8003bc:	41 ff d1             	call   *%r9
+
+00000000008003bf <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003bf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003c2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003cc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003d2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003de:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003e0:	48 85 c0             	test   %rax,%rax
+  8003e3:	7f 01                	jg     8003e6 <sys_env_set_trapframe+0x27>
+}
+  8003e5:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003e6:	55                   	push   %rbp
+  8003e7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ea:	49 89 c0             	mov    %rax,%r8
+  8003ed:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003f2:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8003f9:	00 00 00 
+  8003fc:	be 29 00 00 00       	mov    $0x29,%esi
+  800401:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800408:	00 00 00 
+  80040b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800410:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  800417:	00 00 00 
+  80041a:	41 ff d1             	call   *%r9
+
+000000000080041d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80041d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800420:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800425:	ba 00 00 00 00       	mov    $0x0,%edx
+  80042a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800430:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800436:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80043c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80043e:	48 85 c0             	test   %rax,%rax
+  800441:	7f 01                	jg     800444 <sys_env_set_pgfault_upcall+0x27>
+}
+  800443:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800444:	55                   	push   %rbp
+  800445:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800448:	49 89 c0             	mov    %rax,%r8
+  80044b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800450:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800457:	00 00 00 
+  80045a:	be 29 00 00 00       	mov    $0x29,%esi
+  80045f:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800466:	00 00 00 
+  800469:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046e:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  800475:	00 00 00 
+  800478:	41 ff d1             	call   *%r9
+
+000000000080047b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80047b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80047e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800481:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800486:	4d 63 c0             	movslq %r8d,%r8
+  800489:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80048f:	0f 05                	syscall
+}
+  800491:	c3                   	ret
+
+0000000000800492 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800492:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800495:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800498:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80049d:	4d 63 c0             	movslq %r8d,%r8
+  8004a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004a6:	0f 05                	syscall
+}
+  8004a8:	c3                   	ret
+
+00000000008004a9 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004a9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8004ae:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004b1:	45 89 c0             	mov    %r8d,%r8d
+  8004b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004ba:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004bc:	48 85 c0             	test   %rax,%rax
+  8004bf:	7f 01                	jg     8004c2 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004c1:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004c2:	55                   	push   %rbp
+  8004c3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c6:	49 89 c0             	mov    %rax,%r8
+  8004c9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004ce:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8004d5:	00 00 00 
+  8004d8:	be 29 00 00 00       	mov    $0x29,%esi
+  8004dd:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8004e4:	00 00 00 
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  8004f3:	00 00 00 
+  8004f6:	41 ff d1             	call   *%r9
+
+00000000008004f9 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004f9:	55                   	push   %rbp
+  8004fa:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800503:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800508:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050d:	48 b8 a9 04 80 00 00 	movabs $0x8004a9,%rax
+  800514:	00 00 00 
+  800517:	ff d0                	call   *%rax
+}
+  800519:	5d                   	pop    %rbp
+  80051a:	c3                   	ret
+
+000000000080051b <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80051b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800520:	bf 00 00 00 00       	mov    $0x0,%edi
+  800525:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80052a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800535:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800541:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800543:	c3                   	ret
+
+0000000000800544 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800544:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800549:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80054e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800553:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800559:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80055f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800565:	0f 05                	syscall
+    if (check && ret > 0) {
+  800567:	48 85 c0             	test   %rax,%rax
+  80056a:	7f 01                	jg     80056d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80056c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80056d:	55                   	push   %rbp
+  80056e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800571:	49 89 c0             	mov    %rax,%r8
+  800574:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800579:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800580:	00 00 00 
+  800583:	be 29 00 00 00       	mov    $0x29,%esi
+  800588:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80058f:	00 00 00 
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  80059e:	00 00 00 
+  8005a1:	41 ff d1             	call   *%r9
+
+00000000008005a4 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8005a4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8005a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ae:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ca:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005cc:	c3                   	ret
+
+00000000008005cd <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005cd:	89 d2                	mov    %edx,%edx
+  8005cf:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005d1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e8:	0f 05                	syscall
+}
+  8005ea:	c3                   	ret
+
+00000000008005eb <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005eb:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005ee:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800604:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80060a:	0f 05                	syscall
+}
+  80060c:	c3                   	ret
+
+000000000080060d <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80060d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  800610:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800615:	ba 00 00 00 00       	mov    $0x0,%edx
+  80061a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800620:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800626:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80062c:	0f 05                	syscall
+}
+  80062e:	c3                   	ret
+
+000000000080062f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80062f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800632:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800637:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80063c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800641:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800647:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80064d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800653:	0f 05                	syscall
+    if (check && ret > 0) {
+  800655:	48 85 c0             	test   %rax,%rax
+  800658:	7f 01                	jg     80065b <sys_irq_ack+0x2c>
+}
+  80065a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80065b:	55                   	push   %rbp
+  80065c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80065f:	49 89 c0             	mov    %rax,%r8
+  800662:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800667:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80066e:	00 00 00 
+  800671:	be 29 00 00 00       	mov    $0x29,%esi
+  800676:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80067d:	00 00 00 
+  800680:	b8 00 00 00 00       	mov    $0x0,%eax
+  800685:	49 b9 c8 33 80 00 00 	movabs $0x8033c8,%r9
+  80068c:	00 00 00 
+  80068f:	41 ff d1             	call   *%r9
+
+0000000000800692 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  800692:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  800695:	48 b8 64 42 80 00 00 	movabs $0x804264,%rax
+  80069c:	00 00 00 
+    call *%rax
+  80069f:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8006a1:	41 5f                	pop    %r15
+	popq %r15
+  8006a3:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8006a5:	41 5f                	pop    %r15
+	popq %r14
+  8006a7:	41 5e                	pop    %r14
+	popq %r13
+  8006a9:	41 5d                	pop    %r13
+	popq %r12
+  8006ab:	41 5c                	pop    %r12
+	popq %r11
+  8006ad:	41 5b                	pop    %r11
+	popq %r10
+  8006af:	41 5a                	pop    %r10
+	popq %r9
+  8006b1:	41 59                	pop    %r9
+	popq %r8
+  8006b3:	41 58                	pop    %r8
+	popq %rsi
+  8006b5:	5e                   	pop    %rsi
+	popq %rdi
+  8006b6:	5f                   	pop    %rdi
+	popq %rbp
+  8006b7:	5d                   	pop    %rbp
+	popq %rdx
+  8006b8:	5a                   	pop    %rdx
+	popq %rcx
+  8006b9:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8006ba:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8006bf:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8006c4:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8006c8:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8006cb:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8006d0:	5b                   	pop    %rbx
+	popq %rax
+  8006d1:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8006d2:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8006d6:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8006d7:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8006dc:	c3                   	ret
+
+00000000008006dd <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006dd:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006e4:	ff ff ff 
+  8006e7:	48 01 f8             	add    %rdi,%rax
+  8006ea:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006ee:	c3                   	ret
+
+00000000008006ef <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006ef:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006f6:	ff ff ff 
+  8006f9:	48 01 f8             	add    %rdi,%rax
+  8006fc:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800700:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800706:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80070a:	c3                   	ret
+
+000000000080070b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80070b:	55                   	push   %rbp
+  80070c:	48 89 e5             	mov    %rsp,%rbp
+  80070f:	41 57                	push   %r15
+  800711:	41 56                	push   %r14
+  800713:	41 55                	push   %r13
+  800715:	41 54                	push   %r12
+  800717:	53                   	push   %rbx
+  800718:	48 83 ec 08          	sub    $0x8,%rsp
+  80071c:	49 89 ff             	mov    %rdi,%r15
+  80071f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  800724:	49 bd 9a 2e 80 00 00 	movabs $0x802e9a,%r13
+  80072b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80072e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  800734:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  800737:	48 89 df             	mov    %rbx,%rdi
+  80073a:	41 ff d5             	call   *%r13
+  80073d:	83 e0 04             	and    $0x4,%eax
+  800740:	74 17                	je     800759 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  800742:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  800749:	4c 39 f3             	cmp    %r14,%rbx
+  80074c:	75 e6                	jne    800734 <fd_alloc+0x29>
+  80074e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800754:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  800759:	4d 89 27             	mov    %r12,(%r15)
+}
+  80075c:	48 83 c4 08          	add    $0x8,%rsp
+  800760:	5b                   	pop    %rbx
+  800761:	41 5c                	pop    %r12
+  800763:	41 5d                	pop    %r13
+  800765:	41 5e                	pop    %r14
+  800767:	41 5f                	pop    %r15
+  800769:	5d                   	pop    %rbp
+  80076a:	c3                   	ret
+
+000000000080076b <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80076b:	83 ff 1f             	cmp    $0x1f,%edi
+  80076e:	77 39                	ja     8007a9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800770:	55                   	push   %rbp
+  800771:	48 89 e5             	mov    %rsp,%rbp
+  800774:	41 54                	push   %r12
+  800776:	53                   	push   %rbx
+  800777:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80077a:	48 63 df             	movslq %edi,%rbx
+  80077d:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800784:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800788:	48 89 df             	mov    %rbx,%rdi
+  80078b:	48 b8 9a 2e 80 00 00 	movabs $0x802e9a,%rax
+  800792:	00 00 00 
+  800795:	ff d0                	call   *%rax
+  800797:	a8 04                	test   $0x4,%al
+  800799:	74 14                	je     8007af <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80079b:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80079f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8007a4:	5b                   	pop    %rbx
+  8007a5:	41 5c                	pop    %r12
+  8007a7:	5d                   	pop    %rbp
+  8007a8:	c3                   	ret
+        return -E_INVAL;
+  8007a9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8007ae:	c3                   	ret
+        return -E_INVAL;
+  8007af:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8007b4:	eb ee                	jmp    8007a4 <fd_lookup+0x39>
+
+00000000008007b6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8007b6:	55                   	push   %rbp
+  8007b7:	48 89 e5             	mov    %rsp,%rbp
+  8007ba:	41 54                	push   %r12
+  8007bc:	53                   	push   %rbx
+  8007bd:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8007c0:	48 b8 80 47 80 00 00 	movabs $0x804780,%rax
+  8007c7:	00 00 00 
+  8007ca:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  8007d1:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8007d4:	39 3b                	cmp    %edi,(%rbx)
+  8007d6:	74 47                	je     80081f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8007d8:	48 83 c0 08          	add    $0x8,%rax
+  8007dc:	48 8b 18             	mov    (%rax),%rbx
+  8007df:	48 85 db             	test   %rbx,%rbx
+  8007e2:	75 f0                	jne    8007d4 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8007e4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8007eb:	00 00 00 
+  8007ee:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007f4:	89 fa                	mov    %edi,%edx
+  8007f6:	48 bf f0 46 80 00 00 	movabs $0x8046f0,%rdi
+  8007fd:	00 00 00 
+  800800:	b8 00 00 00 00       	mov    $0x0,%eax
+  800805:	48 b9 18 35 80 00 00 	movabs $0x803518,%rcx
+  80080c:	00 00 00 
+  80080f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  800811:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  800816:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80081a:	5b                   	pop    %rbx
+  80081b:	41 5c                	pop    %r12
+  80081d:	5d                   	pop    %rbp
+  80081e:	c3                   	ret
+            return 0;
+  80081f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800824:	eb f0                	jmp    800816 <dev_lookup+0x60>
+
+0000000000800826 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  800826:	55                   	push   %rbp
+  800827:	48 89 e5             	mov    %rsp,%rbp
+  80082a:	41 55                	push   %r13
+  80082c:	41 54                	push   %r12
+  80082e:	53                   	push   %rbx
+  80082f:	48 83 ec 18          	sub    $0x18,%rsp
+  800833:	48 89 fb             	mov    %rdi,%rbx
+  800836:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800839:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  800840:	ff ff ff 
+  800843:	48 01 df             	add    %rbx,%rdi
+  800846:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80084a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80084e:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800855:	00 00 00 
+  800858:	ff d0                	call   *%rax
+  80085a:	41 89 c5             	mov    %eax,%r13d
+  80085d:	85 c0                	test   %eax,%eax
+  80085f:	78 06                	js     800867 <fd_close+0x41>
+  800861:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800865:	74 1a                	je     800881 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800867:	45 84 e4             	test   %r12b,%r12b
+  80086a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80086f:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800873:	44 89 e8             	mov    %r13d,%eax
+  800876:	48 83 c4 18          	add    $0x18,%rsp
+  80087a:	5b                   	pop    %rbx
+  80087b:	41 5c                	pop    %r12
+  80087d:	41 5d                	pop    %r13
+  80087f:	5d                   	pop    %rbp
+  800880:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800881:	8b 3b                	mov    (%rbx),%edi
+  800883:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800887:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  80088e:	00 00 00 
+  800891:	ff d0                	call   *%rax
+  800893:	41 89 c5             	mov    %eax,%r13d
+  800896:	85 c0                	test   %eax,%eax
+  800898:	78 1b                	js     8008b5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80089a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80089e:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8008a2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8008a8:	48 85 c0             	test   %rax,%rax
+  8008ab:	74 08                	je     8008b5 <fd_close+0x8f>
+  8008ad:	48 89 df             	mov    %rbx,%rdi
+  8008b0:	ff d0                	call   *%rax
+  8008b2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8008b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8008ba:	48 89 de             	mov    %rbx,%rsi
+  8008bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8008c2:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  8008c9:	00 00 00 
+  8008cc:	ff d0                	call   *%rax
+    return res;
+  8008ce:	eb a3                	jmp    800873 <fd_close+0x4d>
+
+00000000008008d0 <close>:
+
+int
+close(int fdnum) {
+  8008d0:	55                   	push   %rbp
+  8008d1:	48 89 e5             	mov    %rsp,%rbp
+  8008d4:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8008d8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8008dc:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  8008e3:	00 00 00 
+  8008e6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8008e8:	85 c0                	test   %eax,%eax
+  8008ea:	78 15                	js     800901 <close+0x31>
+
+    return fd_close(fd, 1);
+  8008ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8008f1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008f5:	48 b8 26 08 80 00 00 	movabs $0x800826,%rax
+  8008fc:	00 00 00 
+  8008ff:	ff d0                	call   *%rax
+}
+  800901:	c9                   	leave
+  800902:	c3                   	ret
+
+0000000000800903 <close_all>:
+
+void
+close_all(void) {
+  800903:	55                   	push   %rbp
+  800904:	48 89 e5             	mov    %rsp,%rbp
+  800907:	41 54                	push   %r12
+  800909:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80090a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80090f:	49 bc d0 08 80 00 00 	movabs $0x8008d0,%r12
+  800916:	00 00 00 
+  800919:	89 df                	mov    %ebx,%edi
+  80091b:	41 ff d4             	call   *%r12
+  80091e:	83 c3 01             	add    $0x1,%ebx
+  800921:	83 fb 20             	cmp    $0x20,%ebx
+  800924:	75 f3                	jne    800919 <close_all+0x16>
+}
+  800926:	5b                   	pop    %rbx
+  800927:	41 5c                	pop    %r12
+  800929:	5d                   	pop    %rbp
+  80092a:	c3                   	ret
+
+000000000080092b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  80092b:	55                   	push   %rbp
+  80092c:	48 89 e5             	mov    %rsp,%rbp
+  80092f:	41 57                	push   %r15
+  800931:	41 56                	push   %r14
+  800933:	41 55                	push   %r13
+  800935:	41 54                	push   %r12
+  800937:	53                   	push   %rbx
+  800938:	48 83 ec 18          	sub    $0x18,%rsp
+  80093c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80093f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  800943:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  80094a:	00 00 00 
+  80094d:	ff d0                	call   *%rax
+  80094f:	89 c3                	mov    %eax,%ebx
+  800951:	85 c0                	test   %eax,%eax
+  800953:	0f 88 b8 00 00 00    	js     800a11 <dup+0xe6>
+    close(newfdnum);
+  800959:	44 89 e7             	mov    %r12d,%edi
+  80095c:	48 b8 d0 08 80 00 00 	movabs $0x8008d0,%rax
+  800963:	00 00 00 
+  800966:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800968:	4d 63 ec             	movslq %r12d,%r13
+  80096b:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800972:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800976:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80097a:	4c 89 ff             	mov    %r15,%rdi
+  80097d:	49 be ef 06 80 00 00 	movabs $0x8006ef,%r14
+  800984:	00 00 00 
+  800987:	41 ff d6             	call   *%r14
+  80098a:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80098d:	4c 89 ef             	mov    %r13,%rdi
+  800990:	41 ff d6             	call   *%r14
+  800993:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800996:	48 89 df             	mov    %rbx,%rdi
+  800999:	48 b8 9a 2e 80 00 00 	movabs $0x802e9a,%rax
+  8009a0:	00 00 00 
+  8009a3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8009a5:	a8 04                	test   $0x4,%al
+  8009a7:	74 2b                	je     8009d4 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8009a9:	41 89 c1             	mov    %eax,%r9d
+  8009ac:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009b2:	4c 89 f1             	mov    %r14,%rcx
+  8009b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009ba:	48 89 de             	mov    %rbx,%rsi
+  8009bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c2:	48 b8 b5 02 80 00 00 	movabs $0x8002b5,%rax
+  8009c9:	00 00 00 
+  8009cc:	ff d0                	call   *%rax
+  8009ce:	89 c3                	mov    %eax,%ebx
+  8009d0:	85 c0                	test   %eax,%eax
+  8009d2:	78 4e                	js     800a22 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8009d4:	4c 89 ff             	mov    %r15,%rdi
+  8009d7:	48 b8 9a 2e 80 00 00 	movabs $0x802e9a,%rax
+  8009de:	00 00 00 
+  8009e1:	ff d0                	call   *%rax
+  8009e3:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8009e6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009ec:	4c 89 e9             	mov    %r13,%rcx
+  8009ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009f4:	4c 89 fe             	mov    %r15,%rsi
+  8009f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009fc:	48 b8 b5 02 80 00 00 	movabs $0x8002b5,%rax
+  800a03:	00 00 00 
+  800a06:	ff d0                	call   *%rax
+  800a08:	89 c3                	mov    %eax,%ebx
+  800a0a:	85 c0                	test   %eax,%eax
+  800a0c:	78 14                	js     800a22 <dup+0xf7>
+
+    return newfdnum;
+  800a0e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  800a11:	89 d8                	mov    %ebx,%eax
+  800a13:	48 83 c4 18          	add    $0x18,%rsp
+  800a17:	5b                   	pop    %rbx
+  800a18:	41 5c                	pop    %r12
+  800a1a:	41 5d                	pop    %r13
+  800a1c:	41 5e                	pop    %r14
+  800a1e:	41 5f                	pop    %r15
+  800a20:	5d                   	pop    %rbp
+  800a21:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  800a22:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a27:	4c 89 ee             	mov    %r13,%rsi
+  800a2a:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a2f:	49 bc 05 03 80 00 00 	movabs $0x800305,%r12
+  800a36:	00 00 00 
+  800a39:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  800a3c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a41:	4c 89 f6             	mov    %r14,%rsi
+  800a44:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a49:	41 ff d4             	call   *%r12
+    return res;
+  800a4c:	eb c3                	jmp    800a11 <dup+0xe6>
+
+0000000000800a4e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a4e:	55                   	push   %rbp
+  800a4f:	48 89 e5             	mov    %rsp,%rbp
+  800a52:	41 56                	push   %r14
+  800a54:	41 55                	push   %r13
+  800a56:	41 54                	push   %r12
+  800a58:	53                   	push   %rbx
+  800a59:	48 83 ec 10          	sub    $0x10,%rsp
+  800a5d:	89 fb                	mov    %edi,%ebx
+  800a5f:	49 89 f4             	mov    %rsi,%r12
+  800a62:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a65:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a69:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800a70:	00 00 00 
+  800a73:	ff d0                	call   *%rax
+  800a75:	85 c0                	test   %eax,%eax
+  800a77:	78 4c                	js     800ac5 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a79:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a7d:	41 8b 3e             	mov    (%r14),%edi
+  800a80:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a84:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  800a8b:	00 00 00 
+  800a8e:	ff d0                	call   *%rax
+  800a90:	85 c0                	test   %eax,%eax
+  800a92:	78 35                	js     800ac9 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a94:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a98:	83 e0 03             	and    $0x3,%eax
+  800a9b:	83 f8 01             	cmp    $0x1,%eax
+  800a9e:	74 2d                	je     800acd <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800aa0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800aa4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800aa8:	48 85 c0             	test   %rax,%rax
+  800aab:	74 56                	je     800b03 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800aad:	4c 89 ea             	mov    %r13,%rdx
+  800ab0:	4c 89 e6             	mov    %r12,%rsi
+  800ab3:	4c 89 f7             	mov    %r14,%rdi
+  800ab6:	ff d0                	call   *%rax
+}
+  800ab8:	48 83 c4 10          	add    $0x10,%rsp
+  800abc:	5b                   	pop    %rbx
+  800abd:	41 5c                	pop    %r12
+  800abf:	41 5d                	pop    %r13
+  800ac1:	41 5e                	pop    %r14
+  800ac3:	5d                   	pop    %rbp
+  800ac4:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ac5:	48 98                	cltq
+  800ac7:	eb ef                	jmp    800ab8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ac9:	48 98                	cltq
+  800acb:	eb eb                	jmp    800ab8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800acd:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ad4:	00 00 00 
+  800ad7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800add:	89 da                	mov    %ebx,%edx
+  800adf:	48 bf 31 47 80 00 00 	movabs $0x804731,%rdi
+  800ae6:	00 00 00 
+  800ae9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aee:	48 b9 18 35 80 00 00 	movabs $0x803518,%rcx
+  800af5:	00 00 00 
+  800af8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800afa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800b01:	eb b5                	jmp    800ab8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800b03:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800b0a:	eb ac                	jmp    800ab8 <read+0x6a>
+
+0000000000800b0c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800b0c:	55                   	push   %rbp
+  800b0d:	48 89 e5             	mov    %rsp,%rbp
+  800b10:	41 57                	push   %r15
+  800b12:	41 56                	push   %r14
+  800b14:	41 55                	push   %r13
+  800b16:	41 54                	push   %r12
+  800b18:	53                   	push   %rbx
+  800b19:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800b1d:	48 85 d2             	test   %rdx,%rdx
+  800b20:	74 54                	je     800b76 <readn+0x6a>
+  800b22:	41 89 fd             	mov    %edi,%r13d
+  800b25:	49 89 f6             	mov    %rsi,%r14
+  800b28:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800b2b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800b30:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800b35:	49 bf 4e 0a 80 00 00 	movabs $0x800a4e,%r15
+  800b3c:	00 00 00 
+  800b3f:	4c 89 e2             	mov    %r12,%rdx
+  800b42:	48 29 f2             	sub    %rsi,%rdx
+  800b45:	4c 01 f6             	add    %r14,%rsi
+  800b48:	44 89 ef             	mov    %r13d,%edi
+  800b4b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b4e:	85 c0                	test   %eax,%eax
+  800b50:	78 20                	js     800b72 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b52:	01 c3                	add    %eax,%ebx
+  800b54:	85 c0                	test   %eax,%eax
+  800b56:	74 08                	je     800b60 <readn+0x54>
+  800b58:	48 63 f3             	movslq %ebx,%rsi
+  800b5b:	4c 39 e6             	cmp    %r12,%rsi
+  800b5e:	72 df                	jb     800b3f <readn+0x33>
+    }
+    return res;
+  800b60:	48 63 c3             	movslq %ebx,%rax
+}
+  800b63:	48 83 c4 08          	add    $0x8,%rsp
+  800b67:	5b                   	pop    %rbx
+  800b68:	41 5c                	pop    %r12
+  800b6a:	41 5d                	pop    %r13
+  800b6c:	41 5e                	pop    %r14
+  800b6e:	41 5f                	pop    %r15
+  800b70:	5d                   	pop    %rbp
+  800b71:	c3                   	ret
+        if (inc < 0) return inc;
+  800b72:	48 98                	cltq
+  800b74:	eb ed                	jmp    800b63 <readn+0x57>
+    int inc = 1, res = 0;
+  800b76:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b7b:	eb e3                	jmp    800b60 <readn+0x54>
+
+0000000000800b7d <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b7d:	55                   	push   %rbp
+  800b7e:	48 89 e5             	mov    %rsp,%rbp
+  800b81:	41 56                	push   %r14
+  800b83:	41 55                	push   %r13
+  800b85:	41 54                	push   %r12
+  800b87:	53                   	push   %rbx
+  800b88:	48 83 ec 10          	sub    $0x10,%rsp
+  800b8c:	89 fb                	mov    %edi,%ebx
+  800b8e:	49 89 f4             	mov    %rsi,%r12
+  800b91:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b94:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b98:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800b9f:	00 00 00 
+  800ba2:	ff d0                	call   *%rax
+  800ba4:	85 c0                	test   %eax,%eax
+  800ba6:	78 47                	js     800bef <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ba8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800bac:	41 8b 3e             	mov    (%r14),%edi
+  800baf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800bb3:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  800bba:	00 00 00 
+  800bbd:	ff d0                	call   *%rax
+  800bbf:	85 c0                	test   %eax,%eax
+  800bc1:	78 30                	js     800bf3 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800bc3:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800bc8:	74 2d                	je     800bf7 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800bce:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800bd2:	48 85 c0             	test   %rax,%rax
+  800bd5:	74 56                	je     800c2d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800bd7:	4c 89 ea             	mov    %r13,%rdx
+  800bda:	4c 89 e6             	mov    %r12,%rsi
+  800bdd:	4c 89 f7             	mov    %r14,%rdi
+  800be0:	ff d0                	call   *%rax
+}
+  800be2:	48 83 c4 10          	add    $0x10,%rsp
+  800be6:	5b                   	pop    %rbx
+  800be7:	41 5c                	pop    %r12
+  800be9:	41 5d                	pop    %r13
+  800beb:	41 5e                	pop    %r14
+  800bed:	5d                   	pop    %rbp
+  800bee:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bef:	48 98                	cltq
+  800bf1:	eb ef                	jmp    800be2 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bf3:	48 98                	cltq
+  800bf5:	eb eb                	jmp    800be2 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800bf7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800bfe:	00 00 00 
+  800c01:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800c07:	89 da                	mov    %ebx,%edx
+  800c09:	48 bf 4d 47 80 00 00 	movabs $0x80474d,%rdi
+  800c10:	00 00 00 
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	48 b9 18 35 80 00 00 	movabs $0x803518,%rcx
+  800c1f:	00 00 00 
+  800c22:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800c24:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800c2b:	eb b5                	jmp    800be2 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800c2d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800c34:	eb ac                	jmp    800be2 <write+0x65>
+
+0000000000800c36 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800c36:	55                   	push   %rbp
+  800c37:	48 89 e5             	mov    %rsp,%rbp
+  800c3a:	41 54                	push   %r12
+  800c3c:	53                   	push   %rbx
+  800c3d:	48 83 ec 10          	sub    $0x10,%rsp
+  800c41:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c43:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c47:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800c4e:	00 00 00 
+  800c51:	ff d0                	call   *%rax
+  800c53:	85 c0                	test   %eax,%eax
+  800c55:	78 3e                	js     800c95 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c57:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c5b:	41 8b 3c 24          	mov    (%r12),%edi
+  800c5f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c63:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  800c6a:	00 00 00 
+  800c6d:	ff d0                	call   *%rax
+  800c6f:	85 c0                	test   %eax,%eax
+  800c71:	78 22                	js     800c95 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c73:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c77:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c7b:	48 85 c0             	test   %rax,%rax
+  800c7e:	74 0b                	je     800c8b <seek+0x55>
+  800c80:	89 de                	mov    %ebx,%esi
+  800c82:	4c 89 e7             	mov    %r12,%rdi
+  800c85:	ff d0                	call   *%rax
+  800c87:	85 c0                	test   %eax,%eax
+  800c89:	78 0a                	js     800c95 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c8b:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c90:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c95:	48 83 c4 10          	add    $0x10,%rsp
+  800c99:	5b                   	pop    %rbx
+  800c9a:	41 5c                	pop    %r12
+  800c9c:	5d                   	pop    %rbp
+  800c9d:	c3                   	ret
+
+0000000000800c9e <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c9e:	55                   	push   %rbp
+  800c9f:	48 89 e5             	mov    %rsp,%rbp
+  800ca2:	41 55                	push   %r13
+  800ca4:	41 54                	push   %r12
+  800ca6:	53                   	push   %rbx
+  800ca7:	48 83 ec 18          	sub    $0x18,%rsp
+  800cab:	89 fb                	mov    %edi,%ebx
+  800cad:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cb0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800cb4:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800cbb:	00 00 00 
+  800cbe:	ff d0                	call   *%rax
+  800cc0:	85 c0                	test   %eax,%eax
+  800cc2:	78 38                	js     800cfc <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cc4:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800cc8:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800ccc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800cd0:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  800cd7:	00 00 00 
+  800cda:	ff d0                	call   *%rax
+  800cdc:	85 c0                	test   %eax,%eax
+  800cde:	78 1c                	js     800cfc <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800ce0:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800ce5:	74 20                	je     800d07 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800ce7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800ceb:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800cef:	48 85 c0             	test   %rax,%rax
+  800cf2:	74 47                	je     800d3b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800cf4:	44 89 e6             	mov    %r12d,%esi
+  800cf7:	4c 89 ef             	mov    %r13,%rdi
+  800cfa:	ff d0                	call   *%rax
+}
+  800cfc:	48 83 c4 18          	add    $0x18,%rsp
+  800d00:	5b                   	pop    %rbx
+  800d01:	41 5c                	pop    %r12
+  800d03:	41 5d                	pop    %r13
+  800d05:	5d                   	pop    %rbp
+  800d06:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800d07:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800d0e:	00 00 00 
+  800d11:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800d17:	89 da                	mov    %ebx,%edx
+  800d19:	48 bf 10 47 80 00 00 	movabs $0x804710,%rdi
+  800d20:	00 00 00 
+  800d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d28:	48 b9 18 35 80 00 00 	movabs $0x803518,%rcx
+  800d2f:	00 00 00 
+  800d32:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800d34:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d39:	eb c1                	jmp    800cfc <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800d3b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d40:	eb ba                	jmp    800cfc <ftruncate+0x5e>
+
+0000000000800d42 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800d42:	55                   	push   %rbp
+  800d43:	48 89 e5             	mov    %rsp,%rbp
+  800d46:	41 54                	push   %r12
+  800d48:	53                   	push   %rbx
+  800d49:	48 83 ec 10          	sub    $0x10,%rsp
+  800d4d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d50:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d54:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  800d5b:	00 00 00 
+  800d5e:	ff d0                	call   *%rax
+  800d60:	85 c0                	test   %eax,%eax
+  800d62:	78 4e                	js     800db2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d64:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d68:	41 8b 3c 24          	mov    (%r12),%edi
+  800d6c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d70:	48 b8 b6 07 80 00 00 	movabs $0x8007b6,%rax
+  800d77:	00 00 00 
+  800d7a:	ff d0                	call   *%rax
+  800d7c:	85 c0                	test   %eax,%eax
+  800d7e:	78 32                	js     800db2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d80:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d84:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d89:	74 30                	je     800dbb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d8b:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d8e:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d95:	00 00 00 
+    stat->st_isdir = 0;
+  800d98:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d9f:	00 00 00 
+    stat->st_dev = dev;
+  800da2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800da9:	48 89 de             	mov    %rbx,%rsi
+  800dac:	4c 89 e7             	mov    %r12,%rdi
+  800daf:	ff 50 28             	call   *0x28(%rax)
+}
+  800db2:	48 83 c4 10          	add    $0x10,%rsp
+  800db6:	5b                   	pop    %rbx
+  800db7:	41 5c                	pop    %r12
+  800db9:	5d                   	pop    %rbp
+  800dba:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800dbb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800dc0:	eb f0                	jmp    800db2 <fstat+0x70>
+
+0000000000800dc2 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800dc2:	55                   	push   %rbp
+  800dc3:	48 89 e5             	mov    %rsp,%rbp
+  800dc6:	41 54                	push   %r12
+  800dc8:	53                   	push   %rbx
+  800dc9:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800dcc:	be 00 00 00 00       	mov    $0x0,%esi
+  800dd1:	48 b8 30 1f 80 00 00 	movabs $0x801f30,%rax
+  800dd8:	00 00 00 
+  800ddb:	ff d0                	call   *%rax
+  800ddd:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800ddf:	85 c0                	test   %eax,%eax
+  800de1:	78 25                	js     800e08 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800de3:	4c 89 e6             	mov    %r12,%rsi
+  800de6:	89 c7                	mov    %eax,%edi
+  800de8:	48 b8 42 0d 80 00 00 	movabs $0x800d42,%rax
+  800def:	00 00 00 
+  800df2:	ff d0                	call   *%rax
+  800df4:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800df7:	89 df                	mov    %ebx,%edi
+  800df9:	48 b8 d0 08 80 00 00 	movabs $0x8008d0,%rax
+  800e00:	00 00 00 
+  800e03:	ff d0                	call   *%rax
+
+    return res;
+  800e05:	44 89 e3             	mov    %r12d,%ebx
+}
+  800e08:	89 d8                	mov    %ebx,%eax
+  800e0a:	5b                   	pop    %rbx
+  800e0b:	41 5c                	pop    %r12
+  800e0d:	5d                   	pop    %rbp
+  800e0e:	c3                   	ret
+
+0000000000800e0f <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800e0f:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800e16:	00 00 00 
+  800e19:	83 38 00             	cmpl   $0x0,(%rax)
+  800e1c:	74 0a                	je     800e28 <fsenv+0x19>
+    return envid;
+}
+  800e1e:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800e25:	00 00 
+  800e27:	c3                   	ret
+fsenv(void) {
+  800e28:	55                   	push   %rbp
+  800e29:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800e2c:	bf 03 00 00 00       	mov    $0x3,%edi
+  800e31:	48 b8 4e 46 80 00 00 	movabs $0x80464e,%rax
+  800e38:	00 00 00 
+  800e3b:	ff d0                	call   *%rax
+  800e3d:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800e44:	00 00 
+}
+  800e46:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800e4d:	00 00 
+  800e4f:	5d                   	pop    %rbp
+  800e50:	c3                   	ret
+
+0000000000800e51 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800e51:	55                   	push   %rbp
+  800e52:	48 89 e5             	mov    %rsp,%rbp
+  800e55:	41 54                	push   %r12
+  800e57:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800e58:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e5d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e62:	48 89 de             	mov    %rbx,%rsi
+  800e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e6a:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  800e71:	00 00 00 
+  800e74:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e76:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e7d:	00 00 00 
+  800e80:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e86:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e8b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e90:	48 89 de             	mov    %rbx,%rsi
+  800e93:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e98:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  800e9f:	00 00 00 
+  800ea2:	ff d0                	call   *%rax
+  800ea4:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800ea6:	85 c0                	test   %eax,%eax
+  800ea8:	0f 88 a2 00 00 00    	js     800f50 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800eae:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800eb5:	00 00 00 
+  800eb8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ebe:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800ec3:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800ec5:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800eca:	49 bc 62 30 80 00 00 	movabs $0x803062,%r12
+  800ed1:	00 00 00 
+  800ed4:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800ed7:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800edc:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800edf:	48 b8 0f 0e 80 00 00 	movabs $0x800e0f,%rax
+  800ee6:	00 00 00 
+  800ee9:	ff d0                	call   *%rax
+  800eeb:	89 c7                	mov    %eax,%edi
+  800eed:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800ef3:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800ef8:	48 89 da             	mov    %rbx,%rdx
+  800efb:	be 09 00 00 00       	mov    $0x9,%esi
+  800f00:	48 b8 f8 45 80 00 00 	movabs $0x8045f8,%rax
+  800f07:	00 00 00 
+  800f0a:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800f0c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f16:	be 00 00 00 00       	mov    $0x0,%esi
+  800f1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f20:	48 b8 d4 45 80 00 00 	movabs $0x8045d4,%rax
+  800f27:	00 00 00 
+  800f2a:	ff d0                	call   *%rax
+  800f2c:	89 c3                	mov    %eax,%ebx
+  800f2e:	85 c0                	test   %eax,%eax
+  800f30:	78 25                	js     800f57 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800f32:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f39:	00 00 00 
+  800f3c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800f42:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800f49:	00 00 
+    return 0;
+  800f4b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800f50:	89 d8                	mov    %ebx,%eax
+  800f52:	5b                   	pop    %rbx
+  800f53:	41 5c                	pop    %r12
+  800f55:	5d                   	pop    %rbp
+  800f56:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800f57:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f5c:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f61:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f66:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  800f6d:	00 00 00 
+  800f70:	ff d0                	call   *%rax
+        return res;
+  800f72:	eb dc                	jmp    800f50 <fschan_setup+0xff>
+
+0000000000800f74 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f74:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f7b:	00 00 00 
+  800f7e:	80 38 00             	cmpb   $0x0,(%rax)
+  800f81:	74 55                	je     800fd8 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f83:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f8a:	00 00 00 
+  800f8d:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f93:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f98:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f9f:	00 00 00 
+  800fa2:	3b 0a                	cmp    (%rdx),%ecx
+  800fa4:	75 01                	jne    800fa7 <fschan+0x33>
+}
+  800fa6:	c3                   	ret
+fschan(void) {
+  800fa7:	55                   	push   %rbp
+  800fa8:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800fab:	48 b8 51 0e 80 00 00 	movabs $0x800e51,%rax
+  800fb2:	00 00 00 
+  800fb5:	ff d0                	call   *%rax
+  800fb7:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800fb9:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800fbe:	85 d2                	test   %edx,%edx
+  800fc0:	78 02                	js     800fc4 <fschan+0x50>
+}
+  800fc2:	5d                   	pop    %rbp
+  800fc3:	c3                   	ret
+        fschan_enabled = 0;
+  800fc4:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800fcb:	00 00 00 
+  800fce:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800fd1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fd6:	eb ea                	jmp    800fc2 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	c3                   	ret
+
+0000000000800fde <fbuf>:
+fbuf(struct Fd *fd) {
+  800fde:	55                   	push   %rbp
+  800fdf:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800fe2:	48 b8 dd 06 80 00 00 	movabs $0x8006dd,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800fee:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ff3:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800ff7:	77 12                	ja     80100b <fbuf+0x2d>
+  800ff9:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800ffd:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801004:	00 00 00 
+  801007:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80100b:	48 89 d0             	mov    %rdx,%rax
+  80100e:	5d                   	pop    %rbp
+  80100f:	c3                   	ret
+
+0000000000801010 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801010:	55                   	push   %rbp
+  801011:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801014:	48 83 c7 40          	add    $0x40,%rdi
+  801018:	48 b8 9c 30 80 00 00 	movabs $0x80309c,%rax
+  80101f:	00 00 00 
+  801022:	ff d0                	call   *%rax
+  801024:	84 c0                	test   %al,%al
+  801026:	75 02                	jne    80102a <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801028:	5d                   	pop    %rbp
+  801029:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80102a:	48 b8 0f 0e 80 00 00 	movabs $0x800e0f,%rax
+  801031:	00 00 00 
+  801034:	ff d0                	call   *%rax
+  801036:	89 c7                	mov    %eax,%edi
+  801038:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80103e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801043:	ba 00 00 00 00       	mov    $0x0,%edx
+  801048:	be 0a 00 00 00       	mov    $0xa,%esi
+  80104d:	48 b8 f8 45 80 00 00 	movabs $0x8045f8,%rax
+  801054:	00 00 00 
+  801057:	ff d0                	call   *%rax
+}
+  801059:	eb cd                	jmp    801028 <fschan_publish+0x18>
+
+000000000080105b <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80105b:	55                   	push   %rbp
+  80105c:	48 89 e5             	mov    %rsp,%rbp
+  80105f:	41 57                	push   %r15
+  801061:	41 56                	push   %r14
+  801063:	41 55                	push   %r13
+  801065:	41 54                	push   %r12
+  801067:	53                   	push   %rbx
+  801068:	48 83 ec 48          	sub    $0x48,%rsp
+  80106c:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801070:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801074:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801077:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80107b:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80107e:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801085:	00 00 00 
+  801088:	8b 02                	mov    (%rdx),%eax
+  80108a:	83 c0 01             	add    $0x1,%eax
+  80108d:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801092:	0f 44 c1             	cmove  %ecx,%eax
+  801095:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801097:	4d 85 c0             	test   %r8,%r8
+  80109a:	74 2c                	je     8010c8 <fschan_rw+0x6d>
+  80109c:	45 89 ce             	mov    %r9d,%r14d
+  80109f:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8010a6:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8010aa:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8010b0:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8010b7:	00 
+  8010b8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8010be:	b8 01 00 00 00       	mov    $0x1,%eax
+  8010c3:	e9 41 01 00 00       	jmp    801209 <fschan_rw+0x1ae>
+  8010c8:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8010cc:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8010d0:	e9 9c 01 00 00       	jmp    801271 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8010d5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8010d9:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8010dc:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8010df:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8010e2:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8010e6:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8010ea:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8010ee:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8010f2:	48 89 da             	mov    %rbx,%rdx
+  8010f5:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  8010fc:	00 00 00 
+  8010ff:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801101:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801105:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  80110c:	00 00 00 
+  80110f:	ff d0                	call   *%rax
+            queued += blk;
+  801111:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801114:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801118:	4d 39 fc             	cmp    %r15,%r12
+  80111b:	73 6b                	jae    801188 <fschan_rw+0x12d>
+  80111d:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801121:	77 65                	ja     801188 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801123:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801127:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80112b:	48 b8 77 30 80 00 00 	movabs $0x803077,%rax
+  801132:	00 00 00 
+  801135:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801137:	4c 89 fb             	mov    %r15,%rbx
+  80113a:	4c 29 e3             	sub    %r12,%rbx
+  80113d:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801142:	48 39 d3             	cmp    %rdx,%rbx
+  801145:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801149:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80114d:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801151:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801155:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801158:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80115a:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801161:	00 00 00 
+  801164:	8b 09                	mov    (%rcx),%ecx
+  801166:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801169:	83 fe 03             	cmp    $0x3,%esi
+  80116c:	0f 85 63 ff ff ff    	jne    8010d5 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801172:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801176:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801179:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80117c:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80117f:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801183:	e9 79 ff ff ff       	jmp    801101 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801188:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80118c:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801193:	48 89 df             	mov    %rbx,%rdi
+  801196:	48 b8 3a 31 80 00 00 	movabs $0x80313a,%rax
+  80119d:	00 00 00 
+  8011a0:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8011a2:	48 89 df             	mov    %rbx,%rdi
+  8011a5:	48 b8 c8 30 80 00 00 	movabs $0x8030c8,%rax
+  8011ac:	00 00 00 
+  8011af:	ff d0                	call   *%rax
+  8011b1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8011b5:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8011b9:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8011bd:	75 25                	jne    8011e4 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8011bf:	8b 40 04             	mov    0x4(%rax),%eax
+  8011c2:	85 c0                	test   %eax,%eax
+  8011c4:	0f 88 86 00 00 00    	js     801250 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011ca:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8011ce:	74 5b                	je     80122b <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8011d0:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8011d4:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8011d8:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8011dc:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8011e0:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8011e4:	48 89 df             	mov    %rbx,%rdi
+  8011e7:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  8011ee:	00 00 00 
+  8011f1:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8011f3:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8011f7:	83 f0 01             	xor    $0x1,%eax
+  8011fa:	4d 39 fc             	cmp    %r15,%r12
+  8011fd:	0f 92 c2             	setb   %dl
+  801200:	84 c2                	test   %al,%dl
+  801202:	75 05                	jne    801209 <fschan_rw+0x1ae>
+  801204:	45 85 ed             	test   %r13d,%r13d
+  801207:	74 50                	je     801259 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801209:	4d 39 fc             	cmp    %r15,%r12
+  80120c:	0f 92 c1             	setb   %cl
+  80120f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801213:	0f 96 c2             	setbe  %dl
+  801216:	84 d1                	test   %dl,%cl
+  801218:	0f 84 6a ff ff ff    	je     801188 <fschan_rw+0x12d>
+  80121e:	84 c0                	test   %al,%al
+  801220:	0f 85 fd fe ff ff    	jne    801123 <fschan_rw+0xc8>
+  801226:	e9 5d ff ff ff       	jmp    801188 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80122b:	48 63 d0             	movslq %eax,%rdx
+  80122e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801232:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801236:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80123a:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80123e:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801242:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  801249:	00 00 00 
+  80124c:	ff d0                	call   *%rax
+  80124e:	eb 80                	jmp    8011d0 <fschan_rw+0x175>
+                err = msg->fm_res;
+  801250:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801253:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  801257:	eb 8b                	jmp    8011e4 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  801259:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80125e:	0f 85 68 fe ff ff    	jne    8010cc <fschan_rw+0x71>
+  801264:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  801267:	85 c0                	test   %eax,%eax
+  801269:	0f 84 5d fe ff ff    	je     8010cc <fschan_rw+0x71>
+  80126f:	48 98                	cltq
+}
+  801271:	48 83 c4 48          	add    $0x48,%rsp
+  801275:	5b                   	pop    %rbx
+  801276:	41 5c                	pop    %r12
+  801278:	41 5d                	pop    %r13
+  80127a:	41 5e                	pop    %r14
+  80127c:	41 5f                	pop    %r15
+  80127e:	5d                   	pop    %rbp
+  80127f:	c3                   	ret
+
+0000000000801280 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801280:	55                   	push   %rbp
+  801281:	48 89 e5             	mov    %rsp,%rbp
+  801284:	41 56                	push   %r14
+  801286:	41 55                	push   %r13
+  801288:	41 54                	push   %r12
+  80128a:	53                   	push   %rbx
+  80128b:	48 83 ec 10          	sub    $0x10,%rsp
+  80128f:	49 89 fe             	mov    %rdi,%r14
+  801292:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801295:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801299:	48 29 f3             	sub    %rsi,%rbx
+  80129c:	48 39 d3             	cmp    %rdx,%rbx
+  80129f:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8012a3:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8012aa:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8012ab:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8012b0:	49 bd f9 2e 80 00 00 	movabs $0x802ef9,%r13
+  8012b7:	00 00 00 
+  8012ba:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8012c1:	76 1e                	jbe    8012e1 <mmap_fault+0x61>
+  8012c3:	4c 01 e7             	add    %r12,%rdi
+  8012c6:	41 ff d5             	call   *%r13
+  8012c9:	84 c0                	test   %al,%al
+  8012cb:	75 14                	jne    8012e1 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8012cd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012d1:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8012d8:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8012dc:	48 39 df             	cmp    %rbx,%rdi
+  8012df:	72 e2                	jb     8012c3 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8012e1:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8012e8:	00 00 00 
+  8012eb:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8012f2:	00 00 00 
+  8012f5:	4c 89 f0             	mov    %r14,%rax
+  8012f8:	48 29 d0             	sub    %rdx,%rax
+  8012fb:	48 c1 f8 03          	sar    $0x3,%rax
+  8012ff:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801306:	aa aa aa 
+  801309:	48 0f af c2          	imul   %rdx,%rax
+  80130d:	48 c1 e0 0c          	shl    $0xc,%rax
+  801311:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  801316:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80131a:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80131c:	44 89 e0             	mov    %r12d,%eax
+  80131f:	41 03 46 10          	add    0x10(%r14),%eax
+  801323:	41 2b 06             	sub    (%r14),%eax
+  801326:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  801329:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80132d:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  801331:	41 8b 46 14          	mov    0x14(%r14),%eax
+  801335:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  801338:	48 b8 0f 0e 80 00 00 	movabs $0x800e0f,%rax
+  80133f:	00 00 00 
+  801342:	ff d0                	call   *%rax
+  801344:	89 c7                	mov    %eax,%edi
+  801346:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80134c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801351:	48 89 da             	mov    %rbx,%rdx
+  801354:	be 0f 00 00 00       	mov    $0xf,%esi
+  801359:	48 b8 f8 45 80 00 00 	movabs $0x8045f8,%rax
+  801360:	00 00 00 
+  801363:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  801365:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80136a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80136e:	4c 89 e6             	mov    %r12,%rsi
+  801371:	bf 00 00 00 00       	mov    $0x0,%edi
+  801376:	48 b8 d4 45 80 00 00 	movabs $0x8045d4,%rax
+  80137d:	00 00 00 
+  801380:	ff d0                	call   *%rax
+  801382:	48 98                	cltq
+}
+  801384:	48 83 c4 10          	add    $0x10,%rsp
+  801388:	5b                   	pop    %rbx
+  801389:	41 5c                	pop    %r12
+  80138b:	41 5d                	pop    %r13
+  80138d:	41 5e                	pop    %r14
+  80138f:	5d                   	pop    %rbp
+  801390:	c3                   	ret
+
+0000000000801391 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801391:	48 8b 37             	mov    (%rdi),%rsi
+  801394:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80139b:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8013a2:	00 00 00 
+  8013a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013aa:	eb 0f                	jmp    8013bb <mmap_pgfault+0x2a>
+  8013ac:	c3                   	ret
+  8013ad:	48 83 c1 01          	add    $0x1,%rcx
+  8013b1:	48 83 c2 18          	add    $0x18,%rdx
+  8013b5:	48 83 f9 20          	cmp    $0x20,%rcx
+  8013b9:	74 6e                	je     801429 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013bb:	48 8b 02             	mov    (%rdx),%rax
+  8013be:	48 83 e8 01          	sub    $0x1,%rax
+  8013c2:	48 39 f0             	cmp    %rsi,%rax
+  8013c5:	73 e6                	jae    8013ad <mmap_pgfault+0x1c>
+  8013c7:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8013cb:	73 e0                	jae    8013ad <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013cd:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8013d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d6:	f6 c2 01             	test   $0x1,%dl
+  8013d9:	75 d1                	jne    8013ac <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8013db:	f6 c2 02             	test   $0x2,%dl
+  8013de:	74 1a                	je     8013fa <mmap_pgfault+0x69>
+  8013e0:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e9:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8013f0:	00 00 00 
+  8013f3:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8013f8:	74 35                	je     80142f <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013fe:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801402:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801409:	00 00 00 
+  80140c:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  801410:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801415:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  80141c:	00 00 00 
+  80141f:	ff d0                	call   *%rax
+  801421:	48 85 c0             	test   %rax,%rax
+  801424:	0f 9f c0             	setg   %al
+}
+  801427:	5d                   	pop    %rbp
+  801428:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80142e:	c3                   	ret
+}
+  80142f:	c3                   	ret
+
+0000000000801430 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  801430:	55                   	push   %rbp
+  801431:	48 89 e5             	mov    %rsp,%rbp
+  801434:	41 54                	push   %r12
+  801436:	53                   	push   %rbx
+  801437:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80143a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801441:	00 00 00 
+  801444:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  801449:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80144d:	74 15                	je     801464 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80144f:	48 83 c3 01          	add    $0x1,%rbx
+  801453:	48 83 c0 18          	add    $0x18,%rax
+  801457:	48 83 fb 20          	cmp    $0x20,%rbx
+  80145b:	75 ec                	jne    801449 <mmap_alloc+0x19>
+    return NULL;
+  80145d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801462:	eb 52                	jmp    8014b6 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801464:	4c 89 e7             	mov    %r12,%rdi
+  801467:	48 b8 9a 2e 80 00 00 	movabs $0x802e9a,%rax
+  80146e:	00 00 00 
+  801471:	ff d0                	call   *%rax
+  801473:	41 89 c1             	mov    %eax,%r9d
+  801476:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80147d:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801481:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801487:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148c:	4c 89 e6             	mov    %r12,%rsi
+  80148f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801494:	48 b8 b5 02 80 00 00 	movabs $0x8002b5,%rax
+  80149b:	00 00 00 
+  80149e:	ff d0                	call   *%rax
+  8014a0:	85 c0                	test   %eax,%eax
+  8014a2:	78 17                	js     8014bb <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8014a4:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8014a8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8014af:	00 00 00 
+  8014b2:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8014b6:	5b                   	pop    %rbx
+  8014b7:	41 5c                	pop    %r12
+  8014b9:	5d                   	pop    %rbp
+  8014ba:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8014bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c0:	eb f4                	jmp    8014b6 <mmap_alloc+0x86>
+
+00000000008014c2 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8014c2:	55                   	push   %rbp
+  8014c3:	48 89 e5             	mov    %rsp,%rbp
+  8014c6:	41 56                	push   %r14
+  8014c8:	41 55                	push   %r13
+  8014ca:	41 54                	push   %r12
+  8014cc:	53                   	push   %rbx
+  8014cd:	48 83 ec 10          	sub    $0x10,%rsp
+  8014d1:	41 89 fc             	mov    %edi,%r12d
+  8014d4:	49 89 f5             	mov    %rsi,%r13
+  8014d7:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014da:	48 89 f0             	mov    %rsi,%rax
+  8014dd:	48 09 d0             	or     %rdx,%rax
+  8014e0:	75 0d                	jne    8014ef <fsipc+0x2d>
+  8014e2:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8014e5:	83 f8 04             	cmp    $0x4,%eax
+  8014e8:	76 7d                	jbe    801567 <fsipc+0xa5>
+  8014ea:	83 ff 0d             	cmp    $0xd,%edi
+  8014ed:	74 78                	je     801567 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8014ef:	48 b8 0f 0e 80 00 00 	movabs $0x800e0f,%rax
+  8014f6:	00 00 00 
+  8014f9:	ff d0                	call   *%rax
+  8014fb:	89 c7                	mov    %eax,%edi
+  8014fd:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  801504:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80150b:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  801512:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801518:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80151f:	00 00 00 
+  801522:	44 89 e6             	mov    %r12d,%esi
+  801525:	48 b8 f8 45 80 00 00 	movabs $0x8045f8,%rax
+  80152c:	00 00 00 
+  80152f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  801531:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801538:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  801539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801542:	4c 89 ee             	mov    %r13,%rsi
+  801545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80154a:	48 b8 d4 45 80 00 00 	movabs $0x8045d4,%rax
+  801551:	00 00 00 
+  801554:	ff d0                	call   *%rax
+  801556:	89 c3                	mov    %eax,%ebx
+}
+  801558:	89 d8                	mov    %ebx,%eax
+  80155a:	48 83 c4 10          	add    $0x10,%rsp
+  80155e:	5b                   	pop    %rbx
+  80155f:	41 5c                	pop    %r12
+  801561:	41 5d                	pop    %r13
+  801563:	41 5e                	pop    %r14
+  801565:	5d                   	pop    %rbp
+  801566:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801567:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  80156e:	00 00 00 
+  801571:	ff d0                	call   *%rax
+  801573:	49 89 c6             	mov    %rax,%r14
+  801576:	48 85 c0             	test   %rax,%rax
+  801579:	0f 84 70 ff ff ff    	je     8014ef <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80157f:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801583:	48 b8 77 30 80 00 00 	movabs $0x803077,%rax
+  80158a:	00 00 00 
+  80158d:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80158f:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801592:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801599:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80159d:	ba 10 00 00 00       	mov    $0x10,%edx
+  8015a2:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8015a9:	00 00 00 
+  8015ac:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  8015b3:	00 00 00 
+  8015b6:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8015b8:	4c 89 f7             	mov    %r14,%rdi
+  8015bb:	48 b8 10 10 80 00 00 	movabs $0x801010,%rax
+  8015c2:	00 00 00 
+  8015c5:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8015c7:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8015ce:	4c 89 f7             	mov    %r14,%rdi
+  8015d1:	48 b8 3a 31 80 00 00 	movabs $0x80313a,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8015dd:	4c 89 f7             	mov    %r14,%rdi
+  8015e0:	48 b8 c8 30 80 00 00 	movabs $0x8030c8,%rax
+  8015e7:	00 00 00 
+  8015ea:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8015ec:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8015ef:	41 83 fc 05          	cmp    $0x5,%r12d
+  8015f3:	75 04                	jne    8015f9 <fsipc+0x137>
+  8015f5:	85 db                	test   %ebx,%ebx
+  8015f7:	79 14                	jns    80160d <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8015f9:	4c 89 f7             	mov    %r14,%rdi
+  8015fc:	48 b8 ef 30 80 00 00 	movabs $0x8030ef,%rax
+  801603:	00 00 00 
+  801606:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  801608:	e9 4b ff ff ff       	jmp    801558 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80160d:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801611:	ba 88 00 00 00       	mov    $0x88,%edx
+  801616:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80161d:	00 00 00 
+  801620:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+  80162c:	eb cb                	jmp    8015f9 <fsipc+0x137>
+
+000000000080162e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80162e:	55                   	push   %rbp
+  80162f:	48 89 e5             	mov    %rsp,%rbp
+  801632:	41 57                	push   %r15
+  801634:	41 56                	push   %r14
+  801636:	41 55                	push   %r13
+  801638:	41 54                	push   %r12
+  80163a:	53                   	push   %rbx
+  80163b:	48 83 ec 18          	sub    $0x18,%rsp
+  80163f:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  801643:	49 89 f6             	mov    %rsi,%r14
+  801646:	49 89 d4             	mov    %rdx,%r12
+  801649:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80164c:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  801653:	00 00 00 
+  801656:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801658:	48 85 c0             	test   %rax,%rax
+  80165b:	0f 85 96 00 00 00    	jne    8016f7 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  801661:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801668:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801669:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801670:	00 00 00 
+    while (n) {
+  801673:	4d 85 e4             	test   %r12,%r12
+  801676:	74 79                	je     8016f1 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801678:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80167d:	49 39 dc             	cmp    %rbx,%r12
+  801680:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801684:	48 89 da             	mov    %rbx,%rdx
+  801687:	4c 89 f6             	mov    %r14,%rsi
+  80168a:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801691:	00 00 00 
+  801694:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  80169b:	00 00 00 
+  80169e:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8016a0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8016a4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8016a7:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8016aa:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8016ad:	44 01 e8             	add    %r13d,%eax
+  8016b0:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8016b4:	41 0f 44 c5          	cmove  %r13d,%eax
+  8016b8:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8016bc:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8016c0:	48 89 da             	mov    %rbx,%rdx
+  8016c3:	be 00 00 00 00       	mov    $0x0,%esi
+  8016c8:	bf 04 00 00 00       	mov    $0x4,%edi
+  8016cd:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+        if (res < 0)
+  8016d9:	85 c0                	test   %eax,%eax
+  8016db:	78 4a                	js     801727 <devfile_write_direct+0xf9>
+        buf += res;
+  8016dd:	48 98                	cltq
+  8016df:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8016e2:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8016e6:	49 29 c4             	sub    %rax,%r12
+  8016e9:	75 8d                	jne    801678 <devfile_write_direct+0x4a>
+    return write;
+  8016eb:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016ef:	eb 27                	jmp    801718 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8016f1:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8016f5:	eb f4                	jmp    8016eb <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8016f7:	45 89 e9             	mov    %r13d,%r9d
+  8016fa:	4d 89 e0             	mov    %r12,%r8
+  8016fd:	4c 89 f1             	mov    %r14,%rcx
+  801700:	ba 04 00 00 00       	mov    $0x4,%edx
+  801705:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801709:	48 89 c7             	mov    %rax,%rdi
+  80170c:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801713:	00 00 00 
+  801716:	ff d0                	call   *%rax
+}
+  801718:	48 83 c4 18          	add    $0x18,%rsp
+  80171c:	5b                   	pop    %rbx
+  80171d:	41 5c                	pop    %r12
+  80171f:	41 5d                	pop    %r13
+  801721:	41 5e                	pop    %r14
+  801723:	41 5f                	pop    %r15
+  801725:	5d                   	pop    %rbp
+  801726:	c3                   	ret
+            return res;
+  801727:	48 98                	cltq
+  801729:	eb ed                	jmp    801718 <devfile_write_direct+0xea>
+
+000000000080172b <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80172b:	55                   	push   %rbp
+  80172c:	48 89 e5             	mov    %rsp,%rbp
+  80172f:	41 54                	push   %r12
+  801731:	53                   	push   %rbx
+  801732:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  801735:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  80173c:	00 00 00 
+  80173f:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  801741:	48 85 c0             	test   %rax,%rax
+  801744:	74 71                	je     8017b7 <fbuf_flush+0x8c>
+  801746:	48 89 c3             	mov    %rax,%rbx
+  801749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80174e:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  801752:	75 05                	jne    801759 <fbuf_flush+0x2e>
+}
+  801754:	5b                   	pop    %rbx
+  801755:	41 5c                	pop    %r12
+  801757:	5d                   	pop    %rbp
+  801758:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  801759:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80175c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  801760:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801767:	00 00 00 
+  80176a:	48 89 de             	mov    %rbx,%rsi
+  80176d:	48 29 c6             	sub    %rax,%rsi
+  801770:	48 c1 fe 03          	sar    $0x3,%rsi
+  801774:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80177b:	aa aa aa 
+  80177e:	48 0f af f0          	imul   %rax,%rsi
+  801782:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801786:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80178b:	48 01 c6             	add    %rax,%rsi
+  80178e:	4c 89 e7             	mov    %r12,%rdi
+  801791:	48 b8 2e 16 80 00 00 	movabs $0x80162e,%rax
+  801798:	00 00 00 
+  80179b:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80179d:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8017a1:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8017a8:	00 
+    return res < 0 ? res : 0;
+  8017a9:	48 85 c0             	test   %rax,%rax
+  8017ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b1:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8017b5:	eb 9d                	jmp    801754 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8017b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017bc:	eb 96                	jmp    801754 <fbuf_flush+0x29>
+
+00000000008017be <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8017be:	55                   	push   %rbp
+  8017bf:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8017c2:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  8017c9:	00 00 00 
+  8017cc:	ff d0                	call   *%rax
+}
+  8017ce:	5d                   	pop    %rbp
+  8017cf:	c3                   	ret
+
+00000000008017d0 <devfile_write>:
+    if (!fd || !buf)
+  8017d0:	48 85 ff             	test   %rdi,%rdi
+  8017d3:	0f 84 d3 01 00 00    	je     8019ac <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8017d9:	55                   	push   %rbp
+  8017da:	48 89 e5             	mov    %rsp,%rbp
+  8017dd:	41 57                	push   %r15
+  8017df:	41 56                	push   %r14
+  8017e1:	41 55                	push   %r13
+  8017e3:	41 54                	push   %r12
+  8017e5:	53                   	push   %rbx
+  8017e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ea:	49 89 fc             	mov    %rdi,%r12
+  8017ed:	49 89 f6             	mov    %rsi,%r14
+  8017f0:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8017f3:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8017f8:	48 85 f6             	test   %rsi,%rsi
+  8017fb:	0f 84 9c 01 00 00    	je     80199d <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  801801:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  801808:	00 00 00 
+  80180b:	ff d0                	call   *%rax
+  80180d:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  801810:	48 85 c0             	test   %rax,%rax
+  801813:	0f 84 a2 00 00 00    	je     8018bb <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801819:	be 00 10 00 00       	mov    $0x1000,%esi
+  80181e:	4c 89 e7             	mov    %r12,%rdi
+  801821:	48 b8 24 02 80 00 00 	movabs $0x800224,%rax
+  801828:	00 00 00 
+  80182b:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  80182d:	83 f8 02             	cmp    $0x2,%eax
+  801830:	0f 8f 85 00 00 00    	jg     8018bb <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  801836:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80183d:	00 00 00 
+  801840:	4d 89 ef             	mov    %r13,%r15
+  801843:	49 29 c7             	sub    %rax,%r15
+  801846:	49 c1 ff 03          	sar    $0x3,%r15
+  80184a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801851:	aa aa aa 
+  801854:	4c 0f af f8          	imul   %rax,%r15
+  801858:	49 c1 e7 0e          	shl    $0xe,%r15
+  80185c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801861:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801864:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801869:	0f 84 d7 00 00 00    	je     801946 <devfile_write+0x176>
+  80186f:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801873:	89 c2                	mov    %eax,%edx
+  801875:	41 03 55 0c          	add    0xc(%r13),%edx
+  801879:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80187e:	75 0f                	jne    80188f <devfile_write+0xbf>
+  801880:	48 01 d8             	add    %rbx,%rax
+  801883:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801889:	0f 86 92 00 00 00    	jbe    801921 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80188f:	4c 89 e7             	mov    %r12,%rdi
+  801892:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  801899:	00 00 00 
+  80189c:	ff d0                	call   *%rax
+  80189e:	85 c0                	test   %eax,%eax
+  8018a0:	78 52                	js     8018f4 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018a2:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018a9:	77 7f                	ja     80192a <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8018ab:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8018b0:	0f 85 c2 00 00 00    	jne    801978 <devfile_write+0x1a8>
+  8018b6:	e9 94 00 00 00       	jmp    80194f <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8018bb:	4c 89 e7             	mov    %r12,%rdi
+  8018be:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	79 07                	jns    8018d5 <devfile_write+0x105>
+  8018ce:	48 98                	cltq
+  8018d0:	e9 c8 00 00 00       	jmp    80199d <devfile_write+0x1cd>
+  8018d5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018da:	48 89 da             	mov    %rbx,%rdx
+  8018dd:	4c 89 f6             	mov    %r14,%rsi
+  8018e0:	4c 89 e7             	mov    %r12,%rdi
+  8018e3:	48 b8 2e 16 80 00 00 	movabs $0x80162e,%rax
+  8018ea:	00 00 00 
+  8018ed:	ff d0                	call   *%rax
+  8018ef:	e9 a9 00 00 00       	jmp    80199d <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8018f4:	48 98                	cltq
+  8018f6:	e9 a2 00 00 00       	jmp    80199d <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018fb:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801900:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801905:	4c 89 fe             	mov    %r15,%rsi
+  801908:	bf 00 00 00 00       	mov    $0x0,%edi
+  80190d:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  801914:	00 00 00 
+  801917:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  801919:	85 c0                	test   %eax,%eax
+  80191b:	79 45                	jns    801962 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80191d:	48 98                	cltq
+  80191f:	eb 7c                	jmp    80199d <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801921:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801928:	76 4e                	jbe    801978 <devfile_write+0x1a8>
+  80192a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80192f:	48 89 da             	mov    %rbx,%rdx
+  801932:	4c 89 f6             	mov    %r14,%rsi
+  801935:	4c 89 e7             	mov    %r12,%rdi
+  801938:	48 b8 2e 16 80 00 00 	movabs $0x80162e,%rax
+  80193f:	00 00 00 
+  801942:	ff d0                	call   *%rax
+  801944:	eb 57                	jmp    80199d <devfile_write+0x1cd>
+  801946:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80194d:	77 db                	ja     80192a <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80194f:	4c 89 ff             	mov    %r15,%rdi
+  801952:	48 b8 f9 2e 80 00 00 	movabs $0x802ef9,%rax
+  801959:	00 00 00 
+  80195c:	ff d0                	call   *%rax
+  80195e:	84 c0                	test   %al,%al
+  801960:	74 99                	je     8018fb <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  801962:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  801967:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80196c:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801970:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801977:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801978:	4c 89 ff             	mov    %r15,%rdi
+  80197b:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80197f:	48 89 da             	mov    %rbx,%rdx
+  801982:	4c 89 f6             	mov    %r14,%rsi
+  801985:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801991:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801995:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80199a:	48 89 d8             	mov    %rbx,%rax
+}
+  80199d:	48 83 c4 08          	add    $0x8,%rsp
+  8019a1:	5b                   	pop    %rbx
+  8019a2:	41 5c                	pop    %r12
+  8019a4:	41 5d                	pop    %r13
+  8019a6:	41 5e                	pop    %r14
+  8019a8:	41 5f                	pop    %r15
+  8019aa:	5d                   	pop    %rbp
+  8019ab:	c3                   	ret
+        return E_INVAL;
+  8019ac:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8019b1:	c3                   	ret
+
+00000000008019b2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8019b2:	55                   	push   %rbp
+  8019b3:	48 89 e5             	mov    %rsp,%rbp
+  8019b6:	41 54                	push   %r12
+  8019b8:	53                   	push   %rbx
+  8019b9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8019bc:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  8019c3:	00 00 00 
+  8019c6:	ff d0                	call   *%rax
+  8019c8:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8019cb:	48 89 df             	mov    %rbx,%rdi
+  8019ce:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  8019d5:	00 00 00 
+  8019d8:	ff d0                	call   *%rax
+  8019da:	48 85 c0             	test   %rax,%rax
+  8019dd:	74 17                	je     8019f6 <devfile_flush+0x44>
+  8019df:	48 89 df             	mov    %rbx,%rdi
+  8019e2:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  8019e9:	00 00 00 
+  8019ec:	ff d0                	call   *%rax
+  8019ee:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019f5:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019f6:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019f9:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  801a00:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  801a02:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a07:	be 00 00 00 00       	mov    $0x0,%esi
+  801a0c:	bf 06 00 00 00       	mov    $0x6,%edi
+  801a11:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  801a18:	00 00 00 
+  801a1b:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  801a1d:	45 85 e4             	test   %r12d,%r12d
+  801a20:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  801a24:	5b                   	pop    %rbx
+  801a25:	41 5c                	pop    %r12
+  801a27:	5d                   	pop    %rbp
+  801a28:	c3                   	ret
+
+0000000000801a29 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  801a29:	55                   	push   %rbp
+  801a2a:	48 89 e5             	mov    %rsp,%rbp
+  801a2d:	41 57                	push   %r15
+  801a2f:	41 56                	push   %r14
+  801a31:	41 55                	push   %r13
+  801a33:	41 54                	push   %r12
+  801a35:	53                   	push   %rbx
+  801a36:	48 83 ec 38          	sub    $0x38,%rsp
+  801a3a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  801a3e:	49 89 f7             	mov    %rsi,%r15
+  801a41:	48 89 d3             	mov    %rdx,%rbx
+  801a44:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  801a47:	48 b8 74 0f 80 00 00 	movabs $0x800f74,%rax
+  801a4e:	00 00 00 
+  801a51:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a53:	48 85 c0             	test   %rax,%rax
+  801a56:	75 20                	jne    801a78 <devfile_read_direct+0x4f>
+    bool map = 1;
+  801a58:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a5d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a64:	00 
+    while (n) {
+  801a65:	48 85 db             	test   %rbx,%rbx
+  801a68:	0f 85 df 00 00 00    	jne    801b4d <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a6e:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a72:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a76:	eb 21                	jmp    801a99 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a78:	45 89 f1             	mov    %r14d,%r9d
+  801a7b:	49 89 d8             	mov    %rbx,%r8
+  801a7e:	4c 89 f9             	mov    %r15,%rcx
+  801a81:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a8a:	48 89 c7             	mov    %rax,%rdi
+  801a8d:	48 b8 5b 10 80 00 00 	movabs $0x80105b,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+}
+  801a99:	48 83 c4 38          	add    $0x38,%rsp
+  801a9d:	5b                   	pop    %rbx
+  801a9e:	41 5c                	pop    %r12
+  801aa0:	41 5d                	pop    %r13
+  801aa2:	41 5e                	pop    %r14
+  801aa4:	41 5f                	pop    %r15
+  801aa6:	5d                   	pop    %rbp
+  801aa7:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801aa8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801aac:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801ab2:	75 1e                	jne    801ad2 <devfile_read_direct+0xa9>
+  801ab4:	e9 e2 00 00 00       	jmp    801b9b <devfile_read_direct+0x172>
+            if (!res) return read;
+  801ab9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801abd:	eb da                	jmp    801a99 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801abf:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801ac3:	0f 85 d0 01 00 00    	jne    801c99 <devfile_read_direct+0x270>
+            map = 0;
+  801ac9:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801acd:	eb 03                	jmp    801ad2 <devfile_read_direct+0xa9>
+  801acf:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801ad2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801ad7:	48 39 d3             	cmp    %rdx,%rbx
+  801ada:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801ade:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801ae2:	8b 40 0c             	mov    0xc(%rax),%eax
+  801ae5:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801aec:	00 00 00 
+  801aef:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801af1:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801af5:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801af9:	be 00 00 00 00       	mov    $0x0,%esi
+  801afe:	bf 03 00 00 00       	mov    $0x3,%edi
+  801b03:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+        if (res <= 0)
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	0f 8e 63 01 00 00    	jle    801c7a <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801b17:	4c 63 e0             	movslq %eax,%r12
+  801b1a:	4c 89 e2             	mov    %r12,%rdx
+  801b1d:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801b24:	00 00 00 
+  801b27:	4c 89 ff             	mov    %r15,%rdi
+  801b2a:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  801b31:	00 00 00 
+  801b34:	ff d0                	call   *%rax
+        buf += res;
+  801b36:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801b39:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801b3c:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801b40:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801b44:	48 85 db             	test   %rbx,%rbx
+  801b47:	0f 84 25 ff ff ff    	je     801a72 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801b4d:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801b50:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801b54:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801b58:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b5c:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b63:	0f 97 c2             	seta   %dl
+  801b66:	20 c2                	and    %al,%dl
+  801b68:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b6b:	0f 84 5e ff ff ff    	je     801acf <devfile_read_direct+0xa6>
+  801b71:	4c 89 fa             	mov    %r15,%rdx
+  801b74:	4d 89 fd             	mov    %r15,%r13
+  801b77:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b7e:	0f 85 4e ff ff ff    	jne    801ad2 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b84:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b88:	0f 84 1a ff ff ff    	je     801aa8 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b8e:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b95:	0f 85 37 ff ff ff    	jne    801ad2 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b9b:	48 89 d8             	mov    %rbx,%rax
+  801b9e:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801ba4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801ba9:	48 39 c8             	cmp    %rcx,%rax
+  801bac:	48 0f 47 c1          	cmova  %rcx,%rax
+  801bb0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801bb4:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801bb8:	49 89 d4             	mov    %rdx,%r12
+  801bbb:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801bbf:	48 b8 9a 2e 80 00 00 	movabs $0x802e9a,%rax
+  801bc6:	00 00 00 
+  801bc9:	ff d0                	call   *%rax
+  801bcb:	a8 40                	test   $0x40,%al
+  801bcd:	0f 85 b9 00 00 00    	jne    801c8c <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801bd3:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801bda:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801bde:	49 39 c5             	cmp    %rax,%r13
+  801be1:	72 d8                	jb     801bbb <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801be3:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801be7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bee:	00 00 00 
+  801bf1:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801bf5:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801bf8:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801bfa:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801bfe:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801c02:	48 b8 0f 0e 80 00 00 	movabs $0x800e0f,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+  801c0e:	89 c7                	mov    %eax,%edi
+  801c10:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801c16:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801c1b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801c22:	00 00 00 
+  801c25:	be 0e 00 00 00       	mov    $0xe,%esi
+  801c2a:	48 b8 f8 45 80 00 00 	movabs $0x8045f8,%rax
+  801c31:	00 00 00 
+  801c34:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801c36:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801c3b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801c3f:	4c 89 fe             	mov    %r15,%rsi
+  801c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c47:	48 b8 d4 45 80 00 00 	movabs $0x8045d4,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  801c53:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801c56:	48 85 d2             	test   %rdx,%rdx
+  801c59:	0f 84 5a fe ff ff    	je     801ab9 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c5f:	0f 8e 5a fe ff ff    	jle    801abf <devfile_read_direct+0x96>
+                buf += res;
+  801c65:	48 98                	cltq
+  801c67:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c6a:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c6d:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c71:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c75:	e9 ca fe ff ff       	jmp    801b44 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c7a:	41 89 c5             	mov    %eax,%r13d
+  801c7d:	48 98                	cltq
+  801c7f:	45 85 ed             	test   %r13d,%r13d
+  801c82:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c87:	e9 0d fe ff ff       	jmp    801a99 <devfile_read_direct+0x70>
+            map = 0;
+  801c8c:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c90:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c94:	e9 39 fe ff ff       	jmp    801ad2 <devfile_read_direct+0xa9>
+  801c99:	48 89 d0             	mov    %rdx,%rax
+  801c9c:	e9 f8 fd ff ff       	jmp    801a99 <devfile_read_direct+0x70>
+
+0000000000801ca1 <devfile_read>:
+    if (!fd || !buf)
+  801ca1:	48 85 ff             	test   %rdi,%rdi
+  801ca4:	0f 84 21 02 00 00    	je     801ecb <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801caa:	55                   	push   %rbp
+  801cab:	48 89 e5             	mov    %rsp,%rbp
+  801cae:	41 57                	push   %r15
+  801cb0:	41 56                	push   %r14
+  801cb2:	41 55                	push   %r13
+  801cb4:	41 54                	push   %r12
+  801cb6:	53                   	push   %rbx
+  801cb7:	48 83 ec 28          	sub    $0x28,%rsp
+  801cbb:	48 89 fb             	mov    %rdi,%rbx
+  801cbe:	49 89 f4             	mov    %rsi,%r12
+  801cc1:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801cc4:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801cc9:	48 85 f6             	test   %rsi,%rsi
+  801ccc:	74 4b                	je     801d19 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801cce:	48 b8 de 0f 80 00 00 	movabs $0x800fde,%rax
+  801cd5:	00 00 00 
+  801cd8:	ff d0                	call   *%rax
+  801cda:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cdd:	48 85 c0             	test   %rax,%rax
+  801ce0:	74 22                	je     801d04 <devfile_read+0x63>
+  801ce2:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801ce9:	77 19                	ja     801d04 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801ceb:	be 00 10 00 00       	mov    $0x1000,%esi
+  801cf0:	48 89 df             	mov    %rbx,%rdi
+  801cf3:	48 b8 24 02 80 00 00 	movabs $0x800224,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cff:	83 f8 02             	cmp    $0x2,%eax
+  801d02:	7e 40                	jle    801d44 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801d04:	48 89 df             	mov    %rbx,%rdi
+  801d07:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  801d0e:	00 00 00 
+  801d11:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801d13:	85 c0                	test   %eax,%eax
+  801d15:	79 11                	jns    801d28 <devfile_read+0x87>
+  801d17:	48 98                	cltq
+}
+  801d19:	48 83 c4 28          	add    $0x28,%rsp
+  801d1d:	5b                   	pop    %rbx
+  801d1e:	41 5c                	pop    %r12
+  801d20:	41 5d                	pop    %r13
+  801d22:	41 5e                	pop    %r14
+  801d24:	41 5f                	pop    %r15
+  801d26:	5d                   	pop    %rbp
+  801d27:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801d28:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801d2d:	4c 89 ea             	mov    %r13,%rdx
+  801d30:	4c 89 e6             	mov    %r12,%rsi
+  801d33:	48 89 df             	mov    %rbx,%rdi
+  801d36:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801d3d:	00 00 00 
+  801d40:	ff d0                	call   *%rax
+  801d42:	eb d5                	jmp    801d19 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801d44:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801d48:	48 89 df             	mov    %rbx,%rdi
+  801d4b:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  801d52:	00 00 00 
+  801d55:	ff d0                	call   *%rax
+  801d57:	85 c0                	test   %eax,%eax
+  801d59:	0f 88 33 01 00 00    	js     801e92 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d5f:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d66:	00 00 00 
+  801d69:	4c 89 f0             	mov    %r14,%rax
+  801d6c:	48 29 d0             	sub    %rdx,%rax
+  801d6f:	48 c1 f8 03          	sar    $0x3,%rax
+  801d73:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d7a:	aa aa aa 
+  801d7d:	48 0f af c2          	imul   %rdx,%rax
+  801d81:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d85:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d89:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d8c:	41 39 06             	cmp    %eax,(%r14)
+  801d8f:	75 0d                	jne    801d9e <devfile_read+0xfd>
+  801d91:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d94:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d98:	0f 84 fb 00 00 00    	je     801e99 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d9e:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801da3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801da7:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801daa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801dae:	48 89 c7             	mov    %rax,%rdi
+  801db1:	48 b8 f9 2e 80 00 00 	movabs $0x802ef9,%rax
+  801db8:	00 00 00 
+  801dbb:	ff d0                	call   *%rax
+  801dbd:	84 c0                	test   %al,%al
+  801dbf:	75 27                	jne    801de8 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801dc1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801dc6:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801dcb:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801dcf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd4:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801de0:	85 c0                	test   %eax,%eax
+  801de2:	0f 88 dc 00 00 00    	js     801ec4 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801de8:	44 89 f8             	mov    %r15d,%eax
+  801deb:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801df0:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801df2:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801df9:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801dfa:	8b 43 10             	mov    0x10(%rbx),%eax
+  801dfd:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801e01:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801e04:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801e09:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801e0d:	48 89 df             	mov    %rbx,%rdi
+  801e10:	48 b8 29 1a 80 00 00 	movabs $0x801a29,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801e1c:	48 85 c0             	test   %rax,%rax
+  801e1f:	0f 88 f4 fe ff ff    	js     801d19 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801e25:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801e28:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801e2b:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801e2e:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801e32:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801e36:	48 63 d1             	movslq %ecx,%rdx
+  801e39:	48 01 d0             	add    %rdx,%rax
+  801e3c:	4d 63 ff             	movslq %r15d,%r15
+  801e3f:	4c 29 f8             	sub    %r15,%rax
+  801e42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e47:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801e4b:	48 85 c0             	test   %rax,%rax
+  801e4e:	0f 8e c5 fe ff ff    	jle    801d19 <devfile_read+0x78>
+    n = MIN(n, res);
+  801e54:	4c 39 e8             	cmp    %r13,%rax
+  801e57:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e5b:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e5e:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e62:	48 63 f6             	movslq %esi,%rsi
+  801e65:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e6a:	48 01 c6             	add    %rax,%rsi
+  801e6d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e71:	48 01 c6             	add    %rax,%rsi
+  801e74:	4c 89 ea             	mov    %r13,%rdx
+  801e77:	4c 89 e7             	mov    %r12,%rdi
+  801e7a:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  801e81:	00 00 00 
+  801e84:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e86:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e8a:	4c 89 e8             	mov    %r13,%rax
+  801e8d:	e9 87 fe ff ff       	jmp    801d19 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e92:	48 98                	cltq
+  801e94:	e9 80 fe ff ff       	jmp    801d19 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e99:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e9d:	41 39 d7             	cmp    %edx,%r15d
+  801ea0:	0f 8c f8 fe ff ff    	jl     801d9e <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801ea6:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801eaa:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801ead:	41 39 cf             	cmp    %ecx,%r15d
+  801eb0:	0f 8d e8 fe ff ff    	jge    801d9e <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801eb6:	4d 63 ff             	movslq %r15d,%r15
+  801eb9:	4c 29 f8             	sub    %r15,%rax
+  801ebc:	48 63 d2             	movslq %edx,%rdx
+  801ebf:	48 01 d0             	add    %rdx,%rax
+  801ec2:	eb 87                	jmp    801e4b <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801ec4:	48 98                	cltq
+  801ec6:	e9 4e fe ff ff       	jmp    801d19 <devfile_read+0x78>
+        return E_INVAL;
+  801ecb:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801ed0:	c3                   	ret
+
+0000000000801ed1 <fs_channel>:
+fs_channel(bool enable) {
+  801ed1:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801ed3:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801eda:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801edc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ee1:	40 84 ff             	test   %dil,%dil
+  801ee4:	74 47                	je     801f2d <fs_channel+0x5c>
+  801ee6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801eed:	00 00 00 
+  801ef0:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801ef6:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801efd:	00 00 00 
+  801f00:	3b 08                	cmp    (%rax),%ecx
+  801f02:	74 29                	je     801f2d <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801f04:	55                   	push   %rbp
+  801f05:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801f08:	48 b8 51 0e 80 00 00 	movabs $0x800e51,%rax
+  801f0f:	00 00 00 
+  801f12:	ff d0                	call   *%rax
+  801f14:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801f16:	85 c0                	test   %eax,%eax
+  801f18:	78 04                	js     801f1e <fs_channel+0x4d>
+}
+  801f1a:	89 d0                	mov    %edx,%eax
+  801f1c:	5d                   	pop    %rbp
+  801f1d:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801f1e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f25:	00 00 00 
+  801f28:	c6 00 00             	movb   $0x0,(%rax)
+  801f2b:	eb ed                	jmp    801f1a <fs_channel+0x49>
+}
+  801f2d:	89 d0                	mov    %edx,%eax
+  801f2f:	c3                   	ret
+
+0000000000801f30 <open>:
+open(const char *path, int mode) {
+  801f30:	55                   	push   %rbp
+  801f31:	48 89 e5             	mov    %rsp,%rbp
+  801f34:	41 55                	push   %r13
+  801f36:	41 54                	push   %r12
+  801f38:	53                   	push   %rbx
+  801f39:	48 83 ec 18          	sub    $0x18,%rsp
+  801f3d:	49 89 fc             	mov    %rdi,%r12
+  801f40:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801f43:	48 b8 ff 3d 80 00 00 	movabs $0x803dff,%rax
+  801f4a:	00 00 00 
+  801f4d:	ff d0                	call   *%rax
+  801f4f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f55:	0f 87 8f 00 00 00    	ja     801fea <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f5b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f5f:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  801f66:	00 00 00 
+  801f69:	ff d0                	call   *%rax
+  801f6b:	89 c3                	mov    %eax,%ebx
+  801f6d:	85 c0                	test   %eax,%eax
+  801f6f:	78 55                	js     801fc6 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f71:	4c 89 e6             	mov    %r12,%rsi
+  801f74:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f7b:	00 00 00 
+  801f7e:	48 89 df             	mov    %rbx,%rdi
+  801f81:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f8d:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f99:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f9d:	bf 01 00 00 00       	mov    $0x1,%edi
+  801fa2:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+  801fae:	89 c3                	mov    %eax,%ebx
+  801fb0:	85 c0                	test   %eax,%eax
+  801fb2:	78 1f                	js     801fd3 <open+0xa3>
+    return fd2num(fd);
+  801fb4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fb8:	48 b8 dd 06 80 00 00 	movabs $0x8006dd,%rax
+  801fbf:	00 00 00 
+  801fc2:	ff d0                	call   *%rax
+  801fc4:	89 c3                	mov    %eax,%ebx
+}
+  801fc6:	89 d8                	mov    %ebx,%eax
+  801fc8:	48 83 c4 18          	add    $0x18,%rsp
+  801fcc:	5b                   	pop    %rbx
+  801fcd:	41 5c                	pop    %r12
+  801fcf:	41 5d                	pop    %r13
+  801fd1:	5d                   	pop    %rbp
+  801fd2:	c3                   	ret
+        fd_close(fd, 0);
+  801fd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fdc:	48 b8 26 08 80 00 00 	movabs $0x800826,%rax
+  801fe3:	00 00 00 
+  801fe6:	ff d0                	call   *%rax
+        return res;
+  801fe8:	eb dc                	jmp    801fc6 <open+0x96>
+        return -E_BAD_PATH;
+  801fea:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801fef:	eb d5                	jmp    801fc6 <open+0x96>
+
+0000000000801ff1 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801ff1:	55                   	push   %rbp
+  801ff2:	48 89 e5             	mov    %rsp,%rbp
+  801ff5:	41 56                	push   %r14
+  801ff7:	41 55                	push   %r13
+  801ff9:	41 54                	push   %r12
+  801ffb:	53                   	push   %rbx
+  801ffc:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802000:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802007:	00 00 00 
+  80200a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80200f:	49 bd 6b 07 80 00 00 	movabs $0x80076b,%r13
+  802016:	00 00 00 
+  802019:	49 be 2b 17 80 00 00 	movabs $0x80172b,%r14
+  802020:	00 00 00 
+  802023:	eb 0c                	jmp    802031 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802025:	83 c3 01             	add    $0x1,%ebx
+  802028:	49 83 c4 18          	add    $0x18,%r12
+  80202c:	83 fb 20             	cmp    $0x20,%ebx
+  80202f:	74 1d                	je     80204e <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802031:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802036:	74 ed                	je     802025 <file_flush_buffers+0x34>
+  802038:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80203c:	89 df                	mov    %ebx,%edi
+  80203e:	41 ff d5             	call   *%r13
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 e0                	js     802025 <file_flush_buffers+0x34>
+  802045:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802049:	41 ff d6             	call   *%r14
+  80204c:	eb d7                	jmp    802025 <file_flush_buffers+0x34>
+}
+  80204e:	48 83 c4 10          	add    $0x10,%rsp
+  802052:	5b                   	pop    %rbx
+  802053:	41 5c                	pop    %r12
+  802055:	41 5d                	pop    %r13
+  802057:	41 5e                	pop    %r14
+  802059:	5d                   	pop    %rbp
+  80205a:	c3                   	ret
+
+000000000080205b <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+  80205f:	41 54                	push   %r12
+  802061:	53                   	push   %rbx
+  802062:	49 89 fc             	mov    %rdi,%r12
+  802065:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802067:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  80206e:	00 00 00 
+  802071:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802073:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80207a:	00 00 00 
+  80207d:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802082:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802084:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802087:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208c:	be 00 00 00 00       	mov    $0x0,%esi
+  802091:	bf 02 00 00 00       	mov    $0x2,%edi
+  802096:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  80209d:	00 00 00 
+  8020a0:	ff d0                	call   *%rax
+}
+  8020a2:	5b                   	pop    %rbx
+  8020a3:	41 5c                	pop    %r12
+  8020a5:	5d                   	pop    %rbp
+  8020a6:	c3                   	ret
+
+00000000008020a7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8020a7:	55                   	push   %rbp
+  8020a8:	48 89 e5             	mov    %rsp,%rbp
+  8020ab:	41 54                	push   %r12
+  8020ad:	53                   	push   %rbx
+  8020ae:	49 89 fc             	mov    %rdi,%r12
+  8020b1:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8020b4:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  8020bb:	00 00 00 
+  8020be:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8020c0:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8020c5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8020cc:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8020ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8020d8:	bf 05 00 00 00       	mov    $0x5,%edi
+  8020dd:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8020e4:	00 00 00 
+  8020e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8020e9:	85 c0                	test   %eax,%eax
+  8020eb:	78 3d                	js     80212a <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020ed:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8020f4:	00 00 00 
+  8020f7:	4c 89 e6             	mov    %r12,%rsi
+  8020fa:	48 89 df             	mov    %rbx,%rdi
+  8020fd:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  802104:	00 00 00 
+  802107:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802109:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802110:	00 
+  802111:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802117:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80211e:	00 
+  80211f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802125:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80212a:	5b                   	pop    %rbx
+  80212b:	41 5c                	pop    %r12
+  80212d:	5d                   	pop    %rbp
+  80212e:	c3                   	ret
+
+000000000080212f <remove>:
+remove(const char *path) {
+  80212f:	55                   	push   %rbp
+  802130:	48 89 e5             	mov    %rsp,%rbp
+  802133:	53                   	push   %rbx
+  802134:	48 83 ec 08          	sub    $0x8,%rsp
+  802138:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80213b:	48 b8 ff 3d 80 00 00 	movabs $0x803dff,%rax
+  802142:	00 00 00 
+  802145:	ff d0                	call   *%rax
+  802147:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80214d:	77 3a                	ja     802189 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80214f:	48 89 de             	mov    %rbx,%rsi
+  802152:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802159:	00 00 00 
+  80215c:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216d:	be 00 00 00 00       	mov    $0x0,%esi
+  802172:	bf 07 00 00 00       	mov    $0x7,%edi
+  802177:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+}
+  802183:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802187:	c9                   	leave
+  802188:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802189:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80218e:	eb f3                	jmp    802183 <remove+0x54>
+
+0000000000802190 <sync>:
+sync(void) {
+  802190:	55                   	push   %rbp
+  802191:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802194:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  80219b:	00 00 00 
+  80219e:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8021a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a5:	be 00 00 00 00       	mov    $0x0,%esi
+  8021aa:	bf 08 00 00 00       	mov    $0x8,%edi
+  8021af:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8021b6:	00 00 00 
+  8021b9:	ff d0                	call   *%rax
+}
+  8021bb:	5d                   	pop    %rbp
+  8021bc:	c3                   	ret
+
+00000000008021bd <fsync>:
+fsync(int fdnum) {
+  8021bd:	55                   	push   %rbp
+  8021be:	48 89 e5             	mov    %rsp,%rbp
+  8021c1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8021c5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8021c9:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  8021d0:	00 00 00 
+  8021d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021d5:	85 c0                	test   %eax,%eax
+  8021d7:	78 4b                	js     802224 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021d9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8021dd:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  8021e4:	00 00 00 
+  8021e7:	8b 00                	mov    (%rax),%eax
+  8021e9:	39 02                	cmp    %eax,(%rdx)
+  8021eb:	75 39                	jne    802226 <fsync+0x69>
+    file_flush_buffers();
+  8021ed:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  8021f4:	00 00 00 
+  8021f7:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8021f9:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021fd:	8b 40 0c             	mov    0xc(%rax),%eax
+  802200:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802207:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80220e:	be 00 00 00 00       	mov    $0x0,%esi
+  802213:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802218:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  80221f:	00 00 00 
+  802222:	ff d0                	call   *%rax
+}
+  802224:	c9                   	leave
+  802225:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802226:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80222b:	eb f7                	jmp    802224 <fsync+0x67>
+
+000000000080222d <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80222d:	55                   	push   %rbp
+  80222e:	48 89 e5             	mov    %rsp,%rbp
+  802231:	53                   	push   %rbx
+  802232:	48 83 ec 08          	sub    $0x8,%rsp
+  802236:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802239:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223e:	be 00 00 00 00       	mov    $0x0,%esi
+  802243:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802248:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  80224f:	00 00 00 
+  802252:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802254:	85 c0                	test   %eax,%eax
+  802256:	78 2d                	js     802285 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  802258:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80225f:	00 00 00 
+  802262:	48 8b 10             	mov    (%rax),%rdx
+  802265:	48 89 13             	mov    %rdx,(%rbx)
+  802268:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80226c:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802270:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802274:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802278:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80227c:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802280:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802285:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802289:	c9                   	leave
+  80228a:	c3                   	ret
+
+000000000080228b <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80228b:	55                   	push   %rbp
+  80228c:	48 89 e5             	mov    %rsp,%rbp
+  80228f:	53                   	push   %rbx
+  802290:	48 83 ec 08          	sub    $0x8,%rsp
+  802294:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802297:	ba 00 00 00 00       	mov    $0x0,%edx
+  80229c:	be 00 00 00 00       	mov    $0x0,%esi
+  8022a1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8022a6:	48 b8 c2 14 80 00 00 	movabs $0x8014c2,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8022b2:	85 c0                	test   %eax,%eax
+  8022b4:	78 3d                	js     8022f3 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8022b6:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8022bd:	00 00 00 
+  8022c0:	48 8b 10             	mov    (%rax),%rdx
+  8022c3:	48 89 13             	mov    %rdx,(%rbx)
+  8022c6:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8022ca:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8022ce:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8022d2:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8022d6:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8022da:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8022de:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8022e2:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8022e6:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8022ea:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8022ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022f3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022f7:	c9                   	leave
+  8022f8:	c3                   	ret
+
+00000000008022f9 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8022f9:	55                   	push   %rbp
+  8022fa:	48 89 e5             	mov    %rsp,%rbp
+  8022fd:	41 57                	push   %r15
+  8022ff:	41 56                	push   %r14
+  802301:	41 55                	push   %r13
+  802303:	41 54                	push   %r12
+  802305:	53                   	push   %rbx
+  802306:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80230a:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  802311:	00 
+  802312:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802319:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80231f:	0f 85 43 01 00 00    	jne    802468 <munmap+0x16f>
+  802325:	49 89 ff             	mov    %rdi,%r15
+  802328:	4c 39 f7             	cmp    %r14,%rdi
+  80232b:	0f 87 37 01 00 00    	ja     802468 <munmap+0x16f>
+  802331:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  802338:	00 00 00 
+  80233b:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  802341:	eb 2c                	jmp    80236f <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  802343:	4c 39 f8             	cmp    %r15,%rax
+  802346:	0f 83 85 00 00 00    	jae    8023d1 <munmap+0xd8>
+            m->mm_end = start;
+  80234c:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802351:	48 83 c3 18          	add    $0x18,%rbx
+  802355:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80235c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802363:	00 00 00 
+  802366:	48 39 c3             	cmp    %rax,%rbx
+  802369:	0f 84 d0 00 00 00    	je     80243f <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80236f:	49 89 dc             	mov    %rbx,%r12
+  802372:	48 8b 03             	mov    (%rbx),%rax
+  802375:	4c 39 f0             	cmp    %r14,%rax
+  802378:	73 d7                	jae    802351 <munmap+0x58>
+  80237a:	48 85 c0             	test   %rax,%rax
+  80237d:	74 d2                	je     802351 <munmap+0x58>
+  80237f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802383:	49 39 d7             	cmp    %rdx,%r15
+  802386:	73 c9                	jae    802351 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802388:	49 39 d6             	cmp    %rdx,%r14
+  80238b:	73 b6                	jae    802343 <munmap+0x4a>
+  80238d:	49 39 c7             	cmp    %rax,%r15
+  802390:	76 b1                	jbe    802343 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802392:	4c 89 ef             	mov    %r13,%rdi
+  802395:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8023a1:	48 85 c0             	test   %rax,%rax
+  8023a4:	0f 84 c5 00 00 00    	je     80246f <munmap+0x176>
+            *tail = *m;
+  8023aa:	48 8b 13             	mov    (%rbx),%rdx
+  8023ad:	48 89 10             	mov    %rdx,(%rax)
+  8023b0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8023b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8023b8:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8023bc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8023c0:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8023c3:	44 89 f2             	mov    %r14d,%edx
+  8023c6:	2b 13                	sub    (%rbx),%edx
+  8023c8:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8023cb:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8023cf:	eb 80                	jmp    802351 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8023d1:	49 39 d6             	cmp    %rdx,%r14
+  8023d4:	73 18                	jae    8023ee <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8023d6:	44 89 f2             	mov    %r14d,%edx
+  8023d9:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8023de:	29 c2                	sub    %eax,%edx
+  8023e0:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8023e5:	4d 89 34 24          	mov    %r14,(%r12)
+  8023e9:	e9 63 ff ff ff       	jmp    802351 <munmap+0x58>
+    m->mm_start = 0;
+  8023ee:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8023f5:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8023f6:	4c 89 e6             	mov    %r12,%rsi
+  8023f9:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802400:	00 00 00 
+  802403:	48 29 c6             	sub    %rax,%rsi
+  802406:	48 c1 fe 03          	sar    $0x3,%rsi
+  80240a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802411:	aa aa aa 
+  802414:	48 0f af f0          	imul   %rax,%rsi
+  802418:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80241c:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  802421:	48 01 c6             	add    %rax,%rsi
+  802424:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802429:	bf 00 00 00 00       	mov    $0x0,%edi
+  80242e:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802435:	00 00 00 
+  802438:	ff d0                	call   *%rax
+}
+  80243a:	e9 12 ff ff ff       	jmp    802351 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80243f:	4c 89 f2             	mov    %r14,%rdx
+  802442:	4c 29 fa             	sub    %r15,%rdx
+  802445:	4c 89 fe             	mov    %r15,%rsi
+  802448:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244d:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802454:	00 00 00 
+  802457:	ff d0                	call   *%rax
+}
+  802459:	48 83 c4 08          	add    $0x8,%rsp
+  80245d:	5b                   	pop    %rbx
+  80245e:	41 5c                	pop    %r12
+  802460:	41 5d                	pop    %r13
+  802462:	41 5e                	pop    %r14
+  802464:	41 5f                	pop    %r15
+  802466:	5d                   	pop    %rbp
+  802467:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802468:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80246d:	eb ea                	jmp    802459 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80246f:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802474:	eb e3                	jmp    802459 <munmap+0x160>
+
+0000000000802476 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802476:	55                   	push   %rbp
+  802477:	48 89 e5             	mov    %rsp,%rbp
+  80247a:	41 57                	push   %r15
+  80247c:	41 56                	push   %r14
+  80247e:	41 55                	push   %r13
+  802480:	41 54                	push   %r12
+  802482:	53                   	push   %rbx
+  802483:	48 83 ec 28          	sub    $0x28,%rsp
+  802487:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80248b:	49 89 f5             	mov    %rsi,%r13
+  80248e:	41 89 d6             	mov    %edx,%r14d
+  802491:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802494:	41 89 cc             	mov    %ecx,%r12d
+  802497:	44 89 c7             	mov    %r8d,%edi
+  80249a:	44 89 cb             	mov    %r9d,%ebx
+  80249d:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8024a1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8024a5:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  8024ac:	00 00 00 
+  8024af:	ff d0                	call   *%rax
+  8024b1:	41 89 c7             	mov    %eax,%r15d
+  8024b4:	85 c0                	test   %eax,%eax
+  8024b6:	0f 88 ae 01 00 00    	js     80266a <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8024bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024c0:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  8024c7:	00 00 00 
+  8024ca:	8b 32                	mov    (%rdx),%esi
+  8024cc:	39 30                	cmp    %esi,(%rax)
+  8024ce:	0f 85 7a 02 00 00    	jne    80274e <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8024d4:	8b 40 08             	mov    0x8(%rax),%eax
+  8024d7:	83 e0 03             	and    $0x3,%eax
+  8024da:	83 f8 01             	cmp    $0x1,%eax
+  8024dd:	0f 84 76 02 00 00    	je     802759 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8024e3:	4d 85 ed             	test   %r13,%r13
+  8024e6:	0f 84 78 02 00 00    	je     802764 <mmap+0x2ee>
+  8024ec:	85 db                	test   %ebx,%ebx
+  8024ee:	0f 88 70 02 00 00    	js     802764 <mmap+0x2ee>
+  8024f4:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8024fa:	41 89 df             	mov    %ebx,%r15d
+  8024fd:	0f 85 6c 02 00 00    	jne    80276f <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802503:	44 89 f0             	mov    %r14d,%eax
+  802506:	83 e0 fd             	and    $0xfffffffd,%eax
+  802509:	83 f8 04             	cmp    $0x4,%eax
+  80250c:	0f 85 68 02 00 00    	jne    80277a <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802512:	44 89 e1             	mov    %r12d,%ecx
+  802515:	83 e1 01             	and    $0x1,%ecx
+  802518:	0f 95 c2             	setne  %dl
+  80251b:	44 89 e0             	mov    %r12d,%eax
+  80251e:	d1 e8                	shr    %eax
+  802520:	83 f0 01             	xor    $0x1,%eax
+  802523:	83 e0 01             	and    $0x1,%eax
+  802526:	38 c2                	cmp    %al,%dl
+  802528:	0f 85 57 02 00 00    	jne    802785 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80252e:	85 c9                	test   %ecx,%ecx
+  802530:	74 0a                	je     80253c <mmap+0xc6>
+  802532:	41 f6 c6 02          	test   $0x2,%r14b
+  802536:	0f 85 54 02 00 00    	jne    802790 <mmap+0x31a>
+    file_flush_buffers();
+  80253c:	48 b8 f1 1f 80 00 00 	movabs $0x801ff1,%rax
+  802543:	00 00 00 
+  802546:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  802548:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80254f:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  802556:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80255a:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80255d:	41 f6 c4 04          	test   $0x4,%r12b
+  802561:	0f 84 15 01 00 00    	je     80267c <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  802567:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80256a:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802570:	0f 85 25 02 00 00    	jne    80279b <mmap+0x325>
+  802576:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80257a:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802581:	00 00 00 
+  802584:	48 39 c2             	cmp    %rax,%rdx
+  802587:	0f 82 19 02 00 00    	jb     8027a6 <mmap+0x330>
+  80258d:	48 39 c7             	cmp    %rax,%rdi
+  802590:	0f 87 10 02 00 00    	ja     8027a6 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802596:	4c 89 ee             	mov    %r13,%rsi
+  802599:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  8025a0:	00 00 00 
+  8025a3:	ff d0                	call   *%rax
+  8025a5:	85 c0                	test   %eax,%eax
+  8025a7:	0f 88 04 02 00 00    	js     8027b1 <mmap+0x33b>
+    if (!handler) {
+  8025ad:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8025b4:	00 00 00 
+  8025b7:	80 38 00             	cmpb   $0x0,(%rax)
+  8025ba:	75 2b                	jne    8025e7 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8025bc:	48 bf 91 13 80 00 00 	movabs $0x801391,%rdi
+  8025c3:	00 00 00 
+  8025c6:	48 b8 ee 42 80 00 00 	movabs $0x8042ee,%rax
+  8025cd:	00 00 00 
+  8025d0:	ff d0                	call   *%rax
+  8025d2:	85 c0                	test   %eax,%eax
+  8025d4:	0f 88 ea 01 00 00    	js     8027c4 <mmap+0x34e>
+        handler = 1;
+  8025da:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8025e1:	00 00 00 
+  8025e4:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8025e7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8025eb:	48 b8 30 14 80 00 00 	movabs $0x801430,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+  8025f7:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8025fa:	48 85 c0             	test   %rax,%rax
+  8025fd:	0f 84 c9 01 00 00    	je     8027cc <mmap+0x356>
+    m->mm_start = va;
+  802603:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  802606:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80260a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80260e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  802611:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  802615:	44 89 e0             	mov    %r12d,%eax
+  802618:	c1 e0 06             	shl    $0x6,%eax
+  80261b:	25 80 00 00 00       	and    $0x80,%eax
+  802620:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  802623:	09 f0                	or     %esi,%eax
+  802625:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  802629:	41 f6 c4 08          	test   $0x8,%r12b
+  80262d:	74 31                	je     802660 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80262f:	48 39 d3             	cmp    %rdx,%rbx
+  802632:	73 2c                	jae    802660 <mmap+0x1ea>
+  802634:	ba 00 00 04 00       	mov    $0x40000,%edx
+  802639:	48 89 de             	mov    %rbx,%rsi
+  80263c:	4c 89 f7             	mov    %r14,%rdi
+  80263f:	48 b8 80 12 80 00 00 	movabs $0x801280,%rax
+  802646:	00 00 00 
+  802649:	ff d0                	call   *%rax
+  80264b:	49 89 c4             	mov    %rax,%r12
+  80264e:	48 85 c0             	test   %rax,%rax
+  802651:	0f 8e d7 00 00 00    	jle    80272e <mmap+0x2b8>
+            va += n;
+  802657:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80265a:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80265e:	72 d4                	jb     802634 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  802660:	49 8b 06             	mov    (%r14),%rax
+  802663:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802667:	48 89 06             	mov    %rax,(%rsi)
+}
+  80266a:	44 89 f8             	mov    %r15d,%eax
+  80266d:	48 83 c4 28          	add    $0x28,%rsp
+  802671:	5b                   	pop    %rbx
+  802672:	41 5c                	pop    %r12
+  802674:	41 5d                	pop    %r13
+  802676:	41 5e                	pop    %r14
+  802678:	41 5f                	pop    %r15
+  80267a:	5d                   	pop    %rbp
+  80267b:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80267c:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802683:	00 00 00 
+  802686:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802689:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802690:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802693:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802698:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80269f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8026a2:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8026a9:	00 00 00 
+  8026ac:	48 39 d7             	cmp    %rdx,%rdi
+  8026af:	73 1c                	jae    8026cd <mmap+0x257>
+        return -E_NO_MEM;
+  8026b1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026b7:	eb b1                	jmp    80266a <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8026b9:	48 83 c0 01          	add    $0x1,%rax
+  8026bd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8026c1:	77 3f                	ja     802702 <mmap+0x28c>
+  8026c3:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8026c8:	48 39 d7             	cmp    %rdx,%rdi
+  8026cb:	72 2a                	jb     8026f7 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8026cd:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8026d1:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8026d5:	48 39 d1             	cmp    %rdx,%rcx
+  8026d8:	73 df                	jae    8026b9 <mmap+0x243>
+  8026da:	48 85 c9             	test   %rcx,%rcx
+  8026dd:	74 da                	je     8026b9 <mmap+0x243>
+  8026df:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8026e3:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8026e8:	48 39 d3             	cmp    %rdx,%rbx
+  8026eb:	73 cc                	jae    8026b9 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8026ed:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8026f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f5:	eb cc                	jmp    8026c3 <mmap+0x24d>
+        return -E_NO_MEM;
+  8026f7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026fd:	e9 68 ff ff ff       	jmp    80266a <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  802702:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  802707:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80270e:	00 00 00 
+  802711:	48 39 c2             	cmp    %rax,%rdx
+  802714:	0f 82 9f 00 00 00    	jb     8027b9 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80271a:	48 85 db             	test   %rbx,%rbx
+  80271d:	0f 85 8a fe ff ff    	jne    8025ad <mmap+0x137>
+        return -E_NO_MEM;
+  802723:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802729:	e9 3c ff ff ff       	jmp    80266a <mmap+0x1f4>
+        if (n < 0) {
+  80272e:	0f 89 2c ff ff ff    	jns    802660 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  802734:	49 8b 3e             	mov    (%r14),%rdi
+  802737:	4c 89 ee             	mov    %r13,%rsi
+  80273a:	48 b8 f9 22 80 00 00 	movabs $0x8022f9,%rax
+  802741:	00 00 00 
+  802744:	ff d0                	call   *%rax
+            return n;
+  802746:	45 89 e7             	mov    %r12d,%r15d
+  802749:	e9 1c ff ff ff       	jmp    80266a <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80274e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802754:	e9 11 ff ff ff       	jmp    80266a <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802759:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80275f:	e9 06 ff ff ff       	jmp    80266a <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802764:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80276a:	e9 fb fe ff ff       	jmp    80266a <mmap+0x1f4>
+  80276f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802775:	e9 f0 fe ff ff       	jmp    80266a <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80277a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802780:	e9 e5 fe ff ff       	jmp    80266a <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802785:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80278b:	e9 da fe ff ff       	jmp    80266a <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802790:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802796:	e9 cf fe ff ff       	jmp    80266a <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80279b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8027a1:	e9 c4 fe ff ff       	jmp    80266a <mmap+0x1f4>
+  8027a6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8027ac:	e9 b9 fe ff ff       	jmp    80266a <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8027b1:	41 89 c7             	mov    %eax,%r15d
+  8027b4:	e9 b1 fe ff ff       	jmp    80266a <mmap+0x1f4>
+        return -E_NO_MEM;
+  8027b9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8027bf:	e9 a6 fe ff ff       	jmp    80266a <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8027c4:	41 89 c7             	mov    %eax,%r15d
+  8027c7:	e9 9e fe ff ff       	jmp    80266a <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8027cc:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8027d2:	e9 93 fe ff ff       	jmp    80266a <mmap+0x1f4>
+
+00000000008027d7 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8027d7:	55                   	push   %rbp
+  8027d8:	48 89 e5             	mov    %rsp,%rbp
+  8027db:	41 54                	push   %r12
+  8027dd:	53                   	push   %rbx
+  8027de:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8027e1:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  8027e8:	00 00 00 
+  8027eb:	ff d0                	call   *%rax
+  8027ed:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8027f0:	48 be a0 47 80 00 00 	movabs $0x8047a0,%rsi
+  8027f7:	00 00 00 
+  8027fa:	48 89 df             	mov    %rbx,%rdi
+  8027fd:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  802804:	00 00 00 
+  802807:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802809:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80280e:	41 2b 04 24          	sub    (%r12),%eax
+  802812:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  802818:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80281f:	00 00 00 
+    stat->st_dev = &devpipe;
+  802822:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  802829:	00 00 00 
+  80282c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  802833:	b8 00 00 00 00       	mov    $0x0,%eax
+  802838:	5b                   	pop    %rbx
+  802839:	41 5c                	pop    %r12
+  80283b:	5d                   	pop    %rbp
+  80283c:	c3                   	ret
+
+000000000080283d <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80283d:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802840:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  802846:	8b 17                	mov    (%rdi),%edx
+  802848:	85 d2                	test   %edx,%edx
+  80284a:	75 01                	jne    80284d <pipe_wakeup+0x10>
+  80284c:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80284d:	55                   	push   %rbp
+  80284e:	48 89 e5             	mov    %rsp,%rbp
+  802851:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  802854:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80285a:	be 00 04 00 00       	mov    $0x400,%esi
+  80285f:	48 b8 eb 05 80 00 00 	movabs $0x8005eb,%rax
+  802866:	00 00 00 
+  802869:	ff d0                	call   *%rax
+}
+  80286b:	5d                   	pop    %rbp
+  80286c:	c3                   	ret
+
+000000000080286d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80286d:	55                   	push   %rbp
+  80286e:	48 89 e5             	mov    %rsp,%rbp
+  802871:	41 55                	push   %r13
+  802873:	41 54                	push   %r12
+  802875:	53                   	push   %rbx
+  802876:	48 83 ec 08          	sub    $0x8,%rsp
+  80287a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80287d:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+  802889:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80288c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802891:	4c 89 e6             	mov    %r12,%rsi
+  802894:	bf 00 00 00 00       	mov    $0x0,%edi
+  802899:	49 bc 05 03 80 00 00 	movabs $0x800305,%r12
+  8028a0:	00 00 00 
+  8028a3:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028a6:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8028aa:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8028ae:	49 bd 3d 28 80 00 00 	movabs $0x80283d,%r13
+  8028b5:	00 00 00 
+  8028b8:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8028bb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8028bf:	48 89 de             	mov    %rbx,%rsi
+  8028c2:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8028c5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8028ca:	48 89 de             	mov    %rbx,%rsi
+  8028cd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028d2:	41 ff d4             	call   *%r12
+  8028d5:	48 83 c4 08          	add    $0x8,%rsp
+  8028d9:	5b                   	pop    %rbx
+  8028da:	41 5c                	pop    %r12
+  8028dc:	41 5d                	pop    %r13
+  8028de:	5d                   	pop    %rbp
+  8028df:	c3                   	ret
+
+00000000008028e0 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8028e0:	55                   	push   %rbp
+  8028e1:	48 89 e5             	mov    %rsp,%rbp
+  8028e4:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8028e7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028f1:	48 b8 48 02 80 00 00 	movabs $0x800248,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+  8028fd:	85 c0                	test   %eax,%eax
+  8028ff:	0f 94 c0             	sete   %al
+  802902:	0f b6 c0             	movzbl %al,%eax
+}
+  802905:	5d                   	pop    %rbp
+  802906:	c3                   	ret
+
+0000000000802907 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802907:	55                   	push   %rbp
+  802908:	48 89 e5             	mov    %rsp,%rbp
+  80290b:	41 57                	push   %r15
+  80290d:	41 56                	push   %r14
+  80290f:	41 55                	push   %r13
+  802911:	41 54                	push   %r12
+  802913:	53                   	push   %rbx
+  802914:	48 83 ec 38          	sub    $0x38,%rsp
+  802918:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80291c:	49 89 f4             	mov    %rsi,%r12
+  80291f:	49 89 d7             	mov    %rdx,%r15
+  802922:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802926:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  80292d:	00 00 00 
+  802930:	ff d0                	call   *%rax
+  802932:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802935:	4d 85 ff             	test   %r15,%r15
+  802938:	0f 84 f1 00 00 00    	je     802a2f <devpipe_write+0x128>
+  80293e:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  802942:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  802946:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80294a:	49 bd e0 28 80 00 00 	movabs $0x8028e0,%r13
+  802951:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802954:	49 bf 3d 28 80 00 00 	movabs $0x80283d,%r15
+  80295b:	00 00 00 
+  80295e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802962:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802966:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80296a:	8b 73 04             	mov    0x4(%rbx),%esi
+  80296d:	48 63 ce             	movslq %esi,%rcx
+  802970:	48 63 03             	movslq (%rbx),%rax
+  802973:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802979:	48 39 c1             	cmp    %rax,%rcx
+  80297c:	72 64                	jb     8029e2 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80297e:	48 89 de             	mov    %rbx,%rsi
+  802981:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802985:	41 ff d5             	call   *%r13
+  802988:	85 c0                	test   %eax,%eax
+  80298a:	0f 85 b9 00 00 00    	jne    802a49 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802990:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802994:	4c 89 f7             	mov    %r14,%rdi
+  802997:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80299a:	8b 43 04             	mov    0x4(%rbx),%eax
+  80299d:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8029a4:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8029ab:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8029b1:	8b 03                	mov    (%rbx),%eax
+  8029b3:	41 39 c4             	cmp    %eax,%r12d
+  8029b6:	75 b2                	jne    80296a <devpipe_write+0x63>
+  8029b8:	48 89 de             	mov    %rbx,%rsi
+  8029bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8029bf:	41 ff d5             	call   *%r13
+  8029c2:	85 c0                	test   %eax,%eax
+  8029c4:	75 a0                	jne    802966 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8029c6:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8029cb:	44 89 e6             	mov    %r12d,%esi
+  8029ce:	48 89 df             	mov    %rbx,%rdi
+  8029d1:	48 b8 cd 05 80 00 00 	movabs $0x8005cd,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+  8029dd:	e9 7c ff ff ff       	jmp    80295e <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8029e2:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8029e6:	41 0f b6 38          	movzbl (%r8),%edi
+  8029ea:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8029f1:	80 80 80 
+  8029f4:	48 89 c8             	mov    %rcx,%rax
+  8029f7:	48 f7 e2             	mul    %rdx
+  8029fa:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029fe:	48 89 d0             	mov    %rdx,%rax
+  802a01:	48 c1 e0 08          	shl    $0x8,%rax
+  802a05:	48 29 d0             	sub    %rdx,%rax
+  802a08:	48 c1 e0 04          	shl    $0x4,%rax
+  802a0c:	48 29 c1             	sub    %rax,%rcx
+  802a0f:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  802a14:	83 c6 01             	add    $0x1,%esi
+  802a17:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802a1a:	49 83 c0 01          	add    $0x1,%r8
+  802a1e:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  802a22:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a26:	49 39 c0             	cmp    %rax,%r8
+  802a29:	0f 85 2f ff ff ff    	jne    80295e <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802a2f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802a33:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802a37:	48 b8 3d 28 80 00 00 	movabs $0x80283d,%rax
+  802a3e:	00 00 00 
+  802a41:	ff d0                	call   *%rax
+    return n;
+  802a43:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a47:	eb 05                	jmp    802a4e <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a49:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a4e:	48 83 c4 38          	add    $0x38,%rsp
+  802a52:	5b                   	pop    %rbx
+  802a53:	41 5c                	pop    %r12
+  802a55:	41 5d                	pop    %r13
+  802a57:	41 5e                	pop    %r14
+  802a59:	41 5f                	pop    %r15
+  802a5b:	5d                   	pop    %rbp
+  802a5c:	c3                   	ret
+
+0000000000802a5d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a5d:	55                   	push   %rbp
+  802a5e:	48 89 e5             	mov    %rsp,%rbp
+  802a61:	41 57                	push   %r15
+  802a63:	41 56                	push   %r14
+  802a65:	41 55                	push   %r13
+  802a67:	41 54                	push   %r12
+  802a69:	53                   	push   %rbx
+  802a6a:	48 83 ec 28          	sub    $0x28,%rsp
+  802a6e:	49 89 fd             	mov    %rdi,%r13
+  802a71:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a75:	49 89 d4             	mov    %rdx,%r12
+  802a78:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a7c:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  802a83:	00 00 00 
+  802a86:	ff d0                	call   *%rax
+  802a88:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a8b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a91:	49 bf e0 28 80 00 00 	movabs $0x8028e0,%r15
+  802a98:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a9b:	4d 85 e4             	test   %r12,%r12
+  802a9e:	0f 84 d5 00 00 00    	je     802b79 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802aa4:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802aa8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802aac:	8b 03                	mov    (%rbx),%eax
+  802aae:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802ab1:	75 7a                	jne    802b2d <devpipe_read+0xd0>
+            if (i > 0) {
+  802ab3:	4d 85 f6             	test   %r14,%r14
+  802ab6:	75 50                	jne    802b08 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802ab8:	48 89 de             	mov    %rbx,%rsi
+  802abb:	4c 89 ef             	mov    %r13,%rdi
+  802abe:	41 ff d7             	call   *%r15
+  802ac1:	85 c0                	test   %eax,%eax
+  802ac3:	0f 85 c9 00 00 00    	jne    802b92 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802ac9:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802acc:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802ad3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802ad9:	8b 43 04             	mov    0x4(%rbx),%eax
+  802adc:	41 39 c4             	cmp    %eax,%r12d
+  802adf:	75 cb                	jne    802aac <devpipe_read+0x4f>
+  802ae1:	48 89 de             	mov    %rbx,%rsi
+  802ae4:	4c 89 ef             	mov    %r13,%rdi
+  802ae7:	41 ff d7             	call   *%r15
+  802aea:	85 c0                	test   %eax,%eax
+  802aec:	75 be                	jne    802aac <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802aee:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802af3:	44 89 e6             	mov    %r12d,%esi
+  802af6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802afa:	48 b8 cd 05 80 00 00 	movabs $0x8005cd,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+  802b06:	eb a4                	jmp    802aac <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b08:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b0c:	48 89 de             	mov    %rbx,%rsi
+  802b0f:	48 b8 3d 28 80 00 00 	movabs $0x80283d,%rax
+  802b16:	00 00 00 
+  802b19:	ff d0                	call   *%rax
+                return i;
+  802b1b:	4c 89 f0             	mov    %r14,%rax
+}
+  802b1e:	48 83 c4 28          	add    $0x28,%rsp
+  802b22:	5b                   	pop    %rbx
+  802b23:	41 5c                	pop    %r12
+  802b25:	41 5d                	pop    %r13
+  802b27:	41 5e                	pop    %r14
+  802b29:	41 5f                	pop    %r15
+  802b2b:	5d                   	pop    %rbp
+  802b2c:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802b2d:	48 63 c8             	movslq %eax,%rcx
+  802b30:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802b37:	80 80 80 
+  802b3a:	48 89 c8             	mov    %rcx,%rax
+  802b3d:	48 f7 e2             	mul    %rdx
+  802b40:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802b44:	48 89 d0             	mov    %rdx,%rax
+  802b47:	48 c1 e0 08          	shl    $0x8,%rax
+  802b4b:	48 29 d0             	sub    %rdx,%rax
+  802b4e:	48 c1 e0 04          	shl    $0x4,%rax
+  802b52:	48 89 c2             	mov    %rax,%rdx
+  802b55:	48 89 c8             	mov    %rcx,%rax
+  802b58:	48 29 d0             	sub    %rdx,%rax
+  802b5b:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b60:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b64:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b68:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b6b:	49 83 c6 01          	add    $0x1,%r14
+  802b6f:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b73:	0f 85 2b ff ff ff    	jne    802aa4 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b79:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b7d:	48 89 de             	mov    %rbx,%rsi
+  802b80:	48 b8 3d 28 80 00 00 	movabs $0x80283d,%rax
+  802b87:	00 00 00 
+  802b8a:	ff d0                	call   *%rax
+    return n;
+  802b8c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b90:	eb 8c                	jmp    802b1e <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b97:	eb 85                	jmp    802b1e <devpipe_read+0xc1>
+
+0000000000802b99 <pipe>:
+pipe(int pfd[2]) {
+  802b99:	55                   	push   %rbp
+  802b9a:	48 89 e5             	mov    %rsp,%rbp
+  802b9d:	41 55                	push   %r13
+  802b9f:	41 54                	push   %r12
+  802ba1:	53                   	push   %rbx
+  802ba2:	48 83 ec 18          	sub    $0x18,%rsp
+  802ba6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802ba9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802bad:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  802bb4:	00 00 00 
+  802bb7:	ff d0                	call   *%rax
+  802bb9:	89 c3                	mov    %eax,%ebx
+  802bbb:	85 c0                	test   %eax,%eax
+  802bbd:	0f 88 a0 01 00 00    	js     802d63 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802bc3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bcd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802bd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bd6:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  802bdd:	00 00 00 
+  802be0:	ff d0                	call   *%rax
+  802be2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802be4:	85 c0                	test   %eax,%eax
+  802be6:	0f 88 77 01 00 00    	js     802d63 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bec:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802bf0:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  802bf7:	00 00 00 
+  802bfa:	ff d0                	call   *%rax
+  802bfc:	89 c3                	mov    %eax,%ebx
+  802bfe:	85 c0                	test   %eax,%eax
+  802c00:	0f 88 43 01 00 00    	js     802d49 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802c06:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c0b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c10:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802c14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c19:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  802c20:	00 00 00 
+  802c23:	ff d0                	call   *%rax
+  802c25:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802c27:	85 c0                	test   %eax,%eax
+  802c29:	0f 88 1a 01 00 00    	js     802d49 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802c2f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c33:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  802c3a:	00 00 00 
+  802c3d:	ff d0                	call   *%rax
+  802c3f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802c42:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c4c:	48 89 c6             	mov    %rax,%rsi
+  802c4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c54:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+  802c60:	89 c3                	mov    %eax,%ebx
+  802c62:	85 c0                	test   %eax,%eax
+  802c64:	0f 88 c5 00 00 00    	js     802d2f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c6a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c6e:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  802c75:	00 00 00 
+  802c78:	ff d0                	call   *%rax
+  802c7a:	48 89 c1             	mov    %rax,%rcx
+  802c7d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c83:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c89:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8e:	4c 89 ee             	mov    %r13,%rsi
+  802c91:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c96:	48 b8 b5 02 80 00 00 	movabs $0x8002b5,%rax
+  802c9d:	00 00 00 
+  802ca0:	ff d0                	call   *%rax
+  802ca2:	89 c3                	mov    %eax,%ebx
+  802ca4:	85 c0                	test   %eax,%eax
+  802ca6:	78 6e                	js     802d16 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802ca8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cad:	4c 89 ef             	mov    %r13,%rdi
+  802cb0:	48 b8 24 02 80 00 00 	movabs $0x800224,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+  802cbc:	83 f8 02             	cmp    $0x2,%eax
+  802cbf:	0f 85 ab 00 00 00    	jne    802d70 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802cc5:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802ccc:	00 00 
+  802cce:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cd2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802cd4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802cd8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802cdf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802ce3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802ce5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802ce9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802cf0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802cf4:	48 bb dd 06 80 00 00 	movabs $0x8006dd,%rbx
+  802cfb:	00 00 00 
+  802cfe:	ff d3                	call   *%rbx
+  802d00:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802d04:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802d08:	ff d3                	call   *%rbx
+  802d0a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802d0f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802d14:	eb 4d                	jmp    802d63 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802d16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d1b:	4c 89 ee             	mov    %r13,%rsi
+  802d1e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d23:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802d2a:	00 00 00 
+  802d2d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802d2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d34:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802d38:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d3d:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802d44:	00 00 00 
+  802d47:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802d49:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d4e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d52:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d57:	48 b8 05 03 80 00 00 	movabs $0x800305,%rax
+  802d5e:	00 00 00 
+  802d61:	ff d0                	call   *%rax
+}
+  802d63:	89 d8                	mov    %ebx,%eax
+  802d65:	48 83 c4 18          	add    $0x18,%rsp
+  802d69:	5b                   	pop    %rbx
+  802d6a:	41 5c                	pop    %r12
+  802d6c:	41 5d                	pop    %r13
+  802d6e:	5d                   	pop    %rbp
+  802d6f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d70:	48 b9 d0 47 80 00 00 	movabs $0x8047d0,%rcx
+  802d77:	00 00 00 
+  802d7a:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  802d81:	00 00 00 
+  802d84:	be 50 00 00 00       	mov    $0x50,%esi
+  802d89:	48 bf bc 47 80 00 00 	movabs $0x8047bc,%rdi
+  802d90:	00 00 00 
+  802d93:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d98:	49 b8 c8 33 80 00 00 	movabs $0x8033c8,%r8
+  802d9f:	00 00 00 
+  802da2:	41 ff d0             	call   *%r8
+
+0000000000802da5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802da5:	55                   	push   %rbp
+  802da6:	48 89 e5             	mov    %rsp,%rbp
+  802da9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802dad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802db1:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802dbd:	85 c0                	test   %eax,%eax
+  802dbf:	78 23                	js     802de4 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802dc1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802dc5:	48 b8 ef 06 80 00 00 	movabs $0x8006ef,%rax
+  802dcc:	00 00 00 
+  802dcf:	ff d0                	call   *%rax
+  802dd1:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802dd4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802dd8:	48 b8 e0 28 80 00 00 	movabs $0x8028e0,%rax
+  802ddf:	00 00 00 
+  802de2:	ff d0                	call   *%rax
+}
+  802de4:	c9                   	leave
+  802de5:	c3                   	ret
+
+0000000000802de6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802de6:	48 89 f8             	mov    %rdi,%rax
+  802de9:	48 c1 e8 27          	shr    $0x27,%rax
+  802ded:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802df4:	01 00 00 
+  802df7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dfb:	f6 c2 01             	test   $0x1,%dl
+  802dfe:	74 6d                	je     802e6d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e00:	48 89 f8             	mov    %rdi,%rax
+  802e03:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802e07:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e0e:	01 00 00 
+  802e11:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e15:	f6 c2 01             	test   $0x1,%dl
+  802e18:	74 62                	je     802e7c <get_uvpt_entry+0x96>
+  802e1a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e21:	01 00 00 
+  802e24:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e28:	f6 c2 80             	test   $0x80,%dl
+  802e2b:	75 4f                	jne    802e7c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e2d:	48 89 f8             	mov    %rdi,%rax
+  802e30:	48 c1 e8 15          	shr    $0x15,%rax
+  802e34:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e3b:	01 00 00 
+  802e3e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e42:	f6 c2 01             	test   $0x1,%dl
+  802e45:	74 44                	je     802e8b <get_uvpt_entry+0xa5>
+  802e47:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e4e:	01 00 00 
+  802e51:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e55:	f6 c2 80             	test   $0x80,%dl
+  802e58:	75 31                	jne    802e8b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802e5a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e5e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e65:	01 00 00 
+  802e68:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e6c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e6d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e74:	01 00 00 
+  802e77:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e7b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e7c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e83:	01 00 00 
+  802e86:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e8a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e8b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e92:	01 00 00 
+  802e95:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e99:	c3                   	ret
+
+0000000000802e9a <get_prot>:
+
+int
+get_prot(void *va) {
+  802e9a:	55                   	push   %rbp
+  802e9b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e9e:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802ea5:	00 00 00 
+  802ea8:	ff d0                	call   *%rax
+  802eaa:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802ead:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802eb2:	89 c1                	mov    %eax,%ecx
+  802eb4:	83 c9 04             	or     $0x4,%ecx
+  802eb7:	f6 c2 01             	test   $0x1,%dl
+  802eba:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802ebd:	89 c1                	mov    %eax,%ecx
+  802ebf:	83 c9 02             	or     $0x2,%ecx
+  802ec2:	f6 c2 02             	test   $0x2,%dl
+  802ec5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802ec8:	89 c1                	mov    %eax,%ecx
+  802eca:	83 c9 01             	or     $0x1,%ecx
+  802ecd:	48 85 d2             	test   %rdx,%rdx
+  802ed0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802ed3:	89 c1                	mov    %eax,%ecx
+  802ed5:	83 c9 40             	or     $0x40,%ecx
+  802ed8:	f6 c6 04             	test   $0x4,%dh
+  802edb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802ede:	5d                   	pop    %rbp
+  802edf:	c3                   	ret
+
+0000000000802ee0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802ee0:	55                   	push   %rbp
+  802ee1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802ee4:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ef0:	48 c1 e8 06          	shr    $0x6,%rax
+  802ef4:	83 e0 01             	and    $0x1,%eax
+}
+  802ef7:	5d                   	pop    %rbp
+  802ef8:	c3                   	ret
+
+0000000000802ef9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ef9:	55                   	push   %rbp
+  802efa:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802efd:	48 b8 e6 2d 80 00 00 	movabs $0x802de6,%rax
+  802f04:	00 00 00 
+  802f07:	ff d0                	call   *%rax
+  802f09:	83 e0 01             	and    $0x1,%eax
+}
+  802f0c:	5d                   	pop    %rbp
+  802f0d:	c3                   	ret
+
+0000000000802f0e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802f0e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802f15:	01 00 00 
+  802f18:	a8 01                	test   $0x1,%al
+  802f1a:	75 06                	jne    802f22 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f21:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802f22:	55                   	push   %rbp
+  802f23:	48 89 e5             	mov    %rsp,%rbp
+  802f26:	41 57                	push   %r15
+  802f28:	41 56                	push   %r14
+  802f2a:	41 55                	push   %r13
+  802f2c:	41 54                	push   %r12
+  802f2e:	53                   	push   %rbx
+  802f2f:	48 83 ec 28          	sub    $0x28,%rsp
+  802f33:	49 89 fe             	mov    %rdi,%r14
+  802f36:	49 89 f7             	mov    %rsi,%r15
+  802f39:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802f40:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f41:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802f48:	01 00 00 
+  802f4b:	e9 ae 00 00 00       	jmp    802ffe <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f50:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f57:	49 83 ec 01          	sub    $0x1,%r12
+  802f5b:	74 2d                	je     802f8a <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f5d:	48 89 d8             	mov    %rbx,%rax
+  802f60:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f64:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f69:	f6 c2 01             	test   $0x1,%dl
+  802f6c:	74 e2                	je     802f50 <foreach_shared_region+0x42>
+  802f6e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f73:	f6 c4 04             	test   $0x4,%ah
+  802f76:	74 d8                	je     802f50 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f78:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f7f:	4c 89 fa             	mov    %r15,%rdx
+  802f82:	48 89 df             	mov    %rbx,%rdi
+  802f85:	41 ff d6             	call   *%r14
+  802f88:	eb c6                	jmp    802f50 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f8a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f91:	00 
+  802f92:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f97:	74 4a                	je     802fe3 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f99:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f9d:	48 c1 e8 15          	shr    $0x15,%rax
+  802fa1:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802fa8:	01 00 00 
+  802fab:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802faf:	a8 01                	test   $0x1,%al
+  802fb1:	74 d7                	je     802f8a <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802fb3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802fb7:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802fbe:	48 39 c3             	cmp    %rax,%rbx
+  802fc1:	73 c7                	jae    802f8a <foreach_shared_region+0x7c>
+  802fc3:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802fca:	48 39 d0             	cmp    %rdx,%rax
+  802fcd:	4d 19 e4             	sbb    %r12,%r12
+  802fd0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802fd7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802fde:	e9 7a ff ff ff       	jmp    802f5d <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802fe3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802fea:	40 
+  802feb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fef:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802ff6:	00 00 00 
+  802ff9:	48 39 c1             	cmp    %rax,%rcx
+  802ffc:	74 50                	je     80304e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802ffe:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803002:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803006:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80300d:	01 00 00 
+  803010:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803014:	a8 01                	test   $0x1,%al
+  803016:	74 cb                	je     802fe3 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803018:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80301c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803023:	48 39 c1             	cmp    %rax,%rcx
+  803026:	73 bb                	jae    802fe3 <foreach_shared_region+0xd5>
+  803028:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80302f:	48 39 d0             	cmp    %rdx,%rax
+  803032:	48 19 c0             	sbb    %rax,%rax
+  803035:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80303b:	48 05 00 02 00 00    	add    $0x200,%rax
+  803041:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803045:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803049:	e9 4b ff ff ff       	jmp    802f99 <foreach_shared_region+0x8b>
+  80304e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803053:	48 83 c4 28          	add    $0x28,%rsp
+  803057:	5b                   	pop    %rbx
+  803058:	41 5c                	pop    %r12
+  80305a:	41 5d                	pop    %r13
+  80305c:	41 5e                	pop    %r14
+  80305e:	41 5f                	pop    %r15
+  803060:	5d                   	pop    %rbp
+  803061:	c3                   	ret
+
+0000000000803062 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803062:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803068:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80306f:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803076:	c3                   	ret
+
+0000000000803077 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803077:	8b 47 40             	mov    0x40(%rdi),%eax
+  80307a:	8b 17                	mov    (%rdi),%edx
+  80307c:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80307e:	83 f8 0f             	cmp    $0xf,%eax
+  803081:	77 13                	ja     803096 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803083:	8b 47 40             	mov    0x40(%rdi),%eax
+  803086:	83 e0 0f             	and    $0xf,%eax
+  803089:	48 c1 e0 09          	shl    $0x9,%rax
+  80308d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803094:	00 
+  803095:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309b:	c3                   	ret
+
+000000000080309c <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80309c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80309f:	83 c0 01             	add    $0x1,%eax
+  8030a2:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030a5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8030ab:	8b 57 04             	mov    0x4(%rdi),%edx
+  8030ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8030b3:	85 d2                	test   %edx,%edx
+  8030b5:	75 04                	jne    8030bb <chan_publish+0x1f>
+  8030b7:	83 e0 01             	and    $0x1,%eax
+}
+  8030ba:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8030bb:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8030be:	85 c0                	test   %eax,%eax
+  8030c0:	0f 95 c0             	setne  %al
+  8030c3:	0f b6 c0             	movzbl %al,%eax
+  8030c6:	eb ef                	jmp    8030b7 <chan_publish+0x1b>
+
+00000000008030c8 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8030c8:	8b 47 40             	mov    0x40(%rdi),%eax
+  8030cb:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8030cd:	29 d0                	sub    %edx,%eax
+  8030cf:	83 e8 01             	sub    $0x1,%eax
+  8030d2:	83 f8 0f             	cmp    $0xf,%eax
+  8030d5:	77 12                	ja     8030e9 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8030d7:	8b 07                	mov    (%rdi),%eax
+  8030d9:	83 e0 0f             	and    $0xf,%eax
+  8030dc:	48 c1 e0 09          	shl    $0x9,%rax
+  8030e0:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8030e7:	00 
+  8030e8:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8030e9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030ee:	c3                   	ret
+
+00000000008030ef <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8030ef:	8b 07                	mov    (%rdi),%eax
+  8030f1:	83 c0 01             	add    $0x1,%eax
+  8030f4:	89 07                	mov    %eax,(%rdi)
+}
+  8030f6:	c3                   	ret
+
+00000000008030f7 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8030f7:	55                   	push   %rbp
+  8030f8:	48 89 e5             	mov    %rsp,%rbp
+  8030fb:	53                   	push   %rbx
+  8030fc:	48 83 ec 08          	sub    $0x8,%rsp
+  803100:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803103:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80310a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803110:	48 b8 c8 30 80 00 00 	movabs $0x8030c8,%rax
+  803117:	00 00 00 
+  80311a:	ff d0                	call   *%rax
+  80311c:	48 85 c0             	test   %rax,%rax
+  80311f:	74 12                	je     803133 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803121:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803128:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80312d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803131:	c9                   	leave
+  803132:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803133:	b8 01 00 00 00       	mov    $0x1,%eax
+  803138:	eb f3                	jmp    80312d <chan_arm+0x36>
+
+000000000080313a <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80313a:	55                   	push   %rbp
+  80313b:	48 89 e5             	mov    %rsp,%rbp
+  80313e:	41 56                	push   %r14
+  803140:	41 55                	push   %r13
+  803142:	41 54                	push   %r12
+  803144:	53                   	push   %rbx
+  803145:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803148:	49 bc f7 30 80 00 00 	movabs $0x8030f7,%r12
+  80314f:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803152:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803156:	49 bd cd 05 80 00 00 	movabs $0x8005cd,%r13
+  80315d:	00 00 00 
+    while (chan_arm(r))
+  803160:	eb 0d                	jmp    80316f <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803162:	8b 33                	mov    (%rbx),%esi
+  803164:	ba 00 00 00 00       	mov    $0x0,%edx
+  803169:	4c 89 f7             	mov    %r14,%rdi
+  80316c:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80316f:	48 89 df             	mov    %rbx,%rdi
+  803172:	41 ff d4             	call   *%r12
+  803175:	84 c0                	test   %al,%al
+  803177:	75 e9                	jne    803162 <chan_wait+0x28>
+}
+  803179:	5b                   	pop    %rbx
+  80317a:	41 5c                	pop    %r12
+  80317c:	41 5d                	pop    %r13
+  80317e:	41 5e                	pop    %r14
+  803180:	5d                   	pop    %rbp
+  803181:	c3                   	ret
+
+0000000000803182 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803182:	55                   	push   %rbp
+  803183:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803186:	48 83 c7 40          	add    $0x40,%rdi
+  80318a:	be 01 00 00 00       	mov    $0x1,%esi
+  80318f:	48 b8 eb 05 80 00 00 	movabs $0x8005eb,%rax
+  803196:	00 00 00 
+  803199:	ff d0                	call   *%rax
+}
+  80319b:	5d                   	pop    %rbp
+  80319c:	c3                   	ret
+
+000000000080319d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80319d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031a2:	c3                   	ret
+
+00000000008031a3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8031a3:	55                   	push   %rbp
+  8031a4:	48 89 e5             	mov    %rsp,%rbp
+  8031a7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8031aa:	48 be f4 47 80 00 00 	movabs $0x8047f4,%rsi
+  8031b1:	00 00 00 
+  8031b4:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+    return 0;
+}
+  8031c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031c5:	5d                   	pop    %rbp
+  8031c6:	c3                   	ret
+
+00000000008031c7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8031c7:	55                   	push   %rbp
+  8031c8:	48 89 e5             	mov    %rsp,%rbp
+  8031cb:	41 57                	push   %r15
+  8031cd:	41 56                	push   %r14
+  8031cf:	41 55                	push   %r13
+  8031d1:	41 54                	push   %r12
+  8031d3:	53                   	push   %rbx
+  8031d4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8031db:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8031e2:	48 85 d2             	test   %rdx,%rdx
+  8031e5:	74 7a                	je     803261 <devcons_write+0x9a>
+  8031e7:	49 89 d6             	mov    %rdx,%r14
+  8031ea:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031f0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8031f5:	49 bf 37 40 80 00 00 	movabs $0x804037,%r15
+  8031fc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031ff:	4c 89 f3             	mov    %r14,%rbx
+  803202:	48 29 f3             	sub    %rsi,%rbx
+  803205:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80320a:	48 39 c3             	cmp    %rax,%rbx
+  80320d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803211:	4c 63 eb             	movslq %ebx,%r13
+  803214:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80321b:	48 01 c6             	add    %rax,%rsi
+  80321e:	4c 89 ea             	mov    %r13,%rdx
+  803221:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803228:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80322b:	4c 89 ee             	mov    %r13,%rsi
+  80322e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803235:	48 b8 27 01 80 00 00 	movabs $0x800127,%rax
+  80323c:	00 00 00 
+  80323f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803241:	41 01 dc             	add    %ebx,%r12d
+  803244:	49 63 f4             	movslq %r12d,%rsi
+  803247:	4c 39 f6             	cmp    %r14,%rsi
+  80324a:	72 b3                	jb     8031ff <devcons_write+0x38>
+    return res;
+  80324c:	49 63 c4             	movslq %r12d,%rax
+}
+  80324f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  803256:	5b                   	pop    %rbx
+  803257:	41 5c                	pop    %r12
+  803259:	41 5d                	pop    %r13
+  80325b:	41 5e                	pop    %r14
+  80325d:	41 5f                	pop    %r15
+  80325f:	5d                   	pop    %rbp
+  803260:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803261:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803267:	eb e3                	jmp    80324c <devcons_write+0x85>
+
+0000000000803269 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803269:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80326c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803271:	48 85 c0             	test   %rax,%rax
+  803274:	74 55                	je     8032cb <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803276:	55                   	push   %rbp
+  803277:	48 89 e5             	mov    %rsp,%rbp
+  80327a:	41 55                	push   %r13
+  80327c:	41 54                	push   %r12
+  80327e:	53                   	push   %rbx
+  80327f:	48 83 ec 08          	sub    $0x8,%rsp
+  803283:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803286:	48 bb 46 01 80 00 00 	movabs $0x800146,%rbx
+  80328d:	00 00 00 
+  803290:	49 bc fb 01 80 00 00 	movabs $0x8001fb,%r12
+  803297:	00 00 00 
+  80329a:	eb 03                	jmp    80329f <devcons_read+0x36>
+  80329c:	41 ff d4             	call   *%r12
+  80329f:	ff d3                	call   *%rbx
+  8032a1:	85 c0                	test   %eax,%eax
+  8032a3:	74 f7                	je     80329c <devcons_read+0x33>
+    if (c < 0) return c;
+  8032a5:	48 63 d0             	movslq %eax,%rdx
+  8032a8:	78 13                	js     8032bd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8032aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032af:	83 f8 04             	cmp    $0x4,%eax
+  8032b2:	74 09                	je     8032bd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8032b4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8032b8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8032bd:	48 89 d0             	mov    %rdx,%rax
+  8032c0:	48 83 c4 08          	add    $0x8,%rsp
+  8032c4:	5b                   	pop    %rbx
+  8032c5:	41 5c                	pop    %r12
+  8032c7:	41 5d                	pop    %r13
+  8032c9:	5d                   	pop    %rbp
+  8032ca:	c3                   	ret
+  8032cb:	48 89 d0             	mov    %rdx,%rax
+  8032ce:	c3                   	ret
+
+00000000008032cf <cputchar>:
+cputchar(int ch) {
+  8032cf:	55                   	push   %rbp
+  8032d0:	48 89 e5             	mov    %rsp,%rbp
+  8032d3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8032d7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8032db:	be 01 00 00 00       	mov    $0x1,%esi
+  8032e0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8032e4:	48 b8 27 01 80 00 00 	movabs $0x800127,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+}
+  8032f0:	c9                   	leave
+  8032f1:	c3                   	ret
+
+00000000008032f2 <getchar>:
+getchar(void) {
+  8032f2:	55                   	push   %rbp
+  8032f3:	48 89 e5             	mov    %rsp,%rbp
+  8032f6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032fa:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032ff:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803303:	bf 00 00 00 00       	mov    $0x0,%edi
+  803308:	48 b8 4e 0a 80 00 00 	movabs $0x800a4e,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+  803314:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  803316:	85 c0                	test   %eax,%eax
+  803318:	78 06                	js     803320 <getchar+0x2e>
+  80331a:	74 08                	je     803324 <getchar+0x32>
+  80331c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  803320:	89 d0                	mov    %edx,%eax
+  803322:	c9                   	leave
+  803323:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  803324:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  803329:	eb f5                	jmp    803320 <getchar+0x2e>
+
+000000000080332b <iscons>:
+iscons(int fdnum) {
+  80332b:	55                   	push   %rbp
+  80332c:	48 89 e5             	mov    %rsp,%rbp
+  80332f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803333:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803337:	48 b8 6b 07 80 00 00 	movabs $0x80076b,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803343:	85 c0                	test   %eax,%eax
+  803345:	78 18                	js     80335f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  803347:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80334b:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803352:	00 00 00 
+  803355:	8b 00                	mov    (%rax),%eax
+  803357:	39 02                	cmp    %eax,(%rdx)
+  803359:	0f 94 c0             	sete   %al
+  80335c:	0f b6 c0             	movzbl %al,%eax
+}
+  80335f:	c9                   	leave
+  803360:	c3                   	ret
+
+0000000000803361 <opencons>:
+opencons(void) {
+  803361:	55                   	push   %rbp
+  803362:	48 89 e5             	mov    %rsp,%rbp
+  803365:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803369:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80336d:	48 b8 0b 07 80 00 00 	movabs $0x80070b,%rax
+  803374:	00 00 00 
+  803377:	ff d0                	call   *%rax
+  803379:	85 c0                	test   %eax,%eax
+  80337b:	78 49                	js     8033c6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80337d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803382:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803387:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80338b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803390:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  803397:	00 00 00 
+  80339a:	ff d0                	call   *%rax
+  80339c:	85 c0                	test   %eax,%eax
+  80339e:	78 26                	js     8033c6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8033a0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033a4:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  8033ab:	00 00 
+  8033ad:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8033af:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8033b3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8033ba:	48 b8 dd 06 80 00 00 	movabs $0x8006dd,%rax
+  8033c1:	00 00 00 
+  8033c4:	ff d0                	call   *%rax
+}
+  8033c6:	c9                   	leave
+  8033c7:	c3                   	ret
+
+00000000008033c8 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8033c8:	55                   	push   %rbp
+  8033c9:	48 89 e5             	mov    %rsp,%rbp
+  8033cc:	41 56                	push   %r14
+  8033ce:	41 55                	push   %r13
+  8033d0:	41 54                	push   %r12
+  8033d2:	53                   	push   %rbx
+  8033d3:	48 83 ec 50          	sub    $0x50,%rsp
+  8033d7:	49 89 fc             	mov    %rdi,%r12
+  8033da:	41 89 f5             	mov    %esi,%r13d
+  8033dd:	48 89 d3             	mov    %rdx,%rbx
+  8033e0:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8033e4:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8033e8:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8033ec:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8033f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033f7:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033fb:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033ff:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803403:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80340a:	00 00 00 
+  80340d:	4c 8b 30             	mov    (%rax),%r14
+  803410:	48 b8 d2 01 80 00 00 	movabs $0x8001d2,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+  80341c:	89 c6                	mov    %eax,%esi
+  80341e:	45 89 e8             	mov    %r13d,%r8d
+  803421:	4c 89 e1             	mov    %r12,%rcx
+  803424:	4c 89 f2             	mov    %r14,%rdx
+  803427:	48 bf 00 48 80 00 00 	movabs $0x804800,%rdi
+  80342e:	00 00 00 
+  803431:	b8 00 00 00 00       	mov    $0x0,%eax
+  803436:	49 bc 18 35 80 00 00 	movabs $0x803518,%r12
+  80343d:	00 00 00 
+  803440:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  803443:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  803447:	48 89 df             	mov    %rbx,%rdi
+  80344a:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+    cprintf("\n");
+  803456:	48 bf 4b 47 80 00 00 	movabs $0x80474b,%rdi
+  80345d:	00 00 00 
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+  803465:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803468:	cc                   	int3
+  803469:	eb fd                	jmp    803468 <_panic+0xa0>
+
+000000000080346b <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80346b:	55                   	push   %rbp
+  80346c:	48 89 e5             	mov    %rsp,%rbp
+  80346f:	53                   	push   %rbx
+  803470:	48 83 ec 08          	sub    $0x8,%rsp
+  803474:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803477:	8b 06                	mov    (%rsi),%eax
+  803479:	8d 50 01             	lea    0x1(%rax),%edx
+  80347c:	89 16                	mov    %edx,(%rsi)
+  80347e:	48 98                	cltq
+  803480:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803485:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80348b:	74 0a                	je     803497 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80348d:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803491:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803495:	c9                   	leave
+  803496:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803497:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80349b:	be ff 00 00 00       	mov    $0xff,%esi
+  8034a0:	48 b8 27 01 80 00 00 	movabs $0x800127,%rax
+  8034a7:	00 00 00 
+  8034aa:	ff d0                	call   *%rax
+        state->offset = 0;
+  8034ac:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8034b2:	eb d9                	jmp    80348d <putch+0x22>
+
+00000000008034b4 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8034b4:	55                   	push   %rbp
+  8034b5:	48 89 e5             	mov    %rsp,%rbp
+  8034b8:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8034bf:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8034c2:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8034c9:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8034ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034d3:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8034d6:	48 89 f1             	mov    %rsi,%rcx
+  8034d9:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8034e0:	48 bf 6b 34 80 00 00 	movabs $0x80346b,%rdi
+  8034e7:	00 00 00 
+  8034ea:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  8034f1:	00 00 00 
+  8034f4:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8034f6:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034fd:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803504:	48 b8 27 01 80 00 00 	movabs $0x800127,%rax
+  80350b:	00 00 00 
+  80350e:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  803510:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  803516:	c9                   	leave
+  803517:	c3                   	ret
+
+0000000000803518 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  803518:	55                   	push   %rbp
+  803519:	48 89 e5             	mov    %rsp,%rbp
+  80351c:	48 83 ec 50          	sub    $0x50,%rsp
+  803520:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803524:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803528:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80352c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803530:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  803534:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80353b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80353f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803543:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803547:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80354b:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80354f:	48 b8 b4 34 80 00 00 	movabs $0x8034b4,%rax
+  803556:	00 00 00 
+  803559:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80355b:	c9                   	leave
+  80355c:	c3                   	ret
+
+000000000080355d <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80355d:	55                   	push   %rbp
+  80355e:	48 89 e5             	mov    %rsp,%rbp
+  803561:	41 57                	push   %r15
+  803563:	41 56                	push   %r14
+  803565:	41 55                	push   %r13
+  803567:	41 54                	push   %r12
+  803569:	53                   	push   %rbx
+  80356a:	48 83 ec 18          	sub    $0x18,%rsp
+  80356e:	49 89 fc             	mov    %rdi,%r12
+  803571:	49 89 f5             	mov    %rsi,%r13
+  803574:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803578:	8b 45 10             	mov    0x10(%rbp),%eax
+  80357b:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80357e:	41 89 cf             	mov    %ecx,%r15d
+  803581:	4c 39 fa             	cmp    %r15,%rdx
+  803584:	73 5b                	jae    8035e1 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803586:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80358a:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80358e:	85 db                	test   %ebx,%ebx
+  803590:	7e 0e                	jle    8035a0 <print_num+0x43>
+            putch(padc, put_arg);
+  803592:	4c 89 ee             	mov    %r13,%rsi
+  803595:	44 89 f7             	mov    %r14d,%edi
+  803598:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80359b:	83 eb 01             	sub    $0x1,%ebx
+  80359e:	75 f2                	jne    803592 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8035a0:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8035a4:	48 b9 34 48 80 00 00 	movabs $0x804834,%rcx
+  8035ab:	00 00 00 
+  8035ae:	48 b8 23 48 80 00 00 	movabs $0x804823,%rax
+  8035b5:	00 00 00 
+  8035b8:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8035bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c5:	49 f7 f7             	div    %r15
+  8035c8:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8035cc:	4c 89 ee             	mov    %r13,%rsi
+  8035cf:	41 ff d4             	call   *%r12
+}
+  8035d2:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8035d6:	5b                   	pop    %rbx
+  8035d7:	41 5c                	pop    %r12
+  8035d9:	41 5d                	pop    %r13
+  8035db:	41 5e                	pop    %r14
+  8035dd:	41 5f                	pop    %r15
+  8035df:	5d                   	pop    %rbp
+  8035e0:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8035e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035ea:	49 f7 f7             	div    %r15
+  8035ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8035f1:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8035f5:	52                   	push   %rdx
+  8035f6:	45 0f be c9          	movsbl %r9b,%r9d
+  8035fa:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035fe:	48 89 c2             	mov    %rax,%rdx
+  803601:	48 b8 5d 35 80 00 00 	movabs $0x80355d,%rax
+  803608:	00 00 00 
+  80360b:	ff d0                	call   *%rax
+  80360d:	48 83 c4 10          	add    $0x10,%rsp
+  803611:	eb 8d                	jmp    8035a0 <print_num+0x43>
+
+0000000000803613 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  803613:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  803617:	48 8b 06             	mov    (%rsi),%rax
+  80361a:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80361e:	73 0a                	jae    80362a <sprintputch+0x17>
+        *state->start++ = ch;
+  803620:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  803624:	48 89 16             	mov    %rdx,(%rsi)
+  803627:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80362a:	c3                   	ret
+
+000000000080362b <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80362b:	55                   	push   %rbp
+  80362c:	48 89 e5             	mov    %rsp,%rbp
+  80362f:	48 83 ec 50          	sub    $0x50,%rsp
+  803633:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803637:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80363b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80363f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803646:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80364a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80364e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803652:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  803656:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80365a:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803661:	00 00 00 
+  803664:	ff d0                	call   *%rax
+}
+  803666:	c9                   	leave
+  803667:	c3                   	ret
+
+0000000000803668 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803668:	55                   	push   %rbp
+  803669:	48 89 e5             	mov    %rsp,%rbp
+  80366c:	41 57                	push   %r15
+  80366e:	41 56                	push   %r14
+  803670:	41 55                	push   %r13
+  803672:	41 54                	push   %r12
+  803674:	53                   	push   %rbx
+  803675:	48 83 ec 38          	sub    $0x38,%rsp
+  803679:	49 89 fe             	mov    %rdi,%r14
+  80367c:	49 89 f5             	mov    %rsi,%r13
+  80367f:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803682:	48 8b 01             	mov    (%rcx),%rax
+  803685:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803689:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80368d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803691:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803695:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803699:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80369d:	0f b6 3b             	movzbl (%rbx),%edi
+  8036a0:	40 80 ff 25          	cmp    $0x25,%dil
+  8036a4:	74 18                	je     8036be <vprintfmt+0x56>
+            if (!ch) return;
+  8036a6:	40 84 ff             	test   %dil,%dil
+  8036a9:	0f 84 b1 06 00 00    	je     803d60 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8036af:	40 0f b6 ff          	movzbl %dil,%edi
+  8036b3:	4c 89 ee             	mov    %r13,%rsi
+  8036b6:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8036b9:	4c 89 e3             	mov    %r12,%rbx
+  8036bc:	eb db                	jmp    803699 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8036be:	be 00 00 00 00       	mov    $0x0,%esi
+  8036c3:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8036c7:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8036cc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036d2:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8036d9:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036dd:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8036e2:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8036e7:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8036ea:	83 e8 23             	sub    $0x23,%eax
+  8036ed:	3c 57                	cmp    $0x57,%al
+  8036ef:	0f 87 51 06 00 00    	ja     803d46 <vprintfmt+0x6de>
+  8036f5:	0f b6 c0             	movzbl %al,%eax
+  8036f8:	48 b9 e0 49 80 00 00 	movabs $0x8049e0,%rcx
+  8036ff:	00 00 00 
+  803702:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803705:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803708:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80370c:	eb cf                	jmp    8036dd <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80370e:	49 89 dc             	mov    %rbx,%r12
+  803711:	be 01 00 00 00       	mov    $0x1,%esi
+  803716:	eb c5                	jmp    8036dd <vprintfmt+0x75>
+            padc = ch;
+  803718:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80371c:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80371f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803722:	eb b9                	jmp    8036dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803724:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803727:	83 f8 2f             	cmp    $0x2f,%eax
+  80372a:	77 24                	ja     803750 <vprintfmt+0xe8>
+  80372c:	89 c1                	mov    %eax,%ecx
+  80372e:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  803732:	83 c0 08             	add    $0x8,%eax
+  803735:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803738:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80373b:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80373e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803742:	79 99                	jns    8036dd <vprintfmt+0x75>
+                width = precision;
+  803744:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  803748:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80374e:	eb 8d                	jmp    8036dd <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803750:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803754:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  803758:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80375c:	eb da                	jmp    803738 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80375e:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803763:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803767:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80376d:	3c 39                	cmp    $0x39,%al
+  80376f:	77 1c                	ja     80378d <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803771:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803775:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803779:	0f b6 c0             	movzbl %al,%eax
+  80377c:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803781:	0f b6 03             	movzbl (%rbx),%eax
+  803784:	3c 39                	cmp    $0x39,%al
+  803786:	76 e9                	jbe    803771 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803788:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80378b:	eb b1                	jmp    80373e <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80378d:	49 89 dc             	mov    %rbx,%r12
+  803790:	eb ac                	jmp    80373e <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803792:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803795:	85 c9                	test   %ecx,%ecx
+  803797:	b8 00 00 00 00       	mov    $0x0,%eax
+  80379c:	0f 49 c1             	cmovns %ecx,%eax
+  80379f:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8037a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8037a5:	e9 33 ff ff ff       	jmp    8036dd <vprintfmt+0x75>
+            lflag++;
+  8037aa:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8037ad:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8037b0:	e9 28 ff ff ff       	jmp    8036dd <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8037b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8037bb:	77 19                	ja     8037d6 <vprintfmt+0x16e>
+  8037bd:	89 c2                	mov    %eax,%edx
+  8037bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037c3:	83 c0 08             	add    $0x8,%eax
+  8037c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8037c9:	8b 3a                	mov    (%rdx),%edi
+  8037cb:	4c 89 ee             	mov    %r13,%rsi
+  8037ce:	41 ff d6             	call   *%r14
+            break;
+  8037d1:	e9 c3 fe ff ff       	jmp    803699 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8037d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037e2:	eb e5                	jmp    8037c9 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8037e4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8037e7:	83 f8 2f             	cmp    $0x2f,%eax
+  8037ea:	77 5a                	ja     803846 <vprintfmt+0x1de>
+  8037ec:	89 c2                	mov    %eax,%edx
+  8037ee:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037f2:	83 c0 08             	add    $0x8,%eax
+  8037f5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8037f8:	8b 02                	mov    (%rdx),%eax
+  8037fa:	89 c1                	mov    %eax,%ecx
+  8037fc:	f7 d9                	neg    %ecx
+  8037fe:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803801:	83 f9 16             	cmp    $0x16,%ecx
+  803804:	7f 4e                	jg     803854 <vprintfmt+0x1ec>
+  803806:	48 63 c1             	movslq %ecx,%rax
+  803809:	48 ba a0 4c 80 00 00 	movabs $0x804ca0,%rdx
+  803810:	00 00 00 
+  803813:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803817:	48 85 c0             	test   %rax,%rax
+  80381a:	74 38                	je     803854 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80381c:	48 89 c1             	mov    %rax,%rcx
+  80381f:	48 ba b9 47 80 00 00 	movabs $0x8047b9,%rdx
+  803826:	00 00 00 
+  803829:	4c 89 ee             	mov    %r13,%rsi
+  80382c:	4c 89 f7             	mov    %r14,%rdi
+  80382f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803834:	49 b8 2b 36 80 00 00 	movabs $0x80362b,%r8
+  80383b:	00 00 00 
+  80383e:	41 ff d0             	call   *%r8
+  803841:	e9 53 fe ff ff       	jmp    803699 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  803846:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80384a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80384e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803852:	eb a4                	jmp    8037f8 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803854:	48 ba 4c 48 80 00 00 	movabs $0x80484c,%rdx
+  80385b:	00 00 00 
+  80385e:	4c 89 ee             	mov    %r13,%rsi
+  803861:	4c 89 f7             	mov    %r14,%rdi
+  803864:	b8 00 00 00 00       	mov    $0x0,%eax
+  803869:	49 b8 2b 36 80 00 00 	movabs $0x80362b,%r8
+  803870:	00 00 00 
+  803873:	41 ff d0             	call   *%r8
+  803876:	e9 1e fe ff ff       	jmp    803699 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80387b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80387e:	83 f8 2f             	cmp    $0x2f,%eax
+  803881:	77 6c                	ja     8038ef <vprintfmt+0x287>
+  803883:	89 c2                	mov    %eax,%edx
+  803885:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803889:	83 c0 08             	add    $0x8,%eax
+  80388c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80388f:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803892:	48 85 d2             	test   %rdx,%rdx
+  803895:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  80389c:	00 00 00 
+  80389f:	48 0f 45 c2          	cmovne %rdx,%rax
+  8038a3:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8038a7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8038ab:	7e 06                	jle    8038b3 <vprintfmt+0x24b>
+  8038ad:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8038b1:	75 4a                	jne    8038fd <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038b3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8038b7:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8038bb:	0f b6 00             	movzbl (%rax),%eax
+  8038be:	84 c0                	test   %al,%al
+  8038c0:	0f 85 9a 00 00 00    	jne    803960 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8038c6:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c9:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8038cd:	85 c0                	test   %eax,%eax
+  8038cf:	0f 8e c4 fd ff ff    	jle    803699 <vprintfmt+0x31>
+  8038d5:	4c 89 ee             	mov    %r13,%rsi
+  8038d8:	bf 20 00 00 00       	mov    $0x20,%edi
+  8038dd:	41 ff d6             	call   *%r14
+  8038e0:	41 83 ec 01          	sub    $0x1,%r12d
+  8038e4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8038e8:	75 eb                	jne    8038d5 <vprintfmt+0x26d>
+  8038ea:	e9 aa fd ff ff       	jmp    803699 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8038ef:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038f3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038fb:	eb 92                	jmp    80388f <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038fd:	49 63 f7             	movslq %r15d,%rsi
+  803900:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803904:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  80390b:	00 00 00 
+  80390e:	ff d0                	call   *%rax
+  803910:	48 89 c2             	mov    %rax,%rdx
+  803913:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803916:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  803918:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80391b:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80391e:	85 c0                	test   %eax,%eax
+  803920:	7e 91                	jle    8038b3 <vprintfmt+0x24b>
+  803922:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  803927:	4c 89 ee             	mov    %r13,%rsi
+  80392a:	44 89 e7             	mov    %r12d,%edi
+  80392d:	41 ff d6             	call   *%r14
+  803930:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803934:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803937:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80393a:	75 eb                	jne    803927 <vprintfmt+0x2bf>
+  80393c:	e9 72 ff ff ff       	jmp    8038b3 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803941:	0f b6 f8             	movzbl %al,%edi
+  803944:	4c 89 ee             	mov    %r13,%rsi
+  803947:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80394a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80394e:	49 83 c4 01          	add    $0x1,%r12
+  803952:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  803958:	84 c0                	test   %al,%al
+  80395a:	0f 84 66 ff ff ff    	je     8038c6 <vprintfmt+0x25e>
+  803960:	45 85 ff             	test   %r15d,%r15d
+  803963:	78 0a                	js     80396f <vprintfmt+0x307>
+  803965:	41 83 ef 01          	sub    $0x1,%r15d
+  803969:	0f 88 57 ff ff ff    	js     8038c6 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80396f:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803973:	74 cc                	je     803941 <vprintfmt+0x2d9>
+  803975:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803978:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80397d:	80 fa 5e             	cmp    $0x5e,%dl
+  803980:	77 c2                	ja     803944 <vprintfmt+0x2dc>
+  803982:	eb bd                	jmp    803941 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803984:	40 84 f6             	test   %sil,%sil
+  803987:	75 26                	jne    8039af <vprintfmt+0x347>
+    switch (lflag) {
+  803989:	85 d2                	test   %edx,%edx
+  80398b:	74 59                	je     8039e6 <vprintfmt+0x37e>
+  80398d:	83 fa 01             	cmp    $0x1,%edx
+  803990:	74 7b                	je     803a0d <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803995:	83 f8 2f             	cmp    $0x2f,%eax
+  803998:	0f 87 96 00 00 00    	ja     803a34 <vprintfmt+0x3cc>
+  80399e:	89 c2                	mov    %eax,%edx
+  8039a0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039a4:	83 c0 08             	add    $0x8,%eax
+  8039a7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039aa:	4c 8b 22             	mov    (%rdx),%r12
+  8039ad:	eb 17                	jmp    8039c6 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8039af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8039b5:	77 21                	ja     8039d8 <vprintfmt+0x370>
+  8039b7:	89 c2                	mov    %eax,%edx
+  8039b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039bd:	83 c0 08             	add    $0x8,%eax
+  8039c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039c3:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8039c6:	4d 85 e4             	test   %r12,%r12
+  8039c9:	78 7a                	js     803a45 <vprintfmt+0x3dd>
+            num = i;
+  8039cb:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8039ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8039d3:	e9 50 02 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8039d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039e4:	eb dd                	jmp    8039c3 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8039e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8039ec:	77 11                	ja     8039ff <vprintfmt+0x397>
+  8039ee:	89 c2                	mov    %eax,%edx
+  8039f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039f4:	83 c0 08             	add    $0x8,%eax
+  8039f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039fa:	4c 63 22             	movslq (%rdx),%r12
+  8039fd:	eb c7                	jmp    8039c6 <vprintfmt+0x35e>
+  8039ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a03:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a07:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a0b:	eb ed                	jmp    8039fa <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803a0d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a10:	83 f8 2f             	cmp    $0x2f,%eax
+  803a13:	77 11                	ja     803a26 <vprintfmt+0x3be>
+  803a15:	89 c2                	mov    %eax,%edx
+  803a17:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a1b:	83 c0 08             	add    $0x8,%eax
+  803a1e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a21:	4c 8b 22             	mov    (%rdx),%r12
+  803a24:	eb a0                	jmp    8039c6 <vprintfmt+0x35e>
+  803a26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a32:	eb ed                	jmp    803a21 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  803a34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a40:	e9 65 ff ff ff       	jmp    8039aa <vprintfmt+0x342>
+                putch('-', put_arg);
+  803a45:	4c 89 ee             	mov    %r13,%rsi
+  803a48:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803a4d:	41 ff d6             	call   *%r14
+                i = -i;
+  803a50:	49 f7 dc             	neg    %r12
+  803a53:	e9 73 ff ff ff       	jmp    8039cb <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803a58:	40 84 f6             	test   %sil,%sil
+  803a5b:	75 32                	jne    803a8f <vprintfmt+0x427>
+    switch (lflag) {
+  803a5d:	85 d2                	test   %edx,%edx
+  803a5f:	74 5d                	je     803abe <vprintfmt+0x456>
+  803a61:	83 fa 01             	cmp    $0x1,%edx
+  803a64:	0f 84 82 00 00 00    	je     803aec <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a6d:	83 f8 2f             	cmp    $0x2f,%eax
+  803a70:	0f 87 a5 00 00 00    	ja     803b1b <vprintfmt+0x4b3>
+  803a76:	89 c2                	mov    %eax,%edx
+  803a78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a7c:	83 c0 08             	add    $0x8,%eax
+  803a7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a82:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a85:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a8a:	e9 99 01 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a92:	83 f8 2f             	cmp    $0x2f,%eax
+  803a95:	77 19                	ja     803ab0 <vprintfmt+0x448>
+  803a97:	89 c2                	mov    %eax,%edx
+  803a99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a9d:	83 c0 08             	add    $0x8,%eax
+  803aa0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aa3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803aa6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803aab:	e9 78 01 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+  803ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803abc:	eb e5                	jmp    803aa3 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803abe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ac1:	83 f8 2f             	cmp    $0x2f,%eax
+  803ac4:	77 18                	ja     803ade <vprintfmt+0x476>
+  803ac6:	89 c2                	mov    %eax,%edx
+  803ac8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803acc:	83 c0 08             	add    $0x8,%eax
+  803acf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ad2:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803ad4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803ad9:	e9 4a 01 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+  803ade:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ae2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ae6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aea:	eb e6                	jmp    803ad2 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803aec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aef:	83 f8 2f             	cmp    $0x2f,%eax
+  803af2:	77 19                	ja     803b0d <vprintfmt+0x4a5>
+  803af4:	89 c2                	mov    %eax,%edx
+  803af6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803afa:	83 c0 08             	add    $0x8,%eax
+  803afd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b00:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803b03:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803b08:	e9 1b 01 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+  803b0d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b11:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b15:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b19:	eb e5                	jmp    803b00 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803b1b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b1f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b23:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b27:	e9 56 ff ff ff       	jmp    803a82 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803b2c:	40 84 f6             	test   %sil,%sil
+  803b2f:	75 2e                	jne    803b5f <vprintfmt+0x4f7>
+    switch (lflag) {
+  803b31:	85 d2                	test   %edx,%edx
+  803b33:	74 59                	je     803b8e <vprintfmt+0x526>
+  803b35:	83 fa 01             	cmp    $0x1,%edx
+  803b38:	74 7f                	je     803bb9 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803b3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b3d:	83 f8 2f             	cmp    $0x2f,%eax
+  803b40:	0f 87 9f 00 00 00    	ja     803be5 <vprintfmt+0x57d>
+  803b46:	89 c2                	mov    %eax,%edx
+  803b48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b4c:	83 c0 08             	add    $0x8,%eax
+  803b4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b55:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803b5a:	e9 c9 00 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b62:	83 f8 2f             	cmp    $0x2f,%eax
+  803b65:	77 19                	ja     803b80 <vprintfmt+0x518>
+  803b67:	89 c2                	mov    %eax,%edx
+  803b69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b6d:	83 c0 08             	add    $0x8,%eax
+  803b70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b73:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b76:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b7b:	e9 a8 00 00 00       	jmp    803c28 <vprintfmt+0x5c0>
+  803b80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b8c:	eb e5                	jmp    803b73 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b8e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b91:	83 f8 2f             	cmp    $0x2f,%eax
+  803b94:	77 15                	ja     803bab <vprintfmt+0x543>
+  803b96:	89 c2                	mov    %eax,%edx
+  803b98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b9c:	83 c0 08             	add    $0x8,%eax
+  803b9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ba2:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803ba4:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803ba9:	eb 7d                	jmp    803c28 <vprintfmt+0x5c0>
+  803bab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803baf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bb7:	eb e9                	jmp    803ba2 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803bb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bbc:	83 f8 2f             	cmp    $0x2f,%eax
+  803bbf:	77 16                	ja     803bd7 <vprintfmt+0x56f>
+  803bc1:	89 c2                	mov    %eax,%edx
+  803bc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bc7:	83 c0 08             	add    $0x8,%eax
+  803bca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bcd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803bd0:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803bd5:	eb 51                	jmp    803c28 <vprintfmt+0x5c0>
+  803bd7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bdb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bdf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803be3:	eb e8                	jmp    803bcd <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803be5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803be9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf1:	e9 5c ff ff ff       	jmp    803b52 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803bf6:	4c 89 ee             	mov    %r13,%rsi
+  803bf9:	bf 30 00 00 00       	mov    $0x30,%edi
+  803bfe:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803c01:	4c 89 ee             	mov    %r13,%rsi
+  803c04:	bf 78 00 00 00       	mov    $0x78,%edi
+  803c09:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803c0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c0f:	83 f8 2f             	cmp    $0x2f,%eax
+  803c12:	77 47                	ja     803c5b <vprintfmt+0x5f3>
+  803c14:	89 c2                	mov    %eax,%edx
+  803c16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c1a:	83 c0 08             	add    $0x8,%eax
+  803c1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c23:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803c28:	48 83 ec 08          	sub    $0x8,%rsp
+  803c2c:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803c30:	0f 94 c0             	sete   %al
+  803c33:	0f b6 c0             	movzbl %al,%eax
+  803c36:	50                   	push   %rax
+  803c37:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803c3c:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803c40:	4c 89 ee             	mov    %r13,%rsi
+  803c43:	4c 89 f7             	mov    %r14,%rdi
+  803c46:	48 b8 5d 35 80 00 00 	movabs $0x80355d,%rax
+  803c4d:	00 00 00 
+  803c50:	ff d0                	call   *%rax
+            break;
+  803c52:	48 83 c4 10          	add    $0x10,%rsp
+  803c56:	e9 3e fa ff ff       	jmp    803699 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c67:	eb b7                	jmp    803c20 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c69:	40 84 f6             	test   %sil,%sil
+  803c6c:	75 2b                	jne    803c99 <vprintfmt+0x631>
+    switch (lflag) {
+  803c6e:	85 d2                	test   %edx,%edx
+  803c70:	74 56                	je     803cc8 <vprintfmt+0x660>
+  803c72:	83 fa 01             	cmp    $0x1,%edx
+  803c75:	74 7f                	je     803cf6 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c77:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c7a:	83 f8 2f             	cmp    $0x2f,%eax
+  803c7d:	0f 87 a2 00 00 00    	ja     803d25 <vprintfmt+0x6bd>
+  803c83:	89 c2                	mov    %eax,%edx
+  803c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c89:	83 c0 08             	add    $0x8,%eax
+  803c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c8f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c92:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c97:	eb 8f                	jmp    803c28 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c9c:	83 f8 2f             	cmp    $0x2f,%eax
+  803c9f:	77 19                	ja     803cba <vprintfmt+0x652>
+  803ca1:	89 c2                	mov    %eax,%edx
+  803ca3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ca7:	83 c0 08             	add    $0x8,%eax
+  803caa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803cb0:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803cb5:	e9 6e ff ff ff       	jmp    803c28 <vprintfmt+0x5c0>
+  803cba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc6:	eb e5                	jmp    803cad <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803cc8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ccb:	83 f8 2f             	cmp    $0x2f,%eax
+  803cce:	77 18                	ja     803ce8 <vprintfmt+0x680>
+  803cd0:	89 c2                	mov    %eax,%edx
+  803cd2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cd6:	83 c0 08             	add    $0x8,%eax
+  803cd9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cdc:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803cde:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803ce3:	e9 40 ff ff ff       	jmp    803c28 <vprintfmt+0x5c0>
+  803ce8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cf0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cf4:	eb e6                	jmp    803cdc <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803cf6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803cf9:	83 f8 2f             	cmp    $0x2f,%eax
+  803cfc:	77 19                	ja     803d17 <vprintfmt+0x6af>
+  803cfe:	89 c2                	mov    %eax,%edx
+  803d00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803d04:	83 c0 08             	add    $0x8,%eax
+  803d07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803d0a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803d0d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803d12:	e9 11 ff ff ff       	jmp    803c28 <vprintfmt+0x5c0>
+  803d17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d23:	eb e5                	jmp    803d0a <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803d25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803d29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803d2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d31:	e9 59 ff ff ff       	jmp    803c8f <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803d36:	4c 89 ee             	mov    %r13,%rsi
+  803d39:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d3e:	41 ff d6             	call   *%r14
+            break;
+  803d41:	e9 53 f9 ff ff       	jmp    803699 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803d46:	4c 89 ee             	mov    %r13,%rsi
+  803d49:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d4e:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803d51:	48 83 eb 01          	sub    $0x1,%rbx
+  803d55:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803d59:	75 f6                	jne    803d51 <vprintfmt+0x6e9>
+  803d5b:	e9 39 f9 ff ff       	jmp    803699 <vprintfmt+0x31>
+}
+  803d60:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d64:	5b                   	pop    %rbx
+  803d65:	41 5c                	pop    %r12
+  803d67:	41 5d                	pop    %r13
+  803d69:	41 5e                	pop    %r14
+  803d6b:	41 5f                	pop    %r15
+  803d6d:	5d                   	pop    %rbp
+  803d6e:	c3                   	ret
+
+0000000000803d6f <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d6f:	55                   	push   %rbp
+  803d70:	48 89 e5             	mov    %rsp,%rbp
+  803d73:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d77:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d7b:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d80:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d84:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d8b:	48 85 ff             	test   %rdi,%rdi
+  803d8e:	74 2b                	je     803dbb <vsnprintf+0x4c>
+  803d90:	48 85 f6             	test   %rsi,%rsi
+  803d93:	74 26                	je     803dbb <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d99:	48 bf 13 36 80 00 00 	movabs $0x803613,%rdi
+  803da0:	00 00 00 
+  803da3:	48 b8 68 36 80 00 00 	movabs $0x803668,%rax
+  803daa:	00 00 00 
+  803dad:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803daf:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803db3:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803db6:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803db9:	c9                   	leave
+  803dba:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803dbb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803dc0:	eb f7                	jmp    803db9 <vsnprintf+0x4a>
+
+0000000000803dc2 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803dc2:	55                   	push   %rbp
+  803dc3:	48 89 e5             	mov    %rsp,%rbp
+  803dc6:	48 83 ec 50          	sub    $0x50,%rsp
+  803dca:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803dce:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803dd2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803dd6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803ddd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803de1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803de5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803de9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803ded:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803df1:	48 b8 6f 3d 80 00 00 	movabs $0x803d6f,%rax
+  803df8:	00 00 00 
+  803dfb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803dfd:	c9                   	leave
+  803dfe:	c3                   	ret
+
+0000000000803dff <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803dff:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803e02:	74 10                	je     803e14 <strlen+0x15>
+    size_t n = 0;
+  803e04:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803e09:	48 83 c0 01          	add    $0x1,%rax
+  803e0d:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803e11:	75 f6                	jne    803e09 <strlen+0xa>
+  803e13:	c3                   	ret
+    size_t n = 0;
+  803e14:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803e19:	c3                   	ret
+
+0000000000803e1a <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803e1a:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803e1d:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803e22:	48 85 f6             	test   %rsi,%rsi
+  803e25:	74 11                	je     803e38 <strnlen+0x1e>
+  803e27:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803e2b:	74 0c                	je     803e39 <strnlen+0x1f>
+  803e2d:	48 83 c2 01          	add    $0x1,%rdx
+  803e31:	48 39 d0             	cmp    %rdx,%rax
+  803e34:	75 f1                	jne    803e27 <strnlen+0xd>
+  803e36:	eb 04                	jmp    803e3c <strnlen+0x22>
+  803e38:	c3                   	ret
+  803e39:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803e3c:	c3                   	ret
+
+0000000000803e3d <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803e3d:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803e40:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e45:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803e49:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803e4c:	48 83 c2 01          	add    $0x1,%rdx
+  803e50:	84 c9                	test   %cl,%cl
+  803e52:	75 f1                	jne    803e45 <strcpy+0x8>
+        ;
+    return res;
+}
+  803e54:	c3                   	ret
+
+0000000000803e55 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803e55:	55                   	push   %rbp
+  803e56:	48 89 e5             	mov    %rsp,%rbp
+  803e59:	41 54                	push   %r12
+  803e5b:	53                   	push   %rbx
+  803e5c:	48 89 fb             	mov    %rdi,%rbx
+  803e5f:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e62:	48 b8 ff 3d 80 00 00 	movabs $0x803dff,%rax
+  803e69:	00 00 00 
+  803e6c:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e6e:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e72:	4c 89 e6             	mov    %r12,%rsi
+  803e75:	48 b8 3d 3e 80 00 00 	movabs $0x803e3d,%rax
+  803e7c:	00 00 00 
+  803e7f:	ff d0                	call   *%rax
+    return dst;
+}
+  803e81:	48 89 d8             	mov    %rbx,%rax
+  803e84:	5b                   	pop    %rbx
+  803e85:	41 5c                	pop    %r12
+  803e87:	5d                   	pop    %rbp
+  803e88:	c3                   	ret
+
+0000000000803e89 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e89:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e8c:	48 85 d2             	test   %rdx,%rdx
+  803e8f:	74 1f                	je     803eb0 <strncpy+0x27>
+  803e91:	48 01 fa             	add    %rdi,%rdx
+  803e94:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e97:	48 83 c1 01          	add    $0x1,%rcx
+  803e9b:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e9f:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803ea3:	41 80 f8 01          	cmp    $0x1,%r8b
+  803ea7:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803eab:	48 39 ca             	cmp    %rcx,%rdx
+  803eae:	75 e7                	jne    803e97 <strncpy+0xe>
+    }
+    return ret;
+}
+  803eb0:	c3                   	ret
+
+0000000000803eb1 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803eb1:	48 89 f8             	mov    %rdi,%rax
+  803eb4:	48 85 d2             	test   %rdx,%rdx
+  803eb7:	74 24                	je     803edd <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803eb9:	48 83 ea 01          	sub    $0x1,%rdx
+  803ebd:	74 1b                	je     803eda <strlcpy+0x29>
+  803ebf:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803ec3:	0f b6 16             	movzbl (%rsi),%edx
+  803ec6:	84 d2                	test   %dl,%dl
+  803ec8:	74 10                	je     803eda <strlcpy+0x29>
+            *dst++ = *src++;
+  803eca:	48 83 c6 01          	add    $0x1,%rsi
+  803ece:	48 83 c0 01          	add    $0x1,%rax
+  803ed2:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803ed5:	48 39 c8             	cmp    %rcx,%rax
+  803ed8:	75 e9                	jne    803ec3 <strlcpy+0x12>
+        *dst = '\0';
+  803eda:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803edd:	48 29 f8             	sub    %rdi,%rax
+}
+  803ee0:	c3                   	ret
+
+0000000000803ee1 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803ee1:	0f b6 07             	movzbl (%rdi),%eax
+  803ee4:	84 c0                	test   %al,%al
+  803ee6:	74 13                	je     803efb <strcmp+0x1a>
+  803ee8:	38 06                	cmp    %al,(%rsi)
+  803eea:	75 0f                	jne    803efb <strcmp+0x1a>
+  803eec:	48 83 c7 01          	add    $0x1,%rdi
+  803ef0:	48 83 c6 01          	add    $0x1,%rsi
+  803ef4:	0f b6 07             	movzbl (%rdi),%eax
+  803ef7:	84 c0                	test   %al,%al
+  803ef9:	75 ed                	jne    803ee8 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803efb:	0f b6 c0             	movzbl %al,%eax
+  803efe:	0f b6 16             	movzbl (%rsi),%edx
+  803f01:	29 d0                	sub    %edx,%eax
+}
+  803f03:	c3                   	ret
+
+0000000000803f04 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803f04:	48 85 d2             	test   %rdx,%rdx
+  803f07:	74 1f                	je     803f28 <strncmp+0x24>
+  803f09:	0f b6 07             	movzbl (%rdi),%eax
+  803f0c:	84 c0                	test   %al,%al
+  803f0e:	74 1e                	je     803f2e <strncmp+0x2a>
+  803f10:	3a 06                	cmp    (%rsi),%al
+  803f12:	75 1a                	jne    803f2e <strncmp+0x2a>
+  803f14:	48 83 c7 01          	add    $0x1,%rdi
+  803f18:	48 83 c6 01          	add    $0x1,%rsi
+  803f1c:	48 83 ea 01          	sub    $0x1,%rdx
+  803f20:	75 e7                	jne    803f09 <strncmp+0x5>
+
+    if (!n) return 0;
+  803f22:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f27:	c3                   	ret
+  803f28:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2d:	c3                   	ret
+  803f2e:	48 85 d2             	test   %rdx,%rdx
+  803f31:	74 09                	je     803f3c <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803f33:	0f b6 07             	movzbl (%rdi),%eax
+  803f36:	0f b6 16             	movzbl (%rsi),%edx
+  803f39:	29 d0                	sub    %edx,%eax
+  803f3b:	c3                   	ret
+    if (!n) return 0;
+  803f3c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803f41:	c3                   	ret
+
+0000000000803f42 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803f42:	0f b6 17             	movzbl (%rdi),%edx
+  803f45:	84 d2                	test   %dl,%dl
+  803f47:	74 18                	je     803f61 <strchr+0x1f>
+        if (*str == c) {
+  803f49:	0f be d2             	movsbl %dl,%edx
+  803f4c:	39 f2                	cmp    %esi,%edx
+  803f4e:	74 17                	je     803f67 <strchr+0x25>
+    for (; *str; str++) {
+  803f50:	48 83 c7 01          	add    $0x1,%rdi
+  803f54:	0f b6 17             	movzbl (%rdi),%edx
+  803f57:	84 d2                	test   %dl,%dl
+  803f59:	75 ee                	jne    803f49 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f60:	c3                   	ret
+  803f61:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f66:	c3                   	ret
+  803f67:	48 89 f8             	mov    %rdi,%rax
+}
+  803f6a:	c3                   	ret
+
+0000000000803f6b <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f6b:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f6e:	0f b6 17             	movzbl (%rdi),%edx
+  803f71:	84 d2                	test   %dl,%dl
+  803f73:	74 13                	je     803f88 <strfind+0x1d>
+  803f75:	0f be d2             	movsbl %dl,%edx
+  803f78:	39 f2                	cmp    %esi,%edx
+  803f7a:	74 0b                	je     803f87 <strfind+0x1c>
+  803f7c:	48 83 c0 01          	add    $0x1,%rax
+  803f80:	0f b6 10             	movzbl (%rax),%edx
+  803f83:	84 d2                	test   %dl,%dl
+  803f85:	75 ee                	jne    803f75 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f87:	c3                   	ret
+  803f88:	c3                   	ret
+
+0000000000803f89 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f89:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f8c:	48 89 f8             	mov    %rdi,%rax
+  803f8f:	48 f7 d8             	neg    %rax
+  803f92:	83 e0 07             	and    $0x7,%eax
+  803f95:	49 89 d1             	mov    %rdx,%r9
+  803f98:	49 29 c1             	sub    %rax,%r9
+  803f9b:	78 36                	js     803fd3 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f9d:	40 0f b6 c6          	movzbl %sil,%eax
+  803fa1:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803fa8:	01 01 01 
+  803fab:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803faf:	40 f6 c7 07          	test   $0x7,%dil
+  803fb3:	75 38                	jne    803fed <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803fb5:	4c 89 c9             	mov    %r9,%rcx
+  803fb8:	48 c1 f9 03          	sar    $0x3,%rcx
+  803fbc:	74 0c                	je     803fca <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803fbe:	fc                   	cld
+  803fbf:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803fc2:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803fc6:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803fca:	4d 85 c9             	test   %r9,%r9
+  803fcd:	75 45                	jne    804014 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803fcf:	4c 89 c0             	mov    %r8,%rax
+  803fd2:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803fd3:	48 85 d2             	test   %rdx,%rdx
+  803fd6:	74 f7                	je     803fcf <memset+0x46>
+  803fd8:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803fdb:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803fde:	48 83 c0 01          	add    $0x1,%rax
+  803fe2:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803fe6:	48 39 c2             	cmp    %rax,%rdx
+  803fe9:	75 f3                	jne    803fde <memset+0x55>
+  803feb:	eb e2                	jmp    803fcf <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803fed:	40 f6 c7 01          	test   $0x1,%dil
+  803ff1:	74 06                	je     803ff9 <memset+0x70>
+  803ff3:	88 07                	mov    %al,(%rdi)
+  803ff5:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803ff9:	40 f6 c7 02          	test   $0x2,%dil
+  803ffd:	74 07                	je     804006 <memset+0x7d>
+  803fff:	66 89 07             	mov    %ax,(%rdi)
+  804002:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  804006:	40 f6 c7 04          	test   $0x4,%dil
+  80400a:	74 a9                	je     803fb5 <memset+0x2c>
+  80400c:	89 07                	mov    %eax,(%rdi)
+  80400e:	48 83 c7 04          	add    $0x4,%rdi
+  804012:	eb a1                	jmp    803fb5 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  804014:	41 f6 c1 04          	test   $0x4,%r9b
+  804018:	74 06                	je     804020 <memset+0x97>
+  80401a:	89 07                	mov    %eax,(%rdi)
+  80401c:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  804020:	41 f6 c1 02          	test   $0x2,%r9b
+  804024:	74 07                	je     80402d <memset+0xa4>
+  804026:	66 89 07             	mov    %ax,(%rdi)
+  804029:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80402d:	41 f6 c1 01          	test   $0x1,%r9b
+  804031:	74 9c                	je     803fcf <memset+0x46>
+  804033:	88 07                	mov    %al,(%rdi)
+  804035:	eb 98                	jmp    803fcf <memset+0x46>
+
+0000000000804037 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  804037:	48 89 f8             	mov    %rdi,%rax
+  80403a:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80403d:	48 39 fe             	cmp    %rdi,%rsi
+  804040:	73 3b                	jae    80407d <memmove+0x46>
+  804042:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  804046:	48 39 d7             	cmp    %rdx,%rdi
+  804049:	73 32                	jae    80407d <memmove+0x46>
+        s += n;
+        d += n;
+  80404b:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80404f:	48 89 d6             	mov    %rdx,%rsi
+  804052:	48 09 fe             	or     %rdi,%rsi
+  804055:	48 09 ce             	or     %rcx,%rsi
+  804058:	40 f6 c6 07          	test   $0x7,%sil
+  80405c:	75 12                	jne    804070 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80405e:	48 83 ef 08          	sub    $0x8,%rdi
+  804062:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  804066:	48 c1 e9 03          	shr    $0x3,%rcx
+  80406a:	fd                   	std
+  80406b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80406e:	fc                   	cld
+  80406f:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804070:	48 83 ef 01          	sub    $0x1,%rdi
+  804074:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804078:	fd                   	std
+  804079:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80407b:	eb f1                	jmp    80406e <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80407d:	48 89 f2             	mov    %rsi,%rdx
+  804080:	48 09 c2             	or     %rax,%rdx
+  804083:	48 09 ca             	or     %rcx,%rdx
+  804086:	f6 c2 07             	test   $0x7,%dl
+  804089:	75 0c                	jne    804097 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80408b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80408f:	48 89 c7             	mov    %rax,%rdi
+  804092:	fc                   	cld
+  804093:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804096:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804097:	48 89 c7             	mov    %rax,%rdi
+  80409a:	fc                   	cld
+  80409b:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80409d:	c3                   	ret
+
+000000000080409e <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80409e:	55                   	push   %rbp
+  80409f:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8040a2:	48 b8 37 40 80 00 00 	movabs $0x804037,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+}
+  8040ae:	5d                   	pop    %rbp
+  8040af:	c3                   	ret
+
+00000000008040b0 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8040b0:	55                   	push   %rbp
+  8040b1:	48 89 e5             	mov    %rsp,%rbp
+  8040b4:	41 57                	push   %r15
+  8040b6:	41 56                	push   %r14
+  8040b8:	41 55                	push   %r13
+  8040ba:	41 54                	push   %r12
+  8040bc:	53                   	push   %rbx
+  8040bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8040c1:	49 89 fe             	mov    %rdi,%r14
+  8040c4:	49 89 f7             	mov    %rsi,%r15
+  8040c7:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8040ca:	48 89 f7             	mov    %rsi,%rdi
+  8040cd:	48 b8 ff 3d 80 00 00 	movabs $0x803dff,%rax
+  8040d4:	00 00 00 
+  8040d7:	ff d0                	call   *%rax
+  8040d9:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8040dc:	48 89 de             	mov    %rbx,%rsi
+  8040df:	4c 89 f7             	mov    %r14,%rdi
+  8040e2:	48 b8 1a 3e 80 00 00 	movabs $0x803e1a,%rax
+  8040e9:	00 00 00 
+  8040ec:	ff d0                	call   *%rax
+  8040ee:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040f1:	48 39 c3             	cmp    %rax,%rbx
+  8040f4:	74 36                	je     80412c <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8040f6:	48 89 d8             	mov    %rbx,%rax
+  8040f9:	4c 29 e8             	sub    %r13,%rax
+  8040fc:	49 39 c4             	cmp    %rax,%r12
+  8040ff:	73 31                	jae    804132 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  804101:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  804106:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80410a:	4c 89 fe             	mov    %r15,%rsi
+  80410d:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  804114:	00 00 00 
+  804117:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  804119:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80411d:	48 83 c4 08          	add    $0x8,%rsp
+  804121:	5b                   	pop    %rbx
+  804122:	41 5c                	pop    %r12
+  804124:	41 5d                	pop    %r13
+  804126:	41 5e                	pop    %r14
+  804128:	41 5f                	pop    %r15
+  80412a:	5d                   	pop    %rbp
+  80412b:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80412c:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  804130:	eb eb                	jmp    80411d <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  804132:	48 83 eb 01          	sub    $0x1,%rbx
+  804136:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80413a:	48 89 da             	mov    %rbx,%rdx
+  80413d:	4c 89 fe             	mov    %r15,%rsi
+  804140:	48 b8 9e 40 80 00 00 	movabs $0x80409e,%rax
+  804147:	00 00 00 
+  80414a:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80414c:	49 01 de             	add    %rbx,%r14
+  80414f:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  804154:	eb c3                	jmp    804119 <strlcat+0x69>
+
+0000000000804156 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  804156:	48 85 d2             	test   %rdx,%rdx
+  804159:	74 2d                	je     804188 <memcmp+0x32>
+  80415b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  804160:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  804164:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  804169:	44 38 c1             	cmp    %r8b,%cl
+  80416c:	75 0f                	jne    80417d <memcmp+0x27>
+    while (n-- > 0) {
+  80416e:	48 83 c0 01          	add    $0x1,%rax
+  804172:	48 39 c2             	cmp    %rax,%rdx
+  804175:	75 e9                	jne    804160 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804177:	b8 00 00 00 00       	mov    $0x0,%eax
+  80417c:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80417d:	0f b6 c1             	movzbl %cl,%eax
+  804180:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804184:	44 29 c0             	sub    %r8d,%eax
+  804187:	c3                   	ret
+    return 0;
+  804188:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80418d:	c3                   	ret
+
+000000000080418e <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80418e:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804192:	48 39 c7             	cmp    %rax,%rdi
+  804195:	73 0f                	jae    8041a6 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804197:	40 38 37             	cmp    %sil,(%rdi)
+  80419a:	74 0e                	je     8041aa <memfind+0x1c>
+    for (; src < end; src++) {
+  80419c:	48 83 c7 01          	add    $0x1,%rdi
+  8041a0:	48 39 f8             	cmp    %rdi,%rax
+  8041a3:	75 f2                	jne    804197 <memfind+0x9>
+  8041a5:	c3                   	ret
+  8041a6:	48 89 f8             	mov    %rdi,%rax
+  8041a9:	c3                   	ret
+  8041aa:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8041ad:	c3                   	ret
+
+00000000008041ae <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8041ae:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8041b1:	0f b6 37             	movzbl (%rdi),%esi
+  8041b4:	40 80 fe 20          	cmp    $0x20,%sil
+  8041b8:	74 06                	je     8041c0 <strtol+0x12>
+  8041ba:	40 80 fe 09          	cmp    $0x9,%sil
+  8041be:	75 13                	jne    8041d3 <strtol+0x25>
+  8041c0:	48 83 c7 01          	add    $0x1,%rdi
+  8041c4:	0f b6 37             	movzbl (%rdi),%esi
+  8041c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8041cb:	74 f3                	je     8041c0 <strtol+0x12>
+  8041cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8041d1:	74 ed                	je     8041c0 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8041d3:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8041d6:	83 e0 fd             	and    $0xfffffffd,%eax
+  8041d9:	3c 01                	cmp    $0x1,%al
+  8041db:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041df:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8041e5:	75 0f                	jne    8041f6 <strtol+0x48>
+  8041e7:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8041ea:	74 14                	je     804200 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8041ec:	85 d2                	test   %edx,%edx
+  8041ee:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8041f3:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8041f6:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041fb:	4c 63 ca             	movslq %edx,%r9
+  8041fe:	eb 36                	jmp    804236 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804200:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  804204:	74 0f                	je     804215 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  804206:	85 d2                	test   %edx,%edx
+  804208:	75 ec                	jne    8041f6 <strtol+0x48>
+        s++;
+  80420a:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80420e:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  804213:	eb e1                	jmp    8041f6 <strtol+0x48>
+        s += 2;
+  804215:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  804219:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80421e:	eb d6                	jmp    8041f6 <strtol+0x48>
+            dig -= '0';
+  804220:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  804223:	44 0f b6 c1          	movzbl %cl,%r8d
+  804227:	41 39 d0             	cmp    %edx,%r8d
+  80422a:	7d 21                	jge    80424d <strtol+0x9f>
+        val = val * base + dig;
+  80422c:	49 0f af c1          	imul   %r9,%rax
+  804230:	0f b6 c9             	movzbl %cl,%ecx
+  804233:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  804236:	48 83 c7 01          	add    $0x1,%rdi
+  80423a:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80423e:	80 f9 39             	cmp    $0x39,%cl
+  804241:	76 dd                	jbe    804220 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  804243:	80 f9 7b             	cmp    $0x7b,%cl
+  804246:	77 05                	ja     80424d <strtol+0x9f>
+            dig -= 'a' - 10;
+  804248:	83 e9 57             	sub    $0x57,%ecx
+  80424b:	eb d6                	jmp    804223 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80424d:	4d 85 d2             	test   %r10,%r10
+  804250:	74 03                	je     804255 <strtol+0xa7>
+  804252:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  804255:	48 89 c2             	mov    %rax,%rdx
+  804258:	48 f7 da             	neg    %rdx
+  80425b:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80425f:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804263:	c3                   	ret
+
+0000000000804264 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804264:	55                   	push   %rbp
+  804265:	48 89 e5             	mov    %rsp,%rbp
+  804268:	41 56                	push   %r14
+  80426a:	41 55                	push   %r13
+  80426c:	41 54                	push   %r12
+  80426e:	53                   	push   %rbx
+  80426f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804272:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804279:	00 00 00 
+  80427c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804280:	74 27                	je     8042a9 <_handle_vectored_pagefault+0x45>
+  804282:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804287:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80428e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804291:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804294:	4c 89 e7             	mov    %r12,%rdi
+  804297:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80429c:	84 c0                	test   %al,%al
+  80429e:	75 45                	jne    8042e5 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042a0:	48 83 c3 01          	add    $0x1,%rbx
+  8042a4:	49 3b 1e             	cmp    (%r14),%rbx
+  8042a7:	72 eb                	jb     804294 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8042a9:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8042b0:	00 
+  8042b1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8042b6:	4d 8b 04 24          	mov    (%r12),%r8
+  8042ba:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  8042c1:	00 00 00 
+  8042c4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8042c9:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  8042d0:	00 00 00 
+  8042d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042d8:	49 ba c8 33 80 00 00 	movabs $0x8033c8,%r10
+  8042df:	00 00 00 
+  8042e2:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8042e5:	5b                   	pop    %rbx
+  8042e6:	41 5c                	pop    %r12
+  8042e8:	41 5d                	pop    %r13
+  8042ea:	41 5e                	pop    %r14
+  8042ec:	5d                   	pop    %rbp
+  8042ed:	c3                   	ret
+
+00000000008042ee <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042ee:	55                   	push   %rbp
+  8042ef:	48 89 e5             	mov    %rsp,%rbp
+  8042f2:	53                   	push   %rbx
+  8042f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8042f7:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042fa:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804301:	00 00 00 
+  804304:	80 38 00             	cmpb   $0x0,(%rax)
+  804307:	0f 84 84 00 00 00    	je     804391 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80430d:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804314:	00 00 00 
+  804317:	48 8b 10             	mov    (%rax),%rdx
+  80431a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80431f:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804326:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804329:	48 85 d2             	test   %rdx,%rdx
+  80432c:	74 19                	je     804347 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80432e:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804332:	0f 84 e8 00 00 00    	je     804420 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804338:	48 83 c0 01          	add    $0x1,%rax
+  80433c:	48 39 d0             	cmp    %rdx,%rax
+  80433f:	75 ed                	jne    80432e <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804341:	48 83 fa 08          	cmp    $0x8,%rdx
+  804345:	74 1c                	je     804363 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804347:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80434b:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804352:	00 00 00 
+  804355:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80435c:	00 00 00 
+  80435f:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804363:	48 b8 d2 01 80 00 00 	movabs $0x8001d2,%rax
+  80436a:	00 00 00 
+  80436d:	ff d0                	call   *%rax
+  80436f:	89 c7                	mov    %eax,%edi
+  804371:	48 be 92 06 80 00 00 	movabs $0x800692,%rsi
+  804378:	00 00 00 
+  80437b:	48 b8 1d 04 80 00 00 	movabs $0x80041d,%rax
+  804382:	00 00 00 
+  804385:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804387:	85 c0                	test   %eax,%eax
+  804389:	78 68                	js     8043f3 <add_pgfault_handler+0x105>
+    return res;
+}
+  80438b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80438f:	c9                   	leave
+  804390:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804391:	48 b8 d2 01 80 00 00 	movabs $0x8001d2,%rax
+  804398:	00 00 00 
+  80439b:	ff d0                	call   *%rax
+  80439d:	89 c7                	mov    %eax,%edi
+  80439f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8043a4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043a9:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8043b0:	00 00 00 
+  8043b3:	48 b8 5f 02 80 00 00 	movabs $0x80025f,%rax
+  8043ba:	00 00 00 
+  8043bd:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8043bf:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8043c6:	00 00 00 
+  8043c9:	48 8b 02             	mov    (%rdx),%rax
+  8043cc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8043d0:	48 89 0a             	mov    %rcx,(%rdx)
+  8043d3:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043da:	00 00 00 
+  8043dd:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8043e1:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043e8:	00 00 00 
+  8043eb:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043ee:	e9 70 ff ff ff       	jmp    804363 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043f3:	89 c1                	mov    %eax,%ecx
+  8043f5:	48 ba b6 4d 80 00 00 	movabs $0x804db6,%rdx
+  8043fc:	00 00 00 
+  8043ff:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804404:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  80440b:	00 00 00 
+  80440e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804413:	49 b8 c8 33 80 00 00 	movabs $0x8033c8,%r8
+  80441a:	00 00 00 
+  80441d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804420:	b8 00 00 00 00       	mov    $0x0,%eax
+  804425:	e9 61 ff ff ff       	jmp    80438b <add_pgfault_handler+0x9d>
+
+000000000080442a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80442a:	55                   	push   %rbp
+  80442b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80442e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804435:	00 00 00 
+  804438:	80 38 00             	cmpb   $0x0,(%rax)
+  80443b:	74 33                	je     804470 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80443d:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804444:	00 00 00 
+  804447:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80444c:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804453:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804456:	48 85 c0             	test   %rax,%rax
+  804459:	0f 84 85 00 00 00    	je     8044e4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80445f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804463:	74 40                	je     8044a5 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804465:	48 83 c1 01          	add    $0x1,%rcx
+  804469:	48 39 c1             	cmp    %rax,%rcx
+  80446c:	75 f1                	jne    80445f <remove_pgfault_handler+0x35>
+  80446e:	eb 74                	jmp    8044e4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804470:	48 b9 ce 4d 80 00 00 	movabs $0x804dce,%rcx
+  804477:	00 00 00 
+  80447a:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  804481:	00 00 00 
+  804484:	be 43 00 00 00       	mov    $0x43,%esi
+  804489:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  804490:	00 00 00 
+  804493:	b8 00 00 00 00       	mov    $0x0,%eax
+  804498:	49 b8 c8 33 80 00 00 	movabs $0x8033c8,%r8
+  80449f:	00 00 00 
+  8044a2:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8044a5:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8044ac:	00 
+  8044ad:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8044b1:	48 29 ca             	sub    %rcx,%rdx
+  8044b4:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8044bb:	00 00 00 
+  8044be:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8044c2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8044c7:	48 89 ce             	mov    %rcx,%rsi
+  8044ca:	48 b8 37 40 80 00 00 	movabs $0x804037,%rax
+  8044d1:	00 00 00 
+  8044d4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8044d6:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044dd:	00 00 00 
+  8044e0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8044e4:	5d                   	pop    %rbp
+  8044e5:	c3                   	ret
+
+00000000008044e6 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044e6:	55                   	push   %rbp
+  8044e7:	48 89 e5             	mov    %rsp,%rbp
+  8044ea:	41 55                	push   %r13
+  8044ec:	41 54                	push   %r12
+  8044ee:	53                   	push   %rbx
+  8044ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8044f3:	49 89 fd             	mov    %rdi,%r13
+  8044f6:	48 89 f7             	mov    %rsi,%rdi
+  8044f9:	48 89 d3             	mov    %rdx,%rbx
+  8044fc:	49 89 cc             	mov    %rcx,%r12
+  8044ff:	4c 89 c2             	mov    %r8,%rdx
+  804502:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804505:	48 85 f6             	test   %rsi,%rsi
+  804508:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80450f:	00 00 00 
+  804512:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804516:	be 00 10 00 00       	mov    $0x1000,%esi
+  80451b:	48 85 db             	test   %rbx,%rbx
+  80451e:	74 03                	je     804523 <ipc_recv_futex+0x3d>
+  804520:	48 8b 33             	mov    (%rbx),%rsi
+  804523:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804527:	48 b8 a9 04 80 00 00 	movabs $0x8004a9,%rax
+  80452e:	00 00 00 
+  804531:	ff d0                	call   *%rax
+    if (res < 0) {
+  804533:	85 c0                	test   %eax,%eax
+  804535:	78 75                	js     8045ac <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804537:	4d 85 ed             	test   %r13,%r13
+  80453a:	74 14                	je     804550 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80453c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804543:	00 00 00 
+  804546:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80454c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804550:	4d 85 e4             	test   %r12,%r12
+  804553:	74 14                	je     804569 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804555:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80455c:	00 00 00 
+  80455f:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804565:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804569:	48 85 db             	test   %rbx,%rbx
+  80456c:	74 23                	je     804591 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80456e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804575:	00 00 00 
+  804578:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80457e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804583:	85 c9                	test   %ecx,%ecx
+  804585:	74 07                	je     80458e <ipc_recv_futex+0xa8>
+  804587:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80458e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804591:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804598:	00 00 00 
+  80459b:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045a1:	48 83 c4 08          	add    $0x8,%rsp
+  8045a5:	5b                   	pop    %rbx
+  8045a6:	41 5c                	pop    %r12
+  8045a8:	41 5d                	pop    %r13
+  8045aa:	5d                   	pop    %rbp
+  8045ab:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045ac:	4d 85 ed             	test   %r13,%r13
+  8045af:	74 08                	je     8045b9 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045b1:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b8:	00 
+        if (perm_store != NULL) {
+  8045b9:	4d 85 e4             	test   %r12,%r12
+  8045bc:	74 08                	je     8045c6 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045be:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045c5:	00 
+        if (size != NULL) {
+  8045c6:	48 85 db             	test   %rbx,%rbx
+  8045c9:	74 d6                	je     8045a1 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045cb:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045d2:	eb cd                	jmp    8045a1 <ipc_recv_futex+0xbb>
+
+00000000008045d4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045d4:	55                   	push   %rbp
+  8045d5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8045dc:	6a 00                	push   $0x0
+  8045de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045e4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045ea:	48 b8 e6 44 80 00 00 	movabs $0x8044e6,%rax
+  8045f1:	00 00 00 
+  8045f4:	ff d0                	call   *%rax
+}
+  8045f6:	c9                   	leave
+  8045f7:	c3                   	ret
+
+00000000008045f8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f8:	55                   	push   %rbp
+  8045f9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045fc:	48 85 d2             	test   %rdx,%rdx
+  8045ff:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804606:	00 00 00 
+  804609:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80460d:	89 f6                	mov    %esi,%esi
+  80460f:	48 b8 92 04 80 00 00 	movabs $0x800492,%rax
+  804616:	00 00 00 
+  804619:	ff d0                	call   *%rax
+    if (res < 0) {
+  80461b:	85 c0                	test   %eax,%eax
+  80461d:	78 02                	js     804621 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80461f:	5d                   	pop    %rbp
+  804620:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804621:	89 c1                	mov    %eax,%ecx
+  804623:	48 ba e8 4d 80 00 00 	movabs $0x804de8,%rdx
+  80462a:	00 00 00 
+  80462d:	be 50 00 00 00       	mov    $0x50,%esi
+  804632:	48 bf fc 4d 80 00 00 	movabs $0x804dfc,%rdi
+  804639:	00 00 00 
+  80463c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804641:	49 b8 c8 33 80 00 00 	movabs $0x8033c8,%r8
+  804648:	00 00 00 
+  80464b:	41 ff d0             	call   *%r8
+
+000000000080464e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80464e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804653:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80465a:	00 00 00 
+  80465d:	48 89 d0             	mov    %rdx,%rax
+  804660:	48 c1 e0 04          	shl    $0x4,%rax
+  804664:	48 29 d0             	sub    %rdx,%rax
+  804667:	48 c1 e0 05          	shl    $0x5,%rax
+  80466b:	48 01 c8             	add    %rcx,%rax
+  80466e:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804674:	39 f8                	cmp    %edi,%eax
+  804676:	74 13                	je     80468b <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804678:	48 83 c2 01          	add    $0x1,%rdx
+  80467c:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804683:	75 d8                	jne    80465d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804685:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80468a:	c3                   	ret
+            return envs[i].env_id;
+  80468b:	48 89 d0             	mov    %rdx,%rax
+  80468e:	48 c1 e0 04          	shl    $0x4,%rax
+  804692:	48 29 d0             	sub    %rdx,%rax
+  804695:	48 c1 e0 05          	shl    $0x5,%rax
+  804699:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046a0:	00 00 00 
+  8046a3:	48 01 d0             	add    %rdx,%rax
+  8046a6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046ac:	c3                   	ret
+  8046ad:	0f 1f 00             	nopl   (%rax)
+
+00000000008046b0 <__rodata_start>:
+  8046b0:	3c 75                	cmp    $0x75,%al
+  8046b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046b3:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046b8:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8046bc:	1f                   	(bad)
+  8046bd:	44 00 00             	add    %r8b,(%rax)
+  8046c0:	73 79                	jae    80473b <__rodata_start+0x8b>
+  8046c2:	73 63                	jae    804727 <__rodata_start+0x77>
+  8046c4:	61                   	(bad)
+  8046c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab47 <__bss_end+0x721c8b47>
+  8046cd:	65 74 75             	gs je  804745 <__rodata_start+0x95>
+  8046d0:	72 6e                	jb     804740 <__rodata_start+0x90>
+  8046d2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab54 <__bss_end+0x281c8b54>
+  8046d9:	28 
+  8046da:	3e 20 30             	ds and %dh,(%rax)
+  8046dd:	29 00                	sub    %eax,(%rax)
+  8046df:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046e7:	61                   	(bad)
+  8046e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ea:	2e 63 00             	cs movsxd (%rax),%eax
+  8046ed:	0f 1f 00             	nopl   (%rax)
+  8046f0:	5b                   	pop    %rbx
+  8046f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046f6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046f9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046fe:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  804702:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  804709:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805174 <__ctors_end+0x94>
+  804710:	5b                   	pop    %rbx
+  804711:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804716:	20 66 74             	and    %ah,0x74(%rsi)
+  804719:	72 75                	jb     804790 <devtab+0x10>
+  80471b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80471f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad678a <__bss_end+0x2d29478a>
+  804726:	20 62 61             	and    %ah,0x61(%rdx)
+  804729:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80472d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804731:	5b                   	pop    %rbx
+  804732:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804737:	20 72 65             	and    %dh,0x65(%rdx)
+  80473a:	61                   	(bad)
+  80473b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad67a6 <__bss_end+0x2d2947a6>
+  804742:	20 62 61             	and    %ah,0x61(%rdx)
+  804745:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804749:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80474d:	5b                   	pop    %rbx
+  80474e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804753:	20 77 72             	and    %dh,0x72(%rdi)
+  804756:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80475d:	2d 
+  80475e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804763:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804766:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 90                	xchg   %ax,%ax
+
+0000000000804780 <devtab>:
+  804780:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804790:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8047b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8048a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8048b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8049a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8049b0:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049c0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049d0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049e0:	05 37 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     .7......F=......
+  8049f0:	36 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     6=......F=......
+  804a00:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804a10:	46 3d 80 00 00 00 00 00 24 37 80 00 00 00 00 00     F=......$7......
+  804a20:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804a30:	18 37 80 00 00 00 00 00 92 37 80 00 00 00 00 00     .7.......7......
+  804a40:	46 3d 80 00 00 00 00 00 18 37 80 00 00 00 00 00     F=.......7......
+  804a50:	5e 37 80 00 00 00 00 00 5e 37 80 00 00 00 00 00     ^7......^7......
+  804a60:	5e 37 80 00 00 00 00 00 5e 37 80 00 00 00 00 00     ^7......^7......
+  804a70:	5e 37 80 00 00 00 00 00 5e 37 80 00 00 00 00 00     ^7......^7......
+  804a80:	5e 37 80 00 00 00 00 00 5e 37 80 00 00 00 00 00     ^7......^7......
+  804a90:	5e 37 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     ^7......F=......
+  804aa0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804ab0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804ac0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804ad0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804ae0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804af0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b00:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b10:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b20:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b30:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b40:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b50:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b60:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b70:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804b80:	46 3d 80 00 00 00 00 00 69 3c 80 00 00 00 00 00     F=......i<......
+  804b90:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804ba0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804bb0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804bc0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804bd0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804be0:	b5 37 80 00 00 00 00 00 84 39 80 00 00 00 00 00     .7.......9......
+  804bf0:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804c00:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804c10:	e4 37 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     .7......F=......
+  804c20:	46 3d 80 00 00 00 00 00 aa 37 80 00 00 00 00 00     F=.......7......
+  804c30:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804c40:	2c 3b 80 00 00 00 00 00 f6 3b 80 00 00 00 00 00     ,;.......;......
+  804c50:	46 3d 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     F=......F=......
+  804c60:	7b 38 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     {8......F=......
+  804c70:	58 3a 80 00 00 00 00 00 46 3d 80 00 00 00 00 00     X:......F=......
+  804c80:	46 3d 80 00 00 00 00 00 69 3c 80 00 00 00 00 00     F=......i<......
+  804c90:	46 3d 80 00 00 00 00 00 0e 37 80 00 00 00 00 00     F=.......7......
+
+0000000000804ca0 <error_string>:
+	...
+  804ca8:	55 48 80 00 00 00 00 00 67 48 80 00 00 00 00 00     UH......gH......
+  804cb8:	77 48 80 00 00 00 00 00 89 48 80 00 00 00 00 00     wH.......H......
+  804cc8:	97 48 80 00 00 00 00 00 ab 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	c0 48 80 00 00 00 00 00 d3 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	e5 48 80 00 00 00 00 00 f9 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	09 49 80 00 00 00 00 00 1c 49 80 00 00 00 00 00     .I.......I......
+  804d08:	33 49 80 00 00 00 00 00 49 49 80 00 00 00 00 00     3I......II......
+  804d18:	61 49 80 00 00 00 00 00 79 49 80 00 00 00 00 00     aI......yI......
+  804d28:	86 49 80 00 00 00 00 00 58 4d 80 00 00 00 00 00     .I......XM......
+  804d38:	9a 49 80 00 00 00 00 00 b2 49 80 00 00 00 00 00     .I.......I......
+  804d48:	bc 49 80 00 00 00 00 00 c6 49 80 00 00 00 00 00     .I.......I......
+  804d58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d78:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d88:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d98:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804da8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804db8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804dc8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804dd8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804de8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804df8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
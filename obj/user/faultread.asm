@@ -0,0 +1,8157 @@
+
+obj/user/faultread:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2a 00 00 00       	call   80004d <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from location zero */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+#ifndef __clang_analyzer__
+    cprintf("I read %08x from location 0!\n", *(volatile unsigned *)0);
+  800029:	8b 34 25 00 00 00 00 	mov    0x0,%esi
+  800030:	48 bf b0 46 80 00 00 	movabs $0x8046b0,%rdi
+  800037:	00 00 00 
+  80003a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003f:	48 ba d0 01 80 00 00 	movabs $0x8001d0,%rdx
+  800046:	00 00 00 
+  800049:	ff d2                	call   *%rdx
+#endif
+}
+  80004b:	5d                   	pop    %rbp
+  80004c:	c3                   	ret
+
+000000000080004d <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80004d:	55                   	push   %rbp
+  80004e:	48 89 e5             	mov    %rsp,%rbp
+  800051:	41 56                	push   %r14
+  800053:	41 55                	push   %r13
+  800055:	41 54                	push   %r12
+  800057:	53                   	push   %rbx
+  800058:	41 89 fd             	mov    %edi,%r13d
+  80005b:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800065:	00 00 00 
+  800068:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80006f:	00 00 00 
+  800072:	48 39 c2             	cmp    %rax,%rdx
+  800075:	73 17                	jae    80008e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800077:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007a:	49 89 c4             	mov    %rax,%r12
+  80007d:	48 83 c3 08          	add    $0x8,%rbx
+  800081:	b8 00 00 00 00       	mov    $0x0,%eax
+  800086:	ff 53 f8             	call   *-0x8(%rbx)
+  800089:	4c 39 e3             	cmp    %r12,%rbx
+  80008c:	72 ef                	jb     80007d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80008e:	48 b8 c7 0f 80 00 00 	movabs $0x800fc7,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	89 c2                	mov    %eax,%edx
+  80009c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000a2:	48 89 d0             	mov    %rdx,%rax
+  8000a5:	48 c1 e0 04          	shl    $0x4,%rax
+  8000a9:	48 29 d0             	sub    %rdx,%rax
+  8000ac:	48 c1 e0 05          	shl    $0x5,%rax
+  8000b0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000b7:	00 00 00 
+  8000ba:	48 01 d0             	add    %rdx,%rax
+  8000bd:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c4:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000c7:	45 85 ed             	test   %r13d,%r13d
+  8000ca:	7e 0d                	jle    8000d9 <libmain+0x8c>
+  8000cc:	49 8b 06             	mov    (%r14),%rax
+  8000cf:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000d6:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000d9:	4c 89 f6             	mov    %r14,%rsi
+  8000dc:	44 89 ef             	mov    %r13d,%edi
+  8000df:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000eb:	48 b8 00 01 80 00 00 	movabs $0x800100,%rax
+  8000f2:	00 00 00 
+  8000f5:	ff d0                	call   *%rax
+#endif
+}
+  8000f7:	5b                   	pop    %rbx
+  8000f8:	41 5c                	pop    %r12
+  8000fa:	41 5d                	pop    %r13
+  8000fc:	41 5e                	pop    %r14
+  8000fe:	5d                   	pop    %rbp
+  8000ff:	c3                   	ret
+
+0000000000800100 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800100:	55                   	push   %rbp
+  800101:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800104:	48 b8 ad 16 80 00 00 	movabs $0x8016ad,%rax
+  80010b:	00 00 00 
+  80010e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800110:	bf 00 00 00 00       	mov    $0x0,%edi
+  800115:	48 b8 64 0f 80 00 00 	movabs $0x800f64,%rax
+  80011c:	00 00 00 
+  80011f:	ff d0                	call   *%rax
+}
+  800121:	5d                   	pop    %rbp
+  800122:	c3                   	ret
+
+0000000000800123 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800123:	55                   	push   %rbp
+  800124:	48 89 e5             	mov    %rsp,%rbp
+  800127:	53                   	push   %rbx
+  800128:	48 83 ec 08          	sub    $0x8,%rsp
+  80012c:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80012f:	8b 06                	mov    (%rsi),%eax
+  800131:	8d 50 01             	lea    0x1(%rax),%edx
+  800134:	89 16                	mov    %edx,(%rsi)
+  800136:	48 98                	cltq
+  800138:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80013d:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800143:	74 0a                	je     80014f <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800145:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800149:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80014d:	c9                   	leave
+  80014e:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80014f:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800153:	be ff 00 00 00       	mov    $0xff,%esi
+  800158:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  80015f:	00 00 00 
+  800162:	ff d0                	call   *%rax
+        state->offset = 0;
+  800164:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80016a:	eb d9                	jmp    800145 <putch+0x22>
+
+000000000080016c <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80016c:	55                   	push   %rbp
+  80016d:	48 89 e5             	mov    %rsp,%rbp
+  800170:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800177:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80017a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800181:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800186:	b8 00 00 00 00       	mov    $0x0,%eax
+  80018b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80018e:	48 89 f1             	mov    %rsi,%rcx
+  800191:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800198:	48 bf 23 01 80 00 00 	movabs $0x800123,%rdi
+  80019f:	00 00 00 
+  8001a2:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  8001a9:	00 00 00 
+  8001ac:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001ae:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001b5:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001bc:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  8001c3:	00 00 00 
+  8001c6:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001c8:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001ce:	c9                   	leave
+  8001cf:	c3                   	ret
+
+00000000008001d0 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d0:	55                   	push   %rbp
+  8001d1:	48 89 e5             	mov    %rsp,%rbp
+  8001d4:	48 83 ec 50          	sub    $0x50,%rsp
+  8001d8:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001dc:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001ec:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8001fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8001ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800203:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800207:	48 b8 6c 01 80 00 00 	movabs $0x80016c,%rax
+  80020e:	00 00 00 
+  800211:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800213:	c9                   	leave
+  800214:	c3                   	ret
+
+0000000000800215 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800215:	55                   	push   %rbp
+  800216:	48 89 e5             	mov    %rsp,%rbp
+  800219:	41 57                	push   %r15
+  80021b:	41 56                	push   %r14
+  80021d:	41 55                	push   %r13
+  80021f:	41 54                	push   %r12
+  800221:	53                   	push   %rbx
+  800222:	48 83 ec 18          	sub    $0x18,%rsp
+  800226:	49 89 fc             	mov    %rdi,%r12
+  800229:	49 89 f5             	mov    %rsi,%r13
+  80022c:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800230:	8b 45 10             	mov    0x10(%rbp),%eax
+  800233:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800236:	41 89 cf             	mov    %ecx,%r15d
+  800239:	4c 39 fa             	cmp    %r15,%rdx
+  80023c:	73 5b                	jae    800299 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80023e:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800242:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800246:	85 db                	test   %ebx,%ebx
+  800248:	7e 0e                	jle    800258 <print_num+0x43>
+            putch(padc, put_arg);
+  80024a:	4c 89 ee             	mov    %r13,%rsi
+  80024d:	44 89 f7             	mov    %r14d,%edi
+  800250:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800253:	83 eb 01             	sub    $0x1,%ebx
+  800256:	75 f2                	jne    80024a <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800258:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80025c:	48 b9 e9 46 80 00 00 	movabs $0x8046e9,%rcx
+  800263:	00 00 00 
+  800266:	48 b8 d8 46 80 00 00 	movabs $0x8046d8,%rax
+  80026d:	00 00 00 
+  800270:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800274:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800278:	ba 00 00 00 00       	mov    $0x0,%edx
+  80027d:	49 f7 f7             	div    %r15
+  800280:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800284:	4c 89 ee             	mov    %r13,%rsi
+  800287:	41 ff d4             	call   *%r12
+}
+  80028a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80028e:	5b                   	pop    %rbx
+  80028f:	41 5c                	pop    %r12
+  800291:	41 5d                	pop    %r13
+  800293:	41 5e                	pop    %r14
+  800295:	41 5f                	pop    %r15
+  800297:	5d                   	pop    %rbp
+  800298:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800299:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80029d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a2:	49 f7 f7             	div    %r15
+  8002a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8002a9:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002ad:	52                   	push   %rdx
+  8002ae:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b2:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002b6:	48 89 c2             	mov    %rax,%rdx
+  8002b9:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  8002c0:	00 00 00 
+  8002c3:	ff d0                	call   *%rax
+  8002c5:	48 83 c4 10          	add    $0x10,%rsp
+  8002c9:	eb 8d                	jmp    800258 <print_num+0x43>
+
+00000000008002cb <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002cb:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002cf:	48 8b 06             	mov    (%rsi),%rax
+  8002d2:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002d6:	73 0a                	jae    8002e2 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002d8:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002dc:	48 89 16             	mov    %rdx,(%rsi)
+  8002df:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e2:	c3                   	ret
+
+00000000008002e3 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	48 83 ec 50          	sub    $0x50,%rsp
+  8002eb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002ef:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002f7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8002fe:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800302:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800306:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80030a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80030e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800312:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800319:	00 00 00 
+  80031c:	ff d0                	call   *%rax
+}
+  80031e:	c9                   	leave
+  80031f:	c3                   	ret
+
+0000000000800320 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800320:	55                   	push   %rbp
+  800321:	48 89 e5             	mov    %rsp,%rbp
+  800324:	41 57                	push   %r15
+  800326:	41 56                	push   %r14
+  800328:	41 55                	push   %r13
+  80032a:	41 54                	push   %r12
+  80032c:	53                   	push   %rbx
+  80032d:	48 83 ec 38          	sub    $0x38,%rsp
+  800331:	49 89 fe             	mov    %rdi,%r14
+  800334:	49 89 f5             	mov    %rsi,%r13
+  800337:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80033a:	48 8b 01             	mov    (%rcx),%rax
+  80033d:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800341:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800345:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800349:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80034d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800351:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800355:	0f b6 3b             	movzbl (%rbx),%edi
+  800358:	40 80 ff 25          	cmp    $0x25,%dil
+  80035c:	74 18                	je     800376 <vprintfmt+0x56>
+            if (!ch) return;
+  80035e:	40 84 ff             	test   %dil,%dil
+  800361:	0f 84 b1 06 00 00    	je     800a18 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800367:	40 0f b6 ff          	movzbl %dil,%edi
+  80036b:	4c 89 ee             	mov    %r13,%rsi
+  80036e:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800371:	4c 89 e3             	mov    %r12,%rbx
+  800374:	eb db                	jmp    800351 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800376:	be 00 00 00 00       	mov    $0x0,%esi
+  80037b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80037f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800384:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80038a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800391:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800395:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80039a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80039f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a2:	83 e8 23             	sub    $0x23,%eax
+  8003a5:	3c 57                	cmp    $0x57,%al
+  8003a7:	0f 87 51 06 00 00    	ja     8009fe <vprintfmt+0x6de>
+  8003ad:	0f b6 c0             	movzbl %al,%eax
+  8003b0:	48 b9 a0 48 80 00 00 	movabs $0x8048a0,%rcx
+  8003b7:	00 00 00 
+  8003ba:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003bd:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c0:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003c4:	eb cf                	jmp    800395 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003c6:	49 89 dc             	mov    %rbx,%r12
+  8003c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8003ce:	eb c5                	jmp    800395 <vprintfmt+0x75>
+            padc = ch;
+  8003d0:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003d4:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003d7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003da:	eb b9                	jmp    800395 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003df:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e2:	77 24                	ja     800408 <vprintfmt+0xe8>
+  8003e4:	89 c1                	mov    %eax,%ecx
+  8003e6:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003ea:	83 c0 08             	add    $0x8,%eax
+  8003ed:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f0:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f3:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003f6:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003fa:	79 99                	jns    800395 <vprintfmt+0x75>
+                width = precision;
+  8003fc:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800400:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800406:	eb 8d                	jmp    800395 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800408:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80040c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800410:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800414:	eb da                	jmp    8003f0 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800416:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80041b:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80041f:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800425:	3c 39                	cmp    $0x39,%al
+  800427:	77 1c                	ja     800445 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800429:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80042d:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800431:	0f b6 c0             	movzbl %al,%eax
+  800434:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800439:	0f b6 03             	movzbl (%rbx),%eax
+  80043c:	3c 39                	cmp    $0x39,%al
+  80043e:	76 e9                	jbe    800429 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800440:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800443:	eb b1                	jmp    8003f6 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800445:	49 89 dc             	mov    %rbx,%r12
+  800448:	eb ac                	jmp    8003f6 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80044a:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80044d:	85 c9                	test   %ecx,%ecx
+  80044f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800454:	0f 49 c1             	cmovns %ecx,%eax
+  800457:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80045a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80045d:	e9 33 ff ff ff       	jmp    800395 <vprintfmt+0x75>
+            lflag++;
+  800462:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800465:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800468:	e9 28 ff ff ff       	jmp    800395 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80046d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800470:	83 f8 2f             	cmp    $0x2f,%eax
+  800473:	77 19                	ja     80048e <vprintfmt+0x16e>
+  800475:	89 c2                	mov    %eax,%edx
+  800477:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80047b:	83 c0 08             	add    $0x8,%eax
+  80047e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800481:	8b 3a                	mov    (%rdx),%edi
+  800483:	4c 89 ee             	mov    %r13,%rsi
+  800486:	41 ff d6             	call   *%r14
+            break;
+  800489:	e9 c3 fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80048e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800492:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800496:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049a:	eb e5                	jmp    800481 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80049c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80049f:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a2:	77 5a                	ja     8004fe <vprintfmt+0x1de>
+  8004a4:	89 c2                	mov    %eax,%edx
+  8004a6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004aa:	83 c0 08             	add    $0x8,%eax
+  8004ad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b0:	8b 02                	mov    (%rdx),%eax
+  8004b2:	89 c1                	mov    %eax,%ecx
+  8004b4:	f7 d9                	neg    %ecx
+  8004b6:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004b9:	83 f9 16             	cmp    $0x16,%ecx
+  8004bc:	7f 4e                	jg     80050c <vprintfmt+0x1ec>
+  8004be:	48 63 c1             	movslq %ecx,%rax
+  8004c1:	48 ba 60 4b 80 00 00 	movabs $0x804b60,%rdx
+  8004c8:	00 00 00 
+  8004cb:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004cf:	48 85 c0             	test   %rax,%rax
+  8004d2:	74 38                	je     80050c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004d4:	48 89 c1             	mov    %rax,%rcx
+  8004d7:	48 ba 39 4d 80 00 00 	movabs $0x804d39,%rdx
+  8004de:	00 00 00 
+  8004e1:	4c 89 ee             	mov    %r13,%rsi
+  8004e4:	4c 89 f7             	mov    %r14,%rdi
+  8004e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004ec:	49 b8 e3 02 80 00 00 	movabs $0x8002e3,%r8
+  8004f3:	00 00 00 
+  8004f6:	41 ff d0             	call   *%r8
+  8004f9:	e9 53 fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8004fe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800502:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800506:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050a:	eb a4                	jmp    8004b0 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80050c:	48 ba 01 47 80 00 00 	movabs $0x804701,%rdx
+  800513:	00 00 00 
+  800516:	4c 89 ee             	mov    %r13,%rsi
+  800519:	4c 89 f7             	mov    %r14,%rdi
+  80051c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800521:	49 b8 e3 02 80 00 00 	movabs $0x8002e3,%r8
+  800528:	00 00 00 
+  80052b:	41 ff d0             	call   *%r8
+  80052e:	e9 1e fe ff ff       	jmp    800351 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800533:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800536:	83 f8 2f             	cmp    $0x2f,%eax
+  800539:	77 6c                	ja     8005a7 <vprintfmt+0x287>
+  80053b:	89 c2                	mov    %eax,%edx
+  80053d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800541:	83 c0 08             	add    $0x8,%eax
+  800544:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800547:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80054a:	48 85 d2             	test   %rdx,%rdx
+  80054d:	48 b8 fa 46 80 00 00 	movabs $0x8046fa,%rax
+  800554:	00 00 00 
+  800557:	48 0f 45 c2          	cmovne %rdx,%rax
+  80055b:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80055f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800563:	7e 06                	jle    80056b <vprintfmt+0x24b>
+  800565:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800569:	75 4a                	jne    8005b5 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80056b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80056f:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800573:	0f b6 00             	movzbl (%rax),%eax
+  800576:	84 c0                	test   %al,%al
+  800578:	0f 85 9a 00 00 00    	jne    800618 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80057e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800581:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800585:	85 c0                	test   %eax,%eax
+  800587:	0f 8e c4 fd ff ff    	jle    800351 <vprintfmt+0x31>
+  80058d:	4c 89 ee             	mov    %r13,%rsi
+  800590:	bf 20 00 00 00       	mov    $0x20,%edi
+  800595:	41 ff d6             	call   *%r14
+  800598:	41 83 ec 01          	sub    $0x1,%r12d
+  80059c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a0:	75 eb                	jne    80058d <vprintfmt+0x26d>
+  8005a2:	e9 aa fd ff ff       	jmp    800351 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b3:	eb 92                	jmp    800547 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005b5:	49 63 f7             	movslq %r15d,%rsi
+  8005b8:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005bc:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  8005c3:	00 00 00 
+  8005c6:	ff d0                	call   *%rax
+  8005c8:	48 89 c2             	mov    %rax,%rdx
+  8005cb:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ce:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d0:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d3:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005d6:	85 c0                	test   %eax,%eax
+  8005d8:	7e 91                	jle    80056b <vprintfmt+0x24b>
+  8005da:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005df:	4c 89 ee             	mov    %r13,%rsi
+  8005e2:	44 89 e7             	mov    %r12d,%edi
+  8005e5:	41 ff d6             	call   *%r14
+  8005e8:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005ec:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005ef:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f2:	75 eb                	jne    8005df <vprintfmt+0x2bf>
+  8005f4:	e9 72 ff ff ff       	jmp    80056b <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005f9:	0f b6 f8             	movzbl %al,%edi
+  8005fc:	4c 89 ee             	mov    %r13,%rsi
+  8005ff:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800602:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800606:	49 83 c4 01          	add    $0x1,%r12
+  80060a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800610:	84 c0                	test   %al,%al
+  800612:	0f 84 66 ff ff ff    	je     80057e <vprintfmt+0x25e>
+  800618:	45 85 ff             	test   %r15d,%r15d
+  80061b:	78 0a                	js     800627 <vprintfmt+0x307>
+  80061d:	41 83 ef 01          	sub    $0x1,%r15d
+  800621:	0f 88 57 ff ff ff    	js     80057e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800627:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80062b:	74 cc                	je     8005f9 <vprintfmt+0x2d9>
+  80062d:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800630:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800635:	80 fa 5e             	cmp    $0x5e,%dl
+  800638:	77 c2                	ja     8005fc <vprintfmt+0x2dc>
+  80063a:	eb bd                	jmp    8005f9 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80063c:	40 84 f6             	test   %sil,%sil
+  80063f:	75 26                	jne    800667 <vprintfmt+0x347>
+    switch (lflag) {
+  800641:	85 d2                	test   %edx,%edx
+  800643:	74 59                	je     80069e <vprintfmt+0x37e>
+  800645:	83 fa 01             	cmp    $0x1,%edx
+  800648:	74 7b                	je     8006c5 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80064a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80064d:	83 f8 2f             	cmp    $0x2f,%eax
+  800650:	0f 87 96 00 00 00    	ja     8006ec <vprintfmt+0x3cc>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065c:	83 c0 08             	add    $0x8,%eax
+  80065f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800662:	4c 8b 22             	mov    (%rdx),%r12
+  800665:	eb 17                	jmp    80067e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800667:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066a:	83 f8 2f             	cmp    $0x2f,%eax
+  80066d:	77 21                	ja     800690 <vprintfmt+0x370>
+  80066f:	89 c2                	mov    %eax,%edx
+  800671:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800675:	83 c0 08             	add    $0x8,%eax
+  800678:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80067b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80067e:	4d 85 e4             	test   %r12,%r12
+  800681:	78 7a                	js     8006fd <vprintfmt+0x3dd>
+            num = i;
+  800683:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800686:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80068b:	e9 50 02 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800690:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800694:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb dd                	jmp    80067b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80069e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a4:	77 11                	ja     8006b7 <vprintfmt+0x397>
+  8006a6:	89 c2                	mov    %eax,%edx
+  8006a8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ac:	83 c0 08             	add    $0x8,%eax
+  8006af:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b2:	4c 63 22             	movslq (%rdx),%r12
+  8006b5:	eb c7                	jmp    80067e <vprintfmt+0x35e>
+  8006b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c3:	eb ed                	jmp    8006b2 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8006cb:	77 11                	ja     8006de <vprintfmt+0x3be>
+  8006cd:	89 c2                	mov    %eax,%edx
+  8006cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d3:	83 c0 08             	add    $0x8,%eax
+  8006d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d9:	4c 8b 22             	mov    (%rdx),%r12
+  8006dc:	eb a0                	jmp    80067e <vprintfmt+0x35e>
+  8006de:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ea:	eb ed                	jmp    8006d9 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006ec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	e9 65 ff ff ff       	jmp    800662 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8006fd:	4c 89 ee             	mov    %r13,%rsi
+  800700:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800705:	41 ff d6             	call   *%r14
+                i = -i;
+  800708:	49 f7 dc             	neg    %r12
+  80070b:	e9 73 ff ff ff       	jmp    800683 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800710:	40 84 f6             	test   %sil,%sil
+  800713:	75 32                	jne    800747 <vprintfmt+0x427>
+    switch (lflag) {
+  800715:	85 d2                	test   %edx,%edx
+  800717:	74 5d                	je     800776 <vprintfmt+0x456>
+  800719:	83 fa 01             	cmp    $0x1,%edx
+  80071c:	0f 84 82 00 00 00    	je     8007a4 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800722:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800725:	83 f8 2f             	cmp    $0x2f,%eax
+  800728:	0f 87 a5 00 00 00    	ja     8007d3 <vprintfmt+0x4b3>
+  80072e:	89 c2                	mov    %eax,%edx
+  800730:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800734:	83 c0 08             	add    $0x8,%eax
+  800737:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80073d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800742:	e9 99 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800747:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074a:	83 f8 2f             	cmp    $0x2f,%eax
+  80074d:	77 19                	ja     800768 <vprintfmt+0x448>
+  80074f:	89 c2                	mov    %eax,%edx
+  800751:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800755:	83 c0 08             	add    $0x8,%eax
+  800758:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80075e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800763:	e9 78 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800768:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80076c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800770:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800774:	eb e5                	jmp    80075b <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800776:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800779:	83 f8 2f             	cmp    $0x2f,%eax
+  80077c:	77 18                	ja     800796 <vprintfmt+0x476>
+  80077e:	89 c2                	mov    %eax,%edx
+  800780:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800784:	83 c0 08             	add    $0x8,%eax
+  800787:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80078c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800791:	e9 4a 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800796:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80079e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a2:	eb e6                	jmp    80078a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8007aa:	77 19                	ja     8007c5 <vprintfmt+0x4a5>
+  8007ac:	89 c2                	mov    %eax,%edx
+  8007ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b2:	83 c0 08             	add    $0x8,%eax
+  8007b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007bb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c0:	e9 1b 01 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  8007c5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d1:	eb e5                	jmp    8007b8 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	e9 56 ff ff ff       	jmp    80073a <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e4:	40 84 f6             	test   %sil,%sil
+  8007e7:	75 2e                	jne    800817 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007e9:	85 d2                	test   %edx,%edx
+  8007eb:	74 59                	je     800846 <vprintfmt+0x526>
+  8007ed:	83 fa 01             	cmp    $0x1,%edx
+  8007f0:	74 7f                	je     800871 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007f5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007f8:	0f 87 9f 00 00 00    	ja     80089d <vprintfmt+0x57d>
+  8007fe:	89 c2                	mov    %eax,%edx
+  800800:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800804:	83 c0 08             	add    $0x8,%eax
+  800807:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80080d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800812:	e9 c9 00 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	77 19                	ja     800838 <vprintfmt+0x518>
+  80081f:	89 c2                	mov    %eax,%edx
+  800821:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800825:	83 c0 08             	add    $0x8,%eax
+  800828:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80082e:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800833:	e9 a8 00 00 00       	jmp    8008e0 <vprintfmt+0x5c0>
+  800838:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800840:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800844:	eb e5                	jmp    80082b <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800846:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800849:	83 f8 2f             	cmp    $0x2f,%eax
+  80084c:	77 15                	ja     800863 <vprintfmt+0x543>
+  80084e:	89 c2                	mov    %eax,%edx
+  800850:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800854:	83 c0 08             	add    $0x8,%eax
+  800857:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085a:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80085c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800861:	eb 7d                	jmp    8008e0 <vprintfmt+0x5c0>
+  800863:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800867:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb e9                	jmp    80085a <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800871:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800874:	83 f8 2f             	cmp    $0x2f,%eax
+  800877:	77 16                	ja     80088f <vprintfmt+0x56f>
+  800879:	89 c2                	mov    %eax,%edx
+  80087b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087f:	83 c0 08             	add    $0x8,%eax
+  800882:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800885:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800888:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  80088d:	eb 51                	jmp    8008e0 <vprintfmt+0x5c0>
+  80088f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800893:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800897:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80089b:	eb e8                	jmp    800885 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  80089d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a9:	e9 5c ff ff ff       	jmp    80080a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008ae:	4c 89 ee             	mov    %r13,%rsi
+  8008b1:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008b6:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008b9:	4c 89 ee             	mov    %r13,%rsi
+  8008bc:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c1:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008c4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c7:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ca:	77 47                	ja     800913 <vprintfmt+0x5f3>
+  8008cc:	89 c2                	mov    %eax,%edx
+  8008ce:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d2:	83 c0 08             	add    $0x8,%eax
+  8008d5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008db:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e4:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008e8:	0f 94 c0             	sete   %al
+  8008eb:	0f b6 c0             	movzbl %al,%eax
+  8008ee:	50                   	push   %rax
+  8008ef:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008f4:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008f8:	4c 89 ee             	mov    %r13,%rsi
+  8008fb:	4c 89 f7             	mov    %r14,%rdi
+  8008fe:	48 b8 15 02 80 00 00 	movabs $0x800215,%rax
+  800905:	00 00 00 
+  800908:	ff d0                	call   *%rax
+            break;
+  80090a:	48 83 c4 10          	add    $0x10,%rsp
+  80090e:	e9 3e fa ff ff       	jmp    800351 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800913:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800917:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091f:	eb b7                	jmp    8008d8 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800921:	40 84 f6             	test   %sil,%sil
+  800924:	75 2b                	jne    800951 <vprintfmt+0x631>
+    switch (lflag) {
+  800926:	85 d2                	test   %edx,%edx
+  800928:	74 56                	je     800980 <vprintfmt+0x660>
+  80092a:	83 fa 01             	cmp    $0x1,%edx
+  80092d:	74 7f                	je     8009ae <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	0f 87 a2 00 00 00    	ja     8009dd <vprintfmt+0x6bd>
+  80093b:	89 c2                	mov    %eax,%edx
+  80093d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800941:	83 c0 08             	add    $0x8,%eax
+  800944:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800947:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80094a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094f:	eb 8f                	jmp    8008e0 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800951:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800954:	83 f8 2f             	cmp    $0x2f,%eax
+  800957:	77 19                	ja     800972 <vprintfmt+0x652>
+  800959:	89 c2                	mov    %eax,%edx
+  80095b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095f:	83 c0 08             	add    $0x8,%eax
+  800962:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800965:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800968:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096d:	e9 6e ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	eb e5                	jmp    800965 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800983:	83 f8 2f             	cmp    $0x2f,%eax
+  800986:	77 18                	ja     8009a0 <vprintfmt+0x680>
+  800988:	89 c2                	mov    %eax,%edx
+  80098a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098e:	83 c0 08             	add    $0x8,%eax
+  800991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800994:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800996:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  80099b:	e9 40 ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  8009a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ac:	eb e6                	jmp    800994 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b4:	77 19                	ja     8009cf <vprintfmt+0x6af>
+  8009b6:	89 c2                	mov    %eax,%edx
+  8009b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bc:	83 c0 08             	add    $0x8,%eax
+  8009bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ca:	e9 11 ff ff ff       	jmp    8008e0 <vprintfmt+0x5c0>
+  8009cf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009db:	eb e5                	jmp    8009c2 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009dd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e9:	e9 59 ff ff ff       	jmp    800947 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009ee:	4c 89 ee             	mov    %r13,%rsi
+  8009f1:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009f6:	41 ff d6             	call   *%r14
+            break;
+  8009f9:	e9 53 f9 ff ff       	jmp    800351 <vprintfmt+0x31>
+            putch('%', put_arg);
+  8009fe:	4c 89 ee             	mov    %r13,%rsi
+  800a01:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a06:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a09:	48 83 eb 01          	sub    $0x1,%rbx
+  800a0d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a11:	75 f6                	jne    800a09 <vprintfmt+0x6e9>
+  800a13:	e9 39 f9 ff ff       	jmp    800351 <vprintfmt+0x31>
+}
+  800a18:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a1c:	5b                   	pop    %rbx
+  800a1d:	41 5c                	pop    %r12
+  800a1f:	41 5d                	pop    %r13
+  800a21:	41 5e                	pop    %r14
+  800a23:	41 5f                	pop    %r15
+  800a25:	5d                   	pop    %rbp
+  800a26:	c3                   	ret
+
+0000000000800a27 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a27:	55                   	push   %rbp
+  800a28:	48 89 e5             	mov    %rsp,%rbp
+  800a2b:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a2f:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a33:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a38:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a3c:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a43:	48 85 ff             	test   %rdi,%rdi
+  800a46:	74 2b                	je     800a73 <vsnprintf+0x4c>
+  800a48:	48 85 f6             	test   %rsi,%rsi
+  800a4b:	74 26                	je     800a73 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a4d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a51:	48 bf cb 02 80 00 00 	movabs $0x8002cb,%rdi
+  800a58:	00 00 00 
+  800a5b:	48 b8 20 03 80 00 00 	movabs $0x800320,%rax
+  800a62:	00 00 00 
+  800a65:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a67:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a6b:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a6e:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a71:	c9                   	leave
+  800a72:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a73:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a78:	eb f7                	jmp    800a71 <vsnprintf+0x4a>
+
+0000000000800a7a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a7a:	55                   	push   %rbp
+  800a7b:	48 89 e5             	mov    %rsp,%rbp
+  800a7e:	48 83 ec 50          	sub    $0x50,%rsp
+  800a82:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a86:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a8a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a8e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a95:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a99:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aa5:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aa9:	48 b8 27 0a 80 00 00 	movabs $0x800a27,%rax
+  800ab0:	00 00 00 
+  800ab3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ab5:	c9                   	leave
+  800ab6:	c3                   	ret
+
+0000000000800ab7 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ab7:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800aba:	74 10                	je     800acc <strlen+0x15>
+    size_t n = 0;
+  800abc:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac1:	48 83 c0 01          	add    $0x1,%rax
+  800ac5:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ac9:	75 f6                	jne    800ac1 <strlen+0xa>
+  800acb:	c3                   	ret
+    size_t n = 0;
+  800acc:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad1:	c3                   	ret
+
+0000000000800ad2 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad2:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ad5:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ada:	48 85 f6             	test   %rsi,%rsi
+  800add:	74 11                	je     800af0 <strnlen+0x1e>
+  800adf:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae3:	74 0c                	je     800af1 <strnlen+0x1f>
+  800ae5:	48 83 c2 01          	add    $0x1,%rdx
+  800ae9:	48 39 d0             	cmp    %rdx,%rax
+  800aec:	75 f1                	jne    800adf <strnlen+0xd>
+  800aee:	eb 04                	jmp    800af4 <strnlen+0x22>
+  800af0:	c3                   	ret
+  800af1:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800af4:	c3                   	ret
+
+0000000000800af5 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800af5:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800af8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800afd:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b01:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b04:	48 83 c2 01          	add    $0x1,%rdx
+  800b08:	84 c9                	test   %cl,%cl
+  800b0a:	75 f1                	jne    800afd <strcpy+0x8>
+        ;
+    return res;
+}
+  800b0c:	c3                   	ret
+
+0000000000800b0d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b0d:	55                   	push   %rbp
+  800b0e:	48 89 e5             	mov    %rsp,%rbp
+  800b11:	41 54                	push   %r12
+  800b13:	53                   	push   %rbx
+  800b14:	48 89 fb             	mov    %rdi,%rbx
+  800b17:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b1a:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800b21:	00 00 00 
+  800b24:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b26:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b2a:	4c 89 e6             	mov    %r12,%rsi
+  800b2d:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+    return dst;
+}
+  800b39:	48 89 d8             	mov    %rbx,%rax
+  800b3c:	5b                   	pop    %rbx
+  800b3d:	41 5c                	pop    %r12
+  800b3f:	5d                   	pop    %rbp
+  800b40:	c3                   	ret
+
+0000000000800b41 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b41:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b44:	48 85 d2             	test   %rdx,%rdx
+  800b47:	74 1f                	je     800b68 <strncpy+0x27>
+  800b49:	48 01 fa             	add    %rdi,%rdx
+  800b4c:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b4f:	48 83 c1 01          	add    $0x1,%rcx
+  800b53:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b57:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b5b:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b5f:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b63:	48 39 ca             	cmp    %rcx,%rdx
+  800b66:	75 e7                	jne    800b4f <strncpy+0xe>
+    }
+    return ret;
+}
+  800b68:	c3                   	ret
+
+0000000000800b69 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b69:	48 89 f8             	mov    %rdi,%rax
+  800b6c:	48 85 d2             	test   %rdx,%rdx
+  800b6f:	74 24                	je     800b95 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b71:	48 83 ea 01          	sub    $0x1,%rdx
+  800b75:	74 1b                	je     800b92 <strlcpy+0x29>
+  800b77:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b7b:	0f b6 16             	movzbl (%rsi),%edx
+  800b7e:	84 d2                	test   %dl,%dl
+  800b80:	74 10                	je     800b92 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b82:	48 83 c6 01          	add    $0x1,%rsi
+  800b86:	48 83 c0 01          	add    $0x1,%rax
+  800b8a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b8d:	48 39 c8             	cmp    %rcx,%rax
+  800b90:	75 e9                	jne    800b7b <strlcpy+0x12>
+        *dst = '\0';
+  800b92:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b95:	48 29 f8             	sub    %rdi,%rax
+}
+  800b98:	c3                   	ret
+
+0000000000800b99 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b99:	0f b6 07             	movzbl (%rdi),%eax
+  800b9c:	84 c0                	test   %al,%al
+  800b9e:	74 13                	je     800bb3 <strcmp+0x1a>
+  800ba0:	38 06                	cmp    %al,(%rsi)
+  800ba2:	75 0f                	jne    800bb3 <strcmp+0x1a>
+  800ba4:	48 83 c7 01          	add    $0x1,%rdi
+  800ba8:	48 83 c6 01          	add    $0x1,%rsi
+  800bac:	0f b6 07             	movzbl (%rdi),%eax
+  800baf:	84 c0                	test   %al,%al
+  800bb1:	75 ed                	jne    800ba0 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb3:	0f b6 c0             	movzbl %al,%eax
+  800bb6:	0f b6 16             	movzbl (%rsi),%edx
+  800bb9:	29 d0                	sub    %edx,%eax
+}
+  800bbb:	c3                   	ret
+
+0000000000800bbc <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bbc:	48 85 d2             	test   %rdx,%rdx
+  800bbf:	74 1f                	je     800be0 <strncmp+0x24>
+  800bc1:	0f b6 07             	movzbl (%rdi),%eax
+  800bc4:	84 c0                	test   %al,%al
+  800bc6:	74 1e                	je     800be6 <strncmp+0x2a>
+  800bc8:	3a 06                	cmp    (%rsi),%al
+  800bca:	75 1a                	jne    800be6 <strncmp+0x2a>
+  800bcc:	48 83 c7 01          	add    $0x1,%rdi
+  800bd0:	48 83 c6 01          	add    $0x1,%rsi
+  800bd4:	48 83 ea 01          	sub    $0x1,%rdx
+  800bd8:	75 e7                	jne    800bc1 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bda:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bdf:	c3                   	ret
+  800be0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be5:	c3                   	ret
+  800be6:	48 85 d2             	test   %rdx,%rdx
+  800be9:	74 09                	je     800bf4 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800beb:	0f b6 07             	movzbl (%rdi),%eax
+  800bee:	0f b6 16             	movzbl (%rsi),%edx
+  800bf1:	29 d0                	sub    %edx,%eax
+  800bf3:	c3                   	ret
+    if (!n) return 0;
+  800bf4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bf9:	c3                   	ret
+
+0000000000800bfa <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bfa:	0f b6 17             	movzbl (%rdi),%edx
+  800bfd:	84 d2                	test   %dl,%dl
+  800bff:	74 18                	je     800c19 <strchr+0x1f>
+        if (*str == c) {
+  800c01:	0f be d2             	movsbl %dl,%edx
+  800c04:	39 f2                	cmp    %esi,%edx
+  800c06:	74 17                	je     800c1f <strchr+0x25>
+    for (; *str; str++) {
+  800c08:	48 83 c7 01          	add    $0x1,%rdi
+  800c0c:	0f b6 17             	movzbl (%rdi),%edx
+  800c0f:	84 d2                	test   %dl,%dl
+  800c11:	75 ee                	jne    800c01 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c18:	c3                   	ret
+  800c19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1e:	c3                   	ret
+  800c1f:	48 89 f8             	mov    %rdi,%rax
+}
+  800c22:	c3                   	ret
+
+0000000000800c23 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c23:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c26:	0f b6 17             	movzbl (%rdi),%edx
+  800c29:	84 d2                	test   %dl,%dl
+  800c2b:	74 13                	je     800c40 <strfind+0x1d>
+  800c2d:	0f be d2             	movsbl %dl,%edx
+  800c30:	39 f2                	cmp    %esi,%edx
+  800c32:	74 0b                	je     800c3f <strfind+0x1c>
+  800c34:	48 83 c0 01          	add    $0x1,%rax
+  800c38:	0f b6 10             	movzbl (%rax),%edx
+  800c3b:	84 d2                	test   %dl,%dl
+  800c3d:	75 ee                	jne    800c2d <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c3f:	c3                   	ret
+  800c40:	c3                   	ret
+
+0000000000800c41 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c41:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c44:	48 89 f8             	mov    %rdi,%rax
+  800c47:	48 f7 d8             	neg    %rax
+  800c4a:	83 e0 07             	and    $0x7,%eax
+  800c4d:	49 89 d1             	mov    %rdx,%r9
+  800c50:	49 29 c1             	sub    %rax,%r9
+  800c53:	78 36                	js     800c8b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c55:	40 0f b6 c6          	movzbl %sil,%eax
+  800c59:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c60:	01 01 01 
+  800c63:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c67:	40 f6 c7 07          	test   $0x7,%dil
+  800c6b:	75 38                	jne    800ca5 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c6d:	4c 89 c9             	mov    %r9,%rcx
+  800c70:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c74:	74 0c                	je     800c82 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c76:	fc                   	cld
+  800c77:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c7a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c7e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c82:	4d 85 c9             	test   %r9,%r9
+  800c85:	75 45                	jne    800ccc <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c87:	4c 89 c0             	mov    %r8,%rax
+  800c8a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c8b:	48 85 d2             	test   %rdx,%rdx
+  800c8e:	74 f7                	je     800c87 <memset+0x46>
+  800c90:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c93:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c96:	48 83 c0 01          	add    $0x1,%rax
+  800c9a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800c9e:	48 39 c2             	cmp    %rax,%rdx
+  800ca1:	75 f3                	jne    800c96 <memset+0x55>
+  800ca3:	eb e2                	jmp    800c87 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ca5:	40 f6 c7 01          	test   $0x1,%dil
+  800ca9:	74 06                	je     800cb1 <memset+0x70>
+  800cab:	88 07                	mov    %al,(%rdi)
+  800cad:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb1:	40 f6 c7 02          	test   $0x2,%dil
+  800cb5:	74 07                	je     800cbe <memset+0x7d>
+  800cb7:	66 89 07             	mov    %ax,(%rdi)
+  800cba:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cbe:	40 f6 c7 04          	test   $0x4,%dil
+  800cc2:	74 a9                	je     800c6d <memset+0x2c>
+  800cc4:	89 07                	mov    %eax,(%rdi)
+  800cc6:	48 83 c7 04          	add    $0x4,%rdi
+  800cca:	eb a1                	jmp    800c6d <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ccc:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd0:	74 06                	je     800cd8 <memset+0x97>
+  800cd2:	89 07                	mov    %eax,(%rdi)
+  800cd4:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd8:	41 f6 c1 02          	test   $0x2,%r9b
+  800cdc:	74 07                	je     800ce5 <memset+0xa4>
+  800cde:	66 89 07             	mov    %ax,(%rdi)
+  800ce1:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ce5:	41 f6 c1 01          	test   $0x1,%r9b
+  800ce9:	74 9c                	je     800c87 <memset+0x46>
+  800ceb:	88 07                	mov    %al,(%rdi)
+  800ced:	eb 98                	jmp    800c87 <memset+0x46>
+
+0000000000800cef <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cef:	48 89 f8             	mov    %rdi,%rax
+  800cf2:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cf5:	48 39 fe             	cmp    %rdi,%rsi
+  800cf8:	73 3b                	jae    800d35 <memmove+0x46>
+  800cfa:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800cfe:	48 39 d7             	cmp    %rdx,%rdi
+  800d01:	73 32                	jae    800d35 <memmove+0x46>
+        s += n;
+        d += n;
+  800d03:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d07:	48 89 d6             	mov    %rdx,%rsi
+  800d0a:	48 09 fe             	or     %rdi,%rsi
+  800d0d:	48 09 ce             	or     %rcx,%rsi
+  800d10:	40 f6 c6 07          	test   $0x7,%sil
+  800d14:	75 12                	jne    800d28 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d16:	48 83 ef 08          	sub    $0x8,%rdi
+  800d1a:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d1e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d22:	fd                   	std
+  800d23:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d26:	fc                   	cld
+  800d27:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d28:	48 83 ef 01          	sub    $0x1,%rdi
+  800d2c:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d30:	fd                   	std
+  800d31:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d33:	eb f1                	jmp    800d26 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d35:	48 89 f2             	mov    %rsi,%rdx
+  800d38:	48 09 c2             	or     %rax,%rdx
+  800d3b:	48 09 ca             	or     %rcx,%rdx
+  800d3e:	f6 c2 07             	test   $0x7,%dl
+  800d41:	75 0c                	jne    800d4f <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d43:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d47:	48 89 c7             	mov    %rax,%rdi
+  800d4a:	fc                   	cld
+  800d4b:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d4e:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d4f:	48 89 c7             	mov    %rax,%rdi
+  800d52:	fc                   	cld
+  800d53:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d55:	c3                   	ret
+
+0000000000800d56 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d56:	55                   	push   %rbp
+  800d57:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d5a:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  800d61:	00 00 00 
+  800d64:	ff d0                	call   *%rax
+}
+  800d66:	5d                   	pop    %rbp
+  800d67:	c3                   	ret
+
+0000000000800d68 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d68:	55                   	push   %rbp
+  800d69:	48 89 e5             	mov    %rsp,%rbp
+  800d6c:	41 57                	push   %r15
+  800d6e:	41 56                	push   %r14
+  800d70:	41 55                	push   %r13
+  800d72:	41 54                	push   %r12
+  800d74:	53                   	push   %rbx
+  800d75:	48 83 ec 08          	sub    $0x8,%rsp
+  800d79:	49 89 fe             	mov    %rdi,%r14
+  800d7c:	49 89 f7             	mov    %rsi,%r15
+  800d7f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d82:	48 89 f7             	mov    %rsi,%rdi
+  800d85:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+  800d91:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d94:	48 89 de             	mov    %rbx,%rsi
+  800d97:	4c 89 f7             	mov    %r14,%rdi
+  800d9a:	48 b8 d2 0a 80 00 00 	movabs $0x800ad2,%rax
+  800da1:	00 00 00 
+  800da4:	ff d0                	call   *%rax
+  800da6:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800da9:	48 39 c3             	cmp    %rax,%rbx
+  800dac:	74 36                	je     800de4 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dae:	48 89 d8             	mov    %rbx,%rax
+  800db1:	4c 29 e8             	sub    %r13,%rax
+  800db4:	49 39 c4             	cmp    %rax,%r12
+  800db7:	73 31                	jae    800dea <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800db9:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dbe:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc2:	4c 89 fe             	mov    %r15,%rsi
+  800dc5:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  800dcc:	00 00 00 
+  800dcf:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd1:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dd5:	48 83 c4 08          	add    $0x8,%rsp
+  800dd9:	5b                   	pop    %rbx
+  800dda:	41 5c                	pop    %r12
+  800ddc:	41 5d                	pop    %r13
+  800dde:	41 5e                	pop    %r14
+  800de0:	41 5f                	pop    %r15
+  800de2:	5d                   	pop    %rbp
+  800de3:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de4:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800de8:	eb eb                	jmp    800dd5 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800dea:	48 83 eb 01          	sub    $0x1,%rbx
+  800dee:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df2:	48 89 da             	mov    %rbx,%rdx
+  800df5:	4c 89 fe             	mov    %r15,%rsi
+  800df8:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  800dff:	00 00 00 
+  800e02:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e04:	49 01 de             	add    %rbx,%r14
+  800e07:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e0c:	eb c3                	jmp    800dd1 <strlcat+0x69>
+
+0000000000800e0e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e0e:	48 85 d2             	test   %rdx,%rdx
+  800e11:	74 2d                	je     800e40 <memcmp+0x32>
+  800e13:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e18:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e1c:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e21:	44 38 c1             	cmp    %r8b,%cl
+  800e24:	75 0f                	jne    800e35 <memcmp+0x27>
+    while (n-- > 0) {
+  800e26:	48 83 c0 01          	add    $0x1,%rax
+  800e2a:	48 39 c2             	cmp    %rax,%rdx
+  800e2d:	75 e9                	jne    800e18 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e2f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e34:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e35:	0f b6 c1             	movzbl %cl,%eax
+  800e38:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e3c:	44 29 c0             	sub    %r8d,%eax
+  800e3f:	c3                   	ret
+    return 0;
+  800e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e45:	c3                   	ret
+
+0000000000800e46 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e46:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e4a:	48 39 c7             	cmp    %rax,%rdi
+  800e4d:	73 0f                	jae    800e5e <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e4f:	40 38 37             	cmp    %sil,(%rdi)
+  800e52:	74 0e                	je     800e62 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e54:	48 83 c7 01          	add    $0x1,%rdi
+  800e58:	48 39 f8             	cmp    %rdi,%rax
+  800e5b:	75 f2                	jne    800e4f <memfind+0x9>
+  800e5d:	c3                   	ret
+  800e5e:	48 89 f8             	mov    %rdi,%rax
+  800e61:	c3                   	ret
+  800e62:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e65:	c3                   	ret
+
+0000000000800e66 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e66:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e69:	0f b6 37             	movzbl (%rdi),%esi
+  800e6c:	40 80 fe 20          	cmp    $0x20,%sil
+  800e70:	74 06                	je     800e78 <strtol+0x12>
+  800e72:	40 80 fe 09          	cmp    $0x9,%sil
+  800e76:	75 13                	jne    800e8b <strtol+0x25>
+  800e78:	48 83 c7 01          	add    $0x1,%rdi
+  800e7c:	0f b6 37             	movzbl (%rdi),%esi
+  800e7f:	40 80 fe 20          	cmp    $0x20,%sil
+  800e83:	74 f3                	je     800e78 <strtol+0x12>
+  800e85:	40 80 fe 09          	cmp    $0x9,%sil
+  800e89:	74 ed                	je     800e78 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e8b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e8e:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e91:	3c 01                	cmp    $0x1,%al
+  800e93:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e97:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800e9d:	75 0f                	jne    800eae <strtol+0x48>
+  800e9f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea2:	74 14                	je     800eb8 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ea4:	85 d2                	test   %edx,%edx
+  800ea6:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eab:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eae:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb3:	4c 63 ca             	movslq %edx,%r9
+  800eb6:	eb 36                	jmp    800eee <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eb8:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ebc:	74 0f                	je     800ecd <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ebe:	85 d2                	test   %edx,%edx
+  800ec0:	75 ec                	jne    800eae <strtol+0x48>
+        s++;
+  800ec2:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ec6:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ecb:	eb e1                	jmp    800eae <strtol+0x48>
+        s += 2;
+  800ecd:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed1:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ed6:	eb d6                	jmp    800eae <strtol+0x48>
+            dig -= '0';
+  800ed8:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800edb:	44 0f b6 c1          	movzbl %cl,%r8d
+  800edf:	41 39 d0             	cmp    %edx,%r8d
+  800ee2:	7d 21                	jge    800f05 <strtol+0x9f>
+        val = val * base + dig;
+  800ee4:	49 0f af c1          	imul   %r9,%rax
+  800ee8:	0f b6 c9             	movzbl %cl,%ecx
+  800eeb:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800eee:	48 83 c7 01          	add    $0x1,%rdi
+  800ef2:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800ef6:	80 f9 39             	cmp    $0x39,%cl
+  800ef9:	76 dd                	jbe    800ed8 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800efb:	80 f9 7b             	cmp    $0x7b,%cl
+  800efe:	77 05                	ja     800f05 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f00:	83 e9 57             	sub    $0x57,%ecx
+  800f03:	eb d6                	jmp    800edb <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f05:	4d 85 d2             	test   %r10,%r10
+  800f08:	74 03                	je     800f0d <strtol+0xa7>
+  800f0a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f0d:	48 89 c2             	mov    %rax,%rdx
+  800f10:	48 f7 da             	neg    %rdx
+  800f13:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f17:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f1b:	c3                   	ret
+
+0000000000800f1c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f1c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f26:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f2c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f32:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f38:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f3a:	c3                   	ret
+
+0000000000800f3b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f3b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f40:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f45:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f4f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f55:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f5b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f61:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f63:	c3                   	ret
+
+0000000000800f64 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f64:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f67:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f6c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f71:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f76:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f7c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f82:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f88:	0f 05                	syscall
+    if (check && ret > 0) {
+  800f8a:	48 85 c0             	test   %rax,%rax
+  800f8d:	7f 01                	jg     800f90 <sys_env_destroy+0x2c>
+}
+  800f8f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800f90:	55                   	push   %rbp
+  800f91:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800f94:	49 89 c0             	mov    %rax,%r8
+  800f97:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800f9c:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  800fa3:	00 00 00 
+  800fa6:	be 29 00 00 00       	mov    $0x29,%esi
+  800fab:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  800fb2:	00 00 00 
+  800fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fba:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  800fc1:	00 00 00 
+  800fc4:	41 ff d1             	call   *%r9
+
+0000000000800fc7 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fc7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fcc:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fe1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fe7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800fed:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800fef:	c3                   	ret
+
+0000000000800ff0 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  800ff0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800ff5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ffa:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801004:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80100a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801010:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801016:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801018:	c3                   	ret
+
+0000000000801019 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801019:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80101e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801025:	00 00 00 
+  801028:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801034:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80103a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80103c:	c3                   	ret
+
+000000000080103d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80103d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801040:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801045:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80104b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801051:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801053:	c3                   	ret
+
+0000000000801054 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801054:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801057:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80105c:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80105f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801065:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80106b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80106d:	48 85 c0             	test   %rax,%rax
+  801070:	7f 01                	jg     801073 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801072:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801073:	55                   	push   %rbp
+  801074:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801077:	49 89 c0             	mov    %rax,%r8
+  80107a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80107f:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801086:	00 00 00 
+  801089:	be 29 00 00 00       	mov    $0x29,%esi
+  80108e:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801095:	00 00 00 
+  801098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80109d:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  8010a4:	00 00 00 
+  8010a7:	41 ff d1             	call   *%r9
+
+00000000008010aa <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010aa:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010ad:	48 63 d2             	movslq %edx,%rdx
+  8010b0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010b3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b8:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010bb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010bd:	48 85 c0             	test   %rax,%rax
+  8010c0:	7f 01                	jg     8010c3 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010c2:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010c3:	55                   	push   %rbp
+  8010c4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010c7:	49 89 c0             	mov    %rax,%r8
+  8010ca:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010cf:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8010d6:	00 00 00 
+  8010d9:	be 29 00 00 00       	mov    $0x29,%esi
+  8010de:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8010e5:	00 00 00 
+  8010e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ed:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  8010f4:	00 00 00 
+  8010f7:	41 ff d1             	call   *%r9
+
+00000000008010fa <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8010fa:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010fd:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801102:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801108:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80110e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801114:	0f 05                	syscall
+    if (check && ret > 0) {
+  801116:	48 85 c0             	test   %rax,%rax
+  801119:	7f 01                	jg     80111c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80111b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80111c:	55                   	push   %rbp
+  80111d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801120:	49 89 c0             	mov    %rax,%r8
+  801123:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801128:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  80112f:	00 00 00 
+  801132:	be 29 00 00 00       	mov    $0x29,%esi
+  801137:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  80113e:	00 00 00 
+  801141:	b8 00 00 00 00       	mov    $0x0,%eax
+  801146:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  80114d:	00 00 00 
+  801150:	41 ff d1             	call   *%r9
+
+0000000000801153 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801153:	48 63 f6             	movslq %esi,%rsi
+  801156:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801159:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80115e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801163:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801169:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80116f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801175:	0f 05                	syscall
+    if (check && ret > 0) {
+  801177:	48 85 c0             	test   %rax,%rax
+  80117a:	7f 01                	jg     80117d <sys_env_set_status+0x2a>
+}
+  80117c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80117d:	55                   	push   %rbp
+  80117e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801181:	49 89 c0             	mov    %rax,%r8
+  801184:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801189:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801190:	00 00 00 
+  801193:	be 29 00 00 00       	mov    $0x29,%esi
+  801198:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  80119f:	00 00 00 
+  8011a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a7:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  8011ae:	00 00 00 
+  8011b1:	41 ff d1             	call   *%r9
+
+00000000008011b4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011b7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011cd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011d3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011d5:	48 85 c0             	test   %rax,%rax
+  8011d8:	7f 01                	jg     8011db <sys_env_set_trapframe+0x27>
+}
+  8011da:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011db:	55                   	push   %rbp
+  8011dc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011df:	49 89 c0             	mov    %rax,%r8
+  8011e2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8011e7:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8011ee:	00 00 00 
+  8011f1:	be 29 00 00 00       	mov    $0x29,%esi
+  8011f6:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8011fd:	00 00 00 
+  801200:	b8 00 00 00 00       	mov    $0x0,%eax
+  801205:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  80120c:	00 00 00 
+  80120f:	41 ff d1             	call   *%r9
+
+0000000000801212 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801212:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801215:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80121a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801225:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80122b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801231:	0f 05                	syscall
+    if (check && ret > 0) {
+  801233:	48 85 c0             	test   %rax,%rax
+  801236:	7f 01                	jg     801239 <sys_env_set_pgfault_upcall+0x27>
+}
+  801238:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801239:	55                   	push   %rbp
+  80123a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80123d:	49 89 c0             	mov    %rax,%r8
+  801240:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801245:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  80124c:	00 00 00 
+  80124f:	be 29 00 00 00       	mov    $0x29,%esi
+  801254:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  80125b:	00 00 00 
+  80125e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801263:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  80126a:	00 00 00 
+  80126d:	41 ff d1             	call   *%r9
+
+0000000000801270 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801270:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801273:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801276:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80127b:	4d 63 c0             	movslq %r8d,%r8
+  80127e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801284:	0f 05                	syscall
+}
+  801286:	c3                   	ret
+
+0000000000801287 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801287:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80128a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80128d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801292:	4d 63 c0             	movslq %r8d,%r8
+  801295:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80129b:	0f 05                	syscall
+}
+  80129d:	c3                   	ret
+
+000000000080129e <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80129e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a3:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a6:	45 89 c0             	mov    %r8d,%r8d
+  8012a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012af:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012b1:	48 85 c0             	test   %rax,%rax
+  8012b4:	7f 01                	jg     8012b7 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012b6:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012b7:	55                   	push   %rbp
+  8012b8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012bb:	49 89 c0             	mov    %rax,%r8
+  8012be:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012c3:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8012ca:	00 00 00 
+  8012cd:	be 29 00 00 00       	mov    $0x29,%esi
+  8012d2:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8012d9:	00 00 00 
+  8012dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e1:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  8012e8:	00 00 00 
+  8012eb:	41 ff d1             	call   *%r9
+
+00000000008012ee <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8012ee:	55                   	push   %rbp
+  8012ef:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8012f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801302:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  801309:	00 00 00 
+  80130c:	ff d0                	call   *%rax
+}
+  80130e:	5d                   	pop    %rbp
+  80130f:	c3                   	ret
+
+0000000000801310 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801310:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80131f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801324:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801330:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801336:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801338:	c3                   	ret
+
+0000000000801339 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801339:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80133e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801343:	ba 00 00 00 00       	mov    $0x0,%edx
+  801348:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801354:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80135a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80135c:	48 85 c0             	test   %rax,%rax
+  80135f:	7f 01                	jg     801362 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801361:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801362:	55                   	push   %rbp
+  801363:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801366:	49 89 c0             	mov    %rax,%r8
+  801369:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80136e:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801375:	00 00 00 
+  801378:	be 29 00 00 00       	mov    $0x29,%esi
+  80137d:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801384:	00 00 00 
+  801387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138c:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  801393:	00 00 00 
+  801396:	41 ff d1             	call   *%r9
+
+0000000000801399 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801399:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80139e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bf:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c1:	c3                   	ret
+
+00000000008013c2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013c2:	89 d2                	mov    %edx,%edx
+  8013c4:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013dd:	0f 05                	syscall
+}
+  8013df:	c3                   	ret
+
+00000000008013e0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8013e0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ff:	0f 05                	syscall
+}
+  801401:	c3                   	ret
+
+0000000000801402 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801402:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80141b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801421:	0f 05                	syscall
+}
+  801423:	c3                   	ret
+
+0000000000801424 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801424:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801427:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801431:	ba 00 00 00 00       	mov    $0x0,%edx
+  801436:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801442:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801448:	0f 05                	syscall
+    if (check && ret > 0) {
+  80144a:	48 85 c0             	test   %rax,%rax
+  80144d:	7f 01                	jg     801450 <sys_irq_ack+0x2c>
+}
+  80144f:	c3                   	ret
+sys_irq_ack(int irq) {
+  801450:	55                   	push   %rbp
+  801451:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801454:	49 89 c0             	mov    %rax,%r8
+  801457:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80145c:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801463:	00 00 00 
+  801466:	be 29 00 00 00       	mov    $0x29,%esi
+  80146b:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801472:	00 00 00 
+  801475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147a:	49 b9 72 41 80 00 00 	movabs $0x804172,%r9
+  801481:	00 00 00 
+  801484:	41 ff d1             	call   *%r9
+
+0000000000801487 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801487:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80148e:	ff ff ff 
+  801491:	48 01 f8             	add    %rdi,%rax
+  801494:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801498:	c3                   	ret
+
+0000000000801499 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801499:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014a0:	ff ff ff 
+  8014a3:	48 01 f8             	add    %rdi,%rax
+  8014a6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014aa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014b0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014b4:	c3                   	ret
+
+00000000008014b5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014b5:	55                   	push   %rbp
+  8014b6:	48 89 e5             	mov    %rsp,%rbp
+  8014b9:	41 57                	push   %r15
+  8014bb:	41 56                	push   %r14
+  8014bd:	41 55                	push   %r13
+  8014bf:	41 54                	push   %r12
+  8014c1:	53                   	push   %rbx
+  8014c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8014c6:	49 89 ff             	mov    %rdi,%r15
+  8014c9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014ce:	49 bd 44 3c 80 00 00 	movabs $0x803c44,%r13
+  8014d5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014d8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8014de:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8014e1:	48 89 df             	mov    %rbx,%rdi
+  8014e4:	41 ff d5             	call   *%r13
+  8014e7:	83 e0 04             	and    $0x4,%eax
+  8014ea:	74 17                	je     801503 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8014ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8014f3:	4c 39 f3             	cmp    %r14,%rbx
+  8014f6:	75 e6                	jne    8014de <fd_alloc+0x29>
+  8014f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8014fe:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801503:	4d 89 27             	mov    %r12,(%r15)
+}
+  801506:	48 83 c4 08          	add    $0x8,%rsp
+  80150a:	5b                   	pop    %rbx
+  80150b:	41 5c                	pop    %r12
+  80150d:	41 5d                	pop    %r13
+  80150f:	41 5e                	pop    %r14
+  801511:	41 5f                	pop    %r15
+  801513:	5d                   	pop    %rbp
+  801514:	c3                   	ret
+
+0000000000801515 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801515:	83 ff 1f             	cmp    $0x1f,%edi
+  801518:	77 39                	ja     801553 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80151a:	55                   	push   %rbp
+  80151b:	48 89 e5             	mov    %rsp,%rbp
+  80151e:	41 54                	push   %r12
+  801520:	53                   	push   %rbx
+  801521:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801524:	48 63 df             	movslq %edi,%rbx
+  801527:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80152e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801532:	48 89 df             	mov    %rbx,%rdi
+  801535:	48 b8 44 3c 80 00 00 	movabs $0x803c44,%rax
+  80153c:	00 00 00 
+  80153f:	ff d0                	call   *%rax
+  801541:	a8 04                	test   $0x4,%al
+  801543:	74 14                	je     801559 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801545:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801549:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80154e:	5b                   	pop    %rbx
+  80154f:	41 5c                	pop    %r12
+  801551:	5d                   	pop    %rbp
+  801552:	c3                   	ret
+        return -E_INVAL;
+  801553:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801558:	c3                   	ret
+        return -E_INVAL;
+  801559:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80155e:	eb ee                	jmp    80154e <fd_lookup+0x39>
+
+0000000000801560 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801560:	55                   	push   %rbp
+  801561:	48 89 e5             	mov    %rsp,%rbp
+  801564:	41 54                	push   %r12
+  801566:	53                   	push   %rbx
+  801567:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80156a:	48 b8 00 4d 80 00 00 	movabs $0x804d00,%rax
+  801571:	00 00 00 
+  801574:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80157b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80157e:	39 3b                	cmp    %edi,(%rbx)
+  801580:	74 47                	je     8015c9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801582:	48 83 c0 08          	add    $0x8,%rax
+  801586:	48 8b 18             	mov    (%rax),%rbx
+  801589:	48 85 db             	test   %rbx,%rbx
+  80158c:	75 f0                	jne    80157e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80158e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801595:	00 00 00 
+  801598:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80159e:	89 fa                	mov    %edi,%edx
+  8015a0:	48 bf 68 4c 80 00 00 	movabs $0x804c68,%rdi
+  8015a7:	00 00 00 
+  8015aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015af:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  8015b6:	00 00 00 
+  8015b9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015c0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015c4:	5b                   	pop    %rbx
+  8015c5:	41 5c                	pop    %r12
+  8015c7:	5d                   	pop    %rbp
+  8015c8:	c3                   	ret
+            return 0;
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ce:	eb f0                	jmp    8015c0 <dev_lookup+0x60>
+
+00000000008015d0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015d0:	55                   	push   %rbp
+  8015d1:	48 89 e5             	mov    %rsp,%rbp
+  8015d4:	41 55                	push   %r13
+  8015d6:	41 54                	push   %r12
+  8015d8:	53                   	push   %rbx
+  8015d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8015dd:	48 89 fb             	mov    %rdi,%rbx
+  8015e0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015e3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8015ea:	ff ff ff 
+  8015ed:	48 01 df             	add    %rbx,%rdi
+  8015f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8015f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015f8:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8015ff:	00 00 00 
+  801602:	ff d0                	call   *%rax
+  801604:	41 89 c5             	mov    %eax,%r13d
+  801607:	85 c0                	test   %eax,%eax
+  801609:	78 06                	js     801611 <fd_close+0x41>
+  80160b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80160f:	74 1a                	je     80162b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801611:	45 84 e4             	test   %r12b,%r12b
+  801614:	b8 00 00 00 00       	mov    $0x0,%eax
+  801619:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80161d:	44 89 e8             	mov    %r13d,%eax
+  801620:	48 83 c4 18          	add    $0x18,%rsp
+  801624:	5b                   	pop    %rbx
+  801625:	41 5c                	pop    %r12
+  801627:	41 5d                	pop    %r13
+  801629:	5d                   	pop    %rbp
+  80162a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80162b:	8b 3b                	mov    (%rbx),%edi
+  80162d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801631:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801638:	00 00 00 
+  80163b:	ff d0                	call   *%rax
+  80163d:	41 89 c5             	mov    %eax,%r13d
+  801640:	85 c0                	test   %eax,%eax
+  801642:	78 1b                	js     80165f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801644:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801648:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80164c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801652:	48 85 c0             	test   %rax,%rax
+  801655:	74 08                	je     80165f <fd_close+0x8f>
+  801657:	48 89 df             	mov    %rbx,%rdi
+  80165a:	ff d0                	call   *%rax
+  80165c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80165f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801664:	48 89 de             	mov    %rbx,%rsi
+  801667:	bf 00 00 00 00       	mov    $0x0,%edi
+  80166c:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  801673:	00 00 00 
+  801676:	ff d0                	call   *%rax
+    return res;
+  801678:	eb a3                	jmp    80161d <fd_close+0x4d>
+
+000000000080167a <close>:
+
+int
+close(int fdnum) {
+  80167a:	55                   	push   %rbp
+  80167b:	48 89 e5             	mov    %rsp,%rbp
+  80167e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801682:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801686:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  80168d:	00 00 00 
+  801690:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801692:	85 c0                	test   %eax,%eax
+  801694:	78 15                	js     8016ab <close+0x31>
+
+    return fd_close(fd, 1);
+  801696:	be 01 00 00 00       	mov    $0x1,%esi
+  80169b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80169f:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  8016a6:	00 00 00 
+  8016a9:	ff d0                	call   *%rax
+}
+  8016ab:	c9                   	leave
+  8016ac:	c3                   	ret
+
+00000000008016ad <close_all>:
+
+void
+close_all(void) {
+  8016ad:	55                   	push   %rbp
+  8016ae:	48 89 e5             	mov    %rsp,%rbp
+  8016b1:	41 54                	push   %r12
+  8016b3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016b9:	49 bc 7a 16 80 00 00 	movabs $0x80167a,%r12
+  8016c0:	00 00 00 
+  8016c3:	89 df                	mov    %ebx,%edi
+  8016c5:	41 ff d4             	call   *%r12
+  8016c8:	83 c3 01             	add    $0x1,%ebx
+  8016cb:	83 fb 20             	cmp    $0x20,%ebx
+  8016ce:	75 f3                	jne    8016c3 <close_all+0x16>
+}
+  8016d0:	5b                   	pop    %rbx
+  8016d1:	41 5c                	pop    %r12
+  8016d3:	5d                   	pop    %rbp
+  8016d4:	c3                   	ret
+
+00000000008016d5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016d5:	55                   	push   %rbp
+  8016d6:	48 89 e5             	mov    %rsp,%rbp
+  8016d9:	41 57                	push   %r15
+  8016db:	41 56                	push   %r14
+  8016dd:	41 55                	push   %r13
+  8016df:	41 54                	push   %r12
+  8016e1:	53                   	push   %rbx
+  8016e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8016e6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8016e9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8016ed:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8016f4:	00 00 00 
+  8016f7:	ff d0                	call   *%rax
+  8016f9:	89 c3                	mov    %eax,%ebx
+  8016fb:	85 c0                	test   %eax,%eax
+  8016fd:	0f 88 b8 00 00 00    	js     8017bb <dup+0xe6>
+    close(newfdnum);
+  801703:	44 89 e7             	mov    %r12d,%edi
+  801706:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  80170d:	00 00 00 
+  801710:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801712:	4d 63 ec             	movslq %r12d,%r13
+  801715:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80171c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801720:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801724:	4c 89 ff             	mov    %r15,%rdi
+  801727:	49 be 99 14 80 00 00 	movabs $0x801499,%r14
+  80172e:	00 00 00 
+  801731:	41 ff d6             	call   *%r14
+  801734:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801737:	4c 89 ef             	mov    %r13,%rdi
+  80173a:	41 ff d6             	call   *%r14
+  80173d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801740:	48 89 df             	mov    %rbx,%rdi
+  801743:	48 b8 44 3c 80 00 00 	movabs $0x803c44,%rax
+  80174a:	00 00 00 
+  80174d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80174f:	a8 04                	test   $0x4,%al
+  801751:	74 2b                	je     80177e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801753:	41 89 c1             	mov    %eax,%r9d
+  801756:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80175c:	4c 89 f1             	mov    %r14,%rcx
+  80175f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801764:	48 89 de             	mov    %rbx,%rsi
+  801767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80176c:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  801773:	00 00 00 
+  801776:	ff d0                	call   *%rax
+  801778:	89 c3                	mov    %eax,%ebx
+  80177a:	85 c0                	test   %eax,%eax
+  80177c:	78 4e                	js     8017cc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80177e:	4c 89 ff             	mov    %r15,%rdi
+  801781:	48 b8 44 3c 80 00 00 	movabs $0x803c44,%rax
+  801788:	00 00 00 
+  80178b:	ff d0                	call   *%rax
+  80178d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801790:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801796:	4c 89 e9             	mov    %r13,%rcx
+  801799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179e:	4c 89 fe             	mov    %r15,%rsi
+  8017a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017a6:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+  8017b2:	89 c3                	mov    %eax,%ebx
+  8017b4:	85 c0                	test   %eax,%eax
+  8017b6:	78 14                	js     8017cc <dup+0xf7>
+
+    return newfdnum;
+  8017b8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017bb:	89 d8                	mov    %ebx,%eax
+  8017bd:	48 83 c4 18          	add    $0x18,%rsp
+  8017c1:	5b                   	pop    %rbx
+  8017c2:	41 5c                	pop    %r12
+  8017c4:	41 5d                	pop    %r13
+  8017c6:	41 5e                	pop    %r14
+  8017c8:	41 5f                	pop    %r15
+  8017ca:	5d                   	pop    %rbp
+  8017cb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017d1:	4c 89 ee             	mov    %r13,%rsi
+  8017d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017d9:	49 bc fa 10 80 00 00 	movabs $0x8010fa,%r12
+  8017e0:	00 00 00 
+  8017e3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8017e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017eb:	4c 89 f6             	mov    %r14,%rsi
+  8017ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f3:	41 ff d4             	call   *%r12
+    return res;
+  8017f6:	eb c3                	jmp    8017bb <dup+0xe6>
+
+00000000008017f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8017f8:	55                   	push   %rbp
+  8017f9:	48 89 e5             	mov    %rsp,%rbp
+  8017fc:	41 56                	push   %r14
+  8017fe:	41 55                	push   %r13
+  801800:	41 54                	push   %r12
+  801802:	53                   	push   %rbx
+  801803:	48 83 ec 10          	sub    $0x10,%rsp
+  801807:	89 fb                	mov    %edi,%ebx
+  801809:	49 89 f4             	mov    %rsi,%r12
+  80180c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80180f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801813:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 4c                	js     80186f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801823:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801827:	41 8b 3e             	mov    (%r14),%edi
+  80182a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80182e:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801835:	00 00 00 
+  801838:	ff d0                	call   *%rax
+  80183a:	85 c0                	test   %eax,%eax
+  80183c:	78 35                	js     801873 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80183e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801842:	83 e0 03             	and    $0x3,%eax
+  801845:	83 f8 01             	cmp    $0x1,%eax
+  801848:	74 2d                	je     801877 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80184a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80184e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801852:	48 85 c0             	test   %rax,%rax
+  801855:	74 56                	je     8018ad <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801857:	4c 89 ea             	mov    %r13,%rdx
+  80185a:	4c 89 e6             	mov    %r12,%rsi
+  80185d:	4c 89 f7             	mov    %r14,%rdi
+  801860:	ff d0                	call   *%rax
+}
+  801862:	48 83 c4 10          	add    $0x10,%rsp
+  801866:	5b                   	pop    %rbx
+  801867:	41 5c                	pop    %r12
+  801869:	41 5d                	pop    %r13
+  80186b:	41 5e                	pop    %r14
+  80186d:	5d                   	pop    %rbp
+  80186e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80186f:	48 98                	cltq
+  801871:	eb ef                	jmp    801862 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801873:	48 98                	cltq
+  801875:	eb eb                	jmp    801862 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801877:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80187e:	00 00 00 
+  801881:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801887:	89 da                	mov    %ebx,%edx
+  801889:	48 bf a9 4c 80 00 00 	movabs $0x804ca9,%rdi
+  801890:	00 00 00 
+  801893:	b8 00 00 00 00       	mov    $0x0,%eax
+  801898:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  80189f:	00 00 00 
+  8018a2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018ab:	eb b5                	jmp    801862 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018ad:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018b4:	eb ac                	jmp    801862 <read+0x6a>
+
+00000000008018b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018b6:	55                   	push   %rbp
+  8018b7:	48 89 e5             	mov    %rsp,%rbp
+  8018ba:	41 57                	push   %r15
+  8018bc:	41 56                	push   %r14
+  8018be:	41 55                	push   %r13
+  8018c0:	41 54                	push   %r12
+  8018c2:	53                   	push   %rbx
+  8018c3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018c7:	48 85 d2             	test   %rdx,%rdx
+  8018ca:	74 54                	je     801920 <readn+0x6a>
+  8018cc:	41 89 fd             	mov    %edi,%r13d
+  8018cf:	49 89 f6             	mov    %rsi,%r14
+  8018d2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018da:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8018df:	49 bf f8 17 80 00 00 	movabs $0x8017f8,%r15
+  8018e6:	00 00 00 
+  8018e9:	4c 89 e2             	mov    %r12,%rdx
+  8018ec:	48 29 f2             	sub    %rsi,%rdx
+  8018ef:	4c 01 f6             	add    %r14,%rsi
+  8018f2:	44 89 ef             	mov    %r13d,%edi
+  8018f5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8018f8:	85 c0                	test   %eax,%eax
+  8018fa:	78 20                	js     80191c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8018fc:	01 c3                	add    %eax,%ebx
+  8018fe:	85 c0                	test   %eax,%eax
+  801900:	74 08                	je     80190a <readn+0x54>
+  801902:	48 63 f3             	movslq %ebx,%rsi
+  801905:	4c 39 e6             	cmp    %r12,%rsi
+  801908:	72 df                	jb     8018e9 <readn+0x33>
+    }
+    return res;
+  80190a:	48 63 c3             	movslq %ebx,%rax
+}
+  80190d:	48 83 c4 08          	add    $0x8,%rsp
+  801911:	5b                   	pop    %rbx
+  801912:	41 5c                	pop    %r12
+  801914:	41 5d                	pop    %r13
+  801916:	41 5e                	pop    %r14
+  801918:	41 5f                	pop    %r15
+  80191a:	5d                   	pop    %rbp
+  80191b:	c3                   	ret
+        if (inc < 0) return inc;
+  80191c:	48 98                	cltq
+  80191e:	eb ed                	jmp    80190d <readn+0x57>
+    int inc = 1, res = 0;
+  801920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801925:	eb e3                	jmp    80190a <readn+0x54>
+
+0000000000801927 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801927:	55                   	push   %rbp
+  801928:	48 89 e5             	mov    %rsp,%rbp
+  80192b:	41 56                	push   %r14
+  80192d:	41 55                	push   %r13
+  80192f:	41 54                	push   %r12
+  801931:	53                   	push   %rbx
+  801932:	48 83 ec 10          	sub    $0x10,%rsp
+  801936:	89 fb                	mov    %edi,%ebx
+  801938:	49 89 f4             	mov    %rsi,%r12
+  80193b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80193e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801942:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801949:	00 00 00 
+  80194c:	ff d0                	call   *%rax
+  80194e:	85 c0                	test   %eax,%eax
+  801950:	78 47                	js     801999 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801952:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801956:	41 8b 3e             	mov    (%r14),%edi
+  801959:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80195d:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801964:	00 00 00 
+  801967:	ff d0                	call   *%rax
+  801969:	85 c0                	test   %eax,%eax
+  80196b:	78 30                	js     80199d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80196d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801972:	74 2d                	je     8019a1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801974:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801978:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80197c:	48 85 c0             	test   %rax,%rax
+  80197f:	74 56                	je     8019d7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801981:	4c 89 ea             	mov    %r13,%rdx
+  801984:	4c 89 e6             	mov    %r12,%rsi
+  801987:	4c 89 f7             	mov    %r14,%rdi
+  80198a:	ff d0                	call   *%rax
+}
+  80198c:	48 83 c4 10          	add    $0x10,%rsp
+  801990:	5b                   	pop    %rbx
+  801991:	41 5c                	pop    %r12
+  801993:	41 5d                	pop    %r13
+  801995:	41 5e                	pop    %r14
+  801997:	5d                   	pop    %rbp
+  801998:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801999:	48 98                	cltq
+  80199b:	eb ef                	jmp    80198c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80199d:	48 98                	cltq
+  80199f:	eb eb                	jmp    80198c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019a1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019a8:	00 00 00 
+  8019ab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019b1:	89 da                	mov    %ebx,%edx
+  8019b3:	48 bf c5 4c 80 00 00 	movabs $0x804cc5,%rdi
+  8019ba:	00 00 00 
+  8019bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c2:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  8019c9:	00 00 00 
+  8019cc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019d5:	eb b5                	jmp    80198c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019d7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019de:	eb ac                	jmp    80198c <write+0x65>
+
+00000000008019e0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8019e0:	55                   	push   %rbp
+  8019e1:	48 89 e5             	mov    %rsp,%rbp
+  8019e4:	41 54                	push   %r12
+  8019e6:	53                   	push   %rbx
+  8019e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8019eb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019ed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8019f1:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8019f8:	00 00 00 
+  8019fb:	ff d0                	call   *%rax
+  8019fd:	85 c0                	test   %eax,%eax
+  8019ff:	78 3e                	js     801a3f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a01:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a05:	41 8b 3c 24          	mov    (%r12),%edi
+  801a09:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a0d:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801a14:	00 00 00 
+  801a17:	ff d0                	call   *%rax
+  801a19:	85 c0                	test   %eax,%eax
+  801a1b:	78 22                	js     801a3f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a21:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a25:	48 85 c0             	test   %rax,%rax
+  801a28:	74 0b                	je     801a35 <seek+0x55>
+  801a2a:	89 de                	mov    %ebx,%esi
+  801a2c:	4c 89 e7             	mov    %r12,%rdi
+  801a2f:	ff d0                	call   *%rax
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 0a                	js     801a3f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a35:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a3f:	48 83 c4 10          	add    $0x10,%rsp
+  801a43:	5b                   	pop    %rbx
+  801a44:	41 5c                	pop    %r12
+  801a46:	5d                   	pop    %rbp
+  801a47:	c3                   	ret
+
+0000000000801a48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a48:	55                   	push   %rbp
+  801a49:	48 89 e5             	mov    %rsp,%rbp
+  801a4c:	41 55                	push   %r13
+  801a4e:	41 54                	push   %r12
+  801a50:	53                   	push   %rbx
+  801a51:	48 83 ec 18          	sub    $0x18,%rsp
+  801a55:	89 fb                	mov    %edi,%ebx
+  801a57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a5e:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801a65:	00 00 00 
+  801a68:	ff d0                	call   *%rax
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 38                	js     801aa6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a7a:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801a81:	00 00 00 
+  801a84:	ff d0                	call   *%rax
+  801a86:	85 c0                	test   %eax,%eax
+  801a88:	78 1c                	js     801aa6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801a8f:	74 20                	je     801ab1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801a91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a95:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801a99:	48 85 c0             	test   %rax,%rax
+  801a9c:	74 47                	je     801ae5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801a9e:	44 89 e6             	mov    %r12d,%esi
+  801aa1:	4c 89 ef             	mov    %r13,%rdi
+  801aa4:	ff d0                	call   *%rax
+}
+  801aa6:	48 83 c4 18          	add    $0x18,%rsp
+  801aaa:	5b                   	pop    %rbx
+  801aab:	41 5c                	pop    %r12
+  801aad:	41 5d                	pop    %r13
+  801aaf:	5d                   	pop    %rbp
+  801ab0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ab1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ab8:	00 00 00 
+  801abb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ac1:	89 da                	mov    %ebx,%edx
+  801ac3:	48 bf 88 4c 80 00 00 	movabs $0x804c88,%rdi
+  801aca:	00 00 00 
+  801acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad2:	48 b9 d0 01 80 00 00 	movabs $0x8001d0,%rcx
+  801ad9:	00 00 00 
+  801adc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ade:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae3:	eb c1                	jmp    801aa6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ae5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801aea:	eb ba                	jmp    801aa6 <ftruncate+0x5e>
+
+0000000000801aec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801aec:	55                   	push   %rbp
+  801aed:	48 89 e5             	mov    %rsp,%rbp
+  801af0:	41 54                	push   %r12
+  801af2:	53                   	push   %rbx
+  801af3:	48 83 ec 10          	sub    $0x10,%rsp
+  801af7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801afa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801afe:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  801b05:	00 00 00 
+  801b08:	ff d0                	call   *%rax
+  801b0a:	85 c0                	test   %eax,%eax
+  801b0c:	78 4e                	js     801b5c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b12:	41 8b 3c 24          	mov    (%r12),%edi
+  801b16:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b1a:	48 b8 60 15 80 00 00 	movabs $0x801560,%rax
+  801b21:	00 00 00 
+  801b24:	ff d0                	call   *%rax
+  801b26:	85 c0                	test   %eax,%eax
+  801b28:	78 32                	js     801b5c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b2e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b33:	74 30                	je     801b65 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b35:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b3f:	00 00 00 
+    stat->st_isdir = 0;
+  801b42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b49:	00 00 00 
+    stat->st_dev = dev;
+  801b4c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b53:	48 89 de             	mov    %rbx,%rsi
+  801b56:	4c 89 e7             	mov    %r12,%rdi
+  801b59:	ff 50 28             	call   *0x28(%rax)
+}
+  801b5c:	48 83 c4 10          	add    $0x10,%rsp
+  801b60:	5b                   	pop    %rbx
+  801b61:	41 5c                	pop    %r12
+  801b63:	5d                   	pop    %rbp
+  801b64:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b6a:	eb f0                	jmp    801b5c <fstat+0x70>
+
+0000000000801b6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b6c:	55                   	push   %rbp
+  801b6d:	48 89 e5             	mov    %rsp,%rbp
+  801b70:	41 54                	push   %r12
+  801b72:	53                   	push   %rbx
+  801b73:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b76:	be 00 00 00 00       	mov    $0x0,%esi
+  801b7b:	48 b8 da 2c 80 00 00 	movabs $0x802cda,%rax
+  801b82:	00 00 00 
+  801b85:	ff d0                	call   *%rax
+  801b87:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b89:	85 c0                	test   %eax,%eax
+  801b8b:	78 25                	js     801bb2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801b8d:	4c 89 e6             	mov    %r12,%rsi
+  801b90:	89 c7                	mov    %eax,%edi
+  801b92:	48 b8 ec 1a 80 00 00 	movabs $0x801aec,%rax
+  801b99:	00 00 00 
+  801b9c:	ff d0                	call   *%rax
+  801b9e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ba1:	89 df                	mov    %ebx,%edi
+  801ba3:	48 b8 7a 16 80 00 00 	movabs $0x80167a,%rax
+  801baa:	00 00 00 
+  801bad:	ff d0                	call   *%rax
+
+    return res;
+  801baf:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bb2:	89 d8                	mov    %ebx,%eax
+  801bb4:	5b                   	pop    %rbx
+  801bb5:	41 5c                	pop    %r12
+  801bb7:	5d                   	pop    %rbp
+  801bb8:	c3                   	ret
+
+0000000000801bb9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bb9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801bc0:	00 00 00 
+  801bc3:	83 38 00             	cmpl   $0x0,(%rax)
+  801bc6:	74 0a                	je     801bd2 <fsenv+0x19>
+    return envid;
+}
+  801bc8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bcf:	00 00 
+  801bd1:	c3                   	ret
+fsenv(void) {
+  801bd2:	55                   	push   %rbp
+  801bd3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bd6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bdb:	48 b8 4a 46 80 00 00 	movabs $0x80464a,%rax
+  801be2:	00 00 00 
+  801be5:	ff d0                	call   *%rax
+  801be7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801bee:	00 00 
+}
+  801bf0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bf7:	00 00 
+  801bf9:	5d                   	pop    %rbp
+  801bfa:	c3                   	ret
+
+0000000000801bfb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801bfb:	55                   	push   %rbp
+  801bfc:	48 89 e5             	mov    %rsp,%rbp
+  801bff:	41 54                	push   %r12
+  801c01:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c02:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c07:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c0c:	48 89 de             	mov    %rbx,%rsi
+  801c0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c14:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  801c1b:	00 00 00 
+  801c1e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c20:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c27:	00 00 00 
+  801c2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c35:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c3a:	48 89 de             	mov    %rbx,%rsi
+  801c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c42:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  801c49:	00 00 00 
+  801c4c:	ff d0                	call   *%rax
+  801c4e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c50:	85 c0                	test   %eax,%eax
+  801c52:	0f 88 a2 00 00 00    	js     801cfa <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c58:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c5f:	00 00 00 
+  801c62:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c68:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c6d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c6f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c74:	49 bc 0c 3e 80 00 00 	movabs $0x803e0c,%r12
+  801c7b:	00 00 00 
+  801c7e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801c81:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801c86:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c89:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  801c90:	00 00 00 
+  801c93:	ff d0                	call   *%rax
+  801c95:	89 c7                	mov    %eax,%edi
+  801c97:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801c9d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ca2:	48 89 da             	mov    %rbx,%rdx
+  801ca5:	be 09 00 00 00       	mov    $0x9,%esi
+  801caa:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  801cb1:	00 00 00 
+  801cb4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc0:	be 00 00 00 00       	mov    $0x0,%esi
+  801cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cca:	48 b8 d0 45 80 00 00 	movabs $0x8045d0,%rax
+  801cd1:	00 00 00 
+  801cd4:	ff d0                	call   *%rax
+  801cd6:	89 c3                	mov    %eax,%ebx
+  801cd8:	85 c0                	test   %eax,%eax
+  801cda:	78 25                	js     801d01 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801cdc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ce3:	00 00 00 
+  801ce6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801cec:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801cf3:	00 00 
+    return 0;
+  801cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801cfa:	89 d8                	mov    %ebx,%eax
+  801cfc:	5b                   	pop    %rbx
+  801cfd:	41 5c                	pop    %r12
+  801cff:	5d                   	pop    %rbp
+  801d00:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d01:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d06:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d10:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+        return res;
+  801d1c:	eb dc                	jmp    801cfa <fschan_setup+0xff>
+
+0000000000801d1e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d1e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d25:	00 00 00 
+  801d28:	80 38 00             	cmpb   $0x0,(%rax)
+  801d2b:	74 55                	je     801d82 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d2d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d34:	00 00 00 
+  801d37:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d3d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d42:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d49:	00 00 00 
+  801d4c:	3b 0a                	cmp    (%rdx),%ecx
+  801d4e:	75 01                	jne    801d51 <fschan+0x33>
+}
+  801d50:	c3                   	ret
+fschan(void) {
+  801d51:	55                   	push   %rbp
+  801d52:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d55:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  801d5c:	00 00 00 
+  801d5f:	ff d0                	call   *%rax
+  801d61:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d63:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d68:	85 d2                	test   %edx,%edx
+  801d6a:	78 02                	js     801d6e <fschan+0x50>
+}
+  801d6c:	5d                   	pop    %rbp
+  801d6d:	c3                   	ret
+        fschan_enabled = 0;
+  801d6e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d75:	00 00 00 
+  801d78:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d80:	eb ea                	jmp    801d6c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d87:	c3                   	ret
+
+0000000000801d88 <fbuf>:
+fbuf(struct Fd *fd) {
+  801d88:	55                   	push   %rbp
+  801d89:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801d8c:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  801d93:	00 00 00 
+  801d96:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801da1:	77 12                	ja     801db5 <fbuf+0x2d>
+  801da3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801da7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801dae:	00 00 00 
+  801db1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801db5:	48 89 d0             	mov    %rdx,%rax
+  801db8:	5d                   	pop    %rbp
+  801db9:	c3                   	ret
+
+0000000000801dba <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801dba:	55                   	push   %rbp
+  801dbb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801dbe:	48 83 c7 40          	add    $0x40,%rdi
+  801dc2:	48 b8 46 3e 80 00 00 	movabs $0x803e46,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+  801dce:	84 c0                	test   %al,%al
+  801dd0:	75 02                	jne    801dd4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801dd2:	5d                   	pop    %rbp
+  801dd3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801dd4:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+  801de0:	89 c7                	mov    %eax,%edi
+  801de2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801de8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df2:	be 0a 00 00 00       	mov    $0xa,%esi
+  801df7:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  801dfe:	00 00 00 
+  801e01:	ff d0                	call   *%rax
+}
+  801e03:	eb cd                	jmp    801dd2 <fschan_publish+0x18>
+
+0000000000801e05 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e05:	55                   	push   %rbp
+  801e06:	48 89 e5             	mov    %rsp,%rbp
+  801e09:	41 57                	push   %r15
+  801e0b:	41 56                	push   %r14
+  801e0d:	41 55                	push   %r13
+  801e0f:	41 54                	push   %r12
+  801e11:	53                   	push   %rbx
+  801e12:	48 83 ec 48          	sub    $0x48,%rsp
+  801e16:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e1a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e1e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e21:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e25:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e28:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e2f:	00 00 00 
+  801e32:	8b 02                	mov    (%rdx),%eax
+  801e34:	83 c0 01             	add    $0x1,%eax
+  801e37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e3c:	0f 44 c1             	cmove  %ecx,%eax
+  801e3f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e41:	4d 85 c0             	test   %r8,%r8
+  801e44:	74 2c                	je     801e72 <fschan_rw+0x6d>
+  801e46:	45 89 ce             	mov    %r9d,%r14d
+  801e49:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e50:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e54:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e5a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e61:	00 
+  801e62:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e68:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e6d:	e9 41 01 00 00       	jmp    801fb3 <fschan_rw+0x1ae>
+  801e72:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e7a:	e9 9c 01 00 00       	jmp    80201b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801e7f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801e83:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801e86:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801e89:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801e8c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801e90:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e94:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801e98:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801e9c:	48 89 da             	mov    %rbx,%rdx
+  801e9f:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801eab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801eaf:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+            queued += blk;
+  801ebb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ebe:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ec2:	4d 39 fc             	cmp    %r15,%r12
+  801ec5:	73 6b                	jae    801f32 <fschan_rw+0x12d>
+  801ec7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801ecb:	77 65                	ja     801f32 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ed1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801ed5:	48 b8 21 3e 80 00 00 	movabs $0x803e21,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801ee1:	4c 89 fb             	mov    %r15,%rbx
+  801ee4:	4c 29 e3             	sub    %r12,%rbx
+  801ee7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801eec:	48 39 d3             	cmp    %rdx,%rbx
+  801eef:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801ef3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801ef7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801efb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801eff:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f02:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f04:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f0b:	00 00 00 
+  801f0e:	8b 09                	mov    (%rcx),%ecx
+  801f10:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f13:	83 fe 03             	cmp    $0x3,%esi
+  801f16:	0f 85 63 ff ff ff    	jne    801e7f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f1c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f20:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f23:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f26:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f29:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f2d:	e9 79 ff ff ff       	jmp    801eab <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f36:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f3d:	48 89 df             	mov    %rbx,%rdi
+  801f40:	48 b8 e4 3e 80 00 00 	movabs $0x803ee4,%rax
+  801f47:	00 00 00 
+  801f4a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f4c:	48 89 df             	mov    %rbx,%rdi
+  801f4f:	48 b8 72 3e 80 00 00 	movabs $0x803e72,%rax
+  801f56:	00 00 00 
+  801f59:	ff d0                	call   *%rax
+  801f5b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f5f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f63:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f67:	75 25                	jne    801f8e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f69:	8b 40 04             	mov    0x4(%rax),%eax
+  801f6c:	85 c0                	test   %eax,%eax
+  801f6e:	0f 88 86 00 00 00    	js     801ffa <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f74:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f78:	74 5b                	je     801fd5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f7a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f7e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801f82:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801f86:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801f8a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801f8e:	48 89 df             	mov    %rbx,%rdi
+  801f91:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  801f98:	00 00 00 
+  801f9b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801f9d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801fa1:	83 f0 01             	xor    $0x1,%eax
+  801fa4:	4d 39 fc             	cmp    %r15,%r12
+  801fa7:	0f 92 c2             	setb   %dl
+  801faa:	84 c2                	test   %al,%dl
+  801fac:	75 05                	jne    801fb3 <fschan_rw+0x1ae>
+  801fae:	45 85 ed             	test   %r13d,%r13d
+  801fb1:	74 50                	je     802003 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fb3:	4d 39 fc             	cmp    %r15,%r12
+  801fb6:	0f 92 c1             	setb   %cl
+  801fb9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fbd:	0f 96 c2             	setbe  %dl
+  801fc0:	84 d1                	test   %dl,%cl
+  801fc2:	0f 84 6a ff ff ff    	je     801f32 <fschan_rw+0x12d>
+  801fc8:	84 c0                	test   %al,%al
+  801fca:	0f 85 fd fe ff ff    	jne    801ecd <fschan_rw+0xc8>
+  801fd0:	e9 5d ff ff ff       	jmp    801f32 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801fd5:	48 63 d0             	movslq %eax,%rdx
+  801fd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fdc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801fe0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801fe4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801fe8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801fec:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+  801ff8:	eb 80                	jmp    801f7a <fschan_rw+0x175>
+                err = msg->fm_res;
+  801ffa:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801ffd:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802001:	eb 8b                	jmp    801f8e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802003:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802008:	0f 85 68 fe ff ff    	jne    801e76 <fschan_rw+0x71>
+  80200e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	0f 84 5d fe ff ff    	je     801e76 <fschan_rw+0x71>
+  802019:	48 98                	cltq
+}
+  80201b:	48 83 c4 48          	add    $0x48,%rsp
+  80201f:	5b                   	pop    %rbx
+  802020:	41 5c                	pop    %r12
+  802022:	41 5d                	pop    %r13
+  802024:	41 5e                	pop    %r14
+  802026:	41 5f                	pop    %r15
+  802028:	5d                   	pop    %rbp
+  802029:	c3                   	ret
+
+000000000080202a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80202a:	55                   	push   %rbp
+  80202b:	48 89 e5             	mov    %rsp,%rbp
+  80202e:	41 56                	push   %r14
+  802030:	41 55                	push   %r13
+  802032:	41 54                	push   %r12
+  802034:	53                   	push   %rbx
+  802035:	48 83 ec 10          	sub    $0x10,%rsp
+  802039:	49 89 fe             	mov    %rdi,%r14
+  80203c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80203f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802043:	48 29 f3             	sub    %rsi,%rbx
+  802046:	48 39 d3             	cmp    %rdx,%rbx
+  802049:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80204d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802054:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802055:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80205a:	49 bd a3 3c 80 00 00 	movabs $0x803ca3,%r13
+  802061:	00 00 00 
+  802064:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80206b:	76 1e                	jbe    80208b <mmap_fault+0x61>
+  80206d:	4c 01 e7             	add    %r12,%rdi
+  802070:	41 ff d5             	call   *%r13
+  802073:	84 c0                	test   %al,%al
+  802075:	75 14                	jne    80208b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80207b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802082:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802086:	48 39 df             	cmp    %rbx,%rdi
+  802089:	72 e2                	jb     80206d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80208b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802092:	00 00 00 
+  802095:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80209c:	00 00 00 
+  80209f:	4c 89 f0             	mov    %r14,%rax
+  8020a2:	48 29 d0             	sub    %rdx,%rax
+  8020a5:	48 c1 f8 03          	sar    $0x3,%rax
+  8020a9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020b0:	aa aa aa 
+  8020b3:	48 0f af c2          	imul   %rdx,%rax
+  8020b7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020bb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020c0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020c4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020c6:	44 89 e0             	mov    %r12d,%eax
+  8020c9:	41 03 46 10          	add    0x10(%r14),%eax
+  8020cd:	41 2b 06             	sub    (%r14),%eax
+  8020d0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020d7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020db:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8020df:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8020e2:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  8020e9:	00 00 00 
+  8020ec:	ff d0                	call   *%rax
+  8020ee:	89 c7                	mov    %eax,%edi
+  8020f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8020fb:	48 89 da             	mov    %rbx,%rdx
+  8020fe:	be 0f 00 00 00       	mov    $0xf,%esi
+  802103:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  80210a:	00 00 00 
+  80210d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80210f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802114:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802118:	4c 89 e6             	mov    %r12,%rsi
+  80211b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802120:	48 b8 d0 45 80 00 00 	movabs $0x8045d0,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+  80212c:	48 98                	cltq
+}
+  80212e:	48 83 c4 10          	add    $0x10,%rsp
+  802132:	5b                   	pop    %rbx
+  802133:	41 5c                	pop    %r12
+  802135:	41 5d                	pop    %r13
+  802137:	41 5e                	pop    %r14
+  802139:	5d                   	pop    %rbp
+  80213a:	c3                   	ret
+
+000000000080213b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80213b:	48 8b 37             	mov    (%rdi),%rsi
+  80213e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802145:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80214c:	00 00 00 
+  80214f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802154:	eb 0f                	jmp    802165 <mmap_pgfault+0x2a>
+  802156:	c3                   	ret
+  802157:	48 83 c1 01          	add    $0x1,%rcx
+  80215b:	48 83 c2 18          	add    $0x18,%rdx
+  80215f:	48 83 f9 20          	cmp    $0x20,%rcx
+  802163:	74 6e                	je     8021d3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802165:	48 8b 02             	mov    (%rdx),%rax
+  802168:	48 83 e8 01          	sub    $0x1,%rax
+  80216c:	48 39 f0             	cmp    %rsi,%rax
+  80216f:	73 e6                	jae    802157 <mmap_pgfault+0x1c>
+  802171:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802175:	73 e0                	jae    802157 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802177:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80217b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802180:	f6 c2 01             	test   $0x1,%dl
+  802183:	75 d1                	jne    802156 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802185:	f6 c2 02             	test   $0x2,%dl
+  802188:	74 1a                	je     8021a4 <mmap_pgfault+0x69>
+  80218a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80218e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802193:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80219a:	00 00 00 
+  80219d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021a2:	74 35                	je     8021d9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021a4:	55                   	push   %rbp
+  8021a5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021a8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021ac:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021b3:	00 00 00 
+  8021b6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021ba:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021bf:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  8021c6:	00 00 00 
+  8021c9:	ff d0                	call   *%rax
+  8021cb:	48 85 c0             	test   %rax,%rax
+  8021ce:	0f 9f c0             	setg   %al
+}
+  8021d1:	5d                   	pop    %rbp
+  8021d2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021d8:	c3                   	ret
+}
+  8021d9:	c3                   	ret
+
+00000000008021da <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021da:	55                   	push   %rbp
+  8021db:	48 89 e5             	mov    %rsp,%rbp
+  8021de:	41 54                	push   %r12
+  8021e0:	53                   	push   %rbx
+  8021e1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021e4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021eb:	00 00 00 
+  8021ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8021f3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8021f7:	74 15                	je     80220e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021f9:	48 83 c3 01          	add    $0x1,%rbx
+  8021fd:	48 83 c0 18          	add    $0x18,%rax
+  802201:	48 83 fb 20          	cmp    $0x20,%rbx
+  802205:	75 ec                	jne    8021f3 <mmap_alloc+0x19>
+    return NULL;
+  802207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80220c:	eb 52                	jmp    802260 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80220e:	4c 89 e7             	mov    %r12,%rdi
+  802211:	48 b8 44 3c 80 00 00 	movabs $0x803c44,%rax
+  802218:	00 00 00 
+  80221b:	ff d0                	call   *%rax
+  80221d:	41 89 c1             	mov    %eax,%r9d
+  802220:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802227:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80222b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802231:	ba 00 00 00 00       	mov    $0x0,%edx
+  802236:	4c 89 e6             	mov    %r12,%rsi
+  802239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223e:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  802245:	00 00 00 
+  802248:	ff d0                	call   *%rax
+  80224a:	85 c0                	test   %eax,%eax
+  80224c:	78 17                	js     802265 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80224e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802252:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802259:	00 00 00 
+  80225c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802260:	5b                   	pop    %rbx
+  802261:	41 5c                	pop    %r12
+  802263:	5d                   	pop    %rbp
+  802264:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226a:	eb f4                	jmp    802260 <mmap_alloc+0x86>
+
+000000000080226c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+  802270:	41 56                	push   %r14
+  802272:	41 55                	push   %r13
+  802274:	41 54                	push   %r12
+  802276:	53                   	push   %rbx
+  802277:	48 83 ec 10          	sub    $0x10,%rsp
+  80227b:	41 89 fc             	mov    %edi,%r12d
+  80227e:	49 89 f5             	mov    %rsi,%r13
+  802281:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802284:	48 89 f0             	mov    %rsi,%rax
+  802287:	48 09 d0             	or     %rdx,%rax
+  80228a:	75 0d                	jne    802299 <fsipc+0x2d>
+  80228c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80228f:	83 f8 04             	cmp    $0x4,%eax
+  802292:	76 7d                	jbe    802311 <fsipc+0xa5>
+  802294:	83 ff 0d             	cmp    $0xd,%edi
+  802297:	74 78                	je     802311 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802299:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  8022a0:	00 00 00 
+  8022a3:	ff d0                	call   *%rax
+  8022a5:	89 c7                	mov    %eax,%edi
+  8022a7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022ae:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022b5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022c2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022c9:	00 00 00 
+  8022cc:	44 89 e6             	mov    %r12d,%esi
+  8022cf:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  8022d6:	00 00 00 
+  8022d9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022db:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022e2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022e8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022ec:	4c 89 ee             	mov    %r13,%rsi
+  8022ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f4:	48 b8 d0 45 80 00 00 	movabs $0x8045d0,%rax
+  8022fb:	00 00 00 
+  8022fe:	ff d0                	call   *%rax
+  802300:	89 c3                	mov    %eax,%ebx
+}
+  802302:	89 d8                	mov    %ebx,%eax
+  802304:	48 83 c4 10          	add    $0x10,%rsp
+  802308:	5b                   	pop    %rbx
+  802309:	41 5c                	pop    %r12
+  80230b:	41 5d                	pop    %r13
+  80230d:	41 5e                	pop    %r14
+  80230f:	5d                   	pop    %rbp
+  802310:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802311:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  802318:	00 00 00 
+  80231b:	ff d0                	call   *%rax
+  80231d:	49 89 c6             	mov    %rax,%r14
+  802320:	48 85 c0             	test   %rax,%rax
+  802323:	0f 84 70 ff ff ff    	je     802299 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802329:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80232d:	48 b8 21 3e 80 00 00 	movabs $0x803e21,%rax
+  802334:	00 00 00 
+  802337:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802339:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80233c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802343:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802347:	ba 10 00 00 00       	mov    $0x10,%edx
+  80234c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802353:	00 00 00 
+  802356:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  80235d:	00 00 00 
+  802360:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802362:	4c 89 f7             	mov    %r14,%rdi
+  802365:	48 b8 ba 1d 80 00 00 	movabs $0x801dba,%rax
+  80236c:	00 00 00 
+  80236f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802371:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802378:	4c 89 f7             	mov    %r14,%rdi
+  80237b:	48 b8 e4 3e 80 00 00 	movabs $0x803ee4,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802387:	4c 89 f7             	mov    %r14,%rdi
+  80238a:	48 b8 72 3e 80 00 00 	movabs $0x803e72,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802396:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802399:	41 83 fc 05          	cmp    $0x5,%r12d
+  80239d:	75 04                	jne    8023a3 <fsipc+0x137>
+  80239f:	85 db                	test   %ebx,%ebx
+  8023a1:	79 14                	jns    8023b7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023a3:	4c 89 f7             	mov    %r14,%rdi
+  8023a6:	48 b8 99 3e 80 00 00 	movabs $0x803e99,%rax
+  8023ad:	00 00 00 
+  8023b0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023b2:	e9 4b ff ff ff       	jmp    802302 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023b7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023bb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023c0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023c7:	00 00 00 
+  8023ca:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  8023d1:	00 00 00 
+  8023d4:	ff d0                	call   *%rax
+  8023d6:	eb cb                	jmp    8023a3 <fsipc+0x137>
+
+00000000008023d8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023d8:	55                   	push   %rbp
+  8023d9:	48 89 e5             	mov    %rsp,%rbp
+  8023dc:	41 57                	push   %r15
+  8023de:	41 56                	push   %r14
+  8023e0:	41 55                	push   %r13
+  8023e2:	41 54                	push   %r12
+  8023e4:	53                   	push   %rbx
+  8023e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8023e9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8023ed:	49 89 f6             	mov    %rsi,%r14
+  8023f0:	49 89 d4             	mov    %rdx,%r12
+  8023f3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8023f6:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8023fd:	00 00 00 
+  802400:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802402:	48 85 c0             	test   %rax,%rax
+  802405:	0f 85 96 00 00 00    	jne    8024a1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80240b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802412:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802413:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80241a:	00 00 00 
+    while (n) {
+  80241d:	4d 85 e4             	test   %r12,%r12
+  802420:	74 79                	je     80249b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802422:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802427:	49 39 dc             	cmp    %rbx,%r12
+  80242a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80242e:	48 89 da             	mov    %rbx,%rdx
+  802431:	4c 89 f6             	mov    %r14,%rsi
+  802434:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80243b:	00 00 00 
+  80243e:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  802445:	00 00 00 
+  802448:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80244a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80244e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802451:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802454:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802457:	44 01 e8             	add    %r13d,%eax
+  80245a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80245e:	41 0f 44 c5          	cmove  %r13d,%eax
+  802462:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802466:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80246a:	48 89 da             	mov    %rbx,%rdx
+  80246d:	be 00 00 00 00       	mov    $0x0,%esi
+  802472:	bf 04 00 00 00       	mov    $0x4,%edi
+  802477:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  80247e:	00 00 00 
+  802481:	ff d0                	call   *%rax
+        if (res < 0)
+  802483:	85 c0                	test   %eax,%eax
+  802485:	78 4a                	js     8024d1 <devfile_write_direct+0xf9>
+        buf += res;
+  802487:	48 98                	cltq
+  802489:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80248c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802490:	49 29 c4             	sub    %rax,%r12
+  802493:	75 8d                	jne    802422 <devfile_write_direct+0x4a>
+    return write;
+  802495:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802499:	eb 27                	jmp    8024c2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80249b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80249f:	eb f4                	jmp    802495 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8024a1:	45 89 e9             	mov    %r13d,%r9d
+  8024a4:	4d 89 e0             	mov    %r12,%r8
+  8024a7:	4c 89 f1             	mov    %r14,%rcx
+  8024aa:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024b3:	48 89 c7             	mov    %rax,%rdi
+  8024b6:	48 b8 05 1e 80 00 00 	movabs $0x801e05,%rax
+  8024bd:	00 00 00 
+  8024c0:	ff d0                	call   *%rax
+}
+  8024c2:	48 83 c4 18          	add    $0x18,%rsp
+  8024c6:	5b                   	pop    %rbx
+  8024c7:	41 5c                	pop    %r12
+  8024c9:	41 5d                	pop    %r13
+  8024cb:	41 5e                	pop    %r14
+  8024cd:	41 5f                	pop    %r15
+  8024cf:	5d                   	pop    %rbp
+  8024d0:	c3                   	ret
+            return res;
+  8024d1:	48 98                	cltq
+  8024d3:	eb ed                	jmp    8024c2 <devfile_write_direct+0xea>
+
+00000000008024d5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024d5:	55                   	push   %rbp
+  8024d6:	48 89 e5             	mov    %rsp,%rbp
+  8024d9:	41 54                	push   %r12
+  8024db:	53                   	push   %rbx
+  8024dc:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8024df:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8024eb:	48 85 c0             	test   %rax,%rax
+  8024ee:	74 71                	je     802561 <fbuf_flush+0x8c>
+  8024f0:	48 89 c3             	mov    %rax,%rbx
+  8024f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024f8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8024fc:	75 05                	jne    802503 <fbuf_flush+0x2e>
+}
+  8024fe:	5b                   	pop    %rbx
+  8024ff:	41 5c                	pop    %r12
+  802501:	5d                   	pop    %rbp
+  802502:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802503:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802506:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80250a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802511:	00 00 00 
+  802514:	48 89 de             	mov    %rbx,%rsi
+  802517:	48 29 c6             	sub    %rax,%rsi
+  80251a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80251e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802525:	aa aa aa 
+  802528:	48 0f af f0          	imul   %rax,%rsi
+  80252c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802530:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802535:	48 01 c6             	add    %rax,%rsi
+  802538:	4c 89 e7             	mov    %r12,%rdi
+  80253b:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  802542:	00 00 00 
+  802545:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802547:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80254b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802552:	00 
+    return res < 0 ? res : 0;
+  802553:	48 85 c0             	test   %rax,%rax
+  802556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80255b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80255f:	eb 9d                	jmp    8024fe <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802561:	b8 00 00 00 00       	mov    $0x0,%eax
+  802566:	eb 96                	jmp    8024fe <fbuf_flush+0x29>
+
+0000000000802568 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802568:	55                   	push   %rbp
+  802569:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80256c:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  802573:	00 00 00 
+  802576:	ff d0                	call   *%rax
+}
+  802578:	5d                   	pop    %rbp
+  802579:	c3                   	ret
+
+000000000080257a <devfile_write>:
+    if (!fd || !buf)
+  80257a:	48 85 ff             	test   %rdi,%rdi
+  80257d:	0f 84 d3 01 00 00    	je     802756 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802583:	55                   	push   %rbp
+  802584:	48 89 e5             	mov    %rsp,%rbp
+  802587:	41 57                	push   %r15
+  802589:	41 56                	push   %r14
+  80258b:	41 55                	push   %r13
+  80258d:	41 54                	push   %r12
+  80258f:	53                   	push   %rbx
+  802590:	48 83 ec 08          	sub    $0x8,%rsp
+  802594:	49 89 fc             	mov    %rdi,%r12
+  802597:	49 89 f6             	mov    %rsi,%r14
+  80259a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80259d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025a2:	48 85 f6             	test   %rsi,%rsi
+  8025a5:	0f 84 9c 01 00 00    	je     802747 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025ab:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  8025b2:	00 00 00 
+  8025b5:	ff d0                	call   *%rax
+  8025b7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025ba:	48 85 c0             	test   %rax,%rax
+  8025bd:	0f 84 a2 00 00 00    	je     802665 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025c8:	4c 89 e7             	mov    %r12,%rdi
+  8025cb:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025d7:	83 f8 02             	cmp    $0x2,%eax
+  8025da:	0f 8f 85 00 00 00    	jg     802665 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8025e0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025e7:	00 00 00 
+  8025ea:	4d 89 ef             	mov    %r13,%r15
+  8025ed:	49 29 c7             	sub    %rax,%r15
+  8025f0:	49 c1 ff 03          	sar    $0x3,%r15
+  8025f4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8025fb:	aa aa aa 
+  8025fe:	4c 0f af f8          	imul   %rax,%r15
+  802602:	49 c1 e7 0e          	shl    $0xe,%r15
+  802606:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80260b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80260e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802613:	0f 84 d7 00 00 00    	je     8026f0 <devfile_write+0x176>
+  802619:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80261d:	89 c2                	mov    %eax,%edx
+  80261f:	41 03 55 0c          	add    0xc(%r13),%edx
+  802623:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802628:	75 0f                	jne    802639 <devfile_write+0xbf>
+  80262a:	48 01 d8             	add    %rbx,%rax
+  80262d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802633:	0f 86 92 00 00 00    	jbe    8026cb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802639:	4c 89 e7             	mov    %r12,%rdi
+  80263c:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  802643:	00 00 00 
+  802646:	ff d0                	call   *%rax
+  802648:	85 c0                	test   %eax,%eax
+  80264a:	78 52                	js     80269e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80264c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802653:	77 7f                	ja     8026d4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802655:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80265a:	0f 85 c2 00 00 00    	jne    802722 <devfile_write+0x1a8>
+  802660:	e9 94 00 00 00       	jmp    8026f9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802665:	4c 89 e7             	mov    %r12,%rdi
+  802668:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802674:	85 c0                	test   %eax,%eax
+  802676:	79 07                	jns    80267f <devfile_write+0x105>
+  802678:	48 98                	cltq
+  80267a:	e9 c8 00 00 00       	jmp    802747 <devfile_write+0x1cd>
+  80267f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802684:	48 89 da             	mov    %rbx,%rdx
+  802687:	4c 89 f6             	mov    %r14,%rsi
+  80268a:	4c 89 e7             	mov    %r12,%rdi
+  80268d:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  802694:	00 00 00 
+  802697:	ff d0                	call   *%rax
+  802699:	e9 a9 00 00 00       	jmp    802747 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80269e:	48 98                	cltq
+  8026a0:	e9 a2 00 00 00       	jmp    802747 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026a5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026aa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026af:	4c 89 fe             	mov    %r15,%rsi
+  8026b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b7:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8026be:	00 00 00 
+  8026c1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026c3:	85 c0                	test   %eax,%eax
+  8026c5:	79 45                	jns    80270c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026c7:	48 98                	cltq
+  8026c9:	eb 7c                	jmp    802747 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026cb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026d2:	76 4e                	jbe    802722 <devfile_write+0x1a8>
+  8026d4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026d9:	48 89 da             	mov    %rbx,%rdx
+  8026dc:	4c 89 f6             	mov    %r14,%rsi
+  8026df:	4c 89 e7             	mov    %r12,%rdi
+  8026e2:	48 b8 d8 23 80 00 00 	movabs $0x8023d8,%rax
+  8026e9:	00 00 00 
+  8026ec:	ff d0                	call   *%rax
+  8026ee:	eb 57                	jmp    802747 <devfile_write+0x1cd>
+  8026f0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026f7:	77 db                	ja     8026d4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8026f9:	4c 89 ff             	mov    %r15,%rdi
+  8026fc:	48 b8 a3 3c 80 00 00 	movabs $0x803ca3,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+  802708:	84 c0                	test   %al,%al
+  80270a:	74 99                	je     8026a5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80270c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802711:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802716:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80271a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802721:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802722:	4c 89 ff             	mov    %r15,%rdi
+  802725:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802729:	48 89 da             	mov    %rbx,%rdx
+  80272c:	4c 89 f6             	mov    %r14,%rsi
+  80272f:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80273b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80273f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802744:	48 89 d8             	mov    %rbx,%rax
+}
+  802747:	48 83 c4 08          	add    $0x8,%rsp
+  80274b:	5b                   	pop    %rbx
+  80274c:	41 5c                	pop    %r12
+  80274e:	41 5d                	pop    %r13
+  802750:	41 5e                	pop    %r14
+  802752:	41 5f                	pop    %r15
+  802754:	5d                   	pop    %rbp
+  802755:	c3                   	ret
+        return E_INVAL;
+  802756:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80275b:	c3                   	ret
+
+000000000080275c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80275c:	55                   	push   %rbp
+  80275d:	48 89 e5             	mov    %rsp,%rbp
+  802760:	41 54                	push   %r12
+  802762:	53                   	push   %rbx
+  802763:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802766:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  80276d:	00 00 00 
+  802770:	ff d0                	call   *%rax
+  802772:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802775:	48 89 df             	mov    %rbx,%rdi
+  802778:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  80277f:	00 00 00 
+  802782:	ff d0                	call   *%rax
+  802784:	48 85 c0             	test   %rax,%rax
+  802787:	74 17                	je     8027a0 <devfile_flush+0x44>
+  802789:	48 89 df             	mov    %rbx,%rdi
+  80278c:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+  802798:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80279f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027a0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027a3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027aa:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8027b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027bb:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  8027c2:	00 00 00 
+  8027c5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027c7:	45 85 e4             	test   %r12d,%r12d
+  8027ca:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027ce:	5b                   	pop    %rbx
+  8027cf:	41 5c                	pop    %r12
+  8027d1:	5d                   	pop    %rbp
+  8027d2:	c3                   	ret
+
+00000000008027d3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027d3:	55                   	push   %rbp
+  8027d4:	48 89 e5             	mov    %rsp,%rbp
+  8027d7:	41 57                	push   %r15
+  8027d9:	41 56                	push   %r14
+  8027db:	41 55                	push   %r13
+  8027dd:	41 54                	push   %r12
+  8027df:	53                   	push   %rbx
+  8027e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8027e4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027e8:	49 89 f7             	mov    %rsi,%r15
+  8027eb:	48 89 d3             	mov    %rdx,%rbx
+  8027ee:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8027f1:	48 b8 1e 1d 80 00 00 	movabs $0x801d1e,%rax
+  8027f8:	00 00 00 
+  8027fb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8027fd:	48 85 c0             	test   %rax,%rax
+  802800:	75 20                	jne    802822 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802802:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802807:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80280e:	00 
+    while (n) {
+  80280f:	48 85 db             	test   %rbx,%rbx
+  802812:	0f 85 df 00 00 00    	jne    8028f7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802818:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80281c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802820:	eb 21                	jmp    802843 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802822:	45 89 f1             	mov    %r14d,%r9d
+  802825:	49 89 d8             	mov    %rbx,%r8
+  802828:	4c 89 f9             	mov    %r15,%rcx
+  80282b:	ba 03 00 00 00       	mov    $0x3,%edx
+  802830:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802834:	48 89 c7             	mov    %rax,%rdi
+  802837:	48 b8 05 1e 80 00 00 	movabs $0x801e05,%rax
+  80283e:	00 00 00 
+  802841:	ff d0                	call   *%rax
+}
+  802843:	48 83 c4 38          	add    $0x38,%rsp
+  802847:	5b                   	pop    %rbx
+  802848:	41 5c                	pop    %r12
+  80284a:	41 5d                	pop    %r13
+  80284c:	41 5e                	pop    %r14
+  80284e:	41 5f                	pop    %r15
+  802850:	5d                   	pop    %rbp
+  802851:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802852:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802856:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80285c:	75 1e                	jne    80287c <devfile_read_direct+0xa9>
+  80285e:	e9 e2 00 00 00       	jmp    802945 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802863:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802867:	eb da                	jmp    802843 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802869:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80286d:	0f 85 d0 01 00 00    	jne    802a43 <devfile_read_direct+0x270>
+            map = 0;
+  802873:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802877:	eb 03                	jmp    80287c <devfile_read_direct+0xa9>
+  802879:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80287c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802881:	48 39 d3             	cmp    %rdx,%rbx
+  802884:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802888:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80288c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80288f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802896:	00 00 00 
+  802899:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  80289b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80289f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8028a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028ad:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  8028b4:	00 00 00 
+  8028b7:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028b9:	85 c0                	test   %eax,%eax
+  8028bb:	0f 8e 63 01 00 00    	jle    802a24 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028c1:	4c 63 e0             	movslq %eax,%r12
+  8028c4:	4c 89 e2             	mov    %r12,%rdx
+  8028c7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028ce:	00 00 00 
+  8028d1:	4c 89 ff             	mov    %r15,%rdi
+  8028d4:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  8028db:	00 00 00 
+  8028de:	ff d0                	call   *%rax
+        buf += res;
+  8028e0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8028e3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8028e6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8028ea:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8028ee:	48 85 db             	test   %rbx,%rbx
+  8028f1:	0f 84 25 ff ff ff    	je     80281c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  8028f7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  8028fa:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  8028fe:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802902:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802906:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80290d:	0f 97 c2             	seta   %dl
+  802910:	20 c2                	and    %al,%dl
+  802912:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802915:	0f 84 5e ff ff ff    	je     802879 <devfile_read_direct+0xa6>
+  80291b:	4c 89 fa             	mov    %r15,%rdx
+  80291e:	4d 89 fd             	mov    %r15,%r13
+  802921:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802928:	0f 85 4e ff ff ff    	jne    80287c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80292e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802932:	0f 84 1a ff ff ff    	je     802852 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802938:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80293f:	0f 85 37 ff ff ff    	jne    80287c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802945:	48 89 d8             	mov    %rbx,%rax
+  802948:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80294e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802953:	48 39 c8             	cmp    %rcx,%rax
+  802956:	48 0f 47 c1          	cmova  %rcx,%rax
+  80295a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  80295e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802962:	49 89 d4             	mov    %rdx,%r12
+  802965:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802969:	48 b8 44 3c 80 00 00 	movabs $0x803c44,%rax
+  802970:	00 00 00 
+  802973:	ff d0                	call   *%rax
+  802975:	a8 40                	test   $0x40,%al
+  802977:	0f 85 b9 00 00 00    	jne    802a36 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  80297d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802984:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802988:	49 39 c5             	cmp    %rax,%r13
+  80298b:	72 d8                	jb     802965 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80298d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802991:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802998:	00 00 00 
+  80299b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80299f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029a2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029a4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029a8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029ac:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  8029b3:	00 00 00 
+  8029b6:	ff d0                	call   *%rax
+  8029b8:	89 c7                	mov    %eax,%edi
+  8029ba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029c0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029c5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029cc:	00 00 00 
+  8029cf:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029d4:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8029e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029e5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029e9:	4c 89 fe             	mov    %r15,%rsi
+  8029ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f1:	48 b8 d0 45 80 00 00 	movabs $0x8045d0,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a00:	48 85 d2             	test   %rdx,%rdx
+  802a03:	0f 84 5a fe ff ff    	je     802863 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a09:	0f 8e 5a fe ff ff    	jle    802869 <devfile_read_direct+0x96>
+                buf += res;
+  802a0f:	48 98                	cltq
+  802a11:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a14:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a17:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a1b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a1f:	e9 ca fe ff ff       	jmp    8028ee <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a24:	41 89 c5             	mov    %eax,%r13d
+  802a27:	48 98                	cltq
+  802a29:	45 85 ed             	test   %r13d,%r13d
+  802a2c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a31:	e9 0d fe ff ff       	jmp    802843 <devfile_read_direct+0x70>
+            map = 0;
+  802a36:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a3a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a3e:	e9 39 fe ff ff       	jmp    80287c <devfile_read_direct+0xa9>
+  802a43:	48 89 d0             	mov    %rdx,%rax
+  802a46:	e9 f8 fd ff ff       	jmp    802843 <devfile_read_direct+0x70>
+
+0000000000802a4b <devfile_read>:
+    if (!fd || !buf)
+  802a4b:	48 85 ff             	test   %rdi,%rdi
+  802a4e:	0f 84 21 02 00 00    	je     802c75 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a54:	55                   	push   %rbp
+  802a55:	48 89 e5             	mov    %rsp,%rbp
+  802a58:	41 57                	push   %r15
+  802a5a:	41 56                	push   %r14
+  802a5c:	41 55                	push   %r13
+  802a5e:	41 54                	push   %r12
+  802a60:	53                   	push   %rbx
+  802a61:	48 83 ec 28          	sub    $0x28,%rsp
+  802a65:	48 89 fb             	mov    %rdi,%rbx
+  802a68:	49 89 f4             	mov    %rsi,%r12
+  802a6b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a6e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a73:	48 85 f6             	test   %rsi,%rsi
+  802a76:	74 4b                	je     802ac3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a78:	48 b8 88 1d 80 00 00 	movabs $0x801d88,%rax
+  802a7f:	00 00 00 
+  802a82:	ff d0                	call   *%rax
+  802a84:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802a87:	48 85 c0             	test   %rax,%rax
+  802a8a:	74 22                	je     802aae <devfile_read+0x63>
+  802a8c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802a93:	77 19                	ja     802aae <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a95:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a9a:	48 89 df             	mov    %rbx,%rdi
+  802a9d:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  802aa4:	00 00 00 
+  802aa7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802aa9:	83 f8 02             	cmp    $0x2,%eax
+  802aac:	7e 40                	jle    802aee <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802aae:	48 89 df             	mov    %rbx,%rdi
+  802ab1:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  802ab8:	00 00 00 
+  802abb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802abd:	85 c0                	test   %eax,%eax
+  802abf:	79 11                	jns    802ad2 <devfile_read+0x87>
+  802ac1:	48 98                	cltq
+}
+  802ac3:	48 83 c4 28          	add    $0x28,%rsp
+  802ac7:	5b                   	pop    %rbx
+  802ac8:	41 5c                	pop    %r12
+  802aca:	41 5d                	pop    %r13
+  802acc:	41 5e                	pop    %r14
+  802ace:	41 5f                	pop    %r15
+  802ad0:	5d                   	pop    %rbp
+  802ad1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ad2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ad7:	4c 89 ea             	mov    %r13,%rdx
+  802ada:	4c 89 e6             	mov    %r12,%rsi
+  802add:	48 89 df             	mov    %rbx,%rdi
+  802ae0:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802ae7:	00 00 00 
+  802aea:	ff d0                	call   *%rax
+  802aec:	eb d5                	jmp    802ac3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802aee:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802af2:	48 89 df             	mov    %rbx,%rdi
+  802af5:	48 b8 d5 24 80 00 00 	movabs $0x8024d5,%rax
+  802afc:	00 00 00 
+  802aff:	ff d0                	call   *%rax
+  802b01:	85 c0                	test   %eax,%eax
+  802b03:	0f 88 33 01 00 00    	js     802c3c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b09:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b10:	00 00 00 
+  802b13:	4c 89 f0             	mov    %r14,%rax
+  802b16:	48 29 d0             	sub    %rdx,%rax
+  802b19:	48 c1 f8 03          	sar    $0x3,%rax
+  802b1d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b24:	aa aa aa 
+  802b27:	48 0f af c2          	imul   %rdx,%rax
+  802b2b:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b33:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b36:	41 39 06             	cmp    %eax,(%r14)
+  802b39:	75 0d                	jne    802b48 <devfile_read+0xfd>
+  802b3b:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b3e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b42:	0f 84 fb 00 00 00    	je     802c43 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b48:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b4d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b51:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b58:	48 89 c7             	mov    %rax,%rdi
+  802b5b:	48 b8 a3 3c 80 00 00 	movabs $0x803ca3,%rax
+  802b62:	00 00 00 
+  802b65:	ff d0                	call   *%rax
+  802b67:	84 c0                	test   %al,%al
+  802b69:	75 27                	jne    802b92 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b6b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b70:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b75:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b79:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7e:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  802b85:	00 00 00 
+  802b88:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802b8a:	85 c0                	test   %eax,%eax
+  802b8c:	0f 88 dc 00 00 00    	js     802c6e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802b92:	44 89 f8             	mov    %r15d,%eax
+  802b95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b9a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802b9c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ba3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ba4:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ba7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802bab:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bae:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bb3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bb7:	48 89 df             	mov    %rbx,%rdi
+  802bba:	48 b8 d3 27 80 00 00 	movabs $0x8027d3,%rax
+  802bc1:	00 00 00 
+  802bc4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802bc6:	48 85 c0             	test   %rax,%rax
+  802bc9:	0f 88 f4 fe ff ff    	js     802ac3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802bcf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802bd2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802bd5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802bd8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802bdc:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802be0:	48 63 d1             	movslq %ecx,%rdx
+  802be3:	48 01 d0             	add    %rdx,%rax
+  802be6:	4d 63 ff             	movslq %r15d,%r15
+  802be9:	4c 29 f8             	sub    %r15,%rax
+  802bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802bf5:	48 85 c0             	test   %rax,%rax
+  802bf8:	0f 8e c5 fe ff ff    	jle    802ac3 <devfile_read+0x78>
+    n = MIN(n, res);
+  802bfe:	4c 39 e8             	cmp    %r13,%rax
+  802c01:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c05:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c08:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c0c:	48 63 f6             	movslq %esi,%rsi
+  802c0f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c14:	48 01 c6             	add    %rax,%rsi
+  802c17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c1b:	48 01 c6             	add    %rax,%rsi
+  802c1e:	4c 89 ea             	mov    %r13,%rdx
+  802c21:	4c 89 e7             	mov    %r12,%rdi
+  802c24:	48 b8 56 0d 80 00 00 	movabs $0x800d56,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c30:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c34:	4c 89 e8             	mov    %r13,%rax
+  802c37:	e9 87 fe ff ff       	jmp    802ac3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c3c:	48 98                	cltq
+  802c3e:	e9 80 fe ff ff       	jmp    802ac3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c43:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c47:	41 39 d7             	cmp    %edx,%r15d
+  802c4a:	0f 8c f8 fe ff ff    	jl     802b48 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c50:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c54:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c57:	41 39 cf             	cmp    %ecx,%r15d
+  802c5a:	0f 8d e8 fe ff ff    	jge    802b48 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c60:	4d 63 ff             	movslq %r15d,%r15
+  802c63:	4c 29 f8             	sub    %r15,%rax
+  802c66:	48 63 d2             	movslq %edx,%rdx
+  802c69:	48 01 d0             	add    %rdx,%rax
+  802c6c:	eb 87                	jmp    802bf5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c6e:	48 98                	cltq
+  802c70:	e9 4e fe ff ff       	jmp    802ac3 <devfile_read+0x78>
+        return E_INVAL;
+  802c75:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c7a:	c3                   	ret
+
+0000000000802c7b <fs_channel>:
+fs_channel(bool enable) {
+  802c7b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802c7d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802c84:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c8b:	40 84 ff             	test   %dil,%dil
+  802c8e:	74 47                	je     802cd7 <fs_channel+0x5c>
+  802c90:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802c97:	00 00 00 
+  802c9a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802ca0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802ca7:	00 00 00 
+  802caa:	3b 08                	cmp    (%rax),%ecx
+  802cac:	74 29                	je     802cd7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cae:	55                   	push   %rbp
+  802caf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cb2:	48 b8 fb 1b 80 00 00 	movabs $0x801bfb,%rax
+  802cb9:	00 00 00 
+  802cbc:	ff d0                	call   *%rax
+  802cbe:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802cc0:	85 c0                	test   %eax,%eax
+  802cc2:	78 04                	js     802cc8 <fs_channel+0x4d>
+}
+  802cc4:	89 d0                	mov    %edx,%eax
+  802cc6:	5d                   	pop    %rbp
+  802cc7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802cc8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802ccf:	00 00 00 
+  802cd2:	c6 00 00             	movb   $0x0,(%rax)
+  802cd5:	eb ed                	jmp    802cc4 <fs_channel+0x49>
+}
+  802cd7:	89 d0                	mov    %edx,%eax
+  802cd9:	c3                   	ret
+
+0000000000802cda <open>:
+open(const char *path, int mode) {
+  802cda:	55                   	push   %rbp
+  802cdb:	48 89 e5             	mov    %rsp,%rbp
+  802cde:	41 55                	push   %r13
+  802ce0:	41 54                	push   %r12
+  802ce2:	53                   	push   %rbx
+  802ce3:	48 83 ec 18          	sub    $0x18,%rsp
+  802ce7:	49 89 fc             	mov    %rdi,%r12
+  802cea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ced:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  802cf4:	00 00 00 
+  802cf7:	ff d0                	call   *%rax
+  802cf9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802cff:	0f 87 8f 00 00 00    	ja     802d94 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d09:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  802d10:	00 00 00 
+  802d13:	ff d0                	call   *%rax
+  802d15:	89 c3                	mov    %eax,%ebx
+  802d17:	85 c0                	test   %eax,%eax
+  802d19:	78 55                	js     802d70 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d1b:	4c 89 e6             	mov    %r12,%rsi
+  802d1e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d25:	00 00 00 
+  802d28:	48 89 df             	mov    %rbx,%rdi
+  802d2b:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d47:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d4c:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802d53:	00 00 00 
+  802d56:	ff d0                	call   *%rax
+  802d58:	89 c3                	mov    %eax,%ebx
+  802d5a:	85 c0                	test   %eax,%eax
+  802d5c:	78 1f                	js     802d7d <open+0xa3>
+    return fd2num(fd);
+  802d5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d62:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	89 c3                	mov    %eax,%ebx
+}
+  802d70:	89 d8                	mov    %ebx,%eax
+  802d72:	48 83 c4 18          	add    $0x18,%rsp
+  802d76:	5b                   	pop    %rbx
+  802d77:	41 5c                	pop    %r12
+  802d79:	41 5d                	pop    %r13
+  802d7b:	5d                   	pop    %rbp
+  802d7c:	c3                   	ret
+        fd_close(fd, 0);
+  802d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d86:	48 b8 d0 15 80 00 00 	movabs $0x8015d0,%rax
+  802d8d:	00 00 00 
+  802d90:	ff d0                	call   *%rax
+        return res;
+  802d92:	eb dc                	jmp    802d70 <open+0x96>
+        return -E_BAD_PATH;
+  802d94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d99:	eb d5                	jmp    802d70 <open+0x96>
+
+0000000000802d9b <file_flush_buffers>:
+file_flush_buffers(void) {
+  802d9b:	55                   	push   %rbp
+  802d9c:	48 89 e5             	mov    %rsp,%rbp
+  802d9f:	41 56                	push   %r14
+  802da1:	41 55                	push   %r13
+  802da3:	41 54                	push   %r12
+  802da5:	53                   	push   %rbx
+  802da6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802daa:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802db1:	00 00 00 
+  802db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802db9:	49 bd 15 15 80 00 00 	movabs $0x801515,%r13
+  802dc0:	00 00 00 
+  802dc3:	49 be d5 24 80 00 00 	movabs $0x8024d5,%r14
+  802dca:	00 00 00 
+  802dcd:	eb 0c                	jmp    802ddb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802dcf:	83 c3 01             	add    $0x1,%ebx
+  802dd2:	49 83 c4 18          	add    $0x18,%r12
+  802dd6:	83 fb 20             	cmp    $0x20,%ebx
+  802dd9:	74 1d                	je     802df8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802ddb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802de0:	74 ed                	je     802dcf <file_flush_buffers+0x34>
+  802de2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802de6:	89 df                	mov    %ebx,%edi
+  802de8:	41 ff d5             	call   *%r13
+  802deb:	85 c0                	test   %eax,%eax
+  802ded:	78 e0                	js     802dcf <file_flush_buffers+0x34>
+  802def:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df3:	41 ff d6             	call   *%r14
+  802df6:	eb d7                	jmp    802dcf <file_flush_buffers+0x34>
+}
+  802df8:	48 83 c4 10          	add    $0x10,%rsp
+  802dfc:	5b                   	pop    %rbx
+  802dfd:	41 5c                	pop    %r12
+  802dff:	41 5d                	pop    %r13
+  802e01:	41 5e                	pop    %r14
+  802e03:	5d                   	pop    %rbp
+  802e04:	c3                   	ret
+
+0000000000802e05 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+  802e09:	41 54                	push   %r12
+  802e0b:	53                   	push   %rbx
+  802e0c:	49 89 fc             	mov    %rdi,%r12
+  802e0f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e11:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  802e18:	00 00 00 
+  802e1b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e1d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e24:	00 00 00 
+  802e27:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e2c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e2e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e36:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e40:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802e47:	00 00 00 
+  802e4a:	ff d0                	call   *%rax
+}
+  802e4c:	5b                   	pop    %rbx
+  802e4d:	41 5c                	pop    %r12
+  802e4f:	5d                   	pop    %rbp
+  802e50:	c3                   	ret
+
+0000000000802e51 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e51:	55                   	push   %rbp
+  802e52:	48 89 e5             	mov    %rsp,%rbp
+  802e55:	41 54                	push   %r12
+  802e57:	53                   	push   %rbx
+  802e58:	49 89 fc             	mov    %rdi,%r12
+  802e5b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e5e:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  802e65:	00 00 00 
+  802e68:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e6a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e6f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e76:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  802e82:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e87:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802e8e:	00 00 00 
+  802e91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e93:	85 c0                	test   %eax,%eax
+  802e95:	78 3d                	js     802ed4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e97:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802e9e:	00 00 00 
+  802ea1:	4c 89 e6             	mov    %r12,%rsi
+  802ea4:	48 89 df             	mov    %rbx,%rdi
+  802ea7:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  802eae:	00 00 00 
+  802eb1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802eb3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802eba:	00 
+  802ebb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ec1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ec8:	00 
+  802ec9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed4:	5b                   	pop    %rbx
+  802ed5:	41 5c                	pop    %r12
+  802ed7:	5d                   	pop    %rbp
+  802ed8:	c3                   	ret
+
+0000000000802ed9 <remove>:
+remove(const char *path) {
+  802ed9:	55                   	push   %rbp
+  802eda:	48 89 e5             	mov    %rsp,%rbp
+  802edd:	53                   	push   %rbx
+  802ede:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802ee5:	48 b8 b7 0a 80 00 00 	movabs $0x800ab7,%rax
+  802eec:	00 00 00 
+  802eef:	ff d0                	call   *%rax
+  802ef1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ef7:	77 3a                	ja     802f33 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802ef9:	48 89 de             	mov    %rbx,%rsi
+  802efc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f03:	00 00 00 
+  802f06:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  802f0d:	00 00 00 
+  802f10:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f17:	be 00 00 00 00       	mov    $0x0,%esi
+  802f1c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f21:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802f28:	00 00 00 
+  802f2b:	ff d0                	call   *%rax
+}
+  802f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f31:	c9                   	leave
+  802f32:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f33:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f38:	eb f3                	jmp    802f2d <remove+0x54>
+
+0000000000802f3a <sync>:
+sync(void) {
+  802f3a:	55                   	push   %rbp
+  802f3b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f3e:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  802f45:	00 00 00 
+  802f48:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  802f54:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f59:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802f60:	00 00 00 
+  802f63:	ff d0                	call   *%rax
+}
+  802f65:	5d                   	pop    %rbp
+  802f66:	c3                   	ret
+
+0000000000802f67 <fsync>:
+fsync(int fdnum) {
+  802f67:	55                   	push   %rbp
+  802f68:	48 89 e5             	mov    %rsp,%rbp
+  802f6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f6f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f73:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  802f7a:	00 00 00 
+  802f7d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f7f:	85 c0                	test   %eax,%eax
+  802f81:	78 4b                	js     802fce <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f87:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802f8e:	00 00 00 
+  802f91:	8b 00                	mov    (%rax),%eax
+  802f93:	39 02                	cmp    %eax,(%rdx)
+  802f95:	75 39                	jne    802fd0 <fsync+0x69>
+    file_flush_buffers();
+  802f97:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  802f9e:	00 00 00 
+  802fa1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fa7:	8b 40 0c             	mov    0xc(%rax),%eax
+  802faa:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802fb1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fbd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fc2:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802fc9:	00 00 00 
+  802fcc:	ff d0                	call   *%rax
+}
+  802fce:	c9                   	leave
+  802fcf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fd5:	eb f7                	jmp    802fce <fsync+0x67>
+
+0000000000802fd7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802fd7:	55                   	push   %rbp
+  802fd8:	48 89 e5             	mov    %rsp,%rbp
+  802fdb:	53                   	push   %rbx
+  802fdc:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ff2:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802ff9:	00 00 00 
+  802ffc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802ffe:	85 c0                	test   %eax,%eax
+  803000:	78 2d                	js     80302f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803002:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803009:	00 00 00 
+  80300c:	48 8b 10             	mov    (%rax),%rdx
+  80300f:	48 89 13             	mov    %rdx,(%rbx)
+  803012:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803016:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80301a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80301e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803022:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803026:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80302a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80302f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803033:	c9                   	leave
+  803034:	c3                   	ret
+
+0000000000803035 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803035:	55                   	push   %rbp
+  803036:	48 89 e5             	mov    %rsp,%rbp
+  803039:	53                   	push   %rbx
+  80303a:	48 83 ec 08          	sub    $0x8,%rsp
+  80303e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803041:	ba 00 00 00 00       	mov    $0x0,%edx
+  803046:	be 00 00 00 00       	mov    $0x0,%esi
+  80304b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803050:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  803057:	00 00 00 
+  80305a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80305c:	85 c0                	test   %eax,%eax
+  80305e:	78 3d                	js     80309d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803060:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803067:	00 00 00 
+  80306a:	48 8b 10             	mov    (%rax),%rdx
+  80306d:	48 89 13             	mov    %rdx,(%rbx)
+  803070:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803074:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803078:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80307c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803080:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803084:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803088:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80308c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803090:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803094:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80309d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a1:	c9                   	leave
+  8030a2:	c3                   	ret
+
+00000000008030a3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030a3:	55                   	push   %rbp
+  8030a4:	48 89 e5             	mov    %rsp,%rbp
+  8030a7:	41 57                	push   %r15
+  8030a9:	41 56                	push   %r14
+  8030ab:	41 55                	push   %r13
+  8030ad:	41 54                	push   %r12
+  8030af:	53                   	push   %rbx
+  8030b0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030b4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030bb:	00 
+  8030bc:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030c3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030c9:	0f 85 43 01 00 00    	jne    803212 <munmap+0x16f>
+  8030cf:	49 89 ff             	mov    %rdi,%r15
+  8030d2:	4c 39 f7             	cmp    %r14,%rdi
+  8030d5:	0f 87 37 01 00 00    	ja     803212 <munmap+0x16f>
+  8030db:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8030e2:	00 00 00 
+  8030e5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8030eb:	eb 2c                	jmp    803119 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8030ed:	4c 39 f8             	cmp    %r15,%rax
+  8030f0:	0f 83 85 00 00 00    	jae    80317b <munmap+0xd8>
+            m->mm_end = start;
+  8030f6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8030fb:	48 83 c3 18          	add    $0x18,%rbx
+  8030ff:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803106:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80310d:	00 00 00 
+  803110:	48 39 c3             	cmp    %rax,%rbx
+  803113:	0f 84 d0 00 00 00    	je     8031e9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803119:	49 89 dc             	mov    %rbx,%r12
+  80311c:	48 8b 03             	mov    (%rbx),%rax
+  80311f:	4c 39 f0             	cmp    %r14,%rax
+  803122:	73 d7                	jae    8030fb <munmap+0x58>
+  803124:	48 85 c0             	test   %rax,%rax
+  803127:	74 d2                	je     8030fb <munmap+0x58>
+  803129:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80312d:	49 39 d7             	cmp    %rdx,%r15
+  803130:	73 c9                	jae    8030fb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803132:	49 39 d6             	cmp    %rdx,%r14
+  803135:	73 b6                	jae    8030ed <munmap+0x4a>
+  803137:	49 39 c7             	cmp    %rax,%r15
+  80313a:	76 b1                	jbe    8030ed <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80313c:	4c 89 ef             	mov    %r13,%rdi
+  80313f:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  803146:	00 00 00 
+  803149:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80314b:	48 85 c0             	test   %rax,%rax
+  80314e:	0f 84 c5 00 00 00    	je     803219 <munmap+0x176>
+            *tail = *m;
+  803154:	48 8b 13             	mov    (%rbx),%rdx
+  803157:	48 89 10             	mov    %rdx,(%rax)
+  80315a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80315e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803162:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803166:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80316a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80316d:	44 89 f2             	mov    %r14d,%edx
+  803170:	2b 13                	sub    (%rbx),%edx
+  803172:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803175:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803179:	eb 80                	jmp    8030fb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80317b:	49 39 d6             	cmp    %rdx,%r14
+  80317e:	73 18                	jae    803198 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803180:	44 89 f2             	mov    %r14d,%edx
+  803183:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803188:	29 c2                	sub    %eax,%edx
+  80318a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80318f:	4d 89 34 24          	mov    %r14,(%r12)
+  803193:	e9 63 ff ff ff       	jmp    8030fb <munmap+0x58>
+    m->mm_start = 0;
+  803198:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80319f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8031a0:	4c 89 e6             	mov    %r12,%rsi
+  8031a3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031aa:	00 00 00 
+  8031ad:	48 29 c6             	sub    %rax,%rsi
+  8031b0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031b4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031bb:	aa aa aa 
+  8031be:	48 0f af f0          	imul   %rax,%rsi
+  8031c2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031c6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031cb:	48 01 c6             	add    %rax,%rsi
+  8031ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031d8:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+}
+  8031e4:	e9 12 ff ff ff       	jmp    8030fb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8031e9:	4c 89 f2             	mov    %r14,%rdx
+  8031ec:	4c 29 fa             	sub    %r15,%rdx
+  8031ef:	4c 89 fe             	mov    %r15,%rsi
+  8031f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031f7:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  8031fe:	00 00 00 
+  803201:	ff d0                	call   *%rax
+}
+  803203:	48 83 c4 08          	add    $0x8,%rsp
+  803207:	5b                   	pop    %rbx
+  803208:	41 5c                	pop    %r12
+  80320a:	41 5d                	pop    %r13
+  80320c:	41 5e                	pop    %r14
+  80320e:	41 5f                	pop    %r15
+  803210:	5d                   	pop    %rbp
+  803211:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803217:	eb ea                	jmp    803203 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803219:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80321e:	eb e3                	jmp    803203 <munmap+0x160>
+
+0000000000803220 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803220:	55                   	push   %rbp
+  803221:	48 89 e5             	mov    %rsp,%rbp
+  803224:	41 57                	push   %r15
+  803226:	41 56                	push   %r14
+  803228:	41 55                	push   %r13
+  80322a:	41 54                	push   %r12
+  80322c:	53                   	push   %rbx
+  80322d:	48 83 ec 28          	sub    $0x28,%rsp
+  803231:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803235:	49 89 f5             	mov    %rsi,%r13
+  803238:	41 89 d6             	mov    %edx,%r14d
+  80323b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80323e:	41 89 cc             	mov    %ecx,%r12d
+  803241:	44 89 c7             	mov    %r8d,%edi
+  803244:	44 89 cb             	mov    %r9d,%ebx
+  803247:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80324b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80324f:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803256:	00 00 00 
+  803259:	ff d0                	call   *%rax
+  80325b:	41 89 c7             	mov    %eax,%r15d
+  80325e:	85 c0                	test   %eax,%eax
+  803260:	0f 88 ae 01 00 00    	js     803414 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803266:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80326a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803271:	00 00 00 
+  803274:	8b 32                	mov    (%rdx),%esi
+  803276:	39 30                	cmp    %esi,(%rax)
+  803278:	0f 85 7a 02 00 00    	jne    8034f8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80327e:	8b 40 08             	mov    0x8(%rax),%eax
+  803281:	83 e0 03             	and    $0x3,%eax
+  803284:	83 f8 01             	cmp    $0x1,%eax
+  803287:	0f 84 76 02 00 00    	je     803503 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80328d:	4d 85 ed             	test   %r13,%r13
+  803290:	0f 84 78 02 00 00    	je     80350e <mmap+0x2ee>
+  803296:	85 db                	test   %ebx,%ebx
+  803298:	0f 88 70 02 00 00    	js     80350e <mmap+0x2ee>
+  80329e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032a4:	41 89 df             	mov    %ebx,%r15d
+  8032a7:	0f 85 6c 02 00 00    	jne    803519 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032ad:	44 89 f0             	mov    %r14d,%eax
+  8032b0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032b3:	83 f8 04             	cmp    $0x4,%eax
+  8032b6:	0f 85 68 02 00 00    	jne    803524 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032bc:	44 89 e1             	mov    %r12d,%ecx
+  8032bf:	83 e1 01             	and    $0x1,%ecx
+  8032c2:	0f 95 c2             	setne  %dl
+  8032c5:	44 89 e0             	mov    %r12d,%eax
+  8032c8:	d1 e8                	shr    %eax
+  8032ca:	83 f0 01             	xor    $0x1,%eax
+  8032cd:	83 e0 01             	and    $0x1,%eax
+  8032d0:	38 c2                	cmp    %al,%dl
+  8032d2:	0f 85 57 02 00 00    	jne    80352f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032d8:	85 c9                	test   %ecx,%ecx
+  8032da:	74 0a                	je     8032e6 <mmap+0xc6>
+  8032dc:	41 f6 c6 02          	test   $0x2,%r14b
+  8032e0:	0f 85 54 02 00 00    	jne    80353a <mmap+0x31a>
+    file_flush_buffers();
+  8032e6:	48 b8 9b 2d 80 00 00 	movabs $0x802d9b,%rax
+  8032ed:	00 00 00 
+  8032f0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8032f2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8032f9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803300:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803304:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803307:	41 f6 c4 04          	test   $0x4,%r12b
+  80330b:	0f 84 15 01 00 00    	je     803426 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803311:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803314:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80331a:	0f 85 25 02 00 00    	jne    803545 <mmap+0x325>
+  803320:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803324:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80332b:	00 00 00 
+  80332e:	48 39 c2             	cmp    %rax,%rdx
+  803331:	0f 82 19 02 00 00    	jb     803550 <mmap+0x330>
+  803337:	48 39 c7             	cmp    %rax,%rdi
+  80333a:	0f 87 10 02 00 00    	ja     803550 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803340:	4c 89 ee             	mov    %r13,%rsi
+  803343:	48 b8 a3 30 80 00 00 	movabs $0x8030a3,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	0f 88 04 02 00 00    	js     80355b <mmap+0x33b>
+    if (!handler) {
+  803357:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80335e:	00 00 00 
+  803361:	80 38 00             	cmpb   $0x0,(%rax)
+  803364:	75 2b                	jne    803391 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803366:	48 bf 3b 21 80 00 00 	movabs $0x80213b,%rdi
+  80336d:	00 00 00 
+  803370:	48 b8 9f 42 80 00 00 	movabs $0x80429f,%rax
+  803377:	00 00 00 
+  80337a:	ff d0                	call   *%rax
+  80337c:	85 c0                	test   %eax,%eax
+  80337e:	0f 88 ea 01 00 00    	js     80356e <mmap+0x34e>
+        handler = 1;
+  803384:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80338b:	00 00 00 
+  80338e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803391:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803395:	48 b8 da 21 80 00 00 	movabs $0x8021da,%rax
+  80339c:	00 00 00 
+  80339f:	ff d0                	call   *%rax
+  8033a1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033a4:	48 85 c0             	test   %rax,%rax
+  8033a7:	0f 84 c9 01 00 00    	je     803576 <mmap+0x356>
+    m->mm_start = va;
+  8033ad:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033b0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033b8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033bb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033bf:	44 89 e0             	mov    %r12d,%eax
+  8033c2:	c1 e0 06             	shl    $0x6,%eax
+  8033c5:	25 80 00 00 00       	and    $0x80,%eax
+  8033ca:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033cd:	09 f0                	or     %esi,%eax
+  8033cf:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033d3:	41 f6 c4 08          	test   $0x8,%r12b
+  8033d7:	74 31                	je     80340a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033d9:	48 39 d3             	cmp    %rdx,%rbx
+  8033dc:	73 2c                	jae    80340a <mmap+0x1ea>
+  8033de:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8033e3:	48 89 de             	mov    %rbx,%rsi
+  8033e6:	4c 89 f7             	mov    %r14,%rdi
+  8033e9:	48 b8 2a 20 80 00 00 	movabs $0x80202a,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+  8033f5:	49 89 c4             	mov    %rax,%r12
+  8033f8:	48 85 c0             	test   %rax,%rax
+  8033fb:	0f 8e d7 00 00 00    	jle    8034d8 <mmap+0x2b8>
+            va += n;
+  803401:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803404:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803408:	72 d4                	jb     8033de <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80340a:	49 8b 06             	mov    (%r14),%rax
+  80340d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803411:	48 89 06             	mov    %rax,(%rsi)
+}
+  803414:	44 89 f8             	mov    %r15d,%eax
+  803417:	48 83 c4 28          	add    $0x28,%rsp
+  80341b:	5b                   	pop    %rbx
+  80341c:	41 5c                	pop    %r12
+  80341e:	41 5d                	pop    %r13
+  803420:	41 5e                	pop    %r14
+  803422:	41 5f                	pop    %r15
+  803424:	5d                   	pop    %rbp
+  803425:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803426:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80342d:	00 00 00 
+  803430:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803433:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80343a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80343d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803442:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803449:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80344c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803453:	00 00 00 
+  803456:	48 39 d7             	cmp    %rdx,%rdi
+  803459:	73 1c                	jae    803477 <mmap+0x257>
+        return -E_NO_MEM;
+  80345b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803461:	eb b1                	jmp    803414 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803463:	48 83 c0 01          	add    $0x1,%rax
+  803467:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80346b:	77 3f                	ja     8034ac <mmap+0x28c>
+  80346d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803472:	48 39 d7             	cmp    %rdx,%rdi
+  803475:	72 2a                	jb     8034a1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803477:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80347b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80347f:	48 39 d1             	cmp    %rdx,%rcx
+  803482:	73 df                	jae    803463 <mmap+0x243>
+  803484:	48 85 c9             	test   %rcx,%rcx
+  803487:	74 da                	je     803463 <mmap+0x243>
+  803489:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80348d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803492:	48 39 d3             	cmp    %rdx,%rbx
+  803495:	73 cc                	jae    803463 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803497:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80349a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80349f:	eb cc                	jmp    80346d <mmap+0x24d>
+        return -E_NO_MEM;
+  8034a1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034a7:	e9 68 ff ff ff       	jmp    803414 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034ac:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034b1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034b8:	00 00 00 
+  8034bb:	48 39 c2             	cmp    %rax,%rdx
+  8034be:	0f 82 9f 00 00 00    	jb     803563 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034c4:	48 85 db             	test   %rbx,%rbx
+  8034c7:	0f 85 8a fe ff ff    	jne    803357 <mmap+0x137>
+        return -E_NO_MEM;
+  8034cd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034d3:	e9 3c ff ff ff       	jmp    803414 <mmap+0x1f4>
+        if (n < 0) {
+  8034d8:	0f 89 2c ff ff ff    	jns    80340a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8034de:	49 8b 3e             	mov    (%r14),%rdi
+  8034e1:	4c 89 ee             	mov    %r13,%rsi
+  8034e4:	48 b8 a3 30 80 00 00 	movabs $0x8030a3,%rax
+  8034eb:	00 00 00 
+  8034ee:	ff d0                	call   *%rax
+            return n;
+  8034f0:	45 89 e7             	mov    %r12d,%r15d
+  8034f3:	e9 1c ff ff ff       	jmp    803414 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8034fe:	e9 11 ff ff ff       	jmp    803414 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803503:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803509:	e9 06 ff ff ff       	jmp    803414 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80350e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803514:	e9 fb fe ff ff       	jmp    803414 <mmap+0x1f4>
+  803519:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80351f:	e9 f0 fe ff ff       	jmp    803414 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803524:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80352a:	e9 e5 fe ff ff       	jmp    803414 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80352f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803535:	e9 da fe ff ff       	jmp    803414 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80353a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803540:	e9 cf fe ff ff       	jmp    803414 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803545:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80354b:	e9 c4 fe ff ff       	jmp    803414 <mmap+0x1f4>
+  803550:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803556:	e9 b9 fe ff ff       	jmp    803414 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80355b:	41 89 c7             	mov    %eax,%r15d
+  80355e:	e9 b1 fe ff ff       	jmp    803414 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803563:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803569:	e9 a6 fe ff ff       	jmp    803414 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80356e:	41 89 c7             	mov    %eax,%r15d
+  803571:	e9 9e fe ff ff       	jmp    803414 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803576:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80357c:	e9 93 fe ff ff       	jmp    803414 <mmap+0x1f4>
+
+0000000000803581 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803581:	55                   	push   %rbp
+  803582:	48 89 e5             	mov    %rsp,%rbp
+  803585:	41 54                	push   %r12
+  803587:	53                   	push   %rbx
+  803588:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80358b:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  803592:	00 00 00 
+  803595:	ff d0                	call   *%rax
+  803597:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80359a:	48 be 20 4d 80 00 00 	movabs $0x804d20,%rsi
+  8035a1:	00 00 00 
+  8035a4:	48 89 df             	mov    %rbx,%rdi
+  8035a7:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  8035ae:	00 00 00 
+  8035b1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035b3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035b8:	41 2b 04 24          	sub    (%r12),%eax
+  8035bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035c9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035cc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035d3:	00 00 00 
+  8035d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e2:	5b                   	pop    %rbx
+  8035e3:	41 5c                	pop    %r12
+  8035e5:	5d                   	pop    %rbp
+  8035e6:	c3                   	ret
+
+00000000008035e7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035e7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035ea:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8035f0:	8b 17                	mov    (%rdi),%edx
+  8035f2:	85 d2                	test   %edx,%edx
+  8035f4:	75 01                	jne    8035f7 <pipe_wakeup+0x10>
+  8035f6:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035f7:	55                   	push   %rbp
+  8035f8:	48 89 e5             	mov    %rsp,%rbp
+  8035fb:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8035fe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803604:	be 00 04 00 00       	mov    $0x400,%esi
+  803609:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  803610:	00 00 00 
+  803613:	ff d0                	call   *%rax
+}
+  803615:	5d                   	pop    %rbp
+  803616:	c3                   	ret
+
+0000000000803617 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803617:	55                   	push   %rbp
+  803618:	48 89 e5             	mov    %rsp,%rbp
+  80361b:	41 55                	push   %r13
+  80361d:	41 54                	push   %r12
+  80361f:	53                   	push   %rbx
+  803620:	48 83 ec 08          	sub    $0x8,%rsp
+  803624:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803627:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+  803633:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803636:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80363b:	4c 89 e6             	mov    %r12,%rsi
+  80363e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803643:	49 bc fa 10 80 00 00 	movabs $0x8010fa,%r12
+  80364a:	00 00 00 
+  80364d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803650:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803654:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803658:	49 bd e7 35 80 00 00 	movabs $0x8035e7,%r13
+  80365f:	00 00 00 
+  803662:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803665:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803669:	48 89 de             	mov    %rbx,%rsi
+  80366c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80366f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803674:	48 89 de             	mov    %rbx,%rsi
+  803677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80367c:	41 ff d4             	call   *%r12
+  80367f:	48 83 c4 08          	add    $0x8,%rsp
+  803683:	5b                   	pop    %rbx
+  803684:	41 5c                	pop    %r12
+  803686:	41 5d                	pop    %r13
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+
+000000000080368a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803691:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803696:	be 00 10 00 00       	mov    $0x1000,%esi
+  80369b:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  8036a2:	00 00 00 
+  8036a5:	ff d0                	call   *%rax
+  8036a7:	85 c0                	test   %eax,%eax
+  8036a9:	0f 94 c0             	sete   %al
+  8036ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8036af:	5d                   	pop    %rbp
+  8036b0:	c3                   	ret
+
+00000000008036b1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036b1:	55                   	push   %rbp
+  8036b2:	48 89 e5             	mov    %rsp,%rbp
+  8036b5:	41 57                	push   %r15
+  8036b7:	41 56                	push   %r14
+  8036b9:	41 55                	push   %r13
+  8036bb:	41 54                	push   %r12
+  8036bd:	53                   	push   %rbx
+  8036be:	48 83 ec 38          	sub    $0x38,%rsp
+  8036c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036c6:	49 89 f4             	mov    %rsi,%r12
+  8036c9:	49 89 d7             	mov    %rdx,%r15
+  8036cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036d0:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  8036d7:	00 00 00 
+  8036da:	ff d0                	call   *%rax
+  8036dc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036df:	4d 85 ff             	test   %r15,%r15
+  8036e2:	0f 84 f1 00 00 00    	je     8037d9 <devpipe_write+0x128>
+  8036e8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8036ec:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8036f0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8036f4:	49 bd 8a 36 80 00 00 	movabs $0x80368a,%r13
+  8036fb:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8036fe:	49 bf e7 35 80 00 00 	movabs $0x8035e7,%r15
+  803705:	00 00 00 
+  803708:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80370c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803710:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803714:	8b 73 04             	mov    0x4(%rbx),%esi
+  803717:	48 63 ce             	movslq %esi,%rcx
+  80371a:	48 63 03             	movslq (%rbx),%rax
+  80371d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803723:	48 39 c1             	cmp    %rax,%rcx
+  803726:	72 64                	jb     80378c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803728:	48 89 de             	mov    %rbx,%rsi
+  80372b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80372f:	41 ff d5             	call   *%r13
+  803732:	85 c0                	test   %eax,%eax
+  803734:	0f 85 b9 00 00 00    	jne    8037f3 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80373a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80373e:	4c 89 f7             	mov    %r14,%rdi
+  803741:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803744:	8b 43 04             	mov    0x4(%rbx),%eax
+  803747:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80374e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803755:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80375b:	8b 03                	mov    (%rbx),%eax
+  80375d:	41 39 c4             	cmp    %eax,%r12d
+  803760:	75 b2                	jne    803714 <devpipe_write+0x63>
+  803762:	48 89 de             	mov    %rbx,%rsi
+  803765:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803769:	41 ff d5             	call   *%r13
+  80376c:	85 c0                	test   %eax,%eax
+  80376e:	75 a0                	jne    803710 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803770:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803775:	44 89 e6             	mov    %r12d,%esi
+  803778:	48 89 df             	mov    %rbx,%rdi
+  80377b:	48 b8 c2 13 80 00 00 	movabs $0x8013c2,%rax
+  803782:	00 00 00 
+  803785:	ff d0                	call   *%rax
+  803787:	e9 7c ff ff ff       	jmp    803708 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80378c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803790:	41 0f b6 38          	movzbl (%r8),%edi
+  803794:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80379b:	80 80 80 
+  80379e:	48 89 c8             	mov    %rcx,%rax
+  8037a1:	48 f7 e2             	mul    %rdx
+  8037a4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037a8:	48 89 d0             	mov    %rdx,%rax
+  8037ab:	48 c1 e0 08          	shl    $0x8,%rax
+  8037af:	48 29 d0             	sub    %rdx,%rax
+  8037b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8037b6:	48 29 c1             	sub    %rax,%rcx
+  8037b9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037be:	83 c6 01             	add    $0x1,%esi
+  8037c1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037c4:	49 83 c0 01          	add    $0x1,%r8
+  8037c8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037cc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037d0:	49 39 c0             	cmp    %rax,%r8
+  8037d3:	0f 85 2f ff ff ff    	jne    803708 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037d9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037dd:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037e1:	48 b8 e7 35 80 00 00 	movabs $0x8035e7,%rax
+  8037e8:	00 00 00 
+  8037eb:	ff d0                	call   *%rax
+    return n;
+  8037ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8037f1:	eb 05                	jmp    8037f8 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037f8:	48 83 c4 38          	add    $0x38,%rsp
+  8037fc:	5b                   	pop    %rbx
+  8037fd:	41 5c                	pop    %r12
+  8037ff:	41 5d                	pop    %r13
+  803801:	41 5e                	pop    %r14
+  803803:	41 5f                	pop    %r15
+  803805:	5d                   	pop    %rbp
+  803806:	c3                   	ret
+
+0000000000803807 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803807:	55                   	push   %rbp
+  803808:	48 89 e5             	mov    %rsp,%rbp
+  80380b:	41 57                	push   %r15
+  80380d:	41 56                	push   %r14
+  80380f:	41 55                	push   %r13
+  803811:	41 54                	push   %r12
+  803813:	53                   	push   %rbx
+  803814:	48 83 ec 28          	sub    $0x28,%rsp
+  803818:	49 89 fd             	mov    %rdi,%r13
+  80381b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80381f:	49 89 d4             	mov    %rdx,%r12
+  803822:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803826:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  80382d:	00 00 00 
+  803830:	ff d0                	call   *%rax
+  803832:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803835:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80383b:	49 bf 8a 36 80 00 00 	movabs $0x80368a,%r15
+  803842:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803845:	4d 85 e4             	test   %r12,%r12
+  803848:	0f 84 d5 00 00 00    	je     803923 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80384e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803852:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803856:	8b 03                	mov    (%rbx),%eax
+  803858:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80385b:	75 7a                	jne    8038d7 <devpipe_read+0xd0>
+            if (i > 0) {
+  80385d:	4d 85 f6             	test   %r14,%r14
+  803860:	75 50                	jne    8038b2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803862:	48 89 de             	mov    %rbx,%rsi
+  803865:	4c 89 ef             	mov    %r13,%rdi
+  803868:	41 ff d7             	call   *%r15
+  80386b:	85 c0                	test   %eax,%eax
+  80386d:	0f 85 c9 00 00 00    	jne    80393c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803873:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803876:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80387d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803883:	8b 43 04             	mov    0x4(%rbx),%eax
+  803886:	41 39 c4             	cmp    %eax,%r12d
+  803889:	75 cb                	jne    803856 <devpipe_read+0x4f>
+  80388b:	48 89 de             	mov    %rbx,%rsi
+  80388e:	4c 89 ef             	mov    %r13,%rdi
+  803891:	41 ff d7             	call   *%r15
+  803894:	85 c0                	test   %eax,%eax
+  803896:	75 be                	jne    803856 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803898:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80389d:	44 89 e6             	mov    %r12d,%esi
+  8038a0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038a4:	48 b8 c2 13 80 00 00 	movabs $0x8013c2,%rax
+  8038ab:	00 00 00 
+  8038ae:	ff d0                	call   *%rax
+  8038b0:	eb a4                	jmp    803856 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038b2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038b6:	48 89 de             	mov    %rbx,%rsi
+  8038b9:	48 b8 e7 35 80 00 00 	movabs $0x8035e7,%rax
+  8038c0:	00 00 00 
+  8038c3:	ff d0                	call   *%rax
+                return i;
+  8038c5:	4c 89 f0             	mov    %r14,%rax
+}
+  8038c8:	48 83 c4 28          	add    $0x28,%rsp
+  8038cc:	5b                   	pop    %rbx
+  8038cd:	41 5c                	pop    %r12
+  8038cf:	41 5d                	pop    %r13
+  8038d1:	41 5e                	pop    %r14
+  8038d3:	41 5f                	pop    %r15
+  8038d5:	5d                   	pop    %rbp
+  8038d6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038d7:	48 63 c8             	movslq %eax,%rcx
+  8038da:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8038e1:	80 80 80 
+  8038e4:	48 89 c8             	mov    %rcx,%rax
+  8038e7:	48 f7 e2             	mul    %rdx
+  8038ea:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8038ee:	48 89 d0             	mov    %rdx,%rax
+  8038f1:	48 c1 e0 08          	shl    $0x8,%rax
+  8038f5:	48 29 d0             	sub    %rdx,%rax
+  8038f8:	48 c1 e0 04          	shl    $0x4,%rax
+  8038fc:	48 89 c2             	mov    %rax,%rdx
+  8038ff:	48 89 c8             	mov    %rcx,%rax
+  803902:	48 29 d0             	sub    %rdx,%rax
+  803905:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80390a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80390e:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803912:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803915:	49 83 c6 01          	add    $0x1,%r14
+  803919:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80391d:	0f 85 2b ff ff ff    	jne    80384e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803923:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803927:	48 89 de             	mov    %rbx,%rsi
+  80392a:	48 b8 e7 35 80 00 00 	movabs $0x8035e7,%rax
+  803931:	00 00 00 
+  803934:	ff d0                	call   *%rax
+    return n;
+  803936:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80393a:	eb 8c                	jmp    8038c8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80393c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803941:	eb 85                	jmp    8038c8 <devpipe_read+0xc1>
+
+0000000000803943 <pipe>:
+pipe(int pfd[2]) {
+  803943:	55                   	push   %rbp
+  803944:	48 89 e5             	mov    %rsp,%rbp
+  803947:	41 55                	push   %r13
+  803949:	41 54                	push   %r12
+  80394b:	53                   	push   %rbx
+  80394c:	48 83 ec 18          	sub    $0x18,%rsp
+  803950:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803953:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803957:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  80395e:	00 00 00 
+  803961:	ff d0                	call   *%rax
+  803963:	89 c3                	mov    %eax,%ebx
+  803965:	85 c0                	test   %eax,%eax
+  803967:	0f 88 a0 01 00 00    	js     803b0d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80396d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803972:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803977:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80397b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803980:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  803987:	00 00 00 
+  80398a:	ff d0                	call   *%rax
+  80398c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80398e:	85 c0                	test   %eax,%eax
+  803990:	0f 88 77 01 00 00    	js     803b0d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803996:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80399a:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  8039a1:	00 00 00 
+  8039a4:	ff d0                	call   *%rax
+  8039a6:	89 c3                	mov    %eax,%ebx
+  8039a8:	85 c0                	test   %eax,%eax
+  8039aa:	0f 88 43 01 00 00    	js     803af3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ba:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c3:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  8039ca:	00 00 00 
+  8039cd:	ff d0                	call   *%rax
+  8039cf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039d1:	85 c0                	test   %eax,%eax
+  8039d3:	0f 88 1a 01 00 00    	js     803af3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039dd:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  8039e4:	00 00 00 
+  8039e7:	ff d0                	call   *%rax
+  8039e9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039ec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039f6:	48 89 c6             	mov    %rax,%rsi
+  8039f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039fe:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  803a05:	00 00 00 
+  803a08:	ff d0                	call   *%rax
+  803a0a:	89 c3                	mov    %eax,%ebx
+  803a0c:	85 c0                	test   %eax,%eax
+  803a0e:	0f 88 c5 00 00 00    	js     803ad9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a14:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a18:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  803a1f:	00 00 00 
+  803a22:	ff d0                	call   *%rax
+  803a24:	48 89 c1             	mov    %rax,%rcx
+  803a27:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a2d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a33:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a38:	4c 89 ee             	mov    %r13,%rsi
+  803a3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a40:	48 b8 aa 10 80 00 00 	movabs $0x8010aa,%rax
+  803a47:	00 00 00 
+  803a4a:	ff d0                	call   *%rax
+  803a4c:	89 c3                	mov    %eax,%ebx
+  803a4e:	85 c0                	test   %eax,%eax
+  803a50:	78 6e                	js     803ac0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a52:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a57:	4c 89 ef             	mov    %r13,%rdi
+  803a5a:	48 b8 19 10 80 00 00 	movabs $0x801019,%rax
+  803a61:	00 00 00 
+  803a64:	ff d0                	call   *%rax
+  803a66:	83 f8 02             	cmp    $0x2,%eax
+  803a69:	0f 85 ab 00 00 00    	jne    803b1a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a6f:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a76:	00 00 
+  803a78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a7c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a7e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a89:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a8d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a9a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a9e:	48 bb 87 14 80 00 00 	movabs $0x801487,%rbx
+  803aa5:	00 00 00 
+  803aa8:	ff d3                	call   *%rbx
+  803aaa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803aae:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ab2:	ff d3                	call   *%rbx
+  803ab4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ab9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803abe:	eb 4d                	jmp    803b0d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ac0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ac5:	4c 89 ee             	mov    %r13,%rsi
+  803ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acd:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  803ad4:	00 00 00 
+  803ad7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ad9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ade:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ae2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae7:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  803aee:	00 00 00 
+  803af1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803af8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b01:	48 b8 fa 10 80 00 00 	movabs $0x8010fa,%rax
+  803b08:	00 00 00 
+  803b0b:	ff d0                	call   *%rax
+}
+  803b0d:	89 d8                	mov    %ebx,%eax
+  803b0f:	48 83 c4 18          	add    $0x18,%rsp
+  803b13:	5b                   	pop    %rbx
+  803b14:	41 5c                	pop    %r12
+  803b16:	41 5d                	pop    %r13
+  803b18:	5d                   	pop    %rbp
+  803b19:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b1a:	48 b9 50 4d 80 00 00 	movabs $0x804d50,%rcx
+  803b21:	00 00 00 
+  803b24:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  803b2b:	00 00 00 
+  803b2e:	be 50 00 00 00       	mov    $0x50,%esi
+  803b33:	48 bf 3c 4d 80 00 00 	movabs $0x804d3c,%rdi
+  803b3a:	00 00 00 
+  803b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b42:	49 b8 72 41 80 00 00 	movabs $0x804172,%r8
+  803b49:	00 00 00 
+  803b4c:	41 ff d0             	call   *%r8
+
+0000000000803b4f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b4f:	55                   	push   %rbp
+  803b50:	48 89 e5             	mov    %rsp,%rbp
+  803b53:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b5b:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b67:	85 c0                	test   %eax,%eax
+  803b69:	78 23                	js     803b8e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b6b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b6f:	48 b8 99 14 80 00 00 	movabs $0x801499,%rax
+  803b76:	00 00 00 
+  803b79:	ff d0                	call   *%rax
+  803b7b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b7e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b82:	48 b8 8a 36 80 00 00 	movabs $0x80368a,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+}
+  803b8e:	c9                   	leave
+  803b8f:	c3                   	ret
+
+0000000000803b90 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b90:	48 89 f8             	mov    %rdi,%rax
+  803b93:	48 c1 e8 27          	shr    $0x27,%rax
+  803b97:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803b9e:	01 00 00 
+  803ba1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ba5:	f6 c2 01             	test   $0x1,%dl
+  803ba8:	74 6d                	je     803c17 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803baa:	48 89 f8             	mov    %rdi,%rax
+  803bad:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bb1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bb8:	01 00 00 
+  803bbb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bbf:	f6 c2 01             	test   $0x1,%dl
+  803bc2:	74 62                	je     803c26 <get_uvpt_entry+0x96>
+  803bc4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bcb:	01 00 00 
+  803bce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bd2:	f6 c2 80             	test   $0x80,%dl
+  803bd5:	75 4f                	jne    803c26 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bd7:	48 89 f8             	mov    %rdi,%rax
+  803bda:	48 c1 e8 15          	shr    $0x15,%rax
+  803bde:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803be5:	01 00 00 
+  803be8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bec:	f6 c2 01             	test   $0x1,%dl
+  803bef:	74 44                	je     803c35 <get_uvpt_entry+0xa5>
+  803bf1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bf8:	01 00 00 
+  803bfb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bff:	f6 c2 80             	test   $0x80,%dl
+  803c02:	75 31                	jne    803c35 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c04:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c08:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c0f:	01 00 00 
+  803c12:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c16:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c17:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c1e:	01 00 00 
+  803c21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c25:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c26:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c2d:	01 00 00 
+  803c30:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c34:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c35:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c3c:	01 00 00 
+  803c3f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c43:	c3                   	ret
+
+0000000000803c44 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c44:	55                   	push   %rbp
+  803c45:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c48:	48 b8 90 3b 80 00 00 	movabs $0x803b90,%rax
+  803c4f:	00 00 00 
+  803c52:	ff d0                	call   *%rax
+  803c54:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c57:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c5c:	89 c1                	mov    %eax,%ecx
+  803c5e:	83 c9 04             	or     $0x4,%ecx
+  803c61:	f6 c2 01             	test   $0x1,%dl
+  803c64:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c67:	89 c1                	mov    %eax,%ecx
+  803c69:	83 c9 02             	or     $0x2,%ecx
+  803c6c:	f6 c2 02             	test   $0x2,%dl
+  803c6f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c72:	89 c1                	mov    %eax,%ecx
+  803c74:	83 c9 01             	or     $0x1,%ecx
+  803c77:	48 85 d2             	test   %rdx,%rdx
+  803c7a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c7d:	89 c1                	mov    %eax,%ecx
+  803c7f:	83 c9 40             	or     $0x40,%ecx
+  803c82:	f6 c6 04             	test   $0x4,%dh
+  803c85:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c88:	5d                   	pop    %rbp
+  803c89:	c3                   	ret
+
+0000000000803c8a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c8a:	55                   	push   %rbp
+  803c8b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c8e:	48 b8 90 3b 80 00 00 	movabs $0x803b90,%rax
+  803c95:	00 00 00 
+  803c98:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c9a:	48 c1 e8 06          	shr    $0x6,%rax
+  803c9e:	83 e0 01             	and    $0x1,%eax
+}
+  803ca1:	5d                   	pop    %rbp
+  803ca2:	c3                   	ret
+
+0000000000803ca3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ca3:	55                   	push   %rbp
+  803ca4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803ca7:	48 b8 90 3b 80 00 00 	movabs $0x803b90,%rax
+  803cae:	00 00 00 
+  803cb1:	ff d0                	call   *%rax
+  803cb3:	83 e0 01             	and    $0x1,%eax
+}
+  803cb6:	5d                   	pop    %rbp
+  803cb7:	c3                   	ret
+
+0000000000803cb8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803cb8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803cbf:	01 00 00 
+  803cc2:	a8 01                	test   $0x1,%al
+  803cc4:	75 06                	jne    803ccc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ccb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ccc:	55                   	push   %rbp
+  803ccd:	48 89 e5             	mov    %rsp,%rbp
+  803cd0:	41 57                	push   %r15
+  803cd2:	41 56                	push   %r14
+  803cd4:	41 55                	push   %r13
+  803cd6:	41 54                	push   %r12
+  803cd8:	53                   	push   %rbx
+  803cd9:	48 83 ec 28          	sub    $0x28,%rsp
+  803cdd:	49 89 fe             	mov    %rdi,%r14
+  803ce0:	49 89 f7             	mov    %rsi,%r15
+  803ce3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803cea:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803ceb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803cf2:	01 00 00 
+  803cf5:	e9 ae 00 00 00       	jmp    803da8 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803cfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d01:	49 83 ec 01          	sub    $0x1,%r12
+  803d05:	74 2d                	je     803d34 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d07:	48 89 d8             	mov    %rbx,%rax
+  803d0a:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d0e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d13:	f6 c2 01             	test   $0x1,%dl
+  803d16:	74 e2                	je     803cfa <foreach_shared_region+0x42>
+  803d18:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d1d:	f6 c4 04             	test   $0x4,%ah
+  803d20:	74 d8                	je     803cfa <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d22:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d29:	4c 89 fa             	mov    %r15,%rdx
+  803d2c:	48 89 df             	mov    %rbx,%rdi
+  803d2f:	41 ff d6             	call   *%r14
+  803d32:	eb c6                	jmp    803cfa <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d34:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d3b:	00 
+  803d3c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d41:	74 4a                	je     803d8d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d47:	48 c1 e8 15          	shr    $0x15,%rax
+  803d4b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d52:	01 00 00 
+  803d55:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d59:	a8 01                	test   $0x1,%al
+  803d5b:	74 d7                	je     803d34 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d5d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d61:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d68:	48 39 c3             	cmp    %rax,%rbx
+  803d6b:	73 c7                	jae    803d34 <foreach_shared_region+0x7c>
+  803d6d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d74:	48 39 d0             	cmp    %rdx,%rax
+  803d77:	4d 19 e4             	sbb    %r12,%r12
+  803d7a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d81:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d88:	e9 7a ff ff ff       	jmp    803d07 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803d8d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803d94:	40 
+  803d95:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d99:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803da0:	00 00 00 
+  803da3:	48 39 c1             	cmp    %rax,%rcx
+  803da6:	74 50                	je     803df8 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803da8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803dac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803db0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803db7:	01 00 00 
+  803dba:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803dbe:	a8 01                	test   $0x1,%al
+  803dc0:	74 cb                	je     803d8d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dc2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dc6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803dcd:	48 39 c1             	cmp    %rax,%rcx
+  803dd0:	73 bb                	jae    803d8d <foreach_shared_region+0xd5>
+  803dd2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803dd9:	48 39 d0             	cmp    %rdx,%rax
+  803ddc:	48 19 c0             	sbb    %rax,%rax
+  803ddf:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803de5:	48 05 00 02 00 00    	add    $0x200,%rax
+  803deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803def:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803df3:	e9 4b ff ff ff       	jmp    803d43 <foreach_shared_region+0x8b>
+  803df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803dfd:	48 83 c4 28          	add    $0x28,%rsp
+  803e01:	5b                   	pop    %rbx
+  803e02:	41 5c                	pop    %r12
+  803e04:	41 5d                	pop    %r13
+  803e06:	41 5e                	pop    %r14
+  803e08:	41 5f                	pop    %r15
+  803e0a:	5d                   	pop    %rbp
+  803e0b:	c3                   	ret
+
+0000000000803e0c <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e0c:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e12:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e19:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e20:	c3                   	ret
+
+0000000000803e21 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e21:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e24:	8b 17                	mov    (%rdi),%edx
+  803e26:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e28:	83 f8 0f             	cmp    $0xf,%eax
+  803e2b:	77 13                	ja     803e40 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e2d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e30:	83 e0 0f             	and    $0xf,%eax
+  803e33:	48 c1 e0 09          	shl    $0x9,%rax
+  803e37:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e3e:	00 
+  803e3f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e45:	c3                   	ret
+
+0000000000803e46 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e46:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e49:	83 c0 01             	add    $0x1,%eax
+  803e4c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e4f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e55:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e5d:	85 d2                	test   %edx,%edx
+  803e5f:	75 04                	jne    803e65 <chan_publish+0x1f>
+  803e61:	83 e0 01             	and    $0x1,%eax
+}
+  803e64:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e65:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e68:	85 c0                	test   %eax,%eax
+  803e6a:	0f 95 c0             	setne  %al
+  803e6d:	0f b6 c0             	movzbl %al,%eax
+  803e70:	eb ef                	jmp    803e61 <chan_publish+0x1b>
+
+0000000000803e72 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e72:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e75:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e77:	29 d0                	sub    %edx,%eax
+  803e79:	83 e8 01             	sub    $0x1,%eax
+  803e7c:	83 f8 0f             	cmp    $0xf,%eax
+  803e7f:	77 12                	ja     803e93 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803e81:	8b 07                	mov    (%rdi),%eax
+  803e83:	83 e0 0f             	and    $0xf,%eax
+  803e86:	48 c1 e0 09          	shl    $0x9,%rax
+  803e8a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e91:	00 
+  803e92:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e98:	c3                   	ret
+
+0000000000803e99 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803e99:	8b 07                	mov    (%rdi),%eax
+  803e9b:	83 c0 01             	add    $0x1,%eax
+  803e9e:	89 07                	mov    %eax,(%rdi)
+}
+  803ea0:	c3                   	ret
+
+0000000000803ea1 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803ea1:	55                   	push   %rbp
+  803ea2:	48 89 e5             	mov    %rsp,%rbp
+  803ea5:	53                   	push   %rbx
+  803ea6:	48 83 ec 08          	sub    $0x8,%rsp
+  803eaa:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803ead:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803eb4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803eba:	48 b8 72 3e 80 00 00 	movabs $0x803e72,%rax
+  803ec1:	00 00 00 
+  803ec4:	ff d0                	call   *%rax
+  803ec6:	48 85 c0             	test   %rax,%rax
+  803ec9:	74 12                	je     803edd <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803ecb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803edb:	c9                   	leave
+  803edc:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803edd:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ee2:	eb f3                	jmp    803ed7 <chan_arm+0x36>
+
+0000000000803ee4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803ee4:	55                   	push   %rbp
+  803ee5:	48 89 e5             	mov    %rsp,%rbp
+  803ee8:	41 56                	push   %r14
+  803eea:	41 55                	push   %r13
+  803eec:	41 54                	push   %r12
+  803eee:	53                   	push   %rbx
+  803eef:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803ef2:	49 bc a1 3e 80 00 00 	movabs $0x803ea1,%r12
+  803ef9:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803efc:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f00:	49 bd c2 13 80 00 00 	movabs $0x8013c2,%r13
+  803f07:	00 00 00 
+    while (chan_arm(r))
+  803f0a:	eb 0d                	jmp    803f19 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f0c:	8b 33                	mov    (%rbx),%esi
+  803f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f13:	4c 89 f7             	mov    %r14,%rdi
+  803f16:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f19:	48 89 df             	mov    %rbx,%rdi
+  803f1c:	41 ff d4             	call   *%r12
+  803f1f:	84 c0                	test   %al,%al
+  803f21:	75 e9                	jne    803f0c <chan_wait+0x28>
+}
+  803f23:	5b                   	pop    %rbx
+  803f24:	41 5c                	pop    %r12
+  803f26:	41 5d                	pop    %r13
+  803f28:	41 5e                	pop    %r14
+  803f2a:	5d                   	pop    %rbp
+  803f2b:	c3                   	ret
+
+0000000000803f2c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f2c:	55                   	push   %rbp
+  803f2d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f30:	48 83 c7 40          	add    $0x40,%rdi
+  803f34:	be 01 00 00 00       	mov    $0x1,%esi
+  803f39:	48 b8 e0 13 80 00 00 	movabs $0x8013e0,%rax
+  803f40:	00 00 00 
+  803f43:	ff d0                	call   *%rax
+}
+  803f45:	5d                   	pop    %rbp
+  803f46:	c3                   	ret
+
+0000000000803f47 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f4c:	c3                   	ret
+
+0000000000803f4d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f4d:	55                   	push   %rbp
+  803f4e:	48 89 e5             	mov    %rsp,%rbp
+  803f51:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f54:	48 be 74 4d 80 00 00 	movabs $0x804d74,%rsi
+  803f5b:	00 00 00 
+  803f5e:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  803f65:	00 00 00 
+  803f68:	ff d0                	call   *%rax
+    return 0;
+}
+  803f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6f:	5d                   	pop    %rbp
+  803f70:	c3                   	ret
+
+0000000000803f71 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f71:	55                   	push   %rbp
+  803f72:	48 89 e5             	mov    %rsp,%rbp
+  803f75:	41 57                	push   %r15
+  803f77:	41 56                	push   %r14
+  803f79:	41 55                	push   %r13
+  803f7b:	41 54                	push   %r12
+  803f7d:	53                   	push   %rbx
+  803f7e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f85:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f8c:	48 85 d2             	test   %rdx,%rdx
+  803f8f:	74 7a                	je     80400b <devcons_write+0x9a>
+  803f91:	49 89 d6             	mov    %rdx,%r14
+  803f94:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f9a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803f9f:	49 bf ef 0c 80 00 00 	movabs $0x800cef,%r15
+  803fa6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fa9:	4c 89 f3             	mov    %r14,%rbx
+  803fac:	48 29 f3             	sub    %rsi,%rbx
+  803faf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fb4:	48 39 c3             	cmp    %rax,%rbx
+  803fb7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fbb:	4c 63 eb             	movslq %ebx,%r13
+  803fbe:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fc5:	48 01 c6             	add    %rax,%rsi
+  803fc8:	4c 89 ea             	mov    %r13,%rdx
+  803fcb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fd2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fd5:	4c 89 ee             	mov    %r13,%rsi
+  803fd8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fdf:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  803fe6:	00 00 00 
+  803fe9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803feb:	41 01 dc             	add    %ebx,%r12d
+  803fee:	49 63 f4             	movslq %r12d,%rsi
+  803ff1:	4c 39 f6             	cmp    %r14,%rsi
+  803ff4:	72 b3                	jb     803fa9 <devcons_write+0x38>
+    return res;
+  803ff6:	49 63 c4             	movslq %r12d,%rax
+}
+  803ff9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804000:	5b                   	pop    %rbx
+  804001:	41 5c                	pop    %r12
+  804003:	41 5d                	pop    %r13
+  804005:	41 5e                	pop    %r14
+  804007:	41 5f                	pop    %r15
+  804009:	5d                   	pop    %rbp
+  80400a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80400b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804011:	eb e3                	jmp    803ff6 <devcons_write+0x85>
+
+0000000000804013 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804013:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80401b:	48 85 c0             	test   %rax,%rax
+  80401e:	74 55                	je     804075 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804020:	55                   	push   %rbp
+  804021:	48 89 e5             	mov    %rsp,%rbp
+  804024:	41 55                	push   %r13
+  804026:	41 54                	push   %r12
+  804028:	53                   	push   %rbx
+  804029:	48 83 ec 08          	sub    $0x8,%rsp
+  80402d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804030:	48 bb 3b 0f 80 00 00 	movabs $0x800f3b,%rbx
+  804037:	00 00 00 
+  80403a:	49 bc f0 0f 80 00 00 	movabs $0x800ff0,%r12
+  804041:	00 00 00 
+  804044:	eb 03                	jmp    804049 <devcons_read+0x36>
+  804046:	41 ff d4             	call   *%r12
+  804049:	ff d3                	call   *%rbx
+  80404b:	85 c0                	test   %eax,%eax
+  80404d:	74 f7                	je     804046 <devcons_read+0x33>
+    if (c < 0) return c;
+  80404f:	48 63 d0             	movslq %eax,%rdx
+  804052:	78 13                	js     804067 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804054:	ba 00 00 00 00       	mov    $0x0,%edx
+  804059:	83 f8 04             	cmp    $0x4,%eax
+  80405c:	74 09                	je     804067 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80405e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804062:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804067:	48 89 d0             	mov    %rdx,%rax
+  80406a:	48 83 c4 08          	add    $0x8,%rsp
+  80406e:	5b                   	pop    %rbx
+  80406f:	41 5c                	pop    %r12
+  804071:	41 5d                	pop    %r13
+  804073:	5d                   	pop    %rbp
+  804074:	c3                   	ret
+  804075:	48 89 d0             	mov    %rdx,%rax
+  804078:	c3                   	ret
+
+0000000000804079 <cputchar>:
+cputchar(int ch) {
+  804079:	55                   	push   %rbp
+  80407a:	48 89 e5             	mov    %rsp,%rbp
+  80407d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804081:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804085:	be 01 00 00 00       	mov    $0x1,%esi
+  80408a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80408e:	48 b8 1c 0f 80 00 00 	movabs $0x800f1c,%rax
+  804095:	00 00 00 
+  804098:	ff d0                	call   *%rax
+}
+  80409a:	c9                   	leave
+  80409b:	c3                   	ret
+
+000000000080409c <getchar>:
+getchar(void) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040a9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b2:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  8040b9:	00 00 00 
+  8040bc:	ff d0                	call   *%rax
+  8040be:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040c0:	85 c0                	test   %eax,%eax
+  8040c2:	78 06                	js     8040ca <getchar+0x2e>
+  8040c4:	74 08                	je     8040ce <getchar+0x32>
+  8040c6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040ca:	89 d0                	mov    %edx,%eax
+  8040cc:	c9                   	leave
+  8040cd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040ce:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040d3:	eb f5                	jmp    8040ca <getchar+0x2e>
+
+00000000008040d5 <iscons>:
+iscons(int fdnum) {
+  8040d5:	55                   	push   %rbp
+  8040d6:	48 89 e5             	mov    %rsp,%rbp
+  8040d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040e1:	48 b8 15 15 80 00 00 	movabs $0x801515,%rax
+  8040e8:	00 00 00 
+  8040eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040ed:	85 c0                	test   %eax,%eax
+  8040ef:	78 18                	js     804109 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8040f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040f5:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8040fc:	00 00 00 
+  8040ff:	8b 00                	mov    (%rax),%eax
+  804101:	39 02                	cmp    %eax,(%rdx)
+  804103:	0f 94 c0             	sete   %al
+  804106:	0f b6 c0             	movzbl %al,%eax
+}
+  804109:	c9                   	leave
+  80410a:	c3                   	ret
+
+000000000080410b <opencons>:
+opencons(void) {
+  80410b:	55                   	push   %rbp
+  80410c:	48 89 e5             	mov    %rsp,%rbp
+  80410f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804113:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804117:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	85 c0                	test   %eax,%eax
+  804125:	78 49                	js     804170 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804127:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80412c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804131:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413a:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+  804146:	85 c0                	test   %eax,%eax
+  804148:	78 26                	js     804170 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80414a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80414e:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804155:	00 00 
+  804157:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804159:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80415d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804164:	48 b8 87 14 80 00 00 	movabs $0x801487,%rax
+  80416b:	00 00 00 
+  80416e:	ff d0                	call   *%rax
+}
+  804170:	c9                   	leave
+  804171:	c3                   	ret
+
+0000000000804172 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+  804176:	41 56                	push   %r14
+  804178:	41 55                	push   %r13
+  80417a:	41 54                	push   %r12
+  80417c:	53                   	push   %rbx
+  80417d:	48 83 ec 50          	sub    $0x50,%rsp
+  804181:	49 89 fc             	mov    %rdi,%r12
+  804184:	41 89 f5             	mov    %esi,%r13d
+  804187:	48 89 d3             	mov    %rdx,%rbx
+  80418a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80418e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804192:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804196:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80419d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041a1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041a5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041a9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041ad:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041b4:	00 00 00 
+  8041b7:	4c 8b 30             	mov    (%rax),%r14
+  8041ba:	48 b8 c7 0f 80 00 00 	movabs $0x800fc7,%rax
+  8041c1:	00 00 00 
+  8041c4:	ff d0                	call   *%rax
+  8041c6:	89 c6                	mov    %eax,%esi
+  8041c8:	45 89 e8             	mov    %r13d,%r8d
+  8041cb:	4c 89 e1             	mov    %r12,%rcx
+  8041ce:	4c 89 f2             	mov    %r14,%rdx
+  8041d1:	48 bf 80 4d 80 00 00 	movabs $0x804d80,%rdi
+  8041d8:	00 00 00 
+  8041db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e0:	49 bc d0 01 80 00 00 	movabs $0x8001d0,%r12
+  8041e7:	00 00 00 
+  8041ea:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8041ed:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8041f1:	48 89 df             	mov    %rbx,%rdi
+  8041f4:	48 b8 6c 01 80 00 00 	movabs $0x80016c,%rax
+  8041fb:	00 00 00 
+  8041fe:	ff d0                	call   *%rax
+    cprintf("\n");
+  804200:	48 bf cc 46 80 00 00 	movabs $0x8046cc,%rdi
+  804207:	00 00 00 
+  80420a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80420f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804212:	cc                   	int3
+  804213:	eb fd                	jmp    804212 <_panic+0xa0>
+
+0000000000804215 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804215:	55                   	push   %rbp
+  804216:	48 89 e5             	mov    %rsp,%rbp
+  804219:	41 56                	push   %r14
+  80421b:	41 55                	push   %r13
+  80421d:	41 54                	push   %r12
+  80421f:	53                   	push   %rbx
+  804220:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804223:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80422a:	00 00 00 
+  80422d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804231:	74 27                	je     80425a <_handle_vectored_pagefault+0x45>
+  804233:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804238:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80423f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804242:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804245:	4c 89 e7             	mov    %r12,%rdi
+  804248:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80424d:	84 c0                	test   %al,%al
+  80424f:	75 45                	jne    804296 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804251:	48 83 c3 01          	add    $0x1,%rbx
+  804255:	49 3b 1e             	cmp    (%r14),%rbx
+  804258:	72 eb                	jb     804245 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80425a:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804261:	00 
+  804262:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804267:	4d 8b 04 24          	mov    (%r12),%r8
+  80426b:	48 ba a8 4d 80 00 00 	movabs $0x804da8,%rdx
+  804272:	00 00 00 
+  804275:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80427a:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804281:	00 00 00 
+  804284:	b8 00 00 00 00       	mov    $0x0,%eax
+  804289:	49 ba 72 41 80 00 00 	movabs $0x804172,%r10
+  804290:	00 00 00 
+  804293:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804296:	5b                   	pop    %rbx
+  804297:	41 5c                	pop    %r12
+  804299:	41 5d                	pop    %r13
+  80429b:	41 5e                	pop    %r14
+  80429d:	5d                   	pop    %rbp
+  80429e:	c3                   	ret
+
+000000000080429f <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80429f:	55                   	push   %rbp
+  8042a0:	48 89 e5             	mov    %rsp,%rbp
+  8042a3:	53                   	push   %rbx
+  8042a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8042a8:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042ab:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042b2:	00 00 00 
+  8042b5:	80 38 00             	cmpb   $0x0,(%rax)
+  8042b8:	0f 84 84 00 00 00    	je     804342 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042be:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042c5:	00 00 00 
+  8042c8:	48 8b 10             	mov    (%rax),%rdx
+  8042cb:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042d0:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042d7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042da:	48 85 d2             	test   %rdx,%rdx
+  8042dd:	74 19                	je     8042f8 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042df:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042e3:	0f 84 e8 00 00 00    	je     8043d1 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e9:	48 83 c0 01          	add    $0x1,%rax
+  8042ed:	48 39 d0             	cmp    %rdx,%rax
+  8042f0:	75 ed                	jne    8042df <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042f2:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042f6:	74 1c                	je     804314 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042f8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042fc:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804303:	00 00 00 
+  804306:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80430d:	00 00 00 
+  804310:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804314:	48 b8 c7 0f 80 00 00 	movabs $0x800fc7,%rax
+  80431b:	00 00 00 
+  80431e:	ff d0                	call   *%rax
+  804320:	89 c7                	mov    %eax,%edi
+  804322:	48 be 97 44 80 00 00 	movabs $0x804497,%rsi
+  804329:	00 00 00 
+  80432c:	48 b8 12 12 80 00 00 	movabs $0x801212,%rax
+  804333:	00 00 00 
+  804336:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804338:	85 c0                	test   %eax,%eax
+  80433a:	78 68                	js     8043a4 <add_pgfault_handler+0x105>
+    return res;
+}
+  80433c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804340:	c9                   	leave
+  804341:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804342:	48 b8 c7 0f 80 00 00 	movabs $0x800fc7,%rax
+  804349:	00 00 00 
+  80434c:	ff d0                	call   *%rax
+  80434e:	89 c7                	mov    %eax,%edi
+  804350:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804355:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80435a:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804361:	00 00 00 
+  804364:	48 b8 54 10 80 00 00 	movabs $0x801054,%rax
+  80436b:	00 00 00 
+  80436e:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804370:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804377:	00 00 00 
+  80437a:	48 8b 02             	mov    (%rdx),%rax
+  80437d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804381:	48 89 0a             	mov    %rcx,(%rdx)
+  804384:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80438b:	00 00 00 
+  80438e:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804392:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804399:	00 00 00 
+  80439c:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80439f:	e9 70 ff ff ff       	jmp    804314 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043a4:	89 c1                	mov    %eax,%ecx
+  8043a6:	48 ba e6 4d 80 00 00 	movabs $0x804de6,%rdx
+  8043ad:	00 00 00 
+  8043b0:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043b5:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  8043bc:	00 00 00 
+  8043bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c4:	49 b8 72 41 80 00 00 	movabs $0x804172,%r8
+  8043cb:	00 00 00 
+  8043ce:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d6:	e9 61 ff ff ff       	jmp    80433c <add_pgfault_handler+0x9d>
+
+00000000008043db <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043db:	55                   	push   %rbp
+  8043dc:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043df:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043e6:	00 00 00 
+  8043e9:	80 38 00             	cmpb   $0x0,(%rax)
+  8043ec:	74 33                	je     804421 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043ee:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043f5:	00 00 00 
+  8043f8:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043fd:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804404:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804407:	48 85 c0             	test   %rax,%rax
+  80440a:	0f 84 85 00 00 00    	je     804495 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804410:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804414:	74 40                	je     804456 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804416:	48 83 c1 01          	add    $0x1,%rcx
+  80441a:	48 39 c1             	cmp    %rax,%rcx
+  80441d:	75 f1                	jne    804410 <remove_pgfault_handler+0x35>
+  80441f:	eb 74                	jmp    804495 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804421:	48 b9 fe 4d 80 00 00 	movabs $0x804dfe,%rcx
+  804428:	00 00 00 
+  80442b:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  804432:	00 00 00 
+  804435:	be 43 00 00 00       	mov    $0x43,%esi
+  80443a:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804441:	00 00 00 
+  804444:	b8 00 00 00 00       	mov    $0x0,%eax
+  804449:	49 b8 72 41 80 00 00 	movabs $0x804172,%r8
+  804450:	00 00 00 
+  804453:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804456:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80445d:	00 
+  80445e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804462:	48 29 ca             	sub    %rcx,%rdx
+  804465:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80446c:	00 00 00 
+  80446f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804473:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804478:	48 89 ce             	mov    %rcx,%rsi
+  80447b:	48 b8 ef 0c 80 00 00 	movabs $0x800cef,%rax
+  804482:	00 00 00 
+  804485:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804487:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80448e:	00 00 00 
+  804491:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804495:	5d                   	pop    %rbp
+  804496:	c3                   	ret
+
+0000000000804497 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804497:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80449a:	48 b8 15 42 80 00 00 	movabs $0x804215,%rax
+  8044a1:	00 00 00 
+    call *%rax
+  8044a4:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044a6:	41 5f                	pop    %r15
+	popq %r15
+  8044a8:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044aa:	41 5f                	pop    %r15
+	popq %r14
+  8044ac:	41 5e                	pop    %r14
+	popq %r13
+  8044ae:	41 5d                	pop    %r13
+	popq %r12
+  8044b0:	41 5c                	pop    %r12
+	popq %r11
+  8044b2:	41 5b                	pop    %r11
+	popq %r10
+  8044b4:	41 5a                	pop    %r10
+	popq %r9
+  8044b6:	41 59                	pop    %r9
+	popq %r8
+  8044b8:	41 58                	pop    %r8
+	popq %rsi
+  8044ba:	5e                   	pop    %rsi
+	popq %rdi
+  8044bb:	5f                   	pop    %rdi
+	popq %rbp
+  8044bc:	5d                   	pop    %rbp
+	popq %rdx
+  8044bd:	5a                   	pop    %rdx
+	popq %rcx
+  8044be:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044bf:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044c4:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044c9:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044cd:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044d0:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044d5:	5b                   	pop    %rbx
+	popq %rax
+  8044d6:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044d7:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044db:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044dc:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044e1:	c3                   	ret
+
+00000000008044e2 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044e2:	55                   	push   %rbp
+  8044e3:	48 89 e5             	mov    %rsp,%rbp
+  8044e6:	41 55                	push   %r13
+  8044e8:	41 54                	push   %r12
+  8044ea:	53                   	push   %rbx
+  8044eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ef:	49 89 fd             	mov    %rdi,%r13
+  8044f2:	48 89 f7             	mov    %rsi,%rdi
+  8044f5:	48 89 d3             	mov    %rdx,%rbx
+  8044f8:	49 89 cc             	mov    %rcx,%r12
+  8044fb:	4c 89 c2             	mov    %r8,%rdx
+  8044fe:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804501:	48 85 f6             	test   %rsi,%rsi
+  804504:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80450b:	00 00 00 
+  80450e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804512:	be 00 10 00 00       	mov    $0x1000,%esi
+  804517:	48 85 db             	test   %rbx,%rbx
+  80451a:	74 03                	je     80451f <ipc_recv_futex+0x3d>
+  80451c:	48 8b 33             	mov    (%rbx),%rsi
+  80451f:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804523:	48 b8 9e 12 80 00 00 	movabs $0x80129e,%rax
+  80452a:	00 00 00 
+  80452d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80452f:	85 c0                	test   %eax,%eax
+  804531:	78 75                	js     8045a8 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804533:	4d 85 ed             	test   %r13,%r13
+  804536:	74 14                	je     80454c <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804538:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80453f:	00 00 00 
+  804542:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804548:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80454c:	4d 85 e4             	test   %r12,%r12
+  80454f:	74 14                	je     804565 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804551:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804558:	00 00 00 
+  80455b:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804561:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804565:	48 85 db             	test   %rbx,%rbx
+  804568:	74 23                	je     80458d <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80456a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804571:	00 00 00 
+  804574:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80457a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80457f:	85 c9                	test   %ecx,%ecx
+  804581:	74 07                	je     80458a <ipc_recv_futex+0xa8>
+  804583:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80458a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80458d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804594:	00 00 00 
+  804597:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80459d:	48 83 c4 08          	add    $0x8,%rsp
+  8045a1:	5b                   	pop    %rbx
+  8045a2:	41 5c                	pop    %r12
+  8045a4:	41 5d                	pop    %r13
+  8045a6:	5d                   	pop    %rbp
+  8045a7:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045a8:	4d 85 ed             	test   %r13,%r13
+  8045ab:	74 08                	je     8045b5 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045ad:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b4:	00 
+        if (perm_store != NULL) {
+  8045b5:	4d 85 e4             	test   %r12,%r12
+  8045b8:	74 08                	je     8045c2 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045ba:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045c1:	00 
+        if (size != NULL) {
+  8045c2:	48 85 db             	test   %rbx,%rbx
+  8045c5:	74 d6                	je     80459d <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045c7:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045ce:	eb cd                	jmp    80459d <ipc_recv_futex+0xbb>
+
+00000000008045d0 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045d0:	55                   	push   %rbp
+  8045d1:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8045d8:	6a 00                	push   $0x0
+  8045da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045e6:	48 b8 e2 44 80 00 00 	movabs $0x8044e2,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+}
+  8045f2:	c9                   	leave
+  8045f3:	c3                   	ret
+
+00000000008045f4 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f4:	55                   	push   %rbp
+  8045f5:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045f8:	48 85 d2             	test   %rdx,%rdx
+  8045fb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804602:	00 00 00 
+  804605:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804609:	89 f6                	mov    %esi,%esi
+  80460b:	48 b8 87 12 80 00 00 	movabs $0x801287,%rax
+  804612:	00 00 00 
+  804615:	ff d0                	call   *%rax
+    if (res < 0) {
+  804617:	85 c0                	test   %eax,%eax
+  804619:	78 02                	js     80461d <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80461b:	5d                   	pop    %rbp
+  80461c:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  80461d:	89 c1                	mov    %eax,%ecx
+  80461f:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  804626:	00 00 00 
+  804629:	be 50 00 00 00       	mov    $0x50,%esi
+  80462e:	48 bf 2c 4e 80 00 00 	movabs $0x804e2c,%rdi
+  804635:	00 00 00 
+  804638:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463d:	49 b8 72 41 80 00 00 	movabs $0x804172,%r8
+  804644:	00 00 00 
+  804647:	41 ff d0             	call   *%r8
+
+000000000080464a <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80464a:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80464f:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804656:	00 00 00 
+  804659:	48 89 d0             	mov    %rdx,%rax
+  80465c:	48 c1 e0 04          	shl    $0x4,%rax
+  804660:	48 29 d0             	sub    %rdx,%rax
+  804663:	48 c1 e0 05          	shl    $0x5,%rax
+  804667:	48 01 c8             	add    %rcx,%rax
+  80466a:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804670:	39 f8                	cmp    %edi,%eax
+  804672:	74 13                	je     804687 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804674:	48 83 c2 01          	add    $0x1,%rdx
+  804678:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80467f:	75 d8                	jne    804659 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804681:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804686:	c3                   	ret
+            return envs[i].env_id;
+  804687:	48 89 d0             	mov    %rdx,%rax
+  80468a:	48 c1 e0 04          	shl    $0x4,%rax
+  80468e:	48 29 d0             	sub    %rdx,%rax
+  804691:	48 c1 e0 05          	shl    $0x5,%rax
+  804695:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80469c:	00 00 00 
+  80469f:	48 01 d0             	add    %rdx,%rax
+  8046a2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046a8:	c3                   	ret
+  8046a9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+00000000008046b0 <__rodata_start>:
+  8046b0:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  8046b4:	61                   	(bad)
+  8046b5:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f87eec <__bss_end+0x20745eec>
+  8046bc:	66 72 6f             	data16 jb 80472e <__rodata_start+0x7e>
+  8046bf:	6d                   	insl   (%dx),%es:(%rdi)
+  8046c0:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  8046c4:	61                   	(bad)
+  8046c5:	74 69                	je     804730 <__rodata_start+0x80>
+  8046c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046c9:	20 30                	and    %dh,(%rax)
+  8046cb:	21 0a                	and    %ecx,(%rdx)
+  8046cd:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8046d4:	77 6e                	ja     804744 <__rodata_start+0x94>
+  8046d6:	3e 00 30             	ds add %dh,(%rax)
+  8046d9:	31 32                	xor    %esi,(%rdx)
+  8046db:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046e2:	41                   	rex.B
+  8046e3:	42                   	rex.X
+  8046e4:	43                   	rex.XB
+  8046e5:	44                   	rex.R
+  8046e6:	45                   	rex.RB
+  8046e7:	46 00 30             	rex.RX add %r14b,(%rax)
+  8046ea:	31 32                	xor    %esi,(%rdx)
+  8046ec:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046f3:	61                   	(bad)
+  8046f4:	62 63 64 65 66       	(bad)
+  8046f9:	00 28                	add    %ch,(%rax)
+  8046fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046fc:	75 6c                	jne    80476a <__rodata_start+0xba>
+  8046fe:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ff:	29 00                	sub    %eax,(%rax)
+  804701:	65 72 72             	gs jb  804776 <__rodata_start+0xc6>
+  804704:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804705:	72 20                	jb     804727 <__rodata_start+0x77>
+  804707:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80470c:	73 70                	jae    80477e <__rodata_start+0xce>
+  80470e:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804712:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804719:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80471a:	72 00                	jb     80471c <__rodata_start+0x6c>
+  80471c:	62 61 64 20 65       	(bad)
+  804721:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804722:	76 69                	jbe    80478d <__rodata_start+0xdd>
+  804724:	72 6f                	jb     804795 <__rodata_start+0xe5>
+  804726:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804727:	6d                   	insl   (%dx),%es:(%rdi)
+  804728:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80472a:	74 00                	je     80472c <__rodata_start+0x7c>
+  80472c:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804733:	20 70 61             	and    %dh,0x61(%rax)
+  804736:	72 61                	jb     804799 <__rodata_start+0xe9>
+  804738:	6d                   	insl   (%dx),%es:(%rdi)
+  804739:	65 74 65             	gs je  8047a1 <__rodata_start+0xf1>
+  80473c:	72 00                	jb     80473e <__rodata_start+0x8e>
+  80473e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80473f:	75 74                	jne    8047b5 <__rodata_start+0x105>
+  804741:	20 6f 66             	and    %ch,0x66(%rdi)
+  804744:	20 6d 65             	and    %ch,0x65(%rbp)
+  804747:	6d                   	insl   (%dx),%es:(%rdi)
+  804748:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804749:	72 79                	jb     8047c4 <__rodata_start+0x114>
+  80474b:	00 6f 75             	add    %ch,0x75(%rdi)
+  80474e:	74 20                	je     804770 <__rodata_start+0xc0>
+  804750:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804751:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804755:	76 69                	jbe    8047c0 <__rodata_start+0x110>
+  804757:	72 6f                	jb     8047c8 <__rodata_start+0x118>
+  804759:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80475a:	6d                   	insl   (%dx),%es:(%rdi)
+  80475b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80475d:	74 73                	je     8047d2 <__rodata_start+0x122>
+  80475f:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804762:	72 72                	jb     8047d6 <__rodata_start+0x126>
+  804764:	75 70                	jne    8047d6 <__rodata_start+0x126>
+  804766:	74 65                	je     8047cd <__rodata_start+0x11d>
+  804768:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  80476d:	75 67                	jne    8047d6 <__rodata_start+0x126>
+  80476f:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804772:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804774:	00 73 65             	add    %dh,0x65(%rbx)
+  804777:	67 6d                	insl   (%dx),%es:(%edi)
+  804779:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80477b:	74 61                	je     8047de <__rodata_start+0x12e>
+  80477d:	74 69                	je     8047e8 <__rodata_start+0x138>
+  80477f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804780:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804781:	20 66 61             	and    %ah,0x61(%rsi)
+  804784:	75 6c                	jne    8047f2 <__rodata_start+0x142>
+  804786:	74 00                	je     804788 <__rodata_start+0xd8>
+  804788:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80478f:	20 45 4c             	and    %al,0x4c(%rbp)
+  804792:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804796:	61                   	(bad)
+  804797:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  80479c:	20 73 75             	and    %dh,0x75(%rbx)
+  80479f:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8047a2:	73 79                	jae    80481d <__rodata_start+0x16d>
+  8047a4:	73 74                	jae    80481a <__rodata_start+0x16a>
+  8047a6:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8047a8:	20 63 61             	and    %ah,0x61(%rbx)
+  8047ab:	6c                   	insb   (%dx),%es:(%rdi)
+  8047ac:	6c                   	insb   (%dx),%es:(%rdi)
+  8047ad:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047b0:	74 72                	je     804824 <__rodata_start+0x174>
+  8047b2:	79 20                	jns    8047d4 <__rodata_start+0x124>
+  8047b4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047b5:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047b6:	74 20                	je     8047d8 <__rodata_start+0x128>
+  8047b8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047ba:	75 6e                	jne    80482a <__rodata_start+0x17a>
+  8047bc:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8047c0:	76 20                	jbe    8047e2 <__rodata_start+0x132>
+  8047c2:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047c9:	72 65                	jb     804830 <__rodata_start+0x180>
+  8047cb:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047ce:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047cf:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047d3:	65 78 70             	gs js  804846 <__rodata_start+0x196>
+  8047d6:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8047db:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047de:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8047e2:	20 66 69             	and    %ah,0x69(%rsi)
+  8047e5:	6c                   	insb   (%dx),%es:(%rdi)
+  8047e6:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8047ea:	20 66 72             	and    %ah,0x72(%rsi)
+  8047ed:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8047f2:	61                   	(bad)
+  8047f3:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8047f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047f8:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8047fc:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8047ff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804800:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804801:	20 6d 61             	and    %ch,0x61(%rbp)
+  804804:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804805:	79 20                	jns    804827 <__rodata_start+0x177>
+  804807:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  80480e:	72 65                	jb     804875 <__rodata_start+0x1c5>
+  804810:	20 6f 70             	and    %ch,0x70(%rdi)
+  804813:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804815:	00 66 69             	add    %ah,0x69(%rsi)
+  804818:	6c                   	insb   (%dx),%es:(%rdi)
+  804819:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  80481d:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804820:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804821:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804824:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804825:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804826:	74 20                	je     804848 <__rodata_start+0x198>
+  804828:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80482a:	75 6e                	jne    80489a <__rodata_start+0x1ea>
+  80482c:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804830:	76 61                	jbe    804893 <__rodata_start+0x1e3>
+  804832:	6c                   	insb   (%dx),%es:(%rdi)
+  804833:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80483a:	00 
+  80483b:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804842:	72 65                	jb     8048a9 <__rodata_start+0x1f9>
+  804844:	61                   	(bad)
+  804845:	64 79 20             	fs jns 804868 <__rodata_start+0x1b8>
+  804848:	65 78 69             	gs js  8048b4 <__rodata_start+0x204>
+  80484b:	73 74                	jae    8048c1 <__rodata_start+0x211>
+  80484d:	73 00                	jae    80484f <__rodata_start+0x19f>
+  80484f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804850:	70 65                	jo     8048b7 <__rodata_start+0x207>
+  804852:	72 61                	jb     8048b5 <__rodata_start+0x205>
+  804854:	74 69                	je     8048bf <__rodata_start+0x20f>
+  804856:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804857:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804858:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80485b:	74 20                	je     80487d <__rodata_start+0x1cd>
+  80485d:	73 75                	jae    8048d4 <__rodata_start+0x224>
+  80485f:	70 70                	jo     8048d1 <__rodata_start+0x221>
+  804861:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804862:	72 74                	jb     8048d8 <__rodata_start+0x228>
+  804864:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  80486a:	20 61 67             	and    %ah,0x67(%rcx)
+  80486d:	61                   	(bad)
+  80486e:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804875:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804879:	74 00                	je     80487b <__rodata_start+0x1cb>
+  80487b:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804882:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804885:	20 75 73             	and    %dh,0x73(%rbp)
+  804888:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80488c:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804893:	00 
+  804894:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80489b:	00 00 00 
+  80489e:	66 90                	xchg   %ax,%ax
+  8048a0:	bd 03 80 00 00       	mov    $0x8003,%ebp
+  8048a5:	00 00                	add    %al,(%rax)
+  8048a7:	00 fe                	add    %bh,%dh
+  8048a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048af:	00 ee                	add    %ch,%dh
+  8048b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048b7:	00 fe                	add    %bh,%dh
+  8048b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048bf:	00 fe                	add    %bh,%dh
+  8048c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048c7:	00 fe                	add    %bh,%dh
+  8048c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048cf:	00 fe                	add    %bh,%dh
+  8048d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048d7:	00 dc                	add    %bl,%ah
+  8048d9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048df:	00 fe                	add    %bh,%dh
+  8048e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048e7:	00 fe                	add    %bh,%dh
+  8048e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048ef:	00 d0                	add    %dl,%al
+  8048f1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048f7:	00 4a 04             	add    %cl,0x4(%rdx)
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 fe                	add    %bh,%dh
+  804901:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804907:	00 d0                	add    %dl,%al
+  804909:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80490f:	00 16                	add    %dl,(%rsi)
+  804911:	04 80                	add    $0x80,%al
+  804913:	00 00                	add    %al,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 16                	add    %dl,(%rsi)
+  804919:	04 80                	add    $0x80,%al
+  80491b:	00 00                	add    %al,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 16                	add    %dl,(%rsi)
+  804921:	04 80                	add    $0x80,%al
+  804923:	00 00                	add    %al,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 16                	add    %dl,(%rsi)
+  804929:	04 80                	add    $0x80,%al
+  80492b:	00 00                	add    %al,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 16                	add    %dl,(%rsi)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 16                	add    %dl,(%rsi)
+  804939:	04 80                	add    $0x80,%al
+  80493b:	00 00                	add    %al,(%rax)
+  80493d:	00 00                	add    %al,(%rax)
+  80493f:	00 16                	add    %dl,(%rsi)
+  804941:	04 80                	add    $0x80,%al
+  804943:	00 00                	add    %al,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 16                	add    %dl,(%rsi)
+  804949:	04 80                	add    $0x80,%al
+  80494b:	00 00                	add    %al,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 16                	add    %dl,(%rsi)
+  804951:	04 80                	add    $0x80,%al
+  804953:	00 00                	add    %al,(%rax)
+  804955:	00 00                	add    %al,(%rax)
+  804957:	00 fe                	add    %bh,%dh
+  804959:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80495f:	00 fe                	add    %bh,%dh
+  804961:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804967:	00 fe                	add    %bh,%dh
+  804969:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80496f:	00 fe                	add    %bh,%dh
+  804971:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804977:	00 fe                	add    %bh,%dh
+  804979:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80497f:	00 fe                	add    %bh,%dh
+  804981:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804987:	00 fe                	add    %bh,%dh
+  804989:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80498f:	00 fe                	add    %bh,%dh
+  804991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804997:	00 fe                	add    %bh,%dh
+  804999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80499f:	00 fe                	add    %bh,%dh
+  8049a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049a7:	00 fe                	add    %bh,%dh
+  8049a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049af:	00 fe                	add    %bh,%dh
+  8049b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049b7:	00 fe                	add    %bh,%dh
+  8049b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049bf:	00 fe                	add    %bh,%dh
+  8049c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049c7:	00 fe                	add    %bh,%dh
+  8049c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049cf:	00 fe                	add    %bh,%dh
+  8049d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049d7:	00 fe                	add    %bh,%dh
+  8049d9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049df:	00 fe                	add    %bh,%dh
+  8049e1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049e7:	00 fe                	add    %bh,%dh
+  8049e9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049ef:	00 fe                	add    %bh,%dh
+  8049f1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049f7:	00 fe                	add    %bh,%dh
+  8049f9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8049ff:	00 fe                	add    %bh,%dh
+  804a01:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a07:	00 fe                	add    %bh,%dh
+  804a09:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a0f:	00 fe                	add    %bh,%dh
+  804a11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a17:	00 fe                	add    %bh,%dh
+  804a19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a1f:	00 fe                	add    %bh,%dh
+  804a21:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a27:	00 fe                	add    %bh,%dh
+  804a29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a2f:	00 fe                	add    %bh,%dh
+  804a31:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a37:	00 fe                	add    %bh,%dh
+  804a39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a3f:	00 fe                	add    %bh,%dh
+  804a41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a47:	00 21                	add    %ah,(%rcx)
+  804a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a4f:	00 fe                	add    %bh,%dh
+  804a51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a57:	00 fe                	add    %bh,%dh
+  804a59:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a5f:	00 fe                	add    %bh,%dh
+  804a61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a67:	00 fe                	add    %bh,%dh
+  804a69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a6f:	00 fe                	add    %bh,%dh
+  804a71:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a77:	00 fe                	add    %bh,%dh
+  804a79:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a7f:	00 fe                	add    %bh,%dh
+  804a81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a87:	00 fe                	add    %bh,%dh
+  804a89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a8f:	00 fe                	add    %bh,%dh
+  804a91:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a97:	00 fe                	add    %bh,%dh
+  804a99:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a9f:	00 6d 04             	add    %ch,0x4(%rbp)
+  804aa2:	80 00 00             	addb   $0x0,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 3c 06             	add    %bh,(%rsi,%rax,1)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 fe                	add    %bh,%dh
+  804ab1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804ab7:	00 fe                	add    %bh,%dh
+  804ab9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804abf:	00 fe                	add    %bh,%dh
+  804ac1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804ac7:	00 fe                	add    %bh,%dh
+  804ac9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804acf:	00 9c 04 80 00 00 00 	add    %bl,0x80(%rsp,%rax,1)
+  804ad6:	00 00                	add    %al,(%rax)
+  804ad8:	fe 09                	decb   (%rcx)
+  804ada:	80 00 00             	addb   $0x0,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 fe                	add    %bh,%dh
+  804ae1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804ae7:	00 62 04             	add    %ah,0x4(%rdx)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 fe                	add    %bh,%dh
+  804af1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804af7:	00 fe                	add    %bh,%dh
+  804af9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804aff:	00 e4                	add    %ah,%ah
+  804b01:	07                   	(bad)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 ae 08 80 00 00    	add    %ch,0x8008(%rsi)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 fe                	add    %bh,%dh
+  804b11:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b17:	00 fe                	add    %bh,%dh
+  804b19:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b1f:	00 33                	add    %dh,(%rbx)
+  804b21:	05 80 00 00 00       	add    $0x80,%eax
+  804b26:	00 00                	add    %al,(%rax)
+  804b28:	fe 09                	decb   (%rcx)
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 10                	add    %dl,(%rax)
+  804b31:	07                   	(bad)
+  804b32:	80 00 00             	addb   $0x0,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 fe                	add    %bh,%dh
+  804b39:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b3f:	00 fe                	add    %bh,%dh
+  804b41:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b47:	00 21                	add    %ah,(%rcx)
+  804b49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b4f:	00 fe                	add    %bh,%dh
+  804b51:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b57:	00 c6                	add    %al,%dh
+  804b59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b60 <error_string>:
+	...
+  804b68:	0a 47 80 00 00 00 00 00 1c 47 80 00 00 00 00 00     .G.......G......
+  804b78:	2c 47 80 00 00 00 00 00 3e 47 80 00 00 00 00 00     ,G......>G......
+  804b88:	4c 47 80 00 00 00 00 00 60 47 80 00 00 00 00 00     LG......`G......
+  804b98:	75 47 80 00 00 00 00 00 88 47 80 00 00 00 00 00     uG.......G......
+  804ba8:	9a 47 80 00 00 00 00 00 ae 47 80 00 00 00 00 00     .G.......G......
+  804bb8:	be 47 80 00 00 00 00 00 d1 47 80 00 00 00 00 00     .G.......G......
+  804bc8:	e8 47 80 00 00 00 00 00 fe 47 80 00 00 00 00 00     .G.......G......
+  804bd8:	16 48 80 00 00 00 00 00 2e 48 80 00 00 00 00 00     .H.......H......
+  804be8:	3b 48 80 00 00 00 00 00 18 4c 80 00 00 00 00 00     ;H.......L......
+  804bf8:	4f 48 80 00 00 00 00 00 67 48 80 00 00 00 00 00     OH......gH......
+  804c08:	71 48 80 00 00 00 00 00 7b 48 80 00 00 00 00 00     qH......{H......
+  804c18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c38:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c48:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c58:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c68:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c78:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804c88:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804c98:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804ca8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804cb8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804cc8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cd8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804d00 <devtab>:
+  804d00:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804d10:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804d80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804d90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804da0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804db0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804dc0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804dd0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804de0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804df0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804e00:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804e10:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e20:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e30:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,8158 @@
+
+obj/user/faultreadkernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2f 00 00 00       	call   800052 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* Buggy program - faults with a read from kernel space */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("I read %08x from location 0x8040000000!\n", *(unsigned *)0x8040000000);
+  800029:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  800030:	00 00 00 
+  800033:	8b 30                	mov    (%rax),%esi
+  800035:	48 bf b0 46 80 00 00 	movabs $0x8046b0,%rdi
+  80003c:	00 00 00 
+  80003f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800044:	48 ba d5 01 80 00 00 	movabs $0x8001d5,%rdx
+  80004b:	00 00 00 
+  80004e:	ff d2                	call   *%rdx
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 56                	push   %r14
+  800058:	41 55                	push   %r13
+  80005a:	41 54                	push   %r12
+  80005c:	53                   	push   %rbx
+  80005d:	41 89 fd             	mov    %edi,%r13d
+  800060:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  80006a:	00 00 00 
+  80006d:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800074:	00 00 00 
+  800077:	48 39 c2             	cmp    %rax,%rdx
+  80007a:	73 17                	jae    800093 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007f:	49 89 c4             	mov    %rax,%r12
+  800082:	48 83 c3 08          	add    $0x8,%rbx
+  800086:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008b:	ff 53 f8             	call   *-0x8(%rbx)
+  80008e:	4c 39 e3             	cmp    %r12,%rbx
+  800091:	72 ef                	jb     800082 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800093:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  80009a:	00 00 00 
+  80009d:	ff d0                	call   *%rax
+  80009f:	89 c2                	mov    %eax,%edx
+  8000a1:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000a7:	48 89 d0             	mov    %rdx,%rax
+  8000aa:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ae:	48 29 d0             	sub    %rdx,%rax
+  8000b1:	48 c1 e0 05          	shl    $0x5,%rax
+  8000b5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000bc:	00 00 00 
+  8000bf:	48 01 d0             	add    %rdx,%rax
+  8000c2:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c9:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000cc:	45 85 ed             	test   %r13d,%r13d
+  8000cf:	7e 0d                	jle    8000de <libmain+0x8c>
+  8000d1:	49 8b 06             	mov    (%r14),%rax
+  8000d4:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000db:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000de:	4c 89 f6             	mov    %r14,%rsi
+  8000e1:	44 89 ef             	mov    %r13d,%edi
+  8000e4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000eb:	00 00 00 
+  8000ee:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000f0:	48 b8 05 01 80 00 00 	movabs $0x800105,%rax
+  8000f7:	00 00 00 
+  8000fa:	ff d0                	call   *%rax
+#endif
+}
+  8000fc:	5b                   	pop    %rbx
+  8000fd:	41 5c                	pop    %r12
+  8000ff:	41 5d                	pop    %r13
+  800101:	41 5e                	pop    %r14
+  800103:	5d                   	pop    %rbp
+  800104:	c3                   	ret
+
+0000000000800105 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800105:	55                   	push   %rbp
+  800106:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800109:	48 b8 b2 16 80 00 00 	movabs $0x8016b2,%rax
+  800110:	00 00 00 
+  800113:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800115:	bf 00 00 00 00       	mov    $0x0,%edi
+  80011a:	48 b8 69 0f 80 00 00 	movabs $0x800f69,%rax
+  800121:	00 00 00 
+  800124:	ff d0                	call   *%rax
+}
+  800126:	5d                   	pop    %rbp
+  800127:	c3                   	ret
+
+0000000000800128 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800128:	55                   	push   %rbp
+  800129:	48 89 e5             	mov    %rsp,%rbp
+  80012c:	53                   	push   %rbx
+  80012d:	48 83 ec 08          	sub    $0x8,%rsp
+  800131:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800134:	8b 06                	mov    (%rsi),%eax
+  800136:	8d 50 01             	lea    0x1(%rax),%edx
+  800139:	89 16                	mov    %edx,(%rsi)
+  80013b:	48 98                	cltq
+  80013d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800142:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800148:	74 0a                	je     800154 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80014a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80014e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800152:	c9                   	leave
+  800153:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800154:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800158:	be ff 00 00 00       	mov    $0xff,%esi
+  80015d:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  800164:	00 00 00 
+  800167:	ff d0                	call   *%rax
+        state->offset = 0;
+  800169:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80016f:	eb d9                	jmp    80014a <putch+0x22>
+
+0000000000800171 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800171:	55                   	push   %rbp
+  800172:	48 89 e5             	mov    %rsp,%rbp
+  800175:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80017c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80017f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800186:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80018b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800190:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800193:	48 89 f1             	mov    %rsi,%rcx
+  800196:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80019d:	48 bf 28 01 80 00 00 	movabs $0x800128,%rdi
+  8001a4:	00 00 00 
+  8001a7:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  8001ae:	00 00 00 
+  8001b1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001b3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001ba:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001c1:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  8001c8:	00 00 00 
+  8001cb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001cd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001d3:	c9                   	leave
+  8001d4:	c3                   	ret
+
+00000000008001d5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001d5:	55                   	push   %rbp
+  8001d6:	48 89 e5             	mov    %rsp,%rbp
+  8001d9:	48 83 ec 50          	sub    $0x50,%rsp
+  8001dd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001e1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8001e5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8001e9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8001ed:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8001f1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8001f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8001fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800200:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800204:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800208:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80020c:	48 b8 71 01 80 00 00 	movabs $0x800171,%rax
+  800213:	00 00 00 
+  800216:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800218:	c9                   	leave
+  800219:	c3                   	ret
+
+000000000080021a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80021a:	55                   	push   %rbp
+  80021b:	48 89 e5             	mov    %rsp,%rbp
+  80021e:	41 57                	push   %r15
+  800220:	41 56                	push   %r14
+  800222:	41 55                	push   %r13
+  800224:	41 54                	push   %r12
+  800226:	53                   	push   %rbx
+  800227:	48 83 ec 18          	sub    $0x18,%rsp
+  80022b:	49 89 fc             	mov    %rdi,%r12
+  80022e:	49 89 f5             	mov    %rsi,%r13
+  800231:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800235:	8b 45 10             	mov    0x10(%rbp),%eax
+  800238:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80023b:	41 89 cf             	mov    %ecx,%r15d
+  80023e:	4c 39 fa             	cmp    %r15,%rdx
+  800241:	73 5b                	jae    80029e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800243:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800247:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80024b:	85 db                	test   %ebx,%ebx
+  80024d:	7e 0e                	jle    80025d <print_num+0x43>
+            putch(padc, put_arg);
+  80024f:	4c 89 ee             	mov    %r13,%rsi
+  800252:	44 89 f7             	mov    %r14d,%edi
+  800255:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800258:	83 eb 01             	sub    $0x1,%ebx
+  80025b:	75 f2                	jne    80024f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80025d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800261:	48 b9 f4 46 80 00 00 	movabs $0x8046f4,%rcx
+  800268:	00 00 00 
+  80026b:	48 b8 e3 46 80 00 00 	movabs $0x8046e3,%rax
+  800272:	00 00 00 
+  800275:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800279:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80027d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800282:	49 f7 f7             	div    %r15
+  800285:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800289:	4c 89 ee             	mov    %r13,%rsi
+  80028c:	41 ff d4             	call   *%r12
+}
+  80028f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800293:	5b                   	pop    %rbx
+  800294:	41 5c                	pop    %r12
+  800296:	41 5d                	pop    %r13
+  800298:	41 5e                	pop    %r14
+  80029a:	41 5f                	pop    %r15
+  80029c:	5d                   	pop    %rbp
+  80029d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80029e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a7:	49 f7 f7             	div    %r15
+  8002aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8002ae:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002b2:	52                   	push   %rdx
+  8002b3:	45 0f be c9          	movsbl %r9b,%r9d
+  8002b7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002bb:	48 89 c2             	mov    %rax,%rdx
+  8002be:	48 b8 1a 02 80 00 00 	movabs $0x80021a,%rax
+  8002c5:	00 00 00 
+  8002c8:	ff d0                	call   *%rax
+  8002ca:	48 83 c4 10          	add    $0x10,%rsp
+  8002ce:	eb 8d                	jmp    80025d <print_num+0x43>
+
+00000000008002d0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002d0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002d4:	48 8b 06             	mov    (%rsi),%rax
+  8002d7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002db:	73 0a                	jae    8002e7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002dd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002e1:	48 89 16             	mov    %rdx,(%rsi)
+  8002e4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8002e7:	c3                   	ret
+
+00000000008002e8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8002e8:	55                   	push   %rbp
+  8002e9:	48 89 e5             	mov    %rsp,%rbp
+  8002ec:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002f4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002f8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8002fc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800303:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800307:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80030b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80030f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800313:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800317:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  80031e:	00 00 00 
+  800321:	ff d0                	call   *%rax
+}
+  800323:	c9                   	leave
+  800324:	c3                   	ret
+
+0000000000800325 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800325:	55                   	push   %rbp
+  800326:	48 89 e5             	mov    %rsp,%rbp
+  800329:	41 57                	push   %r15
+  80032b:	41 56                	push   %r14
+  80032d:	41 55                	push   %r13
+  80032f:	41 54                	push   %r12
+  800331:	53                   	push   %rbx
+  800332:	48 83 ec 38          	sub    $0x38,%rsp
+  800336:	49 89 fe             	mov    %rdi,%r14
+  800339:	49 89 f5             	mov    %rsi,%r13
+  80033c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80033f:	48 8b 01             	mov    (%rcx),%rax
+  800342:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800346:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80034a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80034e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800352:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800356:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80035a:	0f b6 3b             	movzbl (%rbx),%edi
+  80035d:	40 80 ff 25          	cmp    $0x25,%dil
+  800361:	74 18                	je     80037b <vprintfmt+0x56>
+            if (!ch) return;
+  800363:	40 84 ff             	test   %dil,%dil
+  800366:	0f 84 b1 06 00 00    	je     800a1d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80036c:	40 0f b6 ff          	movzbl %dil,%edi
+  800370:	4c 89 ee             	mov    %r13,%rsi
+  800373:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800376:	4c 89 e3             	mov    %r12,%rbx
+  800379:	eb db                	jmp    800356 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80037b:	be 00 00 00 00       	mov    $0x0,%esi
+  800380:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800384:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800389:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80038f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800396:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80039a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80039f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003a4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003a7:	83 e8 23             	sub    $0x23,%eax
+  8003aa:	3c 57                	cmp    $0x57,%al
+  8003ac:	0f 87 51 06 00 00    	ja     800a03 <vprintfmt+0x6de>
+  8003b2:	0f b6 c0             	movzbl %al,%eax
+  8003b5:	48 b9 a0 48 80 00 00 	movabs $0x8048a0,%rcx
+  8003bc:	00 00 00 
+  8003bf:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003c2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003c5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003c9:	eb cf                	jmp    80039a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003cb:	49 89 dc             	mov    %rbx,%r12
+  8003ce:	be 01 00 00 00       	mov    $0x1,%esi
+  8003d3:	eb c5                	jmp    80039a <vprintfmt+0x75>
+            padc = ch;
+  8003d5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003d9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003dc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003df:	eb b9                	jmp    80039a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8003e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8003e7:	77 24                	ja     80040d <vprintfmt+0xe8>
+  8003e9:	89 c1                	mov    %eax,%ecx
+  8003eb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8003ef:	83 c0 08             	add    $0x8,%eax
+  8003f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8003f5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8003f8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8003fb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8003ff:	79 99                	jns    80039a <vprintfmt+0x75>
+                width = precision;
+  800401:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800405:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80040b:	eb 8d                	jmp    80039a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80040d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800411:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800415:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800419:	eb da                	jmp    8003f5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80041b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800420:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800424:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80042a:	3c 39                	cmp    $0x39,%al
+  80042c:	77 1c                	ja     80044a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80042e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800432:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800436:	0f b6 c0             	movzbl %al,%eax
+  800439:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80043e:	0f b6 03             	movzbl (%rbx),%eax
+  800441:	3c 39                	cmp    $0x39,%al
+  800443:	76 e9                	jbe    80042e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800445:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800448:	eb b1                	jmp    8003fb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80044a:	49 89 dc             	mov    %rbx,%r12
+  80044d:	eb ac                	jmp    8003fb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80044f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800452:	85 c9                	test   %ecx,%ecx
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	0f 49 c1             	cmovns %ecx,%eax
+  80045c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80045f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800462:	e9 33 ff ff ff       	jmp    80039a <vprintfmt+0x75>
+            lflag++;
+  800467:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80046a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80046d:	e9 28 ff ff ff       	jmp    80039a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800472:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800475:	83 f8 2f             	cmp    $0x2f,%eax
+  800478:	77 19                	ja     800493 <vprintfmt+0x16e>
+  80047a:	89 c2                	mov    %eax,%edx
+  80047c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800480:	83 c0 08             	add    $0x8,%eax
+  800483:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800486:	8b 3a                	mov    (%rdx),%edi
+  800488:	4c 89 ee             	mov    %r13,%rsi
+  80048b:	41 ff d6             	call   *%r14
+            break;
+  80048e:	e9 c3 fe ff ff       	jmp    800356 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800493:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800497:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80049b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80049f:	eb e5                	jmp    800486 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004a1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004a4:	83 f8 2f             	cmp    $0x2f,%eax
+  8004a7:	77 5a                	ja     800503 <vprintfmt+0x1de>
+  8004a9:	89 c2                	mov    %eax,%edx
+  8004ab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004af:	83 c0 08             	add    $0x8,%eax
+  8004b2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004b5:	8b 02                	mov    (%rdx),%eax
+  8004b7:	89 c1                	mov    %eax,%ecx
+  8004b9:	f7 d9                	neg    %ecx
+  8004bb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004be:	83 f9 16             	cmp    $0x16,%ecx
+  8004c1:	7f 4e                	jg     800511 <vprintfmt+0x1ec>
+  8004c3:	48 63 c1             	movslq %ecx,%rax
+  8004c6:	48 ba 60 4b 80 00 00 	movabs $0x804b60,%rdx
+  8004cd:	00 00 00 
+  8004d0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004d4:	48 85 c0             	test   %rax,%rax
+  8004d7:	74 38                	je     800511 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004d9:	48 89 c1             	mov    %rax,%rcx
+  8004dc:	48 ba 39 4d 80 00 00 	movabs $0x804d39,%rdx
+  8004e3:	00 00 00 
+  8004e6:	4c 89 ee             	mov    %r13,%rsi
+  8004e9:	4c 89 f7             	mov    %r14,%rdi
+  8004ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f1:	49 b8 e8 02 80 00 00 	movabs $0x8002e8,%r8
+  8004f8:	00 00 00 
+  8004fb:	41 ff d0             	call   *%r8
+  8004fe:	e9 53 fe ff ff       	jmp    800356 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800503:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800507:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80050b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80050f:	eb a4                	jmp    8004b5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800511:	48 ba 0c 47 80 00 00 	movabs $0x80470c,%rdx
+  800518:	00 00 00 
+  80051b:	4c 89 ee             	mov    %r13,%rsi
+  80051e:	4c 89 f7             	mov    %r14,%rdi
+  800521:	b8 00 00 00 00       	mov    $0x0,%eax
+  800526:	49 b8 e8 02 80 00 00 	movabs $0x8002e8,%r8
+  80052d:	00 00 00 
+  800530:	41 ff d0             	call   *%r8
+  800533:	e9 1e fe ff ff       	jmp    800356 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800538:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80053b:	83 f8 2f             	cmp    $0x2f,%eax
+  80053e:	77 6c                	ja     8005ac <vprintfmt+0x287>
+  800540:	89 c2                	mov    %eax,%edx
+  800542:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800546:	83 c0 08             	add    $0x8,%eax
+  800549:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80054c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80054f:	48 85 d2             	test   %rdx,%rdx
+  800552:	48 b8 05 47 80 00 00 	movabs $0x804705,%rax
+  800559:	00 00 00 
+  80055c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800560:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800564:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800568:	7e 06                	jle    800570 <vprintfmt+0x24b>
+  80056a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80056e:	75 4a                	jne    8005ba <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800570:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800574:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800578:	0f b6 00             	movzbl (%rax),%eax
+  80057b:	84 c0                	test   %al,%al
+  80057d:	0f 85 9a 00 00 00    	jne    80061d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800583:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800586:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80058a:	85 c0                	test   %eax,%eax
+  80058c:	0f 8e c4 fd ff ff    	jle    800356 <vprintfmt+0x31>
+  800592:	4c 89 ee             	mov    %r13,%rsi
+  800595:	bf 20 00 00 00       	mov    $0x20,%edi
+  80059a:	41 ff d6             	call   *%r14
+  80059d:	41 83 ec 01          	sub    $0x1,%r12d
+  8005a1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005a5:	75 eb                	jne    800592 <vprintfmt+0x26d>
+  8005a7:	e9 aa fd ff ff       	jmp    800356 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b8:	eb 92                	jmp    80054c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005ba:	49 63 f7             	movslq %r15d,%rsi
+  8005bd:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005c1:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+  8005cd:	48 89 c2             	mov    %rax,%rdx
+  8005d0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005d3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005d5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005d8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005db:	85 c0                	test   %eax,%eax
+  8005dd:	7e 91                	jle    800570 <vprintfmt+0x24b>
+  8005df:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8005e4:	4c 89 ee             	mov    %r13,%rsi
+  8005e7:	44 89 e7             	mov    %r12d,%edi
+  8005ea:	41 ff d6             	call   *%r14
+  8005ed:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8005f1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8005f7:	75 eb                	jne    8005e4 <vprintfmt+0x2bf>
+  8005f9:	e9 72 ff ff ff       	jmp    800570 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8005fe:	0f b6 f8             	movzbl %al,%edi
+  800601:	4c 89 ee             	mov    %r13,%rsi
+  800604:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800607:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060b:	49 83 c4 01          	add    $0x1,%r12
+  80060f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800615:	84 c0                	test   %al,%al
+  800617:	0f 84 66 ff ff ff    	je     800583 <vprintfmt+0x25e>
+  80061d:	45 85 ff             	test   %r15d,%r15d
+  800620:	78 0a                	js     80062c <vprintfmt+0x307>
+  800622:	41 83 ef 01          	sub    $0x1,%r15d
+  800626:	0f 88 57 ff ff ff    	js     800583 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80062c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800630:	74 cc                	je     8005fe <vprintfmt+0x2d9>
+  800632:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800635:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80063a:	80 fa 5e             	cmp    $0x5e,%dl
+  80063d:	77 c2                	ja     800601 <vprintfmt+0x2dc>
+  80063f:	eb bd                	jmp    8005fe <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800641:	40 84 f6             	test   %sil,%sil
+  800644:	75 26                	jne    80066c <vprintfmt+0x347>
+    switch (lflag) {
+  800646:	85 d2                	test   %edx,%edx
+  800648:	74 59                	je     8006a3 <vprintfmt+0x37e>
+  80064a:	83 fa 01             	cmp    $0x1,%edx
+  80064d:	74 7b                	je     8006ca <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80064f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800652:	83 f8 2f             	cmp    $0x2f,%eax
+  800655:	0f 87 96 00 00 00    	ja     8006f1 <vprintfmt+0x3cc>
+  80065b:	89 c2                	mov    %eax,%edx
+  80065d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800661:	83 c0 08             	add    $0x8,%eax
+  800664:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800667:	4c 8b 22             	mov    (%rdx),%r12
+  80066a:	eb 17                	jmp    800683 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80066c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80066f:	83 f8 2f             	cmp    $0x2f,%eax
+  800672:	77 21                	ja     800695 <vprintfmt+0x370>
+  800674:	89 c2                	mov    %eax,%edx
+  800676:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067a:	83 c0 08             	add    $0x8,%eax
+  80067d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800680:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800683:	4d 85 e4             	test   %r12,%r12
+  800686:	78 7a                	js     800702 <vprintfmt+0x3dd>
+            num = i;
+  800688:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80068b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800690:	e9 50 02 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800695:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800699:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80069d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a1:	eb dd                	jmp    800680 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8006a9:	77 11                	ja     8006bc <vprintfmt+0x397>
+  8006ab:	89 c2                	mov    %eax,%edx
+  8006ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006b1:	83 c0 08             	add    $0x8,%eax
+  8006b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006b7:	4c 63 22             	movslq (%rdx),%r12
+  8006ba:	eb c7                	jmp    800683 <vprintfmt+0x35e>
+  8006bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c8:	eb ed                	jmp    8006b7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8006d0:	77 11                	ja     8006e3 <vprintfmt+0x3be>
+  8006d2:	89 c2                	mov    %eax,%edx
+  8006d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006d8:	83 c0 08             	add    $0x8,%eax
+  8006db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006de:	4c 8b 22             	mov    (%rdx),%r12
+  8006e1:	eb a0                	jmp    800683 <vprintfmt+0x35e>
+  8006e3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ef:	eb ed                	jmp    8006de <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8006f1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006f5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006fd:	e9 65 ff ff ff       	jmp    800667 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800702:	4c 89 ee             	mov    %r13,%rsi
+  800705:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80070a:	41 ff d6             	call   *%r14
+                i = -i;
+  80070d:	49 f7 dc             	neg    %r12
+  800710:	e9 73 ff ff ff       	jmp    800688 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800715:	40 84 f6             	test   %sil,%sil
+  800718:	75 32                	jne    80074c <vprintfmt+0x427>
+    switch (lflag) {
+  80071a:	85 d2                	test   %edx,%edx
+  80071c:	74 5d                	je     80077b <vprintfmt+0x456>
+  80071e:	83 fa 01             	cmp    $0x1,%edx
+  800721:	0f 84 82 00 00 00    	je     8007a9 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800727:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80072a:	83 f8 2f             	cmp    $0x2f,%eax
+  80072d:	0f 87 a5 00 00 00    	ja     8007d8 <vprintfmt+0x4b3>
+  800733:	89 c2                	mov    %eax,%edx
+  800735:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800739:	83 c0 08             	add    $0x8,%eax
+  80073c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80073f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800742:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800747:	e9 99 01 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80074c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074f:	83 f8 2f             	cmp    $0x2f,%eax
+  800752:	77 19                	ja     80076d <vprintfmt+0x448>
+  800754:	89 c2                	mov    %eax,%edx
+  800756:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075a:	83 c0 08             	add    $0x8,%eax
+  80075d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800760:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800763:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800768:	e9 78 01 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+  80076d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800771:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800775:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800779:	eb e5                	jmp    800760 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80077b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80077e:	83 f8 2f             	cmp    $0x2f,%eax
+  800781:	77 18                	ja     80079b <vprintfmt+0x476>
+  800783:	89 c2                	mov    %eax,%edx
+  800785:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800789:	83 c0 08             	add    $0x8,%eax
+  80078c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80078f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800791:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800796:	e9 4a 01 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+  80079b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80079f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a7:	eb e6                	jmp    80078f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8007af:	77 19                	ja     8007ca <vprintfmt+0x4a5>
+  8007b1:	89 c2                	mov    %eax,%edx
+  8007b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b7:	83 c0 08             	add    $0x8,%eax
+  8007ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bd:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007c0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007c5:	e9 1b 01 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+  8007ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d6:	eb e5                	jmp    8007bd <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e4:	e9 56 ff ff ff       	jmp    80073f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e9:	40 84 f6             	test   %sil,%sil
+  8007ec:	75 2e                	jne    80081c <vprintfmt+0x4f7>
+    switch (lflag) {
+  8007ee:	85 d2                	test   %edx,%edx
+  8007f0:	74 59                	je     80084b <vprintfmt+0x526>
+  8007f2:	83 fa 01             	cmp    $0x1,%edx
+  8007f5:	74 7f                	je     800876 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8007f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fd:	0f 87 9f 00 00 00    	ja     8008a2 <vprintfmt+0x57d>
+  800803:	89 c2                	mov    %eax,%edx
+  800805:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800809:	83 c0 08             	add    $0x8,%eax
+  80080c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800812:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800817:	e9 c9 00 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80081c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 19                	ja     80083d <vprintfmt+0x518>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800833:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800838:	e9 a8 00 00 00       	jmp    8008e5 <vprintfmt+0x5c0>
+  80083d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800841:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800845:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800849:	eb e5                	jmp    800830 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80084b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084e:	83 f8 2f             	cmp    $0x2f,%eax
+  800851:	77 15                	ja     800868 <vprintfmt+0x543>
+  800853:	89 c2                	mov    %eax,%edx
+  800855:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800859:	83 c0 08             	add    $0x8,%eax
+  80085c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800861:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800866:	eb 7d                	jmp    8008e5 <vprintfmt+0x5c0>
+  800868:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800870:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800874:	eb e9                	jmp    80085f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800876:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800879:	83 f8 2f             	cmp    $0x2f,%eax
+  80087c:	77 16                	ja     800894 <vprintfmt+0x56f>
+  80087e:	89 c2                	mov    %eax,%edx
+  800880:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800884:	83 c0 08             	add    $0x8,%eax
+  800887:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80088d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800892:	eb 51                	jmp    8008e5 <vprintfmt+0x5c0>
+  800894:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800898:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80089c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a0:	eb e8                	jmp    80088a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008a2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008aa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ae:	e9 5c ff ff ff       	jmp    80080f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008b3:	4c 89 ee             	mov    %r13,%rsi
+  8008b6:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008bb:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008be:	4c 89 ee             	mov    %r13,%rsi
+  8008c1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008c6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008c9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cf:	77 47                	ja     800918 <vprintfmt+0x5f3>
+  8008d1:	89 c2                	mov    %eax,%edx
+  8008d3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d7:	83 c0 08             	add    $0x8,%eax
+  8008da:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008e0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8008e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8008e9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8008ed:	0f 94 c0             	sete   %al
+  8008f0:	0f b6 c0             	movzbl %al,%eax
+  8008f3:	50                   	push   %rax
+  8008f4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8008f9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8008fd:	4c 89 ee             	mov    %r13,%rsi
+  800900:	4c 89 f7             	mov    %r14,%rdi
+  800903:	48 b8 1a 02 80 00 00 	movabs $0x80021a,%rax
+  80090a:	00 00 00 
+  80090d:	ff d0                	call   *%rax
+            break;
+  80090f:	48 83 c4 10          	add    $0x10,%rsp
+  800913:	e9 3e fa ff ff       	jmp    800356 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800918:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800920:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800924:	eb b7                	jmp    8008dd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800926:	40 84 f6             	test   %sil,%sil
+  800929:	75 2b                	jne    800956 <vprintfmt+0x631>
+    switch (lflag) {
+  80092b:	85 d2                	test   %edx,%edx
+  80092d:	74 56                	je     800985 <vprintfmt+0x660>
+  80092f:	83 fa 01             	cmp    $0x1,%edx
+  800932:	74 7f                	je     8009b3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800934:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800937:	83 f8 2f             	cmp    $0x2f,%eax
+  80093a:	0f 87 a2 00 00 00    	ja     8009e2 <vprintfmt+0x6bd>
+  800940:	89 c2                	mov    %eax,%edx
+  800942:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800946:	83 c0 08             	add    $0x8,%eax
+  800949:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80094f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800954:	eb 8f                	jmp    8008e5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800956:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800959:	83 f8 2f             	cmp    $0x2f,%eax
+  80095c:	77 19                	ja     800977 <vprintfmt+0x652>
+  80095e:	89 c2                	mov    %eax,%edx
+  800960:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800964:	83 c0 08             	add    $0x8,%eax
+  800967:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800972:	e9 6e ff ff ff       	jmp    8008e5 <vprintfmt+0x5c0>
+  800977:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800983:	eb e5                	jmp    80096a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800985:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800988:	83 f8 2f             	cmp    $0x2f,%eax
+  80098b:	77 18                	ja     8009a5 <vprintfmt+0x680>
+  80098d:	89 c2                	mov    %eax,%edx
+  80098f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800993:	83 c0 08             	add    $0x8,%eax
+  800996:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800999:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80099b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a0:	e9 40 ff ff ff       	jmp    8008e5 <vprintfmt+0x5c0>
+  8009a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b1:	eb e6                	jmp    800999 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b9:	77 19                	ja     8009d4 <vprintfmt+0x6af>
+  8009bb:	89 c2                	mov    %eax,%edx
+  8009bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c1:	83 c0 08             	add    $0x8,%eax
+  8009c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009ca:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009cf:	e9 11 ff ff ff       	jmp    8008e5 <vprintfmt+0x5c0>
+  8009d4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009dc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e0:	eb e5                	jmp    8009c7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8009e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ee:	e9 59 ff ff ff       	jmp    80094c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8009f3:	4c 89 ee             	mov    %r13,%rsi
+  8009f6:	bf 25 00 00 00       	mov    $0x25,%edi
+  8009fb:	41 ff d6             	call   *%r14
+            break;
+  8009fe:	e9 53 f9 ff ff       	jmp    800356 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a03:	4c 89 ee             	mov    %r13,%rsi
+  800a06:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a0b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a0e:	48 83 eb 01          	sub    $0x1,%rbx
+  800a12:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a16:	75 f6                	jne    800a0e <vprintfmt+0x6e9>
+  800a18:	e9 39 f9 ff ff       	jmp    800356 <vprintfmt+0x31>
+}
+  800a1d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a21:	5b                   	pop    %rbx
+  800a22:	41 5c                	pop    %r12
+  800a24:	41 5d                	pop    %r13
+  800a26:	41 5e                	pop    %r14
+  800a28:	41 5f                	pop    %r15
+  800a2a:	5d                   	pop    %rbp
+  800a2b:	c3                   	ret
+
+0000000000800a2c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a2c:	55                   	push   %rbp
+  800a2d:	48 89 e5             	mov    %rsp,%rbp
+  800a30:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a34:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a38:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a3d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a41:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a48:	48 85 ff             	test   %rdi,%rdi
+  800a4b:	74 2b                	je     800a78 <vsnprintf+0x4c>
+  800a4d:	48 85 f6             	test   %rsi,%rsi
+  800a50:	74 26                	je     800a78 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a52:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a56:	48 bf d0 02 80 00 00 	movabs $0x8002d0,%rdi
+  800a5d:	00 00 00 
+  800a60:	48 b8 25 03 80 00 00 	movabs $0x800325,%rax
+  800a67:	00 00 00 
+  800a6a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a6c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a70:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a73:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a76:	c9                   	leave
+  800a77:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a78:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a7d:	eb f7                	jmp    800a76 <vsnprintf+0x4a>
+
+0000000000800a7f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a7f:	55                   	push   %rbp
+  800a80:	48 89 e5             	mov    %rsp,%rbp
+  800a83:	48 83 ec 50          	sub    $0x50,%rsp
+  800a87:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a8b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a8f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800a93:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a9a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a9e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800aa6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800aaa:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800aae:	48 b8 2c 0a 80 00 00 	movabs $0x800a2c,%rax
+  800ab5:	00 00 00 
+  800ab8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800aba:	c9                   	leave
+  800abb:	c3                   	ret
+
+0000000000800abc <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800abc:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800abf:	74 10                	je     800ad1 <strlen+0x15>
+    size_t n = 0;
+  800ac1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ac6:	48 83 c0 01          	add    $0x1,%rax
+  800aca:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800ace:	75 f6                	jne    800ac6 <strlen+0xa>
+  800ad0:	c3                   	ret
+    size_t n = 0;
+  800ad1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ad6:	c3                   	ret
+
+0000000000800ad7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ad7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ada:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800adf:	48 85 f6             	test   %rsi,%rsi
+  800ae2:	74 11                	je     800af5 <strnlen+0x1e>
+  800ae4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800ae8:	74 0c                	je     800af6 <strnlen+0x1f>
+  800aea:	48 83 c2 01          	add    $0x1,%rdx
+  800aee:	48 39 d0             	cmp    %rdx,%rax
+  800af1:	75 f1                	jne    800ae4 <strnlen+0xd>
+  800af3:	eb 04                	jmp    800af9 <strnlen+0x22>
+  800af5:	c3                   	ret
+  800af6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800af9:	c3                   	ret
+
+0000000000800afa <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800afa:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800afd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b02:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b06:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b09:	48 83 c2 01          	add    $0x1,%rdx
+  800b0d:	84 c9                	test   %cl,%cl
+  800b0f:	75 f1                	jne    800b02 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b11:	c3                   	ret
+
+0000000000800b12 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b12:	55                   	push   %rbp
+  800b13:	48 89 e5             	mov    %rsp,%rbp
+  800b16:	41 54                	push   %r12
+  800b18:	53                   	push   %rbx
+  800b19:	48 89 fb             	mov    %rdi,%rbx
+  800b1c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b1f:	48 b8 bc 0a 80 00 00 	movabs $0x800abc,%rax
+  800b26:	00 00 00 
+  800b29:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b2b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b2f:	4c 89 e6             	mov    %r12,%rsi
+  800b32:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  800b39:	00 00 00 
+  800b3c:	ff d0                	call   *%rax
+    return dst;
+}
+  800b3e:	48 89 d8             	mov    %rbx,%rax
+  800b41:	5b                   	pop    %rbx
+  800b42:	41 5c                	pop    %r12
+  800b44:	5d                   	pop    %rbp
+  800b45:	c3                   	ret
+
+0000000000800b46 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b46:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b49:	48 85 d2             	test   %rdx,%rdx
+  800b4c:	74 1f                	je     800b6d <strncpy+0x27>
+  800b4e:	48 01 fa             	add    %rdi,%rdx
+  800b51:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b54:	48 83 c1 01          	add    $0x1,%rcx
+  800b58:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b5c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b60:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b64:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b68:	48 39 ca             	cmp    %rcx,%rdx
+  800b6b:	75 e7                	jne    800b54 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b6d:	c3                   	ret
+
+0000000000800b6e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b6e:	48 89 f8             	mov    %rdi,%rax
+  800b71:	48 85 d2             	test   %rdx,%rdx
+  800b74:	74 24                	je     800b9a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b76:	48 83 ea 01          	sub    $0x1,%rdx
+  800b7a:	74 1b                	je     800b97 <strlcpy+0x29>
+  800b7c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b80:	0f b6 16             	movzbl (%rsi),%edx
+  800b83:	84 d2                	test   %dl,%dl
+  800b85:	74 10                	je     800b97 <strlcpy+0x29>
+            *dst++ = *src++;
+  800b87:	48 83 c6 01          	add    $0x1,%rsi
+  800b8b:	48 83 c0 01          	add    $0x1,%rax
+  800b8f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800b92:	48 39 c8             	cmp    %rcx,%rax
+  800b95:	75 e9                	jne    800b80 <strlcpy+0x12>
+        *dst = '\0';
+  800b97:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800b9a:	48 29 f8             	sub    %rdi,%rax
+}
+  800b9d:	c3                   	ret
+
+0000000000800b9e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800b9e:	0f b6 07             	movzbl (%rdi),%eax
+  800ba1:	84 c0                	test   %al,%al
+  800ba3:	74 13                	je     800bb8 <strcmp+0x1a>
+  800ba5:	38 06                	cmp    %al,(%rsi)
+  800ba7:	75 0f                	jne    800bb8 <strcmp+0x1a>
+  800ba9:	48 83 c7 01          	add    $0x1,%rdi
+  800bad:	48 83 c6 01          	add    $0x1,%rsi
+  800bb1:	0f b6 07             	movzbl (%rdi),%eax
+  800bb4:	84 c0                	test   %al,%al
+  800bb6:	75 ed                	jne    800ba5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bb8:	0f b6 c0             	movzbl %al,%eax
+  800bbb:	0f b6 16             	movzbl (%rsi),%edx
+  800bbe:	29 d0                	sub    %edx,%eax
+}
+  800bc0:	c3                   	ret
+
+0000000000800bc1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bc1:	48 85 d2             	test   %rdx,%rdx
+  800bc4:	74 1f                	je     800be5 <strncmp+0x24>
+  800bc6:	0f b6 07             	movzbl (%rdi),%eax
+  800bc9:	84 c0                	test   %al,%al
+  800bcb:	74 1e                	je     800beb <strncmp+0x2a>
+  800bcd:	3a 06                	cmp    (%rsi),%al
+  800bcf:	75 1a                	jne    800beb <strncmp+0x2a>
+  800bd1:	48 83 c7 01          	add    $0x1,%rdi
+  800bd5:	48 83 c6 01          	add    $0x1,%rsi
+  800bd9:	48 83 ea 01          	sub    $0x1,%rdx
+  800bdd:	75 e7                	jne    800bc6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bdf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800be4:	c3                   	ret
+  800be5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bea:	c3                   	ret
+  800beb:	48 85 d2             	test   %rdx,%rdx
+  800bee:	74 09                	je     800bf9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bf0:	0f b6 07             	movzbl (%rdi),%eax
+  800bf3:	0f b6 16             	movzbl (%rsi),%edx
+  800bf6:	29 d0                	sub    %edx,%eax
+  800bf8:	c3                   	ret
+    if (!n) return 0;
+  800bf9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800bfe:	c3                   	ret
+
+0000000000800bff <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800bff:	0f b6 17             	movzbl (%rdi),%edx
+  800c02:	84 d2                	test   %dl,%dl
+  800c04:	74 18                	je     800c1e <strchr+0x1f>
+        if (*str == c) {
+  800c06:	0f be d2             	movsbl %dl,%edx
+  800c09:	39 f2                	cmp    %esi,%edx
+  800c0b:	74 17                	je     800c24 <strchr+0x25>
+    for (; *str; str++) {
+  800c0d:	48 83 c7 01          	add    $0x1,%rdi
+  800c11:	0f b6 17             	movzbl (%rdi),%edx
+  800c14:	84 d2                	test   %dl,%dl
+  800c16:	75 ee                	jne    800c06 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c1d:	c3                   	ret
+  800c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c23:	c3                   	ret
+  800c24:	48 89 f8             	mov    %rdi,%rax
+}
+  800c27:	c3                   	ret
+
+0000000000800c28 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c28:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c2b:	0f b6 17             	movzbl (%rdi),%edx
+  800c2e:	84 d2                	test   %dl,%dl
+  800c30:	74 13                	je     800c45 <strfind+0x1d>
+  800c32:	0f be d2             	movsbl %dl,%edx
+  800c35:	39 f2                	cmp    %esi,%edx
+  800c37:	74 0b                	je     800c44 <strfind+0x1c>
+  800c39:	48 83 c0 01          	add    $0x1,%rax
+  800c3d:	0f b6 10             	movzbl (%rax),%edx
+  800c40:	84 d2                	test   %dl,%dl
+  800c42:	75 ee                	jne    800c32 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c44:	c3                   	ret
+  800c45:	c3                   	ret
+
+0000000000800c46 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c46:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c49:	48 89 f8             	mov    %rdi,%rax
+  800c4c:	48 f7 d8             	neg    %rax
+  800c4f:	83 e0 07             	and    $0x7,%eax
+  800c52:	49 89 d1             	mov    %rdx,%r9
+  800c55:	49 29 c1             	sub    %rax,%r9
+  800c58:	78 36                	js     800c90 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c5a:	40 0f b6 c6          	movzbl %sil,%eax
+  800c5e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c65:	01 01 01 
+  800c68:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c6c:	40 f6 c7 07          	test   $0x7,%dil
+  800c70:	75 38                	jne    800caa <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c72:	4c 89 c9             	mov    %r9,%rcx
+  800c75:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c79:	74 0c                	je     800c87 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c7b:	fc                   	cld
+  800c7c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c7f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800c83:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800c87:	4d 85 c9             	test   %r9,%r9
+  800c8a:	75 45                	jne    800cd1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800c8c:	4c 89 c0             	mov    %r8,%rax
+  800c8f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800c90:	48 85 d2             	test   %rdx,%rdx
+  800c93:	74 f7                	je     800c8c <memset+0x46>
+  800c95:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800c98:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800c9b:	48 83 c0 01          	add    $0x1,%rax
+  800c9f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ca3:	48 39 c2             	cmp    %rax,%rdx
+  800ca6:	75 f3                	jne    800c9b <memset+0x55>
+  800ca8:	eb e2                	jmp    800c8c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800caa:	40 f6 c7 01          	test   $0x1,%dil
+  800cae:	74 06                	je     800cb6 <memset+0x70>
+  800cb0:	88 07                	mov    %al,(%rdi)
+  800cb2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cb6:	40 f6 c7 02          	test   $0x2,%dil
+  800cba:	74 07                	je     800cc3 <memset+0x7d>
+  800cbc:	66 89 07             	mov    %ax,(%rdi)
+  800cbf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cc3:	40 f6 c7 04          	test   $0x4,%dil
+  800cc7:	74 a9                	je     800c72 <memset+0x2c>
+  800cc9:	89 07                	mov    %eax,(%rdi)
+  800ccb:	48 83 c7 04          	add    $0x4,%rdi
+  800ccf:	eb a1                	jmp    800c72 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cd1:	41 f6 c1 04          	test   $0x4,%r9b
+  800cd5:	74 06                	je     800cdd <memset+0x97>
+  800cd7:	89 07                	mov    %eax,(%rdi)
+  800cd9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cdd:	41 f6 c1 02          	test   $0x2,%r9b
+  800ce1:	74 07                	je     800cea <memset+0xa4>
+  800ce3:	66 89 07             	mov    %ax,(%rdi)
+  800ce6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800cea:	41 f6 c1 01          	test   $0x1,%r9b
+  800cee:	74 9c                	je     800c8c <memset+0x46>
+  800cf0:	88 07                	mov    %al,(%rdi)
+  800cf2:	eb 98                	jmp    800c8c <memset+0x46>
+
+0000000000800cf4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800cf4:	48 89 f8             	mov    %rdi,%rax
+  800cf7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800cfa:	48 39 fe             	cmp    %rdi,%rsi
+  800cfd:	73 3b                	jae    800d3a <memmove+0x46>
+  800cff:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d03:	48 39 d7             	cmp    %rdx,%rdi
+  800d06:	73 32                	jae    800d3a <memmove+0x46>
+        s += n;
+        d += n;
+  800d08:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d0c:	48 89 d6             	mov    %rdx,%rsi
+  800d0f:	48 09 fe             	or     %rdi,%rsi
+  800d12:	48 09 ce             	or     %rcx,%rsi
+  800d15:	40 f6 c6 07          	test   $0x7,%sil
+  800d19:	75 12                	jne    800d2d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d1b:	48 83 ef 08          	sub    $0x8,%rdi
+  800d1f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d23:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d27:	fd                   	std
+  800d28:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d2b:	fc                   	cld
+  800d2c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d2d:	48 83 ef 01          	sub    $0x1,%rdi
+  800d31:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d35:	fd                   	std
+  800d36:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d38:	eb f1                	jmp    800d2b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d3a:	48 89 f2             	mov    %rsi,%rdx
+  800d3d:	48 09 c2             	or     %rax,%rdx
+  800d40:	48 09 ca             	or     %rcx,%rdx
+  800d43:	f6 c2 07             	test   $0x7,%dl
+  800d46:	75 0c                	jne    800d54 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d48:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d4c:	48 89 c7             	mov    %rax,%rdi
+  800d4f:	fc                   	cld
+  800d50:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d53:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d54:	48 89 c7             	mov    %rax,%rdi
+  800d57:	fc                   	cld
+  800d58:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d5a:	c3                   	ret
+
+0000000000800d5b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d5b:	55                   	push   %rbp
+  800d5c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d5f:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  800d66:	00 00 00 
+  800d69:	ff d0                	call   *%rax
+}
+  800d6b:	5d                   	pop    %rbp
+  800d6c:	c3                   	ret
+
+0000000000800d6d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d6d:	55                   	push   %rbp
+  800d6e:	48 89 e5             	mov    %rsp,%rbp
+  800d71:	41 57                	push   %r15
+  800d73:	41 56                	push   %r14
+  800d75:	41 55                	push   %r13
+  800d77:	41 54                	push   %r12
+  800d79:	53                   	push   %rbx
+  800d7a:	48 83 ec 08          	sub    $0x8,%rsp
+  800d7e:	49 89 fe             	mov    %rdi,%r14
+  800d81:	49 89 f7             	mov    %rsi,%r15
+  800d84:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800d87:	48 89 f7             	mov    %rsi,%rdi
+  800d8a:	48 b8 bc 0a 80 00 00 	movabs $0x800abc,%rax
+  800d91:	00 00 00 
+  800d94:	ff d0                	call   *%rax
+  800d96:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800d99:	48 89 de             	mov    %rbx,%rsi
+  800d9c:	4c 89 f7             	mov    %r14,%rdi
+  800d9f:	48 b8 d7 0a 80 00 00 	movabs $0x800ad7,%rax
+  800da6:	00 00 00 
+  800da9:	ff d0                	call   *%rax
+  800dab:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dae:	48 39 c3             	cmp    %rax,%rbx
+  800db1:	74 36                	je     800de9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800db3:	48 89 d8             	mov    %rbx,%rax
+  800db6:	4c 29 e8             	sub    %r13,%rax
+  800db9:	49 39 c4             	cmp    %rax,%r12
+  800dbc:	73 31                	jae    800def <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800dbe:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800dc3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800dc7:	4c 89 fe             	mov    %r15,%rsi
+  800dca:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  800dd1:	00 00 00 
+  800dd4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800dd6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800dda:	48 83 c4 08          	add    $0x8,%rsp
+  800dde:	5b                   	pop    %rbx
+  800ddf:	41 5c                	pop    %r12
+  800de1:	41 5d                	pop    %r13
+  800de3:	41 5e                	pop    %r14
+  800de5:	41 5f                	pop    %r15
+  800de7:	5d                   	pop    %rbp
+  800de8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800de9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ded:	eb eb                	jmp    800dda <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800def:	48 83 eb 01          	sub    $0x1,%rbx
+  800df3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800df7:	48 89 da             	mov    %rbx,%rdx
+  800dfa:	4c 89 fe             	mov    %r15,%rsi
+  800dfd:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  800e04:	00 00 00 
+  800e07:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e09:	49 01 de             	add    %rbx,%r14
+  800e0c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e11:	eb c3                	jmp    800dd6 <strlcat+0x69>
+
+0000000000800e13 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e13:	48 85 d2             	test   %rdx,%rdx
+  800e16:	74 2d                	je     800e45 <memcmp+0x32>
+  800e18:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e1d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e21:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e26:	44 38 c1             	cmp    %r8b,%cl
+  800e29:	75 0f                	jne    800e3a <memcmp+0x27>
+    while (n-- > 0) {
+  800e2b:	48 83 c0 01          	add    $0x1,%rax
+  800e2f:	48 39 c2             	cmp    %rax,%rdx
+  800e32:	75 e9                	jne    800e1d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e39:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e3a:	0f b6 c1             	movzbl %cl,%eax
+  800e3d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e41:	44 29 c0             	sub    %r8d,%eax
+  800e44:	c3                   	ret
+    return 0;
+  800e45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e4a:	c3                   	ret
+
+0000000000800e4b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e4b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e4f:	48 39 c7             	cmp    %rax,%rdi
+  800e52:	73 0f                	jae    800e63 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e54:	40 38 37             	cmp    %sil,(%rdi)
+  800e57:	74 0e                	je     800e67 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e59:	48 83 c7 01          	add    $0x1,%rdi
+  800e5d:	48 39 f8             	cmp    %rdi,%rax
+  800e60:	75 f2                	jne    800e54 <memfind+0x9>
+  800e62:	c3                   	ret
+  800e63:	48 89 f8             	mov    %rdi,%rax
+  800e66:	c3                   	ret
+  800e67:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e6a:	c3                   	ret
+
+0000000000800e6b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e6b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e6e:	0f b6 37             	movzbl (%rdi),%esi
+  800e71:	40 80 fe 20          	cmp    $0x20,%sil
+  800e75:	74 06                	je     800e7d <strtol+0x12>
+  800e77:	40 80 fe 09          	cmp    $0x9,%sil
+  800e7b:	75 13                	jne    800e90 <strtol+0x25>
+  800e7d:	48 83 c7 01          	add    $0x1,%rdi
+  800e81:	0f b6 37             	movzbl (%rdi),%esi
+  800e84:	40 80 fe 20          	cmp    $0x20,%sil
+  800e88:	74 f3                	je     800e7d <strtol+0x12>
+  800e8a:	40 80 fe 09          	cmp    $0x9,%sil
+  800e8e:	74 ed                	je     800e7d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800e90:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800e93:	83 e0 fd             	and    $0xfffffffd,%eax
+  800e96:	3c 01                	cmp    $0x1,%al
+  800e98:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800e9c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ea2:	75 0f                	jne    800eb3 <strtol+0x48>
+  800ea4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ea7:	74 14                	je     800ebd <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ea9:	85 d2                	test   %edx,%edx
+  800eab:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800eb0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800eb3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800eb8:	4c 63 ca             	movslq %edx,%r9
+  800ebb:	eb 36                	jmp    800ef3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ebd:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ec1:	74 0f                	je     800ed2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ec3:	85 d2                	test   %edx,%edx
+  800ec5:	75 ec                	jne    800eb3 <strtol+0x48>
+        s++;
+  800ec7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ecb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800ed0:	eb e1                	jmp    800eb3 <strtol+0x48>
+        s += 2;
+  800ed2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ed6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800edb:	eb d6                	jmp    800eb3 <strtol+0x48>
+            dig -= '0';
+  800edd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ee0:	44 0f b6 c1          	movzbl %cl,%r8d
+  800ee4:	41 39 d0             	cmp    %edx,%r8d
+  800ee7:	7d 21                	jge    800f0a <strtol+0x9f>
+        val = val * base + dig;
+  800ee9:	49 0f af c1          	imul   %r9,%rax
+  800eed:	0f b6 c9             	movzbl %cl,%ecx
+  800ef0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800ef3:	48 83 c7 01          	add    $0x1,%rdi
+  800ef7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800efb:	80 f9 39             	cmp    $0x39,%cl
+  800efe:	76 dd                	jbe    800edd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f00:	80 f9 7b             	cmp    $0x7b,%cl
+  800f03:	77 05                	ja     800f0a <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f05:	83 e9 57             	sub    $0x57,%ecx
+  800f08:	eb d6                	jmp    800ee0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f0a:	4d 85 d2             	test   %r10,%r10
+  800f0d:	74 03                	je     800f12 <strtol+0xa7>
+  800f0f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f12:	48 89 c2             	mov    %rax,%rdx
+  800f15:	48 f7 da             	neg    %rdx
+  800f18:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f1c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f20:	c3                   	ret
+
+0000000000800f21 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f21:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f26:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f2b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f31:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f3d:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f3f:	c3                   	ret
+
+0000000000800f40 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f40:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f45:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f4a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f54:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f5a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f60:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f66:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f68:	c3                   	ret
+
+0000000000800f69 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f69:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f6c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f71:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f76:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f81:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f87:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f8d:	0f 05                	syscall
+    if (check && ret > 0) {
+  800f8f:	48 85 c0             	test   %rax,%rax
+  800f92:	7f 01                	jg     800f95 <sys_env_destroy+0x2c>
+}
+  800f94:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800f95:	55                   	push   %rbp
+  800f96:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800f99:	49 89 c0             	mov    %rax,%r8
+  800f9c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fa1:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  800fa8:	00 00 00 
+  800fab:	be 29 00 00 00       	mov    $0x29,%esi
+  800fb0:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  800fb7:	00 00 00 
+  800fba:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fbf:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  800fc6:	00 00 00 
+  800fc9:	41 ff d1             	call   *%r9
+
+0000000000800fcc <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fcc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fd6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800fdb:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800fe6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800ff2:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  800ff4:	c3                   	ret
+
+0000000000800ff5 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  800ff5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800ffa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800fff:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801004:	ba 00 00 00 00       	mov    $0x0,%edx
+  801009:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80100f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801015:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80101b:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80101d:	c3                   	ret
+
+000000000080101e <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80101e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801023:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80102a:	00 00 00 
+  80102d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801033:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801039:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80103f:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801041:	c3                   	ret
+
+0000000000801042 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801042:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801045:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80104a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801050:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801056:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801058:	c3                   	ret
+
+0000000000801059 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801059:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80105c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801061:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801064:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80106a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801070:	0f 05                	syscall
+    if (check && ret > 0) {
+  801072:	48 85 c0             	test   %rax,%rax
+  801075:	7f 01                	jg     801078 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801077:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801078:	55                   	push   %rbp
+  801079:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80107c:	49 89 c0             	mov    %rax,%r8
+  80107f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801084:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  80108b:	00 00 00 
+  80108e:	be 29 00 00 00       	mov    $0x29,%esi
+  801093:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  80109a:	00 00 00 
+  80109d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a2:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  8010a9:	00 00 00 
+  8010ac:	41 ff d1             	call   *%r9
+
+00000000008010af <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010af:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010b2:	48 63 d2             	movslq %edx,%rdx
+  8010b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010b8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010bd:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010c0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010c2:	48 85 c0             	test   %rax,%rax
+  8010c5:	7f 01                	jg     8010c8 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010c7:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010c8:	55                   	push   %rbp
+  8010c9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cc:	49 89 c0             	mov    %rax,%r8
+  8010cf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010d4:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8010db:	00 00 00 
+  8010de:	be 29 00 00 00       	mov    $0x29,%esi
+  8010e3:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8010ea:	00 00 00 
+  8010ed:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f2:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  8010f9:	00 00 00 
+  8010fc:	41 ff d1             	call   *%r9
+
+00000000008010ff <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8010ff:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801102:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801107:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80110d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801113:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801119:	0f 05                	syscall
+    if (check && ret > 0) {
+  80111b:	48 85 c0             	test   %rax,%rax
+  80111e:	7f 01                	jg     801121 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801120:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801121:	55                   	push   %rbp
+  801122:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801125:	49 89 c0             	mov    %rax,%r8
+  801128:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80112d:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801134:	00 00 00 
+  801137:	be 29 00 00 00       	mov    $0x29,%esi
+  80113c:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801143:	00 00 00 
+  801146:	b8 00 00 00 00       	mov    $0x0,%eax
+  80114b:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  801152:	00 00 00 
+  801155:	41 ff d1             	call   *%r9
+
+0000000000801158 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801158:	48 63 f6             	movslq %esi,%rsi
+  80115b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80115e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801163:	ba 00 00 00 00       	mov    $0x0,%edx
+  801168:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80116e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801174:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80117a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80117c:	48 85 c0             	test   %rax,%rax
+  80117f:	7f 01                	jg     801182 <sys_env_set_status+0x2a>
+}
+  801181:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801182:	55                   	push   %rbp
+  801183:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801186:	49 89 c0             	mov    %rax,%r8
+  801189:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80118e:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801195:	00 00 00 
+  801198:	be 29 00 00 00       	mov    $0x29,%esi
+  80119d:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8011a4:	00 00 00 
+  8011a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ac:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  8011b3:	00 00 00 
+  8011b6:	41 ff d1             	call   *%r9
+
+00000000008011b9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011b9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011bc:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011d8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011da:	48 85 c0             	test   %rax,%rax
+  8011dd:	7f 01                	jg     8011e0 <sys_env_set_trapframe+0x27>
+}
+  8011df:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011e0:	55                   	push   %rbp
+  8011e1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e4:	49 89 c0             	mov    %rax,%r8
+  8011e7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8011ec:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8011f3:	00 00 00 
+  8011f6:	be 29 00 00 00       	mov    $0x29,%esi
+  8011fb:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801202:	00 00 00 
+  801205:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120a:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  801211:	00 00 00 
+  801214:	41 ff d1             	call   *%r9
+
+0000000000801217 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801217:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80121a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80121f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801224:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80122a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801230:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801236:	0f 05                	syscall
+    if (check && ret > 0) {
+  801238:	48 85 c0             	test   %rax,%rax
+  80123b:	7f 01                	jg     80123e <sys_env_set_pgfault_upcall+0x27>
+}
+  80123d:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80123e:	55                   	push   %rbp
+  80123f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801242:	49 89 c0             	mov    %rax,%r8
+  801245:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80124a:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801251:	00 00 00 
+  801254:	be 29 00 00 00       	mov    $0x29,%esi
+  801259:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801260:	00 00 00 
+  801263:	b8 00 00 00 00       	mov    $0x0,%eax
+  801268:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  80126f:	00 00 00 
+  801272:	41 ff d1             	call   *%r9
+
+0000000000801275 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801275:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801278:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80127b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801280:	4d 63 c0             	movslq %r8d,%r8
+  801283:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801289:	0f 05                	syscall
+}
+  80128b:	c3                   	ret
+
+000000000080128c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80128c:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80128f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801292:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801297:	4d 63 c0             	movslq %r8d,%r8
+  80129a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a0:	0f 05                	syscall
+}
+  8012a2:	c3                   	ret
+
+00000000008012a3 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a8:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ab:	45 89 c0             	mov    %r8d,%r8d
+  8012ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012b4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012b6:	48 85 c0             	test   %rax,%rax
+  8012b9:	7f 01                	jg     8012bc <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012bb:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012bc:	55                   	push   %rbp
+  8012bd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c0:	49 89 c0             	mov    %rax,%r8
+  8012c3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012c8:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  8012cf:	00 00 00 
+  8012d2:	be 29 00 00 00       	mov    $0x29,%esi
+  8012d7:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  8012de:	00 00 00 
+  8012e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e6:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  8012ed:	00 00 00 
+  8012f0:	41 ff d1             	call   *%r9
+
+00000000008012f3 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8012f3:	55                   	push   %rbp
+  8012f4:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8012f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801302:	ba 00 00 00 00       	mov    $0x0,%edx
+  801307:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  80130e:	00 00 00 
+  801311:	ff d0                	call   *%rax
+}
+  801313:	5d                   	pop    %rbp
+  801314:	c3                   	ret
+
+0000000000801315 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801315:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80131a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80131f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801324:	ba 00 00 00 00       	mov    $0x0,%edx
+  801329:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801335:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80133b:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80133d:	c3                   	ret
+
+000000000080133e <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80133e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801343:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80134d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801353:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801359:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80135f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801361:	48 85 c0             	test   %rax,%rax
+  801364:	7f 01                	jg     801367 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801366:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801367:	55                   	push   %rbp
+  801368:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80136b:	49 89 c0             	mov    %rax,%r8
+  80136e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801373:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  80137a:	00 00 00 
+  80137d:	be 29 00 00 00       	mov    $0x29,%esi
+  801382:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801389:	00 00 00 
+  80138c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801391:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  801398:	00 00 00 
+  80139b:	41 ff d1             	call   *%r9
+
+000000000080139e <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80139e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c4:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c6:	c3                   	ret
+
+00000000008013c7 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013c7:	89 d2                	mov    %edx,%edx
+  8013c9:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013cb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e2:	0f 05                	syscall
+}
+  8013e4:	c3                   	ret
+
+00000000008013e5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8013e5:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801404:	0f 05                	syscall
+}
+  801406:	c3                   	ret
+
+0000000000801407 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801407:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80140a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801414:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80141a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801420:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801426:	0f 05                	syscall
+}
+  801428:	c3                   	ret
+
+0000000000801429 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801429:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80142c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801431:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801436:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801447:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 01                	jg     801455 <sys_irq_ack+0x2c>
+}
+  801454:	c3                   	ret
+sys_irq_ack(int irq) {
+  801455:	55                   	push   %rbp
+  801456:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801459:	49 89 c0             	mov    %rax,%r8
+  80145c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801461:	48 ba 38 4c 80 00 00 	movabs $0x804c38,%rdx
+  801468:	00 00 00 
+  80146b:	be 29 00 00 00       	mov    $0x29,%esi
+  801470:	48 bf 57 4c 80 00 00 	movabs $0x804c57,%rdi
+  801477:	00 00 00 
+  80147a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147f:	49 b9 77 41 80 00 00 	movabs $0x804177,%r9
+  801486:	00 00 00 
+  801489:	41 ff d1             	call   *%r9
+
+000000000080148c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80148c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801493:	ff ff ff 
+  801496:	48 01 f8             	add    %rdi,%rax
+  801499:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80149d:	c3                   	ret
+
+000000000080149e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80149e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014a5:	ff ff ff 
+  8014a8:	48 01 f8             	add    %rdi,%rax
+  8014ab:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014af:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014b5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014b9:	c3                   	ret
+
+00000000008014ba <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014ba:	55                   	push   %rbp
+  8014bb:	48 89 e5             	mov    %rsp,%rbp
+  8014be:	41 57                	push   %r15
+  8014c0:	41 56                	push   %r14
+  8014c2:	41 55                	push   %r13
+  8014c4:	41 54                	push   %r12
+  8014c6:	53                   	push   %rbx
+  8014c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8014cb:	49 89 ff             	mov    %rdi,%r15
+  8014ce:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014d3:	49 bd 49 3c 80 00 00 	movabs $0x803c49,%r13
+  8014da:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014dd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8014e3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8014e6:	48 89 df             	mov    %rbx,%rdi
+  8014e9:	41 ff d5             	call   *%r13
+  8014ec:	83 e0 04             	and    $0x4,%eax
+  8014ef:	74 17                	je     801508 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8014f1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8014f8:	4c 39 f3             	cmp    %r14,%rbx
+  8014fb:	75 e6                	jne    8014e3 <fd_alloc+0x29>
+  8014fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801503:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801508:	4d 89 27             	mov    %r12,(%r15)
+}
+  80150b:	48 83 c4 08          	add    $0x8,%rsp
+  80150f:	5b                   	pop    %rbx
+  801510:	41 5c                	pop    %r12
+  801512:	41 5d                	pop    %r13
+  801514:	41 5e                	pop    %r14
+  801516:	41 5f                	pop    %r15
+  801518:	5d                   	pop    %rbp
+  801519:	c3                   	ret
+
+000000000080151a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80151a:	83 ff 1f             	cmp    $0x1f,%edi
+  80151d:	77 39                	ja     801558 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80151f:	55                   	push   %rbp
+  801520:	48 89 e5             	mov    %rsp,%rbp
+  801523:	41 54                	push   %r12
+  801525:	53                   	push   %rbx
+  801526:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801529:	48 63 df             	movslq %edi,%rbx
+  80152c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801533:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801537:	48 89 df             	mov    %rbx,%rdi
+  80153a:	48 b8 49 3c 80 00 00 	movabs $0x803c49,%rax
+  801541:	00 00 00 
+  801544:	ff d0                	call   *%rax
+  801546:	a8 04                	test   $0x4,%al
+  801548:	74 14                	je     80155e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80154a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80154e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801553:	5b                   	pop    %rbx
+  801554:	41 5c                	pop    %r12
+  801556:	5d                   	pop    %rbp
+  801557:	c3                   	ret
+        return -E_INVAL;
+  801558:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80155d:	c3                   	ret
+        return -E_INVAL;
+  80155e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801563:	eb ee                	jmp    801553 <fd_lookup+0x39>
+
+0000000000801565 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801565:	55                   	push   %rbp
+  801566:	48 89 e5             	mov    %rsp,%rbp
+  801569:	41 54                	push   %r12
+  80156b:	53                   	push   %rbx
+  80156c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80156f:	48 b8 00 4d 80 00 00 	movabs $0x804d00,%rax
+  801576:	00 00 00 
+  801579:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  801580:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801583:	39 3b                	cmp    %edi,(%rbx)
+  801585:	74 47                	je     8015ce <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801587:	48 83 c0 08          	add    $0x8,%rax
+  80158b:	48 8b 18             	mov    (%rax),%rbx
+  80158e:	48 85 db             	test   %rbx,%rbx
+  801591:	75 f0                	jne    801583 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801593:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80159a:	00 00 00 
+  80159d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8015a3:	89 fa                	mov    %edi,%edx
+  8015a5:	48 bf 68 4c 80 00 00 	movabs $0x804c68,%rdi
+  8015ac:	00 00 00 
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	48 b9 d5 01 80 00 00 	movabs $0x8001d5,%rcx
+  8015bb:	00 00 00 
+  8015be:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015c5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015c9:	5b                   	pop    %rbx
+  8015ca:	41 5c                	pop    %r12
+  8015cc:	5d                   	pop    %rbp
+  8015cd:	c3                   	ret
+            return 0;
+  8015ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d3:	eb f0                	jmp    8015c5 <dev_lookup+0x60>
+
+00000000008015d5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015d5:	55                   	push   %rbp
+  8015d6:	48 89 e5             	mov    %rsp,%rbp
+  8015d9:	41 55                	push   %r13
+  8015db:	41 54                	push   %r12
+  8015dd:	53                   	push   %rbx
+  8015de:	48 83 ec 18          	sub    $0x18,%rsp
+  8015e2:	48 89 fb             	mov    %rdi,%rbx
+  8015e5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8015e8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8015ef:	ff ff ff 
+  8015f2:	48 01 df             	add    %rbx,%rdi
+  8015f5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8015f9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8015fd:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  801604:	00 00 00 
+  801607:	ff d0                	call   *%rax
+  801609:	41 89 c5             	mov    %eax,%r13d
+  80160c:	85 c0                	test   %eax,%eax
+  80160e:	78 06                	js     801616 <fd_close+0x41>
+  801610:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801614:	74 1a                	je     801630 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801616:	45 84 e4             	test   %r12b,%r12b
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801622:	44 89 e8             	mov    %r13d,%eax
+  801625:	48 83 c4 18          	add    $0x18,%rsp
+  801629:	5b                   	pop    %rbx
+  80162a:	41 5c                	pop    %r12
+  80162c:	41 5d                	pop    %r13
+  80162e:	5d                   	pop    %rbp
+  80162f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801630:	8b 3b                	mov    (%rbx),%edi
+  801632:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801636:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  80163d:	00 00 00 
+  801640:	ff d0                	call   *%rax
+  801642:	41 89 c5             	mov    %eax,%r13d
+  801645:	85 c0                	test   %eax,%eax
+  801647:	78 1b                	js     801664 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801649:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80164d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801651:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801657:	48 85 c0             	test   %rax,%rax
+  80165a:	74 08                	je     801664 <fd_close+0x8f>
+  80165c:	48 89 df             	mov    %rbx,%rdi
+  80165f:	ff d0                	call   *%rax
+  801661:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801664:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801669:	48 89 de             	mov    %rbx,%rsi
+  80166c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801671:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+    return res;
+  80167d:	eb a3                	jmp    801622 <fd_close+0x4d>
+
+000000000080167f <close>:
+
+int
+close(int fdnum) {
+  80167f:	55                   	push   %rbp
+  801680:	48 89 e5             	mov    %rsp,%rbp
+  801683:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801687:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80168b:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  801692:	00 00 00 
+  801695:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801697:	85 c0                	test   %eax,%eax
+  801699:	78 15                	js     8016b0 <close+0x31>
+
+    return fd_close(fd, 1);
+  80169b:	be 01 00 00 00       	mov    $0x1,%esi
+  8016a0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016a4:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  8016ab:	00 00 00 
+  8016ae:	ff d0                	call   *%rax
+}
+  8016b0:	c9                   	leave
+  8016b1:	c3                   	ret
+
+00000000008016b2 <close_all>:
+
+void
+close_all(void) {
+  8016b2:	55                   	push   %rbp
+  8016b3:	48 89 e5             	mov    %rsp,%rbp
+  8016b6:	41 54                	push   %r12
+  8016b8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016b9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016be:	49 bc 7f 16 80 00 00 	movabs $0x80167f,%r12
+  8016c5:	00 00 00 
+  8016c8:	89 df                	mov    %ebx,%edi
+  8016ca:	41 ff d4             	call   *%r12
+  8016cd:	83 c3 01             	add    $0x1,%ebx
+  8016d0:	83 fb 20             	cmp    $0x20,%ebx
+  8016d3:	75 f3                	jne    8016c8 <close_all+0x16>
+}
+  8016d5:	5b                   	pop    %rbx
+  8016d6:	41 5c                	pop    %r12
+  8016d8:	5d                   	pop    %rbp
+  8016d9:	c3                   	ret
+
+00000000008016da <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016da:	55                   	push   %rbp
+  8016db:	48 89 e5             	mov    %rsp,%rbp
+  8016de:	41 57                	push   %r15
+  8016e0:	41 56                	push   %r14
+  8016e2:	41 55                	push   %r13
+  8016e4:	41 54                	push   %r12
+  8016e6:	53                   	push   %rbx
+  8016e7:	48 83 ec 18          	sub    $0x18,%rsp
+  8016eb:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8016ee:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8016f2:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  8016f9:	00 00 00 
+  8016fc:	ff d0                	call   *%rax
+  8016fe:	89 c3                	mov    %eax,%ebx
+  801700:	85 c0                	test   %eax,%eax
+  801702:	0f 88 b8 00 00 00    	js     8017c0 <dup+0xe6>
+    close(newfdnum);
+  801708:	44 89 e7             	mov    %r12d,%edi
+  80170b:	48 b8 7f 16 80 00 00 	movabs $0x80167f,%rax
+  801712:	00 00 00 
+  801715:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801717:	4d 63 ec             	movslq %r12d,%r13
+  80171a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801721:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801725:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801729:	4c 89 ff             	mov    %r15,%rdi
+  80172c:	49 be 9e 14 80 00 00 	movabs $0x80149e,%r14
+  801733:	00 00 00 
+  801736:	41 ff d6             	call   *%r14
+  801739:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80173c:	4c 89 ef             	mov    %r13,%rdi
+  80173f:	41 ff d6             	call   *%r14
+  801742:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801745:	48 89 df             	mov    %rbx,%rdi
+  801748:	48 b8 49 3c 80 00 00 	movabs $0x803c49,%rax
+  80174f:	00 00 00 
+  801752:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801754:	a8 04                	test   $0x4,%al
+  801756:	74 2b                	je     801783 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801758:	41 89 c1             	mov    %eax,%r9d
+  80175b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801761:	4c 89 f1             	mov    %r14,%rcx
+  801764:	ba 00 00 00 00       	mov    $0x0,%edx
+  801769:	48 89 de             	mov    %rbx,%rsi
+  80176c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801771:	48 b8 af 10 80 00 00 	movabs $0x8010af,%rax
+  801778:	00 00 00 
+  80177b:	ff d0                	call   *%rax
+  80177d:	89 c3                	mov    %eax,%ebx
+  80177f:	85 c0                	test   %eax,%eax
+  801781:	78 4e                	js     8017d1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801783:	4c 89 ff             	mov    %r15,%rdi
+  801786:	48 b8 49 3c 80 00 00 	movabs $0x803c49,%rax
+  80178d:	00 00 00 
+  801790:	ff d0                	call   *%rax
+  801792:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801795:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80179b:	4c 89 e9             	mov    %r13,%rcx
+  80179e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a3:	4c 89 fe             	mov    %r15,%rsi
+  8017a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017ab:	48 b8 af 10 80 00 00 	movabs $0x8010af,%rax
+  8017b2:	00 00 00 
+  8017b5:	ff d0                	call   *%rax
+  8017b7:	89 c3                	mov    %eax,%ebx
+  8017b9:	85 c0                	test   %eax,%eax
+  8017bb:	78 14                	js     8017d1 <dup+0xf7>
+
+    return newfdnum;
+  8017bd:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017c0:	89 d8                	mov    %ebx,%eax
+  8017c2:	48 83 c4 18          	add    $0x18,%rsp
+  8017c6:	5b                   	pop    %rbx
+  8017c7:	41 5c                	pop    %r12
+  8017c9:	41 5d                	pop    %r13
+  8017cb:	41 5e                	pop    %r14
+  8017cd:	41 5f                	pop    %r15
+  8017cf:	5d                   	pop    %rbp
+  8017d0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017d6:	4c 89 ee             	mov    %r13,%rsi
+  8017d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017de:	49 bc ff 10 80 00 00 	movabs $0x8010ff,%r12
+  8017e5:	00 00 00 
+  8017e8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8017eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017f0:	4c 89 f6             	mov    %r14,%rsi
+  8017f3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017f8:	41 ff d4             	call   *%r12
+    return res;
+  8017fb:	eb c3                	jmp    8017c0 <dup+0xe6>
+
+00000000008017fd <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8017fd:	55                   	push   %rbp
+  8017fe:	48 89 e5             	mov    %rsp,%rbp
+  801801:	41 56                	push   %r14
+  801803:	41 55                	push   %r13
+  801805:	41 54                	push   %r12
+  801807:	53                   	push   %rbx
+  801808:	48 83 ec 10          	sub    $0x10,%rsp
+  80180c:	89 fb                	mov    %edi,%ebx
+  80180e:	49 89 f4             	mov    %rsi,%r12
+  801811:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801814:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801818:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  80181f:	00 00 00 
+  801822:	ff d0                	call   *%rax
+  801824:	85 c0                	test   %eax,%eax
+  801826:	78 4c                	js     801874 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801828:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80182c:	41 8b 3e             	mov    (%r14),%edi
+  80182f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801833:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  80183a:	00 00 00 
+  80183d:	ff d0                	call   *%rax
+  80183f:	85 c0                	test   %eax,%eax
+  801841:	78 35                	js     801878 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801843:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801847:	83 e0 03             	and    $0x3,%eax
+  80184a:	83 f8 01             	cmp    $0x1,%eax
+  80184d:	74 2d                	je     80187c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80184f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801853:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801857:	48 85 c0             	test   %rax,%rax
+  80185a:	74 56                	je     8018b2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80185c:	4c 89 ea             	mov    %r13,%rdx
+  80185f:	4c 89 e6             	mov    %r12,%rsi
+  801862:	4c 89 f7             	mov    %r14,%rdi
+  801865:	ff d0                	call   *%rax
+}
+  801867:	48 83 c4 10          	add    $0x10,%rsp
+  80186b:	5b                   	pop    %rbx
+  80186c:	41 5c                	pop    %r12
+  80186e:	41 5d                	pop    %r13
+  801870:	41 5e                	pop    %r14
+  801872:	5d                   	pop    %rbp
+  801873:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801874:	48 98                	cltq
+  801876:	eb ef                	jmp    801867 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801878:	48 98                	cltq
+  80187a:	eb eb                	jmp    801867 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80187c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801883:	00 00 00 
+  801886:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80188c:	89 da                	mov    %ebx,%edx
+  80188e:	48 bf a9 4c 80 00 00 	movabs $0x804ca9,%rdi
+  801895:	00 00 00 
+  801898:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189d:	48 b9 d5 01 80 00 00 	movabs $0x8001d5,%rcx
+  8018a4:	00 00 00 
+  8018a7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018a9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018b0:	eb b5                	jmp    801867 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018b2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018b9:	eb ac                	jmp    801867 <read+0x6a>
+
+00000000008018bb <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018bb:	55                   	push   %rbp
+  8018bc:	48 89 e5             	mov    %rsp,%rbp
+  8018bf:	41 57                	push   %r15
+  8018c1:	41 56                	push   %r14
+  8018c3:	41 55                	push   %r13
+  8018c5:	41 54                	push   %r12
+  8018c7:	53                   	push   %rbx
+  8018c8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018cc:	48 85 d2             	test   %rdx,%rdx
+  8018cf:	74 54                	je     801925 <readn+0x6a>
+  8018d1:	41 89 fd             	mov    %edi,%r13d
+  8018d4:	49 89 f6             	mov    %rsi,%r14
+  8018d7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018da:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018df:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8018e4:	49 bf fd 17 80 00 00 	movabs $0x8017fd,%r15
+  8018eb:	00 00 00 
+  8018ee:	4c 89 e2             	mov    %r12,%rdx
+  8018f1:	48 29 f2             	sub    %rsi,%rdx
+  8018f4:	4c 01 f6             	add    %r14,%rsi
+  8018f7:	44 89 ef             	mov    %r13d,%edi
+  8018fa:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8018fd:	85 c0                	test   %eax,%eax
+  8018ff:	78 20                	js     801921 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801901:	01 c3                	add    %eax,%ebx
+  801903:	85 c0                	test   %eax,%eax
+  801905:	74 08                	je     80190f <readn+0x54>
+  801907:	48 63 f3             	movslq %ebx,%rsi
+  80190a:	4c 39 e6             	cmp    %r12,%rsi
+  80190d:	72 df                	jb     8018ee <readn+0x33>
+    }
+    return res;
+  80190f:	48 63 c3             	movslq %ebx,%rax
+}
+  801912:	48 83 c4 08          	add    $0x8,%rsp
+  801916:	5b                   	pop    %rbx
+  801917:	41 5c                	pop    %r12
+  801919:	41 5d                	pop    %r13
+  80191b:	41 5e                	pop    %r14
+  80191d:	41 5f                	pop    %r15
+  80191f:	5d                   	pop    %rbp
+  801920:	c3                   	ret
+        if (inc < 0) return inc;
+  801921:	48 98                	cltq
+  801923:	eb ed                	jmp    801912 <readn+0x57>
+    int inc = 1, res = 0;
+  801925:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80192a:	eb e3                	jmp    80190f <readn+0x54>
+
+000000000080192c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80192c:	55                   	push   %rbp
+  80192d:	48 89 e5             	mov    %rsp,%rbp
+  801930:	41 56                	push   %r14
+  801932:	41 55                	push   %r13
+  801934:	41 54                	push   %r12
+  801936:	53                   	push   %rbx
+  801937:	48 83 ec 10          	sub    $0x10,%rsp
+  80193b:	89 fb                	mov    %edi,%ebx
+  80193d:	49 89 f4             	mov    %rsi,%r12
+  801940:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801943:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801947:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  80194e:	00 00 00 
+  801951:	ff d0                	call   *%rax
+  801953:	85 c0                	test   %eax,%eax
+  801955:	78 47                	js     80199e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801957:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80195b:	41 8b 3e             	mov    (%r14),%edi
+  80195e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801962:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  801969:	00 00 00 
+  80196c:	ff d0                	call   *%rax
+  80196e:	85 c0                	test   %eax,%eax
+  801970:	78 30                	js     8019a2 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801972:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801977:	74 2d                	je     8019a6 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801979:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80197d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801981:	48 85 c0             	test   %rax,%rax
+  801984:	74 56                	je     8019dc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801986:	4c 89 ea             	mov    %r13,%rdx
+  801989:	4c 89 e6             	mov    %r12,%rsi
+  80198c:	4c 89 f7             	mov    %r14,%rdi
+  80198f:	ff d0                	call   *%rax
+}
+  801991:	48 83 c4 10          	add    $0x10,%rsp
+  801995:	5b                   	pop    %rbx
+  801996:	41 5c                	pop    %r12
+  801998:	41 5d                	pop    %r13
+  80199a:	41 5e                	pop    %r14
+  80199c:	5d                   	pop    %rbp
+  80199d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80199e:	48 98                	cltq
+  8019a0:	eb ef                	jmp    801991 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019a2:	48 98                	cltq
+  8019a4:	eb eb                	jmp    801991 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019a6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019ad:	00 00 00 
+  8019b0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019b6:	89 da                	mov    %ebx,%edx
+  8019b8:	48 bf c5 4c 80 00 00 	movabs $0x804cc5,%rdi
+  8019bf:	00 00 00 
+  8019c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019c7:	48 b9 d5 01 80 00 00 	movabs $0x8001d5,%rcx
+  8019ce:	00 00 00 
+  8019d1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019d3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019da:	eb b5                	jmp    801991 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019dc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8019e3:	eb ac                	jmp    801991 <write+0x65>
+
+00000000008019e5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8019e5:	55                   	push   %rbp
+  8019e6:	48 89 e5             	mov    %rsp,%rbp
+  8019e9:	41 54                	push   %r12
+  8019eb:	53                   	push   %rbx
+  8019ec:	48 83 ec 10          	sub    $0x10,%rsp
+  8019f0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019f2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8019f6:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  8019fd:	00 00 00 
+  801a00:	ff d0                	call   *%rax
+  801a02:	85 c0                	test   %eax,%eax
+  801a04:	78 3e                	js     801a44 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a06:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a0a:	41 8b 3c 24          	mov    (%r12),%edi
+  801a0e:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a12:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  801a19:	00 00 00 
+  801a1c:	ff d0                	call   *%rax
+  801a1e:	85 c0                	test   %eax,%eax
+  801a20:	78 22                	js     801a44 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a22:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a26:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a2a:	48 85 c0             	test   %rax,%rax
+  801a2d:	74 0b                	je     801a3a <seek+0x55>
+  801a2f:	89 de                	mov    %ebx,%esi
+  801a31:	4c 89 e7             	mov    %r12,%rdi
+  801a34:	ff d0                	call   *%rax
+  801a36:	85 c0                	test   %eax,%eax
+  801a38:	78 0a                	js     801a44 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a3a:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a44:	48 83 c4 10          	add    $0x10,%rsp
+  801a48:	5b                   	pop    %rbx
+  801a49:	41 5c                	pop    %r12
+  801a4b:	5d                   	pop    %rbp
+  801a4c:	c3                   	ret
+
+0000000000801a4d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a4d:	55                   	push   %rbp
+  801a4e:	48 89 e5             	mov    %rsp,%rbp
+  801a51:	41 55                	push   %r13
+  801a53:	41 54                	push   %r12
+  801a55:	53                   	push   %rbx
+  801a56:	48 83 ec 18          	sub    $0x18,%rsp
+  801a5a:	89 fb                	mov    %edi,%ebx
+  801a5c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a5f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a63:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  801a6a:	00 00 00 
+  801a6d:	ff d0                	call   *%rax
+  801a6f:	85 c0                	test   %eax,%eax
+  801a71:	78 38                	js     801aab <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a73:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a77:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a7b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a7f:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  801a86:	00 00 00 
+  801a89:	ff d0                	call   *%rax
+  801a8b:	85 c0                	test   %eax,%eax
+  801a8d:	78 1c                	js     801aab <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801a8f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801a94:	74 20                	je     801ab6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801a96:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a9a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801a9e:	48 85 c0             	test   %rax,%rax
+  801aa1:	74 47                	je     801aea <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801aa3:	44 89 e6             	mov    %r12d,%esi
+  801aa6:	4c 89 ef             	mov    %r13,%rdi
+  801aa9:	ff d0                	call   *%rax
+}
+  801aab:	48 83 c4 18          	add    $0x18,%rsp
+  801aaf:	5b                   	pop    %rbx
+  801ab0:	41 5c                	pop    %r12
+  801ab2:	41 5d                	pop    %r13
+  801ab4:	5d                   	pop    %rbp
+  801ab5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ab6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801abd:	00 00 00 
+  801ac0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ac6:	89 da                	mov    %ebx,%edx
+  801ac8:	48 bf 88 4c 80 00 00 	movabs $0x804c88,%rdi
+  801acf:	00 00 00 
+  801ad2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ad7:	48 b9 d5 01 80 00 00 	movabs $0x8001d5,%rcx
+  801ade:	00 00 00 
+  801ae1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ae3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ae8:	eb c1                	jmp    801aab <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801aea:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801aef:	eb ba                	jmp    801aab <ftruncate+0x5e>
+
+0000000000801af1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801af1:	55                   	push   %rbp
+  801af2:	48 89 e5             	mov    %rsp,%rbp
+  801af5:	41 54                	push   %r12
+  801af7:	53                   	push   %rbx
+  801af8:	48 83 ec 10          	sub    $0x10,%rsp
+  801afc:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aff:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b03:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  801b0a:	00 00 00 
+  801b0d:	ff d0                	call   *%rax
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	78 4e                	js     801b61 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b13:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b17:	41 8b 3c 24          	mov    (%r12),%edi
+  801b1b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b1f:	48 b8 65 15 80 00 00 	movabs $0x801565,%rax
+  801b26:	00 00 00 
+  801b29:	ff d0                	call   *%rax
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 32                	js     801b61 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b2f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b33:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b38:	74 30                	je     801b6a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b3a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b3d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b44:	00 00 00 
+    stat->st_isdir = 0;
+  801b47:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b4e:	00 00 00 
+    stat->st_dev = dev;
+  801b51:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b58:	48 89 de             	mov    %rbx,%rsi
+  801b5b:	4c 89 e7             	mov    %r12,%rdi
+  801b5e:	ff 50 28             	call   *0x28(%rax)
+}
+  801b61:	48 83 c4 10          	add    $0x10,%rsp
+  801b65:	5b                   	pop    %rbx
+  801b66:	41 5c                	pop    %r12
+  801b68:	5d                   	pop    %rbp
+  801b69:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b6a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b6f:	eb f0                	jmp    801b61 <fstat+0x70>
+
+0000000000801b71 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b71:	55                   	push   %rbp
+  801b72:	48 89 e5             	mov    %rsp,%rbp
+  801b75:	41 54                	push   %r12
+  801b77:	53                   	push   %rbx
+  801b78:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b7b:	be 00 00 00 00       	mov    $0x0,%esi
+  801b80:	48 b8 df 2c 80 00 00 	movabs $0x802cdf,%rax
+  801b87:	00 00 00 
+  801b8a:	ff d0                	call   *%rax
+  801b8c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801b8e:	85 c0                	test   %eax,%eax
+  801b90:	78 25                	js     801bb7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801b92:	4c 89 e6             	mov    %r12,%rsi
+  801b95:	89 c7                	mov    %eax,%edi
+  801b97:	48 b8 f1 1a 80 00 00 	movabs $0x801af1,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ba6:	89 df                	mov    %ebx,%edi
+  801ba8:	48 b8 7f 16 80 00 00 	movabs $0x80167f,%rax
+  801baf:	00 00 00 
+  801bb2:	ff d0                	call   *%rax
+
+    return res;
+  801bb4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bb7:	89 d8                	mov    %ebx,%eax
+  801bb9:	5b                   	pop    %rbx
+  801bba:	41 5c                	pop    %r12
+  801bbc:	5d                   	pop    %rbp
+  801bbd:	c3                   	ret
+
+0000000000801bbe <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bbe:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801bc5:	00 00 00 
+  801bc8:	83 38 00             	cmpl   $0x0,(%rax)
+  801bcb:	74 0a                	je     801bd7 <fsenv+0x19>
+    return envid;
+}
+  801bcd:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bd4:	00 00 
+  801bd6:	c3                   	ret
+fsenv(void) {
+  801bd7:	55                   	push   %rbp
+  801bd8:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bdb:	bf 03 00 00 00       	mov    $0x3,%edi
+  801be0:	48 b8 4f 46 80 00 00 	movabs $0x80464f,%rax
+  801be7:	00 00 00 
+  801bea:	ff d0                	call   *%rax
+  801bec:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801bf3:	00 00 
+}
+  801bf5:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bfc:	00 00 
+  801bfe:	5d                   	pop    %rbp
+  801bff:	c3                   	ret
+
+0000000000801c00 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801c00:	55                   	push   %rbp
+  801c01:	48 89 e5             	mov    %rsp,%rbp
+  801c04:	41 54                	push   %r12
+  801c06:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c07:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c0c:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c11:	48 89 de             	mov    %rbx,%rsi
+  801c14:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c19:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  801c20:	00 00 00 
+  801c23:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c25:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c2c:	00 00 00 
+  801c2f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c35:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c3a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c3f:	48 89 de             	mov    %rbx,%rsi
+  801c42:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c47:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  801c4e:	00 00 00 
+  801c51:	ff d0                	call   *%rax
+  801c53:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c55:	85 c0                	test   %eax,%eax
+  801c57:	0f 88 a2 00 00 00    	js     801cff <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c5d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c64:	00 00 00 
+  801c67:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c6d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c72:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c74:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c79:	49 bc 11 3e 80 00 00 	movabs $0x803e11,%r12
+  801c80:	00 00 00 
+  801c83:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801c86:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801c8b:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c8e:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  801c95:	00 00 00 
+  801c98:	ff d0                	call   *%rax
+  801c9a:	89 c7                	mov    %eax,%edi
+  801c9c:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801ca2:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ca7:	48 89 da             	mov    %rbx,%rdx
+  801caa:	be 09 00 00 00       	mov    $0x9,%esi
+  801caf:	48 b8 f9 45 80 00 00 	movabs $0x8045f9,%rax
+  801cb6:	00 00 00 
+  801cb9:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cc0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cc5:	be 00 00 00 00       	mov    $0x0,%esi
+  801cca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ccf:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  801cd6:	00 00 00 
+  801cd9:	ff d0                	call   *%rax
+  801cdb:	89 c3                	mov    %eax,%ebx
+  801cdd:	85 c0                	test   %eax,%eax
+  801cdf:	78 25                	js     801d06 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801ce1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ce8:	00 00 00 
+  801ceb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801cf1:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801cf8:	00 00 
+    return 0;
+  801cfa:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801cff:	89 d8                	mov    %ebx,%eax
+  801d01:	5b                   	pop    %rbx
+  801d02:	41 5c                	pop    %r12
+  801d04:	5d                   	pop    %rbp
+  801d05:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d06:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d0b:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d10:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d15:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  801d1c:	00 00 00 
+  801d1f:	ff d0                	call   *%rax
+        return res;
+  801d21:	eb dc                	jmp    801cff <fschan_setup+0xff>
+
+0000000000801d23 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d23:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d2a:	00 00 00 
+  801d2d:	80 38 00             	cmpb   $0x0,(%rax)
+  801d30:	74 55                	je     801d87 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d32:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d39:	00 00 00 
+  801d3c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d42:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d47:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d4e:	00 00 00 
+  801d51:	3b 0a                	cmp    (%rdx),%ecx
+  801d53:	75 01                	jne    801d56 <fschan+0x33>
+}
+  801d55:	c3                   	ret
+fschan(void) {
+  801d56:	55                   	push   %rbp
+  801d57:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d5a:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  801d61:	00 00 00 
+  801d64:	ff d0                	call   *%rax
+  801d66:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d68:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d6d:	85 d2                	test   %edx,%edx
+  801d6f:	78 02                	js     801d73 <fschan+0x50>
+}
+  801d71:	5d                   	pop    %rbp
+  801d72:	c3                   	ret
+        fschan_enabled = 0;
+  801d73:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d7a:	00 00 00 
+  801d7d:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d80:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d85:	eb ea                	jmp    801d71 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801d87:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d8c:	c3                   	ret
+
+0000000000801d8d <fbuf>:
+fbuf(struct Fd *fd) {
+  801d8d:	55                   	push   %rbp
+  801d8e:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801d91:	48 b8 8c 14 80 00 00 	movabs $0x80148c,%rax
+  801d98:	00 00 00 
+  801d9b:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801d9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801da6:	77 12                	ja     801dba <fbuf+0x2d>
+  801da8:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801dac:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801db3:	00 00 00 
+  801db6:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801dba:	48 89 d0             	mov    %rdx,%rax
+  801dbd:	5d                   	pop    %rbp
+  801dbe:	c3                   	ret
+
+0000000000801dbf <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801dbf:	55                   	push   %rbp
+  801dc0:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801dc3:	48 83 c7 40          	add    $0x40,%rdi
+  801dc7:	48 b8 4b 3e 80 00 00 	movabs $0x803e4b,%rax
+  801dce:	00 00 00 
+  801dd1:	ff d0                	call   *%rax
+  801dd3:	84 c0                	test   %al,%al
+  801dd5:	75 02                	jne    801dd9 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801dd7:	5d                   	pop    %rbp
+  801dd8:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801dd9:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  801de0:	00 00 00 
+  801de3:	ff d0                	call   *%rax
+  801de5:	89 c7                	mov    %eax,%edi
+  801de7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ded:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801df2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801df7:	be 0a 00 00 00       	mov    $0xa,%esi
+  801dfc:	48 b8 f9 45 80 00 00 	movabs $0x8045f9,%rax
+  801e03:	00 00 00 
+  801e06:	ff d0                	call   *%rax
+}
+  801e08:	eb cd                	jmp    801dd7 <fschan_publish+0x18>
+
+0000000000801e0a <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e0a:	55                   	push   %rbp
+  801e0b:	48 89 e5             	mov    %rsp,%rbp
+  801e0e:	41 57                	push   %r15
+  801e10:	41 56                	push   %r14
+  801e12:	41 55                	push   %r13
+  801e14:	41 54                	push   %r12
+  801e16:	53                   	push   %rbx
+  801e17:	48 83 ec 48          	sub    $0x48,%rsp
+  801e1b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e1f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e23:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e26:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e2a:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e2d:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e34:	00 00 00 
+  801e37:	8b 02                	mov    (%rdx),%eax
+  801e39:	83 c0 01             	add    $0x1,%eax
+  801e3c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e41:	0f 44 c1             	cmove  %ecx,%eax
+  801e44:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e46:	4d 85 c0             	test   %r8,%r8
+  801e49:	74 2c                	je     801e77 <fschan_rw+0x6d>
+  801e4b:	45 89 ce             	mov    %r9d,%r14d
+  801e4e:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e55:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e59:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e5f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e66:	00 
+  801e67:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e72:	e9 41 01 00 00       	jmp    801fb8 <fschan_rw+0x1ae>
+  801e77:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e7b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e7f:	e9 9c 01 00 00       	jmp    802020 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801e84:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801e88:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801e8b:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801e8e:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801e91:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801e95:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801e99:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801e9d:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801ea1:	48 89 da             	mov    %rbx,%rdx
+  801ea4:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801eb0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801eb4:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+            queued += blk;
+  801ec0:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ec3:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ec7:	4d 39 fc             	cmp    %r15,%r12
+  801eca:	73 6b                	jae    801f37 <fschan_rw+0x12d>
+  801ecc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801ed0:	77 65                	ja     801f37 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801ed2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ed6:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801eda:	48 b8 26 3e 80 00 00 	movabs $0x803e26,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801ee6:	4c 89 fb             	mov    %r15,%rbx
+  801ee9:	4c 29 e3             	sub    %r12,%rbx
+  801eec:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801ef1:	48 39 d3             	cmp    %rdx,%rbx
+  801ef4:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801ef8:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801efc:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801f00:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801f04:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f07:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f09:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f10:	00 00 00 
+  801f13:	8b 09                	mov    (%rcx),%ecx
+  801f15:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f18:	83 fe 03             	cmp    $0x3,%esi
+  801f1b:	0f 85 63 ff ff ff    	jne    801e84 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f21:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f25:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f28:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f2b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f2e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f32:	e9 79 ff ff ff       	jmp    801eb0 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f37:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f3b:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f42:	48 89 df             	mov    %rbx,%rdi
+  801f45:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f51:	48 89 df             	mov    %rbx,%rdi
+  801f54:	48 b8 77 3e 80 00 00 	movabs $0x803e77,%rax
+  801f5b:	00 00 00 
+  801f5e:	ff d0                	call   *%rax
+  801f60:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f64:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f68:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f6c:	75 25                	jne    801f93 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f6e:	8b 40 04             	mov    0x4(%rax),%eax
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	0f 88 86 00 00 00    	js     801fff <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f79:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f7d:	74 5b                	je     801fda <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f7f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801f83:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801f87:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801f8b:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801f8f:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801f93:	48 89 df             	mov    %rbx,%rdi
+  801f96:	48 b8 9e 3e 80 00 00 	movabs $0x803e9e,%rax
+  801f9d:	00 00 00 
+  801fa0:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801fa2:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801fa6:	83 f0 01             	xor    $0x1,%eax
+  801fa9:	4d 39 fc             	cmp    %r15,%r12
+  801fac:	0f 92 c2             	setb   %dl
+  801faf:	84 c2                	test   %al,%dl
+  801fb1:	75 05                	jne    801fb8 <fschan_rw+0x1ae>
+  801fb3:	45 85 ed             	test   %r13d,%r13d
+  801fb6:	74 50                	je     802008 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fb8:	4d 39 fc             	cmp    %r15,%r12
+  801fbb:	0f 92 c1             	setb   %cl
+  801fbe:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fc2:	0f 96 c2             	setbe  %dl
+  801fc5:	84 d1                	test   %dl,%cl
+  801fc7:	0f 84 6a ff ff ff    	je     801f37 <fschan_rw+0x12d>
+  801fcd:	84 c0                	test   %al,%al
+  801fcf:	0f 85 fd fe ff ff    	jne    801ed2 <fschan_rw+0xc8>
+  801fd5:	e9 5d ff ff ff       	jmp    801f37 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801fda:	48 63 d0             	movslq %eax,%rdx
+  801fdd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fe1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  801fe5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801fe9:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  801fed:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  801ff1:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  801ff8:	00 00 00 
+  801ffb:	ff d0                	call   *%rax
+  801ffd:	eb 80                	jmp    801f7f <fschan_rw+0x175>
+                err = msg->fm_res;
+  801fff:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802002:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802006:	eb 8b                	jmp    801f93 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802008:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80200d:	0f 85 68 fe ff ff    	jne    801e7b <fschan_rw+0x71>
+  802013:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802016:	85 c0                	test   %eax,%eax
+  802018:	0f 84 5d fe ff ff    	je     801e7b <fschan_rw+0x71>
+  80201e:	48 98                	cltq
+}
+  802020:	48 83 c4 48          	add    $0x48,%rsp
+  802024:	5b                   	pop    %rbx
+  802025:	41 5c                	pop    %r12
+  802027:	41 5d                	pop    %r13
+  802029:	41 5e                	pop    %r14
+  80202b:	41 5f                	pop    %r15
+  80202d:	5d                   	pop    %rbp
+  80202e:	c3                   	ret
+
+000000000080202f <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80202f:	55                   	push   %rbp
+  802030:	48 89 e5             	mov    %rsp,%rbp
+  802033:	41 56                	push   %r14
+  802035:	41 55                	push   %r13
+  802037:	41 54                	push   %r12
+  802039:	53                   	push   %rbx
+  80203a:	48 83 ec 10          	sub    $0x10,%rsp
+  80203e:	49 89 fe             	mov    %rdi,%r14
+  802041:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802044:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802048:	48 29 f3             	sub    %rsi,%rbx
+  80204b:	48 39 d3             	cmp    %rdx,%rbx
+  80204e:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802052:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802059:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80205a:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80205f:	49 bd a8 3c 80 00 00 	movabs $0x803ca8,%r13
+  802066:	00 00 00 
+  802069:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802070:	76 1e                	jbe    802090 <mmap_fault+0x61>
+  802072:	4c 01 e7             	add    %r12,%rdi
+  802075:	41 ff d5             	call   *%r13
+  802078:	84 c0                	test   %al,%al
+  80207a:	75 14                	jne    802090 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80207c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802080:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802087:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80208b:	48 39 df             	cmp    %rbx,%rdi
+  80208e:	72 e2                	jb     802072 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802090:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802097:	00 00 00 
+  80209a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8020a1:	00 00 00 
+  8020a4:	4c 89 f0             	mov    %r14,%rax
+  8020a7:	48 29 d0             	sub    %rdx,%rax
+  8020aa:	48 c1 f8 03          	sar    $0x3,%rax
+  8020ae:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020b5:	aa aa aa 
+  8020b8:	48 0f af c2          	imul   %rdx,%rax
+  8020bc:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020c0:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020c5:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020c9:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020cb:	44 89 e0             	mov    %r12d,%eax
+  8020ce:	41 03 46 10          	add    0x10(%r14),%eax
+  8020d2:	41 2b 06             	sub    (%r14),%eax
+  8020d5:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020d8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020dc:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020e0:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8020e4:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8020e7:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  8020ee:	00 00 00 
+  8020f1:	ff d0                	call   *%rax
+  8020f3:	89 c7                	mov    %eax,%edi
+  8020f5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8020fb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802100:	48 89 da             	mov    %rbx,%rdx
+  802103:	be 0f 00 00 00       	mov    $0xf,%esi
+  802108:	48 b8 f9 45 80 00 00 	movabs $0x8045f9,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802114:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802119:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80211d:	4c 89 e6             	mov    %r12,%rsi
+  802120:	bf 00 00 00 00       	mov    $0x0,%edi
+  802125:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	48 98                	cltq
+}
+  802133:	48 83 c4 10          	add    $0x10,%rsp
+  802137:	5b                   	pop    %rbx
+  802138:	41 5c                	pop    %r12
+  80213a:	41 5d                	pop    %r13
+  80213c:	41 5e                	pop    %r14
+  80213e:	5d                   	pop    %rbp
+  80213f:	c3                   	ret
+
+0000000000802140 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802140:	48 8b 37             	mov    (%rdi),%rsi
+  802143:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80214a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802151:	00 00 00 
+  802154:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802159:	eb 0f                	jmp    80216a <mmap_pgfault+0x2a>
+  80215b:	c3                   	ret
+  80215c:	48 83 c1 01          	add    $0x1,%rcx
+  802160:	48 83 c2 18          	add    $0x18,%rdx
+  802164:	48 83 f9 20          	cmp    $0x20,%rcx
+  802168:	74 6e                	je     8021d8 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80216a:	48 8b 02             	mov    (%rdx),%rax
+  80216d:	48 83 e8 01          	sub    $0x1,%rax
+  802171:	48 39 f0             	cmp    %rsi,%rax
+  802174:	73 e6                	jae    80215c <mmap_pgfault+0x1c>
+  802176:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80217a:	73 e0                	jae    80215c <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80217c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802180:	b8 00 00 00 00       	mov    $0x0,%eax
+  802185:	f6 c2 01             	test   $0x1,%dl
+  802188:	75 d1                	jne    80215b <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80218a:	f6 c2 02             	test   $0x2,%dl
+  80218d:	74 1a                	je     8021a9 <mmap_pgfault+0x69>
+  80218f:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802193:	b8 00 00 00 00       	mov    $0x0,%eax
+  802198:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80219f:	00 00 00 
+  8021a2:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021a7:	74 35                	je     8021de <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021a9:	55                   	push   %rbp
+  8021aa:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021ad:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021b1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021b8:	00 00 00 
+  8021bb:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021bf:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021c4:	48 b8 2f 20 80 00 00 	movabs $0x80202f,%rax
+  8021cb:	00 00 00 
+  8021ce:	ff d0                	call   *%rax
+  8021d0:	48 85 c0             	test   %rax,%rax
+  8021d3:	0f 9f c0             	setg   %al
+}
+  8021d6:	5d                   	pop    %rbp
+  8021d7:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dd:	c3                   	ret
+}
+  8021de:	c3                   	ret
+
+00000000008021df <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021df:	55                   	push   %rbp
+  8021e0:	48 89 e5             	mov    %rsp,%rbp
+  8021e3:	41 54                	push   %r12
+  8021e5:	53                   	push   %rbx
+  8021e6:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021e9:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021f0:	00 00 00 
+  8021f3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8021f8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8021fc:	74 15                	je     802213 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8021fe:	48 83 c3 01          	add    $0x1,%rbx
+  802202:	48 83 c0 18          	add    $0x18,%rax
+  802206:	48 83 fb 20          	cmp    $0x20,%rbx
+  80220a:	75 ec                	jne    8021f8 <mmap_alloc+0x19>
+    return NULL;
+  80220c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802211:	eb 52                	jmp    802265 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802213:	4c 89 e7             	mov    %r12,%rdi
+  802216:	48 b8 49 3c 80 00 00 	movabs $0x803c49,%rax
+  80221d:	00 00 00 
+  802220:	ff d0                	call   *%rax
+  802222:	41 89 c1             	mov    %eax,%r9d
+  802225:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80222c:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802230:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223b:	4c 89 e6             	mov    %r12,%rsi
+  80223e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802243:	48 b8 af 10 80 00 00 	movabs $0x8010af,%rax
+  80224a:	00 00 00 
+  80224d:	ff d0                	call   *%rax
+  80224f:	85 c0                	test   %eax,%eax
+  802251:	78 17                	js     80226a <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802253:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802257:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80225e:	00 00 00 
+  802261:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802265:	5b                   	pop    %rbx
+  802266:	41 5c                	pop    %r12
+  802268:	5d                   	pop    %rbp
+  802269:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80226a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226f:	eb f4                	jmp    802265 <mmap_alloc+0x86>
+
+0000000000802271 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802271:	55                   	push   %rbp
+  802272:	48 89 e5             	mov    %rsp,%rbp
+  802275:	41 56                	push   %r14
+  802277:	41 55                	push   %r13
+  802279:	41 54                	push   %r12
+  80227b:	53                   	push   %rbx
+  80227c:	48 83 ec 10          	sub    $0x10,%rsp
+  802280:	41 89 fc             	mov    %edi,%r12d
+  802283:	49 89 f5             	mov    %rsi,%r13
+  802286:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802289:	48 89 f0             	mov    %rsi,%rax
+  80228c:	48 09 d0             	or     %rdx,%rax
+  80228f:	75 0d                	jne    80229e <fsipc+0x2d>
+  802291:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802294:	83 f8 04             	cmp    $0x4,%eax
+  802297:	76 7d                	jbe    802316 <fsipc+0xa5>
+  802299:	83 ff 0d             	cmp    $0xd,%edi
+  80229c:	74 78                	je     802316 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80229e:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  8022a5:	00 00 00 
+  8022a8:	ff d0                	call   *%rax
+  8022aa:	89 c7                	mov    %eax,%edi
+  8022ac:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022b3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022ba:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022c1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022c7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022ce:	00 00 00 
+  8022d1:	44 89 e6             	mov    %r12d,%esi
+  8022d4:	48 b8 f9 45 80 00 00 	movabs $0x8045f9,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022e0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022e7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8022e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022ed:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8022f1:	4c 89 ee             	mov    %r13,%rsi
+  8022f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022f9:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  802300:	00 00 00 
+  802303:	ff d0                	call   *%rax
+  802305:	89 c3                	mov    %eax,%ebx
+}
+  802307:	89 d8                	mov    %ebx,%eax
+  802309:	48 83 c4 10          	add    $0x10,%rsp
+  80230d:	5b                   	pop    %rbx
+  80230e:	41 5c                	pop    %r12
+  802310:	41 5d                	pop    %r13
+  802312:	41 5e                	pop    %r14
+  802314:	5d                   	pop    %rbp
+  802315:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802316:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  80231d:	00 00 00 
+  802320:	ff d0                	call   *%rax
+  802322:	49 89 c6             	mov    %rax,%r14
+  802325:	48 85 c0             	test   %rax,%rax
+  802328:	0f 84 70 ff ff ff    	je     80229e <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80232e:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802332:	48 b8 26 3e 80 00 00 	movabs $0x803e26,%rax
+  802339:	00 00 00 
+  80233c:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80233e:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802341:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802348:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80234c:	ba 10 00 00 00       	mov    $0x10,%edx
+  802351:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802358:	00 00 00 
+  80235b:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  802362:	00 00 00 
+  802365:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802367:	4c 89 f7             	mov    %r14,%rdi
+  80236a:	48 b8 bf 1d 80 00 00 	movabs $0x801dbf,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802376:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80237d:	4c 89 f7             	mov    %r14,%rdi
+  802380:	48 b8 e9 3e 80 00 00 	movabs $0x803ee9,%rax
+  802387:	00 00 00 
+  80238a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80238c:	4c 89 f7             	mov    %r14,%rdi
+  80238f:	48 b8 77 3e 80 00 00 	movabs $0x803e77,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80239b:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80239e:	41 83 fc 05          	cmp    $0x5,%r12d
+  8023a2:	75 04                	jne    8023a8 <fsipc+0x137>
+  8023a4:	85 db                	test   %ebx,%ebx
+  8023a6:	79 14                	jns    8023bc <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023a8:	4c 89 f7             	mov    %r14,%rdi
+  8023ab:	48 b8 9e 3e 80 00 00 	movabs $0x803e9e,%rax
+  8023b2:	00 00 00 
+  8023b5:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023b7:	e9 4b ff ff ff       	jmp    802307 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023bc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023c0:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023c5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023cc:	00 00 00 
+  8023cf:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  8023d6:	00 00 00 
+  8023d9:	ff d0                	call   *%rax
+  8023db:	eb cb                	jmp    8023a8 <fsipc+0x137>
+
+00000000008023dd <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023dd:	55                   	push   %rbp
+  8023de:	48 89 e5             	mov    %rsp,%rbp
+  8023e1:	41 57                	push   %r15
+  8023e3:	41 56                	push   %r14
+  8023e5:	41 55                	push   %r13
+  8023e7:	41 54                	push   %r12
+  8023e9:	53                   	push   %rbx
+  8023ea:	48 83 ec 18          	sub    $0x18,%rsp
+  8023ee:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8023f2:	49 89 f6             	mov    %rsi,%r14
+  8023f5:	49 89 d4             	mov    %rdx,%r12
+  8023f8:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8023fb:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  802402:	00 00 00 
+  802405:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802407:	48 85 c0             	test   %rax,%rax
+  80240a:	0f 85 96 00 00 00    	jne    8024a6 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802410:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802417:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802418:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80241f:	00 00 00 
+    while (n) {
+  802422:	4d 85 e4             	test   %r12,%r12
+  802425:	74 79                	je     8024a0 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802427:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80242c:	49 39 dc             	cmp    %rbx,%r12
+  80242f:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802433:	48 89 da             	mov    %rbx,%rdx
+  802436:	4c 89 f6             	mov    %r14,%rsi
+  802439:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802440:	00 00 00 
+  802443:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  80244a:	00 00 00 
+  80244d:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80244f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802453:	8b 40 0c             	mov    0xc(%rax),%eax
+  802456:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802459:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80245c:	44 01 e8             	add    %r13d,%eax
+  80245f:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802463:	41 0f 44 c5          	cmove  %r13d,%eax
+  802467:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80246b:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80246f:	48 89 da             	mov    %rbx,%rdx
+  802472:	be 00 00 00 00       	mov    $0x0,%esi
+  802477:	bf 04 00 00 00       	mov    $0x4,%edi
+  80247c:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+        if (res < 0)
+  802488:	85 c0                	test   %eax,%eax
+  80248a:	78 4a                	js     8024d6 <devfile_write_direct+0xf9>
+        buf += res;
+  80248c:	48 98                	cltq
+  80248e:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802491:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802495:	49 29 c4             	sub    %rax,%r12
+  802498:	75 8d                	jne    802427 <devfile_write_direct+0x4a>
+    return write;
+  80249a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80249e:	eb 27                	jmp    8024c7 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8024a0:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8024a4:	eb f4                	jmp    80249a <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8024a6:	45 89 e9             	mov    %r13d,%r9d
+  8024a9:	4d 89 e0             	mov    %r12,%r8
+  8024ac:	4c 89 f1             	mov    %r14,%rcx
+  8024af:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024b4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024b8:	48 89 c7             	mov    %rax,%rdi
+  8024bb:	48 b8 0a 1e 80 00 00 	movabs $0x801e0a,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+}
+  8024c7:	48 83 c4 18          	add    $0x18,%rsp
+  8024cb:	5b                   	pop    %rbx
+  8024cc:	41 5c                	pop    %r12
+  8024ce:	41 5d                	pop    %r13
+  8024d0:	41 5e                	pop    %r14
+  8024d2:	41 5f                	pop    %r15
+  8024d4:	5d                   	pop    %rbp
+  8024d5:	c3                   	ret
+            return res;
+  8024d6:	48 98                	cltq
+  8024d8:	eb ed                	jmp    8024c7 <devfile_write_direct+0xea>
+
+00000000008024da <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024da:	55                   	push   %rbp
+  8024db:	48 89 e5             	mov    %rsp,%rbp
+  8024de:	41 54                	push   %r12
+  8024e0:	53                   	push   %rbx
+  8024e1:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8024e4:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  8024eb:	00 00 00 
+  8024ee:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8024f0:	48 85 c0             	test   %rax,%rax
+  8024f3:	74 71                	je     802566 <fbuf_flush+0x8c>
+  8024f5:	48 89 c3             	mov    %rax,%rbx
+  8024f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fd:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802501:	75 05                	jne    802508 <fbuf_flush+0x2e>
+}
+  802503:	5b                   	pop    %rbx
+  802504:	41 5c                	pop    %r12
+  802506:	5d                   	pop    %rbp
+  802507:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802508:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80250b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80250f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802516:	00 00 00 
+  802519:	48 89 de             	mov    %rbx,%rsi
+  80251c:	48 29 c6             	sub    %rax,%rsi
+  80251f:	48 c1 fe 03          	sar    $0x3,%rsi
+  802523:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80252a:	aa aa aa 
+  80252d:	48 0f af f0          	imul   %rax,%rsi
+  802531:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802535:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80253a:	48 01 c6             	add    %rax,%rsi
+  80253d:	4c 89 e7             	mov    %r12,%rdi
+  802540:	48 b8 dd 23 80 00 00 	movabs $0x8023dd,%rax
+  802547:	00 00 00 
+  80254a:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80254c:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802550:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802557:	00 
+    return res < 0 ? res : 0;
+  802558:	48 85 c0             	test   %rax,%rax
+  80255b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802560:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802564:	eb 9d                	jmp    802503 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802566:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256b:	eb 96                	jmp    802503 <fbuf_flush+0x29>
+
+000000000080256d <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80256d:	55                   	push   %rbp
+  80256e:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802571:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802578:	00 00 00 
+  80257b:	ff d0                	call   *%rax
+}
+  80257d:	5d                   	pop    %rbp
+  80257e:	c3                   	ret
+
+000000000080257f <devfile_write>:
+    if (!fd || !buf)
+  80257f:	48 85 ff             	test   %rdi,%rdi
+  802582:	0f 84 d3 01 00 00    	je     80275b <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802588:	55                   	push   %rbp
+  802589:	48 89 e5             	mov    %rsp,%rbp
+  80258c:	41 57                	push   %r15
+  80258e:	41 56                	push   %r14
+  802590:	41 55                	push   %r13
+  802592:	41 54                	push   %r12
+  802594:	53                   	push   %rbx
+  802595:	48 83 ec 08          	sub    $0x8,%rsp
+  802599:	49 89 fc             	mov    %rdi,%r12
+  80259c:	49 89 f6             	mov    %rsi,%r14
+  80259f:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8025a2:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025a7:	48 85 f6             	test   %rsi,%rsi
+  8025aa:	0f 84 9c 01 00 00    	je     80274c <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025b0:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  8025b7:	00 00 00 
+  8025ba:	ff d0                	call   *%rax
+  8025bc:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025bf:	48 85 c0             	test   %rax,%rax
+  8025c2:	0f 84 a2 00 00 00    	je     80266a <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025c8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025cd:	4c 89 e7             	mov    %r12,%rdi
+  8025d0:	48 b8 1e 10 80 00 00 	movabs $0x80101e,%rax
+  8025d7:	00 00 00 
+  8025da:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025dc:	83 f8 02             	cmp    $0x2,%eax
+  8025df:	0f 8f 85 00 00 00    	jg     80266a <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8025e5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8025ec:	00 00 00 
+  8025ef:	4d 89 ef             	mov    %r13,%r15
+  8025f2:	49 29 c7             	sub    %rax,%r15
+  8025f5:	49 c1 ff 03          	sar    $0x3,%r15
+  8025f9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802600:	aa aa aa 
+  802603:	4c 0f af f8          	imul   %rax,%r15
+  802607:	49 c1 e7 0e          	shl    $0xe,%r15
+  80260b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802610:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802613:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802618:	0f 84 d7 00 00 00    	je     8026f5 <devfile_write+0x176>
+  80261e:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802622:	89 c2                	mov    %eax,%edx
+  802624:	41 03 55 0c          	add    0xc(%r13),%edx
+  802628:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80262d:	75 0f                	jne    80263e <devfile_write+0xbf>
+  80262f:	48 01 d8             	add    %rbx,%rax
+  802632:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802638:	0f 86 92 00 00 00    	jbe    8026d0 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80263e:	4c 89 e7             	mov    %r12,%rdi
+  802641:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+  80264d:	85 c0                	test   %eax,%eax
+  80264f:	78 52                	js     8026a3 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802651:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802658:	77 7f                	ja     8026d9 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80265a:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80265f:	0f 85 c2 00 00 00    	jne    802727 <devfile_write+0x1a8>
+  802665:	e9 94 00 00 00       	jmp    8026fe <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80266a:	4c 89 e7             	mov    %r12,%rdi
+  80266d:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802679:	85 c0                	test   %eax,%eax
+  80267b:	79 07                	jns    802684 <devfile_write+0x105>
+  80267d:	48 98                	cltq
+  80267f:	e9 c8 00 00 00       	jmp    80274c <devfile_write+0x1cd>
+  802684:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802689:	48 89 da             	mov    %rbx,%rdx
+  80268c:	4c 89 f6             	mov    %r14,%rsi
+  80268f:	4c 89 e7             	mov    %r12,%rdi
+  802692:	48 b8 dd 23 80 00 00 	movabs $0x8023dd,%rax
+  802699:	00 00 00 
+  80269c:	ff d0                	call   *%rax
+  80269e:	e9 a9 00 00 00       	jmp    80274c <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8026a3:	48 98                	cltq
+  8026a5:	e9 a2 00 00 00       	jmp    80274c <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026aa:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026af:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026b4:	4c 89 fe             	mov    %r15,%rsi
+  8026b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026bc:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  8026c3:	00 00 00 
+  8026c6:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026c8:	85 c0                	test   %eax,%eax
+  8026ca:	79 45                	jns    802711 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026cc:	48 98                	cltq
+  8026ce:	eb 7c                	jmp    80274c <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026d0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026d7:	76 4e                	jbe    802727 <devfile_write+0x1a8>
+  8026d9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026de:	48 89 da             	mov    %rbx,%rdx
+  8026e1:	4c 89 f6             	mov    %r14,%rsi
+  8026e4:	4c 89 e7             	mov    %r12,%rdi
+  8026e7:	48 b8 dd 23 80 00 00 	movabs $0x8023dd,%rax
+  8026ee:	00 00 00 
+  8026f1:	ff d0                	call   *%rax
+  8026f3:	eb 57                	jmp    80274c <devfile_write+0x1cd>
+  8026f5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026fc:	77 db                	ja     8026d9 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8026fe:	4c 89 ff             	mov    %r15,%rdi
+  802701:	48 b8 a8 3c 80 00 00 	movabs $0x803ca8,%rax
+  802708:	00 00 00 
+  80270b:	ff d0                	call   *%rax
+  80270d:	84 c0                	test   %al,%al
+  80270f:	74 99                	je     8026aa <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802711:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802716:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80271b:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80271f:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802726:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802727:	4c 89 ff             	mov    %r15,%rdi
+  80272a:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80272e:	48 89 da             	mov    %rbx,%rdx
+  802731:	4c 89 f6             	mov    %r14,%rsi
+  802734:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  80273b:	00 00 00 
+  80273e:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802740:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802744:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802749:	48 89 d8             	mov    %rbx,%rax
+}
+  80274c:	48 83 c4 08          	add    $0x8,%rsp
+  802750:	5b                   	pop    %rbx
+  802751:	41 5c                	pop    %r12
+  802753:	41 5d                	pop    %r13
+  802755:	41 5e                	pop    %r14
+  802757:	41 5f                	pop    %r15
+  802759:	5d                   	pop    %rbp
+  80275a:	c3                   	ret
+        return E_INVAL;
+  80275b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802760:	c3                   	ret
+
+0000000000802761 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802761:	55                   	push   %rbp
+  802762:	48 89 e5             	mov    %rsp,%rbp
+  802765:	41 54                	push   %r12
+  802767:	53                   	push   %rbx
+  802768:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80276b:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802772:	00 00 00 
+  802775:	ff d0                	call   *%rax
+  802777:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80277a:	48 89 df             	mov    %rbx,%rdi
+  80277d:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+  802789:	48 85 c0             	test   %rax,%rax
+  80278c:	74 17                	je     8027a5 <devfile_flush+0x44>
+  80278e:	48 89 df             	mov    %rbx,%rdi
+  802791:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802798:	00 00 00 
+  80279b:	ff d0                	call   *%rax
+  80279d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8027a4:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027a5:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027a8:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027af:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027bb:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027c0:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027cc:	45 85 e4             	test   %r12d,%r12d
+  8027cf:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027d3:	5b                   	pop    %rbx
+  8027d4:	41 5c                	pop    %r12
+  8027d6:	5d                   	pop    %rbp
+  8027d7:	c3                   	ret
+
+00000000008027d8 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027d8:	55                   	push   %rbp
+  8027d9:	48 89 e5             	mov    %rsp,%rbp
+  8027dc:	41 57                	push   %r15
+  8027de:	41 56                	push   %r14
+  8027e0:	41 55                	push   %r13
+  8027e2:	41 54                	push   %r12
+  8027e4:	53                   	push   %rbx
+  8027e5:	48 83 ec 38          	sub    $0x38,%rsp
+  8027e9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8027ed:	49 89 f7             	mov    %rsi,%r15
+  8027f0:	48 89 d3             	mov    %rdx,%rbx
+  8027f3:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8027f6:	48 b8 23 1d 80 00 00 	movabs $0x801d23,%rax
+  8027fd:	00 00 00 
+  802800:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802802:	48 85 c0             	test   %rax,%rax
+  802805:	75 20                	jne    802827 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802807:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  80280c:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802813:	00 
+    while (n) {
+  802814:	48 85 db             	test   %rbx,%rbx
+  802817:	0f 85 df 00 00 00    	jne    8028fc <devfile_read_direct+0x124>
+    size_t read = 0;
+  80281d:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802821:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802825:	eb 21                	jmp    802848 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802827:	45 89 f1             	mov    %r14d,%r9d
+  80282a:	49 89 d8             	mov    %rbx,%r8
+  80282d:	4c 89 f9             	mov    %r15,%rcx
+  802830:	ba 03 00 00 00       	mov    $0x3,%edx
+  802835:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802839:	48 89 c7             	mov    %rax,%rdi
+  80283c:	48 b8 0a 1e 80 00 00 	movabs $0x801e0a,%rax
+  802843:	00 00 00 
+  802846:	ff d0                	call   *%rax
+}
+  802848:	48 83 c4 38          	add    $0x38,%rsp
+  80284c:	5b                   	pop    %rbx
+  80284d:	41 5c                	pop    %r12
+  80284f:	41 5d                	pop    %r13
+  802851:	41 5e                	pop    %r14
+  802853:	41 5f                	pop    %r15
+  802855:	5d                   	pop    %rbp
+  802856:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802857:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80285b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802861:	75 1e                	jne    802881 <devfile_read_direct+0xa9>
+  802863:	e9 e2 00 00 00       	jmp    80294a <devfile_read_direct+0x172>
+            if (!res) return read;
+  802868:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80286c:	eb da                	jmp    802848 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  80286e:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802872:	0f 85 d0 01 00 00    	jne    802a48 <devfile_read_direct+0x270>
+            map = 0;
+  802878:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80287c:	eb 03                	jmp    802881 <devfile_read_direct+0xa9>
+  80287e:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802881:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802886:	48 39 d3             	cmp    %rdx,%rbx
+  802889:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80288d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802891:	8b 40 0c             	mov    0xc(%rax),%eax
+  802894:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  80289b:	00 00 00 
+  80289e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8028a0:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8028a4:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8028ad:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028b2:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028be:	85 c0                	test   %eax,%eax
+  8028c0:	0f 8e 63 01 00 00    	jle    802a29 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028c6:	4c 63 e0             	movslq %eax,%r12
+  8028c9:	4c 89 e2             	mov    %r12,%rdx
+  8028cc:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028d3:	00 00 00 
+  8028d6:	4c 89 ff             	mov    %r15,%rdi
+  8028d9:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  8028e0:	00 00 00 
+  8028e3:	ff d0                	call   *%rax
+        buf += res;
+  8028e5:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8028e8:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8028eb:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8028ef:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8028f3:	48 85 db             	test   %rbx,%rbx
+  8028f6:	0f 84 25 ff ff ff    	je     802821 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  8028fc:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  8028ff:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802903:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802907:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80290b:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802912:	0f 97 c2             	seta   %dl
+  802915:	20 c2                	and    %al,%dl
+  802917:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  80291a:	0f 84 5e ff ff ff    	je     80287e <devfile_read_direct+0xa6>
+  802920:	4c 89 fa             	mov    %r15,%rdx
+  802923:	4d 89 fd             	mov    %r15,%r13
+  802926:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80292d:	0f 85 4e ff ff ff    	jne    802881 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802933:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802937:	0f 84 1a ff ff ff    	je     802857 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80293d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802944:	0f 85 37 ff ff ff    	jne    802881 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  80294a:	48 89 d8             	mov    %rbx,%rax
+  80294d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802953:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802958:	48 39 c8             	cmp    %rcx,%rax
+  80295b:	48 0f 47 c1          	cmova  %rcx,%rax
+  80295f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802963:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802967:	49 89 d4             	mov    %rdx,%r12
+  80296a:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80296e:	48 b8 49 3c 80 00 00 	movabs $0x803c49,%rax
+  802975:	00 00 00 
+  802978:	ff d0                	call   *%rax
+  80297a:	a8 40                	test   $0x40,%al
+  80297c:	0f 85 b9 00 00 00    	jne    802a3b <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802982:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80298d:	49 39 c5             	cmp    %rax,%r13
+  802990:	72 d8                	jb     80296a <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802992:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802996:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80299d:	00 00 00 
+  8029a0:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029a4:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029a7:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029a9:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029ad:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029b1:	48 b8 be 1b 80 00 00 	movabs $0x801bbe,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+  8029bd:	89 c7                	mov    %eax,%edi
+  8029bf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029c5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029ca:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029d1:	00 00 00 
+  8029d4:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029d9:	48 b8 f9 45 80 00 00 	movabs $0x8045f9,%rax
+  8029e0:	00 00 00 
+  8029e3:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8029e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8029ea:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8029ee:	4c 89 fe             	mov    %r15,%rsi
+  8029f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f6:	48 b8 d5 45 80 00 00 	movabs $0x8045d5,%rax
+  8029fd:	00 00 00 
+  802a00:	ff d0                	call   *%rax
+  802a02:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a05:	48 85 d2             	test   %rdx,%rdx
+  802a08:	0f 84 5a fe ff ff    	je     802868 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a0e:	0f 8e 5a fe ff ff    	jle    80286e <devfile_read_direct+0x96>
+                buf += res;
+  802a14:	48 98                	cltq
+  802a16:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a19:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a1c:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a20:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a24:	e9 ca fe ff ff       	jmp    8028f3 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a29:	41 89 c5             	mov    %eax,%r13d
+  802a2c:	48 98                	cltq
+  802a2e:	45 85 ed             	test   %r13d,%r13d
+  802a31:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a36:	e9 0d fe ff ff       	jmp    802848 <devfile_read_direct+0x70>
+            map = 0;
+  802a3b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a3f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a43:	e9 39 fe ff ff       	jmp    802881 <devfile_read_direct+0xa9>
+  802a48:	48 89 d0             	mov    %rdx,%rax
+  802a4b:	e9 f8 fd ff ff       	jmp    802848 <devfile_read_direct+0x70>
+
+0000000000802a50 <devfile_read>:
+    if (!fd || !buf)
+  802a50:	48 85 ff             	test   %rdi,%rdi
+  802a53:	0f 84 21 02 00 00    	je     802c7a <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a59:	55                   	push   %rbp
+  802a5a:	48 89 e5             	mov    %rsp,%rbp
+  802a5d:	41 57                	push   %r15
+  802a5f:	41 56                	push   %r14
+  802a61:	41 55                	push   %r13
+  802a63:	41 54                	push   %r12
+  802a65:	53                   	push   %rbx
+  802a66:	48 83 ec 28          	sub    $0x28,%rsp
+  802a6a:	48 89 fb             	mov    %rdi,%rbx
+  802a6d:	49 89 f4             	mov    %rsi,%r12
+  802a70:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a73:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a78:	48 85 f6             	test   %rsi,%rsi
+  802a7b:	74 4b                	je     802ac8 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a7d:	48 b8 8d 1d 80 00 00 	movabs $0x801d8d,%rax
+  802a84:	00 00 00 
+  802a87:	ff d0                	call   *%rax
+  802a89:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802a8c:	48 85 c0             	test   %rax,%rax
+  802a8f:	74 22                	je     802ab3 <devfile_read+0x63>
+  802a91:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802a98:	77 19                	ja     802ab3 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a9a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a9f:	48 89 df             	mov    %rbx,%rdi
+  802aa2:	48 b8 1e 10 80 00 00 	movabs $0x80101e,%rax
+  802aa9:	00 00 00 
+  802aac:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802aae:	83 f8 02             	cmp    $0x2,%eax
+  802ab1:	7e 40                	jle    802af3 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ab3:	48 89 df             	mov    %rbx,%rdi
+  802ab6:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ac2:	85 c0                	test   %eax,%eax
+  802ac4:	79 11                	jns    802ad7 <devfile_read+0x87>
+  802ac6:	48 98                	cltq
+}
+  802ac8:	48 83 c4 28          	add    $0x28,%rsp
+  802acc:	5b                   	pop    %rbx
+  802acd:	41 5c                	pop    %r12
+  802acf:	41 5d                	pop    %r13
+  802ad1:	41 5e                	pop    %r14
+  802ad3:	41 5f                	pop    %r15
+  802ad5:	5d                   	pop    %rbp
+  802ad6:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ad7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802adc:	4c 89 ea             	mov    %r13,%rdx
+  802adf:	4c 89 e6             	mov    %r12,%rsi
+  802ae2:	48 89 df             	mov    %rbx,%rdi
+  802ae5:	48 b8 d8 27 80 00 00 	movabs $0x8027d8,%rax
+  802aec:	00 00 00 
+  802aef:	ff d0                	call   *%rax
+  802af1:	eb d5                	jmp    802ac8 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802af3:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802af7:	48 89 df             	mov    %rbx,%rdi
+  802afa:	48 b8 da 24 80 00 00 	movabs $0x8024da,%rax
+  802b01:	00 00 00 
+  802b04:	ff d0                	call   *%rax
+  802b06:	85 c0                	test   %eax,%eax
+  802b08:	0f 88 33 01 00 00    	js     802c41 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b0e:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b15:	00 00 00 
+  802b18:	4c 89 f0             	mov    %r14,%rax
+  802b1b:	48 29 d0             	sub    %rdx,%rax
+  802b1e:	48 c1 f8 03          	sar    $0x3,%rax
+  802b22:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b29:	aa aa aa 
+  802b2c:	48 0f af c2          	imul   %rdx,%rax
+  802b30:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b34:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b38:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b3b:	41 39 06             	cmp    %eax,(%r14)
+  802b3e:	75 0d                	jne    802b4d <devfile_read+0xfd>
+  802b40:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b43:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b47:	0f 84 fb 00 00 00    	je     802c48 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b4d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b52:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b56:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b5d:	48 89 c7             	mov    %rax,%rdi
+  802b60:	48 b8 a8 3c 80 00 00 	movabs $0x803ca8,%rax
+  802b67:	00 00 00 
+  802b6a:	ff d0                	call   *%rax
+  802b6c:	84 c0                	test   %al,%al
+  802b6e:	75 27                	jne    802b97 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b70:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b75:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b7a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b83:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  802b8a:	00 00 00 
+  802b8d:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802b8f:	85 c0                	test   %eax,%eax
+  802b91:	0f 88 dc 00 00 00    	js     802c73 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802b97:	44 89 f8             	mov    %r15d,%eax
+  802b9a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802b9f:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802ba1:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802ba8:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802ba9:	8b 43 10             	mov    0x10(%rbx),%eax
+  802bac:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802bb0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bb3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bb8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bbc:	48 89 df             	mov    %rbx,%rdi
+  802bbf:	48 b8 d8 27 80 00 00 	movabs $0x8027d8,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802bcb:	48 85 c0             	test   %rax,%rax
+  802bce:	0f 88 f4 fe ff ff    	js     802ac8 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802bd4:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802bd7:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802bda:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802bdd:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802be1:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802be5:	48 63 d1             	movslq %ecx,%rdx
+  802be8:	48 01 d0             	add    %rdx,%rax
+  802beb:	4d 63 ff             	movslq %r15d,%r15
+  802bee:	4c 29 f8             	sub    %r15,%rax
+  802bf1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bf6:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802bfa:	48 85 c0             	test   %rax,%rax
+  802bfd:	0f 8e c5 fe ff ff    	jle    802ac8 <devfile_read+0x78>
+    n = MIN(n, res);
+  802c03:	4c 39 e8             	cmp    %r13,%rax
+  802c06:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c0a:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c0d:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c11:	48 63 f6             	movslq %esi,%rsi
+  802c14:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c19:	48 01 c6             	add    %rax,%rsi
+  802c1c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c20:	48 01 c6             	add    %rax,%rsi
+  802c23:	4c 89 ea             	mov    %r13,%rdx
+  802c26:	4c 89 e7             	mov    %r12,%rdi
+  802c29:	48 b8 5b 0d 80 00 00 	movabs $0x800d5b,%rax
+  802c30:	00 00 00 
+  802c33:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c35:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c39:	4c 89 e8             	mov    %r13,%rax
+  802c3c:	e9 87 fe ff ff       	jmp    802ac8 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c41:	48 98                	cltq
+  802c43:	e9 80 fe ff ff       	jmp    802ac8 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c48:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c4c:	41 39 d7             	cmp    %edx,%r15d
+  802c4f:	0f 8c f8 fe ff ff    	jl     802b4d <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c55:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c59:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c5c:	41 39 cf             	cmp    %ecx,%r15d
+  802c5f:	0f 8d e8 fe ff ff    	jge    802b4d <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c65:	4d 63 ff             	movslq %r15d,%r15
+  802c68:	4c 29 f8             	sub    %r15,%rax
+  802c6b:	48 63 d2             	movslq %edx,%rdx
+  802c6e:	48 01 d0             	add    %rdx,%rax
+  802c71:	eb 87                	jmp    802bfa <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c73:	48 98                	cltq
+  802c75:	e9 4e fe ff ff       	jmp    802ac8 <devfile_read+0x78>
+        return E_INVAL;
+  802c7a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c7f:	c3                   	ret
+
+0000000000802c80 <fs_channel>:
+fs_channel(bool enable) {
+  802c80:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802c82:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802c89:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802c8b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c90:	40 84 ff             	test   %dil,%dil
+  802c93:	74 47                	je     802cdc <fs_channel+0x5c>
+  802c95:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802c9c:	00 00 00 
+  802c9f:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802ca5:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802cac:	00 00 00 
+  802caf:	3b 08                	cmp    (%rax),%ecx
+  802cb1:	74 29                	je     802cdc <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cb3:	55                   	push   %rbp
+  802cb4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cb7:	48 b8 00 1c 80 00 00 	movabs $0x801c00,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+  802cc3:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802cc5:	85 c0                	test   %eax,%eax
+  802cc7:	78 04                	js     802ccd <fs_channel+0x4d>
+}
+  802cc9:	89 d0                	mov    %edx,%eax
+  802ccb:	5d                   	pop    %rbp
+  802ccc:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ccd:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802cd4:	00 00 00 
+  802cd7:	c6 00 00             	movb   $0x0,(%rax)
+  802cda:	eb ed                	jmp    802cc9 <fs_channel+0x49>
+}
+  802cdc:	89 d0                	mov    %edx,%eax
+  802cde:	c3                   	ret
+
+0000000000802cdf <open>:
+open(const char *path, int mode) {
+  802cdf:	55                   	push   %rbp
+  802ce0:	48 89 e5             	mov    %rsp,%rbp
+  802ce3:	41 55                	push   %r13
+  802ce5:	41 54                	push   %r12
+  802ce7:	53                   	push   %rbx
+  802ce8:	48 83 ec 18          	sub    $0x18,%rsp
+  802cec:	49 89 fc             	mov    %rdi,%r12
+  802cef:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802cf2:	48 b8 bc 0a 80 00 00 	movabs $0x800abc,%rax
+  802cf9:	00 00 00 
+  802cfc:	ff d0                	call   *%rax
+  802cfe:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d04:	0f 87 8f 00 00 00    	ja     802d99 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d0a:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d0e:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+  802d1a:	89 c3                	mov    %eax,%ebx
+  802d1c:	85 c0                	test   %eax,%eax
+  802d1e:	78 55                	js     802d75 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d20:	4c 89 e6             	mov    %r12,%rsi
+  802d23:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d2a:	00 00 00 
+  802d2d:	48 89 df             	mov    %rbx,%rdi
+  802d30:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802d37:	00 00 00 
+  802d3a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d3c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d43:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d48:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d4c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d51:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	89 c3                	mov    %eax,%ebx
+  802d5f:	85 c0                	test   %eax,%eax
+  802d61:	78 1f                	js     802d82 <open+0xa3>
+    return fd2num(fd);
+  802d63:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d67:	48 b8 8c 14 80 00 00 	movabs $0x80148c,%rax
+  802d6e:	00 00 00 
+  802d71:	ff d0                	call   *%rax
+  802d73:	89 c3                	mov    %eax,%ebx
+}
+  802d75:	89 d8                	mov    %ebx,%eax
+  802d77:	48 83 c4 18          	add    $0x18,%rsp
+  802d7b:	5b                   	pop    %rbx
+  802d7c:	41 5c                	pop    %r12
+  802d7e:	41 5d                	pop    %r13
+  802d80:	5d                   	pop    %rbp
+  802d81:	c3                   	ret
+        fd_close(fd, 0);
+  802d82:	be 00 00 00 00       	mov    $0x0,%esi
+  802d87:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d8b:	48 b8 d5 15 80 00 00 	movabs $0x8015d5,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+        return res;
+  802d97:	eb dc                	jmp    802d75 <open+0x96>
+        return -E_BAD_PATH;
+  802d99:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802d9e:	eb d5                	jmp    802d75 <open+0x96>
+
+0000000000802da0 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802da0:	55                   	push   %rbp
+  802da1:	48 89 e5             	mov    %rsp,%rbp
+  802da4:	41 56                	push   %r14
+  802da6:	41 55                	push   %r13
+  802da8:	41 54                	push   %r12
+  802daa:	53                   	push   %rbx
+  802dab:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802daf:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802db6:	00 00 00 
+  802db9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dbe:	49 bd 1a 15 80 00 00 	movabs $0x80151a,%r13
+  802dc5:	00 00 00 
+  802dc8:	49 be da 24 80 00 00 	movabs $0x8024da,%r14
+  802dcf:	00 00 00 
+  802dd2:	eb 0c                	jmp    802de0 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802dd4:	83 c3 01             	add    $0x1,%ebx
+  802dd7:	49 83 c4 18          	add    $0x18,%r12
+  802ddb:	83 fb 20             	cmp    $0x20,%ebx
+  802dde:	74 1d                	je     802dfd <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802de0:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802de5:	74 ed                	je     802dd4 <file_flush_buffers+0x34>
+  802de7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802deb:	89 df                	mov    %ebx,%edi
+  802ded:	41 ff d5             	call   *%r13
+  802df0:	85 c0                	test   %eax,%eax
+  802df2:	78 e0                	js     802dd4 <file_flush_buffers+0x34>
+  802df4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802df8:	41 ff d6             	call   *%r14
+  802dfb:	eb d7                	jmp    802dd4 <file_flush_buffers+0x34>
+}
+  802dfd:	48 83 c4 10          	add    $0x10,%rsp
+  802e01:	5b                   	pop    %rbx
+  802e02:	41 5c                	pop    %r12
+  802e04:	41 5d                	pop    %r13
+  802e06:	41 5e                	pop    %r14
+  802e08:	5d                   	pop    %rbp
+  802e09:	c3                   	ret
+
+0000000000802e0a <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e0a:	55                   	push   %rbp
+  802e0b:	48 89 e5             	mov    %rsp,%rbp
+  802e0e:	41 54                	push   %r12
+  802e10:	53                   	push   %rbx
+  802e11:	49 89 fc             	mov    %rdi,%r12
+  802e14:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e16:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  802e1d:	00 00 00 
+  802e20:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e22:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e29:	00 00 00 
+  802e2c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e31:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e33:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e36:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e3b:	be 00 00 00 00       	mov    $0x0,%esi
+  802e40:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e45:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802e4c:	00 00 00 
+  802e4f:	ff d0                	call   *%rax
+}
+  802e51:	5b                   	pop    %rbx
+  802e52:	41 5c                	pop    %r12
+  802e54:	5d                   	pop    %rbp
+  802e55:	c3                   	ret
+
+0000000000802e56 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e56:	55                   	push   %rbp
+  802e57:	48 89 e5             	mov    %rsp,%rbp
+  802e5a:	41 54                	push   %r12
+  802e5c:	53                   	push   %rbx
+  802e5d:	49 89 fc             	mov    %rdi,%r12
+  802e60:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e63:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e6f:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e74:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e7b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e82:	be 00 00 00 00       	mov    $0x0,%esi
+  802e87:	bf 05 00 00 00       	mov    $0x5,%edi
+  802e8c:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802e93:	00 00 00 
+  802e96:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802e98:	85 c0                	test   %eax,%eax
+  802e9a:	78 3d                	js     802ed9 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802e9c:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802ea3:	00 00 00 
+  802ea6:	4c 89 e6             	mov    %r12,%rsi
+  802ea9:	48 89 df             	mov    %rbx,%rdi
+  802eac:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802eb3:	00 00 00 
+  802eb6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802eb8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802ebf:	00 
+  802ec0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ec6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802ecd:	00 
+  802ece:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ed9:	5b                   	pop    %rbx
+  802eda:	41 5c                	pop    %r12
+  802edc:	5d                   	pop    %rbp
+  802edd:	c3                   	ret
+
+0000000000802ede <remove>:
+remove(const char *path) {
+  802ede:	55                   	push   %rbp
+  802edf:	48 89 e5             	mov    %rsp,%rbp
+  802ee2:	53                   	push   %rbx
+  802ee3:	48 83 ec 08          	sub    $0x8,%rsp
+  802ee7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802eea:	48 b8 bc 0a 80 00 00 	movabs $0x800abc,%rax
+  802ef1:	00 00 00 
+  802ef4:	ff d0                	call   *%rax
+  802ef6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802efc:	77 3a                	ja     802f38 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802efe:	48 89 de             	mov    %rbx,%rsi
+  802f01:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f08:	00 00 00 
+  802f0b:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  802f12:	00 00 00 
+  802f15:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f17:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1c:	be 00 00 00 00       	mov    $0x0,%esi
+  802f21:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f26:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802f2d:	00 00 00 
+  802f30:	ff d0                	call   *%rax
+}
+  802f32:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f36:	c9                   	leave
+  802f37:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f38:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f3d:	eb f3                	jmp    802f32 <remove+0x54>
+
+0000000000802f3f <sync>:
+sync(void) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f43:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  802f4a:	00 00 00 
+  802f4d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f4f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f54:	be 00 00 00 00       	mov    $0x0,%esi
+  802f59:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f5e:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802f65:	00 00 00 
+  802f68:	ff d0                	call   *%rax
+}
+  802f6a:	5d                   	pop    %rbp
+  802f6b:	c3                   	ret
+
+0000000000802f6c <fsync>:
+fsync(int fdnum) {
+  802f6c:	55                   	push   %rbp
+  802f6d:	48 89 e5             	mov    %rsp,%rbp
+  802f70:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f74:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f78:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  802f7f:	00 00 00 
+  802f82:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802f84:	85 c0                	test   %eax,%eax
+  802f86:	78 4b                	js     802fd3 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802f88:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802f8c:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802f93:	00 00 00 
+  802f96:	8b 00                	mov    (%rax),%eax
+  802f98:	39 02                	cmp    %eax,(%rdx)
+  802f9a:	75 39                	jne    802fd5 <fsync+0x69>
+    file_flush_buffers();
+  802f9c:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fa8:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fac:	8b 40 0c             	mov    0xc(%rax),%eax
+  802faf:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802fb6:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fb8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fbd:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fc7:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802fce:	00 00 00 
+  802fd1:	ff d0                	call   *%rax
+}
+  802fd3:	c9                   	leave
+  802fd4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fd5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802fda:	eb f7                	jmp    802fd3 <fsync+0x67>
+
+0000000000802fdc <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802fdc:	55                   	push   %rbp
+  802fdd:	48 89 e5             	mov    %rsp,%rbp
+  802fe0:	53                   	push   %rbx
+  802fe1:	48 83 ec 08          	sub    $0x8,%rsp
+  802fe5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  802fe8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fed:	be 00 00 00 00       	mov    $0x0,%esi
+  802ff2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  802ff7:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  802ffe:	00 00 00 
+  803001:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803003:	85 c0                	test   %eax,%eax
+  803005:	78 2d                	js     803034 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803007:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80300e:	00 00 00 
+  803011:	48 8b 10             	mov    (%rax),%rdx
+  803014:	48 89 13             	mov    %rdx,(%rbx)
+  803017:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80301b:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80301f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803023:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803027:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80302b:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80302f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803034:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803038:	c9                   	leave
+  803039:	c3                   	ret
+
+000000000080303a <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80303a:	55                   	push   %rbp
+  80303b:	48 89 e5             	mov    %rsp,%rbp
+  80303e:	53                   	push   %rbx
+  80303f:	48 83 ec 08          	sub    $0x8,%rsp
+  803043:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304b:	be 00 00 00 00       	mov    $0x0,%esi
+  803050:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803055:	48 b8 71 22 80 00 00 	movabs $0x802271,%rax
+  80305c:	00 00 00 
+  80305f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803061:	85 c0                	test   %eax,%eax
+  803063:	78 3d                	js     8030a2 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803065:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80306c:	00 00 00 
+  80306f:	48 8b 10             	mov    (%rax),%rdx
+  803072:	48 89 13             	mov    %rdx,(%rbx)
+  803075:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803079:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80307d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803081:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803085:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803089:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80308d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803091:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803095:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803099:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80309d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030a6:	c9                   	leave
+  8030a7:	c3                   	ret
+
+00000000008030a8 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030a8:	55                   	push   %rbp
+  8030a9:	48 89 e5             	mov    %rsp,%rbp
+  8030ac:	41 57                	push   %r15
+  8030ae:	41 56                	push   %r14
+  8030b0:	41 55                	push   %r13
+  8030b2:	41 54                	push   %r12
+  8030b4:	53                   	push   %rbx
+  8030b5:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030b9:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030c0:	00 
+  8030c1:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030c8:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030ce:	0f 85 43 01 00 00    	jne    803217 <munmap+0x16f>
+  8030d4:	49 89 ff             	mov    %rdi,%r15
+  8030d7:	4c 39 f7             	cmp    %r14,%rdi
+  8030da:	0f 87 37 01 00 00    	ja     803217 <munmap+0x16f>
+  8030e0:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8030e7:	00 00 00 
+  8030ea:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8030f0:	eb 2c                	jmp    80311e <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8030f2:	4c 39 f8             	cmp    %r15,%rax
+  8030f5:	0f 83 85 00 00 00    	jae    803180 <munmap+0xd8>
+            m->mm_end = start;
+  8030fb:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803100:	48 83 c3 18          	add    $0x18,%rbx
+  803104:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80310b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803112:	00 00 00 
+  803115:	48 39 c3             	cmp    %rax,%rbx
+  803118:	0f 84 d0 00 00 00    	je     8031ee <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80311e:	49 89 dc             	mov    %rbx,%r12
+  803121:	48 8b 03             	mov    (%rbx),%rax
+  803124:	4c 39 f0             	cmp    %r14,%rax
+  803127:	73 d7                	jae    803100 <munmap+0x58>
+  803129:	48 85 c0             	test   %rax,%rax
+  80312c:	74 d2                	je     803100 <munmap+0x58>
+  80312e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803132:	49 39 d7             	cmp    %rdx,%r15
+  803135:	73 c9                	jae    803100 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803137:	49 39 d6             	cmp    %rdx,%r14
+  80313a:	73 b6                	jae    8030f2 <munmap+0x4a>
+  80313c:	49 39 c7             	cmp    %rax,%r15
+  80313f:	76 b1                	jbe    8030f2 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803141:	4c 89 ef             	mov    %r13,%rdi
+  803144:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  80314b:	00 00 00 
+  80314e:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803150:	48 85 c0             	test   %rax,%rax
+  803153:	0f 84 c5 00 00 00    	je     80321e <munmap+0x176>
+            *tail = *m;
+  803159:	48 8b 13             	mov    (%rbx),%rdx
+  80315c:	48 89 10             	mov    %rdx,(%rax)
+  80315f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803163:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803167:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80316b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80316f:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803172:	44 89 f2             	mov    %r14d,%edx
+  803175:	2b 13                	sub    (%rbx),%edx
+  803177:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80317a:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80317e:	eb 80                	jmp    803100 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803180:	49 39 d6             	cmp    %rdx,%r14
+  803183:	73 18                	jae    80319d <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803185:	44 89 f2             	mov    %r14d,%edx
+  803188:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80318d:	29 c2                	sub    %eax,%edx
+  80318f:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803194:	4d 89 34 24          	mov    %r14,(%r12)
+  803198:	e9 63 ff ff ff       	jmp    803100 <munmap+0x58>
+    m->mm_start = 0;
+  80319d:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8031a4:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8031a5:	4c 89 e6             	mov    %r12,%rsi
+  8031a8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031af:	00 00 00 
+  8031b2:	48 29 c6             	sub    %rax,%rsi
+  8031b5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031b9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031c0:	aa aa aa 
+  8031c3:	48 0f af f0          	imul   %rax,%rsi
+  8031c7:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031cb:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031d0:	48 01 c6             	add    %rax,%rsi
+  8031d3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031d8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031dd:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  8031e4:	00 00 00 
+  8031e7:	ff d0                	call   *%rax
+}
+  8031e9:	e9 12 ff ff ff       	jmp    803100 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8031ee:	4c 89 f2             	mov    %r14,%rdx
+  8031f1:	4c 29 fa             	sub    %r15,%rdx
+  8031f4:	4c 89 fe             	mov    %r15,%rsi
+  8031f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031fc:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  803203:	00 00 00 
+  803206:	ff d0                	call   *%rax
+}
+  803208:	48 83 c4 08          	add    $0x8,%rsp
+  80320c:	5b                   	pop    %rbx
+  80320d:	41 5c                	pop    %r12
+  80320f:	41 5d                	pop    %r13
+  803211:	41 5e                	pop    %r14
+  803213:	41 5f                	pop    %r15
+  803215:	5d                   	pop    %rbp
+  803216:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803217:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80321c:	eb ea                	jmp    803208 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80321e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803223:	eb e3                	jmp    803208 <munmap+0x160>
+
+0000000000803225 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803225:	55                   	push   %rbp
+  803226:	48 89 e5             	mov    %rsp,%rbp
+  803229:	41 57                	push   %r15
+  80322b:	41 56                	push   %r14
+  80322d:	41 55                	push   %r13
+  80322f:	41 54                	push   %r12
+  803231:	53                   	push   %rbx
+  803232:	48 83 ec 28          	sub    $0x28,%rsp
+  803236:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80323a:	49 89 f5             	mov    %rsi,%r13
+  80323d:	41 89 d6             	mov    %edx,%r14d
+  803240:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803243:	41 89 cc             	mov    %ecx,%r12d
+  803246:	44 89 c7             	mov    %r8d,%edi
+  803249:	44 89 cb             	mov    %r9d,%ebx
+  80324c:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803250:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803254:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+  803260:	41 89 c7             	mov    %eax,%r15d
+  803263:	85 c0                	test   %eax,%eax
+  803265:	0f 88 ae 01 00 00    	js     803419 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80326b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80326f:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803276:	00 00 00 
+  803279:	8b 32                	mov    (%rdx),%esi
+  80327b:	39 30                	cmp    %esi,(%rax)
+  80327d:	0f 85 7a 02 00 00    	jne    8034fd <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803283:	8b 40 08             	mov    0x8(%rax),%eax
+  803286:	83 e0 03             	and    $0x3,%eax
+  803289:	83 f8 01             	cmp    $0x1,%eax
+  80328c:	0f 84 76 02 00 00    	je     803508 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803292:	4d 85 ed             	test   %r13,%r13
+  803295:	0f 84 78 02 00 00    	je     803513 <mmap+0x2ee>
+  80329b:	85 db                	test   %ebx,%ebx
+  80329d:	0f 88 70 02 00 00    	js     803513 <mmap+0x2ee>
+  8032a3:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032a9:	41 89 df             	mov    %ebx,%r15d
+  8032ac:	0f 85 6c 02 00 00    	jne    80351e <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032b2:	44 89 f0             	mov    %r14d,%eax
+  8032b5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032b8:	83 f8 04             	cmp    $0x4,%eax
+  8032bb:	0f 85 68 02 00 00    	jne    803529 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032c1:	44 89 e1             	mov    %r12d,%ecx
+  8032c4:	83 e1 01             	and    $0x1,%ecx
+  8032c7:	0f 95 c2             	setne  %dl
+  8032ca:	44 89 e0             	mov    %r12d,%eax
+  8032cd:	d1 e8                	shr    %eax
+  8032cf:	83 f0 01             	xor    $0x1,%eax
+  8032d2:	83 e0 01             	and    $0x1,%eax
+  8032d5:	38 c2                	cmp    %al,%dl
+  8032d7:	0f 85 57 02 00 00    	jne    803534 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032dd:	85 c9                	test   %ecx,%ecx
+  8032df:	74 0a                	je     8032eb <mmap+0xc6>
+  8032e1:	41 f6 c6 02          	test   $0x2,%r14b
+  8032e5:	0f 85 54 02 00 00    	jne    80353f <mmap+0x31a>
+    file_flush_buffers();
+  8032eb:	48 b8 a0 2d 80 00 00 	movabs $0x802da0,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8032f7:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8032fe:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803305:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803309:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80330c:	41 f6 c4 04          	test   $0x4,%r12b
+  803310:	0f 84 15 01 00 00    	je     80342b <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803316:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803319:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80331f:	0f 85 25 02 00 00    	jne    80354a <mmap+0x325>
+  803325:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803329:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803330:	00 00 00 
+  803333:	48 39 c2             	cmp    %rax,%rdx
+  803336:	0f 82 19 02 00 00    	jb     803555 <mmap+0x330>
+  80333c:	48 39 c7             	cmp    %rax,%rdi
+  80333f:	0f 87 10 02 00 00    	ja     803555 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803345:	4c 89 ee             	mov    %r13,%rsi
+  803348:	48 b8 a8 30 80 00 00 	movabs $0x8030a8,%rax
+  80334f:	00 00 00 
+  803352:	ff d0                	call   *%rax
+  803354:	85 c0                	test   %eax,%eax
+  803356:	0f 88 04 02 00 00    	js     803560 <mmap+0x33b>
+    if (!handler) {
+  80335c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803363:	00 00 00 
+  803366:	80 38 00             	cmpb   $0x0,(%rax)
+  803369:	75 2b                	jne    803396 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80336b:	48 bf 40 21 80 00 00 	movabs $0x802140,%rdi
+  803372:	00 00 00 
+  803375:	48 b8 a4 42 80 00 00 	movabs $0x8042a4,%rax
+  80337c:	00 00 00 
+  80337f:	ff d0                	call   *%rax
+  803381:	85 c0                	test   %eax,%eax
+  803383:	0f 88 ea 01 00 00    	js     803573 <mmap+0x34e>
+        handler = 1;
+  803389:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803390:	00 00 00 
+  803393:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803396:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80339a:	48 b8 df 21 80 00 00 	movabs $0x8021df,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+  8033a6:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033a9:	48 85 c0             	test   %rax,%rax
+  8033ac:	0f 84 c9 01 00 00    	je     80357b <mmap+0x356>
+    m->mm_start = va;
+  8033b2:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033b5:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033b9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033bd:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033c0:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033c4:	44 89 e0             	mov    %r12d,%eax
+  8033c7:	c1 e0 06             	shl    $0x6,%eax
+  8033ca:	25 80 00 00 00       	and    $0x80,%eax
+  8033cf:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033d2:	09 f0                	or     %esi,%eax
+  8033d4:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033d8:	41 f6 c4 08          	test   $0x8,%r12b
+  8033dc:	74 31                	je     80340f <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033de:	48 39 d3             	cmp    %rdx,%rbx
+  8033e1:	73 2c                	jae    80340f <mmap+0x1ea>
+  8033e3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8033e8:	48 89 de             	mov    %rbx,%rsi
+  8033eb:	4c 89 f7             	mov    %r14,%rdi
+  8033ee:	48 b8 2f 20 80 00 00 	movabs $0x80202f,%rax
+  8033f5:	00 00 00 
+  8033f8:	ff d0                	call   *%rax
+  8033fa:	49 89 c4             	mov    %rax,%r12
+  8033fd:	48 85 c0             	test   %rax,%rax
+  803400:	0f 8e d7 00 00 00    	jle    8034dd <mmap+0x2b8>
+            va += n;
+  803406:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803409:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80340d:	72 d4                	jb     8033e3 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80340f:	49 8b 06             	mov    (%r14),%rax
+  803412:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803416:	48 89 06             	mov    %rax,(%rsi)
+}
+  803419:	44 89 f8             	mov    %r15d,%eax
+  80341c:	48 83 c4 28          	add    $0x28,%rsp
+  803420:	5b                   	pop    %rbx
+  803421:	41 5c                	pop    %r12
+  803423:	41 5d                	pop    %r13
+  803425:	41 5e                	pop    %r14
+  803427:	41 5f                	pop    %r15
+  803429:	5d                   	pop    %rbp
+  80342a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80342b:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803432:	00 00 00 
+  803435:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803438:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80343f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803442:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803447:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80344e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803451:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803458:	00 00 00 
+  80345b:	48 39 d7             	cmp    %rdx,%rdi
+  80345e:	73 1c                	jae    80347c <mmap+0x257>
+        return -E_NO_MEM;
+  803460:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803466:	eb b1                	jmp    803419 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803468:	48 83 c0 01          	add    $0x1,%rax
+  80346c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803470:	77 3f                	ja     8034b1 <mmap+0x28c>
+  803472:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803477:	48 39 d7             	cmp    %rdx,%rdi
+  80347a:	72 2a                	jb     8034a6 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80347c:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803480:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803484:	48 39 d1             	cmp    %rdx,%rcx
+  803487:	73 df                	jae    803468 <mmap+0x243>
+  803489:	48 85 c9             	test   %rcx,%rcx
+  80348c:	74 da                	je     803468 <mmap+0x243>
+  80348e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803492:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803497:	48 39 d3             	cmp    %rdx,%rbx
+  80349a:	73 cc                	jae    803468 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80349c:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80349f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034a4:	eb cc                	jmp    803472 <mmap+0x24d>
+        return -E_NO_MEM;
+  8034a6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034ac:	e9 68 ff ff ff       	jmp    803419 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034b1:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034b6:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034bd:	00 00 00 
+  8034c0:	48 39 c2             	cmp    %rax,%rdx
+  8034c3:	0f 82 9f 00 00 00    	jb     803568 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034c9:	48 85 db             	test   %rbx,%rbx
+  8034cc:	0f 85 8a fe ff ff    	jne    80335c <mmap+0x137>
+        return -E_NO_MEM;
+  8034d2:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034d8:	e9 3c ff ff ff       	jmp    803419 <mmap+0x1f4>
+        if (n < 0) {
+  8034dd:	0f 89 2c ff ff ff    	jns    80340f <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8034e3:	49 8b 3e             	mov    (%r14),%rdi
+  8034e6:	4c 89 ee             	mov    %r13,%rsi
+  8034e9:	48 b8 a8 30 80 00 00 	movabs $0x8030a8,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+            return n;
+  8034f5:	45 89 e7             	mov    %r12d,%r15d
+  8034f8:	e9 1c ff ff ff       	jmp    803419 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034fd:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803503:	e9 11 ff ff ff       	jmp    803419 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803508:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80350e:	e9 06 ff ff ff       	jmp    803419 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803513:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803519:	e9 fb fe ff ff       	jmp    803419 <mmap+0x1f4>
+  80351e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803524:	e9 f0 fe ff ff       	jmp    803419 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803529:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80352f:	e9 e5 fe ff ff       	jmp    803419 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803534:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80353a:	e9 da fe ff ff       	jmp    803419 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80353f:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803545:	e9 cf fe ff ff       	jmp    803419 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80354a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803550:	e9 c4 fe ff ff       	jmp    803419 <mmap+0x1f4>
+  803555:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80355b:	e9 b9 fe ff ff       	jmp    803419 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803560:	41 89 c7             	mov    %eax,%r15d
+  803563:	e9 b1 fe ff ff       	jmp    803419 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803568:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80356e:	e9 a6 fe ff ff       	jmp    803419 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803573:	41 89 c7             	mov    %eax,%r15d
+  803576:	e9 9e fe ff ff       	jmp    803419 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80357b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803581:	e9 93 fe ff ff       	jmp    803419 <mmap+0x1f4>
+
+0000000000803586 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803586:	55                   	push   %rbp
+  803587:	48 89 e5             	mov    %rsp,%rbp
+  80358a:	41 54                	push   %r12
+  80358c:	53                   	push   %rbx
+  80358d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803590:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  803597:	00 00 00 
+  80359a:	ff d0                	call   *%rax
+  80359c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80359f:	48 be 20 4d 80 00 00 	movabs $0x804d20,%rsi
+  8035a6:	00 00 00 
+  8035a9:	48 89 df             	mov    %rbx,%rdi
+  8035ac:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  8035b3:	00 00 00 
+  8035b6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035b8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035bd:	41 2b 04 24          	sub    (%r12),%eax
+  8035c1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035c7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035ce:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035d1:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035d8:	00 00 00 
+  8035db:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8035e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8035e7:	5b                   	pop    %rbx
+  8035e8:	41 5c                	pop    %r12
+  8035ea:	5d                   	pop    %rbp
+  8035eb:	c3                   	ret
+
+00000000008035ec <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035ec:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8035ef:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8035f5:	8b 17                	mov    (%rdi),%edx
+  8035f7:	85 d2                	test   %edx,%edx
+  8035f9:	75 01                	jne    8035fc <pipe_wakeup+0x10>
+  8035fb:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+  803600:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803603:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803609:	be 00 04 00 00       	mov    $0x400,%esi
+  80360e:	48 b8 e5 13 80 00 00 	movabs $0x8013e5,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+}
+  80361a:	5d                   	pop    %rbp
+  80361b:	c3                   	ret
+
+000000000080361c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+  803620:	41 55                	push   %r13
+  803622:	41 54                	push   %r12
+  803624:	53                   	push   %rbx
+  803625:	48 83 ec 08          	sub    $0x8,%rsp
+  803629:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80362c:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  803633:	00 00 00 
+  803636:	ff d0                	call   *%rax
+  803638:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80363b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803640:	4c 89 e6             	mov    %r12,%rsi
+  803643:	bf 00 00 00 00       	mov    $0x0,%edi
+  803648:	49 bc ff 10 80 00 00 	movabs $0x8010ff,%r12
+  80364f:	00 00 00 
+  803652:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803655:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803659:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80365d:	49 bd ec 35 80 00 00 	movabs $0x8035ec,%r13
+  803664:	00 00 00 
+  803667:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80366a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80366e:	48 89 de             	mov    %rbx,%rsi
+  803671:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803674:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803679:	48 89 de             	mov    %rbx,%rsi
+  80367c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803681:	41 ff d4             	call   *%r12
+  803684:	48 83 c4 08          	add    $0x8,%rsp
+  803688:	5b                   	pop    %rbx
+  803689:	41 5c                	pop    %r12
+  80368b:	41 5d                	pop    %r13
+  80368d:	5d                   	pop    %rbp
+  80368e:	c3                   	ret
+
+000000000080368f <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80368f:	55                   	push   %rbp
+  803690:	48 89 e5             	mov    %rsp,%rbp
+  803693:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803696:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80369b:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036a0:	48 b8 42 10 80 00 00 	movabs $0x801042,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+  8036ac:	85 c0                	test   %eax,%eax
+  8036ae:	0f 94 c0             	sete   %al
+  8036b1:	0f b6 c0             	movzbl %al,%eax
+}
+  8036b4:	5d                   	pop    %rbp
+  8036b5:	c3                   	ret
+
+00000000008036b6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036b6:	55                   	push   %rbp
+  8036b7:	48 89 e5             	mov    %rsp,%rbp
+  8036ba:	41 57                	push   %r15
+  8036bc:	41 56                	push   %r14
+  8036be:	41 55                	push   %r13
+  8036c0:	41 54                	push   %r12
+  8036c2:	53                   	push   %rbx
+  8036c3:	48 83 ec 38          	sub    $0x38,%rsp
+  8036c7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036cb:	49 89 f4             	mov    %rsi,%r12
+  8036ce:	49 89 d7             	mov    %rdx,%r15
+  8036d1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036d5:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+  8036e1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8036e4:	4d 85 ff             	test   %r15,%r15
+  8036e7:	0f 84 f1 00 00 00    	je     8037de <devpipe_write+0x128>
+  8036ed:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8036f1:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8036f5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8036f9:	49 bd 8f 36 80 00 00 	movabs $0x80368f,%r13
+  803700:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803703:	49 bf ec 35 80 00 00 	movabs $0x8035ec,%r15
+  80370a:	00 00 00 
+  80370d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803711:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803715:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803719:	8b 73 04             	mov    0x4(%rbx),%esi
+  80371c:	48 63 ce             	movslq %esi,%rcx
+  80371f:	48 63 03             	movslq (%rbx),%rax
+  803722:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803728:	48 39 c1             	cmp    %rax,%rcx
+  80372b:	72 64                	jb     803791 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80372d:	48 89 de             	mov    %rbx,%rsi
+  803730:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803734:	41 ff d5             	call   *%r13
+  803737:	85 c0                	test   %eax,%eax
+  803739:	0f 85 b9 00 00 00    	jne    8037f8 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80373f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803743:	4c 89 f7             	mov    %r14,%rdi
+  803746:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803749:	8b 43 04             	mov    0x4(%rbx),%eax
+  80374c:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803753:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80375a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803760:	8b 03                	mov    (%rbx),%eax
+  803762:	41 39 c4             	cmp    %eax,%r12d
+  803765:	75 b2                	jne    803719 <devpipe_write+0x63>
+  803767:	48 89 de             	mov    %rbx,%rsi
+  80376a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80376e:	41 ff d5             	call   *%r13
+  803771:	85 c0                	test   %eax,%eax
+  803773:	75 a0                	jne    803715 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803775:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80377a:	44 89 e6             	mov    %r12d,%esi
+  80377d:	48 89 df             	mov    %rbx,%rdi
+  803780:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  803787:	00 00 00 
+  80378a:	ff d0                	call   *%rax
+  80378c:	e9 7c ff ff ff       	jmp    80370d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803791:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803795:	41 0f b6 38          	movzbl (%r8),%edi
+  803799:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8037a0:	80 80 80 
+  8037a3:	48 89 c8             	mov    %rcx,%rax
+  8037a6:	48 f7 e2             	mul    %rdx
+  8037a9:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037ad:	48 89 d0             	mov    %rdx,%rax
+  8037b0:	48 c1 e0 08          	shl    $0x8,%rax
+  8037b4:	48 29 d0             	sub    %rdx,%rax
+  8037b7:	48 c1 e0 04          	shl    $0x4,%rax
+  8037bb:	48 29 c1             	sub    %rax,%rcx
+  8037be:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037c3:	83 c6 01             	add    $0x1,%esi
+  8037c6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037c9:	49 83 c0 01          	add    $0x1,%r8
+  8037cd:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037d1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037d5:	49 39 c0             	cmp    %rax,%r8
+  8037d8:	0f 85 2f ff ff ff    	jne    80370d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037de:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8037e2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8037e6:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  8037ed:	00 00 00 
+  8037f0:	ff d0                	call   *%rax
+    return n;
+  8037f2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8037f6:	eb 05                	jmp    8037fd <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8037f8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037fd:	48 83 c4 38          	add    $0x38,%rsp
+  803801:	5b                   	pop    %rbx
+  803802:	41 5c                	pop    %r12
+  803804:	41 5d                	pop    %r13
+  803806:	41 5e                	pop    %r14
+  803808:	41 5f                	pop    %r15
+  80380a:	5d                   	pop    %rbp
+  80380b:	c3                   	ret
+
+000000000080380c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80380c:	55                   	push   %rbp
+  80380d:	48 89 e5             	mov    %rsp,%rbp
+  803810:	41 57                	push   %r15
+  803812:	41 56                	push   %r14
+  803814:	41 55                	push   %r13
+  803816:	41 54                	push   %r12
+  803818:	53                   	push   %rbx
+  803819:	48 83 ec 28          	sub    $0x28,%rsp
+  80381d:	49 89 fd             	mov    %rdi,%r13
+  803820:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803824:	49 89 d4             	mov    %rdx,%r12
+  803827:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80382b:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  803832:	00 00 00 
+  803835:	ff d0                	call   *%rax
+  803837:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80383a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803840:	49 bf 8f 36 80 00 00 	movabs $0x80368f,%r15
+  803847:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  80384a:	4d 85 e4             	test   %r12,%r12
+  80384d:	0f 84 d5 00 00 00    	je     803928 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803853:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803857:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80385b:	8b 03                	mov    (%rbx),%eax
+  80385d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803860:	75 7a                	jne    8038dc <devpipe_read+0xd0>
+            if (i > 0) {
+  803862:	4d 85 f6             	test   %r14,%r14
+  803865:	75 50                	jne    8038b7 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803867:	48 89 de             	mov    %rbx,%rsi
+  80386a:	4c 89 ef             	mov    %r13,%rdi
+  80386d:	41 ff d7             	call   *%r15
+  803870:	85 c0                	test   %eax,%eax
+  803872:	0f 85 c9 00 00 00    	jne    803941 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803878:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80387b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803882:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803888:	8b 43 04             	mov    0x4(%rbx),%eax
+  80388b:	41 39 c4             	cmp    %eax,%r12d
+  80388e:	75 cb                	jne    80385b <devpipe_read+0x4f>
+  803890:	48 89 de             	mov    %rbx,%rsi
+  803893:	4c 89 ef             	mov    %r13,%rdi
+  803896:	41 ff d7             	call   *%r15
+  803899:	85 c0                	test   %eax,%eax
+  80389b:	75 be                	jne    80385b <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80389d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8038a2:	44 89 e6             	mov    %r12d,%esi
+  8038a5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038a9:	48 b8 c7 13 80 00 00 	movabs $0x8013c7,%rax
+  8038b0:	00 00 00 
+  8038b3:	ff d0                	call   *%rax
+  8038b5:	eb a4                	jmp    80385b <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038b7:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038bb:	48 89 de             	mov    %rbx,%rsi
+  8038be:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  8038c5:	00 00 00 
+  8038c8:	ff d0                	call   *%rax
+                return i;
+  8038ca:	4c 89 f0             	mov    %r14,%rax
+}
+  8038cd:	48 83 c4 28          	add    $0x28,%rsp
+  8038d1:	5b                   	pop    %rbx
+  8038d2:	41 5c                	pop    %r12
+  8038d4:	41 5d                	pop    %r13
+  8038d6:	41 5e                	pop    %r14
+  8038d8:	41 5f                	pop    %r15
+  8038da:	5d                   	pop    %rbp
+  8038db:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038dc:	48 63 c8             	movslq %eax,%rcx
+  8038df:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8038e6:	80 80 80 
+  8038e9:	48 89 c8             	mov    %rcx,%rax
+  8038ec:	48 f7 e2             	mul    %rdx
+  8038ef:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8038f3:	48 89 d0             	mov    %rdx,%rax
+  8038f6:	48 c1 e0 08          	shl    $0x8,%rax
+  8038fa:	48 29 d0             	sub    %rdx,%rax
+  8038fd:	48 c1 e0 04          	shl    $0x4,%rax
+  803901:	48 89 c2             	mov    %rax,%rdx
+  803904:	48 89 c8             	mov    %rcx,%rax
+  803907:	48 29 d0             	sub    %rdx,%rax
+  80390a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80390f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803913:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803917:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80391a:	49 83 c6 01          	add    $0x1,%r14
+  80391e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803922:	0f 85 2b ff ff ff    	jne    803853 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803928:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80392c:	48 89 de             	mov    %rbx,%rsi
+  80392f:	48 b8 ec 35 80 00 00 	movabs $0x8035ec,%rax
+  803936:	00 00 00 
+  803939:	ff d0                	call   *%rax
+    return n;
+  80393b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80393f:	eb 8c                	jmp    8038cd <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803941:	b8 00 00 00 00       	mov    $0x0,%eax
+  803946:	eb 85                	jmp    8038cd <devpipe_read+0xc1>
+
+0000000000803948 <pipe>:
+pipe(int pfd[2]) {
+  803948:	55                   	push   %rbp
+  803949:	48 89 e5             	mov    %rsp,%rbp
+  80394c:	41 55                	push   %r13
+  80394e:	41 54                	push   %r12
+  803950:	53                   	push   %rbx
+  803951:	48 83 ec 18          	sub    $0x18,%rsp
+  803955:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803958:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80395c:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+  803968:	89 c3                	mov    %eax,%ebx
+  80396a:	85 c0                	test   %eax,%eax
+  80396c:	0f 88 a0 01 00 00    	js     803b12 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803972:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803977:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80397c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803980:	bf 00 00 00 00       	mov    $0x0,%edi
+  803985:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  80398c:	00 00 00 
+  80398f:	ff d0                	call   *%rax
+  803991:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803993:	85 c0                	test   %eax,%eax
+  803995:	0f 88 77 01 00 00    	js     803b12 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80399b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80399f:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+  8039ab:	89 c3                	mov    %eax,%ebx
+  8039ad:	85 c0                	test   %eax,%eax
+  8039af:	0f 88 43 01 00 00    	js     803af8 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039b5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039bf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039c8:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  8039cf:	00 00 00 
+  8039d2:	ff d0                	call   *%rax
+  8039d4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039d6:	85 c0                	test   %eax,%eax
+  8039d8:	0f 88 1a 01 00 00    	js     803af8 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039de:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8039e2:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  8039e9:	00 00 00 
+  8039ec:	ff d0                	call   *%rax
+  8039ee:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8039f1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039fb:	48 89 c6             	mov    %rax,%rsi
+  8039fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a03:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  803a0a:	00 00 00 
+  803a0d:	ff d0                	call   *%rax
+  803a0f:	89 c3                	mov    %eax,%ebx
+  803a11:	85 c0                	test   %eax,%eax
+  803a13:	0f 88 c5 00 00 00    	js     803ade <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a19:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a1d:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  803a24:	00 00 00 
+  803a27:	ff d0                	call   *%rax
+  803a29:	48 89 c1             	mov    %rax,%rcx
+  803a2c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a32:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a38:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a3d:	4c 89 ee             	mov    %r13,%rsi
+  803a40:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a45:	48 b8 af 10 80 00 00 	movabs $0x8010af,%rax
+  803a4c:	00 00 00 
+  803a4f:	ff d0                	call   *%rax
+  803a51:	89 c3                	mov    %eax,%ebx
+  803a53:	85 c0                	test   %eax,%eax
+  803a55:	78 6e                	js     803ac5 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a57:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a5c:	4c 89 ef             	mov    %r13,%rdi
+  803a5f:	48 b8 1e 10 80 00 00 	movabs $0x80101e,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+  803a6b:	83 f8 02             	cmp    $0x2,%eax
+  803a6e:	0f 85 ab 00 00 00    	jne    803b1f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a74:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a7b:	00 00 
+  803a7d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a81:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803a83:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a87:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803a8e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803a92:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803a94:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803a98:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803a9f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803aa3:	48 bb 8c 14 80 00 00 	movabs $0x80148c,%rbx
+  803aaa:	00 00 00 
+  803aad:	ff d3                	call   *%rbx
+  803aaf:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ab3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ab7:	ff d3                	call   *%rbx
+  803ab9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803abe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ac3:	eb 4d                	jmp    803b12 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ac5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aca:	4c 89 ee             	mov    %r13,%rsi
+  803acd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad2:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  803ad9:	00 00 00 
+  803adc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ade:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ae3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ae7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aec:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  803af3:	00 00 00 
+  803af6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803af8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803afd:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b06:	48 b8 ff 10 80 00 00 	movabs $0x8010ff,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+}
+  803b12:	89 d8                	mov    %ebx,%eax
+  803b14:	48 83 c4 18          	add    $0x18,%rsp
+  803b18:	5b                   	pop    %rbx
+  803b19:	41 5c                	pop    %r12
+  803b1b:	41 5d                	pop    %r13
+  803b1d:	5d                   	pop    %rbp
+  803b1e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b1f:	48 b9 50 4d 80 00 00 	movabs $0x804d50,%rcx
+  803b26:	00 00 00 
+  803b29:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  803b30:	00 00 00 
+  803b33:	be 50 00 00 00       	mov    $0x50,%esi
+  803b38:	48 bf 3c 4d 80 00 00 	movabs $0x804d3c,%rdi
+  803b3f:	00 00 00 
+  803b42:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b47:	49 b8 77 41 80 00 00 	movabs $0x804177,%r8
+  803b4e:	00 00 00 
+  803b51:	41 ff d0             	call   *%r8
+
+0000000000803b54 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b54:	55                   	push   %rbp
+  803b55:	48 89 e5             	mov    %rsp,%rbp
+  803b58:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b5c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b60:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  803b67:	00 00 00 
+  803b6a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b6c:	85 c0                	test   %eax,%eax
+  803b6e:	78 23                	js     803b93 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b70:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b74:	48 b8 9e 14 80 00 00 	movabs $0x80149e,%rax
+  803b7b:	00 00 00 
+  803b7e:	ff d0                	call   *%rax
+  803b80:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803b83:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b87:	48 b8 8f 36 80 00 00 	movabs $0x80368f,%rax
+  803b8e:	00 00 00 
+  803b91:	ff d0                	call   *%rax
+}
+  803b93:	c9                   	leave
+  803b94:	c3                   	ret
+
+0000000000803b95 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803b95:	48 89 f8             	mov    %rdi,%rax
+  803b98:	48 c1 e8 27          	shr    $0x27,%rax
+  803b9c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ba3:	01 00 00 
+  803ba6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803baa:	f6 c2 01             	test   $0x1,%dl
+  803bad:	74 6d                	je     803c1c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803baf:	48 89 f8             	mov    %rdi,%rax
+  803bb2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bb6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bbd:	01 00 00 
+  803bc0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bc4:	f6 c2 01             	test   $0x1,%dl
+  803bc7:	74 62                	je     803c2b <get_uvpt_entry+0x96>
+  803bc9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bd0:	01 00 00 
+  803bd3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bd7:	f6 c2 80             	test   $0x80,%dl
+  803bda:	75 4f                	jne    803c2b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bdc:	48 89 f8             	mov    %rdi,%rax
+  803bdf:	48 c1 e8 15          	shr    $0x15,%rax
+  803be3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bea:	01 00 00 
+  803bed:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bf1:	f6 c2 01             	test   $0x1,%dl
+  803bf4:	74 44                	je     803c3a <get_uvpt_entry+0xa5>
+  803bf6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803bfd:	01 00 00 
+  803c00:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c04:	f6 c2 80             	test   $0x80,%dl
+  803c07:	75 31                	jne    803c3a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c09:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c0d:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c14:	01 00 00 
+  803c17:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c1b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c1c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c23:	01 00 00 
+  803c26:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c2a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c2b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c32:	01 00 00 
+  803c35:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c39:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c3a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c41:	01 00 00 
+  803c44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c48:	c3                   	ret
+
+0000000000803c49 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c49:	55                   	push   %rbp
+  803c4a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c4d:	48 b8 95 3b 80 00 00 	movabs $0x803b95,%rax
+  803c54:	00 00 00 
+  803c57:	ff d0                	call   *%rax
+  803c59:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c5c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c61:	89 c1                	mov    %eax,%ecx
+  803c63:	83 c9 04             	or     $0x4,%ecx
+  803c66:	f6 c2 01             	test   $0x1,%dl
+  803c69:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c6c:	89 c1                	mov    %eax,%ecx
+  803c6e:	83 c9 02             	or     $0x2,%ecx
+  803c71:	f6 c2 02             	test   $0x2,%dl
+  803c74:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c77:	89 c1                	mov    %eax,%ecx
+  803c79:	83 c9 01             	or     $0x1,%ecx
+  803c7c:	48 85 d2             	test   %rdx,%rdx
+  803c7f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803c82:	89 c1                	mov    %eax,%ecx
+  803c84:	83 c9 40             	or     $0x40,%ecx
+  803c87:	f6 c6 04             	test   $0x4,%dh
+  803c8a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803c8d:	5d                   	pop    %rbp
+  803c8e:	c3                   	ret
+
+0000000000803c8f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803c8f:	55                   	push   %rbp
+  803c90:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c93:	48 b8 95 3b 80 00 00 	movabs $0x803b95,%rax
+  803c9a:	00 00 00 
+  803c9d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803c9f:	48 c1 e8 06          	shr    $0x6,%rax
+  803ca3:	83 e0 01             	and    $0x1,%eax
+}
+  803ca6:	5d                   	pop    %rbp
+  803ca7:	c3                   	ret
+
+0000000000803ca8 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803ca8:	55                   	push   %rbp
+  803ca9:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803cac:	48 b8 95 3b 80 00 00 	movabs $0x803b95,%rax
+  803cb3:	00 00 00 
+  803cb6:	ff d0                	call   *%rax
+  803cb8:	83 e0 01             	and    $0x1,%eax
+}
+  803cbb:	5d                   	pop    %rbp
+  803cbc:	c3                   	ret
+
+0000000000803cbd <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803cbd:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803cc4:	01 00 00 
+  803cc7:	a8 01                	test   $0x1,%al
+  803cc9:	75 06                	jne    803cd1 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803ccb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cd0:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cd1:	55                   	push   %rbp
+  803cd2:	48 89 e5             	mov    %rsp,%rbp
+  803cd5:	41 57                	push   %r15
+  803cd7:	41 56                	push   %r14
+  803cd9:	41 55                	push   %r13
+  803cdb:	41 54                	push   %r12
+  803cdd:	53                   	push   %rbx
+  803cde:	48 83 ec 28          	sub    $0x28,%rsp
+  803ce2:	49 89 fe             	mov    %rdi,%r14
+  803ce5:	49 89 f7             	mov    %rsi,%r15
+  803ce8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803cef:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803cf0:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803cf7:	01 00 00 
+  803cfa:	e9 ae 00 00 00       	jmp    803dad <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803cff:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d06:	49 83 ec 01          	sub    $0x1,%r12
+  803d0a:	74 2d                	je     803d39 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d0c:	48 89 d8             	mov    %rbx,%rax
+  803d0f:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d13:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d18:	f6 c2 01             	test   $0x1,%dl
+  803d1b:	74 e2                	je     803cff <foreach_shared_region+0x42>
+  803d1d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d22:	f6 c4 04             	test   $0x4,%ah
+  803d25:	74 d8                	je     803cff <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d27:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d2e:	4c 89 fa             	mov    %r15,%rdx
+  803d31:	48 89 df             	mov    %rbx,%rdi
+  803d34:	41 ff d6             	call   *%r14
+  803d37:	eb c6                	jmp    803cff <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d39:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d40:	00 
+  803d41:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d46:	74 4a                	je     803d92 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d48:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d4c:	48 c1 e8 15          	shr    $0x15,%rax
+  803d50:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d57:	01 00 00 
+  803d5a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d5e:	a8 01                	test   $0x1,%al
+  803d60:	74 d7                	je     803d39 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d62:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d66:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d6d:	48 39 c3             	cmp    %rax,%rbx
+  803d70:	73 c7                	jae    803d39 <foreach_shared_region+0x7c>
+  803d72:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d79:	48 39 d0             	cmp    %rdx,%rax
+  803d7c:	4d 19 e4             	sbb    %r12,%r12
+  803d7f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803d86:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803d8d:	e9 7a ff ff ff       	jmp    803d0c <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803d92:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803d99:	40 
+  803d9a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d9e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803da5:	00 00 00 
+  803da8:	48 39 c1             	cmp    %rax,%rcx
+  803dab:	74 50                	je     803dfd <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803dad:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803db1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803db5:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803dbc:	01 00 00 
+  803dbf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803dc3:	a8 01                	test   $0x1,%al
+  803dc5:	74 cb                	je     803d92 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803dc7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dcb:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803dd2:	48 39 c1             	cmp    %rax,%rcx
+  803dd5:	73 bb                	jae    803d92 <foreach_shared_region+0xd5>
+  803dd7:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803dde:	48 39 d0             	cmp    %rdx,%rax
+  803de1:	48 19 c0             	sbb    %rax,%rax
+  803de4:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803dea:	48 05 00 02 00 00    	add    $0x200,%rax
+  803df0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803df4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803df8:	e9 4b ff ff ff       	jmp    803d48 <foreach_shared_region+0x8b>
+  803dfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e02:	48 83 c4 28          	add    $0x28,%rsp
+  803e06:	5b                   	pop    %rbx
+  803e07:	41 5c                	pop    %r12
+  803e09:	41 5d                	pop    %r13
+  803e0b:	41 5e                	pop    %r14
+  803e0d:	41 5f                	pop    %r15
+  803e0f:	5d                   	pop    %rbp
+  803e10:	c3                   	ret
+
+0000000000803e11 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e11:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e17:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e1e:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e25:	c3                   	ret
+
+0000000000803e26 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e26:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e29:	8b 17                	mov    (%rdi),%edx
+  803e2b:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e2d:	83 f8 0f             	cmp    $0xf,%eax
+  803e30:	77 13                	ja     803e45 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e32:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e35:	83 e0 0f             	and    $0xf,%eax
+  803e38:	48 c1 e0 09          	shl    $0x9,%rax
+  803e3c:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e43:	00 
+  803e44:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e4a:	c3                   	ret
+
+0000000000803e4b <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e4b:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e4e:	83 c0 01             	add    $0x1,%eax
+  803e51:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e54:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e5a:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e62:	85 d2                	test   %edx,%edx
+  803e64:	75 04                	jne    803e6a <chan_publish+0x1f>
+  803e66:	83 e0 01             	and    $0x1,%eax
+}
+  803e69:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e6a:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e6d:	85 c0                	test   %eax,%eax
+  803e6f:	0f 95 c0             	setne  %al
+  803e72:	0f b6 c0             	movzbl %al,%eax
+  803e75:	eb ef                	jmp    803e66 <chan_publish+0x1b>
+
+0000000000803e77 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e77:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e7a:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e7c:	29 d0                	sub    %edx,%eax
+  803e7e:	83 e8 01             	sub    $0x1,%eax
+  803e81:	83 f8 0f             	cmp    $0xf,%eax
+  803e84:	77 12                	ja     803e98 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803e86:	8b 07                	mov    (%rdi),%eax
+  803e88:	83 e0 0f             	and    $0xf,%eax
+  803e8b:	48 c1 e0 09          	shl    $0x9,%rax
+  803e8f:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e96:	00 
+  803e97:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e98:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e9d:	c3                   	ret
+
+0000000000803e9e <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803e9e:	8b 07                	mov    (%rdi),%eax
+  803ea0:	83 c0 01             	add    $0x1,%eax
+  803ea3:	89 07                	mov    %eax,(%rdi)
+}
+  803ea5:	c3                   	ret
+
+0000000000803ea6 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803ea6:	55                   	push   %rbp
+  803ea7:	48 89 e5             	mov    %rsp,%rbp
+  803eaa:	53                   	push   %rbx
+  803eab:	48 83 ec 08          	sub    $0x8,%rsp
+  803eaf:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803eb2:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803eb9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803ebf:	48 b8 77 3e 80 00 00 	movabs $0x803e77,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+  803ecb:	48 85 c0             	test   %rax,%rax
+  803ece:	74 12                	je     803ee2 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803ed0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ed7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803edc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803ee0:	c9                   	leave
+  803ee1:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803ee2:	b8 01 00 00 00       	mov    $0x1,%eax
+  803ee7:	eb f3                	jmp    803edc <chan_arm+0x36>
+
+0000000000803ee9 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803ee9:	55                   	push   %rbp
+  803eea:	48 89 e5             	mov    %rsp,%rbp
+  803eed:	41 56                	push   %r14
+  803eef:	41 55                	push   %r13
+  803ef1:	41 54                	push   %r12
+  803ef3:	53                   	push   %rbx
+  803ef4:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803ef7:	49 bc a6 3e 80 00 00 	movabs $0x803ea6,%r12
+  803efe:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f01:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f05:	49 bd c7 13 80 00 00 	movabs $0x8013c7,%r13
+  803f0c:	00 00 00 
+    while (chan_arm(r))
+  803f0f:	eb 0d                	jmp    803f1e <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f11:	8b 33                	mov    (%rbx),%esi
+  803f13:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f18:	4c 89 f7             	mov    %r14,%rdi
+  803f1b:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f1e:	48 89 df             	mov    %rbx,%rdi
+  803f21:	41 ff d4             	call   *%r12
+  803f24:	84 c0                	test   %al,%al
+  803f26:	75 e9                	jne    803f11 <chan_wait+0x28>
+}
+  803f28:	5b                   	pop    %rbx
+  803f29:	41 5c                	pop    %r12
+  803f2b:	41 5d                	pop    %r13
+  803f2d:	41 5e                	pop    %r14
+  803f2f:	5d                   	pop    %rbp
+  803f30:	c3                   	ret
+
+0000000000803f31 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f31:	55                   	push   %rbp
+  803f32:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f35:	48 83 c7 40          	add    $0x40,%rdi
+  803f39:	be 01 00 00 00       	mov    $0x1,%esi
+  803f3e:	48 b8 e5 13 80 00 00 	movabs $0x8013e5,%rax
+  803f45:	00 00 00 
+  803f48:	ff d0                	call   *%rax
+}
+  803f4a:	5d                   	pop    %rbp
+  803f4b:	c3                   	ret
+
+0000000000803f4c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f51:	c3                   	ret
+
+0000000000803f52 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f52:	55                   	push   %rbp
+  803f53:	48 89 e5             	mov    %rsp,%rbp
+  803f56:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f59:	48 be 74 4d 80 00 00 	movabs $0x804d74,%rsi
+  803f60:	00 00 00 
+  803f63:	48 b8 fa 0a 80 00 00 	movabs $0x800afa,%rax
+  803f6a:	00 00 00 
+  803f6d:	ff d0                	call   *%rax
+    return 0;
+}
+  803f6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f74:	5d                   	pop    %rbp
+  803f75:	c3                   	ret
+
+0000000000803f76 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f76:	55                   	push   %rbp
+  803f77:	48 89 e5             	mov    %rsp,%rbp
+  803f7a:	41 57                	push   %r15
+  803f7c:	41 56                	push   %r14
+  803f7e:	41 55                	push   %r13
+  803f80:	41 54                	push   %r12
+  803f82:	53                   	push   %rbx
+  803f83:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803f8a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803f91:	48 85 d2             	test   %rdx,%rdx
+  803f94:	74 7a                	je     804010 <devcons_write+0x9a>
+  803f96:	49 89 d6             	mov    %rdx,%r14
+  803f99:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803f9f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803fa4:	49 bf f4 0c 80 00 00 	movabs $0x800cf4,%r15
+  803fab:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fae:	4c 89 f3             	mov    %r14,%rbx
+  803fb1:	48 29 f3             	sub    %rsi,%rbx
+  803fb4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fb9:	48 39 c3             	cmp    %rax,%rbx
+  803fbc:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fc0:	4c 63 eb             	movslq %ebx,%r13
+  803fc3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fca:	48 01 c6             	add    %rax,%rsi
+  803fcd:	4c 89 ea             	mov    %r13,%rdx
+  803fd0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fd7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803fda:	4c 89 ee             	mov    %r13,%rsi
+  803fdd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803fe4:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  803ff0:	41 01 dc             	add    %ebx,%r12d
+  803ff3:	49 63 f4             	movslq %r12d,%rsi
+  803ff6:	4c 39 f6             	cmp    %r14,%rsi
+  803ff9:	72 b3                	jb     803fae <devcons_write+0x38>
+    return res;
+  803ffb:	49 63 c4             	movslq %r12d,%rax
+}
+  803ffe:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804005:	5b                   	pop    %rbx
+  804006:	41 5c                	pop    %r12
+  804008:	41 5d                	pop    %r13
+  80400a:	41 5e                	pop    %r14
+  80400c:	41 5f                	pop    %r15
+  80400e:	5d                   	pop    %rbp
+  80400f:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804010:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804016:	eb e3                	jmp    803ffb <devcons_write+0x85>
+
+0000000000804018 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804018:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80401b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804020:	48 85 c0             	test   %rax,%rax
+  804023:	74 55                	je     80407a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804025:	55                   	push   %rbp
+  804026:	48 89 e5             	mov    %rsp,%rbp
+  804029:	41 55                	push   %r13
+  80402b:	41 54                	push   %r12
+  80402d:	53                   	push   %rbx
+  80402e:	48 83 ec 08          	sub    $0x8,%rsp
+  804032:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804035:	48 bb 40 0f 80 00 00 	movabs $0x800f40,%rbx
+  80403c:	00 00 00 
+  80403f:	49 bc f5 0f 80 00 00 	movabs $0x800ff5,%r12
+  804046:	00 00 00 
+  804049:	eb 03                	jmp    80404e <devcons_read+0x36>
+  80404b:	41 ff d4             	call   *%r12
+  80404e:	ff d3                	call   *%rbx
+  804050:	85 c0                	test   %eax,%eax
+  804052:	74 f7                	je     80404b <devcons_read+0x33>
+    if (c < 0) return c;
+  804054:	48 63 d0             	movslq %eax,%rdx
+  804057:	78 13                	js     80406c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80405e:	83 f8 04             	cmp    $0x4,%eax
+  804061:	74 09                	je     80406c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804063:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804067:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80406c:	48 89 d0             	mov    %rdx,%rax
+  80406f:	48 83 c4 08          	add    $0x8,%rsp
+  804073:	5b                   	pop    %rbx
+  804074:	41 5c                	pop    %r12
+  804076:	41 5d                	pop    %r13
+  804078:	5d                   	pop    %rbp
+  804079:	c3                   	ret
+  80407a:	48 89 d0             	mov    %rdx,%rax
+  80407d:	c3                   	ret
+
+000000000080407e <cputchar>:
+cputchar(int ch) {
+  80407e:	55                   	push   %rbp
+  80407f:	48 89 e5             	mov    %rsp,%rbp
+  804082:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804086:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80408a:	be 01 00 00 00       	mov    $0x1,%esi
+  80408f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804093:	48 b8 21 0f 80 00 00 	movabs $0x800f21,%rax
+  80409a:	00 00 00 
+  80409d:	ff d0                	call   *%rax
+}
+  80409f:	c9                   	leave
+  8040a0:	c3                   	ret
+
+00000000008040a1 <getchar>:
+getchar(void) {
+  8040a1:	55                   	push   %rbp
+  8040a2:	48 89 e5             	mov    %rsp,%rbp
+  8040a5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040a9:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040ae:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040b7:	48 b8 fd 17 80 00 00 	movabs $0x8017fd,%rax
+  8040be:	00 00 00 
+  8040c1:	ff d0                	call   *%rax
+  8040c3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040c5:	85 c0                	test   %eax,%eax
+  8040c7:	78 06                	js     8040cf <getchar+0x2e>
+  8040c9:	74 08                	je     8040d3 <getchar+0x32>
+  8040cb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040cf:	89 d0                	mov    %edx,%eax
+  8040d1:	c9                   	leave
+  8040d2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040d3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040d8:	eb f5                	jmp    8040cf <getchar+0x2e>
+
+00000000008040da <iscons>:
+iscons(int fdnum) {
+  8040da:	55                   	push   %rbp
+  8040db:	48 89 e5             	mov    %rsp,%rbp
+  8040de:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040e2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040e6:	48 b8 1a 15 80 00 00 	movabs $0x80151a,%rax
+  8040ed:	00 00 00 
+  8040f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040f2:	85 c0                	test   %eax,%eax
+  8040f4:	78 18                	js     80410e <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8040f6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8040fa:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  804101:	00 00 00 
+  804104:	8b 00                	mov    (%rax),%eax
+  804106:	39 02                	cmp    %eax,(%rdx)
+  804108:	0f 94 c0             	sete   %al
+  80410b:	0f b6 c0             	movzbl %al,%eax
+}
+  80410e:	c9                   	leave
+  80410f:	c3                   	ret
+
+0000000000804110 <opencons>:
+opencons(void) {
+  804110:	55                   	push   %rbp
+  804111:	48 89 e5             	mov    %rsp,%rbp
+  804114:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804118:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80411c:	48 b8 ba 14 80 00 00 	movabs $0x8014ba,%rax
+  804123:	00 00 00 
+  804126:	ff d0                	call   *%rax
+  804128:	85 c0                	test   %eax,%eax
+  80412a:	78 49                	js     804175 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80412c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804131:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804136:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80413a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413f:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+  80414b:	85 c0                	test   %eax,%eax
+  80414d:	78 26                	js     804175 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80414f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804153:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80415a:	00 00 
+  80415c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80415e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804162:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804169:	48 b8 8c 14 80 00 00 	movabs $0x80148c,%rax
+  804170:	00 00 00 
+  804173:	ff d0                	call   *%rax
+}
+  804175:	c9                   	leave
+  804176:	c3                   	ret
+
+0000000000804177 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804177:	55                   	push   %rbp
+  804178:	48 89 e5             	mov    %rsp,%rbp
+  80417b:	41 56                	push   %r14
+  80417d:	41 55                	push   %r13
+  80417f:	41 54                	push   %r12
+  804181:	53                   	push   %rbx
+  804182:	48 83 ec 50          	sub    $0x50,%rsp
+  804186:	49 89 fc             	mov    %rdi,%r12
+  804189:	41 89 f5             	mov    %esi,%r13d
+  80418c:	48 89 d3             	mov    %rdx,%rbx
+  80418f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804193:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804197:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80419b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8041a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041a6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041aa:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041ae:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041b2:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041b9:	00 00 00 
+  8041bc:	4c 8b 30             	mov    (%rax),%r14
+  8041bf:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  8041c6:	00 00 00 
+  8041c9:	ff d0                	call   *%rax
+  8041cb:	89 c6                	mov    %eax,%esi
+  8041cd:	45 89 e8             	mov    %r13d,%r8d
+  8041d0:	4c 89 e1             	mov    %r12,%rcx
+  8041d3:	4c 89 f2             	mov    %r14,%rdx
+  8041d6:	48 bf 80 4d 80 00 00 	movabs $0x804d80,%rdi
+  8041dd:	00 00 00 
+  8041e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041e5:	49 bc d5 01 80 00 00 	movabs $0x8001d5,%r12
+  8041ec:	00 00 00 
+  8041ef:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8041f2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8041f6:	48 89 df             	mov    %rbx,%rdi
+  8041f9:	48 b8 71 01 80 00 00 	movabs $0x800171,%rax
+  804200:	00 00 00 
+  804203:	ff d0                	call   *%rax
+    cprintf("\n");
+  804205:	48 bf c3 4c 80 00 00 	movabs $0x804cc3,%rdi
+  80420c:	00 00 00 
+  80420f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804214:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804217:	cc                   	int3
+  804218:	eb fd                	jmp    804217 <_panic+0xa0>
+
+000000000080421a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80421a:	55                   	push   %rbp
+  80421b:	48 89 e5             	mov    %rsp,%rbp
+  80421e:	41 56                	push   %r14
+  804220:	41 55                	push   %r13
+  804222:	41 54                	push   %r12
+  804224:	53                   	push   %rbx
+  804225:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804228:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80422f:	00 00 00 
+  804232:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804236:	74 27                	je     80425f <_handle_vectored_pagefault+0x45>
+  804238:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80423d:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804244:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804247:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80424a:	4c 89 e7             	mov    %r12,%rdi
+  80424d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804252:	84 c0                	test   %al,%al
+  804254:	75 45                	jne    80429b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804256:	48 83 c3 01          	add    $0x1,%rbx
+  80425a:	49 3b 1e             	cmp    (%r14),%rbx
+  80425d:	72 eb                	jb     80424a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80425f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804266:	00 
+  804267:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80426c:	4d 8b 04 24          	mov    (%r12),%r8
+  804270:	48 ba a8 4d 80 00 00 	movabs $0x804da8,%rdx
+  804277:	00 00 00 
+  80427a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80427f:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804286:	00 00 00 
+  804289:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428e:	49 ba 77 41 80 00 00 	movabs $0x804177,%r10
+  804295:	00 00 00 
+  804298:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80429b:	5b                   	pop    %rbx
+  80429c:	41 5c                	pop    %r12
+  80429e:	41 5d                	pop    %r13
+  8042a0:	41 5e                	pop    %r14
+  8042a2:	5d                   	pop    %rbp
+  8042a3:	c3                   	ret
+
+00000000008042a4 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042a4:	55                   	push   %rbp
+  8042a5:	48 89 e5             	mov    %rsp,%rbp
+  8042a8:	53                   	push   %rbx
+  8042a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ad:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042b0:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042b7:	00 00 00 
+  8042ba:	80 38 00             	cmpb   $0x0,(%rax)
+  8042bd:	0f 84 84 00 00 00    	je     804347 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c3:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042ca:	00 00 00 
+  8042cd:	48 8b 10             	mov    (%rax),%rdx
+  8042d0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042d5:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042dc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042df:	48 85 d2             	test   %rdx,%rdx
+  8042e2:	74 19                	je     8042fd <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042e4:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042e8:	0f 84 e8 00 00 00    	je     8043d6 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ee:	48 83 c0 01          	add    $0x1,%rax
+  8042f2:	48 39 d0             	cmp    %rdx,%rax
+  8042f5:	75 ed                	jne    8042e4 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042f7:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042fb:	74 1c                	je     804319 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042fd:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804301:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804308:	00 00 00 
+  80430b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804312:	00 00 00 
+  804315:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804319:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  804320:	00 00 00 
+  804323:	ff d0                	call   *%rax
+  804325:	89 c7                	mov    %eax,%edi
+  804327:	48 be 9c 44 80 00 00 	movabs $0x80449c,%rsi
+  80432e:	00 00 00 
+  804331:	48 b8 17 12 80 00 00 	movabs $0x801217,%rax
+  804338:	00 00 00 
+  80433b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80433d:	85 c0                	test   %eax,%eax
+  80433f:	78 68                	js     8043a9 <add_pgfault_handler+0x105>
+    return res;
+}
+  804341:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804345:	c9                   	leave
+  804346:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804347:	48 b8 cc 0f 80 00 00 	movabs $0x800fcc,%rax
+  80434e:	00 00 00 
+  804351:	ff d0                	call   *%rax
+  804353:	89 c7                	mov    %eax,%edi
+  804355:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80435a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80435f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804366:	00 00 00 
+  804369:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  804370:	00 00 00 
+  804373:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804375:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80437c:	00 00 00 
+  80437f:	48 8b 02             	mov    (%rdx),%rax
+  804382:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804386:	48 89 0a             	mov    %rcx,(%rdx)
+  804389:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804390:	00 00 00 
+  804393:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804397:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80439e:	00 00 00 
+  8043a1:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043a4:	e9 70 ff ff ff       	jmp    804319 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043a9:	89 c1                	mov    %eax,%ecx
+  8043ab:	48 ba e6 4d 80 00 00 	movabs $0x804de6,%rdx
+  8043b2:	00 00 00 
+  8043b5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043ba:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  8043c1:	00 00 00 
+  8043c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c9:	49 b8 77 41 80 00 00 	movabs $0x804177,%r8
+  8043d0:	00 00 00 
+  8043d3:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043db:	e9 61 ff ff ff       	jmp    804341 <add_pgfault_handler+0x9d>
+
+00000000008043e0 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043e0:	55                   	push   %rbp
+  8043e1:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043e4:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043eb:	00 00 00 
+  8043ee:	80 38 00             	cmpb   $0x0,(%rax)
+  8043f1:	74 33                	je     804426 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f3:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043fa:	00 00 00 
+  8043fd:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804402:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804409:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80440c:	48 85 c0             	test   %rax,%rax
+  80440f:	0f 84 85 00 00 00    	je     80449a <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804415:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804419:	74 40                	je     80445b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80441b:	48 83 c1 01          	add    $0x1,%rcx
+  80441f:	48 39 c1             	cmp    %rax,%rcx
+  804422:	75 f1                	jne    804415 <remove_pgfault_handler+0x35>
+  804424:	eb 74                	jmp    80449a <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804426:	48 b9 fe 4d 80 00 00 	movabs $0x804dfe,%rcx
+  80442d:	00 00 00 
+  804430:	48 ba 27 4d 80 00 00 	movabs $0x804d27,%rdx
+  804437:	00 00 00 
+  80443a:	be 43 00 00 00       	mov    $0x43,%esi
+  80443f:	48 bf d8 4d 80 00 00 	movabs $0x804dd8,%rdi
+  804446:	00 00 00 
+  804449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80444e:	49 b8 77 41 80 00 00 	movabs $0x804177,%r8
+  804455:	00 00 00 
+  804458:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80445b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804462:	00 
+  804463:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804467:	48 29 ca             	sub    %rcx,%rdx
+  80446a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804471:	00 00 00 
+  804474:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804478:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80447d:	48 89 ce             	mov    %rcx,%rsi
+  804480:	48 b8 f4 0c 80 00 00 	movabs $0x800cf4,%rax
+  804487:	00 00 00 
+  80448a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80448c:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804493:	00 00 00 
+  804496:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80449a:	5d                   	pop    %rbp
+  80449b:	c3                   	ret
+
+000000000080449c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80449c:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80449f:	48 b8 1a 42 80 00 00 	movabs $0x80421a,%rax
+  8044a6:	00 00 00 
+    call *%rax
+  8044a9:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044ab:	41 5f                	pop    %r15
+	popq %r15
+  8044ad:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044af:	41 5f                	pop    %r15
+	popq %r14
+  8044b1:	41 5e                	pop    %r14
+	popq %r13
+  8044b3:	41 5d                	pop    %r13
+	popq %r12
+  8044b5:	41 5c                	pop    %r12
+	popq %r11
+  8044b7:	41 5b                	pop    %r11
+	popq %r10
+  8044b9:	41 5a                	pop    %r10
+	popq %r9
+  8044bb:	41 59                	pop    %r9
+	popq %r8
+  8044bd:	41 58                	pop    %r8
+	popq %rsi
+  8044bf:	5e                   	pop    %rsi
+	popq %rdi
+  8044c0:	5f                   	pop    %rdi
+	popq %rbp
+  8044c1:	5d                   	pop    %rbp
+	popq %rdx
+  8044c2:	5a                   	pop    %rdx
+	popq %rcx
+  8044c3:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044c4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044c9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044ce:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044d2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044d5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044da:	5b                   	pop    %rbx
+	popq %rax
+  8044db:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044dc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044e0:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044e1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044e6:	c3                   	ret
+
+00000000008044e7 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044e7:	55                   	push   %rbp
+  8044e8:	48 89 e5             	mov    %rsp,%rbp
+  8044eb:	41 55                	push   %r13
+  8044ed:	41 54                	push   %r12
+  8044ef:	53                   	push   %rbx
+  8044f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8044f4:	49 89 fd             	mov    %rdi,%r13
+  8044f7:	48 89 f7             	mov    %rsi,%rdi
+  8044fa:	48 89 d3             	mov    %rdx,%rbx
+  8044fd:	49 89 cc             	mov    %rcx,%r12
+  804500:	4c 89 c2             	mov    %r8,%rdx
+  804503:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804506:	48 85 f6             	test   %rsi,%rsi
+  804509:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804510:	00 00 00 
+  804513:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804517:	be 00 10 00 00       	mov    $0x1000,%esi
+  80451c:	48 85 db             	test   %rbx,%rbx
+  80451f:	74 03                	je     804524 <ipc_recv_futex+0x3d>
+  804521:	48 8b 33             	mov    (%rbx),%rsi
+  804524:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804528:	48 b8 a3 12 80 00 00 	movabs $0x8012a3,%rax
+  80452f:	00 00 00 
+  804532:	ff d0                	call   *%rax
+    if (res < 0) {
+  804534:	85 c0                	test   %eax,%eax
+  804536:	78 75                	js     8045ad <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804538:	4d 85 ed             	test   %r13,%r13
+  80453b:	74 14                	je     804551 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80453d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804544:	00 00 00 
+  804547:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80454d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804551:	4d 85 e4             	test   %r12,%r12
+  804554:	74 14                	je     80456a <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804556:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80455d:	00 00 00 
+  804560:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804566:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80456a:	48 85 db             	test   %rbx,%rbx
+  80456d:	74 23                	je     804592 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80456f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804576:	00 00 00 
+  804579:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80457f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804584:	85 c9                	test   %ecx,%ecx
+  804586:	74 07                	je     80458f <ipc_recv_futex+0xa8>
+  804588:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80458f:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804592:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804599:	00 00 00 
+  80459c:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045a2:	48 83 c4 08          	add    $0x8,%rsp
+  8045a6:	5b                   	pop    %rbx
+  8045a7:	41 5c                	pop    %r12
+  8045a9:	41 5d                	pop    %r13
+  8045ab:	5d                   	pop    %rbp
+  8045ac:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045ad:	4d 85 ed             	test   %r13,%r13
+  8045b0:	74 08                	je     8045ba <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045b2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b9:	00 
+        if (perm_store != NULL) {
+  8045ba:	4d 85 e4             	test   %r12,%r12
+  8045bd:	74 08                	je     8045c7 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045bf:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045c6:	00 
+        if (size != NULL) {
+  8045c7:	48 85 db             	test   %rbx,%rbx
+  8045ca:	74 d6                	je     8045a2 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045cc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045d3:	eb cd                	jmp    8045a2 <ipc_recv_futex+0xbb>
+
+00000000008045d5 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045d5:	55                   	push   %rbp
+  8045d6:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8045dd:	6a 00                	push   $0x0
+  8045df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045eb:	48 b8 e7 44 80 00 00 	movabs $0x8044e7,%rax
+  8045f2:	00 00 00 
+  8045f5:	ff d0                	call   *%rax
+}
+  8045f7:	c9                   	leave
+  8045f8:	c3                   	ret
+
+00000000008045f9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f9:	55                   	push   %rbp
+  8045fa:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045fd:	48 85 d2             	test   %rdx,%rdx
+  804600:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804607:	00 00 00 
+  80460a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80460e:	89 f6                	mov    %esi,%esi
+  804610:	48 b8 8c 12 80 00 00 	movabs $0x80128c,%rax
+  804617:	00 00 00 
+  80461a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80461c:	85 c0                	test   %eax,%eax
+  80461e:	78 02                	js     804622 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804620:	5d                   	pop    %rbp
+  804621:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804622:	89 c1                	mov    %eax,%ecx
+  804624:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  80462b:	00 00 00 
+  80462e:	be 50 00 00 00       	mov    $0x50,%esi
+  804633:	48 bf 2c 4e 80 00 00 	movabs $0x804e2c,%rdi
+  80463a:	00 00 00 
+  80463d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804642:	49 b8 77 41 80 00 00 	movabs $0x804177,%r8
+  804649:	00 00 00 
+  80464c:	41 ff d0             	call   *%r8
+
+000000000080464f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80464f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804654:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80465b:	00 00 00 
+  80465e:	48 89 d0             	mov    %rdx,%rax
+  804661:	48 c1 e0 04          	shl    $0x4,%rax
+  804665:	48 29 d0             	sub    %rdx,%rax
+  804668:	48 c1 e0 05          	shl    $0x5,%rax
+  80466c:	48 01 c8             	add    %rcx,%rax
+  80466f:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804675:	39 f8                	cmp    %edi,%eax
+  804677:	74 13                	je     80468c <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804679:	48 83 c2 01          	add    $0x1,%rdx
+  80467d:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804684:	75 d8                	jne    80465e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804686:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80468b:	c3                   	ret
+            return envs[i].env_id;
+  80468c:	48 89 d0             	mov    %rdx,%rax
+  80468f:	48 c1 e0 04          	shl    $0x4,%rax
+  804693:	48 29 d0             	sub    %rdx,%rax
+  804696:	48 c1 e0 05          	shl    $0x5,%rax
+  80469a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046a1:	00 00 00 
+  8046a4:	48 01 d0             	add    %rdx,%rax
+  8046a7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046ad:	c3                   	ret
+  8046ae:	66 90                	xchg   %ax,%ax
+
+00000000008046b0 <__rodata_start>:
+  8046b0:	49 20 72 65          	rex.WB and %sil,0x65(%r10)
+  8046b4:	61                   	(bad)
+  8046b5:	64 20 25 30 38 78 20 	and    %ah,%fs:0x20783830(%rip)        # 20f87eec <__bss_end+0x20745eec>
+  8046bc:	66 72 6f             	data16 jb 80472e <__rodata_start+0x7e>
+  8046bf:	6d                   	insl   (%dx),%es:(%rdi)
+  8046c0:	20 6c 6f 63          	and    %ch,0x63(%rdi,%rbp,2)
+  8046c4:	61                   	(bad)
+  8046c5:	74 69                	je     804730 <__rodata_start+0x80>
+  8046c7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8046c8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046c9:	20 30                	and    %dh,(%rax)
+  8046cb:	78 38                	js     804705 <__rodata_start+0x55>
+  8046cd:	30 34 30             	xor    %dh,(%rax,%rsi,1)
+  8046d0:	30 30                	xor    %dh,(%rax)
+  8046d2:	30 30                	xor    %dh,(%rax)
+  8046d4:	30 30                	xor    %dh,(%rax)
+  8046d6:	21 0a                	and    %ecx,(%rdx)
+  8046d8:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8046df:	77 6e                	ja     80474f <__rodata_start+0x9f>
+  8046e1:	3e 00 30             	ds add %dh,(%rax)
+  8046e4:	31 32                	xor    %esi,(%rdx)
+  8046e6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046ed:	41                   	rex.B
+  8046ee:	42                   	rex.X
+  8046ef:	43                   	rex.XB
+  8046f0:	44                   	rex.R
+  8046f1:	45                   	rex.RB
+  8046f2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8046f5:	31 32                	xor    %esi,(%rdx)
+  8046f7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8046fe:	61                   	(bad)
+  8046ff:	62 63 64 65 66       	(bad)
+  804704:	00 28                	add    %ch,(%rax)
+  804706:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804707:	75 6c                	jne    804775 <__rodata_start+0xc5>
+  804709:	6c                   	insb   (%dx),%es:(%rdi)
+  80470a:	29 00                	sub    %eax,(%rax)
+  80470c:	65 72 72             	gs jb  804781 <__rodata_start+0xd1>
+  80470f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804710:	72 20                	jb     804732 <__rodata_start+0x82>
+  804712:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804717:	73 70                	jae    804789 <__rodata_start+0xd9>
+  804719:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80471d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804724:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804725:	72 00                	jb     804727 <__rodata_start+0x77>
+  804727:	62 61 64 20 65       	(bad)
+  80472c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80472d:	76 69                	jbe    804798 <__rodata_start+0xe8>
+  80472f:	72 6f                	jb     8047a0 <__rodata_start+0xf0>
+  804731:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804732:	6d                   	insl   (%dx),%es:(%rdi)
+  804733:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804735:	74 00                	je     804737 <__rodata_start+0x87>
+  804737:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80473e:	20 70 61             	and    %dh,0x61(%rax)
+  804741:	72 61                	jb     8047a4 <__rodata_start+0xf4>
+  804743:	6d                   	insl   (%dx),%es:(%rdi)
+  804744:	65 74 65             	gs je  8047ac <__rodata_start+0xfc>
+  804747:	72 00                	jb     804749 <__rodata_start+0x99>
+  804749:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80474a:	75 74                	jne    8047c0 <__rodata_start+0x110>
+  80474c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80474f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804752:	6d                   	insl   (%dx),%es:(%rdi)
+  804753:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804754:	72 79                	jb     8047cf <__rodata_start+0x11f>
+  804756:	00 6f 75             	add    %ch,0x75(%rdi)
+  804759:	74 20                	je     80477b <__rodata_start+0xcb>
+  80475b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80475c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804760:	76 69                	jbe    8047cb <__rodata_start+0x11b>
+  804762:	72 6f                	jb     8047d3 <__rodata_start+0x123>
+  804764:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804765:	6d                   	insl   (%dx),%es:(%rdi)
+  804766:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804768:	74 73                	je     8047dd <__rodata_start+0x12d>
+  80476a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80476d:	72 72                	jb     8047e1 <__rodata_start+0x131>
+  80476f:	75 70                	jne    8047e1 <__rodata_start+0x131>
+  804771:	74 65                	je     8047d8 <__rodata_start+0x128>
+  804773:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804778:	75 67                	jne    8047e1 <__rodata_start+0x131>
+  80477a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80477d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80477f:	00 73 65             	add    %dh,0x65(%rbx)
+  804782:	67 6d                	insl   (%dx),%es:(%edi)
+  804784:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804786:	74 61                	je     8047e9 <__rodata_start+0x139>
+  804788:	74 69                	je     8047f3 <__rodata_start+0x143>
+  80478a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80478b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80478c:	20 66 61             	and    %ah,0x61(%rsi)
+  80478f:	75 6c                	jne    8047fd <__rodata_start+0x14d>
+  804791:	74 00                	je     804793 <__rodata_start+0xe3>
+  804793:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80479a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80479d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8047a1:	61                   	(bad)
+  8047a2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8047a7:	20 73 75             	and    %dh,0x75(%rbx)
+  8047aa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8047ad:	73 79                	jae    804828 <__rodata_start+0x178>
+  8047af:	73 74                	jae    804825 <__rodata_start+0x175>
+  8047b1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8047b3:	20 63 61             	and    %ah,0x61(%rbx)
+  8047b6:	6c                   	insb   (%dx),%es:(%rdi)
+  8047b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8047b8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047bb:	74 72                	je     80482f <__rodata_start+0x17f>
+  8047bd:	79 20                	jns    8047df <__rodata_start+0x12f>
+  8047bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047c1:	74 20                	je     8047e3 <__rodata_start+0x133>
+  8047c3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047c5:	75 6e                	jne    804835 <__rodata_start+0x185>
+  8047c7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8047cb:	76 20                	jbe    8047ed <__rodata_start+0x13d>
+  8047cd:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047d4:	72 65                	jb     80483b <__rodata_start+0x18b>
+  8047d6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047d9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047da:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047de:	65 78 70             	gs js  804851 <__rodata_start+0x1a1>
+  8047e1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8047e6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8047e9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8047ed:	20 66 69             	and    %ah,0x69(%rsi)
+  8047f0:	6c                   	insb   (%dx),%es:(%rdi)
+  8047f1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8047f5:	20 66 72             	and    %ah,0x72(%rsi)
+  8047f8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8047fd:	61                   	(bad)
+  8047fe:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804801:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804802:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804803:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804807:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80480a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80480b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80480c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80480f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804810:	79 20                	jns    804832 <__rodata_start+0x182>
+  804812:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804819:	72 65                	jb     804880 <__rodata_start+0x1d0>
+  80481b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80481e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804820:	00 66 69             	add    %ah,0x69(%rsi)
+  804823:	6c                   	insb   (%dx),%es:(%rdi)
+  804824:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804828:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80482b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80482c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80482f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804830:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804831:	74 20                	je     804853 <__rodata_start+0x1a3>
+  804833:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804835:	75 6e                	jne    8048a5 <__rodata_start+0x1f5>
+  804837:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  80483b:	76 61                	jbe    80489e <__rodata_start+0x1ee>
+  80483d:	6c                   	insb   (%dx),%es:(%rdi)
+  80483e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804845:	00 
+  804846:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80484d:	72 65                	jb     8048b4 <__rodata_start+0x204>
+  80484f:	61                   	(bad)
+  804850:	64 79 20             	fs jns 804873 <__rodata_start+0x1c3>
+  804853:	65 78 69             	gs js  8048bf <__rodata_start+0x20f>
+  804856:	73 74                	jae    8048cc <__rodata_start+0x21c>
+  804858:	73 00                	jae    80485a <__rodata_start+0x1aa>
+  80485a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80485b:	70 65                	jo     8048c2 <__rodata_start+0x212>
+  80485d:	72 61                	jb     8048c0 <__rodata_start+0x210>
+  80485f:	74 69                	je     8048ca <__rodata_start+0x21a>
+  804861:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804862:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804863:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804866:	74 20                	je     804888 <__rodata_start+0x1d8>
+  804868:	73 75                	jae    8048df <__rodata_start+0x22f>
+  80486a:	70 70                	jo     8048dc <__rodata_start+0x22c>
+  80486c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80486d:	72 74                	jb     8048e3 <__rodata_start+0x233>
+  80486f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804875:	20 61 67             	and    %ah,0x67(%rcx)
+  804878:	61                   	(bad)
+  804879:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804880:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804884:	74 00                	je     804886 <__rodata_start+0x1d6>
+  804886:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80488d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804890:	20 75 73             	and    %dh,0x73(%rbp)
+  804893:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804897:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80489e:	00 
+  80489f:	90                   	nop
+  8048a0:	c2 03 80             	ret    $0x8003
+  8048a3:	00 00                	add    %al,(%rax)
+  8048a5:	00 00                	add    %al,(%rax)
+  8048a7:	00 03                	add    %al,(%rbx)
+  8048a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048af:	00 f3                	add    %dh,%bl
+  8048b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8048b7:	00 03                	add    %al,(%rbx)
+  8048b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048bf:	00 03                	add    %al,(%rbx)
+  8048c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048c7:	00 03                	add    %al,(%rbx)
+  8048c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048cf:	00 03                	add    %al,(%rbx)
+  8048d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048d7:	00 e1                	add    %ah,%cl
+  8048d9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048df:	00 03                	add    %al,(%rbx)
+  8048e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048e7:	00 03                	add    %al,(%rbx)
+  8048e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048ef:	00 d5                	add    %dl,%ch
+  8048f1:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048f7:	00 4f 04             	add    %cl,0x4(%rdi)
+  8048fa:	80 00 00             	addb   $0x0,(%rax)
+  8048fd:	00 00                	add    %al,(%rax)
+  8048ff:	00 03                	add    %al,(%rbx)
+  804901:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804907:	00 d5                	add    %dl,%ch
+  804909:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80490f:	00 1b                	add    %bl,(%rbx)
+  804911:	04 80                	add    $0x80,%al
+  804913:	00 00                	add    %al,(%rax)
+  804915:	00 00                	add    %al,(%rax)
+  804917:	00 1b                	add    %bl,(%rbx)
+  804919:	04 80                	add    $0x80,%al
+  80491b:	00 00                	add    %al,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 1b                	add    %bl,(%rbx)
+  804921:	04 80                	add    $0x80,%al
+  804923:	00 00                	add    %al,(%rax)
+  804925:	00 00                	add    %al,(%rax)
+  804927:	00 1b                	add    %bl,(%rbx)
+  804929:	04 80                	add    $0x80,%al
+  80492b:	00 00                	add    %al,(%rax)
+  80492d:	00 00                	add    %al,(%rax)
+  80492f:	00 1b                	add    %bl,(%rbx)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 1b                	add    %bl,(%rbx)
+  804939:	04 80                	add    $0x80,%al
+  80493b:	00 00                	add    %al,(%rax)
+  80493d:	00 00                	add    %al,(%rax)
+  80493f:	00 1b                	add    %bl,(%rbx)
+  804941:	04 80                	add    $0x80,%al
+  804943:	00 00                	add    %al,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 1b                	add    %bl,(%rbx)
+  804949:	04 80                	add    $0x80,%al
+  80494b:	00 00                	add    %al,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 1b                	add    %bl,(%rbx)
+  804951:	04 80                	add    $0x80,%al
+  804953:	00 00                	add    %al,(%rax)
+  804955:	00 00                	add    %al,(%rax)
+  804957:	00 03                	add    %al,(%rbx)
+  804959:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80495f:	00 03                	add    %al,(%rbx)
+  804961:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804967:	00 03                	add    %al,(%rbx)
+  804969:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80496f:	00 03                	add    %al,(%rbx)
+  804971:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804977:	00 03                	add    %al,(%rbx)
+  804979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80497f:	00 03                	add    %al,(%rbx)
+  804981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804987:	00 03                	add    %al,(%rbx)
+  804989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80498f:	00 03                	add    %al,(%rbx)
+  804991:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804997:	00 03                	add    %al,(%rbx)
+  804999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80499f:	00 03                	add    %al,(%rbx)
+  8049a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049a7:	00 03                	add    %al,(%rbx)
+  8049a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049af:	00 03                	add    %al,(%rbx)
+  8049b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049b7:	00 03                	add    %al,(%rbx)
+  8049b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049bf:	00 03                	add    %al,(%rbx)
+  8049c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049c7:	00 03                	add    %al,(%rbx)
+  8049c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049cf:	00 03                	add    %al,(%rbx)
+  8049d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049d7:	00 03                	add    %al,(%rbx)
+  8049d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049df:	00 03                	add    %al,(%rbx)
+  8049e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049e7:	00 03                	add    %al,(%rbx)
+  8049e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ef:	00 03                	add    %al,(%rbx)
+  8049f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049f7:	00 03                	add    %al,(%rbx)
+  8049f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ff:	00 03                	add    %al,(%rbx)
+  804a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a07:	00 03                	add    %al,(%rbx)
+  804a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a0f:	00 03                	add    %al,(%rbx)
+  804a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a17:	00 03                	add    %al,(%rbx)
+  804a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a1f:	00 03                	add    %al,(%rbx)
+  804a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a27:	00 03                	add    %al,(%rbx)
+  804a29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a2f:	00 03                	add    %al,(%rbx)
+  804a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a37:	00 03                	add    %al,(%rbx)
+  804a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a3f:	00 03                	add    %al,(%rbx)
+  804a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a47:	00 26                	add    %ah,(%rsi)
+  804a49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804a4f:	00 03                	add    %al,(%rbx)
+  804a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a57:	00 03                	add    %al,(%rbx)
+  804a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a5f:	00 03                	add    %al,(%rbx)
+  804a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a67:	00 03                	add    %al,(%rbx)
+  804a69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a6f:	00 03                	add    %al,(%rbx)
+  804a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a77:	00 03                	add    %al,(%rbx)
+  804a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a7f:	00 03                	add    %al,(%rbx)
+  804a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a87:	00 03                	add    %al,(%rbx)
+  804a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a8f:	00 03                	add    %al,(%rbx)
+  804a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a97:	00 03                	add    %al,(%rbx)
+  804a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a9f:	00 72 04             	add    %dh,0x4(%rdx)
+  804aa2:	80 00 00             	addb   $0x0,(%rax)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 41 06             	add    %al,0x6(%rcx)
+  804aaa:	80 00 00             	addb   $0x0,(%rax)
+  804aad:	00 00                	add    %al,(%rax)
+  804aaf:	00 03                	add    %al,(%rbx)
+  804ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ab7:	00 03                	add    %al,(%rbx)
+  804ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804abf:	00 03                	add    %al,(%rbx)
+  804ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ac7:	00 03                	add    %al,(%rbx)
+  804ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804acf:	00 a1 04 80 00 00    	add    %ah,0x8004(%rcx)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 03                	add    %al,(%rbx)
+  804ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804adf:	00 03                	add    %al,(%rbx)
+  804ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ae7:	00 67 04             	add    %ah,0x4(%rdi)
+  804aea:	80 00 00             	addb   $0x0,(%rax)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 03                	add    %al,(%rbx)
+  804af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804af7:	00 03                	add    %al,(%rbx)
+  804af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aff:	00 e9                	add    %ch,%cl
+  804b01:	07                   	(bad)
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 b3 08 80 00 00    	add    %dh,0x8008(%rbx)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 03                	add    %al,(%rbx)
+  804b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b17:	00 03                	add    %al,(%rbx)
+  804b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b1f:	00 38                	add    %bh,(%rax)
+  804b21:	05 80 00 00 00       	add    $0x80,%eax
+  804b26:	00 00                	add    %al,(%rax)
+  804b28:	03 0a                	add    (%rdx),%ecx
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 15 07 80 00 00    	add    %dl,0x8007(%rip)        # 80cb3c <__ctors_end+0x7a5c>
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 03                	add    %al,(%rbx)
+  804b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b3f:	00 03                	add    %al,(%rbx)
+  804b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b47:	00 26                	add    %ah,(%rsi)
+  804b49:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804b4f:	00 03                	add    %al,(%rbx)
+  804b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b57:	00 cb                	add    %cl,%bl
+  804b59:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b60 <error_string>:
+	...
+  804b68:	15 47 80 00 00 00 00 00 27 47 80 00 00 00 00 00     .G......'G......
+  804b78:	37 47 80 00 00 00 00 00 49 47 80 00 00 00 00 00     7G......IG......
+  804b88:	57 47 80 00 00 00 00 00 6b 47 80 00 00 00 00 00     WG......kG......
+  804b98:	80 47 80 00 00 00 00 00 93 47 80 00 00 00 00 00     .G.......G......
+  804ba8:	a5 47 80 00 00 00 00 00 b9 47 80 00 00 00 00 00     .G.......G......
+  804bb8:	c9 47 80 00 00 00 00 00 dc 47 80 00 00 00 00 00     .G.......G......
+  804bc8:	f3 47 80 00 00 00 00 00 09 48 80 00 00 00 00 00     .G.......H......
+  804bd8:	21 48 80 00 00 00 00 00 39 48 80 00 00 00 00 00     !H......9H......
+  804be8:	46 48 80 00 00 00 00 00 18 4c 80 00 00 00 00 00     FH.......L......
+  804bf8:	5a 48 80 00 00 00 00 00 72 48 80 00 00 00 00 00     ZH......rH......
+  804c08:	7c 48 80 00 00 00 00 00 86 48 80 00 00 00 00 00     |H.......H......
+  804c18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c38:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c48:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c58:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c68:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c78:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804c88:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804c98:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804ca8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804cb8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804cc8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cd8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804ce8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804cf8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804d00 <devtab>:
+  804d00:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804d10:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804d80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804d90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804da0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804db0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804dc0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804dd0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804de0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804df0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804e00:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804e10:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e20:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e30:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
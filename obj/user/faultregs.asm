@@ -0,0 +1,9247 @@
+
+obj/user/faultregs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ba 0c 00 00       	call   800cdd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <check_regs>:
+
+static struct regs before, during, after;
+
+static void
+check_regs(struct regs *a, const char *an, struct regs *b, const char *bn,
+           const char *testname) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+  800036:	49 89 fc             	mov    %rdi,%r12
+  800039:	48 89 d3             	mov    %rdx,%rbx
+  80003c:	4d 89 c6             	mov    %r8,%r14
+    int mismatch = 0;
+
+    cprintf("%-6s %-8s %-8s\n", "", an, bn);
+  80003f:	48 89 f2             	mov    %rsi,%rdx
+  800042:	48 be 73 53 80 00 00 	movabs $0x805373,%rsi
+  800049:	00 00 00 
+  80004c:	48 bf 40 53 80 00 00 	movabs $0x805340,%rdi
+  800053:	00 00 00 
+  800056:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005b:	49 bd 03 0f 80 00 00 	movabs $0x800f03,%r13
+  800062:	00 00 00 
+  800065:	41 ff d5             	call   *%r13
+            cprintf("MISMATCH\n");                                                             \
+            mismatch = 1;                                                                      \
+        }                                                                                      \
+    } while (0)
+
+    CHECK(r14, regs.reg_r14);
+  800068:	48 8b 4b 08          	mov    0x8(%rbx),%rcx
+  80006c:	49 8b 54 24 08       	mov    0x8(%r12),%rdx
+  800071:	48 be 50 53 80 00 00 	movabs $0x805350,%rsi
+  800078:	00 00 00 
+  80007b:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800082:	00 00 00 
+  800085:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008a:	41 ff d5             	call   *%r13
+  80008d:	48 8b 43 08          	mov    0x8(%rbx),%rax
+  800091:	49 39 44 24 08       	cmp    %rax,0x8(%r12)
+  800096:	0f 84 48 06 00 00    	je     8006e4 <check_regs+0x6bf>
+  80009c:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8000a3:	00 00 00 
+  8000a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ab:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8000b2:	00 00 00 
+  8000b5:	ff d2                	call   *%rdx
+  8000b7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r13, regs.reg_r13);
+  8000bd:	48 8b 4b 10          	mov    0x10(%rbx),%rcx
+  8000c1:	49 8b 54 24 10       	mov    0x10(%r12),%rdx
+  8000c6:	48 be 74 53 80 00 00 	movabs $0x805374,%rsi
+  8000cd:	00 00 00 
+  8000d0:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8000d7:	00 00 00 
+  8000da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000df:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8000e6:	00 00 00 
+  8000e9:	41 ff d0             	call   *%r8
+  8000ec:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8000f0:	49 39 44 24 10       	cmp    %rax,0x10(%r12)
+  8000f5:	0f 84 06 06 00 00    	je     800701 <check_regs+0x6dc>
+  8000fb:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800102:	00 00 00 
+  800105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80010a:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800111:	00 00 00 
+  800114:	ff d2                	call   *%rdx
+  800116:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r12, regs.reg_r12);
+  80011c:	48 8b 4b 18          	mov    0x18(%rbx),%rcx
+  800120:	49 8b 54 24 18       	mov    0x18(%r12),%rdx
+  800125:	48 be 78 53 80 00 00 	movabs $0x805378,%rsi
+  80012c:	00 00 00 
+  80012f:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  800145:	00 00 00 
+  800148:	41 ff d0             	call   *%r8
+  80014b:	48 8b 43 18          	mov    0x18(%rbx),%rax
+  80014f:	49 39 44 24 18       	cmp    %rax,0x18(%r12)
+  800154:	0f 84 c7 05 00 00    	je     800721 <check_regs+0x6fc>
+  80015a:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800161:	00 00 00 
+  800164:	b8 00 00 00 00       	mov    $0x0,%eax
+  800169:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800170:	00 00 00 
+  800173:	ff d2                	call   *%rdx
+  800175:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r11, regs.reg_r11);
+  80017b:	48 8b 4b 20          	mov    0x20(%rbx),%rcx
+  80017f:	49 8b 54 24 20       	mov    0x20(%r12),%rdx
+  800184:	48 be 7c 53 80 00 00 	movabs $0x80537c,%rsi
+  80018b:	00 00 00 
+  80018e:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800195:	00 00 00 
+  800198:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019d:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8001a4:	00 00 00 
+  8001a7:	41 ff d0             	call   *%r8
+  8001aa:	48 8b 43 20          	mov    0x20(%rbx),%rax
+  8001ae:	49 39 44 24 20       	cmp    %rax,0x20(%r12)
+  8001b3:	0f 84 88 05 00 00    	je     800741 <check_regs+0x71c>
+  8001b9:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8001c0:	00 00 00 
+  8001c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c8:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8001cf:	00 00 00 
+  8001d2:	ff d2                	call   *%rdx
+  8001d4:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(r10, regs.reg_r10);
+  8001da:	48 8b 4b 28          	mov    0x28(%rbx),%rcx
+  8001de:	49 8b 54 24 28       	mov    0x28(%r12),%rdx
+  8001e3:	48 be 80 53 80 00 00 	movabs $0x805380,%rsi
+  8001ea:	00 00 00 
+  8001ed:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8001f4:	00 00 00 
+  8001f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fc:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  800203:	00 00 00 
+  800206:	41 ff d0             	call   *%r8
+  800209:	48 8b 43 28          	mov    0x28(%rbx),%rax
+  80020d:	49 39 44 24 28       	cmp    %rax,0x28(%r12)
+  800212:	0f 84 49 05 00 00    	je     800761 <check_regs+0x73c>
+  800218:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  80021f:	00 00 00 
+  800222:	b8 00 00 00 00       	mov    $0x0,%eax
+  800227:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  80022e:	00 00 00 
+  800231:	ff d2                	call   *%rdx
+  800233:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800239:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80023d:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  800242:	48 be 84 53 80 00 00 	movabs $0x805384,%rsi
+  800249:	00 00 00 
+  80024c:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800253:	00 00 00 
+  800256:	b8 00 00 00 00       	mov    $0x0,%eax
+  80025b:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  800262:	00 00 00 
+  800265:	41 ff d0             	call   *%r8
+  800268:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  80026c:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  800271:	0f 84 0a 05 00 00    	je     800781 <check_regs+0x75c>
+  800277:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  80027e:	00 00 00 
+  800281:	b8 00 00 00 00       	mov    $0x0,%eax
+  800286:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  80028d:	00 00 00 
+  800290:	ff d2                	call   *%rdx
+  800292:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  800298:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  80029c:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  8002a1:	48 be 88 53 80 00 00 	movabs $0x805388,%rsi
+  8002a8:	00 00 00 
+  8002ab:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8002b2:	00 00 00 
+  8002b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ba:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8002c1:	00 00 00 
+  8002c4:	41 ff d0             	call   *%r8
+  8002c7:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  8002cb:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  8002d0:	0f 84 cb 04 00 00    	je     8007a1 <check_regs+0x77c>
+  8002d6:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8002dd:	00 00 00 
+  8002e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e5:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8002ec:	00 00 00 
+  8002ef:	ff d2                	call   *%rdx
+  8002f1:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdi, regs.reg_rdi);
+  8002f7:	48 8b 4b 48          	mov    0x48(%rbx),%rcx
+  8002fb:	49 8b 54 24 48       	mov    0x48(%r12),%rdx
+  800300:	48 be 88 53 80 00 00 	movabs $0x805388,%rsi
+  800307:	00 00 00 
+  80030a:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800311:	00 00 00 
+  800314:	b8 00 00 00 00       	mov    $0x0,%eax
+  800319:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  800320:	00 00 00 
+  800323:	41 ff d0             	call   *%r8
+  800326:	48 8b 43 48          	mov    0x48(%rbx),%rax
+  80032a:	49 39 44 24 48       	cmp    %rax,0x48(%r12)
+  80032f:	0f 84 8c 04 00 00    	je     8007c1 <check_regs+0x79c>
+  800335:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  80033c:	00 00 00 
+  80033f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800344:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  80034b:	00 00 00 
+  80034e:	ff d2                	call   *%rdx
+  800350:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rsi, regs.reg_rsi);
+  800356:	48 8b 4b 40          	mov    0x40(%rbx),%rcx
+  80035a:	49 8b 54 24 40       	mov    0x40(%r12),%rdx
+  80035f:	48 be 84 53 80 00 00 	movabs $0x805384,%rsi
+  800366:	00 00 00 
+  800369:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800370:	00 00 00 
+  800373:	b8 00 00 00 00       	mov    $0x0,%eax
+  800378:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  80037f:	00 00 00 
+  800382:	41 ff d0             	call   *%r8
+  800385:	48 8b 43 40          	mov    0x40(%rbx),%rax
+  800389:	49 39 44 24 40       	cmp    %rax,0x40(%r12)
+  80038e:	0f 84 4d 04 00 00    	je     8007e1 <check_regs+0x7bc>
+  800394:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  80039b:	00 00 00 
+  80039e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a3:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8003aa:	00 00 00 
+  8003ad:	ff d2                	call   *%rdx
+  8003af:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbp, regs.reg_rbp);
+  8003b5:	48 8b 4b 50          	mov    0x50(%rbx),%rcx
+  8003b9:	49 8b 54 24 50       	mov    0x50(%r12),%rdx
+  8003be:	48 be 8c 53 80 00 00 	movabs $0x80538c,%rsi
+  8003c5:	00 00 00 
+  8003c8:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8003cf:	00 00 00 
+  8003d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d7:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8003de:	00 00 00 
+  8003e1:	41 ff d0             	call   *%r8
+  8003e4:	48 8b 43 50          	mov    0x50(%rbx),%rax
+  8003e8:	49 39 44 24 50       	cmp    %rax,0x50(%r12)
+  8003ed:	0f 84 0e 04 00 00    	je     800801 <check_regs+0x7dc>
+  8003f3:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8003fa:	00 00 00 
+  8003fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800402:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800409:	00 00 00 
+  80040c:	ff d2                	call   *%rdx
+  80040e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rbx, regs.reg_rbx);
+  800414:	48 8b 4b 68          	mov    0x68(%rbx),%rcx
+  800418:	49 8b 54 24 68       	mov    0x68(%r12),%rdx
+  80041d:	48 be 90 53 80 00 00 	movabs $0x805390,%rsi
+  800424:	00 00 00 
+  800427:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  80042e:	00 00 00 
+  800431:	b8 00 00 00 00       	mov    $0x0,%eax
+  800436:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  80043d:	00 00 00 
+  800440:	41 ff d0             	call   *%r8
+  800443:	48 8b 43 68          	mov    0x68(%rbx),%rax
+  800447:	49 39 44 24 68       	cmp    %rax,0x68(%r12)
+  80044c:	0f 84 cf 03 00 00    	je     800821 <check_regs+0x7fc>
+  800452:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800459:	00 00 00 
+  80045c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800461:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800468:	00 00 00 
+  80046b:	ff d2                	call   *%rdx
+  80046d:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rdx, regs.reg_rdx);
+  800473:	48 8b 4b 58          	mov    0x58(%rbx),%rcx
+  800477:	49 8b 54 24 58       	mov    0x58(%r12),%rdx
+  80047c:	48 be 94 53 80 00 00 	movabs $0x805394,%rsi
+  800483:	00 00 00 
+  800486:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  80048d:	00 00 00 
+  800490:	b8 00 00 00 00       	mov    $0x0,%eax
+  800495:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  80049c:	00 00 00 
+  80049f:	41 ff d0             	call   *%r8
+  8004a2:	48 8b 43 58          	mov    0x58(%rbx),%rax
+  8004a6:	49 39 44 24 58       	cmp    %rax,0x58(%r12)
+  8004ab:	0f 84 90 03 00 00    	je     800841 <check_regs+0x81c>
+  8004b1:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8004b8:	00 00 00 
+  8004bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c0:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8004c7:	00 00 00 
+  8004ca:	ff d2                	call   *%rdx
+  8004cc:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rcx, regs.reg_rcx);
+  8004d2:	48 8b 4b 60          	mov    0x60(%rbx),%rcx
+  8004d6:	49 8b 54 24 60       	mov    0x60(%r12),%rdx
+  8004db:	48 be 98 53 80 00 00 	movabs $0x805398,%rsi
+  8004e2:	00 00 00 
+  8004e5:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8004ec:	00 00 00 
+  8004ef:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004f4:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8004fb:	00 00 00 
+  8004fe:	41 ff d0             	call   *%r8
+  800501:	48 8b 43 60          	mov    0x60(%rbx),%rax
+  800505:	49 39 44 24 60       	cmp    %rax,0x60(%r12)
+  80050a:	0f 84 51 03 00 00    	je     800861 <check_regs+0x83c>
+  800510:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800517:	00 00 00 
+  80051a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80051f:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800526:	00 00 00 
+  800529:	ff d2                	call   *%rdx
+  80052b:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rax, regs.reg_rax);
+  800531:	48 8b 4b 70          	mov    0x70(%rbx),%rcx
+  800535:	49 8b 54 24 70       	mov    0x70(%r12),%rdx
+  80053a:	48 be 9c 53 80 00 00 	movabs $0x80539c,%rsi
+  800541:	00 00 00 
+  800544:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  80054b:	00 00 00 
+  80054e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800553:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  80055a:	00 00 00 
+  80055d:	41 ff d0             	call   *%r8
+  800560:	48 8b 43 70          	mov    0x70(%rbx),%rax
+  800564:	49 39 44 24 70       	cmp    %rax,0x70(%r12)
+  800569:	0f 84 12 03 00 00    	je     800881 <check_regs+0x85c>
+  80056f:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800585:	00 00 00 
+  800588:	ff d2                	call   *%rdx
+  80058a:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rip, rip);
+  800590:	48 8b 4b 78          	mov    0x78(%rbx),%rcx
+  800594:	49 8b 54 24 78       	mov    0x78(%r12),%rdx
+  800599:	48 be a0 53 80 00 00 	movabs $0x8053a0,%rsi
+  8005a0:	00 00 00 
+  8005a3:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8005aa:	00 00 00 
+  8005ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b2:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  8005b9:	00 00 00 
+  8005bc:	41 ff d0             	call   *%r8
+  8005bf:	48 8b 43 78          	mov    0x78(%rbx),%rax
+  8005c3:	49 39 44 24 78       	cmp    %rax,0x78(%r12)
+  8005c8:	0f 84 d3 02 00 00    	je     8008a1 <check_regs+0x87c>
+  8005ce:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8005d5:	00 00 00 
+  8005d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005dd:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8005e4:	00 00 00 
+  8005e7:	ff d2                	call   *%rdx
+  8005e9:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    CHECK(rflags, rflags);
+  8005ef:	48 8b 8b 80 00 00 00 	mov    0x80(%rbx),%rcx
+  8005f6:	49 8b 94 24 80 00 00 	mov    0x80(%r12),%rdx
+  8005fd:	00 
+  8005fe:	48 be a4 53 80 00 00 	movabs $0x8053a4,%rsi
+  800605:	00 00 00 
+  800608:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  80060f:	00 00 00 
+  800612:	b8 00 00 00 00       	mov    $0x0,%eax
+  800617:	49 b8 03 0f 80 00 00 	movabs $0x800f03,%r8
+  80061e:	00 00 00 
+  800621:	41 ff d0             	call   *%r8
+  800624:	48 8b 83 80 00 00 00 	mov    0x80(%rbx),%rax
+  80062b:	49 39 84 24 80 00 00 	cmp    %rax,0x80(%r12)
+  800632:	00 
+  800633:	0f 84 88 02 00 00    	je     8008c1 <check_regs+0x89c>
+  800639:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  800640:	00 00 00 
+  800643:	b8 00 00 00 00       	mov    $0x0,%eax
+  800648:	49 bd 03 0f 80 00 00 	movabs $0x800f03,%r13
+  80064f:	00 00 00 
+  800652:	41 ff d5             	call   *%r13
+    CHECK(rsp, rsp);
+  800655:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  80065c:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  800663:	00 
+  800664:	48 be ab 53 80 00 00 	movabs $0x8053ab,%rsi
+  80066b:	00 00 00 
+  80066e:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  800675:	00 00 00 
+  800678:	b8 00 00 00 00       	mov    $0x0,%eax
+  80067d:	41 ff d5             	call   *%r13
+  800680:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  800687:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  80068e:	00 
+  80068f:	0f 84 ea 02 00 00    	je     80097f <check_regs+0x95a>
+  800695:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  80069c:	00 00 00 
+  80069f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a4:	48 bb 03 0f 80 00 00 	movabs $0x800f03,%rbx
+  8006ab:	00 00 00 
+  8006ae:	ff d3                	call   *%rbx
+
+#undef CHECK
+
+    cprintf("Registers %s ", testname);
+  8006b0:	4c 89 f6             	mov    %r14,%rsi
+  8006b3:	48 bf af 53 80 00 00 	movabs $0x8053af,%rdi
+  8006ba:	00 00 00 
+  8006bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c2:	ff d3                	call   *%rbx
+    if (!mismatch)
+        cprintf("OK\n");
+    else
+        cprintf("MISMATCH\n");
+  8006c4:	48 bf 6a 53 80 00 00 	movabs $0x80536a,%rdi
+  8006cb:	00 00 00 
+  8006ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d3:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8006da:	00 00 00 
+  8006dd:	ff d2                	call   *%rdx
+}
+  8006df:	e9 8c 02 00 00       	jmp    800970 <check_regs+0x94b>
+    CHECK(r14, regs.reg_r14);
+  8006e4:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8006eb:	00 00 00 
+  8006ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006f3:	41 ff d5             	call   *%r13
+    int mismatch = 0;
+  8006f6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8006fc:	e9 bc f9 ff ff       	jmp    8000bd <check_regs+0x98>
+    CHECK(r13, regs.reg_r13);
+  800701:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800708:	00 00 00 
+  80070b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800710:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800717:	00 00 00 
+  80071a:	ff d2                	call   *%rdx
+  80071c:	e9 fb f9 ff ff       	jmp    80011c <check_regs+0xf7>
+    CHECK(r12, regs.reg_r12);
+  800721:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800728:	00 00 00 
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800730:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800737:	00 00 00 
+  80073a:	ff d2                	call   *%rdx
+  80073c:	e9 3a fa ff ff       	jmp    80017b <check_regs+0x156>
+    CHECK(r11, regs.reg_r11);
+  800741:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800748:	00 00 00 
+  80074b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800750:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800757:	00 00 00 
+  80075a:	ff d2                	call   *%rdx
+  80075c:	e9 79 fa ff ff       	jmp    8001da <check_regs+0x1b5>
+    CHECK(r10, regs.reg_r10);
+  800761:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800768:	00 00 00 
+  80076b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800770:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800777:	00 00 00 
+  80077a:	ff d2                	call   *%rdx
+  80077c:	e9 b8 fa ff ff       	jmp    800239 <check_regs+0x214>
+    CHECK(rsi, regs.reg_rsi);
+  800781:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800788:	00 00 00 
+  80078b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800790:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800797:	00 00 00 
+  80079a:	ff d2                	call   *%rdx
+  80079c:	e9 f7 fa ff ff       	jmp    800298 <check_regs+0x273>
+    CHECK(rdi, regs.reg_rdi);
+  8007a1:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8007a8:	00 00 00 
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8007b7:	00 00 00 
+  8007ba:	ff d2                	call   *%rdx
+  8007bc:	e9 36 fb ff ff       	jmp    8002f7 <check_regs+0x2d2>
+    CHECK(rdi, regs.reg_rdi);
+  8007c1:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8007c8:	00 00 00 
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8007d7:	00 00 00 
+  8007da:	ff d2                	call   *%rdx
+  8007dc:	e9 75 fb ff ff       	jmp    800356 <check_regs+0x331>
+    CHECK(rsi, regs.reg_rsi);
+  8007e1:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8007e8:	00 00 00 
+  8007eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007f0:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8007f7:	00 00 00 
+  8007fa:	ff d2                	call   *%rdx
+  8007fc:	e9 b4 fb ff ff       	jmp    8003b5 <check_regs+0x390>
+    CHECK(rbp, regs.reg_rbp);
+  800801:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800808:	00 00 00 
+  80080b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800810:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800817:	00 00 00 
+  80081a:	ff d2                	call   *%rdx
+  80081c:	e9 f3 fb ff ff       	jmp    800414 <check_regs+0x3ef>
+    CHECK(rbx, regs.reg_rbx);
+  800821:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800828:	00 00 00 
+  80082b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800830:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800837:	00 00 00 
+  80083a:	ff d2                	call   *%rdx
+  80083c:	e9 32 fc ff ff       	jmp    800473 <check_regs+0x44e>
+    CHECK(rdx, regs.reg_rdx);
+  800841:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800848:	00 00 00 
+  80084b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800850:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800857:	00 00 00 
+  80085a:	ff d2                	call   *%rdx
+  80085c:	e9 71 fc ff ff       	jmp    8004d2 <check_regs+0x4ad>
+    CHECK(rcx, regs.reg_rcx);
+  800861:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800868:	00 00 00 
+  80086b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800870:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800877:	00 00 00 
+  80087a:	ff d2                	call   *%rdx
+  80087c:	e9 b0 fc ff ff       	jmp    800531 <check_regs+0x50c>
+    CHECK(rax, regs.reg_rax);
+  800881:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800888:	00 00 00 
+  80088b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800890:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800897:	00 00 00 
+  80089a:	ff d2                	call   *%rdx
+  80089c:	e9 ef fc ff ff       	jmp    800590 <check_regs+0x56b>
+    CHECK(rip, rip);
+  8008a1:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8008a8:	00 00 00 
+  8008ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b0:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  8008b7:	00 00 00 
+  8008ba:	ff d2                	call   *%rdx
+  8008bc:	e9 2e fd ff ff       	jmp    8005ef <check_regs+0x5ca>
+    CHECK(rflags, rflags);
+  8008c1:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  8008c8:	00 00 00 
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 bf 03 0f 80 00 00 	movabs $0x800f03,%r15
+  8008d7:	00 00 00 
+  8008da:	41 ff d7             	call   *%r15
+    CHECK(rsp, rsp);
+  8008dd:	48 8b 8b 88 00 00 00 	mov    0x88(%rbx),%rcx
+  8008e4:	49 8b 94 24 88 00 00 	mov    0x88(%r12),%rdx
+  8008eb:	00 
+  8008ec:	48 be ab 53 80 00 00 	movabs $0x8053ab,%rsi
+  8008f3:	00 00 00 
+  8008f6:	48 bf 54 53 80 00 00 	movabs $0x805354,%rdi
+  8008fd:	00 00 00 
+  800900:	b8 00 00 00 00       	mov    $0x0,%eax
+  800905:	41 ff d7             	call   *%r15
+  800908:	48 8b 83 88 00 00 00 	mov    0x88(%rbx),%rax
+  80090f:	49 39 84 24 88 00 00 	cmp    %rax,0x88(%r12)
+  800916:	00 
+  800917:	0f 85 78 fd ff ff    	jne    800695 <check_regs+0x670>
+  80091d:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800924:	00 00 00 
+  800927:	b8 00 00 00 00       	mov    $0x0,%eax
+  80092c:	48 bb 03 0f 80 00 00 	movabs $0x800f03,%rbx
+  800933:	00 00 00 
+  800936:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  800938:	4c 89 f6             	mov    %r14,%rsi
+  80093b:	48 bf af 53 80 00 00 	movabs $0x8053af,%rdi
+  800942:	00 00 00 
+  800945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80094a:	ff d3                	call   *%rbx
+    if (!mismatch)
+  80094c:	45 85 ed             	test   %r13d,%r13d
+  80094f:	0f 85 6f fd ff ff    	jne    8006c4 <check_regs+0x69f>
+        cprintf("OK\n");
+  800955:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  80095c:	00 00 00 
+  80095f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800964:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  80096b:	00 00 00 
+  80096e:	ff d2                	call   *%rdx
+}
+  800970:	48 83 c4 08          	add    $0x8,%rsp
+  800974:	5b                   	pop    %rbx
+  800975:	41 5c                	pop    %r12
+  800977:	41 5d                	pop    %r13
+  800979:	41 5e                	pop    %r14
+  80097b:	41 5f                	pop    %r15
+  80097d:	5d                   	pop    %rbp
+  80097e:	c3                   	ret
+    CHECK(rsp, rsp);
+  80097f:	48 bf 66 53 80 00 00 	movabs $0x805366,%rdi
+  800986:	00 00 00 
+  800989:	b8 00 00 00 00       	mov    $0x0,%eax
+  80098e:	48 bb 03 0f 80 00 00 	movabs $0x800f03,%rbx
+  800995:	00 00 00 
+  800998:	ff d3                	call   *%rbx
+    cprintf("Registers %s ", testname);
+  80099a:	4c 89 f6             	mov    %r14,%rsi
+  80099d:	48 bf af 53 80 00 00 	movabs $0x8053af,%rdi
+  8009a4:	00 00 00 
+  8009a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009ac:	ff d3                	call   *%rbx
+    if (!mismatch)
+  8009ae:	e9 11 fd ff ff       	jmp    8006c4 <check_regs+0x69f>
+
+00000000008009b3 <pgfault>:
+
+static bool
+pgfault(struct UTrapframe *utf) {
+  8009b3:	55                   	push   %rbp
+  8009b4:	48 89 e5             	mov    %rsp,%rbp
+    int r;
+
+    if (utf->utf_fault_va != (uint64_t)UTEMP)
+  8009b7:	48 8b 0f             	mov    (%rdi),%rcx
+  8009ba:	48 81 f9 00 00 40 00 	cmp    $0x400000,%rcx
+  8009c1:	0f 85 13 01 00 00    	jne    800ada <pgfault+0x127>
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+              (unsigned long)utf->utf_fault_va, (unsigned long)utf->utf_rip);
+
+    /* Check registers in UTrapframe */
+    during.regs = utf->utf_regs;
+  8009c7:	48 be a0 00 81 00 00 	movabs $0x8100a0,%rsi
+  8009ce:	00 00 00 
+  8009d1:	48 8b 57 10          	mov    0x10(%rdi),%rdx
+  8009d5:	48 89 16             	mov    %rdx,(%rsi)
+  8009d8:	48 8b 57 18          	mov    0x18(%rdi),%rdx
+  8009dc:	48 89 56 08          	mov    %rdx,0x8(%rsi)
+  8009e0:	48 8b 57 20          	mov    0x20(%rdi),%rdx
+  8009e4:	48 89 56 10          	mov    %rdx,0x10(%rsi)
+  8009e8:	48 8b 57 28          	mov    0x28(%rdi),%rdx
+  8009ec:	48 89 56 18          	mov    %rdx,0x18(%rsi)
+  8009f0:	48 8b 57 30          	mov    0x30(%rdi),%rdx
+  8009f4:	48 89 56 20          	mov    %rdx,0x20(%rsi)
+  8009f8:	48 8b 57 38          	mov    0x38(%rdi),%rdx
+  8009fc:	48 89 56 28          	mov    %rdx,0x28(%rsi)
+  800a00:	48 8b 57 40          	mov    0x40(%rdi),%rdx
+  800a04:	48 89 56 30          	mov    %rdx,0x30(%rsi)
+  800a08:	48 8b 57 48          	mov    0x48(%rdi),%rdx
+  800a0c:	48 89 56 38          	mov    %rdx,0x38(%rsi)
+  800a10:	48 8b 57 50          	mov    0x50(%rdi),%rdx
+  800a14:	48 89 56 40          	mov    %rdx,0x40(%rsi)
+  800a18:	48 8b 57 58          	mov    0x58(%rdi),%rdx
+  800a1c:	48 89 56 48          	mov    %rdx,0x48(%rsi)
+  800a20:	48 8b 57 60          	mov    0x60(%rdi),%rdx
+  800a24:	48 89 56 50          	mov    %rdx,0x50(%rsi)
+  800a28:	48 8b 57 68          	mov    0x68(%rdi),%rdx
+  800a2c:	48 89 56 58          	mov    %rdx,0x58(%rsi)
+  800a30:	48 8b 57 70          	mov    0x70(%rdi),%rdx
+  800a34:	48 89 56 60          	mov    %rdx,0x60(%rsi)
+  800a38:	48 8b 57 78          	mov    0x78(%rdi),%rdx
+  800a3c:	48 89 56 68          	mov    %rdx,0x68(%rsi)
+  800a40:	48 8b 97 80 00 00 00 	mov    0x80(%rdi),%rdx
+  800a47:	48 89 56 70          	mov    %rdx,0x70(%rsi)
+    during.rip = utf->utf_rip;
+  800a4b:	48 8b 97 88 00 00 00 	mov    0x88(%rdi),%rdx
+  800a52:	48 89 56 78          	mov    %rdx,0x78(%rsi)
+    during.rflags = utf->utf_rflags & 0xfff;
+  800a56:	48 8b 97 90 00 00 00 	mov    0x90(%rdi),%rdx
+  800a5d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  800a63:	48 89 96 80 00 00 00 	mov    %rdx,0x80(%rsi)
+    during.rsp = utf->utf_rsp;
+  800a6a:	48 8b 87 98 00 00 00 	mov    0x98(%rdi),%rax
+  800a71:	48 89 86 88 00 00 00 	mov    %rax,0x88(%rsi)
+    check_regs(&before, "before", &during, "during", "in UTrapframe");
+  800a78:	49 b8 ce 53 80 00 00 	movabs $0x8053ce,%r8
+  800a7f:	00 00 00 
+  800a82:	48 b9 dc 53 80 00 00 	movabs $0x8053dc,%rcx
+  800a89:	00 00 00 
+  800a8c:	48 89 f2             	mov    %rsi,%rdx
+  800a8f:	48 be e3 53 80 00 00 	movabs $0x8053e3,%rsi
+  800a96:	00 00 00 
+  800a99:	48 bf 40 01 81 00 00 	movabs $0x810140,%rdi
+  800aa0:	00 00 00 
+  800aa3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+    ;
+
+    /* Map UTEMP so the write succeeds */
+    if ((r = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW)) < 0)
+  800aaf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800ab4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800ab9:	be 00 00 40 00       	mov    $0x400000,%esi
+  800abe:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ac3:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  800aca:	00 00 00 
+  800acd:	ff d0                	call   *%rax
+  800acf:	85 c0                	test   %eax,%eax
+  800ad1:	78 39                	js     800b0c <pgfault+0x159>
+        panic("sys_page_alloc: %i", r);
+    return 1;
+}
+  800ad3:	b8 01 00 00 00       	mov    $0x1,%eax
+  800ad8:	5d                   	pop    %rbp
+  800ad9:	c3                   	ret
+        panic("pgfault expected at UTEMP, got 0x%08lx (rip %08lx)",
+  800ada:	4c 8b 87 88 00 00 00 	mov    0x88(%rdi),%r8
+  800ae1:	48 ba 18 54 80 00 00 	movabs $0x805418,%rdx
+  800ae8:	00 00 00 
+  800aeb:	be 62 00 00 00       	mov    $0x62,%esi
+  800af0:	48 bf bd 53 80 00 00 	movabs $0x8053bd,%rdi
+  800af7:	00 00 00 
+  800afa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aff:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  800b06:	00 00 00 
+  800b09:	41 ff d1             	call   *%r9
+        panic("sys_page_alloc: %i", r);
+  800b0c:	89 c1                	mov    %eax,%ecx
+  800b0e:	48 ba ea 53 80 00 00 	movabs $0x8053ea,%rdx
+  800b15:	00 00 00 
+  800b18:	be 6f 00 00 00       	mov    $0x6f,%esi
+  800b1d:	48 bf bd 53 80 00 00 	movabs $0x8053bd,%rdi
+  800b24:	00 00 00 
+  800b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b2c:	49 b8 b3 0d 80 00 00 	movabs $0x800db3,%r8
+  800b33:	00 00 00 
+  800b36:	41 ff d0             	call   *%r8
+
+0000000000800b39 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800b39:	55                   	push   %rbp
+  800b3a:	48 89 e5             	mov    %rsp,%rbp
+    add_pgfault_handler(pgfault);
+  800b3d:	48 bf b3 09 80 00 00 	movabs $0x8009b3,%rdi
+  800b44:	00 00 00 
+  800b47:	48 b8 44 22 80 00 00 	movabs $0x802244,%rax
+  800b4e:	00 00 00 
+  800b51:	ff d0                	call   *%rax
+
+    __asm __volatile(
+  800b53:	48 b8 40 01 81 00 00 	movabs $0x810140,%rax
+  800b5a:	00 00 00 
+  800b5d:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  800b64:	00 00 00 
+  800b67:	50                   	push   %rax
+  800b68:	52                   	push   %rdx
+  800b69:	50                   	push   %rax
+  800b6a:	9c                   	pushf
+  800b6b:	58                   	pop    %rax
+  800b6c:	48 0d d4 08 00 00    	or     $0x8d4,%rax
+  800b72:	50                   	push   %rax
+  800b73:	9d                   	popf
+  800b74:	4c 8b 7c 24 10       	mov    0x10(%rsp),%r15
+  800b79:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800b80:	48 8d 04 25 cc 0b 80 	lea    0x800bcc,%rax
+  800b87:	00 
+  800b88:	49 89 47 78          	mov    %rax,0x78(%r15)
+  800b8c:	58                   	pop    %rax
+  800b8d:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800b91:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800b95:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800b99:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800b9d:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800ba1:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800ba5:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800ba9:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bad:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bb1:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800bb5:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800bb9:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800bbd:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800bc1:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800bc5:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800bcc:	c7 04 25 00 00 40 00 	movl   $0x2a,0x400000
+  800bd3:	2a 00 00 00 
+  800bd7:	4c 8b 3c 24          	mov    (%rsp),%r15
+  800bdb:	4d 89 77 08          	mov    %r14,0x8(%r15)
+  800bdf:	4d 89 6f 10          	mov    %r13,0x10(%r15)
+  800be3:	4d 89 67 18          	mov    %r12,0x18(%r15)
+  800be7:	4d 89 5f 20          	mov    %r11,0x20(%r15)
+  800beb:	4d 89 57 28          	mov    %r10,0x28(%r15)
+  800bef:	4d 89 4f 30          	mov    %r9,0x30(%r15)
+  800bf3:	4d 89 47 38          	mov    %r8,0x38(%r15)
+  800bf7:	49 89 77 40          	mov    %rsi,0x40(%r15)
+  800bfb:	49 89 7f 48          	mov    %rdi,0x48(%r15)
+  800bff:	49 89 6f 50          	mov    %rbp,0x50(%r15)
+  800c03:	49 89 57 58          	mov    %rdx,0x58(%r15)
+  800c07:	49 89 4f 60          	mov    %rcx,0x60(%r15)
+  800c0b:	49 89 5f 68          	mov    %rbx,0x68(%r15)
+  800c0f:	49 89 47 70          	mov    %rax,0x70(%r15)
+  800c13:	49 89 a7 88 00 00 00 	mov    %rsp,0x88(%r15)
+  800c1a:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c1f:	4d 8b 77 08          	mov    0x8(%r15),%r14
+  800c23:	4d 8b 6f 10          	mov    0x10(%r15),%r13
+  800c27:	4d 8b 67 18          	mov    0x18(%r15),%r12
+  800c2b:	4d 8b 5f 20          	mov    0x20(%r15),%r11
+  800c2f:	4d 8b 57 28          	mov    0x28(%r15),%r10
+  800c33:	4d 8b 4f 30          	mov    0x30(%r15),%r9
+  800c37:	4d 8b 47 38          	mov    0x38(%r15),%r8
+  800c3b:	49 8b 77 40          	mov    0x40(%r15),%rsi
+  800c3f:	49 8b 7f 48          	mov    0x48(%r15),%rdi
+  800c43:	49 8b 6f 50          	mov    0x50(%r15),%rbp
+  800c47:	49 8b 57 58          	mov    0x58(%r15),%rdx
+  800c4b:	49 8b 4f 60          	mov    0x60(%r15),%rcx
+  800c4f:	49 8b 5f 68          	mov    0x68(%r15),%rbx
+  800c53:	49 8b 47 70          	mov    0x70(%r15),%rax
+  800c57:	49 8b a7 88 00 00 00 	mov    0x88(%r15),%rsp
+  800c5e:	50                   	push   %rax
+  800c5f:	9c                   	pushf
+  800c60:	58                   	pop    %rax
+  800c61:	4c 8b 7c 24 08       	mov    0x8(%rsp),%r15
+  800c66:	49 89 87 80 00 00 00 	mov    %rax,0x80(%r15)
+  800c6d:	58                   	pop    %rax
+            : "memory", "cc");
+
+    /* Check UTEMP to roughly determine that EIP was restored
+     * correctly (of course, we probably wouldn't get this far if
+     * it weren't) */
+    if (*(int *)UTEMP != 42)
+  800c6e:	83 3c 25 00 00 40 00 	cmpl   $0x2a,0x400000
+  800c75:	2a 
+  800c76:	75 48                	jne    800cc0 <umain+0x187>
+        cprintf("RIP after page-fault MISMATCH\n");
+    after.rip = before.rip;
+  800c78:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  800c7f:	00 00 00 
+  800c82:	48 bf 40 01 81 00 00 	movabs $0x810140,%rdi
+  800c89:	00 00 00 
+  800c8c:	48 8b 47 78          	mov    0x78(%rdi),%rax
+  800c90:	48 89 42 78          	mov    %rax,0x78(%rdx)
+
+    check_regs(&before, "before", &after, "after", "after page-fault");
+  800c94:	49 b8 fd 53 80 00 00 	movabs $0x8053fd,%r8
+  800c9b:	00 00 00 
+  800c9e:	48 b9 0e 54 80 00 00 	movabs $0x80540e,%rcx
+  800ca5:	00 00 00 
+  800ca8:	48 be e3 53 80 00 00 	movabs $0x8053e3,%rsi
+  800caf:	00 00 00 
+  800cb2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800cb9:	00 00 00 
+  800cbc:	ff d0                	call   *%rax
+}
+  800cbe:	5d                   	pop    %rbp
+  800cbf:	c3                   	ret
+        cprintf("RIP after page-fault MISMATCH\n");
+  800cc0:	48 bf 50 54 80 00 00 	movabs $0x805450,%rdi
+  800cc7:	00 00 00 
+  800cca:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ccf:	48 ba 03 0f 80 00 00 	movabs $0x800f03,%rdx
+  800cd6:	00 00 00 
+  800cd9:	ff d2                	call   *%rdx
+  800cdb:	eb 9b                	jmp    800c78 <umain+0x13f>
+
+0000000000800cdd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800cdd:	55                   	push   %rbp
+  800cde:	48 89 e5             	mov    %rsp,%rbp
+  800ce1:	41 56                	push   %r14
+  800ce3:	41 55                	push   %r13
+  800ce5:	41 54                	push   %r12
+  800ce7:	53                   	push   %rbx
+  800ce8:	41 89 fd             	mov    %edi,%r13d
+  800ceb:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800cee:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800cf5:	00 00 00 
+  800cf8:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800cff:	00 00 00 
+  800d02:	48 39 c2             	cmp    %rax,%rdx
+  800d05:	73 17                	jae    800d1e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800d07:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800d0a:	49 89 c4             	mov    %rax,%r12
+  800d0d:	48 83 c3 08          	add    $0x8,%rbx
+  800d11:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d16:	ff 53 f8             	call   *-0x8(%rbx)
+  800d19:	4c 39 e3             	cmp    %r12,%rbx
+  800d1c:	72 ef                	jb     800d0d <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800d1e:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  800d25:	00 00 00 
+  800d28:	ff d0                	call   *%rax
+  800d2a:	89 c2                	mov    %eax,%edx
+  800d2c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800d32:	48 89 d0             	mov    %rdx,%rax
+  800d35:	48 c1 e0 04          	shl    $0x4,%rax
+  800d39:	48 29 d0             	sub    %rdx,%rax
+  800d3c:	48 c1 e0 05          	shl    $0x5,%rax
+  800d40:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800d47:	00 00 00 
+  800d4a:	48 01 d0             	add    %rdx,%rax
+  800d4d:	48 a3 d0 01 81 00 00 	movabs %rax,0x8101d0
+  800d54:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800d57:	45 85 ed             	test   %r13d,%r13d
+  800d5a:	7e 0d                	jle    800d69 <libmain+0x8c>
+  800d5c:	49 8b 06             	mov    (%r14),%rax
+  800d5f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800d66:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800d69:	4c 89 f6             	mov    %r14,%rsi
+  800d6c:	44 89 ef             	mov    %r13d,%edi
+  800d6f:	48 b8 39 0b 80 00 00 	movabs $0x800b39,%rax
+  800d76:	00 00 00 
+  800d79:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800d7b:	48 b8 90 0d 80 00 00 	movabs $0x800d90,%rax
+  800d82:	00 00 00 
+  800d85:	ff d0                	call   *%rax
+#endif
+}
+  800d87:	5b                   	pop    %rbx
+  800d88:	41 5c                	pop    %r12
+  800d8a:	41 5d                	pop    %r13
+  800d8c:	41 5e                	pop    %r14
+  800d8e:	5d                   	pop    %rbp
+  800d8f:	c3                   	ret
+
+0000000000800d90 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800d90:	55                   	push   %rbp
+  800d91:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800d94:	48 b8 ad 26 80 00 00 	movabs $0x8026ad,%rax
+  800d9b:	00 00 00 
+  800d9e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800da0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800da5:	48 b8 97 1c 80 00 00 	movabs $0x801c97,%rax
+  800dac:	00 00 00 
+  800daf:	ff d0                	call   *%rax
+}
+  800db1:	5d                   	pop    %rbp
+  800db2:	c3                   	ret
+
+0000000000800db3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800db3:	55                   	push   %rbp
+  800db4:	48 89 e5             	mov    %rsp,%rbp
+  800db7:	41 56                	push   %r14
+  800db9:	41 55                	push   %r13
+  800dbb:	41 54                	push   %r12
+  800dbd:	53                   	push   %rbx
+  800dbe:	48 83 ec 50          	sub    $0x50,%rsp
+  800dc2:	49 89 fc             	mov    %rdi,%r12
+  800dc5:	41 89 f5             	mov    %esi,%r13d
+  800dc8:	48 89 d3             	mov    %rdx,%rbx
+  800dcb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800dcf:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800dd3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dd7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800dde:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800de2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800de6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800dea:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800dee:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800df5:	00 00 00 
+  800df8:	4c 8b 30             	mov    (%rax),%r14
+  800dfb:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  800e02:	00 00 00 
+  800e05:	ff d0                	call   *%rax
+  800e07:	89 c6                	mov    %eax,%esi
+  800e09:	45 89 e8             	mov    %r13d,%r8d
+  800e0c:	4c 89 e1             	mov    %r12,%rcx
+  800e0f:	4c 89 f2             	mov    %r14,%rdx
+  800e12:	48 bf 80 54 80 00 00 	movabs $0x805480,%rdi
+  800e19:	00 00 00 
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	49 bc 03 0f 80 00 00 	movabs $0x800f03,%r12
+  800e28:	00 00 00 
+  800e2b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800e2e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800e32:	48 89 df             	mov    %rbx,%rdi
+  800e35:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  800e3c:	00 00 00 
+  800e3f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800e41:	48 bf 72 53 80 00 00 	movabs $0x805372,%rdi
+  800e48:	00 00 00 
+  800e4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e50:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800e53:	cc                   	int3
+  800e54:	eb fd                	jmp    800e53 <_panic+0xa0>
+
+0000000000800e56 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800e56:	55                   	push   %rbp
+  800e57:	48 89 e5             	mov    %rsp,%rbp
+  800e5a:	53                   	push   %rbx
+  800e5b:	48 83 ec 08          	sub    $0x8,%rsp
+  800e5f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800e62:	8b 06                	mov    (%rsi),%eax
+  800e64:	8d 50 01             	lea    0x1(%rax),%edx
+  800e67:	89 16                	mov    %edx,(%rsi)
+  800e69:	48 98                	cltq
+  800e6b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800e70:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800e76:	74 0a                	je     800e82 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800e78:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800e7c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800e80:	c9                   	leave
+  800e81:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800e82:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800e86:	be ff 00 00 00       	mov    $0xff,%esi
+  800e8b:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  800e92:	00 00 00 
+  800e95:	ff d0                	call   *%rax
+        state->offset = 0;
+  800e97:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800e9d:	eb d9                	jmp    800e78 <putch+0x22>
+
+0000000000800e9f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800e9f:	55                   	push   %rbp
+  800ea0:	48 89 e5             	mov    %rsp,%rbp
+  800ea3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800eaa:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800ead:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800eb4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800eb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ebe:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800ec1:	48 89 f1             	mov    %rsi,%rcx
+  800ec4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800ecb:	48 bf 56 0e 80 00 00 	movabs $0x800e56,%rdi
+  800ed2:	00 00 00 
+  800ed5:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800ee1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800ee8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800eef:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  800ef6:	00 00 00 
+  800ef9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800efb:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800f01:	c9                   	leave
+  800f02:	c3                   	ret
+
+0000000000800f03 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800f03:	55                   	push   %rbp
+  800f04:	48 89 e5             	mov    %rsp,%rbp
+  800f07:	48 83 ec 50          	sub    $0x50,%rsp
+  800f0b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800f0f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800f13:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f17:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f1b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800f1f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800f26:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f2e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f32:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800f36:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800f3a:	48 b8 9f 0e 80 00 00 	movabs $0x800e9f,%rax
+  800f41:	00 00 00 
+  800f44:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800f46:	c9                   	leave
+  800f47:	c3                   	ret
+
+0000000000800f48 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800f48:	55                   	push   %rbp
+  800f49:	48 89 e5             	mov    %rsp,%rbp
+  800f4c:	41 57                	push   %r15
+  800f4e:	41 56                	push   %r14
+  800f50:	41 55                	push   %r13
+  800f52:	41 54                	push   %r12
+  800f54:	53                   	push   %rbx
+  800f55:	48 83 ec 18          	sub    $0x18,%rsp
+  800f59:	49 89 fc             	mov    %rdi,%r12
+  800f5c:	49 89 f5             	mov    %rsi,%r13
+  800f5f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800f63:	8b 45 10             	mov    0x10(%rbp),%eax
+  800f66:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800f69:	41 89 cf             	mov    %ecx,%r15d
+  800f6c:	4c 39 fa             	cmp    %r15,%rdx
+  800f6f:	73 5b                	jae    800fcc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800f71:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800f75:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800f79:	85 db                	test   %ebx,%ebx
+  800f7b:	7e 0e                	jle    800f8b <print_num+0x43>
+            putch(padc, put_arg);
+  800f7d:	4c 89 ee             	mov    %r13,%rsi
+  800f80:	44 89 f7             	mov    %r14d,%edi
+  800f83:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800f86:	83 eb 01             	sub    $0x1,%ebx
+  800f89:	75 f2                	jne    800f7d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800f8b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800f8f:	48 b9 b4 54 80 00 00 	movabs $0x8054b4,%rcx
+  800f96:	00 00 00 
+  800f99:	48 b8 a3 54 80 00 00 	movabs $0x8054a3,%rax
+  800fa0:	00 00 00 
+  800fa3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800fa7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fb0:	49 f7 f7             	div    %r15
+  800fb3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800fb7:	4c 89 ee             	mov    %r13,%rsi
+  800fba:	41 ff d4             	call   *%r12
+}
+  800fbd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fc1:	5b                   	pop    %rbx
+  800fc2:	41 5c                	pop    %r12
+  800fc4:	41 5d                	pop    %r13
+  800fc6:	41 5e                	pop    %r14
+  800fc8:	41 5f                	pop    %r15
+  800fca:	5d                   	pop    %rbp
+  800fcb:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800fcc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd5:	49 f7 f7             	div    %r15
+  800fd8:	48 83 ec 08          	sub    $0x8,%rsp
+  800fdc:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800fe0:	52                   	push   %rdx
+  800fe1:	45 0f be c9          	movsbl %r9b,%r9d
+  800fe5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800fe9:	48 89 c2             	mov    %rax,%rdx
+  800fec:	48 b8 48 0f 80 00 00 	movabs $0x800f48,%rax
+  800ff3:	00 00 00 
+  800ff6:	ff d0                	call   *%rax
+  800ff8:	48 83 c4 10          	add    $0x10,%rsp
+  800ffc:	eb 8d                	jmp    800f8b <print_num+0x43>
+
+0000000000800ffe <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800ffe:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  801002:	48 8b 06             	mov    (%rsi),%rax
+  801005:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  801009:	73 0a                	jae    801015 <sprintputch+0x17>
+        *state->start++ = ch;
+  80100b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80100f:	48 89 16             	mov    %rdx,(%rsi)
+  801012:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  801015:	c3                   	ret
+
+0000000000801016 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  801016:	55                   	push   %rbp
+  801017:	48 89 e5             	mov    %rsp,%rbp
+  80101a:	48 83 ec 50          	sub    $0x50,%rsp
+  80101e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801022:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801026:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80102a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801031:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801035:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801039:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80103d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  801041:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801045:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  80104c:	00 00 00 
+  80104f:	ff d0                	call   *%rax
+}
+  801051:	c9                   	leave
+  801052:	c3                   	ret
+
+0000000000801053 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  801053:	55                   	push   %rbp
+  801054:	48 89 e5             	mov    %rsp,%rbp
+  801057:	41 57                	push   %r15
+  801059:	41 56                	push   %r14
+  80105b:	41 55                	push   %r13
+  80105d:	41 54                	push   %r12
+  80105f:	53                   	push   %rbx
+  801060:	48 83 ec 38          	sub    $0x38,%rsp
+  801064:	49 89 fe             	mov    %rdi,%r14
+  801067:	49 89 f5             	mov    %rsi,%r13
+  80106a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80106d:	48 8b 01             	mov    (%rcx),%rax
+  801070:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  801074:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  801078:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80107c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  801080:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  801084:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  801088:	0f b6 3b             	movzbl (%rbx),%edi
+  80108b:	40 80 ff 25          	cmp    $0x25,%dil
+  80108f:	74 18                	je     8010a9 <vprintfmt+0x56>
+            if (!ch) return;
+  801091:	40 84 ff             	test   %dil,%dil
+  801094:	0f 84 b1 06 00 00    	je     80174b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80109a:	40 0f b6 ff          	movzbl %dil,%edi
+  80109e:	4c 89 ee             	mov    %r13,%rsi
+  8010a1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8010a4:	4c 89 e3             	mov    %r12,%rbx
+  8010a7:	eb db                	jmp    801084 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8010a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8010ae:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8010b2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8010b7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8010bd:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8010c4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8010c8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8010cd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8010d2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8010d5:	83 e8 23             	sub    $0x23,%eax
+  8010d8:	3c 57                	cmp    $0x57,%al
+  8010da:	0f 87 51 06 00 00    	ja     801731 <vprintfmt+0x6de>
+  8010e0:	0f b6 c0             	movzbl %al,%eax
+  8010e3:	48 b9 60 56 80 00 00 	movabs $0x805660,%rcx
+  8010ea:	00 00 00 
+  8010ed:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8010f0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8010f3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8010f7:	eb cf                	jmp    8010c8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8010f9:	49 89 dc             	mov    %rbx,%r12
+  8010fc:	be 01 00 00 00       	mov    $0x1,%esi
+  801101:	eb c5                	jmp    8010c8 <vprintfmt+0x75>
+            padc = ch;
+  801103:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  801107:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80110a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80110d:	eb b9                	jmp    8010c8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80110f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801112:	83 f8 2f             	cmp    $0x2f,%eax
+  801115:	77 24                	ja     80113b <vprintfmt+0xe8>
+  801117:	89 c1                	mov    %eax,%ecx
+  801119:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80111d:	83 c0 08             	add    $0x8,%eax
+  801120:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801123:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  801126:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  801129:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80112d:	79 99                	jns    8010c8 <vprintfmt+0x75>
+                width = precision;
+  80112f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  801133:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  801139:	eb 8d                	jmp    8010c8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80113b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80113f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  801143:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801147:	eb da                	jmp    801123 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  801149:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80114e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  801152:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  801158:	3c 39                	cmp    $0x39,%al
+  80115a:	77 1c                	ja     801178 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80115c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  801160:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  801164:	0f b6 c0             	movzbl %al,%eax
+  801167:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80116c:	0f b6 03             	movzbl (%rbx),%eax
+  80116f:	3c 39                	cmp    $0x39,%al
+  801171:	76 e9                	jbe    80115c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  801173:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  801176:	eb b1                	jmp    801129 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  801178:	49 89 dc             	mov    %rbx,%r12
+  80117b:	eb ac                	jmp    801129 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80117d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  801180:	85 c9                	test   %ecx,%ecx
+  801182:	b8 00 00 00 00       	mov    $0x0,%eax
+  801187:	0f 49 c1             	cmovns %ecx,%eax
+  80118a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80118d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  801190:	e9 33 ff ff ff       	jmp    8010c8 <vprintfmt+0x75>
+            lflag++;
+  801195:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  801198:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80119b:	e9 28 ff ff ff       	jmp    8010c8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8011a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8011a6:	77 19                	ja     8011c1 <vprintfmt+0x16e>
+  8011a8:	89 c2                	mov    %eax,%edx
+  8011aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011ae:	83 c0 08             	add    $0x8,%eax
+  8011b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011b4:	8b 3a                	mov    (%rdx),%edi
+  8011b6:	4c 89 ee             	mov    %r13,%rsi
+  8011b9:	41 ff d6             	call   *%r14
+            break;
+  8011bc:	e9 c3 fe ff ff       	jmp    801084 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8011c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011cd:	eb e5                	jmp    8011b4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8011cf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011d2:	83 f8 2f             	cmp    $0x2f,%eax
+  8011d5:	77 5a                	ja     801231 <vprintfmt+0x1de>
+  8011d7:	89 c2                	mov    %eax,%edx
+  8011d9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011dd:	83 c0 08             	add    $0x8,%eax
+  8011e0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8011e3:	8b 02                	mov    (%rdx),%eax
+  8011e5:	89 c1                	mov    %eax,%ecx
+  8011e7:	f7 d9                	neg    %ecx
+  8011e9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8011ec:	83 f9 16             	cmp    $0x16,%ecx
+  8011ef:	7f 4e                	jg     80123f <vprintfmt+0x1ec>
+  8011f1:	48 63 c1             	movslq %ecx,%rax
+  8011f4:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  8011fb:	00 00 00 
+  8011fe:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  801202:	48 85 c0             	test   %rax,%rax
+  801205:	74 38                	je     80123f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  801207:	48 89 c1             	mov    %rax,%rcx
+  80120a:	48 ba aa 5a 80 00 00 	movabs $0x805aaa,%rdx
+  801211:	00 00 00 
+  801214:	4c 89 ee             	mov    %r13,%rsi
+  801217:	4c 89 f7             	mov    %r14,%rdi
+  80121a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121f:	49 b8 16 10 80 00 00 	movabs $0x801016,%r8
+  801226:	00 00 00 
+  801229:	41 ff d0             	call   *%r8
+  80122c:	e9 53 fe ff ff       	jmp    801084 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801231:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801235:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801239:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80123d:	eb a4                	jmp    8011e3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80123f:	48 ba cc 54 80 00 00 	movabs $0x8054cc,%rdx
+  801246:	00 00 00 
+  801249:	4c 89 ee             	mov    %r13,%rsi
+  80124c:	4c 89 f7             	mov    %r14,%rdi
+  80124f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801254:	49 b8 16 10 80 00 00 	movabs $0x801016,%r8
+  80125b:	00 00 00 
+  80125e:	41 ff d0             	call   *%r8
+  801261:	e9 1e fe ff ff       	jmp    801084 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  801266:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801269:	83 f8 2f             	cmp    $0x2f,%eax
+  80126c:	77 6c                	ja     8012da <vprintfmt+0x287>
+  80126e:	89 c2                	mov    %eax,%edx
+  801270:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801274:	83 c0 08             	add    $0x8,%eax
+  801277:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80127a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80127d:	48 85 d2             	test   %rdx,%rdx
+  801280:	48 b8 c5 54 80 00 00 	movabs $0x8054c5,%rax
+  801287:	00 00 00 
+  80128a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80128e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801292:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  801296:	7e 06                	jle    80129e <vprintfmt+0x24b>
+  801298:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80129c:	75 4a                	jne    8012e8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80129e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8012a2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8012a6:	0f b6 00             	movzbl (%rax),%eax
+  8012a9:	84 c0                	test   %al,%al
+  8012ab:	0f 85 9a 00 00 00    	jne    80134b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8012b1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8012b4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8012b8:	85 c0                	test   %eax,%eax
+  8012ba:	0f 8e c4 fd ff ff    	jle    801084 <vprintfmt+0x31>
+  8012c0:	4c 89 ee             	mov    %r13,%rsi
+  8012c3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8012c8:	41 ff d6             	call   *%r14
+  8012cb:	41 83 ec 01          	sub    $0x1,%r12d
+  8012cf:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8012d3:	75 eb                	jne    8012c0 <vprintfmt+0x26d>
+  8012d5:	e9 aa fd ff ff       	jmp    801084 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8012da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e6:	eb 92                	jmp    80127a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8012e8:	49 63 f7             	movslq %r15d,%rsi
+  8012eb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8012ef:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  8012f6:	00 00 00 
+  8012f9:	ff d0                	call   *%rax
+  8012fb:	48 89 c2             	mov    %rax,%rdx
+  8012fe:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801301:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  801303:	8d 70 ff             	lea    -0x1(%rax),%esi
+  801306:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  801309:	85 c0                	test   %eax,%eax
+  80130b:	7e 91                	jle    80129e <vprintfmt+0x24b>
+  80130d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  801312:	4c 89 ee             	mov    %r13,%rsi
+  801315:	44 89 e7             	mov    %r12d,%edi
+  801318:	41 ff d6             	call   *%r14
+  80131b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80131f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801322:	83 f8 ff             	cmp    $0xffffffff,%eax
+  801325:	75 eb                	jne    801312 <vprintfmt+0x2bf>
+  801327:	e9 72 ff ff ff       	jmp    80129e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80132c:	0f b6 f8             	movzbl %al,%edi
+  80132f:	4c 89 ee             	mov    %r13,%rsi
+  801332:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801335:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  801339:	49 83 c4 01          	add    $0x1,%r12
+  80133d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801343:	84 c0                	test   %al,%al
+  801345:	0f 84 66 ff ff ff    	je     8012b1 <vprintfmt+0x25e>
+  80134b:	45 85 ff             	test   %r15d,%r15d
+  80134e:	78 0a                	js     80135a <vprintfmt+0x307>
+  801350:	41 83 ef 01          	sub    $0x1,%r15d
+  801354:	0f 88 57 ff ff ff    	js     8012b1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80135a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80135e:	74 cc                	je     80132c <vprintfmt+0x2d9>
+  801360:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801363:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  801368:	80 fa 5e             	cmp    $0x5e,%dl
+  80136b:	77 c2                	ja     80132f <vprintfmt+0x2dc>
+  80136d:	eb bd                	jmp    80132c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80136f:	40 84 f6             	test   %sil,%sil
+  801372:	75 26                	jne    80139a <vprintfmt+0x347>
+    switch (lflag) {
+  801374:	85 d2                	test   %edx,%edx
+  801376:	74 59                	je     8013d1 <vprintfmt+0x37e>
+  801378:	83 fa 01             	cmp    $0x1,%edx
+  80137b:	74 7b                	je     8013f8 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80137d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801380:	83 f8 2f             	cmp    $0x2f,%eax
+  801383:	0f 87 96 00 00 00    	ja     80141f <vprintfmt+0x3cc>
+  801389:	89 c2                	mov    %eax,%edx
+  80138b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80138f:	83 c0 08             	add    $0x8,%eax
+  801392:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801395:	4c 8b 22             	mov    (%rdx),%r12
+  801398:	eb 17                	jmp    8013b1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80139a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80139d:	83 f8 2f             	cmp    $0x2f,%eax
+  8013a0:	77 21                	ja     8013c3 <vprintfmt+0x370>
+  8013a2:	89 c2                	mov    %eax,%edx
+  8013a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013a8:	83 c0 08             	add    $0x8,%eax
+  8013ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013ae:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8013b1:	4d 85 e4             	test   %r12,%r12
+  8013b4:	78 7a                	js     801430 <vprintfmt+0x3dd>
+            num = i;
+  8013b6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8013b9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8013be:	e9 50 02 00 00       	jmp    801613 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8013c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013cf:	eb dd                	jmp    8013ae <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8013d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8013d7:	77 11                	ja     8013ea <vprintfmt+0x397>
+  8013d9:	89 c2                	mov    %eax,%edx
+  8013db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013df:	83 c0 08             	add    $0x8,%eax
+  8013e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013e5:	4c 63 22             	movslq (%rdx),%r12
+  8013e8:	eb c7                	jmp    8013b1 <vprintfmt+0x35e>
+  8013ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013f6:	eb ed                	jmp    8013e5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8013f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8013fe:	77 11                	ja     801411 <vprintfmt+0x3be>
+  801400:	89 c2                	mov    %eax,%edx
+  801402:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801406:	83 c0 08             	add    $0x8,%eax
+  801409:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80140c:	4c 8b 22             	mov    (%rdx),%r12
+  80140f:	eb a0                	jmp    8013b1 <vprintfmt+0x35e>
+  801411:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801415:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801419:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80141d:	eb ed                	jmp    80140c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80141f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801423:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801427:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80142b:	e9 65 ff ff ff       	jmp    801395 <vprintfmt+0x342>
+                putch('-', put_arg);
+  801430:	4c 89 ee             	mov    %r13,%rsi
+  801433:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  801438:	41 ff d6             	call   *%r14
+                i = -i;
+  80143b:	49 f7 dc             	neg    %r12
+  80143e:	e9 73 ff ff ff       	jmp    8013b6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801443:	40 84 f6             	test   %sil,%sil
+  801446:	75 32                	jne    80147a <vprintfmt+0x427>
+    switch (lflag) {
+  801448:	85 d2                	test   %edx,%edx
+  80144a:	74 5d                	je     8014a9 <vprintfmt+0x456>
+  80144c:	83 fa 01             	cmp    $0x1,%edx
+  80144f:	0f 84 82 00 00 00    	je     8014d7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801455:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801458:	83 f8 2f             	cmp    $0x2f,%eax
+  80145b:	0f 87 a5 00 00 00    	ja     801506 <vprintfmt+0x4b3>
+  801461:	89 c2                	mov    %eax,%edx
+  801463:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801467:	83 c0 08             	add    $0x8,%eax
+  80146a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80146d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801470:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801475:	e9 99 01 00 00       	jmp    801613 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80147a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80147d:	83 f8 2f             	cmp    $0x2f,%eax
+  801480:	77 19                	ja     80149b <vprintfmt+0x448>
+  801482:	89 c2                	mov    %eax,%edx
+  801484:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801488:	83 c0 08             	add    $0x8,%eax
+  80148b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80148e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801491:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801496:	e9 78 01 00 00       	jmp    801613 <vprintfmt+0x5c0>
+  80149b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80149f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014a7:	eb e5                	jmp    80148e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8014a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8014af:	77 18                	ja     8014c9 <vprintfmt+0x476>
+  8014b1:	89 c2                	mov    %eax,%edx
+  8014b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014b7:	83 c0 08             	add    $0x8,%eax
+  8014ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014bd:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8014bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8014c4:	e9 4a 01 00 00       	jmp    801613 <vprintfmt+0x5c0>
+  8014c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014d5:	eb e6                	jmp    8014bd <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8014d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014da:	83 f8 2f             	cmp    $0x2f,%eax
+  8014dd:	77 19                	ja     8014f8 <vprintfmt+0x4a5>
+  8014df:	89 c2                	mov    %eax,%edx
+  8014e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014e5:	83 c0 08             	add    $0x8,%eax
+  8014e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014eb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8014ee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8014f3:	e9 1b 01 00 00       	jmp    801613 <vprintfmt+0x5c0>
+  8014f8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014fc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801500:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801504:	eb e5                	jmp    8014eb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  801506:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80150a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80150e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801512:	e9 56 ff ff ff       	jmp    80146d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  801517:	40 84 f6             	test   %sil,%sil
+  80151a:	75 2e                	jne    80154a <vprintfmt+0x4f7>
+    switch (lflag) {
+  80151c:	85 d2                	test   %edx,%edx
+  80151e:	74 59                	je     801579 <vprintfmt+0x526>
+  801520:	83 fa 01             	cmp    $0x1,%edx
+  801523:	74 7f                	je     8015a4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  801525:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801528:	83 f8 2f             	cmp    $0x2f,%eax
+  80152b:	0f 87 9f 00 00 00    	ja     8015d0 <vprintfmt+0x57d>
+  801531:	89 c2                	mov    %eax,%edx
+  801533:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801537:	83 c0 08             	add    $0x8,%eax
+  80153a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80153d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801540:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801545:	e9 c9 00 00 00       	jmp    801613 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80154a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80154d:	83 f8 2f             	cmp    $0x2f,%eax
+  801550:	77 19                	ja     80156b <vprintfmt+0x518>
+  801552:	89 c2                	mov    %eax,%edx
+  801554:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801558:	83 c0 08             	add    $0x8,%eax
+  80155b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80155e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801561:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801566:	e9 a8 00 00 00       	jmp    801613 <vprintfmt+0x5c0>
+  80156b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80156f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801573:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801577:	eb e5                	jmp    80155e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  801579:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80157c:	83 f8 2f             	cmp    $0x2f,%eax
+  80157f:	77 15                	ja     801596 <vprintfmt+0x543>
+  801581:	89 c2                	mov    %eax,%edx
+  801583:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801587:	83 c0 08             	add    $0x8,%eax
+  80158a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80158d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80158f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801594:	eb 7d                	jmp    801613 <vprintfmt+0x5c0>
+  801596:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80159a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80159e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015a2:	eb e9                	jmp    80158d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8015a4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015a7:	83 f8 2f             	cmp    $0x2f,%eax
+  8015aa:	77 16                	ja     8015c2 <vprintfmt+0x56f>
+  8015ac:	89 c2                	mov    %eax,%edx
+  8015ae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8015b2:	83 c0 08             	add    $0x8,%eax
+  8015b5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8015b8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8015bb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8015c0:	eb 51                	jmp    801613 <vprintfmt+0x5c0>
+  8015c2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015c6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015ca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015ce:	eb e8                	jmp    8015b8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8015d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8015d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8015d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015dc:	e9 5c ff ff ff       	jmp    80153d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8015e1:	4c 89 ee             	mov    %r13,%rsi
+  8015e4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8015e9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8015ec:	4c 89 ee             	mov    %r13,%rsi
+  8015ef:	bf 78 00 00 00       	mov    $0x78,%edi
+  8015f4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8015f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8015fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8015fd:	77 47                	ja     801646 <vprintfmt+0x5f3>
+  8015ff:	89 c2                	mov    %eax,%edx
+  801601:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801605:	83 c0 08             	add    $0x8,%eax
+  801608:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80160b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80160e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801613:	48 83 ec 08          	sub    $0x8,%rsp
+  801617:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80161b:	0f 94 c0             	sete   %al
+  80161e:	0f b6 c0             	movzbl %al,%eax
+  801621:	50                   	push   %rax
+  801622:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801627:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80162b:	4c 89 ee             	mov    %r13,%rsi
+  80162e:	4c 89 f7             	mov    %r14,%rdi
+  801631:	48 b8 48 0f 80 00 00 	movabs $0x800f48,%rax
+  801638:	00 00 00 
+  80163b:	ff d0                	call   *%rax
+            break;
+  80163d:	48 83 c4 10          	add    $0x10,%rsp
+  801641:	e9 3e fa ff ff       	jmp    801084 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801646:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80164a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80164e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801652:	eb b7                	jmp    80160b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801654:	40 84 f6             	test   %sil,%sil
+  801657:	75 2b                	jne    801684 <vprintfmt+0x631>
+    switch (lflag) {
+  801659:	85 d2                	test   %edx,%edx
+  80165b:	74 56                	je     8016b3 <vprintfmt+0x660>
+  80165d:	83 fa 01             	cmp    $0x1,%edx
+  801660:	74 7f                	je     8016e1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801662:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801665:	83 f8 2f             	cmp    $0x2f,%eax
+  801668:	0f 87 a2 00 00 00    	ja     801710 <vprintfmt+0x6bd>
+  80166e:	89 c2                	mov    %eax,%edx
+  801670:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801674:	83 c0 08             	add    $0x8,%eax
+  801677:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80167a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80167d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801682:	eb 8f                	jmp    801613 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801684:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801687:	83 f8 2f             	cmp    $0x2f,%eax
+  80168a:	77 19                	ja     8016a5 <vprintfmt+0x652>
+  80168c:	89 c2                	mov    %eax,%edx
+  80168e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801692:	83 c0 08             	add    $0x8,%eax
+  801695:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801698:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80169b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8016a0:	e9 6e ff ff ff       	jmp    801613 <vprintfmt+0x5c0>
+  8016a5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016a9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016ad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016b1:	eb e5                	jmp    801698 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8016b3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016b6:	83 f8 2f             	cmp    $0x2f,%eax
+  8016b9:	77 18                	ja     8016d3 <vprintfmt+0x680>
+  8016bb:	89 c2                	mov    %eax,%edx
+  8016bd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016c1:	83 c0 08             	add    $0x8,%eax
+  8016c4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016c7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8016c9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8016ce:	e9 40 ff ff ff       	jmp    801613 <vprintfmt+0x5c0>
+  8016d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8016d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8016db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8016df:	eb e6                	jmp    8016c7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8016e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8016e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8016e7:	77 19                	ja     801702 <vprintfmt+0x6af>
+  8016e9:	89 c2                	mov    %eax,%edx
+  8016eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8016ef:	83 c0 08             	add    $0x8,%eax
+  8016f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8016f5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8016f8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8016fd:	e9 11 ff ff ff       	jmp    801613 <vprintfmt+0x5c0>
+  801702:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801706:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80170a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80170e:	eb e5                	jmp    8016f5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801710:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801714:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801718:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80171c:	e9 59 ff ff ff       	jmp    80167a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801721:	4c 89 ee             	mov    %r13,%rsi
+  801724:	bf 25 00 00 00       	mov    $0x25,%edi
+  801729:	41 ff d6             	call   *%r14
+            break;
+  80172c:	e9 53 f9 ff ff       	jmp    801084 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801731:	4c 89 ee             	mov    %r13,%rsi
+  801734:	bf 25 00 00 00       	mov    $0x25,%edi
+  801739:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80173c:	48 83 eb 01          	sub    $0x1,%rbx
+  801740:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801744:	75 f6                	jne    80173c <vprintfmt+0x6e9>
+  801746:	e9 39 f9 ff ff       	jmp    801084 <vprintfmt+0x31>
+}
+  80174b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80174f:	5b                   	pop    %rbx
+  801750:	41 5c                	pop    %r12
+  801752:	41 5d                	pop    %r13
+  801754:	41 5e                	pop    %r14
+  801756:	41 5f                	pop    %r15
+  801758:	5d                   	pop    %rbp
+  801759:	c3                   	ret
+
+000000000080175a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80175a:	55                   	push   %rbp
+  80175b:	48 89 e5             	mov    %rsp,%rbp
+  80175e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801762:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801766:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80176b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80176f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801776:	48 85 ff             	test   %rdi,%rdi
+  801779:	74 2b                	je     8017a6 <vsnprintf+0x4c>
+  80177b:	48 85 f6             	test   %rsi,%rsi
+  80177e:	74 26                	je     8017a6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801780:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801784:	48 bf fe 0f 80 00 00 	movabs $0x800ffe,%rdi
+  80178b:	00 00 00 
+  80178e:	48 b8 53 10 80 00 00 	movabs $0x801053,%rax
+  801795:	00 00 00 
+  801798:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80179a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80179e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  8017a1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  8017a4:	c9                   	leave
+  8017a5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  8017a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017ab:	eb f7                	jmp    8017a4 <vsnprintf+0x4a>
+
+00000000008017ad <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  8017ad:	55                   	push   %rbp
+  8017ae:	48 89 e5             	mov    %rsp,%rbp
+  8017b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8017b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8017b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8017bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8017c1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8017c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8017cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8017d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8017d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8017d8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8017dc:	48 b8 5a 17 80 00 00 	movabs $0x80175a,%rax
+  8017e3:	00 00 00 
+  8017e6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8017e8:	c9                   	leave
+  8017e9:	c3                   	ret
+
+00000000008017ea <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8017ea:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8017ed:	74 10                	je     8017ff <strlen+0x15>
+    size_t n = 0;
+  8017ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8017f4:	48 83 c0 01          	add    $0x1,%rax
+  8017f8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8017fc:	75 f6                	jne    8017f4 <strlen+0xa>
+  8017fe:	c3                   	ret
+    size_t n = 0;
+  8017ff:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  801804:	c3                   	ret
+
+0000000000801805 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  801805:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801808:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  80180d:	48 85 f6             	test   %rsi,%rsi
+  801810:	74 11                	je     801823 <strnlen+0x1e>
+  801812:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801816:	74 0c                	je     801824 <strnlen+0x1f>
+  801818:	48 83 c2 01          	add    $0x1,%rdx
+  80181c:	48 39 d0             	cmp    %rdx,%rax
+  80181f:	75 f1                	jne    801812 <strnlen+0xd>
+  801821:	eb 04                	jmp    801827 <strnlen+0x22>
+  801823:	c3                   	ret
+  801824:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801827:	c3                   	ret
+
+0000000000801828 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801828:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80182b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801830:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801834:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801837:	48 83 c2 01          	add    $0x1,%rdx
+  80183b:	84 c9                	test   %cl,%cl
+  80183d:	75 f1                	jne    801830 <strcpy+0x8>
+        ;
+    return res;
+}
+  80183f:	c3                   	ret
+
+0000000000801840 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801840:	55                   	push   %rbp
+  801841:	48 89 e5             	mov    %rsp,%rbp
+  801844:	41 54                	push   %r12
+  801846:	53                   	push   %rbx
+  801847:	48 89 fb             	mov    %rdi,%rbx
+  80184a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80184d:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  801854:	00 00 00 
+  801857:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801859:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80185d:	4c 89 e6             	mov    %r12,%rsi
+  801860:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  801867:	00 00 00 
+  80186a:	ff d0                	call   *%rax
+    return dst;
+}
+  80186c:	48 89 d8             	mov    %rbx,%rax
+  80186f:	5b                   	pop    %rbx
+  801870:	41 5c                	pop    %r12
+  801872:	5d                   	pop    %rbp
+  801873:	c3                   	ret
+
+0000000000801874 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801874:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801877:	48 85 d2             	test   %rdx,%rdx
+  80187a:	74 1f                	je     80189b <strncpy+0x27>
+  80187c:	48 01 fa             	add    %rdi,%rdx
+  80187f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801882:	48 83 c1 01          	add    $0x1,%rcx
+  801886:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80188a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80188e:	41 80 f8 01          	cmp    $0x1,%r8b
+  801892:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801896:	48 39 ca             	cmp    %rcx,%rdx
+  801899:	75 e7                	jne    801882 <strncpy+0xe>
+    }
+    return ret;
+}
+  80189b:	c3                   	ret
+
+000000000080189c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80189c:	48 89 f8             	mov    %rdi,%rax
+  80189f:	48 85 d2             	test   %rdx,%rdx
+  8018a2:	74 24                	je     8018c8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  8018a4:	48 83 ea 01          	sub    $0x1,%rdx
+  8018a8:	74 1b                	je     8018c5 <strlcpy+0x29>
+  8018aa:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  8018ae:	0f b6 16             	movzbl (%rsi),%edx
+  8018b1:	84 d2                	test   %dl,%dl
+  8018b3:	74 10                	je     8018c5 <strlcpy+0x29>
+            *dst++ = *src++;
+  8018b5:	48 83 c6 01          	add    $0x1,%rsi
+  8018b9:	48 83 c0 01          	add    $0x1,%rax
+  8018bd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8018c0:	48 39 c8             	cmp    %rcx,%rax
+  8018c3:	75 e9                	jne    8018ae <strlcpy+0x12>
+        *dst = '\0';
+  8018c5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8018c8:	48 29 f8             	sub    %rdi,%rax
+}
+  8018cb:	c3                   	ret
+
+00000000008018cc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8018cc:	0f b6 07             	movzbl (%rdi),%eax
+  8018cf:	84 c0                	test   %al,%al
+  8018d1:	74 13                	je     8018e6 <strcmp+0x1a>
+  8018d3:	38 06                	cmp    %al,(%rsi)
+  8018d5:	75 0f                	jne    8018e6 <strcmp+0x1a>
+  8018d7:	48 83 c7 01          	add    $0x1,%rdi
+  8018db:	48 83 c6 01          	add    $0x1,%rsi
+  8018df:	0f b6 07             	movzbl (%rdi),%eax
+  8018e2:	84 c0                	test   %al,%al
+  8018e4:	75 ed                	jne    8018d3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8018e6:	0f b6 c0             	movzbl %al,%eax
+  8018e9:	0f b6 16             	movzbl (%rsi),%edx
+  8018ec:	29 d0                	sub    %edx,%eax
+}
+  8018ee:	c3                   	ret
+
+00000000008018ef <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8018ef:	48 85 d2             	test   %rdx,%rdx
+  8018f2:	74 1f                	je     801913 <strncmp+0x24>
+  8018f4:	0f b6 07             	movzbl (%rdi),%eax
+  8018f7:	84 c0                	test   %al,%al
+  8018f9:	74 1e                	je     801919 <strncmp+0x2a>
+  8018fb:	3a 06                	cmp    (%rsi),%al
+  8018fd:	75 1a                	jne    801919 <strncmp+0x2a>
+  8018ff:	48 83 c7 01          	add    $0x1,%rdi
+  801903:	48 83 c6 01          	add    $0x1,%rsi
+  801907:	48 83 ea 01          	sub    $0x1,%rdx
+  80190b:	75 e7                	jne    8018f4 <strncmp+0x5>
+
+    if (!n) return 0;
+  80190d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801912:	c3                   	ret
+  801913:	b8 00 00 00 00       	mov    $0x0,%eax
+  801918:	c3                   	ret
+  801919:	48 85 d2             	test   %rdx,%rdx
+  80191c:	74 09                	je     801927 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80191e:	0f b6 07             	movzbl (%rdi),%eax
+  801921:	0f b6 16             	movzbl (%rsi),%edx
+  801924:	29 d0                	sub    %edx,%eax
+  801926:	c3                   	ret
+    if (!n) return 0;
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80192c:	c3                   	ret
+
+000000000080192d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80192d:	0f b6 17             	movzbl (%rdi),%edx
+  801930:	84 d2                	test   %dl,%dl
+  801932:	74 18                	je     80194c <strchr+0x1f>
+        if (*str == c) {
+  801934:	0f be d2             	movsbl %dl,%edx
+  801937:	39 f2                	cmp    %esi,%edx
+  801939:	74 17                	je     801952 <strchr+0x25>
+    for (; *str; str++) {
+  80193b:	48 83 c7 01          	add    $0x1,%rdi
+  80193f:	0f b6 17             	movzbl (%rdi),%edx
+  801942:	84 d2                	test   %dl,%dl
+  801944:	75 ee                	jne    801934 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801946:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194b:	c3                   	ret
+  80194c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801951:	c3                   	ret
+  801952:	48 89 f8             	mov    %rdi,%rax
+}
+  801955:	c3                   	ret
+
+0000000000801956 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801956:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801959:	0f b6 17             	movzbl (%rdi),%edx
+  80195c:	84 d2                	test   %dl,%dl
+  80195e:	74 13                	je     801973 <strfind+0x1d>
+  801960:	0f be d2             	movsbl %dl,%edx
+  801963:	39 f2                	cmp    %esi,%edx
+  801965:	74 0b                	je     801972 <strfind+0x1c>
+  801967:	48 83 c0 01          	add    $0x1,%rax
+  80196b:	0f b6 10             	movzbl (%rax),%edx
+  80196e:	84 d2                	test   %dl,%dl
+  801970:	75 ee                	jne    801960 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801972:	c3                   	ret
+  801973:	c3                   	ret
+
+0000000000801974 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801974:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801977:	48 89 f8             	mov    %rdi,%rax
+  80197a:	48 f7 d8             	neg    %rax
+  80197d:	83 e0 07             	and    $0x7,%eax
+  801980:	49 89 d1             	mov    %rdx,%r9
+  801983:	49 29 c1             	sub    %rax,%r9
+  801986:	78 36                	js     8019be <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801988:	40 0f b6 c6          	movzbl %sil,%eax
+  80198c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801993:	01 01 01 
+  801996:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80199a:	40 f6 c7 07          	test   $0x7,%dil
+  80199e:	75 38                	jne    8019d8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8019a0:	4c 89 c9             	mov    %r9,%rcx
+  8019a3:	48 c1 f9 03          	sar    $0x3,%rcx
+  8019a7:	74 0c                	je     8019b5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8019a9:	fc                   	cld
+  8019aa:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8019ad:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8019b1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8019b5:	4d 85 c9             	test   %r9,%r9
+  8019b8:	75 45                	jne    8019ff <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8019ba:	4c 89 c0             	mov    %r8,%rax
+  8019bd:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8019be:	48 85 d2             	test   %rdx,%rdx
+  8019c1:	74 f7                	je     8019ba <memset+0x46>
+  8019c3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8019c6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8019c9:	48 83 c0 01          	add    $0x1,%rax
+  8019cd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8019d1:	48 39 c2             	cmp    %rax,%rdx
+  8019d4:	75 f3                	jne    8019c9 <memset+0x55>
+  8019d6:	eb e2                	jmp    8019ba <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8019d8:	40 f6 c7 01          	test   $0x1,%dil
+  8019dc:	74 06                	je     8019e4 <memset+0x70>
+  8019de:	88 07                	mov    %al,(%rdi)
+  8019e0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8019e4:	40 f6 c7 02          	test   $0x2,%dil
+  8019e8:	74 07                	je     8019f1 <memset+0x7d>
+  8019ea:	66 89 07             	mov    %ax,(%rdi)
+  8019ed:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019f1:	40 f6 c7 04          	test   $0x4,%dil
+  8019f5:	74 a9                	je     8019a0 <memset+0x2c>
+  8019f7:	89 07                	mov    %eax,(%rdi)
+  8019f9:	48 83 c7 04          	add    $0x4,%rdi
+  8019fd:	eb a1                	jmp    8019a0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8019ff:	41 f6 c1 04          	test   $0x4,%r9b
+  801a03:	74 06                	je     801a0b <memset+0x97>
+  801a05:	89 07                	mov    %eax,(%rdi)
+  801a07:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801a0b:	41 f6 c1 02          	test   $0x2,%r9b
+  801a0f:	74 07                	je     801a18 <memset+0xa4>
+  801a11:	66 89 07             	mov    %ax,(%rdi)
+  801a14:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801a18:	41 f6 c1 01          	test   $0x1,%r9b
+  801a1c:	74 9c                	je     8019ba <memset+0x46>
+  801a1e:	88 07                	mov    %al,(%rdi)
+  801a20:	eb 98                	jmp    8019ba <memset+0x46>
+
+0000000000801a22 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801a22:	48 89 f8             	mov    %rdi,%rax
+  801a25:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801a28:	48 39 fe             	cmp    %rdi,%rsi
+  801a2b:	73 3b                	jae    801a68 <memmove+0x46>
+  801a2d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801a31:	48 39 d7             	cmp    %rdx,%rdi
+  801a34:	73 32                	jae    801a68 <memmove+0x46>
+        s += n;
+        d += n;
+  801a36:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a3a:	48 89 d6             	mov    %rdx,%rsi
+  801a3d:	48 09 fe             	or     %rdi,%rsi
+  801a40:	48 09 ce             	or     %rcx,%rsi
+  801a43:	40 f6 c6 07          	test   $0x7,%sil
+  801a47:	75 12                	jne    801a5b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801a49:	48 83 ef 08          	sub    $0x8,%rdi
+  801a4d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801a51:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a55:	fd                   	std
+  801a56:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801a59:	fc                   	cld
+  801a5a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801a5b:	48 83 ef 01          	sub    $0x1,%rdi
+  801a5f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801a63:	fd                   	std
+  801a64:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801a66:	eb f1                	jmp    801a59 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801a68:	48 89 f2             	mov    %rsi,%rdx
+  801a6b:	48 09 c2             	or     %rax,%rdx
+  801a6e:	48 09 ca             	or     %rcx,%rdx
+  801a71:	f6 c2 07             	test   $0x7,%dl
+  801a74:	75 0c                	jne    801a82 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801a76:	48 c1 e9 03          	shr    $0x3,%rcx
+  801a7a:	48 89 c7             	mov    %rax,%rdi
+  801a7d:	fc                   	cld
+  801a7e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801a81:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801a82:	48 89 c7             	mov    %rax,%rdi
+  801a85:	fc                   	cld
+  801a86:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801a88:	c3                   	ret
+
+0000000000801a89 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801a89:	55                   	push   %rbp
+  801a8a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801a8d:	48 b8 22 1a 80 00 00 	movabs $0x801a22,%rax
+  801a94:	00 00 00 
+  801a97:	ff d0                	call   *%rax
+}
+  801a99:	5d                   	pop    %rbp
+  801a9a:	c3                   	ret
+
+0000000000801a9b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801a9b:	55                   	push   %rbp
+  801a9c:	48 89 e5             	mov    %rsp,%rbp
+  801a9f:	41 57                	push   %r15
+  801aa1:	41 56                	push   %r14
+  801aa3:	41 55                	push   %r13
+  801aa5:	41 54                	push   %r12
+  801aa7:	53                   	push   %rbx
+  801aa8:	48 83 ec 08          	sub    $0x8,%rsp
+  801aac:	49 89 fe             	mov    %rdi,%r14
+  801aaf:	49 89 f7             	mov    %rsi,%r15
+  801ab2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801ab5:	48 89 f7             	mov    %rsi,%rdi
+  801ab8:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  801abf:	00 00 00 
+  801ac2:	ff d0                	call   *%rax
+  801ac4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801ac7:	48 89 de             	mov    %rbx,%rsi
+  801aca:	4c 89 f7             	mov    %r14,%rdi
+  801acd:	48 b8 05 18 80 00 00 	movabs $0x801805,%rax
+  801ad4:	00 00 00 
+  801ad7:	ff d0                	call   *%rax
+  801ad9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801adc:	48 39 c3             	cmp    %rax,%rbx
+  801adf:	74 36                	je     801b17 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801ae1:	48 89 d8             	mov    %rbx,%rax
+  801ae4:	4c 29 e8             	sub    %r13,%rax
+  801ae7:	49 39 c4             	cmp    %rax,%r12
+  801aea:	73 31                	jae    801b1d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801aec:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801af1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801af5:	4c 89 fe             	mov    %r15,%rsi
+  801af8:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  801aff:	00 00 00 
+  801b02:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801b04:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801b08:	48 83 c4 08          	add    $0x8,%rsp
+  801b0c:	5b                   	pop    %rbx
+  801b0d:	41 5c                	pop    %r12
+  801b0f:	41 5d                	pop    %r13
+  801b11:	41 5e                	pop    %r14
+  801b13:	41 5f                	pop    %r15
+  801b15:	5d                   	pop    %rbp
+  801b16:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801b17:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801b1b:	eb eb                	jmp    801b08 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801b1d:	48 83 eb 01          	sub    $0x1,%rbx
+  801b21:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801b25:	48 89 da             	mov    %rbx,%rdx
+  801b28:	4c 89 fe             	mov    %r15,%rsi
+  801b2b:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  801b32:	00 00 00 
+  801b35:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801b37:	49 01 de             	add    %rbx,%r14
+  801b3a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801b3f:	eb c3                	jmp    801b04 <strlcat+0x69>
+
+0000000000801b41 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801b41:	48 85 d2             	test   %rdx,%rdx
+  801b44:	74 2d                	je     801b73 <memcmp+0x32>
+  801b46:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801b4b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801b4f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801b54:	44 38 c1             	cmp    %r8b,%cl
+  801b57:	75 0f                	jne    801b68 <memcmp+0x27>
+    while (n-- > 0) {
+  801b59:	48 83 c0 01          	add    $0x1,%rax
+  801b5d:	48 39 c2             	cmp    %rax,%rdx
+  801b60:	75 e9                	jne    801b4b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801b62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b67:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801b68:	0f b6 c1             	movzbl %cl,%eax
+  801b6b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801b6f:	44 29 c0             	sub    %r8d,%eax
+  801b72:	c3                   	ret
+    return 0;
+  801b73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b78:	c3                   	ret
+
+0000000000801b79 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801b79:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801b7d:	48 39 c7             	cmp    %rax,%rdi
+  801b80:	73 0f                	jae    801b91 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801b82:	40 38 37             	cmp    %sil,(%rdi)
+  801b85:	74 0e                	je     801b95 <memfind+0x1c>
+    for (; src < end; src++) {
+  801b87:	48 83 c7 01          	add    $0x1,%rdi
+  801b8b:	48 39 f8             	cmp    %rdi,%rax
+  801b8e:	75 f2                	jne    801b82 <memfind+0x9>
+  801b90:	c3                   	ret
+  801b91:	48 89 f8             	mov    %rdi,%rax
+  801b94:	c3                   	ret
+  801b95:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801b98:	c3                   	ret
+
+0000000000801b99 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801b99:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801b9c:	0f b6 37             	movzbl (%rdi),%esi
+  801b9f:	40 80 fe 20          	cmp    $0x20,%sil
+  801ba3:	74 06                	je     801bab <strtol+0x12>
+  801ba5:	40 80 fe 09          	cmp    $0x9,%sil
+  801ba9:	75 13                	jne    801bbe <strtol+0x25>
+  801bab:	48 83 c7 01          	add    $0x1,%rdi
+  801baf:	0f b6 37             	movzbl (%rdi),%esi
+  801bb2:	40 80 fe 20          	cmp    $0x20,%sil
+  801bb6:	74 f3                	je     801bab <strtol+0x12>
+  801bb8:	40 80 fe 09          	cmp    $0x9,%sil
+  801bbc:	74 ed                	je     801bab <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801bbe:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801bc1:	83 e0 fd             	and    $0xfffffffd,%eax
+  801bc4:	3c 01                	cmp    $0x1,%al
+  801bc6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801bca:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801bd0:	75 0f                	jne    801be1 <strtol+0x48>
+  801bd2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801bd5:	74 14                	je     801beb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801bd7:	85 d2                	test   %edx,%edx
+  801bd9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801bde:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801be1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801be6:	4c 63 ca             	movslq %edx,%r9
+  801be9:	eb 36                	jmp    801c21 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801beb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801bef:	74 0f                	je     801c00 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801bf1:	85 d2                	test   %edx,%edx
+  801bf3:	75 ec                	jne    801be1 <strtol+0x48>
+        s++;
+  801bf5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801bf9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801bfe:	eb e1                	jmp    801be1 <strtol+0x48>
+        s += 2;
+  801c00:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801c04:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801c09:	eb d6                	jmp    801be1 <strtol+0x48>
+            dig -= '0';
+  801c0b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801c0e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801c12:	41 39 d0             	cmp    %edx,%r8d
+  801c15:	7d 21                	jge    801c38 <strtol+0x9f>
+        val = val * base + dig;
+  801c17:	49 0f af c1          	imul   %r9,%rax
+  801c1b:	0f b6 c9             	movzbl %cl,%ecx
+  801c1e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801c21:	48 83 c7 01          	add    $0x1,%rdi
+  801c25:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801c29:	80 f9 39             	cmp    $0x39,%cl
+  801c2c:	76 dd                	jbe    801c0b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801c2e:	80 f9 7b             	cmp    $0x7b,%cl
+  801c31:	77 05                	ja     801c38 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801c33:	83 e9 57             	sub    $0x57,%ecx
+  801c36:	eb d6                	jmp    801c0e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801c38:	4d 85 d2             	test   %r10,%r10
+  801c3b:	74 03                	je     801c40 <strtol+0xa7>
+  801c3d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801c40:	48 89 c2             	mov    %rax,%rdx
+  801c43:	48 f7 da             	neg    %rdx
+  801c46:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801c4a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801c4e:	c3                   	ret
+
+0000000000801c4f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c59:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801c6b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801c6d:	c3                   	ret
+
+0000000000801c6e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801c6e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801c73:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c78:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801c7d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c82:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801c88:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801c8e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801c94:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801c96:	c3                   	ret
+
+0000000000801c97 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801c97:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801c9a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801c9f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801ca4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ca9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801caf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801cb5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801cbb:	0f 05                	syscall
+    if (check && ret > 0) {
+  801cbd:	48 85 c0             	test   %rax,%rax
+  801cc0:	7f 01                	jg     801cc3 <sys_env_destroy+0x2c>
+}
+  801cc2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801cc3:	55                   	push   %rbp
+  801cc4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801cc7:	49 89 c0             	mov    %rax,%r8
+  801cca:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801ccf:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801cd6:	00 00 00 
+  801cd9:	be 29 00 00 00       	mov    $0x29,%esi
+  801cde:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801ce5:	00 00 00 
+  801ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ced:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801cf4:	00 00 00 
+  801cf7:	41 ff d1             	call   *%r9
+
+0000000000801cfa <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801cfa:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801cff:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d04:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d09:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d0e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d14:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d1a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801d20:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d22:	c3                   	ret
+
+0000000000801d23 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801d23:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801d28:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d2d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d32:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d37:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d43:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801d49:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801d4b:	c3                   	ret
+
+0000000000801d4c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801d4c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d51:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801d58:	00 00 00 
+  801d5b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d61:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d67:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801d6d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801d6f:	c3                   	ret
+
+0000000000801d70 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801d70:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801d73:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d7e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801d84:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801d86:	c3                   	ret
+
+0000000000801d87 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801d87:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801d8a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801d8f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801d92:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801d98:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801d9e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801da0:	48 85 c0             	test   %rax,%rax
+  801da3:	7f 01                	jg     801da6 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801da5:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801da6:	55                   	push   %rbp
+  801da7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801daa:	49 89 c0             	mov    %rax,%r8
+  801dad:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801db2:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801db9:	00 00 00 
+  801dbc:	be 29 00 00 00       	mov    $0x29,%esi
+  801dc1:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801dc8:	00 00 00 
+  801dcb:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dd0:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801dd7:	00 00 00 
+  801dda:	41 ff d1             	call   *%r9
+
+0000000000801ddd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801ddd:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801de0:	48 63 d2             	movslq %edx,%rdx
+  801de3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801de6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801deb:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801dee:	0f 05                	syscall
+    if (check && ret > 0) {
+  801df0:	48 85 c0             	test   %rax,%rax
+  801df3:	7f 01                	jg     801df6 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801df5:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801df6:	55                   	push   %rbp
+  801df7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801dfa:	49 89 c0             	mov    %rax,%r8
+  801dfd:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801e02:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801e09:	00 00 00 
+  801e0c:	be 29 00 00 00       	mov    $0x29,%esi
+  801e11:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801e18:	00 00 00 
+  801e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e20:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801e27:	00 00 00 
+  801e2a:	41 ff d1             	call   *%r9
+
+0000000000801e2d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801e2d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801e30:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e35:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e3b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e41:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801e47:	0f 05                	syscall
+    if (check && ret > 0) {
+  801e49:	48 85 c0             	test   %rax,%rax
+  801e4c:	7f 01                	jg     801e4f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801e4e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801e4f:	55                   	push   %rbp
+  801e50:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801e53:	49 89 c0             	mov    %rax,%r8
+  801e56:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801e5b:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801e62:	00 00 00 
+  801e65:	be 29 00 00 00       	mov    $0x29,%esi
+  801e6a:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801e71:	00 00 00 
+  801e74:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e79:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801e80:	00 00 00 
+  801e83:	41 ff d1             	call   *%r9
+
+0000000000801e86 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801e86:	48 63 f6             	movslq %esi,%rsi
+  801e89:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801e8c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e91:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e96:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801e9c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ea2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ea8:	0f 05                	syscall
+    if (check && ret > 0) {
+  801eaa:	48 85 c0             	test   %rax,%rax
+  801ead:	7f 01                	jg     801eb0 <sys_env_set_status+0x2a>
+}
+  801eaf:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801eb0:	55                   	push   %rbp
+  801eb1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801eb4:	49 89 c0             	mov    %rax,%r8
+  801eb7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801ebc:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801ec3:	00 00 00 
+  801ec6:	be 29 00 00 00       	mov    $0x29,%esi
+  801ecb:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801ed2:	00 00 00 
+  801ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eda:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801ee1:	00 00 00 
+  801ee4:	41 ff d1             	call   *%r9
+
+0000000000801ee7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801ee7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801eea:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801eef:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801efa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f00:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f06:	0f 05                	syscall
+    if (check && ret > 0) {
+  801f08:	48 85 c0             	test   %rax,%rax
+  801f0b:	7f 01                	jg     801f0e <sys_env_set_trapframe+0x27>
+}
+  801f0d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801f0e:	55                   	push   %rbp
+  801f0f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f12:	49 89 c0             	mov    %rax,%r8
+  801f15:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801f1a:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801f21:	00 00 00 
+  801f24:	be 29 00 00 00       	mov    $0x29,%esi
+  801f29:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801f30:	00 00 00 
+  801f33:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f38:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801f3f:	00 00 00 
+  801f42:	41 ff d1             	call   *%r9
+
+0000000000801f45 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801f45:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801f48:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f52:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801f58:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f5e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f64:	0f 05                	syscall
+    if (check && ret > 0) {
+  801f66:	48 85 c0             	test   %rax,%rax
+  801f69:	7f 01                	jg     801f6c <sys_env_set_pgfault_upcall+0x27>
+}
+  801f6b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801f6c:	55                   	push   %rbp
+  801f6d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f70:	49 89 c0             	mov    %rax,%r8
+  801f73:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801f78:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801f7f:	00 00 00 
+  801f82:	be 29 00 00 00       	mov    $0x29,%esi
+  801f87:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801f8e:	00 00 00 
+  801f91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f96:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  801f9d:	00 00 00 
+  801fa0:	41 ff d1             	call   *%r9
+
+0000000000801fa3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801fa3:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801fa6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fa9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fae:	4d 63 c0             	movslq %r8d,%r8
+  801fb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fb7:	0f 05                	syscall
+}
+  801fb9:	c3                   	ret
+
+0000000000801fba <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801fba:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801fbd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fc0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fc5:	4d 63 c0             	movslq %r8d,%r8
+  801fc8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fce:	0f 05                	syscall
+}
+  801fd0:	c3                   	ret
+
+0000000000801fd1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801fd1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801fd6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fd9:	45 89 c0             	mov    %r8d,%r8d
+  801fdc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fe2:	0f 05                	syscall
+    if (check && ret > 0) {
+  801fe4:	48 85 c0             	test   %rax,%rax
+  801fe7:	7f 01                	jg     801fea <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801fe9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801fee:	49 89 c0             	mov    %rax,%r8
+  801ff1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801ff6:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801ffd:	00 00 00 
+  802000:	be 29 00 00 00       	mov    $0x29,%esi
+  802005:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80200c:	00 00 00 
+  80200f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802014:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  80201b:	00 00 00 
+  80201e:	41 ff d1             	call   *%r9
+
+0000000000802021 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  802021:	55                   	push   %rbp
+  802022:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  802025:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80202b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802030:	ba 00 00 00 00       	mov    $0x0,%edx
+  802035:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+}
+  802041:	5d                   	pop    %rbp
+  802042:	c3                   	ret
+
+0000000000802043 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  802043:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  802048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80204d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802052:	ba 00 00 00 00       	mov    $0x0,%edx
+  802057:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80205d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802063:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802069:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80206b:	c3                   	ret
+
+000000000080206c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80206c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  802071:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802076:	ba 00 00 00 00       	mov    $0x0,%edx
+  80207b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802081:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802087:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80208d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80208f:	48 85 c0             	test   %rax,%rax
+  802092:	7f 01                	jg     802095 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  802094:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  802095:	55                   	push   %rbp
+  802096:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802099:	49 89 c0             	mov    %rax,%r8
+  80209c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8020a1:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8020a8:	00 00 00 
+  8020ab:	be 29 00 00 00       	mov    $0x29,%esi
+  8020b0:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8020b7:	00 00 00 
+  8020ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020bf:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  8020c6:	00 00 00 
+  8020c9:	41 ff d1             	call   *%r9
+
+00000000008020cc <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8020cc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8020d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020d6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8020db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8020e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8020f2:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8020f4:	c3                   	ret
+
+00000000008020f5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8020f5:	89 d2                	mov    %edx,%edx
+  8020f7:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8020f9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8020fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802104:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80210a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802110:	0f 05                	syscall
+}
+  802112:	c3                   	ret
+
+0000000000802113 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  802113:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802116:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80211b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802120:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802126:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80212c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802132:	0f 05                	syscall
+}
+  802134:	c3                   	ret
+
+0000000000802135 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  802135:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802138:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80213d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802142:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802154:	0f 05                	syscall
+}
+  802156:	c3                   	ret
+
+0000000000802157 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  802157:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80215a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80215f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802164:	ba 00 00 00 00       	mov    $0x0,%edx
+  802169:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80216f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802175:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80217b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80217d:	48 85 c0             	test   %rax,%rax
+  802180:	7f 01                	jg     802183 <sys_irq_ack+0x2c>
+}
+  802182:	c3                   	ret
+sys_irq_ack(int irq) {
+  802183:	55                   	push   %rbp
+  802184:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802187:	49 89 c0             	mov    %rax,%r8
+  80218a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80218f:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  802196:	00 00 00 
+  802199:	be 29 00 00 00       	mov    $0x29,%esi
+  80219e:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8021a5:	00 00 00 
+  8021a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021ad:	49 b9 b3 0d 80 00 00 	movabs $0x800db3,%r9
+  8021b4:	00 00 00 
+  8021b7:	41 ff d1             	call   *%r9
+
+00000000008021ba <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8021ba:	55                   	push   %rbp
+  8021bb:	48 89 e5             	mov    %rsp,%rbp
+  8021be:	41 56                	push   %r14
+  8021c0:	41 55                	push   %r13
+  8021c2:	41 54                	push   %r12
+  8021c4:	53                   	push   %rbx
+  8021c5:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8021c8:	48 b8 28 02 81 00 00 	movabs $0x810228,%rax
+  8021cf:	00 00 00 
+  8021d2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8021d6:	74 27                	je     8021ff <_handle_vectored_pagefault+0x45>
+  8021d8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8021dd:	49 bd e0 01 81 00 00 	movabs $0x8101e0,%r13
+  8021e4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8021e7:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8021ea:	4c 89 e7             	mov    %r12,%rdi
+  8021ed:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8021f2:	84 c0                	test   %al,%al
+  8021f4:	75 45                	jne    80223b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8021f6:	48 83 c3 01          	add    $0x1,%rbx
+  8021fa:	49 3b 1e             	cmp    (%r14),%rbx
+  8021fd:	72 eb                	jb     8021ea <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8021ff:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  802206:	00 
+  802207:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80220c:	4d 8b 04 24          	mov    (%r12),%r8
+  802210:	48 ba 28 5a 80 00 00 	movabs $0x805a28,%rdx
+  802217:	00 00 00 
+  80221a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80221f:	48 bf 58 5a 80 00 00 	movabs $0x805a58,%rdi
+  802226:	00 00 00 
+  802229:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222e:	49 ba b3 0d 80 00 00 	movabs $0x800db3,%r10
+  802235:	00 00 00 
+  802238:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80223b:	5b                   	pop    %rbx
+  80223c:	41 5c                	pop    %r12
+  80223e:	41 5d                	pop    %r13
+  802240:	41 5e                	pop    %r14
+  802242:	5d                   	pop    %rbp
+  802243:	c3                   	ret
+
+0000000000802244 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  802244:	55                   	push   %rbp
+  802245:	48 89 e5             	mov    %rsp,%rbp
+  802248:	53                   	push   %rbx
+  802249:	48 83 ec 08          	sub    $0x8,%rsp
+  80224d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  802250:	48 b8 20 02 81 00 00 	movabs $0x810220,%rax
+  802257:	00 00 00 
+  80225a:	80 38 00             	cmpb   $0x0,(%rax)
+  80225d:	0f 84 84 00 00 00    	je     8022e7 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  802263:	48 b8 28 02 81 00 00 	movabs $0x810228,%rax
+  80226a:	00 00 00 
+  80226d:	48 8b 10             	mov    (%rax),%rdx
+  802270:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  802275:	48 b9 e0 01 81 00 00 	movabs $0x8101e0,%rcx
+  80227c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80227f:	48 85 d2             	test   %rdx,%rdx
+  802282:	74 19                	je     80229d <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  802284:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  802288:	0f 84 e8 00 00 00    	je     802376 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80228e:	48 83 c0 01          	add    $0x1,%rax
+  802292:	48 39 d0             	cmp    %rdx,%rax
+  802295:	75 ed                	jne    802284 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  802297:	48 83 fa 08          	cmp    $0x8,%rdx
+  80229b:	74 1c                	je     8022b9 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80229d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8022a1:	48 a3 28 02 81 00 00 	movabs %rax,0x810228
+  8022a8:	00 00 00 
+  8022ab:	48 b8 e0 01 81 00 00 	movabs $0x8101e0,%rax
+  8022b2:	00 00 00 
+  8022b5:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8022b9:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  8022c0:	00 00 00 
+  8022c3:	ff d0                	call   *%rax
+  8022c5:	89 c7                	mov    %eax,%edi
+  8022c7:	48 be 3c 24 80 00 00 	movabs $0x80243c,%rsi
+  8022ce:	00 00 00 
+  8022d1:	48 b8 45 1f 80 00 00 	movabs $0x801f45,%rax
+  8022d8:	00 00 00 
+  8022db:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8022dd:	85 c0                	test   %eax,%eax
+  8022df:	78 68                	js     802349 <add_pgfault_handler+0x105>
+    return res;
+}
+  8022e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022e5:	c9                   	leave
+  8022e6:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8022e7:	48 b8 fa 1c 80 00 00 	movabs $0x801cfa,%rax
+  8022ee:	00 00 00 
+  8022f1:	ff d0                	call   *%rax
+  8022f3:	89 c7                	mov    %eax,%edi
+  8022f5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8022fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8022ff:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  802306:	00 00 00 
+  802309:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  802310:	00 00 00 
+  802313:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  802315:	48 ba 28 02 81 00 00 	movabs $0x810228,%rdx
+  80231c:	00 00 00 
+  80231f:	48 8b 02             	mov    (%rdx),%rax
+  802322:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  802326:	48 89 0a             	mov    %rcx,(%rdx)
+  802329:	48 ba e0 01 81 00 00 	movabs $0x8101e0,%rdx
+  802330:	00 00 00 
+  802333:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  802337:	48 b8 20 02 81 00 00 	movabs $0x810220,%rax
+  80233e:	00 00 00 
+  802341:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  802344:	e9 70 ff ff ff       	jmp    8022b9 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  802349:	89 c1                	mov    %eax,%ecx
+  80234b:	48 ba 66 5a 80 00 00 	movabs $0x805a66,%rdx
+  802352:	00 00 00 
+  802355:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80235a:	48 bf 58 5a 80 00 00 	movabs $0x805a58,%rdi
+  802361:	00 00 00 
+  802364:	b8 00 00 00 00       	mov    $0x0,%eax
+  802369:	49 b8 b3 0d 80 00 00 	movabs $0x800db3,%r8
+  802370:	00 00 00 
+  802373:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  802376:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237b:	e9 61 ff ff ff       	jmp    8022e1 <add_pgfault_handler+0x9d>
+
+0000000000802380 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  802384:	48 b8 20 02 81 00 00 	movabs $0x810220,%rax
+  80238b:	00 00 00 
+  80238e:	80 38 00             	cmpb   $0x0,(%rax)
+  802391:	74 33                	je     8023c6 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  802393:	48 a1 28 02 81 00 00 	movabs 0x810228,%rax
+  80239a:	00 00 00 
+  80239d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8023a2:	48 ba e0 01 81 00 00 	movabs $0x8101e0,%rdx
+  8023a9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8023ac:	48 85 c0             	test   %rax,%rax
+  8023af:	0f 84 85 00 00 00    	je     80243a <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8023b5:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8023b9:	74 40                	je     8023fb <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8023bb:	48 83 c1 01          	add    $0x1,%rcx
+  8023bf:	48 39 c1             	cmp    %rax,%rcx
+  8023c2:	75 f1                	jne    8023b5 <remove_pgfault_handler+0x35>
+  8023c4:	eb 74                	jmp    80243a <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8023c6:	48 b9 7e 5a 80 00 00 	movabs $0x805a7e,%rcx
+  8023cd:	00 00 00 
+  8023d0:	48 ba 98 5a 80 00 00 	movabs $0x805a98,%rdx
+  8023d7:	00 00 00 
+  8023da:	be 43 00 00 00       	mov    $0x43,%esi
+  8023df:	48 bf 58 5a 80 00 00 	movabs $0x805a58,%rdi
+  8023e6:	00 00 00 
+  8023e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ee:	49 b8 b3 0d 80 00 00 	movabs $0x800db3,%r8
+  8023f5:	00 00 00 
+  8023f8:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8023fb:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  802402:	00 
+  802403:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  802407:	48 29 ca             	sub    %rcx,%rdx
+  80240a:	48 b8 e0 01 81 00 00 	movabs $0x8101e0,%rax
+  802411:	00 00 00 
+  802414:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  802418:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80241d:	48 89 ce             	mov    %rcx,%rsi
+  802420:	48 b8 22 1a 80 00 00 	movabs $0x801a22,%rax
+  802427:	00 00 00 
+  80242a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80242c:	48 b8 28 02 81 00 00 	movabs $0x810228,%rax
+  802433:	00 00 00 
+  802436:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80243a:	5d                   	pop    %rbp
+  80243b:	c3                   	ret
+
+000000000080243c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80243c:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80243f:	48 b8 ba 21 80 00 00 	movabs $0x8021ba,%rax
+  802446:	00 00 00 
+    call *%rax
+  802449:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80244b:	41 5f                	pop    %r15
+	popq %r15
+  80244d:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80244f:	41 5f                	pop    %r15
+	popq %r14
+  802451:	41 5e                	pop    %r14
+	popq %r13
+  802453:	41 5d                	pop    %r13
+	popq %r12
+  802455:	41 5c                	pop    %r12
+	popq %r11
+  802457:	41 5b                	pop    %r11
+	popq %r10
+  802459:	41 5a                	pop    %r10
+	popq %r9
+  80245b:	41 59                	pop    %r9
+	popq %r8
+  80245d:	41 58                	pop    %r8
+	popq %rsi
+  80245f:	5e                   	pop    %rsi
+	popq %rdi
+  802460:	5f                   	pop    %rdi
+	popq %rbp
+  802461:	5d                   	pop    %rbp
+	popq %rdx
+  802462:	5a                   	pop    %rdx
+	popq %rcx
+  802463:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  802464:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  802469:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80246e:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  802472:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  802475:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80247a:	5b                   	pop    %rbx
+	popq %rax
+  80247b:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80247c:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  802480:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  802481:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  802486:	c3                   	ret
+
+0000000000802487 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802487:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80248e:	ff ff ff 
+  802491:	48 01 f8             	add    %rdi,%rax
+  802494:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  802498:	c3                   	ret
+
+0000000000802499 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  802499:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8024a0:	ff ff ff 
+  8024a3:	48 01 f8             	add    %rdi,%rax
+  8024a6:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8024aa:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8024b0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8024b4:	c3                   	ret
+
+00000000008024b5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8024b5:	55                   	push   %rbp
+  8024b6:	48 89 e5             	mov    %rsp,%rbp
+  8024b9:	41 57                	push   %r15
+  8024bb:	41 56                	push   %r14
+  8024bd:	41 55                	push   %r13
+  8024bf:	41 54                	push   %r12
+  8024c1:	53                   	push   %rbx
+  8024c2:	48 83 ec 08          	sub    $0x8,%rsp
+  8024c6:	49 89 ff             	mov    %rdi,%r15
+  8024c9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8024ce:	49 bd 44 4c 80 00 00 	movabs $0x804c44,%r13
+  8024d5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8024d8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8024de:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8024e1:	48 89 df             	mov    %rbx,%rdi
+  8024e4:	41 ff d5             	call   *%r13
+  8024e7:	83 e0 04             	and    $0x4,%eax
+  8024ea:	74 17                	je     802503 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8024ec:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8024f3:	4c 39 f3             	cmp    %r14,%rbx
+  8024f6:	75 e6                	jne    8024de <fd_alloc+0x29>
+  8024f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8024fe:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  802503:	4d 89 27             	mov    %r12,(%r15)
+}
+  802506:	48 83 c4 08          	add    $0x8,%rsp
+  80250a:	5b                   	pop    %rbx
+  80250b:	41 5c                	pop    %r12
+  80250d:	41 5d                	pop    %r13
+  80250f:	41 5e                	pop    %r14
+  802511:	41 5f                	pop    %r15
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+
+0000000000802515 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  802515:	83 ff 1f             	cmp    $0x1f,%edi
+  802518:	77 39                	ja     802553 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80251a:	55                   	push   %rbp
+  80251b:	48 89 e5             	mov    %rsp,%rbp
+  80251e:	41 54                	push   %r12
+  802520:	53                   	push   %rbx
+  802521:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  802524:	48 63 df             	movslq %edi,%rbx
+  802527:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80252e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802532:	48 89 df             	mov    %rbx,%rdi
+  802535:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  80253c:	00 00 00 
+  80253f:	ff d0                	call   *%rax
+  802541:	a8 04                	test   $0x4,%al
+  802543:	74 14                	je     802559 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  802545:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802549:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80254e:	5b                   	pop    %rbx
+  80254f:	41 5c                	pop    %r12
+  802551:	5d                   	pop    %rbp
+  802552:	c3                   	ret
+        return -E_INVAL;
+  802553:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  802558:	c3                   	ret
+        return -E_INVAL;
+  802559:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80255e:	eb ee                	jmp    80254e <fd_lookup+0x39>
+
+0000000000802560 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802560:	55                   	push   %rbp
+  802561:	48 89 e5             	mov    %rsp,%rbp
+  802564:	41 54                	push   %r12
+  802566:	53                   	push   %rbx
+  802567:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80256a:	48 b8 40 5b 80 00 00 	movabs $0x805b40,%rax
+  802571:	00 00 00 
+  802574:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80257b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80257e:	39 3b                	cmp    %edi,(%rbx)
+  802580:	74 47                	je     8025c9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802582:	48 83 c0 08          	add    $0x8,%rax
+  802586:	48 8b 18             	mov    (%rax),%rbx
+  802589:	48 85 db             	test   %rbx,%rbx
+  80258c:	75 f0                	jne    80257e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80258e:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  802595:	00 00 00 
+  802598:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80259e:	89 fa                	mov    %edi,%edx
+  8025a0:	48 bf b0 5a 80 00 00 	movabs $0x805ab0,%rdi
+  8025a7:	00 00 00 
+  8025aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025af:	48 b9 03 0f 80 00 00 	movabs $0x800f03,%rcx
+  8025b6:	00 00 00 
+  8025b9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8025bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8025c0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8025c4:	5b                   	pop    %rbx
+  8025c5:	41 5c                	pop    %r12
+  8025c7:	5d                   	pop    %rbp
+  8025c8:	c3                   	ret
+            return 0;
+  8025c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025ce:	eb f0                	jmp    8025c0 <dev_lookup+0x60>
+
+00000000008025d0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8025d0:	55                   	push   %rbp
+  8025d1:	48 89 e5             	mov    %rsp,%rbp
+  8025d4:	41 55                	push   %r13
+  8025d6:	41 54                	push   %r12
+  8025d8:	53                   	push   %rbx
+  8025d9:	48 83 ec 18          	sub    $0x18,%rsp
+  8025dd:	48 89 fb             	mov    %rdi,%rbx
+  8025e0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8025e3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8025ea:	ff ff ff 
+  8025ed:	48 01 df             	add    %rbx,%rdi
+  8025f0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8025f4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8025f8:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+  802604:	41 89 c5             	mov    %eax,%r13d
+  802607:	85 c0                	test   %eax,%eax
+  802609:	78 06                	js     802611 <fd_close+0x41>
+  80260b:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80260f:	74 1a                	je     80262b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802611:	45 84 e4             	test   %r12b,%r12b
+  802614:	b8 00 00 00 00       	mov    $0x0,%eax
+  802619:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80261d:	44 89 e8             	mov    %r13d,%eax
+  802620:	48 83 c4 18          	add    $0x18,%rsp
+  802624:	5b                   	pop    %rbx
+  802625:	41 5c                	pop    %r12
+  802627:	41 5d                	pop    %r13
+  802629:	5d                   	pop    %rbp
+  80262a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80262b:	8b 3b                	mov    (%rbx),%edi
+  80262d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802631:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802638:	00 00 00 
+  80263b:	ff d0                	call   *%rax
+  80263d:	41 89 c5             	mov    %eax,%r13d
+  802640:	85 c0                	test   %eax,%eax
+  802642:	78 1b                	js     80265f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  802644:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802648:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80264c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802652:	48 85 c0             	test   %rax,%rax
+  802655:	74 08                	je     80265f <fd_close+0x8f>
+  802657:	48 89 df             	mov    %rbx,%rdi
+  80265a:	ff d0                	call   *%rax
+  80265c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80265f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802664:	48 89 de             	mov    %rbx,%rsi
+  802667:	bf 00 00 00 00       	mov    $0x0,%edi
+  80266c:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+    return res;
+  802678:	eb a3                	jmp    80261d <fd_close+0x4d>
+
+000000000080267a <close>:
+
+int
+close(int fdnum) {
+  80267a:	55                   	push   %rbp
+  80267b:	48 89 e5             	mov    %rsp,%rbp
+  80267e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802682:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802686:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  80268d:	00 00 00 
+  802690:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802692:	85 c0                	test   %eax,%eax
+  802694:	78 15                	js     8026ab <close+0x31>
+
+    return fd_close(fd, 1);
+  802696:	be 01 00 00 00       	mov    $0x1,%esi
+  80269b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80269f:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+}
+  8026ab:	c9                   	leave
+  8026ac:	c3                   	ret
+
+00000000008026ad <close_all>:
+
+void
+close_all(void) {
+  8026ad:	55                   	push   %rbp
+  8026ae:	48 89 e5             	mov    %rsp,%rbp
+  8026b1:	41 54                	push   %r12
+  8026b3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8026b4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8026b9:	49 bc 7a 26 80 00 00 	movabs $0x80267a,%r12
+  8026c0:	00 00 00 
+  8026c3:	89 df                	mov    %ebx,%edi
+  8026c5:	41 ff d4             	call   *%r12
+  8026c8:	83 c3 01             	add    $0x1,%ebx
+  8026cb:	83 fb 20             	cmp    $0x20,%ebx
+  8026ce:	75 f3                	jne    8026c3 <close_all+0x16>
+}
+  8026d0:	5b                   	pop    %rbx
+  8026d1:	41 5c                	pop    %r12
+  8026d3:	5d                   	pop    %rbp
+  8026d4:	c3                   	ret
+
+00000000008026d5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8026d5:	55                   	push   %rbp
+  8026d6:	48 89 e5             	mov    %rsp,%rbp
+  8026d9:	41 57                	push   %r15
+  8026db:	41 56                	push   %r14
+  8026dd:	41 55                	push   %r13
+  8026df:	41 54                	push   %r12
+  8026e1:	53                   	push   %rbx
+  8026e2:	48 83 ec 18          	sub    $0x18,%rsp
+  8026e6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8026e9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8026ed:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	89 c3                	mov    %eax,%ebx
+  8026fb:	85 c0                	test   %eax,%eax
+  8026fd:	0f 88 b8 00 00 00    	js     8027bb <dup+0xe6>
+    close(newfdnum);
+  802703:	44 89 e7             	mov    %r12d,%edi
+  802706:	48 b8 7a 26 80 00 00 	movabs $0x80267a,%rax
+  80270d:	00 00 00 
+  802710:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802712:	4d 63 ec             	movslq %r12d,%r13
+  802715:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80271c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802720:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  802724:	4c 89 ff             	mov    %r15,%rdi
+  802727:	49 be 99 24 80 00 00 	movabs $0x802499,%r14
+  80272e:	00 00 00 
+  802731:	41 ff d6             	call   *%r14
+  802734:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  802737:	4c 89 ef             	mov    %r13,%rdi
+  80273a:	41 ff d6             	call   *%r14
+  80273d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802740:	48 89 df             	mov    %rbx,%rdi
+  802743:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  80274a:	00 00 00 
+  80274d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80274f:	a8 04                	test   $0x4,%al
+  802751:	74 2b                	je     80277e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  802753:	41 89 c1             	mov    %eax,%r9d
+  802756:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80275c:	4c 89 f1             	mov    %r14,%rcx
+  80275f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802764:	48 89 de             	mov    %rbx,%rsi
+  802767:	bf 00 00 00 00       	mov    $0x0,%edi
+  80276c:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  802773:	00 00 00 
+  802776:	ff d0                	call   *%rax
+  802778:	89 c3                	mov    %eax,%ebx
+  80277a:	85 c0                	test   %eax,%eax
+  80277c:	78 4e                	js     8027cc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80277e:	4c 89 ff             	mov    %r15,%rdi
+  802781:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  802788:	00 00 00 
+  80278b:	ff d0                	call   *%rax
+  80278d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  802790:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802796:	4c 89 e9             	mov    %r13,%rcx
+  802799:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279e:	4c 89 fe             	mov    %r15,%rsi
+  8027a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027a6:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  8027ad:	00 00 00 
+  8027b0:	ff d0                	call   *%rax
+  8027b2:	89 c3                	mov    %eax,%ebx
+  8027b4:	85 c0                	test   %eax,%eax
+  8027b6:	78 14                	js     8027cc <dup+0xf7>
+
+    return newfdnum;
+  8027b8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8027bb:	89 d8                	mov    %ebx,%eax
+  8027bd:	48 83 c4 18          	add    $0x18,%rsp
+  8027c1:	5b                   	pop    %rbx
+  8027c2:	41 5c                	pop    %r12
+  8027c4:	41 5d                	pop    %r13
+  8027c6:	41 5e                	pop    %r14
+  8027c8:	41 5f                	pop    %r15
+  8027ca:	5d                   	pop    %rbp
+  8027cb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8027cc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027d1:	4c 89 ee             	mov    %r13,%rsi
+  8027d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d9:	49 bc 2d 1e 80 00 00 	movabs $0x801e2d,%r12
+  8027e0:	00 00 00 
+  8027e3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8027e6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8027eb:	4c 89 f6             	mov    %r14,%rsi
+  8027ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f3:	41 ff d4             	call   *%r12
+    return res;
+  8027f6:	eb c3                	jmp    8027bb <dup+0xe6>
+
+00000000008027f8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8027f8:	55                   	push   %rbp
+  8027f9:	48 89 e5             	mov    %rsp,%rbp
+  8027fc:	41 56                	push   %r14
+  8027fe:	41 55                	push   %r13
+  802800:	41 54                	push   %r12
+  802802:	53                   	push   %rbx
+  802803:	48 83 ec 10          	sub    $0x10,%rsp
+  802807:	89 fb                	mov    %edi,%ebx
+  802809:	49 89 f4             	mov    %rsi,%r12
+  80280c:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80280f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802813:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+  80281f:	85 c0                	test   %eax,%eax
+  802821:	78 4c                	js     80286f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802823:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802827:	41 8b 3e             	mov    (%r14),%edi
+  80282a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80282e:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802835:	00 00 00 
+  802838:	ff d0                	call   *%rax
+  80283a:	85 c0                	test   %eax,%eax
+  80283c:	78 35                	js     802873 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  80283e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802842:	83 e0 03             	and    $0x3,%eax
+  802845:	83 f8 01             	cmp    $0x1,%eax
+  802848:	74 2d                	je     802877 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80284a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80284e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802852:	48 85 c0             	test   %rax,%rax
+  802855:	74 56                	je     8028ad <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802857:	4c 89 ea             	mov    %r13,%rdx
+  80285a:	4c 89 e6             	mov    %r12,%rsi
+  80285d:	4c 89 f7             	mov    %r14,%rdi
+  802860:	ff d0                	call   *%rax
+}
+  802862:	48 83 c4 10          	add    $0x10,%rsp
+  802866:	5b                   	pop    %rbx
+  802867:	41 5c                	pop    %r12
+  802869:	41 5d                	pop    %r13
+  80286b:	41 5e                	pop    %r14
+  80286d:	5d                   	pop    %rbp
+  80286e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80286f:	48 98                	cltq
+  802871:	eb ef                	jmp    802862 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802873:	48 98                	cltq
+  802875:	eb eb                	jmp    802862 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802877:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  80287e:	00 00 00 
+  802881:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802887:	89 da                	mov    %ebx,%edx
+  802889:	48 bf f1 5a 80 00 00 	movabs $0x805af1,%rdi
+  802890:	00 00 00 
+  802893:	b8 00 00 00 00       	mov    $0x0,%eax
+  802898:	48 b9 03 0f 80 00 00 	movabs $0x800f03,%rcx
+  80289f:	00 00 00 
+  8028a2:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8028a4:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8028ab:	eb b5                	jmp    802862 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8028ad:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8028b4:	eb ac                	jmp    802862 <read+0x6a>
+
+00000000008028b6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8028b6:	55                   	push   %rbp
+  8028b7:	48 89 e5             	mov    %rsp,%rbp
+  8028ba:	41 57                	push   %r15
+  8028bc:	41 56                	push   %r14
+  8028be:	41 55                	push   %r13
+  8028c0:	41 54                	push   %r12
+  8028c2:	53                   	push   %rbx
+  8028c3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8028c7:	48 85 d2             	test   %rdx,%rdx
+  8028ca:	74 54                	je     802920 <readn+0x6a>
+  8028cc:	41 89 fd             	mov    %edi,%r13d
+  8028cf:	49 89 f6             	mov    %rsi,%r14
+  8028d2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8028d5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8028da:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  8028df:	49 bf f8 27 80 00 00 	movabs $0x8027f8,%r15
+  8028e6:	00 00 00 
+  8028e9:	4c 89 e2             	mov    %r12,%rdx
+  8028ec:	48 29 f2             	sub    %rsi,%rdx
+  8028ef:	4c 01 f6             	add    %r14,%rsi
+  8028f2:	44 89 ef             	mov    %r13d,%edi
+  8028f5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  8028f8:	85 c0                	test   %eax,%eax
+  8028fa:	78 20                	js     80291c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  8028fc:	01 c3                	add    %eax,%ebx
+  8028fe:	85 c0                	test   %eax,%eax
+  802900:	74 08                	je     80290a <readn+0x54>
+  802902:	48 63 f3             	movslq %ebx,%rsi
+  802905:	4c 39 e6             	cmp    %r12,%rsi
+  802908:	72 df                	jb     8028e9 <readn+0x33>
+    }
+    return res;
+  80290a:	48 63 c3             	movslq %ebx,%rax
+}
+  80290d:	48 83 c4 08          	add    $0x8,%rsp
+  802911:	5b                   	pop    %rbx
+  802912:	41 5c                	pop    %r12
+  802914:	41 5d                	pop    %r13
+  802916:	41 5e                	pop    %r14
+  802918:	41 5f                	pop    %r15
+  80291a:	5d                   	pop    %rbp
+  80291b:	c3                   	ret
+        if (inc < 0) return inc;
+  80291c:	48 98                	cltq
+  80291e:	eb ed                	jmp    80290d <readn+0x57>
+    int inc = 1, res = 0;
+  802920:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802925:	eb e3                	jmp    80290a <readn+0x54>
+
+0000000000802927 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802927:	55                   	push   %rbp
+  802928:	48 89 e5             	mov    %rsp,%rbp
+  80292b:	41 56                	push   %r14
+  80292d:	41 55                	push   %r13
+  80292f:	41 54                	push   %r12
+  802931:	53                   	push   %rbx
+  802932:	48 83 ec 10          	sub    $0x10,%rsp
+  802936:	89 fb                	mov    %edi,%ebx
+  802938:	49 89 f4             	mov    %rsi,%r12
+  80293b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80293e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802942:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  802949:	00 00 00 
+  80294c:	ff d0                	call   *%rax
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	78 47                	js     802999 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802952:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802956:	41 8b 3e             	mov    (%r14),%edi
+  802959:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80295d:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+  802969:	85 c0                	test   %eax,%eax
+  80296b:	78 30                	js     80299d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  80296d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802972:	74 2d                	je     8029a1 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802974:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802978:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80297c:	48 85 c0             	test   %rax,%rax
+  80297f:	74 56                	je     8029d7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802981:	4c 89 ea             	mov    %r13,%rdx
+  802984:	4c 89 e6             	mov    %r12,%rsi
+  802987:	4c 89 f7             	mov    %r14,%rdi
+  80298a:	ff d0                	call   *%rax
+}
+  80298c:	48 83 c4 10          	add    $0x10,%rsp
+  802990:	5b                   	pop    %rbx
+  802991:	41 5c                	pop    %r12
+  802993:	41 5d                	pop    %r13
+  802995:	41 5e                	pop    %r14
+  802997:	5d                   	pop    %rbp
+  802998:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802999:	48 98                	cltq
+  80299b:	eb ef                	jmp    80298c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80299d:	48 98                	cltq
+  80299f:	eb eb                	jmp    80298c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8029a1:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  8029a8:	00 00 00 
+  8029ab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8029b1:	89 da                	mov    %ebx,%edx
+  8029b3:	48 bf 0d 5b 80 00 00 	movabs $0x805b0d,%rdi
+  8029ba:	00 00 00 
+  8029bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c2:	48 b9 03 0f 80 00 00 	movabs $0x800f03,%rcx
+  8029c9:	00 00 00 
+  8029cc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8029ce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8029d5:	eb b5                	jmp    80298c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8029d7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8029de:	eb ac                	jmp    80298c <write+0x65>
+
+00000000008029e0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	41 54                	push   %r12
+  8029e6:	53                   	push   %rbx
+  8029e7:	48 83 ec 10          	sub    $0x10,%rsp
+  8029eb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8029ed:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8029f1:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8029f8:	00 00 00 
+  8029fb:	ff d0                	call   *%rax
+  8029fd:	85 c0                	test   %eax,%eax
+  8029ff:	78 3e                	js     802a3f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a01:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802a05:	41 8b 3c 24          	mov    (%r12),%edi
+  802a09:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802a0d:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+  802a19:	85 c0                	test   %eax,%eax
+  802a1b:	78 22                	js     802a3f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802a1d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802a21:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802a25:	48 85 c0             	test   %rax,%rax
+  802a28:	74 0b                	je     802a35 <seek+0x55>
+  802a2a:	89 de                	mov    %ebx,%esi
+  802a2c:	4c 89 e7             	mov    %r12,%rdi
+  802a2f:	ff d0                	call   *%rax
+  802a31:	85 c0                	test   %eax,%eax
+  802a33:	78 0a                	js     802a3f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802a35:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a3f:	48 83 c4 10          	add    $0x10,%rsp
+  802a43:	5b                   	pop    %rbx
+  802a44:	41 5c                	pop    %r12
+  802a46:	5d                   	pop    %rbp
+  802a47:	c3                   	ret
+
+0000000000802a48 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802a48:	55                   	push   %rbp
+  802a49:	48 89 e5             	mov    %rsp,%rbp
+  802a4c:	41 55                	push   %r13
+  802a4e:	41 54                	push   %r12
+  802a50:	53                   	push   %rbx
+  802a51:	48 83 ec 18          	sub    $0x18,%rsp
+  802a55:	89 fb                	mov    %edi,%ebx
+  802a57:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a5a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a5e:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  802a65:	00 00 00 
+  802a68:	ff d0                	call   *%rax
+  802a6a:	85 c0                	test   %eax,%eax
+  802a6c:	78 38                	js     802aa6 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a6e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802a72:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802a76:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a7a:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802a81:	00 00 00 
+  802a84:	ff d0                	call   *%rax
+  802a86:	85 c0                	test   %eax,%eax
+  802a88:	78 1c                	js     802aa6 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802a8a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802a8f:	74 20                	je     802ab1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802a91:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a95:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802a99:	48 85 c0             	test   %rax,%rax
+  802a9c:	74 47                	je     802ae5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802a9e:	44 89 e6             	mov    %r12d,%esi
+  802aa1:	4c 89 ef             	mov    %r13,%rdi
+  802aa4:	ff d0                	call   *%rax
+}
+  802aa6:	48 83 c4 18          	add    $0x18,%rsp
+  802aaa:	5b                   	pop    %rbx
+  802aab:	41 5c                	pop    %r12
+  802aad:	41 5d                	pop    %r13
+  802aaf:	5d                   	pop    %rbp
+  802ab0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802ab1:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  802ab8:	00 00 00 
+  802abb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802ac1:	89 da                	mov    %ebx,%edx
+  802ac3:	48 bf d0 5a 80 00 00 	movabs $0x805ad0,%rdi
+  802aca:	00 00 00 
+  802acd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ad2:	48 b9 03 0f 80 00 00 	movabs $0x800f03,%rcx
+  802ad9:	00 00 00 
+  802adc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802ade:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ae3:	eb c1                	jmp    802aa6 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802ae5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802aea:	eb ba                	jmp    802aa6 <ftruncate+0x5e>
+
+0000000000802aec <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802aec:	55                   	push   %rbp
+  802aed:	48 89 e5             	mov    %rsp,%rbp
+  802af0:	41 54                	push   %r12
+  802af2:	53                   	push   %rbx
+  802af3:	48 83 ec 10          	sub    $0x10,%rsp
+  802af7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802afa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802afe:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  802b05:	00 00 00 
+  802b08:	ff d0                	call   *%rax
+  802b0a:	85 c0                	test   %eax,%eax
+  802b0c:	78 4e                	js     802b5c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b0e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802b12:	41 8b 3c 24          	mov    (%r12),%edi
+  802b16:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802b1a:	48 b8 60 25 80 00 00 	movabs $0x802560,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+  802b26:	85 c0                	test   %eax,%eax
+  802b28:	78 32                	js     802b5c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b2a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802b2e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802b33:	74 30                	je     802b65 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802b35:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802b38:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802b3f:	00 00 00 
+    stat->st_isdir = 0;
+  802b42:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802b49:	00 00 00 
+    stat->st_dev = dev;
+  802b4c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802b53:	48 89 de             	mov    %rbx,%rsi
+  802b56:	4c 89 e7             	mov    %r12,%rdi
+  802b59:	ff 50 28             	call   *0x28(%rax)
+}
+  802b5c:	48 83 c4 10          	add    $0x10,%rsp
+  802b60:	5b                   	pop    %rbx
+  802b61:	41 5c                	pop    %r12
+  802b63:	5d                   	pop    %rbp
+  802b64:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802b65:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802b6a:	eb f0                	jmp    802b5c <fstat+0x70>
+
+0000000000802b6c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802b6c:	55                   	push   %rbp
+  802b6d:	48 89 e5             	mov    %rsp,%rbp
+  802b70:	41 54                	push   %r12
+  802b72:	53                   	push   %rbx
+  802b73:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802b76:	be 00 00 00 00       	mov    $0x0,%esi
+  802b7b:	48 b8 da 3c 80 00 00 	movabs $0x803cda,%rax
+  802b82:	00 00 00 
+  802b85:	ff d0                	call   *%rax
+  802b87:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802b89:	85 c0                	test   %eax,%eax
+  802b8b:	78 25                	js     802bb2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802b8d:	4c 89 e6             	mov    %r12,%rsi
+  802b90:	89 c7                	mov    %eax,%edi
+  802b92:	48 b8 ec 2a 80 00 00 	movabs $0x802aec,%rax
+  802b99:	00 00 00 
+  802b9c:	ff d0                	call   *%rax
+  802b9e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802ba1:	89 df                	mov    %ebx,%edi
+  802ba3:	48 b8 7a 26 80 00 00 	movabs $0x80267a,%rax
+  802baa:	00 00 00 
+  802bad:	ff d0                	call   *%rax
+
+    return res;
+  802baf:	44 89 e3             	mov    %r12d,%ebx
+}
+  802bb2:	89 d8                	mov    %ebx,%eax
+  802bb4:	5b                   	pop    %rbx
+  802bb5:	41 5c                	pop    %r12
+  802bb7:	5d                   	pop    %rbp
+  802bb8:	c3                   	ret
+
+0000000000802bb9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802bb9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802bc0:	00 00 00 
+  802bc3:	83 38 00             	cmpl   $0x0,(%rax)
+  802bc6:	74 0a                	je     802bd2 <fsenv+0x19>
+    return envid;
+}
+  802bc8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802bcf:	00 00 
+  802bd1:	c3                   	ret
+fsenv(void) {
+  802bd2:	55                   	push   %rbp
+  802bd3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802bd6:	bf 03 00 00 00       	mov    $0x3,%edi
+  802bdb:	48 b8 da 52 80 00 00 	movabs $0x8052da,%rax
+  802be2:	00 00 00 
+  802be5:	ff d0                	call   *%rax
+  802be7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802bee:	00 00 
+}
+  802bf0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802bf7:	00 00 
+  802bf9:	5d                   	pop    %rbp
+  802bfa:	c3                   	ret
+
+0000000000802bfb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802bfb:	55                   	push   %rbp
+  802bfc:	48 89 e5             	mov    %rsp,%rbp
+  802bff:	41 54                	push   %r12
+  802c01:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802c02:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802c07:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802c0c:	48 89 de             	mov    %rbx,%rsi
+  802c0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c14:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  802c1b:	00 00 00 
+  802c1e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802c20:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802c27:	00 00 00 
+  802c2a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802c30:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802c35:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802c3a:	48 89 de             	mov    %rbx,%rsi
+  802c3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c42:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  802c49:	00 00 00 
+  802c4c:	ff d0                	call   *%rax
+  802c4e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802c50:	85 c0                	test   %eax,%eax
+  802c52:	0f 88 a2 00 00 00    	js     802cfa <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802c58:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  802c5f:	00 00 00 
+  802c62:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802c68:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802c6d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802c6f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802c74:	49 bc 0c 4e 80 00 00 	movabs $0x804e0c,%r12
+  802c7b:	00 00 00 
+  802c7e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802c81:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802c86:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802c89:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+  802c95:	89 c7                	mov    %eax,%edi
+  802c97:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802c9d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802ca2:	48 89 da             	mov    %rbx,%rdx
+  802ca5:	be 09 00 00 00       	mov    $0x9,%esi
+  802caa:	48 b8 84 52 80 00 00 	movabs $0x805284,%rax
+  802cb1:	00 00 00 
+  802cb4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802cb6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802cbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cc0:	be 00 00 00 00       	mov    $0x0,%esi
+  802cc5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cca:	48 b8 60 52 80 00 00 	movabs $0x805260,%rax
+  802cd1:	00 00 00 
+  802cd4:	ff d0                	call   *%rax
+  802cd6:	89 c3                	mov    %eax,%ebx
+  802cd8:	85 c0                	test   %eax,%eax
+  802cda:	78 25                	js     802d01 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802cdc:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  802ce3:	00 00 00 
+  802ce6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802cec:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802cf3:	00 00 
+    return 0;
+  802cf5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802cfa:	89 d8                	mov    %ebx,%eax
+  802cfc:	5b                   	pop    %rbx
+  802cfd:	41 5c                	pop    %r12
+  802cff:	5d                   	pop    %rbp
+  802d00:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802d01:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802d06:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802d0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d10:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  802d17:	00 00 00 
+  802d1a:	ff d0                	call   *%rax
+        return res;
+  802d1c:	eb dc                	jmp    802cfa <fschan_setup+0xff>
+
+0000000000802d1e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802d1e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802d25:	00 00 00 
+  802d28:	80 38 00             	cmpb   $0x0,(%rax)
+  802d2b:	74 55                	je     802d82 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d2d:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  802d34:	00 00 00 
+  802d37:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802d3d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d42:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802d49:	00 00 00 
+  802d4c:	3b 0a                	cmp    (%rdx),%ecx
+  802d4e:	75 01                	jne    802d51 <fschan+0x33>
+}
+  802d50:	c3                   	ret
+fschan(void) {
+  802d51:	55                   	push   %rbp
+  802d52:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d55:	48 b8 fb 2b 80 00 00 	movabs $0x802bfb,%rax
+  802d5c:	00 00 00 
+  802d5f:	ff d0                	call   *%rax
+  802d61:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802d63:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802d68:	85 d2                	test   %edx,%edx
+  802d6a:	78 02                	js     802d6e <fschan+0x50>
+}
+  802d6c:	5d                   	pop    %rbp
+  802d6d:	c3                   	ret
+        fschan_enabled = 0;
+  802d6e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802d75:	00 00 00 
+  802d78:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d80:	eb ea                	jmp    802d6c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802d82:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d87:	c3                   	ret
+
+0000000000802d88 <fbuf>:
+fbuf(struct Fd *fd) {
+  802d88:	55                   	push   %rbp
+  802d89:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802d8c:	48 b8 87 24 80 00 00 	movabs $0x802487,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802d98:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d9d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802da1:	77 12                	ja     802db5 <fbuf+0x2d>
+  802da3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802da7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802dae:	00 00 00 
+  802db1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802db5:	48 89 d0             	mov    %rdx,%rax
+  802db8:	5d                   	pop    %rbp
+  802db9:	c3                   	ret
+
+0000000000802dba <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802dba:	55                   	push   %rbp
+  802dbb:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802dbe:	48 83 c7 40          	add    $0x40,%rdi
+  802dc2:	48 b8 46 4e 80 00 00 	movabs $0x804e46,%rax
+  802dc9:	00 00 00 
+  802dcc:	ff d0                	call   *%rax
+  802dce:	84 c0                	test   %al,%al
+  802dd0:	75 02                	jne    802dd4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802dd2:	5d                   	pop    %rbp
+  802dd3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802dd4:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  802ddb:	00 00 00 
+  802dde:	ff d0                	call   *%rax
+  802de0:	89 c7                	mov    %eax,%edi
+  802de2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802de8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ded:	ba 00 00 00 00       	mov    $0x0,%edx
+  802df2:	be 0a 00 00 00       	mov    $0xa,%esi
+  802df7:	48 b8 84 52 80 00 00 	movabs $0x805284,%rax
+  802dfe:	00 00 00 
+  802e01:	ff d0                	call   *%rax
+}
+  802e03:	eb cd                	jmp    802dd2 <fschan_publish+0x18>
+
+0000000000802e05 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802e05:	55                   	push   %rbp
+  802e06:	48 89 e5             	mov    %rsp,%rbp
+  802e09:	41 57                	push   %r15
+  802e0b:	41 56                	push   %r14
+  802e0d:	41 55                	push   %r13
+  802e0f:	41 54                	push   %r12
+  802e11:	53                   	push   %rbx
+  802e12:	48 83 ec 48          	sub    $0x48,%rsp
+  802e16:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802e1a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802e1e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802e21:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802e25:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802e28:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802e2f:	00 00 00 
+  802e32:	8b 02                	mov    (%rdx),%eax
+  802e34:	83 c0 01             	add    $0x1,%eax
+  802e37:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802e3c:	0f 44 c1             	cmove  %ecx,%eax
+  802e3f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802e41:	4d 85 c0             	test   %r8,%r8
+  802e44:	74 2c                	je     802e72 <fschan_rw+0x6d>
+  802e46:	45 89 ce             	mov    %r9d,%r14d
+  802e49:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802e50:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802e54:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802e5a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802e61:	00 
+  802e62:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802e68:	b8 01 00 00 00       	mov    $0x1,%eax
+  802e6d:	e9 41 01 00 00       	jmp    802fb3 <fschan_rw+0x1ae>
+  802e72:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802e76:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802e7a:	e9 9c 01 00 00       	jmp    80301b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802e7f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802e83:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802e86:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802e89:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802e8c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802e90:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802e94:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802e98:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802e9c:	48 89 da             	mov    %rbx,%rdx
+  802e9f:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  802ea6:	00 00 00 
+  802ea9:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802eab:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802eaf:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  802eb6:	00 00 00 
+  802eb9:	ff d0                	call   *%rax
+            queued += blk;
+  802ebb:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802ebe:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802ec2:	4d 39 fc             	cmp    %r15,%r12
+  802ec5:	73 6b                	jae    802f32 <fschan_rw+0x12d>
+  802ec7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802ecb:	77 65                	ja     802f32 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802ecd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ed1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802ed5:	48 b8 21 4e 80 00 00 	movabs $0x804e21,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802ee1:	4c 89 fb             	mov    %r15,%rbx
+  802ee4:	4c 29 e3             	sub    %r12,%rbx
+  802ee7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802eec:	48 39 d3             	cmp    %rdx,%rbx
+  802eef:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802ef3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802ef7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802efb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802eff:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802f02:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802f04:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802f0b:	00 00 00 
+  802f0e:	8b 09                	mov    (%rcx),%ecx
+  802f10:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802f13:	83 fe 03             	cmp    $0x3,%esi
+  802f16:	0f 85 63 ff ff ff    	jne    802e7f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802f1c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802f20:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802f23:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802f26:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802f29:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802f2d:	e9 79 ff ff ff       	jmp    802eab <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802f32:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f36:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802f3d:	48 89 df             	mov    %rbx,%rdi
+  802f40:	48 b8 e4 4e 80 00 00 	movabs $0x804ee4,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802f4c:	48 89 df             	mov    %rbx,%rdi
+  802f4f:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+  802f5b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802f5f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802f63:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802f67:	75 25                	jne    802f8e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802f69:	8b 40 04             	mov    0x4(%rax),%eax
+  802f6c:	85 c0                	test   %eax,%eax
+  802f6e:	0f 88 86 00 00 00    	js     802ffa <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802f74:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802f78:	74 5b                	je     802fd5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802f7a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802f7e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802f82:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802f86:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802f8a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802f8e:	48 89 df             	mov    %rbx,%rdi
+  802f91:	48 b8 99 4e 80 00 00 	movabs $0x804e99,%rax
+  802f98:	00 00 00 
+  802f9b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802f9d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802fa1:	83 f0 01             	xor    $0x1,%eax
+  802fa4:	4d 39 fc             	cmp    %r15,%r12
+  802fa7:	0f 92 c2             	setb   %dl
+  802faa:	84 c2                	test   %al,%dl
+  802fac:	75 05                	jne    802fb3 <fschan_rw+0x1ae>
+  802fae:	45 85 ed             	test   %r13d,%r13d
+  802fb1:	74 50                	je     803003 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802fb3:	4d 39 fc             	cmp    %r15,%r12
+  802fb6:	0f 92 c1             	setb   %cl
+  802fb9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802fbd:	0f 96 c2             	setbe  %dl
+  802fc0:	84 d1                	test   %dl,%cl
+  802fc2:	0f 84 6a ff ff ff    	je     802f32 <fschan_rw+0x12d>
+  802fc8:	84 c0                	test   %al,%al
+  802fca:	0f 85 fd fe ff ff    	jne    802ecd <fschan_rw+0xc8>
+  802fd0:	e9 5d ff ff ff       	jmp    802f32 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802fd5:	48 63 d0             	movslq %eax,%rdx
+  802fd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802fdc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802fe0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802fe4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802fe8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802fec:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  802ff3:	00 00 00 
+  802ff6:	ff d0                	call   *%rax
+  802ff8:	eb 80                	jmp    802f7a <fschan_rw+0x175>
+                err = msg->fm_res;
+  802ffa:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802ffd:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  803001:	eb 8b                	jmp    802f8e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  803003:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  803008:	0f 85 68 fe ff ff    	jne    802e76 <fschan_rw+0x71>
+  80300e:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803011:	85 c0                	test   %eax,%eax
+  803013:	0f 84 5d fe ff ff    	je     802e76 <fschan_rw+0x71>
+  803019:	48 98                	cltq
+}
+  80301b:	48 83 c4 48          	add    $0x48,%rsp
+  80301f:	5b                   	pop    %rbx
+  803020:	41 5c                	pop    %r12
+  803022:	41 5d                	pop    %r13
+  803024:	41 5e                	pop    %r14
+  803026:	41 5f                	pop    %r15
+  803028:	5d                   	pop    %rbp
+  803029:	c3                   	ret
+
+000000000080302a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80302a:	55                   	push   %rbp
+  80302b:	48 89 e5             	mov    %rsp,%rbp
+  80302e:	41 56                	push   %r14
+  803030:	41 55                	push   %r13
+  803032:	41 54                	push   %r12
+  803034:	53                   	push   %rbx
+  803035:	48 83 ec 10          	sub    $0x10,%rsp
+  803039:	49 89 fe             	mov    %rdi,%r14
+  80303c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80303f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  803043:	48 29 f3             	sub    %rsi,%rbx
+  803046:	48 39 d3             	cmp    %rdx,%rbx
+  803049:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80304d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  803054:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  803055:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80305a:	49 bd a3 4c 80 00 00 	movabs $0x804ca3,%r13
+  803061:	00 00 00 
+  803064:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80306b:	76 1e                	jbe    80308b <mmap_fault+0x61>
+  80306d:	4c 01 e7             	add    %r12,%rdi
+  803070:	41 ff d5             	call   *%r13
+  803073:	84 c0                	test   %al,%al
+  803075:	75 14                	jne    80308b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  803077:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80307b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  803082:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  803086:	48 39 df             	cmp    %rbx,%rdi
+  803089:	72 e2                	jb     80306d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80308b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  803092:	00 00 00 
+  803095:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80309c:	00 00 00 
+  80309f:	4c 89 f0             	mov    %r14,%rax
+  8030a2:	48 29 d0             	sub    %rdx,%rax
+  8030a5:	48 c1 f8 03          	sar    $0x3,%rax
+  8030a9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8030b0:	aa aa aa 
+  8030b3:	48 0f af c2          	imul   %rdx,%rax
+  8030b7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8030bb:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8030c0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8030c4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8030c6:	44 89 e0             	mov    %r12d,%eax
+  8030c9:	41 03 46 10          	add    0x10(%r14),%eax
+  8030cd:	41 2b 06             	sub    (%r14),%eax
+  8030d0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8030d3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8030d7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8030db:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8030df:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8030e2:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+  8030ee:	89 c7                	mov    %eax,%edi
+  8030f0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8030f6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030fb:	48 89 da             	mov    %rbx,%rdx
+  8030fe:	be 0f 00 00 00       	mov    $0xf,%esi
+  803103:	48 b8 84 52 80 00 00 	movabs $0x805284,%rax
+  80310a:	00 00 00 
+  80310d:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80310f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803114:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803118:	4c 89 e6             	mov    %r12,%rsi
+  80311b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803120:	48 b8 60 52 80 00 00 	movabs $0x805260,%rax
+  803127:	00 00 00 
+  80312a:	ff d0                	call   *%rax
+  80312c:	48 98                	cltq
+}
+  80312e:	48 83 c4 10          	add    $0x10,%rsp
+  803132:	5b                   	pop    %rbx
+  803133:	41 5c                	pop    %r12
+  803135:	41 5d                	pop    %r13
+  803137:	41 5e                	pop    %r14
+  803139:	5d                   	pop    %rbp
+  80313a:	c3                   	ret
+
+000000000080313b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80313b:	48 8b 37             	mov    (%rdi),%rsi
+  80313e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  803145:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80314c:	00 00 00 
+  80314f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803154:	eb 0f                	jmp    803165 <mmap_pgfault+0x2a>
+  803156:	c3                   	ret
+  803157:	48 83 c1 01          	add    $0x1,%rcx
+  80315b:	48 83 c2 18          	add    $0x18,%rdx
+  80315f:	48 83 f9 20          	cmp    $0x20,%rcx
+  803163:	74 6e                	je     8031d3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  803165:	48 8b 02             	mov    (%rdx),%rax
+  803168:	48 83 e8 01          	sub    $0x1,%rax
+  80316c:	48 39 f0             	cmp    %rsi,%rax
+  80316f:	73 e6                	jae    803157 <mmap_pgfault+0x1c>
+  803171:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  803175:	73 e0                	jae    803157 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  803177:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80317b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803180:	f6 c2 01             	test   $0x1,%dl
+  803183:	75 d1                	jne    803156 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  803185:	f6 c2 02             	test   $0x2,%dl
+  803188:	74 1a                	je     8031a4 <mmap_pgfault+0x69>
+  80318a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80318e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803193:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80319a:	00 00 00 
+  80319d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8031a2:	74 35                	je     8031d9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8031a4:	55                   	push   %rbp
+  8031a5:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8031a8:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8031ac:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031b3:	00 00 00 
+  8031b6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8031ba:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8031bf:	48 b8 2a 30 80 00 00 	movabs $0x80302a,%rax
+  8031c6:	00 00 00 
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	48 85 c0             	test   %rax,%rax
+  8031ce:	0f 9f c0             	setg   %al
+}
+  8031d1:	5d                   	pop    %rbp
+  8031d2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8031d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8031d8:	c3                   	ret
+}
+  8031d9:	c3                   	ret
+
+00000000008031da <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8031da:	55                   	push   %rbp
+  8031db:	48 89 e5             	mov    %rsp,%rbp
+  8031de:	41 54                	push   %r12
+  8031e0:	53                   	push   %rbx
+  8031e1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031e4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031eb:	00 00 00 
+  8031ee:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8031f3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8031f7:	74 15                	je     80320e <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8031f9:	48 83 c3 01          	add    $0x1,%rbx
+  8031fd:	48 83 c0 18          	add    $0x18,%rax
+  803201:	48 83 fb 20          	cmp    $0x20,%rbx
+  803205:	75 ec                	jne    8031f3 <mmap_alloc+0x19>
+    return NULL;
+  803207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80320c:	eb 52                	jmp    803260 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80320e:	4c 89 e7             	mov    %r12,%rdi
+  803211:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  803218:	00 00 00 
+  80321b:	ff d0                	call   *%rax
+  80321d:	41 89 c1             	mov    %eax,%r9d
+  803220:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  803227:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80322b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803231:	ba 00 00 00 00       	mov    $0x0,%edx
+  803236:	4c 89 e6             	mov    %r12,%rsi
+  803239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80323e:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  803245:	00 00 00 
+  803248:	ff d0                	call   *%rax
+  80324a:	85 c0                	test   %eax,%eax
+  80324c:	78 17                	js     803265 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80324e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  803252:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803259:	00 00 00 
+  80325c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  803260:	5b                   	pop    %rbx
+  803261:	41 5c                	pop    %r12
+  803263:	5d                   	pop    %rbp
+  803264:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  803265:	b8 00 00 00 00       	mov    $0x0,%eax
+  80326a:	eb f4                	jmp    803260 <mmap_alloc+0x86>
+
+000000000080326c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80326c:	55                   	push   %rbp
+  80326d:	48 89 e5             	mov    %rsp,%rbp
+  803270:	41 56                	push   %r14
+  803272:	41 55                	push   %r13
+  803274:	41 54                	push   %r12
+  803276:	53                   	push   %rbx
+  803277:	48 83 ec 10          	sub    $0x10,%rsp
+  80327b:	41 89 fc             	mov    %edi,%r12d
+  80327e:	49 89 f5             	mov    %rsi,%r13
+  803281:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  803284:	48 89 f0             	mov    %rsi,%rax
+  803287:	48 09 d0             	or     %rdx,%rax
+  80328a:	75 0d                	jne    803299 <fsipc+0x2d>
+  80328c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80328f:	83 f8 04             	cmp    $0x4,%eax
+  803292:	76 7d                	jbe    803311 <fsipc+0xa5>
+  803294:	83 ff 0d             	cmp    $0xd,%edi
+  803297:	74 78                	je     803311 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  803299:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  8032a0:	00 00 00 
+  8032a3:	ff d0                	call   *%rax
+  8032a5:	89 c7                	mov    %eax,%edi
+  8032a7:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8032ae:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8032b5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8032bc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8032c2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8032c9:	00 00 00 
+  8032cc:	44 89 e6             	mov    %r12d,%esi
+  8032cf:	48 b8 84 52 80 00 00 	movabs $0x805284,%rax
+  8032d6:	00 00 00 
+  8032d9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8032db:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8032e2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8032e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8032e8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8032ec:	4c 89 ee             	mov    %r13,%rsi
+  8032ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032f4:	48 b8 60 52 80 00 00 	movabs $0x805260,%rax
+  8032fb:	00 00 00 
+  8032fe:	ff d0                	call   *%rax
+  803300:	89 c3                	mov    %eax,%ebx
+}
+  803302:	89 d8                	mov    %ebx,%eax
+  803304:	48 83 c4 10          	add    $0x10,%rsp
+  803308:	5b                   	pop    %rbx
+  803309:	41 5c                	pop    %r12
+  80330b:	41 5d                	pop    %r13
+  80330d:	41 5e                	pop    %r14
+  80330f:	5d                   	pop    %rbp
+  803310:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  803311:	48 b8 1e 2d 80 00 00 	movabs $0x802d1e,%rax
+  803318:	00 00 00 
+  80331b:	ff d0                	call   *%rax
+  80331d:	49 89 c6             	mov    %rax,%r14
+  803320:	48 85 c0             	test   %rax,%rax
+  803323:	0f 84 70 ff ff ff    	je     803299 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  803329:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80332d:	48 b8 21 4e 80 00 00 	movabs $0x804e21,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  803339:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80333c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  803343:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  803347:	ba 10 00 00 00       	mov    $0x10,%edx
+  80334c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  803353:	00 00 00 
+  803356:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  803362:	4c 89 f7             	mov    %r14,%rdi
+  803365:	48 b8 ba 2d 80 00 00 	movabs $0x802dba,%rax
+  80336c:	00 00 00 
+  80336f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  803371:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  803378:	4c 89 f7             	mov    %r14,%rdi
+  80337b:	48 b8 e4 4e 80 00 00 	movabs $0x804ee4,%rax
+  803382:	00 00 00 
+  803385:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  803387:	4c 89 f7             	mov    %r14,%rdi
+  80338a:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  803391:	00 00 00 
+  803394:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  803396:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  803399:	41 83 fc 05          	cmp    $0x5,%r12d
+  80339d:	75 04                	jne    8033a3 <fsipc+0x137>
+  80339f:	85 db                	test   %ebx,%ebx
+  8033a1:	79 14                	jns    8033b7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8033a3:	4c 89 f7             	mov    %r14,%rdi
+  8033a6:	48 b8 99 4e 80 00 00 	movabs $0x804e99,%rax
+  8033ad:	00 00 00 
+  8033b0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8033b2:	e9 4b ff ff ff       	jmp    803302 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8033b7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8033bb:	ba 88 00 00 00       	mov    $0x88,%edx
+  8033c0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033c7:	00 00 00 
+  8033ca:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  8033d1:	00 00 00 
+  8033d4:	ff d0                	call   *%rax
+  8033d6:	eb cb                	jmp    8033a3 <fsipc+0x137>
+
+00000000008033d8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8033d8:	55                   	push   %rbp
+  8033d9:	48 89 e5             	mov    %rsp,%rbp
+  8033dc:	41 57                	push   %r15
+  8033de:	41 56                	push   %r14
+  8033e0:	41 55                	push   %r13
+  8033e2:	41 54                	push   %r12
+  8033e4:	53                   	push   %rbx
+  8033e5:	48 83 ec 18          	sub    $0x18,%rsp
+  8033e9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8033ed:	49 89 f6             	mov    %rsi,%r14
+  8033f0:	49 89 d4             	mov    %rdx,%r12
+  8033f3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8033f6:	48 b8 1e 2d 80 00 00 	movabs $0x802d1e,%rax
+  8033fd:	00 00 00 
+  803400:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  803402:	48 85 c0             	test   %rax,%rax
+  803405:	0f 85 96 00 00 00    	jne    8034a1 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80340b:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803412:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803413:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80341a:	00 00 00 
+    while (n) {
+  80341d:	4d 85 e4             	test   %r12,%r12
+  803420:	74 79                	je     80349b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  803422:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  803427:	49 39 dc             	cmp    %rbx,%r12
+  80342a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80342e:	48 89 da             	mov    %rbx,%rdx
+  803431:	4c 89 f6             	mov    %r14,%rsi
+  803434:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80343b:	00 00 00 
+  80343e:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  803445:	00 00 00 
+  803448:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80344a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80344e:	8b 40 0c             	mov    0xc(%rax),%eax
+  803451:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  803454:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  803457:	44 01 e8             	add    %r13d,%eax
+  80345a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80345e:	41 0f 44 c5          	cmove  %r13d,%eax
+  803462:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  803466:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80346a:	48 89 da             	mov    %rbx,%rdx
+  80346d:	be 00 00 00 00       	mov    $0x0,%esi
+  803472:	bf 04 00 00 00       	mov    $0x4,%edi
+  803477:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  80347e:	00 00 00 
+  803481:	ff d0                	call   *%rax
+        if (res < 0)
+  803483:	85 c0                	test   %eax,%eax
+  803485:	78 4a                	js     8034d1 <devfile_write_direct+0xf9>
+        buf += res;
+  803487:	48 98                	cltq
+  803489:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80348c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  803490:	49 29 c4             	sub    %rax,%r12
+  803493:	75 8d                	jne    803422 <devfile_write_direct+0x4a>
+    return write;
+  803495:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803499:	eb 27                	jmp    8034c2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80349b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80349f:	eb f4                	jmp    803495 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8034a1:	45 89 e9             	mov    %r13d,%r9d
+  8034a4:	4d 89 e0             	mov    %r12,%r8
+  8034a7:	4c 89 f1             	mov    %r14,%rcx
+  8034aa:	ba 04 00 00 00       	mov    $0x4,%edx
+  8034af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8034b3:	48 89 c7             	mov    %rax,%rdi
+  8034b6:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  8034bd:	00 00 00 
+  8034c0:	ff d0                	call   *%rax
+}
+  8034c2:	48 83 c4 18          	add    $0x18,%rsp
+  8034c6:	5b                   	pop    %rbx
+  8034c7:	41 5c                	pop    %r12
+  8034c9:	41 5d                	pop    %r13
+  8034cb:	41 5e                	pop    %r14
+  8034cd:	41 5f                	pop    %r15
+  8034cf:	5d                   	pop    %rbp
+  8034d0:	c3                   	ret
+            return res;
+  8034d1:	48 98                	cltq
+  8034d3:	eb ed                	jmp    8034c2 <devfile_write_direct+0xea>
+
+00000000008034d5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	41 54                	push   %r12
+  8034db:	53                   	push   %rbx
+  8034dc:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8034df:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  8034e6:	00 00 00 
+  8034e9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8034eb:	48 85 c0             	test   %rax,%rax
+  8034ee:	74 71                	je     803561 <fbuf_flush+0x8c>
+  8034f0:	48 89 c3             	mov    %rax,%rbx
+  8034f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034f8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8034fc:	75 05                	jne    803503 <fbuf_flush+0x2e>
+}
+  8034fe:	5b                   	pop    %rbx
+  8034ff:	41 5c                	pop    %r12
+  803501:	5d                   	pop    %rbp
+  803502:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  803503:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  803506:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80350a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803511:	00 00 00 
+  803514:	48 89 de             	mov    %rbx,%rsi
+  803517:	48 29 c6             	sub    %rax,%rsi
+  80351a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80351e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803525:	aa aa aa 
+  803528:	48 0f af f0          	imul   %rax,%rsi
+  80352c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  803530:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803535:	48 01 c6             	add    %rax,%rsi
+  803538:	4c 89 e7             	mov    %r12,%rdi
+  80353b:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  803547:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80354b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803552:	00 
+    return res < 0 ? res : 0;
+  803553:	48 85 c0             	test   %rax,%rax
+  803556:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80355f:	eb 9d                	jmp    8034fe <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  803561:	b8 00 00 00 00       	mov    $0x0,%eax
+  803566:	eb 96                	jmp    8034fe <fbuf_flush+0x29>
+
+0000000000803568 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  803568:	55                   	push   %rbp
+  803569:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80356c:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  803573:	00 00 00 
+  803576:	ff d0                	call   *%rax
+}
+  803578:	5d                   	pop    %rbp
+  803579:	c3                   	ret
+
+000000000080357a <devfile_write>:
+    if (!fd || !buf)
+  80357a:	48 85 ff             	test   %rdi,%rdi
+  80357d:	0f 84 d3 01 00 00    	je     803756 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  803583:	55                   	push   %rbp
+  803584:	48 89 e5             	mov    %rsp,%rbp
+  803587:	41 57                	push   %r15
+  803589:	41 56                	push   %r14
+  80358b:	41 55                	push   %r13
+  80358d:	41 54                	push   %r12
+  80358f:	53                   	push   %rbx
+  803590:	48 83 ec 08          	sub    $0x8,%rsp
+  803594:	49 89 fc             	mov    %rdi,%r12
+  803597:	49 89 f6             	mov    %rsi,%r14
+  80359a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80359d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8035a2:	48 85 f6             	test   %rsi,%rsi
+  8035a5:	0f 84 9c 01 00 00    	je     803747 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8035ab:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  8035b2:	00 00 00 
+  8035b5:	ff d0                	call   *%rax
+  8035b7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8035ba:	48 85 c0             	test   %rax,%rax
+  8035bd:	0f 84 a2 00 00 00    	je     803665 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8035c3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8035c8:	4c 89 e7             	mov    %r12,%rdi
+  8035cb:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  8035d2:	00 00 00 
+  8035d5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8035d7:	83 f8 02             	cmp    $0x2,%eax
+  8035da:	0f 8f 85 00 00 00    	jg     803665 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8035e0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035e7:	00 00 00 
+  8035ea:	4d 89 ef             	mov    %r13,%r15
+  8035ed:	49 29 c7             	sub    %rax,%r15
+  8035f0:	49 c1 ff 03          	sar    $0x3,%r15
+  8035f4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8035fb:	aa aa aa 
+  8035fe:	4c 0f af f8          	imul   %rax,%r15
+  803602:	49 c1 e7 0e          	shl    $0xe,%r15
+  803606:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80360b:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  80360e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  803613:	0f 84 d7 00 00 00    	je     8036f0 <devfile_write+0x176>
+  803619:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80361d:	89 c2                	mov    %eax,%edx
+  80361f:	41 03 55 0c          	add    0xc(%r13),%edx
+  803623:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  803628:	75 0f                	jne    803639 <devfile_write+0xbf>
+  80362a:	48 01 d8             	add    %rbx,%rax
+  80362d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  803633:	0f 86 92 00 00 00    	jbe    8036cb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  803639:	4c 89 e7             	mov    %r12,%rdi
+  80363c:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  803643:	00 00 00 
+  803646:	ff d0                	call   *%rax
+  803648:	85 c0                	test   %eax,%eax
+  80364a:	78 52                	js     80369e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80364c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  803653:	77 7f                	ja     8036d4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  803655:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80365a:	0f 85 c2 00 00 00    	jne    803722 <devfile_write+0x1a8>
+  803660:	e9 94 00 00 00       	jmp    8036f9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  803665:	4c 89 e7             	mov    %r12,%rdi
+  803668:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  80366f:	00 00 00 
+  803672:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803674:	85 c0                	test   %eax,%eax
+  803676:	79 07                	jns    80367f <devfile_write+0x105>
+  803678:	48 98                	cltq
+  80367a:	e9 c8 00 00 00       	jmp    803747 <devfile_write+0x1cd>
+  80367f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803684:	48 89 da             	mov    %rbx,%rdx
+  803687:	4c 89 f6             	mov    %r14,%rsi
+  80368a:	4c 89 e7             	mov    %r12,%rdi
+  80368d:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  803694:	00 00 00 
+  803697:	ff d0                	call   *%rax
+  803699:	e9 a9 00 00 00       	jmp    803747 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80369e:	48 98                	cltq
+  8036a0:	e9 a2 00 00 00       	jmp    803747 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8036a5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8036aa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8036af:	4c 89 fe             	mov    %r15,%rsi
+  8036b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036b7:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  8036be:	00 00 00 
+  8036c1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8036c3:	85 c0                	test   %eax,%eax
+  8036c5:	79 45                	jns    80370c <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8036c7:	48 98                	cltq
+  8036c9:	eb 7c                	jmp    803747 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8036cb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8036d2:	76 4e                	jbe    803722 <devfile_write+0x1a8>
+  8036d4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8036d9:	48 89 da             	mov    %rbx,%rdx
+  8036dc:	4c 89 f6             	mov    %r14,%rsi
+  8036df:	4c 89 e7             	mov    %r12,%rdi
+  8036e2:	48 b8 d8 33 80 00 00 	movabs $0x8033d8,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+  8036ee:	eb 57                	jmp    803747 <devfile_write+0x1cd>
+  8036f0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8036f7:	77 db                	ja     8036d4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8036f9:	4c 89 ff             	mov    %r15,%rdi
+  8036fc:	48 b8 a3 4c 80 00 00 	movabs $0x804ca3,%rax
+  803703:	00 00 00 
+  803706:	ff d0                	call   *%rax
+  803708:	84 c0                	test   %al,%al
+  80370a:	74 99                	je     8036a5 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80370c:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  803711:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803716:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80371a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  803721:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  803722:	4c 89 ff             	mov    %r15,%rdi
+  803725:	49 03 7d 10          	add    0x10(%r13),%rdi
+  803729:	48 89 da             	mov    %rbx,%rdx
+  80372c:	4c 89 f6             	mov    %r14,%rsi
+  80372f:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  803736:	00 00 00 
+  803739:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80373b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80373f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  803744:	48 89 d8             	mov    %rbx,%rax
+}
+  803747:	48 83 c4 08          	add    $0x8,%rsp
+  80374b:	5b                   	pop    %rbx
+  80374c:	41 5c                	pop    %r12
+  80374e:	41 5d                	pop    %r13
+  803750:	41 5e                	pop    %r14
+  803752:	41 5f                	pop    %r15
+  803754:	5d                   	pop    %rbp
+  803755:	c3                   	ret
+        return E_INVAL;
+  803756:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80375b:	c3                   	ret
+
+000000000080375c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80375c:	55                   	push   %rbp
+  80375d:	48 89 e5             	mov    %rsp,%rbp
+  803760:	41 54                	push   %r12
+  803762:	53                   	push   %rbx
+  803763:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  803766:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  80376d:	00 00 00 
+  803770:	ff d0                	call   *%rax
+  803772:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  803775:	48 89 df             	mov    %rbx,%rdi
+  803778:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  80377f:	00 00 00 
+  803782:	ff d0                	call   *%rax
+  803784:	48 85 c0             	test   %rax,%rax
+  803787:	74 17                	je     8037a0 <devfile_flush+0x44>
+  803789:	48 89 df             	mov    %rbx,%rdi
+  80378c:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803793:	00 00 00 
+  803796:	ff d0                	call   *%rax
+  803798:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80379f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8037a0:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8037a3:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8037aa:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8037ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8037b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8037b6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8037bb:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  8037c2:	00 00 00 
+  8037c5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8037c7:	45 85 e4             	test   %r12d,%r12d
+  8037ca:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8037ce:	5b                   	pop    %rbx
+  8037cf:	41 5c                	pop    %r12
+  8037d1:	5d                   	pop    %rbp
+  8037d2:	c3                   	ret
+
+00000000008037d3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8037d3:	55                   	push   %rbp
+  8037d4:	48 89 e5             	mov    %rsp,%rbp
+  8037d7:	41 57                	push   %r15
+  8037d9:	41 56                	push   %r14
+  8037db:	41 55                	push   %r13
+  8037dd:	41 54                	push   %r12
+  8037df:	53                   	push   %rbx
+  8037e0:	48 83 ec 38          	sub    $0x38,%rsp
+  8037e4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8037e8:	49 89 f7             	mov    %rsi,%r15
+  8037eb:	48 89 d3             	mov    %rdx,%rbx
+  8037ee:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8037f1:	48 b8 1e 2d 80 00 00 	movabs $0x802d1e,%rax
+  8037f8:	00 00 00 
+  8037fb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8037fd:	48 85 c0             	test   %rax,%rax
+  803800:	75 20                	jne    803822 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803802:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  803807:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  80380e:	00 
+    while (n) {
+  80380f:	48 85 db             	test   %rbx,%rbx
+  803812:	0f 85 df 00 00 00    	jne    8038f7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  803818:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80381c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803820:	eb 21                	jmp    803843 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803822:	45 89 f1             	mov    %r14d,%r9d
+  803825:	49 89 d8             	mov    %rbx,%r8
+  803828:	4c 89 f9             	mov    %r15,%rcx
+  80382b:	ba 03 00 00 00       	mov    $0x3,%edx
+  803830:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803834:	48 89 c7             	mov    %rax,%rdi
+  803837:	48 b8 05 2e 80 00 00 	movabs $0x802e05,%rax
+  80383e:	00 00 00 
+  803841:	ff d0                	call   *%rax
+}
+  803843:	48 83 c4 38          	add    $0x38,%rsp
+  803847:	5b                   	pop    %rbx
+  803848:	41 5c                	pop    %r12
+  80384a:	41 5d                	pop    %r13
+  80384c:	41 5e                	pop    %r14
+  80384e:	41 5f                	pop    %r15
+  803850:	5d                   	pop    %rbp
+  803851:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803852:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803856:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80385c:	75 1e                	jne    80387c <devfile_read_direct+0xa9>
+  80385e:	e9 e2 00 00 00       	jmp    803945 <devfile_read_direct+0x172>
+            if (!res) return read;
+  803863:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803867:	eb da                	jmp    803843 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  803869:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  80386d:	0f 85 d0 01 00 00    	jne    803a43 <devfile_read_direct+0x270>
+            map = 0;
+  803873:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803877:	eb 03                	jmp    80387c <devfile_read_direct+0xa9>
+  803879:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80387c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803881:	48 39 d3             	cmp    %rdx,%rbx
+  803884:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803888:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80388c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80388f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  803896:	00 00 00 
+  803899:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  80389b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  80389f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8038a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8038a8:	bf 03 00 00 00       	mov    $0x3,%edi
+  8038ad:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  8038b4:	00 00 00 
+  8038b7:	ff d0                	call   *%rax
+        if (res <= 0)
+  8038b9:	85 c0                	test   %eax,%eax
+  8038bb:	0f 8e 63 01 00 00    	jle    803a24 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8038c1:	4c 63 e0             	movslq %eax,%r12
+  8038c4:	4c 89 e2             	mov    %r12,%rdx
+  8038c7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8038ce:	00 00 00 
+  8038d1:	4c 89 ff             	mov    %r15,%rdi
+  8038d4:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  8038db:	00 00 00 
+  8038de:	ff d0                	call   *%rax
+        buf += res;
+  8038e0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  8038e3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  8038e6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  8038ea:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  8038ee:	48 85 db             	test   %rbx,%rbx
+  8038f1:	0f 84 25 ff ff ff    	je     80381c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  8038f7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  8038fa:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  8038fe:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803902:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803906:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  80390d:	0f 97 c2             	seta   %dl
+  803910:	20 c2                	and    %al,%dl
+  803912:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803915:	0f 84 5e ff ff ff    	je     803879 <devfile_read_direct+0xa6>
+  80391b:	4c 89 fa             	mov    %r15,%rdx
+  80391e:	4d 89 fd             	mov    %r15,%r13
+  803921:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  803928:	0f 85 4e ff ff ff    	jne    80387c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  80392e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803932:	0f 84 1a ff ff ff    	je     803852 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803938:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  80393f:	0f 85 37 ff ff ff    	jne    80387c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  803945:	48 89 d8             	mov    %rbx,%rax
+  803948:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  80394e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  803953:	48 39 c8             	cmp    %rcx,%rax
+  803956:	48 0f 47 c1          	cmova  %rcx,%rax
+  80395a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  80395e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  803962:	49 89 d4             	mov    %rdx,%r12
+  803965:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  803969:	48 b8 44 4c 80 00 00 	movabs $0x804c44,%rax
+  803970:	00 00 00 
+  803973:	ff d0                	call   *%rax
+  803975:	a8 40                	test   $0x40,%al
+  803977:	0f 85 b9 00 00 00    	jne    803a36 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  80397d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803984:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803988:	49 39 c5             	cmp    %rax,%r13
+  80398b:	72 d8                	jb     803965 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  80398d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803991:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803998:	00 00 00 
+  80399b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  80399f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8039a2:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8039a4:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8039a8:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8039ac:	48 b8 b9 2b 80 00 00 	movabs $0x802bb9,%rax
+  8039b3:	00 00 00 
+  8039b6:	ff d0                	call   *%rax
+  8039b8:	89 c7                	mov    %eax,%edi
+  8039ba:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8039c0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039c5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8039cc:	00 00 00 
+  8039cf:	be 0e 00 00 00       	mov    $0xe,%esi
+  8039d4:	48 b8 84 52 80 00 00 	movabs $0x805284,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  8039e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8039e5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  8039e9:	4c 89 fe             	mov    %r15,%rsi
+  8039ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039f1:	48 b8 60 52 80 00 00 	movabs $0x805260,%rax
+  8039f8:	00 00 00 
+  8039fb:	ff d0                	call   *%rax
+  8039fd:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803a00:	48 85 d2             	test   %rdx,%rdx
+  803a03:	0f 84 5a fe ff ff    	je     803863 <devfile_read_direct+0x90>
+            if (res > 0) {
+  803a09:	0f 8e 5a fe ff ff    	jle    803869 <devfile_read_direct+0x96>
+                buf += res;
+  803a0f:	48 98                	cltq
+  803a11:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803a14:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803a17:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803a1b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803a1f:	e9 ca fe ff ff       	jmp    8038ee <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803a24:	41 89 c5             	mov    %eax,%r13d
+  803a27:	48 98                	cltq
+  803a29:	45 85 ed             	test   %r13d,%r13d
+  803a2c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  803a31:	e9 0d fe ff ff       	jmp    803843 <devfile_read_direct+0x70>
+            map = 0;
+  803a36:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803a3a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803a3e:	e9 39 fe ff ff       	jmp    80387c <devfile_read_direct+0xa9>
+  803a43:	48 89 d0             	mov    %rdx,%rax
+  803a46:	e9 f8 fd ff ff       	jmp    803843 <devfile_read_direct+0x70>
+
+0000000000803a4b <devfile_read>:
+    if (!fd || !buf)
+  803a4b:	48 85 ff             	test   %rdi,%rdi
+  803a4e:	0f 84 21 02 00 00    	je     803c75 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803a54:	55                   	push   %rbp
+  803a55:	48 89 e5             	mov    %rsp,%rbp
+  803a58:	41 57                	push   %r15
+  803a5a:	41 56                	push   %r14
+  803a5c:	41 55                	push   %r13
+  803a5e:	41 54                	push   %r12
+  803a60:	53                   	push   %rbx
+  803a61:	48 83 ec 28          	sub    $0x28,%rsp
+  803a65:	48 89 fb             	mov    %rdi,%rbx
+  803a68:	49 89 f4             	mov    %rsi,%r12
+  803a6b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803a6e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803a73:	48 85 f6             	test   %rsi,%rsi
+  803a76:	74 4b                	je     803ac3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803a78:	48 b8 88 2d 80 00 00 	movabs $0x802d88,%rax
+  803a7f:	00 00 00 
+  803a82:	ff d0                	call   *%rax
+  803a84:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803a87:	48 85 c0             	test   %rax,%rax
+  803a8a:	74 22                	je     803aae <devfile_read+0x63>
+  803a8c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  803a93:	77 19                	ja     803aae <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803a95:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a9a:	48 89 df             	mov    %rbx,%rdi
+  803a9d:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  803aa4:	00 00 00 
+  803aa7:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803aa9:	83 f8 02             	cmp    $0x2,%eax
+  803aac:	7e 40                	jle    803aee <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803aae:	48 89 df             	mov    %rbx,%rdi
+  803ab1:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  803ab8:	00 00 00 
+  803abb:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803abd:	85 c0                	test   %eax,%eax
+  803abf:	79 11                	jns    803ad2 <devfile_read+0x87>
+  803ac1:	48 98                	cltq
+}
+  803ac3:	48 83 c4 28          	add    $0x28,%rsp
+  803ac7:	5b                   	pop    %rbx
+  803ac8:	41 5c                	pop    %r12
+  803aca:	41 5d                	pop    %r13
+  803acc:	41 5e                	pop    %r14
+  803ace:	41 5f                	pop    %r15
+  803ad0:	5d                   	pop    %rbp
+  803ad1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803ad2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803ad7:	4c 89 ea             	mov    %r13,%rdx
+  803ada:	4c 89 e6             	mov    %r12,%rsi
+  803add:	48 89 df             	mov    %rbx,%rdi
+  803ae0:	48 b8 d3 37 80 00 00 	movabs $0x8037d3,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+  803aec:	eb d5                	jmp    803ac3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803aee:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803af2:	48 89 df             	mov    %rbx,%rdi
+  803af5:	48 b8 d5 34 80 00 00 	movabs $0x8034d5,%rax
+  803afc:	00 00 00 
+  803aff:	ff d0                	call   *%rax
+  803b01:	85 c0                	test   %eax,%eax
+  803b03:	0f 88 33 01 00 00    	js     803c3c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803b09:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  803b10:	00 00 00 
+  803b13:	4c 89 f0             	mov    %r14,%rax
+  803b16:	48 29 d0             	sub    %rdx,%rax
+  803b19:	48 c1 f8 03          	sar    $0x3,%rax
+  803b1d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803b24:	aa aa aa 
+  803b27:	48 0f af c2          	imul   %rdx,%rax
+  803b2b:	48 c1 e0 0e          	shl    $0xe,%rax
+  803b2f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803b33:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803b36:	41 39 06             	cmp    %eax,(%r14)
+  803b39:	75 0d                	jne    803b48 <devfile_read+0xfd>
+  803b3b:	8b 43 10             	mov    0x10(%rbx),%eax
+  803b3e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803b42:	0f 84 fb 00 00 00    	je     803c43 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803b48:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803b4d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803b51:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b58:	48 89 c7             	mov    %rax,%rdi
+  803b5b:	48 b8 a3 4c 80 00 00 	movabs $0x804ca3,%rax
+  803b62:	00 00 00 
+  803b65:	ff d0                	call   *%rax
+  803b67:	84 c0                	test   %al,%al
+  803b69:	75 27                	jne    803b92 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803b6b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803b70:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803b75:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b79:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b7e:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  803b85:	00 00 00 
+  803b88:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803b8a:	85 c0                	test   %eax,%eax
+  803b8c:	0f 88 dc 00 00 00    	js     803c6e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803b92:	44 89 f8             	mov    %r15d,%eax
+  803b95:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803b9a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803b9c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803ba3:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803ba4:	8b 43 10             	mov    0x10(%rbx),%eax
+  803ba7:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803bab:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803bae:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803bb3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803bb7:	48 89 df             	mov    %rbx,%rdi
+  803bba:	48 b8 d3 37 80 00 00 	movabs $0x8037d3,%rax
+  803bc1:	00 00 00 
+  803bc4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803bc6:	48 85 c0             	test   %rax,%rax
+  803bc9:	0f 88 f4 fe ff ff    	js     803ac3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803bcf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803bd2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803bd5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803bd8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803bdc:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803be0:	48 63 d1             	movslq %ecx,%rdx
+  803be3:	48 01 d0             	add    %rdx,%rax
+  803be6:	4d 63 ff             	movslq %r15d,%r15
+  803be9:	4c 29 f8             	sub    %r15,%rax
+  803bec:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bf1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803bf5:	48 85 c0             	test   %rax,%rax
+  803bf8:	0f 8e c5 fe ff ff    	jle    803ac3 <devfile_read+0x78>
+    n = MIN(n, res);
+  803bfe:	4c 39 e8             	cmp    %r13,%rax
+  803c01:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803c05:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c08:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803c0c:	48 63 f6             	movslq %esi,%rsi
+  803c0f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803c14:	48 01 c6             	add    %rax,%rsi
+  803c17:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803c1b:	48 01 c6             	add    %rax,%rsi
+  803c1e:	4c 89 ea             	mov    %r13,%rdx
+  803c21:	4c 89 e7             	mov    %r12,%rdi
+  803c24:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  803c2b:	00 00 00 
+  803c2e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803c30:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803c34:	4c 89 e8             	mov    %r13,%rax
+  803c37:	e9 87 fe ff ff       	jmp    803ac3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803c3c:	48 98                	cltq
+  803c3e:	e9 80 fe ff ff       	jmp    803ac3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803c43:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803c47:	41 39 d7             	cmp    %edx,%r15d
+  803c4a:	0f 8c f8 fe ff ff    	jl     803b48 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803c50:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803c54:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803c57:	41 39 cf             	cmp    %ecx,%r15d
+  803c5a:	0f 8d e8 fe ff ff    	jge    803b48 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803c60:	4d 63 ff             	movslq %r15d,%r15
+  803c63:	4c 29 f8             	sub    %r15,%rax
+  803c66:	48 63 d2             	movslq %edx,%rdx
+  803c69:	48 01 d0             	add    %rdx,%rax
+  803c6c:	eb 87                	jmp    803bf5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803c6e:	48 98                	cltq
+  803c70:	e9 4e fe ff ff       	jmp    803ac3 <devfile_read+0x78>
+        return E_INVAL;
+  803c75:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803c7a:	c3                   	ret
+
+0000000000803c7b <fs_channel>:
+fs_channel(bool enable) {
+  803c7b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803c7d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803c84:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803c86:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c8b:	40 84 ff             	test   %dil,%dil
+  803c8e:	74 47                	je     803cd7 <fs_channel+0x5c>
+  803c90:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  803c97:	00 00 00 
+  803c9a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803ca0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803ca7:	00 00 00 
+  803caa:	3b 08                	cmp    (%rax),%ecx
+  803cac:	74 29                	je     803cd7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803cae:	55                   	push   %rbp
+  803caf:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803cb2:	48 b8 fb 2b 80 00 00 	movabs $0x802bfb,%rax
+  803cb9:	00 00 00 
+  803cbc:	ff d0                	call   *%rax
+  803cbe:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803cc0:	85 c0                	test   %eax,%eax
+  803cc2:	78 04                	js     803cc8 <fs_channel+0x4d>
+}
+  803cc4:	89 d0                	mov    %edx,%eax
+  803cc6:	5d                   	pop    %rbp
+  803cc7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803cc8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803ccf:	00 00 00 
+  803cd2:	c6 00 00             	movb   $0x0,(%rax)
+  803cd5:	eb ed                	jmp    803cc4 <fs_channel+0x49>
+}
+  803cd7:	89 d0                	mov    %edx,%eax
+  803cd9:	c3                   	ret
+
+0000000000803cda <open>:
+open(const char *path, int mode) {
+  803cda:	55                   	push   %rbp
+  803cdb:	48 89 e5             	mov    %rsp,%rbp
+  803cde:	41 55                	push   %r13
+  803ce0:	41 54                	push   %r12
+  803ce2:	53                   	push   %rbx
+  803ce3:	48 83 ec 18          	sub    $0x18,%rsp
+  803ce7:	49 89 fc             	mov    %rdi,%r12
+  803cea:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803ced:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+  803cf9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803cff:	0f 87 8f 00 00 00    	ja     803d94 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803d05:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d09:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+  803d15:	89 c3                	mov    %eax,%ebx
+  803d17:	85 c0                	test   %eax,%eax
+  803d19:	78 55                	js     803d70 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803d1b:	4c 89 e6             	mov    %r12,%rsi
+  803d1e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803d25:	00 00 00 
+  803d28:	48 89 df             	mov    %rbx,%rdi
+  803d2b:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  803d32:	00 00 00 
+  803d35:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803d37:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803d3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d43:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d47:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d4c:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803d53:	00 00 00 
+  803d56:	ff d0                	call   *%rax
+  803d58:	89 c3                	mov    %eax,%ebx
+  803d5a:	85 c0                	test   %eax,%eax
+  803d5c:	78 1f                	js     803d7d <open+0xa3>
+    return fd2num(fd);
+  803d5e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d62:	48 b8 87 24 80 00 00 	movabs $0x802487,%rax
+  803d69:	00 00 00 
+  803d6c:	ff d0                	call   *%rax
+  803d6e:	89 c3                	mov    %eax,%ebx
+}
+  803d70:	89 d8                	mov    %ebx,%eax
+  803d72:	48 83 c4 18          	add    $0x18,%rsp
+  803d76:	5b                   	pop    %rbx
+  803d77:	41 5c                	pop    %r12
+  803d79:	41 5d                	pop    %r13
+  803d7b:	5d                   	pop    %rbp
+  803d7c:	c3                   	ret
+        fd_close(fd, 0);
+  803d7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803d82:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d86:	48 b8 d0 25 80 00 00 	movabs $0x8025d0,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+        return res;
+  803d92:	eb dc                	jmp    803d70 <open+0x96>
+        return -E_BAD_PATH;
+  803d94:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803d99:	eb d5                	jmp    803d70 <open+0x96>
+
+0000000000803d9b <file_flush_buffers>:
+file_flush_buffers(void) {
+  803d9b:	55                   	push   %rbp
+  803d9c:	48 89 e5             	mov    %rsp,%rbp
+  803d9f:	41 56                	push   %r14
+  803da1:	41 55                	push   %r13
+  803da3:	41 54                	push   %r12
+  803da5:	53                   	push   %rbx
+  803da6:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803daa:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803db1:	00 00 00 
+  803db4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803db9:	49 bd 15 25 80 00 00 	movabs $0x802515,%r13
+  803dc0:	00 00 00 
+  803dc3:	49 be d5 34 80 00 00 	movabs $0x8034d5,%r14
+  803dca:	00 00 00 
+  803dcd:	eb 0c                	jmp    803ddb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803dcf:	83 c3 01             	add    $0x1,%ebx
+  803dd2:	49 83 c4 18          	add    $0x18,%r12
+  803dd6:	83 fb 20             	cmp    $0x20,%ebx
+  803dd9:	74 1d                	je     803df8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803ddb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803de0:	74 ed                	je     803dcf <file_flush_buffers+0x34>
+  803de2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803de6:	89 df                	mov    %ebx,%edi
+  803de8:	41 ff d5             	call   *%r13
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	78 e0                	js     803dcf <file_flush_buffers+0x34>
+  803def:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803df3:	41 ff d6             	call   *%r14
+  803df6:	eb d7                	jmp    803dcf <file_flush_buffers+0x34>
+}
+  803df8:	48 83 c4 10          	add    $0x10,%rsp
+  803dfc:	5b                   	pop    %rbx
+  803dfd:	41 5c                	pop    %r12
+  803dff:	41 5d                	pop    %r13
+  803e01:	41 5e                	pop    %r14
+  803e03:	5d                   	pop    %rbp
+  803e04:	c3                   	ret
+
+0000000000803e05 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803e05:	55                   	push   %rbp
+  803e06:	48 89 e5             	mov    %rsp,%rbp
+  803e09:	41 54                	push   %r12
+  803e0b:	53                   	push   %rbx
+  803e0c:	49 89 fc             	mov    %rdi,%r12
+  803e0f:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803e11:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  803e18:	00 00 00 
+  803e1b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803e1d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803e24:	00 00 00 
+  803e27:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803e2c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803e2e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e36:	be 00 00 00 00       	mov    $0x0,%esi
+  803e3b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803e40:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803e47:	00 00 00 
+  803e4a:	ff d0                	call   *%rax
+}
+  803e4c:	5b                   	pop    %rbx
+  803e4d:	41 5c                	pop    %r12
+  803e4f:	5d                   	pop    %rbp
+  803e50:	c3                   	ret
+
+0000000000803e51 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803e51:	55                   	push   %rbp
+  803e52:	48 89 e5             	mov    %rsp,%rbp
+  803e55:	41 54                	push   %r12
+  803e57:	53                   	push   %rbx
+  803e58:	49 89 fc             	mov    %rdi,%r12
+  803e5b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803e5e:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  803e65:	00 00 00 
+  803e68:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803e6a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803e6f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803e76:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803e78:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  803e82:	bf 05 00 00 00       	mov    $0x5,%edi
+  803e87:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803e8e:	00 00 00 
+  803e91:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803e93:	85 c0                	test   %eax,%eax
+  803e95:	78 3d                	js     803ed4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803e97:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803e9e:	00 00 00 
+  803ea1:	4c 89 e6             	mov    %r12,%rsi
+  803ea4:	48 89 df             	mov    %rbx,%rdi
+  803ea7:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  803eae:	00 00 00 
+  803eb1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803eb3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803eba:	00 
+  803ebb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803ec1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803ec8:	00 
+  803ec9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803ecf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed4:	5b                   	pop    %rbx
+  803ed5:	41 5c                	pop    %r12
+  803ed7:	5d                   	pop    %rbp
+  803ed8:	c3                   	ret
+
+0000000000803ed9 <remove>:
+remove(const char *path) {
+  803ed9:	55                   	push   %rbp
+  803eda:	48 89 e5             	mov    %rsp,%rbp
+  803edd:	53                   	push   %rbx
+  803ede:	48 83 ec 08          	sub    $0x8,%rsp
+  803ee2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803ee5:	48 b8 ea 17 80 00 00 	movabs $0x8017ea,%rax
+  803eec:	00 00 00 
+  803eef:	ff d0                	call   *%rax
+  803ef1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803ef7:	77 3a                	ja     803f33 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803ef9:	48 89 de             	mov    %rbx,%rsi
+  803efc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803f03:	00 00 00 
+  803f06:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  803f0d:	00 00 00 
+  803f10:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803f12:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f17:	be 00 00 00 00       	mov    $0x0,%esi
+  803f1c:	bf 07 00 00 00       	mov    $0x7,%edi
+  803f21:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803f28:	00 00 00 
+  803f2b:	ff d0                	call   *%rax
+}
+  803f2d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803f31:	c9                   	leave
+  803f32:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803f33:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803f38:	eb f3                	jmp    803f2d <remove+0x54>
+
+0000000000803f3a <sync>:
+sync(void) {
+  803f3a:	55                   	push   %rbp
+  803f3b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803f3e:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  803f45:	00 00 00 
+  803f48:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803f4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f4f:	be 00 00 00 00       	mov    $0x0,%esi
+  803f54:	bf 08 00 00 00       	mov    $0x8,%edi
+  803f59:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803f60:	00 00 00 
+  803f63:	ff d0                	call   *%rax
+}
+  803f65:	5d                   	pop    %rbp
+  803f66:	c3                   	ret
+
+0000000000803f67 <fsync>:
+fsync(int fdnum) {
+  803f67:	55                   	push   %rbp
+  803f68:	48 89 e5             	mov    %rsp,%rbp
+  803f6b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f6f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f73:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f7f:	85 c0                	test   %eax,%eax
+  803f81:	78 4b                	js     803fce <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803f83:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803f87:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803f8e:	00 00 00 
+  803f91:	8b 00                	mov    (%rax),%eax
+  803f93:	39 02                	cmp    %eax,(%rdx)
+  803f95:	75 39                	jne    803fd0 <fsync+0x69>
+    file_flush_buffers();
+  803f97:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  803f9e:	00 00 00 
+  803fa1:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803fa3:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803fa7:	8b 40 0c             	mov    0xc(%rax),%eax
+  803faa:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803fb1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803fb3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fb8:	be 00 00 00 00       	mov    $0x0,%esi
+  803fbd:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803fc2:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803fc9:	00 00 00 
+  803fcc:	ff d0                	call   *%rax
+}
+  803fce:	c9                   	leave
+  803fcf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803fd0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803fd5:	eb f7                	jmp    803fce <fsync+0x67>
+
+0000000000803fd7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803fd7:	55                   	push   %rbp
+  803fd8:	48 89 e5             	mov    %rsp,%rbp
+  803fdb:	53                   	push   %rbx
+  803fdc:	48 83 ec 08          	sub    $0x8,%rsp
+  803fe0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803fe3:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fe8:	be 00 00 00 00       	mov    $0x0,%esi
+  803fed:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803ff2:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  803ff9:	00 00 00 
+  803ffc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ffe:	85 c0                	test   %eax,%eax
+  804000:	78 2d                	js     80402f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  804002:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  804009:	00 00 00 
+  80400c:	48 8b 10             	mov    (%rax),%rdx
+  80400f:	48 89 13             	mov    %rdx,(%rbx)
+  804012:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804016:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80401a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80401e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804022:	48 8b 40 18          	mov    0x18(%rax),%rax
+  804026:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80402a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80402f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804033:	c9                   	leave
+  804034:	c3                   	ret
+
+0000000000804035 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  804035:	55                   	push   %rbp
+  804036:	48 89 e5             	mov    %rsp,%rbp
+  804039:	53                   	push   %rbx
+  80403a:	48 83 ec 08          	sub    $0x8,%rsp
+  80403e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  804041:	ba 00 00 00 00       	mov    $0x0,%edx
+  804046:	be 00 00 00 00       	mov    $0x0,%esi
+  80404b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  804050:	48 b8 6c 32 80 00 00 	movabs $0x80326c,%rax
+  804057:	00 00 00 
+  80405a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80405c:	85 c0                	test   %eax,%eax
+  80405e:	78 3d                	js     80409d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  804060:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  804067:	00 00 00 
+  80406a:	48 8b 10             	mov    (%rax),%rdx
+  80406d:	48 89 13             	mov    %rdx,(%rbx)
+  804070:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  804074:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  804078:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80407c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804080:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  804084:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  804088:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80408c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  804090:	48 8b 40 28          	mov    0x28(%rax),%rax
+  804094:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  804098:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80409d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040a1:	c9                   	leave
+  8040a2:	c3                   	ret
+
+00000000008040a3 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8040a3:	55                   	push   %rbp
+  8040a4:	48 89 e5             	mov    %rsp,%rbp
+  8040a7:	41 57                	push   %r15
+  8040a9:	41 56                	push   %r14
+  8040ab:	41 55                	push   %r13
+  8040ad:	41 54                	push   %r12
+  8040af:	53                   	push   %rbx
+  8040b0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8040b4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8040bb:	00 
+  8040bc:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8040c3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8040c9:	0f 85 43 01 00 00    	jne    804212 <munmap+0x16f>
+  8040cf:	49 89 ff             	mov    %rdi,%r15
+  8040d2:	4c 39 f7             	cmp    %r14,%rdi
+  8040d5:	0f 87 37 01 00 00    	ja     804212 <munmap+0x16f>
+  8040db:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8040e2:	00 00 00 
+  8040e5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8040eb:	eb 2c                	jmp    804119 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8040ed:	4c 39 f8             	cmp    %r15,%rax
+  8040f0:	0f 83 85 00 00 00    	jae    80417b <munmap+0xd8>
+            m->mm_end = start;
+  8040f6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8040fb:	48 83 c3 18          	add    $0x18,%rbx
+  8040ff:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  804106:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80410d:	00 00 00 
+  804110:	48 39 c3             	cmp    %rax,%rbx
+  804113:	0f 84 d0 00 00 00    	je     8041e9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  804119:	49 89 dc             	mov    %rbx,%r12
+  80411c:	48 8b 03             	mov    (%rbx),%rax
+  80411f:	4c 39 f0             	cmp    %r14,%rax
+  804122:	73 d7                	jae    8040fb <munmap+0x58>
+  804124:	48 85 c0             	test   %rax,%rax
+  804127:	74 d2                	je     8040fb <munmap+0x58>
+  804129:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80412d:	49 39 d7             	cmp    %rdx,%r15
+  804130:	73 c9                	jae    8040fb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  804132:	49 39 d6             	cmp    %rdx,%r14
+  804135:	73 b6                	jae    8040ed <munmap+0x4a>
+  804137:	49 39 c7             	cmp    %rax,%r15
+  80413a:	76 b1                	jbe    8040ed <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80413c:	4c 89 ef             	mov    %r13,%rdi
+  80413f:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  804146:	00 00 00 
+  804149:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80414b:	48 85 c0             	test   %rax,%rax
+  80414e:	0f 84 c5 00 00 00    	je     804219 <munmap+0x176>
+            *tail = *m;
+  804154:	48 8b 13             	mov    (%rbx),%rdx
+  804157:	48 89 10             	mov    %rdx,(%rax)
+  80415a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80415e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  804162:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  804166:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80416a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80416d:	44 89 f2             	mov    %r14d,%edx
+  804170:	2b 13                	sub    (%rbx),%edx
+  804172:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  804175:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  804179:	eb 80                	jmp    8040fb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80417b:	49 39 d6             	cmp    %rdx,%r14
+  80417e:	73 18                	jae    804198 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  804180:	44 89 f2             	mov    %r14d,%edx
+  804183:	41 03 54 24 10       	add    0x10(%r12),%edx
+  804188:	29 c2                	sub    %eax,%edx
+  80418a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80418f:	4d 89 34 24          	mov    %r14,(%r12)
+  804193:	e9 63 ff ff ff       	jmp    8040fb <munmap+0x58>
+    m->mm_start = 0;
+  804198:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80419f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8041a0:	4c 89 e6             	mov    %r12,%rsi
+  8041a3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8041aa:	00 00 00 
+  8041ad:	48 29 c6             	sub    %rax,%rsi
+  8041b0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8041b4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8041bb:	aa aa aa 
+  8041be:	48 0f af f0          	imul   %rax,%rsi
+  8041c2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8041c6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8041cb:	48 01 c6             	add    %rax,%rsi
+  8041ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041d8:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  8041df:	00 00 00 
+  8041e2:	ff d0                	call   *%rax
+}
+  8041e4:	e9 12 ff ff ff       	jmp    8040fb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8041e9:	4c 89 f2             	mov    %r14,%rdx
+  8041ec:	4c 29 fa             	sub    %r15,%rdx
+  8041ef:	4c 89 fe             	mov    %r15,%rsi
+  8041f2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041f7:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  8041fe:	00 00 00 
+  804201:	ff d0                	call   *%rax
+}
+  804203:	48 83 c4 08          	add    $0x8,%rsp
+  804207:	5b                   	pop    %rbx
+  804208:	41 5c                	pop    %r12
+  80420a:	41 5d                	pop    %r13
+  80420c:	41 5e                	pop    %r14
+  80420e:	41 5f                	pop    %r15
+  804210:	5d                   	pop    %rbp
+  804211:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  804212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  804217:	eb ea                	jmp    804203 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  804219:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80421e:	eb e3                	jmp    804203 <munmap+0x160>
+
+0000000000804220 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804220:	55                   	push   %rbp
+  804221:	48 89 e5             	mov    %rsp,%rbp
+  804224:	41 57                	push   %r15
+  804226:	41 56                	push   %r14
+  804228:	41 55                	push   %r13
+  80422a:	41 54                	push   %r12
+  80422c:	53                   	push   %rbx
+  80422d:	48 83 ec 28          	sub    $0x28,%rsp
+  804231:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  804235:	49 89 f5             	mov    %rsi,%r13
+  804238:	41 89 d6             	mov    %edx,%r14d
+  80423b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80423e:	41 89 cc             	mov    %ecx,%r12d
+  804241:	44 89 c7             	mov    %r8d,%edi
+  804244:	44 89 cb             	mov    %r9d,%ebx
+  804247:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80424b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80424f:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  804256:	00 00 00 
+  804259:	ff d0                	call   *%rax
+  80425b:	41 89 c7             	mov    %eax,%r15d
+  80425e:	85 c0                	test   %eax,%eax
+  804260:	0f 88 ae 01 00 00    	js     804414 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  804266:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80426a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  804271:	00 00 00 
+  804274:	8b 32                	mov    (%rdx),%esi
+  804276:	39 30                	cmp    %esi,(%rax)
+  804278:	0f 85 7a 02 00 00    	jne    8044f8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80427e:	8b 40 08             	mov    0x8(%rax),%eax
+  804281:	83 e0 03             	and    $0x3,%eax
+  804284:	83 f8 01             	cmp    $0x1,%eax
+  804287:	0f 84 76 02 00 00    	je     804503 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80428d:	4d 85 ed             	test   %r13,%r13
+  804290:	0f 84 78 02 00 00    	je     80450e <mmap+0x2ee>
+  804296:	85 db                	test   %ebx,%ebx
+  804298:	0f 88 70 02 00 00    	js     80450e <mmap+0x2ee>
+  80429e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8042a4:	41 89 df             	mov    %ebx,%r15d
+  8042a7:	0f 85 6c 02 00 00    	jne    804519 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8042ad:	44 89 f0             	mov    %r14d,%eax
+  8042b0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8042b3:	83 f8 04             	cmp    $0x4,%eax
+  8042b6:	0f 85 68 02 00 00    	jne    804524 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8042bc:	44 89 e1             	mov    %r12d,%ecx
+  8042bf:	83 e1 01             	and    $0x1,%ecx
+  8042c2:	0f 95 c2             	setne  %dl
+  8042c5:	44 89 e0             	mov    %r12d,%eax
+  8042c8:	d1 e8                	shr    %eax
+  8042ca:	83 f0 01             	xor    $0x1,%eax
+  8042cd:	83 e0 01             	and    $0x1,%eax
+  8042d0:	38 c2                	cmp    %al,%dl
+  8042d2:	0f 85 57 02 00 00    	jne    80452f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8042d8:	85 c9                	test   %ecx,%ecx
+  8042da:	74 0a                	je     8042e6 <mmap+0xc6>
+  8042dc:	41 f6 c6 02          	test   $0x2,%r14b
+  8042e0:	0f 85 54 02 00 00    	jne    80453a <mmap+0x31a>
+    file_flush_buffers();
+  8042e6:	48 b8 9b 3d 80 00 00 	movabs $0x803d9b,%rax
+  8042ed:	00 00 00 
+  8042f0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8042f2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8042f9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  804300:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804304:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  804307:	41 f6 c4 04          	test   $0x4,%r12b
+  80430b:	0f 84 15 01 00 00    	je     804426 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  804311:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  804314:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80431a:	0f 85 25 02 00 00    	jne    804545 <mmap+0x325>
+  804320:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  804324:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80432b:	00 00 00 
+  80432e:	48 39 c2             	cmp    %rax,%rdx
+  804331:	0f 82 19 02 00 00    	jb     804550 <mmap+0x330>
+  804337:	48 39 c7             	cmp    %rax,%rdi
+  80433a:	0f 87 10 02 00 00    	ja     804550 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  804340:	4c 89 ee             	mov    %r13,%rsi
+  804343:	48 b8 a3 40 80 00 00 	movabs $0x8040a3,%rax
+  80434a:	00 00 00 
+  80434d:	ff d0                	call   *%rax
+  80434f:	85 c0                	test   %eax,%eax
+  804351:	0f 88 04 02 00 00    	js     80455b <mmap+0x33b>
+    if (!handler) {
+  804357:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80435e:	00 00 00 
+  804361:	80 38 00             	cmpb   $0x0,(%rax)
+  804364:	75 2b                	jne    804391 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  804366:	48 bf 3b 31 80 00 00 	movabs $0x80313b,%rdi
+  80436d:	00 00 00 
+  804370:	48 b8 44 22 80 00 00 	movabs $0x802244,%rax
+  804377:	00 00 00 
+  80437a:	ff d0                	call   *%rax
+  80437c:	85 c0                	test   %eax,%eax
+  80437e:	0f 88 ea 01 00 00    	js     80456e <mmap+0x34e>
+        handler = 1;
+  804384:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80438b:	00 00 00 
+  80438e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  804391:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804395:	48 b8 da 31 80 00 00 	movabs $0x8031da,%rax
+  80439c:	00 00 00 
+  80439f:	ff d0                	call   *%rax
+  8043a1:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8043a4:	48 85 c0             	test   %rax,%rax
+  8043a7:	0f 84 c9 01 00 00    	je     804576 <mmap+0x356>
+    m->mm_start = va;
+  8043ad:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8043b0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8043b4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8043b8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8043bb:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8043bf:	44 89 e0             	mov    %r12d,%eax
+  8043c2:	c1 e0 06             	shl    $0x6,%eax
+  8043c5:	25 80 00 00 00       	and    $0x80,%eax
+  8043ca:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8043cd:	09 f0                	or     %esi,%eax
+  8043cf:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8043d3:	41 f6 c4 08          	test   $0x8,%r12b
+  8043d7:	74 31                	je     80440a <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8043d9:	48 39 d3             	cmp    %rdx,%rbx
+  8043dc:	73 2c                	jae    80440a <mmap+0x1ea>
+  8043de:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8043e3:	48 89 de             	mov    %rbx,%rsi
+  8043e6:	4c 89 f7             	mov    %r14,%rdi
+  8043e9:	48 b8 2a 30 80 00 00 	movabs $0x80302a,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+  8043f5:	49 89 c4             	mov    %rax,%r12
+  8043f8:	48 85 c0             	test   %rax,%rax
+  8043fb:	0f 8e d7 00 00 00    	jle    8044d8 <mmap+0x2b8>
+            va += n;
+  804401:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  804404:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  804408:	72 d4                	jb     8043de <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80440a:	49 8b 06             	mov    (%r14),%rax
+  80440d:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804411:	48 89 06             	mov    %rax,(%rsi)
+}
+  804414:	44 89 f8             	mov    %r15d,%eax
+  804417:	48 83 c4 28          	add    $0x28,%rsp
+  80441b:	5b                   	pop    %rbx
+  80441c:	41 5c                	pop    %r12
+  80441e:	41 5d                	pop    %r13
+  804420:	41 5e                	pop    %r14
+  804422:	41 5f                	pop    %r15
+  804424:	5d                   	pop    %rbp
+  804425:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804426:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80442d:	00 00 00 
+  804430:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  804433:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80443a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80443d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  804442:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  804449:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80444c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  804453:	00 00 00 
+  804456:	48 39 d7             	cmp    %rdx,%rdi
+  804459:	73 1c                	jae    804477 <mmap+0x257>
+        return -E_NO_MEM;
+  80445b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804461:	eb b1                	jmp    804414 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804463:	48 83 c0 01          	add    $0x1,%rax
+  804467:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80446b:	77 3f                	ja     8044ac <mmap+0x28c>
+  80446d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  804472:	48 39 d7             	cmp    %rdx,%rdi
+  804475:	72 2a                	jb     8044a1 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  804477:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80447b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80447f:	48 39 d1             	cmp    %rdx,%rcx
+  804482:	73 df                	jae    804463 <mmap+0x243>
+  804484:	48 85 c9             	test   %rcx,%rcx
+  804487:	74 da                	je     804463 <mmap+0x243>
+  804489:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80448d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  804492:	48 39 d3             	cmp    %rdx,%rbx
+  804495:	73 cc                	jae    804463 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  804497:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80449a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80449f:	eb cc                	jmp    80446d <mmap+0x24d>
+        return -E_NO_MEM;
+  8044a1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8044a7:	e9 68 ff ff ff       	jmp    804414 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8044ac:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8044b1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8044b8:	00 00 00 
+  8044bb:	48 39 c2             	cmp    %rax,%rdx
+  8044be:	0f 82 9f 00 00 00    	jb     804563 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8044c4:	48 85 db             	test   %rbx,%rbx
+  8044c7:	0f 85 8a fe ff ff    	jne    804357 <mmap+0x137>
+        return -E_NO_MEM;
+  8044cd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8044d3:	e9 3c ff ff ff       	jmp    804414 <mmap+0x1f4>
+        if (n < 0) {
+  8044d8:	0f 89 2c ff ff ff    	jns    80440a <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8044de:	49 8b 3e             	mov    (%r14),%rdi
+  8044e1:	4c 89 ee             	mov    %r13,%rsi
+  8044e4:	48 b8 a3 40 80 00 00 	movabs $0x8040a3,%rax
+  8044eb:	00 00 00 
+  8044ee:	ff d0                	call   *%rax
+            return n;
+  8044f0:	45 89 e7             	mov    %r12d,%r15d
+  8044f3:	e9 1c ff ff ff       	jmp    804414 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8044f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8044fe:	e9 11 ff ff ff       	jmp    804414 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  804503:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804509:	e9 06 ff ff ff       	jmp    804414 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80450e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804514:	e9 fb fe ff ff       	jmp    804414 <mmap+0x1f4>
+  804519:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80451f:	e9 f0 fe ff ff       	jmp    804414 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  804524:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80452a:	e9 e5 fe ff ff       	jmp    804414 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80452f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804535:	e9 da fe ff ff       	jmp    804414 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80453a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  804540:	e9 cf fe ff ff       	jmp    804414 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  804545:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80454b:	e9 c4 fe ff ff       	jmp    804414 <mmap+0x1f4>
+  804550:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804556:	e9 b9 fe ff ff       	jmp    804414 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80455b:	41 89 c7             	mov    %eax,%r15d
+  80455e:	e9 b1 fe ff ff       	jmp    804414 <mmap+0x1f4>
+        return -E_NO_MEM;
+  804563:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804569:	e9 a6 fe ff ff       	jmp    804414 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80456e:	41 89 c7             	mov    %eax,%r15d
+  804571:	e9 9e fe ff ff       	jmp    804414 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  804576:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80457c:	e9 93 fe ff ff       	jmp    804414 <mmap+0x1f4>
+
+0000000000804581 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804581:	55                   	push   %rbp
+  804582:	48 89 e5             	mov    %rsp,%rbp
+  804585:	41 54                	push   %r12
+  804587:	53                   	push   %rbx
+  804588:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80458b:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  804592:	00 00 00 
+  804595:	ff d0                	call   *%rax
+  804597:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80459a:	48 be 60 5b 80 00 00 	movabs $0x805b60,%rsi
+  8045a1:	00 00 00 
+  8045a4:	48 89 df             	mov    %rbx,%rdi
+  8045a7:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  8045ae:	00 00 00 
+  8045b1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8045b3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8045b8:	41 2b 04 24          	sub    (%r12),%eax
+  8045bc:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8045c2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8045c9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8045cc:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8045d3:	00 00 00 
+  8045d6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8045dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e2:	5b                   	pop    %rbx
+  8045e3:	41 5c                	pop    %r12
+  8045e5:	5d                   	pop    %rbp
+  8045e6:	c3                   	ret
+
+00000000008045e7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045e7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045ea:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8045f0:	8b 17                	mov    (%rdi),%edx
+  8045f2:	85 d2                	test   %edx,%edx
+  8045f4:	75 01                	jne    8045f7 <pipe_wakeup+0x10>
+  8045f6:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045f7:	55                   	push   %rbp
+  8045f8:	48 89 e5             	mov    %rsp,%rbp
+  8045fb:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8045fe:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804604:	be 00 04 00 00       	mov    $0x400,%esi
+  804609:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+}
+  804615:	5d                   	pop    %rbp
+  804616:	c3                   	ret
+
+0000000000804617 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804617:	55                   	push   %rbp
+  804618:	48 89 e5             	mov    %rsp,%rbp
+  80461b:	41 55                	push   %r13
+  80461d:	41 54                	push   %r12
+  80461f:	53                   	push   %rbx
+  804620:	48 83 ec 08          	sub    $0x8,%rsp
+  804624:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804627:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  80462e:	00 00 00 
+  804631:	ff d0                	call   *%rax
+  804633:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804636:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80463b:	4c 89 e6             	mov    %r12,%rsi
+  80463e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804643:	49 bc 2d 1e 80 00 00 	movabs $0x801e2d,%r12
+  80464a:	00 00 00 
+  80464d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804650:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804654:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804658:	49 bd e7 45 80 00 00 	movabs $0x8045e7,%r13
+  80465f:	00 00 00 
+  804662:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804665:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804669:	48 89 de             	mov    %rbx,%rsi
+  80466c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80466f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804674:	48 89 de             	mov    %rbx,%rsi
+  804677:	bf 00 00 00 00       	mov    $0x0,%edi
+  80467c:	41 ff d4             	call   *%r12
+  80467f:	48 83 c4 08          	add    $0x8,%rsp
+  804683:	5b                   	pop    %rbx
+  804684:	41 5c                	pop    %r12
+  804686:	41 5d                	pop    %r13
+  804688:	5d                   	pop    %rbp
+  804689:	c3                   	ret
+
+000000000080468a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80468a:	55                   	push   %rbp
+  80468b:	48 89 e5             	mov    %rsp,%rbp
+  80468e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804691:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804696:	be 00 10 00 00       	mov    $0x1000,%esi
+  80469b:	48 b8 70 1d 80 00 00 	movabs $0x801d70,%rax
+  8046a2:	00 00 00 
+  8046a5:	ff d0                	call   *%rax
+  8046a7:	85 c0                	test   %eax,%eax
+  8046a9:	0f 94 c0             	sete   %al
+  8046ac:	0f b6 c0             	movzbl %al,%eax
+}
+  8046af:	5d                   	pop    %rbp
+  8046b0:	c3                   	ret
+
+00000000008046b1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8046b1:	55                   	push   %rbp
+  8046b2:	48 89 e5             	mov    %rsp,%rbp
+  8046b5:	41 57                	push   %r15
+  8046b7:	41 56                	push   %r14
+  8046b9:	41 55                	push   %r13
+  8046bb:	41 54                	push   %r12
+  8046bd:	53                   	push   %rbx
+  8046be:	48 83 ec 38          	sub    $0x38,%rsp
+  8046c2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8046c6:	49 89 f4             	mov    %rsi,%r12
+  8046c9:	49 89 d7             	mov    %rdx,%r15
+  8046cc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046d0:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8046d7:	00 00 00 
+  8046da:	ff d0                	call   *%rax
+  8046dc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046df:	4d 85 ff             	test   %r15,%r15
+  8046e2:	0f 84 f1 00 00 00    	je     8047d9 <devpipe_write+0x128>
+  8046e8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8046ec:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8046f0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8046f4:	49 bd 8a 46 80 00 00 	movabs $0x80468a,%r13
+  8046fb:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8046fe:	49 bf e7 45 80 00 00 	movabs $0x8045e7,%r15
+  804705:	00 00 00 
+  804708:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80470c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804710:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804714:	8b 73 04             	mov    0x4(%rbx),%esi
+  804717:	48 63 ce             	movslq %esi,%rcx
+  80471a:	48 63 03             	movslq (%rbx),%rax
+  80471d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804723:	48 39 c1             	cmp    %rax,%rcx
+  804726:	72 64                	jb     80478c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  804728:	48 89 de             	mov    %rbx,%rsi
+  80472b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80472f:	41 ff d5             	call   *%r13
+  804732:	85 c0                	test   %eax,%eax
+  804734:	0f 85 b9 00 00 00    	jne    8047f3 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80473a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80473e:	4c 89 f7             	mov    %r14,%rdi
+  804741:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804744:	8b 43 04             	mov    0x4(%rbx),%eax
+  804747:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80474e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804755:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80475b:	8b 03                	mov    (%rbx),%eax
+  80475d:	41 39 c4             	cmp    %eax,%r12d
+  804760:	75 b2                	jne    804714 <devpipe_write+0x63>
+  804762:	48 89 de             	mov    %rbx,%rsi
+  804765:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804769:	41 ff d5             	call   *%r13
+  80476c:	85 c0                	test   %eax,%eax
+  80476e:	75 a0                	jne    804710 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804770:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804775:	44 89 e6             	mov    %r12d,%esi
+  804778:	48 89 df             	mov    %rbx,%rdi
+  80477b:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  804782:	00 00 00 
+  804785:	ff d0                	call   *%rax
+  804787:	e9 7c ff ff ff       	jmp    804708 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80478c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804790:	41 0f b6 38          	movzbl (%r8),%edi
+  804794:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80479b:	80 80 80 
+  80479e:	48 89 c8             	mov    %rcx,%rax
+  8047a1:	48 f7 e2             	mul    %rdx
+  8047a4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8047a8:	48 89 d0             	mov    %rdx,%rax
+  8047ab:	48 c1 e0 08          	shl    $0x8,%rax
+  8047af:	48 29 d0             	sub    %rdx,%rax
+  8047b2:	48 c1 e0 04          	shl    $0x4,%rax
+  8047b6:	48 29 c1             	sub    %rax,%rcx
+  8047b9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8047be:	83 c6 01             	add    $0x1,%esi
+  8047c1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047c4:	49 83 c0 01          	add    $0x1,%r8
+  8047c8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8047cc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047d0:	49 39 c0             	cmp    %rax,%r8
+  8047d3:	0f 85 2f ff ff ff    	jne    804708 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8047d9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8047dd:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8047e1:	48 b8 e7 45 80 00 00 	movabs $0x8045e7,%rax
+  8047e8:	00 00 00 
+  8047eb:	ff d0                	call   *%rax
+    return n;
+  8047ed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047f1:	eb 05                	jmp    8047f8 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8047f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047f8:	48 83 c4 38          	add    $0x38,%rsp
+  8047fc:	5b                   	pop    %rbx
+  8047fd:	41 5c                	pop    %r12
+  8047ff:	41 5d                	pop    %r13
+  804801:	41 5e                	pop    %r14
+  804803:	41 5f                	pop    %r15
+  804805:	5d                   	pop    %rbp
+  804806:	c3                   	ret
+
+0000000000804807 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804807:	55                   	push   %rbp
+  804808:	48 89 e5             	mov    %rsp,%rbp
+  80480b:	41 57                	push   %r15
+  80480d:	41 56                	push   %r14
+  80480f:	41 55                	push   %r13
+  804811:	41 54                	push   %r12
+  804813:	53                   	push   %rbx
+  804814:	48 83 ec 28          	sub    $0x28,%rsp
+  804818:	49 89 fd             	mov    %rdi,%r13
+  80481b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80481f:	49 89 d4             	mov    %rdx,%r12
+  804822:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804826:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  80482d:	00 00 00 
+  804830:	ff d0                	call   *%rax
+  804832:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804835:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80483b:	49 bf 8a 46 80 00 00 	movabs $0x80468a,%r15
+  804842:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804845:	4d 85 e4             	test   %r12,%r12
+  804848:	0f 84 d5 00 00 00    	je     804923 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80484e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804852:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804856:	8b 03                	mov    (%rbx),%eax
+  804858:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80485b:	75 7a                	jne    8048d7 <devpipe_read+0xd0>
+            if (i > 0) {
+  80485d:	4d 85 f6             	test   %r14,%r14
+  804860:	75 50                	jne    8048b2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804862:	48 89 de             	mov    %rbx,%rsi
+  804865:	4c 89 ef             	mov    %r13,%rdi
+  804868:	41 ff d7             	call   *%r15
+  80486b:	85 c0                	test   %eax,%eax
+  80486d:	0f 85 c9 00 00 00    	jne    80493c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804873:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804876:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80487d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804883:	8b 43 04             	mov    0x4(%rbx),%eax
+  804886:	41 39 c4             	cmp    %eax,%r12d
+  804889:	75 cb                	jne    804856 <devpipe_read+0x4f>
+  80488b:	48 89 de             	mov    %rbx,%rsi
+  80488e:	4c 89 ef             	mov    %r13,%rdi
+  804891:	41 ff d7             	call   *%r15
+  804894:	85 c0                	test   %eax,%eax
+  804896:	75 be                	jne    804856 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804898:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80489d:	44 89 e6             	mov    %r12d,%esi
+  8048a0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8048a4:	48 b8 f5 20 80 00 00 	movabs $0x8020f5,%rax
+  8048ab:	00 00 00 
+  8048ae:	ff d0                	call   *%rax
+  8048b0:	eb a4                	jmp    804856 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8048b2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8048b6:	48 89 de             	mov    %rbx,%rsi
+  8048b9:	48 b8 e7 45 80 00 00 	movabs $0x8045e7,%rax
+  8048c0:	00 00 00 
+  8048c3:	ff d0                	call   *%rax
+                return i;
+  8048c5:	4c 89 f0             	mov    %r14,%rax
+}
+  8048c8:	48 83 c4 28          	add    $0x28,%rsp
+  8048cc:	5b                   	pop    %rbx
+  8048cd:	41 5c                	pop    %r12
+  8048cf:	41 5d                	pop    %r13
+  8048d1:	41 5e                	pop    %r14
+  8048d3:	41 5f                	pop    %r15
+  8048d5:	5d                   	pop    %rbp
+  8048d6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8048d7:	48 63 c8             	movslq %eax,%rcx
+  8048da:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8048e1:	80 80 80 
+  8048e4:	48 89 c8             	mov    %rcx,%rax
+  8048e7:	48 f7 e2             	mul    %rdx
+  8048ea:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8048ee:	48 89 d0             	mov    %rdx,%rax
+  8048f1:	48 c1 e0 08          	shl    $0x8,%rax
+  8048f5:	48 29 d0             	sub    %rdx,%rax
+  8048f8:	48 c1 e0 04          	shl    $0x4,%rax
+  8048fc:	48 89 c2             	mov    %rax,%rdx
+  8048ff:	48 89 c8             	mov    %rcx,%rax
+  804902:	48 29 d0             	sub    %rdx,%rax
+  804905:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80490a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80490e:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804912:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804915:	49 83 c6 01          	add    $0x1,%r14
+  804919:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  80491d:	0f 85 2b ff ff ff    	jne    80484e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804923:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804927:	48 89 de             	mov    %rbx,%rsi
+  80492a:	48 b8 e7 45 80 00 00 	movabs $0x8045e7,%rax
+  804931:	00 00 00 
+  804934:	ff d0                	call   *%rax
+    return n;
+  804936:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80493a:	eb 8c                	jmp    8048c8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80493c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804941:	eb 85                	jmp    8048c8 <devpipe_read+0xc1>
+
+0000000000804943 <pipe>:
+pipe(int pfd[2]) {
+  804943:	55                   	push   %rbp
+  804944:	48 89 e5             	mov    %rsp,%rbp
+  804947:	41 55                	push   %r13
+  804949:	41 54                	push   %r12
+  80494b:	53                   	push   %rbx
+  80494c:	48 83 ec 18          	sub    $0x18,%rsp
+  804950:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804953:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804957:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  80495e:	00 00 00 
+  804961:	ff d0                	call   *%rax
+  804963:	89 c3                	mov    %eax,%ebx
+  804965:	85 c0                	test   %eax,%eax
+  804967:	0f 88 a0 01 00 00    	js     804b0d <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80496d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804972:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804977:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80497b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804980:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  804987:	00 00 00 
+  80498a:	ff d0                	call   *%rax
+  80498c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80498e:	85 c0                	test   %eax,%eax
+  804990:	0f 88 77 01 00 00    	js     804b0d <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804996:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80499a:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  8049a1:	00 00 00 
+  8049a4:	ff d0                	call   *%rax
+  8049a6:	89 c3                	mov    %eax,%ebx
+  8049a8:	85 c0                	test   %eax,%eax
+  8049aa:	0f 88 43 01 00 00    	js     804af3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8049b0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049b5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049ba:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8049be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049c3:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  8049ca:	00 00 00 
+  8049cd:	ff d0                	call   *%rax
+  8049cf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049d1:	85 c0                	test   %eax,%eax
+  8049d3:	0f 88 1a 01 00 00    	js     804af3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8049d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8049dd:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  8049e4:	00 00 00 
+  8049e7:	ff d0                	call   *%rax
+  8049e9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8049ec:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049f6:	48 89 c6             	mov    %rax,%rsi
+  8049f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049fe:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  804a05:	00 00 00 
+  804a08:	ff d0                	call   *%rax
+  804a0a:	89 c3                	mov    %eax,%ebx
+  804a0c:	85 c0                	test   %eax,%eax
+  804a0e:	0f 88 c5 00 00 00    	js     804ad9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804a14:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804a18:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  804a1f:	00 00 00 
+  804a22:	ff d0                	call   *%rax
+  804a24:	48 89 c1             	mov    %rax,%rcx
+  804a27:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804a2d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a33:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a38:	4c 89 ee             	mov    %r13,%rsi
+  804a3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a40:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  804a47:	00 00 00 
+  804a4a:	ff d0                	call   *%rax
+  804a4c:	89 c3                	mov    %eax,%ebx
+  804a4e:	85 c0                	test   %eax,%eax
+  804a50:	78 6e                	js     804ac0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804a52:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a57:	4c 89 ef             	mov    %r13,%rdi
+  804a5a:	48 b8 4c 1d 80 00 00 	movabs $0x801d4c,%rax
+  804a61:	00 00 00 
+  804a64:	ff d0                	call   *%rax
+  804a66:	83 f8 02             	cmp    $0x2,%eax
+  804a69:	0f 85 ab 00 00 00    	jne    804b1a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804a6f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804a76:	00 00 
+  804a78:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a7c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804a7e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a82:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804a89:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804a8d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804a8f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a93:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804a9a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a9e:	48 bb 87 24 80 00 00 	movabs $0x802487,%rbx
+  804aa5:	00 00 00 
+  804aa8:	ff d3                	call   *%rbx
+  804aaa:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804aae:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804ab2:	ff d3                	call   *%rbx
+  804ab4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804ab9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804abe:	eb 4d                	jmp    804b0d <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804ac0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ac5:	4c 89 ee             	mov    %r13,%rsi
+  804ac8:	bf 00 00 00 00       	mov    $0x0,%edi
+  804acd:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  804ad4:	00 00 00 
+  804ad7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804ad9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ade:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804ae2:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ae7:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  804aee:	00 00 00 
+  804af1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804af3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804af8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804afc:	bf 00 00 00 00       	mov    $0x0,%edi
+  804b01:	48 b8 2d 1e 80 00 00 	movabs $0x801e2d,%rax
+  804b08:	00 00 00 
+  804b0b:	ff d0                	call   *%rax
+}
+  804b0d:	89 d8                	mov    %ebx,%eax
+  804b0f:	48 83 c4 18          	add    $0x18,%rsp
+  804b13:	5b                   	pop    %rbx
+  804b14:	41 5c                	pop    %r12
+  804b16:	41 5d                	pop    %r13
+  804b18:	5d                   	pop    %rbp
+  804b19:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804b1a:	48 b9 78 5b 80 00 00 	movabs $0x805b78,%rcx
+  804b21:	00 00 00 
+  804b24:	48 ba 98 5a 80 00 00 	movabs $0x805a98,%rdx
+  804b2b:	00 00 00 
+  804b2e:	be 50 00 00 00       	mov    $0x50,%esi
+  804b33:	48 bf 67 5b 80 00 00 	movabs $0x805b67,%rdi
+  804b3a:	00 00 00 
+  804b3d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b42:	49 b8 b3 0d 80 00 00 	movabs $0x800db3,%r8
+  804b49:	00 00 00 
+  804b4c:	41 ff d0             	call   *%r8
+
+0000000000804b4f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804b4f:	55                   	push   %rbp
+  804b50:	48 89 e5             	mov    %rsp,%rbp
+  804b53:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804b57:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804b5b:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  804b62:	00 00 00 
+  804b65:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b67:	85 c0                	test   %eax,%eax
+  804b69:	78 23                	js     804b8e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804b6b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b6f:	48 b8 99 24 80 00 00 	movabs $0x802499,%rax
+  804b76:	00 00 00 
+  804b79:	ff d0                	call   *%rax
+  804b7b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804b7e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b82:	48 b8 8a 46 80 00 00 	movabs $0x80468a,%rax
+  804b89:	00 00 00 
+  804b8c:	ff d0                	call   *%rax
+}
+  804b8e:	c9                   	leave
+  804b8f:	c3                   	ret
+
+0000000000804b90 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b90:	48 89 f8             	mov    %rdi,%rax
+  804b93:	48 c1 e8 27          	shr    $0x27,%rax
+  804b97:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b9e:	01 00 00 
+  804ba1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ba5:	f6 c2 01             	test   $0x1,%dl
+  804ba8:	74 6d                	je     804c17 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804baa:	48 89 f8             	mov    %rdi,%rax
+  804bad:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804bb1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804bb8:	01 00 00 
+  804bbb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bbf:	f6 c2 01             	test   $0x1,%dl
+  804bc2:	74 62                	je     804c26 <get_uvpt_entry+0x96>
+  804bc4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804bcb:	01 00 00 
+  804bce:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bd2:	f6 c2 80             	test   $0x80,%dl
+  804bd5:	75 4f                	jne    804c26 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804bd7:	48 89 f8             	mov    %rdi,%rax
+  804bda:	48 c1 e8 15          	shr    $0x15,%rax
+  804bde:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804be5:	01 00 00 
+  804be8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bec:	f6 c2 01             	test   $0x1,%dl
+  804bef:	74 44                	je     804c35 <get_uvpt_entry+0xa5>
+  804bf1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bf8:	01 00 00 
+  804bfb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bff:	f6 c2 80             	test   $0x80,%dl
+  804c02:	75 31                	jne    804c35 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804c04:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804c08:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804c0f:	01 00 00 
+  804c12:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804c16:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804c17:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804c1e:	01 00 00 
+  804c21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c25:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c26:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c2d:	01 00 00 
+  804c30:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c34:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804c35:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804c3c:	01 00 00 
+  804c3f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804c43:	c3                   	ret
+
+0000000000804c44 <get_prot>:
+
+int
+get_prot(void *va) {
+  804c44:	55                   	push   %rbp
+  804c45:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c48:	48 b8 90 4b 80 00 00 	movabs $0x804b90,%rax
+  804c4f:	00 00 00 
+  804c52:	ff d0                	call   *%rax
+  804c54:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804c57:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804c5c:	89 c1                	mov    %eax,%ecx
+  804c5e:	83 c9 04             	or     $0x4,%ecx
+  804c61:	f6 c2 01             	test   $0x1,%dl
+  804c64:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804c67:	89 c1                	mov    %eax,%ecx
+  804c69:	83 c9 02             	or     $0x2,%ecx
+  804c6c:	f6 c2 02             	test   $0x2,%dl
+  804c6f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804c72:	89 c1                	mov    %eax,%ecx
+  804c74:	83 c9 01             	or     $0x1,%ecx
+  804c77:	48 85 d2             	test   %rdx,%rdx
+  804c7a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804c7d:	89 c1                	mov    %eax,%ecx
+  804c7f:	83 c9 40             	or     $0x40,%ecx
+  804c82:	f6 c6 04             	test   $0x4,%dh
+  804c85:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c88:	5d                   	pop    %rbp
+  804c89:	c3                   	ret
+
+0000000000804c8a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c8a:	55                   	push   %rbp
+  804c8b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c8e:	48 b8 90 4b 80 00 00 	movabs $0x804b90,%rax
+  804c95:	00 00 00 
+  804c98:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c9a:	48 c1 e8 06          	shr    $0x6,%rax
+  804c9e:	83 e0 01             	and    $0x1,%eax
+}
+  804ca1:	5d                   	pop    %rbp
+  804ca2:	c3                   	ret
+
+0000000000804ca3 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804ca3:	55                   	push   %rbp
+  804ca4:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804ca7:	48 b8 90 4b 80 00 00 	movabs $0x804b90,%rax
+  804cae:	00 00 00 
+  804cb1:	ff d0                	call   *%rax
+  804cb3:	83 e0 01             	and    $0x1,%eax
+}
+  804cb6:	5d                   	pop    %rbp
+  804cb7:	c3                   	ret
+
+0000000000804cb8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804cb8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804cbf:	01 00 00 
+  804cc2:	a8 01                	test   $0x1,%al
+  804cc4:	75 06                	jne    804ccc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804cc6:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ccb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804ccc:	55                   	push   %rbp
+  804ccd:	48 89 e5             	mov    %rsp,%rbp
+  804cd0:	41 57                	push   %r15
+  804cd2:	41 56                	push   %r14
+  804cd4:	41 55                	push   %r13
+  804cd6:	41 54                	push   %r12
+  804cd8:	53                   	push   %rbx
+  804cd9:	48 83 ec 28          	sub    $0x28,%rsp
+  804cdd:	49 89 fe             	mov    %rdi,%r14
+  804ce0:	49 89 f7             	mov    %rsi,%r15
+  804ce3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804cea:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804ceb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804cf2:	01 00 00 
+  804cf5:	e9 ae 00 00 00       	jmp    804da8 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804cfa:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804d01:	49 83 ec 01          	sub    $0x1,%r12
+  804d05:	74 2d                	je     804d34 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804d07:	48 89 d8             	mov    %rbx,%rax
+  804d0a:	48 c1 e8 0c          	shr    $0xc,%rax
+  804d0e:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804d13:	f6 c2 01             	test   $0x1,%dl
+  804d16:	74 e2                	je     804cfa <foreach_shared_region+0x42>
+  804d18:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804d1d:	f6 c4 04             	test   $0x4,%ah
+  804d20:	74 d8                	je     804cfa <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804d22:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804d29:	4c 89 fa             	mov    %r15,%rdx
+  804d2c:	48 89 df             	mov    %rbx,%rdi
+  804d2f:	41 ff d6             	call   *%r14
+  804d32:	eb c6                	jmp    804cfa <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804d34:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804d3b:	00 
+  804d3c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804d41:	74 4a                	je     804d8d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804d43:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804d47:	48 c1 e8 15          	shr    $0x15,%rax
+  804d4b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804d52:	01 00 00 
+  804d55:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d59:	a8 01                	test   $0x1,%al
+  804d5b:	74 d7                	je     804d34 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804d5d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804d61:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804d68:	48 39 c3             	cmp    %rax,%rbx
+  804d6b:	73 c7                	jae    804d34 <foreach_shared_region+0x7c>
+  804d6d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804d74:	48 39 d0             	cmp    %rdx,%rax
+  804d77:	4d 19 e4             	sbb    %r12,%r12
+  804d7a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804d81:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804d88:	e9 7a ff ff ff       	jmp    804d07 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804d8d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804d94:	40 
+  804d95:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804d99:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804da0:	00 00 00 
+  804da3:	48 39 c1             	cmp    %rax,%rcx
+  804da6:	74 50                	je     804df8 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804da8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804dac:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804db0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804db7:	01 00 00 
+  804dba:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804dbe:	a8 01                	test   $0x1,%al
+  804dc0:	74 cb                	je     804d8d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804dc2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804dc6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804dcd:	48 39 c1             	cmp    %rax,%rcx
+  804dd0:	73 bb                	jae    804d8d <foreach_shared_region+0xd5>
+  804dd2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804dd9:	48 39 d0             	cmp    %rdx,%rax
+  804ddc:	48 19 c0             	sbb    %rax,%rax
+  804ddf:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804de5:	48 05 00 02 00 00    	add    $0x200,%rax
+  804deb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804def:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804df3:	e9 4b ff ff ff       	jmp    804d43 <foreach_shared_region+0x8b>
+  804df8:	b8 00 00 00 00       	mov    $0x0,%eax
+  804dfd:	48 83 c4 28          	add    $0x28,%rsp
+  804e01:	5b                   	pop    %rbx
+  804e02:	41 5c                	pop    %r12
+  804e04:	41 5d                	pop    %r13
+  804e06:	41 5e                	pop    %r14
+  804e08:	41 5f                	pop    %r15
+  804e0a:	5d                   	pop    %rbp
+  804e0b:	c3                   	ret
+
+0000000000804e0c <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804e0c:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804e12:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804e19:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804e20:	c3                   	ret
+
+0000000000804e21 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804e21:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e24:	8b 17                	mov    (%rdi),%edx
+  804e26:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e28:	83 f8 0f             	cmp    $0xf,%eax
+  804e2b:	77 13                	ja     804e40 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804e2d:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e30:	83 e0 0f             	and    $0xf,%eax
+  804e33:	48 c1 e0 09          	shl    $0x9,%rax
+  804e37:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804e3e:	00 
+  804e3f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804e40:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e45:	c3                   	ret
+
+0000000000804e46 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804e46:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e49:	83 c0 01             	add    $0x1,%eax
+  804e4c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804e4f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e55:	8b 57 04             	mov    0x4(%rdi),%edx
+  804e58:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e5d:	85 d2                	test   %edx,%edx
+  804e5f:	75 04                	jne    804e65 <chan_publish+0x1f>
+  804e61:	83 e0 01             	and    $0x1,%eax
+}
+  804e64:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804e65:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804e68:	85 c0                	test   %eax,%eax
+  804e6a:	0f 95 c0             	setne  %al
+  804e6d:	0f b6 c0             	movzbl %al,%eax
+  804e70:	eb ef                	jmp    804e61 <chan_publish+0x1b>
+
+0000000000804e72 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804e72:	8b 47 40             	mov    0x40(%rdi),%eax
+  804e75:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804e77:	29 d0                	sub    %edx,%eax
+  804e79:	83 e8 01             	sub    $0x1,%eax
+  804e7c:	83 f8 0f             	cmp    $0xf,%eax
+  804e7f:	77 12                	ja     804e93 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804e81:	8b 07                	mov    (%rdi),%eax
+  804e83:	83 e0 0f             	and    $0xf,%eax
+  804e86:	48 c1 e0 09          	shl    $0x9,%rax
+  804e8a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804e91:	00 
+  804e92:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804e93:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804e98:	c3                   	ret
+
+0000000000804e99 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804e99:	8b 07                	mov    (%rdi),%eax
+  804e9b:	83 c0 01             	add    $0x1,%eax
+  804e9e:	89 07                	mov    %eax,(%rdi)
+}
+  804ea0:	c3                   	ret
+
+0000000000804ea1 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804ea1:	55                   	push   %rbp
+  804ea2:	48 89 e5             	mov    %rsp,%rbp
+  804ea5:	53                   	push   %rbx
+  804ea6:	48 83 ec 08          	sub    $0x8,%rsp
+  804eaa:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804ead:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804eb4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804eba:	48 b8 72 4e 80 00 00 	movabs $0x804e72,%rax
+  804ec1:	00 00 00 
+  804ec4:	ff d0                	call   *%rax
+  804ec6:	48 85 c0             	test   %rax,%rax
+  804ec9:	74 12                	je     804edd <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804ecb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ed7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804edb:	c9                   	leave
+  804edc:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804edd:	b8 01 00 00 00       	mov    $0x1,%eax
+  804ee2:	eb f3                	jmp    804ed7 <chan_arm+0x36>
+
+0000000000804ee4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804ee4:	55                   	push   %rbp
+  804ee5:	48 89 e5             	mov    %rsp,%rbp
+  804ee8:	41 56                	push   %r14
+  804eea:	41 55                	push   %r13
+  804eec:	41 54                	push   %r12
+  804eee:	53                   	push   %rbx
+  804eef:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804ef2:	49 bc a1 4e 80 00 00 	movabs $0x804ea1,%r12
+  804ef9:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804efc:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804f00:	49 bd f5 20 80 00 00 	movabs $0x8020f5,%r13
+  804f07:	00 00 00 
+    while (chan_arm(r))
+  804f0a:	eb 0d                	jmp    804f19 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804f0c:	8b 33                	mov    (%rbx),%esi
+  804f0e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804f13:	4c 89 f7             	mov    %r14,%rdi
+  804f16:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804f19:	48 89 df             	mov    %rbx,%rdi
+  804f1c:	41 ff d4             	call   *%r12
+  804f1f:	84 c0                	test   %al,%al
+  804f21:	75 e9                	jne    804f0c <chan_wait+0x28>
+}
+  804f23:	5b                   	pop    %rbx
+  804f24:	41 5c                	pop    %r12
+  804f26:	41 5d                	pop    %r13
+  804f28:	41 5e                	pop    %r14
+  804f2a:	5d                   	pop    %rbp
+  804f2b:	c3                   	ret
+
+0000000000804f2c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804f2c:	55                   	push   %rbp
+  804f2d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804f30:	48 83 c7 40          	add    $0x40,%rdi
+  804f34:	be 01 00 00 00       	mov    $0x1,%esi
+  804f39:	48 b8 13 21 80 00 00 	movabs $0x802113,%rax
+  804f40:	00 00 00 
+  804f43:	ff d0                	call   *%rax
+}
+  804f45:	5d                   	pop    %rbp
+  804f46:	c3                   	ret
+
+0000000000804f47 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804f47:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f4c:	c3                   	ret
+
+0000000000804f4d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804f4d:	55                   	push   %rbp
+  804f4e:	48 89 e5             	mov    %rsp,%rbp
+  804f51:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804f54:	48 be 9c 5b 80 00 00 	movabs $0x805b9c,%rsi
+  804f5b:	00 00 00 
+  804f5e:	48 b8 28 18 80 00 00 	movabs $0x801828,%rax
+  804f65:	00 00 00 
+  804f68:	ff d0                	call   *%rax
+    return 0;
+}
+  804f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f6f:	5d                   	pop    %rbp
+  804f70:	c3                   	ret
+
+0000000000804f71 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804f71:	55                   	push   %rbp
+  804f72:	48 89 e5             	mov    %rsp,%rbp
+  804f75:	41 57                	push   %r15
+  804f77:	41 56                	push   %r14
+  804f79:	41 55                	push   %r13
+  804f7b:	41 54                	push   %r12
+  804f7d:	53                   	push   %rbx
+  804f7e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804f85:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804f8c:	48 85 d2             	test   %rdx,%rdx
+  804f8f:	74 7a                	je     80500b <devcons_write+0x9a>
+  804f91:	49 89 d6             	mov    %rdx,%r14
+  804f94:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804f9a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804f9f:	49 bf 22 1a 80 00 00 	movabs $0x801a22,%r15
+  804fa6:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804fa9:	4c 89 f3             	mov    %r14,%rbx
+  804fac:	48 29 f3             	sub    %rsi,%rbx
+  804faf:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804fb4:	48 39 c3             	cmp    %rax,%rbx
+  804fb7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804fbb:	4c 63 eb             	movslq %ebx,%r13
+  804fbe:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804fc5:	48 01 c6             	add    %rax,%rsi
+  804fc8:	4c 89 ea             	mov    %r13,%rdx
+  804fcb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804fd2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804fd5:	4c 89 ee             	mov    %r13,%rsi
+  804fd8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804fdf:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  804fe6:	00 00 00 
+  804fe9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804feb:	41 01 dc             	add    %ebx,%r12d
+  804fee:	49 63 f4             	movslq %r12d,%rsi
+  804ff1:	4c 39 f6             	cmp    %r14,%rsi
+  804ff4:	72 b3                	jb     804fa9 <devcons_write+0x38>
+    return res;
+  804ff6:	49 63 c4             	movslq %r12d,%rax
+}
+  804ff9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805000:	5b                   	pop    %rbx
+  805001:	41 5c                	pop    %r12
+  805003:	41 5d                	pop    %r13
+  805005:	41 5e                	pop    %r14
+  805007:	41 5f                	pop    %r15
+  805009:	5d                   	pop    %rbp
+  80500a:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80500b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805011:	eb e3                	jmp    804ff6 <devcons_write+0x85>
+
+0000000000805013 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805013:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80501b:	48 85 c0             	test   %rax,%rax
+  80501e:	74 55                	je     805075 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805020:	55                   	push   %rbp
+  805021:	48 89 e5             	mov    %rsp,%rbp
+  805024:	41 55                	push   %r13
+  805026:	41 54                	push   %r12
+  805028:	53                   	push   %rbx
+  805029:	48 83 ec 08          	sub    $0x8,%rsp
+  80502d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805030:	48 bb 6e 1c 80 00 00 	movabs $0x801c6e,%rbx
+  805037:	00 00 00 
+  80503a:	49 bc 23 1d 80 00 00 	movabs $0x801d23,%r12
+  805041:	00 00 00 
+  805044:	eb 03                	jmp    805049 <devcons_read+0x36>
+  805046:	41 ff d4             	call   *%r12
+  805049:	ff d3                	call   *%rbx
+  80504b:	85 c0                	test   %eax,%eax
+  80504d:	74 f7                	je     805046 <devcons_read+0x33>
+    if (c < 0) return c;
+  80504f:	48 63 d0             	movslq %eax,%rdx
+  805052:	78 13                	js     805067 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805054:	ba 00 00 00 00       	mov    $0x0,%edx
+  805059:	83 f8 04             	cmp    $0x4,%eax
+  80505c:	74 09                	je     805067 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80505e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  805062:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  805067:	48 89 d0             	mov    %rdx,%rax
+  80506a:	48 83 c4 08          	add    $0x8,%rsp
+  80506e:	5b                   	pop    %rbx
+  80506f:	41 5c                	pop    %r12
+  805071:	41 5d                	pop    %r13
+  805073:	5d                   	pop    %rbp
+  805074:	c3                   	ret
+  805075:	48 89 d0             	mov    %rdx,%rax
+  805078:	c3                   	ret
+
+0000000000805079 <cputchar>:
+cputchar(int ch) {
+  805079:	55                   	push   %rbp
+  80507a:	48 89 e5             	mov    %rsp,%rbp
+  80507d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  805081:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  805085:	be 01 00 00 00       	mov    $0x1,%esi
+  80508a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80508e:	48 b8 4f 1c 80 00 00 	movabs $0x801c4f,%rax
+  805095:	00 00 00 
+  805098:	ff d0                	call   *%rax
+}
+  80509a:	c9                   	leave
+  80509b:	c3                   	ret
+
+000000000080509c <getchar>:
+getchar(void) {
+  80509c:	55                   	push   %rbp
+  80509d:	48 89 e5             	mov    %rsp,%rbp
+  8050a0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8050a4:	ba 01 00 00 00       	mov    $0x1,%edx
+  8050a9:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8050ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050b2:	48 b8 f8 27 80 00 00 	movabs $0x8027f8,%rax
+  8050b9:	00 00 00 
+  8050bc:	ff d0                	call   *%rax
+  8050be:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8050c0:	85 c0                	test   %eax,%eax
+  8050c2:	78 06                	js     8050ca <getchar+0x2e>
+  8050c4:	74 08                	je     8050ce <getchar+0x32>
+  8050c6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8050ca:	89 d0                	mov    %edx,%eax
+  8050cc:	c9                   	leave
+  8050cd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8050ce:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8050d3:	eb f5                	jmp    8050ca <getchar+0x2e>
+
+00000000008050d5 <iscons>:
+iscons(int fdnum) {
+  8050d5:	55                   	push   %rbp
+  8050d6:	48 89 e5             	mov    %rsp,%rbp
+  8050d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8050dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8050e1:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8050e8:	00 00 00 
+  8050eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8050ed:	85 c0                	test   %eax,%eax
+  8050ef:	78 18                	js     805109 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8050f1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8050f5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8050fc:	00 00 00 
+  8050ff:	8b 00                	mov    (%rax),%eax
+  805101:	39 02                	cmp    %eax,(%rdx)
+  805103:	0f 94 c0             	sete   %al
+  805106:	0f b6 c0             	movzbl %al,%eax
+}
+  805109:	c9                   	leave
+  80510a:	c3                   	ret
+
+000000000080510b <opencons>:
+opencons(void) {
+  80510b:	55                   	push   %rbp
+  80510c:	48 89 e5             	mov    %rsp,%rbp
+  80510f:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805113:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805117:	48 b8 b5 24 80 00 00 	movabs $0x8024b5,%rax
+  80511e:	00 00 00 
+  805121:	ff d0                	call   *%rax
+  805123:	85 c0                	test   %eax,%eax
+  805125:	78 49                	js     805170 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805127:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80512c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805131:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80513a:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  805141:	00 00 00 
+  805144:	ff d0                	call   *%rax
+  805146:	85 c0                	test   %eax,%eax
+  805148:	78 26                	js     805170 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80514a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80514e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  805155:	00 00 
+  805157:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  805159:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80515d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  805164:	48 b8 87 24 80 00 00 	movabs $0x802487,%rax
+  80516b:	00 00 00 
+  80516e:	ff d0                	call   *%rax
+}
+  805170:	c9                   	leave
+  805171:	c3                   	ret
+
+0000000000805172 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  805172:	55                   	push   %rbp
+  805173:	48 89 e5             	mov    %rsp,%rbp
+  805176:	41 55                	push   %r13
+  805178:	41 54                	push   %r12
+  80517a:	53                   	push   %rbx
+  80517b:	48 83 ec 08          	sub    $0x8,%rsp
+  80517f:	49 89 fd             	mov    %rdi,%r13
+  805182:	48 89 f7             	mov    %rsi,%rdi
+  805185:	48 89 d3             	mov    %rdx,%rbx
+  805188:	49 89 cc             	mov    %rcx,%r12
+  80518b:	4c 89 c2             	mov    %r8,%rdx
+  80518e:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805191:	48 85 f6             	test   %rsi,%rsi
+  805194:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80519b:	00 00 00 
+  80519e:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8051a2:	be 00 10 00 00       	mov    $0x1000,%esi
+  8051a7:	48 85 db             	test   %rbx,%rbx
+  8051aa:	74 03                	je     8051af <ipc_recv_futex+0x3d>
+  8051ac:	48 8b 33             	mov    (%rbx),%rsi
+  8051af:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8051b3:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8051ba:	00 00 00 
+  8051bd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8051bf:	85 c0                	test   %eax,%eax
+  8051c1:	78 75                	js     805238 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8051c3:	4d 85 ed             	test   %r13,%r13
+  8051c6:	74 14                	je     8051dc <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8051c8:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  8051cf:	00 00 00 
+  8051d2:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8051d8:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8051dc:	4d 85 e4             	test   %r12,%r12
+  8051df:	74 14                	je     8051f5 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8051e1:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  8051e8:	00 00 00 
+  8051eb:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8051f1:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8051f5:	48 85 db             	test   %rbx,%rbx
+  8051f8:	74 23                	je     80521d <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8051fa:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  805201:	00 00 00 
+  805204:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80520a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80520f:	85 c9                	test   %ecx,%ecx
+  805211:	74 07                	je     80521a <ipc_recv_futex+0xa8>
+  805213:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80521a:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80521d:	48 a1 d0 01 81 00 00 	movabs 0x8101d0,%rax
+  805224:	00 00 00 
+  805227:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80522d:	48 83 c4 08          	add    $0x8,%rsp
+  805231:	5b                   	pop    %rbx
+  805232:	41 5c                	pop    %r12
+  805234:	41 5d                	pop    %r13
+  805236:	5d                   	pop    %rbp
+  805237:	c3                   	ret
+        if (from_env_store != NULL) {
+  805238:	4d 85 ed             	test   %r13,%r13
+  80523b:	74 08                	je     805245 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80523d:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  805244:	00 
+        if (perm_store != NULL) {
+  805245:	4d 85 e4             	test   %r12,%r12
+  805248:	74 08                	je     805252 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80524a:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805251:	00 
+        if (size != NULL) {
+  805252:	48 85 db             	test   %rbx,%rbx
+  805255:	74 d6                	je     80522d <ipc_recv_futex+0xbb>
+            *size = 0;
+  805257:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80525e:	eb cd                	jmp    80522d <ipc_recv_futex+0xbb>
+
+0000000000805260 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805260:	55                   	push   %rbp
+  805261:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  805264:	48 83 ec 08          	sub    $0x8,%rsp
+  805268:	6a 00                	push   $0x0
+  80526a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805276:	48 b8 72 51 80 00 00 	movabs $0x805172,%rax
+  80527d:	00 00 00 
+  805280:	ff d0                	call   *%rax
+}
+  805282:	c9                   	leave
+  805283:	c3                   	ret
+
+0000000000805284 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805284:	55                   	push   %rbp
+  805285:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805288:	48 85 d2             	test   %rdx,%rdx
+  80528b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805292:	00 00 00 
+  805295:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  805299:	89 f6                	mov    %esi,%esi
+  80529b:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  8052a2:	00 00 00 
+  8052a5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8052a7:	85 c0                	test   %eax,%eax
+  8052a9:	78 02                	js     8052ad <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8052ab:	5d                   	pop    %rbp
+  8052ac:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8052ad:	89 c1                	mov    %eax,%ecx
+  8052af:	48 ba a8 5b 80 00 00 	movabs $0x805ba8,%rdx
+  8052b6:	00 00 00 
+  8052b9:	be 50 00 00 00       	mov    $0x50,%esi
+  8052be:	48 bf bc 5b 80 00 00 	movabs $0x805bbc,%rdi
+  8052c5:	00 00 00 
+  8052c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052cd:	49 b8 b3 0d 80 00 00 	movabs $0x800db3,%r8
+  8052d4:	00 00 00 
+  8052d7:	41 ff d0             	call   *%r8
+
+00000000008052da <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8052da:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8052df:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8052e6:	00 00 00 
+  8052e9:	48 89 d0             	mov    %rdx,%rax
+  8052ec:	48 c1 e0 04          	shl    $0x4,%rax
+  8052f0:	48 29 d0             	sub    %rdx,%rax
+  8052f3:	48 c1 e0 05          	shl    $0x5,%rax
+  8052f7:	48 01 c8             	add    %rcx,%rax
+  8052fa:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805300:	39 f8                	cmp    %edi,%eax
+  805302:	74 13                	je     805317 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  805304:	48 83 c2 01          	add    $0x1,%rdx
+  805308:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80530f:	75 d8                	jne    8052e9 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805311:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805316:	c3                   	ret
+            return envs[i].env_id;
+  805317:	48 89 d0             	mov    %rdx,%rax
+  80531a:	48 c1 e0 04          	shl    $0x4,%rax
+  80531e:	48 29 d0             	sub    %rdx,%rax
+  805321:	48 c1 e0 05          	shl    $0x5,%rax
+  805325:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80532c:	00 00 00 
+  80532f:	48 01 d0             	add    %rdx,%rax
+  805332:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805338:	c3                   	ret
+  805339:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805340 <__rodata_start>:
+  805340:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  805345:	25 2d 38 73 20       	and    $0x2073382d,%eax
+  80534a:	25 2d 38 73 0a       	and    $0xa73382d,%eax
+  80534f:	00 72 31             	add    %dh,0x31(%rdx)
+  805352:	34 00                	xor    $0x0,%al
+  805354:	25 2d 36 73 20       	and    $0x2073362d,%eax
+  805359:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  80535e:	20 25 30 38 6c 78    	and    %ah,0x786c3830(%rip)        # 78ec8b94 <__bss_end+0x78687b94>
+  805364:	20 00                	and    %al,(%rax)
+  805366:	4f                   	rex.WRXB
+  805367:	4b 0a 00             	rex.WXB or (%r8),%al
+  80536a:	4d                   	rex.WRB
+  80536b:	49 53                	rex.WB push %r11
+  80536d:	4d                   	rex.WRB
+  80536e:	41 54                	push   %r12
+  805370:	43                   	rex.XB
+  805371:	48 0a 00             	rex.W or (%rax),%al
+  805374:	72 31                	jb     8053a7 <__rodata_start+0x67>
+  805376:	33 00                	xor    (%rax),%eax
+  805378:	72 31                	jb     8053ab <__rodata_start+0x6b>
+  80537a:	32 00                	xor    (%rax),%al
+  80537c:	72 31                	jb     8053af <__rodata_start+0x6f>
+  80537e:	31 00                	xor    %eax,(%rax)
+  805380:	72 31                	jb     8053b3 <__rodata_start+0x73>
+  805382:	30 00                	xor    %al,(%rax)
+  805384:	72 73                	jb     8053f9 <__rodata_start+0xb9>
+  805386:	69 00 72 64 69 00    	imul   $0x696472,(%rax),%eax
+  80538c:	72 62                	jb     8053f0 <__rodata_start+0xb0>
+  80538e:	70 00                	jo     805390 <__rodata_start+0x50>
+  805390:	72 62                	jb     8053f4 <__rodata_start+0xb4>
+  805392:	78 00                	js     805394 <__rodata_start+0x54>
+  805394:	72 64                	jb     8053fa <__rodata_start+0xba>
+  805396:	78 00                	js     805398 <__rodata_start+0x58>
+  805398:	72 63                	jb     8053fd <__rodata_start+0xbd>
+  80539a:	78 00                	js     80539c <__rodata_start+0x5c>
+  80539c:	72 61                	jb     8053ff <__rodata_start+0xbf>
+  80539e:	78 00                	js     8053a0 <__rodata_start+0x60>
+  8053a0:	72 69                	jb     80540b <__rodata_start+0xcb>
+  8053a2:	70 00                	jo     8053a4 <__rodata_start+0x64>
+  8053a4:	72 66                	jb     80540c <__rodata_start+0xcc>
+  8053a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8053a7:	61                   	(bad)
+  8053a8:	67 73 00             	addr32 jae 8053ab <__rodata_start+0x6b>
+  8053ab:	72 73                	jb     805420 <__rodata_start+0xe0>
+  8053ad:	70 00                	jo     8053af <__rodata_start+0x6f>
+  8053af:	52                   	push   %rdx
+  8053b0:	65 67 69 73 74 65 72 	imul   $0x20737265,%gs:0x74(%ebx),%esi
+  8053b7:	73 20 
+  8053b9:	25 73 20 00 75       	and    $0x75002073,%eax
+  8053be:	73 65                	jae    805425 <__rodata_start+0xe5>
+  8053c0:	72 2f                	jb     8053f1 <__rodata_start+0xb1>
+  8053c2:	66 61                	data16 (bad)
+  8053c4:	75 6c                	jne    805432 <__rodata_start+0xf2>
+  8053c6:	74 72                	je     80543a <__rodata_start+0xfa>
+  8053c8:	65 67 73 2e          	gs addr32 jae 8053fa <__rodata_start+0xba>
+  8053cc:	63 00                	movsxd (%rax),%eax
+  8053ce:	69 6e 20 55 54 72 61 	imul   $0x61725455,0x20(%rsi),%ebp
+  8053d5:	70 66                	jo     80543d <__rodata_start+0xfd>
+  8053d7:	72 61                	jb     80543a <__rodata_start+0xfa>
+  8053d9:	6d                   	insl   (%dx),%es:(%rdi)
+  8053da:	65 00 64 75 72       	add    %ah,%gs:0x72(%rbp,%rsi,2)
+  8053df:	69 6e 67 00 62 65 66 	imul   $0x66656200,0x67(%rsi),%ebp
+  8053e6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053e7:	72 65                	jb     80544e <__rodata_start+0x10e>
+  8053e9:	00 73 79             	add    %dh,0x79(%rbx)
+  8053ec:	73 5f                	jae    80544d <__rodata_start+0x10d>
+  8053ee:	70 61                	jo     805451 <__rodata_start+0x111>
+  8053f0:	67 65 5f             	addr32 gs pop %rdi
+  8053f3:	61                   	(bad)
+  8053f4:	6c                   	insb   (%dx),%es:(%rdi)
+  8053f5:	6c                   	insb   (%dx),%es:(%rdi)
+  8053f6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053f7:	63 3a                	movsxd (%rdx),%edi
+  8053f9:	20 25 69 00 61 66    	and    %ah,0x66610069(%rip)        # 66e15468 <__bss_end+0x665d4468>
+  8053ff:	74 65                	je     805466 <__rodata_start+0x126>
+  805401:	72 20                	jb     805423 <__rodata_start+0xe3>
+  805403:	70 61                	jo     805466 <__rodata_start+0x126>
+  805405:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  80540c:	74 00                	je     80540e <__rodata_start+0xce>
+  80540e:	61                   	(bad)
+  80540f:	66 74 65             	data16 je 805477 <__rodata_start+0x137>
+  805412:	72 00                	jb     805414 <__rodata_start+0xd4>
+  805414:	0f 1f 40 00          	nopl   0x0(%rax)
+  805418:	70 67                	jo     805481 <__rodata_start+0x141>
+  80541a:	66 61                	data16 (bad)
+  80541c:	75 6c                	jne    80548a <__rodata_start+0x14a>
+  80541e:	74 20                	je     805440 <__rodata_start+0x100>
+  805420:	65 78 70             	gs js  805493 <__rodata_start+0x153>
+  805423:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805428:	20 61 74             	and    %ah,0x74(%rcx)
+  80542b:	20 55 54             	and    %dl,0x54(%rbp)
+  80542e:	45                   	rex.RB
+  80542f:	4d 50                	rex.WRB push %r8
+  805431:	2c 20                	sub    $0x20,%al
+  805433:	67 6f                	outsl  %ds:(%esi),(%dx)
+  805435:	74 20                	je     805457 <__rodata_start+0x117>
+  805437:	30 78 25             	xor    %bh,0x25(%rax)
+  80543a:	30 38                	xor    %bh,(%rax)
+  80543c:	6c                   	insb   (%dx),%es:(%rdi)
+  80543d:	78 20                	js     80545f <__rodata_start+0x11f>
+  80543f:	28 72 69             	sub    %dh,0x69(%rdx)
+  805442:	70 20                	jo     805464 <__rodata_start+0x124>
+  805444:	25 30 38 6c 78       	and    $0x786c3830,%eax
+  805449:	29 00                	sub    %eax,(%rax)
+  80544b:	00 00                	add    %al,(%rax)
+  80544d:	00 00                	add    %al,(%rax)
+  80544f:	00 52 49             	add    %dl,0x49(%rdx)
+  805452:	50                   	push   %rax
+  805453:	20 61 66             	and    %ah,0x66(%rcx)
+  805456:	74 65                	je     8054bd <__rodata_start+0x17d>
+  805458:	72 20                	jb     80547a <__rodata_start+0x13a>
+  80545a:	70 61                	jo     8054bd <__rodata_start+0x17d>
+  80545c:	67 65 2d 66 61 75 6c 	addr32 gs sub $0x6c756166,%eax
+  805463:	74 20                	je     805485 <__rodata_start+0x145>
+  805465:	4d                   	rex.WRB
+  805466:	49 53                	rex.WB push %r11
+  805468:	4d                   	rex.WRB
+  805469:	41 54                	push   %r12
+  80546b:	43                   	rex.XB
+  80546c:	48 0a 00             	rex.W or (%rax),%al
+  80546f:	3c 75                	cmp    $0x75,%al
+  805471:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805472:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  805476:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805477:	3e 00 0f             	ds add %cl,(%rdi)
+  80547a:	1f                   	(bad)
+  80547b:	80 00 00             	addb   $0x0,(%rax)
+  80547e:	00 00                	add    %al,(%rax)
+  805480:	5b                   	pop    %rbx
+  805481:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  805486:	20 75 73             	and    %dh,0x73(%rbp)
+  805489:	65 72 20             	gs jb  8054ac <__rodata_start+0x16c>
+  80548c:	70 61                	jo     8054ef <__rodata_start+0x1af>
+  80548e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80548f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805496:	73 20                	jae    8054b8 <__rodata_start+0x178>
+  805498:	61                   	(bad)
+  805499:	74 20                	je     8054bb <__rodata_start+0x17b>
+  80549b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8054a0:	3a 20                	cmp    (%rax),%ah
+  8054a2:	00 30                	add    %dh,(%rax)
+  8054a4:	31 32                	xor    %esi,(%rdx)
+  8054a6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8054ad:	41                   	rex.B
+  8054ae:	42                   	rex.X
+  8054af:	43                   	rex.XB
+  8054b0:	44                   	rex.R
+  8054b1:	45                   	rex.RB
+  8054b2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8054b5:	31 32                	xor    %esi,(%rdx)
+  8054b7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8054be:	61                   	(bad)
+  8054bf:	62 63 64 65 66       	(bad)
+  8054c4:	00 28                	add    %ch,(%rax)
+  8054c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054c7:	75 6c                	jne    805535 <__rodata_start+0x1f5>
+  8054c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8054ca:	29 00                	sub    %eax,(%rax)
+  8054cc:	65 72 72             	gs jb  805541 <__rodata_start+0x201>
+  8054cf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054d0:	72 20                	jb     8054f2 <__rodata_start+0x1b2>
+  8054d2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8054d7:	73 70                	jae    805549 <__rodata_start+0x209>
+  8054d9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8054dd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8054e4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054e5:	72 00                	jb     8054e7 <__rodata_start+0x1a7>
+  8054e7:	62 61 64 20 65       	(bad)
+  8054ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054ed:	76 69                	jbe    805558 <__rodata_start+0x218>
+  8054ef:	72 6f                	jb     805560 <__rodata_start+0x220>
+  8054f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8054f3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8054f5:	74 00                	je     8054f7 <__rodata_start+0x1b7>
+  8054f7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8054fe:	20 70 61             	and    %dh,0x61(%rax)
+  805501:	72 61                	jb     805564 <__rodata_start+0x224>
+  805503:	6d                   	insl   (%dx),%es:(%rdi)
+  805504:	65 74 65             	gs je  80556c <__rodata_start+0x22c>
+  805507:	72 00                	jb     805509 <__rodata_start+0x1c9>
+  805509:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80550a:	75 74                	jne    805580 <__rodata_start+0x240>
+  80550c:	20 6f 66             	and    %ch,0x66(%rdi)
+  80550f:	20 6d 65             	and    %ch,0x65(%rbp)
+  805512:	6d                   	insl   (%dx),%es:(%rdi)
+  805513:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805514:	72 79                	jb     80558f <__rodata_start+0x24f>
+  805516:	00 6f 75             	add    %ch,0x75(%rdi)
+  805519:	74 20                	je     80553b <__rodata_start+0x1fb>
+  80551b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80551c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805520:	76 69                	jbe    80558b <__rodata_start+0x24b>
+  805522:	72 6f                	jb     805593 <__rodata_start+0x253>
+  805524:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805525:	6d                   	insl   (%dx),%es:(%rdi)
+  805526:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805528:	74 73                	je     80559d <__rodata_start+0x25d>
+  80552a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80552d:	72 72                	jb     8055a1 <__rodata_start+0x261>
+  80552f:	75 70                	jne    8055a1 <__rodata_start+0x261>
+  805531:	74 65                	je     805598 <__rodata_start+0x258>
+  805533:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805538:	75 67                	jne    8055a1 <__rodata_start+0x261>
+  80553a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80553d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80553f:	00 73 65             	add    %dh,0x65(%rbx)
+  805542:	67 6d                	insl   (%dx),%es:(%edi)
+  805544:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805546:	74 61                	je     8055a9 <__rodata_start+0x269>
+  805548:	74 69                	je     8055b3 <__rodata_start+0x273>
+  80554a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80554b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80554c:	20 66 61             	and    %ah,0x61(%rsi)
+  80554f:	75 6c                	jne    8055bd <__rodata_start+0x27d>
+  805551:	74 00                	je     805553 <__rodata_start+0x213>
+  805553:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80555a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80555d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805561:	61                   	(bad)
+  805562:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805567:	20 73 75             	and    %dh,0x75(%rbx)
+  80556a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80556d:	73 79                	jae    8055e8 <__rodata_start+0x2a8>
+  80556f:	73 74                	jae    8055e5 <__rodata_start+0x2a5>
+  805571:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805573:	20 63 61             	and    %ah,0x61(%rbx)
+  805576:	6c                   	insb   (%dx),%es:(%rdi)
+  805577:	6c                   	insb   (%dx),%es:(%rdi)
+  805578:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80557b:	74 72                	je     8055ef <__rodata_start+0x2af>
+  80557d:	79 20                	jns    80559f <__rodata_start+0x25f>
+  80557f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805580:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805581:	74 20                	je     8055a3 <__rodata_start+0x263>
+  805583:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805585:	75 6e                	jne    8055f5 <__rodata_start+0x2b5>
+  805587:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80558b:	76 20                	jbe    8055ad <__rodata_start+0x26d>
+  80558d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805594:	72 65                	jb     8055fb <__rodata_start+0x2bb>
+  805596:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805599:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80559a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80559e:	65 78 70             	gs js  805611 <__rodata_start+0x2d1>
+  8055a1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8055a6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8055a9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8055ad:	20 66 69             	and    %ah,0x69(%rsi)
+  8055b0:	6c                   	insb   (%dx),%es:(%rdi)
+  8055b1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8055b5:	20 66 72             	and    %ah,0x72(%rsi)
+  8055b8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8055bd:	61                   	(bad)
+  8055be:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8055c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055c3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8055c7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8055ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055cc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8055cf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055d0:	79 20                	jns    8055f2 <__rodata_start+0x2b2>
+  8055d2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8055d9:	72 65                	jb     805640 <__rodata_start+0x300>
+  8055db:	20 6f 70             	and    %ch,0x70(%rdi)
+  8055de:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8055e0:	00 66 69             	add    %ah,0x69(%rsi)
+  8055e3:	6c                   	insb   (%dx),%es:(%rdi)
+  8055e4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8055e8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8055eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055ec:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8055ef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055f0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055f1:	74 20                	je     805613 <__rodata_start+0x2d3>
+  8055f3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8055f5:	75 6e                	jne    805665 <__rodata_start+0x325>
+  8055f7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8055fb:	76 61                	jbe    80565e <__rodata_start+0x31e>
+  8055fd:	6c                   	insb   (%dx),%es:(%rdi)
+  8055fe:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805605:	00 
+  805606:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  80560d:	72 65                	jb     805674 <__rodata_start+0x334>
+  80560f:	61                   	(bad)
+  805610:	64 79 20             	fs jns 805633 <__rodata_start+0x2f3>
+  805613:	65 78 69             	gs js  80567f <__rodata_start+0x33f>
+  805616:	73 74                	jae    80568c <__rodata_start+0x34c>
+  805618:	73 00                	jae    80561a <__rodata_start+0x2da>
+  80561a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80561b:	70 65                	jo     805682 <__rodata_start+0x342>
+  80561d:	72 61                	jb     805680 <__rodata_start+0x340>
+  80561f:	74 69                	je     80568a <__rodata_start+0x34a>
+  805621:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805622:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805623:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805626:	74 20                	je     805648 <__rodata_start+0x308>
+  805628:	73 75                	jae    80569f <__rodata_start+0x35f>
+  80562a:	70 70                	jo     80569c <__rodata_start+0x35c>
+  80562c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80562d:	72 74                	jb     8056a3 <__rodata_start+0x363>
+  80562f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805635:	20 61 67             	and    %ah,0x67(%rcx)
+  805638:	61                   	(bad)
+  805639:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805640:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805644:	74 00                	je     805646 <__rodata_start+0x306>
+  805646:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80564d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805650:	20 75 73             	and    %dh,0x73(%rbp)
+  805653:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805657:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80565e:	00 
+  80565f:	90                   	nop
+  805660:	f0 10 80 00 00 00 00 	lock adc %al,0x0(%rax)
+  805667:	00 31                	add    %dh,(%rcx)
+  805669:	17                   	(bad)
+  80566a:	80 00 00             	addb   $0x0,(%rax)
+  80566d:	00 00                	add    %al,(%rax)
+  80566f:	00 21                	add    %ah,(%rcx)
+  805671:	17                   	(bad)
+  805672:	80 00 00             	addb   $0x0,(%rax)
+  805675:	00 00                	add    %al,(%rax)
+  805677:	00 31                	add    %dh,(%rcx)
+  805679:	17                   	(bad)
+  80567a:	80 00 00             	addb   $0x0,(%rax)
+  80567d:	00 00                	add    %al,(%rax)
+  80567f:	00 31                	add    %dh,(%rcx)
+  805681:	17                   	(bad)
+  805682:	80 00 00             	addb   $0x0,(%rax)
+  805685:	00 00                	add    %al,(%rax)
+  805687:	00 31                	add    %dh,(%rcx)
+  805689:	17                   	(bad)
+  80568a:	80 00 00             	addb   $0x0,(%rax)
+  80568d:	00 00                	add    %al,(%rax)
+  80568f:	00 31                	add    %dh,(%rcx)
+  805691:	17                   	(bad)
+  805692:	80 00 00             	addb   $0x0,(%rax)
+  805695:	00 00                	add    %al,(%rax)
+  805697:	00 0f                	add    %cl,(%rdi)
+  805699:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  80569f:	00 31                	add    %dh,(%rcx)
+  8056a1:	17                   	(bad)
+  8056a2:	80 00 00             	addb   $0x0,(%rax)
+  8056a5:	00 00                	add    %al,(%rax)
+  8056a7:	00 31                	add    %dh,(%rcx)
+  8056a9:	17                   	(bad)
+  8056aa:	80 00 00             	addb   $0x0,(%rax)
+  8056ad:	00 00                	add    %al,(%rax)
+  8056af:	00 03                	add    %al,(%rbx)
+  8056b1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8056b7:	00 7d 11             	add    %bh,0x11(%rbp)
+  8056ba:	80 00 00             	addb   $0x0,(%rax)
+  8056bd:	00 00                	add    %al,(%rax)
+  8056bf:	00 31                	add    %dh,(%rcx)
+  8056c1:	17                   	(bad)
+  8056c2:	80 00 00             	addb   $0x0,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 03                	add    %al,(%rbx)
+  8056c9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  8056cf:	00 49 11             	add    %cl,0x11(%rcx)
+  8056d2:	80 00 00             	addb   $0x0,(%rax)
+  8056d5:	00 00                	add    %al,(%rax)
+  8056d7:	00 49 11             	add    %cl,0x11(%rcx)
+  8056da:	80 00 00             	addb   $0x0,(%rax)
+  8056dd:	00 00                	add    %al,(%rax)
+  8056df:	00 49 11             	add    %cl,0x11(%rcx)
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 49 11             	add    %cl,0x11(%rcx)
+  8056ea:	80 00 00             	addb   $0x0,(%rax)
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 49 11             	add    %cl,0x11(%rcx)
+  8056f2:	80 00 00             	addb   $0x0,(%rax)
+  8056f5:	00 00                	add    %al,(%rax)
+  8056f7:	00 49 11             	add    %cl,0x11(%rcx)
+  8056fa:	80 00 00             	addb   $0x0,(%rax)
+  8056fd:	00 00                	add    %al,(%rax)
+  8056ff:	00 49 11             	add    %cl,0x11(%rcx)
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 49 11             	add    %cl,0x11(%rcx)
+  80570a:	80 00 00             	addb   $0x0,(%rax)
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 49 11             	add    %cl,0x11(%rcx)
+  805712:	80 00 00             	addb   $0x0,(%rax)
+  805715:	00 00                	add    %al,(%rax)
+  805717:	00 31                	add    %dh,(%rcx)
+  805719:	17                   	(bad)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 31                	add    %dh,(%rcx)
+  805721:	17                   	(bad)
+  805722:	80 00 00             	addb   $0x0,(%rax)
+  805725:	00 00                	add    %al,(%rax)
+  805727:	00 31                	add    %dh,(%rcx)
+  805729:	17                   	(bad)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 31                	add    %dh,(%rcx)
+  805731:	17                   	(bad)
+  805732:	80 00 00             	addb   $0x0,(%rax)
+  805735:	00 00                	add    %al,(%rax)
+  805737:	00 31                	add    %dh,(%rcx)
+  805739:	17                   	(bad)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 31                	add    %dh,(%rcx)
+  805741:	17                   	(bad)
+  805742:	80 00 00             	addb   $0x0,(%rax)
+  805745:	00 00                	add    %al,(%rax)
+  805747:	00 31                	add    %dh,(%rcx)
+  805749:	17                   	(bad)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 31                	add    %dh,(%rcx)
+  805751:	17                   	(bad)
+  805752:	80 00 00             	addb   $0x0,(%rax)
+  805755:	00 00                	add    %al,(%rax)
+  805757:	00 31                	add    %dh,(%rcx)
+  805759:	17                   	(bad)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 31                	add    %dh,(%rcx)
+  805761:	17                   	(bad)
+  805762:	80 00 00             	addb   $0x0,(%rax)
+  805765:	00 00                	add    %al,(%rax)
+  805767:	00 31                	add    %dh,(%rcx)
+  805769:	17                   	(bad)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 31                	add    %dh,(%rcx)
+  805771:	17                   	(bad)
+  805772:	80 00 00             	addb   $0x0,(%rax)
+  805775:	00 00                	add    %al,(%rax)
+  805777:	00 31                	add    %dh,(%rcx)
+  805779:	17                   	(bad)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 31                	add    %dh,(%rcx)
+  805781:	17                   	(bad)
+  805782:	80 00 00             	addb   $0x0,(%rax)
+  805785:	00 00                	add    %al,(%rax)
+  805787:	00 31                	add    %dh,(%rcx)
+  805789:	17                   	(bad)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 31                	add    %dh,(%rcx)
+  805791:	17                   	(bad)
+  805792:	80 00 00             	addb   $0x0,(%rax)
+  805795:	00 00                	add    %al,(%rax)
+  805797:	00 31                	add    %dh,(%rcx)
+  805799:	17                   	(bad)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 31                	add    %dh,(%rcx)
+  8057a1:	17                   	(bad)
+  8057a2:	80 00 00             	addb   $0x0,(%rax)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 31                	add    %dh,(%rcx)
+  8057a9:	17                   	(bad)
+  8057aa:	80 00 00             	addb   $0x0,(%rax)
+  8057ad:	00 00                	add    %al,(%rax)
+  8057af:	00 31                	add    %dh,(%rcx)
+  8057b1:	17                   	(bad)
+  8057b2:	80 00 00             	addb   $0x0,(%rax)
+  8057b5:	00 00                	add    %al,(%rax)
+  8057b7:	00 31                	add    %dh,(%rcx)
+  8057b9:	17                   	(bad)
+  8057ba:	80 00 00             	addb   $0x0,(%rax)
+  8057bd:	00 00                	add    %al,(%rax)
+  8057bf:	00 31                	add    %dh,(%rcx)
+  8057c1:	17                   	(bad)
+  8057c2:	80 00 00             	addb   $0x0,(%rax)
+  8057c5:	00 00                	add    %al,(%rax)
+  8057c7:	00 31                	add    %dh,(%rcx)
+  8057c9:	17                   	(bad)
+  8057ca:	80 00 00             	addb   $0x0,(%rax)
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 31                	add    %dh,(%rcx)
+  8057d1:	17                   	(bad)
+  8057d2:	80 00 00             	addb   $0x0,(%rax)
+  8057d5:	00 00                	add    %al,(%rax)
+  8057d7:	00 31                	add    %dh,(%rcx)
+  8057d9:	17                   	(bad)
+  8057da:	80 00 00             	addb   $0x0,(%rax)
+  8057dd:	00 00                	add    %al,(%rax)
+  8057df:	00 31                	add    %dh,(%rcx)
+  8057e1:	17                   	(bad)
+  8057e2:	80 00 00             	addb   $0x0,(%rax)
+  8057e5:	00 00                	add    %al,(%rax)
+  8057e7:	00 31                	add    %dh,(%rcx)
+  8057e9:	17                   	(bad)
+  8057ea:	80 00 00             	addb   $0x0,(%rax)
+  8057ed:	00 00                	add    %al,(%rax)
+  8057ef:	00 31                	add    %dh,(%rcx)
+  8057f1:	17                   	(bad)
+  8057f2:	80 00 00             	addb   $0x0,(%rax)
+  8057f5:	00 00                	add    %al,(%rax)
+  8057f7:	00 31                	add    %dh,(%rcx)
+  8057f9:	17                   	(bad)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 31                	add    %dh,(%rcx)
+  805801:	17                   	(bad)
+  805802:	80 00 00             	addb   $0x0,(%rax)
+  805805:	00 00                	add    %al,(%rax)
+  805807:	00 54 16 80          	add    %dl,-0x80(%rsi,%rdx,1)
+  80580b:	00 00                	add    %al,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 31                	add    %dh,(%rcx)
+  805811:	17                   	(bad)
+  805812:	80 00 00             	addb   $0x0,(%rax)
+  805815:	00 00                	add    %al,(%rax)
+  805817:	00 31                	add    %dh,(%rcx)
+  805819:	17                   	(bad)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 31                	add    %dh,(%rcx)
+  805821:	17                   	(bad)
+  805822:	80 00 00             	addb   $0x0,(%rax)
+  805825:	00 00                	add    %al,(%rax)
+  805827:	00 31                	add    %dh,(%rcx)
+  805829:	17                   	(bad)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 31                	add    %dh,(%rcx)
+  805831:	17                   	(bad)
+  805832:	80 00 00             	addb   $0x0,(%rax)
+  805835:	00 00                	add    %al,(%rax)
+  805837:	00 31                	add    %dh,(%rcx)
+  805839:	17                   	(bad)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 31                	add    %dh,(%rcx)
+  805841:	17                   	(bad)
+  805842:	80 00 00             	addb   $0x0,(%rax)
+  805845:	00 00                	add    %al,(%rax)
+  805847:	00 31                	add    %dh,(%rcx)
+  805849:	17                   	(bad)
+  80584a:	80 00 00             	addb   $0x0,(%rax)
+  80584d:	00 00                	add    %al,(%rax)
+  80584f:	00 31                	add    %dh,(%rcx)
+  805851:	17                   	(bad)
+  805852:	80 00 00             	addb   $0x0,(%rax)
+  805855:	00 00                	add    %al,(%rax)
+  805857:	00 31                	add    %dh,(%rcx)
+  805859:	17                   	(bad)
+  80585a:	80 00 00             	addb   $0x0,(%rax)
+  80585d:	00 00                	add    %al,(%rax)
+  80585f:	00 a0 11 80 00 00    	add    %ah,0x8011(%rax)
+  805865:	00 00                	add    %al,(%rax)
+  805867:	00 6f 13             	add    %ch,0x13(%rdi)
+  80586a:	80 00 00             	addb   $0x0,(%rax)
+  80586d:	00 00                	add    %al,(%rax)
+  80586f:	00 31                	add    %dh,(%rcx)
+  805871:	17                   	(bad)
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 31                	add    %dh,(%rcx)
+  805879:	17                   	(bad)
+  80587a:	80 00 00             	addb   $0x0,(%rax)
+  80587d:	00 00                	add    %al,(%rax)
+  80587f:	00 31                	add    %dh,(%rcx)
+  805881:	17                   	(bad)
+  805882:	80 00 00             	addb   $0x0,(%rax)
+  805885:	00 00                	add    %al,(%rax)
+  805887:	00 31                	add    %dh,(%rcx)
+  805889:	17                   	(bad)
+  80588a:	80 00 00             	addb   $0x0,(%rax)
+  80588d:	00 00                	add    %al,(%rax)
+  80588f:	00 cf                	add    %cl,%bh
+  805891:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805897:	00 31                	add    %dh,(%rcx)
+  805899:	17                   	(bad)
+  80589a:	80 00 00             	addb   $0x0,(%rax)
+  80589d:	00 00                	add    %al,(%rax)
+  80589f:	00 31                	add    %dh,(%rcx)
+  8058a1:	17                   	(bad)
+  8058a2:	80 00 00             	addb   $0x0,(%rax)
+  8058a5:	00 00                	add    %al,(%rax)
+  8058a7:	00 95 11 80 00 00    	add    %dl,0x8011(%rbp)
+  8058ad:	00 00                	add    %al,(%rax)
+  8058af:	00 31                	add    %dh,(%rcx)
+  8058b1:	17                   	(bad)
+  8058b2:	80 00 00             	addb   $0x0,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 31                	add    %dh,(%rcx)
+  8058b9:	17                   	(bad)
+  8058ba:	80 00 00             	addb   $0x0,(%rax)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 17                	add    %dl,(%rdi)
+  8058c1:	15 80 00 00 00       	adc    $0x80,%eax
+  8058c6:	00 00                	add    %al,(%rax)
+  8058c8:	e1 15                	loope  8058df <__rodata_start+0x59f>
+  8058ca:	80 00 00             	addb   $0x0,(%rax)
+  8058cd:	00 00                	add    %al,(%rax)
+  8058cf:	00 31                	add    %dh,(%rcx)
+  8058d1:	17                   	(bad)
+  8058d2:	80 00 00             	addb   $0x0,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 31                	add    %dh,(%rcx)
+  8058d9:	17                   	(bad)
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 66 12             	add    %ah,0x12(%rsi)
+  8058e2:	80 00 00             	addb   $0x0,(%rax)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 31                	add    %dh,(%rcx)
+  8058e9:	17                   	(bad)
+  8058ea:	80 00 00             	addb   $0x0,(%rax)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 43 14             	add    %al,0x14(%rbx)
+  8058f2:	80 00 00             	addb   $0x0,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 31                	add    %dh,(%rcx)
+  8058f9:	17                   	(bad)
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 31                	add    %dh,(%rcx)
+  805901:	17                   	(bad)
+  805902:	80 00 00             	addb   $0x0,(%rax)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 54 16 80          	add    %dl,-0x80(%rsi,%rdx,1)
+  80590b:	00 00                	add    %al,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 31                	add    %dh,(%rcx)
+  805911:	17                   	(bad)
+  805912:	80 00 00             	addb   $0x0,(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 f9                	add    %bh,%cl
+  805919:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+	...
+
+0000000000805920 <error_string>:
+	...
+  805928:	d5 54 80 00 00 00 00 00 e7 54 80 00 00 00 00 00     .T.......T......
+  805938:	f7 54 80 00 00 00 00 00 09 55 80 00 00 00 00 00     .T.......U......
+  805948:	17 55 80 00 00 00 00 00 2b 55 80 00 00 00 00 00     .U......+U......
+  805958:	40 55 80 00 00 00 00 00 53 55 80 00 00 00 00 00     @U......SU......
+  805968:	65 55 80 00 00 00 00 00 79 55 80 00 00 00 00 00     eU......yU......
+  805978:	89 55 80 00 00 00 00 00 9c 55 80 00 00 00 00 00     .U.......U......
+  805988:	b3 55 80 00 00 00 00 00 c9 55 80 00 00 00 00 00     .U.......U......
+  805998:	e1 55 80 00 00 00 00 00 f9 55 80 00 00 00 00 00     .U.......U......
+  8059a8:	06 56 80 00 00 00 00 00 d8 59 80 00 00 00 00 00     .V.......Y......
+  8059b8:	1a 56 80 00 00 00 00 00 32 56 80 00 00 00 00 00     .V......2V......
+  8059c8:	3c 56 80 00 00 00 00 00 46 56 80 00 00 00 00 00     <V......FV......
+  8059d8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8059e8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8059f8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805a08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805a18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805a28:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805a38:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805a48:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805a58:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805a68:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805a78:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805a88:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805a98:	61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65 64     assertion failed
+  805aa8:	3a 20 25 73 00 0f 1f 00 5b 25 30 38 78 5d 20 75     : %s....[%08x] u
+  805ab8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805ac8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805ad8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805ae8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805af8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805b08:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805b18:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805b28:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b38:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805b40 <devtab>:
+  805b40:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805b50:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805b60:	3c 70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e     <pipe>.lib/pipe.
+  805b70:	63 00 70 69 70 65 00 90 73 79 73 5f 72 65 67 69     c.pipe..sys_regi
+  805b80:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805b90:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  805ba0:	73 3e 00 63 6f 6e 73 00 69 70 63 5f 73 65 6e 64     s>.cons.ipc_send
+  805bb0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805bc0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
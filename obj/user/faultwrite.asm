@@ -0,0 +1,7878 @@
+
+obj/user/faultwrite:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 0e 00 00 00       	call   800031 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+#ifndef __clang_analyzer__
+    *(volatile unsigned *)0 = 0;
+  800025:	c7 04 25 00 00 00 00 	movl   $0x0,0x0
+  80002c:	00 00 00 00 
+#endif
+}
+  800030:	c3                   	ret
+
+0000000000800031 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800031:	55                   	push   %rbp
+  800032:	48 89 e5             	mov    %rsp,%rbp
+  800035:	41 56                	push   %r14
+  800037:	41 55                	push   %r13
+  800039:	41 54                	push   %r12
+  80003b:	53                   	push   %rbx
+  80003c:	41 89 fd             	mov    %edi,%r13d
+  80003f:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800042:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800049:	00 00 00 
+  80004c:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800053:	00 00 00 
+  800056:	48 39 c2             	cmp    %rax,%rdx
+  800059:	73 17                	jae    800072 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80005b:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80005e:	49 89 c4             	mov    %rax,%r12
+  800061:	48 83 c3 08          	add    $0x8,%rbx
+  800065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006a:	ff 53 f8             	call   *-0x8(%rbx)
+  80006d:	4c 39 e3             	cmp    %r12,%rbx
+  800070:	72 ef                	jb     800061 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800072:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  800079:	00 00 00 
+  80007c:	ff d0                	call   *%rax
+  80007e:	89 c2                	mov    %eax,%edx
+  800080:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800086:	48 89 d0             	mov    %rdx,%rax
+  800089:	48 c1 e0 04          	shl    $0x4,%rax
+  80008d:	48 29 d0             	sub    %rdx,%rax
+  800090:	48 c1 e0 05          	shl    $0x5,%rax
+  800094:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80009b:	00 00 00 
+  80009e:	48 01 d0             	add    %rdx,%rax
+  8000a1:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000a8:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000ab:	45 85 ed             	test   %r13d,%r13d
+  8000ae:	7e 0d                	jle    8000bd <libmain+0x8c>
+  8000b0:	49 8b 06             	mov    (%r14),%rax
+  8000b3:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000ba:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000bd:	4c 89 f6             	mov    %r14,%rsi
+  8000c0:	44 89 ef             	mov    %r13d,%edi
+  8000c3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000ca:	00 00 00 
+  8000cd:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000cf:	48 b8 e4 00 80 00 00 	movabs $0x8000e4,%rax
+  8000d6:	00 00 00 
+  8000d9:	ff d0                	call   *%rax
+#endif
+}
+  8000db:	5b                   	pop    %rbx
+  8000dc:	41 5c                	pop    %r12
+  8000de:	41 5d                	pop    %r13
+  8000e0:	41 5e                	pop    %r14
+  8000e2:	5d                   	pop    %rbp
+  8000e3:	c3                   	ret
+
+00000000008000e4 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e4:	55                   	push   %rbp
+  8000e5:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000e8:	48 b8 98 08 80 00 00 	movabs $0x800898,%rax
+  8000ef:	00 00 00 
+  8000f2:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f9:	48 b8 4f 01 80 00 00 	movabs $0x80014f,%rax
+  800100:	00 00 00 
+  800103:	ff d0                	call   *%rax
+}
+  800105:	5d                   	pop    %rbp
+  800106:	c3                   	ret
+
+0000000000800107 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800107:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80010c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800111:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80011d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800123:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800125:	c3                   	ret
+
+0000000000800126 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800126:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80012b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800130:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800140:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800146:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80014c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80014e:	c3                   	ret
+
+000000000080014f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80014f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800152:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800157:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80015c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800161:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800173:	0f 05                	syscall
+    if (check && ret > 0) {
+  800175:	48 85 c0             	test   %rax,%rax
+  800178:	7f 01                	jg     80017b <sys_env_destroy+0x2c>
+}
+  80017a:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80017b:	55                   	push   %rbp
+  80017c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80017f:	49 89 c0             	mov    %rax,%r8
+  800182:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800187:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  80018e:	00 00 00 
+  800191:	be 29 00 00 00       	mov    $0x29,%esi
+  800196:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  8001ac:	00 00 00 
+  8001af:	41 ff d1             	call   *%r9
+
+00000000008001b2 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001b2:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001bc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001d8:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001da:	c3                   	ret
+
+00000000008001db <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001db:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001ef:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800201:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800203:	c3                   	ret
+
+0000000000800204 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800204:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800209:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800210:	00 00 00 
+  800213:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800219:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800225:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800227:	c3                   	ret
+
+0000000000800228 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800228:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80022b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800230:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800236:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80023c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80023e:	c3                   	ret
+
+000000000080023f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80023f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800242:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800247:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80024a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800250:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800256:	0f 05                	syscall
+    if (check && ret > 0) {
+  800258:	48 85 c0             	test   %rax,%rax
+  80025b:	7f 01                	jg     80025e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80025d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800262:	49 89 c0             	mov    %rax,%r8
+  800265:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80026a:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  800271:	00 00 00 
+  800274:	be 29 00 00 00       	mov    $0x29,%esi
+  800279:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  800280:	00 00 00 
+  800283:	b8 00 00 00 00       	mov    $0x0,%eax
+  800288:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  80028f:	00 00 00 
+  800292:	41 ff d1             	call   *%r9
+
+0000000000800295 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  800295:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  800298:	48 63 d2             	movslq %edx,%rdx
+  80029b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80029e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002a3:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002a6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002a8:	48 85 c0             	test   %rax,%rax
+  8002ab:	7f 01                	jg     8002ae <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002ad:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002ae:	55                   	push   %rbp
+  8002af:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b2:	49 89 c0             	mov    %rax,%r8
+  8002b5:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002ba:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  8002c1:	00 00 00 
+  8002c4:	be 29 00 00 00       	mov    $0x29,%esi
+  8002c9:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  8002d0:	00 00 00 
+  8002d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d8:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  8002df:	00 00 00 
+  8002e2:	41 ff d1             	call   *%r9
+
+00000000008002e5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002e5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002e8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8002ff:	0f 05                	syscall
+    if (check && ret > 0) {
+  800301:	48 85 c0             	test   %rax,%rax
+  800304:	7f 01                	jg     800307 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800306:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800307:	55                   	push   %rbp
+  800308:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80030b:	49 89 c0             	mov    %rax,%r8
+  80030e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800313:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  80031a:	00 00 00 
+  80031d:	be 29 00 00 00       	mov    $0x29,%esi
+  800322:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  800329:	00 00 00 
+  80032c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800331:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  800338:	00 00 00 
+  80033b:	41 ff d1             	call   *%r9
+
+000000000080033e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80033e:	48 63 f6             	movslq %esi,%rsi
+  800341:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800344:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800349:	ba 00 00 00 00       	mov    $0x0,%edx
+  80034e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800354:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80035a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800360:	0f 05                	syscall
+    if (check && ret > 0) {
+  800362:	48 85 c0             	test   %rax,%rax
+  800365:	7f 01                	jg     800368 <sys_env_set_status+0x2a>
+}
+  800367:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800368:	55                   	push   %rbp
+  800369:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80036c:	49 89 c0             	mov    %rax,%r8
+  80036f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800374:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  80037b:	00 00 00 
+  80037e:	be 29 00 00 00       	mov    $0x29,%esi
+  800383:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  80038a:	00 00 00 
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  800399:	00 00 00 
+  80039c:	41 ff d1             	call   *%r9
+
+000000000080039f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80039f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003be:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003c0:	48 85 c0             	test   %rax,%rax
+  8003c3:	7f 01                	jg     8003c6 <sys_env_set_trapframe+0x27>
+}
+  8003c5:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003c6:	55                   	push   %rbp
+  8003c7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003ca:	49 89 c0             	mov    %rax,%r8
+  8003cd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003d2:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  8003d9:	00 00 00 
+  8003dc:	be 29 00 00 00       	mov    $0x29,%esi
+  8003e1:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  8003e8:	00 00 00 
+  8003eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f0:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  8003f7:	00 00 00 
+  8003fa:	41 ff d1             	call   *%r9
+
+00000000008003fd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8003fd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800400:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800405:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800416:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80041c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80041e:	48 85 c0             	test   %rax,%rax
+  800421:	7f 01                	jg     800424 <sys_env_set_pgfault_upcall+0x27>
+}
+  800423:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800424:	55                   	push   %rbp
+  800425:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800428:	49 89 c0             	mov    %rax,%r8
+  80042b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800430:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  800437:	00 00 00 
+  80043a:	be 29 00 00 00       	mov    $0x29,%esi
+  80043f:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  800446:	00 00 00 
+  800449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80044e:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  800455:	00 00 00 
+  800458:	41 ff d1             	call   *%r9
+
+000000000080045b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80045b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80045e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800461:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800466:	4d 63 c0             	movslq %r8d,%r8
+  800469:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80046f:	0f 05                	syscall
+}
+  800471:	c3                   	ret
+
+0000000000800472 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800472:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800475:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800478:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80047d:	4d 63 c0             	movslq %r8d,%r8
+  800480:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800486:	0f 05                	syscall
+}
+  800488:	c3                   	ret
+
+0000000000800489 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  800489:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80048e:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800491:	45 89 c0             	mov    %r8d,%r8d
+  800494:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80049a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80049c:	48 85 c0             	test   %rax,%rax
+  80049f:	7f 01                	jg     8004a2 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004a1:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004a2:	55                   	push   %rbp
+  8004a3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004a6:	49 89 c0             	mov    %rax,%r8
+  8004a9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004ae:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  8004b5:	00 00 00 
+  8004b8:	be 29 00 00 00       	mov    $0x29,%esi
+  8004bd:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  8004c4:	00 00 00 
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  8004d3:	00 00 00 
+  8004d6:	41 ff d1             	call   *%r9
+
+00000000008004d9 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004d9:	55                   	push   %rbp
+  8004da:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004e3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004ed:	48 b8 89 04 80 00 00 	movabs $0x800489,%rax
+  8004f4:	00 00 00 
+  8004f7:	ff d0                	call   *%rax
+}
+  8004f9:	5d                   	pop    %rbp
+  8004fa:	c3                   	ret
+
+00000000008004fb <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004fb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800500:	bf 00 00 00 00       	mov    $0x0,%edi
+  800505:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80050a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80051b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800521:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800523:	c3                   	ret
+
+0000000000800524 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800524:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800529:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80052e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800533:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800539:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800545:	0f 05                	syscall
+    if (check && ret > 0) {
+  800547:	48 85 c0             	test   %rax,%rax
+  80054a:	7f 01                	jg     80054d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80054c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80054d:	55                   	push   %rbp
+  80054e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800551:	49 89 c0             	mov    %rax,%r8
+  800554:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800559:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  800560:	00 00 00 
+  800563:	be 29 00 00 00       	mov    $0x29,%esi
+  800568:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  80056f:	00 00 00 
+  800572:	b8 00 00 00 00       	mov    $0x0,%eax
+  800577:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  80057e:	00 00 00 
+  800581:	41 ff d1             	call   *%r9
+
+0000000000800584 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  800584:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800589:	bf 00 00 00 00       	mov    $0x0,%edi
+  80058e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800593:	ba 00 00 00 00       	mov    $0x0,%edx
+  800598:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80059e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005aa:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005ac:	c3                   	ret
+
+00000000008005ad <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005ad:	89 d2                	mov    %edx,%edx
+  8005af:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005b1:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005c8:	0f 05                	syscall
+}
+  8005ca:	c3                   	ret
+
+00000000008005cb <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005cb:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005ce:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ea:	0f 05                	syscall
+}
+  8005ec:	c3                   	ret
+
+00000000008005ed <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005ed:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005f0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800606:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80060c:	0f 05                	syscall
+}
+  80060e:	c3                   	ret
+
+000000000080060f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80060f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800612:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800617:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80061c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800621:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800627:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80062d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800633:	0f 05                	syscall
+    if (check && ret > 0) {
+  800635:	48 85 c0             	test   %rax,%rax
+  800638:	7f 01                	jg     80063b <sys_irq_ack+0x2c>
+}
+  80063a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80063b:	55                   	push   %rbp
+  80063c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80063f:	49 89 c0             	mov    %rax,%r8
+  800642:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800647:	48 ba a0 46 80 00 00 	movabs $0x8046a0,%rdx
+  80064e:	00 00 00 
+  800651:	be 29 00 00 00       	mov    $0x29,%esi
+  800656:	48 bf bf 46 80 00 00 	movabs $0x8046bf,%rdi
+  80065d:	00 00 00 
+  800660:	b8 00 00 00 00       	mov    $0x0,%eax
+  800665:	49 b9 5d 33 80 00 00 	movabs $0x80335d,%r9
+  80066c:	00 00 00 
+  80066f:	41 ff d1             	call   *%r9
+
+0000000000800672 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800672:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800679:	ff ff ff 
+  80067c:	48 01 f8             	add    %rdi,%rax
+  80067f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800683:	c3                   	ret
+
+0000000000800684 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800684:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80068b:	ff ff ff 
+  80068e:	48 01 f8             	add    %rdi,%rax
+  800691:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  800695:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80069b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80069f:	c3                   	ret
+
+00000000008006a0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006a0:	55                   	push   %rbp
+  8006a1:	48 89 e5             	mov    %rsp,%rbp
+  8006a4:	41 57                	push   %r15
+  8006a6:	41 56                	push   %r14
+  8006a8:	41 55                	push   %r13
+  8006aa:	41 54                	push   %r12
+  8006ac:	53                   	push   %rbx
+  8006ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b1:	49 89 ff             	mov    %rdi,%r15
+  8006b4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b9:	49 bd 2f 2e 80 00 00 	movabs $0x802e2f,%r13
+  8006c0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006c3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006c9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006cc:	48 89 df             	mov    %rbx,%rdi
+  8006cf:	41 ff d5             	call   *%r13
+  8006d2:	83 e0 04             	and    $0x4,%eax
+  8006d5:	74 17                	je     8006ee <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006d7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006de:	4c 39 f3             	cmp    %r14,%rbx
+  8006e1:	75 e6                	jne    8006c9 <fd_alloc+0x29>
+  8006e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006e9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006ee:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006f1:	48 83 c4 08          	add    $0x8,%rsp
+  8006f5:	5b                   	pop    %rbx
+  8006f6:	41 5c                	pop    %r12
+  8006f8:	41 5d                	pop    %r13
+  8006fa:	41 5e                	pop    %r14
+  8006fc:	41 5f                	pop    %r15
+  8006fe:	5d                   	pop    %rbp
+  8006ff:	c3                   	ret
+
+0000000000800700 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800700:	83 ff 1f             	cmp    $0x1f,%edi
+  800703:	77 39                	ja     80073e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800705:	55                   	push   %rbp
+  800706:	48 89 e5             	mov    %rsp,%rbp
+  800709:	41 54                	push   %r12
+  80070b:	53                   	push   %rbx
+  80070c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80070f:	48 63 df             	movslq %edi,%rbx
+  800712:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800719:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80071d:	48 89 df             	mov    %rbx,%rdi
+  800720:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  800727:	00 00 00 
+  80072a:	ff d0                	call   *%rax
+  80072c:	a8 04                	test   $0x4,%al
+  80072e:	74 14                	je     800744 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800730:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800734:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800739:	5b                   	pop    %rbx
+  80073a:	41 5c                	pop    %r12
+  80073c:	5d                   	pop    %rbp
+  80073d:	c3                   	ret
+        return -E_INVAL;
+  80073e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800743:	c3                   	ret
+        return -E_INVAL;
+  800744:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800749:	eb ee                	jmp    800739 <fd_lookup+0x39>
+
+000000000080074b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80074b:	55                   	push   %rbp
+  80074c:	48 89 e5             	mov    %rsp,%rbp
+  80074f:	41 54                	push   %r12
+  800751:	53                   	push   %rbx
+  800752:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800755:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  80075c:	00 00 00 
+  80075f:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800766:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800769:	39 3b                	cmp    %edi,(%rbx)
+  80076b:	74 47                	je     8007b4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80076d:	48 83 c0 08          	add    $0x8,%rax
+  800771:	48 8b 18             	mov    (%rax),%rbx
+  800774:	48 85 db             	test   %rbx,%rbx
+  800777:	75 f0                	jne    800769 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800779:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800780:	00 00 00 
+  800783:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800789:	89 fa                	mov    %edi,%edx
+  80078b:	48 bf d0 46 80 00 00 	movabs $0x8046d0,%rdi
+  800792:	00 00 00 
+  800795:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079a:	48 b9 ad 34 80 00 00 	movabs $0x8034ad,%rcx
+  8007a1:	00 00 00 
+  8007a4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007a6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007ab:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007af:	5b                   	pop    %rbx
+  8007b0:	41 5c                	pop    %r12
+  8007b2:	5d                   	pop    %rbp
+  8007b3:	c3                   	ret
+            return 0;
+  8007b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b9:	eb f0                	jmp    8007ab <dev_lookup+0x60>
+
+00000000008007bb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007bb:	55                   	push   %rbp
+  8007bc:	48 89 e5             	mov    %rsp,%rbp
+  8007bf:	41 55                	push   %r13
+  8007c1:	41 54                	push   %r12
+  8007c3:	53                   	push   %rbx
+  8007c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8007c8:	48 89 fb             	mov    %rdi,%rbx
+  8007cb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007ce:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007d5:	ff ff ff 
+  8007d8:	48 01 df             	add    %rbx,%rdi
+  8007db:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007df:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007e3:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  8007ea:	00 00 00 
+  8007ed:	ff d0                	call   *%rax
+  8007ef:	41 89 c5             	mov    %eax,%r13d
+  8007f2:	85 c0                	test   %eax,%eax
+  8007f4:	78 06                	js     8007fc <fd_close+0x41>
+  8007f6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007fa:	74 1a                	je     800816 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007fc:	45 84 e4             	test   %r12b,%r12b
+  8007ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800804:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800808:	44 89 e8             	mov    %r13d,%eax
+  80080b:	48 83 c4 18          	add    $0x18,%rsp
+  80080f:	5b                   	pop    %rbx
+  800810:	41 5c                	pop    %r12
+  800812:	41 5d                	pop    %r13
+  800814:	5d                   	pop    %rbp
+  800815:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800816:	8b 3b                	mov    (%rbx),%edi
+  800818:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80081c:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800823:	00 00 00 
+  800826:	ff d0                	call   *%rax
+  800828:	41 89 c5             	mov    %eax,%r13d
+  80082b:	85 c0                	test   %eax,%eax
+  80082d:	78 1b                	js     80084a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80082f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800833:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800837:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80083d:	48 85 c0             	test   %rax,%rax
+  800840:	74 08                	je     80084a <fd_close+0x8f>
+  800842:	48 89 df             	mov    %rbx,%rdi
+  800845:	ff d0                	call   *%rax
+  800847:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80084a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80084f:	48 89 de             	mov    %rbx,%rsi
+  800852:	bf 00 00 00 00       	mov    $0x0,%edi
+  800857:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  80085e:	00 00 00 
+  800861:	ff d0                	call   *%rax
+    return res;
+  800863:	eb a3                	jmp    800808 <fd_close+0x4d>
+
+0000000000800865 <close>:
+
+int
+close(int fdnum) {
+  800865:	55                   	push   %rbp
+  800866:	48 89 e5             	mov    %rsp,%rbp
+  800869:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80086d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800871:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800878:	00 00 00 
+  80087b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80087d:	85 c0                	test   %eax,%eax
+  80087f:	78 15                	js     800896 <close+0x31>
+
+    return fd_close(fd, 1);
+  800881:	be 01 00 00 00       	mov    $0x1,%esi
+  800886:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80088a:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  800891:	00 00 00 
+  800894:	ff d0                	call   *%rax
+}
+  800896:	c9                   	leave
+  800897:	c3                   	ret
+
+0000000000800898 <close_all>:
+
+void
+close_all(void) {
+  800898:	55                   	push   %rbp
+  800899:	48 89 e5             	mov    %rsp,%rbp
+  80089c:	41 54                	push   %r12
+  80089e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80089f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a4:	49 bc 65 08 80 00 00 	movabs $0x800865,%r12
+  8008ab:	00 00 00 
+  8008ae:	89 df                	mov    %ebx,%edi
+  8008b0:	41 ff d4             	call   *%r12
+  8008b3:	83 c3 01             	add    $0x1,%ebx
+  8008b6:	83 fb 20             	cmp    $0x20,%ebx
+  8008b9:	75 f3                	jne    8008ae <close_all+0x16>
+}
+  8008bb:	5b                   	pop    %rbx
+  8008bc:	41 5c                	pop    %r12
+  8008be:	5d                   	pop    %rbp
+  8008bf:	c3                   	ret
+
+00000000008008c0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008c0:	55                   	push   %rbp
+  8008c1:	48 89 e5             	mov    %rsp,%rbp
+  8008c4:	41 57                	push   %r15
+  8008c6:	41 56                	push   %r14
+  8008c8:	41 55                	push   %r13
+  8008ca:	41 54                	push   %r12
+  8008cc:	53                   	push   %rbx
+  8008cd:	48 83 ec 18          	sub    $0x18,%rsp
+  8008d1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008d4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008d8:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  8008df:	00 00 00 
+  8008e2:	ff d0                	call   *%rax
+  8008e4:	89 c3                	mov    %eax,%ebx
+  8008e6:	85 c0                	test   %eax,%eax
+  8008e8:	0f 88 b8 00 00 00    	js     8009a6 <dup+0xe6>
+    close(newfdnum);
+  8008ee:	44 89 e7             	mov    %r12d,%edi
+  8008f1:	48 b8 65 08 80 00 00 	movabs $0x800865,%rax
+  8008f8:	00 00 00 
+  8008fb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008fd:	4d 63 ec             	movslq %r12d,%r13
+  800900:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800907:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80090b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80090f:	4c 89 ff             	mov    %r15,%rdi
+  800912:	49 be 84 06 80 00 00 	movabs $0x800684,%r14
+  800919:	00 00 00 
+  80091c:	41 ff d6             	call   *%r14
+  80091f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800922:	4c 89 ef             	mov    %r13,%rdi
+  800925:	41 ff d6             	call   *%r14
+  800928:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80092b:	48 89 df             	mov    %rbx,%rdi
+  80092e:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  800935:	00 00 00 
+  800938:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80093a:	a8 04                	test   $0x4,%al
+  80093c:	74 2b                	je     800969 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80093e:	41 89 c1             	mov    %eax,%r9d
+  800941:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800947:	4c 89 f1             	mov    %r14,%rcx
+  80094a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80094f:	48 89 de             	mov    %rbx,%rsi
+  800952:	bf 00 00 00 00       	mov    $0x0,%edi
+  800957:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  80095e:	00 00 00 
+  800961:	ff d0                	call   *%rax
+  800963:	89 c3                	mov    %eax,%ebx
+  800965:	85 c0                	test   %eax,%eax
+  800967:	78 4e                	js     8009b7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800969:	4c 89 ff             	mov    %r15,%rdi
+  80096c:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  800973:	00 00 00 
+  800976:	ff d0                	call   *%rax
+  800978:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80097b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800981:	4c 89 e9             	mov    %r13,%rcx
+  800984:	ba 00 00 00 00       	mov    $0x0,%edx
+  800989:	4c 89 fe             	mov    %r15,%rsi
+  80098c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800991:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  800998:	00 00 00 
+  80099b:	ff d0                	call   *%rax
+  80099d:	89 c3                	mov    %eax,%ebx
+  80099f:	85 c0                	test   %eax,%eax
+  8009a1:	78 14                	js     8009b7 <dup+0xf7>
+
+    return newfdnum;
+  8009a3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009a6:	89 d8                	mov    %ebx,%eax
+  8009a8:	48 83 c4 18          	add    $0x18,%rsp
+  8009ac:	5b                   	pop    %rbx
+  8009ad:	41 5c                	pop    %r12
+  8009af:	41 5d                	pop    %r13
+  8009b1:	41 5e                	pop    %r14
+  8009b3:	41 5f                	pop    %r15
+  8009b5:	5d                   	pop    %rbp
+  8009b6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009bc:	4c 89 ee             	mov    %r13,%rsi
+  8009bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c4:	49 bc e5 02 80 00 00 	movabs $0x8002e5,%r12
+  8009cb:	00 00 00 
+  8009ce:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009d1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009d6:	4c 89 f6             	mov    %r14,%rsi
+  8009d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009de:	41 ff d4             	call   *%r12
+    return res;
+  8009e1:	eb c3                	jmp    8009a6 <dup+0xe6>
+
+00000000008009e3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009e3:	55                   	push   %rbp
+  8009e4:	48 89 e5             	mov    %rsp,%rbp
+  8009e7:	41 56                	push   %r14
+  8009e9:	41 55                	push   %r13
+  8009eb:	41 54                	push   %r12
+  8009ed:	53                   	push   %rbx
+  8009ee:	48 83 ec 10          	sub    $0x10,%rsp
+  8009f2:	89 fb                	mov    %edi,%ebx
+  8009f4:	49 89 f4             	mov    %rsi,%r12
+  8009f7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009fa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009fe:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800a05:	00 00 00 
+  800a08:	ff d0                	call   *%rax
+  800a0a:	85 c0                	test   %eax,%eax
+  800a0c:	78 4c                	js     800a5a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a0e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a12:	41 8b 3e             	mov    (%r14),%edi
+  800a15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a19:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800a20:	00 00 00 
+  800a23:	ff d0                	call   *%rax
+  800a25:	85 c0                	test   %eax,%eax
+  800a27:	78 35                	js     800a5e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a29:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a2d:	83 e0 03             	and    $0x3,%eax
+  800a30:	83 f8 01             	cmp    $0x1,%eax
+  800a33:	74 2d                	je     800a62 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a39:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a3d:	48 85 c0             	test   %rax,%rax
+  800a40:	74 56                	je     800a98 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a42:	4c 89 ea             	mov    %r13,%rdx
+  800a45:	4c 89 e6             	mov    %r12,%rsi
+  800a48:	4c 89 f7             	mov    %r14,%rdi
+  800a4b:	ff d0                	call   *%rax
+}
+  800a4d:	48 83 c4 10          	add    $0x10,%rsp
+  800a51:	5b                   	pop    %rbx
+  800a52:	41 5c                	pop    %r12
+  800a54:	41 5d                	pop    %r13
+  800a56:	41 5e                	pop    %r14
+  800a58:	5d                   	pop    %rbp
+  800a59:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a5a:	48 98                	cltq
+  800a5c:	eb ef                	jmp    800a4d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a5e:	48 98                	cltq
+  800a60:	eb eb                	jmp    800a4d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a62:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a69:	00 00 00 
+  800a6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a72:	89 da                	mov    %ebx,%edx
+  800a74:	48 bf 11 47 80 00 00 	movabs $0x804711,%rdi
+  800a7b:	00 00 00 
+  800a7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a83:	48 b9 ad 34 80 00 00 	movabs $0x8034ad,%rcx
+  800a8a:	00 00 00 
+  800a8d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a96:	eb b5                	jmp    800a4d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a98:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a9f:	eb ac                	jmp    800a4d <read+0x6a>
+
+0000000000800aa1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800aa1:	55                   	push   %rbp
+  800aa2:	48 89 e5             	mov    %rsp,%rbp
+  800aa5:	41 57                	push   %r15
+  800aa7:	41 56                	push   %r14
+  800aa9:	41 55                	push   %r13
+  800aab:	41 54                	push   %r12
+  800aad:	53                   	push   %rbx
+  800aae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ab2:	48 85 d2             	test   %rdx,%rdx
+  800ab5:	74 54                	je     800b0b <readn+0x6a>
+  800ab7:	41 89 fd             	mov    %edi,%r13d
+  800aba:	49 89 f6             	mov    %rsi,%r14
+  800abd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ac0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ac5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800aca:	49 bf e3 09 80 00 00 	movabs $0x8009e3,%r15
+  800ad1:	00 00 00 
+  800ad4:	4c 89 e2             	mov    %r12,%rdx
+  800ad7:	48 29 f2             	sub    %rsi,%rdx
+  800ada:	4c 01 f6             	add    %r14,%rsi
+  800add:	44 89 ef             	mov    %r13d,%edi
+  800ae0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ae3:	85 c0                	test   %eax,%eax
+  800ae5:	78 20                	js     800b07 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ae7:	01 c3                	add    %eax,%ebx
+  800ae9:	85 c0                	test   %eax,%eax
+  800aeb:	74 08                	je     800af5 <readn+0x54>
+  800aed:	48 63 f3             	movslq %ebx,%rsi
+  800af0:	4c 39 e6             	cmp    %r12,%rsi
+  800af3:	72 df                	jb     800ad4 <readn+0x33>
+    }
+    return res;
+  800af5:	48 63 c3             	movslq %ebx,%rax
+}
+  800af8:	48 83 c4 08          	add    $0x8,%rsp
+  800afc:	5b                   	pop    %rbx
+  800afd:	41 5c                	pop    %r12
+  800aff:	41 5d                	pop    %r13
+  800b01:	41 5e                	pop    %r14
+  800b03:	41 5f                	pop    %r15
+  800b05:	5d                   	pop    %rbp
+  800b06:	c3                   	ret
+        if (inc < 0) return inc;
+  800b07:	48 98                	cltq
+  800b09:	eb ed                	jmp    800af8 <readn+0x57>
+    int inc = 1, res = 0;
+  800b0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b10:	eb e3                	jmp    800af5 <readn+0x54>
+
+0000000000800b12 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b12:	55                   	push   %rbp
+  800b13:	48 89 e5             	mov    %rsp,%rbp
+  800b16:	41 56                	push   %r14
+  800b18:	41 55                	push   %r13
+  800b1a:	41 54                	push   %r12
+  800b1c:	53                   	push   %rbx
+  800b1d:	48 83 ec 10          	sub    $0x10,%rsp
+  800b21:	89 fb                	mov    %edi,%ebx
+  800b23:	49 89 f4             	mov    %rsi,%r12
+  800b26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b2d:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800b34:	00 00 00 
+  800b37:	ff d0                	call   *%rax
+  800b39:	85 c0                	test   %eax,%eax
+  800b3b:	78 47                	js     800b84 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b41:	41 8b 3e             	mov    (%r14),%edi
+  800b44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b48:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800b4f:	00 00 00 
+  800b52:	ff d0                	call   *%rax
+  800b54:	85 c0                	test   %eax,%eax
+  800b56:	78 30                	js     800b88 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b58:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b5d:	74 2d                	je     800b8c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b67:	48 85 c0             	test   %rax,%rax
+  800b6a:	74 56                	je     800bc2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b6c:	4c 89 ea             	mov    %r13,%rdx
+  800b6f:	4c 89 e6             	mov    %r12,%rsi
+  800b72:	4c 89 f7             	mov    %r14,%rdi
+  800b75:	ff d0                	call   *%rax
+}
+  800b77:	48 83 c4 10          	add    $0x10,%rsp
+  800b7b:	5b                   	pop    %rbx
+  800b7c:	41 5c                	pop    %r12
+  800b7e:	41 5d                	pop    %r13
+  800b80:	41 5e                	pop    %r14
+  800b82:	5d                   	pop    %rbp
+  800b83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b84:	48 98                	cltq
+  800b86:	eb ef                	jmp    800b77 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b88:	48 98                	cltq
+  800b8a:	eb eb                	jmp    800b77 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b8c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800b93:	00 00 00 
+  800b96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b9c:	89 da                	mov    %ebx,%edx
+  800b9e:	48 bf 2d 47 80 00 00 	movabs $0x80472d,%rdi
+  800ba5:	00 00 00 
+  800ba8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bad:	48 b9 ad 34 80 00 00 	movabs $0x8034ad,%rcx
+  800bb4:	00 00 00 
+  800bb7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bb9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bc0:	eb b5                	jmp    800b77 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bc2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bc9:	eb ac                	jmp    800b77 <write+0x65>
+
+0000000000800bcb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bcb:	55                   	push   %rbp
+  800bcc:	48 89 e5             	mov    %rsp,%rbp
+  800bcf:	41 54                	push   %r12
+  800bd1:	53                   	push   %rbx
+  800bd2:	48 83 ec 10          	sub    $0x10,%rsp
+  800bd6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bd8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bdc:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800be3:	00 00 00 
+  800be6:	ff d0                	call   *%rax
+  800be8:	85 c0                	test   %eax,%eax
+  800bea:	78 3e                	js     800c2a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bec:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800bf0:	41 8b 3c 24          	mov    (%r12),%edi
+  800bf4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bf8:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800bff:	00 00 00 
+  800c02:	ff d0                	call   *%rax
+  800c04:	85 c0                	test   %eax,%eax
+  800c06:	78 22                	js     800c2a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c0c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c10:	48 85 c0             	test   %rax,%rax
+  800c13:	74 0b                	je     800c20 <seek+0x55>
+  800c15:	89 de                	mov    %ebx,%esi
+  800c17:	4c 89 e7             	mov    %r12,%rdi
+  800c1a:	ff d0                	call   *%rax
+  800c1c:	85 c0                	test   %eax,%eax
+  800c1e:	78 0a                	js     800c2a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c20:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c2a:	48 83 c4 10          	add    $0x10,%rsp
+  800c2e:	5b                   	pop    %rbx
+  800c2f:	41 5c                	pop    %r12
+  800c31:	5d                   	pop    %rbp
+  800c32:	c3                   	ret
+
+0000000000800c33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c33:	55                   	push   %rbp
+  800c34:	48 89 e5             	mov    %rsp,%rbp
+  800c37:	41 55                	push   %r13
+  800c39:	41 54                	push   %r12
+  800c3b:	53                   	push   %rbx
+  800c3c:	48 83 ec 18          	sub    $0x18,%rsp
+  800c40:	89 fb                	mov    %edi,%ebx
+  800c42:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c49:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800c50:	00 00 00 
+  800c53:	ff d0                	call   *%rax
+  800c55:	85 c0                	test   %eax,%eax
+  800c57:	78 38                	js     800c91 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c59:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c5d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c65:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800c6c:	00 00 00 
+  800c6f:	ff d0                	call   *%rax
+  800c71:	85 c0                	test   %eax,%eax
+  800c73:	78 1c                	js     800c91 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c75:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c7a:	74 20                	je     800c9c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c80:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c84:	48 85 c0             	test   %rax,%rax
+  800c87:	74 47                	je     800cd0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c89:	44 89 e6             	mov    %r12d,%esi
+  800c8c:	4c 89 ef             	mov    %r13,%rdi
+  800c8f:	ff d0                	call   *%rax
+}
+  800c91:	48 83 c4 18          	add    $0x18,%rsp
+  800c95:	5b                   	pop    %rbx
+  800c96:	41 5c                	pop    %r12
+  800c98:	41 5d                	pop    %r13
+  800c9a:	5d                   	pop    %rbp
+  800c9b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800c9c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ca3:	00 00 00 
+  800ca6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cac:	89 da                	mov    %ebx,%edx
+  800cae:	48 bf f0 46 80 00 00 	movabs $0x8046f0,%rdi
+  800cb5:	00 00 00 
+  800cb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cbd:	48 b9 ad 34 80 00 00 	movabs $0x8034ad,%rcx
+  800cc4:	00 00 00 
+  800cc7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cce:	eb c1                	jmp    800c91 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cd0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800cd5:	eb ba                	jmp    800c91 <ftruncate+0x5e>
+
+0000000000800cd7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cd7:	55                   	push   %rbp
+  800cd8:	48 89 e5             	mov    %rsp,%rbp
+  800cdb:	41 54                	push   %r12
+  800cdd:	53                   	push   %rbx
+  800cde:	48 83 ec 10          	sub    $0x10,%rsp
+  800ce2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ce5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ce9:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  800cf0:	00 00 00 
+  800cf3:	ff d0                	call   *%rax
+  800cf5:	85 c0                	test   %eax,%eax
+  800cf7:	78 4e                	js     800d47 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800cfd:	41 8b 3c 24          	mov    (%r12),%edi
+  800d01:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d05:	48 b8 4b 07 80 00 00 	movabs $0x80074b,%rax
+  800d0c:	00 00 00 
+  800d0f:	ff d0                	call   *%rax
+  800d11:	85 c0                	test   %eax,%eax
+  800d13:	78 32                	js     800d47 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d15:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d19:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d1e:	74 30                	je     800d50 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d20:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d23:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d2a:	00 00 00 
+    stat->st_isdir = 0;
+  800d2d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d34:	00 00 00 
+    stat->st_dev = dev;
+  800d37:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d3e:	48 89 de             	mov    %rbx,%rsi
+  800d41:	4c 89 e7             	mov    %r12,%rdi
+  800d44:	ff 50 28             	call   *0x28(%rax)
+}
+  800d47:	48 83 c4 10          	add    $0x10,%rsp
+  800d4b:	5b                   	pop    %rbx
+  800d4c:	41 5c                	pop    %r12
+  800d4e:	5d                   	pop    %rbp
+  800d4f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d50:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d55:	eb f0                	jmp    800d47 <fstat+0x70>
+
+0000000000800d57 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d57:	55                   	push   %rbp
+  800d58:	48 89 e5             	mov    %rsp,%rbp
+  800d5b:	41 54                	push   %r12
+  800d5d:	53                   	push   %rbx
+  800d5e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d61:	be 00 00 00 00       	mov    $0x0,%esi
+  800d66:	48 b8 c5 1e 80 00 00 	movabs $0x801ec5,%rax
+  800d6d:	00 00 00 
+  800d70:	ff d0                	call   *%rax
+  800d72:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d74:	85 c0                	test   %eax,%eax
+  800d76:	78 25                	js     800d9d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d78:	4c 89 e6             	mov    %r12,%rsi
+  800d7b:	89 c7                	mov    %eax,%edi
+  800d7d:	48 b8 d7 0c 80 00 00 	movabs $0x800cd7,%rax
+  800d84:	00 00 00 
+  800d87:	ff d0                	call   *%rax
+  800d89:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d8c:	89 df                	mov    %ebx,%edi
+  800d8e:	48 b8 65 08 80 00 00 	movabs $0x800865,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+
+    return res;
+  800d9a:	44 89 e3             	mov    %r12d,%ebx
+}
+  800d9d:	89 d8                	mov    %ebx,%eax
+  800d9f:	5b                   	pop    %rbx
+  800da0:	41 5c                	pop    %r12
+  800da2:	5d                   	pop    %rbp
+  800da3:	c3                   	ret
+
+0000000000800da4 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800da4:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800dab:	00 00 00 
+  800dae:	83 38 00             	cmpl   $0x0,(%rax)
+  800db1:	74 0a                	je     800dbd <fsenv+0x19>
+    return envid;
+}
+  800db3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dba:	00 00 
+  800dbc:	c3                   	ret
+fsenv(void) {
+  800dbd:	55                   	push   %rbp
+  800dbe:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dc1:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dc6:	48 b8 2e 46 80 00 00 	movabs $0x80462e,%rax
+  800dcd:	00 00 00 
+  800dd0:	ff d0                	call   *%rax
+  800dd2:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dd9:	00 00 
+}
+  800ddb:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800de2:	00 00 
+  800de4:	5d                   	pop    %rbp
+  800de5:	c3                   	ret
+
+0000000000800de6 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800de6:	55                   	push   %rbp
+  800de7:	48 89 e5             	mov    %rsp,%rbp
+  800dea:	41 54                	push   %r12
+  800dec:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800ded:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800df2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800df7:	48 89 de             	mov    %rbx,%rsi
+  800dfa:	bf 00 00 00 00       	mov    $0x0,%edi
+  800dff:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  800e06:	00 00 00 
+  800e09:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e0b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e12:	00 00 00 
+  800e15:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e1b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e20:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e25:	48 89 de             	mov    %rbx,%rsi
+  800e28:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e2d:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  800e34:	00 00 00 
+  800e37:	ff d0                	call   *%rax
+  800e39:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e3b:	85 c0                	test   %eax,%eax
+  800e3d:	0f 88 a2 00 00 00    	js     800ee5 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e43:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e4a:	00 00 00 
+  800e4d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e53:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e58:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e5a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e5f:	49 bc f7 2f 80 00 00 	movabs $0x802ff7,%r12
+  800e66:	00 00 00 
+  800e69:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e6c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e71:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e74:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  800e7b:	00 00 00 
+  800e7e:	ff d0                	call   *%rax
+  800e80:	89 c7                	mov    %eax,%edi
+  800e82:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e88:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e8d:	48 89 da             	mov    %rbx,%rdx
+  800e90:	be 09 00 00 00       	mov    $0x9,%esi
+  800e95:	48 b8 d8 45 80 00 00 	movabs $0x8045d8,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800ea1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ea6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eab:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eb5:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  800ebc:	00 00 00 
+  800ebf:	ff d0                	call   *%rax
+  800ec1:	89 c3                	mov    %eax,%ebx
+  800ec3:	85 c0                	test   %eax,%eax
+  800ec5:	78 25                	js     800eec <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ec7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ece:	00 00 00 
+  800ed1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ed7:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ede:	00 00 
+    return 0;
+  800ee0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800ee5:	89 d8                	mov    %ebx,%eax
+  800ee7:	5b                   	pop    %rbx
+  800ee8:	41 5c                	pop    %r12
+  800eea:	5d                   	pop    %rbp
+  800eeb:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800eec:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800ef1:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800ef6:	bf 00 00 00 00       	mov    $0x0,%edi
+  800efb:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  800f02:	00 00 00 
+  800f05:	ff d0                	call   *%rax
+        return res;
+  800f07:	eb dc                	jmp    800ee5 <fschan_setup+0xff>
+
+0000000000800f09 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f09:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f10:	00 00 00 
+  800f13:	80 38 00             	cmpb   $0x0,(%rax)
+  800f16:	74 55                	je     800f6d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f18:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f1f:	00 00 00 
+  800f22:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f28:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f2d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f34:	00 00 00 
+  800f37:	3b 0a                	cmp    (%rdx),%ecx
+  800f39:	75 01                	jne    800f3c <fschan+0x33>
+}
+  800f3b:	c3                   	ret
+fschan(void) {
+  800f3c:	55                   	push   %rbp
+  800f3d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f40:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  800f47:	00 00 00 
+  800f4a:	ff d0                	call   *%rax
+  800f4c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f4e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f53:	85 d2                	test   %edx,%edx
+  800f55:	78 02                	js     800f59 <fschan+0x50>
+}
+  800f57:	5d                   	pop    %rbp
+  800f58:	c3                   	ret
+        fschan_enabled = 0;
+  800f59:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f60:	00 00 00 
+  800f63:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f66:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6b:	eb ea                	jmp    800f57 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f6d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f72:	c3                   	ret
+
+0000000000800f73 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f73:	55                   	push   %rbp
+  800f74:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f77:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f83:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f88:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f8c:	77 12                	ja     800fa0 <fbuf+0x2d>
+  800f8e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800f92:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800f99:	00 00 00 
+  800f9c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fa0:	48 89 d0             	mov    %rdx,%rax
+  800fa3:	5d                   	pop    %rbp
+  800fa4:	c3                   	ret
+
+0000000000800fa5 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fa5:	55                   	push   %rbp
+  800fa6:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fa9:	48 83 c7 40          	add    $0x40,%rdi
+  800fad:	48 b8 31 30 80 00 00 	movabs $0x803031,%rax
+  800fb4:	00 00 00 
+  800fb7:	ff d0                	call   *%rax
+  800fb9:	84 c0                	test   %al,%al
+  800fbb:	75 02                	jne    800fbf <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fbd:	5d                   	pop    %rbp
+  800fbe:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fbf:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  800fc6:	00 00 00 
+  800fc9:	ff d0                	call   *%rax
+  800fcb:	89 c7                	mov    %eax,%edi
+  800fcd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fd3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fd8:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fdd:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fe2:	48 b8 d8 45 80 00 00 	movabs $0x8045d8,%rax
+  800fe9:	00 00 00 
+  800fec:	ff d0                	call   *%rax
+}
+  800fee:	eb cd                	jmp    800fbd <fschan_publish+0x18>
+
+0000000000800ff0 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  800ff0:	55                   	push   %rbp
+  800ff1:	48 89 e5             	mov    %rsp,%rbp
+  800ff4:	41 57                	push   %r15
+  800ff6:	41 56                	push   %r14
+  800ff8:	41 55                	push   %r13
+  800ffa:	41 54                	push   %r12
+  800ffc:	53                   	push   %rbx
+  800ffd:	48 83 ec 48          	sub    $0x48,%rsp
+  801001:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801005:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801009:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80100c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801010:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801013:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80101a:	00 00 00 
+  80101d:	8b 02                	mov    (%rdx),%eax
+  80101f:	83 c0 01             	add    $0x1,%eax
+  801022:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801027:	0f 44 c1             	cmove  %ecx,%eax
+  80102a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80102c:	4d 85 c0             	test   %r8,%r8
+  80102f:	74 2c                	je     80105d <fschan_rw+0x6d>
+  801031:	45 89 ce             	mov    %r9d,%r14d
+  801034:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80103b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80103f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801045:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80104c:	00 
+  80104d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801053:	b8 01 00 00 00       	mov    $0x1,%eax
+  801058:	e9 41 01 00 00       	jmp    80119e <fschan_rw+0x1ae>
+  80105d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801061:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801065:	e9 9c 01 00 00       	jmp    801206 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80106a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80106e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801071:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801074:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801077:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80107b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80107f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801083:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801087:	48 89 da             	mov    %rbx,%rdx
+  80108a:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801091:	00 00 00 
+  801094:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801096:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80109a:	48 b8 a5 0f 80 00 00 	movabs $0x800fa5,%rax
+  8010a1:	00 00 00 
+  8010a4:	ff d0                	call   *%rax
+            queued += blk;
+  8010a6:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010a9:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010ad:	4d 39 fc             	cmp    %r15,%r12
+  8010b0:	73 6b                	jae    80111d <fschan_rw+0x12d>
+  8010b2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010b6:	77 65                	ja     80111d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010bc:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010c0:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  8010c7:	00 00 00 
+  8010ca:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010cc:	4c 89 fb             	mov    %r15,%rbx
+  8010cf:	4c 29 e3             	sub    %r12,%rbx
+  8010d2:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010d7:	48 39 d3             	cmp    %rdx,%rbx
+  8010da:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010de:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010e2:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010e6:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010ea:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010ed:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010ef:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8010f6:	00 00 00 
+  8010f9:	8b 09                	mov    (%rcx),%ecx
+  8010fb:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8010fe:	83 fe 03             	cmp    $0x3,%esi
+  801101:	0f 85 63 ff ff ff    	jne    80106a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801107:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80110b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80110e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801111:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801114:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801118:	e9 79 ff ff ff       	jmp    801096 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80111d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801121:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801128:	48 89 df             	mov    %rbx,%rdi
+  80112b:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  801132:	00 00 00 
+  801135:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801137:	48 89 df             	mov    %rbx,%rdi
+  80113a:	48 b8 5d 30 80 00 00 	movabs $0x80305d,%rax
+  801141:	00 00 00 
+  801144:	ff d0                	call   *%rax
+  801146:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80114a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80114e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801152:	75 25                	jne    801179 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801154:	8b 40 04             	mov    0x4(%rax),%eax
+  801157:	85 c0                	test   %eax,%eax
+  801159:	0f 88 86 00 00 00    	js     8011e5 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80115f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801163:	74 5b                	je     8011c0 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801165:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801169:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80116d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801171:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801175:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801179:	48 89 df             	mov    %rbx,%rdi
+  80117c:	48 b8 84 30 80 00 00 	movabs $0x803084,%rax
+  801183:	00 00 00 
+  801186:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801188:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80118c:	83 f0 01             	xor    $0x1,%eax
+  80118f:	4d 39 fc             	cmp    %r15,%r12
+  801192:	0f 92 c2             	setb   %dl
+  801195:	84 c2                	test   %al,%dl
+  801197:	75 05                	jne    80119e <fschan_rw+0x1ae>
+  801199:	45 85 ed             	test   %r13d,%r13d
+  80119c:	74 50                	je     8011ee <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80119e:	4d 39 fc             	cmp    %r15,%r12
+  8011a1:	0f 92 c1             	setb   %cl
+  8011a4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011a8:	0f 96 c2             	setbe  %dl
+  8011ab:	84 d1                	test   %dl,%cl
+  8011ad:	0f 84 6a ff ff ff    	je     80111d <fschan_rw+0x12d>
+  8011b3:	84 c0                	test   %al,%al
+  8011b5:	0f 85 fd fe ff ff    	jne    8010b8 <fschan_rw+0xc8>
+  8011bb:	e9 5d ff ff ff       	jmp    80111d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011c0:	48 63 d0             	movslq %eax,%rdx
+  8011c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011c7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011cf:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011d3:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011d7:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  8011de:	00 00 00 
+  8011e1:	ff d0                	call   *%rax
+  8011e3:	eb 80                	jmp    801165 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011e5:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011e8:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011ec:	eb 8b                	jmp    801179 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011ee:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8011f3:	0f 85 68 fe ff ff    	jne    801061 <fschan_rw+0x71>
+  8011f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8011fc:	85 c0                	test   %eax,%eax
+  8011fe:	0f 84 5d fe ff ff    	je     801061 <fschan_rw+0x71>
+  801204:	48 98                	cltq
+}
+  801206:	48 83 c4 48          	add    $0x48,%rsp
+  80120a:	5b                   	pop    %rbx
+  80120b:	41 5c                	pop    %r12
+  80120d:	41 5d                	pop    %r13
+  80120f:	41 5e                	pop    %r14
+  801211:	41 5f                	pop    %r15
+  801213:	5d                   	pop    %rbp
+  801214:	c3                   	ret
+
+0000000000801215 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801215:	55                   	push   %rbp
+  801216:	48 89 e5             	mov    %rsp,%rbp
+  801219:	41 56                	push   %r14
+  80121b:	41 55                	push   %r13
+  80121d:	41 54                	push   %r12
+  80121f:	53                   	push   %rbx
+  801220:	48 83 ec 10          	sub    $0x10,%rsp
+  801224:	49 89 fe             	mov    %rdi,%r14
+  801227:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80122a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80122e:	48 29 f3             	sub    %rsi,%rbx
+  801231:	48 39 d3             	cmp    %rdx,%rbx
+  801234:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801238:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80123f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801240:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801245:	49 bd 8e 2e 80 00 00 	movabs $0x802e8e,%r13
+  80124c:	00 00 00 
+  80124f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801256:	76 1e                	jbe    801276 <mmap_fault+0x61>
+  801258:	4c 01 e7             	add    %r12,%rdi
+  80125b:	41 ff d5             	call   *%r13
+  80125e:	84 c0                	test   %al,%al
+  801260:	75 14                	jne    801276 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801262:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801266:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80126d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801271:	48 39 df             	cmp    %rbx,%rdi
+  801274:	72 e2                	jb     801258 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  801276:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80127d:	00 00 00 
+  801280:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801287:	00 00 00 
+  80128a:	4c 89 f0             	mov    %r14,%rax
+  80128d:	48 29 d0             	sub    %rdx,%rax
+  801290:	48 c1 f8 03          	sar    $0x3,%rax
+  801294:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80129b:	aa aa aa 
+  80129e:	48 0f af c2          	imul   %rdx,%rax
+  8012a2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012a6:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012ab:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012af:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012b1:	44 89 e0             	mov    %r12d,%eax
+  8012b4:	41 03 46 10          	add    0x10(%r14),%eax
+  8012b8:	41 2b 06             	sub    (%r14),%eax
+  8012bb:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c2:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012c6:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012ca:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012cd:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  8012d4:	00 00 00 
+  8012d7:	ff d0                	call   *%rax
+  8012d9:	89 c7                	mov    %eax,%edi
+  8012db:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012e6:	48 89 da             	mov    %rbx,%rdx
+  8012e9:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012ee:	48 b8 d8 45 80 00 00 	movabs $0x8045d8,%rax
+  8012f5:	00 00 00 
+  8012f8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8012fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012ff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801303:	4c 89 e6             	mov    %r12,%rsi
+  801306:	bf 00 00 00 00       	mov    $0x0,%edi
+  80130b:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  801312:	00 00 00 
+  801315:	ff d0                	call   *%rax
+  801317:	48 98                	cltq
+}
+  801319:	48 83 c4 10          	add    $0x10,%rsp
+  80131d:	5b                   	pop    %rbx
+  80131e:	41 5c                	pop    %r12
+  801320:	41 5d                	pop    %r13
+  801322:	41 5e                	pop    %r14
+  801324:	5d                   	pop    %rbp
+  801325:	c3                   	ret
+
+0000000000801326 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801326:	48 8b 37             	mov    (%rdi),%rsi
+  801329:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801330:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801337:	00 00 00 
+  80133a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80133f:	eb 0f                	jmp    801350 <mmap_pgfault+0x2a>
+  801341:	c3                   	ret
+  801342:	48 83 c1 01          	add    $0x1,%rcx
+  801346:	48 83 c2 18          	add    $0x18,%rdx
+  80134a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80134e:	74 6e                	je     8013be <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801350:	48 8b 02             	mov    (%rdx),%rax
+  801353:	48 83 e8 01          	sub    $0x1,%rax
+  801357:	48 39 f0             	cmp    %rsi,%rax
+  80135a:	73 e6                	jae    801342 <mmap_pgfault+0x1c>
+  80135c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801360:	73 e0                	jae    801342 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801362:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801366:	b8 00 00 00 00       	mov    $0x0,%eax
+  80136b:	f6 c2 01             	test   $0x1,%dl
+  80136e:	75 d1                	jne    801341 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801370:	f6 c2 02             	test   $0x2,%dl
+  801373:	74 1a                	je     80138f <mmap_pgfault+0x69>
+  801375:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  801385:	00 00 00 
+  801388:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80138d:	74 35                	je     8013c4 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80138f:	55                   	push   %rbp
+  801390:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801393:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801397:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80139e:	00 00 00 
+  8013a1:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013a5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013aa:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8013b1:	00 00 00 
+  8013b4:	ff d0                	call   *%rax
+  8013b6:	48 85 c0             	test   %rax,%rax
+  8013b9:	0f 9f c0             	setg   %al
+}
+  8013bc:	5d                   	pop    %rbp
+  8013bd:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c3:	c3                   	ret
+}
+  8013c4:	c3                   	ret
+
+00000000008013c5 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013c5:	55                   	push   %rbp
+  8013c6:	48 89 e5             	mov    %rsp,%rbp
+  8013c9:	41 54                	push   %r12
+  8013cb:	53                   	push   %rbx
+  8013cc:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013cf:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013d6:	00 00 00 
+  8013d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013de:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013e2:	74 15                	je     8013f9 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013e4:	48 83 c3 01          	add    $0x1,%rbx
+  8013e8:	48 83 c0 18          	add    $0x18,%rax
+  8013ec:	48 83 fb 20          	cmp    $0x20,%rbx
+  8013f0:	75 ec                	jne    8013de <mmap_alloc+0x19>
+    return NULL;
+  8013f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f7:	eb 52                	jmp    80144b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8013f9:	4c 89 e7             	mov    %r12,%rdi
+  8013fc:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  801403:	00 00 00 
+  801406:	ff d0                	call   *%rax
+  801408:	41 89 c1             	mov    %eax,%r9d
+  80140b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801412:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801416:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80141c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801421:	4c 89 e6             	mov    %r12,%rsi
+  801424:	bf 00 00 00 00       	mov    $0x0,%edi
+  801429:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  801430:	00 00 00 
+  801433:	ff d0                	call   *%rax
+  801435:	85 c0                	test   %eax,%eax
+  801437:	78 17                	js     801450 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801439:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80143d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801444:	00 00 00 
+  801447:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80144b:	5b                   	pop    %rbx
+  80144c:	41 5c                	pop    %r12
+  80144e:	5d                   	pop    %rbp
+  80144f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801450:	b8 00 00 00 00       	mov    $0x0,%eax
+  801455:	eb f4                	jmp    80144b <mmap_alloc+0x86>
+
+0000000000801457 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  801457:	55                   	push   %rbp
+  801458:	48 89 e5             	mov    %rsp,%rbp
+  80145b:	41 56                	push   %r14
+  80145d:	41 55                	push   %r13
+  80145f:	41 54                	push   %r12
+  801461:	53                   	push   %rbx
+  801462:	48 83 ec 10          	sub    $0x10,%rsp
+  801466:	41 89 fc             	mov    %edi,%r12d
+  801469:	49 89 f5             	mov    %rsi,%r13
+  80146c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80146f:	48 89 f0             	mov    %rsi,%rax
+  801472:	48 09 d0             	or     %rdx,%rax
+  801475:	75 0d                	jne    801484 <fsipc+0x2d>
+  801477:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80147a:	83 f8 04             	cmp    $0x4,%eax
+  80147d:	76 7d                	jbe    8014fc <fsipc+0xa5>
+  80147f:	83 ff 0d             	cmp    $0xd,%edi
+  801482:	74 78                	je     8014fc <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  801484:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  80148b:	00 00 00 
+  80148e:	ff d0                	call   *%rax
+  801490:	89 c7                	mov    %eax,%edi
+  801492:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  801499:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014a0:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014ad:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014b4:	00 00 00 
+  8014b7:	44 89 e6             	mov    %r12d,%esi
+  8014ba:	48 b8 d8 45 80 00 00 	movabs $0x8045d8,%rax
+  8014c1:	00 00 00 
+  8014c4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014c6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014cd:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014d7:	4c 89 ee             	mov    %r13,%rsi
+  8014da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014df:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  8014e6:	00 00 00 
+  8014e9:	ff d0                	call   *%rax
+  8014eb:	89 c3                	mov    %eax,%ebx
+}
+  8014ed:	89 d8                	mov    %ebx,%eax
+  8014ef:	48 83 c4 10          	add    $0x10,%rsp
+  8014f3:	5b                   	pop    %rbx
+  8014f4:	41 5c                	pop    %r12
+  8014f6:	41 5d                	pop    %r13
+  8014f8:	41 5e                	pop    %r14
+  8014fa:	5d                   	pop    %rbp
+  8014fb:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014fc:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  801503:	00 00 00 
+  801506:	ff d0                	call   *%rax
+  801508:	49 89 c6             	mov    %rax,%r14
+  80150b:	48 85 c0             	test   %rax,%rax
+  80150e:	0f 84 70 ff ff ff    	je     801484 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801514:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801518:	48 b8 0c 30 80 00 00 	movabs $0x80300c,%rax
+  80151f:	00 00 00 
+  801522:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801524:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801527:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80152e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801532:	ba 10 00 00 00       	mov    $0x10,%edx
+  801537:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80153e:	00 00 00 
+  801541:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801548:	00 00 00 
+  80154b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80154d:	4c 89 f7             	mov    %r14,%rdi
+  801550:	48 b8 a5 0f 80 00 00 	movabs $0x800fa5,%rax
+  801557:	00 00 00 
+  80155a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80155c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801563:	4c 89 f7             	mov    %r14,%rdi
+  801566:	48 b8 cf 30 80 00 00 	movabs $0x8030cf,%rax
+  80156d:	00 00 00 
+  801570:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801572:	4c 89 f7             	mov    %r14,%rdi
+  801575:	48 b8 5d 30 80 00 00 	movabs $0x80305d,%rax
+  80157c:	00 00 00 
+  80157f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801581:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  801584:	41 83 fc 05          	cmp    $0x5,%r12d
+  801588:	75 04                	jne    80158e <fsipc+0x137>
+  80158a:	85 db                	test   %ebx,%ebx
+  80158c:	79 14                	jns    8015a2 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80158e:	4c 89 f7             	mov    %r14,%rdi
+  801591:	48 b8 84 30 80 00 00 	movabs $0x803084,%rax
+  801598:	00 00 00 
+  80159b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80159d:	e9 4b ff ff ff       	jmp    8014ed <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015a2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015a6:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015ab:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015b2:	00 00 00 
+  8015b5:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  8015bc:	00 00 00 
+  8015bf:	ff d0                	call   *%rax
+  8015c1:	eb cb                	jmp    80158e <fsipc+0x137>
+
+00000000008015c3 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015c3:	55                   	push   %rbp
+  8015c4:	48 89 e5             	mov    %rsp,%rbp
+  8015c7:	41 57                	push   %r15
+  8015c9:	41 56                	push   %r14
+  8015cb:	41 55                	push   %r13
+  8015cd:	41 54                	push   %r12
+  8015cf:	53                   	push   %rbx
+  8015d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d4:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015d8:	49 89 f6             	mov    %rsi,%r14
+  8015db:	49 89 d4             	mov    %rdx,%r12
+  8015de:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015e1:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  8015e8:	00 00 00 
+  8015eb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015ed:	48 85 c0             	test   %rax,%rax
+  8015f0:	0f 85 96 00 00 00    	jne    80168c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8015f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015fd:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015fe:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801605:	00 00 00 
+    while (n) {
+  801608:	4d 85 e4             	test   %r12,%r12
+  80160b:	74 79                	je     801686 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80160d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801612:	49 39 dc             	cmp    %rbx,%r12
+  801615:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801619:	48 89 da             	mov    %rbx,%rdx
+  80161c:	4c 89 f6             	mov    %r14,%rsi
+  80161f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801626:	00 00 00 
+  801629:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801630:	00 00 00 
+  801633:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801635:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801639:	8b 40 0c             	mov    0xc(%rax),%eax
+  80163c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80163f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801642:	44 01 e8             	add    %r13d,%eax
+  801645:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801649:	41 0f 44 c5          	cmove  %r13d,%eax
+  80164d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801651:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801655:	48 89 da             	mov    %rbx,%rdx
+  801658:	be 00 00 00 00       	mov    $0x0,%esi
+  80165d:	bf 04 00 00 00       	mov    $0x4,%edi
+  801662:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  801669:	00 00 00 
+  80166c:	ff d0                	call   *%rax
+        if (res < 0)
+  80166e:	85 c0                	test   %eax,%eax
+  801670:	78 4a                	js     8016bc <devfile_write_direct+0xf9>
+        buf += res;
+  801672:	48 98                	cltq
+  801674:	49 01 c6             	add    %rax,%r14
+        write += res;
+  801677:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80167b:	49 29 c4             	sub    %rax,%r12
+  80167e:	75 8d                	jne    80160d <devfile_write_direct+0x4a>
+    return write;
+  801680:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801684:	eb 27                	jmp    8016ad <devfile_write_direct+0xea>
+    size_t write = 0;
+  801686:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80168a:	eb f4                	jmp    801680 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80168c:	45 89 e9             	mov    %r13d,%r9d
+  80168f:	4d 89 e0             	mov    %r12,%r8
+  801692:	4c 89 f1             	mov    %r14,%rcx
+  801695:	ba 04 00 00 00       	mov    $0x4,%edx
+  80169a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80169e:	48 89 c7             	mov    %rax,%rdi
+  8016a1:	48 b8 f0 0f 80 00 00 	movabs $0x800ff0,%rax
+  8016a8:	00 00 00 
+  8016ab:	ff d0                	call   *%rax
+}
+  8016ad:	48 83 c4 18          	add    $0x18,%rsp
+  8016b1:	5b                   	pop    %rbx
+  8016b2:	41 5c                	pop    %r12
+  8016b4:	41 5d                	pop    %r13
+  8016b6:	41 5e                	pop    %r14
+  8016b8:	41 5f                	pop    %r15
+  8016ba:	5d                   	pop    %rbp
+  8016bb:	c3                   	ret
+            return res;
+  8016bc:	48 98                	cltq
+  8016be:	eb ed                	jmp    8016ad <devfile_write_direct+0xea>
+
+00000000008016c0 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016c0:	55                   	push   %rbp
+  8016c1:	48 89 e5             	mov    %rsp,%rbp
+  8016c4:	41 54                	push   %r12
+  8016c6:	53                   	push   %rbx
+  8016c7:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016ca:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  8016d1:	00 00 00 
+  8016d4:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016d6:	48 85 c0             	test   %rax,%rax
+  8016d9:	74 71                	je     80174c <fbuf_flush+0x8c>
+  8016db:	48 89 c3             	mov    %rax,%rbx
+  8016de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e3:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016e7:	75 05                	jne    8016ee <fbuf_flush+0x2e>
+}
+  8016e9:	5b                   	pop    %rbx
+  8016ea:	41 5c                	pop    %r12
+  8016ec:	5d                   	pop    %rbp
+  8016ed:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016ee:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8016f1:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8016f5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8016fc:	00 00 00 
+  8016ff:	48 89 de             	mov    %rbx,%rsi
+  801702:	48 29 c6             	sub    %rax,%rsi
+  801705:	48 c1 fe 03          	sar    $0x3,%rsi
+  801709:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801710:	aa aa aa 
+  801713:	48 0f af f0          	imul   %rax,%rsi
+  801717:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80171b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801720:	48 01 c6             	add    %rax,%rsi
+  801723:	4c 89 e7             	mov    %r12,%rdi
+  801726:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  80172d:	00 00 00 
+  801730:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801732:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801736:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80173d:	00 
+    return res < 0 ? res : 0;
+  80173e:	48 85 c0             	test   %rax,%rax
+  801741:	ba 00 00 00 00       	mov    $0x0,%edx
+  801746:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80174a:	eb 9d                	jmp    8016e9 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80174c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801751:	eb 96                	jmp    8016e9 <fbuf_flush+0x29>
+
+0000000000801753 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801753:	55                   	push   %rbp
+  801754:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801757:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  80175e:	00 00 00 
+  801761:	ff d0                	call   *%rax
+}
+  801763:	5d                   	pop    %rbp
+  801764:	c3                   	ret
+
+0000000000801765 <devfile_write>:
+    if (!fd || !buf)
+  801765:	48 85 ff             	test   %rdi,%rdi
+  801768:	0f 84 d3 01 00 00    	je     801941 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80176e:	55                   	push   %rbp
+  80176f:	48 89 e5             	mov    %rsp,%rbp
+  801772:	41 57                	push   %r15
+  801774:	41 56                	push   %r14
+  801776:	41 55                	push   %r13
+  801778:	41 54                	push   %r12
+  80177a:	53                   	push   %rbx
+  80177b:	48 83 ec 08          	sub    $0x8,%rsp
+  80177f:	49 89 fc             	mov    %rdi,%r12
+  801782:	49 89 f6             	mov    %rsi,%r14
+  801785:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  801788:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80178d:	48 85 f6             	test   %rsi,%rsi
+  801790:	0f 84 9c 01 00 00    	je     801932 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  801796:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  80179d:	00 00 00 
+  8017a0:	ff d0                	call   *%rax
+  8017a2:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017a5:	48 85 c0             	test   %rax,%rax
+  8017a8:	0f 84 a2 00 00 00    	je     801850 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017ae:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017b3:	4c 89 e7             	mov    %r12,%rdi
+  8017b6:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  8017bd:	00 00 00 
+  8017c0:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017c2:	83 f8 02             	cmp    $0x2,%eax
+  8017c5:	0f 8f 85 00 00 00    	jg     801850 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017cb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017d2:	00 00 00 
+  8017d5:	4d 89 ef             	mov    %r13,%r15
+  8017d8:	49 29 c7             	sub    %rax,%r15
+  8017db:	49 c1 ff 03          	sar    $0x3,%r15
+  8017df:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017e6:	aa aa aa 
+  8017e9:	4c 0f af f8          	imul   %rax,%r15
+  8017ed:	49 c1 e7 0e          	shl    $0xe,%r15
+  8017f1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8017f6:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8017f9:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8017fe:	0f 84 d7 00 00 00    	je     8018db <devfile_write+0x176>
+  801804:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801808:	89 c2                	mov    %eax,%edx
+  80180a:	41 03 55 0c          	add    0xc(%r13),%edx
+  80180e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801813:	75 0f                	jne    801824 <devfile_write+0xbf>
+  801815:	48 01 d8             	add    %rbx,%rax
+  801818:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80181e:	0f 86 92 00 00 00    	jbe    8018b6 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801824:	4c 89 e7             	mov    %r12,%rdi
+  801827:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  80182e:	00 00 00 
+  801831:	ff d0                	call   *%rax
+  801833:	85 c0                	test   %eax,%eax
+  801835:	78 52                	js     801889 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801837:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80183e:	77 7f                	ja     8018bf <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801840:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801845:	0f 85 c2 00 00 00    	jne    80190d <devfile_write+0x1a8>
+  80184b:	e9 94 00 00 00       	jmp    8018e4 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801850:	4c 89 e7             	mov    %r12,%rdi
+  801853:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  80185a:	00 00 00 
+  80185d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80185f:	85 c0                	test   %eax,%eax
+  801861:	79 07                	jns    80186a <devfile_write+0x105>
+  801863:	48 98                	cltq
+  801865:	e9 c8 00 00 00       	jmp    801932 <devfile_write+0x1cd>
+  80186a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80186f:	48 89 da             	mov    %rbx,%rdx
+  801872:	4c 89 f6             	mov    %r14,%rsi
+  801875:	4c 89 e7             	mov    %r12,%rdi
+  801878:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  80187f:	00 00 00 
+  801882:	ff d0                	call   *%rax
+  801884:	e9 a9 00 00 00       	jmp    801932 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801889:	48 98                	cltq
+  80188b:	e9 a2 00 00 00       	jmp    801932 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801890:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801895:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80189a:	4c 89 fe             	mov    %r15,%rsi
+  80189d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018a2:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  8018a9:	00 00 00 
+  8018ac:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018ae:	85 c0                	test   %eax,%eax
+  8018b0:	79 45                	jns    8018f7 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018b2:	48 98                	cltq
+  8018b4:	eb 7c                	jmp    801932 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018b6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018bd:	76 4e                	jbe    80190d <devfile_write+0x1a8>
+  8018bf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018c4:	48 89 da             	mov    %rbx,%rdx
+  8018c7:	4c 89 f6             	mov    %r14,%rsi
+  8018ca:	4c 89 e7             	mov    %r12,%rdi
+  8018cd:	48 b8 c3 15 80 00 00 	movabs $0x8015c3,%rax
+  8018d4:	00 00 00 
+  8018d7:	ff d0                	call   *%rax
+  8018d9:	eb 57                	jmp    801932 <devfile_write+0x1cd>
+  8018db:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018e2:	77 db                	ja     8018bf <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018e4:	4c 89 ff             	mov    %r15,%rdi
+  8018e7:	48 b8 8e 2e 80 00 00 	movabs $0x802e8e,%rax
+  8018ee:	00 00 00 
+  8018f1:	ff d0                	call   *%rax
+  8018f3:	84 c0                	test   %al,%al
+  8018f5:	74 99                	je     801890 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8018f7:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8018fc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801901:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801905:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80190c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80190d:	4c 89 ff             	mov    %r15,%rdi
+  801910:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801914:	48 89 da             	mov    %rbx,%rdx
+  801917:	4c 89 f6             	mov    %r14,%rsi
+  80191a:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801921:	00 00 00 
+  801924:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801926:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80192a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80192f:	48 89 d8             	mov    %rbx,%rax
+}
+  801932:	48 83 c4 08          	add    $0x8,%rsp
+  801936:	5b                   	pop    %rbx
+  801937:	41 5c                	pop    %r12
+  801939:	41 5d                	pop    %r13
+  80193b:	41 5e                	pop    %r14
+  80193d:	41 5f                	pop    %r15
+  80193f:	5d                   	pop    %rbp
+  801940:	c3                   	ret
+        return E_INVAL;
+  801941:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801946:	c3                   	ret
+
+0000000000801947 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801947:	55                   	push   %rbp
+  801948:	48 89 e5             	mov    %rsp,%rbp
+  80194b:	41 54                	push   %r12
+  80194d:	53                   	push   %rbx
+  80194e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801951:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  801958:	00 00 00 
+  80195b:	ff d0                	call   *%rax
+  80195d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801960:	48 89 df             	mov    %rbx,%rdi
+  801963:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  80196a:	00 00 00 
+  80196d:	ff d0                	call   *%rax
+  80196f:	48 85 c0             	test   %rax,%rax
+  801972:	74 17                	je     80198b <devfile_flush+0x44>
+  801974:	48 89 df             	mov    %rbx,%rdi
+  801977:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  80197e:	00 00 00 
+  801981:	ff d0                	call   *%rax
+  801983:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80198a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  80198b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  80198e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  801995:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  801997:	ba 00 00 00 00       	mov    $0x0,%edx
+  80199c:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a1:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019a6:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  8019ad:	00 00 00 
+  8019b0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019b2:	45 85 e4             	test   %r12d,%r12d
+  8019b5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019b9:	5b                   	pop    %rbx
+  8019ba:	41 5c                	pop    %r12
+  8019bc:	5d                   	pop    %rbp
+  8019bd:	c3                   	ret
+
+00000000008019be <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019be:	55                   	push   %rbp
+  8019bf:	48 89 e5             	mov    %rsp,%rbp
+  8019c2:	41 57                	push   %r15
+  8019c4:	41 56                	push   %r14
+  8019c6:	41 55                	push   %r13
+  8019c8:	41 54                	push   %r12
+  8019ca:	53                   	push   %rbx
+  8019cb:	48 83 ec 38          	sub    $0x38,%rsp
+  8019cf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019d3:	49 89 f7             	mov    %rsi,%r15
+  8019d6:	48 89 d3             	mov    %rdx,%rbx
+  8019d9:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019dc:	48 b8 09 0f 80 00 00 	movabs $0x800f09,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019e8:	48 85 c0             	test   %rax,%rax
+  8019eb:	75 20                	jne    801a0d <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019ed:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8019f2:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8019f9:	00 
+    while (n) {
+  8019fa:	48 85 db             	test   %rbx,%rbx
+  8019fd:	0f 85 df 00 00 00    	jne    801ae2 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a03:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a0b:	eb 21                	jmp    801a2e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a0d:	45 89 f1             	mov    %r14d,%r9d
+  801a10:	49 89 d8             	mov    %rbx,%r8
+  801a13:	4c 89 f9             	mov    %r15,%rcx
+  801a16:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a1b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a1f:	48 89 c7             	mov    %rax,%rdi
+  801a22:	48 b8 f0 0f 80 00 00 	movabs $0x800ff0,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+}
+  801a2e:	48 83 c4 38          	add    $0x38,%rsp
+  801a32:	5b                   	pop    %rbx
+  801a33:	41 5c                	pop    %r12
+  801a35:	41 5d                	pop    %r13
+  801a37:	41 5e                	pop    %r14
+  801a39:	41 5f                	pop    %r15
+  801a3b:	5d                   	pop    %rbp
+  801a3c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a41:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a47:	75 1e                	jne    801a67 <devfile_read_direct+0xa9>
+  801a49:	e9 e2 00 00 00       	jmp    801b30 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a4e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a52:	eb da                	jmp    801a2e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a54:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a58:	0f 85 d0 01 00 00    	jne    801c2e <devfile_read_direct+0x270>
+            map = 0;
+  801a5e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a62:	eb 03                	jmp    801a67 <devfile_read_direct+0xa9>
+  801a64:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a67:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a6c:	48 39 d3             	cmp    %rdx,%rbx
+  801a6f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a73:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a77:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a7a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a81:	00 00 00 
+  801a84:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a86:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a8a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a8e:	be 00 00 00 00       	mov    $0x0,%esi
+  801a93:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a98:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  801a9f:	00 00 00 
+  801aa2:	ff d0                	call   *%rax
+        if (res <= 0)
+  801aa4:	85 c0                	test   %eax,%eax
+  801aa6:	0f 8e 63 01 00 00    	jle    801c0f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801aac:	4c 63 e0             	movslq %eax,%r12
+  801aaf:	4c 89 e2             	mov    %r12,%rdx
+  801ab2:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ab9:	00 00 00 
+  801abc:	4c 89 ff             	mov    %r15,%rdi
+  801abf:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801ac6:	00 00 00 
+  801ac9:	ff d0                	call   *%rax
+        buf += res;
+  801acb:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ace:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ad1:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801ad5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801ad9:	48 85 db             	test   %rbx,%rbx
+  801adc:	0f 84 25 ff ff ff    	je     801a07 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801ae2:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801ae5:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801ae9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801aed:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801af1:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801af8:	0f 97 c2             	seta   %dl
+  801afb:	20 c2                	and    %al,%dl
+  801afd:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b00:	0f 84 5e ff ff ff    	je     801a64 <devfile_read_direct+0xa6>
+  801b06:	4c 89 fa             	mov    %r15,%rdx
+  801b09:	4d 89 fd             	mov    %r15,%r13
+  801b0c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b13:	0f 85 4e ff ff ff    	jne    801a67 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b19:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b1d:	0f 84 1a ff ff ff    	je     801a3d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b23:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b2a:	0f 85 37 ff ff ff    	jne    801a67 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b30:	48 89 d8             	mov    %rbx,%rax
+  801b33:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b39:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b3e:	48 39 c8             	cmp    %rcx,%rax
+  801b41:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b49:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b4d:	49 89 d4             	mov    %rdx,%r12
+  801b50:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b54:	48 b8 2f 2e 80 00 00 	movabs $0x802e2f,%rax
+  801b5b:	00 00 00 
+  801b5e:	ff d0                	call   *%rax
+  801b60:	a8 40                	test   $0x40,%al
+  801b62:	0f 85 b9 00 00 00    	jne    801c21 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b68:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b73:	49 39 c5             	cmp    %rax,%r13
+  801b76:	72 d8                	jb     801b50 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b78:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b7c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b83:	00 00 00 
+  801b86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b8a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b8d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b8f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801b93:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801b97:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  801b9e:	00 00 00 
+  801ba1:	ff d0                	call   *%rax
+  801ba3:	89 c7                	mov    %eax,%edi
+  801ba5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bab:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bb0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bb7:	00 00 00 
+  801bba:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bbf:	48 b8 d8 45 80 00 00 	movabs $0x8045d8,%rax
+  801bc6:	00 00 00 
+  801bc9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bcb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bd0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bd4:	4c 89 fe             	mov    %r15,%rsi
+  801bd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bdc:	48 b8 b4 45 80 00 00 	movabs $0x8045b4,%rax
+  801be3:	00 00 00 
+  801be6:	ff d0                	call   *%rax
+  801be8:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801beb:	48 85 d2             	test   %rdx,%rdx
+  801bee:	0f 84 5a fe ff ff    	je     801a4e <devfile_read_direct+0x90>
+            if (res > 0) {
+  801bf4:	0f 8e 5a fe ff ff    	jle    801a54 <devfile_read_direct+0x96>
+                buf += res;
+  801bfa:	48 98                	cltq
+  801bfc:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801bff:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c02:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c06:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c0a:	e9 ca fe ff ff       	jmp    801ad9 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c0f:	41 89 c5             	mov    %eax,%r13d
+  801c12:	48 98                	cltq
+  801c14:	45 85 ed             	test   %r13d,%r13d
+  801c17:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c1c:	e9 0d fe ff ff       	jmp    801a2e <devfile_read_direct+0x70>
+            map = 0;
+  801c21:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c25:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c29:	e9 39 fe ff ff       	jmp    801a67 <devfile_read_direct+0xa9>
+  801c2e:	48 89 d0             	mov    %rdx,%rax
+  801c31:	e9 f8 fd ff ff       	jmp    801a2e <devfile_read_direct+0x70>
+
+0000000000801c36 <devfile_read>:
+    if (!fd || !buf)
+  801c36:	48 85 ff             	test   %rdi,%rdi
+  801c39:	0f 84 21 02 00 00    	je     801e60 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c3f:	55                   	push   %rbp
+  801c40:	48 89 e5             	mov    %rsp,%rbp
+  801c43:	41 57                	push   %r15
+  801c45:	41 56                	push   %r14
+  801c47:	41 55                	push   %r13
+  801c49:	41 54                	push   %r12
+  801c4b:	53                   	push   %rbx
+  801c4c:	48 83 ec 28          	sub    $0x28,%rsp
+  801c50:	48 89 fb             	mov    %rdi,%rbx
+  801c53:	49 89 f4             	mov    %rsi,%r12
+  801c56:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c59:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c5e:	48 85 f6             	test   %rsi,%rsi
+  801c61:	74 4b                	je     801cae <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c63:	48 b8 73 0f 80 00 00 	movabs $0x800f73,%rax
+  801c6a:	00 00 00 
+  801c6d:	ff d0                	call   *%rax
+  801c6f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c72:	48 85 c0             	test   %rax,%rax
+  801c75:	74 22                	je     801c99 <devfile_read+0x63>
+  801c77:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c7e:	77 19                	ja     801c99 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c80:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c85:	48 89 df             	mov    %rbx,%rdi
+  801c88:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  801c8f:	00 00 00 
+  801c92:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c94:	83 f8 02             	cmp    $0x2,%eax
+  801c97:	7e 40                	jle    801cd9 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801c99:	48 89 df             	mov    %rbx,%rdi
+  801c9c:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801ca8:	85 c0                	test   %eax,%eax
+  801caa:	79 11                	jns    801cbd <devfile_read+0x87>
+  801cac:	48 98                	cltq
+}
+  801cae:	48 83 c4 28          	add    $0x28,%rsp
+  801cb2:	5b                   	pop    %rbx
+  801cb3:	41 5c                	pop    %r12
+  801cb5:	41 5d                	pop    %r13
+  801cb7:	41 5e                	pop    %r14
+  801cb9:	41 5f                	pop    %r15
+  801cbb:	5d                   	pop    %rbp
+  801cbc:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cbd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cc2:	4c 89 ea             	mov    %r13,%rdx
+  801cc5:	4c 89 e6             	mov    %r12,%rsi
+  801cc8:	48 89 df             	mov    %rbx,%rdi
+  801ccb:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  801cd2:	00 00 00 
+  801cd5:	ff d0                	call   *%rax
+  801cd7:	eb d5                	jmp    801cae <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cd9:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cdd:	48 89 df             	mov    %rbx,%rdi
+  801ce0:	48 b8 c0 16 80 00 00 	movabs $0x8016c0,%rax
+  801ce7:	00 00 00 
+  801cea:	ff d0                	call   *%rax
+  801cec:	85 c0                	test   %eax,%eax
+  801cee:	0f 88 33 01 00 00    	js     801e27 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801cf4:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801cfb:	00 00 00 
+  801cfe:	4c 89 f0             	mov    %r14,%rax
+  801d01:	48 29 d0             	sub    %rdx,%rax
+  801d04:	48 c1 f8 03          	sar    $0x3,%rax
+  801d08:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d0f:	aa aa aa 
+  801d12:	48 0f af c2          	imul   %rdx,%rax
+  801d16:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d1a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d1e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d21:	41 39 06             	cmp    %eax,(%r14)
+  801d24:	75 0d                	jne    801d33 <devfile_read+0xfd>
+  801d26:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d29:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d2d:	0f 84 fb 00 00 00    	je     801e2e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d33:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d38:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d3c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d43:	48 89 c7             	mov    %rax,%rdi
+  801d46:	48 b8 8e 2e 80 00 00 	movabs $0x802e8e,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+  801d52:	84 c0                	test   %al,%al
+  801d54:	75 27                	jne    801d7d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d56:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d5b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d60:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d64:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d69:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  801d70:	00 00 00 
+  801d73:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d75:	85 c0                	test   %eax,%eax
+  801d77:	0f 88 dc 00 00 00    	js     801e59 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d7d:	44 89 f8             	mov    %r15d,%eax
+  801d80:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d85:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d87:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d8e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d8f:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d92:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801d96:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801d99:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d9e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801da2:	48 89 df             	mov    %rbx,%rdi
+  801da5:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  801dac:	00 00 00 
+  801daf:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801db1:	48 85 c0             	test   %rax,%rax
+  801db4:	0f 88 f4 fe ff ff    	js     801cae <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dba:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dbd:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dc0:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dc3:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dc7:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dcb:	48 63 d1             	movslq %ecx,%rdx
+  801dce:	48 01 d0             	add    %rdx,%rax
+  801dd1:	4d 63 ff             	movslq %r15d,%r15
+  801dd4:	4c 29 f8             	sub    %r15,%rax
+  801dd7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ddc:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801de0:	48 85 c0             	test   %rax,%rax
+  801de3:	0f 8e c5 fe ff ff    	jle    801cae <devfile_read+0x78>
+    n = MIN(n, res);
+  801de9:	4c 39 e8             	cmp    %r13,%rax
+  801dec:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801df0:	8b 73 04             	mov    0x4(%rbx),%esi
+  801df3:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801df7:	48 63 f6             	movslq %esi,%rsi
+  801dfa:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801dff:	48 01 c6             	add    %rax,%rsi
+  801e02:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e06:	48 01 c6             	add    %rax,%rsi
+  801e09:	4c 89 ea             	mov    %r13,%rdx
+  801e0c:	4c 89 e7             	mov    %r12,%rdi
+  801e0f:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e1b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e1f:	4c 89 e8             	mov    %r13,%rax
+  801e22:	e9 87 fe ff ff       	jmp    801cae <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e27:	48 98                	cltq
+  801e29:	e9 80 fe ff ff       	jmp    801cae <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e2e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e32:	41 39 d7             	cmp    %edx,%r15d
+  801e35:	0f 8c f8 fe ff ff    	jl     801d33 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e3b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e3f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e42:	41 39 cf             	cmp    %ecx,%r15d
+  801e45:	0f 8d e8 fe ff ff    	jge    801d33 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e4b:	4d 63 ff             	movslq %r15d,%r15
+  801e4e:	4c 29 f8             	sub    %r15,%rax
+  801e51:	48 63 d2             	movslq %edx,%rdx
+  801e54:	48 01 d0             	add    %rdx,%rax
+  801e57:	eb 87                	jmp    801de0 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e59:	48 98                	cltq
+  801e5b:	e9 4e fe ff ff       	jmp    801cae <devfile_read+0x78>
+        return E_INVAL;
+  801e60:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e65:	c3                   	ret
+
+0000000000801e66 <fs_channel>:
+fs_channel(bool enable) {
+  801e66:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e68:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e6f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e71:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e76:	40 84 ff             	test   %dil,%dil
+  801e79:	74 47                	je     801ec2 <fs_channel+0x5c>
+  801e7b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e82:	00 00 00 
+  801e85:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e8b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e92:	00 00 00 
+  801e95:	3b 08                	cmp    (%rax),%ecx
+  801e97:	74 29                	je     801ec2 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801e99:	55                   	push   %rbp
+  801e9a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801e9d:	48 b8 e6 0d 80 00 00 	movabs $0x800de6,%rax
+  801ea4:	00 00 00 
+  801ea7:	ff d0                	call   *%rax
+  801ea9:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	78 04                	js     801eb3 <fs_channel+0x4d>
+}
+  801eaf:	89 d0                	mov    %edx,%eax
+  801eb1:	5d                   	pop    %rbp
+  801eb2:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801eb3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eba:	00 00 00 
+  801ebd:	c6 00 00             	movb   $0x0,(%rax)
+  801ec0:	eb ed                	jmp    801eaf <fs_channel+0x49>
+}
+  801ec2:	89 d0                	mov    %edx,%eax
+  801ec4:	c3                   	ret
+
+0000000000801ec5 <open>:
+open(const char *path, int mode) {
+  801ec5:	55                   	push   %rbp
+  801ec6:	48 89 e5             	mov    %rsp,%rbp
+  801ec9:	41 55                	push   %r13
+  801ecb:	41 54                	push   %r12
+  801ecd:	53                   	push   %rbx
+  801ece:	48 83 ec 18          	sub    $0x18,%rsp
+  801ed2:	49 89 fc             	mov    %rdi,%r12
+  801ed5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ed8:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+  801ee4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801eea:	0f 87 8f 00 00 00    	ja     801f7f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ef0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ef4:	48 b8 a0 06 80 00 00 	movabs $0x8006a0,%rax
+  801efb:	00 00 00 
+  801efe:	ff d0                	call   *%rax
+  801f00:	89 c3                	mov    %eax,%ebx
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 55                	js     801f5b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f06:	4c 89 e6             	mov    %r12,%rsi
+  801f09:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f10:	00 00 00 
+  801f13:	48 89 df             	mov    %rbx,%rdi
+  801f16:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  801f1d:	00 00 00 
+  801f20:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f22:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f29:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f2e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f32:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f37:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  801f3e:	00 00 00 
+  801f41:	ff d0                	call   *%rax
+  801f43:	89 c3                	mov    %eax,%ebx
+  801f45:	85 c0                	test   %eax,%eax
+  801f47:	78 1f                	js     801f68 <open+0xa3>
+    return fd2num(fd);
+  801f49:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f4d:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+  801f59:	89 c3                	mov    %eax,%ebx
+}
+  801f5b:	89 d8                	mov    %ebx,%eax
+  801f5d:	48 83 c4 18          	add    $0x18,%rsp
+  801f61:	5b                   	pop    %rbx
+  801f62:	41 5c                	pop    %r12
+  801f64:	41 5d                	pop    %r13
+  801f66:	5d                   	pop    %rbp
+  801f67:	c3                   	ret
+        fd_close(fd, 0);
+  801f68:	be 00 00 00 00       	mov    $0x0,%esi
+  801f6d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f71:	48 b8 bb 07 80 00 00 	movabs $0x8007bb,%rax
+  801f78:	00 00 00 
+  801f7b:	ff d0                	call   *%rax
+        return res;
+  801f7d:	eb dc                	jmp    801f5b <open+0x96>
+        return -E_BAD_PATH;
+  801f7f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f84:	eb d5                	jmp    801f5b <open+0x96>
+
+0000000000801f86 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f86:	55                   	push   %rbp
+  801f87:	48 89 e5             	mov    %rsp,%rbp
+  801f8a:	41 56                	push   %r14
+  801f8c:	41 55                	push   %r13
+  801f8e:	41 54                	push   %r12
+  801f90:	53                   	push   %rbx
+  801f91:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801f95:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801f9c:	00 00 00 
+  801f9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fa4:	49 bd 00 07 80 00 00 	movabs $0x800700,%r13
+  801fab:	00 00 00 
+  801fae:	49 be c0 16 80 00 00 	movabs $0x8016c0,%r14
+  801fb5:	00 00 00 
+  801fb8:	eb 0c                	jmp    801fc6 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fba:	83 c3 01             	add    $0x1,%ebx
+  801fbd:	49 83 c4 18          	add    $0x18,%r12
+  801fc1:	83 fb 20             	cmp    $0x20,%ebx
+  801fc4:	74 1d                	je     801fe3 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fc6:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fcb:	74 ed                	je     801fba <file_flush_buffers+0x34>
+  801fcd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd1:	89 df                	mov    %ebx,%edi
+  801fd3:	41 ff d5             	call   *%r13
+  801fd6:	85 c0                	test   %eax,%eax
+  801fd8:	78 e0                	js     801fba <file_flush_buffers+0x34>
+  801fda:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fde:	41 ff d6             	call   *%r14
+  801fe1:	eb d7                	jmp    801fba <file_flush_buffers+0x34>
+}
+  801fe3:	48 83 c4 10          	add    $0x10,%rsp
+  801fe7:	5b                   	pop    %rbx
+  801fe8:	41 5c                	pop    %r12
+  801fea:	41 5d                	pop    %r13
+  801fec:	41 5e                	pop    %r14
+  801fee:	5d                   	pop    %rbp
+  801fef:	c3                   	ret
+
+0000000000801ff0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+  801ff4:	41 54                	push   %r12
+  801ff6:	53                   	push   %rbx
+  801ff7:	49 89 fc             	mov    %rdi,%r12
+  801ffa:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  801ffc:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802003:	00 00 00 
+  802006:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802008:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80200f:	00 00 00 
+  802012:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802017:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802019:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80201c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802021:	be 00 00 00 00       	mov    $0x0,%esi
+  802026:	bf 02 00 00 00       	mov    $0x2,%edi
+  80202b:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  802032:	00 00 00 
+  802035:	ff d0                	call   *%rax
+}
+  802037:	5b                   	pop    %rbx
+  802038:	41 5c                	pop    %r12
+  80203a:	5d                   	pop    %rbp
+  80203b:	c3                   	ret
+
+000000000080203c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80203c:	55                   	push   %rbp
+  80203d:	48 89 e5             	mov    %rsp,%rbp
+  802040:	41 54                	push   %r12
+  802042:	53                   	push   %rbx
+  802043:	49 89 fc             	mov    %rdi,%r12
+  802046:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802049:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802055:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80205a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802061:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802063:	ba 00 00 00 00       	mov    $0x0,%edx
+  802068:	be 00 00 00 00       	mov    $0x0,%esi
+  80206d:	bf 05 00 00 00       	mov    $0x5,%edi
+  802072:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80207e:	85 c0                	test   %eax,%eax
+  802080:	78 3d                	js     8020bf <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802082:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802089:	00 00 00 
+  80208c:	4c 89 e6             	mov    %r12,%rsi
+  80208f:	48 89 df             	mov    %rbx,%rdi
+  802092:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80209e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020a5:	00 
+  8020a6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020ac:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020b3:	00 
+  8020b4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020bf:	5b                   	pop    %rbx
+  8020c0:	41 5c                	pop    %r12
+  8020c2:	5d                   	pop    %rbp
+  8020c3:	c3                   	ret
+
+00000000008020c4 <remove>:
+remove(const char *path) {
+  8020c4:	55                   	push   %rbp
+  8020c5:	48 89 e5             	mov    %rsp,%rbp
+  8020c8:	53                   	push   %rbx
+  8020c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8020cd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020d0:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  8020d7:	00 00 00 
+  8020da:	ff d0                	call   *%rax
+  8020dc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020e2:	77 3a                	ja     80211e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020e4:	48 89 de             	mov    %rbx,%rsi
+  8020e7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020ee:	00 00 00 
+  8020f1:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  8020f8:	00 00 00 
+  8020fb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8020fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  802102:	be 00 00 00 00       	mov    $0x0,%esi
+  802107:	bf 07 00 00 00       	mov    $0x7,%edi
+  80210c:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  802113:	00 00 00 
+  802116:	ff d0                	call   *%rax
+}
+  802118:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80211c:	c9                   	leave
+  80211d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80211e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802123:	eb f3                	jmp    802118 <remove+0x54>
+
+0000000000802125 <sync>:
+sync(void) {
+  802125:	55                   	push   %rbp
+  802126:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802129:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802130:	00 00 00 
+  802133:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802135:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213a:	be 00 00 00 00       	mov    $0x0,%esi
+  80213f:	bf 08 00 00 00       	mov    $0x8,%edi
+  802144:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+}
+  802150:	5d                   	pop    %rbp
+  802151:	c3                   	ret
+
+0000000000802152 <fsync>:
+fsync(int fdnum) {
+  802152:	55                   	push   %rbp
+  802153:	48 89 e5             	mov    %rsp,%rbp
+  802156:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80215a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80215e:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80216a:	85 c0                	test   %eax,%eax
+  80216c:	78 4b                	js     8021b9 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80216e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802172:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802179:	00 00 00 
+  80217c:	8b 00                	mov    (%rax),%eax
+  80217e:	39 02                	cmp    %eax,(%rdx)
+  802180:	75 39                	jne    8021bb <fsync+0x69>
+    file_flush_buffers();
+  802182:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80218e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802192:	8b 40 0c             	mov    0xc(%rax),%eax
+  802195:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80219c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80219e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021a8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021ad:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+}
+  8021b9:	c9                   	leave
+  8021ba:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c0:	eb f7                	jmp    8021b9 <fsync+0x67>
+
+00000000008021c2 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021c2:	55                   	push   %rbp
+  8021c3:	48 89 e5             	mov    %rsp,%rbp
+  8021c6:	53                   	push   %rbx
+  8021c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8021cb:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8021d8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021dd:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  8021e4:	00 00 00 
+  8021e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021e9:	85 c0                	test   %eax,%eax
+  8021eb:	78 2d                	js     80221a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021ed:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8021f4:	00 00 00 
+  8021f7:	48 8b 10             	mov    (%rax),%rdx
+  8021fa:	48 89 13             	mov    %rdx,(%rbx)
+  8021fd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802201:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802205:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802209:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80220d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802211:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802215:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80221e:	c9                   	leave
+  80221f:	c3                   	ret
+
+0000000000802220 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+  802224:	53                   	push   %rbx
+  802225:	48 83 ec 08          	sub    $0x8,%rsp
+  802229:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80222c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802231:	be 00 00 00 00       	mov    $0x0,%esi
+  802236:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80223b:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  802242:	00 00 00 
+  802245:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802247:	85 c0                	test   %eax,%eax
+  802249:	78 3d                	js     802288 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80224b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802252:	00 00 00 
+  802255:	48 8b 10             	mov    (%rax),%rdx
+  802258:	48 89 13             	mov    %rdx,(%rbx)
+  80225b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80225f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802263:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802267:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80226b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80226f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802273:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802277:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80227b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80227f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  802283:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802288:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80228c:	c9                   	leave
+  80228d:	c3                   	ret
+
+000000000080228e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80228e:	55                   	push   %rbp
+  80228f:	48 89 e5             	mov    %rsp,%rbp
+  802292:	41 57                	push   %r15
+  802294:	41 56                	push   %r14
+  802296:	41 55                	push   %r13
+  802298:	41 54                	push   %r12
+  80229a:	53                   	push   %rbx
+  80229b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80229f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022a6:	00 
+  8022a7:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022ae:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022b4:	0f 85 43 01 00 00    	jne    8023fd <munmap+0x16f>
+  8022ba:	49 89 ff             	mov    %rdi,%r15
+  8022bd:	4c 39 f7             	cmp    %r14,%rdi
+  8022c0:	0f 87 37 01 00 00    	ja     8023fd <munmap+0x16f>
+  8022c6:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022cd:	00 00 00 
+  8022d0:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022d6:	eb 2c                	jmp    802304 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022d8:	4c 39 f8             	cmp    %r15,%rax
+  8022db:	0f 83 85 00 00 00    	jae    802366 <munmap+0xd8>
+            m->mm_end = start;
+  8022e1:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022e6:	48 83 c3 18          	add    $0x18,%rbx
+  8022ea:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8022f1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8022f8:	00 00 00 
+  8022fb:	48 39 c3             	cmp    %rax,%rbx
+  8022fe:	0f 84 d0 00 00 00    	je     8023d4 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802304:	49 89 dc             	mov    %rbx,%r12
+  802307:	48 8b 03             	mov    (%rbx),%rax
+  80230a:	4c 39 f0             	cmp    %r14,%rax
+  80230d:	73 d7                	jae    8022e6 <munmap+0x58>
+  80230f:	48 85 c0             	test   %rax,%rax
+  802312:	74 d2                	je     8022e6 <munmap+0x58>
+  802314:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802318:	49 39 d7             	cmp    %rdx,%r15
+  80231b:	73 c9                	jae    8022e6 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80231d:	49 39 d6             	cmp    %rdx,%r14
+  802320:	73 b6                	jae    8022d8 <munmap+0x4a>
+  802322:	49 39 c7             	cmp    %rax,%r15
+  802325:	76 b1                	jbe    8022d8 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802327:	4c 89 ef             	mov    %r13,%rdi
+  80232a:	48 b8 c5 13 80 00 00 	movabs $0x8013c5,%rax
+  802331:	00 00 00 
+  802334:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  802336:	48 85 c0             	test   %rax,%rax
+  802339:	0f 84 c5 00 00 00    	je     802404 <munmap+0x176>
+            *tail = *m;
+  80233f:	48 8b 13             	mov    (%rbx),%rdx
+  802342:	48 89 10             	mov    %rdx,(%rax)
+  802345:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802349:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80234d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802351:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  802355:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802358:	44 89 f2             	mov    %r14d,%edx
+  80235b:	2b 13                	sub    (%rbx),%edx
+  80235d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802360:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  802364:	eb 80                	jmp    8022e6 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  802366:	49 39 d6             	cmp    %rdx,%r14
+  802369:	73 18                	jae    802383 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80236b:	44 89 f2             	mov    %r14d,%edx
+  80236e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802373:	29 c2                	sub    %eax,%edx
+  802375:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80237a:	4d 89 34 24          	mov    %r14,(%r12)
+  80237e:	e9 63 ff ff ff       	jmp    8022e6 <munmap+0x58>
+    m->mm_start = 0;
+  802383:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80238a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80238b:	4c 89 e6             	mov    %r12,%rsi
+  80238e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802395:	00 00 00 
+  802398:	48 29 c6             	sub    %rax,%rsi
+  80239b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80239f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023a6:	aa aa aa 
+  8023a9:	48 0f af f0          	imul   %rax,%rsi
+  8023ad:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023b1:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023b6:	48 01 c6             	add    %rax,%rsi
+  8023b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023c3:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  8023ca:	00 00 00 
+  8023cd:	ff d0                	call   *%rax
+}
+  8023cf:	e9 12 ff ff ff       	jmp    8022e6 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023d4:	4c 89 f2             	mov    %r14,%rdx
+  8023d7:	4c 29 fa             	sub    %r15,%rdx
+  8023da:	4c 89 fe             	mov    %r15,%rsi
+  8023dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e2:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+}
+  8023ee:	48 83 c4 08          	add    $0x8,%rsp
+  8023f2:	5b                   	pop    %rbx
+  8023f3:	41 5c                	pop    %r12
+  8023f5:	41 5d                	pop    %r13
+  8023f7:	41 5e                	pop    %r14
+  8023f9:	41 5f                	pop    %r15
+  8023fb:	5d                   	pop    %rbp
+  8023fc:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8023fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802402:	eb ea                	jmp    8023ee <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802404:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802409:	eb e3                	jmp    8023ee <munmap+0x160>
+
+000000000080240b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80240b:	55                   	push   %rbp
+  80240c:	48 89 e5             	mov    %rsp,%rbp
+  80240f:	41 57                	push   %r15
+  802411:	41 56                	push   %r14
+  802413:	41 55                	push   %r13
+  802415:	41 54                	push   %r12
+  802417:	53                   	push   %rbx
+  802418:	48 83 ec 28          	sub    $0x28,%rsp
+  80241c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802420:	49 89 f5             	mov    %rsi,%r13
+  802423:	41 89 d6             	mov    %edx,%r14d
+  802426:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802429:	41 89 cc             	mov    %ecx,%r12d
+  80242c:	44 89 c7             	mov    %r8d,%edi
+  80242f:	44 89 cb             	mov    %r9d,%ebx
+  802432:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802436:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80243a:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  802441:	00 00 00 
+  802444:	ff d0                	call   *%rax
+  802446:	41 89 c7             	mov    %eax,%r15d
+  802449:	85 c0                	test   %eax,%eax
+  80244b:	0f 88 ae 01 00 00    	js     8025ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802451:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802455:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80245c:	00 00 00 
+  80245f:	8b 32                	mov    (%rdx),%esi
+  802461:	39 30                	cmp    %esi,(%rax)
+  802463:	0f 85 7a 02 00 00    	jne    8026e3 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802469:	8b 40 08             	mov    0x8(%rax),%eax
+  80246c:	83 e0 03             	and    $0x3,%eax
+  80246f:	83 f8 01             	cmp    $0x1,%eax
+  802472:	0f 84 76 02 00 00    	je     8026ee <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802478:	4d 85 ed             	test   %r13,%r13
+  80247b:	0f 84 78 02 00 00    	je     8026f9 <mmap+0x2ee>
+  802481:	85 db                	test   %ebx,%ebx
+  802483:	0f 88 70 02 00 00    	js     8026f9 <mmap+0x2ee>
+  802489:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80248f:	41 89 df             	mov    %ebx,%r15d
+  802492:	0f 85 6c 02 00 00    	jne    802704 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802498:	44 89 f0             	mov    %r14d,%eax
+  80249b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80249e:	83 f8 04             	cmp    $0x4,%eax
+  8024a1:	0f 85 68 02 00 00    	jne    80270f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024a7:	44 89 e1             	mov    %r12d,%ecx
+  8024aa:	83 e1 01             	and    $0x1,%ecx
+  8024ad:	0f 95 c2             	setne  %dl
+  8024b0:	44 89 e0             	mov    %r12d,%eax
+  8024b3:	d1 e8                	shr    %eax
+  8024b5:	83 f0 01             	xor    $0x1,%eax
+  8024b8:	83 e0 01             	and    $0x1,%eax
+  8024bb:	38 c2                	cmp    %al,%dl
+  8024bd:	0f 85 57 02 00 00    	jne    80271a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024c3:	85 c9                	test   %ecx,%ecx
+  8024c5:	74 0a                	je     8024d1 <mmap+0xc6>
+  8024c7:	41 f6 c6 02          	test   $0x2,%r14b
+  8024cb:	0f 85 54 02 00 00    	jne    802725 <mmap+0x31a>
+    file_flush_buffers();
+  8024d1:	48 b8 86 1f 80 00 00 	movabs $0x801f86,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024dd:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024e4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024eb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024ef:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8024f2:	41 f6 c4 04          	test   $0x4,%r12b
+  8024f6:	0f 84 15 01 00 00    	je     802611 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8024fc:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8024ff:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802505:	0f 85 25 02 00 00    	jne    802730 <mmap+0x325>
+  80250b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80250f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802516:	00 00 00 
+  802519:	48 39 c2             	cmp    %rax,%rdx
+  80251c:	0f 82 19 02 00 00    	jb     80273b <mmap+0x330>
+  802522:	48 39 c7             	cmp    %rax,%rdi
+  802525:	0f 87 10 02 00 00    	ja     80273b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80252b:	4c 89 ee             	mov    %r13,%rsi
+  80252e:	48 b8 8e 22 80 00 00 	movabs $0x80228e,%rax
+  802535:	00 00 00 
+  802538:	ff d0                	call   *%rax
+  80253a:	85 c0                	test   %eax,%eax
+  80253c:	0f 88 04 02 00 00    	js     802746 <mmap+0x33b>
+    if (!handler) {
+  802542:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802549:	00 00 00 
+  80254c:	80 38 00             	cmpb   $0x0,(%rax)
+  80254f:	75 2b                	jne    80257c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802551:	48 bf 26 13 80 00 00 	movabs $0x801326,%rdi
+  802558:	00 00 00 
+  80255b:	48 b8 83 42 80 00 00 	movabs $0x804283,%rax
+  802562:	00 00 00 
+  802565:	ff d0                	call   *%rax
+  802567:	85 c0                	test   %eax,%eax
+  802569:	0f 88 ea 01 00 00    	js     802759 <mmap+0x34e>
+        handler = 1;
+  80256f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802576:	00 00 00 
+  802579:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80257c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802580:	48 b8 c5 13 80 00 00 	movabs $0x8013c5,%rax
+  802587:	00 00 00 
+  80258a:	ff d0                	call   *%rax
+  80258c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80258f:	48 85 c0             	test   %rax,%rax
+  802592:	0f 84 c9 01 00 00    	je     802761 <mmap+0x356>
+    m->mm_start = va;
+  802598:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80259b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80259f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025a3:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025a6:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025aa:	44 89 e0             	mov    %r12d,%eax
+  8025ad:	c1 e0 06             	shl    $0x6,%eax
+  8025b0:	25 80 00 00 00       	and    $0x80,%eax
+  8025b5:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025b8:	09 f0                	or     %esi,%eax
+  8025ba:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025be:	41 f6 c4 08          	test   $0x8,%r12b
+  8025c2:	74 31                	je     8025f5 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025c4:	48 39 d3             	cmp    %rdx,%rbx
+  8025c7:	73 2c                	jae    8025f5 <mmap+0x1ea>
+  8025c9:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025ce:	48 89 de             	mov    %rbx,%rsi
+  8025d1:	4c 89 f7             	mov    %r14,%rdi
+  8025d4:	48 b8 15 12 80 00 00 	movabs $0x801215,%rax
+  8025db:	00 00 00 
+  8025de:	ff d0                	call   *%rax
+  8025e0:	49 89 c4             	mov    %rax,%r12
+  8025e3:	48 85 c0             	test   %rax,%rax
+  8025e6:	0f 8e d7 00 00 00    	jle    8026c3 <mmap+0x2b8>
+            va += n;
+  8025ec:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025ef:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8025f3:	72 d4                	jb     8025c9 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8025f5:	49 8b 06             	mov    (%r14),%rax
+  8025f8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8025fc:	48 89 06             	mov    %rax,(%rsi)
+}
+  8025ff:	44 89 f8             	mov    %r15d,%eax
+  802602:	48 83 c4 28          	add    $0x28,%rsp
+  802606:	5b                   	pop    %rbx
+  802607:	41 5c                	pop    %r12
+  802609:	41 5d                	pop    %r13
+  80260b:	41 5e                	pop    %r14
+  80260d:	41 5f                	pop    %r15
+  80260f:	5d                   	pop    %rbp
+  802610:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802611:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802618:	00 00 00 
+  80261b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80261e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802625:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802628:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80262d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802634:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802637:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80263e:	00 00 00 
+  802641:	48 39 d7             	cmp    %rdx,%rdi
+  802644:	73 1c                	jae    802662 <mmap+0x257>
+        return -E_NO_MEM;
+  802646:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80264c:	eb b1                	jmp    8025ff <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80264e:	48 83 c0 01          	add    $0x1,%rax
+  802652:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802656:	77 3f                	ja     802697 <mmap+0x28c>
+  802658:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80265d:	48 39 d7             	cmp    %rdx,%rdi
+  802660:	72 2a                	jb     80268c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802662:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  802666:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80266a:	48 39 d1             	cmp    %rdx,%rcx
+  80266d:	73 df                	jae    80264e <mmap+0x243>
+  80266f:	48 85 c9             	test   %rcx,%rcx
+  802672:	74 da                	je     80264e <mmap+0x243>
+  802674:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802678:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80267d:	48 39 d3             	cmp    %rdx,%rbx
+  802680:	73 cc                	jae    80264e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802682:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802685:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268a:	eb cc                	jmp    802658 <mmap+0x24d>
+        return -E_NO_MEM;
+  80268c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802692:	e9 68 ff ff ff       	jmp    8025ff <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  802697:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80269c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026a3:	00 00 00 
+  8026a6:	48 39 c2             	cmp    %rax,%rdx
+  8026a9:	0f 82 9f 00 00 00    	jb     80274e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026af:	48 85 db             	test   %rbx,%rbx
+  8026b2:	0f 85 8a fe ff ff    	jne    802542 <mmap+0x137>
+        return -E_NO_MEM;
+  8026b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026be:	e9 3c ff ff ff       	jmp    8025ff <mmap+0x1f4>
+        if (n < 0) {
+  8026c3:	0f 89 2c ff ff ff    	jns    8025f5 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026c9:	49 8b 3e             	mov    (%r14),%rdi
+  8026cc:	4c 89 ee             	mov    %r13,%rsi
+  8026cf:	48 b8 8e 22 80 00 00 	movabs $0x80228e,%rax
+  8026d6:	00 00 00 
+  8026d9:	ff d0                	call   *%rax
+            return n;
+  8026db:	45 89 e7             	mov    %r12d,%r15d
+  8026de:	e9 1c ff ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026e3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026e9:	e9 11 ff ff ff       	jmp    8025ff <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026ee:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026f4:	e9 06 ff ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8026f9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026ff:	e9 fb fe ff ff       	jmp    8025ff <mmap+0x1f4>
+  802704:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270a:	e9 f0 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80270f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802715:	e9 e5 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80271a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802720:	e9 da fe ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802725:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80272b:	e9 cf fe ff ff       	jmp    8025ff <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802730:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802736:	e9 c4 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+  80273b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802741:	e9 b9 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802746:	41 89 c7             	mov    %eax,%r15d
+  802749:	e9 b1 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+        return -E_NO_MEM;
+  80274e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802754:	e9 a6 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802759:	41 89 c7             	mov    %eax,%r15d
+  80275c:	e9 9e fe ff ff       	jmp    8025ff <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802761:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802767:	e9 93 fe ff ff       	jmp    8025ff <mmap+0x1f4>
+
+000000000080276c <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80276c:	55                   	push   %rbp
+  80276d:	48 89 e5             	mov    %rsp,%rbp
+  802770:	41 54                	push   %r12
+  802772:	53                   	push   %rbx
+  802773:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802776:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+  802782:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  802785:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  80278c:	00 00 00 
+  80278f:	48 89 df             	mov    %rbx,%rdi
+  802792:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  802799:	00 00 00 
+  80279c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80279e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027a3:	41 2b 04 24          	sub    (%r12),%eax
+  8027a7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027ad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027b4:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027b7:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027be:	00 00 00 
+  8027c1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027cd:	5b                   	pop    %rbx
+  8027ce:	41 5c                	pop    %r12
+  8027d0:	5d                   	pop    %rbp
+  8027d1:	c3                   	ret
+
+00000000008027d2 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027d2:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027d5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027db:	8b 17                	mov    (%rdi),%edx
+  8027dd:	85 d2                	test   %edx,%edx
+  8027df:	75 01                	jne    8027e2 <pipe_wakeup+0x10>
+  8027e1:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027e2:	55                   	push   %rbp
+  8027e3:	48 89 e5             	mov    %rsp,%rbp
+  8027e6:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027e9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027ef:	be 00 04 00 00       	mov    $0x400,%esi
+  8027f4:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+}
+  802800:	5d                   	pop    %rbp
+  802801:	c3                   	ret
+
+0000000000802802 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	41 55                	push   %r13
+  802808:	41 54                	push   %r12
+  80280a:	53                   	push   %rbx
+  80280b:	48 83 ec 08          	sub    $0x8,%rsp
+  80280f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802812:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802819:	00 00 00 
+  80281c:	ff d0                	call   *%rax
+  80281e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802821:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802826:	4c 89 e6             	mov    %r12,%rsi
+  802829:	bf 00 00 00 00       	mov    $0x0,%edi
+  80282e:	49 bc e5 02 80 00 00 	movabs $0x8002e5,%r12
+  802835:	00 00 00 
+  802838:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80283b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80283f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802843:	49 bd d2 27 80 00 00 	movabs $0x8027d2,%r13
+  80284a:	00 00 00 
+  80284d:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802850:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802854:	48 89 de             	mov    %rbx,%rsi
+  802857:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80285a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80285f:	48 89 de             	mov    %rbx,%rsi
+  802862:	bf 00 00 00 00       	mov    $0x0,%edi
+  802867:	41 ff d4             	call   *%r12
+  80286a:	48 83 c4 08          	add    $0x8,%rsp
+  80286e:	5b                   	pop    %rbx
+  80286f:	41 5c                	pop    %r12
+  802871:	41 5d                	pop    %r13
+  802873:	5d                   	pop    %rbp
+  802874:	c3                   	ret
+
+0000000000802875 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802875:	55                   	push   %rbp
+  802876:	48 89 e5             	mov    %rsp,%rbp
+  802879:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80287c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802881:	be 00 10 00 00       	mov    $0x1000,%esi
+  802886:	48 b8 28 02 80 00 00 	movabs $0x800228,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+  802892:	85 c0                	test   %eax,%eax
+  802894:	0f 94 c0             	sete   %al
+  802897:	0f b6 c0             	movzbl %al,%eax
+}
+  80289a:	5d                   	pop    %rbp
+  80289b:	c3                   	ret
+
+000000000080289c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80289c:	55                   	push   %rbp
+  80289d:	48 89 e5             	mov    %rsp,%rbp
+  8028a0:	41 57                	push   %r15
+  8028a2:	41 56                	push   %r14
+  8028a4:	41 55                	push   %r13
+  8028a6:	41 54                	push   %r12
+  8028a8:	53                   	push   %rbx
+  8028a9:	48 83 ec 38          	sub    $0x38,%rsp
+  8028ad:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028b1:	49 89 f4             	mov    %rsi,%r12
+  8028b4:	49 89 d7             	mov    %rdx,%r15
+  8028b7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028bb:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+  8028c7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028ca:	4d 85 ff             	test   %r15,%r15
+  8028cd:	0f 84 f1 00 00 00    	je     8029c4 <devpipe_write+0x128>
+  8028d3:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028d7:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028db:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028df:	49 bd 75 28 80 00 00 	movabs $0x802875,%r13
+  8028e6:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028e9:	49 bf d2 27 80 00 00 	movabs $0x8027d2,%r15
+  8028f0:	00 00 00 
+  8028f3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8028f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028fb:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8028ff:	8b 73 04             	mov    0x4(%rbx),%esi
+  802902:	48 63 ce             	movslq %esi,%rcx
+  802905:	48 63 03             	movslq (%rbx),%rax
+  802908:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80290e:	48 39 c1             	cmp    %rax,%rcx
+  802911:	72 64                	jb     802977 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802913:	48 89 de             	mov    %rbx,%rsi
+  802916:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80291a:	41 ff d5             	call   *%r13
+  80291d:	85 c0                	test   %eax,%eax
+  80291f:	0f 85 b9 00 00 00    	jne    8029de <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802925:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802929:	4c 89 f7             	mov    %r14,%rdi
+  80292c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80292f:	8b 43 04             	mov    0x4(%rbx),%eax
+  802932:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802939:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802940:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802946:	8b 03                	mov    (%rbx),%eax
+  802948:	41 39 c4             	cmp    %eax,%r12d
+  80294b:	75 b2                	jne    8028ff <devpipe_write+0x63>
+  80294d:	48 89 de             	mov    %rbx,%rsi
+  802950:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802954:	41 ff d5             	call   *%r13
+  802957:	85 c0                	test   %eax,%eax
+  802959:	75 a0                	jne    8028fb <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80295b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802960:	44 89 e6             	mov    %r12d,%esi
+  802963:	48 89 df             	mov    %rbx,%rdi
+  802966:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  80296d:	00 00 00 
+  802970:	ff d0                	call   *%rax
+  802972:	e9 7c ff ff ff       	jmp    8028f3 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802977:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80297b:	41 0f b6 38          	movzbl (%r8),%edi
+  80297f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802986:	80 80 80 
+  802989:	48 89 c8             	mov    %rcx,%rax
+  80298c:	48 f7 e2             	mul    %rdx
+  80298f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802993:	48 89 d0             	mov    %rdx,%rax
+  802996:	48 c1 e0 08          	shl    $0x8,%rax
+  80299a:	48 29 d0             	sub    %rdx,%rax
+  80299d:	48 c1 e0 04          	shl    $0x4,%rax
+  8029a1:	48 29 c1             	sub    %rax,%rcx
+  8029a4:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029a9:	83 c6 01             	add    $0x1,%esi
+  8029ac:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029af:	49 83 c0 01          	add    $0x1,%r8
+  8029b3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029b7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029bb:	49 39 c0             	cmp    %rax,%r8
+  8029be:	0f 85 2f ff ff ff    	jne    8028f3 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029c4:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029c8:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029cc:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  8029d3:	00 00 00 
+  8029d6:	ff d0                	call   *%rax
+    return n;
+  8029d8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029dc:	eb 05                	jmp    8029e3 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e3:	48 83 c4 38          	add    $0x38,%rsp
+  8029e7:	5b                   	pop    %rbx
+  8029e8:	41 5c                	pop    %r12
+  8029ea:	41 5d                	pop    %r13
+  8029ec:	41 5e                	pop    %r14
+  8029ee:	41 5f                	pop    %r15
+  8029f0:	5d                   	pop    %rbp
+  8029f1:	c3                   	ret
+
+00000000008029f2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029f2:	55                   	push   %rbp
+  8029f3:	48 89 e5             	mov    %rsp,%rbp
+  8029f6:	41 57                	push   %r15
+  8029f8:	41 56                	push   %r14
+  8029fa:	41 55                	push   %r13
+  8029fc:	41 54                	push   %r12
+  8029fe:	53                   	push   %rbx
+  8029ff:	48 83 ec 28          	sub    $0x28,%rsp
+  802a03:	49 89 fd             	mov    %rdi,%r13
+  802a06:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a0a:	49 89 d4             	mov    %rdx,%r12
+  802a0d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a11:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802a18:	00 00 00 
+  802a1b:	ff d0                	call   *%rax
+  802a1d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a20:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a26:	49 bf 75 28 80 00 00 	movabs $0x802875,%r15
+  802a2d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a30:	4d 85 e4             	test   %r12,%r12
+  802a33:	0f 84 d5 00 00 00    	je     802b0e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a39:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a41:	8b 03                	mov    (%rbx),%eax
+  802a43:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a46:	75 7a                	jne    802ac2 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a48:	4d 85 f6             	test   %r14,%r14
+  802a4b:	75 50                	jne    802a9d <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a4d:	48 89 de             	mov    %rbx,%rsi
+  802a50:	4c 89 ef             	mov    %r13,%rdi
+  802a53:	41 ff d7             	call   *%r15
+  802a56:	85 c0                	test   %eax,%eax
+  802a58:	0f 85 c9 00 00 00    	jne    802b27 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a5e:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a61:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a68:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a6e:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a71:	41 39 c4             	cmp    %eax,%r12d
+  802a74:	75 cb                	jne    802a41 <devpipe_read+0x4f>
+  802a76:	48 89 de             	mov    %rbx,%rsi
+  802a79:	4c 89 ef             	mov    %r13,%rdi
+  802a7c:	41 ff d7             	call   *%r15
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	75 be                	jne    802a41 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a83:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a88:	44 89 e6             	mov    %r12d,%esi
+  802a8b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a8f:	48 b8 ad 05 80 00 00 	movabs $0x8005ad,%rax
+  802a96:	00 00 00 
+  802a99:	ff d0                	call   *%rax
+  802a9b:	eb a4                	jmp    802a41 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802a9d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802aa1:	48 89 de             	mov    %rbx,%rsi
+  802aa4:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  802aab:	00 00 00 
+  802aae:	ff d0                	call   *%rax
+                return i;
+  802ab0:	4c 89 f0             	mov    %r14,%rax
+}
+  802ab3:	48 83 c4 28          	add    $0x28,%rsp
+  802ab7:	5b                   	pop    %rbx
+  802ab8:	41 5c                	pop    %r12
+  802aba:	41 5d                	pop    %r13
+  802abc:	41 5e                	pop    %r14
+  802abe:	41 5f                	pop    %r15
+  802ac0:	5d                   	pop    %rbp
+  802ac1:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ac2:	48 63 c8             	movslq %eax,%rcx
+  802ac5:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802acc:	80 80 80 
+  802acf:	48 89 c8             	mov    %rcx,%rax
+  802ad2:	48 f7 e2             	mul    %rdx
+  802ad5:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802ad9:	48 89 d0             	mov    %rdx,%rax
+  802adc:	48 c1 e0 08          	shl    $0x8,%rax
+  802ae0:	48 29 d0             	sub    %rdx,%rax
+  802ae3:	48 c1 e0 04          	shl    $0x4,%rax
+  802ae7:	48 89 c2             	mov    %rax,%rdx
+  802aea:	48 89 c8             	mov    %rcx,%rax
+  802aed:	48 29 d0             	sub    %rdx,%rax
+  802af0:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802af5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802af9:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802afd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b00:	49 83 c6 01          	add    $0x1,%r14
+  802b04:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b08:	0f 85 2b ff ff ff    	jne    802a39 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b0e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b12:	48 89 de             	mov    %rbx,%rsi
+  802b15:	48 b8 d2 27 80 00 00 	movabs $0x8027d2,%rax
+  802b1c:	00 00 00 
+  802b1f:	ff d0                	call   *%rax
+    return n;
+  802b21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b25:	eb 8c                	jmp    802ab3 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b27:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b2c:	eb 85                	jmp    802ab3 <devpipe_read+0xc1>
+
+0000000000802b2e <pipe>:
+pipe(int pfd[2]) {
+  802b2e:	55                   	push   %rbp
+  802b2f:	48 89 e5             	mov    %rsp,%rbp
+  802b32:	41 55                	push   %r13
+  802b34:	41 54                	push   %r12
+  802b36:	53                   	push   %rbx
+  802b37:	48 83 ec 18          	sub    $0x18,%rsp
+  802b3b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b3e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b42:	48 b8 a0 06 80 00 00 	movabs $0x8006a0,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	89 c3                	mov    %eax,%ebx
+  802b50:	85 c0                	test   %eax,%eax
+  802b52:	0f 88 a0 01 00 00    	js     802cf8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b58:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b62:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b66:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b6b:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  802b72:	00 00 00 
+  802b75:	ff d0                	call   *%rax
+  802b77:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b79:	85 c0                	test   %eax,%eax
+  802b7b:	0f 88 77 01 00 00    	js     802cf8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b81:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b85:	48 b8 a0 06 80 00 00 	movabs $0x8006a0,%rax
+  802b8c:	00 00 00 
+  802b8f:	ff d0                	call   *%rax
+  802b91:	89 c3                	mov    %eax,%ebx
+  802b93:	85 c0                	test   %eax,%eax
+  802b95:	0f 88 43 01 00 00    	js     802cde <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802b9b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ba0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ba5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ba9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bae:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  802bb5:	00 00 00 
+  802bb8:	ff d0                	call   *%rax
+  802bba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bbc:	85 c0                	test   %eax,%eax
+  802bbe:	0f 88 1a 01 00 00    	js     802cde <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bc4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bc8:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802bcf:	00 00 00 
+  802bd2:	ff d0                	call   *%rax
+  802bd4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bd7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bdc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be1:	48 89 c6             	mov    %rax,%rsi
+  802be4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be9:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	89 c3                	mov    %eax,%ebx
+  802bf7:	85 c0                	test   %eax,%eax
+  802bf9:	0f 88 c5 00 00 00    	js     802cc4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802bff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c03:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802c0a:	00 00 00 
+  802c0d:	ff d0                	call   *%rax
+  802c0f:	48 89 c1             	mov    %rax,%rcx
+  802c12:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c18:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c23:	4c 89 ee             	mov    %r13,%rsi
+  802c26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c2b:	48 b8 95 02 80 00 00 	movabs $0x800295,%rax
+  802c32:	00 00 00 
+  802c35:	ff d0                	call   *%rax
+  802c37:	89 c3                	mov    %eax,%ebx
+  802c39:	85 c0                	test   %eax,%eax
+  802c3b:	78 6e                	js     802cab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c3d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c42:	4c 89 ef             	mov    %r13,%rdi
+  802c45:	48 b8 04 02 80 00 00 	movabs $0x800204,%rax
+  802c4c:	00 00 00 
+  802c4f:	ff d0                	call   *%rax
+  802c51:	83 f8 02             	cmp    $0x2,%eax
+  802c54:	0f 85 ab 00 00 00    	jne    802d05 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c5a:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c61:	00 00 
+  802c63:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c67:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c6d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c74:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c78:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c7e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c89:	48 bb 72 06 80 00 00 	movabs $0x800672,%rbx
+  802c90:	00 00 00 
+  802c93:	ff d3                	call   *%rbx
+  802c95:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802c99:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c9d:	ff d3                	call   *%rbx
+  802c9f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802ca4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca9:	eb 4d                	jmp    802cf8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cb0:	4c 89 ee             	mov    %r13,%rsi
+  802cb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb8:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  802cbf:	00 00 00 
+  802cc2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ccd:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd2:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  802cd9:	00 00 00 
+  802cdc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ce3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802ce7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cec:	48 b8 e5 02 80 00 00 	movabs $0x8002e5,%rax
+  802cf3:	00 00 00 
+  802cf6:	ff d0                	call   *%rax
+}
+  802cf8:	89 d8                	mov    %ebx,%eax
+  802cfa:	48 83 c4 18          	add    $0x18,%rsp
+  802cfe:	5b                   	pop    %rbx
+  802cff:	41 5c                	pop    %r12
+  802d01:	41 5d                	pop    %r13
+  802d03:	5d                   	pop    %rbp
+  802d04:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d05:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d0c:	00 00 00 
+  802d0f:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d16:	00 00 00 
+  802d19:	be 50 00 00 00       	mov    $0x50,%esi
+  802d1e:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d25:	00 00 00 
+  802d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d2d:	49 b8 5d 33 80 00 00 	movabs $0x80335d,%r8
+  802d34:	00 00 00 
+  802d37:	41 ff d0             	call   *%r8
+
+0000000000802d3a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d3a:	55                   	push   %rbp
+  802d3b:	48 89 e5             	mov    %rsp,%rbp
+  802d3e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d42:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d46:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  802d4d:	00 00 00 
+  802d50:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d52:	85 c0                	test   %eax,%eax
+  802d54:	78 23                	js     802d79 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d56:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d5a:	48 b8 84 06 80 00 00 	movabs $0x800684,%rax
+  802d61:	00 00 00 
+  802d64:	ff d0                	call   *%rax
+  802d66:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d69:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d6d:	48 b8 75 28 80 00 00 	movabs $0x802875,%rax
+  802d74:	00 00 00 
+  802d77:	ff d0                	call   *%rax
+}
+  802d79:	c9                   	leave
+  802d7a:	c3                   	ret
+
+0000000000802d7b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d7b:	48 89 f8             	mov    %rdi,%rax
+  802d7e:	48 c1 e8 27          	shr    $0x27,%rax
+  802d82:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d89:	01 00 00 
+  802d8c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d90:	f6 c2 01             	test   $0x1,%dl
+  802d93:	74 6d                	je     802e02 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d95:	48 89 f8             	mov    %rdi,%rax
+  802d98:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d9c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802da3:	01 00 00 
+  802da6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802daa:	f6 c2 01             	test   $0x1,%dl
+  802dad:	74 62                	je     802e11 <get_uvpt_entry+0x96>
+  802daf:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802db6:	01 00 00 
+  802db9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dbd:	f6 c2 80             	test   $0x80,%dl
+  802dc0:	75 4f                	jne    802e11 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dc2:	48 89 f8             	mov    %rdi,%rax
+  802dc5:	48 c1 e8 15          	shr    $0x15,%rax
+  802dc9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dd0:	01 00 00 
+  802dd3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dd7:	f6 c2 01             	test   $0x1,%dl
+  802dda:	74 44                	je     802e20 <get_uvpt_entry+0xa5>
+  802ddc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802de3:	01 00 00 
+  802de6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dea:	f6 c2 80             	test   $0x80,%dl
+  802ded:	75 31                	jne    802e20 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802def:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802df3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dfa:	01 00 00 
+  802dfd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e01:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e02:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e09:	01 00 00 
+  802e0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e10:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e11:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e18:	01 00 00 
+  802e1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e1f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e20:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e27:	01 00 00 
+  802e2a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e2e:	c3                   	ret
+
+0000000000802e2f <get_prot>:
+
+int
+get_prot(void *va) {
+  802e2f:	55                   	push   %rbp
+  802e30:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e33:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+  802e3f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e42:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e47:	89 c1                	mov    %eax,%ecx
+  802e49:	83 c9 04             	or     $0x4,%ecx
+  802e4c:	f6 c2 01             	test   $0x1,%dl
+  802e4f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e52:	89 c1                	mov    %eax,%ecx
+  802e54:	83 c9 02             	or     $0x2,%ecx
+  802e57:	f6 c2 02             	test   $0x2,%dl
+  802e5a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e5d:	89 c1                	mov    %eax,%ecx
+  802e5f:	83 c9 01             	or     $0x1,%ecx
+  802e62:	48 85 d2             	test   %rdx,%rdx
+  802e65:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e68:	89 c1                	mov    %eax,%ecx
+  802e6a:	83 c9 40             	or     $0x40,%ecx
+  802e6d:	f6 c6 04             	test   $0x4,%dh
+  802e70:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e73:	5d                   	pop    %rbp
+  802e74:	c3                   	ret
+
+0000000000802e75 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e75:	55                   	push   %rbp
+  802e76:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e79:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e85:	48 c1 e8 06          	shr    $0x6,%rax
+  802e89:	83 e0 01             	and    $0x1,%eax
+}
+  802e8c:	5d                   	pop    %rbp
+  802e8d:	c3                   	ret
+
+0000000000802e8e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e8e:	55                   	push   %rbp
+  802e8f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802e92:	48 b8 7b 2d 80 00 00 	movabs $0x802d7b,%rax
+  802e99:	00 00 00 
+  802e9c:	ff d0                	call   *%rax
+  802e9e:	83 e0 01             	and    $0x1,%eax
+}
+  802ea1:	5d                   	pop    %rbp
+  802ea2:	c3                   	ret
+
+0000000000802ea3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802ea3:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802eaa:	01 00 00 
+  802ead:	a8 01                	test   $0x1,%al
+  802eaf:	75 06                	jne    802eb7 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802eb1:	b8 00 00 00 00       	mov    $0x0,%eax
+  802eb6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802eb7:	55                   	push   %rbp
+  802eb8:	48 89 e5             	mov    %rsp,%rbp
+  802ebb:	41 57                	push   %r15
+  802ebd:	41 56                	push   %r14
+  802ebf:	41 55                	push   %r13
+  802ec1:	41 54                	push   %r12
+  802ec3:	53                   	push   %rbx
+  802ec4:	48 83 ec 28          	sub    $0x28,%rsp
+  802ec8:	49 89 fe             	mov    %rdi,%r14
+  802ecb:	49 89 f7             	mov    %rsi,%r15
+  802ece:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ed5:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ed6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802edd:	01 00 00 
+  802ee0:	e9 ae 00 00 00       	jmp    802f93 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802ee5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802eec:	49 83 ec 01          	sub    $0x1,%r12
+  802ef0:	74 2d                	je     802f1f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ef2:	48 89 d8             	mov    %rbx,%rax
+  802ef5:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef9:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802efe:	f6 c2 01             	test   $0x1,%dl
+  802f01:	74 e2                	je     802ee5 <foreach_shared_region+0x42>
+  802f03:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f08:	f6 c4 04             	test   $0x4,%ah
+  802f0b:	74 d8                	je     802ee5 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f0d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f14:	4c 89 fa             	mov    %r15,%rdx
+  802f17:	48 89 df             	mov    %rbx,%rdi
+  802f1a:	41 ff d6             	call   *%r14
+  802f1d:	eb c6                	jmp    802ee5 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f1f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f26:	00 
+  802f27:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f2c:	74 4a                	je     802f78 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f32:	48 c1 e8 15          	shr    $0x15,%rax
+  802f36:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f3d:	01 00 00 
+  802f40:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f44:	a8 01                	test   $0x1,%al
+  802f46:	74 d7                	je     802f1f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f48:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f4c:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f53:	48 39 c3             	cmp    %rax,%rbx
+  802f56:	73 c7                	jae    802f1f <foreach_shared_region+0x7c>
+  802f58:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f5f:	48 39 d0             	cmp    %rdx,%rax
+  802f62:	4d 19 e4             	sbb    %r12,%r12
+  802f65:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f6c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f73:	e9 7a ff ff ff       	jmp    802ef2 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f78:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f7f:	40 
+  802f80:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f84:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f8b:	00 00 00 
+  802f8e:	48 39 c1             	cmp    %rax,%rcx
+  802f91:	74 50                	je     802fe3 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802f93:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f97:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f9b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fa2:	01 00 00 
+  802fa5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fa9:	a8 01                	test   $0x1,%al
+  802fab:	74 cb                	je     802f78 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fad:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fb1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fb8:	48 39 c1             	cmp    %rax,%rcx
+  802fbb:	73 bb                	jae    802f78 <foreach_shared_region+0xd5>
+  802fbd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fc4:	48 39 d0             	cmp    %rdx,%rax
+  802fc7:	48 19 c0             	sbb    %rax,%rax
+  802fca:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fd0:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fd6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fda:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fde:	e9 4b ff ff ff       	jmp    802f2e <foreach_shared_region+0x8b>
+  802fe3:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fe8:	48 83 c4 28          	add    $0x28,%rsp
+  802fec:	5b                   	pop    %rbx
+  802fed:	41 5c                	pop    %r12
+  802fef:	41 5d                	pop    %r13
+  802ff1:	41 5e                	pop    %r14
+  802ff3:	41 5f                	pop    %r15
+  802ff5:	5d                   	pop    %rbp
+  802ff6:	c3                   	ret
+
+0000000000802ff7 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  802ff7:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  802ffd:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803004:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80300b:	c3                   	ret
+
+000000000080300c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80300c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80300f:	8b 17                	mov    (%rdi),%edx
+  803011:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803013:	83 f8 0f             	cmp    $0xf,%eax
+  803016:	77 13                	ja     80302b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803018:	8b 47 40             	mov    0x40(%rdi),%eax
+  80301b:	83 e0 0f             	and    $0xf,%eax
+  80301e:	48 c1 e0 09          	shl    $0x9,%rax
+  803022:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803029:	00 
+  80302a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80302b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803030:	c3                   	ret
+
+0000000000803031 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803031:	8b 47 40             	mov    0x40(%rdi),%eax
+  803034:	83 c0 01             	add    $0x1,%eax
+  803037:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80303a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803040:	8b 57 04             	mov    0x4(%rdi),%edx
+  803043:	b8 00 00 00 00       	mov    $0x0,%eax
+  803048:	85 d2                	test   %edx,%edx
+  80304a:	75 04                	jne    803050 <chan_publish+0x1f>
+  80304c:	83 e0 01             	and    $0x1,%eax
+}
+  80304f:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803050:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803053:	85 c0                	test   %eax,%eax
+  803055:	0f 95 c0             	setne  %al
+  803058:	0f b6 c0             	movzbl %al,%eax
+  80305b:	eb ef                	jmp    80304c <chan_publish+0x1b>
+
+000000000080305d <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80305d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803060:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803062:	29 d0                	sub    %edx,%eax
+  803064:	83 e8 01             	sub    $0x1,%eax
+  803067:	83 f8 0f             	cmp    $0xf,%eax
+  80306a:	77 12                	ja     80307e <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80306c:	8b 07                	mov    (%rdi),%eax
+  80306e:	83 e0 0f             	and    $0xf,%eax
+  803071:	48 c1 e0 09          	shl    $0x9,%rax
+  803075:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80307c:	00 
+  80307d:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80307e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803083:	c3                   	ret
+
+0000000000803084 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803084:	8b 07                	mov    (%rdi),%eax
+  803086:	83 c0 01             	add    $0x1,%eax
+  803089:	89 07                	mov    %eax,(%rdi)
+}
+  80308b:	c3                   	ret
+
+000000000080308c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80308c:	55                   	push   %rbp
+  80308d:	48 89 e5             	mov    %rsp,%rbp
+  803090:	53                   	push   %rbx
+  803091:	48 83 ec 08          	sub    $0x8,%rsp
+  803095:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803098:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80309f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030a5:	48 b8 5d 30 80 00 00 	movabs $0x80305d,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+  8030b1:	48 85 c0             	test   %rax,%rax
+  8030b4:	74 12                	je     8030c8 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030b6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c6:	c9                   	leave
+  8030c7:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030cd:	eb f3                	jmp    8030c2 <chan_arm+0x36>
+
+00000000008030cf <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030cf:	55                   	push   %rbp
+  8030d0:	48 89 e5             	mov    %rsp,%rbp
+  8030d3:	41 56                	push   %r14
+  8030d5:	41 55                	push   %r13
+  8030d7:	41 54                	push   %r12
+  8030d9:	53                   	push   %rbx
+  8030da:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030dd:	49 bc 8c 30 80 00 00 	movabs $0x80308c,%r12
+  8030e4:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030e7:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030eb:	49 bd ad 05 80 00 00 	movabs $0x8005ad,%r13
+  8030f2:	00 00 00 
+    while (chan_arm(r))
+  8030f5:	eb 0d                	jmp    803104 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030f7:	8b 33                	mov    (%rbx),%esi
+  8030f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030fe:	4c 89 f7             	mov    %r14,%rdi
+  803101:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803104:	48 89 df             	mov    %rbx,%rdi
+  803107:	41 ff d4             	call   *%r12
+  80310a:	84 c0                	test   %al,%al
+  80310c:	75 e9                	jne    8030f7 <chan_wait+0x28>
+}
+  80310e:	5b                   	pop    %rbx
+  80310f:	41 5c                	pop    %r12
+  803111:	41 5d                	pop    %r13
+  803113:	41 5e                	pop    %r14
+  803115:	5d                   	pop    %rbp
+  803116:	c3                   	ret
+
+0000000000803117 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803117:	55                   	push   %rbp
+  803118:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80311b:	48 83 c7 40          	add    $0x40,%rdi
+  80311f:	be 01 00 00 00       	mov    $0x1,%esi
+  803124:	48 b8 cb 05 80 00 00 	movabs $0x8005cb,%rax
+  80312b:	00 00 00 
+  80312e:	ff d0                	call   *%rax
+}
+  803130:	5d                   	pop    %rbp
+  803131:	c3                   	ret
+
+0000000000803132 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803132:	b8 00 00 00 00       	mov    $0x0,%eax
+  803137:	c3                   	ret
+
+0000000000803138 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803138:	55                   	push   %rbp
+  803139:	48 89 e5             	mov    %rsp,%rbp
+  80313c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80313f:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  803146:	00 00 00 
+  803149:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  803150:	00 00 00 
+  803153:	ff d0                	call   *%rax
+    return 0;
+}
+  803155:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315a:	5d                   	pop    %rbp
+  80315b:	c3                   	ret
+
+000000000080315c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80315c:	55                   	push   %rbp
+  80315d:	48 89 e5             	mov    %rsp,%rbp
+  803160:	41 57                	push   %r15
+  803162:	41 56                	push   %r14
+  803164:	41 55                	push   %r13
+  803166:	41 54                	push   %r12
+  803168:	53                   	push   %rbx
+  803169:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803170:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803177:	48 85 d2             	test   %rdx,%rdx
+  80317a:	74 7a                	je     8031f6 <devcons_write+0x9a>
+  80317c:	49 89 d6             	mov    %rdx,%r14
+  80317f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803185:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80318a:	49 bf cc 3f 80 00 00 	movabs $0x803fcc,%r15
+  803191:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803194:	4c 89 f3             	mov    %r14,%rbx
+  803197:	48 29 f3             	sub    %rsi,%rbx
+  80319a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80319f:	48 39 c3             	cmp    %rax,%rbx
+  8031a2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031a6:	4c 63 eb             	movslq %ebx,%r13
+  8031a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031b0:	48 01 c6             	add    %rax,%rsi
+  8031b3:	4c 89 ea             	mov    %r13,%rdx
+  8031b6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031bd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031c0:	4c 89 ee             	mov    %r13,%rsi
+  8031c3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031ca:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  8031d1:	00 00 00 
+  8031d4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031d6:	41 01 dc             	add    %ebx,%r12d
+  8031d9:	49 63 f4             	movslq %r12d,%rsi
+  8031dc:	4c 39 f6             	cmp    %r14,%rsi
+  8031df:	72 b3                	jb     803194 <devcons_write+0x38>
+    return res;
+  8031e1:	49 63 c4             	movslq %r12d,%rax
+}
+  8031e4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031eb:	5b                   	pop    %rbx
+  8031ec:	41 5c                	pop    %r12
+  8031ee:	41 5d                	pop    %r13
+  8031f0:	41 5e                	pop    %r14
+  8031f2:	41 5f                	pop    %r15
+  8031f4:	5d                   	pop    %rbp
+  8031f5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8031f6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031fc:	eb e3                	jmp    8031e1 <devcons_write+0x85>
+
+00000000008031fe <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031fe:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803201:	ba 00 00 00 00       	mov    $0x0,%edx
+  803206:	48 85 c0             	test   %rax,%rax
+  803209:	74 55                	je     803260 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80320b:	55                   	push   %rbp
+  80320c:	48 89 e5             	mov    %rsp,%rbp
+  80320f:	41 55                	push   %r13
+  803211:	41 54                	push   %r12
+  803213:	53                   	push   %rbx
+  803214:	48 83 ec 08          	sub    $0x8,%rsp
+  803218:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80321b:	48 bb 26 01 80 00 00 	movabs $0x800126,%rbx
+  803222:	00 00 00 
+  803225:	49 bc db 01 80 00 00 	movabs $0x8001db,%r12
+  80322c:	00 00 00 
+  80322f:	eb 03                	jmp    803234 <devcons_read+0x36>
+  803231:	41 ff d4             	call   *%r12
+  803234:	ff d3                	call   *%rbx
+  803236:	85 c0                	test   %eax,%eax
+  803238:	74 f7                	je     803231 <devcons_read+0x33>
+    if (c < 0) return c;
+  80323a:	48 63 d0             	movslq %eax,%rdx
+  80323d:	78 13                	js     803252 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80323f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803244:	83 f8 04             	cmp    $0x4,%eax
+  803247:	74 09                	je     803252 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803249:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80324d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803252:	48 89 d0             	mov    %rdx,%rax
+  803255:	48 83 c4 08          	add    $0x8,%rsp
+  803259:	5b                   	pop    %rbx
+  80325a:	41 5c                	pop    %r12
+  80325c:	41 5d                	pop    %r13
+  80325e:	5d                   	pop    %rbp
+  80325f:	c3                   	ret
+  803260:	48 89 d0             	mov    %rdx,%rax
+  803263:	c3                   	ret
+
+0000000000803264 <cputchar>:
+cputchar(int ch) {
+  803264:	55                   	push   %rbp
+  803265:	48 89 e5             	mov    %rsp,%rbp
+  803268:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80326c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803270:	be 01 00 00 00       	mov    $0x1,%esi
+  803275:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803279:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  803280:	00 00 00 
+  803283:	ff d0                	call   *%rax
+}
+  803285:	c9                   	leave
+  803286:	c3                   	ret
+
+0000000000803287 <getchar>:
+getchar(void) {
+  803287:	55                   	push   %rbp
+  803288:	48 89 e5             	mov    %rsp,%rbp
+  80328b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80328f:	ba 01 00 00 00       	mov    $0x1,%edx
+  803294:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  803298:	bf 00 00 00 00       	mov    $0x0,%edi
+  80329d:	48 b8 e3 09 80 00 00 	movabs $0x8009e3,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+  8032a9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032ab:	85 c0                	test   %eax,%eax
+  8032ad:	78 06                	js     8032b5 <getchar+0x2e>
+  8032af:	74 08                	je     8032b9 <getchar+0x32>
+  8032b1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032b5:	89 d0                	mov    %edx,%eax
+  8032b7:	c9                   	leave
+  8032b8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032b9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032be:	eb f5                	jmp    8032b5 <getchar+0x2e>
+
+00000000008032c0 <iscons>:
+iscons(int fdnum) {
+  8032c0:	55                   	push   %rbp
+  8032c1:	48 89 e5             	mov    %rsp,%rbp
+  8032c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032cc:	48 b8 00 07 80 00 00 	movabs $0x800700,%rax
+  8032d3:	00 00 00 
+  8032d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032d8:	85 c0                	test   %eax,%eax
+  8032da:	78 18                	js     8032f4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032e0:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032e7:	00 00 00 
+  8032ea:	8b 00                	mov    (%rax),%eax
+  8032ec:	39 02                	cmp    %eax,(%rdx)
+  8032ee:	0f 94 c0             	sete   %al
+  8032f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8032f4:	c9                   	leave
+  8032f5:	c3                   	ret
+
+00000000008032f6 <opencons>:
+opencons(void) {
+  8032f6:	55                   	push   %rbp
+  8032f7:	48 89 e5             	mov    %rsp,%rbp
+  8032fa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032fe:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803302:	48 b8 a0 06 80 00 00 	movabs $0x8006a0,%rax
+  803309:	00 00 00 
+  80330c:	ff d0                	call   *%rax
+  80330e:	85 c0                	test   %eax,%eax
+  803310:	78 49                	js     80335b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803312:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803317:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80331c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803320:	bf 00 00 00 00       	mov    $0x0,%edi
+  803325:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  80332c:	00 00 00 
+  80332f:	ff d0                	call   *%rax
+  803331:	85 c0                	test   %eax,%eax
+  803333:	78 26                	js     80335b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803335:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803339:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803340:	00 00 
+  803342:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803344:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803348:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80334f:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+}
+  80335b:	c9                   	leave
+  80335c:	c3                   	ret
+
+000000000080335d <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80335d:	55                   	push   %rbp
+  80335e:	48 89 e5             	mov    %rsp,%rbp
+  803361:	41 56                	push   %r14
+  803363:	41 55                	push   %r13
+  803365:	41 54                	push   %r12
+  803367:	53                   	push   %rbx
+  803368:	48 83 ec 50          	sub    $0x50,%rsp
+  80336c:	49 89 fc             	mov    %rdi,%r12
+  80336f:	41 89 f5             	mov    %esi,%r13d
+  803372:	48 89 d3             	mov    %rdx,%rbx
+  803375:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803379:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80337d:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803381:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  803388:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80338c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803390:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803394:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  803398:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  80339f:	00 00 00 
+  8033a2:	4c 8b 30             	mov    (%rax),%r14
+  8033a5:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  8033ac:	00 00 00 
+  8033af:	ff d0                	call   *%rax
+  8033b1:	89 c6                	mov    %eax,%esi
+  8033b3:	45 89 e8             	mov    %r13d,%r8d
+  8033b6:	4c 89 e1             	mov    %r12,%rcx
+  8033b9:	4c 89 f2             	mov    %r14,%rdx
+  8033bc:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033c3:	00 00 00 
+  8033c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033cb:	49 bc ad 34 80 00 00 	movabs $0x8034ad,%r12
+  8033d2:	00 00 00 
+  8033d5:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033d8:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033dc:	48 89 df             	mov    %rbx,%rdi
+  8033df:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  8033e6:	00 00 00 
+  8033e9:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033eb:	48 bf 2b 47 80 00 00 	movabs $0x80472b,%rdi
+  8033f2:	00 00 00 
+  8033f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033fa:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8033fd:	cc                   	int3
+  8033fe:	eb fd                	jmp    8033fd <_panic+0xa0>
+
+0000000000803400 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803400:	55                   	push   %rbp
+  803401:	48 89 e5             	mov    %rsp,%rbp
+  803404:	53                   	push   %rbx
+  803405:	48 83 ec 08          	sub    $0x8,%rsp
+  803409:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80340c:	8b 06                	mov    (%rsi),%eax
+  80340e:	8d 50 01             	lea    0x1(%rax),%edx
+  803411:	89 16                	mov    %edx,(%rsi)
+  803413:	48 98                	cltq
+  803415:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80341a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803420:	74 0a                	je     80342c <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803422:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803426:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80342a:	c9                   	leave
+  80342b:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80342c:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803430:	be ff 00 00 00       	mov    $0xff,%esi
+  803435:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  80343c:	00 00 00 
+  80343f:	ff d0                	call   *%rax
+        state->offset = 0;
+  803441:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803447:	eb d9                	jmp    803422 <putch+0x22>
+
+0000000000803449 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803449:	55                   	push   %rbp
+  80344a:	48 89 e5             	mov    %rsp,%rbp
+  80344d:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803454:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803457:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80345e:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803463:	b8 00 00 00 00       	mov    $0x0,%eax
+  803468:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80346b:	48 89 f1             	mov    %rsi,%rcx
+  80346e:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803475:	48 bf 00 34 80 00 00 	movabs $0x803400,%rdi
+  80347c:	00 00 00 
+  80347f:	48 b8 fd 35 80 00 00 	movabs $0x8035fd,%rax
+  803486:	00 00 00 
+  803489:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80348b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803492:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803499:	48 b8 07 01 80 00 00 	movabs $0x800107,%rax
+  8034a0:	00 00 00 
+  8034a3:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034a5:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034ab:	c9                   	leave
+  8034ac:	c3                   	ret
+
+00000000008034ad <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034ad:	55                   	push   %rbp
+  8034ae:	48 89 e5             	mov    %rsp,%rbp
+  8034b1:	48 83 ec 50          	sub    $0x50,%rsp
+  8034b5:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034b9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034bd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034c1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034c5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034c9:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034d0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034d8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034dc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034e0:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034e4:	48 b8 49 34 80 00 00 	movabs $0x803449,%rax
+  8034eb:	00 00 00 
+  8034ee:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8034f0:	c9                   	leave
+  8034f1:	c3                   	ret
+
+00000000008034f2 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8034f2:	55                   	push   %rbp
+  8034f3:	48 89 e5             	mov    %rsp,%rbp
+  8034f6:	41 57                	push   %r15
+  8034f8:	41 56                	push   %r14
+  8034fa:	41 55                	push   %r13
+  8034fc:	41 54                	push   %r12
+  8034fe:	53                   	push   %rbx
+  8034ff:	48 83 ec 18          	sub    $0x18,%rsp
+  803503:	49 89 fc             	mov    %rdi,%r12
+  803506:	49 89 f5             	mov    %rsi,%r13
+  803509:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80350d:	8b 45 10             	mov    0x10(%rbp),%eax
+  803510:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803513:	41 89 cf             	mov    %ecx,%r15d
+  803516:	4c 39 fa             	cmp    %r15,%rdx
+  803519:	73 5b                	jae    803576 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80351b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80351f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803523:	85 db                	test   %ebx,%ebx
+  803525:	7e 0e                	jle    803535 <print_num+0x43>
+            putch(padc, put_arg);
+  803527:	4c 89 ee             	mov    %r13,%rsi
+  80352a:	44 89 f7             	mov    %r14d,%edi
+  80352d:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803530:	83 eb 01             	sub    $0x1,%ebx
+  803533:	75 f2                	jne    803527 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803535:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803539:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  803540:	00 00 00 
+  803543:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  80354a:	00 00 00 
+  80354d:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803551:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803555:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355a:	49 f7 f7             	div    %r15
+  80355d:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803561:	4c 89 ee             	mov    %r13,%rsi
+  803564:	41 ff d4             	call   *%r12
+}
+  803567:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80356b:	5b                   	pop    %rbx
+  80356c:	41 5c                	pop    %r12
+  80356e:	41 5d                	pop    %r13
+  803570:	41 5e                	pop    %r14
+  803572:	41 5f                	pop    %r15
+  803574:	5d                   	pop    %rbp
+  803575:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803576:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80357a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357f:	49 f7 f7             	div    %r15
+  803582:	48 83 ec 08          	sub    $0x8,%rsp
+  803586:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80358a:	52                   	push   %rdx
+  80358b:	45 0f be c9          	movsbl %r9b,%r9d
+  80358f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803593:	48 89 c2             	mov    %rax,%rdx
+  803596:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  80359d:	00 00 00 
+  8035a0:	ff d0                	call   *%rax
+  8035a2:	48 83 c4 10          	add    $0x10,%rsp
+  8035a6:	eb 8d                	jmp    803535 <print_num+0x43>
+
+00000000008035a8 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035a8:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035ac:	48 8b 06             	mov    (%rsi),%rax
+  8035af:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035b3:	73 0a                	jae    8035bf <sprintputch+0x17>
+        *state->start++ = ch;
+  8035b5:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035b9:	48 89 16             	mov    %rdx,(%rsi)
+  8035bc:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035bf:	c3                   	ret
+
+00000000008035c0 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035c0:	55                   	push   %rbp
+  8035c1:	48 89 e5             	mov    %rsp,%rbp
+  8035c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8035c8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035cc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035d0:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035d4:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035db:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035df:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035e3:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035e7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035eb:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035ef:	48 b8 fd 35 80 00 00 	movabs $0x8035fd,%rax
+  8035f6:	00 00 00 
+  8035f9:	ff d0                	call   *%rax
+}
+  8035fb:	c9                   	leave
+  8035fc:	c3                   	ret
+
+00000000008035fd <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8035fd:	55                   	push   %rbp
+  8035fe:	48 89 e5             	mov    %rsp,%rbp
+  803601:	41 57                	push   %r15
+  803603:	41 56                	push   %r14
+  803605:	41 55                	push   %r13
+  803607:	41 54                	push   %r12
+  803609:	53                   	push   %rbx
+  80360a:	48 83 ec 38          	sub    $0x38,%rsp
+  80360e:	49 89 fe             	mov    %rdi,%r14
+  803611:	49 89 f5             	mov    %rsi,%r13
+  803614:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803617:	48 8b 01             	mov    (%rcx),%rax
+  80361a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80361e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803622:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803626:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80362a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80362e:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803632:	0f b6 3b             	movzbl (%rbx),%edi
+  803635:	40 80 ff 25          	cmp    $0x25,%dil
+  803639:	74 18                	je     803653 <vprintfmt+0x56>
+            if (!ch) return;
+  80363b:	40 84 ff             	test   %dil,%dil
+  80363e:	0f 84 b1 06 00 00    	je     803cf5 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803644:	40 0f b6 ff          	movzbl %dil,%edi
+  803648:	4c 89 ee             	mov    %r13,%rsi
+  80364b:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80364e:	4c 89 e3             	mov    %r12,%rbx
+  803651:	eb db                	jmp    80362e <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803653:	be 00 00 00 00       	mov    $0x0,%esi
+  803658:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80365c:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803661:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803667:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80366e:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803672:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803677:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80367c:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80367f:	83 e8 23             	sub    $0x23,%eax
+  803682:	3c 57                	cmp    $0x57,%al
+  803684:	0f 87 51 06 00 00    	ja     803cdb <vprintfmt+0x6de>
+  80368a:	0f b6 c0             	movzbl %al,%eax
+  80368d:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  803694:	00 00 00 
+  803697:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80369a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80369d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036a1:	eb cf                	jmp    803672 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036a3:	49 89 dc             	mov    %rbx,%r12
+  8036a6:	be 01 00 00 00       	mov    $0x1,%esi
+  8036ab:	eb c5                	jmp    803672 <vprintfmt+0x75>
+            padc = ch;
+  8036ad:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036b1:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036b4:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036b7:	eb b9                	jmp    803672 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8036bf:	77 24                	ja     8036e5 <vprintfmt+0xe8>
+  8036c1:	89 c1                	mov    %eax,%ecx
+  8036c3:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036c7:	83 c0 08             	add    $0x8,%eax
+  8036ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036cd:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036d0:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036d3:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036d7:	79 99                	jns    803672 <vprintfmt+0x75>
+                width = precision;
+  8036d9:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036dd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036e3:	eb 8d                	jmp    803672 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036e5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036e9:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036f1:	eb da                	jmp    8036cd <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8036f3:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8036f8:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8036fc:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803702:	3c 39                	cmp    $0x39,%al
+  803704:	77 1c                	ja     803722 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803706:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80370a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80370e:	0f b6 c0             	movzbl %al,%eax
+  803711:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803716:	0f b6 03             	movzbl (%rbx),%eax
+  803719:	3c 39                	cmp    $0x39,%al
+  80371b:	76 e9                	jbe    803706 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80371d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803720:	eb b1                	jmp    8036d3 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803722:	49 89 dc             	mov    %rbx,%r12
+  803725:	eb ac                	jmp    8036d3 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803727:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80372a:	85 c9                	test   %ecx,%ecx
+  80372c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803731:	0f 49 c1             	cmovns %ecx,%eax
+  803734:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803737:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80373a:	e9 33 ff ff ff       	jmp    803672 <vprintfmt+0x75>
+            lflag++;
+  80373f:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803742:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803745:	e9 28 ff ff ff       	jmp    803672 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80374a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80374d:	83 f8 2f             	cmp    $0x2f,%eax
+  803750:	77 19                	ja     80376b <vprintfmt+0x16e>
+  803752:	89 c2                	mov    %eax,%edx
+  803754:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803758:	83 c0 08             	add    $0x8,%eax
+  80375b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80375e:	8b 3a                	mov    (%rdx),%edi
+  803760:	4c 89 ee             	mov    %r13,%rsi
+  803763:	41 ff d6             	call   *%r14
+            break;
+  803766:	e9 c3 fe ff ff       	jmp    80362e <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80376b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80376f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803773:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803777:	eb e5                	jmp    80375e <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803779:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80377c:	83 f8 2f             	cmp    $0x2f,%eax
+  80377f:	77 5a                	ja     8037db <vprintfmt+0x1de>
+  803781:	89 c2                	mov    %eax,%edx
+  803783:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803787:	83 c0 08             	add    $0x8,%eax
+  80378a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80378d:	8b 02                	mov    (%rdx),%eax
+  80378f:	89 c1                	mov    %eax,%ecx
+  803791:	f7 d9                	neg    %ecx
+  803793:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  803796:	83 f9 16             	cmp    $0x16,%ecx
+  803799:	7f 4e                	jg     8037e9 <vprintfmt+0x1ec>
+  80379b:	48 63 c1             	movslq %ecx,%rax
+  80379e:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  8037a5:	00 00 00 
+  8037a8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037ac:	48 85 c0             	test   %rax,%rax
+  8037af:	74 38                	je     8037e9 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037b1:	48 89 c1             	mov    %rax,%rcx
+  8037b4:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037bb:	00 00 00 
+  8037be:	4c 89 ee             	mov    %r13,%rsi
+  8037c1:	4c 89 f7             	mov    %r14,%rdi
+  8037c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c9:	49 b8 c0 35 80 00 00 	movabs $0x8035c0,%r8
+  8037d0:	00 00 00 
+  8037d3:	41 ff d0             	call   *%r8
+  8037d6:	e9 53 fe ff ff       	jmp    80362e <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037db:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037df:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037e7:	eb a4                	jmp    80378d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037e9:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  8037f0:	00 00 00 
+  8037f3:	4c 89 ee             	mov    %r13,%rsi
+  8037f6:	4c 89 f7             	mov    %r14,%rdi
+  8037f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037fe:	49 b8 c0 35 80 00 00 	movabs $0x8035c0,%r8
+  803805:	00 00 00 
+  803808:	41 ff d0             	call   *%r8
+  80380b:	e9 1e fe ff ff       	jmp    80362e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803810:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803813:	83 f8 2f             	cmp    $0x2f,%eax
+  803816:	77 6c                	ja     803884 <vprintfmt+0x287>
+  803818:	89 c2                	mov    %eax,%edx
+  80381a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80381e:	83 c0 08             	add    $0x8,%eax
+  803821:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803824:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803827:	48 85 d2             	test   %rdx,%rdx
+  80382a:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  803831:	00 00 00 
+  803834:	48 0f 45 c2          	cmovne %rdx,%rax
+  803838:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80383c:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803840:	7e 06                	jle    803848 <vprintfmt+0x24b>
+  803842:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803846:	75 4a                	jne    803892 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803848:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80384c:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803850:	0f b6 00             	movzbl (%rax),%eax
+  803853:	84 c0                	test   %al,%al
+  803855:	0f 85 9a 00 00 00    	jne    8038f5 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80385b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80385e:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803862:	85 c0                	test   %eax,%eax
+  803864:	0f 8e c4 fd ff ff    	jle    80362e <vprintfmt+0x31>
+  80386a:	4c 89 ee             	mov    %r13,%rsi
+  80386d:	bf 20 00 00 00       	mov    $0x20,%edi
+  803872:	41 ff d6             	call   *%r14
+  803875:	41 83 ec 01          	sub    $0x1,%r12d
+  803879:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80387d:	75 eb                	jne    80386a <vprintfmt+0x26d>
+  80387f:	e9 aa fd ff ff       	jmp    80362e <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803884:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803888:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80388c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803890:	eb 92                	jmp    803824 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803892:	49 63 f7             	movslq %r15d,%rsi
+  803895:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803899:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  8038a0:	00 00 00 
+  8038a3:	ff d0                	call   *%rax
+  8038a5:	48 89 c2             	mov    %rax,%rdx
+  8038a8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038ab:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038ad:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038b0:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038b3:	85 c0                	test   %eax,%eax
+  8038b5:	7e 91                	jle    803848 <vprintfmt+0x24b>
+  8038b7:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038bc:	4c 89 ee             	mov    %r13,%rsi
+  8038bf:	44 89 e7             	mov    %r12d,%edi
+  8038c2:	41 ff d6             	call   *%r14
+  8038c5:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038c9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038cc:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038cf:	75 eb                	jne    8038bc <vprintfmt+0x2bf>
+  8038d1:	e9 72 ff ff ff       	jmp    803848 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038d6:	0f b6 f8             	movzbl %al,%edi
+  8038d9:	4c 89 ee             	mov    %r13,%rsi
+  8038dc:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038df:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038e3:	49 83 c4 01          	add    $0x1,%r12
+  8038e7:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038ed:	84 c0                	test   %al,%al
+  8038ef:	0f 84 66 ff ff ff    	je     80385b <vprintfmt+0x25e>
+  8038f5:	45 85 ff             	test   %r15d,%r15d
+  8038f8:	78 0a                	js     803904 <vprintfmt+0x307>
+  8038fa:	41 83 ef 01          	sub    $0x1,%r15d
+  8038fe:	0f 88 57 ff ff ff    	js     80385b <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803904:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803908:	74 cc                	je     8038d6 <vprintfmt+0x2d9>
+  80390a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80390d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803912:	80 fa 5e             	cmp    $0x5e,%dl
+  803915:	77 c2                	ja     8038d9 <vprintfmt+0x2dc>
+  803917:	eb bd                	jmp    8038d6 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803919:	40 84 f6             	test   %sil,%sil
+  80391c:	75 26                	jne    803944 <vprintfmt+0x347>
+    switch (lflag) {
+  80391e:	85 d2                	test   %edx,%edx
+  803920:	74 59                	je     80397b <vprintfmt+0x37e>
+  803922:	83 fa 01             	cmp    $0x1,%edx
+  803925:	74 7b                	je     8039a2 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803927:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80392a:	83 f8 2f             	cmp    $0x2f,%eax
+  80392d:	0f 87 96 00 00 00    	ja     8039c9 <vprintfmt+0x3cc>
+  803933:	89 c2                	mov    %eax,%edx
+  803935:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803939:	83 c0 08             	add    $0x8,%eax
+  80393c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80393f:	4c 8b 22             	mov    (%rdx),%r12
+  803942:	eb 17                	jmp    80395b <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803944:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803947:	83 f8 2f             	cmp    $0x2f,%eax
+  80394a:	77 21                	ja     80396d <vprintfmt+0x370>
+  80394c:	89 c2                	mov    %eax,%edx
+  80394e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803952:	83 c0 08             	add    $0x8,%eax
+  803955:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803958:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80395b:	4d 85 e4             	test   %r12,%r12
+  80395e:	78 7a                	js     8039da <vprintfmt+0x3dd>
+            num = i;
+  803960:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803963:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803968:	e9 50 02 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80396d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803971:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803975:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803979:	eb dd                	jmp    803958 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80397b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80397e:	83 f8 2f             	cmp    $0x2f,%eax
+  803981:	77 11                	ja     803994 <vprintfmt+0x397>
+  803983:	89 c2                	mov    %eax,%edx
+  803985:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803989:	83 c0 08             	add    $0x8,%eax
+  80398c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80398f:	4c 63 22             	movslq (%rdx),%r12
+  803992:	eb c7                	jmp    80395b <vprintfmt+0x35e>
+  803994:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803998:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80399c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039a0:	eb ed                	jmp    80398f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8039a8:	77 11                	ja     8039bb <vprintfmt+0x3be>
+  8039aa:	89 c2                	mov    %eax,%edx
+  8039ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039b0:	83 c0 08             	add    $0x8,%eax
+  8039b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039b6:	4c 8b 22             	mov    (%rdx),%r12
+  8039b9:	eb a0                	jmp    80395b <vprintfmt+0x35e>
+  8039bb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039bf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039c3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039c7:	eb ed                	jmp    8039b6 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039d5:	e9 65 ff ff ff       	jmp    80393f <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039da:	4c 89 ee             	mov    %r13,%rsi
+  8039dd:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039e2:	41 ff d6             	call   *%r14
+                i = -i;
+  8039e5:	49 f7 dc             	neg    %r12
+  8039e8:	e9 73 ff ff ff       	jmp    803960 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039ed:	40 84 f6             	test   %sil,%sil
+  8039f0:	75 32                	jne    803a24 <vprintfmt+0x427>
+    switch (lflag) {
+  8039f2:	85 d2                	test   %edx,%edx
+  8039f4:	74 5d                	je     803a53 <vprintfmt+0x456>
+  8039f6:	83 fa 01             	cmp    $0x1,%edx
+  8039f9:	0f 84 82 00 00 00    	je     803a81 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8039ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a02:	83 f8 2f             	cmp    $0x2f,%eax
+  803a05:	0f 87 a5 00 00 00    	ja     803ab0 <vprintfmt+0x4b3>
+  803a0b:	89 c2                	mov    %eax,%edx
+  803a0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a11:	83 c0 08             	add    $0x8,%eax
+  803a14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a17:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a1a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a1f:	e9 99 01 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a27:	83 f8 2f             	cmp    $0x2f,%eax
+  803a2a:	77 19                	ja     803a45 <vprintfmt+0x448>
+  803a2c:	89 c2                	mov    %eax,%edx
+  803a2e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a32:	83 c0 08             	add    $0x8,%eax
+  803a35:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a38:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a40:	e9 78 01 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+  803a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a51:	eb e5                	jmp    803a38 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a56:	83 f8 2f             	cmp    $0x2f,%eax
+  803a59:	77 18                	ja     803a73 <vprintfmt+0x476>
+  803a5b:	89 c2                	mov    %eax,%edx
+  803a5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a61:	83 c0 08             	add    $0x8,%eax
+  803a64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a67:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a69:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a6e:	e9 4a 01 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+  803a73:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a77:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a7f:	eb e6                	jmp    803a67 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a81:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a84:	83 f8 2f             	cmp    $0x2f,%eax
+  803a87:	77 19                	ja     803aa2 <vprintfmt+0x4a5>
+  803a89:	89 c2                	mov    %eax,%edx
+  803a8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a8f:	83 c0 08             	add    $0x8,%eax
+  803a92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a95:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a98:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803a9d:	e9 1b 01 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+  803aa2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aa6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aaa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aae:	eb e5                	jmp    803a95 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ab0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ab4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ab8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803abc:	e9 56 ff ff ff       	jmp    803a17 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ac1:	40 84 f6             	test   %sil,%sil
+  803ac4:	75 2e                	jne    803af4 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803ac6:	85 d2                	test   %edx,%edx
+  803ac8:	74 59                	je     803b23 <vprintfmt+0x526>
+  803aca:	83 fa 01             	cmp    $0x1,%edx
+  803acd:	74 7f                	je     803b4e <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803acf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ad2:	83 f8 2f             	cmp    $0x2f,%eax
+  803ad5:	0f 87 9f 00 00 00    	ja     803b7a <vprintfmt+0x57d>
+  803adb:	89 c2                	mov    %eax,%edx
+  803add:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ae1:	83 c0 08             	add    $0x8,%eax
+  803ae4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ae7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803aea:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803aef:	e9 c9 00 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803af4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803af7:	83 f8 2f             	cmp    $0x2f,%eax
+  803afa:	77 19                	ja     803b15 <vprintfmt+0x518>
+  803afc:	89 c2                	mov    %eax,%edx
+  803afe:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b02:	83 c0 08             	add    $0x8,%eax
+  803b05:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b08:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b10:	e9 a8 00 00 00       	jmp    803bbd <vprintfmt+0x5c0>
+  803b15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b21:	eb e5                	jmp    803b08 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b23:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b26:	83 f8 2f             	cmp    $0x2f,%eax
+  803b29:	77 15                	ja     803b40 <vprintfmt+0x543>
+  803b2b:	89 c2                	mov    %eax,%edx
+  803b2d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b31:	83 c0 08             	add    $0x8,%eax
+  803b34:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b37:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b39:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b3e:	eb 7d                	jmp    803bbd <vprintfmt+0x5c0>
+  803b40:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b44:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b4c:	eb e9                	jmp    803b37 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b4e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b51:	83 f8 2f             	cmp    $0x2f,%eax
+  803b54:	77 16                	ja     803b6c <vprintfmt+0x56f>
+  803b56:	89 c2                	mov    %eax,%edx
+  803b58:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b5c:	83 c0 08             	add    $0x8,%eax
+  803b5f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b62:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b65:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b6a:	eb 51                	jmp    803bbd <vprintfmt+0x5c0>
+  803b6c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b70:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b74:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b78:	eb e8                	jmp    803b62 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b86:	e9 5c ff ff ff       	jmp    803ae7 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b8b:	4c 89 ee             	mov    %r13,%rsi
+  803b8e:	bf 30 00 00 00       	mov    $0x30,%edi
+  803b93:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803b96:	4c 89 ee             	mov    %r13,%rsi
+  803b99:	bf 78 00 00 00       	mov    $0x78,%edi
+  803b9e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  803ba7:	77 47                	ja     803bf0 <vprintfmt+0x5f3>
+  803ba9:	89 c2                	mov    %eax,%edx
+  803bab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803baf:	83 c0 08             	add    $0x8,%eax
+  803bb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bb5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bb8:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bbd:	48 83 ec 08          	sub    $0x8,%rsp
+  803bc1:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bc5:	0f 94 c0             	sete   %al
+  803bc8:	0f b6 c0             	movzbl %al,%eax
+  803bcb:	50                   	push   %rax
+  803bcc:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bd1:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bd5:	4c 89 ee             	mov    %r13,%rsi
+  803bd8:	4c 89 f7             	mov    %r14,%rdi
+  803bdb:	48 b8 f2 34 80 00 00 	movabs $0x8034f2,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+            break;
+  803be7:	48 83 c4 10          	add    $0x10,%rsp
+  803beb:	e9 3e fa ff ff       	jmp    80362e <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803bf0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bf4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bf8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bfc:	eb b7                	jmp    803bb5 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803bfe:	40 84 f6             	test   %sil,%sil
+  803c01:	75 2b                	jne    803c2e <vprintfmt+0x631>
+    switch (lflag) {
+  803c03:	85 d2                	test   %edx,%edx
+  803c05:	74 56                	je     803c5d <vprintfmt+0x660>
+  803c07:	83 fa 01             	cmp    $0x1,%edx
+  803c0a:	74 7f                	je     803c8b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c0f:	83 f8 2f             	cmp    $0x2f,%eax
+  803c12:	0f 87 a2 00 00 00    	ja     803cba <vprintfmt+0x6bd>
+  803c18:	89 c2                	mov    %eax,%edx
+  803c1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c1e:	83 c0 08             	add    $0x8,%eax
+  803c21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c24:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c27:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c2c:	eb 8f                	jmp    803bbd <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c31:	83 f8 2f             	cmp    $0x2f,%eax
+  803c34:	77 19                	ja     803c4f <vprintfmt+0x652>
+  803c36:	89 c2                	mov    %eax,%edx
+  803c38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c3c:	83 c0 08             	add    $0x8,%eax
+  803c3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c42:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c45:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c4a:	e9 6e ff ff ff       	jmp    803bbd <vprintfmt+0x5c0>
+  803c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c5b:	eb e5                	jmp    803c42 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c60:	83 f8 2f             	cmp    $0x2f,%eax
+  803c63:	77 18                	ja     803c7d <vprintfmt+0x680>
+  803c65:	89 c2                	mov    %eax,%edx
+  803c67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c6b:	83 c0 08             	add    $0x8,%eax
+  803c6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c71:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c73:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c78:	e9 40 ff ff ff       	jmp    803bbd <vprintfmt+0x5c0>
+  803c7d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c81:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c85:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c89:	eb e6                	jmp    803c71 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c8b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c8e:	83 f8 2f             	cmp    $0x2f,%eax
+  803c91:	77 19                	ja     803cac <vprintfmt+0x6af>
+  803c93:	89 c2                	mov    %eax,%edx
+  803c95:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c99:	83 c0 08             	add    $0x8,%eax
+  803c9c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c9f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803ca2:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803ca7:	e9 11 ff ff ff       	jmp    803bbd <vprintfmt+0x5c0>
+  803cac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cb4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cb8:	eb e5                	jmp    803c9f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cbe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc6:	e9 59 ff ff ff       	jmp    803c24 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803ccb:	4c 89 ee             	mov    %r13,%rsi
+  803cce:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cd3:	41 ff d6             	call   *%r14
+            break;
+  803cd6:	e9 53 f9 ff ff       	jmp    80362e <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cdb:	4c 89 ee             	mov    %r13,%rsi
+  803cde:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ce3:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803ce6:	48 83 eb 01          	sub    $0x1,%rbx
+  803cea:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803cee:	75 f6                	jne    803ce6 <vprintfmt+0x6e9>
+  803cf0:	e9 39 f9 ff ff       	jmp    80362e <vprintfmt+0x31>
+}
+  803cf5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803cf9:	5b                   	pop    %rbx
+  803cfa:	41 5c                	pop    %r12
+  803cfc:	41 5d                	pop    %r13
+  803cfe:	41 5e                	pop    %r14
+  803d00:	41 5f                	pop    %r15
+  803d02:	5d                   	pop    %rbp
+  803d03:	c3                   	ret
+
+0000000000803d04 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d04:	55                   	push   %rbp
+  803d05:	48 89 e5             	mov    %rsp,%rbp
+  803d08:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d0c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d10:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d15:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d19:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d20:	48 85 ff             	test   %rdi,%rdi
+  803d23:	74 2b                	je     803d50 <vsnprintf+0x4c>
+  803d25:	48 85 f6             	test   %rsi,%rsi
+  803d28:	74 26                	je     803d50 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d2a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d2e:	48 bf a8 35 80 00 00 	movabs $0x8035a8,%rdi
+  803d35:	00 00 00 
+  803d38:	48 b8 fd 35 80 00 00 	movabs $0x8035fd,%rax
+  803d3f:	00 00 00 
+  803d42:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d44:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d48:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d4b:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d4e:	c9                   	leave
+  803d4f:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d50:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d55:	eb f7                	jmp    803d4e <vsnprintf+0x4a>
+
+0000000000803d57 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d57:	55                   	push   %rbp
+  803d58:	48 89 e5             	mov    %rsp,%rbp
+  803d5b:	48 83 ec 50          	sub    $0x50,%rsp
+  803d5f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d63:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d67:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d6b:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d72:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d7a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d7e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d82:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d86:	48 b8 04 3d 80 00 00 	movabs $0x803d04,%rax
+  803d8d:	00 00 00 
+  803d90:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803d92:	c9                   	leave
+  803d93:	c3                   	ret
+
+0000000000803d94 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803d94:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803d97:	74 10                	je     803da9 <strlen+0x15>
+    size_t n = 0;
+  803d99:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803d9e:	48 83 c0 01          	add    $0x1,%rax
+  803da2:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803da6:	75 f6                	jne    803d9e <strlen+0xa>
+  803da8:	c3                   	ret
+    size_t n = 0;
+  803da9:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dae:	c3                   	ret
+
+0000000000803daf <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803daf:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803db2:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803db7:	48 85 f6             	test   %rsi,%rsi
+  803dba:	74 11                	je     803dcd <strnlen+0x1e>
+  803dbc:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dc0:	74 0c                	je     803dce <strnlen+0x1f>
+  803dc2:	48 83 c2 01          	add    $0x1,%rdx
+  803dc6:	48 39 d0             	cmp    %rdx,%rax
+  803dc9:	75 f1                	jne    803dbc <strnlen+0xd>
+  803dcb:	eb 04                	jmp    803dd1 <strnlen+0x22>
+  803dcd:	c3                   	ret
+  803dce:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803dd1:	c3                   	ret
+
+0000000000803dd2 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dd2:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dd5:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dda:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dde:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803de1:	48 83 c2 01          	add    $0x1,%rdx
+  803de5:	84 c9                	test   %cl,%cl
+  803de7:	75 f1                	jne    803dda <strcpy+0x8>
+        ;
+    return res;
+}
+  803de9:	c3                   	ret
+
+0000000000803dea <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803dea:	55                   	push   %rbp
+  803deb:	48 89 e5             	mov    %rsp,%rbp
+  803dee:	41 54                	push   %r12
+  803df0:	53                   	push   %rbx
+  803df1:	48 89 fb             	mov    %rdi,%rbx
+  803df4:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803df7:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  803dfe:	00 00 00 
+  803e01:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e03:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e07:	4c 89 e6             	mov    %r12,%rsi
+  803e0a:	48 b8 d2 3d 80 00 00 	movabs $0x803dd2,%rax
+  803e11:	00 00 00 
+  803e14:	ff d0                	call   *%rax
+    return dst;
+}
+  803e16:	48 89 d8             	mov    %rbx,%rax
+  803e19:	5b                   	pop    %rbx
+  803e1a:	41 5c                	pop    %r12
+  803e1c:	5d                   	pop    %rbp
+  803e1d:	c3                   	ret
+
+0000000000803e1e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e1e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e21:	48 85 d2             	test   %rdx,%rdx
+  803e24:	74 1f                	je     803e45 <strncpy+0x27>
+  803e26:	48 01 fa             	add    %rdi,%rdx
+  803e29:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e2c:	48 83 c1 01          	add    $0x1,%rcx
+  803e30:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e34:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e38:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e3c:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e40:	48 39 ca             	cmp    %rcx,%rdx
+  803e43:	75 e7                	jne    803e2c <strncpy+0xe>
+    }
+    return ret;
+}
+  803e45:	c3                   	ret
+
+0000000000803e46 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e46:	48 89 f8             	mov    %rdi,%rax
+  803e49:	48 85 d2             	test   %rdx,%rdx
+  803e4c:	74 24                	je     803e72 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e4e:	48 83 ea 01          	sub    $0x1,%rdx
+  803e52:	74 1b                	je     803e6f <strlcpy+0x29>
+  803e54:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e58:	0f b6 16             	movzbl (%rsi),%edx
+  803e5b:	84 d2                	test   %dl,%dl
+  803e5d:	74 10                	je     803e6f <strlcpy+0x29>
+            *dst++ = *src++;
+  803e5f:	48 83 c6 01          	add    $0x1,%rsi
+  803e63:	48 83 c0 01          	add    $0x1,%rax
+  803e67:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e6a:	48 39 c8             	cmp    %rcx,%rax
+  803e6d:	75 e9                	jne    803e58 <strlcpy+0x12>
+        *dst = '\0';
+  803e6f:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e72:	48 29 f8             	sub    %rdi,%rax
+}
+  803e75:	c3                   	ret
+
+0000000000803e76 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e76:	0f b6 07             	movzbl (%rdi),%eax
+  803e79:	84 c0                	test   %al,%al
+  803e7b:	74 13                	je     803e90 <strcmp+0x1a>
+  803e7d:	38 06                	cmp    %al,(%rsi)
+  803e7f:	75 0f                	jne    803e90 <strcmp+0x1a>
+  803e81:	48 83 c7 01          	add    $0x1,%rdi
+  803e85:	48 83 c6 01          	add    $0x1,%rsi
+  803e89:	0f b6 07             	movzbl (%rdi),%eax
+  803e8c:	84 c0                	test   %al,%al
+  803e8e:	75 ed                	jne    803e7d <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803e90:	0f b6 c0             	movzbl %al,%eax
+  803e93:	0f b6 16             	movzbl (%rsi),%edx
+  803e96:	29 d0                	sub    %edx,%eax
+}
+  803e98:	c3                   	ret
+
+0000000000803e99 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803e99:	48 85 d2             	test   %rdx,%rdx
+  803e9c:	74 1f                	je     803ebd <strncmp+0x24>
+  803e9e:	0f b6 07             	movzbl (%rdi),%eax
+  803ea1:	84 c0                	test   %al,%al
+  803ea3:	74 1e                	je     803ec3 <strncmp+0x2a>
+  803ea5:	3a 06                	cmp    (%rsi),%al
+  803ea7:	75 1a                	jne    803ec3 <strncmp+0x2a>
+  803ea9:	48 83 c7 01          	add    $0x1,%rdi
+  803ead:	48 83 c6 01          	add    $0x1,%rsi
+  803eb1:	48 83 ea 01          	sub    $0x1,%rdx
+  803eb5:	75 e7                	jne    803e9e <strncmp+0x5>
+
+    if (!n) return 0;
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebc:	c3                   	ret
+  803ebd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec2:	c3                   	ret
+  803ec3:	48 85 d2             	test   %rdx,%rdx
+  803ec6:	74 09                	je     803ed1 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ec8:	0f b6 07             	movzbl (%rdi),%eax
+  803ecb:	0f b6 16             	movzbl (%rsi),%edx
+  803ece:	29 d0                	sub    %edx,%eax
+  803ed0:	c3                   	ret
+    if (!n) return 0;
+  803ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ed6:	c3                   	ret
+
+0000000000803ed7 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ed7:	0f b6 17             	movzbl (%rdi),%edx
+  803eda:	84 d2                	test   %dl,%dl
+  803edc:	74 18                	je     803ef6 <strchr+0x1f>
+        if (*str == c) {
+  803ede:	0f be d2             	movsbl %dl,%edx
+  803ee1:	39 f2                	cmp    %esi,%edx
+  803ee3:	74 17                	je     803efc <strchr+0x25>
+    for (; *str; str++) {
+  803ee5:	48 83 c7 01          	add    $0x1,%rdi
+  803ee9:	0f b6 17             	movzbl (%rdi),%edx
+  803eec:	84 d2                	test   %dl,%dl
+  803eee:	75 ee                	jne    803ede <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef5:	c3                   	ret
+  803ef6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efb:	c3                   	ret
+  803efc:	48 89 f8             	mov    %rdi,%rax
+}
+  803eff:	c3                   	ret
+
+0000000000803f00 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f00:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f03:	0f b6 17             	movzbl (%rdi),%edx
+  803f06:	84 d2                	test   %dl,%dl
+  803f08:	74 13                	je     803f1d <strfind+0x1d>
+  803f0a:	0f be d2             	movsbl %dl,%edx
+  803f0d:	39 f2                	cmp    %esi,%edx
+  803f0f:	74 0b                	je     803f1c <strfind+0x1c>
+  803f11:	48 83 c0 01          	add    $0x1,%rax
+  803f15:	0f b6 10             	movzbl (%rax),%edx
+  803f18:	84 d2                	test   %dl,%dl
+  803f1a:	75 ee                	jne    803f0a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f1c:	c3                   	ret
+  803f1d:	c3                   	ret
+
+0000000000803f1e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f1e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f21:	48 89 f8             	mov    %rdi,%rax
+  803f24:	48 f7 d8             	neg    %rax
+  803f27:	83 e0 07             	and    $0x7,%eax
+  803f2a:	49 89 d1             	mov    %rdx,%r9
+  803f2d:	49 29 c1             	sub    %rax,%r9
+  803f30:	78 36                	js     803f68 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f32:	40 0f b6 c6          	movzbl %sil,%eax
+  803f36:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f3d:	01 01 01 
+  803f40:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f44:	40 f6 c7 07          	test   $0x7,%dil
+  803f48:	75 38                	jne    803f82 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f4a:	4c 89 c9             	mov    %r9,%rcx
+  803f4d:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f51:	74 0c                	je     803f5f <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f53:	fc                   	cld
+  803f54:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f57:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f5b:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f5f:	4d 85 c9             	test   %r9,%r9
+  803f62:	75 45                	jne    803fa9 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f64:	4c 89 c0             	mov    %r8,%rax
+  803f67:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f68:	48 85 d2             	test   %rdx,%rdx
+  803f6b:	74 f7                	je     803f64 <memset+0x46>
+  803f6d:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f70:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f73:	48 83 c0 01          	add    $0x1,%rax
+  803f77:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f7b:	48 39 c2             	cmp    %rax,%rdx
+  803f7e:	75 f3                	jne    803f73 <memset+0x55>
+  803f80:	eb e2                	jmp    803f64 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f82:	40 f6 c7 01          	test   $0x1,%dil
+  803f86:	74 06                	je     803f8e <memset+0x70>
+  803f88:	88 07                	mov    %al,(%rdi)
+  803f8a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f8e:	40 f6 c7 02          	test   $0x2,%dil
+  803f92:	74 07                	je     803f9b <memset+0x7d>
+  803f94:	66 89 07             	mov    %ax,(%rdi)
+  803f97:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803f9b:	40 f6 c7 04          	test   $0x4,%dil
+  803f9f:	74 a9                	je     803f4a <memset+0x2c>
+  803fa1:	89 07                	mov    %eax,(%rdi)
+  803fa3:	48 83 c7 04          	add    $0x4,%rdi
+  803fa7:	eb a1                	jmp    803f4a <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fa9:	41 f6 c1 04          	test   $0x4,%r9b
+  803fad:	74 06                	je     803fb5 <memset+0x97>
+  803faf:	89 07                	mov    %eax,(%rdi)
+  803fb1:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fb5:	41 f6 c1 02          	test   $0x2,%r9b
+  803fb9:	74 07                	je     803fc2 <memset+0xa4>
+  803fbb:	66 89 07             	mov    %ax,(%rdi)
+  803fbe:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fc2:	41 f6 c1 01          	test   $0x1,%r9b
+  803fc6:	74 9c                	je     803f64 <memset+0x46>
+  803fc8:	88 07                	mov    %al,(%rdi)
+  803fca:	eb 98                	jmp    803f64 <memset+0x46>
+
+0000000000803fcc <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fcc:	48 89 f8             	mov    %rdi,%rax
+  803fcf:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fd2:	48 39 fe             	cmp    %rdi,%rsi
+  803fd5:	73 3b                	jae    804012 <memmove+0x46>
+  803fd7:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803fdb:	48 39 d7             	cmp    %rdx,%rdi
+  803fde:	73 32                	jae    804012 <memmove+0x46>
+        s += n;
+        d += n;
+  803fe0:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803fe4:	48 89 d6             	mov    %rdx,%rsi
+  803fe7:	48 09 fe             	or     %rdi,%rsi
+  803fea:	48 09 ce             	or     %rcx,%rsi
+  803fed:	40 f6 c6 07          	test   $0x7,%sil
+  803ff1:	75 12                	jne    804005 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803ff3:	48 83 ef 08          	sub    $0x8,%rdi
+  803ff7:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803ffb:	48 c1 e9 03          	shr    $0x3,%rcx
+  803fff:	fd                   	std
+  804000:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804003:	fc                   	cld
+  804004:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804005:	48 83 ef 01          	sub    $0x1,%rdi
+  804009:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80400d:	fd                   	std
+  80400e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804010:	eb f1                	jmp    804003 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804012:	48 89 f2             	mov    %rsi,%rdx
+  804015:	48 09 c2             	or     %rax,%rdx
+  804018:	48 09 ca             	or     %rcx,%rdx
+  80401b:	f6 c2 07             	test   $0x7,%dl
+  80401e:	75 0c                	jne    80402c <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804020:	48 c1 e9 03          	shr    $0x3,%rcx
+  804024:	48 89 c7             	mov    %rax,%rdi
+  804027:	fc                   	cld
+  804028:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80402b:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80402c:	48 89 c7             	mov    %rax,%rdi
+  80402f:	fc                   	cld
+  804030:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804032:	c3                   	ret
+
+0000000000804033 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804033:	55                   	push   %rbp
+  804034:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  804037:	48 b8 cc 3f 80 00 00 	movabs $0x803fcc,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+}
+  804043:	5d                   	pop    %rbp
+  804044:	c3                   	ret
+
+0000000000804045 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804045:	55                   	push   %rbp
+  804046:	48 89 e5             	mov    %rsp,%rbp
+  804049:	41 57                	push   %r15
+  80404b:	41 56                	push   %r14
+  80404d:	41 55                	push   %r13
+  80404f:	41 54                	push   %r12
+  804051:	53                   	push   %rbx
+  804052:	48 83 ec 08          	sub    $0x8,%rsp
+  804056:	49 89 fe             	mov    %rdi,%r14
+  804059:	49 89 f7             	mov    %rsi,%r15
+  80405c:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80405f:	48 89 f7             	mov    %rsi,%rdi
+  804062:	48 b8 94 3d 80 00 00 	movabs $0x803d94,%rax
+  804069:	00 00 00 
+  80406c:	ff d0                	call   *%rax
+  80406e:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804071:	48 89 de             	mov    %rbx,%rsi
+  804074:	4c 89 f7             	mov    %r14,%rdi
+  804077:	48 b8 af 3d 80 00 00 	movabs $0x803daf,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  804086:	48 39 c3             	cmp    %rax,%rbx
+  804089:	74 36                	je     8040c1 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80408b:	48 89 d8             	mov    %rbx,%rax
+  80408e:	4c 29 e8             	sub    %r13,%rax
+  804091:	49 39 c4             	cmp    %rax,%r12
+  804094:	73 31                	jae    8040c7 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  804096:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80409b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80409f:	4c 89 fe             	mov    %r15,%rsi
+  8040a2:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  8040a9:	00 00 00 
+  8040ac:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040ae:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040b2:	48 83 c4 08          	add    $0x8,%rsp
+  8040b6:	5b                   	pop    %rbx
+  8040b7:	41 5c                	pop    %r12
+  8040b9:	41 5d                	pop    %r13
+  8040bb:	41 5e                	pop    %r14
+  8040bd:	41 5f                	pop    %r15
+  8040bf:	5d                   	pop    %rbp
+  8040c0:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040c1:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040c5:	eb eb                	jmp    8040b2 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040c7:	48 83 eb 01          	sub    $0x1,%rbx
+  8040cb:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040cf:	48 89 da             	mov    %rbx,%rdx
+  8040d2:	4c 89 fe             	mov    %r15,%rsi
+  8040d5:	48 b8 33 40 80 00 00 	movabs $0x804033,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040e1:	49 01 de             	add    %rbx,%r14
+  8040e4:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040e9:	eb c3                	jmp    8040ae <strlcat+0x69>
+
+00000000008040eb <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040eb:	48 85 d2             	test   %rdx,%rdx
+  8040ee:	74 2d                	je     80411d <memcmp+0x32>
+  8040f0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8040f5:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8040f9:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8040fe:	44 38 c1             	cmp    %r8b,%cl
+  804101:	75 0f                	jne    804112 <memcmp+0x27>
+    while (n-- > 0) {
+  804103:	48 83 c0 01          	add    $0x1,%rax
+  804107:	48 39 c2             	cmp    %rax,%rdx
+  80410a:	75 e9                	jne    8040f5 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80410c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804111:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804112:	0f b6 c1             	movzbl %cl,%eax
+  804115:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804119:	44 29 c0             	sub    %r8d,%eax
+  80411c:	c3                   	ret
+    return 0;
+  80411d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804122:	c3                   	ret
+
+0000000000804123 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804123:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804127:	48 39 c7             	cmp    %rax,%rdi
+  80412a:	73 0f                	jae    80413b <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80412c:	40 38 37             	cmp    %sil,(%rdi)
+  80412f:	74 0e                	je     80413f <memfind+0x1c>
+    for (; src < end; src++) {
+  804131:	48 83 c7 01          	add    $0x1,%rdi
+  804135:	48 39 f8             	cmp    %rdi,%rax
+  804138:	75 f2                	jne    80412c <memfind+0x9>
+  80413a:	c3                   	ret
+  80413b:	48 89 f8             	mov    %rdi,%rax
+  80413e:	c3                   	ret
+  80413f:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804142:	c3                   	ret
+
+0000000000804143 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804143:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  804146:	0f b6 37             	movzbl (%rdi),%esi
+  804149:	40 80 fe 20          	cmp    $0x20,%sil
+  80414d:	74 06                	je     804155 <strtol+0x12>
+  80414f:	40 80 fe 09          	cmp    $0x9,%sil
+  804153:	75 13                	jne    804168 <strtol+0x25>
+  804155:	48 83 c7 01          	add    $0x1,%rdi
+  804159:	0f b6 37             	movzbl (%rdi),%esi
+  80415c:	40 80 fe 20          	cmp    $0x20,%sil
+  804160:	74 f3                	je     804155 <strtol+0x12>
+  804162:	40 80 fe 09          	cmp    $0x9,%sil
+  804166:	74 ed                	je     804155 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  804168:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80416b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80416e:	3c 01                	cmp    $0x1,%al
+  804170:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804174:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80417a:	75 0f                	jne    80418b <strtol+0x48>
+  80417c:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80417f:	74 14                	je     804195 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804181:	85 d2                	test   %edx,%edx
+  804183:	b8 0a 00 00 00       	mov    $0xa,%eax
+  804188:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80418b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  804190:	4c 63 ca             	movslq %edx,%r9
+  804193:	eb 36                	jmp    8041cb <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804195:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  804199:	74 0f                	je     8041aa <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80419b:	85 d2                	test   %edx,%edx
+  80419d:	75 ec                	jne    80418b <strtol+0x48>
+        s++;
+  80419f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041a3:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041a8:	eb e1                	jmp    80418b <strtol+0x48>
+        s += 2;
+  8041aa:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041ae:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041b3:	eb d6                	jmp    80418b <strtol+0x48>
+            dig -= '0';
+  8041b5:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041b8:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041bc:	41 39 d0             	cmp    %edx,%r8d
+  8041bf:	7d 21                	jge    8041e2 <strtol+0x9f>
+        val = val * base + dig;
+  8041c1:	49 0f af c1          	imul   %r9,%rax
+  8041c5:	0f b6 c9             	movzbl %cl,%ecx
+  8041c8:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041cb:	48 83 c7 01          	add    $0x1,%rdi
+  8041cf:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041d3:	80 f9 39             	cmp    $0x39,%cl
+  8041d6:	76 dd                	jbe    8041b5 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041d8:	80 f9 7b             	cmp    $0x7b,%cl
+  8041db:	77 05                	ja     8041e2 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041dd:	83 e9 57             	sub    $0x57,%ecx
+  8041e0:	eb d6                	jmp    8041b8 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041e2:	4d 85 d2             	test   %r10,%r10
+  8041e5:	74 03                	je     8041ea <strtol+0xa7>
+  8041e7:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041ea:	48 89 c2             	mov    %rax,%rdx
+  8041ed:	48 f7 da             	neg    %rdx
+  8041f0:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8041f4:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8041f8:	c3                   	ret
+
+00000000008041f9 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8041f9:	55                   	push   %rbp
+  8041fa:	48 89 e5             	mov    %rsp,%rbp
+  8041fd:	41 56                	push   %r14
+  8041ff:	41 55                	push   %r13
+  804201:	41 54                	push   %r12
+  804203:	53                   	push   %rbx
+  804204:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804207:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80420e:	00 00 00 
+  804211:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804215:	74 27                	je     80423e <_handle_vectored_pagefault+0x45>
+  804217:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80421c:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804223:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804226:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804229:	4c 89 e7             	mov    %r12,%rdi
+  80422c:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804231:	84 c0                	test   %al,%al
+  804233:	75 45                	jne    80427a <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804235:	48 83 c3 01          	add    $0x1,%rbx
+  804239:	49 3b 1e             	cmp    (%r14),%rbx
+  80423c:	72 eb                	jb     804229 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80423e:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804245:	00 
+  804246:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80424b:	4d 8b 04 24          	mov    (%r12),%r8
+  80424f:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  804256:	00 00 00 
+  804259:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80425e:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804265:	00 00 00 
+  804268:	b8 00 00 00 00       	mov    $0x0,%eax
+  80426d:	49 ba 5d 33 80 00 00 	movabs $0x80335d,%r10
+  804274:	00 00 00 
+  804277:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80427a:	5b                   	pop    %rbx
+  80427b:	41 5c                	pop    %r12
+  80427d:	41 5d                	pop    %r13
+  80427f:	41 5e                	pop    %r14
+  804281:	5d                   	pop    %rbp
+  804282:	c3                   	ret
+
+0000000000804283 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804283:	55                   	push   %rbp
+  804284:	48 89 e5             	mov    %rsp,%rbp
+  804287:	53                   	push   %rbx
+  804288:	48 83 ec 08          	sub    $0x8,%rsp
+  80428c:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80428f:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804296:	00 00 00 
+  804299:	80 38 00             	cmpb   $0x0,(%rax)
+  80429c:	0f 84 84 00 00 00    	je     804326 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042a2:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042a9:	00 00 00 
+  8042ac:	48 8b 10             	mov    (%rax),%rdx
+  8042af:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042b4:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042bb:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042be:	48 85 d2             	test   %rdx,%rdx
+  8042c1:	74 19                	je     8042dc <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042c3:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042c7:	0f 84 e8 00 00 00    	je     8043b5 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042cd:	48 83 c0 01          	add    $0x1,%rax
+  8042d1:	48 39 d0             	cmp    %rdx,%rax
+  8042d4:	75 ed                	jne    8042c3 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042d6:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042da:	74 1c                	je     8042f8 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042dc:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042e0:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042e7:	00 00 00 
+  8042ea:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8042f1:	00 00 00 
+  8042f4:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8042f8:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  8042ff:	00 00 00 
+  804302:	ff d0                	call   *%rax
+  804304:	89 c7                	mov    %eax,%edi
+  804306:	48 be 7b 44 80 00 00 	movabs $0x80447b,%rsi
+  80430d:	00 00 00 
+  804310:	48 b8 fd 03 80 00 00 	movabs $0x8003fd,%rax
+  804317:	00 00 00 
+  80431a:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80431c:	85 c0                	test   %eax,%eax
+  80431e:	78 68                	js     804388 <add_pgfault_handler+0x105>
+    return res;
+}
+  804320:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804324:	c9                   	leave
+  804325:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804326:	48 b8 b2 01 80 00 00 	movabs $0x8001b2,%rax
+  80432d:	00 00 00 
+  804330:	ff d0                	call   *%rax
+  804332:	89 c7                	mov    %eax,%edi
+  804334:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804339:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80433e:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804345:	00 00 00 
+  804348:	48 b8 3f 02 80 00 00 	movabs $0x80023f,%rax
+  80434f:	00 00 00 
+  804352:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804354:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80435b:	00 00 00 
+  80435e:	48 8b 02             	mov    (%rdx),%rax
+  804361:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804365:	48 89 0a             	mov    %rcx,(%rdx)
+  804368:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80436f:	00 00 00 
+  804372:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804376:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80437d:	00 00 00 
+  804380:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804383:	e9 70 ff ff ff       	jmp    8042f8 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804388:	89 c1                	mov    %eax,%ecx
+  80438a:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  804391:	00 00 00 
+  804394:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804399:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  8043a0:	00 00 00 
+  8043a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a8:	49 b8 5d 33 80 00 00 	movabs $0x80335d,%r8
+  8043af:	00 00 00 
+  8043b2:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ba:	e9 61 ff ff ff       	jmp    804320 <add_pgfault_handler+0x9d>
+
+00000000008043bf <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043bf:	55                   	push   %rbp
+  8043c0:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043c3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043ca:	00 00 00 
+  8043cd:	80 38 00             	cmpb   $0x0,(%rax)
+  8043d0:	74 33                	je     804405 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043d2:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043d9:	00 00 00 
+  8043dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043e1:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043e8:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043eb:	48 85 c0             	test   %rax,%rax
+  8043ee:	0f 84 85 00 00 00    	je     804479 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8043f4:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8043f8:	74 40                	je     80443a <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043fa:	48 83 c1 01          	add    $0x1,%rcx
+  8043fe:	48 39 c1             	cmp    %rax,%rcx
+  804401:	75 f1                	jne    8043f4 <remove_pgfault_handler+0x35>
+  804403:	eb 74                	jmp    804479 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804405:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  80440c:	00 00 00 
+  80440f:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  804416:	00 00 00 
+  804419:	be 43 00 00 00       	mov    $0x43,%esi
+  80441e:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804425:	00 00 00 
+  804428:	b8 00 00 00 00       	mov    $0x0,%eax
+  80442d:	49 b8 5d 33 80 00 00 	movabs $0x80335d,%r8
+  804434:	00 00 00 
+  804437:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80443a:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804441:	00 
+  804442:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804446:	48 29 ca             	sub    %rcx,%rdx
+  804449:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804450:	00 00 00 
+  804453:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804457:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80445c:	48 89 ce             	mov    %rcx,%rsi
+  80445f:	48 b8 cc 3f 80 00 00 	movabs $0x803fcc,%rax
+  804466:	00 00 00 
+  804469:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80446b:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804472:	00 00 00 
+  804475:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804479:	5d                   	pop    %rbp
+  80447a:	c3                   	ret
+
+000000000080447b <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80447b:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80447e:	48 b8 f9 41 80 00 00 	movabs $0x8041f9,%rax
+  804485:	00 00 00 
+    call *%rax
+  804488:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80448a:	41 5f                	pop    %r15
+	popq %r15
+  80448c:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80448e:	41 5f                	pop    %r15
+	popq %r14
+  804490:	41 5e                	pop    %r14
+	popq %r13
+  804492:	41 5d                	pop    %r13
+	popq %r12
+  804494:	41 5c                	pop    %r12
+	popq %r11
+  804496:	41 5b                	pop    %r11
+	popq %r10
+  804498:	41 5a                	pop    %r10
+	popq %r9
+  80449a:	41 59                	pop    %r9
+	popq %r8
+  80449c:	41 58                	pop    %r8
+	popq %rsi
+  80449e:	5e                   	pop    %rsi
+	popq %rdi
+  80449f:	5f                   	pop    %rdi
+	popq %rbp
+  8044a0:	5d                   	pop    %rbp
+	popq %rdx
+  8044a1:	5a                   	pop    %rdx
+	popq %rcx
+  8044a2:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044a3:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044a8:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044ad:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044b1:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044b4:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044b9:	5b                   	pop    %rbx
+	popq %rax
+  8044ba:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044bb:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044bf:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044c0:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044c5:	c3                   	ret
+
+00000000008044c6 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044c6:	55                   	push   %rbp
+  8044c7:	48 89 e5             	mov    %rsp,%rbp
+  8044ca:	41 55                	push   %r13
+  8044cc:	41 54                	push   %r12
+  8044ce:	53                   	push   %rbx
+  8044cf:	48 83 ec 08          	sub    $0x8,%rsp
+  8044d3:	49 89 fd             	mov    %rdi,%r13
+  8044d6:	48 89 f7             	mov    %rsi,%rdi
+  8044d9:	48 89 d3             	mov    %rdx,%rbx
+  8044dc:	49 89 cc             	mov    %rcx,%r12
+  8044df:	4c 89 c2             	mov    %r8,%rdx
+  8044e2:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044e5:	48 85 f6             	test   %rsi,%rsi
+  8044e8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044ef:	00 00 00 
+  8044f2:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8044f6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044fb:	48 85 db             	test   %rbx,%rbx
+  8044fe:	74 03                	je     804503 <ipc_recv_futex+0x3d>
+  804500:	48 8b 33             	mov    (%rbx),%rsi
+  804503:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804507:	48 b8 89 04 80 00 00 	movabs $0x800489,%rax
+  80450e:	00 00 00 
+  804511:	ff d0                	call   *%rax
+    if (res < 0) {
+  804513:	85 c0                	test   %eax,%eax
+  804515:	78 75                	js     80458c <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804517:	4d 85 ed             	test   %r13,%r13
+  80451a:	74 14                	je     804530 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80451c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804523:	00 00 00 
+  804526:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80452c:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804530:	4d 85 e4             	test   %r12,%r12
+  804533:	74 14                	je     804549 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804535:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80453c:	00 00 00 
+  80453f:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804545:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804549:	48 85 db             	test   %rbx,%rbx
+  80454c:	74 23                	je     804571 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80454e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804555:	00 00 00 
+  804558:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80455e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804563:	85 c9                	test   %ecx,%ecx
+  804565:	74 07                	je     80456e <ipc_recv_futex+0xa8>
+  804567:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80456e:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804571:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804578:	00 00 00 
+  80457b:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804581:	48 83 c4 08          	add    $0x8,%rsp
+  804585:	5b                   	pop    %rbx
+  804586:	41 5c                	pop    %r12
+  804588:	41 5d                	pop    %r13
+  80458a:	5d                   	pop    %rbp
+  80458b:	c3                   	ret
+        if (from_env_store != NULL) {
+  80458c:	4d 85 ed             	test   %r13,%r13
+  80458f:	74 08                	je     804599 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804591:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804598:	00 
+        if (perm_store != NULL) {
+  804599:	4d 85 e4             	test   %r12,%r12
+  80459c:	74 08                	je     8045a6 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80459e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045a5:	00 
+        if (size != NULL) {
+  8045a6:	48 85 db             	test   %rbx,%rbx
+  8045a9:	74 d6                	je     804581 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045ab:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045b2:	eb cd                	jmp    804581 <ipc_recv_futex+0xbb>
+
+00000000008045b4 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045b4:	55                   	push   %rbp
+  8045b5:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8045bc:	6a 00                	push   $0x0
+  8045be:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045ca:	48 b8 c6 44 80 00 00 	movabs $0x8044c6,%rax
+  8045d1:	00 00 00 
+  8045d4:	ff d0                	call   *%rax
+}
+  8045d6:	c9                   	leave
+  8045d7:	c3                   	ret
+
+00000000008045d8 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045d8:	55                   	push   %rbp
+  8045d9:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045dc:	48 85 d2             	test   %rdx,%rdx
+  8045df:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045e6:	00 00 00 
+  8045e9:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045ed:	89 f6                	mov    %esi,%esi
+  8045ef:	48 b8 72 04 80 00 00 	movabs $0x800472,%rax
+  8045f6:	00 00 00 
+  8045f9:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045fb:	85 c0                	test   %eax,%eax
+  8045fd:	78 02                	js     804601 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8045ff:	5d                   	pop    %rbp
+  804600:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804601:	89 c1                	mov    %eax,%ecx
+  804603:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  80460a:	00 00 00 
+  80460d:	be 50 00 00 00       	mov    $0x50,%esi
+  804612:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  804619:	00 00 00 
+  80461c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804621:	49 b8 5d 33 80 00 00 	movabs $0x80335d,%r8
+  804628:	00 00 00 
+  80462b:	41 ff d0             	call   *%r8
+
+000000000080462e <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80462e:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804633:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80463a:	00 00 00 
+  80463d:	48 89 d0             	mov    %rdx,%rax
+  804640:	48 c1 e0 04          	shl    $0x4,%rax
+  804644:	48 29 d0             	sub    %rdx,%rax
+  804647:	48 c1 e0 05          	shl    $0x5,%rax
+  80464b:	48 01 c8             	add    %rcx,%rax
+  80464e:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804654:	39 f8                	cmp    %edi,%eax
+  804656:	74 13                	je     80466b <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804658:	48 83 c2 01          	add    $0x1,%rdx
+  80465c:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804663:	75 d8                	jne    80463d <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804665:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80466a:	c3                   	ret
+            return envs[i].env_id;
+  80466b:	48 89 d0             	mov    %rdx,%rax
+  80466e:	48 c1 e0 04          	shl    $0x4,%rax
+  804672:	48 29 d0             	sub    %rdx,%rax
+  804675:	48 c1 e0 05          	shl    $0x5,%rax
+  804679:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804680:	00 00 00 
+  804683:	48 01 d0             	add    %rdx,%rax
+  804686:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80468c:	c3                   	ret
+  80468d:	0f 1f 00             	nopl   (%rax)
+
+0000000000804690 <__rodata_start>:
+  804690:	3c 75                	cmp    $0x75,%al
+  804692:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804693:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804697:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804698:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  80469c:	1f                   	(bad)
+  80469d:	44 00 00             	add    %r8b,(%rax)
+  8046a0:	73 79                	jae    80471b <__rodata_start+0x8b>
+  8046a2:	73 63                	jae    804707 <__rodata_start+0x77>
+  8046a4:	61                   	(bad)
+  8046a5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046a6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046a7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab27 <__bss_end+0x721c8b27>
+  8046ad:	65 74 75             	gs je  804725 <__rodata_start+0x95>
+  8046b0:	72 6e                	jb     804720 <__rodata_start+0x90>
+  8046b2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab34 <__bss_end+0x281c8b34>
+  8046b9:	28 
+  8046ba:	3e 20 30             	ds and %dh,(%rax)
+  8046bd:	29 00                	sub    %eax,(%rax)
+  8046bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046c7:	61                   	(bad)
+  8046c8:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ca:	2e 63 00             	cs movsxd (%rax),%eax
+  8046cd:	0f 1f 00             	nopl   (%rax)
+  8046d0:	5b                   	pop    %rbx
+  8046d1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046d6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046d9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046dd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046de:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046e2:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046e9:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805154 <__ctors_end+0x74>
+  8046f0:	5b                   	pop    %rbx
+  8046f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046f6:	20 66 74             	and    %ah,0x74(%rsi)
+  8046f9:	72 75                	jb     804770 <devtab+0x10>
+  8046fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046fc:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8046ff:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad676a <__bss_end+0x2d29476a>
+  804706:	20 62 61             	and    %ah,0x61(%rdx)
+  804709:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80470d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804711:	5b                   	pop    %rbx
+  804712:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804717:	20 72 65             	and    %dh,0x65(%rdx)
+  80471a:	61                   	(bad)
+  80471b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad6786 <__bss_end+0x2d294786>
+  804722:	20 62 61             	and    %ah,0x61(%rdx)
+  804725:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804729:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80472d:	5b                   	pop    %rbx
+  80472e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804733:	20 77 72             	and    %dh,0x72(%rdi)
+  804736:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80473d:	2d 
+  80473e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804743:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804746:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80474a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804751:	00 00 00 
+  804754:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475b:	00 00 00 
+  80475e:	66 90                	xchg   %ax,%ax
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	9a 36 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	cb 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	db 3c 80 00 00 00 00 00 b9 36 80 00 00 00 00 00     .<.......6......
+  804a00:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	ad 36 80 00 00 00 00 00 27 37 80 00 00 00 00 00     .6......'7......
+  804a20:	db 3c 80 00 00 00 00 00 ad 36 80 00 00 00 00 00     .<.......6......
+  804a30:	f3 36 80 00 00 00 00 00 f3 36 80 00 00 00 00 00     .6.......6......
+  804a40:	f3 36 80 00 00 00 00 00 f3 36 80 00 00 00 00 00     .6.......6......
+  804a50:	f3 36 80 00 00 00 00 00 f3 36 80 00 00 00 00 00     .6.......6......
+  804a60:	f3 36 80 00 00 00 00 00 f3 36 80 00 00 00 00 00     .6.......6......
+  804a70:	f3 36 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .6.......<......
+  804a80:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	db 3c 80 00 00 00 00 00 fe 3b 80 00 00 00 00 00     .<.......;......
+  804b70:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	4a 37 80 00 00 00 00 00 19 39 80 00 00 00 00 00     J7.......9......
+  804bd0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	79 37 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     y7.......<......
+  804c00:	db 3c 80 00 00 00 00 00 3f 37 80 00 00 00 00 00     .<......?7......
+  804c10:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	c1 3a 80 00 00 00 00 00 8b 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	db 3c 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	10 38 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .8.......<......
+  804c50:	ed 39 80 00 00 00 00 00 db 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	db 3c 80 00 00 00 00 00 fe 3b 80 00 00 00 00 00     .<.......;......
+  804c70:	db 3c 80 00 00 00 00 00 a3 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
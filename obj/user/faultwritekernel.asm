@@ -0,0 +1,7876 @@
+
+obj/user/faultwritekernel:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 00 00 00       	call   800036 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+    *(volatile unsigned *)0x8040000000 = 0;
+  800025:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80002c:	00 00 00 
+  80002f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+}
+  800035:	c3                   	ret
+
+0000000000800036 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800036:	55                   	push   %rbp
+  800037:	48 89 e5             	mov    %rsp,%rbp
+  80003a:	41 56                	push   %r14
+  80003c:	41 55                	push   %r13
+  80003e:	41 54                	push   %r12
+  800040:	53                   	push   %rbx
+  800041:	41 89 fd             	mov    %edi,%r13d
+  800044:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800047:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  80004e:	00 00 00 
+  800051:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800058:	00 00 00 
+  80005b:	48 39 c2             	cmp    %rax,%rdx
+  80005e:	73 17                	jae    800077 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800060:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800063:	49 89 c4             	mov    %rax,%r12
+  800066:	48 83 c3 08          	add    $0x8,%rbx
+  80006a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006f:	ff 53 f8             	call   *-0x8(%rbx)
+  800072:	4c 39 e3             	cmp    %r12,%rbx
+  800075:	72 ef                	jb     800066 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800077:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  80007e:	00 00 00 
+  800081:	ff d0                	call   *%rax
+  800083:	89 c2                	mov    %eax,%edx
+  800085:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80008b:	48 89 d0             	mov    %rdx,%rax
+  80008e:	48 c1 e0 04          	shl    $0x4,%rax
+  800092:	48 29 d0             	sub    %rdx,%rax
+  800095:	48 c1 e0 05          	shl    $0x5,%rax
+  800099:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000a0:	00 00 00 
+  8000a3:	48 01 d0             	add    %rdx,%rax
+  8000a6:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000ad:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000b0:	45 85 ed             	test   %r13d,%r13d
+  8000b3:	7e 0d                	jle    8000c2 <libmain+0x8c>
+  8000b5:	49 8b 06             	mov    (%r14),%rax
+  8000b8:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000bf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000c2:	4c 89 f6             	mov    %r14,%rsi
+  8000c5:	44 89 ef             	mov    %r13d,%edi
+  8000c8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000cf:	00 00 00 
+  8000d2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000d4:	48 b8 e9 00 80 00 00 	movabs $0x8000e9,%rax
+  8000db:	00 00 00 
+  8000de:	ff d0                	call   *%rax
+#endif
+}
+  8000e0:	5b                   	pop    %rbx
+  8000e1:	41 5c                	pop    %r12
+  8000e3:	41 5d                	pop    %r13
+  8000e5:	41 5e                	pop    %r14
+  8000e7:	5d                   	pop    %rbp
+  8000e8:	c3                   	ret
+
+00000000008000e9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000e9:	55                   	push   %rbp
+  8000ea:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000ed:	48 b8 9d 08 80 00 00 	movabs $0x80089d,%rax
+  8000f4:	00 00 00 
+  8000f7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000fe:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+}
+  80010a:	5d                   	pop    %rbp
+  80010b:	c3                   	ret
+
+000000000080010c <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80010c:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800111:	ba 00 00 00 00       	mov    $0x0,%edx
+  800116:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80011c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800122:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800128:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80012a:	c3                   	ret
+
+000000000080012b <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80012b:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800130:	bf 00 00 00 00       	mov    $0x0,%edi
+  800135:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80013a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80013f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800145:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80014b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800151:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800153:	c3                   	ret
+
+0000000000800154 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800154:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800157:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80015c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800161:	ba 00 00 00 00       	mov    $0x0,%edx
+  800166:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80016c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800172:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800178:	0f 05                	syscall
+    if (check && ret > 0) {
+  80017a:	48 85 c0             	test   %rax,%rax
+  80017d:	7f 01                	jg     800180 <sys_env_destroy+0x2c>
+}
+  80017f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800180:	55                   	push   %rbp
+  800181:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800184:	49 89 c0             	mov    %rax,%r8
+  800187:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80018c:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  800193:	00 00 00 
+  800196:	be 29 00 00 00       	mov    $0x29,%esi
+  80019b:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  8001a2:	00 00 00 
+  8001a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001aa:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  8001b1:	00 00 00 
+  8001b4:	41 ff d1             	call   *%r9
+
+00000000008001b7 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001b7:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001dd:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001df:	c3                   	ret
+
+00000000008001e0 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001e0:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ea:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800200:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800206:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800208:	c3                   	ret
+
+0000000000800209 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800209:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80020e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800215:	00 00 00 
+  800218:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80021e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800224:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80022a:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80022c:	c3                   	ret
+
+000000000080022d <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80022d:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800230:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800235:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800241:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800243:	c3                   	ret
+
+0000000000800244 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800244:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800247:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80024c:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80024f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800255:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80025b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80025d:	48 85 c0             	test   %rax,%rax
+  800260:	7f 01                	jg     800263 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800262:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800263:	55                   	push   %rbp
+  800264:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800267:	49 89 c0             	mov    %rax,%r8
+  80026a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80026f:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  800276:	00 00 00 
+  800279:	be 29 00 00 00       	mov    $0x29,%esi
+  80027e:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  800285:	00 00 00 
+  800288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80028d:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  800294:	00 00 00 
+  800297:	41 ff d1             	call   *%r9
+
+000000000080029a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80029a:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80029d:	48 63 d2             	movslq %edx,%rdx
+  8002a0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002a3:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002a8:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002ab:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002ad:	48 85 c0             	test   %rax,%rax
+  8002b0:	7f 01                	jg     8002b3 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002b2:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002b3:	55                   	push   %rbp
+  8002b4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002b7:	49 89 c0             	mov    %rax,%r8
+  8002ba:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002bf:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  8002c6:	00 00 00 
+  8002c9:	be 29 00 00 00       	mov    $0x29,%esi
+  8002ce:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  8002d5:	00 00 00 
+  8002d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002dd:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  8002e4:	00 00 00 
+  8002e7:	41 ff d1             	call   *%r9
+
+00000000008002ea <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002ea:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002ed:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002f2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002f8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002fe:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800304:	0f 05                	syscall
+    if (check && ret > 0) {
+  800306:	48 85 c0             	test   %rax,%rax
+  800309:	7f 01                	jg     80030c <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80030b:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80030c:	55                   	push   %rbp
+  80030d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800310:	49 89 c0             	mov    %rax,%r8
+  800313:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800318:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  80031f:	00 00 00 
+  800322:	be 29 00 00 00       	mov    $0x29,%esi
+  800327:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  80032e:	00 00 00 
+  800331:	b8 00 00 00 00       	mov    $0x0,%eax
+  800336:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  80033d:	00 00 00 
+  800340:	41 ff d1             	call   *%r9
+
+0000000000800343 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800343:	48 63 f6             	movslq %esi,%rsi
+  800346:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800349:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80034e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800353:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800359:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80035f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800365:	0f 05                	syscall
+    if (check && ret > 0) {
+  800367:	48 85 c0             	test   %rax,%rax
+  80036a:	7f 01                	jg     80036d <sys_env_set_status+0x2a>
+}
+  80036c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80036d:	55                   	push   %rbp
+  80036e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800371:	49 89 c0             	mov    %rax,%r8
+  800374:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800379:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  800380:	00 00 00 
+  800383:	be 29 00 00 00       	mov    $0x29,%esi
+  800388:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  80038f:	00 00 00 
+  800392:	b8 00 00 00 00       	mov    $0x0,%eax
+  800397:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  80039e:	00 00 00 
+  8003a1:	41 ff d1             	call   *%r9
+
+00000000008003a4 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003a4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003a7:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003c3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003c5:	48 85 c0             	test   %rax,%rax
+  8003c8:	7f 01                	jg     8003cb <sys_env_set_trapframe+0x27>
+}
+  8003ca:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003cb:	55                   	push   %rbp
+  8003cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003cf:	49 89 c0             	mov    %rax,%r8
+  8003d2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003d7:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  8003de:	00 00 00 
+  8003e1:	be 29 00 00 00       	mov    $0x29,%esi
+  8003e6:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  8003ed:	00 00 00 
+  8003f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f5:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  8003fc:	00 00 00 
+  8003ff:	41 ff d1             	call   *%r9
+
+0000000000800402 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  800402:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800405:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80040a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800415:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80041b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800421:	0f 05                	syscall
+    if (check && ret > 0) {
+  800423:	48 85 c0             	test   %rax,%rax
+  800426:	7f 01                	jg     800429 <sys_env_set_pgfault_upcall+0x27>
+}
+  800428:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800429:	55                   	push   %rbp
+  80042a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80042d:	49 89 c0             	mov    %rax,%r8
+  800430:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800435:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  80043c:	00 00 00 
+  80043f:	be 29 00 00 00       	mov    $0x29,%esi
+  800444:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  80044b:	00 00 00 
+  80044e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800453:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  80045a:	00 00 00 
+  80045d:	41 ff d1             	call   *%r9
+
+0000000000800460 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800460:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800463:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800466:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80046b:	4d 63 c0             	movslq %r8d,%r8
+  80046e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800474:	0f 05                	syscall
+}
+  800476:	c3                   	ret
+
+0000000000800477 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800477:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80047a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80047d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800482:	4d 63 c0             	movslq %r8d,%r8
+  800485:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80048b:	0f 05                	syscall
+}
+  80048d:	c3                   	ret
+
+000000000080048e <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80048e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800493:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800496:	45 89 c0             	mov    %r8d,%r8d
+  800499:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80049f:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004a1:	48 85 c0             	test   %rax,%rax
+  8004a4:	7f 01                	jg     8004a7 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004a6:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004a7:	55                   	push   %rbp
+  8004a8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004ab:	49 89 c0             	mov    %rax,%r8
+  8004ae:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004b3:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  8004ba:	00 00 00 
+  8004bd:	be 29 00 00 00       	mov    $0x29,%esi
+  8004c2:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  8004c9:	00 00 00 
+  8004cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004d1:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  8004d8:	00 00 00 
+  8004db:	41 ff d1             	call   *%r9
+
+00000000008004de <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004de:	55                   	push   %rbp
+  8004df:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004e2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004e8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004f2:	48 b8 8e 04 80 00 00 	movabs $0x80048e,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+}
+  8004fe:	5d                   	pop    %rbp
+  8004ff:	c3                   	ret
+
+0000000000800500 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  800500:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800505:	bf 00 00 00 00       	mov    $0x0,%edi
+  80050a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80050f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800514:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80051a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800520:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800526:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800528:	c3                   	ret
+
+0000000000800529 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800529:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80052e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800533:	ba 00 00 00 00       	mov    $0x0,%edx
+  800538:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80053e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800544:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80054a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80054c:	48 85 c0             	test   %rax,%rax
+  80054f:	7f 01                	jg     800552 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800551:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800552:	55                   	push   %rbp
+  800553:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800556:	49 89 c0             	mov    %rax,%r8
+  800559:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80055e:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  800565:	00 00 00 
+  800568:	be 29 00 00 00       	mov    $0x29,%esi
+  80056d:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  800574:	00 00 00 
+  800577:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057c:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  800583:	00 00 00 
+  800586:	41 ff d1             	call   *%r9
+
+0000000000800589 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  800589:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80058e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800593:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800598:	ba 00 00 00 00       	mov    $0x0,%edx
+  80059d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005a3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005a9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005af:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005b1:	c3                   	ret
+
+00000000008005b2 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005b2:	89 d2                	mov    %edx,%edx
+  8005b4:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005b6:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005bb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005c1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005c7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005cd:	0f 05                	syscall
+}
+  8005cf:	c3                   	ret
+
+00000000008005d0 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005d0:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005d3:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005dd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005e9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005ef:	0f 05                	syscall
+}
+  8005f1:	c3                   	ret
+
+00000000008005f2 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005f2:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005f5:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005ff:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800605:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80060b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800611:	0f 05                	syscall
+}
+  800613:	c3                   	ret
+
+0000000000800614 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800614:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800617:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80061c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800621:	ba 00 00 00 00       	mov    $0x0,%edx
+  800626:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80062c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800632:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800638:	0f 05                	syscall
+    if (check && ret > 0) {
+  80063a:	48 85 c0             	test   %rax,%rax
+  80063d:	7f 01                	jg     800640 <sys_irq_ack+0x2c>
+}
+  80063f:	c3                   	ret
+sys_irq_ack(int irq) {
+  800640:	55                   	push   %rbp
+  800641:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800644:	49 89 c0             	mov    %rax,%r8
+  800647:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80064c:	48 ba a8 46 80 00 00 	movabs $0x8046a8,%rdx
+  800653:	00 00 00 
+  800656:	be 29 00 00 00       	mov    $0x29,%esi
+  80065b:	48 bf c7 46 80 00 00 	movabs $0x8046c7,%rdi
+  800662:	00 00 00 
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	49 b9 62 33 80 00 00 	movabs $0x803362,%r9
+  800671:	00 00 00 
+  800674:	41 ff d1             	call   *%r9
+
+0000000000800677 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800677:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80067e:	ff ff ff 
+  800681:	48 01 f8             	add    %rdi,%rax
+  800684:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  800688:	c3                   	ret
+
+0000000000800689 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800689:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800690:	ff ff ff 
+  800693:	48 01 f8             	add    %rdi,%rax
+  800696:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80069a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006a0:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006a4:	c3                   	ret
+
+00000000008006a5 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006a5:	55                   	push   %rbp
+  8006a6:	48 89 e5             	mov    %rsp,%rbp
+  8006a9:	41 57                	push   %r15
+  8006ab:	41 56                	push   %r14
+  8006ad:	41 55                	push   %r13
+  8006af:	41 54                	push   %r12
+  8006b1:	53                   	push   %rbx
+  8006b2:	48 83 ec 08          	sub    $0x8,%rsp
+  8006b6:	49 89 ff             	mov    %rdi,%r15
+  8006b9:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006be:	49 bd 34 2e 80 00 00 	movabs $0x802e34,%r13
+  8006c5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006c8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006ce:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006d1:	48 89 df             	mov    %rbx,%rdi
+  8006d4:	41 ff d5             	call   *%r13
+  8006d7:	83 e0 04             	and    $0x4,%eax
+  8006da:	74 17                	je     8006f3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006dc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006e3:	4c 39 f3             	cmp    %r14,%rbx
+  8006e6:	75 e6                	jne    8006ce <fd_alloc+0x29>
+  8006e8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006ee:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006f3:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006f6:	48 83 c4 08          	add    $0x8,%rsp
+  8006fa:	5b                   	pop    %rbx
+  8006fb:	41 5c                	pop    %r12
+  8006fd:	41 5d                	pop    %r13
+  8006ff:	41 5e                	pop    %r14
+  800701:	41 5f                	pop    %r15
+  800703:	5d                   	pop    %rbp
+  800704:	c3                   	ret
+
+0000000000800705 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  800705:	83 ff 1f             	cmp    $0x1f,%edi
+  800708:	77 39                	ja     800743 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80070a:	55                   	push   %rbp
+  80070b:	48 89 e5             	mov    %rsp,%rbp
+  80070e:	41 54                	push   %r12
+  800710:	53                   	push   %rbx
+  800711:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800714:	48 63 df             	movslq %edi,%rbx
+  800717:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80071e:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800722:	48 89 df             	mov    %rbx,%rdi
+  800725:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  80072c:	00 00 00 
+  80072f:	ff d0                	call   *%rax
+  800731:	a8 04                	test   $0x4,%al
+  800733:	74 14                	je     800749 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800735:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800739:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80073e:	5b                   	pop    %rbx
+  80073f:	41 5c                	pop    %r12
+  800741:	5d                   	pop    %rbp
+  800742:	c3                   	ret
+        return -E_INVAL;
+  800743:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800748:	c3                   	ret
+        return -E_INVAL;
+  800749:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80074e:	eb ee                	jmp    80073e <fd_lookup+0x39>
+
+0000000000800750 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800750:	55                   	push   %rbp
+  800751:	48 89 e5             	mov    %rsp,%rbp
+  800754:	41 54                	push   %r12
+  800756:	53                   	push   %rbx
+  800757:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80075a:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  800761:	00 00 00 
+  800764:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80076b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80076e:	39 3b                	cmp    %edi,(%rbx)
+  800770:	74 47                	je     8007b9 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800772:	48 83 c0 08          	add    $0x8,%rax
+  800776:	48 8b 18             	mov    (%rax),%rbx
+  800779:	48 85 db             	test   %rbx,%rbx
+  80077c:	75 f0                	jne    80076e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80077e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800785:	00 00 00 
+  800788:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80078e:	89 fa                	mov    %edi,%edx
+  800790:	48 bf d8 46 80 00 00 	movabs $0x8046d8,%rdi
+  800797:	00 00 00 
+  80079a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079f:	48 b9 b2 34 80 00 00 	movabs $0x8034b2,%rcx
+  8007a6:	00 00 00 
+  8007a9:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007ab:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007b0:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007b4:	5b                   	pop    %rbx
+  8007b5:	41 5c                	pop    %r12
+  8007b7:	5d                   	pop    %rbp
+  8007b8:	c3                   	ret
+            return 0;
+  8007b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007be:	eb f0                	jmp    8007b0 <dev_lookup+0x60>
+
+00000000008007c0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007c0:	55                   	push   %rbp
+  8007c1:	48 89 e5             	mov    %rsp,%rbp
+  8007c4:	41 55                	push   %r13
+  8007c6:	41 54                	push   %r12
+  8007c8:	53                   	push   %rbx
+  8007c9:	48 83 ec 18          	sub    $0x18,%rsp
+  8007cd:	48 89 fb             	mov    %rdi,%rbx
+  8007d0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007d3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007da:	ff ff ff 
+  8007dd:	48 01 df             	add    %rbx,%rdi
+  8007e0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007e4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007e8:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  8007ef:	00 00 00 
+  8007f2:	ff d0                	call   *%rax
+  8007f4:	41 89 c5             	mov    %eax,%r13d
+  8007f7:	85 c0                	test   %eax,%eax
+  8007f9:	78 06                	js     800801 <fd_close+0x41>
+  8007fb:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007ff:	74 1a                	je     80081b <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  800801:	45 84 e4             	test   %r12b,%r12b
+  800804:	b8 00 00 00 00       	mov    $0x0,%eax
+  800809:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80080d:	44 89 e8             	mov    %r13d,%eax
+  800810:	48 83 c4 18          	add    $0x18,%rsp
+  800814:	5b                   	pop    %rbx
+  800815:	41 5c                	pop    %r12
+  800817:	41 5d                	pop    %r13
+  800819:	5d                   	pop    %rbp
+  80081a:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80081b:	8b 3b                	mov    (%rbx),%edi
+  80081d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800821:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800828:	00 00 00 
+  80082b:	ff d0                	call   *%rax
+  80082d:	41 89 c5             	mov    %eax,%r13d
+  800830:	85 c0                	test   %eax,%eax
+  800832:	78 1b                	js     80084f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800834:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800838:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80083c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800842:	48 85 c0             	test   %rax,%rax
+  800845:	74 08                	je     80084f <fd_close+0x8f>
+  800847:	48 89 df             	mov    %rbx,%rdi
+  80084a:	ff d0                	call   *%rax
+  80084c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80084f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800854:	48 89 de             	mov    %rbx,%rsi
+  800857:	bf 00 00 00 00       	mov    $0x0,%edi
+  80085c:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  800863:	00 00 00 
+  800866:	ff d0                	call   *%rax
+    return res;
+  800868:	eb a3                	jmp    80080d <fd_close+0x4d>
+
+000000000080086a <close>:
+
+int
+close(int fdnum) {
+  80086a:	55                   	push   %rbp
+  80086b:	48 89 e5             	mov    %rsp,%rbp
+  80086e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800872:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800876:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  80087d:	00 00 00 
+  800880:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800882:	85 c0                	test   %eax,%eax
+  800884:	78 15                	js     80089b <close+0x31>
+
+    return fd_close(fd, 1);
+  800886:	be 01 00 00 00       	mov    $0x1,%esi
+  80088b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80088f:	48 b8 c0 07 80 00 00 	movabs $0x8007c0,%rax
+  800896:	00 00 00 
+  800899:	ff d0                	call   *%rax
+}
+  80089b:	c9                   	leave
+  80089c:	c3                   	ret
+
+000000000080089d <close_all>:
+
+void
+close_all(void) {
+  80089d:	55                   	push   %rbp
+  80089e:	48 89 e5             	mov    %rsp,%rbp
+  8008a1:	41 54                	push   %r12
+  8008a3:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008a4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008a9:	49 bc 6a 08 80 00 00 	movabs $0x80086a,%r12
+  8008b0:	00 00 00 
+  8008b3:	89 df                	mov    %ebx,%edi
+  8008b5:	41 ff d4             	call   *%r12
+  8008b8:	83 c3 01             	add    $0x1,%ebx
+  8008bb:	83 fb 20             	cmp    $0x20,%ebx
+  8008be:	75 f3                	jne    8008b3 <close_all+0x16>
+}
+  8008c0:	5b                   	pop    %rbx
+  8008c1:	41 5c                	pop    %r12
+  8008c3:	5d                   	pop    %rbp
+  8008c4:	c3                   	ret
+
+00000000008008c5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008c5:	55                   	push   %rbp
+  8008c6:	48 89 e5             	mov    %rsp,%rbp
+  8008c9:	41 57                	push   %r15
+  8008cb:	41 56                	push   %r14
+  8008cd:	41 55                	push   %r13
+  8008cf:	41 54                	push   %r12
+  8008d1:	53                   	push   %rbx
+  8008d2:	48 83 ec 18          	sub    $0x18,%rsp
+  8008d6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008d9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008dd:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  8008e4:	00 00 00 
+  8008e7:	ff d0                	call   *%rax
+  8008e9:	89 c3                	mov    %eax,%ebx
+  8008eb:	85 c0                	test   %eax,%eax
+  8008ed:	0f 88 b8 00 00 00    	js     8009ab <dup+0xe6>
+    close(newfdnum);
+  8008f3:	44 89 e7             	mov    %r12d,%edi
+  8008f6:	48 b8 6a 08 80 00 00 	movabs $0x80086a,%rax
+  8008fd:	00 00 00 
+  800900:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  800902:	4d 63 ec             	movslq %r12d,%r13
+  800905:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80090c:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800910:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800914:	4c 89 ff             	mov    %r15,%rdi
+  800917:	49 be 89 06 80 00 00 	movabs $0x800689,%r14
+  80091e:	00 00 00 
+  800921:	41 ff d6             	call   *%r14
+  800924:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800927:	4c 89 ef             	mov    %r13,%rdi
+  80092a:	41 ff d6             	call   *%r14
+  80092d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800930:	48 89 df             	mov    %rbx,%rdi
+  800933:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  80093a:	00 00 00 
+  80093d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  80093f:	a8 04                	test   $0x4,%al
+  800941:	74 2b                	je     80096e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800943:	41 89 c1             	mov    %eax,%r9d
+  800946:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80094c:	4c 89 f1             	mov    %r14,%rcx
+  80094f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800954:	48 89 de             	mov    %rbx,%rsi
+  800957:	bf 00 00 00 00       	mov    $0x0,%edi
+  80095c:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  800963:	00 00 00 
+  800966:	ff d0                	call   *%rax
+  800968:	89 c3                	mov    %eax,%ebx
+  80096a:	85 c0                	test   %eax,%eax
+  80096c:	78 4e                	js     8009bc <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  80096e:	4c 89 ff             	mov    %r15,%rdi
+  800971:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  800978:	00 00 00 
+  80097b:	ff d0                	call   *%rax
+  80097d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800980:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800986:	4c 89 e9             	mov    %r13,%rcx
+  800989:	ba 00 00 00 00       	mov    $0x0,%edx
+  80098e:	4c 89 fe             	mov    %r15,%rsi
+  800991:	bf 00 00 00 00       	mov    $0x0,%edi
+  800996:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  80099d:	00 00 00 
+  8009a0:	ff d0                	call   *%rax
+  8009a2:	89 c3                	mov    %eax,%ebx
+  8009a4:	85 c0                	test   %eax,%eax
+  8009a6:	78 14                	js     8009bc <dup+0xf7>
+
+    return newfdnum;
+  8009a8:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009ab:	89 d8                	mov    %ebx,%eax
+  8009ad:	48 83 c4 18          	add    $0x18,%rsp
+  8009b1:	5b                   	pop    %rbx
+  8009b2:	41 5c                	pop    %r12
+  8009b4:	41 5d                	pop    %r13
+  8009b6:	41 5e                	pop    %r14
+  8009b8:	41 5f                	pop    %r15
+  8009ba:	5d                   	pop    %rbp
+  8009bb:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009c1:	4c 89 ee             	mov    %r13,%rsi
+  8009c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009c9:	49 bc ea 02 80 00 00 	movabs $0x8002ea,%r12
+  8009d0:	00 00 00 
+  8009d3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009db:	4c 89 f6             	mov    %r14,%rsi
+  8009de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e3:	41 ff d4             	call   *%r12
+    return res;
+  8009e6:	eb c3                	jmp    8009ab <dup+0xe6>
+
+00000000008009e8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009e8:	55                   	push   %rbp
+  8009e9:	48 89 e5             	mov    %rsp,%rbp
+  8009ec:	41 56                	push   %r14
+  8009ee:	41 55                	push   %r13
+  8009f0:	41 54                	push   %r12
+  8009f2:	53                   	push   %rbx
+  8009f3:	48 83 ec 10          	sub    $0x10,%rsp
+  8009f7:	89 fb                	mov    %edi,%ebx
+  8009f9:	49 89 f4             	mov    %rsi,%r12
+  8009fc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009ff:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a03:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800a0a:	00 00 00 
+  800a0d:	ff d0                	call   *%rax
+  800a0f:	85 c0                	test   %eax,%eax
+  800a11:	78 4c                	js     800a5f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a13:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a17:	41 8b 3e             	mov    (%r14),%edi
+  800a1a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a1e:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800a25:	00 00 00 
+  800a28:	ff d0                	call   *%rax
+  800a2a:	85 c0                	test   %eax,%eax
+  800a2c:	78 35                	js     800a63 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a2e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a32:	83 e0 03             	and    $0x3,%eax
+  800a35:	83 f8 01             	cmp    $0x1,%eax
+  800a38:	74 2d                	je     800a67 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a3a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a3e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a42:	48 85 c0             	test   %rax,%rax
+  800a45:	74 56                	je     800a9d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a47:	4c 89 ea             	mov    %r13,%rdx
+  800a4a:	4c 89 e6             	mov    %r12,%rsi
+  800a4d:	4c 89 f7             	mov    %r14,%rdi
+  800a50:	ff d0                	call   *%rax
+}
+  800a52:	48 83 c4 10          	add    $0x10,%rsp
+  800a56:	5b                   	pop    %rbx
+  800a57:	41 5c                	pop    %r12
+  800a59:	41 5d                	pop    %r13
+  800a5b:	41 5e                	pop    %r14
+  800a5d:	5d                   	pop    %rbp
+  800a5e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a5f:	48 98                	cltq
+  800a61:	eb ef                	jmp    800a52 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a63:	48 98                	cltq
+  800a65:	eb eb                	jmp    800a52 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a67:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a6e:	00 00 00 
+  800a71:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a77:	89 da                	mov    %ebx,%edx
+  800a79:	48 bf 19 47 80 00 00 	movabs $0x804719,%rdi
+  800a80:	00 00 00 
+  800a83:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a88:	48 b9 b2 34 80 00 00 	movabs $0x8034b2,%rcx
+  800a8f:	00 00 00 
+  800a92:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a94:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a9b:	eb b5                	jmp    800a52 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a9d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800aa4:	eb ac                	jmp    800a52 <read+0x6a>
+
+0000000000800aa6 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800aa6:	55                   	push   %rbp
+  800aa7:	48 89 e5             	mov    %rsp,%rbp
+  800aaa:	41 57                	push   %r15
+  800aac:	41 56                	push   %r14
+  800aae:	41 55                	push   %r13
+  800ab0:	41 54                	push   %r12
+  800ab2:	53                   	push   %rbx
+  800ab3:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ab7:	48 85 d2             	test   %rdx,%rdx
+  800aba:	74 54                	je     800b10 <readn+0x6a>
+  800abc:	41 89 fd             	mov    %edi,%r13d
+  800abf:	49 89 f6             	mov    %rsi,%r14
+  800ac2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ac5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800aca:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800acf:	49 bf e8 09 80 00 00 	movabs $0x8009e8,%r15
+  800ad6:	00 00 00 
+  800ad9:	4c 89 e2             	mov    %r12,%rdx
+  800adc:	48 29 f2             	sub    %rsi,%rdx
+  800adf:	4c 01 f6             	add    %r14,%rsi
+  800ae2:	44 89 ef             	mov    %r13d,%edi
+  800ae5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ae8:	85 c0                	test   %eax,%eax
+  800aea:	78 20                	js     800b0c <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800aec:	01 c3                	add    %eax,%ebx
+  800aee:	85 c0                	test   %eax,%eax
+  800af0:	74 08                	je     800afa <readn+0x54>
+  800af2:	48 63 f3             	movslq %ebx,%rsi
+  800af5:	4c 39 e6             	cmp    %r12,%rsi
+  800af8:	72 df                	jb     800ad9 <readn+0x33>
+    }
+    return res;
+  800afa:	48 63 c3             	movslq %ebx,%rax
+}
+  800afd:	48 83 c4 08          	add    $0x8,%rsp
+  800b01:	5b                   	pop    %rbx
+  800b02:	41 5c                	pop    %r12
+  800b04:	41 5d                	pop    %r13
+  800b06:	41 5e                	pop    %r14
+  800b08:	41 5f                	pop    %r15
+  800b0a:	5d                   	pop    %rbp
+  800b0b:	c3                   	ret
+        if (inc < 0) return inc;
+  800b0c:	48 98                	cltq
+  800b0e:	eb ed                	jmp    800afd <readn+0x57>
+    int inc = 1, res = 0;
+  800b10:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b15:	eb e3                	jmp    800afa <readn+0x54>
+
+0000000000800b17 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b17:	55                   	push   %rbp
+  800b18:	48 89 e5             	mov    %rsp,%rbp
+  800b1b:	41 56                	push   %r14
+  800b1d:	41 55                	push   %r13
+  800b1f:	41 54                	push   %r12
+  800b21:	53                   	push   %rbx
+  800b22:	48 83 ec 10          	sub    $0x10,%rsp
+  800b26:	89 fb                	mov    %edi,%ebx
+  800b28:	49 89 f4             	mov    %rsi,%r12
+  800b2b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b2e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b32:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800b39:	00 00 00 
+  800b3c:	ff d0                	call   *%rax
+  800b3e:	85 c0                	test   %eax,%eax
+  800b40:	78 47                	js     800b89 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b42:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b46:	41 8b 3e             	mov    (%r14),%edi
+  800b49:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b4d:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800b54:	00 00 00 
+  800b57:	ff d0                	call   *%rax
+  800b59:	85 c0                	test   %eax,%eax
+  800b5b:	78 30                	js     800b8d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b5d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b62:	74 2d                	je     800b91 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b64:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b68:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b6c:	48 85 c0             	test   %rax,%rax
+  800b6f:	74 56                	je     800bc7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b71:	4c 89 ea             	mov    %r13,%rdx
+  800b74:	4c 89 e6             	mov    %r12,%rsi
+  800b77:	4c 89 f7             	mov    %r14,%rdi
+  800b7a:	ff d0                	call   *%rax
+}
+  800b7c:	48 83 c4 10          	add    $0x10,%rsp
+  800b80:	5b                   	pop    %rbx
+  800b81:	41 5c                	pop    %r12
+  800b83:	41 5d                	pop    %r13
+  800b85:	41 5e                	pop    %r14
+  800b87:	5d                   	pop    %rbp
+  800b88:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b89:	48 98                	cltq
+  800b8b:	eb ef                	jmp    800b7c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b8d:	48 98                	cltq
+  800b8f:	eb eb                	jmp    800b7c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b91:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800b98:	00 00 00 
+  800b9b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800ba1:	89 da                	mov    %ebx,%edx
+  800ba3:	48 bf 35 47 80 00 00 	movabs $0x804735,%rdi
+  800baa:	00 00 00 
+  800bad:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bb2:	48 b9 b2 34 80 00 00 	movabs $0x8034b2,%rcx
+  800bb9:	00 00 00 
+  800bbc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bbe:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bc5:	eb b5                	jmp    800b7c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bc7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bce:	eb ac                	jmp    800b7c <write+0x65>
+
+0000000000800bd0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bd0:	55                   	push   %rbp
+  800bd1:	48 89 e5             	mov    %rsp,%rbp
+  800bd4:	41 54                	push   %r12
+  800bd6:	53                   	push   %rbx
+  800bd7:	48 83 ec 10          	sub    $0x10,%rsp
+  800bdb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bdd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800be1:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800be8:	00 00 00 
+  800beb:	ff d0                	call   *%rax
+  800bed:	85 c0                	test   %eax,%eax
+  800bef:	78 3e                	js     800c2f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800bf1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800bf5:	41 8b 3c 24          	mov    (%r12),%edi
+  800bf9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bfd:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800c04:	00 00 00 
+  800c07:	ff d0                	call   *%rax
+  800c09:	85 c0                	test   %eax,%eax
+  800c0b:	78 22                	js     800c2f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c0d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c11:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c15:	48 85 c0             	test   %rax,%rax
+  800c18:	74 0b                	je     800c25 <seek+0x55>
+  800c1a:	89 de                	mov    %ebx,%esi
+  800c1c:	4c 89 e7             	mov    %r12,%rdi
+  800c1f:	ff d0                	call   *%rax
+  800c21:	85 c0                	test   %eax,%eax
+  800c23:	78 0a                	js     800c2f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c25:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c2a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c2f:	48 83 c4 10          	add    $0x10,%rsp
+  800c33:	5b                   	pop    %rbx
+  800c34:	41 5c                	pop    %r12
+  800c36:	5d                   	pop    %rbp
+  800c37:	c3                   	ret
+
+0000000000800c38 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c38:	55                   	push   %rbp
+  800c39:	48 89 e5             	mov    %rsp,%rbp
+  800c3c:	41 55                	push   %r13
+  800c3e:	41 54                	push   %r12
+  800c40:	53                   	push   %rbx
+  800c41:	48 83 ec 18          	sub    $0x18,%rsp
+  800c45:	89 fb                	mov    %edi,%ebx
+  800c47:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c4a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c4e:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800c55:	00 00 00 
+  800c58:	ff d0                	call   *%rax
+  800c5a:	85 c0                	test   %eax,%eax
+  800c5c:	78 38                	js     800c96 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c5e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c62:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c66:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c6a:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800c71:	00 00 00 
+  800c74:	ff d0                	call   *%rax
+  800c76:	85 c0                	test   %eax,%eax
+  800c78:	78 1c                	js     800c96 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c7a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c7f:	74 20                	je     800ca1 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c81:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c85:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c89:	48 85 c0             	test   %rax,%rax
+  800c8c:	74 47                	je     800cd5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c8e:	44 89 e6             	mov    %r12d,%esi
+  800c91:	4c 89 ef             	mov    %r13,%rdi
+  800c94:	ff d0                	call   *%rax
+}
+  800c96:	48 83 c4 18          	add    $0x18,%rsp
+  800c9a:	5b                   	pop    %rbx
+  800c9b:	41 5c                	pop    %r12
+  800c9d:	41 5d                	pop    %r13
+  800c9f:	5d                   	pop    %rbp
+  800ca0:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800ca1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ca8:	00 00 00 
+  800cab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800cb1:	89 da                	mov    %ebx,%edx
+  800cb3:	48 bf f8 46 80 00 00 	movabs $0x8046f8,%rdi
+  800cba:	00 00 00 
+  800cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc2:	48 b9 b2 34 80 00 00 	movabs $0x8034b2,%rcx
+  800cc9:	00 00 00 
+  800ccc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cce:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cd3:	eb c1                	jmp    800c96 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cd5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800cda:	eb ba                	jmp    800c96 <ftruncate+0x5e>
+
+0000000000800cdc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cdc:	55                   	push   %rbp
+  800cdd:	48 89 e5             	mov    %rsp,%rbp
+  800ce0:	41 54                	push   %r12
+  800ce2:	53                   	push   %rbx
+  800ce3:	48 83 ec 10          	sub    $0x10,%rsp
+  800ce7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cea:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800cee:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  800cf5:	00 00 00 
+  800cf8:	ff d0                	call   *%rax
+  800cfa:	85 c0                	test   %eax,%eax
+  800cfc:	78 4e                	js     800d4c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cfe:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d02:	41 8b 3c 24          	mov    (%r12),%edi
+  800d06:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d0a:	48 b8 50 07 80 00 00 	movabs $0x800750,%rax
+  800d11:	00 00 00 
+  800d14:	ff d0                	call   *%rax
+  800d16:	85 c0                	test   %eax,%eax
+  800d18:	78 32                	js     800d4c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d1a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d1e:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d23:	74 30                	je     800d55 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d25:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d28:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d2f:	00 00 00 
+    stat->st_isdir = 0;
+  800d32:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d39:	00 00 00 
+    stat->st_dev = dev;
+  800d3c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d43:	48 89 de             	mov    %rbx,%rsi
+  800d46:	4c 89 e7             	mov    %r12,%rdi
+  800d49:	ff 50 28             	call   *0x28(%rax)
+}
+  800d4c:	48 83 c4 10          	add    $0x10,%rsp
+  800d50:	5b                   	pop    %rbx
+  800d51:	41 5c                	pop    %r12
+  800d53:	5d                   	pop    %rbp
+  800d54:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d55:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d5a:	eb f0                	jmp    800d4c <fstat+0x70>
+
+0000000000800d5c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d5c:	55                   	push   %rbp
+  800d5d:	48 89 e5             	mov    %rsp,%rbp
+  800d60:	41 54                	push   %r12
+  800d62:	53                   	push   %rbx
+  800d63:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d66:	be 00 00 00 00       	mov    $0x0,%esi
+  800d6b:	48 b8 ca 1e 80 00 00 	movabs $0x801eca,%rax
+  800d72:	00 00 00 
+  800d75:	ff d0                	call   *%rax
+  800d77:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d79:	85 c0                	test   %eax,%eax
+  800d7b:	78 25                	js     800da2 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d7d:	4c 89 e6             	mov    %r12,%rsi
+  800d80:	89 c7                	mov    %eax,%edi
+  800d82:	48 b8 dc 0c 80 00 00 	movabs $0x800cdc,%rax
+  800d89:	00 00 00 
+  800d8c:	ff d0                	call   *%rax
+  800d8e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d91:	89 df                	mov    %ebx,%edi
+  800d93:	48 b8 6a 08 80 00 00 	movabs $0x80086a,%rax
+  800d9a:	00 00 00 
+  800d9d:	ff d0                	call   *%rax
+
+    return res;
+  800d9f:	44 89 e3             	mov    %r12d,%ebx
+}
+  800da2:	89 d8                	mov    %ebx,%eax
+  800da4:	5b                   	pop    %rbx
+  800da5:	41 5c                	pop    %r12
+  800da7:	5d                   	pop    %rbp
+  800da8:	c3                   	ret
+
+0000000000800da9 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800da9:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800db0:	00 00 00 
+  800db3:	83 38 00             	cmpl   $0x0,(%rax)
+  800db6:	74 0a                	je     800dc2 <fsenv+0x19>
+    return envid;
+}
+  800db8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dbf:	00 00 
+  800dc1:	c3                   	ret
+fsenv(void) {
+  800dc2:	55                   	push   %rbp
+  800dc3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dc6:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dcb:	48 b8 33 46 80 00 00 	movabs $0x804633,%rax
+  800dd2:	00 00 00 
+  800dd5:	ff d0                	call   *%rax
+  800dd7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dde:	00 00 
+}
+  800de0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800de7:	00 00 
+  800de9:	5d                   	pop    %rbp
+  800dea:	c3                   	ret
+
+0000000000800deb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800deb:	55                   	push   %rbp
+  800dec:	48 89 e5             	mov    %rsp,%rbp
+  800def:	41 54                	push   %r12
+  800df1:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800df2:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800df7:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800dfc:	48 89 de             	mov    %rbx,%rsi
+  800dff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e04:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  800e0b:	00 00 00 
+  800e0e:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e10:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e17:	00 00 00 
+  800e1a:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e20:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e25:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e2a:	48 89 de             	mov    %rbx,%rsi
+  800e2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e32:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  800e39:	00 00 00 
+  800e3c:	ff d0                	call   *%rax
+  800e3e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e40:	85 c0                	test   %eax,%eax
+  800e42:	0f 88 a2 00 00 00    	js     800eea <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e48:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e4f:	00 00 00 
+  800e52:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e58:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e5d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e5f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e64:	49 bc fc 2f 80 00 00 	movabs $0x802ffc,%r12
+  800e6b:	00 00 00 
+  800e6e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e71:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e76:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e79:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800e80:	00 00 00 
+  800e83:	ff d0                	call   *%rax
+  800e85:	89 c7                	mov    %eax,%edi
+  800e87:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e8d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e92:	48 89 da             	mov    %rbx,%rdx
+  800e95:	be 09 00 00 00       	mov    $0x9,%esi
+  800e9a:	48 b8 dd 45 80 00 00 	movabs $0x8045dd,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800ea6:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800eab:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eb0:	be 00 00 00 00       	mov    $0x0,%esi
+  800eb5:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eba:	48 b8 b9 45 80 00 00 	movabs $0x8045b9,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+  800ec6:	89 c3                	mov    %eax,%ebx
+  800ec8:	85 c0                	test   %eax,%eax
+  800eca:	78 25                	js     800ef1 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ecc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ed3:	00 00 00 
+  800ed6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800edc:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ee3:	00 00 
+    return 0;
+  800ee5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800eea:	89 d8                	mov    %ebx,%eax
+  800eec:	5b                   	pop    %rbx
+  800eed:	41 5c                	pop    %r12
+  800eef:	5d                   	pop    %rbp
+  800ef0:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800ef1:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800ef6:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800efb:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f00:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  800f07:	00 00 00 
+  800f0a:	ff d0                	call   *%rax
+        return res;
+  800f0c:	eb dc                	jmp    800eea <fschan_setup+0xff>
+
+0000000000800f0e <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f0e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f15:	00 00 00 
+  800f18:	80 38 00             	cmpb   $0x0,(%rax)
+  800f1b:	74 55                	je     800f72 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f1d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f24:	00 00 00 
+  800f27:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f2d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f32:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f39:	00 00 00 
+  800f3c:	3b 0a                	cmp    (%rdx),%ecx
+  800f3e:	75 01                	jne    800f41 <fschan+0x33>
+}
+  800f40:	c3                   	ret
+fschan(void) {
+  800f41:	55                   	push   %rbp
+  800f42:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f45:	48 b8 eb 0d 80 00 00 	movabs $0x800deb,%rax
+  800f4c:	00 00 00 
+  800f4f:	ff d0                	call   *%rax
+  800f51:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f53:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f58:	85 d2                	test   %edx,%edx
+  800f5a:	78 02                	js     800f5e <fschan+0x50>
+}
+  800f5c:	5d                   	pop    %rbp
+  800f5d:	c3                   	ret
+        fschan_enabled = 0;
+  800f5e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f65:	00 00 00 
+  800f68:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f70:	eb ea                	jmp    800f5c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f77:	c3                   	ret
+
+0000000000800f78 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f78:	55                   	push   %rbp
+  800f79:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f7c:	48 b8 77 06 80 00 00 	movabs $0x800677,%rax
+  800f83:	00 00 00 
+  800f86:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f91:	77 12                	ja     800fa5 <fbuf+0x2d>
+  800f93:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800f97:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800f9e:	00 00 00 
+  800fa1:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fa5:	48 89 d0             	mov    %rdx,%rax
+  800fa8:	5d                   	pop    %rbp
+  800fa9:	c3                   	ret
+
+0000000000800faa <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800faa:	55                   	push   %rbp
+  800fab:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fae:	48 83 c7 40          	add    $0x40,%rdi
+  800fb2:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  800fb9:	00 00 00 
+  800fbc:	ff d0                	call   *%rax
+  800fbe:	84 c0                	test   %al,%al
+  800fc0:	75 02                	jne    800fc4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fc2:	5d                   	pop    %rbp
+  800fc3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fc4:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  800fcb:	00 00 00 
+  800fce:	ff d0                	call   *%rax
+  800fd0:	89 c7                	mov    %eax,%edi
+  800fd2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fd8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fdd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fe2:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fe7:	48 b8 dd 45 80 00 00 	movabs $0x8045dd,%rax
+  800fee:	00 00 00 
+  800ff1:	ff d0                	call   *%rax
+}
+  800ff3:	eb cd                	jmp    800fc2 <fschan_publish+0x18>
+
+0000000000800ff5 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  800ff5:	55                   	push   %rbp
+  800ff6:	48 89 e5             	mov    %rsp,%rbp
+  800ff9:	41 57                	push   %r15
+  800ffb:	41 56                	push   %r14
+  800ffd:	41 55                	push   %r13
+  800fff:	41 54                	push   %r12
+  801001:	53                   	push   %rbx
+  801002:	48 83 ec 48          	sub    $0x48,%rsp
+  801006:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80100a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80100e:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801011:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801015:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801018:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80101f:	00 00 00 
+  801022:	8b 02                	mov    (%rdx),%eax
+  801024:	83 c0 01             	add    $0x1,%eax
+  801027:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80102c:	0f 44 c1             	cmove  %ecx,%eax
+  80102f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801031:	4d 85 c0             	test   %r8,%r8
+  801034:	74 2c                	je     801062 <fschan_rw+0x6d>
+  801036:	45 89 ce             	mov    %r9d,%r14d
+  801039:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801040:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801044:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80104a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801051:	00 
+  801052:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801058:	b8 01 00 00 00       	mov    $0x1,%eax
+  80105d:	e9 41 01 00 00       	jmp    8011a3 <fschan_rw+0x1ae>
+  801062:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801066:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80106a:	e9 9c 01 00 00       	jmp    80120b <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80106f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801073:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801076:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801079:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80107c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801080:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801084:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801088:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80108c:	48 89 da             	mov    %rbx,%rdx
+  80108f:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  801096:	00 00 00 
+  801099:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80109b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80109f:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  8010a6:	00 00 00 
+  8010a9:	ff d0                	call   *%rax
+            queued += blk;
+  8010ab:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010ae:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010b2:	4d 39 fc             	cmp    %r15,%r12
+  8010b5:	73 6b                	jae    801122 <fschan_rw+0x12d>
+  8010b7:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010bb:	77 65                	ja     801122 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010c1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010c5:	48 b8 11 30 80 00 00 	movabs $0x803011,%rax
+  8010cc:	00 00 00 
+  8010cf:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010d1:	4c 89 fb             	mov    %r15,%rbx
+  8010d4:	4c 29 e3             	sub    %r12,%rbx
+  8010d7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010dc:	48 39 d3             	cmp    %rdx,%rbx
+  8010df:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010e3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010e7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010eb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010ef:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010f2:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010f4:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8010fb:	00 00 00 
+  8010fe:	8b 09                	mov    (%rcx),%ecx
+  801100:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801103:	83 fe 03             	cmp    $0x3,%esi
+  801106:	0f 85 63 ff ff ff    	jne    80106f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80110c:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801110:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801113:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801116:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801119:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80111d:	e9 79 ff ff ff       	jmp    80109b <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801122:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801126:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80112d:	48 89 df             	mov    %rbx,%rdi
+  801130:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  801137:	00 00 00 
+  80113a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80113c:	48 89 df             	mov    %rbx,%rdi
+  80113f:	48 b8 62 30 80 00 00 	movabs $0x803062,%rax
+  801146:	00 00 00 
+  801149:	ff d0                	call   *%rax
+  80114b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80114f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801153:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801157:	75 25                	jne    80117e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801159:	8b 40 04             	mov    0x4(%rax),%eax
+  80115c:	85 c0                	test   %eax,%eax
+  80115e:	0f 88 86 00 00 00    	js     8011ea <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801164:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801168:	74 5b                	je     8011c5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80116a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80116e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801172:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801176:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80117a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80117e:	48 89 df             	mov    %rbx,%rdi
+  801181:	48 b8 89 30 80 00 00 	movabs $0x803089,%rax
+  801188:	00 00 00 
+  80118b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80118d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801191:	83 f0 01             	xor    $0x1,%eax
+  801194:	4d 39 fc             	cmp    %r15,%r12
+  801197:	0f 92 c2             	setb   %dl
+  80119a:	84 c2                	test   %al,%dl
+  80119c:	75 05                	jne    8011a3 <fschan_rw+0x1ae>
+  80119e:	45 85 ed             	test   %r13d,%r13d
+  8011a1:	74 50                	je     8011f3 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011a3:	4d 39 fc             	cmp    %r15,%r12
+  8011a6:	0f 92 c1             	setb   %cl
+  8011a9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011ad:	0f 96 c2             	setbe  %dl
+  8011b0:	84 d1                	test   %dl,%cl
+  8011b2:	0f 84 6a ff ff ff    	je     801122 <fschan_rw+0x12d>
+  8011b8:	84 c0                	test   %al,%al
+  8011ba:	0f 85 fd fe ff ff    	jne    8010bd <fschan_rw+0xc8>
+  8011c0:	e9 5d ff ff ff       	jmp    801122 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011c5:	48 63 d0             	movslq %eax,%rdx
+  8011c8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011cc:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011d0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011d4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011d8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011dc:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8011e3:	00 00 00 
+  8011e6:	ff d0                	call   *%rax
+  8011e8:	eb 80                	jmp    80116a <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011ea:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011ed:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011f1:	eb 8b                	jmp    80117e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011f3:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8011f8:	0f 85 68 fe ff ff    	jne    801066 <fschan_rw+0x71>
+  8011fe:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  801201:	85 c0                	test   %eax,%eax
+  801203:	0f 84 5d fe ff ff    	je     801066 <fschan_rw+0x71>
+  801209:	48 98                	cltq
+}
+  80120b:	48 83 c4 48          	add    $0x48,%rsp
+  80120f:	5b                   	pop    %rbx
+  801210:	41 5c                	pop    %r12
+  801212:	41 5d                	pop    %r13
+  801214:	41 5e                	pop    %r14
+  801216:	41 5f                	pop    %r15
+  801218:	5d                   	pop    %rbp
+  801219:	c3                   	ret
+
+000000000080121a <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80121a:	55                   	push   %rbp
+  80121b:	48 89 e5             	mov    %rsp,%rbp
+  80121e:	41 56                	push   %r14
+  801220:	41 55                	push   %r13
+  801222:	41 54                	push   %r12
+  801224:	53                   	push   %rbx
+  801225:	48 83 ec 10          	sub    $0x10,%rsp
+  801229:	49 89 fe             	mov    %rdi,%r14
+  80122c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80122f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801233:	48 29 f3             	sub    %rsi,%rbx
+  801236:	48 39 d3             	cmp    %rdx,%rbx
+  801239:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80123d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801244:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801245:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80124a:	49 bd 93 2e 80 00 00 	movabs $0x802e93,%r13
+  801251:	00 00 00 
+  801254:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80125b:	76 1e                	jbe    80127b <mmap_fault+0x61>
+  80125d:	4c 01 e7             	add    %r12,%rdi
+  801260:	41 ff d5             	call   *%r13
+  801263:	84 c0                	test   %al,%al
+  801265:	75 14                	jne    80127b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801267:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80126b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801272:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801276:	48 39 df             	cmp    %rbx,%rdi
+  801279:	72 e2                	jb     80125d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80127b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801282:	00 00 00 
+  801285:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80128c:	00 00 00 
+  80128f:	4c 89 f0             	mov    %r14,%rax
+  801292:	48 29 d0             	sub    %rdx,%rax
+  801295:	48 c1 f8 03          	sar    $0x3,%rax
+  801299:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012a0:	aa aa aa 
+  8012a3:	48 0f af c2          	imul   %rdx,%rax
+  8012a7:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012ab:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012b0:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012b4:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012b6:	44 89 e0             	mov    %r12d,%eax
+  8012b9:	41 03 46 10          	add    0x10(%r14),%eax
+  8012bd:	41 2b 06             	sub    (%r14),%eax
+  8012c0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012c3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012c7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012cb:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012cf:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012d2:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  8012d9:	00 00 00 
+  8012dc:	ff d0                	call   *%rax
+  8012de:	89 c7                	mov    %eax,%edi
+  8012e0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012e6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012eb:	48 89 da             	mov    %rbx,%rdx
+  8012ee:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012f3:	48 b8 dd 45 80 00 00 	movabs $0x8045dd,%rax
+  8012fa:	00 00 00 
+  8012fd:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8012ff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801304:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801308:	4c 89 e6             	mov    %r12,%rsi
+  80130b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801310:	48 b8 b9 45 80 00 00 	movabs $0x8045b9,%rax
+  801317:	00 00 00 
+  80131a:	ff d0                	call   *%rax
+  80131c:	48 98                	cltq
+}
+  80131e:	48 83 c4 10          	add    $0x10,%rsp
+  801322:	5b                   	pop    %rbx
+  801323:	41 5c                	pop    %r12
+  801325:	41 5d                	pop    %r13
+  801327:	41 5e                	pop    %r14
+  801329:	5d                   	pop    %rbp
+  80132a:	c3                   	ret
+
+000000000080132b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80132b:	48 8b 37             	mov    (%rdi),%rsi
+  80132e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801335:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80133c:	00 00 00 
+  80133f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801344:	eb 0f                	jmp    801355 <mmap_pgfault+0x2a>
+  801346:	c3                   	ret
+  801347:	48 83 c1 01          	add    $0x1,%rcx
+  80134b:	48 83 c2 18          	add    $0x18,%rdx
+  80134f:	48 83 f9 20          	cmp    $0x20,%rcx
+  801353:	74 6e                	je     8013c3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801355:	48 8b 02             	mov    (%rdx),%rax
+  801358:	48 83 e8 01          	sub    $0x1,%rax
+  80135c:	48 39 f0             	cmp    %rsi,%rax
+  80135f:	73 e6                	jae    801347 <mmap_pgfault+0x1c>
+  801361:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801365:	73 e0                	jae    801347 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801367:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80136b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801370:	f6 c2 01             	test   $0x1,%dl
+  801373:	75 d1                	jne    801346 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801375:	f6 c2 02             	test   $0x2,%dl
+  801378:	74 1a                	je     801394 <mmap_pgfault+0x69>
+  80137a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80137e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801383:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80138a:	00 00 00 
+  80138d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  801392:	74 35                	je     8013c9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  801394:	55                   	push   %rbp
+  801395:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801398:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80139c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013a3:	00 00 00 
+  8013a6:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013aa:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013af:	48 b8 1a 12 80 00 00 	movabs $0x80121a,%rax
+  8013b6:	00 00 00 
+  8013b9:	ff d0                	call   *%rax
+  8013bb:	48 85 c0             	test   %rax,%rax
+  8013be:	0f 9f c0             	setg   %al
+}
+  8013c1:	5d                   	pop    %rbp
+  8013c2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013c8:	c3                   	ret
+}
+  8013c9:	c3                   	ret
+
+00000000008013ca <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013ca:	55                   	push   %rbp
+  8013cb:	48 89 e5             	mov    %rsp,%rbp
+  8013ce:	41 54                	push   %r12
+  8013d0:	53                   	push   %rbx
+  8013d1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013d4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013db:	00 00 00 
+  8013de:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013e3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013e7:	74 15                	je     8013fe <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013e9:	48 83 c3 01          	add    $0x1,%rbx
+  8013ed:	48 83 c0 18          	add    $0x18,%rax
+  8013f1:	48 83 fb 20          	cmp    $0x20,%rbx
+  8013f5:	75 ec                	jne    8013e3 <mmap_alloc+0x19>
+    return NULL;
+  8013f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013fc:	eb 52                	jmp    801450 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8013fe:	4c 89 e7             	mov    %r12,%rdi
+  801401:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  801408:	00 00 00 
+  80140b:	ff d0                	call   *%rax
+  80140d:	41 89 c1             	mov    %eax,%r9d
+  801410:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801417:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80141b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801421:	ba 00 00 00 00       	mov    $0x0,%edx
+  801426:	4c 89 e6             	mov    %r12,%rsi
+  801429:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142e:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  801435:	00 00 00 
+  801438:	ff d0                	call   *%rax
+  80143a:	85 c0                	test   %eax,%eax
+  80143c:	78 17                	js     801455 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80143e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801442:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801449:	00 00 00 
+  80144c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801450:	5b                   	pop    %rbx
+  801451:	41 5c                	pop    %r12
+  801453:	5d                   	pop    %rbp
+  801454:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80145a:	eb f4                	jmp    801450 <mmap_alloc+0x86>
+
+000000000080145c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80145c:	55                   	push   %rbp
+  80145d:	48 89 e5             	mov    %rsp,%rbp
+  801460:	41 56                	push   %r14
+  801462:	41 55                	push   %r13
+  801464:	41 54                	push   %r12
+  801466:	53                   	push   %rbx
+  801467:	48 83 ec 10          	sub    $0x10,%rsp
+  80146b:	41 89 fc             	mov    %edi,%r12d
+  80146e:	49 89 f5             	mov    %rsi,%r13
+  801471:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801474:	48 89 f0             	mov    %rsi,%rax
+  801477:	48 09 d0             	or     %rdx,%rax
+  80147a:	75 0d                	jne    801489 <fsipc+0x2d>
+  80147c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80147f:	83 f8 04             	cmp    $0x4,%eax
+  801482:	76 7d                	jbe    801501 <fsipc+0xa5>
+  801484:	83 ff 0d             	cmp    $0xd,%edi
+  801487:	74 78                	je     801501 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  801489:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  801490:	00 00 00 
+  801493:	ff d0                	call   *%rax
+  801495:	89 c7                	mov    %eax,%edi
+  801497:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80149e:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014a5:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014ac:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014b2:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014b9:	00 00 00 
+  8014bc:	44 89 e6             	mov    %r12d,%esi
+  8014bf:	48 b8 dd 45 80 00 00 	movabs $0x8045dd,%rax
+  8014c6:	00 00 00 
+  8014c9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014cb:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014d2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014d8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014dc:	4c 89 ee             	mov    %r13,%rsi
+  8014df:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e4:	48 b8 b9 45 80 00 00 	movabs $0x8045b9,%rax
+  8014eb:	00 00 00 
+  8014ee:	ff d0                	call   *%rax
+  8014f0:	89 c3                	mov    %eax,%ebx
+}
+  8014f2:	89 d8                	mov    %ebx,%eax
+  8014f4:	48 83 c4 10          	add    $0x10,%rsp
+  8014f8:	5b                   	pop    %rbx
+  8014f9:	41 5c                	pop    %r12
+  8014fb:	41 5d                	pop    %r13
+  8014fd:	41 5e                	pop    %r14
+  8014ff:	5d                   	pop    %rbp
+  801500:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801501:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  801508:	00 00 00 
+  80150b:	ff d0                	call   *%rax
+  80150d:	49 89 c6             	mov    %rax,%r14
+  801510:	48 85 c0             	test   %rax,%rax
+  801513:	0f 84 70 ff ff ff    	je     801489 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801519:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80151d:	48 b8 11 30 80 00 00 	movabs $0x803011,%rax
+  801524:	00 00 00 
+  801527:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801529:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80152c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801533:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801537:	ba 10 00 00 00       	mov    $0x10,%edx
+  80153c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801543:	00 00 00 
+  801546:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  80154d:	00 00 00 
+  801550:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801552:	4c 89 f7             	mov    %r14,%rdi
+  801555:	48 b8 aa 0f 80 00 00 	movabs $0x800faa,%rax
+  80155c:	00 00 00 
+  80155f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801561:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801568:	4c 89 f7             	mov    %r14,%rdi
+  80156b:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  801572:	00 00 00 
+  801575:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801577:	4c 89 f7             	mov    %r14,%rdi
+  80157a:	48 b8 62 30 80 00 00 	movabs $0x803062,%rax
+  801581:	00 00 00 
+  801584:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801586:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  801589:	41 83 fc 05          	cmp    $0x5,%r12d
+  80158d:	75 04                	jne    801593 <fsipc+0x137>
+  80158f:	85 db                	test   %ebx,%ebx
+  801591:	79 14                	jns    8015a7 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  801593:	4c 89 f7             	mov    %r14,%rdi
+  801596:	48 b8 89 30 80 00 00 	movabs $0x803089,%rax
+  80159d:	00 00 00 
+  8015a0:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015a2:	e9 4b ff ff ff       	jmp    8014f2 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015a7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015ab:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015b0:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015b7:	00 00 00 
+  8015ba:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8015c1:	00 00 00 
+  8015c4:	ff d0                	call   *%rax
+  8015c6:	eb cb                	jmp    801593 <fsipc+0x137>
+
+00000000008015c8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015c8:	55                   	push   %rbp
+  8015c9:	48 89 e5             	mov    %rsp,%rbp
+  8015cc:	41 57                	push   %r15
+  8015ce:	41 56                	push   %r14
+  8015d0:	41 55                	push   %r13
+  8015d2:	41 54                	push   %r12
+  8015d4:	53                   	push   %rbx
+  8015d5:	48 83 ec 18          	sub    $0x18,%rsp
+  8015d9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015dd:	49 89 f6             	mov    %rsi,%r14
+  8015e0:	49 89 d4             	mov    %rdx,%r12
+  8015e3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015e6:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  8015ed:	00 00 00 
+  8015f0:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015f2:	48 85 c0             	test   %rax,%rax
+  8015f5:	0f 85 96 00 00 00    	jne    801691 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8015fb:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  801602:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801603:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80160a:	00 00 00 
+    while (n) {
+  80160d:	4d 85 e4             	test   %r12,%r12
+  801610:	74 79                	je     80168b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801612:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801617:	49 39 dc             	cmp    %rbx,%r12
+  80161a:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80161e:	48 89 da             	mov    %rbx,%rdx
+  801621:	4c 89 f6             	mov    %r14,%rsi
+  801624:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80162b:	00 00 00 
+  80162e:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  801635:	00 00 00 
+  801638:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80163a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80163e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801641:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801644:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801647:	44 01 e8             	add    %r13d,%eax
+  80164a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80164e:	41 0f 44 c5          	cmove  %r13d,%eax
+  801652:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801656:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80165a:	48 89 da             	mov    %rbx,%rdx
+  80165d:	be 00 00 00 00       	mov    $0x0,%esi
+  801662:	bf 04 00 00 00       	mov    $0x4,%edi
+  801667:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  80166e:	00 00 00 
+  801671:	ff d0                	call   *%rax
+        if (res < 0)
+  801673:	85 c0                	test   %eax,%eax
+  801675:	78 4a                	js     8016c1 <devfile_write_direct+0xf9>
+        buf += res;
+  801677:	48 98                	cltq
+  801679:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80167c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801680:	49 29 c4             	sub    %rax,%r12
+  801683:	75 8d                	jne    801612 <devfile_write_direct+0x4a>
+    return write;
+  801685:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801689:	eb 27                	jmp    8016b2 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80168b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80168f:	eb f4                	jmp    801685 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801691:	45 89 e9             	mov    %r13d,%r9d
+  801694:	4d 89 e0             	mov    %r12,%r8
+  801697:	4c 89 f1             	mov    %r14,%rcx
+  80169a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80169f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016a3:	48 89 c7             	mov    %rax,%rdi
+  8016a6:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  8016ad:	00 00 00 
+  8016b0:	ff d0                	call   *%rax
+}
+  8016b2:	48 83 c4 18          	add    $0x18,%rsp
+  8016b6:	5b                   	pop    %rbx
+  8016b7:	41 5c                	pop    %r12
+  8016b9:	41 5d                	pop    %r13
+  8016bb:	41 5e                	pop    %r14
+  8016bd:	41 5f                	pop    %r15
+  8016bf:	5d                   	pop    %rbp
+  8016c0:	c3                   	ret
+            return res;
+  8016c1:	48 98                	cltq
+  8016c3:	eb ed                	jmp    8016b2 <devfile_write_direct+0xea>
+
+00000000008016c5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016c5:	55                   	push   %rbp
+  8016c6:	48 89 e5             	mov    %rsp,%rbp
+  8016c9:	41 54                	push   %r12
+  8016cb:	53                   	push   %rbx
+  8016cc:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016cf:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  8016d6:	00 00 00 
+  8016d9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016db:	48 85 c0             	test   %rax,%rax
+  8016de:	74 71                	je     801751 <fbuf_flush+0x8c>
+  8016e0:	48 89 c3             	mov    %rax,%rbx
+  8016e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016ec:	75 05                	jne    8016f3 <fbuf_flush+0x2e>
+}
+  8016ee:	5b                   	pop    %rbx
+  8016ef:	41 5c                	pop    %r12
+  8016f1:	5d                   	pop    %rbp
+  8016f2:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016f3:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8016f6:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8016fa:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801701:	00 00 00 
+  801704:	48 89 de             	mov    %rbx,%rsi
+  801707:	48 29 c6             	sub    %rax,%rsi
+  80170a:	48 c1 fe 03          	sar    $0x3,%rsi
+  80170e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801715:	aa aa aa 
+  801718:	48 0f af f0          	imul   %rax,%rsi
+  80171c:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801720:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801725:	48 01 c6             	add    %rax,%rsi
+  801728:	4c 89 e7             	mov    %r12,%rdi
+  80172b:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  801732:	00 00 00 
+  801735:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801737:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80173b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801742:	00 
+    return res < 0 ? res : 0;
+  801743:	48 85 c0             	test   %rax,%rax
+  801746:	ba 00 00 00 00       	mov    $0x0,%edx
+  80174b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80174f:	eb 9d                	jmp    8016ee <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801751:	b8 00 00 00 00       	mov    $0x0,%eax
+  801756:	eb 96                	jmp    8016ee <fbuf_flush+0x29>
+
+0000000000801758 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801758:	55                   	push   %rbp
+  801759:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80175c:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801763:	00 00 00 
+  801766:	ff d0                	call   *%rax
+}
+  801768:	5d                   	pop    %rbp
+  801769:	c3                   	ret
+
+000000000080176a <devfile_write>:
+    if (!fd || !buf)
+  80176a:	48 85 ff             	test   %rdi,%rdi
+  80176d:	0f 84 d3 01 00 00    	je     801946 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801773:	55                   	push   %rbp
+  801774:	48 89 e5             	mov    %rsp,%rbp
+  801777:	41 57                	push   %r15
+  801779:	41 56                	push   %r14
+  80177b:	41 55                	push   %r13
+  80177d:	41 54                	push   %r12
+  80177f:	53                   	push   %rbx
+  801780:	48 83 ec 08          	sub    $0x8,%rsp
+  801784:	49 89 fc             	mov    %rdi,%r12
+  801787:	49 89 f6             	mov    %rsi,%r14
+  80178a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80178d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801792:	48 85 f6             	test   %rsi,%rsi
+  801795:	0f 84 9c 01 00 00    	je     801937 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80179b:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  8017a2:	00 00 00 
+  8017a5:	ff d0                	call   *%rax
+  8017a7:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017aa:	48 85 c0             	test   %rax,%rax
+  8017ad:	0f 84 a2 00 00 00    	je     801855 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017b3:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017b8:	4c 89 e7             	mov    %r12,%rdi
+  8017bb:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  8017c2:	00 00 00 
+  8017c5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017c7:	83 f8 02             	cmp    $0x2,%eax
+  8017ca:	0f 8f 85 00 00 00    	jg     801855 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017d0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017d7:	00 00 00 
+  8017da:	4d 89 ef             	mov    %r13,%r15
+  8017dd:	49 29 c7             	sub    %rax,%r15
+  8017e0:	49 c1 ff 03          	sar    $0x3,%r15
+  8017e4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017eb:	aa aa aa 
+  8017ee:	4c 0f af f8          	imul   %rax,%r15
+  8017f2:	49 c1 e7 0e          	shl    $0xe,%r15
+  8017f6:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8017fb:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8017fe:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801803:	0f 84 d7 00 00 00    	je     8018e0 <devfile_write+0x176>
+  801809:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80180d:	89 c2                	mov    %eax,%edx
+  80180f:	41 03 55 0c          	add    0xc(%r13),%edx
+  801813:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801818:	75 0f                	jne    801829 <devfile_write+0xbf>
+  80181a:	48 01 d8             	add    %rbx,%rax
+  80181d:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801823:	0f 86 92 00 00 00    	jbe    8018bb <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801829:	4c 89 e7             	mov    %r12,%rdi
+  80182c:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801833:	00 00 00 
+  801836:	ff d0                	call   *%rax
+  801838:	85 c0                	test   %eax,%eax
+  80183a:	78 52                	js     80188e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80183c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801843:	77 7f                	ja     8018c4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801845:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80184a:	0f 85 c2 00 00 00    	jne    801912 <devfile_write+0x1a8>
+  801850:	e9 94 00 00 00       	jmp    8018e9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801855:	4c 89 e7             	mov    %r12,%rdi
+  801858:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  80185f:	00 00 00 
+  801862:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801864:	85 c0                	test   %eax,%eax
+  801866:	79 07                	jns    80186f <devfile_write+0x105>
+  801868:	48 98                	cltq
+  80186a:	e9 c8 00 00 00       	jmp    801937 <devfile_write+0x1cd>
+  80186f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801874:	48 89 da             	mov    %rbx,%rdx
+  801877:	4c 89 f6             	mov    %r14,%rsi
+  80187a:	4c 89 e7             	mov    %r12,%rdi
+  80187d:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  801884:	00 00 00 
+  801887:	ff d0                	call   *%rax
+  801889:	e9 a9 00 00 00       	jmp    801937 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80188e:	48 98                	cltq
+  801890:	e9 a2 00 00 00       	jmp    801937 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801895:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80189a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80189f:	4c 89 fe             	mov    %r15,%rsi
+  8018a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018a7:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  8018ae:	00 00 00 
+  8018b1:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018b3:	85 c0                	test   %eax,%eax
+  8018b5:	79 45                	jns    8018fc <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018b7:	48 98                	cltq
+  8018b9:	eb 7c                	jmp    801937 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018bb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018c2:	76 4e                	jbe    801912 <devfile_write+0x1a8>
+  8018c4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018c9:	48 89 da             	mov    %rbx,%rdx
+  8018cc:	4c 89 f6             	mov    %r14,%rsi
+  8018cf:	4c 89 e7             	mov    %r12,%rdi
+  8018d2:	48 b8 c8 15 80 00 00 	movabs $0x8015c8,%rax
+  8018d9:	00 00 00 
+  8018dc:	ff d0                	call   *%rax
+  8018de:	eb 57                	jmp    801937 <devfile_write+0x1cd>
+  8018e0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018e7:	77 db                	ja     8018c4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018e9:	4c 89 ff             	mov    %r15,%rdi
+  8018ec:	48 b8 93 2e 80 00 00 	movabs $0x802e93,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+  8018f8:	84 c0                	test   %al,%al
+  8018fa:	74 99                	je     801895 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8018fc:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  801901:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801906:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80190a:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801911:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801912:	4c 89 ff             	mov    %r15,%rdi
+  801915:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801919:	48 89 da             	mov    %rbx,%rdx
+  80191c:	4c 89 f6             	mov    %r14,%rsi
+  80191f:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  801926:	00 00 00 
+  801929:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80192b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80192f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801934:	48 89 d8             	mov    %rbx,%rax
+}
+  801937:	48 83 c4 08          	add    $0x8,%rsp
+  80193b:	5b                   	pop    %rbx
+  80193c:	41 5c                	pop    %r12
+  80193e:	41 5d                	pop    %r13
+  801940:	41 5e                	pop    %r14
+  801942:	41 5f                	pop    %r15
+  801944:	5d                   	pop    %rbp
+  801945:	c3                   	ret
+        return E_INVAL;
+  801946:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80194b:	c3                   	ret
+
+000000000080194c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80194c:	55                   	push   %rbp
+  80194d:	48 89 e5             	mov    %rsp,%rbp
+  801950:	41 54                	push   %r12
+  801952:	53                   	push   %rbx
+  801953:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801956:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  80195d:	00 00 00 
+  801960:	ff d0                	call   *%rax
+  801962:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801965:	48 89 df             	mov    %rbx,%rdi
+  801968:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  80196f:	00 00 00 
+  801972:	ff d0                	call   *%rax
+  801974:	48 85 c0             	test   %rax,%rax
+  801977:	74 17                	je     801990 <devfile_flush+0x44>
+  801979:	48 89 df             	mov    %rbx,%rdi
+  80197c:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  801983:	00 00 00 
+  801986:	ff d0                	call   *%rax
+  801988:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  80198f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801990:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801993:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80199a:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80199c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8019a6:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019ab:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  8019b2:	00 00 00 
+  8019b5:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019b7:	45 85 e4             	test   %r12d,%r12d
+  8019ba:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019be:	5b                   	pop    %rbx
+  8019bf:	41 5c                	pop    %r12
+  8019c1:	5d                   	pop    %rbp
+  8019c2:	c3                   	ret
+
+00000000008019c3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019c3:	55                   	push   %rbp
+  8019c4:	48 89 e5             	mov    %rsp,%rbp
+  8019c7:	41 57                	push   %r15
+  8019c9:	41 56                	push   %r14
+  8019cb:	41 55                	push   %r13
+  8019cd:	41 54                	push   %r12
+  8019cf:	53                   	push   %rbx
+  8019d0:	48 83 ec 38          	sub    $0x38,%rsp
+  8019d4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019d8:	49 89 f7             	mov    %rsi,%r15
+  8019db:	48 89 d3             	mov    %rdx,%rbx
+  8019de:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019e1:	48 b8 0e 0f 80 00 00 	movabs $0x800f0e,%rax
+  8019e8:	00 00 00 
+  8019eb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019ed:	48 85 c0             	test   %rax,%rax
+  8019f0:	75 20                	jne    801a12 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019f2:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8019f7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8019fe:	00 
+    while (n) {
+  8019ff:	48 85 db             	test   %rbx,%rbx
+  801a02:	0f 85 df 00 00 00    	jne    801ae7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a08:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a0c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a10:	eb 21                	jmp    801a33 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a12:	45 89 f1             	mov    %r14d,%r9d
+  801a15:	49 89 d8             	mov    %rbx,%r8
+  801a18:	4c 89 f9             	mov    %r15,%rcx
+  801a1b:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a20:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a24:	48 89 c7             	mov    %rax,%rdi
+  801a27:	48 b8 f5 0f 80 00 00 	movabs $0x800ff5,%rax
+  801a2e:	00 00 00 
+  801a31:	ff d0                	call   *%rax
+}
+  801a33:	48 83 c4 38          	add    $0x38,%rsp
+  801a37:	5b                   	pop    %rbx
+  801a38:	41 5c                	pop    %r12
+  801a3a:	41 5d                	pop    %r13
+  801a3c:	41 5e                	pop    %r14
+  801a3e:	41 5f                	pop    %r15
+  801a40:	5d                   	pop    %rbp
+  801a41:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a42:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a46:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a4c:	75 1e                	jne    801a6c <devfile_read_direct+0xa9>
+  801a4e:	e9 e2 00 00 00       	jmp    801b35 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a53:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a57:	eb da                	jmp    801a33 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a59:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a5d:	0f 85 d0 01 00 00    	jne    801c33 <devfile_read_direct+0x270>
+            map = 0;
+  801a63:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a67:	eb 03                	jmp    801a6c <devfile_read_direct+0xa9>
+  801a69:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a6c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a71:	48 39 d3             	cmp    %rdx,%rbx
+  801a74:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a78:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a7c:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a7f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a86:	00 00 00 
+  801a89:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a8b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a8f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a93:	be 00 00 00 00       	mov    $0x0,%esi
+  801a98:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a9d:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+        if (res <= 0)
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	0f 8e 63 01 00 00    	jle    801c14 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801ab1:	4c 63 e0             	movslq %eax,%r12
+  801ab4:	4c 89 e2             	mov    %r12,%rdx
+  801ab7:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801abe:	00 00 00 
+  801ac1:	4c 89 ff             	mov    %r15,%rdi
+  801ac4:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  801acb:	00 00 00 
+  801ace:	ff d0                	call   *%rax
+        buf += res;
+  801ad0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ad3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ad6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801ada:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801ade:	48 85 db             	test   %rbx,%rbx
+  801ae1:	0f 84 25 ff ff ff    	je     801a0c <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801ae7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801aea:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801aee:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801af2:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801af6:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801afd:	0f 97 c2             	seta   %dl
+  801b00:	20 c2                	and    %al,%dl
+  801b02:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b05:	0f 84 5e ff ff ff    	je     801a69 <devfile_read_direct+0xa6>
+  801b0b:	4c 89 fa             	mov    %r15,%rdx
+  801b0e:	4d 89 fd             	mov    %r15,%r13
+  801b11:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b18:	0f 85 4e ff ff ff    	jne    801a6c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b1e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b22:	0f 84 1a ff ff ff    	je     801a42 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b28:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b2f:	0f 85 37 ff ff ff    	jne    801a6c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b35:	48 89 d8             	mov    %rbx,%rax
+  801b38:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b3e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b43:	48 39 c8             	cmp    %rcx,%rax
+  801b46:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b4a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b4e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b52:	49 89 d4             	mov    %rdx,%r12
+  801b55:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b59:	48 b8 34 2e 80 00 00 	movabs $0x802e34,%rax
+  801b60:	00 00 00 
+  801b63:	ff d0                	call   *%rax
+  801b65:	a8 40                	test   $0x40,%al
+  801b67:	0f 85 b9 00 00 00    	jne    801c26 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b6d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b74:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b78:	49 39 c5             	cmp    %rax,%r13
+  801b7b:	72 d8                	jb     801b55 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b7d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b81:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b88:	00 00 00 
+  801b8b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b8f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b92:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b94:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801b98:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801b9c:	48 b8 a9 0d 80 00 00 	movabs $0x800da9,%rax
+  801ba3:	00 00 00 
+  801ba6:	ff d0                	call   *%rax
+  801ba8:	89 c7                	mov    %eax,%edi
+  801baa:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bb0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bb5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bbc:	00 00 00 
+  801bbf:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bc4:	48 b8 dd 45 80 00 00 	movabs $0x8045dd,%rax
+  801bcb:	00 00 00 
+  801bce:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bd0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bd5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bd9:	4c 89 fe             	mov    %r15,%rsi
+  801bdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be1:	48 b8 b9 45 80 00 00 	movabs $0x8045b9,%rax
+  801be8:	00 00 00 
+  801beb:	ff d0                	call   *%rax
+  801bed:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801bf0:	48 85 d2             	test   %rdx,%rdx
+  801bf3:	0f 84 5a fe ff ff    	je     801a53 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801bf9:	0f 8e 5a fe ff ff    	jle    801a59 <devfile_read_direct+0x96>
+                buf += res;
+  801bff:	48 98                	cltq
+  801c01:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c04:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c07:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c0b:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c0f:	e9 ca fe ff ff       	jmp    801ade <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c14:	41 89 c5             	mov    %eax,%r13d
+  801c17:	48 98                	cltq
+  801c19:	45 85 ed             	test   %r13d,%r13d
+  801c1c:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c21:	e9 0d fe ff ff       	jmp    801a33 <devfile_read_direct+0x70>
+            map = 0;
+  801c26:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c2a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c2e:	e9 39 fe ff ff       	jmp    801a6c <devfile_read_direct+0xa9>
+  801c33:	48 89 d0             	mov    %rdx,%rax
+  801c36:	e9 f8 fd ff ff       	jmp    801a33 <devfile_read_direct+0x70>
+
+0000000000801c3b <devfile_read>:
+    if (!fd || !buf)
+  801c3b:	48 85 ff             	test   %rdi,%rdi
+  801c3e:	0f 84 21 02 00 00    	je     801e65 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c44:	55                   	push   %rbp
+  801c45:	48 89 e5             	mov    %rsp,%rbp
+  801c48:	41 57                	push   %r15
+  801c4a:	41 56                	push   %r14
+  801c4c:	41 55                	push   %r13
+  801c4e:	41 54                	push   %r12
+  801c50:	53                   	push   %rbx
+  801c51:	48 83 ec 28          	sub    $0x28,%rsp
+  801c55:	48 89 fb             	mov    %rdi,%rbx
+  801c58:	49 89 f4             	mov    %rsi,%r12
+  801c5b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c5e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c63:	48 85 f6             	test   %rsi,%rsi
+  801c66:	74 4b                	je     801cb3 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c68:	48 b8 78 0f 80 00 00 	movabs $0x800f78,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+  801c74:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c77:	48 85 c0             	test   %rax,%rax
+  801c7a:	74 22                	je     801c9e <devfile_read+0x63>
+  801c7c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c83:	77 19                	ja     801c9e <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c85:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c8a:	48 89 df             	mov    %rbx,%rdi
+  801c8d:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  801c94:	00 00 00 
+  801c97:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c99:	83 f8 02             	cmp    $0x2,%eax
+  801c9c:	7e 40                	jle    801cde <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801c9e:	48 89 df             	mov    %rbx,%rdi
+  801ca1:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801ca8:	00 00 00 
+  801cab:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cad:	85 c0                	test   %eax,%eax
+  801caf:	79 11                	jns    801cc2 <devfile_read+0x87>
+  801cb1:	48 98                	cltq
+}
+  801cb3:	48 83 c4 28          	add    $0x28,%rsp
+  801cb7:	5b                   	pop    %rbx
+  801cb8:	41 5c                	pop    %r12
+  801cba:	41 5d                	pop    %r13
+  801cbc:	41 5e                	pop    %r14
+  801cbe:	41 5f                	pop    %r15
+  801cc0:	5d                   	pop    %rbp
+  801cc1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cc2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cc7:	4c 89 ea             	mov    %r13,%rdx
+  801cca:	4c 89 e6             	mov    %r12,%rsi
+  801ccd:	48 89 df             	mov    %rbx,%rdi
+  801cd0:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  801cd7:	00 00 00 
+  801cda:	ff d0                	call   *%rax
+  801cdc:	eb d5                	jmp    801cb3 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cde:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801ce2:	48 89 df             	mov    %rbx,%rdi
+  801ce5:	48 b8 c5 16 80 00 00 	movabs $0x8016c5,%rax
+  801cec:	00 00 00 
+  801cef:	ff d0                	call   *%rax
+  801cf1:	85 c0                	test   %eax,%eax
+  801cf3:	0f 88 33 01 00 00    	js     801e2c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801cf9:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d00:	00 00 00 
+  801d03:	4c 89 f0             	mov    %r14,%rax
+  801d06:	48 29 d0             	sub    %rdx,%rax
+  801d09:	48 c1 f8 03          	sar    $0x3,%rax
+  801d0d:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d14:	aa aa aa 
+  801d17:	48 0f af c2          	imul   %rdx,%rax
+  801d1b:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d1f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d23:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d26:	41 39 06             	cmp    %eax,(%r14)
+  801d29:	75 0d                	jne    801d38 <devfile_read+0xfd>
+  801d2b:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d2e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d32:	0f 84 fb 00 00 00    	je     801e33 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d38:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d3d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d41:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d48:	48 89 c7             	mov    %rax,%rdi
+  801d4b:	48 b8 93 2e 80 00 00 	movabs $0x802e93,%rax
+  801d52:	00 00 00 
+  801d55:	ff d0                	call   *%rax
+  801d57:	84 c0                	test   %al,%al
+  801d59:	75 27                	jne    801d82 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d5b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d60:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d65:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6e:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  801d75:	00 00 00 
+  801d78:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d7a:	85 c0                	test   %eax,%eax
+  801d7c:	0f 88 dc 00 00 00    	js     801e5e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d82:	44 89 f8             	mov    %r15d,%eax
+  801d85:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d8a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d8c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d93:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d94:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d97:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801d9b:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801d9e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801da3:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801da7:	48 89 df             	mov    %rbx,%rdi
+  801daa:	48 b8 c3 19 80 00 00 	movabs $0x8019c3,%rax
+  801db1:	00 00 00 
+  801db4:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801db6:	48 85 c0             	test   %rax,%rax
+  801db9:	0f 88 f4 fe ff ff    	js     801cb3 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dbf:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801dc2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801dc5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dc8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dcc:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dd0:	48 63 d1             	movslq %ecx,%rdx
+  801dd3:	48 01 d0             	add    %rdx,%rax
+  801dd6:	4d 63 ff             	movslq %r15d,%r15
+  801dd9:	4c 29 f8             	sub    %r15,%rax
+  801ddc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801de1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801de5:	48 85 c0             	test   %rax,%rax
+  801de8:	0f 8e c5 fe ff ff    	jle    801cb3 <devfile_read+0x78>
+    n = MIN(n, res);
+  801dee:	4c 39 e8             	cmp    %r13,%rax
+  801df1:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801df5:	8b 73 04             	mov    0x4(%rbx),%esi
+  801df8:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801dfc:	48 63 f6             	movslq %esi,%rsi
+  801dff:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e04:	48 01 c6             	add    %rax,%rsi
+  801e07:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e0b:	48 01 c6             	add    %rax,%rsi
+  801e0e:	4c 89 ea             	mov    %r13,%rdx
+  801e11:	4c 89 e7             	mov    %r12,%rdi
+  801e14:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  801e1b:	00 00 00 
+  801e1e:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e20:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e24:	4c 89 e8             	mov    %r13,%rax
+  801e27:	e9 87 fe ff ff       	jmp    801cb3 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e2c:	48 98                	cltq
+  801e2e:	e9 80 fe ff ff       	jmp    801cb3 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e33:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e37:	41 39 d7             	cmp    %edx,%r15d
+  801e3a:	0f 8c f8 fe ff ff    	jl     801d38 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e40:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e44:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e47:	41 39 cf             	cmp    %ecx,%r15d
+  801e4a:	0f 8d e8 fe ff ff    	jge    801d38 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e50:	4d 63 ff             	movslq %r15d,%r15
+  801e53:	4c 29 f8             	sub    %r15,%rax
+  801e56:	48 63 d2             	movslq %edx,%rdx
+  801e59:	48 01 d0             	add    %rdx,%rax
+  801e5c:	eb 87                	jmp    801de5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e5e:	48 98                	cltq
+  801e60:	e9 4e fe ff ff       	jmp    801cb3 <devfile_read+0x78>
+        return E_INVAL;
+  801e65:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e6a:	c3                   	ret
+
+0000000000801e6b <fs_channel>:
+fs_channel(bool enable) {
+  801e6b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e6d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e74:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e76:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e7b:	40 84 ff             	test   %dil,%dil
+  801e7e:	74 47                	je     801ec7 <fs_channel+0x5c>
+  801e80:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e87:	00 00 00 
+  801e8a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e90:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e97:	00 00 00 
+  801e9a:	3b 08                	cmp    (%rax),%ecx
+  801e9c:	74 29                	je     801ec7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801e9e:	55                   	push   %rbp
+  801e9f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801ea2:	48 b8 eb 0d 80 00 00 	movabs $0x800deb,%rax
+  801ea9:	00 00 00 
+  801eac:	ff d0                	call   *%rax
+  801eae:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 04                	js     801eb8 <fs_channel+0x4d>
+}
+  801eb4:	89 d0                	mov    %edx,%eax
+  801eb6:	5d                   	pop    %rbp
+  801eb7:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801eb8:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801ebf:	00 00 00 
+  801ec2:	c6 00 00             	movb   $0x0,(%rax)
+  801ec5:	eb ed                	jmp    801eb4 <fs_channel+0x49>
+}
+  801ec7:	89 d0                	mov    %edx,%eax
+  801ec9:	c3                   	ret
+
+0000000000801eca <open>:
+open(const char *path, int mode) {
+  801eca:	55                   	push   %rbp
+  801ecb:	48 89 e5             	mov    %rsp,%rbp
+  801ece:	41 55                	push   %r13
+  801ed0:	41 54                	push   %r12
+  801ed2:	53                   	push   %rbx
+  801ed3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ed7:	49 89 fc             	mov    %rdi,%r12
+  801eda:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801edd:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801eef:	0f 87 8f 00 00 00    	ja     801f84 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ef5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801ef9:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  801f00:	00 00 00 
+  801f03:	ff d0                	call   *%rax
+  801f05:	89 c3                	mov    %eax,%ebx
+  801f07:	85 c0                	test   %eax,%eax
+  801f09:	78 55                	js     801f60 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f0b:	4c 89 e6             	mov    %r12,%rsi
+  801f0e:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f15:	00 00 00 
+  801f18:	48 89 df             	mov    %rbx,%rdi
+  801f1b:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  801f22:	00 00 00 
+  801f25:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f27:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f33:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f37:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f3c:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+  801f48:	89 c3                	mov    %eax,%ebx
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 1f                	js     801f6d <open+0xa3>
+    return fd2num(fd);
+  801f4e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f52:	48 b8 77 06 80 00 00 	movabs $0x800677,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+  801f5e:	89 c3                	mov    %eax,%ebx
+}
+  801f60:	89 d8                	mov    %ebx,%eax
+  801f62:	48 83 c4 18          	add    $0x18,%rsp
+  801f66:	5b                   	pop    %rbx
+  801f67:	41 5c                	pop    %r12
+  801f69:	41 5d                	pop    %r13
+  801f6b:	5d                   	pop    %rbp
+  801f6c:	c3                   	ret
+        fd_close(fd, 0);
+  801f6d:	be 00 00 00 00       	mov    $0x0,%esi
+  801f72:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f76:	48 b8 c0 07 80 00 00 	movabs $0x8007c0,%rax
+  801f7d:	00 00 00 
+  801f80:	ff d0                	call   *%rax
+        return res;
+  801f82:	eb dc                	jmp    801f60 <open+0x96>
+        return -E_BAD_PATH;
+  801f84:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f89:	eb d5                	jmp    801f60 <open+0x96>
+
+0000000000801f8b <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f8b:	55                   	push   %rbp
+  801f8c:	48 89 e5             	mov    %rsp,%rbp
+  801f8f:	41 56                	push   %r14
+  801f91:	41 55                	push   %r13
+  801f93:	41 54                	push   %r12
+  801f95:	53                   	push   %rbx
+  801f96:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801f9a:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fa1:	00 00 00 
+  801fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fa9:	49 bd 05 07 80 00 00 	movabs $0x800705,%r13
+  801fb0:	00 00 00 
+  801fb3:	49 be c5 16 80 00 00 	movabs $0x8016c5,%r14
+  801fba:	00 00 00 
+  801fbd:	eb 0c                	jmp    801fcb <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fbf:	83 c3 01             	add    $0x1,%ebx
+  801fc2:	49 83 c4 18          	add    $0x18,%r12
+  801fc6:	83 fb 20             	cmp    $0x20,%ebx
+  801fc9:	74 1d                	je     801fe8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fcb:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fd0:	74 ed                	je     801fbf <file_flush_buffers+0x34>
+  801fd2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd6:	89 df                	mov    %ebx,%edi
+  801fd8:	41 ff d5             	call   *%r13
+  801fdb:	85 c0                	test   %eax,%eax
+  801fdd:	78 e0                	js     801fbf <file_flush_buffers+0x34>
+  801fdf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fe3:	41 ff d6             	call   *%r14
+  801fe6:	eb d7                	jmp    801fbf <file_flush_buffers+0x34>
+}
+  801fe8:	48 83 c4 10          	add    $0x10,%rsp
+  801fec:	5b                   	pop    %rbx
+  801fed:	41 5c                	pop    %r12
+  801fef:	41 5d                	pop    %r13
+  801ff1:	41 5e                	pop    %r14
+  801ff3:	5d                   	pop    %rbp
+  801ff4:	c3                   	ret
+
+0000000000801ff5 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801ff5:	55                   	push   %rbp
+  801ff6:	48 89 e5             	mov    %rsp,%rbp
+  801ff9:	41 54                	push   %r12
+  801ffb:	53                   	push   %rbx
+  801ffc:	49 89 fc             	mov    %rdi,%r12
+  801fff:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802001:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  802008:	00 00 00 
+  80200b:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80200d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802014:	00 00 00 
+  802017:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80201c:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80201e:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802021:	ba 00 00 00 00       	mov    $0x0,%edx
+  802026:	be 00 00 00 00       	mov    $0x0,%esi
+  80202b:	bf 02 00 00 00       	mov    $0x2,%edi
+  802030:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  802037:	00 00 00 
+  80203a:	ff d0                	call   *%rax
+}
+  80203c:	5b                   	pop    %rbx
+  80203d:	41 5c                	pop    %r12
+  80203f:	5d                   	pop    %rbp
+  802040:	c3                   	ret
+
+0000000000802041 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802041:	55                   	push   %rbp
+  802042:	48 89 e5             	mov    %rsp,%rbp
+  802045:	41 54                	push   %r12
+  802047:	53                   	push   %rbx
+  802048:	49 89 fc             	mov    %rdi,%r12
+  80204b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80204e:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  802055:	00 00 00 
+  802058:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80205a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80205f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802066:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802068:	ba 00 00 00 00       	mov    $0x0,%edx
+  80206d:	be 00 00 00 00       	mov    $0x0,%esi
+  802072:	bf 05 00 00 00       	mov    $0x5,%edi
+  802077:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  80207e:	00 00 00 
+  802081:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802083:	85 c0                	test   %eax,%eax
+  802085:	78 3d                	js     8020c4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802087:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80208e:	00 00 00 
+  802091:	4c 89 e6             	mov    %r12,%rsi
+  802094:	48 89 df             	mov    %rbx,%rdi
+  802097:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  80209e:	00 00 00 
+  8020a1:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020a3:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020aa:	00 
+  8020ab:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020b1:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020b8:	00 
+  8020b9:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020c4:	5b                   	pop    %rbx
+  8020c5:	41 5c                	pop    %r12
+  8020c7:	5d                   	pop    %rbp
+  8020c8:	c3                   	ret
+
+00000000008020c9 <remove>:
+remove(const char *path) {
+  8020c9:	55                   	push   %rbp
+  8020ca:	48 89 e5             	mov    %rsp,%rbp
+  8020cd:	53                   	push   %rbx
+  8020ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8020d2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020d5:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020e7:	77 3a                	ja     802123 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020e9:	48 89 de             	mov    %rbx,%rsi
+  8020ec:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020f3:	00 00 00 
+  8020f6:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802102:	ba 00 00 00 00       	mov    $0x0,%edx
+  802107:	be 00 00 00 00       	mov    $0x0,%esi
+  80210c:	bf 07 00 00 00       	mov    $0x7,%edi
+  802111:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+}
+  80211d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802121:	c9                   	leave
+  802122:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802123:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802128:	eb f3                	jmp    80211d <remove+0x54>
+
+000000000080212a <sync>:
+sync(void) {
+  80212a:	55                   	push   %rbp
+  80212b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80212e:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  802135:	00 00 00 
+  802138:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80213a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213f:	be 00 00 00 00       	mov    $0x0,%esi
+  802144:	bf 08 00 00 00       	mov    $0x8,%edi
+  802149:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  802150:	00 00 00 
+  802153:	ff d0                	call   *%rax
+}
+  802155:	5d                   	pop    %rbp
+  802156:	c3                   	ret
+
+0000000000802157 <fsync>:
+fsync(int fdnum) {
+  802157:	55                   	push   %rbp
+  802158:	48 89 e5             	mov    %rsp,%rbp
+  80215b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80215f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802163:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  80216a:	00 00 00 
+  80216d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80216f:	85 c0                	test   %eax,%eax
+  802171:	78 4b                	js     8021be <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802173:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802177:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  80217e:	00 00 00 
+  802181:	8b 00                	mov    (%rax),%eax
+  802183:	39 02                	cmp    %eax,(%rdx)
+  802185:	75 39                	jne    8021c0 <fsync+0x69>
+    file_flush_buffers();
+  802187:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  80218e:	00 00 00 
+  802191:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802193:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802197:	8b 40 0c             	mov    0xc(%rax),%eax
+  80219a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021a1:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021a8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021ad:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021b2:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+}
+  8021be:	c9                   	leave
+  8021bf:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021c0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021c5:	eb f7                	jmp    8021be <fsync+0x67>
+
+00000000008021c7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+  8021cb:	53                   	push   %rbx
+  8021cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8021d0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8021dd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021e2:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  8021e9:	00 00 00 
+  8021ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021ee:	85 c0                	test   %eax,%eax
+  8021f0:	78 2d                	js     80221f <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021f2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8021f9:	00 00 00 
+  8021fc:	48 8b 10             	mov    (%rax),%rdx
+  8021ff:	48 89 13             	mov    %rdx,(%rbx)
+  802202:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802206:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80220a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80220e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802212:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802216:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80221a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80221f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802223:	c9                   	leave
+  802224:	c3                   	ret
+
+0000000000802225 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802225:	55                   	push   %rbp
+  802226:	48 89 e5             	mov    %rsp,%rbp
+  802229:	53                   	push   %rbx
+  80222a:	48 83 ec 08          	sub    $0x8,%rsp
+  80222e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802231:	ba 00 00 00 00       	mov    $0x0,%edx
+  802236:	be 00 00 00 00       	mov    $0x0,%esi
+  80223b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802240:	48 b8 5c 14 80 00 00 	movabs $0x80145c,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80224c:	85 c0                	test   %eax,%eax
+  80224e:	78 3d                	js     80228d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802250:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802257:	00 00 00 
+  80225a:	48 8b 10             	mov    (%rax),%rdx
+  80225d:	48 89 13             	mov    %rdx,(%rbx)
+  802260:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802264:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802268:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80226c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802270:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802274:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802278:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80227c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802280:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802284:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  802288:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80228d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802291:	c9                   	leave
+  802292:	c3                   	ret
+
+0000000000802293 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  802293:	55                   	push   %rbp
+  802294:	48 89 e5             	mov    %rsp,%rbp
+  802297:	41 57                	push   %r15
+  802299:	41 56                	push   %r14
+  80229b:	41 55                	push   %r13
+  80229d:	41 54                	push   %r12
+  80229f:	53                   	push   %rbx
+  8022a0:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022a4:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022ab:	00 
+  8022ac:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022b3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022b9:	0f 85 43 01 00 00    	jne    802402 <munmap+0x16f>
+  8022bf:	49 89 ff             	mov    %rdi,%r15
+  8022c2:	4c 39 f7             	cmp    %r14,%rdi
+  8022c5:	0f 87 37 01 00 00    	ja     802402 <munmap+0x16f>
+  8022cb:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022d2:	00 00 00 
+  8022d5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022db:	eb 2c                	jmp    802309 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022dd:	4c 39 f8             	cmp    %r15,%rax
+  8022e0:	0f 83 85 00 00 00    	jae    80236b <munmap+0xd8>
+            m->mm_end = start;
+  8022e6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022eb:	48 83 c3 18          	add    $0x18,%rbx
+  8022ef:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8022f6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8022fd:	00 00 00 
+  802300:	48 39 c3             	cmp    %rax,%rbx
+  802303:	0f 84 d0 00 00 00    	je     8023d9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802309:	49 89 dc             	mov    %rbx,%r12
+  80230c:	48 8b 03             	mov    (%rbx),%rax
+  80230f:	4c 39 f0             	cmp    %r14,%rax
+  802312:	73 d7                	jae    8022eb <munmap+0x58>
+  802314:	48 85 c0             	test   %rax,%rax
+  802317:	74 d2                	je     8022eb <munmap+0x58>
+  802319:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80231d:	49 39 d7             	cmp    %rdx,%r15
+  802320:	73 c9                	jae    8022eb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802322:	49 39 d6             	cmp    %rdx,%r14
+  802325:	73 b6                	jae    8022dd <munmap+0x4a>
+  802327:	49 39 c7             	cmp    %rax,%r15
+  80232a:	76 b1                	jbe    8022dd <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80232c:	4c 89 ef             	mov    %r13,%rdi
+  80232f:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  802336:	00 00 00 
+  802339:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80233b:	48 85 c0             	test   %rax,%rax
+  80233e:	0f 84 c5 00 00 00    	je     802409 <munmap+0x176>
+            *tail = *m;
+  802344:	48 8b 13             	mov    (%rbx),%rdx
+  802347:	48 89 10             	mov    %rdx,(%rax)
+  80234a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80234e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802352:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802356:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80235a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80235d:	44 89 f2             	mov    %r14d,%edx
+  802360:	2b 13                	sub    (%rbx),%edx
+  802362:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802365:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  802369:	eb 80                	jmp    8022eb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80236b:	49 39 d6             	cmp    %rdx,%r14
+  80236e:	73 18                	jae    802388 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802370:	44 89 f2             	mov    %r14d,%edx
+  802373:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802378:	29 c2                	sub    %eax,%edx
+  80237a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80237f:	4d 89 34 24          	mov    %r14,(%r12)
+  802383:	e9 63 ff ff ff       	jmp    8022eb <munmap+0x58>
+    m->mm_start = 0;
+  802388:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80238f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  802390:	4c 89 e6             	mov    %r12,%rsi
+  802393:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80239a:	00 00 00 
+  80239d:	48 29 c6             	sub    %rax,%rsi
+  8023a0:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023a4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023ab:	aa aa aa 
+  8023ae:	48 0f af f0          	imul   %rax,%rsi
+  8023b2:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023b6:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023bb:	48 01 c6             	add    %rax,%rsi
+  8023be:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023c3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023c8:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+}
+  8023d4:	e9 12 ff ff ff       	jmp    8022eb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023d9:	4c 89 f2             	mov    %r14,%rdx
+  8023dc:	4c 29 fa             	sub    %r15,%rdx
+  8023df:	4c 89 fe             	mov    %r15,%rsi
+  8023e2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e7:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8023ee:	00 00 00 
+  8023f1:	ff d0                	call   *%rax
+}
+  8023f3:	48 83 c4 08          	add    $0x8,%rsp
+  8023f7:	5b                   	pop    %rbx
+  8023f8:	41 5c                	pop    %r12
+  8023fa:	41 5d                	pop    %r13
+  8023fc:	41 5e                	pop    %r14
+  8023fe:	41 5f                	pop    %r15
+  802400:	5d                   	pop    %rbp
+  802401:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  802402:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802407:	eb ea                	jmp    8023f3 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802409:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80240e:	eb e3                	jmp    8023f3 <munmap+0x160>
+
+0000000000802410 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802410:	55                   	push   %rbp
+  802411:	48 89 e5             	mov    %rsp,%rbp
+  802414:	41 57                	push   %r15
+  802416:	41 56                	push   %r14
+  802418:	41 55                	push   %r13
+  80241a:	41 54                	push   %r12
+  80241c:	53                   	push   %rbx
+  80241d:	48 83 ec 28          	sub    $0x28,%rsp
+  802421:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802425:	49 89 f5             	mov    %rsi,%r13
+  802428:	41 89 d6             	mov    %edx,%r14d
+  80242b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80242e:	41 89 cc             	mov    %ecx,%r12d
+  802431:	44 89 c7             	mov    %r8d,%edi
+  802434:	44 89 cb             	mov    %r9d,%ebx
+  802437:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80243b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80243f:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  802446:	00 00 00 
+  802449:	ff d0                	call   *%rax
+  80244b:	41 89 c7             	mov    %eax,%r15d
+  80244e:	85 c0                	test   %eax,%eax
+  802450:	0f 88 ae 01 00 00    	js     802604 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802456:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80245a:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802461:	00 00 00 
+  802464:	8b 32                	mov    (%rdx),%esi
+  802466:	39 30                	cmp    %esi,(%rax)
+  802468:	0f 85 7a 02 00 00    	jne    8026e8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80246e:	8b 40 08             	mov    0x8(%rax),%eax
+  802471:	83 e0 03             	and    $0x3,%eax
+  802474:	83 f8 01             	cmp    $0x1,%eax
+  802477:	0f 84 76 02 00 00    	je     8026f3 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80247d:	4d 85 ed             	test   %r13,%r13
+  802480:	0f 84 78 02 00 00    	je     8026fe <mmap+0x2ee>
+  802486:	85 db                	test   %ebx,%ebx
+  802488:	0f 88 70 02 00 00    	js     8026fe <mmap+0x2ee>
+  80248e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802494:	41 89 df             	mov    %ebx,%r15d
+  802497:	0f 85 6c 02 00 00    	jne    802709 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80249d:	44 89 f0             	mov    %r14d,%eax
+  8024a0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024a3:	83 f8 04             	cmp    $0x4,%eax
+  8024a6:	0f 85 68 02 00 00    	jne    802714 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024ac:	44 89 e1             	mov    %r12d,%ecx
+  8024af:	83 e1 01             	and    $0x1,%ecx
+  8024b2:	0f 95 c2             	setne  %dl
+  8024b5:	44 89 e0             	mov    %r12d,%eax
+  8024b8:	d1 e8                	shr    %eax
+  8024ba:	83 f0 01             	xor    $0x1,%eax
+  8024bd:	83 e0 01             	and    $0x1,%eax
+  8024c0:	38 c2                	cmp    %al,%dl
+  8024c2:	0f 85 57 02 00 00    	jne    80271f <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024c8:	85 c9                	test   %ecx,%ecx
+  8024ca:	74 0a                	je     8024d6 <mmap+0xc6>
+  8024cc:	41 f6 c6 02          	test   $0x2,%r14b
+  8024d0:	0f 85 54 02 00 00    	jne    80272a <mmap+0x31a>
+    file_flush_buffers();
+  8024d6:	48 b8 8b 1f 80 00 00 	movabs $0x801f8b,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024e2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024e9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024f0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024f4:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8024f7:	41 f6 c4 04          	test   $0x4,%r12b
+  8024fb:	0f 84 15 01 00 00    	je     802616 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  802501:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802504:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80250a:	0f 85 25 02 00 00    	jne    802735 <mmap+0x325>
+  802510:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802514:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80251b:	00 00 00 
+  80251e:	48 39 c2             	cmp    %rax,%rdx
+  802521:	0f 82 19 02 00 00    	jb     802740 <mmap+0x330>
+  802527:	48 39 c7             	cmp    %rax,%rdi
+  80252a:	0f 87 10 02 00 00    	ja     802740 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802530:	4c 89 ee             	mov    %r13,%rsi
+  802533:	48 b8 93 22 80 00 00 	movabs $0x802293,%rax
+  80253a:	00 00 00 
+  80253d:	ff d0                	call   *%rax
+  80253f:	85 c0                	test   %eax,%eax
+  802541:	0f 88 04 02 00 00    	js     80274b <mmap+0x33b>
+    if (!handler) {
+  802547:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80254e:	00 00 00 
+  802551:	80 38 00             	cmpb   $0x0,(%rax)
+  802554:	75 2b                	jne    802581 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802556:	48 bf 2b 13 80 00 00 	movabs $0x80132b,%rdi
+  80255d:	00 00 00 
+  802560:	48 b8 88 42 80 00 00 	movabs $0x804288,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+  80256c:	85 c0                	test   %eax,%eax
+  80256e:	0f 88 ea 01 00 00    	js     80275e <mmap+0x34e>
+        handler = 1;
+  802574:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80257b:	00 00 00 
+  80257e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802581:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802585:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  80258c:	00 00 00 
+  80258f:	ff d0                	call   *%rax
+  802591:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  802594:	48 85 c0             	test   %rax,%rax
+  802597:	0f 84 c9 01 00 00    	je     802766 <mmap+0x356>
+    m->mm_start = va;
+  80259d:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025a0:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025a4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025a8:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025ab:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025af:	44 89 e0             	mov    %r12d,%eax
+  8025b2:	c1 e0 06             	shl    $0x6,%eax
+  8025b5:	25 80 00 00 00       	and    $0x80,%eax
+  8025ba:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025bd:	09 f0                	or     %esi,%eax
+  8025bf:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025c3:	41 f6 c4 08          	test   $0x8,%r12b
+  8025c7:	74 31                	je     8025fa <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025c9:	48 39 d3             	cmp    %rdx,%rbx
+  8025cc:	73 2c                	jae    8025fa <mmap+0x1ea>
+  8025ce:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025d3:	48 89 de             	mov    %rbx,%rsi
+  8025d6:	4c 89 f7             	mov    %r14,%rdi
+  8025d9:	48 b8 1a 12 80 00 00 	movabs $0x80121a,%rax
+  8025e0:	00 00 00 
+  8025e3:	ff d0                	call   *%rax
+  8025e5:	49 89 c4             	mov    %rax,%r12
+  8025e8:	48 85 c0             	test   %rax,%rax
+  8025eb:	0f 8e d7 00 00 00    	jle    8026c8 <mmap+0x2b8>
+            va += n;
+  8025f1:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025f4:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8025f8:	72 d4                	jb     8025ce <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8025fa:	49 8b 06             	mov    (%r14),%rax
+  8025fd:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  802601:	48 89 06             	mov    %rax,(%rsi)
+}
+  802604:	44 89 f8             	mov    %r15d,%eax
+  802607:	48 83 c4 28          	add    $0x28,%rsp
+  80260b:	5b                   	pop    %rbx
+  80260c:	41 5c                	pop    %r12
+  80260e:	41 5d                	pop    %r13
+  802610:	41 5e                	pop    %r14
+  802612:	41 5f                	pop    %r15
+  802614:	5d                   	pop    %rbp
+  802615:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802616:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80261d:	00 00 00 
+  802620:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802623:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80262a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80262d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802632:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802639:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80263c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802643:	00 00 00 
+  802646:	48 39 d7             	cmp    %rdx,%rdi
+  802649:	73 1c                	jae    802667 <mmap+0x257>
+        return -E_NO_MEM;
+  80264b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802651:	eb b1                	jmp    802604 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802653:	48 83 c0 01          	add    $0x1,%rax
+  802657:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80265b:	77 3f                	ja     80269c <mmap+0x28c>
+  80265d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802662:	48 39 d7             	cmp    %rdx,%rdi
+  802665:	72 2a                	jb     802691 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802667:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80266b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80266f:	48 39 d1             	cmp    %rdx,%rcx
+  802672:	73 df                	jae    802653 <mmap+0x243>
+  802674:	48 85 c9             	test   %rcx,%rcx
+  802677:	74 da                	je     802653 <mmap+0x243>
+  802679:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80267d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802682:	48 39 d3             	cmp    %rdx,%rbx
+  802685:	73 cc                	jae    802653 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802687:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80268a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80268f:	eb cc                	jmp    80265d <mmap+0x24d>
+        return -E_NO_MEM;
+  802691:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802697:	e9 68 ff ff ff       	jmp    802604 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80269c:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026a1:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026a8:	00 00 00 
+  8026ab:	48 39 c2             	cmp    %rax,%rdx
+  8026ae:	0f 82 9f 00 00 00    	jb     802753 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026b4:	48 85 db             	test   %rbx,%rbx
+  8026b7:	0f 85 8a fe ff ff    	jne    802547 <mmap+0x137>
+        return -E_NO_MEM;
+  8026bd:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026c3:	e9 3c ff ff ff       	jmp    802604 <mmap+0x1f4>
+        if (n < 0) {
+  8026c8:	0f 89 2c ff ff ff    	jns    8025fa <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026ce:	49 8b 3e             	mov    (%r14),%rdi
+  8026d1:	4c 89 ee             	mov    %r13,%rsi
+  8026d4:	48 b8 93 22 80 00 00 	movabs $0x802293,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+            return n;
+  8026e0:	45 89 e7             	mov    %r12d,%r15d
+  8026e3:	e9 1c ff ff ff       	jmp    802604 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026e8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026ee:	e9 11 ff ff ff       	jmp    802604 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026f3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026f9:	e9 06 ff ff ff       	jmp    802604 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8026fe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802704:	e9 fb fe ff ff       	jmp    802604 <mmap+0x1f4>
+  802709:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270f:	e9 f0 fe ff ff       	jmp    802604 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802714:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80271a:	e9 e5 fe ff ff       	jmp    802604 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80271f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802725:	e9 da fe ff ff       	jmp    802604 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80272a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802730:	e9 cf fe ff ff       	jmp    802604 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802735:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80273b:	e9 c4 fe ff ff       	jmp    802604 <mmap+0x1f4>
+  802740:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802746:	e9 b9 fe ff ff       	jmp    802604 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80274b:	41 89 c7             	mov    %eax,%r15d
+  80274e:	e9 b1 fe ff ff       	jmp    802604 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802753:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802759:	e9 a6 fe ff ff       	jmp    802604 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80275e:	41 89 c7             	mov    %eax,%r15d
+  802761:	e9 9e fe ff ff       	jmp    802604 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802766:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80276c:	e9 93 fe ff ff       	jmp    802604 <mmap+0x1f4>
+
+0000000000802771 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802771:	55                   	push   %rbp
+  802772:	48 89 e5             	mov    %rsp,%rbp
+  802775:	41 54                	push   %r12
+  802777:	53                   	push   %rbx
+  802778:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80277b:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802782:	00 00 00 
+  802785:	ff d0                	call   *%rax
+  802787:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80278a:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  802791:	00 00 00 
+  802794:	48 89 df             	mov    %rbx,%rdi
+  802797:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027a3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027a8:	41 2b 04 24          	sub    (%r12),%eax
+  8027ac:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027b2:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027b9:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027bc:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027c3:	00 00 00 
+  8027c6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d2:	5b                   	pop    %rbx
+  8027d3:	41 5c                	pop    %r12
+  8027d5:	5d                   	pop    %rbp
+  8027d6:	c3                   	ret
+
+00000000008027d7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027d7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027da:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027e0:	8b 17                	mov    (%rdi),%edx
+  8027e2:	85 d2                	test   %edx,%edx
+  8027e4:	75 01                	jne    8027e7 <pipe_wakeup+0x10>
+  8027e6:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027e7:	55                   	push   %rbp
+  8027e8:	48 89 e5             	mov    %rsp,%rbp
+  8027eb:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027ee:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027f4:	be 00 04 00 00       	mov    $0x400,%esi
+  8027f9:	48 b8 d0 05 80 00 00 	movabs $0x8005d0,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+}
+  802805:	5d                   	pop    %rbp
+  802806:	c3                   	ret
+
+0000000000802807 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802807:	55                   	push   %rbp
+  802808:	48 89 e5             	mov    %rsp,%rbp
+  80280b:	41 55                	push   %r13
+  80280d:	41 54                	push   %r12
+  80280f:	53                   	push   %rbx
+  802810:	48 83 ec 08          	sub    $0x8,%rsp
+  802814:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802817:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  80281e:	00 00 00 
+  802821:	ff d0                	call   *%rax
+  802823:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802826:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80282b:	4c 89 e6             	mov    %r12,%rsi
+  80282e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802833:	49 bc ea 02 80 00 00 	movabs $0x8002ea,%r12
+  80283a:	00 00 00 
+  80283d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802840:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802844:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802848:	49 bd d7 27 80 00 00 	movabs $0x8027d7,%r13
+  80284f:	00 00 00 
+  802852:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802855:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802859:	48 89 de             	mov    %rbx,%rsi
+  80285c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80285f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802864:	48 89 de             	mov    %rbx,%rsi
+  802867:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286c:	41 ff d4             	call   *%r12
+  80286f:	48 83 c4 08          	add    $0x8,%rsp
+  802873:	5b                   	pop    %rbx
+  802874:	41 5c                	pop    %r12
+  802876:	41 5d                	pop    %r13
+  802878:	5d                   	pop    %rbp
+  802879:	c3                   	ret
+
+000000000080287a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80287a:	55                   	push   %rbp
+  80287b:	48 89 e5             	mov    %rsp,%rbp
+  80287e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802881:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802886:	be 00 10 00 00       	mov    $0x1000,%esi
+  80288b:	48 b8 2d 02 80 00 00 	movabs $0x80022d,%rax
+  802892:	00 00 00 
+  802895:	ff d0                	call   *%rax
+  802897:	85 c0                	test   %eax,%eax
+  802899:	0f 94 c0             	sete   %al
+  80289c:	0f b6 c0             	movzbl %al,%eax
+}
+  80289f:	5d                   	pop    %rbp
+  8028a0:	c3                   	ret
+
+00000000008028a1 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028a1:	55                   	push   %rbp
+  8028a2:	48 89 e5             	mov    %rsp,%rbp
+  8028a5:	41 57                	push   %r15
+  8028a7:	41 56                	push   %r14
+  8028a9:	41 55                	push   %r13
+  8028ab:	41 54                	push   %r12
+  8028ad:	53                   	push   %rbx
+  8028ae:	48 83 ec 38          	sub    $0x38,%rsp
+  8028b2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028b6:	49 89 f4             	mov    %rsi,%r12
+  8028b9:	49 89 d7             	mov    %rdx,%r15
+  8028bc:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028c0:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  8028c7:	00 00 00 
+  8028ca:	ff d0                	call   *%rax
+  8028cc:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028cf:	4d 85 ff             	test   %r15,%r15
+  8028d2:	0f 84 f1 00 00 00    	je     8029c9 <devpipe_write+0x128>
+  8028d8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028dc:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028e0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028e4:	49 bd 7a 28 80 00 00 	movabs $0x80287a,%r13
+  8028eb:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028ee:	49 bf d7 27 80 00 00 	movabs $0x8027d7,%r15
+  8028f5:	00 00 00 
+  8028f8:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8028fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802900:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  802904:	8b 73 04             	mov    0x4(%rbx),%esi
+  802907:	48 63 ce             	movslq %esi,%rcx
+  80290a:	48 63 03             	movslq (%rbx),%rax
+  80290d:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802913:	48 39 c1             	cmp    %rax,%rcx
+  802916:	72 64                	jb     80297c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802918:	48 89 de             	mov    %rbx,%rsi
+  80291b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80291f:	41 ff d5             	call   *%r13
+  802922:	85 c0                	test   %eax,%eax
+  802924:	0f 85 b9 00 00 00    	jne    8029e3 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80292a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80292e:	4c 89 f7             	mov    %r14,%rdi
+  802931:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802934:	8b 43 04             	mov    0x4(%rbx),%eax
+  802937:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80293e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802945:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80294b:	8b 03                	mov    (%rbx),%eax
+  80294d:	41 39 c4             	cmp    %eax,%r12d
+  802950:	75 b2                	jne    802904 <devpipe_write+0x63>
+  802952:	48 89 de             	mov    %rbx,%rsi
+  802955:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802959:	41 ff d5             	call   *%r13
+  80295c:	85 c0                	test   %eax,%eax
+  80295e:	75 a0                	jne    802900 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802960:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802965:	44 89 e6             	mov    %r12d,%esi
+  802968:	48 89 df             	mov    %rbx,%rdi
+  80296b:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  802972:	00 00 00 
+  802975:	ff d0                	call   *%rax
+  802977:	e9 7c ff ff ff       	jmp    8028f8 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80297c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802980:	41 0f b6 38          	movzbl (%r8),%edi
+  802984:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80298b:	80 80 80 
+  80298e:	48 89 c8             	mov    %rcx,%rax
+  802991:	48 f7 e2             	mul    %rdx
+  802994:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802998:	48 89 d0             	mov    %rdx,%rax
+  80299b:	48 c1 e0 08          	shl    $0x8,%rax
+  80299f:	48 29 d0             	sub    %rdx,%rax
+  8029a2:	48 c1 e0 04          	shl    $0x4,%rax
+  8029a6:	48 29 c1             	sub    %rax,%rcx
+  8029a9:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029ae:	83 c6 01             	add    $0x1,%esi
+  8029b1:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029b4:	49 83 c0 01          	add    $0x1,%r8
+  8029b8:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029c0:	49 39 c0             	cmp    %rax,%r8
+  8029c3:	0f 85 2f ff ff ff    	jne    8028f8 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029c9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029cd:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029d1:	48 b8 d7 27 80 00 00 	movabs $0x8027d7,%rax
+  8029d8:	00 00 00 
+  8029db:	ff d0                	call   *%rax
+    return n;
+  8029dd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029e1:	eb 05                	jmp    8029e8 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029e3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029e8:	48 83 c4 38          	add    $0x38,%rsp
+  8029ec:	5b                   	pop    %rbx
+  8029ed:	41 5c                	pop    %r12
+  8029ef:	41 5d                	pop    %r13
+  8029f1:	41 5e                	pop    %r14
+  8029f3:	41 5f                	pop    %r15
+  8029f5:	5d                   	pop    %rbp
+  8029f6:	c3                   	ret
+
+00000000008029f7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029f7:	55                   	push   %rbp
+  8029f8:	48 89 e5             	mov    %rsp,%rbp
+  8029fb:	41 57                	push   %r15
+  8029fd:	41 56                	push   %r14
+  8029ff:	41 55                	push   %r13
+  802a01:	41 54                	push   %r12
+  802a03:	53                   	push   %rbx
+  802a04:	48 83 ec 28          	sub    $0x28,%rsp
+  802a08:	49 89 fd             	mov    %rdi,%r13
+  802a0b:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a0f:	49 89 d4             	mov    %rdx,%r12
+  802a12:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a16:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+  802a22:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a25:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a2b:	49 bf 7a 28 80 00 00 	movabs $0x80287a,%r15
+  802a32:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a35:	4d 85 e4             	test   %r12,%r12
+  802a38:	0f 84 d5 00 00 00    	je     802b13 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a3e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a42:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a46:	8b 03                	mov    (%rbx),%eax
+  802a48:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a4b:	75 7a                	jne    802ac7 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a4d:	4d 85 f6             	test   %r14,%r14
+  802a50:	75 50                	jne    802aa2 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a52:	48 89 de             	mov    %rbx,%rsi
+  802a55:	4c 89 ef             	mov    %r13,%rdi
+  802a58:	41 ff d7             	call   *%r15
+  802a5b:	85 c0                	test   %eax,%eax
+  802a5d:	0f 85 c9 00 00 00    	jne    802b2c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a63:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a66:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a6d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a73:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a76:	41 39 c4             	cmp    %eax,%r12d
+  802a79:	75 cb                	jne    802a46 <devpipe_read+0x4f>
+  802a7b:	48 89 de             	mov    %rbx,%rsi
+  802a7e:	4c 89 ef             	mov    %r13,%rdi
+  802a81:	41 ff d7             	call   *%r15
+  802a84:	85 c0                	test   %eax,%eax
+  802a86:	75 be                	jne    802a46 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a88:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a8d:	44 89 e6             	mov    %r12d,%esi
+  802a90:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a94:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  802a9b:	00 00 00 
+  802a9e:	ff d0                	call   *%rax
+  802aa0:	eb a4                	jmp    802a46 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802aa2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802aa6:	48 89 de             	mov    %rbx,%rsi
+  802aa9:	48 b8 d7 27 80 00 00 	movabs $0x8027d7,%rax
+  802ab0:	00 00 00 
+  802ab3:	ff d0                	call   *%rax
+                return i;
+  802ab5:	4c 89 f0             	mov    %r14,%rax
+}
+  802ab8:	48 83 c4 28          	add    $0x28,%rsp
+  802abc:	5b                   	pop    %rbx
+  802abd:	41 5c                	pop    %r12
+  802abf:	41 5d                	pop    %r13
+  802ac1:	41 5e                	pop    %r14
+  802ac3:	41 5f                	pop    %r15
+  802ac5:	5d                   	pop    %rbp
+  802ac6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ac7:	48 63 c8             	movslq %eax,%rcx
+  802aca:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ad1:	80 80 80 
+  802ad4:	48 89 c8             	mov    %rcx,%rax
+  802ad7:	48 f7 e2             	mul    %rdx
+  802ada:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802ade:	48 89 d0             	mov    %rdx,%rax
+  802ae1:	48 c1 e0 08          	shl    $0x8,%rax
+  802ae5:	48 29 d0             	sub    %rdx,%rax
+  802ae8:	48 c1 e0 04          	shl    $0x4,%rax
+  802aec:	48 89 c2             	mov    %rax,%rdx
+  802aef:	48 89 c8             	mov    %rcx,%rax
+  802af2:	48 29 d0             	sub    %rdx,%rax
+  802af5:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802afa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802afe:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b02:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b05:	49 83 c6 01          	add    $0x1,%r14
+  802b09:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b0d:	0f 85 2b ff ff ff    	jne    802a3e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b13:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b17:	48 89 de             	mov    %rbx,%rsi
+  802b1a:	48 b8 d7 27 80 00 00 	movabs $0x8027d7,%rax
+  802b21:	00 00 00 
+  802b24:	ff d0                	call   *%rax
+    return n;
+  802b26:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b2a:	eb 8c                	jmp    802ab8 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b31:	eb 85                	jmp    802ab8 <devpipe_read+0xc1>
+
+0000000000802b33 <pipe>:
+pipe(int pfd[2]) {
+  802b33:	55                   	push   %rbp
+  802b34:	48 89 e5             	mov    %rsp,%rbp
+  802b37:	41 55                	push   %r13
+  802b39:	41 54                	push   %r12
+  802b3b:	53                   	push   %rbx
+  802b3c:	48 83 ec 18          	sub    $0x18,%rsp
+  802b40:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b43:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b47:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  802b4e:	00 00 00 
+  802b51:	ff d0                	call   *%rax
+  802b53:	89 c3                	mov    %eax,%ebx
+  802b55:	85 c0                	test   %eax,%eax
+  802b57:	0f 88 a0 01 00 00    	js     802cfd <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b5d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b67:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b6b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b70:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+  802b7c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b7e:	85 c0                	test   %eax,%eax
+  802b80:	0f 88 77 01 00 00    	js     802cfd <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b86:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b8a:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+  802b96:	89 c3                	mov    %eax,%ebx
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	0f 88 43 01 00 00    	js     802ce3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802ba0:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802ba5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802baa:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bb3:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  802bba:	00 00 00 
+  802bbd:	ff d0                	call   *%rax
+  802bbf:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bc1:	85 c0                	test   %eax,%eax
+  802bc3:	0f 88 1a 01 00 00    	js     802ce3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bc9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bcd:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bdc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802be1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802be6:	48 89 c6             	mov    %rax,%rsi
+  802be9:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bee:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+  802bfa:	89 c3                	mov    %eax,%ebx
+  802bfc:	85 c0                	test   %eax,%eax
+  802bfe:	0f 88 c5 00 00 00    	js     802cc9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c04:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c08:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	48 89 c1             	mov    %rax,%rcx
+  802c17:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c1d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c23:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c28:	4c 89 ee             	mov    %r13,%rsi
+  802c2b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c30:	48 b8 9a 02 80 00 00 	movabs $0x80029a,%rax
+  802c37:	00 00 00 
+  802c3a:	ff d0                	call   *%rax
+  802c3c:	89 c3                	mov    %eax,%ebx
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	78 6e                	js     802cb0 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c42:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c47:	4c 89 ef             	mov    %r13,%rdi
+  802c4a:	48 b8 09 02 80 00 00 	movabs $0x800209,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+  802c56:	83 f8 02             	cmp    $0x2,%eax
+  802c59:	0f 85 ab 00 00 00    	jne    802d0a <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c5f:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c66:	00 00 
+  802c68:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c6c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c6e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c72:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c79:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c7d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c7f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c83:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c8a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c8e:	48 bb 77 06 80 00 00 	movabs $0x800677,%rbx
+  802c95:	00 00 00 
+  802c98:	ff d3                	call   *%rbx
+  802c9a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802c9e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802ca2:	ff d3                	call   *%rbx
+  802ca4:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802ca9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cae:	eb 4d                	jmp    802cfd <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cb0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cb5:	4c 89 ee             	mov    %r13,%rsi
+  802cb8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cbd:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802cc4:	00 00 00 
+  802cc7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cc9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cce:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd7:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802ce3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ce8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf1:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+}
+  802cfd:	89 d8                	mov    %ebx,%eax
+  802cff:	48 83 c4 18          	add    $0x18,%rsp
+  802d03:	5b                   	pop    %rbx
+  802d04:	41 5c                	pop    %r12
+  802d06:	41 5d                	pop    %r13
+  802d08:	5d                   	pop    %rbp
+  802d09:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d0a:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d11:	00 00 00 
+  802d14:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d1b:	00 00 00 
+  802d1e:	be 50 00 00 00       	mov    $0x50,%esi
+  802d23:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d2a:	00 00 00 
+  802d2d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d32:	49 b8 62 33 80 00 00 	movabs $0x803362,%r8
+  802d39:	00 00 00 
+  802d3c:	41 ff d0             	call   *%r8
+
+0000000000802d3f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d3f:	55                   	push   %rbp
+  802d40:	48 89 e5             	mov    %rsp,%rbp
+  802d43:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d47:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d4b:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  802d52:	00 00 00 
+  802d55:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d57:	85 c0                	test   %eax,%eax
+  802d59:	78 23                	js     802d7e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d5b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d5f:	48 b8 89 06 80 00 00 	movabs $0x800689,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d6e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d72:	48 b8 7a 28 80 00 00 	movabs $0x80287a,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+}
+  802d7e:	c9                   	leave
+  802d7f:	c3                   	ret
+
+0000000000802d80 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d80:	48 89 f8             	mov    %rdi,%rax
+  802d83:	48 c1 e8 27          	shr    $0x27,%rax
+  802d87:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d8e:	01 00 00 
+  802d91:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d95:	f6 c2 01             	test   $0x1,%dl
+  802d98:	74 6d                	je     802e07 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d9a:	48 89 f8             	mov    %rdi,%rax
+  802d9d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802da1:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802da8:	01 00 00 
+  802dab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802daf:	f6 c2 01             	test   $0x1,%dl
+  802db2:	74 62                	je     802e16 <get_uvpt_entry+0x96>
+  802db4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dbb:	01 00 00 
+  802dbe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dc2:	f6 c2 80             	test   $0x80,%dl
+  802dc5:	75 4f                	jne    802e16 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802dc7:	48 89 f8             	mov    %rdi,%rax
+  802dca:	48 c1 e8 15          	shr    $0x15,%rax
+  802dce:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dd5:	01 00 00 
+  802dd8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ddc:	f6 c2 01             	test   $0x1,%dl
+  802ddf:	74 44                	je     802e25 <get_uvpt_entry+0xa5>
+  802de1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802de8:	01 00 00 
+  802deb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802def:	f6 c2 80             	test   $0x80,%dl
+  802df2:	75 31                	jne    802e25 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802df4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802df8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802dff:	01 00 00 
+  802e02:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e06:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e07:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e0e:	01 00 00 
+  802e11:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e15:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e16:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e1d:	01 00 00 
+  802e20:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e24:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e25:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e2c:	01 00 00 
+  802e2f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e33:	c3                   	ret
+
+0000000000802e34 <get_prot>:
+
+int
+get_prot(void *va) {
+  802e34:	55                   	push   %rbp
+  802e35:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e38:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+  802e44:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e47:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e4c:	89 c1                	mov    %eax,%ecx
+  802e4e:	83 c9 04             	or     $0x4,%ecx
+  802e51:	f6 c2 01             	test   $0x1,%dl
+  802e54:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e57:	89 c1                	mov    %eax,%ecx
+  802e59:	83 c9 02             	or     $0x2,%ecx
+  802e5c:	f6 c2 02             	test   $0x2,%dl
+  802e5f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e62:	89 c1                	mov    %eax,%ecx
+  802e64:	83 c9 01             	or     $0x1,%ecx
+  802e67:	48 85 d2             	test   %rdx,%rdx
+  802e6a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e6d:	89 c1                	mov    %eax,%ecx
+  802e6f:	83 c9 40             	or     $0x40,%ecx
+  802e72:	f6 c6 04             	test   $0x4,%dh
+  802e75:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e78:	5d                   	pop    %rbp
+  802e79:	c3                   	ret
+
+0000000000802e7a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e7a:	55                   	push   %rbp
+  802e7b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e7e:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802e85:	00 00 00 
+  802e88:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e8a:	48 c1 e8 06          	shr    $0x6,%rax
+  802e8e:	83 e0 01             	and    $0x1,%eax
+}
+  802e91:	5d                   	pop    %rbp
+  802e92:	c3                   	ret
+
+0000000000802e93 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e93:	55                   	push   %rbp
+  802e94:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802e97:	48 b8 80 2d 80 00 00 	movabs $0x802d80,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	83 e0 01             	and    $0x1,%eax
+}
+  802ea6:	5d                   	pop    %rbp
+  802ea7:	c3                   	ret
+
+0000000000802ea8 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802ea8:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802eaf:	01 00 00 
+  802eb2:	a8 01                	test   $0x1,%al
+  802eb4:	75 06                	jne    802ebc <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ebb:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ebc:	55                   	push   %rbp
+  802ebd:	48 89 e5             	mov    %rsp,%rbp
+  802ec0:	41 57                	push   %r15
+  802ec2:	41 56                	push   %r14
+  802ec4:	41 55                	push   %r13
+  802ec6:	41 54                	push   %r12
+  802ec8:	53                   	push   %rbx
+  802ec9:	48 83 ec 28          	sub    $0x28,%rsp
+  802ecd:	49 89 fe             	mov    %rdi,%r14
+  802ed0:	49 89 f7             	mov    %rsi,%r15
+  802ed3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802eda:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802edb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ee2:	01 00 00 
+  802ee5:	e9 ae 00 00 00       	jmp    802f98 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802eea:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ef1:	49 83 ec 01          	sub    $0x1,%r12
+  802ef5:	74 2d                	je     802f24 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ef7:	48 89 d8             	mov    %rbx,%rax
+  802efa:	48 c1 e8 0c          	shr    $0xc,%rax
+  802efe:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f03:	f6 c2 01             	test   $0x1,%dl
+  802f06:	74 e2                	je     802eea <foreach_shared_region+0x42>
+  802f08:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f0d:	f6 c4 04             	test   $0x4,%ah
+  802f10:	74 d8                	je     802eea <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f12:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f19:	4c 89 fa             	mov    %r15,%rdx
+  802f1c:	48 89 df             	mov    %rbx,%rdi
+  802f1f:	41 ff d6             	call   *%r14
+  802f22:	eb c6                	jmp    802eea <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f24:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f2b:	00 
+  802f2c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f31:	74 4a                	je     802f7d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f33:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f37:	48 c1 e8 15          	shr    $0x15,%rax
+  802f3b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f42:	01 00 00 
+  802f45:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f49:	a8 01                	test   $0x1,%al
+  802f4b:	74 d7                	je     802f24 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f4d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f51:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f58:	48 39 c3             	cmp    %rax,%rbx
+  802f5b:	73 c7                	jae    802f24 <foreach_shared_region+0x7c>
+  802f5d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f64:	48 39 d0             	cmp    %rdx,%rax
+  802f67:	4d 19 e4             	sbb    %r12,%r12
+  802f6a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f71:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f78:	e9 7a ff ff ff       	jmp    802ef7 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f7d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f84:	40 
+  802f85:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f89:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f90:	00 00 00 
+  802f93:	48 39 c1             	cmp    %rax,%rcx
+  802f96:	74 50                	je     802fe8 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802f98:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f9c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fa0:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fa7:	01 00 00 
+  802faa:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fae:	a8 01                	test   $0x1,%al
+  802fb0:	74 cb                	je     802f7d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fb2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fb6:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fbd:	48 39 c1             	cmp    %rax,%rcx
+  802fc0:	73 bb                	jae    802f7d <foreach_shared_region+0xd5>
+  802fc2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fc9:	48 39 d0             	cmp    %rdx,%rax
+  802fcc:	48 19 c0             	sbb    %rax,%rax
+  802fcf:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fd5:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fdf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fe3:	e9 4b ff ff ff       	jmp    802f33 <foreach_shared_region+0x8b>
+  802fe8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fed:	48 83 c4 28          	add    $0x28,%rsp
+  802ff1:	5b                   	pop    %rbx
+  802ff2:	41 5c                	pop    %r12
+  802ff4:	41 5d                	pop    %r13
+  802ff6:	41 5e                	pop    %r14
+  802ff8:	41 5f                	pop    %r15
+  802ffa:	5d                   	pop    %rbp
+  802ffb:	c3                   	ret
+
+0000000000802ffc <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  802ffc:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803002:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803009:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803010:	c3                   	ret
+
+0000000000803011 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803011:	8b 47 40             	mov    0x40(%rdi),%eax
+  803014:	8b 17                	mov    (%rdi),%edx
+  803016:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803018:	83 f8 0f             	cmp    $0xf,%eax
+  80301b:	77 13                	ja     803030 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80301d:	8b 47 40             	mov    0x40(%rdi),%eax
+  803020:	83 e0 0f             	and    $0xf,%eax
+  803023:	48 c1 e0 09          	shl    $0x9,%rax
+  803027:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80302e:	00 
+  80302f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803030:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803035:	c3                   	ret
+
+0000000000803036 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803036:	8b 47 40             	mov    0x40(%rdi),%eax
+  803039:	83 c0 01             	add    $0x1,%eax
+  80303c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80303f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803045:	8b 57 04             	mov    0x4(%rdi),%edx
+  803048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80304d:	85 d2                	test   %edx,%edx
+  80304f:	75 04                	jne    803055 <chan_publish+0x1f>
+  803051:	83 e0 01             	and    $0x1,%eax
+}
+  803054:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803055:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803058:	85 c0                	test   %eax,%eax
+  80305a:	0f 95 c0             	setne  %al
+  80305d:	0f b6 c0             	movzbl %al,%eax
+  803060:	eb ef                	jmp    803051 <chan_publish+0x1b>
+
+0000000000803062 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803062:	8b 47 40             	mov    0x40(%rdi),%eax
+  803065:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803067:	29 d0                	sub    %edx,%eax
+  803069:	83 e8 01             	sub    $0x1,%eax
+  80306c:	83 f8 0f             	cmp    $0xf,%eax
+  80306f:	77 12                	ja     803083 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803071:	8b 07                	mov    (%rdi),%eax
+  803073:	83 e0 0f             	and    $0xf,%eax
+  803076:	48 c1 e0 09          	shl    $0x9,%rax
+  80307a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803081:	00 
+  803082:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803083:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803088:	c3                   	ret
+
+0000000000803089 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803089:	8b 07                	mov    (%rdi),%eax
+  80308b:	83 c0 01             	add    $0x1,%eax
+  80308e:	89 07                	mov    %eax,(%rdi)
+}
+  803090:	c3                   	ret
+
+0000000000803091 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803091:	55                   	push   %rbp
+  803092:	48 89 e5             	mov    %rsp,%rbp
+  803095:	53                   	push   %rbx
+  803096:	48 83 ec 08          	sub    $0x8,%rsp
+  80309a:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80309d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030a4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030aa:	48 b8 62 30 80 00 00 	movabs $0x803062,%rax
+  8030b1:	00 00 00 
+  8030b4:	ff d0                	call   *%rax
+  8030b6:	48 85 c0             	test   %rax,%rax
+  8030b9:	74 12                	je     8030cd <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030bb:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030cb:	c9                   	leave
+  8030cc:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030cd:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030d2:	eb f3                	jmp    8030c7 <chan_arm+0x36>
+
+00000000008030d4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030d4:	55                   	push   %rbp
+  8030d5:	48 89 e5             	mov    %rsp,%rbp
+  8030d8:	41 56                	push   %r14
+  8030da:	41 55                	push   %r13
+  8030dc:	41 54                	push   %r12
+  8030de:	53                   	push   %rbx
+  8030df:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030e2:	49 bc 91 30 80 00 00 	movabs $0x803091,%r12
+  8030e9:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030ec:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030f0:	49 bd b2 05 80 00 00 	movabs $0x8005b2,%r13
+  8030f7:	00 00 00 
+    while (chan_arm(r))
+  8030fa:	eb 0d                	jmp    803109 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030fc:	8b 33                	mov    (%rbx),%esi
+  8030fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  803103:	4c 89 f7             	mov    %r14,%rdi
+  803106:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803109:	48 89 df             	mov    %rbx,%rdi
+  80310c:	41 ff d4             	call   *%r12
+  80310f:	84 c0                	test   %al,%al
+  803111:	75 e9                	jne    8030fc <chan_wait+0x28>
+}
+  803113:	5b                   	pop    %rbx
+  803114:	41 5c                	pop    %r12
+  803116:	41 5d                	pop    %r13
+  803118:	41 5e                	pop    %r14
+  80311a:	5d                   	pop    %rbp
+  80311b:	c3                   	ret
+
+000000000080311c <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80311c:	55                   	push   %rbp
+  80311d:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803120:	48 83 c7 40          	add    $0x40,%rdi
+  803124:	be 01 00 00 00       	mov    $0x1,%esi
+  803129:	48 b8 d0 05 80 00 00 	movabs $0x8005d0,%rax
+  803130:	00 00 00 
+  803133:	ff d0                	call   *%rax
+}
+  803135:	5d                   	pop    %rbp
+  803136:	c3                   	ret
+
+0000000000803137 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803137:	b8 00 00 00 00       	mov    $0x0,%eax
+  80313c:	c3                   	ret
+
+000000000080313d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80313d:	55                   	push   %rbp
+  80313e:	48 89 e5             	mov    %rsp,%rbp
+  803141:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803144:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  80314b:	00 00 00 
+  80314e:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+    return 0;
+}
+  80315a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80315f:	5d                   	pop    %rbp
+  803160:	c3                   	ret
+
+0000000000803161 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803161:	55                   	push   %rbp
+  803162:	48 89 e5             	mov    %rsp,%rbp
+  803165:	41 57                	push   %r15
+  803167:	41 56                	push   %r14
+  803169:	41 55                	push   %r13
+  80316b:	41 54                	push   %r12
+  80316d:	53                   	push   %rbx
+  80316e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803175:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80317c:	48 85 d2             	test   %rdx,%rdx
+  80317f:	74 7a                	je     8031fb <devcons_write+0x9a>
+  803181:	49 89 d6             	mov    %rdx,%r14
+  803184:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80318a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80318f:	49 bf d1 3f 80 00 00 	movabs $0x803fd1,%r15
+  803196:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803199:	4c 89 f3             	mov    %r14,%rbx
+  80319c:	48 29 f3             	sub    %rsi,%rbx
+  80319f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031a4:	48 39 c3             	cmp    %rax,%rbx
+  8031a7:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031ab:	4c 63 eb             	movslq %ebx,%r13
+  8031ae:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031b5:	48 01 c6             	add    %rax,%rsi
+  8031b8:	4c 89 ea             	mov    %r13,%rdx
+  8031bb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031c2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031c5:	4c 89 ee             	mov    %r13,%rsi
+  8031c8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031cf:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8031d6:	00 00 00 
+  8031d9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031db:	41 01 dc             	add    %ebx,%r12d
+  8031de:	49 63 f4             	movslq %r12d,%rsi
+  8031e1:	4c 39 f6             	cmp    %r14,%rsi
+  8031e4:	72 b3                	jb     803199 <devcons_write+0x38>
+    return res;
+  8031e6:	49 63 c4             	movslq %r12d,%rax
+}
+  8031e9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031f0:	5b                   	pop    %rbx
+  8031f1:	41 5c                	pop    %r12
+  8031f3:	41 5d                	pop    %r13
+  8031f5:	41 5e                	pop    %r14
+  8031f7:	41 5f                	pop    %r15
+  8031f9:	5d                   	pop    %rbp
+  8031fa:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8031fb:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803201:	eb e3                	jmp    8031e6 <devcons_write+0x85>
+
+0000000000803203 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803203:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320b:	48 85 c0             	test   %rax,%rax
+  80320e:	74 55                	je     803265 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803210:	55                   	push   %rbp
+  803211:	48 89 e5             	mov    %rsp,%rbp
+  803214:	41 55                	push   %r13
+  803216:	41 54                	push   %r12
+  803218:	53                   	push   %rbx
+  803219:	48 83 ec 08          	sub    $0x8,%rsp
+  80321d:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803220:	48 bb 2b 01 80 00 00 	movabs $0x80012b,%rbx
+  803227:	00 00 00 
+  80322a:	49 bc e0 01 80 00 00 	movabs $0x8001e0,%r12
+  803231:	00 00 00 
+  803234:	eb 03                	jmp    803239 <devcons_read+0x36>
+  803236:	41 ff d4             	call   *%r12
+  803239:	ff d3                	call   *%rbx
+  80323b:	85 c0                	test   %eax,%eax
+  80323d:	74 f7                	je     803236 <devcons_read+0x33>
+    if (c < 0) return c;
+  80323f:	48 63 d0             	movslq %eax,%rdx
+  803242:	78 13                	js     803257 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803244:	ba 00 00 00 00       	mov    $0x0,%edx
+  803249:	83 f8 04             	cmp    $0x4,%eax
+  80324c:	74 09                	je     803257 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80324e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803252:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803257:	48 89 d0             	mov    %rdx,%rax
+  80325a:	48 83 c4 08          	add    $0x8,%rsp
+  80325e:	5b                   	pop    %rbx
+  80325f:	41 5c                	pop    %r12
+  803261:	41 5d                	pop    %r13
+  803263:	5d                   	pop    %rbp
+  803264:	c3                   	ret
+  803265:	48 89 d0             	mov    %rdx,%rax
+  803268:	c3                   	ret
+
+0000000000803269 <cputchar>:
+cputchar(int ch) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803271:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803275:	be 01 00 00 00       	mov    $0x1,%esi
+  80327a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80327e:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+}
+  80328a:	c9                   	leave
+  80328b:	c3                   	ret
+
+000000000080328c <getchar>:
+getchar(void) {
+  80328c:	55                   	push   %rbp
+  80328d:	48 89 e5             	mov    %rsp,%rbp
+  803290:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803294:	ba 01 00 00 00       	mov    $0x1,%edx
+  803299:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80329d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a2:	48 b8 e8 09 80 00 00 	movabs $0x8009e8,%rax
+  8032a9:	00 00 00 
+  8032ac:	ff d0                	call   *%rax
+  8032ae:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032b0:	85 c0                	test   %eax,%eax
+  8032b2:	78 06                	js     8032ba <getchar+0x2e>
+  8032b4:	74 08                	je     8032be <getchar+0x32>
+  8032b6:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032ba:	89 d0                	mov    %edx,%eax
+  8032bc:	c9                   	leave
+  8032bd:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032be:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032c3:	eb f5                	jmp    8032ba <getchar+0x2e>
+
+00000000008032c5 <iscons>:
+iscons(int fdnum) {
+  8032c5:	55                   	push   %rbp
+  8032c6:	48 89 e5             	mov    %rsp,%rbp
+  8032c9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032cd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032d1:	48 b8 05 07 80 00 00 	movabs $0x800705,%rax
+  8032d8:	00 00 00 
+  8032db:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032dd:	85 c0                	test   %eax,%eax
+  8032df:	78 18                	js     8032f9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032e1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032e5:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032ec:	00 00 00 
+  8032ef:	8b 00                	mov    (%rax),%eax
+  8032f1:	39 02                	cmp    %eax,(%rdx)
+  8032f3:	0f 94 c0             	sete   %al
+  8032f6:	0f b6 c0             	movzbl %al,%eax
+}
+  8032f9:	c9                   	leave
+  8032fa:	c3                   	ret
+
+00000000008032fb <opencons>:
+opencons(void) {
+  8032fb:	55                   	push   %rbp
+  8032fc:	48 89 e5             	mov    %rsp,%rbp
+  8032ff:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803303:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803307:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 49                	js     803360 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803317:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80331c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803321:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803325:	bf 00 00 00 00       	mov    $0x0,%edi
+  80332a:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  803331:	00 00 00 
+  803334:	ff d0                	call   *%rax
+  803336:	85 c0                	test   %eax,%eax
+  803338:	78 26                	js     803360 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80333a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80333e:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803345:	00 00 
+  803347:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803349:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80334d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803354:	48 b8 77 06 80 00 00 	movabs $0x800677,%rax
+  80335b:	00 00 00 
+  80335e:	ff d0                	call   *%rax
+}
+  803360:	c9                   	leave
+  803361:	c3                   	ret
+
+0000000000803362 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803362:	55                   	push   %rbp
+  803363:	48 89 e5             	mov    %rsp,%rbp
+  803366:	41 56                	push   %r14
+  803368:	41 55                	push   %r13
+  80336a:	41 54                	push   %r12
+  80336c:	53                   	push   %rbx
+  80336d:	48 83 ec 50          	sub    $0x50,%rsp
+  803371:	49 89 fc             	mov    %rdi,%r12
+  803374:	41 89 f5             	mov    %esi,%r13d
+  803377:	48 89 d3             	mov    %rdx,%rbx
+  80337a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80337e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803382:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803386:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80338d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803391:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803395:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  803399:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80339d:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8033a4:	00 00 00 
+  8033a7:	4c 8b 30             	mov    (%rax),%r14
+  8033aa:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  8033b1:	00 00 00 
+  8033b4:	ff d0                	call   *%rax
+  8033b6:	89 c6                	mov    %eax,%esi
+  8033b8:	45 89 e8             	mov    %r13d,%r8d
+  8033bb:	4c 89 e1             	mov    %r12,%rcx
+  8033be:	4c 89 f2             	mov    %r14,%rdx
+  8033c1:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033c8:	00 00 00 
+  8033cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033d0:	49 bc b2 34 80 00 00 	movabs $0x8034b2,%r12
+  8033d7:	00 00 00 
+  8033da:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033dd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033e1:	48 89 df             	mov    %rbx,%rdi
+  8033e4:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  8033eb:	00 00 00 
+  8033ee:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033f0:	48 bf 33 47 80 00 00 	movabs $0x804733,%rdi
+  8033f7:	00 00 00 
+  8033fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ff:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  803402:	cc                   	int3
+  803403:	eb fd                	jmp    803402 <_panic+0xa0>
+
+0000000000803405 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  803405:	55                   	push   %rbp
+  803406:	48 89 e5             	mov    %rsp,%rbp
+  803409:	53                   	push   %rbx
+  80340a:	48 83 ec 08          	sub    $0x8,%rsp
+  80340e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803411:	8b 06                	mov    (%rsi),%eax
+  803413:	8d 50 01             	lea    0x1(%rax),%edx
+  803416:	89 16                	mov    %edx,(%rsi)
+  803418:	48 98                	cltq
+  80341a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80341f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803425:	74 0a                	je     803431 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803427:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80342b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80342f:	c9                   	leave
+  803430:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803431:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803435:	be ff 00 00 00       	mov    $0xff,%esi
+  80343a:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  803441:	00 00 00 
+  803444:	ff d0                	call   *%rax
+        state->offset = 0;
+  803446:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80344c:	eb d9                	jmp    803427 <putch+0x22>
+
+000000000080344e <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80344e:	55                   	push   %rbp
+  80344f:	48 89 e5             	mov    %rsp,%rbp
+  803452:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803459:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80345c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803463:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80346d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803470:	48 89 f1             	mov    %rsi,%rcx
+  803473:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80347a:	48 bf 05 34 80 00 00 	movabs $0x803405,%rdi
+  803481:	00 00 00 
+  803484:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  80348b:	00 00 00 
+  80348e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803490:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803497:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80349e:	48 b8 0c 01 80 00 00 	movabs $0x80010c,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034aa:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034b0:	c9                   	leave
+  8034b1:	c3                   	ret
+
+00000000008034b2 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034b2:	55                   	push   %rbp
+  8034b3:	48 89 e5             	mov    %rsp,%rbp
+  8034b6:	48 83 ec 50          	sub    $0x50,%rsp
+  8034ba:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034be:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034c2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034c6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034ca:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034ce:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034d5:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034dd:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034e1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034e5:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034e9:	48 b8 4e 34 80 00 00 	movabs $0x80344e,%rax
+  8034f0:	00 00 00 
+  8034f3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8034f5:	c9                   	leave
+  8034f6:	c3                   	ret
+
+00000000008034f7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8034f7:	55                   	push   %rbp
+  8034f8:	48 89 e5             	mov    %rsp,%rbp
+  8034fb:	41 57                	push   %r15
+  8034fd:	41 56                	push   %r14
+  8034ff:	41 55                	push   %r13
+  803501:	41 54                	push   %r12
+  803503:	53                   	push   %rbx
+  803504:	48 83 ec 18          	sub    $0x18,%rsp
+  803508:	49 89 fc             	mov    %rdi,%r12
+  80350b:	49 89 f5             	mov    %rsi,%r13
+  80350e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803512:	8b 45 10             	mov    0x10(%rbp),%eax
+  803515:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803518:	41 89 cf             	mov    %ecx,%r15d
+  80351b:	4c 39 fa             	cmp    %r15,%rdx
+  80351e:	73 5b                	jae    80357b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803520:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803524:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803528:	85 db                	test   %ebx,%ebx
+  80352a:	7e 0e                	jle    80353a <print_num+0x43>
+            putch(padc, put_arg);
+  80352c:	4c 89 ee             	mov    %r13,%rsi
+  80352f:	44 89 f7             	mov    %r14d,%edi
+  803532:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803535:	83 eb 01             	sub    $0x1,%ebx
+  803538:	75 f2                	jne    80352c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80353a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80353e:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  803545:	00 00 00 
+  803548:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  80354f:	00 00 00 
+  803552:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803556:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80355a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80355f:	49 f7 f7             	div    %r15
+  803562:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803566:	4c 89 ee             	mov    %r13,%rsi
+  803569:	41 ff d4             	call   *%r12
+}
+  80356c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803570:	5b                   	pop    %rbx
+  803571:	41 5c                	pop    %r12
+  803573:	41 5d                	pop    %r13
+  803575:	41 5e                	pop    %r14
+  803577:	41 5f                	pop    %r15
+  803579:	5d                   	pop    %rbp
+  80357a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80357b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80357f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803584:	49 f7 f7             	div    %r15
+  803587:	48 83 ec 08          	sub    $0x8,%rsp
+  80358b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80358f:	52                   	push   %rdx
+  803590:	45 0f be c9          	movsbl %r9b,%r9d
+  803594:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  803598:	48 89 c2             	mov    %rax,%rdx
+  80359b:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  8035a2:	00 00 00 
+  8035a5:	ff d0                	call   *%rax
+  8035a7:	48 83 c4 10          	add    $0x10,%rsp
+  8035ab:	eb 8d                	jmp    80353a <print_num+0x43>
+
+00000000008035ad <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035ad:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035b1:	48 8b 06             	mov    (%rsi),%rax
+  8035b4:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035b8:	73 0a                	jae    8035c4 <sprintputch+0x17>
+        *state->start++ = ch;
+  8035ba:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035be:	48 89 16             	mov    %rdx,(%rsi)
+  8035c1:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035c4:	c3                   	ret
+
+00000000008035c5 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035c5:	55                   	push   %rbp
+  8035c6:	48 89 e5             	mov    %rsp,%rbp
+  8035c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8035cd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035d1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035d5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035d9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035e8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035ec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035f0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035f4:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  8035fb:	00 00 00 
+  8035fe:	ff d0                	call   *%rax
+}
+  803600:	c9                   	leave
+  803601:	c3                   	ret
+
+0000000000803602 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  803602:	55                   	push   %rbp
+  803603:	48 89 e5             	mov    %rsp,%rbp
+  803606:	41 57                	push   %r15
+  803608:	41 56                	push   %r14
+  80360a:	41 55                	push   %r13
+  80360c:	41 54                	push   %r12
+  80360e:	53                   	push   %rbx
+  80360f:	48 83 ec 38          	sub    $0x38,%rsp
+  803613:	49 89 fe             	mov    %rdi,%r14
+  803616:	49 89 f5             	mov    %rsi,%r13
+  803619:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80361c:	48 8b 01             	mov    (%rcx),%rax
+  80361f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803623:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80362b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80362f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803633:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803637:	0f b6 3b             	movzbl (%rbx),%edi
+  80363a:	40 80 ff 25          	cmp    $0x25,%dil
+  80363e:	74 18                	je     803658 <vprintfmt+0x56>
+            if (!ch) return;
+  803640:	40 84 ff             	test   %dil,%dil
+  803643:	0f 84 b1 06 00 00    	je     803cfa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803649:	40 0f b6 ff          	movzbl %dil,%edi
+  80364d:	4c 89 ee             	mov    %r13,%rsi
+  803650:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803653:	4c 89 e3             	mov    %r12,%rbx
+  803656:	eb db                	jmp    803633 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803658:	be 00 00 00 00       	mov    $0x0,%esi
+  80365d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803661:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803666:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80366c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803673:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803677:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80367c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803681:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803684:	83 e8 23             	sub    $0x23,%eax
+  803687:	3c 57                	cmp    $0x57,%al
+  803689:	0f 87 51 06 00 00    	ja     803ce0 <vprintfmt+0x6de>
+  80368f:	0f b6 c0             	movzbl %al,%eax
+  803692:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  803699:	00 00 00 
+  80369c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80369f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036a2:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036a6:	eb cf                	jmp    803677 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036a8:	49 89 dc             	mov    %rbx,%r12
+  8036ab:	be 01 00 00 00       	mov    $0x1,%esi
+  8036b0:	eb c5                	jmp    803677 <vprintfmt+0x75>
+            padc = ch;
+  8036b2:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036b6:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036b9:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036bc:	eb b9                	jmp    803677 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036be:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036c1:	83 f8 2f             	cmp    $0x2f,%eax
+  8036c4:	77 24                	ja     8036ea <vprintfmt+0xe8>
+  8036c6:	89 c1                	mov    %eax,%ecx
+  8036c8:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036cc:	83 c0 08             	add    $0x8,%eax
+  8036cf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036d2:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036d5:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036d8:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036dc:	79 99                	jns    803677 <vprintfmt+0x75>
+                width = precision;
+  8036de:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036e2:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036e8:	eb 8d                	jmp    803677 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036ea:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036ee:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036f6:	eb da                	jmp    8036d2 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8036f8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8036fd:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803701:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803707:	3c 39                	cmp    $0x39,%al
+  803709:	77 1c                	ja     803727 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80370b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80370f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803713:	0f b6 c0             	movzbl %al,%eax
+  803716:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80371b:	0f b6 03             	movzbl (%rbx),%eax
+  80371e:	3c 39                	cmp    $0x39,%al
+  803720:	76 e9                	jbe    80370b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803722:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803725:	eb b1                	jmp    8036d8 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803727:	49 89 dc             	mov    %rbx,%r12
+  80372a:	eb ac                	jmp    8036d8 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80372c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80372f:	85 c9                	test   %ecx,%ecx
+  803731:	b8 00 00 00 00       	mov    $0x0,%eax
+  803736:	0f 49 c1             	cmovns %ecx,%eax
+  803739:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80373c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80373f:	e9 33 ff ff ff       	jmp    803677 <vprintfmt+0x75>
+            lflag++;
+  803744:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803747:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80374a:	e9 28 ff ff ff       	jmp    803677 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80374f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803752:	83 f8 2f             	cmp    $0x2f,%eax
+  803755:	77 19                	ja     803770 <vprintfmt+0x16e>
+  803757:	89 c2                	mov    %eax,%edx
+  803759:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80375d:	83 c0 08             	add    $0x8,%eax
+  803760:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803763:	8b 3a                	mov    (%rdx),%edi
+  803765:	4c 89 ee             	mov    %r13,%rsi
+  803768:	41 ff d6             	call   *%r14
+            break;
+  80376b:	e9 c3 fe ff ff       	jmp    803633 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803770:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803774:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803778:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80377c:	eb e5                	jmp    803763 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80377e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803781:	83 f8 2f             	cmp    $0x2f,%eax
+  803784:	77 5a                	ja     8037e0 <vprintfmt+0x1de>
+  803786:	89 c2                	mov    %eax,%edx
+  803788:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80378c:	83 c0 08             	add    $0x8,%eax
+  80378f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803792:	8b 02                	mov    (%rdx),%eax
+  803794:	89 c1                	mov    %eax,%ecx
+  803796:	f7 d9                	neg    %ecx
+  803798:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80379b:	83 f9 16             	cmp    $0x16,%ecx
+  80379e:	7f 4e                	jg     8037ee <vprintfmt+0x1ec>
+  8037a0:	48 63 c1             	movslq %ecx,%rax
+  8037a3:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  8037aa:	00 00 00 
+  8037ad:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037b1:	48 85 c0             	test   %rax,%rax
+  8037b4:	74 38                	je     8037ee <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037b6:	48 89 c1             	mov    %rax,%rcx
+  8037b9:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037c0:	00 00 00 
+  8037c3:	4c 89 ee             	mov    %r13,%rsi
+  8037c6:	4c 89 f7             	mov    %r14,%rdi
+  8037c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037ce:	49 b8 c5 35 80 00 00 	movabs $0x8035c5,%r8
+  8037d5:	00 00 00 
+  8037d8:	41 ff d0             	call   *%r8
+  8037db:	e9 53 fe ff ff       	jmp    803633 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037ec:	eb a4                	jmp    803792 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037ee:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  8037f5:	00 00 00 
+  8037f8:	4c 89 ee             	mov    %r13,%rsi
+  8037fb:	4c 89 f7             	mov    %r14,%rdi
+  8037fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803803:	49 b8 c5 35 80 00 00 	movabs $0x8035c5,%r8
+  80380a:	00 00 00 
+  80380d:	41 ff d0             	call   *%r8
+  803810:	e9 1e fe ff ff       	jmp    803633 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803815:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803818:	83 f8 2f             	cmp    $0x2f,%eax
+  80381b:	77 6c                	ja     803889 <vprintfmt+0x287>
+  80381d:	89 c2                	mov    %eax,%edx
+  80381f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803823:	83 c0 08             	add    $0x8,%eax
+  803826:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803829:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80382c:	48 85 d2             	test   %rdx,%rdx
+  80382f:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  803836:	00 00 00 
+  803839:	48 0f 45 c2          	cmovne %rdx,%rax
+  80383d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803841:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803845:	7e 06                	jle    80384d <vprintfmt+0x24b>
+  803847:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80384b:	75 4a                	jne    803897 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80384d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803851:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803855:	0f b6 00             	movzbl (%rax),%eax
+  803858:	84 c0                	test   %al,%al
+  80385a:	0f 85 9a 00 00 00    	jne    8038fa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803860:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803863:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803867:	85 c0                	test   %eax,%eax
+  803869:	0f 8e c4 fd ff ff    	jle    803633 <vprintfmt+0x31>
+  80386f:	4c 89 ee             	mov    %r13,%rsi
+  803872:	bf 20 00 00 00       	mov    $0x20,%edi
+  803877:	41 ff d6             	call   *%r14
+  80387a:	41 83 ec 01          	sub    $0x1,%r12d
+  80387e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803882:	75 eb                	jne    80386f <vprintfmt+0x26d>
+  803884:	e9 aa fd ff ff       	jmp    803633 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803889:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80388d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803895:	eb 92                	jmp    803829 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803897:	49 63 f7             	movslq %r15d,%rsi
+  80389a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80389e:	48 b8 b4 3d 80 00 00 	movabs $0x803db4,%rax
+  8038a5:	00 00 00 
+  8038a8:	ff d0                	call   *%rax
+  8038aa:	48 89 c2             	mov    %rax,%rdx
+  8038ad:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038b0:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038b2:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038b5:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038b8:	85 c0                	test   %eax,%eax
+  8038ba:	7e 91                	jle    80384d <vprintfmt+0x24b>
+  8038bc:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038c1:	4c 89 ee             	mov    %r13,%rsi
+  8038c4:	44 89 e7             	mov    %r12d,%edi
+  8038c7:	41 ff d6             	call   *%r14
+  8038ca:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038ce:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038d1:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038d4:	75 eb                	jne    8038c1 <vprintfmt+0x2bf>
+  8038d6:	e9 72 ff ff ff       	jmp    80384d <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038db:	0f b6 f8             	movzbl %al,%edi
+  8038de:	4c 89 ee             	mov    %r13,%rsi
+  8038e1:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038e4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038e8:	49 83 c4 01          	add    $0x1,%r12
+  8038ec:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038f2:	84 c0                	test   %al,%al
+  8038f4:	0f 84 66 ff ff ff    	je     803860 <vprintfmt+0x25e>
+  8038fa:	45 85 ff             	test   %r15d,%r15d
+  8038fd:	78 0a                	js     803909 <vprintfmt+0x307>
+  8038ff:	41 83 ef 01          	sub    $0x1,%r15d
+  803903:	0f 88 57 ff ff ff    	js     803860 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803909:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80390d:	74 cc                	je     8038db <vprintfmt+0x2d9>
+  80390f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803912:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803917:	80 fa 5e             	cmp    $0x5e,%dl
+  80391a:	77 c2                	ja     8038de <vprintfmt+0x2dc>
+  80391c:	eb bd                	jmp    8038db <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80391e:	40 84 f6             	test   %sil,%sil
+  803921:	75 26                	jne    803949 <vprintfmt+0x347>
+    switch (lflag) {
+  803923:	85 d2                	test   %edx,%edx
+  803925:	74 59                	je     803980 <vprintfmt+0x37e>
+  803927:	83 fa 01             	cmp    $0x1,%edx
+  80392a:	74 7b                	je     8039a7 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80392c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80392f:	83 f8 2f             	cmp    $0x2f,%eax
+  803932:	0f 87 96 00 00 00    	ja     8039ce <vprintfmt+0x3cc>
+  803938:	89 c2                	mov    %eax,%edx
+  80393a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80393e:	83 c0 08             	add    $0x8,%eax
+  803941:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803944:	4c 8b 22             	mov    (%rdx),%r12
+  803947:	eb 17                	jmp    803960 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803949:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80394c:	83 f8 2f             	cmp    $0x2f,%eax
+  80394f:	77 21                	ja     803972 <vprintfmt+0x370>
+  803951:	89 c2                	mov    %eax,%edx
+  803953:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803957:	83 c0 08             	add    $0x8,%eax
+  80395a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80395d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803960:	4d 85 e4             	test   %r12,%r12
+  803963:	78 7a                	js     8039df <vprintfmt+0x3dd>
+            num = i;
+  803965:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803968:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80396d:	e9 50 02 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80397a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80397e:	eb dd                	jmp    80395d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803980:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803983:	83 f8 2f             	cmp    $0x2f,%eax
+  803986:	77 11                	ja     803999 <vprintfmt+0x397>
+  803988:	89 c2                	mov    %eax,%edx
+  80398a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80398e:	83 c0 08             	add    $0x8,%eax
+  803991:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803994:	4c 63 22             	movslq (%rdx),%r12
+  803997:	eb c7                	jmp    803960 <vprintfmt+0x35e>
+  803999:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80399d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039a1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039a5:	eb ed                	jmp    803994 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8039ad:	77 11                	ja     8039c0 <vprintfmt+0x3be>
+  8039af:	89 c2                	mov    %eax,%edx
+  8039b1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039b5:	83 c0 08             	add    $0x8,%eax
+  8039b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039bb:	4c 8b 22             	mov    (%rdx),%r12
+  8039be:	eb a0                	jmp    803960 <vprintfmt+0x35e>
+  8039c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039cc:	eb ed                	jmp    8039bb <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039ce:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039d2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039da:	e9 65 ff ff ff       	jmp    803944 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039df:	4c 89 ee             	mov    %r13,%rsi
+  8039e2:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039e7:	41 ff d6             	call   *%r14
+                i = -i;
+  8039ea:	49 f7 dc             	neg    %r12
+  8039ed:	e9 73 ff ff ff       	jmp    803965 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039f2:	40 84 f6             	test   %sil,%sil
+  8039f5:	75 32                	jne    803a29 <vprintfmt+0x427>
+    switch (lflag) {
+  8039f7:	85 d2                	test   %edx,%edx
+  8039f9:	74 5d                	je     803a58 <vprintfmt+0x456>
+  8039fb:	83 fa 01             	cmp    $0x1,%edx
+  8039fe:	0f 84 82 00 00 00    	je     803a86 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a07:	83 f8 2f             	cmp    $0x2f,%eax
+  803a0a:	0f 87 a5 00 00 00    	ja     803ab5 <vprintfmt+0x4b3>
+  803a10:	89 c2                	mov    %eax,%edx
+  803a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a16:	83 c0 08             	add    $0x8,%eax
+  803a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a1c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a1f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a24:	e9 99 01 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a29:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a2c:	83 f8 2f             	cmp    $0x2f,%eax
+  803a2f:	77 19                	ja     803a4a <vprintfmt+0x448>
+  803a31:	89 c2                	mov    %eax,%edx
+  803a33:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a37:	83 c0 08             	add    $0x8,%eax
+  803a3a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a3d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a40:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a45:	e9 78 01 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+  803a4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a56:	eb e5                	jmp    803a3d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a58:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a5b:	83 f8 2f             	cmp    $0x2f,%eax
+  803a5e:	77 18                	ja     803a78 <vprintfmt+0x476>
+  803a60:	89 c2                	mov    %eax,%edx
+  803a62:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a66:	83 c0 08             	add    $0x8,%eax
+  803a69:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a6c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a6e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a73:	e9 4a 01 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+  803a78:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a7c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a80:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a84:	eb e6                	jmp    803a6c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a89:	83 f8 2f             	cmp    $0x2f,%eax
+  803a8c:	77 19                	ja     803aa7 <vprintfmt+0x4a5>
+  803a8e:	89 c2                	mov    %eax,%edx
+  803a90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a94:	83 c0 08             	add    $0x8,%eax
+  803a97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a9a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a9d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803aa2:	e9 1b 01 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+  803aa7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aaf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab3:	eb e5                	jmp    803a9a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803ab5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ab9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ac1:	e9 56 ff ff ff       	jmp    803a1c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ac6:	40 84 f6             	test   %sil,%sil
+  803ac9:	75 2e                	jne    803af9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803acb:	85 d2                	test   %edx,%edx
+  803acd:	74 59                	je     803b28 <vprintfmt+0x526>
+  803acf:	83 fa 01             	cmp    $0x1,%edx
+  803ad2:	74 7f                	je     803b53 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803ad4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ad7:	83 f8 2f             	cmp    $0x2f,%eax
+  803ada:	0f 87 9f 00 00 00    	ja     803b7f <vprintfmt+0x57d>
+  803ae0:	89 c2                	mov    %eax,%edx
+  803ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ae6:	83 c0 08             	add    $0x8,%eax
+  803ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aec:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803aef:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803af4:	e9 c9 00 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803afc:	83 f8 2f             	cmp    $0x2f,%eax
+  803aff:	77 19                	ja     803b1a <vprintfmt+0x518>
+  803b01:	89 c2                	mov    %eax,%edx
+  803b03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b07:	83 c0 08             	add    $0x8,%eax
+  803b0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b10:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b15:	e9 a8 00 00 00       	jmp    803bc2 <vprintfmt+0x5c0>
+  803b1a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b1e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b22:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b26:	eb e5                	jmp    803b0d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b2b:	83 f8 2f             	cmp    $0x2f,%eax
+  803b2e:	77 15                	ja     803b45 <vprintfmt+0x543>
+  803b30:	89 c2                	mov    %eax,%edx
+  803b32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b36:	83 c0 08             	add    $0x8,%eax
+  803b39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b3c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b3e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b43:	eb 7d                	jmp    803bc2 <vprintfmt+0x5c0>
+  803b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b51:	eb e9                	jmp    803b3c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b56:	83 f8 2f             	cmp    $0x2f,%eax
+  803b59:	77 16                	ja     803b71 <vprintfmt+0x56f>
+  803b5b:	89 c2                	mov    %eax,%edx
+  803b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b61:	83 c0 08             	add    $0x8,%eax
+  803b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b6f:	eb 51                	jmp    803bc2 <vprintfmt+0x5c0>
+  803b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b7d:	eb e8                	jmp    803b67 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b7f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b83:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b8b:	e9 5c ff ff ff       	jmp    803aec <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b90:	4c 89 ee             	mov    %r13,%rsi
+  803b93:	bf 30 00 00 00       	mov    $0x30,%edi
+  803b98:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803b9b:	4c 89 ee             	mov    %r13,%rsi
+  803b9e:	bf 78 00 00 00       	mov    $0x78,%edi
+  803ba3:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803ba6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ba9:	83 f8 2f             	cmp    $0x2f,%eax
+  803bac:	77 47                	ja     803bf5 <vprintfmt+0x5f3>
+  803bae:	89 c2                	mov    %eax,%edx
+  803bb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bb4:	83 c0 08             	add    $0x8,%eax
+  803bb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bbd:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bc2:	48 83 ec 08          	sub    $0x8,%rsp
+  803bc6:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bca:	0f 94 c0             	sete   %al
+  803bcd:	0f b6 c0             	movzbl %al,%eax
+  803bd0:	50                   	push   %rax
+  803bd1:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bd6:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bda:	4c 89 ee             	mov    %r13,%rsi
+  803bdd:	4c 89 f7             	mov    %r14,%rdi
+  803be0:	48 b8 f7 34 80 00 00 	movabs $0x8034f7,%rax
+  803be7:	00 00 00 
+  803bea:	ff d0                	call   *%rax
+            break;
+  803bec:	48 83 c4 10          	add    $0x10,%rsp
+  803bf0:	e9 3e fa ff ff       	jmp    803633 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803bf5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803bf9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bfd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c01:	eb b7                	jmp    803bba <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c03:	40 84 f6             	test   %sil,%sil
+  803c06:	75 2b                	jne    803c33 <vprintfmt+0x631>
+    switch (lflag) {
+  803c08:	85 d2                	test   %edx,%edx
+  803c0a:	74 56                	je     803c62 <vprintfmt+0x660>
+  803c0c:	83 fa 01             	cmp    $0x1,%edx
+  803c0f:	74 7f                	je     803c90 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c14:	83 f8 2f             	cmp    $0x2f,%eax
+  803c17:	0f 87 a2 00 00 00    	ja     803cbf <vprintfmt+0x6bd>
+  803c1d:	89 c2                	mov    %eax,%edx
+  803c1f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c23:	83 c0 08             	add    $0x8,%eax
+  803c26:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c29:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c2c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c31:	eb 8f                	jmp    803bc2 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c33:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c36:	83 f8 2f             	cmp    $0x2f,%eax
+  803c39:	77 19                	ja     803c54 <vprintfmt+0x652>
+  803c3b:	89 c2                	mov    %eax,%edx
+  803c3d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c41:	83 c0 08             	add    $0x8,%eax
+  803c44:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c47:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c4a:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c4f:	e9 6e ff ff ff       	jmp    803bc2 <vprintfmt+0x5c0>
+  803c54:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c58:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c5c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c60:	eb e5                	jmp    803c47 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c62:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c65:	83 f8 2f             	cmp    $0x2f,%eax
+  803c68:	77 18                	ja     803c82 <vprintfmt+0x680>
+  803c6a:	89 c2                	mov    %eax,%edx
+  803c6c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c70:	83 c0 08             	add    $0x8,%eax
+  803c73:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c76:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c78:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c7d:	e9 40 ff ff ff       	jmp    803bc2 <vprintfmt+0x5c0>
+  803c82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c8e:	eb e6                	jmp    803c76 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c93:	83 f8 2f             	cmp    $0x2f,%eax
+  803c96:	77 19                	ja     803cb1 <vprintfmt+0x6af>
+  803c98:	89 c2                	mov    %eax,%edx
+  803c9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c9e:	83 c0 08             	add    $0x8,%eax
+  803ca1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ca4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803ca7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803cac:	e9 11 ff ff ff       	jmp    803bc2 <vprintfmt+0x5c0>
+  803cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbd:	eb e5                	jmp    803ca4 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cbf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cc3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cc7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ccb:	e9 59 ff ff ff       	jmp    803c29 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cd0:	4c 89 ee             	mov    %r13,%rsi
+  803cd3:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cd8:	41 ff d6             	call   *%r14
+            break;
+  803cdb:	e9 53 f9 ff ff       	jmp    803633 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803ce0:	4c 89 ee             	mov    %r13,%rsi
+  803ce3:	bf 25 00 00 00       	mov    $0x25,%edi
+  803ce8:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803ceb:	48 83 eb 01          	sub    $0x1,%rbx
+  803cef:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803cf3:	75 f6                	jne    803ceb <vprintfmt+0x6e9>
+  803cf5:	e9 39 f9 ff ff       	jmp    803633 <vprintfmt+0x31>
+}
+  803cfa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803cfe:	5b                   	pop    %rbx
+  803cff:	41 5c                	pop    %r12
+  803d01:	41 5d                	pop    %r13
+  803d03:	41 5e                	pop    %r14
+  803d05:	41 5f                	pop    %r15
+  803d07:	5d                   	pop    %rbp
+  803d08:	c3                   	ret
+
+0000000000803d09 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d09:	55                   	push   %rbp
+  803d0a:	48 89 e5             	mov    %rsp,%rbp
+  803d0d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d11:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d15:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d1a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d1e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d25:	48 85 ff             	test   %rdi,%rdi
+  803d28:	74 2b                	je     803d55 <vsnprintf+0x4c>
+  803d2a:	48 85 f6             	test   %rsi,%rsi
+  803d2d:	74 26                	je     803d55 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d33:	48 bf ad 35 80 00 00 	movabs $0x8035ad,%rdi
+  803d3a:	00 00 00 
+  803d3d:	48 b8 02 36 80 00 00 	movabs $0x803602,%rax
+  803d44:	00 00 00 
+  803d47:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d49:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d4d:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d50:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d53:	c9                   	leave
+  803d54:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d5a:	eb f7                	jmp    803d53 <vsnprintf+0x4a>
+
+0000000000803d5c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d5c:	55                   	push   %rbp
+  803d5d:	48 89 e5             	mov    %rsp,%rbp
+  803d60:	48 83 ec 50          	sub    $0x50,%rsp
+  803d64:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d68:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d6c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d70:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d77:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d7b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d7f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d83:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d87:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d8b:	48 b8 09 3d 80 00 00 	movabs $0x803d09,%rax
+  803d92:	00 00 00 
+  803d95:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803d97:	c9                   	leave
+  803d98:	c3                   	ret
+
+0000000000803d99 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803d99:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803d9c:	74 10                	je     803dae <strlen+0x15>
+    size_t n = 0;
+  803d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803da3:	48 83 c0 01          	add    $0x1,%rax
+  803da7:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803dab:	75 f6                	jne    803da3 <strlen+0xa>
+  803dad:	c3                   	ret
+    size_t n = 0;
+  803dae:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803db3:	c3                   	ret
+
+0000000000803db4 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803db4:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803db7:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dbc:	48 85 f6             	test   %rsi,%rsi
+  803dbf:	74 11                	je     803dd2 <strnlen+0x1e>
+  803dc1:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803dc5:	74 0c                	je     803dd3 <strnlen+0x1f>
+  803dc7:	48 83 c2 01          	add    $0x1,%rdx
+  803dcb:	48 39 d0             	cmp    %rdx,%rax
+  803dce:	75 f1                	jne    803dc1 <strnlen+0xd>
+  803dd0:	eb 04                	jmp    803dd6 <strnlen+0x22>
+  803dd2:	c3                   	ret
+  803dd3:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803dd6:	c3                   	ret
+
+0000000000803dd7 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dd7:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dda:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ddf:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803de3:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803de6:	48 83 c2 01          	add    $0x1,%rdx
+  803dea:	84 c9                	test   %cl,%cl
+  803dec:	75 f1                	jne    803ddf <strcpy+0x8>
+        ;
+    return res;
+}
+  803dee:	c3                   	ret
+
+0000000000803def <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803def:	55                   	push   %rbp
+  803df0:	48 89 e5             	mov    %rsp,%rbp
+  803df3:	41 54                	push   %r12
+  803df5:	53                   	push   %rbx
+  803df6:	48 89 fb             	mov    %rdi,%rbx
+  803df9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803dfc:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  803e03:	00 00 00 
+  803e06:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e08:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e0c:	4c 89 e6             	mov    %r12,%rsi
+  803e0f:	48 b8 d7 3d 80 00 00 	movabs $0x803dd7,%rax
+  803e16:	00 00 00 
+  803e19:	ff d0                	call   *%rax
+    return dst;
+}
+  803e1b:	48 89 d8             	mov    %rbx,%rax
+  803e1e:	5b                   	pop    %rbx
+  803e1f:	41 5c                	pop    %r12
+  803e21:	5d                   	pop    %rbp
+  803e22:	c3                   	ret
+
+0000000000803e23 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e23:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e26:	48 85 d2             	test   %rdx,%rdx
+  803e29:	74 1f                	je     803e4a <strncpy+0x27>
+  803e2b:	48 01 fa             	add    %rdi,%rdx
+  803e2e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e31:	48 83 c1 01          	add    $0x1,%rcx
+  803e35:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e39:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e3d:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e41:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e45:	48 39 ca             	cmp    %rcx,%rdx
+  803e48:	75 e7                	jne    803e31 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e4a:	c3                   	ret
+
+0000000000803e4b <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e4b:	48 89 f8             	mov    %rdi,%rax
+  803e4e:	48 85 d2             	test   %rdx,%rdx
+  803e51:	74 24                	je     803e77 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e53:	48 83 ea 01          	sub    $0x1,%rdx
+  803e57:	74 1b                	je     803e74 <strlcpy+0x29>
+  803e59:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e5d:	0f b6 16             	movzbl (%rsi),%edx
+  803e60:	84 d2                	test   %dl,%dl
+  803e62:	74 10                	je     803e74 <strlcpy+0x29>
+            *dst++ = *src++;
+  803e64:	48 83 c6 01          	add    $0x1,%rsi
+  803e68:	48 83 c0 01          	add    $0x1,%rax
+  803e6c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e6f:	48 39 c8             	cmp    %rcx,%rax
+  803e72:	75 e9                	jne    803e5d <strlcpy+0x12>
+        *dst = '\0';
+  803e74:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e77:	48 29 f8             	sub    %rdi,%rax
+}
+  803e7a:	c3                   	ret
+
+0000000000803e7b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e7b:	0f b6 07             	movzbl (%rdi),%eax
+  803e7e:	84 c0                	test   %al,%al
+  803e80:	74 13                	je     803e95 <strcmp+0x1a>
+  803e82:	38 06                	cmp    %al,(%rsi)
+  803e84:	75 0f                	jne    803e95 <strcmp+0x1a>
+  803e86:	48 83 c7 01          	add    $0x1,%rdi
+  803e8a:	48 83 c6 01          	add    $0x1,%rsi
+  803e8e:	0f b6 07             	movzbl (%rdi),%eax
+  803e91:	84 c0                	test   %al,%al
+  803e93:	75 ed                	jne    803e82 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803e95:	0f b6 c0             	movzbl %al,%eax
+  803e98:	0f b6 16             	movzbl (%rsi),%edx
+  803e9b:	29 d0                	sub    %edx,%eax
+}
+  803e9d:	c3                   	ret
+
+0000000000803e9e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803e9e:	48 85 d2             	test   %rdx,%rdx
+  803ea1:	74 1f                	je     803ec2 <strncmp+0x24>
+  803ea3:	0f b6 07             	movzbl (%rdi),%eax
+  803ea6:	84 c0                	test   %al,%al
+  803ea8:	74 1e                	je     803ec8 <strncmp+0x2a>
+  803eaa:	3a 06                	cmp    (%rsi),%al
+  803eac:	75 1a                	jne    803ec8 <strncmp+0x2a>
+  803eae:	48 83 c7 01          	add    $0x1,%rdi
+  803eb2:	48 83 c6 01          	add    $0x1,%rsi
+  803eb6:	48 83 ea 01          	sub    $0x1,%rdx
+  803eba:	75 e7                	jne    803ea3 <strncmp+0x5>
+
+    if (!n) return 0;
+  803ebc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec1:	c3                   	ret
+  803ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec7:	c3                   	ret
+  803ec8:	48 85 d2             	test   %rdx,%rdx
+  803ecb:	74 09                	je     803ed6 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ecd:	0f b6 07             	movzbl (%rdi),%eax
+  803ed0:	0f b6 16             	movzbl (%rsi),%edx
+  803ed3:	29 d0                	sub    %edx,%eax
+  803ed5:	c3                   	ret
+    if (!n) return 0;
+  803ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803edb:	c3                   	ret
+
+0000000000803edc <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803edc:	0f b6 17             	movzbl (%rdi),%edx
+  803edf:	84 d2                	test   %dl,%dl
+  803ee1:	74 18                	je     803efb <strchr+0x1f>
+        if (*str == c) {
+  803ee3:	0f be d2             	movsbl %dl,%edx
+  803ee6:	39 f2                	cmp    %esi,%edx
+  803ee8:	74 17                	je     803f01 <strchr+0x25>
+    for (; *str; str++) {
+  803eea:	48 83 c7 01          	add    $0x1,%rdi
+  803eee:	0f b6 17             	movzbl (%rdi),%edx
+  803ef1:	84 d2                	test   %dl,%dl
+  803ef3:	75 ee                	jne    803ee3 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803efa:	c3                   	ret
+  803efb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f00:	c3                   	ret
+  803f01:	48 89 f8             	mov    %rdi,%rax
+}
+  803f04:	c3                   	ret
+
+0000000000803f05 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f05:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f08:	0f b6 17             	movzbl (%rdi),%edx
+  803f0b:	84 d2                	test   %dl,%dl
+  803f0d:	74 13                	je     803f22 <strfind+0x1d>
+  803f0f:	0f be d2             	movsbl %dl,%edx
+  803f12:	39 f2                	cmp    %esi,%edx
+  803f14:	74 0b                	je     803f21 <strfind+0x1c>
+  803f16:	48 83 c0 01          	add    $0x1,%rax
+  803f1a:	0f b6 10             	movzbl (%rax),%edx
+  803f1d:	84 d2                	test   %dl,%dl
+  803f1f:	75 ee                	jne    803f0f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f21:	c3                   	ret
+  803f22:	c3                   	ret
+
+0000000000803f23 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f23:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f26:	48 89 f8             	mov    %rdi,%rax
+  803f29:	48 f7 d8             	neg    %rax
+  803f2c:	83 e0 07             	and    $0x7,%eax
+  803f2f:	49 89 d1             	mov    %rdx,%r9
+  803f32:	49 29 c1             	sub    %rax,%r9
+  803f35:	78 36                	js     803f6d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f37:	40 0f b6 c6          	movzbl %sil,%eax
+  803f3b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f42:	01 01 01 
+  803f45:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f49:	40 f6 c7 07          	test   $0x7,%dil
+  803f4d:	75 38                	jne    803f87 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f4f:	4c 89 c9             	mov    %r9,%rcx
+  803f52:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f56:	74 0c                	je     803f64 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f58:	fc                   	cld
+  803f59:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f5c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f60:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f64:	4d 85 c9             	test   %r9,%r9
+  803f67:	75 45                	jne    803fae <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f69:	4c 89 c0             	mov    %r8,%rax
+  803f6c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f6d:	48 85 d2             	test   %rdx,%rdx
+  803f70:	74 f7                	je     803f69 <memset+0x46>
+  803f72:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f75:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f78:	48 83 c0 01          	add    $0x1,%rax
+  803f7c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f80:	48 39 c2             	cmp    %rax,%rdx
+  803f83:	75 f3                	jne    803f78 <memset+0x55>
+  803f85:	eb e2                	jmp    803f69 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f87:	40 f6 c7 01          	test   $0x1,%dil
+  803f8b:	74 06                	je     803f93 <memset+0x70>
+  803f8d:	88 07                	mov    %al,(%rdi)
+  803f8f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f93:	40 f6 c7 02          	test   $0x2,%dil
+  803f97:	74 07                	je     803fa0 <memset+0x7d>
+  803f99:	66 89 07             	mov    %ax,(%rdi)
+  803f9c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fa0:	40 f6 c7 04          	test   $0x4,%dil
+  803fa4:	74 a9                	je     803f4f <memset+0x2c>
+  803fa6:	89 07                	mov    %eax,(%rdi)
+  803fa8:	48 83 c7 04          	add    $0x4,%rdi
+  803fac:	eb a1                	jmp    803f4f <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fae:	41 f6 c1 04          	test   $0x4,%r9b
+  803fb2:	74 06                	je     803fba <memset+0x97>
+  803fb4:	89 07                	mov    %eax,(%rdi)
+  803fb6:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fba:	41 f6 c1 02          	test   $0x2,%r9b
+  803fbe:	74 07                	je     803fc7 <memset+0xa4>
+  803fc0:	66 89 07             	mov    %ax,(%rdi)
+  803fc3:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fc7:	41 f6 c1 01          	test   $0x1,%r9b
+  803fcb:	74 9c                	je     803f69 <memset+0x46>
+  803fcd:	88 07                	mov    %al,(%rdi)
+  803fcf:	eb 98                	jmp    803f69 <memset+0x46>
+
+0000000000803fd1 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fd1:	48 89 f8             	mov    %rdi,%rax
+  803fd4:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fd7:	48 39 fe             	cmp    %rdi,%rsi
+  803fda:	73 3b                	jae    804017 <memmove+0x46>
+  803fdc:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803fe0:	48 39 d7             	cmp    %rdx,%rdi
+  803fe3:	73 32                	jae    804017 <memmove+0x46>
+        s += n;
+        d += n;
+  803fe5:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803fe9:	48 89 d6             	mov    %rdx,%rsi
+  803fec:	48 09 fe             	or     %rdi,%rsi
+  803fef:	48 09 ce             	or     %rcx,%rsi
+  803ff2:	40 f6 c6 07          	test   $0x7,%sil
+  803ff6:	75 12                	jne    80400a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803ff8:	48 83 ef 08          	sub    $0x8,%rdi
+  803ffc:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  804000:	48 c1 e9 03          	shr    $0x3,%rcx
+  804004:	fd                   	std
+  804005:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804008:	fc                   	cld
+  804009:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80400a:	48 83 ef 01          	sub    $0x1,%rdi
+  80400e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804012:	fd                   	std
+  804013:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804015:	eb f1                	jmp    804008 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804017:	48 89 f2             	mov    %rsi,%rdx
+  80401a:	48 09 c2             	or     %rax,%rdx
+  80401d:	48 09 ca             	or     %rcx,%rdx
+  804020:	f6 c2 07             	test   $0x7,%dl
+  804023:	75 0c                	jne    804031 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804025:	48 c1 e9 03          	shr    $0x3,%rcx
+  804029:	48 89 c7             	mov    %rax,%rdi
+  80402c:	fc                   	cld
+  80402d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804030:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804031:	48 89 c7             	mov    %rax,%rdi
+  804034:	fc                   	cld
+  804035:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804037:	c3                   	ret
+
+0000000000804038 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804038:	55                   	push   %rbp
+  804039:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80403c:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  804043:	00 00 00 
+  804046:	ff d0                	call   *%rax
+}
+  804048:	5d                   	pop    %rbp
+  804049:	c3                   	ret
+
+000000000080404a <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80404a:	55                   	push   %rbp
+  80404b:	48 89 e5             	mov    %rsp,%rbp
+  80404e:	41 57                	push   %r15
+  804050:	41 56                	push   %r14
+  804052:	41 55                	push   %r13
+  804054:	41 54                	push   %r12
+  804056:	53                   	push   %rbx
+  804057:	48 83 ec 08          	sub    $0x8,%rsp
+  80405b:	49 89 fe             	mov    %rdi,%r14
+  80405e:	49 89 f7             	mov    %rsi,%r15
+  804061:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  804064:	48 89 f7             	mov    %rsi,%rdi
+  804067:	48 b8 99 3d 80 00 00 	movabs $0x803d99,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+  804073:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804076:	48 89 de             	mov    %rbx,%rsi
+  804079:	4c 89 f7             	mov    %r14,%rdi
+  80407c:	48 b8 b4 3d 80 00 00 	movabs $0x803db4,%rax
+  804083:	00 00 00 
+  804086:	ff d0                	call   *%rax
+  804088:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80408b:	48 39 c3             	cmp    %rax,%rbx
+  80408e:	74 36                	je     8040c6 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  804090:	48 89 d8             	mov    %rbx,%rax
+  804093:	4c 29 e8             	sub    %r13,%rax
+  804096:	49 39 c4             	cmp    %rax,%r12
+  804099:	73 31                	jae    8040cc <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80409b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040a0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040a4:	4c 89 fe             	mov    %r15,%rsi
+  8040a7:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8040ae:	00 00 00 
+  8040b1:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040b3:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040b7:	48 83 c4 08          	add    $0x8,%rsp
+  8040bb:	5b                   	pop    %rbx
+  8040bc:	41 5c                	pop    %r12
+  8040be:	41 5d                	pop    %r13
+  8040c0:	41 5e                	pop    %r14
+  8040c2:	41 5f                	pop    %r15
+  8040c4:	5d                   	pop    %rbp
+  8040c5:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040c6:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040ca:	eb eb                	jmp    8040b7 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040cc:	48 83 eb 01          	sub    $0x1,%rbx
+  8040d0:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040d4:	48 89 da             	mov    %rbx,%rdx
+  8040d7:	4c 89 fe             	mov    %r15,%rsi
+  8040da:	48 b8 38 40 80 00 00 	movabs $0x804038,%rax
+  8040e1:	00 00 00 
+  8040e4:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040e6:	49 01 de             	add    %rbx,%r14
+  8040e9:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040ee:	eb c3                	jmp    8040b3 <strlcat+0x69>
+
+00000000008040f0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040f0:	48 85 d2             	test   %rdx,%rdx
+  8040f3:	74 2d                	je     804122 <memcmp+0x32>
+  8040f5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8040fa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8040fe:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  804103:	44 38 c1             	cmp    %r8b,%cl
+  804106:	75 0f                	jne    804117 <memcmp+0x27>
+    while (n-- > 0) {
+  804108:	48 83 c0 01          	add    $0x1,%rax
+  80410c:	48 39 c2             	cmp    %rax,%rdx
+  80410f:	75 e9                	jne    8040fa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804111:	b8 00 00 00 00       	mov    $0x0,%eax
+  804116:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804117:	0f b6 c1             	movzbl %cl,%eax
+  80411a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80411e:	44 29 c0             	sub    %r8d,%eax
+  804121:	c3                   	ret
+    return 0;
+  804122:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804127:	c3                   	ret
+
+0000000000804128 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804128:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80412c:	48 39 c7             	cmp    %rax,%rdi
+  80412f:	73 0f                	jae    804140 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804131:	40 38 37             	cmp    %sil,(%rdi)
+  804134:	74 0e                	je     804144 <memfind+0x1c>
+    for (; src < end; src++) {
+  804136:	48 83 c7 01          	add    $0x1,%rdi
+  80413a:	48 39 f8             	cmp    %rdi,%rax
+  80413d:	75 f2                	jne    804131 <memfind+0x9>
+  80413f:	c3                   	ret
+  804140:	48 89 f8             	mov    %rdi,%rax
+  804143:	c3                   	ret
+  804144:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804147:	c3                   	ret
+
+0000000000804148 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804148:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80414b:	0f b6 37             	movzbl (%rdi),%esi
+  80414e:	40 80 fe 20          	cmp    $0x20,%sil
+  804152:	74 06                	je     80415a <strtol+0x12>
+  804154:	40 80 fe 09          	cmp    $0x9,%sil
+  804158:	75 13                	jne    80416d <strtol+0x25>
+  80415a:	48 83 c7 01          	add    $0x1,%rdi
+  80415e:	0f b6 37             	movzbl (%rdi),%esi
+  804161:	40 80 fe 20          	cmp    $0x20,%sil
+  804165:	74 f3                	je     80415a <strtol+0x12>
+  804167:	40 80 fe 09          	cmp    $0x9,%sil
+  80416b:	74 ed                	je     80415a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80416d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804170:	83 e0 fd             	and    $0xfffffffd,%eax
+  804173:	3c 01                	cmp    $0x1,%al
+  804175:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804179:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80417f:	75 0f                	jne    804190 <strtol+0x48>
+  804181:	80 3f 30             	cmpb   $0x30,(%rdi)
+  804184:	74 14                	je     80419a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804186:	85 d2                	test   %edx,%edx
+  804188:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80418d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  804190:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  804195:	4c 63 ca             	movslq %edx,%r9
+  804198:	eb 36                	jmp    8041d0 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80419a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80419e:	74 0f                	je     8041af <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041a0:	85 d2                	test   %edx,%edx
+  8041a2:	75 ec                	jne    804190 <strtol+0x48>
+        s++;
+  8041a4:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041a8:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041ad:	eb e1                	jmp    804190 <strtol+0x48>
+        s += 2;
+  8041af:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041b3:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041b8:	eb d6                	jmp    804190 <strtol+0x48>
+            dig -= '0';
+  8041ba:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041bd:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041c1:	41 39 d0             	cmp    %edx,%r8d
+  8041c4:	7d 21                	jge    8041e7 <strtol+0x9f>
+        val = val * base + dig;
+  8041c6:	49 0f af c1          	imul   %r9,%rax
+  8041ca:	0f b6 c9             	movzbl %cl,%ecx
+  8041cd:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041d0:	48 83 c7 01          	add    $0x1,%rdi
+  8041d4:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041d8:	80 f9 39             	cmp    $0x39,%cl
+  8041db:	76 dd                	jbe    8041ba <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041dd:	80 f9 7b             	cmp    $0x7b,%cl
+  8041e0:	77 05                	ja     8041e7 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041e2:	83 e9 57             	sub    $0x57,%ecx
+  8041e5:	eb d6                	jmp    8041bd <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041e7:	4d 85 d2             	test   %r10,%r10
+  8041ea:	74 03                	je     8041ef <strtol+0xa7>
+  8041ec:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041ef:	48 89 c2             	mov    %rax,%rdx
+  8041f2:	48 f7 da             	neg    %rdx
+  8041f5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8041f9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8041fd:	c3                   	ret
+
+00000000008041fe <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8041fe:	55                   	push   %rbp
+  8041ff:	48 89 e5             	mov    %rsp,%rbp
+  804202:	41 56                	push   %r14
+  804204:	41 55                	push   %r13
+  804206:	41 54                	push   %r12
+  804208:	53                   	push   %rbx
+  804209:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80420c:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804213:	00 00 00 
+  804216:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80421a:	74 27                	je     804243 <_handle_vectored_pagefault+0x45>
+  80421c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804221:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804228:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80422b:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80422e:	4c 89 e7             	mov    %r12,%rdi
+  804231:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804236:	84 c0                	test   %al,%al
+  804238:	75 45                	jne    80427f <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80423a:	48 83 c3 01          	add    $0x1,%rbx
+  80423e:	49 3b 1e             	cmp    (%r14),%rbx
+  804241:	72 eb                	jb     80422e <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804243:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80424a:	00 
+  80424b:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804250:	4d 8b 04 24          	mov    (%r12),%r8
+  804254:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  80425b:	00 00 00 
+  80425e:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804263:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80426a:	00 00 00 
+  80426d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804272:	49 ba 62 33 80 00 00 	movabs $0x803362,%r10
+  804279:	00 00 00 
+  80427c:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80427f:	5b                   	pop    %rbx
+  804280:	41 5c                	pop    %r12
+  804282:	41 5d                	pop    %r13
+  804284:	41 5e                	pop    %r14
+  804286:	5d                   	pop    %rbp
+  804287:	c3                   	ret
+
+0000000000804288 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804288:	55                   	push   %rbp
+  804289:	48 89 e5             	mov    %rsp,%rbp
+  80428c:	53                   	push   %rbx
+  80428d:	48 83 ec 08          	sub    $0x8,%rsp
+  804291:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804294:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80429b:	00 00 00 
+  80429e:	80 38 00             	cmpb   $0x0,(%rax)
+  8042a1:	0f 84 84 00 00 00    	je     80432b <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042a7:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042ae:	00 00 00 
+  8042b1:	48 8b 10             	mov    (%rax),%rdx
+  8042b4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042b9:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042c0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c3:	48 85 d2             	test   %rdx,%rdx
+  8042c6:	74 19                	je     8042e1 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042c8:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042cc:	0f 84 e8 00 00 00    	je     8043ba <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042d2:	48 83 c0 01          	add    $0x1,%rax
+  8042d6:	48 39 d0             	cmp    %rdx,%rax
+  8042d9:	75 ed                	jne    8042c8 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042db:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042df:	74 1c                	je     8042fd <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042e1:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042e5:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042ec:	00 00 00 
+  8042ef:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8042f6:	00 00 00 
+  8042f9:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8042fd:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  804304:	00 00 00 
+  804307:	ff d0                	call   *%rax
+  804309:	89 c7                	mov    %eax,%edi
+  80430b:	48 be 80 44 80 00 00 	movabs $0x804480,%rsi
+  804312:	00 00 00 
+  804315:	48 b8 02 04 80 00 00 	movabs $0x800402,%rax
+  80431c:	00 00 00 
+  80431f:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804321:	85 c0                	test   %eax,%eax
+  804323:	78 68                	js     80438d <add_pgfault_handler+0x105>
+    return res;
+}
+  804325:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804329:	c9                   	leave
+  80432a:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80432b:	48 b8 b7 01 80 00 00 	movabs $0x8001b7,%rax
+  804332:	00 00 00 
+  804335:	ff d0                	call   *%rax
+  804337:	89 c7                	mov    %eax,%edi
+  804339:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80433e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804343:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80434a:	00 00 00 
+  80434d:	48 b8 44 02 80 00 00 	movabs $0x800244,%rax
+  804354:	00 00 00 
+  804357:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804359:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804360:	00 00 00 
+  804363:	48 8b 02             	mov    (%rdx),%rax
+  804366:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80436a:	48 89 0a             	mov    %rcx,(%rdx)
+  80436d:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804374:	00 00 00 
+  804377:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80437b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804382:	00 00 00 
+  804385:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804388:	e9 70 ff ff ff       	jmp    8042fd <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80438d:	89 c1                	mov    %eax,%ecx
+  80438f:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  804396:	00 00 00 
+  804399:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80439e:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  8043a5:	00 00 00 
+  8043a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ad:	49 b8 62 33 80 00 00 	movabs $0x803362,%r8
+  8043b4:	00 00 00 
+  8043b7:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043bf:	e9 61 ff ff ff       	jmp    804325 <add_pgfault_handler+0x9d>
+
+00000000008043c4 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043c4:	55                   	push   %rbp
+  8043c5:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043c8:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043cf:	00 00 00 
+  8043d2:	80 38 00             	cmpb   $0x0,(%rax)
+  8043d5:	74 33                	je     80440a <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043d7:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043de:	00 00 00 
+  8043e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043e6:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043ed:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f0:	48 85 c0             	test   %rax,%rax
+  8043f3:	0f 84 85 00 00 00    	je     80447e <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8043f9:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8043fd:	74 40                	je     80443f <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043ff:	48 83 c1 01          	add    $0x1,%rcx
+  804403:	48 39 c1             	cmp    %rax,%rcx
+  804406:	75 f1                	jne    8043f9 <remove_pgfault_handler+0x35>
+  804408:	eb 74                	jmp    80447e <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80440a:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  804411:	00 00 00 
+  804414:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  80441b:	00 00 00 
+  80441e:	be 43 00 00 00       	mov    $0x43,%esi
+  804423:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80442a:	00 00 00 
+  80442d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804432:	49 b8 62 33 80 00 00 	movabs $0x803362,%r8
+  804439:	00 00 00 
+  80443c:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80443f:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804446:	00 
+  804447:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80444b:	48 29 ca             	sub    %rcx,%rdx
+  80444e:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804455:	00 00 00 
+  804458:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80445c:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804461:	48 89 ce             	mov    %rcx,%rsi
+  804464:	48 b8 d1 3f 80 00 00 	movabs $0x803fd1,%rax
+  80446b:	00 00 00 
+  80446e:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804470:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804477:	00 00 00 
+  80447a:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80447e:	5d                   	pop    %rbp
+  80447f:	c3                   	ret
+
+0000000000804480 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804480:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804483:	48 b8 fe 41 80 00 00 	movabs $0x8041fe,%rax
+  80448a:	00 00 00 
+    call *%rax
+  80448d:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80448f:	41 5f                	pop    %r15
+	popq %r15
+  804491:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804493:	41 5f                	pop    %r15
+	popq %r14
+  804495:	41 5e                	pop    %r14
+	popq %r13
+  804497:	41 5d                	pop    %r13
+	popq %r12
+  804499:	41 5c                	pop    %r12
+	popq %r11
+  80449b:	41 5b                	pop    %r11
+	popq %r10
+  80449d:	41 5a                	pop    %r10
+	popq %r9
+  80449f:	41 59                	pop    %r9
+	popq %r8
+  8044a1:	41 58                	pop    %r8
+	popq %rsi
+  8044a3:	5e                   	pop    %rsi
+	popq %rdi
+  8044a4:	5f                   	pop    %rdi
+	popq %rbp
+  8044a5:	5d                   	pop    %rbp
+	popq %rdx
+  8044a6:	5a                   	pop    %rdx
+	popq %rcx
+  8044a7:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044a8:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044ad:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044b2:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044b6:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044b9:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044be:	5b                   	pop    %rbx
+	popq %rax
+  8044bf:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044c0:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044c4:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044c5:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044ca:	c3                   	ret
+
+00000000008044cb <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044cb:	55                   	push   %rbp
+  8044cc:	48 89 e5             	mov    %rsp,%rbp
+  8044cf:	41 55                	push   %r13
+  8044d1:	41 54                	push   %r12
+  8044d3:	53                   	push   %rbx
+  8044d4:	48 83 ec 08          	sub    $0x8,%rsp
+  8044d8:	49 89 fd             	mov    %rdi,%r13
+  8044db:	48 89 f7             	mov    %rsi,%rdi
+  8044de:	48 89 d3             	mov    %rdx,%rbx
+  8044e1:	49 89 cc             	mov    %rcx,%r12
+  8044e4:	4c 89 c2             	mov    %r8,%rdx
+  8044e7:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044ea:	48 85 f6             	test   %rsi,%rsi
+  8044ed:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044f4:	00 00 00 
+  8044f7:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8044fb:	be 00 10 00 00       	mov    $0x1000,%esi
+  804500:	48 85 db             	test   %rbx,%rbx
+  804503:	74 03                	je     804508 <ipc_recv_futex+0x3d>
+  804505:	48 8b 33             	mov    (%rbx),%rsi
+  804508:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80450c:	48 b8 8e 04 80 00 00 	movabs $0x80048e,%rax
+  804513:	00 00 00 
+  804516:	ff d0                	call   *%rax
+    if (res < 0) {
+  804518:	85 c0                	test   %eax,%eax
+  80451a:	78 75                	js     804591 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80451c:	4d 85 ed             	test   %r13,%r13
+  80451f:	74 14                	je     804535 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804521:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804528:	00 00 00 
+  80452b:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804531:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804535:	4d 85 e4             	test   %r12,%r12
+  804538:	74 14                	je     80454e <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80453a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804541:	00 00 00 
+  804544:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80454a:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80454e:	48 85 db             	test   %rbx,%rbx
+  804551:	74 23                	je     804576 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804553:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80455a:	00 00 00 
+  80455d:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804563:	ba 00 00 00 00       	mov    $0x0,%edx
+  804568:	85 c9                	test   %ecx,%ecx
+  80456a:	74 07                	je     804573 <ipc_recv_futex+0xa8>
+  80456c:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804573:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804576:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80457d:	00 00 00 
+  804580:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804586:	48 83 c4 08          	add    $0x8,%rsp
+  80458a:	5b                   	pop    %rbx
+  80458b:	41 5c                	pop    %r12
+  80458d:	41 5d                	pop    %r13
+  80458f:	5d                   	pop    %rbp
+  804590:	c3                   	ret
+        if (from_env_store != NULL) {
+  804591:	4d 85 ed             	test   %r13,%r13
+  804594:	74 08                	je     80459e <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804596:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80459d:	00 
+        if (perm_store != NULL) {
+  80459e:	4d 85 e4             	test   %r12,%r12
+  8045a1:	74 08                	je     8045ab <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045a3:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045aa:	00 
+        if (size != NULL) {
+  8045ab:	48 85 db             	test   %rbx,%rbx
+  8045ae:	74 d6                	je     804586 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045b0:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045b7:	eb cd                	jmp    804586 <ipc_recv_futex+0xbb>
+
+00000000008045b9 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045b9:	55                   	push   %rbp
+  8045ba:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045bd:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c1:	6a 00                	push   $0x0
+  8045c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045c9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045cf:	48 b8 cb 44 80 00 00 	movabs $0x8044cb,%rax
+  8045d6:	00 00 00 
+  8045d9:	ff d0                	call   *%rax
+}
+  8045db:	c9                   	leave
+  8045dc:	c3                   	ret
+
+00000000008045dd <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045dd:	55                   	push   %rbp
+  8045de:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045e1:	48 85 d2             	test   %rdx,%rdx
+  8045e4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045eb:	00 00 00 
+  8045ee:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045f2:	89 f6                	mov    %esi,%esi
+  8045f4:	48 b8 77 04 80 00 00 	movabs $0x800477,%rax
+  8045fb:	00 00 00 
+  8045fe:	ff d0                	call   *%rax
+    if (res < 0) {
+  804600:	85 c0                	test   %eax,%eax
+  804602:	78 02                	js     804606 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804604:	5d                   	pop    %rbp
+  804605:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804606:	89 c1                	mov    %eax,%ecx
+  804608:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  80460f:	00 00 00 
+  804612:	be 50 00 00 00       	mov    $0x50,%esi
+  804617:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  80461e:	00 00 00 
+  804621:	b8 00 00 00 00       	mov    $0x0,%eax
+  804626:	49 b8 62 33 80 00 00 	movabs $0x803362,%r8
+  80462d:	00 00 00 
+  804630:	41 ff d0             	call   *%r8
+
+0000000000804633 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804633:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804638:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80463f:	00 00 00 
+  804642:	48 89 d0             	mov    %rdx,%rax
+  804645:	48 c1 e0 04          	shl    $0x4,%rax
+  804649:	48 29 d0             	sub    %rdx,%rax
+  80464c:	48 c1 e0 05          	shl    $0x5,%rax
+  804650:	48 01 c8             	add    %rcx,%rax
+  804653:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804659:	39 f8                	cmp    %edi,%eax
+  80465b:	74 13                	je     804670 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80465d:	48 83 c2 01          	add    $0x1,%rdx
+  804661:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804668:	75 d8                	jne    804642 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80466a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80466f:	c3                   	ret
+            return envs[i].env_id;
+  804670:	48 89 d0             	mov    %rdx,%rax
+  804673:	48 c1 e0 04          	shl    $0x4,%rax
+  804677:	48 29 d0             	sub    %rdx,%rax
+  80467a:	48 c1 e0 05          	shl    $0x5,%rax
+  80467e:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804685:	00 00 00 
+  804688:	48 01 d0             	add    %rdx,%rax
+  80468b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804691:	c3                   	ret
+  804692:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+0000000000804698 <__rodata_start>:
+  804698:	3c 75                	cmp    $0x75,%al
+  80469a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80469b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80469f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046a0:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  8046a4:	1f                   	(bad)
+  8046a5:	44 00 00             	add    %r8b,(%rax)
+  8046a8:	73 79                	jae    804723 <__rodata_start+0x8b>
+  8046aa:	73 63                	jae    80470f <__rodata_start+0x77>
+  8046ac:	61                   	(bad)
+  8046ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ae:	6c                   	insb   (%dx),%es:(%rdi)
+  8046af:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab2f <__bss_end+0x721c8b2f>
+  8046b5:	65 74 75             	gs je  80472d <__rodata_start+0x95>
+  8046b8:	72 6e                	jb     804728 <__rodata_start+0x90>
+  8046ba:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab3c <__bss_end+0x281c8b3c>
+  8046c1:	28 
+  8046c2:	3e 20 30             	ds and %dh,(%rax)
+  8046c5:	29 00                	sub    %eax,(%rax)
+  8046c7:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046cf:	61                   	(bad)
+  8046d0:	6c                   	insb   (%dx),%es:(%rdi)
+  8046d1:	6c                   	insb   (%dx),%es:(%rdi)
+  8046d2:	2e 63 00             	cs movsxd (%rax),%eax
+  8046d5:	0f 1f 00             	nopl   (%rax)
+  8046d8:	5b                   	pop    %rbx
+  8046d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046de:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046e1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046e5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046e6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046ea:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046f1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80515c <__ctors_end+0x7c>
+  8046f8:	5b                   	pop    %rbx
+  8046f9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046fe:	20 66 74             	and    %ah,0x74(%rsi)
+  804701:	72 75                	jb     804778 <devtab+0x18>
+  804703:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804704:	63 61 74             	movsxd 0x74(%rcx),%esp
+  804707:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad6772 <__bss_end+0x2d294772>
+  80470e:	20 62 61             	and    %ah,0x61(%rdx)
+  804711:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804715:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804719:	5b                   	pop    %rbx
+  80471a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80471f:	20 72 65             	and    %dh,0x65(%rdx)
+  804722:	61                   	(bad)
+  804723:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad678e <__bss_end+0x2d29478e>
+  80472a:	20 62 61             	and    %ah,0x61(%rdx)
+  80472d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804731:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804735:	5b                   	pop    %rbx
+  804736:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80473b:	20 77 72             	and    %dh,0x72(%rdi)
+  80473e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  804745:	2d 
+  804746:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80474b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80474e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804752:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804759:	00 00 00 
+  80475c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	9f 36 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	d0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	e0 3c 80 00 00 00 00 00 be 36 80 00 00 00 00 00     .<.......6......
+  804a00:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	b2 36 80 00 00 00 00 00 2c 37 80 00 00 00 00 00     .6......,7......
+  804a20:	e0 3c 80 00 00 00 00 00 b2 36 80 00 00 00 00 00     .<.......6......
+  804a30:	f8 36 80 00 00 00 00 00 f8 36 80 00 00 00 00 00     .6.......6......
+  804a40:	f8 36 80 00 00 00 00 00 f8 36 80 00 00 00 00 00     .6.......6......
+  804a50:	f8 36 80 00 00 00 00 00 f8 36 80 00 00 00 00 00     .6.......6......
+  804a60:	f8 36 80 00 00 00 00 00 f8 36 80 00 00 00 00 00     .6.......6......
+  804a70:	f8 36 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .6.......<......
+  804a80:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	e0 3c 80 00 00 00 00 00 03 3c 80 00 00 00 00 00     .<.......<......
+  804b70:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	4f 37 80 00 00 00 00 00 1e 39 80 00 00 00 00 00     O7.......9......
+  804bd0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	7e 37 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     ~7.......<......
+  804c00:	e0 3c 80 00 00 00 00 00 44 37 80 00 00 00 00 00     .<......D7......
+  804c10:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	c6 3a 80 00 00 00 00 00 90 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	e0 3c 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	15 38 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .8.......<......
+  804c50:	f2 39 80 00 00 00 00 00 e0 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	e0 3c 80 00 00 00 00 00 03 3c 80 00 00 00 00 00     .<.......<......
+  804c70:	e0 3c 80 00 00 00 00 00 a8 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,8587 @@
+
+obj/user/forktree:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 ff 00 00 00       	call   800122 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <forktree>:
+        exit();
+    }
+}
+
+void
+forktree(const char *cur) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 54                	push   %r12
+  80002b:	53                   	push   %rbx
+  80002c:	48 89 fb             	mov    %rdi,%rbx
+    cprintf("%04x: I am '%s'\n", sys_getenvid(), cur);
+  80002f:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  800036:	00 00 00 
+  800039:	ff d0                	call   *%rax
+  80003b:	89 c6                	mov    %eax,%esi
+  80003d:	48 89 da             	mov    %rbx,%rdx
+  800040:	48 bf a0 48 80 00 00 	movabs $0x8048a0,%rdi
+  800047:	00 00 00 
+  80004a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80004f:	48 b9 a5 02 80 00 00 	movabs $0x8002a5,%rcx
+  800056:	00 00 00 
+  800059:	ff d1                	call   *%rcx
+
+    forkchild(cur, '0');
+  80005b:	be 30 00 00 00       	mov    $0x30,%esi
+  800060:	48 89 df             	mov    %rbx,%rdi
+  800063:	49 bc 80 00 80 00 00 	movabs $0x800080,%r12
+  80006a:	00 00 00 
+  80006d:	41 ff d4             	call   *%r12
+    forkchild(cur, '1');
+  800070:	be 31 00 00 00       	mov    $0x31,%esi
+  800075:	48 89 df             	mov    %rbx,%rdi
+  800078:	41 ff d4             	call   *%r12
+}
+  80007b:	5b                   	pop    %rbx
+  80007c:	41 5c                	pop    %r12
+  80007e:	5d                   	pop    %rbp
+  80007f:	c3                   	ret
+
+0000000000800080 <forkchild>:
+forkchild(const char *cur, char branch) {
+  800080:	55                   	push   %rbp
+  800081:	48 89 e5             	mov    %rsp,%rbp
+  800084:	41 54                	push   %r12
+  800086:	53                   	push   %rbx
+  800087:	48 83 ec 10          	sub    $0x10,%rsp
+  80008b:	48 89 fb             	mov    %rdi,%rbx
+  80008e:	41 89 f4             	mov    %esi,%r12d
+    if (strlen(cur) >= DEPTH)
+  800091:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	48 83 f8 02          	cmp    $0x2,%rax
+  8000a1:	76 09                	jbe    8000ac <forkchild+0x2c>
+}
+  8000a3:	48 83 c4 10          	add    $0x10,%rsp
+  8000a7:	5b                   	pop    %rbx
+  8000a8:	41 5c                	pop    %r12
+  8000aa:	5d                   	pop    %rbp
+  8000ab:	c3                   	ret
+    snprintf(nxt, DEPTH + 1, "%s%c", cur, branch);
+  8000ac:	45 0f be c4          	movsbl %r12b,%r8d
+  8000b0:	48 89 d9             	mov    %rbx,%rcx
+  8000b3:	48 ba b1 48 80 00 00 	movabs $0x8048b1,%rdx
+  8000ba:	00 00 00 
+  8000bd:	be 04 00 00 00       	mov    $0x4,%esi
+  8000c2:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000cb:	49 b9 4f 0b 80 00 00 	movabs $0x800b4f,%r9
+  8000d2:	00 00 00 
+  8000d5:	41 ff d1             	call   *%r9
+    if (fork() == 0) {
+  8000d8:	48 b8 5c 15 80 00 00 	movabs $0x80155c,%rax
+  8000df:	00 00 00 
+  8000e2:	ff d0                	call   *%rax
+  8000e4:	85 c0                	test   %eax,%eax
+  8000e6:	75 bb                	jne    8000a3 <forkchild+0x23>
+        forktree(nxt);
+  8000e8:	48 8d 7d ec          	lea    -0x14(%rbp),%rdi
+  8000ec:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        exit();
+  8000f8:	48 b8 d5 01 80 00 00 	movabs $0x8001d5,%rax
+  8000ff:	00 00 00 
+  800102:	ff d0                	call   *%rax
+  800104:	eb 9d                	jmp    8000a3 <forkchild+0x23>
+
+0000000000800106 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800106:	55                   	push   %rbp
+  800107:	48 89 e5             	mov    %rsp,%rbp
+    forktree("");
+  80010a:	48 bf b0 48 80 00 00 	movabs $0x8048b0,%rdi
+  800111:	00 00 00 
+  800114:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80011b:	00 00 00 
+  80011e:	ff d0                	call   *%rax
+}
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+
+0000000000800122 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800122:	55                   	push   %rbp
+  800123:	48 89 e5             	mov    %rsp,%rbp
+  800126:	41 56                	push   %r14
+  800128:	41 55                	push   %r13
+  80012a:	41 54                	push   %r12
+  80012c:	53                   	push   %rbx
+  80012d:	41 89 fd             	mov    %edi,%r13d
+  800130:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800133:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80013a:	00 00 00 
+  80013d:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800144:	00 00 00 
+  800147:	48 39 c2             	cmp    %rax,%rdx
+  80014a:	73 17                	jae    800163 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80014c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80014f:	49 89 c4             	mov    %rax,%r12
+  800152:	48 83 c3 08          	add    $0x8,%rbx
+  800156:	b8 00 00 00 00       	mov    $0x0,%eax
+  80015b:	ff 53 f8             	call   *-0x8(%rbx)
+  80015e:	4c 39 e3             	cmp    %r12,%rbx
+  800161:	72 ef                	jb     800152 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800163:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  80016a:	00 00 00 
+  80016d:	ff d0                	call   *%rax
+  80016f:	89 c2                	mov    %eax,%edx
+  800171:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800177:	48 89 d0             	mov    %rdx,%rax
+  80017a:	48 c1 e0 04          	shl    $0x4,%rax
+  80017e:	48 29 d0             	sub    %rdx,%rax
+  800181:	48 c1 e0 05          	shl    $0x5,%rax
+  800185:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80018c:	00 00 00 
+  80018f:	48 01 d0             	add    %rdx,%rax
+  800192:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800199:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80019c:	45 85 ed             	test   %r13d,%r13d
+  80019f:	7e 0d                	jle    8001ae <libmain+0x8c>
+  8001a1:	49 8b 06             	mov    (%r14),%rax
+  8001a4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001ab:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001ae:	4c 89 f6             	mov    %r14,%rsi
+  8001b1:	44 89 ef             	mov    %r13d,%edi
+  8001b4:	48 b8 06 01 80 00 00 	movabs $0x800106,%rax
+  8001bb:	00 00 00 
+  8001be:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001c0:	48 b8 d5 01 80 00 00 	movabs $0x8001d5,%rax
+  8001c7:	00 00 00 
+  8001ca:	ff d0                	call   *%rax
+#endif
+}
+  8001cc:	5b                   	pop    %rbx
+  8001cd:	41 5c                	pop    %r12
+  8001cf:	41 5d                	pop    %r13
+  8001d1:	41 5e                	pop    %r14
+  8001d3:	5d                   	pop    %rbp
+  8001d4:	c3                   	ret
+
+00000000008001d5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001d5:	55                   	push   %rbp
+  8001d6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001d9:	48 b8 a2 18 80 00 00 	movabs $0x8018a2,%rax
+  8001e0:	00 00 00 
+  8001e3:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001e5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001ea:	48 b8 39 10 80 00 00 	movabs $0x801039,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+}
+  8001f6:	5d                   	pop    %rbp
+  8001f7:	c3                   	ret
+
+00000000008001f8 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8001f8:	55                   	push   %rbp
+  8001f9:	48 89 e5             	mov    %rsp,%rbp
+  8001fc:	53                   	push   %rbx
+  8001fd:	48 83 ec 08          	sub    $0x8,%rsp
+  800201:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800204:	8b 06                	mov    (%rsi),%eax
+  800206:	8d 50 01             	lea    0x1(%rax),%edx
+  800209:	89 16                	mov    %edx,(%rsi)
+  80020b:	48 98                	cltq
+  80020d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800212:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800218:	74 0a                	je     800224 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80021a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80021e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800222:	c9                   	leave
+  800223:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800224:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800228:	be ff 00 00 00       	mov    $0xff,%esi
+  80022d:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+        state->offset = 0;
+  800239:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80023f:	eb d9                	jmp    80021a <putch+0x22>
+
+0000000000800241 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800241:	55                   	push   %rbp
+  800242:	48 89 e5             	mov    %rsp,%rbp
+  800245:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80024c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80024f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800256:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80025b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800260:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800263:	48 89 f1             	mov    %rsi,%rcx
+  800266:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80026d:	48 bf f8 01 80 00 00 	movabs $0x8001f8,%rdi
+  800274:	00 00 00 
+  800277:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  80027e:	00 00 00 
+  800281:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800283:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80028a:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800291:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  800298:	00 00 00 
+  80029b:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80029d:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002a3:	c9                   	leave
+  8002a4:	c3                   	ret
+
+00000000008002a5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+  8002a9:	48 83 ec 50          	sub    $0x50,%rsp
+  8002ad:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002b1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002b5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002b9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002bd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002c1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002c8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002cc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002d0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002d4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002d8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002dc:	48 b8 41 02 80 00 00 	movabs $0x800241,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002e8:	c9                   	leave
+  8002e9:	c3                   	ret
+
+00000000008002ea <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002ea:	55                   	push   %rbp
+  8002eb:	48 89 e5             	mov    %rsp,%rbp
+  8002ee:	41 57                	push   %r15
+  8002f0:	41 56                	push   %r14
+  8002f2:	41 55                	push   %r13
+  8002f4:	41 54                	push   %r12
+  8002f6:	53                   	push   %rbx
+  8002f7:	48 83 ec 18          	sub    $0x18,%rsp
+  8002fb:	49 89 fc             	mov    %rdi,%r12
+  8002fe:	49 89 f5             	mov    %rsi,%r13
+  800301:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800305:	8b 45 10             	mov    0x10(%rbp),%eax
+  800308:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80030b:	41 89 cf             	mov    %ecx,%r15d
+  80030e:	4c 39 fa             	cmp    %r15,%rdx
+  800311:	73 5b                	jae    80036e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800313:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800317:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80031b:	85 db                	test   %ebx,%ebx
+  80031d:	7e 0e                	jle    80032d <print_num+0x43>
+            putch(padc, put_arg);
+  80031f:	4c 89 ee             	mov    %r13,%rsi
+  800322:	44 89 f7             	mov    %r14d,%edi
+  800325:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800328:	83 eb 01             	sub    $0x1,%ebx
+  80032b:	75 f2                	jne    80031f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80032d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800331:	48 b9 d1 48 80 00 00 	movabs $0x8048d1,%rcx
+  800338:	00 00 00 
+  80033b:	48 b8 c0 48 80 00 00 	movabs $0x8048c0,%rax
+  800342:	00 00 00 
+  800345:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800349:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80034d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800352:	49 f7 f7             	div    %r15
+  800355:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800359:	4c 89 ee             	mov    %r13,%rsi
+  80035c:	41 ff d4             	call   *%r12
+}
+  80035f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800363:	5b                   	pop    %rbx
+  800364:	41 5c                	pop    %r12
+  800366:	41 5d                	pop    %r13
+  800368:	41 5e                	pop    %r14
+  80036a:	41 5f                	pop    %r15
+  80036c:	5d                   	pop    %rbp
+  80036d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80036e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800372:	ba 00 00 00 00       	mov    $0x0,%edx
+  800377:	49 f7 f7             	div    %r15
+  80037a:	48 83 ec 08          	sub    $0x8,%rsp
+  80037e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800382:	52                   	push   %rdx
+  800383:	45 0f be c9          	movsbl %r9b,%r9d
+  800387:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80038b:	48 89 c2             	mov    %rax,%rdx
+  80038e:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  800395:	00 00 00 
+  800398:	ff d0                	call   *%rax
+  80039a:	48 83 c4 10          	add    $0x10,%rsp
+  80039e:	eb 8d                	jmp    80032d <print_num+0x43>
+
+00000000008003a0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003a0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003a4:	48 8b 06             	mov    (%rsi),%rax
+  8003a7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003ab:	73 0a                	jae    8003b7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003ad:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003b1:	48 89 16             	mov    %rdx,(%rsi)
+  8003b4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003b7:	c3                   	ret
+
+00000000008003b8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003b8:	55                   	push   %rbp
+  8003b9:	48 89 e5             	mov    %rsp,%rbp
+  8003bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003c8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003cc:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003d3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003db:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003e3:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003e7:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  8003ee:	00 00 00 
+  8003f1:	ff d0                	call   *%rax
+}
+  8003f3:	c9                   	leave
+  8003f4:	c3                   	ret
+
+00000000008003f5 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8003f5:	55                   	push   %rbp
+  8003f6:	48 89 e5             	mov    %rsp,%rbp
+  8003f9:	41 57                	push   %r15
+  8003fb:	41 56                	push   %r14
+  8003fd:	41 55                	push   %r13
+  8003ff:	41 54                	push   %r12
+  800401:	53                   	push   %rbx
+  800402:	48 83 ec 38          	sub    $0x38,%rsp
+  800406:	49 89 fe             	mov    %rdi,%r14
+  800409:	49 89 f5             	mov    %rsi,%r13
+  80040c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80040f:	48 8b 01             	mov    (%rcx),%rax
+  800412:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800416:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80041a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80041e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800422:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800426:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80042a:	0f b6 3b             	movzbl (%rbx),%edi
+  80042d:	40 80 ff 25          	cmp    $0x25,%dil
+  800431:	74 18                	je     80044b <vprintfmt+0x56>
+            if (!ch) return;
+  800433:	40 84 ff             	test   %dil,%dil
+  800436:	0f 84 b1 06 00 00    	je     800aed <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80043c:	40 0f b6 ff          	movzbl %dil,%edi
+  800440:	4c 89 ee             	mov    %r13,%rsi
+  800443:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800446:	4c 89 e3             	mov    %r12,%rbx
+  800449:	eb db                	jmp    800426 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80044b:	be 00 00 00 00       	mov    $0x0,%esi
+  800450:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800454:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800459:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80045f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800466:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80046a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80046f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800474:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800477:	83 e8 23             	sub    $0x23,%eax
+  80047a:	3c 57                	cmp    $0x57,%al
+  80047c:	0f 87 51 06 00 00    	ja     800ad3 <vprintfmt+0x6de>
+  800482:	0f b6 c0             	movzbl %al,%eax
+  800485:	48 b9 80 4a 80 00 00 	movabs $0x804a80,%rcx
+  80048c:	00 00 00 
+  80048f:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800492:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800495:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800499:	eb cf                	jmp    80046a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80049b:	49 89 dc             	mov    %rbx,%r12
+  80049e:	be 01 00 00 00       	mov    $0x1,%esi
+  8004a3:	eb c5                	jmp    80046a <vprintfmt+0x75>
+            padc = ch;
+  8004a5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004a9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004ac:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004af:	eb b9                	jmp    80046a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8004b7:	77 24                	ja     8004dd <vprintfmt+0xe8>
+  8004b9:	89 c1                	mov    %eax,%ecx
+  8004bb:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004bf:	83 c0 08             	add    $0x8,%eax
+  8004c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004c5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004c8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004cb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004cf:	79 99                	jns    80046a <vprintfmt+0x75>
+                width = precision;
+  8004d1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004d5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004db:	eb 8d                	jmp    80046a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004dd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004e1:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004e5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e9:	eb da                	jmp    8004c5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004eb:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8004f0:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8004f4:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8004fa:	3c 39                	cmp    $0x39,%al
+  8004fc:	77 1c                	ja     80051a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8004fe:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800502:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800506:	0f b6 c0             	movzbl %al,%eax
+  800509:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80050e:	0f b6 03             	movzbl (%rbx),%eax
+  800511:	3c 39                	cmp    $0x39,%al
+  800513:	76 e9                	jbe    8004fe <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800515:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800518:	eb b1                	jmp    8004cb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80051a:	49 89 dc             	mov    %rbx,%r12
+  80051d:	eb ac                	jmp    8004cb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80051f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800522:	85 c9                	test   %ecx,%ecx
+  800524:	b8 00 00 00 00       	mov    $0x0,%eax
+  800529:	0f 49 c1             	cmovns %ecx,%eax
+  80052c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80052f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800532:	e9 33 ff ff ff       	jmp    80046a <vprintfmt+0x75>
+            lflag++;
+  800537:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80053a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80053d:	e9 28 ff ff ff       	jmp    80046a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800542:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800545:	83 f8 2f             	cmp    $0x2f,%eax
+  800548:	77 19                	ja     800563 <vprintfmt+0x16e>
+  80054a:	89 c2                	mov    %eax,%edx
+  80054c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800550:	83 c0 08             	add    $0x8,%eax
+  800553:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800556:	8b 3a                	mov    (%rdx),%edi
+  800558:	4c 89 ee             	mov    %r13,%rsi
+  80055b:	41 ff d6             	call   *%r14
+            break;
+  80055e:	e9 c3 fe ff ff       	jmp    800426 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800563:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800567:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80056b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80056f:	eb e5                	jmp    800556 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800571:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800574:	83 f8 2f             	cmp    $0x2f,%eax
+  800577:	77 5a                	ja     8005d3 <vprintfmt+0x1de>
+  800579:	89 c2                	mov    %eax,%edx
+  80057b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80057f:	83 c0 08             	add    $0x8,%eax
+  800582:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800585:	8b 02                	mov    (%rdx),%eax
+  800587:	89 c1                	mov    %eax,%ecx
+  800589:	f7 d9                	neg    %ecx
+  80058b:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80058e:	83 f9 16             	cmp    $0x16,%ecx
+  800591:	7f 4e                	jg     8005e1 <vprintfmt+0x1ec>
+  800593:	48 63 c1             	movslq %ecx,%rax
+  800596:	48 ba 40 4d 80 00 00 	movabs $0x804d40,%rdx
+  80059d:	00 00 00 
+  8005a0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005a4:	48 85 c0             	test   %rax,%rax
+  8005a7:	74 38                	je     8005e1 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005a9:	48 89 c1             	mov    %rax,%rcx
+  8005ac:	48 ba 39 4f 80 00 00 	movabs $0x804f39,%rdx
+  8005b3:	00 00 00 
+  8005b6:	4c 89 ee             	mov    %r13,%rsi
+  8005b9:	4c 89 f7             	mov    %r14,%rdi
+  8005bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c1:	49 b8 b8 03 80 00 00 	movabs $0x8003b8,%r8
+  8005c8:	00 00 00 
+  8005cb:	41 ff d0             	call   *%r8
+  8005ce:	e9 53 fe ff ff       	jmp    800426 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005df:	eb a4                	jmp    800585 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005e1:	48 ba e9 48 80 00 00 	movabs $0x8048e9,%rdx
+  8005e8:	00 00 00 
+  8005eb:	4c 89 ee             	mov    %r13,%rsi
+  8005ee:	4c 89 f7             	mov    %r14,%rdi
+  8005f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005f6:	49 b8 b8 03 80 00 00 	movabs $0x8003b8,%r8
+  8005fd:	00 00 00 
+  800600:	41 ff d0             	call   *%r8
+  800603:	e9 1e fe ff ff       	jmp    800426 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800608:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80060b:	83 f8 2f             	cmp    $0x2f,%eax
+  80060e:	77 6c                	ja     80067c <vprintfmt+0x287>
+  800610:	89 c2                	mov    %eax,%edx
+  800612:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800616:	83 c0 08             	add    $0x8,%eax
+  800619:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80061c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80061f:	48 85 d2             	test   %rdx,%rdx
+  800622:	48 b8 e2 48 80 00 00 	movabs $0x8048e2,%rax
+  800629:	00 00 00 
+  80062c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800630:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800634:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800638:	7e 06                	jle    800640 <vprintfmt+0x24b>
+  80063a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80063e:	75 4a                	jne    80068a <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800640:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800644:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800648:	0f b6 00             	movzbl (%rax),%eax
+  80064b:	84 c0                	test   %al,%al
+  80064d:	0f 85 9a 00 00 00    	jne    8006ed <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800653:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800656:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80065a:	85 c0                	test   %eax,%eax
+  80065c:	0f 8e c4 fd ff ff    	jle    800426 <vprintfmt+0x31>
+  800662:	4c 89 ee             	mov    %r13,%rsi
+  800665:	bf 20 00 00 00       	mov    $0x20,%edi
+  80066a:	41 ff d6             	call   *%r14
+  80066d:	41 83 ec 01          	sub    $0x1,%r12d
+  800671:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800675:	75 eb                	jne    800662 <vprintfmt+0x26d>
+  800677:	e9 aa fd ff ff       	jmp    800426 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80067c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800680:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800684:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800688:	eb 92                	jmp    80061c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80068a:	49 63 f7             	movslq %r15d,%rsi
+  80068d:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800691:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  800698:	00 00 00 
+  80069b:	ff d0                	call   *%rax
+  80069d:	48 89 c2             	mov    %rax,%rdx
+  8006a0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006a5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006a8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006ab:	85 c0                	test   %eax,%eax
+  8006ad:	7e 91                	jle    800640 <vprintfmt+0x24b>
+  8006af:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006b4:	4c 89 ee             	mov    %r13,%rsi
+  8006b7:	44 89 e7             	mov    %r12d,%edi
+  8006ba:	41 ff d6             	call   *%r14
+  8006bd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006c7:	75 eb                	jne    8006b4 <vprintfmt+0x2bf>
+  8006c9:	e9 72 ff ff ff       	jmp    800640 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ce:	0f b6 f8             	movzbl %al,%edi
+  8006d1:	4c 89 ee             	mov    %r13,%rsi
+  8006d4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006d7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006db:	49 83 c4 01          	add    $0x1,%r12
+  8006df:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006e5:	84 c0                	test   %al,%al
+  8006e7:	0f 84 66 ff ff ff    	je     800653 <vprintfmt+0x25e>
+  8006ed:	45 85 ff             	test   %r15d,%r15d
+  8006f0:	78 0a                	js     8006fc <vprintfmt+0x307>
+  8006f2:	41 83 ef 01          	sub    $0x1,%r15d
+  8006f6:	0f 88 57 ff ff ff    	js     800653 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006fc:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800700:	74 cc                	je     8006ce <vprintfmt+0x2d9>
+  800702:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800705:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80070a:	80 fa 5e             	cmp    $0x5e,%dl
+  80070d:	77 c2                	ja     8006d1 <vprintfmt+0x2dc>
+  80070f:	eb bd                	jmp    8006ce <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800711:	40 84 f6             	test   %sil,%sil
+  800714:	75 26                	jne    80073c <vprintfmt+0x347>
+    switch (lflag) {
+  800716:	85 d2                	test   %edx,%edx
+  800718:	74 59                	je     800773 <vprintfmt+0x37e>
+  80071a:	83 fa 01             	cmp    $0x1,%edx
+  80071d:	74 7b                	je     80079a <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80071f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800722:	83 f8 2f             	cmp    $0x2f,%eax
+  800725:	0f 87 96 00 00 00    	ja     8007c1 <vprintfmt+0x3cc>
+  80072b:	89 c2                	mov    %eax,%edx
+  80072d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800731:	83 c0 08             	add    $0x8,%eax
+  800734:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800737:	4c 8b 22             	mov    (%rdx),%r12
+  80073a:	eb 17                	jmp    800753 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80073c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80073f:	83 f8 2f             	cmp    $0x2f,%eax
+  800742:	77 21                	ja     800765 <vprintfmt+0x370>
+  800744:	89 c2                	mov    %eax,%edx
+  800746:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80074a:	83 c0 08             	add    $0x8,%eax
+  80074d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800750:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800753:	4d 85 e4             	test   %r12,%r12
+  800756:	78 7a                	js     8007d2 <vprintfmt+0x3dd>
+            num = i;
+  800758:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80075b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800760:	e9 50 02 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800765:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800769:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80076d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800771:	eb dd                	jmp    800750 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800773:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800776:	83 f8 2f             	cmp    $0x2f,%eax
+  800779:	77 11                	ja     80078c <vprintfmt+0x397>
+  80077b:	89 c2                	mov    %eax,%edx
+  80077d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800781:	83 c0 08             	add    $0x8,%eax
+  800784:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800787:	4c 63 22             	movslq (%rdx),%r12
+  80078a:	eb c7                	jmp    800753 <vprintfmt+0x35e>
+  80078c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800790:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800794:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800798:	eb ed                	jmp    800787 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  80079a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079d:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a0:	77 11                	ja     8007b3 <vprintfmt+0x3be>
+  8007a2:	89 c2                	mov    %eax,%edx
+  8007a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a8:	83 c0 08             	add    $0x8,%eax
+  8007ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ae:	4c 8b 22             	mov    (%rdx),%r12
+  8007b1:	eb a0                	jmp    800753 <vprintfmt+0x35e>
+  8007b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bf:	eb ed                	jmp    8007ae <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007c1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007c5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007cd:	e9 65 ff ff ff       	jmp    800737 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007d2:	4c 89 ee             	mov    %r13,%rsi
+  8007d5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007da:	41 ff d6             	call   *%r14
+                i = -i;
+  8007dd:	49 f7 dc             	neg    %r12
+  8007e0:	e9 73 ff ff ff       	jmp    800758 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007e5:	40 84 f6             	test   %sil,%sil
+  8007e8:	75 32                	jne    80081c <vprintfmt+0x427>
+    switch (lflag) {
+  8007ea:	85 d2                	test   %edx,%edx
+  8007ec:	74 5d                	je     80084b <vprintfmt+0x456>
+  8007ee:	83 fa 01             	cmp    $0x1,%edx
+  8007f1:	0f 84 82 00 00 00    	je     800879 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8007f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8007fd:	0f 87 a5 00 00 00    	ja     8008a8 <vprintfmt+0x4b3>
+  800803:	89 c2                	mov    %eax,%edx
+  800805:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800809:	83 c0 08             	add    $0x8,%eax
+  80080c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80080f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800812:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800817:	e9 99 01 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80081c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 19                	ja     80083d <vprintfmt+0x448>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800833:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800838:	e9 78 01 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+  80083d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800841:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800845:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800849:	eb e5                	jmp    800830 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80084b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084e:	83 f8 2f             	cmp    $0x2f,%eax
+  800851:	77 18                	ja     80086b <vprintfmt+0x476>
+  800853:	89 c2                	mov    %eax,%edx
+  800855:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800859:	83 c0 08             	add    $0x8,%eax
+  80085c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800861:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800866:	e9 4a 01 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+  80086b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80086f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800873:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800877:	eb e6                	jmp    80085f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800879:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80087c:	83 f8 2f             	cmp    $0x2f,%eax
+  80087f:	77 19                	ja     80089a <vprintfmt+0x4a5>
+  800881:	89 c2                	mov    %eax,%edx
+  800883:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800887:	83 c0 08             	add    $0x8,%eax
+  80088a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80088d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800890:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800895:	e9 1b 01 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+  80089a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a6:	eb e5                	jmp    80088d <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008a8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b4:	e9 56 ff ff ff       	jmp    80080f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008b9:	40 84 f6             	test   %sil,%sil
+  8008bc:	75 2e                	jne    8008ec <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008be:	85 d2                	test   %edx,%edx
+  8008c0:	74 59                	je     80091b <vprintfmt+0x526>
+  8008c2:	83 fa 01             	cmp    $0x1,%edx
+  8008c5:	74 7f                	je     800946 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cd:	0f 87 9f 00 00 00    	ja     800972 <vprintfmt+0x57d>
+  8008d3:	89 c2                	mov    %eax,%edx
+  8008d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d9:	83 c0 08             	add    $0x8,%eax
+  8008dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008e2:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008e7:	e9 c9 00 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ec:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ef:	83 f8 2f             	cmp    $0x2f,%eax
+  8008f2:	77 19                	ja     80090d <vprintfmt+0x518>
+  8008f4:	89 c2                	mov    %eax,%edx
+  8008f6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008fa:	83 c0 08             	add    $0x8,%eax
+  8008fd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800900:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800903:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800908:	e9 a8 00 00 00       	jmp    8009b5 <vprintfmt+0x5c0>
+  80090d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800911:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800915:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800919:	eb e5                	jmp    800900 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80091b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80091e:	83 f8 2f             	cmp    $0x2f,%eax
+  800921:	77 15                	ja     800938 <vprintfmt+0x543>
+  800923:	89 c2                	mov    %eax,%edx
+  800925:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800929:	83 c0 08             	add    $0x8,%eax
+  80092c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800931:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800936:	eb 7d                	jmp    8009b5 <vprintfmt+0x5c0>
+  800938:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800940:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800944:	eb e9                	jmp    80092f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800949:	83 f8 2f             	cmp    $0x2f,%eax
+  80094c:	77 16                	ja     800964 <vprintfmt+0x56f>
+  80094e:	89 c2                	mov    %eax,%edx
+  800950:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800954:	83 c0 08             	add    $0x8,%eax
+  800957:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80095a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80095d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800962:	eb 51                	jmp    8009b5 <vprintfmt+0x5c0>
+  800964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800970:	eb e8                	jmp    80095a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	e9 5c ff ff ff       	jmp    8008df <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800983:	4c 89 ee             	mov    %r13,%rsi
+  800986:	bf 30 00 00 00       	mov    $0x30,%edi
+  80098b:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  80098e:	4c 89 ee             	mov    %r13,%rsi
+  800991:	bf 78 00 00 00       	mov    $0x78,%edi
+  800996:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099c:	83 f8 2f             	cmp    $0x2f,%eax
+  80099f:	77 47                	ja     8009e8 <vprintfmt+0x5f3>
+  8009a1:	89 c2                	mov    %eax,%edx
+  8009a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a7:	83 c0 08             	add    $0x8,%eax
+  8009aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ad:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009b0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8009b9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009bd:	0f 94 c0             	sete   %al
+  8009c0:	0f b6 c0             	movzbl %al,%eax
+  8009c3:	50                   	push   %rax
+  8009c4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009c9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009cd:	4c 89 ee             	mov    %r13,%rsi
+  8009d0:	4c 89 f7             	mov    %r14,%rdi
+  8009d3:	48 b8 ea 02 80 00 00 	movabs $0x8002ea,%rax
+  8009da:	00 00 00 
+  8009dd:	ff d0                	call   *%rax
+            break;
+  8009df:	48 83 c4 10          	add    $0x10,%rsp
+  8009e3:	e9 3e fa ff ff       	jmp    800426 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009f4:	eb b7                	jmp    8009ad <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f6:	40 84 f6             	test   %sil,%sil
+  8009f9:	75 2b                	jne    800a26 <vprintfmt+0x631>
+    switch (lflag) {
+  8009fb:	85 d2                	test   %edx,%edx
+  8009fd:	74 56                	je     800a55 <vprintfmt+0x660>
+  8009ff:	83 fa 01             	cmp    $0x1,%edx
+  800a02:	74 7f                	je     800a83 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a04:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a07:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0a:	0f 87 a2 00 00 00    	ja     800ab2 <vprintfmt+0x6bd>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a24:	eb 8f                	jmp    8009b5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a26:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a29:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2c:	77 19                	ja     800a47 <vprintfmt+0x652>
+  800a2e:	89 c2                	mov    %eax,%edx
+  800a30:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a34:	83 c0 08             	add    $0x8,%eax
+  800a37:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a42:	e9 6e ff ff ff       	jmp    8009b5 <vprintfmt+0x5c0>
+  800a47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a53:	eb e5                	jmp    800a3a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a58:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5b:	77 18                	ja     800a75 <vprintfmt+0x680>
+  800a5d:	89 c2                	mov    %eax,%edx
+  800a5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a63:	83 c0 08             	add    $0x8,%eax
+  800a66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a69:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a70:	e9 40 ff ff ff       	jmp    8009b5 <vprintfmt+0x5c0>
+  800a75:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a79:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a81:	eb e6                	jmp    800a69 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a83:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a86:	83 f8 2f             	cmp    $0x2f,%eax
+  800a89:	77 19                	ja     800aa4 <vprintfmt+0x6af>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a9a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800a9f:	e9 11 ff ff ff       	jmp    8009b5 <vprintfmt+0x5c0>
+  800aa4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab0:	eb e5                	jmp    800a97 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ab2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800abe:	e9 59 ff ff ff       	jmp    800a1c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ac3:	4c 89 ee             	mov    %r13,%rsi
+  800ac6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800acb:	41 ff d6             	call   *%r14
+            break;
+  800ace:	e9 53 f9 ff ff       	jmp    800426 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ad3:	4c 89 ee             	mov    %r13,%rsi
+  800ad6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800adb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800ade:	48 83 eb 01          	sub    $0x1,%rbx
+  800ae2:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ae6:	75 f6                	jne    800ade <vprintfmt+0x6e9>
+  800ae8:	e9 39 f9 ff ff       	jmp    800426 <vprintfmt+0x31>
+}
+  800aed:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800af1:	5b                   	pop    %rbx
+  800af2:	41 5c                	pop    %r12
+  800af4:	41 5d                	pop    %r13
+  800af6:	41 5e                	pop    %r14
+  800af8:	41 5f                	pop    %r15
+  800afa:	5d                   	pop    %rbp
+  800afb:	c3                   	ret
+
+0000000000800afc <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800afc:	55                   	push   %rbp
+  800afd:	48 89 e5             	mov    %rsp,%rbp
+  800b00:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b04:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b08:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b0d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b11:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b18:	48 85 ff             	test   %rdi,%rdi
+  800b1b:	74 2b                	je     800b48 <vsnprintf+0x4c>
+  800b1d:	48 85 f6             	test   %rsi,%rsi
+  800b20:	74 26                	je     800b48 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b22:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b26:	48 bf a0 03 80 00 00 	movabs $0x8003a0,%rdi
+  800b2d:	00 00 00 
+  800b30:	48 b8 f5 03 80 00 00 	movabs $0x8003f5,%rax
+  800b37:	00 00 00 
+  800b3a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b3c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b40:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b43:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b46:	c9                   	leave
+  800b47:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b48:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b4d:	eb f7                	jmp    800b46 <vsnprintf+0x4a>
+
+0000000000800b4f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b4f:	55                   	push   %rbp
+  800b50:	48 89 e5             	mov    %rsp,%rbp
+  800b53:	48 83 ec 50          	sub    $0x50,%rsp
+  800b57:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b5b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b5f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b63:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b6a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b72:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b76:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b7a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b7e:	48 b8 fc 0a 80 00 00 	movabs $0x800afc,%rax
+  800b85:	00 00 00 
+  800b88:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b8a:	c9                   	leave
+  800b8b:	c3                   	ret
+
+0000000000800b8c <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800b8c:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800b8f:	74 10                	je     800ba1 <strlen+0x15>
+    size_t n = 0;
+  800b91:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800b96:	48 83 c0 01          	add    $0x1,%rax
+  800b9a:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800b9e:	75 f6                	jne    800b96 <strlen+0xa>
+  800ba0:	c3                   	ret
+    size_t n = 0;
+  800ba1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800ba6:	c3                   	ret
+
+0000000000800ba7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800ba7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800baa:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800baf:	48 85 f6             	test   %rsi,%rsi
+  800bb2:	74 11                	je     800bc5 <strnlen+0x1e>
+  800bb4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bb8:	74 0c                	je     800bc6 <strnlen+0x1f>
+  800bba:	48 83 c2 01          	add    $0x1,%rdx
+  800bbe:	48 39 d0             	cmp    %rdx,%rax
+  800bc1:	75 f1                	jne    800bb4 <strnlen+0xd>
+  800bc3:	eb 04                	jmp    800bc9 <strnlen+0x22>
+  800bc5:	c3                   	ret
+  800bc6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bc9:	c3                   	ret
+
+0000000000800bca <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bca:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bcd:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bd2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bd6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bd9:	48 83 c2 01          	add    $0x1,%rdx
+  800bdd:	84 c9                	test   %cl,%cl
+  800bdf:	75 f1                	jne    800bd2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800be1:	c3                   	ret
+
+0000000000800be2 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800be2:	55                   	push   %rbp
+  800be3:	48 89 e5             	mov    %rsp,%rbp
+  800be6:	41 54                	push   %r12
+  800be8:	53                   	push   %rbx
+  800be9:	48 89 fb             	mov    %rdi,%rbx
+  800bec:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800bef:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800bfb:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800bff:	4c 89 e6             	mov    %r12,%rsi
+  800c02:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  800c09:	00 00 00 
+  800c0c:	ff d0                	call   *%rax
+    return dst;
+}
+  800c0e:	48 89 d8             	mov    %rbx,%rax
+  800c11:	5b                   	pop    %rbx
+  800c12:	41 5c                	pop    %r12
+  800c14:	5d                   	pop    %rbp
+  800c15:	c3                   	ret
+
+0000000000800c16 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c16:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c19:	48 85 d2             	test   %rdx,%rdx
+  800c1c:	74 1f                	je     800c3d <strncpy+0x27>
+  800c1e:	48 01 fa             	add    %rdi,%rdx
+  800c21:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c24:	48 83 c1 01          	add    $0x1,%rcx
+  800c28:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c2c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c30:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c34:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c38:	48 39 ca             	cmp    %rcx,%rdx
+  800c3b:	75 e7                	jne    800c24 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c3d:	c3                   	ret
+
+0000000000800c3e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c3e:	48 89 f8             	mov    %rdi,%rax
+  800c41:	48 85 d2             	test   %rdx,%rdx
+  800c44:	74 24                	je     800c6a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c46:	48 83 ea 01          	sub    $0x1,%rdx
+  800c4a:	74 1b                	je     800c67 <strlcpy+0x29>
+  800c4c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c50:	0f b6 16             	movzbl (%rsi),%edx
+  800c53:	84 d2                	test   %dl,%dl
+  800c55:	74 10                	je     800c67 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c57:	48 83 c6 01          	add    $0x1,%rsi
+  800c5b:	48 83 c0 01          	add    $0x1,%rax
+  800c5f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c62:	48 39 c8             	cmp    %rcx,%rax
+  800c65:	75 e9                	jne    800c50 <strlcpy+0x12>
+        *dst = '\0';
+  800c67:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c6a:	48 29 f8             	sub    %rdi,%rax
+}
+  800c6d:	c3                   	ret
+
+0000000000800c6e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c6e:	0f b6 07             	movzbl (%rdi),%eax
+  800c71:	84 c0                	test   %al,%al
+  800c73:	74 13                	je     800c88 <strcmp+0x1a>
+  800c75:	38 06                	cmp    %al,(%rsi)
+  800c77:	75 0f                	jne    800c88 <strcmp+0x1a>
+  800c79:	48 83 c7 01          	add    $0x1,%rdi
+  800c7d:	48 83 c6 01          	add    $0x1,%rsi
+  800c81:	0f b6 07             	movzbl (%rdi),%eax
+  800c84:	84 c0                	test   %al,%al
+  800c86:	75 ed                	jne    800c75 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c88:	0f b6 c0             	movzbl %al,%eax
+  800c8b:	0f b6 16             	movzbl (%rsi),%edx
+  800c8e:	29 d0                	sub    %edx,%eax
+}
+  800c90:	c3                   	ret
+
+0000000000800c91 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800c91:	48 85 d2             	test   %rdx,%rdx
+  800c94:	74 1f                	je     800cb5 <strncmp+0x24>
+  800c96:	0f b6 07             	movzbl (%rdi),%eax
+  800c99:	84 c0                	test   %al,%al
+  800c9b:	74 1e                	je     800cbb <strncmp+0x2a>
+  800c9d:	3a 06                	cmp    (%rsi),%al
+  800c9f:	75 1a                	jne    800cbb <strncmp+0x2a>
+  800ca1:	48 83 c7 01          	add    $0x1,%rdi
+  800ca5:	48 83 c6 01          	add    $0x1,%rsi
+  800ca9:	48 83 ea 01          	sub    $0x1,%rdx
+  800cad:	75 e7                	jne    800c96 <strncmp+0x5>
+
+    if (!n) return 0;
+  800caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb4:	c3                   	ret
+  800cb5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cba:	c3                   	ret
+  800cbb:	48 85 d2             	test   %rdx,%rdx
+  800cbe:	74 09                	je     800cc9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cc0:	0f b6 07             	movzbl (%rdi),%eax
+  800cc3:	0f b6 16             	movzbl (%rsi),%edx
+  800cc6:	29 d0                	sub    %edx,%eax
+  800cc8:	c3                   	ret
+    if (!n) return 0;
+  800cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cce:	c3                   	ret
+
+0000000000800ccf <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ccf:	0f b6 17             	movzbl (%rdi),%edx
+  800cd2:	84 d2                	test   %dl,%dl
+  800cd4:	74 18                	je     800cee <strchr+0x1f>
+        if (*str == c) {
+  800cd6:	0f be d2             	movsbl %dl,%edx
+  800cd9:	39 f2                	cmp    %esi,%edx
+  800cdb:	74 17                	je     800cf4 <strchr+0x25>
+    for (; *str; str++) {
+  800cdd:	48 83 c7 01          	add    $0x1,%rdi
+  800ce1:	0f b6 17             	movzbl (%rdi),%edx
+  800ce4:	84 d2                	test   %dl,%dl
+  800ce6:	75 ee                	jne    800cd6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ce8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ced:	c3                   	ret
+  800cee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cf3:	c3                   	ret
+  800cf4:	48 89 f8             	mov    %rdi,%rax
+}
+  800cf7:	c3                   	ret
+
+0000000000800cf8 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800cf8:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800cfb:	0f b6 17             	movzbl (%rdi),%edx
+  800cfe:	84 d2                	test   %dl,%dl
+  800d00:	74 13                	je     800d15 <strfind+0x1d>
+  800d02:	0f be d2             	movsbl %dl,%edx
+  800d05:	39 f2                	cmp    %esi,%edx
+  800d07:	74 0b                	je     800d14 <strfind+0x1c>
+  800d09:	48 83 c0 01          	add    $0x1,%rax
+  800d0d:	0f b6 10             	movzbl (%rax),%edx
+  800d10:	84 d2                	test   %dl,%dl
+  800d12:	75 ee                	jne    800d02 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d14:	c3                   	ret
+  800d15:	c3                   	ret
+
+0000000000800d16 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d16:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d19:	48 89 f8             	mov    %rdi,%rax
+  800d1c:	48 f7 d8             	neg    %rax
+  800d1f:	83 e0 07             	and    $0x7,%eax
+  800d22:	49 89 d1             	mov    %rdx,%r9
+  800d25:	49 29 c1             	sub    %rax,%r9
+  800d28:	78 36                	js     800d60 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d2a:	40 0f b6 c6          	movzbl %sil,%eax
+  800d2e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d35:	01 01 01 
+  800d38:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d3c:	40 f6 c7 07          	test   $0x7,%dil
+  800d40:	75 38                	jne    800d7a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d42:	4c 89 c9             	mov    %r9,%rcx
+  800d45:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d49:	74 0c                	je     800d57 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d4b:	fc                   	cld
+  800d4c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d4f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d53:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d57:	4d 85 c9             	test   %r9,%r9
+  800d5a:	75 45                	jne    800da1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d5c:	4c 89 c0             	mov    %r8,%rax
+  800d5f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d60:	48 85 d2             	test   %rdx,%rdx
+  800d63:	74 f7                	je     800d5c <memset+0x46>
+  800d65:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d68:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d6b:	48 83 c0 01          	add    $0x1,%rax
+  800d6f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d73:	48 39 c2             	cmp    %rax,%rdx
+  800d76:	75 f3                	jne    800d6b <memset+0x55>
+  800d78:	eb e2                	jmp    800d5c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d7a:	40 f6 c7 01          	test   $0x1,%dil
+  800d7e:	74 06                	je     800d86 <memset+0x70>
+  800d80:	88 07                	mov    %al,(%rdi)
+  800d82:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d86:	40 f6 c7 02          	test   $0x2,%dil
+  800d8a:	74 07                	je     800d93 <memset+0x7d>
+  800d8c:	66 89 07             	mov    %ax,(%rdi)
+  800d8f:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800d93:	40 f6 c7 04          	test   $0x4,%dil
+  800d97:	74 a9                	je     800d42 <memset+0x2c>
+  800d99:	89 07                	mov    %eax,(%rdi)
+  800d9b:	48 83 c7 04          	add    $0x4,%rdi
+  800d9f:	eb a1                	jmp    800d42 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da1:	41 f6 c1 04          	test   $0x4,%r9b
+  800da5:	74 06                	je     800dad <memset+0x97>
+  800da7:	89 07                	mov    %eax,(%rdi)
+  800da9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dad:	41 f6 c1 02          	test   $0x2,%r9b
+  800db1:	74 07                	je     800dba <memset+0xa4>
+  800db3:	66 89 07             	mov    %ax,(%rdi)
+  800db6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dba:	41 f6 c1 01          	test   $0x1,%r9b
+  800dbe:	74 9c                	je     800d5c <memset+0x46>
+  800dc0:	88 07                	mov    %al,(%rdi)
+  800dc2:	eb 98                	jmp    800d5c <memset+0x46>
+
+0000000000800dc4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dc4:	48 89 f8             	mov    %rdi,%rax
+  800dc7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dca:	48 39 fe             	cmp    %rdi,%rsi
+  800dcd:	73 3b                	jae    800e0a <memmove+0x46>
+  800dcf:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800dd3:	48 39 d7             	cmp    %rdx,%rdi
+  800dd6:	73 32                	jae    800e0a <memmove+0x46>
+        s += n;
+        d += n;
+  800dd8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ddc:	48 89 d6             	mov    %rdx,%rsi
+  800ddf:	48 09 fe             	or     %rdi,%rsi
+  800de2:	48 09 ce             	or     %rcx,%rsi
+  800de5:	40 f6 c6 07          	test   $0x7,%sil
+  800de9:	75 12                	jne    800dfd <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800deb:	48 83 ef 08          	sub    $0x8,%rdi
+  800def:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800df3:	48 c1 e9 03          	shr    $0x3,%rcx
+  800df7:	fd                   	std
+  800df8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800dfb:	fc                   	cld
+  800dfc:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800dfd:	48 83 ef 01          	sub    $0x1,%rdi
+  800e01:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e05:	fd                   	std
+  800e06:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e08:	eb f1                	jmp    800dfb <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e0a:	48 89 f2             	mov    %rsi,%rdx
+  800e0d:	48 09 c2             	or     %rax,%rdx
+  800e10:	48 09 ca             	or     %rcx,%rdx
+  800e13:	f6 c2 07             	test   $0x7,%dl
+  800e16:	75 0c                	jne    800e24 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e18:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e1c:	48 89 c7             	mov    %rax,%rdi
+  800e1f:	fc                   	cld
+  800e20:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e23:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e24:	48 89 c7             	mov    %rax,%rdi
+  800e27:	fc                   	cld
+  800e28:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e2a:	c3                   	ret
+
+0000000000800e2b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e2b:	55                   	push   %rbp
+  800e2c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e2f:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  800e36:	00 00 00 
+  800e39:	ff d0                	call   *%rax
+}
+  800e3b:	5d                   	pop    %rbp
+  800e3c:	c3                   	ret
+
+0000000000800e3d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e3d:	55                   	push   %rbp
+  800e3e:	48 89 e5             	mov    %rsp,%rbp
+  800e41:	41 57                	push   %r15
+  800e43:	41 56                	push   %r14
+  800e45:	41 55                	push   %r13
+  800e47:	41 54                	push   %r12
+  800e49:	53                   	push   %rbx
+  800e4a:	48 83 ec 08          	sub    $0x8,%rsp
+  800e4e:	49 89 fe             	mov    %rdi,%r14
+  800e51:	49 89 f7             	mov    %rsi,%r15
+  800e54:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e57:	48 89 f7             	mov    %rsi,%rdi
+  800e5a:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  800e61:	00 00 00 
+  800e64:	ff d0                	call   *%rax
+  800e66:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e69:	48 89 de             	mov    %rbx,%rsi
+  800e6c:	4c 89 f7             	mov    %r14,%rdi
+  800e6f:	48 b8 a7 0b 80 00 00 	movabs $0x800ba7,%rax
+  800e76:	00 00 00 
+  800e79:	ff d0                	call   *%rax
+  800e7b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e7e:	48 39 c3             	cmp    %rax,%rbx
+  800e81:	74 36                	je     800eb9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e83:	48 89 d8             	mov    %rbx,%rax
+  800e86:	4c 29 e8             	sub    %r13,%rax
+  800e89:	49 39 c4             	cmp    %rax,%r12
+  800e8c:	73 31                	jae    800ebf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800e8e:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800e93:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e97:	4c 89 fe             	mov    %r15,%rsi
+  800e9a:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  800ea1:	00 00 00 
+  800ea4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ea6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eaa:	48 83 c4 08          	add    $0x8,%rsp
+  800eae:	5b                   	pop    %rbx
+  800eaf:	41 5c                	pop    %r12
+  800eb1:	41 5d                	pop    %r13
+  800eb3:	41 5e                	pop    %r14
+  800eb5:	41 5f                	pop    %r15
+  800eb7:	5d                   	pop    %rbp
+  800eb8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eb9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ebd:	eb eb                	jmp    800eaa <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ebf:	48 83 eb 01          	sub    $0x1,%rbx
+  800ec3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ec7:	48 89 da             	mov    %rbx,%rdx
+  800eca:	4c 89 fe             	mov    %r15,%rsi
+  800ecd:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  800ed4:	00 00 00 
+  800ed7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ed9:	49 01 de             	add    %rbx,%r14
+  800edc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ee1:	eb c3                	jmp    800ea6 <strlcat+0x69>
+
+0000000000800ee3 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ee3:	48 85 d2             	test   %rdx,%rdx
+  800ee6:	74 2d                	je     800f15 <memcmp+0x32>
+  800ee8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800eed:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ef1:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800ef6:	44 38 c1             	cmp    %r8b,%cl
+  800ef9:	75 0f                	jne    800f0a <memcmp+0x27>
+    while (n-- > 0) {
+  800efb:	48 83 c0 01          	add    $0x1,%rax
+  800eff:	48 39 c2             	cmp    %rax,%rdx
+  800f02:	75 e9                	jne    800eed <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f04:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f09:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f0a:	0f b6 c1             	movzbl %cl,%eax
+  800f0d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f11:	44 29 c0             	sub    %r8d,%eax
+  800f14:	c3                   	ret
+    return 0;
+  800f15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f1a:	c3                   	ret
+
+0000000000800f1b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f1b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f1f:	48 39 c7             	cmp    %rax,%rdi
+  800f22:	73 0f                	jae    800f33 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f24:	40 38 37             	cmp    %sil,(%rdi)
+  800f27:	74 0e                	je     800f37 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f29:	48 83 c7 01          	add    $0x1,%rdi
+  800f2d:	48 39 f8             	cmp    %rdi,%rax
+  800f30:	75 f2                	jne    800f24 <memfind+0x9>
+  800f32:	c3                   	ret
+  800f33:	48 89 f8             	mov    %rdi,%rax
+  800f36:	c3                   	ret
+  800f37:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f3a:	c3                   	ret
+
+0000000000800f3b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f3b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f3e:	0f b6 37             	movzbl (%rdi),%esi
+  800f41:	40 80 fe 20          	cmp    $0x20,%sil
+  800f45:	74 06                	je     800f4d <strtol+0x12>
+  800f47:	40 80 fe 09          	cmp    $0x9,%sil
+  800f4b:	75 13                	jne    800f60 <strtol+0x25>
+  800f4d:	48 83 c7 01          	add    $0x1,%rdi
+  800f51:	0f b6 37             	movzbl (%rdi),%esi
+  800f54:	40 80 fe 20          	cmp    $0x20,%sil
+  800f58:	74 f3                	je     800f4d <strtol+0x12>
+  800f5a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f5e:	74 ed                	je     800f4d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f60:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f63:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f66:	3c 01                	cmp    $0x1,%al
+  800f68:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f6c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f72:	75 0f                	jne    800f83 <strtol+0x48>
+  800f74:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f77:	74 14                	je     800f8d <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f79:	85 d2                	test   %edx,%edx
+  800f7b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f80:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f88:	4c 63 ca             	movslq %edx,%r9
+  800f8b:	eb 36                	jmp    800fc3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f8d:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800f91:	74 0f                	je     800fa2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800f93:	85 d2                	test   %edx,%edx
+  800f95:	75 ec                	jne    800f83 <strtol+0x48>
+        s++;
+  800f97:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800f9b:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fa0:	eb e1                	jmp    800f83 <strtol+0x48>
+        s += 2;
+  800fa2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fa6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fab:	eb d6                	jmp    800f83 <strtol+0x48>
+            dig -= '0';
+  800fad:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fb0:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fb4:	41 39 d0             	cmp    %edx,%r8d
+  800fb7:	7d 21                	jge    800fda <strtol+0x9f>
+        val = val * base + dig;
+  800fb9:	49 0f af c1          	imul   %r9,%rax
+  800fbd:	0f b6 c9             	movzbl %cl,%ecx
+  800fc0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fc3:	48 83 c7 01          	add    $0x1,%rdi
+  800fc7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fcb:	80 f9 39             	cmp    $0x39,%cl
+  800fce:	76 dd                	jbe    800fad <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fd0:	80 f9 7b             	cmp    $0x7b,%cl
+  800fd3:	77 05                	ja     800fda <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fd5:	83 e9 57             	sub    $0x57,%ecx
+  800fd8:	eb d6                	jmp    800fb0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fda:	4d 85 d2             	test   %r10,%r10
+  800fdd:	74 03                	je     800fe2 <strtol+0xa7>
+  800fdf:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800fe2:	48 89 c2             	mov    %rax,%rdx
+  800fe5:	48 f7 da             	neg    %rdx
+  800fe8:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800fec:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800ff0:	c3                   	ret
+
+0000000000800ff1 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800ff6:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801001:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801007:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80100d:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80100f:	c3                   	ret
+
+0000000000801010 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801010:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801015:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80101f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801024:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801030:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801036:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801038:	c3                   	ret
+
+0000000000801039 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801039:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80103c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801041:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801046:	ba 00 00 00 00       	mov    $0x0,%edx
+  80104b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801051:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801057:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80105d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80105f:	48 85 c0             	test   %rax,%rax
+  801062:	7f 01                	jg     801065 <sys_env_destroy+0x2c>
+}
+  801064:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801065:	55                   	push   %rbp
+  801066:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801069:	49 89 c0             	mov    %rax,%r8
+  80106c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801071:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801078:	00 00 00 
+  80107b:	be 29 00 00 00       	mov    $0x29,%esi
+  801080:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801087:	00 00 00 
+  80108a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80108f:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801096:	00 00 00 
+  801099:	41 ff d1             	call   *%r9
+
+000000000080109c <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80109c:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010a6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010bc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010c2:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010c4:	c3                   	ret
+
+00000000008010c5 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010c5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010cf:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010df:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010e5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010eb:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010ed:	c3                   	ret
+
+00000000008010ee <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010ee:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f3:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8010fa:	00 00 00 
+  8010fd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801103:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801109:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110f:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801111:	c3                   	ret
+
+0000000000801112 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801112:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801115:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80111a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801120:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801126:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801128:	c3                   	ret
+
+0000000000801129 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801129:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80112c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801131:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801134:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80113a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801140:	0f 05                	syscall
+    if (check && ret > 0) {
+  801142:	48 85 c0             	test   %rax,%rax
+  801145:	7f 01                	jg     801148 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801147:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801148:	55                   	push   %rbp
+  801149:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80114c:	49 89 c0             	mov    %rax,%r8
+  80114f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801154:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  80115b:	00 00 00 
+  80115e:	be 29 00 00 00       	mov    $0x29,%esi
+  801163:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  80116a:	00 00 00 
+  80116d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801172:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801179:	00 00 00 
+  80117c:	41 ff d1             	call   *%r9
+
+000000000080117f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80117f:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801182:	48 63 d2             	movslq %edx,%rdx
+  801185:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801188:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118d:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801190:	0f 05                	syscall
+    if (check && ret > 0) {
+  801192:	48 85 c0             	test   %rax,%rax
+  801195:	7f 01                	jg     801198 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801197:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801198:	55                   	push   %rbp
+  801199:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80119c:	49 89 c0             	mov    %rax,%r8
+  80119f:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011a4:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  8011ab:	00 00 00 
+  8011ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8011b3:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  8011ba:	00 00 00 
+  8011bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011c2:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  8011c9:	00 00 00 
+  8011cc:	41 ff d1             	call   *%r9
+
+00000000008011cf <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011cf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011d2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011e9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011eb:	48 85 c0             	test   %rax,%rax
+  8011ee:	7f 01                	jg     8011f1 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8011f0:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8011f1:	55                   	push   %rbp
+  8011f2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011f5:	49 89 c0             	mov    %rax,%r8
+  8011f8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8011fd:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801204:	00 00 00 
+  801207:	be 29 00 00 00       	mov    $0x29,%esi
+  80120c:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801213:	00 00 00 
+  801216:	b8 00 00 00 00       	mov    $0x0,%eax
+  80121b:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801222:	00 00 00 
+  801225:	41 ff d1             	call   *%r9
+
+0000000000801228 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801228:	48 63 f6             	movslq %esi,%rsi
+  80122b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80122e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801233:	ba 00 00 00 00       	mov    $0x0,%edx
+  801238:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80123e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801244:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80124a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80124c:	48 85 c0             	test   %rax,%rax
+  80124f:	7f 01                	jg     801252 <sys_env_set_status+0x2a>
+}
+  801251:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801252:	55                   	push   %rbp
+  801253:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801256:	49 89 c0             	mov    %rax,%r8
+  801259:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80125e:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801265:	00 00 00 
+  801268:	be 29 00 00 00       	mov    $0x29,%esi
+  80126d:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801274:	00 00 00 
+  801277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127c:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801283:	00 00 00 
+  801286:	41 ff d1             	call   *%r9
+
+0000000000801289 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801289:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80128c:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801291:	ba 00 00 00 00       	mov    $0x0,%edx
+  801296:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80129c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012aa:	48 85 c0             	test   %rax,%rax
+  8012ad:	7f 01                	jg     8012b0 <sys_env_set_trapframe+0x27>
+}
+  8012af:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8012b0:	55                   	push   %rbp
+  8012b1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b4:	49 89 c0             	mov    %rax,%r8
+  8012b7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8012bc:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  8012c3:	00 00 00 
+  8012c6:	be 29 00 00 00       	mov    $0x29,%esi
+  8012cb:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  8012d2:	00 00 00 
+  8012d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012da:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  8012e1:	00 00 00 
+  8012e4:	41 ff d1             	call   *%r9
+
+00000000008012e7 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8012e7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ea:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ef:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012fa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801300:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801306:	0f 05                	syscall
+    if (check && ret > 0) {
+  801308:	48 85 c0             	test   %rax,%rax
+  80130b:	7f 01                	jg     80130e <sys_env_set_pgfault_upcall+0x27>
+}
+  80130d:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80130e:	55                   	push   %rbp
+  80130f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801312:	49 89 c0             	mov    %rax,%r8
+  801315:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80131a:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801321:	00 00 00 
+  801324:	be 29 00 00 00       	mov    $0x29,%esi
+  801329:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801330:	00 00 00 
+  801333:	b8 00 00 00 00       	mov    $0x0,%eax
+  801338:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  80133f:	00 00 00 
+  801342:	41 ff d1             	call   *%r9
+
+0000000000801345 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801345:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801348:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80134b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801350:	4d 63 c0             	movslq %r8d,%r8
+  801353:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801359:	0f 05                	syscall
+}
+  80135b:	c3                   	ret
+
+000000000080135c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80135c:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80135f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801367:	4d 63 c0             	movslq %r8d,%r8
+  80136a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801370:	0f 05                	syscall
+}
+  801372:	c3                   	ret
+
+0000000000801373 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801373:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801378:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137b:	45 89 c0             	mov    %r8d,%r8d
+  80137e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801384:	0f 05                	syscall
+    if (check && ret > 0) {
+  801386:	48 85 c0             	test   %rax,%rax
+  801389:	7f 01                	jg     80138c <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80138b:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80138c:	55                   	push   %rbp
+  80138d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801390:	49 89 c0             	mov    %rax,%r8
+  801393:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801398:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  80139f:	00 00 00 
+  8013a2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013a7:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  8013ae:	00 00 00 
+  8013b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013b6:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  8013bd:	00 00 00 
+  8013c0:	41 ff d1             	call   *%r9
+
+00000000008013c3 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8013c3:	55                   	push   %rbp
+  8013c4:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8013c7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013cd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d7:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  8013de:	00 00 00 
+  8013e1:	ff d0                	call   *%rax
+}
+  8013e3:	5d                   	pop    %rbp
+  8013e4:	c3                   	ret
+
+00000000008013e5 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013e5:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013ef:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801405:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80140b:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80140d:	c3                   	ret
+
+000000000080140e <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80140e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801413:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801418:	ba 00 00 00 00       	mov    $0x0,%edx
+  80141d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801423:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801429:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801431:	48 85 c0             	test   %rax,%rax
+  801434:	7f 01                	jg     801437 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801436:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801437:	55                   	push   %rbp
+  801438:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80143b:	49 89 c0             	mov    %rax,%r8
+  80143e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801443:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  80144a:	00 00 00 
+  80144d:	be 29 00 00 00       	mov    $0x29,%esi
+  801452:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801459:	00 00 00 
+  80145c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801461:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801468:	00 00 00 
+  80146b:	41 ff d1             	call   *%r9
+
+000000000080146e <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80146e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801473:	bf 00 00 00 00       	mov    $0x0,%edi
+  801478:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80147d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801482:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801488:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80148e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801494:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801496:	c3                   	ret
+
+0000000000801497 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801497:	89 d2                	mov    %edx,%edx
+  801499:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  80149b:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014a0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ac:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b2:	0f 05                	syscall
+}
+  8014b4:	c3                   	ret
+
+00000000008014b5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8014b5:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014c2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014d4:	0f 05                	syscall
+}
+  8014d6:	c3                   	ret
+
+00000000008014d7 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8014d7:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014da:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014f6:	0f 05                	syscall
+}
+  8014f8:	c3                   	ret
+
+00000000008014f9 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8014f9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014fc:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801501:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801506:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801511:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801517:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80151d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80151f:	48 85 c0             	test   %rax,%rax
+  801522:	7f 01                	jg     801525 <sys_irq_ack+0x2c>
+}
+  801524:	c3                   	ret
+sys_irq_ack(int irq) {
+  801525:	55                   	push   %rbp
+  801526:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801529:	49 89 c0             	mov    %rax,%r8
+  80152c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801531:	48 ba 18 4e 80 00 00 	movabs $0x804e18,%rdx
+  801538:	00 00 00 
+  80153b:	be 29 00 00 00       	mov    $0x29,%esi
+  801540:	48 bf 37 4e 80 00 00 	movabs $0x804e37,%rdi
+  801547:	00 00 00 
+  80154a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154f:	49 b9 67 43 80 00 00 	movabs $0x804367,%r9
+  801556:	00 00 00 
+  801559:	41 ff d1             	call   *%r9
+
+000000000080155c <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80155c:	55                   	push   %rbp
+  80155d:	48 89 e5             	mov    %rsp,%rbp
+  801560:	41 54                	push   %r12
+  801562:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801563:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  80156a:	00 00 00 
+  80156d:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80156f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801574:	0f 05                	syscall
+  801576:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801579:	85 c0                	test   %eax,%eax
+  80157b:	78 7e                	js     8015fb <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  80157d:	0f 84 80 00 00 00    	je     801603 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801583:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801589:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801590:	00 00 00 
+  801593:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801598:	89 c2                	mov    %eax,%edx
+  80159a:	be 00 00 00 00       	mov    $0x0,%esi
+  80159f:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015a4:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8015ab:	00 00 00 
+  8015ae:	ff d0                	call   *%rax
+  8015b0:	85 c0                	test   %eax,%eax
+  8015b2:	0f 88 86 00 00 00    	js     80163e <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8015b8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015bf:	00 00 00 
+  8015c2:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8015c9:	44 89 e7             	mov    %r12d,%edi
+  8015cc:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  8015d3:	00 00 00 
+  8015d6:	ff d0                	call   *%rax
+  8015d8:	85 c0                	test   %eax,%eax
+  8015da:	78 6a                	js     801646 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8015dc:	be 02 00 00 00       	mov    $0x2,%esi
+  8015e1:	44 89 e7             	mov    %r12d,%edi
+  8015e4:	48 b8 28 12 80 00 00 	movabs $0x801228,%rax
+  8015eb:	00 00 00 
+  8015ee:	ff d0                	call   *%rax
+		return -1;
+  8015f0:	85 c0                	test   %eax,%eax
+  8015f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8015f7:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8015fb:	44 89 e0             	mov    %r12d,%eax
+  8015fe:	5b                   	pop    %rbx
+  8015ff:	41 5c                	pop    %r12
+  801601:	5d                   	pop    %rbp
+  801602:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801603:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  80160a:	00 00 00 
+  80160d:	ff d0                	call   *%rax
+  80160f:	89 c2                	mov    %eax,%edx
+  801611:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801617:	48 89 d0             	mov    %rdx,%rax
+  80161a:	48 c1 e0 04          	shl    $0x4,%rax
+  80161e:	48 29 d0             	sub    %rdx,%rax
+  801621:	48 c1 e0 05          	shl    $0x5,%rax
+  801625:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80162c:	00 00 00 
+  80162f:	48 01 d0             	add    %rdx,%rax
+  801632:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801639:	00 00 00 
+        return 0;
+  80163c:	eb bd                	jmp    8015fb <fork+0x9f>
+		return -1;
+  80163e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801644:	eb b5                	jmp    8015fb <fork+0x9f>
+		return -1;
+  801646:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80164c:	eb ad                	jmp    8015fb <fork+0x9f>
+
+000000000080164e <sfork>:
+
+envid_t
+sfork() {
+  80164e:	55                   	push   %rbp
+  80164f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801652:	48 ba 45 4e 80 00 00 	movabs $0x804e45,%rdx
+  801659:	00 00 00 
+  80165c:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801661:	48 bf 60 4e 80 00 00 	movabs $0x804e60,%rdi
+  801668:	00 00 00 
+  80166b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801670:	48 b9 67 43 80 00 00 	movabs $0x804367,%rcx
+  801677:	00 00 00 
+  80167a:	ff d1                	call   *%rcx
+
+000000000080167c <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80167c:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801683:	ff ff ff 
+  801686:	48 01 f8             	add    %rdi,%rax
+  801689:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80168d:	c3                   	ret
+
+000000000080168e <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80168e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801695:	ff ff ff 
+  801698:	48 01 f8             	add    %rdi,%rax
+  80169b:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80169f:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016a5:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016a9:	c3                   	ret
+
+00000000008016aa <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8016aa:	55                   	push   %rbp
+  8016ab:	48 89 e5             	mov    %rsp,%rbp
+  8016ae:	41 57                	push   %r15
+  8016b0:	41 56                	push   %r14
+  8016b2:	41 55                	push   %r13
+  8016b4:	41 54                	push   %r12
+  8016b6:	53                   	push   %rbx
+  8016b7:	48 83 ec 08          	sub    $0x8,%rsp
+  8016bb:	49 89 ff             	mov    %rdi,%r15
+  8016be:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8016c3:	49 bd 39 3e 80 00 00 	movabs $0x803e39,%r13
+  8016ca:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8016cd:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8016d3:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8016d6:	48 89 df             	mov    %rbx,%rdi
+  8016d9:	41 ff d5             	call   *%r13
+  8016dc:	83 e0 04             	and    $0x4,%eax
+  8016df:	74 17                	je     8016f8 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8016e1:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8016e8:	4c 39 f3             	cmp    %r14,%rbx
+  8016eb:	75 e6                	jne    8016d3 <fd_alloc+0x29>
+  8016ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8016f3:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8016f8:	4d 89 27             	mov    %r12,(%r15)
+}
+  8016fb:	48 83 c4 08          	add    $0x8,%rsp
+  8016ff:	5b                   	pop    %rbx
+  801700:	41 5c                	pop    %r12
+  801702:	41 5d                	pop    %r13
+  801704:	41 5e                	pop    %r14
+  801706:	41 5f                	pop    %r15
+  801708:	5d                   	pop    %rbp
+  801709:	c3                   	ret
+
+000000000080170a <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80170a:	83 ff 1f             	cmp    $0x1f,%edi
+  80170d:	77 39                	ja     801748 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80170f:	55                   	push   %rbp
+  801710:	48 89 e5             	mov    %rsp,%rbp
+  801713:	41 54                	push   %r12
+  801715:	53                   	push   %rbx
+  801716:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801719:	48 63 df             	movslq %edi,%rbx
+  80171c:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801723:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801727:	48 89 df             	mov    %rbx,%rdi
+  80172a:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  801731:	00 00 00 
+  801734:	ff d0                	call   *%rax
+  801736:	a8 04                	test   $0x4,%al
+  801738:	74 14                	je     80174e <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80173a:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80173e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801743:	5b                   	pop    %rbx
+  801744:	41 5c                	pop    %r12
+  801746:	5d                   	pop    %rbp
+  801747:	c3                   	ret
+        return -E_INVAL;
+  801748:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80174d:	c3                   	ret
+        return -E_INVAL;
+  80174e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801753:	eb ee                	jmp    801743 <fd_lookup+0x39>
+
+0000000000801755 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801755:	55                   	push   %rbp
+  801756:	48 89 e5             	mov    %rsp,%rbp
+  801759:	41 54                	push   %r12
+  80175b:	53                   	push   %rbx
+  80175c:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80175f:	48 b8 00 4f 80 00 00 	movabs $0x804f00,%rax
+  801766:	00 00 00 
+  801769:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801770:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801773:	39 3b                	cmp    %edi,(%rbx)
+  801775:	74 47                	je     8017be <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801777:	48 83 c0 08          	add    $0x8,%rax
+  80177b:	48 8b 18             	mov    (%rax),%rbx
+  80177e:	48 85 db             	test   %rbx,%rbx
+  801781:	75 f0                	jne    801773 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801783:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80178a:	00 00 00 
+  80178d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801793:	89 fa                	mov    %edi,%edx
+  801795:	48 bf 70 4e 80 00 00 	movabs $0x804e70,%rdi
+  80179c:	00 00 00 
+  80179f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017a4:	48 b9 a5 02 80 00 00 	movabs $0x8002a5,%rcx
+  8017ab:	00 00 00 
+  8017ae:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8017b5:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8017b9:	5b                   	pop    %rbx
+  8017ba:	41 5c                	pop    %r12
+  8017bc:	5d                   	pop    %rbp
+  8017bd:	c3                   	ret
+            return 0;
+  8017be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c3:	eb f0                	jmp    8017b5 <dev_lookup+0x60>
+
+00000000008017c5 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8017c5:	55                   	push   %rbp
+  8017c6:	48 89 e5             	mov    %rsp,%rbp
+  8017c9:	41 55                	push   %r13
+  8017cb:	41 54                	push   %r12
+  8017cd:	53                   	push   %rbx
+  8017ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8017d2:	48 89 fb             	mov    %rdi,%rbx
+  8017d5:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017d8:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8017df:	ff ff ff 
+  8017e2:	48 01 df             	add    %rbx,%rdi
+  8017e5:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8017e9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8017ed:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  8017f4:	00 00 00 
+  8017f7:	ff d0                	call   *%rax
+  8017f9:	41 89 c5             	mov    %eax,%r13d
+  8017fc:	85 c0                	test   %eax,%eax
+  8017fe:	78 06                	js     801806 <fd_close+0x41>
+  801800:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801804:	74 1a                	je     801820 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801806:	45 84 e4             	test   %r12b,%r12b
+  801809:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180e:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801812:	44 89 e8             	mov    %r13d,%eax
+  801815:	48 83 c4 18          	add    $0x18,%rsp
+  801819:	5b                   	pop    %rbx
+  80181a:	41 5c                	pop    %r12
+  80181c:	41 5d                	pop    %r13
+  80181e:	5d                   	pop    %rbp
+  80181f:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801820:	8b 3b                	mov    (%rbx),%edi
+  801822:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801826:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  80182d:	00 00 00 
+  801830:	ff d0                	call   *%rax
+  801832:	41 89 c5             	mov    %eax,%r13d
+  801835:	85 c0                	test   %eax,%eax
+  801837:	78 1b                	js     801854 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801839:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80183d:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801841:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801847:	48 85 c0             	test   %rax,%rax
+  80184a:	74 08                	je     801854 <fd_close+0x8f>
+  80184c:	48 89 df             	mov    %rbx,%rdi
+  80184f:	ff d0                	call   *%rax
+  801851:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801854:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801859:	48 89 de             	mov    %rbx,%rsi
+  80185c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801861:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+    return res;
+  80186d:	eb a3                	jmp    801812 <fd_close+0x4d>
+
+000000000080186f <close>:
+
+int
+close(int fdnum) {
+  80186f:	55                   	push   %rbp
+  801870:	48 89 e5             	mov    %rsp,%rbp
+  801873:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801877:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80187b:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801882:	00 00 00 
+  801885:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801887:	85 c0                	test   %eax,%eax
+  801889:	78 15                	js     8018a0 <close+0x31>
+
+    return fd_close(fd, 1);
+  80188b:	be 01 00 00 00       	mov    $0x1,%esi
+  801890:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801894:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  80189b:	00 00 00 
+  80189e:	ff d0                	call   *%rax
+}
+  8018a0:	c9                   	leave
+  8018a1:	c3                   	ret
+
+00000000008018a2 <close_all>:
+
+void
+close_all(void) {
+  8018a2:	55                   	push   %rbp
+  8018a3:	48 89 e5             	mov    %rsp,%rbp
+  8018a6:	41 54                	push   %r12
+  8018a8:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018ae:	49 bc 6f 18 80 00 00 	movabs $0x80186f,%r12
+  8018b5:	00 00 00 
+  8018b8:	89 df                	mov    %ebx,%edi
+  8018ba:	41 ff d4             	call   *%r12
+  8018bd:	83 c3 01             	add    $0x1,%ebx
+  8018c0:	83 fb 20             	cmp    $0x20,%ebx
+  8018c3:	75 f3                	jne    8018b8 <close_all+0x16>
+}
+  8018c5:	5b                   	pop    %rbx
+  8018c6:	41 5c                	pop    %r12
+  8018c8:	5d                   	pop    %rbp
+  8018c9:	c3                   	ret
+
+00000000008018ca <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8018ca:	55                   	push   %rbp
+  8018cb:	48 89 e5             	mov    %rsp,%rbp
+  8018ce:	41 57                	push   %r15
+  8018d0:	41 56                	push   %r14
+  8018d2:	41 55                	push   %r13
+  8018d4:	41 54                	push   %r12
+  8018d6:	53                   	push   %rbx
+  8018d7:	48 83 ec 18          	sub    $0x18,%rsp
+  8018db:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8018de:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8018e2:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  8018e9:	00 00 00 
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	89 c3                	mov    %eax,%ebx
+  8018f0:	85 c0                	test   %eax,%eax
+  8018f2:	0f 88 b8 00 00 00    	js     8019b0 <dup+0xe6>
+    close(newfdnum);
+  8018f8:	44 89 e7             	mov    %r12d,%edi
+  8018fb:	48 b8 6f 18 80 00 00 	movabs $0x80186f,%rax
+  801902:	00 00 00 
+  801905:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801907:	4d 63 ec             	movslq %r12d,%r13
+  80190a:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801911:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801915:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801919:	4c 89 ff             	mov    %r15,%rdi
+  80191c:	49 be 8e 16 80 00 00 	movabs $0x80168e,%r14
+  801923:	00 00 00 
+  801926:	41 ff d6             	call   *%r14
+  801929:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80192c:	4c 89 ef             	mov    %r13,%rdi
+  80192f:	41 ff d6             	call   *%r14
+  801932:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801935:	48 89 df             	mov    %rbx,%rdi
+  801938:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80193f:	00 00 00 
+  801942:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801944:	a8 04                	test   $0x4,%al
+  801946:	74 2b                	je     801973 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801948:	41 89 c1             	mov    %eax,%r9d
+  80194b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801951:	4c 89 f1             	mov    %r14,%rcx
+  801954:	ba 00 00 00 00       	mov    $0x0,%edx
+  801959:	48 89 de             	mov    %rbx,%rsi
+  80195c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801961:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  801968:	00 00 00 
+  80196b:	ff d0                	call   *%rax
+  80196d:	89 c3                	mov    %eax,%ebx
+  80196f:	85 c0                	test   %eax,%eax
+  801971:	78 4e                	js     8019c1 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801973:	4c 89 ff             	mov    %r15,%rdi
+  801976:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80197d:	00 00 00 
+  801980:	ff d0                	call   *%rax
+  801982:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801985:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80198b:	4c 89 e9             	mov    %r13,%rcx
+  80198e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801993:	4c 89 fe             	mov    %r15,%rsi
+  801996:	bf 00 00 00 00       	mov    $0x0,%edi
+  80199b:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8019a2:	00 00 00 
+  8019a5:	ff d0                	call   *%rax
+  8019a7:	89 c3                	mov    %eax,%ebx
+  8019a9:	85 c0                	test   %eax,%eax
+  8019ab:	78 14                	js     8019c1 <dup+0xf7>
+
+    return newfdnum;
+  8019ad:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019b0:	89 d8                	mov    %ebx,%eax
+  8019b2:	48 83 c4 18          	add    $0x18,%rsp
+  8019b6:	5b                   	pop    %rbx
+  8019b7:	41 5c                	pop    %r12
+  8019b9:	41 5d                	pop    %r13
+  8019bb:	41 5e                	pop    %r14
+  8019bd:	41 5f                	pop    %r15
+  8019bf:	5d                   	pop    %rbp
+  8019c0:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8019c1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019c6:	4c 89 ee             	mov    %r13,%rsi
+  8019c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ce:	49 bc cf 11 80 00 00 	movabs $0x8011cf,%r12
+  8019d5:	00 00 00 
+  8019d8:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8019db:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8019e0:	4c 89 f6             	mov    %r14,%rsi
+  8019e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e8:	41 ff d4             	call   *%r12
+    return res;
+  8019eb:	eb c3                	jmp    8019b0 <dup+0xe6>
+
+00000000008019ed <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8019ed:	55                   	push   %rbp
+  8019ee:	48 89 e5             	mov    %rsp,%rbp
+  8019f1:	41 56                	push   %r14
+  8019f3:	41 55                	push   %r13
+  8019f5:	41 54                	push   %r12
+  8019f7:	53                   	push   %rbx
+  8019f8:	48 83 ec 10          	sub    $0x10,%rsp
+  8019fc:	89 fb                	mov    %edi,%ebx
+  8019fe:	49 89 f4             	mov    %rsi,%r12
+  801a01:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a04:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a08:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801a0f:	00 00 00 
+  801a12:	ff d0                	call   *%rax
+  801a14:	85 c0                	test   %eax,%eax
+  801a16:	78 4c                	js     801a64 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a18:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a1c:	41 8b 3e             	mov    (%r14),%edi
+  801a1f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a23:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  801a2a:	00 00 00 
+  801a2d:	ff d0                	call   *%rax
+  801a2f:	85 c0                	test   %eax,%eax
+  801a31:	78 35                	js     801a68 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a33:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a37:	83 e0 03             	and    $0x3,%eax
+  801a3a:	83 f8 01             	cmp    $0x1,%eax
+  801a3d:	74 2d                	je     801a6c <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a3f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a43:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a47:	48 85 c0             	test   %rax,%rax
+  801a4a:	74 56                	je     801aa2 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a4c:	4c 89 ea             	mov    %r13,%rdx
+  801a4f:	4c 89 e6             	mov    %r12,%rsi
+  801a52:	4c 89 f7             	mov    %r14,%rdi
+  801a55:	ff d0                	call   *%rax
+}
+  801a57:	48 83 c4 10          	add    $0x10,%rsp
+  801a5b:	5b                   	pop    %rbx
+  801a5c:	41 5c                	pop    %r12
+  801a5e:	41 5d                	pop    %r13
+  801a60:	41 5e                	pop    %r14
+  801a62:	5d                   	pop    %rbp
+  801a63:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a64:	48 98                	cltq
+  801a66:	eb ef                	jmp    801a57 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a68:	48 98                	cltq
+  801a6a:	eb eb                	jmp    801a57 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801a6c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a73:	00 00 00 
+  801a76:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a7c:	89 da                	mov    %ebx,%edx
+  801a7e:	48 bf b1 4e 80 00 00 	movabs $0x804eb1,%rdi
+  801a85:	00 00 00 
+  801a88:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a8d:	48 b9 a5 02 80 00 00 	movabs $0x8002a5,%rcx
+  801a94:	00 00 00 
+  801a97:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801a99:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801aa0:	eb b5                	jmp    801a57 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801aa2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801aa9:	eb ac                	jmp    801a57 <read+0x6a>
+
+0000000000801aab <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801aab:	55                   	push   %rbp
+  801aac:	48 89 e5             	mov    %rsp,%rbp
+  801aaf:	41 57                	push   %r15
+  801ab1:	41 56                	push   %r14
+  801ab3:	41 55                	push   %r13
+  801ab5:	41 54                	push   %r12
+  801ab7:	53                   	push   %rbx
+  801ab8:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801abc:	48 85 d2             	test   %rdx,%rdx
+  801abf:	74 54                	je     801b15 <readn+0x6a>
+  801ac1:	41 89 fd             	mov    %edi,%r13d
+  801ac4:	49 89 f6             	mov    %rsi,%r14
+  801ac7:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801aca:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801acf:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ad4:	49 bf ed 19 80 00 00 	movabs $0x8019ed,%r15
+  801adb:	00 00 00 
+  801ade:	4c 89 e2             	mov    %r12,%rdx
+  801ae1:	48 29 f2             	sub    %rsi,%rdx
+  801ae4:	4c 01 f6             	add    %r14,%rsi
+  801ae7:	44 89 ef             	mov    %r13d,%edi
+  801aea:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 20                	js     801b11 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801af1:	01 c3                	add    %eax,%ebx
+  801af3:	85 c0                	test   %eax,%eax
+  801af5:	74 08                	je     801aff <readn+0x54>
+  801af7:	48 63 f3             	movslq %ebx,%rsi
+  801afa:	4c 39 e6             	cmp    %r12,%rsi
+  801afd:	72 df                	jb     801ade <readn+0x33>
+    }
+    return res;
+  801aff:	48 63 c3             	movslq %ebx,%rax
+}
+  801b02:	48 83 c4 08          	add    $0x8,%rsp
+  801b06:	5b                   	pop    %rbx
+  801b07:	41 5c                	pop    %r12
+  801b09:	41 5d                	pop    %r13
+  801b0b:	41 5e                	pop    %r14
+  801b0d:	41 5f                	pop    %r15
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+        if (inc < 0) return inc;
+  801b11:	48 98                	cltq
+  801b13:	eb ed                	jmp    801b02 <readn+0x57>
+    int inc = 1, res = 0;
+  801b15:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b1a:	eb e3                	jmp    801aff <readn+0x54>
+
+0000000000801b1c <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b1c:	55                   	push   %rbp
+  801b1d:	48 89 e5             	mov    %rsp,%rbp
+  801b20:	41 56                	push   %r14
+  801b22:	41 55                	push   %r13
+  801b24:	41 54                	push   %r12
+  801b26:	53                   	push   %rbx
+  801b27:	48 83 ec 10          	sub    $0x10,%rsp
+  801b2b:	89 fb                	mov    %edi,%ebx
+  801b2d:	49 89 f4             	mov    %rsi,%r12
+  801b30:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b33:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b37:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801b3e:	00 00 00 
+  801b41:	ff d0                	call   *%rax
+  801b43:	85 c0                	test   %eax,%eax
+  801b45:	78 47                	js     801b8e <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b47:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b4b:	41 8b 3e             	mov    (%r14),%edi
+  801b4e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b52:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  801b59:	00 00 00 
+  801b5c:	ff d0                	call   *%rax
+  801b5e:	85 c0                	test   %eax,%eax
+  801b60:	78 30                	js     801b92 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801b62:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801b67:	74 2d                	je     801b96 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801b69:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b6d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801b71:	48 85 c0             	test   %rax,%rax
+  801b74:	74 56                	je     801bcc <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801b76:	4c 89 ea             	mov    %r13,%rdx
+  801b79:	4c 89 e6             	mov    %r12,%rsi
+  801b7c:	4c 89 f7             	mov    %r14,%rdi
+  801b7f:	ff d0                	call   *%rax
+}
+  801b81:	48 83 c4 10          	add    $0x10,%rsp
+  801b85:	5b                   	pop    %rbx
+  801b86:	41 5c                	pop    %r12
+  801b88:	41 5d                	pop    %r13
+  801b8a:	41 5e                	pop    %r14
+  801b8c:	5d                   	pop    %rbp
+  801b8d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b8e:	48 98                	cltq
+  801b90:	eb ef                	jmp    801b81 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b92:	48 98                	cltq
+  801b94:	eb eb                	jmp    801b81 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b96:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b9d:	00 00 00 
+  801ba0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ba6:	89 da                	mov    %ebx,%edx
+  801ba8:	48 bf cd 4e 80 00 00 	movabs $0x804ecd,%rdi
+  801baf:	00 00 00 
+  801bb2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb7:	48 b9 a5 02 80 00 00 	movabs $0x8002a5,%rcx
+  801bbe:	00 00 00 
+  801bc1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bc3:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801bca:	eb b5                	jmp    801b81 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bcc:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bd3:	eb ac                	jmp    801b81 <write+0x65>
+
+0000000000801bd5 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801bd5:	55                   	push   %rbp
+  801bd6:	48 89 e5             	mov    %rsp,%rbp
+  801bd9:	41 54                	push   %r12
+  801bdb:	53                   	push   %rbx
+  801bdc:	48 83 ec 10          	sub    $0x10,%rsp
+  801be0:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801be2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801be6:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801bed:	00 00 00 
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	85 c0                	test   %eax,%eax
+  801bf4:	78 3e                	js     801c34 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801bfa:	41 8b 3c 24          	mov    (%r12),%edi
+  801bfe:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c02:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+  801c0e:	85 c0                	test   %eax,%eax
+  801c10:	78 22                	js     801c34 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c12:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c16:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c1a:	48 85 c0             	test   %rax,%rax
+  801c1d:	74 0b                	je     801c2a <seek+0x55>
+  801c1f:	89 de                	mov    %ebx,%esi
+  801c21:	4c 89 e7             	mov    %r12,%rdi
+  801c24:	ff d0                	call   *%rax
+  801c26:	85 c0                	test   %eax,%eax
+  801c28:	78 0a                	js     801c34 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801c2a:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801c2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c34:	48 83 c4 10          	add    $0x10,%rsp
+  801c38:	5b                   	pop    %rbx
+  801c39:	41 5c                	pop    %r12
+  801c3b:	5d                   	pop    %rbp
+  801c3c:	c3                   	ret
+
+0000000000801c3d <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c3d:	55                   	push   %rbp
+  801c3e:	48 89 e5             	mov    %rsp,%rbp
+  801c41:	41 55                	push   %r13
+  801c43:	41 54                	push   %r12
+  801c45:	53                   	push   %rbx
+  801c46:	48 83 ec 18          	sub    $0x18,%rsp
+  801c4a:	89 fb                	mov    %edi,%ebx
+  801c4c:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c4f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c53:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801c5a:	00 00 00 
+  801c5d:	ff d0                	call   *%rax
+  801c5f:	85 c0                	test   %eax,%eax
+  801c61:	78 38                	js     801c9b <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c63:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801c67:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801c6b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c6f:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  801c76:	00 00 00 
+  801c79:	ff d0                	call   *%rax
+  801c7b:	85 c0                	test   %eax,%eax
+  801c7d:	78 1c                	js     801c9b <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c7f:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801c84:	74 20                	je     801ca6 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801c86:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c8a:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801c8e:	48 85 c0             	test   %rax,%rax
+  801c91:	74 47                	je     801cda <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801c93:	44 89 e6             	mov    %r12d,%esi
+  801c96:	4c 89 ef             	mov    %r13,%rdi
+  801c99:	ff d0                	call   *%rax
+}
+  801c9b:	48 83 c4 18          	add    $0x18,%rsp
+  801c9f:	5b                   	pop    %rbx
+  801ca0:	41 5c                	pop    %r12
+  801ca2:	41 5d                	pop    %r13
+  801ca4:	5d                   	pop    %rbp
+  801ca5:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ca6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cad:	00 00 00 
+  801cb0:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801cb6:	89 da                	mov    %ebx,%edx
+  801cb8:	48 bf 90 4e 80 00 00 	movabs $0x804e90,%rdi
+  801cbf:	00 00 00 
+  801cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc7:	48 b9 a5 02 80 00 00 	movabs $0x8002a5,%rcx
+  801cce:	00 00 00 
+  801cd1:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cd3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801cd8:	eb c1                	jmp    801c9b <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cda:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801cdf:	eb ba                	jmp    801c9b <ftruncate+0x5e>
+
+0000000000801ce1 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ce1:	55                   	push   %rbp
+  801ce2:	48 89 e5             	mov    %rsp,%rbp
+  801ce5:	41 54                	push   %r12
+  801ce7:	53                   	push   %rbx
+  801ce8:	48 83 ec 10          	sub    $0x10,%rsp
+  801cec:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cef:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801cf3:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  801cfa:	00 00 00 
+  801cfd:	ff d0                	call   *%rax
+  801cff:	85 c0                	test   %eax,%eax
+  801d01:	78 4e                	js     801d51 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d03:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d07:	41 8b 3c 24          	mov    (%r12),%edi
+  801d0b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d0f:	48 b8 55 17 80 00 00 	movabs $0x801755,%rax
+  801d16:	00 00 00 
+  801d19:	ff d0                	call   *%rax
+  801d1b:	85 c0                	test   %eax,%eax
+  801d1d:	78 32                	js     801d51 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d1f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d23:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d28:	74 30                	je     801d5a <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d2a:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d2d:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d34:	00 00 00 
+    stat->st_isdir = 0;
+  801d37:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d3e:	00 00 00 
+    stat->st_dev = dev;
+  801d41:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d48:	48 89 de             	mov    %rbx,%rsi
+  801d4b:	4c 89 e7             	mov    %r12,%rdi
+  801d4e:	ff 50 28             	call   *0x28(%rax)
+}
+  801d51:	48 83 c4 10          	add    $0x10,%rsp
+  801d55:	5b                   	pop    %rbx
+  801d56:	41 5c                	pop    %r12
+  801d58:	5d                   	pop    %rbp
+  801d59:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d5a:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d5f:	eb f0                	jmp    801d51 <fstat+0x70>
+
+0000000000801d61 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801d61:	55                   	push   %rbp
+  801d62:	48 89 e5             	mov    %rsp,%rbp
+  801d65:	41 54                	push   %r12
+  801d67:	53                   	push   %rbx
+  801d68:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  801d70:	48 b8 cf 2e 80 00 00 	movabs $0x802ecf,%rax
+  801d77:	00 00 00 
+  801d7a:	ff d0                	call   *%rax
+  801d7c:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801d7e:	85 c0                	test   %eax,%eax
+  801d80:	78 25                	js     801da7 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801d82:	4c 89 e6             	mov    %r12,%rsi
+  801d85:	89 c7                	mov    %eax,%edi
+  801d87:	48 b8 e1 1c 80 00 00 	movabs $0x801ce1,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+  801d93:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801d96:	89 df                	mov    %ebx,%edi
+  801d98:	48 b8 6f 18 80 00 00 	movabs $0x80186f,%rax
+  801d9f:	00 00 00 
+  801da2:	ff d0                	call   *%rax
+
+    return res;
+  801da4:	44 89 e3             	mov    %r12d,%ebx
+}
+  801da7:	89 d8                	mov    %ebx,%eax
+  801da9:	5b                   	pop    %rbx
+  801daa:	41 5c                	pop    %r12
+  801dac:	5d                   	pop    %rbp
+  801dad:	c3                   	ret
+
+0000000000801dae <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dae:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801db5:	00 00 00 
+  801db8:	83 38 00             	cmpl   $0x0,(%rax)
+  801dbb:	74 0a                	je     801dc7 <fsenv+0x19>
+    return envid;
+}
+  801dbd:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801dc4:	00 00 
+  801dc6:	c3                   	ret
+fsenv(void) {
+  801dc7:	55                   	push   %rbp
+  801dc8:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dcb:	bf 03 00 00 00       	mov    $0x3,%edi
+  801dd0:	48 b8 3f 48 80 00 00 	movabs $0x80483f,%rax
+  801dd7:	00 00 00 
+  801dda:	ff d0                	call   *%rax
+  801ddc:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801de3:	00 00 
+}
+  801de5:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801dec:	00 00 
+  801dee:	5d                   	pop    %rbp
+  801def:	c3                   	ret
+
+0000000000801df0 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801df0:	55                   	push   %rbp
+  801df1:	48 89 e5             	mov    %rsp,%rbp
+  801df4:	41 54                	push   %r12
+  801df6:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801df7:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801dfc:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e01:	48 89 de             	mov    %rbx,%rsi
+  801e04:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e09:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  801e10:	00 00 00 
+  801e13:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e15:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e1c:	00 00 00 
+  801e1f:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e25:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801e2a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e2f:	48 89 de             	mov    %rbx,%rsi
+  801e32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e37:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  801e3e:	00 00 00 
+  801e41:	ff d0                	call   *%rax
+  801e43:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801e45:	85 c0                	test   %eax,%eax
+  801e47:	0f 88 a2 00 00 00    	js     801eef <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e4d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e54:	00 00 00 
+  801e57:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801e5d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e62:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801e64:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801e69:	49 bc 01 40 80 00 00 	movabs $0x804001,%r12
+  801e70:	00 00 00 
+  801e73:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801e76:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801e7b:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e7e:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  801e85:	00 00 00 
+  801e88:	ff d0                	call   *%rax
+  801e8a:	89 c7                	mov    %eax,%edi
+  801e8c:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801e92:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801e97:	48 89 da             	mov    %rbx,%rdx
+  801e9a:	be 09 00 00 00       	mov    $0x9,%esi
+  801e9f:	48 b8 e9 47 80 00 00 	movabs $0x8047e9,%rax
+  801ea6:	00 00 00 
+  801ea9:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801eab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801eb0:	ba 00 00 00 00       	mov    $0x0,%edx
+  801eb5:	be 00 00 00 00       	mov    $0x0,%esi
+  801eba:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ebf:	48 b8 c5 47 80 00 00 	movabs $0x8047c5,%rax
+  801ec6:	00 00 00 
+  801ec9:	ff d0                	call   *%rax
+  801ecb:	89 c3                	mov    %eax,%ebx
+  801ecd:	85 c0                	test   %eax,%eax
+  801ecf:	78 25                	js     801ef6 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801ed1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ed8:	00 00 00 
+  801edb:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ee1:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801ee8:	00 00 
+    return 0;
+  801eea:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801eef:	89 d8                	mov    %ebx,%eax
+  801ef1:	5b                   	pop    %rbx
+  801ef2:	41 5c                	pop    %r12
+  801ef4:	5d                   	pop    %rbp
+  801ef5:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801ef6:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801efb:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f00:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f05:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  801f0c:	00 00 00 
+  801f0f:	ff d0                	call   *%rax
+        return res;
+  801f11:	eb dc                	jmp    801eef <fschan_setup+0xff>
+
+0000000000801f13 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f13:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f1a:	00 00 00 
+  801f1d:	80 38 00             	cmpb   $0x0,(%rax)
+  801f20:	74 55                	je     801f77 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f22:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f29:	00 00 00 
+  801f2c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801f32:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f37:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801f3e:	00 00 00 
+  801f41:	3b 0a                	cmp    (%rdx),%ecx
+  801f43:	75 01                	jne    801f46 <fschan+0x33>
+}
+  801f45:	c3                   	ret
+fschan(void) {
+  801f46:	55                   	push   %rbp
+  801f47:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f4a:	48 b8 f0 1d 80 00 00 	movabs $0x801df0,%rax
+  801f51:	00 00 00 
+  801f54:	ff d0                	call   *%rax
+  801f56:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801f58:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f5d:	85 d2                	test   %edx,%edx
+  801f5f:	78 02                	js     801f63 <fschan+0x50>
+}
+  801f61:	5d                   	pop    %rbp
+  801f62:	c3                   	ret
+        fschan_enabled = 0;
+  801f63:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f6a:	00 00 00 
+  801f6d:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801f70:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f75:	eb ea                	jmp    801f61 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7c:	c3                   	ret
+
+0000000000801f7d <fbuf>:
+fbuf(struct Fd *fd) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801f81:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  801f88:	00 00 00 
+  801f8b:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801f8d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f92:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801f96:	77 12                	ja     801faa <fbuf+0x2d>
+  801f98:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801f9c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801fa3:	00 00 00 
+  801fa6:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801faa:	48 89 d0             	mov    %rdx,%rax
+  801fad:	5d                   	pop    %rbp
+  801fae:	c3                   	ret
+
+0000000000801faf <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801faf:	55                   	push   %rbp
+  801fb0:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801fb3:	48 83 c7 40          	add    $0x40,%rdi
+  801fb7:	48 b8 3b 40 80 00 00 	movabs $0x80403b,%rax
+  801fbe:	00 00 00 
+  801fc1:	ff d0                	call   *%rax
+  801fc3:	84 c0                	test   %al,%al
+  801fc5:	75 02                	jne    801fc9 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801fc7:	5d                   	pop    %rbp
+  801fc8:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801fc9:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  801fd0:	00 00 00 
+  801fd3:	ff d0                	call   *%rax
+  801fd5:	89 c7                	mov    %eax,%edi
+  801fd7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fdd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801fe2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fe7:	be 0a 00 00 00       	mov    $0xa,%esi
+  801fec:	48 b8 e9 47 80 00 00 	movabs $0x8047e9,%rax
+  801ff3:	00 00 00 
+  801ff6:	ff d0                	call   *%rax
+}
+  801ff8:	eb cd                	jmp    801fc7 <fschan_publish+0x18>
+
+0000000000801ffa <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801ffa:	55                   	push   %rbp
+  801ffb:	48 89 e5             	mov    %rsp,%rbp
+  801ffe:	41 57                	push   %r15
+  802000:	41 56                	push   %r14
+  802002:	41 55                	push   %r13
+  802004:	41 54                	push   %r12
+  802006:	53                   	push   %rbx
+  802007:	48 83 ec 48          	sub    $0x48,%rsp
+  80200b:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80200f:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802013:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802016:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80201a:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80201d:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802024:	00 00 00 
+  802027:	8b 02                	mov    (%rdx),%eax
+  802029:	83 c0 01             	add    $0x1,%eax
+  80202c:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802031:	0f 44 c1             	cmove  %ecx,%eax
+  802034:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802036:	4d 85 c0             	test   %r8,%r8
+  802039:	74 2c                	je     802067 <fschan_rw+0x6d>
+  80203b:	45 89 ce             	mov    %r9d,%r14d
+  80203e:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802045:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802049:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80204f:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802056:	00 
+  802057:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80205d:	b8 01 00 00 00       	mov    $0x1,%eax
+  802062:	e9 41 01 00 00       	jmp    8021a8 <fschan_rw+0x1ae>
+  802067:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80206b:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80206f:	e9 9c 01 00 00       	jmp    802210 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802074:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802078:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80207b:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80207e:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802081:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802085:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802089:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80208d:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802091:	48 89 da             	mov    %rbx,%rdx
+  802094:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8020a0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020a4:	48 b8 af 1f 80 00 00 	movabs $0x801faf,%rax
+  8020ab:	00 00 00 
+  8020ae:	ff d0                	call   *%rax
+            queued += blk;
+  8020b0:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8020b3:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8020b7:	4d 39 fc             	cmp    %r15,%r12
+  8020ba:	73 6b                	jae    802127 <fschan_rw+0x12d>
+  8020bc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8020c0:	77 65                	ja     802127 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8020c2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8020c6:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8020ca:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  8020d1:	00 00 00 
+  8020d4:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8020d6:	4c 89 fb             	mov    %r15,%rbx
+  8020d9:	4c 29 e3             	sub    %r12,%rbx
+  8020dc:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8020e1:	48 39 d3             	cmp    %rdx,%rbx
+  8020e4:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8020e8:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8020ec:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8020f0:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8020f4:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8020f7:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8020f9:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802100:	00 00 00 
+  802103:	8b 09                	mov    (%rcx),%ecx
+  802105:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802108:	83 fe 03             	cmp    $0x3,%esi
+  80210b:	0f 85 63 ff ff ff    	jne    802074 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802111:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802115:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802118:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80211b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80211e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802122:	e9 79 ff ff ff       	jmp    8020a0 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80212b:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802132:	48 89 df             	mov    %rbx,%rdi
+  802135:	48 b8 d9 40 80 00 00 	movabs $0x8040d9,%rax
+  80213c:	00 00 00 
+  80213f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802141:	48 89 df             	mov    %rbx,%rdi
+  802144:	48 b8 67 40 80 00 00 	movabs $0x804067,%rax
+  80214b:	00 00 00 
+  80214e:	ff d0                	call   *%rax
+  802150:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802154:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802158:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80215c:	75 25                	jne    802183 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80215e:	8b 40 04             	mov    0x4(%rax),%eax
+  802161:	85 c0                	test   %eax,%eax
+  802163:	0f 88 86 00 00 00    	js     8021ef <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802169:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80216d:	74 5b                	je     8021ca <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80216f:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802173:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802177:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80217b:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80217f:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802183:	48 89 df             	mov    %rbx,%rdi
+  802186:	48 b8 8e 40 80 00 00 	movabs $0x80408e,%rax
+  80218d:	00 00 00 
+  802190:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802192:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802196:	83 f0 01             	xor    $0x1,%eax
+  802199:	4d 39 fc             	cmp    %r15,%r12
+  80219c:	0f 92 c2             	setb   %dl
+  80219f:	84 c2                	test   %al,%dl
+  8021a1:	75 05                	jne    8021a8 <fschan_rw+0x1ae>
+  8021a3:	45 85 ed             	test   %r13d,%r13d
+  8021a6:	74 50                	je     8021f8 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021a8:	4d 39 fc             	cmp    %r15,%r12
+  8021ab:	0f 92 c1             	setb   %cl
+  8021ae:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8021b2:	0f 96 c2             	setbe  %dl
+  8021b5:	84 d1                	test   %dl,%cl
+  8021b7:	0f 84 6a ff ff ff    	je     802127 <fschan_rw+0x12d>
+  8021bd:	84 c0                	test   %al,%al
+  8021bf:	0f 85 fd fe ff ff    	jne    8020c2 <fschan_rw+0xc8>
+  8021c5:	e9 5d ff ff ff       	jmp    802127 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021ca:	48 63 d0             	movslq %eax,%rdx
+  8021cd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8021d1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8021d5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8021d9:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8021dd:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8021e1:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  8021e8:	00 00 00 
+  8021eb:	ff d0                	call   *%rax
+  8021ed:	eb 80                	jmp    80216f <fschan_rw+0x175>
+                err = msg->fm_res;
+  8021ef:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8021f2:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8021f6:	eb 8b                	jmp    802183 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8021f8:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8021fd:	0f 85 68 fe ff ff    	jne    80206b <fschan_rw+0x71>
+  802203:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802206:	85 c0                	test   %eax,%eax
+  802208:	0f 84 5d fe ff ff    	je     80206b <fschan_rw+0x71>
+  80220e:	48 98                	cltq
+}
+  802210:	48 83 c4 48          	add    $0x48,%rsp
+  802214:	5b                   	pop    %rbx
+  802215:	41 5c                	pop    %r12
+  802217:	41 5d                	pop    %r13
+  802219:	41 5e                	pop    %r14
+  80221b:	41 5f                	pop    %r15
+  80221d:	5d                   	pop    %rbp
+  80221e:	c3                   	ret
+
+000000000080221f <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80221f:	55                   	push   %rbp
+  802220:	48 89 e5             	mov    %rsp,%rbp
+  802223:	41 56                	push   %r14
+  802225:	41 55                	push   %r13
+  802227:	41 54                	push   %r12
+  802229:	53                   	push   %rbx
+  80222a:	48 83 ec 10          	sub    $0x10,%rsp
+  80222e:	49 89 fe             	mov    %rdi,%r14
+  802231:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802234:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802238:	48 29 f3             	sub    %rsi,%rbx
+  80223b:	48 39 d3             	cmp    %rdx,%rbx
+  80223e:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802242:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802249:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80224a:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80224f:	49 bd 98 3e 80 00 00 	movabs $0x803e98,%r13
+  802256:	00 00 00 
+  802259:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802260:	76 1e                	jbe    802280 <mmap_fault+0x61>
+  802262:	4c 01 e7             	add    %r12,%rdi
+  802265:	41 ff d5             	call   *%r13
+  802268:	84 c0                	test   %al,%al
+  80226a:	75 14                	jne    802280 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80226c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802270:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802277:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80227b:	48 39 df             	cmp    %rbx,%rdi
+  80227e:	72 e2                	jb     802262 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802280:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802287:	00 00 00 
+  80228a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802291:	00 00 00 
+  802294:	4c 89 f0             	mov    %r14,%rax
+  802297:	48 29 d0             	sub    %rdx,%rax
+  80229a:	48 c1 f8 03          	sar    $0x3,%rax
+  80229e:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8022a5:	aa aa aa 
+  8022a8:	48 0f af c2          	imul   %rdx,%rax
+  8022ac:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022b0:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8022b5:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8022b9:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8022bb:	44 89 e0             	mov    %r12d,%eax
+  8022be:	41 03 46 10          	add    0x10(%r14),%eax
+  8022c2:	41 2b 06             	sub    (%r14),%eax
+  8022c5:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8022c8:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022cc:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8022d0:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8022d4:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8022d7:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  8022de:	00 00 00 
+  8022e1:	ff d0                	call   *%rax
+  8022e3:	89 c7                	mov    %eax,%edi
+  8022e5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022eb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8022f0:	48 89 da             	mov    %rbx,%rdx
+  8022f3:	be 0f 00 00 00       	mov    $0xf,%esi
+  8022f8:	48 b8 e9 47 80 00 00 	movabs $0x8047e9,%rax
+  8022ff:	00 00 00 
+  802302:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802304:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802309:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80230d:	4c 89 e6             	mov    %r12,%rsi
+  802310:	bf 00 00 00 00       	mov    $0x0,%edi
+  802315:	48 b8 c5 47 80 00 00 	movabs $0x8047c5,%rax
+  80231c:	00 00 00 
+  80231f:	ff d0                	call   *%rax
+  802321:	48 98                	cltq
+}
+  802323:	48 83 c4 10          	add    $0x10,%rsp
+  802327:	5b                   	pop    %rbx
+  802328:	41 5c                	pop    %r12
+  80232a:	41 5d                	pop    %r13
+  80232c:	41 5e                	pop    %r14
+  80232e:	5d                   	pop    %rbp
+  80232f:	c3                   	ret
+
+0000000000802330 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802330:	48 8b 37             	mov    (%rdi),%rsi
+  802333:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80233a:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802341:	00 00 00 
+  802344:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802349:	eb 0f                	jmp    80235a <mmap_pgfault+0x2a>
+  80234b:	c3                   	ret
+  80234c:	48 83 c1 01          	add    $0x1,%rcx
+  802350:	48 83 c2 18          	add    $0x18,%rdx
+  802354:	48 83 f9 20          	cmp    $0x20,%rcx
+  802358:	74 6e                	je     8023c8 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80235a:	48 8b 02             	mov    (%rdx),%rax
+  80235d:	48 83 e8 01          	sub    $0x1,%rax
+  802361:	48 39 f0             	cmp    %rsi,%rax
+  802364:	73 e6                	jae    80234c <mmap_pgfault+0x1c>
+  802366:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80236a:	73 e0                	jae    80234c <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80236c:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802370:	b8 00 00 00 00       	mov    $0x0,%eax
+  802375:	f6 c2 01             	test   $0x1,%dl
+  802378:	75 d1                	jne    80234b <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80237a:	f6 c2 02             	test   $0x2,%dl
+  80237d:	74 1a                	je     802399 <mmap_pgfault+0x69>
+  80237f:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802383:	b8 00 00 00 00       	mov    $0x0,%eax
+  802388:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80238f:	00 00 00 
+  802392:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802397:	74 35                	je     8023ce <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802399:	55                   	push   %rbp
+  80239a:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80239d:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023a1:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023a8:	00 00 00 
+  8023ab:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8023af:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8023b4:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  8023bb:	00 00 00 
+  8023be:	ff d0                	call   *%rax
+  8023c0:	48 85 c0             	test   %rax,%rax
+  8023c3:	0f 9f c0             	setg   %al
+}
+  8023c6:	5d                   	pop    %rbp
+  8023c7:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023cd:	c3                   	ret
+}
+  8023ce:	c3                   	ret
+
+00000000008023cf <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8023cf:	55                   	push   %rbp
+  8023d0:	48 89 e5             	mov    %rsp,%rbp
+  8023d3:	41 54                	push   %r12
+  8023d5:	53                   	push   %rbx
+  8023d6:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023d9:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023e0:	00 00 00 
+  8023e3:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8023e8:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8023ec:	74 15                	je     802403 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8023ee:	48 83 c3 01          	add    $0x1,%rbx
+  8023f2:	48 83 c0 18          	add    $0x18,%rax
+  8023f6:	48 83 fb 20          	cmp    $0x20,%rbx
+  8023fa:	75 ec                	jne    8023e8 <mmap_alloc+0x19>
+    return NULL;
+  8023fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802401:	eb 52                	jmp    802455 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802403:	4c 89 e7             	mov    %r12,%rdi
+  802406:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  80240d:	00 00 00 
+  802410:	ff d0                	call   *%rax
+  802412:	41 89 c1             	mov    %eax,%r9d
+  802415:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80241c:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802420:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802426:	ba 00 00 00 00       	mov    $0x0,%edx
+  80242b:	4c 89 e6             	mov    %r12,%rsi
+  80242e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802433:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+  80243f:	85 c0                	test   %eax,%eax
+  802441:	78 17                	js     80245a <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802443:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802447:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80244e:	00 00 00 
+  802451:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802455:	5b                   	pop    %rbx
+  802456:	41 5c                	pop    %r12
+  802458:	5d                   	pop    %rbp
+  802459:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80245a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80245f:	eb f4                	jmp    802455 <mmap_alloc+0x86>
+
+0000000000802461 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802461:	55                   	push   %rbp
+  802462:	48 89 e5             	mov    %rsp,%rbp
+  802465:	41 56                	push   %r14
+  802467:	41 55                	push   %r13
+  802469:	41 54                	push   %r12
+  80246b:	53                   	push   %rbx
+  80246c:	48 83 ec 10          	sub    $0x10,%rsp
+  802470:	41 89 fc             	mov    %edi,%r12d
+  802473:	49 89 f5             	mov    %rsi,%r13
+  802476:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802479:	48 89 f0             	mov    %rsi,%rax
+  80247c:	48 09 d0             	or     %rdx,%rax
+  80247f:	75 0d                	jne    80248e <fsipc+0x2d>
+  802481:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802484:	83 f8 04             	cmp    $0x4,%eax
+  802487:	76 7d                	jbe    802506 <fsipc+0xa5>
+  802489:	83 ff 0d             	cmp    $0xd,%edi
+  80248c:	74 78                	je     802506 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80248e:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  802495:	00 00 00 
+  802498:	ff d0                	call   *%rax
+  80249a:	89 c7                	mov    %eax,%edi
+  80249c:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8024a3:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8024aa:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8024b1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024b7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8024be:	00 00 00 
+  8024c1:	44 89 e6             	mov    %r12d,%esi
+  8024c4:	48 b8 e9 47 80 00 00 	movabs $0x8047e9,%rax
+  8024cb:	00 00 00 
+  8024ce:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8024d0:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024d7:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8024d8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024dd:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8024e1:	4c 89 ee             	mov    %r13,%rsi
+  8024e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024e9:	48 b8 c5 47 80 00 00 	movabs $0x8047c5,%rax
+  8024f0:	00 00 00 
+  8024f3:	ff d0                	call   *%rax
+  8024f5:	89 c3                	mov    %eax,%ebx
+}
+  8024f7:	89 d8                	mov    %ebx,%eax
+  8024f9:	48 83 c4 10          	add    $0x10,%rsp
+  8024fd:	5b                   	pop    %rbx
+  8024fe:	41 5c                	pop    %r12
+  802500:	41 5d                	pop    %r13
+  802502:	41 5e                	pop    %r14
+  802504:	5d                   	pop    %rbp
+  802505:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802506:	48 b8 13 1f 80 00 00 	movabs $0x801f13,%rax
+  80250d:	00 00 00 
+  802510:	ff d0                	call   *%rax
+  802512:	49 89 c6             	mov    %rax,%r14
+  802515:	48 85 c0             	test   %rax,%rax
+  802518:	0f 84 70 ff ff ff    	je     80248e <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80251e:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802522:	48 b8 16 40 80 00 00 	movabs $0x804016,%rax
+  802529:	00 00 00 
+  80252c:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80252e:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802531:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802538:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80253c:	ba 10 00 00 00       	mov    $0x10,%edx
+  802541:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802548:	00 00 00 
+  80254b:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  802552:	00 00 00 
+  802555:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802557:	4c 89 f7             	mov    %r14,%rdi
+  80255a:	48 b8 af 1f 80 00 00 	movabs $0x801faf,%rax
+  802561:	00 00 00 
+  802564:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802566:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80256d:	4c 89 f7             	mov    %r14,%rdi
+  802570:	48 b8 d9 40 80 00 00 	movabs $0x8040d9,%rax
+  802577:	00 00 00 
+  80257a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80257c:	4c 89 f7             	mov    %r14,%rdi
+  80257f:	48 b8 67 40 80 00 00 	movabs $0x804067,%rax
+  802586:	00 00 00 
+  802589:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80258b:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80258e:	41 83 fc 05          	cmp    $0x5,%r12d
+  802592:	75 04                	jne    802598 <fsipc+0x137>
+  802594:	85 db                	test   %ebx,%ebx
+  802596:	79 14                	jns    8025ac <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802598:	4c 89 f7             	mov    %r14,%rdi
+  80259b:	48 b8 8e 40 80 00 00 	movabs $0x80408e,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8025a7:	e9 4b ff ff ff       	jmp    8024f7 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8025ac:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025b0:	ba 88 00 00 00       	mov    $0x88,%edx
+  8025b5:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8025bc:	00 00 00 
+  8025bf:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  8025c6:	00 00 00 
+  8025c9:	ff d0                	call   *%rax
+  8025cb:	eb cb                	jmp    802598 <fsipc+0x137>
+
+00000000008025cd <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8025cd:	55                   	push   %rbp
+  8025ce:	48 89 e5             	mov    %rsp,%rbp
+  8025d1:	41 57                	push   %r15
+  8025d3:	41 56                	push   %r14
+  8025d5:	41 55                	push   %r13
+  8025d7:	41 54                	push   %r12
+  8025d9:	53                   	push   %rbx
+  8025da:	48 83 ec 18          	sub    $0x18,%rsp
+  8025de:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8025e2:	49 89 f6             	mov    %rsi,%r14
+  8025e5:	49 89 d4             	mov    %rdx,%r12
+  8025e8:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8025eb:	48 b8 13 1f 80 00 00 	movabs $0x801f13,%rax
+  8025f2:	00 00 00 
+  8025f5:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8025f7:	48 85 c0             	test   %rax,%rax
+  8025fa:	0f 85 96 00 00 00    	jne    802696 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802600:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802607:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802608:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80260f:	00 00 00 
+    while (n) {
+  802612:	4d 85 e4             	test   %r12,%r12
+  802615:	74 79                	je     802690 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802617:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80261c:	49 39 dc             	cmp    %rbx,%r12
+  80261f:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802623:	48 89 da             	mov    %rbx,%rdx
+  802626:	4c 89 f6             	mov    %r14,%rsi
+  802629:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802630:	00 00 00 
+  802633:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  80263a:	00 00 00 
+  80263d:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80263f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802643:	8b 40 0c             	mov    0xc(%rax),%eax
+  802646:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802649:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80264c:	44 01 e8             	add    %r13d,%eax
+  80264f:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802653:	41 0f 44 c5          	cmove  %r13d,%eax
+  802657:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80265b:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80265f:	48 89 da             	mov    %rbx,%rdx
+  802662:	be 00 00 00 00       	mov    $0x0,%esi
+  802667:	bf 04 00 00 00       	mov    $0x4,%edi
+  80266c:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  802673:	00 00 00 
+  802676:	ff d0                	call   *%rax
+        if (res < 0)
+  802678:	85 c0                	test   %eax,%eax
+  80267a:	78 4a                	js     8026c6 <devfile_write_direct+0xf9>
+        buf += res;
+  80267c:	48 98                	cltq
+  80267e:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802681:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802685:	49 29 c4             	sub    %rax,%r12
+  802688:	75 8d                	jne    802617 <devfile_write_direct+0x4a>
+    return write;
+  80268a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80268e:	eb 27                	jmp    8026b7 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802690:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802694:	eb f4                	jmp    80268a <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802696:	45 89 e9             	mov    %r13d,%r9d
+  802699:	4d 89 e0             	mov    %r12,%r8
+  80269c:	4c 89 f1             	mov    %r14,%rcx
+  80269f:	ba 04 00 00 00       	mov    $0x4,%edx
+  8026a4:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026a8:	48 89 c7             	mov    %rax,%rdi
+  8026ab:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+}
+  8026b7:	48 83 c4 18          	add    $0x18,%rsp
+  8026bb:	5b                   	pop    %rbx
+  8026bc:	41 5c                	pop    %r12
+  8026be:	41 5d                	pop    %r13
+  8026c0:	41 5e                	pop    %r14
+  8026c2:	41 5f                	pop    %r15
+  8026c4:	5d                   	pop    %rbp
+  8026c5:	c3                   	ret
+            return res;
+  8026c6:	48 98                	cltq
+  8026c8:	eb ed                	jmp    8026b7 <devfile_write_direct+0xea>
+
+00000000008026ca <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8026ca:	55                   	push   %rbp
+  8026cb:	48 89 e5             	mov    %rsp,%rbp
+  8026ce:	41 54                	push   %r12
+  8026d0:	53                   	push   %rbx
+  8026d1:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8026d4:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  8026db:	00 00 00 
+  8026de:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8026e0:	48 85 c0             	test   %rax,%rax
+  8026e3:	74 71                	je     802756 <fbuf_flush+0x8c>
+  8026e5:	48 89 c3             	mov    %rax,%rbx
+  8026e8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026ed:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8026f1:	75 05                	jne    8026f8 <fbuf_flush+0x2e>
+}
+  8026f3:	5b                   	pop    %rbx
+  8026f4:	41 5c                	pop    %r12
+  8026f6:	5d                   	pop    %rbp
+  8026f7:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8026f8:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8026fb:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8026ff:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802706:	00 00 00 
+  802709:	48 89 de             	mov    %rbx,%rsi
+  80270c:	48 29 c6             	sub    %rax,%rsi
+  80270f:	48 c1 fe 03          	sar    $0x3,%rsi
+  802713:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80271a:	aa aa aa 
+  80271d:	48 0f af f0          	imul   %rax,%rsi
+  802721:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802725:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80272a:	48 01 c6             	add    %rax,%rsi
+  80272d:	4c 89 e7             	mov    %r12,%rdi
+  802730:	48 b8 cd 25 80 00 00 	movabs $0x8025cd,%rax
+  802737:	00 00 00 
+  80273a:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80273c:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802740:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802747:	00 
+    return res < 0 ? res : 0;
+  802748:	48 85 c0             	test   %rax,%rax
+  80274b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802750:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802754:	eb 9d                	jmp    8026f3 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802756:	b8 00 00 00 00       	mov    $0x0,%eax
+  80275b:	eb 96                	jmp    8026f3 <fbuf_flush+0x29>
+
+000000000080275d <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80275d:	55                   	push   %rbp
+  80275e:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802761:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+}
+  80276d:	5d                   	pop    %rbp
+  80276e:	c3                   	ret
+
+000000000080276f <devfile_write>:
+    if (!fd || !buf)
+  80276f:	48 85 ff             	test   %rdi,%rdi
+  802772:	0f 84 d3 01 00 00    	je     80294b <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802778:	55                   	push   %rbp
+  802779:	48 89 e5             	mov    %rsp,%rbp
+  80277c:	41 57                	push   %r15
+  80277e:	41 56                	push   %r14
+  802780:	41 55                	push   %r13
+  802782:	41 54                	push   %r12
+  802784:	53                   	push   %rbx
+  802785:	48 83 ec 08          	sub    $0x8,%rsp
+  802789:	49 89 fc             	mov    %rdi,%r12
+  80278c:	49 89 f6             	mov    %rsi,%r14
+  80278f:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802792:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802797:	48 85 f6             	test   %rsi,%rsi
+  80279a:	0f 84 9c 01 00 00    	je     80293c <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8027a0:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  8027a7:	00 00 00 
+  8027aa:	ff d0                	call   *%rax
+  8027ac:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8027af:	48 85 c0             	test   %rax,%rax
+  8027b2:	0f 84 a2 00 00 00    	je     80285a <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8027b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8027bd:	4c 89 e7             	mov    %r12,%rdi
+  8027c0:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  8027c7:	00 00 00 
+  8027ca:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8027cc:	83 f8 02             	cmp    $0x2,%eax
+  8027cf:	0f 8f 85 00 00 00    	jg     80285a <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8027d5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8027dc:	00 00 00 
+  8027df:	4d 89 ef             	mov    %r13,%r15
+  8027e2:	49 29 c7             	sub    %rax,%r15
+  8027e5:	49 c1 ff 03          	sar    $0x3,%r15
+  8027e9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027f0:	aa aa aa 
+  8027f3:	4c 0f af f8          	imul   %rax,%r15
+  8027f7:	49 c1 e7 0e          	shl    $0xe,%r15
+  8027fb:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802800:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802803:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802808:	0f 84 d7 00 00 00    	je     8028e5 <devfile_write+0x176>
+  80280e:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802812:	89 c2                	mov    %eax,%edx
+  802814:	41 03 55 0c          	add    0xc(%r13),%edx
+  802818:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80281d:	75 0f                	jne    80282e <devfile_write+0xbf>
+  80281f:	48 01 d8             	add    %rbx,%rax
+  802822:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802828:	0f 86 92 00 00 00    	jbe    8028c0 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80282e:	4c 89 e7             	mov    %r12,%rdi
+  802831:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	85 c0                	test   %eax,%eax
+  80283f:	78 52                	js     802893 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802841:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802848:	77 7f                	ja     8028c9 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80284a:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80284f:	0f 85 c2 00 00 00    	jne    802917 <devfile_write+0x1a8>
+  802855:	e9 94 00 00 00       	jmp    8028ee <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80285a:	4c 89 e7             	mov    %r12,%rdi
+  80285d:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802869:	85 c0                	test   %eax,%eax
+  80286b:	79 07                	jns    802874 <devfile_write+0x105>
+  80286d:	48 98                	cltq
+  80286f:	e9 c8 00 00 00       	jmp    80293c <devfile_write+0x1cd>
+  802874:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802879:	48 89 da             	mov    %rbx,%rdx
+  80287c:	4c 89 f6             	mov    %r14,%rsi
+  80287f:	4c 89 e7             	mov    %r12,%rdi
+  802882:	48 b8 cd 25 80 00 00 	movabs $0x8025cd,%rax
+  802889:	00 00 00 
+  80288c:	ff d0                	call   *%rax
+  80288e:	e9 a9 00 00 00       	jmp    80293c <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802893:	48 98                	cltq
+  802895:	e9 a2 00 00 00       	jmp    80293c <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80289a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80289f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8028a4:	4c 89 fe             	mov    %r15,%rsi
+  8028a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028ac:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  8028b3:	00 00 00 
+  8028b6:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8028b8:	85 c0                	test   %eax,%eax
+  8028ba:	79 45                	jns    802901 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028bc:	48 98                	cltq
+  8028be:	eb 7c                	jmp    80293c <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028c0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028c7:	76 4e                	jbe    802917 <devfile_write+0x1a8>
+  8028c9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028ce:	48 89 da             	mov    %rbx,%rdx
+  8028d1:	4c 89 f6             	mov    %r14,%rsi
+  8028d4:	4c 89 e7             	mov    %r12,%rdi
+  8028d7:	48 b8 cd 25 80 00 00 	movabs $0x8025cd,%rax
+  8028de:	00 00 00 
+  8028e1:	ff d0                	call   *%rax
+  8028e3:	eb 57                	jmp    80293c <devfile_write+0x1cd>
+  8028e5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028ec:	77 db                	ja     8028c9 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8028ee:	4c 89 ff             	mov    %r15,%rdi
+  8028f1:	48 b8 98 3e 80 00 00 	movabs $0x803e98,%rax
+  8028f8:	00 00 00 
+  8028fb:	ff d0                	call   *%rax
+  8028fd:	84 c0                	test   %al,%al
+  8028ff:	74 99                	je     80289a <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802901:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802906:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80290b:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80290f:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802916:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802917:	4c 89 ff             	mov    %r15,%rdi
+  80291a:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80291e:	48 89 da             	mov    %rbx,%rdx
+  802921:	4c 89 f6             	mov    %r14,%rsi
+  802924:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  80292b:	00 00 00 
+  80292e:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802930:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802934:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802939:	48 89 d8             	mov    %rbx,%rax
+}
+  80293c:	48 83 c4 08          	add    $0x8,%rsp
+  802940:	5b                   	pop    %rbx
+  802941:	41 5c                	pop    %r12
+  802943:	41 5d                	pop    %r13
+  802945:	41 5e                	pop    %r14
+  802947:	41 5f                	pop    %r15
+  802949:	5d                   	pop    %rbp
+  80294a:	c3                   	ret
+        return E_INVAL;
+  80294b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802950:	c3                   	ret
+
+0000000000802951 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802951:	55                   	push   %rbp
+  802952:	48 89 e5             	mov    %rsp,%rbp
+  802955:	41 54                	push   %r12
+  802957:	53                   	push   %rbx
+  802958:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80295b:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802962:	00 00 00 
+  802965:	ff d0                	call   *%rax
+  802967:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80296a:	48 89 df             	mov    %rbx,%rdi
+  80296d:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802974:	00 00 00 
+  802977:	ff d0                	call   *%rax
+  802979:	48 85 c0             	test   %rax,%rax
+  80297c:	74 17                	je     802995 <devfile_flush+0x44>
+  80297e:	48 89 df             	mov    %rbx,%rdi
+  802981:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802988:	00 00 00 
+  80298b:	ff d0                	call   *%rax
+  80298d:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802994:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802995:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802998:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80299f:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8029a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ab:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029b0:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8029bc:	45 85 e4             	test   %r12d,%r12d
+  8029bf:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8029c3:	5b                   	pop    %rbx
+  8029c4:	41 5c                	pop    %r12
+  8029c6:	5d                   	pop    %rbp
+  8029c7:	c3                   	ret
+
+00000000008029c8 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8029c8:	55                   	push   %rbp
+  8029c9:	48 89 e5             	mov    %rsp,%rbp
+  8029cc:	41 57                	push   %r15
+  8029ce:	41 56                	push   %r14
+  8029d0:	41 55                	push   %r13
+  8029d2:	41 54                	push   %r12
+  8029d4:	53                   	push   %rbx
+  8029d5:	48 83 ec 38          	sub    $0x38,%rsp
+  8029d9:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8029dd:	49 89 f7             	mov    %rsi,%r15
+  8029e0:	48 89 d3             	mov    %rdx,%rbx
+  8029e3:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8029e6:	48 b8 13 1f 80 00 00 	movabs $0x801f13,%rax
+  8029ed:	00 00 00 
+  8029f0:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8029f2:	48 85 c0             	test   %rax,%rax
+  8029f5:	75 20                	jne    802a17 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8029f7:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8029fc:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a03:	00 
+    while (n) {
+  802a04:	48 85 db             	test   %rbx,%rbx
+  802a07:	0f 85 df 00 00 00    	jne    802aec <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a0d:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a11:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a15:	eb 21                	jmp    802a38 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a17:	45 89 f1             	mov    %r14d,%r9d
+  802a1a:	49 89 d8             	mov    %rbx,%r8
+  802a1d:	4c 89 f9             	mov    %r15,%rcx
+  802a20:	ba 03 00 00 00       	mov    $0x3,%edx
+  802a25:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a29:	48 89 c7             	mov    %rax,%rdi
+  802a2c:	48 b8 fa 1f 80 00 00 	movabs $0x801ffa,%rax
+  802a33:	00 00 00 
+  802a36:	ff d0                	call   *%rax
+}
+  802a38:	48 83 c4 38          	add    $0x38,%rsp
+  802a3c:	5b                   	pop    %rbx
+  802a3d:	41 5c                	pop    %r12
+  802a3f:	41 5d                	pop    %r13
+  802a41:	41 5e                	pop    %r14
+  802a43:	41 5f                	pop    %r15
+  802a45:	5d                   	pop    %rbp
+  802a46:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a47:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a4b:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a51:	75 1e                	jne    802a71 <devfile_read_direct+0xa9>
+  802a53:	e9 e2 00 00 00       	jmp    802b3a <devfile_read_direct+0x172>
+            if (!res) return read;
+  802a58:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a5c:	eb da                	jmp    802a38 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802a5e:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802a62:	0f 85 d0 01 00 00    	jne    802c38 <devfile_read_direct+0x270>
+            map = 0;
+  802a68:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a6c:	eb 03                	jmp    802a71 <devfile_read_direct+0xa9>
+  802a6e:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a71:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802a76:	48 39 d3             	cmp    %rdx,%rbx
+  802a79:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802a7d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a81:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a84:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802a8b:	00 00 00 
+  802a8e:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802a90:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802a94:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802a98:	be 00 00 00 00       	mov    $0x0,%esi
+  802a9d:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aa2:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  802aa9:	00 00 00 
+  802aac:	ff d0                	call   *%rax
+        if (res <= 0)
+  802aae:	85 c0                	test   %eax,%eax
+  802ab0:	0f 8e 63 01 00 00    	jle    802c19 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ab6:	4c 63 e0             	movslq %eax,%r12
+  802ab9:	4c 89 e2             	mov    %r12,%rdx
+  802abc:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802ac3:	00 00 00 
+  802ac6:	4c 89 ff             	mov    %r15,%rdi
+  802ac9:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+        buf += res;
+  802ad5:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802ad8:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802adb:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802adf:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802ae3:	48 85 db             	test   %rbx,%rbx
+  802ae6:	0f 84 25 ff ff ff    	je     802a11 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802aec:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802aef:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802af3:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802af7:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802afb:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b02:	0f 97 c2             	seta   %dl
+  802b05:	20 c2                	and    %al,%dl
+  802b07:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b0a:	0f 84 5e ff ff ff    	je     802a6e <devfile_read_direct+0xa6>
+  802b10:	4c 89 fa             	mov    %r15,%rdx
+  802b13:	4d 89 fd             	mov    %r15,%r13
+  802b16:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802b1d:	0f 85 4e ff ff ff    	jne    802a71 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802b23:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b27:	0f 84 1a ff ff ff    	je     802a47 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b2d:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b34:	0f 85 37 ff ff ff    	jne    802a71 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802b3a:	48 89 d8             	mov    %rbx,%rax
+  802b3d:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b43:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b48:	48 39 c8             	cmp    %rcx,%rax
+  802b4b:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b4f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802b53:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802b57:	49 89 d4             	mov    %rdx,%r12
+  802b5a:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802b5e:	48 b8 39 3e 80 00 00 	movabs $0x803e39,%rax
+  802b65:	00 00 00 
+  802b68:	ff d0                	call   *%rax
+  802b6a:	a8 40                	test   $0x40,%al
+  802b6c:	0f 85 b9 00 00 00    	jne    802c2b <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802b72:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802b79:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802b7d:	49 39 c5             	cmp    %rax,%r13
+  802b80:	72 d8                	jb     802b5a <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b82:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802b86:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802b8d:	00 00 00 
+  802b90:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b94:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802b97:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802b99:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802b9d:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802ba1:	48 b8 ae 1d 80 00 00 	movabs $0x801dae,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+  802bad:	89 c7                	mov    %eax,%edi
+  802baf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802bb5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802bba:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802bc1:	00 00 00 
+  802bc4:	be 0e 00 00 00       	mov    $0xe,%esi
+  802bc9:	48 b8 e9 47 80 00 00 	movabs $0x8047e9,%rax
+  802bd0:	00 00 00 
+  802bd3:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802bd5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802bda:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802bde:	4c 89 fe             	mov    %r15,%rsi
+  802be1:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be6:	48 b8 c5 47 80 00 00 	movabs $0x8047c5,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+  802bf2:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802bf5:	48 85 d2             	test   %rdx,%rdx
+  802bf8:	0f 84 5a fe ff ff    	je     802a58 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802bfe:	0f 8e 5a fe ff ff    	jle    802a5e <devfile_read_direct+0x96>
+                buf += res;
+  802c04:	48 98                	cltq
+  802c06:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c09:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c0c:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c10:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c14:	e9 ca fe ff ff       	jmp    802ae3 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c19:	41 89 c5             	mov    %eax,%r13d
+  802c1c:	48 98                	cltq
+  802c1e:	45 85 ed             	test   %r13d,%r13d
+  802c21:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802c26:	e9 0d fe ff ff       	jmp    802a38 <devfile_read_direct+0x70>
+            map = 0;
+  802c2b:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c2f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c33:	e9 39 fe ff ff       	jmp    802a71 <devfile_read_direct+0xa9>
+  802c38:	48 89 d0             	mov    %rdx,%rax
+  802c3b:	e9 f8 fd ff ff       	jmp    802a38 <devfile_read_direct+0x70>
+
+0000000000802c40 <devfile_read>:
+    if (!fd || !buf)
+  802c40:	48 85 ff             	test   %rdi,%rdi
+  802c43:	0f 84 21 02 00 00    	je     802e6a <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c49:	55                   	push   %rbp
+  802c4a:	48 89 e5             	mov    %rsp,%rbp
+  802c4d:	41 57                	push   %r15
+  802c4f:	41 56                	push   %r14
+  802c51:	41 55                	push   %r13
+  802c53:	41 54                	push   %r12
+  802c55:	53                   	push   %rbx
+  802c56:	48 83 ec 28          	sub    $0x28,%rsp
+  802c5a:	48 89 fb             	mov    %rdi,%rbx
+  802c5d:	49 89 f4             	mov    %rsi,%r12
+  802c60:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802c63:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802c68:	48 85 f6             	test   %rsi,%rsi
+  802c6b:	74 4b                	je     802cb8 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802c6d:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802c74:	00 00 00 
+  802c77:	ff d0                	call   *%rax
+  802c79:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c7c:	48 85 c0             	test   %rax,%rax
+  802c7f:	74 22                	je     802ca3 <devfile_read+0x63>
+  802c81:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802c88:	77 19                	ja     802ca3 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802c8a:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c8f:	48 89 df             	mov    %rbx,%rdi
+  802c92:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802c9e:	83 f8 02             	cmp    $0x2,%eax
+  802ca1:	7e 40                	jle    802ce3 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ca3:	48 89 df             	mov    %rbx,%rdi
+  802ca6:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802cad:	00 00 00 
+  802cb0:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cb2:	85 c0                	test   %eax,%eax
+  802cb4:	79 11                	jns    802cc7 <devfile_read+0x87>
+  802cb6:	48 98                	cltq
+}
+  802cb8:	48 83 c4 28          	add    $0x28,%rsp
+  802cbc:	5b                   	pop    %rbx
+  802cbd:	41 5c                	pop    %r12
+  802cbf:	41 5d                	pop    %r13
+  802cc1:	41 5e                	pop    %r14
+  802cc3:	41 5f                	pop    %r15
+  802cc5:	5d                   	pop    %rbp
+  802cc6:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cc7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ccc:	4c 89 ea             	mov    %r13,%rdx
+  802ccf:	4c 89 e6             	mov    %r12,%rsi
+  802cd2:	48 89 df             	mov    %rbx,%rdi
+  802cd5:	48 b8 c8 29 80 00 00 	movabs $0x8029c8,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	eb d5                	jmp    802cb8 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802ce3:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ce7:	48 89 df             	mov    %rbx,%rdi
+  802cea:	48 b8 ca 26 80 00 00 	movabs $0x8026ca,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+  802cf6:	85 c0                	test   %eax,%eax
+  802cf8:	0f 88 33 01 00 00    	js     802e31 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802cfe:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d05:	00 00 00 
+  802d08:	4c 89 f0             	mov    %r14,%rax
+  802d0b:	48 29 d0             	sub    %rdx,%rax
+  802d0e:	48 c1 f8 03          	sar    $0x3,%rax
+  802d12:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d19:	aa aa aa 
+  802d1c:	48 0f af c2          	imul   %rdx,%rax
+  802d20:	48 c1 e0 0e          	shl    $0xe,%rax
+  802d24:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d28:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d2b:	41 39 06             	cmp    %eax,(%r14)
+  802d2e:	75 0d                	jne    802d3d <devfile_read+0xfd>
+  802d30:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d33:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802d37:	0f 84 fb 00 00 00    	je     802e38 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802d3d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d42:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d46:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d49:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d4d:	48 89 c7             	mov    %rax,%rdi
+  802d50:	48 b8 98 3e 80 00 00 	movabs $0x803e98,%rax
+  802d57:	00 00 00 
+  802d5a:	ff d0                	call   *%rax
+  802d5c:	84 c0                	test   %al,%al
+  802d5e:	75 27                	jne    802d87 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802d60:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802d65:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802d6a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802d6e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d73:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  802d7a:	00 00 00 
+  802d7d:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802d7f:	85 c0                	test   %eax,%eax
+  802d81:	0f 88 dc 00 00 00    	js     802e63 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802d87:	44 89 f8             	mov    %r15d,%eax
+  802d8a:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802d8f:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802d91:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802d98:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802d99:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d9c:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802da0:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802da3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802da8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802dac:	48 89 df             	mov    %rbx,%rdi
+  802daf:	48 b8 c8 29 80 00 00 	movabs $0x8029c8,%rax
+  802db6:	00 00 00 
+  802db9:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802dbb:	48 85 c0             	test   %rax,%rax
+  802dbe:	0f 88 f4 fe ff ff    	js     802cb8 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802dc4:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802dc7:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802dca:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802dcd:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802dd1:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802dd5:	48 63 d1             	movslq %ecx,%rdx
+  802dd8:	48 01 d0             	add    %rdx,%rax
+  802ddb:	4d 63 ff             	movslq %r15d,%r15
+  802dde:	4c 29 f8             	sub    %r15,%rax
+  802de1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802de6:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802dea:	48 85 c0             	test   %rax,%rax
+  802ded:	0f 8e c5 fe ff ff    	jle    802cb8 <devfile_read+0x78>
+    n = MIN(n, res);
+  802df3:	4c 39 e8             	cmp    %r13,%rax
+  802df6:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802dfa:	8b 73 04             	mov    0x4(%rbx),%esi
+  802dfd:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e01:	48 63 f6             	movslq %esi,%rsi
+  802e04:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e09:	48 01 c6             	add    %rax,%rsi
+  802e0c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e10:	48 01 c6             	add    %rax,%rsi
+  802e13:	4c 89 ea             	mov    %r13,%rdx
+  802e16:	4c 89 e7             	mov    %r12,%rdi
+  802e19:	48 b8 2b 0e 80 00 00 	movabs $0x800e2b,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802e25:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802e29:	4c 89 e8             	mov    %r13,%rax
+  802e2c:	e9 87 fe ff ff       	jmp    802cb8 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e31:	48 98                	cltq
+  802e33:	e9 80 fe ff ff       	jmp    802cb8 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e38:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e3c:	41 39 d7             	cmp    %edx,%r15d
+  802e3f:	0f 8c f8 fe ff ff    	jl     802d3d <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e45:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e49:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e4c:	41 39 cf             	cmp    %ecx,%r15d
+  802e4f:	0f 8d e8 fe ff ff    	jge    802d3d <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802e55:	4d 63 ff             	movslq %r15d,%r15
+  802e58:	4c 29 f8             	sub    %r15,%rax
+  802e5b:	48 63 d2             	movslq %edx,%rdx
+  802e5e:	48 01 d0             	add    %rdx,%rax
+  802e61:	eb 87                	jmp    802dea <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e63:	48 98                	cltq
+  802e65:	e9 4e fe ff ff       	jmp    802cb8 <devfile_read+0x78>
+        return E_INVAL;
+  802e6a:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e6f:	c3                   	ret
+
+0000000000802e70 <fs_channel>:
+fs_channel(bool enable) {
+  802e70:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802e72:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802e79:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802e7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e80:	40 84 ff             	test   %dil,%dil
+  802e83:	74 47                	je     802ecc <fs_channel+0x5c>
+  802e85:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802e8c:	00 00 00 
+  802e8f:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802e95:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802e9c:	00 00 00 
+  802e9f:	3b 08                	cmp    (%rax),%ecx
+  802ea1:	74 29                	je     802ecc <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802ea3:	55                   	push   %rbp
+  802ea4:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802ea7:	48 b8 f0 1d 80 00 00 	movabs $0x801df0,%rax
+  802eae:	00 00 00 
+  802eb1:	ff d0                	call   *%rax
+  802eb3:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	78 04                	js     802ebd <fs_channel+0x4d>
+}
+  802eb9:	89 d0                	mov    %edx,%eax
+  802ebb:	5d                   	pop    %rbp
+  802ebc:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ebd:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802ec4:	00 00 00 
+  802ec7:	c6 00 00             	movb   $0x0,(%rax)
+  802eca:	eb ed                	jmp    802eb9 <fs_channel+0x49>
+}
+  802ecc:	89 d0                	mov    %edx,%eax
+  802ece:	c3                   	ret
+
+0000000000802ecf <open>:
+open(const char *path, int mode) {
+  802ecf:	55                   	push   %rbp
+  802ed0:	48 89 e5             	mov    %rsp,%rbp
+  802ed3:	41 55                	push   %r13
+  802ed5:	41 54                	push   %r12
+  802ed7:	53                   	push   %rbx
+  802ed8:	48 83 ec 18          	sub    $0x18,%rsp
+  802edc:	49 89 fc             	mov    %rdi,%r12
+  802edf:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802ee2:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  802ee9:	00 00 00 
+  802eec:	ff d0                	call   *%rax
+  802eee:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802ef4:	0f 87 8f 00 00 00    	ja     802f89 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802efa:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802efe:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  802f05:	00 00 00 
+  802f08:	ff d0                	call   *%rax
+  802f0a:	89 c3                	mov    %eax,%ebx
+  802f0c:	85 c0                	test   %eax,%eax
+  802f0e:	78 55                	js     802f65 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f10:	4c 89 e6             	mov    %r12,%rsi
+  802f13:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f1a:	00 00 00 
+  802f1d:	48 89 df             	mov    %rbx,%rdi
+  802f20:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  802f27:	00 00 00 
+  802f2a:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f2c:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802f33:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f38:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f3c:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f41:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  802f48:	00 00 00 
+  802f4b:	ff d0                	call   *%rax
+  802f4d:	89 c3                	mov    %eax,%ebx
+  802f4f:	85 c0                	test   %eax,%eax
+  802f51:	78 1f                	js     802f72 <open+0xa3>
+    return fd2num(fd);
+  802f53:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f57:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  802f5e:	00 00 00 
+  802f61:	ff d0                	call   *%rax
+  802f63:	89 c3                	mov    %eax,%ebx
+}
+  802f65:	89 d8                	mov    %ebx,%eax
+  802f67:	48 83 c4 18          	add    $0x18,%rsp
+  802f6b:	5b                   	pop    %rbx
+  802f6c:	41 5c                	pop    %r12
+  802f6e:	41 5d                	pop    %r13
+  802f70:	5d                   	pop    %rbp
+  802f71:	c3                   	ret
+        fd_close(fd, 0);
+  802f72:	be 00 00 00 00       	mov    $0x0,%esi
+  802f77:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802f7b:	48 b8 c5 17 80 00 00 	movabs $0x8017c5,%rax
+  802f82:	00 00 00 
+  802f85:	ff d0                	call   *%rax
+        return res;
+  802f87:	eb dc                	jmp    802f65 <open+0x96>
+        return -E_BAD_PATH;
+  802f89:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802f8e:	eb d5                	jmp    802f65 <open+0x96>
+
+0000000000802f90 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802f90:	55                   	push   %rbp
+  802f91:	48 89 e5             	mov    %rsp,%rbp
+  802f94:	41 56                	push   %r14
+  802f96:	41 55                	push   %r13
+  802f98:	41 54                	push   %r12
+  802f9a:	53                   	push   %rbx
+  802f9b:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802f9f:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802fa6:	00 00 00 
+  802fa9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802fae:	49 bd 0a 17 80 00 00 	movabs $0x80170a,%r13
+  802fb5:	00 00 00 
+  802fb8:	49 be ca 26 80 00 00 	movabs $0x8026ca,%r14
+  802fbf:	00 00 00 
+  802fc2:	eb 0c                	jmp    802fd0 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802fc4:	83 c3 01             	add    $0x1,%ebx
+  802fc7:	49 83 c4 18          	add    $0x18,%r12
+  802fcb:	83 fb 20             	cmp    $0x20,%ebx
+  802fce:	74 1d                	je     802fed <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802fd0:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802fd5:	74 ed                	je     802fc4 <file_flush_buffers+0x34>
+  802fd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802fdb:	89 df                	mov    %ebx,%edi
+  802fdd:	41 ff d5             	call   *%r13
+  802fe0:	85 c0                	test   %eax,%eax
+  802fe2:	78 e0                	js     802fc4 <file_flush_buffers+0x34>
+  802fe4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fe8:	41 ff d6             	call   *%r14
+  802feb:	eb d7                	jmp    802fc4 <file_flush_buffers+0x34>
+}
+  802fed:	48 83 c4 10          	add    $0x10,%rsp
+  802ff1:	5b                   	pop    %rbx
+  802ff2:	41 5c                	pop    %r12
+  802ff4:	41 5d                	pop    %r13
+  802ff6:	41 5e                	pop    %r14
+  802ff8:	5d                   	pop    %rbp
+  802ff9:	c3                   	ret
+
+0000000000802ffa <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802ffa:	55                   	push   %rbp
+  802ffb:	48 89 e5             	mov    %rsp,%rbp
+  802ffe:	41 54                	push   %r12
+  803000:	53                   	push   %rbx
+  803001:	49 89 fc             	mov    %rdi,%r12
+  803004:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803006:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  80300d:	00 00 00 
+  803010:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803012:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803019:	00 00 00 
+  80301c:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803021:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803023:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803026:	ba 00 00 00 00       	mov    $0x0,%edx
+  80302b:	be 00 00 00 00       	mov    $0x0,%esi
+  803030:	bf 02 00 00 00       	mov    $0x2,%edi
+  803035:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  80303c:	00 00 00 
+  80303f:	ff d0                	call   *%rax
+}
+  803041:	5b                   	pop    %rbx
+  803042:	41 5c                	pop    %r12
+  803044:	5d                   	pop    %rbp
+  803045:	c3                   	ret
+
+0000000000803046 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803046:	55                   	push   %rbp
+  803047:	48 89 e5             	mov    %rsp,%rbp
+  80304a:	41 54                	push   %r12
+  80304c:	53                   	push   %rbx
+  80304d:	49 89 fc             	mov    %rdi,%r12
+  803050:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803053:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80305f:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803064:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80306b:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80306d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803072:	be 00 00 00 00       	mov    $0x0,%esi
+  803077:	bf 05 00 00 00       	mov    $0x5,%edi
+  80307c:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  803083:	00 00 00 
+  803086:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803088:	85 c0                	test   %eax,%eax
+  80308a:	78 3d                	js     8030c9 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80308c:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803093:	00 00 00 
+  803096:	4c 89 e6             	mov    %r12,%rsi
+  803099:	48 89 df             	mov    %rbx,%rdi
+  80309c:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8030a8:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8030af:	00 
+  8030b0:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8030b6:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8030bd:	00 
+  8030be:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8030c4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c9:	5b                   	pop    %rbx
+  8030ca:	41 5c                	pop    %r12
+  8030cc:	5d                   	pop    %rbp
+  8030cd:	c3                   	ret
+
+00000000008030ce <remove>:
+remove(const char *path) {
+  8030ce:	55                   	push   %rbp
+  8030cf:	48 89 e5             	mov    %rsp,%rbp
+  8030d2:	53                   	push   %rbx
+  8030d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8030d7:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8030da:	48 b8 8c 0b 80 00 00 	movabs $0x800b8c,%rax
+  8030e1:	00 00 00 
+  8030e4:	ff d0                	call   *%rax
+  8030e6:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030ec:	77 3a                	ja     803128 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8030ee:	48 89 de             	mov    %rbx,%rsi
+  8030f1:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8030f8:	00 00 00 
+  8030fb:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  803102:	00 00 00 
+  803105:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803107:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310c:	be 00 00 00 00       	mov    $0x0,%esi
+  803111:	bf 07 00 00 00       	mov    $0x7,%edi
+  803116:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  80311d:	00 00 00 
+  803120:	ff d0                	call   *%rax
+}
+  803122:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803126:	c9                   	leave
+  803127:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803128:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80312d:	eb f3                	jmp    803122 <remove+0x54>
+
+000000000080312f <sync>:
+sync(void) {
+  80312f:	55                   	push   %rbp
+  803130:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803133:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  80313a:	00 00 00 
+  80313d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80313f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803144:	be 00 00 00 00       	mov    $0x0,%esi
+  803149:	bf 08 00 00 00       	mov    $0x8,%edi
+  80314e:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  803155:	00 00 00 
+  803158:	ff d0                	call   *%rax
+}
+  80315a:	5d                   	pop    %rbp
+  80315b:	c3                   	ret
+
+000000000080315c <fsync>:
+fsync(int fdnum) {
+  80315c:	55                   	push   %rbp
+  80315d:	48 89 e5             	mov    %rsp,%rbp
+  803160:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803164:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803168:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  80316f:	00 00 00 
+  803172:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803174:	85 c0                	test   %eax,%eax
+  803176:	78 4b                	js     8031c3 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803178:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80317c:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803183:	00 00 00 
+  803186:	8b 00                	mov    (%rax),%eax
+  803188:	39 02                	cmp    %eax,(%rdx)
+  80318a:	75 39                	jne    8031c5 <fsync+0x69>
+    file_flush_buffers();
+  80318c:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803198:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80319c:	8b 40 0c             	mov    0xc(%rax),%eax
+  80319f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8031a6:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8031a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b2:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8031b7:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  8031be:	00 00 00 
+  8031c1:	ff d0                	call   *%rax
+}
+  8031c3:	c9                   	leave
+  8031c4:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8031ca:	eb f7                	jmp    8031c3 <fsync+0x67>
+
+00000000008031cc <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8031cc:	55                   	push   %rbp
+  8031cd:	48 89 e5             	mov    %rsp,%rbp
+  8031d0:	53                   	push   %rbx
+  8031d1:	48 83 ec 08          	sub    $0x8,%rsp
+  8031d5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8031d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031dd:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e2:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8031e7:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  8031ee:	00 00 00 
+  8031f1:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031f3:	85 c0                	test   %eax,%eax
+  8031f5:	78 2d                	js     803224 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8031f7:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8031fe:	00 00 00 
+  803201:	48 8b 10             	mov    (%rax),%rdx
+  803204:	48 89 13             	mov    %rdx,(%rbx)
+  803207:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80320b:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80320f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803213:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803217:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80321b:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80321f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803224:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803228:	c9                   	leave
+  803229:	c3                   	ret
+
+000000000080322a <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80322a:	55                   	push   %rbp
+  80322b:	48 89 e5             	mov    %rsp,%rbp
+  80322e:	53                   	push   %rbx
+  80322f:	48 83 ec 08          	sub    $0x8,%rsp
+  803233:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323b:	be 00 00 00 00       	mov    $0x0,%esi
+  803240:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803245:	48 b8 61 24 80 00 00 	movabs $0x802461,%rax
+  80324c:	00 00 00 
+  80324f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803251:	85 c0                	test   %eax,%eax
+  803253:	78 3d                	js     803292 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803255:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80325c:	00 00 00 
+  80325f:	48 8b 10             	mov    (%rax),%rdx
+  803262:	48 89 13             	mov    %rdx,(%rbx)
+  803265:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803269:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80326d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803271:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803275:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803279:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80327d:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803281:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803285:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803289:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80328d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803292:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803296:	c9                   	leave
+  803297:	c3                   	ret
+
+0000000000803298 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803298:	55                   	push   %rbp
+  803299:	48 89 e5             	mov    %rsp,%rbp
+  80329c:	41 57                	push   %r15
+  80329e:	41 56                	push   %r14
+  8032a0:	41 55                	push   %r13
+  8032a2:	41 54                	push   %r12
+  8032a4:	53                   	push   %rbx
+  8032a5:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8032a9:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8032b0:	00 
+  8032b1:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8032b8:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8032be:	0f 85 43 01 00 00    	jne    803407 <munmap+0x16f>
+  8032c4:	49 89 ff             	mov    %rdi,%r15
+  8032c7:	4c 39 f7             	cmp    %r14,%rdi
+  8032ca:	0f 87 37 01 00 00    	ja     803407 <munmap+0x16f>
+  8032d0:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8032d7:	00 00 00 
+  8032da:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8032e0:	eb 2c                	jmp    80330e <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8032e2:	4c 39 f8             	cmp    %r15,%rax
+  8032e5:	0f 83 85 00 00 00    	jae    803370 <munmap+0xd8>
+            m->mm_end = start;
+  8032eb:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8032f0:	48 83 c3 18          	add    $0x18,%rbx
+  8032f4:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8032fb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803302:	00 00 00 
+  803305:	48 39 c3             	cmp    %rax,%rbx
+  803308:	0f 84 d0 00 00 00    	je     8033de <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80330e:	49 89 dc             	mov    %rbx,%r12
+  803311:	48 8b 03             	mov    (%rbx),%rax
+  803314:	4c 39 f0             	cmp    %r14,%rax
+  803317:	73 d7                	jae    8032f0 <munmap+0x58>
+  803319:	48 85 c0             	test   %rax,%rax
+  80331c:	74 d2                	je     8032f0 <munmap+0x58>
+  80331e:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803322:	49 39 d7             	cmp    %rdx,%r15
+  803325:	73 c9                	jae    8032f0 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803327:	49 39 d6             	cmp    %rdx,%r14
+  80332a:	73 b6                	jae    8032e2 <munmap+0x4a>
+  80332c:	49 39 c7             	cmp    %rax,%r15
+  80332f:	76 b1                	jbe    8032e2 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803331:	4c 89 ef             	mov    %r13,%rdi
+  803334:	48 b8 cf 23 80 00 00 	movabs $0x8023cf,%rax
+  80333b:	00 00 00 
+  80333e:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803340:	48 85 c0             	test   %rax,%rax
+  803343:	0f 84 c5 00 00 00    	je     80340e <munmap+0x176>
+            *tail = *m;
+  803349:	48 8b 13             	mov    (%rbx),%rdx
+  80334c:	48 89 10             	mov    %rdx,(%rax)
+  80334f:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803353:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803357:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80335b:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80335f:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803362:	44 89 f2             	mov    %r14d,%edx
+  803365:	2b 13                	sub    (%rbx),%edx
+  803367:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80336a:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80336e:	eb 80                	jmp    8032f0 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803370:	49 39 d6             	cmp    %rdx,%r14
+  803373:	73 18                	jae    80338d <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803375:	44 89 f2             	mov    %r14d,%edx
+  803378:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80337d:	29 c2                	sub    %eax,%edx
+  80337f:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803384:	4d 89 34 24          	mov    %r14,(%r12)
+  803388:	e9 63 ff ff ff       	jmp    8032f0 <munmap+0x58>
+    m->mm_start = 0;
+  80338d:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803394:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803395:	4c 89 e6             	mov    %r12,%rsi
+  803398:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80339f:	00 00 00 
+  8033a2:	48 29 c6             	sub    %rax,%rsi
+  8033a5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8033a9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8033b0:	aa aa aa 
+  8033b3:	48 0f af f0          	imul   %rax,%rsi
+  8033b7:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8033bb:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8033c0:	48 01 c6             	add    %rax,%rsi
+  8033c3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8033c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033cd:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  8033d4:	00 00 00 
+  8033d7:	ff d0                	call   *%rax
+}
+  8033d9:	e9 12 ff ff ff       	jmp    8032f0 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8033de:	4c 89 f2             	mov    %r14,%rdx
+  8033e1:	4c 29 fa             	sub    %r15,%rdx
+  8033e4:	4c 89 fe             	mov    %r15,%rsi
+  8033e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8033ec:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  8033f3:	00 00 00 
+  8033f6:	ff d0                	call   *%rax
+}
+  8033f8:	48 83 c4 08          	add    $0x8,%rsp
+  8033fc:	5b                   	pop    %rbx
+  8033fd:	41 5c                	pop    %r12
+  8033ff:	41 5d                	pop    %r13
+  803401:	41 5e                	pop    %r14
+  803403:	41 5f                	pop    %r15
+  803405:	5d                   	pop    %rbp
+  803406:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803407:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80340c:	eb ea                	jmp    8033f8 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80340e:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803413:	eb e3                	jmp    8033f8 <munmap+0x160>
+
+0000000000803415 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803415:	55                   	push   %rbp
+  803416:	48 89 e5             	mov    %rsp,%rbp
+  803419:	41 57                	push   %r15
+  80341b:	41 56                	push   %r14
+  80341d:	41 55                	push   %r13
+  80341f:	41 54                	push   %r12
+  803421:	53                   	push   %rbx
+  803422:	48 83 ec 28          	sub    $0x28,%rsp
+  803426:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80342a:	49 89 f5             	mov    %rsi,%r13
+  80342d:	41 89 d6             	mov    %edx,%r14d
+  803430:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803433:	41 89 cc             	mov    %ecx,%r12d
+  803436:	44 89 c7             	mov    %r8d,%edi
+  803439:	44 89 cb             	mov    %r9d,%ebx
+  80343c:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803440:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803444:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+  803450:	41 89 c7             	mov    %eax,%r15d
+  803453:	85 c0                	test   %eax,%eax
+  803455:	0f 88 ae 01 00 00    	js     803609 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80345b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80345f:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803466:	00 00 00 
+  803469:	8b 32                	mov    (%rdx),%esi
+  80346b:	39 30                	cmp    %esi,(%rax)
+  80346d:	0f 85 7a 02 00 00    	jne    8036ed <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803473:	8b 40 08             	mov    0x8(%rax),%eax
+  803476:	83 e0 03             	and    $0x3,%eax
+  803479:	83 f8 01             	cmp    $0x1,%eax
+  80347c:	0f 84 76 02 00 00    	je     8036f8 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803482:	4d 85 ed             	test   %r13,%r13
+  803485:	0f 84 78 02 00 00    	je     803703 <mmap+0x2ee>
+  80348b:	85 db                	test   %ebx,%ebx
+  80348d:	0f 88 70 02 00 00    	js     803703 <mmap+0x2ee>
+  803493:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803499:	41 89 df             	mov    %ebx,%r15d
+  80349c:	0f 85 6c 02 00 00    	jne    80370e <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8034a2:	44 89 f0             	mov    %r14d,%eax
+  8034a5:	83 e0 fd             	and    $0xfffffffd,%eax
+  8034a8:	83 f8 04             	cmp    $0x4,%eax
+  8034ab:	0f 85 68 02 00 00    	jne    803719 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8034b1:	44 89 e1             	mov    %r12d,%ecx
+  8034b4:	83 e1 01             	and    $0x1,%ecx
+  8034b7:	0f 95 c2             	setne  %dl
+  8034ba:	44 89 e0             	mov    %r12d,%eax
+  8034bd:	d1 e8                	shr    %eax
+  8034bf:	83 f0 01             	xor    $0x1,%eax
+  8034c2:	83 e0 01             	and    $0x1,%eax
+  8034c5:	38 c2                	cmp    %al,%dl
+  8034c7:	0f 85 57 02 00 00    	jne    803724 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8034cd:	85 c9                	test   %ecx,%ecx
+  8034cf:	74 0a                	je     8034db <mmap+0xc6>
+  8034d1:	41 f6 c6 02          	test   $0x2,%r14b
+  8034d5:	0f 85 54 02 00 00    	jne    80372f <mmap+0x31a>
+    file_flush_buffers();
+  8034db:	48 b8 90 2f 80 00 00 	movabs $0x802f90,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8034e7:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8034ee:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8034f5:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8034f9:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8034fc:	41 f6 c4 04          	test   $0x4,%r12b
+  803500:	0f 84 15 01 00 00    	je     80361b <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803506:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803509:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80350f:	0f 85 25 02 00 00    	jne    80373a <mmap+0x325>
+  803515:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803519:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803520:	00 00 00 
+  803523:	48 39 c2             	cmp    %rax,%rdx
+  803526:	0f 82 19 02 00 00    	jb     803745 <mmap+0x330>
+  80352c:	48 39 c7             	cmp    %rax,%rdi
+  80352f:	0f 87 10 02 00 00    	ja     803745 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803535:	4c 89 ee             	mov    %r13,%rsi
+  803538:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  80353f:	00 00 00 
+  803542:	ff d0                	call   *%rax
+  803544:	85 c0                	test   %eax,%eax
+  803546:	0f 88 04 02 00 00    	js     803750 <mmap+0x33b>
+    if (!handler) {
+  80354c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803553:	00 00 00 
+  803556:	80 38 00             	cmpb   $0x0,(%rax)
+  803559:	75 2b                	jne    803586 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80355b:	48 bf 30 23 80 00 00 	movabs $0x802330,%rdi
+  803562:	00 00 00 
+  803565:	48 b8 94 44 80 00 00 	movabs $0x804494,%rax
+  80356c:	00 00 00 
+  80356f:	ff d0                	call   *%rax
+  803571:	85 c0                	test   %eax,%eax
+  803573:	0f 88 ea 01 00 00    	js     803763 <mmap+0x34e>
+        handler = 1;
+  803579:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803580:	00 00 00 
+  803583:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803586:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80358a:	48 b8 cf 23 80 00 00 	movabs $0x8023cf,%rax
+  803591:	00 00 00 
+  803594:	ff d0                	call   *%rax
+  803596:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803599:	48 85 c0             	test   %rax,%rax
+  80359c:	0f 84 c9 01 00 00    	je     80376b <mmap+0x356>
+    m->mm_start = va;
+  8035a2:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8035a5:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8035a9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8035ad:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8035b0:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8035b4:	44 89 e0             	mov    %r12d,%eax
+  8035b7:	c1 e0 06             	shl    $0x6,%eax
+  8035ba:	25 80 00 00 00       	and    $0x80,%eax
+  8035bf:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8035c2:	09 f0                	or     %esi,%eax
+  8035c4:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8035c8:	41 f6 c4 08          	test   $0x8,%r12b
+  8035cc:	74 31                	je     8035ff <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035ce:	48 39 d3             	cmp    %rdx,%rbx
+  8035d1:	73 2c                	jae    8035ff <mmap+0x1ea>
+  8035d3:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8035d8:	48 89 de             	mov    %rbx,%rsi
+  8035db:	4c 89 f7             	mov    %r14,%rdi
+  8035de:	48 b8 1f 22 80 00 00 	movabs $0x80221f,%rax
+  8035e5:	00 00 00 
+  8035e8:	ff d0                	call   *%rax
+  8035ea:	49 89 c4             	mov    %rax,%r12
+  8035ed:	48 85 c0             	test   %rax,%rax
+  8035f0:	0f 8e d7 00 00 00    	jle    8036cd <mmap+0x2b8>
+            va += n;
+  8035f6:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8035f9:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8035fd:	72 d4                	jb     8035d3 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8035ff:	49 8b 06             	mov    (%r14),%rax
+  803602:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803606:	48 89 06             	mov    %rax,(%rsi)
+}
+  803609:	44 89 f8             	mov    %r15d,%eax
+  80360c:	48 83 c4 28          	add    $0x28,%rsp
+  803610:	5b                   	pop    %rbx
+  803611:	41 5c                	pop    %r12
+  803613:	41 5d                	pop    %r13
+  803615:	41 5e                	pop    %r14
+  803617:	41 5f                	pop    %r15
+  803619:	5d                   	pop    %rbp
+  80361a:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80361b:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803622:	00 00 00 
+  803625:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803628:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80362f:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803632:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803637:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80363e:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803641:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803648:	00 00 00 
+  80364b:	48 39 d7             	cmp    %rdx,%rdi
+  80364e:	73 1c                	jae    80366c <mmap+0x257>
+        return -E_NO_MEM;
+  803650:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803656:	eb b1                	jmp    803609 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803658:	48 83 c0 01          	add    $0x1,%rax
+  80365c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803660:	77 3f                	ja     8036a1 <mmap+0x28c>
+  803662:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803667:	48 39 d7             	cmp    %rdx,%rdi
+  80366a:	72 2a                	jb     803696 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80366c:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803670:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803674:	48 39 d1             	cmp    %rdx,%rcx
+  803677:	73 df                	jae    803658 <mmap+0x243>
+  803679:	48 85 c9             	test   %rcx,%rcx
+  80367c:	74 da                	je     803658 <mmap+0x243>
+  80367e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803682:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803687:	48 39 d3             	cmp    %rdx,%rbx
+  80368a:	73 cc                	jae    803658 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80368c:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80368f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803694:	eb cc                	jmp    803662 <mmap+0x24d>
+        return -E_NO_MEM;
+  803696:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80369c:	e9 68 ff ff ff       	jmp    803609 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8036a1:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8036a6:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8036ad:	00 00 00 
+  8036b0:	48 39 c2             	cmp    %rax,%rdx
+  8036b3:	0f 82 9f 00 00 00    	jb     803758 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8036b9:	48 85 db             	test   %rbx,%rbx
+  8036bc:	0f 85 8a fe ff ff    	jne    80354c <mmap+0x137>
+        return -E_NO_MEM;
+  8036c2:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036c8:	e9 3c ff ff ff       	jmp    803609 <mmap+0x1f4>
+        if (n < 0) {
+  8036cd:	0f 89 2c ff ff ff    	jns    8035ff <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8036d3:	49 8b 3e             	mov    (%r14),%rdi
+  8036d6:	4c 89 ee             	mov    %r13,%rsi
+  8036d9:	48 b8 98 32 80 00 00 	movabs $0x803298,%rax
+  8036e0:	00 00 00 
+  8036e3:	ff d0                	call   *%rax
+            return n;
+  8036e5:	45 89 e7             	mov    %r12d,%r15d
+  8036e8:	e9 1c ff ff ff       	jmp    803609 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036ed:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036f3:	e9 11 ff ff ff       	jmp    803609 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036f8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8036fe:	e9 06 ff ff ff       	jmp    803609 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803703:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803709:	e9 fb fe ff ff       	jmp    803609 <mmap+0x1f4>
+  80370e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803714:	e9 f0 fe ff ff       	jmp    803609 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803719:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80371f:	e9 e5 fe ff ff       	jmp    803609 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803724:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80372a:	e9 da fe ff ff       	jmp    803609 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80372f:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803735:	e9 cf fe ff ff       	jmp    803609 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80373a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803740:	e9 c4 fe ff ff       	jmp    803609 <mmap+0x1f4>
+  803745:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80374b:	e9 b9 fe ff ff       	jmp    803609 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803750:	41 89 c7             	mov    %eax,%r15d
+  803753:	e9 b1 fe ff ff       	jmp    803609 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803758:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80375e:	e9 a6 fe ff ff       	jmp    803609 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803763:	41 89 c7             	mov    %eax,%r15d
+  803766:	e9 9e fe ff ff       	jmp    803609 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80376b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803771:	e9 93 fe ff ff       	jmp    803609 <mmap+0x1f4>
+
+0000000000803776 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803776:	55                   	push   %rbp
+  803777:	48 89 e5             	mov    %rsp,%rbp
+  80377a:	41 54                	push   %r12
+  80377c:	53                   	push   %rbx
+  80377d:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803780:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803787:	00 00 00 
+  80378a:	ff d0                	call   *%rax
+  80378c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80378f:	48 be 20 4f 80 00 00 	movabs $0x804f20,%rsi
+  803796:	00 00 00 
+  803799:	48 89 df             	mov    %rbx,%rdi
+  80379c:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  8037a3:	00 00 00 
+  8037a6:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8037a8:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8037ad:	41 2b 04 24          	sub    (%r12),%eax
+  8037b1:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8037b7:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8037be:	00 00 00 
+    stat->st_dev = &devpipe;
+  8037c1:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8037c8:	00 00 00 
+  8037cb:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8037d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d7:	5b                   	pop    %rbx
+  8037d8:	41 5c                	pop    %r12
+  8037da:	5d                   	pop    %rbp
+  8037db:	c3                   	ret
+
+00000000008037dc <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037dc:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8037df:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8037e5:	8b 17                	mov    (%rdi),%edx
+  8037e7:	85 d2                	test   %edx,%edx
+  8037e9:	75 01                	jne    8037ec <pipe_wakeup+0x10>
+  8037eb:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8037ec:	55                   	push   %rbp
+  8037ed:	48 89 e5             	mov    %rsp,%rbp
+  8037f0:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8037f3:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8037f9:	be 00 04 00 00       	mov    $0x400,%esi
+  8037fe:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  803805:	00 00 00 
+  803808:	ff d0                	call   *%rax
+}
+  80380a:	5d                   	pop    %rbp
+  80380b:	c3                   	ret
+
+000000000080380c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80380c:	55                   	push   %rbp
+  80380d:	48 89 e5             	mov    %rsp,%rbp
+  803810:	41 55                	push   %r13
+  803812:	41 54                	push   %r12
+  803814:	53                   	push   %rbx
+  803815:	48 83 ec 08          	sub    $0x8,%rsp
+  803819:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80381c:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803823:	00 00 00 
+  803826:	ff d0                	call   *%rax
+  803828:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80382b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803830:	4c 89 e6             	mov    %r12,%rsi
+  803833:	bf 00 00 00 00       	mov    $0x0,%edi
+  803838:	49 bc cf 11 80 00 00 	movabs $0x8011cf,%r12
+  80383f:	00 00 00 
+  803842:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803845:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803849:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80384d:	49 bd dc 37 80 00 00 	movabs $0x8037dc,%r13
+  803854:	00 00 00 
+  803857:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80385a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80385e:	48 89 de             	mov    %rbx,%rsi
+  803861:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803864:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803869:	48 89 de             	mov    %rbx,%rsi
+  80386c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803871:	41 ff d4             	call   *%r12
+  803874:	48 83 c4 08          	add    $0x8,%rsp
+  803878:	5b                   	pop    %rbx
+  803879:	41 5c                	pop    %r12
+  80387b:	41 5d                	pop    %r13
+  80387d:	5d                   	pop    %rbp
+  80387e:	c3                   	ret
+
+000000000080387f <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80387f:	55                   	push   %rbp
+  803880:	48 89 e5             	mov    %rsp,%rbp
+  803883:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803886:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80388b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803890:	48 b8 12 11 80 00 00 	movabs $0x801112,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	85 c0                	test   %eax,%eax
+  80389e:	0f 94 c0             	sete   %al
+  8038a1:	0f b6 c0             	movzbl %al,%eax
+}
+  8038a4:	5d                   	pop    %rbp
+  8038a5:	c3                   	ret
+
+00000000008038a6 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8038a6:	55                   	push   %rbp
+  8038a7:	48 89 e5             	mov    %rsp,%rbp
+  8038aa:	41 57                	push   %r15
+  8038ac:	41 56                	push   %r14
+  8038ae:	41 55                	push   %r13
+  8038b0:	41 54                	push   %r12
+  8038b2:	53                   	push   %rbx
+  8038b3:	48 83 ec 38          	sub    $0x38,%rsp
+  8038b7:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8038bb:	49 89 f4             	mov    %rsi,%r12
+  8038be:	49 89 d7             	mov    %rdx,%r15
+  8038c1:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c5:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  8038cc:	00 00 00 
+  8038cf:	ff d0                	call   *%rax
+  8038d1:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8038d4:	4d 85 ff             	test   %r15,%r15
+  8038d7:	0f 84 f1 00 00 00    	je     8039ce <devpipe_write+0x128>
+  8038dd:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8038e1:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8038e5:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8038e9:	49 bd 7f 38 80 00 00 	movabs $0x80387f,%r13
+  8038f0:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038f3:	49 bf dc 37 80 00 00 	movabs $0x8037dc,%r15
+  8038fa:	00 00 00 
+  8038fd:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803905:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803909:	8b 73 04             	mov    0x4(%rbx),%esi
+  80390c:	48 63 ce             	movslq %esi,%rcx
+  80390f:	48 63 03             	movslq (%rbx),%rax
+  803912:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803918:	48 39 c1             	cmp    %rax,%rcx
+  80391b:	72 64                	jb     803981 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80391d:	48 89 de             	mov    %rbx,%rsi
+  803920:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803924:	41 ff d5             	call   *%r13
+  803927:	85 c0                	test   %eax,%eax
+  803929:	0f 85 b9 00 00 00    	jne    8039e8 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80392f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803933:	4c 89 f7             	mov    %r14,%rdi
+  803936:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803939:	8b 43 04             	mov    0x4(%rbx),%eax
+  80393c:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803943:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80394a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803950:	8b 03                	mov    (%rbx),%eax
+  803952:	41 39 c4             	cmp    %eax,%r12d
+  803955:	75 b2                	jne    803909 <devpipe_write+0x63>
+  803957:	48 89 de             	mov    %rbx,%rsi
+  80395a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80395e:	41 ff d5             	call   *%r13
+  803961:	85 c0                	test   %eax,%eax
+  803963:	75 a0                	jne    803905 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803965:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80396a:	44 89 e6             	mov    %r12d,%esi
+  80396d:	48 89 df             	mov    %rbx,%rdi
+  803970:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  803977:	00 00 00 
+  80397a:	ff d0                	call   *%rax
+  80397c:	e9 7c ff ff ff       	jmp    8038fd <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803981:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803985:	41 0f b6 38          	movzbl (%r8),%edi
+  803989:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803990:	80 80 80 
+  803993:	48 89 c8             	mov    %rcx,%rax
+  803996:	48 f7 e2             	mul    %rdx
+  803999:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80399d:	48 89 d0             	mov    %rdx,%rax
+  8039a0:	48 c1 e0 08          	shl    $0x8,%rax
+  8039a4:	48 29 d0             	sub    %rdx,%rax
+  8039a7:	48 c1 e0 04          	shl    $0x4,%rax
+  8039ab:	48 29 c1             	sub    %rax,%rcx
+  8039ae:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8039b3:	83 c6 01             	add    $0x1,%esi
+  8039b6:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8039b9:	49 83 c0 01          	add    $0x1,%r8
+  8039bd:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8039c1:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8039c5:	49 39 c0             	cmp    %rax,%r8
+  8039c8:	0f 85 2f ff ff ff    	jne    8038fd <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8039ce:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8039d2:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8039d6:	48 b8 dc 37 80 00 00 	movabs $0x8037dc,%rax
+  8039dd:	00 00 00 
+  8039e0:	ff d0                	call   *%rax
+    return n;
+  8039e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8039e6:	eb 05                	jmp    8039ed <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8039e8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8039ed:	48 83 c4 38          	add    $0x38,%rsp
+  8039f1:	5b                   	pop    %rbx
+  8039f2:	41 5c                	pop    %r12
+  8039f4:	41 5d                	pop    %r13
+  8039f6:	41 5e                	pop    %r14
+  8039f8:	41 5f                	pop    %r15
+  8039fa:	5d                   	pop    %rbp
+  8039fb:	c3                   	ret
+
+00000000008039fc <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8039fc:	55                   	push   %rbp
+  8039fd:	48 89 e5             	mov    %rsp,%rbp
+  803a00:	41 57                	push   %r15
+  803a02:	41 56                	push   %r14
+  803a04:	41 55                	push   %r13
+  803a06:	41 54                	push   %r12
+  803a08:	53                   	push   %rbx
+  803a09:	48 83 ec 28          	sub    $0x28,%rsp
+  803a0d:	49 89 fd             	mov    %rdi,%r13
+  803a10:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a14:	49 89 d4             	mov    %rdx,%r12
+  803a17:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a1b:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803a22:	00 00 00 
+  803a25:	ff d0                	call   *%rax
+  803a27:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a2a:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803a30:	49 bf 7f 38 80 00 00 	movabs $0x80387f,%r15
+  803a37:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803a3a:	4d 85 e4             	test   %r12,%r12
+  803a3d:	0f 84 d5 00 00 00    	je     803b18 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a43:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a47:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803a4b:	8b 03                	mov    (%rbx),%eax
+  803a4d:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803a50:	75 7a                	jne    803acc <devpipe_read+0xd0>
+            if (i > 0) {
+  803a52:	4d 85 f6             	test   %r14,%r14
+  803a55:	75 50                	jne    803aa7 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a57:	48 89 de             	mov    %rbx,%rsi
+  803a5a:	4c 89 ef             	mov    %r13,%rdi
+  803a5d:	41 ff d7             	call   *%r15
+  803a60:	85 c0                	test   %eax,%eax
+  803a62:	0f 85 c9 00 00 00    	jne    803b31 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803a68:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803a6b:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a72:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a78:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a7b:	41 39 c4             	cmp    %eax,%r12d
+  803a7e:	75 cb                	jne    803a4b <devpipe_read+0x4f>
+  803a80:	48 89 de             	mov    %rbx,%rsi
+  803a83:	4c 89 ef             	mov    %r13,%rdi
+  803a86:	41 ff d7             	call   *%r15
+  803a89:	85 c0                	test   %eax,%eax
+  803a8b:	75 be                	jne    803a4b <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803a8d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803a92:	44 89 e6             	mov    %r12d,%esi
+  803a95:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a99:	48 b8 97 14 80 00 00 	movabs $0x801497,%rax
+  803aa0:	00 00 00 
+  803aa3:	ff d0                	call   *%rax
+  803aa5:	eb a4                	jmp    803a4b <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803aa7:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803aab:	48 89 de             	mov    %rbx,%rsi
+  803aae:	48 b8 dc 37 80 00 00 	movabs $0x8037dc,%rax
+  803ab5:	00 00 00 
+  803ab8:	ff d0                	call   *%rax
+                return i;
+  803aba:	4c 89 f0             	mov    %r14,%rax
+}
+  803abd:	48 83 c4 28          	add    $0x28,%rsp
+  803ac1:	5b                   	pop    %rbx
+  803ac2:	41 5c                	pop    %r12
+  803ac4:	41 5d                	pop    %r13
+  803ac6:	41 5e                	pop    %r14
+  803ac8:	41 5f                	pop    %r15
+  803aca:	5d                   	pop    %rbp
+  803acb:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803acc:	48 63 c8             	movslq %eax,%rcx
+  803acf:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ad6:	80 80 80 
+  803ad9:	48 89 c8             	mov    %rcx,%rax
+  803adc:	48 f7 e2             	mul    %rdx
+  803adf:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803ae3:	48 89 d0             	mov    %rdx,%rax
+  803ae6:	48 c1 e0 08          	shl    $0x8,%rax
+  803aea:	48 29 d0             	sub    %rdx,%rax
+  803aed:	48 c1 e0 04          	shl    $0x4,%rax
+  803af1:	48 89 c2             	mov    %rax,%rdx
+  803af4:	48 89 c8             	mov    %rcx,%rax
+  803af7:	48 29 d0             	sub    %rdx,%rax
+  803afa:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803aff:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b03:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803b07:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b0a:	49 83 c6 01          	add    $0x1,%r14
+  803b0e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803b12:	0f 85 2b ff ff ff    	jne    803a43 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b18:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b1c:	48 89 de             	mov    %rbx,%rsi
+  803b1f:	48 b8 dc 37 80 00 00 	movabs $0x8037dc,%rax
+  803b26:	00 00 00 
+  803b29:	ff d0                	call   *%rax
+    return n;
+  803b2b:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b2f:	eb 8c                	jmp    803abd <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b31:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b36:	eb 85                	jmp    803abd <devpipe_read+0xc1>
+
+0000000000803b38 <pipe>:
+pipe(int pfd[2]) {
+  803b38:	55                   	push   %rbp
+  803b39:	48 89 e5             	mov    %rsp,%rbp
+  803b3c:	41 55                	push   %r13
+  803b3e:	41 54                	push   %r12
+  803b40:	53                   	push   %rbx
+  803b41:	48 83 ec 18          	sub    $0x18,%rsp
+  803b45:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b48:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803b4c:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  803b53:	00 00 00 
+  803b56:	ff d0                	call   *%rax
+  803b58:	89 c3                	mov    %eax,%ebx
+  803b5a:	85 c0                	test   %eax,%eax
+  803b5c:	0f 88 a0 01 00 00    	js     803d02 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803b62:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803b67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b6c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b75:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  803b7c:	00 00 00 
+  803b7f:	ff d0                	call   *%rax
+  803b81:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803b83:	85 c0                	test   %eax,%eax
+  803b85:	0f 88 77 01 00 00    	js     803d02 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803b8b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803b8f:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  803b96:	00 00 00 
+  803b99:	ff d0                	call   *%rax
+  803b9b:	89 c3                	mov    %eax,%ebx
+  803b9d:	85 c0                	test   %eax,%eax
+  803b9f:	0f 88 43 01 00 00    	js     803ce8 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ba5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803baa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803baf:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803bb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb8:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  803bbf:	00 00 00 
+  803bc2:	ff d0                	call   *%rax
+  803bc4:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bc6:	85 c0                	test   %eax,%eax
+  803bc8:	0f 88 1a 01 00 00    	js     803ce8 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803bce:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803bd2:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803bd9:	00 00 00 
+  803bdc:	ff d0                	call   *%rax
+  803bde:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803be1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803be6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803beb:	48 89 c6             	mov    %rax,%rsi
+  803bee:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf3:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  803bfa:	00 00 00 
+  803bfd:	ff d0                	call   *%rax
+  803bff:	89 c3                	mov    %eax,%ebx
+  803c01:	85 c0                	test   %eax,%eax
+  803c03:	0f 88 c5 00 00 00    	js     803cce <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c09:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c0d:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803c14:	00 00 00 
+  803c17:	ff d0                	call   *%rax
+  803c19:	48 89 c1             	mov    %rax,%rcx
+  803c1c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c22:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c28:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c2d:	4c 89 ee             	mov    %r13,%rsi
+  803c30:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c35:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  803c3c:	00 00 00 
+  803c3f:	ff d0                	call   *%rax
+  803c41:	89 c3                	mov    %eax,%ebx
+  803c43:	85 c0                	test   %eax,%eax
+  803c45:	78 6e                	js     803cb5 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803c47:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c4c:	4c 89 ef             	mov    %r13,%rdi
+  803c4f:	48 b8 ee 10 80 00 00 	movabs $0x8010ee,%rax
+  803c56:	00 00 00 
+  803c59:	ff d0                	call   *%rax
+  803c5b:	83 f8 02             	cmp    $0x2,%eax
+  803c5e:	0f 85 ab 00 00 00    	jne    803d0f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803c64:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803c6b:	00 00 
+  803c6d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c71:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803c73:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803c77:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803c7e:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803c82:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803c84:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803c88:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803c8f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c93:	48 bb 7c 16 80 00 00 	movabs $0x80167c,%rbx
+  803c9a:	00 00 00 
+  803c9d:	ff d3                	call   *%rbx
+  803c9f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ca3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ca7:	ff d3                	call   *%rbx
+  803ca9:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803cae:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803cb3:	eb 4d                	jmp    803d02 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803cb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cba:	4c 89 ee             	mov    %r13,%rsi
+  803cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cc2:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  803cc9:	00 00 00 
+  803ccc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803cce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cd3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cd7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cdc:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  803ce3:	00 00 00 
+  803ce6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ce8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ced:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cf1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cf6:	48 b8 cf 11 80 00 00 	movabs $0x8011cf,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+}
+  803d02:	89 d8                	mov    %ebx,%eax
+  803d04:	48 83 c4 18          	add    $0x18,%rsp
+  803d08:	5b                   	pop    %rbx
+  803d09:	41 5c                	pop    %r12
+  803d0b:	41 5d                	pop    %r13
+  803d0d:	5d                   	pop    %rbp
+  803d0e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d0f:	48 b9 50 4f 80 00 00 	movabs $0x804f50,%rcx
+  803d16:	00 00 00 
+  803d19:	48 ba 27 4f 80 00 00 	movabs $0x804f27,%rdx
+  803d20:	00 00 00 
+  803d23:	be 50 00 00 00       	mov    $0x50,%esi
+  803d28:	48 bf 3c 4f 80 00 00 	movabs $0x804f3c,%rdi
+  803d2f:	00 00 00 
+  803d32:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d37:	49 b8 67 43 80 00 00 	movabs $0x804367,%r8
+  803d3e:	00 00 00 
+  803d41:	41 ff d0             	call   *%r8
+
+0000000000803d44 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803d44:	55                   	push   %rbp
+  803d45:	48 89 e5             	mov    %rsp,%rbp
+  803d48:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803d4c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803d50:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803d5c:	85 c0                	test   %eax,%eax
+  803d5e:	78 23                	js     803d83 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803d60:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d64:	48 b8 8e 16 80 00 00 	movabs $0x80168e,%rax
+  803d6b:	00 00 00 
+  803d6e:	ff d0                	call   *%rax
+  803d70:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803d73:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803d77:	48 b8 7f 38 80 00 00 	movabs $0x80387f,%rax
+  803d7e:	00 00 00 
+  803d81:	ff d0                	call   *%rax
+}
+  803d83:	c9                   	leave
+  803d84:	c3                   	ret
+
+0000000000803d85 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803d85:	48 89 f8             	mov    %rdi,%rax
+  803d88:	48 c1 e8 27          	shr    $0x27,%rax
+  803d8c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803d93:	01 00 00 
+  803d96:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803d9a:	f6 c2 01             	test   $0x1,%dl
+  803d9d:	74 6d                	je     803e0c <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803d9f:	48 89 f8             	mov    %rdi,%rax
+  803da2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803da6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dad:	01 00 00 
+  803db0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803db4:	f6 c2 01             	test   $0x1,%dl
+  803db7:	74 62                	je     803e1b <get_uvpt_entry+0x96>
+  803db9:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803dc0:	01 00 00 
+  803dc3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803dc7:	f6 c2 80             	test   $0x80,%dl
+  803dca:	75 4f                	jne    803e1b <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803dcc:	48 89 f8             	mov    %rdi,%rax
+  803dcf:	48 c1 e8 15          	shr    $0x15,%rax
+  803dd3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803dda:	01 00 00 
+  803ddd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803de1:	f6 c2 01             	test   $0x1,%dl
+  803de4:	74 44                	je     803e2a <get_uvpt_entry+0xa5>
+  803de6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803ded:	01 00 00 
+  803df0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803df4:	f6 c2 80             	test   $0x80,%dl
+  803df7:	75 31                	jne    803e2a <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803df9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803dfd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e04:	01 00 00 
+  803e07:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e0b:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e0c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e13:	01 00 00 
+  803e16:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e1a:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e1b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e22:	01 00 00 
+  803e25:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e29:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e2a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e31:	01 00 00 
+  803e34:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e38:	c3                   	ret
+
+0000000000803e39 <get_prot>:
+
+int
+get_prot(void *va) {
+  803e39:	55                   	push   %rbp
+  803e3a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e3d:	48 b8 85 3d 80 00 00 	movabs $0x803d85,%rax
+  803e44:	00 00 00 
+  803e47:	ff d0                	call   *%rax
+  803e49:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803e4c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803e51:	89 c1                	mov    %eax,%ecx
+  803e53:	83 c9 04             	or     $0x4,%ecx
+  803e56:	f6 c2 01             	test   $0x1,%dl
+  803e59:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803e5c:	89 c1                	mov    %eax,%ecx
+  803e5e:	83 c9 02             	or     $0x2,%ecx
+  803e61:	f6 c2 02             	test   $0x2,%dl
+  803e64:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803e67:	89 c1                	mov    %eax,%ecx
+  803e69:	83 c9 01             	or     $0x1,%ecx
+  803e6c:	48 85 d2             	test   %rdx,%rdx
+  803e6f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803e72:	89 c1                	mov    %eax,%ecx
+  803e74:	83 c9 40             	or     $0x40,%ecx
+  803e77:	f6 c6 04             	test   $0x4,%dh
+  803e7a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803e7d:	5d                   	pop    %rbp
+  803e7e:	c3                   	ret
+
+0000000000803e7f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803e7f:	55                   	push   %rbp
+  803e80:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803e83:	48 b8 85 3d 80 00 00 	movabs $0x803d85,%rax
+  803e8a:	00 00 00 
+  803e8d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803e8f:	48 c1 e8 06          	shr    $0x6,%rax
+  803e93:	83 e0 01             	and    $0x1,%eax
+}
+  803e96:	5d                   	pop    %rbp
+  803e97:	c3                   	ret
+
+0000000000803e98 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803e98:	55                   	push   %rbp
+  803e99:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803e9c:	48 b8 85 3d 80 00 00 	movabs $0x803d85,%rax
+  803ea3:	00 00 00 
+  803ea6:	ff d0                	call   *%rax
+  803ea8:	83 e0 01             	and    $0x1,%eax
+}
+  803eab:	5d                   	pop    %rbp
+  803eac:	c3                   	ret
+
+0000000000803ead <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803ead:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803eb4:	01 00 00 
+  803eb7:	a8 01                	test   $0x1,%al
+  803eb9:	75 06                	jne    803ec1 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803ebb:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ec0:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803ec1:	55                   	push   %rbp
+  803ec2:	48 89 e5             	mov    %rsp,%rbp
+  803ec5:	41 57                	push   %r15
+  803ec7:	41 56                	push   %r14
+  803ec9:	41 55                	push   %r13
+  803ecb:	41 54                	push   %r12
+  803ecd:	53                   	push   %rbx
+  803ece:	48 83 ec 28          	sub    $0x28,%rsp
+  803ed2:	49 89 fe             	mov    %rdi,%r14
+  803ed5:	49 89 f7             	mov    %rsi,%r15
+  803ed8:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803edf:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803ee0:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803ee7:	01 00 00 
+  803eea:	e9 ae 00 00 00       	jmp    803f9d <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803eef:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803ef6:	49 83 ec 01          	sub    $0x1,%r12
+  803efa:	74 2d                	je     803f29 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803efc:	48 89 d8             	mov    %rbx,%rax
+  803eff:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f03:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803f08:	f6 c2 01             	test   $0x1,%dl
+  803f0b:	74 e2                	je     803eef <foreach_shared_region+0x42>
+  803f0d:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f12:	f6 c4 04             	test   $0x4,%ah
+  803f15:	74 d8                	je     803eef <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803f17:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f1e:	4c 89 fa             	mov    %r15,%rdx
+  803f21:	48 89 df             	mov    %rbx,%rdi
+  803f24:	41 ff d6             	call   *%r14
+  803f27:	eb c6                	jmp    803eef <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f29:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803f30:	00 
+  803f31:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803f36:	74 4a                	je     803f82 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803f38:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803f3c:	48 c1 e8 15          	shr    $0x15,%rax
+  803f40:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803f47:	01 00 00 
+  803f4a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803f4e:	a8 01                	test   $0x1,%al
+  803f50:	74 d7                	je     803f29 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f52:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803f56:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803f5d:	48 39 c3             	cmp    %rax,%rbx
+  803f60:	73 c7                	jae    803f29 <foreach_shared_region+0x7c>
+  803f62:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803f69:	48 39 d0             	cmp    %rdx,%rax
+  803f6c:	4d 19 e4             	sbb    %r12,%r12
+  803f6f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803f76:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803f7d:	e9 7a ff ff ff       	jmp    803efc <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803f82:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803f89:	40 
+  803f8a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803f8e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803f95:	00 00 00 
+  803f98:	48 39 c1             	cmp    %rax,%rcx
+  803f9b:	74 50                	je     803fed <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803f9d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803fa1:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fa5:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803fac:	01 00 00 
+  803faf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fb3:	a8 01                	test   $0x1,%al
+  803fb5:	74 cb                	je     803f82 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803fb7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803fbb:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803fc2:	48 39 c1             	cmp    %rax,%rcx
+  803fc5:	73 bb                	jae    803f82 <foreach_shared_region+0xd5>
+  803fc7:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803fce:	48 39 d0             	cmp    %rdx,%rax
+  803fd1:	48 19 c0             	sbb    %rax,%rax
+  803fd4:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803fda:	48 05 00 02 00 00    	add    $0x200,%rax
+  803fe0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fe4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803fe8:	e9 4b ff ff ff       	jmp    803f38 <foreach_shared_region+0x8b>
+  803fed:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ff2:	48 83 c4 28          	add    $0x28,%rsp
+  803ff6:	5b                   	pop    %rbx
+  803ff7:	41 5c                	pop    %r12
+  803ff9:	41 5d                	pop    %r13
+  803ffb:	41 5e                	pop    %r14
+  803ffd:	41 5f                	pop    %r15
+  803fff:	5d                   	pop    %rbp
+  804000:	c3                   	ret
+
+0000000000804001 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804001:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804007:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80400e:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804015:	c3                   	ret
+
+0000000000804016 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804016:	8b 47 40             	mov    0x40(%rdi),%eax
+  804019:	8b 17                	mov    (%rdi),%edx
+  80401b:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80401d:	83 f8 0f             	cmp    $0xf,%eax
+  804020:	77 13                	ja     804035 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804022:	8b 47 40             	mov    0x40(%rdi),%eax
+  804025:	83 e0 0f             	and    $0xf,%eax
+  804028:	48 c1 e0 09          	shl    $0x9,%rax
+  80402c:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804033:	00 
+  804034:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804035:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80403a:	c3                   	ret
+
+000000000080403b <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80403b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80403e:	83 c0 01             	add    $0x1,%eax
+  804041:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804044:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80404a:	8b 57 04             	mov    0x4(%rdi),%edx
+  80404d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804052:	85 d2                	test   %edx,%edx
+  804054:	75 04                	jne    80405a <chan_publish+0x1f>
+  804056:	83 e0 01             	and    $0x1,%eax
+}
+  804059:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80405a:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80405d:	85 c0                	test   %eax,%eax
+  80405f:	0f 95 c0             	setne  %al
+  804062:	0f b6 c0             	movzbl %al,%eax
+  804065:	eb ef                	jmp    804056 <chan_publish+0x1b>
+
+0000000000804067 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804067:	8b 47 40             	mov    0x40(%rdi),%eax
+  80406a:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80406c:	29 d0                	sub    %edx,%eax
+  80406e:	83 e8 01             	sub    $0x1,%eax
+  804071:	83 f8 0f             	cmp    $0xf,%eax
+  804074:	77 12                	ja     804088 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804076:	8b 07                	mov    (%rdi),%eax
+  804078:	83 e0 0f             	and    $0xf,%eax
+  80407b:	48 c1 e0 09          	shl    $0x9,%rax
+  80407f:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804086:	00 
+  804087:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804088:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80408d:	c3                   	ret
+
+000000000080408e <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80408e:	8b 07                	mov    (%rdi),%eax
+  804090:	83 c0 01             	add    $0x1,%eax
+  804093:	89 07                	mov    %eax,(%rdi)
+}
+  804095:	c3                   	ret
+
+0000000000804096 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804096:	55                   	push   %rbp
+  804097:	48 89 e5             	mov    %rsp,%rbp
+  80409a:	53                   	push   %rbx
+  80409b:	48 83 ec 08          	sub    $0x8,%rsp
+  80409f:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8040a2:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040a9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8040af:	48 b8 67 40 80 00 00 	movabs $0x804067,%rax
+  8040b6:	00 00 00 
+  8040b9:	ff d0                	call   *%rax
+  8040bb:	48 85 c0             	test   %rax,%rax
+  8040be:	74 12                	je     8040d2 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8040c0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8040c7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040cc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8040d0:	c9                   	leave
+  8040d1:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8040d2:	b8 01 00 00 00       	mov    $0x1,%eax
+  8040d7:	eb f3                	jmp    8040cc <chan_arm+0x36>
+
+00000000008040d9 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8040d9:	55                   	push   %rbp
+  8040da:	48 89 e5             	mov    %rsp,%rbp
+  8040dd:	41 56                	push   %r14
+  8040df:	41 55                	push   %r13
+  8040e1:	41 54                	push   %r12
+  8040e3:	53                   	push   %rbx
+  8040e4:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8040e7:	49 bc 96 40 80 00 00 	movabs $0x804096,%r12
+  8040ee:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8040f1:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8040f5:	49 bd 97 14 80 00 00 	movabs $0x801497,%r13
+  8040fc:	00 00 00 
+    while (chan_arm(r))
+  8040ff:	eb 0d                	jmp    80410e <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804101:	8b 33                	mov    (%rbx),%esi
+  804103:	ba 00 00 00 00       	mov    $0x0,%edx
+  804108:	4c 89 f7             	mov    %r14,%rdi
+  80410b:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80410e:	48 89 df             	mov    %rbx,%rdi
+  804111:	41 ff d4             	call   *%r12
+  804114:	84 c0                	test   %al,%al
+  804116:	75 e9                	jne    804101 <chan_wait+0x28>
+}
+  804118:	5b                   	pop    %rbx
+  804119:	41 5c                	pop    %r12
+  80411b:	41 5d                	pop    %r13
+  80411d:	41 5e                	pop    %r14
+  80411f:	5d                   	pop    %rbp
+  804120:	c3                   	ret
+
+0000000000804121 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804121:	55                   	push   %rbp
+  804122:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804125:	48 83 c7 40          	add    $0x40,%rdi
+  804129:	be 01 00 00 00       	mov    $0x1,%esi
+  80412e:	48 b8 b5 14 80 00 00 	movabs $0x8014b5,%rax
+  804135:	00 00 00 
+  804138:	ff d0                	call   *%rax
+}
+  80413a:	5d                   	pop    %rbp
+  80413b:	c3                   	ret
+
+000000000080413c <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80413c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804141:	c3                   	ret
+
+0000000000804142 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804142:	55                   	push   %rbp
+  804143:	48 89 e5             	mov    %rsp,%rbp
+  804146:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804149:	48 be 74 4f 80 00 00 	movabs $0x804f74,%rsi
+  804150:	00 00 00 
+  804153:	48 b8 ca 0b 80 00 00 	movabs $0x800bca,%rax
+  80415a:	00 00 00 
+  80415d:	ff d0                	call   *%rax
+    return 0;
+}
+  80415f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804164:	5d                   	pop    %rbp
+  804165:	c3                   	ret
+
+0000000000804166 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804166:	55                   	push   %rbp
+  804167:	48 89 e5             	mov    %rsp,%rbp
+  80416a:	41 57                	push   %r15
+  80416c:	41 56                	push   %r14
+  80416e:	41 55                	push   %r13
+  804170:	41 54                	push   %r12
+  804172:	53                   	push   %rbx
+  804173:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80417a:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804181:	48 85 d2             	test   %rdx,%rdx
+  804184:	74 7a                	je     804200 <devcons_write+0x9a>
+  804186:	49 89 d6             	mov    %rdx,%r14
+  804189:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80418f:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804194:	49 bf c4 0d 80 00 00 	movabs $0x800dc4,%r15
+  80419b:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80419e:	4c 89 f3             	mov    %r14,%rbx
+  8041a1:	48 29 f3             	sub    %rsi,%rbx
+  8041a4:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8041a9:	48 39 c3             	cmp    %rax,%rbx
+  8041ac:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8041b0:	4c 63 eb             	movslq %ebx,%r13
+  8041b3:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8041ba:	48 01 c6             	add    %rax,%rsi
+  8041bd:	4c 89 ea             	mov    %r13,%rdx
+  8041c0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041c7:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8041ca:	4c 89 ee             	mov    %r13,%rsi
+  8041cd:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8041d4:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  8041db:	00 00 00 
+  8041de:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8041e0:	41 01 dc             	add    %ebx,%r12d
+  8041e3:	49 63 f4             	movslq %r12d,%rsi
+  8041e6:	4c 39 f6             	cmp    %r14,%rsi
+  8041e9:	72 b3                	jb     80419e <devcons_write+0x38>
+    return res;
+  8041eb:	49 63 c4             	movslq %r12d,%rax
+}
+  8041ee:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8041f5:	5b                   	pop    %rbx
+  8041f6:	41 5c                	pop    %r12
+  8041f8:	41 5d                	pop    %r13
+  8041fa:	41 5e                	pop    %r14
+  8041fc:	41 5f                	pop    %r15
+  8041fe:	5d                   	pop    %rbp
+  8041ff:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804200:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804206:	eb e3                	jmp    8041eb <devcons_write+0x85>
+
+0000000000804208 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804208:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80420b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804210:	48 85 c0             	test   %rax,%rax
+  804213:	74 55                	je     80426a <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804215:	55                   	push   %rbp
+  804216:	48 89 e5             	mov    %rsp,%rbp
+  804219:	41 55                	push   %r13
+  80421b:	41 54                	push   %r12
+  80421d:	53                   	push   %rbx
+  80421e:	48 83 ec 08          	sub    $0x8,%rsp
+  804222:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804225:	48 bb 10 10 80 00 00 	movabs $0x801010,%rbx
+  80422c:	00 00 00 
+  80422f:	49 bc c5 10 80 00 00 	movabs $0x8010c5,%r12
+  804236:	00 00 00 
+  804239:	eb 03                	jmp    80423e <devcons_read+0x36>
+  80423b:	41 ff d4             	call   *%r12
+  80423e:	ff d3                	call   *%rbx
+  804240:	85 c0                	test   %eax,%eax
+  804242:	74 f7                	je     80423b <devcons_read+0x33>
+    if (c < 0) return c;
+  804244:	48 63 d0             	movslq %eax,%rdx
+  804247:	78 13                	js     80425c <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804249:	ba 00 00 00 00       	mov    $0x0,%edx
+  80424e:	83 f8 04             	cmp    $0x4,%eax
+  804251:	74 09                	je     80425c <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804253:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804257:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80425c:	48 89 d0             	mov    %rdx,%rax
+  80425f:	48 83 c4 08          	add    $0x8,%rsp
+  804263:	5b                   	pop    %rbx
+  804264:	41 5c                	pop    %r12
+  804266:	41 5d                	pop    %r13
+  804268:	5d                   	pop    %rbp
+  804269:	c3                   	ret
+  80426a:	48 89 d0             	mov    %rdx,%rax
+  80426d:	c3                   	ret
+
+000000000080426e <cputchar>:
+cputchar(int ch) {
+  80426e:	55                   	push   %rbp
+  80426f:	48 89 e5             	mov    %rsp,%rbp
+  804272:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804276:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80427a:	be 01 00 00 00       	mov    $0x1,%esi
+  80427f:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804283:	48 b8 f1 0f 80 00 00 	movabs $0x800ff1,%rax
+  80428a:	00 00 00 
+  80428d:	ff d0                	call   *%rax
+}
+  80428f:	c9                   	leave
+  804290:	c3                   	ret
+
+0000000000804291 <getchar>:
+getchar(void) {
+  804291:	55                   	push   %rbp
+  804292:	48 89 e5             	mov    %rsp,%rbp
+  804295:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804299:	ba 01 00 00 00       	mov    $0x1,%edx
+  80429e:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8042a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042a7:	48 b8 ed 19 80 00 00 	movabs $0x8019ed,%rax
+  8042ae:	00 00 00 
+  8042b1:	ff d0                	call   *%rax
+  8042b3:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8042b5:	85 c0                	test   %eax,%eax
+  8042b7:	78 06                	js     8042bf <getchar+0x2e>
+  8042b9:	74 08                	je     8042c3 <getchar+0x32>
+  8042bb:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8042bf:	89 d0                	mov    %edx,%eax
+  8042c1:	c9                   	leave
+  8042c2:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8042c3:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8042c8:	eb f5                	jmp    8042bf <getchar+0x2e>
+
+00000000008042ca <iscons>:
+iscons(int fdnum) {
+  8042ca:	55                   	push   %rbp
+  8042cb:	48 89 e5             	mov    %rsp,%rbp
+  8042ce:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8042d2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8042d6:	48 b8 0a 17 80 00 00 	movabs $0x80170a,%rax
+  8042dd:	00 00 00 
+  8042e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8042e2:	85 c0                	test   %eax,%eax
+  8042e4:	78 18                	js     8042fe <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8042e6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8042ea:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8042f1:	00 00 00 
+  8042f4:	8b 00                	mov    (%rax),%eax
+  8042f6:	39 02                	cmp    %eax,(%rdx)
+  8042f8:	0f 94 c0             	sete   %al
+  8042fb:	0f b6 c0             	movzbl %al,%eax
+}
+  8042fe:	c9                   	leave
+  8042ff:	c3                   	ret
+
+0000000000804300 <opencons>:
+opencons(void) {
+  804300:	55                   	push   %rbp
+  804301:	48 89 e5             	mov    %rsp,%rbp
+  804304:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804308:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80430c:	48 b8 aa 16 80 00 00 	movabs $0x8016aa,%rax
+  804313:	00 00 00 
+  804316:	ff d0                	call   *%rax
+  804318:	85 c0                	test   %eax,%eax
+  80431a:	78 49                	js     804365 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80431c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804321:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804326:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80432a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80432f:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+  80433b:	85 c0                	test   %eax,%eax
+  80433d:	78 26                	js     804365 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80433f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804343:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80434a:	00 00 
+  80434c:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80434e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804352:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804359:	48 b8 7c 16 80 00 00 	movabs $0x80167c,%rax
+  804360:	00 00 00 
+  804363:	ff d0                	call   *%rax
+}
+  804365:	c9                   	leave
+  804366:	c3                   	ret
+
+0000000000804367 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804367:	55                   	push   %rbp
+  804368:	48 89 e5             	mov    %rsp,%rbp
+  80436b:	41 56                	push   %r14
+  80436d:	41 55                	push   %r13
+  80436f:	41 54                	push   %r12
+  804371:	53                   	push   %rbx
+  804372:	48 83 ec 50          	sub    $0x50,%rsp
+  804376:	49 89 fc             	mov    %rdi,%r12
+  804379:	41 89 f5             	mov    %esi,%r13d
+  80437c:	48 89 d3             	mov    %rdx,%rbx
+  80437f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804383:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804387:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80438b:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804392:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804396:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80439a:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80439e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8043a2:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8043a9:	00 00 00 
+  8043ac:	4c 8b 30             	mov    (%rax),%r14
+  8043af:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  8043b6:	00 00 00 
+  8043b9:	ff d0                	call   *%rax
+  8043bb:	89 c6                	mov    %eax,%esi
+  8043bd:	45 89 e8             	mov    %r13d,%r8d
+  8043c0:	4c 89 e1             	mov    %r12,%rcx
+  8043c3:	4c 89 f2             	mov    %r14,%rdx
+  8043c6:	48 bf 80 4f 80 00 00 	movabs $0x804f80,%rdi
+  8043cd:	00 00 00 
+  8043d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d5:	49 bc a5 02 80 00 00 	movabs $0x8002a5,%r12
+  8043dc:	00 00 00 
+  8043df:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8043e2:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8043e6:	48 89 df             	mov    %rbx,%rdi
+  8043e9:	48 b8 41 02 80 00 00 	movabs $0x800241,%rax
+  8043f0:	00 00 00 
+  8043f3:	ff d0                	call   *%rax
+    cprintf("\n");
+  8043f5:	48 bf af 48 80 00 00 	movabs $0x8048af,%rdi
+  8043fc:	00 00 00 
+  8043ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804404:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804407:	cc                   	int3
+  804408:	eb fd                	jmp    804407 <_panic+0xa0>
+
+000000000080440a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80440a:	55                   	push   %rbp
+  80440b:	48 89 e5             	mov    %rsp,%rbp
+  80440e:	41 56                	push   %r14
+  804410:	41 55                	push   %r13
+  804412:	41 54                	push   %r12
+  804414:	53                   	push   %rbx
+  804415:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804418:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80441f:	00 00 00 
+  804422:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804426:	74 27                	je     80444f <_handle_vectored_pagefault+0x45>
+  804428:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80442d:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804434:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804437:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80443a:	4c 89 e7             	mov    %r12,%rdi
+  80443d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804442:	84 c0                	test   %al,%al
+  804444:	75 45                	jne    80448b <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804446:	48 83 c3 01          	add    $0x1,%rbx
+  80444a:	49 3b 1e             	cmp    (%r14),%rbx
+  80444d:	72 eb                	jb     80443a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80444f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804456:	00 
+  804457:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80445c:	4d 8b 04 24          	mov    (%r12),%r8
+  804460:	48 ba a8 4f 80 00 00 	movabs $0x804fa8,%rdx
+  804467:	00 00 00 
+  80446a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80446f:	48 bf d8 4f 80 00 00 	movabs $0x804fd8,%rdi
+  804476:	00 00 00 
+  804479:	b8 00 00 00 00       	mov    $0x0,%eax
+  80447e:	49 ba 67 43 80 00 00 	movabs $0x804367,%r10
+  804485:	00 00 00 
+  804488:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80448b:	5b                   	pop    %rbx
+  80448c:	41 5c                	pop    %r12
+  80448e:	41 5d                	pop    %r13
+  804490:	41 5e                	pop    %r14
+  804492:	5d                   	pop    %rbp
+  804493:	c3                   	ret
+
+0000000000804494 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804494:	55                   	push   %rbp
+  804495:	48 89 e5             	mov    %rsp,%rbp
+  804498:	53                   	push   %rbx
+  804499:	48 83 ec 08          	sub    $0x8,%rsp
+  80449d:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8044a0:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8044a7:	00 00 00 
+  8044aa:	80 38 00             	cmpb   $0x0,(%rax)
+  8044ad:	0f 84 84 00 00 00    	je     804537 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044b3:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044ba:	00 00 00 
+  8044bd:	48 8b 10             	mov    (%rax),%rdx
+  8044c0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8044c5:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8044cc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044cf:	48 85 d2             	test   %rdx,%rdx
+  8044d2:	74 19                	je     8044ed <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8044d4:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8044d8:	0f 84 e8 00 00 00    	je     8045c6 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044de:	48 83 c0 01          	add    $0x1,%rax
+  8044e2:	48 39 d0             	cmp    %rdx,%rax
+  8044e5:	75 ed                	jne    8044d4 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8044e7:	48 83 fa 08          	cmp    $0x8,%rdx
+  8044eb:	74 1c                	je     804509 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8044ed:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8044f1:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8044f8:	00 00 00 
+  8044fb:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804502:	00 00 00 
+  804505:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804509:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  804510:	00 00 00 
+  804513:	ff d0                	call   *%rax
+  804515:	89 c7                	mov    %eax,%edi
+  804517:	48 be 8c 46 80 00 00 	movabs $0x80468c,%rsi
+  80451e:	00 00 00 
+  804521:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  804528:	00 00 00 
+  80452b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80452d:	85 c0                	test   %eax,%eax
+  80452f:	78 68                	js     804599 <add_pgfault_handler+0x105>
+    return res;
+}
+  804531:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804535:	c9                   	leave
+  804536:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804537:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  80453e:	00 00 00 
+  804541:	ff d0                	call   *%rax
+  804543:	89 c7                	mov    %eax,%edi
+  804545:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80454a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80454f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804556:	00 00 00 
+  804559:	48 b8 29 11 80 00 00 	movabs $0x801129,%rax
+  804560:	00 00 00 
+  804563:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804565:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80456c:	00 00 00 
+  80456f:	48 8b 02             	mov    (%rdx),%rax
+  804572:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804576:	48 89 0a             	mov    %rcx,(%rdx)
+  804579:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804580:	00 00 00 
+  804583:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804587:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80458e:	00 00 00 
+  804591:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804594:	e9 70 ff ff ff       	jmp    804509 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804599:	89 c1                	mov    %eax,%ecx
+  80459b:	48 ba e6 4f 80 00 00 	movabs $0x804fe6,%rdx
+  8045a2:	00 00 00 
+  8045a5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8045aa:	48 bf d8 4f 80 00 00 	movabs $0x804fd8,%rdi
+  8045b1:	00 00 00 
+  8045b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b9:	49 b8 67 43 80 00 00 	movabs $0x804367,%r8
+  8045c0:	00 00 00 
+  8045c3:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8045c6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045cb:	e9 61 ff ff ff       	jmp    804531 <add_pgfault_handler+0x9d>
+
+00000000008045d0 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8045d0:	55                   	push   %rbp
+  8045d1:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8045d4:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8045db:	00 00 00 
+  8045de:	80 38 00             	cmpb   $0x0,(%rax)
+  8045e1:	74 33                	je     804616 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8045e3:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8045ea:	00 00 00 
+  8045ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8045f2:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8045f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8045fc:	48 85 c0             	test   %rax,%rax
+  8045ff:	0f 84 85 00 00 00    	je     80468a <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804605:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804609:	74 40                	je     80464b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80460b:	48 83 c1 01          	add    $0x1,%rcx
+  80460f:	48 39 c1             	cmp    %rax,%rcx
+  804612:	75 f1                	jne    804605 <remove_pgfault_handler+0x35>
+  804614:	eb 74                	jmp    80468a <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804616:	48 b9 fe 4f 80 00 00 	movabs $0x804ffe,%rcx
+  80461d:	00 00 00 
+  804620:	48 ba 27 4f 80 00 00 	movabs $0x804f27,%rdx
+  804627:	00 00 00 
+  80462a:	be 43 00 00 00       	mov    $0x43,%esi
+  80462f:	48 bf d8 4f 80 00 00 	movabs $0x804fd8,%rdi
+  804636:	00 00 00 
+  804639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463e:	49 b8 67 43 80 00 00 	movabs $0x804367,%r8
+  804645:	00 00 00 
+  804648:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80464b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804652:	00 
+  804653:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804657:	48 29 ca             	sub    %rcx,%rdx
+  80465a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804661:	00 00 00 
+  804664:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804668:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80466d:	48 89 ce             	mov    %rcx,%rsi
+  804670:	48 b8 c4 0d 80 00 00 	movabs $0x800dc4,%rax
+  804677:	00 00 00 
+  80467a:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80467c:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804683:	00 00 00 
+  804686:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80468a:	5d                   	pop    %rbp
+  80468b:	c3                   	ret
+
+000000000080468c <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80468c:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80468f:	48 b8 0a 44 80 00 00 	movabs $0x80440a,%rax
+  804696:	00 00 00 
+    call *%rax
+  804699:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80469b:	41 5f                	pop    %r15
+	popq %r15
+  80469d:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80469f:	41 5f                	pop    %r15
+	popq %r14
+  8046a1:	41 5e                	pop    %r14
+	popq %r13
+  8046a3:	41 5d                	pop    %r13
+	popq %r12
+  8046a5:	41 5c                	pop    %r12
+	popq %r11
+  8046a7:	41 5b                	pop    %r11
+	popq %r10
+  8046a9:	41 5a                	pop    %r10
+	popq %r9
+  8046ab:	41 59                	pop    %r9
+	popq %r8
+  8046ad:	41 58                	pop    %r8
+	popq %rsi
+  8046af:	5e                   	pop    %rsi
+	popq %rdi
+  8046b0:	5f                   	pop    %rdi
+	popq %rbp
+  8046b1:	5d                   	pop    %rbp
+	popq %rdx
+  8046b2:	5a                   	pop    %rdx
+	popq %rcx
+  8046b3:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8046b4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8046b9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8046be:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8046c2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8046c5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8046ca:	5b                   	pop    %rbx
+	popq %rax
+  8046cb:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8046cc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8046d0:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8046d1:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8046d6:	c3                   	ret
+
+00000000008046d7 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8046d7:	55                   	push   %rbp
+  8046d8:	48 89 e5             	mov    %rsp,%rbp
+  8046db:	41 55                	push   %r13
+  8046dd:	41 54                	push   %r12
+  8046df:	53                   	push   %rbx
+  8046e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8046e4:	49 89 fd             	mov    %rdi,%r13
+  8046e7:	48 89 f7             	mov    %rsi,%rdi
+  8046ea:	48 89 d3             	mov    %rdx,%rbx
+  8046ed:	49 89 cc             	mov    %rcx,%r12
+  8046f0:	4c 89 c2             	mov    %r8,%rdx
+  8046f3:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8046f6:	48 85 f6             	test   %rsi,%rsi
+  8046f9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804700:	00 00 00 
+  804703:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804707:	be 00 10 00 00       	mov    $0x1000,%esi
+  80470c:	48 85 db             	test   %rbx,%rbx
+  80470f:	74 03                	je     804714 <ipc_recv_futex+0x3d>
+  804711:	48 8b 33             	mov    (%rbx),%rsi
+  804714:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804718:	48 b8 73 13 80 00 00 	movabs $0x801373,%rax
+  80471f:	00 00 00 
+  804722:	ff d0                	call   *%rax
+    if (res < 0) {
+  804724:	85 c0                	test   %eax,%eax
+  804726:	78 75                	js     80479d <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804728:	4d 85 ed             	test   %r13,%r13
+  80472b:	74 14                	je     804741 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80472d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804734:	00 00 00 
+  804737:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80473d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804741:	4d 85 e4             	test   %r12,%r12
+  804744:	74 14                	je     80475a <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804746:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80474d:	00 00 00 
+  804750:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804756:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80475a:	48 85 db             	test   %rbx,%rbx
+  80475d:	74 23                	je     804782 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80475f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804766:	00 00 00 
+  804769:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80476f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804774:	85 c9                	test   %ecx,%ecx
+  804776:	74 07                	je     80477f <ipc_recv_futex+0xa8>
+  804778:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80477f:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804782:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804789:	00 00 00 
+  80478c:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804792:	48 83 c4 08          	add    $0x8,%rsp
+  804796:	5b                   	pop    %rbx
+  804797:	41 5c                	pop    %r12
+  804799:	41 5d                	pop    %r13
+  80479b:	5d                   	pop    %rbp
+  80479c:	c3                   	ret
+        if (from_env_store != NULL) {
+  80479d:	4d 85 ed             	test   %r13,%r13
+  8047a0:	74 08                	je     8047aa <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8047a2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8047a9:	00 
+        if (perm_store != NULL) {
+  8047aa:	4d 85 e4             	test   %r12,%r12
+  8047ad:	74 08                	je     8047b7 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8047af:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8047b6:	00 
+        if (size != NULL) {
+  8047b7:	48 85 db             	test   %rbx,%rbx
+  8047ba:	74 d6                	je     804792 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8047bc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8047c3:	eb cd                	jmp    804792 <ipc_recv_futex+0xbb>
+
+00000000008047c5 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8047c5:	55                   	push   %rbp
+  8047c6:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8047c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8047cd:	6a 00                	push   $0x0
+  8047cf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8047d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8047db:	48 b8 d7 46 80 00 00 	movabs $0x8046d7,%rax
+  8047e2:	00 00 00 
+  8047e5:	ff d0                	call   *%rax
+}
+  8047e7:	c9                   	leave
+  8047e8:	c3                   	ret
+
+00000000008047e9 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8047e9:	55                   	push   %rbp
+  8047ea:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8047ed:	48 85 d2             	test   %rdx,%rdx
+  8047f0:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047f7:	00 00 00 
+  8047fa:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8047fe:	89 f6                	mov    %esi,%esi
+  804800:	48 b8 5c 13 80 00 00 	movabs $0x80135c,%rax
+  804807:	00 00 00 
+  80480a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80480c:	85 c0                	test   %eax,%eax
+  80480e:	78 02                	js     804812 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804810:	5d                   	pop    %rbp
+  804811:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804812:	89 c1                	mov    %eax,%ecx
+  804814:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  80481b:	00 00 00 
+  80481e:	be 50 00 00 00       	mov    $0x50,%esi
+  804823:	48 bf 2c 50 80 00 00 	movabs $0x80502c,%rdi
+  80482a:	00 00 00 
+  80482d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804832:	49 b8 67 43 80 00 00 	movabs $0x804367,%r8
+  804839:	00 00 00 
+  80483c:	41 ff d0             	call   *%r8
+
+000000000080483f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80483f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804844:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80484b:	00 00 00 
+  80484e:	48 89 d0             	mov    %rdx,%rax
+  804851:	48 c1 e0 04          	shl    $0x4,%rax
+  804855:	48 29 d0             	sub    %rdx,%rax
+  804858:	48 c1 e0 05          	shl    $0x5,%rax
+  80485c:	48 01 c8             	add    %rcx,%rax
+  80485f:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804865:	39 f8                	cmp    %edi,%eax
+  804867:	74 13                	je     80487c <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804869:	48 83 c2 01          	add    $0x1,%rdx
+  80486d:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804874:	75 d8                	jne    80484e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804876:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80487b:	c3                   	ret
+            return envs[i].env_id;
+  80487c:	48 89 d0             	mov    %rdx,%rax
+  80487f:	48 c1 e0 04          	shl    $0x4,%rax
+  804883:	48 29 d0             	sub    %rdx,%rax
+  804886:	48 c1 e0 05          	shl    $0x5,%rax
+  80488a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804891:	00 00 00 
+  804894:	48 01 d0             	add    %rdx,%rax
+  804897:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80489d:	c3                   	ret
+  80489e:	66 90                	xchg   %ax,%ax
+
+00000000008048a0 <__rodata_start>:
+  8048a0:	25 30 34 78 3a       	and    $0x3a783430,%eax
+  8048a5:	20 49 20             	and    %cl,0x20(%rcx)
+  8048a8:	61                   	(bad)
+  8048a9:	6d                   	insl   (%dx),%es:(%rdi)
+  8048aa:	20 27                	and    %ah,(%rdi)
+  8048ac:	25 73 27 0a 00       	and    $0xa2773,%eax
+  8048b1:	25 73 25 63 00       	and    $0x632573,%eax
+  8048b6:	3c 75                	cmp    $0x75,%al
+  8048b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048b9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8048bd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048be:	3e 00 30             	ds add %dh,(%rax)
+  8048c1:	31 32                	xor    %esi,(%rdx)
+  8048c3:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048ca:	41                   	rex.B
+  8048cb:	42                   	rex.X
+  8048cc:	43                   	rex.XB
+  8048cd:	44                   	rex.R
+  8048ce:	45                   	rex.RB
+  8048cf:	46 00 30             	rex.RX add %r14b,(%rax)
+  8048d2:	31 32                	xor    %esi,(%rdx)
+  8048d4:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048db:	61                   	(bad)
+  8048dc:	62 63 64 65 66       	(bad)
+  8048e1:	00 28                	add    %ch,(%rax)
+  8048e3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e4:	75 6c                	jne    804952 <__rodata_start+0xb2>
+  8048e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8048e7:	29 00                	sub    %eax,(%rax)
+  8048e9:	65 72 72             	gs jb  80495e <__rodata_start+0xbe>
+  8048ec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048ed:	72 20                	jb     80490f <__rodata_start+0x6f>
+  8048ef:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8048f4:	73 70                	jae    804966 <__rodata_start+0xc6>
+  8048f6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8048fa:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804901:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804902:	72 00                	jb     804904 <__rodata_start+0x64>
+  804904:	62 61 64 20 65       	(bad)
+  804909:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490a:	76 69                	jbe    804975 <__rodata_start+0xd5>
+  80490c:	72 6f                	jb     80497d <__rodata_start+0xdd>
+  80490e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490f:	6d                   	insl   (%dx),%es:(%rdi)
+  804910:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804912:	74 00                	je     804914 <__rodata_start+0x74>
+  804914:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80491b:	20 70 61             	and    %dh,0x61(%rax)
+  80491e:	72 61                	jb     804981 <__rodata_start+0xe1>
+  804920:	6d                   	insl   (%dx),%es:(%rdi)
+  804921:	65 74 65             	gs je  804989 <__rodata_start+0xe9>
+  804924:	72 00                	jb     804926 <__rodata_start+0x86>
+  804926:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804927:	75 74                	jne    80499d <__rodata_start+0xfd>
+  804929:	20 6f 66             	and    %ch,0x66(%rdi)
+  80492c:	20 6d 65             	and    %ch,0x65(%rbp)
+  80492f:	6d                   	insl   (%dx),%es:(%rdi)
+  804930:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804931:	72 79                	jb     8049ac <__rodata_start+0x10c>
+  804933:	00 6f 75             	add    %ch,0x75(%rdi)
+  804936:	74 20                	je     804958 <__rodata_start+0xb8>
+  804938:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804939:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80493d:	76 69                	jbe    8049a8 <__rodata_start+0x108>
+  80493f:	72 6f                	jb     8049b0 <__rodata_start+0x110>
+  804941:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804942:	6d                   	insl   (%dx),%es:(%rdi)
+  804943:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804945:	74 73                	je     8049ba <__rodata_start+0x11a>
+  804947:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80494a:	72 72                	jb     8049be <__rodata_start+0x11e>
+  80494c:	75 70                	jne    8049be <__rodata_start+0x11e>
+  80494e:	74 65                	je     8049b5 <__rodata_start+0x115>
+  804950:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804955:	75 67                	jne    8049be <__rodata_start+0x11e>
+  804957:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80495a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80495c:	00 73 65             	add    %dh,0x65(%rbx)
+  80495f:	67 6d                	insl   (%dx),%es:(%edi)
+  804961:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804963:	74 61                	je     8049c6 <__rodata_start+0x126>
+  804965:	74 69                	je     8049d0 <__rodata_start+0x130>
+  804967:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804968:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804969:	20 66 61             	and    %ah,0x61(%rsi)
+  80496c:	75 6c                	jne    8049da <__rodata_start+0x13a>
+  80496e:	74 00                	je     804970 <__rodata_start+0xd0>
+  804970:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804977:	20 45 4c             	and    %al,0x4c(%rbp)
+  80497a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  80497e:	61                   	(bad)
+  80497f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804984:	20 73 75             	and    %dh,0x75(%rbx)
+  804987:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80498a:	73 79                	jae    804a05 <__rodata_start+0x165>
+  80498c:	73 74                	jae    804a02 <__rodata_start+0x162>
+  80498e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804990:	20 63 61             	and    %ah,0x61(%rbx)
+  804993:	6c                   	insb   (%dx),%es:(%rdi)
+  804994:	6c                   	insb   (%dx),%es:(%rdi)
+  804995:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804998:	74 72                	je     804a0c <__rodata_start+0x16c>
+  80499a:	79 20                	jns    8049bc <__rodata_start+0x11c>
+  80499c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80499e:	74 20                	je     8049c0 <__rodata_start+0x120>
+  8049a0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049a2:	75 6e                	jne    804a12 <__rodata_start+0x172>
+  8049a4:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8049a8:	76 20                	jbe    8049ca <__rodata_start+0x12a>
+  8049aa:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8049b1:	72 65                	jb     804a18 <__rodata_start+0x178>
+  8049b3:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8049b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049b7:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8049bb:	65 78 70             	gs js  804a2e <__rodata_start+0x18e>
+  8049be:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8049c3:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8049c6:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8049ca:	20 66 69             	and    %ah,0x69(%rsi)
+  8049cd:	6c                   	insb   (%dx),%es:(%rdi)
+  8049ce:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8049d2:	20 66 72             	and    %ah,0x72(%rsi)
+  8049d5:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8049da:	61                   	(bad)
+  8049db:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8049de:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e0:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8049e4:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8049e7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e9:	20 6d 61             	and    %ch,0x61(%rbp)
+  8049ec:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ed:	79 20                	jns    804a0f <__rodata_start+0x16f>
+  8049ef:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8049f6:	72 65                	jb     804a5d <__rodata_start+0x1bd>
+  8049f8:	20 6f 70             	and    %ch,0x70(%rdi)
+  8049fb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049fd:	00 66 69             	add    %ah,0x69(%rsi)
+  804a00:	6c                   	insb   (%dx),%es:(%rdi)
+  804a01:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a05:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a09:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a0d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a0e:	74 20                	je     804a30 <__rodata_start+0x190>
+  804a10:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a12:	75 6e                	jne    804a82 <__rodata_start+0x1e2>
+  804a14:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804a18:	76 61                	jbe    804a7b <__rodata_start+0x1db>
+  804a1a:	6c                   	insb   (%dx),%es:(%rdi)
+  804a1b:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a22:	00 
+  804a23:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804a2a:	72 65                	jb     804a91 <__rodata_start+0x1f1>
+  804a2c:	61                   	(bad)
+  804a2d:	64 79 20             	fs jns 804a50 <__rodata_start+0x1b0>
+  804a30:	65 78 69             	gs js  804a9c <__rodata_start+0x1fc>
+  804a33:	73 74                	jae    804aa9 <__rodata_start+0x209>
+  804a35:	73 00                	jae    804a37 <__rodata_start+0x197>
+  804a37:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a38:	70 65                	jo     804a9f <__rodata_start+0x1ff>
+  804a3a:	72 61                	jb     804a9d <__rodata_start+0x1fd>
+  804a3c:	74 69                	je     804aa7 <__rodata_start+0x207>
+  804a3e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a3f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a40:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a43:	74 20                	je     804a65 <__rodata_start+0x1c5>
+  804a45:	73 75                	jae    804abc <__rodata_start+0x21c>
+  804a47:	70 70                	jo     804ab9 <__rodata_start+0x219>
+  804a49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a4a:	72 74                	jb     804ac0 <__rodata_start+0x220>
+  804a4c:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a52:	20 61 67             	and    %ah,0x67(%rcx)
+  804a55:	61                   	(bad)
+  804a56:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804a5d:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804a61:	74 00                	je     804a63 <__rodata_start+0x1c3>
+  804a63:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804a6a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a6d:	20 75 73             	and    %dh,0x73(%rbp)
+  804a70:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804a74:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804a7b:	00 
+  804a7c:	0f 1f 40 00          	nopl   0x0(%rax)
+  804a80:	92                   	xchg   %eax,%edx
+  804a81:	04 80                	add    $0x80,%al
+  804a83:	00 00                	add    %al,(%rax)
+  804a85:	00 00                	add    %al,(%rax)
+  804a87:	00 d3                	add    %dl,%bl
+  804a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a8f:	00 c3                	add    %al,%bl
+  804a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a97:	00 d3                	add    %dl,%bl
+  804a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a9f:	00 d3                	add    %dl,%bl
+  804aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aa7:	00 d3                	add    %dl,%bl
+  804aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aaf:	00 d3                	add    %dl,%bl
+  804ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ab7:	00 b1 04 80 00 00    	add    %dh,0x8004(%rcx)
+  804abd:	00 00                	add    %al,(%rax)
+  804abf:	00 d3                	add    %dl,%bl
+  804ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ac7:	00 d3                	add    %dl,%bl
+  804ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804acf:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  804ad5:	00 00                	add    %al,(%rax)
+  804ad7:	00 1f                	add    %bl,(%rdi)
+  804ad9:	05 80 00 00 00       	add    $0x80,%eax
+  804ade:	00 00                	add    %al,(%rax)
+  804ae0:	d3 0a                	rorl   %cl,(%rdx)
+  804ae2:	80 00 00             	addb   $0x0,(%rax)
+  804ae5:	00 00                	add    %al,(%rax)
+  804ae7:	00 a5 04 80 00 00    	add    %ah,0x8004(%rbp)
+  804aed:	00 00                	add    %al,(%rax)
+  804aef:	00 eb                	add    %ch,%bl
+  804af1:	04 80                	add    $0x80,%al
+  804af3:	00 00                	add    %al,(%rax)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 eb                	add    %ch,%bl
+  804af9:	04 80                	add    $0x80,%al
+  804afb:	00 00                	add    %al,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 eb                	add    %ch,%bl
+  804b01:	04 80                	add    $0x80,%al
+  804b03:	00 00                	add    %al,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 eb                	add    %ch,%bl
+  804b09:	04 80                	add    $0x80,%al
+  804b0b:	00 00                	add    %al,(%rax)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 eb                	add    %ch,%bl
+  804b11:	04 80                	add    $0x80,%al
+  804b13:	00 00                	add    %al,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 eb                	add    %ch,%bl
+  804b19:	04 80                	add    $0x80,%al
+  804b1b:	00 00                	add    %al,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 eb                	add    %ch,%bl
+  804b21:	04 80                	add    $0x80,%al
+  804b23:	00 00                	add    %al,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 eb                	add    %ch,%bl
+  804b29:	04 80                	add    $0x80,%al
+  804b2b:	00 00                	add    %al,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 eb                	add    %ch,%bl
+  804b31:	04 80                	add    $0x80,%al
+  804b33:	00 00                	add    %al,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 d3                	add    %dl,%bl
+  804b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b3f:	00 d3                	add    %dl,%bl
+  804b41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b47:	00 d3                	add    %dl,%bl
+  804b49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b4f:	00 d3                	add    %dl,%bl
+  804b51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b57:	00 d3                	add    %dl,%bl
+  804b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b5f:	00 d3                	add    %dl,%bl
+  804b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b67:	00 d3                	add    %dl,%bl
+  804b69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b6f:	00 d3                	add    %dl,%bl
+  804b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b77:	00 d3                	add    %dl,%bl
+  804b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b7f:	00 d3                	add    %dl,%bl
+  804b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b87:	00 d3                	add    %dl,%bl
+  804b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b8f:	00 d3                	add    %dl,%bl
+  804b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b97:	00 d3                	add    %dl,%bl
+  804b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b9f:	00 d3                	add    %dl,%bl
+  804ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ba7:	00 d3                	add    %dl,%bl
+  804ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804baf:	00 d3                	add    %dl,%bl
+  804bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bb7:	00 d3                	add    %dl,%bl
+  804bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bbf:	00 d3                	add    %dl,%bl
+  804bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bc7:	00 d3                	add    %dl,%bl
+  804bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bcf:	00 d3                	add    %dl,%bl
+  804bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bd7:	00 d3                	add    %dl,%bl
+  804bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bdf:	00 d3                	add    %dl,%bl
+  804be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804be7:	00 d3                	add    %dl,%bl
+  804be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bef:	00 d3                	add    %dl,%bl
+  804bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bf7:	00 d3                	add    %dl,%bl
+  804bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bff:	00 d3                	add    %dl,%bl
+  804c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c07:	00 d3                	add    %dl,%bl
+  804c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c0f:	00 d3                	add    %dl,%bl
+  804c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c17:	00 d3                	add    %dl,%bl
+  804c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c1f:	00 d3                	add    %dl,%bl
+  804c21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c27:	00 f6                	add    %dh,%dh
+  804c29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804c2f:	00 d3                	add    %dl,%bl
+  804c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c37:	00 d3                	add    %dl,%bl
+  804c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c3f:	00 d3                	add    %dl,%bl
+  804c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c47:	00 d3                	add    %dl,%bl
+  804c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c4f:	00 d3                	add    %dl,%bl
+  804c51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c57:	00 d3                	add    %dl,%bl
+  804c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c5f:	00 d3                	add    %dl,%bl
+  804c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c67:	00 d3                	add    %dl,%bl
+  804c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c6f:	00 d3                	add    %dl,%bl
+  804c71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c77:	00 d3                	add    %dl,%bl
+  804c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c7f:	00 42 05             	add    %al,0x5(%rdx)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 11                	add    %dl,(%rcx)
+  804c89:	07                   	(bad)
+  804c8a:	80 00 00             	addb   $0x0,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 d3                	add    %dl,%bl
+  804c91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c97:	00 d3                	add    %dl,%bl
+  804c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c9f:	00 d3                	add    %dl,%bl
+  804ca1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ca7:	00 d3                	add    %dl,%bl
+  804ca9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804caf:	00 71 05             	add    %dh,0x5(%rcx)
+  804cb2:	80 00 00             	addb   $0x0,(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 d3                	add    %dl,%bl
+  804cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cbf:	00 d3                	add    %dl,%bl
+  804cc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cc7:	00 37                	add    %dh,(%rdi)
+  804cc9:	05 80 00 00 00       	add    $0x80,%eax
+  804cce:	00 00                	add    %al,(%rax)
+  804cd0:	d3 0a                	rorl   %cl,(%rdx)
+  804cd2:	80 00 00             	addb   $0x0,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 d3                	add    %dl,%bl
+  804cd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cdf:	00 b9 08 80 00 00    	add    %bh,0x8008(%rcx)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 83 09 80 00 00    	add    %al,0x8009(%rbx)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 d3                	add    %dl,%bl
+  804cf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cf7:	00 d3                	add    %dl,%bl
+  804cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cff:	00 08                	add    %cl,(%rax)
+  804d01:	06                   	(bad)
+  804d02:	80 00 00             	addb   $0x0,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 d3                	add    %dl,%bl
+  804d09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d0f:	00 e5                	add    %ah,%ch
+  804d11:	07                   	(bad)
+  804d12:	80 00 00             	addb   $0x0,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 d3                	add    %dl,%bl
+  804d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d1f:	00 d3                	add    %dl,%bl
+  804d21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d27:	00 f6                	add    %dh,%dh
+  804d29:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804d2f:	00 d3                	add    %dl,%bl
+  804d31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d37:	00 9b 04 80 00 00    	add    %bl,0x8004(%rbx)
+  804d3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804d40 <error_string>:
+	...
+  804d48:	f2 48 80 00 00 00 00 00 04 49 80 00 00 00 00 00     .H.......I......
+  804d58:	14 49 80 00 00 00 00 00 26 49 80 00 00 00 00 00     .I......&I......
+  804d68:	34 49 80 00 00 00 00 00 48 49 80 00 00 00 00 00     4I......HI......
+  804d78:	5d 49 80 00 00 00 00 00 70 49 80 00 00 00 00 00     ]I......pI......
+  804d88:	82 49 80 00 00 00 00 00 96 49 80 00 00 00 00 00     .I.......I......
+  804d98:	a6 49 80 00 00 00 00 00 b9 49 80 00 00 00 00 00     .I.......I......
+  804da8:	d0 49 80 00 00 00 00 00 e6 49 80 00 00 00 00 00     .I.......I......
+  804db8:	fe 49 80 00 00 00 00 00 16 4a 80 00 00 00 00 00     .I.......J......
+  804dc8:	23 4a 80 00 00 00 00 00 f8 4d 80 00 00 00 00 00     #J.......M......
+  804dd8:	37 4a 80 00 00 00 00 00 4f 4a 80 00 00 00 00 00     7J......OJ......
+  804de8:	59 4a 80 00 00 00 00 00 63 4a 80 00 00 00 00 00     YJ......cJ......
+  804df8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e08:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e18:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e28:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e38:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804e48:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804e58:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804e68:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804e78:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804e88:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804e98:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804ea8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804eb8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804ec8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804ed8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804ee8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f00 <devtab>:
+  804f00:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f10:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804f20:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804f30:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804f40:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804f50:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804f60:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804f70:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804f80:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804f90:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804fa0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804fb0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804fc0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804fd0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804fe0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804ff0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805000:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805010:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805020:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805030:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805040:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805050:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805060:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805070:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805080:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805090:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805100:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805110:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805120:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805130:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805140:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805150:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
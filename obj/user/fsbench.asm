@@ -0,0 +1,8741 @@
+
+obj/user/fsbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c0 02 00 00       	call   8002e3 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+#define NPASSES   8
+
+static char buf[FILE_SIZE];
+
+static void
+bench(int fd, const char *transport, size_t blk) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80003d:	49 89 d5             	mov    %rdx,%r13
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800040:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800042:	48 c1 e2 20          	shl    $0x20,%rdx
+  800046:	89 c0                	mov    %eax,%eax
+  800048:	48 09 c2             	or     %rax,%rdx
+  80004b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  80004f:	c7 45 cc 08 00 00 00 	movl   $0x8,-0x34(%rbp)
+    uint64_t nreads = 0;
+  800056:	bb 00 00 00 00       	mov    $0x0,%ebx
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NPASSES; i++) {
+        seek(fd, 0);
+        for (;;) {
+            ssize_t res = read(fd, buf, blk);
+  80005b:	49 bf 00 00 81 00 00 	movabs $0x810000,%r15
+  800062:	00 00 00 
+  800065:	49 be 31 1b 80 00 00 	movabs $0x801b31,%r14
+  80006c:	00 00 00 
+  80006f:	eb 33                	jmp    8000a4 <bench+0x7f>
+            if (res < 0) panic("read: %i", (int)res);
+  800071:	89 c1                	mov    %eax,%ecx
+  800073:	48 ba 40 49 80 00 00 	movabs $0x804940,%rdx
+  80007a:	00 00 00 
+  80007d:	be 16 00 00 00       	mov    $0x16,%esi
+  800082:	48 bf 49 49 80 00 00 	movabs $0x804949,%rdi
+  800089:	00 00 00 
+  80008c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800091:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  800098:	00 00 00 
+  80009b:	41 ff d0             	call   *%r8
+    for (int i = 0; i < NPASSES; i++) {
+  80009e:	83 6d cc 01          	subl   $0x1,-0x34(%rbp)
+  8000a2:	74 2d                	je     8000d1 <bench+0xac>
+        seek(fd, 0);
+  8000a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a9:	44 89 e7             	mov    %r12d,%edi
+  8000ac:	48 b8 19 1d 80 00 00 	movabs $0x801d19,%rax
+  8000b3:	00 00 00 
+  8000b6:	ff d0                	call   *%rax
+            ssize_t res = read(fd, buf, blk);
+  8000b8:	4c 89 ea             	mov    %r13,%rdx
+  8000bb:	4c 89 fe             	mov    %r15,%rsi
+  8000be:	44 89 e7             	mov    %r12d,%edi
+  8000c1:	41 ff d6             	call   *%r14
+            if (res < 0) panic("read: %i", (int)res);
+  8000c4:	48 85 c0             	test   %rax,%rax
+  8000c7:	78 a8                	js     800071 <bench+0x4c>
+            if (!res) break;
+  8000c9:	74 d3                	je     80009e <bench+0x79>
+            nreads++;
+  8000cb:	48 83 c3 01          	add    $0x1,%rbx
+        for (;;) {
+  8000cf:	eb e7                	jmp    8000b8 <bench+0x93>
+    asm volatile("rdtsc"
+  8000d1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000d3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000d7:	89 c0                	mov    %eax,%eax
+  8000d9:	48 09 c2             	or     %rax,%rdx
+        }
+    }
+    uint64_t cycles = read_tsc() - start;
+  8000dc:	48 89 d1             	mov    %rdx,%rcx
+  8000df:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8000e3:	48 29 c1             	sub    %rax,%rcx
+
+    cprintf("fsbench: %s: %u-byte reads: %lu cycles per read, %lu bytes per Kcycle\n",
+            transport, (unsigned)blk, (unsigned long)(cycles / nreads),
+            (unsigned long)(NPASSES * FILE_SIZE * 1000ULL / cycles));
+  8000e6:	b8 00 00 40 1f       	mov    $0x1f400000,%eax
+  8000eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000f0:	48 f7 f1             	div    %rcx
+  8000f3:	49 89 c0             	mov    %rax,%r8
+            transport, (unsigned)blk, (unsigned long)(cycles / nreads),
+  8000f6:	48 89 c8             	mov    %rcx,%rax
+  8000f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000fe:	48 f7 f3             	div    %rbx
+  800101:	48 89 c1             	mov    %rax,%rcx
+    cprintf("fsbench: %s: %u-byte reads: %lu cycles per read, %lu bytes per Kcycle\n",
+  800104:	44 89 ea             	mov    %r13d,%edx
+  800107:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80010b:	48 bf a8 49 80 00 00 	movabs $0x8049a8,%rdi
+  800112:	00 00 00 
+  800115:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011a:	49 b9 09 05 80 00 00 	movabs $0x800509,%r9
+  800121:	00 00 00 
+  800124:	41 ff d1             	call   *%r9
+}
+  800127:	48 83 c4 28          	add    $0x28,%rsp
+  80012b:	5b                   	pop    %rbx
+  80012c:	41 5c                	pop    %r12
+  80012e:	41 5d                	pop    %r13
+  800130:	41 5e                	pop    %r14
+  800132:	41 5f                	pop    %r15
+  800134:	5d                   	pop    %rbp
+  800135:	c3                   	ret
+
+0000000000800136 <bench_all>:
+
+static void
+bench_all(int fd, const char *transport) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 55                	push   %r13
+  80013c:	41 54                	push   %r12
+  80013e:	53                   	push   %rbx
+  80013f:	48 83 ec 08          	sub    $0x8,%rsp
+  800143:	89 fb                	mov    %edi,%ebx
+  800145:	49 89 f4             	mov    %rsi,%r12
+    bench(fd, transport, 64);
+  800148:	ba 40 00 00 00       	mov    $0x40,%edx
+  80014d:	49 bd 25 00 80 00 00 	movabs $0x800025,%r13
+  800154:	00 00 00 
+  800157:	41 ff d5             	call   *%r13
+    bench(fd, transport, 512);
+  80015a:	ba 00 02 00 00       	mov    $0x200,%edx
+  80015f:	4c 89 e6             	mov    %r12,%rsi
+  800162:	89 df                	mov    %ebx,%edi
+  800164:	41 ff d5             	call   *%r13
+    /* Pipelined over channels */
+    bench(fd, transport, 8192);
+  800167:	ba 00 20 00 00       	mov    $0x2000,%edx
+  80016c:	4c 89 e6             	mov    %r12,%rsi
+  80016f:	89 df                	mov    %ebx,%edi
+  800171:	41 ff d5             	call   *%r13
+}
+  800174:	48 83 c4 08          	add    $0x8,%rsp
+  800178:	5b                   	pop    %rbx
+  800179:	41 5c                	pop    %r12
+  80017b:	41 5d                	pop    %r13
+  80017d:	5d                   	pop    %rbp
+  80017e:	c3                   	ret
+
+000000000080017f <umain>:
+
+void
+umain(int argc, char **argv) {
+  80017f:	55                   	push   %rbp
+  800180:	48 89 e5             	mov    %rsp,%rbp
+  800183:	41 54                	push   %r12
+  800185:	53                   	push   %rbx
+    int fd, res;
+
+    if ((fd = open("/fsbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  800186:	be 02 03 00 00       	mov    $0x302,%esi
+  80018b:	48 bf 58 49 80 00 00 	movabs $0x804958,%rdi
+  800192:	00 00 00 
+  800195:	48 b8 13 30 80 00 00 	movabs $0x803013,%rax
+  80019c:	00 00 00 
+  80019f:	ff d0                	call   *%rax
+  8001a1:	89 c3                	mov    %eax,%ebx
+  8001a3:	85 c0                	test   %eax,%eax
+  8001a5:	0f 88 b3 00 00 00    	js     80025e <umain+0xdf>
+        panic("open /fsbench: %i", fd);
+
+    memset(buf, 'x', sizeof(buf));
+  8001ab:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8001b0:	be 78 00 00 00       	mov    $0x78,%esi
+  8001b5:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  8001bc:	00 00 00 
+  8001bf:	4c 89 e7             	mov    %r12,%rdi
+  8001c2:	48 b8 7a 0f 80 00 00 	movabs $0x800f7a,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((res = write(fd, buf, sizeof(buf))) != sizeof(buf))
+  8001ce:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8001d3:	4c 89 e6             	mov    %r12,%rsi
+  8001d6:	89 df                	mov    %ebx,%edi
+  8001d8:	48 b8 60 1c 80 00 00 	movabs $0x801c60,%rax
+  8001df:	00 00 00 
+  8001e2:	ff d0                	call   *%rax
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  8001eb:	0f 85 9a 00 00 00    	jne    80028b <umain+0x10c>
+        panic("write /fsbench: %i", res);
+
+    bench_all(fd, "ipc");
+  8001f1:	48 be 86 49 80 00 00 	movabs $0x804986,%rsi
+  8001f8:	00 00 00 
+  8001fb:	89 df                	mov    %ebx,%edi
+  8001fd:	48 b8 36 01 80 00 00 	movabs $0x800136,%rax
+  800204:	00 00 00 
+  800207:	ff d0                	call   *%rax
+
+    if ((res = fs_channel(1)) < 0) panic("fs_channel: %i", res);
+  800209:	bf 01 00 00 00       	mov    $0x1,%edi
+  80020e:	48 b8 b4 2f 80 00 00 	movabs $0x802fb4,%rax
+  800215:	00 00 00 
+  800218:	ff d0                	call   *%rax
+  80021a:	85 c0                	test   %eax,%eax
+  80021c:	0f 88 94 00 00 00    	js     8002b6 <umain+0x137>
+    bench_all(fd, "channel");
+  800222:	48 be 99 49 80 00 00 	movabs $0x804999,%rsi
+  800229:	00 00 00 
+  80022c:	89 df                	mov    %ebx,%edi
+  80022e:	48 b8 36 01 80 00 00 	movabs $0x800136,%rax
+  800235:	00 00 00 
+  800238:	ff d0                	call   *%rax
+    fs_channel(0);
+  80023a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80023f:	48 b8 b4 2f 80 00 00 	movabs $0x802fb4,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+
+    close(fd);
+  80024b:	89 df                	mov    %ebx,%edi
+  80024d:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+}
+  800259:	5b                   	pop    %rbx
+  80025a:	41 5c                	pop    %r12
+  80025c:	5d                   	pop    %rbp
+  80025d:	c3                   	ret
+        panic("open /fsbench: %i", fd);
+  80025e:	89 c1                	mov    %eax,%ecx
+  800260:	48 ba 61 49 80 00 00 	movabs $0x804961,%rdx
+  800267:	00 00 00 
+  80026a:	be 2f 00 00 00       	mov    $0x2f,%esi
+  80026f:	48 bf 49 49 80 00 00 	movabs $0x804949,%rdi
+  800276:	00 00 00 
+  800279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027e:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  800285:	00 00 00 
+  800288:	41 ff d0             	call   *%r8
+        panic("write /fsbench: %i", res);
+  80028b:	48 ba 73 49 80 00 00 	movabs $0x804973,%rdx
+  800292:	00 00 00 
+  800295:	be 33 00 00 00       	mov    $0x33,%esi
+  80029a:	48 bf 49 49 80 00 00 	movabs $0x804949,%rdi
+  8002a1:	00 00 00 
+  8002a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a9:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  8002b0:	00 00 00 
+  8002b3:	41 ff d0             	call   *%r8
+    if ((res = fs_channel(1)) < 0) panic("fs_channel: %i", res);
+  8002b6:	89 c1                	mov    %eax,%ecx
+  8002b8:	48 ba 8a 49 80 00 00 	movabs $0x80498a,%rdx
+  8002bf:	00 00 00 
+  8002c2:	be 37 00 00 00       	mov    $0x37,%esi
+  8002c7:	48 bf 49 49 80 00 00 	movabs $0x804949,%rdi
+  8002ce:	00 00 00 
+  8002d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d6:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  8002dd:	00 00 00 
+  8002e0:	41 ff d0             	call   *%r8
+
+00000000008002e3 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8002e3:	55                   	push   %rbp
+  8002e4:	48 89 e5             	mov    %rsp,%rbp
+  8002e7:	41 56                	push   %r14
+  8002e9:	41 55                	push   %r13
+  8002eb:	41 54                	push   %r12
+  8002ed:	53                   	push   %rbx
+  8002ee:	41 89 fd             	mov    %edi,%r13d
+  8002f1:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8002f4:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8002fb:	00 00 00 
+  8002fe:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800305:	00 00 00 
+  800308:	48 39 c2             	cmp    %rax,%rdx
+  80030b:	73 17                	jae    800324 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80030d:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800310:	49 89 c4             	mov    %rax,%r12
+  800313:	48 83 c3 08          	add    $0x8,%rbx
+  800317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031c:	ff 53 f8             	call   *-0x8(%rbx)
+  80031f:	4c 39 e3             	cmp    %r12,%rbx
+  800322:	72 ef                	jb     800313 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800324:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+  800330:	89 c2                	mov    %eax,%edx
+  800332:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800338:	48 89 d0             	mov    %rdx,%rax
+  80033b:	48 c1 e0 04          	shl    $0x4,%rax
+  80033f:	48 29 d0             	sub    %rdx,%rax
+  800342:	48 c1 e0 05          	shl    $0x5,%rax
+  800346:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80034d:	00 00 00 
+  800350:	48 01 d0             	add    %rdx,%rax
+  800353:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  80035a:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80035d:	45 85 ed             	test   %r13d,%r13d
+  800360:	7e 0d                	jle    80036f <libmain+0x8c>
+  800362:	49 8b 06             	mov    (%r14),%rax
+  800365:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80036c:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80036f:	4c 89 f6             	mov    %r14,%rsi
+  800372:	44 89 ef             	mov    %r13d,%edi
+  800375:	48 b8 7f 01 80 00 00 	movabs $0x80017f,%rax
+  80037c:	00 00 00 
+  80037f:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800381:	48 b8 96 03 80 00 00 	movabs $0x800396,%rax
+  800388:	00 00 00 
+  80038b:	ff d0                	call   *%rax
+#endif
+}
+  80038d:	5b                   	pop    %rbx
+  80038e:	41 5c                	pop    %r12
+  800390:	41 5d                	pop    %r13
+  800392:	41 5e                	pop    %r14
+  800394:	5d                   	pop    %rbp
+  800395:	c3                   	ret
+
+0000000000800396 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800396:	55                   	push   %rbp
+  800397:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80039a:	48 b8 e6 19 80 00 00 	movabs $0x8019e6,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8003a6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8003ab:	48 b8 9d 12 80 00 00 	movabs $0x80129d,%rax
+  8003b2:	00 00 00 
+  8003b5:	ff d0                	call   *%rax
+}
+  8003b7:	5d                   	pop    %rbp
+  8003b8:	c3                   	ret
+
+00000000008003b9 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8003b9:	55                   	push   %rbp
+  8003ba:	48 89 e5             	mov    %rsp,%rbp
+  8003bd:	41 56                	push   %r14
+  8003bf:	41 55                	push   %r13
+  8003c1:	41 54                	push   %r12
+  8003c3:	53                   	push   %rbx
+  8003c4:	48 83 ec 50          	sub    $0x50,%rsp
+  8003c8:	49 89 fc             	mov    %rdi,%r12
+  8003cb:	41 89 f5             	mov    %esi,%r13d
+  8003ce:	48 89 d3             	mov    %rdx,%rbx
+  8003d1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8003d5:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8003d9:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8003dd:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8003e4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003e8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8003ec:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8003f0:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8003f4:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8003fb:	00 00 00 
+  8003fe:	4c 8b 30             	mov    (%rax),%r14
+  800401:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  800408:	00 00 00 
+  80040b:	ff d0                	call   *%rax
+  80040d:	89 c6                	mov    %eax,%esi
+  80040f:	45 89 e8             	mov    %r13d,%r8d
+  800412:	4c 89 e1             	mov    %r12,%rcx
+  800415:	4c 89 f2             	mov    %r14,%rdx
+  800418:	48 bf 00 4a 80 00 00 	movabs $0x804a00,%rdi
+  80041f:	00 00 00 
+  800422:	b8 00 00 00 00       	mov    $0x0,%eax
+  800427:	49 bc 09 05 80 00 00 	movabs $0x800509,%r12
+  80042e:	00 00 00 
+  800431:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800434:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800438:	48 89 df             	mov    %rbx,%rdi
+  80043b:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  800442:	00 00 00 
+  800445:	ff d0                	call   *%rax
+    cprintf("\n");
+  800447:	48 bf 03 50 80 00 00 	movabs $0x805003,%rdi
+  80044e:	00 00 00 
+  800451:	b8 00 00 00 00       	mov    $0x0,%eax
+  800456:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800459:	cc                   	int3
+  80045a:	eb fd                	jmp    800459 <_panic+0xa0>
+
+000000000080045c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80045c:	55                   	push   %rbp
+  80045d:	48 89 e5             	mov    %rsp,%rbp
+  800460:	53                   	push   %rbx
+  800461:	48 83 ec 08          	sub    $0x8,%rsp
+  800465:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800468:	8b 06                	mov    (%rsi),%eax
+  80046a:	8d 50 01             	lea    0x1(%rax),%edx
+  80046d:	89 16                	mov    %edx,(%rsi)
+  80046f:	48 98                	cltq
+  800471:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800476:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80047c:	74 0a                	je     800488 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80047e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800482:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800486:	c9                   	leave
+  800487:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800488:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80048c:	be ff 00 00 00       	mov    $0xff,%esi
+  800491:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  800498:	00 00 00 
+  80049b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80049d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8004a3:	eb d9                	jmp    80047e <putch+0x22>
+
+00000000008004a5 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8004a5:	55                   	push   %rbp
+  8004a6:	48 89 e5             	mov    %rsp,%rbp
+  8004a9:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8004b0:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8004b3:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8004ba:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8004bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8004c7:	48 89 f1             	mov    %rsi,%rcx
+  8004ca:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8004d1:	48 bf 5c 04 80 00 00 	movabs $0x80045c,%rdi
+  8004d8:	00 00 00 
+  8004db:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  8004e2:	00 00 00 
+  8004e5:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8004e7:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8004ee:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8004f5:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  8004fc:	00 00 00 
+  8004ff:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800501:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800507:	c9                   	leave
+  800508:	c3                   	ret
+
+0000000000800509 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800509:	55                   	push   %rbp
+  80050a:	48 89 e5             	mov    %rsp,%rbp
+  80050d:	48 83 ec 50          	sub    $0x50,%rsp
+  800511:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800515:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800519:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80051d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800521:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800525:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80052c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800530:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800534:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800538:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80053c:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800540:	48 b8 a5 04 80 00 00 	movabs $0x8004a5,%rax
+  800547:	00 00 00 
+  80054a:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80054c:	c9                   	leave
+  80054d:	c3                   	ret
+
+000000000080054e <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80054e:	55                   	push   %rbp
+  80054f:	48 89 e5             	mov    %rsp,%rbp
+  800552:	41 57                	push   %r15
+  800554:	41 56                	push   %r14
+  800556:	41 55                	push   %r13
+  800558:	41 54                	push   %r12
+  80055a:	53                   	push   %rbx
+  80055b:	48 83 ec 18          	sub    $0x18,%rsp
+  80055f:	49 89 fc             	mov    %rdi,%r12
+  800562:	49 89 f5             	mov    %rsi,%r13
+  800565:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800569:	8b 45 10             	mov    0x10(%rbp),%eax
+  80056c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80056f:	41 89 cf             	mov    %ecx,%r15d
+  800572:	4c 39 fa             	cmp    %r15,%rdx
+  800575:	73 5b                	jae    8005d2 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800577:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80057b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80057f:	85 db                	test   %ebx,%ebx
+  800581:	7e 0e                	jle    800591 <print_num+0x43>
+            putch(padc, put_arg);
+  800583:	4c 89 ee             	mov    %r13,%rsi
+  800586:	44 89 f7             	mov    %r14d,%edi
+  800589:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80058c:	83 eb 01             	sub    $0x1,%ebx
+  80058f:	75 f2                	jne    800583 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800591:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800595:	48 b9 34 4a 80 00 00 	movabs $0x804a34,%rcx
+  80059c:	00 00 00 
+  80059f:	48 b8 23 4a 80 00 00 	movabs $0x804a23,%rax
+  8005a6:	00 00 00 
+  8005a9:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8005ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b6:	49 f7 f7             	div    %r15
+  8005b9:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8005bd:	4c 89 ee             	mov    %r13,%rsi
+  8005c0:	41 ff d4             	call   *%r12
+}
+  8005c3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8005c7:	5b                   	pop    %rbx
+  8005c8:	41 5c                	pop    %r12
+  8005ca:	41 5d                	pop    %r13
+  8005cc:	41 5e                	pop    %r14
+  8005ce:	41 5f                	pop    %r15
+  8005d0:	5d                   	pop    %rbp
+  8005d1:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8005d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8005d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005db:	49 f7 f7             	div    %r15
+  8005de:	48 83 ec 08          	sub    $0x8,%rsp
+  8005e2:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8005e6:	52                   	push   %rdx
+  8005e7:	45 0f be c9          	movsbl %r9b,%r9d
+  8005eb:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8005ef:	48 89 c2             	mov    %rax,%rdx
+  8005f2:	48 b8 4e 05 80 00 00 	movabs $0x80054e,%rax
+  8005f9:	00 00 00 
+  8005fc:	ff d0                	call   *%rax
+  8005fe:	48 83 c4 10          	add    $0x10,%rsp
+  800602:	eb 8d                	jmp    800591 <print_num+0x43>
+
+0000000000800604 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800604:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800608:	48 8b 06             	mov    (%rsi),%rax
+  80060b:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80060f:	73 0a                	jae    80061b <sprintputch+0x17>
+        *state->start++ = ch;
+  800611:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800615:	48 89 16             	mov    %rdx,(%rsi)
+  800618:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80061b:	c3                   	ret
+
+000000000080061c <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80061c:	55                   	push   %rbp
+  80061d:	48 89 e5             	mov    %rsp,%rbp
+  800620:	48 83 ec 50          	sub    $0x50,%rsp
+  800624:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800628:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80062c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800630:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800637:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80063b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80063f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800643:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800647:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80064b:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  800652:	00 00 00 
+  800655:	ff d0                	call   *%rax
+}
+  800657:	c9                   	leave
+  800658:	c3                   	ret
+
+0000000000800659 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800659:	55                   	push   %rbp
+  80065a:	48 89 e5             	mov    %rsp,%rbp
+  80065d:	41 57                	push   %r15
+  80065f:	41 56                	push   %r14
+  800661:	41 55                	push   %r13
+  800663:	41 54                	push   %r12
+  800665:	53                   	push   %rbx
+  800666:	48 83 ec 38          	sub    $0x38,%rsp
+  80066a:	49 89 fe             	mov    %rdi,%r14
+  80066d:	49 89 f5             	mov    %rsi,%r13
+  800670:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800673:	48 8b 01             	mov    (%rcx),%rax
+  800676:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80067a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80067e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800682:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800686:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80068a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80068e:	0f b6 3b             	movzbl (%rbx),%edi
+  800691:	40 80 ff 25          	cmp    $0x25,%dil
+  800695:	74 18                	je     8006af <vprintfmt+0x56>
+            if (!ch) return;
+  800697:	40 84 ff             	test   %dil,%dil
+  80069a:	0f 84 b1 06 00 00    	je     800d51 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8006a0:	40 0f b6 ff          	movzbl %dil,%edi
+  8006a4:	4c 89 ee             	mov    %r13,%rsi
+  8006a7:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8006aa:	4c 89 e3             	mov    %r12,%rbx
+  8006ad:	eb db                	jmp    80068a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8006af:	be 00 00 00 00       	mov    $0x0,%esi
+  8006b4:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8006b8:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8006bd:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006c3:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8006ca:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8006ce:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8006d3:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8006d8:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8006db:	83 e8 23             	sub    $0x23,%eax
+  8006de:	3c 57                	cmp    $0x57,%al
+  8006e0:	0f 87 51 06 00 00    	ja     800d37 <vprintfmt+0x6de>
+  8006e6:	0f b6 c0             	movzbl %al,%eax
+  8006e9:	48 b9 e0 4b 80 00 00 	movabs $0x804be0,%rcx
+  8006f0:	00 00 00 
+  8006f3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8006f6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8006f9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8006fd:	eb cf                	jmp    8006ce <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8006ff:	49 89 dc             	mov    %rbx,%r12
+  800702:	be 01 00 00 00       	mov    $0x1,%esi
+  800707:	eb c5                	jmp    8006ce <vprintfmt+0x75>
+            padc = ch;
+  800709:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80070d:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800710:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800713:	eb b9                	jmp    8006ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800715:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800718:	83 f8 2f             	cmp    $0x2f,%eax
+  80071b:	77 24                	ja     800741 <vprintfmt+0xe8>
+  80071d:	89 c1                	mov    %eax,%ecx
+  80071f:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800723:	83 c0 08             	add    $0x8,%eax
+  800726:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800729:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80072c:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80072f:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800733:	79 99                	jns    8006ce <vprintfmt+0x75>
+                width = precision;
+  800735:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800739:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80073f:	eb 8d                	jmp    8006ce <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800741:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800745:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800749:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074d:	eb da                	jmp    800729 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80074f:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800754:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800758:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80075e:	3c 39                	cmp    $0x39,%al
+  800760:	77 1c                	ja     80077e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800762:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800766:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80076a:	0f b6 c0             	movzbl %al,%eax
+  80076d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800772:	0f b6 03             	movzbl (%rbx),%eax
+  800775:	3c 39                	cmp    $0x39,%al
+  800777:	76 e9                	jbe    800762 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800779:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80077c:	eb b1                	jmp    80072f <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80077e:	49 89 dc             	mov    %rbx,%r12
+  800781:	eb ac                	jmp    80072f <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800783:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800786:	85 c9                	test   %ecx,%ecx
+  800788:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078d:	0f 49 c1             	cmovns %ecx,%eax
+  800790:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800793:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800796:	e9 33 ff ff ff       	jmp    8006ce <vprintfmt+0x75>
+            lflag++;
+  80079b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80079e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a1:	e9 28 ff ff ff       	jmp    8006ce <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8007a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ac:	77 19                	ja     8007c7 <vprintfmt+0x16e>
+  8007ae:	89 c2                	mov    %eax,%edx
+  8007b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b4:	83 c0 08             	add    $0x8,%eax
+  8007b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ba:	8b 3a                	mov    (%rdx),%edi
+  8007bc:	4c 89 ee             	mov    %r13,%rsi
+  8007bf:	41 ff d6             	call   *%r14
+            break;
+  8007c2:	e9 c3 fe ff ff       	jmp    80068a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	eb e5                	jmp    8007ba <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8007d5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007d8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007db:	77 5a                	ja     800837 <vprintfmt+0x1de>
+  8007dd:	89 c2                	mov    %eax,%edx
+  8007df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e3:	83 c0 08             	add    $0x8,%eax
+  8007e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8007e9:	8b 02                	mov    (%rdx),%eax
+  8007eb:	89 c1                	mov    %eax,%ecx
+  8007ed:	f7 d9                	neg    %ecx
+  8007ef:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8007f2:	83 f9 16             	cmp    $0x16,%ecx
+  8007f5:	7f 4e                	jg     800845 <vprintfmt+0x1ec>
+  8007f7:	48 63 c1             	movslq %ecx,%rax
+  8007fa:	48 ba a0 4e 80 00 00 	movabs $0x804ea0,%rdx
+  800801:	00 00 00 
+  800804:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800808:	48 85 c0             	test   %rax,%rax
+  80080b:	74 38                	je     800845 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80080d:	48 89 c1             	mov    %rax,%rcx
+  800810:	48 ba 79 50 80 00 00 	movabs $0x805079,%rdx
+  800817:	00 00 00 
+  80081a:	4c 89 ee             	mov    %r13,%rsi
+  80081d:	4c 89 f7             	mov    %r14,%rdi
+  800820:	b8 00 00 00 00       	mov    $0x0,%eax
+  800825:	49 b8 1c 06 80 00 00 	movabs $0x80061c,%r8
+  80082c:	00 00 00 
+  80082f:	41 ff d0             	call   *%r8
+  800832:	e9 53 fe ff ff       	jmp    80068a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800837:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80083f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800843:	eb a4                	jmp    8007e9 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800845:	48 ba 4c 4a 80 00 00 	movabs $0x804a4c,%rdx
+  80084c:	00 00 00 
+  80084f:	4c 89 ee             	mov    %r13,%rsi
+  800852:	4c 89 f7             	mov    %r14,%rdi
+  800855:	b8 00 00 00 00       	mov    $0x0,%eax
+  80085a:	49 b8 1c 06 80 00 00 	movabs $0x80061c,%r8
+  800861:	00 00 00 
+  800864:	41 ff d0             	call   *%r8
+  800867:	e9 1e fe ff ff       	jmp    80068a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 6c                	ja     8008e0 <vprintfmt+0x287>
+  800874:	89 c2                	mov    %eax,%edx
+  800876:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800883:	48 85 d2             	test   %rdx,%rdx
+  800886:	48 b8 45 4a 80 00 00 	movabs $0x804a45,%rax
+  80088d:	00 00 00 
+  800890:	48 0f 45 c2          	cmovne %rdx,%rax
+  800894:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800898:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80089c:	7e 06                	jle    8008a4 <vprintfmt+0x24b>
+  80089e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8008a2:	75 4a                	jne    8008ee <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008a4:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8008a8:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8008ac:	0f b6 00             	movzbl (%rax),%eax
+  8008af:	84 c0                	test   %al,%al
+  8008b1:	0f 85 9a 00 00 00    	jne    800951 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8008b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8008ba:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8008be:	85 c0                	test   %eax,%eax
+  8008c0:	0f 8e c4 fd ff ff    	jle    80068a <vprintfmt+0x31>
+  8008c6:	4c 89 ee             	mov    %r13,%rsi
+  8008c9:	bf 20 00 00 00       	mov    $0x20,%edi
+  8008ce:	41 ff d6             	call   *%r14
+  8008d1:	41 83 ec 01          	sub    $0x1,%r12d
+  8008d5:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8008d9:	75 eb                	jne    8008c6 <vprintfmt+0x26d>
+  8008db:	e9 aa fd ff ff       	jmp    80068a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ec:	eb 92                	jmp    800880 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8008ee:	49 63 f7             	movslq %r15d,%rsi
+  8008f1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8008f5:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  8008fc:	00 00 00 
+  8008ff:	ff d0                	call   *%rax
+  800901:	48 89 c2             	mov    %rax,%rdx
+  800904:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800907:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800909:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80090c:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  80090f:	85 c0                	test   %eax,%eax
+  800911:	7e 91                	jle    8008a4 <vprintfmt+0x24b>
+  800913:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800918:	4c 89 ee             	mov    %r13,%rsi
+  80091b:	44 89 e7             	mov    %r12d,%edi
+  80091e:	41 ff d6             	call   *%r14
+  800921:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800925:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800928:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80092b:	75 eb                	jne    800918 <vprintfmt+0x2bf>
+  80092d:	e9 72 ff ff ff       	jmp    8008a4 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800932:	0f b6 f8             	movzbl %al,%edi
+  800935:	4c 89 ee             	mov    %r13,%rsi
+  800938:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80093b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80093f:	49 83 c4 01          	add    $0x1,%r12
+  800943:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800949:	84 c0                	test   %al,%al
+  80094b:	0f 84 66 ff ff ff    	je     8008b7 <vprintfmt+0x25e>
+  800951:	45 85 ff             	test   %r15d,%r15d
+  800954:	78 0a                	js     800960 <vprintfmt+0x307>
+  800956:	41 83 ef 01          	sub    $0x1,%r15d
+  80095a:	0f 88 57 ff ff ff    	js     8008b7 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800960:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800964:	74 cc                	je     800932 <vprintfmt+0x2d9>
+  800966:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800969:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80096e:	80 fa 5e             	cmp    $0x5e,%dl
+  800971:	77 c2                	ja     800935 <vprintfmt+0x2dc>
+  800973:	eb bd                	jmp    800932 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800975:	40 84 f6             	test   %sil,%sil
+  800978:	75 26                	jne    8009a0 <vprintfmt+0x347>
+    switch (lflag) {
+  80097a:	85 d2                	test   %edx,%edx
+  80097c:	74 59                	je     8009d7 <vprintfmt+0x37e>
+  80097e:	83 fa 01             	cmp    $0x1,%edx
+  800981:	74 7b                	je     8009fe <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800983:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800986:	83 f8 2f             	cmp    $0x2f,%eax
+  800989:	0f 87 96 00 00 00    	ja     800a25 <vprintfmt+0x3cc>
+  80098f:	89 c2                	mov    %eax,%edx
+  800991:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800995:	83 c0 08             	add    $0x8,%eax
+  800998:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099b:	4c 8b 22             	mov    (%rdx),%r12
+  80099e:	eb 17                	jmp    8009b7 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a3:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a6:	77 21                	ja     8009c9 <vprintfmt+0x370>
+  8009a8:	89 c2                	mov    %eax,%edx
+  8009aa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ae:	83 c0 08             	add    $0x8,%eax
+  8009b1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b4:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8009b7:	4d 85 e4             	test   %r12,%r12
+  8009ba:	78 7a                	js     800a36 <vprintfmt+0x3dd>
+            num = i;
+  8009bc:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8009bf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8009c4:	e9 50 02 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d5:	eb dd                	jmp    8009b4 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8009d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009da:	83 f8 2f             	cmp    $0x2f,%eax
+  8009dd:	77 11                	ja     8009f0 <vprintfmt+0x397>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	4c 63 22             	movslq (%rdx),%r12
+  8009ee:	eb c7                	jmp    8009b7 <vprintfmt+0x35e>
+  8009f0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009f8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fc:	eb ed                	jmp    8009eb <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8009fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a01:	83 f8 2f             	cmp    $0x2f,%eax
+  800a04:	77 11                	ja     800a17 <vprintfmt+0x3be>
+  800a06:	89 c2                	mov    %eax,%edx
+  800a08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0c:	83 c0 08             	add    $0x8,%eax
+  800a0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a12:	4c 8b 22             	mov    (%rdx),%r12
+  800a15:	eb a0                	jmp    8009b7 <vprintfmt+0x35e>
+  800a17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a23:	eb ed                	jmp    800a12 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a25:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a29:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a2d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a31:	e9 65 ff ff ff       	jmp    80099b <vprintfmt+0x342>
+                putch('-', put_arg);
+  800a36:	4c 89 ee             	mov    %r13,%rsi
+  800a39:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800a3e:	41 ff d6             	call   *%r14
+                i = -i;
+  800a41:	49 f7 dc             	neg    %r12
+  800a44:	e9 73 ff ff ff       	jmp    8009bc <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800a49:	40 84 f6             	test   %sil,%sil
+  800a4c:	75 32                	jne    800a80 <vprintfmt+0x427>
+    switch (lflag) {
+  800a4e:	85 d2                	test   %edx,%edx
+  800a50:	74 5d                	je     800aaf <vprintfmt+0x456>
+  800a52:	83 fa 01             	cmp    $0x1,%edx
+  800a55:	0f 84 82 00 00 00    	je     800add <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800a5b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5e:	83 f8 2f             	cmp    $0x2f,%eax
+  800a61:	0f 87 a5 00 00 00    	ja     800b0c <vprintfmt+0x4b3>
+  800a67:	89 c2                	mov    %eax,%edx
+  800a69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a6d:	83 c0 08             	add    $0x8,%eax
+  800a70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a73:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a7b:	e9 99 01 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a83:	83 f8 2f             	cmp    $0x2f,%eax
+  800a86:	77 19                	ja     800aa1 <vprintfmt+0x448>
+  800a88:	89 c2                	mov    %eax,%edx
+  800a8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a8e:	83 c0 08             	add    $0x8,%eax
+  800a91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a94:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a97:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a9c:	e9 78 01 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+  800aa1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aad:	eb e5                	jmp    800a94 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800aaf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab5:	77 18                	ja     800acf <vprintfmt+0x476>
+  800ab7:	89 c2                	mov    %eax,%edx
+  800ab9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800abd:	83 c0 08             	add    $0x8,%eax
+  800ac0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac3:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800ac5:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800aca:	e9 4a 01 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+  800acf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800adb:	eb e6                	jmp    800ac3 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800add:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ae0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae3:	77 19                	ja     800afe <vprintfmt+0x4a5>
+  800ae5:	89 c2                	mov    %eax,%edx
+  800ae7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aeb:	83 c0 08             	add    $0x8,%eax
+  800aee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800af4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800af9:	e9 1b 01 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	eb e5                	jmp    800af1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b18:	e9 56 ff ff ff       	jmp    800a73 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b1d:	40 84 f6             	test   %sil,%sil
+  800b20:	75 2e                	jne    800b50 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b22:	85 d2                	test   %edx,%edx
+  800b24:	74 59                	je     800b7f <vprintfmt+0x526>
+  800b26:	83 fa 01             	cmp    $0x1,%edx
+  800b29:	74 7f                	je     800baa <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800b2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b2e:	83 f8 2f             	cmp    $0x2f,%eax
+  800b31:	0f 87 9f 00 00 00    	ja     800bd6 <vprintfmt+0x57d>
+  800b37:	89 c2                	mov    %eax,%edx
+  800b39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3d:	83 c0 08             	add    $0x8,%eax
+  800b40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b43:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b46:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b4b:	e9 c9 00 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b53:	83 f8 2f             	cmp    $0x2f,%eax
+  800b56:	77 19                	ja     800b71 <vprintfmt+0x518>
+  800b58:	89 c2                	mov    %eax,%edx
+  800b5a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b5e:	83 c0 08             	add    $0x8,%eax
+  800b61:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b64:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b67:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b6c:	e9 a8 00 00 00       	jmp    800c19 <vprintfmt+0x5c0>
+  800b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7d:	eb e5                	jmp    800b64 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	77 15                	ja     800b9c <vprintfmt+0x543>
+  800b87:	89 c2                	mov    %eax,%edx
+  800b89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8d:	83 c0 08             	add    $0x8,%eax
+  800b90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b93:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b95:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b9a:	eb 7d                	jmp    800c19 <vprintfmt+0x5c0>
+  800b9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba8:	eb e9                	jmp    800b93 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800baa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bad:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb0:	77 16                	ja     800bc8 <vprintfmt+0x56f>
+  800bb2:	89 c2                	mov    %eax,%edx
+  800bb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb8:	83 c0 08             	add    $0x8,%eax
+  800bbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bc1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800bc6:	eb 51                	jmp    800c19 <vprintfmt+0x5c0>
+  800bc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd4:	eb e8                	jmp    800bbe <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800bd6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bda:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bde:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be2:	e9 5c ff ff ff       	jmp    800b43 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800be7:	4c 89 ee             	mov    %r13,%rsi
+  800bea:	bf 30 00 00 00       	mov    $0x30,%edi
+  800bef:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800bf2:	4c 89 ee             	mov    %r13,%rsi
+  800bf5:	bf 78 00 00 00       	mov    $0x78,%edi
+  800bfa:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800bfd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c00:	83 f8 2f             	cmp    $0x2f,%eax
+  800c03:	77 47                	ja     800c4c <vprintfmt+0x5f3>
+  800c05:	89 c2                	mov    %eax,%edx
+  800c07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0b:	83 c0 08             	add    $0x8,%eax
+  800c0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c11:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c14:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c19:	48 83 ec 08          	sub    $0x8,%rsp
+  800c1d:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c21:	0f 94 c0             	sete   %al
+  800c24:	0f b6 c0             	movzbl %al,%eax
+  800c27:	50                   	push   %rax
+  800c28:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800c2d:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800c31:	4c 89 ee             	mov    %r13,%rsi
+  800c34:	4c 89 f7             	mov    %r14,%rdi
+  800c37:	48 b8 4e 05 80 00 00 	movabs $0x80054e,%rax
+  800c3e:	00 00 00 
+  800c41:	ff d0                	call   *%rax
+            break;
+  800c43:	48 83 c4 10          	add    $0x10,%rsp
+  800c47:	e9 3e fa ff ff       	jmp    80068a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800c4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c58:	eb b7                	jmp    800c11 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800c5a:	40 84 f6             	test   %sil,%sil
+  800c5d:	75 2b                	jne    800c8a <vprintfmt+0x631>
+    switch (lflag) {
+  800c5f:	85 d2                	test   %edx,%edx
+  800c61:	74 56                	je     800cb9 <vprintfmt+0x660>
+  800c63:	83 fa 01             	cmp    $0x1,%edx
+  800c66:	74 7f                	je     800ce7 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800c68:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c6b:	83 f8 2f             	cmp    $0x2f,%eax
+  800c6e:	0f 87 a2 00 00 00    	ja     800d16 <vprintfmt+0x6bd>
+  800c74:	89 c2                	mov    %eax,%edx
+  800c76:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c7a:	83 c0 08             	add    $0x8,%eax
+  800c7d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c80:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c83:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c88:	eb 8f                	jmp    800c19 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800c90:	77 19                	ja     800cab <vprintfmt+0x652>
+  800c92:	89 c2                	mov    %eax,%edx
+  800c94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c98:	83 c0 08             	add    $0x8,%eax
+  800c9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca1:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ca6:	e9 6e ff ff ff       	jmp    800c19 <vprintfmt+0x5c0>
+  800cab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800caf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cb3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb7:	eb e5                	jmp    800c9e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800cb9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cbc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cbf:	77 18                	ja     800cd9 <vprintfmt+0x680>
+  800cc1:	89 c2                	mov    %eax,%edx
+  800cc3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cc7:	83 c0 08             	add    $0x8,%eax
+  800cca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ccd:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ccf:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800cd4:	e9 40 ff ff ff       	jmp    800c19 <vprintfmt+0x5c0>
+  800cd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ce5:	eb e6                	jmp    800ccd <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ce7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cea:	83 f8 2f             	cmp    $0x2f,%eax
+  800ced:	77 19                	ja     800d08 <vprintfmt+0x6af>
+  800cef:	89 c2                	mov    %eax,%edx
+  800cf1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf5:	83 c0 08             	add    $0x8,%eax
+  800cf8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cfb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cfe:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d03:	e9 11 ff ff ff       	jmp    800c19 <vprintfmt+0x5c0>
+  800d08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d14:	eb e5                	jmp    800cfb <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d16:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d1a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d1e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d22:	e9 59 ff ff ff       	jmp    800c80 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d27:	4c 89 ee             	mov    %r13,%rsi
+  800d2a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d2f:	41 ff d6             	call   *%r14
+            break;
+  800d32:	e9 53 f9 ff ff       	jmp    80068a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800d37:	4c 89 ee             	mov    %r13,%rsi
+  800d3a:	bf 25 00 00 00       	mov    $0x25,%edi
+  800d3f:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800d42:	48 83 eb 01          	sub    $0x1,%rbx
+  800d46:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800d4a:	75 f6                	jne    800d42 <vprintfmt+0x6e9>
+  800d4c:	e9 39 f9 ff ff       	jmp    80068a <vprintfmt+0x31>
+}
+  800d51:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d55:	5b                   	pop    %rbx
+  800d56:	41 5c                	pop    %r12
+  800d58:	41 5d                	pop    %r13
+  800d5a:	41 5e                	pop    %r14
+  800d5c:	41 5f                	pop    %r15
+  800d5e:	5d                   	pop    %rbp
+  800d5f:	c3                   	ret
+
+0000000000800d60 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800d60:	55                   	push   %rbp
+  800d61:	48 89 e5             	mov    %rsp,%rbp
+  800d64:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800d68:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800d6c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800d71:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800d75:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800d7c:	48 85 ff             	test   %rdi,%rdi
+  800d7f:	74 2b                	je     800dac <vsnprintf+0x4c>
+  800d81:	48 85 f6             	test   %rsi,%rsi
+  800d84:	74 26                	je     800dac <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800d86:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d8a:	48 bf 04 06 80 00 00 	movabs $0x800604,%rdi
+  800d91:	00 00 00 
+  800d94:	48 b8 59 06 80 00 00 	movabs $0x800659,%rax
+  800d9b:	00 00 00 
+  800d9e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800da0:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800da4:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800da7:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800daa:	c9                   	leave
+  800dab:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800dac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800db1:	eb f7                	jmp    800daa <vsnprintf+0x4a>
+
+0000000000800db3 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800db3:	55                   	push   %rbp
+  800db4:	48 89 e5             	mov    %rsp,%rbp
+  800db7:	48 83 ec 50          	sub    $0x50,%rsp
+  800dbb:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800dbf:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dc3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800dc7:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800dce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800dd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800dda:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800dde:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800de2:	48 b8 60 0d 80 00 00 	movabs $0x800d60,%rax
+  800de9:	00 00 00 
+  800dec:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800dee:	c9                   	leave
+  800def:	c3                   	ret
+
+0000000000800df0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800df0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800df3:	74 10                	je     800e05 <strlen+0x15>
+    size_t n = 0;
+  800df5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800dfa:	48 83 c0 01          	add    $0x1,%rax
+  800dfe:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e02:	75 f6                	jne    800dfa <strlen+0xa>
+  800e04:	c3                   	ret
+    size_t n = 0;
+  800e05:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e0a:	c3                   	ret
+
+0000000000800e0b <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e0b:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e0e:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e13:	48 85 f6             	test   %rsi,%rsi
+  800e16:	74 11                	je     800e29 <strnlen+0x1e>
+  800e18:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e1c:	74 0c                	je     800e2a <strnlen+0x1f>
+  800e1e:	48 83 c2 01          	add    $0x1,%rdx
+  800e22:	48 39 d0             	cmp    %rdx,%rax
+  800e25:	75 f1                	jne    800e18 <strnlen+0xd>
+  800e27:	eb 04                	jmp    800e2d <strnlen+0x22>
+  800e29:	c3                   	ret
+  800e2a:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800e2d:	c3                   	ret
+
+0000000000800e2e <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800e2e:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800e31:	ba 00 00 00 00       	mov    $0x0,%edx
+  800e36:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800e3a:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800e3d:	48 83 c2 01          	add    $0x1,%rdx
+  800e41:	84 c9                	test   %cl,%cl
+  800e43:	75 f1                	jne    800e36 <strcpy+0x8>
+        ;
+    return res;
+}
+  800e45:	c3                   	ret
+
+0000000000800e46 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800e46:	55                   	push   %rbp
+  800e47:	48 89 e5             	mov    %rsp,%rbp
+  800e4a:	41 54                	push   %r12
+  800e4c:	53                   	push   %rbx
+  800e4d:	48 89 fb             	mov    %rdi,%rbx
+  800e50:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800e53:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  800e5a:	00 00 00 
+  800e5d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800e5f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800e63:	4c 89 e6             	mov    %r12,%rsi
+  800e66:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  800e6d:	00 00 00 
+  800e70:	ff d0                	call   *%rax
+    return dst;
+}
+  800e72:	48 89 d8             	mov    %rbx,%rax
+  800e75:	5b                   	pop    %rbx
+  800e76:	41 5c                	pop    %r12
+  800e78:	5d                   	pop    %rbp
+  800e79:	c3                   	ret
+
+0000000000800e7a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800e7a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800e7d:	48 85 d2             	test   %rdx,%rdx
+  800e80:	74 1f                	je     800ea1 <strncpy+0x27>
+  800e82:	48 01 fa             	add    %rdi,%rdx
+  800e85:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800e88:	48 83 c1 01          	add    $0x1,%rcx
+  800e8c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e90:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e94:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e98:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e9c:	48 39 ca             	cmp    %rcx,%rdx
+  800e9f:	75 e7                	jne    800e88 <strncpy+0xe>
+    }
+    return ret;
+}
+  800ea1:	c3                   	ret
+
+0000000000800ea2 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ea2:	48 89 f8             	mov    %rdi,%rax
+  800ea5:	48 85 d2             	test   %rdx,%rdx
+  800ea8:	74 24                	je     800ece <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800eaa:	48 83 ea 01          	sub    $0x1,%rdx
+  800eae:	74 1b                	je     800ecb <strlcpy+0x29>
+  800eb0:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800eb4:	0f b6 16             	movzbl (%rsi),%edx
+  800eb7:	84 d2                	test   %dl,%dl
+  800eb9:	74 10                	je     800ecb <strlcpy+0x29>
+            *dst++ = *src++;
+  800ebb:	48 83 c6 01          	add    $0x1,%rsi
+  800ebf:	48 83 c0 01          	add    $0x1,%rax
+  800ec3:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800ec6:	48 39 c8             	cmp    %rcx,%rax
+  800ec9:	75 e9                	jne    800eb4 <strlcpy+0x12>
+        *dst = '\0';
+  800ecb:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ece:	48 29 f8             	sub    %rdi,%rax
+}
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ed2:	0f b6 07             	movzbl (%rdi),%eax
+  800ed5:	84 c0                	test   %al,%al
+  800ed7:	74 13                	je     800eec <strcmp+0x1a>
+  800ed9:	38 06                	cmp    %al,(%rsi)
+  800edb:	75 0f                	jne    800eec <strcmp+0x1a>
+  800edd:	48 83 c7 01          	add    $0x1,%rdi
+  800ee1:	48 83 c6 01          	add    $0x1,%rsi
+  800ee5:	0f b6 07             	movzbl (%rdi),%eax
+  800ee8:	84 c0                	test   %al,%al
+  800eea:	75 ed                	jne    800ed9 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800eec:	0f b6 c0             	movzbl %al,%eax
+  800eef:	0f b6 16             	movzbl (%rsi),%edx
+  800ef2:	29 d0                	sub    %edx,%eax
+}
+  800ef4:	c3                   	ret
+
+0000000000800ef5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ef5:	48 85 d2             	test   %rdx,%rdx
+  800ef8:	74 1f                	je     800f19 <strncmp+0x24>
+  800efa:	0f b6 07             	movzbl (%rdi),%eax
+  800efd:	84 c0                	test   %al,%al
+  800eff:	74 1e                	je     800f1f <strncmp+0x2a>
+  800f01:	3a 06                	cmp    (%rsi),%al
+  800f03:	75 1a                	jne    800f1f <strncmp+0x2a>
+  800f05:	48 83 c7 01          	add    $0x1,%rdi
+  800f09:	48 83 c6 01          	add    $0x1,%rsi
+  800f0d:	48 83 ea 01          	sub    $0x1,%rdx
+  800f11:	75 e7                	jne    800efa <strncmp+0x5>
+
+    if (!n) return 0;
+  800f13:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f18:	c3                   	ret
+  800f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1e:	c3                   	ret
+  800f1f:	48 85 d2             	test   %rdx,%rdx
+  800f22:	74 09                	je     800f2d <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f24:	0f b6 07             	movzbl (%rdi),%eax
+  800f27:	0f b6 16             	movzbl (%rsi),%edx
+  800f2a:	29 d0                	sub    %edx,%eax
+  800f2c:	c3                   	ret
+    if (!n) return 0;
+  800f2d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f32:	c3                   	ret
+
+0000000000800f33 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800f33:	0f b6 17             	movzbl (%rdi),%edx
+  800f36:	84 d2                	test   %dl,%dl
+  800f38:	74 18                	je     800f52 <strchr+0x1f>
+        if (*str == c) {
+  800f3a:	0f be d2             	movsbl %dl,%edx
+  800f3d:	39 f2                	cmp    %esi,%edx
+  800f3f:	74 17                	je     800f58 <strchr+0x25>
+    for (; *str; str++) {
+  800f41:	48 83 c7 01          	add    $0x1,%rdi
+  800f45:	0f b6 17             	movzbl (%rdi),%edx
+  800f48:	84 d2                	test   %dl,%dl
+  800f4a:	75 ee                	jne    800f3a <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f51:	c3                   	ret
+  800f52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f57:	c3                   	ret
+  800f58:	48 89 f8             	mov    %rdi,%rax
+}
+  800f5b:	c3                   	ret
+
+0000000000800f5c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800f5c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800f5f:	0f b6 17             	movzbl (%rdi),%edx
+  800f62:	84 d2                	test   %dl,%dl
+  800f64:	74 13                	je     800f79 <strfind+0x1d>
+  800f66:	0f be d2             	movsbl %dl,%edx
+  800f69:	39 f2                	cmp    %esi,%edx
+  800f6b:	74 0b                	je     800f78 <strfind+0x1c>
+  800f6d:	48 83 c0 01          	add    $0x1,%rax
+  800f71:	0f b6 10             	movzbl (%rax),%edx
+  800f74:	84 d2                	test   %dl,%dl
+  800f76:	75 ee                	jne    800f66 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800f78:	c3                   	ret
+  800f79:	c3                   	ret
+
+0000000000800f7a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800f7a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800f7d:	48 89 f8             	mov    %rdi,%rax
+  800f80:	48 f7 d8             	neg    %rax
+  800f83:	83 e0 07             	and    $0x7,%eax
+  800f86:	49 89 d1             	mov    %rdx,%r9
+  800f89:	49 29 c1             	sub    %rax,%r9
+  800f8c:	78 36                	js     800fc4 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f8e:	40 0f b6 c6          	movzbl %sil,%eax
+  800f92:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f99:	01 01 01 
+  800f9c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800fa0:	40 f6 c7 07          	test   $0x7,%dil
+  800fa4:	75 38                	jne    800fde <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800fa6:	4c 89 c9             	mov    %r9,%rcx
+  800fa9:	48 c1 f9 03          	sar    $0x3,%rcx
+  800fad:	74 0c                	je     800fbb <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800faf:	fc                   	cld
+  800fb0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800fb3:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800fb7:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800fbb:	4d 85 c9             	test   %r9,%r9
+  800fbe:	75 45                	jne    801005 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800fc0:	4c 89 c0             	mov    %r8,%rax
+  800fc3:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800fc4:	48 85 d2             	test   %rdx,%rdx
+  800fc7:	74 f7                	je     800fc0 <memset+0x46>
+  800fc9:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800fcc:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800fcf:	48 83 c0 01          	add    $0x1,%rax
+  800fd3:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800fd7:	48 39 c2             	cmp    %rax,%rdx
+  800fda:	75 f3                	jne    800fcf <memset+0x55>
+  800fdc:	eb e2                	jmp    800fc0 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800fde:	40 f6 c7 01          	test   $0x1,%dil
+  800fe2:	74 06                	je     800fea <memset+0x70>
+  800fe4:	88 07                	mov    %al,(%rdi)
+  800fe6:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800fea:	40 f6 c7 02          	test   $0x2,%dil
+  800fee:	74 07                	je     800ff7 <memset+0x7d>
+  800ff0:	66 89 07             	mov    %ax,(%rdi)
+  800ff3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ff7:	40 f6 c7 04          	test   $0x4,%dil
+  800ffb:	74 a9                	je     800fa6 <memset+0x2c>
+  800ffd:	89 07                	mov    %eax,(%rdi)
+  800fff:	48 83 c7 04          	add    $0x4,%rdi
+  801003:	eb a1                	jmp    800fa6 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801005:	41 f6 c1 04          	test   $0x4,%r9b
+  801009:	74 06                	je     801011 <memset+0x97>
+  80100b:	89 07                	mov    %eax,(%rdi)
+  80100d:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801011:	41 f6 c1 02          	test   $0x2,%r9b
+  801015:	74 07                	je     80101e <memset+0xa4>
+  801017:	66 89 07             	mov    %ax,(%rdi)
+  80101a:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80101e:	41 f6 c1 01          	test   $0x1,%r9b
+  801022:	74 9c                	je     800fc0 <memset+0x46>
+  801024:	88 07                	mov    %al,(%rdi)
+  801026:	eb 98                	jmp    800fc0 <memset+0x46>
+
+0000000000801028 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801028:	48 89 f8             	mov    %rdi,%rax
+  80102b:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80102e:	48 39 fe             	cmp    %rdi,%rsi
+  801031:	73 3b                	jae    80106e <memmove+0x46>
+  801033:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801037:	48 39 d7             	cmp    %rdx,%rdi
+  80103a:	73 32                	jae    80106e <memmove+0x46>
+        s += n;
+        d += n;
+  80103c:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801040:	48 89 d6             	mov    %rdx,%rsi
+  801043:	48 09 fe             	or     %rdi,%rsi
+  801046:	48 09 ce             	or     %rcx,%rsi
+  801049:	40 f6 c6 07          	test   $0x7,%sil
+  80104d:	75 12                	jne    801061 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80104f:	48 83 ef 08          	sub    $0x8,%rdi
+  801053:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801057:	48 c1 e9 03          	shr    $0x3,%rcx
+  80105b:	fd                   	std
+  80105c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80105f:	fc                   	cld
+  801060:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801061:	48 83 ef 01          	sub    $0x1,%rdi
+  801065:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801069:	fd                   	std
+  80106a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80106c:	eb f1                	jmp    80105f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80106e:	48 89 f2             	mov    %rsi,%rdx
+  801071:	48 09 c2             	or     %rax,%rdx
+  801074:	48 09 ca             	or     %rcx,%rdx
+  801077:	f6 c2 07             	test   $0x7,%dl
+  80107a:	75 0c                	jne    801088 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80107c:	48 c1 e9 03          	shr    $0x3,%rcx
+  801080:	48 89 c7             	mov    %rax,%rdi
+  801083:	fc                   	cld
+  801084:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801087:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801088:	48 89 c7             	mov    %rax,%rdi
+  80108b:	fc                   	cld
+  80108c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80108e:	c3                   	ret
+
+000000000080108f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80108f:	55                   	push   %rbp
+  801090:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801093:	48 b8 28 10 80 00 00 	movabs $0x801028,%rax
+  80109a:	00 00 00 
+  80109d:	ff d0                	call   *%rax
+}
+  80109f:	5d                   	pop    %rbp
+  8010a0:	c3                   	ret
+
+00000000008010a1 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8010a1:	55                   	push   %rbp
+  8010a2:	48 89 e5             	mov    %rsp,%rbp
+  8010a5:	41 57                	push   %r15
+  8010a7:	41 56                	push   %r14
+  8010a9:	41 55                	push   %r13
+  8010ab:	41 54                	push   %r12
+  8010ad:	53                   	push   %rbx
+  8010ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8010b2:	49 89 fe             	mov    %rdi,%r14
+  8010b5:	49 89 f7             	mov    %rsi,%r15
+  8010b8:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8010bb:	48 89 f7             	mov    %rsi,%rdi
+  8010be:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  8010c5:	00 00 00 
+  8010c8:	ff d0                	call   *%rax
+  8010ca:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8010cd:	48 89 de             	mov    %rbx,%rsi
+  8010d0:	4c 89 f7             	mov    %r14,%rdi
+  8010d3:	48 b8 0b 0e 80 00 00 	movabs $0x800e0b,%rax
+  8010da:	00 00 00 
+  8010dd:	ff d0                	call   *%rax
+  8010df:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8010e2:	48 39 c3             	cmp    %rax,%rbx
+  8010e5:	74 36                	je     80111d <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8010e7:	48 89 d8             	mov    %rbx,%rax
+  8010ea:	4c 29 e8             	sub    %r13,%rax
+  8010ed:	49 39 c4             	cmp    %rax,%r12
+  8010f0:	73 31                	jae    801123 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8010f2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8010f7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010fb:	4c 89 fe             	mov    %r15,%rsi
+  8010fe:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  801105:	00 00 00 
+  801108:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80110a:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80110e:	48 83 c4 08          	add    $0x8,%rsp
+  801112:	5b                   	pop    %rbx
+  801113:	41 5c                	pop    %r12
+  801115:	41 5d                	pop    %r13
+  801117:	41 5e                	pop    %r14
+  801119:	41 5f                	pop    %r15
+  80111b:	5d                   	pop    %rbp
+  80111c:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80111d:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801121:	eb eb                	jmp    80110e <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801123:	48 83 eb 01          	sub    $0x1,%rbx
+  801127:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80112b:	48 89 da             	mov    %rbx,%rdx
+  80112e:	4c 89 fe             	mov    %r15,%rsi
+  801131:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  801138:	00 00 00 
+  80113b:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80113d:	49 01 de             	add    %rbx,%r14
+  801140:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801145:	eb c3                	jmp    80110a <strlcat+0x69>
+
+0000000000801147 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801147:	48 85 d2             	test   %rdx,%rdx
+  80114a:	74 2d                	je     801179 <memcmp+0x32>
+  80114c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801151:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801155:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80115a:	44 38 c1             	cmp    %r8b,%cl
+  80115d:	75 0f                	jne    80116e <memcmp+0x27>
+    while (n-- > 0) {
+  80115f:	48 83 c0 01          	add    $0x1,%rax
+  801163:	48 39 c2             	cmp    %rax,%rdx
+  801166:	75 e9                	jne    801151 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801168:	b8 00 00 00 00       	mov    $0x0,%eax
+  80116d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80116e:	0f b6 c1             	movzbl %cl,%eax
+  801171:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801175:	44 29 c0             	sub    %r8d,%eax
+  801178:	c3                   	ret
+    return 0;
+  801179:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80117e:	c3                   	ret
+
+000000000080117f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80117f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801183:	48 39 c7             	cmp    %rax,%rdi
+  801186:	73 0f                	jae    801197 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801188:	40 38 37             	cmp    %sil,(%rdi)
+  80118b:	74 0e                	je     80119b <memfind+0x1c>
+    for (; src < end; src++) {
+  80118d:	48 83 c7 01          	add    $0x1,%rdi
+  801191:	48 39 f8             	cmp    %rdi,%rax
+  801194:	75 f2                	jne    801188 <memfind+0x9>
+  801196:	c3                   	ret
+  801197:	48 89 f8             	mov    %rdi,%rax
+  80119a:	c3                   	ret
+  80119b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80119e:	c3                   	ret
+
+000000000080119f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80119f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8011a2:	0f b6 37             	movzbl (%rdi),%esi
+  8011a5:	40 80 fe 20          	cmp    $0x20,%sil
+  8011a9:	74 06                	je     8011b1 <strtol+0x12>
+  8011ab:	40 80 fe 09          	cmp    $0x9,%sil
+  8011af:	75 13                	jne    8011c4 <strtol+0x25>
+  8011b1:	48 83 c7 01          	add    $0x1,%rdi
+  8011b5:	0f b6 37             	movzbl (%rdi),%esi
+  8011b8:	40 80 fe 20          	cmp    $0x20,%sil
+  8011bc:	74 f3                	je     8011b1 <strtol+0x12>
+  8011be:	40 80 fe 09          	cmp    $0x9,%sil
+  8011c2:	74 ed                	je     8011b1 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8011c4:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8011c7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8011ca:	3c 01                	cmp    $0x1,%al
+  8011cc:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011d0:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8011d6:	75 0f                	jne    8011e7 <strtol+0x48>
+  8011d8:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8011db:	74 14                	je     8011f1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8011dd:	85 d2                	test   %edx,%edx
+  8011df:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8011e4:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8011e7:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8011ec:	4c 63 ca             	movslq %edx,%r9
+  8011ef:	eb 36                	jmp    801227 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8011f1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8011f5:	74 0f                	je     801206 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8011f7:	85 d2                	test   %edx,%edx
+  8011f9:	75 ec                	jne    8011e7 <strtol+0x48>
+        s++;
+  8011fb:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8011ff:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801204:	eb e1                	jmp    8011e7 <strtol+0x48>
+        s += 2;
+  801206:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80120a:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80120f:	eb d6                	jmp    8011e7 <strtol+0x48>
+            dig -= '0';
+  801211:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801214:	44 0f b6 c1          	movzbl %cl,%r8d
+  801218:	41 39 d0             	cmp    %edx,%r8d
+  80121b:	7d 21                	jge    80123e <strtol+0x9f>
+        val = val * base + dig;
+  80121d:	49 0f af c1          	imul   %r9,%rax
+  801221:	0f b6 c9             	movzbl %cl,%ecx
+  801224:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801227:	48 83 c7 01          	add    $0x1,%rdi
+  80122b:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80122f:	80 f9 39             	cmp    $0x39,%cl
+  801232:	76 dd                	jbe    801211 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801234:	80 f9 7b             	cmp    $0x7b,%cl
+  801237:	77 05                	ja     80123e <strtol+0x9f>
+            dig -= 'a' - 10;
+  801239:	83 e9 57             	sub    $0x57,%ecx
+  80123c:	eb d6                	jmp    801214 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80123e:	4d 85 d2             	test   %r10,%r10
+  801241:	74 03                	je     801246 <strtol+0xa7>
+  801243:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801246:	48 89 c2             	mov    %rax,%rdx
+  801249:	48 f7 da             	neg    %rdx
+  80124c:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801250:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801254:	c3                   	ret
+
+0000000000801255 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801255:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80125a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80125f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801265:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80126b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801271:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801273:	c3                   	ret
+
+0000000000801274 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801274:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801279:	bf 00 00 00 00       	mov    $0x0,%edi
+  80127e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801283:	ba 00 00 00 00       	mov    $0x0,%edx
+  801288:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801294:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80129a:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129c:	c3                   	ret
+
+000000000080129d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80129d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012a5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012c3:	48 85 c0             	test   %rax,%rax
+  8012c6:	7f 01                	jg     8012c9 <sys_env_destroy+0x2c>
+}
+  8012c8:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8012c9:	55                   	push   %rbp
+  8012ca:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012cd:	49 89 c0             	mov    %rax,%r8
+  8012d0:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8012d5:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8012dc:	00 00 00 
+  8012df:	be 29 00 00 00       	mov    $0x29,%esi
+  8012e4:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8012eb:	00 00 00 
+  8012ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012f3:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8012fa:	00 00 00 
+  8012fd:	41 ff d1             	call   *%r9
+
+0000000000801300 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801300:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801305:	bf 00 00 00 00       	mov    $0x0,%edi
+  80130a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801314:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80131a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801320:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801326:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801328:	c3                   	ret
+
+0000000000801329 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801329:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80132e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801333:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801338:	ba 00 00 00 00       	mov    $0x0,%edx
+  80133d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801343:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801349:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80134f:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801351:	c3                   	ret
+
+0000000000801352 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801352:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801357:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80135e:	00 00 00 
+  801361:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801367:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80136d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801373:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801375:	c3                   	ret
+
+0000000000801376 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801376:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801379:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801384:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80138a:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80138c:	c3                   	ret
+
+000000000080138d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80138d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801390:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801395:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801398:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80139e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a6:	48 85 c0             	test   %rax,%rax
+  8013a9:	7f 01                	jg     8013ac <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8013ab:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b0:	49 89 c0             	mov    %rax,%r8
+  8013b3:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8013b8:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8013bf:	00 00 00 
+  8013c2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c7:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8013ce:	00 00 00 
+  8013d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d6:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8013dd:	00 00 00 
+  8013e0:	41 ff d1             	call   *%r9
+
+00000000008013e3 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013e3:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8013e6:	48 63 d2             	movslq %edx,%rdx
+  8013e9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ec:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f1:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8013f4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f6:	48 85 c0             	test   %rax,%rax
+  8013f9:	7f 01                	jg     8013fc <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8013fb:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8013fc:	55                   	push   %rbp
+  8013fd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801400:	49 89 c0             	mov    %rax,%r8
+  801403:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801408:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  80140f:	00 00 00 
+  801412:	be 29 00 00 00       	mov    $0x29,%esi
+  801417:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  80141e:	00 00 00 
+  801421:	b8 00 00 00 00       	mov    $0x0,%eax
+  801426:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  80142d:	00 00 00 
+  801430:	41 ff d1             	call   *%r9
+
+0000000000801433 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801433:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801436:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80143b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801441:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801447:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80144f:	48 85 c0             	test   %rax,%rax
+  801452:	7f 01                	jg     801455 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801454:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801455:	55                   	push   %rbp
+  801456:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801459:	49 89 c0             	mov    %rax,%r8
+  80145c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801461:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801468:	00 00 00 
+  80146b:	be 29 00 00 00       	mov    $0x29,%esi
+  801470:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801477:	00 00 00 
+  80147a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80147f:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  801486:	00 00 00 
+  801489:	41 ff d1             	call   *%r9
+
+000000000080148c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80148c:	48 63 f6             	movslq %esi,%rsi
+  80148f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801492:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801497:	ba 00 00 00 00       	mov    $0x0,%edx
+  80149c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ae:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014b0:	48 85 c0             	test   %rax,%rax
+  8014b3:	7f 01                	jg     8014b6 <sys_env_set_status+0x2a>
+}
+  8014b5:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8014b6:	55                   	push   %rbp
+  8014b7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ba:	49 89 c0             	mov    %rax,%r8
+  8014bd:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8014c2:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8014c9:	00 00 00 
+  8014cc:	be 29 00 00 00       	mov    $0x29,%esi
+  8014d1:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8014d8:	00 00 00 
+  8014db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014e0:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8014e7:	00 00 00 
+  8014ea:	41 ff d1             	call   *%r9
+
+00000000008014ed <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8014ed:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014f0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014fa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801500:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801506:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80150c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80150e:	48 85 c0             	test   %rax,%rax
+  801511:	7f 01                	jg     801514 <sys_env_set_trapframe+0x27>
+}
+  801513:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801514:	55                   	push   %rbp
+  801515:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801518:	49 89 c0             	mov    %rax,%r8
+  80151b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801520:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801527:	00 00 00 
+  80152a:	be 29 00 00 00       	mov    $0x29,%esi
+  80152f:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801536:	00 00 00 
+  801539:	b8 00 00 00 00       	mov    $0x0,%eax
+  80153e:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  801545:	00 00 00 
+  801548:	41 ff d1             	call   *%r9
+
+000000000080154b <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80154b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80154e:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801553:	ba 00 00 00 00       	mov    $0x0,%edx
+  801558:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801564:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80156a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80156c:	48 85 c0             	test   %rax,%rax
+  80156f:	7f 01                	jg     801572 <sys_env_set_pgfault_upcall+0x27>
+}
+  801571:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801572:	55                   	push   %rbp
+  801573:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801576:	49 89 c0             	mov    %rax,%r8
+  801579:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80157e:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801585:	00 00 00 
+  801588:	be 29 00 00 00       	mov    $0x29,%esi
+  80158d:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801594:	00 00 00 
+  801597:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159c:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8015a3:	00 00 00 
+  8015a6:	41 ff d1             	call   *%r9
+
+00000000008015a9 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015a9:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015ac:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015af:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b4:	4d 63 c0             	movslq %r8d,%r8
+  8015b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015bd:	0f 05                	syscall
+}
+  8015bf:	c3                   	ret
+
+00000000008015c0 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8015c0:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8015c3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c6:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015cb:	4d 63 c0             	movslq %r8d,%r8
+  8015ce:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d4:	0f 05                	syscall
+}
+  8015d6:	c3                   	ret
+
+00000000008015d7 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015d7:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015dc:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015df:	45 89 c0             	mov    %r8d,%r8d
+  8015e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015ea:	48 85 c0             	test   %rax,%rax
+  8015ed:	7f 01                	jg     8015f0 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8015ef:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8015f0:	55                   	push   %rbp
+  8015f1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f4:	49 89 c0             	mov    %rax,%r8
+  8015f7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8015fc:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  801603:	00 00 00 
+  801606:	be 29 00 00 00       	mov    $0x29,%esi
+  80160b:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  801612:	00 00 00 
+  801615:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161a:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  801621:	00 00 00 
+  801624:	41 ff d1             	call   *%r9
+
+0000000000801627 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801627:	55                   	push   %rbp
+  801628:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80162b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801631:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801636:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163b:	48 b8 d7 15 80 00 00 	movabs $0x8015d7,%rax
+  801642:	00 00 00 
+  801645:	ff d0                	call   *%rax
+}
+  801647:	5d                   	pop    %rbp
+  801648:	c3                   	ret
+
+0000000000801649 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801649:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801653:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801658:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801669:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166f:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801671:	c3                   	ret
+
+0000000000801672 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801672:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801677:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80167c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801681:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801687:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80168d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801693:	0f 05                	syscall
+    if (check && ret > 0) {
+  801695:	48 85 c0             	test   %rax,%rax
+  801698:	7f 01                	jg     80169b <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80169a:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80169b:	55                   	push   %rbp
+  80169c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169f:	49 89 c0             	mov    %rax,%r8
+  8016a2:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8016a7:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  8016ae:	00 00 00 
+  8016b1:	be 29 00 00 00       	mov    $0x29,%esi
+  8016b6:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8016bd:	00 00 00 
+  8016c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c5:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8016cc:	00 00 00 
+  8016cf:	41 ff d1             	call   *%r9
+
+00000000008016d2 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016d2:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016dc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f8:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016fa:	c3                   	ret
+
+00000000008016fb <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8016fb:	89 d2                	mov    %edx,%edx
+  8016fd:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ff:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801704:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80170a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801710:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801716:	0f 05                	syscall
+}
+  801718:	c3                   	ret
+
+0000000000801719 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801719:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80171c:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801721:	ba 00 00 00 00       	mov    $0x0,%edx
+  801726:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80172c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801732:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801738:	0f 05                	syscall
+}
+  80173a:	c3                   	ret
+
+000000000080173b <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80173b:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80173e:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801743:	ba 00 00 00 00       	mov    $0x0,%edx
+  801748:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80174e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801754:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80175a:	0f 05                	syscall
+}
+  80175c:	c3                   	ret
+
+000000000080175d <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80175d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801760:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801765:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80176a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80176f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801775:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80177b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801781:	0f 05                	syscall
+    if (check && ret > 0) {
+  801783:	48 85 c0             	test   %rax,%rax
+  801786:	7f 01                	jg     801789 <sys_irq_ack+0x2c>
+}
+  801788:	c3                   	ret
+sys_irq_ack(int irq) {
+  801789:	55                   	push   %rbp
+  80178a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80178d:	49 89 c0             	mov    %rax,%r8
+  801790:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801795:	48 ba 78 4f 80 00 00 	movabs $0x804f78,%rdx
+  80179c:	00 00 00 
+  80179f:	be 29 00 00 00       	mov    $0x29,%esi
+  8017a4:	48 bf 97 4f 80 00 00 	movabs $0x804f97,%rdi
+  8017ab:	00 00 00 
+  8017ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017b3:	49 b9 b9 03 80 00 00 	movabs $0x8003b9,%r9
+  8017ba:	00 00 00 
+  8017bd:	41 ff d1             	call   *%r9
+
+00000000008017c0 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017c0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017c7:	ff ff ff 
+  8017ca:	48 01 f8             	add    %rdi,%rax
+  8017cd:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8017d1:	c3                   	ret
+
+00000000008017d2 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8017d2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8017d9:	ff ff ff 
+  8017dc:	48 01 f8             	add    %rdi,%rax
+  8017df:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8017e3:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8017e9:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8017ed:	c3                   	ret
+
+00000000008017ee <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8017ee:	55                   	push   %rbp
+  8017ef:	48 89 e5             	mov    %rsp,%rbp
+  8017f2:	41 57                	push   %r15
+  8017f4:	41 56                	push   %r14
+  8017f6:	41 55                	push   %r13
+  8017f8:	41 54                	push   %r12
+  8017fa:	53                   	push   %rbx
+  8017fb:	48 83 ec 08          	sub    $0x8,%rsp
+  8017ff:	49 89 ff             	mov    %rdi,%r15
+  801802:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801807:	49 bd 7d 3f 80 00 00 	movabs $0x803f7d,%r13
+  80180e:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801811:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801817:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80181a:	48 89 df             	mov    %rbx,%rdi
+  80181d:	41 ff d5             	call   *%r13
+  801820:	83 e0 04             	and    $0x4,%eax
+  801823:	74 17                	je     80183c <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801825:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80182c:	4c 39 f3             	cmp    %r14,%rbx
+  80182f:	75 e6                	jne    801817 <fd_alloc+0x29>
+  801831:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801837:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80183c:	4d 89 27             	mov    %r12,(%r15)
+}
+  80183f:	48 83 c4 08          	add    $0x8,%rsp
+  801843:	5b                   	pop    %rbx
+  801844:	41 5c                	pop    %r12
+  801846:	41 5d                	pop    %r13
+  801848:	41 5e                	pop    %r14
+  80184a:	41 5f                	pop    %r15
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+
+000000000080184e <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80184e:	83 ff 1f             	cmp    $0x1f,%edi
+  801851:	77 39                	ja     80188c <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801853:	55                   	push   %rbp
+  801854:	48 89 e5             	mov    %rsp,%rbp
+  801857:	41 54                	push   %r12
+  801859:	53                   	push   %rbx
+  80185a:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80185d:	48 63 df             	movslq %edi,%rbx
+  801860:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801867:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80186b:	48 89 df             	mov    %rbx,%rdi
+  80186e:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  801875:	00 00 00 
+  801878:	ff d0                	call   *%rax
+  80187a:	a8 04                	test   $0x4,%al
+  80187c:	74 14                	je     801892 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80187e:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801882:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801887:	5b                   	pop    %rbx
+  801888:	41 5c                	pop    %r12
+  80188a:	5d                   	pop    %rbp
+  80188b:	c3                   	ret
+        return -E_INVAL;
+  80188c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801891:	c3                   	ret
+        return -E_INVAL;
+  801892:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801897:	eb ee                	jmp    801887 <fd_lookup+0x39>
+
+0000000000801899 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801899:	55                   	push   %rbp
+  80189a:	48 89 e5             	mov    %rsp,%rbp
+  80189d:	41 54                	push   %r12
+  80189f:	53                   	push   %rbx
+  8018a0:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8018a3:	48 b8 40 50 80 00 00 	movabs $0x805040,%rax
+  8018aa:	00 00 00 
+  8018ad:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8018b4:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8018b7:	39 3b                	cmp    %edi,(%rbx)
+  8018b9:	74 47                	je     801902 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8018bb:	48 83 c0 08          	add    $0x8,%rax
+  8018bf:	48 8b 18             	mov    (%rax),%rbx
+  8018c2:	48 85 db             	test   %rbx,%rbx
+  8018c5:	75 f0                	jne    8018b7 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8018c7:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8018ce:	00 00 00 
+  8018d1:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018d7:	89 fa                	mov    %edi,%edx
+  8018d9:	48 bf a8 4f 80 00 00 	movabs $0x804fa8,%rdi
+  8018e0:	00 00 00 
+  8018e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e8:	48 b9 09 05 80 00 00 	movabs $0x800509,%rcx
+  8018ef:	00 00 00 
+  8018f2:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8018f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8018f9:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8018fd:	5b                   	pop    %rbx
+  8018fe:	41 5c                	pop    %r12
+  801900:	5d                   	pop    %rbp
+  801901:	c3                   	ret
+            return 0;
+  801902:	b8 00 00 00 00       	mov    $0x0,%eax
+  801907:	eb f0                	jmp    8018f9 <dev_lookup+0x60>
+
+0000000000801909 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801909:	55                   	push   %rbp
+  80190a:	48 89 e5             	mov    %rsp,%rbp
+  80190d:	41 55                	push   %r13
+  80190f:	41 54                	push   %r12
+  801911:	53                   	push   %rbx
+  801912:	48 83 ec 18          	sub    $0x18,%rsp
+  801916:	48 89 fb             	mov    %rdi,%rbx
+  801919:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80191c:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801923:	ff ff ff 
+  801926:	48 01 df             	add    %rbx,%rdi
+  801929:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80192d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801931:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801938:	00 00 00 
+  80193b:	ff d0                	call   *%rax
+  80193d:	41 89 c5             	mov    %eax,%r13d
+  801940:	85 c0                	test   %eax,%eax
+  801942:	78 06                	js     80194a <fd_close+0x41>
+  801944:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801948:	74 1a                	je     801964 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80194a:	45 84 e4             	test   %r12b,%r12b
+  80194d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801952:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801956:	44 89 e8             	mov    %r13d,%eax
+  801959:	48 83 c4 18          	add    $0x18,%rsp
+  80195d:	5b                   	pop    %rbx
+  80195e:	41 5c                	pop    %r12
+  801960:	41 5d                	pop    %r13
+  801962:	5d                   	pop    %rbp
+  801963:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801964:	8b 3b                	mov    (%rbx),%edi
+  801966:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80196a:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801971:	00 00 00 
+  801974:	ff d0                	call   *%rax
+  801976:	41 89 c5             	mov    %eax,%r13d
+  801979:	85 c0                	test   %eax,%eax
+  80197b:	78 1b                	js     801998 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80197d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801981:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801985:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80198b:	48 85 c0             	test   %rax,%rax
+  80198e:	74 08                	je     801998 <fd_close+0x8f>
+  801990:	48 89 df             	mov    %rbx,%rdi
+  801993:	ff d0                	call   *%rax
+  801995:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801998:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80199d:	48 89 de             	mov    %rbx,%rsi
+  8019a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019a5:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  8019ac:	00 00 00 
+  8019af:	ff d0                	call   *%rax
+    return res;
+  8019b1:	eb a3                	jmp    801956 <fd_close+0x4d>
+
+00000000008019b3 <close>:
+
+int
+close(int fdnum) {
+  8019b3:	55                   	push   %rbp
+  8019b4:	48 89 e5             	mov    %rsp,%rbp
+  8019b7:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8019bb:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8019bf:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  8019c6:	00 00 00 
+  8019c9:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8019cb:	85 c0                	test   %eax,%eax
+  8019cd:	78 15                	js     8019e4 <close+0x31>
+
+    return fd_close(fd, 1);
+  8019cf:	be 01 00 00 00       	mov    $0x1,%esi
+  8019d4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8019d8:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  8019df:	00 00 00 
+  8019e2:	ff d0                	call   *%rax
+}
+  8019e4:	c9                   	leave
+  8019e5:	c3                   	ret
+
+00000000008019e6 <close_all>:
+
+void
+close_all(void) {
+  8019e6:	55                   	push   %rbp
+  8019e7:	48 89 e5             	mov    %rsp,%rbp
+  8019ea:	41 54                	push   %r12
+  8019ec:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8019ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8019f2:	49 bc b3 19 80 00 00 	movabs $0x8019b3,%r12
+  8019f9:	00 00 00 
+  8019fc:	89 df                	mov    %ebx,%edi
+  8019fe:	41 ff d4             	call   *%r12
+  801a01:	83 c3 01             	add    $0x1,%ebx
+  801a04:	83 fb 20             	cmp    $0x20,%ebx
+  801a07:	75 f3                	jne    8019fc <close_all+0x16>
+}
+  801a09:	5b                   	pop    %rbx
+  801a0a:	41 5c                	pop    %r12
+  801a0c:	5d                   	pop    %rbp
+  801a0d:	c3                   	ret
+
+0000000000801a0e <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801a0e:	55                   	push   %rbp
+  801a0f:	48 89 e5             	mov    %rsp,%rbp
+  801a12:	41 57                	push   %r15
+  801a14:	41 56                	push   %r14
+  801a16:	41 55                	push   %r13
+  801a18:	41 54                	push   %r12
+  801a1a:	53                   	push   %rbx
+  801a1b:	48 83 ec 18          	sub    $0x18,%rsp
+  801a1f:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801a22:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801a26:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801a2d:	00 00 00 
+  801a30:	ff d0                	call   *%rax
+  801a32:	89 c3                	mov    %eax,%ebx
+  801a34:	85 c0                	test   %eax,%eax
+  801a36:	0f 88 b8 00 00 00    	js     801af4 <dup+0xe6>
+    close(newfdnum);
+  801a3c:	44 89 e7             	mov    %r12d,%edi
+  801a3f:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  801a46:	00 00 00 
+  801a49:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801a4b:	4d 63 ec             	movslq %r12d,%r13
+  801a4e:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801a55:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801a59:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801a5d:	4c 89 ff             	mov    %r15,%rdi
+  801a60:	49 be d2 17 80 00 00 	movabs $0x8017d2,%r14
+  801a67:	00 00 00 
+  801a6a:	41 ff d6             	call   *%r14
+  801a6d:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801a70:	4c 89 ef             	mov    %r13,%rdi
+  801a73:	41 ff d6             	call   *%r14
+  801a76:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801a79:	48 89 df             	mov    %rbx,%rdi
+  801a7c:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  801a83:	00 00 00 
+  801a86:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801a88:	a8 04                	test   $0x4,%al
+  801a8a:	74 2b                	je     801ab7 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801a8c:	41 89 c1             	mov    %eax,%r9d
+  801a8f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a95:	4c 89 f1             	mov    %r14,%rcx
+  801a98:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a9d:	48 89 de             	mov    %rbx,%rsi
+  801aa0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801aa5:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  801aac:	00 00 00 
+  801aaf:	ff d0                	call   *%rax
+  801ab1:	89 c3                	mov    %eax,%ebx
+  801ab3:	85 c0                	test   %eax,%eax
+  801ab5:	78 4e                	js     801b05 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ab7:	4c 89 ff             	mov    %r15,%rdi
+  801aba:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  801ac1:	00 00 00 
+  801ac4:	ff d0                	call   *%rax
+  801ac6:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801ac9:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801acf:	4c 89 e9             	mov    %r13,%rcx
+  801ad2:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad7:	4c 89 fe             	mov    %r15,%rsi
+  801ada:	bf 00 00 00 00       	mov    $0x0,%edi
+  801adf:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  801ae6:	00 00 00 
+  801ae9:	ff d0                	call   *%rax
+  801aeb:	89 c3                	mov    %eax,%ebx
+  801aed:	85 c0                	test   %eax,%eax
+  801aef:	78 14                	js     801b05 <dup+0xf7>
+
+    return newfdnum;
+  801af1:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801af4:	89 d8                	mov    %ebx,%eax
+  801af6:	48 83 c4 18          	add    $0x18,%rsp
+  801afa:	5b                   	pop    %rbx
+  801afb:	41 5c                	pop    %r12
+  801afd:	41 5d                	pop    %r13
+  801aff:	41 5e                	pop    %r14
+  801b01:	41 5f                	pop    %r15
+  801b03:	5d                   	pop    %rbp
+  801b04:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b0a:	4c 89 ee             	mov    %r13,%rsi
+  801b0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b12:	49 bc 33 14 80 00 00 	movabs $0x801433,%r12
+  801b19:	00 00 00 
+  801b1c:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801b1f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b24:	4c 89 f6             	mov    %r14,%rsi
+  801b27:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b2c:	41 ff d4             	call   *%r12
+    return res;
+  801b2f:	eb c3                	jmp    801af4 <dup+0xe6>
+
+0000000000801b31 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801b31:	55                   	push   %rbp
+  801b32:	48 89 e5             	mov    %rsp,%rbp
+  801b35:	41 56                	push   %r14
+  801b37:	41 55                	push   %r13
+  801b39:	41 54                	push   %r12
+  801b3b:	53                   	push   %rbx
+  801b3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801b40:	89 fb                	mov    %edi,%ebx
+  801b42:	49 89 f4             	mov    %rsi,%r12
+  801b45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b4c:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801b53:	00 00 00 
+  801b56:	ff d0                	call   *%rax
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	78 4c                	js     801ba8 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b60:	41 8b 3e             	mov    (%r14),%edi
+  801b63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b67:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+  801b73:	85 c0                	test   %eax,%eax
+  801b75:	78 35                	js     801bac <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801b77:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801b7b:	83 e0 03             	and    $0x3,%eax
+  801b7e:	83 f8 01             	cmp    $0x1,%eax
+  801b81:	74 2d                	je     801bb0 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b83:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b87:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801b8b:	48 85 c0             	test   %rax,%rax
+  801b8e:	74 56                	je     801be6 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801b90:	4c 89 ea             	mov    %r13,%rdx
+  801b93:	4c 89 e6             	mov    %r12,%rsi
+  801b96:	4c 89 f7             	mov    %r14,%rdi
+  801b99:	ff d0                	call   *%rax
+}
+  801b9b:	48 83 c4 10          	add    $0x10,%rsp
+  801b9f:	5b                   	pop    %rbx
+  801ba0:	41 5c                	pop    %r12
+  801ba2:	41 5d                	pop    %r13
+  801ba4:	41 5e                	pop    %r14
+  801ba6:	5d                   	pop    %rbp
+  801ba7:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ba8:	48 98                	cltq
+  801baa:	eb ef                	jmp    801b9b <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bac:	48 98                	cltq
+  801bae:	eb eb                	jmp    801b9b <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bb0:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801bb7:	00 00 00 
+  801bba:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bc0:	89 da                	mov    %ebx,%edx
+  801bc2:	48 bf e9 4f 80 00 00 	movabs $0x804fe9,%rdi
+  801bc9:	00 00 00 
+  801bcc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd1:	48 b9 09 05 80 00 00 	movabs $0x800509,%rcx
+  801bd8:	00 00 00 
+  801bdb:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801bdd:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801be4:	eb b5                	jmp    801b9b <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801be6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801bed:	eb ac                	jmp    801b9b <read+0x6a>
+
+0000000000801bef <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801bef:	55                   	push   %rbp
+  801bf0:	48 89 e5             	mov    %rsp,%rbp
+  801bf3:	41 57                	push   %r15
+  801bf5:	41 56                	push   %r14
+  801bf7:	41 55                	push   %r13
+  801bf9:	41 54                	push   %r12
+  801bfb:	53                   	push   %rbx
+  801bfc:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c00:	48 85 d2             	test   %rdx,%rdx
+  801c03:	74 54                	je     801c59 <readn+0x6a>
+  801c05:	41 89 fd             	mov    %edi,%r13d
+  801c08:	49 89 f6             	mov    %rsi,%r14
+  801c0b:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801c0e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801c13:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801c18:	49 bf 31 1b 80 00 00 	movabs $0x801b31,%r15
+  801c1f:	00 00 00 
+  801c22:	4c 89 e2             	mov    %r12,%rdx
+  801c25:	48 29 f2             	sub    %rsi,%rdx
+  801c28:	4c 01 f6             	add    %r14,%rsi
+  801c2b:	44 89 ef             	mov    %r13d,%edi
+  801c2e:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801c31:	85 c0                	test   %eax,%eax
+  801c33:	78 20                	js     801c55 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801c35:	01 c3                	add    %eax,%ebx
+  801c37:	85 c0                	test   %eax,%eax
+  801c39:	74 08                	je     801c43 <readn+0x54>
+  801c3b:	48 63 f3             	movslq %ebx,%rsi
+  801c3e:	4c 39 e6             	cmp    %r12,%rsi
+  801c41:	72 df                	jb     801c22 <readn+0x33>
+    }
+    return res;
+  801c43:	48 63 c3             	movslq %ebx,%rax
+}
+  801c46:	48 83 c4 08          	add    $0x8,%rsp
+  801c4a:	5b                   	pop    %rbx
+  801c4b:	41 5c                	pop    %r12
+  801c4d:	41 5d                	pop    %r13
+  801c4f:	41 5e                	pop    %r14
+  801c51:	41 5f                	pop    %r15
+  801c53:	5d                   	pop    %rbp
+  801c54:	c3                   	ret
+        if (inc < 0) return inc;
+  801c55:	48 98                	cltq
+  801c57:	eb ed                	jmp    801c46 <readn+0x57>
+    int inc = 1, res = 0;
+  801c59:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c5e:	eb e3                	jmp    801c43 <readn+0x54>
+
+0000000000801c60 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801c60:	55                   	push   %rbp
+  801c61:	48 89 e5             	mov    %rsp,%rbp
+  801c64:	41 56                	push   %r14
+  801c66:	41 55                	push   %r13
+  801c68:	41 54                	push   %r12
+  801c6a:	53                   	push   %rbx
+  801c6b:	48 83 ec 10          	sub    $0x10,%rsp
+  801c6f:	89 fb                	mov    %edi,%ebx
+  801c71:	49 89 f4             	mov    %rsi,%r12
+  801c74:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c77:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c7b:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	78 47                	js     801cd2 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c8b:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c8f:	41 8b 3e             	mov    (%r14),%edi
+  801c92:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c96:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801c9d:	00 00 00 
+  801ca0:	ff d0                	call   *%rax
+  801ca2:	85 c0                	test   %eax,%eax
+  801ca4:	78 30                	js     801cd6 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ca6:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801cab:	74 2d                	je     801cda <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801cad:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cb1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801cb5:	48 85 c0             	test   %rax,%rax
+  801cb8:	74 56                	je     801d10 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801cba:	4c 89 ea             	mov    %r13,%rdx
+  801cbd:	4c 89 e6             	mov    %r12,%rsi
+  801cc0:	4c 89 f7             	mov    %r14,%rdi
+  801cc3:	ff d0                	call   *%rax
+}
+  801cc5:	48 83 c4 10          	add    $0x10,%rsp
+  801cc9:	5b                   	pop    %rbx
+  801cca:	41 5c                	pop    %r12
+  801ccc:	41 5d                	pop    %r13
+  801cce:	41 5e                	pop    %r14
+  801cd0:	5d                   	pop    %rbp
+  801cd1:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd2:	48 98                	cltq
+  801cd4:	eb ef                	jmp    801cc5 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd6:	48 98                	cltq
+  801cd8:	eb eb                	jmp    801cc5 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cda:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801ce1:	00 00 00 
+  801ce4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cea:	89 da                	mov    %ebx,%edx
+  801cec:	48 bf 05 50 80 00 00 	movabs $0x805005,%rdi
+  801cf3:	00 00 00 
+  801cf6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cfb:	48 b9 09 05 80 00 00 	movabs $0x800509,%rcx
+  801d02:	00 00 00 
+  801d05:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d07:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d0e:	eb b5                	jmp    801cc5 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d10:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d17:	eb ac                	jmp    801cc5 <write+0x65>
+
+0000000000801d19 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801d19:	55                   	push   %rbp
+  801d1a:	48 89 e5             	mov    %rsp,%rbp
+  801d1d:	41 54                	push   %r12
+  801d1f:	53                   	push   %rbx
+  801d20:	48 83 ec 10          	sub    $0x10,%rsp
+  801d24:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d26:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d2a:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801d31:	00 00 00 
+  801d34:	ff d0                	call   *%rax
+  801d36:	85 c0                	test   %eax,%eax
+  801d38:	78 3e                	js     801d78 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d3e:	41 8b 3c 24          	mov    (%r12),%edi
+  801d42:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d46:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801d4d:	00 00 00 
+  801d50:	ff d0                	call   *%rax
+  801d52:	85 c0                	test   %eax,%eax
+  801d54:	78 22                	js     801d78 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801d56:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d5a:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801d5e:	48 85 c0             	test   %rax,%rax
+  801d61:	74 0b                	je     801d6e <seek+0x55>
+  801d63:	89 de                	mov    %ebx,%esi
+  801d65:	4c 89 e7             	mov    %r12,%rdi
+  801d68:	ff d0                	call   *%rax
+  801d6a:	85 c0                	test   %eax,%eax
+  801d6c:	78 0a                	js     801d78 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801d6e:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801d73:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801d78:	48 83 c4 10          	add    $0x10,%rsp
+  801d7c:	5b                   	pop    %rbx
+  801d7d:	41 5c                	pop    %r12
+  801d7f:	5d                   	pop    %rbp
+  801d80:	c3                   	ret
+
+0000000000801d81 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801d81:	55                   	push   %rbp
+  801d82:	48 89 e5             	mov    %rsp,%rbp
+  801d85:	41 55                	push   %r13
+  801d87:	41 54                	push   %r12
+  801d89:	53                   	push   %rbx
+  801d8a:	48 83 ec 18          	sub    $0x18,%rsp
+  801d8e:	89 fb                	mov    %edi,%ebx
+  801d90:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d93:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d97:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801d9e:	00 00 00 
+  801da1:	ff d0                	call   *%rax
+  801da3:	85 c0                	test   %eax,%eax
+  801da5:	78 38                	js     801ddf <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da7:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801dab:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801daf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801db3:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801dba:	00 00 00 
+  801dbd:	ff d0                	call   *%rax
+  801dbf:	85 c0                	test   %eax,%eax
+  801dc1:	78 1c                	js     801ddf <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dc3:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801dc8:	74 20                	je     801dea <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801dca:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dce:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801dd2:	48 85 c0             	test   %rax,%rax
+  801dd5:	74 47                	je     801e1e <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801dd7:	44 89 e6             	mov    %r12d,%esi
+  801dda:	4c 89 ef             	mov    %r13,%rdi
+  801ddd:	ff d0                	call   *%rax
+}
+  801ddf:	48 83 c4 18          	add    $0x18,%rsp
+  801de3:	5b                   	pop    %rbx
+  801de4:	41 5c                	pop    %r12
+  801de6:	41 5d                	pop    %r13
+  801de8:	5d                   	pop    %rbp
+  801de9:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801dea:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801df1:	00 00 00 
+  801df4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801dfa:	89 da                	mov    %ebx,%edx
+  801dfc:	48 bf c8 4f 80 00 00 	movabs $0x804fc8,%rdi
+  801e03:	00 00 00 
+  801e06:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e0b:	48 b9 09 05 80 00 00 	movabs $0x800509,%rcx
+  801e12:	00 00 00 
+  801e15:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e17:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801e1c:	eb c1                	jmp    801ddf <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e1e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e23:	eb ba                	jmp    801ddf <ftruncate+0x5e>
+
+0000000000801e25 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801e25:	55                   	push   %rbp
+  801e26:	48 89 e5             	mov    %rsp,%rbp
+  801e29:	41 54                	push   %r12
+  801e2b:	53                   	push   %rbx
+  801e2c:	48 83 ec 10          	sub    $0x10,%rsp
+  801e30:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e33:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e37:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  801e3e:	00 00 00 
+  801e41:	ff d0                	call   *%rax
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 4e                	js     801e95 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e47:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e4b:	41 8b 3c 24          	mov    (%r12),%edi
+  801e4f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e53:	48 b8 99 18 80 00 00 	movabs $0x801899,%rax
+  801e5a:	00 00 00 
+  801e5d:	ff d0                	call   *%rax
+  801e5f:	85 c0                	test   %eax,%eax
+  801e61:	78 32                	js     801e95 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e63:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e67:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801e6c:	74 30                	je     801e9e <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801e6e:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801e71:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801e78:	00 00 00 
+    stat->st_isdir = 0;
+  801e7b:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801e82:	00 00 00 
+    stat->st_dev = dev;
+  801e85:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801e8c:	48 89 de             	mov    %rbx,%rsi
+  801e8f:	4c 89 e7             	mov    %r12,%rdi
+  801e92:	ff 50 28             	call   *0x28(%rax)
+}
+  801e95:	48 83 c4 10          	add    $0x10,%rsp
+  801e99:	5b                   	pop    %rbx
+  801e9a:	41 5c                	pop    %r12
+  801e9c:	5d                   	pop    %rbp
+  801e9d:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e9e:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ea3:	eb f0                	jmp    801e95 <fstat+0x70>
+
+0000000000801ea5 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	41 54                	push   %r12
+  801eab:	53                   	push   %rbx
+  801eac:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801eaf:	be 00 00 00 00       	mov    $0x0,%esi
+  801eb4:	48 b8 13 30 80 00 00 	movabs $0x803013,%rax
+  801ebb:	00 00 00 
+  801ebe:	ff d0                	call   *%rax
+  801ec0:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801ec2:	85 c0                	test   %eax,%eax
+  801ec4:	78 25                	js     801eeb <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801ec6:	4c 89 e6             	mov    %r12,%rsi
+  801ec9:	89 c7                	mov    %eax,%edi
+  801ecb:	48 b8 25 1e 80 00 00 	movabs $0x801e25,%rax
+  801ed2:	00 00 00 
+  801ed5:	ff d0                	call   *%rax
+  801ed7:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801eda:	89 df                	mov    %ebx,%edi
+  801edc:	48 b8 b3 19 80 00 00 	movabs $0x8019b3,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+
+    return res;
+  801ee8:	44 89 e3             	mov    %r12d,%ebx
+}
+  801eeb:	89 d8                	mov    %ebx,%eax
+  801eed:	5b                   	pop    %rbx
+  801eee:	41 5c                	pop    %r12
+  801ef0:	5d                   	pop    %rbp
+  801ef1:	c3                   	ret
+
+0000000000801ef2 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801ef2:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  801ef9:	00 00 00 
+  801efc:	83 38 00             	cmpl   $0x0,(%rax)
+  801eff:	74 0a                	je     801f0b <fsenv+0x19>
+    return envid;
+}
+  801f01:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  801f08:	00 00 
+  801f0a:	c3                   	ret
+fsenv(void) {
+  801f0b:	55                   	push   %rbp
+  801f0c:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801f0f:	bf 03 00 00 00       	mov    $0x3,%edi
+  801f14:	48 b8 e0 48 80 00 00 	movabs $0x8048e0,%rax
+  801f1b:	00 00 00 
+  801f1e:	ff d0                	call   *%rax
+  801f20:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  801f27:	00 00 
+}
+  801f29:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  801f30:	00 00 
+  801f32:	5d                   	pop    %rbp
+  801f33:	c3                   	ret
+
+0000000000801f34 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801f34:	55                   	push   %rbp
+  801f35:	48 89 e5             	mov    %rsp,%rbp
+  801f38:	41 54                	push   %r12
+  801f3a:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f3b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f40:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f45:	48 89 de             	mov    %rbx,%rsi
+  801f48:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4d:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  801f54:	00 00 00 
+  801f57:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801f59:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  801f60:	00 00 00 
+  801f63:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f69:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801f6e:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f73:	48 89 de             	mov    %rbx,%rsi
+  801f76:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f7b:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  801f82:	00 00 00 
+  801f85:	ff d0                	call   *%rax
+  801f87:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801f89:	85 c0                	test   %eax,%eax
+  801f8b:	0f 88 a2 00 00 00    	js     802033 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801f91:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801f98:	00 00 00 
+  801f9b:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801fa1:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fa6:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801fa8:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801fad:	49 bc 45 41 80 00 00 	movabs $0x804145,%r12
+  801fb4:	00 00 00 
+  801fb7:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801fba:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801fbf:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801fc2:	48 b8 f2 1e 80 00 00 	movabs $0x801ef2,%rax
+  801fc9:	00 00 00 
+  801fcc:	ff d0                	call   *%rax
+  801fce:	89 c7                	mov    %eax,%edi
+  801fd0:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801fd6:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801fdb:	48 89 da             	mov    %rbx,%rdx
+  801fde:	be 09 00 00 00       	mov    $0x9,%esi
+  801fe3:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  801fea:	00 00 00 
+  801fed:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801fef:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801ff4:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff9:	be 00 00 00 00       	mov    $0x0,%esi
+  801ffe:	bf 00 00 00 00       	mov    $0x0,%edi
+  802003:	48 b8 66 48 80 00 00 	movabs $0x804866,%rax
+  80200a:	00 00 00 
+  80200d:	ff d0                	call   *%rax
+  80200f:	89 c3                	mov    %eax,%ebx
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 25                	js     80203a <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802015:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80201c:	00 00 00 
+  80201f:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802025:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  80202c:	00 00 
+    return 0;
+  80202e:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802033:	89 d8                	mov    %ebx,%eax
+  802035:	5b                   	pop    %rbx
+  802036:	41 5c                	pop    %r12
+  802038:	5d                   	pop    %rbp
+  802039:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80203a:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80203f:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802044:	bf 00 00 00 00       	mov    $0x0,%edi
+  802049:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  802050:	00 00 00 
+  802053:	ff d0                	call   *%rax
+        return res;
+  802055:	eb dc                	jmp    802033 <fschan_setup+0xff>
+
+0000000000802057 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802057:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  80205e:	00 00 00 
+  802061:	80 38 00             	cmpb   $0x0,(%rax)
+  802064:	74 55                	je     8020bb <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802066:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80206d:	00 00 00 
+  802070:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802076:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80207b:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  802082:	00 00 00 
+  802085:	3b 0a                	cmp    (%rdx),%ecx
+  802087:	75 01                	jne    80208a <fschan+0x33>
+}
+  802089:	c3                   	ret
+fschan(void) {
+  80208a:	55                   	push   %rbp
+  80208b:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80208e:	48 b8 34 1f 80 00 00 	movabs $0x801f34,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+  80209a:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80209c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8020a1:	85 d2                	test   %edx,%edx
+  8020a3:	78 02                	js     8020a7 <fschan+0x50>
+}
+  8020a5:	5d                   	pop    %rbp
+  8020a6:	c3                   	ret
+        fschan_enabled = 0;
+  8020a7:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8020ae:	00 00 00 
+  8020b1:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8020b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020b9:	eb ea                	jmp    8020a5 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8020bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c0:	c3                   	ret
+
+00000000008020c1 <fbuf>:
+fbuf(struct Fd *fd) {
+  8020c1:	55                   	push   %rbp
+  8020c2:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8020c5:	48 b8 c0 17 80 00 00 	movabs $0x8017c0,%rax
+  8020cc:	00 00 00 
+  8020cf:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8020d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020d6:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8020da:	77 12                	ja     8020ee <fbuf+0x2d>
+  8020dc:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8020e0:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  8020e7:	00 00 00 
+  8020ea:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8020ee:	48 89 d0             	mov    %rdx,%rax
+  8020f1:	5d                   	pop    %rbp
+  8020f2:	c3                   	ret
+
+00000000008020f3 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8020f3:	55                   	push   %rbp
+  8020f4:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8020f7:	48 83 c7 40          	add    $0x40,%rdi
+  8020fb:	48 b8 7f 41 80 00 00 	movabs $0x80417f,%rax
+  802102:	00 00 00 
+  802105:	ff d0                	call   *%rax
+  802107:	84 c0                	test   %al,%al
+  802109:	75 02                	jne    80210d <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80210b:	5d                   	pop    %rbp
+  80210c:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80210d:	48 b8 f2 1e 80 00 00 	movabs $0x801ef2,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+  802119:	89 c7                	mov    %eax,%edi
+  80211b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802121:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802126:	ba 00 00 00 00       	mov    $0x0,%edx
+  80212b:	be 0a 00 00 00       	mov    $0xa,%esi
+  802130:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+}
+  80213c:	eb cd                	jmp    80210b <fschan_publish+0x18>
+
+000000000080213e <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80213e:	55                   	push   %rbp
+  80213f:	48 89 e5             	mov    %rsp,%rbp
+  802142:	41 57                	push   %r15
+  802144:	41 56                	push   %r14
+  802146:	41 55                	push   %r13
+  802148:	41 54                	push   %r12
+  80214a:	53                   	push   %rbx
+  80214b:	48 83 ec 48          	sub    $0x48,%rsp
+  80214f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802153:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802157:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80215a:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80215e:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802161:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  802168:	00 00 00 
+  80216b:	8b 02                	mov    (%rdx),%eax
+  80216d:	83 c0 01             	add    $0x1,%eax
+  802170:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802175:	0f 44 c1             	cmove  %ecx,%eax
+  802178:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80217a:	4d 85 c0             	test   %r8,%r8
+  80217d:	74 2c                	je     8021ab <fschan_rw+0x6d>
+  80217f:	45 89 ce             	mov    %r9d,%r14d
+  802182:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802189:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80218d:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802193:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80219a:	00 
+  80219b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8021a1:	b8 01 00 00 00       	mov    $0x1,%eax
+  8021a6:	e9 41 01 00 00       	jmp    8022ec <fschan_rw+0x1ae>
+  8021ab:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8021af:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8021b3:	e9 9c 01 00 00       	jmp    802354 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8021b8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8021bc:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8021bf:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8021c2:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8021c5:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8021c9:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8021cd:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8021d1:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8021d5:	48 89 da             	mov    %rbx,%rdx
+  8021d8:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8021e4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8021e8:	48 b8 f3 20 80 00 00 	movabs $0x8020f3,%rax
+  8021ef:	00 00 00 
+  8021f2:	ff d0                	call   *%rax
+            queued += blk;
+  8021f4:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8021f7:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021fb:	4d 39 fc             	cmp    %r15,%r12
+  8021fe:	73 6b                	jae    80226b <fschan_rw+0x12d>
+  802200:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802204:	77 65                	ja     80226b <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802206:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80220a:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80220e:	48 b8 5a 41 80 00 00 	movabs $0x80415a,%rax
+  802215:	00 00 00 
+  802218:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80221a:	4c 89 fb             	mov    %r15,%rbx
+  80221d:	4c 29 e3             	sub    %r12,%rbx
+  802220:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802225:	48 39 d3             	cmp    %rdx,%rbx
+  802228:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80222c:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802230:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802234:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802238:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80223b:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80223d:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  802244:	00 00 00 
+  802247:	8b 09                	mov    (%rcx),%ecx
+  802249:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80224c:	83 fe 03             	cmp    $0x3,%esi
+  80224f:	0f 85 63 ff ff ff    	jne    8021b8 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802255:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802259:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80225c:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80225f:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802262:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802266:	e9 79 ff ff ff       	jmp    8021e4 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80226b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80226f:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802276:	48 89 df             	mov    %rbx,%rdi
+  802279:	48 b8 1d 42 80 00 00 	movabs $0x80421d,%rax
+  802280:	00 00 00 
+  802283:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802285:	48 89 df             	mov    %rbx,%rdi
+  802288:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  80228f:	00 00 00 
+  802292:	ff d0                	call   *%rax
+  802294:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802298:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80229c:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8022a0:	75 25                	jne    8022c7 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8022a2:	8b 40 04             	mov    0x4(%rax),%eax
+  8022a5:	85 c0                	test   %eax,%eax
+  8022a7:	0f 88 86 00 00 00    	js     802333 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8022ad:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8022b1:	74 5b                	je     80230e <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8022b3:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8022b7:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8022bb:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8022bf:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8022c3:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8022c7:	48 89 df             	mov    %rbx,%rdi
+  8022ca:	48 b8 d2 41 80 00 00 	movabs $0x8041d2,%rax
+  8022d1:	00 00 00 
+  8022d4:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8022d6:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8022da:	83 f0 01             	xor    $0x1,%eax
+  8022dd:	4d 39 fc             	cmp    %r15,%r12
+  8022e0:	0f 92 c2             	setb   %dl
+  8022e3:	84 c2                	test   %al,%dl
+  8022e5:	75 05                	jne    8022ec <fschan_rw+0x1ae>
+  8022e7:	45 85 ed             	test   %r13d,%r13d
+  8022ea:	74 50                	je     80233c <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022ec:	4d 39 fc             	cmp    %r15,%r12
+  8022ef:	0f 92 c1             	setb   %cl
+  8022f2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022f6:	0f 96 c2             	setbe  %dl
+  8022f9:	84 d1                	test   %dl,%cl
+  8022fb:	0f 84 6a ff ff ff    	je     80226b <fschan_rw+0x12d>
+  802301:	84 c0                	test   %al,%al
+  802303:	0f 85 fd fe ff ff    	jne    802206 <fschan_rw+0xc8>
+  802309:	e9 5d ff ff ff       	jmp    80226b <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80230e:	48 63 d0             	movslq %eax,%rdx
+  802311:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802315:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802319:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80231d:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802321:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802325:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  80232c:	00 00 00 
+  80232f:	ff d0                	call   *%rax
+  802331:	eb 80                	jmp    8022b3 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802333:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802336:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80233a:	eb 8b                	jmp    8022c7 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80233c:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802341:	0f 85 68 fe ff ff    	jne    8021af <fschan_rw+0x71>
+  802347:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80234a:	85 c0                	test   %eax,%eax
+  80234c:	0f 84 5d fe ff ff    	je     8021af <fschan_rw+0x71>
+  802352:	48 98                	cltq
+}
+  802354:	48 83 c4 48          	add    $0x48,%rsp
+  802358:	5b                   	pop    %rbx
+  802359:	41 5c                	pop    %r12
+  80235b:	41 5d                	pop    %r13
+  80235d:	41 5e                	pop    %r14
+  80235f:	41 5f                	pop    %r15
+  802361:	5d                   	pop    %rbp
+  802362:	c3                   	ret
+
+0000000000802363 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802363:	55                   	push   %rbp
+  802364:	48 89 e5             	mov    %rsp,%rbp
+  802367:	41 56                	push   %r14
+  802369:	41 55                	push   %r13
+  80236b:	41 54                	push   %r12
+  80236d:	53                   	push   %rbx
+  80236e:	48 83 ec 10          	sub    $0x10,%rsp
+  802372:	49 89 fe             	mov    %rdi,%r14
+  802375:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802378:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80237c:	48 29 f3             	sub    %rsi,%rbx
+  80237f:	48 39 d3             	cmp    %rdx,%rbx
+  802382:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802386:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80238d:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80238e:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802393:	49 bd dc 3f 80 00 00 	movabs $0x803fdc,%r13
+  80239a:	00 00 00 
+  80239d:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8023a4:	76 1e                	jbe    8023c4 <mmap_fault+0x61>
+  8023a6:	4c 01 e7             	add    %r12,%rdi
+  8023a9:	41 ff d5             	call   *%r13
+  8023ac:	84 c0                	test   %al,%al
+  8023ae:	75 14                	jne    8023c4 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8023b0:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8023b4:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8023bb:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8023bf:	48 39 df             	cmp    %rbx,%rdi
+  8023c2:	72 e2                	jb     8023a6 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8023c4:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  8023cb:	00 00 00 
+  8023ce:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8023d5:	00 00 00 
+  8023d8:	4c 89 f0             	mov    %r14,%rax
+  8023db:	48 29 d0             	sub    %rdx,%rax
+  8023de:	48 c1 f8 03          	sar    $0x3,%rax
+  8023e2:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8023e9:	aa aa aa 
+  8023ec:	48 0f af c2          	imul   %rdx,%rax
+  8023f0:	48 c1 e0 0c          	shl    $0xc,%rax
+  8023f4:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8023f9:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8023fd:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8023ff:	44 89 e0             	mov    %r12d,%eax
+  802402:	41 03 46 10          	add    0x10(%r14),%eax
+  802406:	41 2b 06             	sub    (%r14),%eax
+  802409:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80240c:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802410:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802414:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802418:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80241b:	48 b8 f2 1e 80 00 00 	movabs $0x801ef2,%rax
+  802422:	00 00 00 
+  802425:	ff d0                	call   *%rax
+  802427:	89 c7                	mov    %eax,%edi
+  802429:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80242f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802434:	48 89 da             	mov    %rbx,%rdx
+  802437:	be 0f 00 00 00       	mov    $0xf,%esi
+  80243c:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  802443:	00 00 00 
+  802446:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802448:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80244d:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802451:	4c 89 e6             	mov    %r12,%rsi
+  802454:	bf 00 00 00 00       	mov    $0x0,%edi
+  802459:	48 b8 66 48 80 00 00 	movabs $0x804866,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+  802465:	48 98                	cltq
+}
+  802467:	48 83 c4 10          	add    $0x10,%rsp
+  80246b:	5b                   	pop    %rbx
+  80246c:	41 5c                	pop    %r12
+  80246e:	41 5d                	pop    %r13
+  802470:	41 5e                	pop    %r14
+  802472:	5d                   	pop    %rbp
+  802473:	c3                   	ret
+
+0000000000802474 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802474:	48 8b 37             	mov    (%rdi),%rsi
+  802477:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80247e:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  802485:	00 00 00 
+  802488:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80248d:	eb 0f                	jmp    80249e <mmap_pgfault+0x2a>
+  80248f:	c3                   	ret
+  802490:	48 83 c1 01          	add    $0x1,%rcx
+  802494:	48 83 c2 18          	add    $0x18,%rdx
+  802498:	48 83 f9 20          	cmp    $0x20,%rcx
+  80249c:	74 6e                	je     80250c <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80249e:	48 8b 02             	mov    (%rdx),%rax
+  8024a1:	48 83 e8 01          	sub    $0x1,%rax
+  8024a5:	48 39 f0             	cmp    %rsi,%rax
+  8024a8:	73 e6                	jae    802490 <mmap_pgfault+0x1c>
+  8024aa:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8024ae:	73 e0                	jae    802490 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8024b0:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8024b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024b9:	f6 c2 01             	test   $0x1,%dl
+  8024bc:	75 d1                	jne    80248f <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8024be:	f6 c2 02             	test   $0x2,%dl
+  8024c1:	74 1a                	je     8024dd <mmap_pgfault+0x69>
+  8024c3:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024cc:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  8024d3:	00 00 00 
+  8024d6:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8024db:	74 35                	je     802512 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8024dd:	55                   	push   %rbp
+  8024de:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8024e1:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8024e5:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8024ec:	00 00 00 
+  8024ef:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8024f3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8024f8:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  8024ff:	00 00 00 
+  802502:	ff d0                	call   *%rax
+  802504:	48 85 c0             	test   %rax,%rax
+  802507:	0f 9f c0             	setg   %al
+}
+  80250a:	5d                   	pop    %rbp
+  80250b:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80250c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802511:	c3                   	ret
+}
+  802512:	c3                   	ret
+
+0000000000802513 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802513:	55                   	push   %rbp
+  802514:	48 89 e5             	mov    %rsp,%rbp
+  802517:	41 54                	push   %r12
+  802519:	53                   	push   %rbx
+  80251a:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80251d:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802524:	00 00 00 
+  802527:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80252c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802530:	74 15                	je     802547 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802532:	48 83 c3 01          	add    $0x1,%rbx
+  802536:	48 83 c0 18          	add    $0x18,%rax
+  80253a:	48 83 fb 20          	cmp    $0x20,%rbx
+  80253e:	75 ec                	jne    80252c <mmap_alloc+0x19>
+    return NULL;
+  802540:	b8 00 00 00 00       	mov    $0x0,%eax
+  802545:	eb 52                	jmp    802599 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802547:	4c 89 e7             	mov    %r12,%rdi
+  80254a:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	41 89 c1             	mov    %eax,%r9d
+  802559:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802560:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802564:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80256a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80256f:	4c 89 e6             	mov    %r12,%rsi
+  802572:	bf 00 00 00 00       	mov    $0x0,%edi
+  802577:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+  802583:	85 c0                	test   %eax,%eax
+  802585:	78 17                	js     80259e <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802587:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80258b:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802592:	00 00 00 
+  802595:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802599:	5b                   	pop    %rbx
+  80259a:	41 5c                	pop    %r12
+  80259c:	5d                   	pop    %rbp
+  80259d:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80259e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a3:	eb f4                	jmp    802599 <mmap_alloc+0x86>
+
+00000000008025a5 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	41 56                	push   %r14
+  8025ab:	41 55                	push   %r13
+  8025ad:	41 54                	push   %r12
+  8025af:	53                   	push   %rbx
+  8025b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b4:	41 89 fc             	mov    %edi,%r12d
+  8025b7:	49 89 f5             	mov    %rsi,%r13
+  8025ba:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8025bd:	48 89 f0             	mov    %rsi,%rax
+  8025c0:	48 09 d0             	or     %rdx,%rax
+  8025c3:	75 0d                	jne    8025d2 <fsipc+0x2d>
+  8025c5:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8025c8:	83 f8 04             	cmp    $0x4,%eax
+  8025cb:	76 7d                	jbe    80264a <fsipc+0xa5>
+  8025cd:	83 ff 0d             	cmp    $0xd,%edi
+  8025d0:	74 78                	je     80264a <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8025d2:	48 b8 f2 1e 80 00 00 	movabs $0x801ef2,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+  8025de:	89 c7                	mov    %eax,%edi
+  8025e0:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8025e7:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8025ee:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8025f5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025fb:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802602:	00 00 00 
+  802605:	44 89 e6             	mov    %r12d,%esi
+  802608:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  80260f:	00 00 00 
+  802612:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802614:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80261b:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80261c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802621:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802625:	4c 89 ee             	mov    %r13,%rsi
+  802628:	bf 00 00 00 00       	mov    $0x0,%edi
+  80262d:	48 b8 66 48 80 00 00 	movabs $0x804866,%rax
+  802634:	00 00 00 
+  802637:	ff d0                	call   *%rax
+  802639:	89 c3                	mov    %eax,%ebx
+}
+  80263b:	89 d8                	mov    %ebx,%eax
+  80263d:	48 83 c4 10          	add    $0x10,%rsp
+  802641:	5b                   	pop    %rbx
+  802642:	41 5c                	pop    %r12
+  802644:	41 5d                	pop    %r13
+  802646:	41 5e                	pop    %r14
+  802648:	5d                   	pop    %rbp
+  802649:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80264a:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802651:	00 00 00 
+  802654:	ff d0                	call   *%rax
+  802656:	49 89 c6             	mov    %rax,%r14
+  802659:	48 85 c0             	test   %rax,%rax
+  80265c:	0f 84 70 ff ff ff    	je     8025d2 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802662:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802666:	48 b8 5a 41 80 00 00 	movabs $0x80415a,%rax
+  80266d:	00 00 00 
+  802670:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802672:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802675:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80267c:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802680:	ba 10 00 00 00       	mov    $0x10,%edx
+  802685:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  80268c:	00 00 00 
+  80268f:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  802696:	00 00 00 
+  802699:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80269b:	4c 89 f7             	mov    %r14,%rdi
+  80269e:	48 b8 f3 20 80 00 00 	movabs $0x8020f3,%rax
+  8026a5:	00 00 00 
+  8026a8:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8026aa:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8026b1:	4c 89 f7             	mov    %r14,%rdi
+  8026b4:	48 b8 1d 42 80 00 00 	movabs $0x80421d,%rax
+  8026bb:	00 00 00 
+  8026be:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8026c0:	4c 89 f7             	mov    %r14,%rdi
+  8026c3:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8026cf:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8026d2:	41 83 fc 05          	cmp    $0x5,%r12d
+  8026d6:	75 04                	jne    8026dc <fsipc+0x137>
+  8026d8:	85 db                	test   %ebx,%ebx
+  8026da:	79 14                	jns    8026f0 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8026dc:	4c 89 f7             	mov    %r14,%rdi
+  8026df:	48 b8 d2 41 80 00 00 	movabs $0x8041d2,%rax
+  8026e6:	00 00 00 
+  8026e9:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8026eb:	e9 4b ff ff ff       	jmp    80263b <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8026f0:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8026f4:	ba 88 00 00 00       	mov    $0x88,%edx
+  8026f9:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802700:	00 00 00 
+  802703:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  80270a:	00 00 00 
+  80270d:	ff d0                	call   *%rax
+  80270f:	eb cb                	jmp    8026dc <fsipc+0x137>
+
+0000000000802711 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802711:	55                   	push   %rbp
+  802712:	48 89 e5             	mov    %rsp,%rbp
+  802715:	41 57                	push   %r15
+  802717:	41 56                	push   %r14
+  802719:	41 55                	push   %r13
+  80271b:	41 54                	push   %r12
+  80271d:	53                   	push   %rbx
+  80271e:	48 83 ec 18          	sub    $0x18,%rsp
+  802722:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802726:	49 89 f6             	mov    %rsi,%r14
+  802729:	49 89 d4             	mov    %rdx,%r12
+  80272c:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80272f:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802736:	00 00 00 
+  802739:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80273b:	48 85 c0             	test   %rax,%rax
+  80273e:	0f 85 96 00 00 00    	jne    8027da <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802744:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80274b:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80274c:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802753:	00 00 00 
+    while (n) {
+  802756:	4d 85 e4             	test   %r12,%r12
+  802759:	74 79                	je     8027d4 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80275b:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802760:	49 39 dc             	cmp    %rbx,%r12
+  802763:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802767:	48 89 da             	mov    %rbx,%rdx
+  80276a:	4c 89 f6             	mov    %r14,%rsi
+  80276d:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  802774:	00 00 00 
+  802777:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  80277e:	00 00 00 
+  802781:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802783:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802787:	8b 40 0c             	mov    0xc(%rax),%eax
+  80278a:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80278d:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802790:	44 01 e8             	add    %r13d,%eax
+  802793:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802797:	41 0f 44 c5          	cmove  %r13d,%eax
+  80279b:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80279f:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8027a3:	48 89 da             	mov    %rbx,%rdx
+  8027a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8027ab:	bf 04 00 00 00       	mov    $0x4,%edi
+  8027b0:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  8027b7:	00 00 00 
+  8027ba:	ff d0                	call   *%rax
+        if (res < 0)
+  8027bc:	85 c0                	test   %eax,%eax
+  8027be:	78 4a                	js     80280a <devfile_write_direct+0xf9>
+        buf += res;
+  8027c0:	48 98                	cltq
+  8027c2:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8027c5:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8027c9:	49 29 c4             	sub    %rax,%r12
+  8027cc:	75 8d                	jne    80275b <devfile_write_direct+0x4a>
+    return write;
+  8027ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8027d2:	eb 27                	jmp    8027fb <devfile_write_direct+0xea>
+    size_t write = 0;
+  8027d4:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8027d8:	eb f4                	jmp    8027ce <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027da:	45 89 e9             	mov    %r13d,%r9d
+  8027dd:	4d 89 e0             	mov    %r12,%r8
+  8027e0:	4c 89 f1             	mov    %r14,%rcx
+  8027e3:	ba 04 00 00 00       	mov    $0x4,%edx
+  8027e8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8027ec:	48 89 c7             	mov    %rax,%rdi
+  8027ef:	48 b8 3e 21 80 00 00 	movabs $0x80213e,%rax
+  8027f6:	00 00 00 
+  8027f9:	ff d0                	call   *%rax
+}
+  8027fb:	48 83 c4 18          	add    $0x18,%rsp
+  8027ff:	5b                   	pop    %rbx
+  802800:	41 5c                	pop    %r12
+  802802:	41 5d                	pop    %r13
+  802804:	41 5e                	pop    %r14
+  802806:	41 5f                	pop    %r15
+  802808:	5d                   	pop    %rbp
+  802809:	c3                   	ret
+            return res;
+  80280a:	48 98                	cltq
+  80280c:	eb ed                	jmp    8027fb <devfile_write_direct+0xea>
+
+000000000080280e <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80280e:	55                   	push   %rbp
+  80280f:	48 89 e5             	mov    %rsp,%rbp
+  802812:	41 54                	push   %r12
+  802814:	53                   	push   %rbx
+  802815:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802818:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802824:	48 85 c0             	test   %rax,%rax
+  802827:	74 71                	je     80289a <fbuf_flush+0x8c>
+  802829:	48 89 c3             	mov    %rax,%rbx
+  80282c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802831:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802835:	75 05                	jne    80283c <fbuf_flush+0x2e>
+}
+  802837:	5b                   	pop    %rbx
+  802838:	41 5c                	pop    %r12
+  80283a:	5d                   	pop    %rbp
+  80283b:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80283c:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80283f:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802843:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  80284a:	00 00 00 
+  80284d:	48 89 de             	mov    %rbx,%rsi
+  802850:	48 29 c6             	sub    %rax,%rsi
+  802853:	48 c1 fe 03          	sar    $0x3,%rsi
+  802857:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80285e:	aa aa aa 
+  802861:	48 0f af f0          	imul   %rax,%rsi
+  802865:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802869:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80286e:	48 01 c6             	add    %rax,%rsi
+  802871:	4c 89 e7             	mov    %r12,%rdi
+  802874:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  80287b:	00 00 00 
+  80287e:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802880:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802884:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80288b:	00 
+    return res < 0 ? res : 0;
+  80288c:	48 85 c0             	test   %rax,%rax
+  80288f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802894:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802898:	eb 9d                	jmp    802837 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80289a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80289f:	eb 96                	jmp    802837 <fbuf_flush+0x29>
+
+00000000008028a1 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8028a1:	55                   	push   %rbp
+  8028a2:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8028a5:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  8028ac:	00 00 00 
+  8028af:	ff d0                	call   *%rax
+}
+  8028b1:	5d                   	pop    %rbp
+  8028b2:	c3                   	ret
+
+00000000008028b3 <devfile_write>:
+    if (!fd || !buf)
+  8028b3:	48 85 ff             	test   %rdi,%rdi
+  8028b6:	0f 84 d3 01 00 00    	je     802a8f <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8028bc:	55                   	push   %rbp
+  8028bd:	48 89 e5             	mov    %rsp,%rbp
+  8028c0:	41 57                	push   %r15
+  8028c2:	41 56                	push   %r14
+  8028c4:	41 55                	push   %r13
+  8028c6:	41 54                	push   %r12
+  8028c8:	53                   	push   %rbx
+  8028c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8028cd:	49 89 fc             	mov    %rdi,%r12
+  8028d0:	49 89 f6             	mov    %rsi,%r14
+  8028d3:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8028d6:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8028db:	48 85 f6             	test   %rsi,%rsi
+  8028de:	0f 84 9c 01 00 00    	je     802a80 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8028e4:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  8028eb:	00 00 00 
+  8028ee:	ff d0                	call   *%rax
+  8028f0:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8028f3:	48 85 c0             	test   %rax,%rax
+  8028f6:	0f 84 a2 00 00 00    	je     80299e <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8028fc:	be 00 10 00 00       	mov    $0x1000,%esi
+  802901:	4c 89 e7             	mov    %r12,%rdi
+  802904:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802910:	83 f8 02             	cmp    $0x2,%eax
+  802913:	0f 8f 85 00 00 00    	jg     80299e <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802919:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802920:	00 00 00 
+  802923:	4d 89 ef             	mov    %r13,%r15
+  802926:	49 29 c7             	sub    %rax,%r15
+  802929:	49 c1 ff 03          	sar    $0x3,%r15
+  80292d:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802934:	aa aa aa 
+  802937:	4c 0f af f8          	imul   %rax,%r15
+  80293b:	49 c1 e7 0e          	shl    $0xe,%r15
+  80293f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802944:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802947:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80294c:	0f 84 d7 00 00 00    	je     802a29 <devfile_write+0x176>
+  802952:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802956:	89 c2                	mov    %eax,%edx
+  802958:	41 03 55 0c          	add    0xc(%r13),%edx
+  80295c:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802961:	75 0f                	jne    802972 <devfile_write+0xbf>
+  802963:	48 01 d8             	add    %rbx,%rax
+  802966:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80296c:	0f 86 92 00 00 00    	jbe    802a04 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802972:	4c 89 e7             	mov    %r12,%rdi
+  802975:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  80297c:	00 00 00 
+  80297f:	ff d0                	call   *%rax
+  802981:	85 c0                	test   %eax,%eax
+  802983:	78 52                	js     8029d7 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802985:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80298c:	77 7f                	ja     802a0d <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80298e:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802993:	0f 85 c2 00 00 00    	jne    802a5b <devfile_write+0x1a8>
+  802999:	e9 94 00 00 00       	jmp    802a32 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80299e:	4c 89 e7             	mov    %r12,%rdi
+  8029a1:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8029ad:	85 c0                	test   %eax,%eax
+  8029af:	79 07                	jns    8029b8 <devfile_write+0x105>
+  8029b1:	48 98                	cltq
+  8029b3:	e9 c8 00 00 00       	jmp    802a80 <devfile_write+0x1cd>
+  8029b8:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8029bd:	48 89 da             	mov    %rbx,%rdx
+  8029c0:	4c 89 f6             	mov    %r14,%rsi
+  8029c3:	4c 89 e7             	mov    %r12,%rdi
+  8029c6:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  8029cd:	00 00 00 
+  8029d0:	ff d0                	call   *%rax
+  8029d2:	e9 a9 00 00 00       	jmp    802a80 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8029d7:	48 98                	cltq
+  8029d9:	e9 a2 00 00 00       	jmp    802a80 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8029de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8029e3:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8029e8:	4c 89 fe             	mov    %r15,%rsi
+  8029eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f0:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  8029f7:	00 00 00 
+  8029fa:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8029fc:	85 c0                	test   %eax,%eax
+  8029fe:	79 45                	jns    802a45 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802a00:	48 98                	cltq
+  802a02:	eb 7c                	jmp    802a80 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a04:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a0b:	76 4e                	jbe    802a5b <devfile_write+0x1a8>
+  802a0d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802a12:	48 89 da             	mov    %rbx,%rdx
+  802a15:	4c 89 f6             	mov    %r14,%rsi
+  802a18:	4c 89 e7             	mov    %r12,%rdi
+  802a1b:	48 b8 11 27 80 00 00 	movabs $0x802711,%rax
+  802a22:	00 00 00 
+  802a25:	ff d0                	call   *%rax
+  802a27:	eb 57                	jmp    802a80 <devfile_write+0x1cd>
+  802a29:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a30:	77 db                	ja     802a0d <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802a32:	4c 89 ff             	mov    %r15,%rdi
+  802a35:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  802a3c:	00 00 00 
+  802a3f:	ff d0                	call   *%rax
+  802a41:	84 c0                	test   %al,%al
+  802a43:	74 99                	je     8029de <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802a45:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802a4a:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802a4f:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802a53:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802a5a:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802a5b:	4c 89 ff             	mov    %r15,%rdi
+  802a5e:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802a62:	48 89 da             	mov    %rbx,%rdx
+  802a65:	4c 89 f6             	mov    %r14,%rsi
+  802a68:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  802a6f:	00 00 00 
+  802a72:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802a74:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802a78:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802a7d:	48 89 d8             	mov    %rbx,%rax
+}
+  802a80:	48 83 c4 08          	add    $0x8,%rsp
+  802a84:	5b                   	pop    %rbx
+  802a85:	41 5c                	pop    %r12
+  802a87:	41 5d                	pop    %r13
+  802a89:	41 5e                	pop    %r14
+  802a8b:	41 5f                	pop    %r15
+  802a8d:	5d                   	pop    %rbp
+  802a8e:	c3                   	ret
+        return E_INVAL;
+  802a8f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802a94:	c3                   	ret
+
+0000000000802a95 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802a95:	55                   	push   %rbp
+  802a96:	48 89 e5             	mov    %rsp,%rbp
+  802a99:	41 54                	push   %r12
+  802a9b:	53                   	push   %rbx
+  802a9c:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802a9f:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  802aa6:	00 00 00 
+  802aa9:	ff d0                	call   *%rax
+  802aab:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802aae:	48 89 df             	mov    %rbx,%rdi
+  802ab1:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  802ab8:	00 00 00 
+  802abb:	ff d0                	call   *%rax
+  802abd:	48 85 c0             	test   %rax,%rax
+  802ac0:	74 17                	je     802ad9 <devfile_flush+0x44>
+  802ac2:	48 89 df             	mov    %rbx,%rdi
+  802ac5:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  802acc:	00 00 00 
+  802acf:	ff d0                	call   *%rax
+  802ad1:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ad8:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ad9:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802adc:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  802ae3:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802ae5:	ba 00 00 00 00       	mov    $0x0,%edx
+  802aea:	be 00 00 00 00       	mov    $0x0,%esi
+  802aef:	bf 06 00 00 00       	mov    $0x6,%edi
+  802af4:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  802afb:	00 00 00 
+  802afe:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802b00:	45 85 e4             	test   %r12d,%r12d
+  802b03:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802b07:	5b                   	pop    %rbx
+  802b08:	41 5c                	pop    %r12
+  802b0a:	5d                   	pop    %rbp
+  802b0b:	c3                   	ret
+
+0000000000802b0c <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802b0c:	55                   	push   %rbp
+  802b0d:	48 89 e5             	mov    %rsp,%rbp
+  802b10:	41 57                	push   %r15
+  802b12:	41 56                	push   %r14
+  802b14:	41 55                	push   %r13
+  802b16:	41 54                	push   %r12
+  802b18:	53                   	push   %rbx
+  802b19:	48 83 ec 38          	sub    $0x38,%rsp
+  802b1d:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802b21:	49 89 f7             	mov    %rsi,%r15
+  802b24:	48 89 d3             	mov    %rdx,%rbx
+  802b27:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802b2a:	48 b8 57 20 80 00 00 	movabs $0x802057,%rax
+  802b31:	00 00 00 
+  802b34:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b36:	48 85 c0             	test   %rax,%rax
+  802b39:	75 20                	jne    802b5b <devfile_read_direct+0x4f>
+    bool map = 1;
+  802b3b:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802b40:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802b47:	00 
+    while (n) {
+  802b48:	48 85 db             	test   %rbx,%rbx
+  802b4b:	0f 85 df 00 00 00    	jne    802c30 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802b51:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802b55:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b59:	eb 21                	jmp    802b7c <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802b5b:	45 89 f1             	mov    %r14d,%r9d
+  802b5e:	49 89 d8             	mov    %rbx,%r8
+  802b61:	4c 89 f9             	mov    %r15,%rcx
+  802b64:	ba 03 00 00 00       	mov    $0x3,%edx
+  802b69:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802b6d:	48 89 c7             	mov    %rax,%rdi
+  802b70:	48 b8 3e 21 80 00 00 	movabs $0x80213e,%rax
+  802b77:	00 00 00 
+  802b7a:	ff d0                	call   *%rax
+}
+  802b7c:	48 83 c4 38          	add    $0x38,%rsp
+  802b80:	5b                   	pop    %rbx
+  802b81:	41 5c                	pop    %r12
+  802b83:	41 5d                	pop    %r13
+  802b85:	41 5e                	pop    %r14
+  802b87:	41 5f                	pop    %r15
+  802b89:	5d                   	pop    %rbp
+  802b8a:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b8b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b8f:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802b95:	75 1e                	jne    802bb5 <devfile_read_direct+0xa9>
+  802b97:	e9 e2 00 00 00       	jmp    802c7e <devfile_read_direct+0x172>
+            if (!res) return read;
+  802b9c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ba0:	eb da                	jmp    802b7c <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802ba2:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802ba6:	0f 85 d0 01 00 00    	jne    802d7c <devfile_read_direct+0x270>
+            map = 0;
+  802bac:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802bb0:	eb 03                	jmp    802bb5 <devfile_read_direct+0xa9>
+  802bb2:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802bb5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802bba:	48 39 d3             	cmp    %rdx,%rbx
+  802bbd:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bc1:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802bc5:	8b 40 0c             	mov    0xc(%rax),%eax
+  802bc8:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  802bcf:	00 00 00 
+  802bd2:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802bd4:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802bd8:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802bdc:	be 00 00 00 00       	mov    $0x0,%esi
+  802be1:	bf 03 00 00 00       	mov    $0x3,%edi
+  802be6:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  802bed:	00 00 00 
+  802bf0:	ff d0                	call   *%rax
+        if (res <= 0)
+  802bf2:	85 c0                	test   %eax,%eax
+  802bf4:	0f 8e 63 01 00 00    	jle    802d5d <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802bfa:	4c 63 e0             	movslq %eax,%r12
+  802bfd:	4c 89 e2             	mov    %r12,%rdx
+  802c00:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  802c07:	00 00 00 
+  802c0a:	4c 89 ff             	mov    %r15,%rdi
+  802c0d:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  802c14:	00 00 00 
+  802c17:	ff d0                	call   *%rax
+        buf += res;
+  802c19:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802c1c:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802c1f:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802c23:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802c27:	48 85 db             	test   %rbx,%rbx
+  802c2a:	0f 84 25 ff ff ff    	je     802b55 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802c30:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802c33:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802c37:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802c3b:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c3f:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802c46:	0f 97 c2             	seta   %dl
+  802c49:	20 c2                	and    %al,%dl
+  802c4b:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802c4e:	0f 84 5e ff ff ff    	je     802bb2 <devfile_read_direct+0xa6>
+  802c54:	4c 89 fa             	mov    %r15,%rdx
+  802c57:	4d 89 fd             	mov    %r15,%r13
+  802c5a:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802c61:	0f 85 4e ff ff ff    	jne    802bb5 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802c67:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802c6b:	0f 84 1a ff ff ff    	je     802b8b <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c71:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802c78:	0f 85 37 ff ff ff    	jne    802bb5 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802c7e:	48 89 d8             	mov    %rbx,%rax
+  802c81:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802c87:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802c8c:	48 39 c8             	cmp    %rcx,%rax
+  802c8f:	48 0f 47 c1          	cmova  %rcx,%rax
+  802c93:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802c97:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802c9b:	49 89 d4             	mov    %rdx,%r12
+  802c9e:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802ca2:	48 b8 7d 3f 80 00 00 	movabs $0x803f7d,%rax
+  802ca9:	00 00 00 
+  802cac:	ff d0                	call   *%rax
+  802cae:	a8 40                	test   $0x40,%al
+  802cb0:	0f 85 b9 00 00 00    	jne    802d6f <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802cb6:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802cbd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802cc1:	49 39 c5             	cmp    %rax,%r13
+  802cc4:	72 d8                	jb     802c9e <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cc6:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802cca:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802cd1:	00 00 00 
+  802cd4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cd8:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802cdb:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802cdd:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802ce1:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802ce5:	48 b8 f2 1e 80 00 00 	movabs $0x801ef2,%rax
+  802cec:	00 00 00 
+  802cef:	ff d0                	call   *%rax
+  802cf1:	89 c7                	mov    %eax,%edi
+  802cf3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802cf9:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802cfe:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802d05:	00 00 00 
+  802d08:	be 0e 00 00 00       	mov    $0xe,%esi
+  802d0d:	48 b8 8a 48 80 00 00 	movabs $0x80488a,%rax
+  802d14:	00 00 00 
+  802d17:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802d19:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802d1e:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802d22:	4c 89 fe             	mov    %r15,%rsi
+  802d25:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d2a:	48 b8 66 48 80 00 00 	movabs $0x804866,%rax
+  802d31:	00 00 00 
+  802d34:	ff d0                	call   *%rax
+  802d36:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802d39:	48 85 d2             	test   %rdx,%rdx
+  802d3c:	0f 84 5a fe ff ff    	je     802b9c <devfile_read_direct+0x90>
+            if (res > 0) {
+  802d42:	0f 8e 5a fe ff ff    	jle    802ba2 <devfile_read_direct+0x96>
+                buf += res;
+  802d48:	48 98                	cltq
+  802d4a:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802d4d:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802d50:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802d54:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802d58:	e9 ca fe ff ff       	jmp    802c27 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802d5d:	41 89 c5             	mov    %eax,%r13d
+  802d60:	48 98                	cltq
+  802d62:	45 85 ed             	test   %r13d,%r13d
+  802d65:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802d6a:	e9 0d fe ff ff       	jmp    802b7c <devfile_read_direct+0x70>
+            map = 0;
+  802d6f:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d73:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d77:	e9 39 fe ff ff       	jmp    802bb5 <devfile_read_direct+0xa9>
+  802d7c:	48 89 d0             	mov    %rdx,%rax
+  802d7f:	e9 f8 fd ff ff       	jmp    802b7c <devfile_read_direct+0x70>
+
+0000000000802d84 <devfile_read>:
+    if (!fd || !buf)
+  802d84:	48 85 ff             	test   %rdi,%rdi
+  802d87:	0f 84 21 02 00 00    	je     802fae <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802d8d:	55                   	push   %rbp
+  802d8e:	48 89 e5             	mov    %rsp,%rbp
+  802d91:	41 57                	push   %r15
+  802d93:	41 56                	push   %r14
+  802d95:	41 55                	push   %r13
+  802d97:	41 54                	push   %r12
+  802d99:	53                   	push   %rbx
+  802d9a:	48 83 ec 28          	sub    $0x28,%rsp
+  802d9e:	48 89 fb             	mov    %rdi,%rbx
+  802da1:	49 89 f4             	mov    %rsi,%r12
+  802da4:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802da7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802dac:	48 85 f6             	test   %rsi,%rsi
+  802daf:	74 4b                	je     802dfc <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802db1:	48 b8 c1 20 80 00 00 	movabs $0x8020c1,%rax
+  802db8:	00 00 00 
+  802dbb:	ff d0                	call   *%rax
+  802dbd:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802dc0:	48 85 c0             	test   %rax,%rax
+  802dc3:	74 22                	je     802de7 <devfile_read+0x63>
+  802dc5:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802dcc:	77 19                	ja     802de7 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802dce:	be 00 10 00 00       	mov    $0x1000,%esi
+  802dd3:	48 89 df             	mov    %rbx,%rdi
+  802dd6:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802de2:	83 f8 02             	cmp    $0x2,%eax
+  802de5:	7e 40                	jle    802e27 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802de7:	48 89 df             	mov    %rbx,%rdi
+  802dea:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  802df1:	00 00 00 
+  802df4:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802df6:	85 c0                	test   %eax,%eax
+  802df8:	79 11                	jns    802e0b <devfile_read+0x87>
+  802dfa:	48 98                	cltq
+}
+  802dfc:	48 83 c4 28          	add    $0x28,%rsp
+  802e00:	5b                   	pop    %rbx
+  802e01:	41 5c                	pop    %r12
+  802e03:	41 5d                	pop    %r13
+  802e05:	41 5e                	pop    %r14
+  802e07:	41 5f                	pop    %r15
+  802e09:	5d                   	pop    %rbp
+  802e0a:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802e0b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802e10:	4c 89 ea             	mov    %r13,%rdx
+  802e13:	4c 89 e6             	mov    %r12,%rsi
+  802e16:	48 89 df             	mov    %rbx,%rdi
+  802e19:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+  802e25:	eb d5                	jmp    802dfc <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802e27:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e2b:	48 89 df             	mov    %rbx,%rdi
+  802e2e:	48 b8 0e 28 80 00 00 	movabs $0x80280e,%rax
+  802e35:	00 00 00 
+  802e38:	ff d0                	call   *%rax
+  802e3a:	85 c0                	test   %eax,%eax
+  802e3c:	0f 88 33 01 00 00    	js     802f75 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802e42:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  802e49:	00 00 00 
+  802e4c:	4c 89 f0             	mov    %r14,%rax
+  802e4f:	48 29 d0             	sub    %rdx,%rax
+  802e52:	48 c1 f8 03          	sar    $0x3,%rax
+  802e56:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802e5d:	aa aa aa 
+  802e60:	48 0f af c2          	imul   %rdx,%rax
+  802e64:	48 c1 e0 0e          	shl    $0xe,%rax
+  802e68:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e6c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802e6f:	41 39 06             	cmp    %eax,(%r14)
+  802e72:	75 0d                	jne    802e81 <devfile_read+0xfd>
+  802e74:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e77:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802e7b:	0f 84 fb 00 00 00    	je     802f7c <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802e81:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e86:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802e8a:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802e8d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802e91:	48 89 c7             	mov    %rax,%rdi
+  802e94:	48 b8 dc 3f 80 00 00 	movabs $0x803fdc,%rax
+  802e9b:	00 00 00 
+  802e9e:	ff d0                	call   *%rax
+  802ea0:	84 c0                	test   %al,%al
+  802ea2:	75 27                	jne    802ecb <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ea4:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ea9:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802eae:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb7:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  802ebe:	00 00 00 
+  802ec1:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	0f 88 dc 00 00 00    	js     802fa7 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ecb:	44 89 f8             	mov    %r15d,%eax
+  802ece:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ed3:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802ed5:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802edc:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802edd:	8b 43 10             	mov    0x10(%rbx),%eax
+  802ee0:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ee4:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802ee7:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802eec:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802ef0:	48 89 df             	mov    %rbx,%rdi
+  802ef3:	48 b8 0c 2b 80 00 00 	movabs $0x802b0c,%rax
+  802efa:	00 00 00 
+  802efd:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802eff:	48 85 c0             	test   %rax,%rax
+  802f02:	0f 88 f4 fe ff ff    	js     802dfc <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802f08:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802f0b:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802f0e:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802f11:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802f15:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802f19:	48 63 d1             	movslq %ecx,%rdx
+  802f1c:	48 01 d0             	add    %rdx,%rax
+  802f1f:	4d 63 ff             	movslq %r15d,%r15
+  802f22:	4c 29 f8             	sub    %r15,%rax
+  802f25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f2a:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802f2e:	48 85 c0             	test   %rax,%rax
+  802f31:	0f 8e c5 fe ff ff    	jle    802dfc <devfile_read+0x78>
+    n = MIN(n, res);
+  802f37:	4c 39 e8             	cmp    %r13,%rax
+  802f3a:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802f3e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802f41:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802f45:	48 63 f6             	movslq %esi,%rsi
+  802f48:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f4d:	48 01 c6             	add    %rax,%rsi
+  802f50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f54:	48 01 c6             	add    %rax,%rsi
+  802f57:	4c 89 ea             	mov    %r13,%rdx
+  802f5a:	4c 89 e7             	mov    %r12,%rdi
+  802f5d:	48 b8 8f 10 80 00 00 	movabs $0x80108f,%rax
+  802f64:	00 00 00 
+  802f67:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802f69:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802f6d:	4c 89 e8             	mov    %r13,%rax
+  802f70:	e9 87 fe ff ff       	jmp    802dfc <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f75:	48 98                	cltq
+  802f77:	e9 80 fe ff ff       	jmp    802dfc <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f7c:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f80:	41 39 d7             	cmp    %edx,%r15d
+  802f83:	0f 8c f8 fe ff ff    	jl     802e81 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802f89:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802f8d:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802f90:	41 39 cf             	cmp    %ecx,%r15d
+  802f93:	0f 8d e8 fe ff ff    	jge    802e81 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802f99:	4d 63 ff             	movslq %r15d,%r15
+  802f9c:	4c 29 f8             	sub    %r15,%rax
+  802f9f:	48 63 d2             	movslq %edx,%rdx
+  802fa2:	48 01 d0             	add    %rdx,%rax
+  802fa5:	eb 87                	jmp    802f2e <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fa7:	48 98                	cltq
+  802fa9:	e9 4e fe ff ff       	jmp    802dfc <devfile_read+0x78>
+        return E_INVAL;
+  802fae:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802fb3:	c3                   	ret
+
+0000000000802fb4 <fs_channel>:
+fs_channel(bool enable) {
+  802fb4:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802fb6:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  802fbd:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802fbf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc4:	40 84 ff             	test   %dil,%dil
+  802fc7:	74 47                	je     803010 <fs_channel+0x5c>
+  802fc9:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802fd0:	00 00 00 
+  802fd3:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802fd9:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  802fe0:	00 00 00 
+  802fe3:	3b 08                	cmp    (%rax),%ecx
+  802fe5:	74 29                	je     803010 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802fe7:	55                   	push   %rbp
+  802fe8:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802feb:	48 b8 34 1f 80 00 00 	movabs $0x801f34,%rax
+  802ff2:	00 00 00 
+  802ff5:	ff d0                	call   *%rax
+  802ff7:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802ff9:	85 c0                	test   %eax,%eax
+  802ffb:	78 04                	js     803001 <fs_channel+0x4d>
+}
+  802ffd:	89 d0                	mov    %edx,%eax
+  802fff:	5d                   	pop    %rbp
+  803000:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803001:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  803008:	00 00 00 
+  80300b:	c6 00 00             	movb   $0x0,(%rax)
+  80300e:	eb ed                	jmp    802ffd <fs_channel+0x49>
+}
+  803010:	89 d0                	mov    %edx,%eax
+  803012:	c3                   	ret
+
+0000000000803013 <open>:
+open(const char *path, int mode) {
+  803013:	55                   	push   %rbp
+  803014:	48 89 e5             	mov    %rsp,%rbp
+  803017:	41 55                	push   %r13
+  803019:	41 54                	push   %r12
+  80301b:	53                   	push   %rbx
+  80301c:	48 83 ec 18          	sub    $0x18,%rsp
+  803020:	49 89 fc             	mov    %rdi,%r12
+  803023:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803026:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  80302d:	00 00 00 
+  803030:	ff d0                	call   *%rax
+  803032:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803038:	0f 87 8f 00 00 00    	ja     8030cd <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80303e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803042:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  803049:	00 00 00 
+  80304c:	ff d0                	call   *%rax
+  80304e:	89 c3                	mov    %eax,%ebx
+  803050:	85 c0                	test   %eax,%eax
+  803052:	78 55                	js     8030a9 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803054:	4c 89 e6             	mov    %r12,%rsi
+  803057:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  80305e:	00 00 00 
+  803061:	48 89 df             	mov    %rbx,%rdi
+  803064:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  80306b:	00 00 00 
+  80306e:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803070:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80307c:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803080:	bf 01 00 00 00       	mov    $0x1,%edi
+  803085:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  80308c:	00 00 00 
+  80308f:	ff d0                	call   *%rax
+  803091:	89 c3                	mov    %eax,%ebx
+  803093:	85 c0                	test   %eax,%eax
+  803095:	78 1f                	js     8030b6 <open+0xa3>
+    return fd2num(fd);
+  803097:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80309b:	48 b8 c0 17 80 00 00 	movabs $0x8017c0,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	89 c3                	mov    %eax,%ebx
+}
+  8030a9:	89 d8                	mov    %ebx,%eax
+  8030ab:	48 83 c4 18          	add    $0x18,%rsp
+  8030af:	5b                   	pop    %rbx
+  8030b0:	41 5c                	pop    %r12
+  8030b2:	41 5d                	pop    %r13
+  8030b4:	5d                   	pop    %rbp
+  8030b5:	c3                   	ret
+        fd_close(fd, 0);
+  8030b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8030bb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8030bf:	48 b8 09 19 80 00 00 	movabs $0x801909,%rax
+  8030c6:	00 00 00 
+  8030c9:	ff d0                	call   *%rax
+        return res;
+  8030cb:	eb dc                	jmp    8030a9 <open+0x96>
+        return -E_BAD_PATH;
+  8030cd:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8030d2:	eb d5                	jmp    8030a9 <open+0x96>
+
+00000000008030d4 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8030d4:	55                   	push   %rbp
+  8030d5:	48 89 e5             	mov    %rsp,%rbp
+  8030d8:	41 56                	push   %r14
+  8030da:	41 55                	push   %r13
+  8030dc:	41 54                	push   %r12
+  8030de:	53                   	push   %rbx
+  8030df:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8030e3:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  8030ea:	00 00 00 
+  8030ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8030f2:	49 bd 4e 18 80 00 00 	movabs $0x80184e,%r13
+  8030f9:	00 00 00 
+  8030fc:	49 be 0e 28 80 00 00 	movabs $0x80280e,%r14
+  803103:	00 00 00 
+  803106:	eb 0c                	jmp    803114 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803108:	83 c3 01             	add    $0x1,%ebx
+  80310b:	49 83 c4 18          	add    $0x18,%r12
+  80310f:	83 fb 20             	cmp    $0x20,%ebx
+  803112:	74 1d                	je     803131 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803114:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803119:	74 ed                	je     803108 <file_flush_buffers+0x34>
+  80311b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80311f:	89 df                	mov    %ebx,%edi
+  803121:	41 ff d5             	call   *%r13
+  803124:	85 c0                	test   %eax,%eax
+  803126:	78 e0                	js     803108 <file_flush_buffers+0x34>
+  803128:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80312c:	41 ff d6             	call   *%r14
+  80312f:	eb d7                	jmp    803108 <file_flush_buffers+0x34>
+}
+  803131:	48 83 c4 10          	add    $0x10,%rsp
+  803135:	5b                   	pop    %rbx
+  803136:	41 5c                	pop    %r12
+  803138:	41 5d                	pop    %r13
+  80313a:	41 5e                	pop    %r14
+  80313c:	5d                   	pop    %rbp
+  80313d:	c3                   	ret
+
+000000000080313e <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80313e:	55                   	push   %rbp
+  80313f:	48 89 e5             	mov    %rsp,%rbp
+  803142:	41 54                	push   %r12
+  803144:	53                   	push   %rbx
+  803145:	49 89 fc             	mov    %rdi,%r12
+  803148:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80314a:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  803151:	00 00 00 
+  803154:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803156:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80315d:	00 00 00 
+  803160:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803165:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803167:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80316a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316f:	be 00 00 00 00       	mov    $0x0,%esi
+  803174:	bf 02 00 00 00       	mov    $0x2,%edi
+  803179:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803180:	00 00 00 
+  803183:	ff d0                	call   *%rax
+}
+  803185:	5b                   	pop    %rbx
+  803186:	41 5c                	pop    %r12
+  803188:	5d                   	pop    %rbp
+  803189:	c3                   	ret
+
+000000000080318a <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80318a:	55                   	push   %rbp
+  80318b:	48 89 e5             	mov    %rsp,%rbp
+  80318e:	41 54                	push   %r12
+  803190:	53                   	push   %rbx
+  803191:	49 89 fc             	mov    %rdi,%r12
+  803194:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803197:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  80319e:	00 00 00 
+  8031a1:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8031a3:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8031a8:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8031af:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8031b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8031bb:	bf 05 00 00 00       	mov    $0x5,%edi
+  8031c0:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  8031c7:	00 00 00 
+  8031ca:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031cc:	85 c0                	test   %eax,%eax
+  8031ce:	78 3d                	js     80320d <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8031d0:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  8031d7:	00 00 00 
+  8031da:	4c 89 e6             	mov    %r12,%rsi
+  8031dd:	48 89 df             	mov    %rbx,%rdi
+  8031e0:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  8031e7:	00 00 00 
+  8031ea:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8031ec:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8031f3:	00 
+  8031f4:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8031fa:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803201:	00 
+  803202:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803208:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80320d:	5b                   	pop    %rbx
+  80320e:	41 5c                	pop    %r12
+  803210:	5d                   	pop    %rbp
+  803211:	c3                   	ret
+
+0000000000803212 <remove>:
+remove(const char *path) {
+  803212:	55                   	push   %rbp
+  803213:	48 89 e5             	mov    %rsp,%rbp
+  803216:	53                   	push   %rbx
+  803217:	48 83 ec 08          	sub    $0x8,%rsp
+  80321b:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80321e:	48 b8 f0 0d 80 00 00 	movabs $0x800df0,%rax
+  803225:	00 00 00 
+  803228:	ff d0                	call   *%rax
+  80322a:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803230:	77 3a                	ja     80326c <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803232:	48 89 de             	mov    %rbx,%rsi
+  803235:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  80323c:	00 00 00 
+  80323f:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  803246:	00 00 00 
+  803249:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80324b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803250:	be 00 00 00 00       	mov    $0x0,%esi
+  803255:	bf 07 00 00 00       	mov    $0x7,%edi
+  80325a:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803261:	00 00 00 
+  803264:	ff d0                	call   *%rax
+}
+  803266:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80326a:	c9                   	leave
+  80326b:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80326c:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803271:	eb f3                	jmp    803266 <remove+0x54>
+
+0000000000803273 <sync>:
+sync(void) {
+  803273:	55                   	push   %rbp
+  803274:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803277:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803283:	ba 00 00 00 00       	mov    $0x0,%edx
+  803288:	be 00 00 00 00       	mov    $0x0,%esi
+  80328d:	bf 08 00 00 00       	mov    $0x8,%edi
+  803292:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803299:	00 00 00 
+  80329c:	ff d0                	call   *%rax
+}
+  80329e:	5d                   	pop    %rbp
+  80329f:	c3                   	ret
+
+00000000008032a0 <fsync>:
+fsync(int fdnum) {
+  8032a0:	55                   	push   %rbp
+  8032a1:	48 89 e5             	mov    %rsp,%rbp
+  8032a4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032a8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032ac:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  8032b3:	00 00 00 
+  8032b6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032b8:	85 c0                	test   %eax,%eax
+  8032ba:	78 4b                	js     803307 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8032bc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032c0:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8032c7:	00 00 00 
+  8032ca:	8b 00                	mov    (%rax),%eax
+  8032cc:	39 02                	cmp    %eax,(%rdx)
+  8032ce:	75 39                	jne    803309 <fsync+0x69>
+    file_flush_buffers();
+  8032d0:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  8032d7:	00 00 00 
+  8032da:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8032dc:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8032e0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8032e3:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8032ea:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8032ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8032f6:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8032fb:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803302:	00 00 00 
+  803305:	ff d0                	call   *%rax
+}
+  803307:	c9                   	leave
+  803308:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803309:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80330e:	eb f7                	jmp    803307 <fsync+0x67>
+
+0000000000803310 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803310:	55                   	push   %rbp
+  803311:	48 89 e5             	mov    %rsp,%rbp
+  803314:	53                   	push   %rbx
+  803315:	48 83 ec 08          	sub    $0x8,%rsp
+  803319:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80331c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803321:	be 00 00 00 00       	mov    $0x0,%esi
+  803326:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80332b:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803337:	85 c0                	test   %eax,%eax
+  803339:	78 2d                	js     803368 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80333b:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803342:	00 00 00 
+  803345:	48 8b 10             	mov    (%rax),%rdx
+  803348:	48 89 13             	mov    %rdx,(%rbx)
+  80334b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80334f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803353:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803357:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80335b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80335f:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803363:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803368:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80336c:	c9                   	leave
+  80336d:	c3                   	ret
+
+000000000080336e <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80336e:	55                   	push   %rbp
+  80336f:	48 89 e5             	mov    %rsp,%rbp
+  803372:	53                   	push   %rbx
+  803373:	48 83 ec 08          	sub    $0x8,%rsp
+  803377:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80337a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80337f:	be 00 00 00 00       	mov    $0x0,%esi
+  803384:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803389:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  803390:	00 00 00 
+  803393:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803395:	85 c0                	test   %eax,%eax
+  803397:	78 3d                	js     8033d6 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803399:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  8033a0:	00 00 00 
+  8033a3:	48 8b 10             	mov    (%rax),%rdx
+  8033a6:	48 89 13             	mov    %rdx,(%rbx)
+  8033a9:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8033ad:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8033b1:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033b5:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8033b9:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8033bd:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8033c1:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8033c5:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8033c9:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8033cd:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8033d1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033d6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033da:	c9                   	leave
+  8033db:	c3                   	ret
+
+00000000008033dc <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8033dc:	55                   	push   %rbp
+  8033dd:	48 89 e5             	mov    %rsp,%rbp
+  8033e0:	41 57                	push   %r15
+  8033e2:	41 56                	push   %r14
+  8033e4:	41 55                	push   %r13
+  8033e6:	41 54                	push   %r12
+  8033e8:	53                   	push   %rbx
+  8033e9:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8033ed:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8033f4:	00 
+  8033f5:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8033fc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803402:	0f 85 43 01 00 00    	jne    80354b <munmap+0x16f>
+  803408:	49 89 ff             	mov    %rdi,%r15
+  80340b:	4c 39 f7             	cmp    %r14,%rdi
+  80340e:	0f 87 37 01 00 00    	ja     80354b <munmap+0x16f>
+  803414:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  80341b:	00 00 00 
+  80341e:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803424:	eb 2c                	jmp    803452 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803426:	4c 39 f8             	cmp    %r15,%rax
+  803429:	0f 83 85 00 00 00    	jae    8034b4 <munmap+0xd8>
+            m->mm_end = start;
+  80342f:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803434:	48 83 c3 18          	add    $0x18,%rbx
+  803438:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80343f:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803446:	00 00 00 
+  803449:	48 39 c3             	cmp    %rax,%rbx
+  80344c:	0f 84 d0 00 00 00    	je     803522 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803452:	49 89 dc             	mov    %rbx,%r12
+  803455:	48 8b 03             	mov    (%rbx),%rax
+  803458:	4c 39 f0             	cmp    %r14,%rax
+  80345b:	73 d7                	jae    803434 <munmap+0x58>
+  80345d:	48 85 c0             	test   %rax,%rax
+  803460:	74 d2                	je     803434 <munmap+0x58>
+  803462:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803466:	49 39 d7             	cmp    %rdx,%r15
+  803469:	73 c9                	jae    803434 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80346b:	49 39 d6             	cmp    %rdx,%r14
+  80346e:	73 b6                	jae    803426 <munmap+0x4a>
+  803470:	49 39 c7             	cmp    %rax,%r15
+  803473:	76 b1                	jbe    803426 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803475:	4c 89 ef             	mov    %r13,%rdi
+  803478:	48 b8 13 25 80 00 00 	movabs $0x802513,%rax
+  80347f:	00 00 00 
+  803482:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803484:	48 85 c0             	test   %rax,%rax
+  803487:	0f 84 c5 00 00 00    	je     803552 <munmap+0x176>
+            *tail = *m;
+  80348d:	48 8b 13             	mov    (%rbx),%rdx
+  803490:	48 89 10             	mov    %rdx,(%rax)
+  803493:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803497:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80349b:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80349f:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8034a3:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8034a6:	44 89 f2             	mov    %r14d,%edx
+  8034a9:	2b 13                	sub    (%rbx),%edx
+  8034ab:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8034ae:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8034b2:	eb 80                	jmp    803434 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8034b4:	49 39 d6             	cmp    %rdx,%r14
+  8034b7:	73 18                	jae    8034d1 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8034b9:	44 89 f2             	mov    %r14d,%edx
+  8034bc:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8034c1:	29 c2                	sub    %eax,%edx
+  8034c3:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8034c8:	4d 89 34 24          	mov    %r14,(%r12)
+  8034cc:	e9 63 ff ff ff       	jmp    803434 <munmap+0x58>
+    m->mm_start = 0;
+  8034d1:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8034d8:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8034d9:	4c 89 e6             	mov    %r12,%rsi
+  8034dc:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8034e3:	00 00 00 
+  8034e6:	48 29 c6             	sub    %rax,%rsi
+  8034e9:	48 c1 fe 03          	sar    $0x3,%rsi
+  8034ed:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8034f4:	aa aa aa 
+  8034f7:	48 0f af f0          	imul   %rax,%rsi
+  8034fb:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8034ff:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803504:	48 01 c6             	add    %rax,%rsi
+  803507:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80350c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803511:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  803518:	00 00 00 
+  80351b:	ff d0                	call   *%rax
+}
+  80351d:	e9 12 ff ff ff       	jmp    803434 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803522:	4c 89 f2             	mov    %r14,%rdx
+  803525:	4c 29 fa             	sub    %r15,%rdx
+  803528:	4c 89 fe             	mov    %r15,%rsi
+  80352b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803530:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  803537:	00 00 00 
+  80353a:	ff d0                	call   *%rax
+}
+  80353c:	48 83 c4 08          	add    $0x8,%rsp
+  803540:	5b                   	pop    %rbx
+  803541:	41 5c                	pop    %r12
+  803543:	41 5d                	pop    %r13
+  803545:	41 5e                	pop    %r14
+  803547:	41 5f                	pop    %r15
+  803549:	5d                   	pop    %rbp
+  80354a:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80354b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803550:	eb ea                	jmp    80353c <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803552:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803557:	eb e3                	jmp    80353c <munmap+0x160>
+
+0000000000803559 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803559:	55                   	push   %rbp
+  80355a:	48 89 e5             	mov    %rsp,%rbp
+  80355d:	41 57                	push   %r15
+  80355f:	41 56                	push   %r14
+  803561:	41 55                	push   %r13
+  803563:	41 54                	push   %r12
+  803565:	53                   	push   %rbx
+  803566:	48 83 ec 28          	sub    $0x28,%rsp
+  80356a:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80356e:	49 89 f5             	mov    %rsi,%r13
+  803571:	41 89 d6             	mov    %edx,%r14d
+  803574:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803577:	41 89 cc             	mov    %ecx,%r12d
+  80357a:	44 89 c7             	mov    %r8d,%edi
+  80357d:	44 89 cb             	mov    %r9d,%ebx
+  803580:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803584:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803588:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  80358f:	00 00 00 
+  803592:	ff d0                	call   *%rax
+  803594:	41 89 c7             	mov    %eax,%r15d
+  803597:	85 c0                	test   %eax,%eax
+  803599:	0f 88 ae 01 00 00    	js     80374d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80359f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8035a3:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8035aa:	00 00 00 
+  8035ad:	8b 32                	mov    (%rdx),%esi
+  8035af:	39 30                	cmp    %esi,(%rax)
+  8035b1:	0f 85 7a 02 00 00    	jne    803831 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8035b7:	8b 40 08             	mov    0x8(%rax),%eax
+  8035ba:	83 e0 03             	and    $0x3,%eax
+  8035bd:	83 f8 01             	cmp    $0x1,%eax
+  8035c0:	0f 84 76 02 00 00    	je     80383c <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8035c6:	4d 85 ed             	test   %r13,%r13
+  8035c9:	0f 84 78 02 00 00    	je     803847 <mmap+0x2ee>
+  8035cf:	85 db                	test   %ebx,%ebx
+  8035d1:	0f 88 70 02 00 00    	js     803847 <mmap+0x2ee>
+  8035d7:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8035dd:	41 89 df             	mov    %ebx,%r15d
+  8035e0:	0f 85 6c 02 00 00    	jne    803852 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8035e6:	44 89 f0             	mov    %r14d,%eax
+  8035e9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8035ec:	83 f8 04             	cmp    $0x4,%eax
+  8035ef:	0f 85 68 02 00 00    	jne    80385d <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8035f5:	44 89 e1             	mov    %r12d,%ecx
+  8035f8:	83 e1 01             	and    $0x1,%ecx
+  8035fb:	0f 95 c2             	setne  %dl
+  8035fe:	44 89 e0             	mov    %r12d,%eax
+  803601:	d1 e8                	shr    %eax
+  803603:	83 f0 01             	xor    $0x1,%eax
+  803606:	83 e0 01             	and    $0x1,%eax
+  803609:	38 c2                	cmp    %al,%dl
+  80360b:	0f 85 57 02 00 00    	jne    803868 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803611:	85 c9                	test   %ecx,%ecx
+  803613:	74 0a                	je     80361f <mmap+0xc6>
+  803615:	41 f6 c6 02          	test   $0x2,%r14b
+  803619:	0f 85 54 02 00 00    	jne    803873 <mmap+0x31a>
+    file_flush_buffers();
+  80361f:	48 b8 d4 30 80 00 00 	movabs $0x8030d4,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80362b:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803632:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803639:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80363d:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803640:	41 f6 c4 04          	test   $0x4,%r12b
+  803644:	0f 84 15 01 00 00    	je     80375f <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80364a:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80364d:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803653:	0f 85 25 02 00 00    	jne    80387e <mmap+0x325>
+  803659:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80365d:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803664:	00 00 00 
+  803667:	48 39 c2             	cmp    %rax,%rdx
+  80366a:	0f 82 19 02 00 00    	jb     803889 <mmap+0x330>
+  803670:	48 39 c7             	cmp    %rax,%rdi
+  803673:	0f 87 10 02 00 00    	ja     803889 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803679:	4c 89 ee             	mov    %r13,%rsi
+  80367c:	48 b8 dc 33 80 00 00 	movabs $0x8033dc,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+  803688:	85 c0                	test   %eax,%eax
+  80368a:	0f 88 04 02 00 00    	js     803894 <mmap+0x33b>
+    if (!handler) {
+  803690:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803697:	00 00 00 
+  80369a:	80 38 00             	cmpb   $0x0,(%rax)
+  80369d:	75 2b                	jne    8036ca <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80369f:	48 bf 74 24 80 00 00 	movabs $0x802474,%rdi
+  8036a6:	00 00 00 
+  8036a9:	48 b8 35 45 80 00 00 	movabs $0x804535,%rax
+  8036b0:	00 00 00 
+  8036b3:	ff d0                	call   *%rax
+  8036b5:	85 c0                	test   %eax,%eax
+  8036b7:	0f 88 ea 01 00 00    	js     8038a7 <mmap+0x34e>
+        handler = 1;
+  8036bd:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8036c4:	00 00 00 
+  8036c7:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8036ca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8036ce:	48 b8 13 25 80 00 00 	movabs $0x802513,%rax
+  8036d5:	00 00 00 
+  8036d8:	ff d0                	call   *%rax
+  8036da:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8036dd:	48 85 c0             	test   %rax,%rax
+  8036e0:	0f 84 c9 01 00 00    	je     8038af <mmap+0x356>
+    m->mm_start = va;
+  8036e6:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8036e9:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8036ed:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8036f1:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8036f4:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8036f8:	44 89 e0             	mov    %r12d,%eax
+  8036fb:	c1 e0 06             	shl    $0x6,%eax
+  8036fe:	25 80 00 00 00       	and    $0x80,%eax
+  803703:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803706:	09 f0                	or     %esi,%eax
+  803708:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80370c:	41 f6 c4 08          	test   $0x8,%r12b
+  803710:	74 31                	je     803743 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803712:	48 39 d3             	cmp    %rdx,%rbx
+  803715:	73 2c                	jae    803743 <mmap+0x1ea>
+  803717:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80371c:	48 89 de             	mov    %rbx,%rsi
+  80371f:	4c 89 f7             	mov    %r14,%rdi
+  803722:	48 b8 63 23 80 00 00 	movabs $0x802363,%rax
+  803729:	00 00 00 
+  80372c:	ff d0                	call   *%rax
+  80372e:	49 89 c4             	mov    %rax,%r12
+  803731:	48 85 c0             	test   %rax,%rax
+  803734:	0f 8e d7 00 00 00    	jle    803811 <mmap+0x2b8>
+            va += n;
+  80373a:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80373d:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803741:	72 d4                	jb     803717 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803743:	49 8b 06             	mov    (%r14),%rax
+  803746:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80374a:	48 89 06             	mov    %rax,(%rsi)
+}
+  80374d:	44 89 f8             	mov    %r15d,%eax
+  803750:	48 83 c4 28          	add    $0x28,%rsp
+  803754:	5b                   	pop    %rbx
+  803755:	41 5c                	pop    %r12
+  803757:	41 5d                	pop    %r13
+  803759:	41 5e                	pop    %r14
+  80375b:	41 5f                	pop    %r15
+  80375d:	5d                   	pop    %rbp
+  80375e:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80375f:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803766:	00 00 00 
+  803769:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80376c:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803773:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803776:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80377b:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  803782:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803785:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80378c:	00 00 00 
+  80378f:	48 39 d7             	cmp    %rdx,%rdi
+  803792:	73 1c                	jae    8037b0 <mmap+0x257>
+        return -E_NO_MEM;
+  803794:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80379a:	eb b1                	jmp    80374d <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80379c:	48 83 c0 01          	add    $0x1,%rax
+  8037a0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8037a4:	77 3f                	ja     8037e5 <mmap+0x28c>
+  8037a6:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8037ab:	48 39 d7             	cmp    %rdx,%rdi
+  8037ae:	72 2a                	jb     8037da <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8037b0:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8037b4:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8037b8:	48 39 d1             	cmp    %rdx,%rcx
+  8037bb:	73 df                	jae    80379c <mmap+0x243>
+  8037bd:	48 85 c9             	test   %rcx,%rcx
+  8037c0:	74 da                	je     80379c <mmap+0x243>
+  8037c2:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8037c6:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8037cb:	48 39 d3             	cmp    %rdx,%rbx
+  8037ce:	73 cc                	jae    80379c <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8037d0:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8037d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037d8:	eb cc                	jmp    8037a6 <mmap+0x24d>
+        return -E_NO_MEM;
+  8037da:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037e0:	e9 68 ff ff ff       	jmp    80374d <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8037e5:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8037ea:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8037f1:	00 00 00 
+  8037f4:	48 39 c2             	cmp    %rax,%rdx
+  8037f7:	0f 82 9f 00 00 00    	jb     80389c <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8037fd:	48 85 db             	test   %rbx,%rbx
+  803800:	0f 85 8a fe ff ff    	jne    803690 <mmap+0x137>
+        return -E_NO_MEM;
+  803806:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80380c:	e9 3c ff ff ff       	jmp    80374d <mmap+0x1f4>
+        if (n < 0) {
+  803811:	0f 89 2c ff ff ff    	jns    803743 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803817:	49 8b 3e             	mov    (%r14),%rdi
+  80381a:	4c 89 ee             	mov    %r13,%rsi
+  80381d:	48 b8 dc 33 80 00 00 	movabs $0x8033dc,%rax
+  803824:	00 00 00 
+  803827:	ff d0                	call   *%rax
+            return n;
+  803829:	45 89 e7             	mov    %r12d,%r15d
+  80382c:	e9 1c ff ff ff       	jmp    80374d <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803831:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803837:	e9 11 ff ff ff       	jmp    80374d <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80383c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803842:	e9 06 ff ff ff       	jmp    80374d <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803847:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80384d:	e9 fb fe ff ff       	jmp    80374d <mmap+0x1f4>
+  803852:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803858:	e9 f0 fe ff ff       	jmp    80374d <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80385d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803863:	e9 e5 fe ff ff       	jmp    80374d <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803868:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80386e:	e9 da fe ff ff       	jmp    80374d <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803873:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803879:	e9 cf fe ff ff       	jmp    80374d <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80387e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803884:	e9 c4 fe ff ff       	jmp    80374d <mmap+0x1f4>
+  803889:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80388f:	e9 b9 fe ff ff       	jmp    80374d <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803894:	41 89 c7             	mov    %eax,%r15d
+  803897:	e9 b1 fe ff ff       	jmp    80374d <mmap+0x1f4>
+        return -E_NO_MEM;
+  80389c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038a2:	e9 a6 fe ff ff       	jmp    80374d <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038a7:	41 89 c7             	mov    %eax,%r15d
+  8038aa:	e9 9e fe ff ff       	jmp    80374d <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8038af:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038b5:	e9 93 fe ff ff       	jmp    80374d <mmap+0x1f4>
+
+00000000008038ba <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8038ba:	55                   	push   %rbp
+  8038bb:	48 89 e5             	mov    %rsp,%rbp
+  8038be:	41 54                	push   %r12
+  8038c0:	53                   	push   %rbx
+  8038c1:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8038c4:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  8038cb:	00 00 00 
+  8038ce:	ff d0                	call   *%rax
+  8038d0:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8038d3:	48 be 60 50 80 00 00 	movabs $0x805060,%rsi
+  8038da:	00 00 00 
+  8038dd:	48 89 df             	mov    %rbx,%rdi
+  8038e0:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  8038e7:	00 00 00 
+  8038ea:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8038ec:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8038f1:	41 2b 04 24          	sub    (%r12),%eax
+  8038f5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8038fb:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803902:	00 00 00 
+    stat->st_dev = &devpipe;
+  803905:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80390c:	00 00 00 
+  80390f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803916:	b8 00 00 00 00       	mov    $0x0,%eax
+  80391b:	5b                   	pop    %rbx
+  80391c:	41 5c                	pop    %r12
+  80391e:	5d                   	pop    %rbp
+  80391f:	c3                   	ret
+
+0000000000803920 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803920:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803923:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803929:	8b 17                	mov    (%rdi),%edx
+  80392b:	85 d2                	test   %edx,%edx
+  80392d:	75 01                	jne    803930 <pipe_wakeup+0x10>
+  80392f:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803930:	55                   	push   %rbp
+  803931:	48 89 e5             	mov    %rsp,%rbp
+  803934:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803937:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80393d:	be 00 04 00 00       	mov    $0x400,%esi
+  803942:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  803949:	00 00 00 
+  80394c:	ff d0                	call   *%rax
+}
+  80394e:	5d                   	pop    %rbp
+  80394f:	c3                   	ret
+
+0000000000803950 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803950:	55                   	push   %rbp
+  803951:	48 89 e5             	mov    %rsp,%rbp
+  803954:	41 55                	push   %r13
+  803956:	41 54                	push   %r12
+  803958:	53                   	push   %rbx
+  803959:	48 83 ec 08          	sub    $0x8,%rsp
+  80395d:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803960:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803967:	00 00 00 
+  80396a:	ff d0                	call   *%rax
+  80396c:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  80396f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803974:	4c 89 e6             	mov    %r12,%rsi
+  803977:	bf 00 00 00 00       	mov    $0x0,%edi
+  80397c:	49 bc 33 14 80 00 00 	movabs $0x801433,%r12
+  803983:	00 00 00 
+  803986:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803989:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80398d:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803991:	49 bd 20 39 80 00 00 	movabs $0x803920,%r13
+  803998:	00 00 00 
+  80399b:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80399e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8039a2:	48 89 de             	mov    %rbx,%rsi
+  8039a5:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8039a8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039ad:	48 89 de             	mov    %rbx,%rsi
+  8039b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039b5:	41 ff d4             	call   *%r12
+  8039b8:	48 83 c4 08          	add    $0x8,%rsp
+  8039bc:	5b                   	pop    %rbx
+  8039bd:	41 5c                	pop    %r12
+  8039bf:	41 5d                	pop    %r13
+  8039c1:	5d                   	pop    %rbp
+  8039c2:	c3                   	ret
+
+00000000008039c3 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8039c3:	55                   	push   %rbp
+  8039c4:	48 89 e5             	mov    %rsp,%rbp
+  8039c7:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8039ca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8039cf:	be 00 10 00 00       	mov    $0x1000,%esi
+  8039d4:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	0f 94 c0             	sete   %al
+  8039e5:	0f b6 c0             	movzbl %al,%eax
+}
+  8039e8:	5d                   	pop    %rbp
+  8039e9:	c3                   	ret
+
+00000000008039ea <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8039ea:	55                   	push   %rbp
+  8039eb:	48 89 e5             	mov    %rsp,%rbp
+  8039ee:	41 57                	push   %r15
+  8039f0:	41 56                	push   %r14
+  8039f2:	41 55                	push   %r13
+  8039f4:	41 54                	push   %r12
+  8039f6:	53                   	push   %rbx
+  8039f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8039fb:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8039ff:	49 89 f4             	mov    %rsi,%r12
+  803a02:	49 89 d7             	mov    %rdx,%r15
+  803a05:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a09:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+  803a15:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a18:	4d 85 ff             	test   %r15,%r15
+  803a1b:	0f 84 f1 00 00 00    	je     803b12 <devpipe_write+0x128>
+  803a21:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803a25:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803a29:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803a2d:	49 bd c3 39 80 00 00 	movabs $0x8039c3,%r13
+  803a34:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a37:	49 bf 20 39 80 00 00 	movabs $0x803920,%r15
+  803a3e:	00 00 00 
+  803a41:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803a45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a49:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803a4d:	8b 73 04             	mov    0x4(%rbx),%esi
+  803a50:	48 63 ce             	movslq %esi,%rcx
+  803a53:	48 63 03             	movslq (%rbx),%rax
+  803a56:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803a5c:	48 39 c1             	cmp    %rax,%rcx
+  803a5f:	72 64                	jb     803ac5 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a61:	48 89 de             	mov    %rbx,%rsi
+  803a64:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803a68:	41 ff d5             	call   *%r13
+  803a6b:	85 c0                	test   %eax,%eax
+  803a6d:	0f 85 b9 00 00 00    	jne    803b2c <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a73:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803a77:	4c 89 f7             	mov    %r14,%rdi
+  803a7a:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803a7d:	8b 43 04             	mov    0x4(%rbx),%eax
+  803a80:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803a87:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a8e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803a94:	8b 03                	mov    (%rbx),%eax
+  803a96:	41 39 c4             	cmp    %eax,%r12d
+  803a99:	75 b2                	jne    803a4d <devpipe_write+0x63>
+  803a9b:	48 89 de             	mov    %rbx,%rsi
+  803a9e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aa2:	41 ff d5             	call   *%r13
+  803aa5:	85 c0                	test   %eax,%eax
+  803aa7:	75 a0                	jne    803a49 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803aa9:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803aae:	44 89 e6             	mov    %r12d,%esi
+  803ab1:	48 89 df             	mov    %rbx,%rdi
+  803ab4:	48 b8 fb 16 80 00 00 	movabs $0x8016fb,%rax
+  803abb:	00 00 00 
+  803abe:	ff d0                	call   *%rax
+  803ac0:	e9 7c ff ff ff       	jmp    803a41 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803ac5:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803ac9:	41 0f b6 38          	movzbl (%r8),%edi
+  803acd:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803ad4:	80 80 80 
+  803ad7:	48 89 c8             	mov    %rcx,%rax
+  803ada:	48 f7 e2             	mul    %rdx
+  803add:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803ae1:	48 89 d0             	mov    %rdx,%rax
+  803ae4:	48 c1 e0 08          	shl    $0x8,%rax
+  803ae8:	48 29 d0             	sub    %rdx,%rax
+  803aeb:	48 c1 e0 04          	shl    $0x4,%rax
+  803aef:	48 29 c1             	sub    %rax,%rcx
+  803af2:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803af7:	83 c6 01             	add    $0x1,%esi
+  803afa:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803afd:	49 83 c0 01          	add    $0x1,%r8
+  803b01:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803b05:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803b09:	49 39 c0             	cmp    %rax,%r8
+  803b0c:	0f 85 2f ff ff ff    	jne    803a41 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b12:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b16:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b1a:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  803b21:	00 00 00 
+  803b24:	ff d0                	call   *%rax
+    return n;
+  803b26:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803b2a:	eb 05                	jmp    803b31 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b2c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803b31:	48 83 c4 38          	add    $0x38,%rsp
+  803b35:	5b                   	pop    %rbx
+  803b36:	41 5c                	pop    %r12
+  803b38:	41 5d                	pop    %r13
+  803b3a:	41 5e                	pop    %r14
+  803b3c:	41 5f                	pop    %r15
+  803b3e:	5d                   	pop    %rbp
+  803b3f:	c3                   	ret
+
+0000000000803b40 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803b40:	55                   	push   %rbp
+  803b41:	48 89 e5             	mov    %rsp,%rbp
+  803b44:	41 57                	push   %r15
+  803b46:	41 56                	push   %r14
+  803b48:	41 55                	push   %r13
+  803b4a:	41 54                	push   %r12
+  803b4c:	53                   	push   %rbx
+  803b4d:	48 83 ec 28          	sub    $0x28,%rsp
+  803b51:	49 89 fd             	mov    %rdi,%r13
+  803b54:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803b58:	49 89 d4             	mov    %rdx,%r12
+  803b5b:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b5f:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803b66:	00 00 00 
+  803b69:	ff d0                	call   *%rax
+  803b6b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b6e:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803b74:	49 bf c3 39 80 00 00 	movabs $0x8039c3,%r15
+  803b7b:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803b7e:	4d 85 e4             	test   %r12,%r12
+  803b81:	0f 84 d5 00 00 00    	je     803c5c <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803b87:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b8b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803b8f:	8b 03                	mov    (%rbx),%eax
+  803b91:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803b94:	75 7a                	jne    803c10 <devpipe_read+0xd0>
+            if (i > 0) {
+  803b96:	4d 85 f6             	test   %r14,%r14
+  803b99:	75 50                	jne    803beb <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b9b:	48 89 de             	mov    %rbx,%rsi
+  803b9e:	4c 89 ef             	mov    %r13,%rdi
+  803ba1:	41 ff d7             	call   *%r15
+  803ba4:	85 c0                	test   %eax,%eax
+  803ba6:	0f 85 c9 00 00 00    	jne    803c75 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803bac:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803baf:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803bb6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bbc:	8b 43 04             	mov    0x4(%rbx),%eax
+  803bbf:	41 39 c4             	cmp    %eax,%r12d
+  803bc2:	75 cb                	jne    803b8f <devpipe_read+0x4f>
+  803bc4:	48 89 de             	mov    %rbx,%rsi
+  803bc7:	4c 89 ef             	mov    %r13,%rdi
+  803bca:	41 ff d7             	call   *%r15
+  803bcd:	85 c0                	test   %eax,%eax
+  803bcf:	75 be                	jne    803b8f <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bd1:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bd6:	44 89 e6             	mov    %r12d,%esi
+  803bd9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bdd:	48 b8 fb 16 80 00 00 	movabs $0x8016fb,%rax
+  803be4:	00 00 00 
+  803be7:	ff d0                	call   *%rax
+  803be9:	eb a4                	jmp    803b8f <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803beb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bef:	48 89 de             	mov    %rbx,%rsi
+  803bf2:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  803bf9:	00 00 00 
+  803bfc:	ff d0                	call   *%rax
+                return i;
+  803bfe:	4c 89 f0             	mov    %r14,%rax
+}
+  803c01:	48 83 c4 28          	add    $0x28,%rsp
+  803c05:	5b                   	pop    %rbx
+  803c06:	41 5c                	pop    %r12
+  803c08:	41 5d                	pop    %r13
+  803c0a:	41 5e                	pop    %r14
+  803c0c:	41 5f                	pop    %r15
+  803c0e:	5d                   	pop    %rbp
+  803c0f:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803c10:	48 63 c8             	movslq %eax,%rcx
+  803c13:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c1a:	80 80 80 
+  803c1d:	48 89 c8             	mov    %rcx,%rax
+  803c20:	48 f7 e2             	mul    %rdx
+  803c23:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c27:	48 89 d0             	mov    %rdx,%rax
+  803c2a:	48 c1 e0 08          	shl    $0x8,%rax
+  803c2e:	48 29 d0             	sub    %rdx,%rax
+  803c31:	48 c1 e0 04          	shl    $0x4,%rax
+  803c35:	48 89 c2             	mov    %rax,%rdx
+  803c38:	48 89 c8             	mov    %rcx,%rax
+  803c3b:	48 29 d0             	sub    %rdx,%rax
+  803c3e:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803c43:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803c47:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803c4b:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c4e:	49 83 c6 01          	add    $0x1,%r14
+  803c52:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803c56:	0f 85 2b ff ff ff    	jne    803b87 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c5c:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c60:	48 89 de             	mov    %rbx,%rsi
+  803c63:	48 b8 20 39 80 00 00 	movabs $0x803920,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+    return n;
+  803c6f:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803c73:	eb 8c                	jmp    803c01 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c75:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c7a:	eb 85                	jmp    803c01 <devpipe_read+0xc1>
+
+0000000000803c7c <pipe>:
+pipe(int pfd[2]) {
+  803c7c:	55                   	push   %rbp
+  803c7d:	48 89 e5             	mov    %rsp,%rbp
+  803c80:	41 55                	push   %r13
+  803c82:	41 54                	push   %r12
+  803c84:	53                   	push   %rbx
+  803c85:	48 83 ec 18          	sub    $0x18,%rsp
+  803c89:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803c8c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803c90:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  803c97:	00 00 00 
+  803c9a:	ff d0                	call   *%rax
+  803c9c:	89 c3                	mov    %eax,%ebx
+  803c9e:	85 c0                	test   %eax,%eax
+  803ca0:	0f 88 a0 01 00 00    	js     803e46 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ca6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cb0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803cb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cb9:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  803cc0:	00 00 00 
+  803cc3:	ff d0                	call   *%rax
+  803cc5:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803cc7:	85 c0                	test   %eax,%eax
+  803cc9:	0f 88 77 01 00 00    	js     803e46 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ccf:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803cd3:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  803cda:	00 00 00 
+  803cdd:	ff d0                	call   *%rax
+  803cdf:	89 c3                	mov    %eax,%ebx
+  803ce1:	85 c0                	test   %eax,%eax
+  803ce3:	0f 88 43 01 00 00    	js     803e2c <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803ce9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803cee:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803cf3:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803cf7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cfc:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  803d03:	00 00 00 
+  803d06:	ff d0                	call   *%rax
+  803d08:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d0a:	85 c0                	test   %eax,%eax
+  803d0c:	0f 88 1a 01 00 00    	js     803e2c <pipe+0x1b0>
+    va = fd2data(fd0);
+  803d12:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803d16:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803d1d:	00 00 00 
+  803d20:	ff d0                	call   *%rax
+  803d22:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803d25:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d2a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d2f:	48 89 c6             	mov    %rax,%rsi
+  803d32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d37:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  803d3e:	00 00 00 
+  803d41:	ff d0                	call   *%rax
+  803d43:	89 c3                	mov    %eax,%ebx
+  803d45:	85 c0                	test   %eax,%eax
+  803d47:	0f 88 c5 00 00 00    	js     803e12 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803d4d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d51:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803d58:	00 00 00 
+  803d5b:	ff d0                	call   *%rax
+  803d5d:	48 89 c1             	mov    %rax,%rcx
+  803d60:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803d66:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803d6c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803d71:	4c 89 ee             	mov    %r13,%rsi
+  803d74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d79:	48 b8 e3 13 80 00 00 	movabs $0x8013e3,%rax
+  803d80:	00 00 00 
+  803d83:	ff d0                	call   *%rax
+  803d85:	89 c3                	mov    %eax,%ebx
+  803d87:	85 c0                	test   %eax,%eax
+  803d89:	78 6e                	js     803df9 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d8b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803d90:	4c 89 ef             	mov    %r13,%rdi
+  803d93:	48 b8 52 13 80 00 00 	movabs $0x801352,%rax
+  803d9a:	00 00 00 
+  803d9d:	ff d0                	call   *%rax
+  803d9f:	83 f8 02             	cmp    $0x2,%eax
+  803da2:	0f 85 ab 00 00 00    	jne    803e53 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803da8:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803daf:	00 00 
+  803db1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803db5:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803db7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803dbb:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803dc2:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803dc6:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803dc8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803dcc:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803dd3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803dd7:	48 bb c0 17 80 00 00 	movabs $0x8017c0,%rbx
+  803dde:	00 00 00 
+  803de1:	ff d3                	call   *%rbx
+  803de3:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803de7:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803deb:	ff d3                	call   *%rbx
+  803ded:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803df2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803df7:	eb 4d                	jmp    803e46 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803df9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dfe:	4c 89 ee             	mov    %r13,%rsi
+  803e01:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e06:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  803e0d:	00 00 00 
+  803e10:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803e12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e17:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e20:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  803e27:	00 00 00 
+  803e2a:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803e2c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e31:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e35:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e3a:	48 b8 33 14 80 00 00 	movabs $0x801433,%rax
+  803e41:	00 00 00 
+  803e44:	ff d0                	call   *%rax
+}
+  803e46:	89 d8                	mov    %ebx,%eax
+  803e48:	48 83 c4 18          	add    $0x18,%rsp
+  803e4c:	5b                   	pop    %rbx
+  803e4d:	41 5c                	pop    %r12
+  803e4f:	41 5d                	pop    %r13
+  803e51:	5d                   	pop    %rbp
+  803e52:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e53:	48 b9 90 50 80 00 00 	movabs $0x805090,%rcx
+  803e5a:	00 00 00 
+  803e5d:	48 ba 67 50 80 00 00 	movabs $0x805067,%rdx
+  803e64:	00 00 00 
+  803e67:	be 50 00 00 00       	mov    $0x50,%esi
+  803e6c:	48 bf 7c 50 80 00 00 	movabs $0x80507c,%rdi
+  803e73:	00 00 00 
+  803e76:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e7b:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  803e82:	00 00 00 
+  803e85:	41 ff d0             	call   *%r8
+
+0000000000803e88 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803e88:	55                   	push   %rbp
+  803e89:	48 89 e5             	mov    %rsp,%rbp
+  803e8c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803e90:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803e94:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  803e9b:	00 00 00 
+  803e9e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	78 23                	js     803ec7 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803ea4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ea8:	48 b8 d2 17 80 00 00 	movabs $0x8017d2,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+  803eb4:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803eb7:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ebb:	48 b8 c3 39 80 00 00 	movabs $0x8039c3,%rax
+  803ec2:	00 00 00 
+  803ec5:	ff d0                	call   *%rax
+}
+  803ec7:	c9                   	leave
+  803ec8:	c3                   	ret
+
+0000000000803ec9 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ec9:	48 89 f8             	mov    %rdi,%rax
+  803ecc:	48 c1 e8 27          	shr    $0x27,%rax
+  803ed0:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ed7:	01 00 00 
+  803eda:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ede:	f6 c2 01             	test   $0x1,%dl
+  803ee1:	74 6d                	je     803f50 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ee3:	48 89 f8             	mov    %rdi,%rax
+  803ee6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803eea:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ef1:	01 00 00 
+  803ef4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ef8:	f6 c2 01             	test   $0x1,%dl
+  803efb:	74 62                	je     803f5f <get_uvpt_entry+0x96>
+  803efd:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f04:	01 00 00 
+  803f07:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f0b:	f6 c2 80             	test   $0x80,%dl
+  803f0e:	75 4f                	jne    803f5f <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f10:	48 89 f8             	mov    %rdi,%rax
+  803f13:	48 c1 e8 15          	shr    $0x15,%rax
+  803f17:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f1e:	01 00 00 
+  803f21:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f25:	f6 c2 01             	test   $0x1,%dl
+  803f28:	74 44                	je     803f6e <get_uvpt_entry+0xa5>
+  803f2a:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f31:	01 00 00 
+  803f34:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f38:	f6 c2 80             	test   $0x80,%dl
+  803f3b:	75 31                	jne    803f6e <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803f3d:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803f41:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803f48:	01 00 00 
+  803f4b:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803f4f:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f50:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f57:	01 00 00 
+  803f5a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f5e:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f5f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f66:	01 00 00 
+  803f69:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f6d:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803f6e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803f75:	01 00 00 
+  803f78:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803f7c:	c3                   	ret
+
+0000000000803f7d <get_prot>:
+
+int
+get_prot(void *va) {
+  803f7d:	55                   	push   %rbp
+  803f7e:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803f81:	48 b8 c9 3e 80 00 00 	movabs $0x803ec9,%rax
+  803f88:	00 00 00 
+  803f8b:	ff d0                	call   *%rax
+  803f8d:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803f90:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803f95:	89 c1                	mov    %eax,%ecx
+  803f97:	83 c9 04             	or     $0x4,%ecx
+  803f9a:	f6 c2 01             	test   $0x1,%dl
+  803f9d:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803fa0:	89 c1                	mov    %eax,%ecx
+  803fa2:	83 c9 02             	or     $0x2,%ecx
+  803fa5:	f6 c2 02             	test   $0x2,%dl
+  803fa8:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803fab:	89 c1                	mov    %eax,%ecx
+  803fad:	83 c9 01             	or     $0x1,%ecx
+  803fb0:	48 85 d2             	test   %rdx,%rdx
+  803fb3:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803fb6:	89 c1                	mov    %eax,%ecx
+  803fb8:	83 c9 40             	or     $0x40,%ecx
+  803fbb:	f6 c6 04             	test   $0x4,%dh
+  803fbe:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803fc1:	5d                   	pop    %rbp
+  803fc2:	c3                   	ret
+
+0000000000803fc3 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803fc3:	55                   	push   %rbp
+  803fc4:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803fc7:	48 b8 c9 3e 80 00 00 	movabs $0x803ec9,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803fd3:	48 c1 e8 06          	shr    $0x6,%rax
+  803fd7:	83 e0 01             	and    $0x1,%eax
+}
+  803fda:	5d                   	pop    %rbp
+  803fdb:	c3                   	ret
+
+0000000000803fdc <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803fdc:	55                   	push   %rbp
+  803fdd:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803fe0:	48 b8 c9 3e 80 00 00 	movabs $0x803ec9,%rax
+  803fe7:	00 00 00 
+  803fea:	ff d0                	call   *%rax
+  803fec:	83 e0 01             	and    $0x1,%eax
+}
+  803fef:	5d                   	pop    %rbp
+  803ff0:	c3                   	ret
+
+0000000000803ff1 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803ff1:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803ff8:	01 00 00 
+  803ffb:	a8 01                	test   $0x1,%al
+  803ffd:	75 06                	jne    804005 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803fff:	b8 00 00 00 00       	mov    $0x0,%eax
+  804004:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804005:	55                   	push   %rbp
+  804006:	48 89 e5             	mov    %rsp,%rbp
+  804009:	41 57                	push   %r15
+  80400b:	41 56                	push   %r14
+  80400d:	41 55                	push   %r13
+  80400f:	41 54                	push   %r12
+  804011:	53                   	push   %rbx
+  804012:	48 83 ec 28          	sub    $0x28,%rsp
+  804016:	49 89 fe             	mov    %rdi,%r14
+  804019:	49 89 f7             	mov    %rsi,%r15
+  80401c:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804023:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804024:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80402b:	01 00 00 
+  80402e:	e9 ae 00 00 00       	jmp    8040e1 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804033:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80403a:	49 83 ec 01          	sub    $0x1,%r12
+  80403e:	74 2d                	je     80406d <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804040:	48 89 d8             	mov    %rbx,%rax
+  804043:	48 c1 e8 0c          	shr    $0xc,%rax
+  804047:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80404c:	f6 c2 01             	test   $0x1,%dl
+  80404f:	74 e2                	je     804033 <foreach_shared_region+0x42>
+  804051:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804056:	f6 c4 04             	test   $0x4,%ah
+  804059:	74 d8                	je     804033 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80405b:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804062:	4c 89 fa             	mov    %r15,%rdx
+  804065:	48 89 df             	mov    %rbx,%rdi
+  804068:	41 ff d6             	call   *%r14
+  80406b:	eb c6                	jmp    804033 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80406d:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804074:	00 
+  804075:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80407a:	74 4a                	je     8040c6 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80407c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804080:	48 c1 e8 15          	shr    $0x15,%rax
+  804084:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80408b:	01 00 00 
+  80408e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804092:	a8 01                	test   $0x1,%al
+  804094:	74 d7                	je     80406d <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804096:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80409a:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8040a1:	48 39 c3             	cmp    %rax,%rbx
+  8040a4:	73 c7                	jae    80406d <foreach_shared_region+0x7c>
+  8040a6:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8040ad:	48 39 d0             	cmp    %rdx,%rax
+  8040b0:	4d 19 e4             	sbb    %r12,%r12
+  8040b3:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8040ba:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8040c1:	e9 7a ff ff ff       	jmp    804040 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8040c6:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8040cd:	40 
+  8040ce:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040d2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8040d9:	00 00 00 
+  8040dc:	48 39 c1             	cmp    %rax,%rcx
+  8040df:	74 50                	je     804131 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8040e1:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8040e5:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8040e9:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8040f0:	01 00 00 
+  8040f3:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8040f7:	a8 01                	test   $0x1,%al
+  8040f9:	74 cb                	je     8040c6 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8040fb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040ff:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804106:	48 39 c1             	cmp    %rax,%rcx
+  804109:	73 bb                	jae    8040c6 <foreach_shared_region+0xd5>
+  80410b:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804112:	48 39 d0             	cmp    %rdx,%rax
+  804115:	48 19 c0             	sbb    %rax,%rax
+  804118:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80411e:	48 05 00 02 00 00    	add    $0x200,%rax
+  804124:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804128:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80412c:	e9 4b ff ff ff       	jmp    80407c <foreach_shared_region+0x8b>
+  804131:	b8 00 00 00 00       	mov    $0x0,%eax
+  804136:	48 83 c4 28          	add    $0x28,%rsp
+  80413a:	5b                   	pop    %rbx
+  80413b:	41 5c                	pop    %r12
+  80413d:	41 5d                	pop    %r13
+  80413f:	41 5e                	pop    %r14
+  804141:	41 5f                	pop    %r15
+  804143:	5d                   	pop    %rbp
+  804144:	c3                   	ret
+
+0000000000804145 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804145:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80414b:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804152:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804159:	c3                   	ret
+
+000000000080415a <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80415a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80415d:	8b 17                	mov    (%rdi),%edx
+  80415f:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804161:	83 f8 0f             	cmp    $0xf,%eax
+  804164:	77 13                	ja     804179 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804166:	8b 47 40             	mov    0x40(%rdi),%eax
+  804169:	83 e0 0f             	and    $0xf,%eax
+  80416c:	48 c1 e0 09          	shl    $0x9,%rax
+  804170:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804177:	00 
+  804178:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804179:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80417e:	c3                   	ret
+
+000000000080417f <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80417f:	8b 47 40             	mov    0x40(%rdi),%eax
+  804182:	83 c0 01             	add    $0x1,%eax
+  804185:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804188:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80418e:	8b 57 04             	mov    0x4(%rdi),%edx
+  804191:	b8 00 00 00 00       	mov    $0x0,%eax
+  804196:	85 d2                	test   %edx,%edx
+  804198:	75 04                	jne    80419e <chan_publish+0x1f>
+  80419a:	83 e0 01             	and    $0x1,%eax
+}
+  80419d:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80419e:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8041a1:	85 c0                	test   %eax,%eax
+  8041a3:	0f 95 c0             	setne  %al
+  8041a6:	0f b6 c0             	movzbl %al,%eax
+  8041a9:	eb ef                	jmp    80419a <chan_publish+0x1b>
+
+00000000008041ab <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8041ab:	8b 47 40             	mov    0x40(%rdi),%eax
+  8041ae:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8041b0:	29 d0                	sub    %edx,%eax
+  8041b2:	83 e8 01             	sub    $0x1,%eax
+  8041b5:	83 f8 0f             	cmp    $0xf,%eax
+  8041b8:	77 12                	ja     8041cc <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8041ba:	8b 07                	mov    (%rdi),%eax
+  8041bc:	83 e0 0f             	and    $0xf,%eax
+  8041bf:	48 c1 e0 09          	shl    $0x9,%rax
+  8041c3:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8041ca:	00 
+  8041cb:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8041cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8041d1:	c3                   	ret
+
+00000000008041d2 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8041d2:	8b 07                	mov    (%rdi),%eax
+  8041d4:	83 c0 01             	add    $0x1,%eax
+  8041d7:	89 07                	mov    %eax,(%rdi)
+}
+  8041d9:	c3                   	ret
+
+00000000008041da <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8041da:	55                   	push   %rbp
+  8041db:	48 89 e5             	mov    %rsp,%rbp
+  8041de:	53                   	push   %rbx
+  8041df:	48 83 ec 08          	sub    $0x8,%rsp
+  8041e3:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8041e6:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8041ed:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8041f3:	48 b8 ab 41 80 00 00 	movabs $0x8041ab,%rax
+  8041fa:	00 00 00 
+  8041fd:	ff d0                	call   *%rax
+  8041ff:	48 85 c0             	test   %rax,%rax
+  804202:	74 12                	je     804216 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804204:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80420b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804210:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804214:	c9                   	leave
+  804215:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804216:	b8 01 00 00 00       	mov    $0x1,%eax
+  80421b:	eb f3                	jmp    804210 <chan_arm+0x36>
+
+000000000080421d <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80421d:	55                   	push   %rbp
+  80421e:	48 89 e5             	mov    %rsp,%rbp
+  804221:	41 56                	push   %r14
+  804223:	41 55                	push   %r13
+  804225:	41 54                	push   %r12
+  804227:	53                   	push   %rbx
+  804228:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80422b:	49 bc da 41 80 00 00 	movabs $0x8041da,%r12
+  804232:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804235:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804239:	49 bd fb 16 80 00 00 	movabs $0x8016fb,%r13
+  804240:	00 00 00 
+    while (chan_arm(r))
+  804243:	eb 0d                	jmp    804252 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804245:	8b 33                	mov    (%rbx),%esi
+  804247:	ba 00 00 00 00       	mov    $0x0,%edx
+  80424c:	4c 89 f7             	mov    %r14,%rdi
+  80424f:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804252:	48 89 df             	mov    %rbx,%rdi
+  804255:	41 ff d4             	call   *%r12
+  804258:	84 c0                	test   %al,%al
+  80425a:	75 e9                	jne    804245 <chan_wait+0x28>
+}
+  80425c:	5b                   	pop    %rbx
+  80425d:	41 5c                	pop    %r12
+  80425f:	41 5d                	pop    %r13
+  804261:	41 5e                	pop    %r14
+  804263:	5d                   	pop    %rbp
+  804264:	c3                   	ret
+
+0000000000804265 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804265:	55                   	push   %rbp
+  804266:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804269:	48 83 c7 40          	add    $0x40,%rdi
+  80426d:	be 01 00 00 00       	mov    $0x1,%esi
+  804272:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  804279:	00 00 00 
+  80427c:	ff d0                	call   *%rax
+}
+  80427e:	5d                   	pop    %rbp
+  80427f:	c3                   	ret
+
+0000000000804280 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804280:	b8 00 00 00 00       	mov    $0x0,%eax
+  804285:	c3                   	ret
+
+0000000000804286 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804286:	55                   	push   %rbp
+  804287:	48 89 e5             	mov    %rsp,%rbp
+  80428a:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80428d:	48 be b4 50 80 00 00 	movabs $0x8050b4,%rsi
+  804294:	00 00 00 
+  804297:	48 b8 2e 0e 80 00 00 	movabs $0x800e2e,%rax
+  80429e:	00 00 00 
+  8042a1:	ff d0                	call   *%rax
+    return 0;
+}
+  8042a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042a8:	5d                   	pop    %rbp
+  8042a9:	c3                   	ret
+
+00000000008042aa <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8042aa:	55                   	push   %rbp
+  8042ab:	48 89 e5             	mov    %rsp,%rbp
+  8042ae:	41 57                	push   %r15
+  8042b0:	41 56                	push   %r14
+  8042b2:	41 55                	push   %r13
+  8042b4:	41 54                	push   %r12
+  8042b6:	53                   	push   %rbx
+  8042b7:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8042be:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8042c5:	48 85 d2             	test   %rdx,%rdx
+  8042c8:	74 7a                	je     804344 <devcons_write+0x9a>
+  8042ca:	49 89 d6             	mov    %rdx,%r14
+  8042cd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8042d3:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8042d8:	49 bf 28 10 80 00 00 	movabs $0x801028,%r15
+  8042df:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8042e2:	4c 89 f3             	mov    %r14,%rbx
+  8042e5:	48 29 f3             	sub    %rsi,%rbx
+  8042e8:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8042ed:	48 39 c3             	cmp    %rax,%rbx
+  8042f0:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8042f4:	4c 63 eb             	movslq %ebx,%r13
+  8042f7:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8042fe:	48 01 c6             	add    %rax,%rsi
+  804301:	4c 89 ea             	mov    %r13,%rdx
+  804304:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80430b:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80430e:	4c 89 ee             	mov    %r13,%rsi
+  804311:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804318:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  80431f:	00 00 00 
+  804322:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804324:	41 01 dc             	add    %ebx,%r12d
+  804327:	49 63 f4             	movslq %r12d,%rsi
+  80432a:	4c 39 f6             	cmp    %r14,%rsi
+  80432d:	72 b3                	jb     8042e2 <devcons_write+0x38>
+    return res;
+  80432f:	49 63 c4             	movslq %r12d,%rax
+}
+  804332:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804339:	5b                   	pop    %rbx
+  80433a:	41 5c                	pop    %r12
+  80433c:	41 5d                	pop    %r13
+  80433e:	41 5e                	pop    %r14
+  804340:	41 5f                	pop    %r15
+  804342:	5d                   	pop    %rbp
+  804343:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804344:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80434a:	eb e3                	jmp    80432f <devcons_write+0x85>
+
+000000000080434c <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80434c:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80434f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804354:	48 85 c0             	test   %rax,%rax
+  804357:	74 55                	je     8043ae <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804359:	55                   	push   %rbp
+  80435a:	48 89 e5             	mov    %rsp,%rbp
+  80435d:	41 55                	push   %r13
+  80435f:	41 54                	push   %r12
+  804361:	53                   	push   %rbx
+  804362:	48 83 ec 08          	sub    $0x8,%rsp
+  804366:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804369:	48 bb 74 12 80 00 00 	movabs $0x801274,%rbx
+  804370:	00 00 00 
+  804373:	49 bc 29 13 80 00 00 	movabs $0x801329,%r12
+  80437a:	00 00 00 
+  80437d:	eb 03                	jmp    804382 <devcons_read+0x36>
+  80437f:	41 ff d4             	call   *%r12
+  804382:	ff d3                	call   *%rbx
+  804384:	85 c0                	test   %eax,%eax
+  804386:	74 f7                	je     80437f <devcons_read+0x33>
+    if (c < 0) return c;
+  804388:	48 63 d0             	movslq %eax,%rdx
+  80438b:	78 13                	js     8043a0 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80438d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804392:	83 f8 04             	cmp    $0x4,%eax
+  804395:	74 09                	je     8043a0 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804397:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80439b:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8043a0:	48 89 d0             	mov    %rdx,%rax
+  8043a3:	48 83 c4 08          	add    $0x8,%rsp
+  8043a7:	5b                   	pop    %rbx
+  8043a8:	41 5c                	pop    %r12
+  8043aa:	41 5d                	pop    %r13
+  8043ac:	5d                   	pop    %rbp
+  8043ad:	c3                   	ret
+  8043ae:	48 89 d0             	mov    %rdx,%rax
+  8043b1:	c3                   	ret
+
+00000000008043b2 <cputchar>:
+cputchar(int ch) {
+  8043b2:	55                   	push   %rbp
+  8043b3:	48 89 e5             	mov    %rsp,%rbp
+  8043b6:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8043ba:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8043be:	be 01 00 00 00       	mov    $0x1,%esi
+  8043c3:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8043c7:	48 b8 55 12 80 00 00 	movabs $0x801255,%rax
+  8043ce:	00 00 00 
+  8043d1:	ff d0                	call   *%rax
+}
+  8043d3:	c9                   	leave
+  8043d4:	c3                   	ret
+
+00000000008043d5 <getchar>:
+getchar(void) {
+  8043d5:	55                   	push   %rbp
+  8043d6:	48 89 e5             	mov    %rsp,%rbp
+  8043d9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8043dd:	ba 01 00 00 00       	mov    $0x1,%edx
+  8043e2:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8043e6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043eb:	48 b8 31 1b 80 00 00 	movabs $0x801b31,%rax
+  8043f2:	00 00 00 
+  8043f5:	ff d0                	call   *%rax
+  8043f7:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8043f9:	85 c0                	test   %eax,%eax
+  8043fb:	78 06                	js     804403 <getchar+0x2e>
+  8043fd:	74 08                	je     804407 <getchar+0x32>
+  8043ff:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804403:	89 d0                	mov    %edx,%eax
+  804405:	c9                   	leave
+  804406:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804407:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80440c:	eb f5                	jmp    804403 <getchar+0x2e>
+
+000000000080440e <iscons>:
+iscons(int fdnum) {
+  80440e:	55                   	push   %rbp
+  80440f:	48 89 e5             	mov    %rsp,%rbp
+  804412:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804416:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80441a:	48 b8 4e 18 80 00 00 	movabs $0x80184e,%rax
+  804421:	00 00 00 
+  804424:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804426:	85 c0                	test   %eax,%eax
+  804428:	78 18                	js     804442 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80442a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80442e:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804435:	00 00 00 
+  804438:	8b 00                	mov    (%rax),%eax
+  80443a:	39 02                	cmp    %eax,(%rdx)
+  80443c:	0f 94 c0             	sete   %al
+  80443f:	0f b6 c0             	movzbl %al,%eax
+}
+  804442:	c9                   	leave
+  804443:	c3                   	ret
+
+0000000000804444 <opencons>:
+opencons(void) {
+  804444:	55                   	push   %rbp
+  804445:	48 89 e5             	mov    %rsp,%rbp
+  804448:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80444c:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804450:	48 b8 ee 17 80 00 00 	movabs $0x8017ee,%rax
+  804457:	00 00 00 
+  80445a:	ff d0                	call   *%rax
+  80445c:	85 c0                	test   %eax,%eax
+  80445e:	78 49                	js     8044a9 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804460:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804465:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80446a:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80446e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804473:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  80447a:	00 00 00 
+  80447d:	ff d0                	call   *%rax
+  80447f:	85 c0                	test   %eax,%eax
+  804481:	78 26                	js     8044a9 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804483:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804487:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80448e:	00 00 
+  804490:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804492:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804496:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80449d:	48 b8 c0 17 80 00 00 	movabs $0x8017c0,%rax
+  8044a4:	00 00 00 
+  8044a7:	ff d0                	call   *%rax
+}
+  8044a9:	c9                   	leave
+  8044aa:	c3                   	ret
+
+00000000008044ab <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8044ab:	55                   	push   %rbp
+  8044ac:	48 89 e5             	mov    %rsp,%rbp
+  8044af:	41 56                	push   %r14
+  8044b1:	41 55                	push   %r13
+  8044b3:	41 54                	push   %r12
+  8044b5:	53                   	push   %rbx
+  8044b6:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044b9:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  8044c0:	00 00 00 
+  8044c3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8044c7:	74 27                	je     8044f0 <_handle_vectored_pagefault+0x45>
+  8044c9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8044ce:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  8044d5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044d8:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8044db:	4c 89 e7             	mov    %r12,%rdi
+  8044de:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8044e3:	84 c0                	test   %al,%al
+  8044e5:	75 45                	jne    80452c <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044e7:	48 83 c3 01          	add    $0x1,%rbx
+  8044eb:	49 3b 1e             	cmp    (%r14),%rbx
+  8044ee:	72 eb                	jb     8044db <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8044f0:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8044f7:	00 
+  8044f8:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8044fd:	4d 8b 04 24          	mov    (%r12),%r8
+  804501:	48 ba c0 50 80 00 00 	movabs $0x8050c0,%rdx
+  804508:	00 00 00 
+  80450b:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804510:	48 bf f0 50 80 00 00 	movabs $0x8050f0,%rdi
+  804517:	00 00 00 
+  80451a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80451f:	49 ba b9 03 80 00 00 	movabs $0x8003b9,%r10
+  804526:	00 00 00 
+  804529:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80452c:	5b                   	pop    %rbx
+  80452d:	41 5c                	pop    %r12
+  80452f:	41 5d                	pop    %r13
+  804531:	41 5e                	pop    %r14
+  804533:	5d                   	pop    %rbp
+  804534:	c3                   	ret
+
+0000000000804535 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804535:	55                   	push   %rbp
+  804536:	48 89 e5             	mov    %rsp,%rbp
+  804539:	53                   	push   %rbx
+  80453a:	48 83 ec 08          	sub    $0x8,%rsp
+  80453e:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804541:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804548:	00 00 00 
+  80454b:	80 38 00             	cmpb   $0x0,(%rax)
+  80454e:	0f 84 84 00 00 00    	je     8045d8 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804554:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  80455b:	00 00 00 
+  80455e:	48 8b 10             	mov    (%rax),%rdx
+  804561:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804566:	48 b9 00 10 85 00 00 	movabs $0x851000,%rcx
+  80456d:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804570:	48 85 d2             	test   %rdx,%rdx
+  804573:	74 19                	je     80458e <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804575:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804579:	0f 84 e8 00 00 00    	je     804667 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80457f:	48 83 c0 01          	add    $0x1,%rax
+  804583:	48 39 d0             	cmp    %rdx,%rax
+  804586:	75 ed                	jne    804575 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804588:	48 83 fa 08          	cmp    $0x8,%rdx
+  80458c:	74 1c                	je     8045aa <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80458e:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804592:	48 a3 48 10 85 00 00 	movabs %rax,0x851048
+  804599:	00 00 00 
+  80459c:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  8045a3:	00 00 00 
+  8045a6:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8045aa:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  8045b1:	00 00 00 
+  8045b4:	ff d0                	call   *%rax
+  8045b6:	89 c7                	mov    %eax,%edi
+  8045b8:	48 be 2d 47 80 00 00 	movabs $0x80472d,%rsi
+  8045bf:	00 00 00 
+  8045c2:	48 b8 4b 15 80 00 00 	movabs $0x80154b,%rax
+  8045c9:	00 00 00 
+  8045cc:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8045ce:	85 c0                	test   %eax,%eax
+  8045d0:	78 68                	js     80463a <add_pgfault_handler+0x105>
+    return res;
+}
+  8045d2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8045d6:	c9                   	leave
+  8045d7:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8045d8:	48 b8 00 13 80 00 00 	movabs $0x801300,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+  8045e4:	89 c7                	mov    %eax,%edi
+  8045e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8045eb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045f0:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8045f7:	00 00 00 
+  8045fa:	48 b8 8d 13 80 00 00 	movabs $0x80138d,%rax
+  804601:	00 00 00 
+  804604:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804606:	48 ba 48 10 85 00 00 	movabs $0x851048,%rdx
+  80460d:	00 00 00 
+  804610:	48 8b 02             	mov    (%rdx),%rax
+  804613:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804617:	48 89 0a             	mov    %rcx,(%rdx)
+  80461a:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804621:	00 00 00 
+  804624:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804628:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  80462f:	00 00 00 
+  804632:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804635:	e9 70 ff ff ff       	jmp    8045aa <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80463a:	89 c1                	mov    %eax,%ecx
+  80463c:	48 ba fe 50 80 00 00 	movabs $0x8050fe,%rdx
+  804643:	00 00 00 
+  804646:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80464b:	48 bf f0 50 80 00 00 	movabs $0x8050f0,%rdi
+  804652:	00 00 00 
+  804655:	b8 00 00 00 00       	mov    $0x0,%eax
+  80465a:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  804661:	00 00 00 
+  804664:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804667:	b8 00 00 00 00       	mov    $0x0,%eax
+  80466c:	e9 61 ff ff ff       	jmp    8045d2 <add_pgfault_handler+0x9d>
+
+0000000000804671 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804671:	55                   	push   %rbp
+  804672:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804675:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  80467c:	00 00 00 
+  80467f:	80 38 00             	cmpb   $0x0,(%rax)
+  804682:	74 33                	je     8046b7 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804684:	48 a1 48 10 85 00 00 	movabs 0x851048,%rax
+  80468b:	00 00 00 
+  80468e:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804693:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  80469a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80469d:	48 85 c0             	test   %rax,%rax
+  8046a0:	0f 84 85 00 00 00    	je     80472b <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8046a6:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8046aa:	74 40                	je     8046ec <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8046ac:	48 83 c1 01          	add    $0x1,%rcx
+  8046b0:	48 39 c1             	cmp    %rax,%rcx
+  8046b3:	75 f1                	jne    8046a6 <remove_pgfault_handler+0x35>
+  8046b5:	eb 74                	jmp    80472b <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8046b7:	48 b9 16 51 80 00 00 	movabs $0x805116,%rcx
+  8046be:	00 00 00 
+  8046c1:	48 ba 67 50 80 00 00 	movabs $0x805067,%rdx
+  8046c8:	00 00 00 
+  8046cb:	be 43 00 00 00       	mov    $0x43,%esi
+  8046d0:	48 bf f0 50 80 00 00 	movabs $0x8050f0,%rdi
+  8046d7:	00 00 00 
+  8046da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046df:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  8046e6:	00 00 00 
+  8046e9:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8046ec:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8046f3:	00 
+  8046f4:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046f8:	48 29 ca             	sub    %rcx,%rdx
+  8046fb:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804702:	00 00 00 
+  804705:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804709:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80470e:	48 89 ce             	mov    %rcx,%rsi
+  804711:	48 b8 28 10 80 00 00 	movabs $0x801028,%rax
+  804718:	00 00 00 
+  80471b:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80471d:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804724:	00 00 00 
+  804727:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80472b:	5d                   	pop    %rbp
+  80472c:	c3                   	ret
+
+000000000080472d <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80472d:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804730:	48 b8 ab 44 80 00 00 	movabs $0x8044ab,%rax
+  804737:	00 00 00 
+    call *%rax
+  80473a:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80473c:	41 5f                	pop    %r15
+	popq %r15
+  80473e:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804740:	41 5f                	pop    %r15
+	popq %r14
+  804742:	41 5e                	pop    %r14
+	popq %r13
+  804744:	41 5d                	pop    %r13
+	popq %r12
+  804746:	41 5c                	pop    %r12
+	popq %r11
+  804748:	41 5b                	pop    %r11
+	popq %r10
+  80474a:	41 5a                	pop    %r10
+	popq %r9
+  80474c:	41 59                	pop    %r9
+	popq %r8
+  80474e:	41 58                	pop    %r8
+	popq %rsi
+  804750:	5e                   	pop    %rsi
+	popq %rdi
+  804751:	5f                   	pop    %rdi
+	popq %rbp
+  804752:	5d                   	pop    %rbp
+	popq %rdx
+  804753:	5a                   	pop    %rdx
+	popq %rcx
+  804754:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804755:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80475a:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80475f:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804763:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804766:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80476b:	5b                   	pop    %rbx
+	popq %rax
+  80476c:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80476d:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804771:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804772:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804777:	c3                   	ret
+
+0000000000804778 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804778:	55                   	push   %rbp
+  804779:	48 89 e5             	mov    %rsp,%rbp
+  80477c:	41 55                	push   %r13
+  80477e:	41 54                	push   %r12
+  804780:	53                   	push   %rbx
+  804781:	48 83 ec 08          	sub    $0x8,%rsp
+  804785:	49 89 fd             	mov    %rdi,%r13
+  804788:	48 89 f7             	mov    %rsi,%rdi
+  80478b:	48 89 d3             	mov    %rdx,%rbx
+  80478e:	49 89 cc             	mov    %rcx,%r12
+  804791:	4c 89 c2             	mov    %r8,%rdx
+  804794:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804797:	48 85 f6             	test   %rsi,%rsi
+  80479a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8047a1:	00 00 00 
+  8047a4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8047a8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8047ad:	48 85 db             	test   %rbx,%rbx
+  8047b0:	74 03                	je     8047b5 <ipc_recv_futex+0x3d>
+  8047b2:	48 8b 33             	mov    (%rbx),%rsi
+  8047b5:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8047b9:	48 b8 d7 15 80 00 00 	movabs $0x8015d7,%rax
+  8047c0:	00 00 00 
+  8047c3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8047c5:	85 c0                	test   %eax,%eax
+  8047c7:	78 75                	js     80483e <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8047c9:	4d 85 ed             	test   %r13,%r13
+  8047cc:	74 14                	je     8047e2 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8047ce:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8047d5:	00 00 00 
+  8047d8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8047de:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8047e2:	4d 85 e4             	test   %r12,%r12
+  8047e5:	74 14                	je     8047fb <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8047e7:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8047ee:	00 00 00 
+  8047f1:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8047f7:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8047fb:	48 85 db             	test   %rbx,%rbx
+  8047fe:	74 23                	je     804823 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804800:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804807:	00 00 00 
+  80480a:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804810:	ba 00 00 00 00       	mov    $0x0,%edx
+  804815:	85 c9                	test   %ecx,%ecx
+  804817:	74 07                	je     804820 <ipc_recv_futex+0xa8>
+  804819:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804820:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804823:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80482a:	00 00 00 
+  80482d:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804833:	48 83 c4 08          	add    $0x8,%rsp
+  804837:	5b                   	pop    %rbx
+  804838:	41 5c                	pop    %r12
+  80483a:	41 5d                	pop    %r13
+  80483c:	5d                   	pop    %rbp
+  80483d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80483e:	4d 85 ed             	test   %r13,%r13
+  804841:	74 08                	je     80484b <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804843:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80484a:	00 
+        if (perm_store != NULL) {
+  80484b:	4d 85 e4             	test   %r12,%r12
+  80484e:	74 08                	je     804858 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804850:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804857:	00 
+        if (size != NULL) {
+  804858:	48 85 db             	test   %rbx,%rbx
+  80485b:	74 d6                	je     804833 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80485d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804864:	eb cd                	jmp    804833 <ipc_recv_futex+0xbb>
+
+0000000000804866 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804866:	55                   	push   %rbp
+  804867:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80486a:	48 83 ec 08          	sub    $0x8,%rsp
+  80486e:	6a 00                	push   $0x0
+  804870:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804876:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80487c:	48 b8 78 47 80 00 00 	movabs $0x804778,%rax
+  804883:	00 00 00 
+  804886:	ff d0                	call   *%rax
+}
+  804888:	c9                   	leave
+  804889:	c3                   	ret
+
+000000000080488a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80488a:	55                   	push   %rbp
+  80488b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80488e:	48 85 d2             	test   %rdx,%rdx
+  804891:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804898:	00 00 00 
+  80489b:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80489f:	89 f6                	mov    %esi,%esi
+  8048a1:	48 b8 c0 15 80 00 00 	movabs $0x8015c0,%rax
+  8048a8:	00 00 00 
+  8048ab:	ff d0                	call   *%rax
+    if (res < 0) {
+  8048ad:	85 c0                	test   %eax,%eax
+  8048af:	78 02                	js     8048b3 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8048b1:	5d                   	pop    %rbp
+  8048b2:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8048b3:	89 c1                	mov    %eax,%ecx
+  8048b5:	48 ba 30 51 80 00 00 	movabs $0x805130,%rdx
+  8048bc:	00 00 00 
+  8048bf:	be 50 00 00 00       	mov    $0x50,%esi
+  8048c4:	48 bf 44 51 80 00 00 	movabs $0x805144,%rdi
+  8048cb:	00 00 00 
+  8048ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048d3:	49 b8 b9 03 80 00 00 	movabs $0x8003b9,%r8
+  8048da:	00 00 00 
+  8048dd:	41 ff d0             	call   *%r8
+
+00000000008048e0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8048e0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8048e5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8048ec:	00 00 00 
+  8048ef:	48 89 d0             	mov    %rdx,%rax
+  8048f2:	48 c1 e0 04          	shl    $0x4,%rax
+  8048f6:	48 29 d0             	sub    %rdx,%rax
+  8048f9:	48 c1 e0 05          	shl    $0x5,%rax
+  8048fd:	48 01 c8             	add    %rcx,%rax
+  804900:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804906:	39 f8                	cmp    %edi,%eax
+  804908:	74 13                	je     80491d <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80490a:	48 83 c2 01          	add    $0x1,%rdx
+  80490e:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804915:	75 d8                	jne    8048ef <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804917:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80491c:	c3                   	ret
+            return envs[i].env_id;
+  80491d:	48 89 d0             	mov    %rdx,%rax
+  804920:	48 c1 e0 04          	shl    $0x4,%rax
+  804924:	48 29 d0             	sub    %rdx,%rax
+  804927:	48 c1 e0 05          	shl    $0x5,%rax
+  80492b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804932:	00 00 00 
+  804935:	48 01 d0             	add    %rdx,%rax
+  804938:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80493e:	c3                   	ret
+  80493f:	90                   	nop
+
+0000000000804940 <__rodata_start>:
+  804940:	72 65                	jb     8049a7 <__rodata_start+0x67>
+  804942:	61                   	(bad)
+  804943:	64 3a 20             	cmp    %fs:(%rax),%ah
+  804946:	25 69 00 75 73       	and    $0x73750069,%eax
+  80494b:	65 72 2f             	gs jb  80497d <__rodata_start+0x3d>
+  80494e:	66 73 62             	data16 jae 8049b3 <__rodata_start+0x73>
+  804951:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804953:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  804956:	63 00                	movsxd (%rax),%eax
+  804958:	2f                   	(bad)
+  804959:	66 73 62             	data16 jae 8049be <__rodata_start+0x7e>
+  80495c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80495e:	63 68 00             	movsxd 0x0(%rax),%ebp
+  804961:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804962:	70 65                	jo     8049c9 <__rodata_start+0x89>
+  804964:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804965:	20 2f                	and    %ch,(%rdi)
+  804967:	66 73 62             	data16 jae 8049cc <__rodata_start+0x8c>
+  80496a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80496c:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  80496f:	20 25 69 00 77 72    	and    %ah,0x72770069(%rip)        # 72f749de <__bss_end+0x727229de>
+  804975:	69 74 65 20 2f 66 73 	imul   $0x6273662f,0x20(%rbp,%riz,2),%esi
+  80497c:	62 
+  80497d:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80497f:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804982:	20 25 69 00 69 70    	and    %ah,0x70690069(%rip)        # 70e949f1 <__bss_end+0x706429f1>
+  804988:	63 00                	movsxd (%rax),%eax
+  80498a:	66 73 5f             	data16 jae 8049ec <__rodata_start+0xac>
+  80498d:	63 68 61             	movsxd 0x61(%rax),%ebp
+  804990:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804991:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804992:	65 6c                	gs insb (%dx),%es:(%rdi)
+  804994:	3a 20                	cmp    (%rax),%ah
+  804996:	25 69 00 63 68       	and    $0x68630069,%eax
+  80499b:	61                   	(bad)
+  80499c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499e:	65 6c                	gs insb (%dx),%es:(%rdi)
+  8049a0:	00 0f                	add    %cl,(%rdi)
+  8049a2:	1f                   	(bad)
+  8049a3:	80 00 00             	addb   $0x0,(%rax)
+  8049a6:	00 00                	add    %al,(%rax)
+  8049a8:	66 73 62             	data16 jae 804a0d <__rodata_start+0xcd>
+  8049ab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049ad:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  8049b0:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a08429 <__bss_end+0x251b6429>
+  8049b6:	75 2d                	jne    8049e5 <__rodata_start+0xa5>
+  8049b8:	62                   	(bad)
+  8049b9:	79 74                	jns    804a2f <__rodata_start+0xef>
+  8049bb:	65 20 72 65          	and    %dh,%gs:0x65(%rdx)
+  8049bf:	61                   	(bad)
+  8049c0:	64 73 3a             	fs jae 8049fd <__rodata_start+0xbd>
+  8049c3:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0bf35 <__bss_end+0x631b9f35>
+  8049c9:	79 63                	jns    804a2e <__rodata_start+0xee>
+  8049cb:	6c                   	insb   (%dx),%es:(%rdi)
+  8049cc:	65 73 20             	gs jae 8049ef <__rodata_start+0xaf>
+  8049cf:	70 65                	jo     804a36 <__rodata_start+0xf6>
+  8049d1:	72 20                	jb     8049f3 <__rodata_start+0xb3>
+  8049d3:	72 65                	jb     804a3a <__rodata_start+0xfa>
+  8049d5:	61                   	(bad)
+  8049d6:	64 2c 20             	fs sub $0x20,%al
+  8049d9:	25 6c 75 20 62       	and    $0x6220756c,%eax
+  8049de:	79 74                	jns    804a54 <__rodata_start+0x114>
+  8049e0:	65 73 20             	gs jae 804a03 <__rodata_start+0xc3>
+  8049e3:	70 65                	jo     804a4a <__rodata_start+0x10a>
+  8049e5:	72 20                	jb     804a07 <__rodata_start+0xc7>
+  8049e7:	4b 63 79 63          	rex.WXB movslq 0x63(%r9),%rdi
+  8049eb:	6c                   	insb   (%dx),%es:(%rdi)
+  8049ec:	65 0a 00             	or     %gs:(%rax),%al
+  8049ef:	3c 75                	cmp    $0x75,%al
+  8049f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049f2:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8049f6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049f7:	3e 00 0f             	ds add %cl,(%rdi)
+  8049fa:	1f                   	(bad)
+  8049fb:	80 00 00             	addb   $0x0,(%rax)
+  8049fe:	00 00                	add    %al,(%rax)
+  804a00:	5b                   	pop    %rbx
+  804a01:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804a06:	20 75 73             	and    %dh,0x73(%rbp)
+  804a09:	65 72 20             	gs jb  804a2c <__rodata_start+0xec>
+  804a0c:	70 61                	jo     804a6f <__rodata_start+0x12f>
+  804a0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a0f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804a16:	73 20                	jae    804a38 <__rodata_start+0xf8>
+  804a18:	61                   	(bad)
+  804a19:	74 20                	je     804a3b <__rodata_start+0xfb>
+  804a1b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804a20:	3a 20                	cmp    (%rax),%ah
+  804a22:	00 30                	add    %dh,(%rax)
+  804a24:	31 32                	xor    %esi,(%rdx)
+  804a26:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a2d:	41                   	rex.B
+  804a2e:	42                   	rex.X
+  804a2f:	43                   	rex.XB
+  804a30:	44                   	rex.R
+  804a31:	45                   	rex.RB
+  804a32:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a35:	31 32                	xor    %esi,(%rdx)
+  804a37:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a3e:	61                   	(bad)
+  804a3f:	62 63 64 65 66       	(bad)
+  804a44:	00 28                	add    %ch,(%rax)
+  804a46:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a47:	75 6c                	jne    804ab5 <__rodata_start+0x175>
+  804a49:	6c                   	insb   (%dx),%es:(%rdi)
+  804a4a:	29 00                	sub    %eax,(%rax)
+  804a4c:	65 72 72             	gs jb  804ac1 <__rodata_start+0x181>
+  804a4f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a50:	72 20                	jb     804a72 <__rodata_start+0x132>
+  804a52:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804a57:	73 70                	jae    804ac9 <__rodata_start+0x189>
+  804a59:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804a5d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804a64:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a65:	72 00                	jb     804a67 <__rodata_start+0x127>
+  804a67:	62 61 64 20 65       	(bad)
+  804a6c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a6d:	76 69                	jbe    804ad8 <__rodata_start+0x198>
+  804a6f:	72 6f                	jb     804ae0 <__rodata_start+0x1a0>
+  804a71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a72:	6d                   	insl   (%dx),%es:(%rdi)
+  804a73:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a75:	74 00                	je     804a77 <__rodata_start+0x137>
+  804a77:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a7e:	20 70 61             	and    %dh,0x61(%rax)
+  804a81:	72 61                	jb     804ae4 <__rodata_start+0x1a4>
+  804a83:	6d                   	insl   (%dx),%es:(%rdi)
+  804a84:	65 74 65             	gs je  804aec <__rodata_start+0x1ac>
+  804a87:	72 00                	jb     804a89 <__rodata_start+0x149>
+  804a89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8a:	75 74                	jne    804b00 <__rodata_start+0x1c0>
+  804a8c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804a8f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804a92:	6d                   	insl   (%dx),%es:(%rdi)
+  804a93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a94:	72 79                	jb     804b0f <__rodata_start+0x1cf>
+  804a96:	00 6f 75             	add    %ch,0x75(%rdi)
+  804a99:	74 20                	je     804abb <__rodata_start+0x17b>
+  804a9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a9c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804aa0:	76 69                	jbe    804b0b <__rodata_start+0x1cb>
+  804aa2:	72 6f                	jb     804b13 <__rodata_start+0x1d3>
+  804aa4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aa5:	6d                   	insl   (%dx),%es:(%rdi)
+  804aa6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804aa8:	74 73                	je     804b1d <__rodata_start+0x1dd>
+  804aaa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804aad:	72 72                	jb     804b21 <__rodata_start+0x1e1>
+  804aaf:	75 70                	jne    804b21 <__rodata_start+0x1e1>
+  804ab1:	74 65                	je     804b18 <__rodata_start+0x1d8>
+  804ab3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804ab8:	75 67                	jne    804b21 <__rodata_start+0x1e1>
+  804aba:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804abd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804abf:	00 73 65             	add    %dh,0x65(%rbx)
+  804ac2:	67 6d                	insl   (%dx),%es:(%edi)
+  804ac4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ac6:	74 61                	je     804b29 <__rodata_start+0x1e9>
+  804ac8:	74 69                	je     804b33 <__rodata_start+0x1f3>
+  804aca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804acb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804acc:	20 66 61             	and    %ah,0x61(%rsi)
+  804acf:	75 6c                	jne    804b3d <__rodata_start+0x1fd>
+  804ad1:	74 00                	je     804ad3 <__rodata_start+0x193>
+  804ad3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ada:	20 45 4c             	and    %al,0x4c(%rbp)
+  804add:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804ae1:	61                   	(bad)
+  804ae2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804ae7:	20 73 75             	and    %dh,0x75(%rbx)
+  804aea:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804aed:	73 79                	jae    804b68 <__rodata_start+0x228>
+  804aef:	73 74                	jae    804b65 <__rodata_start+0x225>
+  804af1:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804af3:	20 63 61             	and    %ah,0x61(%rbx)
+  804af6:	6c                   	insb   (%dx),%es:(%rdi)
+  804af7:	6c                   	insb   (%dx),%es:(%rdi)
+  804af8:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804afb:	74 72                	je     804b6f <__rodata_start+0x22f>
+  804afd:	79 20                	jns    804b1f <__rodata_start+0x1df>
+  804aff:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b00:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b01:	74 20                	je     804b23 <__rodata_start+0x1e3>
+  804b03:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b05:	75 6e                	jne    804b75 <__rodata_start+0x235>
+  804b07:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804b0b:	76 20                	jbe    804b2d <__rodata_start+0x1ed>
+  804b0d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b14:	72 65                	jb     804b7b <__rodata_start+0x23b>
+  804b16:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b1a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b1e:	65 78 70             	gs js  804b91 <__rodata_start+0x251>
+  804b21:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b26:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b29:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b2d:	20 66 69             	and    %ah,0x69(%rsi)
+  804b30:	6c                   	insb   (%dx),%es:(%rdi)
+  804b31:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b35:	20 66 72             	and    %ah,0x72(%rsi)
+  804b38:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b3d:	61                   	(bad)
+  804b3e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b43:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b47:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b4a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b4b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b4c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b50:	79 20                	jns    804b72 <__rodata_start+0x232>
+  804b52:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804b59:	72 65                	jb     804bc0 <__rodata_start+0x280>
+  804b5b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804b5e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b60:	00 66 69             	add    %ah,0x69(%rsi)
+  804b63:	6c                   	insb   (%dx),%es:(%rdi)
+  804b64:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804b68:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804b6b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b6c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804b6f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b70:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b71:	74 20                	je     804b93 <__rodata_start+0x253>
+  804b73:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b75:	75 6e                	jne    804be5 <__rodata_start+0x2a5>
+  804b77:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804b7b:	76 61                	jbe    804bde <__rodata_start+0x29e>
+  804b7d:	6c                   	insb   (%dx),%es:(%rdi)
+  804b7e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804b85:	00 
+  804b86:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804b8d:	72 65                	jb     804bf4 <__rodata_start+0x2b4>
+  804b8f:	61                   	(bad)
+  804b90:	64 79 20             	fs jns 804bb3 <__rodata_start+0x273>
+  804b93:	65 78 69             	gs js  804bff <__rodata_start+0x2bf>
+  804b96:	73 74                	jae    804c0c <__rodata_start+0x2cc>
+  804b98:	73 00                	jae    804b9a <__rodata_start+0x25a>
+  804b9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9b:	70 65                	jo     804c02 <__rodata_start+0x2c2>
+  804b9d:	72 61                	jb     804c00 <__rodata_start+0x2c0>
+  804b9f:	74 69                	je     804c0a <__rodata_start+0x2ca>
+  804ba1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ba3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804ba6:	74 20                	je     804bc8 <__rodata_start+0x288>
+  804ba8:	73 75                	jae    804c1f <__rodata_start+0x2df>
+  804baa:	70 70                	jo     804c1c <__rodata_start+0x2dc>
+  804bac:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bad:	72 74                	jb     804c23 <__rodata_start+0x2e3>
+  804baf:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804bb5:	20 61 67             	and    %ah,0x67(%rcx)
+  804bb8:	61                   	(bad)
+  804bb9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804bc0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804bc4:	74 00                	je     804bc6 <__rodata_start+0x286>
+  804bc6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804bcd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804bd0:	20 75 73             	and    %dh,0x73(%rbp)
+  804bd3:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804bd7:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804bde:	00 
+  804bdf:	90                   	nop
+  804be0:	f6 06 80             	testb  $0x80,(%rsi)
+  804be3:	00 00                	add    %al,(%rax)
+  804be5:	00 00                	add    %al,(%rax)
+  804be7:	00 37                	add    %dh,(%rdi)
+  804be9:	0d 80 00 00 00       	or     $0x80,%eax
+  804bee:	00 00                	add    %al,(%rax)
+  804bf0:	27                   	(bad)
+  804bf1:	0d 80 00 00 00       	or     $0x80,%eax
+  804bf6:	00 00                	add    %al,(%rax)
+  804bf8:	37                   	(bad)
+  804bf9:	0d 80 00 00 00       	or     $0x80,%eax
+  804bfe:	00 00                	add    %al,(%rax)
+  804c00:	37                   	(bad)
+  804c01:	0d 80 00 00 00       	or     $0x80,%eax
+  804c06:	00 00                	add    %al,(%rax)
+  804c08:	37                   	(bad)
+  804c09:	0d 80 00 00 00       	or     $0x80,%eax
+  804c0e:	00 00                	add    %al,(%rax)
+  804c10:	37                   	(bad)
+  804c11:	0d 80 00 00 00       	or     $0x80,%eax
+  804c16:	00 00                	add    %al,(%rax)
+  804c18:	15 07 80 00 00       	adc    $0x8007,%eax
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 37                	add    %dh,(%rdi)
+  804c21:	0d 80 00 00 00       	or     $0x80,%eax
+  804c26:	00 00                	add    %al,(%rax)
+  804c28:	37                   	(bad)
+  804c29:	0d 80 00 00 00       	or     $0x80,%eax
+  804c2e:	00 00                	add    %al,(%rax)
+  804c30:	09 07                	or     %eax,(%rdi)
+  804c32:	80 00 00             	addb   $0x0,(%rax)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 83 07 80 00 00    	add    %al,0x8007(%rbx)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 37                	add    %dh,(%rdi)
+  804c41:	0d 80 00 00 00       	or     $0x80,%eax
+  804c46:	00 00                	add    %al,(%rax)
+  804c48:	09 07                	or     %eax,(%rdi)
+  804c4a:	80 00 00             	addb   $0x0,(%rax)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c52:	80 00 00             	addb   $0x0,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c72:	80 00 00             	addb   $0x0,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c7a:	80 00 00             	addb   $0x0,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c8a:	80 00 00             	addb   $0x0,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 4f 07             	add    %cl,0x7(%rdi)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 37                	add    %dh,(%rdi)
+  804c99:	0d 80 00 00 00       	or     $0x80,%eax
+  804c9e:	00 00                	add    %al,(%rax)
+  804ca0:	37                   	(bad)
+  804ca1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ca6:	00 00                	add    %al,(%rax)
+  804ca8:	37                   	(bad)
+  804ca9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cae:	00 00                	add    %al,(%rax)
+  804cb0:	37                   	(bad)
+  804cb1:	0d 80 00 00 00       	or     $0x80,%eax
+  804cb6:	00 00                	add    %al,(%rax)
+  804cb8:	37                   	(bad)
+  804cb9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cbe:	00 00                	add    %al,(%rax)
+  804cc0:	37                   	(bad)
+  804cc1:	0d 80 00 00 00       	or     $0x80,%eax
+  804cc6:	00 00                	add    %al,(%rax)
+  804cc8:	37                   	(bad)
+  804cc9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cce:	00 00                	add    %al,(%rax)
+  804cd0:	37                   	(bad)
+  804cd1:	0d 80 00 00 00       	or     $0x80,%eax
+  804cd6:	00 00                	add    %al,(%rax)
+  804cd8:	37                   	(bad)
+  804cd9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cde:	00 00                	add    %al,(%rax)
+  804ce0:	37                   	(bad)
+  804ce1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ce6:	00 00                	add    %al,(%rax)
+  804ce8:	37                   	(bad)
+  804ce9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cee:	00 00                	add    %al,(%rax)
+  804cf0:	37                   	(bad)
+  804cf1:	0d 80 00 00 00       	or     $0x80,%eax
+  804cf6:	00 00                	add    %al,(%rax)
+  804cf8:	37                   	(bad)
+  804cf9:	0d 80 00 00 00       	or     $0x80,%eax
+  804cfe:	00 00                	add    %al,(%rax)
+  804d00:	37                   	(bad)
+  804d01:	0d 80 00 00 00       	or     $0x80,%eax
+  804d06:	00 00                	add    %al,(%rax)
+  804d08:	37                   	(bad)
+  804d09:	0d 80 00 00 00       	or     $0x80,%eax
+  804d0e:	00 00                	add    %al,(%rax)
+  804d10:	37                   	(bad)
+  804d11:	0d 80 00 00 00       	or     $0x80,%eax
+  804d16:	00 00                	add    %al,(%rax)
+  804d18:	37                   	(bad)
+  804d19:	0d 80 00 00 00       	or     $0x80,%eax
+  804d1e:	00 00                	add    %al,(%rax)
+  804d20:	37                   	(bad)
+  804d21:	0d 80 00 00 00       	or     $0x80,%eax
+  804d26:	00 00                	add    %al,(%rax)
+  804d28:	37                   	(bad)
+  804d29:	0d 80 00 00 00       	or     $0x80,%eax
+  804d2e:	00 00                	add    %al,(%rax)
+  804d30:	37                   	(bad)
+  804d31:	0d 80 00 00 00       	or     $0x80,%eax
+  804d36:	00 00                	add    %al,(%rax)
+  804d38:	37                   	(bad)
+  804d39:	0d 80 00 00 00       	or     $0x80,%eax
+  804d3e:	00 00                	add    %al,(%rax)
+  804d40:	37                   	(bad)
+  804d41:	0d 80 00 00 00       	or     $0x80,%eax
+  804d46:	00 00                	add    %al,(%rax)
+  804d48:	37                   	(bad)
+  804d49:	0d 80 00 00 00       	or     $0x80,%eax
+  804d4e:	00 00                	add    %al,(%rax)
+  804d50:	37                   	(bad)
+  804d51:	0d 80 00 00 00       	or     $0x80,%eax
+  804d56:	00 00                	add    %al,(%rax)
+  804d58:	37                   	(bad)
+  804d59:	0d 80 00 00 00       	or     $0x80,%eax
+  804d5e:	00 00                	add    %al,(%rax)
+  804d60:	37                   	(bad)
+  804d61:	0d 80 00 00 00       	or     $0x80,%eax
+  804d66:	00 00                	add    %al,(%rax)
+  804d68:	37                   	(bad)
+  804d69:	0d 80 00 00 00       	or     $0x80,%eax
+  804d6e:	00 00                	add    %al,(%rax)
+  804d70:	37                   	(bad)
+  804d71:	0d 80 00 00 00       	or     $0x80,%eax
+  804d76:	00 00                	add    %al,(%rax)
+  804d78:	37                   	(bad)
+  804d79:	0d 80 00 00 00       	or     $0x80,%eax
+  804d7e:	00 00                	add    %al,(%rax)
+  804d80:	37                   	(bad)
+  804d81:	0d 80 00 00 00       	or     $0x80,%eax
+  804d86:	00 00                	add    %al,(%rax)
+  804d88:	5a                   	pop    %rdx
+  804d89:	0c 80                	or     $0x80,%al
+  804d8b:	00 00                	add    %al,(%rax)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 37                	add    %dh,(%rdi)
+  804d91:	0d 80 00 00 00       	or     $0x80,%eax
+  804d96:	00 00                	add    %al,(%rax)
+  804d98:	37                   	(bad)
+  804d99:	0d 80 00 00 00       	or     $0x80,%eax
+  804d9e:	00 00                	add    %al,(%rax)
+  804da0:	37                   	(bad)
+  804da1:	0d 80 00 00 00       	or     $0x80,%eax
+  804da6:	00 00                	add    %al,(%rax)
+  804da8:	37                   	(bad)
+  804da9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dae:	00 00                	add    %al,(%rax)
+  804db0:	37                   	(bad)
+  804db1:	0d 80 00 00 00       	or     $0x80,%eax
+  804db6:	00 00                	add    %al,(%rax)
+  804db8:	37                   	(bad)
+  804db9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dbe:	00 00                	add    %al,(%rax)
+  804dc0:	37                   	(bad)
+  804dc1:	0d 80 00 00 00       	or     $0x80,%eax
+  804dc6:	00 00                	add    %al,(%rax)
+  804dc8:	37                   	(bad)
+  804dc9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dce:	00 00                	add    %al,(%rax)
+  804dd0:	37                   	(bad)
+  804dd1:	0d 80 00 00 00       	or     $0x80,%eax
+  804dd6:	00 00                	add    %al,(%rax)
+  804dd8:	37                   	(bad)
+  804dd9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dde:	00 00                	add    %al,(%rax)
+  804de0:	a6                   	cmpsb  %es:(%rdi),%ds:(%rsi)
+  804de1:	07                   	(bad)
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 75 09             	add    %dh,0x9(%rbp)
+  804dea:	80 00 00             	addb   $0x0,(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 37                	add    %dh,(%rdi)
+  804df1:	0d 80 00 00 00       	or     $0x80,%eax
+  804df6:	00 00                	add    %al,(%rax)
+  804df8:	37                   	(bad)
+  804df9:	0d 80 00 00 00       	or     $0x80,%eax
+  804dfe:	00 00                	add    %al,(%rax)
+  804e00:	37                   	(bad)
+  804e01:	0d 80 00 00 00       	or     $0x80,%eax
+  804e06:	00 00                	add    %al,(%rax)
+  804e08:	37                   	(bad)
+  804e09:	0d 80 00 00 00       	or     $0x80,%eax
+  804e0e:	00 00                	add    %al,(%rax)
+  804e10:	d5                   	(bad)
+  804e11:	07                   	(bad)
+  804e12:	80 00 00             	addb   $0x0,(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 37                	add    %dh,(%rdi)
+  804e19:	0d 80 00 00 00       	or     $0x80,%eax
+  804e1e:	00 00                	add    %al,(%rax)
+  804e20:	37                   	(bad)
+  804e21:	0d 80 00 00 00       	or     $0x80,%eax
+  804e26:	00 00                	add    %al,(%rax)
+  804e28:	9b                   	fwait
+  804e29:	07                   	(bad)
+  804e2a:	80 00 00             	addb   $0x0,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 37                	add    %dh,(%rdi)
+  804e31:	0d 80 00 00 00       	or     $0x80,%eax
+  804e36:	00 00                	add    %al,(%rax)
+  804e38:	37                   	(bad)
+  804e39:	0d 80 00 00 00       	or     $0x80,%eax
+  804e3e:	00 00                	add    %al,(%rax)
+  804e40:	1d 0b 80 00 00       	sbb    $0x800b,%eax
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 e7                	add    %ah,%bh
+  804e49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e4f:	00 37                	add    %dh,(%rdi)
+  804e51:	0d 80 00 00 00       	or     $0x80,%eax
+  804e56:	00 00                	add    %al,(%rax)
+  804e58:	37                   	(bad)
+  804e59:	0d 80 00 00 00       	or     $0x80,%eax
+  804e5e:	00 00                	add    %al,(%rax)
+  804e60:	6c                   	insb   (%dx),%es:(%rdi)
+  804e61:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804e67:	00 37                	add    %dh,(%rdi)
+  804e69:	0d 80 00 00 00       	or     $0x80,%eax
+  804e6e:	00 00                	add    %al,(%rax)
+  804e70:	49 0a 80 00 00 00 00 	rex.WB or 0x0(%r8),%al
+  804e77:	00 37                	add    %dh,(%rdi)
+  804e79:	0d 80 00 00 00       	or     $0x80,%eax
+  804e7e:	00 00                	add    %al,(%rax)
+  804e80:	37                   	(bad)
+  804e81:	0d 80 00 00 00       	or     $0x80,%eax
+  804e86:	00 00                	add    %al,(%rax)
+  804e88:	5a                   	pop    %rdx
+  804e89:	0c 80                	or     $0x80,%al
+  804e8b:	00 00                	add    %al,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 37                	add    %dh,(%rdi)
+  804e91:	0d 80 00 00 00       	or     $0x80,%eax
+  804e96:	00 00                	add    %al,(%rax)
+  804e98:	ff 06                	incl   (%rsi)
+  804e9a:	80 00 00             	addb   $0x0,(%rax)
+  804e9d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804ea0 <error_string>:
+	...
+  804ea8:	55 4a 80 00 00 00 00 00 67 4a 80 00 00 00 00 00     UJ......gJ......
+  804eb8:	77 4a 80 00 00 00 00 00 89 4a 80 00 00 00 00 00     wJ.......J......
+  804ec8:	97 4a 80 00 00 00 00 00 ab 4a 80 00 00 00 00 00     .J.......J......
+  804ed8:	c0 4a 80 00 00 00 00 00 d3 4a 80 00 00 00 00 00     .J.......J......
+  804ee8:	e5 4a 80 00 00 00 00 00 f9 4a 80 00 00 00 00 00     .J.......J......
+  804ef8:	09 4b 80 00 00 00 00 00 1c 4b 80 00 00 00 00 00     .K.......K......
+  804f08:	33 4b 80 00 00 00 00 00 49 4b 80 00 00 00 00 00     3K......IK......
+  804f18:	61 4b 80 00 00 00 00 00 79 4b 80 00 00 00 00 00     aK......yK......
+  804f28:	86 4b 80 00 00 00 00 00 58 4f 80 00 00 00 00 00     .K......XO......
+  804f38:	9a 4b 80 00 00 00 00 00 b2 4b 80 00 00 00 00 00     .K.......K......
+  804f48:	bc 4b 80 00 00 00 00 00 c6 4b 80 00 00 00 00 00     .K.......K......
+  804f58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804f68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804f78:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804f88:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804f98:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804fa8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804fb8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804fc8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804fd8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804fe8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804ff8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805008:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805018:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805028:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805038:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805040 <devtab>:
+  805040:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805050:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805060:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805070:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805080:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805090:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8050a0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8050b0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8050c0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8050d0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  8050e0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  8050f0:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805100:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805110:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805120:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805130:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805140:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805150:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,9002 @@
+
+obj/user/fsconcbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e2 03 00 00       	call   800405 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+}
+
+/* Read the hot file until n reads are done or, if child is
+ * not 0, until it exits, whichever comes later */
+static void
+bench(const char *name, int fd, envid_t child) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	41 89 f6             	mov    %esi,%r14d
+  800039:	89 d0                	mov    %edx,%eax
+  80003b:	89 55 c8             	mov    %edx,-0x38(%rbp)
+    uint64_t total = 0, worst = 0, nreads = 0;
+    const volatile struct Env *env = &envs[ENVX(child)];
+  80003e:	25 ff 03 00 00       	and    $0x3ff,%eax
+  800043:	89 45 cc             	mov    %eax,-0x34(%rbp)
+    uint64_t total = 0, worst = 0, nreads = 0;
+  800046:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80004c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800052:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+
+    while (nreads < NREADS || (child && env->env_id == child && env->env_status != ENV_FREE)) {
+        seek(fd, 0);
+        uint64_t start = read_tsc();
+        int res = read(fd, buf, HOT_SIZE);
+  800058:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80005c:	eb 1b                	jmp    800079 <bench+0x54>
+        uint64_t cycles = read_tsc() - start;
+        if (res != HOT_SIZE) panic("read /fsconcbench: %i", res);
+
+        total += cycles;
+  80005e:	49 01 d7             	add    %rdx,%r15
+        worst = MAX(worst, cycles);
+  800061:	49 39 d5             	cmp    %rdx,%r13
+  800064:	4c 0f 42 ea          	cmovb  %rdx,%r13
+        nreads++;
+  800068:	49 83 c4 01          	add    $0x1,%r12
+    while (nreads < NREADS || (child && env->env_id == child && env->env_status != ENV_FREE)) {
+  80006c:	49 81 fc ff 00 00 00 	cmp    $0xff,%r12
+  800073:	0f 87 84 00 00 00    	ja     8000fd <bench+0xd8>
+        seek(fd, 0);
+  800079:	be 00 00 00 00       	mov    $0x0,%esi
+  80007e:	44 89 f7             	mov    %r14d,%edi
+  800081:	48 b8 5b 1f 80 00 00 	movabs $0x801f5b,%rax
+  800088:	00 00 00 
+  80008b:	ff d0                	call   *%rax
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  80008d:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80008f:	48 c1 e2 20          	shl    $0x20,%rdx
+  800093:	89 c0                	mov    %eax,%eax
+  800095:	48 89 d3             	mov    %rdx,%rbx
+  800098:	48 09 c3             	or     %rax,%rbx
+        int res = read(fd, buf, HOT_SIZE);
+  80009b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8000a0:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  8000a7:	00 00 00 
+  8000aa:	44 89 f7             	mov    %r14d,%edi
+  8000ad:	48 b8 73 1d 80 00 00 	movabs $0x801d73,%rax
+  8000b4:	00 00 00 
+  8000b7:	ff d0                	call   *%rax
+  8000b9:	48 89 c1             	mov    %rax,%rcx
+    asm volatile("rdtsc"
+  8000bc:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000be:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000c2:	89 c0                	mov    %eax,%eax
+  8000c4:	48 09 c2             	or     %rax,%rdx
+        uint64_t cycles = read_tsc() - start;
+  8000c7:	48 29 da             	sub    %rbx,%rdx
+        if (res != HOT_SIZE) panic("read /fsconcbench: %i", res);
+  8000ca:	81 f9 00 00 01 00    	cmp    $0x10000,%ecx
+  8000d0:	74 8c                	je     80005e <bench+0x39>
+  8000d2:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  8000d9:	00 00 00 
+  8000dc:	be 2e 00 00 00       	mov    $0x2e,%esi
+  8000e1:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  8000e8:	00 00 00 
+  8000eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f0:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8000f7:	00 00 00 
+  8000fa:	41 ff d0             	call   *%r8
+    while (nreads < NREADS || (child && env->env_id == child && env->env_status != ENV_FREE)) {
+  8000fd:	8b 4d c8             	mov    -0x38(%rbp),%ecx
+  800100:	85 c9                	test   %ecx,%ecx
+  800102:	74 49                	je     80014d <bench+0x128>
+  800104:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800107:	48 63 d7             	movslq %edi,%rdx
+  80010a:	48 69 d2 e0 01 00 00 	imul   $0x1e0,%rdx,%rdx
+  800111:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800118:	00 00 00 
+  80011b:	48 01 d0             	add    %rdx,%rax
+  80011e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800124:	39 c8                	cmp    %ecx,%eax
+  800126:	75 25                	jne    80014d <bench+0x128>
+  800128:	48 63 d7             	movslq %edi,%rdx
+  80012b:	48 69 d2 e0 01 00 00 	imul   $0x1e0,%rdx,%rdx
+  800132:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800139:	00 00 00 
+  80013c:	48 01 d0             	add    %rdx,%rax
+  80013f:	8b 80 d4 00 00 00    	mov    0xd4(%rax),%eax
+  800145:	85 c0                	test   %eax,%eax
+  800147:	0f 85 2c ff ff ff    	jne    800079 <bench+0x54>
+    }
+
+    cprintf("fsconcbench: %s: %lu reads, %lu cycles per read, %lu at worst\n",
+            name, (unsigned long)nreads, (unsigned long)(total / nreads),
+  80014d:	48 8b 5d c0          	mov    -0x40(%rbp),%rbx
+  800151:	4c 89 f8             	mov    %r15,%rax
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	49 f7 f4             	div    %r12
+  80015c:	48 89 c1             	mov    %rax,%rcx
+    cprintf("fsconcbench: %s: %lu reads, %lu cycles per read, %lu at worst\n",
+  80015f:	4d 89 e8             	mov    %r13,%r8
+  800162:	4c 89 e2             	mov    %r12,%rdx
+  800165:	48 89 de             	mov    %rbx,%rsi
+  800168:	48 bf 50 4d 80 00 00 	movabs $0x804d50,%rdi
+  80016f:	00 00 00 
+  800172:	b8 00 00 00 00       	mov    $0x0,%eax
+  800177:	49 b9 2b 06 80 00 00 	movabs $0x80062b,%r9
+  80017e:	00 00 00 
+  800181:	41 ff d1             	call   *%r9
+            (unsigned long)worst);
+}
+  800184:	48 83 c4 18          	add    $0x18,%rsp
+  800188:	5b                   	pop    %rbx
+  800189:	41 5c                	pop    %r12
+  80018b:	41 5d                	pop    %r13
+  80018d:	41 5e                	pop    %r14
+  80018f:	41 5f                	pop    %r15
+  800191:	5d                   	pop    %rbp
+  800192:	c3                   	ret
+
+0000000000800193 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800193:	55                   	push   %rbp
+  800194:	48 89 e5             	mov    %rsp,%rbp
+  800197:	41 57                	push   %r15
+  800199:	41 56                	push   %r14
+  80019b:	41 55                	push   %r13
+  80019d:	41 54                	push   %r12
+  80019f:	53                   	push   %rbx
+  8001a0:	48 83 ec 08          	sub    $0x8,%rsp
+    int fd, res;
+
+    if ((fd = open("/fsconcbench", O_RDWR | O_CREAT | O_TRUNC)) < 0)
+  8001a4:	be 02 03 00 00       	mov    $0x302,%esi
+  8001a9:	48 bf a9 4c 80 00 00 	movabs $0x804ca9,%rdi
+  8001b0:	00 00 00 
+  8001b3:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8001ba:	00 00 00 
+  8001bd:	ff d0                	call   *%rax
+  8001bf:	89 c3                	mov    %eax,%ebx
+  8001c1:	85 c0                	test   %eax,%eax
+  8001c3:	0f 88 c7 00 00 00    	js     800290 <umain+0xfd>
+        panic("open /fsconcbench: %i", fd);
+    memset(buf, 'x', HOT_SIZE);
+  8001c9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8001ce:	be 78 00 00 00       	mov    $0x78,%esi
+  8001d3:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  8001da:	00 00 00 
+  8001dd:	4c 89 e7             	mov    %r12,%rdi
+  8001e0:	48 b8 9c 10 80 00 00 	movabs $0x80109c,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+    if ((res = write(fd, buf, HOT_SIZE)) != HOT_SIZE)
+  8001ec:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8001f1:	4c 89 e6             	mov    %r12,%rsi
+  8001f4:	89 df                	mov    %ebx,%edi
+  8001f6:	48 b8 a2 1e 80 00 00 	movabs $0x801ea2,%rax
+  8001fd:	00 00 00 
+  800200:	ff d0                	call   *%rax
+  800202:	89 c1                	mov    %eax,%ecx
+  800204:	3d 00 00 01 00       	cmp    $0x10000,%eax
+  800209:	0f 85 ae 00 00 00    	jne    8002bd <umain+0x12a>
+        panic("write /fsconcbench: %i", res);
+
+    bench("idle disk", fd, 0);
+  80020f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800214:	89 de                	mov    %ebx,%esi
+  800216:	48 bf e3 4c 80 00 00 	movabs $0x804ce3,%rdi
+  80021d:	00 00 00 
+  800220:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800227:	00 00 00 
+  80022a:	ff d0                	call   *%rax
+
+    envid_t child = fork();
+  80022c:	48 b8 e2 18 80 00 00 	movabs $0x8018e2,%rax
+  800233:	00 00 00 
+  800236:	ff d0                	call   *%rax
+  800238:	41 89 c4             	mov    %eax,%r12d
+    if (child < 0) panic("fork: %i", child);
+  80023b:	85 c0                	test   %eax,%eax
+  80023d:	0f 88 a5 00 00 00    	js     8002e8 <umain+0x155>
+    if (!child) {
+  800243:	0f 84 cc 00 00 00    	je     800315 <umain+0x182>
+        stream();
+        exit();
+    }
+
+    bench("busy disk", fd, child);
+  800249:	44 89 e2             	mov    %r12d,%edx
+  80024c:	89 de                	mov    %ebx,%esi
+  80024e:	48 bf 41 4d 80 00 00 	movabs $0x804d41,%rdi
+  800255:	00 00 00 
+  800258:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+    wait(child);
+  800264:	44 89 e7             	mov    %r12d,%edi
+  800267:	48 b8 0b 41 80 00 00 	movabs $0x80410b,%rax
+  80026e:	00 00 00 
+  800271:	ff d0                	call   *%rax
+    close(fd);
+  800273:	89 df                	mov    %ebx,%edi
+  800275:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  80027c:	00 00 00 
+  80027f:	ff d0                	call   *%rax
+}
+  800281:	48 83 c4 08          	add    $0x8,%rsp
+  800285:	5b                   	pop    %rbx
+  800286:	41 5c                	pop    %r12
+  800288:	41 5d                	pop    %r13
+  80028a:	41 5e                	pop    %r14
+  80028c:	41 5f                	pop    %r15
+  80028e:	5d                   	pop    %rbp
+  80028f:	c3                   	ret
+        panic("open /fsconcbench: %i", fd);
+  800290:	89 c1                	mov    %eax,%ecx
+  800292:	48 ba b6 4c 80 00 00 	movabs $0x804cb6,%rdx
+  800299:	00 00 00 
+  80029c:	be 3f 00 00 00       	mov    $0x3f,%esi
+  8002a1:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  8002a8:	00 00 00 
+  8002ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002b0:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8002b7:	00 00 00 
+  8002ba:	41 ff d0             	call   *%r8
+        panic("write /fsconcbench: %i", res);
+  8002bd:	48 ba cc 4c 80 00 00 	movabs $0x804ccc,%rdx
+  8002c4:	00 00 00 
+  8002c7:	be 42 00 00 00       	mov    $0x42,%esi
+  8002cc:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  8002d3:	00 00 00 
+  8002d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002db:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8002e2:	00 00 00 
+  8002e5:	41 ff d0             	call   *%r8
+    if (child < 0) panic("fork: %i", child);
+  8002e8:	89 c1                	mov    %eax,%ecx
+  8002ea:	48 ba ed 4c 80 00 00 	movabs $0x804ced,%rdx
+  8002f1:	00 00 00 
+  8002f4:	be 47 00 00 00       	mov    $0x47,%esi
+  8002f9:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  800300:	00 00 00 
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  80030f:	00 00 00 
+  800312:	41 ff d0             	call   *%r8
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800315:	be 00 00 00 00       	mov    $0x0,%esi
+  80031a:	48 bf f6 4c 80 00 00 	movabs $0x804cf6,%rdi
+  800321:	00 00 00 
+  800324:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  80032b:	00 00 00 
+  80032e:	ff d0                	call   *%rax
+  800330:	41 89 c6             	mov    %eax,%r14d
+  800333:	85 c0                	test   %eax,%eax
+  800335:	78 12                	js     800349 <umain+0x1b6>
+    size_t total = 0;
+  800337:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  80033d:	49 bf 73 1d 80 00 00 	movabs $0x801d73,%r15
+  800344:	00 00 00 
+  800347:	eb 32                	jmp    80037b <umain+0x1e8>
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800349:	89 c1                	mov    %eax,%ecx
+  80034b:	48 ba ff 4c 80 00 00 	movabs $0x804cff,%rdx
+  800352:	00 00 00 
+  800355:	be 19 00 00 00       	mov    $0x19,%esi
+  80035a:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  800361:	00 00 00 
+  800364:	b8 00 00 00 00       	mov    $0x0,%eax
+  800369:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  800370:	00 00 00 
+  800373:	41 ff d0             	call   *%r8
+        total += res;
+  800376:	48 98                	cltq
+  800378:	49 01 c5             	add    %rax,%r13
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  80037b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  800380:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  800387:	00 00 00 
+  80038a:	44 89 f7             	mov    %r14d,%edi
+  80038d:	41 ff d7             	call   *%r15
+  800390:	89 c1                	mov    %eax,%ecx
+  800392:	85 c0                	test   %eax,%eax
+  800394:	7f e0                	jg     800376 <umain+0x1e3>
+    if (res < 0) panic("read /bigfile: %i", res);
+  800396:	78 42                	js     8003da <umain+0x247>
+    close(fd);
+  800398:	44 89 f7             	mov    %r14d,%edi
+  80039b:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  8003a2:	00 00 00 
+  8003a5:	ff d0                	call   *%rax
+    cprintf("fsconcbench: streamed %lu KB\n", (unsigned long)(total / 1024));
+  8003a7:	4c 89 ee             	mov    %r13,%rsi
+  8003aa:	48 c1 ee 0a          	shr    $0xa,%rsi
+  8003ae:	48 bf 23 4d 80 00 00 	movabs $0x804d23,%rdi
+  8003b5:	00 00 00 
+  8003b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003bd:	48 ba 2b 06 80 00 00 	movabs $0x80062b,%rdx
+  8003c4:	00 00 00 
+  8003c7:	ff d2                	call   *%rdx
+        exit();
+  8003c9:	48 b8 b8 04 80 00 00 	movabs $0x8004b8,%rax
+  8003d0:	00 00 00 
+  8003d3:	ff d0                	call   *%rax
+  8003d5:	e9 6f fe ff ff       	jmp    800249 <umain+0xb6>
+    if (res < 0) panic("read /bigfile: %i", res);
+  8003da:	48 ba 11 4d 80 00 00 	movabs $0x804d11,%rdx
+  8003e1:	00 00 00 
+  8003e4:	be 1c 00 00 00       	mov    $0x1c,%esi
+  8003e9:	48 bf 96 4c 80 00 00 	movabs $0x804c96,%rdi
+  8003f0:	00 00 00 
+  8003f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003f8:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8003ff:	00 00 00 
+  800402:	41 ff d0             	call   *%r8
+
+0000000000800405 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800405:	55                   	push   %rbp
+  800406:	48 89 e5             	mov    %rsp,%rbp
+  800409:	41 56                	push   %r14
+  80040b:	41 55                	push   %r13
+  80040d:	41 54                	push   %r12
+  80040f:	53                   	push   %rbx
+  800410:	41 89 fd             	mov    %edi,%r13d
+  800413:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800416:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80041d:	00 00 00 
+  800420:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800427:	00 00 00 
+  80042a:	48 39 c2             	cmp    %rax,%rdx
+  80042d:	73 17                	jae    800446 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80042f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800432:	49 89 c4             	mov    %rax,%r12
+  800435:	48 83 c3 08          	add    $0x8,%rbx
+  800439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043e:	ff 53 f8             	call   *-0x8(%rbx)
+  800441:	4c 39 e3             	cmp    %r12,%rbx
+  800444:	72 ef                	jb     800435 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800446:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  80044d:	00 00 00 
+  800450:	ff d0                	call   *%rax
+  800452:	89 c2                	mov    %eax,%edx
+  800454:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80045a:	48 89 d0             	mov    %rdx,%rax
+  80045d:	48 c1 e0 04          	shl    $0x4,%rax
+  800461:	48 29 d0             	sub    %rdx,%rax
+  800464:	48 c1 e0 05          	shl    $0x5,%rax
+  800468:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80046f:	00 00 00 
+  800472:	48 01 d0             	add    %rdx,%rax
+  800475:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  80047c:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80047f:	45 85 ed             	test   %r13d,%r13d
+  800482:	7e 0d                	jle    800491 <libmain+0x8c>
+  800484:	49 8b 06             	mov    (%r14),%rax
+  800487:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  80048e:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800491:	4c 89 f6             	mov    %r14,%rsi
+  800494:	44 89 ef             	mov    %r13d,%edi
+  800497:	48 b8 93 01 80 00 00 	movabs $0x800193,%rax
+  80049e:	00 00 00 
+  8004a1:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004a3:	48 b8 b8 04 80 00 00 	movabs $0x8004b8,%rax
+  8004aa:	00 00 00 
+  8004ad:	ff d0                	call   *%rax
+#endif
+}
+  8004af:	5b                   	pop    %rbx
+  8004b0:	41 5c                	pop    %r12
+  8004b2:	41 5d                	pop    %r13
+  8004b4:	41 5e                	pop    %r14
+  8004b6:	5d                   	pop    %rbp
+  8004b7:	c3                   	ret
+
+00000000008004b8 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004b8:	55                   	push   %rbp
+  8004b9:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004bc:	48 b8 28 1c 80 00 00 	movabs $0x801c28,%rax
+  8004c3:	00 00 00 
+  8004c6:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004c8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004cd:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  8004d4:	00 00 00 
+  8004d7:	ff d0                	call   *%rax
+}
+  8004d9:	5d                   	pop    %rbp
+  8004da:	c3                   	ret
+
+00000000008004db <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004db:	55                   	push   %rbp
+  8004dc:	48 89 e5             	mov    %rsp,%rbp
+  8004df:	41 56                	push   %r14
+  8004e1:	41 55                	push   %r13
+  8004e3:	41 54                	push   %r12
+  8004e5:	53                   	push   %rbx
+  8004e6:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ea:	49 89 fc             	mov    %rdi,%r12
+  8004ed:	41 89 f5             	mov    %esi,%r13d
+  8004f0:	48 89 d3             	mov    %rdx,%rbx
+  8004f3:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004f7:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004fb:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004ff:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800506:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80050e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800512:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800516:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80051d:	00 00 00 
+  800520:	4c 8b 30             	mov    (%rax),%r14
+  800523:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  80052a:	00 00 00 
+  80052d:	ff d0                	call   *%rax
+  80052f:	89 c6                	mov    %eax,%esi
+  800531:	45 89 e8             	mov    %r13d,%r8d
+  800534:	4c 89 e1             	mov    %r12,%rcx
+  800537:	4c 89 f2             	mov    %r14,%rdx
+  80053a:	48 bf a0 4d 80 00 00 	movabs $0x804da0,%rdi
+  800541:	00 00 00 
+  800544:	b8 00 00 00 00       	mov    $0x0,%eax
+  800549:	49 bc 2b 06 80 00 00 	movabs $0x80062b,%r12
+  800550:	00 00 00 
+  800553:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800556:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80055a:	48 89 df             	mov    %rbx,%rdi
+  80055d:	48 b8 c7 05 80 00 00 	movabs $0x8005c7,%rax
+  800564:	00 00 00 
+  800567:	ff d0                	call   *%rax
+    cprintf("\n");
+  800569:	48 bf 3f 4d 80 00 00 	movabs $0x804d3f,%rdi
+  800570:	00 00 00 
+  800573:	b8 00 00 00 00       	mov    $0x0,%eax
+  800578:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80057b:	cc                   	int3
+  80057c:	eb fd                	jmp    80057b <_panic+0xa0>
+
+000000000080057e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80057e:	55                   	push   %rbp
+  80057f:	48 89 e5             	mov    %rsp,%rbp
+  800582:	53                   	push   %rbx
+  800583:	48 83 ec 08          	sub    $0x8,%rsp
+  800587:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80058a:	8b 06                	mov    (%rsi),%eax
+  80058c:	8d 50 01             	lea    0x1(%rax),%edx
+  80058f:	89 16                	mov    %edx,(%rsi)
+  800591:	48 98                	cltq
+  800593:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800598:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80059e:	74 0a                	je     8005aa <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005a0:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005a4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005a8:	c9                   	leave
+  8005a9:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005aa:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005ae:	be ff 00 00 00       	mov    $0xff,%esi
+  8005b3:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  8005ba:	00 00 00 
+  8005bd:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005bf:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005c5:	eb d9                	jmp    8005a0 <putch+0x22>
+
+00000000008005c7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005c7:	55                   	push   %rbp
+  8005c8:	48 89 e5             	mov    %rsp,%rbp
+  8005cb:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005d2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005d5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005dc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005e9:	48 89 f1             	mov    %rsi,%rcx
+  8005ec:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005f3:	48 bf 7e 05 80 00 00 	movabs $0x80057e,%rdi
+  8005fa:	00 00 00 
+  8005fd:	48 b8 7b 07 80 00 00 	movabs $0x80077b,%rax
+  800604:	00 00 00 
+  800607:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800609:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800610:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800617:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  80061e:	00 00 00 
+  800621:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800623:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800629:	c9                   	leave
+  80062a:	c3                   	ret
+
+000000000080062b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80062b:	55                   	push   %rbp
+  80062c:	48 89 e5             	mov    %rsp,%rbp
+  80062f:	48 83 ec 50          	sub    $0x50,%rsp
+  800633:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800637:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80063b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80063f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800643:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800647:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80064e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800652:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800656:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80065a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80065e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800662:	48 b8 c7 05 80 00 00 	movabs $0x8005c7,%rax
+  800669:	00 00 00 
+  80066c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80066e:	c9                   	leave
+  80066f:	c3                   	ret
+
+0000000000800670 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800670:	55                   	push   %rbp
+  800671:	48 89 e5             	mov    %rsp,%rbp
+  800674:	41 57                	push   %r15
+  800676:	41 56                	push   %r14
+  800678:	41 55                	push   %r13
+  80067a:	41 54                	push   %r12
+  80067c:	53                   	push   %rbx
+  80067d:	48 83 ec 18          	sub    $0x18,%rsp
+  800681:	49 89 fc             	mov    %rdi,%r12
+  800684:	49 89 f5             	mov    %rsi,%r13
+  800687:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80068b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80068e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800691:	41 89 cf             	mov    %ecx,%r15d
+  800694:	4c 39 fa             	cmp    %r15,%rdx
+  800697:	73 5b                	jae    8006f4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800699:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80069d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006a1:	85 db                	test   %ebx,%ebx
+  8006a3:	7e 0e                	jle    8006b3 <print_num+0x43>
+            putch(padc, put_arg);
+  8006a5:	4c 89 ee             	mov    %r13,%rsi
+  8006a8:	44 89 f7             	mov    %r14d,%edi
+  8006ab:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006ae:	83 eb 01             	sub    $0x1,%ebx
+  8006b1:	75 f2                	jne    8006a5 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006b3:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006b7:	48 b9 d4 4d 80 00 00 	movabs $0x804dd4,%rcx
+  8006be:	00 00 00 
+  8006c1:	48 b8 c3 4d 80 00 00 	movabs $0x804dc3,%rax
+  8006c8:	00 00 00 
+  8006cb:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006cf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d8:	49 f7 f7             	div    %r15
+  8006db:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006df:	4c 89 ee             	mov    %r13,%rsi
+  8006e2:	41 ff d4             	call   *%r12
+}
+  8006e5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006e9:	5b                   	pop    %rbx
+  8006ea:	41 5c                	pop    %r12
+  8006ec:	41 5d                	pop    %r13
+  8006ee:	41 5e                	pop    %r14
+  8006f0:	41 5f                	pop    %r15
+  8006f2:	5d                   	pop    %rbp
+  8006f3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006f4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006fd:	49 f7 f7             	div    %r15
+  800700:	48 83 ec 08          	sub    $0x8,%rsp
+  800704:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800708:	52                   	push   %rdx
+  800709:	45 0f be c9          	movsbl %r9b,%r9d
+  80070d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800711:	48 89 c2             	mov    %rax,%rdx
+  800714:	48 b8 70 06 80 00 00 	movabs $0x800670,%rax
+  80071b:	00 00 00 
+  80071e:	ff d0                	call   *%rax
+  800720:	48 83 c4 10          	add    $0x10,%rsp
+  800724:	eb 8d                	jmp    8006b3 <print_num+0x43>
+
+0000000000800726 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800726:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80072a:	48 8b 06             	mov    (%rsi),%rax
+  80072d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800731:	73 0a                	jae    80073d <sprintputch+0x17>
+        *state->start++ = ch;
+  800733:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800737:	48 89 16             	mov    %rdx,(%rsi)
+  80073a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80073d:	c3                   	ret
+
+000000000080073e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80073e:	55                   	push   %rbp
+  80073f:	48 89 e5             	mov    %rsp,%rbp
+  800742:	48 83 ec 50          	sub    $0x50,%rsp
+  800746:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80074a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80074e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800752:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800759:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80075d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800761:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800765:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800769:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80076d:	48 b8 7b 07 80 00 00 	movabs $0x80077b,%rax
+  800774:	00 00 00 
+  800777:	ff d0                	call   *%rax
+}
+  800779:	c9                   	leave
+  80077a:	c3                   	ret
+
+000000000080077b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80077b:	55                   	push   %rbp
+  80077c:	48 89 e5             	mov    %rsp,%rbp
+  80077f:	41 57                	push   %r15
+  800781:	41 56                	push   %r14
+  800783:	41 55                	push   %r13
+  800785:	41 54                	push   %r12
+  800787:	53                   	push   %rbx
+  800788:	48 83 ec 38          	sub    $0x38,%rsp
+  80078c:	49 89 fe             	mov    %rdi,%r14
+  80078f:	49 89 f5             	mov    %rsi,%r13
+  800792:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800795:	48 8b 01             	mov    (%rcx),%rax
+  800798:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80079c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a4:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007ac:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007b0:	0f b6 3b             	movzbl (%rbx),%edi
+  8007b3:	40 80 ff 25          	cmp    $0x25,%dil
+  8007b7:	74 18                	je     8007d1 <vprintfmt+0x56>
+            if (!ch) return;
+  8007b9:	40 84 ff             	test   %dil,%dil
+  8007bc:	0f 84 b1 06 00 00    	je     800e73 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007c2:	40 0f b6 ff          	movzbl %dil,%edi
+  8007c6:	4c 89 ee             	mov    %r13,%rsi
+  8007c9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007cc:	4c 89 e3             	mov    %r12,%rbx
+  8007cf:	eb db                	jmp    8007ac <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007da:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007df:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007ec:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007f0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007f5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007fa:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007fd:	83 e8 23             	sub    $0x23,%eax
+  800800:	3c 57                	cmp    $0x57,%al
+  800802:	0f 87 51 06 00 00    	ja     800e59 <vprintfmt+0x6de>
+  800808:	0f b6 c0             	movzbl %al,%eax
+  80080b:	48 b9 80 4f 80 00 00 	movabs $0x804f80,%rcx
+  800812:	00 00 00 
+  800815:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800818:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80081b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80081f:	eb cf                	jmp    8007f0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800821:	49 89 dc             	mov    %rbx,%r12
+  800824:	be 01 00 00 00       	mov    $0x1,%esi
+  800829:	eb c5                	jmp    8007f0 <vprintfmt+0x75>
+            padc = ch;
+  80082b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80082f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800832:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800835:	eb b9                	jmp    8007f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800837:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083a:	83 f8 2f             	cmp    $0x2f,%eax
+  80083d:	77 24                	ja     800863 <vprintfmt+0xe8>
+  80083f:	89 c1                	mov    %eax,%ecx
+  800841:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800845:	83 c0 08             	add    $0x8,%eax
+  800848:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80084e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800851:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800855:	79 99                	jns    8007f0 <vprintfmt+0x75>
+                width = precision;
+  800857:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80085b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800861:	eb 8d                	jmp    8007f0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800863:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800867:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80086b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80086f:	eb da                	jmp    80084b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800871:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800876:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80087a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800880:	3c 39                	cmp    $0x39,%al
+  800882:	77 1c                	ja     8008a0 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800884:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800888:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80088c:	0f b6 c0             	movzbl %al,%eax
+  80088f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800894:	0f b6 03             	movzbl (%rbx),%eax
+  800897:	3c 39                	cmp    $0x39,%al
+  800899:	76 e9                	jbe    800884 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80089b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80089e:	eb b1                	jmp    800851 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008a0:	49 89 dc             	mov    %rbx,%r12
+  8008a3:	eb ac                	jmp    800851 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008a5:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008a8:	85 c9                	test   %ecx,%ecx
+  8008aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008af:	0f 49 c1             	cmovns %ecx,%eax
+  8008b2:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008b5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008b8:	e9 33 ff ff ff       	jmp    8007f0 <vprintfmt+0x75>
+            lflag++;
+  8008bd:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008c0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008c3:	e9 28 ff ff ff       	jmp    8007f0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008c8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cb:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ce:	77 19                	ja     8008e9 <vprintfmt+0x16e>
+  8008d0:	89 c2                	mov    %eax,%edx
+  8008d2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d6:	83 c0 08             	add    $0x8,%eax
+  8008d9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008dc:	8b 3a                	mov    (%rdx),%edi
+  8008de:	4c 89 ee             	mov    %r13,%rsi
+  8008e1:	41 ff d6             	call   *%r14
+            break;
+  8008e4:	e9 c3 fe ff ff       	jmp    8007ac <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f5:	eb e5                	jmp    8008dc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008f7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fa:	83 f8 2f             	cmp    $0x2f,%eax
+  8008fd:	77 5a                	ja     800959 <vprintfmt+0x1de>
+  8008ff:	89 c2                	mov    %eax,%edx
+  800901:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800905:	83 c0 08             	add    $0x8,%eax
+  800908:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80090b:	8b 02                	mov    (%rdx),%eax
+  80090d:	89 c1                	mov    %eax,%ecx
+  80090f:	f7 d9                	neg    %ecx
+  800911:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800914:	83 f9 16             	cmp    $0x16,%ecx
+  800917:	7f 4e                	jg     800967 <vprintfmt+0x1ec>
+  800919:	48 63 c1             	movslq %ecx,%rax
+  80091c:	48 ba 40 52 80 00 00 	movabs $0x805240,%rdx
+  800923:	00 00 00 
+  800926:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80092a:	48 85 c0             	test   %rax,%rax
+  80092d:	74 38                	je     800967 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80092f:	48 89 c1             	mov    %rax,%rcx
+  800932:	48 ba 39 54 80 00 00 	movabs $0x805439,%rdx
+  800939:	00 00 00 
+  80093c:	4c 89 ee             	mov    %r13,%rsi
+  80093f:	4c 89 f7             	mov    %r14,%rdi
+  800942:	b8 00 00 00 00       	mov    $0x0,%eax
+  800947:	49 b8 3e 07 80 00 00 	movabs $0x80073e,%r8
+  80094e:	00 00 00 
+  800951:	41 ff d0             	call   *%r8
+  800954:	e9 53 fe ff ff       	jmp    8007ac <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800959:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800961:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800965:	eb a4                	jmp    80090b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800967:	48 ba ec 4d 80 00 00 	movabs $0x804dec,%rdx
+  80096e:	00 00 00 
+  800971:	4c 89 ee             	mov    %r13,%rsi
+  800974:	4c 89 f7             	mov    %r14,%rdi
+  800977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097c:	49 b8 3e 07 80 00 00 	movabs $0x80073e,%r8
+  800983:	00 00 00 
+  800986:	41 ff d0             	call   *%r8
+  800989:	e9 1e fe ff ff       	jmp    8007ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80098e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800991:	83 f8 2f             	cmp    $0x2f,%eax
+  800994:	77 6c                	ja     800a02 <vprintfmt+0x287>
+  800996:	89 c2                	mov    %eax,%edx
+  800998:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099c:	83 c0 08             	add    $0x8,%eax
+  80099f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a2:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009a5:	48 85 d2             	test   %rdx,%rdx
+  8009a8:	48 b8 e5 4d 80 00 00 	movabs $0x804de5,%rax
+  8009af:	00 00 00 
+  8009b2:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009b6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009ba:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009be:	7e 06                	jle    8009c6 <vprintfmt+0x24b>
+  8009c0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009c4:	75 4a                	jne    800a10 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ca:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009ce:	0f b6 00             	movzbl (%rax),%eax
+  8009d1:	84 c0                	test   %al,%al
+  8009d3:	0f 85 9a 00 00 00    	jne    800a73 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009d9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009dc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009e0:	85 c0                	test   %eax,%eax
+  8009e2:	0f 8e c4 fd ff ff    	jle    8007ac <vprintfmt+0x31>
+  8009e8:	4c 89 ee             	mov    %r13,%rsi
+  8009eb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009f0:	41 ff d6             	call   *%r14
+  8009f3:	41 83 ec 01          	sub    $0x1,%r12d
+  8009f7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009fb:	75 eb                	jne    8009e8 <vprintfmt+0x26d>
+  8009fd:	e9 aa fd ff ff       	jmp    8007ac <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0e:	eb 92                	jmp    8009a2 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a10:	49 63 f7             	movslq %r15d,%rsi
+  800a13:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a17:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  800a1e:	00 00 00 
+  800a21:	ff d0                	call   *%rax
+  800a23:	48 89 c2             	mov    %rax,%rdx
+  800a26:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a29:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a2b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a2e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a31:	85 c0                	test   %eax,%eax
+  800a33:	7e 91                	jle    8009c6 <vprintfmt+0x24b>
+  800a35:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a3a:	4c 89 ee             	mov    %r13,%rsi
+  800a3d:	44 89 e7             	mov    %r12d,%edi
+  800a40:	41 ff d6             	call   *%r14
+  800a43:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a47:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a4a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a4d:	75 eb                	jne    800a3a <vprintfmt+0x2bf>
+  800a4f:	e9 72 ff ff ff       	jmp    8009c6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a54:	0f b6 f8             	movzbl %al,%edi
+  800a57:	4c 89 ee             	mov    %r13,%rsi
+  800a5a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a5d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a61:	49 83 c4 01          	add    $0x1,%r12
+  800a65:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a6b:	84 c0                	test   %al,%al
+  800a6d:	0f 84 66 ff ff ff    	je     8009d9 <vprintfmt+0x25e>
+  800a73:	45 85 ff             	test   %r15d,%r15d
+  800a76:	78 0a                	js     800a82 <vprintfmt+0x307>
+  800a78:	41 83 ef 01          	sub    $0x1,%r15d
+  800a7c:	0f 88 57 ff ff ff    	js     8009d9 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a82:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a86:	74 cc                	je     800a54 <vprintfmt+0x2d9>
+  800a88:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a8b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a90:	80 fa 5e             	cmp    $0x5e,%dl
+  800a93:	77 c2                	ja     800a57 <vprintfmt+0x2dc>
+  800a95:	eb bd                	jmp    800a54 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a97:	40 84 f6             	test   %sil,%sil
+  800a9a:	75 26                	jne    800ac2 <vprintfmt+0x347>
+    switch (lflag) {
+  800a9c:	85 d2                	test   %edx,%edx
+  800a9e:	74 59                	je     800af9 <vprintfmt+0x37e>
+  800aa0:	83 fa 01             	cmp    $0x1,%edx
+  800aa3:	74 7b                	je     800b20 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aab:	0f 87 96 00 00 00    	ja     800b47 <vprintfmt+0x3cc>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	4c 8b 22             	mov    (%rdx),%r12
+  800ac0:	eb 17                	jmp    800ad9 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac8:	77 21                	ja     800aeb <vprintfmt+0x370>
+  800aca:	89 c2                	mov    %eax,%edx
+  800acc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad0:	83 c0 08             	add    $0x8,%eax
+  800ad3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800ad9:	4d 85 e4             	test   %r12,%r12
+  800adc:	78 7a                	js     800b58 <vprintfmt+0x3dd>
+            num = i;
+  800ade:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800ae1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ae6:	e9 50 02 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aeb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af7:	eb dd                	jmp    800ad6 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800af9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afc:	83 f8 2f             	cmp    $0x2f,%eax
+  800aff:	77 11                	ja     800b12 <vprintfmt+0x397>
+  800b01:	89 c2                	mov    %eax,%edx
+  800b03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b07:	83 c0 08             	add    $0x8,%eax
+  800b0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0d:	4c 63 22             	movslq (%rdx),%r12
+  800b10:	eb c7                	jmp    800ad9 <vprintfmt+0x35e>
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb ed                	jmp    800b0d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b23:	83 f8 2f             	cmp    $0x2f,%eax
+  800b26:	77 11                	ja     800b39 <vprintfmt+0x3be>
+  800b28:	89 c2                	mov    %eax,%edx
+  800b2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2e:	83 c0 08             	add    $0x8,%eax
+  800b31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b34:	4c 8b 22             	mov    (%rdx),%r12
+  800b37:	eb a0                	jmp    800ad9 <vprintfmt+0x35e>
+  800b39:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b41:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b45:	eb ed                	jmp    800b34 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	e9 65 ff ff ff       	jmp    800abd <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b58:	4c 89 ee             	mov    %r13,%rsi
+  800b5b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b60:	41 ff d6             	call   *%r14
+                i = -i;
+  800b63:	49 f7 dc             	neg    %r12
+  800b66:	e9 73 ff ff ff       	jmp    800ade <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6b:	40 84 f6             	test   %sil,%sil
+  800b6e:	75 32                	jne    800ba2 <vprintfmt+0x427>
+    switch (lflag) {
+  800b70:	85 d2                	test   %edx,%edx
+  800b72:	74 5d                	je     800bd1 <vprintfmt+0x456>
+  800b74:	83 fa 01             	cmp    $0x1,%edx
+  800b77:	0f 84 82 00 00 00    	je     800bff <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b7d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b80:	83 f8 2f             	cmp    $0x2f,%eax
+  800b83:	0f 87 a5 00 00 00    	ja     800c2e <vprintfmt+0x4b3>
+  800b89:	89 c2                	mov    %eax,%edx
+  800b8b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8f:	83 c0 08             	add    $0x8,%eax
+  800b92:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b95:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b98:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b9d:	e9 99 01 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba5:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba8:	77 19                	ja     800bc3 <vprintfmt+0x448>
+  800baa:	89 c2                	mov    %eax,%edx
+  800bac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb0:	83 c0 08             	add    $0x8,%eax
+  800bb3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb6:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bb9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bbe:	e9 78 01 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+  800bc3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bcf:	eb e5                	jmp    800bb6 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bd1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd7:	77 18                	ja     800bf1 <vprintfmt+0x476>
+  800bd9:	89 c2                	mov    %eax,%edx
+  800bdb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bdf:	83 c0 08             	add    $0x8,%eax
+  800be2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800be7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bec:	e9 4a 01 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+  800bf1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bf9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bfd:	eb e6                	jmp    800be5 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800bff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c02:	83 f8 2f             	cmp    $0x2f,%eax
+  800c05:	77 19                	ja     800c20 <vprintfmt+0x4a5>
+  800c07:	89 c2                	mov    %eax,%edx
+  800c09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0d:	83 c0 08             	add    $0x8,%eax
+  800c10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c13:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c1b:	e9 1b 01 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+  800c20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2c:	eb e5                	jmp    800c13 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3a:	e9 56 ff ff ff       	jmp    800b95 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c3f:	40 84 f6             	test   %sil,%sil
+  800c42:	75 2e                	jne    800c72 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c44:	85 d2                	test   %edx,%edx
+  800c46:	74 59                	je     800ca1 <vprintfmt+0x526>
+  800c48:	83 fa 01             	cmp    $0x1,%edx
+  800c4b:	74 7f                	je     800ccc <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c50:	83 f8 2f             	cmp    $0x2f,%eax
+  800c53:	0f 87 9f 00 00 00    	ja     800cf8 <vprintfmt+0x57d>
+  800c59:	89 c2                	mov    %eax,%edx
+  800c5b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5f:	83 c0 08             	add    $0x8,%eax
+  800c62:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c65:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c68:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c6d:	e9 c9 00 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c75:	83 f8 2f             	cmp    $0x2f,%eax
+  800c78:	77 19                	ja     800c93 <vprintfmt+0x518>
+  800c7a:	89 c2                	mov    %eax,%edx
+  800c7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c80:	83 c0 08             	add    $0x8,%eax
+  800c83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c89:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c8e:	e9 a8 00 00 00       	jmp    800d3b <vprintfmt+0x5c0>
+  800c93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c9f:	eb e5                	jmp    800c86 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ca1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca7:	77 15                	ja     800cbe <vprintfmt+0x543>
+  800ca9:	89 c2                	mov    %eax,%edx
+  800cab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800caf:	83 c0 08             	add    $0x8,%eax
+  800cb2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb5:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800cb7:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800cbc:	eb 7d                	jmp    800d3b <vprintfmt+0x5c0>
+  800cbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cca:	eb e9                	jmp    800cb5 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ccc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ccf:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd2:	77 16                	ja     800cea <vprintfmt+0x56f>
+  800cd4:	89 c2                	mov    %eax,%edx
+  800cd6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cda:	83 c0 08             	add    $0x8,%eax
+  800cdd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ce3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800ce8:	eb 51                	jmp    800d3b <vprintfmt+0x5c0>
+  800cea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf6:	eb e8                	jmp    800ce0 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800cf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d04:	e9 5c ff ff ff       	jmp    800c65 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d09:	4c 89 ee             	mov    %r13,%rsi
+  800d0c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d11:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d14:	4c 89 ee             	mov    %r13,%rsi
+  800d17:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d1c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d1f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d22:	83 f8 2f             	cmp    $0x2f,%eax
+  800d25:	77 47                	ja     800d6e <vprintfmt+0x5f3>
+  800d27:	89 c2                	mov    %eax,%edx
+  800d29:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2d:	83 c0 08             	add    $0x8,%eax
+  800d30:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d33:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d36:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d3b:	48 83 ec 08          	sub    $0x8,%rsp
+  800d3f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d43:	0f 94 c0             	sete   %al
+  800d46:	0f b6 c0             	movzbl %al,%eax
+  800d49:	50                   	push   %rax
+  800d4a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d4f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d53:	4c 89 ee             	mov    %r13,%rsi
+  800d56:	4c 89 f7             	mov    %r14,%rdi
+  800d59:	48 b8 70 06 80 00 00 	movabs $0x800670,%rax
+  800d60:	00 00 00 
+  800d63:	ff d0                	call   *%rax
+            break;
+  800d65:	48 83 c4 10          	add    $0x10,%rsp
+  800d69:	e9 3e fa ff ff       	jmp    8007ac <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7a:	eb b7                	jmp    800d33 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d7c:	40 84 f6             	test   %sil,%sil
+  800d7f:	75 2b                	jne    800dac <vprintfmt+0x631>
+    switch (lflag) {
+  800d81:	85 d2                	test   %edx,%edx
+  800d83:	74 56                	je     800ddb <vprintfmt+0x660>
+  800d85:	83 fa 01             	cmp    $0x1,%edx
+  800d88:	74 7f                	je     800e09 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d90:	0f 87 a2 00 00 00    	ja     800e38 <vprintfmt+0x6bd>
+  800d96:	89 c2                	mov    %eax,%edx
+  800d98:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9c:	83 c0 08             	add    $0x8,%eax
+  800d9f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da5:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800daa:	eb 8f                	jmp    800d3b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800daf:	83 f8 2f             	cmp    $0x2f,%eax
+  800db2:	77 19                	ja     800dcd <vprintfmt+0x652>
+  800db4:	89 c2                	mov    %eax,%edx
+  800db6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dba:	83 c0 08             	add    $0x8,%eax
+  800dbd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dc3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dc8:	e9 6e ff ff ff       	jmp    800d3b <vprintfmt+0x5c0>
+  800dcd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dd9:	eb e5                	jmp    800dc0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ddb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dde:	83 f8 2f             	cmp    $0x2f,%eax
+  800de1:	77 18                	ja     800dfb <vprintfmt+0x680>
+  800de3:	89 c2                	mov    %eax,%edx
+  800de5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de9:	83 c0 08             	add    $0x8,%eax
+  800dec:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800def:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800df1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800df6:	e9 40 ff ff ff       	jmp    800d3b <vprintfmt+0x5c0>
+  800dfb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dff:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e03:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e07:	eb e6                	jmp    800def <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e09:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e0f:	77 19                	ja     800e2a <vprintfmt+0x6af>
+  800e11:	89 c2                	mov    %eax,%edx
+  800e13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e17:	83 c0 08             	add    $0x8,%eax
+  800e1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e20:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e25:	e9 11 ff ff ff       	jmp    800d3b <vprintfmt+0x5c0>
+  800e2a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e2e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e32:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e36:	eb e5                	jmp    800e1d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e38:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e40:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e44:	e9 59 ff ff ff       	jmp    800da2 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e49:	4c 89 ee             	mov    %r13,%rsi
+  800e4c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e51:	41 ff d6             	call   *%r14
+            break;
+  800e54:	e9 53 f9 ff ff       	jmp    8007ac <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e59:	4c 89 ee             	mov    %r13,%rsi
+  800e5c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e61:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e64:	48 83 eb 01          	sub    $0x1,%rbx
+  800e68:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e6c:	75 f6                	jne    800e64 <vprintfmt+0x6e9>
+  800e6e:	e9 39 f9 ff ff       	jmp    8007ac <vprintfmt+0x31>
+}
+  800e73:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e77:	5b                   	pop    %rbx
+  800e78:	41 5c                	pop    %r12
+  800e7a:	41 5d                	pop    %r13
+  800e7c:	41 5e                	pop    %r14
+  800e7e:	41 5f                	pop    %r15
+  800e80:	5d                   	pop    %rbp
+  800e81:	c3                   	ret
+
+0000000000800e82 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e82:	55                   	push   %rbp
+  800e83:	48 89 e5             	mov    %rsp,%rbp
+  800e86:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e8a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e8e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e93:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e97:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e9e:	48 85 ff             	test   %rdi,%rdi
+  800ea1:	74 2b                	je     800ece <vsnprintf+0x4c>
+  800ea3:	48 85 f6             	test   %rsi,%rsi
+  800ea6:	74 26                	je     800ece <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800ea8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800eac:	48 bf 26 07 80 00 00 	movabs $0x800726,%rdi
+  800eb3:	00 00 00 
+  800eb6:	48 b8 7b 07 80 00 00 	movabs $0x80077b,%rax
+  800ebd:	00 00 00 
+  800ec0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ec2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ec6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ec9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ecc:	c9                   	leave
+  800ecd:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ece:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed3:	eb f7                	jmp    800ecc <vsnprintf+0x4a>
+
+0000000000800ed5 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ed5:	55                   	push   %rbp
+  800ed6:	48 89 e5             	mov    %rsp,%rbp
+  800ed9:	48 83 ec 50          	sub    $0x50,%rsp
+  800edd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ee1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ee5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ee9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ef0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ef4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800efc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f00:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f04:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  800f0b:	00 00 00 
+  800f0e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f10:	c9                   	leave
+  800f11:	c3                   	ret
+
+0000000000800f12 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f12:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f15:	74 10                	je     800f27 <strlen+0x15>
+    size_t n = 0;
+  800f17:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f1c:	48 83 c0 01          	add    $0x1,%rax
+  800f20:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f24:	75 f6                	jne    800f1c <strlen+0xa>
+  800f26:	c3                   	ret
+    size_t n = 0;
+  800f27:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f2c:	c3                   	ret
+
+0000000000800f2d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f2d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f30:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f35:	48 85 f6             	test   %rsi,%rsi
+  800f38:	74 11                	je     800f4b <strnlen+0x1e>
+  800f3a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f3e:	74 0c                	je     800f4c <strnlen+0x1f>
+  800f40:	48 83 c2 01          	add    $0x1,%rdx
+  800f44:	48 39 d0             	cmp    %rdx,%rax
+  800f47:	75 f1                	jne    800f3a <strnlen+0xd>
+  800f49:	eb 04                	jmp    800f4f <strnlen+0x22>
+  800f4b:	c3                   	ret
+  800f4c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f4f:	c3                   	ret
+
+0000000000800f50 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f50:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f53:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f58:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f5c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f5f:	48 83 c2 01          	add    $0x1,%rdx
+  800f63:	84 c9                	test   %cl,%cl
+  800f65:	75 f1                	jne    800f58 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f67:	c3                   	ret
+
+0000000000800f68 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f68:	55                   	push   %rbp
+  800f69:	48 89 e5             	mov    %rsp,%rbp
+  800f6c:	41 54                	push   %r12
+  800f6e:	53                   	push   %rbx
+  800f6f:	48 89 fb             	mov    %rdi,%rbx
+  800f72:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f75:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  800f7c:	00 00 00 
+  800f7f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f81:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f85:	4c 89 e6             	mov    %r12,%rsi
+  800f88:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  800f8f:	00 00 00 
+  800f92:	ff d0                	call   *%rax
+    return dst;
+}
+  800f94:	48 89 d8             	mov    %rbx,%rax
+  800f97:	5b                   	pop    %rbx
+  800f98:	41 5c                	pop    %r12
+  800f9a:	5d                   	pop    %rbp
+  800f9b:	c3                   	ret
+
+0000000000800f9c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f9c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f9f:	48 85 d2             	test   %rdx,%rdx
+  800fa2:	74 1f                	je     800fc3 <strncpy+0x27>
+  800fa4:	48 01 fa             	add    %rdi,%rdx
+  800fa7:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800faa:	48 83 c1 01          	add    $0x1,%rcx
+  800fae:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fb2:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800fb6:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fba:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800fbe:	48 39 ca             	cmp    %rcx,%rdx
+  800fc1:	75 e7                	jne    800faa <strncpy+0xe>
+    }
+    return ret;
+}
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fc4:	48 89 f8             	mov    %rdi,%rax
+  800fc7:	48 85 d2             	test   %rdx,%rdx
+  800fca:	74 24                	je     800ff0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fcc:	48 83 ea 01          	sub    $0x1,%rdx
+  800fd0:	74 1b                	je     800fed <strlcpy+0x29>
+  800fd2:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fd6:	0f b6 16             	movzbl (%rsi),%edx
+  800fd9:	84 d2                	test   %dl,%dl
+  800fdb:	74 10                	je     800fed <strlcpy+0x29>
+            *dst++ = *src++;
+  800fdd:	48 83 c6 01          	add    $0x1,%rsi
+  800fe1:	48 83 c0 01          	add    $0x1,%rax
+  800fe5:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fe8:	48 39 c8             	cmp    %rcx,%rax
+  800feb:	75 e9                	jne    800fd6 <strlcpy+0x12>
+        *dst = '\0';
+  800fed:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ff0:	48 29 f8             	sub    %rdi,%rax
+}
+  800ff3:	c3                   	ret
+
+0000000000800ff4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ff4:	0f b6 07             	movzbl (%rdi),%eax
+  800ff7:	84 c0                	test   %al,%al
+  800ff9:	74 13                	je     80100e <strcmp+0x1a>
+  800ffb:	38 06                	cmp    %al,(%rsi)
+  800ffd:	75 0f                	jne    80100e <strcmp+0x1a>
+  800fff:	48 83 c7 01          	add    $0x1,%rdi
+  801003:	48 83 c6 01          	add    $0x1,%rsi
+  801007:	0f b6 07             	movzbl (%rdi),%eax
+  80100a:	84 c0                	test   %al,%al
+  80100c:	75 ed                	jne    800ffb <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80100e:	0f b6 c0             	movzbl %al,%eax
+  801011:	0f b6 16             	movzbl (%rsi),%edx
+  801014:	29 d0                	sub    %edx,%eax
+}
+  801016:	c3                   	ret
+
+0000000000801017 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801017:	48 85 d2             	test   %rdx,%rdx
+  80101a:	74 1f                	je     80103b <strncmp+0x24>
+  80101c:	0f b6 07             	movzbl (%rdi),%eax
+  80101f:	84 c0                	test   %al,%al
+  801021:	74 1e                	je     801041 <strncmp+0x2a>
+  801023:	3a 06                	cmp    (%rsi),%al
+  801025:	75 1a                	jne    801041 <strncmp+0x2a>
+  801027:	48 83 c7 01          	add    $0x1,%rdi
+  80102b:	48 83 c6 01          	add    $0x1,%rsi
+  80102f:	48 83 ea 01          	sub    $0x1,%rdx
+  801033:	75 e7                	jne    80101c <strncmp+0x5>
+
+    if (!n) return 0;
+  801035:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103a:	c3                   	ret
+  80103b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801040:	c3                   	ret
+  801041:	48 85 d2             	test   %rdx,%rdx
+  801044:	74 09                	je     80104f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801046:	0f b6 07             	movzbl (%rdi),%eax
+  801049:	0f b6 16             	movzbl (%rsi),%edx
+  80104c:	29 d0                	sub    %edx,%eax
+  80104e:	c3                   	ret
+    if (!n) return 0;
+  80104f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801054:	c3                   	ret
+
+0000000000801055 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801055:	0f b6 17             	movzbl (%rdi),%edx
+  801058:	84 d2                	test   %dl,%dl
+  80105a:	74 18                	je     801074 <strchr+0x1f>
+        if (*str == c) {
+  80105c:	0f be d2             	movsbl %dl,%edx
+  80105f:	39 f2                	cmp    %esi,%edx
+  801061:	74 17                	je     80107a <strchr+0x25>
+    for (; *str; str++) {
+  801063:	48 83 c7 01          	add    $0x1,%rdi
+  801067:	0f b6 17             	movzbl (%rdi),%edx
+  80106a:	84 d2                	test   %dl,%dl
+  80106c:	75 ee                	jne    80105c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80106e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801073:	c3                   	ret
+  801074:	b8 00 00 00 00       	mov    $0x0,%eax
+  801079:	c3                   	ret
+  80107a:	48 89 f8             	mov    %rdi,%rax
+}
+  80107d:	c3                   	ret
+
+000000000080107e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80107e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801081:	0f b6 17             	movzbl (%rdi),%edx
+  801084:	84 d2                	test   %dl,%dl
+  801086:	74 13                	je     80109b <strfind+0x1d>
+  801088:	0f be d2             	movsbl %dl,%edx
+  80108b:	39 f2                	cmp    %esi,%edx
+  80108d:	74 0b                	je     80109a <strfind+0x1c>
+  80108f:	48 83 c0 01          	add    $0x1,%rax
+  801093:	0f b6 10             	movzbl (%rax),%edx
+  801096:	84 d2                	test   %dl,%dl
+  801098:	75 ee                	jne    801088 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80109a:	c3                   	ret
+  80109b:	c3                   	ret
+
+000000000080109c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80109c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80109f:	48 89 f8             	mov    %rdi,%rax
+  8010a2:	48 f7 d8             	neg    %rax
+  8010a5:	83 e0 07             	and    $0x7,%eax
+  8010a8:	49 89 d1             	mov    %rdx,%r9
+  8010ab:	49 29 c1             	sub    %rax,%r9
+  8010ae:	78 36                	js     8010e6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010b0:	40 0f b6 c6          	movzbl %sil,%eax
+  8010b4:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010bb:	01 01 01 
+  8010be:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010c2:	40 f6 c7 07          	test   $0x7,%dil
+  8010c6:	75 38                	jne    801100 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010c8:	4c 89 c9             	mov    %r9,%rcx
+  8010cb:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010cf:	74 0c                	je     8010dd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010d1:	fc                   	cld
+  8010d2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010d5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010d9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010dd:	4d 85 c9             	test   %r9,%r9
+  8010e0:	75 45                	jne    801127 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010e2:	4c 89 c0             	mov    %r8,%rax
+  8010e5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010e6:	48 85 d2             	test   %rdx,%rdx
+  8010e9:	74 f7                	je     8010e2 <memset+0x46>
+  8010eb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010ee:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010f1:	48 83 c0 01          	add    $0x1,%rax
+  8010f5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010f9:	48 39 c2             	cmp    %rax,%rdx
+  8010fc:	75 f3                	jne    8010f1 <memset+0x55>
+  8010fe:	eb e2                	jmp    8010e2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801100:	40 f6 c7 01          	test   $0x1,%dil
+  801104:	74 06                	je     80110c <memset+0x70>
+  801106:	88 07                	mov    %al,(%rdi)
+  801108:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80110c:	40 f6 c7 02          	test   $0x2,%dil
+  801110:	74 07                	je     801119 <memset+0x7d>
+  801112:	66 89 07             	mov    %ax,(%rdi)
+  801115:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801119:	40 f6 c7 04          	test   $0x4,%dil
+  80111d:	74 a9                	je     8010c8 <memset+0x2c>
+  80111f:	89 07                	mov    %eax,(%rdi)
+  801121:	48 83 c7 04          	add    $0x4,%rdi
+  801125:	eb a1                	jmp    8010c8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801127:	41 f6 c1 04          	test   $0x4,%r9b
+  80112b:	74 06                	je     801133 <memset+0x97>
+  80112d:	89 07                	mov    %eax,(%rdi)
+  80112f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801133:	41 f6 c1 02          	test   $0x2,%r9b
+  801137:	74 07                	je     801140 <memset+0xa4>
+  801139:	66 89 07             	mov    %ax,(%rdi)
+  80113c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801140:	41 f6 c1 01          	test   $0x1,%r9b
+  801144:	74 9c                	je     8010e2 <memset+0x46>
+  801146:	88 07                	mov    %al,(%rdi)
+  801148:	eb 98                	jmp    8010e2 <memset+0x46>
+
+000000000080114a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80114a:	48 89 f8             	mov    %rdi,%rax
+  80114d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801150:	48 39 fe             	cmp    %rdi,%rsi
+  801153:	73 3b                	jae    801190 <memmove+0x46>
+  801155:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801159:	48 39 d7             	cmp    %rdx,%rdi
+  80115c:	73 32                	jae    801190 <memmove+0x46>
+        s += n;
+        d += n;
+  80115e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801162:	48 89 d6             	mov    %rdx,%rsi
+  801165:	48 09 fe             	or     %rdi,%rsi
+  801168:	48 09 ce             	or     %rcx,%rsi
+  80116b:	40 f6 c6 07          	test   $0x7,%sil
+  80116f:	75 12                	jne    801183 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801171:	48 83 ef 08          	sub    $0x8,%rdi
+  801175:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801179:	48 c1 e9 03          	shr    $0x3,%rcx
+  80117d:	fd                   	std
+  80117e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801181:	fc                   	cld
+  801182:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801183:	48 83 ef 01          	sub    $0x1,%rdi
+  801187:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80118b:	fd                   	std
+  80118c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80118e:	eb f1                	jmp    801181 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801190:	48 89 f2             	mov    %rsi,%rdx
+  801193:	48 09 c2             	or     %rax,%rdx
+  801196:	48 09 ca             	or     %rcx,%rdx
+  801199:	f6 c2 07             	test   $0x7,%dl
+  80119c:	75 0c                	jne    8011aa <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80119e:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011a2:	48 89 c7             	mov    %rax,%rdi
+  8011a5:	fc                   	cld
+  8011a6:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011a9:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011aa:	48 89 c7             	mov    %rax,%rdi
+  8011ad:	fc                   	cld
+  8011ae:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011b0:	c3                   	ret
+
+00000000008011b1 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011b1:	55                   	push   %rbp
+  8011b2:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011b5:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  8011bc:	00 00 00 
+  8011bf:	ff d0                	call   *%rax
+}
+  8011c1:	5d                   	pop    %rbp
+  8011c2:	c3                   	ret
+
+00000000008011c3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011c3:	55                   	push   %rbp
+  8011c4:	48 89 e5             	mov    %rsp,%rbp
+  8011c7:	41 57                	push   %r15
+  8011c9:	41 56                	push   %r14
+  8011cb:	41 55                	push   %r13
+  8011cd:	41 54                	push   %r12
+  8011cf:	53                   	push   %rbx
+  8011d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d4:	49 89 fe             	mov    %rdi,%r14
+  8011d7:	49 89 f7             	mov    %rsi,%r15
+  8011da:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011dd:	48 89 f7             	mov    %rsi,%rdi
+  8011e0:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  8011e7:	00 00 00 
+  8011ea:	ff d0                	call   *%rax
+  8011ec:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011ef:	48 89 de             	mov    %rbx,%rsi
+  8011f2:	4c 89 f7             	mov    %r14,%rdi
+  8011f5:	48 b8 2d 0f 80 00 00 	movabs $0x800f2d,%rax
+  8011fc:	00 00 00 
+  8011ff:	ff d0                	call   *%rax
+  801201:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801204:	48 39 c3             	cmp    %rax,%rbx
+  801207:	74 36                	je     80123f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801209:	48 89 d8             	mov    %rbx,%rax
+  80120c:	4c 29 e8             	sub    %r13,%rax
+  80120f:	49 39 c4             	cmp    %rax,%r12
+  801212:	73 31                	jae    801245 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801214:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801219:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80121d:	4c 89 fe             	mov    %r15,%rsi
+  801220:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  801227:	00 00 00 
+  80122a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80122c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801230:	48 83 c4 08          	add    $0x8,%rsp
+  801234:	5b                   	pop    %rbx
+  801235:	41 5c                	pop    %r12
+  801237:	41 5d                	pop    %r13
+  801239:	41 5e                	pop    %r14
+  80123b:	41 5f                	pop    %r15
+  80123d:	5d                   	pop    %rbp
+  80123e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80123f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801243:	eb eb                	jmp    801230 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801245:	48 83 eb 01          	sub    $0x1,%rbx
+  801249:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80124d:	48 89 da             	mov    %rbx,%rdx
+  801250:	4c 89 fe             	mov    %r15,%rsi
+  801253:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80125a:	00 00 00 
+  80125d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80125f:	49 01 de             	add    %rbx,%r14
+  801262:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801267:	eb c3                	jmp    80122c <strlcat+0x69>
+
+0000000000801269 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801269:	48 85 d2             	test   %rdx,%rdx
+  80126c:	74 2d                	je     80129b <memcmp+0x32>
+  80126e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801273:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801277:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80127c:	44 38 c1             	cmp    %r8b,%cl
+  80127f:	75 0f                	jne    801290 <memcmp+0x27>
+    while (n-- > 0) {
+  801281:	48 83 c0 01          	add    $0x1,%rax
+  801285:	48 39 c2             	cmp    %rax,%rdx
+  801288:	75 e9                	jne    801273 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80128a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80128f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801290:	0f b6 c1             	movzbl %cl,%eax
+  801293:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801297:	44 29 c0             	sub    %r8d,%eax
+  80129a:	c3                   	ret
+    return 0;
+  80129b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a0:	c3                   	ret
+
+00000000008012a1 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012a1:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012a5:	48 39 c7             	cmp    %rax,%rdi
+  8012a8:	73 0f                	jae    8012b9 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012aa:	40 38 37             	cmp    %sil,(%rdi)
+  8012ad:	74 0e                	je     8012bd <memfind+0x1c>
+    for (; src < end; src++) {
+  8012af:	48 83 c7 01          	add    $0x1,%rdi
+  8012b3:	48 39 f8             	cmp    %rdi,%rax
+  8012b6:	75 f2                	jne    8012aa <memfind+0x9>
+  8012b8:	c3                   	ret
+  8012b9:	48 89 f8             	mov    %rdi,%rax
+  8012bc:	c3                   	ret
+  8012bd:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012c0:	c3                   	ret
+
+00000000008012c1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012c1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012c4:	0f b6 37             	movzbl (%rdi),%esi
+  8012c7:	40 80 fe 20          	cmp    $0x20,%sil
+  8012cb:	74 06                	je     8012d3 <strtol+0x12>
+  8012cd:	40 80 fe 09          	cmp    $0x9,%sil
+  8012d1:	75 13                	jne    8012e6 <strtol+0x25>
+  8012d3:	48 83 c7 01          	add    $0x1,%rdi
+  8012d7:	0f b6 37             	movzbl (%rdi),%esi
+  8012da:	40 80 fe 20          	cmp    $0x20,%sil
+  8012de:	74 f3                	je     8012d3 <strtol+0x12>
+  8012e0:	40 80 fe 09          	cmp    $0x9,%sil
+  8012e4:	74 ed                	je     8012d3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012e6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012e9:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012ec:	3c 01                	cmp    $0x1,%al
+  8012ee:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012f2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012f8:	75 0f                	jne    801309 <strtol+0x48>
+  8012fa:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012fd:	74 14                	je     801313 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012ff:	85 d2                	test   %edx,%edx
+  801301:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801306:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801309:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80130e:	4c 63 ca             	movslq %edx,%r9
+  801311:	eb 36                	jmp    801349 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801313:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801317:	74 0f                	je     801328 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801319:	85 d2                	test   %edx,%edx
+  80131b:	75 ec                	jne    801309 <strtol+0x48>
+        s++;
+  80131d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801321:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801326:	eb e1                	jmp    801309 <strtol+0x48>
+        s += 2;
+  801328:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80132c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801331:	eb d6                	jmp    801309 <strtol+0x48>
+            dig -= '0';
+  801333:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801336:	44 0f b6 c1          	movzbl %cl,%r8d
+  80133a:	41 39 d0             	cmp    %edx,%r8d
+  80133d:	7d 21                	jge    801360 <strtol+0x9f>
+        val = val * base + dig;
+  80133f:	49 0f af c1          	imul   %r9,%rax
+  801343:	0f b6 c9             	movzbl %cl,%ecx
+  801346:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801349:	48 83 c7 01          	add    $0x1,%rdi
+  80134d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801351:	80 f9 39             	cmp    $0x39,%cl
+  801354:	76 dd                	jbe    801333 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801356:	80 f9 7b             	cmp    $0x7b,%cl
+  801359:	77 05                	ja     801360 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80135b:	83 e9 57             	sub    $0x57,%ecx
+  80135e:	eb d6                	jmp    801336 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801360:	4d 85 d2             	test   %r10,%r10
+  801363:	74 03                	je     801368 <strtol+0xa7>
+  801365:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801368:	48 89 c2             	mov    %rax,%rdx
+  80136b:	48 f7 da             	neg    %rdx
+  80136e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801372:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801376:	c3                   	ret
+
+0000000000801377 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801377:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80137c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801381:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801387:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80138d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801393:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801395:	c3                   	ret
+
+0000000000801396 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801396:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80139b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013aa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bc:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013be:	c3                   	ret
+
+00000000008013bf <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013bf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013c7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013e5:	48 85 c0             	test   %rax,%rax
+  8013e8:	7f 01                	jg     8013eb <sys_env_destroy+0x2c>
+}
+  8013ea:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8013eb:	55                   	push   %rbp
+  8013ec:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013ef:	49 89 c0             	mov    %rax,%r8
+  8013f2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013f7:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8013fe:	00 00 00 
+  801401:	be 29 00 00 00       	mov    $0x29,%esi
+  801406:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  80140d:	00 00 00 
+  801410:	b8 00 00 00 00       	mov    $0x0,%eax
+  801415:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  80141c:	00 00 00 
+  80141f:	41 ff d1             	call   *%r9
+
+0000000000801422 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801427:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801431:	ba 00 00 00 00       	mov    $0x0,%edx
+  801436:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801442:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801448:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144a:	c3                   	ret
+
+000000000080144b <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80145a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801471:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801473:	c3                   	ret
+
+0000000000801474 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801474:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801479:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801480:	00 00 00 
+  801483:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801489:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80148f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801495:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801497:	c3                   	ret
+
+0000000000801498 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801498:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80149b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ac:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014ae:	c3                   	ret
+
+00000000008014af <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014af:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b2:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b7:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014c8:	48 85 c0             	test   %rax,%rax
+  8014cb:	7f 01                	jg     8014ce <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014cd:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014ce:	55                   	push   %rbp
+  8014cf:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d2:	49 89 c0             	mov    %rax,%r8
+  8014d5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014da:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8014e1:	00 00 00 
+  8014e4:	be 29 00 00 00       	mov    $0x29,%esi
+  8014e9:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  8014f0:	00 00 00 
+  8014f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f8:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8014ff:	00 00 00 
+  801502:	41 ff d1             	call   *%r9
+
+0000000000801505 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801505:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801508:	48 63 d2             	movslq %edx,%rdx
+  80150b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80150e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801513:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801516:	0f 05                	syscall
+    if (check && ret > 0) {
+  801518:	48 85 c0             	test   %rax,%rax
+  80151b:	7f 01                	jg     80151e <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80151d:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80151e:	55                   	push   %rbp
+  80151f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801522:	49 89 c0             	mov    %rax,%r8
+  801525:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80152a:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  801531:	00 00 00 
+  801534:	be 29 00 00 00       	mov    $0x29,%esi
+  801539:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  801540:	00 00 00 
+  801543:	b8 00 00 00 00       	mov    $0x0,%eax
+  801548:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  80154f:	00 00 00 
+  801552:	41 ff d1             	call   *%r9
+
+0000000000801555 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801555:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801558:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80155d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801563:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801569:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80156f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801571:	48 85 c0             	test   %rax,%rax
+  801574:	7f 01                	jg     801577 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801576:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801577:	55                   	push   %rbp
+  801578:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157b:	49 89 c0             	mov    %rax,%r8
+  80157e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801583:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  80158a:	00 00 00 
+  80158d:	be 29 00 00 00       	mov    $0x29,%esi
+  801592:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  801599:	00 00 00 
+  80159c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a1:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8015a8:	00 00 00 
+  8015ab:	41 ff d1             	call   *%r9
+
+00000000008015ae <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015ae:	48 63 f6             	movslq %esi,%rsi
+  8015b1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b4:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015be:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015d2:	48 85 c0             	test   %rax,%rax
+  8015d5:	7f 01                	jg     8015d8 <sys_env_set_status+0x2a>
+}
+  8015d7:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8015d8:	55                   	push   %rbp
+  8015d9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015dc:	49 89 c0             	mov    %rax,%r8
+  8015df:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015e4:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8015eb:	00 00 00 
+  8015ee:	be 29 00 00 00       	mov    $0x29,%esi
+  8015f3:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  8015fa:	00 00 00 
+  8015fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801602:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  801609:	00 00 00 
+  80160c:	41 ff d1             	call   *%r9
+
+000000000080160f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80160f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801617:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801622:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801628:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80162e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801630:	48 85 c0             	test   %rax,%rax
+  801633:	7f 01                	jg     801636 <sys_env_set_trapframe+0x27>
+}
+  801635:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801636:	55                   	push   %rbp
+  801637:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163a:	49 89 c0             	mov    %rax,%r8
+  80163d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801642:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  801649:	00 00 00 
+  80164c:	be 29 00 00 00       	mov    $0x29,%esi
+  801651:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  801658:	00 00 00 
+  80165b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801660:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  801667:	00 00 00 
+  80166a:	41 ff d1             	call   *%r9
+
+000000000080166d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80166d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801670:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801675:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801686:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80168e:	48 85 c0             	test   %rax,%rax
+  801691:	7f 01                	jg     801694 <sys_env_set_pgfault_upcall+0x27>
+}
+  801693:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801694:	55                   	push   %rbp
+  801695:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801698:	49 89 c0             	mov    %rax,%r8
+  80169b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016a0:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8016a7:	00 00 00 
+  8016aa:	be 29 00 00 00       	mov    $0x29,%esi
+  8016af:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  8016b6:	00 00 00 
+  8016b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016be:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8016c5:	00 00 00 
+  8016c8:	41 ff d1             	call   *%r9
+
+00000000008016cb <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016cb:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016ce:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016d1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016d6:	4d 63 c0             	movslq %r8d,%r8
+  8016d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016df:	0f 05                	syscall
+}
+  8016e1:	c3                   	ret
+
+00000000008016e2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016e2:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016e5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016e8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ed:	4d 63 c0             	movslq %r8d,%r8
+  8016f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f6:	0f 05                	syscall
+}
+  8016f8:	c3                   	ret
+
+00000000008016f9 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016f9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016fe:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801701:	45 89 c0             	mov    %r8d,%r8d
+  801704:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80170a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80170c:	48 85 c0             	test   %rax,%rax
+  80170f:	7f 01                	jg     801712 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801711:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801712:	55                   	push   %rbp
+  801713:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801716:	49 89 c0             	mov    %rax,%r8
+  801719:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80171e:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  801725:	00 00 00 
+  801728:	be 29 00 00 00       	mov    $0x29,%esi
+  80172d:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  801734:	00 00 00 
+  801737:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173c:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  801743:	00 00 00 
+  801746:	41 ff d1             	call   *%r9
+
+0000000000801749 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801749:	55                   	push   %rbp
+  80174a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80174d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801753:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801758:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175d:	48 b8 f9 16 80 00 00 	movabs $0x8016f9,%rax
+  801764:	00 00 00 
+  801767:	ff d0                	call   *%rax
+}
+  801769:	5d                   	pop    %rbp
+  80176a:	c3                   	ret
+
+000000000080176b <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80176b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801770:	bf 00 00 00 00       	mov    $0x0,%edi
+  801775:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801785:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80178b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801791:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801793:	c3                   	ret
+
+0000000000801794 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801794:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801799:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80179e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017b5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017b7:	48 85 c0             	test   %rax,%rax
+  8017ba:	7f 01                	jg     8017bd <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8017bc:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8017bd:	55                   	push   %rbp
+  8017be:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c1:	49 89 c0             	mov    %rax,%r8
+  8017c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017c9:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8017d0:	00 00 00 
+  8017d3:	be 29 00 00 00       	mov    $0x29,%esi
+  8017d8:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  8017df:	00 00 00 
+  8017e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e7:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8017ee:	00 00 00 
+  8017f1:	41 ff d1             	call   *%r9
+
+00000000008017f4 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017f4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017fe:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801803:	ba 00 00 00 00       	mov    $0x0,%edx
+  801808:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80180e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801814:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80181a:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80181c:	c3                   	ret
+
+000000000080181d <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80181d:	89 d2                	mov    %edx,%edx
+  80181f:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801821:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801826:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80182c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801832:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801838:	0f 05                	syscall
+}
+  80183a:	c3                   	ret
+
+000000000080183b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80183b:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80183e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801843:	ba 00 00 00 00       	mov    $0x0,%edx
+  801848:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80184e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801854:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80185a:	0f 05                	syscall
+}
+  80185c:	c3                   	ret
+
+000000000080185d <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80185d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801860:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801865:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801870:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801876:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80187c:	0f 05                	syscall
+}
+  80187e:	c3                   	ret
+
+000000000080187f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80187f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801882:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801887:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80188c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801891:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801897:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80189d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018a3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018a5:	48 85 c0             	test   %rax,%rax
+  8018a8:	7f 01                	jg     8018ab <sys_irq_ack+0x2c>
+}
+  8018aa:	c3                   	ret
+sys_irq_ack(int irq) {
+  8018ab:	55                   	push   %rbp
+  8018ac:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018af:	49 89 c0             	mov    %rax,%r8
+  8018b2:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8018b7:	48 ba 18 53 80 00 00 	movabs $0x805318,%rdx
+  8018be:	00 00 00 
+  8018c1:	be 29 00 00 00       	mov    $0x29,%esi
+  8018c6:	48 bf 37 53 80 00 00 	movabs $0x805337,%rdi
+  8018cd:	00 00 00 
+  8018d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d5:	49 b9 db 04 80 00 00 	movabs $0x8004db,%r9
+  8018dc:	00 00 00 
+  8018df:	41 ff d1             	call   *%r9
+
+00000000008018e2 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8018e2:	55                   	push   %rbp
+  8018e3:	48 89 e5             	mov    %rsp,%rbp
+  8018e6:	41 54                	push   %r12
+  8018e8:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  8018e9:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  8018f0:	00 00 00 
+  8018f3:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8018f5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8018fa:	0f 05                	syscall
+  8018fc:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8018ff:	85 c0                	test   %eax,%eax
+  801901:	78 7e                	js     801981 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801903:	0f 84 80 00 00 00    	je     801989 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801909:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80190f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801916:	00 00 00 
+  801919:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80191e:	89 c2                	mov    %eax,%edx
+  801920:	be 00 00 00 00       	mov    $0x0,%esi
+  801925:	bf 00 00 00 00       	mov    $0x0,%edi
+  80192a:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  801931:	00 00 00 
+  801934:	ff d0                	call   *%rax
+  801936:	85 c0                	test   %eax,%eax
+  801938:	0f 88 86 00 00 00    	js     8019c4 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80193e:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801945:	00 00 00 
+  801948:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80194f:	44 89 e7             	mov    %r12d,%edi
+  801952:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  801959:	00 00 00 
+  80195c:	ff d0                	call   *%rax
+  80195e:	85 c0                	test   %eax,%eax
+  801960:	78 6a                	js     8019cc <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801962:	be 02 00 00 00       	mov    $0x2,%esi
+  801967:	44 89 e7             	mov    %r12d,%edi
+  80196a:	48 b8 ae 15 80 00 00 	movabs $0x8015ae,%rax
+  801971:	00 00 00 
+  801974:	ff d0                	call   *%rax
+		return -1;
+  801976:	85 c0                	test   %eax,%eax
+  801978:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80197d:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801981:	44 89 e0             	mov    %r12d,%eax
+  801984:	5b                   	pop    %rbx
+  801985:	41 5c                	pop    %r12
+  801987:	5d                   	pop    %rbp
+  801988:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801989:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  801990:	00 00 00 
+  801993:	ff d0                	call   *%rax
+  801995:	89 c2                	mov    %eax,%edx
+  801997:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80199d:	48 89 d0             	mov    %rdx,%rax
+  8019a0:	48 c1 e0 04          	shl    $0x4,%rax
+  8019a4:	48 29 d0             	sub    %rdx,%rax
+  8019a7:	48 c1 e0 05          	shl    $0x5,%rax
+  8019ab:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8019b2:	00 00 00 
+  8019b5:	48 01 d0             	add    %rdx,%rax
+  8019b8:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  8019bf:	00 00 00 
+        return 0;
+  8019c2:	eb bd                	jmp    801981 <fork+0x9f>
+		return -1;
+  8019c4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019ca:	eb b5                	jmp    801981 <fork+0x9f>
+		return -1;
+  8019cc:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8019d2:	eb ad                	jmp    801981 <fork+0x9f>
+
+00000000008019d4 <sfork>:
+
+envid_t
+sfork() {
+  8019d4:	55                   	push   %rbp
+  8019d5:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8019d8:	48 ba 45 53 80 00 00 	movabs $0x805345,%rdx
+  8019df:	00 00 00 
+  8019e2:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8019e7:	48 bf 60 53 80 00 00 	movabs $0x805360,%rdi
+  8019ee:	00 00 00 
+  8019f1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f6:	48 b9 db 04 80 00 00 	movabs $0x8004db,%rcx
+  8019fd:	00 00 00 
+  801a00:	ff d1                	call   *%rcx
+
+0000000000801a02 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a02:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a09:	ff ff ff 
+  801a0c:	48 01 f8             	add    %rdi,%rax
+  801a0f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a13:	c3                   	ret
+
+0000000000801a14 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a14:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a1b:	ff ff ff 
+  801a1e:	48 01 f8             	add    %rdi,%rax
+  801a21:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a25:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a2b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a2f:	c3                   	ret
+
+0000000000801a30 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a30:	55                   	push   %rbp
+  801a31:	48 89 e5             	mov    %rsp,%rbp
+  801a34:	41 57                	push   %r15
+  801a36:	41 56                	push   %r14
+  801a38:	41 55                	push   %r13
+  801a3a:	41 54                	push   %r12
+  801a3c:	53                   	push   %rbx
+  801a3d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a41:	49 89 ff             	mov    %rdi,%r15
+  801a44:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a49:	49 bd be 42 80 00 00 	movabs $0x8042be,%r13
+  801a50:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a53:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a59:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a5c:	48 89 df             	mov    %rbx,%rdi
+  801a5f:	41 ff d5             	call   *%r13
+  801a62:	83 e0 04             	and    $0x4,%eax
+  801a65:	74 17                	je     801a7e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a67:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a6e:	4c 39 f3             	cmp    %r14,%rbx
+  801a71:	75 e6                	jne    801a59 <fd_alloc+0x29>
+  801a73:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a79:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a7e:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a81:	48 83 c4 08          	add    $0x8,%rsp
+  801a85:	5b                   	pop    %rbx
+  801a86:	41 5c                	pop    %r12
+  801a88:	41 5d                	pop    %r13
+  801a8a:	41 5e                	pop    %r14
+  801a8c:	41 5f                	pop    %r15
+  801a8e:	5d                   	pop    %rbp
+  801a8f:	c3                   	ret
+
+0000000000801a90 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a90:	83 ff 1f             	cmp    $0x1f,%edi
+  801a93:	77 39                	ja     801ace <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a95:	55                   	push   %rbp
+  801a96:	48 89 e5             	mov    %rsp,%rbp
+  801a99:	41 54                	push   %r12
+  801a9b:	53                   	push   %rbx
+  801a9c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a9f:	48 63 df             	movslq %edi,%rbx
+  801aa2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801aa9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801aad:	48 89 df             	mov    %rbx,%rdi
+  801ab0:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+  801abc:	a8 04                	test   $0x4,%al
+  801abe:	74 14                	je     801ad4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801ac0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801ac4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ac9:	5b                   	pop    %rbx
+  801aca:	41 5c                	pop    %r12
+  801acc:	5d                   	pop    %rbp
+  801acd:	c3                   	ret
+        return -E_INVAL;
+  801ace:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801ad3:	c3                   	ret
+        return -E_INVAL;
+  801ad4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ad9:	eb ee                	jmp    801ac9 <fd_lookup+0x39>
+
+0000000000801adb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801adb:	55                   	push   %rbp
+  801adc:	48 89 e5             	mov    %rsp,%rbp
+  801adf:	41 54                	push   %r12
+  801ae1:	53                   	push   %rbx
+  801ae2:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801ae5:	48 b8 00 54 80 00 00 	movabs $0x805400,%rax
+  801aec:	00 00 00 
+  801aef:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801af6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801af9:	39 3b                	cmp    %edi,(%rbx)
+  801afb:	74 47                	je     801b44 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801afd:	48 83 c0 08          	add    $0x8,%rax
+  801b01:	48 8b 18             	mov    (%rax),%rbx
+  801b04:	48 85 db             	test   %rbx,%rbx
+  801b07:	75 f0                	jne    801af9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b09:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801b10:	00 00 00 
+  801b13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b19:	89 fa                	mov    %edi,%edx
+  801b1b:	48 bf 70 53 80 00 00 	movabs $0x805370,%rdi
+  801b22:	00 00 00 
+  801b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2a:	48 b9 2b 06 80 00 00 	movabs $0x80062b,%rcx
+  801b31:	00 00 00 
+  801b34:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b36:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b3b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b3f:	5b                   	pop    %rbx
+  801b40:	41 5c                	pop    %r12
+  801b42:	5d                   	pop    %rbp
+  801b43:	c3                   	ret
+            return 0;
+  801b44:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b49:	eb f0                	jmp    801b3b <dev_lookup+0x60>
+
+0000000000801b4b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b4b:	55                   	push   %rbp
+  801b4c:	48 89 e5             	mov    %rsp,%rbp
+  801b4f:	41 55                	push   %r13
+  801b51:	41 54                	push   %r12
+  801b53:	53                   	push   %rbx
+  801b54:	48 83 ec 18          	sub    $0x18,%rsp
+  801b58:	48 89 fb             	mov    %rdi,%rbx
+  801b5b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b5e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b65:	ff ff ff 
+  801b68:	48 01 df             	add    %rbx,%rdi
+  801b6b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b6f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b73:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+  801b7f:	41 89 c5             	mov    %eax,%r13d
+  801b82:	85 c0                	test   %eax,%eax
+  801b84:	78 06                	js     801b8c <fd_close+0x41>
+  801b86:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801b8a:	74 1a                	je     801ba6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801b8c:	45 84 e4             	test   %r12b,%r12b
+  801b8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b94:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b98:	44 89 e8             	mov    %r13d,%eax
+  801b9b:	48 83 c4 18          	add    $0x18,%rsp
+  801b9f:	5b                   	pop    %rbx
+  801ba0:	41 5c                	pop    %r12
+  801ba2:	41 5d                	pop    %r13
+  801ba4:	5d                   	pop    %rbp
+  801ba5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801ba6:	8b 3b                	mov    (%rbx),%edi
+  801ba8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bac:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801bb3:	00 00 00 
+  801bb6:	ff d0                	call   *%rax
+  801bb8:	41 89 c5             	mov    %eax,%r13d
+  801bbb:	85 c0                	test   %eax,%eax
+  801bbd:	78 1b                	js     801bda <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bbf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bc3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801bc7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801bcd:	48 85 c0             	test   %rax,%rax
+  801bd0:	74 08                	je     801bda <fd_close+0x8f>
+  801bd2:	48 89 df             	mov    %rbx,%rdi
+  801bd5:	ff d0                	call   *%rax
+  801bd7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bda:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bdf:	48 89 de             	mov    %rbx,%rsi
+  801be2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801be7:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  801bee:	00 00 00 
+  801bf1:	ff d0                	call   *%rax
+    return res;
+  801bf3:	eb a3                	jmp    801b98 <fd_close+0x4d>
+
+0000000000801bf5 <close>:
+
+int
+close(int fdnum) {
+  801bf5:	55                   	push   %rbp
+  801bf6:	48 89 e5             	mov    %rsp,%rbp
+  801bf9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801bfd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c01:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801c08:	00 00 00 
+  801c0b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c0d:	85 c0                	test   %eax,%eax
+  801c0f:	78 15                	js     801c26 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c11:	be 01 00 00 00       	mov    $0x1,%esi
+  801c16:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c1a:	48 b8 4b 1b 80 00 00 	movabs $0x801b4b,%rax
+  801c21:	00 00 00 
+  801c24:	ff d0                	call   *%rax
+}
+  801c26:	c9                   	leave
+  801c27:	c3                   	ret
+
+0000000000801c28 <close_all>:
+
+void
+close_all(void) {
+  801c28:	55                   	push   %rbp
+  801c29:	48 89 e5             	mov    %rsp,%rbp
+  801c2c:	41 54                	push   %r12
+  801c2e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c2f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c34:	49 bc f5 1b 80 00 00 	movabs $0x801bf5,%r12
+  801c3b:	00 00 00 
+  801c3e:	89 df                	mov    %ebx,%edi
+  801c40:	41 ff d4             	call   *%r12
+  801c43:	83 c3 01             	add    $0x1,%ebx
+  801c46:	83 fb 20             	cmp    $0x20,%ebx
+  801c49:	75 f3                	jne    801c3e <close_all+0x16>
+}
+  801c4b:	5b                   	pop    %rbx
+  801c4c:	41 5c                	pop    %r12
+  801c4e:	5d                   	pop    %rbp
+  801c4f:	c3                   	ret
+
+0000000000801c50 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c50:	55                   	push   %rbp
+  801c51:	48 89 e5             	mov    %rsp,%rbp
+  801c54:	41 57                	push   %r15
+  801c56:	41 56                	push   %r14
+  801c58:	41 55                	push   %r13
+  801c5a:	41 54                	push   %r12
+  801c5c:	53                   	push   %rbx
+  801c5d:	48 83 ec 18          	sub    $0x18,%rsp
+  801c61:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c64:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c68:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+  801c74:	89 c3                	mov    %eax,%ebx
+  801c76:	85 c0                	test   %eax,%eax
+  801c78:	0f 88 b8 00 00 00    	js     801d36 <dup+0xe6>
+    close(newfdnum);
+  801c7e:	44 89 e7             	mov    %r12d,%edi
+  801c81:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  801c88:	00 00 00 
+  801c8b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801c8d:	4d 63 ec             	movslq %r12d,%r13
+  801c90:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c97:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c9b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c9f:	4c 89 ff             	mov    %r15,%rdi
+  801ca2:	49 be 14 1a 80 00 00 	movabs $0x801a14,%r14
+  801ca9:	00 00 00 
+  801cac:	41 ff d6             	call   *%r14
+  801caf:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cb2:	4c 89 ef             	mov    %r13,%rdi
+  801cb5:	41 ff d6             	call   *%r14
+  801cb8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cbb:	48 89 df             	mov    %rbx,%rdi
+  801cbe:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  801cc5:	00 00 00 
+  801cc8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801cca:	a8 04                	test   $0x4,%al
+  801ccc:	74 2b                	je     801cf9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801cce:	41 89 c1             	mov    %eax,%r9d
+  801cd1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cd7:	4c 89 f1             	mov    %r14,%rcx
+  801cda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cdf:	48 89 de             	mov    %rbx,%rsi
+  801ce2:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ce7:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  801cee:	00 00 00 
+  801cf1:	ff d0                	call   *%rax
+  801cf3:	89 c3                	mov    %eax,%ebx
+  801cf5:	85 c0                	test   %eax,%eax
+  801cf7:	78 4e                	js     801d47 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801cf9:	4c 89 ff             	mov    %r15,%rdi
+  801cfc:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  801d03:	00 00 00 
+  801d06:	ff d0                	call   *%rax
+  801d08:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d0b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d11:	4c 89 e9             	mov    %r13,%rcx
+  801d14:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d19:	4c 89 fe             	mov    %r15,%rsi
+  801d1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d21:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  801d28:	00 00 00 
+  801d2b:	ff d0                	call   *%rax
+  801d2d:	89 c3                	mov    %eax,%ebx
+  801d2f:	85 c0                	test   %eax,%eax
+  801d31:	78 14                	js     801d47 <dup+0xf7>
+
+    return newfdnum;
+  801d33:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d36:	89 d8                	mov    %ebx,%eax
+  801d38:	48 83 c4 18          	add    $0x18,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	41 5e                	pop    %r14
+  801d43:	41 5f                	pop    %r15
+  801d45:	5d                   	pop    %rbp
+  801d46:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d47:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d4c:	4c 89 ee             	mov    %r13,%rsi
+  801d4f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d54:	49 bc 55 15 80 00 00 	movabs $0x801555,%r12
+  801d5b:	00 00 00 
+  801d5e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d61:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d66:	4c 89 f6             	mov    %r14,%rsi
+  801d69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6e:	41 ff d4             	call   *%r12
+    return res;
+  801d71:	eb c3                	jmp    801d36 <dup+0xe6>
+
+0000000000801d73 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d73:	55                   	push   %rbp
+  801d74:	48 89 e5             	mov    %rsp,%rbp
+  801d77:	41 56                	push   %r14
+  801d79:	41 55                	push   %r13
+  801d7b:	41 54                	push   %r12
+  801d7d:	53                   	push   %rbx
+  801d7e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d82:	89 fb                	mov    %edi,%ebx
+  801d84:	49 89 f4             	mov    %rsi,%r12
+  801d87:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d8e:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801d95:	00 00 00 
+  801d98:	ff d0                	call   *%rax
+  801d9a:	85 c0                	test   %eax,%eax
+  801d9c:	78 4c                	js     801dea <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d9e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801da2:	41 8b 3e             	mov    (%r14),%edi
+  801da5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801da9:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 35                	js     801dee <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801db9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dbd:	83 e0 03             	and    $0x3,%eax
+  801dc0:	83 f8 01             	cmp    $0x1,%eax
+  801dc3:	74 2d                	je     801df2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801dc5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dc9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801dcd:	48 85 c0             	test   %rax,%rax
+  801dd0:	74 56                	je     801e28 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801dd2:	4c 89 ea             	mov    %r13,%rdx
+  801dd5:	4c 89 e6             	mov    %r12,%rsi
+  801dd8:	4c 89 f7             	mov    %r14,%rdi
+  801ddb:	ff d0                	call   *%rax
+}
+  801ddd:	48 83 c4 10          	add    $0x10,%rsp
+  801de1:	5b                   	pop    %rbx
+  801de2:	41 5c                	pop    %r12
+  801de4:	41 5d                	pop    %r13
+  801de6:	41 5e                	pop    %r14
+  801de8:	5d                   	pop    %rbp
+  801de9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dea:	48 98                	cltq
+  801dec:	eb ef                	jmp    801ddd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dee:	48 98                	cltq
+  801df0:	eb eb                	jmp    801ddd <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801df2:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801df9:	00 00 00 
+  801dfc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e02:	89 da                	mov    %ebx,%edx
+  801e04:	48 bf b1 53 80 00 00 	movabs $0x8053b1,%rdi
+  801e0b:	00 00 00 
+  801e0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e13:	48 b9 2b 06 80 00 00 	movabs $0x80062b,%rcx
+  801e1a:	00 00 00 
+  801e1d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e1f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e26:	eb b5                	jmp    801ddd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e28:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e2f:	eb ac                	jmp    801ddd <read+0x6a>
+
+0000000000801e31 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e31:	55                   	push   %rbp
+  801e32:	48 89 e5             	mov    %rsp,%rbp
+  801e35:	41 57                	push   %r15
+  801e37:	41 56                	push   %r14
+  801e39:	41 55                	push   %r13
+  801e3b:	41 54                	push   %r12
+  801e3d:	53                   	push   %rbx
+  801e3e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e42:	48 85 d2             	test   %rdx,%rdx
+  801e45:	74 54                	je     801e9b <readn+0x6a>
+  801e47:	41 89 fd             	mov    %edi,%r13d
+  801e4a:	49 89 f6             	mov    %rsi,%r14
+  801e4d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e50:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e55:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e5a:	49 bf 73 1d 80 00 00 	movabs $0x801d73,%r15
+  801e61:	00 00 00 
+  801e64:	4c 89 e2             	mov    %r12,%rdx
+  801e67:	48 29 f2             	sub    %rsi,%rdx
+  801e6a:	4c 01 f6             	add    %r14,%rsi
+  801e6d:	44 89 ef             	mov    %r13d,%edi
+  801e70:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e73:	85 c0                	test   %eax,%eax
+  801e75:	78 20                	js     801e97 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e77:	01 c3                	add    %eax,%ebx
+  801e79:	85 c0                	test   %eax,%eax
+  801e7b:	74 08                	je     801e85 <readn+0x54>
+  801e7d:	48 63 f3             	movslq %ebx,%rsi
+  801e80:	4c 39 e6             	cmp    %r12,%rsi
+  801e83:	72 df                	jb     801e64 <readn+0x33>
+    }
+    return res;
+  801e85:	48 63 c3             	movslq %ebx,%rax
+}
+  801e88:	48 83 c4 08          	add    $0x8,%rsp
+  801e8c:	5b                   	pop    %rbx
+  801e8d:	41 5c                	pop    %r12
+  801e8f:	41 5d                	pop    %r13
+  801e91:	41 5e                	pop    %r14
+  801e93:	41 5f                	pop    %r15
+  801e95:	5d                   	pop    %rbp
+  801e96:	c3                   	ret
+        if (inc < 0) return inc;
+  801e97:	48 98                	cltq
+  801e99:	eb ed                	jmp    801e88 <readn+0x57>
+    int inc = 1, res = 0;
+  801e9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ea0:	eb e3                	jmp    801e85 <readn+0x54>
+
+0000000000801ea2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ea2:	55                   	push   %rbp
+  801ea3:	48 89 e5             	mov    %rsp,%rbp
+  801ea6:	41 56                	push   %r14
+  801ea8:	41 55                	push   %r13
+  801eaa:	41 54                	push   %r12
+  801eac:	53                   	push   %rbx
+  801ead:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb1:	89 fb                	mov    %edi,%ebx
+  801eb3:	49 89 f4             	mov    %rsi,%r12
+  801eb6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebd:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801ec4:	00 00 00 
+  801ec7:	ff d0                	call   *%rax
+  801ec9:	85 c0                	test   %eax,%eax
+  801ecb:	78 47                	js     801f14 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecd:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ed1:	41 8b 3e             	mov    (%r14),%edi
+  801ed4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed8:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 30                	js     801f18 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee8:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801eed:	74 2d                	je     801f1c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801eef:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801ef7:	48 85 c0             	test   %rax,%rax
+  801efa:	74 56                	je     801f52 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801efc:	4c 89 ea             	mov    %r13,%rdx
+  801eff:	4c 89 e6             	mov    %r12,%rsi
+  801f02:	4c 89 f7             	mov    %r14,%rdi
+  801f05:	ff d0                	call   *%rax
+}
+  801f07:	48 83 c4 10          	add    $0x10,%rsp
+  801f0b:	5b                   	pop    %rbx
+  801f0c:	41 5c                	pop    %r12
+  801f0e:	41 5d                	pop    %r13
+  801f10:	41 5e                	pop    %r14
+  801f12:	5d                   	pop    %rbp
+  801f13:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f14:	48 98                	cltq
+  801f16:	eb ef                	jmp    801f07 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f18:	48 98                	cltq
+  801f1a:	eb eb                	jmp    801f07 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f1c:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801f23:	00 00 00 
+  801f26:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f2c:	89 da                	mov    %ebx,%edx
+  801f2e:	48 bf cd 53 80 00 00 	movabs $0x8053cd,%rdi
+  801f35:	00 00 00 
+  801f38:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f3d:	48 b9 2b 06 80 00 00 	movabs $0x80062b,%rcx
+  801f44:	00 00 00 
+  801f47:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f49:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f50:	eb b5                	jmp    801f07 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f52:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f59:	eb ac                	jmp    801f07 <write+0x65>
+
+0000000000801f5b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f5b:	55                   	push   %rbp
+  801f5c:	48 89 e5             	mov    %rsp,%rbp
+  801f5f:	41 54                	push   %r12
+  801f61:	53                   	push   %rbx
+  801f62:	48 83 ec 10          	sub    $0x10,%rsp
+  801f66:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f68:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f6c:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	85 c0                	test   %eax,%eax
+  801f7a:	78 3e                	js     801fba <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f7c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f80:	41 8b 3c 24          	mov    (%r12),%edi
+  801f84:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f88:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801f8f:	00 00 00 
+  801f92:	ff d0                	call   *%rax
+  801f94:	85 c0                	test   %eax,%eax
+  801f96:	78 22                	js     801fba <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801f98:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f9c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801fa0:	48 85 c0             	test   %rax,%rax
+  801fa3:	74 0b                	je     801fb0 <seek+0x55>
+  801fa5:	89 de                	mov    %ebx,%esi
+  801fa7:	4c 89 e7             	mov    %r12,%rdi
+  801faa:	ff d0                	call   *%rax
+  801fac:	85 c0                	test   %eax,%eax
+  801fae:	78 0a                	js     801fba <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801fb0:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801fb5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fba:	48 83 c4 10          	add    $0x10,%rsp
+  801fbe:	5b                   	pop    %rbx
+  801fbf:	41 5c                	pop    %r12
+  801fc1:	5d                   	pop    %rbp
+  801fc2:	c3                   	ret
+
+0000000000801fc3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fc3:	55                   	push   %rbp
+  801fc4:	48 89 e5             	mov    %rsp,%rbp
+  801fc7:	41 55                	push   %r13
+  801fc9:	41 54                	push   %r12
+  801fcb:	53                   	push   %rbx
+  801fcc:	48 83 ec 18          	sub    $0x18,%rsp
+  801fd0:	89 fb                	mov    %edi,%ebx
+  801fd2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fd5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fd9:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  801fe0:	00 00 00 
+  801fe3:	ff d0                	call   *%rax
+  801fe5:	85 c0                	test   %eax,%eax
+  801fe7:	78 38                	js     802021 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fe9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801fed:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ff1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ff5:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  801ffc:	00 00 00 
+  801fff:	ff d0                	call   *%rax
+  802001:	85 c0                	test   %eax,%eax
+  802003:	78 1c                	js     802021 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802005:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80200a:	74 20                	je     80202c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80200c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802010:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802014:	48 85 c0             	test   %rax,%rax
+  802017:	74 47                	je     802060 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802019:	44 89 e6             	mov    %r12d,%esi
+  80201c:	4c 89 ef             	mov    %r13,%rdi
+  80201f:	ff d0                	call   *%rax
+}
+  802021:	48 83 c4 18          	add    $0x18,%rsp
+  802025:	5b                   	pop    %rbx
+  802026:	41 5c                	pop    %r12
+  802028:	41 5d                	pop    %r13
+  80202a:	5d                   	pop    %rbp
+  80202b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80202c:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802033:	00 00 00 
+  802036:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80203c:	89 da                	mov    %ebx,%edx
+  80203e:	48 bf 90 53 80 00 00 	movabs $0x805390,%rdi
+  802045:	00 00 00 
+  802048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80204d:	48 b9 2b 06 80 00 00 	movabs $0x80062b,%rcx
+  802054:	00 00 00 
+  802057:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802059:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80205e:	eb c1                	jmp    802021 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802060:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802065:	eb ba                	jmp    802021 <ftruncate+0x5e>
+
+0000000000802067 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802067:	55                   	push   %rbp
+  802068:	48 89 e5             	mov    %rsp,%rbp
+  80206b:	41 54                	push   %r12
+  80206d:	53                   	push   %rbx
+  80206e:	48 83 ec 10          	sub    $0x10,%rsp
+  802072:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802075:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802079:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  802080:	00 00 00 
+  802083:	ff d0                	call   *%rax
+  802085:	85 c0                	test   %eax,%eax
+  802087:	78 4e                	js     8020d7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802089:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80208d:	41 8b 3c 24          	mov    (%r12),%edi
+  802091:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802095:	48 b8 db 1a 80 00 00 	movabs $0x801adb,%rax
+  80209c:	00 00 00 
+  80209f:	ff d0                	call   *%rax
+  8020a1:	85 c0                	test   %eax,%eax
+  8020a3:	78 32                	js     8020d7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020a5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020a9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020ae:	74 30                	je     8020e0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020b0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020b3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020ba:	00 00 00 
+    stat->st_isdir = 0;
+  8020bd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020c4:	00 00 00 
+    stat->st_dev = dev;
+  8020c7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020ce:	48 89 de             	mov    %rbx,%rsi
+  8020d1:	4c 89 e7             	mov    %r12,%rdi
+  8020d4:	ff 50 28             	call   *0x28(%rax)
+}
+  8020d7:	48 83 c4 10          	add    $0x10,%rsp
+  8020db:	5b                   	pop    %rbx
+  8020dc:	41 5c                	pop    %r12
+  8020de:	5d                   	pop    %rbp
+  8020df:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020e0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e5:	eb f0                	jmp    8020d7 <fstat+0x70>
+
+00000000008020e7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  8020e7:	55                   	push   %rbp
+  8020e8:	48 89 e5             	mov    %rsp,%rbp
+  8020eb:	41 54                	push   %r12
+  8020ed:	53                   	push   %rbx
+  8020ee:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  8020f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8020f6:	48 b8 55 32 80 00 00 	movabs $0x803255,%rax
+  8020fd:	00 00 00 
+  802100:	ff d0                	call   *%rax
+  802102:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802104:	85 c0                	test   %eax,%eax
+  802106:	78 25                	js     80212d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802108:	4c 89 e6             	mov    %r12,%rsi
+  80210b:	89 c7                	mov    %eax,%edi
+  80210d:	48 b8 67 20 80 00 00 	movabs $0x802067,%rax
+  802114:	00 00 00 
+  802117:	ff d0                	call   *%rax
+  802119:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80211c:	89 df                	mov    %ebx,%edi
+  80211e:	48 b8 f5 1b 80 00 00 	movabs $0x801bf5,%rax
+  802125:	00 00 00 
+  802128:	ff d0                	call   *%rax
+
+    return res;
+  80212a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80212d:	89 d8                	mov    %ebx,%eax
+  80212f:	5b                   	pop    %rbx
+  802130:	41 5c                	pop    %r12
+  802132:	5d                   	pop    %rbp
+  802133:	c3                   	ret
+
+0000000000802134 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802134:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  80213b:	00 00 00 
+  80213e:	83 38 00             	cmpl   $0x0,(%rax)
+  802141:	74 0a                	je     80214d <fsenv+0x19>
+    return envid;
+}
+  802143:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  80214a:	00 00 
+  80214c:	c3                   	ret
+fsenv(void) {
+  80214d:	55                   	push   %rbp
+  80214e:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802151:	bf 03 00 00 00       	mov    $0x3,%edi
+  802156:	48 b8 21 4c 80 00 00 	movabs $0x804c21,%rax
+  80215d:	00 00 00 
+  802160:	ff d0                	call   *%rax
+  802162:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  802169:	00 00 
+}
+  80216b:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  802172:	00 00 
+  802174:	5d                   	pop    %rbp
+  802175:	c3                   	ret
+
+0000000000802176 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802176:	55                   	push   %rbp
+  802177:	48 89 e5             	mov    %rsp,%rbp
+  80217a:	41 54                	push   %r12
+  80217c:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80217d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802182:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802187:	48 89 de             	mov    %rbx,%rsi
+  80218a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80218f:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  802196:	00 00 00 
+  802199:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80219b:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  8021a2:	00 00 00 
+  8021a5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8021ab:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8021b0:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021b5:	48 89 de             	mov    %rbx,%rsi
+  8021b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021bd:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  8021c4:	00 00 00 
+  8021c7:	ff d0                	call   *%rax
+  8021c9:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8021cb:	85 c0                	test   %eax,%eax
+  8021cd:	0f 88 a2 00 00 00    	js     802275 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8021d3:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8021da:	00 00 00 
+  8021dd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021e3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021e8:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8021ea:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8021ef:	49 bc 86 44 80 00 00 	movabs $0x804486,%r12
+  8021f6:	00 00 00 
+  8021f9:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8021fc:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802201:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802204:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80220b:	00 00 00 
+  80220e:	ff d0                	call   *%rax
+  802210:	89 c7                	mov    %eax,%edi
+  802212:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802218:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80221d:	48 89 da             	mov    %rbx,%rdx
+  802220:	be 09 00 00 00       	mov    $0x9,%esi
+  802225:	48 b8 cb 4b 80 00 00 	movabs $0x804bcb,%rax
+  80222c:	00 00 00 
+  80222f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802231:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80223b:	be 00 00 00 00       	mov    $0x0,%esi
+  802240:	bf 00 00 00 00       	mov    $0x0,%edi
+  802245:	48 b8 a7 4b 80 00 00 	movabs $0x804ba7,%rax
+  80224c:	00 00 00 
+  80224f:	ff d0                	call   *%rax
+  802251:	89 c3                	mov    %eax,%ebx
+  802253:	85 c0                	test   %eax,%eax
+  802255:	78 25                	js     80227c <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802257:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80225e:	00 00 00 
+  802261:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802267:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  80226e:	00 00 
+    return 0;
+  802270:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802275:	89 d8                	mov    %ebx,%eax
+  802277:	5b                   	pop    %rbx
+  802278:	41 5c                	pop    %r12
+  80227a:	5d                   	pop    %rbp
+  80227b:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80227c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802281:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802286:	bf 00 00 00 00       	mov    $0x0,%edi
+  80228b:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+        return res;
+  802297:	eb dc                	jmp    802275 <fschan_setup+0xff>
+
+0000000000802299 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802299:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8022a0:	00 00 00 
+  8022a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8022a6:	74 55                	je     8022fd <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022a8:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8022af:	00 00 00 
+  8022b2:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8022b8:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022bd:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  8022c4:	00 00 00 
+  8022c7:	3b 0a                	cmp    (%rdx),%ecx
+  8022c9:	75 01                	jne    8022cc <fschan+0x33>
+}
+  8022cb:	c3                   	ret
+fschan(void) {
+  8022cc:	55                   	push   %rbp
+  8022cd:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022d0:	48 b8 76 21 80 00 00 	movabs $0x802176,%rax
+  8022d7:	00 00 00 
+  8022da:	ff d0                	call   *%rax
+  8022dc:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8022de:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022e3:	85 d2                	test   %edx,%edx
+  8022e5:	78 02                	js     8022e9 <fschan+0x50>
+}
+  8022e7:	5d                   	pop    %rbp
+  8022e8:	c3                   	ret
+        fschan_enabled = 0;
+  8022e9:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8022f0:	00 00 00 
+  8022f3:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8022f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8022fb:	eb ea                	jmp    8022e7 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8022fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802302:	c3                   	ret
+
+0000000000802303 <fbuf>:
+fbuf(struct Fd *fd) {
+  802303:	55                   	push   %rbp
+  802304:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802307:	48 b8 02 1a 80 00 00 	movabs $0x801a02,%rax
+  80230e:	00 00 00 
+  802311:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802313:	ba 00 00 00 00       	mov    $0x0,%edx
+  802318:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80231c:	77 12                	ja     802330 <fbuf+0x2d>
+  80231e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802322:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802329:	00 00 00 
+  80232c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802330:	48 89 d0             	mov    %rdx,%rax
+  802333:	5d                   	pop    %rbp
+  802334:	c3                   	ret
+
+0000000000802335 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802335:	55                   	push   %rbp
+  802336:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802339:	48 83 c7 40          	add    $0x40,%rdi
+  80233d:	48 b8 c0 44 80 00 00 	movabs $0x8044c0,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	84 c0                	test   %al,%al
+  80234b:	75 02                	jne    80234f <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80234d:	5d                   	pop    %rbp
+  80234e:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80234f:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802356:	00 00 00 
+  802359:	ff d0                	call   *%rax
+  80235b:	89 c7                	mov    %eax,%edi
+  80235d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802363:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236d:	be 0a 00 00 00       	mov    $0xa,%esi
+  802372:	48 b8 cb 4b 80 00 00 	movabs $0x804bcb,%rax
+  802379:	00 00 00 
+  80237c:	ff d0                	call   *%rax
+}
+  80237e:	eb cd                	jmp    80234d <fschan_publish+0x18>
+
+0000000000802380 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802380:	55                   	push   %rbp
+  802381:	48 89 e5             	mov    %rsp,%rbp
+  802384:	41 57                	push   %r15
+  802386:	41 56                	push   %r14
+  802388:	41 55                	push   %r13
+  80238a:	41 54                	push   %r12
+  80238c:	53                   	push   %rbx
+  80238d:	48 83 ec 48          	sub    $0x48,%rsp
+  802391:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802395:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802399:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80239c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8023a0:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8023a3:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  8023aa:	00 00 00 
+  8023ad:	8b 02                	mov    (%rdx),%eax
+  8023af:	83 c0 01             	add    $0x1,%eax
+  8023b2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023b7:	0f 44 c1             	cmove  %ecx,%eax
+  8023ba:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8023bc:	4d 85 c0             	test   %r8,%r8
+  8023bf:	74 2c                	je     8023ed <fschan_rw+0x6d>
+  8023c1:	45 89 ce             	mov    %r9d,%r14d
+  8023c4:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8023cb:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8023cf:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023d5:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8023dc:	00 
+  8023dd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023e3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8023e8:	e9 41 01 00 00       	jmp    80252e <fschan_rw+0x1ae>
+  8023ed:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8023f1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8023f5:	e9 9c 01 00 00       	jmp    802596 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8023fa:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8023fe:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802401:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802404:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802407:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80240b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80240f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802413:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802417:	48 89 da             	mov    %rbx,%rdx
+  80241a:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802426:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80242a:	48 b8 35 23 80 00 00 	movabs $0x802335,%rax
+  802431:	00 00 00 
+  802434:	ff d0                	call   *%rax
+            queued += blk;
+  802436:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802439:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80243d:	4d 39 fc             	cmp    %r15,%r12
+  802440:	73 6b                	jae    8024ad <fschan_rw+0x12d>
+  802442:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802446:	77 65                	ja     8024ad <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802448:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80244c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802450:	48 b8 9b 44 80 00 00 	movabs $0x80449b,%rax
+  802457:	00 00 00 
+  80245a:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80245c:	4c 89 fb             	mov    %r15,%rbx
+  80245f:	4c 29 e3             	sub    %r12,%rbx
+  802462:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802467:	48 39 d3             	cmp    %rdx,%rbx
+  80246a:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80246e:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802472:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802476:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80247a:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80247d:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80247f:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  802486:	00 00 00 
+  802489:	8b 09                	mov    (%rcx),%ecx
+  80248b:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80248e:	83 fe 03             	cmp    $0x3,%esi
+  802491:	0f 85 63 ff ff ff    	jne    8023fa <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802497:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80249b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80249e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8024a1:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8024a4:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8024a8:	e9 79 ff ff ff       	jmp    802426 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8024ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024b1:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8024b8:	48 89 df             	mov    %rbx,%rdi
+  8024bb:	48 b8 5e 45 80 00 00 	movabs $0x80455e,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8024c7:	48 89 df             	mov    %rbx,%rdi
+  8024ca:	48 b8 ec 44 80 00 00 	movabs $0x8044ec,%rax
+  8024d1:	00 00 00 
+  8024d4:	ff d0                	call   *%rax
+  8024d6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8024da:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8024de:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8024e2:	75 25                	jne    802509 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8024e4:	8b 40 04             	mov    0x4(%rax),%eax
+  8024e7:	85 c0                	test   %eax,%eax
+  8024e9:	0f 88 86 00 00 00    	js     802575 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024ef:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8024f3:	74 5b                	je     802550 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8024f5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8024f9:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8024fd:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802501:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802505:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802509:	48 89 df             	mov    %rbx,%rdi
+  80250c:	48 b8 13 45 80 00 00 	movabs $0x804513,%rax
+  802513:	00 00 00 
+  802516:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802518:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80251c:	83 f0 01             	xor    $0x1,%eax
+  80251f:	4d 39 fc             	cmp    %r15,%r12
+  802522:	0f 92 c2             	setb   %dl
+  802525:	84 c2                	test   %al,%dl
+  802527:	75 05                	jne    80252e <fschan_rw+0x1ae>
+  802529:	45 85 ed             	test   %r13d,%r13d
+  80252c:	74 50                	je     80257e <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80252e:	4d 39 fc             	cmp    %r15,%r12
+  802531:	0f 92 c1             	setb   %cl
+  802534:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802538:	0f 96 c2             	setbe  %dl
+  80253b:	84 d1                	test   %dl,%cl
+  80253d:	0f 84 6a ff ff ff    	je     8024ad <fschan_rw+0x12d>
+  802543:	84 c0                	test   %al,%al
+  802545:	0f 85 fd fe ff ff    	jne    802448 <fschan_rw+0xc8>
+  80254b:	e9 5d ff ff ff       	jmp    8024ad <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802550:	48 63 d0             	movslq %eax,%rdx
+  802553:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802557:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80255b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80255f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802563:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802567:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80256e:	00 00 00 
+  802571:	ff d0                	call   *%rax
+  802573:	eb 80                	jmp    8024f5 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802575:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802578:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80257c:	eb 8b                	jmp    802509 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80257e:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802583:	0f 85 68 fe ff ff    	jne    8023f1 <fschan_rw+0x71>
+  802589:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80258c:	85 c0                	test   %eax,%eax
+  80258e:	0f 84 5d fe ff ff    	je     8023f1 <fschan_rw+0x71>
+  802594:	48 98                	cltq
+}
+  802596:	48 83 c4 48          	add    $0x48,%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	41 5d                	pop    %r13
+  80259f:	41 5e                	pop    %r14
+  8025a1:	41 5f                	pop    %r15
+  8025a3:	5d                   	pop    %rbp
+  8025a4:	c3                   	ret
+
+00000000008025a5 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8025a5:	55                   	push   %rbp
+  8025a6:	48 89 e5             	mov    %rsp,%rbp
+  8025a9:	41 56                	push   %r14
+  8025ab:	41 55                	push   %r13
+  8025ad:	41 54                	push   %r12
+  8025af:	53                   	push   %rbx
+  8025b0:	48 83 ec 10          	sub    $0x10,%rsp
+  8025b4:	49 89 fe             	mov    %rdi,%r14
+  8025b7:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8025ba:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8025be:	48 29 f3             	sub    %rsi,%rbx
+  8025c1:	48 39 d3             	cmp    %rdx,%rbx
+  8025c4:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8025c8:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8025cf:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8025d0:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8025d5:	49 bd 1d 43 80 00 00 	movabs $0x80431d,%r13
+  8025dc:	00 00 00 
+  8025df:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8025e6:	76 1e                	jbe    802606 <mmap_fault+0x61>
+  8025e8:	4c 01 e7             	add    %r12,%rdi
+  8025eb:	41 ff d5             	call   *%r13
+  8025ee:	84 c0                	test   %al,%al
+  8025f0:	75 14                	jne    802606 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8025f2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025f6:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8025fd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802601:	48 39 df             	cmp    %rbx,%rdi
+  802604:	72 e2                	jb     8025e8 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802606:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  80260d:	00 00 00 
+  802610:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  802617:	00 00 00 
+  80261a:	4c 89 f0             	mov    %r14,%rax
+  80261d:	48 29 d0             	sub    %rdx,%rax
+  802620:	48 c1 f8 03          	sar    $0x3,%rax
+  802624:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80262b:	aa aa aa 
+  80262e:	48 0f af c2          	imul   %rdx,%rax
+  802632:	48 c1 e0 0c          	shl    $0xc,%rax
+  802636:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80263b:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80263f:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802641:	44 89 e0             	mov    %r12d,%eax
+  802644:	41 03 46 10          	add    0x10(%r14),%eax
+  802648:	41 2b 06             	sub    (%r14),%eax
+  80264b:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80264e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802652:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802656:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80265a:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80265d:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802664:	00 00 00 
+  802667:	ff d0                	call   *%rax
+  802669:	89 c7                	mov    %eax,%edi
+  80266b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802671:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802676:	48 89 da             	mov    %rbx,%rdx
+  802679:	be 0f 00 00 00       	mov    $0xf,%esi
+  80267e:	48 b8 cb 4b 80 00 00 	movabs $0x804bcb,%rax
+  802685:	00 00 00 
+  802688:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80268a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80268f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802693:	4c 89 e6             	mov    %r12,%rsi
+  802696:	bf 00 00 00 00       	mov    $0x0,%edi
+  80269b:	48 b8 a7 4b 80 00 00 	movabs $0x804ba7,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+  8026a7:	48 98                	cltq
+}
+  8026a9:	48 83 c4 10          	add    $0x10,%rsp
+  8026ad:	5b                   	pop    %rbx
+  8026ae:	41 5c                	pop    %r12
+  8026b0:	41 5d                	pop    %r13
+  8026b2:	41 5e                	pop    %r14
+  8026b4:	5d                   	pop    %rbp
+  8026b5:	c3                   	ret
+
+00000000008026b6 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8026b6:	48 8b 37             	mov    (%rdi),%rsi
+  8026b9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8026c0:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8026c7:	00 00 00 
+  8026ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026cf:	eb 0f                	jmp    8026e0 <mmap_pgfault+0x2a>
+  8026d1:	c3                   	ret
+  8026d2:	48 83 c1 01          	add    $0x1,%rcx
+  8026d6:	48 83 c2 18          	add    $0x18,%rdx
+  8026da:	48 83 f9 20          	cmp    $0x20,%rcx
+  8026de:	74 6e                	je     80274e <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8026e0:	48 8b 02             	mov    (%rdx),%rax
+  8026e3:	48 83 e8 01          	sub    $0x1,%rax
+  8026e7:	48 39 f0             	cmp    %rsi,%rax
+  8026ea:	73 e6                	jae    8026d2 <mmap_pgfault+0x1c>
+  8026ec:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8026f0:	73 e0                	jae    8026d2 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8026f2:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8026f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026fb:	f6 c2 01             	test   $0x1,%dl
+  8026fe:	75 d1                	jne    8026d1 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802700:	f6 c2 02             	test   $0x2,%dl
+  802703:	74 1a                	je     80271f <mmap_pgfault+0x69>
+  802705:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802709:	b8 00 00 00 00       	mov    $0x0,%eax
+  80270e:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  802715:	00 00 00 
+  802718:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80271d:	74 35                	je     802754 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80271f:	55                   	push   %rbp
+  802720:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802723:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802727:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  80272e:	00 00 00 
+  802731:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802735:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80273a:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  802741:	00 00 00 
+  802744:	ff d0                	call   *%rax
+  802746:	48 85 c0             	test   %rax,%rax
+  802749:	0f 9f c0             	setg   %al
+}
+  80274c:	5d                   	pop    %rbp
+  80274d:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80274e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802753:	c3                   	ret
+}
+  802754:	c3                   	ret
+
+0000000000802755 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802755:	55                   	push   %rbp
+  802756:	48 89 e5             	mov    %rsp,%rbp
+  802759:	41 54                	push   %r12
+  80275b:	53                   	push   %rbx
+  80275c:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80275f:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  802766:	00 00 00 
+  802769:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80276e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802772:	74 15                	je     802789 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802774:	48 83 c3 01          	add    $0x1,%rbx
+  802778:	48 83 c0 18          	add    $0x18,%rax
+  80277c:	48 83 fb 20          	cmp    $0x20,%rbx
+  802780:	75 ec                	jne    80276e <mmap_alloc+0x19>
+    return NULL;
+  802782:	b8 00 00 00 00       	mov    $0x0,%eax
+  802787:	eb 52                	jmp    8027db <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802789:	4c 89 e7             	mov    %r12,%rdi
+  80278c:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  802793:	00 00 00 
+  802796:	ff d0                	call   *%rax
+  802798:	41 89 c1             	mov    %eax,%r9d
+  80279b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8027a2:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027a6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b1:	4c 89 e6             	mov    %r12,%rsi
+  8027b4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027b9:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  8027c0:	00 00 00 
+  8027c3:	ff d0                	call   *%rax
+  8027c5:	85 c0                	test   %eax,%eax
+  8027c7:	78 17                	js     8027e0 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8027c9:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8027cd:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8027d4:	00 00 00 
+  8027d7:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8027db:	5b                   	pop    %rbx
+  8027dc:	41 5c                	pop    %r12
+  8027de:	5d                   	pop    %rbp
+  8027df:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e5:	eb f4                	jmp    8027db <mmap_alloc+0x86>
+
+00000000008027e7 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8027e7:	55                   	push   %rbp
+  8027e8:	48 89 e5             	mov    %rsp,%rbp
+  8027eb:	41 56                	push   %r14
+  8027ed:	41 55                	push   %r13
+  8027ef:	41 54                	push   %r12
+  8027f1:	53                   	push   %rbx
+  8027f2:	48 83 ec 10          	sub    $0x10,%rsp
+  8027f6:	41 89 fc             	mov    %edi,%r12d
+  8027f9:	49 89 f5             	mov    %rsi,%r13
+  8027fc:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027ff:	48 89 f0             	mov    %rsi,%rax
+  802802:	48 09 d0             	or     %rdx,%rax
+  802805:	75 0d                	jne    802814 <fsipc+0x2d>
+  802807:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80280a:	83 f8 04             	cmp    $0x4,%eax
+  80280d:	76 7d                	jbe    80288c <fsipc+0xa5>
+  80280f:	83 ff 0d             	cmp    $0xd,%edi
+  802812:	74 78                	je     80288c <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802814:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+  802820:	89 c7                	mov    %eax,%edi
+  802822:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802829:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802830:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802837:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80283d:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802844:	00 00 00 
+  802847:	44 89 e6             	mov    %r12d,%esi
+  80284a:	48 b8 cb 4b 80 00 00 	movabs $0x804bcb,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802856:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80285d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80285e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802863:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802867:	4c 89 ee             	mov    %r13,%rsi
+  80286a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80286f:	48 b8 a7 4b 80 00 00 	movabs $0x804ba7,%rax
+  802876:	00 00 00 
+  802879:	ff d0                	call   *%rax
+  80287b:	89 c3                	mov    %eax,%ebx
+}
+  80287d:	89 d8                	mov    %ebx,%eax
+  80287f:	48 83 c4 10          	add    $0x10,%rsp
+  802883:	5b                   	pop    %rbx
+  802884:	41 5c                	pop    %r12
+  802886:	41 5d                	pop    %r13
+  802888:	41 5e                	pop    %r14
+  80288a:	5d                   	pop    %rbp
+  80288b:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80288c:	48 b8 99 22 80 00 00 	movabs $0x802299,%rax
+  802893:	00 00 00 
+  802896:	ff d0                	call   *%rax
+  802898:	49 89 c6             	mov    %rax,%r14
+  80289b:	48 85 c0             	test   %rax,%rax
+  80289e:	0f 84 70 ff ff ff    	je     802814 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8028a4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8028a8:	48 b8 9b 44 80 00 00 	movabs $0x80449b,%rax
+  8028af:	00 00 00 
+  8028b2:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8028b4:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8028b7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8028be:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8028c2:	ba 10 00 00 00       	mov    $0x10,%edx
+  8028c7:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  8028ce:	00 00 00 
+  8028d1:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8028d8:	00 00 00 
+  8028db:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8028dd:	4c 89 f7             	mov    %r14,%rdi
+  8028e0:	48 b8 35 23 80 00 00 	movabs $0x802335,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8028ec:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8028f3:	4c 89 f7             	mov    %r14,%rdi
+  8028f6:	48 b8 5e 45 80 00 00 	movabs $0x80455e,%rax
+  8028fd:	00 00 00 
+  802900:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802902:	4c 89 f7             	mov    %r14,%rdi
+  802905:	48 b8 ec 44 80 00 00 	movabs $0x8044ec,%rax
+  80290c:	00 00 00 
+  80290f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802911:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802914:	41 83 fc 05          	cmp    $0x5,%r12d
+  802918:	75 04                	jne    80291e <fsipc+0x137>
+  80291a:	85 db                	test   %ebx,%ebx
+  80291c:	79 14                	jns    802932 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80291e:	4c 89 f7             	mov    %r14,%rdi
+  802921:	48 b8 13 45 80 00 00 	movabs $0x804513,%rax
+  802928:	00 00 00 
+  80292b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80292d:	e9 4b ff ff ff       	jmp    80287d <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802932:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802936:	ba 88 00 00 00       	mov    $0x88,%edx
+  80293b:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802942:	00 00 00 
+  802945:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  80294c:	00 00 00 
+  80294f:	ff d0                	call   *%rax
+  802951:	eb cb                	jmp    80291e <fsipc+0x137>
+
+0000000000802953 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+  802957:	41 57                	push   %r15
+  802959:	41 56                	push   %r14
+  80295b:	41 55                	push   %r13
+  80295d:	41 54                	push   %r12
+  80295f:	53                   	push   %rbx
+  802960:	48 83 ec 18          	sub    $0x18,%rsp
+  802964:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802968:	49 89 f6             	mov    %rsi,%r14
+  80296b:	49 89 d4             	mov    %rdx,%r12
+  80296e:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802971:	48 b8 99 22 80 00 00 	movabs $0x802299,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80297d:	48 85 c0             	test   %rax,%rax
+  802980:	0f 85 96 00 00 00    	jne    802a1c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802986:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80298d:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80298e:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802995:	00 00 00 
+    while (n) {
+  802998:	4d 85 e4             	test   %r12,%r12
+  80299b:	74 79                	je     802a16 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80299d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8029a2:	49 39 dc             	cmp    %rbx,%r12
+  8029a5:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8029a9:	48 89 da             	mov    %rbx,%rdx
+  8029ac:	4c 89 f6             	mov    %r14,%rsi
+  8029af:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  8029b6:	00 00 00 
+  8029b9:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8029c0:	00 00 00 
+  8029c3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029c5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8029c9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029cc:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8029cf:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8029d2:	44 01 e8             	add    %r13d,%eax
+  8029d5:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8029d9:	41 0f 44 c5          	cmove  %r13d,%eax
+  8029dd:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8029e1:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8029e5:	48 89 da             	mov    %rbx,%rdx
+  8029e8:	be 00 00 00 00       	mov    $0x0,%esi
+  8029ed:	bf 04 00 00 00       	mov    $0x4,%edi
+  8029f2:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+        if (res < 0)
+  8029fe:	85 c0                	test   %eax,%eax
+  802a00:	78 4a                	js     802a4c <devfile_write_direct+0xf9>
+        buf += res;
+  802a02:	48 98                	cltq
+  802a04:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a07:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a0b:	49 29 c4             	sub    %rax,%r12
+  802a0e:	75 8d                	jne    80299d <devfile_write_direct+0x4a>
+    return write;
+  802a10:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a14:	eb 27                	jmp    802a3d <devfile_write_direct+0xea>
+    size_t write = 0;
+  802a16:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802a1a:	eb f4                	jmp    802a10 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a1c:	45 89 e9             	mov    %r13d,%r9d
+  802a1f:	4d 89 e0             	mov    %r12,%r8
+  802a22:	4c 89 f1             	mov    %r14,%rcx
+  802a25:	ba 04 00 00 00       	mov    $0x4,%edx
+  802a2a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a2e:	48 89 c7             	mov    %rax,%rdi
+  802a31:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  802a38:	00 00 00 
+  802a3b:	ff d0                	call   *%rax
+}
+  802a3d:	48 83 c4 18          	add    $0x18,%rsp
+  802a41:	5b                   	pop    %rbx
+  802a42:	41 5c                	pop    %r12
+  802a44:	41 5d                	pop    %r13
+  802a46:	41 5e                	pop    %r14
+  802a48:	41 5f                	pop    %r15
+  802a4a:	5d                   	pop    %rbp
+  802a4b:	c3                   	ret
+            return res;
+  802a4c:	48 98                	cltq
+  802a4e:	eb ed                	jmp    802a3d <devfile_write_direct+0xea>
+
+0000000000802a50 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802a50:	55                   	push   %rbp
+  802a51:	48 89 e5             	mov    %rsp,%rbp
+  802a54:	41 54                	push   %r12
+  802a56:	53                   	push   %rbx
+  802a57:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802a5a:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802a61:	00 00 00 
+  802a64:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802a66:	48 85 c0             	test   %rax,%rax
+  802a69:	74 71                	je     802adc <fbuf_flush+0x8c>
+  802a6b:	48 89 c3             	mov    %rax,%rbx
+  802a6e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a73:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802a77:	75 05                	jne    802a7e <fbuf_flush+0x2e>
+}
+  802a79:	5b                   	pop    %rbx
+  802a7a:	41 5c                	pop    %r12
+  802a7c:	5d                   	pop    %rbp
+  802a7d:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802a7e:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802a81:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802a85:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802a8c:	00 00 00 
+  802a8f:	48 89 de             	mov    %rbx,%rsi
+  802a92:	48 29 c6             	sub    %rax,%rsi
+  802a95:	48 c1 fe 03          	sar    $0x3,%rsi
+  802a99:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802aa0:	aa aa aa 
+  802aa3:	48 0f af f0          	imul   %rax,%rsi
+  802aa7:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802aab:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ab0:	48 01 c6             	add    %rax,%rsi
+  802ab3:	4c 89 e7             	mov    %r12,%rdi
+  802ab6:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802ac2:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802ac6:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802acd:	00 
+    return res < 0 ? res : 0;
+  802ace:	48 85 c0             	test   %rax,%rax
+  802ad1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ad6:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802ada:	eb 9d                	jmp    802a79 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ae1:	eb 96                	jmp    802a79 <fbuf_flush+0x29>
+
+0000000000802ae3 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802ae3:	55                   	push   %rbp
+  802ae4:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802ae7:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  802aee:	00 00 00 
+  802af1:	ff d0                	call   *%rax
+}
+  802af3:	5d                   	pop    %rbp
+  802af4:	c3                   	ret
+
+0000000000802af5 <devfile_write>:
+    if (!fd || !buf)
+  802af5:	48 85 ff             	test   %rdi,%rdi
+  802af8:	0f 84 d3 01 00 00    	je     802cd1 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+  802b02:	41 57                	push   %r15
+  802b04:	41 56                	push   %r14
+  802b06:	41 55                	push   %r13
+  802b08:	41 54                	push   %r12
+  802b0a:	53                   	push   %rbx
+  802b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b0f:	49 89 fc             	mov    %rdi,%r12
+  802b12:	49 89 f6             	mov    %rsi,%r14
+  802b15:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802b18:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b1d:	48 85 f6             	test   %rsi,%rsi
+  802b20:	0f 84 9c 01 00 00    	je     802cc2 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802b26:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+  802b32:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802b35:	48 85 c0             	test   %rax,%rax
+  802b38:	0f 84 a2 00 00 00    	je     802be0 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b3e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b43:	4c 89 e7             	mov    %r12,%rdi
+  802b46:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  802b4d:	00 00 00 
+  802b50:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802b52:	83 f8 02             	cmp    $0x2,%eax
+  802b55:	0f 8f 85 00 00 00    	jg     802be0 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802b5b:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802b62:	00 00 00 
+  802b65:	4d 89 ef             	mov    %r13,%r15
+  802b68:	49 29 c7             	sub    %rax,%r15
+  802b6b:	49 c1 ff 03          	sar    $0x3,%r15
+  802b6f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b76:	aa aa aa 
+  802b79:	4c 0f af f8          	imul   %rax,%r15
+  802b7d:	49 c1 e7 0e          	shl    $0xe,%r15
+  802b81:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b86:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802b89:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b8e:	0f 84 d7 00 00 00    	je     802c6b <devfile_write+0x176>
+  802b94:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802b98:	89 c2                	mov    %eax,%edx
+  802b9a:	41 03 55 0c          	add    0xc(%r13),%edx
+  802b9e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802ba3:	75 0f                	jne    802bb4 <devfile_write+0xbf>
+  802ba5:	48 01 d8             	add    %rbx,%rax
+  802ba8:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802bae:	0f 86 92 00 00 00    	jbe    802c46 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802bb4:	4c 89 e7             	mov    %r12,%rdi
+  802bb7:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  802bbe:	00 00 00 
+  802bc1:	ff d0                	call   *%rax
+  802bc3:	85 c0                	test   %eax,%eax
+  802bc5:	78 52                	js     802c19 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bc7:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bce:	77 7f                	ja     802c4f <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802bd0:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802bd5:	0f 85 c2 00 00 00    	jne    802c9d <devfile_write+0x1a8>
+  802bdb:	e9 94 00 00 00       	jmp    802c74 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802be0:	4c 89 e7             	mov    %r12,%rdi
+  802be3:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  802bea:	00 00 00 
+  802bed:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bef:	85 c0                	test   %eax,%eax
+  802bf1:	79 07                	jns    802bfa <devfile_write+0x105>
+  802bf3:	48 98                	cltq
+  802bf5:	e9 c8 00 00 00       	jmp    802cc2 <devfile_write+0x1cd>
+  802bfa:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802bff:	48 89 da             	mov    %rbx,%rdx
+  802c02:	4c 89 f6             	mov    %r14,%rsi
+  802c05:	4c 89 e7             	mov    %r12,%rdi
+  802c08:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	e9 a9 00 00 00       	jmp    802cc2 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c19:	48 98                	cltq
+  802c1b:	e9 a2 00 00 00       	jmp    802cc2 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c20:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c25:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c2a:	4c 89 fe             	mov    %r15,%rsi
+  802c2d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c32:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  802c39:	00 00 00 
+  802c3c:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802c3e:	85 c0                	test   %eax,%eax
+  802c40:	79 45                	jns    802c87 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c42:	48 98                	cltq
+  802c44:	eb 7c                	jmp    802cc2 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c46:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c4d:	76 4e                	jbe    802c9d <devfile_write+0x1a8>
+  802c4f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c54:	48 89 da             	mov    %rbx,%rdx
+  802c57:	4c 89 f6             	mov    %r14,%rsi
+  802c5a:	4c 89 e7             	mov    %r12,%rdi
+  802c5d:	48 b8 53 29 80 00 00 	movabs $0x802953,%rax
+  802c64:	00 00 00 
+  802c67:	ff d0                	call   *%rax
+  802c69:	eb 57                	jmp    802cc2 <devfile_write+0x1cd>
+  802c6b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c72:	77 db                	ja     802c4f <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802c74:	4c 89 ff             	mov    %r15,%rdi
+  802c77:	48 b8 1d 43 80 00 00 	movabs $0x80431d,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+  802c83:	84 c0                	test   %al,%al
+  802c85:	74 99                	je     802c20 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802c87:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802c8c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c91:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802c95:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802c9c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802c9d:	4c 89 ff             	mov    %r15,%rdi
+  802ca0:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802ca4:	48 89 da             	mov    %rbx,%rdx
+  802ca7:	4c 89 f6             	mov    %r14,%rsi
+  802caa:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  802cb1:	00 00 00 
+  802cb4:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802cb6:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802cba:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802cbf:	48 89 d8             	mov    %rbx,%rax
+}
+  802cc2:	48 83 c4 08          	add    $0x8,%rsp
+  802cc6:	5b                   	pop    %rbx
+  802cc7:	41 5c                	pop    %r12
+  802cc9:	41 5d                	pop    %r13
+  802ccb:	41 5e                	pop    %r14
+  802ccd:	41 5f                	pop    %r15
+  802ccf:	5d                   	pop    %rbp
+  802cd0:	c3                   	ret
+        return E_INVAL;
+  802cd1:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802cd6:	c3                   	ret
+
+0000000000802cd7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802cd7:	55                   	push   %rbp
+  802cd8:	48 89 e5             	mov    %rsp,%rbp
+  802cdb:	41 54                	push   %r12
+  802cdd:	53                   	push   %rbx
+  802cde:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802ce1:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  802ce8:	00 00 00 
+  802ceb:	ff d0                	call   *%rax
+  802ced:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802cf0:	48 89 df             	mov    %rbx,%rdi
+  802cf3:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802cfa:	00 00 00 
+  802cfd:	ff d0                	call   *%rax
+  802cff:	48 85 c0             	test   %rax,%rax
+  802d02:	74 17                	je     802d1b <devfile_flush+0x44>
+  802d04:	48 89 df             	mov    %rbx,%rdi
+  802d07:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802d0e:	00 00 00 
+  802d11:	ff d0                	call   *%rax
+  802d13:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802d1a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d1b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d1e:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  802d25:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802d27:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d2c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d31:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d36:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  802d3d:	00 00 00 
+  802d40:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d42:	45 85 e4             	test   %r12d,%r12d
+  802d45:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d49:	5b                   	pop    %rbx
+  802d4a:	41 5c                	pop    %r12
+  802d4c:	5d                   	pop    %rbp
+  802d4d:	c3                   	ret
+
+0000000000802d4e <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802d4e:	55                   	push   %rbp
+  802d4f:	48 89 e5             	mov    %rsp,%rbp
+  802d52:	41 57                	push   %r15
+  802d54:	41 56                	push   %r14
+  802d56:	41 55                	push   %r13
+  802d58:	41 54                	push   %r12
+  802d5a:	53                   	push   %rbx
+  802d5b:	48 83 ec 38          	sub    $0x38,%rsp
+  802d5f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802d63:	49 89 f7             	mov    %rsi,%r15
+  802d66:	48 89 d3             	mov    %rdx,%rbx
+  802d69:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802d6c:	48 b8 99 22 80 00 00 	movabs $0x802299,%rax
+  802d73:	00 00 00 
+  802d76:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d78:	48 85 c0             	test   %rax,%rax
+  802d7b:	75 20                	jne    802d9d <devfile_read_direct+0x4f>
+    bool map = 1;
+  802d7d:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802d82:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802d89:	00 
+    while (n) {
+  802d8a:	48 85 db             	test   %rbx,%rbx
+  802d8d:	0f 85 df 00 00 00    	jne    802e72 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802d93:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802d97:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d9b:	eb 21                	jmp    802dbe <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d9d:	45 89 f1             	mov    %r14d,%r9d
+  802da0:	49 89 d8             	mov    %rbx,%r8
+  802da3:	4c 89 f9             	mov    %r15,%rcx
+  802da6:	ba 03 00 00 00       	mov    $0x3,%edx
+  802dab:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802daf:	48 89 c7             	mov    %rax,%rdi
+  802db2:	48 b8 80 23 80 00 00 	movabs $0x802380,%rax
+  802db9:	00 00 00 
+  802dbc:	ff d0                	call   *%rax
+}
+  802dbe:	48 83 c4 38          	add    $0x38,%rsp
+  802dc2:	5b                   	pop    %rbx
+  802dc3:	41 5c                	pop    %r12
+  802dc5:	41 5d                	pop    %r13
+  802dc7:	41 5e                	pop    %r14
+  802dc9:	41 5f                	pop    %r15
+  802dcb:	5d                   	pop    %rbp
+  802dcc:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802dcd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802dd1:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802dd7:	75 1e                	jne    802df7 <devfile_read_direct+0xa9>
+  802dd9:	e9 e2 00 00 00       	jmp    802ec0 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802dde:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802de2:	eb da                	jmp    802dbe <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802de4:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802de8:	0f 85 d0 01 00 00    	jne    802fbe <devfile_read_direct+0x270>
+            map = 0;
+  802dee:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802df2:	eb 03                	jmp    802df7 <devfile_read_direct+0xa9>
+  802df4:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802df7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802dfc:	48 39 d3             	cmp    %rdx,%rbx
+  802dff:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e03:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e07:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e0a:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  802e11:	00 00 00 
+  802e14:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802e16:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802e1a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802e1e:	be 00 00 00 00       	mov    $0x0,%esi
+  802e23:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e28:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  802e2f:	00 00 00 
+  802e32:	ff d0                	call   *%rax
+        if (res <= 0)
+  802e34:	85 c0                	test   %eax,%eax
+  802e36:	0f 8e 63 01 00 00    	jle    802f9f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802e3c:	4c 63 e0             	movslq %eax,%r12
+  802e3f:	4c 89 e2             	mov    %r12,%rdx
+  802e42:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  802e49:	00 00 00 
+  802e4c:	4c 89 ff             	mov    %r15,%rdi
+  802e4f:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  802e56:	00 00 00 
+  802e59:	ff d0                	call   *%rax
+        buf += res;
+  802e5b:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802e5e:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802e61:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802e65:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802e69:	48 85 db             	test   %rbx,%rbx
+  802e6c:	0f 84 25 ff ff ff    	je     802d97 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802e72:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802e75:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802e79:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802e7d:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e81:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802e88:	0f 97 c2             	seta   %dl
+  802e8b:	20 c2                	and    %al,%dl
+  802e8d:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802e90:	0f 84 5e ff ff ff    	je     802df4 <devfile_read_direct+0xa6>
+  802e96:	4c 89 fa             	mov    %r15,%rdx
+  802e99:	4d 89 fd             	mov    %r15,%r13
+  802e9c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ea3:	0f 85 4e ff ff ff    	jne    802df7 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ea9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802ead:	0f 84 1a ff ff ff    	je     802dcd <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802eb3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802eba:	0f 85 37 ff ff ff    	jne    802df7 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802ec0:	48 89 d8             	mov    %rbx,%rax
+  802ec3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ec9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802ece:	48 39 c8             	cmp    %rcx,%rax
+  802ed1:	48 0f 47 c1          	cmova  %rcx,%rax
+  802ed5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ed9:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802edd:	49 89 d4             	mov    %rdx,%r12
+  802ee0:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802ee4:	48 b8 be 42 80 00 00 	movabs $0x8042be,%rax
+  802eeb:	00 00 00 
+  802eee:	ff d0                	call   *%rax
+  802ef0:	a8 40                	test   $0x40,%al
+  802ef2:	0f 85 b9 00 00 00    	jne    802fb1 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802ef8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802eff:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f03:	49 39 c5             	cmp    %rax,%r13
+  802f06:	72 d8                	jb     802ee0 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f08:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f0c:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802f13:	00 00 00 
+  802f16:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f1a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802f1d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802f1f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802f23:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802f27:	48 b8 34 21 80 00 00 	movabs $0x802134,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+  802f33:	89 c7                	mov    %eax,%edi
+  802f35:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f3b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f40:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  802f47:	00 00 00 
+  802f4a:	be 0e 00 00 00       	mov    $0xe,%esi
+  802f4f:	48 b8 cb 4b 80 00 00 	movabs $0x804bcb,%rax
+  802f56:	00 00 00 
+  802f59:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802f5b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f60:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f64:	4c 89 fe             	mov    %r15,%rsi
+  802f67:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f6c:	48 b8 a7 4b 80 00 00 	movabs $0x804ba7,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+  802f78:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802f7b:	48 85 d2             	test   %rdx,%rdx
+  802f7e:	0f 84 5a fe ff ff    	je     802dde <devfile_read_direct+0x90>
+            if (res > 0) {
+  802f84:	0f 8e 5a fe ff ff    	jle    802de4 <devfile_read_direct+0x96>
+                buf += res;
+  802f8a:	48 98                	cltq
+  802f8c:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802f8f:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802f92:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802f96:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802f9a:	e9 ca fe ff ff       	jmp    802e69 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802f9f:	41 89 c5             	mov    %eax,%r13d
+  802fa2:	48 98                	cltq
+  802fa4:	45 85 ed             	test   %r13d,%r13d
+  802fa7:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802fac:	e9 0d fe ff ff       	jmp    802dbe <devfile_read_direct+0x70>
+            map = 0;
+  802fb1:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802fb5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802fb9:	e9 39 fe ff ff       	jmp    802df7 <devfile_read_direct+0xa9>
+  802fbe:	48 89 d0             	mov    %rdx,%rax
+  802fc1:	e9 f8 fd ff ff       	jmp    802dbe <devfile_read_direct+0x70>
+
+0000000000802fc6 <devfile_read>:
+    if (!fd || !buf)
+  802fc6:	48 85 ff             	test   %rdi,%rdi
+  802fc9:	0f 84 21 02 00 00    	je     8031f0 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fcf:	55                   	push   %rbp
+  802fd0:	48 89 e5             	mov    %rsp,%rbp
+  802fd3:	41 57                	push   %r15
+  802fd5:	41 56                	push   %r14
+  802fd7:	41 55                	push   %r13
+  802fd9:	41 54                	push   %r12
+  802fdb:	53                   	push   %rbx
+  802fdc:	48 83 ec 28          	sub    $0x28,%rsp
+  802fe0:	48 89 fb             	mov    %rdi,%rbx
+  802fe3:	49 89 f4             	mov    %rsi,%r12
+  802fe6:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802fe9:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802fee:	48 85 f6             	test   %rsi,%rsi
+  802ff1:	74 4b                	je     80303e <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ff3:	48 b8 03 23 80 00 00 	movabs $0x802303,%rax
+  802ffa:	00 00 00 
+  802ffd:	ff d0                	call   *%rax
+  802fff:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803002:	48 85 c0             	test   %rax,%rax
+  803005:	74 22                	je     803029 <devfile_read+0x63>
+  803007:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80300e:	77 19                	ja     803029 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803010:	be 00 10 00 00       	mov    $0x1000,%esi
+  803015:	48 89 df             	mov    %rbx,%rdi
+  803018:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803024:	83 f8 02             	cmp    $0x2,%eax
+  803027:	7e 40                	jle    803069 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803029:	48 89 df             	mov    %rbx,%rdi
+  80302c:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  803033:	00 00 00 
+  803036:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803038:	85 c0                	test   %eax,%eax
+  80303a:	79 11                	jns    80304d <devfile_read+0x87>
+  80303c:	48 98                	cltq
+}
+  80303e:	48 83 c4 28          	add    $0x28,%rsp
+  803042:	5b                   	pop    %rbx
+  803043:	41 5c                	pop    %r12
+  803045:	41 5d                	pop    %r13
+  803047:	41 5e                	pop    %r14
+  803049:	41 5f                	pop    %r15
+  80304b:	5d                   	pop    %rbp
+  80304c:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80304d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803052:	4c 89 ea             	mov    %r13,%rdx
+  803055:	4c 89 e6             	mov    %r12,%rsi
+  803058:	48 89 df             	mov    %rbx,%rdi
+  80305b:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  803062:	00 00 00 
+  803065:	ff d0                	call   *%rax
+  803067:	eb d5                	jmp    80303e <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803069:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80306d:	48 89 df             	mov    %rbx,%rdi
+  803070:	48 b8 50 2a 80 00 00 	movabs $0x802a50,%rax
+  803077:	00 00 00 
+  80307a:	ff d0                	call   *%rax
+  80307c:	85 c0                	test   %eax,%eax
+  80307e:	0f 88 33 01 00 00    	js     8031b7 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803084:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  80308b:	00 00 00 
+  80308e:	4c 89 f0             	mov    %r14,%rax
+  803091:	48 29 d0             	sub    %rdx,%rax
+  803094:	48 c1 f8 03          	sar    $0x3,%rax
+  803098:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80309f:	aa aa aa 
+  8030a2:	48 0f af c2          	imul   %rdx,%rax
+  8030a6:	48 c1 e0 0e          	shl    $0xe,%rax
+  8030aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030ae:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030b1:	41 39 06             	cmp    %eax,(%r14)
+  8030b4:	75 0d                	jne    8030c3 <devfile_read+0xfd>
+  8030b6:	8b 43 10             	mov    0x10(%rbx),%eax
+  8030b9:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8030bd:	0f 84 fb 00 00 00    	je     8031be <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8030c3:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030c8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030cc:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8030cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030d3:	48 89 c7             	mov    %rax,%rdi
+  8030d6:	48 b8 1d 43 80 00 00 	movabs $0x80431d,%rax
+  8030dd:	00 00 00 
+  8030e0:	ff d0                	call   *%rax
+  8030e2:	84 c0                	test   %al,%al
+  8030e4:	75 27                	jne    80310d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030e6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8030eb:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8030f0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8030f9:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803105:	85 c0                	test   %eax,%eax
+  803107:	0f 88 dc 00 00 00    	js     8031e9 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80310d:	44 89 f8             	mov    %r15d,%eax
+  803110:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803115:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803117:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80311e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80311f:	8b 43 10             	mov    0x10(%rbx),%eax
+  803122:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803126:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803129:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80312e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803132:	48 89 df             	mov    %rbx,%rdi
+  803135:	48 b8 4e 2d 80 00 00 	movabs $0x802d4e,%rax
+  80313c:	00 00 00 
+  80313f:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803141:	48 85 c0             	test   %rax,%rax
+  803144:	0f 88 f4 fe ff ff    	js     80303e <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80314a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80314d:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803150:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803153:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803157:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80315b:	48 63 d1             	movslq %ecx,%rdx
+  80315e:	48 01 d0             	add    %rdx,%rax
+  803161:	4d 63 ff             	movslq %r15d,%r15
+  803164:	4c 29 f8             	sub    %r15,%rax
+  803167:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316c:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803170:	48 85 c0             	test   %rax,%rax
+  803173:	0f 8e c5 fe ff ff    	jle    80303e <devfile_read+0x78>
+    n = MIN(n, res);
+  803179:	4c 39 e8             	cmp    %r13,%rax
+  80317c:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803180:	8b 73 04             	mov    0x4(%rbx),%esi
+  803183:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803187:	48 63 f6             	movslq %esi,%rsi
+  80318a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80318f:	48 01 c6             	add    %rax,%rsi
+  803192:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803196:	48 01 c6             	add    %rax,%rsi
+  803199:	4c 89 ea             	mov    %r13,%rdx
+  80319c:	4c 89 e7             	mov    %r12,%rdi
+  80319f:	48 b8 b1 11 80 00 00 	movabs $0x8011b1,%rax
+  8031a6:	00 00 00 
+  8031a9:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8031ab:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8031af:	4c 89 e8             	mov    %r13,%rax
+  8031b2:	e9 87 fe ff ff       	jmp    80303e <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8031b7:	48 98                	cltq
+  8031b9:	e9 80 fe ff ff       	jmp    80303e <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031be:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8031c2:	41 39 d7             	cmp    %edx,%r15d
+  8031c5:	0f 8c f8 fe ff ff    	jl     8030c3 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031cb:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8031cf:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8031d2:	41 39 cf             	cmp    %ecx,%r15d
+  8031d5:	0f 8d e8 fe ff ff    	jge    8030c3 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8031db:	4d 63 ff             	movslq %r15d,%r15
+  8031de:	4c 29 f8             	sub    %r15,%rax
+  8031e1:	48 63 d2             	movslq %edx,%rdx
+  8031e4:	48 01 d0             	add    %rdx,%rax
+  8031e7:	eb 87                	jmp    803170 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8031e9:	48 98                	cltq
+  8031eb:	e9 4e fe ff ff       	jmp    80303e <devfile_read+0x78>
+        return E_INVAL;
+  8031f0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8031f5:	c3                   	ret
+
+00000000008031f6 <fs_channel>:
+fs_channel(bool enable) {
+  8031f6:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8031f8:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  8031ff:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803201:	ba 00 00 00 00       	mov    $0x0,%edx
+  803206:	40 84 ff             	test   %dil,%dil
+  803209:	74 47                	je     803252 <fs_channel+0x5c>
+  80320b:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  803212:	00 00 00 
+  803215:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80321b:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  803222:	00 00 00 
+  803225:	3b 08                	cmp    (%rax),%ecx
+  803227:	74 29                	je     803252 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803229:	55                   	push   %rbp
+  80322a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80322d:	48 b8 76 21 80 00 00 	movabs $0x802176,%rax
+  803234:	00 00 00 
+  803237:	ff d0                	call   *%rax
+  803239:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80323b:	85 c0                	test   %eax,%eax
+  80323d:	78 04                	js     803243 <fs_channel+0x4d>
+}
+  80323f:	89 d0                	mov    %edx,%eax
+  803241:	5d                   	pop    %rbp
+  803242:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803243:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  80324a:	00 00 00 
+  80324d:	c6 00 00             	movb   $0x0,(%rax)
+  803250:	eb ed                	jmp    80323f <fs_channel+0x49>
+}
+  803252:	89 d0                	mov    %edx,%eax
+  803254:	c3                   	ret
+
+0000000000803255 <open>:
+open(const char *path, int mode) {
+  803255:	55                   	push   %rbp
+  803256:	48 89 e5             	mov    %rsp,%rbp
+  803259:	41 55                	push   %r13
+  80325b:	41 54                	push   %r12
+  80325d:	53                   	push   %rbx
+  80325e:	48 83 ec 18          	sub    $0x18,%rsp
+  803262:	49 89 fc             	mov    %rdi,%r12
+  803265:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803268:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  80326f:	00 00 00 
+  803272:	ff d0                	call   *%rax
+  803274:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80327a:	0f 87 8f 00 00 00    	ja     80330f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803280:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803284:	48 b8 30 1a 80 00 00 	movabs $0x801a30,%rax
+  80328b:	00 00 00 
+  80328e:	ff d0                	call   *%rax
+  803290:	89 c3                	mov    %eax,%ebx
+  803292:	85 c0                	test   %eax,%eax
+  803294:	78 55                	js     8032eb <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803296:	4c 89 e6             	mov    %r12,%rsi
+  803299:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  8032a0:	00 00 00 
+  8032a3:	48 89 df             	mov    %rbx,%rdi
+  8032a6:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  8032ad:	00 00 00 
+  8032b0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032b2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8032b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032be:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032c2:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032c7:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8032ce:	00 00 00 
+  8032d1:	ff d0                	call   *%rax
+  8032d3:	89 c3                	mov    %eax,%ebx
+  8032d5:	85 c0                	test   %eax,%eax
+  8032d7:	78 1f                	js     8032f8 <open+0xa3>
+    return fd2num(fd);
+  8032d9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032dd:	48 b8 02 1a 80 00 00 	movabs $0x801a02,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+  8032e9:	89 c3                	mov    %eax,%ebx
+}
+  8032eb:	89 d8                	mov    %ebx,%eax
+  8032ed:	48 83 c4 18          	add    $0x18,%rsp
+  8032f1:	5b                   	pop    %rbx
+  8032f2:	41 5c                	pop    %r12
+  8032f4:	41 5d                	pop    %r13
+  8032f6:	5d                   	pop    %rbp
+  8032f7:	c3                   	ret
+        fd_close(fd, 0);
+  8032f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032fd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803301:	48 b8 4b 1b 80 00 00 	movabs $0x801b4b,%rax
+  803308:	00 00 00 
+  80330b:	ff d0                	call   *%rax
+        return res;
+  80330d:	eb dc                	jmp    8032eb <open+0x96>
+        return -E_BAD_PATH;
+  80330f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803314:	eb d5                	jmp    8032eb <open+0x96>
+
+0000000000803316 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803316:	55                   	push   %rbp
+  803317:	48 89 e5             	mov    %rsp,%rbp
+  80331a:	41 56                	push   %r14
+  80331c:	41 55                	push   %r13
+  80331e:	41 54                	push   %r12
+  803320:	53                   	push   %rbx
+  803321:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803325:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  80332c:	00 00 00 
+  80332f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803334:	49 bd 90 1a 80 00 00 	movabs $0x801a90,%r13
+  80333b:	00 00 00 
+  80333e:	49 be 50 2a 80 00 00 	movabs $0x802a50,%r14
+  803345:	00 00 00 
+  803348:	eb 0c                	jmp    803356 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80334a:	83 c3 01             	add    $0x1,%ebx
+  80334d:	49 83 c4 18          	add    $0x18,%r12
+  803351:	83 fb 20             	cmp    $0x20,%ebx
+  803354:	74 1d                	je     803373 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803356:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80335b:	74 ed                	je     80334a <file_flush_buffers+0x34>
+  80335d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803361:	89 df                	mov    %ebx,%edi
+  803363:	41 ff d5             	call   *%r13
+  803366:	85 c0                	test   %eax,%eax
+  803368:	78 e0                	js     80334a <file_flush_buffers+0x34>
+  80336a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80336e:	41 ff d6             	call   *%r14
+  803371:	eb d7                	jmp    80334a <file_flush_buffers+0x34>
+}
+  803373:	48 83 c4 10          	add    $0x10,%rsp
+  803377:	5b                   	pop    %rbx
+  803378:	41 5c                	pop    %r12
+  80337a:	41 5d                	pop    %r13
+  80337c:	41 5e                	pop    %r14
+  80337e:	5d                   	pop    %rbp
+  80337f:	c3                   	ret
+
+0000000000803380 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803380:	55                   	push   %rbp
+  803381:	48 89 e5             	mov    %rsp,%rbp
+  803384:	41 54                	push   %r12
+  803386:	53                   	push   %rbx
+  803387:	49 89 fc             	mov    %rdi,%r12
+  80338a:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80338c:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  803393:	00 00 00 
+  803396:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803398:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80339f:	00 00 00 
+  8033a2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8033a7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8033a9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8033ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8033bb:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8033c2:	00 00 00 
+  8033c5:	ff d0                	call   *%rax
+}
+  8033c7:	5b                   	pop    %rbx
+  8033c8:	41 5c                	pop    %r12
+  8033ca:	5d                   	pop    %rbp
+  8033cb:	c3                   	ret
+
+00000000008033cc <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8033cc:	55                   	push   %rbp
+  8033cd:	48 89 e5             	mov    %rsp,%rbp
+  8033d0:	41 54                	push   %r12
+  8033d2:	53                   	push   %rbx
+  8033d3:	49 89 fc             	mov    %rdi,%r12
+  8033d6:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8033d9:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  8033e0:	00 00 00 
+  8033e3:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8033e5:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8033ea:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8033f1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8033f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033f8:	be 00 00 00 00       	mov    $0x0,%esi
+  8033fd:	bf 05 00 00 00       	mov    $0x5,%edi
+  803402:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  803409:	00 00 00 
+  80340c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80340e:	85 c0                	test   %eax,%eax
+  803410:	78 3d                	js     80344f <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803412:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  803419:	00 00 00 
+  80341c:	4c 89 e6             	mov    %r12,%rsi
+  80341f:	48 89 df             	mov    %rbx,%rdi
+  803422:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  803429:	00 00 00 
+  80342c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80342e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803435:	00 
+  803436:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80343c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803443:	00 
+  803444:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80344a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80344f:	5b                   	pop    %rbx
+  803450:	41 5c                	pop    %r12
+  803452:	5d                   	pop    %rbp
+  803453:	c3                   	ret
+
+0000000000803454 <remove>:
+remove(const char *path) {
+  803454:	55                   	push   %rbp
+  803455:	48 89 e5             	mov    %rsp,%rbp
+  803458:	53                   	push   %rbx
+  803459:	48 83 ec 08          	sub    $0x8,%rsp
+  80345d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803460:	48 b8 12 0f 80 00 00 	movabs $0x800f12,%rax
+  803467:	00 00 00 
+  80346a:	ff d0                	call   *%rax
+  80346c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803472:	77 3a                	ja     8034ae <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803474:	48 89 de             	mov    %rbx,%rsi
+  803477:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  80347e:	00 00 00 
+  803481:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  803488:	00 00 00 
+  80348b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80348d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803492:	be 00 00 00 00       	mov    $0x0,%esi
+  803497:	bf 07 00 00 00       	mov    $0x7,%edi
+  80349c:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8034a3:	00 00 00 
+  8034a6:	ff d0                	call   *%rax
+}
+  8034a8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034ac:	c9                   	leave
+  8034ad:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034ae:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034b3:	eb f3                	jmp    8034a8 <remove+0x54>
+
+00000000008034b5 <sync>:
+sync(void) {
+  8034b5:	55                   	push   %rbp
+  8034b6:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8034b9:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  8034c0:	00 00 00 
+  8034c3:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8034c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8034cf:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034d4:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8034db:	00 00 00 
+  8034de:	ff d0                	call   *%rax
+}
+  8034e0:	5d                   	pop    %rbp
+  8034e1:	c3                   	ret
+
+00000000008034e2 <fsync>:
+fsync(int fdnum) {
+  8034e2:	55                   	push   %rbp
+  8034e3:	48 89 e5             	mov    %rsp,%rbp
+  8034e6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8034ea:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8034ee:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  8034f5:	00 00 00 
+  8034f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034fa:	85 c0                	test   %eax,%eax
+  8034fc:	78 4b                	js     803549 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034fe:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803502:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803509:	00 00 00 
+  80350c:	8b 00                	mov    (%rax),%eax
+  80350e:	39 02                	cmp    %eax,(%rdx)
+  803510:	75 39                	jne    80354b <fsync+0x69>
+    file_flush_buffers();
+  803512:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  803519:	00 00 00 
+  80351c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80351e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803522:	8b 40 0c             	mov    0xc(%rax),%eax
+  803525:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  80352c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80352e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803533:	be 00 00 00 00       	mov    $0x0,%esi
+  803538:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80353d:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  803544:	00 00 00 
+  803547:	ff d0                	call   *%rax
+}
+  803549:	c9                   	leave
+  80354a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80354b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803550:	eb f7                	jmp    803549 <fsync+0x67>
+
+0000000000803552 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803552:	55                   	push   %rbp
+  803553:	48 89 e5             	mov    %rsp,%rbp
+  803556:	53                   	push   %rbx
+  803557:	48 83 ec 08          	sub    $0x8,%rsp
+  80355b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80355e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803563:	be 00 00 00 00       	mov    $0x0,%esi
+  803568:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80356d:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  803574:	00 00 00 
+  803577:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803579:	85 c0                	test   %eax,%eax
+  80357b:	78 2d                	js     8035aa <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80357d:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803584:	00 00 00 
+  803587:	48 8b 10             	mov    (%rax),%rdx
+  80358a:	48 89 13             	mov    %rdx,(%rbx)
+  80358d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803591:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803595:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803599:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80359d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035a1:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8035a5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035aa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035ae:	c9                   	leave
+  8035af:	c3                   	ret
+
+00000000008035b0 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8035b0:	55                   	push   %rbp
+  8035b1:	48 89 e5             	mov    %rsp,%rbp
+  8035b4:	53                   	push   %rbx
+  8035b5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035b9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8035bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c1:	be 00 00 00 00       	mov    $0x0,%esi
+  8035c6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8035cb:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8035d2:	00 00 00 
+  8035d5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	78 3d                	js     803618 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8035db:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  8035e2:	00 00 00 
+  8035e5:	48 8b 10             	mov    (%rax),%rdx
+  8035e8:	48 89 13             	mov    %rdx,(%rbx)
+  8035eb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035ef:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8035f3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8035f7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8035fb:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8035ff:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803603:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803607:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80360b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80360f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803613:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803618:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80361c:	c9                   	leave
+  80361d:	c3                   	ret
+
+000000000080361e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80361e:	55                   	push   %rbp
+  80361f:	48 89 e5             	mov    %rsp,%rbp
+  803622:	41 57                	push   %r15
+  803624:	41 56                	push   %r14
+  803626:	41 55                	push   %r13
+  803628:	41 54                	push   %r12
+  80362a:	53                   	push   %rbx
+  80362b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80362f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803636:	00 
+  803637:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80363e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803644:	0f 85 43 01 00 00    	jne    80378d <munmap+0x16f>
+  80364a:	49 89 ff             	mov    %rdi,%r15
+  80364d:	4c 39 f7             	cmp    %r14,%rdi
+  803650:	0f 87 37 01 00 00    	ja     80378d <munmap+0x16f>
+  803656:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  80365d:	00 00 00 
+  803660:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803666:	eb 2c                	jmp    803694 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803668:	4c 39 f8             	cmp    %r15,%rax
+  80366b:	0f 83 85 00 00 00    	jae    8036f6 <munmap+0xd8>
+            m->mm_end = start;
+  803671:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803676:	48 83 c3 18          	add    $0x18,%rbx
+  80367a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803681:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803688:	00 00 00 
+  80368b:	48 39 c3             	cmp    %rax,%rbx
+  80368e:	0f 84 d0 00 00 00    	je     803764 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803694:	49 89 dc             	mov    %rbx,%r12
+  803697:	48 8b 03             	mov    (%rbx),%rax
+  80369a:	4c 39 f0             	cmp    %r14,%rax
+  80369d:	73 d7                	jae    803676 <munmap+0x58>
+  80369f:	48 85 c0             	test   %rax,%rax
+  8036a2:	74 d2                	je     803676 <munmap+0x58>
+  8036a4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036a8:	49 39 d7             	cmp    %rdx,%r15
+  8036ab:	73 c9                	jae    803676 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8036ad:	49 39 d6             	cmp    %rdx,%r14
+  8036b0:	73 b6                	jae    803668 <munmap+0x4a>
+  8036b2:	49 39 c7             	cmp    %rax,%r15
+  8036b5:	76 b1                	jbe    803668 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8036b7:	4c 89 ef             	mov    %r13,%rdi
+  8036ba:	48 b8 55 27 80 00 00 	movabs $0x802755,%rax
+  8036c1:	00 00 00 
+  8036c4:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8036c6:	48 85 c0             	test   %rax,%rax
+  8036c9:	0f 84 c5 00 00 00    	je     803794 <munmap+0x176>
+            *tail = *m;
+  8036cf:	48 8b 13             	mov    (%rbx),%rdx
+  8036d2:	48 89 10             	mov    %rdx,(%rax)
+  8036d5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036d9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8036dd:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8036e1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8036e5:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8036e8:	44 89 f2             	mov    %r14d,%edx
+  8036eb:	2b 13                	sub    (%rbx),%edx
+  8036ed:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8036f0:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8036f4:	eb 80                	jmp    803676 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8036f6:	49 39 d6             	cmp    %rdx,%r14
+  8036f9:	73 18                	jae    803713 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8036fb:	44 89 f2             	mov    %r14d,%edx
+  8036fe:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803703:	29 c2                	sub    %eax,%edx
+  803705:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80370a:	4d 89 34 24          	mov    %r14,(%r12)
+  80370e:	e9 63 ff ff ff       	jmp    803676 <munmap+0x58>
+    m->mm_start = 0;
+  803713:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80371a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80371b:	4c 89 e6             	mov    %r12,%rsi
+  80371e:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  803725:	00 00 00 
+  803728:	48 29 c6             	sub    %rax,%rsi
+  80372b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80372f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803736:	aa aa aa 
+  803739:	48 0f af f0          	imul   %rax,%rsi
+  80373d:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803741:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803746:	48 01 c6             	add    %rax,%rsi
+  803749:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80374e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803753:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  80375a:	00 00 00 
+  80375d:	ff d0                	call   *%rax
+}
+  80375f:	e9 12 ff ff ff       	jmp    803676 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803764:	4c 89 f2             	mov    %r14,%rdx
+  803767:	4c 29 fa             	sub    %r15,%rdx
+  80376a:	4c 89 fe             	mov    %r15,%rsi
+  80376d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803772:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  803779:	00 00 00 
+  80377c:	ff d0                	call   *%rax
+}
+  80377e:	48 83 c4 08          	add    $0x8,%rsp
+  803782:	5b                   	pop    %rbx
+  803783:	41 5c                	pop    %r12
+  803785:	41 5d                	pop    %r13
+  803787:	41 5e                	pop    %r14
+  803789:	41 5f                	pop    %r15
+  80378b:	5d                   	pop    %rbp
+  80378c:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80378d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803792:	eb ea                	jmp    80377e <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803794:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803799:	eb e3                	jmp    80377e <munmap+0x160>
+
+000000000080379b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80379b:	55                   	push   %rbp
+  80379c:	48 89 e5             	mov    %rsp,%rbp
+  80379f:	41 57                	push   %r15
+  8037a1:	41 56                	push   %r14
+  8037a3:	41 55                	push   %r13
+  8037a5:	41 54                	push   %r12
+  8037a7:	53                   	push   %rbx
+  8037a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8037ac:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8037b0:	49 89 f5             	mov    %rsi,%r13
+  8037b3:	41 89 d6             	mov    %edx,%r14d
+  8037b6:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8037b9:	41 89 cc             	mov    %ecx,%r12d
+  8037bc:	44 89 c7             	mov    %r8d,%edi
+  8037bf:	44 89 cb             	mov    %r9d,%ebx
+  8037c2:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037c6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037ca:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  8037d1:	00 00 00 
+  8037d4:	ff d0                	call   *%rax
+  8037d6:	41 89 c7             	mov    %eax,%r15d
+  8037d9:	85 c0                	test   %eax,%eax
+  8037db:	0f 88 ae 01 00 00    	js     80398f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037e1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8037e5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8037ec:	00 00 00 
+  8037ef:	8b 32                	mov    (%rdx),%esi
+  8037f1:	39 30                	cmp    %esi,(%rax)
+  8037f3:	0f 85 7a 02 00 00    	jne    803a73 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8037f9:	8b 40 08             	mov    0x8(%rax),%eax
+  8037fc:	83 e0 03             	and    $0x3,%eax
+  8037ff:	83 f8 01             	cmp    $0x1,%eax
+  803802:	0f 84 76 02 00 00    	je     803a7e <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803808:	4d 85 ed             	test   %r13,%r13
+  80380b:	0f 84 78 02 00 00    	je     803a89 <mmap+0x2ee>
+  803811:	85 db                	test   %ebx,%ebx
+  803813:	0f 88 70 02 00 00    	js     803a89 <mmap+0x2ee>
+  803819:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80381f:	41 89 df             	mov    %ebx,%r15d
+  803822:	0f 85 6c 02 00 00    	jne    803a94 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803828:	44 89 f0             	mov    %r14d,%eax
+  80382b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80382e:	83 f8 04             	cmp    $0x4,%eax
+  803831:	0f 85 68 02 00 00    	jne    803a9f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803837:	44 89 e1             	mov    %r12d,%ecx
+  80383a:	83 e1 01             	and    $0x1,%ecx
+  80383d:	0f 95 c2             	setne  %dl
+  803840:	44 89 e0             	mov    %r12d,%eax
+  803843:	d1 e8                	shr    %eax
+  803845:	83 f0 01             	xor    $0x1,%eax
+  803848:	83 e0 01             	and    $0x1,%eax
+  80384b:	38 c2                	cmp    %al,%dl
+  80384d:	0f 85 57 02 00 00    	jne    803aaa <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803853:	85 c9                	test   %ecx,%ecx
+  803855:	74 0a                	je     803861 <mmap+0xc6>
+  803857:	41 f6 c6 02          	test   $0x2,%r14b
+  80385b:	0f 85 54 02 00 00    	jne    803ab5 <mmap+0x31a>
+    file_flush_buffers();
+  803861:	48 b8 16 33 80 00 00 	movabs $0x803316,%rax
+  803868:	00 00 00 
+  80386b:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80386d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803874:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80387b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80387f:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803882:	41 f6 c4 04          	test   $0x4,%r12b
+  803886:	0f 84 15 01 00 00    	je     8039a1 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80388c:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80388f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803895:	0f 85 25 02 00 00    	jne    803ac0 <mmap+0x325>
+  80389b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80389f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8038a6:	00 00 00 
+  8038a9:	48 39 c2             	cmp    %rax,%rdx
+  8038ac:	0f 82 19 02 00 00    	jb     803acb <mmap+0x330>
+  8038b2:	48 39 c7             	cmp    %rax,%rdi
+  8038b5:	0f 87 10 02 00 00    	ja     803acb <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8038bb:	4c 89 ee             	mov    %r13,%rsi
+  8038be:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  8038c5:	00 00 00 
+  8038c8:	ff d0                	call   *%rax
+  8038ca:	85 c0                	test   %eax,%eax
+  8038cc:	0f 88 04 02 00 00    	js     803ad6 <mmap+0x33b>
+    if (!handler) {
+  8038d2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8038d9:	00 00 00 
+  8038dc:	80 38 00             	cmpb   $0x0,(%rax)
+  8038df:	75 2b                	jne    80390c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038e1:	48 bf b6 26 80 00 00 	movabs $0x8026b6,%rdi
+  8038e8:	00 00 00 
+  8038eb:	48 b8 76 48 80 00 00 	movabs $0x804876,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+  8038f7:	85 c0                	test   %eax,%eax
+  8038f9:	0f 88 ea 01 00 00    	js     803ae9 <mmap+0x34e>
+        handler = 1;
+  8038ff:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803906:	00 00 00 
+  803909:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80390c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803910:	48 b8 55 27 80 00 00 	movabs $0x802755,%rax
+  803917:	00 00 00 
+  80391a:	ff d0                	call   *%rax
+  80391c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80391f:	48 85 c0             	test   %rax,%rax
+  803922:	0f 84 c9 01 00 00    	je     803af1 <mmap+0x356>
+    m->mm_start = va;
+  803928:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80392b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80392f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803933:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803936:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80393a:	44 89 e0             	mov    %r12d,%eax
+  80393d:	c1 e0 06             	shl    $0x6,%eax
+  803940:	25 80 00 00 00       	and    $0x80,%eax
+  803945:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803948:	09 f0                	or     %esi,%eax
+  80394a:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80394e:	41 f6 c4 08          	test   $0x8,%r12b
+  803952:	74 31                	je     803985 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803954:	48 39 d3             	cmp    %rdx,%rbx
+  803957:	73 2c                	jae    803985 <mmap+0x1ea>
+  803959:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80395e:	48 89 de             	mov    %rbx,%rsi
+  803961:	4c 89 f7             	mov    %r14,%rdi
+  803964:	48 b8 a5 25 80 00 00 	movabs $0x8025a5,%rax
+  80396b:	00 00 00 
+  80396e:	ff d0                	call   *%rax
+  803970:	49 89 c4             	mov    %rax,%r12
+  803973:	48 85 c0             	test   %rax,%rax
+  803976:	0f 8e d7 00 00 00    	jle    803a53 <mmap+0x2b8>
+            va += n;
+  80397c:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80397f:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803983:	72 d4                	jb     803959 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803985:	49 8b 06             	mov    (%r14),%rax
+  803988:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80398c:	48 89 06             	mov    %rax,(%rsi)
+}
+  80398f:	44 89 f8             	mov    %r15d,%eax
+  803992:	48 83 c4 28          	add    $0x28,%rsp
+  803996:	5b                   	pop    %rbx
+  803997:	41 5c                	pop    %r12
+  803999:	41 5d                	pop    %r13
+  80399b:	41 5e                	pop    %r14
+  80399d:	41 5f                	pop    %r15
+  80399f:	5d                   	pop    %rbp
+  8039a0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039a1:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8039a8:	00 00 00 
+  8039ab:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8039ae:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8039b5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039b8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039bd:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  8039c4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039c7:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8039ce:	00 00 00 
+  8039d1:	48 39 d7             	cmp    %rdx,%rdi
+  8039d4:	73 1c                	jae    8039f2 <mmap+0x257>
+        return -E_NO_MEM;
+  8039d6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039dc:	eb b1                	jmp    80398f <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039de:	48 83 c0 01          	add    $0x1,%rax
+  8039e2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8039e6:	77 3f                	ja     803a27 <mmap+0x28c>
+  8039e8:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8039ed:	48 39 d7             	cmp    %rdx,%rdi
+  8039f0:	72 2a                	jb     803a1c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039f2:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8039f6:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8039fa:	48 39 d1             	cmp    %rdx,%rcx
+  8039fd:	73 df                	jae    8039de <mmap+0x243>
+  8039ff:	48 85 c9             	test   %rcx,%rcx
+  803a02:	74 da                	je     8039de <mmap+0x243>
+  803a04:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a08:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a0d:	48 39 d3             	cmp    %rdx,%rbx
+  803a10:	73 cc                	jae    8039de <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803a12:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a1a:	eb cc                	jmp    8039e8 <mmap+0x24d>
+        return -E_NO_MEM;
+  803a1c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a22:	e9 68 ff ff ff       	jmp    80398f <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803a27:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803a2c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803a33:	00 00 00 
+  803a36:	48 39 c2             	cmp    %rax,%rdx
+  803a39:	0f 82 9f 00 00 00    	jb     803ade <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803a3f:	48 85 db             	test   %rbx,%rbx
+  803a42:	0f 85 8a fe ff ff    	jne    8038d2 <mmap+0x137>
+        return -E_NO_MEM;
+  803a48:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a4e:	e9 3c ff ff ff       	jmp    80398f <mmap+0x1f4>
+        if (n < 0) {
+  803a53:	0f 89 2c ff ff ff    	jns    803985 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803a59:	49 8b 3e             	mov    (%r14),%rdi
+  803a5c:	4c 89 ee             	mov    %r13,%rsi
+  803a5f:	48 b8 1e 36 80 00 00 	movabs $0x80361e,%rax
+  803a66:	00 00 00 
+  803a69:	ff d0                	call   *%rax
+            return n;
+  803a6b:	45 89 e7             	mov    %r12d,%r15d
+  803a6e:	e9 1c ff ff ff       	jmp    80398f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803a73:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a79:	e9 11 ff ff ff       	jmp    80398f <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803a7e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a84:	e9 06 ff ff ff       	jmp    80398f <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803a89:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a8f:	e9 fb fe ff ff       	jmp    80398f <mmap+0x1f4>
+  803a94:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a9a:	e9 f0 fe ff ff       	jmp    80398f <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803a9f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803aa5:	e9 e5 fe ff ff       	jmp    80398f <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803aaa:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ab0:	e9 da fe ff ff       	jmp    80398f <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803ab5:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803abb:	e9 cf fe ff ff       	jmp    80398f <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803ac0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ac6:	e9 c4 fe ff ff       	jmp    80398f <mmap+0x1f4>
+  803acb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ad1:	e9 b9 fe ff ff       	jmp    80398f <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803ad6:	41 89 c7             	mov    %eax,%r15d
+  803ad9:	e9 b1 fe ff ff       	jmp    80398f <mmap+0x1f4>
+        return -E_NO_MEM;
+  803ade:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ae4:	e9 a6 fe ff ff       	jmp    80398f <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803ae9:	41 89 c7             	mov    %eax,%r15d
+  803aec:	e9 9e fe ff ff       	jmp    80398f <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803af1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803af7:	e9 93 fe ff ff       	jmp    80398f <mmap+0x1f4>
+
+0000000000803afc <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803afc:	55                   	push   %rbp
+  803afd:	48 89 e5             	mov    %rsp,%rbp
+  803b00:	41 54                	push   %r12
+  803b02:	53                   	push   %rbx
+  803b03:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b06:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+  803b12:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b15:	48 be 20 54 80 00 00 	movabs $0x805420,%rsi
+  803b1c:	00 00 00 
+  803b1f:	48 89 df             	mov    %rbx,%rdi
+  803b22:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  803b29:	00 00 00 
+  803b2c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b2e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b33:	41 2b 04 24          	sub    (%r12),%eax
+  803b37:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b3d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b44:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b47:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b4e:	00 00 00 
+  803b51:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b58:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b5d:	5b                   	pop    %rbx
+  803b5e:	41 5c                	pop    %r12
+  803b60:	5d                   	pop    %rbp
+  803b61:	c3                   	ret
+
+0000000000803b62 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b62:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b65:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803b6b:	8b 17                	mov    (%rdi),%edx
+  803b6d:	85 d2                	test   %edx,%edx
+  803b6f:	75 01                	jne    803b72 <pipe_wakeup+0x10>
+  803b71:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b72:	55                   	push   %rbp
+  803b73:	48 89 e5             	mov    %rsp,%rbp
+  803b76:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803b79:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803b7f:	be 00 04 00 00       	mov    $0x400,%esi
+  803b84:	48 b8 3b 18 80 00 00 	movabs $0x80183b,%rax
+  803b8b:	00 00 00 
+  803b8e:	ff d0                	call   *%rax
+}
+  803b90:	5d                   	pop    %rbp
+  803b91:	c3                   	ret
+
+0000000000803b92 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b92:	55                   	push   %rbp
+  803b93:	48 89 e5             	mov    %rsp,%rbp
+  803b96:	41 55                	push   %r13
+  803b98:	41 54                	push   %r12
+  803b9a:	53                   	push   %rbx
+  803b9b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b9f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803ba2:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803ba9:	00 00 00 
+  803bac:	ff d0                	call   *%rax
+  803bae:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803bb1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bb6:	4c 89 e6             	mov    %r12,%rsi
+  803bb9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bbe:	49 bc 55 15 80 00 00 	movabs $0x801555,%r12
+  803bc5:	00 00 00 
+  803bc8:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803bcb:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803bcf:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803bd3:	49 bd 62 3b 80 00 00 	movabs $0x803b62,%r13
+  803bda:	00 00 00 
+  803bdd:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803be0:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803be4:	48 89 de             	mov    %rbx,%rsi
+  803be7:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803bea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bef:	48 89 de             	mov    %rbx,%rsi
+  803bf2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bf7:	41 ff d4             	call   *%r12
+  803bfa:	48 83 c4 08          	add    $0x8,%rsp
+  803bfe:	5b                   	pop    %rbx
+  803bff:	41 5c                	pop    %r12
+  803c01:	41 5d                	pop    %r13
+  803c03:	5d                   	pop    %rbp
+  803c04:	c3                   	ret
+
+0000000000803c05 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c05:	55                   	push   %rbp
+  803c06:	48 89 e5             	mov    %rsp,%rbp
+  803c09:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c0c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c11:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c16:	48 b8 98 14 80 00 00 	movabs $0x801498,%rax
+  803c1d:	00 00 00 
+  803c20:	ff d0                	call   *%rax
+  803c22:	85 c0                	test   %eax,%eax
+  803c24:	0f 94 c0             	sete   %al
+  803c27:	0f b6 c0             	movzbl %al,%eax
+}
+  803c2a:	5d                   	pop    %rbp
+  803c2b:	c3                   	ret
+
+0000000000803c2c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c2c:	55                   	push   %rbp
+  803c2d:	48 89 e5             	mov    %rsp,%rbp
+  803c30:	41 57                	push   %r15
+  803c32:	41 56                	push   %r14
+  803c34:	41 55                	push   %r13
+  803c36:	41 54                	push   %r12
+  803c38:	53                   	push   %rbx
+  803c39:	48 83 ec 38          	sub    $0x38,%rsp
+  803c3d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c41:	49 89 f4             	mov    %rsi,%r12
+  803c44:	49 89 d7             	mov    %rdx,%r15
+  803c47:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c4b:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803c52:	00 00 00 
+  803c55:	ff d0                	call   *%rax
+  803c57:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c5a:	4d 85 ff             	test   %r15,%r15
+  803c5d:	0f 84 f1 00 00 00    	je     803d54 <devpipe_write+0x128>
+  803c63:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803c67:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803c6b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803c6f:	49 bd 05 3c 80 00 00 	movabs $0x803c05,%r13
+  803c76:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c79:	49 bf 62 3b 80 00 00 	movabs $0x803b62,%r15
+  803c80:	00 00 00 
+  803c83:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c87:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c8b:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803c8f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c92:	48 63 ce             	movslq %esi,%rcx
+  803c95:	48 63 03             	movslq (%rbx),%rax
+  803c98:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803c9e:	48 39 c1             	cmp    %rax,%rcx
+  803ca1:	72 64                	jb     803d07 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ca3:	48 89 de             	mov    %rbx,%rsi
+  803ca6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803caa:	41 ff d5             	call   *%r13
+  803cad:	85 c0                	test   %eax,%eax
+  803caf:	0f 85 b9 00 00 00    	jne    803d6e <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cb5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cb9:	4c 89 f7             	mov    %r14,%rdi
+  803cbc:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803cbf:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cc2:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803cc9:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cd0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cd6:	8b 03                	mov    (%rbx),%eax
+  803cd8:	41 39 c4             	cmp    %eax,%r12d
+  803cdb:	75 b2                	jne    803c8f <devpipe_write+0x63>
+  803cdd:	48 89 de             	mov    %rbx,%rsi
+  803ce0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ce4:	41 ff d5             	call   *%r13
+  803ce7:	85 c0                	test   %eax,%eax
+  803ce9:	75 a0                	jne    803c8b <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803ceb:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cf0:	44 89 e6             	mov    %r12d,%esi
+  803cf3:	48 89 df             	mov    %rbx,%rdi
+  803cf6:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  803cfd:	00 00 00 
+  803d00:	ff d0                	call   *%rax
+  803d02:	e9 7c ff ff ff       	jmp    803c83 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d07:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803d0b:	41 0f b6 38          	movzbl (%r8),%edi
+  803d0f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d16:	80 80 80 
+  803d19:	48 89 c8             	mov    %rcx,%rax
+  803d1c:	48 f7 e2             	mul    %rdx
+  803d1f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d23:	48 89 d0             	mov    %rdx,%rax
+  803d26:	48 c1 e0 08          	shl    $0x8,%rax
+  803d2a:	48 29 d0             	sub    %rdx,%rax
+  803d2d:	48 c1 e0 04          	shl    $0x4,%rax
+  803d31:	48 29 c1             	sub    %rax,%rcx
+  803d34:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d39:	83 c6 01             	add    $0x1,%esi
+  803d3c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d3f:	49 83 c0 01          	add    $0x1,%r8
+  803d43:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803d47:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803d4b:	49 39 c0             	cmp    %rax,%r8
+  803d4e:	0f 85 2f ff ff ff    	jne    803c83 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d54:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803d58:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803d5c:	48 b8 62 3b 80 00 00 	movabs $0x803b62,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+    return n;
+  803d68:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803d6c:	eb 05                	jmp    803d73 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d6e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d73:	48 83 c4 38          	add    $0x38,%rsp
+  803d77:	5b                   	pop    %rbx
+  803d78:	41 5c                	pop    %r12
+  803d7a:	41 5d                	pop    %r13
+  803d7c:	41 5e                	pop    %r14
+  803d7e:	41 5f                	pop    %r15
+  803d80:	5d                   	pop    %rbp
+  803d81:	c3                   	ret
+
+0000000000803d82 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d82:	55                   	push   %rbp
+  803d83:	48 89 e5             	mov    %rsp,%rbp
+  803d86:	41 57                	push   %r15
+  803d88:	41 56                	push   %r14
+  803d8a:	41 55                	push   %r13
+  803d8c:	41 54                	push   %r12
+  803d8e:	53                   	push   %rbx
+  803d8f:	48 83 ec 28          	sub    $0x28,%rsp
+  803d93:	49 89 fd             	mov    %rdi,%r13
+  803d96:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803d9a:	49 89 d4             	mov    %rdx,%r12
+  803d9d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803da1:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803da8:	00 00 00 
+  803dab:	ff d0                	call   *%rax
+  803dad:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803db0:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803db6:	49 bf 05 3c 80 00 00 	movabs $0x803c05,%r15
+  803dbd:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803dc0:	4d 85 e4             	test   %r12,%r12
+  803dc3:	0f 84 d5 00 00 00    	je     803e9e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803dc9:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803dcd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803dd1:	8b 03                	mov    (%rbx),%eax
+  803dd3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803dd6:	75 7a                	jne    803e52 <devpipe_read+0xd0>
+            if (i > 0) {
+  803dd8:	4d 85 f6             	test   %r14,%r14
+  803ddb:	75 50                	jne    803e2d <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ddd:	48 89 de             	mov    %rbx,%rsi
+  803de0:	4c 89 ef             	mov    %r13,%rdi
+  803de3:	41 ff d7             	call   *%r15
+  803de6:	85 c0                	test   %eax,%eax
+  803de8:	0f 85 c9 00 00 00    	jne    803eb7 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803dee:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803df1:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803df8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803dfe:	8b 43 04             	mov    0x4(%rbx),%eax
+  803e01:	41 39 c4             	cmp    %eax,%r12d
+  803e04:	75 cb                	jne    803dd1 <devpipe_read+0x4f>
+  803e06:	48 89 de             	mov    %rbx,%rsi
+  803e09:	4c 89 ef             	mov    %r13,%rdi
+  803e0c:	41 ff d7             	call   *%r15
+  803e0f:	85 c0                	test   %eax,%eax
+  803e11:	75 be                	jne    803dd1 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803e13:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803e18:	44 89 e6             	mov    %r12d,%esi
+  803e1b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e1f:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  803e26:	00 00 00 
+  803e29:	ff d0                	call   *%rax
+  803e2b:	eb a4                	jmp    803dd1 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e2d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e31:	48 89 de             	mov    %rbx,%rsi
+  803e34:	48 b8 62 3b 80 00 00 	movabs $0x803b62,%rax
+  803e3b:	00 00 00 
+  803e3e:	ff d0                	call   *%rax
+                return i;
+  803e40:	4c 89 f0             	mov    %r14,%rax
+}
+  803e43:	48 83 c4 28          	add    $0x28,%rsp
+  803e47:	5b                   	pop    %rbx
+  803e48:	41 5c                	pop    %r12
+  803e4a:	41 5d                	pop    %r13
+  803e4c:	41 5e                	pop    %r14
+  803e4e:	41 5f                	pop    %r15
+  803e50:	5d                   	pop    %rbp
+  803e51:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e52:	48 63 c8             	movslq %eax,%rcx
+  803e55:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803e5c:	80 80 80 
+  803e5f:	48 89 c8             	mov    %rcx,%rax
+  803e62:	48 f7 e2             	mul    %rdx
+  803e65:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803e69:	48 89 d0             	mov    %rdx,%rax
+  803e6c:	48 c1 e0 08          	shl    $0x8,%rax
+  803e70:	48 29 d0             	sub    %rdx,%rax
+  803e73:	48 c1 e0 04          	shl    $0x4,%rax
+  803e77:	48 89 c2             	mov    %rax,%rdx
+  803e7a:	48 89 c8             	mov    %rcx,%rax
+  803e7d:	48 29 d0             	sub    %rdx,%rax
+  803e80:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803e85:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803e89:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803e8d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e90:	49 83 c6 01          	add    $0x1,%r14
+  803e94:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803e98:	0f 85 2b ff ff ff    	jne    803dc9 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e9e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ea2:	48 89 de             	mov    %rbx,%rsi
+  803ea5:	48 b8 62 3b 80 00 00 	movabs $0x803b62,%rax
+  803eac:	00 00 00 
+  803eaf:	ff d0                	call   *%rax
+    return n;
+  803eb1:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803eb5:	eb 8c                	jmp    803e43 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803eb7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ebc:	eb 85                	jmp    803e43 <devpipe_read+0xc1>
+
+0000000000803ebe <pipe>:
+pipe(int pfd[2]) {
+  803ebe:	55                   	push   %rbp
+  803ebf:	48 89 e5             	mov    %rsp,%rbp
+  803ec2:	41 55                	push   %r13
+  803ec4:	41 54                	push   %r12
+  803ec6:	53                   	push   %rbx
+  803ec7:	48 83 ec 18          	sub    $0x18,%rsp
+  803ecb:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ece:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803ed2:	48 b8 30 1a 80 00 00 	movabs $0x801a30,%rax
+  803ed9:	00 00 00 
+  803edc:	ff d0                	call   *%rax
+  803ede:	89 c3                	mov    %eax,%ebx
+  803ee0:	85 c0                	test   %eax,%eax
+  803ee2:	0f 88 a0 01 00 00    	js     804088 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803ee8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803eed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ef2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ef6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803efb:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  803f02:	00 00 00 
+  803f05:	ff d0                	call   *%rax
+  803f07:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f09:	85 c0                	test   %eax,%eax
+  803f0b:	0f 88 77 01 00 00    	js     804088 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f11:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f15:	48 b8 30 1a 80 00 00 	movabs $0x801a30,%rax
+  803f1c:	00 00 00 
+  803f1f:	ff d0                	call   *%rax
+  803f21:	89 c3                	mov    %eax,%ebx
+  803f23:	85 c0                	test   %eax,%eax
+  803f25:	0f 88 43 01 00 00    	js     80406e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f35:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f39:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f3e:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  803f45:	00 00 00 
+  803f48:	ff d0                	call   *%rax
+  803f4a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f4c:	85 c0                	test   %eax,%eax
+  803f4e:	0f 88 1a 01 00 00    	js     80406e <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f54:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f58:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803f5f:	00 00 00 
+  803f62:	ff d0                	call   *%rax
+  803f64:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f67:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f71:	48 89 c6             	mov    %rax,%rsi
+  803f74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f79:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  803f80:	00 00 00 
+  803f83:	ff d0                	call   *%rax
+  803f85:	89 c3                	mov    %eax,%ebx
+  803f87:	85 c0                	test   %eax,%eax
+  803f89:	0f 88 c5 00 00 00    	js     804054 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803f8f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f93:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  803f9a:	00 00 00 
+  803f9d:	ff d0                	call   *%rax
+  803f9f:	48 89 c1             	mov    %rax,%rcx
+  803fa2:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803fa8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803fae:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fb3:	4c 89 ee             	mov    %r13,%rsi
+  803fb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fbb:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  803fc2:	00 00 00 
+  803fc5:	ff d0                	call   *%rax
+  803fc7:	89 c3                	mov    %eax,%ebx
+  803fc9:	85 c0                	test   %eax,%eax
+  803fcb:	78 6e                	js     80403b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fcd:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fd2:	4c 89 ef             	mov    %r13,%rdi
+  803fd5:	48 b8 74 14 80 00 00 	movabs $0x801474,%rax
+  803fdc:	00 00 00 
+  803fdf:	ff d0                	call   *%rax
+  803fe1:	83 f8 02             	cmp    $0x2,%eax
+  803fe4:	0f 85 ab 00 00 00    	jne    804095 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803fea:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ff1:	00 00 
+  803ff3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ff7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ff9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ffd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804004:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804008:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80400a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80400e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804015:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804019:	48 bb 02 1a 80 00 00 	movabs $0x801a02,%rbx
+  804020:	00 00 00 
+  804023:	ff d3                	call   *%rbx
+  804025:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804029:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80402d:	ff d3                	call   *%rbx
+  80402f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804034:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804039:	eb 4d                	jmp    804088 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80403b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804040:	4c 89 ee             	mov    %r13,%rsi
+  804043:	bf 00 00 00 00       	mov    $0x0,%edi
+  804048:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  80404f:	00 00 00 
+  804052:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804054:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804059:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80405d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804062:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  804069:	00 00 00 
+  80406c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  80406e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804073:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804077:	bf 00 00 00 00       	mov    $0x0,%edi
+  80407c:	48 b8 55 15 80 00 00 	movabs $0x801555,%rax
+  804083:	00 00 00 
+  804086:	ff d0                	call   *%rax
+}
+  804088:	89 d8                	mov    %ebx,%eax
+  80408a:	48 83 c4 18          	add    $0x18,%rsp
+  80408e:	5b                   	pop    %rbx
+  80408f:	41 5c                	pop    %r12
+  804091:	41 5d                	pop    %r13
+  804093:	5d                   	pop    %rbp
+  804094:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804095:	48 b9 50 54 80 00 00 	movabs $0x805450,%rcx
+  80409c:	00 00 00 
+  80409f:	48 ba 27 54 80 00 00 	movabs $0x805427,%rdx
+  8040a6:	00 00 00 
+  8040a9:	be 50 00 00 00       	mov    $0x50,%esi
+  8040ae:	48 bf 3c 54 80 00 00 	movabs $0x80543c,%rdi
+  8040b5:	00 00 00 
+  8040b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040bd:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8040c4:	00 00 00 
+  8040c7:	41 ff d0             	call   *%r8
+
+00000000008040ca <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8040ca:	55                   	push   %rbp
+  8040cb:	48 89 e5             	mov    %rsp,%rbp
+  8040ce:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040d2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040d6:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  8040dd:	00 00 00 
+  8040e0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040e2:	85 c0                	test   %eax,%eax
+  8040e4:	78 23                	js     804109 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8040e6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040ea:	48 b8 14 1a 80 00 00 	movabs $0x801a14,%rax
+  8040f1:	00 00 00 
+  8040f4:	ff d0                	call   *%rax
+  8040f6:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8040f9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8040fd:	48 b8 05 3c 80 00 00 	movabs $0x803c05,%rax
+  804104:	00 00 00 
+  804107:	ff d0                	call   *%rax
+}
+  804109:	c9                   	leave
+  80410a:	c3                   	ret
+
+000000000080410b <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  80410b:	55                   	push   %rbp
+  80410c:	48 89 e5             	mov    %rsp,%rbp
+  80410f:	41 56                	push   %r14
+  804111:	41 55                	push   %r13
+  804113:	41 54                	push   %r12
+  804115:	53                   	push   %rbx
+    assert(envid != 0);
+  804116:	85 ff                	test   %edi,%edi
+  804118:	0f 84 b7 00 00 00    	je     8041d5 <wait+0xca>
+  80411e:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804121:	89 f9                	mov    %edi,%ecx
+  804123:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804129:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804130:	00 00 00 
+  804133:	45 89 e0             	mov    %r12d,%r8d
+  804136:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  80413d:	4c 89 c0             	mov    %r8,%rax
+  804140:	48 c1 e0 04          	shl    $0x4,%rax
+  804144:	48 89 c2             	mov    %rax,%rdx
+  804147:	4c 29 c2             	sub    %r8,%rdx
+  80414a:	48 c1 e2 05          	shl    $0x5,%rdx
+  80414e:	48 01 fa             	add    %rdi,%rdx
+  804151:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804157:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  80415d:	41 39 c4             	cmp    %eax,%r12d
+  804160:	75 6a                	jne    8041cc <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804162:	48 63 d1             	movslq %ecx,%rdx
+  804165:	48 89 d0             	mov    %rdx,%rax
+  804168:	48 c1 e0 04          	shl    $0x4,%rax
+  80416c:	48 29 d0             	sub    %rdx,%rax
+  80416f:	48 c1 e0 05          	shl    $0x5,%rax
+  804173:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80417a:	00 00 00 
+  80417d:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804184:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804185:	48 63 c9             	movslq %ecx,%rcx
+  804188:	48 89 c8             	mov    %rcx,%rax
+  80418b:	48 c1 e0 04          	shl    $0x4,%rax
+  80418f:	48 29 c8             	sub    %rcx,%rax
+  804192:	48 c1 e0 05          	shl    $0x5,%rax
+  804196:	48 89 d3             	mov    %rdx,%rbx
+  804199:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80419c:	49 bd 1d 18 80 00 00 	movabs $0x80181d,%r13
+  8041a3:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8041a6:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8041ac:	85 c0                	test   %eax,%eax
+  8041ae:	74 1c                	je     8041cc <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  8041b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041b5:	4c 89 f7             	mov    %r14,%rdi
+  8041b8:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8041bb:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8041c1:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8041c7:	44 39 e0             	cmp    %r12d,%eax
+  8041ca:	74 da                	je     8041a6 <wait+0x9b>
+    }
+}
+  8041cc:	5b                   	pop    %rbx
+  8041cd:	41 5c                	pop    %r12
+  8041cf:	41 5d                	pop    %r13
+  8041d1:	41 5e                	pop    %r14
+  8041d3:	5d                   	pop    %rbp
+  8041d4:	c3                   	ret
+    assert(envid != 0);
+  8041d5:	48 b9 74 54 80 00 00 	movabs $0x805474,%rcx
+  8041dc:	00 00 00 
+  8041df:	48 ba 27 54 80 00 00 	movabs $0x805427,%rdx
+  8041e6:	00 00 00 
+  8041e9:	be 06 00 00 00       	mov    $0x6,%esi
+  8041ee:	48 bf 7f 54 80 00 00 	movabs $0x80547f,%rdi
+  8041f5:	00 00 00 
+  8041f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041fd:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  804204:	00 00 00 
+  804207:	41 ff d0             	call   *%r8
+
+000000000080420a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80420a:	48 89 f8             	mov    %rdi,%rax
+  80420d:	48 c1 e8 27          	shr    $0x27,%rax
+  804211:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804218:	01 00 00 
+  80421b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80421f:	f6 c2 01             	test   $0x1,%dl
+  804222:	74 6d                	je     804291 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804224:	48 89 f8             	mov    %rdi,%rax
+  804227:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80422b:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804232:	01 00 00 
+  804235:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804239:	f6 c2 01             	test   $0x1,%dl
+  80423c:	74 62                	je     8042a0 <get_uvpt_entry+0x96>
+  80423e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804245:	01 00 00 
+  804248:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80424c:	f6 c2 80             	test   $0x80,%dl
+  80424f:	75 4f                	jne    8042a0 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804251:	48 89 f8             	mov    %rdi,%rax
+  804254:	48 c1 e8 15          	shr    $0x15,%rax
+  804258:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80425f:	01 00 00 
+  804262:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804266:	f6 c2 01             	test   $0x1,%dl
+  804269:	74 44                	je     8042af <get_uvpt_entry+0xa5>
+  80426b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804272:	01 00 00 
+  804275:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804279:	f6 c2 80             	test   $0x80,%dl
+  80427c:	75 31                	jne    8042af <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80427e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804282:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804289:	01 00 00 
+  80428c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804290:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804291:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804298:	01 00 00 
+  80429b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80429f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8042a0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8042a7:	01 00 00 
+  8042aa:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042ae:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8042af:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8042b6:	01 00 00 
+  8042b9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8042bd:	c3                   	ret
+
+00000000008042be <get_prot>:
+
+int
+get_prot(void *va) {
+  8042be:	55                   	push   %rbp
+  8042bf:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8042c2:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  8042c9:	00 00 00 
+  8042cc:	ff d0                	call   *%rax
+  8042ce:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8042d1:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8042d6:	89 c1                	mov    %eax,%ecx
+  8042d8:	83 c9 04             	or     $0x4,%ecx
+  8042db:	f6 c2 01             	test   $0x1,%dl
+  8042de:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8042e1:	89 c1                	mov    %eax,%ecx
+  8042e3:	83 c9 02             	or     $0x2,%ecx
+  8042e6:	f6 c2 02             	test   $0x2,%dl
+  8042e9:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8042ec:	89 c1                	mov    %eax,%ecx
+  8042ee:	83 c9 01             	or     $0x1,%ecx
+  8042f1:	48 85 d2             	test   %rdx,%rdx
+  8042f4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8042f7:	89 c1                	mov    %eax,%ecx
+  8042f9:	83 c9 40             	or     $0x40,%ecx
+  8042fc:	f6 c6 04             	test   $0x4,%dh
+  8042ff:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804302:	5d                   	pop    %rbp
+  804303:	c3                   	ret
+
+0000000000804304 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804304:	55                   	push   %rbp
+  804305:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804308:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  80430f:	00 00 00 
+  804312:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804314:	48 c1 e8 06          	shr    $0x6,%rax
+  804318:	83 e0 01             	and    $0x1,%eax
+}
+  80431b:	5d                   	pop    %rbp
+  80431c:	c3                   	ret
+
+000000000080431d <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80431d:	55                   	push   %rbp
+  80431e:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804321:	48 b8 0a 42 80 00 00 	movabs $0x80420a,%rax
+  804328:	00 00 00 
+  80432b:	ff d0                	call   *%rax
+  80432d:	83 e0 01             	and    $0x1,%eax
+}
+  804330:	5d                   	pop    %rbp
+  804331:	c3                   	ret
+
+0000000000804332 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804332:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804339:	01 00 00 
+  80433c:	a8 01                	test   $0x1,%al
+  80433e:	75 06                	jne    804346 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804340:	b8 00 00 00 00       	mov    $0x0,%eax
+  804345:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804346:	55                   	push   %rbp
+  804347:	48 89 e5             	mov    %rsp,%rbp
+  80434a:	41 57                	push   %r15
+  80434c:	41 56                	push   %r14
+  80434e:	41 55                	push   %r13
+  804350:	41 54                	push   %r12
+  804352:	53                   	push   %rbx
+  804353:	48 83 ec 28          	sub    $0x28,%rsp
+  804357:	49 89 fe             	mov    %rdi,%r14
+  80435a:	49 89 f7             	mov    %rsi,%r15
+  80435d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804364:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804365:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80436c:	01 00 00 
+  80436f:	e9 ae 00 00 00       	jmp    804422 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804374:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80437b:	49 83 ec 01          	sub    $0x1,%r12
+  80437f:	74 2d                	je     8043ae <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804381:	48 89 d8             	mov    %rbx,%rax
+  804384:	48 c1 e8 0c          	shr    $0xc,%rax
+  804388:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80438d:	f6 c2 01             	test   $0x1,%dl
+  804390:	74 e2                	je     804374 <foreach_shared_region+0x42>
+  804392:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804397:	f6 c4 04             	test   $0x4,%ah
+  80439a:	74 d8                	je     804374 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80439c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8043a3:	4c 89 fa             	mov    %r15,%rdx
+  8043a6:	48 89 df             	mov    %rbx,%rdi
+  8043a9:	41 ff d6             	call   *%r14
+  8043ac:	eb c6                	jmp    804374 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8043ae:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8043b5:	00 
+  8043b6:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8043bb:	74 4a                	je     804407 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8043bd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8043c1:	48 c1 e8 15          	shr    $0x15,%rax
+  8043c5:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8043cc:	01 00 00 
+  8043cf:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8043d3:	a8 01                	test   $0x1,%al
+  8043d5:	74 d7                	je     8043ae <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8043d7:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8043db:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8043e2:	48 39 c3             	cmp    %rax,%rbx
+  8043e5:	73 c7                	jae    8043ae <foreach_shared_region+0x7c>
+  8043e7:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8043ee:	48 39 d0             	cmp    %rdx,%rax
+  8043f1:	4d 19 e4             	sbb    %r12,%r12
+  8043f4:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8043fb:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804402:	e9 7a ff ff ff       	jmp    804381 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804407:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80440e:	40 
+  80440f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804413:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80441a:	00 00 00 
+  80441d:	48 39 c1             	cmp    %rax,%rcx
+  804420:	74 50                	je     804472 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804422:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804426:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80442a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804431:	01 00 00 
+  804434:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804438:	a8 01                	test   $0x1,%al
+  80443a:	74 cb                	je     804407 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80443c:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804440:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804447:	48 39 c1             	cmp    %rax,%rcx
+  80444a:	73 bb                	jae    804407 <foreach_shared_region+0xd5>
+  80444c:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804453:	48 39 d0             	cmp    %rdx,%rax
+  804456:	48 19 c0             	sbb    %rax,%rax
+  804459:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80445f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804465:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804469:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80446d:	e9 4b ff ff ff       	jmp    8043bd <foreach_shared_region+0x8b>
+  804472:	b8 00 00 00 00       	mov    $0x0,%eax
+  804477:	48 83 c4 28          	add    $0x28,%rsp
+  80447b:	5b                   	pop    %rbx
+  80447c:	41 5c                	pop    %r12
+  80447e:	41 5d                	pop    %r13
+  804480:	41 5e                	pop    %r14
+  804482:	41 5f                	pop    %r15
+  804484:	5d                   	pop    %rbp
+  804485:	c3                   	ret
+
+0000000000804486 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804486:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80448c:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804493:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80449a:	c3                   	ret
+
+000000000080449b <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80449b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80449e:	8b 17                	mov    (%rdi),%edx
+  8044a0:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8044a2:	83 f8 0f             	cmp    $0xf,%eax
+  8044a5:	77 13                	ja     8044ba <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8044a7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044aa:	83 e0 0f             	and    $0xf,%eax
+  8044ad:	48 c1 e0 09          	shl    $0x9,%rax
+  8044b1:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8044b8:	00 
+  8044b9:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8044ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8044bf:	c3                   	ret
+
+00000000008044c0 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8044c0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044c3:	83 c0 01             	add    $0x1,%eax
+  8044c6:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8044c9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8044cf:	8b 57 04             	mov    0x4(%rdi),%edx
+  8044d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044d7:	85 d2                	test   %edx,%edx
+  8044d9:	75 04                	jne    8044df <chan_publish+0x1f>
+  8044db:	83 e0 01             	and    $0x1,%eax
+}
+  8044de:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8044df:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8044e2:	85 c0                	test   %eax,%eax
+  8044e4:	0f 95 c0             	setne  %al
+  8044e7:	0f b6 c0             	movzbl %al,%eax
+  8044ea:	eb ef                	jmp    8044db <chan_publish+0x1b>
+
+00000000008044ec <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8044ec:	8b 47 40             	mov    0x40(%rdi),%eax
+  8044ef:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8044f1:	29 d0                	sub    %edx,%eax
+  8044f3:	83 e8 01             	sub    $0x1,%eax
+  8044f6:	83 f8 0f             	cmp    $0xf,%eax
+  8044f9:	77 12                	ja     80450d <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8044fb:	8b 07                	mov    (%rdi),%eax
+  8044fd:	83 e0 0f             	and    $0xf,%eax
+  804500:	48 c1 e0 09          	shl    $0x9,%rax
+  804504:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80450b:	00 
+  80450c:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80450d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804512:	c3                   	ret
+
+0000000000804513 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804513:	8b 07                	mov    (%rdi),%eax
+  804515:	83 c0 01             	add    $0x1,%eax
+  804518:	89 07                	mov    %eax,(%rdi)
+}
+  80451a:	c3                   	ret
+
+000000000080451b <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80451b:	55                   	push   %rbp
+  80451c:	48 89 e5             	mov    %rsp,%rbp
+  80451f:	53                   	push   %rbx
+  804520:	48 83 ec 08          	sub    $0x8,%rsp
+  804524:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804527:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80452e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804534:	48 b8 ec 44 80 00 00 	movabs $0x8044ec,%rax
+  80453b:	00 00 00 
+  80453e:	ff d0                	call   *%rax
+  804540:	48 85 c0             	test   %rax,%rax
+  804543:	74 12                	je     804557 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804545:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80454c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804551:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804555:	c9                   	leave
+  804556:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804557:	b8 01 00 00 00       	mov    $0x1,%eax
+  80455c:	eb f3                	jmp    804551 <chan_arm+0x36>
+
+000000000080455e <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80455e:	55                   	push   %rbp
+  80455f:	48 89 e5             	mov    %rsp,%rbp
+  804562:	41 56                	push   %r14
+  804564:	41 55                	push   %r13
+  804566:	41 54                	push   %r12
+  804568:	53                   	push   %rbx
+  804569:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80456c:	49 bc 1b 45 80 00 00 	movabs $0x80451b,%r12
+  804573:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804576:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80457a:	49 bd 1d 18 80 00 00 	movabs $0x80181d,%r13
+  804581:	00 00 00 
+    while (chan_arm(r))
+  804584:	eb 0d                	jmp    804593 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804586:	8b 33                	mov    (%rbx),%esi
+  804588:	ba 00 00 00 00       	mov    $0x0,%edx
+  80458d:	4c 89 f7             	mov    %r14,%rdi
+  804590:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804593:	48 89 df             	mov    %rbx,%rdi
+  804596:	41 ff d4             	call   *%r12
+  804599:	84 c0                	test   %al,%al
+  80459b:	75 e9                	jne    804586 <chan_wait+0x28>
+}
+  80459d:	5b                   	pop    %rbx
+  80459e:	41 5c                	pop    %r12
+  8045a0:	41 5d                	pop    %r13
+  8045a2:	41 5e                	pop    %r14
+  8045a4:	5d                   	pop    %rbp
+  8045a5:	c3                   	ret
+
+00000000008045a6 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8045a6:	55                   	push   %rbp
+  8045a7:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8045aa:	48 83 c7 40          	add    $0x40,%rdi
+  8045ae:	be 01 00 00 00       	mov    $0x1,%esi
+  8045b3:	48 b8 3b 18 80 00 00 	movabs $0x80183b,%rax
+  8045ba:	00 00 00 
+  8045bd:	ff d0                	call   *%rax
+}
+  8045bf:	5d                   	pop    %rbp
+  8045c0:	c3                   	ret
+
+00000000008045c1 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8045c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045c6:	c3                   	ret
+
+00000000008045c7 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8045c7:	55                   	push   %rbp
+  8045c8:	48 89 e5             	mov    %rsp,%rbp
+  8045cb:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8045ce:	48 be 8a 54 80 00 00 	movabs $0x80548a,%rsi
+  8045d5:	00 00 00 
+  8045d8:	48 b8 50 0f 80 00 00 	movabs $0x800f50,%rax
+  8045df:	00 00 00 
+  8045e2:	ff d0                	call   *%rax
+    return 0;
+}
+  8045e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045e9:	5d                   	pop    %rbp
+  8045ea:	c3                   	ret
+
+00000000008045eb <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8045eb:	55                   	push   %rbp
+  8045ec:	48 89 e5             	mov    %rsp,%rbp
+  8045ef:	41 57                	push   %r15
+  8045f1:	41 56                	push   %r14
+  8045f3:	41 55                	push   %r13
+  8045f5:	41 54                	push   %r12
+  8045f7:	53                   	push   %rbx
+  8045f8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8045ff:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804606:	48 85 d2             	test   %rdx,%rdx
+  804609:	74 7a                	je     804685 <devcons_write+0x9a>
+  80460b:	49 89 d6             	mov    %rdx,%r14
+  80460e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804614:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804619:	49 bf 4a 11 80 00 00 	movabs $0x80114a,%r15
+  804620:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804623:	4c 89 f3             	mov    %r14,%rbx
+  804626:	48 29 f3             	sub    %rsi,%rbx
+  804629:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80462e:	48 39 c3             	cmp    %rax,%rbx
+  804631:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804635:	4c 63 eb             	movslq %ebx,%r13
+  804638:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80463f:	48 01 c6             	add    %rax,%rsi
+  804642:	4c 89 ea             	mov    %r13,%rdx
+  804645:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80464c:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80464f:	4c 89 ee             	mov    %r13,%rsi
+  804652:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804659:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  804660:	00 00 00 
+  804663:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804665:	41 01 dc             	add    %ebx,%r12d
+  804668:	49 63 f4             	movslq %r12d,%rsi
+  80466b:	4c 39 f6             	cmp    %r14,%rsi
+  80466e:	72 b3                	jb     804623 <devcons_write+0x38>
+    return res;
+  804670:	49 63 c4             	movslq %r12d,%rax
+}
+  804673:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80467a:	5b                   	pop    %rbx
+  80467b:	41 5c                	pop    %r12
+  80467d:	41 5d                	pop    %r13
+  80467f:	41 5e                	pop    %r14
+  804681:	41 5f                	pop    %r15
+  804683:	5d                   	pop    %rbp
+  804684:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804685:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80468b:	eb e3                	jmp    804670 <devcons_write+0x85>
+
+000000000080468d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80468d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804690:	ba 00 00 00 00       	mov    $0x0,%edx
+  804695:	48 85 c0             	test   %rax,%rax
+  804698:	74 55                	je     8046ef <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80469a:	55                   	push   %rbp
+  80469b:	48 89 e5             	mov    %rsp,%rbp
+  80469e:	41 55                	push   %r13
+  8046a0:	41 54                	push   %r12
+  8046a2:	53                   	push   %rbx
+  8046a3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046a7:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8046aa:	48 bb 96 13 80 00 00 	movabs $0x801396,%rbx
+  8046b1:	00 00 00 
+  8046b4:	49 bc 4b 14 80 00 00 	movabs $0x80144b,%r12
+  8046bb:	00 00 00 
+  8046be:	eb 03                	jmp    8046c3 <devcons_read+0x36>
+  8046c0:	41 ff d4             	call   *%r12
+  8046c3:	ff d3                	call   *%rbx
+  8046c5:	85 c0                	test   %eax,%eax
+  8046c7:	74 f7                	je     8046c0 <devcons_read+0x33>
+    if (c < 0) return c;
+  8046c9:	48 63 d0             	movslq %eax,%rdx
+  8046cc:	78 13                	js     8046e1 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8046ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046d3:	83 f8 04             	cmp    $0x4,%eax
+  8046d6:	74 09                	je     8046e1 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8046d8:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8046dc:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8046e1:	48 89 d0             	mov    %rdx,%rax
+  8046e4:	48 83 c4 08          	add    $0x8,%rsp
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	41 5c                	pop    %r12
+  8046eb:	41 5d                	pop    %r13
+  8046ed:	5d                   	pop    %rbp
+  8046ee:	c3                   	ret
+  8046ef:	48 89 d0             	mov    %rdx,%rax
+  8046f2:	c3                   	ret
+
+00000000008046f3 <cputchar>:
+cputchar(int ch) {
+  8046f3:	55                   	push   %rbp
+  8046f4:	48 89 e5             	mov    %rsp,%rbp
+  8046f7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8046fb:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8046ff:	be 01 00 00 00       	mov    $0x1,%esi
+  804704:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804708:	48 b8 77 13 80 00 00 	movabs $0x801377,%rax
+  80470f:	00 00 00 
+  804712:	ff d0                	call   *%rax
+}
+  804714:	c9                   	leave
+  804715:	c3                   	ret
+
+0000000000804716 <getchar>:
+getchar(void) {
+  804716:	55                   	push   %rbp
+  804717:	48 89 e5             	mov    %rsp,%rbp
+  80471a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80471e:	ba 01 00 00 00       	mov    $0x1,%edx
+  804723:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804727:	bf 00 00 00 00       	mov    $0x0,%edi
+  80472c:	48 b8 73 1d 80 00 00 	movabs $0x801d73,%rax
+  804733:	00 00 00 
+  804736:	ff d0                	call   *%rax
+  804738:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80473a:	85 c0                	test   %eax,%eax
+  80473c:	78 06                	js     804744 <getchar+0x2e>
+  80473e:	74 08                	je     804748 <getchar+0x32>
+  804740:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804744:	89 d0                	mov    %edx,%eax
+  804746:	c9                   	leave
+  804747:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804748:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80474d:	eb f5                	jmp    804744 <getchar+0x2e>
+
+000000000080474f <iscons>:
+iscons(int fdnum) {
+  80474f:	55                   	push   %rbp
+  804750:	48 89 e5             	mov    %rsp,%rbp
+  804753:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804757:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80475b:	48 b8 90 1a 80 00 00 	movabs $0x801a90,%rax
+  804762:	00 00 00 
+  804765:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804767:	85 c0                	test   %eax,%eax
+  804769:	78 18                	js     804783 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80476b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80476f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804776:	00 00 00 
+  804779:	8b 00                	mov    (%rax),%eax
+  80477b:	39 02                	cmp    %eax,(%rdx)
+  80477d:	0f 94 c0             	sete   %al
+  804780:	0f b6 c0             	movzbl %al,%eax
+}
+  804783:	c9                   	leave
+  804784:	c3                   	ret
+
+0000000000804785 <opencons>:
+opencons(void) {
+  804785:	55                   	push   %rbp
+  804786:	48 89 e5             	mov    %rsp,%rbp
+  804789:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80478d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804791:	48 b8 30 1a 80 00 00 	movabs $0x801a30,%rax
+  804798:	00 00 00 
+  80479b:	ff d0                	call   *%rax
+  80479d:	85 c0                	test   %eax,%eax
+  80479f:	78 49                	js     8047ea <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8047a1:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047a6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ab:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8047af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047b4:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  8047bb:	00 00 00 
+  8047be:	ff d0                	call   *%rax
+  8047c0:	85 c0                	test   %eax,%eax
+  8047c2:	78 26                	js     8047ea <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8047c4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8047c8:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8047cf:	00 00 
+  8047d1:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8047d3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8047d7:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8047de:	48 b8 02 1a 80 00 00 	movabs $0x801a02,%rax
+  8047e5:	00 00 00 
+  8047e8:	ff d0                	call   *%rax
+}
+  8047ea:	c9                   	leave
+  8047eb:	c3                   	ret
+
+00000000008047ec <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8047ec:	55                   	push   %rbp
+  8047ed:	48 89 e5             	mov    %rsp,%rbp
+  8047f0:	41 56                	push   %r14
+  8047f2:	41 55                	push   %r13
+  8047f4:	41 54                	push   %r12
+  8047f6:	53                   	push   %rbx
+  8047f7:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047fa:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804801:	00 00 00 
+  804804:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804808:	74 27                	je     804831 <_handle_vectored_pagefault+0x45>
+  80480a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80480f:	49 bd 00 10 85 00 00 	movabs $0x851000,%r13
+  804816:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804819:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80481c:	4c 89 e7             	mov    %r12,%rdi
+  80481f:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804824:	84 c0                	test   %al,%al
+  804826:	75 45                	jne    80486d <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804828:	48 83 c3 01          	add    $0x1,%rbx
+  80482c:	49 3b 1e             	cmp    (%r14),%rbx
+  80482f:	72 eb                	jb     80481c <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804831:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804838:	00 
+  804839:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80483e:	4d 8b 04 24          	mov    (%r12),%r8
+  804842:	48 ba 98 54 80 00 00 	movabs $0x805498,%rdx
+  804849:	00 00 00 
+  80484c:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804851:	48 bf c8 54 80 00 00 	movabs $0x8054c8,%rdi
+  804858:	00 00 00 
+  80485b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804860:	49 ba db 04 80 00 00 	movabs $0x8004db,%r10
+  804867:	00 00 00 
+  80486a:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80486d:	5b                   	pop    %rbx
+  80486e:	41 5c                	pop    %r12
+  804870:	41 5d                	pop    %r13
+  804872:	41 5e                	pop    %r14
+  804874:	5d                   	pop    %rbp
+  804875:	c3                   	ret
+
+0000000000804876 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804876:	55                   	push   %rbp
+  804877:	48 89 e5             	mov    %rsp,%rbp
+  80487a:	53                   	push   %rbx
+  80487b:	48 83 ec 08          	sub    $0x8,%rsp
+  80487f:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804882:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804889:	00 00 00 
+  80488c:	80 38 00             	cmpb   $0x0,(%rax)
+  80488f:	0f 84 84 00 00 00    	je     804919 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804895:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  80489c:	00 00 00 
+  80489f:	48 8b 10             	mov    (%rax),%rdx
+  8048a2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048a7:	48 b9 00 10 85 00 00 	movabs $0x851000,%rcx
+  8048ae:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048b1:	48 85 d2             	test   %rdx,%rdx
+  8048b4:	74 19                	je     8048cf <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048b6:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8048ba:	0f 84 e8 00 00 00    	je     8049a8 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8048c0:	48 83 c0 01          	add    $0x1,%rax
+  8048c4:	48 39 d0             	cmp    %rdx,%rax
+  8048c7:	75 ed                	jne    8048b6 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8048c9:	48 83 fa 08          	cmp    $0x8,%rdx
+  8048cd:	74 1c                	je     8048eb <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8048cf:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8048d3:	48 a3 48 10 85 00 00 	movabs %rax,0x851048
+  8048da:	00 00 00 
+  8048dd:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  8048e4:	00 00 00 
+  8048e7:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8048eb:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  8048f2:	00 00 00 
+  8048f5:	ff d0                	call   *%rax
+  8048f7:	89 c7                	mov    %eax,%edi
+  8048f9:	48 be 6e 4a 80 00 00 	movabs $0x804a6e,%rsi
+  804900:	00 00 00 
+  804903:	48 b8 6d 16 80 00 00 	movabs $0x80166d,%rax
+  80490a:	00 00 00 
+  80490d:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80490f:	85 c0                	test   %eax,%eax
+  804911:	78 68                	js     80497b <add_pgfault_handler+0x105>
+    return res;
+}
+  804913:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804917:	c9                   	leave
+  804918:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804919:	48 b8 22 14 80 00 00 	movabs $0x801422,%rax
+  804920:	00 00 00 
+  804923:	ff d0                	call   *%rax
+  804925:	89 c7                	mov    %eax,%edi
+  804927:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80492c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804931:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804938:	00 00 00 
+  80493b:	48 b8 af 14 80 00 00 	movabs $0x8014af,%rax
+  804942:	00 00 00 
+  804945:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804947:	48 ba 48 10 85 00 00 	movabs $0x851048,%rdx
+  80494e:	00 00 00 
+  804951:	48 8b 02             	mov    (%rdx),%rax
+  804954:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804958:	48 89 0a             	mov    %rcx,(%rdx)
+  80495b:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804962:	00 00 00 
+  804965:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804969:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804970:	00 00 00 
+  804973:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804976:	e9 70 ff ff ff       	jmp    8048eb <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80497b:	89 c1                	mov    %eax,%ecx
+  80497d:	48 ba d6 54 80 00 00 	movabs $0x8054d6,%rdx
+  804984:	00 00 00 
+  804987:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80498c:	48 bf c8 54 80 00 00 	movabs $0x8054c8,%rdi
+  804993:	00 00 00 
+  804996:	b8 00 00 00 00       	mov    $0x0,%eax
+  80499b:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  8049a2:	00 00 00 
+  8049a5:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8049a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049ad:	e9 61 ff ff ff       	jmp    804913 <add_pgfault_handler+0x9d>
+
+00000000008049b2 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8049b2:	55                   	push   %rbp
+  8049b3:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8049b6:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  8049bd:	00 00 00 
+  8049c0:	80 38 00             	cmpb   $0x0,(%rax)
+  8049c3:	74 33                	je     8049f8 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8049c5:	48 a1 48 10 85 00 00 	movabs 0x851048,%rax
+  8049cc:	00 00 00 
+  8049cf:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8049d4:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  8049db:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8049de:	48 85 c0             	test   %rax,%rax
+  8049e1:	0f 84 85 00 00 00    	je     804a6c <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8049e7:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8049eb:	74 40                	je     804a2d <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8049ed:	48 83 c1 01          	add    $0x1,%rcx
+  8049f1:	48 39 c1             	cmp    %rax,%rcx
+  8049f4:	75 f1                	jne    8049e7 <remove_pgfault_handler+0x35>
+  8049f6:	eb 74                	jmp    804a6c <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8049f8:	48 b9 ee 54 80 00 00 	movabs $0x8054ee,%rcx
+  8049ff:	00 00 00 
+  804a02:	48 ba 27 54 80 00 00 	movabs $0x805427,%rdx
+  804a09:	00 00 00 
+  804a0c:	be 43 00 00 00       	mov    $0x43,%esi
+  804a11:	48 bf c8 54 80 00 00 	movabs $0x8054c8,%rdi
+  804a18:	00 00 00 
+  804a1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a20:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  804a27:	00 00 00 
+  804a2a:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804a2d:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804a34:	00 
+  804a35:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804a39:	48 29 ca             	sub    %rcx,%rdx
+  804a3c:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804a43:	00 00 00 
+  804a46:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804a4a:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804a4f:	48 89 ce             	mov    %rcx,%rsi
+  804a52:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  804a59:	00 00 00 
+  804a5c:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804a5e:	48 b8 48 10 85 00 00 	movabs $0x851048,%rax
+  804a65:	00 00 00 
+  804a68:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804a6c:	5d                   	pop    %rbp
+  804a6d:	c3                   	ret
+
+0000000000804a6e <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804a6e:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804a71:	48 b8 ec 47 80 00 00 	movabs $0x8047ec,%rax
+  804a78:	00 00 00 
+    call *%rax
+  804a7b:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804a7d:	41 5f                	pop    %r15
+	popq %r15
+  804a7f:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804a81:	41 5f                	pop    %r15
+	popq %r14
+  804a83:	41 5e                	pop    %r14
+	popq %r13
+  804a85:	41 5d                	pop    %r13
+	popq %r12
+  804a87:	41 5c                	pop    %r12
+	popq %r11
+  804a89:	41 5b                	pop    %r11
+	popq %r10
+  804a8b:	41 5a                	pop    %r10
+	popq %r9
+  804a8d:	41 59                	pop    %r9
+	popq %r8
+  804a8f:	41 58                	pop    %r8
+	popq %rsi
+  804a91:	5e                   	pop    %rsi
+	popq %rdi
+  804a92:	5f                   	pop    %rdi
+	popq %rbp
+  804a93:	5d                   	pop    %rbp
+	popq %rdx
+  804a94:	5a                   	pop    %rdx
+	popq %rcx
+  804a95:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804a96:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804a9b:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804aa0:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804aa4:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804aa7:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804aac:	5b                   	pop    %rbx
+	popq %rax
+  804aad:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804aae:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804ab2:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804ab3:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804ab8:	c3                   	ret
+
+0000000000804ab9 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804ab9:	55                   	push   %rbp
+  804aba:	48 89 e5             	mov    %rsp,%rbp
+  804abd:	41 55                	push   %r13
+  804abf:	41 54                	push   %r12
+  804ac1:	53                   	push   %rbx
+  804ac2:	48 83 ec 08          	sub    $0x8,%rsp
+  804ac6:	49 89 fd             	mov    %rdi,%r13
+  804ac9:	48 89 f7             	mov    %rsi,%rdi
+  804acc:	48 89 d3             	mov    %rdx,%rbx
+  804acf:	49 89 cc             	mov    %rcx,%r12
+  804ad2:	4c 89 c2             	mov    %r8,%rdx
+  804ad5:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804ad8:	48 85 f6             	test   %rsi,%rsi
+  804adb:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804ae2:	00 00 00 
+  804ae5:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804ae9:	be 00 10 00 00       	mov    $0x1000,%esi
+  804aee:	48 85 db             	test   %rbx,%rbx
+  804af1:	74 03                	je     804af6 <ipc_recv_futex+0x3d>
+  804af3:	48 8b 33             	mov    (%rbx),%rsi
+  804af6:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804afa:	48 b8 f9 16 80 00 00 	movabs $0x8016f9,%rax
+  804b01:	00 00 00 
+  804b04:	ff d0                	call   *%rax
+    if (res < 0) {
+  804b06:	85 c0                	test   %eax,%eax
+  804b08:	78 75                	js     804b7f <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804b0a:	4d 85 ed             	test   %r13,%r13
+  804b0d:	74 14                	je     804b23 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804b0f:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804b16:	00 00 00 
+  804b19:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804b1f:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804b23:	4d 85 e4             	test   %r12,%r12
+  804b26:	74 14                	je     804b3c <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804b28:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804b2f:	00 00 00 
+  804b32:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804b38:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804b3c:	48 85 db             	test   %rbx,%rbx
+  804b3f:	74 23                	je     804b64 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804b41:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804b48:	00 00 00 
+  804b4b:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804b51:	ba 00 00 00 00       	mov    $0x0,%edx
+  804b56:	85 c9                	test   %ecx,%ecx
+  804b58:	74 07                	je     804b61 <ipc_recv_futex+0xa8>
+  804b5a:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804b61:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804b64:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804b6b:	00 00 00 
+  804b6e:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804b74:	48 83 c4 08          	add    $0x8,%rsp
+  804b78:	5b                   	pop    %rbx
+  804b79:	41 5c                	pop    %r12
+  804b7b:	41 5d                	pop    %r13
+  804b7d:	5d                   	pop    %rbp
+  804b7e:	c3                   	ret
+        if (from_env_store != NULL) {
+  804b7f:	4d 85 ed             	test   %r13,%r13
+  804b82:	74 08                	je     804b8c <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804b84:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804b8b:	00 
+        if (perm_store != NULL) {
+  804b8c:	4d 85 e4             	test   %r12,%r12
+  804b8f:	74 08                	je     804b99 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804b91:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804b98:	00 
+        if (size != NULL) {
+  804b99:	48 85 db             	test   %rbx,%rbx
+  804b9c:	74 d6                	je     804b74 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804b9e:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804ba5:	eb cd                	jmp    804b74 <ipc_recv_futex+0xbb>
+
+0000000000804ba7 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804ba7:	55                   	push   %rbp
+  804ba8:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804bab:	48 83 ec 08          	sub    $0x8,%rsp
+  804baf:	6a 00                	push   $0x0
+  804bb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804bb7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804bbd:	48 b8 b9 4a 80 00 00 	movabs $0x804ab9,%rax
+  804bc4:	00 00 00 
+  804bc7:	ff d0                	call   *%rax
+}
+  804bc9:	c9                   	leave
+  804bca:	c3                   	ret
+
+0000000000804bcb <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804bcb:	55                   	push   %rbp
+  804bcc:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804bcf:	48 85 d2             	test   %rdx,%rdx
+  804bd2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804bd9:	00 00 00 
+  804bdc:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804be0:	89 f6                	mov    %esi,%esi
+  804be2:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  804be9:	00 00 00 
+  804bec:	ff d0                	call   *%rax
+    if (res < 0) {
+  804bee:	85 c0                	test   %eax,%eax
+  804bf0:	78 02                	js     804bf4 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804bf2:	5d                   	pop    %rbp
+  804bf3:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804bf4:	89 c1                	mov    %eax,%ecx
+  804bf6:	48 ba 08 55 80 00 00 	movabs $0x805508,%rdx
+  804bfd:	00 00 00 
+  804c00:	be 50 00 00 00       	mov    $0x50,%esi
+  804c05:	48 bf 1c 55 80 00 00 	movabs $0x80551c,%rdi
+  804c0c:	00 00 00 
+  804c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c14:	49 b8 db 04 80 00 00 	movabs $0x8004db,%r8
+  804c1b:	00 00 00 
+  804c1e:	41 ff d0             	call   *%r8
+
+0000000000804c21 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804c21:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804c26:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804c2d:	00 00 00 
+  804c30:	48 89 d0             	mov    %rdx,%rax
+  804c33:	48 c1 e0 04          	shl    $0x4,%rax
+  804c37:	48 29 d0             	sub    %rdx,%rax
+  804c3a:	48 c1 e0 05          	shl    $0x5,%rax
+  804c3e:	48 01 c8             	add    %rcx,%rax
+  804c41:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804c47:	39 f8                	cmp    %edi,%eax
+  804c49:	74 13                	je     804c5e <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804c4b:	48 83 c2 01          	add    $0x1,%rdx
+  804c4f:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804c56:	75 d8                	jne    804c30 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804c58:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c5d:	c3                   	ret
+            return envs[i].env_id;
+  804c5e:	48 89 d0             	mov    %rdx,%rax
+  804c61:	48 c1 e0 04          	shl    $0x4,%rax
+  804c65:	48 29 d0             	sub    %rdx,%rax
+  804c68:	48 c1 e0 05          	shl    $0x5,%rax
+  804c6c:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804c73:	00 00 00 
+  804c76:	48 01 d0             	add    %rdx,%rax
+  804c79:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804c7f:	c3                   	ret
+
+0000000000804c80 <__rodata_start>:
+  804c80:	72 65                	jb     804ce7 <__rodata_start+0x67>
+  804c82:	61                   	(bad)
+  804c83:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804c86:	66 73 63             	data16 jae 804cec <__rodata_start+0x6c>
+  804c89:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c8b:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804c8e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c8f:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804c92:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f54d01 <__bss_end+0x73702d01>
+  804c98:	65 72 2f             	gs jb  804cca <__rodata_start+0x4a>
+  804c9b:	66 73 63             	data16 jae 804d01 <__rodata_start+0x81>
+  804c9e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ca0:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804ca3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ca4:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  804ca7:	63 00                	movsxd (%rax),%eax
+  804ca9:	2f                   	(bad)
+  804caa:	66 73 63             	data16 jae 804d10 <__rodata_start+0x90>
+  804cad:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804caf:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804cb2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb3:	63 68 00             	movsxd 0x0(%rax),%ebp
+  804cb6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cb7:	70 65                	jo     804d1e <__rodata_start+0x9e>
+  804cb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cba:	20 2f                	and    %ch,(%rdi)
+  804cbc:	66 73 63             	data16 jae 804d22 <__rodata_start+0xa2>
+  804cbf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cc0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cc1:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804cc4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cc5:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804cc8:	20 25 69 00 77 72    	and    %ah,0x72770069(%rip)        # 72f74d37 <__bss_end+0x72722d37>
+  804cce:	69 74 65 20 2f 66 73 	imul   $0x6373662f,0x20(%rbp,%riz,2),%esi
+  804cd5:	63 
+  804cd6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cd7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cd8:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804cdb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cdc:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804cdf:	20 25 69 00 69 64    	and    %ah,0x64690069(%rip)        # 64e94d4e <__bss_end+0x64642d4e>
+  804ce5:	6c                   	insb   (%dx),%es:(%rdi)
+  804ce6:	65 20 64 69 73       	and    %ah,%gs:0x73(%rcx,%rbp,2)
+  804ceb:	6b 00 66             	imul   $0x66,(%rax),%eax
+  804cee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cef:	72 6b                	jb     804d5c <__rodata_start+0xdc>
+  804cf1:	3a 20                	cmp    (%rax),%ah
+  804cf3:	25 69 00 2f 62       	and    $0x622f0069,%eax
+  804cf8:	69 67 66 69 6c 65 00 	imul   $0x656c69,0x66(%rdi),%esp
+  804cff:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d00:	70 65                	jo     804d67 <__rodata_start+0xe7>
+  804d02:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d03:	20 2f                	and    %ch,(%rdi)
+  804d05:	62                   	(bad)
+  804d06:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804d0d:	20 25 69 00 72 65    	and    %ah,0x65720069(%rip)        # 65f24d7c <__bss_end+0x656d2d7c>
+  804d13:	61                   	(bad)
+  804d14:	64 20 2f             	and    %ch,%fs:(%rdi)
+  804d17:	62                   	(bad)
+  804d18:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  804d1f:	20 25 69 00 66 73    	and    %ah,0x73660069(%rip)        # 73e64d8e <__bss_end+0x73612d8e>
+  804d25:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  804d28:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804d2b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d2c:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804d2f:	20 73 74             	and    %dh,0x74(%rbx)
+  804d32:	72 65                	jb     804d99 <__rodata_start+0x119>
+  804d34:	61                   	(bad)
+  804d35:	6d                   	insl   (%dx),%es:(%rdi)
+  804d36:	65 64 20 25 6c 75 20 	gs and %ah,%fs:0x4b20756c(%rip)        # 4ba0c2aa <__bss_end+0x4b1ba2aa>
+  804d3d:	4b 
+  804d3e:	42 0a 00             	rex.X or (%rax),%al
+  804d41:	62 75                	(bad)
+  804d43:	73 79                	jae    804dbe <__rodata_start+0x13e>
+  804d45:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804d49:	6b 00 0f             	imul   $0xf,(%rax),%eax
+  804d4c:	1f                   	(bad)
+  804d4d:	44 00 00             	add    %r8b,(%rax)
+  804d50:	66 73 63             	data16 jae 804db6 <__rodata_start+0x136>
+  804d53:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d54:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d55:	63 62 65             	movsxd 0x65(%rdx),%esp
+  804d58:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d59:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804d5c:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a087d5 <__bss_end+0x251b67d5>
+  804d62:	6c                   	insb   (%dx),%es:(%rdi)
+  804d63:	75 20                	jne    804d85 <__rodata_start+0x105>
+  804d65:	72 65                	jb     804dcc <__rodata_start+0x14c>
+  804d67:	61                   	(bad)
+  804d68:	64 73 2c             	fs jae 804d97 <__rodata_start+0x117>
+  804d6b:	20 25 6c 75 20 63    	and    %ah,0x6320756c(%rip)        # 63a0c2dd <__bss_end+0x631ba2dd>
+  804d71:	79 63                	jns    804dd6 <__rodata_start+0x156>
+  804d73:	6c                   	insb   (%dx),%es:(%rdi)
+  804d74:	65 73 20             	gs jae 804d97 <__rodata_start+0x117>
+  804d77:	70 65                	jo     804dde <__rodata_start+0x15e>
+  804d79:	72 20                	jb     804d9b <__rodata_start+0x11b>
+  804d7b:	72 65                	jb     804de2 <__rodata_start+0x162>
+  804d7d:	61                   	(bad)
+  804d7e:	64 2c 20             	fs sub $0x20,%al
+  804d81:	25 6c 75 20 61       	and    $0x6120756c,%eax
+  804d86:	74 20                	je     804da8 <__rodata_start+0x128>
+  804d88:	77 6f                	ja     804df9 <__rodata_start+0x179>
+  804d8a:	72 73                	jb     804dff <__rodata_start+0x17f>
+  804d8c:	74 0a                	je     804d98 <__rodata_start+0x118>
+  804d8e:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804d95:	77 6e                	ja     804e05 <__rodata_start+0x185>
+  804d97:	3e 00 0f             	ds add %cl,(%rdi)
+  804d9a:	1f                   	(bad)
+  804d9b:	80 00 00             	addb   $0x0,(%rax)
+  804d9e:	00 00                	add    %al,(%rax)
+  804da0:	5b                   	pop    %rbx
+  804da1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804da6:	20 75 73             	and    %dh,0x73(%rbp)
+  804da9:	65 72 20             	gs jb  804dcc <__rodata_start+0x14c>
+  804dac:	70 61                	jo     804e0f <__rodata_start+0x18f>
+  804dae:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804daf:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804db6:	73 20                	jae    804dd8 <__rodata_start+0x158>
+  804db8:	61                   	(bad)
+  804db9:	74 20                	je     804ddb <__rodata_start+0x15b>
+  804dbb:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804dc0:	3a 20                	cmp    (%rax),%ah
+  804dc2:	00 30                	add    %dh,(%rax)
+  804dc4:	31 32                	xor    %esi,(%rdx)
+  804dc6:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804dcd:	41                   	rex.B
+  804dce:	42                   	rex.X
+  804dcf:	43                   	rex.XB
+  804dd0:	44                   	rex.R
+  804dd1:	45                   	rex.RB
+  804dd2:	46 00 30             	rex.RX add %r14b,(%rax)
+  804dd5:	31 32                	xor    %esi,(%rdx)
+  804dd7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804dde:	61                   	(bad)
+  804ddf:	62 63 64 65 66       	(bad)
+  804de4:	00 28                	add    %ch,(%rax)
+  804de6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804de7:	75 6c                	jne    804e55 <__rodata_start+0x1d5>
+  804de9:	6c                   	insb   (%dx),%es:(%rdi)
+  804dea:	29 00                	sub    %eax,(%rax)
+  804dec:	65 72 72             	gs jb  804e61 <__rodata_start+0x1e1>
+  804def:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804df0:	72 20                	jb     804e12 <__rodata_start+0x192>
+  804df2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804df7:	73 70                	jae    804e69 <__rodata_start+0x1e9>
+  804df9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804dfd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804e04:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e05:	72 00                	jb     804e07 <__rodata_start+0x187>
+  804e07:	62 61 64 20 65       	(bad)
+  804e0c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e0d:	76 69                	jbe    804e78 <__rodata_start+0x1f8>
+  804e0f:	72 6f                	jb     804e80 <__rodata_start+0x200>
+  804e11:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e12:	6d                   	insl   (%dx),%es:(%rdi)
+  804e13:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e15:	74 00                	je     804e17 <__rodata_start+0x197>
+  804e17:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804e1e:	20 70 61             	and    %dh,0x61(%rax)
+  804e21:	72 61                	jb     804e84 <__rodata_start+0x204>
+  804e23:	6d                   	insl   (%dx),%es:(%rdi)
+  804e24:	65 74 65             	gs je  804e8c <__rodata_start+0x20c>
+  804e27:	72 00                	jb     804e29 <__rodata_start+0x1a9>
+  804e29:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e2a:	75 74                	jne    804ea0 <__rodata_start+0x220>
+  804e2c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804e2f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804e32:	6d                   	insl   (%dx),%es:(%rdi)
+  804e33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e34:	72 79                	jb     804eaf <__rodata_start+0x22f>
+  804e36:	00 6f 75             	add    %ch,0x75(%rdi)
+  804e39:	74 20                	je     804e5b <__rodata_start+0x1db>
+  804e3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e3c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804e40:	76 69                	jbe    804eab <__rodata_start+0x22b>
+  804e42:	72 6f                	jb     804eb3 <__rodata_start+0x233>
+  804e44:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e45:	6d                   	insl   (%dx),%es:(%rdi)
+  804e46:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e48:	74 73                	je     804ebd <__rodata_start+0x23d>
+  804e4a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804e4d:	72 72                	jb     804ec1 <__rodata_start+0x241>
+  804e4f:	75 70                	jne    804ec1 <__rodata_start+0x241>
+  804e51:	74 65                	je     804eb8 <__rodata_start+0x238>
+  804e53:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804e58:	75 67                	jne    804ec1 <__rodata_start+0x241>
+  804e5a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804e5d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804e5f:	00 73 65             	add    %dh,0x65(%rbx)
+  804e62:	67 6d                	insl   (%dx),%es:(%edi)
+  804e64:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804e66:	74 61                	je     804ec9 <__rodata_start+0x249>
+  804e68:	74 69                	je     804ed3 <__rodata_start+0x253>
+  804e6a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e6c:	20 66 61             	and    %ah,0x61(%rsi)
+  804e6f:	75 6c                	jne    804edd <__rodata_start+0x25d>
+  804e71:	74 00                	je     804e73 <__rodata_start+0x1f3>
+  804e73:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804e7a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804e7d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804e81:	61                   	(bad)
+  804e82:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804e87:	20 73 75             	and    %dh,0x75(%rbx)
+  804e8a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804e8d:	73 79                	jae    804f08 <__rodata_start+0x288>
+  804e8f:	73 74                	jae    804f05 <__rodata_start+0x285>
+  804e91:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804e93:	20 63 61             	and    %ah,0x61(%rbx)
+  804e96:	6c                   	insb   (%dx),%es:(%rdi)
+  804e97:	6c                   	insb   (%dx),%es:(%rdi)
+  804e98:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804e9b:	74 72                	je     804f0f <__rodata_start+0x28f>
+  804e9d:	79 20                	jns    804ebf <__rodata_start+0x23f>
+  804e9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ea0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ea1:	74 20                	je     804ec3 <__rodata_start+0x243>
+  804ea3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ea5:	75 6e                	jne    804f15 <__rodata_start+0x295>
+  804ea7:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804eab:	76 20                	jbe    804ecd <__rodata_start+0x24d>
+  804ead:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804eb4:	72 65                	jb     804f1b <__rodata_start+0x29b>
+  804eb6:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804eb9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eba:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804ebe:	65 78 70             	gs js  804f31 <__rodata_start+0x2b1>
+  804ec1:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804ec6:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804ec9:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804ecd:	20 66 69             	and    %ah,0x69(%rsi)
+  804ed0:	6c                   	insb   (%dx),%es:(%rdi)
+  804ed1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804ed5:	20 66 72             	and    %ah,0x72(%rsi)
+  804ed8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804edd:	61                   	(bad)
+  804ede:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804ee1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ee2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ee3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804ee7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804eea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eec:	20 6d 61             	and    %ch,0x61(%rbp)
+  804eef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ef0:	79 20                	jns    804f12 <__rodata_start+0x292>
+  804ef2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804ef9:	72 65                	jb     804f60 <__rodata_start+0x2e0>
+  804efb:	20 6f 70             	and    %ch,0x70(%rdi)
+  804efe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f00:	00 66 69             	add    %ah,0x69(%rsi)
+  804f03:	6c                   	insb   (%dx),%es:(%rdi)
+  804f04:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804f08:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804f0b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f0c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804f0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f11:	74 20                	je     804f33 <__rodata_start+0x2b3>
+  804f13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f15:	75 6e                	jne    804f85 <__rodata_start+0x305>
+  804f17:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804f1b:	76 61                	jbe    804f7e <__rodata_start+0x2fe>
+  804f1d:	6c                   	insb   (%dx),%es:(%rdi)
+  804f1e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804f25:	00 
+  804f26:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804f2d:	72 65                	jb     804f94 <__rodata_start+0x314>
+  804f2f:	61                   	(bad)
+  804f30:	64 79 20             	fs jns 804f53 <__rodata_start+0x2d3>
+  804f33:	65 78 69             	gs js  804f9f <__rodata_start+0x31f>
+  804f36:	73 74                	jae    804fac <__rodata_start+0x32c>
+  804f38:	73 00                	jae    804f3a <__rodata_start+0x2ba>
+  804f3a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f3b:	70 65                	jo     804fa2 <__rodata_start+0x322>
+  804f3d:	72 61                	jb     804fa0 <__rodata_start+0x320>
+  804f3f:	74 69                	je     804faa <__rodata_start+0x32a>
+  804f41:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f42:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f43:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804f46:	74 20                	je     804f68 <__rodata_start+0x2e8>
+  804f48:	73 75                	jae    804fbf <__rodata_start+0x33f>
+  804f4a:	70 70                	jo     804fbc <__rodata_start+0x33c>
+  804f4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f4d:	72 74                	jb     804fc3 <__rodata_start+0x343>
+  804f4f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804f55:	20 61 67             	and    %ah,0x67(%rcx)
+  804f58:	61                   	(bad)
+  804f59:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804f60:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804f64:	74 00                	je     804f66 <__rodata_start+0x2e6>
+  804f66:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804f6d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804f70:	20 75 73             	and    %dh,0x73(%rbp)
+  804f73:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804f77:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804f7e:	00 
+  804f7f:	90                   	nop
+  804f80:	18 08                	sbb    %cl,(%rax)
+  804f82:	80 00 00             	addb   $0x0,(%rax)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 59 0e             	add    %bl,0xe(%rcx)
+  804f8a:	80 00 00             	addb   $0x0,(%rax)
+  804f8d:	00 00                	add    %al,(%rax)
+  804f8f:	00 49 0e             	add    %cl,0xe(%rcx)
+  804f92:	80 00 00             	addb   $0x0,(%rax)
+  804f95:	00 00                	add    %al,(%rax)
+  804f97:	00 59 0e             	add    %bl,0xe(%rcx)
+  804f9a:	80 00 00             	addb   $0x0,(%rax)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 59 0e             	add    %bl,0xe(%rcx)
+  804fa2:	80 00 00             	addb   $0x0,(%rax)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 59 0e             	add    %bl,0xe(%rcx)
+  804faa:	80 00 00             	addb   $0x0,(%rax)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 59 0e             	add    %bl,0xe(%rcx)
+  804fb2:	80 00 00             	addb   $0x0,(%rax)
+  804fb5:	00 00                	add    %al,(%rax)
+  804fb7:	00 37                	add    %dh,(%rdi)
+  804fb9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804fbf:	00 59 0e             	add    %bl,0xe(%rcx)
+  804fc2:	80 00 00             	addb   $0x0,(%rax)
+  804fc5:	00 00                	add    %al,(%rax)
+  804fc7:	00 59 0e             	add    %bl,0xe(%rcx)
+  804fca:	80 00 00             	addb   $0x0,(%rax)
+  804fcd:	00 00                	add    %al,(%rax)
+  804fcf:	00 2b                	add    %ch,(%rbx)
+  804fd1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804fd7:	00 a5 08 80 00 00    	add    %ah,0x8008(%rbp)
+  804fdd:	00 00                	add    %al,(%rax)
+  804fdf:	00 59 0e             	add    %bl,0xe(%rcx)
+  804fe2:	80 00 00             	addb   $0x0,(%rax)
+  804fe5:	00 00                	add    %al,(%rax)
+  804fe7:	00 2b                	add    %ch,(%rbx)
+  804fe9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804fef:	00 71 08             	add    %dh,0x8(%rcx)
+  804ff2:	80 00 00             	addb   $0x0,(%rax)
+  804ff5:	00 00                	add    %al,(%rax)
+  804ff7:	00 71 08             	add    %dh,0x8(%rcx)
+  804ffa:	80 00 00             	addb   $0x0,(%rax)
+  804ffd:	00 00                	add    %al,(%rax)
+  804fff:	00 71 08             	add    %dh,0x8(%rcx)
+  805002:	80 00 00             	addb   $0x0,(%rax)
+  805005:	00 00                	add    %al,(%rax)
+  805007:	00 71 08             	add    %dh,0x8(%rcx)
+  80500a:	80 00 00             	addb   $0x0,(%rax)
+  80500d:	00 00                	add    %al,(%rax)
+  80500f:	00 71 08             	add    %dh,0x8(%rcx)
+  805012:	80 00 00             	addb   $0x0,(%rax)
+  805015:	00 00                	add    %al,(%rax)
+  805017:	00 71 08             	add    %dh,0x8(%rcx)
+  80501a:	80 00 00             	addb   $0x0,(%rax)
+  80501d:	00 00                	add    %al,(%rax)
+  80501f:	00 71 08             	add    %dh,0x8(%rcx)
+  805022:	80 00 00             	addb   $0x0,(%rax)
+  805025:	00 00                	add    %al,(%rax)
+  805027:	00 71 08             	add    %dh,0x8(%rcx)
+  80502a:	80 00 00             	addb   $0x0,(%rax)
+  80502d:	00 00                	add    %al,(%rax)
+  80502f:	00 71 08             	add    %dh,0x8(%rcx)
+  805032:	80 00 00             	addb   $0x0,(%rax)
+  805035:	00 00                	add    %al,(%rax)
+  805037:	00 59 0e             	add    %bl,0xe(%rcx)
+  80503a:	80 00 00             	addb   $0x0,(%rax)
+  80503d:	00 00                	add    %al,(%rax)
+  80503f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805042:	80 00 00             	addb   $0x0,(%rax)
+  805045:	00 00                	add    %al,(%rax)
+  805047:	00 59 0e             	add    %bl,0xe(%rcx)
+  80504a:	80 00 00             	addb   $0x0,(%rax)
+  80504d:	00 00                	add    %al,(%rax)
+  80504f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805052:	80 00 00             	addb   $0x0,(%rax)
+  805055:	00 00                	add    %al,(%rax)
+  805057:	00 59 0e             	add    %bl,0xe(%rcx)
+  80505a:	80 00 00             	addb   $0x0,(%rax)
+  80505d:	00 00                	add    %al,(%rax)
+  80505f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805062:	80 00 00             	addb   $0x0,(%rax)
+  805065:	00 00                	add    %al,(%rax)
+  805067:	00 59 0e             	add    %bl,0xe(%rcx)
+  80506a:	80 00 00             	addb   $0x0,(%rax)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805072:	80 00 00             	addb   $0x0,(%rax)
+  805075:	00 00                	add    %al,(%rax)
+  805077:	00 59 0e             	add    %bl,0xe(%rcx)
+  80507a:	80 00 00             	addb   $0x0,(%rax)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805082:	80 00 00             	addb   $0x0,(%rax)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 59 0e             	add    %bl,0xe(%rcx)
+  80508a:	80 00 00             	addb   $0x0,(%rax)
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805092:	80 00 00             	addb   $0x0,(%rax)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 59 0e             	add    %bl,0xe(%rcx)
+  80509a:	80 00 00             	addb   $0x0,(%rax)
+  80509d:	00 00                	add    %al,(%rax)
+  80509f:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050a2:	80 00 00             	addb   $0x0,(%rax)
+  8050a5:	00 00                	add    %al,(%rax)
+  8050a7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050aa:	80 00 00             	addb   $0x0,(%rax)
+  8050ad:	00 00                	add    %al,(%rax)
+  8050af:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050b2:	80 00 00             	addb   $0x0,(%rax)
+  8050b5:	00 00                	add    %al,(%rax)
+  8050b7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050ba:	80 00 00             	addb   $0x0,(%rax)
+  8050bd:	00 00                	add    %al,(%rax)
+  8050bf:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050c2:	80 00 00             	addb   $0x0,(%rax)
+  8050c5:	00 00                	add    %al,(%rax)
+  8050c7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050ca:	80 00 00             	addb   $0x0,(%rax)
+  8050cd:	00 00                	add    %al,(%rax)
+  8050cf:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050d2:	80 00 00             	addb   $0x0,(%rax)
+  8050d5:	00 00                	add    %al,(%rax)
+  8050d7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050da:	80 00 00             	addb   $0x0,(%rax)
+  8050dd:	00 00                	add    %al,(%rax)
+  8050df:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050e2:	80 00 00             	addb   $0x0,(%rax)
+  8050e5:	00 00                	add    %al,(%rax)
+  8050e7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050ea:	80 00 00             	addb   $0x0,(%rax)
+  8050ed:	00 00                	add    %al,(%rax)
+  8050ef:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050f2:	80 00 00             	addb   $0x0,(%rax)
+  8050f5:	00 00                	add    %al,(%rax)
+  8050f7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8050fa:	80 00 00             	addb   $0x0,(%rax)
+  8050fd:	00 00                	add    %al,(%rax)
+  8050ff:	00 59 0e             	add    %bl,0xe(%rcx)
+  805102:	80 00 00             	addb   $0x0,(%rax)
+  805105:	00 00                	add    %al,(%rax)
+  805107:	00 59 0e             	add    %bl,0xe(%rcx)
+  80510a:	80 00 00             	addb   $0x0,(%rax)
+  80510d:	00 00                	add    %al,(%rax)
+  80510f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805112:	80 00 00             	addb   $0x0,(%rax)
+  805115:	00 00                	add    %al,(%rax)
+  805117:	00 59 0e             	add    %bl,0xe(%rcx)
+  80511a:	80 00 00             	addb   $0x0,(%rax)
+  80511d:	00 00                	add    %al,(%rax)
+  80511f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805122:	80 00 00             	addb   $0x0,(%rax)
+  805125:	00 00                	add    %al,(%rax)
+  805127:	00 7c 0d 80          	add    %bh,-0x80(%rbp,%rcx,1)
+  80512b:	00 00                	add    %al,(%rax)
+  80512d:	00 00                	add    %al,(%rax)
+  80512f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805132:	80 00 00             	addb   $0x0,(%rax)
+  805135:	00 00                	add    %al,(%rax)
+  805137:	00 59 0e             	add    %bl,0xe(%rcx)
+  80513a:	80 00 00             	addb   $0x0,(%rax)
+  80513d:	00 00                	add    %al,(%rax)
+  80513f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805142:	80 00 00             	addb   $0x0,(%rax)
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 59 0e             	add    %bl,0xe(%rcx)
+  80514a:	80 00 00             	addb   $0x0,(%rax)
+  80514d:	00 00                	add    %al,(%rax)
+  80514f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805152:	80 00 00             	addb   $0x0,(%rax)
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 59 0e             	add    %bl,0xe(%rcx)
+  80515a:	80 00 00             	addb   $0x0,(%rax)
+  80515d:	00 00                	add    %al,(%rax)
+  80515f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805162:	80 00 00             	addb   $0x0,(%rax)
+  805165:	00 00                	add    %al,(%rax)
+  805167:	00 59 0e             	add    %bl,0xe(%rcx)
+  80516a:	80 00 00             	addb   $0x0,(%rax)
+  80516d:	00 00                	add    %al,(%rax)
+  80516f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805172:	80 00 00             	addb   $0x0,(%rax)
+  805175:	00 00                	add    %al,(%rax)
+  805177:	00 59 0e             	add    %bl,0xe(%rcx)
+  80517a:	80 00 00             	addb   $0x0,(%rax)
+  80517d:	00 00                	add    %al,(%rax)
+  80517f:	00 c8                	add    %cl,%al
+  805181:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805187:	00 97 0a 80 00 00    	add    %dl,0x800a(%rdi)
+  80518d:	00 00                	add    %al,(%rax)
+  80518f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805192:	80 00 00             	addb   $0x0,(%rax)
+  805195:	00 00                	add    %al,(%rax)
+  805197:	00 59 0e             	add    %bl,0xe(%rcx)
+  80519a:	80 00 00             	addb   $0x0,(%rax)
+  80519d:	00 00                	add    %al,(%rax)
+  80519f:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051a2:	80 00 00             	addb   $0x0,(%rax)
+  8051a5:	00 00                	add    %al,(%rax)
+  8051a7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051aa:	80 00 00             	addb   $0x0,(%rax)
+  8051ad:	00 00                	add    %al,(%rax)
+  8051af:	00 f7                	add    %dh,%bh
+  8051b1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8051b7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051ba:	80 00 00             	addb   $0x0,(%rax)
+  8051bd:	00 00                	add    %al,(%rax)
+  8051bf:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051c2:	80 00 00             	addb   $0x0,(%rax)
+  8051c5:	00 00                	add    %al,(%rax)
+  8051c7:	00 bd 08 80 00 00    	add    %bh,0x8008(%rbp)
+  8051cd:	00 00                	add    %al,(%rax)
+  8051cf:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051d2:	80 00 00             	addb   $0x0,(%rax)
+  8051d5:	00 00                	add    %al,(%rax)
+  8051d7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051da:	80 00 00             	addb   $0x0,(%rax)
+  8051dd:	00 00                	add    %al,(%rax)
+  8051df:	00 3f                	add    %bh,(%rdi)
+  8051e1:	0c 80                	or     $0x80,%al
+  8051e3:	00 00                	add    %al,(%rax)
+  8051e5:	00 00                	add    %al,(%rax)
+  8051e7:	00 09                	add    %cl,(%rcx)
+  8051e9:	0d 80 00 00 00       	or     $0x80,%eax
+  8051ee:	00 00                	add    %al,(%rax)
+  8051f0:	59                   	pop    %rcx
+  8051f1:	0e                   	(bad)
+  8051f2:	80 00 00             	addb   $0x0,(%rax)
+  8051f5:	00 00                	add    %al,(%rax)
+  8051f7:	00 59 0e             	add    %bl,0xe(%rcx)
+  8051fa:	80 00 00             	addb   $0x0,(%rax)
+  8051fd:	00 00                	add    %al,(%rax)
+  8051ff:	00 8e 09 80 00 00    	add    %cl,0x8009(%rsi)
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 59 0e             	add    %bl,0xe(%rcx)
+  80520a:	80 00 00             	addb   $0x0,(%rax)
+  80520d:	00 00                	add    %al,(%rax)
+  80520f:	00 6b 0b             	add    %ch,0xb(%rbx)
+  805212:	80 00 00             	addb   $0x0,(%rax)
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 59 0e             	add    %bl,0xe(%rcx)
+  80521a:	80 00 00             	addb   $0x0,(%rax)
+  80521d:	00 00                	add    %al,(%rax)
+  80521f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805222:	80 00 00             	addb   $0x0,(%rax)
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 7c 0d 80          	add    %bh,-0x80(%rbp,%rcx,1)
+  80522b:	00 00                	add    %al,(%rax)
+  80522d:	00 00                	add    %al,(%rax)
+  80522f:	00 59 0e             	add    %bl,0xe(%rcx)
+  805232:	80 00 00             	addb   $0x0,(%rax)
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 21                	add    %ah,(%rcx)
+  805239:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+	...
+
+0000000000805240 <error_string>:
+	...
+  805248:	f5 4d 80 00 00 00 00 00 07 4e 80 00 00 00 00 00     .M.......N......
+  805258:	17 4e 80 00 00 00 00 00 29 4e 80 00 00 00 00 00     .N......)N......
+  805268:	37 4e 80 00 00 00 00 00 4b 4e 80 00 00 00 00 00     7N......KN......
+  805278:	60 4e 80 00 00 00 00 00 73 4e 80 00 00 00 00 00     `N......sN......
+  805288:	85 4e 80 00 00 00 00 00 99 4e 80 00 00 00 00 00     .N.......N......
+  805298:	a9 4e 80 00 00 00 00 00 bc 4e 80 00 00 00 00 00     .N.......N......
+  8052a8:	d3 4e 80 00 00 00 00 00 e9 4e 80 00 00 00 00 00     .N.......N......
+  8052b8:	01 4f 80 00 00 00 00 00 19 4f 80 00 00 00 00 00     .O.......O......
+  8052c8:	26 4f 80 00 00 00 00 00 f8 52 80 00 00 00 00 00     &O.......R......
+  8052d8:	3a 4f 80 00 00 00 00 00 52 4f 80 00 00 00 00 00     :O......RO......
+  8052e8:	5c 4f 80 00 00 00 00 00 66 4f 80 00 00 00 00 00     \O......fO......
+  8052f8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805308:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805318:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805328:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805338:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805348:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805358:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805368:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805378:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805388:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805398:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8053a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8053b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8053c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8053d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8053e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805400 <devtab>:
+  805400:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805410:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805420:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805430:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805440:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805450:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805460:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805470:	3d 20 32 00 65 6e 76 69 64 20 21 3d 20 30 00 6c     = 2.envid != 0.l
+  805480:	69 62 2f 77 61 69 74 2e 63 00 3c 63 6f 6e 73 3e     ib/wait.c.<cons>
+  805490:	00 63 6f 6e 73 00 66 90 55 73 65 72 73 70 61 63     .cons.f.Userspac
+  8054a0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8054b0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8054c0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8054d0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8054e0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8054f0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805500:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805510:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805520:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
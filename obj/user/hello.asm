@@ -0,0 +1,8159 @@
+
+obj/user/hello:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4d 00 00 00       	call   800070 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+/* hello, world */
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    cprintf("hello, world\n");
+  80002e:	48 bf d0 46 80 00 00 	movabs $0x8046d0,%rdi
+  800035:	00 00 00 
+  800038:	b8 00 00 00 00       	mov    $0x0,%eax
+  80003d:	48 bb f3 01 80 00 00 	movabs $0x8001f3,%rbx
+  800044:	00 00 00 
+  800047:	ff d3                	call   *%rbx
+    cprintf("i am environment %08x\n", thisenv->env_id);
+  800049:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800050:	00 00 00 
+  800053:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800059:	48 bf de 46 80 00 00 	movabs $0x8046de,%rdi
+  800060:	00 00 00 
+  800063:	b8 00 00 00 00       	mov    $0x0,%eax
+  800068:	ff d3                	call   *%rbx
+}
+  80006a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80006e:	c9                   	leave
+  80006f:	c3                   	ret
+
+0000000000800070 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800070:	55                   	push   %rbp
+  800071:	48 89 e5             	mov    %rsp,%rbp
+  800074:	41 56                	push   %r14
+  800076:	41 55                	push   %r13
+  800078:	41 54                	push   %r12
+  80007a:	53                   	push   %rbx
+  80007b:	41 89 fd             	mov    %edi,%r13d
+  80007e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800081:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800088:	00 00 00 
+  80008b:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800092:	00 00 00 
+  800095:	48 39 c2             	cmp    %rax,%rdx
+  800098:	73 17                	jae    8000b1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80009a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80009d:	49 89 c4             	mov    %rax,%r12
+  8000a0:	48 83 c3 08          	add    $0x8,%rbx
+  8000a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a9:	ff 53 f8             	call   *-0x8(%rbx)
+  8000ac:	4c 39 e3             	cmp    %r12,%rbx
+  8000af:	72 ef                	jb     8000a0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8000b1:	48 b8 ea 0f 80 00 00 	movabs $0x800fea,%rax
+  8000b8:	00 00 00 
+  8000bb:	ff d0                	call   *%rax
+  8000bd:	89 c2                	mov    %eax,%edx
+  8000bf:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000c5:	48 89 d0             	mov    %rdx,%rax
+  8000c8:	48 c1 e0 04          	shl    $0x4,%rax
+  8000cc:	48 29 d0             	sub    %rdx,%rax
+  8000cf:	48 c1 e0 05          	shl    $0x5,%rax
+  8000d3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000da:	00 00 00 
+  8000dd:	48 01 d0             	add    %rdx,%rax
+  8000e0:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000e7:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000ea:	45 85 ed             	test   %r13d,%r13d
+  8000ed:	7e 0d                	jle    8000fc <libmain+0x8c>
+  8000ef:	49 8b 06             	mov    (%r14),%rax
+  8000f2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000f9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000fc:	4c 89 f6             	mov    %r14,%rsi
+  8000ff:	44 89 ef             	mov    %r13d,%edi
+  800102:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800109:	00 00 00 
+  80010c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80010e:	48 b8 23 01 80 00 00 	movabs $0x800123,%rax
+  800115:	00 00 00 
+  800118:	ff d0                	call   *%rax
+#endif
+}
+  80011a:	5b                   	pop    %rbx
+  80011b:	41 5c                	pop    %r12
+  80011d:	41 5d                	pop    %r13
+  80011f:	41 5e                	pop    %r14
+  800121:	5d                   	pop    %rbp
+  800122:	c3                   	ret
+
+0000000000800123 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800123:	55                   	push   %rbp
+  800124:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800127:	48 b8 d0 16 80 00 00 	movabs $0x8016d0,%rax
+  80012e:	00 00 00 
+  800131:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800133:	bf 00 00 00 00       	mov    $0x0,%edi
+  800138:	48 b8 87 0f 80 00 00 	movabs $0x800f87,%rax
+  80013f:	00 00 00 
+  800142:	ff d0                	call   *%rax
+}
+  800144:	5d                   	pop    %rbp
+  800145:	c3                   	ret
+
+0000000000800146 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800146:	55                   	push   %rbp
+  800147:	48 89 e5             	mov    %rsp,%rbp
+  80014a:	53                   	push   %rbx
+  80014b:	48 83 ec 08          	sub    $0x8,%rsp
+  80014f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800152:	8b 06                	mov    (%rsi),%eax
+  800154:	8d 50 01             	lea    0x1(%rax),%edx
+  800157:	89 16                	mov    %edx,(%rsi)
+  800159:	48 98                	cltq
+  80015b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800160:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800166:	74 0a                	je     800172 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800168:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80016c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800170:	c9                   	leave
+  800171:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800172:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800176:	be ff 00 00 00       	mov    $0xff,%esi
+  80017b:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  800182:	00 00 00 
+  800185:	ff d0                	call   *%rax
+        state->offset = 0;
+  800187:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80018d:	eb d9                	jmp    800168 <putch+0x22>
+
+000000000080018f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80018f:	55                   	push   %rbp
+  800190:	48 89 e5             	mov    %rsp,%rbp
+  800193:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80019a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80019d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8001a4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ae:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8001b1:	48 89 f1             	mov    %rsi,%rcx
+  8001b4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8001bb:	48 bf 46 01 80 00 00 	movabs $0x800146,%rdi
+  8001c2:	00 00 00 
+  8001c5:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  8001cc:	00 00 00 
+  8001cf:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8001d1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8001d8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8001df:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  8001e6:	00 00 00 
+  8001e9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8001eb:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8001f1:	c9                   	leave
+  8001f2:	c3                   	ret
+
+00000000008001f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8001f3:	55                   	push   %rbp
+  8001f4:	48 89 e5             	mov    %rsp,%rbp
+  8001f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8001fb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8001ff:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800203:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800207:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80020b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80020f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800216:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80021a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80021e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800222:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800226:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80022a:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  800231:	00 00 00 
+  800234:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+
+0000000000800238 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800238:	55                   	push   %rbp
+  800239:	48 89 e5             	mov    %rsp,%rbp
+  80023c:	41 57                	push   %r15
+  80023e:	41 56                	push   %r14
+  800240:	41 55                	push   %r13
+  800242:	41 54                	push   %r12
+  800244:	53                   	push   %rbx
+  800245:	48 83 ec 18          	sub    $0x18,%rsp
+  800249:	49 89 fc             	mov    %rdi,%r12
+  80024c:	49 89 f5             	mov    %rsi,%r13
+  80024f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800253:	8b 45 10             	mov    0x10(%rbp),%eax
+  800256:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800259:	41 89 cf             	mov    %ecx,%r15d
+  80025c:	4c 39 fa             	cmp    %r15,%rdx
+  80025f:	73 5b                	jae    8002bc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800261:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800265:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800269:	85 db                	test   %ebx,%ebx
+  80026b:	7e 0e                	jle    80027b <print_num+0x43>
+            putch(padc, put_arg);
+  80026d:	4c 89 ee             	mov    %r13,%rsi
+  800270:	44 89 f7             	mov    %r14d,%edi
+  800273:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800276:	83 eb 01             	sub    $0x1,%ebx
+  800279:	75 f2                	jne    80026d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80027b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80027f:	48 b9 10 47 80 00 00 	movabs $0x804710,%rcx
+  800286:	00 00 00 
+  800289:	48 b8 ff 46 80 00 00 	movabs $0x8046ff,%rax
+  800290:	00 00 00 
+  800293:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800297:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80029b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002a0:	49 f7 f7             	div    %r15
+  8002a3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8002a7:	4c 89 ee             	mov    %r13,%rsi
+  8002aa:	41 ff d4             	call   *%r12
+}
+  8002ad:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8002b1:	5b                   	pop    %rbx
+  8002b2:	41 5c                	pop    %r12
+  8002b4:	41 5d                	pop    %r13
+  8002b6:	41 5e                	pop    %r14
+  8002b8:	41 5f                	pop    %r15
+  8002ba:	5d                   	pop    %rbp
+  8002bb:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8002bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8002c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002c5:	49 f7 f7             	div    %r15
+  8002c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8002cc:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8002d0:	52                   	push   %rdx
+  8002d1:	45 0f be c9          	movsbl %r9b,%r9d
+  8002d5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8002d9:	48 89 c2             	mov    %rax,%rdx
+  8002dc:	48 b8 38 02 80 00 00 	movabs $0x800238,%rax
+  8002e3:	00 00 00 
+  8002e6:	ff d0                	call   *%rax
+  8002e8:	48 83 c4 10          	add    $0x10,%rsp
+  8002ec:	eb 8d                	jmp    80027b <print_num+0x43>
+
+00000000008002ee <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8002ee:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8002f2:	48 8b 06             	mov    (%rsi),%rax
+  8002f5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8002f9:	73 0a                	jae    800305 <sprintputch+0x17>
+        *state->start++ = ch;
+  8002fb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8002ff:	48 89 16             	mov    %rdx,(%rsi)
+  800302:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800305:	c3                   	ret
+
+0000000000800306 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800306:	55                   	push   %rbp
+  800307:	48 89 e5             	mov    %rsp,%rbp
+  80030a:	48 83 ec 50          	sub    $0x50,%rsp
+  80030e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800312:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800316:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80031a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800321:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800325:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800329:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80032d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800331:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800335:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  80033c:	00 00 00 
+  80033f:	ff d0                	call   *%rax
+}
+  800341:	c9                   	leave
+  800342:	c3                   	ret
+
+0000000000800343 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800343:	55                   	push   %rbp
+  800344:	48 89 e5             	mov    %rsp,%rbp
+  800347:	41 57                	push   %r15
+  800349:	41 56                	push   %r14
+  80034b:	41 55                	push   %r13
+  80034d:	41 54                	push   %r12
+  80034f:	53                   	push   %rbx
+  800350:	48 83 ec 38          	sub    $0x38,%rsp
+  800354:	49 89 fe             	mov    %rdi,%r14
+  800357:	49 89 f5             	mov    %rsi,%r13
+  80035a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80035d:	48 8b 01             	mov    (%rcx),%rax
+  800360:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800364:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800368:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80036c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800370:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800374:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800378:	0f b6 3b             	movzbl (%rbx),%edi
+  80037b:	40 80 ff 25          	cmp    $0x25,%dil
+  80037f:	74 18                	je     800399 <vprintfmt+0x56>
+            if (!ch) return;
+  800381:	40 84 ff             	test   %dil,%dil
+  800384:	0f 84 b1 06 00 00    	je     800a3b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80038a:	40 0f b6 ff          	movzbl %dil,%edi
+  80038e:	4c 89 ee             	mov    %r13,%rsi
+  800391:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800394:	4c 89 e3             	mov    %r12,%rbx
+  800397:	eb db                	jmp    800374 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800399:	be 00 00 00 00       	mov    $0x0,%esi
+  80039e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8003a2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8003a7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8003ad:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8003b4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003b8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8003bd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8003c2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8003c5:	83 e8 23             	sub    $0x23,%eax
+  8003c8:	3c 57                	cmp    $0x57,%al
+  8003ca:	0f 87 51 06 00 00    	ja     800a21 <vprintfmt+0x6de>
+  8003d0:	0f b6 c0             	movzbl %al,%eax
+  8003d3:	48 b9 c0 48 80 00 00 	movabs $0x8048c0,%rcx
+  8003da:	00 00 00 
+  8003dd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8003e0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8003e3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8003e7:	eb cf                	jmp    8003b8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8003e9:	49 89 dc             	mov    %rbx,%r12
+  8003ec:	be 01 00 00 00       	mov    $0x1,%esi
+  8003f1:	eb c5                	jmp    8003b8 <vprintfmt+0x75>
+            padc = ch;
+  8003f3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8003f7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8003fa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8003fd:	eb b9                	jmp    8003b8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8003ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800402:	83 f8 2f             	cmp    $0x2f,%eax
+  800405:	77 24                	ja     80042b <vprintfmt+0xe8>
+  800407:	89 c1                	mov    %eax,%ecx
+  800409:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80040d:	83 c0 08             	add    $0x8,%eax
+  800410:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800413:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800416:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800419:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80041d:	79 99                	jns    8003b8 <vprintfmt+0x75>
+                width = precision;
+  80041f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800423:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800429:	eb 8d                	jmp    8003b8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80042b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80042f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800433:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800437:	eb da                	jmp    800413 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800439:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80043e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800442:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800448:	3c 39                	cmp    $0x39,%al
+  80044a:	77 1c                	ja     800468 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80044c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800450:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800454:	0f b6 c0             	movzbl %al,%eax
+  800457:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80045c:	0f b6 03             	movzbl (%rbx),%eax
+  80045f:	3c 39                	cmp    $0x39,%al
+  800461:	76 e9                	jbe    80044c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800463:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800466:	eb b1                	jmp    800419 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800468:	49 89 dc             	mov    %rbx,%r12
+  80046b:	eb ac                	jmp    800419 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80046d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800470:	85 c9                	test   %ecx,%ecx
+  800472:	b8 00 00 00 00       	mov    $0x0,%eax
+  800477:	0f 49 c1             	cmovns %ecx,%eax
+  80047a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80047d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800480:	e9 33 ff ff ff       	jmp    8003b8 <vprintfmt+0x75>
+            lflag++;
+  800485:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800488:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80048b:	e9 28 ff ff ff       	jmp    8003b8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800490:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800493:	83 f8 2f             	cmp    $0x2f,%eax
+  800496:	77 19                	ja     8004b1 <vprintfmt+0x16e>
+  800498:	89 c2                	mov    %eax,%edx
+  80049a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80049e:	83 c0 08             	add    $0x8,%eax
+  8004a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004a4:	8b 3a                	mov    (%rdx),%edi
+  8004a6:	4c 89 ee             	mov    %r13,%rsi
+  8004a9:	41 ff d6             	call   *%r14
+            break;
+  8004ac:	e9 c3 fe ff ff       	jmp    800374 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8004b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8004b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8004b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004bd:	eb e5                	jmp    8004a4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8004bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8004c5:	77 5a                	ja     800521 <vprintfmt+0x1de>
+  8004c7:	89 c2                	mov    %eax,%edx
+  8004c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8004cd:	83 c0 08             	add    $0x8,%eax
+  8004d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8004d3:	8b 02                	mov    (%rdx),%eax
+  8004d5:	89 c1                	mov    %eax,%ecx
+  8004d7:	f7 d9                	neg    %ecx
+  8004d9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8004dc:	83 f9 16             	cmp    $0x16,%ecx
+  8004df:	7f 4e                	jg     80052f <vprintfmt+0x1ec>
+  8004e1:	48 63 c1             	movslq %ecx,%rax
+  8004e4:	48 ba 80 4b 80 00 00 	movabs $0x804b80,%rdx
+  8004eb:	00 00 00 
+  8004ee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8004f2:	48 85 c0             	test   %rax,%rax
+  8004f5:	74 38                	je     80052f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8004f7:	48 89 c1             	mov    %rax,%rcx
+  8004fa:	48 ba 59 4d 80 00 00 	movabs $0x804d59,%rdx
+  800501:	00 00 00 
+  800504:	4c 89 ee             	mov    %r13,%rsi
+  800507:	4c 89 f7             	mov    %r14,%rdi
+  80050a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80050f:	49 b8 06 03 80 00 00 	movabs $0x800306,%r8
+  800516:	00 00 00 
+  800519:	41 ff d0             	call   *%r8
+  80051c:	e9 53 fe ff ff       	jmp    800374 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800521:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800525:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800529:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052d:	eb a4                	jmp    8004d3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80052f:	48 ba 28 47 80 00 00 	movabs $0x804728,%rdx
+  800536:	00 00 00 
+  800539:	4c 89 ee             	mov    %r13,%rsi
+  80053c:	4c 89 f7             	mov    %r14,%rdi
+  80053f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800544:	49 b8 06 03 80 00 00 	movabs $0x800306,%r8
+  80054b:	00 00 00 
+  80054e:	41 ff d0             	call   *%r8
+  800551:	e9 1e fe ff ff       	jmp    800374 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800556:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800559:	83 f8 2f             	cmp    $0x2f,%eax
+  80055c:	77 6c                	ja     8005ca <vprintfmt+0x287>
+  80055e:	89 c2                	mov    %eax,%edx
+  800560:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800564:	83 c0 08             	add    $0x8,%eax
+  800567:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80056a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80056d:	48 85 d2             	test   %rdx,%rdx
+  800570:	48 b8 21 47 80 00 00 	movabs $0x804721,%rax
+  800577:	00 00 00 
+  80057a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80057e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800582:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800586:	7e 06                	jle    80058e <vprintfmt+0x24b>
+  800588:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80058c:	75 4a                	jne    8005d8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80058e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800592:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800596:	0f b6 00             	movzbl (%rax),%eax
+  800599:	84 c0                	test   %al,%al
+  80059b:	0f 85 9a 00 00 00    	jne    80063b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8005a1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005a4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8005a8:	85 c0                	test   %eax,%eax
+  8005aa:	0f 8e c4 fd ff ff    	jle    800374 <vprintfmt+0x31>
+  8005b0:	4c 89 ee             	mov    %r13,%rsi
+  8005b3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8005b8:	41 ff d6             	call   *%r14
+  8005bb:	41 83 ec 01          	sub    $0x1,%r12d
+  8005bf:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8005c3:	75 eb                	jne    8005b0 <vprintfmt+0x26d>
+  8005c5:	e9 aa fd ff ff       	jmp    800374 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8005ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d6:	eb 92                	jmp    80056a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8005d8:	49 63 f7             	movslq %r15d,%rsi
+  8005db:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8005df:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  8005e6:	00 00 00 
+  8005e9:	ff d0                	call   *%rax
+  8005eb:	48 89 c2             	mov    %rax,%rdx
+  8005ee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8005f1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8005f3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8005f6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8005f9:	85 c0                	test   %eax,%eax
+  8005fb:	7e 91                	jle    80058e <vprintfmt+0x24b>
+  8005fd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800602:	4c 89 ee             	mov    %r13,%rsi
+  800605:	44 89 e7             	mov    %r12d,%edi
+  800608:	41 ff d6             	call   *%r14
+  80060b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80060f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800612:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800615:	75 eb                	jne    800602 <vprintfmt+0x2bf>
+  800617:	e9 72 ff ff ff       	jmp    80058e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80061c:	0f b6 f8             	movzbl %al,%edi
+  80061f:	4c 89 ee             	mov    %r13,%rsi
+  800622:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800625:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800629:	49 83 c4 01          	add    $0x1,%r12
+  80062d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800633:	84 c0                	test   %al,%al
+  800635:	0f 84 66 ff ff ff    	je     8005a1 <vprintfmt+0x25e>
+  80063b:	45 85 ff             	test   %r15d,%r15d
+  80063e:	78 0a                	js     80064a <vprintfmt+0x307>
+  800640:	41 83 ef 01          	sub    $0x1,%r15d
+  800644:	0f 88 57 ff ff ff    	js     8005a1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80064a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80064e:	74 cc                	je     80061c <vprintfmt+0x2d9>
+  800650:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800653:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800658:	80 fa 5e             	cmp    $0x5e,%dl
+  80065b:	77 c2                	ja     80061f <vprintfmt+0x2dc>
+  80065d:	eb bd                	jmp    80061c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80065f:	40 84 f6             	test   %sil,%sil
+  800662:	75 26                	jne    80068a <vprintfmt+0x347>
+    switch (lflag) {
+  800664:	85 d2                	test   %edx,%edx
+  800666:	74 59                	je     8006c1 <vprintfmt+0x37e>
+  800668:	83 fa 01             	cmp    $0x1,%edx
+  80066b:	74 7b                	je     8006e8 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80066d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800670:	83 f8 2f             	cmp    $0x2f,%eax
+  800673:	0f 87 96 00 00 00    	ja     80070f <vprintfmt+0x3cc>
+  800679:	89 c2                	mov    %eax,%edx
+  80067b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067f:	83 c0 08             	add    $0x8,%eax
+  800682:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800685:	4c 8b 22             	mov    (%rdx),%r12
+  800688:	eb 17                	jmp    8006a1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80068a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068d:	83 f8 2f             	cmp    $0x2f,%eax
+  800690:	77 21                	ja     8006b3 <vprintfmt+0x370>
+  800692:	89 c2                	mov    %eax,%edx
+  800694:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800698:	83 c0 08             	add    $0x8,%eax
+  80069b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8006a1:	4d 85 e4             	test   %r12,%r12
+  8006a4:	78 7a                	js     800720 <vprintfmt+0x3dd>
+            num = i;
+  8006a6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8006a9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8006ae:	e9 50 02 00 00       	jmp    800903 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8006b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006bf:	eb dd                	jmp    80069e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8006c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8006c7:	77 11                	ja     8006da <vprintfmt+0x397>
+  8006c9:	89 c2                	mov    %eax,%edx
+  8006cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006cf:	83 c0 08             	add    $0x8,%eax
+  8006d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006d5:	4c 63 22             	movslq (%rdx),%r12
+  8006d8:	eb c7                	jmp    8006a1 <vprintfmt+0x35e>
+  8006da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006e6:	eb ed                	jmp    8006d5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8006e8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006eb:	83 f8 2f             	cmp    $0x2f,%eax
+  8006ee:	77 11                	ja     800701 <vprintfmt+0x3be>
+  8006f0:	89 c2                	mov    %eax,%edx
+  8006f2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006f6:	83 c0 08             	add    $0x8,%eax
+  8006f9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006fc:	4c 8b 22             	mov    (%rdx),%r12
+  8006ff:	eb a0                	jmp    8006a1 <vprintfmt+0x35e>
+  800701:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800705:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800709:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80070d:	eb ed                	jmp    8006fc <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80070f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800713:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800717:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80071b:	e9 65 ff ff ff       	jmp    800685 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800720:	4c 89 ee             	mov    %r13,%rsi
+  800723:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800728:	41 ff d6             	call   *%r14
+                i = -i;
+  80072b:	49 f7 dc             	neg    %r12
+  80072e:	e9 73 ff ff ff       	jmp    8006a6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800733:	40 84 f6             	test   %sil,%sil
+  800736:	75 32                	jne    80076a <vprintfmt+0x427>
+    switch (lflag) {
+  800738:	85 d2                	test   %edx,%edx
+  80073a:	74 5d                	je     800799 <vprintfmt+0x456>
+  80073c:	83 fa 01             	cmp    $0x1,%edx
+  80073f:	0f 84 82 00 00 00    	je     8007c7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800745:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800748:	83 f8 2f             	cmp    $0x2f,%eax
+  80074b:	0f 87 a5 00 00 00    	ja     8007f6 <vprintfmt+0x4b3>
+  800751:	89 c2                	mov    %eax,%edx
+  800753:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800757:	83 c0 08             	add    $0x8,%eax
+  80075a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80075d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800760:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800765:	e9 99 01 00 00       	jmp    800903 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80076a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076d:	83 f8 2f             	cmp    $0x2f,%eax
+  800770:	77 19                	ja     80078b <vprintfmt+0x448>
+  800772:	89 c2                	mov    %eax,%edx
+  800774:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800778:	83 c0 08             	add    $0x8,%eax
+  80077b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80077e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800781:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800786:	e9 78 01 00 00       	jmp    800903 <vprintfmt+0x5c0>
+  80078b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800793:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800797:	eb e5                	jmp    80077e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800799:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80079c:	83 f8 2f             	cmp    $0x2f,%eax
+  80079f:	77 18                	ja     8007b9 <vprintfmt+0x476>
+  8007a1:	89 c2                	mov    %eax,%edx
+  8007a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a7:	83 c0 08             	add    $0x8,%eax
+  8007aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ad:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8007af:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8007b4:	e9 4a 01 00 00       	jmp    800903 <vprintfmt+0x5c0>
+  8007b9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007bd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007c1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c5:	eb e6                	jmp    8007ad <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8007c7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ca:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cd:	77 19                	ja     8007e8 <vprintfmt+0x4a5>
+  8007cf:	89 c2                	mov    %eax,%edx
+  8007d1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d5:	83 c0 08             	add    $0x8,%eax
+  8007d8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007db:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8007de:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8007e3:	e9 1b 01 00 00       	jmp    800903 <vprintfmt+0x5c0>
+  8007e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f4:	eb e5                	jmp    8007db <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8007f6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800802:	e9 56 ff ff ff       	jmp    80075d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800807:	40 84 f6             	test   %sil,%sil
+  80080a:	75 2e                	jne    80083a <vprintfmt+0x4f7>
+    switch (lflag) {
+  80080c:	85 d2                	test   %edx,%edx
+  80080e:	74 59                	je     800869 <vprintfmt+0x526>
+  800810:	83 fa 01             	cmp    $0x1,%edx
+  800813:	74 7f                	je     800894 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800815:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800818:	83 f8 2f             	cmp    $0x2f,%eax
+  80081b:	0f 87 9f 00 00 00    	ja     8008c0 <vprintfmt+0x57d>
+  800821:	89 c2                	mov    %eax,%edx
+  800823:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800827:	83 c0 08             	add    $0x8,%eax
+  80082a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800830:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800835:	e9 c9 00 00 00       	jmp    800903 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80083a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083d:	83 f8 2f             	cmp    $0x2f,%eax
+  800840:	77 19                	ja     80085b <vprintfmt+0x518>
+  800842:	89 c2                	mov    %eax,%edx
+  800844:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800848:	83 c0 08             	add    $0x8,%eax
+  80084b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800851:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800856:	e9 a8 00 00 00       	jmp    800903 <vprintfmt+0x5c0>
+  80085b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800863:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800867:	eb e5                	jmp    80084e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800869:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086c:	83 f8 2f             	cmp    $0x2f,%eax
+  80086f:	77 15                	ja     800886 <vprintfmt+0x543>
+  800871:	89 c2                	mov    %eax,%edx
+  800873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800877:	83 c0 08             	add    $0x8,%eax
+  80087a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80087f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800884:	eb 7d                	jmp    800903 <vprintfmt+0x5c0>
+  800886:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80088e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800892:	eb e9                	jmp    80087d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800894:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800897:	83 f8 2f             	cmp    $0x2f,%eax
+  80089a:	77 16                	ja     8008b2 <vprintfmt+0x56f>
+  80089c:	89 c2                	mov    %eax,%edx
+  80089e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a2:	83 c0 08             	add    $0x8,%eax
+  8008a5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008ab:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8008b0:	eb 51                	jmp    800903 <vprintfmt+0x5c0>
+  8008b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008be:	eb e8                	jmp    8008a8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8008c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cc:	e9 5c ff ff ff       	jmp    80082d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8008d1:	4c 89 ee             	mov    %r13,%rsi
+  8008d4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8008d9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8008dc:	4c 89 ee             	mov    %r13,%rsi
+  8008df:	bf 78 00 00 00       	mov    $0x78,%edi
+  8008e4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8008e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ed:	77 47                	ja     800936 <vprintfmt+0x5f3>
+  8008ef:	89 c2                	mov    %eax,%edx
+  8008f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f5:	83 c0 08             	add    $0x8,%eax
+  8008f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8008fe:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800903:	48 83 ec 08          	sub    $0x8,%rsp
+  800907:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80090b:	0f 94 c0             	sete   %al
+  80090e:	0f b6 c0             	movzbl %al,%eax
+  800911:	50                   	push   %rax
+  800912:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800917:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80091b:	4c 89 ee             	mov    %r13,%rsi
+  80091e:	4c 89 f7             	mov    %r14,%rdi
+  800921:	48 b8 38 02 80 00 00 	movabs $0x800238,%rax
+  800928:	00 00 00 
+  80092b:	ff d0                	call   *%rax
+            break;
+  80092d:	48 83 c4 10          	add    $0x10,%rsp
+  800931:	e9 3e fa ff ff       	jmp    800374 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800936:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80093a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800942:	eb b7                	jmp    8008fb <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800944:	40 84 f6             	test   %sil,%sil
+  800947:	75 2b                	jne    800974 <vprintfmt+0x631>
+    switch (lflag) {
+  800949:	85 d2                	test   %edx,%edx
+  80094b:	74 56                	je     8009a3 <vprintfmt+0x660>
+  80094d:	83 fa 01             	cmp    $0x1,%edx
+  800950:	74 7f                	je     8009d1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	0f 87 a2 00 00 00    	ja     800a00 <vprintfmt+0x6bd>
+  80095e:	89 c2                	mov    %eax,%edx
+  800960:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800964:	83 c0 08             	add    $0x8,%eax
+  800967:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80096d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800972:	eb 8f                	jmp    800903 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800974:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800977:	83 f8 2f             	cmp    $0x2f,%eax
+  80097a:	77 19                	ja     800995 <vprintfmt+0x652>
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800982:	83 c0 08             	add    $0x8,%eax
+  800985:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800988:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80098b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800990:	e9 6e ff ff ff       	jmp    800903 <vprintfmt+0x5c0>
+  800995:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800999:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a1:	eb e5                	jmp    800988 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8009a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009a9:	77 18                	ja     8009c3 <vprintfmt+0x680>
+  8009ab:	89 c2                	mov    %eax,%edx
+  8009ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009b1:	83 c0 08             	add    $0x8,%eax
+  8009b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009b7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8009b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8009be:	e9 40 ff ff ff       	jmp    800903 <vprintfmt+0x5c0>
+  8009c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	eb e6                	jmp    8009b7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8009d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d7:	77 19                	ja     8009f2 <vprintfmt+0x6af>
+  8009d9:	89 c2                	mov    %eax,%edx
+  8009db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009df:	83 c0 08             	add    $0x8,%eax
+  8009e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ed:	e9 11 ff ff ff       	jmp    800903 <vprintfmt+0x5c0>
+  8009f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009fe:	eb e5                	jmp    8009e5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800a00:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a04:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a08:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a0c:	e9 59 ff ff ff       	jmp    80096a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800a11:	4c 89 ee             	mov    %r13,%rsi
+  800a14:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a19:	41 ff d6             	call   *%r14
+            break;
+  800a1c:	e9 53 f9 ff ff       	jmp    800374 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800a21:	4c 89 ee             	mov    %r13,%rsi
+  800a24:	bf 25 00 00 00       	mov    $0x25,%edi
+  800a29:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800a2c:	48 83 eb 01          	sub    $0x1,%rbx
+  800a30:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800a34:	75 f6                	jne    800a2c <vprintfmt+0x6e9>
+  800a36:	e9 39 f9 ff ff       	jmp    800374 <vprintfmt+0x31>
+}
+  800a3b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800a3f:	5b                   	pop    %rbx
+  800a40:	41 5c                	pop    %r12
+  800a42:	41 5d                	pop    %r13
+  800a44:	41 5e                	pop    %r14
+  800a46:	41 5f                	pop    %r15
+  800a48:	5d                   	pop    %rbp
+  800a49:	c3                   	ret
+
+0000000000800a4a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800a52:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800a56:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800a5b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800a5f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800a66:	48 85 ff             	test   %rdi,%rdi
+  800a69:	74 2b                	je     800a96 <vsnprintf+0x4c>
+  800a6b:	48 85 f6             	test   %rsi,%rsi
+  800a6e:	74 26                	je     800a96 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800a70:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800a74:	48 bf ee 02 80 00 00 	movabs $0x8002ee,%rdi
+  800a7b:	00 00 00 
+  800a7e:	48 b8 43 03 80 00 00 	movabs $0x800343,%rax
+  800a85:	00 00 00 
+  800a88:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800a8a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800a8e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800a91:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800a94:	c9                   	leave
+  800a95:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800a96:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800a9b:	eb f7                	jmp    800a94 <vsnprintf+0x4a>
+
+0000000000800a9d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800a9d:	55                   	push   %rbp
+  800a9e:	48 89 e5             	mov    %rsp,%rbp
+  800aa1:	48 83 ec 50          	sub    $0x50,%rsp
+  800aa5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800aa9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800aad:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ab1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ab8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800abc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ac4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ac8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800acc:	48 b8 4a 0a 80 00 00 	movabs $0x800a4a,%rax
+  800ad3:	00 00 00 
+  800ad6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800ad8:	c9                   	leave
+  800ad9:	c3                   	ret
+
+0000000000800ada <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ada:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800add:	74 10                	je     800aef <strlen+0x15>
+    size_t n = 0;
+  800adf:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ae4:	48 83 c0 01          	add    $0x1,%rax
+  800ae8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800aec:	75 f6                	jne    800ae4 <strlen+0xa>
+  800aee:	c3                   	ret
+    size_t n = 0;
+  800aef:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800af4:	c3                   	ret
+
+0000000000800af5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800af5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800af8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800afd:	48 85 f6             	test   %rsi,%rsi
+  800b00:	74 11                	je     800b13 <strnlen+0x1e>
+  800b02:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800b06:	74 0c                	je     800b14 <strnlen+0x1f>
+  800b08:	48 83 c2 01          	add    $0x1,%rdx
+  800b0c:	48 39 d0             	cmp    %rdx,%rax
+  800b0f:	75 f1                	jne    800b02 <strnlen+0xd>
+  800b11:	eb 04                	jmp    800b17 <strnlen+0x22>
+  800b13:	c3                   	ret
+  800b14:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800b17:	c3                   	ret
+
+0000000000800b18 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800b18:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800b1b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800b20:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800b24:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800b27:	48 83 c2 01          	add    $0x1,%rdx
+  800b2b:	84 c9                	test   %cl,%cl
+  800b2d:	75 f1                	jne    800b20 <strcpy+0x8>
+        ;
+    return res;
+}
+  800b2f:	c3                   	ret
+
+0000000000800b30 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800b30:	55                   	push   %rbp
+  800b31:	48 89 e5             	mov    %rsp,%rbp
+  800b34:	41 54                	push   %r12
+  800b36:	53                   	push   %rbx
+  800b37:	48 89 fb             	mov    %rdi,%rbx
+  800b3a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800b3d:	48 b8 da 0a 80 00 00 	movabs $0x800ada,%rax
+  800b44:	00 00 00 
+  800b47:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800b49:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800b4d:	4c 89 e6             	mov    %r12,%rsi
+  800b50:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  800b57:	00 00 00 
+  800b5a:	ff d0                	call   *%rax
+    return dst;
+}
+  800b5c:	48 89 d8             	mov    %rbx,%rax
+  800b5f:	5b                   	pop    %rbx
+  800b60:	41 5c                	pop    %r12
+  800b62:	5d                   	pop    %rbp
+  800b63:	c3                   	ret
+
+0000000000800b64 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800b64:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800b67:	48 85 d2             	test   %rdx,%rdx
+  800b6a:	74 1f                	je     800b8b <strncpy+0x27>
+  800b6c:	48 01 fa             	add    %rdi,%rdx
+  800b6f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800b72:	48 83 c1 01          	add    $0x1,%rcx
+  800b76:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800b7a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800b7e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800b82:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800b86:	48 39 ca             	cmp    %rcx,%rdx
+  800b89:	75 e7                	jne    800b72 <strncpy+0xe>
+    }
+    return ret;
+}
+  800b8b:	c3                   	ret
+
+0000000000800b8c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800b8c:	48 89 f8             	mov    %rdi,%rax
+  800b8f:	48 85 d2             	test   %rdx,%rdx
+  800b92:	74 24                	je     800bb8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800b94:	48 83 ea 01          	sub    $0x1,%rdx
+  800b98:	74 1b                	je     800bb5 <strlcpy+0x29>
+  800b9a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800b9e:	0f b6 16             	movzbl (%rsi),%edx
+  800ba1:	84 d2                	test   %dl,%dl
+  800ba3:	74 10                	je     800bb5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ba5:	48 83 c6 01          	add    $0x1,%rsi
+  800ba9:	48 83 c0 01          	add    $0x1,%rax
+  800bad:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800bb0:	48 39 c8             	cmp    %rcx,%rax
+  800bb3:	75 e9                	jne    800b9e <strlcpy+0x12>
+        *dst = '\0';
+  800bb5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800bb8:	48 29 f8             	sub    %rdi,%rax
+}
+  800bbb:	c3                   	ret
+
+0000000000800bbc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800bbc:	0f b6 07             	movzbl (%rdi),%eax
+  800bbf:	84 c0                	test   %al,%al
+  800bc1:	74 13                	je     800bd6 <strcmp+0x1a>
+  800bc3:	38 06                	cmp    %al,(%rsi)
+  800bc5:	75 0f                	jne    800bd6 <strcmp+0x1a>
+  800bc7:	48 83 c7 01          	add    $0x1,%rdi
+  800bcb:	48 83 c6 01          	add    $0x1,%rsi
+  800bcf:	0f b6 07             	movzbl (%rdi),%eax
+  800bd2:	84 c0                	test   %al,%al
+  800bd4:	75 ed                	jne    800bc3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800bd6:	0f b6 c0             	movzbl %al,%eax
+  800bd9:	0f b6 16             	movzbl (%rsi),%edx
+  800bdc:	29 d0                	sub    %edx,%eax
+}
+  800bde:	c3                   	ret
+
+0000000000800bdf <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800bdf:	48 85 d2             	test   %rdx,%rdx
+  800be2:	74 1f                	je     800c03 <strncmp+0x24>
+  800be4:	0f b6 07             	movzbl (%rdi),%eax
+  800be7:	84 c0                	test   %al,%al
+  800be9:	74 1e                	je     800c09 <strncmp+0x2a>
+  800beb:	3a 06                	cmp    (%rsi),%al
+  800bed:	75 1a                	jne    800c09 <strncmp+0x2a>
+  800bef:	48 83 c7 01          	add    $0x1,%rdi
+  800bf3:	48 83 c6 01          	add    $0x1,%rsi
+  800bf7:	48 83 ea 01          	sub    $0x1,%rdx
+  800bfb:	75 e7                	jne    800be4 <strncmp+0x5>
+
+    if (!n) return 0;
+  800bfd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c02:	c3                   	ret
+  800c03:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c08:	c3                   	ret
+  800c09:	48 85 d2             	test   %rdx,%rdx
+  800c0c:	74 09                	je     800c17 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c0e:	0f b6 07             	movzbl (%rdi),%eax
+  800c11:	0f b6 16             	movzbl (%rsi),%edx
+  800c14:	29 d0                	sub    %edx,%eax
+  800c16:	c3                   	ret
+    if (!n) return 0;
+  800c17:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c1c:	c3                   	ret
+
+0000000000800c1d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800c1d:	0f b6 17             	movzbl (%rdi),%edx
+  800c20:	84 d2                	test   %dl,%dl
+  800c22:	74 18                	je     800c3c <strchr+0x1f>
+        if (*str == c) {
+  800c24:	0f be d2             	movsbl %dl,%edx
+  800c27:	39 f2                	cmp    %esi,%edx
+  800c29:	74 17                	je     800c42 <strchr+0x25>
+    for (; *str; str++) {
+  800c2b:	48 83 c7 01          	add    $0x1,%rdi
+  800c2f:	0f b6 17             	movzbl (%rdi),%edx
+  800c32:	84 d2                	test   %dl,%dl
+  800c34:	75 ee                	jne    800c24 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800c36:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c3b:	c3                   	ret
+  800c3c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c41:	c3                   	ret
+  800c42:	48 89 f8             	mov    %rdi,%rax
+}
+  800c45:	c3                   	ret
+
+0000000000800c46 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800c46:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800c49:	0f b6 17             	movzbl (%rdi),%edx
+  800c4c:	84 d2                	test   %dl,%dl
+  800c4e:	74 13                	je     800c63 <strfind+0x1d>
+  800c50:	0f be d2             	movsbl %dl,%edx
+  800c53:	39 f2                	cmp    %esi,%edx
+  800c55:	74 0b                	je     800c62 <strfind+0x1c>
+  800c57:	48 83 c0 01          	add    $0x1,%rax
+  800c5b:	0f b6 10             	movzbl (%rax),%edx
+  800c5e:	84 d2                	test   %dl,%dl
+  800c60:	75 ee                	jne    800c50 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800c62:	c3                   	ret
+  800c63:	c3                   	ret
+
+0000000000800c64 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800c64:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800c67:	48 89 f8             	mov    %rdi,%rax
+  800c6a:	48 f7 d8             	neg    %rax
+  800c6d:	83 e0 07             	and    $0x7,%eax
+  800c70:	49 89 d1             	mov    %rdx,%r9
+  800c73:	49 29 c1             	sub    %rax,%r9
+  800c76:	78 36                	js     800cae <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800c78:	40 0f b6 c6          	movzbl %sil,%eax
+  800c7c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800c83:	01 01 01 
+  800c86:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800c8a:	40 f6 c7 07          	test   $0x7,%dil
+  800c8e:	75 38                	jne    800cc8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800c90:	4c 89 c9             	mov    %r9,%rcx
+  800c93:	48 c1 f9 03          	sar    $0x3,%rcx
+  800c97:	74 0c                	je     800ca5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800c99:	fc                   	cld
+  800c9a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800c9d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ca1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ca5:	4d 85 c9             	test   %r9,%r9
+  800ca8:	75 45                	jne    800cef <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800caa:	4c 89 c0             	mov    %r8,%rax
+  800cad:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800cae:	48 85 d2             	test   %rdx,%rdx
+  800cb1:	74 f7                	je     800caa <memset+0x46>
+  800cb3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800cb6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800cb9:	48 83 c0 01          	add    $0x1,%rax
+  800cbd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800cc1:	48 39 c2             	cmp    %rax,%rdx
+  800cc4:	75 f3                	jne    800cb9 <memset+0x55>
+  800cc6:	eb e2                	jmp    800caa <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800cc8:	40 f6 c7 01          	test   $0x1,%dil
+  800ccc:	74 06                	je     800cd4 <memset+0x70>
+  800cce:	88 07                	mov    %al,(%rdi)
+  800cd0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cd4:	40 f6 c7 02          	test   $0x2,%dil
+  800cd8:	74 07                	je     800ce1 <memset+0x7d>
+  800cda:	66 89 07             	mov    %ax,(%rdi)
+  800cdd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ce1:	40 f6 c7 04          	test   $0x4,%dil
+  800ce5:	74 a9                	je     800c90 <memset+0x2c>
+  800ce7:	89 07                	mov    %eax,(%rdi)
+  800ce9:	48 83 c7 04          	add    $0x4,%rdi
+  800ced:	eb a1                	jmp    800c90 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800cef:	41 f6 c1 04          	test   $0x4,%r9b
+  800cf3:	74 06                	je     800cfb <memset+0x97>
+  800cf5:	89 07                	mov    %eax,(%rdi)
+  800cf7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800cfb:	41 f6 c1 02          	test   $0x2,%r9b
+  800cff:	74 07                	je     800d08 <memset+0xa4>
+  800d01:	66 89 07             	mov    %ax,(%rdi)
+  800d04:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800d08:	41 f6 c1 01          	test   $0x1,%r9b
+  800d0c:	74 9c                	je     800caa <memset+0x46>
+  800d0e:	88 07                	mov    %al,(%rdi)
+  800d10:	eb 98                	jmp    800caa <memset+0x46>
+
+0000000000800d12 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800d12:	48 89 f8             	mov    %rdi,%rax
+  800d15:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800d18:	48 39 fe             	cmp    %rdi,%rsi
+  800d1b:	73 3b                	jae    800d58 <memmove+0x46>
+  800d1d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800d21:	48 39 d7             	cmp    %rdx,%rdi
+  800d24:	73 32                	jae    800d58 <memmove+0x46>
+        s += n;
+        d += n;
+  800d26:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d2a:	48 89 d6             	mov    %rdx,%rsi
+  800d2d:	48 09 fe             	or     %rdi,%rsi
+  800d30:	48 09 ce             	or     %rcx,%rsi
+  800d33:	40 f6 c6 07          	test   $0x7,%sil
+  800d37:	75 12                	jne    800d4b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800d39:	48 83 ef 08          	sub    $0x8,%rdi
+  800d3d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800d41:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d45:	fd                   	std
+  800d46:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800d49:	fc                   	cld
+  800d4a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800d4b:	48 83 ef 01          	sub    $0x1,%rdi
+  800d4f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800d53:	fd                   	std
+  800d54:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800d56:	eb f1                	jmp    800d49 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800d58:	48 89 f2             	mov    %rsi,%rdx
+  800d5b:	48 09 c2             	or     %rax,%rdx
+  800d5e:	48 09 ca             	or     %rcx,%rdx
+  800d61:	f6 c2 07             	test   $0x7,%dl
+  800d64:	75 0c                	jne    800d72 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800d66:	48 c1 e9 03          	shr    $0x3,%rcx
+  800d6a:	48 89 c7             	mov    %rax,%rdi
+  800d6d:	fc                   	cld
+  800d6e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800d71:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800d72:	48 89 c7             	mov    %rax,%rdi
+  800d75:	fc                   	cld
+  800d76:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800d78:	c3                   	ret
+
+0000000000800d79 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800d79:	55                   	push   %rbp
+  800d7a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800d7d:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  800d84:	00 00 00 
+  800d87:	ff d0                	call   *%rax
+}
+  800d89:	5d                   	pop    %rbp
+  800d8a:	c3                   	ret
+
+0000000000800d8b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800d8b:	55                   	push   %rbp
+  800d8c:	48 89 e5             	mov    %rsp,%rbp
+  800d8f:	41 57                	push   %r15
+  800d91:	41 56                	push   %r14
+  800d93:	41 55                	push   %r13
+  800d95:	41 54                	push   %r12
+  800d97:	53                   	push   %rbx
+  800d98:	48 83 ec 08          	sub    $0x8,%rsp
+  800d9c:	49 89 fe             	mov    %rdi,%r14
+  800d9f:	49 89 f7             	mov    %rsi,%r15
+  800da2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800da5:	48 89 f7             	mov    %rsi,%rdi
+  800da8:	48 b8 da 0a 80 00 00 	movabs $0x800ada,%rax
+  800daf:	00 00 00 
+  800db2:	ff d0                	call   *%rax
+  800db4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800db7:	48 89 de             	mov    %rbx,%rsi
+  800dba:	4c 89 f7             	mov    %r14,%rdi
+  800dbd:	48 b8 f5 0a 80 00 00 	movabs $0x800af5,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800dcc:	48 39 c3             	cmp    %rax,%rbx
+  800dcf:	74 36                	je     800e07 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800dd1:	48 89 d8             	mov    %rbx,%rax
+  800dd4:	4c 29 e8             	sub    %r13,%rax
+  800dd7:	49 39 c4             	cmp    %rax,%r12
+  800dda:	73 31                	jae    800e0d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ddc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800de1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800de5:	4c 89 fe             	mov    %r15,%rsi
+  800de8:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  800def:	00 00 00 
+  800df2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800df4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800df8:	48 83 c4 08          	add    $0x8,%rsp
+  800dfc:	5b                   	pop    %rbx
+  800dfd:	41 5c                	pop    %r12
+  800dff:	41 5d                	pop    %r13
+  800e01:	41 5e                	pop    %r14
+  800e03:	41 5f                	pop    %r15
+  800e05:	5d                   	pop    %rbp
+  800e06:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e07:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800e0b:	eb eb                	jmp    800df8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800e0d:	48 83 eb 01          	sub    $0x1,%rbx
+  800e11:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800e15:	48 89 da             	mov    %rbx,%rdx
+  800e18:	4c 89 fe             	mov    %r15,%rsi
+  800e1b:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  800e22:	00 00 00 
+  800e25:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800e27:	49 01 de             	add    %rbx,%r14
+  800e2a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800e2f:	eb c3                	jmp    800df4 <strlcat+0x69>
+
+0000000000800e31 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800e31:	48 85 d2             	test   %rdx,%rdx
+  800e34:	74 2d                	je     800e63 <memcmp+0x32>
+  800e36:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800e3b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800e3f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800e44:	44 38 c1             	cmp    %r8b,%cl
+  800e47:	75 0f                	jne    800e58 <memcmp+0x27>
+    while (n-- > 0) {
+  800e49:	48 83 c0 01          	add    $0x1,%rax
+  800e4d:	48 39 c2             	cmp    %rax,%rdx
+  800e50:	75 e9                	jne    800e3b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800e52:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e57:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800e58:	0f b6 c1             	movzbl %cl,%eax
+  800e5b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800e5f:	44 29 c0             	sub    %r8d,%eax
+  800e62:	c3                   	ret
+    return 0;
+  800e63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e68:	c3                   	ret
+
+0000000000800e69 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800e69:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800e6d:	48 39 c7             	cmp    %rax,%rdi
+  800e70:	73 0f                	jae    800e81 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800e72:	40 38 37             	cmp    %sil,(%rdi)
+  800e75:	74 0e                	je     800e85 <memfind+0x1c>
+    for (; src < end; src++) {
+  800e77:	48 83 c7 01          	add    $0x1,%rdi
+  800e7b:	48 39 f8             	cmp    %rdi,%rax
+  800e7e:	75 f2                	jne    800e72 <memfind+0x9>
+  800e80:	c3                   	ret
+  800e81:	48 89 f8             	mov    %rdi,%rax
+  800e84:	c3                   	ret
+  800e85:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800e88:	c3                   	ret
+
+0000000000800e89 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800e89:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800e8c:	0f b6 37             	movzbl (%rdi),%esi
+  800e8f:	40 80 fe 20          	cmp    $0x20,%sil
+  800e93:	74 06                	je     800e9b <strtol+0x12>
+  800e95:	40 80 fe 09          	cmp    $0x9,%sil
+  800e99:	75 13                	jne    800eae <strtol+0x25>
+  800e9b:	48 83 c7 01          	add    $0x1,%rdi
+  800e9f:	0f b6 37             	movzbl (%rdi),%esi
+  800ea2:	40 80 fe 20          	cmp    $0x20,%sil
+  800ea6:	74 f3                	je     800e9b <strtol+0x12>
+  800ea8:	40 80 fe 09          	cmp    $0x9,%sil
+  800eac:	74 ed                	je     800e9b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800eae:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800eb1:	83 e0 fd             	and    $0xfffffffd,%eax
+  800eb4:	3c 01                	cmp    $0x1,%al
+  800eb6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800eba:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800ec0:	75 0f                	jne    800ed1 <strtol+0x48>
+  800ec2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800ec5:	74 14                	je     800edb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800ec7:	85 d2                	test   %edx,%edx
+  800ec9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800ece:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ed1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ed6:	4c 63 ca             	movslq %edx,%r9
+  800ed9:	eb 36                	jmp    800f11 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800edb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800edf:	74 0f                	je     800ef0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ee1:	85 d2                	test   %edx,%edx
+  800ee3:	75 ec                	jne    800ed1 <strtol+0x48>
+        s++;
+  800ee5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800ee9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800eee:	eb e1                	jmp    800ed1 <strtol+0x48>
+        s += 2;
+  800ef0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ef4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ef9:	eb d6                	jmp    800ed1 <strtol+0x48>
+            dig -= '0';
+  800efb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800efe:	44 0f b6 c1          	movzbl %cl,%r8d
+  800f02:	41 39 d0             	cmp    %edx,%r8d
+  800f05:	7d 21                	jge    800f28 <strtol+0x9f>
+        val = val * base + dig;
+  800f07:	49 0f af c1          	imul   %r9,%rax
+  800f0b:	0f b6 c9             	movzbl %cl,%ecx
+  800f0e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800f11:	48 83 c7 01          	add    $0x1,%rdi
+  800f15:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800f19:	80 f9 39             	cmp    $0x39,%cl
+  800f1c:	76 dd                	jbe    800efb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800f1e:	80 f9 7b             	cmp    $0x7b,%cl
+  800f21:	77 05                	ja     800f28 <strtol+0x9f>
+            dig -= 'a' - 10;
+  800f23:	83 e9 57             	sub    $0x57,%ecx
+  800f26:	eb d6                	jmp    800efe <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800f28:	4d 85 d2             	test   %r10,%r10
+  800f2b:	74 03                	je     800f30 <strtol+0xa7>
+  800f2d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800f30:	48 89 c2             	mov    %rax,%rdx
+  800f33:	48 f7 da             	neg    %rdx
+  800f36:	40 80 fe 2d          	cmp    $0x2d,%sil
+  800f3a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  800f3e:	c3                   	ret
+
+0000000000800f3f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800f3f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f44:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f49:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f4f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f55:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800f5b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800f5d:	c3                   	ret
+
+0000000000800f5e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800f5e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f63:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f68:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f72:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f78:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800f7e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800f84:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800f86:	c3                   	ret
+
+0000000000800f87 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800f87:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800f8a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800f8f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800f94:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f99:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800f9f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fa5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800fab:	0f 05                	syscall
+    if (check && ret > 0) {
+  800fad:	48 85 c0             	test   %rax,%rax
+  800fb0:	7f 01                	jg     800fb3 <sys_env_destroy+0x2c>
+}
+  800fb2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800fb3:	55                   	push   %rbp
+  800fb4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800fb7:	49 89 c0             	mov    %rax,%r8
+  800fba:	b9 03 00 00 00       	mov    $0x3,%ecx
+  800fbf:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  800fc6:	00 00 00 
+  800fc9:	be 29 00 00 00       	mov    $0x29,%esi
+  800fce:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  800fd5:	00 00 00 
+  800fd8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fdd:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  800fe4:	00 00 00 
+  800fe7:	41 ff d1             	call   *%r9
+
+0000000000800fea <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  800fea:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800fef:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ff4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800ff9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801004:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80100a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801010:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801012:	c3                   	ret
+
+0000000000801013 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801013:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801018:	bf 00 00 00 00       	mov    $0x0,%edi
+  80101d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801022:	ba 00 00 00 00       	mov    $0x0,%edx
+  801027:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80102d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801033:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801039:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80103b:	c3                   	ret
+
+000000000080103c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80103c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801041:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801048:	00 00 00 
+  80104b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801051:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801057:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80105d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80105f:	c3                   	ret
+
+0000000000801060 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801060:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801063:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801068:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80106e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801074:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801076:	c3                   	ret
+
+0000000000801077 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801077:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80107a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80107f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801082:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801088:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80108e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801090:	48 85 c0             	test   %rax,%rax
+  801093:	7f 01                	jg     801096 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801095:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801096:	55                   	push   %rbp
+  801097:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80109a:	49 89 c0             	mov    %rax,%r8
+  80109d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8010a2:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  8010a9:	00 00 00 
+  8010ac:	be 29 00 00 00       	mov    $0x29,%esi
+  8010b1:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  8010b8:	00 00 00 
+  8010bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c0:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  8010c7:	00 00 00 
+  8010ca:	41 ff d1             	call   *%r9
+
+00000000008010cd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010cd:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8010d0:	48 63 d2             	movslq %edx,%rdx
+  8010d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010d6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010db:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8010de:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010e0:	48 85 c0             	test   %rax,%rax
+  8010e3:	7f 01                	jg     8010e6 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8010e5:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8010e6:	55                   	push   %rbp
+  8010e7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010ea:	49 89 c0             	mov    %rax,%r8
+  8010ed:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8010f2:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  8010f9:	00 00 00 
+  8010fc:	be 29 00 00 00       	mov    $0x29,%esi
+  801101:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  801108:	00 00 00 
+  80110b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801110:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  801117:	00 00 00 
+  80111a:	41 ff d1             	call   *%r9
+
+000000000080111d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80111d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801120:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801125:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80112b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801131:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801137:	0f 05                	syscall
+    if (check && ret > 0) {
+  801139:	48 85 c0             	test   %rax,%rax
+  80113c:	7f 01                	jg     80113f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80113e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80113f:	55                   	push   %rbp
+  801140:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801143:	49 89 c0             	mov    %rax,%r8
+  801146:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80114b:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  801152:	00 00 00 
+  801155:	be 29 00 00 00       	mov    $0x29,%esi
+  80115a:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  801161:	00 00 00 
+  801164:	b8 00 00 00 00       	mov    $0x0,%eax
+  801169:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  801170:	00 00 00 
+  801173:	41 ff d1             	call   *%r9
+
+0000000000801176 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801176:	48 63 f6             	movslq %esi,%rsi
+  801179:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80117c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801181:	ba 00 00 00 00       	mov    $0x0,%edx
+  801186:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80118c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801192:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801198:	0f 05                	syscall
+    if (check && ret > 0) {
+  80119a:	48 85 c0             	test   %rax,%rax
+  80119d:	7f 01                	jg     8011a0 <sys_env_set_status+0x2a>
+}
+  80119f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8011a0:	55                   	push   %rbp
+  8011a1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011a4:	49 89 c0             	mov    %rax,%r8
+  8011a7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8011ac:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  8011b3:	00 00 00 
+  8011b6:	be 29 00 00 00       	mov    $0x29,%esi
+  8011bb:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  8011c2:	00 00 00 
+  8011c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ca:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  8011d1:	00 00 00 
+  8011d4:	41 ff d1             	call   *%r9
+
+00000000008011d7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8011d7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011da:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011f8:	48 85 c0             	test   %rax,%rax
+  8011fb:	7f 01                	jg     8011fe <sys_env_set_trapframe+0x27>
+}
+  8011fd:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801202:	49 89 c0             	mov    %rax,%r8
+  801205:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80120a:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  801211:	00 00 00 
+  801214:	be 29 00 00 00       	mov    $0x29,%esi
+  801219:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  801220:	00 00 00 
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+  801228:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  80122f:	00 00 00 
+  801232:	41 ff d1             	call   *%r9
+
+0000000000801235 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801235:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80123d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801242:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801248:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80124e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801254:	0f 05                	syscall
+    if (check && ret > 0) {
+  801256:	48 85 c0             	test   %rax,%rax
+  801259:	7f 01                	jg     80125c <sys_env_set_pgfault_upcall+0x27>
+}
+  80125b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80125c:	55                   	push   %rbp
+  80125d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801260:	49 89 c0             	mov    %rax,%r8
+  801263:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801268:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  80126f:	00 00 00 
+  801272:	be 29 00 00 00       	mov    $0x29,%esi
+  801277:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  80127e:	00 00 00 
+  801281:	b8 00 00 00 00       	mov    $0x0,%eax
+  801286:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  80128d:	00 00 00 
+  801290:	41 ff d1             	call   *%r9
+
+0000000000801293 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801293:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801296:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801299:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80129e:	4d 63 c0             	movslq %r8d,%r8
+  8012a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a7:	0f 05                	syscall
+}
+  8012a9:	c3                   	ret
+
+00000000008012aa <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8012aa:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8012ad:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012b0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b5:	4d 63 c0             	movslq %r8d,%r8
+  8012b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012be:	0f 05                	syscall
+}
+  8012c0:	c3                   	ret
+
+00000000008012c1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012c6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c9:	45 89 c0             	mov    %r8d,%r8d
+  8012cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012d2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012d4:	48 85 c0             	test   %rax,%rax
+  8012d7:	7f 01                	jg     8012da <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8012d9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8012da:	55                   	push   %rbp
+  8012db:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012de:	49 89 c0             	mov    %rax,%r8
+  8012e1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8012e6:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  8012ed:	00 00 00 
+  8012f0:	be 29 00 00 00       	mov    $0x29,%esi
+  8012f5:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  8012fc:	00 00 00 
+  8012ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801304:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  80130b:	00 00 00 
+  80130e:	41 ff d1             	call   *%r9
+
+0000000000801311 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801311:	55                   	push   %rbp
+  801312:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801315:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80131b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801320:	ba 00 00 00 00       	mov    $0x0,%edx
+  801325:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  80132c:	00 00 00 
+  80132f:	ff d0                	call   *%rax
+}
+  801331:	5d                   	pop    %rbp
+  801332:	c3                   	ret
+
+0000000000801333 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801333:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801338:	bf 00 00 00 00       	mov    $0x0,%edi
+  80133d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801342:	ba 00 00 00 00       	mov    $0x0,%edx
+  801347:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801353:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801359:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80135b:	c3                   	ret
+
+000000000080135c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80135c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801361:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801366:	ba 00 00 00 00       	mov    $0x0,%edx
+  80136b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801371:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801377:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80137d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80137f:	48 85 c0             	test   %rax,%rax
+  801382:	7f 01                	jg     801385 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801384:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801385:	55                   	push   %rbp
+  801386:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801389:	49 89 c0             	mov    %rax,%r8
+  80138c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801391:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  801398:	00 00 00 
+  80139b:	be 29 00 00 00       	mov    $0x29,%esi
+  8013a0:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  8013a7:	00 00 00 
+  8013aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013af:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  8013b6:	00 00 00 
+  8013b9:	41 ff d1             	call   *%r9
+
+00000000008013bc <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013bc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013c6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e2:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e4:	c3                   	ret
+
+00000000008013e5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8013e5:	89 d2                	mov    %edx,%edx
+  8013e7:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8013e9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801400:	0f 05                	syscall
+}
+  801402:	c3                   	ret
+
+0000000000801403 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801403:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801406:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801416:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80141c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801422:	0f 05                	syscall
+}
+  801424:	c3                   	ret
+
+0000000000801425 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801425:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801428:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80142d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801432:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801438:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80143e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801444:	0f 05                	syscall
+}
+  801446:	c3                   	ret
+
+0000000000801447 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801447:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80144a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80144f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801454:	ba 00 00 00 00       	mov    $0x0,%edx
+  801459:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80145f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801465:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80146b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80146d:	48 85 c0             	test   %rax,%rax
+  801470:	7f 01                	jg     801473 <sys_irq_ack+0x2c>
+}
+  801472:	c3                   	ret
+sys_irq_ack(int irq) {
+  801473:	55                   	push   %rbp
+  801474:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801477:	49 89 c0             	mov    %rax,%r8
+  80147a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80147f:	48 ba 58 4c 80 00 00 	movabs $0x804c58,%rdx
+  801486:	00 00 00 
+  801489:	be 29 00 00 00       	mov    $0x29,%esi
+  80148e:	48 bf 77 4c 80 00 00 	movabs $0x804c77,%rdi
+  801495:	00 00 00 
+  801498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149d:	49 b9 95 41 80 00 00 	movabs $0x804195,%r9
+  8014a4:	00 00 00 
+  8014a7:	41 ff d1             	call   *%r9
+
+00000000008014aa <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014aa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014b1:	ff ff ff 
+  8014b4:	48 01 f8             	add    %rdi,%rax
+  8014b7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8014bb:	c3                   	ret
+
+00000000008014bc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8014bc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8014c3:	ff ff ff 
+  8014c6:	48 01 f8             	add    %rdi,%rax
+  8014c9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8014cd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8014d3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8014d7:	c3                   	ret
+
+00000000008014d8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8014d8:	55                   	push   %rbp
+  8014d9:	48 89 e5             	mov    %rsp,%rbp
+  8014dc:	41 57                	push   %r15
+  8014de:	41 56                	push   %r14
+  8014e0:	41 55                	push   %r13
+  8014e2:	41 54                	push   %r12
+  8014e4:	53                   	push   %rbx
+  8014e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8014e9:	49 89 ff             	mov    %rdi,%r15
+  8014ec:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8014f1:	49 bd 67 3c 80 00 00 	movabs $0x803c67,%r13
+  8014f8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8014fb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801501:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801504:	48 89 df             	mov    %rbx,%rdi
+  801507:	41 ff d5             	call   *%r13
+  80150a:	83 e0 04             	and    $0x4,%eax
+  80150d:	74 17                	je     801526 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80150f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801516:	4c 39 f3             	cmp    %r14,%rbx
+  801519:	75 e6                	jne    801501 <fd_alloc+0x29>
+  80151b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801521:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801526:	4d 89 27             	mov    %r12,(%r15)
+}
+  801529:	48 83 c4 08          	add    $0x8,%rsp
+  80152d:	5b                   	pop    %rbx
+  80152e:	41 5c                	pop    %r12
+  801530:	41 5d                	pop    %r13
+  801532:	41 5e                	pop    %r14
+  801534:	41 5f                	pop    %r15
+  801536:	5d                   	pop    %rbp
+  801537:	c3                   	ret
+
+0000000000801538 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801538:	83 ff 1f             	cmp    $0x1f,%edi
+  80153b:	77 39                	ja     801576 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80153d:	55                   	push   %rbp
+  80153e:	48 89 e5             	mov    %rsp,%rbp
+  801541:	41 54                	push   %r12
+  801543:	53                   	push   %rbx
+  801544:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801547:	48 63 df             	movslq %edi,%rbx
+  80154a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801551:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801555:	48 89 df             	mov    %rbx,%rdi
+  801558:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  80155f:	00 00 00 
+  801562:	ff d0                	call   *%rax
+  801564:	a8 04                	test   $0x4,%al
+  801566:	74 14                	je     80157c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801568:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80156c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801571:	5b                   	pop    %rbx
+  801572:	41 5c                	pop    %r12
+  801574:	5d                   	pop    %rbp
+  801575:	c3                   	ret
+        return -E_INVAL;
+  801576:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80157b:	c3                   	ret
+        return -E_INVAL;
+  80157c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801581:	eb ee                	jmp    801571 <fd_lookup+0x39>
+
+0000000000801583 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801583:	55                   	push   %rbp
+  801584:	48 89 e5             	mov    %rsp,%rbp
+  801587:	41 54                	push   %r12
+  801589:	53                   	push   %rbx
+  80158a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80158d:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  801594:	00 00 00 
+  801597:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80159e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8015a1:	39 3b                	cmp    %edi,(%rbx)
+  8015a3:	74 47                	je     8015ec <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8015a5:	48 83 c0 08          	add    $0x8,%rax
+  8015a9:	48 8b 18             	mov    (%rax),%rbx
+  8015ac:	48 85 db             	test   %rbx,%rbx
+  8015af:	75 f0                	jne    8015a1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8015b1:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015b8:	00 00 00 
+  8015bb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8015c1:	89 fa                	mov    %edi,%edx
+  8015c3:	48 bf 88 4c 80 00 00 	movabs $0x804c88,%rdi
+  8015ca:	00 00 00 
+  8015cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d2:	48 b9 f3 01 80 00 00 	movabs $0x8001f3,%rcx
+  8015d9:	00 00 00 
+  8015dc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8015de:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8015e3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8015e7:	5b                   	pop    %rbx
+  8015e8:	41 5c                	pop    %r12
+  8015ea:	5d                   	pop    %rbp
+  8015eb:	c3                   	ret
+            return 0;
+  8015ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015f1:	eb f0                	jmp    8015e3 <dev_lookup+0x60>
+
+00000000008015f3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8015f3:	55                   	push   %rbp
+  8015f4:	48 89 e5             	mov    %rsp,%rbp
+  8015f7:	41 55                	push   %r13
+  8015f9:	41 54                	push   %r12
+  8015fb:	53                   	push   %rbx
+  8015fc:	48 83 ec 18          	sub    $0x18,%rsp
+  801600:	48 89 fb             	mov    %rdi,%rbx
+  801603:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801606:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80160d:	ff ff ff 
+  801610:	48 01 df             	add    %rbx,%rdi
+  801613:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801617:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80161b:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  801622:	00 00 00 
+  801625:	ff d0                	call   *%rax
+  801627:	41 89 c5             	mov    %eax,%r13d
+  80162a:	85 c0                	test   %eax,%eax
+  80162c:	78 06                	js     801634 <fd_close+0x41>
+  80162e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801632:	74 1a                	je     80164e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801634:	45 84 e4             	test   %r12b,%r12b
+  801637:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801640:	44 89 e8             	mov    %r13d,%eax
+  801643:	48 83 c4 18          	add    $0x18,%rsp
+  801647:	5b                   	pop    %rbx
+  801648:	41 5c                	pop    %r12
+  80164a:	41 5d                	pop    %r13
+  80164c:	5d                   	pop    %rbp
+  80164d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80164e:	8b 3b                	mov    (%rbx),%edi
+  801650:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801654:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  80165b:	00 00 00 
+  80165e:	ff d0                	call   *%rax
+  801660:	41 89 c5             	mov    %eax,%r13d
+  801663:	85 c0                	test   %eax,%eax
+  801665:	78 1b                	js     801682 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801667:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80166b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80166f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801675:	48 85 c0             	test   %rax,%rax
+  801678:	74 08                	je     801682 <fd_close+0x8f>
+  80167a:	48 89 df             	mov    %rbx,%rdi
+  80167d:	ff d0                	call   *%rax
+  80167f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801682:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801687:	48 89 de             	mov    %rbx,%rsi
+  80168a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80168f:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  801696:	00 00 00 
+  801699:	ff d0                	call   *%rax
+    return res;
+  80169b:	eb a3                	jmp    801640 <fd_close+0x4d>
+
+000000000080169d <close>:
+
+int
+close(int fdnum) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+  8016a1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8016a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8016a9:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  8016b0:	00 00 00 
+  8016b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8016b5:	85 c0                	test   %eax,%eax
+  8016b7:	78 15                	js     8016ce <close+0x31>
+
+    return fd_close(fd, 1);
+  8016b9:	be 01 00 00 00       	mov    $0x1,%esi
+  8016be:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8016c2:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  8016c9:	00 00 00 
+  8016cc:	ff d0                	call   *%rax
+}
+  8016ce:	c9                   	leave
+  8016cf:	c3                   	ret
+
+00000000008016d0 <close_all>:
+
+void
+close_all(void) {
+  8016d0:	55                   	push   %rbp
+  8016d1:	48 89 e5             	mov    %rsp,%rbp
+  8016d4:	41 54                	push   %r12
+  8016d6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8016d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8016dc:	49 bc 9d 16 80 00 00 	movabs $0x80169d,%r12
+  8016e3:	00 00 00 
+  8016e6:	89 df                	mov    %ebx,%edi
+  8016e8:	41 ff d4             	call   *%r12
+  8016eb:	83 c3 01             	add    $0x1,%ebx
+  8016ee:	83 fb 20             	cmp    $0x20,%ebx
+  8016f1:	75 f3                	jne    8016e6 <close_all+0x16>
+}
+  8016f3:	5b                   	pop    %rbx
+  8016f4:	41 5c                	pop    %r12
+  8016f6:	5d                   	pop    %rbp
+  8016f7:	c3                   	ret
+
+00000000008016f8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8016f8:	55                   	push   %rbp
+  8016f9:	48 89 e5             	mov    %rsp,%rbp
+  8016fc:	41 57                	push   %r15
+  8016fe:	41 56                	push   %r14
+  801700:	41 55                	push   %r13
+  801702:	41 54                	push   %r12
+  801704:	53                   	push   %rbx
+  801705:	48 83 ec 18          	sub    $0x18,%rsp
+  801709:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80170c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801710:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  801717:	00 00 00 
+  80171a:	ff d0                	call   *%rax
+  80171c:	89 c3                	mov    %eax,%ebx
+  80171e:	85 c0                	test   %eax,%eax
+  801720:	0f 88 b8 00 00 00    	js     8017de <dup+0xe6>
+    close(newfdnum);
+  801726:	44 89 e7             	mov    %r12d,%edi
+  801729:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  801730:	00 00 00 
+  801733:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801735:	4d 63 ec             	movslq %r12d,%r13
+  801738:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80173f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801743:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801747:	4c 89 ff             	mov    %r15,%rdi
+  80174a:	49 be bc 14 80 00 00 	movabs $0x8014bc,%r14
+  801751:	00 00 00 
+  801754:	41 ff d6             	call   *%r14
+  801757:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80175a:	4c 89 ef             	mov    %r13,%rdi
+  80175d:	41 ff d6             	call   *%r14
+  801760:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801763:	48 89 df             	mov    %rbx,%rdi
+  801766:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  80176d:	00 00 00 
+  801770:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801772:	a8 04                	test   $0x4,%al
+  801774:	74 2b                	je     8017a1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801776:	41 89 c1             	mov    %eax,%r9d
+  801779:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80177f:	4c 89 f1             	mov    %r14,%rcx
+  801782:	ba 00 00 00 00       	mov    $0x0,%edx
+  801787:	48 89 de             	mov    %rbx,%rsi
+  80178a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80178f:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  801796:	00 00 00 
+  801799:	ff d0                	call   *%rax
+  80179b:	89 c3                	mov    %eax,%ebx
+  80179d:	85 c0                	test   %eax,%eax
+  80179f:	78 4e                	js     8017ef <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8017a1:	4c 89 ff             	mov    %r15,%rdi
+  8017a4:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  8017ab:	00 00 00 
+  8017ae:	ff d0                	call   *%rax
+  8017b0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8017b3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8017b9:	4c 89 e9             	mov    %r13,%rcx
+  8017bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017c1:	4c 89 fe             	mov    %r15,%rsi
+  8017c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017c9:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  8017d0:	00 00 00 
+  8017d3:	ff d0                	call   *%rax
+  8017d5:	89 c3                	mov    %eax,%ebx
+  8017d7:	85 c0                	test   %eax,%eax
+  8017d9:	78 14                	js     8017ef <dup+0xf7>
+
+    return newfdnum;
+  8017db:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8017de:	89 d8                	mov    %ebx,%eax
+  8017e0:	48 83 c4 18          	add    $0x18,%rsp
+  8017e4:	5b                   	pop    %rbx
+  8017e5:	41 5c                	pop    %r12
+  8017e7:	41 5d                	pop    %r13
+  8017e9:	41 5e                	pop    %r14
+  8017eb:	41 5f                	pop    %r15
+  8017ed:	5d                   	pop    %rbp
+  8017ee:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8017ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8017f4:	4c 89 ee             	mov    %r13,%rsi
+  8017f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017fc:	49 bc 1d 11 80 00 00 	movabs $0x80111d,%r12
+  801803:	00 00 00 
+  801806:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801809:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80180e:	4c 89 f6             	mov    %r14,%rsi
+  801811:	bf 00 00 00 00       	mov    $0x0,%edi
+  801816:	41 ff d4             	call   *%r12
+    return res;
+  801819:	eb c3                	jmp    8017de <dup+0xe6>
+
+000000000080181b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+  80181f:	41 56                	push   %r14
+  801821:	41 55                	push   %r13
+  801823:	41 54                	push   %r12
+  801825:	53                   	push   %rbx
+  801826:	48 83 ec 10          	sub    $0x10,%rsp
+  80182a:	89 fb                	mov    %edi,%ebx
+  80182c:	49 89 f4             	mov    %rsi,%r12
+  80182f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801832:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801836:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  80183d:	00 00 00 
+  801840:	ff d0                	call   *%rax
+  801842:	85 c0                	test   %eax,%eax
+  801844:	78 4c                	js     801892 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801846:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  80184a:	41 8b 3e             	mov    (%r14),%edi
+  80184d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801851:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801858:	00 00 00 
+  80185b:	ff d0                	call   *%rax
+  80185d:	85 c0                	test   %eax,%eax
+  80185f:	78 35                	js     801896 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801861:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801865:	83 e0 03             	and    $0x3,%eax
+  801868:	83 f8 01             	cmp    $0x1,%eax
+  80186b:	74 2d                	je     80189a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  80186d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801871:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801875:	48 85 c0             	test   %rax,%rax
+  801878:	74 56                	je     8018d0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  80187a:	4c 89 ea             	mov    %r13,%rdx
+  80187d:	4c 89 e6             	mov    %r12,%rsi
+  801880:	4c 89 f7             	mov    %r14,%rdi
+  801883:	ff d0                	call   *%rax
+}
+  801885:	48 83 c4 10          	add    $0x10,%rsp
+  801889:	5b                   	pop    %rbx
+  80188a:	41 5c                	pop    %r12
+  80188c:	41 5d                	pop    %r13
+  80188e:	41 5e                	pop    %r14
+  801890:	5d                   	pop    %rbp
+  801891:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801892:	48 98                	cltq
+  801894:	eb ef                	jmp    801885 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801896:	48 98                	cltq
+  801898:	eb eb                	jmp    801885 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  80189a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018a1:	00 00 00 
+  8018a4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8018aa:	89 da                	mov    %ebx,%edx
+  8018ac:	48 bf c9 4c 80 00 00 	movabs $0x804cc9,%rdi
+  8018b3:	00 00 00 
+  8018b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018bb:	48 b9 f3 01 80 00 00 	movabs $0x8001f3,%rcx
+  8018c2:	00 00 00 
+  8018c5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8018c7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8018ce:	eb b5                	jmp    801885 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  8018d0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  8018d7:	eb ac                	jmp    801885 <read+0x6a>
+
+00000000008018d9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  8018d9:	55                   	push   %rbp
+  8018da:	48 89 e5             	mov    %rsp,%rbp
+  8018dd:	41 57                	push   %r15
+  8018df:	41 56                	push   %r14
+  8018e1:	41 55                	push   %r13
+  8018e3:	41 54                	push   %r12
+  8018e5:	53                   	push   %rbx
+  8018e6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  8018ea:	48 85 d2             	test   %rdx,%rdx
+  8018ed:	74 54                	je     801943 <readn+0x6a>
+  8018ef:	41 89 fd             	mov    %edi,%r13d
+  8018f2:	49 89 f6             	mov    %rsi,%r14
+  8018f5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  8018f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  8018fd:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801902:	49 bf 1b 18 80 00 00 	movabs $0x80181b,%r15
+  801909:	00 00 00 
+  80190c:	4c 89 e2             	mov    %r12,%rdx
+  80190f:	48 29 f2             	sub    %rsi,%rdx
+  801912:	4c 01 f6             	add    %r14,%rsi
+  801915:	44 89 ef             	mov    %r13d,%edi
+  801918:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80191b:	85 c0                	test   %eax,%eax
+  80191d:	78 20                	js     80193f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80191f:	01 c3                	add    %eax,%ebx
+  801921:	85 c0                	test   %eax,%eax
+  801923:	74 08                	je     80192d <readn+0x54>
+  801925:	48 63 f3             	movslq %ebx,%rsi
+  801928:	4c 39 e6             	cmp    %r12,%rsi
+  80192b:	72 df                	jb     80190c <readn+0x33>
+    }
+    return res;
+  80192d:	48 63 c3             	movslq %ebx,%rax
+}
+  801930:	48 83 c4 08          	add    $0x8,%rsp
+  801934:	5b                   	pop    %rbx
+  801935:	41 5c                	pop    %r12
+  801937:	41 5d                	pop    %r13
+  801939:	41 5e                	pop    %r14
+  80193b:	41 5f                	pop    %r15
+  80193d:	5d                   	pop    %rbp
+  80193e:	c3                   	ret
+        if (inc < 0) return inc;
+  80193f:	48 98                	cltq
+  801941:	eb ed                	jmp    801930 <readn+0x57>
+    int inc = 1, res = 0;
+  801943:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801948:	eb e3                	jmp    80192d <readn+0x54>
+
+000000000080194a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80194a:	55                   	push   %rbp
+  80194b:	48 89 e5             	mov    %rsp,%rbp
+  80194e:	41 56                	push   %r14
+  801950:	41 55                	push   %r13
+  801952:	41 54                	push   %r12
+  801954:	53                   	push   %rbx
+  801955:	48 83 ec 10          	sub    $0x10,%rsp
+  801959:	89 fb                	mov    %edi,%ebx
+  80195b:	49 89 f4             	mov    %rsi,%r12
+  80195e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801961:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801965:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  80196c:	00 00 00 
+  80196f:	ff d0                	call   *%rax
+  801971:	85 c0                	test   %eax,%eax
+  801973:	78 47                	js     8019bc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801975:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801979:	41 8b 3e             	mov    (%r14),%edi
+  80197c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801980:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801987:	00 00 00 
+  80198a:	ff d0                	call   *%rax
+  80198c:	85 c0                	test   %eax,%eax
+  80198e:	78 30                	js     8019c0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801990:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801995:	74 2d                	je     8019c4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801997:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80199b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80199f:	48 85 c0             	test   %rax,%rax
+  8019a2:	74 56                	je     8019fa <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8019a4:	4c 89 ea             	mov    %r13,%rdx
+  8019a7:	4c 89 e6             	mov    %r12,%rsi
+  8019aa:	4c 89 f7             	mov    %r14,%rdi
+  8019ad:	ff d0                	call   *%rax
+}
+  8019af:	48 83 c4 10          	add    $0x10,%rsp
+  8019b3:	5b                   	pop    %rbx
+  8019b4:	41 5c                	pop    %r12
+  8019b6:	41 5d                	pop    %r13
+  8019b8:	41 5e                	pop    %r14
+  8019ba:	5d                   	pop    %rbp
+  8019bb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8019bc:	48 98                	cltq
+  8019be:	eb ef                	jmp    8019af <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8019c0:	48 98                	cltq
+  8019c2:	eb eb                	jmp    8019af <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8019c4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8019cb:	00 00 00 
+  8019ce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019d4:	89 da                	mov    %ebx,%edx
+  8019d6:	48 bf e5 4c 80 00 00 	movabs $0x804ce5,%rdi
+  8019dd:	00 00 00 
+  8019e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e5:	48 b9 f3 01 80 00 00 	movabs $0x8001f3,%rcx
+  8019ec:	00 00 00 
+  8019ef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8019f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8019f8:	eb b5                	jmp    8019af <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8019fa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801a01:	eb ac                	jmp    8019af <write+0x65>
+
+0000000000801a03 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801a03:	55                   	push   %rbp
+  801a04:	48 89 e5             	mov    %rsp,%rbp
+  801a07:	41 54                	push   %r12
+  801a09:	53                   	push   %rbx
+  801a0a:	48 83 ec 10          	sub    $0x10,%rsp
+  801a0e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a10:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801a14:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  801a1b:	00 00 00 
+  801a1e:	ff d0                	call   *%rax
+  801a20:	85 c0                	test   %eax,%eax
+  801a22:	78 3e                	js     801a62 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a24:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801a28:	41 8b 3c 24          	mov    (%r12),%edi
+  801a2c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801a30:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801a37:	00 00 00 
+  801a3a:	ff d0                	call   *%rax
+  801a3c:	85 c0                	test   %eax,%eax
+  801a3e:	78 22                	js     801a62 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801a40:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801a44:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801a48:	48 85 c0             	test   %rax,%rax
+  801a4b:	74 0b                	je     801a58 <seek+0x55>
+  801a4d:	89 de                	mov    %ebx,%esi
+  801a4f:	4c 89 e7             	mov    %r12,%rdi
+  801a52:	ff d0                	call   *%rax
+  801a54:	85 c0                	test   %eax,%eax
+  801a56:	78 0a                	js     801a62 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801a58:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801a5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a62:	48 83 c4 10          	add    $0x10,%rsp
+  801a66:	5b                   	pop    %rbx
+  801a67:	41 5c                	pop    %r12
+  801a69:	5d                   	pop    %rbp
+  801a6a:	c3                   	ret
+
+0000000000801a6b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801a6b:	55                   	push   %rbp
+  801a6c:	48 89 e5             	mov    %rsp,%rbp
+  801a6f:	41 55                	push   %r13
+  801a71:	41 54                	push   %r12
+  801a73:	53                   	push   %rbx
+  801a74:	48 83 ec 18          	sub    $0x18,%rsp
+  801a78:	89 fb                	mov    %edi,%ebx
+  801a7a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a7d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a81:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  801a88:	00 00 00 
+  801a8b:	ff d0                	call   *%rax
+  801a8d:	85 c0                	test   %eax,%eax
+  801a8f:	78 38                	js     801ac9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a91:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801a95:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801a99:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a9d:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801aa4:	00 00 00 
+  801aa7:	ff d0                	call   *%rax
+  801aa9:	85 c0                	test   %eax,%eax
+  801aab:	78 1c                	js     801ac9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801aad:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801ab2:	74 20                	je     801ad4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ab4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ab8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801abc:	48 85 c0             	test   %rax,%rax
+  801abf:	74 47                	je     801b08 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ac1:	44 89 e6             	mov    %r12d,%esi
+  801ac4:	4c 89 ef             	mov    %r13,%rdi
+  801ac7:	ff d0                	call   *%rax
+}
+  801ac9:	48 83 c4 18          	add    $0x18,%rsp
+  801acd:	5b                   	pop    %rbx
+  801ace:	41 5c                	pop    %r12
+  801ad0:	41 5d                	pop    %r13
+  801ad2:	5d                   	pop    %rbp
+  801ad3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801ad4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801adb:	00 00 00 
+  801ade:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801ae4:	89 da                	mov    %ebx,%edx
+  801ae6:	48 bf a8 4c 80 00 00 	movabs $0x804ca8,%rdi
+  801aed:	00 00 00 
+  801af0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af5:	48 b9 f3 01 80 00 00 	movabs $0x8001f3,%rcx
+  801afc:	00 00 00 
+  801aff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b01:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b06:	eb c1                	jmp    801ac9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801b08:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b0d:	eb ba                	jmp    801ac9 <ftruncate+0x5e>
+
+0000000000801b0f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801b0f:	55                   	push   %rbp
+  801b10:	48 89 e5             	mov    %rsp,%rbp
+  801b13:	41 54                	push   %r12
+  801b15:	53                   	push   %rbx
+  801b16:	48 83 ec 10          	sub    $0x10,%rsp
+  801b1a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b1d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801b21:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  801b28:	00 00 00 
+  801b2b:	ff d0                	call   *%rax
+  801b2d:	85 c0                	test   %eax,%eax
+  801b2f:	78 4e                	js     801b7f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b31:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801b35:	41 8b 3c 24          	mov    (%r12),%edi
+  801b39:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801b3d:	48 b8 83 15 80 00 00 	movabs $0x801583,%rax
+  801b44:	00 00 00 
+  801b47:	ff d0                	call   *%rax
+  801b49:	85 c0                	test   %eax,%eax
+  801b4b:	78 32                	js     801b7f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b4d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801b51:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801b56:	74 30                	je     801b88 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801b58:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801b5b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801b62:	00 00 00 
+    stat->st_isdir = 0;
+  801b65:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801b6c:	00 00 00 
+    stat->st_dev = dev;
+  801b6f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801b76:	48 89 de             	mov    %rbx,%rsi
+  801b79:	4c 89 e7             	mov    %r12,%rdi
+  801b7c:	ff 50 28             	call   *0x28(%rax)
+}
+  801b7f:	48 83 c4 10          	add    $0x10,%rsp
+  801b83:	5b                   	pop    %rbx
+  801b84:	41 5c                	pop    %r12
+  801b86:	5d                   	pop    %rbp
+  801b87:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801b88:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801b8d:	eb f0                	jmp    801b7f <fstat+0x70>
+
+0000000000801b8f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801b8f:	55                   	push   %rbp
+  801b90:	48 89 e5             	mov    %rsp,%rbp
+  801b93:	41 54                	push   %r12
+  801b95:	53                   	push   %rbx
+  801b96:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801b99:	be 00 00 00 00       	mov    $0x0,%esi
+  801b9e:	48 b8 fd 2c 80 00 00 	movabs $0x802cfd,%rax
+  801ba5:	00 00 00 
+  801ba8:	ff d0                	call   *%rax
+  801baa:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801bac:	85 c0                	test   %eax,%eax
+  801bae:	78 25                	js     801bd5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801bb0:	4c 89 e6             	mov    %r12,%rsi
+  801bb3:	89 c7                	mov    %eax,%edi
+  801bb5:	48 b8 0f 1b 80 00 00 	movabs $0x801b0f,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+  801bc1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801bc4:	89 df                	mov    %ebx,%edi
+  801bc6:	48 b8 9d 16 80 00 00 	movabs $0x80169d,%rax
+  801bcd:	00 00 00 
+  801bd0:	ff d0                	call   *%rax
+
+    return res;
+  801bd2:	44 89 e3             	mov    %r12d,%ebx
+}
+  801bd5:	89 d8                	mov    %ebx,%eax
+  801bd7:	5b                   	pop    %rbx
+  801bd8:	41 5c                	pop    %r12
+  801bda:	5d                   	pop    %rbp
+  801bdb:	c3                   	ret
+
+0000000000801bdc <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bdc:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801be3:	00 00 00 
+  801be6:	83 38 00             	cmpl   $0x0,(%rax)
+  801be9:	74 0a                	je     801bf5 <fsenv+0x19>
+    return envid;
+}
+  801beb:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801bf2:	00 00 
+  801bf4:	c3                   	ret
+fsenv(void) {
+  801bf5:	55                   	push   %rbp
+  801bf6:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801bf9:	bf 03 00 00 00       	mov    $0x3,%edi
+  801bfe:	48 b8 6d 46 80 00 00 	movabs $0x80466d,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801c11:	00 00 
+}
+  801c13:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801c1a:	00 00 
+  801c1c:	5d                   	pop    %rbp
+  801c1d:	c3                   	ret
+
+0000000000801c1e <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801c1e:	55                   	push   %rbp
+  801c1f:	48 89 e5             	mov    %rsp,%rbp
+  801c22:	41 54                	push   %r12
+  801c24:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801c25:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c2a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c2f:	48 89 de             	mov    %rbx,%rsi
+  801c32:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c37:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  801c3e:	00 00 00 
+  801c41:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801c43:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801c4a:	00 00 00 
+  801c4d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801c53:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801c58:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801c5d:	48 89 de             	mov    %rbx,%rsi
+  801c60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c65:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  801c6c:	00 00 00 
+  801c6f:	ff d0                	call   *%rax
+  801c71:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	0f 88 a2 00 00 00    	js     801d1d <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801c7b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c82:	00 00 00 
+  801c85:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801c8b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801c90:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801c92:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801c97:	49 bc 2f 3e 80 00 00 	movabs $0x803e2f,%r12
+  801c9e:	00 00 00 
+  801ca1:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801ca4:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801ca9:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801cac:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801cb3:	00 00 00 
+  801cb6:	ff d0                	call   *%rax
+  801cb8:	89 c7                	mov    %eax,%edi
+  801cba:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801cc0:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801cc5:	48 89 da             	mov    %rbx,%rdx
+  801cc8:	be 09 00 00 00       	mov    $0x9,%esi
+  801ccd:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  801cd4:	00 00 00 
+  801cd7:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801cd9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801cde:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ce3:	be 00 00 00 00       	mov    $0x0,%esi
+  801ce8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ced:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  801cf4:	00 00 00 
+  801cf7:	ff d0                	call   *%rax
+  801cf9:	89 c3                	mov    %eax,%ebx
+  801cfb:	85 c0                	test   %eax,%eax
+  801cfd:	78 25                	js     801d24 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801cff:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d06:	00 00 00 
+  801d09:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801d0f:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801d16:	00 00 
+    return 0;
+  801d18:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801d1d:	89 d8                	mov    %ebx,%eax
+  801d1f:	5b                   	pop    %rbx
+  801d20:	41 5c                	pop    %r12
+  801d22:	5d                   	pop    %rbp
+  801d23:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801d24:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801d29:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801d2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d33:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  801d3a:	00 00 00 
+  801d3d:	ff d0                	call   *%rax
+        return res;
+  801d3f:	eb dc                	jmp    801d1d <fschan_setup+0xff>
+
+0000000000801d41 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801d41:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d48:	00 00 00 
+  801d4b:	80 38 00             	cmpb   $0x0,(%rax)
+  801d4e:	74 55                	je     801da5 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d50:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d57:	00 00 00 
+  801d5a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801d60:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d65:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801d6c:	00 00 00 
+  801d6f:	3b 0a                	cmp    (%rdx),%ecx
+  801d71:	75 01                	jne    801d74 <fschan+0x33>
+}
+  801d73:	c3                   	ret
+fschan(void) {
+  801d74:	55                   	push   %rbp
+  801d75:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d78:	48 b8 1e 1c 80 00 00 	movabs $0x801c1e,%rax
+  801d7f:	00 00 00 
+  801d82:	ff d0                	call   *%rax
+  801d84:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801d86:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801d8b:	85 d2                	test   %edx,%edx
+  801d8d:	78 02                	js     801d91 <fschan+0x50>
+}
+  801d8f:	5d                   	pop    %rbp
+  801d90:	c3                   	ret
+        fschan_enabled = 0;
+  801d91:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801d98:	00 00 00 
+  801d9b:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801d9e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801da3:	eb ea                	jmp    801d8f <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801da5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801daa:	c3                   	ret
+
+0000000000801dab <fbuf>:
+fbuf(struct Fd *fd) {
+  801dab:	55                   	push   %rbp
+  801dac:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801daf:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  801db6:	00 00 00 
+  801db9:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801dbb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dc0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801dc4:	77 12                	ja     801dd8 <fbuf+0x2d>
+  801dc6:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801dca:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801dd1:	00 00 00 
+  801dd4:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801dd8:	48 89 d0             	mov    %rdx,%rax
+  801ddb:	5d                   	pop    %rbp
+  801ddc:	c3                   	ret
+
+0000000000801ddd <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801ddd:	55                   	push   %rbp
+  801dde:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  801de1:	48 83 c7 40          	add    $0x40,%rdi
+  801de5:	48 b8 69 3e 80 00 00 	movabs $0x803e69,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+  801df1:	84 c0                	test   %al,%al
+  801df3:	75 02                	jne    801df7 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  801df5:	5d                   	pop    %rbp
+  801df6:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  801df7:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  801dfe:	00 00 00 
+  801e01:	ff d0                	call   *%rax
+  801e03:	89 c7                	mov    %eax,%edi
+  801e05:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801e0b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801e10:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e15:	be 0a 00 00 00       	mov    $0xa,%esi
+  801e1a:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  801e21:	00 00 00 
+  801e24:	ff d0                	call   *%rax
+}
+  801e26:	eb cd                	jmp    801df5 <fschan_publish+0x18>
+
+0000000000801e28 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  801e28:	55                   	push   %rbp
+  801e29:	48 89 e5             	mov    %rsp,%rbp
+  801e2c:	41 57                	push   %r15
+  801e2e:	41 56                	push   %r14
+  801e30:	41 55                	push   %r13
+  801e32:	41 54                	push   %r12
+  801e34:	53                   	push   %rbx
+  801e35:	48 83 ec 48          	sub    $0x48,%rsp
+  801e39:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801e3d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801e41:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801e44:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801e48:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801e4b:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801e52:	00 00 00 
+  801e55:	8b 02                	mov    (%rdx),%eax
+  801e57:	83 c0 01             	add    $0x1,%eax
+  801e5a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801e5f:	0f 44 c1             	cmove  %ecx,%eax
+  801e62:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801e64:	4d 85 c0             	test   %r8,%r8
+  801e67:	74 2c                	je     801e95 <fschan_rw+0x6d>
+  801e69:	45 89 ce             	mov    %r9d,%r14d
+  801e6c:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801e73:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801e77:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801e7d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801e84:	00 
+  801e85:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801e8b:	b8 01 00 00 00       	mov    $0x1,%eax
+  801e90:	e9 41 01 00 00       	jmp    801fd6 <fschan_rw+0x1ae>
+  801e95:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801e99:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801e9d:	e9 9c 01 00 00       	jmp    80203e <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801ea2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801ea6:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801ea9:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801eac:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801eaf:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801eb3:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801eb7:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  801ebb:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  801ebf:	48 89 da             	mov    %rbx,%rdx
+  801ec2:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  801ec9:	00 00 00 
+  801ecc:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  801ece:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801ed2:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  801ed9:	00 00 00 
+  801edc:	ff d0                	call   *%rax
+            queued += blk;
+  801ede:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  801ee1:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801ee5:	4d 39 fc             	cmp    %r15,%r12
+  801ee8:	73 6b                	jae    801f55 <fschan_rw+0x12d>
+  801eea:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801eee:	77 65                	ja     801f55 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801ef0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801ef4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801ef8:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  801eff:	00 00 00 
+  801f02:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  801f04:	4c 89 fb             	mov    %r15,%rbx
+  801f07:	4c 29 e3             	sub    %r12,%rbx
+  801f0a:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  801f0f:	48 39 d3             	cmp    %rdx,%rbx
+  801f12:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  801f16:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801f1a:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801f1e:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801f22:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  801f25:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  801f27:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801f2e:	00 00 00 
+  801f31:	8b 09                	mov    (%rcx),%ecx
+  801f33:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  801f36:	83 fe 03             	cmp    $0x3,%esi
+  801f39:	0f 85 63 ff ff ff    	jne    801ea2 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801f3f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801f43:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801f46:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801f49:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801f4c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801f50:	e9 79 ff ff ff       	jmp    801ece <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801f55:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801f59:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801f60:	48 89 df             	mov    %rbx,%rdi
+  801f63:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  801f6a:	00 00 00 
+  801f6d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801f6f:	48 89 df             	mov    %rbx,%rdi
+  801f72:	48 b8 95 3e 80 00 00 	movabs $0x803e95,%rax
+  801f79:	00 00 00 
+  801f7c:	ff d0                	call   *%rax
+  801f7e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801f82:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801f86:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801f8a:	75 25                	jne    801fb1 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801f8c:	8b 40 04             	mov    0x4(%rax),%eax
+  801f8f:	85 c0                	test   %eax,%eax
+  801f91:	0f 88 86 00 00 00    	js     80201d <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801f97:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801f9b:	74 5b                	je     801ff8 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801f9d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801fa1:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801fa5:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801fa9:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801fad:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801fb1:	48 89 df             	mov    %rbx,%rdi
+  801fb4:	48 b8 bc 3e 80 00 00 	movabs $0x803ebc,%rax
+  801fbb:	00 00 00 
+  801fbe:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  801fc0:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801fc4:	83 f0 01             	xor    $0x1,%eax
+  801fc7:	4d 39 fc             	cmp    %r15,%r12
+  801fca:	0f 92 c2             	setb   %dl
+  801fcd:	84 c2                	test   %al,%dl
+  801fcf:	75 05                	jne    801fd6 <fschan_rw+0x1ae>
+  801fd1:	45 85 ed             	test   %r13d,%r13d
+  801fd4:	74 50                	je     802026 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801fd6:	4d 39 fc             	cmp    %r15,%r12
+  801fd9:	0f 92 c1             	setb   %cl
+  801fdc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  801fe0:	0f 96 c2             	setbe  %dl
+  801fe3:	84 d1                	test   %dl,%cl
+  801fe5:	0f 84 6a ff ff ff    	je     801f55 <fschan_rw+0x12d>
+  801feb:	84 c0                	test   %al,%al
+  801fed:	0f 85 fd fe ff ff    	jne    801ef0 <fschan_rw+0xc8>
+  801ff3:	e9 5d ff ff ff       	jmp    801f55 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801ff8:	48 63 d0             	movslq %eax,%rdx
+  801ffb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801fff:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802003:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802007:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80200b:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80200f:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  802016:	00 00 00 
+  802019:	ff d0                	call   *%rax
+  80201b:	eb 80                	jmp    801f9d <fschan_rw+0x175>
+                err = msg->fm_res;
+  80201d:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802020:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802024:	eb 8b                	jmp    801fb1 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802026:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80202b:	0f 85 68 fe ff ff    	jne    801e99 <fschan_rw+0x71>
+  802031:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802034:	85 c0                	test   %eax,%eax
+  802036:	0f 84 5d fe ff ff    	je     801e99 <fschan_rw+0x71>
+  80203c:	48 98                	cltq
+}
+  80203e:	48 83 c4 48          	add    $0x48,%rsp
+  802042:	5b                   	pop    %rbx
+  802043:	41 5c                	pop    %r12
+  802045:	41 5d                	pop    %r13
+  802047:	41 5e                	pop    %r14
+  802049:	41 5f                	pop    %r15
+  80204b:	5d                   	pop    %rbp
+  80204c:	c3                   	ret
+
+000000000080204d <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80204d:	55                   	push   %rbp
+  80204e:	48 89 e5             	mov    %rsp,%rbp
+  802051:	41 56                	push   %r14
+  802053:	41 55                	push   %r13
+  802055:	41 54                	push   %r12
+  802057:	53                   	push   %rbx
+  802058:	48 83 ec 10          	sub    $0x10,%rsp
+  80205c:	49 89 fe             	mov    %rdi,%r14
+  80205f:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802062:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802066:	48 29 f3             	sub    %rsi,%rbx
+  802069:	48 39 d3             	cmp    %rdx,%rbx
+  80206c:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802070:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802077:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802078:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80207d:	49 bd c6 3c 80 00 00 	movabs $0x803cc6,%r13
+  802084:	00 00 00 
+  802087:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80208e:	76 1e                	jbe    8020ae <mmap_fault+0x61>
+  802090:	4c 01 e7             	add    %r12,%rdi
+  802093:	41 ff d5             	call   *%r13
+  802096:	84 c0                	test   %al,%al
+  802098:	75 14                	jne    8020ae <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80209a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80209e:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8020a5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8020a9:	48 39 df             	cmp    %rbx,%rdi
+  8020ac:	72 e2                	jb     802090 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8020ae:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8020b5:	00 00 00 
+  8020b8:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8020bf:	00 00 00 
+  8020c2:	4c 89 f0             	mov    %r14,%rax
+  8020c5:	48 29 d0             	sub    %rdx,%rax
+  8020c8:	48 c1 f8 03          	sar    $0x3,%rax
+  8020cc:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8020d3:	aa aa aa 
+  8020d6:	48 0f af c2          	imul   %rdx,%rax
+  8020da:	48 c1 e0 0c          	shl    $0xc,%rax
+  8020de:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8020e3:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8020e7:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8020e9:	44 89 e0             	mov    %r12d,%eax
+  8020ec:	41 03 46 10          	add    0x10(%r14),%eax
+  8020f0:	41 2b 06             	sub    (%r14),%eax
+  8020f3:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8020f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8020fa:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8020fe:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802102:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802105:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  80210c:	00 00 00 
+  80210f:	ff d0                	call   *%rax
+  802111:	89 c7                	mov    %eax,%edi
+  802113:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802119:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80211e:	48 89 da             	mov    %rbx,%rdx
+  802121:	be 0f 00 00 00       	mov    $0xf,%esi
+  802126:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  80212d:	00 00 00 
+  802130:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802132:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802137:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80213b:	4c 89 e6             	mov    %r12,%rsi
+  80213e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802143:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  80214a:	00 00 00 
+  80214d:	ff d0                	call   *%rax
+  80214f:	48 98                	cltq
+}
+  802151:	48 83 c4 10          	add    $0x10,%rsp
+  802155:	5b                   	pop    %rbx
+  802156:	41 5c                	pop    %r12
+  802158:	41 5d                	pop    %r13
+  80215a:	41 5e                	pop    %r14
+  80215c:	5d                   	pop    %rbp
+  80215d:	c3                   	ret
+
+000000000080215e <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80215e:	48 8b 37             	mov    (%rdi),%rsi
+  802161:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802168:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80216f:	00 00 00 
+  802172:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802177:	eb 0f                	jmp    802188 <mmap_pgfault+0x2a>
+  802179:	c3                   	ret
+  80217a:	48 83 c1 01          	add    $0x1,%rcx
+  80217e:	48 83 c2 18          	add    $0x18,%rdx
+  802182:	48 83 f9 20          	cmp    $0x20,%rcx
+  802186:	74 6e                	je     8021f6 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802188:	48 8b 02             	mov    (%rdx),%rax
+  80218b:	48 83 e8 01          	sub    $0x1,%rax
+  80218f:	48 39 f0             	cmp    %rsi,%rax
+  802192:	73 e6                	jae    80217a <mmap_pgfault+0x1c>
+  802194:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802198:	73 e0                	jae    80217a <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80219a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80219e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021a3:	f6 c2 01             	test   $0x1,%dl
+  8021a6:	75 d1                	jne    802179 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8021a8:	f6 c2 02             	test   $0x2,%dl
+  8021ab:	74 1a                	je     8021c7 <mmap_pgfault+0x69>
+  8021ad:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b6:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8021bd:	00 00 00 
+  8021c0:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8021c5:	74 35                	je     8021fc <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8021c7:	55                   	push   %rbp
+  8021c8:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8021cb:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8021cf:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8021d6:	00 00 00 
+  8021d9:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8021dd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8021e2:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  8021e9:	00 00 00 
+  8021ec:	ff d0                	call   *%rax
+  8021ee:	48 85 c0             	test   %rax,%rax
+  8021f1:	0f 9f c0             	setg   %al
+}
+  8021f4:	5d                   	pop    %rbp
+  8021f5:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8021f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021fb:	c3                   	ret
+}
+  8021fc:	c3                   	ret
+
+00000000008021fd <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8021fd:	55                   	push   %rbp
+  8021fe:	48 89 e5             	mov    %rsp,%rbp
+  802201:	41 54                	push   %r12
+  802203:	53                   	push   %rbx
+  802204:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802207:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80220e:	00 00 00 
+  802211:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802216:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80221a:	74 15                	je     802231 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80221c:	48 83 c3 01          	add    $0x1,%rbx
+  802220:	48 83 c0 18          	add    $0x18,%rax
+  802224:	48 83 fb 20          	cmp    $0x20,%rbx
+  802228:	75 ec                	jne    802216 <mmap_alloc+0x19>
+    return NULL;
+  80222a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80222f:	eb 52                	jmp    802283 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802231:	4c 89 e7             	mov    %r12,%rdi
+  802234:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  80223b:	00 00 00 
+  80223e:	ff d0                	call   *%rax
+  802240:	41 89 c1             	mov    %eax,%r9d
+  802243:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80224a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80224e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802254:	ba 00 00 00 00       	mov    $0x0,%edx
+  802259:	4c 89 e6             	mov    %r12,%rsi
+  80225c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802261:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  802268:	00 00 00 
+  80226b:	ff d0                	call   *%rax
+  80226d:	85 c0                	test   %eax,%eax
+  80226f:	78 17                	js     802288 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802271:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802275:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80227c:	00 00 00 
+  80227f:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802283:	5b                   	pop    %rbx
+  802284:	41 5c                	pop    %r12
+  802286:	5d                   	pop    %rbp
+  802287:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802288:	b8 00 00 00 00       	mov    $0x0,%eax
+  80228d:	eb f4                	jmp    802283 <mmap_alloc+0x86>
+
+000000000080228f <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+  802293:	41 56                	push   %r14
+  802295:	41 55                	push   %r13
+  802297:	41 54                	push   %r12
+  802299:	53                   	push   %rbx
+  80229a:	48 83 ec 10          	sub    $0x10,%rsp
+  80229e:	41 89 fc             	mov    %edi,%r12d
+  8022a1:	49 89 f5             	mov    %rsi,%r13
+  8022a4:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8022a7:	48 89 f0             	mov    %rsi,%rax
+  8022aa:	48 09 d0             	or     %rdx,%rax
+  8022ad:	75 0d                	jne    8022bc <fsipc+0x2d>
+  8022af:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8022b2:	83 f8 04             	cmp    $0x4,%eax
+  8022b5:	76 7d                	jbe    802334 <fsipc+0xa5>
+  8022b7:	83 ff 0d             	cmp    $0xd,%edi
+  8022ba:	74 78                	je     802334 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8022bc:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8022c3:	00 00 00 
+  8022c6:	ff d0                	call   *%rax
+  8022c8:	89 c7                	mov    %eax,%edi
+  8022ca:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8022d1:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8022d8:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8022df:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8022e5:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8022ec:	00 00 00 
+  8022ef:	44 89 e6             	mov    %r12d,%esi
+  8022f2:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  8022f9:	00 00 00 
+  8022fc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8022fe:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802305:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802306:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80230b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80230f:	4c 89 ee             	mov    %r13,%rsi
+  802312:	bf 00 00 00 00       	mov    $0x0,%edi
+  802317:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  80231e:	00 00 00 
+  802321:	ff d0                	call   *%rax
+  802323:	89 c3                	mov    %eax,%ebx
+}
+  802325:	89 d8                	mov    %ebx,%eax
+  802327:	48 83 c4 10          	add    $0x10,%rsp
+  80232b:	5b                   	pop    %rbx
+  80232c:	41 5c                	pop    %r12
+  80232e:	41 5d                	pop    %r13
+  802330:	41 5e                	pop    %r14
+  802332:	5d                   	pop    %rbp
+  802333:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802334:	48 b8 41 1d 80 00 00 	movabs $0x801d41,%rax
+  80233b:	00 00 00 
+  80233e:	ff d0                	call   *%rax
+  802340:	49 89 c6             	mov    %rax,%r14
+  802343:	48 85 c0             	test   %rax,%rax
+  802346:	0f 84 70 ff ff ff    	je     8022bc <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80234c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802350:	48 b8 44 3e 80 00 00 	movabs $0x803e44,%rax
+  802357:	00 00 00 
+  80235a:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80235c:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80235f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802366:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80236a:	ba 10 00 00 00       	mov    $0x10,%edx
+  80236f:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802376:	00 00 00 
+  802379:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802385:	4c 89 f7             	mov    %r14,%rdi
+  802388:	48 b8 dd 1d 80 00 00 	movabs $0x801ddd,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802394:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80239b:	4c 89 f7             	mov    %r14,%rdi
+  80239e:	48 b8 07 3f 80 00 00 	movabs $0x803f07,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8023aa:	4c 89 f7             	mov    %r14,%rdi
+  8023ad:	48 b8 95 3e 80 00 00 	movabs $0x803e95,%rax
+  8023b4:	00 00 00 
+  8023b7:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8023b9:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8023bc:	41 83 fc 05          	cmp    $0x5,%r12d
+  8023c0:	75 04                	jne    8023c6 <fsipc+0x137>
+  8023c2:	85 db                	test   %ebx,%ebx
+  8023c4:	79 14                	jns    8023da <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8023c6:	4c 89 f7             	mov    %r14,%rdi
+  8023c9:	48 b8 bc 3e 80 00 00 	movabs $0x803ebc,%rax
+  8023d0:	00 00 00 
+  8023d3:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8023d5:	e9 4b ff ff ff       	jmp    802325 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8023da:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023de:	ba 88 00 00 00       	mov    $0x88,%edx
+  8023e3:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8023ea:	00 00 00 
+  8023ed:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  8023f4:	00 00 00 
+  8023f7:	ff d0                	call   *%rax
+  8023f9:	eb cb                	jmp    8023c6 <fsipc+0x137>
+
+00000000008023fb <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8023fb:	55                   	push   %rbp
+  8023fc:	48 89 e5             	mov    %rsp,%rbp
+  8023ff:	41 57                	push   %r15
+  802401:	41 56                	push   %r14
+  802403:	41 55                	push   %r13
+  802405:	41 54                	push   %r12
+  802407:	53                   	push   %rbx
+  802408:	48 83 ec 18          	sub    $0x18,%rsp
+  80240c:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802410:	49 89 f6             	mov    %rsi,%r14
+  802413:	49 89 d4             	mov    %rdx,%r12
+  802416:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802419:	48 b8 41 1d 80 00 00 	movabs $0x801d41,%rax
+  802420:	00 00 00 
+  802423:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802425:	48 85 c0             	test   %rax,%rax
+  802428:	0f 85 96 00 00 00    	jne    8024c4 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80242e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802435:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802436:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80243d:	00 00 00 
+    while (n) {
+  802440:	4d 85 e4             	test   %r12,%r12
+  802443:	74 79                	je     8024be <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802445:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80244a:	49 39 dc             	cmp    %rbx,%r12
+  80244d:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802451:	48 89 da             	mov    %rbx,%rdx
+  802454:	4c 89 f6             	mov    %r14,%rsi
+  802457:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80245e:	00 00 00 
+  802461:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  802468:	00 00 00 
+  80246b:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80246d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802471:	8b 40 0c             	mov    0xc(%rax),%eax
+  802474:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802477:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80247a:	44 01 e8             	add    %r13d,%eax
+  80247d:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802481:	41 0f 44 c5          	cmove  %r13d,%eax
+  802485:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802489:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80248d:	48 89 da             	mov    %rbx,%rdx
+  802490:	be 00 00 00 00       	mov    $0x0,%esi
+  802495:	bf 04 00 00 00       	mov    $0x4,%edi
+  80249a:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  8024a1:	00 00 00 
+  8024a4:	ff d0                	call   *%rax
+        if (res < 0)
+  8024a6:	85 c0                	test   %eax,%eax
+  8024a8:	78 4a                	js     8024f4 <devfile_write_direct+0xf9>
+        buf += res;
+  8024aa:	48 98                	cltq
+  8024ac:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8024af:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8024b3:	49 29 c4             	sub    %rax,%r12
+  8024b6:	75 8d                	jne    802445 <devfile_write_direct+0x4a>
+    return write;
+  8024b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024bc:	eb 27                	jmp    8024e5 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8024be:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8024c2:	eb f4                	jmp    8024b8 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8024c4:	45 89 e9             	mov    %r13d,%r9d
+  8024c7:	4d 89 e0             	mov    %r12,%r8
+  8024ca:	4c 89 f1             	mov    %r14,%rcx
+  8024cd:	ba 04 00 00 00       	mov    $0x4,%edx
+  8024d2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8024d6:	48 89 c7             	mov    %rax,%rdi
+  8024d9:	48 b8 28 1e 80 00 00 	movabs $0x801e28,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+}
+  8024e5:	48 83 c4 18          	add    $0x18,%rsp
+  8024e9:	5b                   	pop    %rbx
+  8024ea:	41 5c                	pop    %r12
+  8024ec:	41 5d                	pop    %r13
+  8024ee:	41 5e                	pop    %r14
+  8024f0:	41 5f                	pop    %r15
+  8024f2:	5d                   	pop    %rbp
+  8024f3:	c3                   	ret
+            return res;
+  8024f4:	48 98                	cltq
+  8024f6:	eb ed                	jmp    8024e5 <devfile_write_direct+0xea>
+
+00000000008024f8 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8024f8:	55                   	push   %rbp
+  8024f9:	48 89 e5             	mov    %rsp,%rbp
+  8024fc:	41 54                	push   %r12
+  8024fe:	53                   	push   %rbx
+  8024ff:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802502:	48 b8 ab 1d 80 00 00 	movabs $0x801dab,%rax
+  802509:	00 00 00 
+  80250c:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80250e:	48 85 c0             	test   %rax,%rax
+  802511:	74 71                	je     802584 <fbuf_flush+0x8c>
+  802513:	48 89 c3             	mov    %rax,%rbx
+  802516:	b8 00 00 00 00       	mov    $0x0,%eax
+  80251b:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80251f:	75 05                	jne    802526 <fbuf_flush+0x2e>
+}
+  802521:	5b                   	pop    %rbx
+  802522:	41 5c                	pop    %r12
+  802524:	5d                   	pop    %rbp
+  802525:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802526:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802529:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80252d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802534:	00 00 00 
+  802537:	48 89 de             	mov    %rbx,%rsi
+  80253a:	48 29 c6             	sub    %rax,%rsi
+  80253d:	48 c1 fe 03          	sar    $0x3,%rsi
+  802541:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802548:	aa aa aa 
+  80254b:	48 0f af f0          	imul   %rax,%rsi
+  80254f:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802553:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802558:	48 01 c6             	add    %rax,%rsi
+  80255b:	4c 89 e7             	mov    %r12,%rdi
+  80255e:	48 b8 fb 23 80 00 00 	movabs $0x8023fb,%rax
+  802565:	00 00 00 
+  802568:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80256a:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80256e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802575:	00 
+    return res < 0 ? res : 0;
+  802576:	48 85 c0             	test   %rax,%rax
+  802579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80257e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802582:	eb 9d                	jmp    802521 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802584:	b8 00 00 00 00       	mov    $0x0,%eax
+  802589:	eb 96                	jmp    802521 <fbuf_flush+0x29>
+
+000000000080258b <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80258b:	55                   	push   %rbp
+  80258c:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80258f:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802596:	00 00 00 
+  802599:	ff d0                	call   *%rax
+}
+  80259b:	5d                   	pop    %rbp
+  80259c:	c3                   	ret
+
+000000000080259d <devfile_write>:
+    if (!fd || !buf)
+  80259d:	48 85 ff             	test   %rdi,%rdi
+  8025a0:	0f 84 d3 01 00 00    	je     802779 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8025a6:	55                   	push   %rbp
+  8025a7:	48 89 e5             	mov    %rsp,%rbp
+  8025aa:	41 57                	push   %r15
+  8025ac:	41 56                	push   %r14
+  8025ae:	41 55                	push   %r13
+  8025b0:	41 54                	push   %r12
+  8025b2:	53                   	push   %rbx
+  8025b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8025b7:	49 89 fc             	mov    %rdi,%r12
+  8025ba:	49 89 f6             	mov    %rsi,%r14
+  8025bd:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8025c0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8025c5:	48 85 f6             	test   %rsi,%rsi
+  8025c8:	0f 84 9c 01 00 00    	je     80276a <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8025ce:	48 b8 ab 1d 80 00 00 	movabs $0x801dab,%rax
+  8025d5:	00 00 00 
+  8025d8:	ff d0                	call   *%rax
+  8025da:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8025dd:	48 85 c0             	test   %rax,%rax
+  8025e0:	0f 84 a2 00 00 00    	je     802688 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8025e6:	be 00 10 00 00       	mov    $0x1000,%esi
+  8025eb:	4c 89 e7             	mov    %r12,%rdi
+  8025ee:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8025fa:	83 f8 02             	cmp    $0x2,%eax
+  8025fd:	0f 8f 85 00 00 00    	jg     802688 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802603:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80260a:	00 00 00 
+  80260d:	4d 89 ef             	mov    %r13,%r15
+  802610:	49 29 c7             	sub    %rax,%r15
+  802613:	49 c1 ff 03          	sar    $0x3,%r15
+  802617:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80261e:	aa aa aa 
+  802621:	4c 0f af f8          	imul   %rax,%r15
+  802625:	49 c1 e7 0e          	shl    $0xe,%r15
+  802629:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80262e:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802631:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802636:	0f 84 d7 00 00 00    	je     802713 <devfile_write+0x176>
+  80263c:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802640:	89 c2                	mov    %eax,%edx
+  802642:	41 03 55 0c          	add    0xc(%r13),%edx
+  802646:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80264b:	75 0f                	jne    80265c <devfile_write+0xbf>
+  80264d:	48 01 d8             	add    %rbx,%rax
+  802650:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802656:	0f 86 92 00 00 00    	jbe    8026ee <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80265c:	4c 89 e7             	mov    %r12,%rdi
+  80265f:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802666:	00 00 00 
+  802669:	ff d0                	call   *%rax
+  80266b:	85 c0                	test   %eax,%eax
+  80266d:	78 52                	js     8026c1 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80266f:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802676:	77 7f                	ja     8026f7 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802678:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80267d:	0f 85 c2 00 00 00    	jne    802745 <devfile_write+0x1a8>
+  802683:	e9 94 00 00 00       	jmp    80271c <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802688:	4c 89 e7             	mov    %r12,%rdi
+  80268b:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802692:	00 00 00 
+  802695:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802697:	85 c0                	test   %eax,%eax
+  802699:	79 07                	jns    8026a2 <devfile_write+0x105>
+  80269b:	48 98                	cltq
+  80269d:	e9 c8 00 00 00       	jmp    80276a <devfile_write+0x1cd>
+  8026a2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026a7:	48 89 da             	mov    %rbx,%rdx
+  8026aa:	4c 89 f6             	mov    %r14,%rsi
+  8026ad:	4c 89 e7             	mov    %r12,%rdi
+  8026b0:	48 b8 fb 23 80 00 00 	movabs $0x8023fb,%rax
+  8026b7:	00 00 00 
+  8026ba:	ff d0                	call   *%rax
+  8026bc:	e9 a9 00 00 00       	jmp    80276a <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8026c1:	48 98                	cltq
+  8026c3:	e9 a2 00 00 00       	jmp    80276a <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026c8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8026cd:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8026d2:	4c 89 fe             	mov    %r15,%rsi
+  8026d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026da:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  8026e1:	00 00 00 
+  8026e4:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8026e6:	85 c0                	test   %eax,%eax
+  8026e8:	79 45                	jns    80272f <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8026ea:	48 98                	cltq
+  8026ec:	eb 7c                	jmp    80276a <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8026ee:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8026f5:	76 4e                	jbe    802745 <devfile_write+0x1a8>
+  8026f7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8026fc:	48 89 da             	mov    %rbx,%rdx
+  8026ff:	4c 89 f6             	mov    %r14,%rsi
+  802702:	4c 89 e7             	mov    %r12,%rdi
+  802705:	48 b8 fb 23 80 00 00 	movabs $0x8023fb,%rax
+  80270c:	00 00 00 
+  80270f:	ff d0                	call   *%rax
+  802711:	eb 57                	jmp    80276a <devfile_write+0x1cd>
+  802713:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80271a:	77 db                	ja     8026f7 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80271c:	4c 89 ff             	mov    %r15,%rdi
+  80271f:	48 b8 c6 3c 80 00 00 	movabs $0x803cc6,%rax
+  802726:	00 00 00 
+  802729:	ff d0                	call   *%rax
+  80272b:	84 c0                	test   %al,%al
+  80272d:	74 99                	je     8026c8 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80272f:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802734:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802739:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80273d:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802744:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802745:	4c 89 ff             	mov    %r15,%rdi
+  802748:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80274c:	48 89 da             	mov    %rbx,%rdx
+  80274f:	4c 89 f6             	mov    %r14,%rsi
+  802752:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  802759:	00 00 00 
+  80275c:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80275e:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802762:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802767:	48 89 d8             	mov    %rbx,%rax
+}
+  80276a:	48 83 c4 08          	add    $0x8,%rsp
+  80276e:	5b                   	pop    %rbx
+  80276f:	41 5c                	pop    %r12
+  802771:	41 5d                	pop    %r13
+  802773:	41 5e                	pop    %r14
+  802775:	41 5f                	pop    %r15
+  802777:	5d                   	pop    %rbp
+  802778:	c3                   	ret
+        return E_INVAL;
+  802779:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80277e:	c3                   	ret
+
+000000000080277f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80277f:	55                   	push   %rbp
+  802780:	48 89 e5             	mov    %rsp,%rbp
+  802783:	41 54                	push   %r12
+  802785:	53                   	push   %rbx
+  802786:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802789:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802790:	00 00 00 
+  802793:	ff d0                	call   *%rax
+  802795:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802798:	48 89 df             	mov    %rbx,%rdi
+  80279b:	48 b8 ab 1d 80 00 00 	movabs $0x801dab,%rax
+  8027a2:	00 00 00 
+  8027a5:	ff d0                	call   *%rax
+  8027a7:	48 85 c0             	test   %rax,%rax
+  8027aa:	74 17                	je     8027c3 <devfile_flush+0x44>
+  8027ac:	48 89 df             	mov    %rbx,%rdi
+  8027af:	48 b8 ab 1d 80 00 00 	movabs $0x801dab,%rax
+  8027b6:	00 00 00 
+  8027b9:	ff d0                	call   *%rax
+  8027bb:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8027c2:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8027c3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8027c6:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8027cd:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8027cf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027d4:	be 00 00 00 00       	mov    $0x0,%esi
+  8027d9:	bf 06 00 00 00       	mov    $0x6,%edi
+  8027de:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  8027e5:	00 00 00 
+  8027e8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8027ea:	45 85 e4             	test   %r12d,%r12d
+  8027ed:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8027f1:	5b                   	pop    %rbx
+  8027f2:	41 5c                	pop    %r12
+  8027f4:	5d                   	pop    %rbp
+  8027f5:	c3                   	ret
+
+00000000008027f6 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8027f6:	55                   	push   %rbp
+  8027f7:	48 89 e5             	mov    %rsp,%rbp
+  8027fa:	41 57                	push   %r15
+  8027fc:	41 56                	push   %r14
+  8027fe:	41 55                	push   %r13
+  802800:	41 54                	push   %r12
+  802802:	53                   	push   %rbx
+  802803:	48 83 ec 38          	sub    $0x38,%rsp
+  802807:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  80280b:	49 89 f7             	mov    %rsi,%r15
+  80280e:	48 89 d3             	mov    %rdx,%rbx
+  802811:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802814:	48 b8 41 1d 80 00 00 	movabs $0x801d41,%rax
+  80281b:	00 00 00 
+  80281e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802820:	48 85 c0             	test   %rax,%rax
+  802823:	75 20                	jne    802845 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802825:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  80282a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802831:	00 
+    while (n) {
+  802832:	48 85 db             	test   %rbx,%rbx
+  802835:	0f 85 df 00 00 00    	jne    80291a <devfile_read_direct+0x124>
+    size_t read = 0;
+  80283b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  80283f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802843:	eb 21                	jmp    802866 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802845:	45 89 f1             	mov    %r14d,%r9d
+  802848:	49 89 d8             	mov    %rbx,%r8
+  80284b:	4c 89 f9             	mov    %r15,%rcx
+  80284e:	ba 03 00 00 00       	mov    $0x3,%edx
+  802853:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802857:	48 89 c7             	mov    %rax,%rdi
+  80285a:	48 b8 28 1e 80 00 00 	movabs $0x801e28,%rax
+  802861:	00 00 00 
+  802864:	ff d0                	call   *%rax
+}
+  802866:	48 83 c4 38          	add    $0x38,%rsp
+  80286a:	5b                   	pop    %rbx
+  80286b:	41 5c                	pop    %r12
+  80286d:	41 5d                	pop    %r13
+  80286f:	41 5e                	pop    %r14
+  802871:	41 5f                	pop    %r15
+  802873:	5d                   	pop    %rbp
+  802874:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802875:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802879:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  80287f:	75 1e                	jne    80289f <devfile_read_direct+0xa9>
+  802881:	e9 e2 00 00 00       	jmp    802968 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802886:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80288a:	eb da                	jmp    802866 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  80288c:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802890:	0f 85 d0 01 00 00    	jne    802a66 <devfile_read_direct+0x270>
+            map = 0;
+  802896:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80289a:	eb 03                	jmp    80289f <devfile_read_direct+0xa9>
+  80289c:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80289f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8028a4:	48 39 d3             	cmp    %rdx,%rbx
+  8028a7:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8028ab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8028af:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028b2:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  8028b9:	00 00 00 
+  8028bc:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  8028be:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  8028c2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  8028c6:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cb:	bf 03 00 00 00       	mov    $0x3,%edi
+  8028d0:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  8028d7:	00 00 00 
+  8028da:	ff d0                	call   *%rax
+        if (res <= 0)
+  8028dc:	85 c0                	test   %eax,%eax
+  8028de:	0f 8e 63 01 00 00    	jle    802a47 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  8028e4:	4c 63 e0             	movslq %eax,%r12
+  8028e7:	4c 89 e2             	mov    %r12,%rdx
+  8028ea:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  8028f1:	00 00 00 
+  8028f4:	4c 89 ff             	mov    %r15,%rdi
+  8028f7:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  8028fe:	00 00 00 
+  802901:	ff d0                	call   *%rax
+        buf += res;
+  802903:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802906:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802909:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  80290d:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802911:	48 85 db             	test   %rbx,%rbx
+  802914:	0f 84 25 ff ff ff    	je     80283f <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80291a:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80291d:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802921:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802925:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802929:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802930:	0f 97 c2             	seta   %dl
+  802933:	20 c2                	and    %al,%dl
+  802935:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802938:	0f 84 5e ff ff ff    	je     80289c <devfile_read_direct+0xa6>
+  80293e:	4c 89 fa             	mov    %r15,%rdx
+  802941:	4d 89 fd             	mov    %r15,%r13
+  802944:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80294b:	0f 85 4e ff ff ff    	jne    80289f <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802951:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802955:	0f 84 1a ff ff ff    	je     802875 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80295b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802962:	0f 85 37 ff ff ff    	jne    80289f <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802968:	48 89 d8             	mov    %rbx,%rax
+  80296b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802971:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802976:	48 39 c8             	cmp    %rcx,%rax
+  802979:	48 0f 47 c1          	cmova  %rcx,%rax
+  80297d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802981:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802985:	49 89 d4             	mov    %rdx,%r12
+  802988:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80298c:	48 b8 67 3c 80 00 00 	movabs $0x803c67,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+  802998:	a8 40                	test   $0x40,%al
+  80299a:	0f 85 b9 00 00 00    	jne    802a59 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8029a0:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8029a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8029ab:	49 39 c5             	cmp    %rax,%r13
+  8029ae:	72 d8                	jb     802988 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8029b0:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8029b4:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029bb:	00 00 00 
+  8029be:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8029c2:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8029c5:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8029c7:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8029cb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8029cf:	48 b8 dc 1b 80 00 00 	movabs $0x801bdc,%rax
+  8029d6:	00 00 00 
+  8029d9:	ff d0                	call   *%rax
+  8029db:	89 c7                	mov    %eax,%edi
+  8029dd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8029e8:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8029ef:	00 00 00 
+  8029f2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8029f7:	48 b8 17 46 80 00 00 	movabs $0x804617,%rax
+  8029fe:	00 00 00 
+  802a01:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802a03:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a08:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802a0c:	4c 89 fe             	mov    %r15,%rsi
+  802a0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a14:	48 b8 f3 45 80 00 00 	movabs $0x8045f3,%rax
+  802a1b:	00 00 00 
+  802a1e:	ff d0                	call   *%rax
+  802a20:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802a23:	48 85 d2             	test   %rdx,%rdx
+  802a26:	0f 84 5a fe ff ff    	je     802886 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802a2c:	0f 8e 5a fe ff ff    	jle    80288c <devfile_read_direct+0x96>
+                buf += res;
+  802a32:	48 98                	cltq
+  802a34:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802a37:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802a3a:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802a3e:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802a42:	e9 ca fe ff ff       	jmp    802911 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802a47:	41 89 c5             	mov    %eax,%r13d
+  802a4a:	48 98                	cltq
+  802a4c:	45 85 ed             	test   %r13d,%r13d
+  802a4f:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802a54:	e9 0d fe ff ff       	jmp    802866 <devfile_read_direct+0x70>
+            map = 0;
+  802a59:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802a5d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802a61:	e9 39 fe ff ff       	jmp    80289f <devfile_read_direct+0xa9>
+  802a66:	48 89 d0             	mov    %rdx,%rax
+  802a69:	e9 f8 fd ff ff       	jmp    802866 <devfile_read_direct+0x70>
+
+0000000000802a6e <devfile_read>:
+    if (!fd || !buf)
+  802a6e:	48 85 ff             	test   %rdi,%rdi
+  802a71:	0f 84 21 02 00 00    	je     802c98 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802a77:	55                   	push   %rbp
+  802a78:	48 89 e5             	mov    %rsp,%rbp
+  802a7b:	41 57                	push   %r15
+  802a7d:	41 56                	push   %r14
+  802a7f:	41 55                	push   %r13
+  802a81:	41 54                	push   %r12
+  802a83:	53                   	push   %rbx
+  802a84:	48 83 ec 28          	sub    $0x28,%rsp
+  802a88:	48 89 fb             	mov    %rdi,%rbx
+  802a8b:	49 89 f4             	mov    %rsi,%r12
+  802a8e:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802a91:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a96:	48 85 f6             	test   %rsi,%rsi
+  802a99:	74 4b                	je     802ae6 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802a9b:	48 b8 ab 1d 80 00 00 	movabs $0x801dab,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+  802aa7:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802aaa:	48 85 c0             	test   %rax,%rax
+  802aad:	74 22                	je     802ad1 <devfile_read+0x63>
+  802aaf:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ab6:	77 19                	ja     802ad1 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ab8:	be 00 10 00 00       	mov    $0x1000,%esi
+  802abd:	48 89 df             	mov    %rbx,%rdi
+  802ac0:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802acc:	83 f8 02             	cmp    $0x2,%eax
+  802acf:	7e 40                	jle    802b11 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ad1:	48 89 df             	mov    %rbx,%rdi
+  802ad4:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802adb:	00 00 00 
+  802ade:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ae0:	85 c0                	test   %eax,%eax
+  802ae2:	79 11                	jns    802af5 <devfile_read+0x87>
+  802ae4:	48 98                	cltq
+}
+  802ae6:	48 83 c4 28          	add    $0x28,%rsp
+  802aea:	5b                   	pop    %rbx
+  802aeb:	41 5c                	pop    %r12
+  802aed:	41 5d                	pop    %r13
+  802aef:	41 5e                	pop    %r14
+  802af1:	41 5f                	pop    %r15
+  802af3:	5d                   	pop    %rbp
+  802af4:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802af5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802afa:	4c 89 ea             	mov    %r13,%rdx
+  802afd:	4c 89 e6             	mov    %r12,%rsi
+  802b00:	48 89 df             	mov    %rbx,%rdi
+  802b03:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  802b0a:	00 00 00 
+  802b0d:	ff d0                	call   *%rax
+  802b0f:	eb d5                	jmp    802ae6 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802b11:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802b15:	48 89 df             	mov    %rbx,%rdi
+  802b18:	48 b8 f8 24 80 00 00 	movabs $0x8024f8,%rax
+  802b1f:	00 00 00 
+  802b22:	ff d0                	call   *%rax
+  802b24:	85 c0                	test   %eax,%eax
+  802b26:	0f 88 33 01 00 00    	js     802c5f <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802b2c:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802b33:	00 00 00 
+  802b36:	4c 89 f0             	mov    %r14,%rax
+  802b39:	48 29 d0             	sub    %rdx,%rax
+  802b3c:	48 c1 f8 03          	sar    $0x3,%rax
+  802b40:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802b47:	aa aa aa 
+  802b4a:	48 0f af c2          	imul   %rdx,%rax
+  802b4e:	48 c1 e0 0e          	shl    $0xe,%rax
+  802b52:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802b56:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b59:	41 39 06             	cmp    %eax,(%r14)
+  802b5c:	75 0d                	jne    802b6b <devfile_read+0xfd>
+  802b5e:	8b 43 10             	mov    0x10(%rbx),%eax
+  802b61:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802b65:	0f 84 fb 00 00 00    	je     802c66 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802b6b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b70:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802b74:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802b77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802b7b:	48 89 c7             	mov    %rax,%rdi
+  802b7e:	48 b8 c6 3c 80 00 00 	movabs $0x803cc6,%rax
+  802b85:	00 00 00 
+  802b88:	ff d0                	call   *%rax
+  802b8a:	84 c0                	test   %al,%al
+  802b8c:	75 27                	jne    802bb5 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b8e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b93:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b98:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802b9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba1:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  802ba8:	00 00 00 
+  802bab:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802bad:	85 c0                	test   %eax,%eax
+  802baf:	0f 88 dc 00 00 00    	js     802c91 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802bb5:	44 89 f8             	mov    %r15d,%eax
+  802bb8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802bbd:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802bbf:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802bc6:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802bc7:	8b 43 10             	mov    0x10(%rbx),%eax
+  802bca:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802bce:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802bd1:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802bd6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bda:	48 89 df             	mov    %rbx,%rdi
+  802bdd:	48 b8 f6 27 80 00 00 	movabs $0x8027f6,%rax
+  802be4:	00 00 00 
+  802be7:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802be9:	48 85 c0             	test   %rax,%rax
+  802bec:	0f 88 f4 fe ff ff    	js     802ae6 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802bf2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802bf5:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802bf8:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802bfb:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802bff:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802c03:	48 63 d1             	movslq %ecx,%rdx
+  802c06:	48 01 d0             	add    %rdx,%rax
+  802c09:	4d 63 ff             	movslq %r15d,%r15
+  802c0c:	4c 29 f8             	sub    %r15,%rax
+  802c0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c14:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802c18:	48 85 c0             	test   %rax,%rax
+  802c1b:	0f 8e c5 fe ff ff    	jle    802ae6 <devfile_read+0x78>
+    n = MIN(n, res);
+  802c21:	4c 39 e8             	cmp    %r13,%rax
+  802c24:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802c28:	8b 73 04             	mov    0x4(%rbx),%esi
+  802c2b:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802c2f:	48 63 f6             	movslq %esi,%rsi
+  802c32:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c37:	48 01 c6             	add    %rax,%rsi
+  802c3a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c3e:	48 01 c6             	add    %rax,%rsi
+  802c41:	4c 89 ea             	mov    %r13,%rdx
+  802c44:	4c 89 e7             	mov    %r12,%rdi
+  802c47:	48 b8 79 0d 80 00 00 	movabs $0x800d79,%rax
+  802c4e:	00 00 00 
+  802c51:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802c53:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802c57:	4c 89 e8             	mov    %r13,%rax
+  802c5a:	e9 87 fe ff ff       	jmp    802ae6 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802c5f:	48 98                	cltq
+  802c61:	e9 80 fe ff ff       	jmp    802ae6 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c66:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802c6a:	41 39 d7             	cmp    %edx,%r15d
+  802c6d:	0f 8c f8 fe ff ff    	jl     802b6b <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802c73:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802c77:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802c7a:	41 39 cf             	cmp    %ecx,%r15d
+  802c7d:	0f 8d e8 fe ff ff    	jge    802b6b <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802c83:	4d 63 ff             	movslq %r15d,%r15
+  802c86:	4c 29 f8             	sub    %r15,%rax
+  802c89:	48 63 d2             	movslq %edx,%rdx
+  802c8c:	48 01 d0             	add    %rdx,%rax
+  802c8f:	eb 87                	jmp    802c18 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c91:	48 98                	cltq
+  802c93:	e9 4e fe ff ff       	jmp    802ae6 <devfile_read+0x78>
+        return E_INVAL;
+  802c98:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c9d:	c3                   	ret
+
+0000000000802c9e <fs_channel>:
+fs_channel(bool enable) {
+  802c9e:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802ca0:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802ca7:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802ca9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802cae:	40 84 ff             	test   %dil,%dil
+  802cb1:	74 47                	je     802cfa <fs_channel+0x5c>
+  802cb3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802cba:	00 00 00 
+  802cbd:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802cc3:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802cca:	00 00 00 
+  802ccd:	3b 08                	cmp    (%rax),%ecx
+  802ccf:	74 29                	je     802cfa <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802cd1:	55                   	push   %rbp
+  802cd2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802cd5:	48 b8 1e 1c 80 00 00 	movabs $0x801c1e,%rax
+  802cdc:	00 00 00 
+  802cdf:	ff d0                	call   *%rax
+  802ce1:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	78 04                	js     802ceb <fs_channel+0x4d>
+}
+  802ce7:	89 d0                	mov    %edx,%eax
+  802ce9:	5d                   	pop    %rbp
+  802cea:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802ceb:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802cf2:	00 00 00 
+  802cf5:	c6 00 00             	movb   $0x0,(%rax)
+  802cf8:	eb ed                	jmp    802ce7 <fs_channel+0x49>
+}
+  802cfa:	89 d0                	mov    %edx,%eax
+  802cfc:	c3                   	ret
+
+0000000000802cfd <open>:
+open(const char *path, int mode) {
+  802cfd:	55                   	push   %rbp
+  802cfe:	48 89 e5             	mov    %rsp,%rbp
+  802d01:	41 55                	push   %r13
+  802d03:	41 54                	push   %r12
+  802d05:	53                   	push   %rbx
+  802d06:	48 83 ec 18          	sub    $0x18,%rsp
+  802d0a:	49 89 fc             	mov    %rdi,%r12
+  802d0d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802d10:	48 b8 da 0a 80 00 00 	movabs $0x800ada,%rax
+  802d17:	00 00 00 
+  802d1a:	ff d0                	call   *%rax
+  802d1c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802d22:	0f 87 8f 00 00 00    	ja     802db7 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802d28:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802d2c:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  802d33:	00 00 00 
+  802d36:	ff d0                	call   *%rax
+  802d38:	89 c3                	mov    %eax,%ebx
+  802d3a:	85 c0                	test   %eax,%eax
+  802d3c:	78 55                	js     802d93 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802d3e:	4c 89 e6             	mov    %r12,%rsi
+  802d41:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802d48:	00 00 00 
+  802d4b:	48 89 df             	mov    %rbx,%rdi
+  802d4e:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  802d55:	00 00 00 
+  802d58:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802d5a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802d61:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d66:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d6a:	bf 01 00 00 00       	mov    $0x1,%edi
+  802d6f:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802d76:	00 00 00 
+  802d79:	ff d0                	call   *%rax
+  802d7b:	89 c3                	mov    %eax,%ebx
+  802d7d:	85 c0                	test   %eax,%eax
+  802d7f:	78 1f                	js     802da0 <open+0xa3>
+    return fd2num(fd);
+  802d81:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802d85:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  802d8c:	00 00 00 
+  802d8f:	ff d0                	call   *%rax
+  802d91:	89 c3                	mov    %eax,%ebx
+}
+  802d93:	89 d8                	mov    %ebx,%eax
+  802d95:	48 83 c4 18          	add    $0x18,%rsp
+  802d99:	5b                   	pop    %rbx
+  802d9a:	41 5c                	pop    %r12
+  802d9c:	41 5d                	pop    %r13
+  802d9e:	5d                   	pop    %rbp
+  802d9f:	c3                   	ret
+        fd_close(fd, 0);
+  802da0:	be 00 00 00 00       	mov    $0x0,%esi
+  802da5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802da9:	48 b8 f3 15 80 00 00 	movabs $0x8015f3,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+        return res;
+  802db5:	eb dc                	jmp    802d93 <open+0x96>
+        return -E_BAD_PATH;
+  802db7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802dbc:	eb d5                	jmp    802d93 <open+0x96>
+
+0000000000802dbe <file_flush_buffers>:
+file_flush_buffers(void) {
+  802dbe:	55                   	push   %rbp
+  802dbf:	48 89 e5             	mov    %rsp,%rbp
+  802dc2:	41 56                	push   %r14
+  802dc4:	41 55                	push   %r13
+  802dc6:	41 54                	push   %r12
+  802dc8:	53                   	push   %rbx
+  802dc9:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802dcd:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802dd4:	00 00 00 
+  802dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802ddc:	49 bd 38 15 80 00 00 	movabs $0x801538,%r13
+  802de3:	00 00 00 
+  802de6:	49 be f8 24 80 00 00 	movabs $0x8024f8,%r14
+  802ded:	00 00 00 
+  802df0:	eb 0c                	jmp    802dfe <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  802df2:	83 c3 01             	add    $0x1,%ebx
+  802df5:	49 83 c4 18          	add    $0x18,%r12
+  802df9:	83 fb 20             	cmp    $0x20,%ebx
+  802dfc:	74 1d                	je     802e1b <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802dfe:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  802e03:	74 ed                	je     802df2 <file_flush_buffers+0x34>
+  802e05:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802e09:	89 df                	mov    %ebx,%edi
+  802e0b:	41 ff d5             	call   *%r13
+  802e0e:	85 c0                	test   %eax,%eax
+  802e10:	78 e0                	js     802df2 <file_flush_buffers+0x34>
+  802e12:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802e16:	41 ff d6             	call   *%r14
+  802e19:	eb d7                	jmp    802df2 <file_flush_buffers+0x34>
+}
+  802e1b:	48 83 c4 10          	add    $0x10,%rsp
+  802e1f:	5b                   	pop    %rbx
+  802e20:	41 5c                	pop    %r12
+  802e22:	41 5d                	pop    %r13
+  802e24:	41 5e                	pop    %r14
+  802e26:	5d                   	pop    %rbp
+  802e27:	c3                   	ret
+
+0000000000802e28 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  802e28:	55                   	push   %rbp
+  802e29:	48 89 e5             	mov    %rsp,%rbp
+  802e2c:	41 54                	push   %r12
+  802e2e:	53                   	push   %rbx
+  802e2f:	49 89 fc             	mov    %rdi,%r12
+  802e32:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  802e34:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  802e3b:	00 00 00 
+  802e3e:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802e40:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802e47:	00 00 00 
+  802e4a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802e4f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802e51:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802e54:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e59:	be 00 00 00 00       	mov    $0x0,%esi
+  802e5e:	bf 02 00 00 00       	mov    $0x2,%edi
+  802e63:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802e6a:	00 00 00 
+  802e6d:	ff d0                	call   *%rax
+}
+  802e6f:	5b                   	pop    %rbx
+  802e70:	41 5c                	pop    %r12
+  802e72:	5d                   	pop    %rbp
+  802e73:	c3                   	ret
+
+0000000000802e74 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802e74:	55                   	push   %rbp
+  802e75:	48 89 e5             	mov    %rsp,%rbp
+  802e78:	41 54                	push   %r12
+  802e7a:	53                   	push   %rbx
+  802e7b:	49 89 fc             	mov    %rdi,%r12
+  802e7e:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802e81:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802e8d:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802e92:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802e99:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802e9b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ea0:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea5:	bf 05 00 00 00       	mov    $0x5,%edi
+  802eaa:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802eb1:	00 00 00 
+  802eb4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802eb6:	85 c0                	test   %eax,%eax
+  802eb8:	78 3d                	js     802ef7 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802eba:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802ec1:	00 00 00 
+  802ec4:	4c 89 e6             	mov    %r12,%rsi
+  802ec7:	48 89 df             	mov    %rbx,%rdi
+  802eca:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  802ed1:	00 00 00 
+  802ed4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802ed6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  802edd:	00 
+  802ede:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  802ee4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  802eeb:	00 
+  802eec:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  802ef2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802ef7:	5b                   	pop    %rbx
+  802ef8:	41 5c                	pop    %r12
+  802efa:	5d                   	pop    %rbp
+  802efb:	c3                   	ret
+
+0000000000802efc <remove>:
+remove(const char *path) {
+  802efc:	55                   	push   %rbp
+  802efd:	48 89 e5             	mov    %rsp,%rbp
+  802f00:	53                   	push   %rbx
+  802f01:	48 83 ec 08          	sub    $0x8,%rsp
+  802f05:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f08:	48 b8 da 0a 80 00 00 	movabs $0x800ada,%rax
+  802f0f:	00 00 00 
+  802f12:	ff d0                	call   *%rax
+  802f14:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f1a:	77 3a                	ja     802f56 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802f1c:	48 89 de             	mov    %rbx,%rsi
+  802f1f:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802f26:	00 00 00 
+  802f29:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  802f30:	00 00 00 
+  802f33:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  802f35:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f3a:	be 00 00 00 00       	mov    $0x0,%esi
+  802f3f:	bf 07 00 00 00       	mov    $0x7,%edi
+  802f44:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+}
+  802f50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802f54:	c9                   	leave
+  802f55:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802f56:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802f5b:	eb f3                	jmp    802f50 <remove+0x54>
+
+0000000000802f5d <sync>:
+sync(void) {
+  802f5d:	55                   	push   %rbp
+  802f5e:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802f61:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  802f68:	00 00 00 
+  802f6b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802f6d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f72:	be 00 00 00 00       	mov    $0x0,%esi
+  802f77:	bf 08 00 00 00       	mov    $0x8,%edi
+  802f7c:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802f83:	00 00 00 
+  802f86:	ff d0                	call   *%rax
+}
+  802f88:	5d                   	pop    %rbp
+  802f89:	c3                   	ret
+
+0000000000802f8a <fsync>:
+fsync(int fdnum) {
+  802f8a:	55                   	push   %rbp
+  802f8b:	48 89 e5             	mov    %rsp,%rbp
+  802f8e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802f92:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802f96:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  802f9d:	00 00 00 
+  802fa0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802fa2:	85 c0                	test   %eax,%eax
+  802fa4:	78 4b                	js     802ff1 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802fa6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802faa:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802fb1:	00 00 00 
+  802fb4:	8b 00                	mov    (%rax),%eax
+  802fb6:	39 02                	cmp    %eax,(%rdx)
+  802fb8:	75 39                	jne    802ff3 <fsync+0x69>
+    file_flush_buffers();
+  802fba:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  802fc1:	00 00 00 
+  802fc4:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802fc6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802fca:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fcd:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802fd4:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802fd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802fe0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  802fe5:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  802fec:	00 00 00 
+  802fef:	ff d0                	call   *%rax
+}
+  802ff1:	c9                   	leave
+  802ff2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802ff3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802ff8:	eb f7                	jmp    802ff1 <fsync+0x67>
+
+0000000000802ffa <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  802ffa:	55                   	push   %rbp
+  802ffb:	48 89 e5             	mov    %rsp,%rbp
+  802ffe:	53                   	push   %rbx
+  802fff:	48 83 ec 08          	sub    $0x8,%rsp
+  803003:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803006:	ba 00 00 00 00       	mov    $0x0,%edx
+  80300b:	be 00 00 00 00       	mov    $0x0,%esi
+  803010:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803015:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  80301c:	00 00 00 
+  80301f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803021:	85 c0                	test   %eax,%eax
+  803023:	78 2d                	js     803052 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803025:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80302c:	00 00 00 
+  80302f:	48 8b 10             	mov    (%rax),%rdx
+  803032:	48 89 13             	mov    %rdx,(%rbx)
+  803035:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803039:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80303d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803041:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803045:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803049:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80304d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803052:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803056:	c9                   	leave
+  803057:	c3                   	ret
+
+0000000000803058 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803058:	55                   	push   %rbp
+  803059:	48 89 e5             	mov    %rsp,%rbp
+  80305c:	53                   	push   %rbx
+  80305d:	48 83 ec 08          	sub    $0x8,%rsp
+  803061:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803064:	ba 00 00 00 00       	mov    $0x0,%edx
+  803069:	be 00 00 00 00       	mov    $0x0,%esi
+  80306e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803073:	48 b8 8f 22 80 00 00 	movabs $0x80228f,%rax
+  80307a:	00 00 00 
+  80307d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80307f:	85 c0                	test   %eax,%eax
+  803081:	78 3d                	js     8030c0 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803083:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80308a:	00 00 00 
+  80308d:	48 8b 10             	mov    (%rax),%rdx
+  803090:	48 89 13             	mov    %rdx,(%rbx)
+  803093:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803097:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80309b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80309f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8030a3:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8030a7:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8030ab:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8030af:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8030b3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8030b7:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8030bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030c4:	c9                   	leave
+  8030c5:	c3                   	ret
+
+00000000008030c6 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8030c6:	55                   	push   %rbp
+  8030c7:	48 89 e5             	mov    %rsp,%rbp
+  8030ca:	41 57                	push   %r15
+  8030cc:	41 56                	push   %r14
+  8030ce:	41 55                	push   %r13
+  8030d0:	41 54                	push   %r12
+  8030d2:	53                   	push   %rbx
+  8030d3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8030d7:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8030de:	00 
+  8030df:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8030e6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8030ec:	0f 85 43 01 00 00    	jne    803235 <munmap+0x16f>
+  8030f2:	49 89 ff             	mov    %rdi,%r15
+  8030f5:	4c 39 f7             	cmp    %r14,%rdi
+  8030f8:	0f 87 37 01 00 00    	ja     803235 <munmap+0x16f>
+  8030fe:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803105:	00 00 00 
+  803108:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80310e:	eb 2c                	jmp    80313c <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803110:	4c 39 f8             	cmp    %r15,%rax
+  803113:	0f 83 85 00 00 00    	jae    80319e <munmap+0xd8>
+            m->mm_end = start;
+  803119:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80311e:	48 83 c3 18          	add    $0x18,%rbx
+  803122:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803129:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803130:	00 00 00 
+  803133:	48 39 c3             	cmp    %rax,%rbx
+  803136:	0f 84 d0 00 00 00    	je     80320c <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80313c:	49 89 dc             	mov    %rbx,%r12
+  80313f:	48 8b 03             	mov    (%rbx),%rax
+  803142:	4c 39 f0             	cmp    %r14,%rax
+  803145:	73 d7                	jae    80311e <munmap+0x58>
+  803147:	48 85 c0             	test   %rax,%rax
+  80314a:	74 d2                	je     80311e <munmap+0x58>
+  80314c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803150:	49 39 d7             	cmp    %rdx,%r15
+  803153:	73 c9                	jae    80311e <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803155:	49 39 d6             	cmp    %rdx,%r14
+  803158:	73 b6                	jae    803110 <munmap+0x4a>
+  80315a:	49 39 c7             	cmp    %rax,%r15
+  80315d:	76 b1                	jbe    803110 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80315f:	4c 89 ef             	mov    %r13,%rdi
+  803162:	48 b8 fd 21 80 00 00 	movabs $0x8021fd,%rax
+  803169:	00 00 00 
+  80316c:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80316e:	48 85 c0             	test   %rax,%rax
+  803171:	0f 84 c5 00 00 00    	je     80323c <munmap+0x176>
+            *tail = *m;
+  803177:	48 8b 13             	mov    (%rbx),%rdx
+  80317a:	48 89 10             	mov    %rdx,(%rax)
+  80317d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803181:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803185:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803189:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80318d:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803190:	44 89 f2             	mov    %r14d,%edx
+  803193:	2b 13                	sub    (%rbx),%edx
+  803195:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803198:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80319c:	eb 80                	jmp    80311e <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80319e:	49 39 d6             	cmp    %rdx,%r14
+  8031a1:	73 18                	jae    8031bb <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8031a3:	44 89 f2             	mov    %r14d,%edx
+  8031a6:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8031ab:	29 c2                	sub    %eax,%edx
+  8031ad:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8031b2:	4d 89 34 24          	mov    %r14,(%r12)
+  8031b6:	e9 63 ff ff ff       	jmp    80311e <munmap+0x58>
+    m->mm_start = 0;
+  8031bb:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8031c2:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8031c3:	4c 89 e6             	mov    %r12,%rsi
+  8031c6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8031cd:	00 00 00 
+  8031d0:	48 29 c6             	sub    %rax,%rsi
+  8031d3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8031d7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8031de:	aa aa aa 
+  8031e1:	48 0f af f0          	imul   %rax,%rsi
+  8031e5:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8031e9:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8031ee:	48 01 c6             	add    %rax,%rsi
+  8031f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8031f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8031fb:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  803202:	00 00 00 
+  803205:	ff d0                	call   *%rax
+}
+  803207:	e9 12 ff ff ff       	jmp    80311e <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80320c:	4c 89 f2             	mov    %r14,%rdx
+  80320f:	4c 29 fa             	sub    %r15,%rdx
+  803212:	4c 89 fe             	mov    %r15,%rsi
+  803215:	bf 00 00 00 00       	mov    $0x0,%edi
+  80321a:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  803221:	00 00 00 
+  803224:	ff d0                	call   *%rax
+}
+  803226:	48 83 c4 08          	add    $0x8,%rsp
+  80322a:	5b                   	pop    %rbx
+  80322b:	41 5c                	pop    %r12
+  80322d:	41 5d                	pop    %r13
+  80322f:	41 5e                	pop    %r14
+  803231:	41 5f                	pop    %r15
+  803233:	5d                   	pop    %rbp
+  803234:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803235:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80323a:	eb ea                	jmp    803226 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80323c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803241:	eb e3                	jmp    803226 <munmap+0x160>
+
+0000000000803243 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803243:	55                   	push   %rbp
+  803244:	48 89 e5             	mov    %rsp,%rbp
+  803247:	41 57                	push   %r15
+  803249:	41 56                	push   %r14
+  80324b:	41 55                	push   %r13
+  80324d:	41 54                	push   %r12
+  80324f:	53                   	push   %rbx
+  803250:	48 83 ec 28          	sub    $0x28,%rsp
+  803254:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803258:	49 89 f5             	mov    %rsi,%r13
+  80325b:	41 89 d6             	mov    %edx,%r14d
+  80325e:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803261:	41 89 cc             	mov    %ecx,%r12d
+  803264:	44 89 c7             	mov    %r8d,%edi
+  803267:	44 89 cb             	mov    %r9d,%ebx
+  80326a:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80326e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803272:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  803279:	00 00 00 
+  80327c:	ff d0                	call   *%rax
+  80327e:	41 89 c7             	mov    %eax,%r15d
+  803281:	85 c0                	test   %eax,%eax
+  803283:	0f 88 ae 01 00 00    	js     803437 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803289:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80328d:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  803294:	00 00 00 
+  803297:	8b 32                	mov    (%rdx),%esi
+  803299:	39 30                	cmp    %esi,(%rax)
+  80329b:	0f 85 7a 02 00 00    	jne    80351b <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8032a1:	8b 40 08             	mov    0x8(%rax),%eax
+  8032a4:	83 e0 03             	and    $0x3,%eax
+  8032a7:	83 f8 01             	cmp    $0x1,%eax
+  8032aa:	0f 84 76 02 00 00    	je     803526 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8032b0:	4d 85 ed             	test   %r13,%r13
+  8032b3:	0f 84 78 02 00 00    	je     803531 <mmap+0x2ee>
+  8032b9:	85 db                	test   %ebx,%ebx
+  8032bb:	0f 88 70 02 00 00    	js     803531 <mmap+0x2ee>
+  8032c1:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8032c7:	41 89 df             	mov    %ebx,%r15d
+  8032ca:	0f 85 6c 02 00 00    	jne    80353c <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8032d0:	44 89 f0             	mov    %r14d,%eax
+  8032d3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8032d6:	83 f8 04             	cmp    $0x4,%eax
+  8032d9:	0f 85 68 02 00 00    	jne    803547 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8032df:	44 89 e1             	mov    %r12d,%ecx
+  8032e2:	83 e1 01             	and    $0x1,%ecx
+  8032e5:	0f 95 c2             	setne  %dl
+  8032e8:	44 89 e0             	mov    %r12d,%eax
+  8032eb:	d1 e8                	shr    %eax
+  8032ed:	83 f0 01             	xor    $0x1,%eax
+  8032f0:	83 e0 01             	and    $0x1,%eax
+  8032f3:	38 c2                	cmp    %al,%dl
+  8032f5:	0f 85 57 02 00 00    	jne    803552 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8032fb:	85 c9                	test   %ecx,%ecx
+  8032fd:	74 0a                	je     803309 <mmap+0xc6>
+  8032ff:	41 f6 c6 02          	test   $0x2,%r14b
+  803303:	0f 85 54 02 00 00    	jne    80355d <mmap+0x31a>
+    file_flush_buffers();
+  803309:	48 b8 be 2d 80 00 00 	movabs $0x802dbe,%rax
+  803310:	00 00 00 
+  803313:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803315:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80331c:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803323:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803327:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80332a:	41 f6 c4 04          	test   $0x4,%r12b
+  80332e:	0f 84 15 01 00 00    	je     803449 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803334:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803337:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80333d:	0f 85 25 02 00 00    	jne    803568 <mmap+0x325>
+  803343:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803347:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80334e:	00 00 00 
+  803351:	48 39 c2             	cmp    %rax,%rdx
+  803354:	0f 82 19 02 00 00    	jb     803573 <mmap+0x330>
+  80335a:	48 39 c7             	cmp    %rax,%rdi
+  80335d:	0f 87 10 02 00 00    	ja     803573 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803363:	4c 89 ee             	mov    %r13,%rsi
+  803366:	48 b8 c6 30 80 00 00 	movabs $0x8030c6,%rax
+  80336d:	00 00 00 
+  803370:	ff d0                	call   *%rax
+  803372:	85 c0                	test   %eax,%eax
+  803374:	0f 88 04 02 00 00    	js     80357e <mmap+0x33b>
+    if (!handler) {
+  80337a:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803381:	00 00 00 
+  803384:	80 38 00             	cmpb   $0x0,(%rax)
+  803387:	75 2b                	jne    8033b4 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803389:	48 bf 5e 21 80 00 00 	movabs $0x80215e,%rdi
+  803390:	00 00 00 
+  803393:	48 b8 c2 42 80 00 00 	movabs $0x8042c2,%rax
+  80339a:	00 00 00 
+  80339d:	ff d0                	call   *%rax
+  80339f:	85 c0                	test   %eax,%eax
+  8033a1:	0f 88 ea 01 00 00    	js     803591 <mmap+0x34e>
+        handler = 1;
+  8033a7:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8033ae:	00 00 00 
+  8033b1:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8033b4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8033b8:	48 b8 fd 21 80 00 00 	movabs $0x8021fd,%rax
+  8033bf:	00 00 00 
+  8033c2:	ff d0                	call   *%rax
+  8033c4:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8033c7:	48 85 c0             	test   %rax,%rax
+  8033ca:	0f 84 c9 01 00 00    	je     803599 <mmap+0x356>
+    m->mm_start = va;
+  8033d0:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8033d3:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8033d7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8033db:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8033de:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8033e2:	44 89 e0             	mov    %r12d,%eax
+  8033e5:	c1 e0 06             	shl    $0x6,%eax
+  8033e8:	25 80 00 00 00       	and    $0x80,%eax
+  8033ed:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8033f0:	09 f0                	or     %esi,%eax
+  8033f2:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8033f6:	41 f6 c4 08          	test   $0x8,%r12b
+  8033fa:	74 31                	je     80342d <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8033fc:	48 39 d3             	cmp    %rdx,%rbx
+  8033ff:	73 2c                	jae    80342d <mmap+0x1ea>
+  803401:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803406:	48 89 de             	mov    %rbx,%rsi
+  803409:	4c 89 f7             	mov    %r14,%rdi
+  80340c:	48 b8 4d 20 80 00 00 	movabs $0x80204d,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+  803418:	49 89 c4             	mov    %rax,%r12
+  80341b:	48 85 c0             	test   %rax,%rax
+  80341e:	0f 8e d7 00 00 00    	jle    8034fb <mmap+0x2b8>
+            va += n;
+  803424:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803427:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80342b:	72 d4                	jb     803401 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80342d:	49 8b 06             	mov    (%r14),%rax
+  803430:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803434:	48 89 06             	mov    %rax,(%rsi)
+}
+  803437:	44 89 f8             	mov    %r15d,%eax
+  80343a:	48 83 c4 28          	add    $0x28,%rsp
+  80343e:	5b                   	pop    %rbx
+  80343f:	41 5c                	pop    %r12
+  803441:	41 5d                	pop    %r13
+  803443:	41 5e                	pop    %r14
+  803445:	41 5f                	pop    %r15
+  803447:	5d                   	pop    %rbp
+  803448:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803449:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803450:	00 00 00 
+  803453:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803456:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80345d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803460:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803465:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80346c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80346f:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803476:	00 00 00 
+  803479:	48 39 d7             	cmp    %rdx,%rdi
+  80347c:	73 1c                	jae    80349a <mmap+0x257>
+        return -E_NO_MEM;
+  80347e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803484:	eb b1                	jmp    803437 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803486:	48 83 c0 01          	add    $0x1,%rax
+  80348a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80348e:	77 3f                	ja     8034cf <mmap+0x28c>
+  803490:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803495:	48 39 d7             	cmp    %rdx,%rdi
+  803498:	72 2a                	jb     8034c4 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80349a:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80349e:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8034a2:	48 39 d1             	cmp    %rdx,%rcx
+  8034a5:	73 df                	jae    803486 <mmap+0x243>
+  8034a7:	48 85 c9             	test   %rcx,%rcx
+  8034aa:	74 da                	je     803486 <mmap+0x243>
+  8034ac:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8034b0:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8034b5:	48 39 d3             	cmp    %rdx,%rbx
+  8034b8:	73 cc                	jae    803486 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8034ba:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8034bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8034c2:	eb cc                	jmp    803490 <mmap+0x24d>
+        return -E_NO_MEM;
+  8034c4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034ca:	e9 68 ff ff ff       	jmp    803437 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8034cf:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8034d4:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8034db:	00 00 00 
+  8034de:	48 39 c2             	cmp    %rax,%rdx
+  8034e1:	0f 82 9f 00 00 00    	jb     803586 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8034e7:	48 85 db             	test   %rbx,%rbx
+  8034ea:	0f 85 8a fe ff ff    	jne    80337a <mmap+0x137>
+        return -E_NO_MEM;
+  8034f0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8034f6:	e9 3c ff ff ff       	jmp    803437 <mmap+0x1f4>
+        if (n < 0) {
+  8034fb:	0f 89 2c ff ff ff    	jns    80342d <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803501:	49 8b 3e             	mov    (%r14),%rdi
+  803504:	4c 89 ee             	mov    %r13,%rsi
+  803507:	48 b8 c6 30 80 00 00 	movabs $0x8030c6,%rax
+  80350e:	00 00 00 
+  803511:	ff d0                	call   *%rax
+            return n;
+  803513:	45 89 e7             	mov    %r12d,%r15d
+  803516:	e9 1c ff ff ff       	jmp    803437 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80351b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803521:	e9 11 ff ff ff       	jmp    803437 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803526:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80352c:	e9 06 ff ff ff       	jmp    803437 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803531:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803537:	e9 fb fe ff ff       	jmp    803437 <mmap+0x1f4>
+  80353c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803542:	e9 f0 fe ff ff       	jmp    803437 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803547:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80354d:	e9 e5 fe ff ff       	jmp    803437 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803552:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803558:	e9 da fe ff ff       	jmp    803437 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80355d:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803563:	e9 cf fe ff ff       	jmp    803437 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803568:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80356e:	e9 c4 fe ff ff       	jmp    803437 <mmap+0x1f4>
+  803573:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803579:	e9 b9 fe ff ff       	jmp    803437 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80357e:	41 89 c7             	mov    %eax,%r15d
+  803581:	e9 b1 fe ff ff       	jmp    803437 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803586:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80358c:	e9 a6 fe ff ff       	jmp    803437 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803591:	41 89 c7             	mov    %eax,%r15d
+  803594:	e9 9e fe ff ff       	jmp    803437 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803599:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80359f:	e9 93 fe ff ff       	jmp    803437 <mmap+0x1f4>
+
+00000000008035a4 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8035a4:	55                   	push   %rbp
+  8035a5:	48 89 e5             	mov    %rsp,%rbp
+  8035a8:	41 54                	push   %r12
+  8035aa:	53                   	push   %rbx
+  8035ab:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8035ae:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  8035b5:	00 00 00 
+  8035b8:	ff d0                	call   *%rax
+  8035ba:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8035bd:	48 be 40 4d 80 00 00 	movabs $0x804d40,%rsi
+  8035c4:	00 00 00 
+  8035c7:	48 89 df             	mov    %rbx,%rdi
+  8035ca:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8035d6:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8035db:	41 2b 04 24          	sub    (%r12),%eax
+  8035df:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8035e5:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8035ec:	00 00 00 
+    stat->st_dev = &devpipe;
+  8035ef:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8035f6:	00 00 00 
+  8035f9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803600:	b8 00 00 00 00       	mov    $0x0,%eax
+  803605:	5b                   	pop    %rbx
+  803606:	41 5c                	pop    %r12
+  803608:	5d                   	pop    %rbp
+  803609:	c3                   	ret
+
+000000000080360a <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80360a:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80360d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803613:	8b 17                	mov    (%rdi),%edx
+  803615:	85 d2                	test   %edx,%edx
+  803617:	75 01                	jne    80361a <pipe_wakeup+0x10>
+  803619:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80361a:	55                   	push   %rbp
+  80361b:	48 89 e5             	mov    %rsp,%rbp
+  80361e:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803621:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803627:	be 00 04 00 00       	mov    $0x400,%esi
+  80362c:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803633:	00 00 00 
+  803636:	ff d0                	call   *%rax
+}
+  803638:	5d                   	pop    %rbp
+  803639:	c3                   	ret
+
+000000000080363a <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80363a:	55                   	push   %rbp
+  80363b:	48 89 e5             	mov    %rsp,%rbp
+  80363e:	41 55                	push   %r13
+  803640:	41 54                	push   %r12
+  803642:	53                   	push   %rbx
+  803643:	48 83 ec 08          	sub    $0x8,%rsp
+  803647:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80364a:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  803651:	00 00 00 
+  803654:	ff d0                	call   *%rax
+  803656:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803659:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80365e:	4c 89 e6             	mov    %r12,%rsi
+  803661:	bf 00 00 00 00       	mov    $0x0,%edi
+  803666:	49 bc 1d 11 80 00 00 	movabs $0x80111d,%r12
+  80366d:	00 00 00 
+  803670:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803673:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803677:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80367b:	49 bd 0a 36 80 00 00 	movabs $0x80360a,%r13
+  803682:	00 00 00 
+  803685:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803688:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80368c:	48 89 de             	mov    %rbx,%rsi
+  80368f:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803692:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803697:	48 89 de             	mov    %rbx,%rsi
+  80369a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80369f:	41 ff d4             	call   *%r12
+  8036a2:	48 83 c4 08          	add    $0x8,%rsp
+  8036a6:	5b                   	pop    %rbx
+  8036a7:	41 5c                	pop    %r12
+  8036a9:	41 5d                	pop    %r13
+  8036ab:	5d                   	pop    %rbp
+  8036ac:	c3                   	ret
+
+00000000008036ad <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8036ad:	55                   	push   %rbp
+  8036ae:	48 89 e5             	mov    %rsp,%rbp
+  8036b1:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8036b4:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8036b9:	be 00 10 00 00       	mov    $0x1000,%esi
+  8036be:	48 b8 60 10 80 00 00 	movabs $0x801060,%rax
+  8036c5:	00 00 00 
+  8036c8:	ff d0                	call   *%rax
+  8036ca:	85 c0                	test   %eax,%eax
+  8036cc:	0f 94 c0             	sete   %al
+  8036cf:	0f b6 c0             	movzbl %al,%eax
+}
+  8036d2:	5d                   	pop    %rbp
+  8036d3:	c3                   	ret
+
+00000000008036d4 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8036d4:	55                   	push   %rbp
+  8036d5:	48 89 e5             	mov    %rsp,%rbp
+  8036d8:	41 57                	push   %r15
+  8036da:	41 56                	push   %r14
+  8036dc:	41 55                	push   %r13
+  8036de:	41 54                	push   %r12
+  8036e0:	53                   	push   %rbx
+  8036e1:	48 83 ec 38          	sub    $0x38,%rsp
+  8036e5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8036e9:	49 89 f4             	mov    %rsi,%r12
+  8036ec:	49 89 d7             	mov    %rdx,%r15
+  8036ef:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8036f3:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  8036fa:	00 00 00 
+  8036fd:	ff d0                	call   *%rax
+  8036ff:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803702:	4d 85 ff             	test   %r15,%r15
+  803705:	0f 84 f1 00 00 00    	je     8037fc <devpipe_write+0x128>
+  80370b:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  80370f:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803713:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803717:	49 bd ad 36 80 00 00 	movabs $0x8036ad,%r13
+  80371e:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803721:	49 bf 0a 36 80 00 00 	movabs $0x80360a,%r15
+  803728:	00 00 00 
+  80372b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80372f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803733:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803737:	8b 73 04             	mov    0x4(%rbx),%esi
+  80373a:	48 63 ce             	movslq %esi,%rcx
+  80373d:	48 63 03             	movslq (%rbx),%rax
+  803740:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803746:	48 39 c1             	cmp    %rax,%rcx
+  803749:	72 64                	jb     8037af <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80374b:	48 89 de             	mov    %rbx,%rsi
+  80374e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803752:	41 ff d5             	call   *%r13
+  803755:	85 c0                	test   %eax,%eax
+  803757:	0f 85 b9 00 00 00    	jne    803816 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80375d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803761:	4c 89 f7             	mov    %r14,%rdi
+  803764:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803767:	8b 43 04             	mov    0x4(%rbx),%eax
+  80376a:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803771:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803778:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80377e:	8b 03                	mov    (%rbx),%eax
+  803780:	41 39 c4             	cmp    %eax,%r12d
+  803783:	75 b2                	jne    803737 <devpipe_write+0x63>
+  803785:	48 89 de             	mov    %rbx,%rsi
+  803788:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80378c:	41 ff d5             	call   *%r13
+  80378f:	85 c0                	test   %eax,%eax
+  803791:	75 a0                	jne    803733 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803793:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803798:	44 89 e6             	mov    %r12d,%esi
+  80379b:	48 89 df             	mov    %rbx,%rdi
+  80379e:	48 b8 e5 13 80 00 00 	movabs $0x8013e5,%rax
+  8037a5:	00 00 00 
+  8037a8:	ff d0                	call   *%rax
+  8037aa:	e9 7c ff ff ff       	jmp    80372b <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8037af:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8037b3:	41 0f b6 38          	movzbl (%r8),%edi
+  8037b7:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8037be:	80 80 80 
+  8037c1:	48 89 c8             	mov    %rcx,%rax
+  8037c4:	48 f7 e2             	mul    %rdx
+  8037c7:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8037cb:	48 89 d0             	mov    %rdx,%rax
+  8037ce:	48 c1 e0 08          	shl    $0x8,%rax
+  8037d2:	48 29 d0             	sub    %rdx,%rax
+  8037d5:	48 c1 e0 04          	shl    $0x4,%rax
+  8037d9:	48 29 c1             	sub    %rax,%rcx
+  8037dc:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8037e1:	83 c6 01             	add    $0x1,%esi
+  8037e4:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8037e7:	49 83 c0 01          	add    $0x1,%r8
+  8037eb:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8037ef:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8037f3:	49 39 c0             	cmp    %rax,%r8
+  8037f6:	0f 85 2f ff ff ff    	jne    80372b <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8037fc:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803800:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803804:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  80380b:	00 00 00 
+  80380e:	ff d0                	call   *%rax
+    return n;
+  803810:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803814:	eb 05                	jmp    80381b <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803816:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80381b:	48 83 c4 38          	add    $0x38,%rsp
+  80381f:	5b                   	pop    %rbx
+  803820:	41 5c                	pop    %r12
+  803822:	41 5d                	pop    %r13
+  803824:	41 5e                	pop    %r14
+  803826:	41 5f                	pop    %r15
+  803828:	5d                   	pop    %rbp
+  803829:	c3                   	ret
+
+000000000080382a <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80382a:	55                   	push   %rbp
+  80382b:	48 89 e5             	mov    %rsp,%rbp
+  80382e:	41 57                	push   %r15
+  803830:	41 56                	push   %r14
+  803832:	41 55                	push   %r13
+  803834:	41 54                	push   %r12
+  803836:	53                   	push   %rbx
+  803837:	48 83 ec 28          	sub    $0x28,%rsp
+  80383b:	49 89 fd             	mov    %rdi,%r13
+  80383e:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803842:	49 89 d4             	mov    %rdx,%r12
+  803845:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803849:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  803850:	00 00 00 
+  803853:	ff d0                	call   *%rax
+  803855:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803858:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  80385e:	49 bf ad 36 80 00 00 	movabs $0x8036ad,%r15
+  803865:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803868:	4d 85 e4             	test   %r12,%r12
+  80386b:	0f 84 d5 00 00 00    	je     803946 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803871:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803875:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803879:	8b 03                	mov    (%rbx),%eax
+  80387b:	3b 43 04             	cmp    0x4(%rbx),%eax
+  80387e:	75 7a                	jne    8038fa <devpipe_read+0xd0>
+            if (i > 0) {
+  803880:	4d 85 f6             	test   %r14,%r14
+  803883:	75 50                	jne    8038d5 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803885:	48 89 de             	mov    %rbx,%rsi
+  803888:	4c 89 ef             	mov    %r13,%rdi
+  80388b:	41 ff d7             	call   *%r15
+  80388e:	85 c0                	test   %eax,%eax
+  803890:	0f 85 c9 00 00 00    	jne    80395f <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803896:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803899:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8038a0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8038a6:	8b 43 04             	mov    0x4(%rbx),%eax
+  8038a9:	41 39 c4             	cmp    %eax,%r12d
+  8038ac:	75 cb                	jne    803879 <devpipe_read+0x4f>
+  8038ae:	48 89 de             	mov    %rbx,%rsi
+  8038b1:	4c 89 ef             	mov    %r13,%rdi
+  8038b4:	41 ff d7             	call   *%r15
+  8038b7:	85 c0                	test   %eax,%eax
+  8038b9:	75 be                	jne    803879 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8038bb:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8038c0:	44 89 e6             	mov    %r12d,%esi
+  8038c3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8038c7:	48 b8 e5 13 80 00 00 	movabs $0x8013e5,%rax
+  8038ce:	00 00 00 
+  8038d1:	ff d0                	call   *%rax
+  8038d3:	eb a4                	jmp    803879 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038d5:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038d9:	48 89 de             	mov    %rbx,%rsi
+  8038dc:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  8038e3:	00 00 00 
+  8038e6:	ff d0                	call   *%rax
+                return i;
+  8038e8:	4c 89 f0             	mov    %r14,%rax
+}
+  8038eb:	48 83 c4 28          	add    $0x28,%rsp
+  8038ef:	5b                   	pop    %rbx
+  8038f0:	41 5c                	pop    %r12
+  8038f2:	41 5d                	pop    %r13
+  8038f4:	41 5e                	pop    %r14
+  8038f6:	41 5f                	pop    %r15
+  8038f8:	5d                   	pop    %rbp
+  8038f9:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8038fa:	48 63 c8             	movslq %eax,%rcx
+  8038fd:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803904:	80 80 80 
+  803907:	48 89 c8             	mov    %rcx,%rax
+  80390a:	48 f7 e2             	mul    %rdx
+  80390d:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803911:	48 89 d0             	mov    %rdx,%rax
+  803914:	48 c1 e0 08          	shl    $0x8,%rax
+  803918:	48 29 d0             	sub    %rdx,%rax
+  80391b:	48 c1 e0 04          	shl    $0x4,%rax
+  80391f:	48 89 c2             	mov    %rax,%rdx
+  803922:	48 89 c8             	mov    %rcx,%rax
+  803925:	48 29 d0             	sub    %rdx,%rax
+  803928:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80392d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803931:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803935:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803938:	49 83 c6 01          	add    $0x1,%r14
+  80393c:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803940:	0f 85 2b ff ff ff    	jne    803871 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803946:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80394a:	48 89 de             	mov    %rbx,%rsi
+  80394d:	48 b8 0a 36 80 00 00 	movabs $0x80360a,%rax
+  803954:	00 00 00 
+  803957:	ff d0                	call   *%rax
+    return n;
+  803959:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80395d:	eb 8c                	jmp    8038eb <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  80395f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803964:	eb 85                	jmp    8038eb <devpipe_read+0xc1>
+
+0000000000803966 <pipe>:
+pipe(int pfd[2]) {
+  803966:	55                   	push   %rbp
+  803967:	48 89 e5             	mov    %rsp,%rbp
+  80396a:	41 55                	push   %r13
+  80396c:	41 54                	push   %r12
+  80396e:	53                   	push   %rbx
+  80396f:	48 83 ec 18          	sub    $0x18,%rsp
+  803973:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803976:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80397a:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  803981:	00 00 00 
+  803984:	ff d0                	call   *%rax
+  803986:	89 c3                	mov    %eax,%ebx
+  803988:	85 c0                	test   %eax,%eax
+  80398a:	0f 88 a0 01 00 00    	js     803b30 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803990:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803995:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80399a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80399e:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039a3:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  8039aa:	00 00 00 
+  8039ad:	ff d0                	call   *%rax
+  8039af:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8039b1:	85 c0                	test   %eax,%eax
+  8039b3:	0f 88 77 01 00 00    	js     803b30 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039b9:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  8039bd:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  8039c4:	00 00 00 
+  8039c7:	ff d0                	call   *%rax
+  8039c9:	89 c3                	mov    %eax,%ebx
+  8039cb:	85 c0                	test   %eax,%eax
+  8039cd:	0f 88 43 01 00 00    	js     803b16 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8039d3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8039d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8039dd:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8039e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8039e6:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+  8039f2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8039f4:	85 c0                	test   %eax,%eax
+  8039f6:	0f 88 1a 01 00 00    	js     803b16 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8039fc:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803a00:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  803a07:	00 00 00 
+  803a0a:	ff d0                	call   *%rax
+  803a0c:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803a0f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803a14:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a19:	48 89 c6             	mov    %rax,%rsi
+  803a1c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a21:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  803a28:	00 00 00 
+  803a2b:	ff d0                	call   *%rax
+  803a2d:	89 c3                	mov    %eax,%ebx
+  803a2f:	85 c0                	test   %eax,%eax
+  803a31:	0f 88 c5 00 00 00    	js     803afc <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803a37:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803a3b:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  803a42:	00 00 00 
+  803a45:	ff d0                	call   *%rax
+  803a47:	48 89 c1             	mov    %rax,%rcx
+  803a4a:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803a50:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803a56:	ba 00 00 00 00       	mov    $0x0,%edx
+  803a5b:	4c 89 ee             	mov    %r13,%rsi
+  803a5e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a63:	48 b8 cd 10 80 00 00 	movabs $0x8010cd,%rax
+  803a6a:	00 00 00 
+  803a6d:	ff d0                	call   *%rax
+  803a6f:	89 c3                	mov    %eax,%ebx
+  803a71:	85 c0                	test   %eax,%eax
+  803a73:	78 6e                	js     803ae3 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803a75:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a7a:	4c 89 ef             	mov    %r13,%rdi
+  803a7d:	48 b8 3c 10 80 00 00 	movabs $0x80103c,%rax
+  803a84:	00 00 00 
+  803a87:	ff d0                	call   *%rax
+  803a89:	83 f8 02             	cmp    $0x2,%eax
+  803a8c:	0f 85 ab 00 00 00    	jne    803b3d <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803a92:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  803a99:	00 00 
+  803a9b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803a9f:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803aa1:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803aa5:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803aac:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ab0:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ab2:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ab6:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803abd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ac1:	48 bb aa 14 80 00 00 	movabs $0x8014aa,%rbx
+  803ac8:	00 00 00 
+  803acb:	ff d3                	call   *%rbx
+  803acd:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ad1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ad5:	ff d3                	call   *%rbx
+  803ad7:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803adc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ae1:	eb 4d                	jmp    803b30 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ae3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ae8:	4c 89 ee             	mov    %r13,%rsi
+  803aeb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803af0:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  803af7:	00 00 00 
+  803afa:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803afc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b01:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803b05:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b0a:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  803b11:	00 00 00 
+  803b14:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803b16:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b1b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803b1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b24:	48 b8 1d 11 80 00 00 	movabs $0x80111d,%rax
+  803b2b:	00 00 00 
+  803b2e:	ff d0                	call   *%rax
+}
+  803b30:	89 d8                	mov    %ebx,%eax
+  803b32:	48 83 c4 18          	add    $0x18,%rsp
+  803b36:	5b                   	pop    %rbx
+  803b37:	41 5c                	pop    %r12
+  803b39:	41 5d                	pop    %r13
+  803b3b:	5d                   	pop    %rbp
+  803b3c:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803b3d:	48 b9 70 4d 80 00 00 	movabs $0x804d70,%rcx
+  803b44:	00 00 00 
+  803b47:	48 ba 47 4d 80 00 00 	movabs $0x804d47,%rdx
+  803b4e:	00 00 00 
+  803b51:	be 50 00 00 00       	mov    $0x50,%esi
+  803b56:	48 bf 5c 4d 80 00 00 	movabs $0x804d5c,%rdi
+  803b5d:	00 00 00 
+  803b60:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b65:	49 b8 95 41 80 00 00 	movabs $0x804195,%r8
+  803b6c:	00 00 00 
+  803b6f:	41 ff d0             	call   *%r8
+
+0000000000803b72 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803b72:	55                   	push   %rbp
+  803b73:	48 89 e5             	mov    %rsp,%rbp
+  803b76:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803b7a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803b7e:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  803b85:	00 00 00 
+  803b88:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803b8a:	85 c0                	test   %eax,%eax
+  803b8c:	78 23                	js     803bb1 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803b8e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803b92:	48 b8 bc 14 80 00 00 	movabs $0x8014bc,%rax
+  803b99:	00 00 00 
+  803b9c:	ff d0                	call   *%rax
+  803b9e:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803ba1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ba5:	48 b8 ad 36 80 00 00 	movabs $0x8036ad,%rax
+  803bac:	00 00 00 
+  803baf:	ff d0                	call   *%rax
+}
+  803bb1:	c9                   	leave
+  803bb2:	c3                   	ret
+
+0000000000803bb3 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803bb3:	48 89 f8             	mov    %rdi,%rax
+  803bb6:	48 c1 e8 27          	shr    $0x27,%rax
+  803bba:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803bc1:	01 00 00 
+  803bc4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bc8:	f6 c2 01             	test   $0x1,%dl
+  803bcb:	74 6d                	je     803c3a <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803bcd:	48 89 f8             	mov    %rdi,%rax
+  803bd0:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803bd4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bdb:	01 00 00 
+  803bde:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803be2:	f6 c2 01             	test   $0x1,%dl
+  803be5:	74 62                	je     803c49 <get_uvpt_entry+0x96>
+  803be7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803bee:	01 00 00 
+  803bf1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803bf5:	f6 c2 80             	test   $0x80,%dl
+  803bf8:	75 4f                	jne    803c49 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803bfa:	48 89 f8             	mov    %rdi,%rax
+  803bfd:	48 c1 e8 15          	shr    $0x15,%rax
+  803c01:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c08:	01 00 00 
+  803c0b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c0f:	f6 c2 01             	test   $0x1,%dl
+  803c12:	74 44                	je     803c58 <get_uvpt_entry+0xa5>
+  803c14:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c1b:	01 00 00 
+  803c1e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803c22:	f6 c2 80             	test   $0x80,%dl
+  803c25:	75 31                	jne    803c58 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803c27:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803c2b:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803c32:	01 00 00 
+  803c35:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803c39:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803c3a:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803c41:	01 00 00 
+  803c44:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c48:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803c49:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803c50:	01 00 00 
+  803c53:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c57:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803c58:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803c5f:	01 00 00 
+  803c62:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803c66:	c3                   	ret
+
+0000000000803c67 <get_prot>:
+
+int
+get_prot(void *va) {
+  803c67:	55                   	push   %rbp
+  803c68:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803c6b:	48 b8 b3 3b 80 00 00 	movabs $0x803bb3,%rax
+  803c72:	00 00 00 
+  803c75:	ff d0                	call   *%rax
+  803c77:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803c7a:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803c7f:	89 c1                	mov    %eax,%ecx
+  803c81:	83 c9 04             	or     $0x4,%ecx
+  803c84:	f6 c2 01             	test   $0x1,%dl
+  803c87:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803c8a:	89 c1                	mov    %eax,%ecx
+  803c8c:	83 c9 02             	or     $0x2,%ecx
+  803c8f:	f6 c2 02             	test   $0x2,%dl
+  803c92:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803c95:	89 c1                	mov    %eax,%ecx
+  803c97:	83 c9 01             	or     $0x1,%ecx
+  803c9a:	48 85 d2             	test   %rdx,%rdx
+  803c9d:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803ca0:	89 c1                	mov    %eax,%ecx
+  803ca2:	83 c9 40             	or     $0x40,%ecx
+  803ca5:	f6 c6 04             	test   $0x4,%dh
+  803ca8:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803cab:	5d                   	pop    %rbp
+  803cac:	c3                   	ret
+
+0000000000803cad <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803cad:	55                   	push   %rbp
+  803cae:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803cb1:	48 b8 b3 3b 80 00 00 	movabs $0x803bb3,%rax
+  803cb8:	00 00 00 
+  803cbb:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803cbd:	48 c1 e8 06          	shr    $0x6,%rax
+  803cc1:	83 e0 01             	and    $0x1,%eax
+}
+  803cc4:	5d                   	pop    %rbp
+  803cc5:	c3                   	ret
+
+0000000000803cc6 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803cc6:	55                   	push   %rbp
+  803cc7:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803cca:	48 b8 b3 3b 80 00 00 	movabs $0x803bb3,%rax
+  803cd1:	00 00 00 
+  803cd4:	ff d0                	call   *%rax
+  803cd6:	83 e0 01             	and    $0x1,%eax
+}
+  803cd9:	5d                   	pop    %rbp
+  803cda:	c3                   	ret
+
+0000000000803cdb <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803cdb:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803ce2:	01 00 00 
+  803ce5:	a8 01                	test   $0x1,%al
+  803ce7:	75 06                	jne    803cef <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cee:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803cef:	55                   	push   %rbp
+  803cf0:	48 89 e5             	mov    %rsp,%rbp
+  803cf3:	41 57                	push   %r15
+  803cf5:	41 56                	push   %r14
+  803cf7:	41 55                	push   %r13
+  803cf9:	41 54                	push   %r12
+  803cfb:	53                   	push   %rbx
+  803cfc:	48 83 ec 28          	sub    $0x28,%rsp
+  803d00:	49 89 fe             	mov    %rdi,%r14
+  803d03:	49 89 f7             	mov    %rsi,%r15
+  803d06:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803d0d:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d0e:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803d15:	01 00 00 
+  803d18:	e9 ae 00 00 00       	jmp    803dcb <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d1d:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803d24:	49 83 ec 01          	sub    $0x1,%r12
+  803d28:	74 2d                	je     803d57 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803d2a:	48 89 d8             	mov    %rbx,%rax
+  803d2d:	48 c1 e8 0c          	shr    $0xc,%rax
+  803d31:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803d36:	f6 c2 01             	test   $0x1,%dl
+  803d39:	74 e2                	je     803d1d <foreach_shared_region+0x42>
+  803d3b:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803d40:	f6 c4 04             	test   $0x4,%ah
+  803d43:	74 d8                	je     803d1d <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803d45:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803d4c:	4c 89 fa             	mov    %r15,%rdx
+  803d4f:	48 89 df             	mov    %rbx,%rdi
+  803d52:	41 ff d6             	call   *%r14
+  803d55:	eb c6                	jmp    803d1d <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803d57:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803d5e:	00 
+  803d5f:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803d64:	74 4a                	je     803db0 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803d66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803d6a:	48 c1 e8 15          	shr    $0x15,%rax
+  803d6e:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803d75:	01 00 00 
+  803d78:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803d7c:	a8 01                	test   $0x1,%al
+  803d7e:	74 d7                	je     803d57 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803d80:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803d84:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803d8b:	48 39 c3             	cmp    %rax,%rbx
+  803d8e:	73 c7                	jae    803d57 <foreach_shared_region+0x7c>
+  803d90:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803d97:	48 39 d0             	cmp    %rdx,%rax
+  803d9a:	4d 19 e4             	sbb    %r12,%r12
+  803d9d:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803da4:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803dab:	e9 7a ff ff ff       	jmp    803d2a <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803db0:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803db7:	40 
+  803db8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dbc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803dc3:	00 00 00 
+  803dc6:	48 39 c1             	cmp    %rax,%rcx
+  803dc9:	74 50                	je     803e1b <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  803dcb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803dcf:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803dd3:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  803dda:	01 00 00 
+  803ddd:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803de1:	a8 01                	test   $0x1,%al
+  803de3:	74 cb                	je     803db0 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803de5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803de9:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  803df0:	48 39 c1             	cmp    %rax,%rcx
+  803df3:	73 bb                	jae    803db0 <foreach_shared_region+0xd5>
+  803df5:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  803dfc:	48 39 d0             	cmp    %rdx,%rax
+  803dff:	48 19 c0             	sbb    %rax,%rax
+  803e02:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  803e08:	48 05 00 02 00 00    	add    $0x200,%rax
+  803e0e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803e12:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803e16:	e9 4b ff ff ff       	jmp    803d66 <foreach_shared_region+0x8b>
+  803e1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e20:	48 83 c4 28          	add    $0x28,%rsp
+  803e24:	5b                   	pop    %rbx
+  803e25:	41 5c                	pop    %r12
+  803e27:	41 5d                	pop    %r13
+  803e29:	41 5e                	pop    %r14
+  803e2b:	41 5f                	pop    %r15
+  803e2d:	5d                   	pop    %rbp
+  803e2e:	c3                   	ret
+
+0000000000803e2f <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803e2f:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  803e35:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803e3c:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803e43:	c3                   	ret
+
+0000000000803e44 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803e44:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e47:	8b 17                	mov    (%rdi),%edx
+  803e49:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e4b:	83 f8 0f             	cmp    $0xf,%eax
+  803e4e:	77 13                	ja     803e63 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803e50:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e53:	83 e0 0f             	and    $0xf,%eax
+  803e56:	48 c1 e0 09          	shl    $0x9,%rax
+  803e5a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803e61:	00 
+  803e62:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803e63:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803e68:	c3                   	ret
+
+0000000000803e69 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803e69:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e6c:	83 c0 01             	add    $0x1,%eax
+  803e6f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e72:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e78:	8b 57 04             	mov    0x4(%rdi),%edx
+  803e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e80:	85 d2                	test   %edx,%edx
+  803e82:	75 04                	jne    803e88 <chan_publish+0x1f>
+  803e84:	83 e0 01             	and    $0x1,%eax
+}
+  803e87:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803e88:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803e8b:	85 c0                	test   %eax,%eax
+  803e8d:	0f 95 c0             	setne  %al
+  803e90:	0f b6 c0             	movzbl %al,%eax
+  803e93:	eb ef                	jmp    803e84 <chan_publish+0x1b>
+
+0000000000803e95 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803e95:	8b 47 40             	mov    0x40(%rdi),%eax
+  803e98:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803e9a:	29 d0                	sub    %edx,%eax
+  803e9c:	83 e8 01             	sub    $0x1,%eax
+  803e9f:	83 f8 0f             	cmp    $0xf,%eax
+  803ea2:	77 12                	ja     803eb6 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803ea4:	8b 07                	mov    (%rdi),%eax
+  803ea6:	83 e0 0f             	and    $0xf,%eax
+  803ea9:	48 c1 e0 09          	shl    $0x9,%rax
+  803ead:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803eb4:	00 
+  803eb5:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803eb6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ebb:	c3                   	ret
+
+0000000000803ebc <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  803ebc:	8b 07                	mov    (%rdi),%eax
+  803ebe:	83 c0 01             	add    $0x1,%eax
+  803ec1:	89 07                	mov    %eax,(%rdi)
+}
+  803ec3:	c3                   	ret
+
+0000000000803ec4 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803ec4:	55                   	push   %rbp
+  803ec5:	48 89 e5             	mov    %rsp,%rbp
+  803ec8:	53                   	push   %rbx
+  803ec9:	48 83 ec 08          	sub    $0x8,%rsp
+  803ecd:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  803ed0:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ed7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  803edd:	48 b8 95 3e 80 00 00 	movabs $0x803e95,%rax
+  803ee4:	00 00 00 
+  803ee7:	ff d0                	call   *%rax
+  803ee9:	48 85 c0             	test   %rax,%rax
+  803eec:	74 12                	je     803f00 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  803eee:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  803ef5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803efa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803efe:	c9                   	leave
+  803eff:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  803f00:	b8 01 00 00 00       	mov    $0x1,%eax
+  803f05:	eb f3                	jmp    803efa <chan_arm+0x36>
+
+0000000000803f07 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  803f07:	55                   	push   %rbp
+  803f08:	48 89 e5             	mov    %rsp,%rbp
+  803f0b:	41 56                	push   %r14
+  803f0d:	41 55                	push   %r13
+  803f0f:	41 54                	push   %r12
+  803f11:	53                   	push   %rbx
+  803f12:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  803f15:	49 bc c4 3e 80 00 00 	movabs $0x803ec4,%r12
+  803f1c:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f1f:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  803f23:	49 bd e5 13 80 00 00 	movabs $0x8013e5,%r13
+  803f2a:	00 00 00 
+    while (chan_arm(r))
+  803f2d:	eb 0d                	jmp    803f3c <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803f2f:	8b 33                	mov    (%rbx),%esi
+  803f31:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f36:	4c 89 f7             	mov    %r14,%rdi
+  803f39:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803f3c:	48 89 df             	mov    %rbx,%rdi
+  803f3f:	41 ff d4             	call   *%r12
+  803f42:	84 c0                	test   %al,%al
+  803f44:	75 e9                	jne    803f2f <chan_wait+0x28>
+}
+  803f46:	5b                   	pop    %rbx
+  803f47:	41 5c                	pop    %r12
+  803f49:	41 5d                	pop    %r13
+  803f4b:	41 5e                	pop    %r14
+  803f4d:	5d                   	pop    %rbp
+  803f4e:	c3                   	ret
+
+0000000000803f4f <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803f4f:	55                   	push   %rbp
+  803f50:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803f53:	48 83 c7 40          	add    $0x40,%rdi
+  803f57:	be 01 00 00 00       	mov    $0x1,%esi
+  803f5c:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803f63:	00 00 00 
+  803f66:	ff d0                	call   *%rax
+}
+  803f68:	5d                   	pop    %rbp
+  803f69:	c3                   	ret
+
+0000000000803f6a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6f:	c3                   	ret
+
+0000000000803f70 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803f70:	55                   	push   %rbp
+  803f71:	48 89 e5             	mov    %rsp,%rbp
+  803f74:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803f77:	48 be 94 4d 80 00 00 	movabs $0x804d94,%rsi
+  803f7e:	00 00 00 
+  803f81:	48 b8 18 0b 80 00 00 	movabs $0x800b18,%rax
+  803f88:	00 00 00 
+  803f8b:	ff d0                	call   *%rax
+    return 0;
+}
+  803f8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f92:	5d                   	pop    %rbp
+  803f93:	c3                   	ret
+
+0000000000803f94 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803f94:	55                   	push   %rbp
+  803f95:	48 89 e5             	mov    %rsp,%rbp
+  803f98:	41 57                	push   %r15
+  803f9a:	41 56                	push   %r14
+  803f9c:	41 55                	push   %r13
+  803f9e:	41 54                	push   %r12
+  803fa0:	53                   	push   %rbx
+  803fa1:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803fa8:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803faf:	48 85 d2             	test   %rdx,%rdx
+  803fb2:	74 7a                	je     80402e <devcons_write+0x9a>
+  803fb4:	49 89 d6             	mov    %rdx,%r14
+  803fb7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  803fbd:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803fc2:	49 bf 12 0d 80 00 00 	movabs $0x800d12,%r15
+  803fc9:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  803fcc:	4c 89 f3             	mov    %r14,%rbx
+  803fcf:	48 29 f3             	sub    %rsi,%rbx
+  803fd2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803fd7:	48 39 c3             	cmp    %rax,%rbx
+  803fda:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  803fde:	4c 63 eb             	movslq %ebx,%r13
+  803fe1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  803fe8:	48 01 c6             	add    %rax,%rsi
+  803feb:	4c 89 ea             	mov    %r13,%rdx
+  803fee:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  803ff5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  803ff8:	4c 89 ee             	mov    %r13,%rsi
+  803ffb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804002:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  804009:	00 00 00 
+  80400c:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80400e:	41 01 dc             	add    %ebx,%r12d
+  804011:	49 63 f4             	movslq %r12d,%rsi
+  804014:	4c 39 f6             	cmp    %r14,%rsi
+  804017:	72 b3                	jb     803fcc <devcons_write+0x38>
+    return res;
+  804019:	49 63 c4             	movslq %r12d,%rax
+}
+  80401c:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804023:	5b                   	pop    %rbx
+  804024:	41 5c                	pop    %r12
+  804026:	41 5d                	pop    %r13
+  804028:	41 5e                	pop    %r14
+  80402a:	41 5f                	pop    %r15
+  80402c:	5d                   	pop    %rbp
+  80402d:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80402e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804034:	eb e3                	jmp    804019 <devcons_write+0x85>
+
+0000000000804036 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804036:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804039:	ba 00 00 00 00       	mov    $0x0,%edx
+  80403e:	48 85 c0             	test   %rax,%rax
+  804041:	74 55                	je     804098 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804043:	55                   	push   %rbp
+  804044:	48 89 e5             	mov    %rsp,%rbp
+  804047:	41 55                	push   %r13
+  804049:	41 54                	push   %r12
+  80404b:	53                   	push   %rbx
+  80404c:	48 83 ec 08          	sub    $0x8,%rsp
+  804050:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804053:	48 bb 5e 0f 80 00 00 	movabs $0x800f5e,%rbx
+  80405a:	00 00 00 
+  80405d:	49 bc 13 10 80 00 00 	movabs $0x801013,%r12
+  804064:	00 00 00 
+  804067:	eb 03                	jmp    80406c <devcons_read+0x36>
+  804069:	41 ff d4             	call   *%r12
+  80406c:	ff d3                	call   *%rbx
+  80406e:	85 c0                	test   %eax,%eax
+  804070:	74 f7                	je     804069 <devcons_read+0x33>
+    if (c < 0) return c;
+  804072:	48 63 d0             	movslq %eax,%rdx
+  804075:	78 13                	js     80408a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804077:	ba 00 00 00 00       	mov    $0x0,%edx
+  80407c:	83 f8 04             	cmp    $0x4,%eax
+  80407f:	74 09                	je     80408a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804081:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804085:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80408a:	48 89 d0             	mov    %rdx,%rax
+  80408d:	48 83 c4 08          	add    $0x8,%rsp
+  804091:	5b                   	pop    %rbx
+  804092:	41 5c                	pop    %r12
+  804094:	41 5d                	pop    %r13
+  804096:	5d                   	pop    %rbp
+  804097:	c3                   	ret
+  804098:	48 89 d0             	mov    %rdx,%rax
+  80409b:	c3                   	ret
+
+000000000080409c <cputchar>:
+cputchar(int ch) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8040a4:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8040a8:	be 01 00 00 00       	mov    $0x1,%esi
+  8040ad:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8040b1:	48 b8 3f 0f 80 00 00 	movabs $0x800f3f,%rax
+  8040b8:	00 00 00 
+  8040bb:	ff d0                	call   *%rax
+}
+  8040bd:	c9                   	leave
+  8040be:	c3                   	ret
+
+00000000008040bf <getchar>:
+getchar(void) {
+  8040bf:	55                   	push   %rbp
+  8040c0:	48 89 e5             	mov    %rsp,%rbp
+  8040c3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8040c7:	ba 01 00 00 00       	mov    $0x1,%edx
+  8040cc:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8040d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8040d5:	48 b8 1b 18 80 00 00 	movabs $0x80181b,%rax
+  8040dc:	00 00 00 
+  8040df:	ff d0                	call   *%rax
+  8040e1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8040e3:	85 c0                	test   %eax,%eax
+  8040e5:	78 06                	js     8040ed <getchar+0x2e>
+  8040e7:	74 08                	je     8040f1 <getchar+0x32>
+  8040e9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8040ed:	89 d0                	mov    %edx,%eax
+  8040ef:	c9                   	leave
+  8040f0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8040f1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8040f6:	eb f5                	jmp    8040ed <getchar+0x2e>
+
+00000000008040f8 <iscons>:
+iscons(int fdnum) {
+  8040f8:	55                   	push   %rbp
+  8040f9:	48 89 e5             	mov    %rsp,%rbp
+  8040fc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804100:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804104:	48 b8 38 15 80 00 00 	movabs $0x801538,%rax
+  80410b:	00 00 00 
+  80410e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804110:	85 c0                	test   %eax,%eax
+  804112:	78 18                	js     80412c <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804114:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804118:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  80411f:	00 00 00 
+  804122:	8b 00                	mov    (%rax),%eax
+  804124:	39 02                	cmp    %eax,(%rdx)
+  804126:	0f 94 c0             	sete   %al
+  804129:	0f b6 c0             	movzbl %al,%eax
+}
+  80412c:	c9                   	leave
+  80412d:	c3                   	ret
+
+000000000080412e <opencons>:
+opencons(void) {
+  80412e:	55                   	push   %rbp
+  80412f:	48 89 e5             	mov    %rsp,%rbp
+  804132:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804136:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80413a:	48 b8 d8 14 80 00 00 	movabs $0x8014d8,%rax
+  804141:	00 00 00 
+  804144:	ff d0                	call   *%rax
+  804146:	85 c0                	test   %eax,%eax
+  804148:	78 49                	js     804193 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80414a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80414f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804154:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804158:	bf 00 00 00 00       	mov    $0x0,%edi
+  80415d:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  804164:	00 00 00 
+  804167:	ff d0                	call   *%rax
+  804169:	85 c0                	test   %eax,%eax
+  80416b:	78 26                	js     804193 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80416d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804171:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  804178:	00 00 
+  80417a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80417c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804180:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804187:	48 b8 aa 14 80 00 00 	movabs $0x8014aa,%rax
+  80418e:	00 00 00 
+  804191:	ff d0                	call   *%rax
+}
+  804193:	c9                   	leave
+  804194:	c3                   	ret
+
+0000000000804195 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804195:	55                   	push   %rbp
+  804196:	48 89 e5             	mov    %rsp,%rbp
+  804199:	41 56                	push   %r14
+  80419b:	41 55                	push   %r13
+  80419d:	41 54                	push   %r12
+  80419f:	53                   	push   %rbx
+  8041a0:	48 83 ec 50          	sub    $0x50,%rsp
+  8041a4:	49 89 fc             	mov    %rdi,%r12
+  8041a7:	41 89 f5             	mov    %esi,%r13d
+  8041aa:	48 89 d3             	mov    %rdx,%rbx
+  8041ad:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041b1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8041b5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8041b9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8041c0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8041c4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8041c8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8041cc:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8041d0:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8041d7:	00 00 00 
+  8041da:	4c 8b 30             	mov    (%rax),%r14
+  8041dd:	48 b8 ea 0f 80 00 00 	movabs $0x800fea,%rax
+  8041e4:	00 00 00 
+  8041e7:	ff d0                	call   *%rax
+  8041e9:	89 c6                	mov    %eax,%esi
+  8041eb:	45 89 e8             	mov    %r13d,%r8d
+  8041ee:	4c 89 e1             	mov    %r12,%rcx
+  8041f1:	4c 89 f2             	mov    %r14,%rdx
+  8041f4:	48 bf a0 4d 80 00 00 	movabs $0x804da0,%rdi
+  8041fb:	00 00 00 
+  8041fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804203:	49 bc f3 01 80 00 00 	movabs $0x8001f3,%r12
+  80420a:	00 00 00 
+  80420d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804210:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804214:	48 89 df             	mov    %rbx,%rdi
+  804217:	48 b8 8f 01 80 00 00 	movabs $0x80018f,%rax
+  80421e:	00 00 00 
+  804221:	ff d0                	call   *%rax
+    cprintf("\n");
+  804223:	48 bf dc 46 80 00 00 	movabs $0x8046dc,%rdi
+  80422a:	00 00 00 
+  80422d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804232:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804235:	cc                   	int3
+  804236:	eb fd                	jmp    804235 <_panic+0xa0>
+
+0000000000804238 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804238:	55                   	push   %rbp
+  804239:	48 89 e5             	mov    %rsp,%rbp
+  80423c:	41 56                	push   %r14
+  80423e:	41 55                	push   %r13
+  804240:	41 54                	push   %r12
+  804242:	53                   	push   %rbx
+  804243:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804246:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80424d:	00 00 00 
+  804250:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804254:	74 27                	je     80427d <_handle_vectored_pagefault+0x45>
+  804256:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80425b:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804262:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804265:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804268:	4c 89 e7             	mov    %r12,%rdi
+  80426b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804270:	84 c0                	test   %al,%al
+  804272:	75 45                	jne    8042b9 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804274:	48 83 c3 01          	add    $0x1,%rbx
+  804278:	49 3b 1e             	cmp    (%r14),%rbx
+  80427b:	72 eb                	jb     804268 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80427d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804284:	00 
+  804285:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80428a:	4d 8b 04 24          	mov    (%r12),%r8
+  80428e:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  804295:	00 00 00 
+  804298:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80429d:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  8042a4:	00 00 00 
+  8042a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ac:	49 ba 95 41 80 00 00 	movabs $0x804195,%r10
+  8042b3:	00 00 00 
+  8042b6:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8042b9:	5b                   	pop    %rbx
+  8042ba:	41 5c                	pop    %r12
+  8042bc:	41 5d                	pop    %r13
+  8042be:	41 5e                	pop    %r14
+  8042c0:	5d                   	pop    %rbp
+  8042c1:	c3                   	ret
+
+00000000008042c2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042c2:	55                   	push   %rbp
+  8042c3:	48 89 e5             	mov    %rsp,%rbp
+  8042c6:	53                   	push   %rbx
+  8042c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8042cb:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042ce:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042d5:	00 00 00 
+  8042d8:	80 38 00             	cmpb   $0x0,(%rax)
+  8042db:	0f 84 84 00 00 00    	je     804365 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042e1:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042e8:	00 00 00 
+  8042eb:	48 8b 10             	mov    (%rax),%rdx
+  8042ee:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042f3:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042fa:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042fd:	48 85 d2             	test   %rdx,%rdx
+  804300:	74 19                	je     80431b <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804302:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804306:	0f 84 e8 00 00 00    	je     8043f4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80430c:	48 83 c0 01          	add    $0x1,%rax
+  804310:	48 39 d0             	cmp    %rdx,%rax
+  804313:	75 ed                	jne    804302 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804315:	48 83 fa 08          	cmp    $0x8,%rdx
+  804319:	74 1c                	je     804337 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80431b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80431f:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804326:	00 00 00 
+  804329:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804330:	00 00 00 
+  804333:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804337:	48 b8 ea 0f 80 00 00 	movabs $0x800fea,%rax
+  80433e:	00 00 00 
+  804341:	ff d0                	call   *%rax
+  804343:	89 c7                	mov    %eax,%edi
+  804345:	48 be ba 44 80 00 00 	movabs $0x8044ba,%rsi
+  80434c:	00 00 00 
+  80434f:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  804356:	00 00 00 
+  804359:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80435b:	85 c0                	test   %eax,%eax
+  80435d:	78 68                	js     8043c7 <add_pgfault_handler+0x105>
+    return res;
+}
+  80435f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804363:	c9                   	leave
+  804364:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804365:	48 b8 ea 0f 80 00 00 	movabs $0x800fea,%rax
+  80436c:	00 00 00 
+  80436f:	ff d0                	call   *%rax
+  804371:	89 c7                	mov    %eax,%edi
+  804373:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804378:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80437d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804384:	00 00 00 
+  804387:	48 b8 77 10 80 00 00 	movabs $0x801077,%rax
+  80438e:	00 00 00 
+  804391:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804393:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80439a:	00 00 00 
+  80439d:	48 8b 02             	mov    (%rdx),%rax
+  8043a0:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8043a4:	48 89 0a             	mov    %rcx,(%rdx)
+  8043a7:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043ae:	00 00 00 
+  8043b1:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8043b5:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043bc:	00 00 00 
+  8043bf:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043c2:	e9 70 ff ff ff       	jmp    804337 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043c7:	89 c1                	mov    %eax,%ecx
+  8043c9:	48 ba 06 4e 80 00 00 	movabs $0x804e06,%rdx
+  8043d0:	00 00 00 
+  8043d3:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043d8:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  8043df:	00 00 00 
+  8043e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e7:	49 b8 95 41 80 00 00 	movabs $0x804195,%r8
+  8043ee:	00 00 00 
+  8043f1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f9:	e9 61 ff ff ff       	jmp    80435f <add_pgfault_handler+0x9d>
+
+00000000008043fe <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043fe:	55                   	push   %rbp
+  8043ff:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804402:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804409:	00 00 00 
+  80440c:	80 38 00             	cmpb   $0x0,(%rax)
+  80440f:	74 33                	je     804444 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804411:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804418:	00 00 00 
+  80441b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804420:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804427:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80442a:	48 85 c0             	test   %rax,%rax
+  80442d:	0f 84 85 00 00 00    	je     8044b8 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804433:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804437:	74 40                	je     804479 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804439:	48 83 c1 01          	add    $0x1,%rcx
+  80443d:	48 39 c1             	cmp    %rax,%rcx
+  804440:	75 f1                	jne    804433 <remove_pgfault_handler+0x35>
+  804442:	eb 74                	jmp    8044b8 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804444:	48 b9 1e 4e 80 00 00 	movabs $0x804e1e,%rcx
+  80444b:	00 00 00 
+  80444e:	48 ba 47 4d 80 00 00 	movabs $0x804d47,%rdx
+  804455:	00 00 00 
+  804458:	be 43 00 00 00       	mov    $0x43,%esi
+  80445d:	48 bf f8 4d 80 00 00 	movabs $0x804df8,%rdi
+  804464:	00 00 00 
+  804467:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446c:	49 b8 95 41 80 00 00 	movabs $0x804195,%r8
+  804473:	00 00 00 
+  804476:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804479:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804480:	00 
+  804481:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804485:	48 29 ca             	sub    %rcx,%rdx
+  804488:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80448f:	00 00 00 
+  804492:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804496:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80449b:	48 89 ce             	mov    %rcx,%rsi
+  80449e:	48 b8 12 0d 80 00 00 	movabs $0x800d12,%rax
+  8044a5:	00 00 00 
+  8044a8:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8044aa:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8044b1:	00 00 00 
+  8044b4:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8044b8:	5d                   	pop    %rbp
+  8044b9:	c3                   	ret
+
+00000000008044ba <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8044ba:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8044bd:	48 b8 38 42 80 00 00 	movabs $0x804238,%rax
+  8044c4:	00 00 00 
+    call *%rax
+  8044c7:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044c9:	41 5f                	pop    %r15
+	popq %r15
+  8044cb:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044cd:	41 5f                	pop    %r15
+	popq %r14
+  8044cf:	41 5e                	pop    %r14
+	popq %r13
+  8044d1:	41 5d                	pop    %r13
+	popq %r12
+  8044d3:	41 5c                	pop    %r12
+	popq %r11
+  8044d5:	41 5b                	pop    %r11
+	popq %r10
+  8044d7:	41 5a                	pop    %r10
+	popq %r9
+  8044d9:	41 59                	pop    %r9
+	popq %r8
+  8044db:	41 58                	pop    %r8
+	popq %rsi
+  8044dd:	5e                   	pop    %rsi
+	popq %rdi
+  8044de:	5f                   	pop    %rdi
+	popq %rbp
+  8044df:	5d                   	pop    %rbp
+	popq %rdx
+  8044e0:	5a                   	pop    %rdx
+	popq %rcx
+  8044e1:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044e2:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044e7:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044ec:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044f0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044f3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044f8:	5b                   	pop    %rbx
+	popq %rax
+  8044f9:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044fa:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044fe:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044ff:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804504:	c3                   	ret
+
+0000000000804505 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804505:	55                   	push   %rbp
+  804506:	48 89 e5             	mov    %rsp,%rbp
+  804509:	41 55                	push   %r13
+  80450b:	41 54                	push   %r12
+  80450d:	53                   	push   %rbx
+  80450e:	48 83 ec 08          	sub    $0x8,%rsp
+  804512:	49 89 fd             	mov    %rdi,%r13
+  804515:	48 89 f7             	mov    %rsi,%rdi
+  804518:	48 89 d3             	mov    %rdx,%rbx
+  80451b:	49 89 cc             	mov    %rcx,%r12
+  80451e:	4c 89 c2             	mov    %r8,%rdx
+  804521:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804524:	48 85 f6             	test   %rsi,%rsi
+  804527:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80452e:	00 00 00 
+  804531:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804535:	be 00 10 00 00       	mov    $0x1000,%esi
+  80453a:	48 85 db             	test   %rbx,%rbx
+  80453d:	74 03                	je     804542 <ipc_recv_futex+0x3d>
+  80453f:	48 8b 33             	mov    (%rbx),%rsi
+  804542:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804546:	48 b8 c1 12 80 00 00 	movabs $0x8012c1,%rax
+  80454d:	00 00 00 
+  804550:	ff d0                	call   *%rax
+    if (res < 0) {
+  804552:	85 c0                	test   %eax,%eax
+  804554:	78 75                	js     8045cb <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804556:	4d 85 ed             	test   %r13,%r13
+  804559:	74 14                	je     80456f <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80455b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804562:	00 00 00 
+  804565:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80456b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80456f:	4d 85 e4             	test   %r12,%r12
+  804572:	74 14                	je     804588 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804574:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80457b:	00 00 00 
+  80457e:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804584:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804588:	48 85 db             	test   %rbx,%rbx
+  80458b:	74 23                	je     8045b0 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80458d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804594:	00 00 00 
+  804597:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80459d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045a2:	85 c9                	test   %ecx,%ecx
+  8045a4:	74 07                	je     8045ad <ipc_recv_futex+0xa8>
+  8045a6:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8045ad:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8045b0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8045b7:	00 00 00 
+  8045ba:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045c0:	48 83 c4 08          	add    $0x8,%rsp
+  8045c4:	5b                   	pop    %rbx
+  8045c5:	41 5c                	pop    %r12
+  8045c7:	41 5d                	pop    %r13
+  8045c9:	5d                   	pop    %rbp
+  8045ca:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045cb:	4d 85 ed             	test   %r13,%r13
+  8045ce:	74 08                	je     8045d8 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045d0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045d7:	00 
+        if (perm_store != NULL) {
+  8045d8:	4d 85 e4             	test   %r12,%r12
+  8045db:	74 08                	je     8045e5 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045dd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045e4:	00 
+        if (size != NULL) {
+  8045e5:	48 85 db             	test   %rbx,%rbx
+  8045e8:	74 d6                	je     8045c0 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045ea:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045f1:	eb cd                	jmp    8045c0 <ipc_recv_futex+0xbb>
+
+00000000008045f3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045f3:	55                   	push   %rbp
+  8045f4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045f7:	48 83 ec 08          	sub    $0x8,%rsp
+  8045fb:	6a 00                	push   $0x0
+  8045fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804603:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804609:	48 b8 05 45 80 00 00 	movabs $0x804505,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+}
+  804615:	c9                   	leave
+  804616:	c3                   	ret
+
+0000000000804617 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804617:	55                   	push   %rbp
+  804618:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80461b:	48 85 d2             	test   %rdx,%rdx
+  80461e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804625:	00 00 00 
+  804628:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80462c:	89 f6                	mov    %esi,%esi
+  80462e:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  804635:	00 00 00 
+  804638:	ff d0                	call   *%rax
+    if (res < 0) {
+  80463a:	85 c0                	test   %eax,%eax
+  80463c:	78 02                	js     804640 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80463e:	5d                   	pop    %rbp
+  80463f:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804640:	89 c1                	mov    %eax,%ecx
+  804642:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  804649:	00 00 00 
+  80464c:	be 50 00 00 00       	mov    $0x50,%esi
+  804651:	48 bf 4c 4e 80 00 00 	movabs $0x804e4c,%rdi
+  804658:	00 00 00 
+  80465b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804660:	49 b8 95 41 80 00 00 	movabs $0x804195,%r8
+  804667:	00 00 00 
+  80466a:	41 ff d0             	call   *%r8
+
+000000000080466d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80466d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804672:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804679:	00 00 00 
+  80467c:	48 89 d0             	mov    %rdx,%rax
+  80467f:	48 c1 e0 04          	shl    $0x4,%rax
+  804683:	48 29 d0             	sub    %rdx,%rax
+  804686:	48 c1 e0 05          	shl    $0x5,%rax
+  80468a:	48 01 c8             	add    %rcx,%rax
+  80468d:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804693:	39 f8                	cmp    %edi,%eax
+  804695:	74 13                	je     8046aa <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804697:	48 83 c2 01          	add    $0x1,%rdx
+  80469b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8046a2:	75 d8                	jne    80467c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8046a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046a9:	c3                   	ret
+            return envs[i].env_id;
+  8046aa:	48 89 d0             	mov    %rdx,%rax
+  8046ad:	48 c1 e0 04          	shl    $0x4,%rax
+  8046b1:	48 29 d0             	sub    %rdx,%rax
+  8046b4:	48 c1 e0 05          	shl    $0x5,%rax
+  8046b8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8046bf:	00 00 00 
+  8046c2:	48 01 d0             	add    %rdx,%rax
+  8046c5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046cb:	c3                   	ret
+  8046cc:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008046d0 <__rodata_start>:
+  8046d0:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  8046d5:	2c 20                	sub    $0x20,%al
+  8046d7:	77 6f                	ja     804748 <__rodata_start+0x78>
+  8046d9:	72 6c                	jb     804747 <__rodata_start+0x77>
+  8046db:	64 0a 00             	or     %fs:(%rax),%al
+  8046de:	69 20 61 6d 20 65    	imul   $0x65206d61,(%rax),%esp
+  8046e4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046e5:	76 69                	jbe    804750 <__rodata_start+0x80>
+  8046e7:	72 6f                	jb     804758 <__rodata_start+0x88>
+  8046e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046ea:	6d                   	insl   (%dx),%es:(%rdi)
+  8046eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8046ed:	74 20                	je     80470f <__rodata_start+0x3f>
+  8046ef:	25 30 38 78 0a       	and    $0xa783830,%eax
+  8046f4:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  8046fb:	77 6e                	ja     80476b <__rodata_start+0x9b>
+  8046fd:	3e 00 30             	ds add %dh,(%rax)
+  804700:	31 32                	xor    %esi,(%rdx)
+  804702:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804709:	41                   	rex.B
+  80470a:	42                   	rex.X
+  80470b:	43                   	rex.XB
+  80470c:	44                   	rex.R
+  80470d:	45                   	rex.RB
+  80470e:	46 00 30             	rex.RX add %r14b,(%rax)
+  804711:	31 32                	xor    %esi,(%rdx)
+  804713:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80471a:	61                   	(bad)
+  80471b:	62 63 64 65 66       	(bad)
+  804720:	00 28                	add    %ch,(%rax)
+  804722:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804723:	75 6c                	jne    804791 <__rodata_start+0xc1>
+  804725:	6c                   	insb   (%dx),%es:(%rdi)
+  804726:	29 00                	sub    %eax,(%rax)
+  804728:	65 72 72             	gs jb  80479d <__rodata_start+0xcd>
+  80472b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80472c:	72 20                	jb     80474e <__rodata_start+0x7e>
+  80472e:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804733:	73 70                	jae    8047a5 <__rodata_start+0xd5>
+  804735:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804739:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804740:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804741:	72 00                	jb     804743 <__rodata_start+0x73>
+  804743:	62 61 64 20 65       	(bad)
+  804748:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804749:	76 69                	jbe    8047b4 <__rodata_start+0xe4>
+  80474b:	72 6f                	jb     8047bc <__rodata_start+0xec>
+  80474d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80474e:	6d                   	insl   (%dx),%es:(%rdi)
+  80474f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804751:	74 00                	je     804753 <__rodata_start+0x83>
+  804753:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80475a:	20 70 61             	and    %dh,0x61(%rax)
+  80475d:	72 61                	jb     8047c0 <__rodata_start+0xf0>
+  80475f:	6d                   	insl   (%dx),%es:(%rdi)
+  804760:	65 74 65             	gs je  8047c8 <__rodata_start+0xf8>
+  804763:	72 00                	jb     804765 <__rodata_start+0x95>
+  804765:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804766:	75 74                	jne    8047dc <__rodata_start+0x10c>
+  804768:	20 6f 66             	and    %ch,0x66(%rdi)
+  80476b:	20 6d 65             	and    %ch,0x65(%rbp)
+  80476e:	6d                   	insl   (%dx),%es:(%rdi)
+  80476f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804770:	72 79                	jb     8047eb <__rodata_start+0x11b>
+  804772:	00 6f 75             	add    %ch,0x75(%rdi)
+  804775:	74 20                	je     804797 <__rodata_start+0xc7>
+  804777:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804778:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  80477c:	76 69                	jbe    8047e7 <__rodata_start+0x117>
+  80477e:	72 6f                	jb     8047ef <__rodata_start+0x11f>
+  804780:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804781:	6d                   	insl   (%dx),%es:(%rdi)
+  804782:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804784:	74 73                	je     8047f9 <__rodata_start+0x129>
+  804786:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804789:	72 72                	jb     8047fd <__rodata_start+0x12d>
+  80478b:	75 70                	jne    8047fd <__rodata_start+0x12d>
+  80478d:	74 65                	je     8047f4 <__rodata_start+0x124>
+  80478f:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804794:	75 67                	jne    8047fd <__rodata_start+0x12d>
+  804796:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804799:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80479b:	00 73 65             	add    %dh,0x65(%rbx)
+  80479e:	67 6d                	insl   (%dx),%es:(%edi)
+  8047a0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8047a2:	74 61                	je     804805 <__rodata_start+0x135>
+  8047a4:	74 69                	je     80480f <__rodata_start+0x13f>
+  8047a6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047a7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047a8:	20 66 61             	and    %ah,0x61(%rsi)
+  8047ab:	75 6c                	jne    804819 <__rodata_start+0x149>
+  8047ad:	74 00                	je     8047af <__rodata_start+0xdf>
+  8047af:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8047b6:	20 45 4c             	and    %al,0x4c(%rbp)
+  8047b9:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8047bd:	61                   	(bad)
+  8047be:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8047c3:	20 73 75             	and    %dh,0x75(%rbx)
+  8047c6:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8047c9:	73 79                	jae    804844 <__rodata_start+0x174>
+  8047cb:	73 74                	jae    804841 <__rodata_start+0x171>
+  8047cd:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8047cf:	20 63 61             	and    %ah,0x61(%rbx)
+  8047d2:	6c                   	insb   (%dx),%es:(%rdi)
+  8047d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8047d4:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8047d7:	74 72                	je     80484b <__rodata_start+0x17b>
+  8047d9:	79 20                	jns    8047fb <__rodata_start+0x12b>
+  8047db:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8047dd:	74 20                	je     8047ff <__rodata_start+0x12f>
+  8047df:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8047e1:	75 6e                	jne    804851 <__rodata_start+0x181>
+  8047e3:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8047e7:	76 20                	jbe    804809 <__rodata_start+0x139>
+  8047e9:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8047f0:	72 65                	jb     804857 <__rodata_start+0x187>
+  8047f2:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8047f5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8047f6:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8047fa:	65 78 70             	gs js  80486d <__rodata_start+0x19d>
+  8047fd:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804802:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804805:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804809:	20 66 69             	and    %ah,0x69(%rsi)
+  80480c:	6c                   	insb   (%dx),%es:(%rdi)
+  80480d:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804811:	20 66 72             	and    %ah,0x72(%rsi)
+  804814:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804819:	61                   	(bad)
+  80481a:	63 65 20             	movsxd 0x20(%rbp),%esp
+  80481d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80481e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80481f:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804823:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804826:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804827:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804828:	20 6d 61             	and    %ch,0x61(%rbp)
+  80482b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80482c:	79 20                	jns    80484e <__rodata_start+0x17e>
+  80482e:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804835:	72 65                	jb     80489c <__rodata_start+0x1cc>
+  804837:	20 6f 70             	and    %ch,0x70(%rdi)
+  80483a:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80483c:	00 66 69             	add    %ah,0x69(%rsi)
+  80483f:	6c                   	insb   (%dx),%es:(%rdi)
+  804840:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804844:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804847:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804848:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80484b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80484c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80484d:	74 20                	je     80486f <__rodata_start+0x19f>
+  80484f:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804851:	75 6e                	jne    8048c1 <__rodata_start+0x1f1>
+  804853:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804857:	76 61                	jbe    8048ba <__rodata_start+0x1ea>
+  804859:	6c                   	insb   (%dx),%es:(%rdi)
+  80485a:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804861:	00 
+  804862:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804869:	72 65                	jb     8048d0 <__rodata_start+0x200>
+  80486b:	61                   	(bad)
+  80486c:	64 79 20             	fs jns 80488f <__rodata_start+0x1bf>
+  80486f:	65 78 69             	gs js  8048db <__rodata_start+0x20b>
+  804872:	73 74                	jae    8048e8 <__rodata_start+0x218>
+  804874:	73 00                	jae    804876 <__rodata_start+0x1a6>
+  804876:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804877:	70 65                	jo     8048de <__rodata_start+0x20e>
+  804879:	72 61                	jb     8048dc <__rodata_start+0x20c>
+  80487b:	74 69                	je     8048e6 <__rodata_start+0x216>
+  80487d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80487e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80487f:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804882:	74 20                	je     8048a4 <__rodata_start+0x1d4>
+  804884:	73 75                	jae    8048fb <__rodata_start+0x22b>
+  804886:	70 70                	jo     8048f8 <__rodata_start+0x228>
+  804888:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804889:	72 74                	jb     8048ff <__rodata_start+0x22f>
+  80488b:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804891:	20 61 67             	and    %ah,0x67(%rcx)
+  804894:	61                   	(bad)
+  804895:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  80489c:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8048a0:	74 00                	je     8048a2 <__rodata_start+0x1d2>
+  8048a2:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8048a9:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8048ac:	20 75 73             	and    %dh,0x73(%rbp)
+  8048af:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8048b3:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8048ba:	00 
+  8048bb:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+  8048c0:	e0 03                	loopne 8048c5 <__rodata_start+0x1f5>
+  8048c2:	80 00 00             	addb   $0x0,(%rax)
+  8048c5:	00 00                	add    %al,(%rax)
+  8048c7:	00 21                	add    %ah,(%rcx)
+  8048c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048cf:	00 11                	add    %dl,(%rcx)
+  8048d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048d7:	00 21                	add    %ah,(%rcx)
+  8048d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048df:	00 21                	add    %ah,(%rcx)
+  8048e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048e7:	00 21                	add    %ah,(%rcx)
+  8048e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048ef:	00 21                	add    %ah,(%rcx)
+  8048f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8048f7:	00 ff                	add    %bh,%bh
+  8048f9:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  8048ff:	00 21                	add    %ah,(%rcx)
+  804901:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804907:	00 21                	add    %ah,(%rcx)
+  804909:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80490f:	00 f3                	add    %dh,%bl
+  804911:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  804917:	00 6d 04             	add    %ch,0x4(%rbp)
+  80491a:	80 00 00             	addb   $0x0,(%rax)
+  80491d:	00 00                	add    %al,(%rax)
+  80491f:	00 21                	add    %ah,(%rcx)
+  804921:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804927:	00 f3                	add    %dh,%bl
+  804929:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+  80492f:	00 39                	add    %bh,(%rcx)
+  804931:	04 80                	add    $0x80,%al
+  804933:	00 00                	add    %al,(%rax)
+  804935:	00 00                	add    %al,(%rax)
+  804937:	00 39                	add    %bh,(%rcx)
+  804939:	04 80                	add    $0x80,%al
+  80493b:	00 00                	add    %al,(%rax)
+  80493d:	00 00                	add    %al,(%rax)
+  80493f:	00 39                	add    %bh,(%rcx)
+  804941:	04 80                	add    $0x80,%al
+  804943:	00 00                	add    %al,(%rax)
+  804945:	00 00                	add    %al,(%rax)
+  804947:	00 39                	add    %bh,(%rcx)
+  804949:	04 80                	add    $0x80,%al
+  80494b:	00 00                	add    %al,(%rax)
+  80494d:	00 00                	add    %al,(%rax)
+  80494f:	00 39                	add    %bh,(%rcx)
+  804951:	04 80                	add    $0x80,%al
+  804953:	00 00                	add    %al,(%rax)
+  804955:	00 00                	add    %al,(%rax)
+  804957:	00 39                	add    %bh,(%rcx)
+  804959:	04 80                	add    $0x80,%al
+  80495b:	00 00                	add    %al,(%rax)
+  80495d:	00 00                	add    %al,(%rax)
+  80495f:	00 39                	add    %bh,(%rcx)
+  804961:	04 80                	add    $0x80,%al
+  804963:	00 00                	add    %al,(%rax)
+  804965:	00 00                	add    %al,(%rax)
+  804967:	00 39                	add    %bh,(%rcx)
+  804969:	04 80                	add    $0x80,%al
+  80496b:	00 00                	add    %al,(%rax)
+  80496d:	00 00                	add    %al,(%rax)
+  80496f:	00 39                	add    %bh,(%rcx)
+  804971:	04 80                	add    $0x80,%al
+  804973:	00 00                	add    %al,(%rax)
+  804975:	00 00                	add    %al,(%rax)
+  804977:	00 21                	add    %ah,(%rcx)
+  804979:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80497f:	00 21                	add    %ah,(%rcx)
+  804981:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804987:	00 21                	add    %ah,(%rcx)
+  804989:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80498f:	00 21                	add    %ah,(%rcx)
+  804991:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804997:	00 21                	add    %ah,(%rcx)
+  804999:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80499f:	00 21                	add    %ah,(%rcx)
+  8049a1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049a7:	00 21                	add    %ah,(%rcx)
+  8049a9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049af:	00 21                	add    %ah,(%rcx)
+  8049b1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049b7:	00 21                	add    %ah,(%rcx)
+  8049b9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049bf:	00 21                	add    %ah,(%rcx)
+  8049c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049c7:	00 21                	add    %ah,(%rcx)
+  8049c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049cf:	00 21                	add    %ah,(%rcx)
+  8049d1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049d7:	00 21                	add    %ah,(%rcx)
+  8049d9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049df:	00 21                	add    %ah,(%rcx)
+  8049e1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049e7:	00 21                	add    %ah,(%rcx)
+  8049e9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ef:	00 21                	add    %ah,(%rcx)
+  8049f1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049f7:	00 21                	add    %ah,(%rcx)
+  8049f9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8049ff:	00 21                	add    %ah,(%rcx)
+  804a01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a07:	00 21                	add    %ah,(%rcx)
+  804a09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a0f:	00 21                	add    %ah,(%rcx)
+  804a11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a17:	00 21                	add    %ah,(%rcx)
+  804a19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a1f:	00 21                	add    %ah,(%rcx)
+  804a21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a27:	00 21                	add    %ah,(%rcx)
+  804a29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a2f:	00 21                	add    %ah,(%rcx)
+  804a31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a37:	00 21                	add    %ah,(%rcx)
+  804a39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a3f:	00 21                	add    %ah,(%rcx)
+  804a41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a47:	00 21                	add    %ah,(%rcx)
+  804a49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a4f:	00 21                	add    %ah,(%rcx)
+  804a51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a57:	00 21                	add    %ah,(%rcx)
+  804a59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a5f:	00 21                	add    %ah,(%rcx)
+  804a61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a67:	00 44 09 80          	add    %al,-0x80(%rcx,%rcx,1)
+  804a6b:	00 00                	add    %al,(%rax)
+  804a6d:	00 00                	add    %al,(%rax)
+  804a6f:	00 21                	add    %ah,(%rcx)
+  804a71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a77:	00 21                	add    %ah,(%rcx)
+  804a79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a7f:	00 21                	add    %ah,(%rcx)
+  804a81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a87:	00 21                	add    %ah,(%rcx)
+  804a89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a8f:	00 21                	add    %ah,(%rcx)
+  804a91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a97:	00 21                	add    %ah,(%rcx)
+  804a99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804a9f:	00 21                	add    %ah,(%rcx)
+  804aa1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aa7:	00 21                	add    %ah,(%rcx)
+  804aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aaf:	00 21                	add    %ah,(%rcx)
+  804ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ab7:	00 21                	add    %ah,(%rcx)
+  804ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804abf:	00 90 04 80 00 00    	add    %dl,0x8004(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 5f 06             	add    %bl,0x6(%rdi)
+  804aca:	80 00 00             	addb   $0x0,(%rax)
+  804acd:	00 00                	add    %al,(%rax)
+  804acf:	00 21                	add    %ah,(%rcx)
+  804ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ad7:	00 21                	add    %ah,(%rcx)
+  804ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804adf:	00 21                	add    %ah,(%rcx)
+  804ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ae7:	00 21                	add    %ah,(%rcx)
+  804ae9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aef:	00 bf 04 80 00 00    	add    %bh,0x8004(%rdi)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 21                	add    %ah,(%rcx)
+  804af9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aff:	00 21                	add    %ah,(%rcx)
+  804b01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b07:	00 85 04 80 00 00    	add    %al,0x8004(%rbp)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 21                	add    %ah,(%rcx)
+  804b11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b17:	00 21                	add    %ah,(%rcx)
+  804b19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b1f:	00 07                	add    %al,(%rdi)
+  804b21:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804b27:	00 d1                	add    %dl,%cl
+  804b29:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804b2f:	00 21                	add    %ah,(%rcx)
+  804b31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b37:	00 21                	add    %ah,(%rcx)
+  804b39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b3f:	00 56 05             	add    %dl,0x5(%rsi)
+  804b42:	80 00 00             	addb   $0x0,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 21                	add    %ah,(%rcx)
+  804b49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b4f:	00 33                	add    %dh,(%rbx)
+  804b51:	07                   	(bad)
+  804b52:	80 00 00             	addb   $0x0,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 21                	add    %ah,(%rcx)
+  804b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b5f:	00 21                	add    %ah,(%rcx)
+  804b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b67:	00 44 09 80          	add    %al,-0x80(%rcx,%rcx,1)
+  804b6b:	00 00                	add    %al,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 21                	add    %ah,(%rcx)
+  804b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b77:	00 e9                	add    %ch,%cl
+  804b79:	03 80 00 00 00 00    	add    0x0(%rax),%eax
+	...
+
+0000000000804b80 <error_string>:
+	...
+  804b88:	31 47 80 00 00 00 00 00 43 47 80 00 00 00 00 00     1G......CG......
+  804b98:	53 47 80 00 00 00 00 00 65 47 80 00 00 00 00 00     SG......eG......
+  804ba8:	73 47 80 00 00 00 00 00 87 47 80 00 00 00 00 00     sG.......G......
+  804bb8:	9c 47 80 00 00 00 00 00 af 47 80 00 00 00 00 00     .G.......G......
+  804bc8:	c1 47 80 00 00 00 00 00 d5 47 80 00 00 00 00 00     .G.......G......
+  804bd8:	e5 47 80 00 00 00 00 00 f8 47 80 00 00 00 00 00     .G.......G......
+  804be8:	0f 48 80 00 00 00 00 00 25 48 80 00 00 00 00 00     .H......%H......
+  804bf8:	3d 48 80 00 00 00 00 00 55 48 80 00 00 00 00 00     =H......UH......
+  804c08:	62 48 80 00 00 00 00 00 38 4c 80 00 00 00 00 00     bH......8L......
+  804c18:	76 48 80 00 00 00 00 00 8e 48 80 00 00 00 00 00     vH.......H......
+  804c28:	98 48 80 00 00 00 00 00 a2 48 80 00 00 00 00 00     .H.......H......
+  804c38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804c48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804c58:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804c68:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804c78:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  804c88:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  804c98:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  804ca8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  804cb8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  804cc8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  804cd8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  804ce8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  804cf8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  804d08:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804d18:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000804d20 <devtab>:
+  804d20:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804d30:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804d40:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804d50:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804d60:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804d70:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804d80:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804d90:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804da0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804db0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804dc0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804dd0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  804de0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  804df0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  804e00:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  804e10:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  804e20:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  804e30:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  804e40:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  804e50:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  804e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
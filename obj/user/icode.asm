@@ -0,0 +1,9460 @@
+
+obj/user/icode:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 c9 01 00 00       	call   8001ec <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 81 ec 18 02 00 00 	sub    $0x218,%rsp
+    int fd, n, r;
+    char buf[512 + 1];
+
+    binaryname = "icode";
+  800035:	48 b8 98 53 80 00 00 	movabs $0x805398,%rax
+  80003c:	00 00 00 
+  80003f:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800046:	00 00 00 
+
+    cprintf("icode startup\n");
+  800049:	48 bf 9e 53 80 00 00 	movabs $0x80539e,%rdi
+  800050:	00 00 00 
+  800053:	b8 00 00 00 00       	mov    $0x0,%eax
+  800058:	48 bb 12 04 80 00 00 	movabs $0x800412,%rbx
+  80005f:	00 00 00 
+  800062:	ff d3                	call   *%rbx
+
+    cprintf("icode: open /motd\n");
+  800064:	48 bf ad 53 80 00 00 	movabs $0x8053ad,%rdi
+  80006b:	00 00 00 
+  80006e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800073:	ff d3                	call   *%rbx
+    if ((fd = open("/motd", O_RDONLY)) < 0)
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 bf c0 53 80 00 00 	movabs $0x8053c0,%rdi
+  800081:	00 00 00 
+  800084:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  80008b:	00 00 00 
+  80008e:	ff d0                	call   *%rax
+  800090:	89 c3                	mov    %eax,%ebx
+  800092:	85 c0                	test   %eax,%eax
+  800094:	78 31                	js     8000c7 <umain+0xa2>
+        panic("icode: open /motd: %i", fd);
+
+    cprintf("icode: read /motd\n");
+  800096:	48 bf e9 53 80 00 00 	movabs $0x8053e9,%rdi
+  80009d:	00 00 00 
+  8000a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a5:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  8000ac:	00 00 00 
+  8000af:	ff d2                	call   *%rdx
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000b1:	49 bc 3a 1a 80 00 00 	movabs $0x801a3a,%r12
+  8000b8:	00 00 00 
+        sys_cputs(buf, n);
+  8000bb:	49 bd 5e 11 80 00 00 	movabs $0x80115e,%r13
+  8000c2:	00 00 00 
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  8000c5:	eb 3a                	jmp    800101 <umain+0xdc>
+        panic("icode: open /motd: %i", fd);
+  8000c7:	89 c1                	mov    %eax,%ecx
+  8000c9:	48 ba c6 53 80 00 00 	movabs $0x8053c6,%rdx
+  8000d0:	00 00 00 
+  8000d3:	be 0e 00 00 00       	mov    $0xe,%esi
+  8000d8:	48 bf dc 53 80 00 00 	movabs $0x8053dc,%rdi
+  8000df:	00 00 00 
+  8000e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000e7:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  8000ee:	00 00 00 
+  8000f1:	41 ff d0             	call   *%r8
+        sys_cputs(buf, n);
+  8000f4:	48 63 f0             	movslq %eax,%rsi
+  8000f7:	48 8d bd df fd ff ff 	lea    -0x221(%rbp),%rdi
+  8000fe:	41 ff d5             	call   *%r13
+    while ((n = read(fd, buf, sizeof buf - 1)) > 0)
+  800101:	ba 00 02 00 00       	mov    $0x200,%edx
+  800106:	48 8d b5 df fd ff ff 	lea    -0x221(%rbp),%rsi
+  80010d:	89 df                	mov    %ebx,%edi
+  80010f:	41 ff d4             	call   *%r12
+  800112:	85 c0                	test   %eax,%eax
+  800114:	7f de                	jg     8000f4 <umain+0xcf>
+
+    cprintf("icode: close /motd\n");
+  800116:	48 bf fc 53 80 00 00 	movabs $0x8053fc,%rdi
+  80011d:	00 00 00 
+  800120:	b8 00 00 00 00       	mov    $0x0,%eax
+  800125:	49 bc 12 04 80 00 00 	movabs $0x800412,%r12
+  80012c:	00 00 00 
+  80012f:	41 ff d4             	call   *%r12
+    close(fd);
+  800132:	89 df                	mov    %ebx,%edi
+  800134:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80013b:	00 00 00 
+  80013e:	ff d0                	call   *%rax
+
+    cprintf("icode: spawn /init\n");
+  800140:	48 bf 10 54 80 00 00 	movabs $0x805410,%rdi
+  800147:	00 00 00 
+  80014a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014f:	41 ff d4             	call   *%r12
+    if ((r = spawnl("/init", "init", "initarg1", "initarg2", (char *)0)) < 0)
+  800152:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800158:	48 b9 24 54 80 00 00 	movabs $0x805424,%rcx
+  80015f:	00 00 00 
+  800162:	48 ba 2d 54 80 00 00 	movabs $0x80542d,%rdx
+  800169:	00 00 00 
+  80016c:	48 be 37 54 80 00 00 	movabs $0x805437,%rsi
+  800173:	00 00 00 
+  800176:	48 bf 36 54 80 00 00 	movabs $0x805436,%rdi
+  80017d:	00 00 00 
+  800180:	b8 00 00 00 00       	mov    $0x0,%eax
+  800185:	49 b9 73 3f 80 00 00 	movabs $0x803f73,%r9
+  80018c:	00 00 00 
+  80018f:	41 ff d1             	call   *%r9
+  800192:	85 c0                	test   %eax,%eax
+  800194:	78 29                	js     8001bf <umain+0x19a>
+        panic("icode: spawn /init: %i", r);
+
+    cprintf("icode: exiting\n");
+  800196:	48 bf 53 54 80 00 00 	movabs $0x805453,%rdi
+  80019d:	00 00 00 
+  8001a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a5:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  8001ac:	00 00 00 
+  8001af:	ff d2                	call   *%rdx
+}
+  8001b1:	48 81 c4 18 02 00 00 	add    $0x218,%rsp
+  8001b8:	5b                   	pop    %rbx
+  8001b9:	41 5c                	pop    %r12
+  8001bb:	41 5d                	pop    %r13
+  8001bd:	5d                   	pop    %rbp
+  8001be:	c3                   	ret
+        panic("icode: spawn /init: %i", r);
+  8001bf:	89 c1                	mov    %eax,%ecx
+  8001c1:	48 ba 3c 54 80 00 00 	movabs $0x80543c,%rdx
+  8001c8:	00 00 00 
+  8001cb:	be 19 00 00 00       	mov    $0x19,%esi
+  8001d0:	48 bf dc 53 80 00 00 	movabs $0x8053dc,%rdi
+  8001d7:	00 00 00 
+  8001da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001df:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  8001e6:	00 00 00 
+  8001e9:	41 ff d0             	call   *%r8
+
+00000000008001ec <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8001ec:	55                   	push   %rbp
+  8001ed:	48 89 e5             	mov    %rsp,%rbp
+  8001f0:	41 56                	push   %r14
+  8001f2:	41 55                	push   %r13
+  8001f4:	41 54                	push   %r12
+  8001f6:	53                   	push   %rbx
+  8001f7:	41 89 fd             	mov    %edi,%r13d
+  8001fa:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001fd:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800204:	00 00 00 
+  800207:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80020e:	00 00 00 
+  800211:	48 39 c2             	cmp    %rax,%rdx
+  800214:	73 17                	jae    80022d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800216:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800219:	49 89 c4             	mov    %rax,%r12
+  80021c:	48 83 c3 08          	add    $0x8,%rbx
+  800220:	b8 00 00 00 00       	mov    $0x0,%eax
+  800225:	ff 53 f8             	call   *-0x8(%rbx)
+  800228:	4c 39 e3             	cmp    %r12,%rbx
+  80022b:	72 ef                	jb     80021c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80022d:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  800234:	00 00 00 
+  800237:	ff d0                	call   *%rax
+  800239:	89 c2                	mov    %eax,%edx
+  80023b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800241:	48 89 d0             	mov    %rdx,%rax
+  800244:	48 c1 e0 04          	shl    $0x4,%rax
+  800248:	48 29 d0             	sub    %rdx,%rax
+  80024b:	48 c1 e0 05          	shl    $0x5,%rax
+  80024f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800256:	00 00 00 
+  800259:	48 01 d0             	add    %rdx,%rax
+  80025c:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800263:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800266:	45 85 ed             	test   %r13d,%r13d
+  800269:	7e 0d                	jle    800278 <libmain+0x8c>
+  80026b:	49 8b 06             	mov    (%r14),%rax
+  80026e:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800275:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800278:	4c 89 f6             	mov    %r14,%rsi
+  80027b:	44 89 ef             	mov    %r13d,%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80028a:	48 b8 9f 02 80 00 00 	movabs $0x80029f,%rax
+  800291:	00 00 00 
+  800294:	ff d0                	call   *%rax
+#endif
+}
+  800296:	5b                   	pop    %rbx
+  800297:	41 5c                	pop    %r12
+  800299:	41 5d                	pop    %r13
+  80029b:	41 5e                	pop    %r14
+  80029d:	5d                   	pop    %rbp
+  80029e:	c3                   	ret
+
+000000000080029f <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80029f:	55                   	push   %rbp
+  8002a0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002a3:	48 b8 ef 18 80 00 00 	movabs $0x8018ef,%rax
+  8002aa:	00 00 00 
+  8002ad:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002b4:	48 b8 a6 11 80 00 00 	movabs $0x8011a6,%rax
+  8002bb:	00 00 00 
+  8002be:	ff d0                	call   *%rax
+}
+  8002c0:	5d                   	pop    %rbp
+  8002c1:	c3                   	ret
+
+00000000008002c2 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8002c2:	55                   	push   %rbp
+  8002c3:	48 89 e5             	mov    %rsp,%rbp
+  8002c6:	41 56                	push   %r14
+  8002c8:	41 55                	push   %r13
+  8002ca:	41 54                	push   %r12
+  8002cc:	53                   	push   %rbx
+  8002cd:	48 83 ec 50          	sub    $0x50,%rsp
+  8002d1:	49 89 fc             	mov    %rdi,%r12
+  8002d4:	41 89 f5             	mov    %esi,%r13d
+  8002d7:	48 89 d3             	mov    %rdx,%rbx
+  8002da:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8002de:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8002e2:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8002e6:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8002ed:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002f1:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8002f5:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8002f9:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8002fd:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800304:	00 00 00 
+  800307:	4c 8b 30             	mov    (%rax),%r14
+  80030a:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  800311:	00 00 00 
+  800314:	ff d0                	call   *%rax
+  800316:	89 c6                	mov    %eax,%esi
+  800318:	45 89 e8             	mov    %r13d,%r8d
+  80031b:	4c 89 e1             	mov    %r12,%rcx
+  80031e:	4c 89 f2             	mov    %r14,%rdx
+  800321:	48 bf 70 54 80 00 00 	movabs $0x805470,%rdi
+  800328:	00 00 00 
+  80032b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800330:	49 bc 12 04 80 00 00 	movabs $0x800412,%r12
+  800337:	00 00 00 
+  80033a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80033d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800341:	48 89 df             	mov    %rbx,%rdi
+  800344:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  80034b:	00 00 00 
+  80034e:	ff d0                	call   *%rax
+    cprintf("\n");
+  800350:	48 bf fa 53 80 00 00 	movabs $0x8053fa,%rdi
+  800357:	00 00 00 
+  80035a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80035f:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800362:	cc                   	int3
+  800363:	eb fd                	jmp    800362 <_panic+0xa0>
+
+0000000000800365 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800365:	55                   	push   %rbp
+  800366:	48 89 e5             	mov    %rsp,%rbp
+  800369:	53                   	push   %rbx
+  80036a:	48 83 ec 08          	sub    $0x8,%rsp
+  80036e:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800371:	8b 06                	mov    (%rsi),%eax
+  800373:	8d 50 01             	lea    0x1(%rax),%edx
+  800376:	89 16                	mov    %edx,(%rsi)
+  800378:	48 98                	cltq
+  80037a:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80037f:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800385:	74 0a                	je     800391 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800387:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80038b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80038f:	c9                   	leave
+  800390:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800391:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800395:	be ff 00 00 00       	mov    $0xff,%esi
+  80039a:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003a6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003ac:	eb d9                	jmp    800387 <putch+0x22>
+
+00000000008003ae <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003ae:	55                   	push   %rbp
+  8003af:	48 89 e5             	mov    %rsp,%rbp
+  8003b2:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8003b9:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8003bc:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8003c3:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8003c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cd:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8003d0:	48 89 f1             	mov    %rsi,%rcx
+  8003d3:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8003da:	48 bf 65 03 80 00 00 	movabs $0x800365,%rdi
+  8003e1:	00 00 00 
+  8003e4:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  8003eb:	00 00 00 
+  8003ee:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8003f0:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8003f7:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8003fe:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  800405:	00 00 00 
+  800408:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80040a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800410:	c9                   	leave
+  800411:	c3                   	ret
+
+0000000000800412 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800412:	55                   	push   %rbp
+  800413:	48 89 e5             	mov    %rsp,%rbp
+  800416:	48 83 ec 50          	sub    $0x50,%rsp
+  80041a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80041e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800422:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800426:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80042a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80042e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800435:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800439:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800441:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800445:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800449:	48 b8 ae 03 80 00 00 	movabs $0x8003ae,%rax
+  800450:	00 00 00 
+  800453:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800455:	c9                   	leave
+  800456:	c3                   	ret
+
+0000000000800457 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800457:	55                   	push   %rbp
+  800458:	48 89 e5             	mov    %rsp,%rbp
+  80045b:	41 57                	push   %r15
+  80045d:	41 56                	push   %r14
+  80045f:	41 55                	push   %r13
+  800461:	41 54                	push   %r12
+  800463:	53                   	push   %rbx
+  800464:	48 83 ec 18          	sub    $0x18,%rsp
+  800468:	49 89 fc             	mov    %rdi,%r12
+  80046b:	49 89 f5             	mov    %rsi,%r13
+  80046e:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800472:	8b 45 10             	mov    0x10(%rbp),%eax
+  800475:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800478:	41 89 cf             	mov    %ecx,%r15d
+  80047b:	4c 39 fa             	cmp    %r15,%rdx
+  80047e:	73 5b                	jae    8004db <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800480:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800484:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800488:	85 db                	test   %ebx,%ebx
+  80048a:	7e 0e                	jle    80049a <print_num+0x43>
+            putch(padc, put_arg);
+  80048c:	4c 89 ee             	mov    %r13,%rsi
+  80048f:	44 89 f7             	mov    %r14d,%edi
+  800492:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800495:	83 eb 01             	sub    $0x1,%ebx
+  800498:	75 f2                	jne    80048c <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80049a:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80049e:	48 b9 a4 54 80 00 00 	movabs $0x8054a4,%rcx
+  8004a5:	00 00 00 
+  8004a8:	48 b8 93 54 80 00 00 	movabs $0x805493,%rax
+  8004af:	00 00 00 
+  8004b2:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8004b6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004bf:	49 f7 f7             	div    %r15
+  8004c2:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8004c6:	4c 89 ee             	mov    %r13,%rsi
+  8004c9:	41 ff d4             	call   *%r12
+}
+  8004cc:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8004d0:	5b                   	pop    %rbx
+  8004d1:	41 5c                	pop    %r12
+  8004d3:	41 5d                	pop    %r13
+  8004d5:	41 5e                	pop    %r14
+  8004d7:	41 5f                	pop    %r15
+  8004d9:	5d                   	pop    %rbp
+  8004da:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8004db:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8004df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e4:	49 f7 f7             	div    %r15
+  8004e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004eb:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8004ef:	52                   	push   %rdx
+  8004f0:	45 0f be c9          	movsbl %r9b,%r9d
+  8004f4:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8004f8:	48 89 c2             	mov    %rax,%rdx
+  8004fb:	48 b8 57 04 80 00 00 	movabs $0x800457,%rax
+  800502:	00 00 00 
+  800505:	ff d0                	call   *%rax
+  800507:	48 83 c4 10          	add    $0x10,%rsp
+  80050b:	eb 8d                	jmp    80049a <print_num+0x43>
+
+000000000080050d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80050d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800511:	48 8b 06             	mov    (%rsi),%rax
+  800514:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800518:	73 0a                	jae    800524 <sprintputch+0x17>
+        *state->start++ = ch;
+  80051a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80051e:	48 89 16             	mov    %rdx,(%rsi)
+  800521:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800524:	c3                   	ret
+
+0000000000800525 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800525:	55                   	push   %rbp
+  800526:	48 89 e5             	mov    %rsp,%rbp
+  800529:	48 83 ec 50          	sub    $0x50,%rsp
+  80052d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800531:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800535:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800539:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800540:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800544:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800548:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80054c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800550:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800554:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  80055b:	00 00 00 
+  80055e:	ff d0                	call   *%rax
+}
+  800560:	c9                   	leave
+  800561:	c3                   	ret
+
+0000000000800562 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800562:	55                   	push   %rbp
+  800563:	48 89 e5             	mov    %rsp,%rbp
+  800566:	41 57                	push   %r15
+  800568:	41 56                	push   %r14
+  80056a:	41 55                	push   %r13
+  80056c:	41 54                	push   %r12
+  80056e:	53                   	push   %rbx
+  80056f:	48 83 ec 38          	sub    $0x38,%rsp
+  800573:	49 89 fe             	mov    %rdi,%r14
+  800576:	49 89 f5             	mov    %rsi,%r13
+  800579:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80057c:	48 8b 01             	mov    (%rcx),%rax
+  80057f:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800583:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800587:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058b:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80058f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800593:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800597:	0f b6 3b             	movzbl (%rbx),%edi
+  80059a:	40 80 ff 25          	cmp    $0x25,%dil
+  80059e:	74 18                	je     8005b8 <vprintfmt+0x56>
+            if (!ch) return;
+  8005a0:	40 84 ff             	test   %dil,%dil
+  8005a3:	0f 84 b1 06 00 00    	je     800c5a <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005a9:	40 0f b6 ff          	movzbl %dil,%edi
+  8005ad:	4c 89 ee             	mov    %r13,%rsi
+  8005b0:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8005b3:	4c 89 e3             	mov    %r12,%rbx
+  8005b6:	eb db                	jmp    800593 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8005b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8005bd:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8005c1:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8005c6:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005cc:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8005d3:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005d7:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8005dc:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8005e1:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8005e4:	83 e8 23             	sub    $0x23,%eax
+  8005e7:	3c 57                	cmp    $0x57,%al
+  8005e9:	0f 87 51 06 00 00    	ja     800c40 <vprintfmt+0x6de>
+  8005ef:	0f b6 c0             	movzbl %al,%eax
+  8005f2:	48 b9 60 56 80 00 00 	movabs $0x805660,%rcx
+  8005f9:	00 00 00 
+  8005fc:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8005ff:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800602:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800606:	eb cf                	jmp    8005d7 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800608:	49 89 dc             	mov    %rbx,%r12
+  80060b:	be 01 00 00 00       	mov    $0x1,%esi
+  800610:	eb c5                	jmp    8005d7 <vprintfmt+0x75>
+            padc = ch;
+  800612:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800616:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800619:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80061c:	eb b9                	jmp    8005d7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80061e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800621:	83 f8 2f             	cmp    $0x2f,%eax
+  800624:	77 24                	ja     80064a <vprintfmt+0xe8>
+  800626:	89 c1                	mov    %eax,%ecx
+  800628:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80062c:	83 c0 08             	add    $0x8,%eax
+  80062f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800632:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800635:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800638:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80063c:	79 99                	jns    8005d7 <vprintfmt+0x75>
+                width = precision;
+  80063e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800642:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800648:	eb 8d                	jmp    8005d7 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80064a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80064e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800652:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800656:	eb da                	jmp    800632 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800658:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80065d:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800661:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800667:	3c 39                	cmp    $0x39,%al
+  800669:	77 1c                	ja     800687 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80066b:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80066f:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800673:	0f b6 c0             	movzbl %al,%eax
+  800676:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80067b:	0f b6 03             	movzbl (%rbx),%eax
+  80067e:	3c 39                	cmp    $0x39,%al
+  800680:	76 e9                	jbe    80066b <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800682:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800685:	eb b1                	jmp    800638 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800687:	49 89 dc             	mov    %rbx,%r12
+  80068a:	eb ac                	jmp    800638 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80068c:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80068f:	85 c9                	test   %ecx,%ecx
+  800691:	b8 00 00 00 00       	mov    $0x0,%eax
+  800696:	0f 49 c1             	cmovns %ecx,%eax
+  800699:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80069c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80069f:	e9 33 ff ff ff       	jmp    8005d7 <vprintfmt+0x75>
+            lflag++;
+  8006a4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006a7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006aa:	e9 28 ff ff ff       	jmp    8005d7 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006af:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006b2:	83 f8 2f             	cmp    $0x2f,%eax
+  8006b5:	77 19                	ja     8006d0 <vprintfmt+0x16e>
+  8006b7:	89 c2                	mov    %eax,%edx
+  8006b9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006bd:	83 c0 08             	add    $0x8,%eax
+  8006c0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8006c3:	8b 3a                	mov    (%rdx),%edi
+  8006c5:	4c 89 ee             	mov    %r13,%rsi
+  8006c8:	41 ff d6             	call   *%r14
+            break;
+  8006cb:	e9 c3 fe ff ff       	jmp    800593 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8006d0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006d4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006dc:	eb e5                	jmp    8006c3 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8006de:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8006e1:	83 f8 2f             	cmp    $0x2f,%eax
+  8006e4:	77 5a                	ja     800740 <vprintfmt+0x1de>
+  8006e6:	89 c2                	mov    %eax,%edx
+  8006e8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8006ec:	83 c0 08             	add    $0x8,%eax
+  8006ef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8006f2:	8b 02                	mov    (%rdx),%eax
+  8006f4:	89 c1                	mov    %eax,%ecx
+  8006f6:	f7 d9                	neg    %ecx
+  8006f8:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8006fb:	83 f9 16             	cmp    $0x16,%ecx
+  8006fe:	7f 4e                	jg     80074e <vprintfmt+0x1ec>
+  800700:	48 63 c1             	movslq %ecx,%rax
+  800703:	48 ba 20 59 80 00 00 	movabs $0x805920,%rdx
+  80070a:	00 00 00 
+  80070d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800711:	48 85 c0             	test   %rax,%rax
+  800714:	74 38                	je     80074e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800716:	48 89 c1             	mov    %rax,%rcx
+  800719:	48 ba c3 5b 80 00 00 	movabs $0x805bc3,%rdx
+  800720:	00 00 00 
+  800723:	4c 89 ee             	mov    %r13,%rsi
+  800726:	4c 89 f7             	mov    %r14,%rdi
+  800729:	b8 00 00 00 00       	mov    $0x0,%eax
+  80072e:	49 b8 25 05 80 00 00 	movabs $0x800525,%r8
+  800735:	00 00 00 
+  800738:	41 ff d0             	call   *%r8
+  80073b:	e9 53 fe ff ff       	jmp    800593 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800740:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800744:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800748:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80074c:	eb a4                	jmp    8006f2 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80074e:	48 ba bc 54 80 00 00 	movabs $0x8054bc,%rdx
+  800755:	00 00 00 
+  800758:	4c 89 ee             	mov    %r13,%rsi
+  80075b:	4c 89 f7             	mov    %r14,%rdi
+  80075e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800763:	49 b8 25 05 80 00 00 	movabs $0x800525,%r8
+  80076a:	00 00 00 
+  80076d:	41 ff d0             	call   *%r8
+  800770:	e9 1e fe ff ff       	jmp    800593 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800775:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800778:	83 f8 2f             	cmp    $0x2f,%eax
+  80077b:	77 6c                	ja     8007e9 <vprintfmt+0x287>
+  80077d:	89 c2                	mov    %eax,%edx
+  80077f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800783:	83 c0 08             	add    $0x8,%eax
+  800786:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800789:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80078c:	48 85 d2             	test   %rdx,%rdx
+  80078f:	48 b8 b5 54 80 00 00 	movabs $0x8054b5,%rax
+  800796:	00 00 00 
+  800799:	48 0f 45 c2          	cmovne %rdx,%rax
+  80079d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007a1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a5:	7e 06                	jle    8007ad <vprintfmt+0x24b>
+  8007a7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007ab:	75 4a                	jne    8007f7 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007ad:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8007b1:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8007b5:	0f b6 00             	movzbl (%rax),%eax
+  8007b8:	84 c0                	test   %al,%al
+  8007ba:	0f 85 9a 00 00 00    	jne    80085a <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8007c0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007c3:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8007c7:	85 c0                	test   %eax,%eax
+  8007c9:	0f 8e c4 fd ff ff    	jle    800593 <vprintfmt+0x31>
+  8007cf:	4c 89 ee             	mov    %r13,%rsi
+  8007d2:	bf 20 00 00 00       	mov    $0x20,%edi
+  8007d7:	41 ff d6             	call   *%r14
+  8007da:	41 83 ec 01          	sub    $0x1,%r12d
+  8007de:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8007e2:	75 eb                	jne    8007cf <vprintfmt+0x26d>
+  8007e4:	e9 aa fd ff ff       	jmp    800593 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007e9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007ed:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007f5:	eb 92                	jmp    800789 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8007f7:	49 63 f7             	movslq %r15d,%rsi
+  8007fa:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8007fe:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  800805:	00 00 00 
+  800808:	ff d0                	call   *%rax
+  80080a:	48 89 c2             	mov    %rax,%rdx
+  80080d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800810:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800812:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800815:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800818:	85 c0                	test   %eax,%eax
+  80081a:	7e 91                	jle    8007ad <vprintfmt+0x24b>
+  80081c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800821:	4c 89 ee             	mov    %r13,%rsi
+  800824:	44 89 e7             	mov    %r12d,%edi
+  800827:	41 ff d6             	call   *%r14
+  80082a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80082e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800831:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800834:	75 eb                	jne    800821 <vprintfmt+0x2bf>
+  800836:	e9 72 ff ff ff       	jmp    8007ad <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80083b:	0f b6 f8             	movzbl %al,%edi
+  80083e:	4c 89 ee             	mov    %r13,%rsi
+  800841:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800844:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800848:	49 83 c4 01          	add    $0x1,%r12
+  80084c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800852:	84 c0                	test   %al,%al
+  800854:	0f 84 66 ff ff ff    	je     8007c0 <vprintfmt+0x25e>
+  80085a:	45 85 ff             	test   %r15d,%r15d
+  80085d:	78 0a                	js     800869 <vprintfmt+0x307>
+  80085f:	41 83 ef 01          	sub    $0x1,%r15d
+  800863:	0f 88 57 ff ff ff    	js     8007c0 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800869:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80086d:	74 cc                	je     80083b <vprintfmt+0x2d9>
+  80086f:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800872:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800877:	80 fa 5e             	cmp    $0x5e,%dl
+  80087a:	77 c2                	ja     80083e <vprintfmt+0x2dc>
+  80087c:	eb bd                	jmp    80083b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80087e:	40 84 f6             	test   %sil,%sil
+  800881:	75 26                	jne    8008a9 <vprintfmt+0x347>
+    switch (lflag) {
+  800883:	85 d2                	test   %edx,%edx
+  800885:	74 59                	je     8008e0 <vprintfmt+0x37e>
+  800887:	83 fa 01             	cmp    $0x1,%edx
+  80088a:	74 7b                	je     800907 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80088c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088f:	83 f8 2f             	cmp    $0x2f,%eax
+  800892:	0f 87 96 00 00 00    	ja     80092e <vprintfmt+0x3cc>
+  800898:	89 c2                	mov    %eax,%edx
+  80089a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089e:	83 c0 08             	add    $0x8,%eax
+  8008a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a4:	4c 8b 22             	mov    (%rdx),%r12
+  8008a7:	eb 17                	jmp    8008c0 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008a9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ac:	83 f8 2f             	cmp    $0x2f,%eax
+  8008af:	77 21                	ja     8008d2 <vprintfmt+0x370>
+  8008b1:	89 c2                	mov    %eax,%edx
+  8008b3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b7:	83 c0 08             	add    $0x8,%eax
+  8008ba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008bd:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8008c0:	4d 85 e4             	test   %r12,%r12
+  8008c3:	78 7a                	js     80093f <vprintfmt+0x3dd>
+            num = i;
+  8008c5:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8008c8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8008cd:	e9 50 02 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008de:	eb dd                	jmp    8008bd <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8008e0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e3:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e6:	77 11                	ja     8008f9 <vprintfmt+0x397>
+  8008e8:	89 c2                	mov    %eax,%edx
+  8008ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ee:	83 c0 08             	add    $0x8,%eax
+  8008f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f4:	4c 63 22             	movslq (%rdx),%r12
+  8008f7:	eb c7                	jmp    8008c0 <vprintfmt+0x35e>
+  8008f9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008fd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800901:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800905:	eb ed                	jmp    8008f4 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800907:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090a:	83 f8 2f             	cmp    $0x2f,%eax
+  80090d:	77 11                	ja     800920 <vprintfmt+0x3be>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	4c 8b 22             	mov    (%rdx),%r12
+  80091e:	eb a0                	jmp    8008c0 <vprintfmt+0x35e>
+  800920:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800924:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800928:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092c:	eb ed                	jmp    80091b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80092e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800932:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800936:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093a:	e9 65 ff ff ff       	jmp    8008a4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80093f:	4c 89 ee             	mov    %r13,%rsi
+  800942:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800947:	41 ff d6             	call   *%r14
+                i = -i;
+  80094a:	49 f7 dc             	neg    %r12
+  80094d:	e9 73 ff ff ff       	jmp    8008c5 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800952:	40 84 f6             	test   %sil,%sil
+  800955:	75 32                	jne    800989 <vprintfmt+0x427>
+    switch (lflag) {
+  800957:	85 d2                	test   %edx,%edx
+  800959:	74 5d                	je     8009b8 <vprintfmt+0x456>
+  80095b:	83 fa 01             	cmp    $0x1,%edx
+  80095e:	0f 84 82 00 00 00    	je     8009e6 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800964:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800967:	83 f8 2f             	cmp    $0x2f,%eax
+  80096a:	0f 87 a5 00 00 00    	ja     800a15 <vprintfmt+0x4b3>
+  800970:	89 c2                	mov    %eax,%edx
+  800972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800976:	83 c0 08             	add    $0x8,%eax
+  800979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80097f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800984:	e9 99 01 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098c:	83 f8 2f             	cmp    $0x2f,%eax
+  80098f:	77 19                	ja     8009aa <vprintfmt+0x448>
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800997:	83 c0 08             	add    $0x8,%eax
+  80099a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009a0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009a5:	e9 78 01 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+  8009aa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ae:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b6:	eb e5                	jmp    80099d <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8009b8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009be:	77 18                	ja     8009d8 <vprintfmt+0x476>
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c6:	83 c0 08             	add    $0x8,%eax
+  8009c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cc:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8009ce:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8009d3:	e9 4a 01 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	eb e6                	jmp    8009cc <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8009e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ec:	77 19                	ja     800a07 <vprintfmt+0x4a5>
+  8009ee:	89 c2                	mov    %eax,%edx
+  8009f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f4:	83 c0 08             	add    $0x8,%eax
+  8009f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009fa:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009fd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a02:	e9 1b 01 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+  800a07:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a13:	eb e5                	jmp    8009fa <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a15:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a19:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a21:	e9 56 ff ff ff       	jmp    80097c <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a26:	40 84 f6             	test   %sil,%sil
+  800a29:	75 2e                	jne    800a59 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a2b:	85 d2                	test   %edx,%edx
+  800a2d:	74 59                	je     800a88 <vprintfmt+0x526>
+  800a2f:	83 fa 01             	cmp    $0x1,%edx
+  800a32:	74 7f                	je     800ab3 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a37:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3a:	0f 87 9f 00 00 00    	ja     800adf <vprintfmt+0x57d>
+  800a40:	89 c2                	mov    %eax,%edx
+  800a42:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a46:	83 c0 08             	add    $0x8,%eax
+  800a49:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a4f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a54:	e9 c9 00 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5f:	77 19                	ja     800a7a <vprintfmt+0x518>
+  800a61:	89 c2                	mov    %eax,%edx
+  800a63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a67:	83 c0 08             	add    $0x8,%eax
+  800a6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a6d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a70:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a75:	e9 a8 00 00 00       	jmp    800b22 <vprintfmt+0x5c0>
+  800a7a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a7e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a86:	eb e5                	jmp    800a6d <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a88:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8e:	77 15                	ja     800aa5 <vprintfmt+0x543>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a9e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800aa3:	eb 7d                	jmp    800b22 <vprintfmt+0x5c0>
+  800aa5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aa9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab1:	eb e9                	jmp    800a9c <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ab3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ab6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ab9:	77 16                	ja     800ad1 <vprintfmt+0x56f>
+  800abb:	89 c2                	mov    %eax,%edx
+  800abd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac1:	83 c0 08             	add    $0x8,%eax
+  800ac4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ac7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800aca:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800acf:	eb 51                	jmp    800b22 <vprintfmt+0x5c0>
+  800ad1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800add:	eb e8                	jmp    800ac7 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800adf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aeb:	e9 5c ff ff ff       	jmp    800a4c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800af0:	4c 89 ee             	mov    %r13,%rsi
+  800af3:	bf 30 00 00 00       	mov    $0x30,%edi
+  800af8:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800afb:	4c 89 ee             	mov    %r13,%rsi
+  800afe:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b03:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b09:	83 f8 2f             	cmp    $0x2f,%eax
+  800b0c:	77 47                	ja     800b55 <vprintfmt+0x5f3>
+  800b0e:	89 c2                	mov    %eax,%edx
+  800b10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b14:	83 c0 08             	add    $0x8,%eax
+  800b17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b1a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b1d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b22:	48 83 ec 08          	sub    $0x8,%rsp
+  800b26:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b2a:	0f 94 c0             	sete   %al
+  800b2d:	0f b6 c0             	movzbl %al,%eax
+  800b30:	50                   	push   %rax
+  800b31:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b36:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b3a:	4c 89 ee             	mov    %r13,%rsi
+  800b3d:	4c 89 f7             	mov    %r14,%rdi
+  800b40:	48 b8 57 04 80 00 00 	movabs $0x800457,%rax
+  800b47:	00 00 00 
+  800b4a:	ff d0                	call   *%rax
+            break;
+  800b4c:	48 83 c4 10          	add    $0x10,%rsp
+  800b50:	e9 3e fa ff ff       	jmp    800593 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800b55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b61:	eb b7                	jmp    800b1a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b63:	40 84 f6             	test   %sil,%sil
+  800b66:	75 2b                	jne    800b93 <vprintfmt+0x631>
+    switch (lflag) {
+  800b68:	85 d2                	test   %edx,%edx
+  800b6a:	74 56                	je     800bc2 <vprintfmt+0x660>
+  800b6c:	83 fa 01             	cmp    $0x1,%edx
+  800b6f:	74 7f                	je     800bf0 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b71:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b74:	83 f8 2f             	cmp    $0x2f,%eax
+  800b77:	0f 87 a2 00 00 00    	ja     800c1f <vprintfmt+0x6bd>
+  800b7d:	89 c2                	mov    %eax,%edx
+  800b7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b83:	83 c0 08             	add    $0x8,%eax
+  800b86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b89:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b8c:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b91:	eb 8f                	jmp    800b22 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b93:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b96:	83 f8 2f             	cmp    $0x2f,%eax
+  800b99:	77 19                	ja     800bb4 <vprintfmt+0x652>
+  800b9b:	89 c2                	mov    %eax,%edx
+  800b9d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ba1:	83 c0 08             	add    $0x8,%eax
+  800ba4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800baa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800baf:	e9 6e ff ff ff       	jmp    800b22 <vprintfmt+0x5c0>
+  800bb4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bbc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bc0:	eb e5                	jmp    800ba7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800bc2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc8:	77 18                	ja     800be2 <vprintfmt+0x680>
+  800bca:	89 c2                	mov    %eax,%edx
+  800bcc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd0:	83 c0 08             	add    $0x8,%eax
+  800bd3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd6:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800bd8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800bdd:	e9 40 ff ff ff       	jmp    800b22 <vprintfmt+0x5c0>
+  800be2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800be6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bee:	eb e6                	jmp    800bd6 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800bf0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf3:	83 f8 2f             	cmp    $0x2f,%eax
+  800bf6:	77 19                	ja     800c11 <vprintfmt+0x6af>
+  800bf8:	89 c2                	mov    %eax,%edx
+  800bfa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bfe:	83 c0 08             	add    $0x8,%eax
+  800c01:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c04:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c07:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c0c:	e9 11 ff ff ff       	jmp    800b22 <vprintfmt+0x5c0>
+  800c11:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c15:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c19:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1d:	eb e5                	jmp    800c04 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2b:	e9 59 ff ff ff       	jmp    800b89 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c30:	4c 89 ee             	mov    %r13,%rsi
+  800c33:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c38:	41 ff d6             	call   *%r14
+            break;
+  800c3b:	e9 53 f9 ff ff       	jmp    800593 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c40:	4c 89 ee             	mov    %r13,%rsi
+  800c43:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c48:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c4b:	48 83 eb 01          	sub    $0x1,%rbx
+  800c4f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800c53:	75 f6                	jne    800c4b <vprintfmt+0x6e9>
+  800c55:	e9 39 f9 ff ff       	jmp    800593 <vprintfmt+0x31>
+}
+  800c5a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800c5e:	5b                   	pop    %rbx
+  800c5f:	41 5c                	pop    %r12
+  800c61:	41 5d                	pop    %r13
+  800c63:	41 5e                	pop    %r14
+  800c65:	41 5f                	pop    %r15
+  800c67:	5d                   	pop    %rbp
+  800c68:	c3                   	ret
+
+0000000000800c69 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c69:	55                   	push   %rbp
+  800c6a:	48 89 e5             	mov    %rsp,%rbp
+  800c6d:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c71:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c75:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c7a:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c7e:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c85:	48 85 ff             	test   %rdi,%rdi
+  800c88:	74 2b                	je     800cb5 <vsnprintf+0x4c>
+  800c8a:	48 85 f6             	test   %rsi,%rsi
+  800c8d:	74 26                	je     800cb5 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c8f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c93:	48 bf 0d 05 80 00 00 	movabs $0x80050d,%rdi
+  800c9a:	00 00 00 
+  800c9d:	48 b8 62 05 80 00 00 	movabs $0x800562,%rax
+  800ca4:	00 00 00 
+  800ca7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ca9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cad:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800cb0:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800cb3:	c9                   	leave
+  800cb4:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800cb5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cba:	eb f7                	jmp    800cb3 <vsnprintf+0x4a>
+
+0000000000800cbc <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800cbc:	55                   	push   %rbp
+  800cbd:	48 89 e5             	mov    %rsp,%rbp
+  800cc0:	48 83 ec 50          	sub    $0x50,%rsp
+  800cc4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800cc8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ccc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800cd0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800cd7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cdf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ce3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800ce7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ceb:	48 b8 69 0c 80 00 00 	movabs $0x800c69,%rax
+  800cf2:	00 00 00 
+  800cf5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800cf7:	c9                   	leave
+  800cf8:	c3                   	ret
+
+0000000000800cf9 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800cf9:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800cfc:	74 10                	je     800d0e <strlen+0x15>
+    size_t n = 0;
+  800cfe:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d03:	48 83 c0 01          	add    $0x1,%rax
+  800d07:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d0b:	75 f6                	jne    800d03 <strlen+0xa>
+  800d0d:	c3                   	ret
+    size_t n = 0;
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d13:	c3                   	ret
+
+0000000000800d14 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d14:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d17:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d1c:	48 85 f6             	test   %rsi,%rsi
+  800d1f:	74 11                	je     800d32 <strnlen+0x1e>
+  800d21:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d25:	74 0c                	je     800d33 <strnlen+0x1f>
+  800d27:	48 83 c2 01          	add    $0x1,%rdx
+  800d2b:	48 39 d0             	cmp    %rdx,%rax
+  800d2e:	75 f1                	jne    800d21 <strnlen+0xd>
+  800d30:	eb 04                	jmp    800d36 <strnlen+0x22>
+  800d32:	c3                   	ret
+  800d33:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d36:	c3                   	ret
+
+0000000000800d37 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d37:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d3a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d3f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d43:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d46:	48 83 c2 01          	add    $0x1,%rdx
+  800d4a:	84 c9                	test   %cl,%cl
+  800d4c:	75 f1                	jne    800d3f <strcpy+0x8>
+        ;
+    return res;
+}
+  800d4e:	c3                   	ret
+
+0000000000800d4f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d4f:	55                   	push   %rbp
+  800d50:	48 89 e5             	mov    %rsp,%rbp
+  800d53:	41 54                	push   %r12
+  800d55:	53                   	push   %rbx
+  800d56:	48 89 fb             	mov    %rdi,%rbx
+  800d59:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800d5c:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  800d63:	00 00 00 
+  800d66:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d68:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d6c:	4c 89 e6             	mov    %r12,%rsi
+  800d6f:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  800d76:	00 00 00 
+  800d79:	ff d0                	call   *%rax
+    return dst;
+}
+  800d7b:	48 89 d8             	mov    %rbx,%rax
+  800d7e:	5b                   	pop    %rbx
+  800d7f:	41 5c                	pop    %r12
+  800d81:	5d                   	pop    %rbp
+  800d82:	c3                   	ret
+
+0000000000800d83 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d83:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d86:	48 85 d2             	test   %rdx,%rdx
+  800d89:	74 1f                	je     800daa <strncpy+0x27>
+  800d8b:	48 01 fa             	add    %rdi,%rdx
+  800d8e:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d91:	48 83 c1 01          	add    $0x1,%rcx
+  800d95:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d99:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d9d:	41 80 f8 01          	cmp    $0x1,%r8b
+  800da1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800da5:	48 39 ca             	cmp    %rcx,%rdx
+  800da8:	75 e7                	jne    800d91 <strncpy+0xe>
+    }
+    return ret;
+}
+  800daa:	c3                   	ret
+
+0000000000800dab <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dab:	48 89 f8             	mov    %rdi,%rax
+  800dae:	48 85 d2             	test   %rdx,%rdx
+  800db1:	74 24                	je     800dd7 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800db3:	48 83 ea 01          	sub    $0x1,%rdx
+  800db7:	74 1b                	je     800dd4 <strlcpy+0x29>
+  800db9:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800dbd:	0f b6 16             	movzbl (%rsi),%edx
+  800dc0:	84 d2                	test   %dl,%dl
+  800dc2:	74 10                	je     800dd4 <strlcpy+0x29>
+            *dst++ = *src++;
+  800dc4:	48 83 c6 01          	add    $0x1,%rsi
+  800dc8:	48 83 c0 01          	add    $0x1,%rax
+  800dcc:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800dcf:	48 39 c8             	cmp    %rcx,%rax
+  800dd2:	75 e9                	jne    800dbd <strlcpy+0x12>
+        *dst = '\0';
+  800dd4:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800dd7:	48 29 f8             	sub    %rdi,%rax
+}
+  800dda:	c3                   	ret
+
+0000000000800ddb <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ddb:	0f b6 07             	movzbl (%rdi),%eax
+  800dde:	84 c0                	test   %al,%al
+  800de0:	74 13                	je     800df5 <strcmp+0x1a>
+  800de2:	38 06                	cmp    %al,(%rsi)
+  800de4:	75 0f                	jne    800df5 <strcmp+0x1a>
+  800de6:	48 83 c7 01          	add    $0x1,%rdi
+  800dea:	48 83 c6 01          	add    $0x1,%rsi
+  800dee:	0f b6 07             	movzbl (%rdi),%eax
+  800df1:	84 c0                	test   %al,%al
+  800df3:	75 ed                	jne    800de2 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800df5:	0f b6 c0             	movzbl %al,%eax
+  800df8:	0f b6 16             	movzbl (%rsi),%edx
+  800dfb:	29 d0                	sub    %edx,%eax
+}
+  800dfd:	c3                   	ret
+
+0000000000800dfe <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800dfe:	48 85 d2             	test   %rdx,%rdx
+  800e01:	74 1f                	je     800e22 <strncmp+0x24>
+  800e03:	0f b6 07             	movzbl (%rdi),%eax
+  800e06:	84 c0                	test   %al,%al
+  800e08:	74 1e                	je     800e28 <strncmp+0x2a>
+  800e0a:	3a 06                	cmp    (%rsi),%al
+  800e0c:	75 1a                	jne    800e28 <strncmp+0x2a>
+  800e0e:	48 83 c7 01          	add    $0x1,%rdi
+  800e12:	48 83 c6 01          	add    $0x1,%rsi
+  800e16:	48 83 ea 01          	sub    $0x1,%rdx
+  800e1a:	75 e7                	jne    800e03 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e21:	c3                   	ret
+  800e22:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e27:	c3                   	ret
+  800e28:	48 85 d2             	test   %rdx,%rdx
+  800e2b:	74 09                	je     800e36 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e2d:	0f b6 07             	movzbl (%rdi),%eax
+  800e30:	0f b6 16             	movzbl (%rsi),%edx
+  800e33:	29 d0                	sub    %edx,%eax
+  800e35:	c3                   	ret
+    if (!n) return 0;
+  800e36:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e3b:	c3                   	ret
+
+0000000000800e3c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e3c:	0f b6 17             	movzbl (%rdi),%edx
+  800e3f:	84 d2                	test   %dl,%dl
+  800e41:	74 18                	je     800e5b <strchr+0x1f>
+        if (*str == c) {
+  800e43:	0f be d2             	movsbl %dl,%edx
+  800e46:	39 f2                	cmp    %esi,%edx
+  800e48:	74 17                	je     800e61 <strchr+0x25>
+    for (; *str; str++) {
+  800e4a:	48 83 c7 01          	add    $0x1,%rdi
+  800e4e:	0f b6 17             	movzbl (%rdi),%edx
+  800e51:	84 d2                	test   %dl,%dl
+  800e53:	75 ee                	jne    800e43 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800e55:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e5a:	c3                   	ret
+  800e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e60:	c3                   	ret
+  800e61:	48 89 f8             	mov    %rdi,%rax
+}
+  800e64:	c3                   	ret
+
+0000000000800e65 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e65:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e68:	0f b6 17             	movzbl (%rdi),%edx
+  800e6b:	84 d2                	test   %dl,%dl
+  800e6d:	74 13                	je     800e82 <strfind+0x1d>
+  800e6f:	0f be d2             	movsbl %dl,%edx
+  800e72:	39 f2                	cmp    %esi,%edx
+  800e74:	74 0b                	je     800e81 <strfind+0x1c>
+  800e76:	48 83 c0 01          	add    $0x1,%rax
+  800e7a:	0f b6 10             	movzbl (%rax),%edx
+  800e7d:	84 d2                	test   %dl,%dl
+  800e7f:	75 ee                	jne    800e6f <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e81:	c3                   	ret
+  800e82:	c3                   	ret
+
+0000000000800e83 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e83:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e86:	48 89 f8             	mov    %rdi,%rax
+  800e89:	48 f7 d8             	neg    %rax
+  800e8c:	83 e0 07             	and    $0x7,%eax
+  800e8f:	49 89 d1             	mov    %rdx,%r9
+  800e92:	49 29 c1             	sub    %rax,%r9
+  800e95:	78 36                	js     800ecd <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e97:	40 0f b6 c6          	movzbl %sil,%eax
+  800e9b:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ea2:	01 01 01 
+  800ea5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ea9:	40 f6 c7 07          	test   $0x7,%dil
+  800ead:	75 38                	jne    800ee7 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800eaf:	4c 89 c9             	mov    %r9,%rcx
+  800eb2:	48 c1 f9 03          	sar    $0x3,%rcx
+  800eb6:	74 0c                	je     800ec4 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800eb8:	fc                   	cld
+  800eb9:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800ebc:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800ec0:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800ec4:	4d 85 c9             	test   %r9,%r9
+  800ec7:	75 45                	jne    800f0e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800ec9:	4c 89 c0             	mov    %r8,%rax
+  800ecc:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800ecd:	48 85 d2             	test   %rdx,%rdx
+  800ed0:	74 f7                	je     800ec9 <memset+0x46>
+  800ed2:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800ed5:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800ed8:	48 83 c0 01          	add    $0x1,%rax
+  800edc:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800ee0:	48 39 c2             	cmp    %rax,%rdx
+  800ee3:	75 f3                	jne    800ed8 <memset+0x55>
+  800ee5:	eb e2                	jmp    800ec9 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800ee7:	40 f6 c7 01          	test   $0x1,%dil
+  800eeb:	74 06                	je     800ef3 <memset+0x70>
+  800eed:	88 07                	mov    %al,(%rdi)
+  800eef:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800ef3:	40 f6 c7 02          	test   $0x2,%dil
+  800ef7:	74 07                	je     800f00 <memset+0x7d>
+  800ef9:	66 89 07             	mov    %ax,(%rdi)
+  800efc:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f00:	40 f6 c7 04          	test   $0x4,%dil
+  800f04:	74 a9                	je     800eaf <memset+0x2c>
+  800f06:	89 07                	mov    %eax,(%rdi)
+  800f08:	48 83 c7 04          	add    $0x4,%rdi
+  800f0c:	eb a1                	jmp    800eaf <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f0e:	41 f6 c1 04          	test   $0x4,%r9b
+  800f12:	74 06                	je     800f1a <memset+0x97>
+  800f14:	89 07                	mov    %eax,(%rdi)
+  800f16:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f1a:	41 f6 c1 02          	test   $0x2,%r9b
+  800f1e:	74 07                	je     800f27 <memset+0xa4>
+  800f20:	66 89 07             	mov    %ax,(%rdi)
+  800f23:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f27:	41 f6 c1 01          	test   $0x1,%r9b
+  800f2b:	74 9c                	je     800ec9 <memset+0x46>
+  800f2d:	88 07                	mov    %al,(%rdi)
+  800f2f:	eb 98                	jmp    800ec9 <memset+0x46>
+
+0000000000800f31 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f31:	48 89 f8             	mov    %rdi,%rax
+  800f34:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f37:	48 39 fe             	cmp    %rdi,%rsi
+  800f3a:	73 3b                	jae    800f77 <memmove+0x46>
+  800f3c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f40:	48 39 d7             	cmp    %rdx,%rdi
+  800f43:	73 32                	jae    800f77 <memmove+0x46>
+        s += n;
+        d += n;
+  800f45:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f49:	48 89 d6             	mov    %rdx,%rsi
+  800f4c:	48 09 fe             	or     %rdi,%rsi
+  800f4f:	48 09 ce             	or     %rcx,%rsi
+  800f52:	40 f6 c6 07          	test   $0x7,%sil
+  800f56:	75 12                	jne    800f6a <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800f58:	48 83 ef 08          	sub    $0x8,%rdi
+  800f5c:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800f60:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f64:	fd                   	std
+  800f65:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f68:	fc                   	cld
+  800f69:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f6a:	48 83 ef 01          	sub    $0x1,%rdi
+  800f6e:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f72:	fd                   	std
+  800f73:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f75:	eb f1                	jmp    800f68 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f77:	48 89 f2             	mov    %rsi,%rdx
+  800f7a:	48 09 c2             	or     %rax,%rdx
+  800f7d:	48 09 ca             	or     %rcx,%rdx
+  800f80:	f6 c2 07             	test   $0x7,%dl
+  800f83:	75 0c                	jne    800f91 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f85:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f89:	48 89 c7             	mov    %rax,%rdi
+  800f8c:	fc                   	cld
+  800f8d:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f90:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f91:	48 89 c7             	mov    %rax,%rdi
+  800f94:	fc                   	cld
+  800f95:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f97:	c3                   	ret
+
+0000000000800f98 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f98:	55                   	push   %rbp
+  800f99:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f9c:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  800fa3:	00 00 00 
+  800fa6:	ff d0                	call   *%rax
+}
+  800fa8:	5d                   	pop    %rbp
+  800fa9:	c3                   	ret
+
+0000000000800faa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800faa:	55                   	push   %rbp
+  800fab:	48 89 e5             	mov    %rsp,%rbp
+  800fae:	41 57                	push   %r15
+  800fb0:	41 56                	push   %r14
+  800fb2:	41 55                	push   %r13
+  800fb4:	41 54                	push   %r12
+  800fb6:	53                   	push   %rbx
+  800fb7:	48 83 ec 08          	sub    $0x8,%rsp
+  800fbb:	49 89 fe             	mov    %rdi,%r14
+  800fbe:	49 89 f7             	mov    %rsi,%r15
+  800fc1:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800fc4:	48 89 f7             	mov    %rsi,%rdi
+  800fc7:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  800fce:	00 00 00 
+  800fd1:	ff d0                	call   *%rax
+  800fd3:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800fd6:	48 89 de             	mov    %rbx,%rsi
+  800fd9:	4c 89 f7             	mov    %r14,%rdi
+  800fdc:	48 b8 14 0d 80 00 00 	movabs $0x800d14,%rax
+  800fe3:	00 00 00 
+  800fe6:	ff d0                	call   *%rax
+  800fe8:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800feb:	48 39 c3             	cmp    %rax,%rbx
+  800fee:	74 36                	je     801026 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ff0:	48 89 d8             	mov    %rbx,%rax
+  800ff3:	4c 29 e8             	sub    %r13,%rax
+  800ff6:	49 39 c4             	cmp    %rax,%r12
+  800ff9:	73 31                	jae    80102c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ffb:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801000:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801004:	4c 89 fe             	mov    %r15,%rsi
+  801007:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  80100e:	00 00 00 
+  801011:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801013:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801017:	48 83 c4 08          	add    $0x8,%rsp
+  80101b:	5b                   	pop    %rbx
+  80101c:	41 5c                	pop    %r12
+  80101e:	41 5d                	pop    %r13
+  801020:	41 5e                	pop    %r14
+  801022:	41 5f                	pop    %r15
+  801024:	5d                   	pop    %rbp
+  801025:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801026:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80102a:	eb eb                	jmp    801017 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80102c:	48 83 eb 01          	sub    $0x1,%rbx
+  801030:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801034:	48 89 da             	mov    %rbx,%rdx
+  801037:	4c 89 fe             	mov    %r15,%rsi
+  80103a:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  801041:	00 00 00 
+  801044:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801046:	49 01 de             	add    %rbx,%r14
+  801049:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80104e:	eb c3                	jmp    801013 <strlcat+0x69>
+
+0000000000801050 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801050:	48 85 d2             	test   %rdx,%rdx
+  801053:	74 2d                	je     801082 <memcmp+0x32>
+  801055:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80105a:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80105e:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801063:	44 38 c1             	cmp    %r8b,%cl
+  801066:	75 0f                	jne    801077 <memcmp+0x27>
+    while (n-- > 0) {
+  801068:	48 83 c0 01          	add    $0x1,%rax
+  80106c:	48 39 c2             	cmp    %rax,%rdx
+  80106f:	75 e9                	jne    80105a <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801071:	b8 00 00 00 00       	mov    $0x0,%eax
+  801076:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801077:	0f b6 c1             	movzbl %cl,%eax
+  80107a:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80107e:	44 29 c0             	sub    %r8d,%eax
+  801081:	c3                   	ret
+    return 0;
+  801082:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801087:	c3                   	ret
+
+0000000000801088 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801088:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80108c:	48 39 c7             	cmp    %rax,%rdi
+  80108f:	73 0f                	jae    8010a0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801091:	40 38 37             	cmp    %sil,(%rdi)
+  801094:	74 0e                	je     8010a4 <memfind+0x1c>
+    for (; src < end; src++) {
+  801096:	48 83 c7 01          	add    $0x1,%rdi
+  80109a:	48 39 f8             	cmp    %rdi,%rax
+  80109d:	75 f2                	jne    801091 <memfind+0x9>
+  80109f:	c3                   	ret
+  8010a0:	48 89 f8             	mov    %rdi,%rax
+  8010a3:	c3                   	ret
+  8010a4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010a7:	c3                   	ret
+
+00000000008010a8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010a8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010ab:	0f b6 37             	movzbl (%rdi),%esi
+  8010ae:	40 80 fe 20          	cmp    $0x20,%sil
+  8010b2:	74 06                	je     8010ba <strtol+0x12>
+  8010b4:	40 80 fe 09          	cmp    $0x9,%sil
+  8010b8:	75 13                	jne    8010cd <strtol+0x25>
+  8010ba:	48 83 c7 01          	add    $0x1,%rdi
+  8010be:	0f b6 37             	movzbl (%rdi),%esi
+  8010c1:	40 80 fe 20          	cmp    $0x20,%sil
+  8010c5:	74 f3                	je     8010ba <strtol+0x12>
+  8010c7:	40 80 fe 09          	cmp    $0x9,%sil
+  8010cb:	74 ed                	je     8010ba <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8010cd:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8010d0:	83 e0 fd             	and    $0xfffffffd,%eax
+  8010d3:	3c 01                	cmp    $0x1,%al
+  8010d5:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010d9:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8010df:	75 0f                	jne    8010f0 <strtol+0x48>
+  8010e1:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8010e4:	74 14                	je     8010fa <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8010e6:	85 d2                	test   %edx,%edx
+  8010e8:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8010ed:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8010f5:	4c 63 ca             	movslq %edx,%r9
+  8010f8:	eb 36                	jmp    801130 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8010fa:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8010fe:	74 0f                	je     80110f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801100:	85 d2                	test   %edx,%edx
+  801102:	75 ec                	jne    8010f0 <strtol+0x48>
+        s++;
+  801104:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801108:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80110d:	eb e1                	jmp    8010f0 <strtol+0x48>
+        s += 2;
+  80110f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801113:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801118:	eb d6                	jmp    8010f0 <strtol+0x48>
+            dig -= '0';
+  80111a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80111d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801121:	41 39 d0             	cmp    %edx,%r8d
+  801124:	7d 21                	jge    801147 <strtol+0x9f>
+        val = val * base + dig;
+  801126:	49 0f af c1          	imul   %r9,%rax
+  80112a:	0f b6 c9             	movzbl %cl,%ecx
+  80112d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801130:	48 83 c7 01          	add    $0x1,%rdi
+  801134:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801138:	80 f9 39             	cmp    $0x39,%cl
+  80113b:	76 dd                	jbe    80111a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80113d:	80 f9 7b             	cmp    $0x7b,%cl
+  801140:	77 05                	ja     801147 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801142:	83 e9 57             	sub    $0x57,%ecx
+  801145:	eb d6                	jmp    80111d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801147:	4d 85 d2             	test   %r10,%r10
+  80114a:	74 03                	je     80114f <strtol+0xa7>
+  80114c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80114f:	48 89 c2             	mov    %rax,%rdx
+  801152:	48 f7 da             	neg    %rdx
+  801155:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801159:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80115d:	c3                   	ret
+
+000000000080115e <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80115e:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801163:	ba 00 00 00 00       	mov    $0x0,%edx
+  801168:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80116e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801174:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80117a:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80117c:	c3                   	ret
+
+000000000080117d <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80117d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801182:	bf 00 00 00 00       	mov    $0x0,%edi
+  801187:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80118c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801191:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801197:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80119d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011a3:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011a5:	c3                   	ret
+
+00000000008011a6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011a6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011a9:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011ae:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ca:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011cc:	48 85 c0             	test   %rax,%rax
+  8011cf:	7f 01                	jg     8011d2 <sys_env_destroy+0x2c>
+}
+  8011d1:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8011d2:	55                   	push   %rbp
+  8011d3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011d6:	49 89 c0             	mov    %rax,%r8
+  8011d9:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8011de:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8011e5:	00 00 00 
+  8011e8:	be 29 00 00 00       	mov    $0x29,%esi
+  8011ed:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8011f4:	00 00 00 
+  8011f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011fc:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  801203:	00 00 00 
+  801206:	41 ff d1             	call   *%r9
+
+0000000000801209 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801209:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80120e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801213:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801218:	ba 00 00 00 00       	mov    $0x0,%edx
+  80121d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801223:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801229:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80122f:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801231:	c3                   	ret
+
+0000000000801232 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801232:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801237:	bf 00 00 00 00       	mov    $0x0,%edi
+  80123c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801241:	ba 00 00 00 00       	mov    $0x0,%edx
+  801246:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80124c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801252:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801258:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80125a:	c3                   	ret
+
+000000000080125b <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80125b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801260:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801267:	00 00 00 
+  80126a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801270:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801276:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80127c:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80127e:	c3                   	ret
+
+000000000080127f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80127f:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801282:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801287:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80128d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801293:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801295:	c3                   	ret
+
+0000000000801296 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801296:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801299:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80129e:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012ad:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012af:	48 85 c0             	test   %rax,%rax
+  8012b2:	7f 01                	jg     8012b5 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8012b4:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8012b5:	55                   	push   %rbp
+  8012b6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012b9:	49 89 c0             	mov    %rax,%r8
+  8012bc:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8012c1:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8012c8:	00 00 00 
+  8012cb:	be 29 00 00 00       	mov    $0x29,%esi
+  8012d0:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8012d7:	00 00 00 
+  8012da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012df:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  8012e6:	00 00 00 
+  8012e9:	41 ff d1             	call   *%r9
+
+00000000008012ec <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012ec:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8012ef:	48 63 d2             	movslq %edx,%rdx
+  8012f2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012f5:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012fa:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8012fd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012ff:	48 85 c0             	test   %rax,%rax
+  801302:	7f 01                	jg     801305 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801304:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801309:	49 89 c0             	mov    %rax,%r8
+  80130c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801311:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801318:	00 00 00 
+  80131b:	be 29 00 00 00       	mov    $0x29,%esi
+  801320:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801327:	00 00 00 
+  80132a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132f:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  801336:	00 00 00 
+  801339:	41 ff d1             	call   *%r9
+
+000000000080133c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80133c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80133f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801344:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801350:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801356:	0f 05                	syscall
+    if (check && ret > 0) {
+  801358:	48 85 c0             	test   %rax,%rax
+  80135b:	7f 01                	jg     80135e <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80135d:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80135e:	55                   	push   %rbp
+  80135f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801362:	49 89 c0             	mov    %rax,%r8
+  801365:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80136a:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801371:	00 00 00 
+  801374:	be 29 00 00 00       	mov    $0x29,%esi
+  801379:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  801380:	00 00 00 
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+  801388:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  80138f:	00 00 00 
+  801392:	41 ff d1             	call   *%r9
+
+0000000000801395 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801395:	48 63 f6             	movslq %esi,%rsi
+  801398:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80139b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013b9:	48 85 c0             	test   %rax,%rax
+  8013bc:	7f 01                	jg     8013bf <sys_env_set_status+0x2a>
+}
+  8013be:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8013bf:	55                   	push   %rbp
+  8013c0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c3:	49 89 c0             	mov    %rax,%r8
+  8013c6:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8013cb:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8013d2:	00 00 00 
+  8013d5:	be 29 00 00 00       	mov    $0x29,%esi
+  8013da:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8013e1:	00 00 00 
+  8013e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e9:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  8013f0:	00 00 00 
+  8013f3:	41 ff d1             	call   *%r9
+
+00000000008013f6 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8013f6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f9:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801403:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801409:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80140f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801415:	0f 05                	syscall
+    if (check && ret > 0) {
+  801417:	48 85 c0             	test   %rax,%rax
+  80141a:	7f 01                	jg     80141d <sys_env_set_trapframe+0x27>
+}
+  80141c:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80141d:	55                   	push   %rbp
+  80141e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801421:	49 89 c0             	mov    %rax,%r8
+  801424:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801429:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  801430:	00 00 00 
+  801433:	be 29 00 00 00       	mov    $0x29,%esi
+  801438:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80143f:	00 00 00 
+  801442:	b8 00 00 00 00       	mov    $0x0,%eax
+  801447:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  80144e:	00 00 00 
+  801451:	41 ff d1             	call   *%r9
+
+0000000000801454 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801454:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80145c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801461:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801467:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801473:	0f 05                	syscall
+    if (check && ret > 0) {
+  801475:	48 85 c0             	test   %rax,%rax
+  801478:	7f 01                	jg     80147b <sys_env_set_pgfault_upcall+0x27>
+}
+  80147a:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80147b:	55                   	push   %rbp
+  80147c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80147f:	49 89 c0             	mov    %rax,%r8
+  801482:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801487:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80148e:	00 00 00 
+  801491:	be 29 00 00 00       	mov    $0x29,%esi
+  801496:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80149d:	00 00 00 
+  8014a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014a5:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  8014ac:	00 00 00 
+  8014af:	41 ff d1             	call   *%r9
+
+00000000008014b2 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014b2:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b8:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014bd:	4d 63 c0             	movslq %r8d,%r8
+  8014c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c6:	0f 05                	syscall
+}
+  8014c8:	c3                   	ret
+
+00000000008014c9 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8014c9:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8014cc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014cf:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d4:	4d 63 c0             	movslq %r8d,%r8
+  8014d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014dd:	0f 05                	syscall
+}
+  8014df:	c3                   	ret
+
+00000000008014e0 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014e0:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e5:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014e8:	45 89 c0             	mov    %r8d,%r8d
+  8014eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014f1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014f3:	48 85 c0             	test   %rax,%rax
+  8014f6:	7f 01                	jg     8014f9 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8014f8:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8014f9:	55                   	push   %rbp
+  8014fa:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fd:	49 89 c0             	mov    %rax,%r8
+  801500:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801505:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  80150c:	00 00 00 
+  80150f:	be 29 00 00 00       	mov    $0x29,%esi
+  801514:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  80151b:	00 00 00 
+  80151e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801523:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  80152a:	00 00 00 
+  80152d:	41 ff d1             	call   *%r9
+
+0000000000801530 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801530:	55                   	push   %rbp
+  801531:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80153f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801544:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  80154b:	00 00 00 
+  80154e:	ff d0                	call   *%rax
+}
+  801550:	5d                   	pop    %rbp
+  801551:	c3                   	ret
+
+0000000000801552 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801552:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801557:	bf 00 00 00 00       	mov    $0x0,%edi
+  80155c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801561:	ba 00 00 00 00       	mov    $0x0,%edx
+  801566:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80156c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801572:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801578:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80157a:	c3                   	ret
+
+000000000080157b <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80157b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801580:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801585:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801590:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801596:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80159c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80159e:	48 85 c0             	test   %rax,%rax
+  8015a1:	7f 01                	jg     8015a4 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8015a3:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8015a4:	55                   	push   %rbp
+  8015a5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015a8:	49 89 c0             	mov    %rax,%r8
+  8015ab:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8015b0:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8015b7:	00 00 00 
+  8015ba:	be 29 00 00 00       	mov    $0x29,%esi
+  8015bf:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8015c6:	00 00 00 
+  8015c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015ce:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  8015d5:	00 00 00 
+  8015d8:	41 ff d1             	call   *%r9
+
+00000000008015db <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015db:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015e5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ef:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801601:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801603:	c3                   	ret
+
+0000000000801604 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801604:	89 d2                	mov    %edx,%edx
+  801606:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801608:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80160d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801613:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801619:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80161f:	0f 05                	syscall
+}
+  801621:	c3                   	ret
+
+0000000000801622 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801622:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80162a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80162f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801635:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80163b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801641:	0f 05                	syscall
+}
+  801643:	c3                   	ret
+
+0000000000801644 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801644:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80164c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801651:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801657:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80165d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801663:	0f 05                	syscall
+}
+  801665:	c3                   	ret
+
+0000000000801666 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801666:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801669:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80166e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801673:	ba 00 00 00 00       	mov    $0x0,%edx
+  801678:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80167e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801684:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80168c:	48 85 c0             	test   %rax,%rax
+  80168f:	7f 01                	jg     801692 <sys_irq_ack+0x2c>
+}
+  801691:	c3                   	ret
+sys_irq_ack(int irq) {
+  801692:	55                   	push   %rbp
+  801693:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801696:	49 89 c0             	mov    %rax,%r8
+  801699:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80169e:	48 ba f8 59 80 00 00 	movabs $0x8059f8,%rdx
+  8016a5:	00 00 00 
+  8016a8:	be 29 00 00 00       	mov    $0x29,%esi
+  8016ad:	48 bf 17 5a 80 00 00 	movabs $0x805a17,%rdi
+  8016b4:	00 00 00 
+  8016b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016bc:	49 b9 c2 02 80 00 00 	movabs $0x8002c2,%r9
+  8016c3:	00 00 00 
+  8016c6:	41 ff d1             	call   *%r9
+
+00000000008016c9 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016c9:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016d0:	ff ff ff 
+  8016d3:	48 01 f8             	add    %rdi,%rax
+  8016d6:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016da:	c3                   	ret
+
+00000000008016db <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016db:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016e2:	ff ff ff 
+  8016e5:	48 01 f8             	add    %rdi,%rax
+  8016e8:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8016ec:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8016f2:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8016f6:	c3                   	ret
+
+00000000008016f7 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8016f7:	55                   	push   %rbp
+  8016f8:	48 89 e5             	mov    %rsp,%rbp
+  8016fb:	41 57                	push   %r15
+  8016fd:	41 56                	push   %r14
+  8016ff:	41 55                	push   %r13
+  801701:	41 54                	push   %r12
+  801703:	53                   	push   %rbx
+  801704:	48 83 ec 08          	sub    $0x8,%rsp
+  801708:	49 89 ff             	mov    %rdi,%r15
+  80170b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801710:	49 bd 40 47 80 00 00 	movabs $0x804740,%r13
+  801717:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80171a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801720:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801723:	48 89 df             	mov    %rbx,%rdi
+  801726:	41 ff d5             	call   *%r13
+  801729:	83 e0 04             	and    $0x4,%eax
+  80172c:	74 17                	je     801745 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80172e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801735:	4c 39 f3             	cmp    %r14,%rbx
+  801738:	75 e6                	jne    801720 <fd_alloc+0x29>
+  80173a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801740:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801745:	4d 89 27             	mov    %r12,(%r15)
+}
+  801748:	48 83 c4 08          	add    $0x8,%rsp
+  80174c:	5b                   	pop    %rbx
+  80174d:	41 5c                	pop    %r12
+  80174f:	41 5d                	pop    %r13
+  801751:	41 5e                	pop    %r14
+  801753:	41 5f                	pop    %r15
+  801755:	5d                   	pop    %rbp
+  801756:	c3                   	ret
+
+0000000000801757 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801757:	83 ff 1f             	cmp    $0x1f,%edi
+  80175a:	77 39                	ja     801795 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  80175c:	55                   	push   %rbp
+  80175d:	48 89 e5             	mov    %rsp,%rbp
+  801760:	41 54                	push   %r12
+  801762:	53                   	push   %rbx
+  801763:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801766:	48 63 df             	movslq %edi,%rbx
+  801769:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801770:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801774:	48 89 df             	mov    %rbx,%rdi
+  801777:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  80177e:	00 00 00 
+  801781:	ff d0                	call   *%rax
+  801783:	a8 04                	test   $0x4,%al
+  801785:	74 14                	je     80179b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801787:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80178b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801790:	5b                   	pop    %rbx
+  801791:	41 5c                	pop    %r12
+  801793:	5d                   	pop    %rbp
+  801794:	c3                   	ret
+        return -E_INVAL;
+  801795:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80179a:	c3                   	ret
+        return -E_INVAL;
+  80179b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017a0:	eb ee                	jmp    801790 <fd_lookup+0x39>
+
+00000000008017a2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+  8017a6:	41 54                	push   %r12
+  8017a8:	53                   	push   %rbx
+  8017a9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017ac:	48 b8 c0 5a 80 00 00 	movabs $0x805ac0,%rax
+  8017b3:	00 00 00 
+  8017b6:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8017bd:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017c0:	39 3b                	cmp    %edi,(%rbx)
+  8017c2:	74 47                	je     80180b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017c4:	48 83 c0 08          	add    $0x8,%rax
+  8017c8:	48 8b 18             	mov    (%rax),%rbx
+  8017cb:	48 85 db             	test   %rbx,%rbx
+  8017ce:	75 f0                	jne    8017c0 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017d0:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8017d7:	00 00 00 
+  8017da:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017e0:	89 fa                	mov    %edi,%edx
+  8017e2:	48 bf 28 5a 80 00 00 	movabs $0x805a28,%rdi
+  8017e9:	00 00 00 
+  8017ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f1:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  8017f8:	00 00 00 
+  8017fb:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8017fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801802:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801806:	5b                   	pop    %rbx
+  801807:	41 5c                	pop    %r12
+  801809:	5d                   	pop    %rbp
+  80180a:	c3                   	ret
+            return 0;
+  80180b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801810:	eb f0                	jmp    801802 <dev_lookup+0x60>
+
+0000000000801812 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801812:	55                   	push   %rbp
+  801813:	48 89 e5             	mov    %rsp,%rbp
+  801816:	41 55                	push   %r13
+  801818:	41 54                	push   %r12
+  80181a:	53                   	push   %rbx
+  80181b:	48 83 ec 18          	sub    $0x18,%rsp
+  80181f:	48 89 fb             	mov    %rdi,%rbx
+  801822:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801825:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80182c:	ff ff ff 
+  80182f:	48 01 df             	add    %rbx,%rdi
+  801832:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801836:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80183a:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801841:	00 00 00 
+  801844:	ff d0                	call   *%rax
+  801846:	41 89 c5             	mov    %eax,%r13d
+  801849:	85 c0                	test   %eax,%eax
+  80184b:	78 06                	js     801853 <fd_close+0x41>
+  80184d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801851:	74 1a                	je     80186d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801853:	45 84 e4             	test   %r12b,%r12b
+  801856:	b8 00 00 00 00       	mov    $0x0,%eax
+  80185b:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  80185f:	44 89 e8             	mov    %r13d,%eax
+  801862:	48 83 c4 18          	add    $0x18,%rsp
+  801866:	5b                   	pop    %rbx
+  801867:	41 5c                	pop    %r12
+  801869:	41 5d                	pop    %r13
+  80186b:	5d                   	pop    %rbp
+  80186c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80186d:	8b 3b                	mov    (%rbx),%edi
+  80186f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801873:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  80187a:	00 00 00 
+  80187d:	ff d0                	call   *%rax
+  80187f:	41 89 c5             	mov    %eax,%r13d
+  801882:	85 c0                	test   %eax,%eax
+  801884:	78 1b                	js     8018a1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801886:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80188a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80188e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801894:	48 85 c0             	test   %rax,%rax
+  801897:	74 08                	je     8018a1 <fd_close+0x8f>
+  801899:	48 89 df             	mov    %rbx,%rdi
+  80189c:	ff d0                	call   *%rax
+  80189e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018a6:	48 89 de             	mov    %rbx,%rsi
+  8018a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018ae:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  8018b5:	00 00 00 
+  8018b8:	ff d0                	call   *%rax
+    return res;
+  8018ba:	eb a3                	jmp    80185f <fd_close+0x4d>
+
+00000000008018bc <close>:
+
+int
+close(int fdnum) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018c4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018c8:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  8018cf:	00 00 00 
+  8018d2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018d4:	85 c0                	test   %eax,%eax
+  8018d6:	78 15                	js     8018ed <close+0x31>
+
+    return fd_close(fd, 1);
+  8018d8:	be 01 00 00 00       	mov    $0x1,%esi
+  8018dd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018e1:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+}
+  8018ed:	c9                   	leave
+  8018ee:	c3                   	ret
+
+00000000008018ef <close_all>:
+
+void
+close_all(void) {
+  8018ef:	55                   	push   %rbp
+  8018f0:	48 89 e5             	mov    %rsp,%rbp
+  8018f3:	41 54                	push   %r12
+  8018f5:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8018f6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8018fb:	49 bc bc 18 80 00 00 	movabs $0x8018bc,%r12
+  801902:	00 00 00 
+  801905:	89 df                	mov    %ebx,%edi
+  801907:	41 ff d4             	call   *%r12
+  80190a:	83 c3 01             	add    $0x1,%ebx
+  80190d:	83 fb 20             	cmp    $0x20,%ebx
+  801910:	75 f3                	jne    801905 <close_all+0x16>
+}
+  801912:	5b                   	pop    %rbx
+  801913:	41 5c                	pop    %r12
+  801915:	5d                   	pop    %rbp
+  801916:	c3                   	ret
+
+0000000000801917 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801917:	55                   	push   %rbp
+  801918:	48 89 e5             	mov    %rsp,%rbp
+  80191b:	41 57                	push   %r15
+  80191d:	41 56                	push   %r14
+  80191f:	41 55                	push   %r13
+  801921:	41 54                	push   %r12
+  801923:	53                   	push   %rbx
+  801924:	48 83 ec 18          	sub    $0x18,%rsp
+  801928:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80192b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80192f:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801936:	00 00 00 
+  801939:	ff d0                	call   *%rax
+  80193b:	89 c3                	mov    %eax,%ebx
+  80193d:	85 c0                	test   %eax,%eax
+  80193f:	0f 88 b8 00 00 00    	js     8019fd <dup+0xe6>
+    close(newfdnum);
+  801945:	44 89 e7             	mov    %r12d,%edi
+  801948:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801954:	4d 63 ec             	movslq %r12d,%r13
+  801957:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  80195e:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801962:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801966:	4c 89 ff             	mov    %r15,%rdi
+  801969:	49 be db 16 80 00 00 	movabs $0x8016db,%r14
+  801970:	00 00 00 
+  801973:	41 ff d6             	call   *%r14
+  801976:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801979:	4c 89 ef             	mov    %r13,%rdi
+  80197c:	41 ff d6             	call   *%r14
+  80197f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801982:	48 89 df             	mov    %rbx,%rdi
+  801985:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  80198c:	00 00 00 
+  80198f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801991:	a8 04                	test   $0x4,%al
+  801993:	74 2b                	je     8019c0 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801995:	41 89 c1             	mov    %eax,%r9d
+  801998:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80199e:	4c 89 f1             	mov    %r14,%rcx
+  8019a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a6:	48 89 de             	mov    %rbx,%rsi
+  8019a9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019ae:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  8019b5:	00 00 00 
+  8019b8:	ff d0                	call   *%rax
+  8019ba:	89 c3                	mov    %eax,%ebx
+  8019bc:	85 c0                	test   %eax,%eax
+  8019be:	78 4e                	js     801a0e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019c0:	4c 89 ff             	mov    %r15,%rdi
+  8019c3:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  8019ca:	00 00 00 
+  8019cd:	ff d0                	call   *%rax
+  8019cf:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019d2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019d8:	4c 89 e9             	mov    %r13,%rcx
+  8019db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019e0:	4c 89 fe             	mov    %r15,%rsi
+  8019e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019e8:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  8019ef:	00 00 00 
+  8019f2:	ff d0                	call   *%rax
+  8019f4:	89 c3                	mov    %eax,%ebx
+  8019f6:	85 c0                	test   %eax,%eax
+  8019f8:	78 14                	js     801a0e <dup+0xf7>
+
+    return newfdnum;
+  8019fa:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8019fd:	89 d8                	mov    %ebx,%eax
+  8019ff:	48 83 c4 18          	add    $0x18,%rsp
+  801a03:	5b                   	pop    %rbx
+  801a04:	41 5c                	pop    %r12
+  801a06:	41 5d                	pop    %r13
+  801a08:	41 5e                	pop    %r14
+  801a0a:	41 5f                	pop    %r15
+  801a0c:	5d                   	pop    %rbp
+  801a0d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a0e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a13:	4c 89 ee             	mov    %r13,%rsi
+  801a16:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a1b:	49 bc 3c 13 80 00 00 	movabs $0x80133c,%r12
+  801a22:	00 00 00 
+  801a25:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a28:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a2d:	4c 89 f6             	mov    %r14,%rsi
+  801a30:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a35:	41 ff d4             	call   *%r12
+    return res;
+  801a38:	eb c3                	jmp    8019fd <dup+0xe6>
+
+0000000000801a3a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a3a:	55                   	push   %rbp
+  801a3b:	48 89 e5             	mov    %rsp,%rbp
+  801a3e:	41 56                	push   %r14
+  801a40:	41 55                	push   %r13
+  801a42:	41 54                	push   %r12
+  801a44:	53                   	push   %rbx
+  801a45:	48 83 ec 10          	sub    $0x10,%rsp
+  801a49:	89 fb                	mov    %edi,%ebx
+  801a4b:	49 89 f4             	mov    %rsi,%r12
+  801a4e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a51:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a55:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+  801a61:	85 c0                	test   %eax,%eax
+  801a63:	78 4c                	js     801ab1 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a65:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a69:	41 8b 3e             	mov    (%r14),%edi
+  801a6c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a70:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  801a77:	00 00 00 
+  801a7a:	ff d0                	call   *%rax
+  801a7c:	85 c0                	test   %eax,%eax
+  801a7e:	78 35                	js     801ab5 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a80:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a84:	83 e0 03             	and    $0x3,%eax
+  801a87:	83 f8 01             	cmp    $0x1,%eax
+  801a8a:	74 2d                	je     801ab9 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801a8c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a90:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801a94:	48 85 c0             	test   %rax,%rax
+  801a97:	74 56                	je     801aef <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801a99:	4c 89 ea             	mov    %r13,%rdx
+  801a9c:	4c 89 e6             	mov    %r12,%rsi
+  801a9f:	4c 89 f7             	mov    %r14,%rdi
+  801aa2:	ff d0                	call   *%rax
+}
+  801aa4:	48 83 c4 10          	add    $0x10,%rsp
+  801aa8:	5b                   	pop    %rbx
+  801aa9:	41 5c                	pop    %r12
+  801aab:	41 5d                	pop    %r13
+  801aad:	41 5e                	pop    %r14
+  801aaf:	5d                   	pop    %rbp
+  801ab0:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ab1:	48 98                	cltq
+  801ab3:	eb ef                	jmp    801aa4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ab5:	48 98                	cltq
+  801ab7:	eb eb                	jmp    801aa4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ab9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ac0:	00 00 00 
+  801ac3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ac9:	89 da                	mov    %ebx,%edx
+  801acb:	48 bf 69 5a 80 00 00 	movabs $0x805a69,%rdi
+  801ad2:	00 00 00 
+  801ad5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ada:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  801ae1:	00 00 00 
+  801ae4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ae6:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801aed:	eb b5                	jmp    801aa4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801aef:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801af6:	eb ac                	jmp    801aa4 <read+0x6a>
+
+0000000000801af8 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801af8:	55                   	push   %rbp
+  801af9:	48 89 e5             	mov    %rsp,%rbp
+  801afc:	41 57                	push   %r15
+  801afe:	41 56                	push   %r14
+  801b00:	41 55                	push   %r13
+  801b02:	41 54                	push   %r12
+  801b04:	53                   	push   %rbx
+  801b05:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b09:	48 85 d2             	test   %rdx,%rdx
+  801b0c:	74 54                	je     801b62 <readn+0x6a>
+  801b0e:	41 89 fd             	mov    %edi,%r13d
+  801b11:	49 89 f6             	mov    %rsi,%r14
+  801b14:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b17:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b1c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b21:	49 bf 3a 1a 80 00 00 	movabs $0x801a3a,%r15
+  801b28:	00 00 00 
+  801b2b:	4c 89 e2             	mov    %r12,%rdx
+  801b2e:	48 29 f2             	sub    %rsi,%rdx
+  801b31:	4c 01 f6             	add    %r14,%rsi
+  801b34:	44 89 ef             	mov    %r13d,%edi
+  801b37:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b3a:	85 c0                	test   %eax,%eax
+  801b3c:	78 20                	js     801b5e <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b3e:	01 c3                	add    %eax,%ebx
+  801b40:	85 c0                	test   %eax,%eax
+  801b42:	74 08                	je     801b4c <readn+0x54>
+  801b44:	48 63 f3             	movslq %ebx,%rsi
+  801b47:	4c 39 e6             	cmp    %r12,%rsi
+  801b4a:	72 df                	jb     801b2b <readn+0x33>
+    }
+    return res;
+  801b4c:	48 63 c3             	movslq %ebx,%rax
+}
+  801b4f:	48 83 c4 08          	add    $0x8,%rsp
+  801b53:	5b                   	pop    %rbx
+  801b54:	41 5c                	pop    %r12
+  801b56:	41 5d                	pop    %r13
+  801b58:	41 5e                	pop    %r14
+  801b5a:	41 5f                	pop    %r15
+  801b5c:	5d                   	pop    %rbp
+  801b5d:	c3                   	ret
+        if (inc < 0) return inc;
+  801b5e:	48 98                	cltq
+  801b60:	eb ed                	jmp    801b4f <readn+0x57>
+    int inc = 1, res = 0;
+  801b62:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b67:	eb e3                	jmp    801b4c <readn+0x54>
+
+0000000000801b69 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b69:	55                   	push   %rbp
+  801b6a:	48 89 e5             	mov    %rsp,%rbp
+  801b6d:	41 56                	push   %r14
+  801b6f:	41 55                	push   %r13
+  801b71:	41 54                	push   %r12
+  801b73:	53                   	push   %rbx
+  801b74:	48 83 ec 10          	sub    $0x10,%rsp
+  801b78:	89 fb                	mov    %edi,%ebx
+  801b7a:	49 89 f4             	mov    %rsi,%r12
+  801b7d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b80:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b84:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801b8b:	00 00 00 
+  801b8e:	ff d0                	call   *%rax
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	78 47                	js     801bdb <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b94:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801b98:	41 8b 3e             	mov    (%r14),%edi
+  801b9b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b9f:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  801ba6:	00 00 00 
+  801ba9:	ff d0                	call   *%rax
+  801bab:	85 c0                	test   %eax,%eax
+  801bad:	78 30                	js     801bdf <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801baf:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bb4:	74 2d                	je     801be3 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bb6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bba:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bbe:	48 85 c0             	test   %rax,%rax
+  801bc1:	74 56                	je     801c19 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bc3:	4c 89 ea             	mov    %r13,%rdx
+  801bc6:	4c 89 e6             	mov    %r12,%rsi
+  801bc9:	4c 89 f7             	mov    %r14,%rdi
+  801bcc:	ff d0                	call   *%rax
+}
+  801bce:	48 83 c4 10          	add    $0x10,%rsp
+  801bd2:	5b                   	pop    %rbx
+  801bd3:	41 5c                	pop    %r12
+  801bd5:	41 5d                	pop    %r13
+  801bd7:	41 5e                	pop    %r14
+  801bd9:	5d                   	pop    %rbp
+  801bda:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bdb:	48 98                	cltq
+  801bdd:	eb ef                	jmp    801bce <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bdf:	48 98                	cltq
+  801be1:	eb eb                	jmp    801bce <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801be3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801bea:	00 00 00 
+  801bed:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801bf3:	89 da                	mov    %ebx,%edx
+  801bf5:	48 bf 85 5a 80 00 00 	movabs $0x805a85,%rdi
+  801bfc:	00 00 00 
+  801bff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c04:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  801c0b:	00 00 00 
+  801c0e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c10:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c17:	eb b5                	jmp    801bce <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c19:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c20:	eb ac                	jmp    801bce <write+0x65>
+
+0000000000801c22 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	41 54                	push   %r12
+  801c28:	53                   	push   %rbx
+  801c29:	48 83 ec 10          	sub    $0x10,%rsp
+  801c2d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c2f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c33:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801c3a:	00 00 00 
+  801c3d:	ff d0                	call   *%rax
+  801c3f:	85 c0                	test   %eax,%eax
+  801c41:	78 3e                	js     801c81 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c43:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c47:	41 8b 3c 24          	mov    (%r12),%edi
+  801c4b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c4f:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  801c56:	00 00 00 
+  801c59:	ff d0                	call   *%rax
+  801c5b:	85 c0                	test   %eax,%eax
+  801c5d:	78 22                	js     801c81 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c5f:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c63:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c67:	48 85 c0             	test   %rax,%rax
+  801c6a:	74 0b                	je     801c77 <seek+0x55>
+  801c6c:	89 de                	mov    %ebx,%esi
+  801c6e:	4c 89 e7             	mov    %r12,%rdi
+  801c71:	ff d0                	call   *%rax
+  801c73:	85 c0                	test   %eax,%eax
+  801c75:	78 0a                	js     801c81 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801c77:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801c7c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c81:	48 83 c4 10          	add    $0x10,%rsp
+  801c85:	5b                   	pop    %rbx
+  801c86:	41 5c                	pop    %r12
+  801c88:	5d                   	pop    %rbp
+  801c89:	c3                   	ret
+
+0000000000801c8a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801c8a:	55                   	push   %rbp
+  801c8b:	48 89 e5             	mov    %rsp,%rbp
+  801c8e:	41 55                	push   %r13
+  801c90:	41 54                	push   %r12
+  801c92:	53                   	push   %rbx
+  801c93:	48 83 ec 18          	sub    $0x18,%rsp
+  801c97:	89 fb                	mov    %edi,%ebx
+  801c99:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c9c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ca0:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801ca7:	00 00 00 
+  801caa:	ff d0                	call   *%rax
+  801cac:	85 c0                	test   %eax,%eax
+  801cae:	78 38                	js     801ce8 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cb0:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801cb4:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cb8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cbc:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  801cc3:	00 00 00 
+  801cc6:	ff d0                	call   *%rax
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	78 1c                	js     801ce8 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ccc:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cd1:	74 20                	je     801cf3 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cd3:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cd7:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cdb:	48 85 c0             	test   %rax,%rax
+  801cde:	74 47                	je     801d27 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ce0:	44 89 e6             	mov    %r12d,%esi
+  801ce3:	4c 89 ef             	mov    %r13,%rdi
+  801ce6:	ff d0                	call   *%rax
+}
+  801ce8:	48 83 c4 18          	add    $0x18,%rsp
+  801cec:	5b                   	pop    %rbx
+  801ced:	41 5c                	pop    %r12
+  801cef:	41 5d                	pop    %r13
+  801cf1:	5d                   	pop    %rbp
+  801cf2:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801cf3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801cfa:	00 00 00 
+  801cfd:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d03:	89 da                	mov    %ebx,%edx
+  801d05:	48 bf 48 5a 80 00 00 	movabs $0x805a48,%rdi
+  801d0c:	00 00 00 
+  801d0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d14:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  801d1b:	00 00 00 
+  801d1e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d20:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d25:	eb c1                	jmp    801ce8 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d27:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d2c:	eb ba                	jmp    801ce8 <ftruncate+0x5e>
+
+0000000000801d2e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d2e:	55                   	push   %rbp
+  801d2f:	48 89 e5             	mov    %rsp,%rbp
+  801d32:	41 54                	push   %r12
+  801d34:	53                   	push   %rbx
+  801d35:	48 83 ec 10          	sub    $0x10,%rsp
+  801d39:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d40:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  801d47:	00 00 00 
+  801d4a:	ff d0                	call   *%rax
+  801d4c:	85 c0                	test   %eax,%eax
+  801d4e:	78 4e                	js     801d9e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d50:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d54:	41 8b 3c 24          	mov    (%r12),%edi
+  801d58:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d5c:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  801d63:	00 00 00 
+  801d66:	ff d0                	call   *%rax
+  801d68:	85 c0                	test   %eax,%eax
+  801d6a:	78 32                	js     801d9e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d6c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d70:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d75:	74 30                	je     801da7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d77:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d7a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d81:	00 00 00 
+    stat->st_isdir = 0;
+  801d84:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801d8b:	00 00 00 
+    stat->st_dev = dev;
+  801d8e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801d95:	48 89 de             	mov    %rbx,%rsi
+  801d98:	4c 89 e7             	mov    %r12,%rdi
+  801d9b:	ff 50 28             	call   *0x28(%rax)
+}
+  801d9e:	48 83 c4 10          	add    $0x10,%rsp
+  801da2:	5b                   	pop    %rbx
+  801da3:	41 5c                	pop    %r12
+  801da5:	5d                   	pop    %rbp
+  801da6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801da7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dac:	eb f0                	jmp    801d9e <fstat+0x70>
+
+0000000000801dae <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801dae:	55                   	push   %rbp
+  801daf:	48 89 e5             	mov    %rsp,%rbp
+  801db2:	41 54                	push   %r12
+  801db4:	53                   	push   %rbx
+  801db5:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801db8:	be 00 00 00 00       	mov    $0x0,%esi
+  801dbd:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  801dc4:	00 00 00 
+  801dc7:	ff d0                	call   *%rax
+  801dc9:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801dcb:	85 c0                	test   %eax,%eax
+  801dcd:	78 25                	js     801df4 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801dcf:	4c 89 e6             	mov    %r12,%rsi
+  801dd2:	89 c7                	mov    %eax,%edi
+  801dd4:	48 b8 2e 1d 80 00 00 	movabs $0x801d2e,%rax
+  801ddb:	00 00 00 
+  801dde:	ff d0                	call   *%rax
+  801de0:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801de3:	89 df                	mov    %ebx,%edi
+  801de5:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  801dec:	00 00 00 
+  801def:	ff d0                	call   *%rax
+
+    return res;
+  801df1:	44 89 e3             	mov    %r12d,%ebx
+}
+  801df4:	89 d8                	mov    %ebx,%eax
+  801df6:	5b                   	pop    %rbx
+  801df7:	41 5c                	pop    %r12
+  801df9:	5d                   	pop    %rbp
+  801dfa:	c3                   	ret
+
+0000000000801dfb <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801dfb:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e02:	00 00 00 
+  801e05:	83 38 00             	cmpl   $0x0,(%rax)
+  801e08:	74 0a                	je     801e14 <fsenv+0x19>
+    return envid;
+}
+  801e0a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e11:	00 00 
+  801e13:	c3                   	ret
+fsenv(void) {
+  801e14:	55                   	push   %rbp
+  801e15:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e18:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e1d:	48 b8 32 53 80 00 00 	movabs $0x805332,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+  801e29:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e30:	00 00 
+}
+  801e32:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e39:	00 00 
+  801e3b:	5d                   	pop    %rbp
+  801e3c:	c3                   	ret
+
+0000000000801e3d <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e44:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e49:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e4e:	48 89 de             	mov    %rbx,%rsi
+  801e51:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e56:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e62:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e69:	00 00 00 
+  801e6c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e72:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801e77:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e7c:	48 89 de             	mov    %rbx,%rsi
+  801e7f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e84:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  801e8b:	00 00 00 
+  801e8e:	ff d0                	call   *%rax
+  801e90:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801e92:	85 c0                	test   %eax,%eax
+  801e94:	0f 88 a2 00 00 00    	js     801f3c <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801e9a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ea1:	00 00 00 
+  801ea4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801eaa:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801eaf:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801eb1:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801eb6:	49 bc 97 4b 80 00 00 	movabs $0x804b97,%r12
+  801ebd:	00 00 00 
+  801ec0:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801ec3:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801ec8:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ecb:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  801ed2:	00 00 00 
+  801ed5:	ff d0                	call   *%rax
+  801ed7:	89 c7                	mov    %eax,%edi
+  801ed9:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801edf:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801ee4:	48 89 da             	mov    %rbx,%rdx
+  801ee7:	be 09 00 00 00       	mov    $0x9,%esi
+  801eec:	48 b8 dc 52 80 00 00 	movabs $0x8052dc,%rax
+  801ef3:	00 00 00 
+  801ef6:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801ef8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801efd:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f02:	be 00 00 00 00       	mov    $0x0,%esi
+  801f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f0c:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  801f13:	00 00 00 
+  801f16:	ff d0                	call   *%rax
+  801f18:	89 c3                	mov    %eax,%ebx
+  801f1a:	85 c0                	test   %eax,%eax
+  801f1c:	78 25                	js     801f43 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801f1e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f25:	00 00 00 
+  801f28:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f2e:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f35:	00 00 
+    return 0;
+  801f37:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f3c:	89 d8                	mov    %ebx,%eax
+  801f3e:	5b                   	pop    %rbx
+  801f3f:	41 5c                	pop    %r12
+  801f41:	5d                   	pop    %rbp
+  801f42:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f43:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f48:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f4d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f52:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  801f59:	00 00 00 
+  801f5c:	ff d0                	call   *%rax
+        return res;
+  801f5e:	eb dc                	jmp    801f3c <fschan_setup+0xff>
+
+0000000000801f60 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f60:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f67:	00 00 00 
+  801f6a:	80 38 00             	cmpb   $0x0,(%rax)
+  801f6d:	74 55                	je     801fc4 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f6f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f76:	00 00 00 
+  801f79:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801f7f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f84:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801f8b:	00 00 00 
+  801f8e:	3b 0a                	cmp    (%rdx),%ecx
+  801f90:	75 01                	jne    801f93 <fschan+0x33>
+}
+  801f92:	c3                   	ret
+fschan(void) {
+  801f93:	55                   	push   %rbp
+  801f94:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f97:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  801f9e:	00 00 00 
+  801fa1:	ff d0                	call   *%rax
+  801fa3:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801fa5:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801faa:	85 d2                	test   %edx,%edx
+  801fac:	78 02                	js     801fb0 <fschan+0x50>
+}
+  801fae:	5d                   	pop    %rbp
+  801faf:	c3                   	ret
+        fschan_enabled = 0;
+  801fb0:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fb7:	00 00 00 
+  801fba:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801fbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc2:	eb ea                	jmp    801fae <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801fc4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fc9:	c3                   	ret
+
+0000000000801fca <fbuf>:
+fbuf(struct Fd *fd) {
+  801fca:	55                   	push   %rbp
+  801fcb:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801fce:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  801fd5:	00 00 00 
+  801fd8:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801fda:	ba 00 00 00 00       	mov    $0x0,%edx
+  801fdf:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801fe3:	77 12                	ja     801ff7 <fbuf+0x2d>
+  801fe5:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  801fe9:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  801ff0:	00 00 00 
+  801ff3:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  801ff7:	48 89 d0             	mov    %rdx,%rax
+  801ffa:	5d                   	pop    %rbp
+  801ffb:	c3                   	ret
+
+0000000000801ffc <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802000:	48 83 c7 40          	add    $0x40,%rdi
+  802004:	48 b8 d1 4b 80 00 00 	movabs $0x804bd1,%rax
+  80200b:	00 00 00 
+  80200e:	ff d0                	call   *%rax
+  802010:	84 c0                	test   %al,%al
+  802012:	75 02                	jne    802016 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802014:	5d                   	pop    %rbp
+  802015:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802016:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  80201d:	00 00 00 
+  802020:	ff d0                	call   *%rax
+  802022:	89 c7                	mov    %eax,%edi
+  802024:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80202a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80202f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802034:	be 0a 00 00 00       	mov    $0xa,%esi
+  802039:	48 b8 dc 52 80 00 00 	movabs $0x8052dc,%rax
+  802040:	00 00 00 
+  802043:	ff d0                	call   *%rax
+}
+  802045:	eb cd                	jmp    802014 <fschan_publish+0x18>
+
+0000000000802047 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802047:	55                   	push   %rbp
+  802048:	48 89 e5             	mov    %rsp,%rbp
+  80204b:	41 57                	push   %r15
+  80204d:	41 56                	push   %r14
+  80204f:	41 55                	push   %r13
+  802051:	41 54                	push   %r12
+  802053:	53                   	push   %rbx
+  802054:	48 83 ec 48          	sub    $0x48,%rsp
+  802058:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80205c:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802060:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802063:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802067:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80206a:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802071:	00 00 00 
+  802074:	8b 02                	mov    (%rdx),%eax
+  802076:	83 c0 01             	add    $0x1,%eax
+  802079:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80207e:	0f 44 c1             	cmove  %ecx,%eax
+  802081:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802083:	4d 85 c0             	test   %r8,%r8
+  802086:	74 2c                	je     8020b4 <fschan_rw+0x6d>
+  802088:	45 89 ce             	mov    %r9d,%r14d
+  80208b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802092:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802096:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80209c:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8020a3:	00 
+  8020a4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020aa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020af:	e9 41 01 00 00       	jmp    8021f5 <fschan_rw+0x1ae>
+  8020b4:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8020b8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020bc:	e9 9c 01 00 00       	jmp    80225d <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8020c1:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8020c5:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8020c8:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8020cb:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8020ce:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8020d2:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020d6:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8020da:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8020de:	48 89 da             	mov    %rbx,%rdx
+  8020e1:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  8020e8:	00 00 00 
+  8020eb:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8020ed:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8020f1:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  8020f8:	00 00 00 
+  8020fb:	ff d0                	call   *%rax
+            queued += blk;
+  8020fd:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802100:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802104:	4d 39 fc             	cmp    %r15,%r12
+  802107:	73 6b                	jae    802174 <fschan_rw+0x12d>
+  802109:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80210d:	77 65                	ja     802174 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80210f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802113:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802117:	48 b8 ac 4b 80 00 00 	movabs $0x804bac,%rax
+  80211e:	00 00 00 
+  802121:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802123:	4c 89 fb             	mov    %r15,%rbx
+  802126:	4c 29 e3             	sub    %r12,%rbx
+  802129:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80212e:	48 39 d3             	cmp    %rdx,%rbx
+  802131:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802135:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802139:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80213d:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802141:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802144:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802146:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80214d:	00 00 00 
+  802150:	8b 09                	mov    (%rcx),%ecx
+  802152:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802155:	83 fe 03             	cmp    $0x3,%esi
+  802158:	0f 85 63 ff ff ff    	jne    8020c1 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80215e:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802162:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802165:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802168:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80216b:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80216f:	e9 79 ff ff ff       	jmp    8020ed <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802174:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802178:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80217f:	48 89 df             	mov    %rbx,%rdi
+  802182:	48 b8 6f 4c 80 00 00 	movabs $0x804c6f,%rax
+  802189:	00 00 00 
+  80218c:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80218e:	48 89 df             	mov    %rbx,%rdi
+  802191:	48 b8 fd 4b 80 00 00 	movabs $0x804bfd,%rax
+  802198:	00 00 00 
+  80219b:	ff d0                	call   *%rax
+  80219d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8021a1:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8021a5:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8021a9:	75 25                	jne    8021d0 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8021ab:	8b 40 04             	mov    0x4(%rax),%eax
+  8021ae:	85 c0                	test   %eax,%eax
+  8021b0:	0f 88 86 00 00 00    	js     80223c <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021b6:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8021ba:	74 5b                	je     802217 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8021bc:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021c0:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8021c4:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8021c8:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8021cc:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8021d0:	48 89 df             	mov    %rbx,%rdi
+  8021d3:	48 b8 24 4c 80 00 00 	movabs $0x804c24,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8021df:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8021e3:	83 f0 01             	xor    $0x1,%eax
+  8021e6:	4d 39 fc             	cmp    %r15,%r12
+  8021e9:	0f 92 c2             	setb   %dl
+  8021ec:	84 c2                	test   %al,%dl
+  8021ee:	75 05                	jne    8021f5 <fschan_rw+0x1ae>
+  8021f0:	45 85 ed             	test   %r13d,%r13d
+  8021f3:	74 50                	je     802245 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8021f5:	4d 39 fc             	cmp    %r15,%r12
+  8021f8:	0f 92 c1             	setb   %cl
+  8021fb:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8021ff:	0f 96 c2             	setbe  %dl
+  802202:	84 d1                	test   %dl,%cl
+  802204:	0f 84 6a ff ff ff    	je     802174 <fschan_rw+0x12d>
+  80220a:	84 c0                	test   %al,%al
+  80220c:	0f 85 fd fe ff ff    	jne    80210f <fschan_rw+0xc8>
+  802212:	e9 5d ff ff ff       	jmp    802174 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802217:	48 63 d0             	movslq %eax,%rdx
+  80221a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80221e:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802222:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802226:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80222a:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80222e:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802235:	00 00 00 
+  802238:	ff d0                	call   *%rax
+  80223a:	eb 80                	jmp    8021bc <fschan_rw+0x175>
+                err = msg->fm_res;
+  80223c:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80223f:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802243:	eb 8b                	jmp    8021d0 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802245:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80224a:	0f 85 68 fe ff ff    	jne    8020b8 <fschan_rw+0x71>
+  802250:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802253:	85 c0                	test   %eax,%eax
+  802255:	0f 84 5d fe ff ff    	je     8020b8 <fschan_rw+0x71>
+  80225b:	48 98                	cltq
+}
+  80225d:	48 83 c4 48          	add    $0x48,%rsp
+  802261:	5b                   	pop    %rbx
+  802262:	41 5c                	pop    %r12
+  802264:	41 5d                	pop    %r13
+  802266:	41 5e                	pop    %r14
+  802268:	41 5f                	pop    %r15
+  80226a:	5d                   	pop    %rbp
+  80226b:	c3                   	ret
+
+000000000080226c <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80226c:	55                   	push   %rbp
+  80226d:	48 89 e5             	mov    %rsp,%rbp
+  802270:	41 56                	push   %r14
+  802272:	41 55                	push   %r13
+  802274:	41 54                	push   %r12
+  802276:	53                   	push   %rbx
+  802277:	48 83 ec 10          	sub    $0x10,%rsp
+  80227b:	49 89 fe             	mov    %rdi,%r14
+  80227e:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802281:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802285:	48 29 f3             	sub    %rsi,%rbx
+  802288:	48 39 d3             	cmp    %rdx,%rbx
+  80228b:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80228f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802296:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802297:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80229c:	49 bd 9f 47 80 00 00 	movabs $0x80479f,%r13
+  8022a3:	00 00 00 
+  8022a6:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8022ad:	76 1e                	jbe    8022cd <mmap_fault+0x61>
+  8022af:	4c 01 e7             	add    %r12,%rdi
+  8022b2:	41 ff d5             	call   *%r13
+  8022b5:	84 c0                	test   %al,%al
+  8022b7:	75 14                	jne    8022cd <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8022b9:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022bd:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8022c4:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8022c8:	48 39 df             	cmp    %rbx,%rdi
+  8022cb:	72 e2                	jb     8022af <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8022cd:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8022d4:	00 00 00 
+  8022d7:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022de:	00 00 00 
+  8022e1:	4c 89 f0             	mov    %r14,%rax
+  8022e4:	48 29 d0             	sub    %rdx,%rax
+  8022e7:	48 c1 f8 03          	sar    $0x3,%rax
+  8022eb:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8022f2:	aa aa aa 
+  8022f5:	48 0f af c2          	imul   %rdx,%rax
+  8022f9:	48 c1 e0 0c          	shl    $0xc,%rax
+  8022fd:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802302:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802306:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802308:	44 89 e0             	mov    %r12d,%eax
+  80230b:	41 03 46 10          	add    0x10(%r14),%eax
+  80230f:	41 2b 06             	sub    (%r14),%eax
+  802312:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802315:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802319:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80231d:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802321:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802324:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  80232b:	00 00 00 
+  80232e:	ff d0                	call   *%rax
+  802330:	89 c7                	mov    %eax,%edi
+  802332:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802338:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80233d:	48 89 da             	mov    %rbx,%rdx
+  802340:	be 0f 00 00 00       	mov    $0xf,%esi
+  802345:	48 b8 dc 52 80 00 00 	movabs $0x8052dc,%rax
+  80234c:	00 00 00 
+  80234f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802351:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802356:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80235a:	4c 89 e6             	mov    %r12,%rsi
+  80235d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802362:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  802369:	00 00 00 
+  80236c:	ff d0                	call   *%rax
+  80236e:	48 98                	cltq
+}
+  802370:	48 83 c4 10          	add    $0x10,%rsp
+  802374:	5b                   	pop    %rbx
+  802375:	41 5c                	pop    %r12
+  802377:	41 5d                	pop    %r13
+  802379:	41 5e                	pop    %r14
+  80237b:	5d                   	pop    %rbp
+  80237c:	c3                   	ret
+
+000000000080237d <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80237d:	48 8b 37             	mov    (%rdi),%rsi
+  802380:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802387:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80238e:	00 00 00 
+  802391:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802396:	eb 0f                	jmp    8023a7 <mmap_pgfault+0x2a>
+  802398:	c3                   	ret
+  802399:	48 83 c1 01          	add    $0x1,%rcx
+  80239d:	48 83 c2 18          	add    $0x18,%rdx
+  8023a1:	48 83 f9 20          	cmp    $0x20,%rcx
+  8023a5:	74 6e                	je     802415 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023a7:	48 8b 02             	mov    (%rdx),%rax
+  8023aa:	48 83 e8 01          	sub    $0x1,%rax
+  8023ae:	48 39 f0             	cmp    %rsi,%rax
+  8023b1:	73 e6                	jae    802399 <mmap_pgfault+0x1c>
+  8023b3:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8023b7:	73 e0                	jae    802399 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023b9:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8023bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023c2:	f6 c2 01             	test   $0x1,%dl
+  8023c5:	75 d1                	jne    802398 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8023c7:	f6 c2 02             	test   $0x2,%dl
+  8023ca:	74 1a                	je     8023e6 <mmap_pgfault+0x69>
+  8023cc:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023d5:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8023dc:	00 00 00 
+  8023df:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8023e4:	74 35                	je     80241b <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8023e6:	55                   	push   %rbp
+  8023e7:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023ea:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023ee:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023f5:	00 00 00 
+  8023f8:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8023fc:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802401:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+  80240d:	48 85 c0             	test   %rax,%rax
+  802410:	0f 9f c0             	setg   %al
+}
+  802413:	5d                   	pop    %rbp
+  802414:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802415:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241a:	c3                   	ret
+}
+  80241b:	c3                   	ret
+
+000000000080241c <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80241c:	55                   	push   %rbp
+  80241d:	48 89 e5             	mov    %rsp,%rbp
+  802420:	41 54                	push   %r12
+  802422:	53                   	push   %rbx
+  802423:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802426:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80242d:	00 00 00 
+  802430:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802435:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802439:	74 15                	je     802450 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80243b:	48 83 c3 01          	add    $0x1,%rbx
+  80243f:	48 83 c0 18          	add    $0x18,%rax
+  802443:	48 83 fb 20          	cmp    $0x20,%rbx
+  802447:	75 ec                	jne    802435 <mmap_alloc+0x19>
+    return NULL;
+  802449:	b8 00 00 00 00       	mov    $0x0,%eax
+  80244e:	eb 52                	jmp    8024a2 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802450:	4c 89 e7             	mov    %r12,%rdi
+  802453:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  80245a:	00 00 00 
+  80245d:	ff d0                	call   *%rax
+  80245f:	41 89 c1             	mov    %eax,%r9d
+  802462:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802469:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80246d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802473:	ba 00 00 00 00       	mov    $0x0,%edx
+  802478:	4c 89 e6             	mov    %r12,%rsi
+  80247b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802480:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  802487:	00 00 00 
+  80248a:	ff d0                	call   *%rax
+  80248c:	85 c0                	test   %eax,%eax
+  80248e:	78 17                	js     8024a7 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802490:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802494:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80249b:	00 00 00 
+  80249e:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8024a2:	5b                   	pop    %rbx
+  8024a3:	41 5c                	pop    %r12
+  8024a5:	5d                   	pop    %rbp
+  8024a6:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024ac:	eb f4                	jmp    8024a2 <mmap_alloc+0x86>
+
+00000000008024ae <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8024ae:	55                   	push   %rbp
+  8024af:	48 89 e5             	mov    %rsp,%rbp
+  8024b2:	41 56                	push   %r14
+  8024b4:	41 55                	push   %r13
+  8024b6:	41 54                	push   %r12
+  8024b8:	53                   	push   %rbx
+  8024b9:	48 83 ec 10          	sub    $0x10,%rsp
+  8024bd:	41 89 fc             	mov    %edi,%r12d
+  8024c0:	49 89 f5             	mov    %rsi,%r13
+  8024c3:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024c6:	48 89 f0             	mov    %rsi,%rax
+  8024c9:	48 09 d0             	or     %rdx,%rax
+  8024cc:	75 0d                	jne    8024db <fsipc+0x2d>
+  8024ce:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8024d1:	83 f8 04             	cmp    $0x4,%eax
+  8024d4:	76 7d                	jbe    802553 <fsipc+0xa5>
+  8024d6:	83 ff 0d             	cmp    $0xd,%edi
+  8024d9:	74 78                	je     802553 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8024db:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  8024e2:	00 00 00 
+  8024e5:	ff d0                	call   *%rax
+  8024e7:	89 c7                	mov    %eax,%edi
+  8024e9:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8024f0:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8024f7:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8024fe:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802504:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80250b:	00 00 00 
+  80250e:	44 89 e6             	mov    %r12d,%esi
+  802511:	48 b8 dc 52 80 00 00 	movabs $0x8052dc,%rax
+  802518:	00 00 00 
+  80251b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80251d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802524:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802525:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80252a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80252e:	4c 89 ee             	mov    %r13,%rsi
+  802531:	bf 00 00 00 00       	mov    $0x0,%edi
+  802536:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  80253d:	00 00 00 
+  802540:	ff d0                	call   *%rax
+  802542:	89 c3                	mov    %eax,%ebx
+}
+  802544:	89 d8                	mov    %ebx,%eax
+  802546:	48 83 c4 10          	add    $0x10,%rsp
+  80254a:	5b                   	pop    %rbx
+  80254b:	41 5c                	pop    %r12
+  80254d:	41 5d                	pop    %r13
+  80254f:	41 5e                	pop    %r14
+  802551:	5d                   	pop    %rbp
+  802552:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802553:	48 b8 60 1f 80 00 00 	movabs $0x801f60,%rax
+  80255a:	00 00 00 
+  80255d:	ff d0                	call   *%rax
+  80255f:	49 89 c6             	mov    %rax,%r14
+  802562:	48 85 c0             	test   %rax,%rax
+  802565:	0f 84 70 ff ff ff    	je     8024db <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80256b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80256f:	48 b8 ac 4b 80 00 00 	movabs $0x804bac,%rax
+  802576:	00 00 00 
+  802579:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80257b:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80257e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802585:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802589:	ba 10 00 00 00       	mov    $0x10,%edx
+  80258e:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802595:	00 00 00 
+  802598:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  80259f:	00 00 00 
+  8025a2:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8025a4:	4c 89 f7             	mov    %r14,%rdi
+  8025a7:	48 b8 fc 1f 80 00 00 	movabs $0x801ffc,%rax
+  8025ae:	00 00 00 
+  8025b1:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8025b3:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8025ba:	4c 89 f7             	mov    %r14,%rdi
+  8025bd:	48 b8 6f 4c 80 00 00 	movabs $0x804c6f,%rax
+  8025c4:	00 00 00 
+  8025c7:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8025c9:	4c 89 f7             	mov    %r14,%rdi
+  8025cc:	48 b8 fd 4b 80 00 00 	movabs $0x804bfd,%rax
+  8025d3:	00 00 00 
+  8025d6:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8025d8:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8025db:	41 83 fc 05          	cmp    $0x5,%r12d
+  8025df:	75 04                	jne    8025e5 <fsipc+0x137>
+  8025e1:	85 db                	test   %ebx,%ebx
+  8025e3:	79 14                	jns    8025f9 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8025e5:	4c 89 f7             	mov    %r14,%rdi
+  8025e8:	48 b8 24 4c 80 00 00 	movabs $0x804c24,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8025f4:	e9 4b ff ff ff       	jmp    802544 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8025f9:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025fd:	ba 88 00 00 00       	mov    $0x88,%edx
+  802602:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802609:	00 00 00 
+  80260c:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802613:	00 00 00 
+  802616:	ff d0                	call   *%rax
+  802618:	eb cb                	jmp    8025e5 <fsipc+0x137>
+
+000000000080261a <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80261a:	55                   	push   %rbp
+  80261b:	48 89 e5             	mov    %rsp,%rbp
+  80261e:	41 57                	push   %r15
+  802620:	41 56                	push   %r14
+  802622:	41 55                	push   %r13
+  802624:	41 54                	push   %r12
+  802626:	53                   	push   %rbx
+  802627:	48 83 ec 18          	sub    $0x18,%rsp
+  80262b:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80262f:	49 89 f6             	mov    %rsi,%r14
+  802632:	49 89 d4             	mov    %rdx,%r12
+  802635:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802638:	48 b8 60 1f 80 00 00 	movabs $0x801f60,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802644:	48 85 c0             	test   %rax,%rax
+  802647:	0f 85 96 00 00 00    	jne    8026e3 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80264d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802654:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802655:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  80265c:	00 00 00 
+    while (n) {
+  80265f:	4d 85 e4             	test   %r12,%r12
+  802662:	74 79                	je     8026dd <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802664:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802669:	49 39 dc             	cmp    %rbx,%r12
+  80266c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802670:	48 89 da             	mov    %rbx,%rdx
+  802673:	4c 89 f6             	mov    %r14,%rsi
+  802676:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80267d:	00 00 00 
+  802680:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802687:	00 00 00 
+  80268a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80268c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802690:	8b 40 0c             	mov    0xc(%rax),%eax
+  802693:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802696:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802699:	44 01 e8             	add    %r13d,%eax
+  80269c:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8026a0:	41 0f 44 c5          	cmove  %r13d,%eax
+  8026a4:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8026a8:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8026ac:	48 89 da             	mov    %rbx,%rdx
+  8026af:	be 00 00 00 00       	mov    $0x0,%esi
+  8026b4:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026b9:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  8026c0:	00 00 00 
+  8026c3:	ff d0                	call   *%rax
+        if (res < 0)
+  8026c5:	85 c0                	test   %eax,%eax
+  8026c7:	78 4a                	js     802713 <devfile_write_direct+0xf9>
+        buf += res;
+  8026c9:	48 98                	cltq
+  8026cb:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8026ce:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8026d2:	49 29 c4             	sub    %rax,%r12
+  8026d5:	75 8d                	jne    802664 <devfile_write_direct+0x4a>
+    return write;
+  8026d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026db:	eb 27                	jmp    802704 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8026dd:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8026e1:	eb f4                	jmp    8026d7 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8026e3:	45 89 e9             	mov    %r13d,%r9d
+  8026e6:	4d 89 e0             	mov    %r12,%r8
+  8026e9:	4c 89 f1             	mov    %r14,%rcx
+  8026ec:	ba 04 00 00 00       	mov    $0x4,%edx
+  8026f1:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8026f5:	48 89 c7             	mov    %rax,%rdi
+  8026f8:	48 b8 47 20 80 00 00 	movabs $0x802047,%rax
+  8026ff:	00 00 00 
+  802702:	ff d0                	call   *%rax
+}
+  802704:	48 83 c4 18          	add    $0x18,%rsp
+  802708:	5b                   	pop    %rbx
+  802709:	41 5c                	pop    %r12
+  80270b:	41 5d                	pop    %r13
+  80270d:	41 5e                	pop    %r14
+  80270f:	41 5f                	pop    %r15
+  802711:	5d                   	pop    %rbp
+  802712:	c3                   	ret
+            return res;
+  802713:	48 98                	cltq
+  802715:	eb ed                	jmp    802704 <devfile_write_direct+0xea>
+
+0000000000802717 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802717:	55                   	push   %rbp
+  802718:	48 89 e5             	mov    %rsp,%rbp
+  80271b:	41 54                	push   %r12
+  80271d:	53                   	push   %rbx
+  80271e:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802721:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  802728:	00 00 00 
+  80272b:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80272d:	48 85 c0             	test   %rax,%rax
+  802730:	74 71                	je     8027a3 <fbuf_flush+0x8c>
+  802732:	48 89 c3             	mov    %rax,%rbx
+  802735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273a:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80273e:	75 05                	jne    802745 <fbuf_flush+0x2e>
+}
+  802740:	5b                   	pop    %rbx
+  802741:	41 5c                	pop    %r12
+  802743:	5d                   	pop    %rbp
+  802744:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802745:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802748:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80274c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802753:	00 00 00 
+  802756:	48 89 de             	mov    %rbx,%rsi
+  802759:	48 29 c6             	sub    %rax,%rsi
+  80275c:	48 c1 fe 03          	sar    $0x3,%rsi
+  802760:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802767:	aa aa aa 
+  80276a:	48 0f af f0          	imul   %rax,%rsi
+  80276e:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802772:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802777:	48 01 c6             	add    %rax,%rsi
+  80277a:	4c 89 e7             	mov    %r12,%rdi
+  80277d:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  802784:	00 00 00 
+  802787:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802789:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80278d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802794:	00 
+    return res < 0 ? res : 0;
+  802795:	48 85 c0             	test   %rax,%rax
+  802798:	ba 00 00 00 00       	mov    $0x0,%edx
+  80279d:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8027a1:	eb 9d                	jmp    802740 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8027a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a8:	eb 96                	jmp    802740 <fbuf_flush+0x29>
+
+00000000008027aa <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8027aa:	55                   	push   %rbp
+  8027ab:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8027ae:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8027b5:	00 00 00 
+  8027b8:	ff d0                	call   *%rax
+}
+  8027ba:	5d                   	pop    %rbp
+  8027bb:	c3                   	ret
+
+00000000008027bc <devfile_write>:
+    if (!fd || !buf)
+  8027bc:	48 85 ff             	test   %rdi,%rdi
+  8027bf:	0f 84 d3 01 00 00    	je     802998 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8027c5:	55                   	push   %rbp
+  8027c6:	48 89 e5             	mov    %rsp,%rbp
+  8027c9:	41 57                	push   %r15
+  8027cb:	41 56                	push   %r14
+  8027cd:	41 55                	push   %r13
+  8027cf:	41 54                	push   %r12
+  8027d1:	53                   	push   %rbx
+  8027d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8027d6:	49 89 fc             	mov    %rdi,%r12
+  8027d9:	49 89 f6             	mov    %rsi,%r14
+  8027dc:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8027df:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8027e4:	48 85 f6             	test   %rsi,%rsi
+  8027e7:	0f 84 9c 01 00 00    	je     802989 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8027ed:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  8027f4:	00 00 00 
+  8027f7:	ff d0                	call   *%rax
+  8027f9:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8027fc:	48 85 c0             	test   %rax,%rax
+  8027ff:	0f 84 a2 00 00 00    	je     8028a7 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802805:	be 00 10 00 00       	mov    $0x1000,%esi
+  80280a:	4c 89 e7             	mov    %r12,%rdi
+  80280d:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802819:	83 f8 02             	cmp    $0x2,%eax
+  80281c:	0f 8f 85 00 00 00    	jg     8028a7 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802822:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802829:	00 00 00 
+  80282c:	4d 89 ef             	mov    %r13,%r15
+  80282f:	49 29 c7             	sub    %rax,%r15
+  802832:	49 c1 ff 03          	sar    $0x3,%r15
+  802836:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80283d:	aa aa aa 
+  802840:	4c 0f af f8          	imul   %rax,%r15
+  802844:	49 c1 e7 0e          	shl    $0xe,%r15
+  802848:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80284d:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802850:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802855:	0f 84 d7 00 00 00    	je     802932 <devfile_write+0x176>
+  80285b:	49 8b 45 10          	mov    0x10(%r13),%rax
+  80285f:	89 c2                	mov    %eax,%edx
+  802861:	41 03 55 0c          	add    0xc(%r13),%edx
+  802865:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80286a:	75 0f                	jne    80287b <devfile_write+0xbf>
+  80286c:	48 01 d8             	add    %rbx,%rax
+  80286f:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802875:	0f 86 92 00 00 00    	jbe    80290d <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80287b:	4c 89 e7             	mov    %r12,%rdi
+  80287e:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  802885:	00 00 00 
+  802888:	ff d0                	call   *%rax
+  80288a:	85 c0                	test   %eax,%eax
+  80288c:	78 52                	js     8028e0 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80288e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802895:	77 7f                	ja     802916 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802897:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80289c:	0f 85 c2 00 00 00    	jne    802964 <devfile_write+0x1a8>
+  8028a2:	e9 94 00 00 00       	jmp    80293b <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8028a7:	4c 89 e7             	mov    %r12,%rdi
+  8028aa:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8028b1:	00 00 00 
+  8028b4:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028b6:	85 c0                	test   %eax,%eax
+  8028b8:	79 07                	jns    8028c1 <devfile_write+0x105>
+  8028ba:	48 98                	cltq
+  8028bc:	e9 c8 00 00 00       	jmp    802989 <devfile_write+0x1cd>
+  8028c1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028c6:	48 89 da             	mov    %rbx,%rdx
+  8028c9:	4c 89 f6             	mov    %r14,%rsi
+  8028cc:	4c 89 e7             	mov    %r12,%rdi
+  8028cf:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  8028d6:	00 00 00 
+  8028d9:	ff d0                	call   *%rax
+  8028db:	e9 a9 00 00 00       	jmp    802989 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028e0:	48 98                	cltq
+  8028e2:	e9 a2 00 00 00       	jmp    802989 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8028e7:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8028ec:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8028f1:	4c 89 fe             	mov    %r15,%rsi
+  8028f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f9:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  802900:	00 00 00 
+  802903:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802905:	85 c0                	test   %eax,%eax
+  802907:	79 45                	jns    80294e <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802909:	48 98                	cltq
+  80290b:	eb 7c                	jmp    802989 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80290d:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802914:	76 4e                	jbe    802964 <devfile_write+0x1a8>
+  802916:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80291b:	48 89 da             	mov    %rbx,%rdx
+  80291e:	4c 89 f6             	mov    %r14,%rsi
+  802921:	4c 89 e7             	mov    %r12,%rdi
+  802924:	48 b8 1a 26 80 00 00 	movabs $0x80261a,%rax
+  80292b:	00 00 00 
+  80292e:	ff d0                	call   *%rax
+  802930:	eb 57                	jmp    802989 <devfile_write+0x1cd>
+  802932:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802939:	77 db                	ja     802916 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80293b:	4c 89 ff             	mov    %r15,%rdi
+  80293e:	48 b8 9f 47 80 00 00 	movabs $0x80479f,%rax
+  802945:	00 00 00 
+  802948:	ff d0                	call   *%rax
+  80294a:	84 c0                	test   %al,%al
+  80294c:	74 99                	je     8028e7 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80294e:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802953:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802958:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  80295c:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802963:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802964:	4c 89 ff             	mov    %r15,%rdi
+  802967:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80296b:	48 89 da             	mov    %rbx,%rdx
+  80296e:	4c 89 f6             	mov    %r14,%rsi
+  802971:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802978:	00 00 00 
+  80297b:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80297d:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802981:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802986:	48 89 d8             	mov    %rbx,%rax
+}
+  802989:	48 83 c4 08          	add    $0x8,%rsp
+  80298d:	5b                   	pop    %rbx
+  80298e:	41 5c                	pop    %r12
+  802990:	41 5d                	pop    %r13
+  802992:	41 5e                	pop    %r14
+  802994:	41 5f                	pop    %r15
+  802996:	5d                   	pop    %rbp
+  802997:	c3                   	ret
+        return E_INVAL;
+  802998:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80299d:	c3                   	ret
+
+000000000080299e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80299e:	55                   	push   %rbp
+  80299f:	48 89 e5             	mov    %rsp,%rbp
+  8029a2:	41 54                	push   %r12
+  8029a4:	53                   	push   %rbx
+  8029a5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8029a8:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  8029af:	00 00 00 
+  8029b2:	ff d0                	call   *%rax
+  8029b4:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8029b7:	48 89 df             	mov    %rbx,%rdi
+  8029ba:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  8029c1:	00 00 00 
+  8029c4:	ff d0                	call   *%rax
+  8029c6:	48 85 c0             	test   %rax,%rax
+  8029c9:	74 17                	je     8029e2 <devfile_flush+0x44>
+  8029cb:	48 89 df             	mov    %rbx,%rdi
+  8029ce:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  8029d5:	00 00 00 
+  8029d8:	ff d0                	call   *%rax
+  8029da:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8029e1:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029e2:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029e5:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8029ec:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8029ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8029f8:	bf 06 00 00 00       	mov    $0x6,%edi
+  8029fd:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  802a04:	00 00 00 
+  802a07:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a09:	45 85 e4             	test   %r12d,%r12d
+  802a0c:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a10:	5b                   	pop    %rbx
+  802a11:	41 5c                	pop    %r12
+  802a13:	5d                   	pop    %rbp
+  802a14:	c3                   	ret
+
+0000000000802a15 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a15:	55                   	push   %rbp
+  802a16:	48 89 e5             	mov    %rsp,%rbp
+  802a19:	41 57                	push   %r15
+  802a1b:	41 56                	push   %r14
+  802a1d:	41 55                	push   %r13
+  802a1f:	41 54                	push   %r12
+  802a21:	53                   	push   %rbx
+  802a22:	48 83 ec 38          	sub    $0x38,%rsp
+  802a26:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a2a:	49 89 f7             	mov    %rsi,%r15
+  802a2d:	48 89 d3             	mov    %rdx,%rbx
+  802a30:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a33:	48 b8 60 1f 80 00 00 	movabs $0x801f60,%rax
+  802a3a:	00 00 00 
+  802a3d:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a3f:	48 85 c0             	test   %rax,%rax
+  802a42:	75 20                	jne    802a64 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a44:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a49:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a50:	00 
+    while (n) {
+  802a51:	48 85 db             	test   %rbx,%rbx
+  802a54:	0f 85 df 00 00 00    	jne    802b39 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a5a:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a5e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a62:	eb 21                	jmp    802a85 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a64:	45 89 f1             	mov    %r14d,%r9d
+  802a67:	49 89 d8             	mov    %rbx,%r8
+  802a6a:	4c 89 f9             	mov    %r15,%rcx
+  802a6d:	ba 03 00 00 00       	mov    $0x3,%edx
+  802a72:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a76:	48 89 c7             	mov    %rax,%rdi
+  802a79:	48 b8 47 20 80 00 00 	movabs $0x802047,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+}
+  802a85:	48 83 c4 38          	add    $0x38,%rsp
+  802a89:	5b                   	pop    %rbx
+  802a8a:	41 5c                	pop    %r12
+  802a8c:	41 5d                	pop    %r13
+  802a8e:	41 5e                	pop    %r14
+  802a90:	41 5f                	pop    %r15
+  802a92:	5d                   	pop    %rbp
+  802a93:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802a94:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802a98:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802a9e:	75 1e                	jne    802abe <devfile_read_direct+0xa9>
+  802aa0:	e9 e2 00 00 00       	jmp    802b87 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802aa5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802aa9:	eb da                	jmp    802a85 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802aab:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802aaf:	0f 85 d0 01 00 00    	jne    802c85 <devfile_read_direct+0x270>
+            map = 0;
+  802ab5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ab9:	eb 03                	jmp    802abe <devfile_read_direct+0xa9>
+  802abb:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802abe:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802ac3:	48 39 d3             	cmp    %rdx,%rbx
+  802ac6:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802aca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ace:	8b 40 0c             	mov    0xc(%rax),%eax
+  802ad1:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802ad8:	00 00 00 
+  802adb:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802add:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802ae1:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ae5:	be 00 00 00 00       	mov    $0x0,%esi
+  802aea:	bf 03 00 00 00       	mov    $0x3,%edi
+  802aef:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  802af6:	00 00 00 
+  802af9:	ff d0                	call   *%rax
+        if (res <= 0)
+  802afb:	85 c0                	test   %eax,%eax
+  802afd:	0f 8e 63 01 00 00    	jle    802c66 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b03:	4c 63 e0             	movslq %eax,%r12
+  802b06:	4c 89 e2             	mov    %r12,%rdx
+  802b09:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b10:	00 00 00 
+  802b13:	4c 89 ff             	mov    %r15,%rdi
+  802b16:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802b1d:	00 00 00 
+  802b20:	ff d0                	call   *%rax
+        buf += res;
+  802b22:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b25:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b28:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b2c:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b30:	48 85 db             	test   %rbx,%rbx
+  802b33:	0f 84 25 ff ff ff    	je     802a5e <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b39:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b3c:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b40:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b44:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b48:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b4f:	0f 97 c2             	seta   %dl
+  802b52:	20 c2                	and    %al,%dl
+  802b54:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b57:	0f 84 5e ff ff ff    	je     802abb <devfile_read_direct+0xa6>
+  802b5d:	4c 89 fa             	mov    %r15,%rdx
+  802b60:	4d 89 fd             	mov    %r15,%r13
+  802b63:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802b6a:	0f 85 4e ff ff ff    	jne    802abe <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802b70:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b74:	0f 84 1a ff ff ff    	je     802a94 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b7a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b81:	0f 85 37 ff ff ff    	jne    802abe <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802b87:	48 89 d8             	mov    %rbx,%rax
+  802b8a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802b90:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802b95:	48 39 c8             	cmp    %rcx,%rax
+  802b98:	48 0f 47 c1          	cmova  %rcx,%rax
+  802b9c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ba0:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802ba4:	49 89 d4             	mov    %rdx,%r12
+  802ba7:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802bab:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  802bb2:	00 00 00 
+  802bb5:	ff d0                	call   *%rax
+  802bb7:	a8 40                	test   $0x40,%al
+  802bb9:	0f 85 b9 00 00 00    	jne    802c78 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802bbf:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802bc6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bca:	49 39 c5             	cmp    %rax,%r13
+  802bcd:	72 d8                	jb     802ba7 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802bcf:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802bd3:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802bda:	00 00 00 
+  802bdd:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802be1:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802be4:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802be6:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802bea:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802bee:	48 b8 fb 1d 80 00 00 	movabs $0x801dfb,%rax
+  802bf5:	00 00 00 
+  802bf8:	ff d0                	call   *%rax
+  802bfa:	89 c7                	mov    %eax,%edi
+  802bfc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c02:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c07:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c0e:	00 00 00 
+  802c11:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c16:	48 b8 dc 52 80 00 00 	movabs $0x8052dc,%rax
+  802c1d:	00 00 00 
+  802c20:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802c22:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c27:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c2b:	4c 89 fe             	mov    %r15,%rsi
+  802c2e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c33:	48 b8 b8 52 80 00 00 	movabs $0x8052b8,%rax
+  802c3a:	00 00 00 
+  802c3d:	ff d0                	call   *%rax
+  802c3f:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c42:	48 85 d2             	test   %rdx,%rdx
+  802c45:	0f 84 5a fe ff ff    	je     802aa5 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c4b:	0f 8e 5a fe ff ff    	jle    802aab <devfile_read_direct+0x96>
+                buf += res;
+  802c51:	48 98                	cltq
+  802c53:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c56:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c59:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c5d:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c61:	e9 ca fe ff ff       	jmp    802b30 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c66:	41 89 c5             	mov    %eax,%r13d
+  802c69:	48 98                	cltq
+  802c6b:	45 85 ed             	test   %r13d,%r13d
+  802c6e:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802c73:	e9 0d fe ff ff       	jmp    802a85 <devfile_read_direct+0x70>
+            map = 0;
+  802c78:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c7c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c80:	e9 39 fe ff ff       	jmp    802abe <devfile_read_direct+0xa9>
+  802c85:	48 89 d0             	mov    %rdx,%rax
+  802c88:	e9 f8 fd ff ff       	jmp    802a85 <devfile_read_direct+0x70>
+
+0000000000802c8d <devfile_read>:
+    if (!fd || !buf)
+  802c8d:	48 85 ff             	test   %rdi,%rdi
+  802c90:	0f 84 21 02 00 00    	je     802eb7 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802c96:	55                   	push   %rbp
+  802c97:	48 89 e5             	mov    %rsp,%rbp
+  802c9a:	41 57                	push   %r15
+  802c9c:	41 56                	push   %r14
+  802c9e:	41 55                	push   %r13
+  802ca0:	41 54                	push   %r12
+  802ca2:	53                   	push   %rbx
+  802ca3:	48 83 ec 28          	sub    $0x28,%rsp
+  802ca7:	48 89 fb             	mov    %rdi,%rbx
+  802caa:	49 89 f4             	mov    %rsi,%r12
+  802cad:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802cb0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802cb5:	48 85 f6             	test   %rsi,%rsi
+  802cb8:	74 4b                	je     802d05 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802cba:	48 b8 ca 1f 80 00 00 	movabs $0x801fca,%rax
+  802cc1:	00 00 00 
+  802cc4:	ff d0                	call   *%rax
+  802cc6:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802cc9:	48 85 c0             	test   %rax,%rax
+  802ccc:	74 22                	je     802cf0 <devfile_read+0x63>
+  802cce:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802cd5:	77 19                	ja     802cf0 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802cd7:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cdc:	48 89 df             	mov    %rbx,%rdi
+  802cdf:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  802ce6:	00 00 00 
+  802ce9:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ceb:	83 f8 02             	cmp    $0x2,%eax
+  802cee:	7e 40                	jle    802d30 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802cf0:	48 89 df             	mov    %rbx,%rdi
+  802cf3:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  802cfa:	00 00 00 
+  802cfd:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cff:	85 c0                	test   %eax,%eax
+  802d01:	79 11                	jns    802d14 <devfile_read+0x87>
+  802d03:	48 98                	cltq
+}
+  802d05:	48 83 c4 28          	add    $0x28,%rsp
+  802d09:	5b                   	pop    %rbx
+  802d0a:	41 5c                	pop    %r12
+  802d0c:	41 5d                	pop    %r13
+  802d0e:	41 5e                	pop    %r14
+  802d10:	41 5f                	pop    %r15
+  802d12:	5d                   	pop    %rbp
+  802d13:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d14:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d19:	4c 89 ea             	mov    %r13,%rdx
+  802d1c:	4c 89 e6             	mov    %r12,%rsi
+  802d1f:	48 89 df             	mov    %rbx,%rdi
+  802d22:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	eb d5                	jmp    802d05 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d30:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d34:	48 89 df             	mov    %rbx,%rdi
+  802d37:	48 b8 17 27 80 00 00 	movabs $0x802717,%rax
+  802d3e:	00 00 00 
+  802d41:	ff d0                	call   *%rax
+  802d43:	85 c0                	test   %eax,%eax
+  802d45:	0f 88 33 01 00 00    	js     802e7e <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d4b:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d52:	00 00 00 
+  802d55:	4c 89 f0             	mov    %r14,%rax
+  802d58:	48 29 d0             	sub    %rdx,%rax
+  802d5b:	48 c1 f8 03          	sar    $0x3,%rax
+  802d5f:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d66:	aa aa aa 
+  802d69:	48 0f af c2          	imul   %rdx,%rax
+  802d6d:	48 c1 e0 0e          	shl    $0xe,%rax
+  802d71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d75:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d78:	41 39 06             	cmp    %eax,(%r14)
+  802d7b:	75 0d                	jne    802d8a <devfile_read+0xfd>
+  802d7d:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d80:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802d84:	0f 84 fb 00 00 00    	je     802e85 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802d8a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d8f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802d93:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802d96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802d9a:	48 89 c7             	mov    %rax,%rdi
+  802d9d:	48 b8 9f 47 80 00 00 	movabs $0x80479f,%rax
+  802da4:	00 00 00 
+  802da7:	ff d0                	call   *%rax
+  802da9:	84 c0                	test   %al,%al
+  802dab:	75 27                	jne    802dd4 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dad:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802db2:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802db7:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802dbb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc0:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  802dc7:	00 00 00 
+  802dca:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802dcc:	85 c0                	test   %eax,%eax
+  802dce:	0f 88 dc 00 00 00    	js     802eb0 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802dd4:	44 89 f8             	mov    %r15d,%eax
+  802dd7:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ddc:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802dde:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802de5:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802de6:	8b 43 10             	mov    0x10(%rbx),%eax
+  802de9:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802ded:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802df0:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802df5:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802df9:	48 89 df             	mov    %rbx,%rdi
+  802dfc:	48 b8 15 2a 80 00 00 	movabs $0x802a15,%rax
+  802e03:	00 00 00 
+  802e06:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e08:	48 85 c0             	test   %rax,%rax
+  802e0b:	0f 88 f4 fe ff ff    	js     802d05 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e11:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e14:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e17:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802e1a:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802e1e:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802e22:	48 63 d1             	movslq %ecx,%rdx
+  802e25:	48 01 d0             	add    %rdx,%rax
+  802e28:	4d 63 ff             	movslq %r15d,%r15
+  802e2b:	4c 29 f8             	sub    %r15,%rax
+  802e2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e33:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e37:	48 85 c0             	test   %rax,%rax
+  802e3a:	0f 8e c5 fe ff ff    	jle    802d05 <devfile_read+0x78>
+    n = MIN(n, res);
+  802e40:	4c 39 e8             	cmp    %r13,%rax
+  802e43:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e47:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e4a:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e4e:	48 63 f6             	movslq %esi,%rsi
+  802e51:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e56:	48 01 c6             	add    %rax,%rsi
+  802e59:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e5d:	48 01 c6             	add    %rax,%rsi
+  802e60:	4c 89 ea             	mov    %r13,%rdx
+  802e63:	4c 89 e7             	mov    %r12,%rdi
+  802e66:	48 b8 98 0f 80 00 00 	movabs $0x800f98,%rax
+  802e6d:	00 00 00 
+  802e70:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802e72:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802e76:	4c 89 e8             	mov    %r13,%rax
+  802e79:	e9 87 fe ff ff       	jmp    802d05 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e7e:	48 98                	cltq
+  802e80:	e9 80 fe ff ff       	jmp    802d05 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e85:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802e89:	41 39 d7             	cmp    %edx,%r15d
+  802e8c:	0f 8c f8 fe ff ff    	jl     802d8a <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e92:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802e96:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802e99:	41 39 cf             	cmp    %ecx,%r15d
+  802e9c:	0f 8d e8 fe ff ff    	jge    802d8a <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802ea2:	4d 63 ff             	movslq %r15d,%r15
+  802ea5:	4c 29 f8             	sub    %r15,%rax
+  802ea8:	48 63 d2             	movslq %edx,%rdx
+  802eab:	48 01 d0             	add    %rdx,%rax
+  802eae:	eb 87                	jmp    802e37 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802eb0:	48 98                	cltq
+  802eb2:	e9 4e fe ff ff       	jmp    802d05 <devfile_read+0x78>
+        return E_INVAL;
+  802eb7:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ebc:	c3                   	ret
+
+0000000000802ebd <fs_channel>:
+fs_channel(bool enable) {
+  802ebd:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802ebf:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802ec6:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802ec8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ecd:	40 84 ff             	test   %dil,%dil
+  802ed0:	74 47                	je     802f19 <fs_channel+0x5c>
+  802ed2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802ed9:	00 00 00 
+  802edc:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802ee2:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802ee9:	00 00 00 
+  802eec:	3b 08                	cmp    (%rax),%ecx
+  802eee:	74 29                	je     802f19 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802ef0:	55                   	push   %rbp
+  802ef1:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802ef4:	48 b8 3d 1e 80 00 00 	movabs $0x801e3d,%rax
+  802efb:	00 00 00 
+  802efe:	ff d0                	call   *%rax
+  802f00:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f02:	85 c0                	test   %eax,%eax
+  802f04:	78 04                	js     802f0a <fs_channel+0x4d>
+}
+  802f06:	89 d0                	mov    %edx,%eax
+  802f08:	5d                   	pop    %rbp
+  802f09:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f0a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f11:	00 00 00 
+  802f14:	c6 00 00             	movb   $0x0,(%rax)
+  802f17:	eb ed                	jmp    802f06 <fs_channel+0x49>
+}
+  802f19:	89 d0                	mov    %edx,%eax
+  802f1b:	c3                   	ret
+
+0000000000802f1c <open>:
+open(const char *path, int mode) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	41 55                	push   %r13
+  802f22:	41 54                	push   %r12
+  802f24:	53                   	push   %rbx
+  802f25:	48 83 ec 18          	sub    $0x18,%rsp
+  802f29:	49 89 fc             	mov    %rdi,%r12
+  802f2c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f2f:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  802f36:	00 00 00 
+  802f39:	ff d0                	call   *%rax
+  802f3b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f41:	0f 87 8f 00 00 00    	ja     802fd6 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f47:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f4b:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  802f52:	00 00 00 
+  802f55:	ff d0                	call   *%rax
+  802f57:	89 c3                	mov    %eax,%ebx
+  802f59:	85 c0                	test   %eax,%eax
+  802f5b:	78 55                	js     802fb2 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f5d:	4c 89 e6             	mov    %r12,%rsi
+  802f60:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f67:	00 00 00 
+  802f6a:	48 89 df             	mov    %rbx,%rdi
+  802f6d:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  802f74:	00 00 00 
+  802f77:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f79:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802f80:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f85:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802f89:	bf 01 00 00 00       	mov    $0x1,%edi
+  802f8e:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  802f95:	00 00 00 
+  802f98:	ff d0                	call   *%rax
+  802f9a:	89 c3                	mov    %eax,%ebx
+  802f9c:	85 c0                	test   %eax,%eax
+  802f9e:	78 1f                	js     802fbf <open+0xa3>
+    return fd2num(fd);
+  802fa0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fa4:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+  802fb0:	89 c3                	mov    %eax,%ebx
+}
+  802fb2:	89 d8                	mov    %ebx,%eax
+  802fb4:	48 83 c4 18          	add    $0x18,%rsp
+  802fb8:	5b                   	pop    %rbx
+  802fb9:	41 5c                	pop    %r12
+  802fbb:	41 5d                	pop    %r13
+  802fbd:	5d                   	pop    %rbp
+  802fbe:	c3                   	ret
+        fd_close(fd, 0);
+  802fbf:	be 00 00 00 00       	mov    $0x0,%esi
+  802fc4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fc8:	48 b8 12 18 80 00 00 	movabs $0x801812,%rax
+  802fcf:	00 00 00 
+  802fd2:	ff d0                	call   *%rax
+        return res;
+  802fd4:	eb dc                	jmp    802fb2 <open+0x96>
+        return -E_BAD_PATH;
+  802fd6:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802fdb:	eb d5                	jmp    802fb2 <open+0x96>
+
+0000000000802fdd <file_flush_buffers>:
+file_flush_buffers(void) {
+  802fdd:	55                   	push   %rbp
+  802fde:	48 89 e5             	mov    %rsp,%rbp
+  802fe1:	41 56                	push   %r14
+  802fe3:	41 55                	push   %r13
+  802fe5:	41 54                	push   %r12
+  802fe7:	53                   	push   %rbx
+  802fe8:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  802fec:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  802ff3:	00 00 00 
+  802ff6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  802ffb:	49 bd 57 17 80 00 00 	movabs $0x801757,%r13
+  803002:	00 00 00 
+  803005:	49 be 17 27 80 00 00 	movabs $0x802717,%r14
+  80300c:	00 00 00 
+  80300f:	eb 0c                	jmp    80301d <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803011:	83 c3 01             	add    $0x1,%ebx
+  803014:	49 83 c4 18          	add    $0x18,%r12
+  803018:	83 fb 20             	cmp    $0x20,%ebx
+  80301b:	74 1d                	je     80303a <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80301d:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803022:	74 ed                	je     803011 <file_flush_buffers+0x34>
+  803024:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803028:	89 df                	mov    %ebx,%edi
+  80302a:	41 ff d5             	call   *%r13
+  80302d:	85 c0                	test   %eax,%eax
+  80302f:	78 e0                	js     803011 <file_flush_buffers+0x34>
+  803031:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803035:	41 ff d6             	call   *%r14
+  803038:	eb d7                	jmp    803011 <file_flush_buffers+0x34>
+}
+  80303a:	48 83 c4 10          	add    $0x10,%rsp
+  80303e:	5b                   	pop    %rbx
+  80303f:	41 5c                	pop    %r12
+  803041:	41 5d                	pop    %r13
+  803043:	41 5e                	pop    %r14
+  803045:	5d                   	pop    %rbp
+  803046:	c3                   	ret
+
+0000000000803047 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803047:	55                   	push   %rbp
+  803048:	48 89 e5             	mov    %rsp,%rbp
+  80304b:	41 54                	push   %r12
+  80304d:	53                   	push   %rbx
+  80304e:	49 89 fc             	mov    %rdi,%r12
+  803051:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803053:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  80305a:	00 00 00 
+  80305d:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80305f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803066:	00 00 00 
+  803069:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80306e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803070:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803073:	ba 00 00 00 00       	mov    $0x0,%edx
+  803078:	be 00 00 00 00       	mov    $0x0,%esi
+  80307d:	bf 02 00 00 00       	mov    $0x2,%edi
+  803082:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+}
+  80308e:	5b                   	pop    %rbx
+  80308f:	41 5c                	pop    %r12
+  803091:	5d                   	pop    %rbp
+  803092:	c3                   	ret
+
+0000000000803093 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803093:	55                   	push   %rbp
+  803094:	48 89 e5             	mov    %rsp,%rbp
+  803097:	41 54                	push   %r12
+  803099:	53                   	push   %rbx
+  80309a:	49 89 fc             	mov    %rdi,%r12
+  80309d:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8030a0:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  8030a7:	00 00 00 
+  8030aa:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8030ac:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8030b1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8030b8:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8030ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030bf:	be 00 00 00 00       	mov    $0x0,%esi
+  8030c4:	bf 05 00 00 00       	mov    $0x5,%edi
+  8030c9:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  8030d0:	00 00 00 
+  8030d3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030d5:	85 c0                	test   %eax,%eax
+  8030d7:	78 3d                	js     803116 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8030d9:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8030e0:	00 00 00 
+  8030e3:	4c 89 e6             	mov    %r12,%rsi
+  8030e6:	48 89 df             	mov    %rbx,%rdi
+  8030e9:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  8030f0:	00 00 00 
+  8030f3:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8030f5:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8030fc:	00 
+  8030fd:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803103:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80310a:	00 
+  80310b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803116:	5b                   	pop    %rbx
+  803117:	41 5c                	pop    %r12
+  803119:	5d                   	pop    %rbp
+  80311a:	c3                   	ret
+
+000000000080311b <remove>:
+remove(const char *path) {
+  80311b:	55                   	push   %rbp
+  80311c:	48 89 e5             	mov    %rsp,%rbp
+  80311f:	53                   	push   %rbx
+  803120:	48 83 ec 08          	sub    $0x8,%rsp
+  803124:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803127:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  80312e:	00 00 00 
+  803131:	ff d0                	call   *%rax
+  803133:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803139:	77 3a                	ja     803175 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80313b:	48 89 de             	mov    %rbx,%rsi
+  80313e:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803145:	00 00 00 
+  803148:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  80314f:	00 00 00 
+  803152:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803154:	ba 00 00 00 00       	mov    $0x0,%edx
+  803159:	be 00 00 00 00       	mov    $0x0,%esi
+  80315e:	bf 07 00 00 00       	mov    $0x7,%edi
+  803163:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  80316a:	00 00 00 
+  80316d:	ff d0                	call   *%rax
+}
+  80316f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803173:	c9                   	leave
+  803174:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803175:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80317a:	eb f3                	jmp    80316f <remove+0x54>
+
+000000000080317c <sync>:
+sync(void) {
+  80317c:	55                   	push   %rbp
+  80317d:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803180:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  803187:	00 00 00 
+  80318a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80318c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803191:	be 00 00 00 00       	mov    $0x0,%esi
+  803196:	bf 08 00 00 00       	mov    $0x8,%edi
+  80319b:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+}
+  8031a7:	5d                   	pop    %rbp
+  8031a8:	c3                   	ret
+
+00000000008031a9 <fsync>:
+fsync(int fdnum) {
+  8031a9:	55                   	push   %rbp
+  8031aa:	48 89 e5             	mov    %rsp,%rbp
+  8031ad:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031b1:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031b5:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  8031bc:	00 00 00 
+  8031bf:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031c1:	85 c0                	test   %eax,%eax
+  8031c3:	78 4b                	js     803210 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031c5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031c9:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8031d0:	00 00 00 
+  8031d3:	8b 00                	mov    (%rax),%eax
+  8031d5:	39 02                	cmp    %eax,(%rdx)
+  8031d7:	75 39                	jne    803212 <fsync+0x69>
+    file_flush_buffers();
+  8031d9:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8031e5:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8031e9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8031ec:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8031f3:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8031f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fa:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ff:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803204:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  80320b:	00 00 00 
+  80320e:	ff d0                	call   *%rax
+}
+  803210:	c9                   	leave
+  803211:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803212:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803217:	eb f7                	jmp    803210 <fsync+0x67>
+
+0000000000803219 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803219:	55                   	push   %rbp
+  80321a:	48 89 e5             	mov    %rsp,%rbp
+  80321d:	53                   	push   %rbx
+  80321e:	48 83 ec 08          	sub    $0x8,%rsp
+  803222:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803225:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322a:	be 00 00 00 00       	mov    $0x0,%esi
+  80322f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803234:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  80323b:	00 00 00 
+  80323e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803240:	85 c0                	test   %eax,%eax
+  803242:	78 2d                	js     803271 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803244:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80324b:	00 00 00 
+  80324e:	48 8b 10             	mov    (%rax),%rdx
+  803251:	48 89 13             	mov    %rdx,(%rbx)
+  803254:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803258:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80325c:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803260:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803264:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803268:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80326c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803275:	c9                   	leave
+  803276:	c3                   	ret
+
+0000000000803277 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803277:	55                   	push   %rbp
+  803278:	48 89 e5             	mov    %rsp,%rbp
+  80327b:	53                   	push   %rbx
+  80327c:	48 83 ec 08          	sub    $0x8,%rsp
+  803280:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803283:	ba 00 00 00 00       	mov    $0x0,%edx
+  803288:	be 00 00 00 00       	mov    $0x0,%esi
+  80328d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803292:	48 b8 ae 24 80 00 00 	movabs $0x8024ae,%rax
+  803299:	00 00 00 
+  80329c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80329e:	85 c0                	test   %eax,%eax
+  8032a0:	78 3d                	js     8032df <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8032a2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032a9:	00 00 00 
+  8032ac:	48 8b 10             	mov    (%rax),%rdx
+  8032af:	48 89 13             	mov    %rdx,(%rbx)
+  8032b2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032b6:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032ba:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032be:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032c2:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8032c6:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8032ca:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8032ce:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8032d2:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032d6:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8032da:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032df:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032e3:	c9                   	leave
+  8032e4:	c3                   	ret
+
+00000000008032e5 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8032e5:	55                   	push   %rbp
+  8032e6:	48 89 e5             	mov    %rsp,%rbp
+  8032e9:	41 57                	push   %r15
+  8032eb:	41 56                	push   %r14
+  8032ed:	41 55                	push   %r13
+  8032ef:	41 54                	push   %r12
+  8032f1:	53                   	push   %rbx
+  8032f2:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8032f6:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8032fd:	00 
+  8032fe:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803305:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80330b:	0f 85 43 01 00 00    	jne    803454 <munmap+0x16f>
+  803311:	49 89 ff             	mov    %rdi,%r15
+  803314:	4c 39 f7             	cmp    %r14,%rdi
+  803317:	0f 87 37 01 00 00    	ja     803454 <munmap+0x16f>
+  80331d:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803324:	00 00 00 
+  803327:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80332d:	eb 2c                	jmp    80335b <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80332f:	4c 39 f8             	cmp    %r15,%rax
+  803332:	0f 83 85 00 00 00    	jae    8033bd <munmap+0xd8>
+            m->mm_end = start;
+  803338:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80333d:	48 83 c3 18          	add    $0x18,%rbx
+  803341:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803348:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80334f:	00 00 00 
+  803352:	48 39 c3             	cmp    %rax,%rbx
+  803355:	0f 84 d0 00 00 00    	je     80342b <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80335b:	49 89 dc             	mov    %rbx,%r12
+  80335e:	48 8b 03             	mov    (%rbx),%rax
+  803361:	4c 39 f0             	cmp    %r14,%rax
+  803364:	73 d7                	jae    80333d <munmap+0x58>
+  803366:	48 85 c0             	test   %rax,%rax
+  803369:	74 d2                	je     80333d <munmap+0x58>
+  80336b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80336f:	49 39 d7             	cmp    %rdx,%r15
+  803372:	73 c9                	jae    80333d <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803374:	49 39 d6             	cmp    %rdx,%r14
+  803377:	73 b6                	jae    80332f <munmap+0x4a>
+  803379:	49 39 c7             	cmp    %rax,%r15
+  80337c:	76 b1                	jbe    80332f <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80337e:	4c 89 ef             	mov    %r13,%rdi
+  803381:	48 b8 1c 24 80 00 00 	movabs $0x80241c,%rax
+  803388:	00 00 00 
+  80338b:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80338d:	48 85 c0             	test   %rax,%rax
+  803390:	0f 84 c5 00 00 00    	je     80345b <munmap+0x176>
+            *tail = *m;
+  803396:	48 8b 13             	mov    (%rbx),%rdx
+  803399:	48 89 10             	mov    %rdx,(%rax)
+  80339c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033a0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8033a4:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8033a8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8033ac:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8033af:	44 89 f2             	mov    %r14d,%edx
+  8033b2:	2b 13                	sub    (%rbx),%edx
+  8033b4:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8033b7:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8033bb:	eb 80                	jmp    80333d <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8033bd:	49 39 d6             	cmp    %rdx,%r14
+  8033c0:	73 18                	jae    8033da <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8033c2:	44 89 f2             	mov    %r14d,%edx
+  8033c5:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8033ca:	29 c2                	sub    %eax,%edx
+  8033cc:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8033d1:	4d 89 34 24          	mov    %r14,(%r12)
+  8033d5:	e9 63 ff ff ff       	jmp    80333d <munmap+0x58>
+    m->mm_start = 0;
+  8033da:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8033e1:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8033e2:	4c 89 e6             	mov    %r12,%rsi
+  8033e5:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8033ec:	00 00 00 
+  8033ef:	48 29 c6             	sub    %rax,%rsi
+  8033f2:	48 c1 fe 03          	sar    $0x3,%rsi
+  8033f6:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8033fd:	aa aa aa 
+  803400:	48 0f af f0          	imul   %rax,%rsi
+  803404:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803408:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80340d:	48 01 c6             	add    %rax,%rsi
+  803410:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803415:	bf 00 00 00 00       	mov    $0x0,%edi
+  80341a:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  803421:	00 00 00 
+  803424:	ff d0                	call   *%rax
+}
+  803426:	e9 12 ff ff ff       	jmp    80333d <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80342b:	4c 89 f2             	mov    %r14,%rdx
+  80342e:	4c 29 fa             	sub    %r15,%rdx
+  803431:	4c 89 fe             	mov    %r15,%rsi
+  803434:	bf 00 00 00 00       	mov    $0x0,%edi
+  803439:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  803440:	00 00 00 
+  803443:	ff d0                	call   *%rax
+}
+  803445:	48 83 c4 08          	add    $0x8,%rsp
+  803449:	5b                   	pop    %rbx
+  80344a:	41 5c                	pop    %r12
+  80344c:	41 5d                	pop    %r13
+  80344e:	41 5e                	pop    %r14
+  803450:	41 5f                	pop    %r15
+  803452:	5d                   	pop    %rbp
+  803453:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803454:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803459:	eb ea                	jmp    803445 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80345b:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803460:	eb e3                	jmp    803445 <munmap+0x160>
+
+0000000000803462 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803462:	55                   	push   %rbp
+  803463:	48 89 e5             	mov    %rsp,%rbp
+  803466:	41 57                	push   %r15
+  803468:	41 56                	push   %r14
+  80346a:	41 55                	push   %r13
+  80346c:	41 54                	push   %r12
+  80346e:	53                   	push   %rbx
+  80346f:	48 83 ec 28          	sub    $0x28,%rsp
+  803473:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803477:	49 89 f5             	mov    %rsi,%r13
+  80347a:	41 89 d6             	mov    %edx,%r14d
+  80347d:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803480:	41 89 cc             	mov    %ecx,%r12d
+  803483:	44 89 c7             	mov    %r8d,%edi
+  803486:	44 89 cb             	mov    %r9d,%ebx
+  803489:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80348d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803491:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+  80349d:	41 89 c7             	mov    %eax,%r15d
+  8034a0:	85 c0                	test   %eax,%eax
+  8034a2:	0f 88 ae 01 00 00    	js     803656 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034a8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034ac:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8034b3:	00 00 00 
+  8034b6:	8b 32                	mov    (%rdx),%esi
+  8034b8:	39 30                	cmp    %esi,(%rax)
+  8034ba:	0f 85 7a 02 00 00    	jne    80373a <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8034c0:	8b 40 08             	mov    0x8(%rax),%eax
+  8034c3:	83 e0 03             	and    $0x3,%eax
+  8034c6:	83 f8 01             	cmp    $0x1,%eax
+  8034c9:	0f 84 76 02 00 00    	je     803745 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8034cf:	4d 85 ed             	test   %r13,%r13
+  8034d2:	0f 84 78 02 00 00    	je     803750 <mmap+0x2ee>
+  8034d8:	85 db                	test   %ebx,%ebx
+  8034da:	0f 88 70 02 00 00    	js     803750 <mmap+0x2ee>
+  8034e0:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8034e6:	41 89 df             	mov    %ebx,%r15d
+  8034e9:	0f 85 6c 02 00 00    	jne    80375b <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8034ef:	44 89 f0             	mov    %r14d,%eax
+  8034f2:	83 e0 fd             	and    $0xfffffffd,%eax
+  8034f5:	83 f8 04             	cmp    $0x4,%eax
+  8034f8:	0f 85 68 02 00 00    	jne    803766 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8034fe:	44 89 e1             	mov    %r12d,%ecx
+  803501:	83 e1 01             	and    $0x1,%ecx
+  803504:	0f 95 c2             	setne  %dl
+  803507:	44 89 e0             	mov    %r12d,%eax
+  80350a:	d1 e8                	shr    %eax
+  80350c:	83 f0 01             	xor    $0x1,%eax
+  80350f:	83 e0 01             	and    $0x1,%eax
+  803512:	38 c2                	cmp    %al,%dl
+  803514:	0f 85 57 02 00 00    	jne    803771 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80351a:	85 c9                	test   %ecx,%ecx
+  80351c:	74 0a                	je     803528 <mmap+0xc6>
+  80351e:	41 f6 c6 02          	test   $0x2,%r14b
+  803522:	0f 85 54 02 00 00    	jne    80377c <mmap+0x31a>
+    file_flush_buffers();
+  803528:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  80352f:	00 00 00 
+  803532:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803534:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80353b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803542:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803546:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803549:	41 f6 c4 04          	test   $0x4,%r12b
+  80354d:	0f 84 15 01 00 00    	je     803668 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803553:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803556:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80355c:	0f 85 25 02 00 00    	jne    803787 <mmap+0x325>
+  803562:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803566:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80356d:	00 00 00 
+  803570:	48 39 c2             	cmp    %rax,%rdx
+  803573:	0f 82 19 02 00 00    	jb     803792 <mmap+0x330>
+  803579:	48 39 c7             	cmp    %rax,%rdi
+  80357c:	0f 87 10 02 00 00    	ja     803792 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803582:	4c 89 ee             	mov    %r13,%rsi
+  803585:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  80358c:	00 00 00 
+  80358f:	ff d0                	call   *%rax
+  803591:	85 c0                	test   %eax,%eax
+  803593:	0f 88 04 02 00 00    	js     80379d <mmap+0x33b>
+    if (!handler) {
+  803599:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035a0:	00 00 00 
+  8035a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8035a6:	75 2b                	jne    8035d3 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8035a8:	48 bf 7d 23 80 00 00 	movabs $0x80237d,%rdi
+  8035af:	00 00 00 
+  8035b2:	48 b8 87 4f 80 00 00 	movabs $0x804f87,%rax
+  8035b9:	00 00 00 
+  8035bc:	ff d0                	call   *%rax
+  8035be:	85 c0                	test   %eax,%eax
+  8035c0:	0f 88 ea 01 00 00    	js     8037b0 <mmap+0x34e>
+        handler = 1;
+  8035c6:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035cd:	00 00 00 
+  8035d0:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8035d3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035d7:	48 b8 1c 24 80 00 00 	movabs $0x80241c,%rax
+  8035de:	00 00 00 
+  8035e1:	ff d0                	call   *%rax
+  8035e3:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8035e6:	48 85 c0             	test   %rax,%rax
+  8035e9:	0f 84 c9 01 00 00    	je     8037b8 <mmap+0x356>
+    m->mm_start = va;
+  8035ef:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8035f2:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8035f6:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8035fa:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8035fd:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803601:	44 89 e0             	mov    %r12d,%eax
+  803604:	c1 e0 06             	shl    $0x6,%eax
+  803607:	25 80 00 00 00       	and    $0x80,%eax
+  80360c:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80360f:	09 f0                	or     %esi,%eax
+  803611:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803615:	41 f6 c4 08          	test   $0x8,%r12b
+  803619:	74 31                	je     80364c <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80361b:	48 39 d3             	cmp    %rdx,%rbx
+  80361e:	73 2c                	jae    80364c <mmap+0x1ea>
+  803620:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803625:	48 89 de             	mov    %rbx,%rsi
+  803628:	4c 89 f7             	mov    %r14,%rdi
+  80362b:	48 b8 6c 22 80 00 00 	movabs $0x80226c,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+  803637:	49 89 c4             	mov    %rax,%r12
+  80363a:	48 85 c0             	test   %rax,%rax
+  80363d:	0f 8e d7 00 00 00    	jle    80371a <mmap+0x2b8>
+            va += n;
+  803643:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803646:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80364a:	72 d4                	jb     803620 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80364c:	49 8b 06             	mov    (%r14),%rax
+  80364f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803653:	48 89 06             	mov    %rax,(%rsi)
+}
+  803656:	44 89 f8             	mov    %r15d,%eax
+  803659:	48 83 c4 28          	add    $0x28,%rsp
+  80365d:	5b                   	pop    %rbx
+  80365e:	41 5c                	pop    %r12
+  803660:	41 5d                	pop    %r13
+  803662:	41 5e                	pop    %r14
+  803664:	41 5f                	pop    %r15
+  803666:	5d                   	pop    %rbp
+  803667:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803668:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80366f:	00 00 00 
+  803672:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803675:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80367c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80367f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803684:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80368b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80368e:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803695:	00 00 00 
+  803698:	48 39 d7             	cmp    %rdx,%rdi
+  80369b:	73 1c                	jae    8036b9 <mmap+0x257>
+        return -E_NO_MEM;
+  80369d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036a3:	eb b1                	jmp    803656 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036a5:	48 83 c0 01          	add    $0x1,%rax
+  8036a9:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8036ad:	77 3f                	ja     8036ee <mmap+0x28c>
+  8036af:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8036b4:	48 39 d7             	cmp    %rdx,%rdi
+  8036b7:	72 2a                	jb     8036e3 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036b9:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8036bd:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8036c1:	48 39 d1             	cmp    %rdx,%rcx
+  8036c4:	73 df                	jae    8036a5 <mmap+0x243>
+  8036c6:	48 85 c9             	test   %rcx,%rcx
+  8036c9:	74 da                	je     8036a5 <mmap+0x243>
+  8036cb:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8036cf:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8036d4:	48 39 d3             	cmp    %rdx,%rbx
+  8036d7:	73 cc                	jae    8036a5 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8036d9:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036e1:	eb cc                	jmp    8036af <mmap+0x24d>
+        return -E_NO_MEM;
+  8036e3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036e9:	e9 68 ff ff ff       	jmp    803656 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8036ee:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8036f3:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8036fa:	00 00 00 
+  8036fd:	48 39 c2             	cmp    %rax,%rdx
+  803700:	0f 82 9f 00 00 00    	jb     8037a5 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803706:	48 85 db             	test   %rbx,%rbx
+  803709:	0f 85 8a fe ff ff    	jne    803599 <mmap+0x137>
+        return -E_NO_MEM;
+  80370f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803715:	e9 3c ff ff ff       	jmp    803656 <mmap+0x1f4>
+        if (n < 0) {
+  80371a:	0f 89 2c ff ff ff    	jns    80364c <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803720:	49 8b 3e             	mov    (%r14),%rdi
+  803723:	4c 89 ee             	mov    %r13,%rsi
+  803726:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  80372d:	00 00 00 
+  803730:	ff d0                	call   *%rax
+            return n;
+  803732:	45 89 e7             	mov    %r12d,%r15d
+  803735:	e9 1c ff ff ff       	jmp    803656 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80373a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803740:	e9 11 ff ff ff       	jmp    803656 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803745:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80374b:	e9 06 ff ff ff       	jmp    803656 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803750:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803756:	e9 fb fe ff ff       	jmp    803656 <mmap+0x1f4>
+  80375b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803761:	e9 f0 fe ff ff       	jmp    803656 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803766:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80376c:	e9 e5 fe ff ff       	jmp    803656 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803771:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803777:	e9 da fe ff ff       	jmp    803656 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80377c:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803782:	e9 cf fe ff ff       	jmp    803656 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803787:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80378d:	e9 c4 fe ff ff       	jmp    803656 <mmap+0x1f4>
+  803792:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803798:	e9 b9 fe ff ff       	jmp    803656 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80379d:	41 89 c7             	mov    %eax,%r15d
+  8037a0:	e9 b1 fe ff ff       	jmp    803656 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8037a5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037ab:	e9 a6 fe ff ff       	jmp    803656 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037b0:	41 89 c7             	mov    %eax,%r15d
+  8037b3:	e9 9e fe ff ff       	jmp    803656 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8037b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037be:	e9 93 fe ff ff       	jmp    803656 <mmap+0x1f4>
+
+00000000008037c3 <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  8037c3:	55                   	push   %rbp
+  8037c4:	48 89 e5             	mov    %rsp,%rbp
+  8037c7:	41 55                	push   %r13
+  8037c9:	41 54                	push   %r12
+  8037cb:	53                   	push   %rbx
+  8037cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8037d0:	48 89 fb             	mov    %rdi,%rbx
+  8037d3:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  8037d6:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  8037d9:	48 b8 40 47 80 00 00 	movabs $0x804740,%rax
+  8037e0:	00 00 00 
+  8037e3:	ff d0                	call   *%rax
+  8037e5:	41 89 c1             	mov    %eax,%r9d
+  8037e8:	4d 89 e0             	mov    %r12,%r8
+  8037eb:	49 29 d8             	sub    %rbx,%r8
+  8037ee:	48 89 d9             	mov    %rbx,%rcx
+  8037f1:	44 89 ea             	mov    %r13d,%edx
+  8037f4:	48 89 de             	mov    %rbx,%rsi
+  8037f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037fc:	48 b8 b5 4a 80 00 00 	movabs $0x804ab5,%rax
+  803803:	00 00 00 
+  803806:	ff d0                	call   *%rax
+    return 0;
+}
+  803808:	b8 00 00 00 00       	mov    $0x0,%eax
+  80380d:	48 83 c4 08          	add    $0x8,%rsp
+  803811:	5b                   	pop    %rbx
+  803812:	41 5c                	pop    %r12
+  803814:	41 5d                	pop    %r13
+  803816:	5d                   	pop    %rbp
+  803817:	c3                   	ret
+
+0000000000803818 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803818:	55                   	push   %rbp
+  803819:	48 89 e5             	mov    %rsp,%rbp
+  80381c:	41 57                	push   %r15
+  80381e:	41 56                	push   %r14
+  803820:	41 55                	push   %r13
+  803822:	41 54                	push   %r12
+  803824:	53                   	push   %rbx
+  803825:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  80382c:	48 89 fb             	mov    %rdi,%rbx
+  80382f:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803832:	48 b8 dd 2f 80 00 00 	movabs $0x802fdd,%rax
+  803839:	00 00 00 
+  80383c:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  80383e:	be 00 00 00 00       	mov    $0x0,%esi
+  803843:	48 89 df             	mov    %rbx,%rdi
+  803846:	48 b8 1c 2f 80 00 00 	movabs $0x802f1c,%rax
+  80384d:	00 00 00 
+  803850:	ff d0                	call   *%rax
+  803852:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803858:	85 c0                	test   %eax,%eax
+  80385a:	0f 88 06 04 00 00    	js     803c66 <spawn+0x44e>
+  803860:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803862:	ba 00 02 00 00       	mov    $0x200,%edx
+  803867:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  80386e:	48 b8 f8 1a 80 00 00 	movabs $0x801af8,%rax
+  803875:	00 00 00 
+  803878:	ff d0                	call   *%rax
+  80387a:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  80387c:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803881:	0f 85 93 02 00 00    	jne    803b1a <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803887:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  80388e:	ff ff 00 
+  803891:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803898:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  80389f:	01 01 00 
+  8038a2:	48 39 d0             	cmp    %rdx,%rax
+  8038a5:	0f 85 ab 02 00 00    	jne    803b56 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  8038ab:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  8038b2:	00 3e 00 
+  8038b5:	0f 85 9b 02 00 00    	jne    803b56 <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8038bb:	b8 08 00 00 00       	mov    $0x8,%eax
+  8038c0:	0f 05                	syscall
+  8038c2:	41 89 c6             	mov    %eax,%r14d
+  8038c5:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  8038cb:	85 c0                	test   %eax,%eax
+  8038cd:	0f 88 75 03 00 00    	js     803c48 <spawn+0x430>
+    envid_t child = res;
+  8038d3:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  8038d9:	89 c2                	mov    %eax,%edx
+  8038db:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8038e1:	48 89 d0             	mov    %rdx,%rax
+  8038e4:	48 c1 e0 04          	shl    $0x4,%rax
+  8038e8:	48 29 d0             	sub    %rdx,%rax
+  8038eb:	48 c1 e0 05          	shl    $0x5,%rax
+  8038ef:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  8038f6:	00 00 00 
+  8038f9:	48 01 c6             	add    %rax,%rsi
+  8038fc:	48 8b 06             	mov    (%rsi),%rax
+  8038ff:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803906:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  80390d:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803914:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  80391b:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803922:	48 29 ce             	sub    %rcx,%rsi
+  803925:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  80392b:	c1 e9 03             	shr    $0x3,%ecx
+  80392e:	89 c9                	mov    %ecx,%ecx
+  803930:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803933:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  80393a:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803941:	49 8b 3c 24          	mov    (%r12),%rdi
+  803945:	48 85 ff             	test   %rdi,%rdi
+  803948:	0f 84 d6 05 00 00    	je     803f24 <spawn+0x70c>
+  80394e:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803954:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  80395a:	48 bb f9 0c 80 00 00 	movabs $0x800cf9,%rbx
+  803961:	00 00 00 
+  803964:	ff d3                	call   *%rbx
+  803966:	4c 01 f8             	add    %r15,%rax
+  803969:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  80396d:	4c 89 ea             	mov    %r13,%rdx
+  803970:	49 83 c5 01          	add    $0x1,%r13
+  803974:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803979:	48 85 ff             	test   %rdi,%rdi
+  80397c:	75 e6                	jne    803964 <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80397e:	49 89 d5             	mov    %rdx,%r13
+  803981:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803988:	48 f7 d0             	not    %rax
+  80398b:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803992:	49 89 df             	mov    %rbx,%r15
+  803995:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803999:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  8039a0:	89 d0                	mov    %edx,%eax
+  8039a2:	83 c0 01             	add    $0x1,%eax
+  8039a5:	48 98                	cltq
+  8039a7:	48 c1 e0 03          	shl    $0x3,%rax
+  8039ab:	49 29 c7             	sub    %rax,%r15
+  8039ae:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8039b5:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  8039b9:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  8039bf:	0f 86 4f 05 00 00    	jbe    803f14 <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8039c5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8039ca:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8039cf:	be 00 00 40 00       	mov    $0x400000,%esi
+  8039d4:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  8039db:	00 00 00 
+  8039de:	ff d0                	call   *%rax
+  8039e0:	85 c0                	test   %eax,%eax
+  8039e2:	0f 88 31 05 00 00    	js     803f19 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  8039e8:	4c 89 e8             	mov    %r13,%rax
+  8039eb:	45 85 ed             	test   %r13d,%r13d
+  8039ee:	7e 65                	jle    803a55 <spawn+0x23d>
+  8039f0:	4d 89 fd             	mov    %r15,%r13
+  8039f3:	48 98                	cltq
+  8039f5:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  8039f9:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803a00:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803a03:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803a0a:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803a0d:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803a14:	ff 
+  803a15:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803a19:	49 8b 34 24          	mov    (%r12),%rsi
+  803a1d:	48 89 df             	mov    %rbx,%rdi
+  803a20:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  803a27:	00 00 00 
+  803a2a:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803a2c:	49 8b 3c 24          	mov    (%r12),%rdi
+  803a30:	48 b8 f9 0c 80 00 00 	movabs $0x800cf9,%rax
+  803a37:	00 00 00 
+  803a3a:	ff d0                	call   *%rax
+  803a3c:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803a41:	49 83 c5 08          	add    $0x8,%r13
+  803a45:	49 83 c4 08          	add    $0x8,%r12
+  803a49:	4d 39 ee             	cmp    %r13,%r14
+  803a4c:	75 bf                	jne    803a0d <spawn+0x1f5>
+  803a4e:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803a55:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803a5c:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803a63:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803a64:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803a6b:	0f 85 2c 01 00 00    	jne    803b9d <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803a71:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803a78:	00 00 00 
+  803a7b:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803a82:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803a89:	ff 
+  803a8a:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803a8e:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803a95:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803a99:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803aa0:	00 00 00 
+  803aa3:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803aaa:	ff 
+  803aab:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803ab2:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803ab8:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803abe:	44 89 f2             	mov    %r14d,%edx
+  803ac1:	be 00 00 40 00       	mov    $0x400000,%esi
+  803ac6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803acb:	48 b8 b5 4a 80 00 00 	movabs $0x804ab5,%rax
+  803ad2:	00 00 00 
+  803ad5:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803ad7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803adc:	be 00 00 40 00       	mov    $0x400000,%esi
+  803ae1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ae6:	48 b8 ee 4a 80 00 00 	movabs $0x804aee,%rax
+  803aed:	00 00 00 
+  803af0:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803af2:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803af9:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803b00:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803b01:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803b08:	00 
+  803b09:	0f 84 5d 03 00 00    	je     803e6c <spawn+0x654>
+  803b0f:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803b15:	e9 1b 02 00 00       	jmp    803d35 <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803b1a:	48 bf e0 5a 80 00 00 	movabs $0x805ae0,%rdi
+  803b21:	00 00 00 
+  803b24:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b29:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  803b30:	00 00 00 
+  803b33:	ff d2                	call   *%rdx
+        close(fd);
+  803b35:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803b3b:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803b42:	00 00 00 
+  803b45:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803b47:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803b4e:	ff ff ff 
+  803b51:	e9 10 01 00 00       	jmp    803c66 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803b56:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803b5b:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803b61:	48 bf 97 5b 80 00 00 	movabs $0x805b97,%rdi
+  803b68:	00 00 00 
+  803b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b70:	48 b9 12 04 80 00 00 	movabs $0x800412,%rcx
+  803b77:	00 00 00 
+  803b7a:	ff d1                	call   *%rcx
+        close(fd);
+  803b7c:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803b82:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803b89:	00 00 00 
+  803b8c:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803b8e:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803b95:	ff ff ff 
+  803b98:	e9 c9 00 00 00       	jmp    803c66 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803b9d:	48 b9 10 5b 80 00 00 	movabs $0x805b10,%rcx
+  803ba4:	00 00 00 
+  803ba7:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  803bae:	00 00 00 
+  803bb1:	be f9 00 00 00       	mov    $0xf9,%esi
+  803bb6:	48 bf c6 5b 80 00 00 	movabs $0x805bc6,%rdi
+  803bbd:	00 00 00 
+  803bc0:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc5:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  803bcc:	00 00 00 
+  803bcf:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803bd2:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803bd6:	48 29 f2             	sub    %rsi,%rdx
+  803bd9:	89 d9                	mov    %ebx,%ecx
+  803bdb:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803be1:	48 b8 7f 4a 80 00 00 	movabs $0x804a7f,%rax
+  803be8:	00 00 00 
+  803beb:	ff d0                	call   *%rax
+  803bed:	e9 f0 01 00 00       	jmp    803de2 <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803bf2:	89 c6                	mov    %eax,%esi
+  803bf4:	48 bf 40 5b 80 00 00 	movabs $0x805b40,%rdi
+  803bfb:	00 00 00 
+  803bfe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c03:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  803c0a:	00 00 00 
+  803c0d:	ff d2                	call   *%rdx
+    scring_discard();
+  803c0f:	48 b8 5f 4a 80 00 00 	movabs $0x804a5f,%rax
+  803c16:	00 00 00 
+  803c19:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803c1b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803c20:	be 00 00 40 00       	mov    $0x400000,%esi
+  803c25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c2a:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  803c31:	00 00 00 
+  803c34:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803c36:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803c3c:	48 b8 a6 11 80 00 00 	movabs $0x8011a6,%rax
+  803c43:	00 00 00 
+  803c46:	ff d0                	call   *%rax
+    close(fd);
+  803c48:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803c4e:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803c55:	00 00 00 
+  803c58:	ff d0                	call   *%rax
+    return res;
+  803c5a:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  803c60:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  803c66:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  803c6c:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803c73:	5b                   	pop    %rbx
+  803c74:	41 5c                	pop    %r12
+  803c76:	41 5d                	pop    %r13
+  803c78:	41 5e                	pop    %r14
+  803c7a:	41 5f                	pop    %r15
+  803c7c:	5d                   	pop    %rbp
+  803c7d:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  803c7e:	89 c6                	mov    %eax,%esi
+  803c80:	48 bf d2 5b 80 00 00 	movabs $0x805bd2,%rdi
+  803c87:	00 00 00 
+  803c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803c8f:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  803c96:	00 00 00 
+  803c99:	ff d2                	call   *%rdx
+        return res;
+  803c9b:	e9 6f ff ff ff       	jmp    803c0f <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  803ca0:	4c 89 e2             	mov    %r12,%rdx
+  803ca3:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803caa:	48 29 c2             	sub    %rax,%rdx
+  803cad:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  803cb4:	be 00 00 00 00       	mov    $0x0,%esi
+  803cb9:	48 b8 83 0e 80 00 00 	movabs $0x800e83,%rax
+  803cc0:	00 00 00 
+  803cc3:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  803cc5:	80 cb 80             	or     $0x80,%bl
+  803cc8:	41 89 d9             	mov    %ebx,%r9d
+  803ccb:	4d 89 e0             	mov    %r12,%r8
+  803cce:	4c 89 f1             	mov    %r14,%rcx
+  803cd1:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  803cd7:	be 00 00 40 00       	mov    $0x400000,%esi
+  803cdc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ce1:	48 b8 b5 4a 80 00 00 	movabs $0x804ab5,%rax
+  803ce8:	00 00 00 
+  803ceb:	ff d0                	call   *%rax
+    res = scring_submit();
+  803ced:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  803cf4:	00 00 00 
+  803cf7:	ff d0                	call   *%rax
+  803cf9:	89 c3                	mov    %eax,%ebx
+  803cfb:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  803d01:	4c 89 e6             	mov    %r12,%rsi
+  803d04:	bf 00 00 40 00       	mov    $0x400000,%edi
+  803d09:	48 b8 e5 32 80 00 00 	movabs $0x8032e5,%rax
+  803d10:	00 00 00 
+  803d13:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803d15:	85 db                	test   %ebx,%ebx
+  803d17:	0f 88 f2 fe ff ff    	js     803c0f <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803d1d:	49 83 c7 01          	add    $0x1,%r15
+  803d21:	49 83 c5 38          	add    $0x38,%r13
+  803d25:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  803d2c:	49 39 c7             	cmp    %rax,%r15
+  803d2f:	0f 83 37 01 00 00    	jae    803e6c <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  803d35:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  803d3a:	75 e1                	jne    803d1d <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  803d3c:	41 8b 45 04          	mov    0x4(%r13),%eax
+  803d40:	89 c3                	mov    %eax,%ebx
+  803d42:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  803d45:	89 da                	mov    %ebx,%edx
+  803d47:	83 ca 04             	or     $0x4,%edx
+  803d4a:	a8 04                	test   $0x4,%al
+  803d4c:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  803d4f:	89 da                	mov    %ebx,%edx
+  803d51:	83 ca 01             	or     $0x1,%edx
+  803d54:	a8 01                	test   $0x1,%al
+  803d56:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  803d59:	49 8b 45 08          	mov    0x8(%r13),%rax
+  803d5d:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  803d63:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  803d67:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  803d6e:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  803d72:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  803d79:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  803d7d:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  803d83:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  803d89:	44 89 f2             	mov    %r14d,%edx
+  803d8c:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  803d92:	74 22                	je     803db6 <spawn+0x59e>
+        va -= res;
+  803d94:	48 63 ca             	movslq %edx,%rcx
+  803d97:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  803d9a:	48 01 cf             	add    %rcx,%rdi
+  803d9d:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  803da4:	48 01 ce             	add    %rcx,%rsi
+  803da7:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  803dae:	29 d0                	sub    %edx,%eax
+  803db0:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  803db6:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803dbd:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  803dc4:	00 
+  803dc5:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  803dcc:	49 89 f4             	mov    %rsi,%r12
+  803dcf:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  803dd2:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803dd9:	49 39 c4             	cmp    %rax,%r12
+  803ddc:	0f 82 f0 fd ff ff    	jb     803bd2 <spawn+0x3ba>
+    res = scring_submit();
+  803de2:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  803de9:	00 00 00 
+  803dec:	ff d0                	call   *%rax
+  803dee:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803df4:	85 c0                	test   %eax,%eax
+  803df6:	0f 88 f6 fd ff ff    	js     803bf2 <spawn+0x3da>
+    if (!filesz) return 0;
+  803dfc:	4d 85 e4             	test   %r12,%r12
+  803dff:	0f 84 18 ff ff ff    	je     803d1d <spawn+0x505>
+    void *addr = UTEMP;
+  803e05:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  803e0c:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  803e10:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  803e17:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  803e1e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  803e23:	ba 06 00 00 00       	mov    $0x6,%edx
+  803e28:	4c 89 e6             	mov    %r12,%rsi
+  803e2b:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  803e32:	48 b8 62 34 80 00 00 	movabs $0x803462,%rax
+  803e39:	00 00 00 
+  803e3c:	ff d0                	call   *%rax
+  803e3e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  803e44:	85 c0                	test   %eax,%eax
+  803e46:	0f 88 32 fe ff ff    	js     803c7e <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  803e4c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803e53:	49 39 c4             	cmp    %rax,%r12
+  803e56:	49 0f 46 c4          	cmovbe %r12,%rax
+  803e5a:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  803e61:	0f 83 5e fe ff ff    	jae    803cc5 <spawn+0x4ad>
+  803e67:	e9 34 fe ff ff       	jmp    803ca0 <spawn+0x488>
+    close(fd);
+  803e6c:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803e72:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  803e79:	00 00 00 
+  803e7c:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  803e7e:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  803e85:	48 bf c3 37 80 00 00 	movabs $0x8037c3,%rdi
+  803e8c:	00 00 00 
+  803e8f:	48 b8 b4 47 80 00 00 	movabs $0x8047b4,%rax
+  803e96:	00 00 00 
+  803e99:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  803e9b:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  803ea2:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803ea8:	48 b8 5f 4b 80 00 00 	movabs $0x804b5f,%rax
+  803eaf:	00 00 00 
+  803eb2:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  803eb4:	be 02 00 00 00       	mov    $0x2,%esi
+  803eb9:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803ebf:	48 b8 27 4b 80 00 00 	movabs $0x804b27,%rax
+  803ec6:	00 00 00 
+  803ec9:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  803ecb:	48 b8 13 4a 80 00 00 	movabs $0x804a13,%rax
+  803ed2:	00 00 00 
+  803ed5:	ff d0                	call   *%rax
+  803ed7:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803edd:	85 c0                	test   %eax,%eax
+  803edf:	78 11                	js     803ef2 <spawn+0x6da>
+    return child;
+  803ee1:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  803ee7:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  803eed:	e9 74 fd ff ff       	jmp    803c66 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  803ef2:	89 c6                	mov    %eax,%esi
+  803ef4:	48 bf 70 5b 80 00 00 	movabs $0x805b70,%rdi
+  803efb:	00 00 00 
+  803efe:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f03:	48 ba 12 04 80 00 00 	movabs $0x800412,%rdx
+  803f0a:	00 00 00 
+  803f0d:	ff d2                	call   *%rdx
+        goto error;
+  803f0f:	e9 fb fc ff ff       	jmp    803c0f <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803f14:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803f19:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  803f1f:	e9 eb fc ff ff       	jmp    803c0f <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803f24:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803f29:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803f2e:	be 00 00 40 00       	mov    $0x400000,%esi
+  803f33:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f38:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  803f3f:	00 00 00 
+  803f42:	ff d0                	call   *%rax
+  803f44:	85 c0                	test   %eax,%eax
+  803f46:	78 d1                	js     803f19 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  803f48:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  803f4f:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803f53:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  803f5a:	f8 ff 40 00 
+  803f5e:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  803f65:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803f69:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  803f6e:	e9 e2 fa ff ff       	jmp    803a55 <spawn+0x23d>
+
+0000000000803f73 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  803f73:	55                   	push   %rbp
+  803f74:	48 89 e5             	mov    %rsp,%rbp
+  803f77:	48 83 ec 50          	sub    $0x50,%rsp
+  803f7b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803f7f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803f83:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803f87:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  803f8b:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803f92:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803f96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803f9a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803f9e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  803fa2:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  803fa7:	eb 15                	jmp    803fbe <spawnl+0x4b>
+  803fa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803fad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803fb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803fb5:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  803fb9:	74 1c                	je     803fd7 <spawnl+0x64>
+  803fbb:	83 c1 01             	add    $0x1,%ecx
+  803fbe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803fc1:	83 f8 2f             	cmp    $0x2f,%eax
+  803fc4:	77 e3                	ja     803fa9 <spawnl+0x36>
+  803fc6:	89 c2                	mov    %eax,%edx
+  803fc8:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  803fcc:	4c 01 d2             	add    %r10,%rdx
+  803fcf:	83 c0 08             	add    $0x8,%eax
+  803fd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803fd5:	eb de                	jmp    803fb5 <spawnl+0x42>
+    const char *argv[argc + 2];
+  803fd7:	8d 41 02             	lea    0x2(%rcx),%eax
+  803fda:	48 98                	cltq
+  803fdc:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  803fe3:	00 
+  803fe4:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  803fe8:	48 29 c4             	sub    %rax,%rsp
+  803feb:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  803ff0:	4c 89 c0             	mov    %r8,%rax
+  803ff3:	48 c1 e8 03          	shr    $0x3,%rax
+  803ff7:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  803ffb:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  804002:	00 
+    argv[argc + 1] = NULL;
+  804003:	8d 41 01             	lea    0x1(%rcx),%eax
+  804006:	48 98                	cltq
+  804008:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  80400f:	00 
+    va_start(vl, arg0);
+  804010:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804017:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80401b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80401f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804023:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804027:	85 c9                	test   %ecx,%ecx
+  804029:	74 41                	je     80406c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80402b:	49 89 c1             	mov    %rax,%r9
+  80402e:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804032:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804035:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80403a:	eb 1b                	jmp    804057 <spawnl+0xe4>
+  80403c:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804040:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804044:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804048:	48 8b 11             	mov    (%rcx),%rdx
+  80404b:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80404e:	48 83 c0 08          	add    $0x8,%rax
+  804052:	48 39 f0             	cmp    %rsi,%rax
+  804055:	74 15                	je     80406c <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804057:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80405a:	83 fa 2f             	cmp    $0x2f,%edx
+  80405d:	77 dd                	ja     80403c <spawnl+0xc9>
+  80405f:	89 d1                	mov    %edx,%ecx
+  804061:	4c 01 c9             	add    %r9,%rcx
+  804064:	83 c2 08             	add    $0x8,%edx
+  804067:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80406a:	eb dc                	jmp    804048 <spawnl+0xd5>
+    return spawn(prog, argv);
+  80406c:	4c 89 c6             	mov    %r8,%rsi
+  80406f:	48 b8 18 38 80 00 00 	movabs $0x803818,%rax
+  804076:	00 00 00 
+  804079:	ff d0                	call   *%rax
+}
+  80407b:	c9                   	leave
+  80407c:	c3                   	ret
+
+000000000080407d <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80407d:	55                   	push   %rbp
+  80407e:	48 89 e5             	mov    %rsp,%rbp
+  804081:	41 54                	push   %r12
+  804083:	53                   	push   %rbx
+  804084:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804087:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80408e:	00 00 00 
+  804091:	ff d0                	call   *%rax
+  804093:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804096:	48 be ef 5b 80 00 00 	movabs $0x805bef,%rsi
+  80409d:	00 00 00 
+  8040a0:	48 89 df             	mov    %rbx,%rdi
+  8040a3:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  8040aa:	00 00 00 
+  8040ad:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8040af:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8040b4:	41 2b 04 24          	sub    (%r12),%eax
+  8040b8:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8040be:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8040c5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8040c8:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8040cf:	00 00 00 
+  8040d2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8040d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040de:	5b                   	pop    %rbx
+  8040df:	41 5c                	pop    %r12
+  8040e1:	5d                   	pop    %rbp
+  8040e2:	c3                   	ret
+
+00000000008040e3 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8040e3:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040e6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8040ec:	8b 17                	mov    (%rdi),%edx
+  8040ee:	85 d2                	test   %edx,%edx
+  8040f0:	75 01                	jne    8040f3 <pipe_wakeup+0x10>
+  8040f2:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8040f3:	55                   	push   %rbp
+  8040f4:	48 89 e5             	mov    %rsp,%rbp
+  8040f7:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8040fa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804100:	be 00 04 00 00       	mov    $0x400,%esi
+  804105:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+}
+  804111:	5d                   	pop    %rbp
+  804112:	c3                   	ret
+
+0000000000804113 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  804113:	55                   	push   %rbp
+  804114:	48 89 e5             	mov    %rsp,%rbp
+  804117:	41 55                	push   %r13
+  804119:	41 54                	push   %r12
+  80411b:	53                   	push   %rbx
+  80411c:	48 83 ec 08          	sub    $0x8,%rsp
+  804120:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804123:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80412a:	00 00 00 
+  80412d:	ff d0                	call   *%rax
+  80412f:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804132:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804137:	4c 89 e6             	mov    %r12,%rsi
+  80413a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80413f:	49 bc 3c 13 80 00 00 	movabs $0x80133c,%r12
+  804146:	00 00 00 
+  804149:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80414c:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804150:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804154:	49 bd e3 40 80 00 00 	movabs $0x8040e3,%r13
+  80415b:	00 00 00 
+  80415e:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804161:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804165:	48 89 de             	mov    %rbx,%rsi
+  804168:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80416b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804170:	48 89 de             	mov    %rbx,%rsi
+  804173:	bf 00 00 00 00       	mov    $0x0,%edi
+  804178:	41 ff d4             	call   *%r12
+  80417b:	48 83 c4 08          	add    $0x8,%rsp
+  80417f:	5b                   	pop    %rbx
+  804180:	41 5c                	pop    %r12
+  804182:	41 5d                	pop    %r13
+  804184:	5d                   	pop    %rbp
+  804185:	c3                   	ret
+
+0000000000804186 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804186:	55                   	push   %rbp
+  804187:	48 89 e5             	mov    %rsp,%rbp
+  80418a:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80418d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804192:	be 00 10 00 00       	mov    $0x1000,%esi
+  804197:	48 b8 7f 12 80 00 00 	movabs $0x80127f,%rax
+  80419e:	00 00 00 
+  8041a1:	ff d0                	call   *%rax
+  8041a3:	85 c0                	test   %eax,%eax
+  8041a5:	0f 94 c0             	sete   %al
+  8041a8:	0f b6 c0             	movzbl %al,%eax
+}
+  8041ab:	5d                   	pop    %rbp
+  8041ac:	c3                   	ret
+
+00000000008041ad <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041ad:	55                   	push   %rbp
+  8041ae:	48 89 e5             	mov    %rsp,%rbp
+  8041b1:	41 57                	push   %r15
+  8041b3:	41 56                	push   %r14
+  8041b5:	41 55                	push   %r13
+  8041b7:	41 54                	push   %r12
+  8041b9:	53                   	push   %rbx
+  8041ba:	48 83 ec 38          	sub    $0x38,%rsp
+  8041be:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8041c2:	49 89 f4             	mov    %rsi,%r12
+  8041c5:	49 89 d7             	mov    %rdx,%r15
+  8041c8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8041cc:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8041d3:	00 00 00 
+  8041d6:	ff d0                	call   *%rax
+  8041d8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8041db:	4d 85 ff             	test   %r15,%r15
+  8041de:	0f 84 f1 00 00 00    	je     8042d5 <devpipe_write+0x128>
+  8041e4:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8041e8:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8041ec:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8041f0:	49 bd 86 41 80 00 00 	movabs $0x804186,%r13
+  8041f7:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8041fa:	49 bf e3 40 80 00 00 	movabs $0x8040e3,%r15
+  804201:	00 00 00 
+  804204:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804208:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80420c:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804210:	8b 73 04             	mov    0x4(%rbx),%esi
+  804213:	48 63 ce             	movslq %esi,%rcx
+  804216:	48 63 03             	movslq (%rbx),%rax
+  804219:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80421f:	48 39 c1             	cmp    %rax,%rcx
+  804222:	72 64                	jb     804288 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  804224:	48 89 de             	mov    %rbx,%rsi
+  804227:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80422b:	41 ff d5             	call   *%r13
+  80422e:	85 c0                	test   %eax,%eax
+  804230:	0f 85 b9 00 00 00    	jne    8042ef <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804236:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80423a:	4c 89 f7             	mov    %r14,%rdi
+  80423d:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804240:	8b 43 04             	mov    0x4(%rbx),%eax
+  804243:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80424a:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804251:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804257:	8b 03                	mov    (%rbx),%eax
+  804259:	41 39 c4             	cmp    %eax,%r12d
+  80425c:	75 b2                	jne    804210 <devpipe_write+0x63>
+  80425e:	48 89 de             	mov    %rbx,%rsi
+  804261:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804265:	41 ff d5             	call   *%r13
+  804268:	85 c0                	test   %eax,%eax
+  80426a:	75 a0                	jne    80420c <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80426c:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804271:	44 89 e6             	mov    %r12d,%esi
+  804274:	48 89 df             	mov    %rbx,%rdi
+  804277:	48 b8 04 16 80 00 00 	movabs $0x801604,%rax
+  80427e:	00 00 00 
+  804281:	ff d0                	call   *%rax
+  804283:	e9 7c ff ff ff       	jmp    804204 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804288:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80428c:	41 0f b6 38          	movzbl (%r8),%edi
+  804290:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804297:	80 80 80 
+  80429a:	48 89 c8             	mov    %rcx,%rax
+  80429d:	48 f7 e2             	mul    %rdx
+  8042a0:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8042a4:	48 89 d0             	mov    %rdx,%rax
+  8042a7:	48 c1 e0 08          	shl    $0x8,%rax
+  8042ab:	48 29 d0             	sub    %rdx,%rax
+  8042ae:	48 c1 e0 04          	shl    $0x4,%rax
+  8042b2:	48 29 c1             	sub    %rax,%rcx
+  8042b5:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8042ba:	83 c6 01             	add    $0x1,%esi
+  8042bd:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8042c0:	49 83 c0 01          	add    $0x1,%r8
+  8042c4:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8042c8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8042cc:	49 39 c0             	cmp    %rax,%r8
+  8042cf:	0f 85 2f ff ff ff    	jne    804204 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8042d5:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8042d9:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8042dd:	48 b8 e3 40 80 00 00 	movabs $0x8040e3,%rax
+  8042e4:	00 00 00 
+  8042e7:	ff d0                	call   *%rax
+    return n;
+  8042e9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8042ed:	eb 05                	jmp    8042f4 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8042ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042f4:	48 83 c4 38          	add    $0x38,%rsp
+  8042f8:	5b                   	pop    %rbx
+  8042f9:	41 5c                	pop    %r12
+  8042fb:	41 5d                	pop    %r13
+  8042fd:	41 5e                	pop    %r14
+  8042ff:	41 5f                	pop    %r15
+  804301:	5d                   	pop    %rbp
+  804302:	c3                   	ret
+
+0000000000804303 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  804303:	55                   	push   %rbp
+  804304:	48 89 e5             	mov    %rsp,%rbp
+  804307:	41 57                	push   %r15
+  804309:	41 56                	push   %r14
+  80430b:	41 55                	push   %r13
+  80430d:	41 54                	push   %r12
+  80430f:	53                   	push   %rbx
+  804310:	48 83 ec 28          	sub    $0x28,%rsp
+  804314:	49 89 fd             	mov    %rdi,%r13
+  804317:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80431b:	49 89 d4             	mov    %rdx,%r12
+  80431e:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804322:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804329:	00 00 00 
+  80432c:	ff d0                	call   *%rax
+  80432e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804331:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  804337:	49 bf 86 41 80 00 00 	movabs $0x804186,%r15
+  80433e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804341:	4d 85 e4             	test   %r12,%r12
+  804344:	0f 84 d5 00 00 00    	je     80441f <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80434a:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80434e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804352:	8b 03                	mov    (%rbx),%eax
+  804354:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804357:	75 7a                	jne    8043d3 <devpipe_read+0xd0>
+            if (i > 0) {
+  804359:	4d 85 f6             	test   %r14,%r14
+  80435c:	75 50                	jne    8043ae <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  80435e:	48 89 de             	mov    %rbx,%rsi
+  804361:	4c 89 ef             	mov    %r13,%rdi
+  804364:	41 ff d7             	call   *%r15
+  804367:	85 c0                	test   %eax,%eax
+  804369:	0f 85 c9 00 00 00    	jne    804438 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80436f:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804372:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804379:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80437f:	8b 43 04             	mov    0x4(%rbx),%eax
+  804382:	41 39 c4             	cmp    %eax,%r12d
+  804385:	75 cb                	jne    804352 <devpipe_read+0x4f>
+  804387:	48 89 de             	mov    %rbx,%rsi
+  80438a:	4c 89 ef             	mov    %r13,%rdi
+  80438d:	41 ff d7             	call   *%r15
+  804390:	85 c0                	test   %eax,%eax
+  804392:	75 be                	jne    804352 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804394:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804399:	44 89 e6             	mov    %r12d,%esi
+  80439c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8043a0:	48 b8 04 16 80 00 00 	movabs $0x801604,%rax
+  8043a7:	00 00 00 
+  8043aa:	ff d0                	call   *%rax
+  8043ac:	eb a4                	jmp    804352 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8043ae:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8043b2:	48 89 de             	mov    %rbx,%rsi
+  8043b5:	48 b8 e3 40 80 00 00 	movabs $0x8040e3,%rax
+  8043bc:	00 00 00 
+  8043bf:	ff d0                	call   *%rax
+                return i;
+  8043c1:	4c 89 f0             	mov    %r14,%rax
+}
+  8043c4:	48 83 c4 28          	add    $0x28,%rsp
+  8043c8:	5b                   	pop    %rbx
+  8043c9:	41 5c                	pop    %r12
+  8043cb:	41 5d                	pop    %r13
+  8043cd:	41 5e                	pop    %r14
+  8043cf:	41 5f                	pop    %r15
+  8043d1:	5d                   	pop    %rbp
+  8043d2:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8043d3:	48 63 c8             	movslq %eax,%rcx
+  8043d6:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8043dd:	80 80 80 
+  8043e0:	48 89 c8             	mov    %rcx,%rax
+  8043e3:	48 f7 e2             	mul    %rdx
+  8043e6:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8043ea:	48 89 d0             	mov    %rdx,%rax
+  8043ed:	48 c1 e0 08          	shl    $0x8,%rax
+  8043f1:	48 29 d0             	sub    %rdx,%rax
+  8043f4:	48 c1 e0 04          	shl    $0x4,%rax
+  8043f8:	48 89 c2             	mov    %rax,%rdx
+  8043fb:	48 89 c8             	mov    %rcx,%rax
+  8043fe:	48 29 d0             	sub    %rdx,%rax
+  804401:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  804406:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80440a:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  80440e:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804411:	49 83 c6 01          	add    $0x1,%r14
+  804415:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804419:	0f 85 2b ff ff ff    	jne    80434a <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80441f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804423:	48 89 de             	mov    %rbx,%rsi
+  804426:	48 b8 e3 40 80 00 00 	movabs $0x8040e3,%rax
+  80442d:	00 00 00 
+  804430:	ff d0                	call   *%rax
+    return n;
+  804432:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804436:	eb 8c                	jmp    8043c4 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  804438:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443d:	eb 85                	jmp    8043c4 <devpipe_read+0xc1>
+
+000000000080443f <pipe>:
+pipe(int pfd[2]) {
+  80443f:	55                   	push   %rbp
+  804440:	48 89 e5             	mov    %rsp,%rbp
+  804443:	41 55                	push   %r13
+  804445:	41 54                	push   %r12
+  804447:	53                   	push   %rbx
+  804448:	48 83 ec 18          	sub    $0x18,%rsp
+  80444c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80444f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804453:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  80445a:	00 00 00 
+  80445d:	ff d0                	call   *%rax
+  80445f:	89 c3                	mov    %eax,%ebx
+  804461:	85 c0                	test   %eax,%eax
+  804463:	0f 88 a0 01 00 00    	js     804609 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804469:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80446e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804473:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804477:	bf 00 00 00 00       	mov    $0x0,%edi
+  80447c:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  804483:	00 00 00 
+  804486:	ff d0                	call   *%rax
+  804488:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80448a:	85 c0                	test   %eax,%eax
+  80448c:	0f 88 77 01 00 00    	js     804609 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804492:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804496:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  80449d:	00 00 00 
+  8044a0:	ff d0                	call   *%rax
+  8044a2:	89 c3                	mov    %eax,%ebx
+  8044a4:	85 c0                	test   %eax,%eax
+  8044a6:	0f 88 43 01 00 00    	js     8045ef <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  8044ac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044b1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044b6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8044ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044bf:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  8044c6:	00 00 00 
+  8044c9:	ff d0                	call   *%rax
+  8044cb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8044cd:	85 c0                	test   %eax,%eax
+  8044cf:	0f 88 1a 01 00 00    	js     8045ef <pipe+0x1b0>
+    va = fd2data(fd0);
+  8044d5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8044d9:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  8044e0:	00 00 00 
+  8044e3:	ff d0                	call   *%rax
+  8044e5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8044e8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044ed:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044f2:	48 89 c6             	mov    %rax,%rsi
+  8044f5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044fa:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  804501:	00 00 00 
+  804504:	ff d0                	call   *%rax
+  804506:	89 c3                	mov    %eax,%ebx
+  804508:	85 c0                	test   %eax,%eax
+  80450a:	0f 88 c5 00 00 00    	js     8045d5 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804510:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804514:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  80451b:	00 00 00 
+  80451e:	ff d0                	call   *%rax
+  804520:	48 89 c1             	mov    %rax,%rcx
+  804523:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804529:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80452f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804534:	4c 89 ee             	mov    %r13,%rsi
+  804537:	bf 00 00 00 00       	mov    $0x0,%edi
+  80453c:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  804543:	00 00 00 
+  804546:	ff d0                	call   *%rax
+  804548:	89 c3                	mov    %eax,%ebx
+  80454a:	85 c0                	test   %eax,%eax
+  80454c:	78 6e                	js     8045bc <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80454e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804553:	4c 89 ef             	mov    %r13,%rdi
+  804556:	48 b8 5b 12 80 00 00 	movabs $0x80125b,%rax
+  80455d:	00 00 00 
+  804560:	ff d0                	call   *%rax
+  804562:	83 f8 02             	cmp    $0x2,%eax
+  804565:	0f 85 ab 00 00 00    	jne    804616 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80456b:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804572:	00 00 
+  804574:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804578:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80457a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80457e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804585:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804589:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80458b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80458f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804596:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80459a:	48 bb c9 16 80 00 00 	movabs $0x8016c9,%rbx
+  8045a1:	00 00 00 
+  8045a4:	ff d3                	call   *%rbx
+  8045a6:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  8045aa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8045ae:	ff d3                	call   *%rbx
+  8045b0:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  8045b5:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8045ba:	eb 4d                	jmp    804609 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  8045bc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045c1:	4c 89 ee             	mov    %r13,%rsi
+  8045c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045c9:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  8045d0:	00 00 00 
+  8045d3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  8045d5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045da:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  8045de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045e3:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  8045ea:	00 00 00 
+  8045ed:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8045ef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045f4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8045f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8045fd:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  804604:	00 00 00 
+  804607:	ff d0                	call   *%rax
+}
+  804609:	89 d8                	mov    %ebx,%eax
+  80460b:	48 83 c4 18          	add    $0x18,%rsp
+  80460f:	5b                   	pop    %rbx
+  804610:	41 5c                	pop    %r12
+  804612:	41 5d                	pop    %r13
+  804614:	5d                   	pop    %rbp
+  804615:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804616:	48 b9 08 5c 80 00 00 	movabs $0x805c08,%rcx
+  80461d:	00 00 00 
+  804620:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  804627:	00 00 00 
+  80462a:	be 50 00 00 00       	mov    $0x50,%esi
+  80462f:	48 bf f6 5b 80 00 00 	movabs $0x805bf6,%rdi
+  804636:	00 00 00 
+  804639:	b8 00 00 00 00       	mov    $0x0,%eax
+  80463e:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  804645:	00 00 00 
+  804648:	41 ff d0             	call   *%r8
+
+000000000080464b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80464b:	55                   	push   %rbp
+  80464c:	48 89 e5             	mov    %rsp,%rbp
+  80464f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804653:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804657:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  80465e:	00 00 00 
+  804661:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804663:	85 c0                	test   %eax,%eax
+  804665:	78 23                	js     80468a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804667:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80466b:	48 b8 db 16 80 00 00 	movabs $0x8016db,%rax
+  804672:	00 00 00 
+  804675:	ff d0                	call   *%rax
+  804677:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80467a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80467e:	48 b8 86 41 80 00 00 	movabs $0x804186,%rax
+  804685:	00 00 00 
+  804688:	ff d0                	call   *%rax
+}
+  80468a:	c9                   	leave
+  80468b:	c3                   	ret
+
+000000000080468c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80468c:	48 89 f8             	mov    %rdi,%rax
+  80468f:	48 c1 e8 27          	shr    $0x27,%rax
+  804693:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80469a:	01 00 00 
+  80469d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046a1:	f6 c2 01             	test   $0x1,%dl
+  8046a4:	74 6d                	je     804713 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8046a6:	48 89 f8             	mov    %rdi,%rax
+  8046a9:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8046ad:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046b4:	01 00 00 
+  8046b7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046bb:	f6 c2 01             	test   $0x1,%dl
+  8046be:	74 62                	je     804722 <get_uvpt_entry+0x96>
+  8046c0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8046c7:	01 00 00 
+  8046ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046ce:	f6 c2 80             	test   $0x80,%dl
+  8046d1:	75 4f                	jne    804722 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8046d3:	48 89 f8             	mov    %rdi,%rax
+  8046d6:	48 c1 e8 15          	shr    $0x15,%rax
+  8046da:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8046e1:	01 00 00 
+  8046e4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046e8:	f6 c2 01             	test   $0x1,%dl
+  8046eb:	74 44                	je     804731 <get_uvpt_entry+0xa5>
+  8046ed:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8046f4:	01 00 00 
+  8046f7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8046fb:	f6 c2 80             	test   $0x80,%dl
+  8046fe:	75 31                	jne    804731 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804700:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804704:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80470b:	01 00 00 
+  80470e:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804712:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804713:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80471a:	01 00 00 
+  80471d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804721:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804722:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804729:	01 00 00 
+  80472c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804730:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804731:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804738:	01 00 00 
+  80473b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80473f:	c3                   	ret
+
+0000000000804740 <get_prot>:
+
+int
+get_prot(void *va) {
+  804740:	55                   	push   %rbp
+  804741:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804744:	48 b8 8c 46 80 00 00 	movabs $0x80468c,%rax
+  80474b:	00 00 00 
+  80474e:	ff d0                	call   *%rax
+  804750:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804753:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804758:	89 c1                	mov    %eax,%ecx
+  80475a:	83 c9 04             	or     $0x4,%ecx
+  80475d:	f6 c2 01             	test   $0x1,%dl
+  804760:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804763:	89 c1                	mov    %eax,%ecx
+  804765:	83 c9 02             	or     $0x2,%ecx
+  804768:	f6 c2 02             	test   $0x2,%dl
+  80476b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80476e:	89 c1                	mov    %eax,%ecx
+  804770:	83 c9 01             	or     $0x1,%ecx
+  804773:	48 85 d2             	test   %rdx,%rdx
+  804776:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804779:	89 c1                	mov    %eax,%ecx
+  80477b:	83 c9 40             	or     $0x40,%ecx
+  80477e:	f6 c6 04             	test   $0x4,%dh
+  804781:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804784:	5d                   	pop    %rbp
+  804785:	c3                   	ret
+
+0000000000804786 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804786:	55                   	push   %rbp
+  804787:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80478a:	48 b8 8c 46 80 00 00 	movabs $0x80468c,%rax
+  804791:	00 00 00 
+  804794:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804796:	48 c1 e8 06          	shr    $0x6,%rax
+  80479a:	83 e0 01             	and    $0x1,%eax
+}
+  80479d:	5d                   	pop    %rbp
+  80479e:	c3                   	ret
+
+000000000080479f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80479f:	55                   	push   %rbp
+  8047a0:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8047a3:	48 b8 8c 46 80 00 00 	movabs $0x80468c,%rax
+  8047aa:	00 00 00 
+  8047ad:	ff d0                	call   *%rax
+  8047af:	83 e0 01             	and    $0x1,%eax
+}
+  8047b2:	5d                   	pop    %rbp
+  8047b3:	c3                   	ret
+
+00000000008047b4 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8047b4:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8047bb:	01 00 00 
+  8047be:	a8 01                	test   $0x1,%al
+  8047c0:	75 06                	jne    8047c8 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8047c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047c7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8047c8:	55                   	push   %rbp
+  8047c9:	48 89 e5             	mov    %rsp,%rbp
+  8047cc:	41 57                	push   %r15
+  8047ce:	41 56                	push   %r14
+  8047d0:	41 55                	push   %r13
+  8047d2:	41 54                	push   %r12
+  8047d4:	53                   	push   %rbx
+  8047d5:	48 83 ec 28          	sub    $0x28,%rsp
+  8047d9:	49 89 fe             	mov    %rdi,%r14
+  8047dc:	49 89 f7             	mov    %rsi,%r15
+  8047df:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8047e6:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8047e7:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8047ee:	01 00 00 
+  8047f1:	e9 ae 00 00 00       	jmp    8048a4 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8047f6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8047fd:	49 83 ec 01          	sub    $0x1,%r12
+  804801:	74 2d                	je     804830 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804803:	48 89 d8             	mov    %rbx,%rax
+  804806:	48 c1 e8 0c          	shr    $0xc,%rax
+  80480a:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80480f:	f6 c2 01             	test   $0x1,%dl
+  804812:	74 e2                	je     8047f6 <foreach_shared_region+0x42>
+  804814:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804819:	f6 c4 04             	test   $0x4,%ah
+  80481c:	74 d8                	je     8047f6 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80481e:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804825:	4c 89 fa             	mov    %r15,%rdx
+  804828:	48 89 df             	mov    %rbx,%rdi
+  80482b:	41 ff d6             	call   *%r14
+  80482e:	eb c6                	jmp    8047f6 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804830:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804837:	00 
+  804838:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80483d:	74 4a                	je     804889 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80483f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804843:	48 c1 e8 15          	shr    $0x15,%rax
+  804847:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80484e:	01 00 00 
+  804851:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804855:	a8 01                	test   $0x1,%al
+  804857:	74 d7                	je     804830 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804859:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80485d:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804864:	48 39 c3             	cmp    %rax,%rbx
+  804867:	73 c7                	jae    804830 <foreach_shared_region+0x7c>
+  804869:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804870:	48 39 d0             	cmp    %rdx,%rax
+  804873:	4d 19 e4             	sbb    %r12,%r12
+  804876:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80487d:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804884:	e9 7a ff ff ff       	jmp    804803 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804889:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804890:	40 
+  804891:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804895:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80489c:	00 00 00 
+  80489f:	48 39 c1             	cmp    %rax,%rcx
+  8048a2:	74 50                	je     8048f4 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8048a4:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8048a8:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8048ac:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8048b3:	01 00 00 
+  8048b6:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8048ba:	a8 01                	test   $0x1,%al
+  8048bc:	74 cb                	je     804889 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8048be:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8048c2:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8048c9:	48 39 c1             	cmp    %rax,%rcx
+  8048cc:	73 bb                	jae    804889 <foreach_shared_region+0xd5>
+  8048ce:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8048d5:	48 39 d0             	cmp    %rdx,%rax
+  8048d8:	48 19 c0             	sbb    %rax,%rax
+  8048db:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8048e1:	48 05 00 02 00 00    	add    $0x200,%rax
+  8048e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8048eb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8048ef:	e9 4b ff ff ff       	jmp    80483f <foreach_shared_region+0x8b>
+  8048f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048f9:	48 83 c4 28          	add    $0x28,%rsp
+  8048fd:	5b                   	pop    %rbx
+  8048fe:	41 5c                	pop    %r12
+  804900:	41 5d                	pop    %r13
+  804902:	41 5e                	pop    %r14
+  804904:	41 5f                	pop    %r15
+  804906:	5d                   	pop    %rbp
+  804907:	c3                   	ret
+
+0000000000804908 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804908:	55                   	push   %rbp
+  804909:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  80490c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804913:	00 00 00 
+  804916:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  80491d:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804924:	00 00 00 
+  804927:	48 39 c2             	cmp    %rax,%rdx
+  80492a:	74 13                	je     80493f <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  80492c:	48 89 c7             	mov    %rax,%rdi
+  80492f:	48 b8 7b 15 80 00 00 	movabs $0x80157b,%rax
+  804936:	00 00 00 
+  804939:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  80493b:	85 c0                	test   %eax,%eax
+  80493d:	78 0c                	js     80494b <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  80493f:	48 b8 db 15 80 00 00 	movabs $0x8015db,%rax
+  804946:	00 00 00 
+  804949:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  80494b:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804952:	00 00 00 
+  804955:	8b 0a                	mov    (%rdx),%ecx
+  804957:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  80495a:	5d                   	pop    %rbp
+  80495b:	c3                   	ret
+
+000000000080495c <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  80495c:	55                   	push   %rbp
+  80495d:	48 89 e5             	mov    %rsp,%rbp
+  804960:	41 57                	push   %r15
+  804962:	41 56                	push   %r14
+  804964:	41 55                	push   %r13
+  804966:	41 54                	push   %r12
+  804968:	53                   	push   %rbx
+  804969:	48 83 ec 18          	sub    $0x18,%rsp
+  80496d:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804971:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804978:	00 00 00 
+  80497b:	83 38 00             	cmpl   $0x0,(%rax)
+  80497e:	75 69                	jne    8049e9 <scring_push+0x8d>
+  804980:	49 89 ff             	mov    %rdi,%r15
+  804983:	49 89 f6             	mov    %rsi,%r14
+  804986:	49 89 d5             	mov    %rdx,%r13
+  804989:	49 89 cc             	mov    %rcx,%r12
+  80498c:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  80498f:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804996:	00 00 00 
+  804999:	8b 42 04             	mov    0x4(%rdx),%eax
+  80499c:	8b 12                	mov    (%rdx),%edx
+  80499e:	29 d0                	sub    %edx,%eax
+  8049a0:	83 f8 20             	cmp    $0x20,%eax
+  8049a3:	74 53                	je     8049f8 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  8049a5:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  8049ac:	00 00 00 
+  8049af:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  8049b2:	83 e0 1f             	and    $0x1f,%eax
+  8049b5:	48 c1 e0 06          	shl    $0x6,%rax
+  8049b9:	48 01 d0             	add    %rdx,%rax
+  8049bc:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  8049c0:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  8049c4:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  8049c8:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  8049cc:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  8049d0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8049d4:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  8049d8:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  8049dc:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  8049e0:	8b 42 04             	mov    0x4(%rdx),%eax
+  8049e3:	83 c0 01             	add    $0x1,%eax
+  8049e6:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  8049e9:	48 83 c4 18          	add    $0x18,%rsp
+  8049ed:	5b                   	pop    %rbx
+  8049ee:	41 5c                	pop    %r12
+  8049f0:	41 5d                	pop    %r13
+  8049f2:	41 5e                	pop    %r14
+  8049f4:	41 5f                	pop    %r15
+  8049f6:	5d                   	pop    %rbp
+  8049f7:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  8049f8:	48 b8 08 49 80 00 00 	movabs $0x804908,%rax
+  8049ff:	00 00 00 
+  804a02:	ff d0                	call   *%rax
+  804a04:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  804a0b:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804a0d:	85 c0                	test   %eax,%eax
+  804a0f:	79 94                	jns    8049a5 <scring_push+0x49>
+  804a11:	eb d6                	jmp    8049e9 <scring_push+0x8d>
+
+0000000000804a13 <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804a13:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804a1a:	00 00 00 
+  804a1d:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804a1f:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804a25:	85 c0                	test   %eax,%eax
+  804a27:	78 14                	js     804a3d <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804a29:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804a30:	00 00 00 
+  804a33:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  804a36:	8b 12                	mov    (%rdx),%edx
+  804a38:	39 d1                	cmp    %edx,%ecx
+  804a3a:	75 11                	jne    804a4d <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  804a3c:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  804a3d:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804a44:	00 00 00 
+  804a47:	8b 0a                	mov    (%rdx),%ecx
+  804a49:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804a4c:	c3                   	ret
+scring_submit(void) {
+  804a4d:	55                   	push   %rbp
+  804a4e:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  804a51:	48 b8 08 49 80 00 00 	movabs $0x804908,%rax
+  804a58:	00 00 00 
+  804a5b:	ff d0                	call   *%rax
+}
+  804a5d:	5d                   	pop    %rbp
+  804a5e:	c3                   	ret
+
+0000000000804a5f <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  804a5f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804a66:	00 00 00 
+  804a69:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  804a6f:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804a76:	00 00 00 
+  804a79:	8b 10                	mov    (%rax),%edx
+  804a7b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804a7e:	c3                   	ret
+
+0000000000804a7f <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  804a7f:	55                   	push   %rbp
+  804a80:	48 89 e5             	mov    %rsp,%rbp
+  804a83:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804a86:	48 63 f7             	movslq %edi,%rsi
+  804a89:	48 83 ec 08          	sub    $0x8,%rsp
+  804a8d:	6a 00                	push   $0x0
+  804a8f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a95:	4c 63 c1             	movslq %ecx,%r8
+  804a98:	48 89 d1             	mov    %rdx,%rcx
+  804a9b:	48 89 c2             	mov    %rax,%rdx
+  804a9e:	bf 04 00 00 00       	mov    $0x4,%edi
+  804aa3:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  804aaa:	00 00 00 
+  804aad:	ff d0                	call   *%rax
+}
+  804aaf:	48 83 c4 10          	add    $0x10,%rsp
+  804ab3:	c9                   	leave
+  804ab4:	c3                   	ret
+
+0000000000804ab5 <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804ab5:	55                   	push   %rbp
+  804ab6:	48 89 e5             	mov    %rsp,%rbp
+  804ab9:	48 89 f0             	mov    %rsi,%rax
+  804abc:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  804abf:	48 63 ca             	movslq %edx,%rcx
+  804ac2:	48 63 f7             	movslq %edi,%rsi
+  804ac5:	48 83 ec 08          	sub    $0x8,%rsp
+  804ac9:	4d 63 c9             	movslq %r9d,%r9
+  804acc:	41 51                	push   %r9
+  804ace:	4d 89 c1             	mov    %r8,%r9
+  804ad1:	4d 89 d0             	mov    %r10,%r8
+  804ad4:	48 89 c2             	mov    %rax,%rdx
+  804ad7:	bf 05 00 00 00       	mov    $0x5,%edi
+  804adc:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  804ae3:	00 00 00 
+  804ae6:	ff d0                	call   *%rax
+}
+  804ae8:	48 83 c4 10          	add    $0x10,%rsp
+  804aec:	c9                   	leave
+  804aed:	c3                   	ret
+
+0000000000804aee <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  804aee:	55                   	push   %rbp
+  804aef:	48 89 e5             	mov    %rsp,%rbp
+  804af2:	48 89 f0             	mov    %rsi,%rax
+  804af5:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  804af8:	48 63 f7             	movslq %edi,%rsi
+  804afb:	48 83 ec 08          	sub    $0x8,%rsp
+  804aff:	6a 00                	push   $0x0
+  804b01:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804b07:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804b0d:	48 89 c2             	mov    %rax,%rdx
+  804b10:	bf 06 00 00 00       	mov    $0x6,%edi
+  804b15:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  804b1c:	00 00 00 
+  804b1f:	ff d0                	call   *%rax
+}
+  804b21:	48 83 c4 10          	add    $0x10,%rsp
+  804b25:	c9                   	leave
+  804b26:	c3                   	ret
+
+0000000000804b27 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  804b27:	55                   	push   %rbp
+  804b28:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  804b2b:	48 63 d6             	movslq %esi,%rdx
+  804b2e:	48 63 f7             	movslq %edi,%rsi
+  804b31:	48 83 ec 08          	sub    $0x8,%rsp
+  804b35:	6a 00                	push   $0x0
+  804b37:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804b3d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804b43:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b48:	bf 09 00 00 00       	mov    $0x9,%edi
+  804b4d:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+}
+  804b59:	48 83 c4 10          	add    $0x10,%rsp
+  804b5d:	c9                   	leave
+  804b5e:	c3                   	ret
+
+0000000000804b5f <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  804b5f:	55                   	push   %rbp
+  804b60:	48 89 e5             	mov    %rsp,%rbp
+  804b63:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  804b66:	48 63 f7             	movslq %edi,%rsi
+  804b69:	48 83 ec 08          	sub    $0x8,%rsp
+  804b6d:	6a 00                	push   $0x0
+  804b6f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804b75:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804b7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804b80:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804b85:	48 b8 5c 49 80 00 00 	movabs $0x80495c,%rax
+  804b8c:	00 00 00 
+  804b8f:	ff d0                	call   *%rax
+}
+  804b91:	48 83 c4 10          	add    $0x10,%rsp
+  804b95:	c9                   	leave
+  804b96:	c3                   	ret
+
+0000000000804b97 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804b97:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804b9d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804ba4:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804bab:	c3                   	ret
+
+0000000000804bac <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804bac:	8b 47 40             	mov    0x40(%rdi),%eax
+  804baf:	8b 17                	mov    (%rdi),%edx
+  804bb1:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804bb3:	83 f8 0f             	cmp    $0xf,%eax
+  804bb6:	77 13                	ja     804bcb <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804bb8:	8b 47 40             	mov    0x40(%rdi),%eax
+  804bbb:	83 e0 0f             	and    $0xf,%eax
+  804bbe:	48 c1 e0 09          	shl    $0x9,%rax
+  804bc2:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804bc9:	00 
+  804bca:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804bcb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804bd0:	c3                   	ret
+
+0000000000804bd1 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804bd1:	8b 47 40             	mov    0x40(%rdi),%eax
+  804bd4:	83 c0 01             	add    $0x1,%eax
+  804bd7:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804bda:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804be0:	8b 57 04             	mov    0x4(%rdi),%edx
+  804be3:	b8 00 00 00 00       	mov    $0x0,%eax
+  804be8:	85 d2                	test   %edx,%edx
+  804bea:	75 04                	jne    804bf0 <chan_publish+0x1f>
+  804bec:	83 e0 01             	and    $0x1,%eax
+}
+  804bef:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804bf0:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804bf3:	85 c0                	test   %eax,%eax
+  804bf5:	0f 95 c0             	setne  %al
+  804bf8:	0f b6 c0             	movzbl %al,%eax
+  804bfb:	eb ef                	jmp    804bec <chan_publish+0x1b>
+
+0000000000804bfd <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804bfd:	8b 47 40             	mov    0x40(%rdi),%eax
+  804c00:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804c02:	29 d0                	sub    %edx,%eax
+  804c04:	83 e8 01             	sub    $0x1,%eax
+  804c07:	83 f8 0f             	cmp    $0xf,%eax
+  804c0a:	77 12                	ja     804c1e <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804c0c:	8b 07                	mov    (%rdi),%eax
+  804c0e:	83 e0 0f             	and    $0xf,%eax
+  804c11:	48 c1 e0 09          	shl    $0x9,%rax
+  804c15:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804c1c:	00 
+  804c1d:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c23:	c3                   	ret
+
+0000000000804c24 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804c24:	8b 07                	mov    (%rdi),%eax
+  804c26:	83 c0 01             	add    $0x1,%eax
+  804c29:	89 07                	mov    %eax,(%rdi)
+}
+  804c2b:	c3                   	ret
+
+0000000000804c2c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804c2c:	55                   	push   %rbp
+  804c2d:	48 89 e5             	mov    %rsp,%rbp
+  804c30:	53                   	push   %rbx
+  804c31:	48 83 ec 08          	sub    $0x8,%rsp
+  804c35:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804c38:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804c3f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804c45:	48 b8 fd 4b 80 00 00 	movabs $0x804bfd,%rax
+  804c4c:	00 00 00 
+  804c4f:	ff d0                	call   *%rax
+  804c51:	48 85 c0             	test   %rax,%rax
+  804c54:	74 12                	je     804c68 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804c56:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804c5d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804c62:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804c66:	c9                   	leave
+  804c67:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804c68:	b8 01 00 00 00       	mov    $0x1,%eax
+  804c6d:	eb f3                	jmp    804c62 <chan_arm+0x36>
+
+0000000000804c6f <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804c6f:	55                   	push   %rbp
+  804c70:	48 89 e5             	mov    %rsp,%rbp
+  804c73:	41 56                	push   %r14
+  804c75:	41 55                	push   %r13
+  804c77:	41 54                	push   %r12
+  804c79:	53                   	push   %rbx
+  804c7a:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804c7d:	49 bc 2c 4c 80 00 00 	movabs $0x804c2c,%r12
+  804c84:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804c87:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804c8b:	49 bd 04 16 80 00 00 	movabs $0x801604,%r13
+  804c92:	00 00 00 
+    while (chan_arm(r))
+  804c95:	eb 0d                	jmp    804ca4 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804c97:	8b 33                	mov    (%rbx),%esi
+  804c99:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c9e:	4c 89 f7             	mov    %r14,%rdi
+  804ca1:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804ca4:	48 89 df             	mov    %rbx,%rdi
+  804ca7:	41 ff d4             	call   *%r12
+  804caa:	84 c0                	test   %al,%al
+  804cac:	75 e9                	jne    804c97 <chan_wait+0x28>
+}
+  804cae:	5b                   	pop    %rbx
+  804caf:	41 5c                	pop    %r12
+  804cb1:	41 5d                	pop    %r13
+  804cb3:	41 5e                	pop    %r14
+  804cb5:	5d                   	pop    %rbp
+  804cb6:	c3                   	ret
+
+0000000000804cb7 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804cb7:	55                   	push   %rbp
+  804cb8:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804cbb:	48 83 c7 40          	add    $0x40,%rdi
+  804cbf:	be 01 00 00 00       	mov    $0x1,%esi
+  804cc4:	48 b8 22 16 80 00 00 	movabs $0x801622,%rax
+  804ccb:	00 00 00 
+  804cce:	ff d0                	call   *%rax
+}
+  804cd0:	5d                   	pop    %rbp
+  804cd1:	c3                   	ret
+
+0000000000804cd2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cd7:	c3                   	ret
+
+0000000000804cd8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804cd8:	55                   	push   %rbp
+  804cd9:	48 89 e5             	mov    %rsp,%rbp
+  804cdc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804cdf:	48 be 2c 5c 80 00 00 	movabs $0x805c2c,%rsi
+  804ce6:	00 00 00 
+  804ce9:	48 b8 37 0d 80 00 00 	movabs $0x800d37,%rax
+  804cf0:	00 00 00 
+  804cf3:	ff d0                	call   *%rax
+    return 0;
+}
+  804cf5:	b8 00 00 00 00       	mov    $0x0,%eax
+  804cfa:	5d                   	pop    %rbp
+  804cfb:	c3                   	ret
+
+0000000000804cfc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804cfc:	55                   	push   %rbp
+  804cfd:	48 89 e5             	mov    %rsp,%rbp
+  804d00:	41 57                	push   %r15
+  804d02:	41 56                	push   %r14
+  804d04:	41 55                	push   %r13
+  804d06:	41 54                	push   %r12
+  804d08:	53                   	push   %rbx
+  804d09:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804d10:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804d17:	48 85 d2             	test   %rdx,%rdx
+  804d1a:	74 7a                	je     804d96 <devcons_write+0x9a>
+  804d1c:	49 89 d6             	mov    %rdx,%r14
+  804d1f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d25:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804d2a:	49 bf 31 0f 80 00 00 	movabs $0x800f31,%r15
+  804d31:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804d34:	4c 89 f3             	mov    %r14,%rbx
+  804d37:	48 29 f3             	sub    %rsi,%rbx
+  804d3a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804d3f:	48 39 c3             	cmp    %rax,%rbx
+  804d42:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804d46:	4c 63 eb             	movslq %ebx,%r13
+  804d49:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804d50:	48 01 c6             	add    %rax,%rsi
+  804d53:	4c 89 ea             	mov    %r13,%rdx
+  804d56:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804d5d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804d60:	4c 89 ee             	mov    %r13,%rsi
+  804d63:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804d6a:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  804d71:	00 00 00 
+  804d74:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804d76:	41 01 dc             	add    %ebx,%r12d
+  804d79:	49 63 f4             	movslq %r12d,%rsi
+  804d7c:	4c 39 f6             	cmp    %r14,%rsi
+  804d7f:	72 b3                	jb     804d34 <devcons_write+0x38>
+    return res;
+  804d81:	49 63 c4             	movslq %r12d,%rax
+}
+  804d84:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804d8b:	5b                   	pop    %rbx
+  804d8c:	41 5c                	pop    %r12
+  804d8e:	41 5d                	pop    %r13
+  804d90:	41 5e                	pop    %r14
+  804d92:	41 5f                	pop    %r15
+  804d94:	5d                   	pop    %rbp
+  804d95:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804d96:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804d9c:	eb e3                	jmp    804d81 <devcons_write+0x85>
+
+0000000000804d9e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804d9e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804da1:	ba 00 00 00 00       	mov    $0x0,%edx
+  804da6:	48 85 c0             	test   %rax,%rax
+  804da9:	74 55                	je     804e00 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804dab:	55                   	push   %rbp
+  804dac:	48 89 e5             	mov    %rsp,%rbp
+  804daf:	41 55                	push   %r13
+  804db1:	41 54                	push   %r12
+  804db3:	53                   	push   %rbx
+  804db4:	48 83 ec 08          	sub    $0x8,%rsp
+  804db8:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804dbb:	48 bb 7d 11 80 00 00 	movabs $0x80117d,%rbx
+  804dc2:	00 00 00 
+  804dc5:	49 bc 32 12 80 00 00 	movabs $0x801232,%r12
+  804dcc:	00 00 00 
+  804dcf:	eb 03                	jmp    804dd4 <devcons_read+0x36>
+  804dd1:	41 ff d4             	call   *%r12
+  804dd4:	ff d3                	call   *%rbx
+  804dd6:	85 c0                	test   %eax,%eax
+  804dd8:	74 f7                	je     804dd1 <devcons_read+0x33>
+    if (c < 0) return c;
+  804dda:	48 63 d0             	movslq %eax,%rdx
+  804ddd:	78 13                	js     804df2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804ddf:	ba 00 00 00 00       	mov    $0x0,%edx
+  804de4:	83 f8 04             	cmp    $0x4,%eax
+  804de7:	74 09                	je     804df2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804de9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804ded:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804df2:	48 89 d0             	mov    %rdx,%rax
+  804df5:	48 83 c4 08          	add    $0x8,%rsp
+  804df9:	5b                   	pop    %rbx
+  804dfa:	41 5c                	pop    %r12
+  804dfc:	41 5d                	pop    %r13
+  804dfe:	5d                   	pop    %rbp
+  804dff:	c3                   	ret
+  804e00:	48 89 d0             	mov    %rdx,%rax
+  804e03:	c3                   	ret
+
+0000000000804e04 <cputchar>:
+cputchar(int ch) {
+  804e04:	55                   	push   %rbp
+  804e05:	48 89 e5             	mov    %rsp,%rbp
+  804e08:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804e0c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804e10:	be 01 00 00 00       	mov    $0x1,%esi
+  804e15:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804e19:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  804e20:	00 00 00 
+  804e23:	ff d0                	call   *%rax
+}
+  804e25:	c9                   	leave
+  804e26:	c3                   	ret
+
+0000000000804e27 <getchar>:
+getchar(void) {
+  804e27:	55                   	push   %rbp
+  804e28:	48 89 e5             	mov    %rsp,%rbp
+  804e2b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804e2f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804e34:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e3d:	48 b8 3a 1a 80 00 00 	movabs $0x801a3a,%rax
+  804e44:	00 00 00 
+  804e47:	ff d0                	call   *%rax
+  804e49:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804e4b:	85 c0                	test   %eax,%eax
+  804e4d:	78 06                	js     804e55 <getchar+0x2e>
+  804e4f:	74 08                	je     804e59 <getchar+0x32>
+  804e51:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804e55:	89 d0                	mov    %edx,%eax
+  804e57:	c9                   	leave
+  804e58:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804e59:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804e5e:	eb f5                	jmp    804e55 <getchar+0x2e>
+
+0000000000804e60 <iscons>:
+iscons(int fdnum) {
+  804e60:	55                   	push   %rbp
+  804e61:	48 89 e5             	mov    %rsp,%rbp
+  804e64:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804e68:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804e6c:	48 b8 57 17 80 00 00 	movabs $0x801757,%rax
+  804e73:	00 00 00 
+  804e76:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804e78:	85 c0                	test   %eax,%eax
+  804e7a:	78 18                	js     804e94 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804e7c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804e80:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804e87:	00 00 00 
+  804e8a:	8b 00                	mov    (%rax),%eax
+  804e8c:	39 02                	cmp    %eax,(%rdx)
+  804e8e:	0f 94 c0             	sete   %al
+  804e91:	0f b6 c0             	movzbl %al,%eax
+}
+  804e94:	c9                   	leave
+  804e95:	c3                   	ret
+
+0000000000804e96 <opencons>:
+opencons(void) {
+  804e96:	55                   	push   %rbp
+  804e97:	48 89 e5             	mov    %rsp,%rbp
+  804e9a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804e9e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804ea2:	48 b8 f7 16 80 00 00 	movabs $0x8016f7,%rax
+  804ea9:	00 00 00 
+  804eac:	ff d0                	call   *%rax
+  804eae:	85 c0                	test   %eax,%eax
+  804eb0:	78 49                	js     804efb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804eb2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804eb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ebc:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804ec0:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ec5:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  804ecc:	00 00 00 
+  804ecf:	ff d0                	call   *%rax
+  804ed1:	85 c0                	test   %eax,%eax
+  804ed3:	78 26                	js     804efb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804ed5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804ed9:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804ee0:	00 00 
+  804ee2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804ee4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804ee8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804eef:	48 b8 c9 16 80 00 00 	movabs $0x8016c9,%rax
+  804ef6:	00 00 00 
+  804ef9:	ff d0                	call   *%rax
+}
+  804efb:	c9                   	leave
+  804efc:	c3                   	ret
+
+0000000000804efd <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804efd:	55                   	push   %rbp
+  804efe:	48 89 e5             	mov    %rsp,%rbp
+  804f01:	41 56                	push   %r14
+  804f03:	41 55                	push   %r13
+  804f05:	41 54                	push   %r12
+  804f07:	53                   	push   %rbx
+  804f08:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f0b:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  804f12:	00 00 00 
+  804f15:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804f19:	74 27                	je     804f42 <_handle_vectored_pagefault+0x45>
+  804f1b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804f20:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  804f27:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f2a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804f2d:	4c 89 e7             	mov    %r12,%rdi
+  804f30:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804f35:	84 c0                	test   %al,%al
+  804f37:	75 45                	jne    804f7e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804f39:	48 83 c3 01          	add    $0x1,%rbx
+  804f3d:	49 3b 1e             	cmp    (%r14),%rbx
+  804f40:	72 eb                	jb     804f2d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804f42:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804f49:	00 
+  804f4a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804f4f:	4d 8b 04 24          	mov    (%r12),%r8
+  804f53:	48 ba 38 5c 80 00 00 	movabs $0x805c38,%rdx
+  804f5a:	00 00 00 
+  804f5d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804f62:	48 bf 68 5c 80 00 00 	movabs $0x805c68,%rdi
+  804f69:	00 00 00 
+  804f6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804f71:	49 ba c2 02 80 00 00 	movabs $0x8002c2,%r10
+  804f78:	00 00 00 
+  804f7b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804f7e:	5b                   	pop    %rbx
+  804f7f:	41 5c                	pop    %r12
+  804f81:	41 5d                	pop    %r13
+  804f83:	41 5e                	pop    %r14
+  804f85:	5d                   	pop    %rbp
+  804f86:	c3                   	ret
+
+0000000000804f87 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804f87:	55                   	push   %rbp
+  804f88:	48 89 e5             	mov    %rsp,%rbp
+  804f8b:	53                   	push   %rbx
+  804f8c:	48 83 ec 08          	sub    $0x8,%rsp
+  804f90:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804f93:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  804f9a:	00 00 00 
+  804f9d:	80 38 00             	cmpb   $0x0,(%rax)
+  804fa0:	0f 84 84 00 00 00    	je     80502a <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804fa6:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  804fad:	00 00 00 
+  804fb0:	48 8b 10             	mov    (%rax),%rdx
+  804fb3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804fb8:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  804fbf:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804fc2:	48 85 d2             	test   %rdx,%rdx
+  804fc5:	74 19                	je     804fe0 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804fc7:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804fcb:	0f 84 e8 00 00 00    	je     8050b9 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804fd1:	48 83 c0 01          	add    $0x1,%rax
+  804fd5:	48 39 d0             	cmp    %rdx,%rax
+  804fd8:	75 ed                	jne    804fc7 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804fda:	48 83 fa 08          	cmp    $0x8,%rdx
+  804fde:	74 1c                	je     804ffc <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804fe0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804fe4:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  804feb:	00 00 00 
+  804fee:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  804ff5:	00 00 00 
+  804ff8:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804ffc:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  805003:	00 00 00 
+  805006:	ff d0                	call   *%rax
+  805008:	89 c7                	mov    %eax,%edi
+  80500a:	48 be 7f 51 80 00 00 	movabs $0x80517f,%rsi
+  805011:	00 00 00 
+  805014:	48 b8 54 14 80 00 00 	movabs $0x801454,%rax
+  80501b:	00 00 00 
+  80501e:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805020:	85 c0                	test   %eax,%eax
+  805022:	78 68                	js     80508c <add_pgfault_handler+0x105>
+    return res;
+}
+  805024:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805028:	c9                   	leave
+  805029:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80502a:	48 b8 09 12 80 00 00 	movabs $0x801209,%rax
+  805031:	00 00 00 
+  805034:	ff d0                	call   *%rax
+  805036:	89 c7                	mov    %eax,%edi
+  805038:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80503d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805042:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  805049:	00 00 00 
+  80504c:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  805053:	00 00 00 
+  805056:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805058:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  80505f:	00 00 00 
+  805062:	48 8b 02             	mov    (%rdx),%rax
+  805065:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805069:	48 89 0a             	mov    %rcx,(%rdx)
+  80506c:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  805073:	00 00 00 
+  805076:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80507a:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805081:	00 00 00 
+  805084:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805087:	e9 70 ff ff ff       	jmp    804ffc <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80508c:	89 c1                	mov    %eax,%ecx
+  80508e:	48 ba 76 5c 80 00 00 	movabs $0x805c76,%rdx
+  805095:	00 00 00 
+  805098:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80509d:	48 bf 68 5c 80 00 00 	movabs $0x805c68,%rdi
+  8050a4:	00 00 00 
+  8050a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050ac:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  8050b3:	00 00 00 
+  8050b6:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8050b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050be:	e9 61 ff ff ff       	jmp    805024 <add_pgfault_handler+0x9d>
+
+00000000008050c3 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8050c3:	55                   	push   %rbp
+  8050c4:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8050c7:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8050ce:	00 00 00 
+  8050d1:	80 38 00             	cmpb   $0x0,(%rax)
+  8050d4:	74 33                	je     805109 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8050d6:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  8050dd:	00 00 00 
+  8050e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8050e5:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8050ec:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8050ef:	48 85 c0             	test   %rax,%rax
+  8050f2:	0f 84 85 00 00 00    	je     80517d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8050f8:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8050fc:	74 40                	je     80513e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8050fe:	48 83 c1 01          	add    $0x1,%rcx
+  805102:	48 39 c1             	cmp    %rax,%rcx
+  805105:	75 f1                	jne    8050f8 <remove_pgfault_handler+0x35>
+  805107:	eb 74                	jmp    80517d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805109:	48 b9 8e 5c 80 00 00 	movabs $0x805c8e,%rcx
+  805110:	00 00 00 
+  805113:	48 ba b1 5b 80 00 00 	movabs $0x805bb1,%rdx
+  80511a:	00 00 00 
+  80511d:	be 43 00 00 00       	mov    $0x43,%esi
+  805122:	48 bf 68 5c 80 00 00 	movabs $0x805c68,%rdi
+  805129:	00 00 00 
+  80512c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805131:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  805138:	00 00 00 
+  80513b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80513e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805145:	00 
+  805146:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80514a:	48 29 ca             	sub    %rcx,%rdx
+  80514d:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  805154:	00 00 00 
+  805157:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80515b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805160:	48 89 ce             	mov    %rcx,%rsi
+  805163:	48 b8 31 0f 80 00 00 	movabs $0x800f31,%rax
+  80516a:	00 00 00 
+  80516d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80516f:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805176:	00 00 00 
+  805179:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80517d:	5d                   	pop    %rbp
+  80517e:	c3                   	ret
+
+000000000080517f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80517f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805182:	48 b8 fd 4e 80 00 00 	movabs $0x804efd,%rax
+  805189:	00 00 00 
+    call *%rax
+  80518c:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80518e:	41 5f                	pop    %r15
+	popq %r15
+  805190:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  805192:	41 5f                	pop    %r15
+	popq %r14
+  805194:	41 5e                	pop    %r14
+	popq %r13
+  805196:	41 5d                	pop    %r13
+	popq %r12
+  805198:	41 5c                	pop    %r12
+	popq %r11
+  80519a:	41 5b                	pop    %r11
+	popq %r10
+  80519c:	41 5a                	pop    %r10
+	popq %r9
+  80519e:	41 59                	pop    %r9
+	popq %r8
+  8051a0:	41 58                	pop    %r8
+	popq %rsi
+  8051a2:	5e                   	pop    %rsi
+	popq %rdi
+  8051a3:	5f                   	pop    %rdi
+	popq %rbp
+  8051a4:	5d                   	pop    %rbp
+	popq %rdx
+  8051a5:	5a                   	pop    %rdx
+	popq %rcx
+  8051a6:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8051a7:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8051ac:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8051b1:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8051b5:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8051b8:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8051bd:	5b                   	pop    %rbx
+	popq %rax
+  8051be:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8051bf:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8051c3:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8051c4:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8051c9:	c3                   	ret
+
+00000000008051ca <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8051ca:	55                   	push   %rbp
+  8051cb:	48 89 e5             	mov    %rsp,%rbp
+  8051ce:	41 55                	push   %r13
+  8051d0:	41 54                	push   %r12
+  8051d2:	53                   	push   %rbx
+  8051d3:	48 83 ec 08          	sub    $0x8,%rsp
+  8051d7:	49 89 fd             	mov    %rdi,%r13
+  8051da:	48 89 f7             	mov    %rsi,%rdi
+  8051dd:	48 89 d3             	mov    %rdx,%rbx
+  8051e0:	49 89 cc             	mov    %rcx,%r12
+  8051e3:	4c 89 c2             	mov    %r8,%rdx
+  8051e6:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8051e9:	48 85 f6             	test   %rsi,%rsi
+  8051ec:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8051f3:	00 00 00 
+  8051f6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8051fa:	be 00 10 00 00       	mov    $0x1000,%esi
+  8051ff:	48 85 db             	test   %rbx,%rbx
+  805202:	74 03                	je     805207 <ipc_recv_futex+0x3d>
+  805204:	48 8b 33             	mov    (%rbx),%rsi
+  805207:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80520b:	48 b8 e0 14 80 00 00 	movabs $0x8014e0,%rax
+  805212:	00 00 00 
+  805215:	ff d0                	call   *%rax
+    if (res < 0) {
+  805217:	85 c0                	test   %eax,%eax
+  805219:	78 75                	js     805290 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80521b:	4d 85 ed             	test   %r13,%r13
+  80521e:	74 14                	je     805234 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  805220:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805227:	00 00 00 
+  80522a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805230:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  805234:	4d 85 e4             	test   %r12,%r12
+  805237:	74 14                	je     80524d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  805239:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805240:	00 00 00 
+  805243:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  805249:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80524d:	48 85 db             	test   %rbx,%rbx
+  805250:	74 23                	je     805275 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805252:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  805259:	00 00 00 
+  80525c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  805262:	ba 00 00 00 00       	mov    $0x0,%edx
+  805267:	85 c9                	test   %ecx,%ecx
+  805269:	74 07                	je     805272 <ipc_recv_futex+0xa8>
+  80526b:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  805272:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  805275:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80527c:	00 00 00 
+  80527f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  805285:	48 83 c4 08          	add    $0x8,%rsp
+  805289:	5b                   	pop    %rbx
+  80528a:	41 5c                	pop    %r12
+  80528c:	41 5d                	pop    %r13
+  80528e:	5d                   	pop    %rbp
+  80528f:	c3                   	ret
+        if (from_env_store != NULL) {
+  805290:	4d 85 ed             	test   %r13,%r13
+  805293:	74 08                	je     80529d <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  805295:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80529c:	00 
+        if (perm_store != NULL) {
+  80529d:	4d 85 e4             	test   %r12,%r12
+  8052a0:	74 08                	je     8052aa <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8052a2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8052a9:	00 
+        if (size != NULL) {
+  8052aa:	48 85 db             	test   %rbx,%rbx
+  8052ad:	74 d6                	je     805285 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8052af:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8052b6:	eb cd                	jmp    805285 <ipc_recv_futex+0xbb>
+
+00000000008052b8 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8052b8:	55                   	push   %rbp
+  8052b9:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8052bc:	48 83 ec 08          	sub    $0x8,%rsp
+  8052c0:	6a 00                	push   $0x0
+  8052c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8052c8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8052ce:	48 b8 ca 51 80 00 00 	movabs $0x8051ca,%rax
+  8052d5:	00 00 00 
+  8052d8:	ff d0                	call   *%rax
+}
+  8052da:	c9                   	leave
+  8052db:	c3                   	ret
+
+00000000008052dc <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8052dc:	55                   	push   %rbp
+  8052dd:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8052e0:	48 85 d2             	test   %rdx,%rdx
+  8052e3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8052ea:	00 00 00 
+  8052ed:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8052f1:	89 f6                	mov    %esi,%esi
+  8052f3:	48 b8 c9 14 80 00 00 	movabs $0x8014c9,%rax
+  8052fa:	00 00 00 
+  8052fd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8052ff:	85 c0                	test   %eax,%eax
+  805301:	78 02                	js     805305 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  805303:	5d                   	pop    %rbp
+  805304:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  805305:	89 c1                	mov    %eax,%ecx
+  805307:	48 ba a8 5c 80 00 00 	movabs $0x805ca8,%rdx
+  80530e:	00 00 00 
+  805311:	be 50 00 00 00       	mov    $0x50,%esi
+  805316:	48 bf bc 5c 80 00 00 	movabs $0x805cbc,%rdi
+  80531d:	00 00 00 
+  805320:	b8 00 00 00 00       	mov    $0x0,%eax
+  805325:	49 b8 c2 02 80 00 00 	movabs $0x8002c2,%r8
+  80532c:	00 00 00 
+  80532f:	41 ff d0             	call   *%r8
+
+0000000000805332 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805332:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  805337:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80533e:	00 00 00 
+  805341:	48 89 d0             	mov    %rdx,%rax
+  805344:	48 c1 e0 04          	shl    $0x4,%rax
+  805348:	48 29 d0             	sub    %rdx,%rax
+  80534b:	48 c1 e0 05          	shl    $0x5,%rax
+  80534f:	48 01 c8             	add    %rcx,%rax
+  805352:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805358:	39 f8                	cmp    %edi,%eax
+  80535a:	74 13                	je     80536f <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80535c:	48 83 c2 01          	add    $0x1,%rdx
+  805360:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  805367:	75 d8                	jne    805341 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805369:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80536e:	c3                   	ret
+            return envs[i].env_id;
+  80536f:	48 89 d0             	mov    %rdx,%rax
+  805372:	48 c1 e0 04          	shl    $0x4,%rax
+  805376:	48 29 d0             	sub    %rdx,%rax
+  805379:	48 c1 e0 05          	shl    $0x5,%rax
+  80537d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805384:	00 00 00 
+  805387:	48 01 d0             	add    %rdx,%rax
+  80538a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805390:	c3                   	ret
+  805391:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805398 <__rodata_start>:
+  805398:	69 63 6f 64 65 00 69 	imul   $0x69006564,0x6f(%rbx),%esp
+  80539f:	63 6f 64             	movsxd 0x64(%rdi),%ebp
+  8053a2:	65 20 73 74          	and    %dh,%gs:0x74(%rbx)
+  8053a6:	61                   	(bad)
+  8053a7:	72 74                	jb     80541d <__rodata_start+0x85>
+  8053a9:	75 70                	jne    80541b <__rodata_start+0x83>
+  8053ab:	0a 00                	or     (%rax),%al
+  8053ad:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  8053b4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053b5:	70 65                	jo     80541c <__rodata_start+0x84>
+  8053b7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053b8:	20 2f                	and    %ch,(%rdi)
+  8053ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8053bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053bc:	74 64                	je     805422 <__rodata_start+0x8a>
+  8053be:	0a 00                	or     (%rax),%al
+  8053c0:	2f                   	(bad)
+  8053c1:	6d                   	insl   (%dx),%es:(%rdi)
+  8053c2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053c3:	74 64                	je     805429 <__rodata_start+0x91>
+  8053c5:	00 69 63             	add    %ch,0x63(%rcx)
+  8053c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053c9:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8053cd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053ce:	70 65                	jo     805435 <__rodata_start+0x9d>
+  8053d0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8053d1:	20 2f                	and    %ch,(%rdi)
+  8053d3:	6d                   	insl   (%dx),%es:(%rdi)
+  8053d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053d5:	74 64                	je     80543b <__rodata_start+0xa3>
+  8053d7:	3a 20                	cmp    (%rax),%ah
+  8053d9:	25 69 00 75 73       	and    $0x73750069,%eax
+  8053de:	65 72 2f             	gs jb  805410 <__rodata_start+0x78>
+  8053e1:	69 63 6f 64 65 2e 63 	imul   $0x632e6564,0x6f(%rbx),%esp
+  8053e8:	00 69 63             	add    %ch,0x63(%rcx)
+  8053eb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053ec:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  8053f0:	72 65                	jb     805457 <__rodata_start+0xbf>
+  8053f2:	61                   	(bad)
+  8053f3:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8053f6:	6d                   	insl   (%dx),%es:(%rdi)
+  8053f7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8053f8:	74 64                	je     80545e <__rodata_start+0xc6>
+  8053fa:	0a 00                	or     (%rax),%al
+  8053fc:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  805403:	63 6c 6f 73          	movsxd 0x73(%rdi,%rbp,2),%ebp
+  805407:	65 20 2f             	and    %ch,%gs:(%rdi)
+  80540a:	6d                   	insl   (%dx),%es:(%rdi)
+  80540b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80540c:	74 64                	je     805472 <__rodata_start+0xda>
+  80540e:	0a 00                	or     (%rax),%al
+  805410:	69 63 6f 64 65 3a 20 	imul   $0x203a6564,0x6f(%rbx),%esp
+  805417:	73 70                	jae    805489 <__rodata_start+0xf1>
+  805419:	61                   	(bad)
+  80541a:	77 6e                	ja     80548a <__rodata_start+0xf2>
+  80541c:	20 2f                	and    %ch,(%rdi)
+  80541e:	69 6e 69 74 0a 00 69 	imul   $0x69000a74,0x69(%rsi),%ebp
+  805425:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805426:	69 74 61 72 67 32 00 	imul   $0x69003267,0x72(%rcx,%riz,2),%esi
+  80542d:	69 
+  80542e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80542f:	69 74 61 72 67 31 00 	imul   $0x2f003167,0x72(%rcx,%riz,2),%esi
+  805436:	2f 
+  805437:	69 6e 69 74 00 69 63 	imul   $0x63690074,0x69(%rsi),%ebp
+  80543e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80543f:	64 65 3a 20          	fs cmp %gs:(%rax),%ah
+  805443:	73 70                	jae    8054b5 <__rodata_start+0x11d>
+  805445:	61                   	(bad)
+  805446:	77 6e                	ja     8054b6 <__rodata_start+0x11e>
+  805448:	20 2f                	and    %ch,(%rdi)
+  80544a:	69 6e 69 74 3a 20 25 	imul   $0x25203a74,0x69(%rsi),%ebp
+  805451:	69 00 69 63 6f 64    	imul   $0x646f6369,(%rax),%eax
+  805457:	65 3a 20             	cmp    %gs:(%rax),%ah
+  80545a:	65 78 69             	gs js  8054c6 <__rodata_start+0x12e>
+  80545d:	74 69                	je     8054c8 <__rodata_start+0x130>
+  80545f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805460:	67 0a 00             	or     (%eax),%al
+  805463:	3c 75                	cmp    $0x75,%al
+  805465:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805466:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80546a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80546b:	3e 00 0f             	ds add %cl,(%rdi)
+  80546e:	1f                   	(bad)
+  80546f:	00 5b 25             	add    %bl,0x25(%rbx)
+  805472:	30 38                	xor    %bh,(%rax)
+  805474:	78 5d                	js     8054d3 <__rodata_start+0x13b>
+  805476:	20 75 73             	and    %dh,0x73(%rbp)
+  805479:	65 72 20             	gs jb  80549c <__rodata_start+0x104>
+  80547c:	70 61                	jo     8054df <__rodata_start+0x147>
+  80547e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80547f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805486:	73 20                	jae    8054a8 <__rodata_start+0x110>
+  805488:	61                   	(bad)
+  805489:	74 20                	je     8054ab <__rodata_start+0x113>
+  80548b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805490:	3a 20                	cmp    (%rax),%ah
+  805492:	00 30                	add    %dh,(%rax)
+  805494:	31 32                	xor    %esi,(%rdx)
+  805496:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80549d:	41                   	rex.B
+  80549e:	42                   	rex.X
+  80549f:	43                   	rex.XB
+  8054a0:	44                   	rex.R
+  8054a1:	45                   	rex.RB
+  8054a2:	46 00 30             	rex.RX add %r14b,(%rax)
+  8054a5:	31 32                	xor    %esi,(%rdx)
+  8054a7:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8054ae:	61                   	(bad)
+  8054af:	62 63 64 65 66       	(bad)
+  8054b4:	00 28                	add    %ch,(%rax)
+  8054b6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054b7:	75 6c                	jne    805525 <__rodata_start+0x18d>
+  8054b9:	6c                   	insb   (%dx),%es:(%rdi)
+  8054ba:	29 00                	sub    %eax,(%rax)
+  8054bc:	65 72 72             	gs jb  805531 <__rodata_start+0x199>
+  8054bf:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054c0:	72 20                	jb     8054e2 <__rodata_start+0x14a>
+  8054c2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8054c7:	73 70                	jae    805539 <__rodata_start+0x1a1>
+  8054c9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8054cd:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8054d4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054d5:	72 00                	jb     8054d7 <__rodata_start+0x13f>
+  8054d7:	62 61 64 20 65       	(bad)
+  8054dc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054dd:	76 69                	jbe    805548 <__rodata_start+0x1b0>
+  8054df:	72 6f                	jb     805550 <__rodata_start+0x1b8>
+  8054e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8054e2:	6d                   	insl   (%dx),%es:(%rdi)
+  8054e3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8054e5:	74 00                	je     8054e7 <__rodata_start+0x14f>
+  8054e7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8054ee:	20 70 61             	and    %dh,0x61(%rax)
+  8054f1:	72 61                	jb     805554 <__rodata_start+0x1bc>
+  8054f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8054f4:	65 74 65             	gs je  80555c <__rodata_start+0x1c4>
+  8054f7:	72 00                	jb     8054f9 <__rodata_start+0x161>
+  8054f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8054fa:	75 74                	jne    805570 <__rodata_start+0x1d8>
+  8054fc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8054ff:	20 6d 65             	and    %ch,0x65(%rbp)
+  805502:	6d                   	insl   (%dx),%es:(%rdi)
+  805503:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805504:	72 79                	jb     80557f <__rodata_start+0x1e7>
+  805506:	00 6f 75             	add    %ch,0x75(%rdi)
+  805509:	74 20                	je     80552b <__rodata_start+0x193>
+  80550b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80550c:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805510:	76 69                	jbe    80557b <__rodata_start+0x1e3>
+  805512:	72 6f                	jb     805583 <__rodata_start+0x1eb>
+  805514:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805515:	6d                   	insl   (%dx),%es:(%rdi)
+  805516:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805518:	74 73                	je     80558d <__rodata_start+0x1f5>
+  80551a:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80551d:	72 72                	jb     805591 <__rodata_start+0x1f9>
+  80551f:	75 70                	jne    805591 <__rodata_start+0x1f9>
+  805521:	74 65                	je     805588 <__rodata_start+0x1f0>
+  805523:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805528:	75 67                	jne    805591 <__rodata_start+0x1f9>
+  80552a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80552d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80552f:	00 73 65             	add    %dh,0x65(%rbx)
+  805532:	67 6d                	insl   (%dx),%es:(%edi)
+  805534:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805536:	74 61                	je     805599 <__rodata_start+0x201>
+  805538:	74 69                	je     8055a3 <__rodata_start+0x20b>
+  80553a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80553b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80553c:	20 66 61             	and    %ah,0x61(%rsi)
+  80553f:	75 6c                	jne    8055ad <__rodata_start+0x215>
+  805541:	74 00                	je     805543 <__rodata_start+0x1ab>
+  805543:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80554a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80554d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805551:	61                   	(bad)
+  805552:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805557:	20 73 75             	and    %dh,0x75(%rbx)
+  80555a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80555d:	73 79                	jae    8055d8 <__rodata_start+0x240>
+  80555f:	73 74                	jae    8055d5 <__rodata_start+0x23d>
+  805561:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805563:	20 63 61             	and    %ah,0x61(%rbx)
+  805566:	6c                   	insb   (%dx),%es:(%rdi)
+  805567:	6c                   	insb   (%dx),%es:(%rdi)
+  805568:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80556b:	74 72                	je     8055df <__rodata_start+0x247>
+  80556d:	79 20                	jns    80558f <__rodata_start+0x1f7>
+  80556f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805570:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805571:	74 20                	je     805593 <__rodata_start+0x1fb>
+  805573:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805575:	75 6e                	jne    8055e5 <__rodata_start+0x24d>
+  805577:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80557b:	76 20                	jbe    80559d <__rodata_start+0x205>
+  80557d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805584:	72 65                	jb     8055eb <__rodata_start+0x253>
+  805586:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805589:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80558a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80558e:	65 78 70             	gs js  805601 <__rodata_start+0x269>
+  805591:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805596:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805599:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80559d:	20 66 69             	and    %ah,0x69(%rsi)
+  8055a0:	6c                   	insb   (%dx),%es:(%rdi)
+  8055a1:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8055a5:	20 66 72             	and    %ah,0x72(%rsi)
+  8055a8:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  8055ad:	61                   	(bad)
+  8055ae:	63 65 20             	movsxd 0x20(%rbp),%esp
+  8055b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055b2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055b3:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  8055b7:	6b 00 74             	imul   $0x74,(%rax),%eax
+  8055ba:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055bc:	20 6d 61             	and    %ch,0x61(%rbp)
+  8055bf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055c0:	79 20                	jns    8055e2 <__rodata_start+0x24a>
+  8055c2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  8055c9:	72 65                	jb     805630 <__rodata_start+0x298>
+  8055cb:	20 6f 70             	and    %ch,0x70(%rdi)
+  8055ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8055d0:	00 66 69             	add    %ah,0x69(%rsi)
+  8055d3:	6c                   	insb   (%dx),%es:(%rdi)
+  8055d4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  8055d8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  8055db:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055dc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  8055df:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8055e1:	74 20                	je     805603 <__rodata_start+0x26b>
+  8055e3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8055e5:	75 6e                	jne    805655 <__rodata_start+0x2bd>
+  8055e7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8055eb:	76 61                	jbe    80564e <__rodata_start+0x2b6>
+  8055ed:	6c                   	insb   (%dx),%es:(%rdi)
+  8055ee:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8055f5:	00 
+  8055f6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8055fd:	72 65                	jb     805664 <__rodata_start+0x2cc>
+  8055ff:	61                   	(bad)
+  805600:	64 79 20             	fs jns 805623 <__rodata_start+0x28b>
+  805603:	65 78 69             	gs js  80566f <__rodata_start+0x2d7>
+  805606:	73 74                	jae    80567c <__rodata_start+0x2e4>
+  805608:	73 00                	jae    80560a <__rodata_start+0x272>
+  80560a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80560b:	70 65                	jo     805672 <__rodata_start+0x2da>
+  80560d:	72 61                	jb     805670 <__rodata_start+0x2d8>
+  80560f:	74 69                	je     80567a <__rodata_start+0x2e2>
+  805611:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805612:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805613:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805616:	74 20                	je     805638 <__rodata_start+0x2a0>
+  805618:	73 75                	jae    80568f <__rodata_start+0x2f7>
+  80561a:	70 70                	jo     80568c <__rodata_start+0x2f4>
+  80561c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80561d:	72 74                	jb     805693 <__rodata_start+0x2fb>
+  80561f:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805625:	20 61 67             	and    %ah,0x67(%rcx)
+  805628:	61                   	(bad)
+  805629:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805630:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805634:	74 00                	je     805636 <__rodata_start+0x29e>
+  805636:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  80563d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805640:	20 75 73             	and    %dh,0x73(%rbp)
+  805643:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805647:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80564e:	00 
+  80564f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805656:	00 00 00 
+  805659:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805660:	ff 05 80 00 00 00    	incl   0x80(%rip)        # 8056e6 <__rodata_start+0x34e>
+  805666:	00 00                	add    %al,(%rax)
+  805668:	40 0c 80             	rex or $0x80,%al
+  80566b:	00 00                	add    %al,(%rax)
+  80566d:	00 00                	add    %al,(%rax)
+  80566f:	00 30                	add    %dh,(%rax)
+  805671:	0c 80                	or     $0x80,%al
+  805673:	00 00                	add    %al,(%rax)
+  805675:	00 00                	add    %al,(%rax)
+  805677:	00 40 0c             	add    %al,0xc(%rax)
+  80567a:	80 00 00             	addb   $0x0,(%rax)
+  80567d:	00 00                	add    %al,(%rax)
+  80567f:	00 40 0c             	add    %al,0xc(%rax)
+  805682:	80 00 00             	addb   $0x0,(%rax)
+  805685:	00 00                	add    %al,(%rax)
+  805687:	00 40 0c             	add    %al,0xc(%rax)
+  80568a:	80 00 00             	addb   $0x0,(%rax)
+  80568d:	00 00                	add    %al,(%rax)
+  80568f:	00 40 0c             	add    %al,0xc(%rax)
+  805692:	80 00 00             	addb   $0x0,(%rax)
+  805695:	00 00                	add    %al,(%rax)
+  805697:	00 1e                	add    %bl,(%rsi)
+  805699:	06                   	(bad)
+  80569a:	80 00 00             	addb   $0x0,(%rax)
+  80569d:	00 00                	add    %al,(%rax)
+  80569f:	00 40 0c             	add    %al,0xc(%rax)
+  8056a2:	80 00 00             	addb   $0x0,(%rax)
+  8056a5:	00 00                	add    %al,(%rax)
+  8056a7:	00 40 0c             	add    %al,0xc(%rax)
+  8056aa:	80 00 00             	addb   $0x0,(%rax)
+  8056ad:	00 00                	add    %al,(%rax)
+  8056af:	00 12                	add    %dl,(%rdx)
+  8056b1:	06                   	(bad)
+  8056b2:	80 00 00             	addb   $0x0,(%rax)
+  8056b5:	00 00                	add    %al,(%rax)
+  8056b7:	00 8c 06 80 00 00 00 	add    %cl,0x80(%rsi,%rax,1)
+  8056be:	00 00                	add    %al,(%rax)
+  8056c0:	40 0c 80             	rex or $0x80,%al
+  8056c3:	00 00                	add    %al,(%rax)
+  8056c5:	00 00                	add    %al,(%rax)
+  8056c7:	00 12                	add    %dl,(%rdx)
+  8056c9:	06                   	(bad)
+  8056ca:	80 00 00             	addb   $0x0,(%rax)
+  8056cd:	00 00                	add    %al,(%rax)
+  8056cf:	00 58 06             	add    %bl,0x6(%rax)
+  8056d2:	80 00 00             	addb   $0x0,(%rax)
+  8056d5:	00 00                	add    %al,(%rax)
+  8056d7:	00 58 06             	add    %bl,0x6(%rax)
+  8056da:	80 00 00             	addb   $0x0,(%rax)
+  8056dd:	00 00                	add    %al,(%rax)
+  8056df:	00 58 06             	add    %bl,0x6(%rax)
+  8056e2:	80 00 00             	addb   $0x0,(%rax)
+  8056e5:	00 00                	add    %al,(%rax)
+  8056e7:	00 58 06             	add    %bl,0x6(%rax)
+  8056ea:	80 00 00             	addb   $0x0,(%rax)
+  8056ed:	00 00                	add    %al,(%rax)
+  8056ef:	00 58 06             	add    %bl,0x6(%rax)
+  8056f2:	80 00 00             	addb   $0x0,(%rax)
+  8056f5:	00 00                	add    %al,(%rax)
+  8056f7:	00 58 06             	add    %bl,0x6(%rax)
+  8056fa:	80 00 00             	addb   $0x0,(%rax)
+  8056fd:	00 00                	add    %al,(%rax)
+  8056ff:	00 58 06             	add    %bl,0x6(%rax)
+  805702:	80 00 00             	addb   $0x0,(%rax)
+  805705:	00 00                	add    %al,(%rax)
+  805707:	00 58 06             	add    %bl,0x6(%rax)
+  80570a:	80 00 00             	addb   $0x0,(%rax)
+  80570d:	00 00                	add    %al,(%rax)
+  80570f:	00 58 06             	add    %bl,0x6(%rax)
+  805712:	80 00 00             	addb   $0x0,(%rax)
+  805715:	00 00                	add    %al,(%rax)
+  805717:	00 40 0c             	add    %al,0xc(%rax)
+  80571a:	80 00 00             	addb   $0x0,(%rax)
+  80571d:	00 00                	add    %al,(%rax)
+  80571f:	00 40 0c             	add    %al,0xc(%rax)
+  805722:	80 00 00             	addb   $0x0,(%rax)
+  805725:	00 00                	add    %al,(%rax)
+  805727:	00 40 0c             	add    %al,0xc(%rax)
+  80572a:	80 00 00             	addb   $0x0,(%rax)
+  80572d:	00 00                	add    %al,(%rax)
+  80572f:	00 40 0c             	add    %al,0xc(%rax)
+  805732:	80 00 00             	addb   $0x0,(%rax)
+  805735:	00 00                	add    %al,(%rax)
+  805737:	00 40 0c             	add    %al,0xc(%rax)
+  80573a:	80 00 00             	addb   $0x0,(%rax)
+  80573d:	00 00                	add    %al,(%rax)
+  80573f:	00 40 0c             	add    %al,0xc(%rax)
+  805742:	80 00 00             	addb   $0x0,(%rax)
+  805745:	00 00                	add    %al,(%rax)
+  805747:	00 40 0c             	add    %al,0xc(%rax)
+  80574a:	80 00 00             	addb   $0x0,(%rax)
+  80574d:	00 00                	add    %al,(%rax)
+  80574f:	00 40 0c             	add    %al,0xc(%rax)
+  805752:	80 00 00             	addb   $0x0,(%rax)
+  805755:	00 00                	add    %al,(%rax)
+  805757:	00 40 0c             	add    %al,0xc(%rax)
+  80575a:	80 00 00             	addb   $0x0,(%rax)
+  80575d:	00 00                	add    %al,(%rax)
+  80575f:	00 40 0c             	add    %al,0xc(%rax)
+  805762:	80 00 00             	addb   $0x0,(%rax)
+  805765:	00 00                	add    %al,(%rax)
+  805767:	00 40 0c             	add    %al,0xc(%rax)
+  80576a:	80 00 00             	addb   $0x0,(%rax)
+  80576d:	00 00                	add    %al,(%rax)
+  80576f:	00 40 0c             	add    %al,0xc(%rax)
+  805772:	80 00 00             	addb   $0x0,(%rax)
+  805775:	00 00                	add    %al,(%rax)
+  805777:	00 40 0c             	add    %al,0xc(%rax)
+  80577a:	80 00 00             	addb   $0x0,(%rax)
+  80577d:	00 00                	add    %al,(%rax)
+  80577f:	00 40 0c             	add    %al,0xc(%rax)
+  805782:	80 00 00             	addb   $0x0,(%rax)
+  805785:	00 00                	add    %al,(%rax)
+  805787:	00 40 0c             	add    %al,0xc(%rax)
+  80578a:	80 00 00             	addb   $0x0,(%rax)
+  80578d:	00 00                	add    %al,(%rax)
+  80578f:	00 40 0c             	add    %al,0xc(%rax)
+  805792:	80 00 00             	addb   $0x0,(%rax)
+  805795:	00 00                	add    %al,(%rax)
+  805797:	00 40 0c             	add    %al,0xc(%rax)
+  80579a:	80 00 00             	addb   $0x0,(%rax)
+  80579d:	00 00                	add    %al,(%rax)
+  80579f:	00 40 0c             	add    %al,0xc(%rax)
+  8057a2:	80 00 00             	addb   $0x0,(%rax)
+  8057a5:	00 00                	add    %al,(%rax)
+  8057a7:	00 40 0c             	add    %al,0xc(%rax)
+  8057aa:	80 00 00             	addb   $0x0,(%rax)
+  8057ad:	00 00                	add    %al,(%rax)
+  8057af:	00 40 0c             	add    %al,0xc(%rax)
+  8057b2:	80 00 00             	addb   $0x0,(%rax)
+  8057b5:	00 00                	add    %al,(%rax)
+  8057b7:	00 40 0c             	add    %al,0xc(%rax)
+  8057ba:	80 00 00             	addb   $0x0,(%rax)
+  8057bd:	00 00                	add    %al,(%rax)
+  8057bf:	00 40 0c             	add    %al,0xc(%rax)
+  8057c2:	80 00 00             	addb   $0x0,(%rax)
+  8057c5:	00 00                	add    %al,(%rax)
+  8057c7:	00 40 0c             	add    %al,0xc(%rax)
+  8057ca:	80 00 00             	addb   $0x0,(%rax)
+  8057cd:	00 00                	add    %al,(%rax)
+  8057cf:	00 40 0c             	add    %al,0xc(%rax)
+  8057d2:	80 00 00             	addb   $0x0,(%rax)
+  8057d5:	00 00                	add    %al,(%rax)
+  8057d7:	00 40 0c             	add    %al,0xc(%rax)
+  8057da:	80 00 00             	addb   $0x0,(%rax)
+  8057dd:	00 00                	add    %al,(%rax)
+  8057df:	00 40 0c             	add    %al,0xc(%rax)
+  8057e2:	80 00 00             	addb   $0x0,(%rax)
+  8057e5:	00 00                	add    %al,(%rax)
+  8057e7:	00 40 0c             	add    %al,0xc(%rax)
+  8057ea:	80 00 00             	addb   $0x0,(%rax)
+  8057ed:	00 00                	add    %al,(%rax)
+  8057ef:	00 40 0c             	add    %al,0xc(%rax)
+  8057f2:	80 00 00             	addb   $0x0,(%rax)
+  8057f5:	00 00                	add    %al,(%rax)
+  8057f7:	00 40 0c             	add    %al,0xc(%rax)
+  8057fa:	80 00 00             	addb   $0x0,(%rax)
+  8057fd:	00 00                	add    %al,(%rax)
+  8057ff:	00 40 0c             	add    %al,0xc(%rax)
+  805802:	80 00 00             	addb   $0x0,(%rax)
+  805805:	00 00                	add    %al,(%rax)
+  805807:	00 63 0b             	add    %ah,0xb(%rbx)
+  80580a:	80 00 00             	addb   $0x0,(%rax)
+  80580d:	00 00                	add    %al,(%rax)
+  80580f:	00 40 0c             	add    %al,0xc(%rax)
+  805812:	80 00 00             	addb   $0x0,(%rax)
+  805815:	00 00                	add    %al,(%rax)
+  805817:	00 40 0c             	add    %al,0xc(%rax)
+  80581a:	80 00 00             	addb   $0x0,(%rax)
+  80581d:	00 00                	add    %al,(%rax)
+  80581f:	00 40 0c             	add    %al,0xc(%rax)
+  805822:	80 00 00             	addb   $0x0,(%rax)
+  805825:	00 00                	add    %al,(%rax)
+  805827:	00 40 0c             	add    %al,0xc(%rax)
+  80582a:	80 00 00             	addb   $0x0,(%rax)
+  80582d:	00 00                	add    %al,(%rax)
+  80582f:	00 40 0c             	add    %al,0xc(%rax)
+  805832:	80 00 00             	addb   $0x0,(%rax)
+  805835:	00 00                	add    %al,(%rax)
+  805837:	00 40 0c             	add    %al,0xc(%rax)
+  80583a:	80 00 00             	addb   $0x0,(%rax)
+  80583d:	00 00                	add    %al,(%rax)
+  80583f:	00 40 0c             	add    %al,0xc(%rax)
+  805842:	80 00 00             	addb   $0x0,(%rax)
+  805845:	00 00                	add    %al,(%rax)
+  805847:	00 40 0c             	add    %al,0xc(%rax)
+  80584a:	80 00 00             	addb   $0x0,(%rax)
+  80584d:	00 00                	add    %al,(%rax)
+  80584f:	00 40 0c             	add    %al,0xc(%rax)
+  805852:	80 00 00             	addb   $0x0,(%rax)
+  805855:	00 00                	add    %al,(%rax)
+  805857:	00 40 0c             	add    %al,0xc(%rax)
+  80585a:	80 00 00             	addb   $0x0,(%rax)
+  80585d:	00 00                	add    %al,(%rax)
+  80585f:	00 af 06 80 00 00    	add    %ch,0x8006(%rdi)
+  805865:	00 00                	add    %al,(%rax)
+  805867:	00 7e 08             	add    %bh,0x8(%rsi)
+  80586a:	80 00 00             	addb   $0x0,(%rax)
+  80586d:	00 00                	add    %al,(%rax)
+  80586f:	00 40 0c             	add    %al,0xc(%rax)
+  805872:	80 00 00             	addb   $0x0,(%rax)
+  805875:	00 00                	add    %al,(%rax)
+  805877:	00 40 0c             	add    %al,0xc(%rax)
+  80587a:	80 00 00             	addb   $0x0,(%rax)
+  80587d:	00 00                	add    %al,(%rax)
+  80587f:	00 40 0c             	add    %al,0xc(%rax)
+  805882:	80 00 00             	addb   $0x0,(%rax)
+  805885:	00 00                	add    %al,(%rax)
+  805887:	00 40 0c             	add    %al,0xc(%rax)
+  80588a:	80 00 00             	addb   $0x0,(%rax)
+  80588d:	00 00                	add    %al,(%rax)
+  80588f:	00 de                	add    %bl,%dh
+  805891:	06                   	(bad)
+  805892:	80 00 00             	addb   $0x0,(%rax)
+  805895:	00 00                	add    %al,(%rax)
+  805897:	00 40 0c             	add    %al,0xc(%rax)
+  80589a:	80 00 00             	addb   $0x0,(%rax)
+  80589d:	00 00                	add    %al,(%rax)
+  80589f:	00 40 0c             	add    %al,0xc(%rax)
+  8058a2:	80 00 00             	addb   $0x0,(%rax)
+  8058a5:	00 00                	add    %al,(%rax)
+  8058a7:	00 a4 06 80 00 00 00 	add    %ah,0x80(%rsi,%rax,1)
+  8058ae:	00 00                	add    %al,(%rax)
+  8058b0:	40 0c 80             	rex or $0x80,%al
+  8058b3:	00 00                	add    %al,(%rax)
+  8058b5:	00 00                	add    %al,(%rax)
+  8058b7:	00 40 0c             	add    %al,0xc(%rax)
+  8058ba:	80 00 00             	addb   $0x0,(%rax)
+  8058bd:	00 00                	add    %al,(%rax)
+  8058bf:	00 26                	add    %ah,(%rsi)
+  8058c1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8058c7:	00 f0                	add    %dh,%al
+  8058c9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  8058cf:	00 40 0c             	add    %al,0xc(%rax)
+  8058d2:	80 00 00             	addb   $0x0,(%rax)
+  8058d5:	00 00                	add    %al,(%rax)
+  8058d7:	00 40 0c             	add    %al,0xc(%rax)
+  8058da:	80 00 00             	addb   $0x0,(%rax)
+  8058dd:	00 00                	add    %al,(%rax)
+  8058df:	00 75 07             	add    %dh,0x7(%rbp)
+  8058e2:	80 00 00             	addb   $0x0,(%rax)
+  8058e5:	00 00                	add    %al,(%rax)
+  8058e7:	00 40 0c             	add    %al,0xc(%rax)
+  8058ea:	80 00 00             	addb   $0x0,(%rax)
+  8058ed:	00 00                	add    %al,(%rax)
+  8058ef:	00 52 09             	add    %dl,0x9(%rdx)
+  8058f2:	80 00 00             	addb   $0x0,(%rax)
+  8058f5:	00 00                	add    %al,(%rax)
+  8058f7:	00 40 0c             	add    %al,0xc(%rax)
+  8058fa:	80 00 00             	addb   $0x0,(%rax)
+  8058fd:	00 00                	add    %al,(%rax)
+  8058ff:	00 40 0c             	add    %al,0xc(%rax)
+  805902:	80 00 00             	addb   $0x0,(%rax)
+  805905:	00 00                	add    %al,(%rax)
+  805907:	00 63 0b             	add    %ah,0xb(%rbx)
+  80590a:	80 00 00             	addb   $0x0,(%rax)
+  80590d:	00 00                	add    %al,(%rax)
+  80590f:	00 40 0c             	add    %al,0xc(%rax)
+  805912:	80 00 00             	addb   $0x0,(%rax)
+  805915:	00 00                	add    %al,(%rax)
+  805917:	00 08                	add    %cl,(%rax)
+  805919:	06                   	(bad)
+  80591a:	80 00 00             	addb   $0x0,(%rax)
+  80591d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805920 <error_string>:
+	...
+  805928:	c5 54 80 00 00 00 00 00 d7 54 80 00 00 00 00 00     .T.......T......
+  805938:	e7 54 80 00 00 00 00 00 f9 54 80 00 00 00 00 00     .T.......T......
+  805948:	07 55 80 00 00 00 00 00 1b 55 80 00 00 00 00 00     .U.......U......
+  805958:	30 55 80 00 00 00 00 00 43 55 80 00 00 00 00 00     0U......CU......
+  805968:	55 55 80 00 00 00 00 00 69 55 80 00 00 00 00 00     UU......iU......
+  805978:	79 55 80 00 00 00 00 00 8c 55 80 00 00 00 00 00     yU.......U......
+  805988:	a3 55 80 00 00 00 00 00 b9 55 80 00 00 00 00 00     .U.......U......
+  805998:	d1 55 80 00 00 00 00 00 e9 55 80 00 00 00 00 00     .U.......U......
+  8059a8:	f6 55 80 00 00 00 00 00 d8 59 80 00 00 00 00 00     .U.......Y......
+  8059b8:	0a 56 80 00 00 00 00 00 22 56 80 00 00 00 00 00     .V......"V......
+  8059c8:	2c 56 80 00 00 00 00 00 36 56 80 00 00 00 00 00     ,V......6V......
+  8059d8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8059e8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8059f8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805a08:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805a18:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805a28:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805a38:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805a48:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805a58:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805a68:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805a78:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805a88:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805a98:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805aa8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab8:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805ac0 <devtab>:
+  805ac0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805ad0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805ae0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805af0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805b00:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805b10:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805b20:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805b30:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805b40:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805b50:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805b60:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805b70:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  805b80:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  805b90:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  805ba0:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  805bb0:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  805bc0:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  805bd0:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805be0:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805bf0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805c00:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805c10:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805c20:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  805c30:	73 3e 00 63 6f 6e 73 00 55 73 65 72 73 70 61 63     s>.cons.Userspac
+  805c40:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805c50:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805c60:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805c70:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805c80:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805c90:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805ca0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805cb0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805cc0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,7887 @@
+
+obj/user/idle:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 2d 00 00 00       	call   800050 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+
+#include <inc/x86.h>
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	53                   	push   %rbx
+  80002a:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "idle";
+  80002e:	48 b8 b0 46 80 00 00 	movabs $0x8046b0,%rax
+  800035:	00 00 00 
+  800038:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  80003f:	00 00 00 
+     * Instead of busy-waiting like this,
+     * a better way would be to use the processor's HLT instruction
+     * to cause the processor to stop executing until the next interrupt -
+     * doing so allows the processor to conserve power more effectively. */
+    while (1) {
+        sys_yield();
+  800042:	48 bb fa 01 80 00 00 	movabs $0x8001fa,%rbx
+  800049:	00 00 00 
+  80004c:	ff d3                	call   *%rbx
+    while (1) {
+  80004e:	eb fc                	jmp    80004c <umain+0x27>
+
+0000000000800050 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800050:	55                   	push   %rbp
+  800051:	48 89 e5             	mov    %rsp,%rbp
+  800054:	41 56                	push   %r14
+  800056:	41 55                	push   %r13
+  800058:	41 54                	push   %r12
+  80005a:	53                   	push   %rbx
+  80005b:	41 89 fd             	mov    %edi,%r13d
+  80005e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800061:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800068:	00 00 00 
+  80006b:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  800072:	00 00 00 
+  800075:	48 39 c2             	cmp    %rax,%rdx
+  800078:	73 17                	jae    800091 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80007a:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80007d:	49 89 c4             	mov    %rax,%r12
+  800080:	48 83 c3 08          	add    $0x8,%rbx
+  800084:	b8 00 00 00 00       	mov    $0x0,%eax
+  800089:	ff 53 f8             	call   *-0x8(%rbx)
+  80008c:	4c 39 e3             	cmp    %r12,%rbx
+  80008f:	72 ef                	jb     800080 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800091:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  800098:	00 00 00 
+  80009b:	ff d0                	call   *%rax
+  80009d:	89 c2                	mov    %eax,%edx
+  80009f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8000a5:	48 89 d0             	mov    %rdx,%rax
+  8000a8:	48 c1 e0 04          	shl    $0x4,%rax
+  8000ac:	48 29 d0             	sub    %rdx,%rax
+  8000af:	48 c1 e0 05          	shl    $0x5,%rax
+  8000b3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8000ba:	00 00 00 
+  8000bd:	48 01 d0             	add    %rdx,%rax
+  8000c0:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8000c7:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000ca:	45 85 ed             	test   %r13d,%r13d
+  8000cd:	7e 0d                	jle    8000dc <libmain+0x8c>
+  8000cf:	49 8b 06             	mov    (%r14),%rax
+  8000d2:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000d9:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000dc:	4c 89 f6             	mov    %r14,%rsi
+  8000df:	44 89 ef             	mov    %r13d,%edi
+  8000e2:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000ee:	48 b8 03 01 80 00 00 	movabs $0x800103,%rax
+  8000f5:	00 00 00 
+  8000f8:	ff d0                	call   *%rax
+#endif
+}
+  8000fa:	5b                   	pop    %rbx
+  8000fb:	41 5c                	pop    %r12
+  8000fd:	41 5d                	pop    %r13
+  8000ff:	41 5e                	pop    %r14
+  800101:	5d                   	pop    %rbp
+  800102:	c3                   	ret
+
+0000000000800103 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800103:	55                   	push   %rbp
+  800104:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800107:	48 b8 b7 08 80 00 00 	movabs $0x8008b7,%rax
+  80010e:	00 00 00 
+  800111:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800113:	bf 00 00 00 00       	mov    $0x0,%edi
+  800118:	48 b8 6e 01 80 00 00 	movabs $0x80016e,%rax
+  80011f:	00 00 00 
+  800122:	ff d0                	call   *%rax
+}
+  800124:	5d                   	pop    %rbp
+  800125:	c3                   	ret
+
+0000000000800126 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  800126:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  800142:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  800144:	c3                   	ret
+
+0000000000800145 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  800145:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80014a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80014f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800154:	ba 00 00 00 00       	mov    $0x0,%edx
+  800159:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80015f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800165:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80016b:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80016d:	c3                   	ret
+
+000000000080016e <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80016e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800171:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800176:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80017b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800180:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800186:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80018c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800192:	0f 05                	syscall
+    if (check && ret > 0) {
+  800194:	48 85 c0             	test   %rax,%rax
+  800197:	7f 01                	jg     80019a <sys_env_destroy+0x2c>
+}
+  800199:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80019a:	55                   	push   %rbp
+  80019b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80019e:	49 89 c0             	mov    %rax,%r8
+  8001a1:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8001a6:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8001ad:	00 00 00 
+  8001b0:	be 29 00 00 00       	mov    $0x29,%esi
+  8001b5:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8001bc:	00 00 00 
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  8001cb:	00 00 00 
+  8001ce:	41 ff d1             	call   *%r9
+
+00000000008001d1 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001d1:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001db:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001f7:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001f9:	c3                   	ret
+
+00000000008001fa <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001fa:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800204:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800209:	ba 00 00 00 00       	mov    $0x0,%edx
+  80020e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800214:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80021a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800220:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  800222:	c3                   	ret
+
+0000000000800223 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  800223:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800228:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80022f:	00 00 00 
+  800232:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800238:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80023e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800244:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  800246:	c3                   	ret
+
+0000000000800247 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  800247:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80024a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80024f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800255:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80025b:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80025d:	c3                   	ret
+
+000000000080025e <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80025e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800261:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800266:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800269:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80026f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800275:	0f 05                	syscall
+    if (check && ret > 0) {
+  800277:	48 85 c0             	test   %rax,%rax
+  80027a:	7f 01                	jg     80027d <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80027c:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80027d:	55                   	push   %rbp
+  80027e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800281:	49 89 c0             	mov    %rax,%r8
+  800284:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800289:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800290:	00 00 00 
+  800293:	be 29 00 00 00       	mov    $0x29,%esi
+  800298:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  8002ae:	00 00 00 
+  8002b1:	41 ff d1             	call   *%r9
+
+00000000008002b4 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002b4:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8002b7:	48 63 d2             	movslq %edx,%rdx
+  8002ba:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002bd:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002c2:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8002c5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002c7:	48 85 c0             	test   %rax,%rax
+  8002ca:	7f 01                	jg     8002cd <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002cc:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002cd:	55                   	push   %rbp
+  8002ce:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002d1:	49 89 c0             	mov    %rax,%r8
+  8002d4:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002d9:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8002e0:	00 00 00 
+  8002e3:	be 29 00 00 00       	mov    $0x29,%esi
+  8002e8:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8002ef:	00 00 00 
+  8002f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002f7:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  8002fe:	00 00 00 
+  800301:	41 ff d1             	call   *%r9
+
+0000000000800304 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  800304:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800307:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80030c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800312:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800318:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80031e:	0f 05                	syscall
+    if (check && ret > 0) {
+  800320:	48 85 c0             	test   %rax,%rax
+  800323:	7f 01                	jg     800326 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  800325:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  800326:	55                   	push   %rbp
+  800327:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80032a:	49 89 c0             	mov    %rax,%r8
+  80032d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800332:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800339:	00 00 00 
+  80033c:	be 29 00 00 00       	mov    $0x29,%esi
+  800341:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800348:	00 00 00 
+  80034b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800350:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  800357:	00 00 00 
+  80035a:	41 ff d1             	call   *%r9
+
+000000000080035d <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80035d:	48 63 f6             	movslq %esi,%rsi
+  800360:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800363:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800368:	ba 00 00 00 00       	mov    $0x0,%edx
+  80036d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800373:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800379:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80037f:	0f 05                	syscall
+    if (check && ret > 0) {
+  800381:	48 85 c0             	test   %rax,%rax
+  800384:	7f 01                	jg     800387 <sys_env_set_status+0x2a>
+}
+  800386:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  800387:	55                   	push   %rbp
+  800388:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80038b:	49 89 c0             	mov    %rax,%r8
+  80038e:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800393:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80039a:	00 00 00 
+  80039d:	be 29 00 00 00       	mov    $0x29,%esi
+  8003a2:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8003a9:	00 00 00 
+  8003ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003b1:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  8003b8:	00 00 00 
+  8003bb:	41 ff d1             	call   *%r9
+
+00000000008003be <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8003be:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003c1:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003c6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003cb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003d1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003d7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003dd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003df:	48 85 c0             	test   %rax,%rax
+  8003e2:	7f 01                	jg     8003e5 <sys_env_set_trapframe+0x27>
+}
+  8003e4:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003e5:	55                   	push   %rbp
+  8003e6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003e9:	49 89 c0             	mov    %rax,%r8
+  8003ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003f1:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8003f8:	00 00 00 
+  8003fb:	be 29 00 00 00       	mov    $0x29,%esi
+  800400:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800407:	00 00 00 
+  80040a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040f:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  800416:	00 00 00 
+  800419:	41 ff d1             	call   *%r9
+
+000000000080041c <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80041c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80041f:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800424:	ba 00 00 00 00       	mov    $0x0,%edx
+  800429:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80042f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800435:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80043b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80043d:	48 85 c0             	test   %rax,%rax
+  800440:	7f 01                	jg     800443 <sys_env_set_pgfault_upcall+0x27>
+}
+  800442:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  800443:	55                   	push   %rbp
+  800444:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800447:	49 89 c0             	mov    %rax,%r8
+  80044a:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80044f:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  800456:	00 00 00 
+  800459:	be 29 00 00 00       	mov    $0x29,%esi
+  80045e:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  800465:	00 00 00 
+  800468:	b8 00 00 00 00       	mov    $0x0,%eax
+  80046d:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  800474:	00 00 00 
+  800477:	41 ff d1             	call   *%r9
+
+000000000080047a <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80047a:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80047d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800480:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800485:	4d 63 c0             	movslq %r8d,%r8
+  800488:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80048e:	0f 05                	syscall
+}
+  800490:	c3                   	ret
+
+0000000000800491 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800491:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800494:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800497:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80049c:	4d 63 c0             	movslq %r8d,%r8
+  80049f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004a5:	0f 05                	syscall
+}
+  8004a7:	c3                   	ret
+
+00000000008004a8 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004a8:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8004ad:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8004b0:	45 89 c0             	mov    %r8d,%r8d
+  8004b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8004b9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8004bb:	48 85 c0             	test   %rax,%rax
+  8004be:	7f 01                	jg     8004c1 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8004c0:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8004c1:	55                   	push   %rbp
+  8004c2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8004c5:	49 89 c0             	mov    %rax,%r8
+  8004c8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004cd:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  8004d4:	00 00 00 
+  8004d7:	be 29 00 00 00       	mov    $0x29,%esi
+  8004dc:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  8004e3:	00 00 00 
+  8004e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004eb:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  8004f2:	00 00 00 
+  8004f5:	41 ff d1             	call   *%r9
+
+00000000008004f8 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004f8:	55                   	push   %rbp
+  8004f9:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800502:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800507:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050c:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  800513:	00 00 00 
+  800516:	ff d0                	call   *%rax
+}
+  800518:	5d                   	pop    %rbp
+  800519:	c3                   	ret
+
+000000000080051a <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80051a:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80051f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800524:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80053a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800540:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  800542:	c3                   	ret
+
+0000000000800543 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  800543:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800548:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80054d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800552:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80055e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800564:	0f 05                	syscall
+    if (check && ret > 0) {
+  800566:	48 85 c0             	test   %rax,%rax
+  800569:	7f 01                	jg     80056c <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80056b:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80056c:	55                   	push   %rbp
+  80056d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800570:	49 89 c0             	mov    %rax,%r8
+  800573:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800578:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80057f:	00 00 00 
+  800582:	be 29 00 00 00       	mov    $0x29,%esi
+  800587:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80058e:	00 00 00 
+  800591:	b8 00 00 00 00       	mov    $0x0,%eax
+  800596:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  80059d:	00 00 00 
+  8005a0:	41 ff d1             	call   *%r9
+
+00000000008005a3 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8005a3:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8005a8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8005ad:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005b7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005c3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005c9:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005cb:	c3                   	ret
+
+00000000008005cc <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005cc:	89 d2                	mov    %edx,%edx
+  8005ce:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005d0:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005d5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e7:	0f 05                	syscall
+}
+  8005e9:	c3                   	ret
+
+00000000008005ea <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005ea:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005ed:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800603:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800609:	0f 05                	syscall
+}
+  80060b:	c3                   	ret
+
+000000000080060c <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80060c:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80060f:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800614:	ba 00 00 00 00       	mov    $0x0,%edx
+  800619:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80061f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800625:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80062b:	0f 05                	syscall
+}
+  80062d:	c3                   	ret
+
+000000000080062e <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80062e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800631:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800636:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80063b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800640:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800646:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80064c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800652:	0f 05                	syscall
+    if (check && ret > 0) {
+  800654:	48 85 c0             	test   %rax,%rax
+  800657:	7f 01                	jg     80065a <sys_irq_ack+0x2c>
+}
+  800659:	c3                   	ret
+sys_irq_ack(int irq) {
+  80065a:	55                   	push   %rbp
+  80065b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80065e:	49 89 c0             	mov    %rax,%r8
+  800661:	b9 16 00 00 00       	mov    $0x16,%ecx
+  800666:	48 ba c0 46 80 00 00 	movabs $0x8046c0,%rdx
+  80066d:	00 00 00 
+  800670:	be 29 00 00 00       	mov    $0x29,%esi
+  800675:	48 bf df 46 80 00 00 	movabs $0x8046df,%rdi
+  80067c:	00 00 00 
+  80067f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800684:	49 b9 7c 33 80 00 00 	movabs $0x80337c,%r9
+  80068b:	00 00 00 
+  80068e:	41 ff d1             	call   *%r9
+
+0000000000800691 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800691:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800698:	ff ff ff 
+  80069b:	48 01 f8             	add    %rdi,%rax
+  80069e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8006a2:	c3                   	ret
+
+00000000008006a3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8006a3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8006aa:	ff ff ff 
+  8006ad:	48 01 f8             	add    %rdi,%rax
+  8006b0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8006b4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8006ba:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8006be:	c3                   	ret
+
+00000000008006bf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8006bf:	55                   	push   %rbp
+  8006c0:	48 89 e5             	mov    %rsp,%rbp
+  8006c3:	41 57                	push   %r15
+  8006c5:	41 56                	push   %r14
+  8006c7:	41 55                	push   %r13
+  8006c9:	41 54                	push   %r12
+  8006cb:	53                   	push   %rbx
+  8006cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8006d0:	49 89 ff             	mov    %rdi,%r15
+  8006d3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006d8:	49 bd 4e 2e 80 00 00 	movabs $0x802e4e,%r13
+  8006df:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006e2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006e8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006eb:	48 89 df             	mov    %rbx,%rdi
+  8006ee:	41 ff d5             	call   *%r13
+  8006f1:	83 e0 04             	and    $0x4,%eax
+  8006f4:	74 17                	je     80070d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006f6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006fd:	4c 39 f3             	cmp    %r14,%rbx
+  800700:	75 e6                	jne    8006e8 <fd_alloc+0x29>
+  800702:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  800708:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80070d:	4d 89 27             	mov    %r12,(%r15)
+}
+  800710:	48 83 c4 08          	add    $0x8,%rsp
+  800714:	5b                   	pop    %rbx
+  800715:	41 5c                	pop    %r12
+  800717:	41 5d                	pop    %r13
+  800719:	41 5e                	pop    %r14
+  80071b:	41 5f                	pop    %r15
+  80071d:	5d                   	pop    %rbp
+  80071e:	c3                   	ret
+
+000000000080071f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80071f:	83 ff 1f             	cmp    $0x1f,%edi
+  800722:	77 39                	ja     80075d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  800724:	55                   	push   %rbp
+  800725:	48 89 e5             	mov    %rsp,%rbp
+  800728:	41 54                	push   %r12
+  80072a:	53                   	push   %rbx
+  80072b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80072e:	48 63 df             	movslq %edi,%rbx
+  800731:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800738:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80073c:	48 89 df             	mov    %rbx,%rdi
+  80073f:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  800746:	00 00 00 
+  800749:	ff d0                	call   *%rax
+  80074b:	a8 04                	test   $0x4,%al
+  80074d:	74 14                	je     800763 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80074f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  800753:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800758:	5b                   	pop    %rbx
+  800759:	41 5c                	pop    %r12
+  80075b:	5d                   	pop    %rbp
+  80075c:	c3                   	ret
+        return -E_INVAL;
+  80075d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  800762:	c3                   	ret
+        return -E_INVAL;
+  800763:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800768:	eb ee                	jmp    800758 <fd_lookup+0x39>
+
+000000000080076a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80076a:	55                   	push   %rbp
+  80076b:	48 89 e5             	mov    %rsp,%rbp
+  80076e:	41 54                	push   %r12
+  800770:	53                   	push   %rbx
+  800771:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  800774:	48 b8 80 47 80 00 00 	movabs $0x804780,%rax
+  80077b:	00 00 00 
+  80077e:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  800785:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800788:	39 3b                	cmp    %edi,(%rbx)
+  80078a:	74 47                	je     8007d3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80078c:	48 83 c0 08          	add    $0x8,%rax
+  800790:	48 8b 18             	mov    (%rax),%rbx
+  800793:	48 85 db             	test   %rbx,%rbx
+  800796:	75 f0                	jne    800788 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800798:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80079f:	00 00 00 
+  8007a2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8007a8:	89 fa                	mov    %edi,%edx
+  8007aa:	48 bf f0 46 80 00 00 	movabs $0x8046f0,%rdi
+  8007b1:	00 00 00 
+  8007b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b9:	48 b9 cc 34 80 00 00 	movabs $0x8034cc,%rcx
+  8007c0:	00 00 00 
+  8007c3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8007c5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007ca:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007ce:	5b                   	pop    %rbx
+  8007cf:	41 5c                	pop    %r12
+  8007d1:	5d                   	pop    %rbp
+  8007d2:	c3                   	ret
+            return 0;
+  8007d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d8:	eb f0                	jmp    8007ca <dev_lookup+0x60>
+
+00000000008007da <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007da:	55                   	push   %rbp
+  8007db:	48 89 e5             	mov    %rsp,%rbp
+  8007de:	41 55                	push   %r13
+  8007e0:	41 54                	push   %r12
+  8007e2:	53                   	push   %rbx
+  8007e3:	48 83 ec 18          	sub    $0x18,%rsp
+  8007e7:	48 89 fb             	mov    %rdi,%rbx
+  8007ea:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007ed:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007f4:	ff ff ff 
+  8007f7:	48 01 df             	add    %rbx,%rdi
+  8007fa:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007fe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800802:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800809:	00 00 00 
+  80080c:	ff d0                	call   *%rax
+  80080e:	41 89 c5             	mov    %eax,%r13d
+  800811:	85 c0                	test   %eax,%eax
+  800813:	78 06                	js     80081b <fd_close+0x41>
+  800815:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  800819:	74 1a                	je     800835 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80081b:	45 84 e4             	test   %r12b,%r12b
+  80081e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800823:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  800827:	44 89 e8             	mov    %r13d,%eax
+  80082a:	48 83 c4 18          	add    $0x18,%rsp
+  80082e:	5b                   	pop    %rbx
+  80082f:	41 5c                	pop    %r12
+  800831:	41 5d                	pop    %r13
+  800833:	5d                   	pop    %rbp
+  800834:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  800835:	8b 3b                	mov    (%rbx),%edi
+  800837:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80083b:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800842:	00 00 00 
+  800845:	ff d0                	call   *%rax
+  800847:	41 89 c5             	mov    %eax,%r13d
+  80084a:	85 c0                	test   %eax,%eax
+  80084c:	78 1b                	js     800869 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80084e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800852:	48 8b 40 20          	mov    0x20(%rax),%rax
+  800856:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80085c:	48 85 c0             	test   %rax,%rax
+  80085f:	74 08                	je     800869 <fd_close+0x8f>
+  800861:	48 89 df             	mov    %rbx,%rdi
+  800864:	ff d0                	call   *%rax
+  800866:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800869:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80086e:	48 89 de             	mov    %rbx,%rsi
+  800871:	bf 00 00 00 00       	mov    $0x0,%edi
+  800876:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  80087d:	00 00 00 
+  800880:	ff d0                	call   *%rax
+    return res;
+  800882:	eb a3                	jmp    800827 <fd_close+0x4d>
+
+0000000000800884 <close>:
+
+int
+close(int fdnum) {
+  800884:	55                   	push   %rbp
+  800885:	48 89 e5             	mov    %rsp,%rbp
+  800888:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80088c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800890:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800897:	00 00 00 
+  80089a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80089c:	85 c0                	test   %eax,%eax
+  80089e:	78 15                	js     8008b5 <close+0x31>
+
+    return fd_close(fd, 1);
+  8008a0:	be 01 00 00 00       	mov    $0x1,%esi
+  8008a5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8008a9:	48 b8 da 07 80 00 00 	movabs $0x8007da,%rax
+  8008b0:	00 00 00 
+  8008b3:	ff d0                	call   *%rax
+}
+  8008b5:	c9                   	leave
+  8008b6:	c3                   	ret
+
+00000000008008b7 <close_all>:
+
+void
+close_all(void) {
+  8008b7:	55                   	push   %rbp
+  8008b8:	48 89 e5             	mov    %rsp,%rbp
+  8008bb:	41 54                	push   %r12
+  8008bd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8008be:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8008c3:	49 bc 84 08 80 00 00 	movabs $0x800884,%r12
+  8008ca:	00 00 00 
+  8008cd:	89 df                	mov    %ebx,%edi
+  8008cf:	41 ff d4             	call   *%r12
+  8008d2:	83 c3 01             	add    $0x1,%ebx
+  8008d5:	83 fb 20             	cmp    $0x20,%ebx
+  8008d8:	75 f3                	jne    8008cd <close_all+0x16>
+}
+  8008da:	5b                   	pop    %rbx
+  8008db:	41 5c                	pop    %r12
+  8008dd:	5d                   	pop    %rbp
+  8008de:	c3                   	ret
+
+00000000008008df <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008df:	55                   	push   %rbp
+  8008e0:	48 89 e5             	mov    %rsp,%rbp
+  8008e3:	41 57                	push   %r15
+  8008e5:	41 56                	push   %r14
+  8008e7:	41 55                	push   %r13
+  8008e9:	41 54                	push   %r12
+  8008eb:	53                   	push   %rbx
+  8008ec:	48 83 ec 18          	sub    $0x18,%rsp
+  8008f0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008f3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008f7:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  8008fe:	00 00 00 
+  800901:	ff d0                	call   *%rax
+  800903:	89 c3                	mov    %eax,%ebx
+  800905:	85 c0                	test   %eax,%eax
+  800907:	0f 88 b8 00 00 00    	js     8009c5 <dup+0xe6>
+    close(newfdnum);
+  80090d:	44 89 e7             	mov    %r12d,%edi
+  800910:	48 b8 84 08 80 00 00 	movabs $0x800884,%rax
+  800917:	00 00 00 
+  80091a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80091c:	4d 63 ec             	movslq %r12d,%r13
+  80091f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  800926:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80092a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80092e:	4c 89 ff             	mov    %r15,%rdi
+  800931:	49 be a3 06 80 00 00 	movabs $0x8006a3,%r14
+  800938:	00 00 00 
+  80093b:	41 ff d6             	call   *%r14
+  80093e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800941:	4c 89 ef             	mov    %r13,%rdi
+  800944:	41 ff d6             	call   *%r14
+  800947:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80094a:	48 89 df             	mov    %rbx,%rdi
+  80094d:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  800954:	00 00 00 
+  800957:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800959:	a8 04                	test   $0x4,%al
+  80095b:	74 2b                	je     800988 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80095d:	41 89 c1             	mov    %eax,%r9d
+  800960:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800966:	4c 89 f1             	mov    %r14,%rcx
+  800969:	ba 00 00 00 00       	mov    $0x0,%edx
+  80096e:	48 89 de             	mov    %rbx,%rsi
+  800971:	bf 00 00 00 00       	mov    $0x0,%edi
+  800976:	48 b8 b4 02 80 00 00 	movabs $0x8002b4,%rax
+  80097d:	00 00 00 
+  800980:	ff d0                	call   *%rax
+  800982:	89 c3                	mov    %eax,%ebx
+  800984:	85 c0                	test   %eax,%eax
+  800986:	78 4e                	js     8009d6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800988:	4c 89 ff             	mov    %r15,%rdi
+  80098b:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  800992:	00 00 00 
+  800995:	ff d0                	call   *%rax
+  800997:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  80099a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8009a0:	4c 89 e9             	mov    %r13,%rcx
+  8009a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a8:	4c 89 fe             	mov    %r15,%rsi
+  8009ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009b0:	48 b8 b4 02 80 00 00 	movabs $0x8002b4,%rax
+  8009b7:	00 00 00 
+  8009ba:	ff d0                	call   *%rax
+  8009bc:	89 c3                	mov    %eax,%ebx
+  8009be:	85 c0                	test   %eax,%eax
+  8009c0:	78 14                	js     8009d6 <dup+0xf7>
+
+    return newfdnum;
+  8009c2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8009c5:	89 d8                	mov    %ebx,%eax
+  8009c7:	48 83 c4 18          	add    $0x18,%rsp
+  8009cb:	5b                   	pop    %rbx
+  8009cc:	41 5c                	pop    %r12
+  8009ce:	41 5d                	pop    %r13
+  8009d0:	41 5e                	pop    %r14
+  8009d2:	41 5f                	pop    %r15
+  8009d4:	5d                   	pop    %rbp
+  8009d5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009d6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009db:	4c 89 ee             	mov    %r13,%rsi
+  8009de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009e3:	49 bc 04 03 80 00 00 	movabs $0x800304,%r12
+  8009ea:	00 00 00 
+  8009ed:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009f0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009f5:	4c 89 f6             	mov    %r14,%rsi
+  8009f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009fd:	41 ff d4             	call   *%r12
+    return res;
+  800a00:	eb c3                	jmp    8009c5 <dup+0xe6>
+
+0000000000800a02 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  800a02:	55                   	push   %rbp
+  800a03:	48 89 e5             	mov    %rsp,%rbp
+  800a06:	41 56                	push   %r14
+  800a08:	41 55                	push   %r13
+  800a0a:	41 54                	push   %r12
+  800a0c:	53                   	push   %rbx
+  800a0d:	48 83 ec 10          	sub    $0x10,%rsp
+  800a11:	89 fb                	mov    %edi,%ebx
+  800a13:	49 89 f4             	mov    %rsi,%r12
+  800a16:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800a1d:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800a24:	00 00 00 
+  800a27:	ff d0                	call   *%rax
+  800a29:	85 c0                	test   %eax,%eax
+  800a2b:	78 4c                	js     800a79 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a2d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a31:	41 8b 3e             	mov    (%r14),%edi
+  800a34:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a38:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800a3f:	00 00 00 
+  800a42:	ff d0                	call   *%rax
+  800a44:	85 c0                	test   %eax,%eax
+  800a46:	78 35                	js     800a7d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a48:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a4c:	83 e0 03             	and    $0x3,%eax
+  800a4f:	83 f8 01             	cmp    $0x1,%eax
+  800a52:	74 2d                	je     800a81 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a58:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a5c:	48 85 c0             	test   %rax,%rax
+  800a5f:	74 56                	je     800ab7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a61:	4c 89 ea             	mov    %r13,%rdx
+  800a64:	4c 89 e6             	mov    %r12,%rsi
+  800a67:	4c 89 f7             	mov    %r14,%rdi
+  800a6a:	ff d0                	call   *%rax
+}
+  800a6c:	48 83 c4 10          	add    $0x10,%rsp
+  800a70:	5b                   	pop    %rbx
+  800a71:	41 5c                	pop    %r12
+  800a73:	41 5d                	pop    %r13
+  800a75:	41 5e                	pop    %r14
+  800a77:	5d                   	pop    %rbp
+  800a78:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a79:	48 98                	cltq
+  800a7b:	eb ef                	jmp    800a6c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a7d:	48 98                	cltq
+  800a7f:	eb eb                	jmp    800a6c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a81:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a88:	00 00 00 
+  800a8b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a91:	89 da                	mov    %ebx,%edx
+  800a93:	48 bf 31 47 80 00 00 	movabs $0x804731,%rdi
+  800a9a:	00 00 00 
+  800a9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa2:	48 b9 cc 34 80 00 00 	movabs $0x8034cc,%rcx
+  800aa9:	00 00 00 
+  800aac:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800aae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800ab5:	eb b5                	jmp    800a6c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800ab7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800abe:	eb ac                	jmp    800a6c <read+0x6a>
+
+0000000000800ac0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800ac0:	55                   	push   %rbp
+  800ac1:	48 89 e5             	mov    %rsp,%rbp
+  800ac4:	41 57                	push   %r15
+  800ac6:	41 56                	push   %r14
+  800ac8:	41 55                	push   %r13
+  800aca:	41 54                	push   %r12
+  800acc:	53                   	push   %rbx
+  800acd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800ad1:	48 85 d2             	test   %rdx,%rdx
+  800ad4:	74 54                	je     800b2a <readn+0x6a>
+  800ad6:	41 89 fd             	mov    %edi,%r13d
+  800ad9:	49 89 f6             	mov    %rsi,%r14
+  800adc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800adf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800ae4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ae9:	49 bf 02 0a 80 00 00 	movabs $0x800a02,%r15
+  800af0:	00 00 00 
+  800af3:	4c 89 e2             	mov    %r12,%rdx
+  800af6:	48 29 f2             	sub    %rsi,%rdx
+  800af9:	4c 01 f6             	add    %r14,%rsi
+  800afc:	44 89 ef             	mov    %r13d,%edi
+  800aff:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800b02:	85 c0                	test   %eax,%eax
+  800b04:	78 20                	js     800b26 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800b06:	01 c3                	add    %eax,%ebx
+  800b08:	85 c0                	test   %eax,%eax
+  800b0a:	74 08                	je     800b14 <readn+0x54>
+  800b0c:	48 63 f3             	movslq %ebx,%rsi
+  800b0f:	4c 39 e6             	cmp    %r12,%rsi
+  800b12:	72 df                	jb     800af3 <readn+0x33>
+    }
+    return res;
+  800b14:	48 63 c3             	movslq %ebx,%rax
+}
+  800b17:	48 83 c4 08          	add    $0x8,%rsp
+  800b1b:	5b                   	pop    %rbx
+  800b1c:	41 5c                	pop    %r12
+  800b1e:	41 5d                	pop    %r13
+  800b20:	41 5e                	pop    %r14
+  800b22:	41 5f                	pop    %r15
+  800b24:	5d                   	pop    %rbp
+  800b25:	c3                   	ret
+        if (inc < 0) return inc;
+  800b26:	48 98                	cltq
+  800b28:	eb ed                	jmp    800b17 <readn+0x57>
+    int inc = 1, res = 0;
+  800b2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b2f:	eb e3                	jmp    800b14 <readn+0x54>
+
+0000000000800b31 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b31:	55                   	push   %rbp
+  800b32:	48 89 e5             	mov    %rsp,%rbp
+  800b35:	41 56                	push   %r14
+  800b37:	41 55                	push   %r13
+  800b39:	41 54                	push   %r12
+  800b3b:	53                   	push   %rbx
+  800b3c:	48 83 ec 10          	sub    $0x10,%rsp
+  800b40:	89 fb                	mov    %edi,%ebx
+  800b42:	49 89 f4             	mov    %rsi,%r12
+  800b45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b4c:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800b53:	00 00 00 
+  800b56:	ff d0                	call   *%rax
+  800b58:	85 c0                	test   %eax,%eax
+  800b5a:	78 47                	js     800ba3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b60:	41 8b 3e             	mov    (%r14),%edi
+  800b63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b67:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800b6e:	00 00 00 
+  800b71:	ff d0                	call   *%rax
+  800b73:	85 c0                	test   %eax,%eax
+  800b75:	78 30                	js     800ba7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b77:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b7c:	74 2d                	je     800bab <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b82:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b86:	48 85 c0             	test   %rax,%rax
+  800b89:	74 56                	je     800be1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b8b:	4c 89 ea             	mov    %r13,%rdx
+  800b8e:	4c 89 e6             	mov    %r12,%rsi
+  800b91:	4c 89 f7             	mov    %r14,%rdi
+  800b94:	ff d0                	call   *%rax
+}
+  800b96:	48 83 c4 10          	add    $0x10,%rsp
+  800b9a:	5b                   	pop    %rbx
+  800b9b:	41 5c                	pop    %r12
+  800b9d:	41 5d                	pop    %r13
+  800b9f:	41 5e                	pop    %r14
+  800ba1:	5d                   	pop    %rbp
+  800ba2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800ba3:	48 98                	cltq
+  800ba5:	eb ef                	jmp    800b96 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800ba7:	48 98                	cltq
+  800ba9:	eb eb                	jmp    800b96 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800bab:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800bb2:	00 00 00 
+  800bb5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800bbb:	89 da                	mov    %ebx,%edx
+  800bbd:	48 bf 4d 47 80 00 00 	movabs $0x80474d,%rdi
+  800bc4:	00 00 00 
+  800bc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bcc:	48 b9 cc 34 80 00 00 	movabs $0x8034cc,%rcx
+  800bd3:	00 00 00 
+  800bd6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bd8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bdf:	eb b5                	jmp    800b96 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800be1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800be8:	eb ac                	jmp    800b96 <write+0x65>
+
+0000000000800bea <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bea:	55                   	push   %rbp
+  800beb:	48 89 e5             	mov    %rsp,%rbp
+  800bee:	41 54                	push   %r12
+  800bf0:	53                   	push   %rbx
+  800bf1:	48 83 ec 10          	sub    $0x10,%rsp
+  800bf5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bf7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bfb:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800c02:	00 00 00 
+  800c05:	ff d0                	call   *%rax
+  800c07:	85 c0                	test   %eax,%eax
+  800c09:	78 3e                	js     800c49 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c0b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800c0f:	41 8b 3c 24          	mov    (%r12),%edi
+  800c13:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800c17:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800c1e:	00 00 00 
+  800c21:	ff d0                	call   *%rax
+  800c23:	85 c0                	test   %eax,%eax
+  800c25:	78 22                	js     800c49 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800c27:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c2b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c2f:	48 85 c0             	test   %rax,%rax
+  800c32:	74 0b                	je     800c3f <seek+0x55>
+  800c34:	89 de                	mov    %ebx,%esi
+  800c36:	4c 89 e7             	mov    %r12,%rdi
+  800c39:	ff d0                	call   *%rax
+  800c3b:	85 c0                	test   %eax,%eax
+  800c3d:	78 0a                	js     800c49 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c3f:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c44:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c49:	48 83 c4 10          	add    $0x10,%rsp
+  800c4d:	5b                   	pop    %rbx
+  800c4e:	41 5c                	pop    %r12
+  800c50:	5d                   	pop    %rbp
+  800c51:	c3                   	ret
+
+0000000000800c52 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c52:	55                   	push   %rbp
+  800c53:	48 89 e5             	mov    %rsp,%rbp
+  800c56:	41 55                	push   %r13
+  800c58:	41 54                	push   %r12
+  800c5a:	53                   	push   %rbx
+  800c5b:	48 83 ec 18          	sub    $0x18,%rsp
+  800c5f:	89 fb                	mov    %edi,%ebx
+  800c61:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c64:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c68:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800c6f:	00 00 00 
+  800c72:	ff d0                	call   *%rax
+  800c74:	85 c0                	test   %eax,%eax
+  800c76:	78 38                	js     800cb0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c78:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c7c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c80:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c84:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800c8b:	00 00 00 
+  800c8e:	ff d0                	call   *%rax
+  800c90:	85 c0                	test   %eax,%eax
+  800c92:	78 1c                	js     800cb0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c94:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c99:	74 20                	je     800cbb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c9b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c9f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800ca3:	48 85 c0             	test   %rax,%rax
+  800ca6:	74 47                	je     800cef <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800ca8:	44 89 e6             	mov    %r12d,%esi
+  800cab:	4c 89 ef             	mov    %r13,%rdi
+  800cae:	ff d0                	call   *%rax
+}
+  800cb0:	48 83 c4 18          	add    $0x18,%rsp
+  800cb4:	5b                   	pop    %rbx
+  800cb5:	41 5c                	pop    %r12
+  800cb7:	41 5d                	pop    %r13
+  800cb9:	5d                   	pop    %rbp
+  800cba:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800cbb:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800cc2:	00 00 00 
+  800cc5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ccb:	89 da                	mov    %ebx,%edx
+  800ccd:	48 bf 10 47 80 00 00 	movabs $0x804710,%rdi
+  800cd4:	00 00 00 
+  800cd7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cdc:	48 b9 cc 34 80 00 00 	movabs $0x8034cc,%rcx
+  800ce3:	00 00 00 
+  800ce6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800ce8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ced:	eb c1                	jmp    800cb0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800cf4:	eb ba                	jmp    800cb0 <ftruncate+0x5e>
+
+0000000000800cf6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cf6:	55                   	push   %rbp
+  800cf7:	48 89 e5             	mov    %rsp,%rbp
+  800cfa:	41 54                	push   %r12
+  800cfc:	53                   	push   %rbx
+  800cfd:	48 83 ec 10          	sub    $0x10,%rsp
+  800d01:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800d04:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d08:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  800d0f:	00 00 00 
+  800d12:	ff d0                	call   *%rax
+  800d14:	85 c0                	test   %eax,%eax
+  800d16:	78 4e                	js     800d66 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800d18:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800d1c:	41 8b 3c 24          	mov    (%r12),%edi
+  800d20:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800d24:	48 b8 6a 07 80 00 00 	movabs $0x80076a,%rax
+  800d2b:	00 00 00 
+  800d2e:	ff d0                	call   *%rax
+  800d30:	85 c0                	test   %eax,%eax
+  800d32:	78 32                	js     800d66 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d38:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d3d:	74 30                	je     800d6f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d3f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d42:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d49:	00 00 00 
+    stat->st_isdir = 0;
+  800d4c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d53:	00 00 00 
+    stat->st_dev = dev;
+  800d56:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d5d:	48 89 de             	mov    %rbx,%rsi
+  800d60:	4c 89 e7             	mov    %r12,%rdi
+  800d63:	ff 50 28             	call   *0x28(%rax)
+}
+  800d66:	48 83 c4 10          	add    $0x10,%rsp
+  800d6a:	5b                   	pop    %rbx
+  800d6b:	41 5c                	pop    %r12
+  800d6d:	5d                   	pop    %rbp
+  800d6e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d6f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d74:	eb f0                	jmp    800d66 <fstat+0x70>
+
+0000000000800d76 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d76:	55                   	push   %rbp
+  800d77:	48 89 e5             	mov    %rsp,%rbp
+  800d7a:	41 54                	push   %r12
+  800d7c:	53                   	push   %rbx
+  800d7d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d80:	be 00 00 00 00       	mov    $0x0,%esi
+  800d85:	48 b8 e4 1e 80 00 00 	movabs $0x801ee4,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+  800d91:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d93:	85 c0                	test   %eax,%eax
+  800d95:	78 25                	js     800dbc <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d97:	4c 89 e6             	mov    %r12,%rsi
+  800d9a:	89 c7                	mov    %eax,%edi
+  800d9c:	48 b8 f6 0c 80 00 00 	movabs $0x800cf6,%rax
+  800da3:	00 00 00 
+  800da6:	ff d0                	call   *%rax
+  800da8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800dab:	89 df                	mov    %ebx,%edi
+  800dad:	48 b8 84 08 80 00 00 	movabs $0x800884,%rax
+  800db4:	00 00 00 
+  800db7:	ff d0                	call   *%rax
+
+    return res;
+  800db9:	44 89 e3             	mov    %r12d,%ebx
+}
+  800dbc:	89 d8                	mov    %ebx,%eax
+  800dbe:	5b                   	pop    %rbx
+  800dbf:	41 5c                	pop    %r12
+  800dc1:	5d                   	pop    %rbp
+  800dc2:	c3                   	ret
+
+0000000000800dc3 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800dc3:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800dca:	00 00 00 
+  800dcd:	83 38 00             	cmpl   $0x0,(%rax)
+  800dd0:	74 0a                	je     800ddc <fsenv+0x19>
+    return envid;
+}
+  800dd2:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dd9:	00 00 
+  800ddb:	c3                   	ret
+fsenv(void) {
+  800ddc:	55                   	push   %rbp
+  800ddd:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800de0:	bf 03 00 00 00       	mov    $0x3,%edi
+  800de5:	48 b8 4d 46 80 00 00 	movabs $0x80464d,%rax
+  800dec:	00 00 00 
+  800def:	ff d0                	call   *%rax
+  800df1:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800df8:	00 00 
+}
+  800dfa:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800e01:	00 00 
+  800e03:	5d                   	pop    %rbp
+  800e04:	c3                   	ret
+
+0000000000800e05 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800e05:	55                   	push   %rbp
+  800e06:	48 89 e5             	mov    %rsp,%rbp
+  800e09:	41 54                	push   %r12
+  800e0b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800e0c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e11:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e16:	48 89 de             	mov    %rbx,%rsi
+  800e19:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e1e:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  800e25:	00 00 00 
+  800e28:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e2a:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e31:	00 00 00 
+  800e34:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e3a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e3f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e44:	48 89 de             	mov    %rbx,%rsi
+  800e47:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e4c:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  800e53:	00 00 00 
+  800e56:	ff d0                	call   *%rax
+  800e58:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e5a:	85 c0                	test   %eax,%eax
+  800e5c:	0f 88 a2 00 00 00    	js     800f04 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e62:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e69:	00 00 00 
+  800e6c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e72:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e77:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e79:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e7e:	49 bc 16 30 80 00 00 	movabs $0x803016,%r12
+  800e85:	00 00 00 
+  800e88:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e8b:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e90:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e93:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  800e9a:	00 00 00 
+  800e9d:	ff d0                	call   *%rax
+  800e9f:	89 c7                	mov    %eax,%edi
+  800ea1:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800ea7:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800eac:	48 89 da             	mov    %rbx,%rdx
+  800eaf:	be 09 00 00 00       	mov    $0x9,%esi
+  800eb4:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  800ebb:	00 00 00 
+  800ebe:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800ec0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ec5:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eca:	be 00 00 00 00       	mov    $0x0,%esi
+  800ecf:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ed4:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  800edb:	00 00 00 
+  800ede:	ff d0                	call   *%rax
+  800ee0:	89 c3                	mov    %eax,%ebx
+  800ee2:	85 c0                	test   %eax,%eax
+  800ee4:	78 25                	js     800f0b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ee6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800eed:	00 00 00 
+  800ef0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ef6:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800efd:	00 00 
+    return 0;
+  800eff:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800f04:	89 d8                	mov    %ebx,%eax
+  800f06:	5b                   	pop    %rbx
+  800f07:	41 5c                	pop    %r12
+  800f09:	5d                   	pop    %rbp
+  800f0a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800f0b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800f10:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800f15:	bf 00 00 00 00       	mov    $0x0,%edi
+  800f1a:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  800f21:	00 00 00 
+  800f24:	ff d0                	call   *%rax
+        return res;
+  800f26:	eb dc                	jmp    800f04 <fschan_setup+0xff>
+
+0000000000800f28 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f28:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f2f:	00 00 00 
+  800f32:	80 38 00             	cmpb   $0x0,(%rax)
+  800f35:	74 55                	je     800f8c <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f37:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f3e:	00 00 00 
+  800f41:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f47:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f4c:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f53:	00 00 00 
+  800f56:	3b 0a                	cmp    (%rdx),%ecx
+  800f58:	75 01                	jne    800f5b <fschan+0x33>
+}
+  800f5a:	c3                   	ret
+fschan(void) {
+  800f5b:	55                   	push   %rbp
+  800f5c:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f5f:	48 b8 05 0e 80 00 00 	movabs $0x800e05,%rax
+  800f66:	00 00 00 
+  800f69:	ff d0                	call   *%rax
+  800f6b:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f6d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f72:	85 d2                	test   %edx,%edx
+  800f74:	78 02                	js     800f78 <fschan+0x50>
+}
+  800f76:	5d                   	pop    %rbp
+  800f77:	c3                   	ret
+        fschan_enabled = 0;
+  800f78:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f7f:	00 00 00 
+  800f82:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f85:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8a:	eb ea                	jmp    800f76 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f91:	c3                   	ret
+
+0000000000800f92 <fbuf>:
+fbuf(struct Fd *fd) {
+  800f92:	55                   	push   %rbp
+  800f93:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f96:	48 b8 91 06 80 00 00 	movabs $0x800691,%rax
+  800f9d:	00 00 00 
+  800fa0:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800fa2:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fa7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800fab:	77 12                	ja     800fbf <fbuf+0x2d>
+  800fad:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800fb1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800fb8:	00 00 00 
+  800fbb:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800fbf:	48 89 d0             	mov    %rdx,%rax
+  800fc2:	5d                   	pop    %rbp
+  800fc3:	c3                   	ret
+
+0000000000800fc4 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800fc4:	55                   	push   %rbp
+  800fc5:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fc8:	48 83 c7 40          	add    $0x40,%rdi
+  800fcc:	48 b8 50 30 80 00 00 	movabs $0x803050,%rax
+  800fd3:	00 00 00 
+  800fd6:	ff d0                	call   *%rax
+  800fd8:	84 c0                	test   %al,%al
+  800fda:	75 02                	jne    800fde <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fdc:	5d                   	pop    %rbp
+  800fdd:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fde:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  800fe5:	00 00 00 
+  800fe8:	ff d0                	call   *%rax
+  800fea:	89 c7                	mov    %eax,%edi
+  800fec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800ff2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800ff7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ffc:	be 0a 00 00 00       	mov    $0xa,%esi
+  801001:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  801008:	00 00 00 
+  80100b:	ff d0                	call   *%rax
+}
+  80100d:	eb cd                	jmp    800fdc <fschan_publish+0x18>
+
+000000000080100f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80100f:	55                   	push   %rbp
+  801010:	48 89 e5             	mov    %rsp,%rbp
+  801013:	41 57                	push   %r15
+  801015:	41 56                	push   %r14
+  801017:	41 55                	push   %r13
+  801019:	41 54                	push   %r12
+  80101b:	53                   	push   %rbx
+  80101c:	48 83 ec 48          	sub    $0x48,%rsp
+  801020:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  801024:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801028:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80102b:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80102f:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  801032:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801039:	00 00 00 
+  80103c:	8b 02                	mov    (%rdx),%eax
+  80103e:	83 c0 01             	add    $0x1,%eax
+  801041:	b9 01 00 00 00       	mov    $0x1,%ecx
+  801046:	0f 44 c1             	cmove  %ecx,%eax
+  801049:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80104b:	4d 85 c0             	test   %r8,%r8
+  80104e:	74 2c                	je     80107c <fschan_rw+0x6d>
+  801050:	45 89 ce             	mov    %r9d,%r14d
+  801053:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80105a:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80105e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801064:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80106b:	00 
+  80106c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  801072:	b8 01 00 00 00       	mov    $0x1,%eax
+  801077:	e9 41 01 00 00       	jmp    8011bd <fschan_rw+0x1ae>
+  80107c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801080:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801084:	e9 9c 01 00 00       	jmp    801225 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801089:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80108d:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801090:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  801093:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  801096:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80109a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80109e:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8010a2:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8010a6:	48 89 da             	mov    %rbx,%rdx
+  8010a9:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  8010b0:	00 00 00 
+  8010b3:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8010b5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8010b9:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  8010c0:	00 00 00 
+  8010c3:	ff d0                	call   *%rax
+            queued += blk;
+  8010c5:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010c8:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010cc:	4d 39 fc             	cmp    %r15,%r12
+  8010cf:	73 6b                	jae    80113c <fschan_rw+0x12d>
+  8010d1:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010d5:	77 65                	ja     80113c <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010db:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010df:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  8010e6:	00 00 00 
+  8010e9:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010eb:	4c 89 fb             	mov    %r15,%rbx
+  8010ee:	4c 29 e3             	sub    %r12,%rbx
+  8010f1:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010f6:	48 39 d3             	cmp    %rdx,%rbx
+  8010f9:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010fd:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  801101:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801105:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  801109:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80110c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80110e:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  801115:	00 00 00 
+  801118:	8b 09                	mov    (%rcx),%ecx
+  80111a:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80111d:	83 fe 03             	cmp    $0x3,%esi
+  801120:	0f 85 63 ff ff ff    	jne    801089 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  801126:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80112a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80112d:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801130:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  801133:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  801137:	e9 79 ff ff ff       	jmp    8010b5 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80113c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801140:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  801147:	48 89 df             	mov    %rbx,%rdi
+  80114a:	48 b8 ee 30 80 00 00 	movabs $0x8030ee,%rax
+  801151:	00 00 00 
+  801154:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801156:	48 89 df             	mov    %rbx,%rdi
+  801159:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  801160:	00 00 00 
+  801163:	ff d0                	call   *%rax
+  801165:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801169:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80116d:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801171:	75 25                	jne    801198 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  801173:	8b 40 04             	mov    0x4(%rax),%eax
+  801176:	85 c0                	test   %eax,%eax
+  801178:	0f 88 86 00 00 00    	js     801204 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80117e:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  801182:	74 5b                	je     8011df <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  801184:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801188:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80118c:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801190:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  801194:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801198:	48 89 df             	mov    %rbx,%rdi
+  80119b:	48 b8 a3 30 80 00 00 	movabs $0x8030a3,%rax
+  8011a2:	00 00 00 
+  8011a5:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8011a7:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8011ab:	83 f0 01             	xor    $0x1,%eax
+  8011ae:	4d 39 fc             	cmp    %r15,%r12
+  8011b1:	0f 92 c2             	setb   %dl
+  8011b4:	84 c2                	test   %al,%dl
+  8011b6:	75 05                	jne    8011bd <fschan_rw+0x1ae>
+  8011b8:	45 85 ed             	test   %r13d,%r13d
+  8011bb:	74 50                	je     80120d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8011bd:	4d 39 fc             	cmp    %r15,%r12
+  8011c0:	0f 92 c1             	setb   %cl
+  8011c3:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8011c7:	0f 96 c2             	setbe  %dl
+  8011ca:	84 d1                	test   %dl,%cl
+  8011cc:	0f 84 6a ff ff ff    	je     80113c <fschan_rw+0x12d>
+  8011d2:	84 c0                	test   %al,%al
+  8011d4:	0f 85 fd fe ff ff    	jne    8010d7 <fschan_rw+0xc8>
+  8011da:	e9 5d ff ff ff       	jmp    80113c <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011df:	48 63 d0             	movslq %eax,%rdx
+  8011e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011e6:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011ee:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011f2:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011f6:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  8011fd:	00 00 00 
+  801200:	ff d0                	call   *%rax
+  801202:	eb 80                	jmp    801184 <fschan_rw+0x175>
+                err = msg->fm_res;
+  801204:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  801207:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80120b:	eb 8b                	jmp    801198 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80120d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  801212:	0f 85 68 fe ff ff    	jne    801080 <fschan_rw+0x71>
+  801218:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80121b:	85 c0                	test   %eax,%eax
+  80121d:	0f 84 5d fe ff ff    	je     801080 <fschan_rw+0x71>
+  801223:	48 98                	cltq
+}
+  801225:	48 83 c4 48          	add    $0x48,%rsp
+  801229:	5b                   	pop    %rbx
+  80122a:	41 5c                	pop    %r12
+  80122c:	41 5d                	pop    %r13
+  80122e:	41 5e                	pop    %r14
+  801230:	41 5f                	pop    %r15
+  801232:	5d                   	pop    %rbp
+  801233:	c3                   	ret
+
+0000000000801234 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  801234:	55                   	push   %rbp
+  801235:	48 89 e5             	mov    %rsp,%rbp
+  801238:	41 56                	push   %r14
+  80123a:	41 55                	push   %r13
+  80123c:	41 54                	push   %r12
+  80123e:	53                   	push   %rbx
+  80123f:	48 83 ec 10          	sub    $0x10,%rsp
+  801243:	49 89 fe             	mov    %rdi,%r14
+  801246:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801249:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80124d:	48 29 f3             	sub    %rsi,%rbx
+  801250:	48 39 d3             	cmp    %rdx,%rbx
+  801253:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  801257:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80125e:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80125f:	bf 00 10 00 00       	mov    $0x1000,%edi
+  801264:	49 bd ad 2e 80 00 00 	movabs $0x802ead,%r13
+  80126b:	00 00 00 
+  80126e:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  801275:	76 1e                	jbe    801295 <mmap_fault+0x61>
+  801277:	4c 01 e7             	add    %r12,%rdi
+  80127a:	41 ff d5             	call   *%r13
+  80127d:	84 c0                	test   %al,%al
+  80127f:	75 14                	jne    801295 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801281:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  801285:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80128c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801290:	48 39 df             	cmp    %rbx,%rdi
+  801293:	72 e2                	jb     801277 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  801295:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80129c:	00 00 00 
+  80129f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8012a6:	00 00 00 
+  8012a9:	4c 89 f0             	mov    %r14,%rax
+  8012ac:	48 29 d0             	sub    %rdx,%rax
+  8012af:	48 c1 f8 03          	sar    $0x3,%rax
+  8012b3:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8012ba:	aa aa aa 
+  8012bd:	48 0f af c2          	imul   %rdx,%rax
+  8012c1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8012c5:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012ca:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012ce:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012d0:	44 89 e0             	mov    %r12d,%eax
+  8012d3:	41 03 46 10          	add    0x10(%r14),%eax
+  8012d7:	41 2b 06             	sub    (%r14),%eax
+  8012da:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012e1:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012e5:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012e9:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012ec:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  8012f3:	00 00 00 
+  8012f6:	ff d0                	call   *%rax
+  8012f8:	89 c7                	mov    %eax,%edi
+  8012fa:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801300:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801305:	48 89 da             	mov    %rbx,%rdx
+  801308:	be 0f 00 00 00       	mov    $0xf,%esi
+  80130d:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  801314:	00 00 00 
+  801317:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  801319:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80131e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  801322:	4c 89 e6             	mov    %r12,%rsi
+  801325:	bf 00 00 00 00       	mov    $0x0,%edi
+  80132a:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  801331:	00 00 00 
+  801334:	ff d0                	call   *%rax
+  801336:	48 98                	cltq
+}
+  801338:	48 83 c4 10          	add    $0x10,%rsp
+  80133c:	5b                   	pop    %rbx
+  80133d:	41 5c                	pop    %r12
+  80133f:	41 5d                	pop    %r13
+  801341:	41 5e                	pop    %r14
+  801343:	5d                   	pop    %rbp
+  801344:	c3                   	ret
+
+0000000000801345 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  801345:	48 8b 37             	mov    (%rdi),%rsi
+  801348:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80134f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  801356:	00 00 00 
+  801359:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80135e:	eb 0f                	jmp    80136f <mmap_pgfault+0x2a>
+  801360:	c3                   	ret
+  801361:	48 83 c1 01          	add    $0x1,%rcx
+  801365:	48 83 c2 18          	add    $0x18,%rdx
+  801369:	48 83 f9 20          	cmp    $0x20,%rcx
+  80136d:	74 6e                	je     8013dd <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80136f:	48 8b 02             	mov    (%rdx),%rax
+  801372:	48 83 e8 01          	sub    $0x1,%rax
+  801376:	48 39 f0             	cmp    %rsi,%rax
+  801379:	73 e6                	jae    801361 <mmap_pgfault+0x1c>
+  80137b:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80137f:	73 e0                	jae    801361 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801381:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80138a:	f6 c2 01             	test   $0x1,%dl
+  80138d:	75 d1                	jne    801360 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80138f:	f6 c2 02             	test   $0x2,%dl
+  801392:	74 1a                	je     8013ae <mmap_pgfault+0x69>
+  801394:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139d:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8013a4:	00 00 00 
+  8013a7:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8013ac:	74 35                	je     8013e3 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8013ae:	55                   	push   %rbp
+  8013af:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8013b2:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8013b6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013bd:	00 00 00 
+  8013c0:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8013c4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013c9:	48 b8 34 12 80 00 00 	movabs $0x801234,%rax
+  8013d0:	00 00 00 
+  8013d3:	ff d0                	call   *%rax
+  8013d5:	48 85 c0             	test   %rax,%rax
+  8013d8:	0f 9f c0             	setg   %al
+}
+  8013db:	5d                   	pop    %rbp
+  8013dc:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e2:	c3                   	ret
+}
+  8013e3:	c3                   	ret
+
+00000000008013e4 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013e4:	55                   	push   %rbp
+  8013e5:	48 89 e5             	mov    %rsp,%rbp
+  8013e8:	41 54                	push   %r12
+  8013ea:	53                   	push   %rbx
+  8013eb:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013ee:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013f5:	00 00 00 
+  8013f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013fd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  801401:	74 15                	je     801418 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  801403:	48 83 c3 01          	add    $0x1,%rbx
+  801407:	48 83 c0 18          	add    $0x18,%rax
+  80140b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80140f:	75 ec                	jne    8013fd <mmap_alloc+0x19>
+    return NULL;
+  801411:	b8 00 00 00 00       	mov    $0x0,%eax
+  801416:	eb 52                	jmp    80146a <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801418:	4c 89 e7             	mov    %r12,%rdi
+  80141b:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  801422:	00 00 00 
+  801425:	ff d0                	call   *%rax
+  801427:	41 89 c1             	mov    %eax,%r9d
+  80142a:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801431:	48 c1 e1 0c          	shl    $0xc,%rcx
+  801435:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80143b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801440:	4c 89 e6             	mov    %r12,%rsi
+  801443:	bf 00 00 00 00       	mov    $0x0,%edi
+  801448:	48 b8 b4 02 80 00 00 	movabs $0x8002b4,%rax
+  80144f:	00 00 00 
+  801452:	ff d0                	call   *%rax
+  801454:	85 c0                	test   %eax,%eax
+  801456:	78 17                	js     80146f <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801458:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80145c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801463:	00 00 00 
+  801466:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80146a:	5b                   	pop    %rbx
+  80146b:	41 5c                	pop    %r12
+  80146d:	5d                   	pop    %rbp
+  80146e:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80146f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801474:	eb f4                	jmp    80146a <mmap_alloc+0x86>
+
+0000000000801476 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  801476:	55                   	push   %rbp
+  801477:	48 89 e5             	mov    %rsp,%rbp
+  80147a:	41 56                	push   %r14
+  80147c:	41 55                	push   %r13
+  80147e:	41 54                	push   %r12
+  801480:	53                   	push   %rbx
+  801481:	48 83 ec 10          	sub    $0x10,%rsp
+  801485:	41 89 fc             	mov    %edi,%r12d
+  801488:	49 89 f5             	mov    %rsi,%r13
+  80148b:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80148e:	48 89 f0             	mov    %rsi,%rax
+  801491:	48 09 d0             	or     %rdx,%rax
+  801494:	75 0d                	jne    8014a3 <fsipc+0x2d>
+  801496:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801499:	83 f8 04             	cmp    $0x4,%eax
+  80149c:	76 7d                	jbe    80151b <fsipc+0xa5>
+  80149e:	83 ff 0d             	cmp    $0xd,%edi
+  8014a1:	74 78                	je     80151b <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8014a3:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  8014aa:	00 00 00 
+  8014ad:	ff d0                	call   *%rax
+  8014af:	89 c7                	mov    %eax,%edi
+  8014b1:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8014b8:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8014bf:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8014c6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014cc:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014d3:	00 00 00 
+  8014d6:	44 89 e6             	mov    %r12d,%esi
+  8014d9:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  8014e0:	00 00 00 
+  8014e3:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014e5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014ec:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014f2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014f6:	4c 89 ee             	mov    %r13,%rsi
+  8014f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014fe:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  801505:	00 00 00 
+  801508:	ff d0                	call   *%rax
+  80150a:	89 c3                	mov    %eax,%ebx
+}
+  80150c:	89 d8                	mov    %ebx,%eax
+  80150e:	48 83 c4 10          	add    $0x10,%rsp
+  801512:	5b                   	pop    %rbx
+  801513:	41 5c                	pop    %r12
+  801515:	41 5d                	pop    %r13
+  801517:	41 5e                	pop    %r14
+  801519:	5d                   	pop    %rbp
+  80151a:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80151b:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+  801527:	49 89 c6             	mov    %rax,%r14
+  80152a:	48 85 c0             	test   %rax,%rax
+  80152d:	0f 84 70 ff ff ff    	je     8014a3 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  801533:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  801537:	48 b8 2b 30 80 00 00 	movabs $0x80302b,%rax
+  80153e:	00 00 00 
+  801541:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  801543:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  801546:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80154d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801551:	ba 10 00 00 00       	mov    $0x10,%edx
+  801556:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80155d:	00 00 00 
+  801560:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  801567:	00 00 00 
+  80156a:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80156c:	4c 89 f7             	mov    %r14,%rdi
+  80156f:	48 b8 c4 0f 80 00 00 	movabs $0x800fc4,%rax
+  801576:	00 00 00 
+  801579:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80157b:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  801582:	4c 89 f7             	mov    %r14,%rdi
+  801585:	48 b8 ee 30 80 00 00 	movabs $0x8030ee,%rax
+  80158c:	00 00 00 
+  80158f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801591:	4c 89 f7             	mov    %r14,%rdi
+  801594:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  80159b:	00 00 00 
+  80159e:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8015a0:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8015a3:	41 83 fc 05          	cmp    $0x5,%r12d
+  8015a7:	75 04                	jne    8015ad <fsipc+0x137>
+  8015a9:	85 db                	test   %ebx,%ebx
+  8015ab:	79 14                	jns    8015c1 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8015ad:	4c 89 f7             	mov    %r14,%rdi
+  8015b0:	48 b8 a3 30 80 00 00 	movabs $0x8030a3,%rax
+  8015b7:	00 00 00 
+  8015ba:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8015bc:	e9 4b ff ff ff       	jmp    80150c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8015c1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8015c5:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015ca:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015d1:	00 00 00 
+  8015d4:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  8015db:	00 00 00 
+  8015de:	ff d0                	call   *%rax
+  8015e0:	eb cb                	jmp    8015ad <fsipc+0x137>
+
+00000000008015e2 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015e2:	55                   	push   %rbp
+  8015e3:	48 89 e5             	mov    %rsp,%rbp
+  8015e6:	41 57                	push   %r15
+  8015e8:	41 56                	push   %r14
+  8015ea:	41 55                	push   %r13
+  8015ec:	41 54                	push   %r12
+  8015ee:	53                   	push   %rbx
+  8015ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8015f3:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015f7:	49 89 f6             	mov    %rsi,%r14
+  8015fa:	49 89 d4             	mov    %rdx,%r12
+  8015fd:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  801600:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  801607:	00 00 00 
+  80160a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80160c:	48 85 c0             	test   %rax,%rax
+  80160f:	0f 85 96 00 00 00    	jne    8016ab <devfile_write_direct+0xc9>
+    size_t write = 0;
+  801615:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80161c:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80161d:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  801624:	00 00 00 
+    while (n) {
+  801627:	4d 85 e4             	test   %r12,%r12
+  80162a:	74 79                	je     8016a5 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80162c:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801631:	49 39 dc             	cmp    %rbx,%r12
+  801634:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801638:	48 89 da             	mov    %rbx,%rdx
+  80163b:	4c 89 f6             	mov    %r14,%rsi
+  80163e:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  801645:	00 00 00 
+  801648:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  80164f:	00 00 00 
+  801652:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  801654:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801658:	8b 40 0c             	mov    0xc(%rax),%eax
+  80165b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80165e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801661:	44 01 e8             	add    %r13d,%eax
+  801664:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801668:	41 0f 44 c5          	cmove  %r13d,%eax
+  80166c:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801670:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  801674:	48 89 da             	mov    %rbx,%rdx
+  801677:	be 00 00 00 00       	mov    $0x0,%esi
+  80167c:	bf 04 00 00 00       	mov    $0x4,%edi
+  801681:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  801688:	00 00 00 
+  80168b:	ff d0                	call   *%rax
+        if (res < 0)
+  80168d:	85 c0                	test   %eax,%eax
+  80168f:	78 4a                	js     8016db <devfile_write_direct+0xf9>
+        buf += res;
+  801691:	48 98                	cltq
+  801693:	49 01 c6             	add    %rax,%r14
+        write += res;
+  801696:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80169a:	49 29 c4             	sub    %rax,%r12
+  80169d:	75 8d                	jne    80162c <devfile_write_direct+0x4a>
+    return write;
+  80169f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8016a3:	eb 27                	jmp    8016cc <devfile_write_direct+0xea>
+    size_t write = 0;
+  8016a5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8016a9:	eb f4                	jmp    80169f <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8016ab:	45 89 e9             	mov    %r13d,%r9d
+  8016ae:	4d 89 e0             	mov    %r12,%r8
+  8016b1:	4c 89 f1             	mov    %r14,%rcx
+  8016b4:	ba 04 00 00 00       	mov    $0x4,%edx
+  8016b9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8016bd:	48 89 c7             	mov    %rax,%rdi
+  8016c0:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  8016c7:	00 00 00 
+  8016ca:	ff d0                	call   *%rax
+}
+  8016cc:	48 83 c4 18          	add    $0x18,%rsp
+  8016d0:	5b                   	pop    %rbx
+  8016d1:	41 5c                	pop    %r12
+  8016d3:	41 5d                	pop    %r13
+  8016d5:	41 5e                	pop    %r14
+  8016d7:	41 5f                	pop    %r15
+  8016d9:	5d                   	pop    %rbp
+  8016da:	c3                   	ret
+            return res;
+  8016db:	48 98                	cltq
+  8016dd:	eb ed                	jmp    8016cc <devfile_write_direct+0xea>
+
+00000000008016df <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016df:	55                   	push   %rbp
+  8016e0:	48 89 e5             	mov    %rsp,%rbp
+  8016e3:	41 54                	push   %r12
+  8016e5:	53                   	push   %rbx
+  8016e6:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016e9:	48 b8 92 0f 80 00 00 	movabs $0x800f92,%rax
+  8016f0:	00 00 00 
+  8016f3:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016f5:	48 85 c0             	test   %rax,%rax
+  8016f8:	74 71                	je     80176b <fbuf_flush+0x8c>
+  8016fa:	48 89 c3             	mov    %rax,%rbx
+  8016fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801702:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  801706:	75 05                	jne    80170d <fbuf_flush+0x2e>
+}
+  801708:	5b                   	pop    %rbx
+  801709:	41 5c                	pop    %r12
+  80170b:	5d                   	pop    %rbp
+  80170c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80170d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  801710:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  801714:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80171b:	00 00 00 
+  80171e:	48 89 de             	mov    %rbx,%rsi
+  801721:	48 29 c6             	sub    %rax,%rsi
+  801724:	48 c1 fe 03          	sar    $0x3,%rsi
+  801728:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80172f:	aa aa aa 
+  801732:	48 0f af f0          	imul   %rax,%rsi
+  801736:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80173a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80173f:	48 01 c6             	add    %rax,%rsi
+  801742:	4c 89 e7             	mov    %r12,%rdi
+  801745:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  80174c:	00 00 00 
+  80174f:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801751:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  801755:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80175c:	00 
+    return res < 0 ? res : 0;
+  80175d:	48 85 c0             	test   %rax,%rax
+  801760:	ba 00 00 00 00       	mov    $0x0,%edx
+  801765:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801769:	eb 9d                	jmp    801708 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80176b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801770:	eb 96                	jmp    801708 <fbuf_flush+0x29>
+
+0000000000801772 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  801772:	55                   	push   %rbp
+  801773:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  801776:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  80177d:	00 00 00 
+  801780:	ff d0                	call   *%rax
+}
+  801782:	5d                   	pop    %rbp
+  801783:	c3                   	ret
+
+0000000000801784 <devfile_write>:
+    if (!fd || !buf)
+  801784:	48 85 ff             	test   %rdi,%rdi
+  801787:	0f 84 d3 01 00 00    	je     801960 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80178d:	55                   	push   %rbp
+  80178e:	48 89 e5             	mov    %rsp,%rbp
+  801791:	41 57                	push   %r15
+  801793:	41 56                	push   %r14
+  801795:	41 55                	push   %r13
+  801797:	41 54                	push   %r12
+  801799:	53                   	push   %rbx
+  80179a:	48 83 ec 08          	sub    $0x8,%rsp
+  80179e:	49 89 fc             	mov    %rdi,%r12
+  8017a1:	49 89 f6             	mov    %rsi,%r14
+  8017a4:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8017a7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8017ac:	48 85 f6             	test   %rsi,%rsi
+  8017af:	0f 84 9c 01 00 00    	je     801951 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8017b5:	48 b8 92 0f 80 00 00 	movabs $0x800f92,%rax
+  8017bc:	00 00 00 
+  8017bf:	ff d0                	call   *%rax
+  8017c1:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8017c4:	48 85 c0             	test   %rax,%rax
+  8017c7:	0f 84 a2 00 00 00    	je     80186f <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017cd:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017d2:	4c 89 e7             	mov    %r12,%rdi
+  8017d5:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  8017dc:	00 00 00 
+  8017df:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017e1:	83 f8 02             	cmp    $0x2,%eax
+  8017e4:	0f 8f 85 00 00 00    	jg     80186f <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017ea:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017f1:	00 00 00 
+  8017f4:	4d 89 ef             	mov    %r13,%r15
+  8017f7:	49 29 c7             	sub    %rax,%r15
+  8017fa:	49 c1 ff 03          	sar    $0x3,%r15
+  8017fe:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801805:	aa aa aa 
+  801808:	4c 0f af f8          	imul   %rax,%r15
+  80180c:	49 c1 e7 0e          	shl    $0xe,%r15
+  801810:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801815:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  801818:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80181d:	0f 84 d7 00 00 00    	je     8018fa <devfile_write+0x176>
+  801823:	49 8b 45 10          	mov    0x10(%r13),%rax
+  801827:	89 c2                	mov    %eax,%edx
+  801829:	41 03 55 0c          	add    0xc(%r13),%edx
+  80182d:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  801832:	75 0f                	jne    801843 <devfile_write+0xbf>
+  801834:	48 01 d8             	add    %rbx,%rax
+  801837:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80183d:	0f 86 92 00 00 00    	jbe    8018d5 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801843:	4c 89 e7             	mov    %r12,%rdi
+  801846:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  80184d:	00 00 00 
+  801850:	ff d0                	call   *%rax
+  801852:	85 c0                	test   %eax,%eax
+  801854:	78 52                	js     8018a8 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801856:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80185d:	77 7f                	ja     8018de <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80185f:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  801864:	0f 85 c2 00 00 00    	jne    80192c <devfile_write+0x1a8>
+  80186a:	e9 94 00 00 00       	jmp    801903 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80186f:	4c 89 e7             	mov    %r12,%rdi
+  801872:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  801879:	00 00 00 
+  80187c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80187e:	85 c0                	test   %eax,%eax
+  801880:	79 07                	jns    801889 <devfile_write+0x105>
+  801882:	48 98                	cltq
+  801884:	e9 c8 00 00 00       	jmp    801951 <devfile_write+0x1cd>
+  801889:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80188e:	48 89 da             	mov    %rbx,%rdx
+  801891:	4c 89 f6             	mov    %r14,%rsi
+  801894:	4c 89 e7             	mov    %r12,%rdi
+  801897:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  80189e:	00 00 00 
+  8018a1:	ff d0                	call   *%rax
+  8018a3:	e9 a9 00 00 00       	jmp    801951 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8018a8:	48 98                	cltq
+  8018aa:	e9 a2 00 00 00       	jmp    801951 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018af:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8018b4:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8018b9:	4c 89 fe             	mov    %r15,%rsi
+  8018bc:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c1:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  8018c8:	00 00 00 
+  8018cb:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018cd:	85 c0                	test   %eax,%eax
+  8018cf:	79 45                	jns    801916 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018d1:	48 98                	cltq
+  8018d3:	eb 7c                	jmp    801951 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018d5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018dc:	76 4e                	jbe    80192c <devfile_write+0x1a8>
+  8018de:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018e3:	48 89 da             	mov    %rbx,%rdx
+  8018e6:	4c 89 f6             	mov    %r14,%rsi
+  8018e9:	4c 89 e7             	mov    %r12,%rdi
+  8018ec:	48 b8 e2 15 80 00 00 	movabs $0x8015e2,%rax
+  8018f3:	00 00 00 
+  8018f6:	ff d0                	call   *%rax
+  8018f8:	eb 57                	jmp    801951 <devfile_write+0x1cd>
+  8018fa:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801901:	77 db                	ja     8018de <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  801903:	4c 89 ff             	mov    %r15,%rdi
+  801906:	48 b8 ad 2e 80 00 00 	movabs $0x802ead,%rax
+  80190d:	00 00 00 
+  801910:	ff d0                	call   *%rax
+  801912:	84 c0                	test   %al,%al
+  801914:	74 99                	je     8018af <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  801916:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80191b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  801920:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  801924:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80192b:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80192c:	4c 89 ff             	mov    %r15,%rdi
+  80192f:	49 03 7d 10          	add    0x10(%r13),%rdi
+  801933:	48 89 da             	mov    %rbx,%rdx
+  801936:	4c 89 f6             	mov    %r14,%rsi
+  801939:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  801940:	00 00 00 
+  801943:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  801945:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801949:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80194e:	48 89 d8             	mov    %rbx,%rax
+}
+  801951:	48 83 c4 08          	add    $0x8,%rsp
+  801955:	5b                   	pop    %rbx
+  801956:	41 5c                	pop    %r12
+  801958:	41 5d                	pop    %r13
+  80195a:	41 5e                	pop    %r14
+  80195c:	41 5f                	pop    %r15
+  80195e:	5d                   	pop    %rbp
+  80195f:	c3                   	ret
+        return E_INVAL;
+  801960:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801965:	c3                   	ret
+
+0000000000801966 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  801966:	55                   	push   %rbp
+  801967:	48 89 e5             	mov    %rsp,%rbp
+  80196a:	41 54                	push   %r12
+  80196c:	53                   	push   %rbx
+  80196d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801970:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  801977:	00 00 00 
+  80197a:	ff d0                	call   *%rax
+  80197c:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80197f:	48 89 df             	mov    %rbx,%rdi
+  801982:	48 b8 92 0f 80 00 00 	movabs $0x800f92,%rax
+  801989:	00 00 00 
+  80198c:	ff d0                	call   *%rax
+  80198e:	48 85 c0             	test   %rax,%rax
+  801991:	74 17                	je     8019aa <devfile_flush+0x44>
+  801993:	48 89 df             	mov    %rbx,%rdi
+  801996:	48 b8 92 0f 80 00 00 	movabs $0x800f92,%rax
+  80199d:	00 00 00 
+  8019a0:	ff d0                	call   *%rax
+  8019a2:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8019a9:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8019aa:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8019ad:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8019b4:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8019b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bb:	be 00 00 00 00       	mov    $0x0,%esi
+  8019c0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8019c5:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  8019cc:	00 00 00 
+  8019cf:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019d1:	45 85 e4             	test   %r12d,%r12d
+  8019d4:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019d8:	5b                   	pop    %rbx
+  8019d9:	41 5c                	pop    %r12
+  8019db:	5d                   	pop    %rbp
+  8019dc:	c3                   	ret
+
+00000000008019dd <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019dd:	55                   	push   %rbp
+  8019de:	48 89 e5             	mov    %rsp,%rbp
+  8019e1:	41 57                	push   %r15
+  8019e3:	41 56                	push   %r14
+  8019e5:	41 55                	push   %r13
+  8019e7:	41 54                	push   %r12
+  8019e9:	53                   	push   %rbx
+  8019ea:	48 83 ec 38          	sub    $0x38,%rsp
+  8019ee:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019f2:	49 89 f7             	mov    %rsi,%r15
+  8019f5:	48 89 d3             	mov    %rdx,%rbx
+  8019f8:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019fb:	48 b8 28 0f 80 00 00 	movabs $0x800f28,%rax
+  801a02:	00 00 00 
+  801a05:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a07:	48 85 c0             	test   %rax,%rax
+  801a0a:	75 20                	jne    801a2c <devfile_read_direct+0x4f>
+    bool map = 1;
+  801a0c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  801a11:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  801a18:	00 
+    while (n) {
+  801a19:	48 85 db             	test   %rbx,%rbx
+  801a1c:	0f 85 df 00 00 00    	jne    801b01 <devfile_read_direct+0x124>
+    size_t read = 0;
+  801a22:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  801a26:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a2a:	eb 21                	jmp    801a4d <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a2c:	45 89 f1             	mov    %r14d,%r9d
+  801a2f:	49 89 d8             	mov    %rbx,%r8
+  801a32:	4c 89 f9             	mov    %r15,%rcx
+  801a35:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a3a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a3e:	48 89 c7             	mov    %rax,%rdi
+  801a41:	48 b8 0f 10 80 00 00 	movabs $0x80100f,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+}
+  801a4d:	48 83 c4 38          	add    $0x38,%rsp
+  801a51:	5b                   	pop    %rbx
+  801a52:	41 5c                	pop    %r12
+  801a54:	41 5d                	pop    %r13
+  801a56:	41 5e                	pop    %r14
+  801a58:	41 5f                	pop    %r15
+  801a5a:	5d                   	pop    %rbp
+  801a5b:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a5c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a60:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a66:	75 1e                	jne    801a86 <devfile_read_direct+0xa9>
+  801a68:	e9 e2 00 00 00       	jmp    801b4f <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a6d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a71:	eb da                	jmp    801a4d <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a73:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a77:	0f 85 d0 01 00 00    	jne    801c4d <devfile_read_direct+0x270>
+            map = 0;
+  801a7d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a81:	eb 03                	jmp    801a86 <devfile_read_direct+0xa9>
+  801a83:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a86:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a8b:	48 39 d3             	cmp    %rdx,%rbx
+  801a8e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a92:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a96:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a99:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801aa0:	00 00 00 
+  801aa3:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801aa5:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801aa9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801aad:	be 00 00 00 00       	mov    $0x0,%esi
+  801ab2:	bf 03 00 00 00       	mov    $0x3,%edi
+  801ab7:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  801abe:	00 00 00 
+  801ac1:	ff d0                	call   *%rax
+        if (res <= 0)
+  801ac3:	85 c0                	test   %eax,%eax
+  801ac5:	0f 8e 63 01 00 00    	jle    801c2e <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801acb:	4c 63 e0             	movslq %eax,%r12
+  801ace:	4c 89 e2             	mov    %r12,%rdx
+  801ad1:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ad8:	00 00 00 
+  801adb:	4c 89 ff             	mov    %r15,%rdi
+  801ade:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  801ae5:	00 00 00 
+  801ae8:	ff d0                	call   *%rax
+        buf += res;
+  801aea:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801aed:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801af0:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801af4:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801af8:	48 85 db             	test   %rbx,%rbx
+  801afb:	0f 84 25 ff ff ff    	je     801a26 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801b01:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801b04:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801b08:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801b0c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b10:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801b17:	0f 97 c2             	seta   %dl
+  801b1a:	20 c2                	and    %al,%dl
+  801b1c:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801b1f:	0f 84 5e ff ff ff    	je     801a83 <devfile_read_direct+0xa6>
+  801b25:	4c 89 fa             	mov    %r15,%rdx
+  801b28:	4d 89 fd             	mov    %r15,%r13
+  801b2b:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b32:	0f 85 4e ff ff ff    	jne    801a86 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b38:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b3c:	0f 84 1a ff ff ff    	je     801a5c <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b42:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b49:	0f 85 37 ff ff ff    	jne    801a86 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b4f:	48 89 d8             	mov    %rbx,%rax
+  801b52:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b58:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b5d:	48 39 c8             	cmp    %rcx,%rax
+  801b60:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b68:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b6c:	49 89 d4             	mov    %rdx,%r12
+  801b6f:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b73:	48 b8 4e 2e 80 00 00 	movabs $0x802e4e,%rax
+  801b7a:	00 00 00 
+  801b7d:	ff d0                	call   *%rax
+  801b7f:	a8 40                	test   $0x40,%al
+  801b81:	0f 85 b9 00 00 00    	jne    801c40 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b87:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b92:	49 39 c5             	cmp    %rax,%r13
+  801b95:	72 d8                	jb     801b6f <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b97:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b9b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801ba2:	00 00 00 
+  801ba5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801ba9:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801bac:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801bae:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801bb2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801bb6:	48 b8 c3 0d 80 00 00 	movabs $0x800dc3,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+  801bc2:	89 c7                	mov    %eax,%edi
+  801bc4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801bca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801bcf:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bd6:	00 00 00 
+  801bd9:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bde:	48 b8 f7 45 80 00 00 	movabs $0x8045f7,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bef:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bf3:	4c 89 fe             	mov    %r15,%rsi
+  801bf6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bfb:	48 b8 d3 45 80 00 00 	movabs $0x8045d3,%rax
+  801c02:	00 00 00 
+  801c05:	ff d0                	call   *%rax
+  801c07:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801c0a:	48 85 d2             	test   %rdx,%rdx
+  801c0d:	0f 84 5a fe ff ff    	je     801a6d <devfile_read_direct+0x90>
+            if (res > 0) {
+  801c13:	0f 8e 5a fe ff ff    	jle    801a73 <devfile_read_direct+0x96>
+                buf += res;
+  801c19:	48 98                	cltq
+  801c1b:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801c1e:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801c21:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801c25:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c29:	e9 ca fe ff ff       	jmp    801af8 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c2e:	41 89 c5             	mov    %eax,%r13d
+  801c31:	48 98                	cltq
+  801c33:	45 85 ed             	test   %r13d,%r13d
+  801c36:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c3b:	e9 0d fe ff ff       	jmp    801a4d <devfile_read_direct+0x70>
+            map = 0;
+  801c40:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c44:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c48:	e9 39 fe ff ff       	jmp    801a86 <devfile_read_direct+0xa9>
+  801c4d:	48 89 d0             	mov    %rdx,%rax
+  801c50:	e9 f8 fd ff ff       	jmp    801a4d <devfile_read_direct+0x70>
+
+0000000000801c55 <devfile_read>:
+    if (!fd || !buf)
+  801c55:	48 85 ff             	test   %rdi,%rdi
+  801c58:	0f 84 21 02 00 00    	je     801e7f <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c5e:	55                   	push   %rbp
+  801c5f:	48 89 e5             	mov    %rsp,%rbp
+  801c62:	41 57                	push   %r15
+  801c64:	41 56                	push   %r14
+  801c66:	41 55                	push   %r13
+  801c68:	41 54                	push   %r12
+  801c6a:	53                   	push   %rbx
+  801c6b:	48 83 ec 28          	sub    $0x28,%rsp
+  801c6f:	48 89 fb             	mov    %rdi,%rbx
+  801c72:	49 89 f4             	mov    %rsi,%r12
+  801c75:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c78:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c7d:	48 85 f6             	test   %rsi,%rsi
+  801c80:	74 4b                	je     801ccd <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c82:	48 b8 92 0f 80 00 00 	movabs $0x800f92,%rax
+  801c89:	00 00 00 
+  801c8c:	ff d0                	call   *%rax
+  801c8e:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c91:	48 85 c0             	test   %rax,%rax
+  801c94:	74 22                	je     801cb8 <devfile_read+0x63>
+  801c96:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c9d:	77 19                	ja     801cb8 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c9f:	be 00 10 00 00       	mov    $0x1000,%esi
+  801ca4:	48 89 df             	mov    %rbx,%rdi
+  801ca7:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  801cae:	00 00 00 
+  801cb1:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801cb3:	83 f8 02             	cmp    $0x2,%eax
+  801cb6:	7e 40                	jle    801cf8 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801cb8:	48 89 df             	mov    %rbx,%rdi
+  801cbb:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  801cc2:	00 00 00 
+  801cc5:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cc7:	85 c0                	test   %eax,%eax
+  801cc9:	79 11                	jns    801cdc <devfile_read+0x87>
+  801ccb:	48 98                	cltq
+}
+  801ccd:	48 83 c4 28          	add    $0x28,%rsp
+  801cd1:	5b                   	pop    %rbx
+  801cd2:	41 5c                	pop    %r12
+  801cd4:	41 5d                	pop    %r13
+  801cd6:	41 5e                	pop    %r14
+  801cd8:	41 5f                	pop    %r15
+  801cda:	5d                   	pop    %rbp
+  801cdb:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cdc:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801ce1:	4c 89 ea             	mov    %r13,%rdx
+  801ce4:	4c 89 e6             	mov    %r12,%rsi
+  801ce7:	48 89 df             	mov    %rbx,%rdi
+  801cea:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801cf1:	00 00 00 
+  801cf4:	ff d0                	call   *%rax
+  801cf6:	eb d5                	jmp    801ccd <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cf8:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cfc:	48 89 df             	mov    %rbx,%rdi
+  801cff:	48 b8 df 16 80 00 00 	movabs $0x8016df,%rax
+  801d06:	00 00 00 
+  801d09:	ff d0                	call   *%rax
+  801d0b:	85 c0                	test   %eax,%eax
+  801d0d:	0f 88 33 01 00 00    	js     801e46 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801d13:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801d1a:	00 00 00 
+  801d1d:	4c 89 f0             	mov    %r14,%rax
+  801d20:	48 29 d0             	sub    %rdx,%rax
+  801d23:	48 c1 f8 03          	sar    $0x3,%rax
+  801d27:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d2e:	aa aa aa 
+  801d31:	48 0f af c2          	imul   %rdx,%rax
+  801d35:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d39:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d3d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d40:	41 39 06             	cmp    %eax,(%r14)
+  801d43:	75 0d                	jne    801d52 <devfile_read+0xfd>
+  801d45:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d48:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d4c:	0f 84 fb 00 00 00    	je     801e4d <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d52:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d57:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d5b:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d62:	48 89 c7             	mov    %rax,%rdi
+  801d65:	48 b8 ad 2e 80 00 00 	movabs $0x802ead,%rax
+  801d6c:	00 00 00 
+  801d6f:	ff d0                	call   *%rax
+  801d71:	84 c0                	test   %al,%al
+  801d73:	75 27                	jne    801d9c <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d75:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d7a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d7f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d83:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d88:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  801d8f:	00 00 00 
+  801d92:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d94:	85 c0                	test   %eax,%eax
+  801d96:	0f 88 dc 00 00 00    	js     801e78 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d9c:	44 89 f8             	mov    %r15d,%eax
+  801d9f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801da4:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801da6:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801dad:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801dae:	8b 43 10             	mov    0x10(%rbx),%eax
+  801db1:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801db5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801db8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801dbd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801dc1:	48 89 df             	mov    %rbx,%rdi
+  801dc4:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801dd0:	48 85 c0             	test   %rax,%rax
+  801dd3:	0f 88 f4 fe ff ff    	js     801ccd <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801dd9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801ddc:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801ddf:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801de2:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801de6:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dea:	48 63 d1             	movslq %ecx,%rdx
+  801ded:	48 01 d0             	add    %rdx,%rax
+  801df0:	4d 63 ff             	movslq %r15d,%r15
+  801df3:	4c 29 f8             	sub    %r15,%rax
+  801df6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dfb:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801dff:	48 85 c0             	test   %rax,%rax
+  801e02:	0f 8e c5 fe ff ff    	jle    801ccd <devfile_read+0x78>
+    n = MIN(n, res);
+  801e08:	4c 39 e8             	cmp    %r13,%rax
+  801e0b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801e0f:	8b 73 04             	mov    0x4(%rbx),%esi
+  801e12:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801e16:	48 63 f6             	movslq %esi,%rsi
+  801e19:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801e1e:	48 01 c6             	add    %rax,%rsi
+  801e21:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801e25:	48 01 c6             	add    %rax,%rsi
+  801e28:	4c 89 ea             	mov    %r13,%rdx
+  801e2b:	4c 89 e7             	mov    %r12,%rdi
+  801e2e:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e3a:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e3e:	4c 89 e8             	mov    %r13,%rax
+  801e41:	e9 87 fe ff ff       	jmp    801ccd <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e46:	48 98                	cltq
+  801e48:	e9 80 fe ff ff       	jmp    801ccd <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e4d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e51:	41 39 d7             	cmp    %edx,%r15d
+  801e54:	0f 8c f8 fe ff ff    	jl     801d52 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e5a:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e5e:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e61:	41 39 cf             	cmp    %ecx,%r15d
+  801e64:	0f 8d e8 fe ff ff    	jge    801d52 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e6a:	4d 63 ff             	movslq %r15d,%r15
+  801e6d:	4c 29 f8             	sub    %r15,%rax
+  801e70:	48 63 d2             	movslq %edx,%rdx
+  801e73:	48 01 d0             	add    %rdx,%rax
+  801e76:	eb 87                	jmp    801dff <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e78:	48 98                	cltq
+  801e7a:	e9 4e fe ff ff       	jmp    801ccd <devfile_read+0x78>
+        return E_INVAL;
+  801e7f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e84:	c3                   	ret
+
+0000000000801e85 <fs_channel>:
+fs_channel(bool enable) {
+  801e85:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e87:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e8e:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e90:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e95:	40 84 ff             	test   %dil,%dil
+  801e98:	74 47                	je     801ee1 <fs_channel+0x5c>
+  801e9a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801ea1:	00 00 00 
+  801ea4:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801eaa:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801eb1:	00 00 00 
+  801eb4:	3b 08                	cmp    (%rax),%ecx
+  801eb6:	74 29                	je     801ee1 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801eb8:	55                   	push   %rbp
+  801eb9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801ebc:	48 b8 05 0e 80 00 00 	movabs $0x800e05,%rax
+  801ec3:	00 00 00 
+  801ec6:	ff d0                	call   *%rax
+  801ec8:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801eca:	85 c0                	test   %eax,%eax
+  801ecc:	78 04                	js     801ed2 <fs_channel+0x4d>
+}
+  801ece:	89 d0                	mov    %edx,%eax
+  801ed0:	5d                   	pop    %rbp
+  801ed1:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801ed2:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801ed9:	00 00 00 
+  801edc:	c6 00 00             	movb   $0x0,(%rax)
+  801edf:	eb ed                	jmp    801ece <fs_channel+0x49>
+}
+  801ee1:	89 d0                	mov    %edx,%eax
+  801ee3:	c3                   	ret
+
+0000000000801ee4 <open>:
+open(const char *path, int mode) {
+  801ee4:	55                   	push   %rbp
+  801ee5:	48 89 e5             	mov    %rsp,%rbp
+  801ee8:	41 55                	push   %r13
+  801eea:	41 54                	push   %r12
+  801eec:	53                   	push   %rbx
+  801eed:	48 83 ec 18          	sub    $0x18,%rsp
+  801ef1:	49 89 fc             	mov    %rdi,%r12
+  801ef4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ef7:	48 b8 b3 3d 80 00 00 	movabs $0x803db3,%rax
+  801efe:	00 00 00 
+  801f01:	ff d0                	call   *%rax
+  801f03:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801f09:	0f 87 8f 00 00 00    	ja     801f9e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801f0f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801f13:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  801f1a:	00 00 00 
+  801f1d:	ff d0                	call   *%rax
+  801f1f:	89 c3                	mov    %eax,%ebx
+  801f21:	85 c0                	test   %eax,%eax
+  801f23:	78 55                	js     801f7a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801f25:	4c 89 e6             	mov    %r12,%rsi
+  801f28:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f2f:	00 00 00 
+  801f32:	48 89 df             	mov    %rbx,%rdi
+  801f35:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  801f3c:	00 00 00 
+  801f3f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f41:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f48:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f4d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f51:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f56:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  801f5d:	00 00 00 
+  801f60:	ff d0                	call   *%rax
+  801f62:	89 c3                	mov    %eax,%ebx
+  801f64:	85 c0                	test   %eax,%eax
+  801f66:	78 1f                	js     801f87 <open+0xa3>
+    return fd2num(fd);
+  801f68:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f6c:	48 b8 91 06 80 00 00 	movabs $0x800691,%rax
+  801f73:	00 00 00 
+  801f76:	ff d0                	call   *%rax
+  801f78:	89 c3                	mov    %eax,%ebx
+}
+  801f7a:	89 d8                	mov    %ebx,%eax
+  801f7c:	48 83 c4 18          	add    $0x18,%rsp
+  801f80:	5b                   	pop    %rbx
+  801f81:	41 5c                	pop    %r12
+  801f83:	41 5d                	pop    %r13
+  801f85:	5d                   	pop    %rbp
+  801f86:	c3                   	ret
+        fd_close(fd, 0);
+  801f87:	be 00 00 00 00       	mov    $0x0,%esi
+  801f8c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f90:	48 b8 da 07 80 00 00 	movabs $0x8007da,%rax
+  801f97:	00 00 00 
+  801f9a:	ff d0                	call   *%rax
+        return res;
+  801f9c:	eb dc                	jmp    801f7a <open+0x96>
+        return -E_BAD_PATH;
+  801f9e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801fa3:	eb d5                	jmp    801f7a <open+0x96>
+
+0000000000801fa5 <file_flush_buffers>:
+file_flush_buffers(void) {
+  801fa5:	55                   	push   %rbp
+  801fa6:	48 89 e5             	mov    %rsp,%rbp
+  801fa9:	41 56                	push   %r14
+  801fab:	41 55                	push   %r13
+  801fad:	41 54                	push   %r12
+  801faf:	53                   	push   %rbx
+  801fb0:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801fb4:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801fbb:	00 00 00 
+  801fbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fc3:	49 bd 1f 07 80 00 00 	movabs $0x80071f,%r13
+  801fca:	00 00 00 
+  801fcd:	49 be df 16 80 00 00 	movabs $0x8016df,%r14
+  801fd4:	00 00 00 
+  801fd7:	eb 0c                	jmp    801fe5 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fd9:	83 c3 01             	add    $0x1,%ebx
+  801fdc:	49 83 c4 18          	add    $0x18,%r12
+  801fe0:	83 fb 20             	cmp    $0x20,%ebx
+  801fe3:	74 1d                	je     802002 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fe5:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fea:	74 ed                	je     801fd9 <file_flush_buffers+0x34>
+  801fec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ff0:	89 df                	mov    %ebx,%edi
+  801ff2:	41 ff d5             	call   *%r13
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 e0                	js     801fd9 <file_flush_buffers+0x34>
+  801ff9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801ffd:	41 ff d6             	call   *%r14
+  802000:	eb d7                	jmp    801fd9 <file_flush_buffers+0x34>
+}
+  802002:	48 83 c4 10          	add    $0x10,%rsp
+  802006:	5b                   	pop    %rbx
+  802007:	41 5c                	pop    %r12
+  802009:	41 5d                	pop    %r13
+  80200b:	41 5e                	pop    %r14
+  80200d:	5d                   	pop    %rbp
+  80200e:	c3                   	ret
+
+000000000080200f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80200f:	55                   	push   %rbp
+  802010:	48 89 e5             	mov    %rsp,%rbp
+  802013:	41 54                	push   %r12
+  802015:	53                   	push   %rbx
+  802016:	49 89 fc             	mov    %rdi,%r12
+  802019:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80201b:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  802022:	00 00 00 
+  802025:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  802027:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80202e:	00 00 00 
+  802031:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  802036:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802038:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80203b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802040:	be 00 00 00 00       	mov    $0x0,%esi
+  802045:	bf 02 00 00 00       	mov    $0x2,%edi
+  80204a:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+}
+  802056:	5b                   	pop    %rbx
+  802057:	41 5c                	pop    %r12
+  802059:	5d                   	pop    %rbp
+  80205a:	c3                   	ret
+
+000000000080205b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80205b:	55                   	push   %rbp
+  80205c:	48 89 e5             	mov    %rsp,%rbp
+  80205f:	41 54                	push   %r12
+  802061:	53                   	push   %rbx
+  802062:	49 89 fc             	mov    %rdi,%r12
+  802065:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802068:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  802074:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802079:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802080:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  802082:	ba 00 00 00 00       	mov    $0x0,%edx
+  802087:	be 00 00 00 00       	mov    $0x0,%esi
+  80208c:	bf 05 00 00 00       	mov    $0x5,%edi
+  802091:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802098:	00 00 00 
+  80209b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80209d:	85 c0                	test   %eax,%eax
+  80209f:	78 3d                	js     8020de <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8020a1:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8020a8:	00 00 00 
+  8020ab:	4c 89 e6             	mov    %r12,%rsi
+  8020ae:	48 89 df             	mov    %rbx,%rdi
+  8020b1:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  8020b8:	00 00 00 
+  8020bb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8020bd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8020c4:	00 
+  8020c5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020cb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020d2:	00 
+  8020d3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020de:	5b                   	pop    %rbx
+  8020df:	41 5c                	pop    %r12
+  8020e1:	5d                   	pop    %rbp
+  8020e2:	c3                   	ret
+
+00000000008020e3 <remove>:
+remove(const char *path) {
+  8020e3:	55                   	push   %rbp
+  8020e4:	48 89 e5             	mov    %rsp,%rbp
+  8020e7:	53                   	push   %rbx
+  8020e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8020ec:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020ef:	48 b8 b3 3d 80 00 00 	movabs $0x803db3,%rax
+  8020f6:	00 00 00 
+  8020f9:	ff d0                	call   *%rax
+  8020fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802101:	77 3a                	ja     80213d <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  802103:	48 89 de             	mov    %rbx,%rsi
+  802106:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80210d:	00 00 00 
+  802110:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  802117:	00 00 00 
+  80211a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80211c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802121:	be 00 00 00 00       	mov    $0x0,%esi
+  802126:	bf 07 00 00 00       	mov    $0x7,%edi
+  80212b:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802132:	00 00 00 
+  802135:	ff d0                	call   *%rax
+}
+  802137:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80213b:	c9                   	leave
+  80213c:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80213d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  802142:	eb f3                	jmp    802137 <remove+0x54>
+
+0000000000802144 <sync>:
+sync(void) {
+  802144:	55                   	push   %rbp
+  802145:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802148:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  80214f:	00 00 00 
+  802152:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  802154:	ba 00 00 00 00       	mov    $0x0,%edx
+  802159:	be 00 00 00 00       	mov    $0x0,%esi
+  80215e:	bf 08 00 00 00       	mov    $0x8,%edi
+  802163:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  80216a:	00 00 00 
+  80216d:	ff d0                	call   *%rax
+}
+  80216f:	5d                   	pop    %rbp
+  802170:	c3                   	ret
+
+0000000000802171 <fsync>:
+fsync(int fdnum) {
+  802171:	55                   	push   %rbp
+  802172:	48 89 e5             	mov    %rsp,%rbp
+  802175:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802179:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80217d:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  802184:	00 00 00 
+  802187:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802189:	85 c0                	test   %eax,%eax
+  80218b:	78 4b                	js     8021d8 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80218d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802191:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802198:	00 00 00 
+  80219b:	8b 00                	mov    (%rax),%eax
+  80219d:	39 02                	cmp    %eax,(%rdx)
+  80219f:	75 39                	jne    8021da <fsync+0x69>
+    file_flush_buffers();
+  8021a1:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  8021a8:	00 00 00 
+  8021ab:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8021ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8021b1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8021b4:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8021bb:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8021bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021c7:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021cc:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  8021d3:	00 00 00 
+  8021d6:	ff d0                	call   *%rax
+}
+  8021d8:	c9                   	leave
+  8021d9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021df:	eb f7                	jmp    8021d8 <fsync+0x67>
+
+00000000008021e1 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021e1:	55                   	push   %rbp
+  8021e2:	48 89 e5             	mov    %rsp,%rbp
+  8021e5:	53                   	push   %rbx
+  8021e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8021ea:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8021f7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021fc:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802203:	00 00 00 
+  802206:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802208:	85 c0                	test   %eax,%eax
+  80220a:	78 2d                	js     802239 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80220c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802213:	00 00 00 
+  802216:	48 8b 10             	mov    (%rax),%rdx
+  802219:	48 89 13             	mov    %rdx,(%rbx)
+  80221c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802220:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802224:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802228:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80222c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802230:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  802234:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802239:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80223d:	c9                   	leave
+  80223e:	c3                   	ret
+
+000000000080223f <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80223f:	55                   	push   %rbp
+  802240:	48 89 e5             	mov    %rsp,%rbp
+  802243:	53                   	push   %rbx
+  802244:	48 83 ec 08          	sub    $0x8,%rsp
+  802248:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80224b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802250:	be 00 00 00 00       	mov    $0x0,%esi
+  802255:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80225a:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802261:	00 00 00 
+  802264:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802266:	85 c0                	test   %eax,%eax
+  802268:	78 3d                	js     8022a7 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80226a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802271:	00 00 00 
+  802274:	48 8b 10             	mov    (%rax),%rdx
+  802277:	48 89 13             	mov    %rdx,(%rbx)
+  80227a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80227e:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  802282:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802286:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80228a:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80228e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  802292:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  802296:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80229a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80229e:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8022a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8022a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8022ab:	c9                   	leave
+  8022ac:	c3                   	ret
+
+00000000008022ad <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8022ad:	55                   	push   %rbp
+  8022ae:	48 89 e5             	mov    %rsp,%rbp
+  8022b1:	41 57                	push   %r15
+  8022b3:	41 56                	push   %r14
+  8022b5:	41 55                	push   %r13
+  8022b7:	41 54                	push   %r12
+  8022b9:	53                   	push   %rbx
+  8022ba:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8022be:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8022c5:	00 
+  8022c6:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022cd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022d3:	0f 85 43 01 00 00    	jne    80241c <munmap+0x16f>
+  8022d9:	49 89 ff             	mov    %rdi,%r15
+  8022dc:	4c 39 f7             	cmp    %r14,%rdi
+  8022df:	0f 87 37 01 00 00    	ja     80241c <munmap+0x16f>
+  8022e5:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022ec:	00 00 00 
+  8022ef:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022f5:	eb 2c                	jmp    802323 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022f7:	4c 39 f8             	cmp    %r15,%rax
+  8022fa:	0f 83 85 00 00 00    	jae    802385 <munmap+0xd8>
+            m->mm_end = start;
+  802300:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802305:	48 83 c3 18          	add    $0x18,%rbx
+  802309:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802310:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802317:	00 00 00 
+  80231a:	48 39 c3             	cmp    %rax,%rbx
+  80231d:	0f 84 d0 00 00 00    	je     8023f3 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  802323:	49 89 dc             	mov    %rbx,%r12
+  802326:	48 8b 03             	mov    (%rbx),%rax
+  802329:	4c 39 f0             	cmp    %r14,%rax
+  80232c:	73 d7                	jae    802305 <munmap+0x58>
+  80232e:	48 85 c0             	test   %rax,%rax
+  802331:	74 d2                	je     802305 <munmap+0x58>
+  802333:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802337:	49 39 d7             	cmp    %rdx,%r15
+  80233a:	73 c9                	jae    802305 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80233c:	49 39 d6             	cmp    %rdx,%r14
+  80233f:	73 b6                	jae    8022f7 <munmap+0x4a>
+  802341:	49 39 c7             	cmp    %rax,%r15
+  802344:	76 b1                	jbe    8022f7 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  802346:	4c 89 ef             	mov    %r13,%rdi
+  802349:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  802350:	00 00 00 
+  802353:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  802355:	48 85 c0             	test   %rax,%rax
+  802358:	0f 84 c5 00 00 00    	je     802423 <munmap+0x176>
+            *tail = *m;
+  80235e:	48 8b 13             	mov    (%rbx),%rdx
+  802361:	48 89 10             	mov    %rdx,(%rax)
+  802364:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802368:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80236c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802370:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  802374:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  802377:	44 89 f2             	mov    %r14d,%edx
+  80237a:	2b 13                	sub    (%rbx),%edx
+  80237c:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80237f:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  802383:	eb 80                	jmp    802305 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  802385:	49 39 d6             	cmp    %rdx,%r14
+  802388:	73 18                	jae    8023a2 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80238a:	44 89 f2             	mov    %r14d,%edx
+  80238d:	41 03 54 24 10       	add    0x10(%r12),%edx
+  802392:	29 c2                	sub    %eax,%edx
+  802394:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  802399:	4d 89 34 24          	mov    %r14,(%r12)
+  80239d:	e9 63 ff ff ff       	jmp    802305 <munmap+0x58>
+    m->mm_start = 0;
+  8023a2:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8023a9:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8023aa:	4c 89 e6             	mov    %r12,%rsi
+  8023ad:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8023b4:	00 00 00 
+  8023b7:	48 29 c6             	sub    %rax,%rsi
+  8023ba:	48 c1 fe 03          	sar    $0x3,%rsi
+  8023be:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8023c5:	aa aa aa 
+  8023c8:	48 0f af f0          	imul   %rax,%rsi
+  8023cc:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023d0:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023d5:	48 01 c6             	add    %rax,%rsi
+  8023d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023e2:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  8023e9:	00 00 00 
+  8023ec:	ff d0                	call   *%rax
+}
+  8023ee:	e9 12 ff ff ff       	jmp    802305 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023f3:	4c 89 f2             	mov    %r14,%rdx
+  8023f6:	4c 29 fa             	sub    %r15,%rdx
+  8023f9:	4c 89 fe             	mov    %r15,%rsi
+  8023fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802401:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+}
+  80240d:	48 83 c4 08          	add    $0x8,%rsp
+  802411:	5b                   	pop    %rbx
+  802412:	41 5c                	pop    %r12
+  802414:	41 5d                	pop    %r13
+  802416:	41 5e                	pop    %r14
+  802418:	41 5f                	pop    %r15
+  80241a:	5d                   	pop    %rbp
+  80241b:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80241c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802421:	eb ea                	jmp    80240d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  802423:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802428:	eb e3                	jmp    80240d <munmap+0x160>
+
+000000000080242a <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80242a:	55                   	push   %rbp
+  80242b:	48 89 e5             	mov    %rsp,%rbp
+  80242e:	41 57                	push   %r15
+  802430:	41 56                	push   %r14
+  802432:	41 55                	push   %r13
+  802434:	41 54                	push   %r12
+  802436:	53                   	push   %rbx
+  802437:	48 83 ec 28          	sub    $0x28,%rsp
+  80243b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80243f:	49 89 f5             	mov    %rsi,%r13
+  802442:	41 89 d6             	mov    %edx,%r14d
+  802445:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802448:	41 89 cc             	mov    %ecx,%r12d
+  80244b:	44 89 c7             	mov    %r8d,%edi
+  80244e:	44 89 cb             	mov    %r9d,%ebx
+  802451:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802455:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802459:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+  802465:	41 89 c7             	mov    %eax,%r15d
+  802468:	85 c0                	test   %eax,%eax
+  80246a:	0f 88 ae 01 00 00    	js     80261e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802470:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802474:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  80247b:	00 00 00 
+  80247e:	8b 32                	mov    (%rdx),%esi
+  802480:	39 30                	cmp    %esi,(%rax)
+  802482:	0f 85 7a 02 00 00    	jne    802702 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802488:	8b 40 08             	mov    0x8(%rax),%eax
+  80248b:	83 e0 03             	and    $0x3,%eax
+  80248e:	83 f8 01             	cmp    $0x1,%eax
+  802491:	0f 84 76 02 00 00    	je     80270d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802497:	4d 85 ed             	test   %r13,%r13
+  80249a:	0f 84 78 02 00 00    	je     802718 <mmap+0x2ee>
+  8024a0:	85 db                	test   %ebx,%ebx
+  8024a2:	0f 88 70 02 00 00    	js     802718 <mmap+0x2ee>
+  8024a8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8024ae:	41 89 df             	mov    %ebx,%r15d
+  8024b1:	0f 85 6c 02 00 00    	jne    802723 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8024b7:	44 89 f0             	mov    %r14d,%eax
+  8024ba:	83 e0 fd             	and    $0xfffffffd,%eax
+  8024bd:	83 f8 04             	cmp    $0x4,%eax
+  8024c0:	0f 85 68 02 00 00    	jne    80272e <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8024c6:	44 89 e1             	mov    %r12d,%ecx
+  8024c9:	83 e1 01             	and    $0x1,%ecx
+  8024cc:	0f 95 c2             	setne  %dl
+  8024cf:	44 89 e0             	mov    %r12d,%eax
+  8024d2:	d1 e8                	shr    %eax
+  8024d4:	83 f0 01             	xor    $0x1,%eax
+  8024d7:	83 e0 01             	and    $0x1,%eax
+  8024da:	38 c2                	cmp    %al,%dl
+  8024dc:	0f 85 57 02 00 00    	jne    802739 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024e2:	85 c9                	test   %ecx,%ecx
+  8024e4:	74 0a                	je     8024f0 <mmap+0xc6>
+  8024e6:	41 f6 c6 02          	test   $0x2,%r14b
+  8024ea:	0f 85 54 02 00 00    	jne    802744 <mmap+0x31a>
+    file_flush_buffers();
+  8024f0:	48 b8 a5 1f 80 00 00 	movabs $0x801fa5,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024fc:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  802503:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80250a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80250e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  802511:	41 f6 c4 04          	test   $0x4,%r12b
+  802515:	0f 84 15 01 00 00    	je     802630 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80251b:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80251e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  802524:	0f 85 25 02 00 00    	jne    80274f <mmap+0x325>
+  80252a:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80252e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  802535:	00 00 00 
+  802538:	48 39 c2             	cmp    %rax,%rdx
+  80253b:	0f 82 19 02 00 00    	jb     80275a <mmap+0x330>
+  802541:	48 39 c7             	cmp    %rax,%rdi
+  802544:	0f 87 10 02 00 00    	ja     80275a <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80254a:	4c 89 ee             	mov    %r13,%rsi
+  80254d:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  802554:	00 00 00 
+  802557:	ff d0                	call   *%rax
+  802559:	85 c0                	test   %eax,%eax
+  80255b:	0f 88 04 02 00 00    	js     802765 <mmap+0x33b>
+    if (!handler) {
+  802561:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802568:	00 00 00 
+  80256b:	80 38 00             	cmpb   $0x0,(%rax)
+  80256e:	75 2b                	jne    80259b <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802570:	48 bf 45 13 80 00 00 	movabs $0x801345,%rdi
+  802577:	00 00 00 
+  80257a:	48 b8 a2 42 80 00 00 	movabs $0x8042a2,%rax
+  802581:	00 00 00 
+  802584:	ff d0                	call   *%rax
+  802586:	85 c0                	test   %eax,%eax
+  802588:	0f 88 ea 01 00 00    	js     802778 <mmap+0x34e>
+        handler = 1;
+  80258e:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802595:	00 00 00 
+  802598:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80259b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80259f:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  8025a6:	00 00 00 
+  8025a9:	ff d0                	call   *%rax
+  8025ab:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8025ae:	48 85 c0             	test   %rax,%rax
+  8025b1:	0f 84 c9 01 00 00    	je     802780 <mmap+0x356>
+    m->mm_start = va;
+  8025b7:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8025ba:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8025be:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8025c2:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8025c5:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025c9:	44 89 e0             	mov    %r12d,%eax
+  8025cc:	c1 e0 06             	shl    $0x6,%eax
+  8025cf:	25 80 00 00 00       	and    $0x80,%eax
+  8025d4:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025d7:	09 f0                	or     %esi,%eax
+  8025d9:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025dd:	41 f6 c4 08          	test   $0x8,%r12b
+  8025e1:	74 31                	je     802614 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025e3:	48 39 d3             	cmp    %rdx,%rbx
+  8025e6:	73 2c                	jae    802614 <mmap+0x1ea>
+  8025e8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025ed:	48 89 de             	mov    %rbx,%rsi
+  8025f0:	4c 89 f7             	mov    %r14,%rdi
+  8025f3:	48 b8 34 12 80 00 00 	movabs $0x801234,%rax
+  8025fa:	00 00 00 
+  8025fd:	ff d0                	call   *%rax
+  8025ff:	49 89 c4             	mov    %rax,%r12
+  802602:	48 85 c0             	test   %rax,%rax
+  802605:	0f 8e d7 00 00 00    	jle    8026e2 <mmap+0x2b8>
+            va += n;
+  80260b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80260e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  802612:	72 d4                	jb     8025e8 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  802614:	49 8b 06             	mov    (%r14),%rax
+  802617:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80261b:	48 89 06             	mov    %rax,(%rsi)
+}
+  80261e:	44 89 f8             	mov    %r15d,%eax
+  802621:	48 83 c4 28          	add    $0x28,%rsp
+  802625:	5b                   	pop    %rbx
+  802626:	41 5c                	pop    %r12
+  802628:	41 5d                	pop    %r13
+  80262a:	41 5e                	pop    %r14
+  80262c:	41 5f                	pop    %r15
+  80262e:	5d                   	pop    %rbp
+  80262f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802630:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  802637:	00 00 00 
+  80263a:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80263d:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  802644:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802647:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80264c:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  802653:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802656:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80265d:	00 00 00 
+  802660:	48 39 d7             	cmp    %rdx,%rdi
+  802663:	73 1c                	jae    802681 <mmap+0x257>
+        return -E_NO_MEM;
+  802665:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80266b:	eb b1                	jmp    80261e <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80266d:	48 83 c0 01          	add    $0x1,%rax
+  802671:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802675:	77 3f                	ja     8026b6 <mmap+0x28c>
+  802677:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80267c:	48 39 d7             	cmp    %rdx,%rdi
+  80267f:	72 2a                	jb     8026ab <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802681:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  802685:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802689:	48 39 d1             	cmp    %rdx,%rcx
+  80268c:	73 df                	jae    80266d <mmap+0x243>
+  80268e:	48 85 c9             	test   %rcx,%rcx
+  802691:	74 da                	je     80266d <mmap+0x243>
+  802693:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802697:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80269c:	48 39 d3             	cmp    %rdx,%rbx
+  80269f:	73 cc                	jae    80266d <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8026a1:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8026a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a9:	eb cc                	jmp    802677 <mmap+0x24d>
+        return -E_NO_MEM;
+  8026ab:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026b1:	e9 68 ff ff ff       	jmp    80261e <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8026b6:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8026bb:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8026c2:	00 00 00 
+  8026c5:	48 39 c2             	cmp    %rax,%rdx
+  8026c8:	0f 82 9f 00 00 00    	jb     80276d <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026ce:	48 85 db             	test   %rbx,%rbx
+  8026d1:	0f 85 8a fe ff ff    	jne    802561 <mmap+0x137>
+        return -E_NO_MEM;
+  8026d7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026dd:	e9 3c ff ff ff       	jmp    80261e <mmap+0x1f4>
+        if (n < 0) {
+  8026e2:	0f 89 2c ff ff ff    	jns    802614 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026e8:	49 8b 3e             	mov    (%r14),%rdi
+  8026eb:	4c 89 ee             	mov    %r13,%rsi
+  8026ee:	48 b8 ad 22 80 00 00 	movabs $0x8022ad,%rax
+  8026f5:	00 00 00 
+  8026f8:	ff d0                	call   *%rax
+            return n;
+  8026fa:	45 89 e7             	mov    %r12d,%r15d
+  8026fd:	e9 1c ff ff ff       	jmp    80261e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802702:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802708:	e9 11 ff ff ff       	jmp    80261e <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80270d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802713:	e9 06 ff ff ff       	jmp    80261e <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  802718:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80271e:	e9 fb fe ff ff       	jmp    80261e <mmap+0x1f4>
+  802723:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802729:	e9 f0 fe ff ff       	jmp    80261e <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80272e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802734:	e9 e5 fe ff ff       	jmp    80261e <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802739:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80273f:	e9 da fe ff ff       	jmp    80261e <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  802744:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80274a:	e9 cf fe ff ff       	jmp    80261e <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80274f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802755:	e9 c4 fe ff ff       	jmp    80261e <mmap+0x1f4>
+  80275a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802760:	e9 b9 fe ff ff       	jmp    80261e <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802765:	41 89 c7             	mov    %eax,%r15d
+  802768:	e9 b1 fe ff ff       	jmp    80261e <mmap+0x1f4>
+        return -E_NO_MEM;
+  80276d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802773:	e9 a6 fe ff ff       	jmp    80261e <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802778:	41 89 c7             	mov    %eax,%r15d
+  80277b:	e9 9e fe ff ff       	jmp    80261e <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802780:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802786:	e9 93 fe ff ff       	jmp    80261e <mmap+0x1f4>
+
+000000000080278b <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80278b:	55                   	push   %rbp
+  80278c:	48 89 e5             	mov    %rsp,%rbp
+  80278f:	41 54                	push   %r12
+  802791:	53                   	push   %rbx
+  802792:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802795:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  80279c:	00 00 00 
+  80279f:	ff d0                	call   *%rax
+  8027a1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8027a4:	48 be a0 47 80 00 00 	movabs $0x8047a0,%rsi
+  8027ab:	00 00 00 
+  8027ae:	48 89 df             	mov    %rbx,%rdi
+  8027b1:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  8027b8:	00 00 00 
+  8027bb:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8027bd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8027c2:	41 2b 04 24          	sub    (%r12),%eax
+  8027c6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027cc:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027d3:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027d6:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027dd:	00 00 00 
+  8027e0:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027ec:	5b                   	pop    %rbx
+  8027ed:	41 5c                	pop    %r12
+  8027ef:	5d                   	pop    %rbp
+  8027f0:	c3                   	ret
+
+00000000008027f1 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027f1:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027f4:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027fa:	8b 17                	mov    (%rdi),%edx
+  8027fc:	85 d2                	test   %edx,%edx
+  8027fe:	75 01                	jne    802801 <pipe_wakeup+0x10>
+  802800:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  802801:	55                   	push   %rbp
+  802802:	48 89 e5             	mov    %rsp,%rbp
+  802805:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  802808:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80280e:	be 00 04 00 00       	mov    $0x400,%esi
+  802813:	48 b8 ea 05 80 00 00 	movabs $0x8005ea,%rax
+  80281a:	00 00 00 
+  80281d:	ff d0                	call   *%rax
+}
+  80281f:	5d                   	pop    %rbp
+  802820:	c3                   	ret
+
+0000000000802821 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  802821:	55                   	push   %rbp
+  802822:	48 89 e5             	mov    %rsp,%rbp
+  802825:	41 55                	push   %r13
+  802827:	41 54                	push   %r12
+  802829:	53                   	push   %rbx
+  80282a:	48 83 ec 08          	sub    $0x8,%rsp
+  80282e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802831:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  802838:	00 00 00 
+  80283b:	ff d0                	call   *%rax
+  80283d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802840:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802845:	4c 89 e6             	mov    %r12,%rsi
+  802848:	bf 00 00 00 00       	mov    $0x0,%edi
+  80284d:	49 bc 04 03 80 00 00 	movabs $0x800304,%r12
+  802854:	00 00 00 
+  802857:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80285a:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80285e:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  802862:	49 bd f1 27 80 00 00 	movabs $0x8027f1,%r13
+  802869:	00 00 00 
+  80286c:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80286f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802873:	48 89 de             	mov    %rbx,%rsi
+  802876:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802879:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80287e:	48 89 de             	mov    %rbx,%rsi
+  802881:	bf 00 00 00 00       	mov    $0x0,%edi
+  802886:	41 ff d4             	call   *%r12
+  802889:	48 83 c4 08          	add    $0x8,%rsp
+  80288d:	5b                   	pop    %rbx
+  80288e:	41 5c                	pop    %r12
+  802890:	41 5d                	pop    %r13
+  802892:	5d                   	pop    %rbp
+  802893:	c3                   	ret
+
+0000000000802894 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  802894:	55                   	push   %rbp
+  802895:	48 89 e5             	mov    %rsp,%rbp
+  802898:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80289b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8028a0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8028a5:	48 b8 47 02 80 00 00 	movabs $0x800247,%rax
+  8028ac:	00 00 00 
+  8028af:	ff d0                	call   *%rax
+  8028b1:	85 c0                	test   %eax,%eax
+  8028b3:	0f 94 c0             	sete   %al
+  8028b6:	0f b6 c0             	movzbl %al,%eax
+}
+  8028b9:	5d                   	pop    %rbp
+  8028ba:	c3                   	ret
+
+00000000008028bb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8028bb:	55                   	push   %rbp
+  8028bc:	48 89 e5             	mov    %rsp,%rbp
+  8028bf:	41 57                	push   %r15
+  8028c1:	41 56                	push   %r14
+  8028c3:	41 55                	push   %r13
+  8028c5:	41 54                	push   %r12
+  8028c7:	53                   	push   %rbx
+  8028c8:	48 83 ec 38          	sub    $0x38,%rsp
+  8028cc:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028d0:	49 89 f4             	mov    %rsi,%r12
+  8028d3:	49 89 d7             	mov    %rdx,%r15
+  8028d6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028da:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  8028e1:	00 00 00 
+  8028e4:	ff d0                	call   *%rax
+  8028e6:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028e9:	4d 85 ff             	test   %r15,%r15
+  8028ec:	0f 84 f1 00 00 00    	je     8029e3 <devpipe_write+0x128>
+  8028f2:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028f6:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028fa:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028fe:	49 bd 94 28 80 00 00 	movabs $0x802894,%r13
+  802905:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802908:	49 bf f1 27 80 00 00 	movabs $0x8027f1,%r15
+  80290f:	00 00 00 
+  802912:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80291a:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80291e:	8b 73 04             	mov    0x4(%rbx),%esi
+  802921:	48 63 ce             	movslq %esi,%rcx
+  802924:	48 63 03             	movslq (%rbx),%rax
+  802927:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80292d:	48 39 c1             	cmp    %rax,%rcx
+  802930:	72 64                	jb     802996 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  802932:	48 89 de             	mov    %rbx,%rsi
+  802935:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802939:	41 ff d5             	call   *%r13
+  80293c:	85 c0                	test   %eax,%eax
+  80293e:	0f 85 b9 00 00 00    	jne    8029fd <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802944:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802948:	4c 89 f7             	mov    %r14,%rdi
+  80294b:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80294e:	8b 43 04             	mov    0x4(%rbx),%eax
+  802951:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802958:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80295f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802965:	8b 03                	mov    (%rbx),%eax
+  802967:	41 39 c4             	cmp    %eax,%r12d
+  80296a:	75 b2                	jne    80291e <devpipe_write+0x63>
+  80296c:	48 89 de             	mov    %rbx,%rsi
+  80296f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802973:	41 ff d5             	call   *%r13
+  802976:	85 c0                	test   %eax,%eax
+  802978:	75 a0                	jne    80291a <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80297a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80297f:	44 89 e6             	mov    %r12d,%esi
+  802982:	48 89 df             	mov    %rbx,%rdi
+  802985:	48 b8 cc 05 80 00 00 	movabs $0x8005cc,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	e9 7c ff ff ff       	jmp    802912 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  802996:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80299a:	41 0f b6 38          	movzbl (%r8),%edi
+  80299e:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8029a5:	80 80 80 
+  8029a8:	48 89 c8             	mov    %rcx,%rax
+  8029ab:	48 f7 e2             	mul    %rdx
+  8029ae:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8029b2:	48 89 d0             	mov    %rdx,%rax
+  8029b5:	48 c1 e0 08          	shl    $0x8,%rax
+  8029b9:	48 29 d0             	sub    %rdx,%rax
+  8029bc:	48 c1 e0 04          	shl    $0x4,%rax
+  8029c0:	48 29 c1             	sub    %rax,%rcx
+  8029c3:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029c8:	83 c6 01             	add    $0x1,%esi
+  8029cb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029ce:	49 83 c0 01          	add    $0x1,%r8
+  8029d2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029d6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029da:	49 39 c0             	cmp    %rax,%r8
+  8029dd:	0f 85 2f ff ff ff    	jne    802912 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029e3:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029e7:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029eb:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  8029f2:	00 00 00 
+  8029f5:	ff d0                	call   *%rax
+    return n;
+  8029f7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029fb:	eb 05                	jmp    802a02 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029fd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802a02:	48 83 c4 38          	add    $0x38,%rsp
+  802a06:	5b                   	pop    %rbx
+  802a07:	41 5c                	pop    %r12
+  802a09:	41 5d                	pop    %r13
+  802a0b:	41 5e                	pop    %r14
+  802a0d:	41 5f                	pop    %r15
+  802a0f:	5d                   	pop    %rbp
+  802a10:	c3                   	ret
+
+0000000000802a11 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  802a11:	55                   	push   %rbp
+  802a12:	48 89 e5             	mov    %rsp,%rbp
+  802a15:	41 57                	push   %r15
+  802a17:	41 56                	push   %r14
+  802a19:	41 55                	push   %r13
+  802a1b:	41 54                	push   %r12
+  802a1d:	53                   	push   %rbx
+  802a1e:	48 83 ec 28          	sub    $0x28,%rsp
+  802a22:	49 89 fd             	mov    %rdi,%r13
+  802a25:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a29:	49 89 d4             	mov    %rdx,%r12
+  802a2c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a30:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  802a37:	00 00 00 
+  802a3a:	ff d0                	call   *%rax
+  802a3c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a3f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a45:	49 bf 94 28 80 00 00 	movabs $0x802894,%r15
+  802a4c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a4f:	4d 85 e4             	test   %r12,%r12
+  802a52:	0f 84 d5 00 00 00    	je     802b2d <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a58:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a5c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a60:	8b 03                	mov    (%rbx),%eax
+  802a62:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a65:	75 7a                	jne    802ae1 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a67:	4d 85 f6             	test   %r14,%r14
+  802a6a:	75 50                	jne    802abc <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a6c:	48 89 de             	mov    %rbx,%rsi
+  802a6f:	4c 89 ef             	mov    %r13,%rdi
+  802a72:	41 ff d7             	call   *%r15
+  802a75:	85 c0                	test   %eax,%eax
+  802a77:	0f 85 c9 00 00 00    	jne    802b46 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a7d:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a80:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a87:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a8d:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a90:	41 39 c4             	cmp    %eax,%r12d
+  802a93:	75 cb                	jne    802a60 <devpipe_read+0x4f>
+  802a95:	48 89 de             	mov    %rbx,%rsi
+  802a98:	4c 89 ef             	mov    %r13,%rdi
+  802a9b:	41 ff d7             	call   *%r15
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	75 be                	jne    802a60 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802aa2:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802aa7:	44 89 e6             	mov    %r12d,%esi
+  802aaa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802aae:	48 b8 cc 05 80 00 00 	movabs $0x8005cc,%rax
+  802ab5:	00 00 00 
+  802ab8:	ff d0                	call   *%rax
+  802aba:	eb a4                	jmp    802a60 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802abc:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802ac0:	48 89 de             	mov    %rbx,%rsi
+  802ac3:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  802aca:	00 00 00 
+  802acd:	ff d0                	call   *%rax
+                return i;
+  802acf:	4c 89 f0             	mov    %r14,%rax
+}
+  802ad2:	48 83 c4 28          	add    $0x28,%rsp
+  802ad6:	5b                   	pop    %rbx
+  802ad7:	41 5c                	pop    %r12
+  802ad9:	41 5d                	pop    %r13
+  802adb:	41 5e                	pop    %r14
+  802add:	41 5f                	pop    %r15
+  802adf:	5d                   	pop    %rbp
+  802ae0:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ae1:	48 63 c8             	movslq %eax,%rcx
+  802ae4:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802aeb:	80 80 80 
+  802aee:	48 89 c8             	mov    %rcx,%rax
+  802af1:	48 f7 e2             	mul    %rdx
+  802af4:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802af8:	48 89 d0             	mov    %rdx,%rax
+  802afb:	48 c1 e0 08          	shl    $0x8,%rax
+  802aff:	48 29 d0             	sub    %rdx,%rax
+  802b02:	48 c1 e0 04          	shl    $0x4,%rax
+  802b06:	48 89 c2             	mov    %rax,%rdx
+  802b09:	48 89 c8             	mov    %rcx,%rax
+  802b0c:	48 29 d0             	sub    %rdx,%rax
+  802b0f:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802b14:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802b18:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802b1c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802b1f:	49 83 c6 01          	add    $0x1,%r14
+  802b23:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802b27:	0f 85 2b ff ff ff    	jne    802a58 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b2d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b31:	48 89 de             	mov    %rbx,%rsi
+  802b34:	48 b8 f1 27 80 00 00 	movabs $0x8027f1,%rax
+  802b3b:	00 00 00 
+  802b3e:	ff d0                	call   *%rax
+    return n;
+  802b40:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b44:	eb 8c                	jmp    802ad2 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b46:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b4b:	eb 85                	jmp    802ad2 <devpipe_read+0xc1>
+
+0000000000802b4d <pipe>:
+pipe(int pfd[2]) {
+  802b4d:	55                   	push   %rbp
+  802b4e:	48 89 e5             	mov    %rsp,%rbp
+  802b51:	41 55                	push   %r13
+  802b53:	41 54                	push   %r12
+  802b55:	53                   	push   %rbx
+  802b56:	48 83 ec 18          	sub    $0x18,%rsp
+  802b5a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b5d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b61:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+  802b6d:	89 c3                	mov    %eax,%ebx
+  802b6f:	85 c0                	test   %eax,%eax
+  802b71:	0f 88 a0 01 00 00    	js     802d17 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b77:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b81:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b85:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b8a:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  802b91:	00 00 00 
+  802b94:	ff d0                	call   *%rax
+  802b96:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b98:	85 c0                	test   %eax,%eax
+  802b9a:	0f 88 77 01 00 00    	js     802d17 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802ba0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802ba4:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  802bab:	00 00 00 
+  802bae:	ff d0                	call   *%rax
+  802bb0:	89 c3                	mov    %eax,%ebx
+  802bb2:	85 c0                	test   %eax,%eax
+  802bb4:	0f 88 43 01 00 00    	js     802cfd <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802bba:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bbf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bc4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802bc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802bcd:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bdb:	85 c0                	test   %eax,%eax
+  802bdd:	0f 88 1a 01 00 00    	js     802cfd <pipe+0x1b0>
+    va = fd2data(fd0);
+  802be3:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802be7:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+  802bf3:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bf6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bfb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802c00:	48 89 c6             	mov    %rax,%rsi
+  802c03:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c08:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	89 c3                	mov    %eax,%ebx
+  802c16:	85 c0                	test   %eax,%eax
+  802c18:	0f 88 c5 00 00 00    	js     802ce3 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802c1e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c22:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  802c29:	00 00 00 
+  802c2c:	ff d0                	call   *%rax
+  802c2e:	48 89 c1             	mov    %rax,%rcx
+  802c31:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c37:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c3d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c42:	4c 89 ee             	mov    %r13,%rsi
+  802c45:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4a:	48 b8 b4 02 80 00 00 	movabs $0x8002b4,%rax
+  802c51:	00 00 00 
+  802c54:	ff d0                	call   *%rax
+  802c56:	89 c3                	mov    %eax,%ebx
+  802c58:	85 c0                	test   %eax,%eax
+  802c5a:	78 6e                	js     802cca <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c5c:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c61:	4c 89 ef             	mov    %r13,%rdi
+  802c64:	48 b8 23 02 80 00 00 	movabs $0x800223,%rax
+  802c6b:	00 00 00 
+  802c6e:	ff d0                	call   *%rax
+  802c70:	83 f8 02             	cmp    $0x2,%eax
+  802c73:	0f 85 ab 00 00 00    	jne    802d24 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c79:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c80:	00 00 
+  802c82:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c86:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c88:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c8c:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c93:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c97:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c99:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c9d:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802ca4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ca8:	48 bb 91 06 80 00 00 	movabs $0x800691,%rbx
+  802caf:	00 00 00 
+  802cb2:	ff d3                	call   *%rbx
+  802cb4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802cb8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802cbc:	ff d3                	call   *%rbx
+  802cbe:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802cc3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802cc8:	eb 4d                	jmp    802d17 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802cca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ccf:	4c 89 ee             	mov    %r13,%rsi
+  802cd2:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cd7:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802ce3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ce8:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cec:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cf1:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  802cf8:	00 00 00 
+  802cfb:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cfd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802d02:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802d06:	bf 00 00 00 00       	mov    $0x0,%edi
+  802d0b:	48 b8 04 03 80 00 00 	movabs $0x800304,%rax
+  802d12:	00 00 00 
+  802d15:	ff d0                	call   *%rax
+}
+  802d17:	89 d8                	mov    %ebx,%eax
+  802d19:	48 83 c4 18          	add    $0x18,%rsp
+  802d1d:	5b                   	pop    %rbx
+  802d1e:	41 5c                	pop    %r12
+  802d20:	41 5d                	pop    %r13
+  802d22:	5d                   	pop    %rbp
+  802d23:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802d24:	48 b9 d0 47 80 00 00 	movabs $0x8047d0,%rcx
+  802d2b:	00 00 00 
+  802d2e:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  802d35:	00 00 00 
+  802d38:	be 50 00 00 00       	mov    $0x50,%esi
+  802d3d:	48 bf bc 47 80 00 00 	movabs $0x8047bc,%rdi
+  802d44:	00 00 00 
+  802d47:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d4c:	49 b8 7c 33 80 00 00 	movabs $0x80337c,%r8
+  802d53:	00 00 00 
+  802d56:	41 ff d0             	call   *%r8
+
+0000000000802d59 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d59:	55                   	push   %rbp
+  802d5a:	48 89 e5             	mov    %rsp,%rbp
+  802d5d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d61:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d65:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  802d6c:	00 00 00 
+  802d6f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d71:	85 c0                	test   %eax,%eax
+  802d73:	78 23                	js     802d98 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d75:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d79:	48 b8 a3 06 80 00 00 	movabs $0x8006a3,%rax
+  802d80:	00 00 00 
+  802d83:	ff d0                	call   *%rax
+  802d85:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d88:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d8c:	48 b8 94 28 80 00 00 	movabs $0x802894,%rax
+  802d93:	00 00 00 
+  802d96:	ff d0                	call   *%rax
+}
+  802d98:	c9                   	leave
+  802d99:	c3                   	ret
+
+0000000000802d9a <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d9a:	48 89 f8             	mov    %rdi,%rax
+  802d9d:	48 c1 e8 27          	shr    $0x27,%rax
+  802da1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802da8:	01 00 00 
+  802dab:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802daf:	f6 c2 01             	test   $0x1,%dl
+  802db2:	74 6d                	je     802e21 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802db4:	48 89 f8             	mov    %rdi,%rax
+  802db7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802dbb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dc2:	01 00 00 
+  802dc5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dc9:	f6 c2 01             	test   $0x1,%dl
+  802dcc:	74 62                	je     802e30 <get_uvpt_entry+0x96>
+  802dce:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dd5:	01 00 00 
+  802dd8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802ddc:	f6 c2 80             	test   $0x80,%dl
+  802ddf:	75 4f                	jne    802e30 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802de1:	48 89 f8             	mov    %rdi,%rax
+  802de4:	48 c1 e8 15          	shr    $0x15,%rax
+  802de8:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802def:	01 00 00 
+  802df2:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802df6:	f6 c2 01             	test   $0x1,%dl
+  802df9:	74 44                	je     802e3f <get_uvpt_entry+0xa5>
+  802dfb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e02:	01 00 00 
+  802e05:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802e09:	f6 c2 80             	test   $0x80,%dl
+  802e0c:	75 31                	jne    802e3f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802e0e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802e12:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802e19:	01 00 00 
+  802e1c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802e20:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802e21:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e28:	01 00 00 
+  802e2b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e2f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e30:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e37:	01 00 00 
+  802e3a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e3e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e3f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e46:	01 00 00 
+  802e49:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e4d:	c3                   	ret
+
+0000000000802e4e <get_prot>:
+
+int
+get_prot(void *va) {
+  802e4e:	55                   	push   %rbp
+  802e4f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e52:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  802e59:	00 00 00 
+  802e5c:	ff d0                	call   *%rax
+  802e5e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e61:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e66:	89 c1                	mov    %eax,%ecx
+  802e68:	83 c9 04             	or     $0x4,%ecx
+  802e6b:	f6 c2 01             	test   $0x1,%dl
+  802e6e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e71:	89 c1                	mov    %eax,%ecx
+  802e73:	83 c9 02             	or     $0x2,%ecx
+  802e76:	f6 c2 02             	test   $0x2,%dl
+  802e79:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e7c:	89 c1                	mov    %eax,%ecx
+  802e7e:	83 c9 01             	or     $0x1,%ecx
+  802e81:	48 85 d2             	test   %rdx,%rdx
+  802e84:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e87:	89 c1                	mov    %eax,%ecx
+  802e89:	83 c9 40             	or     $0x40,%ecx
+  802e8c:	f6 c6 04             	test   $0x4,%dh
+  802e8f:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e92:	5d                   	pop    %rbp
+  802e93:	c3                   	ret
+
+0000000000802e94 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e94:	55                   	push   %rbp
+  802e95:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e98:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  802e9f:	00 00 00 
+  802ea2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802ea4:	48 c1 e8 06          	shr    $0x6,%rax
+  802ea8:	83 e0 01             	and    $0x1,%eax
+}
+  802eab:	5d                   	pop    %rbp
+  802eac:	c3                   	ret
+
+0000000000802ead <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802ead:	55                   	push   %rbp
+  802eae:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802eb1:	48 b8 9a 2d 80 00 00 	movabs $0x802d9a,%rax
+  802eb8:	00 00 00 
+  802ebb:	ff d0                	call   *%rax
+  802ebd:	83 e0 01             	and    $0x1,%eax
+}
+  802ec0:	5d                   	pop    %rbp
+  802ec1:	c3                   	ret
+
+0000000000802ec2 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802ec2:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ec9:	01 00 00 
+  802ecc:	a8 01                	test   $0x1,%al
+  802ece:	75 06                	jne    802ed6 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ed0:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ed5:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802ed6:	55                   	push   %rbp
+  802ed7:	48 89 e5             	mov    %rsp,%rbp
+  802eda:	41 57                	push   %r15
+  802edc:	41 56                	push   %r14
+  802ede:	41 55                	push   %r13
+  802ee0:	41 54                	push   %r12
+  802ee2:	53                   	push   %rbx
+  802ee3:	48 83 ec 28          	sub    $0x28,%rsp
+  802ee7:	49 89 fe             	mov    %rdi,%r14
+  802eea:	49 89 f7             	mov    %rsi,%r15
+  802eed:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ef4:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ef5:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802efc:	01 00 00 
+  802eff:	e9 ae 00 00 00       	jmp    802fb2 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f04:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802f0b:	49 83 ec 01          	sub    $0x1,%r12
+  802f0f:	74 2d                	je     802f3e <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802f11:	48 89 d8             	mov    %rbx,%rax
+  802f14:	48 c1 e8 0c          	shr    $0xc,%rax
+  802f18:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802f1d:	f6 c2 01             	test   $0x1,%dl
+  802f20:	74 e2                	je     802f04 <foreach_shared_region+0x42>
+  802f22:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802f27:	f6 c4 04             	test   $0x4,%ah
+  802f2a:	74 d8                	je     802f04 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f2c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f33:	4c 89 fa             	mov    %r15,%rdx
+  802f36:	48 89 df             	mov    %rbx,%rdi
+  802f39:	41 ff d6             	call   *%r14
+  802f3c:	eb c6                	jmp    802f04 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f3e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f45:	00 
+  802f46:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f4b:	74 4a                	je     802f97 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f4d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f51:	48 c1 e8 15          	shr    $0x15,%rax
+  802f55:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f5c:	01 00 00 
+  802f5f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f63:	a8 01                	test   $0x1,%al
+  802f65:	74 d7                	je     802f3e <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f67:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f6b:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f72:	48 39 c3             	cmp    %rax,%rbx
+  802f75:	73 c7                	jae    802f3e <foreach_shared_region+0x7c>
+  802f77:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f7e:	48 39 d0             	cmp    %rdx,%rax
+  802f81:	4d 19 e4             	sbb    %r12,%r12
+  802f84:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f8b:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f92:	e9 7a ff ff ff       	jmp    802f11 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f97:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f9e:	40 
+  802f9f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fa3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802faa:	00 00 00 
+  802fad:	48 39 c1             	cmp    %rax,%rcx
+  802fb0:	74 50                	je     803002 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802fb2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802fb6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802fba:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802fc1:	01 00 00 
+  802fc4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fc8:	a8 01                	test   $0x1,%al
+  802fca:	74 cb                	je     802f97 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fcc:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fd0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802fd7:	48 39 c1             	cmp    %rax,%rcx
+  802fda:	73 bb                	jae    802f97 <foreach_shared_region+0xd5>
+  802fdc:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fe3:	48 39 d0             	cmp    %rdx,%rax
+  802fe6:	48 19 c0             	sbb    %rax,%rax
+  802fe9:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fef:	48 05 00 02 00 00    	add    $0x200,%rax
+  802ff5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802ff9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802ffd:	e9 4b ff ff ff       	jmp    802f4d <foreach_shared_region+0x8b>
+  803002:	b8 00 00 00 00       	mov    $0x0,%eax
+  803007:	48 83 c4 28          	add    $0x28,%rsp
+  80300b:	5b                   	pop    %rbx
+  80300c:	41 5c                	pop    %r12
+  80300e:	41 5d                	pop    %r13
+  803010:	41 5e                	pop    %r14
+  803012:	41 5f                	pop    %r15
+  803014:	5d                   	pop    %rbp
+  803015:	c3                   	ret
+
+0000000000803016 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  803016:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80301c:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  803023:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80302a:	c3                   	ret
+
+000000000080302b <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80302b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80302e:	8b 17                	mov    (%rdi),%edx
+  803030:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803032:	83 f8 0f             	cmp    $0xf,%eax
+  803035:	77 13                	ja     80304a <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  803037:	8b 47 40             	mov    0x40(%rdi),%eax
+  80303a:	83 e0 0f             	and    $0xf,%eax
+  80303d:	48 c1 e0 09          	shl    $0x9,%rax
+  803041:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803048:	00 
+  803049:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80304a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80304f:	c3                   	ret
+
+0000000000803050 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803050:	8b 47 40             	mov    0x40(%rdi),%eax
+  803053:	83 c0 01             	add    $0x1,%eax
+  803056:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803059:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80305f:	8b 57 04             	mov    0x4(%rdi),%edx
+  803062:	b8 00 00 00 00       	mov    $0x0,%eax
+  803067:	85 d2                	test   %edx,%edx
+  803069:	75 04                	jne    80306f <chan_publish+0x1f>
+  80306b:	83 e0 01             	and    $0x1,%eax
+}
+  80306e:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80306f:	87 47 04             	xchg   %eax,0x4(%rdi)
+  803072:	85 c0                	test   %eax,%eax
+  803074:	0f 95 c0             	setne  %al
+  803077:	0f b6 c0             	movzbl %al,%eax
+  80307a:	eb ef                	jmp    80306b <chan_publish+0x1b>
+
+000000000080307c <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80307c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80307f:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803081:	29 d0                	sub    %edx,%eax
+  803083:	83 e8 01             	sub    $0x1,%eax
+  803086:	83 f8 0f             	cmp    $0xf,%eax
+  803089:	77 12                	ja     80309d <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80308b:	8b 07                	mov    (%rdi),%eax
+  80308d:	83 e0 0f             	and    $0xf,%eax
+  803090:	48 c1 e0 09          	shl    $0x9,%rax
+  803094:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80309b:	00 
+  80309c:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80309d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030a2:	c3                   	ret
+
+00000000008030a3 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8030a3:	8b 07                	mov    (%rdi),%eax
+  8030a5:	83 c0 01             	add    $0x1,%eax
+  8030a8:	89 07                	mov    %eax,(%rdi)
+}
+  8030aa:	c3                   	ret
+
+00000000008030ab <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8030ab:	55                   	push   %rbp
+  8030ac:	48 89 e5             	mov    %rsp,%rbp
+  8030af:	53                   	push   %rbx
+  8030b0:	48 83 ec 08          	sub    $0x8,%rsp
+  8030b4:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8030b7:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8030be:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8030c4:	48 b8 7c 30 80 00 00 	movabs $0x80307c,%rax
+  8030cb:	00 00 00 
+  8030ce:	ff d0                	call   *%rax
+  8030d0:	48 85 c0             	test   %rax,%rax
+  8030d3:	74 12                	je     8030e7 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030d5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030e1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030e5:	c9                   	leave
+  8030e6:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030e7:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030ec:	eb f3                	jmp    8030e1 <chan_arm+0x36>
+
+00000000008030ee <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030ee:	55                   	push   %rbp
+  8030ef:	48 89 e5             	mov    %rsp,%rbp
+  8030f2:	41 56                	push   %r14
+  8030f4:	41 55                	push   %r13
+  8030f6:	41 54                	push   %r12
+  8030f8:	53                   	push   %rbx
+  8030f9:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030fc:	49 bc ab 30 80 00 00 	movabs $0x8030ab,%r12
+  803103:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803106:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80310a:	49 bd cc 05 80 00 00 	movabs $0x8005cc,%r13
+  803111:	00 00 00 
+    while (chan_arm(r))
+  803114:	eb 0d                	jmp    803123 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  803116:	8b 33                	mov    (%rbx),%esi
+  803118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80311d:	4c 89 f7             	mov    %r14,%rdi
+  803120:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  803123:	48 89 df             	mov    %rbx,%rdi
+  803126:	41 ff d4             	call   *%r12
+  803129:	84 c0                	test   %al,%al
+  80312b:	75 e9                	jne    803116 <chan_wait+0x28>
+}
+  80312d:	5b                   	pop    %rbx
+  80312e:	41 5c                	pop    %r12
+  803130:	41 5d                	pop    %r13
+  803132:	41 5e                	pop    %r14
+  803134:	5d                   	pop    %rbp
+  803135:	c3                   	ret
+
+0000000000803136 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  803136:	55                   	push   %rbp
+  803137:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80313a:	48 83 c7 40          	add    $0x40,%rdi
+  80313e:	be 01 00 00 00       	mov    $0x1,%esi
+  803143:	48 b8 ea 05 80 00 00 	movabs $0x8005ea,%rax
+  80314a:	00 00 00 
+  80314d:	ff d0                	call   *%rax
+}
+  80314f:	5d                   	pop    %rbp
+  803150:	c3                   	ret
+
+0000000000803151 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803151:	b8 00 00 00 00       	mov    $0x0,%eax
+  803156:	c3                   	ret
+
+0000000000803157 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  803157:	55                   	push   %rbp
+  803158:	48 89 e5             	mov    %rsp,%rbp
+  80315b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80315e:	48 be f4 47 80 00 00 	movabs $0x8047f4,%rsi
+  803165:	00 00 00 
+  803168:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  80316f:	00 00 00 
+  803172:	ff d0                	call   *%rax
+    return 0;
+}
+  803174:	b8 00 00 00 00       	mov    $0x0,%eax
+  803179:	5d                   	pop    %rbp
+  80317a:	c3                   	ret
+
+000000000080317b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80317b:	55                   	push   %rbp
+  80317c:	48 89 e5             	mov    %rsp,%rbp
+  80317f:	41 57                	push   %r15
+  803181:	41 56                	push   %r14
+  803183:	41 55                	push   %r13
+  803185:	41 54                	push   %r12
+  803187:	53                   	push   %rbx
+  803188:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80318f:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  803196:	48 85 d2             	test   %rdx,%rdx
+  803199:	74 7a                	je     803215 <devcons_write+0x9a>
+  80319b:	49 89 d6             	mov    %rdx,%r14
+  80319e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031a4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8031a9:	49 bf eb 3f 80 00 00 	movabs $0x803feb,%r15
+  8031b0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8031b3:	4c 89 f3             	mov    %r14,%rbx
+  8031b6:	48 29 f3             	sub    %rsi,%rbx
+  8031b9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8031be:	48 39 c3             	cmp    %rax,%rbx
+  8031c1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8031c5:	4c 63 eb             	movslq %ebx,%r13
+  8031c8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031cf:	48 01 c6             	add    %rax,%rsi
+  8031d2:	4c 89 ea             	mov    %r13,%rdx
+  8031d5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031dc:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031df:	4c 89 ee             	mov    %r13,%rsi
+  8031e2:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031e9:	48 b8 26 01 80 00 00 	movabs $0x800126,%rax
+  8031f0:	00 00 00 
+  8031f3:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031f5:	41 01 dc             	add    %ebx,%r12d
+  8031f8:	49 63 f4             	movslq %r12d,%rsi
+  8031fb:	4c 39 f6             	cmp    %r14,%rsi
+  8031fe:	72 b3                	jb     8031b3 <devcons_write+0x38>
+    return res;
+  803200:	49 63 c4             	movslq %r12d,%rax
+}
+  803203:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80320a:	5b                   	pop    %rbx
+  80320b:	41 5c                	pop    %r12
+  80320d:	41 5d                	pop    %r13
+  80320f:	41 5e                	pop    %r14
+  803211:	41 5f                	pop    %r15
+  803213:	5d                   	pop    %rbp
+  803214:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  803215:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80321b:	eb e3                	jmp    803200 <devcons_write+0x85>
+
+000000000080321d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80321d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  803220:	ba 00 00 00 00       	mov    $0x0,%edx
+  803225:	48 85 c0             	test   %rax,%rax
+  803228:	74 55                	je     80327f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80322a:	55                   	push   %rbp
+  80322b:	48 89 e5             	mov    %rsp,%rbp
+  80322e:	41 55                	push   %r13
+  803230:	41 54                	push   %r12
+  803232:	53                   	push   %rbx
+  803233:	48 83 ec 08          	sub    $0x8,%rsp
+  803237:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80323a:	48 bb 45 01 80 00 00 	movabs $0x800145,%rbx
+  803241:	00 00 00 
+  803244:	49 bc fa 01 80 00 00 	movabs $0x8001fa,%r12
+  80324b:	00 00 00 
+  80324e:	eb 03                	jmp    803253 <devcons_read+0x36>
+  803250:	41 ff d4             	call   *%r12
+  803253:	ff d3                	call   *%rbx
+  803255:	85 c0                	test   %eax,%eax
+  803257:	74 f7                	je     803250 <devcons_read+0x33>
+    if (c < 0) return c;
+  803259:	48 63 d0             	movslq %eax,%rdx
+  80325c:	78 13                	js     803271 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80325e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803263:	83 f8 04             	cmp    $0x4,%eax
+  803266:	74 09                	je     803271 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803268:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80326c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803271:	48 89 d0             	mov    %rdx,%rax
+  803274:	48 83 c4 08          	add    $0x8,%rsp
+  803278:	5b                   	pop    %rbx
+  803279:	41 5c                	pop    %r12
+  80327b:	41 5d                	pop    %r13
+  80327d:	5d                   	pop    %rbp
+  80327e:	c3                   	ret
+  80327f:	48 89 d0             	mov    %rdx,%rax
+  803282:	c3                   	ret
+
+0000000000803283 <cputchar>:
+cputchar(int ch) {
+  803283:	55                   	push   %rbp
+  803284:	48 89 e5             	mov    %rsp,%rbp
+  803287:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80328b:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80328f:	be 01 00 00 00       	mov    $0x1,%esi
+  803294:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803298:	48 b8 26 01 80 00 00 	movabs $0x800126,%rax
+  80329f:	00 00 00 
+  8032a2:	ff d0                	call   *%rax
+}
+  8032a4:	c9                   	leave
+  8032a5:	c3                   	ret
+
+00000000008032a6 <getchar>:
+getchar(void) {
+  8032a6:	55                   	push   %rbp
+  8032a7:	48 89 e5             	mov    %rsp,%rbp
+  8032aa:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8032ae:	ba 01 00 00 00       	mov    $0x1,%edx
+  8032b3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8032b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032bc:	48 b8 02 0a 80 00 00 	movabs $0x800a02,%rax
+  8032c3:	00 00 00 
+  8032c6:	ff d0                	call   *%rax
+  8032c8:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	78 06                	js     8032d4 <getchar+0x2e>
+  8032ce:	74 08                	je     8032d8 <getchar+0x32>
+  8032d0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032d4:	89 d0                	mov    %edx,%eax
+  8032d6:	c9                   	leave
+  8032d7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032d8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032dd:	eb f5                	jmp    8032d4 <getchar+0x2e>
+
+00000000008032df <iscons>:
+iscons(int fdnum) {
+  8032df:	55                   	push   %rbp
+  8032e0:	48 89 e5             	mov    %rsp,%rbp
+  8032e3:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032e7:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032eb:	48 b8 1f 07 80 00 00 	movabs $0x80071f,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	78 18                	js     803313 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032fb:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032ff:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  803306:	00 00 00 
+  803309:	8b 00                	mov    (%rax),%eax
+  80330b:	39 02                	cmp    %eax,(%rdx)
+  80330d:	0f 94 c0             	sete   %al
+  803310:	0f b6 c0             	movzbl %al,%eax
+}
+  803313:	c9                   	leave
+  803314:	c3                   	ret
+
+0000000000803315 <opencons>:
+opencons(void) {
+  803315:	55                   	push   %rbp
+  803316:	48 89 e5             	mov    %rsp,%rbp
+  803319:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80331d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  803321:	48 b8 bf 06 80 00 00 	movabs $0x8006bf,%rax
+  803328:	00 00 00 
+  80332b:	ff d0                	call   *%rax
+  80332d:	85 c0                	test   %eax,%eax
+  80332f:	78 49                	js     80337a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803331:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803336:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80333b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80333f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803344:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  80334b:	00 00 00 
+  80334e:	ff d0                	call   *%rax
+  803350:	85 c0                	test   %eax,%eax
+  803352:	78 26                	js     80337a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  803354:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803358:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  80335f:	00 00 
+  803361:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  803363:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803367:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80336e:	48 b8 91 06 80 00 00 	movabs $0x800691,%rax
+  803375:	00 00 00 
+  803378:	ff d0                	call   *%rax
+}
+  80337a:	c9                   	leave
+  80337b:	c3                   	ret
+
+000000000080337c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80337c:	55                   	push   %rbp
+  80337d:	48 89 e5             	mov    %rsp,%rbp
+  803380:	41 56                	push   %r14
+  803382:	41 55                	push   %r13
+  803384:	41 54                	push   %r12
+  803386:	53                   	push   %rbx
+  803387:	48 83 ec 50          	sub    $0x50,%rsp
+  80338b:	49 89 fc             	mov    %rdi,%r12
+  80338e:	41 89 f5             	mov    %esi,%r13d
+  803391:	48 89 d3             	mov    %rdx,%rbx
+  803394:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803398:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80339c:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8033a0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8033a7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8033ab:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8033af:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8033b3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8033b7:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  8033be:	00 00 00 
+  8033c1:	4c 8b 30             	mov    (%rax),%r14
+  8033c4:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  8033cb:	00 00 00 
+  8033ce:	ff d0                	call   *%rax
+  8033d0:	89 c6                	mov    %eax,%esi
+  8033d2:	45 89 e8             	mov    %r13d,%r8d
+  8033d5:	4c 89 e1             	mov    %r12,%rcx
+  8033d8:	4c 89 f2             	mov    %r14,%rdx
+  8033db:	48 bf 00 48 80 00 00 	movabs $0x804800,%rdi
+  8033e2:	00 00 00 
+  8033e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ea:	49 bc cc 34 80 00 00 	movabs $0x8034cc,%r12
+  8033f1:	00 00 00 
+  8033f4:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033f7:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033fb:	48 89 df             	mov    %rbx,%rdi
+  8033fe:	48 b8 68 34 80 00 00 	movabs $0x803468,%rax
+  803405:	00 00 00 
+  803408:	ff d0                	call   *%rax
+    cprintf("\n");
+  80340a:	48 bf 4b 47 80 00 00 	movabs $0x80474b,%rdi
+  803411:	00 00 00 
+  803414:	b8 00 00 00 00       	mov    $0x0,%eax
+  803419:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80341c:	cc                   	int3
+  80341d:	eb fd                	jmp    80341c <_panic+0xa0>
+
+000000000080341f <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80341f:	55                   	push   %rbp
+  803420:	48 89 e5             	mov    %rsp,%rbp
+  803423:	53                   	push   %rbx
+  803424:	48 83 ec 08          	sub    $0x8,%rsp
+  803428:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80342b:	8b 06                	mov    (%rsi),%eax
+  80342d:	8d 50 01             	lea    0x1(%rax),%edx
+  803430:	89 16                	mov    %edx,(%rsi)
+  803432:	48 98                	cltq
+  803434:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803439:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80343f:	74 0a                	je     80344b <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803441:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  803445:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803449:	c9                   	leave
+  80344a:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80344b:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80344f:	be ff 00 00 00       	mov    $0xff,%esi
+  803454:	48 b8 26 01 80 00 00 	movabs $0x800126,%rax
+  80345b:	00 00 00 
+  80345e:	ff d0                	call   *%rax
+        state->offset = 0;
+  803460:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  803466:	eb d9                	jmp    803441 <putch+0x22>
+
+0000000000803468 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803468:	55                   	push   %rbp
+  803469:	48 89 e5             	mov    %rsp,%rbp
+  80346c:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  803473:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  803476:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80347d:	b9 21 00 00 00       	mov    $0x21,%ecx
+  803482:	b8 00 00 00 00       	mov    $0x0,%eax
+  803487:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80348a:	48 89 f1             	mov    %rsi,%rcx
+  80348d:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  803494:	48 bf 1f 34 80 00 00 	movabs $0x80341f,%rdi
+  80349b:	00 00 00 
+  80349e:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  8034a5:	00 00 00 
+  8034a8:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8034aa:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8034b1:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8034b8:	48 b8 26 01 80 00 00 	movabs $0x800126,%rax
+  8034bf:	00 00 00 
+  8034c2:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8034c4:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034ca:	c9                   	leave
+  8034cb:	c3                   	ret
+
+00000000008034cc <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034cc:	55                   	push   %rbp
+  8034cd:	48 89 e5             	mov    %rsp,%rbp
+  8034d0:	48 83 ec 50          	sub    $0x50,%rsp
+  8034d4:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034d8:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034dc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034e0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034e4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034e8:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034ef:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034f7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034fb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034ff:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  803503:	48 b8 68 34 80 00 00 	movabs $0x803468,%rax
+  80350a:	00 00 00 
+  80350d:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80350f:	c9                   	leave
+  803510:	c3                   	ret
+
+0000000000803511 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  803511:	55                   	push   %rbp
+  803512:	48 89 e5             	mov    %rsp,%rbp
+  803515:	41 57                	push   %r15
+  803517:	41 56                	push   %r14
+  803519:	41 55                	push   %r13
+  80351b:	41 54                	push   %r12
+  80351d:	53                   	push   %rbx
+  80351e:	48 83 ec 18          	sub    $0x18,%rsp
+  803522:	49 89 fc             	mov    %rdi,%r12
+  803525:	49 89 f5             	mov    %rsi,%r13
+  803528:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80352c:	8b 45 10             	mov    0x10(%rbp),%eax
+  80352f:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  803532:	41 89 cf             	mov    %ecx,%r15d
+  803535:	4c 39 fa             	cmp    %r15,%rdx
+  803538:	73 5b                	jae    803595 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80353a:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80353e:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  803542:	85 db                	test   %ebx,%ebx
+  803544:	7e 0e                	jle    803554 <print_num+0x43>
+            putch(padc, put_arg);
+  803546:	4c 89 ee             	mov    %r13,%rsi
+  803549:	44 89 f7             	mov    %r14d,%edi
+  80354c:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80354f:	83 eb 01             	sub    $0x1,%ebx
+  803552:	75 f2                	jne    803546 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  803554:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803558:	48 b9 34 48 80 00 00 	movabs $0x804834,%rcx
+  80355f:	00 00 00 
+  803562:	48 b8 23 48 80 00 00 	movabs $0x804823,%rax
+  803569:	00 00 00 
+  80356c:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803570:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803574:	ba 00 00 00 00       	mov    $0x0,%edx
+  803579:	49 f7 f7             	div    %r15
+  80357c:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803580:	4c 89 ee             	mov    %r13,%rsi
+  803583:	41 ff d4             	call   *%r12
+}
+  803586:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80358a:	5b                   	pop    %rbx
+  80358b:	41 5c                	pop    %r12
+  80358d:	41 5d                	pop    %r13
+  80358f:	41 5e                	pop    %r14
+  803591:	41 5f                	pop    %r15
+  803593:	5d                   	pop    %rbp
+  803594:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  803595:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803599:	ba 00 00 00 00       	mov    $0x0,%edx
+  80359e:	49 f7 f7             	div    %r15
+  8035a1:	48 83 ec 08          	sub    $0x8,%rsp
+  8035a5:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8035a9:	52                   	push   %rdx
+  8035aa:	45 0f be c9          	movsbl %r9b,%r9d
+  8035ae:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8035b2:	48 89 c2             	mov    %rax,%rdx
+  8035b5:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  8035bc:	00 00 00 
+  8035bf:	ff d0                	call   *%rax
+  8035c1:	48 83 c4 10          	add    $0x10,%rsp
+  8035c5:	eb 8d                	jmp    803554 <print_num+0x43>
+
+00000000008035c7 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8035c7:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035cb:	48 8b 06             	mov    (%rsi),%rax
+  8035ce:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035d2:	73 0a                	jae    8035de <sprintputch+0x17>
+        *state->start++ = ch;
+  8035d4:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035d8:	48 89 16             	mov    %rdx,(%rsi)
+  8035db:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035de:	c3                   	ret
+
+00000000008035df <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035df:	55                   	push   %rbp
+  8035e0:	48 89 e5             	mov    %rsp,%rbp
+  8035e3:	48 83 ec 50          	sub    $0x50,%rsp
+  8035e7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035eb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035ef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035f3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035fa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035fe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803602:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803606:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80360a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80360e:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+}
+  80361a:	c9                   	leave
+  80361b:	c3                   	ret
+
+000000000080361c <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80361c:	55                   	push   %rbp
+  80361d:	48 89 e5             	mov    %rsp,%rbp
+  803620:	41 57                	push   %r15
+  803622:	41 56                	push   %r14
+  803624:	41 55                	push   %r13
+  803626:	41 54                	push   %r12
+  803628:	53                   	push   %rbx
+  803629:	48 83 ec 38          	sub    $0x38,%rsp
+  80362d:	49 89 fe             	mov    %rdi,%r14
+  803630:	49 89 f5             	mov    %rsi,%r13
+  803633:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  803636:	48 8b 01             	mov    (%rcx),%rax
+  803639:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80363d:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803641:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803645:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803649:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80364d:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803651:	0f b6 3b             	movzbl (%rbx),%edi
+  803654:	40 80 ff 25          	cmp    $0x25,%dil
+  803658:	74 18                	je     803672 <vprintfmt+0x56>
+            if (!ch) return;
+  80365a:	40 84 ff             	test   %dil,%dil
+  80365d:	0f 84 b1 06 00 00    	je     803d14 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  803663:	40 0f b6 ff          	movzbl %dil,%edi
+  803667:	4c 89 ee             	mov    %r13,%rsi
+  80366a:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80366d:	4c 89 e3             	mov    %r12,%rbx
+  803670:	eb db                	jmp    80364d <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  803672:	be 00 00 00 00       	mov    $0x0,%esi
+  803677:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80367b:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803680:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803686:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80368d:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803691:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  803696:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80369b:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80369e:	83 e8 23             	sub    $0x23,%eax
+  8036a1:	3c 57                	cmp    $0x57,%al
+  8036a3:	0f 87 51 06 00 00    	ja     803cfa <vprintfmt+0x6de>
+  8036a9:	0f b6 c0             	movzbl %al,%eax
+  8036ac:	48 b9 e0 49 80 00 00 	movabs $0x8049e0,%rcx
+  8036b3:	00 00 00 
+  8036b6:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8036b9:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8036bc:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8036c0:	eb cf                	jmp    803691 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8036c2:	49 89 dc             	mov    %rbx,%r12
+  8036c5:	be 01 00 00 00       	mov    $0x1,%esi
+  8036ca:	eb c5                	jmp    803691 <vprintfmt+0x75>
+            padc = ch;
+  8036cc:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036d0:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036d3:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036d6:	eb b9                	jmp    803691 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036d8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036db:	83 f8 2f             	cmp    $0x2f,%eax
+  8036de:	77 24                	ja     803704 <vprintfmt+0xe8>
+  8036e0:	89 c1                	mov    %eax,%ecx
+  8036e2:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036e6:	83 c0 08             	add    $0x8,%eax
+  8036e9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036ec:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036ef:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036f2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036f6:	79 99                	jns    803691 <vprintfmt+0x75>
+                width = precision;
+  8036f8:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036fc:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  803702:	eb 8d                	jmp    803691 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  803704:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  803708:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80370c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803710:	eb da                	jmp    8036ec <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  803712:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  803717:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80371b:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  803721:	3c 39                	cmp    $0x39,%al
+  803723:	77 1c                	ja     803741 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  803725:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803729:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80372d:	0f b6 c0             	movzbl %al,%eax
+  803730:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  803735:	0f b6 03             	movzbl (%rbx),%eax
+  803738:	3c 39                	cmp    $0x39,%al
+  80373a:	76 e9                	jbe    803725 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80373c:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80373f:	eb b1                	jmp    8036f2 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803741:	49 89 dc             	mov    %rbx,%r12
+  803744:	eb ac                	jmp    8036f2 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  803746:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803749:	85 c9                	test   %ecx,%ecx
+  80374b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803750:	0f 49 c1             	cmovns %ecx,%eax
+  803753:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  803756:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803759:	e9 33 ff ff ff       	jmp    803691 <vprintfmt+0x75>
+            lflag++;
+  80375e:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803761:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803764:	e9 28 ff ff ff       	jmp    803691 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803769:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80376c:	83 f8 2f             	cmp    $0x2f,%eax
+  80376f:	77 19                	ja     80378a <vprintfmt+0x16e>
+  803771:	89 c2                	mov    %eax,%edx
+  803773:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803777:	83 c0 08             	add    $0x8,%eax
+  80377a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80377d:	8b 3a                	mov    (%rdx),%edi
+  80377f:	4c 89 ee             	mov    %r13,%rsi
+  803782:	41 ff d6             	call   *%r14
+            break;
+  803785:	e9 c3 fe ff ff       	jmp    80364d <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80378a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80378e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803796:	eb e5                	jmp    80377d <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803798:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80379b:	83 f8 2f             	cmp    $0x2f,%eax
+  80379e:	77 5a                	ja     8037fa <vprintfmt+0x1de>
+  8037a0:	89 c2                	mov    %eax,%edx
+  8037a2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8037a6:	83 c0 08             	add    $0x8,%eax
+  8037a9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8037ac:	8b 02                	mov    (%rdx),%eax
+  8037ae:	89 c1                	mov    %eax,%ecx
+  8037b0:	f7 d9                	neg    %ecx
+  8037b2:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8037b5:	83 f9 16             	cmp    $0x16,%ecx
+  8037b8:	7f 4e                	jg     803808 <vprintfmt+0x1ec>
+  8037ba:	48 63 c1             	movslq %ecx,%rax
+  8037bd:	48 ba a0 4c 80 00 00 	movabs $0x804ca0,%rdx
+  8037c4:	00 00 00 
+  8037c7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037cb:	48 85 c0             	test   %rax,%rax
+  8037ce:	74 38                	je     803808 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037d0:	48 89 c1             	mov    %rax,%rcx
+  8037d3:	48 ba b9 47 80 00 00 	movabs $0x8047b9,%rdx
+  8037da:	00 00 00 
+  8037dd:	4c 89 ee             	mov    %r13,%rsi
+  8037e0:	4c 89 f7             	mov    %r14,%rdi
+  8037e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037e8:	49 b8 df 35 80 00 00 	movabs $0x8035df,%r8
+  8037ef:	00 00 00 
+  8037f2:	41 ff d0             	call   *%r8
+  8037f5:	e9 53 fe ff ff       	jmp    80364d <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803802:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803806:	eb a4                	jmp    8037ac <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  803808:	48 ba 4c 48 80 00 00 	movabs $0x80484c,%rdx
+  80380f:	00 00 00 
+  803812:	4c 89 ee             	mov    %r13,%rsi
+  803815:	4c 89 f7             	mov    %r14,%rdi
+  803818:	b8 00 00 00 00       	mov    $0x0,%eax
+  80381d:	49 b8 df 35 80 00 00 	movabs $0x8035df,%r8
+  803824:	00 00 00 
+  803827:	41 ff d0             	call   *%r8
+  80382a:	e9 1e fe ff ff       	jmp    80364d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80382f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803832:	83 f8 2f             	cmp    $0x2f,%eax
+  803835:	77 6c                	ja     8038a3 <vprintfmt+0x287>
+  803837:	89 c2                	mov    %eax,%edx
+  803839:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80383d:	83 c0 08             	add    $0x8,%eax
+  803840:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803843:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  803846:	48 85 d2             	test   %rdx,%rdx
+  803849:	48 b8 45 48 80 00 00 	movabs $0x804845,%rax
+  803850:	00 00 00 
+  803853:	48 0f 45 c2          	cmovne %rdx,%rax
+  803857:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80385b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80385f:	7e 06                	jle    803867 <vprintfmt+0x24b>
+  803861:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  803865:	75 4a                	jne    8038b1 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  803867:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80386b:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80386f:	0f b6 00             	movzbl (%rax),%eax
+  803872:	84 c0                	test   %al,%al
+  803874:	0f 85 9a 00 00 00    	jne    803914 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80387a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80387d:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803881:	85 c0                	test   %eax,%eax
+  803883:	0f 8e c4 fd ff ff    	jle    80364d <vprintfmt+0x31>
+  803889:	4c 89 ee             	mov    %r13,%rsi
+  80388c:	bf 20 00 00 00       	mov    $0x20,%edi
+  803891:	41 ff d6             	call   *%r14
+  803894:	41 83 ec 01          	sub    $0x1,%r12d
+  803898:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80389c:	75 eb                	jne    803889 <vprintfmt+0x26d>
+  80389e:	e9 aa fd ff ff       	jmp    80364d <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8038a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8038a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8038ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8038af:	eb 92                	jmp    803843 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8038b1:	49 63 f7             	movslq %r15d,%rsi
+  8038b4:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8038b8:	48 b8 ce 3d 80 00 00 	movabs $0x803dce,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+  8038c4:	48 89 c2             	mov    %rax,%rdx
+  8038c7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038ca:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038cc:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038cf:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038d2:	85 c0                	test   %eax,%eax
+  8038d4:	7e 91                	jle    803867 <vprintfmt+0x24b>
+  8038d6:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038db:	4c 89 ee             	mov    %r13,%rsi
+  8038de:	44 89 e7             	mov    %r12d,%edi
+  8038e1:	41 ff d6             	call   *%r14
+  8038e4:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038e8:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038eb:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038ee:	75 eb                	jne    8038db <vprintfmt+0x2bf>
+  8038f0:	e9 72 ff ff ff       	jmp    803867 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038f5:	0f b6 f8             	movzbl %al,%edi
+  8038f8:	4c 89 ee             	mov    %r13,%rsi
+  8038fb:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038fe:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  803902:	49 83 c4 01          	add    $0x1,%r12
+  803906:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80390c:	84 c0                	test   %al,%al
+  80390e:	0f 84 66 ff ff ff    	je     80387a <vprintfmt+0x25e>
+  803914:	45 85 ff             	test   %r15d,%r15d
+  803917:	78 0a                	js     803923 <vprintfmt+0x307>
+  803919:	41 83 ef 01          	sub    $0x1,%r15d
+  80391d:	0f 88 57 ff ff ff    	js     80387a <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  803923:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  803927:	74 cc                	je     8038f5 <vprintfmt+0x2d9>
+  803929:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80392c:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803931:	80 fa 5e             	cmp    $0x5e,%dl
+  803934:	77 c2                	ja     8038f8 <vprintfmt+0x2dc>
+  803936:	eb bd                	jmp    8038f5 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803938:	40 84 f6             	test   %sil,%sil
+  80393b:	75 26                	jne    803963 <vprintfmt+0x347>
+    switch (lflag) {
+  80393d:	85 d2                	test   %edx,%edx
+  80393f:	74 59                	je     80399a <vprintfmt+0x37e>
+  803941:	83 fa 01             	cmp    $0x1,%edx
+  803944:	74 7b                	je     8039c1 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  803946:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803949:	83 f8 2f             	cmp    $0x2f,%eax
+  80394c:	0f 87 96 00 00 00    	ja     8039e8 <vprintfmt+0x3cc>
+  803952:	89 c2                	mov    %eax,%edx
+  803954:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803958:	83 c0 08             	add    $0x8,%eax
+  80395b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80395e:	4c 8b 22             	mov    (%rdx),%r12
+  803961:	eb 17                	jmp    80397a <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  803963:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803966:	83 f8 2f             	cmp    $0x2f,%eax
+  803969:	77 21                	ja     80398c <vprintfmt+0x370>
+  80396b:	89 c2                	mov    %eax,%edx
+  80396d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803971:	83 c0 08             	add    $0x8,%eax
+  803974:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803977:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80397a:	4d 85 e4             	test   %r12,%r12
+  80397d:	78 7a                	js     8039f9 <vprintfmt+0x3dd>
+            num = i;
+  80397f:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  803982:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  803987:	e9 50 02 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80398c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803990:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803994:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803998:	eb dd                	jmp    803977 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80399a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80399d:	83 f8 2f             	cmp    $0x2f,%eax
+  8039a0:	77 11                	ja     8039b3 <vprintfmt+0x397>
+  8039a2:	89 c2                	mov    %eax,%edx
+  8039a4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039a8:	83 c0 08             	add    $0x8,%eax
+  8039ab:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039ae:	4c 63 22             	movslq (%rdx),%r12
+  8039b1:	eb c7                	jmp    80397a <vprintfmt+0x35e>
+  8039b3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039bf:	eb ed                	jmp    8039ae <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8039c1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039c4:	83 f8 2f             	cmp    $0x2f,%eax
+  8039c7:	77 11                	ja     8039da <vprintfmt+0x3be>
+  8039c9:	89 c2                	mov    %eax,%edx
+  8039cb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039cf:	83 c0 08             	add    $0x8,%eax
+  8039d2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039d5:	4c 8b 22             	mov    (%rdx),%r12
+  8039d8:	eb a0                	jmp    80397a <vprintfmt+0x35e>
+  8039da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039e6:	eb ed                	jmp    8039d5 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039e8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039ec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039f0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039f4:	e9 65 ff ff ff       	jmp    80395e <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039f9:	4c 89 ee             	mov    %r13,%rsi
+  8039fc:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  803a01:	41 ff d6             	call   *%r14
+                i = -i;
+  803a04:	49 f7 dc             	neg    %r12
+  803a07:	e9 73 ff ff ff       	jmp    80397f <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  803a0c:	40 84 f6             	test   %sil,%sil
+  803a0f:	75 32                	jne    803a43 <vprintfmt+0x427>
+    switch (lflag) {
+  803a11:	85 d2                	test   %edx,%edx
+  803a13:	74 5d                	je     803a72 <vprintfmt+0x456>
+  803a15:	83 fa 01             	cmp    $0x1,%edx
+  803a18:	0f 84 82 00 00 00    	je     803aa0 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  803a1e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a21:	83 f8 2f             	cmp    $0x2f,%eax
+  803a24:	0f 87 a5 00 00 00    	ja     803acf <vprintfmt+0x4b3>
+  803a2a:	89 c2                	mov    %eax,%edx
+  803a2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a30:	83 c0 08             	add    $0x8,%eax
+  803a33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a36:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a39:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a3e:	e9 99 01 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a43:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a46:	83 f8 2f             	cmp    $0x2f,%eax
+  803a49:	77 19                	ja     803a64 <vprintfmt+0x448>
+  803a4b:	89 c2                	mov    %eax,%edx
+  803a4d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a51:	83 c0 08             	add    $0x8,%eax
+  803a54:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a57:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a5a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a5f:	e9 78 01 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+  803a64:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a68:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a6c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a70:	eb e5                	jmp    803a57 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a75:	83 f8 2f             	cmp    $0x2f,%eax
+  803a78:	77 18                	ja     803a92 <vprintfmt+0x476>
+  803a7a:	89 c2                	mov    %eax,%edx
+  803a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a80:	83 c0 08             	add    $0x8,%eax
+  803a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a86:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a88:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a8d:	e9 4a 01 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+  803a92:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a96:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a9a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a9e:	eb e6                	jmp    803a86 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803aa0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aa3:	83 f8 2f             	cmp    $0x2f,%eax
+  803aa6:	77 19                	ja     803ac1 <vprintfmt+0x4a5>
+  803aa8:	89 c2                	mov    %eax,%edx
+  803aaa:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803aae:	83 c0 08             	add    $0x8,%eax
+  803ab1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ab4:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803ab7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803abc:	e9 1b 01 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+  803ac1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ac5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ac9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803acd:	eb e5                	jmp    803ab4 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803acf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ad3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ad7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803adb:	e9 56 ff ff ff       	jmp    803a36 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ae0:	40 84 f6             	test   %sil,%sil
+  803ae3:	75 2e                	jne    803b13 <vprintfmt+0x4f7>
+    switch (lflag) {
+  803ae5:	85 d2                	test   %edx,%edx
+  803ae7:	74 59                	je     803b42 <vprintfmt+0x526>
+  803ae9:	83 fa 01             	cmp    $0x1,%edx
+  803aec:	74 7f                	je     803b6d <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803af1:	83 f8 2f             	cmp    $0x2f,%eax
+  803af4:	0f 87 9f 00 00 00    	ja     803b99 <vprintfmt+0x57d>
+  803afa:	89 c2                	mov    %eax,%edx
+  803afc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b00:	83 c0 08             	add    $0x8,%eax
+  803b03:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b06:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b09:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803b0e:	e9 c9 00 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803b13:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b16:	83 f8 2f             	cmp    $0x2f,%eax
+  803b19:	77 19                	ja     803b34 <vprintfmt+0x518>
+  803b1b:	89 c2                	mov    %eax,%edx
+  803b1d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b21:	83 c0 08             	add    $0x8,%eax
+  803b24:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b27:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b2a:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b2f:	e9 a8 00 00 00       	jmp    803bdc <vprintfmt+0x5c0>
+  803b34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b40:	eb e5                	jmp    803b27 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b42:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b45:	83 f8 2f             	cmp    $0x2f,%eax
+  803b48:	77 15                	ja     803b5f <vprintfmt+0x543>
+  803b4a:	89 c2                	mov    %eax,%edx
+  803b4c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b50:	83 c0 08             	add    $0x8,%eax
+  803b53:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b56:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b58:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b5d:	eb 7d                	jmp    803bdc <vprintfmt+0x5c0>
+  803b5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6b:	eb e9                	jmp    803b56 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b70:	83 f8 2f             	cmp    $0x2f,%eax
+  803b73:	77 16                	ja     803b8b <vprintfmt+0x56f>
+  803b75:	89 c2                	mov    %eax,%edx
+  803b77:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b7b:	83 c0 08             	add    $0x8,%eax
+  803b7e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b81:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b84:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b89:	eb 51                	jmp    803bdc <vprintfmt+0x5c0>
+  803b8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b97:	eb e8                	jmp    803b81 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ba1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ba5:	e9 5c ff ff ff       	jmp    803b06 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803baa:	4c 89 ee             	mov    %r13,%rsi
+  803bad:	bf 30 00 00 00       	mov    $0x30,%edi
+  803bb2:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803bb5:	4c 89 ee             	mov    %r13,%rsi
+  803bb8:	bf 78 00 00 00       	mov    $0x78,%edi
+  803bbd:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803bc0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803bc3:	83 f8 2f             	cmp    $0x2f,%eax
+  803bc6:	77 47                	ja     803c0f <vprintfmt+0x5f3>
+  803bc8:	89 c2                	mov    %eax,%edx
+  803bca:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803bce:	83 c0 08             	add    $0x8,%eax
+  803bd1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bd4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803bd7:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bdc:	48 83 ec 08          	sub    $0x8,%rsp
+  803be0:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803be4:	0f 94 c0             	sete   %al
+  803be7:	0f b6 c0             	movzbl %al,%eax
+  803bea:	50                   	push   %rax
+  803beb:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bf0:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bf4:	4c 89 ee             	mov    %r13,%rsi
+  803bf7:	4c 89 f7             	mov    %r14,%rdi
+  803bfa:	48 b8 11 35 80 00 00 	movabs $0x803511,%rax
+  803c01:	00 00 00 
+  803c04:	ff d0                	call   *%rax
+            break;
+  803c06:	48 83 c4 10          	add    $0x10,%rsp
+  803c0a:	e9 3e fa ff ff       	jmp    80364d <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803c0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c1b:	eb b7                	jmp    803bd4 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803c1d:	40 84 f6             	test   %sil,%sil
+  803c20:	75 2b                	jne    803c4d <vprintfmt+0x631>
+    switch (lflag) {
+  803c22:	85 d2                	test   %edx,%edx
+  803c24:	74 56                	je     803c7c <vprintfmt+0x660>
+  803c26:	83 fa 01             	cmp    $0x1,%edx
+  803c29:	74 7f                	je     803caa <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c2b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c2e:	83 f8 2f             	cmp    $0x2f,%eax
+  803c31:	0f 87 a2 00 00 00    	ja     803cd9 <vprintfmt+0x6bd>
+  803c37:	89 c2                	mov    %eax,%edx
+  803c39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c3d:	83 c0 08             	add    $0x8,%eax
+  803c40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c43:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c46:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c4b:	eb 8f                	jmp    803bdc <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c50:	83 f8 2f             	cmp    $0x2f,%eax
+  803c53:	77 19                	ja     803c6e <vprintfmt+0x652>
+  803c55:	89 c2                	mov    %eax,%edx
+  803c57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c5b:	83 c0 08             	add    $0x8,%eax
+  803c5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c61:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c64:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c69:	e9 6e ff ff ff       	jmp    803bdc <vprintfmt+0x5c0>
+  803c6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c7a:	eb e5                	jmp    803c61 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c7f:	83 f8 2f             	cmp    $0x2f,%eax
+  803c82:	77 18                	ja     803c9c <vprintfmt+0x680>
+  803c84:	89 c2                	mov    %eax,%edx
+  803c86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c8a:	83 c0 08             	add    $0x8,%eax
+  803c8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c90:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c92:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c97:	e9 40 ff ff ff       	jmp    803bdc <vprintfmt+0x5c0>
+  803c9c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ca0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ca4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ca8:	eb e6                	jmp    803c90 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803caa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803cad:	83 f8 2f             	cmp    $0x2f,%eax
+  803cb0:	77 19                	ja     803ccb <vprintfmt+0x6af>
+  803cb2:	89 c2                	mov    %eax,%edx
+  803cb4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803cb8:	83 c0 08             	add    $0x8,%eax
+  803cbb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803cbe:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803cc1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803cc6:	e9 11 ff ff ff       	jmp    803bdc <vprintfmt+0x5c0>
+  803ccb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ccf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cd7:	eb e5                	jmp    803cbe <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cd9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cdd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803ce1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ce5:	e9 59 ff ff ff       	jmp    803c43 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cea:	4c 89 ee             	mov    %r13,%rsi
+  803ced:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cf2:	41 ff d6             	call   *%r14
+            break;
+  803cf5:	e9 53 f9 ff ff       	jmp    80364d <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cfa:	4c 89 ee             	mov    %r13,%rsi
+  803cfd:	bf 25 00 00 00       	mov    $0x25,%edi
+  803d02:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803d05:	48 83 eb 01          	sub    $0x1,%rbx
+  803d09:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803d0d:	75 f6                	jne    803d05 <vprintfmt+0x6e9>
+  803d0f:	e9 39 f9 ff ff       	jmp    80364d <vprintfmt+0x31>
+}
+  803d14:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803d18:	5b                   	pop    %rbx
+  803d19:	41 5c                	pop    %r12
+  803d1b:	41 5d                	pop    %r13
+  803d1d:	41 5e                	pop    %r14
+  803d1f:	41 5f                	pop    %r15
+  803d21:	5d                   	pop    %rbp
+  803d22:	c3                   	ret
+
+0000000000803d23 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803d23:	55                   	push   %rbp
+  803d24:	48 89 e5             	mov    %rsp,%rbp
+  803d27:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d2b:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d2f:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d34:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d38:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d3f:	48 85 ff             	test   %rdi,%rdi
+  803d42:	74 2b                	je     803d6f <vsnprintf+0x4c>
+  803d44:	48 85 f6             	test   %rsi,%rsi
+  803d47:	74 26                	je     803d6f <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d49:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d4d:	48 bf c7 35 80 00 00 	movabs $0x8035c7,%rdi
+  803d54:	00 00 00 
+  803d57:	48 b8 1c 36 80 00 00 	movabs $0x80361c,%rax
+  803d5e:	00 00 00 
+  803d61:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d63:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d67:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d6a:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d6d:	c9                   	leave
+  803d6e:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d6f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d74:	eb f7                	jmp    803d6d <vsnprintf+0x4a>
+
+0000000000803d76 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d76:	55                   	push   %rbp
+  803d77:	48 89 e5             	mov    %rsp,%rbp
+  803d7a:	48 83 ec 50          	sub    $0x50,%rsp
+  803d7e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d82:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d86:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d8a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d91:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d99:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d9d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803da1:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803da5:	48 b8 23 3d 80 00 00 	movabs $0x803d23,%rax
+  803dac:	00 00 00 
+  803daf:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803db1:	c9                   	leave
+  803db2:	c3                   	ret
+
+0000000000803db3 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803db3:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803db6:	74 10                	je     803dc8 <strlen+0x15>
+    size_t n = 0;
+  803db8:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803dbd:	48 83 c0 01          	add    $0x1,%rax
+  803dc1:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803dc5:	75 f6                	jne    803dbd <strlen+0xa>
+  803dc7:	c3                   	ret
+    size_t n = 0;
+  803dc8:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803dcd:	c3                   	ret
+
+0000000000803dce <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803dce:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803dd1:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dd6:	48 85 f6             	test   %rsi,%rsi
+  803dd9:	74 11                	je     803dec <strnlen+0x1e>
+  803ddb:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803ddf:	74 0c                	je     803ded <strnlen+0x1f>
+  803de1:	48 83 c2 01          	add    $0x1,%rdx
+  803de5:	48 39 d0             	cmp    %rdx,%rax
+  803de8:	75 f1                	jne    803ddb <strnlen+0xd>
+  803dea:	eb 04                	jmp    803df0 <strnlen+0x22>
+  803dec:	c3                   	ret
+  803ded:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803df0:	c3                   	ret
+
+0000000000803df1 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803df1:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803df4:	ba 00 00 00 00       	mov    $0x0,%edx
+  803df9:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dfd:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803e00:	48 83 c2 01          	add    $0x1,%rdx
+  803e04:	84 c9                	test   %cl,%cl
+  803e06:	75 f1                	jne    803df9 <strcpy+0x8>
+        ;
+    return res;
+}
+  803e08:	c3                   	ret
+
+0000000000803e09 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803e09:	55                   	push   %rbp
+  803e0a:	48 89 e5             	mov    %rsp,%rbp
+  803e0d:	41 54                	push   %r12
+  803e0f:	53                   	push   %rbx
+  803e10:	48 89 fb             	mov    %rdi,%rbx
+  803e13:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803e16:	48 b8 b3 3d 80 00 00 	movabs $0x803db3,%rax
+  803e1d:	00 00 00 
+  803e20:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803e22:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803e26:	4c 89 e6             	mov    %r12,%rsi
+  803e29:	48 b8 f1 3d 80 00 00 	movabs $0x803df1,%rax
+  803e30:	00 00 00 
+  803e33:	ff d0                	call   *%rax
+    return dst;
+}
+  803e35:	48 89 d8             	mov    %rbx,%rax
+  803e38:	5b                   	pop    %rbx
+  803e39:	41 5c                	pop    %r12
+  803e3b:	5d                   	pop    %rbp
+  803e3c:	c3                   	ret
+
+0000000000803e3d <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e3d:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e40:	48 85 d2             	test   %rdx,%rdx
+  803e43:	74 1f                	je     803e64 <strncpy+0x27>
+  803e45:	48 01 fa             	add    %rdi,%rdx
+  803e48:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e4b:	48 83 c1 01          	add    $0x1,%rcx
+  803e4f:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e53:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e57:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e5b:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e5f:	48 39 ca             	cmp    %rcx,%rdx
+  803e62:	75 e7                	jne    803e4b <strncpy+0xe>
+    }
+    return ret;
+}
+  803e64:	c3                   	ret
+
+0000000000803e65 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e65:	48 89 f8             	mov    %rdi,%rax
+  803e68:	48 85 d2             	test   %rdx,%rdx
+  803e6b:	74 24                	je     803e91 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e6d:	48 83 ea 01          	sub    $0x1,%rdx
+  803e71:	74 1b                	je     803e8e <strlcpy+0x29>
+  803e73:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e77:	0f b6 16             	movzbl (%rsi),%edx
+  803e7a:	84 d2                	test   %dl,%dl
+  803e7c:	74 10                	je     803e8e <strlcpy+0x29>
+            *dst++ = *src++;
+  803e7e:	48 83 c6 01          	add    $0x1,%rsi
+  803e82:	48 83 c0 01          	add    $0x1,%rax
+  803e86:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e89:	48 39 c8             	cmp    %rcx,%rax
+  803e8c:	75 e9                	jne    803e77 <strlcpy+0x12>
+        *dst = '\0';
+  803e8e:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e91:	48 29 f8             	sub    %rdi,%rax
+}
+  803e94:	c3                   	ret
+
+0000000000803e95 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e95:	0f b6 07             	movzbl (%rdi),%eax
+  803e98:	84 c0                	test   %al,%al
+  803e9a:	74 13                	je     803eaf <strcmp+0x1a>
+  803e9c:	38 06                	cmp    %al,(%rsi)
+  803e9e:	75 0f                	jne    803eaf <strcmp+0x1a>
+  803ea0:	48 83 c7 01          	add    $0x1,%rdi
+  803ea4:	48 83 c6 01          	add    $0x1,%rsi
+  803ea8:	0f b6 07             	movzbl (%rdi),%eax
+  803eab:	84 c0                	test   %al,%al
+  803ead:	75 ed                	jne    803e9c <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803eaf:	0f b6 c0             	movzbl %al,%eax
+  803eb2:	0f b6 16             	movzbl (%rsi),%edx
+  803eb5:	29 d0                	sub    %edx,%eax
+}
+  803eb7:	c3                   	ret
+
+0000000000803eb8 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803eb8:	48 85 d2             	test   %rdx,%rdx
+  803ebb:	74 1f                	je     803edc <strncmp+0x24>
+  803ebd:	0f b6 07             	movzbl (%rdi),%eax
+  803ec0:	84 c0                	test   %al,%al
+  803ec2:	74 1e                	je     803ee2 <strncmp+0x2a>
+  803ec4:	3a 06                	cmp    (%rsi),%al
+  803ec6:	75 1a                	jne    803ee2 <strncmp+0x2a>
+  803ec8:	48 83 c7 01          	add    $0x1,%rdi
+  803ecc:	48 83 c6 01          	add    $0x1,%rsi
+  803ed0:	48 83 ea 01          	sub    $0x1,%rdx
+  803ed4:	75 e7                	jne    803ebd <strncmp+0x5>
+
+    if (!n) return 0;
+  803ed6:	b8 00 00 00 00       	mov    $0x0,%eax
+  803edb:	c3                   	ret
+  803edc:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee1:	c3                   	ret
+  803ee2:	48 85 d2             	test   %rdx,%rdx
+  803ee5:	74 09                	je     803ef0 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ee7:	0f b6 07             	movzbl (%rdi),%eax
+  803eea:	0f b6 16             	movzbl (%rsi),%edx
+  803eed:	29 d0                	sub    %edx,%eax
+  803eef:	c3                   	ret
+    if (!n) return 0;
+  803ef0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ef5:	c3                   	ret
+
+0000000000803ef6 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ef6:	0f b6 17             	movzbl (%rdi),%edx
+  803ef9:	84 d2                	test   %dl,%dl
+  803efb:	74 18                	je     803f15 <strchr+0x1f>
+        if (*str == c) {
+  803efd:	0f be d2             	movsbl %dl,%edx
+  803f00:	39 f2                	cmp    %esi,%edx
+  803f02:	74 17                	je     803f1b <strchr+0x25>
+    for (; *str; str++) {
+  803f04:	48 83 c7 01          	add    $0x1,%rdi
+  803f08:	0f b6 17             	movzbl (%rdi),%edx
+  803f0b:	84 d2                	test   %dl,%dl
+  803f0d:	75 ee                	jne    803efd <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803f0f:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f14:	c3                   	ret
+  803f15:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f1a:	c3                   	ret
+  803f1b:	48 89 f8             	mov    %rdi,%rax
+}
+  803f1e:	c3                   	ret
+
+0000000000803f1f <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803f1f:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803f22:	0f b6 17             	movzbl (%rdi),%edx
+  803f25:	84 d2                	test   %dl,%dl
+  803f27:	74 13                	je     803f3c <strfind+0x1d>
+  803f29:	0f be d2             	movsbl %dl,%edx
+  803f2c:	39 f2                	cmp    %esi,%edx
+  803f2e:	74 0b                	je     803f3b <strfind+0x1c>
+  803f30:	48 83 c0 01          	add    $0x1,%rax
+  803f34:	0f b6 10             	movzbl (%rax),%edx
+  803f37:	84 d2                	test   %dl,%dl
+  803f39:	75 ee                	jne    803f29 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f3b:	c3                   	ret
+  803f3c:	c3                   	ret
+
+0000000000803f3d <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f3d:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f40:	48 89 f8             	mov    %rdi,%rax
+  803f43:	48 f7 d8             	neg    %rax
+  803f46:	83 e0 07             	and    $0x7,%eax
+  803f49:	49 89 d1             	mov    %rdx,%r9
+  803f4c:	49 29 c1             	sub    %rax,%r9
+  803f4f:	78 36                	js     803f87 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f51:	40 0f b6 c6          	movzbl %sil,%eax
+  803f55:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f5c:	01 01 01 
+  803f5f:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f63:	40 f6 c7 07          	test   $0x7,%dil
+  803f67:	75 38                	jne    803fa1 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f69:	4c 89 c9             	mov    %r9,%rcx
+  803f6c:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f70:	74 0c                	je     803f7e <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f72:	fc                   	cld
+  803f73:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f76:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f7a:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f7e:	4d 85 c9             	test   %r9,%r9
+  803f81:	75 45                	jne    803fc8 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f83:	4c 89 c0             	mov    %r8,%rax
+  803f86:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f87:	48 85 d2             	test   %rdx,%rdx
+  803f8a:	74 f7                	je     803f83 <memset+0x46>
+  803f8c:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f8f:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f92:	48 83 c0 01          	add    $0x1,%rax
+  803f96:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f9a:	48 39 c2             	cmp    %rax,%rdx
+  803f9d:	75 f3                	jne    803f92 <memset+0x55>
+  803f9f:	eb e2                	jmp    803f83 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803fa1:	40 f6 c7 01          	test   $0x1,%dil
+  803fa5:	74 06                	je     803fad <memset+0x70>
+  803fa7:	88 07                	mov    %al,(%rdi)
+  803fa9:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fad:	40 f6 c7 02          	test   $0x2,%dil
+  803fb1:	74 07                	je     803fba <memset+0x7d>
+  803fb3:	66 89 07             	mov    %ax,(%rdi)
+  803fb6:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fba:	40 f6 c7 04          	test   $0x4,%dil
+  803fbe:	74 a9                	je     803f69 <memset+0x2c>
+  803fc0:	89 07                	mov    %eax,(%rdi)
+  803fc2:	48 83 c7 04          	add    $0x4,%rdi
+  803fc6:	eb a1                	jmp    803f69 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fc8:	41 f6 c1 04          	test   $0x4,%r9b
+  803fcc:	74 06                	je     803fd4 <memset+0x97>
+  803fce:	89 07                	mov    %eax,(%rdi)
+  803fd0:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fd4:	41 f6 c1 02          	test   $0x2,%r9b
+  803fd8:	74 07                	je     803fe1 <memset+0xa4>
+  803fda:	66 89 07             	mov    %ax,(%rdi)
+  803fdd:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fe1:	41 f6 c1 01          	test   $0x1,%r9b
+  803fe5:	74 9c                	je     803f83 <memset+0x46>
+  803fe7:	88 07                	mov    %al,(%rdi)
+  803fe9:	eb 98                	jmp    803f83 <memset+0x46>
+
+0000000000803feb <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803feb:	48 89 f8             	mov    %rdi,%rax
+  803fee:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803ff1:	48 39 fe             	cmp    %rdi,%rsi
+  803ff4:	73 3b                	jae    804031 <memmove+0x46>
+  803ff6:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803ffa:	48 39 d7             	cmp    %rdx,%rdi
+  803ffd:	73 32                	jae    804031 <memmove+0x46>
+        s += n;
+        d += n;
+  803fff:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804003:	48 89 d6             	mov    %rdx,%rsi
+  804006:	48 09 fe             	or     %rdi,%rsi
+  804009:	48 09 ce             	or     %rcx,%rsi
+  80400c:	40 f6 c6 07          	test   $0x7,%sil
+  804010:	75 12                	jne    804024 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  804012:	48 83 ef 08          	sub    $0x8,%rdi
+  804016:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80401a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80401e:	fd                   	std
+  80401f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  804022:	fc                   	cld
+  804023:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  804024:	48 83 ef 01          	sub    $0x1,%rdi
+  804028:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80402c:	fd                   	std
+  80402d:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80402f:	eb f1                	jmp    804022 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804031:	48 89 f2             	mov    %rsi,%rdx
+  804034:	48 09 c2             	or     %rax,%rdx
+  804037:	48 09 ca             	or     %rcx,%rdx
+  80403a:	f6 c2 07             	test   $0x7,%dl
+  80403d:	75 0c                	jne    80404b <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80403f:	48 c1 e9 03          	shr    $0x3,%rcx
+  804043:	48 89 c7             	mov    %rax,%rdi
+  804046:	fc                   	cld
+  804047:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  80404a:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80404b:	48 89 c7             	mov    %rax,%rdi
+  80404e:	fc                   	cld
+  80404f:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804051:	c3                   	ret
+
+0000000000804052 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  804052:	55                   	push   %rbp
+  804053:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  804056:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  80405d:	00 00 00 
+  804060:	ff d0                	call   *%rax
+}
+  804062:	5d                   	pop    %rbp
+  804063:	c3                   	ret
+
+0000000000804064 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  804064:	55                   	push   %rbp
+  804065:	48 89 e5             	mov    %rsp,%rbp
+  804068:	41 57                	push   %r15
+  80406a:	41 56                	push   %r14
+  80406c:	41 55                	push   %r13
+  80406e:	41 54                	push   %r12
+  804070:	53                   	push   %rbx
+  804071:	48 83 ec 08          	sub    $0x8,%rsp
+  804075:	49 89 fe             	mov    %rdi,%r14
+  804078:	49 89 f7             	mov    %rsi,%r15
+  80407b:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80407e:	48 89 f7             	mov    %rsi,%rdi
+  804081:	48 b8 b3 3d 80 00 00 	movabs $0x803db3,%rax
+  804088:	00 00 00 
+  80408b:	ff d0                	call   *%rax
+  80408d:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804090:	48 89 de             	mov    %rbx,%rsi
+  804093:	4c 89 f7             	mov    %r14,%rdi
+  804096:	48 b8 ce 3d 80 00 00 	movabs $0x803dce,%rax
+  80409d:	00 00 00 
+  8040a0:	ff d0                	call   *%rax
+  8040a2:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040a5:	48 39 c3             	cmp    %rax,%rbx
+  8040a8:	74 36                	je     8040e0 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8040aa:	48 89 d8             	mov    %rbx,%rax
+  8040ad:	4c 29 e8             	sub    %r13,%rax
+  8040b0:	49 39 c4             	cmp    %rax,%r12
+  8040b3:	73 31                	jae    8040e6 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8040b5:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8040ba:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040be:	4c 89 fe             	mov    %r15,%rsi
+  8040c1:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  8040c8:	00 00 00 
+  8040cb:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040cd:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040d1:	48 83 c4 08          	add    $0x8,%rsp
+  8040d5:	5b                   	pop    %rbx
+  8040d6:	41 5c                	pop    %r12
+  8040d8:	41 5d                	pop    %r13
+  8040da:	41 5e                	pop    %r14
+  8040dc:	41 5f                	pop    %r15
+  8040de:	5d                   	pop    %rbp
+  8040df:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040e0:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040e4:	eb eb                	jmp    8040d1 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040e6:	48 83 eb 01          	sub    $0x1,%rbx
+  8040ea:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040ee:	48 89 da             	mov    %rbx,%rdx
+  8040f1:	4c 89 fe             	mov    %r15,%rsi
+  8040f4:	48 b8 52 40 80 00 00 	movabs $0x804052,%rax
+  8040fb:	00 00 00 
+  8040fe:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  804100:	49 01 de             	add    %rbx,%r14
+  804103:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  804108:	eb c3                	jmp    8040cd <strlcat+0x69>
+
+000000000080410a <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80410a:	48 85 d2             	test   %rdx,%rdx
+  80410d:	74 2d                	je     80413c <memcmp+0x32>
+  80410f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  804114:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  804118:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80411d:	44 38 c1             	cmp    %r8b,%cl
+  804120:	75 0f                	jne    804131 <memcmp+0x27>
+    while (n-- > 0) {
+  804122:	48 83 c0 01          	add    $0x1,%rax
+  804126:	48 39 c2             	cmp    %rax,%rdx
+  804129:	75 e9                	jne    804114 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80412b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804130:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804131:	0f b6 c1             	movzbl %cl,%eax
+  804134:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804138:	44 29 c0             	sub    %r8d,%eax
+  80413b:	c3                   	ret
+    return 0;
+  80413c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804141:	c3                   	ret
+
+0000000000804142 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  804142:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  804146:	48 39 c7             	cmp    %rax,%rdi
+  804149:	73 0f                	jae    80415a <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80414b:	40 38 37             	cmp    %sil,(%rdi)
+  80414e:	74 0e                	je     80415e <memfind+0x1c>
+    for (; src < end; src++) {
+  804150:	48 83 c7 01          	add    $0x1,%rdi
+  804154:	48 39 f8             	cmp    %rdi,%rax
+  804157:	75 f2                	jne    80414b <memfind+0x9>
+  804159:	c3                   	ret
+  80415a:	48 89 f8             	mov    %rdi,%rax
+  80415d:	c3                   	ret
+  80415e:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804161:	c3                   	ret
+
+0000000000804162 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  804162:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  804165:	0f b6 37             	movzbl (%rdi),%esi
+  804168:	40 80 fe 20          	cmp    $0x20,%sil
+  80416c:	74 06                	je     804174 <strtol+0x12>
+  80416e:	40 80 fe 09          	cmp    $0x9,%sil
+  804172:	75 13                	jne    804187 <strtol+0x25>
+  804174:	48 83 c7 01          	add    $0x1,%rdi
+  804178:	0f b6 37             	movzbl (%rdi),%esi
+  80417b:	40 80 fe 20          	cmp    $0x20,%sil
+  80417f:	74 f3                	je     804174 <strtol+0x12>
+  804181:	40 80 fe 09          	cmp    $0x9,%sil
+  804185:	74 ed                	je     804174 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  804187:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80418a:	83 e0 fd             	and    $0xfffffffd,%eax
+  80418d:	3c 01                	cmp    $0x1,%al
+  80418f:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  804193:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  804199:	75 0f                	jne    8041aa <strtol+0x48>
+  80419b:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80419e:	74 14                	je     8041b4 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8041a0:	85 d2                	test   %edx,%edx
+  8041a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8041a7:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8041aa:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8041af:	4c 63 ca             	movslq %edx,%r9
+  8041b2:	eb 36                	jmp    8041ea <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8041b4:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8041b8:	74 0f                	je     8041c9 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8041ba:	85 d2                	test   %edx,%edx
+  8041bc:	75 ec                	jne    8041aa <strtol+0x48>
+        s++;
+  8041be:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8041c2:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8041c7:	eb e1                	jmp    8041aa <strtol+0x48>
+        s += 2;
+  8041c9:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041cd:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041d2:	eb d6                	jmp    8041aa <strtol+0x48>
+            dig -= '0';
+  8041d4:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041d7:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041db:	41 39 d0             	cmp    %edx,%r8d
+  8041de:	7d 21                	jge    804201 <strtol+0x9f>
+        val = val * base + dig;
+  8041e0:	49 0f af c1          	imul   %r9,%rax
+  8041e4:	0f b6 c9             	movzbl %cl,%ecx
+  8041e7:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041ea:	48 83 c7 01          	add    $0x1,%rdi
+  8041ee:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041f2:	80 f9 39             	cmp    $0x39,%cl
+  8041f5:	76 dd                	jbe    8041d4 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041f7:	80 f9 7b             	cmp    $0x7b,%cl
+  8041fa:	77 05                	ja     804201 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041fc:	83 e9 57             	sub    $0x57,%ecx
+  8041ff:	eb d6                	jmp    8041d7 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  804201:	4d 85 d2             	test   %r10,%r10
+  804204:	74 03                	je     804209 <strtol+0xa7>
+  804206:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  804209:	48 89 c2             	mov    %rax,%rdx
+  80420c:	48 f7 da             	neg    %rdx
+  80420f:	40 80 fe 2d          	cmp    $0x2d,%sil
+  804213:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  804217:	c3                   	ret
+
+0000000000804218 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804218:	55                   	push   %rbp
+  804219:	48 89 e5             	mov    %rsp,%rbp
+  80421c:	41 56                	push   %r14
+  80421e:	41 55                	push   %r13
+  804220:	41 54                	push   %r12
+  804222:	53                   	push   %rbx
+  804223:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804226:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80422d:	00 00 00 
+  804230:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804234:	74 27                	je     80425d <_handle_vectored_pagefault+0x45>
+  804236:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80423b:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804242:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804245:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804248:	4c 89 e7             	mov    %r12,%rdi
+  80424b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804250:	84 c0                	test   %al,%al
+  804252:	75 45                	jne    804299 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804254:	48 83 c3 01          	add    $0x1,%rbx
+  804258:	49 3b 1e             	cmp    (%r14),%rbx
+  80425b:	72 eb                	jb     804248 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80425d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804264:	00 
+  804265:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80426a:	4d 8b 04 24          	mov    (%r12),%r8
+  80426e:	48 ba 78 4d 80 00 00 	movabs $0x804d78,%rdx
+  804275:	00 00 00 
+  804278:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80427d:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  804284:	00 00 00 
+  804287:	b8 00 00 00 00       	mov    $0x0,%eax
+  80428c:	49 ba 7c 33 80 00 00 	movabs $0x80337c,%r10
+  804293:	00 00 00 
+  804296:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804299:	5b                   	pop    %rbx
+  80429a:	41 5c                	pop    %r12
+  80429c:	41 5d                	pop    %r13
+  80429e:	41 5e                	pop    %r14
+  8042a0:	5d                   	pop    %rbp
+  8042a1:	c3                   	ret
+
+00000000008042a2 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8042a2:	55                   	push   %rbp
+  8042a3:	48 89 e5             	mov    %rsp,%rbp
+  8042a6:	53                   	push   %rbx
+  8042a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8042ab:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8042ae:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8042b5:	00 00 00 
+  8042b8:	80 38 00             	cmpb   $0x0,(%rax)
+  8042bb:	0f 84 84 00 00 00    	je     804345 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c1:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042c8:	00 00 00 
+  8042cb:	48 8b 10             	mov    (%rax),%rdx
+  8042ce:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042d3:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042da:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042dd:	48 85 d2             	test   %rdx,%rdx
+  8042e0:	74 19                	je     8042fb <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042e2:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042e6:	0f 84 e8 00 00 00    	je     8043d4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042ec:	48 83 c0 01          	add    $0x1,%rax
+  8042f0:	48 39 d0             	cmp    %rdx,%rax
+  8042f3:	75 ed                	jne    8042e2 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042f5:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042f9:	74 1c                	je     804317 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042fb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042ff:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804306:	00 00 00 
+  804309:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804310:	00 00 00 
+  804313:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804317:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  80431e:	00 00 00 
+  804321:	ff d0                	call   *%rax
+  804323:	89 c7                	mov    %eax,%edi
+  804325:	48 be 9a 44 80 00 00 	movabs $0x80449a,%rsi
+  80432c:	00 00 00 
+  80432f:	48 b8 1c 04 80 00 00 	movabs $0x80041c,%rax
+  804336:	00 00 00 
+  804339:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80433b:	85 c0                	test   %eax,%eax
+  80433d:	78 68                	js     8043a7 <add_pgfault_handler+0x105>
+    return res;
+}
+  80433f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804343:	c9                   	leave
+  804344:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804345:	48 b8 d1 01 80 00 00 	movabs $0x8001d1,%rax
+  80434c:	00 00 00 
+  80434f:	ff d0                	call   *%rax
+  804351:	89 c7                	mov    %eax,%edi
+  804353:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804358:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80435d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804364:	00 00 00 
+  804367:	48 b8 5e 02 80 00 00 	movabs $0x80025e,%rax
+  80436e:	00 00 00 
+  804371:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804373:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80437a:	00 00 00 
+  80437d:	48 8b 02             	mov    (%rdx),%rax
+  804380:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804384:	48 89 0a             	mov    %rcx,(%rdx)
+  804387:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80438e:	00 00 00 
+  804391:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804395:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80439c:	00 00 00 
+  80439f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8043a2:	e9 70 ff ff ff       	jmp    804317 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8043a7:	89 c1                	mov    %eax,%ecx
+  8043a9:	48 ba b6 4d 80 00 00 	movabs $0x804db6,%rdx
+  8043b0:	00 00 00 
+  8043b3:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8043b8:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  8043bf:	00 00 00 
+  8043c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043c7:	49 b8 7c 33 80 00 00 	movabs $0x80337c,%r8
+  8043ce:	00 00 00 
+  8043d1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043d9:	e9 61 ff ff ff       	jmp    80433f <add_pgfault_handler+0x9d>
+
+00000000008043de <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043de:	55                   	push   %rbp
+  8043df:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043e2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043e9:	00 00 00 
+  8043ec:	80 38 00             	cmpb   $0x0,(%rax)
+  8043ef:	74 33                	je     804424 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f1:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043f8:	00 00 00 
+  8043fb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804400:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804407:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80440a:	48 85 c0             	test   %rax,%rax
+  80440d:	0f 84 85 00 00 00    	je     804498 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804413:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804417:	74 40                	je     804459 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804419:	48 83 c1 01          	add    $0x1,%rcx
+  80441d:	48 39 c1             	cmp    %rax,%rcx
+  804420:	75 f1                	jne    804413 <remove_pgfault_handler+0x35>
+  804422:	eb 74                	jmp    804498 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804424:	48 b9 ce 4d 80 00 00 	movabs $0x804dce,%rcx
+  80442b:	00 00 00 
+  80442e:	48 ba a7 47 80 00 00 	movabs $0x8047a7,%rdx
+  804435:	00 00 00 
+  804438:	be 43 00 00 00       	mov    $0x43,%esi
+  80443d:	48 bf a8 4d 80 00 00 	movabs $0x804da8,%rdi
+  804444:	00 00 00 
+  804447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80444c:	49 b8 7c 33 80 00 00 	movabs $0x80337c,%r8
+  804453:	00 00 00 
+  804456:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804459:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804460:	00 
+  804461:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804465:	48 29 ca             	sub    %rcx,%rdx
+  804468:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80446f:	00 00 00 
+  804472:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804476:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80447b:	48 89 ce             	mov    %rcx,%rsi
+  80447e:	48 b8 eb 3f 80 00 00 	movabs $0x803feb,%rax
+  804485:	00 00 00 
+  804488:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80448a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804491:	00 00 00 
+  804494:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804498:	5d                   	pop    %rbp
+  804499:	c3                   	ret
+
+000000000080449a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80449a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80449d:	48 b8 18 42 80 00 00 	movabs $0x804218,%rax
+  8044a4:	00 00 00 
+    call *%rax
+  8044a7:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8044a9:	41 5f                	pop    %r15
+	popq %r15
+  8044ab:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8044ad:	41 5f                	pop    %r15
+	popq %r14
+  8044af:	41 5e                	pop    %r14
+	popq %r13
+  8044b1:	41 5d                	pop    %r13
+	popq %r12
+  8044b3:	41 5c                	pop    %r12
+	popq %r11
+  8044b5:	41 5b                	pop    %r11
+	popq %r10
+  8044b7:	41 5a                	pop    %r10
+	popq %r9
+  8044b9:	41 59                	pop    %r9
+	popq %r8
+  8044bb:	41 58                	pop    %r8
+	popq %rsi
+  8044bd:	5e                   	pop    %rsi
+	popq %rdi
+  8044be:	5f                   	pop    %rdi
+	popq %rbp
+  8044bf:	5d                   	pop    %rbp
+	popq %rdx
+  8044c0:	5a                   	pop    %rdx
+	popq %rcx
+  8044c1:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8044c2:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8044c7:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044cc:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044d0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044d3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044d8:	5b                   	pop    %rbx
+	popq %rax
+  8044d9:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044da:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044de:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044df:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044e4:	c3                   	ret
+
+00000000008044e5 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044e5:	55                   	push   %rbp
+  8044e6:	48 89 e5             	mov    %rsp,%rbp
+  8044e9:	41 55                	push   %r13
+  8044eb:	41 54                	push   %r12
+  8044ed:	53                   	push   %rbx
+  8044ee:	48 83 ec 08          	sub    $0x8,%rsp
+  8044f2:	49 89 fd             	mov    %rdi,%r13
+  8044f5:	48 89 f7             	mov    %rsi,%rdi
+  8044f8:	48 89 d3             	mov    %rdx,%rbx
+  8044fb:	49 89 cc             	mov    %rcx,%r12
+  8044fe:	4c 89 c2             	mov    %r8,%rdx
+  804501:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804504:	48 85 f6             	test   %rsi,%rsi
+  804507:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80450e:	00 00 00 
+  804511:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804515:	be 00 10 00 00       	mov    $0x1000,%esi
+  80451a:	48 85 db             	test   %rbx,%rbx
+  80451d:	74 03                	je     804522 <ipc_recv_futex+0x3d>
+  80451f:	48 8b 33             	mov    (%rbx),%rsi
+  804522:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804526:	48 b8 a8 04 80 00 00 	movabs $0x8004a8,%rax
+  80452d:	00 00 00 
+  804530:	ff d0                	call   *%rax
+    if (res < 0) {
+  804532:	85 c0                	test   %eax,%eax
+  804534:	78 75                	js     8045ab <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804536:	4d 85 ed             	test   %r13,%r13
+  804539:	74 14                	je     80454f <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80453b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804542:	00 00 00 
+  804545:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80454b:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80454f:	4d 85 e4             	test   %r12,%r12
+  804552:	74 14                	je     804568 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804554:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80455b:	00 00 00 
+  80455e:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804564:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804568:	48 85 db             	test   %rbx,%rbx
+  80456b:	74 23                	je     804590 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80456d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804574:	00 00 00 
+  804577:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80457d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804582:	85 c9                	test   %ecx,%ecx
+  804584:	74 07                	je     80458d <ipc_recv_futex+0xa8>
+  804586:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80458d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804590:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804597:	00 00 00 
+  80459a:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8045a0:	48 83 c4 08          	add    $0x8,%rsp
+  8045a4:	5b                   	pop    %rbx
+  8045a5:	41 5c                	pop    %r12
+  8045a7:	41 5d                	pop    %r13
+  8045a9:	5d                   	pop    %rbp
+  8045aa:	c3                   	ret
+        if (from_env_store != NULL) {
+  8045ab:	4d 85 ed             	test   %r13,%r13
+  8045ae:	74 08                	je     8045b8 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8045b0:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8045b7:	00 
+        if (perm_store != NULL) {
+  8045b8:	4d 85 e4             	test   %r12,%r12
+  8045bb:	74 08                	je     8045c5 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8045bd:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8045c4:	00 
+        if (size != NULL) {
+  8045c5:	48 85 db             	test   %rbx,%rbx
+  8045c8:	74 d6                	je     8045a0 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045ca:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045d1:	eb cd                	jmp    8045a0 <ipc_recv_futex+0xbb>
+
+00000000008045d3 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045d3:	55                   	push   %rbp
+  8045d4:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8045db:	6a 00                	push   $0x0
+  8045dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045e3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045e9:	48 b8 e5 44 80 00 00 	movabs $0x8044e5,%rax
+  8045f0:	00 00 00 
+  8045f3:	ff d0                	call   *%rax
+}
+  8045f5:	c9                   	leave
+  8045f6:	c3                   	ret
+
+00000000008045f7 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045f7:	55                   	push   %rbp
+  8045f8:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045fb:	48 85 d2             	test   %rdx,%rdx
+  8045fe:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804605:	00 00 00 
+  804608:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80460c:	89 f6                	mov    %esi,%esi
+  80460e:	48 b8 91 04 80 00 00 	movabs $0x800491,%rax
+  804615:	00 00 00 
+  804618:	ff d0                	call   *%rax
+    if (res < 0) {
+  80461a:	85 c0                	test   %eax,%eax
+  80461c:	78 02                	js     804620 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80461e:	5d                   	pop    %rbp
+  80461f:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804620:	89 c1                	mov    %eax,%ecx
+  804622:	48 ba e8 4d 80 00 00 	movabs $0x804de8,%rdx
+  804629:	00 00 00 
+  80462c:	be 50 00 00 00       	mov    $0x50,%esi
+  804631:	48 bf fc 4d 80 00 00 	movabs $0x804dfc,%rdi
+  804638:	00 00 00 
+  80463b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804640:	49 b8 7c 33 80 00 00 	movabs $0x80337c,%r8
+  804647:	00 00 00 
+  80464a:	41 ff d0             	call   *%r8
+
+000000000080464d <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80464d:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804652:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804659:	00 00 00 
+  80465c:	48 89 d0             	mov    %rdx,%rax
+  80465f:	48 c1 e0 04          	shl    $0x4,%rax
+  804663:	48 29 d0             	sub    %rdx,%rax
+  804666:	48 c1 e0 05          	shl    $0x5,%rax
+  80466a:	48 01 c8             	add    %rcx,%rax
+  80466d:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804673:	39 f8                	cmp    %edi,%eax
+  804675:	74 13                	je     80468a <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804677:	48 83 c2 01          	add    $0x1,%rdx
+  80467b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804682:	75 d8                	jne    80465c <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804684:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804689:	c3                   	ret
+            return envs[i].env_id;
+  80468a:	48 89 d0             	mov    %rdx,%rax
+  80468d:	48 c1 e0 04          	shl    $0x4,%rax
+  804691:	48 29 d0             	sub    %rdx,%rax
+  804694:	48 c1 e0 05          	shl    $0x5,%rax
+  804698:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80469f:	00 00 00 
+  8046a2:	48 01 d0             	add    %rdx,%rax
+  8046a5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8046ab:	c3                   	ret
+  8046ac:	0f 1f 40 00          	nopl   0x0(%rax)
+
+00000000008046b0 <__rodata_start>:
+  8046b0:	69 64 6c 65 00 3c 75 	imul   $0x6e753c00,0x65(%rsp,%rbp,2),%esp
+  8046b7:	6e 
+  8046b8:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046bc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046bd:	3e 00 90 73 79 73 63 	ds add %dl,0x63737973(%rax)
+  8046c4:	61                   	(bad)
+  8046c5:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c6:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c7:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab47 <__bss_end+0x721c8b47>
+  8046cd:	65 74 75             	gs je  804745 <__rodata_start+0x95>
+  8046d0:	72 6e                	jb     804740 <__rodata_start+0x90>
+  8046d2:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab54 <__bss_end+0x281c8b54>
+  8046d9:	28 
+  8046da:	3e 20 30             	ds and %dh,(%rax)
+  8046dd:	29 00                	sub    %eax,(%rax)
+  8046df:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e0:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046e7:	61                   	(bad)
+  8046e8:	6c                   	insb   (%dx),%es:(%rdi)
+  8046e9:	6c                   	insb   (%dx),%es:(%rdi)
+  8046ea:	2e 63 00             	cs movsxd (%rax),%eax
+  8046ed:	0f 1f 00             	nopl   (%rax)
+  8046f0:	5b                   	pop    %rbx
+  8046f1:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046f6:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046f9:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046fd:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046fe:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  804702:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  804709:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 805174 <__ctors_end+0x94>
+  804710:	5b                   	pop    %rbx
+  804711:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804716:	20 66 74             	and    %ah,0x74(%rsi)
+  804719:	72 75                	jb     804790 <devtab+0x10>
+  80471b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80471c:	63 61 74             	movsxd 0x74(%rcx),%esp
+  80471f:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad678a <__bss_end+0x2d29478a>
+  804726:	20 62 61             	and    %ah,0x61(%rdx)
+  804729:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  80472d:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804731:	5b                   	pop    %rbx
+  804732:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804737:	20 72 65             	and    %dh,0x65(%rdx)
+  80473a:	61                   	(bad)
+  80473b:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad67a6 <__bss_end+0x2d2947a6>
+  804742:	20 62 61             	and    %ah,0x61(%rdx)
+  804745:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804749:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80474d:	5b                   	pop    %rbx
+  80474e:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804753:	20 77 72             	and    %dh,0x72(%rdi)
+  804756:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  80475d:	2d 
+  80475e:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  804763:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  804766:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  80476a:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804771:	00 00 00 
+  804774:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80477b:	00 00 00 
+  80477e:	66 90                	xchg   %ax,%ax
+
+0000000000804780 <devtab>:
+  804780:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804790:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  8047a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8047b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804800:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804810:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804820:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804830:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804840:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804850:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804860:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804870:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804880:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804890:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  8048a0:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  8048b0:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048c0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048d0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048e0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048f0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  804900:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  804910:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804920:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804930:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804940:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804950:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804960:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804970:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804980:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804990:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  8049a0:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  8049b0:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049c0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049d0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049e0:	b9 36 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .6.......<......
+  8049f0:	ea 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804a00:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	fa 3c 80 00 00 00 00 00 d8 36 80 00 00 00 00 00     .<.......6......
+  804a20:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804a30:	cc 36 80 00 00 00 00 00 46 37 80 00 00 00 00 00     .6......F7......
+  804a40:	fa 3c 80 00 00 00 00 00 cc 36 80 00 00 00 00 00     .<.......6......
+  804a50:	12 37 80 00 00 00 00 00 12 37 80 00 00 00 00 00     .7.......7......
+  804a60:	12 37 80 00 00 00 00 00 12 37 80 00 00 00 00 00     .7.......7......
+  804a70:	12 37 80 00 00 00 00 00 12 37 80 00 00 00 00 00     .7.......7......
+  804a80:	12 37 80 00 00 00 00 00 12 37 80 00 00 00 00 00     .7.......7......
+  804a90:	12 37 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .7.......<......
+  804aa0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b70:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	fa 3c 80 00 00 00 00 00 1d 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804bd0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	69 37 80 00 00 00 00 00 38 39 80 00 00 00 00 00     i7......89......
+  804bf0:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804c00:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804c10:	98 37 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .7.......<......
+  804c20:	fa 3c 80 00 00 00 00 00 5e 37 80 00 00 00 00 00     .<......^7......
+  804c30:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	e0 3a 80 00 00 00 00 00 aa 3b 80 00 00 00 00 00     .:.......;......
+  804c50:	fa 3c 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .<.......<......
+  804c60:	2f 38 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     /8.......<......
+  804c70:	0c 3a 80 00 00 00 00 00 fa 3c 80 00 00 00 00 00     .:.......<......
+  804c80:	fa 3c 80 00 00 00 00 00 1d 3c 80 00 00 00 00 00     .<.......<......
+  804c90:	fa 3c 80 00 00 00 00 00 c2 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804ca0 <error_string>:
+	...
+  804ca8:	55 48 80 00 00 00 00 00 67 48 80 00 00 00 00 00     UH......gH......
+  804cb8:	77 48 80 00 00 00 00 00 89 48 80 00 00 00 00 00     wH.......H......
+  804cc8:	97 48 80 00 00 00 00 00 ab 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	c0 48 80 00 00 00 00 00 d3 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	e5 48 80 00 00 00 00 00 f9 48 80 00 00 00 00 00     .H.......H......
+  804cf8:	09 49 80 00 00 00 00 00 1c 49 80 00 00 00 00 00     .I.......I......
+  804d08:	33 49 80 00 00 00 00 00 49 49 80 00 00 00 00 00     3I......II......
+  804d18:	61 49 80 00 00 00 00 00 79 49 80 00 00 00 00 00     aI......yI......
+  804d28:	86 49 80 00 00 00 00 00 58 4d 80 00 00 00 00 00     .I......XM......
+  804d38:	9a 49 80 00 00 00 00 00 b2 49 80 00 00 00 00 00     .I.......I......
+  804d48:	bc 49 80 00 00 00 00 00 c6 49 80 00 00 00 00 00     .I.......I......
+  804d58:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d68:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d78:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d88:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d98:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804da8:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804db8:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804dc8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804dd8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804de8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804df8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804e08:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e18:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e28:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e38:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e48:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e58:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e68:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e78:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e88:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e98:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ea8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804eb8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ec8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ed8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ee8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ef8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f08:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f18:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f28:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f38:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f48:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f58:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f68:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f78:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f88:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f98:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fa8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fc8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fd8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fe8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ff8:	00 00 66 0f 1f 44 00 00                             ..f..D..
@@ -0,0 +1,7893 @@
+
+obj/user/implicitconv:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 05 00 00 00       	call   800028 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <signed_impl_conv>:
+    a = 257;
+    char c = a;
+
+    (void)b;
+    (void)c;
+}
+  800025:	c3                   	ret
+
+0000000000800026 <unsigned_impl_conv>:
+unsigned_impl_conv() {
+    unsigned long long a = 400000000000;
+    unsigned int b = a;
+
+    (void)b;
+}
+  800026:	c3                   	ret
+
+0000000000800027 <umain>:
+
+void
+umain(int argc, char **argv) {
+    signed_impl_conv();
+    unsigned_impl_conv();
+}
+  800027:	c3                   	ret
+
+0000000000800028 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800028:	55                   	push   %rbp
+  800029:	48 89 e5             	mov    %rsp,%rbp
+  80002c:	41 56                	push   %r14
+  80002e:	41 55                	push   %r13
+  800030:	41 54                	push   %r12
+  800032:	53                   	push   %rbx
+  800033:	41 89 fd             	mov    %edi,%r13d
+  800036:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800039:	48 ba e0 50 80 00 00 	movabs $0x8050e0,%rdx
+  800040:	00 00 00 
+  800043:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  80004a:	00 00 00 
+  80004d:	48 39 c2             	cmp    %rax,%rdx
+  800050:	73 17                	jae    800069 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800052:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800055:	49 89 c4             	mov    %rax,%r12
+  800058:	48 83 c3 08          	add    $0x8,%rbx
+  80005c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800061:	ff 53 f8             	call   *-0x8(%rbx)
+  800064:	4c 39 e3             	cmp    %r12,%rbx
+  800067:	72 ef                	jb     800058 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800069:	48 b8 a9 01 80 00 00 	movabs $0x8001a9,%rax
+  800070:	00 00 00 
+  800073:	ff d0                	call   *%rax
+  800075:	89 c2                	mov    %eax,%edx
+  800077:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80007d:	48 89 d0             	mov    %rdx,%rax
+  800080:	48 c1 e0 04          	shl    $0x4,%rax
+  800084:	48 29 d0             	sub    %rdx,%rax
+  800087:	48 c1 e0 05          	shl    $0x5,%rax
+  80008b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800092:	00 00 00 
+  800095:	48 01 d0             	add    %rdx,%rax
+  800098:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80009f:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8000a2:	45 85 ed             	test   %r13d,%r13d
+  8000a5:	7e 0d                	jle    8000b4 <libmain+0x8c>
+  8000a7:	49 8b 06             	mov    (%r14),%rax
+  8000aa:	48 a3 00 50 80 00 00 	movabs %rax,0x805000
+  8000b1:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8000b4:	4c 89 f6             	mov    %r14,%rsi
+  8000b7:	44 89 ef             	mov    %r13d,%edi
+  8000ba:	48 b8 27 00 80 00 00 	movabs $0x800027,%rax
+  8000c1:	00 00 00 
+  8000c4:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8000c6:	48 b8 db 00 80 00 00 	movabs $0x8000db,%rax
+  8000cd:	00 00 00 
+  8000d0:	ff d0                	call   *%rax
+#endif
+}
+  8000d2:	5b                   	pop    %rbx
+  8000d3:	41 5c                	pop    %r12
+  8000d5:	41 5d                	pop    %r13
+  8000d7:	41 5e                	pop    %r14
+  8000d9:	5d                   	pop    %rbp
+  8000da:	c3                   	ret
+
+00000000008000db <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8000db:	55                   	push   %rbp
+  8000dc:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8000df:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  8000e6:	00 00 00 
+  8000e9:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8000eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000f0:	48 b8 46 01 80 00 00 	movabs $0x800146,%rax
+  8000f7:	00 00 00 
+  8000fa:	ff d0                	call   *%rax
+}
+  8000fc:	5d                   	pop    %rbp
+  8000fd:	c3                   	ret
+
+00000000008000fe <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800103:	ba 00 00 00 00       	mov    $0x0,%edx
+  800108:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80010e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800114:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80011a:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80011c:	c3                   	ret
+
+000000000080011d <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80011d:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800122:	bf 00 00 00 00       	mov    $0x0,%edi
+  800127:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80012c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800131:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800137:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800143:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  800145:	c3                   	ret
+
+0000000000800146 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  800146:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800149:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80014e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800153:	ba 00 00 00 00       	mov    $0x0,%edx
+  800158:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80015e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800164:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80016a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80016c:	48 85 c0             	test   %rax,%rax
+  80016f:	7f 01                	jg     800172 <sys_env_destroy+0x2c>
+}
+  800171:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  800172:	55                   	push   %rbp
+  800173:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800176:	49 89 c0             	mov    %rax,%r8
+  800179:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80017e:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800185:	00 00 00 
+  800188:	be 29 00 00 00       	mov    $0x29,%esi
+  80018d:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800194:	00 00 00 
+  800197:	b8 00 00 00 00       	mov    $0x0,%eax
+  80019c:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  8001a3:	00 00 00 
+  8001a6:	41 ff d1             	call   *%r9
+
+00000000008001a9 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001a9:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001ae:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001b3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001bd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001cf:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001d1:	c3                   	ret
+
+00000000008001d2 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001d2:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8001d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001dc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8001e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8001ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8001f8:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8001fa:	c3                   	ret
+
+00000000008001fb <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8001fb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800200:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  800207:	00 00 00 
+  80020a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800210:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800216:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80021c:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80021e:	c3                   	ret
+
+000000000080021f <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80021f:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  800222:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800227:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80022d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800233:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  800235:	c3                   	ret
+
+0000000000800236 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  800236:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800239:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80023e:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800241:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800247:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80024d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80024f:	48 85 c0             	test   %rax,%rax
+  800252:	7f 01                	jg     800255 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  800254:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800259:	49 89 c0             	mov    %rax,%r8
+  80025c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  800261:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800268:	00 00 00 
+  80026b:	be 29 00 00 00       	mov    $0x29,%esi
+  800270:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800277:	00 00 00 
+  80027a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80027f:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  800286:	00 00 00 
+  800289:	41 ff d1             	call   *%r9
+
+000000000080028c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80028c:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80028f:	48 63 d2             	movslq %edx,%rdx
+  800292:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800295:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80029a:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80029d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80029f:	48 85 c0             	test   %rax,%rax
+  8002a2:	7f 01                	jg     8002a5 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8002a4:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8002a5:	55                   	push   %rbp
+  8002a6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8002a9:	49 89 c0             	mov    %rax,%r8
+  8002ac:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8002b1:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8002b8:	00 00 00 
+  8002bb:	be 29 00 00 00       	mov    $0x29,%esi
+  8002c0:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8002c7:	00 00 00 
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cf:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  8002d6:	00 00 00 
+  8002d9:	41 ff d1             	call   *%r9
+
+00000000008002dc <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8002dc:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8002df:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8002e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8002ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8002f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8002f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8002f8:	48 85 c0             	test   %rax,%rax
+  8002fb:	7f 01                	jg     8002fe <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8002fd:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8002fe:	55                   	push   %rbp
+  8002ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800302:	49 89 c0             	mov    %rax,%r8
+  800305:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80030a:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800311:	00 00 00 
+  800314:	be 29 00 00 00       	mov    $0x29,%esi
+  800319:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800320:	00 00 00 
+  800323:	b8 00 00 00 00       	mov    $0x0,%eax
+  800328:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  80032f:	00 00 00 
+  800332:	41 ff d1             	call   *%r9
+
+0000000000800335 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  800335:	48 63 f6             	movslq %esi,%rsi
+  800338:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80033b:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800340:	ba 00 00 00 00       	mov    $0x0,%edx
+  800345:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80034b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800351:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800357:	0f 05                	syscall
+    if (check && ret > 0) {
+  800359:	48 85 c0             	test   %rax,%rax
+  80035c:	7f 01                	jg     80035f <sys_env_set_status+0x2a>
+}
+  80035e:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80035f:	55                   	push   %rbp
+  800360:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800363:	49 89 c0             	mov    %rax,%r8
+  800366:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80036b:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800372:	00 00 00 
+  800375:	be 29 00 00 00       	mov    $0x29,%esi
+  80037a:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800381:	00 00 00 
+  800384:	b8 00 00 00 00       	mov    $0x0,%eax
+  800389:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  800390:	00 00 00 
+  800393:	41 ff d1             	call   *%r9
+
+0000000000800396 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  800396:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800399:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80039e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003a3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8003a9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8003af:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8003b5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8003b7:	48 85 c0             	test   %rax,%rax
+  8003ba:	7f 01                	jg     8003bd <sys_env_set_trapframe+0x27>
+}
+  8003bc:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8003bd:	55                   	push   %rbp
+  8003be:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8003c1:	49 89 c0             	mov    %rax,%r8
+  8003c4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8003c9:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8003d0:	00 00 00 
+  8003d3:	be 29 00 00 00       	mov    $0x29,%esi
+  8003d8:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8003df:	00 00 00 
+  8003e2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003e7:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  8003ee:	00 00 00 
+  8003f1:	41 ff d1             	call   *%r9
+
+00000000008003f4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8003f4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8003f7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8003fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  800401:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800407:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80040d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800413:	0f 05                	syscall
+    if (check && ret > 0) {
+  800415:	48 85 c0             	test   %rax,%rax
+  800418:	7f 01                	jg     80041b <sys_env_set_pgfault_upcall+0x27>
+}
+  80041a:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80041b:	55                   	push   %rbp
+  80041c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80041f:	49 89 c0             	mov    %rax,%r8
+  800422:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  800427:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  80042e:	00 00 00 
+  800431:	be 29 00 00 00       	mov    $0x29,%esi
+  800436:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  80043d:	00 00 00 
+  800440:	b8 00 00 00 00       	mov    $0x0,%eax
+  800445:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  80044c:	00 00 00 
+  80044f:	41 ff d1             	call   *%r9
+
+0000000000800452 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800452:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  800455:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800458:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80045d:	4d 63 c0             	movslq %r8d,%r8
+  800460:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800466:	0f 05                	syscall
+}
+  800468:	c3                   	ret
+
+0000000000800469 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  800469:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80046c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80046f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800474:	4d 63 c0             	movslq %r8d,%r8
+  800477:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80047d:	0f 05                	syscall
+}
+  80047f:	c3                   	ret
+
+0000000000800480 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  800480:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800485:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800488:	45 89 c0             	mov    %r8d,%r8d
+  80048b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800491:	0f 05                	syscall
+    if (check && ret > 0) {
+  800493:	48 85 c0             	test   %rax,%rax
+  800496:	7f 01                	jg     800499 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  800498:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  800499:	55                   	push   %rbp
+  80049a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80049d:	49 89 c0             	mov    %rax,%r8
+  8004a0:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8004a5:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  8004ac:	00 00 00 
+  8004af:	be 29 00 00 00       	mov    $0x29,%esi
+  8004b4:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  8004bb:	00 00 00 
+  8004be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004c3:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  8004ca:	00 00 00 
+  8004cd:	41 ff d1             	call   *%r9
+
+00000000008004d0 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8004d0:	55                   	push   %rbp
+  8004d1:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8004d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8004da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8004df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8004e4:	48 b8 80 04 80 00 00 	movabs $0x800480,%rax
+  8004eb:	00 00 00 
+  8004ee:	ff d0                	call   *%rax
+}
+  8004f0:	5d                   	pop    %rbp
+  8004f1:	c3                   	ret
+
+00000000008004f2 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8004f2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8004f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004fc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800501:	ba 00 00 00 00       	mov    $0x0,%edx
+  800506:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80050c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800512:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800518:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80051a:	c3                   	ret
+
+000000000080051b <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80051b:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800520:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800525:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800530:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800536:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80053c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80053e:	48 85 c0             	test   %rax,%rax
+  800541:	7f 01                	jg     800544 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  800543:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  800544:	55                   	push   %rbp
+  800545:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800548:	49 89 c0             	mov    %rax,%r8
+  80054b:	b9 10 00 00 00       	mov    $0x10,%ecx
+  800550:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800557:	00 00 00 
+  80055a:	be 29 00 00 00       	mov    $0x29,%esi
+  80055f:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800566:	00 00 00 
+  800569:	b8 00 00 00 00       	mov    $0x0,%eax
+  80056e:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  800575:	00 00 00 
+  800578:	41 ff d1             	call   *%r9
+
+000000000080057b <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80057b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  800580:	bf 00 00 00 00       	mov    $0x0,%edi
+  800585:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80058a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80058f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  800595:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80059b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005a1:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8005a3:	c3                   	ret
+
+00000000008005a4 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8005a4:	89 d2                	mov    %edx,%edx
+  8005a6:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8005a8:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ad:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005b3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005bf:	0f 05                	syscall
+}
+  8005c1:	c3                   	ret
+
+00000000008005c2 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8005c2:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005c5:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8005e1:	0f 05                	syscall
+}
+  8005e3:	c3                   	ret
+
+00000000008005e4 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8005e4:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8005e7:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8005ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8005f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8005f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8005fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  800603:	0f 05                	syscall
+}
+  800605:	c3                   	ret
+
+0000000000800606 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  800606:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  800609:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80060e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  800613:	ba 00 00 00 00       	mov    $0x0,%edx
+  800618:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80061e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800624:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80062a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80062c:	48 85 c0             	test   %rax,%rax
+  80062f:	7f 01                	jg     800632 <sys_irq_ack+0x2c>
+}
+  800631:	c3                   	ret
+sys_irq_ack(int irq) {
+  800632:	55                   	push   %rbp
+  800633:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  800636:	49 89 c0             	mov    %rax,%r8
+  800639:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80063e:	48 ba 98 46 80 00 00 	movabs $0x804698,%rdx
+  800645:	00 00 00 
+  800648:	be 29 00 00 00       	mov    $0x29,%esi
+  80064d:	48 bf b7 46 80 00 00 	movabs $0x8046b7,%rdi
+  800654:	00 00 00 
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	49 b9 54 33 80 00 00 	movabs $0x803354,%r9
+  800663:	00 00 00 
+  800666:	41 ff d1             	call   *%r9
+
+0000000000800669 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  800669:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800670:	ff ff ff 
+  800673:	48 01 f8             	add    %rdi,%rax
+  800676:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80067a:	c3                   	ret
+
+000000000080067b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80067b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  800682:	ff ff ff 
+  800685:	48 01 f8             	add    %rdi,%rax
+  800688:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80068c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  800692:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  800696:	c3                   	ret
+
+0000000000800697 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  800697:	55                   	push   %rbp
+  800698:	48 89 e5             	mov    %rsp,%rbp
+  80069b:	41 57                	push   %r15
+  80069d:	41 56                	push   %r14
+  80069f:	41 55                	push   %r13
+  8006a1:	41 54                	push   %r12
+  8006a3:	53                   	push   %rbx
+  8006a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8006a8:	49 89 ff             	mov    %rdi,%r15
+  8006ab:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8006b0:	49 bd 26 2e 80 00 00 	movabs $0x802e26,%r13
+  8006b7:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8006ba:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8006c0:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8006c3:	48 89 df             	mov    %rbx,%rdi
+  8006c6:	41 ff d5             	call   *%r13
+  8006c9:	83 e0 04             	and    $0x4,%eax
+  8006cc:	74 17                	je     8006e5 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8006ce:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8006d5:	4c 39 f3             	cmp    %r14,%rbx
+  8006d8:	75 e6                	jne    8006c0 <fd_alloc+0x29>
+  8006da:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8006e0:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8006e5:	4d 89 27             	mov    %r12,(%r15)
+}
+  8006e8:	48 83 c4 08          	add    $0x8,%rsp
+  8006ec:	5b                   	pop    %rbx
+  8006ed:	41 5c                	pop    %r12
+  8006ef:	41 5d                	pop    %r13
+  8006f1:	41 5e                	pop    %r14
+  8006f3:	41 5f                	pop    %r15
+  8006f5:	5d                   	pop    %rbp
+  8006f6:	c3                   	ret
+
+00000000008006f7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8006f7:	83 ff 1f             	cmp    $0x1f,%edi
+  8006fa:	77 39                	ja     800735 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8006fc:	55                   	push   %rbp
+  8006fd:	48 89 e5             	mov    %rsp,%rbp
+  800700:	41 54                	push   %r12
+  800702:	53                   	push   %rbx
+  800703:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  800706:	48 63 df             	movslq %edi,%rbx
+  800709:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  800710:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  800714:	48 89 df             	mov    %rbx,%rdi
+  800717:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80071e:	00 00 00 
+  800721:	ff d0                	call   *%rax
+  800723:	a8 04                	test   $0x4,%al
+  800725:	74 14                	je     80073b <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  800727:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  80072b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800730:	5b                   	pop    %rbx
+  800731:	41 5c                	pop    %r12
+  800733:	5d                   	pop    %rbp
+  800734:	c3                   	ret
+        return -E_INVAL;
+  800735:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80073a:	c3                   	ret
+        return -E_INVAL;
+  80073b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800740:	eb ee                	jmp    800730 <fd_lookup+0x39>
+
+0000000000800742 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  800742:	55                   	push   %rbp
+  800743:	48 89 e5             	mov    %rsp,%rbp
+  800746:	41 54                	push   %r12
+  800748:	53                   	push   %rbx
+  800749:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80074c:	48 b8 60 47 80 00 00 	movabs $0x804760,%rax
+  800753:	00 00 00 
+  800756:	48 bb 20 50 80 00 00 	movabs $0x805020,%rbx
+  80075d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  800760:	39 3b                	cmp    %edi,(%rbx)
+  800762:	74 47                	je     8007ab <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  800764:	48 83 c0 08          	add    $0x8,%rax
+  800768:	48 8b 18             	mov    (%rax),%rbx
+  80076b:	48 85 db             	test   %rbx,%rbx
+  80076e:	75 f0                	jne    800760 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  800770:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800777:	00 00 00 
+  80077a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800780:	89 fa                	mov    %edi,%edx
+  800782:	48 bf c8 46 80 00 00 	movabs $0x8046c8,%rdi
+  800789:	00 00 00 
+  80078c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800791:	48 b9 a4 34 80 00 00 	movabs $0x8034a4,%rcx
+  800798:	00 00 00 
+  80079b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80079d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8007a2:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8007a6:	5b                   	pop    %rbx
+  8007a7:	41 5c                	pop    %r12
+  8007a9:	5d                   	pop    %rbp
+  8007aa:	c3                   	ret
+            return 0;
+  8007ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b0:	eb f0                	jmp    8007a2 <dev_lookup+0x60>
+
+00000000008007b2 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8007b2:	55                   	push   %rbp
+  8007b3:	48 89 e5             	mov    %rsp,%rbp
+  8007b6:	41 55                	push   %r13
+  8007b8:	41 54                	push   %r12
+  8007ba:	53                   	push   %rbx
+  8007bb:	48 83 ec 18          	sub    $0x18,%rsp
+  8007bf:	48 89 fb             	mov    %rdi,%rbx
+  8007c2:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8007c5:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8007cc:	ff ff ff 
+  8007cf:	48 01 df             	add    %rbx,%rdi
+  8007d2:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8007d6:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8007da:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  8007e1:	00 00 00 
+  8007e4:	ff d0                	call   *%rax
+  8007e6:	41 89 c5             	mov    %eax,%r13d
+  8007e9:	85 c0                	test   %eax,%eax
+  8007eb:	78 06                	js     8007f3 <fd_close+0x41>
+  8007ed:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8007f1:	74 1a                	je     80080d <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8007f3:	45 84 e4             	test   %r12b,%r12b
+  8007f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007fb:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8007ff:	44 89 e8             	mov    %r13d,%eax
+  800802:	48 83 c4 18          	add    $0x18,%rsp
+  800806:	5b                   	pop    %rbx
+  800807:	41 5c                	pop    %r12
+  800809:	41 5d                	pop    %r13
+  80080b:	5d                   	pop    %rbp
+  80080c:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  80080d:	8b 3b                	mov    (%rbx),%edi
+  80080f:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800813:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  80081a:	00 00 00 
+  80081d:	ff d0                	call   *%rax
+  80081f:	41 89 c5             	mov    %eax,%r13d
+  800822:	85 c0                	test   %eax,%eax
+  800824:	78 1b                	js     800841 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  800826:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80082a:	48 8b 40 20          	mov    0x20(%rax),%rax
+  80082e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800834:	48 85 c0             	test   %rax,%rax
+  800837:	74 08                	je     800841 <fd_close+0x8f>
+  800839:	48 89 df             	mov    %rbx,%rdi
+  80083c:	ff d0                	call   *%rax
+  80083e:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  800841:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800846:	48 89 de             	mov    %rbx,%rsi
+  800849:	bf 00 00 00 00       	mov    $0x0,%edi
+  80084e:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  800855:	00 00 00 
+  800858:	ff d0                	call   *%rax
+    return res;
+  80085a:	eb a3                	jmp    8007ff <fd_close+0x4d>
+
+000000000080085c <close>:
+
+int
+close(int fdnum) {
+  80085c:	55                   	push   %rbp
+  80085d:	48 89 e5             	mov    %rsp,%rbp
+  800860:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  800864:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800868:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  80086f:	00 00 00 
+  800872:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800874:	85 c0                	test   %eax,%eax
+  800876:	78 15                	js     80088d <close+0x31>
+
+    return fd_close(fd, 1);
+  800878:	be 01 00 00 00       	mov    $0x1,%esi
+  80087d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800881:	48 b8 b2 07 80 00 00 	movabs $0x8007b2,%rax
+  800888:	00 00 00 
+  80088b:	ff d0                	call   *%rax
+}
+  80088d:	c9                   	leave
+  80088e:	c3                   	ret
+
+000000000080088f <close_all>:
+
+void
+close_all(void) {
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	41 54                	push   %r12
+  800895:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  800896:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80089b:	49 bc 5c 08 80 00 00 	movabs $0x80085c,%r12
+  8008a2:	00 00 00 
+  8008a5:	89 df                	mov    %ebx,%edi
+  8008a7:	41 ff d4             	call   *%r12
+  8008aa:	83 c3 01             	add    $0x1,%ebx
+  8008ad:	83 fb 20             	cmp    $0x20,%ebx
+  8008b0:	75 f3                	jne    8008a5 <close_all+0x16>
+}
+  8008b2:	5b                   	pop    %rbx
+  8008b3:	41 5c                	pop    %r12
+  8008b5:	5d                   	pop    %rbp
+  8008b6:	c3                   	ret
+
+00000000008008b7 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8008b7:	55                   	push   %rbp
+  8008b8:	48 89 e5             	mov    %rsp,%rbp
+  8008bb:	41 57                	push   %r15
+  8008bd:	41 56                	push   %r14
+  8008bf:	41 55                	push   %r13
+  8008c1:	41 54                	push   %r12
+  8008c3:	53                   	push   %rbx
+  8008c4:	48 83 ec 18          	sub    $0x18,%rsp
+  8008c8:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  8008cb:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8008cf:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  8008d6:	00 00 00 
+  8008d9:	ff d0                	call   *%rax
+  8008db:	89 c3                	mov    %eax,%ebx
+  8008dd:	85 c0                	test   %eax,%eax
+  8008df:	0f 88 b8 00 00 00    	js     80099d <dup+0xe6>
+    close(newfdnum);
+  8008e5:	44 89 e7             	mov    %r12d,%edi
+  8008e8:	48 b8 5c 08 80 00 00 	movabs $0x80085c,%rax
+  8008ef:	00 00 00 
+  8008f2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8008f4:	4d 63 ec             	movslq %r12d,%r13
+  8008f7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8008fe:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  800902:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  800906:	4c 89 ff             	mov    %r15,%rdi
+  800909:	49 be 7b 06 80 00 00 	movabs $0x80067b,%r14
+  800910:	00 00 00 
+  800913:	41 ff d6             	call   *%r14
+  800916:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  800919:	4c 89 ef             	mov    %r13,%rdi
+  80091c:	41 ff d6             	call   *%r14
+  80091f:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  800922:	48 89 df             	mov    %rbx,%rdi
+  800925:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80092c:	00 00 00 
+  80092f:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  800931:	a8 04                	test   $0x4,%al
+  800933:	74 2b                	je     800960 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  800935:	41 89 c1             	mov    %eax,%r9d
+  800938:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80093e:	4c 89 f1             	mov    %r14,%rcx
+  800941:	ba 00 00 00 00       	mov    $0x0,%edx
+  800946:	48 89 de             	mov    %rbx,%rsi
+  800949:	bf 00 00 00 00       	mov    $0x0,%edi
+  80094e:	48 b8 8c 02 80 00 00 	movabs $0x80028c,%rax
+  800955:	00 00 00 
+  800958:	ff d0                	call   *%rax
+  80095a:	89 c3                	mov    %eax,%ebx
+  80095c:	85 c0                	test   %eax,%eax
+  80095e:	78 4e                	js     8009ae <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  800960:	4c 89 ff             	mov    %r15,%rdi
+  800963:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  80096a:	00 00 00 
+  80096d:	ff d0                	call   *%rax
+  80096f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  800972:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  800978:	4c 89 e9             	mov    %r13,%rcx
+  80097b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800980:	4c 89 fe             	mov    %r15,%rsi
+  800983:	bf 00 00 00 00       	mov    $0x0,%edi
+  800988:	48 b8 8c 02 80 00 00 	movabs $0x80028c,%rax
+  80098f:	00 00 00 
+  800992:	ff d0                	call   *%rax
+  800994:	89 c3                	mov    %eax,%ebx
+  800996:	85 c0                	test   %eax,%eax
+  800998:	78 14                	js     8009ae <dup+0xf7>
+
+    return newfdnum;
+  80099a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  80099d:	89 d8                	mov    %ebx,%eax
+  80099f:	48 83 c4 18          	add    $0x18,%rsp
+  8009a3:	5b                   	pop    %rbx
+  8009a4:	41 5c                	pop    %r12
+  8009a6:	41 5d                	pop    %r13
+  8009a8:	41 5e                	pop    %r14
+  8009aa:	41 5f                	pop    %r15
+  8009ac:	5d                   	pop    %rbp
+  8009ad:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8009ae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009b3:	4c 89 ee             	mov    %r13,%rsi
+  8009b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009bb:	49 bc dc 02 80 00 00 	movabs $0x8002dc,%r12
+  8009c2:	00 00 00 
+  8009c5:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8009c8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8009cd:	4c 89 f6             	mov    %r14,%rsi
+  8009d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009d5:	41 ff d4             	call   *%r12
+    return res;
+  8009d8:	eb c3                	jmp    80099d <dup+0xe6>
+
+00000000008009da <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  8009da:	55                   	push   %rbp
+  8009db:	48 89 e5             	mov    %rsp,%rbp
+  8009de:	41 56                	push   %r14
+  8009e0:	41 55                	push   %r13
+  8009e2:	41 54                	push   %r12
+  8009e4:	53                   	push   %rbx
+  8009e5:	48 83 ec 10          	sub    $0x10,%rsp
+  8009e9:	89 fb                	mov    %edi,%ebx
+  8009eb:	49 89 f4             	mov    %rsi,%r12
+  8009ee:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8009f1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8009f5:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  8009fc:	00 00 00 
+  8009ff:	ff d0                	call   *%rax
+  800a01:	85 c0                	test   %eax,%eax
+  800a03:	78 4c                	js     800a51 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a05:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800a09:	41 8b 3e             	mov    (%r14),%edi
+  800a0c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800a10:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  800a17:	00 00 00 
+  800a1a:	ff d0                	call   *%rax
+  800a1c:	85 c0                	test   %eax,%eax
+  800a1e:	78 35                	js     800a55 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  800a20:	41 8b 46 08          	mov    0x8(%r14),%eax
+  800a24:	83 e0 03             	and    $0x3,%eax
+  800a27:	83 f8 01             	cmp    $0x1,%eax
+  800a2a:	74 2d                	je     800a59 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800a30:	48 8b 40 10          	mov    0x10(%rax),%rax
+  800a34:	48 85 c0             	test   %rax,%rax
+  800a37:	74 56                	je     800a8f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  800a39:	4c 89 ea             	mov    %r13,%rdx
+  800a3c:	4c 89 e6             	mov    %r12,%rsi
+  800a3f:	4c 89 f7             	mov    %r14,%rdi
+  800a42:	ff d0                	call   *%rax
+}
+  800a44:	48 83 c4 10          	add    $0x10,%rsp
+  800a48:	5b                   	pop    %rbx
+  800a49:	41 5c                	pop    %r12
+  800a4b:	41 5d                	pop    %r13
+  800a4d:	41 5e                	pop    %r14
+  800a4f:	5d                   	pop    %rbp
+  800a50:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800a51:	48 98                	cltq
+  800a53:	eb ef                	jmp    800a44 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800a55:	48 98                	cltq
+  800a57:	eb eb                	jmp    800a44 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  800a59:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800a60:	00 00 00 
+  800a63:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800a69:	89 da                	mov    %ebx,%edx
+  800a6b:	48 bf 09 47 80 00 00 	movabs $0x804709,%rdi
+  800a72:	00 00 00 
+  800a75:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a7a:	48 b9 a4 34 80 00 00 	movabs $0x8034a4,%rcx
+  800a81:	00 00 00 
+  800a84:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800a86:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800a8d:	eb b5                	jmp    800a44 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  800a8f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800a96:	eb ac                	jmp    800a44 <read+0x6a>
+
+0000000000800a98 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  800a98:	55                   	push   %rbp
+  800a99:	48 89 e5             	mov    %rsp,%rbp
+  800a9c:	41 57                	push   %r15
+  800a9e:	41 56                	push   %r14
+  800aa0:	41 55                	push   %r13
+  800aa2:	41 54                	push   %r12
+  800aa4:	53                   	push   %rbx
+  800aa5:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  800aa9:	48 85 d2             	test   %rdx,%rdx
+  800aac:	74 54                	je     800b02 <readn+0x6a>
+  800aae:	41 89 fd             	mov    %edi,%r13d
+  800ab1:	49 89 f6             	mov    %rsi,%r14
+  800ab4:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  800ab7:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  800abc:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  800ac1:	49 bf da 09 80 00 00 	movabs $0x8009da,%r15
+  800ac8:	00 00 00 
+  800acb:	4c 89 e2             	mov    %r12,%rdx
+  800ace:	48 29 f2             	sub    %rsi,%rdx
+  800ad1:	4c 01 f6             	add    %r14,%rsi
+  800ad4:	44 89 ef             	mov    %r13d,%edi
+  800ad7:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  800ada:	85 c0                	test   %eax,%eax
+  800adc:	78 20                	js     800afe <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  800ade:	01 c3                	add    %eax,%ebx
+  800ae0:	85 c0                	test   %eax,%eax
+  800ae2:	74 08                	je     800aec <readn+0x54>
+  800ae4:	48 63 f3             	movslq %ebx,%rsi
+  800ae7:	4c 39 e6             	cmp    %r12,%rsi
+  800aea:	72 df                	jb     800acb <readn+0x33>
+    }
+    return res;
+  800aec:	48 63 c3             	movslq %ebx,%rax
+}
+  800aef:	48 83 c4 08          	add    $0x8,%rsp
+  800af3:	5b                   	pop    %rbx
+  800af4:	41 5c                	pop    %r12
+  800af6:	41 5d                	pop    %r13
+  800af8:	41 5e                	pop    %r14
+  800afa:	41 5f                	pop    %r15
+  800afc:	5d                   	pop    %rbp
+  800afd:	c3                   	ret
+        if (inc < 0) return inc;
+  800afe:	48 98                	cltq
+  800b00:	eb ed                	jmp    800aef <readn+0x57>
+    int inc = 1, res = 0;
+  800b02:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800b07:	eb e3                	jmp    800aec <readn+0x54>
+
+0000000000800b09 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  800b09:	55                   	push   %rbp
+  800b0a:	48 89 e5             	mov    %rsp,%rbp
+  800b0d:	41 56                	push   %r14
+  800b0f:	41 55                	push   %r13
+  800b11:	41 54                	push   %r12
+  800b13:	53                   	push   %rbx
+  800b14:	48 83 ec 10          	sub    $0x10,%rsp
+  800b18:	89 fb                	mov    %edi,%ebx
+  800b1a:	49 89 f4             	mov    %rsi,%r12
+  800b1d:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b20:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800b24:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  800b2b:	00 00 00 
+  800b2e:	ff d0                	call   *%rax
+  800b30:	85 c0                	test   %eax,%eax
+  800b32:	78 47                	js     800b7b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b34:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  800b38:	41 8b 3e             	mov    (%r14),%edi
+  800b3b:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800b3f:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  800b46:	00 00 00 
+  800b49:	ff d0                	call   *%rax
+  800b4b:	85 c0                	test   %eax,%eax
+  800b4d:	78 30                	js     800b7f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800b4f:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  800b54:	74 2d                	je     800b83 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800b56:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800b5a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  800b5e:	48 85 c0             	test   %rax,%rax
+  800b61:	74 56                	je     800bb9 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  800b63:	4c 89 ea             	mov    %r13,%rdx
+  800b66:	4c 89 e6             	mov    %r12,%rsi
+  800b69:	4c 89 f7             	mov    %r14,%rdi
+  800b6c:	ff d0                	call   *%rax
+}
+  800b6e:	48 83 c4 10          	add    $0x10,%rsp
+  800b72:	5b                   	pop    %rbx
+  800b73:	41 5c                	pop    %r12
+  800b75:	41 5d                	pop    %r13
+  800b77:	41 5e                	pop    %r14
+  800b79:	5d                   	pop    %rbp
+  800b7a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800b7b:	48 98                	cltq
+  800b7d:	eb ef                	jmp    800b6e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800b7f:	48 98                	cltq
+  800b81:	eb eb                	jmp    800b6e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  800b83:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800b8a:	00 00 00 
+  800b8d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800b93:	89 da                	mov    %ebx,%edx
+  800b95:	48 bf 25 47 80 00 00 	movabs $0x804725,%rdi
+  800b9c:	00 00 00 
+  800b9f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ba4:	48 b9 a4 34 80 00 00 	movabs $0x8034a4,%rcx
+  800bab:	00 00 00 
+  800bae:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800bb0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  800bb7:	eb b5                	jmp    800b6e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  800bb9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  800bc0:	eb ac                	jmp    800b6e <write+0x65>
+
+0000000000800bc2 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  800bc2:	55                   	push   %rbp
+  800bc3:	48 89 e5             	mov    %rsp,%rbp
+  800bc6:	41 54                	push   %r12
+  800bc8:	53                   	push   %rbx
+  800bc9:	48 83 ec 10          	sub    $0x10,%rsp
+  800bcd:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800bcf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800bd3:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  800bda:	00 00 00 
+  800bdd:	ff d0                	call   *%rax
+  800bdf:	85 c0                	test   %eax,%eax
+  800be1:	78 3e                	js     800c21 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800be3:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800be7:	41 8b 3c 24          	mov    (%r12),%edi
+  800beb:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800bef:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  800bf6:	00 00 00 
+  800bf9:	ff d0                	call   *%rax
+  800bfb:	85 c0                	test   %eax,%eax
+  800bfd:	78 22                	js     800c21 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  800bff:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800c03:	48 8b 40 38          	mov    0x38(%rax),%rax
+  800c07:	48 85 c0             	test   %rax,%rax
+  800c0a:	74 0b                	je     800c17 <seek+0x55>
+  800c0c:	89 de                	mov    %ebx,%esi
+  800c0e:	4c 89 e7             	mov    %r12,%rdi
+  800c11:	ff d0                	call   *%rax
+  800c13:	85 c0                	test   %eax,%eax
+  800c15:	78 0a                	js     800c21 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  800c17:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  800c1c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800c21:	48 83 c4 10          	add    $0x10,%rsp
+  800c25:	5b                   	pop    %rbx
+  800c26:	41 5c                	pop    %r12
+  800c28:	5d                   	pop    %rbp
+  800c29:	c3                   	ret
+
+0000000000800c2a <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  800c2a:	55                   	push   %rbp
+  800c2b:	48 89 e5             	mov    %rsp,%rbp
+  800c2e:	41 55                	push   %r13
+  800c30:	41 54                	push   %r12
+  800c32:	53                   	push   %rbx
+  800c33:	48 83 ec 18          	sub    $0x18,%rsp
+  800c37:	89 fb                	mov    %edi,%ebx
+  800c39:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800c3c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  800c40:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  800c47:	00 00 00 
+  800c4a:	ff d0                	call   *%rax
+  800c4c:	85 c0                	test   %eax,%eax
+  800c4e:	78 38                	js     800c88 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800c50:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  800c54:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  800c58:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  800c5c:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  800c63:	00 00 00 
+  800c66:	ff d0                	call   *%rax
+  800c68:	85 c0                	test   %eax,%eax
+  800c6a:	78 1c                	js     800c88 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  800c6c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  800c71:	74 20                	je     800c93 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800c73:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  800c77:	48 8b 40 30          	mov    0x30(%rax),%rax
+  800c7b:	48 85 c0             	test   %rax,%rax
+  800c7e:	74 47                	je     800cc7 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  800c80:	44 89 e6             	mov    %r12d,%esi
+  800c83:	4c 89 ef             	mov    %r13,%rdi
+  800c86:	ff d0                	call   *%rax
+}
+  800c88:	48 83 c4 18          	add    $0x18,%rsp
+  800c8c:	5b                   	pop    %rbx
+  800c8d:	41 5c                	pop    %r12
+  800c8f:	41 5d                	pop    %r13
+  800c91:	5d                   	pop    %rbp
+  800c92:	c3                   	ret
+                thisenv->env_id, fdnum);
+  800c93:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800c9a:	00 00 00 
+  800c9d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  800ca3:	89 da                	mov    %ebx,%edx
+  800ca5:	48 bf e8 46 80 00 00 	movabs $0x8046e8,%rdi
+  800cac:	00 00 00 
+  800caf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cb4:	48 b9 a4 34 80 00 00 	movabs $0x8034a4,%rcx
+  800cbb:	00 00 00 
+  800cbe:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  800cc0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800cc5:	eb c1                	jmp    800c88 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  800cc7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800ccc:	eb ba                	jmp    800c88 <ftruncate+0x5e>
+
+0000000000800cce <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  800cce:	55                   	push   %rbp
+  800ccf:	48 89 e5             	mov    %rsp,%rbp
+  800cd2:	41 54                	push   %r12
+  800cd4:	53                   	push   %rbx
+  800cd5:	48 83 ec 10          	sub    $0x10,%rsp
+  800cd9:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  800cdc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ce0:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  800ce7:	00 00 00 
+  800cea:	ff d0                	call   *%rax
+  800cec:	85 c0                	test   %eax,%eax
+  800cee:	78 4e                	js     800d3e <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  800cf0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  800cf4:	41 8b 3c 24          	mov    (%r12),%edi
+  800cf8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  800cfc:	48 b8 42 07 80 00 00 	movabs $0x800742,%rax
+  800d03:	00 00 00 
+  800d06:	ff d0                	call   *%rax
+  800d08:	85 c0                	test   %eax,%eax
+  800d0a:	78 32                	js     800d3e <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d0c:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  800d10:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  800d15:	74 30                	je     800d47 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  800d17:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  800d1a:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  800d21:	00 00 00 
+    stat->st_isdir = 0;
+  800d24:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  800d2b:	00 00 00 
+    stat->st_dev = dev;
+  800d2e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  800d35:	48 89 de             	mov    %rbx,%rsi
+  800d38:	4c 89 e7             	mov    %r12,%rdi
+  800d3b:	ff 50 28             	call   *0x28(%rax)
+}
+  800d3e:	48 83 c4 10          	add    $0x10,%rsp
+  800d42:	5b                   	pop    %rbx
+  800d43:	41 5c                	pop    %r12
+  800d45:	5d                   	pop    %rbp
+  800d46:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  800d47:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  800d4c:	eb f0                	jmp    800d3e <fstat+0x70>
+
+0000000000800d4e <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  800d4e:	55                   	push   %rbp
+  800d4f:	48 89 e5             	mov    %rsp,%rbp
+  800d52:	41 54                	push   %r12
+  800d54:	53                   	push   %rbx
+  800d55:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  800d58:	be 00 00 00 00       	mov    $0x0,%esi
+  800d5d:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  800d64:	00 00 00 
+  800d67:	ff d0                	call   *%rax
+  800d69:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  800d6b:	85 c0                	test   %eax,%eax
+  800d6d:	78 25                	js     800d94 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  800d6f:	4c 89 e6             	mov    %r12,%rsi
+  800d72:	89 c7                	mov    %eax,%edi
+  800d74:	48 b8 ce 0c 80 00 00 	movabs $0x800cce,%rax
+  800d7b:	00 00 00 
+  800d7e:	ff d0                	call   *%rax
+  800d80:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  800d83:	89 df                	mov    %ebx,%edi
+  800d85:	48 b8 5c 08 80 00 00 	movabs $0x80085c,%rax
+  800d8c:	00 00 00 
+  800d8f:	ff d0                	call   *%rax
+
+    return res;
+  800d91:	44 89 e3             	mov    %r12d,%ebx
+}
+  800d94:	89 d8                	mov    %ebx,%eax
+  800d96:	5b                   	pop    %rbx
+  800d97:	41 5c                	pop    %r12
+  800d99:	5d                   	pop    %rbp
+  800d9a:	c3                   	ret
+
+0000000000800d9b <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800d9b:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  800da2:	00 00 00 
+  800da5:	83 38 00             	cmpl   $0x0,(%rax)
+  800da8:	74 0a                	je     800db4 <fsenv+0x19>
+    return envid;
+}
+  800daa:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800db1:	00 00 
+  800db3:	c3                   	ret
+fsenv(void) {
+  800db4:	55                   	push   %rbp
+  800db5:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  800db8:	bf 03 00 00 00       	mov    $0x3,%edi
+  800dbd:	48 b8 25 46 80 00 00 	movabs $0x804625,%rax
+  800dc4:	00 00 00 
+  800dc7:	ff d0                	call   *%rax
+  800dc9:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  800dd0:	00 00 
+}
+  800dd2:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  800dd9:	00 00 
+  800ddb:	5d                   	pop    %rbp
+  800ddc:	c3                   	ret
+
+0000000000800ddd <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  800ddd:	55                   	push   %rbp
+  800dde:	48 89 e5             	mov    %rsp,%rbp
+  800de1:	41 54                	push   %r12
+  800de3:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800de4:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800de9:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800dee:	48 89 de             	mov    %rbx,%rsi
+  800df1:	bf 00 00 00 00       	mov    $0x0,%edi
+  800df6:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  800dfd:	00 00 00 
+  800e00:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  800e02:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  800e09:	00 00 00 
+  800e0c:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e12:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800e17:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800e1c:	48 89 de             	mov    %rbx,%rsi
+  800e1f:	bf 00 00 00 00       	mov    $0x0,%edi
+  800e24:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  800e2b:	00 00 00 
+  800e2e:	ff d0                	call   *%rax
+  800e30:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  800e32:	85 c0                	test   %eax,%eax
+  800e34:	0f 88 a2 00 00 00    	js     800edc <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  800e3a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800e41:	00 00 00 
+  800e44:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800e4a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  800e4f:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  800e51:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  800e56:	49 bc ee 2f 80 00 00 	movabs $0x802fee,%r12
+  800e5d:	00 00 00 
+  800e60:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  800e63:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  800e68:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  800e6b:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  800e72:	00 00 00 
+  800e75:	ff d0                	call   *%rax
+  800e77:	89 c7                	mov    %eax,%edi
+  800e79:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  800e7f:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  800e84:	48 89 da             	mov    %rbx,%rdx
+  800e87:	be 09 00 00 00       	mov    $0x9,%esi
+  800e8c:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  800e93:	00 00 00 
+  800e96:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  800e98:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ea2:	be 00 00 00 00       	mov    $0x0,%esi
+  800ea7:	bf 00 00 00 00       	mov    $0x0,%edi
+  800eac:	48 b8 ab 45 80 00 00 	movabs $0x8045ab,%rax
+  800eb3:	00 00 00 
+  800eb6:	ff d0                	call   *%rax
+  800eb8:	89 c3                	mov    %eax,%ebx
+  800eba:	85 c0                	test   %eax,%eax
+  800ebc:	78 25                	js     800ee3 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  800ebe:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800ec5:	00 00 00 
+  800ec8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  800ece:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  800ed5:	00 00 
+    return 0;
+  800ed7:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  800edc:	89 d8                	mov    %ebx,%eax
+  800ede:	5b                   	pop    %rbx
+  800edf:	41 5c                	pop    %r12
+  800ee1:	5d                   	pop    %rbp
+  800ee2:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  800ee3:	ba 00 50 00 00       	mov    $0x5000,%edx
+  800ee8:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  800eed:	bf 00 00 00 00       	mov    $0x0,%edi
+  800ef2:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  800ef9:	00 00 00 
+  800efc:	ff d0                	call   *%rax
+        return res;
+  800efe:	eb dc                	jmp    800edc <fschan_setup+0xff>
+
+0000000000800f00 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  800f00:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f07:	00 00 00 
+  800f0a:	80 38 00             	cmpb   $0x0,(%rax)
+  800f0d:	74 55                	je     800f64 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f0f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  800f16:	00 00 00 
+  800f19:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  800f1f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f24:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  800f2b:	00 00 00 
+  800f2e:	3b 0a                	cmp    (%rdx),%ecx
+  800f30:	75 01                	jne    800f33 <fschan+0x33>
+}
+  800f32:	c3                   	ret
+fschan(void) {
+  800f33:	55                   	push   %rbp
+  800f34:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f37:	48 b8 dd 0d 80 00 00 	movabs $0x800ddd,%rax
+  800f3e:	00 00 00 
+  800f41:	ff d0                	call   *%rax
+  800f43:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  800f45:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  800f4a:	85 d2                	test   %edx,%edx
+  800f4c:	78 02                	js     800f50 <fschan+0x50>
+}
+  800f4e:	5d                   	pop    %rbp
+  800f4f:	c3                   	ret
+        fschan_enabled = 0;
+  800f50:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  800f57:	00 00 00 
+  800f5a:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  800f5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f62:	eb ea                	jmp    800f4e <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  800f64:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f69:	c3                   	ret
+
+0000000000800f6a <fbuf>:
+fbuf(struct Fd *fd) {
+  800f6a:	55                   	push   %rbp
+  800f6b:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  800f6e:	48 b8 69 06 80 00 00 	movabs $0x800669,%rax
+  800f75:	00 00 00 
+  800f78:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  800f7a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f7f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  800f83:	77 12                	ja     800f97 <fbuf+0x2d>
+  800f85:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  800f89:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  800f90:	00 00 00 
+  800f93:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  800f97:	48 89 d0             	mov    %rdx,%rax
+  800f9a:	5d                   	pop    %rbp
+  800f9b:	c3                   	ret
+
+0000000000800f9c <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  800f9c:	55                   	push   %rbp
+  800f9d:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  800fa0:	48 83 c7 40          	add    $0x40,%rdi
+  800fa4:	48 b8 28 30 80 00 00 	movabs $0x803028,%rax
+  800fab:	00 00 00 
+  800fae:	ff d0                	call   *%rax
+  800fb0:	84 c0                	test   %al,%al
+  800fb2:	75 02                	jne    800fb6 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  800fb4:	5d                   	pop    %rbp
+  800fb5:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  800fb6:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  800fbd:	00 00 00 
+  800fc0:	ff d0                	call   *%rax
+  800fc2:	89 c7                	mov    %eax,%edi
+  800fc4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800fca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800fcf:	ba 00 00 00 00       	mov    $0x0,%edx
+  800fd4:	be 0a 00 00 00       	mov    $0xa,%esi
+  800fd9:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  800fe0:	00 00 00 
+  800fe3:	ff d0                	call   *%rax
+}
+  800fe5:	eb cd                	jmp    800fb4 <fschan_publish+0x18>
+
+0000000000800fe7 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  800fe7:	55                   	push   %rbp
+  800fe8:	48 89 e5             	mov    %rsp,%rbp
+  800feb:	41 57                	push   %r15
+  800fed:	41 56                	push   %r14
+  800fef:	41 55                	push   %r13
+  800ff1:	41 54                	push   %r12
+  800ff3:	53                   	push   %rbx
+  800ff4:	48 83 ec 48          	sub    $0x48,%rsp
+  800ff8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  800ffc:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  801000:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  801003:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  801007:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80100a:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  801011:	00 00 00 
+  801014:	8b 02                	mov    (%rdx),%eax
+  801016:	83 c0 01             	add    $0x1,%eax
+  801019:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80101e:	0f 44 c1             	cmove  %ecx,%eax
+  801021:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  801023:	4d 85 c0             	test   %r8,%r8
+  801026:	74 2c                	je     801054 <fschan_rw+0x6d>
+  801028:	45 89 ce             	mov    %r9d,%r14d
+  80102b:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  801032:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  801036:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80103c:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  801043:	00 
+  801044:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80104a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80104f:	e9 41 01 00 00       	jmp    801195 <fschan_rw+0x1ae>
+  801054:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  801058:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80105c:	e9 9c 01 00 00       	jmp    8011fd <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  801061:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  801065:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  801068:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80106b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80106e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  801072:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  801076:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80107a:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80107e:	48 89 da             	mov    %rbx,%rdx
+  801081:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  801088:	00 00 00 
+  80108b:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80108d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  801091:	48 b8 9c 0f 80 00 00 	movabs $0x800f9c,%rax
+  801098:	00 00 00 
+  80109b:	ff d0                	call   *%rax
+            queued += blk;
+  80109d:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8010a0:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8010a4:	4d 39 fc             	cmp    %r15,%r12
+  8010a7:	73 6b                	jae    801114 <fschan_rw+0x12d>
+  8010a9:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8010ad:	77 65                	ja     801114 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8010af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8010b3:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8010b7:	48 b8 03 30 80 00 00 	movabs $0x803003,%rax
+  8010be:	00 00 00 
+  8010c1:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8010c3:	4c 89 fb             	mov    %r15,%rbx
+  8010c6:	4c 29 e3             	sub    %r12,%rbx
+  8010c9:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8010ce:	48 39 d3             	cmp    %rdx,%rbx
+  8010d1:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8010d5:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8010d9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8010dd:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8010e1:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8010e4:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8010e6:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8010ed:	00 00 00 
+  8010f0:	8b 09                	mov    (%rcx),%ecx
+  8010f2:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8010f5:	83 fe 03             	cmp    $0x3,%esi
+  8010f8:	0f 85 63 ff ff ff    	jne    801061 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8010fe:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  801102:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  801105:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  801108:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80110b:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80110f:	e9 79 ff ff ff       	jmp    80108d <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  801114:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801118:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80111f:	48 89 df             	mov    %rbx,%rdi
+  801122:	48 b8 c6 30 80 00 00 	movabs $0x8030c6,%rax
+  801129:	00 00 00 
+  80112c:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80112e:	48 89 df             	mov    %rbx,%rdi
+  801131:	48 b8 54 30 80 00 00 	movabs $0x803054,%rax
+  801138:	00 00 00 
+  80113b:	ff d0                	call   *%rax
+  80113d:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  801141:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  801145:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  801149:	75 25                	jne    801170 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80114b:	8b 40 04             	mov    0x4(%rax),%eax
+  80114e:	85 c0                	test   %eax,%eax
+  801150:	0f 88 86 00 00 00    	js     8011dc <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  801156:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80115a:	74 5b                	je     8011b7 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80115c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  801160:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  801164:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  801168:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80116c:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  801170:	48 89 df             	mov    %rbx,%rdi
+  801173:	48 b8 7b 30 80 00 00 	movabs $0x80307b,%rax
+  80117a:	00 00 00 
+  80117d:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80117f:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  801183:	83 f0 01             	xor    $0x1,%eax
+  801186:	4d 39 fc             	cmp    %r15,%r12
+  801189:	0f 92 c2             	setb   %dl
+  80118c:	84 c2                	test   %al,%dl
+  80118e:	75 05                	jne    801195 <fschan_rw+0x1ae>
+  801190:	45 85 ed             	test   %r13d,%r13d
+  801193:	74 50                	je     8011e5 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  801195:	4d 39 fc             	cmp    %r15,%r12
+  801198:	0f 92 c1             	setb   %cl
+  80119b:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80119f:	0f 96 c2             	setbe  %dl
+  8011a2:	84 d1                	test   %dl,%cl
+  8011a4:	0f 84 6a ff ff ff    	je     801114 <fschan_rw+0x12d>
+  8011aa:	84 c0                	test   %al,%al
+  8011ac:	0f 85 fd fe ff ff    	jne    8010af <fschan_rw+0xc8>
+  8011b2:	e9 5d ff ff ff       	jmp    801114 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8011b7:	48 63 d0             	movslq %eax,%rdx
+  8011ba:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8011be:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8011c2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8011c6:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8011ca:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8011ce:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  8011d5:	00 00 00 
+  8011d8:	ff d0                	call   *%rax
+  8011da:	eb 80                	jmp    80115c <fschan_rw+0x175>
+                err = msg->fm_res;
+  8011dc:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8011df:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8011e3:	eb 8b                	jmp    801170 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8011e5:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8011ea:	0f 85 68 fe ff ff    	jne    801058 <fschan_rw+0x71>
+  8011f0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8011f3:	85 c0                	test   %eax,%eax
+  8011f5:	0f 84 5d fe ff ff    	je     801058 <fschan_rw+0x71>
+  8011fb:	48 98                	cltq
+}
+  8011fd:	48 83 c4 48          	add    $0x48,%rsp
+  801201:	5b                   	pop    %rbx
+  801202:	41 5c                	pop    %r12
+  801204:	41 5d                	pop    %r13
+  801206:	41 5e                	pop    %r14
+  801208:	41 5f                	pop    %r15
+  80120a:	5d                   	pop    %rbp
+  80120b:	c3                   	ret
+
+000000000080120c <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80120c:	55                   	push   %rbp
+  80120d:	48 89 e5             	mov    %rsp,%rbp
+  801210:	41 56                	push   %r14
+  801212:	41 55                	push   %r13
+  801214:	41 54                	push   %r12
+  801216:	53                   	push   %rbx
+  801217:	48 83 ec 10          	sub    $0x10,%rsp
+  80121b:	49 89 fe             	mov    %rdi,%r14
+  80121e:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  801221:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  801225:	48 29 f3             	sub    %rsi,%rbx
+  801228:	48 39 d3             	cmp    %rdx,%rbx
+  80122b:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80122f:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  801236:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  801237:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80123c:	49 bd 85 2e 80 00 00 	movabs $0x802e85,%r13
+  801243:	00 00 00 
+  801246:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80124d:	76 1e                	jbe    80126d <mmap_fault+0x61>
+  80124f:	4c 01 e7             	add    %r12,%rdi
+  801252:	41 ff d5             	call   *%r13
+  801255:	84 c0                	test   %al,%al
+  801257:	75 14                	jne    80126d <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  801259:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80125d:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  801264:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  801268:	48 39 df             	cmp    %rbx,%rdi
+  80126b:	72 e2                	jb     80124f <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80126d:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  801274:	00 00 00 
+  801277:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80127e:	00 00 00 
+  801281:	4c 89 f0             	mov    %r14,%rax
+  801284:	48 29 d0             	sub    %rdx,%rax
+  801287:	48 c1 f8 03          	sar    $0x3,%rax
+  80128b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801292:	aa aa aa 
+  801295:	48 0f af c2          	imul   %rdx,%rax
+  801299:	48 c1 e0 0c          	shl    $0xc,%rax
+  80129d:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8012a2:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8012a6:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8012a8:	44 89 e0             	mov    %r12d,%eax
+  8012ab:	41 03 46 10          	add    0x10(%r14),%eax
+  8012af:	41 2b 06             	sub    (%r14),%eax
+  8012b2:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8012b5:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8012b9:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8012bd:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8012c1:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8012c4:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  8012cb:	00 00 00 
+  8012ce:	ff d0                	call   *%rax
+  8012d0:	89 c7                	mov    %eax,%edi
+  8012d2:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8012d8:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8012dd:	48 89 da             	mov    %rbx,%rdx
+  8012e0:	be 0f 00 00 00       	mov    $0xf,%esi
+  8012e5:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  8012ec:	00 00 00 
+  8012ef:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8012f1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8012f6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8012fa:	4c 89 e6             	mov    %r12,%rsi
+  8012fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801302:	48 b8 ab 45 80 00 00 	movabs $0x8045ab,%rax
+  801309:	00 00 00 
+  80130c:	ff d0                	call   *%rax
+  80130e:	48 98                	cltq
+}
+  801310:	48 83 c4 10          	add    $0x10,%rsp
+  801314:	5b                   	pop    %rbx
+  801315:	41 5c                	pop    %r12
+  801317:	41 5d                	pop    %r13
+  801319:	41 5e                	pop    %r14
+  80131b:	5d                   	pop    %rbp
+  80131c:	c3                   	ret
+
+000000000080131d <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80131d:	48 8b 37             	mov    (%rdi),%rsi
+  801320:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  801327:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80132e:	00 00 00 
+  801331:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801336:	eb 0f                	jmp    801347 <mmap_pgfault+0x2a>
+  801338:	c3                   	ret
+  801339:	48 83 c1 01          	add    $0x1,%rcx
+  80133d:	48 83 c2 18          	add    $0x18,%rdx
+  801341:	48 83 f9 20          	cmp    $0x20,%rcx
+  801345:	74 6e                	je     8013b5 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  801347:	48 8b 02             	mov    (%rdx),%rax
+  80134a:	48 83 e8 01          	sub    $0x1,%rax
+  80134e:	48 39 f0             	cmp    %rsi,%rax
+  801351:	73 e6                	jae    801339 <mmap_pgfault+0x1c>
+  801353:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  801357:	73 e0                	jae    801339 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  801359:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80135d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801362:	f6 c2 01             	test   $0x1,%dl
+  801365:	75 d1                	jne    801338 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  801367:	f6 c2 02             	test   $0x2,%dl
+  80136a:	74 1a                	je     801386 <mmap_pgfault+0x69>
+  80136c:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  801370:	b8 00 00 00 00       	mov    $0x0,%eax
+  801375:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80137c:	00 00 00 
+  80137f:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  801384:	74 35                	je     8013bb <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  801386:	55                   	push   %rbp
+  801387:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80138a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80138e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  801395:	00 00 00 
+  801398:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80139c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8013a1:	48 b8 0c 12 80 00 00 	movabs $0x80120c,%rax
+  8013a8:	00 00 00 
+  8013ab:	ff d0                	call   *%rax
+  8013ad:	48 85 c0             	test   %rax,%rax
+  8013b0:	0f 9f c0             	setg   %al
+}
+  8013b3:	5d                   	pop    %rbp
+  8013b4:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8013b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ba:	c3                   	ret
+}
+  8013bb:	c3                   	ret
+
+00000000008013bc <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8013bc:	55                   	push   %rbp
+  8013bd:	48 89 e5             	mov    %rsp,%rbp
+  8013c0:	41 54                	push   %r12
+  8013c2:	53                   	push   %rbx
+  8013c3:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013c6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8013cd:	00 00 00 
+  8013d0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8013d5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8013d9:	74 15                	je     8013f0 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8013db:	48 83 c3 01          	add    $0x1,%rbx
+  8013df:	48 83 c0 18          	add    $0x18,%rax
+  8013e3:	48 83 fb 20          	cmp    $0x20,%rbx
+  8013e7:	75 ec                	jne    8013d5 <mmap_alloc+0x19>
+    return NULL;
+  8013e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ee:	eb 52                	jmp    801442 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8013f0:	4c 89 e7             	mov    %r12,%rdi
+  8013f3:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  8013fa:	00 00 00 
+  8013fd:	ff d0                	call   *%rax
+  8013ff:	41 89 c1             	mov    %eax,%r9d
+  801402:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  801409:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80140d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801413:	ba 00 00 00 00       	mov    $0x0,%edx
+  801418:	4c 89 e6             	mov    %r12,%rsi
+  80141b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801420:	48 b8 8c 02 80 00 00 	movabs $0x80028c,%rax
+  801427:	00 00 00 
+  80142a:	ff d0                	call   *%rax
+  80142c:	85 c0                	test   %eax,%eax
+  80142e:	78 17                	js     801447 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  801430:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  801434:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80143b:	00 00 00 
+  80143e:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  801442:	5b                   	pop    %rbx
+  801443:	41 5c                	pop    %r12
+  801445:	5d                   	pop    %rbp
+  801446:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  801447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144c:	eb f4                	jmp    801442 <mmap_alloc+0x86>
+
+000000000080144e <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80144e:	55                   	push   %rbp
+  80144f:	48 89 e5             	mov    %rsp,%rbp
+  801452:	41 56                	push   %r14
+  801454:	41 55                	push   %r13
+  801456:	41 54                	push   %r12
+  801458:	53                   	push   %rbx
+  801459:	48 83 ec 10          	sub    $0x10,%rsp
+  80145d:	41 89 fc             	mov    %edi,%r12d
+  801460:	49 89 f5             	mov    %rsi,%r13
+  801463:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  801466:	48 89 f0             	mov    %rsi,%rax
+  801469:	48 09 d0             	or     %rdx,%rax
+  80146c:	75 0d                	jne    80147b <fsipc+0x2d>
+  80146e:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  801471:	83 f8 04             	cmp    $0x4,%eax
+  801474:	76 7d                	jbe    8014f3 <fsipc+0xa5>
+  801476:	83 ff 0d             	cmp    $0xd,%edi
+  801479:	74 78                	je     8014f3 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80147b:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  801482:	00 00 00 
+  801485:	ff d0                	call   *%rax
+  801487:	89 c7                	mov    %eax,%edi
+  801489:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  801490:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  801497:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80149e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8014a4:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8014ab:	00 00 00 
+  8014ae:	44 89 e6             	mov    %r12d,%esi
+  8014b1:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  8014b8:	00 00 00 
+  8014bb:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8014bd:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8014c4:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8014c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014ca:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8014ce:	4c 89 ee             	mov    %r13,%rsi
+  8014d1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014d6:	48 b8 ab 45 80 00 00 	movabs $0x8045ab,%rax
+  8014dd:	00 00 00 
+  8014e0:	ff d0                	call   *%rax
+  8014e2:	89 c3                	mov    %eax,%ebx
+}
+  8014e4:	89 d8                	mov    %ebx,%eax
+  8014e6:	48 83 c4 10          	add    $0x10,%rsp
+  8014ea:	5b                   	pop    %rbx
+  8014eb:	41 5c                	pop    %r12
+  8014ed:	41 5d                	pop    %r13
+  8014ef:	41 5e                	pop    %r14
+  8014f1:	5d                   	pop    %rbp
+  8014f2:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8014f3:	48 b8 00 0f 80 00 00 	movabs $0x800f00,%rax
+  8014fa:	00 00 00 
+  8014fd:	ff d0                	call   *%rax
+  8014ff:	49 89 c6             	mov    %rax,%r14
+  801502:	48 85 c0             	test   %rax,%rax
+  801505:	0f 84 70 ff ff ff    	je     80147b <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80150b:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80150f:	48 b8 03 30 80 00 00 	movabs $0x803003,%rax
+  801516:	00 00 00 
+  801519:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  80151b:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80151e:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  801525:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  801529:	ba 10 00 00 00       	mov    $0x10,%edx
+  80152e:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  801535:	00 00 00 
+  801538:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  80153f:	00 00 00 
+  801542:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  801544:	4c 89 f7             	mov    %r14,%rdi
+  801547:	48 b8 9c 0f 80 00 00 	movabs $0x800f9c,%rax
+  80154e:	00 00 00 
+  801551:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  801553:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80155a:	4c 89 f7             	mov    %r14,%rdi
+  80155d:	48 b8 c6 30 80 00 00 	movabs $0x8030c6,%rax
+  801564:	00 00 00 
+  801567:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  801569:	4c 89 f7             	mov    %r14,%rdi
+  80156c:	48 b8 54 30 80 00 00 	movabs $0x803054,%rax
+  801573:	00 00 00 
+  801576:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  801578:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80157b:	41 83 fc 05          	cmp    $0x5,%r12d
+  80157f:	75 04                	jne    801585 <fsipc+0x137>
+  801581:	85 db                	test   %ebx,%ebx
+  801583:	79 14                	jns    801599 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  801585:	4c 89 f7             	mov    %r14,%rdi
+  801588:	48 b8 7b 30 80 00 00 	movabs $0x80307b,%rax
+  80158f:	00 00 00 
+  801592:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  801594:	e9 4b ff ff ff       	jmp    8014e4 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  801599:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80159d:	ba 88 00 00 00       	mov    $0x88,%edx
+  8015a2:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8015a9:	00 00 00 
+  8015ac:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  8015b3:	00 00 00 
+  8015b6:	ff d0                	call   *%rax
+  8015b8:	eb cb                	jmp    801585 <fsipc+0x137>
+
+00000000008015ba <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8015ba:	55                   	push   %rbp
+  8015bb:	48 89 e5             	mov    %rsp,%rbp
+  8015be:	41 57                	push   %r15
+  8015c0:	41 56                	push   %r14
+  8015c2:	41 55                	push   %r13
+  8015c4:	41 54                	push   %r12
+  8015c6:	53                   	push   %rbx
+  8015c7:	48 83 ec 18          	sub    $0x18,%rsp
+  8015cb:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8015cf:	49 89 f6             	mov    %rsi,%r14
+  8015d2:	49 89 d4             	mov    %rdx,%r12
+  8015d5:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8015d8:	48 b8 00 0f 80 00 00 	movabs $0x800f00,%rax
+  8015df:	00 00 00 
+  8015e2:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8015e4:	48 85 c0             	test   %rax,%rax
+  8015e7:	0f 85 96 00 00 00    	jne    801683 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8015ed:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8015f4:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8015f5:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8015fc:	00 00 00 
+    while (n) {
+  8015ff:	4d 85 e4             	test   %r12,%r12
+  801602:	74 79                	je     80167d <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801604:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  801609:	49 39 dc             	cmp    %rbx,%r12
+  80160c:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  801610:	48 89 da             	mov    %rbx,%rdx
+  801613:	4c 89 f6             	mov    %r14,%rsi
+  801616:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80161d:	00 00 00 
+  801620:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  801627:	00 00 00 
+  80162a:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80162c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  801630:	8b 40 0c             	mov    0xc(%rax),%eax
+  801633:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  801636:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  801639:	44 01 e8             	add    %r13d,%eax
+  80163c:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  801640:	41 0f 44 c5          	cmove  %r13d,%eax
+  801644:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  801648:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80164c:	48 89 da             	mov    %rbx,%rdx
+  80164f:	be 00 00 00 00       	mov    $0x0,%esi
+  801654:	bf 04 00 00 00       	mov    $0x4,%edi
+  801659:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  801660:	00 00 00 
+  801663:	ff d0                	call   *%rax
+        if (res < 0)
+  801665:	85 c0                	test   %eax,%eax
+  801667:	78 4a                	js     8016b3 <devfile_write_direct+0xf9>
+        buf += res;
+  801669:	48 98                	cltq
+  80166b:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80166e:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  801672:	49 29 c4             	sub    %rax,%r12
+  801675:	75 8d                	jne    801604 <devfile_write_direct+0x4a>
+    return write;
+  801677:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80167b:	eb 27                	jmp    8016a4 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80167d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  801681:	eb f4                	jmp    801677 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  801683:	45 89 e9             	mov    %r13d,%r9d
+  801686:	4d 89 e0             	mov    %r12,%r8
+  801689:	4c 89 f1             	mov    %r14,%rcx
+  80168c:	ba 04 00 00 00       	mov    $0x4,%edx
+  801691:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801695:	48 89 c7             	mov    %rax,%rdi
+  801698:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  80169f:	00 00 00 
+  8016a2:	ff d0                	call   *%rax
+}
+  8016a4:	48 83 c4 18          	add    $0x18,%rsp
+  8016a8:	5b                   	pop    %rbx
+  8016a9:	41 5c                	pop    %r12
+  8016ab:	41 5d                	pop    %r13
+  8016ad:	41 5e                	pop    %r14
+  8016af:	41 5f                	pop    %r15
+  8016b1:	5d                   	pop    %rbp
+  8016b2:	c3                   	ret
+            return res;
+  8016b3:	48 98                	cltq
+  8016b5:	eb ed                	jmp    8016a4 <devfile_write_direct+0xea>
+
+00000000008016b7 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8016b7:	55                   	push   %rbp
+  8016b8:	48 89 e5             	mov    %rsp,%rbp
+  8016bb:	41 54                	push   %r12
+  8016bd:	53                   	push   %rbx
+  8016be:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8016c1:	48 b8 6a 0f 80 00 00 	movabs $0x800f6a,%rax
+  8016c8:	00 00 00 
+  8016cb:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8016cd:	48 85 c0             	test   %rax,%rax
+  8016d0:	74 71                	je     801743 <fbuf_flush+0x8c>
+  8016d2:	48 89 c3             	mov    %rax,%rbx
+  8016d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016da:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8016de:	75 05                	jne    8016e5 <fbuf_flush+0x2e>
+}
+  8016e0:	5b                   	pop    %rbx
+  8016e1:	41 5c                	pop    %r12
+  8016e3:	5d                   	pop    %rbp
+  8016e4:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8016e5:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8016e8:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8016ec:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8016f3:	00 00 00 
+  8016f6:	48 89 de             	mov    %rbx,%rsi
+  8016f9:	48 29 c6             	sub    %rax,%rsi
+  8016fc:	48 c1 fe 03          	sar    $0x3,%rsi
+  801700:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  801707:	aa aa aa 
+  80170a:	48 0f af f0          	imul   %rax,%rsi
+  80170e:	48 c1 e6 0e          	shl    $0xe,%rsi
+  801712:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801717:	48 01 c6             	add    %rax,%rsi
+  80171a:	4c 89 e7             	mov    %r12,%rdi
+  80171d:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801724:	00 00 00 
+  801727:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  801729:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80172d:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801734:	00 
+    return res < 0 ? res : 0;
+  801735:	48 85 c0             	test   %rax,%rax
+  801738:	ba 00 00 00 00       	mov    $0x0,%edx
+  80173d:	48 0f 4f c2          	cmovg  %rdx,%rax
+  801741:	eb 9d                	jmp    8016e0 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  801743:	b8 00 00 00 00       	mov    $0x0,%eax
+  801748:	eb 96                	jmp    8016e0 <fbuf_flush+0x29>
+
+000000000080174a <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80174a:	55                   	push   %rbp
+  80174b:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80174e:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  801755:	00 00 00 
+  801758:	ff d0                	call   *%rax
+}
+  80175a:	5d                   	pop    %rbp
+  80175b:	c3                   	ret
+
+000000000080175c <devfile_write>:
+    if (!fd || !buf)
+  80175c:	48 85 ff             	test   %rdi,%rdi
+  80175f:	0f 84 d3 01 00 00    	je     801938 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  801765:	55                   	push   %rbp
+  801766:	48 89 e5             	mov    %rsp,%rbp
+  801769:	41 57                	push   %r15
+  80176b:	41 56                	push   %r14
+  80176d:	41 55                	push   %r13
+  80176f:	41 54                	push   %r12
+  801771:	53                   	push   %rbx
+  801772:	48 83 ec 08          	sub    $0x8,%rsp
+  801776:	49 89 fc             	mov    %rdi,%r12
+  801779:	49 89 f6             	mov    %rsi,%r14
+  80177c:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80177f:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801784:	48 85 f6             	test   %rsi,%rsi
+  801787:	0f 84 9c 01 00 00    	je     801929 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80178d:	48 b8 6a 0f 80 00 00 	movabs $0x800f6a,%rax
+  801794:	00 00 00 
+  801797:	ff d0                	call   *%rax
+  801799:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  80179c:	48 85 c0             	test   %rax,%rax
+  80179f:	0f 84 a2 00 00 00    	je     801847 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8017a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017aa:	4c 89 e7             	mov    %r12,%rdi
+  8017ad:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  8017b4:	00 00 00 
+  8017b7:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8017b9:	83 f8 02             	cmp    $0x2,%eax
+  8017bc:	0f 8f 85 00 00 00    	jg     801847 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8017c2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8017c9:	00 00 00 
+  8017cc:	4d 89 ef             	mov    %r13,%r15
+  8017cf:	49 29 c7             	sub    %rax,%r15
+  8017d2:	49 c1 ff 03          	sar    $0x3,%r15
+  8017d6:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8017dd:	aa aa aa 
+  8017e0:	4c 0f af f8          	imul   %rax,%r15
+  8017e4:	49 c1 e7 0e          	shl    $0xe,%r15
+  8017e8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8017ed:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8017f0:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8017f5:	0f 84 d7 00 00 00    	je     8018d2 <devfile_write+0x176>
+  8017fb:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8017ff:	89 c2                	mov    %eax,%edx
+  801801:	41 03 55 0c          	add    0xc(%r13),%edx
+  801805:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80180a:	75 0f                	jne    80181b <devfile_write+0xbf>
+  80180c:	48 01 d8             	add    %rbx,%rax
+  80180f:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  801815:	0f 86 92 00 00 00    	jbe    8018ad <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  80181b:	4c 89 e7             	mov    %r12,%rdi
+  80181e:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  801825:	00 00 00 
+  801828:	ff d0                	call   *%rax
+  80182a:	85 c0                	test   %eax,%eax
+  80182c:	78 52                	js     801880 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80182e:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  801835:	77 7f                	ja     8018b6 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  801837:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80183c:	0f 85 c2 00 00 00    	jne    801904 <devfile_write+0x1a8>
+  801842:	e9 94 00 00 00       	jmp    8018db <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  801847:	4c 89 e7             	mov    %r12,%rdi
+  80184a:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  801851:	00 00 00 
+  801854:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801856:	85 c0                	test   %eax,%eax
+  801858:	79 07                	jns    801861 <devfile_write+0x105>
+  80185a:	48 98                	cltq
+  80185c:	e9 c8 00 00 00       	jmp    801929 <devfile_write+0x1cd>
+  801861:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801866:	48 89 da             	mov    %rbx,%rdx
+  801869:	4c 89 f6             	mov    %r14,%rsi
+  80186c:	4c 89 e7             	mov    %r12,%rdi
+  80186f:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  801876:	00 00 00 
+  801879:	ff d0                	call   *%rax
+  80187b:	e9 a9 00 00 00       	jmp    801929 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  801880:	48 98                	cltq
+  801882:	e9 a2 00 00 00       	jmp    801929 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801887:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80188c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801891:	4c 89 fe             	mov    %r15,%rsi
+  801894:	bf 00 00 00 00       	mov    $0x0,%edi
+  801899:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  8018a0:	00 00 00 
+  8018a3:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8018a5:	85 c0                	test   %eax,%eax
+  8018a7:	79 45                	jns    8018ee <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8018a9:	48 98                	cltq
+  8018ab:	eb 7c                	jmp    801929 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8018ad:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018b4:	76 4e                	jbe    801904 <devfile_write+0x1a8>
+  8018b6:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8018bb:	48 89 da             	mov    %rbx,%rdx
+  8018be:	4c 89 f6             	mov    %r14,%rsi
+  8018c1:	4c 89 e7             	mov    %r12,%rdi
+  8018c4:	48 b8 ba 15 80 00 00 	movabs $0x8015ba,%rax
+  8018cb:	00 00 00 
+  8018ce:	ff d0                	call   *%rax
+  8018d0:	eb 57                	jmp    801929 <devfile_write+0x1cd>
+  8018d2:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8018d9:	77 db                	ja     8018b6 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  8018db:	4c 89 ff             	mov    %r15,%rdi
+  8018de:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  8018e5:	00 00 00 
+  8018e8:	ff d0                	call   *%rax
+  8018ea:	84 c0                	test   %al,%al
+  8018ec:	74 99                	je     801887 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8018ee:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8018f3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8018f8:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8018fc:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  801903:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  801904:	4c 89 ff             	mov    %r15,%rdi
+  801907:	49 03 7d 10          	add    0x10(%r13),%rdi
+  80190b:	48 89 da             	mov    %rbx,%rdx
+  80190e:	4c 89 f6             	mov    %r14,%rsi
+  801911:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  801918:	00 00 00 
+  80191b:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  80191d:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  801921:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  801926:	48 89 d8             	mov    %rbx,%rax
+}
+  801929:	48 83 c4 08          	add    $0x8,%rsp
+  80192d:	5b                   	pop    %rbx
+  80192e:	41 5c                	pop    %r12
+  801930:	41 5d                	pop    %r13
+  801932:	41 5e                	pop    %r14
+  801934:	41 5f                	pop    %r15
+  801936:	5d                   	pop    %rbp
+  801937:	c3                   	ret
+        return E_INVAL;
+  801938:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80193d:	c3                   	ret
+
+000000000080193e <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  80193e:	55                   	push   %rbp
+  80193f:	48 89 e5             	mov    %rsp,%rbp
+  801942:	41 54                	push   %r12
+  801944:	53                   	push   %rbx
+  801945:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  801948:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+  801954:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  801957:	48 89 df             	mov    %rbx,%rdi
+  80195a:	48 b8 6a 0f 80 00 00 	movabs $0x800f6a,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+  801966:	48 85 c0             	test   %rax,%rax
+  801969:	74 17                	je     801982 <devfile_flush+0x44>
+  80196b:	48 89 df             	mov    %rbx,%rdi
+  80196e:	48 b8 6a 0f 80 00 00 	movabs $0x800f6a,%rax
+  801975:	00 00 00 
+  801978:	ff d0                	call   *%rax
+  80197a:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  801981:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  801982:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801985:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80198c:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  80198e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801993:	be 00 00 00 00       	mov    $0x0,%esi
+  801998:	bf 06 00 00 00       	mov    $0x6,%edi
+  80199d:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  8019a4:	00 00 00 
+  8019a7:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8019a9:	45 85 e4             	test   %r12d,%r12d
+  8019ac:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8019b0:	5b                   	pop    %rbx
+  8019b1:	41 5c                	pop    %r12
+  8019b3:	5d                   	pop    %rbp
+  8019b4:	c3                   	ret
+
+00000000008019b5 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8019b5:	55                   	push   %rbp
+  8019b6:	48 89 e5             	mov    %rsp,%rbp
+  8019b9:	41 57                	push   %r15
+  8019bb:	41 56                	push   %r14
+  8019bd:	41 55                	push   %r13
+  8019bf:	41 54                	push   %r12
+  8019c1:	53                   	push   %rbx
+  8019c2:	48 83 ec 38          	sub    $0x38,%rsp
+  8019c6:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8019ca:	49 89 f7             	mov    %rsi,%r15
+  8019cd:	48 89 d3             	mov    %rdx,%rbx
+  8019d0:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  8019d3:	48 b8 00 0f 80 00 00 	movabs $0x800f00,%rax
+  8019da:	00 00 00 
+  8019dd:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  8019df:	48 85 c0             	test   %rax,%rax
+  8019e2:	75 20                	jne    801a04 <devfile_read_direct+0x4f>
+    bool map = 1;
+  8019e4:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  8019e9:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  8019f0:	00 
+    while (n) {
+  8019f1:	48 85 db             	test   %rbx,%rbx
+  8019f4:	0f 85 df 00 00 00    	jne    801ad9 <devfile_read_direct+0x124>
+    size_t read = 0;
+  8019fa:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  8019fe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a02:	eb 21                	jmp    801a25 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  801a04:	45 89 f1             	mov    %r14d,%r9d
+  801a07:	49 89 d8             	mov    %rbx,%r8
+  801a0a:	4c 89 f9             	mov    %r15,%rcx
+  801a0d:	ba 03 00 00 00       	mov    $0x3,%edx
+  801a12:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801a16:	48 89 c7             	mov    %rax,%rdi
+  801a19:	48 b8 e7 0f 80 00 00 	movabs $0x800fe7,%rax
+  801a20:	00 00 00 
+  801a23:	ff d0                	call   *%rax
+}
+  801a25:	48 83 c4 38          	add    $0x38,%rsp
+  801a29:	5b                   	pop    %rbx
+  801a2a:	41 5c                	pop    %r12
+  801a2c:	41 5d                	pop    %r13
+  801a2e:	41 5e                	pop    %r14
+  801a30:	41 5f                	pop    %r15
+  801a32:	5d                   	pop    %rbp
+  801a33:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801a34:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a38:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  801a3e:	75 1e                	jne    801a5e <devfile_read_direct+0xa9>
+  801a40:	e9 e2 00 00 00       	jmp    801b27 <devfile_read_direct+0x172>
+            if (!res) return read;
+  801a45:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  801a49:	eb da                	jmp    801a25 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  801a4b:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  801a4f:	0f 85 d0 01 00 00    	jne    801c25 <devfile_read_direct+0x270>
+            map = 0;
+  801a55:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801a59:	eb 03                	jmp    801a5e <devfile_read_direct+0xa9>
+  801a5b:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  801a5e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  801a63:	48 39 d3             	cmp    %rdx,%rbx
+  801a66:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801a6a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  801a6e:	8b 40 0c             	mov    0xc(%rax),%eax
+  801a71:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  801a78:	00 00 00 
+  801a7b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  801a7d:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  801a81:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  801a85:	be 00 00 00 00       	mov    $0x0,%esi
+  801a8a:	bf 03 00 00 00       	mov    $0x3,%edi
+  801a8f:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  801a96:	00 00 00 
+  801a99:	ff d0                	call   *%rax
+        if (res <= 0)
+  801a9b:	85 c0                	test   %eax,%eax
+  801a9d:	0f 8e 63 01 00 00    	jle    801c06 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  801aa3:	4c 63 e0             	movslq %eax,%r12
+  801aa6:	4c 89 e2             	mov    %r12,%rdx
+  801aa9:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  801ab0:	00 00 00 
+  801ab3:	4c 89 ff             	mov    %r15,%rdi
+  801ab6:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  801abd:	00 00 00 
+  801ac0:	ff d0                	call   *%rax
+        buf += res;
+  801ac2:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  801ac5:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  801ac8:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  801acc:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  801ad0:	48 85 db             	test   %rbx,%rbx
+  801ad3:	0f 84 25 ff ff ff    	je     8019fe <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  801ad9:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  801adc:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  801ae0:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  801ae4:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801ae8:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  801aef:	0f 97 c2             	seta   %dl
+  801af2:	20 c2                	and    %al,%dl
+  801af4:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  801af7:	0f 84 5e ff ff ff    	je     801a5b <devfile_read_direct+0xa6>
+  801afd:	4c 89 fa             	mov    %r15,%rdx
+  801b00:	4d 89 fd             	mov    %r15,%r13
+  801b03:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  801b0a:	0f 85 4e ff ff ff    	jne    801a5e <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  801b10:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  801b14:	0f 84 1a ff ff ff    	je     801a34 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  801b1a:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  801b21:	0f 85 37 ff ff ff    	jne    801a5e <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  801b27:	48 89 d8             	mov    %rbx,%rax
+  801b2a:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  801b30:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  801b35:	48 39 c8             	cmp    %rcx,%rax
+  801b38:	48 0f 47 c1          	cmova  %rcx,%rax
+  801b3c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  801b40:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  801b44:	49 89 d4             	mov    %rdx,%r12
+  801b47:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  801b4b:	48 b8 26 2e 80 00 00 	movabs $0x802e26,%rax
+  801b52:	00 00 00 
+  801b55:	ff d0                	call   *%rax
+  801b57:	a8 40                	test   $0x40,%al
+  801b59:	0f 85 b9 00 00 00    	jne    801c18 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  801b5f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  801b66:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801b6a:	49 39 c5             	cmp    %rax,%r13
+  801b6d:	72 d8                	jb     801b47 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  801b6f:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801b73:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801b7a:	00 00 00 
+  801b7d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  801b81:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  801b84:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  801b86:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  801b8a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  801b8e:	48 b8 9b 0d 80 00 00 	movabs $0x800d9b,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	89 c7                	mov    %eax,%edi
+  801b9c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  801ba2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  801ba7:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  801bae:	00 00 00 
+  801bb1:	be 0e 00 00 00       	mov    $0xe,%esi
+  801bb6:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  801bbd:	00 00 00 
+  801bc0:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  801bc2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801bc7:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  801bcb:	4c 89 fe             	mov    %r15,%rsi
+  801bce:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd3:	48 b8 ab 45 80 00 00 	movabs $0x8045ab,%rax
+  801bda:	00 00 00 
+  801bdd:	ff d0                	call   *%rax
+  801bdf:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  801be2:	48 85 d2             	test   %rdx,%rdx
+  801be5:	0f 84 5a fe ff ff    	je     801a45 <devfile_read_direct+0x90>
+            if (res > 0) {
+  801beb:	0f 8e 5a fe ff ff    	jle    801a4b <devfile_read_direct+0x96>
+                buf += res;
+  801bf1:	48 98                	cltq
+  801bf3:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  801bf6:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  801bf9:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  801bfd:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  801c01:	e9 ca fe ff ff       	jmp    801ad0 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  801c06:	41 89 c5             	mov    %eax,%r13d
+  801c09:	48 98                	cltq
+  801c0b:	45 85 ed             	test   %r13d,%r13d
+  801c0e:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  801c13:	e9 0d fe ff ff       	jmp    801a25 <devfile_read_direct+0x70>
+            map = 0;
+  801c18:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  801c1c:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  801c20:	e9 39 fe ff ff       	jmp    801a5e <devfile_read_direct+0xa9>
+  801c25:	48 89 d0             	mov    %rdx,%rax
+  801c28:	e9 f8 fd ff ff       	jmp    801a25 <devfile_read_direct+0x70>
+
+0000000000801c2d <devfile_read>:
+    if (!fd || !buf)
+  801c2d:	48 85 ff             	test   %rdi,%rdi
+  801c30:	0f 84 21 02 00 00    	je     801e57 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  801c36:	55                   	push   %rbp
+  801c37:	48 89 e5             	mov    %rsp,%rbp
+  801c3a:	41 57                	push   %r15
+  801c3c:	41 56                	push   %r14
+  801c3e:	41 55                	push   %r13
+  801c40:	41 54                	push   %r12
+  801c42:	53                   	push   %rbx
+  801c43:	48 83 ec 28          	sub    $0x28,%rsp
+  801c47:	48 89 fb             	mov    %rdi,%rbx
+  801c4a:	49 89 f4             	mov    %rsi,%r12
+  801c4d:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  801c50:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  801c55:	48 85 f6             	test   %rsi,%rsi
+  801c58:	74 4b                	je     801ca5 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  801c5a:	48 b8 6a 0f 80 00 00 	movabs $0x800f6a,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+  801c66:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c69:	48 85 c0             	test   %rax,%rax
+  801c6c:	74 22                	je     801c90 <devfile_read+0x63>
+  801c6e:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  801c75:	77 19                	ja     801c90 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  801c77:	be 00 10 00 00       	mov    $0x1000,%esi
+  801c7c:	48 89 df             	mov    %rbx,%rdi
+  801c7f:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  801c86:	00 00 00 
+  801c89:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  801c8b:	83 f8 02             	cmp    $0x2,%eax
+  801c8e:	7e 40                	jle    801cd0 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  801c90:	48 89 df             	mov    %rbx,%rdi
+  801c93:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  801c9a:	00 00 00 
+  801c9d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	79 11                	jns    801cb4 <devfile_read+0x87>
+  801ca3:	48 98                	cltq
+}
+  801ca5:	48 83 c4 28          	add    $0x28,%rsp
+  801ca9:	5b                   	pop    %rbx
+  801caa:	41 5c                	pop    %r12
+  801cac:	41 5d                	pop    %r13
+  801cae:	41 5e                	pop    %r14
+  801cb0:	41 5f                	pop    %r15
+  801cb2:	5d                   	pop    %rbp
+  801cb3:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  801cb4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  801cb9:	4c 89 ea             	mov    %r13,%rdx
+  801cbc:	4c 89 e6             	mov    %r12,%rsi
+  801cbf:	48 89 df             	mov    %rbx,%rdi
+  801cc2:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  801cc9:	00 00 00 
+  801ccc:	ff d0                	call   *%rax
+  801cce:	eb d5                	jmp    801ca5 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  801cd0:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801cd4:	48 89 df             	mov    %rbx,%rdi
+  801cd7:	48 b8 b7 16 80 00 00 	movabs $0x8016b7,%rax
+  801cde:	00 00 00 
+  801ce1:	ff d0                	call   *%rax
+  801ce3:	85 c0                	test   %eax,%eax
+  801ce5:	0f 88 33 01 00 00    	js     801e1e <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  801ceb:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  801cf2:	00 00 00 
+  801cf5:	4c 89 f0             	mov    %r14,%rax
+  801cf8:	48 29 d0             	sub    %rdx,%rax
+  801cfb:	48 c1 f8 03          	sar    $0x3,%rax
+  801cff:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  801d06:	aa aa aa 
+  801d09:	48 0f af c2          	imul   %rdx,%rax
+  801d0d:	48 c1 e0 0e          	shl    $0xe,%rax
+  801d11:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801d15:	8b 43 0c             	mov    0xc(%rbx),%eax
+  801d18:	41 39 06             	cmp    %eax,(%r14)
+  801d1b:	75 0d                	jne    801d2a <devfile_read+0xfd>
+  801d1d:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d20:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  801d24:	0f 84 fb 00 00 00    	je     801e25 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  801d2a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801d2f:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  801d33:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  801d36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801d3a:	48 89 c7             	mov    %rax,%rdi
+  801d3d:	48 b8 85 2e 80 00 00 	movabs $0x802e85,%rax
+  801d44:	00 00 00 
+  801d47:	ff d0                	call   *%rax
+  801d49:	84 c0                	test   %al,%al
+  801d4b:	75 27                	jne    801d74 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801d4d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801d52:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d57:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d5b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d60:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  801d67:	00 00 00 
+  801d6a:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  801d6c:	85 c0                	test   %eax,%eax
+  801d6e:	0f 88 dc 00 00 00    	js     801e50 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  801d74:	44 89 f8             	mov    %r15d,%eax
+  801d77:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  801d7c:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  801d7e:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  801d85:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  801d86:	8b 43 10             	mov    0x10(%rbx),%eax
+  801d89:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  801d8d:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  801d90:	ba 00 40 00 00       	mov    $0x4000,%edx
+  801d95:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  801d99:	48 89 df             	mov    %rbx,%rdi
+  801d9c:	48 b8 b5 19 80 00 00 	movabs $0x8019b5,%rax
+  801da3:	00 00 00 
+  801da6:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  801da8:	48 85 c0             	test   %rax,%rax
+  801dab:	0f 88 f4 fe ff ff    	js     801ca5 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  801db1:	8b 53 0c             	mov    0xc(%rbx),%edx
+  801db4:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  801db7:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  801dba:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  801dbe:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  801dc2:	48 63 d1             	movslq %ecx,%rdx
+  801dc5:	48 01 d0             	add    %rdx,%rax
+  801dc8:	4d 63 ff             	movslq %r15d,%r15
+  801dcb:	4c 29 f8             	sub    %r15,%rax
+  801dce:	ba 00 00 00 00       	mov    $0x0,%edx
+  801dd3:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  801dd7:	48 85 c0             	test   %rax,%rax
+  801dda:	0f 8e c5 fe ff ff    	jle    801ca5 <devfile_read+0x78>
+    n = MIN(n, res);
+  801de0:	4c 39 e8             	cmp    %r13,%rax
+  801de3:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  801de7:	8b 73 04             	mov    0x4(%rbx),%esi
+  801dea:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  801dee:	48 63 f6             	movslq %esi,%rsi
+  801df1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  801df6:	48 01 c6             	add    %rax,%rsi
+  801df9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  801dfd:	48 01 c6             	add    %rax,%rsi
+  801e00:	4c 89 ea             	mov    %r13,%rdx
+  801e03:	4c 89 e7             	mov    %r12,%rdi
+  801e06:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  801e0d:	00 00 00 
+  801e10:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  801e12:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  801e16:	4c 89 e8             	mov    %r13,%rax
+  801e19:	e9 87 fe ff ff       	jmp    801ca5 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  801e1e:	48 98                	cltq
+  801e20:	e9 80 fe ff ff       	jmp    801ca5 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e25:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  801e29:	41 39 d7             	cmp    %edx,%r15d
+  801e2c:	0f 8c f8 fe ff ff    	jl     801d2a <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  801e32:	49 8b 46 10          	mov    0x10(%r14),%rax
+  801e36:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  801e39:	41 39 cf             	cmp    %ecx,%r15d
+  801e3c:	0f 8d e8 fe ff ff    	jge    801d2a <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  801e42:	4d 63 ff             	movslq %r15d,%r15
+  801e45:	4c 29 f8             	sub    %r15,%rax
+  801e48:	48 63 d2             	movslq %edx,%rdx
+  801e4b:	48 01 d0             	add    %rdx,%rax
+  801e4e:	eb 87                	jmp    801dd7 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  801e50:	48 98                	cltq
+  801e52:	e9 4e fe ff ff       	jmp    801ca5 <devfile_read+0x78>
+        return E_INVAL;
+  801e57:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  801e5c:	c3                   	ret
+
+0000000000801e5d <fs_channel>:
+fs_channel(bool enable) {
+  801e5d:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  801e5f:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  801e66:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  801e68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e6d:	40 84 ff             	test   %dil,%dil
+  801e70:	74 47                	je     801eb9 <fs_channel+0x5c>
+  801e72:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e79:	00 00 00 
+  801e7c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  801e82:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e89:	00 00 00 
+  801e8c:	3b 08                	cmp    (%rax),%ecx
+  801e8e:	74 29                	je     801eb9 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  801e90:	55                   	push   %rbp
+  801e91:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  801e94:	48 b8 dd 0d 80 00 00 	movabs $0x800ddd,%rax
+  801e9b:	00 00 00 
+  801e9e:	ff d0                	call   *%rax
+  801ea0:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  801ea2:	85 c0                	test   %eax,%eax
+  801ea4:	78 04                	js     801eaa <fs_channel+0x4d>
+}
+  801ea6:	89 d0                	mov    %edx,%eax
+  801ea8:	5d                   	pop    %rbp
+  801ea9:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  801eaa:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801eb1:	00 00 00 
+  801eb4:	c6 00 00             	movb   $0x0,(%rax)
+  801eb7:	eb ed                	jmp    801ea6 <fs_channel+0x49>
+}
+  801eb9:	89 d0                	mov    %edx,%eax
+  801ebb:	c3                   	ret
+
+0000000000801ebc <open>:
+open(const char *path, int mode) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	41 55                	push   %r13
+  801ec2:	41 54                	push   %r12
+  801ec4:	53                   	push   %rbx
+  801ec5:	48 83 ec 18          	sub    $0x18,%rsp
+  801ec9:	49 89 fc             	mov    %rdi,%r12
+  801ecc:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  801ecf:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  801ed6:	00 00 00 
+  801ed9:	ff d0                	call   *%rax
+  801edb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  801ee1:	0f 87 8f 00 00 00    	ja     801f76 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  801ee7:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  801eeb:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  801ef2:	00 00 00 
+  801ef5:	ff d0                	call   *%rax
+  801ef7:	89 c3                	mov    %eax,%ebx
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 55                	js     801f52 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  801efd:	4c 89 e6             	mov    %r12,%rsi
+  801f00:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  801f07:	00 00 00 
+  801f0a:	48 89 df             	mov    %rbx,%rdi
+  801f0d:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  801f14:	00 00 00 
+  801f17:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  801f19:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  801f20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f25:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  801f29:	bf 01 00 00 00       	mov    $0x1,%edi
+  801f2e:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  801f35:	00 00 00 
+  801f38:	ff d0                	call   *%rax
+  801f3a:	89 c3                	mov    %eax,%ebx
+  801f3c:	85 c0                	test   %eax,%eax
+  801f3e:	78 1f                	js     801f5f <open+0xa3>
+    return fd2num(fd);
+  801f40:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f44:	48 b8 69 06 80 00 00 	movabs $0x800669,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  801f50:	89 c3                	mov    %eax,%ebx
+}
+  801f52:	89 d8                	mov    %ebx,%eax
+  801f54:	48 83 c4 18          	add    $0x18,%rsp
+  801f58:	5b                   	pop    %rbx
+  801f59:	41 5c                	pop    %r12
+  801f5b:	41 5d                	pop    %r13
+  801f5d:	5d                   	pop    %rbp
+  801f5e:	c3                   	ret
+        fd_close(fd, 0);
+  801f5f:	be 00 00 00 00       	mov    $0x0,%esi
+  801f64:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801f68:	48 b8 b2 07 80 00 00 	movabs $0x8007b2,%rax
+  801f6f:	00 00 00 
+  801f72:	ff d0                	call   *%rax
+        return res;
+  801f74:	eb dc                	jmp    801f52 <open+0x96>
+        return -E_BAD_PATH;
+  801f76:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  801f7b:	eb d5                	jmp    801f52 <open+0x96>
+
+0000000000801f7d <file_flush_buffers>:
+file_flush_buffers(void) {
+  801f7d:	55                   	push   %rbp
+  801f7e:	48 89 e5             	mov    %rsp,%rbp
+  801f81:	41 56                	push   %r14
+  801f83:	41 55                	push   %r13
+  801f85:	41 54                	push   %r12
+  801f87:	53                   	push   %rbx
+  801f88:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  801f8c:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  801f93:	00 00 00 
+  801f96:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801f9b:	49 bd f7 06 80 00 00 	movabs $0x8006f7,%r13
+  801fa2:	00 00 00 
+  801fa5:	49 be b7 16 80 00 00 	movabs $0x8016b7,%r14
+  801fac:	00 00 00 
+  801faf:	eb 0c                	jmp    801fbd <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  801fb1:	83 c3 01             	add    $0x1,%ebx
+  801fb4:	49 83 c4 18          	add    $0x18,%r12
+  801fb8:	83 fb 20             	cmp    $0x20,%ebx
+  801fbb:	74 1d                	je     801fda <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  801fbd:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  801fc2:	74 ed                	je     801fb1 <file_flush_buffers+0x34>
+  801fc4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801fc8:	89 df                	mov    %ebx,%edi
+  801fca:	41 ff d5             	call   *%r13
+  801fcd:	85 c0                	test   %eax,%eax
+  801fcf:	78 e0                	js     801fb1 <file_flush_buffers+0x34>
+  801fd1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  801fd5:	41 ff d6             	call   *%r14
+  801fd8:	eb d7                	jmp    801fb1 <file_flush_buffers+0x34>
+}
+  801fda:	48 83 c4 10          	add    $0x10,%rsp
+  801fde:	5b                   	pop    %rbx
+  801fdf:	41 5c                	pop    %r12
+  801fe1:	41 5d                	pop    %r13
+  801fe3:	41 5e                	pop    %r14
+  801fe5:	5d                   	pop    %rbp
+  801fe6:	c3                   	ret
+
+0000000000801fe7 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  801fe7:	55                   	push   %rbp
+  801fe8:	48 89 e5             	mov    %rsp,%rbp
+  801feb:	41 54                	push   %r12
+  801fed:	53                   	push   %rbx
+  801fee:	49 89 fc             	mov    %rdi,%r12
+  801ff1:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  801ff3:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  801ffa:	00 00 00 
+  801ffd:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  801fff:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802006:	00 00 00 
+  802009:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80200e:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  802010:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  802013:	ba 00 00 00 00       	mov    $0x0,%edx
+  802018:	be 00 00 00 00       	mov    $0x0,%esi
+  80201d:	bf 02 00 00 00       	mov    $0x2,%edi
+  802022:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  802029:	00 00 00 
+  80202c:	ff d0                	call   *%rax
+}
+  80202e:	5b                   	pop    %rbx
+  80202f:	41 5c                	pop    %r12
+  802031:	5d                   	pop    %rbp
+  802032:	c3                   	ret
+
+0000000000802033 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  802033:	55                   	push   %rbp
+  802034:	48 89 e5             	mov    %rsp,%rbp
+  802037:	41 54                	push   %r12
+  802039:	53                   	push   %rbx
+  80203a:	49 89 fc             	mov    %rdi,%r12
+  80203d:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  802040:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802047:	00 00 00 
+  80204a:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80204c:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  802051:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802058:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80205a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80205f:	be 00 00 00 00       	mov    $0x0,%esi
+  802064:	bf 05 00 00 00       	mov    $0x5,%edi
+  802069:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  802070:	00 00 00 
+  802073:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802075:	85 c0                	test   %eax,%eax
+  802077:	78 3d                	js     8020b6 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  802079:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  802080:	00 00 00 
+  802083:	4c 89 e6             	mov    %r12,%rsi
+  802086:	48 89 df             	mov    %rbx,%rdi
+  802089:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  802095:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80209c:	00 
+  80209d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8020a3:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8020aa:	00 
+  8020ab:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8020b1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8020b6:	5b                   	pop    %rbx
+  8020b7:	41 5c                	pop    %r12
+  8020b9:	5d                   	pop    %rbp
+  8020ba:	c3                   	ret
+
+00000000008020bb <remove>:
+remove(const char *path) {
+  8020bb:	55                   	push   %rbp
+  8020bc:	48 89 e5             	mov    %rsp,%rbp
+  8020bf:	53                   	push   %rbx
+  8020c0:	48 83 ec 08          	sub    $0x8,%rsp
+  8020c4:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8020c7:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  8020ce:	00 00 00 
+  8020d1:	ff d0                	call   *%rax
+  8020d3:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8020d9:	77 3a                	ja     802115 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8020db:	48 89 de             	mov    %rbx,%rsi
+  8020de:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8020e5:	00 00 00 
+  8020e8:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  8020ef:	00 00 00 
+  8020f2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8020f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020f9:	be 00 00 00 00       	mov    $0x0,%esi
+  8020fe:	bf 07 00 00 00       	mov    $0x7,%edi
+  802103:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  80210a:	00 00 00 
+  80210d:	ff d0                	call   *%rax
+}
+  80210f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802113:	c9                   	leave
+  802114:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  802115:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80211a:	eb f3                	jmp    80210f <remove+0x54>
+
+000000000080211c <sync>:
+sync(void) {
+  80211c:	55                   	push   %rbp
+  80211d:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  802120:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802127:	00 00 00 
+  80212a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80212c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802131:	be 00 00 00 00       	mov    $0x0,%esi
+  802136:	bf 08 00 00 00       	mov    $0x8,%edi
+  80213b:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  802142:	00 00 00 
+  802145:	ff d0                	call   *%rax
+}
+  802147:	5d                   	pop    %rbp
+  802148:	c3                   	ret
+
+0000000000802149 <fsync>:
+fsync(int fdnum) {
+  802149:	55                   	push   %rbp
+  80214a:	48 89 e5             	mov    %rsp,%rbp
+  80214d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802151:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802155:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  80215c:	00 00 00 
+  80215f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802161:	85 c0                	test   %eax,%eax
+  802163:	78 4b                	js     8021b0 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802165:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  802169:	48 b8 20 50 80 00 00 	movabs $0x805020,%rax
+  802170:	00 00 00 
+  802173:	8b 00                	mov    (%rax),%eax
+  802175:	39 02                	cmp    %eax,(%rdx)
+  802177:	75 39                	jne    8021b2 <fsync+0x69>
+    file_flush_buffers();
+  802179:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  802185:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  802189:	8b 40 0c             	mov    0xc(%rax),%eax
+  80218c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802193:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  802195:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219a:	be 00 00 00 00       	mov    $0x0,%esi
+  80219f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8021a4:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+}
+  8021b0:	c9                   	leave
+  8021b1:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8021b2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8021b7:	eb f7                	jmp    8021b0 <fsync+0x67>
+
+00000000008021b9 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8021b9:	55                   	push   %rbp
+  8021ba:	48 89 e5             	mov    %rsp,%rbp
+  8021bd:	53                   	push   %rbx
+  8021be:	48 83 ec 08          	sub    $0x8,%rsp
+  8021c2:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8021c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8021cf:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8021d4:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  8021db:	00 00 00 
+  8021de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8021e0:	85 c0                	test   %eax,%eax
+  8021e2:	78 2d                	js     802211 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8021e4:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8021eb:	00 00 00 
+  8021ee:	48 8b 10             	mov    (%rax),%rdx
+  8021f1:	48 89 13             	mov    %rdx,(%rbx)
+  8021f4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8021f8:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8021fc:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  802200:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802204:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802208:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80220c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802211:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802215:	c9                   	leave
+  802216:	c3                   	ret
+
+0000000000802217 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+  80221b:	53                   	push   %rbx
+  80221c:	48 83 ec 08          	sub    $0x8,%rsp
+  802220:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  802223:	ba 00 00 00 00       	mov    $0x0,%edx
+  802228:	be 00 00 00 00       	mov    $0x0,%esi
+  80222d:	bf 0c 00 00 00       	mov    $0xc,%edi
+  802232:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  802239:	00 00 00 
+  80223c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80223e:	85 c0                	test   %eax,%eax
+  802240:	78 3d                	js     80227f <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  802242:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  802249:	00 00 00 
+  80224c:	48 8b 10             	mov    (%rax),%rdx
+  80224f:	48 89 13             	mov    %rdx,(%rbx)
+  802252:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  802256:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80225a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80225e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  802262:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  802266:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80226a:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80226e:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  802272:	48 8b 40 28          	mov    0x28(%rax),%rax
+  802276:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80227a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80227f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802283:	c9                   	leave
+  802284:	c3                   	ret
+
+0000000000802285 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 57                	push   %r15
+  80228b:	41 56                	push   %r14
+  80228d:	41 55                	push   %r13
+  80228f:	41 54                	push   %r12
+  802291:	53                   	push   %rbx
+  802292:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  802296:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80229d:	00 
+  80229e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8022a5:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8022ab:	0f 85 43 01 00 00    	jne    8023f4 <munmap+0x16f>
+  8022b1:	49 89 ff             	mov    %rdi,%r15
+  8022b4:	4c 39 f7             	cmp    %r14,%rdi
+  8022b7:	0f 87 37 01 00 00    	ja     8023f4 <munmap+0x16f>
+  8022bd:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8022c4:	00 00 00 
+  8022c7:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8022cd:	eb 2c                	jmp    8022fb <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8022cf:	4c 39 f8             	cmp    %r15,%rax
+  8022d2:	0f 83 85 00 00 00    	jae    80235d <munmap+0xd8>
+            m->mm_end = start;
+  8022d8:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8022dd:	48 83 c3 18          	add    $0x18,%rbx
+  8022e1:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8022e8:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8022ef:	00 00 00 
+  8022f2:	48 39 c3             	cmp    %rax,%rbx
+  8022f5:	0f 84 d0 00 00 00    	je     8023cb <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8022fb:	49 89 dc             	mov    %rbx,%r12
+  8022fe:	48 8b 03             	mov    (%rbx),%rax
+  802301:	4c 39 f0             	cmp    %r14,%rax
+  802304:	73 d7                	jae    8022dd <munmap+0x58>
+  802306:	48 85 c0             	test   %rax,%rax
+  802309:	74 d2                	je     8022dd <munmap+0x58>
+  80230b:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80230f:	49 39 d7             	cmp    %rdx,%r15
+  802312:	73 c9                	jae    8022dd <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  802314:	49 39 d6             	cmp    %rdx,%r14
+  802317:	73 b6                	jae    8022cf <munmap+0x4a>
+  802319:	49 39 c7             	cmp    %rax,%r15
+  80231c:	76 b1                	jbe    8022cf <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80231e:	4c 89 ef             	mov    %r13,%rdi
+  802321:	48 b8 bc 13 80 00 00 	movabs $0x8013bc,%rax
+  802328:	00 00 00 
+  80232b:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80232d:	48 85 c0             	test   %rax,%rax
+  802330:	0f 84 c5 00 00 00    	je     8023fb <munmap+0x176>
+            *tail = *m;
+  802336:	48 8b 13             	mov    (%rbx),%rdx
+  802339:	48 89 10             	mov    %rdx,(%rax)
+  80233c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  802340:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  802344:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802348:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80234c:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80234f:	44 89 f2             	mov    %r14d,%edx
+  802352:	2b 13                	sub    (%rbx),%edx
+  802354:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  802357:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80235b:	eb 80                	jmp    8022dd <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80235d:	49 39 d6             	cmp    %rdx,%r14
+  802360:	73 18                	jae    80237a <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  802362:	44 89 f2             	mov    %r14d,%edx
+  802365:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80236a:	29 c2                	sub    %eax,%edx
+  80236c:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  802371:	4d 89 34 24          	mov    %r14,(%r12)
+  802375:	e9 63 ff ff ff       	jmp    8022dd <munmap+0x58>
+    m->mm_start = 0;
+  80237a:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  802381:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  802382:	4c 89 e6             	mov    %r12,%rsi
+  802385:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80238c:	00 00 00 
+  80238f:	48 29 c6             	sub    %rax,%rsi
+  802392:	48 c1 fe 03          	sar    $0x3,%rsi
+  802396:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80239d:	aa aa aa 
+  8023a0:	48 0f af f0          	imul   %rax,%rsi
+  8023a4:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8023a8:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8023ad:	48 01 c6             	add    %rax,%rsi
+  8023b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8023b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ba:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  8023c1:	00 00 00 
+  8023c4:	ff d0                	call   *%rax
+}
+  8023c6:	e9 12 ff ff ff       	jmp    8022dd <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8023cb:	4c 89 f2             	mov    %r14,%rdx
+  8023ce:	4c 29 fa             	sub    %r15,%rdx
+  8023d1:	4c 89 fe             	mov    %r15,%rsi
+  8023d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023d9:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  8023e0:	00 00 00 
+  8023e3:	ff d0                	call   *%rax
+}
+  8023e5:	48 83 c4 08          	add    $0x8,%rsp
+  8023e9:	5b                   	pop    %rbx
+  8023ea:	41 5c                	pop    %r12
+  8023ec:	41 5d                	pop    %r13
+  8023ee:	41 5e                	pop    %r14
+  8023f0:	41 5f                	pop    %r15
+  8023f2:	5d                   	pop    %rbp
+  8023f3:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8023f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8023f9:	eb ea                	jmp    8023e5 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8023fb:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  802400:	eb e3                	jmp    8023e5 <munmap+0x160>
+
+0000000000802402 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  802402:	55                   	push   %rbp
+  802403:	48 89 e5             	mov    %rsp,%rbp
+  802406:	41 57                	push   %r15
+  802408:	41 56                	push   %r14
+  80240a:	41 55                	push   %r13
+  80240c:	41 54                	push   %r12
+  80240e:	53                   	push   %rbx
+  80240f:	48 83 ec 28          	sub    $0x28,%rsp
+  802413:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  802417:	49 89 f5             	mov    %rsi,%r13
+  80241a:	41 89 d6             	mov    %edx,%r14d
+  80241d:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  802420:	41 89 cc             	mov    %ecx,%r12d
+  802423:	44 89 c7             	mov    %r8d,%edi
+  802426:	44 89 cb             	mov    %r9d,%ebx
+  802429:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80242d:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802431:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  802438:	00 00 00 
+  80243b:	ff d0                	call   *%rax
+  80243d:	41 89 c7             	mov    %eax,%r15d
+  802440:	85 c0                	test   %eax,%eax
+  802442:	0f 88 ae 01 00 00    	js     8025f6 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  802448:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80244c:	48 ba 20 50 80 00 00 	movabs $0x805020,%rdx
+  802453:	00 00 00 
+  802456:	8b 32                	mov    (%rdx),%esi
+  802458:	39 30                	cmp    %esi,(%rax)
+  80245a:	0f 85 7a 02 00 00    	jne    8026da <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  802460:	8b 40 08             	mov    0x8(%rax),%eax
+  802463:	83 e0 03             	and    $0x3,%eax
+  802466:	83 f8 01             	cmp    $0x1,%eax
+  802469:	0f 84 76 02 00 00    	je     8026e5 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80246f:	4d 85 ed             	test   %r13,%r13
+  802472:	0f 84 78 02 00 00    	je     8026f0 <mmap+0x2ee>
+  802478:	85 db                	test   %ebx,%ebx
+  80247a:	0f 88 70 02 00 00    	js     8026f0 <mmap+0x2ee>
+  802480:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  802486:	41 89 df             	mov    %ebx,%r15d
+  802489:	0f 85 6c 02 00 00    	jne    8026fb <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80248f:	44 89 f0             	mov    %r14d,%eax
+  802492:	83 e0 fd             	and    $0xfffffffd,%eax
+  802495:	83 f8 04             	cmp    $0x4,%eax
+  802498:	0f 85 68 02 00 00    	jne    802706 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80249e:	44 89 e1             	mov    %r12d,%ecx
+  8024a1:	83 e1 01             	and    $0x1,%ecx
+  8024a4:	0f 95 c2             	setne  %dl
+  8024a7:	44 89 e0             	mov    %r12d,%eax
+  8024aa:	d1 e8                	shr    %eax
+  8024ac:	83 f0 01             	xor    $0x1,%eax
+  8024af:	83 e0 01             	and    $0x1,%eax
+  8024b2:	38 c2                	cmp    %al,%dl
+  8024b4:	0f 85 57 02 00 00    	jne    802711 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8024ba:	85 c9                	test   %ecx,%ecx
+  8024bc:	74 0a                	je     8024c8 <mmap+0xc6>
+  8024be:	41 f6 c6 02          	test   $0x2,%r14b
+  8024c2:	0f 85 54 02 00 00    	jne    80271c <mmap+0x31a>
+    file_flush_buffers();
+  8024c8:	48 b8 7d 1f 80 00 00 	movabs $0x801f7d,%rax
+  8024cf:	00 00 00 
+  8024d2:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8024d4:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8024db:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8024e2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8024e6:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8024e9:	41 f6 c4 04          	test   $0x4,%r12b
+  8024ed:	0f 84 15 01 00 00    	je     802608 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8024f3:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8024f6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8024fc:	0f 85 25 02 00 00    	jne    802727 <mmap+0x325>
+  802502:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  802506:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80250d:	00 00 00 
+  802510:	48 39 c2             	cmp    %rax,%rdx
+  802513:	0f 82 19 02 00 00    	jb     802732 <mmap+0x330>
+  802519:	48 39 c7             	cmp    %rax,%rdi
+  80251c:	0f 87 10 02 00 00    	ja     802732 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  802522:	4c 89 ee             	mov    %r13,%rsi
+  802525:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  80252c:	00 00 00 
+  80252f:	ff d0                	call   *%rax
+  802531:	85 c0                	test   %eax,%eax
+  802533:	0f 88 04 02 00 00    	js     80273d <mmap+0x33b>
+    if (!handler) {
+  802539:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  802540:	00 00 00 
+  802543:	80 38 00             	cmpb   $0x0,(%rax)
+  802546:	75 2b                	jne    802573 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802548:	48 bf 1d 13 80 00 00 	movabs $0x80131d,%rdi
+  80254f:	00 00 00 
+  802552:	48 b8 7a 42 80 00 00 	movabs $0x80427a,%rax
+  802559:	00 00 00 
+  80255c:	ff d0                	call   *%rax
+  80255e:	85 c0                	test   %eax,%eax
+  802560:	0f 88 ea 01 00 00    	js     802750 <mmap+0x34e>
+        handler = 1;
+  802566:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80256d:	00 00 00 
+  802570:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  802573:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802577:	48 b8 bc 13 80 00 00 	movabs $0x8013bc,%rax
+  80257e:	00 00 00 
+  802581:	ff d0                	call   *%rax
+  802583:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  802586:	48 85 c0             	test   %rax,%rax
+  802589:	0f 84 c9 01 00 00    	je     802758 <mmap+0x356>
+    m->mm_start = va;
+  80258f:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  802592:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  802596:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80259a:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80259d:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8025a1:	44 89 e0             	mov    %r12d,%eax
+  8025a4:	c1 e0 06             	shl    $0x6,%eax
+  8025a7:	25 80 00 00 00       	and    $0x80,%eax
+  8025ac:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8025af:	09 f0                	or     %esi,%eax
+  8025b1:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8025b5:	41 f6 c4 08          	test   $0x8,%r12b
+  8025b9:	74 31                	je     8025ec <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025bb:	48 39 d3             	cmp    %rdx,%rbx
+  8025be:	73 2c                	jae    8025ec <mmap+0x1ea>
+  8025c0:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8025c5:	48 89 de             	mov    %rbx,%rsi
+  8025c8:	4c 89 f7             	mov    %r14,%rdi
+  8025cb:	48 b8 0c 12 80 00 00 	movabs $0x80120c,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+  8025d7:	49 89 c4             	mov    %rax,%r12
+  8025da:	48 85 c0             	test   %rax,%rax
+  8025dd:	0f 8e d7 00 00 00    	jle    8026ba <mmap+0x2b8>
+            va += n;
+  8025e3:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8025e6:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8025ea:	72 d4                	jb     8025c0 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8025ec:	49 8b 06             	mov    (%r14),%rax
+  8025ef:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8025f3:	48 89 06             	mov    %rax,(%rsi)
+}
+  8025f6:	44 89 f8             	mov    %r15d,%eax
+  8025f9:	48 83 c4 28          	add    $0x28,%rsp
+  8025fd:	5b                   	pop    %rbx
+  8025fe:	41 5c                	pop    %r12
+  802600:	41 5d                	pop    %r13
+  802602:	41 5e                	pop    %r14
+  802604:	41 5f                	pop    %r15
+  802606:	5d                   	pop    %rbp
+  802607:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802608:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80260f:	00 00 00 
+  802612:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  802615:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80261c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80261f:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802624:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  80262b:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80262e:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  802635:	00 00 00 
+  802638:	48 39 d7             	cmp    %rdx,%rdi
+  80263b:	73 1c                	jae    802659 <mmap+0x257>
+        return -E_NO_MEM;
+  80263d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802643:	eb b1                	jmp    8025f6 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  802645:	48 83 c0 01          	add    $0x1,%rax
+  802649:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80264d:	77 3f                	ja     80268e <mmap+0x28c>
+  80264f:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  802654:	48 39 d7             	cmp    %rdx,%rdi
+  802657:	72 2a                	jb     802683 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  802659:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80265d:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  802661:	48 39 d1             	cmp    %rdx,%rcx
+  802664:	73 df                	jae    802645 <mmap+0x243>
+  802666:	48 85 c9             	test   %rcx,%rcx
+  802669:	74 da                	je     802645 <mmap+0x243>
+  80266b:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80266f:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  802674:	48 39 d3             	cmp    %rdx,%rbx
+  802677:	73 cc                	jae    802645 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  802679:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80267c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802681:	eb cc                	jmp    80264f <mmap+0x24d>
+        return -E_NO_MEM;
+  802683:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  802689:	e9 68 ff ff ff       	jmp    8025f6 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80268e:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  802693:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80269a:	00 00 00 
+  80269d:	48 39 c2             	cmp    %rax,%rdx
+  8026a0:	0f 82 9f 00 00 00    	jb     802745 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8026a6:	48 85 db             	test   %rbx,%rbx
+  8026a9:	0f 85 8a fe ff ff    	jne    802539 <mmap+0x137>
+        return -E_NO_MEM;
+  8026af:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8026b5:	e9 3c ff ff ff       	jmp    8025f6 <mmap+0x1f4>
+        if (n < 0) {
+  8026ba:	0f 89 2c ff ff ff    	jns    8025ec <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8026c0:	49 8b 3e             	mov    (%r14),%rdi
+  8026c3:	4c 89 ee             	mov    %r13,%rsi
+  8026c6:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  8026cd:	00 00 00 
+  8026d0:	ff d0                	call   *%rax
+            return n;
+  8026d2:	45 89 e7             	mov    %r12d,%r15d
+  8026d5:	e9 1c ff ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8026da:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026e0:	e9 11 ff ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8026e5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026eb:	e9 06 ff ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8026f0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8026f6:	e9 fb fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+  8026fb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802701:	e9 f0 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  802706:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80270c:	e9 e5 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  802711:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802717:	e9 da fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80271c:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  802722:	e9 cf fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  802727:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80272d:	e9 c4 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+  802732:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  802738:	e9 b9 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80273d:	41 89 c7             	mov    %eax,%r15d
+  802740:	e9 b1 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+        return -E_NO_MEM;
+  802745:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80274b:	e9 a6 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  802750:	41 89 c7             	mov    %eax,%r15d
+  802753:	e9 9e fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  802758:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80275e:	e9 93 fe ff ff       	jmp    8025f6 <mmap+0x1f4>
+
+0000000000802763 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  802763:	55                   	push   %rbp
+  802764:	48 89 e5             	mov    %rsp,%rbp
+  802767:	41 54                	push   %r12
+  802769:	53                   	push   %rbx
+  80276a:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80276d:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802774:	00 00 00 
+  802777:	ff d0                	call   *%rax
+  802779:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80277c:	48 be 80 47 80 00 00 	movabs $0x804780,%rsi
+  802783:	00 00 00 
+  802786:	48 89 df             	mov    %rbx,%rdi
+  802789:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  802790:	00 00 00 
+  802793:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  802795:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80279a:	41 2b 04 24          	sub    (%r12),%eax
+  80279e:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8027a4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8027ab:	00 00 00 
+    stat->st_dev = &devpipe;
+  8027ae:	48 b8 60 50 80 00 00 	movabs $0x805060,%rax
+  8027b5:	00 00 00 
+  8027b8:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8027bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c4:	5b                   	pop    %rbx
+  8027c5:	41 5c                	pop    %r12
+  8027c7:	5d                   	pop    %rbp
+  8027c8:	c3                   	ret
+
+00000000008027c9 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027c9:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8027cc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8027d2:	8b 17                	mov    (%rdi),%edx
+  8027d4:	85 d2                	test   %edx,%edx
+  8027d6:	75 01                	jne    8027d9 <pipe_wakeup+0x10>
+  8027d8:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8027d9:	55                   	push   %rbp
+  8027da:	48 89 e5             	mov    %rsp,%rbp
+  8027dd:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8027e0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8027e6:	be 00 04 00 00       	mov    $0x400,%esi
+  8027eb:	48 b8 c2 05 80 00 00 	movabs $0x8005c2,%rax
+  8027f2:	00 00 00 
+  8027f5:	ff d0                	call   *%rax
+}
+  8027f7:	5d                   	pop    %rbp
+  8027f8:	c3                   	ret
+
+00000000008027f9 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8027f9:	55                   	push   %rbp
+  8027fa:	48 89 e5             	mov    %rsp,%rbp
+  8027fd:	41 55                	push   %r13
+  8027ff:	41 54                	push   %r12
+  802801:	53                   	push   %rbx
+  802802:	48 83 ec 08          	sub    $0x8,%rsp
+  802806:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802809:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802810:	00 00 00 
+  802813:	ff d0                	call   *%rax
+  802815:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802818:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80281d:	4c 89 e6             	mov    %r12,%rsi
+  802820:	bf 00 00 00 00       	mov    $0x0,%edi
+  802825:	49 bc dc 02 80 00 00 	movabs $0x8002dc,%r12
+  80282c:	00 00 00 
+  80282f:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  802832:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  802836:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80283a:	49 bd c9 27 80 00 00 	movabs $0x8027c9,%r13
+  802841:	00 00 00 
+  802844:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802847:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80284b:	48 89 de             	mov    %rbx,%rsi
+  80284e:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  802851:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802856:	48 89 de             	mov    %rbx,%rsi
+  802859:	bf 00 00 00 00       	mov    $0x0,%edi
+  80285e:	41 ff d4             	call   *%r12
+  802861:	48 83 c4 08          	add    $0x8,%rsp
+  802865:	5b                   	pop    %rbx
+  802866:	41 5c                	pop    %r12
+  802868:	41 5d                	pop    %r13
+  80286a:	5d                   	pop    %rbp
+  80286b:	c3                   	ret
+
+000000000080286c <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  80286c:	55                   	push   %rbp
+  80286d:	48 89 e5             	mov    %rsp,%rbp
+  802870:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  802873:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802878:	be 00 10 00 00       	mov    $0x1000,%esi
+  80287d:	48 b8 1f 02 80 00 00 	movabs $0x80021f,%rax
+  802884:	00 00 00 
+  802887:	ff d0                	call   *%rax
+  802889:	85 c0                	test   %eax,%eax
+  80288b:	0f 94 c0             	sete   %al
+  80288e:	0f b6 c0             	movzbl %al,%eax
+}
+  802891:	5d                   	pop    %rbp
+  802892:	c3                   	ret
+
+0000000000802893 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  802893:	55                   	push   %rbp
+  802894:	48 89 e5             	mov    %rsp,%rbp
+  802897:	41 57                	push   %r15
+  802899:	41 56                	push   %r14
+  80289b:	41 55                	push   %r13
+  80289d:	41 54                	push   %r12
+  80289f:	53                   	push   %rbx
+  8028a0:	48 83 ec 38          	sub    $0x38,%rsp
+  8028a4:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8028a8:	49 89 f4             	mov    %rsi,%r12
+  8028ab:	49 89 d7             	mov    %rdx,%r15
+  8028ae:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8028b2:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  8028b9:	00 00 00 
+  8028bc:	ff d0                	call   *%rax
+  8028be:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8028c1:	4d 85 ff             	test   %r15,%r15
+  8028c4:	0f 84 f1 00 00 00    	je     8029bb <devpipe_write+0x128>
+  8028ca:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8028ce:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8028d2:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8028d6:	49 bd 6c 28 80 00 00 	movabs $0x80286c,%r13
+  8028dd:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8028e0:	49 bf c9 27 80 00 00 	movabs $0x8027c9,%r15
+  8028e7:	00 00 00 
+  8028ea:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8028ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8028f2:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8028f6:	8b 73 04             	mov    0x4(%rbx),%esi
+  8028f9:	48 63 ce             	movslq %esi,%rcx
+  8028fc:	48 63 03             	movslq (%rbx),%rax
+  8028ff:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  802905:	48 39 c1             	cmp    %rax,%rcx
+  802908:	72 64                	jb     80296e <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80290a:	48 89 de             	mov    %rbx,%rsi
+  80290d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802911:	41 ff d5             	call   *%r13
+  802914:	85 c0                	test   %eax,%eax
+  802916:	0f 85 b9 00 00 00    	jne    8029d5 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80291c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802920:	4c 89 f7             	mov    %r14,%rdi
+  802923:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  802926:	8b 43 04             	mov    0x4(%rbx),%eax
+  802929:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  802930:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802937:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  80293d:	8b 03                	mov    (%rbx),%eax
+  80293f:	41 39 c4             	cmp    %eax,%r12d
+  802942:	75 b2                	jne    8028f6 <devpipe_write+0x63>
+  802944:	48 89 de             	mov    %rbx,%rsi
+  802947:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80294b:	41 ff d5             	call   *%r13
+  80294e:	85 c0                	test   %eax,%eax
+  802950:	75 a0                	jne    8028f2 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802952:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802957:	44 89 e6             	mov    %r12d,%esi
+  80295a:	48 89 df             	mov    %rbx,%rdi
+  80295d:	48 b8 a4 05 80 00 00 	movabs $0x8005a4,%rax
+  802964:	00 00 00 
+  802967:	ff d0                	call   *%rax
+  802969:	e9 7c ff ff ff       	jmp    8028ea <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  80296e:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  802972:	41 0f b6 38          	movzbl (%r8),%edi
+  802976:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80297d:	80 80 80 
+  802980:	48 89 c8             	mov    %rcx,%rax
+  802983:	48 f7 e2             	mul    %rdx
+  802986:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80298a:	48 89 d0             	mov    %rdx,%rax
+  80298d:	48 c1 e0 08          	shl    $0x8,%rax
+  802991:	48 29 d0             	sub    %rdx,%rax
+  802994:	48 c1 e0 04          	shl    $0x4,%rax
+  802998:	48 29 c1             	sub    %rax,%rcx
+  80299b:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  8029a0:	83 c6 01             	add    $0x1,%esi
+  8029a3:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8029a6:	49 83 c0 01          	add    $0x1,%r8
+  8029aa:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8029ae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8029b2:	49 39 c0             	cmp    %rax,%r8
+  8029b5:	0f 85 2f ff ff ff    	jne    8028ea <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8029bb:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8029bf:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8029c3:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  8029ca:	00 00 00 
+  8029cd:	ff d0                	call   *%rax
+    return n;
+  8029cf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8029d3:	eb 05                	jmp    8029da <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8029d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8029da:	48 83 c4 38          	add    $0x38,%rsp
+  8029de:	5b                   	pop    %rbx
+  8029df:	41 5c                	pop    %r12
+  8029e1:	41 5d                	pop    %r13
+  8029e3:	41 5e                	pop    %r14
+  8029e5:	41 5f                	pop    %r15
+  8029e7:	5d                   	pop    %rbp
+  8029e8:	c3                   	ret
+
+00000000008029e9 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8029e9:	55                   	push   %rbp
+  8029ea:	48 89 e5             	mov    %rsp,%rbp
+  8029ed:	41 57                	push   %r15
+  8029ef:	41 56                	push   %r14
+  8029f1:	41 55                	push   %r13
+  8029f3:	41 54                	push   %r12
+  8029f5:	53                   	push   %rbx
+  8029f6:	48 83 ec 28          	sub    $0x28,%rsp
+  8029fa:	49 89 fd             	mov    %rdi,%r13
+  8029fd:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802a01:	49 89 d4             	mov    %rdx,%r12
+  802a04:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  802a08:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+  802a14:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  802a17:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  802a1d:	49 bf 6c 28 80 00 00 	movabs $0x80286c,%r15
+  802a24:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  802a27:	4d 85 e4             	test   %r12,%r12
+  802a2a:	0f 84 d5 00 00 00    	je     802b05 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a30:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  802a34:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  802a38:	8b 03                	mov    (%rbx),%eax
+  802a3a:	3b 43 04             	cmp    0x4(%rbx),%eax
+  802a3d:	75 7a                	jne    802ab9 <devpipe_read+0xd0>
+            if (i > 0) {
+  802a3f:	4d 85 f6             	test   %r14,%r14
+  802a42:	75 50                	jne    802a94 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  802a44:	48 89 de             	mov    %rbx,%rsi
+  802a47:	4c 89 ef             	mov    %r13,%rdi
+  802a4a:	41 ff d7             	call   *%r15
+  802a4d:	85 c0                	test   %eax,%eax
+  802a4f:	0f 85 c9 00 00 00    	jne    802b1e <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  802a55:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  802a58:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  802a5f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  802a65:	8b 43 04             	mov    0x4(%rbx),%eax
+  802a68:	41 39 c4             	cmp    %eax,%r12d
+  802a6b:	75 cb                	jne    802a38 <devpipe_read+0x4f>
+  802a6d:	48 89 de             	mov    %rbx,%rsi
+  802a70:	4c 89 ef             	mov    %r13,%rdi
+  802a73:	41 ff d7             	call   *%r15
+  802a76:	85 c0                	test   %eax,%eax
+  802a78:	75 be                	jne    802a38 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  802a7a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  802a7f:	44 89 e6             	mov    %r12d,%esi
+  802a82:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802a86:	48 b8 a4 05 80 00 00 	movabs $0x8005a4,%rax
+  802a8d:	00 00 00 
+  802a90:	ff d0                	call   *%rax
+  802a92:	eb a4                	jmp    802a38 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802a94:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802a98:	48 89 de             	mov    %rbx,%rsi
+  802a9b:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  802aa2:	00 00 00 
+  802aa5:	ff d0                	call   *%rax
+                return i;
+  802aa7:	4c 89 f0             	mov    %r14,%rax
+}
+  802aaa:	48 83 c4 28          	add    $0x28,%rsp
+  802aae:	5b                   	pop    %rbx
+  802aaf:	41 5c                	pop    %r12
+  802ab1:	41 5d                	pop    %r13
+  802ab3:	41 5e                	pop    %r14
+  802ab5:	41 5f                	pop    %r15
+  802ab7:	5d                   	pop    %rbp
+  802ab8:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  802ab9:	48 63 c8             	movslq %eax,%rcx
+  802abc:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  802ac3:	80 80 80 
+  802ac6:	48 89 c8             	mov    %rcx,%rax
+  802ac9:	48 f7 e2             	mul    %rdx
+  802acc:	48 c1 ea 0b          	shr    $0xb,%rdx
+  802ad0:	48 89 d0             	mov    %rdx,%rax
+  802ad3:	48 c1 e0 08          	shl    $0x8,%rax
+  802ad7:	48 29 d0             	sub    %rdx,%rax
+  802ada:	48 c1 e0 04          	shl    $0x4,%rax
+  802ade:	48 89 c2             	mov    %rax,%rdx
+  802ae1:	48 89 c8             	mov    %rcx,%rax
+  802ae4:	48 29 d0             	sub    %rdx,%rax
+  802ae7:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  802aec:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802af0:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  802af4:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  802af7:	49 83 c6 01          	add    $0x1,%r14
+  802afb:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  802aff:	0f 85 2b ff ff ff    	jne    802a30 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  802b05:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  802b09:	48 89 de             	mov    %rbx,%rsi
+  802b0c:	48 b8 c9 27 80 00 00 	movabs $0x8027c9,%rax
+  802b13:	00 00 00 
+  802b16:	ff d0                	call   *%rax
+    return n;
+  802b18:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b1c:	eb 8c                	jmp    802aaa <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  802b1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b23:	eb 85                	jmp    802aaa <devpipe_read+0xc1>
+
+0000000000802b25 <pipe>:
+pipe(int pfd[2]) {
+  802b25:	55                   	push   %rbp
+  802b26:	48 89 e5             	mov    %rsp,%rbp
+  802b29:	41 55                	push   %r13
+  802b2b:	41 54                	push   %r12
+  802b2d:	53                   	push   %rbx
+  802b2e:	48 83 ec 18          	sub    $0x18,%rsp
+  802b32:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b35:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802b39:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  802b40:	00 00 00 
+  802b43:	ff d0                	call   *%rax
+  802b45:	89 c3                	mov    %eax,%ebx
+  802b47:	85 c0                	test   %eax,%eax
+  802b49:	0f 88 a0 01 00 00    	js     802cef <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  802b4f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b54:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b59:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802b5d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b62:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  802b69:	00 00 00 
+  802b6c:	ff d0                	call   *%rax
+  802b6e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  802b70:	85 c0                	test   %eax,%eax
+  802b72:	0f 88 77 01 00 00    	js     802cef <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802b78:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  802b7c:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  802b83:	00 00 00 
+  802b86:	ff d0                	call   *%rax
+  802b88:	89 c3                	mov    %eax,%ebx
+  802b8a:	85 c0                	test   %eax,%eax
+  802b8c:	0f 88 43 01 00 00    	js     802cd5 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  802b92:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802b97:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802b9c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802ba0:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba5:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  802bac:	00 00 00 
+  802baf:	ff d0                	call   *%rax
+  802bb1:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  802bb3:	85 c0                	test   %eax,%eax
+  802bb5:	0f 88 1a 01 00 00    	js     802cd5 <pipe+0x1b0>
+    va = fd2data(fd0);
+  802bbb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802bbf:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802bc6:	00 00 00 
+  802bc9:	ff d0                	call   *%rax
+  802bcb:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  802bce:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802bd3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802bd8:	48 89 c6             	mov    %rax,%rsi
+  802bdb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802be0:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  802be7:	00 00 00 
+  802bea:	ff d0                	call   *%rax
+  802bec:	89 c3                	mov    %eax,%ebx
+  802bee:	85 c0                	test   %eax,%eax
+  802bf0:	0f 88 c5 00 00 00    	js     802cbb <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  802bf6:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802bfa:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802c01:	00 00 00 
+  802c04:	ff d0                	call   *%rax
+  802c06:	48 89 c1             	mov    %rax,%rcx
+  802c09:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  802c0f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802c15:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c1a:	4c 89 ee             	mov    %r13,%rsi
+  802c1d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c22:	48 b8 8c 02 80 00 00 	movabs $0x80028c,%rax
+  802c29:	00 00 00 
+  802c2c:	ff d0                	call   *%rax
+  802c2e:	89 c3                	mov    %eax,%ebx
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	78 6e                	js     802ca2 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802c34:	be 00 10 00 00       	mov    $0x1000,%esi
+  802c39:	4c 89 ef             	mov    %r13,%rdi
+  802c3c:	48 b8 fb 01 80 00 00 	movabs $0x8001fb,%rax
+  802c43:	00 00 00 
+  802c46:	ff d0                	call   *%rax
+  802c48:	83 f8 02             	cmp    $0x2,%eax
+  802c4b:	0f 85 ab 00 00 00    	jne    802cfc <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  802c51:	a1 60 50 80 00 00 00 	movabs 0x805060,%eax
+  802c58:	00 00 
+  802c5a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c5e:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  802c60:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  802c64:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  802c6b:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  802c6f:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  802c71:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802c75:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  802c7c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802c80:	48 bb 69 06 80 00 00 	movabs $0x800669,%rbx
+  802c87:	00 00 00 
+  802c8a:	ff d3                	call   *%rbx
+  802c8c:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  802c90:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  802c94:	ff d3                	call   *%rbx
+  802c96:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  802c9b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802ca0:	eb 4d                	jmp    802cef <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  802ca2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802ca7:	4c 89 ee             	mov    %r13,%rsi
+  802caa:	bf 00 00 00 00       	mov    $0x0,%edi
+  802caf:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  802cb6:	00 00 00 
+  802cb9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  802cbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cc0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  802cc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc9:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  802cd0:	00 00 00 
+  802cd3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  802cd5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802cda:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802cde:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ce3:	48 b8 dc 02 80 00 00 	movabs $0x8002dc,%rax
+  802cea:	00 00 00 
+  802ced:	ff d0                	call   *%rax
+}
+  802cef:	89 d8                	mov    %ebx,%eax
+  802cf1:	48 83 c4 18          	add    $0x18,%rsp
+  802cf5:	5b                   	pop    %rbx
+  802cf6:	41 5c                	pop    %r12
+  802cf8:	41 5d                	pop    %r13
+  802cfa:	5d                   	pop    %rbp
+  802cfb:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  802cfc:	48 b9 b0 47 80 00 00 	movabs $0x8047b0,%rcx
+  802d03:	00 00 00 
+  802d06:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  802d0d:	00 00 00 
+  802d10:	be 50 00 00 00       	mov    $0x50,%esi
+  802d15:	48 bf 9c 47 80 00 00 	movabs $0x80479c,%rdi
+  802d1c:	00 00 00 
+  802d1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802d24:	49 b8 54 33 80 00 00 	movabs $0x803354,%r8
+  802d2b:	00 00 00 
+  802d2e:	41 ff d0             	call   *%r8
+
+0000000000802d31 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  802d31:	55                   	push   %rbp
+  802d32:	48 89 e5             	mov    %rsp,%rbp
+  802d35:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  802d39:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  802d3d:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  802d44:	00 00 00 
+  802d47:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  802d49:	85 c0                	test   %eax,%eax
+  802d4b:	78 23                	js     802d70 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  802d4d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d51:	48 b8 7b 06 80 00 00 	movabs $0x80067b,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+  802d5d:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  802d60:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  802d64:	48 b8 6c 28 80 00 00 	movabs $0x80286c,%rax
+  802d6b:	00 00 00 
+  802d6e:	ff d0                	call   *%rax
+}
+  802d70:	c9                   	leave
+  802d71:	c3                   	ret
+
+0000000000802d72 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802d72:	48 89 f8             	mov    %rdi,%rax
+  802d75:	48 c1 e8 27          	shr    $0x27,%rax
+  802d79:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802d80:	01 00 00 
+  802d83:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802d87:	f6 c2 01             	test   $0x1,%dl
+  802d8a:	74 6d                	je     802df9 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802d8c:	48 89 f8             	mov    %rdi,%rax
+  802d8f:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802d93:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802d9a:	01 00 00 
+  802d9d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802da1:	f6 c2 01             	test   $0x1,%dl
+  802da4:	74 62                	je     802e08 <get_uvpt_entry+0x96>
+  802da6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802dad:	01 00 00 
+  802db0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802db4:	f6 c2 80             	test   $0x80,%dl
+  802db7:	75 4f                	jne    802e08 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802db9:	48 89 f8             	mov    %rdi,%rax
+  802dbc:	48 c1 e8 15          	shr    $0x15,%rax
+  802dc0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dc7:	01 00 00 
+  802dca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802dce:	f6 c2 01             	test   $0x1,%dl
+  802dd1:	74 44                	je     802e17 <get_uvpt_entry+0xa5>
+  802dd3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802dda:	01 00 00 
+  802ddd:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  802de1:	f6 c2 80             	test   $0x80,%dl
+  802de4:	75 31                	jne    802e17 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  802de6:	48 c1 ef 0c          	shr    $0xc,%rdi
+  802dea:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  802df1:	01 00 00 
+  802df4:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  802df8:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  802df9:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  802e00:	01 00 00 
+  802e03:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e07:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  802e08:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  802e0f:	01 00 00 
+  802e12:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e16:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  802e17:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  802e1e:	01 00 00 
+  802e21:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  802e25:	c3                   	ret
+
+0000000000802e26 <get_prot>:
+
+int
+get_prot(void *va) {
+  802e26:	55                   	push   %rbp
+  802e27:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e2a:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  802e31:	00 00 00 
+  802e34:	ff d0                	call   *%rax
+  802e36:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  802e39:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  802e3e:	89 c1                	mov    %eax,%ecx
+  802e40:	83 c9 04             	or     $0x4,%ecx
+  802e43:	f6 c2 01             	test   $0x1,%dl
+  802e46:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  802e49:	89 c1                	mov    %eax,%ecx
+  802e4b:	83 c9 02             	or     $0x2,%ecx
+  802e4e:	f6 c2 02             	test   $0x2,%dl
+  802e51:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  802e54:	89 c1                	mov    %eax,%ecx
+  802e56:	83 c9 01             	or     $0x1,%ecx
+  802e59:	48 85 d2             	test   %rdx,%rdx
+  802e5c:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  802e5f:	89 c1                	mov    %eax,%ecx
+  802e61:	83 c9 40             	or     $0x40,%ecx
+  802e64:	f6 c6 04             	test   $0x4,%dh
+  802e67:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  802e6a:	5d                   	pop    %rbp
+  802e6b:	c3                   	ret
+
+0000000000802e6c <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  802e6c:	55                   	push   %rbp
+  802e6d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  802e70:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  802e77:	00 00 00 
+  802e7a:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  802e7c:	48 c1 e8 06          	shr    $0x6,%rax
+  802e80:	83 e0 01             	and    $0x1,%eax
+}
+  802e83:	5d                   	pop    %rbp
+  802e84:	c3                   	ret
+
+0000000000802e85 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  802e85:	55                   	push   %rbp
+  802e86:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  802e89:	48 b8 72 2d 80 00 00 	movabs $0x802d72,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	83 e0 01             	and    $0x1,%eax
+}
+  802e98:	5d                   	pop    %rbp
+  802e99:	c3                   	ret
+
+0000000000802e9a <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  802e9a:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  802ea1:	01 00 00 
+  802ea4:	a8 01                	test   $0x1,%al
+  802ea6:	75 06                	jne    802eae <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  802ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ead:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  802eae:	55                   	push   %rbp
+  802eaf:	48 89 e5             	mov    %rsp,%rbp
+  802eb2:	41 57                	push   %r15
+  802eb4:	41 56                	push   %r14
+  802eb6:	41 55                	push   %r13
+  802eb8:	41 54                	push   %r12
+  802eba:	53                   	push   %rbx
+  802ebb:	48 83 ec 28          	sub    $0x28,%rsp
+  802ebf:	49 89 fe             	mov    %rdi,%r14
+  802ec2:	49 89 f7             	mov    %rsi,%r15
+  802ec5:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  802ecc:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ecd:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  802ed4:	01 00 00 
+  802ed7:	e9 ae 00 00 00       	jmp    802f8a <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802edc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  802ee3:	49 83 ec 01          	sub    $0x1,%r12
+  802ee7:	74 2d                	je     802f16 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  802ee9:	48 89 d8             	mov    %rbx,%rax
+  802eec:	48 c1 e8 0c          	shr    $0xc,%rax
+  802ef0:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  802ef5:	f6 c2 01             	test   $0x1,%dl
+  802ef8:	74 e2                	je     802edc <foreach_shared_region+0x42>
+  802efa:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  802eff:	f6 c4 04             	test   $0x4,%ah
+  802f02:	74 d8                	je     802edc <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  802f04:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  802f0b:	4c 89 fa             	mov    %r15,%rdx
+  802f0e:	48 89 df             	mov    %rbx,%rdi
+  802f11:	41 ff d6             	call   *%r14
+  802f14:	eb c6                	jmp    802edc <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802f16:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  802f1d:	00 
+  802f1e:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  802f23:	74 4a                	je     802f6f <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  802f25:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f29:	48 c1 e8 15          	shr    $0x15,%rax
+  802f2d:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  802f34:	01 00 00 
+  802f37:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802f3b:	a8 01                	test   $0x1,%al
+  802f3d:	74 d7                	je     802f16 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  802f3f:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  802f43:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  802f4a:	48 39 c3             	cmp    %rax,%rbx
+  802f4d:	73 c7                	jae    802f16 <foreach_shared_region+0x7c>
+  802f4f:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  802f56:	48 39 d0             	cmp    %rdx,%rax
+  802f59:	4d 19 e4             	sbb    %r12,%r12
+  802f5c:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  802f63:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  802f6a:	e9 7a ff ff ff       	jmp    802ee9 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  802f6f:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  802f76:	40 
+  802f77:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802f7b:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  802f82:	00 00 00 
+  802f85:	48 39 c1             	cmp    %rax,%rcx
+  802f88:	74 50                	je     802fda <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  802f8a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  802f8e:	48 c1 e8 1e          	shr    $0x1e,%rax
+  802f92:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  802f99:	01 00 00 
+  802f9c:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  802fa0:	a8 01                	test   $0x1,%al
+  802fa2:	74 cb                	je     802f6f <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  802fa4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802fa8:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  802faf:	48 39 c1             	cmp    %rax,%rcx
+  802fb2:	73 bb                	jae    802f6f <foreach_shared_region+0xd5>
+  802fb4:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  802fbb:	48 39 d0             	cmp    %rdx,%rax
+  802fbe:	48 19 c0             	sbb    %rax,%rax
+  802fc1:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  802fc7:	48 05 00 02 00 00    	add    $0x200,%rax
+  802fcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fd1:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  802fd5:	e9 4b ff ff ff       	jmp    802f25 <foreach_shared_region+0x8b>
+  802fda:	b8 00 00 00 00       	mov    $0x0,%eax
+  802fdf:	48 83 c4 28          	add    $0x28,%rsp
+  802fe3:	5b                   	pop    %rbx
+  802fe4:	41 5c                	pop    %r12
+  802fe6:	41 5d                	pop    %r13
+  802fe8:	41 5e                	pop    %r14
+  802fea:	41 5f                	pop    %r15
+  802fec:	5d                   	pop    %rbp
+  802fed:	c3                   	ret
+
+0000000000802fee <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  802fee:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  802ff4:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  802ffb:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  803002:	c3                   	ret
+
+0000000000803003 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  803003:	8b 47 40             	mov    0x40(%rdi),%eax
+  803006:	8b 17                	mov    (%rdi),%edx
+  803008:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80300a:	83 f8 0f             	cmp    $0xf,%eax
+  80300d:	77 13                	ja     803022 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80300f:	8b 47 40             	mov    0x40(%rdi),%eax
+  803012:	83 e0 0f             	and    $0xf,%eax
+  803015:	48 c1 e0 09          	shl    $0x9,%rax
+  803019:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803020:	00 
+  803021:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  803022:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803027:	c3                   	ret
+
+0000000000803028 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  803028:	8b 47 40             	mov    0x40(%rdi),%eax
+  80302b:	83 c0 01             	add    $0x1,%eax
+  80302e:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803031:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803037:	8b 57 04             	mov    0x4(%rdi),%edx
+  80303a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80303f:	85 d2                	test   %edx,%edx
+  803041:	75 04                	jne    803047 <chan_publish+0x1f>
+  803043:	83 e0 01             	and    $0x1,%eax
+}
+  803046:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  803047:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80304a:	85 c0                	test   %eax,%eax
+  80304c:	0f 95 c0             	setne  %al
+  80304f:	0f b6 c0             	movzbl %al,%eax
+  803052:	eb ef                	jmp    803043 <chan_publish+0x1b>
+
+0000000000803054 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  803054:	8b 47 40             	mov    0x40(%rdi),%eax
+  803057:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803059:	29 d0                	sub    %edx,%eax
+  80305b:	83 e8 01             	sub    $0x1,%eax
+  80305e:	83 f8 0f             	cmp    $0xf,%eax
+  803061:	77 12                	ja     803075 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  803063:	8b 07                	mov    (%rdi),%eax
+  803065:	83 e0 0f             	and    $0xf,%eax
+  803068:	48 c1 e0 09          	shl    $0x9,%rax
+  80306c:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  803073:	00 
+  803074:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  803075:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80307a:	c3                   	ret
+
+000000000080307b <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80307b:	8b 07                	mov    (%rdi),%eax
+  80307d:	83 c0 01             	add    $0x1,%eax
+  803080:	89 07                	mov    %eax,(%rdi)
+}
+  803082:	c3                   	ret
+
+0000000000803083 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  803083:	55                   	push   %rbp
+  803084:	48 89 e5             	mov    %rsp,%rbp
+  803087:	53                   	push   %rbx
+  803088:	48 83 ec 08          	sub    $0x8,%rsp
+  80308c:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80308f:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803096:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80309c:	48 b8 54 30 80 00 00 	movabs $0x803054,%rax
+  8030a3:	00 00 00 
+  8030a6:	ff d0                	call   *%rax
+  8030a8:	48 85 c0             	test   %rax,%rax
+  8030ab:	74 12                	je     8030bf <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8030ad:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8030b4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8030b9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8030bd:	c9                   	leave
+  8030be:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8030bf:	b8 01 00 00 00       	mov    $0x1,%eax
+  8030c4:	eb f3                	jmp    8030b9 <chan_arm+0x36>
+
+00000000008030c6 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8030c6:	55                   	push   %rbp
+  8030c7:	48 89 e5             	mov    %rsp,%rbp
+  8030ca:	41 56                	push   %r14
+  8030cc:	41 55                	push   %r13
+  8030ce:	41 54                	push   %r12
+  8030d0:	53                   	push   %rbx
+  8030d1:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8030d4:	49 bc 83 30 80 00 00 	movabs $0x803083,%r12
+  8030db:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030de:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8030e2:	49 bd a4 05 80 00 00 	movabs $0x8005a4,%r13
+  8030e9:	00 00 00 
+    while (chan_arm(r))
+  8030ec:	eb 0d                	jmp    8030fb <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8030ee:	8b 33                	mov    (%rbx),%esi
+  8030f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030f5:	4c 89 f7             	mov    %r14,%rdi
+  8030f8:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8030fb:	48 89 df             	mov    %rbx,%rdi
+  8030fe:	41 ff d4             	call   *%r12
+  803101:	84 c0                	test   %al,%al
+  803103:	75 e9                	jne    8030ee <chan_wait+0x28>
+}
+  803105:	5b                   	pop    %rbx
+  803106:	41 5c                	pop    %r12
+  803108:	41 5d                	pop    %r13
+  80310a:	41 5e                	pop    %r14
+  80310c:	5d                   	pop    %rbp
+  80310d:	c3                   	ret
+
+000000000080310e <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80310e:	55                   	push   %rbp
+  80310f:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  803112:	48 83 c7 40          	add    $0x40,%rdi
+  803116:	be 01 00 00 00       	mov    $0x1,%esi
+  80311b:	48 b8 c2 05 80 00 00 	movabs $0x8005c2,%rax
+  803122:	00 00 00 
+  803125:	ff d0                	call   *%rax
+}
+  803127:	5d                   	pop    %rbp
+  803128:	c3                   	ret
+
+0000000000803129 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  803129:	b8 00 00 00 00       	mov    $0x0,%eax
+  80312e:	c3                   	ret
+
+000000000080312f <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80312f:	55                   	push   %rbp
+  803130:	48 89 e5             	mov    %rsp,%rbp
+  803133:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  803136:	48 be d4 47 80 00 00 	movabs $0x8047d4,%rsi
+  80313d:	00 00 00 
+  803140:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  803147:	00 00 00 
+  80314a:	ff d0                	call   *%rax
+    return 0;
+}
+  80314c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803151:	5d                   	pop    %rbp
+  803152:	c3                   	ret
+
+0000000000803153 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803153:	55                   	push   %rbp
+  803154:	48 89 e5             	mov    %rsp,%rbp
+  803157:	41 57                	push   %r15
+  803159:	41 56                	push   %r14
+  80315b:	41 55                	push   %r13
+  80315d:	41 54                	push   %r12
+  80315f:	53                   	push   %rbx
+  803160:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  803167:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80316e:	48 85 d2             	test   %rdx,%rdx
+  803171:	74 7a                	je     8031ed <devcons_write+0x9a>
+  803173:	49 89 d6             	mov    %rdx,%r14
+  803176:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80317c:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  803181:	49 bf c3 3f 80 00 00 	movabs $0x803fc3,%r15
+  803188:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80318b:	4c 89 f3             	mov    %r14,%rbx
+  80318e:	48 29 f3             	sub    %rsi,%rbx
+  803191:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  803196:	48 39 c3             	cmp    %rax,%rbx
+  803199:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80319d:	4c 63 eb             	movslq %ebx,%r13
+  8031a0:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8031a7:	48 01 c6             	add    %rax,%rsi
+  8031aa:	4c 89 ea             	mov    %r13,%rdx
+  8031ad:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031b4:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8031b7:	4c 89 ee             	mov    %r13,%rsi
+  8031ba:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8031c1:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  8031c8:	00 00 00 
+  8031cb:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8031cd:	41 01 dc             	add    %ebx,%r12d
+  8031d0:	49 63 f4             	movslq %r12d,%rsi
+  8031d3:	4c 39 f6             	cmp    %r14,%rsi
+  8031d6:	72 b3                	jb     80318b <devcons_write+0x38>
+    return res;
+  8031d8:	49 63 c4             	movslq %r12d,%rax
+}
+  8031db:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8031e2:	5b                   	pop    %rbx
+  8031e3:	41 5c                	pop    %r12
+  8031e5:	41 5d                	pop    %r13
+  8031e7:	41 5e                	pop    %r14
+  8031e9:	41 5f                	pop    %r15
+  8031eb:	5d                   	pop    %rbp
+  8031ec:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8031ed:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8031f3:	eb e3                	jmp    8031d8 <devcons_write+0x85>
+
+00000000008031f5 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8031f5:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8031f8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fd:	48 85 c0             	test   %rax,%rax
+  803200:	74 55                	je     803257 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+  803206:	41 55                	push   %r13
+  803208:	41 54                	push   %r12
+  80320a:	53                   	push   %rbx
+  80320b:	48 83 ec 08          	sub    $0x8,%rsp
+  80320f:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  803212:	48 bb 1d 01 80 00 00 	movabs $0x80011d,%rbx
+  803219:	00 00 00 
+  80321c:	49 bc d2 01 80 00 00 	movabs $0x8001d2,%r12
+  803223:	00 00 00 
+  803226:	eb 03                	jmp    80322b <devcons_read+0x36>
+  803228:	41 ff d4             	call   *%r12
+  80322b:	ff d3                	call   *%rbx
+  80322d:	85 c0                	test   %eax,%eax
+  80322f:	74 f7                	je     803228 <devcons_read+0x33>
+    if (c < 0) return c;
+  803231:	48 63 d0             	movslq %eax,%rdx
+  803234:	78 13                	js     803249 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  803236:	ba 00 00 00 00       	mov    $0x0,%edx
+  80323b:	83 f8 04             	cmp    $0x4,%eax
+  80323e:	74 09                	je     803249 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  803240:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  803244:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  803249:	48 89 d0             	mov    %rdx,%rax
+  80324c:	48 83 c4 08          	add    $0x8,%rsp
+  803250:	5b                   	pop    %rbx
+  803251:	41 5c                	pop    %r12
+  803253:	41 5d                	pop    %r13
+  803255:	5d                   	pop    %rbp
+  803256:	c3                   	ret
+  803257:	48 89 d0             	mov    %rdx,%rax
+  80325a:	c3                   	ret
+
+000000000080325b <cputchar>:
+cputchar(int ch) {
+  80325b:	55                   	push   %rbp
+  80325c:	48 89 e5             	mov    %rsp,%rbp
+  80325f:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  803263:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  803267:	be 01 00 00 00       	mov    $0x1,%esi
+  80326c:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  803270:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  803277:	00 00 00 
+  80327a:	ff d0                	call   *%rax
+}
+  80327c:	c9                   	leave
+  80327d:	c3                   	ret
+
+000000000080327e <getchar>:
+getchar(void) {
+  80327e:	55                   	push   %rbp
+  80327f:	48 89 e5             	mov    %rsp,%rbp
+  803282:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  803286:	ba 01 00 00 00       	mov    $0x1,%edx
+  80328b:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80328f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803294:	48 b8 da 09 80 00 00 	movabs $0x8009da,%rax
+  80329b:	00 00 00 
+  80329e:	ff d0                	call   *%rax
+  8032a0:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8032a2:	85 c0                	test   %eax,%eax
+  8032a4:	78 06                	js     8032ac <getchar+0x2e>
+  8032a6:	74 08                	je     8032b0 <getchar+0x32>
+  8032a8:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8032ac:	89 d0                	mov    %edx,%eax
+  8032ae:	c9                   	leave
+  8032af:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8032b0:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8032b5:	eb f5                	jmp    8032ac <getchar+0x2e>
+
+00000000008032b7 <iscons>:
+iscons(int fdnum) {
+  8032b7:	55                   	push   %rbp
+  8032b8:	48 89 e5             	mov    %rsp,%rbp
+  8032bb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8032bf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8032c3:	48 b8 f7 06 80 00 00 	movabs $0x8006f7,%rax
+  8032ca:	00 00 00 
+  8032cd:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032cf:	85 c0                	test   %eax,%eax
+  8032d1:	78 18                	js     8032eb <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8032d3:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8032d7:	48 b8 a0 50 80 00 00 	movabs $0x8050a0,%rax
+  8032de:	00 00 00 
+  8032e1:	8b 00                	mov    (%rax),%eax
+  8032e3:	39 02                	cmp    %eax,(%rdx)
+  8032e5:	0f 94 c0             	sete   %al
+  8032e8:	0f b6 c0             	movzbl %al,%eax
+}
+  8032eb:	c9                   	leave
+  8032ec:	c3                   	ret
+
+00000000008032ed <opencons>:
+opencons(void) {
+  8032ed:	55                   	push   %rbp
+  8032ee:	48 89 e5             	mov    %rsp,%rbp
+  8032f1:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032f5:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8032f9:	48 b8 97 06 80 00 00 	movabs $0x800697,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+  803305:	85 c0                	test   %eax,%eax
+  803307:	78 49                	js     803352 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  803309:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80330e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803313:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  803317:	bf 00 00 00 00       	mov    $0x0,%edi
+  80331c:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+  803328:	85 c0                	test   %eax,%eax
+  80332a:	78 26                	js     803352 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80332c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803330:	a1 a0 50 80 00 00 00 	movabs 0x8050a0,%eax
+  803337:	00 00 
+  803339:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80333b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80333f:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  803346:	48 b8 69 06 80 00 00 	movabs $0x800669,%rax
+  80334d:	00 00 00 
+  803350:	ff d0                	call   *%rax
+}
+  803352:	c9                   	leave
+  803353:	c3                   	ret
+
+0000000000803354 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  803354:	55                   	push   %rbp
+  803355:	48 89 e5             	mov    %rsp,%rbp
+  803358:	41 56                	push   %r14
+  80335a:	41 55                	push   %r13
+  80335c:	41 54                	push   %r12
+  80335e:	53                   	push   %rbx
+  80335f:	48 83 ec 50          	sub    $0x50,%rsp
+  803363:	49 89 fc             	mov    %rdi,%r12
+  803366:	41 89 f5             	mov    %esi,%r13d
+  803369:	48 89 d3             	mov    %rdx,%rbx
+  80336c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  803370:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  803374:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803378:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80337f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803383:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  803387:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  80338b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80338f:	48 b8 00 50 80 00 00 	movabs $0x805000,%rax
+  803396:	00 00 00 
+  803399:	4c 8b 30             	mov    (%rax),%r14
+  80339c:	48 b8 a9 01 80 00 00 	movabs $0x8001a9,%rax
+  8033a3:	00 00 00 
+  8033a6:	ff d0                	call   *%rax
+  8033a8:	89 c6                	mov    %eax,%esi
+  8033aa:	45 89 e8             	mov    %r13d,%r8d
+  8033ad:	4c 89 e1             	mov    %r12,%rcx
+  8033b0:	4c 89 f2             	mov    %r14,%rdx
+  8033b3:	48 bf e0 47 80 00 00 	movabs $0x8047e0,%rdi
+  8033ba:	00 00 00 
+  8033bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033c2:	49 bc a4 34 80 00 00 	movabs $0x8034a4,%r12
+  8033c9:	00 00 00 
+  8033cc:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8033cf:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8033d3:	48 89 df             	mov    %rbx,%rdi
+  8033d6:	48 b8 40 34 80 00 00 	movabs $0x803440,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+    cprintf("\n");
+  8033e2:	48 bf 23 47 80 00 00 	movabs $0x804723,%rdi
+  8033e9:	00 00 00 
+  8033ec:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033f1:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8033f4:	cc                   	int3
+  8033f5:	eb fd                	jmp    8033f4 <_panic+0xa0>
+
+00000000008033f7 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8033f7:	55                   	push   %rbp
+  8033f8:	48 89 e5             	mov    %rsp,%rbp
+  8033fb:	53                   	push   %rbx
+  8033fc:	48 83 ec 08          	sub    $0x8,%rsp
+  803400:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  803403:	8b 06                	mov    (%rsi),%eax
+  803405:	8d 50 01             	lea    0x1(%rax),%edx
+  803408:	89 16                	mov    %edx,(%rsi)
+  80340a:	48 98                	cltq
+  80340c:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  803411:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  803417:	74 0a                	je     803423 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  803419:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80341d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803421:	c9                   	leave
+  803422:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  803423:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  803427:	be ff 00 00 00       	mov    $0xff,%esi
+  80342c:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+        state->offset = 0;
+  803438:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80343e:	eb d9                	jmp    803419 <putch+0x22>
+
+0000000000803440 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  803440:	55                   	push   %rbp
+  803441:	48 89 e5             	mov    %rsp,%rbp
+  803444:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80344b:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80344e:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  803455:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80345a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80345f:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  803462:	48 89 f1             	mov    %rsi,%rcx
+  803465:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80346c:	48 bf f7 33 80 00 00 	movabs $0x8033f7,%rdi
+  803473:	00 00 00 
+  803476:	48 b8 f4 35 80 00 00 	movabs $0x8035f4,%rax
+  80347d:	00 00 00 
+  803480:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  803482:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  803489:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  803490:	48 b8 fe 00 80 00 00 	movabs $0x8000fe,%rax
+  803497:	00 00 00 
+  80349a:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80349c:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8034a2:	c9                   	leave
+  8034a3:	c3                   	ret
+
+00000000008034a4 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8034a4:	55                   	push   %rbp
+  8034a5:	48 89 e5             	mov    %rsp,%rbp
+  8034a8:	48 83 ec 50          	sub    $0x50,%rsp
+  8034ac:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8034b0:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8034b4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8034b8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8034bc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8034c0:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8034c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8034cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8034cf:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8034d3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8034d7:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8034db:	48 b8 40 34 80 00 00 	movabs $0x803440,%rax
+  8034e2:	00 00 00 
+  8034e5:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8034e7:	c9                   	leave
+  8034e8:	c3                   	ret
+
+00000000008034e9 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8034e9:	55                   	push   %rbp
+  8034ea:	48 89 e5             	mov    %rsp,%rbp
+  8034ed:	41 57                	push   %r15
+  8034ef:	41 56                	push   %r14
+  8034f1:	41 55                	push   %r13
+  8034f3:	41 54                	push   %r12
+  8034f5:	53                   	push   %rbx
+  8034f6:	48 83 ec 18          	sub    $0x18,%rsp
+  8034fa:	49 89 fc             	mov    %rdi,%r12
+  8034fd:	49 89 f5             	mov    %rsi,%r13
+  803500:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  803504:	8b 45 10             	mov    0x10(%rbp),%eax
+  803507:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80350a:	41 89 cf             	mov    %ecx,%r15d
+  80350d:	4c 39 fa             	cmp    %r15,%rdx
+  803510:	73 5b                	jae    80356d <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  803512:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  803516:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80351a:	85 db                	test   %ebx,%ebx
+  80351c:	7e 0e                	jle    80352c <print_num+0x43>
+            putch(padc, put_arg);
+  80351e:	4c 89 ee             	mov    %r13,%rsi
+  803521:	44 89 f7             	mov    %r14d,%edi
+  803524:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  803527:	83 eb 01             	sub    $0x1,%ebx
+  80352a:	75 f2                	jne    80351e <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80352c:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  803530:	48 b9 14 48 80 00 00 	movabs $0x804814,%rcx
+  803537:	00 00 00 
+  80353a:	48 b8 03 48 80 00 00 	movabs $0x804803,%rax
+  803541:	00 00 00 
+  803544:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  803548:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80354c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803551:	49 f7 f7             	div    %r15
+  803554:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  803558:	4c 89 ee             	mov    %r13,%rsi
+  80355b:	41 ff d4             	call   *%r12
+}
+  80355e:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803562:	5b                   	pop    %rbx
+  803563:	41 5c                	pop    %r12
+  803565:	41 5d                	pop    %r13
+  803567:	41 5e                	pop    %r14
+  803569:	41 5f                	pop    %r15
+  80356b:	5d                   	pop    %rbp
+  80356c:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80356d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803571:	ba 00 00 00 00       	mov    $0x0,%edx
+  803576:	49 f7 f7             	div    %r15
+  803579:	48 83 ec 08          	sub    $0x8,%rsp
+  80357d:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  803581:	52                   	push   %rdx
+  803582:	45 0f be c9          	movsbl %r9b,%r9d
+  803586:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80358a:	48 89 c2             	mov    %rax,%rdx
+  80358d:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803594:	00 00 00 
+  803597:	ff d0                	call   *%rax
+  803599:	48 83 c4 10          	add    $0x10,%rsp
+  80359d:	eb 8d                	jmp    80352c <print_num+0x43>
+
+000000000080359f <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80359f:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8035a3:	48 8b 06             	mov    (%rsi),%rax
+  8035a6:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8035aa:	73 0a                	jae    8035b6 <sprintputch+0x17>
+        *state->start++ = ch;
+  8035ac:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8035b0:	48 89 16             	mov    %rdx,(%rsi)
+  8035b3:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8035b6:	c3                   	ret
+
+00000000008035b7 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8035b7:	55                   	push   %rbp
+  8035b8:	48 89 e5             	mov    %rsp,%rbp
+  8035bb:	48 83 ec 50          	sub    $0x50,%rsp
+  8035bf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8035c3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8035c7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8035cb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8035d2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8035d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8035da:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8035de:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8035e2:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8035e6:	48 b8 f4 35 80 00 00 	movabs $0x8035f4,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+}
+  8035f2:	c9                   	leave
+  8035f3:	c3                   	ret
+
+00000000008035f4 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8035f4:	55                   	push   %rbp
+  8035f5:	48 89 e5             	mov    %rsp,%rbp
+  8035f8:	41 57                	push   %r15
+  8035fa:	41 56                	push   %r14
+  8035fc:	41 55                	push   %r13
+  8035fe:	41 54                	push   %r12
+  803600:	53                   	push   %rbx
+  803601:	48 83 ec 38          	sub    $0x38,%rsp
+  803605:	49 89 fe             	mov    %rdi,%r14
+  803608:	49 89 f5             	mov    %rsi,%r13
+  80360b:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80360e:	48 8b 01             	mov    (%rcx),%rax
+  803611:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  803615:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  803619:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80361d:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  803621:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  803625:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  803629:	0f b6 3b             	movzbl (%rbx),%edi
+  80362c:	40 80 ff 25          	cmp    $0x25,%dil
+  803630:	74 18                	je     80364a <vprintfmt+0x56>
+            if (!ch) return;
+  803632:	40 84 ff             	test   %dil,%dil
+  803635:	0f 84 b1 06 00 00    	je     803cec <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80363b:	40 0f b6 ff          	movzbl %dil,%edi
+  80363f:	4c 89 ee             	mov    %r13,%rsi
+  803642:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  803645:	4c 89 e3             	mov    %r12,%rbx
+  803648:	eb db                	jmp    803625 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80364a:	be 00 00 00 00       	mov    $0x0,%esi
+  80364f:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  803653:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  803658:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80365e:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  803665:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  803669:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80366e:	41 0f b6 04 24       	movzbl (%r12),%eax
+  803673:	88 45 a0             	mov    %al,-0x60(%rbp)
+  803676:	83 e8 23             	sub    $0x23,%eax
+  803679:	3c 57                	cmp    $0x57,%al
+  80367b:	0f 87 51 06 00 00    	ja     803cd2 <vprintfmt+0x6de>
+  803681:	0f b6 c0             	movzbl %al,%eax
+  803684:	48 b9 c0 49 80 00 00 	movabs $0x8049c0,%rcx
+  80368b:	00 00 00 
+  80368e:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  803691:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  803694:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  803698:	eb cf                	jmp    803669 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  80369a:	49 89 dc             	mov    %rbx,%r12
+  80369d:	be 01 00 00 00       	mov    $0x1,%esi
+  8036a2:	eb c5                	jmp    803669 <vprintfmt+0x75>
+            padc = ch;
+  8036a4:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8036a8:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8036ab:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8036ae:	eb b9                	jmp    803669 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8036b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8036b6:	77 24                	ja     8036dc <vprintfmt+0xe8>
+  8036b8:	89 c1                	mov    %eax,%ecx
+  8036ba:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8036be:	83 c0 08             	add    $0x8,%eax
+  8036c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8036c4:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8036c7:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8036ca:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8036ce:	79 99                	jns    803669 <vprintfmt+0x75>
+                width = precision;
+  8036d0:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8036d4:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8036da:	eb 8d                	jmp    803669 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8036dc:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8036e0:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8036e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8036e8:	eb da                	jmp    8036c4 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8036ea:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8036ef:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8036f3:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8036f9:	3c 39                	cmp    $0x39,%al
+  8036fb:	77 1c                	ja     803719 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8036fd:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  803701:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  803705:	0f b6 c0             	movzbl %al,%eax
+  803708:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80370d:	0f b6 03             	movzbl (%rbx),%eax
+  803710:	3c 39                	cmp    $0x39,%al
+  803712:	76 e9                	jbe    8036fd <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  803714:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  803717:	eb b1                	jmp    8036ca <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  803719:	49 89 dc             	mov    %rbx,%r12
+  80371c:	eb ac                	jmp    8036ca <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80371e:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  803721:	85 c9                	test   %ecx,%ecx
+  803723:	b8 00 00 00 00       	mov    $0x0,%eax
+  803728:	0f 49 c1             	cmovns %ecx,%eax
+  80372b:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80372e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  803731:	e9 33 ff ff ff       	jmp    803669 <vprintfmt+0x75>
+            lflag++;
+  803736:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  803739:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80373c:	e9 28 ff ff ff       	jmp    803669 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  803741:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803744:	83 f8 2f             	cmp    $0x2f,%eax
+  803747:	77 19                	ja     803762 <vprintfmt+0x16e>
+  803749:	89 c2                	mov    %eax,%edx
+  80374b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80374f:	83 c0 08             	add    $0x8,%eax
+  803752:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803755:	8b 3a                	mov    (%rdx),%edi
+  803757:	4c 89 ee             	mov    %r13,%rsi
+  80375a:	41 ff d6             	call   *%r14
+            break;
+  80375d:	e9 c3 fe ff ff       	jmp    803625 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  803762:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803766:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80376a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80376e:	eb e5                	jmp    803755 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  803770:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803773:	83 f8 2f             	cmp    $0x2f,%eax
+  803776:	77 5a                	ja     8037d2 <vprintfmt+0x1de>
+  803778:	89 c2                	mov    %eax,%edx
+  80377a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80377e:	83 c0 08             	add    $0x8,%eax
+  803781:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  803784:	8b 02                	mov    (%rdx),%eax
+  803786:	89 c1                	mov    %eax,%ecx
+  803788:	f7 d9                	neg    %ecx
+  80378a:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80378d:	83 f9 16             	cmp    $0x16,%ecx
+  803790:	7f 4e                	jg     8037e0 <vprintfmt+0x1ec>
+  803792:	48 63 c1             	movslq %ecx,%rax
+  803795:	48 ba 80 4c 80 00 00 	movabs $0x804c80,%rdx
+  80379c:	00 00 00 
+  80379f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8037a3:	48 85 c0             	test   %rax,%rax
+  8037a6:	74 38                	je     8037e0 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8037a8:	48 89 c1             	mov    %rax,%rcx
+  8037ab:	48 ba 99 47 80 00 00 	movabs $0x804799,%rdx
+  8037b2:	00 00 00 
+  8037b5:	4c 89 ee             	mov    %r13,%rsi
+  8037b8:	4c 89 f7             	mov    %r14,%rdi
+  8037bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037c0:	49 b8 b7 35 80 00 00 	movabs $0x8035b7,%r8
+  8037c7:	00 00 00 
+  8037ca:	41 ff d0             	call   *%r8
+  8037cd:	e9 53 fe ff ff       	jmp    803625 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8037d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8037d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8037da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8037de:	eb a4                	jmp    803784 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8037e0:	48 ba 2c 48 80 00 00 	movabs $0x80482c,%rdx
+  8037e7:	00 00 00 
+  8037ea:	4c 89 ee             	mov    %r13,%rsi
+  8037ed:	4c 89 f7             	mov    %r14,%rdi
+  8037f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8037f5:	49 b8 b7 35 80 00 00 	movabs $0x8035b7,%r8
+  8037fc:	00 00 00 
+  8037ff:	41 ff d0             	call   *%r8
+  803802:	e9 1e fe ff ff       	jmp    803625 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  803807:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80380a:	83 f8 2f             	cmp    $0x2f,%eax
+  80380d:	77 6c                	ja     80387b <vprintfmt+0x287>
+  80380f:	89 c2                	mov    %eax,%edx
+  803811:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803815:	83 c0 08             	add    $0x8,%eax
+  803818:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80381b:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80381e:	48 85 d2             	test   %rdx,%rdx
+  803821:	48 b8 25 48 80 00 00 	movabs $0x804825,%rax
+  803828:	00 00 00 
+  80382b:	48 0f 45 c2          	cmovne %rdx,%rax
+  80382f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  803833:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  803837:	7e 06                	jle    80383f <vprintfmt+0x24b>
+  803839:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80383d:	75 4a                	jne    803889 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80383f:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803843:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  803847:	0f b6 00             	movzbl (%rax),%eax
+  80384a:	84 c0                	test   %al,%al
+  80384c:	0f 85 9a 00 00 00    	jne    8038ec <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  803852:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  803855:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  803859:	85 c0                	test   %eax,%eax
+  80385b:	0f 8e c4 fd ff ff    	jle    803625 <vprintfmt+0x31>
+  803861:	4c 89 ee             	mov    %r13,%rsi
+  803864:	bf 20 00 00 00       	mov    $0x20,%edi
+  803869:	41 ff d6             	call   *%r14
+  80386c:	41 83 ec 01          	sub    $0x1,%r12d
+  803870:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803874:	75 eb                	jne    803861 <vprintfmt+0x26d>
+  803876:	e9 aa fd ff ff       	jmp    803625 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80387b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80387f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803883:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803887:	eb 92                	jmp    80381b <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  803889:	49 63 f7             	movslq %r15d,%rsi
+  80388c:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  803890:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  803897:	00 00 00 
+  80389a:	ff d0                	call   *%rax
+  80389c:	48 89 c2             	mov    %rax,%rdx
+  80389f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038a2:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8038a4:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8038a7:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8038aa:	85 c0                	test   %eax,%eax
+  8038ac:	7e 91                	jle    80383f <vprintfmt+0x24b>
+  8038ae:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8038b3:	4c 89 ee             	mov    %r13,%rsi
+  8038b6:	44 89 e7             	mov    %r12d,%edi
+  8038b9:	41 ff d6             	call   *%r14
+  8038bc:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038c0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8038c3:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8038c6:	75 eb                	jne    8038b3 <vprintfmt+0x2bf>
+  8038c8:	e9 72 ff ff ff       	jmp    80383f <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038cd:	0f b6 f8             	movzbl %al,%edi
+  8038d0:	4c 89 ee             	mov    %r13,%rsi
+  8038d3:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8038d6:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8038da:	49 83 c4 01          	add    $0x1,%r12
+  8038de:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8038e4:	84 c0                	test   %al,%al
+  8038e6:	0f 84 66 ff ff ff    	je     803852 <vprintfmt+0x25e>
+  8038ec:	45 85 ff             	test   %r15d,%r15d
+  8038ef:	78 0a                	js     8038fb <vprintfmt+0x307>
+  8038f1:	41 83 ef 01          	sub    $0x1,%r15d
+  8038f5:	0f 88 57 ff ff ff    	js     803852 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8038fb:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8038ff:	74 cc                	je     8038cd <vprintfmt+0x2d9>
+  803901:	8d 50 e0             	lea    -0x20(%rax),%edx
+  803904:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  803909:	80 fa 5e             	cmp    $0x5e,%dl
+  80390c:	77 c2                	ja     8038d0 <vprintfmt+0x2dc>
+  80390e:	eb bd                	jmp    8038cd <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  803910:	40 84 f6             	test   %sil,%sil
+  803913:	75 26                	jne    80393b <vprintfmt+0x347>
+    switch (lflag) {
+  803915:	85 d2                	test   %edx,%edx
+  803917:	74 59                	je     803972 <vprintfmt+0x37e>
+  803919:	83 fa 01             	cmp    $0x1,%edx
+  80391c:	74 7b                	je     803999 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80391e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803921:	83 f8 2f             	cmp    $0x2f,%eax
+  803924:	0f 87 96 00 00 00    	ja     8039c0 <vprintfmt+0x3cc>
+  80392a:	89 c2                	mov    %eax,%edx
+  80392c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803930:	83 c0 08             	add    $0x8,%eax
+  803933:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803936:	4c 8b 22             	mov    (%rdx),%r12
+  803939:	eb 17                	jmp    803952 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80393b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80393e:	83 f8 2f             	cmp    $0x2f,%eax
+  803941:	77 21                	ja     803964 <vprintfmt+0x370>
+  803943:	89 c2                	mov    %eax,%edx
+  803945:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803949:	83 c0 08             	add    $0x8,%eax
+  80394c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80394f:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  803952:	4d 85 e4             	test   %r12,%r12
+  803955:	78 7a                	js     8039d1 <vprintfmt+0x3dd>
+            num = i;
+  803957:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80395a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80395f:	e9 50 02 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803964:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803968:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80396c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803970:	eb dd                	jmp    80394f <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  803972:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803975:	83 f8 2f             	cmp    $0x2f,%eax
+  803978:	77 11                	ja     80398b <vprintfmt+0x397>
+  80397a:	89 c2                	mov    %eax,%edx
+  80397c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803980:	83 c0 08             	add    $0x8,%eax
+  803983:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803986:	4c 63 22             	movslq (%rdx),%r12
+  803989:	eb c7                	jmp    803952 <vprintfmt+0x35e>
+  80398b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80398f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803993:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803997:	eb ed                	jmp    803986 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  803999:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80399c:	83 f8 2f             	cmp    $0x2f,%eax
+  80399f:	77 11                	ja     8039b2 <vprintfmt+0x3be>
+  8039a1:	89 c2                	mov    %eax,%edx
+  8039a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8039a7:	83 c0 08             	add    $0x8,%eax
+  8039aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8039ad:	4c 8b 22             	mov    (%rdx),%r12
+  8039b0:	eb a0                	jmp    803952 <vprintfmt+0x35e>
+  8039b2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039b6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039be:	eb ed                	jmp    8039ad <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8039c0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8039c4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8039c8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8039cc:	e9 65 ff ff ff       	jmp    803936 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8039d1:	4c 89 ee             	mov    %r13,%rsi
+  8039d4:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8039d9:	41 ff d6             	call   *%r14
+                i = -i;
+  8039dc:	49 f7 dc             	neg    %r12
+  8039df:	e9 73 ff ff ff       	jmp    803957 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8039e4:	40 84 f6             	test   %sil,%sil
+  8039e7:	75 32                	jne    803a1b <vprintfmt+0x427>
+    switch (lflag) {
+  8039e9:	85 d2                	test   %edx,%edx
+  8039eb:	74 5d                	je     803a4a <vprintfmt+0x456>
+  8039ed:	83 fa 01             	cmp    $0x1,%edx
+  8039f0:	0f 84 82 00 00 00    	je     803a78 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8039f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8039f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8039fc:	0f 87 a5 00 00 00    	ja     803aa7 <vprintfmt+0x4b3>
+  803a02:	89 c2                	mov    %eax,%edx
+  803a04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a08:	83 c0 08             	add    $0x8,%eax
+  803a0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a0e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a11:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  803a16:	e9 99 01 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803a1b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a1e:	83 f8 2f             	cmp    $0x2f,%eax
+  803a21:	77 19                	ja     803a3c <vprintfmt+0x448>
+  803a23:	89 c2                	mov    %eax,%edx
+  803a25:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a29:	83 c0 08             	add    $0x8,%eax
+  803a2c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a2f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a32:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803a37:	e9 78 01 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+  803a3c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a40:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a44:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a48:	eb e5                	jmp    803a2f <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  803a4a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a4d:	83 f8 2f             	cmp    $0x2f,%eax
+  803a50:	77 18                	ja     803a6a <vprintfmt+0x476>
+  803a52:	89 c2                	mov    %eax,%edx
+  803a54:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a58:	83 c0 08             	add    $0x8,%eax
+  803a5b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a5e:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  803a60:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  803a65:	e9 4a 01 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+  803a6a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a6e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803a72:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803a76:	eb e6                	jmp    803a5e <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  803a78:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803a7b:	83 f8 2f             	cmp    $0x2f,%eax
+  803a7e:	77 19                	ja     803a99 <vprintfmt+0x4a5>
+  803a80:	89 c2                	mov    %eax,%edx
+  803a82:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803a86:	83 c0 08             	add    $0x8,%eax
+  803a89:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803a8c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  803a8f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  803a94:	e9 1b 01 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+  803a99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803a9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aa1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aa5:	eb e5                	jmp    803a8c <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  803aa7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803aab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803aaf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ab3:	e9 56 ff ff ff       	jmp    803a0e <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  803ab8:	40 84 f6             	test   %sil,%sil
+  803abb:	75 2e                	jne    803aeb <vprintfmt+0x4f7>
+    switch (lflag) {
+  803abd:	85 d2                	test   %edx,%edx
+  803abf:	74 59                	je     803b1a <vprintfmt+0x526>
+  803ac1:	83 fa 01             	cmp    $0x1,%edx
+  803ac4:	74 7f                	je     803b45 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  803ac6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803ac9:	83 f8 2f             	cmp    $0x2f,%eax
+  803acc:	0f 87 9f 00 00 00    	ja     803b71 <vprintfmt+0x57d>
+  803ad2:	89 c2                	mov    %eax,%edx
+  803ad4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ad8:	83 c0 08             	add    $0x8,%eax
+  803adb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803ade:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803ae1:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  803ae6:	e9 c9 00 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803aeb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803aee:	83 f8 2f             	cmp    $0x2f,%eax
+  803af1:	77 19                	ja     803b0c <vprintfmt+0x518>
+  803af3:	89 c2                	mov    %eax,%edx
+  803af5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803af9:	83 c0 08             	add    $0x8,%eax
+  803afc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803aff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b02:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803b07:	e9 a8 00 00 00       	jmp    803bb4 <vprintfmt+0x5c0>
+  803b0c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b10:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b14:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b18:	eb e5                	jmp    803aff <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  803b1a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b1d:	83 f8 2f             	cmp    $0x2f,%eax
+  803b20:	77 15                	ja     803b37 <vprintfmt+0x543>
+  803b22:	89 c2                	mov    %eax,%edx
+  803b24:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b28:	83 c0 08             	add    $0x8,%eax
+  803b2b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b2e:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  803b30:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  803b35:	eb 7d                	jmp    803bb4 <vprintfmt+0x5c0>
+  803b37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b43:	eb e9                	jmp    803b2e <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  803b45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b48:	83 f8 2f             	cmp    $0x2f,%eax
+  803b4b:	77 16                	ja     803b63 <vprintfmt+0x56f>
+  803b4d:	89 c2                	mov    %eax,%edx
+  803b4f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803b53:	83 c0 08             	add    $0x8,%eax
+  803b56:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803b59:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  803b5c:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  803b61:	eb 51                	jmp    803bb4 <vprintfmt+0x5c0>
+  803b63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6f:	eb e8                	jmp    803b59 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  803b71:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803b75:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803b79:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b7d:	e9 5c ff ff ff       	jmp    803ade <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  803b82:	4c 89 ee             	mov    %r13,%rsi
+  803b85:	bf 30 00 00 00       	mov    $0x30,%edi
+  803b8a:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  803b8d:	4c 89 ee             	mov    %r13,%rsi
+  803b90:	bf 78 00 00 00       	mov    $0x78,%edi
+  803b95:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  803b98:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803b9b:	83 f8 2f             	cmp    $0x2f,%eax
+  803b9e:	77 47                	ja     803be7 <vprintfmt+0x5f3>
+  803ba0:	89 c2                	mov    %eax,%edx
+  803ba2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803ba6:	83 c0 08             	add    $0x8,%eax
+  803ba9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803bac:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803baf:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  803bb4:	48 83 ec 08          	sub    $0x8,%rsp
+  803bb8:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  803bbc:	0f 94 c0             	sete   %al
+  803bbf:	0f b6 c0             	movzbl %al,%eax
+  803bc2:	50                   	push   %rax
+  803bc3:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  803bc8:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  803bcc:	4c 89 ee             	mov    %r13,%rsi
+  803bcf:	4c 89 f7             	mov    %r14,%rdi
+  803bd2:	48 b8 e9 34 80 00 00 	movabs $0x8034e9,%rax
+  803bd9:	00 00 00 
+  803bdc:	ff d0                	call   *%rax
+            break;
+  803bde:	48 83 c4 10          	add    $0x10,%rsp
+  803be2:	e9 3e fa ff ff       	jmp    803625 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  803be7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803beb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bf3:	eb b7                	jmp    803bac <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  803bf5:	40 84 f6             	test   %sil,%sil
+  803bf8:	75 2b                	jne    803c25 <vprintfmt+0x631>
+    switch (lflag) {
+  803bfa:	85 d2                	test   %edx,%edx
+  803bfc:	74 56                	je     803c54 <vprintfmt+0x660>
+  803bfe:	83 fa 01             	cmp    $0x1,%edx
+  803c01:	74 7f                	je     803c82 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  803c03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c06:	83 f8 2f             	cmp    $0x2f,%eax
+  803c09:	0f 87 a2 00 00 00    	ja     803cb1 <vprintfmt+0x6bd>
+  803c0f:	89 c2                	mov    %eax,%edx
+  803c11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c15:	83 c0 08             	add    $0x8,%eax
+  803c18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  803c23:	eb 8f                	jmp    803bb4 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  803c25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c28:	83 f8 2f             	cmp    $0x2f,%eax
+  803c2b:	77 19                	ja     803c46 <vprintfmt+0x652>
+  803c2d:	89 c2                	mov    %eax,%edx
+  803c2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c33:	83 c0 08             	add    $0x8,%eax
+  803c36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c39:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c3c:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  803c41:	e9 6e ff ff ff       	jmp    803bb4 <vprintfmt+0x5c0>
+  803c46:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c4a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c4e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c52:	eb e5                	jmp    803c39 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  803c54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c57:	83 f8 2f             	cmp    $0x2f,%eax
+  803c5a:	77 18                	ja     803c74 <vprintfmt+0x680>
+  803c5c:	89 c2                	mov    %eax,%edx
+  803c5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c62:	83 c0 08             	add    $0x8,%eax
+  803c65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c68:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  803c6a:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  803c6f:	e9 40 ff ff ff       	jmp    803bb4 <vprintfmt+0x5c0>
+  803c74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803c78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803c7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803c80:	eb e6                	jmp    803c68 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  803c82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  803c85:	83 f8 2f             	cmp    $0x2f,%eax
+  803c88:	77 19                	ja     803ca3 <vprintfmt+0x6af>
+  803c8a:	89 c2                	mov    %eax,%edx
+  803c8c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  803c90:	83 c0 08             	add    $0x8,%eax
+  803c93:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  803c96:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  803c99:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  803c9e:	e9 11 ff ff ff       	jmp    803bb4 <vprintfmt+0x5c0>
+  803ca3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803ca7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803caf:	eb e5                	jmp    803c96 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  803cb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  803cb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  803cb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cbd:	e9 59 ff ff ff       	jmp    803c1b <vprintfmt+0x627>
+            putch(ch, put_arg);
+  803cc2:	4c 89 ee             	mov    %r13,%rsi
+  803cc5:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cca:	41 ff d6             	call   *%r14
+            break;
+  803ccd:	e9 53 f9 ff ff       	jmp    803625 <vprintfmt+0x31>
+            putch('%', put_arg);
+  803cd2:	4c 89 ee             	mov    %r13,%rsi
+  803cd5:	bf 25 00 00 00       	mov    $0x25,%edi
+  803cda:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  803cdd:	48 83 eb 01          	sub    $0x1,%rbx
+  803ce1:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  803ce5:	75 f6                	jne    803cdd <vprintfmt+0x6e9>
+  803ce7:	e9 39 f9 ff ff       	jmp    803625 <vprintfmt+0x31>
+}
+  803cec:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  803cf0:	5b                   	pop    %rbx
+  803cf1:	41 5c                	pop    %r12
+  803cf3:	41 5d                	pop    %r13
+  803cf5:	41 5e                	pop    %r14
+  803cf7:	41 5f                	pop    %r15
+  803cf9:	5d                   	pop    %rbp
+  803cfa:	c3                   	ret
+
+0000000000803cfb <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  803cfb:	55                   	push   %rbp
+  803cfc:	48 89 e5             	mov    %rsp,%rbp
+  803cff:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  803d03:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  803d07:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  803d0c:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  803d10:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  803d17:	48 85 ff             	test   %rdi,%rdi
+  803d1a:	74 2b                	je     803d47 <vsnprintf+0x4c>
+  803d1c:	48 85 f6             	test   %rsi,%rsi
+  803d1f:	74 26                	je     803d47 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  803d21:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  803d25:	48 bf 9f 35 80 00 00 	movabs $0x80359f,%rdi
+  803d2c:	00 00 00 
+  803d2f:	48 b8 f4 35 80 00 00 	movabs $0x8035f4,%rax
+  803d36:	00 00 00 
+  803d39:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  803d3b:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  803d3f:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  803d42:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  803d45:	c9                   	leave
+  803d46:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  803d47:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803d4c:	eb f7                	jmp    803d45 <vsnprintf+0x4a>
+
+0000000000803d4e <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  803d4e:	55                   	push   %rbp
+  803d4f:	48 89 e5             	mov    %rsp,%rbp
+  803d52:	48 83 ec 50          	sub    $0x50,%rsp
+  803d56:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803d5a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803d5e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  803d62:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  803d69:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d71:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d75:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  803d79:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  803d7d:	48 b8 fb 3c 80 00 00 	movabs $0x803cfb,%rax
+  803d84:	00 00 00 
+  803d87:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  803d89:	c9                   	leave
+  803d8a:	c3                   	ret
+
+0000000000803d8b <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  803d8b:	80 3f 00             	cmpb   $0x0,(%rdi)
+  803d8e:	74 10                	je     803da0 <strlen+0x15>
+    size_t n = 0;
+  803d90:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  803d95:	48 83 c0 01          	add    $0x1,%rax
+  803d99:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  803d9d:	75 f6                	jne    803d95 <strlen+0xa>
+  803d9f:	c3                   	ret
+    size_t n = 0;
+  803da0:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  803da5:	c3                   	ret
+
+0000000000803da6 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  803da6:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  803da9:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  803dae:	48 85 f6             	test   %rsi,%rsi
+  803db1:	74 11                	je     803dc4 <strnlen+0x1e>
+  803db3:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  803db7:	74 0c                	je     803dc5 <strnlen+0x1f>
+  803db9:	48 83 c2 01          	add    $0x1,%rdx
+  803dbd:	48 39 d0             	cmp    %rdx,%rax
+  803dc0:	75 f1                	jne    803db3 <strnlen+0xd>
+  803dc2:	eb 04                	jmp    803dc8 <strnlen+0x22>
+  803dc4:	c3                   	ret
+  803dc5:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  803dc8:	c3                   	ret
+
+0000000000803dc9 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  803dc9:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  803dcc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803dd1:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  803dd5:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  803dd8:	48 83 c2 01          	add    $0x1,%rdx
+  803ddc:	84 c9                	test   %cl,%cl
+  803dde:	75 f1                	jne    803dd1 <strcpy+0x8>
+        ;
+    return res;
+}
+  803de0:	c3                   	ret
+
+0000000000803de1 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  803de1:	55                   	push   %rbp
+  803de2:	48 89 e5             	mov    %rsp,%rbp
+  803de5:	41 54                	push   %r12
+  803de7:	53                   	push   %rbx
+  803de8:	48 89 fb             	mov    %rdi,%rbx
+  803deb:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  803dee:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  803df5:	00 00 00 
+  803df8:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  803dfa:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  803dfe:	4c 89 e6             	mov    %r12,%rsi
+  803e01:	48 b8 c9 3d 80 00 00 	movabs $0x803dc9,%rax
+  803e08:	00 00 00 
+  803e0b:	ff d0                	call   *%rax
+    return dst;
+}
+  803e0d:	48 89 d8             	mov    %rbx,%rax
+  803e10:	5b                   	pop    %rbx
+  803e11:	41 5c                	pop    %r12
+  803e13:	5d                   	pop    %rbp
+  803e14:	c3                   	ret
+
+0000000000803e15 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  803e15:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  803e18:	48 85 d2             	test   %rdx,%rdx
+  803e1b:	74 1f                	je     803e3c <strncpy+0x27>
+  803e1d:	48 01 fa             	add    %rdi,%rdx
+  803e20:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  803e23:	48 83 c1 01          	add    $0x1,%rcx
+  803e27:	44 0f b6 06          	movzbl (%rsi),%r8d
+  803e2b:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  803e2f:	41 80 f8 01          	cmp    $0x1,%r8b
+  803e33:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  803e37:	48 39 ca             	cmp    %rcx,%rdx
+  803e3a:	75 e7                	jne    803e23 <strncpy+0xe>
+    }
+    return ret;
+}
+  803e3c:	c3                   	ret
+
+0000000000803e3d <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  803e3d:	48 89 f8             	mov    %rdi,%rax
+  803e40:	48 85 d2             	test   %rdx,%rdx
+  803e43:	74 24                	je     803e69 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  803e45:	48 83 ea 01          	sub    $0x1,%rdx
+  803e49:	74 1b                	je     803e66 <strlcpy+0x29>
+  803e4b:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  803e4f:	0f b6 16             	movzbl (%rsi),%edx
+  803e52:	84 d2                	test   %dl,%dl
+  803e54:	74 10                	je     803e66 <strlcpy+0x29>
+            *dst++ = *src++;
+  803e56:	48 83 c6 01          	add    $0x1,%rsi
+  803e5a:	48 83 c0 01          	add    $0x1,%rax
+  803e5e:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  803e61:	48 39 c8             	cmp    %rcx,%rax
+  803e64:	75 e9                	jne    803e4f <strlcpy+0x12>
+        *dst = '\0';
+  803e66:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  803e69:	48 29 f8             	sub    %rdi,%rax
+}
+  803e6c:	c3                   	ret
+
+0000000000803e6d <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  803e6d:	0f b6 07             	movzbl (%rdi),%eax
+  803e70:	84 c0                	test   %al,%al
+  803e72:	74 13                	je     803e87 <strcmp+0x1a>
+  803e74:	38 06                	cmp    %al,(%rsi)
+  803e76:	75 0f                	jne    803e87 <strcmp+0x1a>
+  803e78:	48 83 c7 01          	add    $0x1,%rdi
+  803e7c:	48 83 c6 01          	add    $0x1,%rsi
+  803e80:	0f b6 07             	movzbl (%rdi),%eax
+  803e83:	84 c0                	test   %al,%al
+  803e85:	75 ed                	jne    803e74 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803e87:	0f b6 c0             	movzbl %al,%eax
+  803e8a:	0f b6 16             	movzbl (%rsi),%edx
+  803e8d:	29 d0                	sub    %edx,%eax
+}
+  803e8f:	c3                   	ret
+
+0000000000803e90 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  803e90:	48 85 d2             	test   %rdx,%rdx
+  803e93:	74 1f                	je     803eb4 <strncmp+0x24>
+  803e95:	0f b6 07             	movzbl (%rdi),%eax
+  803e98:	84 c0                	test   %al,%al
+  803e9a:	74 1e                	je     803eba <strncmp+0x2a>
+  803e9c:	3a 06                	cmp    (%rsi),%al
+  803e9e:	75 1a                	jne    803eba <strncmp+0x2a>
+  803ea0:	48 83 c7 01          	add    $0x1,%rdi
+  803ea4:	48 83 c6 01          	add    $0x1,%rsi
+  803ea8:	48 83 ea 01          	sub    $0x1,%rdx
+  803eac:	75 e7                	jne    803e95 <strncmp+0x5>
+
+    if (!n) return 0;
+  803eae:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb3:	c3                   	ret
+  803eb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eb9:	c3                   	ret
+  803eba:	48 85 d2             	test   %rdx,%rdx
+  803ebd:	74 09                	je     803ec8 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  803ebf:	0f b6 07             	movzbl (%rdi),%eax
+  803ec2:	0f b6 16             	movzbl (%rsi),%edx
+  803ec5:	29 d0                	sub    %edx,%eax
+  803ec7:	c3                   	ret
+    if (!n) return 0;
+  803ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ecd:	c3                   	ret
+
+0000000000803ece <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  803ece:	0f b6 17             	movzbl (%rdi),%edx
+  803ed1:	84 d2                	test   %dl,%dl
+  803ed3:	74 18                	je     803eed <strchr+0x1f>
+        if (*str == c) {
+  803ed5:	0f be d2             	movsbl %dl,%edx
+  803ed8:	39 f2                	cmp    %esi,%edx
+  803eda:	74 17                	je     803ef3 <strchr+0x25>
+    for (; *str; str++) {
+  803edc:	48 83 c7 01          	add    $0x1,%rdi
+  803ee0:	0f b6 17             	movzbl (%rdi),%edx
+  803ee3:	84 d2                	test   %dl,%dl
+  803ee5:	75 ee                	jne    803ed5 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  803ee7:	b8 00 00 00 00       	mov    $0x0,%eax
+  803eec:	c3                   	ret
+  803eed:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ef2:	c3                   	ret
+  803ef3:	48 89 f8             	mov    %rdi,%rax
+}
+  803ef6:	c3                   	ret
+
+0000000000803ef7 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  803ef7:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  803efa:	0f b6 17             	movzbl (%rdi),%edx
+  803efd:	84 d2                	test   %dl,%dl
+  803eff:	74 13                	je     803f14 <strfind+0x1d>
+  803f01:	0f be d2             	movsbl %dl,%edx
+  803f04:	39 f2                	cmp    %esi,%edx
+  803f06:	74 0b                	je     803f13 <strfind+0x1c>
+  803f08:	48 83 c0 01          	add    $0x1,%rax
+  803f0c:	0f b6 10             	movzbl (%rax),%edx
+  803f0f:	84 d2                	test   %dl,%dl
+  803f11:	75 ee                	jne    803f01 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  803f13:	c3                   	ret
+  803f14:	c3                   	ret
+
+0000000000803f15 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  803f15:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  803f18:	48 89 f8             	mov    %rdi,%rax
+  803f1b:	48 f7 d8             	neg    %rax
+  803f1e:	83 e0 07             	and    $0x7,%eax
+  803f21:	49 89 d1             	mov    %rdx,%r9
+  803f24:	49 29 c1             	sub    %rax,%r9
+  803f27:	78 36                	js     803f5f <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  803f29:	40 0f b6 c6          	movzbl %sil,%eax
+  803f2d:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  803f34:	01 01 01 
+  803f37:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  803f3b:	40 f6 c7 07          	test   $0x7,%dil
+  803f3f:	75 38                	jne    803f79 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  803f41:	4c 89 c9             	mov    %r9,%rcx
+  803f44:	48 c1 f9 03          	sar    $0x3,%rcx
+  803f48:	74 0c                	je     803f56 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  803f4a:	fc                   	cld
+  803f4b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  803f4e:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  803f52:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  803f56:	4d 85 c9             	test   %r9,%r9
+  803f59:	75 45                	jne    803fa0 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  803f5b:	4c 89 c0             	mov    %r8,%rax
+  803f5e:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  803f5f:	48 85 d2             	test   %rdx,%rdx
+  803f62:	74 f7                	je     803f5b <memset+0x46>
+  803f64:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  803f67:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  803f6a:	48 83 c0 01          	add    $0x1,%rax
+  803f6e:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  803f72:	48 39 c2             	cmp    %rax,%rdx
+  803f75:	75 f3                	jne    803f6a <memset+0x55>
+  803f77:	eb e2                	jmp    803f5b <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  803f79:	40 f6 c7 01          	test   $0x1,%dil
+  803f7d:	74 06                	je     803f85 <memset+0x70>
+  803f7f:	88 07                	mov    %al,(%rdi)
+  803f81:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803f85:	40 f6 c7 02          	test   $0x2,%dil
+  803f89:	74 07                	je     803f92 <memset+0x7d>
+  803f8b:	66 89 07             	mov    %ax,(%rdi)
+  803f8e:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803f92:	40 f6 c7 04          	test   $0x4,%dil
+  803f96:	74 a9                	je     803f41 <memset+0x2c>
+  803f98:	89 07                	mov    %eax,(%rdi)
+  803f9a:	48 83 c7 04          	add    $0x4,%rdi
+  803f9e:	eb a1                	jmp    803f41 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  803fa0:	41 f6 c1 04          	test   $0x4,%r9b
+  803fa4:	74 06                	je     803fac <memset+0x97>
+  803fa6:	89 07                	mov    %eax,(%rdi)
+  803fa8:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  803fac:	41 f6 c1 02          	test   $0x2,%r9b
+  803fb0:	74 07                	je     803fb9 <memset+0xa4>
+  803fb2:	66 89 07             	mov    %ax,(%rdi)
+  803fb5:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  803fb9:	41 f6 c1 01          	test   $0x1,%r9b
+  803fbd:	74 9c                	je     803f5b <memset+0x46>
+  803fbf:	88 07                	mov    %al,(%rdi)
+  803fc1:	eb 98                	jmp    803f5b <memset+0x46>
+
+0000000000803fc3 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  803fc3:	48 89 f8             	mov    %rdi,%rax
+  803fc6:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  803fc9:	48 39 fe             	cmp    %rdi,%rsi
+  803fcc:	73 3b                	jae    804009 <memmove+0x46>
+  803fce:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  803fd2:	48 39 d7             	cmp    %rdx,%rdi
+  803fd5:	73 32                	jae    804009 <memmove+0x46>
+        s += n;
+        d += n;
+  803fd7:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  803fdb:	48 89 d6             	mov    %rdx,%rsi
+  803fde:	48 09 fe             	or     %rdi,%rsi
+  803fe1:	48 09 ce             	or     %rcx,%rsi
+  803fe4:	40 f6 c6 07          	test   $0x7,%sil
+  803fe8:	75 12                	jne    803ffc <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  803fea:	48 83 ef 08          	sub    $0x8,%rdi
+  803fee:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  803ff2:	48 c1 e9 03          	shr    $0x3,%rcx
+  803ff6:	fd                   	std
+  803ff7:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  803ffa:	fc                   	cld
+  803ffb:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  803ffc:	48 83 ef 01          	sub    $0x1,%rdi
+  804000:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  804004:	fd                   	std
+  804005:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  804007:	eb f1                	jmp    803ffa <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  804009:	48 89 f2             	mov    %rsi,%rdx
+  80400c:	48 09 c2             	or     %rax,%rdx
+  80400f:	48 09 ca             	or     %rcx,%rdx
+  804012:	f6 c2 07             	test   $0x7,%dl
+  804015:	75 0c                	jne    804023 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  804017:	48 c1 e9 03          	shr    $0x3,%rcx
+  80401b:	48 89 c7             	mov    %rax,%rdi
+  80401e:	fc                   	cld
+  80401f:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  804022:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  804023:	48 89 c7             	mov    %rax,%rdi
+  804026:	fc                   	cld
+  804027:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  804029:	c3                   	ret
+
+000000000080402a <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80402a:	55                   	push   %rbp
+  80402b:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80402e:	48 b8 c3 3f 80 00 00 	movabs $0x803fc3,%rax
+  804035:	00 00 00 
+  804038:	ff d0                	call   *%rax
+}
+  80403a:	5d                   	pop    %rbp
+  80403b:	c3                   	ret
+
+000000000080403c <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80403c:	55                   	push   %rbp
+  80403d:	48 89 e5             	mov    %rsp,%rbp
+  804040:	41 57                	push   %r15
+  804042:	41 56                	push   %r14
+  804044:	41 55                	push   %r13
+  804046:	41 54                	push   %r12
+  804048:	53                   	push   %rbx
+  804049:	48 83 ec 08          	sub    $0x8,%rsp
+  80404d:	49 89 fe             	mov    %rdi,%r14
+  804050:	49 89 f7             	mov    %rsi,%r15
+  804053:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  804056:	48 89 f7             	mov    %rsi,%rdi
+  804059:	48 b8 8b 3d 80 00 00 	movabs $0x803d8b,%rax
+  804060:	00 00 00 
+  804063:	ff d0                	call   *%rax
+  804065:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  804068:	48 89 de             	mov    %rbx,%rsi
+  80406b:	4c 89 f7             	mov    %r14,%rdi
+  80406e:	48 b8 a6 3d 80 00 00 	movabs $0x803da6,%rax
+  804075:	00 00 00 
+  804078:	ff d0                	call   *%rax
+  80407a:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80407d:	48 39 c3             	cmp    %rax,%rbx
+  804080:	74 36                	je     8040b8 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  804082:	48 89 d8             	mov    %rbx,%rax
+  804085:	4c 29 e8             	sub    %r13,%rax
+  804088:	49 39 c4             	cmp    %rax,%r12
+  80408b:	73 31                	jae    8040be <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80408d:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  804092:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  804096:	4c 89 fe             	mov    %r15,%rsi
+  804099:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  8040a0:	00 00 00 
+  8040a3:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8040a5:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8040a9:	48 83 c4 08          	add    $0x8,%rsp
+  8040ad:	5b                   	pop    %rbx
+  8040ae:	41 5c                	pop    %r12
+  8040b0:	41 5d                	pop    %r13
+  8040b2:	41 5e                	pop    %r14
+  8040b4:	41 5f                	pop    %r15
+  8040b6:	5d                   	pop    %rbp
+  8040b7:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8040b8:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8040bc:	eb eb                	jmp    8040a9 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8040be:	48 83 eb 01          	sub    $0x1,%rbx
+  8040c2:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8040c6:	48 89 da             	mov    %rbx,%rdx
+  8040c9:	4c 89 fe             	mov    %r15,%rsi
+  8040cc:	48 b8 2a 40 80 00 00 	movabs $0x80402a,%rax
+  8040d3:	00 00 00 
+  8040d6:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8040d8:	49 01 de             	add    %rbx,%r14
+  8040db:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8040e0:	eb c3                	jmp    8040a5 <strlcat+0x69>
+
+00000000008040e2 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8040e2:	48 85 d2             	test   %rdx,%rdx
+  8040e5:	74 2d                	je     804114 <memcmp+0x32>
+  8040e7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8040ec:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8040f0:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8040f5:	44 38 c1             	cmp    %r8b,%cl
+  8040f8:	75 0f                	jne    804109 <memcmp+0x27>
+    while (n-- > 0) {
+  8040fa:	48 83 c0 01          	add    $0x1,%rax
+  8040fe:	48 39 c2             	cmp    %rax,%rdx
+  804101:	75 e9                	jne    8040ec <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  804103:	b8 00 00 00 00       	mov    $0x0,%eax
+  804108:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  804109:	0f b6 c1             	movzbl %cl,%eax
+  80410c:	45 0f b6 c0          	movzbl %r8b,%r8d
+  804110:	44 29 c0             	sub    %r8d,%eax
+  804113:	c3                   	ret
+    return 0;
+  804114:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804119:	c3                   	ret
+
+000000000080411a <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80411a:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80411e:	48 39 c7             	cmp    %rax,%rdi
+  804121:	73 0f                	jae    804132 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  804123:	40 38 37             	cmp    %sil,(%rdi)
+  804126:	74 0e                	je     804136 <memfind+0x1c>
+    for (; src < end; src++) {
+  804128:	48 83 c7 01          	add    $0x1,%rdi
+  80412c:	48 39 f8             	cmp    %rdi,%rax
+  80412f:	75 f2                	jne    804123 <memfind+0x9>
+  804131:	c3                   	ret
+  804132:	48 89 f8             	mov    %rdi,%rax
+  804135:	c3                   	ret
+  804136:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  804139:	c3                   	ret
+
+000000000080413a <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80413a:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80413d:	0f b6 37             	movzbl (%rdi),%esi
+  804140:	40 80 fe 20          	cmp    $0x20,%sil
+  804144:	74 06                	je     80414c <strtol+0x12>
+  804146:	40 80 fe 09          	cmp    $0x9,%sil
+  80414a:	75 13                	jne    80415f <strtol+0x25>
+  80414c:	48 83 c7 01          	add    $0x1,%rdi
+  804150:	0f b6 37             	movzbl (%rdi),%esi
+  804153:	40 80 fe 20          	cmp    $0x20,%sil
+  804157:	74 f3                	je     80414c <strtol+0x12>
+  804159:	40 80 fe 09          	cmp    $0x9,%sil
+  80415d:	74 ed                	je     80414c <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80415f:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  804162:	83 e0 fd             	and    $0xfffffffd,%eax
+  804165:	3c 01                	cmp    $0x1,%al
+  804167:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80416b:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  804171:	75 0f                	jne    804182 <strtol+0x48>
+  804173:	80 3f 30             	cmpb   $0x30,(%rdi)
+  804176:	74 14                	je     80418c <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  804178:	85 d2                	test   %edx,%edx
+  80417a:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80417f:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  804182:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  804187:	4c 63 ca             	movslq %edx,%r9
+  80418a:	eb 36                	jmp    8041c2 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80418c:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  804190:	74 0f                	je     8041a1 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  804192:	85 d2                	test   %edx,%edx
+  804194:	75 ec                	jne    804182 <strtol+0x48>
+        s++;
+  804196:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  80419a:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80419f:	eb e1                	jmp    804182 <strtol+0x48>
+        s += 2;
+  8041a1:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8041a5:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8041aa:	eb d6                	jmp    804182 <strtol+0x48>
+            dig -= '0';
+  8041ac:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8041af:	44 0f b6 c1          	movzbl %cl,%r8d
+  8041b3:	41 39 d0             	cmp    %edx,%r8d
+  8041b6:	7d 21                	jge    8041d9 <strtol+0x9f>
+        val = val * base + dig;
+  8041b8:	49 0f af c1          	imul   %r9,%rax
+  8041bc:	0f b6 c9             	movzbl %cl,%ecx
+  8041bf:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8041c2:	48 83 c7 01          	add    $0x1,%rdi
+  8041c6:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8041ca:	80 f9 39             	cmp    $0x39,%cl
+  8041cd:	76 dd                	jbe    8041ac <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8041cf:	80 f9 7b             	cmp    $0x7b,%cl
+  8041d2:	77 05                	ja     8041d9 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8041d4:	83 e9 57             	sub    $0x57,%ecx
+  8041d7:	eb d6                	jmp    8041af <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8041d9:	4d 85 d2             	test   %r10,%r10
+  8041dc:	74 03                	je     8041e1 <strtol+0xa7>
+  8041de:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8041e1:	48 89 c2             	mov    %rax,%rdx
+  8041e4:	48 f7 da             	neg    %rdx
+  8041e7:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8041eb:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8041ef:	c3                   	ret
+
+00000000008041f0 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8041f0:	55                   	push   %rbp
+  8041f1:	48 89 e5             	mov    %rsp,%rbp
+  8041f4:	41 56                	push   %r14
+  8041f6:	41 55                	push   %r13
+  8041f8:	41 54                	push   %r12
+  8041fa:	53                   	push   %rbx
+  8041fb:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8041fe:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804205:	00 00 00 
+  804208:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80420c:	74 27                	je     804235 <_handle_vectored_pagefault+0x45>
+  80420e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804213:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80421a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80421d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804220:	4c 89 e7             	mov    %r12,%rdi
+  804223:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804228:	84 c0                	test   %al,%al
+  80422a:	75 45                	jne    804271 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80422c:	48 83 c3 01          	add    $0x1,%rbx
+  804230:	49 3b 1e             	cmp    (%r14),%rbx
+  804233:	72 eb                	jb     804220 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804235:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80423c:	00 
+  80423d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804242:	4d 8b 04 24          	mov    (%r12),%r8
+  804246:	48 ba 58 4d 80 00 00 	movabs $0x804d58,%rdx
+  80424d:	00 00 00 
+  804250:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804255:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80425c:	00 00 00 
+  80425f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804264:	49 ba 54 33 80 00 00 	movabs $0x803354,%r10
+  80426b:	00 00 00 
+  80426e:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804271:	5b                   	pop    %rbx
+  804272:	41 5c                	pop    %r12
+  804274:	41 5d                	pop    %r13
+  804276:	41 5e                	pop    %r14
+  804278:	5d                   	pop    %rbp
+  804279:	c3                   	ret
+
+000000000080427a <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80427a:	55                   	push   %rbp
+  80427b:	48 89 e5             	mov    %rsp,%rbp
+  80427e:	53                   	push   %rbx
+  80427f:	48 83 ec 08          	sub    $0x8,%rsp
+  804283:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804286:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80428d:	00 00 00 
+  804290:	80 38 00             	cmpb   $0x0,(%rax)
+  804293:	0f 84 84 00 00 00    	je     80431d <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804299:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8042a0:	00 00 00 
+  8042a3:	48 8b 10             	mov    (%rax),%rdx
+  8042a6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042ab:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8042b2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042b5:	48 85 d2             	test   %rdx,%rdx
+  8042b8:	74 19                	je     8042d3 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8042ba:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8042be:	0f 84 e8 00 00 00    	je     8043ac <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8042c4:	48 83 c0 01          	add    $0x1,%rax
+  8042c8:	48 39 d0             	cmp    %rdx,%rax
+  8042cb:	75 ed                	jne    8042ba <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8042cd:	48 83 fa 08          	cmp    $0x8,%rdx
+  8042d1:	74 1c                	je     8042ef <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8042d3:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8042d7:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8042de:	00 00 00 
+  8042e1:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8042e8:	00 00 00 
+  8042eb:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8042ef:	48 b8 a9 01 80 00 00 	movabs $0x8001a9,%rax
+  8042f6:	00 00 00 
+  8042f9:	ff d0                	call   *%rax
+  8042fb:	89 c7                	mov    %eax,%edi
+  8042fd:	48 be 72 44 80 00 00 	movabs $0x804472,%rsi
+  804304:	00 00 00 
+  804307:	48 b8 f4 03 80 00 00 	movabs $0x8003f4,%rax
+  80430e:	00 00 00 
+  804311:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804313:	85 c0                	test   %eax,%eax
+  804315:	78 68                	js     80437f <add_pgfault_handler+0x105>
+    return res;
+}
+  804317:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80431b:	c9                   	leave
+  80431c:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80431d:	48 b8 a9 01 80 00 00 	movabs $0x8001a9,%rax
+  804324:	00 00 00 
+  804327:	ff d0                	call   *%rax
+  804329:	89 c7                	mov    %eax,%edi
+  80432b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804330:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804335:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80433c:	00 00 00 
+  80433f:	48 b8 36 02 80 00 00 	movabs $0x800236,%rax
+  804346:	00 00 00 
+  804349:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80434b:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804352:	00 00 00 
+  804355:	48 8b 02             	mov    (%rdx),%rax
+  804358:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80435c:	48 89 0a             	mov    %rcx,(%rdx)
+  80435f:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804366:	00 00 00 
+  804369:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80436d:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804374:	00 00 00 
+  804377:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80437a:	e9 70 ff ff ff       	jmp    8042ef <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80437f:	89 c1                	mov    %eax,%ecx
+  804381:	48 ba 96 4d 80 00 00 	movabs $0x804d96,%rdx
+  804388:	00 00 00 
+  80438b:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804390:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  804397:	00 00 00 
+  80439a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80439f:	49 b8 54 33 80 00 00 	movabs $0x803354,%r8
+  8043a6:	00 00 00 
+  8043a9:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8043ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043b1:	e9 61 ff ff ff       	jmp    804317 <add_pgfault_handler+0x9d>
+
+00000000008043b6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8043b6:	55                   	push   %rbp
+  8043b7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8043ba:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8043c1:	00 00 00 
+  8043c4:	80 38 00             	cmpb   $0x0,(%rax)
+  8043c7:	74 33                	je     8043fc <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043c9:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8043d0:	00 00 00 
+  8043d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8043d8:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8043df:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043e2:	48 85 c0             	test   %rax,%rax
+  8043e5:	0f 84 85 00 00 00    	je     804470 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8043eb:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8043ef:	74 40                	je     804431 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8043f1:	48 83 c1 01          	add    $0x1,%rcx
+  8043f5:	48 39 c1             	cmp    %rax,%rcx
+  8043f8:	75 f1                	jne    8043eb <remove_pgfault_handler+0x35>
+  8043fa:	eb 74                	jmp    804470 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8043fc:	48 b9 ae 4d 80 00 00 	movabs $0x804dae,%rcx
+  804403:	00 00 00 
+  804406:	48 ba 87 47 80 00 00 	movabs $0x804787,%rdx
+  80440d:	00 00 00 
+  804410:	be 43 00 00 00       	mov    $0x43,%esi
+  804415:	48 bf 88 4d 80 00 00 	movabs $0x804d88,%rdi
+  80441c:	00 00 00 
+  80441f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804424:	49 b8 54 33 80 00 00 	movabs $0x803354,%r8
+  80442b:	00 00 00 
+  80442e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804431:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804438:	00 
+  804439:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80443d:	48 29 ca             	sub    %rcx,%rdx
+  804440:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804447:	00 00 00 
+  80444a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80444e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804453:	48 89 ce             	mov    %rcx,%rsi
+  804456:	48 b8 c3 3f 80 00 00 	movabs $0x803fc3,%rax
+  80445d:	00 00 00 
+  804460:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804462:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804469:	00 00 00 
+  80446c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804470:	5d                   	pop    %rbp
+  804471:	c3                   	ret
+
+0000000000804472 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804472:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804475:	48 b8 f0 41 80 00 00 	movabs $0x8041f0,%rax
+  80447c:	00 00 00 
+    call *%rax
+  80447f:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804481:	41 5f                	pop    %r15
+	popq %r15
+  804483:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804485:	41 5f                	pop    %r15
+	popq %r14
+  804487:	41 5e                	pop    %r14
+	popq %r13
+  804489:	41 5d                	pop    %r13
+	popq %r12
+  80448b:	41 5c                	pop    %r12
+	popq %r11
+  80448d:	41 5b                	pop    %r11
+	popq %r10
+  80448f:	41 5a                	pop    %r10
+	popq %r9
+  804491:	41 59                	pop    %r9
+	popq %r8
+  804493:	41 58                	pop    %r8
+	popq %rsi
+  804495:	5e                   	pop    %rsi
+	popq %rdi
+  804496:	5f                   	pop    %rdi
+	popq %rbp
+  804497:	5d                   	pop    %rbp
+	popq %rdx
+  804498:	5a                   	pop    %rdx
+	popq %rcx
+  804499:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80449a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80449f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8044a4:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8044a8:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8044ab:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8044b0:	5b                   	pop    %rbx
+	popq %rax
+  8044b1:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8044b2:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8044b6:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8044b7:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8044bc:	c3                   	ret
+
+00000000008044bd <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8044bd:	55                   	push   %rbp
+  8044be:	48 89 e5             	mov    %rsp,%rbp
+  8044c1:	41 55                	push   %r13
+  8044c3:	41 54                	push   %r12
+  8044c5:	53                   	push   %rbx
+  8044c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044ca:	49 89 fd             	mov    %rdi,%r13
+  8044cd:	48 89 f7             	mov    %rsi,%rdi
+  8044d0:	48 89 d3             	mov    %rdx,%rbx
+  8044d3:	49 89 cc             	mov    %rcx,%r12
+  8044d6:	4c 89 c2             	mov    %r8,%rdx
+  8044d9:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8044dc:	48 85 f6             	test   %rsi,%rsi
+  8044df:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8044e6:	00 00 00 
+  8044e9:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8044ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8044f2:	48 85 db             	test   %rbx,%rbx
+  8044f5:	74 03                	je     8044fa <ipc_recv_futex+0x3d>
+  8044f7:	48 8b 33             	mov    (%rbx),%rsi
+  8044fa:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8044fe:	48 b8 80 04 80 00 00 	movabs $0x800480,%rax
+  804505:	00 00 00 
+  804508:	ff d0                	call   *%rax
+    if (res < 0) {
+  80450a:	85 c0                	test   %eax,%eax
+  80450c:	78 75                	js     804583 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80450e:	4d 85 ed             	test   %r13,%r13
+  804511:	74 14                	je     804527 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804513:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80451a:	00 00 00 
+  80451d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804523:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804527:	4d 85 e4             	test   %r12,%r12
+  80452a:	74 14                	je     804540 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80452c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804533:	00 00 00 
+  804536:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80453c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804540:	48 85 db             	test   %rbx,%rbx
+  804543:	74 23                	je     804568 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804545:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80454c:	00 00 00 
+  80454f:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804555:	ba 00 00 00 00       	mov    $0x0,%edx
+  80455a:	85 c9                	test   %ecx,%ecx
+  80455c:	74 07                	je     804565 <ipc_recv_futex+0xa8>
+  80455e:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804565:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804568:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80456f:	00 00 00 
+  804572:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804578:	48 83 c4 08          	add    $0x8,%rsp
+  80457c:	5b                   	pop    %rbx
+  80457d:	41 5c                	pop    %r12
+  80457f:	41 5d                	pop    %r13
+  804581:	5d                   	pop    %rbp
+  804582:	c3                   	ret
+        if (from_env_store != NULL) {
+  804583:	4d 85 ed             	test   %r13,%r13
+  804586:	74 08                	je     804590 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804588:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80458f:	00 
+        if (perm_store != NULL) {
+  804590:	4d 85 e4             	test   %r12,%r12
+  804593:	74 08                	je     80459d <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804595:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80459c:	00 
+        if (size != NULL) {
+  80459d:	48 85 db             	test   %rbx,%rbx
+  8045a0:	74 d6                	je     804578 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8045a2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8045a9:	eb cd                	jmp    804578 <ipc_recv_futex+0xbb>
+
+00000000008045ab <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8045ab:	55                   	push   %rbp
+  8045ac:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8045af:	48 83 ec 08          	sub    $0x8,%rsp
+  8045b3:	6a 00                	push   $0x0
+  8045b5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8045bb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8045c1:	48 b8 bd 44 80 00 00 	movabs $0x8044bd,%rax
+  8045c8:	00 00 00 
+  8045cb:	ff d0                	call   *%rax
+}
+  8045cd:	c9                   	leave
+  8045ce:	c3                   	ret
+
+00000000008045cf <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8045cf:	55                   	push   %rbp
+  8045d0:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8045d3:	48 85 d2             	test   %rdx,%rdx
+  8045d6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8045dd:	00 00 00 
+  8045e0:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8045e4:	89 f6                	mov    %esi,%esi
+  8045e6:	48 b8 69 04 80 00 00 	movabs $0x800469,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8045f2:	85 c0                	test   %eax,%eax
+  8045f4:	78 02                	js     8045f8 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8045f6:	5d                   	pop    %rbp
+  8045f7:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8045f8:	89 c1                	mov    %eax,%ecx
+  8045fa:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  804601:	00 00 00 
+  804604:	be 50 00 00 00       	mov    $0x50,%esi
+  804609:	48 bf dc 4d 80 00 00 	movabs $0x804ddc,%rdi
+  804610:	00 00 00 
+  804613:	b8 00 00 00 00       	mov    $0x0,%eax
+  804618:	49 b8 54 33 80 00 00 	movabs $0x803354,%r8
+  80461f:	00 00 00 
+  804622:	41 ff d0             	call   *%r8
+
+0000000000804625 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804625:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  80462a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804631:	00 00 00 
+  804634:	48 89 d0             	mov    %rdx,%rax
+  804637:	48 c1 e0 04          	shl    $0x4,%rax
+  80463b:	48 29 d0             	sub    %rdx,%rax
+  80463e:	48 c1 e0 05          	shl    $0x5,%rax
+  804642:	48 01 c8             	add    %rcx,%rax
+  804645:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80464b:	39 f8                	cmp    %edi,%eax
+  80464d:	74 13                	je     804662 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80464f:	48 83 c2 01          	add    $0x1,%rdx
+  804653:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80465a:	75 d8                	jne    804634 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80465c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804661:	c3                   	ret
+            return envs[i].env_id;
+  804662:	48 89 d0             	mov    %rdx,%rax
+  804665:	48 c1 e0 04          	shl    $0x4,%rax
+  804669:	48 29 d0             	sub    %rdx,%rax
+  80466c:	48 c1 e0 05          	shl    $0x5,%rax
+  804670:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804677:	00 00 00 
+  80467a:	48 01 d0             	add    %rdx,%rax
+  80467d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804683:	c3                   	ret
+  804684:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804688 <__rodata_start>:
+  804688:	3c 75                	cmp    $0x75,%al
+  80468a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80468b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80468f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804690:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  804694:	1f                   	(bad)
+  804695:	44 00 00             	add    %r8b,(%rax)
+  804698:	73 79                	jae    804713 <__rodata_start+0x8b>
+  80469a:	73 63                	jae    8046ff <__rodata_start+0x77>
+  80469c:	61                   	(bad)
+  80469d:	6c                   	insb   (%dx),%es:(%rdi)
+  80469e:	6c                   	insb   (%dx),%es:(%rdi)
+  80469f:	20 25 7a 64 20 72    	and    %ah,0x7220647a(%rip)        # 72a0ab1f <__bss_end+0x721c8b1f>
+  8046a5:	65 74 75             	gs je  80471d <__rodata_start+0x95>
+  8046a8:	72 6e                	jb     804718 <__rodata_start+0x90>
+  8046aa:	65 64 20 25 7a 64 20 	gs and %ah,%fs:0x2820647a(%rip)        # 28a0ab2c <__bss_end+0x281c8b2c>
+  8046b1:	28 
+  8046b2:	3e 20 30             	ds and %dh,(%rax)
+  8046b5:	29 00                	sub    %eax,(%rax)
+  8046b7:	6c                   	insb   (%dx),%es:(%rdi)
+  8046b8:	69 62 2f 73 79 73 63 	imul   $0x63737973,0x2f(%rdx),%esp
+  8046bf:	61                   	(bad)
+  8046c0:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c1:	6c                   	insb   (%dx),%es:(%rdi)
+  8046c2:	2e 63 00             	cs movsxd (%rax),%eax
+  8046c5:	0f 1f 00             	nopl   (%rax)
+  8046c8:	5b                   	pop    %rbx
+  8046c9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ce:	20 75 6e             	and    %dh,0x6e(%rbp)
+  8046d1:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8046d5:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046d6:	20 64 65 76          	and    %ah,0x76(%rbp,%riz,2)
+  8046da:	69 63 65 20 74 79 70 	imul   $0x70797420,0x65(%rbx),%esp
+  8046e1:	65 20 25 64 0a 00 00 	and    %ah,%gs:0xa64(%rip)        # 80514c <__ctors_end+0x6c>
+  8046e8:	5b                   	pop    %rbx
+  8046e9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8046ee:	20 66 74             	and    %ah,0x74(%rsi)
+  8046f1:	72 75                	jb     804768 <devtab+0x8>
+  8046f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8046f4:	63 61 74             	movsxd 0x74(%rcx),%esp
+  8046f7:	65 20 25 64 20 2d 2d 	and    %ah,%gs:0x2d2d2064(%rip)        # 2dad6762 <__bss_end+0x2d294762>
+  8046fe:	20 62 61             	and    %ah,0x61(%rdx)
+  804701:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804705:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804709:	5b                   	pop    %rbx
+  80470a:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80470f:	20 72 65             	and    %dh,0x65(%rdx)
+  804712:	61                   	(bad)
+  804713:	64 20 25 64 20 2d 2d 	and    %ah,%fs:0x2d2d2064(%rip)        # 2dad677e <__bss_end+0x2d29477e>
+  80471a:	20 62 61             	and    %ah,0x61(%rdx)
+  80471d:	64 20 6d 6f          	and    %ch,%fs:0x6f(%rbp)
+  804721:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804725:	5b                   	pop    %rbx
+  804726:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  80472b:	20 77 72             	and    %dh,0x72(%rdi)
+  80472e:	69 74 65 20 25 64 20 	imul   $0x2d206425,0x20(%rbp,%riz,2),%esi
+  804735:	2d 
+  804736:	2d 20 62 61 64       	sub    $0x64616220,%eax
+  80473b:	20 6d 6f             	and    %ch,0x6f(%rbp)
+  80473e:	64 65 0a 00          	fs or  %gs:(%rax),%al
+  804742:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804749:	00 00 00 
+  80474c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804753:	00 00 00 
+  804756:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  80475d:	00 00 00 
+
+0000000000804760 <devtab>:
+  804760:	20 50 80 00 00 00 00 00 60 50 80 00 00 00 00 00      P......`P......
+  804770:	a0 50 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .P..............
+  804780:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804790:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8047a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8047b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8047c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8047d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8047e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8047f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804800:	3a 20 00 30 31 32 33 34 35 36 37 38 39 41 42 43     : .0123456789ABC
+  804810:	44 45 46 00 30 31 32 33 34 35 36 37 38 39 61 62     DEF.0123456789ab
+  804820:	63 64 65 66 00 28 6e 75 6c 6c 29 00 65 72 72 6f     cdef.(null).erro
+  804830:	72 20 25 64 00 75 6e 73 70 65 63 69 66 69 65 64     r %d.unspecified
+  804840:	20 65 72 72 6f 72 00 62 61 64 20 65 6e 76 69 72      error.bad envir
+  804850:	6f 6e 6d 65 6e 74 00 69 6e 76 61 6c 69 64 20 70     onment.invalid p
+  804860:	61 72 61 6d 65 74 65 72 00 6f 75 74 20 6f 66 20     arameter.out of 
+  804870:	6d 65 6d 6f 72 79 00 6f 75 74 20 6f 66 20 65 6e     memory.out of en
+  804880:	76 69 72 6f 6e 6d 65 6e 74 73 00 63 6f 72 72 75     vironments.corru
+  804890:	70 74 65 64 20 64 65 62 75 67 20 69 6e 66 6f 00     pted debug info.
+  8048a0:	73 65 67 6d 65 6e 74 61 74 69 6f 6e 20 66 61 75     segmentation fau
+  8048b0:	6c 74 00 69 6e 76 61 6c 69 64 20 45 4c 46 20 69     lt.invalid ELF i
+  8048c0:	6d 61 67 65 00 6e 6f 20 73 75 63 68 20 73 79 73     mage.no such sys
+  8048d0:	74 65 6d 20 63 61 6c 6c 00 65 6e 74 72 79 20 6e     tem call.entry n
+  8048e0:	6f 74 20 66 6f 75 6e 64 00 65 6e 76 20 69 73 20     ot found.env is 
+  8048f0:	6e 6f 74 20 72 65 63 76 69 6e 67 00 75 6e 65 78     not recving.unex
+  804900:	70 65 63 74 65 64 20 65 6e 64 20 6f 66 20 66 69     pected end of fi
+  804910:	6c 65 00 6e 6f 20 66 72 65 65 20 73 70 61 63 65     le.no free space
+  804920:	20 6f 6e 20 64 69 73 6b 00 74 6f 6f 20 6d 61 6e      on disk.too man
+  804930:	79 20 66 69 6c 65 73 20 61 72 65 20 6f 70 65 6e     y files are open
+  804940:	00 66 69 6c 65 20 6f 72 20 62 6c 6f 63 6b 20 6e     .file or block n
+  804950:	6f 74 20 66 6f 75 6e 64 00 69 6e 76 61 6c 69 64     ot found.invalid
+  804960:	20 70 61 74 68 00 66 69 6c 65 20 61 6c 72 65 61      path.file alrea
+  804970:	64 79 20 65 78 69 73 74 73 00 6f 70 65 72 61 74     dy exists.operat
+  804980:	69 6f 6e 20 6e 6f 74 20 73 75 70 70 6f 72 74 65     ion not supporte
+  804990:	64 00 74 72 79 20 61 67 61 69 6e 00 74 69 6d 65     d.try again.time
+  8049a0:	64 20 6f 75 74 00 66 69 6c 65 20 69 73 20 69 6e     d out.file is in
+  8049b0:	20 75 73 65 00 66 2e 0f 1f 84 00 00 00 00 00 90      use.f..........
+  8049c0:	91 36 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .6.......<......
+  8049d0:	c2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  8049e0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  8049f0:	d2 3c 80 00 00 00 00 00 b0 36 80 00 00 00 00 00     .<.......6......
+  804a00:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804a10:	a4 36 80 00 00 00 00 00 1e 37 80 00 00 00 00 00     .6.......7......
+  804a20:	d2 3c 80 00 00 00 00 00 a4 36 80 00 00 00 00 00     .<.......6......
+  804a30:	ea 36 80 00 00 00 00 00 ea 36 80 00 00 00 00 00     .6.......6......
+  804a40:	ea 36 80 00 00 00 00 00 ea 36 80 00 00 00 00 00     .6.......6......
+  804a50:	ea 36 80 00 00 00 00 00 ea 36 80 00 00 00 00 00     .6.......6......
+  804a60:	ea 36 80 00 00 00 00 00 ea 36 80 00 00 00 00 00     .6.......6......
+  804a70:	ea 36 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .6.......<......
+  804a80:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804a90:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804aa0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804ab0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804ac0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804ad0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804ae0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804af0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b00:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b10:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b20:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b30:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b40:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b50:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b60:	d2 3c 80 00 00 00 00 00 f5 3b 80 00 00 00 00 00     .<.......;......
+  804b70:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b80:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804b90:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804ba0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804bb0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804bc0:	41 37 80 00 00 00 00 00 10 39 80 00 00 00 00 00     A7.......9......
+  804bd0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804be0:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804bf0:	70 37 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     p7.......<......
+  804c00:	d2 3c 80 00 00 00 00 00 36 37 80 00 00 00 00 00     .<......67......
+  804c10:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804c20:	b8 3a 80 00 00 00 00 00 82 3b 80 00 00 00 00 00     .:.......;......
+  804c30:	d2 3c 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .<.......<......
+  804c40:	07 38 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .8.......<......
+  804c50:	e4 39 80 00 00 00 00 00 d2 3c 80 00 00 00 00 00     .9.......<......
+  804c60:	d2 3c 80 00 00 00 00 00 f5 3b 80 00 00 00 00 00     .<.......;......
+  804c70:	d2 3c 80 00 00 00 00 00 9a 36 80 00 00 00 00 00     .<.......6......
+
+0000000000804c80 <error_string>:
+	...
+  804c88:	35 48 80 00 00 00 00 00 47 48 80 00 00 00 00 00     5H......GH......
+  804c98:	57 48 80 00 00 00 00 00 69 48 80 00 00 00 00 00     WH......iH......
+  804ca8:	77 48 80 00 00 00 00 00 8b 48 80 00 00 00 00 00     wH.......H......
+  804cb8:	a0 48 80 00 00 00 00 00 b3 48 80 00 00 00 00 00     .H.......H......
+  804cc8:	c5 48 80 00 00 00 00 00 d9 48 80 00 00 00 00 00     .H.......H......
+  804cd8:	e9 48 80 00 00 00 00 00 fc 48 80 00 00 00 00 00     .H.......H......
+  804ce8:	13 49 80 00 00 00 00 00 29 49 80 00 00 00 00 00     .I......)I......
+  804cf8:	41 49 80 00 00 00 00 00 59 49 80 00 00 00 00 00     AI......YI......
+  804d08:	66 49 80 00 00 00 00 00 38 4d 80 00 00 00 00 00     fI......8M......
+  804d18:	7a 49 80 00 00 00 00 00 92 49 80 00 00 00 00 00     zI.......I......
+  804d28:	9c 49 80 00 00 00 00 00 a6 49 80 00 00 00 00 00     .I.......I......
+  804d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804d58:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  804d68:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  804d78:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  804d88:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  804d98:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  804da8:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  804db8:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  804dc8:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  804dd8:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  804de8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804df8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e08:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e18:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e38:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e48:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804e58:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804e68:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804e78:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804e88:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804e98:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ea8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804eb8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804ec8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804ed8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804ee8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804ef8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f08:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f18:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f28:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f38:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f48:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804f58:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804f68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804f78:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804f88:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f98:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804fa8:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  804fb8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  804fc8:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  804fd8:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fe8:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  804ff8:	0f 1f 84 00 00 00 00 00                             ........
@@ -0,0 +1,9580 @@
+
+obj/user/init:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 42 05 00 00       	call   800565 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <sum>:
+char bss[6000];
+
+int
+sum(const char *s, int n) {
+    int i, tot = 0;
+    for (i = 0; i < n; i++)
+  800025:	85 f6                	test   %esi,%esi
+  800027:	7e 22                	jle    80004b <sum+0x26>
+  800029:	48 63 f6             	movslq %esi,%rsi
+  80002c:	b8 00 00 00 00       	mov    $0x0,%eax
+    int i, tot = 0;
+  800031:	b9 00 00 00 00       	mov    $0x0,%ecx
+        tot ^= i * s[i];
+  800036:	0f be 14 07          	movsbl (%rdi,%rax,1),%edx
+  80003a:	0f af d0             	imul   %eax,%edx
+  80003d:	31 d1                	xor    %edx,%ecx
+    for (i = 0; i < n; i++)
+  80003f:	48 83 c0 01          	add    $0x1,%rax
+  800043:	48 39 f0             	cmp    %rsi,%rax
+  800046:	75 ee                	jne    800036 <sum+0x11>
+    return tot;
+}
+  800048:	89 c8                	mov    %ecx,%eax
+  80004a:	c3                   	ret
+    int i, tot = 0;
+  80004b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    return tot;
+  800050:	eb f6                	jmp    800048 <sum+0x23>
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec 08 01 00 00 	sub    $0x108,%rsp
+  800066:	41 89 fc             	mov    %edi,%r12d
+  800069:	49 89 f5             	mov    %rsi,%r13
+    int i, r, x, want;
+    char args[256];
+
+    cprintf("init: running\n");
+  80006c:	48 bf e0 55 80 00 00 	movabs $0x8055e0,%rdi
+  800073:	00 00 00 
+  800076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007b:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  800082:	00 00 00 
+  800085:	ff d2                	call   *%rdx
+
+    want = 0xf989e;
+    if ((x = sum((char *)&data, sizeof data)) != want)
+  800087:	be 70 17 00 00       	mov    $0x1770,%esi
+  80008c:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  800093:	00 00 00 
+  800096:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80009d:	00 00 00 
+  8000a0:	ff d0                	call   *%rax
+  8000a2:	3d 9e 98 0f 00       	cmp    $0xf989e,%eax
+  8000a7:	0f 84 64 01 00 00    	je     800211 <umain+0x1bf>
+        cprintf("init: data is not initialized: got sum %08x wanted %08x\n",
+  8000ad:	ba 9e 98 0f 00       	mov    $0xf989e,%edx
+  8000b2:	89 c6                	mov    %eax,%esi
+  8000b4:	48 bf a8 56 80 00 00 	movabs $0x8056a8,%rdi
+  8000bb:	00 00 00 
+  8000be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000c3:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  8000ca:	00 00 00 
+  8000cd:	ff d1                	call   *%rcx
+                x, want);
+    else
+        cprintf("init: data seems okay\n");
+    if ((x = sum(bss, sizeof bss)) != 0)
+  8000cf:	be 70 17 00 00       	mov    $0x1770,%esi
+  8000d4:	48 bf 00 00 81 00 00 	movabs $0x810000,%rdi
+  8000db:	00 00 00 
+  8000de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000e5:	00 00 00 
+  8000e8:	ff d0                	call   *%rax
+  8000ea:	85 c0                	test   %eax,%eax
+  8000ec:	0f 84 3f 01 00 00    	je     800231 <umain+0x1df>
+        cprintf("bss is not initialized: wanted sum 0 got %08x\n", x);
+  8000f2:	89 c6                	mov    %eax,%esi
+  8000f4:	48 bf e8 56 80 00 00 	movabs $0x8056e8,%rdi
+  8000fb:	00 00 00 
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  80010a:	00 00 00 
+  80010d:	ff d2                	call   *%rdx
+    else
+        cprintf("init: bss seems okay\n");
+
+    /* Output in one syscall per line to avoid output interleaving */
+    strcat(args, "init: args:");
+  80010f:	48 be 1c 56 80 00 00 	movabs $0x80561c,%rsi
+  800116:	00 00 00 
+  800119:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800120:	48 b8 c8 10 80 00 00 	movabs $0x8010c8,%rax
+  800127:	00 00 00 
+  80012a:	ff d0                	call   *%rax
+    for (i = 0; i < argc; i++) {
+  80012c:	45 85 e4             	test   %r12d,%r12d
+  80012f:	7e 59                	jle    80018a <umain+0x138>
+  800131:	4c 89 eb             	mov    %r13,%rbx
+  800134:	4d 63 e4             	movslq %r12d,%r12
+  800137:	4f 8d 7c e5 00       	lea    0x0(%r13,%r12,8),%r15
+        strcat(args, " '");
+  80013c:	49 be 28 56 80 00 00 	movabs $0x805628,%r14
+  800143:	00 00 00 
+  800146:	49 bc c8 10 80 00 00 	movabs $0x8010c8,%r12
+  80014d:	00 00 00 
+        strcat(args, argv[i]);
+        strcat(args, "'");
+  800150:	49 bd 29 56 80 00 00 	movabs $0x805629,%r13
+  800157:	00 00 00 
+        strcat(args, " '");
+  80015a:	4c 89 f6             	mov    %r14,%rsi
+  80015d:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800164:	41 ff d4             	call   *%r12
+        strcat(args, argv[i]);
+  800167:	48 8b 33             	mov    (%rbx),%rsi
+  80016a:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  800171:	41 ff d4             	call   *%r12
+        strcat(args, "'");
+  800174:	4c 89 ee             	mov    %r13,%rsi
+  800177:	48 8d bd d0 fe ff ff 	lea    -0x130(%rbp),%rdi
+  80017e:	41 ff d4             	call   *%r12
+    for (i = 0; i < argc; i++) {
+  800181:	48 83 c3 08          	add    $0x8,%rbx
+  800185:	4c 39 fb             	cmp    %r15,%rbx
+  800188:	75 d0                	jne    80015a <umain+0x108>
+    }
+    cprintf("%s\n", args);
+  80018a:	48 8d b5 d0 fe ff ff 	lea    -0x130(%rbp),%rsi
+  800191:	48 bf 2b 56 80 00 00 	movabs $0x80562b,%rdi
+  800198:	00 00 00 
+  80019b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a0:	48 bb 8b 07 80 00 00 	movabs $0x80078b,%rbx
+  8001a7:	00 00 00 
+  8001aa:	ff d3                	call   *%rbx
+
+    cprintf("init: running sh\n");
+  8001ac:	48 bf 2f 56 80 00 00 	movabs $0x80562f,%rdi
+  8001b3:	00 00 00 
+  8001b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001bb:	ff d3                	call   *%rbx
+
+    /* Being run directly from kernel, so no file descriptors open yet */
+    close(0);
+  8001bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c2:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  8001c9:	00 00 00 
+  8001cc:	ff d0                	call   *%rax
+    if ((r = opencons()) < 0)
+  8001ce:	48 b8 fe 04 80 00 00 	movabs $0x8004fe,%rax
+  8001d5:	00 00 00 
+  8001d8:	ff d0                	call   *%rax
+  8001da:	85 c0                	test   %eax,%eax
+  8001dc:	78 73                	js     800251 <umain+0x1ff>
+        panic("opencons: %i", r);
+    if (r != 0)
+  8001de:	0f 84 9a 00 00 00    	je     80027e <umain+0x22c>
+        panic("first opencons used fd %d", r);
+  8001e4:	89 c1                	mov    %eax,%ecx
+  8001e6:	48 ba 5a 56 80 00 00 	movabs $0x80565a,%rdx
+  8001ed:	00 00 00 
+  8001f0:	be 36 00 00 00       	mov    $0x36,%esi
+  8001f5:	48 bf 4e 56 80 00 00 	movabs $0x80564e,%rdi
+  8001fc:	00 00 00 
+  8001ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  800204:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  80020b:	00 00 00 
+  80020e:	41 ff d0             	call   *%r8
+        cprintf("init: data seems okay\n");
+  800211:	48 bf ef 55 80 00 00 	movabs $0x8055ef,%rdi
+  800218:	00 00 00 
+  80021b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800220:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  800227:	00 00 00 
+  80022a:	ff d2                	call   *%rdx
+  80022c:	e9 9e fe ff ff       	jmp    8000cf <umain+0x7d>
+        cprintf("init: bss seems okay\n");
+  800231:	48 bf 06 56 80 00 00 	movabs $0x805606,%rdi
+  800238:	00 00 00 
+  80023b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800240:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  800247:	00 00 00 
+  80024a:	ff d2                	call   *%rdx
+  80024c:	e9 be fe ff ff       	jmp    80010f <umain+0xbd>
+        panic("opencons: %i", r);
+  800251:	89 c1                	mov    %eax,%ecx
+  800253:	48 ba 41 56 80 00 00 	movabs $0x805641,%rdx
+  80025a:	00 00 00 
+  80025d:	be 34 00 00 00       	mov    $0x34,%esi
+  800262:	48 bf 4e 56 80 00 00 	movabs $0x80564e,%rdi
+  800269:	00 00 00 
+  80026c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800271:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  800278:	00 00 00 
+  80027b:	41 ff d0             	call   *%r8
+    if ((r = dup(0, 1)) < 0)
+  80027e:	be 01 00 00 00       	mov    $0x1,%esi
+  800283:	bf 00 00 00 00       	mov    $0x0,%edi
+  800288:	48 b8 90 1c 80 00 00 	movabs $0x801c90,%rax
+  80028f:	00 00 00 
+  800292:	ff d0                	call   *%rax
+        panic("dup: %i", r);
+    while (1) {
+        cprintf("init: starting sh\n");
+  800294:	49 be 7c 56 80 00 00 	movabs $0x80567c,%r14
+  80029b:	00 00 00 
+  80029e:	48 bb 8b 07 80 00 00 	movabs $0x80078b,%rbx
+  8002a5:	00 00 00 
+        r = spawnl("/sh", "sh", (char *)0);
+  8002a8:	49 bd 90 56 80 00 00 	movabs $0x805690,%r13
+  8002af:	00 00 00 
+  8002b2:	49 bc 8f 56 80 00 00 	movabs $0x80568f,%r12
+  8002b9:	00 00 00 
+    if ((r = dup(0, 1)) < 0)
+  8002bc:	85 c0                	test   %eax,%eax
+  8002be:	79 40                	jns    800300 <umain+0x2ae>
+        panic("dup: %i", r);
+  8002c0:	89 c1                	mov    %eax,%ecx
+  8002c2:	48 ba 74 56 80 00 00 	movabs $0x805674,%rdx
+  8002c9:	00 00 00 
+  8002cc:	be 38 00 00 00       	mov    $0x38,%esi
+  8002d1:	48 bf 4e 56 80 00 00 	movabs $0x80564e,%rdi
+  8002d8:	00 00 00 
+  8002db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e0:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  8002e7:	00 00 00 
+  8002ea:	41 ff d0             	call   *%r8
+        if (r < 0) {
+            cprintf("init: spawn sh: %i\n", r);
+  8002ed:	89 c6                	mov    %eax,%esi
+  8002ef:	48 bf 93 56 80 00 00 	movabs $0x805693,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	ff d3                	call   *%rbx
+        cprintf("init: starting sh\n");
+  800300:	4c 89 f7             	mov    %r14,%rdi
+  800303:	b8 00 00 00 00       	mov    $0x0,%eax
+  800308:	ff d3                	call   *%rbx
+        r = spawnl("/sh", "sh", (char *)0);
+  80030a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80030f:	4c 89 ee             	mov    %r13,%rsi
+  800312:	4c 89 e7             	mov    %r12,%rdi
+  800315:	b8 00 00 00 00       	mov    $0x0,%eax
+  80031a:	48 b9 ec 42 80 00 00 	movabs $0x8042ec,%rcx
+  800321:	00 00 00 
+  800324:	ff d1                	call   *%rcx
+        if (r < 0) {
+  800326:	85 c0                	test   %eax,%eax
+  800328:	78 c3                	js     8002ed <umain+0x29b>
+            continue;
+        }
+        wait(r);
+  80032a:	89 c7                	mov    %eax,%edi
+  80032c:	48 b8 05 4a 80 00 00 	movabs $0x804a05,%rax
+  800333:	00 00 00 
+  800336:	ff d0                	call   *%rax
+  800338:	eb c6                	jmp    800300 <umain+0x2ae>
+
+000000000080033a <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	c3                   	ret
+
+0000000000800340 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  800340:	55                   	push   %rbp
+  800341:	48 89 e5             	mov    %rsp,%rbp
+  800344:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800347:	48 be 17 57 80 00 00 	movabs $0x805717,%rsi
+  80034e:	00 00 00 
+  800351:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  800358:	00 00 00 
+  80035b:	ff d0                	call   *%rax
+    return 0;
+}
+  80035d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  800378:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80037f:	48 85 d2             	test   %rdx,%rdx
+  800382:	74 7a                	je     8003fe <devcons_write+0x9a>
+  800384:	49 89 d6             	mov    %rdx,%r14
+  800387:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80038d:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  800392:	49 bf aa 12 80 00 00 	movabs $0x8012aa,%r15
+  800399:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80039c:	4c 89 f3             	mov    %r14,%rbx
+  80039f:	48 29 f3             	sub    %rsi,%rbx
+  8003a2:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8003a7:	48 39 c3             	cmp    %rax,%rbx
+  8003aa:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8003ae:	4c 63 eb             	movslq %ebx,%r13
+  8003b1:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8003b8:	48 01 c6             	add    %rax,%rsi
+  8003bb:	4c 89 ea             	mov    %r13,%rdx
+  8003be:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003c5:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8003c8:	4c 89 ee             	mov    %r13,%rsi
+  8003cb:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8003d2:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  8003d9:	00 00 00 
+  8003dc:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8003de:	41 01 dc             	add    %ebx,%r12d
+  8003e1:	49 63 f4             	movslq %r12d,%rsi
+  8003e4:	4c 39 f6             	cmp    %r14,%rsi
+  8003e7:	72 b3                	jb     80039c <devcons_write+0x38>
+    return res;
+  8003e9:	49 63 c4             	movslq %r12d,%rax
+}
+  8003ec:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8003f3:	5b                   	pop    %rbx
+  8003f4:	41 5c                	pop    %r12
+  8003f6:	41 5d                	pop    %r13
+  8003f8:	41 5e                	pop    %r14
+  8003fa:	41 5f                	pop    %r15
+  8003fc:	5d                   	pop    %rbp
+  8003fd:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8003fe:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800404:	eb e3                	jmp    8003e9 <devcons_write+0x85>
+
+0000000000800406 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800406:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800409:	ba 00 00 00 00       	mov    $0x0,%edx
+  80040e:	48 85 c0             	test   %rax,%rax
+  800411:	74 55                	je     800468 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800413:	55                   	push   %rbp
+  800414:	48 89 e5             	mov    %rsp,%rbp
+  800417:	41 55                	push   %r13
+  800419:	41 54                	push   %r12
+  80041b:	53                   	push   %rbx
+  80041c:	48 83 ec 08          	sub    $0x8,%rsp
+  800420:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  800423:	48 bb f6 14 80 00 00 	movabs $0x8014f6,%rbx
+  80042a:	00 00 00 
+  80042d:	49 bc ab 15 80 00 00 	movabs $0x8015ab,%r12
+  800434:	00 00 00 
+  800437:	eb 03                	jmp    80043c <devcons_read+0x36>
+  800439:	41 ff d4             	call   *%r12
+  80043c:	ff d3                	call   *%rbx
+  80043e:	85 c0                	test   %eax,%eax
+  800440:	74 f7                	je     800439 <devcons_read+0x33>
+    if (c < 0) return c;
+  800442:	48 63 d0             	movslq %eax,%rdx
+  800445:	78 13                	js     80045a <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800447:	ba 00 00 00 00       	mov    $0x0,%edx
+  80044c:	83 f8 04             	cmp    $0x4,%eax
+  80044f:	74 09                	je     80045a <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  800451:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  800455:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80045a:	48 89 d0             	mov    %rdx,%rax
+  80045d:	48 83 c4 08          	add    $0x8,%rsp
+  800461:	5b                   	pop    %rbx
+  800462:	41 5c                	pop    %r12
+  800464:	41 5d                	pop    %r13
+  800466:	5d                   	pop    %rbp
+  800467:	c3                   	ret
+  800468:	48 89 d0             	mov    %rdx,%rax
+  80046b:	c3                   	ret
+
+000000000080046c <cputchar>:
+cputchar(int ch) {
+  80046c:	55                   	push   %rbp
+  80046d:	48 89 e5             	mov    %rsp,%rbp
+  800470:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  800474:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  800478:	be 01 00 00 00       	mov    $0x1,%esi
+  80047d:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  800481:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  800488:	00 00 00 
+  80048b:	ff d0                	call   *%rax
+}
+  80048d:	c9                   	leave
+  80048e:	c3                   	ret
+
+000000000080048f <getchar>:
+getchar(void) {
+  80048f:	55                   	push   %rbp
+  800490:	48 89 e5             	mov    %rsp,%rbp
+  800493:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  800497:	ba 01 00 00 00       	mov    $0x1,%edx
+  80049c:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8004a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a5:	48 b8 b3 1d 80 00 00 	movabs $0x801db3,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+  8004b1:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8004b3:	85 c0                	test   %eax,%eax
+  8004b5:	78 06                	js     8004bd <getchar+0x2e>
+  8004b7:	74 08                	je     8004c1 <getchar+0x32>
+  8004b9:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8004bd:	89 d0                	mov    %edx,%eax
+  8004bf:	c9                   	leave
+  8004c0:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8004c1:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8004c6:	eb f5                	jmp    8004bd <getchar+0x2e>
+
+00000000008004c8 <iscons>:
+iscons(int fdnum) {
+  8004c8:	55                   	push   %rbp
+  8004c9:	48 89 e5             	mov    %rsp,%rbp
+  8004cc:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8004d0:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8004d4:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  8004db:	00 00 00 
+  8004de:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8004e0:	85 c0                	test   %eax,%eax
+  8004e2:	78 18                	js     8004fc <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8004e4:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8004e8:	48 b8 80 77 80 00 00 	movabs $0x807780,%rax
+  8004ef:	00 00 00 
+  8004f2:	8b 00                	mov    (%rax),%eax
+  8004f4:	39 02                	cmp    %eax,(%rdx)
+  8004f6:	0f 94 c0             	sete   %al
+  8004f9:	0f b6 c0             	movzbl %al,%eax
+}
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+
+00000000008004fe <opencons>:
+opencons(void) {
+  8004fe:	55                   	push   %rbp
+  8004ff:	48 89 e5             	mov    %rsp,%rbp
+  800502:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800506:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80050a:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  800511:	00 00 00 
+  800514:	ff d0                	call   *%rax
+  800516:	85 c0                	test   %eax,%eax
+  800518:	78 49                	js     800563 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80051a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80051f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800524:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800528:	bf 00 00 00 00       	mov    $0x0,%edi
+  80052d:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  800534:	00 00 00 
+  800537:	ff d0                	call   *%rax
+  800539:	85 c0                	test   %eax,%eax
+  80053b:	78 26                	js     800563 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80053d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800541:	a1 80 77 80 00 00 00 	movabs 0x807780,%eax
+  800548:	00 00 
+  80054a:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80054c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800550:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800557:	48 b8 42 1a 80 00 00 	movabs $0x801a42,%rax
+  80055e:	00 00 00 
+  800561:	ff d0                	call   *%rax
+}
+  800563:	c9                   	leave
+  800564:	c3                   	ret
+
+0000000000800565 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800565:	55                   	push   %rbp
+  800566:	48 89 e5             	mov    %rsp,%rbp
+  800569:	41 56                	push   %r14
+  80056b:	41 55                	push   %r13
+  80056d:	41 54                	push   %r12
+  80056f:	53                   	push   %rbx
+  800570:	41 89 fd             	mov    %edi,%r13d
+  800573:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800576:	48 ba 60 78 80 00 00 	movabs $0x807860,%rdx
+  80057d:	00 00 00 
+  800580:	48 b8 60 78 80 00 00 	movabs $0x807860,%rax
+  800587:	00 00 00 
+  80058a:	48 39 c2             	cmp    %rax,%rdx
+  80058d:	73 17                	jae    8005a6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80058f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800592:	49 89 c4             	mov    %rax,%r12
+  800595:	48 83 c3 08          	add    $0x8,%rbx
+  800599:	b8 00 00 00 00       	mov    $0x0,%eax
+  80059e:	ff 53 f8             	call   *-0x8(%rbx)
+  8005a1:	4c 39 e3             	cmp    %r12,%rbx
+  8005a4:	72 ef                	jb     800595 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8005a6:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  8005ad:	00 00 00 
+  8005b0:	ff d0                	call   *%rax
+  8005b2:	89 c2                	mov    %eax,%edx
+  8005b4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8005ba:	48 89 d0             	mov    %rdx,%rax
+  8005bd:	48 c1 e0 04          	shl    $0x4,%rax
+  8005c1:	48 29 d0             	sub    %rdx,%rax
+  8005c4:	48 c1 e0 05          	shl    $0x5,%rax
+  8005c8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8005cf:	00 00 00 
+  8005d2:	48 01 d0             	add    %rdx,%rax
+  8005d5:	48 a3 70 17 81 00 00 	movabs %rax,0x811770
+  8005dc:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8005df:	45 85 ed             	test   %r13d,%r13d
+  8005e2:	7e 0d                	jle    8005f1 <libmain+0x8c>
+  8005e4:	49 8b 06             	mov    (%r14),%rax
+  8005e7:	48 a3 c0 77 80 00 00 	movabs %rax,0x8077c0
+  8005ee:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8005f1:	4c 89 f6             	mov    %r14,%rsi
+  8005f4:	44 89 ef             	mov    %r13d,%edi
+  8005f7:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  8005fe:	00 00 00 
+  800601:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800603:	48 b8 18 06 80 00 00 	movabs $0x800618,%rax
+  80060a:	00 00 00 
+  80060d:	ff d0                	call   *%rax
+#endif
+}
+  80060f:	5b                   	pop    %rbx
+  800610:	41 5c                	pop    %r12
+  800612:	41 5d                	pop    %r13
+  800614:	41 5e                	pop    %r14
+  800616:	5d                   	pop    %rbp
+  800617:	c3                   	ret
+
+0000000000800618 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800618:	55                   	push   %rbp
+  800619:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80061c:	48 b8 68 1c 80 00 00 	movabs $0x801c68,%rax
+  800623:	00 00 00 
+  800626:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800628:	bf 00 00 00 00       	mov    $0x0,%edi
+  80062d:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  800634:	00 00 00 
+  800637:	ff d0                	call   *%rax
+}
+  800639:	5d                   	pop    %rbp
+  80063a:	c3                   	ret
+
+000000000080063b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80063b:	55                   	push   %rbp
+  80063c:	48 89 e5             	mov    %rsp,%rbp
+  80063f:	41 56                	push   %r14
+  800641:	41 55                	push   %r13
+  800643:	41 54                	push   %r12
+  800645:	53                   	push   %rbx
+  800646:	48 83 ec 50          	sub    $0x50,%rsp
+  80064a:	49 89 fc             	mov    %rdi,%r12
+  80064d:	41 89 f5             	mov    %esi,%r13d
+  800650:	48 89 d3             	mov    %rdx,%rbx
+  800653:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800657:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80065b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80065f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800666:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80066a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80066e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800672:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800676:	48 b8 c0 77 80 00 00 	movabs $0x8077c0,%rax
+  80067d:	00 00 00 
+  800680:	4c 8b 30             	mov    (%rax),%r14
+  800683:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  80068a:	00 00 00 
+  80068d:	ff d0                	call   *%rax
+  80068f:	89 c6                	mov    %eax,%esi
+  800691:	45 89 e8             	mov    %r13d,%r8d
+  800694:	4c 89 e1             	mov    %r12,%rcx
+  800697:	4c 89 f2             	mov    %r14,%rdx
+  80069a:	48 bf 30 57 80 00 00 	movabs $0x805730,%rdi
+  8006a1:	00 00 00 
+  8006a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006a9:	49 bc 8b 07 80 00 00 	movabs $0x80078b,%r12
+  8006b0:	00 00 00 
+  8006b3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8006b6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8006ba:	48 89 df             	mov    %rbx,%rdi
+  8006bd:	48 b8 27 07 80 00 00 	movabs $0x800727,%rax
+  8006c4:	00 00 00 
+  8006c7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8006c9:	48 bf 43 5d 80 00 00 	movabs $0x805d43,%rdi
+  8006d0:	00 00 00 
+  8006d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006d8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8006db:	cc                   	int3
+  8006dc:	eb fd                	jmp    8006db <_panic+0xa0>
+
+00000000008006de <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8006de:	55                   	push   %rbp
+  8006df:	48 89 e5             	mov    %rsp,%rbp
+  8006e2:	53                   	push   %rbx
+  8006e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8006e7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8006ea:	8b 06                	mov    (%rsi),%eax
+  8006ec:	8d 50 01             	lea    0x1(%rax),%edx
+  8006ef:	89 16                	mov    %edx,(%rsi)
+  8006f1:	48 98                	cltq
+  8006f3:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8006f8:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8006fe:	74 0a                	je     80070a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800700:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800704:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800708:	c9                   	leave
+  800709:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80070a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80070e:	be ff 00 00 00       	mov    $0xff,%esi
+  800713:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  80071a:	00 00 00 
+  80071d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80071f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800725:	eb d9                	jmp    800700 <putch+0x22>
+
+0000000000800727 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800727:	55                   	push   %rbp
+  800728:	48 89 e5             	mov    %rsp,%rbp
+  80072b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800732:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800735:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80073c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800741:	b8 00 00 00 00       	mov    $0x0,%eax
+  800746:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800749:	48 89 f1             	mov    %rsi,%rcx
+  80074c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800753:	48 bf de 06 80 00 00 	movabs $0x8006de,%rdi
+  80075a:	00 00 00 
+  80075d:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  800764:	00 00 00 
+  800767:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800769:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800770:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800777:	48 b8 d7 14 80 00 00 	movabs $0x8014d7,%rax
+  80077e:	00 00 00 
+  800781:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800783:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800789:	c9                   	leave
+  80078a:	c3                   	ret
+
+000000000080078b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80078b:	55                   	push   %rbp
+  80078c:	48 89 e5             	mov    %rsp,%rbp
+  80078f:	48 83 ec 50          	sub    $0x50,%rsp
+  800793:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800797:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80079b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80079f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8007a3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8007a7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8007ae:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007b2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8007ba:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8007be:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8007c2:	48 b8 27 07 80 00 00 	movabs $0x800727,%rax
+  8007c9:	00 00 00 
+  8007cc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8007ce:	c9                   	leave
+  8007cf:	c3                   	ret
+
+00000000008007d0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8007d0:	55                   	push   %rbp
+  8007d1:	48 89 e5             	mov    %rsp,%rbp
+  8007d4:	41 57                	push   %r15
+  8007d6:	41 56                	push   %r14
+  8007d8:	41 55                	push   %r13
+  8007da:	41 54                	push   %r12
+  8007dc:	53                   	push   %rbx
+  8007dd:	48 83 ec 18          	sub    $0x18,%rsp
+  8007e1:	49 89 fc             	mov    %rdi,%r12
+  8007e4:	49 89 f5             	mov    %rsi,%r13
+  8007e7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8007eb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8007ee:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8007f1:	41 89 cf             	mov    %ecx,%r15d
+  8007f4:	4c 39 fa             	cmp    %r15,%rdx
+  8007f7:	73 5b                	jae    800854 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8007f9:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8007fd:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800801:	85 db                	test   %ebx,%ebx
+  800803:	7e 0e                	jle    800813 <print_num+0x43>
+            putch(padc, put_arg);
+  800805:	4c 89 ee             	mov    %r13,%rsi
+  800808:	44 89 f7             	mov    %r14d,%edi
+  80080b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80080e:	83 eb 01             	sub    $0x1,%ebx
+  800811:	75 f2                	jne    800805 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800813:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800817:	48 b9 64 57 80 00 00 	movabs $0x805764,%rcx
+  80081e:	00 00 00 
+  800821:	48 b8 53 57 80 00 00 	movabs $0x805753,%rax
+  800828:	00 00 00 
+  80082b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80082f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800833:	ba 00 00 00 00       	mov    $0x0,%edx
+  800838:	49 f7 f7             	div    %r15
+  80083b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80083f:	4c 89 ee             	mov    %r13,%rsi
+  800842:	41 ff d4             	call   *%r12
+}
+  800845:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800849:	5b                   	pop    %rbx
+  80084a:	41 5c                	pop    %r12
+  80084c:	41 5d                	pop    %r13
+  80084e:	41 5e                	pop    %r14
+  800850:	41 5f                	pop    %r15
+  800852:	5d                   	pop    %rbp
+  800853:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800854:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800858:	ba 00 00 00 00       	mov    $0x0,%edx
+  80085d:	49 f7 f7             	div    %r15
+  800860:	48 83 ec 08          	sub    $0x8,%rsp
+  800864:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800868:	52                   	push   %rdx
+  800869:	45 0f be c9          	movsbl %r9b,%r9d
+  80086d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800871:	48 89 c2             	mov    %rax,%rdx
+  800874:	48 b8 d0 07 80 00 00 	movabs $0x8007d0,%rax
+  80087b:	00 00 00 
+  80087e:	ff d0                	call   *%rax
+  800880:	48 83 c4 10          	add    $0x10,%rsp
+  800884:	eb 8d                	jmp    800813 <print_num+0x43>
+
+0000000000800886 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800886:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80088a:	48 8b 06             	mov    (%rsi),%rax
+  80088d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800891:	73 0a                	jae    80089d <sprintputch+0x17>
+        *state->start++ = ch;
+  800893:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800897:	48 89 16             	mov    %rdx,(%rsi)
+  80089a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80089d:	c3                   	ret
+
+000000000080089e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80089e:	55                   	push   %rbp
+  80089f:	48 89 e5             	mov    %rsp,%rbp
+  8008a2:	48 83 ec 50          	sub    $0x50,%rsp
+  8008a6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8008aa:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8008ae:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8008b2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8008b9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8008bd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8008c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8008c9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8008cd:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  8008d4:	00 00 00 
+  8008d7:	ff d0                	call   *%rax
+}
+  8008d9:	c9                   	leave
+  8008da:	c3                   	ret
+
+00000000008008db <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8008db:	55                   	push   %rbp
+  8008dc:	48 89 e5             	mov    %rsp,%rbp
+  8008df:	41 57                	push   %r15
+  8008e1:	41 56                	push   %r14
+  8008e3:	41 55                	push   %r13
+  8008e5:	41 54                	push   %r12
+  8008e7:	53                   	push   %rbx
+  8008e8:	48 83 ec 38          	sub    $0x38,%rsp
+  8008ec:	49 89 fe             	mov    %rdi,%r14
+  8008ef:	49 89 f5             	mov    %rsi,%r13
+  8008f2:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8008f5:	48 8b 01             	mov    (%rcx),%rax
+  8008f8:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8008fc:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800900:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800904:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800908:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80090c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800910:	0f b6 3b             	movzbl (%rbx),%edi
+  800913:	40 80 ff 25          	cmp    $0x25,%dil
+  800917:	74 18                	je     800931 <vprintfmt+0x56>
+            if (!ch) return;
+  800919:	40 84 ff             	test   %dil,%dil
+  80091c:	0f 84 b1 06 00 00    	je     800fd3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800922:	40 0f b6 ff          	movzbl %dil,%edi
+  800926:	4c 89 ee             	mov    %r13,%rsi
+  800929:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80092c:	4c 89 e3             	mov    %r12,%rbx
+  80092f:	eb db                	jmp    80090c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800931:	be 00 00 00 00       	mov    $0x0,%esi
+  800936:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80093a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80093f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800945:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80094c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800950:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800955:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80095a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80095d:	83 e8 23             	sub    $0x23,%eax
+  800960:	3c 57                	cmp    $0x57,%al
+  800962:	0f 87 51 06 00 00    	ja     800fb9 <vprintfmt+0x6de>
+  800968:	0f b6 c0             	movzbl %al,%eax
+  80096b:	48 b9 20 59 80 00 00 	movabs $0x805920,%rcx
+  800972:	00 00 00 
+  800975:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800978:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80097b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80097f:	eb cf                	jmp    800950 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800981:	49 89 dc             	mov    %rbx,%r12
+  800984:	be 01 00 00 00       	mov    $0x1,%esi
+  800989:	eb c5                	jmp    800950 <vprintfmt+0x75>
+            padc = ch;
+  80098b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80098f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800992:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800995:	eb b9                	jmp    800950 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800997:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80099a:	83 f8 2f             	cmp    $0x2f,%eax
+  80099d:	77 24                	ja     8009c3 <vprintfmt+0xe8>
+  80099f:	89 c1                	mov    %eax,%ecx
+  8009a1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8009a5:	83 c0 08             	add    $0x8,%eax
+  8009a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ab:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8009ae:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8009b1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009b5:	79 99                	jns    800950 <vprintfmt+0x75>
+                width = precision;
+  8009b7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8009bb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8009c1:	eb 8d                	jmp    800950 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8009c3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8009c7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8009cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009cf:	eb da                	jmp    8009ab <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8009d1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8009d6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009da:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8009e0:	3c 39                	cmp    $0x39,%al
+  8009e2:	77 1c                	ja     800a00 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8009e4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8009e8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8009ec:	0f b6 c0             	movzbl %al,%eax
+  8009ef:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8009f4:	0f b6 03             	movzbl (%rbx),%eax
+  8009f7:	3c 39                	cmp    $0x39,%al
+  8009f9:	76 e9                	jbe    8009e4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8009fb:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8009fe:	eb b1                	jmp    8009b1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800a00:	49 89 dc             	mov    %rbx,%r12
+  800a03:	eb ac                	jmp    8009b1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800a05:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800a08:	85 c9                	test   %ecx,%ecx
+  800a0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800a0f:	0f 49 c1             	cmovns %ecx,%eax
+  800a12:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800a15:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a18:	e9 33 ff ff ff       	jmp    800950 <vprintfmt+0x75>
+            lflag++;
+  800a1d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800a20:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800a23:	e9 28 ff ff ff       	jmp    800950 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800a28:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2e:	77 19                	ja     800a49 <vprintfmt+0x16e>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	8b 3a                	mov    (%rdx),%edi
+  800a3e:	4c 89 ee             	mov    %r13,%rsi
+  800a41:	41 ff d6             	call   *%r14
+            break;
+  800a44:	e9 c3 fe ff ff       	jmp    80090c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800a49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a55:	eb e5                	jmp    800a3c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800a57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a5d:	77 5a                	ja     800ab9 <vprintfmt+0x1de>
+  800a5f:	89 c2                	mov    %eax,%edx
+  800a61:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a65:	83 c0 08             	add    $0x8,%eax
+  800a68:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800a6b:	8b 02                	mov    (%rdx),%eax
+  800a6d:	89 c1                	mov    %eax,%ecx
+  800a6f:	f7 d9                	neg    %ecx
+  800a71:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800a74:	83 f9 16             	cmp    $0x16,%ecx
+  800a77:	7f 4e                	jg     800ac7 <vprintfmt+0x1ec>
+  800a79:	48 63 c1             	movslq %ecx,%rax
+  800a7c:	48 ba e0 5b 80 00 00 	movabs $0x805be0,%rdx
+  800a83:	00 00 00 
+  800a86:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800a8a:	48 85 c0             	test   %rax,%rax
+  800a8d:	74 38                	je     800ac7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800a8f:	48 89 c1             	mov    %rax,%rcx
+  800a92:	48 ba 83 5e 80 00 00 	movabs $0x805e83,%rdx
+  800a99:	00 00 00 
+  800a9c:	4c 89 ee             	mov    %r13,%rsi
+  800a9f:	4c 89 f7             	mov    %r14,%rdi
+  800aa2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aa7:	49 b8 9e 08 80 00 00 	movabs $0x80089e,%r8
+  800aae:	00 00 00 
+  800ab1:	41 ff d0             	call   *%r8
+  800ab4:	e9 53 fe ff ff       	jmp    80090c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800ab9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac5:	eb a4                	jmp    800a6b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800ac7:	48 ba 7c 57 80 00 00 	movabs $0x80577c,%rdx
+  800ace:	00 00 00 
+  800ad1:	4c 89 ee             	mov    %r13,%rsi
+  800ad4:	4c 89 f7             	mov    %r14,%rdi
+  800ad7:	b8 00 00 00 00       	mov    $0x0,%eax
+  800adc:	49 b8 9e 08 80 00 00 	movabs $0x80089e,%r8
+  800ae3:	00 00 00 
+  800ae6:	41 ff d0             	call   *%r8
+  800ae9:	e9 1e fe ff ff       	jmp    80090c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800aee:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af1:	83 f8 2f             	cmp    $0x2f,%eax
+  800af4:	77 6c                	ja     800b62 <vprintfmt+0x287>
+  800af6:	89 c2                	mov    %eax,%edx
+  800af8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800afc:	83 c0 08             	add    $0x8,%eax
+  800aff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b02:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800b05:	48 85 d2             	test   %rdx,%rdx
+  800b08:	48 b8 75 57 80 00 00 	movabs $0x805775,%rax
+  800b0f:	00 00 00 
+  800b12:	48 0f 45 c2          	cmovne %rdx,%rax
+  800b16:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800b1a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b1e:	7e 06                	jle    800b26 <vprintfmt+0x24b>
+  800b20:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800b24:	75 4a                	jne    800b70 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800b26:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800b2a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800b2e:	0f b6 00             	movzbl (%rax),%eax
+  800b31:	84 c0                	test   %al,%al
+  800b33:	0f 85 9a 00 00 00    	jne    800bd3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800b39:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b3c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800b40:	85 c0                	test   %eax,%eax
+  800b42:	0f 8e c4 fd ff ff    	jle    80090c <vprintfmt+0x31>
+  800b48:	4c 89 ee             	mov    %r13,%rsi
+  800b4b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800b50:	41 ff d6             	call   *%r14
+  800b53:	41 83 ec 01          	sub    $0x1,%r12d
+  800b57:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800b5b:	75 eb                	jne    800b48 <vprintfmt+0x26d>
+  800b5d:	e9 aa fd ff ff       	jmp    80090c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800b62:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b66:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b6a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6e:	eb 92                	jmp    800b02 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800b70:	49 63 f7             	movslq %r15d,%rsi
+  800b73:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800b77:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  800b7e:	00 00 00 
+  800b81:	ff d0                	call   *%rax
+  800b83:	48 89 c2             	mov    %rax,%rdx
+  800b86:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800b89:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800b8b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800b8e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800b91:	85 c0                	test   %eax,%eax
+  800b93:	7e 91                	jle    800b26 <vprintfmt+0x24b>
+  800b95:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800b9a:	4c 89 ee             	mov    %r13,%rsi
+  800b9d:	44 89 e7             	mov    %r12d,%edi
+  800ba0:	41 ff d6             	call   *%r14
+  800ba3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800ba7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800baa:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800bad:	75 eb                	jne    800b9a <vprintfmt+0x2bf>
+  800baf:	e9 72 ff ff ff       	jmp    800b26 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800bb4:	0f b6 f8             	movzbl %al,%edi
+  800bb7:	4c 89 ee             	mov    %r13,%rsi
+  800bba:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800bbd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800bc1:	49 83 c4 01          	add    $0x1,%r12
+  800bc5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800bcb:	84 c0                	test   %al,%al
+  800bcd:	0f 84 66 ff ff ff    	je     800b39 <vprintfmt+0x25e>
+  800bd3:	45 85 ff             	test   %r15d,%r15d
+  800bd6:	78 0a                	js     800be2 <vprintfmt+0x307>
+  800bd8:	41 83 ef 01          	sub    $0x1,%r15d
+  800bdc:	0f 88 57 ff ff ff    	js     800b39 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800be2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800be6:	74 cc                	je     800bb4 <vprintfmt+0x2d9>
+  800be8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800beb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800bf0:	80 fa 5e             	cmp    $0x5e,%dl
+  800bf3:	77 c2                	ja     800bb7 <vprintfmt+0x2dc>
+  800bf5:	eb bd                	jmp    800bb4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800bf7:	40 84 f6             	test   %sil,%sil
+  800bfa:	75 26                	jne    800c22 <vprintfmt+0x347>
+    switch (lflag) {
+  800bfc:	85 d2                	test   %edx,%edx
+  800bfe:	74 59                	je     800c59 <vprintfmt+0x37e>
+  800c00:	83 fa 01             	cmp    $0x1,%edx
+  800c03:	74 7b                	je     800c80 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800c05:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c08:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0b:	0f 87 96 00 00 00    	ja     800ca7 <vprintfmt+0x3cc>
+  800c11:	89 c2                	mov    %eax,%edx
+  800c13:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c17:	83 c0 08             	add    $0x8,%eax
+  800c1a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1d:	4c 8b 22             	mov    (%rdx),%r12
+  800c20:	eb 17                	jmp    800c39 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800c22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c25:	83 f8 2f             	cmp    $0x2f,%eax
+  800c28:	77 21                	ja     800c4b <vprintfmt+0x370>
+  800c2a:	89 c2                	mov    %eax,%edx
+  800c2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c30:	83 c0 08             	add    $0x8,%eax
+  800c33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c36:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800c39:	4d 85 e4             	test   %r12,%r12
+  800c3c:	78 7a                	js     800cb8 <vprintfmt+0x3dd>
+            num = i;
+  800c3e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800c41:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800c46:	e9 50 02 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c4f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c53:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c57:	eb dd                	jmp    800c36 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800c59:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c5c:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5f:	77 11                	ja     800c72 <vprintfmt+0x397>
+  800c61:	89 c2                	mov    %eax,%edx
+  800c63:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c67:	83 c0 08             	add    $0x8,%eax
+  800c6a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6d:	4c 63 22             	movslq (%rdx),%r12
+  800c70:	eb c7                	jmp    800c39 <vprintfmt+0x35e>
+  800c72:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c76:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7e:	eb ed                	jmp    800c6d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800c80:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c83:	83 f8 2f             	cmp    $0x2f,%eax
+  800c86:	77 11                	ja     800c99 <vprintfmt+0x3be>
+  800c88:	89 c2                	mov    %eax,%edx
+  800c8a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c8e:	83 c0 08             	add    $0x8,%eax
+  800c91:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c94:	4c 8b 22             	mov    (%rdx),%r12
+  800c97:	eb a0                	jmp    800c39 <vprintfmt+0x35e>
+  800c99:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca5:	eb ed                	jmp    800c94 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ca7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800caf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cb3:	e9 65 ff ff ff       	jmp    800c1d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800cb8:	4c 89 ee             	mov    %r13,%rsi
+  800cbb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800cc0:	41 ff d6             	call   *%r14
+                i = -i;
+  800cc3:	49 f7 dc             	neg    %r12
+  800cc6:	e9 73 ff ff ff       	jmp    800c3e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ccb:	40 84 f6             	test   %sil,%sil
+  800cce:	75 32                	jne    800d02 <vprintfmt+0x427>
+    switch (lflag) {
+  800cd0:	85 d2                	test   %edx,%edx
+  800cd2:	74 5d                	je     800d31 <vprintfmt+0x456>
+  800cd4:	83 fa 01             	cmp    $0x1,%edx
+  800cd7:	0f 84 82 00 00 00    	je     800d5f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800cdd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce0:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce3:	0f 87 a5 00 00 00    	ja     800d8e <vprintfmt+0x4b3>
+  800ce9:	89 c2                	mov    %eax,%edx
+  800ceb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cef:	83 c0 08             	add    $0x8,%eax
+  800cf2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf5:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800cf8:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cfd:	e9 99 01 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d02:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d05:	83 f8 2f             	cmp    $0x2f,%eax
+  800d08:	77 19                	ja     800d23 <vprintfmt+0x448>
+  800d0a:	89 c2                	mov    %eax,%edx
+  800d0c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d10:	83 c0 08             	add    $0x8,%eax
+  800d13:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d16:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d19:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d1e:	e9 78 01 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+  800d23:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d27:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2f:	eb e5                	jmp    800d16 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800d31:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d34:	83 f8 2f             	cmp    $0x2f,%eax
+  800d37:	77 18                	ja     800d51 <vprintfmt+0x476>
+  800d39:	89 c2                	mov    %eax,%edx
+  800d3b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3f:	83 c0 08             	add    $0x8,%eax
+  800d42:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d45:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800d47:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800d4c:	e9 4a 01 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+  800d51:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d55:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d59:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5d:	eb e6                	jmp    800d45 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800d5f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d62:	83 f8 2f             	cmp    $0x2f,%eax
+  800d65:	77 19                	ja     800d80 <vprintfmt+0x4a5>
+  800d67:	89 c2                	mov    %eax,%edx
+  800d69:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6d:	83 c0 08             	add    $0x8,%eax
+  800d70:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d73:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800d76:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800d7b:	e9 1b 01 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+  800d80:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d84:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d88:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8c:	eb e5                	jmp    800d73 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800d8e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d92:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d96:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d9a:	e9 56 ff ff ff       	jmp    800cf5 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800d9f:	40 84 f6             	test   %sil,%sil
+  800da2:	75 2e                	jne    800dd2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800da4:	85 d2                	test   %edx,%edx
+  800da6:	74 59                	je     800e01 <vprintfmt+0x526>
+  800da8:	83 fa 01             	cmp    $0x1,%edx
+  800dab:	74 7f                	je     800e2c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800dad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db0:	83 f8 2f             	cmp    $0x2f,%eax
+  800db3:	0f 87 9f 00 00 00    	ja     800e58 <vprintfmt+0x57d>
+  800db9:	89 c2                	mov    %eax,%edx
+  800dbb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dbf:	83 c0 08             	add    $0x8,%eax
+  800dc2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800dc8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800dcd:	e9 c9 00 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dd2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dd5:	83 f8 2f             	cmp    $0x2f,%eax
+  800dd8:	77 19                	ja     800df3 <vprintfmt+0x518>
+  800dda:	89 c2                	mov    %eax,%edx
+  800ddc:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800de0:	83 c0 08             	add    $0x8,%eax
+  800de3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800de6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800de9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dee:	e9 a8 00 00 00       	jmp    800e9b <vprintfmt+0x5c0>
+  800df3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800df7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dff:	eb e5                	jmp    800de6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800e01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e04:	83 f8 2f             	cmp    $0x2f,%eax
+  800e07:	77 15                	ja     800e1e <vprintfmt+0x543>
+  800e09:	89 c2                	mov    %eax,%edx
+  800e0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e0f:	83 c0 08             	add    $0x8,%eax
+  800e12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e15:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800e17:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800e1c:	eb 7d                	jmp    800e9b <vprintfmt+0x5c0>
+  800e1e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e22:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e26:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e2a:	eb e9                	jmp    800e15 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800e2c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e2f:	83 f8 2f             	cmp    $0x2f,%eax
+  800e32:	77 16                	ja     800e4a <vprintfmt+0x56f>
+  800e34:	89 c2                	mov    %eax,%edx
+  800e36:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e3a:	83 c0 08             	add    $0x8,%eax
+  800e3d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e40:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800e43:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800e48:	eb 51                	jmp    800e9b <vprintfmt+0x5c0>
+  800e4a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e4e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e52:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e56:	eb e8                	jmp    800e40 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800e58:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e5c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e60:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e64:	e9 5c ff ff ff       	jmp    800dc5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800e69:	4c 89 ee             	mov    %r13,%rsi
+  800e6c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800e71:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800e74:	4c 89 ee             	mov    %r13,%rsi
+  800e77:	bf 78 00 00 00       	mov    $0x78,%edi
+  800e7c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800e7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e82:	83 f8 2f             	cmp    $0x2f,%eax
+  800e85:	77 47                	ja     800ece <vprintfmt+0x5f3>
+  800e87:	89 c2                	mov    %eax,%edx
+  800e89:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e8d:	83 c0 08             	add    $0x8,%eax
+  800e90:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e93:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e96:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800e9b:	48 83 ec 08          	sub    $0x8,%rsp
+  800e9f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ea3:	0f 94 c0             	sete   %al
+  800ea6:	0f b6 c0             	movzbl %al,%eax
+  800ea9:	50                   	push   %rax
+  800eaa:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800eaf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800eb3:	4c 89 ee             	mov    %r13,%rsi
+  800eb6:	4c 89 f7             	mov    %r14,%rdi
+  800eb9:	48 b8 d0 07 80 00 00 	movabs $0x8007d0,%rax
+  800ec0:	00 00 00 
+  800ec3:	ff d0                	call   *%rax
+            break;
+  800ec5:	48 83 c4 10          	add    $0x10,%rsp
+  800ec9:	e9 3e fa ff ff       	jmp    80090c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ece:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ed2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ed6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800eda:	eb b7                	jmp    800e93 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800edc:	40 84 f6             	test   %sil,%sil
+  800edf:	75 2b                	jne    800f0c <vprintfmt+0x631>
+    switch (lflag) {
+  800ee1:	85 d2                	test   %edx,%edx
+  800ee3:	74 56                	je     800f3b <vprintfmt+0x660>
+  800ee5:	83 fa 01             	cmp    $0x1,%edx
+  800ee8:	74 7f                	je     800f69 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800eea:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eed:	83 f8 2f             	cmp    $0x2f,%eax
+  800ef0:	0f 87 a2 00 00 00    	ja     800f98 <vprintfmt+0x6bd>
+  800ef6:	89 c2                	mov    %eax,%edx
+  800ef8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800efc:	83 c0 08             	add    $0x8,%eax
+  800eff:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f02:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f05:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f0a:	eb 8f                	jmp    800e9b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f0c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f0f:	83 f8 2f             	cmp    $0x2f,%eax
+  800f12:	77 19                	ja     800f2d <vprintfmt+0x652>
+  800f14:	89 c2                	mov    %eax,%edx
+  800f16:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f1a:	83 c0 08             	add    $0x8,%eax
+  800f1d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f20:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f23:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f28:	e9 6e ff ff ff       	jmp    800e9b <vprintfmt+0x5c0>
+  800f2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f39:	eb e5                	jmp    800f20 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800f3b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f3e:	83 f8 2f             	cmp    $0x2f,%eax
+  800f41:	77 18                	ja     800f5b <vprintfmt+0x680>
+  800f43:	89 c2                	mov    %eax,%edx
+  800f45:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f49:	83 c0 08             	add    $0x8,%eax
+  800f4c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800f51:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800f56:	e9 40 ff ff ff       	jmp    800e9b <vprintfmt+0x5c0>
+  800f5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f67:	eb e6                	jmp    800f4f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800f69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6f:	77 19                	ja     800f8a <vprintfmt+0x6af>
+  800f71:	89 c2                	mov    %eax,%edx
+  800f73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f77:	83 c0 08             	add    $0x8,%eax
+  800f7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800f80:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800f85:	e9 11 ff ff ff       	jmp    800e9b <vprintfmt+0x5c0>
+  800f8a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f92:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f96:	eb e5                	jmp    800f7d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800f98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fa0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa4:	e9 59 ff ff ff       	jmp    800f02 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800fa9:	4c 89 ee             	mov    %r13,%rsi
+  800fac:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fb1:	41 ff d6             	call   *%r14
+            break;
+  800fb4:	e9 53 f9 ff ff       	jmp    80090c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800fb9:	4c 89 ee             	mov    %r13,%rsi
+  800fbc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800fc1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800fc4:	48 83 eb 01          	sub    $0x1,%rbx
+  800fc8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800fcc:	75 f6                	jne    800fc4 <vprintfmt+0x6e9>
+  800fce:	e9 39 f9 ff ff       	jmp    80090c <vprintfmt+0x31>
+}
+  800fd3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800fd7:	5b                   	pop    %rbx
+  800fd8:	41 5c                	pop    %r12
+  800fda:	41 5d                	pop    %r13
+  800fdc:	41 5e                	pop    %r14
+  800fde:	41 5f                	pop    %r15
+  800fe0:	5d                   	pop    %rbp
+  800fe1:	c3                   	ret
+
+0000000000800fe2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800fe2:	55                   	push   %rbp
+  800fe3:	48 89 e5             	mov    %rsp,%rbp
+  800fe6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800fea:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800fee:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ff3:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ff7:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ffe:	48 85 ff             	test   %rdi,%rdi
+  801001:	74 2b                	je     80102e <vsnprintf+0x4c>
+  801003:	48 85 f6             	test   %rsi,%rsi
+  801006:	74 26                	je     80102e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801008:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  80100c:	48 bf 86 08 80 00 00 	movabs $0x800886,%rdi
+  801013:	00 00 00 
+  801016:	48 b8 db 08 80 00 00 	movabs $0x8008db,%rax
+  80101d:	00 00 00 
+  801020:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  801022:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801026:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801029:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  80102c:	c9                   	leave
+  80102d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80102e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801033:	eb f7                	jmp    80102c <vsnprintf+0x4a>
+
+0000000000801035 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801035:	55                   	push   %rbp
+  801036:	48 89 e5             	mov    %rsp,%rbp
+  801039:	48 83 ec 50          	sub    $0x50,%rsp
+  80103d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  801041:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801045:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801049:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  801050:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  801054:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801058:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80105c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  801060:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  801064:	48 b8 e2 0f 80 00 00 	movabs $0x800fe2,%rax
+  80106b:	00 00 00 
+  80106e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  801070:	c9                   	leave
+  801071:	c3                   	ret
+
+0000000000801072 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  801072:	80 3f 00             	cmpb   $0x0,(%rdi)
+  801075:	74 10                	je     801087 <strlen+0x15>
+    size_t n = 0;
+  801077:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  80107c:	48 83 c0 01          	add    $0x1,%rax
+  801080:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  801084:	75 f6                	jne    80107c <strlen+0xa>
+  801086:	c3                   	ret
+    size_t n = 0;
+  801087:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  80108c:	c3                   	ret
+
+000000000080108d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  80108d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  801090:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  801095:	48 85 f6             	test   %rsi,%rsi
+  801098:	74 11                	je     8010ab <strnlen+0x1e>
+  80109a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  80109e:	74 0c                	je     8010ac <strnlen+0x1f>
+  8010a0:	48 83 c2 01          	add    $0x1,%rdx
+  8010a4:	48 39 d0             	cmp    %rdx,%rax
+  8010a7:	75 f1                	jne    80109a <strnlen+0xd>
+  8010a9:	eb 04                	jmp    8010af <strnlen+0x22>
+  8010ab:	c3                   	ret
+  8010ac:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8010af:	c3                   	ret
+
+00000000008010b0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8010b0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8010b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  8010bc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  8010bf:	48 83 c2 01          	add    $0x1,%rdx
+  8010c3:	84 c9                	test   %cl,%cl
+  8010c5:	75 f1                	jne    8010b8 <strcpy+0x8>
+        ;
+    return res;
+}
+  8010c7:	c3                   	ret
+
+00000000008010c8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  8010c8:	55                   	push   %rbp
+  8010c9:	48 89 e5             	mov    %rsp,%rbp
+  8010cc:	41 54                	push   %r12
+  8010ce:	53                   	push   %rbx
+  8010cf:	48 89 fb             	mov    %rdi,%rbx
+  8010d2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  8010d5:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  8010dc:	00 00 00 
+  8010df:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  8010e1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  8010e5:	4c 89 e6             	mov    %r12,%rsi
+  8010e8:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  8010ef:	00 00 00 
+  8010f2:	ff d0                	call   *%rax
+    return dst;
+}
+  8010f4:	48 89 d8             	mov    %rbx,%rax
+  8010f7:	5b                   	pop    %rbx
+  8010f8:	41 5c                	pop    %r12
+  8010fa:	5d                   	pop    %rbp
+  8010fb:	c3                   	ret
+
+00000000008010fc <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  8010fc:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  8010ff:	48 85 d2             	test   %rdx,%rdx
+  801102:	74 1f                	je     801123 <strncpy+0x27>
+  801104:	48 01 fa             	add    %rdi,%rdx
+  801107:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  80110a:	48 83 c1 01          	add    $0x1,%rcx
+  80110e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  801112:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801116:	41 80 f8 01          	cmp    $0x1,%r8b
+  80111a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80111e:	48 39 ca             	cmp    %rcx,%rdx
+  801121:	75 e7                	jne    80110a <strncpy+0xe>
+    }
+    return ret;
+}
+  801123:	c3                   	ret
+
+0000000000801124 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801124:	48 89 f8             	mov    %rdi,%rax
+  801127:	48 85 d2             	test   %rdx,%rdx
+  80112a:	74 24                	je     801150 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  80112c:	48 83 ea 01          	sub    $0x1,%rdx
+  801130:	74 1b                	je     80114d <strlcpy+0x29>
+  801132:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801136:	0f b6 16             	movzbl (%rsi),%edx
+  801139:	84 d2                	test   %dl,%dl
+  80113b:	74 10                	je     80114d <strlcpy+0x29>
+            *dst++ = *src++;
+  80113d:	48 83 c6 01          	add    $0x1,%rsi
+  801141:	48 83 c0 01          	add    $0x1,%rax
+  801145:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801148:	48 39 c8             	cmp    %rcx,%rax
+  80114b:	75 e9                	jne    801136 <strlcpy+0x12>
+        *dst = '\0';
+  80114d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801150:	48 29 f8             	sub    %rdi,%rax
+}
+  801153:	c3                   	ret
+
+0000000000801154 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801154:	0f b6 07             	movzbl (%rdi),%eax
+  801157:	84 c0                	test   %al,%al
+  801159:	74 13                	je     80116e <strcmp+0x1a>
+  80115b:	38 06                	cmp    %al,(%rsi)
+  80115d:	75 0f                	jne    80116e <strcmp+0x1a>
+  80115f:	48 83 c7 01          	add    $0x1,%rdi
+  801163:	48 83 c6 01          	add    $0x1,%rsi
+  801167:	0f b6 07             	movzbl (%rdi),%eax
+  80116a:	84 c0                	test   %al,%al
+  80116c:	75 ed                	jne    80115b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80116e:	0f b6 c0             	movzbl %al,%eax
+  801171:	0f b6 16             	movzbl (%rsi),%edx
+  801174:	29 d0                	sub    %edx,%eax
+}
+  801176:	c3                   	ret
+
+0000000000801177 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801177:	48 85 d2             	test   %rdx,%rdx
+  80117a:	74 1f                	je     80119b <strncmp+0x24>
+  80117c:	0f b6 07             	movzbl (%rdi),%eax
+  80117f:	84 c0                	test   %al,%al
+  801181:	74 1e                	je     8011a1 <strncmp+0x2a>
+  801183:	3a 06                	cmp    (%rsi),%al
+  801185:	75 1a                	jne    8011a1 <strncmp+0x2a>
+  801187:	48 83 c7 01          	add    $0x1,%rdi
+  80118b:	48 83 c6 01          	add    $0x1,%rsi
+  80118f:	48 83 ea 01          	sub    $0x1,%rdx
+  801193:	75 e7                	jne    80117c <strncmp+0x5>
+
+    if (!n) return 0;
+  801195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119a:	c3                   	ret
+  80119b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011a0:	c3                   	ret
+  8011a1:	48 85 d2             	test   %rdx,%rdx
+  8011a4:	74 09                	je     8011af <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8011a6:	0f b6 07             	movzbl (%rdi),%eax
+  8011a9:	0f b6 16             	movzbl (%rsi),%edx
+  8011ac:	29 d0                	sub    %edx,%eax
+  8011ae:	c3                   	ret
+    if (!n) return 0;
+  8011af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011b4:	c3                   	ret
+
+00000000008011b5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  8011b5:	0f b6 17             	movzbl (%rdi),%edx
+  8011b8:	84 d2                	test   %dl,%dl
+  8011ba:	74 18                	je     8011d4 <strchr+0x1f>
+        if (*str == c) {
+  8011bc:	0f be d2             	movsbl %dl,%edx
+  8011bf:	39 f2                	cmp    %esi,%edx
+  8011c1:	74 17                	je     8011da <strchr+0x25>
+    for (; *str; str++) {
+  8011c3:	48 83 c7 01          	add    $0x1,%rdi
+  8011c7:	0f b6 17             	movzbl (%rdi),%edx
+  8011ca:	84 d2                	test   %dl,%dl
+  8011cc:	75 ee                	jne    8011bc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8011ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d3:	c3                   	ret
+  8011d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d9:	c3                   	ret
+  8011da:	48 89 f8             	mov    %rdi,%rax
+}
+  8011dd:	c3                   	ret
+
+00000000008011de <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8011de:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8011e1:	0f b6 17             	movzbl (%rdi),%edx
+  8011e4:	84 d2                	test   %dl,%dl
+  8011e6:	74 13                	je     8011fb <strfind+0x1d>
+  8011e8:	0f be d2             	movsbl %dl,%edx
+  8011eb:	39 f2                	cmp    %esi,%edx
+  8011ed:	74 0b                	je     8011fa <strfind+0x1c>
+  8011ef:	48 83 c0 01          	add    $0x1,%rax
+  8011f3:	0f b6 10             	movzbl (%rax),%edx
+  8011f6:	84 d2                	test   %dl,%dl
+  8011f8:	75 ee                	jne    8011e8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8011fa:	c3                   	ret
+  8011fb:	c3                   	ret
+
+00000000008011fc <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8011fc:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8011ff:	48 89 f8             	mov    %rdi,%rax
+  801202:	48 f7 d8             	neg    %rax
+  801205:	83 e0 07             	and    $0x7,%eax
+  801208:	49 89 d1             	mov    %rdx,%r9
+  80120b:	49 29 c1             	sub    %rax,%r9
+  80120e:	78 36                	js     801246 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801210:	40 0f b6 c6          	movzbl %sil,%eax
+  801214:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80121b:	01 01 01 
+  80121e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801222:	40 f6 c7 07          	test   $0x7,%dil
+  801226:	75 38                	jne    801260 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801228:	4c 89 c9             	mov    %r9,%rcx
+  80122b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80122f:	74 0c                	je     80123d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801231:	fc                   	cld
+  801232:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801235:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801239:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80123d:	4d 85 c9             	test   %r9,%r9
+  801240:	75 45                	jne    801287 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801242:	4c 89 c0             	mov    %r8,%rax
+  801245:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801246:	48 85 d2             	test   %rdx,%rdx
+  801249:	74 f7                	je     801242 <memset+0x46>
+  80124b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80124e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801251:	48 83 c0 01          	add    $0x1,%rax
+  801255:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801259:	48 39 c2             	cmp    %rax,%rdx
+  80125c:	75 f3                	jne    801251 <memset+0x55>
+  80125e:	eb e2                	jmp    801242 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801260:	40 f6 c7 01          	test   $0x1,%dil
+  801264:	74 06                	je     80126c <memset+0x70>
+  801266:	88 07                	mov    %al,(%rdi)
+  801268:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80126c:	40 f6 c7 02          	test   $0x2,%dil
+  801270:	74 07                	je     801279 <memset+0x7d>
+  801272:	66 89 07             	mov    %ax,(%rdi)
+  801275:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801279:	40 f6 c7 04          	test   $0x4,%dil
+  80127d:	74 a9                	je     801228 <memset+0x2c>
+  80127f:	89 07                	mov    %eax,(%rdi)
+  801281:	48 83 c7 04          	add    $0x4,%rdi
+  801285:	eb a1                	jmp    801228 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801287:	41 f6 c1 04          	test   $0x4,%r9b
+  80128b:	74 06                	je     801293 <memset+0x97>
+  80128d:	89 07                	mov    %eax,(%rdi)
+  80128f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801293:	41 f6 c1 02          	test   $0x2,%r9b
+  801297:	74 07                	je     8012a0 <memset+0xa4>
+  801299:	66 89 07             	mov    %ax,(%rdi)
+  80129c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8012a0:	41 f6 c1 01          	test   $0x1,%r9b
+  8012a4:	74 9c                	je     801242 <memset+0x46>
+  8012a6:	88 07                	mov    %al,(%rdi)
+  8012a8:	eb 98                	jmp    801242 <memset+0x46>
+
+00000000008012aa <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8012aa:	48 89 f8             	mov    %rdi,%rax
+  8012ad:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8012b0:	48 39 fe             	cmp    %rdi,%rsi
+  8012b3:	73 3b                	jae    8012f0 <memmove+0x46>
+  8012b5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8012b9:	48 39 d7             	cmp    %rdx,%rdi
+  8012bc:	73 32                	jae    8012f0 <memmove+0x46>
+        s += n;
+        d += n;
+  8012be:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012c2:	48 89 d6             	mov    %rdx,%rsi
+  8012c5:	48 09 fe             	or     %rdi,%rsi
+  8012c8:	48 09 ce             	or     %rcx,%rsi
+  8012cb:	40 f6 c6 07          	test   $0x7,%sil
+  8012cf:	75 12                	jne    8012e3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8012d1:	48 83 ef 08          	sub    $0x8,%rdi
+  8012d5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8012d9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8012dd:	fd                   	std
+  8012de:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8012e1:	fc                   	cld
+  8012e2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8012e3:	48 83 ef 01          	sub    $0x1,%rdi
+  8012e7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8012eb:	fd                   	std
+  8012ec:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8012ee:	eb f1                	jmp    8012e1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8012f0:	48 89 f2             	mov    %rsi,%rdx
+  8012f3:	48 09 c2             	or     %rax,%rdx
+  8012f6:	48 09 ca             	or     %rcx,%rdx
+  8012f9:	f6 c2 07             	test   $0x7,%dl
+  8012fc:	75 0c                	jne    80130a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8012fe:	48 c1 e9 03          	shr    $0x3,%rcx
+  801302:	48 89 c7             	mov    %rax,%rdi
+  801305:	fc                   	cld
+  801306:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801309:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80130a:	48 89 c7             	mov    %rax,%rdi
+  80130d:	fc                   	cld
+  80130e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801310:	c3                   	ret
+
+0000000000801311 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801311:	55                   	push   %rbp
+  801312:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801315:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  80131c:	00 00 00 
+  80131f:	ff d0                	call   *%rax
+}
+  801321:	5d                   	pop    %rbp
+  801322:	c3                   	ret
+
+0000000000801323 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801323:	55                   	push   %rbp
+  801324:	48 89 e5             	mov    %rsp,%rbp
+  801327:	41 57                	push   %r15
+  801329:	41 56                	push   %r14
+  80132b:	41 55                	push   %r13
+  80132d:	41 54                	push   %r12
+  80132f:	53                   	push   %rbx
+  801330:	48 83 ec 08          	sub    $0x8,%rsp
+  801334:	49 89 fe             	mov    %rdi,%r14
+  801337:	49 89 f7             	mov    %rsi,%r15
+  80133a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80133d:	48 89 f7             	mov    %rsi,%rdi
+  801340:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  801347:	00 00 00 
+  80134a:	ff d0                	call   *%rax
+  80134c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80134f:	48 89 de             	mov    %rbx,%rsi
+  801352:	4c 89 f7             	mov    %r14,%rdi
+  801355:	48 b8 8d 10 80 00 00 	movabs $0x80108d,%rax
+  80135c:	00 00 00 
+  80135f:	ff d0                	call   *%rax
+  801361:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801364:	48 39 c3             	cmp    %rax,%rbx
+  801367:	74 36                	je     80139f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801369:	48 89 d8             	mov    %rbx,%rax
+  80136c:	4c 29 e8             	sub    %r13,%rax
+  80136f:	49 39 c4             	cmp    %rax,%r12
+  801372:	73 31                	jae    8013a5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801374:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801379:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80137d:	4c 89 fe             	mov    %r15,%rsi
+  801380:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  801387:	00 00 00 
+  80138a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80138c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801390:	48 83 c4 08          	add    $0x8,%rsp
+  801394:	5b                   	pop    %rbx
+  801395:	41 5c                	pop    %r12
+  801397:	41 5d                	pop    %r13
+  801399:	41 5e                	pop    %r14
+  80139b:	41 5f                	pop    %r15
+  80139d:	5d                   	pop    %rbp
+  80139e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  80139f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8013a3:	eb eb                	jmp    801390 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8013a5:	48 83 eb 01          	sub    $0x1,%rbx
+  8013a9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8013ad:	48 89 da             	mov    %rbx,%rdx
+  8013b0:	4c 89 fe             	mov    %r15,%rsi
+  8013b3:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  8013ba:	00 00 00 
+  8013bd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8013bf:	49 01 de             	add    %rbx,%r14
+  8013c2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8013c7:	eb c3                	jmp    80138c <strlcat+0x69>
+
+00000000008013c9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8013c9:	48 85 d2             	test   %rdx,%rdx
+  8013cc:	74 2d                	je     8013fb <memcmp+0x32>
+  8013ce:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8013d3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8013d7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8013dc:	44 38 c1             	cmp    %r8b,%cl
+  8013df:	75 0f                	jne    8013f0 <memcmp+0x27>
+    while (n-- > 0) {
+  8013e1:	48 83 c0 01          	add    $0x1,%rax
+  8013e5:	48 39 c2             	cmp    %rax,%rdx
+  8013e8:	75 e9                	jne    8013d3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ef:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8013f0:	0f b6 c1             	movzbl %cl,%eax
+  8013f3:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8013f7:	44 29 c0             	sub    %r8d,%eax
+  8013fa:	c3                   	ret
+    return 0;
+  8013fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801400:	c3                   	ret
+
+0000000000801401 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801401:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801405:	48 39 c7             	cmp    %rax,%rdi
+  801408:	73 0f                	jae    801419 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80140a:	40 38 37             	cmp    %sil,(%rdi)
+  80140d:	74 0e                	je     80141d <memfind+0x1c>
+    for (; src < end; src++) {
+  80140f:	48 83 c7 01          	add    $0x1,%rdi
+  801413:	48 39 f8             	cmp    %rdi,%rax
+  801416:	75 f2                	jne    80140a <memfind+0x9>
+  801418:	c3                   	ret
+  801419:	48 89 f8             	mov    %rdi,%rax
+  80141c:	c3                   	ret
+  80141d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801420:	c3                   	ret
+
+0000000000801421 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801421:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801424:	0f b6 37             	movzbl (%rdi),%esi
+  801427:	40 80 fe 20          	cmp    $0x20,%sil
+  80142b:	74 06                	je     801433 <strtol+0x12>
+  80142d:	40 80 fe 09          	cmp    $0x9,%sil
+  801431:	75 13                	jne    801446 <strtol+0x25>
+  801433:	48 83 c7 01          	add    $0x1,%rdi
+  801437:	0f b6 37             	movzbl (%rdi),%esi
+  80143a:	40 80 fe 20          	cmp    $0x20,%sil
+  80143e:	74 f3                	je     801433 <strtol+0x12>
+  801440:	40 80 fe 09          	cmp    $0x9,%sil
+  801444:	74 ed                	je     801433 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801446:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801449:	83 e0 fd             	and    $0xfffffffd,%eax
+  80144c:	3c 01                	cmp    $0x1,%al
+  80144e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801452:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801458:	75 0f                	jne    801469 <strtol+0x48>
+  80145a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80145d:	74 14                	je     801473 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80145f:	85 d2                	test   %edx,%edx
+  801461:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801466:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801469:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80146e:	4c 63 ca             	movslq %edx,%r9
+  801471:	eb 36                	jmp    8014a9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801473:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801477:	74 0f                	je     801488 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801479:	85 d2                	test   %edx,%edx
+  80147b:	75 ec                	jne    801469 <strtol+0x48>
+        s++;
+  80147d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801481:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801486:	eb e1                	jmp    801469 <strtol+0x48>
+        s += 2;
+  801488:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80148c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801491:	eb d6                	jmp    801469 <strtol+0x48>
+            dig -= '0';
+  801493:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801496:	44 0f b6 c1          	movzbl %cl,%r8d
+  80149a:	41 39 d0             	cmp    %edx,%r8d
+  80149d:	7d 21                	jge    8014c0 <strtol+0x9f>
+        val = val * base + dig;
+  80149f:	49 0f af c1          	imul   %r9,%rax
+  8014a3:	0f b6 c9             	movzbl %cl,%ecx
+  8014a6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8014a9:	48 83 c7 01          	add    $0x1,%rdi
+  8014ad:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8014b1:	80 f9 39             	cmp    $0x39,%cl
+  8014b4:	76 dd                	jbe    801493 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8014b6:	80 f9 7b             	cmp    $0x7b,%cl
+  8014b9:	77 05                	ja     8014c0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8014bb:	83 e9 57             	sub    $0x57,%ecx
+  8014be:	eb d6                	jmp    801496 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8014c0:	4d 85 d2             	test   %r10,%r10
+  8014c3:	74 03                	je     8014c8 <strtol+0xa7>
+  8014c5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8014c8:	48 89 c2             	mov    %rax,%rdx
+  8014cb:	48 f7 da             	neg    %rdx
+  8014ce:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8014d2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8014d6:	c3                   	ret
+
+00000000008014d7 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8014d7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8014f3:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8014f5:	c3                   	ret
+
+00000000008014f6 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014f6:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801500:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801510:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801516:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80151c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80151e:	c3                   	ret
+
+000000000080151f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80151f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801522:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801527:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80152c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801531:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801537:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801543:	0f 05                	syscall
+    if (check && ret > 0) {
+  801545:	48 85 c0             	test   %rax,%rax
+  801548:	7f 01                	jg     80154b <sys_env_destroy+0x2c>
+}
+  80154a:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80154b:	55                   	push   %rbp
+  80154c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154f:	49 89 c0             	mov    %rax,%r8
+  801552:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801557:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  80155e:	00 00 00 
+  801561:	be 29 00 00 00       	mov    $0x29,%esi
+  801566:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  80156d:	00 00 00 
+  801570:	b8 00 00 00 00       	mov    $0x0,%eax
+  801575:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  80157c:	00 00 00 
+  80157f:	41 ff d1             	call   *%r9
+
+0000000000801582 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801582:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801587:	bf 00 00 00 00       	mov    $0x0,%edi
+  80158c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801591:	ba 00 00 00 00       	mov    $0x0,%edx
+  801596:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a8:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015aa:	c3                   	ret
+
+00000000008015ab <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015ab:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015bf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015cb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d1:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015d3:	c3                   	ret
+
+00000000008015d4 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015d4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015d9:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8015e0:	00 00 00 
+  8015e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015f5:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8015f7:	c3                   	ret
+
+00000000008015f8 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8015f8:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8015fb:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801600:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801606:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80160c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80160e:	c3                   	ret
+
+000000000080160f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80160f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801612:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801617:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80161a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801620:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801626:	0f 05                	syscall
+    if (check && ret > 0) {
+  801628:	48 85 c0             	test   %rax,%rax
+  80162b:	7f 01                	jg     80162e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80162d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80162e:	55                   	push   %rbp
+  80162f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801632:	49 89 c0             	mov    %rax,%r8
+  801635:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80163a:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801641:	00 00 00 
+  801644:	be 29 00 00 00       	mov    $0x29,%esi
+  801649:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  801650:	00 00 00 
+  801653:	b8 00 00 00 00       	mov    $0x0,%eax
+  801658:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  80165f:	00 00 00 
+  801662:	41 ff d1             	call   *%r9
+
+0000000000801665 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801665:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801668:	48 63 d2             	movslq %edx,%rdx
+  80166b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80166e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801673:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801676:	0f 05                	syscall
+    if (check && ret > 0) {
+  801678:	48 85 c0             	test   %rax,%rax
+  80167b:	7f 01                	jg     80167e <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80167d:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80167e:	55                   	push   %rbp
+  80167f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801682:	49 89 c0             	mov    %rax,%r8
+  801685:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80168a:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801691:	00 00 00 
+  801694:	be 29 00 00 00       	mov    $0x29,%esi
+  801699:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  8016a0:	00 00 00 
+  8016a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016a8:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  8016af:	00 00 00 
+  8016b2:	41 ff d1             	call   *%r9
+
+00000000008016b5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8016b5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016b8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016bd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016c3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016c9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016cf:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016d1:	48 85 c0             	test   %rax,%rax
+  8016d4:	7f 01                	jg     8016d7 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8016d6:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8016d7:	55                   	push   %rbp
+  8016d8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016db:	49 89 c0             	mov    %rax,%r8
+  8016de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8016e3:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  8016ea:	00 00 00 
+  8016ed:	be 29 00 00 00       	mov    $0x29,%esi
+  8016f2:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  8016f9:	00 00 00 
+  8016fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801701:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  801708:	00 00 00 
+  80170b:	41 ff d1             	call   *%r9
+
+000000000080170e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80170e:	48 63 f6             	movslq %esi,%rsi
+  801711:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801714:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801719:	ba 00 00 00 00       	mov    $0x0,%edx
+  80171e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801724:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80172a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801730:	0f 05                	syscall
+    if (check && ret > 0) {
+  801732:	48 85 c0             	test   %rax,%rax
+  801735:	7f 01                	jg     801738 <sys_env_set_status+0x2a>
+}
+  801737:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801738:	55                   	push   %rbp
+  801739:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80173c:	49 89 c0             	mov    %rax,%r8
+  80173f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801744:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  80174b:	00 00 00 
+  80174e:	be 29 00 00 00       	mov    $0x29,%esi
+  801753:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  80175a:	00 00 00 
+  80175d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801762:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  801769:	00 00 00 
+  80176c:	41 ff d1             	call   *%r9
+
+000000000080176f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80176f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801772:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801777:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80178e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801790:	48 85 c0             	test   %rax,%rax
+  801793:	7f 01                	jg     801796 <sys_env_set_trapframe+0x27>
+}
+  801795:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179a:	49 89 c0             	mov    %rax,%r8
+  80179d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8017a2:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  8017a9:	00 00 00 
+  8017ac:	be 29 00 00 00       	mov    $0x29,%esi
+  8017b1:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  8017b8:	00 00 00 
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  8017c7:	00 00 00 
+  8017ca:	41 ff d1             	call   *%r9
+
+00000000008017cd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8017cd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ec:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017ee:	48 85 c0             	test   %rax,%rax
+  8017f1:	7f 01                	jg     8017f4 <sys_env_set_pgfault_upcall+0x27>
+}
+  8017f3:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8017f4:	55                   	push   %rbp
+  8017f5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f8:	49 89 c0             	mov    %rax,%r8
+  8017fb:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801800:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801807:	00 00 00 
+  80180a:	be 29 00 00 00       	mov    $0x29,%esi
+  80180f:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  801816:	00 00 00 
+  801819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181e:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  801825:	00 00 00 
+  801828:	41 ff d1             	call   *%r9
+
+000000000080182b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80182b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80182e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801831:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801836:	4d 63 c0             	movslq %r8d,%r8
+  801839:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80183f:	0f 05                	syscall
+}
+  801841:	c3                   	ret
+
+0000000000801842 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801842:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801845:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801848:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80184d:	4d 63 c0             	movslq %r8d,%r8
+  801850:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801856:	0f 05                	syscall
+}
+  801858:	c3                   	ret
+
+0000000000801859 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801859:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80185e:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801861:	45 89 c0             	mov    %r8d,%r8d
+  801864:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80186a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80186c:	48 85 c0             	test   %rax,%rax
+  80186f:	7f 01                	jg     801872 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801871:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801872:	55                   	push   %rbp
+  801873:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801876:	49 89 c0             	mov    %rax,%r8
+  801879:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80187e:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801885:	00 00 00 
+  801888:	be 29 00 00 00       	mov    $0x29,%esi
+  80188d:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  801894:	00 00 00 
+  801897:	b8 00 00 00 00       	mov    $0x0,%eax
+  80189c:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  8018a3:	00 00 00 
+  8018a6:	41 ff d1             	call   *%r9
+
+00000000008018a9 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8018a9:	55                   	push   %rbp
+  8018aa:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8018ad:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8018b8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018bd:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  8018c4:	00 00 00 
+  8018c7:	ff d0                	call   *%rax
+}
+  8018c9:	5d                   	pop    %rbp
+  8018ca:	c3                   	ret
+
+00000000008018cb <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8018cb:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8018d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018f1:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8018f3:	c3                   	ret
+
+00000000008018f4 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8018f4:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8018f9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018fe:	ba 00 00 00 00       	mov    $0x0,%edx
+  801903:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801909:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80190f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801915:	0f 05                	syscall
+    if (check && ret > 0) {
+  801917:	48 85 c0             	test   %rax,%rax
+  80191a:	7f 01                	jg     80191d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80191c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80191d:	55                   	push   %rbp
+  80191e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801921:	49 89 c0             	mov    %rax,%r8
+  801924:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801929:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801930:	00 00 00 
+  801933:	be 29 00 00 00       	mov    $0x29,%esi
+  801938:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  80193f:	00 00 00 
+  801942:	b8 00 00 00 00       	mov    $0x0,%eax
+  801947:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  80194e:	00 00 00 
+  801951:	41 ff d1             	call   *%r9
+
+0000000000801954 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801954:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801959:	bf 00 00 00 00       	mov    $0x0,%edi
+  80195e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801963:	ba 00 00 00 00       	mov    $0x0,%edx
+  801968:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80196e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801974:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80197a:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80197c:	c3                   	ret
+
+000000000080197d <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80197d:	89 d2                	mov    %edx,%edx
+  80197f:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801981:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801986:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80198c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801992:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801998:	0f 05                	syscall
+}
+  80199a:	c3                   	ret
+
+000000000080199b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80199b:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80199e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019a3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019a8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019ae:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019ba:	0f 05                	syscall
+}
+  8019bc:	c3                   	ret
+
+00000000008019bd <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8019bd:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8019c0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ca:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019d0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019d6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019dc:	0f 05                	syscall
+}
+  8019de:	c3                   	ret
+
+00000000008019df <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8019df:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019e2:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8019e7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a03:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a05:	48 85 c0             	test   %rax,%rax
+  801a08:	7f 01                	jg     801a0b <sys_irq_ack+0x2c>
+}
+  801a0a:	c3                   	ret
+sys_irq_ack(int irq) {
+  801a0b:	55                   	push   %rbp
+  801a0c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a0f:	49 89 c0             	mov    %rax,%r8
+  801a12:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801a17:	48 ba b8 5c 80 00 00 	movabs $0x805cb8,%rdx
+  801a1e:	00 00 00 
+  801a21:	be 29 00 00 00       	mov    $0x29,%esi
+  801a26:	48 bf d7 5c 80 00 00 	movabs $0x805cd7,%rdi
+  801a2d:	00 00 00 
+  801a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a35:	49 b9 3b 06 80 00 00 	movabs $0x80063b,%r9
+  801a3c:	00 00 00 
+  801a3f:	41 ff d1             	call   *%r9
+
+0000000000801a42 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a42:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a49:	ff ff ff 
+  801a4c:	48 01 f8             	add    %rdi,%rax
+  801a4f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a53:	c3                   	ret
+
+0000000000801a54 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a54:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a5b:	ff ff ff 
+  801a5e:	48 01 f8             	add    %rdi,%rax
+  801a61:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a65:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a6b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a6f:	c3                   	ret
+
+0000000000801a70 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a70:	55                   	push   %rbp
+  801a71:	48 89 e5             	mov    %rsp,%rbp
+  801a74:	41 57                	push   %r15
+  801a76:	41 56                	push   %r14
+  801a78:	41 55                	push   %r13
+  801a7a:	41 54                	push   %r12
+  801a7c:	53                   	push   %rbx
+  801a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  801a81:	49 89 ff             	mov    %rdi,%r15
+  801a84:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a89:	49 bd b8 4b 80 00 00 	movabs $0x804bb8,%r13
+  801a90:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a93:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a99:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a9c:	48 89 df             	mov    %rbx,%rdi
+  801a9f:	41 ff d5             	call   *%r13
+  801aa2:	83 e0 04             	and    $0x4,%eax
+  801aa5:	74 17                	je     801abe <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801aa7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aae:	4c 39 f3             	cmp    %r14,%rbx
+  801ab1:	75 e6                	jne    801a99 <fd_alloc+0x29>
+  801ab3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801ab9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801abe:	4d 89 27             	mov    %r12,(%r15)
+}
+  801ac1:	48 83 c4 08          	add    $0x8,%rsp
+  801ac5:	5b                   	pop    %rbx
+  801ac6:	41 5c                	pop    %r12
+  801ac8:	41 5d                	pop    %r13
+  801aca:	41 5e                	pop    %r14
+  801acc:	41 5f                	pop    %r15
+  801ace:	5d                   	pop    %rbp
+  801acf:	c3                   	ret
+
+0000000000801ad0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801ad0:	83 ff 1f             	cmp    $0x1f,%edi
+  801ad3:	77 39                	ja     801b0e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ad5:	55                   	push   %rbp
+  801ad6:	48 89 e5             	mov    %rsp,%rbp
+  801ad9:	41 54                	push   %r12
+  801adb:	53                   	push   %rbx
+  801adc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801adf:	48 63 df             	movslq %edi,%rbx
+  801ae2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ae9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801aed:	48 89 df             	mov    %rbx,%rdi
+  801af0:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  801af7:	00 00 00 
+  801afa:	ff d0                	call   *%rax
+  801afc:	a8 04                	test   $0x4,%al
+  801afe:	74 14                	je     801b14 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b00:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b04:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b09:	5b                   	pop    %rbx
+  801b0a:	41 5c                	pop    %r12
+  801b0c:	5d                   	pop    %rbp
+  801b0d:	c3                   	ret
+        return -E_INVAL;
+  801b0e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b13:	c3                   	ret
+        return -E_INVAL;
+  801b14:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b19:	eb ee                	jmp    801b09 <fd_lookup+0x39>
+
+0000000000801b1b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b1b:	55                   	push   %rbp
+  801b1c:	48 89 e5             	mov    %rsp,%rbp
+  801b1f:	41 54                	push   %r12
+  801b21:	53                   	push   %rbx
+  801b22:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b25:	48 b8 80 5d 80 00 00 	movabs $0x805d80,%rax
+  801b2c:	00 00 00 
+  801b2f:	48 bb e0 77 80 00 00 	movabs $0x8077e0,%rbx
+  801b36:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b39:	39 3b                	cmp    %edi,(%rbx)
+  801b3b:	74 47                	je     801b84 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b3d:	48 83 c0 08          	add    $0x8,%rax
+  801b41:	48 8b 18             	mov    (%rax),%rbx
+  801b44:	48 85 db             	test   %rbx,%rbx
+  801b47:	75 f0                	jne    801b39 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b49:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  801b50:	00 00 00 
+  801b53:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b59:	89 fa                	mov    %edi,%edx
+  801b5b:	48 bf e8 5c 80 00 00 	movabs $0x805ce8,%rdi
+  801b62:	00 00 00 
+  801b65:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b6a:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  801b71:	00 00 00 
+  801b74:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b7b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b7f:	5b                   	pop    %rbx
+  801b80:	41 5c                	pop    %r12
+  801b82:	5d                   	pop    %rbp
+  801b83:	c3                   	ret
+            return 0;
+  801b84:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b89:	eb f0                	jmp    801b7b <dev_lookup+0x60>
+
+0000000000801b8b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b8b:	55                   	push   %rbp
+  801b8c:	48 89 e5             	mov    %rsp,%rbp
+  801b8f:	41 55                	push   %r13
+  801b91:	41 54                	push   %r12
+  801b93:	53                   	push   %rbx
+  801b94:	48 83 ec 18          	sub    $0x18,%rsp
+  801b98:	48 89 fb             	mov    %rdi,%rbx
+  801b9b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b9e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ba5:	ff ff ff 
+  801ba8:	48 01 df             	add    %rbx,%rdi
+  801bab:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801baf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bb3:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801bba:	00 00 00 
+  801bbd:	ff d0                	call   *%rax
+  801bbf:	41 89 c5             	mov    %eax,%r13d
+  801bc2:	85 c0                	test   %eax,%eax
+  801bc4:	78 06                	js     801bcc <fd_close+0x41>
+  801bc6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801bca:	74 1a                	je     801be6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801bcc:	45 84 e4             	test   %r12b,%r12b
+  801bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bd8:	44 89 e8             	mov    %r13d,%eax
+  801bdb:	48 83 c4 18          	add    $0x18,%rsp
+  801bdf:	5b                   	pop    %rbx
+  801be0:	41 5c                	pop    %r12
+  801be2:	41 5d                	pop    %r13
+  801be4:	5d                   	pop    %rbp
+  801be5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801be6:	8b 3b                	mov    (%rbx),%edi
+  801be8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bec:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801bf3:	00 00 00 
+  801bf6:	ff d0                	call   *%rax
+  801bf8:	41 89 c5             	mov    %eax,%r13d
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 1b                	js     801c1a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bff:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c03:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c07:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c0d:	48 85 c0             	test   %rax,%rax
+  801c10:	74 08                	je     801c1a <fd_close+0x8f>
+  801c12:	48 89 df             	mov    %rbx,%rdi
+  801c15:	ff d0                	call   *%rax
+  801c17:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c1a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c1f:	48 89 de             	mov    %rbx,%rsi
+  801c22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c27:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  801c2e:	00 00 00 
+  801c31:	ff d0                	call   *%rax
+    return res;
+  801c33:	eb a3                	jmp    801bd8 <fd_close+0x4d>
+
+0000000000801c35 <close>:
+
+int
+close(int fdnum) {
+  801c35:	55                   	push   %rbp
+  801c36:	48 89 e5             	mov    %rsp,%rbp
+  801c39:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c3d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c41:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801c48:	00 00 00 
+  801c4b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c4d:	85 c0                	test   %eax,%eax
+  801c4f:	78 15                	js     801c66 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c51:	be 01 00 00 00       	mov    $0x1,%esi
+  801c56:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c5a:	48 b8 8b 1b 80 00 00 	movabs $0x801b8b,%rax
+  801c61:	00 00 00 
+  801c64:	ff d0                	call   *%rax
+}
+  801c66:	c9                   	leave
+  801c67:	c3                   	ret
+
+0000000000801c68 <close_all>:
+
+void
+close_all(void) {
+  801c68:	55                   	push   %rbp
+  801c69:	48 89 e5             	mov    %rsp,%rbp
+  801c6c:	41 54                	push   %r12
+  801c6e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c6f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c74:	49 bc 35 1c 80 00 00 	movabs $0x801c35,%r12
+  801c7b:	00 00 00 
+  801c7e:	89 df                	mov    %ebx,%edi
+  801c80:	41 ff d4             	call   *%r12
+  801c83:	83 c3 01             	add    $0x1,%ebx
+  801c86:	83 fb 20             	cmp    $0x20,%ebx
+  801c89:	75 f3                	jne    801c7e <close_all+0x16>
+}
+  801c8b:	5b                   	pop    %rbx
+  801c8c:	41 5c                	pop    %r12
+  801c8e:	5d                   	pop    %rbp
+  801c8f:	c3                   	ret
+
+0000000000801c90 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c90:	55                   	push   %rbp
+  801c91:	48 89 e5             	mov    %rsp,%rbp
+  801c94:	41 57                	push   %r15
+  801c96:	41 56                	push   %r14
+  801c98:	41 55                	push   %r13
+  801c9a:	41 54                	push   %r12
+  801c9c:	53                   	push   %rbx
+  801c9d:	48 83 ec 18          	sub    $0x18,%rsp
+  801ca1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ca4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ca8:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801caf:	00 00 00 
+  801cb2:	ff d0                	call   *%rax
+  801cb4:	89 c3                	mov    %eax,%ebx
+  801cb6:	85 c0                	test   %eax,%eax
+  801cb8:	0f 88 b8 00 00 00    	js     801d76 <dup+0xe6>
+    close(newfdnum);
+  801cbe:	44 89 e7             	mov    %r12d,%edi
+  801cc1:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  801cc8:	00 00 00 
+  801ccb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ccd:	4d 63 ec             	movslq %r12d,%r13
+  801cd0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cd7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cdb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cdf:	4c 89 ff             	mov    %r15,%rdi
+  801ce2:	49 be 54 1a 80 00 00 	movabs $0x801a54,%r14
+  801ce9:	00 00 00 
+  801cec:	41 ff d6             	call   *%r14
+  801cef:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801cf2:	4c 89 ef             	mov    %r13,%rdi
+  801cf5:	41 ff d6             	call   *%r14
+  801cf8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cfb:	48 89 df             	mov    %rbx,%rdi
+  801cfe:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d0a:	a8 04                	test   $0x4,%al
+  801d0c:	74 2b                	je     801d39 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d0e:	41 89 c1             	mov    %eax,%r9d
+  801d11:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d17:	4c 89 f1             	mov    %r14,%rcx
+  801d1a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d1f:	48 89 de             	mov    %rbx,%rsi
+  801d22:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d27:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  801d2e:	00 00 00 
+  801d31:	ff d0                	call   *%rax
+  801d33:	89 c3                	mov    %eax,%ebx
+  801d35:	85 c0                	test   %eax,%eax
+  801d37:	78 4e                	js     801d87 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d39:	4c 89 ff             	mov    %r15,%rdi
+  801d3c:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d4b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d51:	4c 89 e9             	mov    %r13,%rcx
+  801d54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d59:	4c 89 fe             	mov    %r15,%rsi
+  801d5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d61:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  801d68:	00 00 00 
+  801d6b:	ff d0                	call   *%rax
+  801d6d:	89 c3                	mov    %eax,%ebx
+  801d6f:	85 c0                	test   %eax,%eax
+  801d71:	78 14                	js     801d87 <dup+0xf7>
+
+    return newfdnum;
+  801d73:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d76:	89 d8                	mov    %ebx,%eax
+  801d78:	48 83 c4 18          	add    $0x18,%rsp
+  801d7c:	5b                   	pop    %rbx
+  801d7d:	41 5c                	pop    %r12
+  801d7f:	41 5d                	pop    %r13
+  801d81:	41 5e                	pop    %r14
+  801d83:	41 5f                	pop    %r15
+  801d85:	5d                   	pop    %rbp
+  801d86:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d8c:	4c 89 ee             	mov    %r13,%rsi
+  801d8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d94:	49 bc b5 16 80 00 00 	movabs $0x8016b5,%r12
+  801d9b:	00 00 00 
+  801d9e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801da1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801da6:	4c 89 f6             	mov    %r14,%rsi
+  801da9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dae:	41 ff d4             	call   *%r12
+    return res;
+  801db1:	eb c3                	jmp    801d76 <dup+0xe6>
+
+0000000000801db3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801db3:	55                   	push   %rbp
+  801db4:	48 89 e5             	mov    %rsp,%rbp
+  801db7:	41 56                	push   %r14
+  801db9:	41 55                	push   %r13
+  801dbb:	41 54                	push   %r12
+  801dbd:	53                   	push   %rbx
+  801dbe:	48 83 ec 10          	sub    $0x10,%rsp
+  801dc2:	89 fb                	mov    %edi,%ebx
+  801dc4:	49 89 f4             	mov    %rsi,%r12
+  801dc7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dca:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dce:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801dd5:	00 00 00 
+  801dd8:	ff d0                	call   *%rax
+  801dda:	85 c0                	test   %eax,%eax
+  801ddc:	78 4c                	js     801e2a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dde:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801de2:	41 8b 3e             	mov    (%r14),%edi
+  801de5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801de9:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	78 35                	js     801e2e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801df9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dfd:	83 e0 03             	and    $0x3,%eax
+  801e00:	83 f8 01             	cmp    $0x1,%eax
+  801e03:	74 2d                	je     801e32 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e05:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e09:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e0d:	48 85 c0             	test   %rax,%rax
+  801e10:	74 56                	je     801e68 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e12:	4c 89 ea             	mov    %r13,%rdx
+  801e15:	4c 89 e6             	mov    %r12,%rsi
+  801e18:	4c 89 f7             	mov    %r14,%rdi
+  801e1b:	ff d0                	call   *%rax
+}
+  801e1d:	48 83 c4 10          	add    $0x10,%rsp
+  801e21:	5b                   	pop    %rbx
+  801e22:	41 5c                	pop    %r12
+  801e24:	41 5d                	pop    %r13
+  801e26:	41 5e                	pop    %r14
+  801e28:	5d                   	pop    %rbp
+  801e29:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2a:	48 98                	cltq
+  801e2c:	eb ef                	jmp    801e1d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e2e:	48 98                	cltq
+  801e30:	eb eb                	jmp    801e1d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e32:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  801e39:	00 00 00 
+  801e3c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e42:	89 da                	mov    %ebx,%edx
+  801e44:	48 bf 29 5d 80 00 00 	movabs $0x805d29,%rdi
+  801e4b:	00 00 00 
+  801e4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e53:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  801e5a:	00 00 00 
+  801e5d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e5f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e66:	eb b5                	jmp    801e1d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e68:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e6f:	eb ac                	jmp    801e1d <read+0x6a>
+
+0000000000801e71 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e71:	55                   	push   %rbp
+  801e72:	48 89 e5             	mov    %rsp,%rbp
+  801e75:	41 57                	push   %r15
+  801e77:	41 56                	push   %r14
+  801e79:	41 55                	push   %r13
+  801e7b:	41 54                	push   %r12
+  801e7d:	53                   	push   %rbx
+  801e7e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e82:	48 85 d2             	test   %rdx,%rdx
+  801e85:	74 54                	je     801edb <readn+0x6a>
+  801e87:	41 89 fd             	mov    %edi,%r13d
+  801e8a:	49 89 f6             	mov    %rsi,%r14
+  801e8d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e90:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e95:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e9a:	49 bf b3 1d 80 00 00 	movabs $0x801db3,%r15
+  801ea1:	00 00 00 
+  801ea4:	4c 89 e2             	mov    %r12,%rdx
+  801ea7:	48 29 f2             	sub    %rsi,%rdx
+  801eaa:	4c 01 f6             	add    %r14,%rsi
+  801ead:	44 89 ef             	mov    %r13d,%edi
+  801eb0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801eb3:	85 c0                	test   %eax,%eax
+  801eb5:	78 20                	js     801ed7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801eb7:	01 c3                	add    %eax,%ebx
+  801eb9:	85 c0                	test   %eax,%eax
+  801ebb:	74 08                	je     801ec5 <readn+0x54>
+  801ebd:	48 63 f3             	movslq %ebx,%rsi
+  801ec0:	4c 39 e6             	cmp    %r12,%rsi
+  801ec3:	72 df                	jb     801ea4 <readn+0x33>
+    }
+    return res;
+  801ec5:	48 63 c3             	movslq %ebx,%rax
+}
+  801ec8:	48 83 c4 08          	add    $0x8,%rsp
+  801ecc:	5b                   	pop    %rbx
+  801ecd:	41 5c                	pop    %r12
+  801ecf:	41 5d                	pop    %r13
+  801ed1:	41 5e                	pop    %r14
+  801ed3:	41 5f                	pop    %r15
+  801ed5:	5d                   	pop    %rbp
+  801ed6:	c3                   	ret
+        if (inc < 0) return inc;
+  801ed7:	48 98                	cltq
+  801ed9:	eb ed                	jmp    801ec8 <readn+0x57>
+    int inc = 1, res = 0;
+  801edb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ee0:	eb e3                	jmp    801ec5 <readn+0x54>
+
+0000000000801ee2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ee2:	55                   	push   %rbp
+  801ee3:	48 89 e5             	mov    %rsp,%rbp
+  801ee6:	41 56                	push   %r14
+  801ee8:	41 55                	push   %r13
+  801eea:	41 54                	push   %r12
+  801eec:	53                   	push   %rbx
+  801eed:	48 83 ec 10          	sub    $0x10,%rsp
+  801ef1:	89 fb                	mov    %edi,%ebx
+  801ef3:	49 89 f4             	mov    %rsi,%r12
+  801ef6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ef9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801efd:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801f04:	00 00 00 
+  801f07:	ff d0                	call   *%rax
+  801f09:	85 c0                	test   %eax,%eax
+  801f0b:	78 47                	js     801f54 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f0d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f11:	41 8b 3e             	mov    (%r14),%edi
+  801f14:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f18:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801f1f:	00 00 00 
+  801f22:	ff d0                	call   *%rax
+  801f24:	85 c0                	test   %eax,%eax
+  801f26:	78 30                	js     801f58 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f28:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f2d:	74 2d                	je     801f5c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f33:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f37:	48 85 c0             	test   %rax,%rax
+  801f3a:	74 56                	je     801f92 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f3c:	4c 89 ea             	mov    %r13,%rdx
+  801f3f:	4c 89 e6             	mov    %r12,%rsi
+  801f42:	4c 89 f7             	mov    %r14,%rdi
+  801f45:	ff d0                	call   *%rax
+}
+  801f47:	48 83 c4 10          	add    $0x10,%rsp
+  801f4b:	5b                   	pop    %rbx
+  801f4c:	41 5c                	pop    %r12
+  801f4e:	41 5d                	pop    %r13
+  801f50:	41 5e                	pop    %r14
+  801f52:	5d                   	pop    %rbp
+  801f53:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f54:	48 98                	cltq
+  801f56:	eb ef                	jmp    801f47 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f58:	48 98                	cltq
+  801f5a:	eb eb                	jmp    801f47 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f5c:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  801f63:	00 00 00 
+  801f66:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f6c:	89 da                	mov    %ebx,%edx
+  801f6e:	48 bf 45 5d 80 00 00 	movabs $0x805d45,%rdi
+  801f75:	00 00 00 
+  801f78:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f7d:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  801f84:	00 00 00 
+  801f87:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f89:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f90:	eb b5                	jmp    801f47 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f92:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f99:	eb ac                	jmp    801f47 <write+0x65>
+
+0000000000801f9b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f9b:	55                   	push   %rbp
+  801f9c:	48 89 e5             	mov    %rsp,%rbp
+  801f9f:	41 54                	push   %r12
+  801fa1:	53                   	push   %rbx
+  801fa2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fa6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fac:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  801fb3:	00 00 00 
+  801fb6:	ff d0                	call   *%rax
+  801fb8:	85 c0                	test   %eax,%eax
+  801fba:	78 3e                	js     801ffa <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fbc:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fc0:	41 8b 3c 24          	mov    (%r12),%edi
+  801fc4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fc8:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  801fcf:	00 00 00 
+  801fd2:	ff d0                	call   *%rax
+  801fd4:	85 c0                	test   %eax,%eax
+  801fd6:	78 22                	js     801ffa <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801fd8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fdc:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801fe0:	48 85 c0             	test   %rax,%rax
+  801fe3:	74 0b                	je     801ff0 <seek+0x55>
+  801fe5:	89 de                	mov    %ebx,%esi
+  801fe7:	4c 89 e7             	mov    %r12,%rdi
+  801fea:	ff d0                	call   *%rax
+  801fec:	85 c0                	test   %eax,%eax
+  801fee:	78 0a                	js     801ffa <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801ff0:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801ff5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ffa:	48 83 c4 10          	add    $0x10,%rsp
+  801ffe:	5b                   	pop    %rbx
+  801fff:	41 5c                	pop    %r12
+  802001:	5d                   	pop    %rbp
+  802002:	c3                   	ret
+
+0000000000802003 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802003:	55                   	push   %rbp
+  802004:	48 89 e5             	mov    %rsp,%rbp
+  802007:	41 55                	push   %r13
+  802009:	41 54                	push   %r12
+  80200b:	53                   	push   %rbx
+  80200c:	48 83 ec 18          	sub    $0x18,%rsp
+  802010:	89 fb                	mov    %edi,%ebx
+  802012:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802015:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802019:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  802020:	00 00 00 
+  802023:	ff d0                	call   *%rax
+  802025:	85 c0                	test   %eax,%eax
+  802027:	78 38                	js     802061 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802029:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80202d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802031:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802035:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  80203c:	00 00 00 
+  80203f:	ff d0                	call   *%rax
+  802041:	85 c0                	test   %eax,%eax
+  802043:	78 1c                	js     802061 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802045:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80204a:	74 20                	je     80206c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80204c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802050:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802054:	48 85 c0             	test   %rax,%rax
+  802057:	74 47                	je     8020a0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802059:	44 89 e6             	mov    %r12d,%esi
+  80205c:	4c 89 ef             	mov    %r13,%rdi
+  80205f:	ff d0                	call   *%rax
+}
+  802061:	48 83 c4 18          	add    $0x18,%rsp
+  802065:	5b                   	pop    %rbx
+  802066:	41 5c                	pop    %r12
+  802068:	41 5d                	pop    %r13
+  80206a:	5d                   	pop    %rbp
+  80206b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  80206c:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  802073:	00 00 00 
+  802076:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  80207c:	89 da                	mov    %ebx,%edx
+  80207e:	48 bf 08 5d 80 00 00 	movabs $0x805d08,%rdi
+  802085:	00 00 00 
+  802088:	b8 00 00 00 00       	mov    $0x0,%eax
+  80208d:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  802094:	00 00 00 
+  802097:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802099:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80209e:	eb c1                	jmp    802061 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020a0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020a5:	eb ba                	jmp    802061 <ftruncate+0x5e>
+
+00000000008020a7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020a7:	55                   	push   %rbp
+  8020a8:	48 89 e5             	mov    %rsp,%rbp
+  8020ab:	41 54                	push   %r12
+  8020ad:	53                   	push   %rbx
+  8020ae:	48 83 ec 10          	sub    $0x10,%rsp
+  8020b2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020b5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020b9:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  8020c0:	00 00 00 
+  8020c3:	ff d0                	call   *%rax
+  8020c5:	85 c0                	test   %eax,%eax
+  8020c7:	78 4e                	js     802117 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020c9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020cd:	41 8b 3c 24          	mov    (%r12),%edi
+  8020d1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020d5:	48 b8 1b 1b 80 00 00 	movabs $0x801b1b,%rax
+  8020dc:	00 00 00 
+  8020df:	ff d0                	call   *%rax
+  8020e1:	85 c0                	test   %eax,%eax
+  8020e3:	78 32                	js     802117 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020e5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020e9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020ee:	74 30                	je     802120 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020f0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020f3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020fa:	00 00 00 
+    stat->st_isdir = 0;
+  8020fd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802104:	00 00 00 
+    stat->st_dev = dev;
+  802107:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80210e:	48 89 de             	mov    %rbx,%rsi
+  802111:	4c 89 e7             	mov    %r12,%rdi
+  802114:	ff 50 28             	call   *0x28(%rax)
+}
+  802117:	48 83 c4 10          	add    $0x10,%rsp
+  80211b:	5b                   	pop    %rbx
+  80211c:	41 5c                	pop    %r12
+  80211e:	5d                   	pop    %rbp
+  80211f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802120:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802125:	eb f0                	jmp    802117 <fstat+0x70>
+
+0000000000802127 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802127:	55                   	push   %rbp
+  802128:	48 89 e5             	mov    %rsp,%rbp
+  80212b:	41 54                	push   %r12
+  80212d:	53                   	push   %rbx
+  80212e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802131:	be 00 00 00 00       	mov    $0x0,%esi
+  802136:	48 b8 95 32 80 00 00 	movabs $0x803295,%rax
+  80213d:	00 00 00 
+  802140:	ff d0                	call   *%rax
+  802142:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802144:	85 c0                	test   %eax,%eax
+  802146:	78 25                	js     80216d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802148:	4c 89 e6             	mov    %r12,%rsi
+  80214b:	89 c7                	mov    %eax,%edi
+  80214d:	48 b8 a7 20 80 00 00 	movabs $0x8020a7,%rax
+  802154:	00 00 00 
+  802157:	ff d0                	call   *%rax
+  802159:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80215c:	89 df                	mov    %ebx,%edi
+  80215e:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  802165:	00 00 00 
+  802168:	ff d0                	call   *%rax
+
+    return res;
+  80216a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80216d:	89 d8                	mov    %ebx,%eax
+  80216f:	5b                   	pop    %rbx
+  802170:	41 5c                	pop    %r12
+  802172:	5d                   	pop    %rbp
+  802173:	c3                   	ret
+
+0000000000802174 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802174:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80217b:	00 00 00 
+  80217e:	83 38 00             	cmpl   $0x0,(%rax)
+  802181:	74 0a                	je     80218d <fsenv+0x19>
+    return envid;
+}
+  802183:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80218a:	00 00 
+  80218c:	c3                   	ret
+fsenv(void) {
+  80218d:	55                   	push   %rbp
+  80218e:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802191:	bf 03 00 00 00       	mov    $0x3,%edi
+  802196:	48 b8 7f 55 80 00 00 	movabs $0x80557f,%rax
+  80219d:	00 00 00 
+  8021a0:	ff d0                	call   *%rax
+  8021a2:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8021a9:	00 00 
+}
+  8021ab:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8021b2:	00 00 
+  8021b4:	5d                   	pop    %rbp
+  8021b5:	c3                   	ret
+
+00000000008021b6 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8021b6:	55                   	push   %rbp
+  8021b7:	48 89 e5             	mov    %rsp,%rbp
+  8021ba:	41 54                	push   %r12
+  8021bc:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021bd:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021c2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021c7:	48 89 de             	mov    %rbx,%rsi
+  8021ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021cf:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  8021d6:	00 00 00 
+  8021d9:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8021db:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8021e2:	00 00 00 
+  8021e5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8021eb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8021f0:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021f5:	48 89 de             	mov    %rbx,%rsi
+  8021f8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fd:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  802204:	00 00 00 
+  802207:	ff d0                	call   *%rax
+  802209:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80220b:	85 c0                	test   %eax,%eax
+  80220d:	0f 88 a2 00 00 00    	js     8022b5 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802213:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  80221a:	00 00 00 
+  80221d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802223:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802228:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80222a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80222f:	49 bc 0f 50 80 00 00 	movabs $0x80500f,%r12
+  802236:	00 00 00 
+  802239:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80223c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802241:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802244:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  80224b:	00 00 00 
+  80224e:	ff d0                	call   *%rax
+  802250:	89 c7                	mov    %eax,%edi
+  802252:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802258:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80225d:	48 89 da             	mov    %rbx,%rdx
+  802260:	be 09 00 00 00       	mov    $0x9,%esi
+  802265:	48 b8 29 55 80 00 00 	movabs $0x805529,%rax
+  80226c:	00 00 00 
+  80226f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802271:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802276:	ba 00 00 00 00       	mov    $0x0,%edx
+  80227b:	be 00 00 00 00       	mov    $0x0,%esi
+  802280:	bf 00 00 00 00       	mov    $0x0,%edi
+  802285:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  80228c:	00 00 00 
+  80228f:	ff d0                	call   *%rax
+  802291:	89 c3                	mov    %eax,%ebx
+  802293:	85 c0                	test   %eax,%eax
+  802295:	78 25                	js     8022bc <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802297:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  80229e:	00 00 00 
+  8022a1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022a7:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8022ae:	00 00 
+    return 0;
+  8022b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8022b5:	89 d8                	mov    %ebx,%eax
+  8022b7:	5b                   	pop    %rbx
+  8022b8:	41 5c                	pop    %r12
+  8022ba:	5d                   	pop    %rbp
+  8022bb:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8022bc:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8022c1:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8022c6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022cb:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  8022d2:	00 00 00 
+  8022d5:	ff d0                	call   *%rax
+        return res;
+  8022d7:	eb dc                	jmp    8022b5 <fschan_setup+0xff>
+
+00000000008022d9 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8022d9:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8022e0:	00 00 00 
+  8022e3:	80 38 00             	cmpb   $0x0,(%rax)
+  8022e6:	74 55                	je     80233d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022e8:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  8022ef:	00 00 00 
+  8022f2:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8022f8:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022fd:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802304:	00 00 00 
+  802307:	3b 0a                	cmp    (%rdx),%ecx
+  802309:	75 01                	jne    80230c <fschan+0x33>
+}
+  80230b:	c3                   	ret
+fschan(void) {
+  80230c:	55                   	push   %rbp
+  80230d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802310:	48 b8 b6 21 80 00 00 	movabs $0x8021b6,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+  80231c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80231e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802323:	85 d2                	test   %edx,%edx
+  802325:	78 02                	js     802329 <fschan+0x50>
+}
+  802327:	5d                   	pop    %rbp
+  802328:	c3                   	ret
+        fschan_enabled = 0;
+  802329:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802330:	00 00 00 
+  802333:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80233b:	eb ea                	jmp    802327 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80233d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802342:	c3                   	ret
+
+0000000000802343 <fbuf>:
+fbuf(struct Fd *fd) {
+  802343:	55                   	push   %rbp
+  802344:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802347:	48 b8 42 1a 80 00 00 	movabs $0x801a42,%rax
+  80234e:	00 00 00 
+  802351:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802353:	ba 00 00 00 00       	mov    $0x0,%edx
+  802358:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80235c:	77 12                	ja     802370 <fbuf+0x2d>
+  80235e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802362:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802369:	00 00 00 
+  80236c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802370:	48 89 d0             	mov    %rdx,%rax
+  802373:	5d                   	pop    %rbp
+  802374:	c3                   	ret
+
+0000000000802375 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802375:	55                   	push   %rbp
+  802376:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802379:	48 83 c7 40          	add    $0x40,%rdi
+  80237d:	48 b8 49 50 80 00 00 	movabs $0x805049,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+  802389:	84 c0                	test   %al,%al
+  80238b:	75 02                	jne    80238f <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80238d:	5d                   	pop    %rbp
+  80238e:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80238f:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  802396:	00 00 00 
+  802399:	ff d0                	call   *%rax
+  80239b:	89 c7                	mov    %eax,%edi
+  80239d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023a3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ad:	be 0a 00 00 00       	mov    $0xa,%esi
+  8023b2:	48 b8 29 55 80 00 00 	movabs $0x805529,%rax
+  8023b9:	00 00 00 
+  8023bc:	ff d0                	call   *%rax
+}
+  8023be:	eb cd                	jmp    80238d <fschan_publish+0x18>
+
+00000000008023c0 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8023c0:	55                   	push   %rbp
+  8023c1:	48 89 e5             	mov    %rsp,%rbp
+  8023c4:	41 57                	push   %r15
+  8023c6:	41 56                	push   %r14
+  8023c8:	41 55                	push   %r13
+  8023ca:	41 54                	push   %r12
+  8023cc:	53                   	push   %rbx
+  8023cd:	48 83 ec 48          	sub    $0x48,%rsp
+  8023d1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023d5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8023d9:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8023dc:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8023e0:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8023e3:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8023ea:	00 00 00 
+  8023ed:	8b 02                	mov    (%rdx),%eax
+  8023ef:	83 c0 01             	add    $0x1,%eax
+  8023f2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023f7:	0f 44 c1             	cmove  %ecx,%eax
+  8023fa:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8023fc:	4d 85 c0             	test   %r8,%r8
+  8023ff:	74 2c                	je     80242d <fschan_rw+0x6d>
+  802401:	45 89 ce             	mov    %r9d,%r14d
+  802404:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80240b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80240f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802415:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80241c:	00 
+  80241d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802423:	b8 01 00 00 00       	mov    $0x1,%eax
+  802428:	e9 41 01 00 00       	jmp    80256e <fschan_rw+0x1ae>
+  80242d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802431:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802435:	e9 9c 01 00 00       	jmp    8025d6 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80243a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80243e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802441:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802444:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802447:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80244b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80244f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802453:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802457:	48 89 da             	mov    %rbx,%rdx
+  80245a:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802466:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80246a:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  802471:	00 00 00 
+  802474:	ff d0                	call   *%rax
+            queued += blk;
+  802476:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802479:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80247d:	4d 39 fc             	cmp    %r15,%r12
+  802480:	73 6b                	jae    8024ed <fschan_rw+0x12d>
+  802482:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802486:	77 65                	ja     8024ed <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802488:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80248c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802490:	48 b8 24 50 80 00 00 	movabs $0x805024,%rax
+  802497:	00 00 00 
+  80249a:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80249c:	4c 89 fb             	mov    %r15,%rbx
+  80249f:	4c 29 e3             	sub    %r12,%rbx
+  8024a2:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8024a7:	48 39 d3             	cmp    %rdx,%rbx
+  8024aa:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8024ae:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8024b2:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8024b6:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8024ba:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8024bd:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8024bf:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8024c6:	00 00 00 
+  8024c9:	8b 09                	mov    (%rcx),%ecx
+  8024cb:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8024ce:	83 fe 03             	cmp    $0x3,%esi
+  8024d1:	0f 85 63 ff ff ff    	jne    80243a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8024d7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8024db:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8024de:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8024e1:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8024e4:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8024e8:	e9 79 ff ff ff       	jmp    802466 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8024ed:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024f1:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8024f8:	48 89 df             	mov    %rbx,%rdi
+  8024fb:	48 b8 e7 50 80 00 00 	movabs $0x8050e7,%rax
+  802502:	00 00 00 
+  802505:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802507:	48 89 df             	mov    %rbx,%rdi
+  80250a:	48 b8 75 50 80 00 00 	movabs $0x805075,%rax
+  802511:	00 00 00 
+  802514:	ff d0                	call   *%rax
+  802516:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80251a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80251e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802522:	75 25                	jne    802549 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802524:	8b 40 04             	mov    0x4(%rax),%eax
+  802527:	85 c0                	test   %eax,%eax
+  802529:	0f 88 86 00 00 00    	js     8025b5 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80252f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802533:	74 5b                	je     802590 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802535:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802539:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80253d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802541:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802545:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802549:	48 89 df             	mov    %rbx,%rdi
+  80254c:	48 b8 9c 50 80 00 00 	movabs $0x80509c,%rax
+  802553:	00 00 00 
+  802556:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802558:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80255c:	83 f0 01             	xor    $0x1,%eax
+  80255f:	4d 39 fc             	cmp    %r15,%r12
+  802562:	0f 92 c2             	setb   %dl
+  802565:	84 c2                	test   %al,%dl
+  802567:	75 05                	jne    80256e <fschan_rw+0x1ae>
+  802569:	45 85 ed             	test   %r13d,%r13d
+  80256c:	74 50                	je     8025be <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80256e:	4d 39 fc             	cmp    %r15,%r12
+  802571:	0f 92 c1             	setb   %cl
+  802574:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802578:	0f 96 c2             	setbe  %dl
+  80257b:	84 d1                	test   %dl,%cl
+  80257d:	0f 84 6a ff ff ff    	je     8024ed <fschan_rw+0x12d>
+  802583:	84 c0                	test   %al,%al
+  802585:	0f 85 fd fe ff ff    	jne    802488 <fschan_rw+0xc8>
+  80258b:	e9 5d ff ff ff       	jmp    8024ed <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802590:	48 63 d0             	movslq %eax,%rdx
+  802593:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802597:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80259b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80259f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8025a3:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8025a7:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  8025ae:	00 00 00 
+  8025b1:	ff d0                	call   *%rax
+  8025b3:	eb 80                	jmp    802535 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8025b5:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8025b8:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8025bc:	eb 8b                	jmp    802549 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8025be:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8025c3:	0f 85 68 fe ff ff    	jne    802431 <fschan_rw+0x71>
+  8025c9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8025cc:	85 c0                	test   %eax,%eax
+  8025ce:	0f 84 5d fe ff ff    	je     802431 <fschan_rw+0x71>
+  8025d4:	48 98                	cltq
+}
+  8025d6:	48 83 c4 48          	add    $0x48,%rsp
+  8025da:	5b                   	pop    %rbx
+  8025db:	41 5c                	pop    %r12
+  8025dd:	41 5d                	pop    %r13
+  8025df:	41 5e                	pop    %r14
+  8025e1:	41 5f                	pop    %r15
+  8025e3:	5d                   	pop    %rbp
+  8025e4:	c3                   	ret
+
+00000000008025e5 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8025e5:	55                   	push   %rbp
+  8025e6:	48 89 e5             	mov    %rsp,%rbp
+  8025e9:	41 56                	push   %r14
+  8025eb:	41 55                	push   %r13
+  8025ed:	41 54                	push   %r12
+  8025ef:	53                   	push   %rbx
+  8025f0:	48 83 ec 10          	sub    $0x10,%rsp
+  8025f4:	49 89 fe             	mov    %rdi,%r14
+  8025f7:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8025fa:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8025fe:	48 29 f3             	sub    %rsi,%rbx
+  802601:	48 39 d3             	cmp    %rdx,%rbx
+  802604:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802608:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80260f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802610:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802615:	49 bd 17 4c 80 00 00 	movabs $0x804c17,%r13
+  80261c:	00 00 00 
+  80261f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802626:	76 1e                	jbe    802646 <mmap_fault+0x61>
+  802628:	4c 01 e7             	add    %r12,%rdi
+  80262b:	41 ff d5             	call   *%r13
+  80262e:	84 c0                	test   %al,%al
+  802630:	75 14                	jne    802646 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802632:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802636:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80263d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802641:	48 39 df             	cmp    %rbx,%rdi
+  802644:	72 e2                	jb     802628 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802646:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80264d:	00 00 00 
+  802650:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802657:	00 00 00 
+  80265a:	4c 89 f0             	mov    %r14,%rax
+  80265d:	48 29 d0             	sub    %rdx,%rax
+  802660:	48 c1 f8 03          	sar    $0x3,%rax
+  802664:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80266b:	aa aa aa 
+  80266e:	48 0f af c2          	imul   %rdx,%rax
+  802672:	48 c1 e0 0c          	shl    $0xc,%rax
+  802676:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80267b:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80267f:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802681:	44 89 e0             	mov    %r12d,%eax
+  802684:	41 03 46 10          	add    0x10(%r14),%eax
+  802688:	41 2b 06             	sub    (%r14),%eax
+  80268b:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80268e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802692:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802696:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80269a:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80269d:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  8026a4:	00 00 00 
+  8026a7:	ff d0                	call   *%rax
+  8026a9:	89 c7                	mov    %eax,%edi
+  8026ab:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026b1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026b6:	48 89 da             	mov    %rbx,%rdx
+  8026b9:	be 0f 00 00 00       	mov    $0xf,%esi
+  8026be:	48 b8 29 55 80 00 00 	movabs $0x805529,%rax
+  8026c5:	00 00 00 
+  8026c8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8026ca:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026cf:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026d3:	4c 89 e6             	mov    %r12,%rsi
+  8026d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026db:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  8026e2:	00 00 00 
+  8026e5:	ff d0                	call   *%rax
+  8026e7:	48 98                	cltq
+}
+  8026e9:	48 83 c4 10          	add    $0x10,%rsp
+  8026ed:	5b                   	pop    %rbx
+  8026ee:	41 5c                	pop    %r12
+  8026f0:	41 5d                	pop    %r13
+  8026f2:	41 5e                	pop    %r14
+  8026f4:	5d                   	pop    %rbp
+  8026f5:	c3                   	ret
+
+00000000008026f6 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8026f6:	48 8b 37             	mov    (%rdi),%rsi
+  8026f9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802700:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802707:	00 00 00 
+  80270a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80270f:	eb 0f                	jmp    802720 <mmap_pgfault+0x2a>
+  802711:	c3                   	ret
+  802712:	48 83 c1 01          	add    $0x1,%rcx
+  802716:	48 83 c2 18          	add    $0x18,%rdx
+  80271a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80271e:	74 6e                	je     80278e <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802720:	48 8b 02             	mov    (%rdx),%rax
+  802723:	48 83 e8 01          	sub    $0x1,%rax
+  802727:	48 39 f0             	cmp    %rsi,%rax
+  80272a:	73 e6                	jae    802712 <mmap_pgfault+0x1c>
+  80272c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802730:	73 e0                	jae    802712 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802732:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80273b:	f6 c2 01             	test   $0x1,%dl
+  80273e:	75 d1                	jne    802711 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802740:	f6 c2 02             	test   $0x2,%dl
+  802743:	74 1a                	je     80275f <mmap_pgfault+0x69>
+  802745:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802749:	b8 00 00 00 00       	mov    $0x0,%eax
+  80274e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802755:	00 00 00 
+  802758:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80275d:	74 35                	je     802794 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80275f:	55                   	push   %rbp
+  802760:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802763:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802767:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80276e:	00 00 00 
+  802771:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802775:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80277a:	48 b8 e5 25 80 00 00 	movabs $0x8025e5,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+  802786:	48 85 c0             	test   %rax,%rax
+  802789:	0f 9f c0             	setg   %al
+}
+  80278c:	5d                   	pop    %rbp
+  80278d:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80278e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802793:	c3                   	ret
+}
+  802794:	c3                   	ret
+
+0000000000802795 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802795:	55                   	push   %rbp
+  802796:	48 89 e5             	mov    %rsp,%rbp
+  802799:	41 54                	push   %r12
+  80279b:	53                   	push   %rbx
+  80279c:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80279f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027a6:	00 00 00 
+  8027a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8027ae:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8027b2:	74 15                	je     8027c9 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8027b4:	48 83 c3 01          	add    $0x1,%rbx
+  8027b8:	48 83 c0 18          	add    $0x18,%rax
+  8027bc:	48 83 fb 20          	cmp    $0x20,%rbx
+  8027c0:	75 ec                	jne    8027ae <mmap_alloc+0x19>
+    return NULL;
+  8027c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c7:	eb 52                	jmp    80281b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027c9:	4c 89 e7             	mov    %r12,%rdi
+  8027cc:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  8027d3:	00 00 00 
+  8027d6:	ff d0                	call   *%rax
+  8027d8:	41 89 c1             	mov    %eax,%r9d
+  8027db:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8027e2:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027e6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f1:	4c 89 e6             	mov    %r12,%rsi
+  8027f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027f9:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  802800:	00 00 00 
+  802803:	ff d0                	call   *%rax
+  802805:	85 c0                	test   %eax,%eax
+  802807:	78 17                	js     802820 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802809:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80280d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802814:	00 00 00 
+  802817:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80281b:	5b                   	pop    %rbx
+  80281c:	41 5c                	pop    %r12
+  80281e:	5d                   	pop    %rbp
+  80281f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802820:	b8 00 00 00 00       	mov    $0x0,%eax
+  802825:	eb f4                	jmp    80281b <mmap_alloc+0x86>
+
+0000000000802827 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802827:	55                   	push   %rbp
+  802828:	48 89 e5             	mov    %rsp,%rbp
+  80282b:	41 56                	push   %r14
+  80282d:	41 55                	push   %r13
+  80282f:	41 54                	push   %r12
+  802831:	53                   	push   %rbx
+  802832:	48 83 ec 10          	sub    $0x10,%rsp
+  802836:	41 89 fc             	mov    %edi,%r12d
+  802839:	49 89 f5             	mov    %rsi,%r13
+  80283c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80283f:	48 89 f0             	mov    %rsi,%rax
+  802842:	48 09 d0             	or     %rdx,%rax
+  802845:	75 0d                	jne    802854 <fsipc+0x2d>
+  802847:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80284a:	83 f8 04             	cmp    $0x4,%eax
+  80284d:	76 7d                	jbe    8028cc <fsipc+0xa5>
+  80284f:	83 ff 0d             	cmp    $0xd,%edi
+  802852:	74 78                	je     8028cc <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802854:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  80285b:	00 00 00 
+  80285e:	ff d0                	call   *%rax
+  802860:	89 c7                	mov    %eax,%edi
+  802862:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802869:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802870:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802877:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80287d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802884:	00 00 00 
+  802887:	44 89 e6             	mov    %r12d,%esi
+  80288a:	48 b8 29 55 80 00 00 	movabs $0x805529,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802896:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80289d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80289e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028a3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8028a7:	4c 89 ee             	mov    %r13,%rsi
+  8028aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028af:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+  8028bb:	89 c3                	mov    %eax,%ebx
+}
+  8028bd:	89 d8                	mov    %ebx,%eax
+  8028bf:	48 83 c4 10          	add    $0x10,%rsp
+  8028c3:	5b                   	pop    %rbx
+  8028c4:	41 5c                	pop    %r12
+  8028c6:	41 5d                	pop    %r13
+  8028c8:	41 5e                	pop    %r14
+  8028ca:	5d                   	pop    %rbp
+  8028cb:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8028cc:	48 b8 d9 22 80 00 00 	movabs $0x8022d9,%rax
+  8028d3:	00 00 00 
+  8028d6:	ff d0                	call   *%rax
+  8028d8:	49 89 c6             	mov    %rax,%r14
+  8028db:	48 85 c0             	test   %rax,%rax
+  8028de:	0f 84 70 ff ff ff    	je     802854 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8028e4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8028e8:	48 b8 24 50 80 00 00 	movabs $0x805024,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8028f4:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8028f7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8028fe:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802902:	ba 10 00 00 00       	mov    $0x10,%edx
+  802907:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80290e:	00 00 00 
+  802911:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  802918:	00 00 00 
+  80291b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80291d:	4c 89 f7             	mov    %r14,%rdi
+  802920:	48 b8 75 23 80 00 00 	movabs $0x802375,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80292c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802933:	4c 89 f7             	mov    %r14,%rdi
+  802936:	48 b8 e7 50 80 00 00 	movabs $0x8050e7,%rax
+  80293d:	00 00 00 
+  802940:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802942:	4c 89 f7             	mov    %r14,%rdi
+  802945:	48 b8 75 50 80 00 00 	movabs $0x805075,%rax
+  80294c:	00 00 00 
+  80294f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802951:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802954:	41 83 fc 05          	cmp    $0x5,%r12d
+  802958:	75 04                	jne    80295e <fsipc+0x137>
+  80295a:	85 db                	test   %ebx,%ebx
+  80295c:	79 14                	jns    802972 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80295e:	4c 89 f7             	mov    %r14,%rdi
+  802961:	48 b8 9c 50 80 00 00 	movabs $0x80509c,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80296d:	e9 4b ff ff ff       	jmp    8028bd <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802972:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802976:	ba 88 00 00 00       	mov    $0x88,%edx
+  80297b:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802982:	00 00 00 
+  802985:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+  802991:	eb cb                	jmp    80295e <fsipc+0x137>
+
+0000000000802993 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802993:	55                   	push   %rbp
+  802994:	48 89 e5             	mov    %rsp,%rbp
+  802997:	41 57                	push   %r15
+  802999:	41 56                	push   %r14
+  80299b:	41 55                	push   %r13
+  80299d:	41 54                	push   %r12
+  80299f:	53                   	push   %rbx
+  8029a0:	48 83 ec 18          	sub    $0x18,%rsp
+  8029a4:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8029a8:	49 89 f6             	mov    %rsi,%r14
+  8029ab:	49 89 d4             	mov    %rdx,%r12
+  8029ae:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8029b1:	48 b8 d9 22 80 00 00 	movabs $0x8022d9,%rax
+  8029b8:	00 00 00 
+  8029bb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8029bd:	48 85 c0             	test   %rax,%rax
+  8029c0:	0f 85 96 00 00 00    	jne    802a5c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8029c6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8029cd:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029ce:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8029d5:	00 00 00 
+    while (n) {
+  8029d8:	4d 85 e4             	test   %r12,%r12
+  8029db:	74 79                	je     802a56 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8029dd:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8029e2:	49 39 dc             	cmp    %rbx,%r12
+  8029e5:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8029e9:	48 89 da             	mov    %rbx,%rdx
+  8029ec:	4c 89 f6             	mov    %r14,%rsi
+  8029ef:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8029f6:	00 00 00 
+  8029f9:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  802a00:	00 00 00 
+  802a03:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a09:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a0c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802a0f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802a12:	44 01 e8             	add    %r13d,%eax
+  802a15:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802a19:	41 0f 44 c5          	cmove  %r13d,%eax
+  802a1d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802a21:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802a25:	48 89 da             	mov    %rbx,%rdx
+  802a28:	be 00 00 00 00       	mov    $0x0,%esi
+  802a2d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a32:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802a39:	00 00 00 
+  802a3c:	ff d0                	call   *%rax
+        if (res < 0)
+  802a3e:	85 c0                	test   %eax,%eax
+  802a40:	78 4a                	js     802a8c <devfile_write_direct+0xf9>
+        buf += res;
+  802a42:	48 98                	cltq
+  802a44:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a47:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a4b:	49 29 c4             	sub    %rax,%r12
+  802a4e:	75 8d                	jne    8029dd <devfile_write_direct+0x4a>
+    return write;
+  802a50:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a54:	eb 27                	jmp    802a7d <devfile_write_direct+0xea>
+    size_t write = 0;
+  802a56:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802a5a:	eb f4                	jmp    802a50 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a5c:	45 89 e9             	mov    %r13d,%r9d
+  802a5f:	4d 89 e0             	mov    %r12,%r8
+  802a62:	4c 89 f1             	mov    %r14,%rcx
+  802a65:	ba 04 00 00 00       	mov    $0x4,%edx
+  802a6a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a6e:	48 89 c7             	mov    %rax,%rdi
+  802a71:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802a78:	00 00 00 
+  802a7b:	ff d0                	call   *%rax
+}
+  802a7d:	48 83 c4 18          	add    $0x18,%rsp
+  802a81:	5b                   	pop    %rbx
+  802a82:	41 5c                	pop    %r12
+  802a84:	41 5d                	pop    %r13
+  802a86:	41 5e                	pop    %r14
+  802a88:	41 5f                	pop    %r15
+  802a8a:	5d                   	pop    %rbp
+  802a8b:	c3                   	ret
+            return res;
+  802a8c:	48 98                	cltq
+  802a8e:	eb ed                	jmp    802a7d <devfile_write_direct+0xea>
+
+0000000000802a90 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802a90:	55                   	push   %rbp
+  802a91:	48 89 e5             	mov    %rsp,%rbp
+  802a94:	41 54                	push   %r12
+  802a96:	53                   	push   %rbx
+  802a97:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802a9a:	48 b8 43 23 80 00 00 	movabs $0x802343,%rax
+  802aa1:	00 00 00 
+  802aa4:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802aa6:	48 85 c0             	test   %rax,%rax
+  802aa9:	74 71                	je     802b1c <fbuf_flush+0x8c>
+  802aab:	48 89 c3             	mov    %rax,%rbx
+  802aae:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ab3:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802ab7:	75 05                	jne    802abe <fbuf_flush+0x2e>
+}
+  802ab9:	5b                   	pop    %rbx
+  802aba:	41 5c                	pop    %r12
+  802abc:	5d                   	pop    %rbp
+  802abd:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802abe:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802ac1:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802ac5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802acc:	00 00 00 
+  802acf:	48 89 de             	mov    %rbx,%rsi
+  802ad2:	48 29 c6             	sub    %rax,%rsi
+  802ad5:	48 c1 fe 03          	sar    $0x3,%rsi
+  802ad9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802ae0:	aa aa aa 
+  802ae3:	48 0f af f0          	imul   %rax,%rsi
+  802ae7:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802aeb:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802af0:	48 01 c6             	add    %rax,%rsi
+  802af3:	4c 89 e7             	mov    %r12,%rdi
+  802af6:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802afd:	00 00 00 
+  802b00:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802b02:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802b06:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b0d:	00 
+    return res < 0 ? res : 0;
+  802b0e:	48 85 c0             	test   %rax,%rax
+  802b11:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b16:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802b1a:	eb 9d                	jmp    802ab9 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802b1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b21:	eb 96                	jmp    802ab9 <fbuf_flush+0x29>
+
+0000000000802b23 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802b23:	55                   	push   %rbp
+  802b24:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802b27:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+}
+  802b33:	5d                   	pop    %rbp
+  802b34:	c3                   	ret
+
+0000000000802b35 <devfile_write>:
+    if (!fd || !buf)
+  802b35:	48 85 ff             	test   %rdi,%rdi
+  802b38:	0f 84 d3 01 00 00    	je     802d11 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	41 57                	push   %r15
+  802b44:	41 56                	push   %r14
+  802b46:	41 55                	push   %r13
+  802b48:	41 54                	push   %r12
+  802b4a:	53                   	push   %rbx
+  802b4b:	48 83 ec 08          	sub    $0x8,%rsp
+  802b4f:	49 89 fc             	mov    %rdi,%r12
+  802b52:	49 89 f6             	mov    %rsi,%r14
+  802b55:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802b58:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b5d:	48 85 f6             	test   %rsi,%rsi
+  802b60:	0f 84 9c 01 00 00    	je     802d02 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802b66:	48 b8 43 23 80 00 00 	movabs $0x802343,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+  802b72:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802b75:	48 85 c0             	test   %rax,%rax
+  802b78:	0f 84 a2 00 00 00    	je     802c20 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b7e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b83:	4c 89 e7             	mov    %r12,%rdi
+  802b86:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802b92:	83 f8 02             	cmp    $0x2,%eax
+  802b95:	0f 8f 85 00 00 00    	jg     802c20 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802b9b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802ba2:	00 00 00 
+  802ba5:	4d 89 ef             	mov    %r13,%r15
+  802ba8:	49 29 c7             	sub    %rax,%r15
+  802bab:	49 c1 ff 03          	sar    $0x3,%r15
+  802baf:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802bb6:	aa aa aa 
+  802bb9:	4c 0f af f8          	imul   %rax,%r15
+  802bbd:	49 c1 e7 0e          	shl    $0xe,%r15
+  802bc1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802bc6:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802bc9:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802bce:	0f 84 d7 00 00 00    	je     802cab <devfile_write+0x176>
+  802bd4:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802bd8:	89 c2                	mov    %eax,%edx
+  802bda:	41 03 55 0c          	add    0xc(%r13),%edx
+  802bde:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802be3:	75 0f                	jne    802bf4 <devfile_write+0xbf>
+  802be5:	48 01 d8             	add    %rbx,%rax
+  802be8:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802bee:	0f 86 92 00 00 00    	jbe    802c86 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802bf4:	4c 89 e7             	mov    %r12,%rdi
+  802bf7:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+  802c03:	85 c0                	test   %eax,%eax
+  802c05:	78 52                	js     802c59 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c07:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c0e:	77 7f                	ja     802c8f <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802c10:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c15:	0f 85 c2 00 00 00    	jne    802cdd <devfile_write+0x1a8>
+  802c1b:	e9 94 00 00 00       	jmp    802cb4 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802c20:	4c 89 e7             	mov    %r12,%rdi
+  802c23:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  802c2a:	00 00 00 
+  802c2d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c2f:	85 c0                	test   %eax,%eax
+  802c31:	79 07                	jns    802c3a <devfile_write+0x105>
+  802c33:	48 98                	cltq
+  802c35:	e9 c8 00 00 00       	jmp    802d02 <devfile_write+0x1cd>
+  802c3a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c3f:	48 89 da             	mov    %rbx,%rdx
+  802c42:	4c 89 f6             	mov    %r14,%rsi
+  802c45:	4c 89 e7             	mov    %r12,%rdi
+  802c48:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802c4f:	00 00 00 
+  802c52:	ff d0                	call   *%rax
+  802c54:	e9 a9 00 00 00       	jmp    802d02 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c59:	48 98                	cltq
+  802c5b:	e9 a2 00 00 00       	jmp    802d02 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c60:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c65:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c6a:	4c 89 fe             	mov    %r15,%rsi
+  802c6d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c72:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	79 45                	jns    802cc7 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c82:	48 98                	cltq
+  802c84:	eb 7c                	jmp    802d02 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c86:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c8d:	76 4e                	jbe    802cdd <devfile_write+0x1a8>
+  802c8f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c94:	48 89 da             	mov    %rbx,%rdx
+  802c97:	4c 89 f6             	mov    %r14,%rsi
+  802c9a:	4c 89 e7             	mov    %r12,%rdi
+  802c9d:	48 b8 93 29 80 00 00 	movabs $0x802993,%rax
+  802ca4:	00 00 00 
+  802ca7:	ff d0                	call   *%rax
+  802ca9:	eb 57                	jmp    802d02 <devfile_write+0x1cd>
+  802cab:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802cb2:	77 db                	ja     802c8f <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802cb4:	4c 89 ff             	mov    %r15,%rdi
+  802cb7:	48 b8 17 4c 80 00 00 	movabs $0x804c17,%rax
+  802cbe:	00 00 00 
+  802cc1:	ff d0                	call   *%rax
+  802cc3:	84 c0                	test   %al,%al
+  802cc5:	74 99                	je     802c60 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802cc7:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802ccc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cd1:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802cd5:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802cdc:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802cdd:	4c 89 ff             	mov    %r15,%rdi
+  802ce0:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802ce4:	48 89 da             	mov    %rbx,%rdx
+  802ce7:	4c 89 f6             	mov    %r14,%rsi
+  802cea:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  802cf1:	00 00 00 
+  802cf4:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802cf6:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802cfa:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802cff:	48 89 d8             	mov    %rbx,%rax
+}
+  802d02:	48 83 c4 08          	add    $0x8,%rsp
+  802d06:	5b                   	pop    %rbx
+  802d07:	41 5c                	pop    %r12
+  802d09:	41 5d                	pop    %r13
+  802d0b:	41 5e                	pop    %r14
+  802d0d:	41 5f                	pop    %r15
+  802d0f:	5d                   	pop    %rbp
+  802d10:	c3                   	ret
+        return E_INVAL;
+  802d11:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d16:	c3                   	ret
+
+0000000000802d17 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d17:	55                   	push   %rbp
+  802d18:	48 89 e5             	mov    %rsp,%rbp
+  802d1b:	41 54                	push   %r12
+  802d1d:	53                   	push   %rbx
+  802d1e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802d21:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  802d28:	00 00 00 
+  802d2b:	ff d0                	call   *%rax
+  802d2d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802d30:	48 89 df             	mov    %rbx,%rdi
+  802d33:	48 b8 43 23 80 00 00 	movabs $0x802343,%rax
+  802d3a:	00 00 00 
+  802d3d:	ff d0                	call   *%rax
+  802d3f:	48 85 c0             	test   %rax,%rax
+  802d42:	74 17                	je     802d5b <devfile_flush+0x44>
+  802d44:	48 89 df             	mov    %rbx,%rdi
+  802d47:	48 b8 43 23 80 00 00 	movabs $0x802343,%rax
+  802d4e:	00 00 00 
+  802d51:	ff d0                	call   *%rax
+  802d53:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802d5a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d5b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d5e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802d65:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802d67:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d6c:	be 00 00 00 00       	mov    $0x0,%esi
+  802d71:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d76:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802d7d:	00 00 00 
+  802d80:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d82:	45 85 e4             	test   %r12d,%r12d
+  802d85:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d89:	5b                   	pop    %rbx
+  802d8a:	41 5c                	pop    %r12
+  802d8c:	5d                   	pop    %rbp
+  802d8d:	c3                   	ret
+
+0000000000802d8e <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802d8e:	55                   	push   %rbp
+  802d8f:	48 89 e5             	mov    %rsp,%rbp
+  802d92:	41 57                	push   %r15
+  802d94:	41 56                	push   %r14
+  802d96:	41 55                	push   %r13
+  802d98:	41 54                	push   %r12
+  802d9a:	53                   	push   %rbx
+  802d9b:	48 83 ec 38          	sub    $0x38,%rsp
+  802d9f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802da3:	49 89 f7             	mov    %rsi,%r15
+  802da6:	48 89 d3             	mov    %rdx,%rbx
+  802da9:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802dac:	48 b8 d9 22 80 00 00 	movabs $0x8022d9,%rax
+  802db3:	00 00 00 
+  802db6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802db8:	48 85 c0             	test   %rax,%rax
+  802dbb:	75 20                	jne    802ddd <devfile_read_direct+0x4f>
+    bool map = 1;
+  802dbd:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802dc2:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802dc9:	00 
+    while (n) {
+  802dca:	48 85 db             	test   %rbx,%rbx
+  802dcd:	0f 85 df 00 00 00    	jne    802eb2 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802dd3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802dd7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ddb:	eb 21                	jmp    802dfe <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ddd:	45 89 f1             	mov    %r14d,%r9d
+  802de0:	49 89 d8             	mov    %rbx,%r8
+  802de3:	4c 89 f9             	mov    %r15,%rcx
+  802de6:	ba 03 00 00 00       	mov    $0x3,%edx
+  802deb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802def:	48 89 c7             	mov    %rax,%rdi
+  802df2:	48 b8 c0 23 80 00 00 	movabs $0x8023c0,%rax
+  802df9:	00 00 00 
+  802dfc:	ff d0                	call   *%rax
+}
+  802dfe:	48 83 c4 38          	add    $0x38,%rsp
+  802e02:	5b                   	pop    %rbx
+  802e03:	41 5c                	pop    %r12
+  802e05:	41 5d                	pop    %r13
+  802e07:	41 5e                	pop    %r14
+  802e09:	41 5f                	pop    %r15
+  802e0b:	5d                   	pop    %rbp
+  802e0c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e0d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e11:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e17:	75 1e                	jne    802e37 <devfile_read_direct+0xa9>
+  802e19:	e9 e2 00 00 00       	jmp    802f00 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802e1e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e22:	eb da                	jmp    802dfe <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802e24:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802e28:	0f 85 d0 01 00 00    	jne    802ffe <devfile_read_direct+0x270>
+            map = 0;
+  802e2e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e32:	eb 03                	jmp    802e37 <devfile_read_direct+0xa9>
+  802e34:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e37:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e3c:	48 39 d3             	cmp    %rdx,%rbx
+  802e3f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e43:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e47:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e4a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802e51:	00 00 00 
+  802e54:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802e56:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802e5a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802e5e:	be 00 00 00 00       	mov    $0x0,%esi
+  802e63:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e68:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  802e6f:	00 00 00 
+  802e72:	ff d0                	call   *%rax
+        if (res <= 0)
+  802e74:	85 c0                	test   %eax,%eax
+  802e76:	0f 8e 63 01 00 00    	jle    802fdf <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802e7c:	4c 63 e0             	movslq %eax,%r12
+  802e7f:	4c 89 e2             	mov    %r12,%rdx
+  802e82:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802e89:	00 00 00 
+  802e8c:	4c 89 ff             	mov    %r15,%rdi
+  802e8f:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  802e96:	00 00 00 
+  802e99:	ff d0                	call   *%rax
+        buf += res;
+  802e9b:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802e9e:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802ea1:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802ea5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802ea9:	48 85 db             	test   %rbx,%rbx
+  802eac:	0f 84 25 ff ff ff    	je     802dd7 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802eb2:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802eb5:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802eb9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802ebd:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ec1:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ec8:	0f 97 c2             	seta   %dl
+  802ecb:	20 c2                	and    %al,%dl
+  802ecd:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802ed0:	0f 84 5e ff ff ff    	je     802e34 <devfile_read_direct+0xa6>
+  802ed6:	4c 89 fa             	mov    %r15,%rdx
+  802ed9:	4d 89 fd             	mov    %r15,%r13
+  802edc:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ee3:	0f 85 4e ff ff ff    	jne    802e37 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ee9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802eed:	0f 84 1a ff ff ff    	je     802e0d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ef3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802efa:	0f 85 37 ff ff ff    	jne    802e37 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802f00:	48 89 d8             	mov    %rbx,%rax
+  802f03:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f09:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802f0e:	48 39 c8             	cmp    %rcx,%rax
+  802f11:	48 0f 47 c1          	cmova  %rcx,%rax
+  802f15:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802f19:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802f1d:	49 89 d4             	mov    %rdx,%r12
+  802f20:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802f24:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  802f2b:	00 00 00 
+  802f2e:	ff d0                	call   *%rax
+  802f30:	a8 40                	test   $0x40,%al
+  802f32:	0f 85 b9 00 00 00    	jne    802ff1 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f38:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802f3f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f43:	49 39 c5             	cmp    %rax,%r13
+  802f46:	72 d8                	jb     802f20 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f48:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f4c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f53:	00 00 00 
+  802f56:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f5a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802f5d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802f5f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802f63:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802f67:	48 b8 74 21 80 00 00 	movabs $0x802174,%rax
+  802f6e:	00 00 00 
+  802f71:	ff d0                	call   *%rax
+  802f73:	89 c7                	mov    %eax,%edi
+  802f75:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f7b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f80:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f87:	00 00 00 
+  802f8a:	be 0e 00 00 00       	mov    $0xe,%esi
+  802f8f:	48 b8 29 55 80 00 00 	movabs $0x805529,%rax
+  802f96:	00 00 00 
+  802f99:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802f9b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fa0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802fa4:	4c 89 fe             	mov    %r15,%rsi
+  802fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fac:	48 b8 05 55 80 00 00 	movabs $0x805505,%rax
+  802fb3:	00 00 00 
+  802fb6:	ff d0                	call   *%rax
+  802fb8:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802fbb:	48 85 d2             	test   %rdx,%rdx
+  802fbe:	0f 84 5a fe ff ff    	je     802e1e <devfile_read_direct+0x90>
+            if (res > 0) {
+  802fc4:	0f 8e 5a fe ff ff    	jle    802e24 <devfile_read_direct+0x96>
+                buf += res;
+  802fca:	48 98                	cltq
+  802fcc:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802fcf:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802fd2:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802fd6:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802fda:	e9 ca fe ff ff       	jmp    802ea9 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802fdf:	41 89 c5             	mov    %eax,%r13d
+  802fe2:	48 98                	cltq
+  802fe4:	45 85 ed             	test   %r13d,%r13d
+  802fe7:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802fec:	e9 0d fe ff ff       	jmp    802dfe <devfile_read_direct+0x70>
+            map = 0;
+  802ff1:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802ff5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ff9:	e9 39 fe ff ff       	jmp    802e37 <devfile_read_direct+0xa9>
+  802ffe:	48 89 d0             	mov    %rdx,%rax
+  803001:	e9 f8 fd ff ff       	jmp    802dfe <devfile_read_direct+0x70>
+
+0000000000803006 <devfile_read>:
+    if (!fd || !buf)
+  803006:	48 85 ff             	test   %rdi,%rdi
+  803009:	0f 84 21 02 00 00    	je     803230 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80300f:	55                   	push   %rbp
+  803010:	48 89 e5             	mov    %rsp,%rbp
+  803013:	41 57                	push   %r15
+  803015:	41 56                	push   %r14
+  803017:	41 55                	push   %r13
+  803019:	41 54                	push   %r12
+  80301b:	53                   	push   %rbx
+  80301c:	48 83 ec 28          	sub    $0x28,%rsp
+  803020:	48 89 fb             	mov    %rdi,%rbx
+  803023:	49 89 f4             	mov    %rsi,%r12
+  803026:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803029:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80302e:	48 85 f6             	test   %rsi,%rsi
+  803031:	74 4b                	je     80307e <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803033:	48 b8 43 23 80 00 00 	movabs $0x802343,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+  80303f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803042:	48 85 c0             	test   %rax,%rax
+  803045:	74 22                	je     803069 <devfile_read+0x63>
+  803047:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80304e:	77 19                	ja     803069 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803050:	be 00 10 00 00       	mov    $0x1000,%esi
+  803055:	48 89 df             	mov    %rbx,%rdi
+  803058:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  80305f:	00 00 00 
+  803062:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803064:	83 f8 02             	cmp    $0x2,%eax
+  803067:	7e 40                	jle    8030a9 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803069:	48 89 df             	mov    %rbx,%rdi
+  80306c:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803078:	85 c0                	test   %eax,%eax
+  80307a:	79 11                	jns    80308d <devfile_read+0x87>
+  80307c:	48 98                	cltq
+}
+  80307e:	48 83 c4 28          	add    $0x28,%rsp
+  803082:	5b                   	pop    %rbx
+  803083:	41 5c                	pop    %r12
+  803085:	41 5d                	pop    %r13
+  803087:	41 5e                	pop    %r14
+  803089:	41 5f                	pop    %r15
+  80308b:	5d                   	pop    %rbp
+  80308c:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80308d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803092:	4c 89 ea             	mov    %r13,%rdx
+  803095:	4c 89 e6             	mov    %r12,%rsi
+  803098:	48 89 df             	mov    %rbx,%rdi
+  80309b:	48 b8 8e 2d 80 00 00 	movabs $0x802d8e,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+  8030a7:	eb d5                	jmp    80307e <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  8030a9:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8030ad:	48 89 df             	mov    %rbx,%rdi
+  8030b0:	48 b8 90 2a 80 00 00 	movabs $0x802a90,%rax
+  8030b7:	00 00 00 
+  8030ba:	ff d0                	call   *%rax
+  8030bc:	85 c0                	test   %eax,%eax
+  8030be:	0f 88 33 01 00 00    	js     8031f7 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  8030c4:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  8030cb:	00 00 00 
+  8030ce:	4c 89 f0             	mov    %r14,%rax
+  8030d1:	48 29 d0             	sub    %rdx,%rax
+  8030d4:	48 c1 f8 03          	sar    $0x3,%rax
+  8030d8:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8030df:	aa aa aa 
+  8030e2:	48 0f af c2          	imul   %rdx,%rax
+  8030e6:	48 c1 e0 0e          	shl    $0xe,%rax
+  8030ea:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030ee:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030f1:	41 39 06             	cmp    %eax,(%r14)
+  8030f4:	75 0d                	jne    803103 <devfile_read+0xfd>
+  8030f6:	8b 43 10             	mov    0x10(%rbx),%eax
+  8030f9:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8030fd:	0f 84 fb 00 00 00    	je     8031fe <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803103:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803108:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80310c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80310f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803113:	48 89 c7             	mov    %rax,%rdi
+  803116:	48 b8 17 4c 80 00 00 	movabs $0x804c17,%rax
+  80311d:	00 00 00 
+  803120:	ff d0                	call   *%rax
+  803122:	84 c0                	test   %al,%al
+  803124:	75 27                	jne    80314d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803126:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80312b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803130:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803134:	bf 00 00 00 00       	mov    $0x0,%edi
+  803139:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803145:	85 c0                	test   %eax,%eax
+  803147:	0f 88 dc 00 00 00    	js     803229 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80314d:	44 89 f8             	mov    %r15d,%eax
+  803150:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803155:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803157:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80315e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80315f:	8b 43 10             	mov    0x10(%rbx),%eax
+  803162:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803166:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803169:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80316e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803172:	48 89 df             	mov    %rbx,%rdi
+  803175:	48 b8 8e 2d 80 00 00 	movabs $0x802d8e,%rax
+  80317c:	00 00 00 
+  80317f:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803181:	48 85 c0             	test   %rax,%rax
+  803184:	0f 88 f4 fe ff ff    	js     80307e <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80318a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80318d:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803190:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803193:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803197:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80319b:	48 63 d1             	movslq %ecx,%rdx
+  80319e:	48 01 d0             	add    %rdx,%rax
+  8031a1:	4d 63 ff             	movslq %r15d,%r15
+  8031a4:	4c 29 f8             	sub    %r15,%rax
+  8031a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ac:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8031b0:	48 85 c0             	test   %rax,%rax
+  8031b3:	0f 8e c5 fe ff ff    	jle    80307e <devfile_read+0x78>
+    n = MIN(n, res);
+  8031b9:	4c 39 e8             	cmp    %r13,%rax
+  8031bc:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  8031c0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8031c3:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8031c7:	48 63 f6             	movslq %esi,%rsi
+  8031ca:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8031cf:	48 01 c6             	add    %rax,%rsi
+  8031d2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031d6:	48 01 c6             	add    %rax,%rsi
+  8031d9:	4c 89 ea             	mov    %r13,%rdx
+  8031dc:	4c 89 e7             	mov    %r12,%rdi
+  8031df:	48 b8 11 13 80 00 00 	movabs $0x801311,%rax
+  8031e6:	00 00 00 
+  8031e9:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8031eb:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8031ef:	4c 89 e8             	mov    %r13,%rax
+  8031f2:	e9 87 fe ff ff       	jmp    80307e <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8031f7:	48 98                	cltq
+  8031f9:	e9 80 fe ff ff       	jmp    80307e <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031fe:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803202:	41 39 d7             	cmp    %edx,%r15d
+  803205:	0f 8c f8 fe ff ff    	jl     803103 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80320b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80320f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803212:	41 39 cf             	cmp    %ecx,%r15d
+  803215:	0f 8d e8 fe ff ff    	jge    803103 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80321b:	4d 63 ff             	movslq %r15d,%r15
+  80321e:	4c 29 f8             	sub    %r15,%rax
+  803221:	48 63 d2             	movslq %edx,%rdx
+  803224:	48 01 d0             	add    %rdx,%rax
+  803227:	eb 87                	jmp    8031b0 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803229:	48 98                	cltq
+  80322b:	e9 4e fe ff ff       	jmp    80307e <devfile_read+0x78>
+        return E_INVAL;
+  803230:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803235:	c3                   	ret
+
+0000000000803236 <fs_channel>:
+fs_channel(bool enable) {
+  803236:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803238:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80323f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803241:	ba 00 00 00 00       	mov    $0x0,%edx
+  803246:	40 84 ff             	test   %dil,%dil
+  803249:	74 47                	je     803292 <fs_channel+0x5c>
+  80324b:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  803252:	00 00 00 
+  803255:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80325b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803262:	00 00 00 
+  803265:	3b 08                	cmp    (%rax),%ecx
+  803267:	74 29                	je     803292 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80326d:	48 b8 b6 21 80 00 00 	movabs $0x8021b6,%rax
+  803274:	00 00 00 
+  803277:	ff d0                	call   *%rax
+  803279:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80327b:	85 c0                	test   %eax,%eax
+  80327d:	78 04                	js     803283 <fs_channel+0x4d>
+}
+  80327f:	89 d0                	mov    %edx,%eax
+  803281:	5d                   	pop    %rbp
+  803282:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803283:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80328a:	00 00 00 
+  80328d:	c6 00 00             	movb   $0x0,(%rax)
+  803290:	eb ed                	jmp    80327f <fs_channel+0x49>
+}
+  803292:	89 d0                	mov    %edx,%eax
+  803294:	c3                   	ret
+
+0000000000803295 <open>:
+open(const char *path, int mode) {
+  803295:	55                   	push   %rbp
+  803296:	48 89 e5             	mov    %rsp,%rbp
+  803299:	41 55                	push   %r13
+  80329b:	41 54                	push   %r12
+  80329d:	53                   	push   %rbx
+  80329e:	48 83 ec 18          	sub    $0x18,%rsp
+  8032a2:	49 89 fc             	mov    %rdi,%r12
+  8032a5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032a8:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  8032af:	00 00 00 
+  8032b2:	ff d0                	call   *%rax
+  8032b4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032ba:	0f 87 8f 00 00 00    	ja     80334f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8032c0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8032c4:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  8032cb:	00 00 00 
+  8032ce:	ff d0                	call   *%rax
+  8032d0:	89 c3                	mov    %eax,%ebx
+  8032d2:	85 c0                	test   %eax,%eax
+  8032d4:	78 55                	js     80332b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8032d6:	4c 89 e6             	mov    %r12,%rsi
+  8032d9:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8032e0:	00 00 00 
+  8032e3:	48 89 df             	mov    %rbx,%rdi
+  8032e6:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  8032ed:	00 00 00 
+  8032f0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032f2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8032f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032fe:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803302:	bf 01 00 00 00       	mov    $0x1,%edi
+  803307:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  80330e:	00 00 00 
+  803311:	ff d0                	call   *%rax
+  803313:	89 c3                	mov    %eax,%ebx
+  803315:	85 c0                	test   %eax,%eax
+  803317:	78 1f                	js     803338 <open+0xa3>
+    return fd2num(fd);
+  803319:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80331d:	48 b8 42 1a 80 00 00 	movabs $0x801a42,%rax
+  803324:	00 00 00 
+  803327:	ff d0                	call   *%rax
+  803329:	89 c3                	mov    %eax,%ebx
+}
+  80332b:	89 d8                	mov    %ebx,%eax
+  80332d:	48 83 c4 18          	add    $0x18,%rsp
+  803331:	5b                   	pop    %rbx
+  803332:	41 5c                	pop    %r12
+  803334:	41 5d                	pop    %r13
+  803336:	5d                   	pop    %rbp
+  803337:	c3                   	ret
+        fd_close(fd, 0);
+  803338:	be 00 00 00 00       	mov    $0x0,%esi
+  80333d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803341:	48 b8 8b 1b 80 00 00 	movabs $0x801b8b,%rax
+  803348:	00 00 00 
+  80334b:	ff d0                	call   *%rax
+        return res;
+  80334d:	eb dc                	jmp    80332b <open+0x96>
+        return -E_BAD_PATH;
+  80334f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803354:	eb d5                	jmp    80332b <open+0x96>
+
+0000000000803356 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803356:	55                   	push   %rbp
+  803357:	48 89 e5             	mov    %rsp,%rbp
+  80335a:	41 56                	push   %r14
+  80335c:	41 55                	push   %r13
+  80335e:	41 54                	push   %r12
+  803360:	53                   	push   %rbx
+  803361:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803365:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80336c:	00 00 00 
+  80336f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803374:	49 bd d0 1a 80 00 00 	movabs $0x801ad0,%r13
+  80337b:	00 00 00 
+  80337e:	49 be 90 2a 80 00 00 	movabs $0x802a90,%r14
+  803385:	00 00 00 
+  803388:	eb 0c                	jmp    803396 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80338a:	83 c3 01             	add    $0x1,%ebx
+  80338d:	49 83 c4 18          	add    $0x18,%r12
+  803391:	83 fb 20             	cmp    $0x20,%ebx
+  803394:	74 1d                	je     8033b3 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803396:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80339b:	74 ed                	je     80338a <file_flush_buffers+0x34>
+  80339d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033a1:	89 df                	mov    %ebx,%edi
+  8033a3:	41 ff d5             	call   *%r13
+  8033a6:	85 c0                	test   %eax,%eax
+  8033a8:	78 e0                	js     80338a <file_flush_buffers+0x34>
+  8033aa:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033ae:	41 ff d6             	call   *%r14
+  8033b1:	eb d7                	jmp    80338a <file_flush_buffers+0x34>
+}
+  8033b3:	48 83 c4 10          	add    $0x10,%rsp
+  8033b7:	5b                   	pop    %rbx
+  8033b8:	41 5c                	pop    %r12
+  8033ba:	41 5d                	pop    %r13
+  8033bc:	41 5e                	pop    %r14
+  8033be:	5d                   	pop    %rbp
+  8033bf:	c3                   	ret
+
+00000000008033c0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8033c0:	55                   	push   %rbp
+  8033c1:	48 89 e5             	mov    %rsp,%rbp
+  8033c4:	41 54                	push   %r12
+  8033c6:	53                   	push   %rbx
+  8033c7:	49 89 fc             	mov    %rdi,%r12
+  8033ca:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8033cc:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  8033d3:	00 00 00 
+  8033d6:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8033d8:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033df:	00 00 00 
+  8033e2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8033e7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8033e9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8033ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033f1:	be 00 00 00 00       	mov    $0x0,%esi
+  8033f6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8033fb:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803402:	00 00 00 
+  803405:	ff d0                	call   *%rax
+}
+  803407:	5b                   	pop    %rbx
+  803408:	41 5c                	pop    %r12
+  80340a:	5d                   	pop    %rbp
+  80340b:	c3                   	ret
+
+000000000080340c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80340c:	55                   	push   %rbp
+  80340d:	48 89 e5             	mov    %rsp,%rbp
+  803410:	41 54                	push   %r12
+  803412:	53                   	push   %rbx
+  803413:	49 89 fc             	mov    %rdi,%r12
+  803416:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803419:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  803420:	00 00 00 
+  803423:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803425:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80342a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803431:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803433:	ba 00 00 00 00       	mov    $0x0,%edx
+  803438:	be 00 00 00 00       	mov    $0x0,%esi
+  80343d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803442:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803449:	00 00 00 
+  80344c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80344e:	85 c0                	test   %eax,%eax
+  803450:	78 3d                	js     80348f <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803452:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803459:	00 00 00 
+  80345c:	4c 89 e6             	mov    %r12,%rsi
+  80345f:	48 89 df             	mov    %rbx,%rdi
+  803462:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  803469:	00 00 00 
+  80346c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80346e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803475:	00 
+  803476:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80347c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803483:	00 
+  803484:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80348a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348f:	5b                   	pop    %rbx
+  803490:	41 5c                	pop    %r12
+  803492:	5d                   	pop    %rbp
+  803493:	c3                   	ret
+
+0000000000803494 <remove>:
+remove(const char *path) {
+  803494:	55                   	push   %rbp
+  803495:	48 89 e5             	mov    %rsp,%rbp
+  803498:	53                   	push   %rbx
+  803499:	48 83 ec 08          	sub    $0x8,%rsp
+  80349d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034a0:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  8034a7:	00 00 00 
+  8034aa:	ff d0                	call   *%rax
+  8034ac:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034b2:	77 3a                	ja     8034ee <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8034b4:	48 89 de             	mov    %rbx,%rsi
+  8034b7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8034be:	00 00 00 
+  8034c1:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  8034c8:	00 00 00 
+  8034cb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8034cd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d2:	be 00 00 00 00       	mov    $0x0,%esi
+  8034d7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8034dc:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8034e3:	00 00 00 
+  8034e6:	ff d0                	call   *%rax
+}
+  8034e8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034ec:	c9                   	leave
+  8034ed:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034ee:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034f3:	eb f3                	jmp    8034e8 <remove+0x54>
+
+00000000008034f5 <sync>:
+sync(void) {
+  8034f5:	55                   	push   %rbp
+  8034f6:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8034f9:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  803500:	00 00 00 
+  803503:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803505:	ba 00 00 00 00       	mov    $0x0,%edx
+  80350a:	be 00 00 00 00       	mov    $0x0,%esi
+  80350f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803514:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  80351b:	00 00 00 
+  80351e:	ff d0                	call   *%rax
+}
+  803520:	5d                   	pop    %rbp
+  803521:	c3                   	ret
+
+0000000000803522 <fsync>:
+fsync(int fdnum) {
+  803522:	55                   	push   %rbp
+  803523:	48 89 e5             	mov    %rsp,%rbp
+  803526:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80352a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80352e:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  803535:	00 00 00 
+  803538:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80353a:	85 c0                	test   %eax,%eax
+  80353c:	78 4b                	js     803589 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80353e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803542:	48 b8 e0 77 80 00 00 	movabs $0x8077e0,%rax
+  803549:	00 00 00 
+  80354c:	8b 00                	mov    (%rax),%eax
+  80354e:	39 02                	cmp    %eax,(%rdx)
+  803550:	75 39                	jne    80358b <fsync+0x69>
+    file_flush_buffers();
+  803552:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  803559:	00 00 00 
+  80355c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80355e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803562:	8b 40 0c             	mov    0xc(%rax),%eax
+  803565:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80356c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80356e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803573:	be 00 00 00 00       	mov    $0x0,%esi
+  803578:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80357d:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803584:	00 00 00 
+  803587:	ff d0                	call   *%rax
+}
+  803589:	c9                   	leave
+  80358a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80358b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803590:	eb f7                	jmp    803589 <fsync+0x67>
+
+0000000000803592 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803592:	55                   	push   %rbp
+  803593:	48 89 e5             	mov    %rsp,%rbp
+  803596:	53                   	push   %rbx
+  803597:	48 83 ec 08          	sub    $0x8,%rsp
+  80359b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80359e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035ad:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  8035b4:	00 00 00 
+  8035b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035b9:	85 c0                	test   %eax,%eax
+  8035bb:	78 2d                	js     8035ea <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8035bd:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8035c4:	00 00 00 
+  8035c7:	48 8b 10             	mov    (%rax),%rdx
+  8035ca:	48 89 13             	mov    %rdx,(%rbx)
+  8035cd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035d1:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8035d5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8035d9:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8035dd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035e1:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8035e5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035ea:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035ee:	c9                   	leave
+  8035ef:	c3                   	ret
+
+00000000008035f0 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8035f0:	55                   	push   %rbp
+  8035f1:	48 89 e5             	mov    %rsp,%rbp
+  8035f4:	53                   	push   %rbx
+  8035f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8035f9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8035fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  803601:	be 00 00 00 00       	mov    $0x0,%esi
+  803606:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80360b:	48 b8 27 28 80 00 00 	movabs $0x802827,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803617:	85 c0                	test   %eax,%eax
+  803619:	78 3d                	js     803658 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80361b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803622:	00 00 00 
+  803625:	48 8b 10             	mov    (%rax),%rdx
+  803628:	48 89 13             	mov    %rdx,(%rbx)
+  80362b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80362f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803633:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803637:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80363b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80363f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803643:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803647:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80364b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80364f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803653:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803658:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80365c:	c9                   	leave
+  80365d:	c3                   	ret
+
+000000000080365e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80365e:	55                   	push   %rbp
+  80365f:	48 89 e5             	mov    %rsp,%rbp
+  803662:	41 57                	push   %r15
+  803664:	41 56                	push   %r14
+  803666:	41 55                	push   %r13
+  803668:	41 54                	push   %r12
+  80366a:	53                   	push   %rbx
+  80366b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80366f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803676:	00 
+  803677:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80367e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803684:	0f 85 43 01 00 00    	jne    8037cd <munmap+0x16f>
+  80368a:	49 89 ff             	mov    %rdi,%r15
+  80368d:	4c 39 f7             	cmp    %r14,%rdi
+  803690:	0f 87 37 01 00 00    	ja     8037cd <munmap+0x16f>
+  803696:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80369d:	00 00 00 
+  8036a0:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8036a6:	eb 2c                	jmp    8036d4 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8036a8:	4c 39 f8             	cmp    %r15,%rax
+  8036ab:	0f 83 85 00 00 00    	jae    803736 <munmap+0xd8>
+            m->mm_end = start;
+  8036b1:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8036b6:	48 83 c3 18          	add    $0x18,%rbx
+  8036ba:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8036c1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8036c8:	00 00 00 
+  8036cb:	48 39 c3             	cmp    %rax,%rbx
+  8036ce:	0f 84 d0 00 00 00    	je     8037a4 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8036d4:	49 89 dc             	mov    %rbx,%r12
+  8036d7:	48 8b 03             	mov    (%rbx),%rax
+  8036da:	4c 39 f0             	cmp    %r14,%rax
+  8036dd:	73 d7                	jae    8036b6 <munmap+0x58>
+  8036df:	48 85 c0             	test   %rax,%rax
+  8036e2:	74 d2                	je     8036b6 <munmap+0x58>
+  8036e4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036e8:	49 39 d7             	cmp    %rdx,%r15
+  8036eb:	73 c9                	jae    8036b6 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8036ed:	49 39 d6             	cmp    %rdx,%r14
+  8036f0:	73 b6                	jae    8036a8 <munmap+0x4a>
+  8036f2:	49 39 c7             	cmp    %rax,%r15
+  8036f5:	76 b1                	jbe    8036a8 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8036f7:	4c 89 ef             	mov    %r13,%rdi
+  8036fa:	48 b8 95 27 80 00 00 	movabs $0x802795,%rax
+  803701:	00 00 00 
+  803704:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803706:	48 85 c0             	test   %rax,%rax
+  803709:	0f 84 c5 00 00 00    	je     8037d4 <munmap+0x176>
+            *tail = *m;
+  80370f:	48 8b 13             	mov    (%rbx),%rdx
+  803712:	48 89 10             	mov    %rdx,(%rax)
+  803715:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803719:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80371d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803721:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803725:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803728:	44 89 f2             	mov    %r14d,%edx
+  80372b:	2b 13                	sub    (%rbx),%edx
+  80372d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803730:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803734:	eb 80                	jmp    8036b6 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803736:	49 39 d6             	cmp    %rdx,%r14
+  803739:	73 18                	jae    803753 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80373b:	44 89 f2             	mov    %r14d,%edx
+  80373e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803743:	29 c2                	sub    %eax,%edx
+  803745:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80374a:	4d 89 34 24          	mov    %r14,(%r12)
+  80374e:	e9 63 ff ff ff       	jmp    8036b6 <munmap+0x58>
+    m->mm_start = 0;
+  803753:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80375a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80375b:	4c 89 e6             	mov    %r12,%rsi
+  80375e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803765:	00 00 00 
+  803768:	48 29 c6             	sub    %rax,%rsi
+  80376b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80376f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803776:	aa aa aa 
+  803779:	48 0f af f0          	imul   %rax,%rsi
+  80377d:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803781:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803786:	48 01 c6             	add    %rax,%rsi
+  803789:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80378e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803793:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  80379a:	00 00 00 
+  80379d:	ff d0                	call   *%rax
+}
+  80379f:	e9 12 ff ff ff       	jmp    8036b6 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8037a4:	4c 89 f2             	mov    %r14,%rdx
+  8037a7:	4c 29 fa             	sub    %r15,%rdx
+  8037aa:	4c 89 fe             	mov    %r15,%rsi
+  8037ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037b2:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  8037b9:	00 00 00 
+  8037bc:	ff d0                	call   *%rax
+}
+  8037be:	48 83 c4 08          	add    $0x8,%rsp
+  8037c2:	5b                   	pop    %rbx
+  8037c3:	41 5c                	pop    %r12
+  8037c5:	41 5d                	pop    %r13
+  8037c7:	41 5e                	pop    %r14
+  8037c9:	41 5f                	pop    %r15
+  8037cb:	5d                   	pop    %rbp
+  8037cc:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8037cd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037d2:	eb ea                	jmp    8037be <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8037d4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8037d9:	eb e3                	jmp    8037be <munmap+0x160>
+
+00000000008037db <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8037db:	55                   	push   %rbp
+  8037dc:	48 89 e5             	mov    %rsp,%rbp
+  8037df:	41 57                	push   %r15
+  8037e1:	41 56                	push   %r14
+  8037e3:	41 55                	push   %r13
+  8037e5:	41 54                	push   %r12
+  8037e7:	53                   	push   %rbx
+  8037e8:	48 83 ec 28          	sub    $0x28,%rsp
+  8037ec:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8037f0:	49 89 f5             	mov    %rsi,%r13
+  8037f3:	41 89 d6             	mov    %edx,%r14d
+  8037f6:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8037f9:	41 89 cc             	mov    %ecx,%r12d
+  8037fc:	44 89 c7             	mov    %r8d,%edi
+  8037ff:	44 89 cb             	mov    %r9d,%ebx
+  803802:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803806:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80380a:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  803811:	00 00 00 
+  803814:	ff d0                	call   *%rax
+  803816:	41 89 c7             	mov    %eax,%r15d
+  803819:	85 c0                	test   %eax,%eax
+  80381b:	0f 88 ae 01 00 00    	js     8039cf <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803821:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803825:	48 ba e0 77 80 00 00 	movabs $0x8077e0,%rdx
+  80382c:	00 00 00 
+  80382f:	8b 32                	mov    (%rdx),%esi
+  803831:	39 30                	cmp    %esi,(%rax)
+  803833:	0f 85 7a 02 00 00    	jne    803ab3 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803839:	8b 40 08             	mov    0x8(%rax),%eax
+  80383c:	83 e0 03             	and    $0x3,%eax
+  80383f:	83 f8 01             	cmp    $0x1,%eax
+  803842:	0f 84 76 02 00 00    	je     803abe <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803848:	4d 85 ed             	test   %r13,%r13
+  80384b:	0f 84 78 02 00 00    	je     803ac9 <mmap+0x2ee>
+  803851:	85 db                	test   %ebx,%ebx
+  803853:	0f 88 70 02 00 00    	js     803ac9 <mmap+0x2ee>
+  803859:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80385f:	41 89 df             	mov    %ebx,%r15d
+  803862:	0f 85 6c 02 00 00    	jne    803ad4 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803868:	44 89 f0             	mov    %r14d,%eax
+  80386b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80386e:	83 f8 04             	cmp    $0x4,%eax
+  803871:	0f 85 68 02 00 00    	jne    803adf <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803877:	44 89 e1             	mov    %r12d,%ecx
+  80387a:	83 e1 01             	and    $0x1,%ecx
+  80387d:	0f 95 c2             	setne  %dl
+  803880:	44 89 e0             	mov    %r12d,%eax
+  803883:	d1 e8                	shr    %eax
+  803885:	83 f0 01             	xor    $0x1,%eax
+  803888:	83 e0 01             	and    $0x1,%eax
+  80388b:	38 c2                	cmp    %al,%dl
+  80388d:	0f 85 57 02 00 00    	jne    803aea <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803893:	85 c9                	test   %ecx,%ecx
+  803895:	74 0a                	je     8038a1 <mmap+0xc6>
+  803897:	41 f6 c6 02          	test   $0x2,%r14b
+  80389b:	0f 85 54 02 00 00    	jne    803af5 <mmap+0x31a>
+    file_flush_buffers();
+  8038a1:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  8038a8:	00 00 00 
+  8038ab:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8038ad:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8038b4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8038bb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8038bf:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8038c2:	41 f6 c4 04          	test   $0x4,%r12b
+  8038c6:	0f 84 15 01 00 00    	je     8039e1 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8038cc:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8038cf:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8038d5:	0f 85 25 02 00 00    	jne    803b00 <mmap+0x325>
+  8038db:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8038df:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8038e6:	00 00 00 
+  8038e9:	48 39 c2             	cmp    %rax,%rdx
+  8038ec:	0f 82 19 02 00 00    	jb     803b0b <mmap+0x330>
+  8038f2:	48 39 c7             	cmp    %rax,%rdi
+  8038f5:	0f 87 10 02 00 00    	ja     803b0b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8038fb:	4c 89 ee             	mov    %r13,%rsi
+  8038fe:	48 b8 5e 36 80 00 00 	movabs $0x80365e,%rax
+  803905:	00 00 00 
+  803908:	ff d0                	call   *%rax
+  80390a:	85 c0                	test   %eax,%eax
+  80390c:	0f 88 04 02 00 00    	js     803b16 <mmap+0x33b>
+    if (!handler) {
+  803912:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803919:	00 00 00 
+  80391c:	80 38 00             	cmpb   $0x0,(%rax)
+  80391f:	75 2b                	jne    80394c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803921:	48 bf f6 26 80 00 00 	movabs $0x8026f6,%rdi
+  803928:	00 00 00 
+  80392b:	48 b8 d4 51 80 00 00 	movabs $0x8051d4,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+  803937:	85 c0                	test   %eax,%eax
+  803939:	0f 88 ea 01 00 00    	js     803b29 <mmap+0x34e>
+        handler = 1;
+  80393f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803946:	00 00 00 
+  803949:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80394c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803950:	48 b8 95 27 80 00 00 	movabs $0x802795,%rax
+  803957:	00 00 00 
+  80395a:	ff d0                	call   *%rax
+  80395c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80395f:	48 85 c0             	test   %rax,%rax
+  803962:	0f 84 c9 01 00 00    	je     803b31 <mmap+0x356>
+    m->mm_start = va;
+  803968:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80396b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80396f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803973:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803976:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80397a:	44 89 e0             	mov    %r12d,%eax
+  80397d:	c1 e0 06             	shl    $0x6,%eax
+  803980:	25 80 00 00 00       	and    $0x80,%eax
+  803985:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803988:	09 f0                	or     %esi,%eax
+  80398a:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80398e:	41 f6 c4 08          	test   $0x8,%r12b
+  803992:	74 31                	je     8039c5 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803994:	48 39 d3             	cmp    %rdx,%rbx
+  803997:	73 2c                	jae    8039c5 <mmap+0x1ea>
+  803999:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80399e:	48 89 de             	mov    %rbx,%rsi
+  8039a1:	4c 89 f7             	mov    %r14,%rdi
+  8039a4:	48 b8 e5 25 80 00 00 	movabs $0x8025e5,%rax
+  8039ab:	00 00 00 
+  8039ae:	ff d0                	call   *%rax
+  8039b0:	49 89 c4             	mov    %rax,%r12
+  8039b3:	48 85 c0             	test   %rax,%rax
+  8039b6:	0f 8e d7 00 00 00    	jle    803a93 <mmap+0x2b8>
+            va += n;
+  8039bc:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8039bf:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8039c3:	72 d4                	jb     803999 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8039c5:	49 8b 06             	mov    (%r14),%rax
+  8039c8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8039cc:	48 89 06             	mov    %rax,(%rsi)
+}
+  8039cf:	44 89 f8             	mov    %r15d,%eax
+  8039d2:	48 83 c4 28          	add    $0x28,%rsp
+  8039d6:	5b                   	pop    %rbx
+  8039d7:	41 5c                	pop    %r12
+  8039d9:	41 5d                	pop    %r13
+  8039db:	41 5e                	pop    %r14
+  8039dd:	41 5f                	pop    %r15
+  8039df:	5d                   	pop    %rbp
+  8039e0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039e1:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8039e8:	00 00 00 
+  8039eb:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8039ee:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8039f5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039f8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039fd:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803a04:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a07:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803a0e:	00 00 00 
+  803a11:	48 39 d7             	cmp    %rdx,%rdi
+  803a14:	73 1c                	jae    803a32 <mmap+0x257>
+        return -E_NO_MEM;
+  803a16:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a1c:	eb b1                	jmp    8039cf <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a1e:	48 83 c0 01          	add    $0x1,%rax
+  803a22:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a26:	77 3f                	ja     803a67 <mmap+0x28c>
+  803a28:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803a2d:	48 39 d7             	cmp    %rdx,%rdi
+  803a30:	72 2a                	jb     803a5c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a32:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a36:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a3a:	48 39 d1             	cmp    %rdx,%rcx
+  803a3d:	73 df                	jae    803a1e <mmap+0x243>
+  803a3f:	48 85 c9             	test   %rcx,%rcx
+  803a42:	74 da                	je     803a1e <mmap+0x243>
+  803a44:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a48:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a4d:	48 39 d3             	cmp    %rdx,%rbx
+  803a50:	73 cc                	jae    803a1e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803a52:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a55:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a5a:	eb cc                	jmp    803a28 <mmap+0x24d>
+        return -E_NO_MEM;
+  803a5c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a62:	e9 68 ff ff ff       	jmp    8039cf <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803a67:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803a6c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803a73:	00 00 00 
+  803a76:	48 39 c2             	cmp    %rax,%rdx
+  803a79:	0f 82 9f 00 00 00    	jb     803b1e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803a7f:	48 85 db             	test   %rbx,%rbx
+  803a82:	0f 85 8a fe ff ff    	jne    803912 <mmap+0x137>
+        return -E_NO_MEM;
+  803a88:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a8e:	e9 3c ff ff ff       	jmp    8039cf <mmap+0x1f4>
+        if (n < 0) {
+  803a93:	0f 89 2c ff ff ff    	jns    8039c5 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803a99:	49 8b 3e             	mov    (%r14),%rdi
+  803a9c:	4c 89 ee             	mov    %r13,%rsi
+  803a9f:	48 b8 5e 36 80 00 00 	movabs $0x80365e,%rax
+  803aa6:	00 00 00 
+  803aa9:	ff d0                	call   *%rax
+            return n;
+  803aab:	45 89 e7             	mov    %r12d,%r15d
+  803aae:	e9 1c ff ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803ab3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ab9:	e9 11 ff ff ff       	jmp    8039cf <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803abe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ac4:	e9 06 ff ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803ac9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803acf:	e9 fb fe ff ff       	jmp    8039cf <mmap+0x1f4>
+  803ad4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ada:	e9 f0 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803adf:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ae5:	e9 e5 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803aea:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803af0:	e9 da fe ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803af5:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803afb:	e9 cf fe ff ff       	jmp    8039cf <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b00:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b06:	e9 c4 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+  803b0b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b11:	e9 b9 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803b16:	41 89 c7             	mov    %eax,%r15d
+  803b19:	e9 b1 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+        return -E_NO_MEM;
+  803b1e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b24:	e9 a6 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803b29:	41 89 c7             	mov    %eax,%r15d
+  803b2c:	e9 9e fe ff ff       	jmp    8039cf <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b31:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b37:	e9 93 fe ff ff       	jmp    8039cf <mmap+0x1f4>
+
+0000000000803b3c <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803b3c:	55                   	push   %rbp
+  803b3d:	48 89 e5             	mov    %rsp,%rbp
+  803b40:	41 55                	push   %r13
+  803b42:	41 54                	push   %r12
+  803b44:	53                   	push   %rbx
+  803b45:	48 83 ec 08          	sub    $0x8,%rsp
+  803b49:	48 89 fb             	mov    %rdi,%rbx
+  803b4c:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803b4f:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803b52:	48 b8 b8 4b 80 00 00 	movabs $0x804bb8,%rax
+  803b59:	00 00 00 
+  803b5c:	ff d0                	call   *%rax
+  803b5e:	41 89 c1             	mov    %eax,%r9d
+  803b61:	4d 89 e0             	mov    %r12,%r8
+  803b64:	49 29 d8             	sub    %rbx,%r8
+  803b67:	48 89 d9             	mov    %rbx,%rcx
+  803b6a:	44 89 ea             	mov    %r13d,%edx
+  803b6d:	48 89 de             	mov    %rbx,%rsi
+  803b70:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b75:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  803b7c:	00 00 00 
+  803b7f:	ff d0                	call   *%rax
+    return 0;
+}
+  803b81:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b86:	48 83 c4 08          	add    $0x8,%rsp
+  803b8a:	5b                   	pop    %rbx
+  803b8b:	41 5c                	pop    %r12
+  803b8d:	41 5d                	pop    %r13
+  803b8f:	5d                   	pop    %rbp
+  803b90:	c3                   	ret
+
+0000000000803b91 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803b91:	55                   	push   %rbp
+  803b92:	48 89 e5             	mov    %rsp,%rbp
+  803b95:	41 57                	push   %r15
+  803b97:	41 56                	push   %r14
+  803b99:	41 55                	push   %r13
+  803b9b:	41 54                	push   %r12
+  803b9d:	53                   	push   %rbx
+  803b9e:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803ba5:	48 89 fb             	mov    %rdi,%rbx
+  803ba8:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803bab:	48 b8 56 33 80 00 00 	movabs $0x803356,%rax
+  803bb2:	00 00 00 
+  803bb5:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  803bb7:	be 00 00 00 00       	mov    $0x0,%esi
+  803bbc:	48 89 df             	mov    %rbx,%rdi
+  803bbf:	48 b8 95 32 80 00 00 	movabs $0x803295,%rax
+  803bc6:	00 00 00 
+  803bc9:	ff d0                	call   *%rax
+  803bcb:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803bd1:	85 c0                	test   %eax,%eax
+  803bd3:	0f 88 06 04 00 00    	js     803fdf <spawn+0x44e>
+  803bd9:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803bdb:	ba 00 02 00 00       	mov    $0x200,%edx
+  803be0:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803be7:	48 b8 71 1e 80 00 00 	movabs $0x801e71,%rax
+  803bee:	00 00 00 
+  803bf1:	ff d0                	call   *%rax
+  803bf3:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803bf5:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803bfa:	0f 85 93 02 00 00    	jne    803e93 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803c00:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803c07:	ff ff 00 
+  803c0a:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803c11:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803c18:	01 01 00 
+  803c1b:	48 39 d0             	cmp    %rdx,%rax
+  803c1e:	0f 85 ab 02 00 00    	jne    803ecf <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803c24:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803c2b:	00 3e 00 
+  803c2e:	0f 85 9b 02 00 00    	jne    803ecf <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  803c34:	b8 08 00 00 00       	mov    $0x8,%eax
+  803c39:	0f 05                	syscall
+  803c3b:	41 89 c6             	mov    %eax,%r14d
+  803c3e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803c44:	85 c0                	test   %eax,%eax
+  803c46:	0f 88 75 03 00 00    	js     803fc1 <spawn+0x430>
+    envid_t child = res;
+  803c4c:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803c52:	89 c2                	mov    %eax,%edx
+  803c54:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803c5a:	48 89 d0             	mov    %rdx,%rax
+  803c5d:	48 c1 e0 04          	shl    $0x4,%rax
+  803c61:	48 29 d0             	sub    %rdx,%rax
+  803c64:	48 c1 e0 05          	shl    $0x5,%rax
+  803c68:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803c6f:	00 00 00 
+  803c72:	48 01 c6             	add    %rax,%rsi
+  803c75:	48 8b 06             	mov    (%rsi),%rax
+  803c78:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803c7f:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803c86:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803c8d:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803c94:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803c9b:	48 29 ce             	sub    %rcx,%rsi
+  803c9e:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803ca4:	c1 e9 03             	shr    $0x3,%ecx
+  803ca7:	89 c9                	mov    %ecx,%ecx
+  803ca9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803cac:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803cb3:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803cba:	49 8b 3c 24          	mov    (%r12),%rdi
+  803cbe:	48 85 ff             	test   %rdi,%rdi
+  803cc1:	0f 84 d6 05 00 00    	je     80429d <spawn+0x70c>
+  803cc7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803ccd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803cd3:	48 bb 72 10 80 00 00 	movabs $0x801072,%rbx
+  803cda:	00 00 00 
+  803cdd:	ff d3                	call   *%rbx
+  803cdf:	4c 01 f8             	add    %r15,%rax
+  803ce2:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803ce6:	4c 89 ea             	mov    %r13,%rdx
+  803ce9:	49 83 c5 01          	add    $0x1,%r13
+  803ced:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803cf2:	48 85 ff             	test   %rdi,%rdi
+  803cf5:	75 e6                	jne    803cdd <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803cf7:	49 89 d5             	mov    %rdx,%r13
+  803cfa:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803d01:	48 f7 d0             	not    %rax
+  803d04:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803d0b:	49 89 df             	mov    %rbx,%r15
+  803d0e:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803d12:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803d19:	89 d0                	mov    %edx,%eax
+  803d1b:	83 c0 01             	add    $0x1,%eax
+  803d1e:	48 98                	cltq
+  803d20:	48 c1 e0 03          	shl    $0x3,%rax
+  803d24:	49 29 c7             	sub    %rax,%r15
+  803d27:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803d2e:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803d32:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803d38:	0f 86 4f 05 00 00    	jbe    80428d <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803d3e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803d43:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803d48:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d4d:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  803d54:	00 00 00 
+  803d57:	ff d0                	call   *%rax
+  803d59:	85 c0                	test   %eax,%eax
+  803d5b:	0f 88 31 05 00 00    	js     804292 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  803d61:	4c 89 e8             	mov    %r13,%rax
+  803d64:	45 85 ed             	test   %r13d,%r13d
+  803d67:	7e 65                	jle    803dce <spawn+0x23d>
+  803d69:	4d 89 fd             	mov    %r15,%r13
+  803d6c:	48 98                	cltq
+  803d6e:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803d72:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803d79:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803d7c:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803d83:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803d86:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803d8d:	ff 
+  803d8e:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803d92:	49 8b 34 24          	mov    (%r12),%rsi
+  803d96:	48 89 df             	mov    %rbx,%rdi
+  803d99:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  803da0:	00 00 00 
+  803da3:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803da5:	49 8b 3c 24          	mov    (%r12),%rdi
+  803da9:	48 b8 72 10 80 00 00 	movabs $0x801072,%rax
+  803db0:	00 00 00 
+  803db3:	ff d0                	call   *%rax
+  803db5:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803dba:	49 83 c5 08          	add    $0x8,%r13
+  803dbe:	49 83 c4 08          	add    $0x8,%r12
+  803dc2:	4d 39 ee             	cmp    %r13,%r14
+  803dc5:	75 bf                	jne    803d86 <spawn+0x1f5>
+  803dc7:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803dce:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803dd5:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803ddc:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803ddd:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803de4:	0f 85 2c 01 00 00    	jne    803f16 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803dea:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803df1:	00 00 00 
+  803df4:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803dfb:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803e02:	ff 
+  803e03:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803e07:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803e0e:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803e12:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803e19:	00 00 00 
+  803e1c:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803e23:	ff 
+  803e24:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803e2b:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803e31:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803e37:	44 89 f2             	mov    %r14d,%edx
+  803e3a:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e44:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  803e4b:	00 00 00 
+  803e4e:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803e50:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803e55:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e5f:	48 b8 66 4f 80 00 00 	movabs $0x804f66,%rax
+  803e66:	00 00 00 
+  803e69:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803e6b:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803e72:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803e79:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803e7a:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803e81:	00 
+  803e82:	0f 84 5d 03 00 00    	je     8041e5 <spawn+0x654>
+  803e88:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803e8e:	e9 1b 02 00 00       	jmp    8040ae <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803e93:	48 bf a0 5d 80 00 00 	movabs $0x805da0,%rdi
+  803e9a:	00 00 00 
+  803e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ea2:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  803ea9:	00 00 00 
+  803eac:	ff d2                	call   *%rdx
+        close(fd);
+  803eae:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803eb4:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803ebb:	00 00 00 
+  803ebe:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803ec0:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803ec7:	ff ff ff 
+  803eca:	e9 10 01 00 00       	jmp    803fdf <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803ecf:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803ed4:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803eda:	48 bf 57 5e 80 00 00 	movabs $0x805e57,%rdi
+  803ee1:	00 00 00 
+  803ee4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee9:	48 b9 8b 07 80 00 00 	movabs $0x80078b,%rcx
+  803ef0:	00 00 00 
+  803ef3:	ff d1                	call   *%rcx
+        close(fd);
+  803ef5:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803efb:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803f02:	00 00 00 
+  803f05:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803f07:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803f0e:	ff ff ff 
+  803f11:	e9 c9 00 00 00       	jmp    803fdf <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803f16:	48 b9 d0 5d 80 00 00 	movabs $0x805dd0,%rcx
+  803f1d:	00 00 00 
+  803f20:	48 ba 71 5e 80 00 00 	movabs $0x805e71,%rdx
+  803f27:	00 00 00 
+  803f2a:	be f9 00 00 00       	mov    $0xf9,%esi
+  803f2f:	48 bf 86 5e 80 00 00 	movabs $0x805e86,%rdi
+  803f36:	00 00 00 
+  803f39:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f3e:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  803f45:	00 00 00 
+  803f48:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803f4b:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803f4f:	48 29 f2             	sub    %rsi,%rdx
+  803f52:	89 d9                	mov    %ebx,%ecx
+  803f54:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803f5a:	48 b8 f7 4e 80 00 00 	movabs $0x804ef7,%rax
+  803f61:	00 00 00 
+  803f64:	ff d0                	call   *%rax
+  803f66:	e9 f0 01 00 00       	jmp    80415b <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803f6b:	89 c6                	mov    %eax,%esi
+  803f6d:	48 bf 00 5e 80 00 00 	movabs $0x805e00,%rdi
+  803f74:	00 00 00 
+  803f77:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f7c:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  803f83:	00 00 00 
+  803f86:	ff d2                	call   *%rdx
+    scring_discard();
+  803f88:	48 b8 d7 4e 80 00 00 	movabs $0x804ed7,%rax
+  803f8f:	00 00 00 
+  803f92:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803f94:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803f99:	be 00 00 40 00       	mov    $0x400000,%esi
+  803f9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fa3:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  803faa:	00 00 00 
+  803fad:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803faf:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803fb5:	48 b8 1f 15 80 00 00 	movabs $0x80151f,%rax
+  803fbc:	00 00 00 
+  803fbf:	ff d0                	call   *%rax
+    close(fd);
+  803fc1:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803fc7:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+    return res;
+  803fd3:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  803fd9:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  803fdf:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  803fe5:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  803fec:	5b                   	pop    %rbx
+  803fed:	41 5c                	pop    %r12
+  803fef:	41 5d                	pop    %r13
+  803ff1:	41 5e                	pop    %r14
+  803ff3:	41 5f                	pop    %r15
+  803ff5:	5d                   	pop    %rbp
+  803ff6:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  803ff7:	89 c6                	mov    %eax,%esi
+  803ff9:	48 bf 92 5e 80 00 00 	movabs $0x805e92,%rdi
+  804000:	00 00 00 
+  804003:	b8 00 00 00 00       	mov    $0x0,%eax
+  804008:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  80400f:	00 00 00 
+  804012:	ff d2                	call   *%rdx
+        return res;
+  804014:	e9 6f ff ff ff       	jmp    803f88 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  804019:	4c 89 e2             	mov    %r12,%rdx
+  80401c:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804023:	48 29 c2             	sub    %rax,%rdx
+  804026:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  80402d:	be 00 00 00 00       	mov    $0x0,%esi
+  804032:	48 b8 fc 11 80 00 00 	movabs $0x8011fc,%rax
+  804039:	00 00 00 
+  80403c:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80403e:	80 cb 80             	or     $0x80,%bl
+  804041:	41 89 d9             	mov    %ebx,%r9d
+  804044:	4d 89 e0             	mov    %r12,%r8
+  804047:	4c 89 f1             	mov    %r14,%rcx
+  80404a:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  804050:	be 00 00 40 00       	mov    $0x400000,%esi
+  804055:	bf 00 00 00 00       	mov    $0x0,%edi
+  80405a:	48 b8 2d 4f 80 00 00 	movabs $0x804f2d,%rax
+  804061:	00 00 00 
+  804064:	ff d0                	call   *%rax
+    res = scring_submit();
+  804066:	48 b8 8b 4e 80 00 00 	movabs $0x804e8b,%rax
+  80406d:	00 00 00 
+  804070:	ff d0                	call   *%rax
+  804072:	89 c3                	mov    %eax,%ebx
+  804074:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  80407a:	4c 89 e6             	mov    %r12,%rsi
+  80407d:	bf 00 00 40 00       	mov    $0x400000,%edi
+  804082:	48 b8 5e 36 80 00 00 	movabs $0x80365e,%rax
+  804089:	00 00 00 
+  80408c:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80408e:	85 db                	test   %ebx,%ebx
+  804090:	0f 88 f2 fe ff ff    	js     803f88 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804096:	49 83 c7 01          	add    $0x1,%r15
+  80409a:	49 83 c5 38          	add    $0x38,%r13
+  80409e:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8040a5:	49 39 c7             	cmp    %rax,%r15
+  8040a8:	0f 83 37 01 00 00    	jae    8041e5 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8040ae:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  8040b3:	75 e1                	jne    804096 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8040b5:	41 8b 45 04          	mov    0x4(%r13),%eax
+  8040b9:	89 c3                	mov    %eax,%ebx
+  8040bb:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8040be:	89 da                	mov    %ebx,%edx
+  8040c0:	83 ca 04             	or     $0x4,%edx
+  8040c3:	a8 04                	test   $0x4,%al
+  8040c5:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  8040c8:	89 da                	mov    %ebx,%edx
+  8040ca:	83 ca 01             	or     $0x1,%edx
+  8040cd:	a8 01                	test   $0x1,%al
+  8040cf:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8040d2:	49 8b 45 08          	mov    0x8(%r13),%rax
+  8040d6:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  8040dc:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  8040e0:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  8040e7:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  8040eb:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  8040f2:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  8040f6:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  8040fc:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  804102:	44 89 f2             	mov    %r14d,%edx
+  804105:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80410b:	74 22                	je     80412f <spawn+0x59e>
+        va -= res;
+  80410d:	48 63 ca             	movslq %edx,%rcx
+  804110:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  804113:	48 01 cf             	add    %rcx,%rdi
+  804116:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  80411d:	48 01 ce             	add    %rcx,%rsi
+  804120:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  804127:	29 d0                	sub    %edx,%eax
+  804129:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  80412f:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804136:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  80413d:	00 
+  80413e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804145:	49 89 f4             	mov    %rsi,%r12
+  804148:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  80414b:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804152:	49 39 c4             	cmp    %rax,%r12
+  804155:	0f 82 f0 fd ff ff    	jb     803f4b <spawn+0x3ba>
+    res = scring_submit();
+  80415b:	48 b8 8b 4e 80 00 00 	movabs $0x804e8b,%rax
+  804162:	00 00 00 
+  804165:	ff d0                	call   *%rax
+  804167:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  80416d:	85 c0                	test   %eax,%eax
+  80416f:	0f 88 f6 fd ff ff    	js     803f6b <spawn+0x3da>
+    if (!filesz) return 0;
+  804175:	4d 85 e4             	test   %r12,%r12
+  804178:	0f 84 18 ff ff ff    	je     804096 <spawn+0x505>
+    void *addr = UTEMP;
+  80417e:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  804185:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  804189:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  804190:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  804197:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80419c:	ba 06 00 00 00       	mov    $0x6,%edx
+  8041a1:	4c 89 e6             	mov    %r12,%rsi
+  8041a4:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  8041ab:	48 b8 db 37 80 00 00 	movabs $0x8037db,%rax
+  8041b2:	00 00 00 
+  8041b5:	ff d0                	call   *%rax
+  8041b7:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  8041bd:	85 c0                	test   %eax,%eax
+  8041bf:	0f 88 32 fe ff ff    	js     803ff7 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  8041c5:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8041cc:	49 39 c4             	cmp    %rax,%r12
+  8041cf:	49 0f 46 c4          	cmovbe %r12,%rax
+  8041d3:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  8041da:	0f 83 5e fe ff ff    	jae    80403e <spawn+0x4ad>
+  8041e0:	e9 34 fe ff ff       	jmp    804019 <spawn+0x488>
+    close(fd);
+  8041e5:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  8041eb:	48 b8 35 1c 80 00 00 	movabs $0x801c35,%rax
+  8041f2:	00 00 00 
+  8041f5:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  8041f7:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  8041fe:	48 bf 3c 3b 80 00 00 	movabs $0x803b3c,%rdi
+  804205:	00 00 00 
+  804208:	48 b8 2c 4c 80 00 00 	movabs $0x804c2c,%rax
+  80420f:	00 00 00 
+  804212:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  804214:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80421b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804221:	48 b8 d7 4f 80 00 00 	movabs $0x804fd7,%rax
+  804228:	00 00 00 
+  80422b:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  80422d:	be 02 00 00 00       	mov    $0x2,%esi
+  804232:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804238:	48 b8 9f 4f 80 00 00 	movabs $0x804f9f,%rax
+  80423f:	00 00 00 
+  804242:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  804244:	48 b8 8b 4e 80 00 00 	movabs $0x804e8b,%rax
+  80424b:	00 00 00 
+  80424e:	ff d0                	call   *%rax
+  804250:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804256:	85 c0                	test   %eax,%eax
+  804258:	78 11                	js     80426b <spawn+0x6da>
+    return child;
+  80425a:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  804260:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  804266:	e9 74 fd ff ff       	jmp    803fdf <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  80426b:	89 c6                	mov    %eax,%esi
+  80426d:	48 bf 30 5e 80 00 00 	movabs $0x805e30,%rdi
+  804274:	00 00 00 
+  804277:	b8 00 00 00 00       	mov    $0x0,%eax
+  80427c:	48 ba 8b 07 80 00 00 	movabs $0x80078b,%rdx
+  804283:	00 00 00 
+  804286:	ff d2                	call   *%rdx
+        goto error;
+  804288:	e9 fb fc ff ff       	jmp    803f88 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80428d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804292:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804298:	e9 eb fc ff ff       	jmp    803f88 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80429d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8042a2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8042a7:	be 00 00 40 00       	mov    $0x400000,%esi
+  8042ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042b1:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  8042b8:	00 00 00 
+  8042bb:	ff d0                	call   *%rax
+  8042bd:	85 c0                	test   %eax,%eax
+  8042bf:	78 d1                	js     804292 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8042c1:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8042c8:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8042cc:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  8042d3:	f8 ff 40 00 
+  8042d7:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8042de:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8042e2:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8042e7:	e9 e2 fa ff ff       	jmp    803dce <spawn+0x23d>
+
+00000000008042ec <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8042ec:	55                   	push   %rbp
+  8042ed:	48 89 e5             	mov    %rsp,%rbp
+  8042f0:	48 83 ec 50          	sub    $0x50,%rsp
+  8042f4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8042f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8042fc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804300:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804304:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80430b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80430f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804313:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804317:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80431b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804320:	eb 15                	jmp    804337 <spawnl+0x4b>
+  804322:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804326:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80432a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80432e:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804332:	74 1c                	je     804350 <spawnl+0x64>
+  804334:	83 c1 01             	add    $0x1,%ecx
+  804337:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80433a:	83 f8 2f             	cmp    $0x2f,%eax
+  80433d:	77 e3                	ja     804322 <spawnl+0x36>
+  80433f:	89 c2                	mov    %eax,%edx
+  804341:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804345:	4c 01 d2             	add    %r10,%rdx
+  804348:	83 c0 08             	add    $0x8,%eax
+  80434b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80434e:	eb de                	jmp    80432e <spawnl+0x42>
+    const char *argv[argc + 2];
+  804350:	8d 41 02             	lea    0x2(%rcx),%eax
+  804353:	48 98                	cltq
+  804355:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80435c:	00 
+  80435d:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  804361:	48 29 c4             	sub    %rax,%rsp
+  804364:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  804369:	4c 89 c0             	mov    %r8,%rax
+  80436c:	48 c1 e8 03          	shr    $0x3,%rax
+  804370:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  804374:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80437b:	00 
+    argv[argc + 1] = NULL;
+  80437c:	8d 41 01             	lea    0x1(%rcx),%eax
+  80437f:	48 98                	cltq
+  804381:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  804388:	00 
+    va_start(vl, arg0);
+  804389:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804390:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804394:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804398:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80439c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8043a0:	85 c9                	test   %ecx,%ecx
+  8043a2:	74 41                	je     8043e5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8043a4:	49 89 c1             	mov    %rax,%r9
+  8043a7:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8043ab:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8043ae:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8043b3:	eb 1b                	jmp    8043d0 <spawnl+0xe4>
+  8043b5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8043b9:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8043bd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8043c1:	48 8b 11             	mov    (%rcx),%rdx
+  8043c4:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8043c7:	48 83 c0 08          	add    $0x8,%rax
+  8043cb:	48 39 f0             	cmp    %rsi,%rax
+  8043ce:	74 15                	je     8043e5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8043d0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8043d3:	83 fa 2f             	cmp    $0x2f,%edx
+  8043d6:	77 dd                	ja     8043b5 <spawnl+0xc9>
+  8043d8:	89 d1                	mov    %edx,%ecx
+  8043da:	4c 01 c9             	add    %r9,%rcx
+  8043dd:	83 c2 08             	add    $0x8,%edx
+  8043e0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8043e3:	eb dc                	jmp    8043c1 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8043e5:	4c 89 c6             	mov    %r8,%rsi
+  8043e8:	48 b8 91 3b 80 00 00 	movabs $0x803b91,%rax
+  8043ef:	00 00 00 
+  8043f2:	ff d0                	call   *%rax
+}
+  8043f4:	c9                   	leave
+  8043f5:	c3                   	ret
+
+00000000008043f6 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8043f6:	55                   	push   %rbp
+  8043f7:	48 89 e5             	mov    %rsp,%rbp
+  8043fa:	41 54                	push   %r12
+  8043fc:	53                   	push   %rbx
+  8043fd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804400:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  804407:	00 00 00 
+  80440a:	ff d0                	call   *%rax
+  80440c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80440f:	48 be af 5e 80 00 00 	movabs $0x805eaf,%rsi
+  804416:	00 00 00 
+  804419:	48 89 df             	mov    %rbx,%rdi
+  80441c:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  804423:	00 00 00 
+  804426:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804428:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80442d:	41 2b 04 24          	sub    (%r12),%eax
+  804431:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804437:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80443e:	00 00 00 
+    stat->st_dev = &devpipe;
+  804441:	48 b8 20 78 80 00 00 	movabs $0x807820,%rax
+  804448:	00 00 00 
+  80444b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804452:	b8 00 00 00 00       	mov    $0x0,%eax
+  804457:	5b                   	pop    %rbx
+  804458:	41 5c                	pop    %r12
+  80445a:	5d                   	pop    %rbp
+  80445b:	c3                   	ret
+
+000000000080445c <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80445c:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80445f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  804465:	8b 17                	mov    (%rdi),%edx
+  804467:	85 d2                	test   %edx,%edx
+  804469:	75 01                	jne    80446c <pipe_wakeup+0x10>
+  80446b:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80446c:	55                   	push   %rbp
+  80446d:	48 89 e5             	mov    %rsp,%rbp
+  804470:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  804473:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  804479:	be 00 04 00 00       	mov    $0x400,%esi
+  80447e:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  804485:	00 00 00 
+  804488:	ff d0                	call   *%rax
+}
+  80448a:	5d                   	pop    %rbp
+  80448b:	c3                   	ret
+
+000000000080448c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80448c:	55                   	push   %rbp
+  80448d:	48 89 e5             	mov    %rsp,%rbp
+  804490:	41 55                	push   %r13
+  804492:	41 54                	push   %r12
+  804494:	53                   	push   %rbx
+  804495:	48 83 ec 08          	sub    $0x8,%rsp
+  804499:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80449c:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8044a3:	00 00 00 
+  8044a6:	ff d0                	call   *%rax
+  8044a8:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8044ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044b0:	4c 89 e6             	mov    %r12,%rsi
+  8044b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044b8:	49 bc b5 16 80 00 00 	movabs $0x8016b5,%r12
+  8044bf:	00 00 00 
+  8044c2:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8044c5:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8044c9:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8044cd:	49 bd 5c 44 80 00 00 	movabs $0x80445c,%r13
+  8044d4:	00 00 00 
+  8044d7:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8044da:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8044de:	48 89 de             	mov    %rbx,%rsi
+  8044e1:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8044e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044e9:	48 89 de             	mov    %rbx,%rsi
+  8044ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044f1:	41 ff d4             	call   *%r12
+  8044f4:	48 83 c4 08          	add    $0x8,%rsp
+  8044f8:	5b                   	pop    %rbx
+  8044f9:	41 5c                	pop    %r12
+  8044fb:	41 5d                	pop    %r13
+  8044fd:	5d                   	pop    %rbp
+  8044fe:	c3                   	ret
+
+00000000008044ff <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8044ff:	55                   	push   %rbp
+  804500:	48 89 e5             	mov    %rsp,%rbp
+  804503:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804506:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80450b:	be 00 10 00 00       	mov    $0x1000,%esi
+  804510:	48 b8 f8 15 80 00 00 	movabs $0x8015f8,%rax
+  804517:	00 00 00 
+  80451a:	ff d0                	call   *%rax
+  80451c:	85 c0                	test   %eax,%eax
+  80451e:	0f 94 c0             	sete   %al
+  804521:	0f b6 c0             	movzbl %al,%eax
+}
+  804524:	5d                   	pop    %rbp
+  804525:	c3                   	ret
+
+0000000000804526 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804526:	55                   	push   %rbp
+  804527:	48 89 e5             	mov    %rsp,%rbp
+  80452a:	41 57                	push   %r15
+  80452c:	41 56                	push   %r14
+  80452e:	41 55                	push   %r13
+  804530:	41 54                	push   %r12
+  804532:	53                   	push   %rbx
+  804533:	48 83 ec 38          	sub    $0x38,%rsp
+  804537:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80453b:	49 89 f4             	mov    %rsi,%r12
+  80453e:	49 89 d7             	mov    %rdx,%r15
+  804541:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804545:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  80454c:	00 00 00 
+  80454f:	ff d0                	call   *%rax
+  804551:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804554:	4d 85 ff             	test   %r15,%r15
+  804557:	0f 84 f1 00 00 00    	je     80464e <devpipe_write+0x128>
+  80455d:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  804561:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  804565:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  804569:	49 bd ff 44 80 00 00 	movabs $0x8044ff,%r13
+  804570:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804573:	49 bf 5c 44 80 00 00 	movabs $0x80445c,%r15
+  80457a:	00 00 00 
+  80457d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804581:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804585:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  804589:	8b 73 04             	mov    0x4(%rbx),%esi
+  80458c:	48 63 ce             	movslq %esi,%rcx
+  80458f:	48 63 03             	movslq (%rbx),%rax
+  804592:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804598:	48 39 c1             	cmp    %rax,%rcx
+  80459b:	72 64                	jb     804601 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80459d:	48 89 de             	mov    %rbx,%rsi
+  8045a0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8045a4:	41 ff d5             	call   *%r13
+  8045a7:	85 c0                	test   %eax,%eax
+  8045a9:	0f 85 b9 00 00 00    	jne    804668 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8045af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8045b3:	4c 89 f7             	mov    %r14,%rdi
+  8045b6:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8045b9:	8b 43 04             	mov    0x4(%rbx),%eax
+  8045bc:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8045c3:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045ca:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8045d0:	8b 03                	mov    (%rbx),%eax
+  8045d2:	41 39 c4             	cmp    %eax,%r12d
+  8045d5:	75 b2                	jne    804589 <devpipe_write+0x63>
+  8045d7:	48 89 de             	mov    %rbx,%rsi
+  8045da:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8045de:	41 ff d5             	call   *%r13
+  8045e1:	85 c0                	test   %eax,%eax
+  8045e3:	75 a0                	jne    804585 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8045e5:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8045ea:	44 89 e6             	mov    %r12d,%esi
+  8045ed:	48 89 df             	mov    %rbx,%rdi
+  8045f0:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8045f7:	00 00 00 
+  8045fa:	ff d0                	call   *%rax
+  8045fc:	e9 7c ff ff ff       	jmp    80457d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804601:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804605:	41 0f b6 38          	movzbl (%r8),%edi
+  804609:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804610:	80 80 80 
+  804613:	48 89 c8             	mov    %rcx,%rax
+  804616:	48 f7 e2             	mul    %rdx
+  804619:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80461d:	48 89 d0             	mov    %rdx,%rax
+  804620:	48 c1 e0 08          	shl    $0x8,%rax
+  804624:	48 29 d0             	sub    %rdx,%rax
+  804627:	48 c1 e0 04          	shl    $0x4,%rax
+  80462b:	48 29 c1             	sub    %rax,%rcx
+  80462e:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804633:	83 c6 01             	add    $0x1,%esi
+  804636:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  804639:	49 83 c0 01          	add    $0x1,%r8
+  80463d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804641:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804645:	49 39 c0             	cmp    %rax,%r8
+  804648:	0f 85 2f ff ff ff    	jne    80457d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80464e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804652:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804656:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  80465d:	00 00 00 
+  804660:	ff d0                	call   *%rax
+    return n;
+  804662:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  804666:	eb 05                	jmp    80466d <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  804668:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80466d:	48 83 c4 38          	add    $0x38,%rsp
+  804671:	5b                   	pop    %rbx
+  804672:	41 5c                	pop    %r12
+  804674:	41 5d                	pop    %r13
+  804676:	41 5e                	pop    %r14
+  804678:	41 5f                	pop    %r15
+  80467a:	5d                   	pop    %rbp
+  80467b:	c3                   	ret
+
+000000000080467c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80467c:	55                   	push   %rbp
+  80467d:	48 89 e5             	mov    %rsp,%rbp
+  804680:	41 57                	push   %r15
+  804682:	41 56                	push   %r14
+  804684:	41 55                	push   %r13
+  804686:	41 54                	push   %r12
+  804688:	53                   	push   %rbx
+  804689:	48 83 ec 28          	sub    $0x28,%rsp
+  80468d:	49 89 fd             	mov    %rdi,%r13
+  804690:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  804694:	49 89 d4             	mov    %rdx,%r12
+  804697:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80469b:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8046a2:	00 00 00 
+  8046a5:	ff d0                	call   *%rax
+  8046a7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046aa:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8046b0:	49 bf ff 44 80 00 00 	movabs $0x8044ff,%r15
+  8046b7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8046ba:	4d 85 e4             	test   %r12,%r12
+  8046bd:	0f 84 d5 00 00 00    	je     804798 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8046c3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8046c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8046cb:	8b 03                	mov    (%rbx),%eax
+  8046cd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8046d0:	75 7a                	jne    80474c <devpipe_read+0xd0>
+            if (i > 0) {
+  8046d2:	4d 85 f6             	test   %r14,%r14
+  8046d5:	75 50                	jne    804727 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046d7:	48 89 de             	mov    %rbx,%rsi
+  8046da:	4c 89 ef             	mov    %r13,%rdi
+  8046dd:	41 ff d7             	call   *%r15
+  8046e0:	85 c0                	test   %eax,%eax
+  8046e2:	0f 85 c9 00 00 00    	jne    8047b1 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8046e8:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  8046eb:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8046f2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8046f8:	8b 43 04             	mov    0x4(%rbx),%eax
+  8046fb:	41 39 c4             	cmp    %eax,%r12d
+  8046fe:	75 cb                	jne    8046cb <devpipe_read+0x4f>
+  804700:	48 89 de             	mov    %rbx,%rsi
+  804703:	4c 89 ef             	mov    %r13,%rdi
+  804706:	41 ff d7             	call   *%r15
+  804709:	85 c0                	test   %eax,%eax
+  80470b:	75 be                	jne    8046cb <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80470d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804712:	44 89 e6             	mov    %r12d,%esi
+  804715:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804719:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  804720:	00 00 00 
+  804723:	ff d0                	call   *%rax
+  804725:	eb a4                	jmp    8046cb <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804727:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80472b:	48 89 de             	mov    %rbx,%rsi
+  80472e:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  804735:	00 00 00 
+  804738:	ff d0                	call   *%rax
+                return i;
+  80473a:	4c 89 f0             	mov    %r14,%rax
+}
+  80473d:	48 83 c4 28          	add    $0x28,%rsp
+  804741:	5b                   	pop    %rbx
+  804742:	41 5c                	pop    %r12
+  804744:	41 5d                	pop    %r13
+  804746:	41 5e                	pop    %r14
+  804748:	41 5f                	pop    %r15
+  80474a:	5d                   	pop    %rbp
+  80474b:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80474c:	48 63 c8             	movslq %eax,%rcx
+  80474f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804756:	80 80 80 
+  804759:	48 89 c8             	mov    %rcx,%rax
+  80475c:	48 f7 e2             	mul    %rdx
+  80475f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804763:	48 89 d0             	mov    %rdx,%rax
+  804766:	48 c1 e0 08          	shl    $0x8,%rax
+  80476a:	48 29 d0             	sub    %rdx,%rax
+  80476d:	48 c1 e0 04          	shl    $0x4,%rax
+  804771:	48 89 c2             	mov    %rax,%rdx
+  804774:	48 89 c8             	mov    %rcx,%rax
+  804777:	48 29 d0             	sub    %rdx,%rax
+  80477a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80477f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804783:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  804787:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80478a:	49 83 c6 01          	add    $0x1,%r14
+  80478e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  804792:	0f 85 2b ff ff ff    	jne    8046c3 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804798:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80479c:	48 89 de             	mov    %rbx,%rsi
+  80479f:	48 b8 5c 44 80 00 00 	movabs $0x80445c,%rax
+  8047a6:	00 00 00 
+  8047a9:	ff d0                	call   *%rax
+    return n;
+  8047ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047af:	eb 8c                	jmp    80473d <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8047b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b6:	eb 85                	jmp    80473d <devpipe_read+0xc1>
+
+00000000008047b8 <pipe>:
+pipe(int pfd[2]) {
+  8047b8:	55                   	push   %rbp
+  8047b9:	48 89 e5             	mov    %rsp,%rbp
+  8047bc:	41 55                	push   %r13
+  8047be:	41 54                	push   %r12
+  8047c0:	53                   	push   %rbx
+  8047c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8047c5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8047c8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8047cc:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  8047d3:	00 00 00 
+  8047d6:	ff d0                	call   *%rax
+  8047d8:	89 c3                	mov    %eax,%ebx
+  8047da:	85 c0                	test   %eax,%eax
+  8047dc:	0f 88 a0 01 00 00    	js     804982 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8047e2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8047e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047ec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8047f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8047f5:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  8047fc:	00 00 00 
+  8047ff:	ff d0                	call   *%rax
+  804801:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804803:	85 c0                	test   %eax,%eax
+  804805:	0f 88 77 01 00 00    	js     804982 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80480b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80480f:	48 b8 70 1a 80 00 00 	movabs $0x801a70,%rax
+  804816:	00 00 00 
+  804819:	ff d0                	call   *%rax
+  80481b:	89 c3                	mov    %eax,%ebx
+  80481d:	85 c0                	test   %eax,%eax
+  80481f:	0f 88 43 01 00 00    	js     804968 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804825:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80482a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80482f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804833:	bf 00 00 00 00       	mov    $0x0,%edi
+  804838:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  80483f:	00 00 00 
+  804842:	ff d0                	call   *%rax
+  804844:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804846:	85 c0                	test   %eax,%eax
+  804848:	0f 88 1a 01 00 00    	js     804968 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80484e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804852:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  804859:	00 00 00 
+  80485c:	ff d0                	call   *%rax
+  80485e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  804861:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804866:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80486b:	48 89 c6             	mov    %rax,%rsi
+  80486e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804873:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  80487a:	00 00 00 
+  80487d:	ff d0                	call   *%rax
+  80487f:	89 c3                	mov    %eax,%ebx
+  804881:	85 c0                	test   %eax,%eax
+  804883:	0f 88 c5 00 00 00    	js     80494e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  804889:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80488d:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  804894:	00 00 00 
+  804897:	ff d0                	call   *%rax
+  804899:	48 89 c1             	mov    %rax,%rcx
+  80489c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8048a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ad:	4c 89 ee             	mov    %r13,%rsi
+  8048b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b5:	48 b8 65 16 80 00 00 	movabs $0x801665,%rax
+  8048bc:	00 00 00 
+  8048bf:	ff d0                	call   *%rax
+  8048c1:	89 c3                	mov    %eax,%ebx
+  8048c3:	85 c0                	test   %eax,%eax
+  8048c5:	78 6e                	js     804935 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8048c7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048cc:	4c 89 ef             	mov    %r13,%rdi
+  8048cf:	48 b8 d4 15 80 00 00 	movabs $0x8015d4,%rax
+  8048d6:	00 00 00 
+  8048d9:	ff d0                	call   *%rax
+  8048db:	83 f8 02             	cmp    $0x2,%eax
+  8048de:	0f 85 ab 00 00 00    	jne    80498f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8048e4:	a1 20 78 80 00 00 00 	movabs 0x807820,%eax
+  8048eb:	00 00 
+  8048ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048f1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8048f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8048f7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8048fe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804902:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804904:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804908:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80490f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804913:	48 bb 42 1a 80 00 00 	movabs $0x801a42,%rbx
+  80491a:	00 00 00 
+  80491d:	ff d3                	call   *%rbx
+  80491f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804923:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804927:	ff d3                	call   *%rbx
+  804929:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80492e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804933:	eb 4d                	jmp    804982 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804935:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80493a:	4c 89 ee             	mov    %r13,%rsi
+  80493d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804942:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  804949:	00 00 00 
+  80494c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80494e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804953:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804957:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495c:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  804963:	00 00 00 
+  804966:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804968:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80496d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804971:	bf 00 00 00 00       	mov    $0x0,%edi
+  804976:	48 b8 b5 16 80 00 00 	movabs $0x8016b5,%rax
+  80497d:	00 00 00 
+  804980:	ff d0                	call   *%rax
+}
+  804982:	89 d8                	mov    %ebx,%eax
+  804984:	48 83 c4 18          	add    $0x18,%rsp
+  804988:	5b                   	pop    %rbx
+  804989:	41 5c                	pop    %r12
+  80498b:	41 5d                	pop    %r13
+  80498d:	5d                   	pop    %rbp
+  80498e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80498f:	48 b9 c8 5e 80 00 00 	movabs $0x805ec8,%rcx
+  804996:	00 00 00 
+  804999:	48 ba 71 5e 80 00 00 	movabs $0x805e71,%rdx
+  8049a0:	00 00 00 
+  8049a3:	be 50 00 00 00       	mov    $0x50,%esi
+  8049a8:	48 bf b6 5e 80 00 00 	movabs $0x805eb6,%rdi
+  8049af:	00 00 00 
+  8049b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049b7:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  8049be:	00 00 00 
+  8049c1:	41 ff d0             	call   *%r8
+
+00000000008049c4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8049c4:	55                   	push   %rbp
+  8049c5:	48 89 e5             	mov    %rsp,%rbp
+  8049c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8049cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8049d0:	48 b8 d0 1a 80 00 00 	movabs $0x801ad0,%rax
+  8049d7:	00 00 00 
+  8049da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8049dc:	85 c0                	test   %eax,%eax
+  8049de:	78 23                	js     804a03 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8049e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049e4:	48 b8 54 1a 80 00 00 	movabs $0x801a54,%rax
+  8049eb:	00 00 00 
+  8049ee:	ff d0                	call   *%rax
+  8049f0:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8049f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8049f7:	48 b8 ff 44 80 00 00 	movabs $0x8044ff,%rax
+  8049fe:	00 00 00 
+  804a01:	ff d0                	call   *%rax
+}
+  804a03:	c9                   	leave
+  804a04:	c3                   	ret
+
+0000000000804a05 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804a05:	55                   	push   %rbp
+  804a06:	48 89 e5             	mov    %rsp,%rbp
+  804a09:	41 56                	push   %r14
+  804a0b:	41 55                	push   %r13
+  804a0d:	41 54                	push   %r12
+  804a0f:	53                   	push   %rbx
+    assert(envid != 0);
+  804a10:	85 ff                	test   %edi,%edi
+  804a12:	0f 84 b7 00 00 00    	je     804acf <wait+0xca>
+  804a18:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804a1b:	89 f9                	mov    %edi,%ecx
+  804a1d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804a23:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804a2a:	00 00 00 
+  804a2d:	45 89 e0             	mov    %r12d,%r8d
+  804a30:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804a37:	4c 89 c0             	mov    %r8,%rax
+  804a3a:	48 c1 e0 04          	shl    $0x4,%rax
+  804a3e:	48 89 c2             	mov    %rax,%rdx
+  804a41:	4c 29 c2             	sub    %r8,%rdx
+  804a44:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a48:	48 01 fa             	add    %rdi,%rdx
+  804a4b:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804a51:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804a57:	41 39 c4             	cmp    %eax,%r12d
+  804a5a:	75 6a                	jne    804ac6 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804a5c:	48 63 d1             	movslq %ecx,%rdx
+  804a5f:	48 89 d0             	mov    %rdx,%rax
+  804a62:	48 c1 e0 04          	shl    $0x4,%rax
+  804a66:	48 29 d0             	sub    %rdx,%rax
+  804a69:	48 c1 e0 05          	shl    $0x5,%rax
+  804a6d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a74:	00 00 00 
+  804a77:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804a7e:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804a7f:	48 63 c9             	movslq %ecx,%rcx
+  804a82:	48 89 c8             	mov    %rcx,%rax
+  804a85:	48 c1 e0 04          	shl    $0x4,%rax
+  804a89:	48 29 c8             	sub    %rcx,%rax
+  804a8c:	48 c1 e0 05          	shl    $0x5,%rax
+  804a90:	48 89 d3             	mov    %rdx,%rbx
+  804a93:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804a96:	49 bd 7d 19 80 00 00 	movabs $0x80197d,%r13
+  804a9d:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804aa0:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804aa6:	85 c0                	test   %eax,%eax
+  804aa8:	74 1c                	je     804ac6 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804aaa:	ba 00 00 00 00       	mov    $0x0,%edx
+  804aaf:	4c 89 f7             	mov    %r14,%rdi
+  804ab2:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  804ab5:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804abb:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804ac1:	44 39 e0             	cmp    %r12d,%eax
+  804ac4:	74 da                	je     804aa0 <wait+0x9b>
+    }
+}
+  804ac6:	5b                   	pop    %rbx
+  804ac7:	41 5c                	pop    %r12
+  804ac9:	41 5d                	pop    %r13
+  804acb:	41 5e                	pop    %r14
+  804acd:	5d                   	pop    %rbp
+  804ace:	c3                   	ret
+    assert(envid != 0);
+  804acf:	48 b9 ec 5e 80 00 00 	movabs $0x805eec,%rcx
+  804ad6:	00 00 00 
+  804ad9:	48 ba 71 5e 80 00 00 	movabs $0x805e71,%rdx
+  804ae0:	00 00 00 
+  804ae3:	be 06 00 00 00       	mov    $0x6,%esi
+  804ae8:	48 bf f7 5e 80 00 00 	movabs $0x805ef7,%rdi
+  804aef:	00 00 00 
+  804af2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804af7:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  804afe:	00 00 00 
+  804b01:	41 ff d0             	call   *%r8
+
+0000000000804b04 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b04:	48 89 f8             	mov    %rdi,%rax
+  804b07:	48 c1 e8 27          	shr    $0x27,%rax
+  804b0b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b12:	01 00 00 
+  804b15:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b19:	f6 c2 01             	test   $0x1,%dl
+  804b1c:	74 6d                	je     804b8b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b1e:	48 89 f8             	mov    %rdi,%rax
+  804b21:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b25:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b2c:	01 00 00 
+  804b2f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b33:	f6 c2 01             	test   $0x1,%dl
+  804b36:	74 62                	je     804b9a <get_uvpt_entry+0x96>
+  804b38:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b3f:	01 00 00 
+  804b42:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b46:	f6 c2 80             	test   $0x80,%dl
+  804b49:	75 4f                	jne    804b9a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804b4b:	48 89 f8             	mov    %rdi,%rax
+  804b4e:	48 c1 e8 15          	shr    $0x15,%rax
+  804b52:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b59:	01 00 00 
+  804b5c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b60:	f6 c2 01             	test   $0x1,%dl
+  804b63:	74 44                	je     804ba9 <get_uvpt_entry+0xa5>
+  804b65:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b6c:	01 00 00 
+  804b6f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b73:	f6 c2 80             	test   $0x80,%dl
+  804b76:	75 31                	jne    804ba9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804b78:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804b7c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804b83:	01 00 00 
+  804b86:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804b8a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b8b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b92:	01 00 00 
+  804b95:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804b99:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b9a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804ba1:	01 00 00 
+  804ba4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804ba8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804ba9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bb0:	01 00 00 
+  804bb3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bb7:	c3                   	ret
+
+0000000000804bb8 <get_prot>:
+
+int
+get_prot(void *va) {
+  804bb8:	55                   	push   %rbp
+  804bb9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804bbc:	48 b8 04 4b 80 00 00 	movabs $0x804b04,%rax
+  804bc3:	00 00 00 
+  804bc6:	ff d0                	call   *%rax
+  804bc8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804bcb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804bd0:	89 c1                	mov    %eax,%ecx
+  804bd2:	83 c9 04             	or     $0x4,%ecx
+  804bd5:	f6 c2 01             	test   $0x1,%dl
+  804bd8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804bdb:	89 c1                	mov    %eax,%ecx
+  804bdd:	83 c9 02             	or     $0x2,%ecx
+  804be0:	f6 c2 02             	test   $0x2,%dl
+  804be3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804be6:	89 c1                	mov    %eax,%ecx
+  804be8:	83 c9 01             	or     $0x1,%ecx
+  804beb:	48 85 d2             	test   %rdx,%rdx
+  804bee:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804bf1:	89 c1                	mov    %eax,%ecx
+  804bf3:	83 c9 40             	or     $0x40,%ecx
+  804bf6:	f6 c6 04             	test   $0x4,%dh
+  804bf9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804bfc:	5d                   	pop    %rbp
+  804bfd:	c3                   	ret
+
+0000000000804bfe <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804bfe:	55                   	push   %rbp
+  804bff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c02:	48 b8 04 4b 80 00 00 	movabs $0x804b04,%rax
+  804c09:	00 00 00 
+  804c0c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c0e:	48 c1 e8 06          	shr    $0x6,%rax
+  804c12:	83 e0 01             	and    $0x1,%eax
+}
+  804c15:	5d                   	pop    %rbp
+  804c16:	c3                   	ret
+
+0000000000804c17 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804c17:	55                   	push   %rbp
+  804c18:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804c1b:	48 b8 04 4b 80 00 00 	movabs $0x804b04,%rax
+  804c22:	00 00 00 
+  804c25:	ff d0                	call   *%rax
+  804c27:	83 e0 01             	and    $0x1,%eax
+}
+  804c2a:	5d                   	pop    %rbp
+  804c2b:	c3                   	ret
+
+0000000000804c2c <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804c2c:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804c33:	01 00 00 
+  804c36:	a8 01                	test   $0x1,%al
+  804c38:	75 06                	jne    804c40 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804c3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c3f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c40:	55                   	push   %rbp
+  804c41:	48 89 e5             	mov    %rsp,%rbp
+  804c44:	41 57                	push   %r15
+  804c46:	41 56                	push   %r14
+  804c48:	41 55                	push   %r13
+  804c4a:	41 54                	push   %r12
+  804c4c:	53                   	push   %rbx
+  804c4d:	48 83 ec 28          	sub    $0x28,%rsp
+  804c51:	49 89 fe             	mov    %rdi,%r14
+  804c54:	49 89 f7             	mov    %rsi,%r15
+  804c57:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804c5e:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804c5f:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804c66:	01 00 00 
+  804c69:	e9 ae 00 00 00       	jmp    804d1c <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804c6e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804c75:	49 83 ec 01          	sub    $0x1,%r12
+  804c79:	74 2d                	je     804ca8 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804c7b:	48 89 d8             	mov    %rbx,%rax
+  804c7e:	48 c1 e8 0c          	shr    $0xc,%rax
+  804c82:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804c87:	f6 c2 01             	test   $0x1,%dl
+  804c8a:	74 e2                	je     804c6e <foreach_shared_region+0x42>
+  804c8c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804c91:	f6 c4 04             	test   $0x4,%ah
+  804c94:	74 d8                	je     804c6e <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804c96:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804c9d:	4c 89 fa             	mov    %r15,%rdx
+  804ca0:	48 89 df             	mov    %rbx,%rdi
+  804ca3:	41 ff d6             	call   *%r14
+  804ca6:	eb c6                	jmp    804c6e <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804ca8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804caf:	00 
+  804cb0:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804cb5:	74 4a                	je     804d01 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804cb7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cbb:	48 c1 e8 15          	shr    $0x15,%rax
+  804cbf:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804cc6:	01 00 00 
+  804cc9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804ccd:	a8 01                	test   $0x1,%al
+  804ccf:	74 d7                	je     804ca8 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804cd1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804cd5:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804cdc:	48 39 c3             	cmp    %rax,%rbx
+  804cdf:	73 c7                	jae    804ca8 <foreach_shared_region+0x7c>
+  804ce1:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804ce8:	48 39 d0             	cmp    %rdx,%rax
+  804ceb:	4d 19 e4             	sbb    %r12,%r12
+  804cee:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804cf5:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804cfc:	e9 7a ff ff ff       	jmp    804c7b <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804d01:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804d08:	40 
+  804d09:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804d0d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d14:	00 00 00 
+  804d17:	48 39 c1             	cmp    %rax,%rcx
+  804d1a:	74 50                	je     804d6c <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804d1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d20:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804d24:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804d2b:	01 00 00 
+  804d2e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d32:	a8 01                	test   $0x1,%al
+  804d34:	74 cb                	je     804d01 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804d36:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804d3a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804d41:	48 39 c1             	cmp    %rax,%rcx
+  804d44:	73 bb                	jae    804d01 <foreach_shared_region+0xd5>
+  804d46:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804d4d:	48 39 d0             	cmp    %rdx,%rax
+  804d50:	48 19 c0             	sbb    %rax,%rax
+  804d53:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804d59:	48 05 00 02 00 00    	add    $0x200,%rax
+  804d5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804d63:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804d67:	e9 4b ff ff ff       	jmp    804cb7 <foreach_shared_region+0x8b>
+  804d6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d71:	48 83 c4 28          	add    $0x28,%rsp
+  804d75:	5b                   	pop    %rbx
+  804d76:	41 5c                	pop    %r12
+  804d78:	41 5d                	pop    %r13
+  804d7a:	41 5e                	pop    %r14
+  804d7c:	41 5f                	pop    %r15
+  804d7e:	5d                   	pop    %rbp
+  804d7f:	c3                   	ret
+
+0000000000804d80 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804d80:	55                   	push   %rbp
+  804d81:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804d84:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  804d8b:	00 00 00 
+  804d8e:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804d95:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804d9c:	00 00 00 
+  804d9f:	48 39 c2             	cmp    %rax,%rdx
+  804da2:	74 13                	je     804db7 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804da4:	48 89 c7             	mov    %rax,%rdi
+  804da7:	48 b8 f4 18 80 00 00 	movabs $0x8018f4,%rax
+  804dae:	00 00 00 
+  804db1:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  804db3:	85 c0                	test   %eax,%eax
+  804db5:	78 0c                	js     804dc3 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  804db7:	48 b8 54 19 80 00 00 	movabs $0x801954,%rax
+  804dbe:	00 00 00 
+  804dc1:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804dc3:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804dca:	00 00 00 
+  804dcd:	8b 0a                	mov    (%rdx),%ecx
+  804dcf:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804dd2:	5d                   	pop    %rbp
+  804dd3:	c3                   	ret
+
+0000000000804dd4 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  804dd4:	55                   	push   %rbp
+  804dd5:	48 89 e5             	mov    %rsp,%rbp
+  804dd8:	41 57                	push   %r15
+  804dda:	41 56                	push   %r14
+  804ddc:	41 55                	push   %r13
+  804dde:	41 54                	push   %r12
+  804de0:	53                   	push   %rbx
+  804de1:	48 83 ec 18          	sub    $0x18,%rsp
+  804de5:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804de9:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804df0:	00 00 00 
+  804df3:	83 38 00             	cmpl   $0x0,(%rax)
+  804df6:	75 69                	jne    804e61 <scring_push+0x8d>
+  804df8:	49 89 ff             	mov    %rdi,%r15
+  804dfb:	49 89 f6             	mov    %rsi,%r14
+  804dfe:	49 89 d5             	mov    %rdx,%r13
+  804e01:	49 89 cc             	mov    %rcx,%r12
+  804e04:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804e07:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804e0e:	00 00 00 
+  804e11:	8b 42 04             	mov    0x4(%rdx),%eax
+  804e14:	8b 12                	mov    (%rdx),%edx
+  804e16:	29 d0                	sub    %edx,%eax
+  804e18:	83 f8 20             	cmp    $0x20,%eax
+  804e1b:	74 53                	je     804e70 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804e1d:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804e24:	00 00 00 
+  804e27:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804e2a:	83 e0 1f             	and    $0x1f,%eax
+  804e2d:	48 c1 e0 06          	shl    $0x6,%rax
+  804e31:	48 01 d0             	add    %rdx,%rax
+  804e34:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804e38:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804e3c:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804e40:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804e44:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804e48:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804e4c:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804e50:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804e54:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804e58:	8b 42 04             	mov    0x4(%rdx),%eax
+  804e5b:	83 c0 01             	add    $0x1,%eax
+  804e5e:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804e61:	48 83 c4 18          	add    $0x18,%rsp
+  804e65:	5b                   	pop    %rbx
+  804e66:	41 5c                	pop    %r12
+  804e68:	41 5d                	pop    %r13
+  804e6a:	41 5e                	pop    %r14
+  804e6c:	41 5f                	pop    %r15
+  804e6e:	5d                   	pop    %rbp
+  804e6f:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804e70:	48 b8 80 4d 80 00 00 	movabs $0x804d80,%rax
+  804e77:	00 00 00 
+  804e7a:	ff d0                	call   *%rax
+  804e7c:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  804e83:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804e85:	85 c0                	test   %eax,%eax
+  804e87:	79 94                	jns    804e1d <scring_push+0x49>
+  804e89:	eb d6                	jmp    804e61 <scring_push+0x8d>
+
+0000000000804e8b <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804e8b:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804e92:	00 00 00 
+  804e95:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804e97:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804e9d:	85 c0                	test   %eax,%eax
+  804e9f:	78 14                	js     804eb5 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804ea1:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804ea8:	00 00 00 
+  804eab:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  804eae:	8b 12                	mov    (%rdx),%edx
+  804eb0:	39 d1                	cmp    %edx,%ecx
+  804eb2:	75 11                	jne    804ec5 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  804eb4:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  804eb5:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804ebc:	00 00 00 
+  804ebf:	8b 0a                	mov    (%rdx),%ecx
+  804ec1:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804ec4:	c3                   	ret
+scring_submit(void) {
+  804ec5:	55                   	push   %rbp
+  804ec6:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  804ec9:	48 b8 80 4d 80 00 00 	movabs $0x804d80,%rax
+  804ed0:	00 00 00 
+  804ed3:	ff d0                	call   *%rax
+}
+  804ed5:	5d                   	pop    %rbp
+  804ed6:	c3                   	ret
+
+0000000000804ed7 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  804ed7:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804ede:	00 00 00 
+  804ee1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  804ee7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804eee:	00 00 00 
+  804ef1:	8b 10                	mov    (%rax),%edx
+  804ef3:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804ef6:	c3                   	ret
+
+0000000000804ef7 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  804ef7:	55                   	push   %rbp
+  804ef8:	48 89 e5             	mov    %rsp,%rbp
+  804efb:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804efe:	48 63 f7             	movslq %edi,%rsi
+  804f01:	48 83 ec 08          	sub    $0x8,%rsp
+  804f05:	6a 00                	push   $0x0
+  804f07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804f0d:	4c 63 c1             	movslq %ecx,%r8
+  804f10:	48 89 d1             	mov    %rdx,%rcx
+  804f13:	48 89 c2             	mov    %rax,%rdx
+  804f16:	bf 04 00 00 00       	mov    $0x4,%edi
+  804f1b:	48 b8 d4 4d 80 00 00 	movabs $0x804dd4,%rax
+  804f22:	00 00 00 
+  804f25:	ff d0                	call   *%rax
+}
+  804f27:	48 83 c4 10          	add    $0x10,%rsp
+  804f2b:	c9                   	leave
+  804f2c:	c3                   	ret
+
+0000000000804f2d <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804f2d:	55                   	push   %rbp
+  804f2e:	48 89 e5             	mov    %rsp,%rbp
+  804f31:	48 89 f0             	mov    %rsi,%rax
+  804f34:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  804f37:	48 63 ca             	movslq %edx,%rcx
+  804f3a:	48 63 f7             	movslq %edi,%rsi
+  804f3d:	48 83 ec 08          	sub    $0x8,%rsp
+  804f41:	4d 63 c9             	movslq %r9d,%r9
+  804f44:	41 51                	push   %r9
+  804f46:	4d 89 c1             	mov    %r8,%r9
+  804f49:	4d 89 d0             	mov    %r10,%r8
+  804f4c:	48 89 c2             	mov    %rax,%rdx
+  804f4f:	bf 05 00 00 00       	mov    $0x5,%edi
+  804f54:	48 b8 d4 4d 80 00 00 	movabs $0x804dd4,%rax
+  804f5b:	00 00 00 
+  804f5e:	ff d0                	call   *%rax
+}
+  804f60:	48 83 c4 10          	add    $0x10,%rsp
+  804f64:	c9                   	leave
+  804f65:	c3                   	ret
+
+0000000000804f66 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  804f66:	55                   	push   %rbp
+  804f67:	48 89 e5             	mov    %rsp,%rbp
+  804f6a:	48 89 f0             	mov    %rsi,%rax
+  804f6d:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  804f70:	48 63 f7             	movslq %edi,%rsi
+  804f73:	48 83 ec 08          	sub    $0x8,%rsp
+  804f77:	6a 00                	push   $0x0
+  804f79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804f7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804f85:	48 89 c2             	mov    %rax,%rdx
+  804f88:	bf 06 00 00 00       	mov    $0x6,%edi
+  804f8d:	48 b8 d4 4d 80 00 00 	movabs $0x804dd4,%rax
+  804f94:	00 00 00 
+  804f97:	ff d0                	call   *%rax
+}
+  804f99:	48 83 c4 10          	add    $0x10,%rsp
+  804f9d:	c9                   	leave
+  804f9e:	c3                   	ret
+
+0000000000804f9f <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  804f9f:	55                   	push   %rbp
+  804fa0:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  804fa3:	48 63 d6             	movslq %esi,%rdx
+  804fa6:	48 63 f7             	movslq %edi,%rsi
+  804fa9:	48 83 ec 08          	sub    $0x8,%rsp
+  804fad:	6a 00                	push   $0x0
+  804faf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804fb5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804fbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804fc0:	bf 09 00 00 00       	mov    $0x9,%edi
+  804fc5:	48 b8 d4 4d 80 00 00 	movabs $0x804dd4,%rax
+  804fcc:	00 00 00 
+  804fcf:	ff d0                	call   *%rax
+}
+  804fd1:	48 83 c4 10          	add    $0x10,%rsp
+  804fd5:	c9                   	leave
+  804fd6:	c3                   	ret
+
+0000000000804fd7 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  804fd7:	55                   	push   %rbp
+  804fd8:	48 89 e5             	mov    %rsp,%rbp
+  804fdb:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  804fde:	48 63 f7             	movslq %edi,%rsi
+  804fe1:	48 83 ec 08          	sub    $0x8,%rsp
+  804fe5:	6a 00                	push   $0x0
+  804fe7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804fed:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ff3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  804ff8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  804ffd:	48 b8 d4 4d 80 00 00 	movabs $0x804dd4,%rax
+  805004:	00 00 00 
+  805007:	ff d0                	call   *%rax
+}
+  805009:	48 83 c4 10          	add    $0x10,%rsp
+  80500d:	c9                   	leave
+  80500e:	c3                   	ret
+
+000000000080500f <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80500f:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  805015:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80501c:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  805023:	c3                   	ret
+
+0000000000805024 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  805024:	8b 47 40             	mov    0x40(%rdi),%eax
+  805027:	8b 17                	mov    (%rdi),%edx
+  805029:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80502b:	83 f8 0f             	cmp    $0xf,%eax
+  80502e:	77 13                	ja     805043 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  805030:	8b 47 40             	mov    0x40(%rdi),%eax
+  805033:	83 e0 0f             	and    $0xf,%eax
+  805036:	48 c1 e0 09          	shl    $0x9,%rax
+  80503a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805041:	00 
+  805042:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805043:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805048:	c3                   	ret
+
+0000000000805049 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  805049:	8b 47 40             	mov    0x40(%rdi),%eax
+  80504c:	83 c0 01             	add    $0x1,%eax
+  80504f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805052:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  805058:	8b 57 04             	mov    0x4(%rdi),%edx
+  80505b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805060:	85 d2                	test   %edx,%edx
+  805062:	75 04                	jne    805068 <chan_publish+0x1f>
+  805064:	83 e0 01             	and    $0x1,%eax
+}
+  805067:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  805068:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80506b:	85 c0                	test   %eax,%eax
+  80506d:	0f 95 c0             	setne  %al
+  805070:	0f b6 c0             	movzbl %al,%eax
+  805073:	eb ef                	jmp    805064 <chan_publish+0x1b>
+
+0000000000805075 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  805075:	8b 47 40             	mov    0x40(%rdi),%eax
+  805078:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80507a:	29 d0                	sub    %edx,%eax
+  80507c:	83 e8 01             	sub    $0x1,%eax
+  80507f:	83 f8 0f             	cmp    $0xf,%eax
+  805082:	77 12                	ja     805096 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  805084:	8b 07                	mov    (%rdi),%eax
+  805086:	83 e0 0f             	and    $0xf,%eax
+  805089:	48 c1 e0 09          	shl    $0x9,%rax
+  80508d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805094:	00 
+  805095:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  805096:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80509b:	c3                   	ret
+
+000000000080509c <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80509c:	8b 07                	mov    (%rdi),%eax
+  80509e:	83 c0 01             	add    $0x1,%eax
+  8050a1:	89 07                	mov    %eax,(%rdi)
+}
+  8050a3:	c3                   	ret
+
+00000000008050a4 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8050a4:	55                   	push   %rbp
+  8050a5:	48 89 e5             	mov    %rsp,%rbp
+  8050a8:	53                   	push   %rbx
+  8050a9:	48 83 ec 08          	sub    $0x8,%rsp
+  8050ad:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8050b0:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8050b7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8050bd:	48 b8 75 50 80 00 00 	movabs $0x805075,%rax
+  8050c4:	00 00 00 
+  8050c7:	ff d0                	call   *%rax
+  8050c9:	48 85 c0             	test   %rax,%rax
+  8050cc:	74 12                	je     8050e0 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8050ce:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8050d5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8050de:	c9                   	leave
+  8050df:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8050e0:	b8 01 00 00 00       	mov    $0x1,%eax
+  8050e5:	eb f3                	jmp    8050da <chan_arm+0x36>
+
+00000000008050e7 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8050e7:	55                   	push   %rbp
+  8050e8:	48 89 e5             	mov    %rsp,%rbp
+  8050eb:	41 56                	push   %r14
+  8050ed:	41 55                	push   %r13
+  8050ef:	41 54                	push   %r12
+  8050f1:	53                   	push   %rbx
+  8050f2:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8050f5:	49 bc a4 50 80 00 00 	movabs $0x8050a4,%r12
+  8050fc:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8050ff:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  805103:	49 bd 7d 19 80 00 00 	movabs $0x80197d,%r13
+  80510a:	00 00 00 
+    while (chan_arm(r))
+  80510d:	eb 0d                	jmp    80511c <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80510f:	8b 33                	mov    (%rbx),%esi
+  805111:	ba 00 00 00 00       	mov    $0x0,%edx
+  805116:	4c 89 f7             	mov    %r14,%rdi
+  805119:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80511c:	48 89 df             	mov    %rbx,%rdi
+  80511f:	41 ff d4             	call   *%r12
+  805122:	84 c0                	test   %al,%al
+  805124:	75 e9                	jne    80510f <chan_wait+0x28>
+}
+  805126:	5b                   	pop    %rbx
+  805127:	41 5c                	pop    %r12
+  805129:	41 5d                	pop    %r13
+  80512b:	41 5e                	pop    %r14
+  80512d:	5d                   	pop    %rbp
+  80512e:	c3                   	ret
+
+000000000080512f <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80512f:	55                   	push   %rbp
+  805130:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  805133:	48 83 c7 40          	add    $0x40,%rdi
+  805137:	be 01 00 00 00       	mov    $0x1,%esi
+  80513c:	48 b8 9b 19 80 00 00 	movabs $0x80199b,%rax
+  805143:	00 00 00 
+  805146:	ff d0                	call   *%rax
+}
+  805148:	5d                   	pop    %rbp
+  805149:	c3                   	ret
+
+000000000080514a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80514a:	55                   	push   %rbp
+  80514b:	48 89 e5             	mov    %rsp,%rbp
+  80514e:	41 56                	push   %r14
+  805150:	41 55                	push   %r13
+  805152:	41 54                	push   %r12
+  805154:	53                   	push   %rbx
+  805155:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805158:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  80515f:	00 00 00 
+  805162:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805166:	74 27                	je     80518f <_handle_vectored_pagefault+0x45>
+  805168:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80516d:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  805174:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805177:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80517a:	4c 89 e7             	mov    %r12,%rdi
+  80517d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805182:	84 c0                	test   %al,%al
+  805184:	75 45                	jne    8051cb <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805186:	48 83 c3 01          	add    $0x1,%rbx
+  80518a:	49 3b 1e             	cmp    (%r14),%rbx
+  80518d:	72 eb                	jb     80517a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80518f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805196:	00 
+  805197:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80519c:	4d 8b 04 24          	mov    (%r12),%r8
+  8051a0:	48 ba 08 5f 80 00 00 	movabs $0x805f08,%rdx
+  8051a7:	00 00 00 
+  8051aa:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8051af:	48 bf 38 5f 80 00 00 	movabs $0x805f38,%rdi
+  8051b6:	00 00 00 
+  8051b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051be:	49 ba 3b 06 80 00 00 	movabs $0x80063b,%r10
+  8051c5:	00 00 00 
+  8051c8:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8051cb:	5b                   	pop    %rbx
+  8051cc:	41 5c                	pop    %r12
+  8051ce:	41 5d                	pop    %r13
+  8051d0:	41 5e                	pop    %r14
+  8051d2:	5d                   	pop    %rbp
+  8051d3:	c3                   	ret
+
+00000000008051d4 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8051d4:	55                   	push   %rbp
+  8051d5:	48 89 e5             	mov    %rsp,%rbp
+  8051d8:	53                   	push   %rbx
+  8051d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8051dd:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8051e0:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8051e7:	00 00 00 
+  8051ea:	80 38 00             	cmpb   $0x0,(%rax)
+  8051ed:	0f 84 84 00 00 00    	je     805277 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8051f3:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8051fa:	00 00 00 
+  8051fd:	48 8b 10             	mov    (%rax),%rdx
+  805200:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  805205:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  80520c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80520f:	48 85 d2             	test   %rdx,%rdx
+  805212:	74 19                	je     80522d <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805214:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  805218:	0f 84 e8 00 00 00    	je     805306 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80521e:	48 83 c0 01          	add    $0x1,%rax
+  805222:	48 39 d0             	cmp    %rdx,%rax
+  805225:	75 ed                	jne    805214 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805227:	48 83 fa 08          	cmp    $0x8,%rdx
+  80522b:	74 1c                	je     805249 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80522d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  805231:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  805238:	00 00 00 
+  80523b:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  805242:	00 00 00 
+  805245:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  805249:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  805250:	00 00 00 
+  805253:	ff d0                	call   *%rax
+  805255:	89 c7                	mov    %eax,%edi
+  805257:	48 be cc 53 80 00 00 	movabs $0x8053cc,%rsi
+  80525e:	00 00 00 
+  805261:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  805268:	00 00 00 
+  80526b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80526d:	85 c0                	test   %eax,%eax
+  80526f:	78 68                	js     8052d9 <add_pgfault_handler+0x105>
+    return res;
+}
+  805271:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805275:	c9                   	leave
+  805276:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  805277:	48 b8 82 15 80 00 00 	movabs $0x801582,%rax
+  80527e:	00 00 00 
+  805281:	ff d0                	call   *%rax
+  805283:	89 c7                	mov    %eax,%edi
+  805285:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80528a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80528f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  805296:	00 00 00 
+  805299:	48 b8 0f 16 80 00 00 	movabs $0x80160f,%rax
+  8052a0:	00 00 00 
+  8052a3:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8052a5:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  8052ac:	00 00 00 
+  8052af:	48 8b 02             	mov    (%rdx),%rax
+  8052b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8052b6:	48 89 0a             	mov    %rcx,(%rdx)
+  8052b9:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8052c0:	00 00 00 
+  8052c3:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8052c7:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8052ce:	00 00 00 
+  8052d1:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8052d4:	e9 70 ff ff ff       	jmp    805249 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8052d9:	89 c1                	mov    %eax,%ecx
+  8052db:	48 ba 46 5f 80 00 00 	movabs $0x805f46,%rdx
+  8052e2:	00 00 00 
+  8052e5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8052ea:	48 bf 38 5f 80 00 00 	movabs $0x805f38,%rdi
+  8052f1:	00 00 00 
+  8052f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052f9:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  805300:	00 00 00 
+  805303:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805306:	b8 00 00 00 00       	mov    $0x0,%eax
+  80530b:	e9 61 ff ff ff       	jmp    805271 <add_pgfault_handler+0x9d>
+
+0000000000805310 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  805310:	55                   	push   %rbp
+  805311:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805314:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  80531b:	00 00 00 
+  80531e:	80 38 00             	cmpb   $0x0,(%rax)
+  805321:	74 33                	je     805356 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  805323:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  80532a:	00 00 00 
+  80532d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  805332:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  805339:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80533c:	48 85 c0             	test   %rax,%rax
+  80533f:	0f 84 85 00 00 00    	je     8053ca <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  805345:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  805349:	74 40                	je     80538b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80534b:	48 83 c1 01          	add    $0x1,%rcx
+  80534f:	48 39 c1             	cmp    %rax,%rcx
+  805352:	75 f1                	jne    805345 <remove_pgfault_handler+0x35>
+  805354:	eb 74                	jmp    8053ca <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  805356:	48 b9 5e 5f 80 00 00 	movabs $0x805f5e,%rcx
+  80535d:	00 00 00 
+  805360:	48 ba 71 5e 80 00 00 	movabs $0x805e71,%rdx
+  805367:	00 00 00 
+  80536a:	be 43 00 00 00       	mov    $0x43,%esi
+  80536f:	48 bf 38 5f 80 00 00 	movabs $0x805f38,%rdi
+  805376:	00 00 00 
+  805379:	b8 00 00 00 00       	mov    $0x0,%eax
+  80537e:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  805385:	00 00 00 
+  805388:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80538b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805392:	00 
+  805393:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805397:	48 29 ca             	sub    %rcx,%rdx
+  80539a:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  8053a1:	00 00 00 
+  8053a4:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8053a8:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8053ad:	48 89 ce             	mov    %rcx,%rsi
+  8053b0:	48 b8 aa 12 80 00 00 	movabs $0x8012aa,%rax
+  8053b7:	00 00 00 
+  8053ba:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8053bc:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8053c3:	00 00 00 
+  8053c6:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8053ca:	5d                   	pop    %rbp
+  8053cb:	c3                   	ret
+
+00000000008053cc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8053cc:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8053cf:	48 b8 4a 51 80 00 00 	movabs $0x80514a,%rax
+  8053d6:	00 00 00 
+    call *%rax
+  8053d9:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8053db:	41 5f                	pop    %r15
+	popq %r15
+  8053dd:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8053df:	41 5f                	pop    %r15
+	popq %r14
+  8053e1:	41 5e                	pop    %r14
+	popq %r13
+  8053e3:	41 5d                	pop    %r13
+	popq %r12
+  8053e5:	41 5c                	pop    %r12
+	popq %r11
+  8053e7:	41 5b                	pop    %r11
+	popq %r10
+  8053e9:	41 5a                	pop    %r10
+	popq %r9
+  8053eb:	41 59                	pop    %r9
+	popq %r8
+  8053ed:	41 58                	pop    %r8
+	popq %rsi
+  8053ef:	5e                   	pop    %rsi
+	popq %rdi
+  8053f0:	5f                   	pop    %rdi
+	popq %rbp
+  8053f1:	5d                   	pop    %rbp
+	popq %rdx
+  8053f2:	5a                   	pop    %rdx
+	popq %rcx
+  8053f3:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8053f4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8053f9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8053fe:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805402:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805405:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80540a:	5b                   	pop    %rbx
+	popq %rax
+  80540b:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80540c:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  805410:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  805411:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  805416:	c3                   	ret
+
+0000000000805417 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  805417:	55                   	push   %rbp
+  805418:	48 89 e5             	mov    %rsp,%rbp
+  80541b:	41 55                	push   %r13
+  80541d:	41 54                	push   %r12
+  80541f:	53                   	push   %rbx
+  805420:	48 83 ec 08          	sub    $0x8,%rsp
+  805424:	49 89 fd             	mov    %rdi,%r13
+  805427:	48 89 f7             	mov    %rsi,%rdi
+  80542a:	48 89 d3             	mov    %rdx,%rbx
+  80542d:	49 89 cc             	mov    %rcx,%r12
+  805430:	4c 89 c2             	mov    %r8,%rdx
+  805433:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  805436:	48 85 f6             	test   %rsi,%rsi
+  805439:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805440:	00 00 00 
+  805443:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  805447:	be 00 10 00 00       	mov    $0x1000,%esi
+  80544c:	48 85 db             	test   %rbx,%rbx
+  80544f:	74 03                	je     805454 <ipc_recv_futex+0x3d>
+  805451:	48 8b 33             	mov    (%rbx),%rsi
+  805454:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  805458:	48 b8 59 18 80 00 00 	movabs $0x801859,%rax
+  80545f:	00 00 00 
+  805462:	ff d0                	call   *%rax
+    if (res < 0) {
+  805464:	85 c0                	test   %eax,%eax
+  805466:	78 75                	js     8054dd <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  805468:	4d 85 ed             	test   %r13,%r13
+  80546b:	74 14                	je     805481 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80546d:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  805474:	00 00 00 
+  805477:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80547d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  805481:	4d 85 e4             	test   %r12,%r12
+  805484:	74 14                	je     80549a <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  805486:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  80548d:	00 00 00 
+  805490:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  805496:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80549a:	48 85 db             	test   %rbx,%rbx
+  80549d:	74 23                	je     8054c2 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80549f:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  8054a6:	00 00 00 
+  8054a9:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8054af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8054b4:	85 c9                	test   %ecx,%ecx
+  8054b6:	74 07                	je     8054bf <ipc_recv_futex+0xa8>
+  8054b8:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8054bf:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8054c2:	48 a1 70 17 81 00 00 	movabs 0x811770,%rax
+  8054c9:	00 00 00 
+  8054cc:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8054d2:	48 83 c4 08          	add    $0x8,%rsp
+  8054d6:	5b                   	pop    %rbx
+  8054d7:	41 5c                	pop    %r12
+  8054d9:	41 5d                	pop    %r13
+  8054db:	5d                   	pop    %rbp
+  8054dc:	c3                   	ret
+        if (from_env_store != NULL) {
+  8054dd:	4d 85 ed             	test   %r13,%r13
+  8054e0:	74 08                	je     8054ea <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8054e2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8054e9:	00 
+        if (perm_store != NULL) {
+  8054ea:	4d 85 e4             	test   %r12,%r12
+  8054ed:	74 08                	je     8054f7 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8054ef:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8054f6:	00 
+        if (size != NULL) {
+  8054f7:	48 85 db             	test   %rbx,%rbx
+  8054fa:	74 d6                	je     8054d2 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8054fc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805503:	eb cd                	jmp    8054d2 <ipc_recv_futex+0xbb>
+
+0000000000805505 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805505:	55                   	push   %rbp
+  805506:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  805509:	48 83 ec 08          	sub    $0x8,%rsp
+  80550d:	6a 00                	push   $0x0
+  80550f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805515:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80551b:	48 b8 17 54 80 00 00 	movabs $0x805417,%rax
+  805522:	00 00 00 
+  805525:	ff d0                	call   *%rax
+}
+  805527:	c9                   	leave
+  805528:	c3                   	ret
+
+0000000000805529 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  805529:	55                   	push   %rbp
+  80552a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80552d:	48 85 d2             	test   %rdx,%rdx
+  805530:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805537:	00 00 00 
+  80553a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80553e:	89 f6                	mov    %esi,%esi
+  805540:	48 b8 42 18 80 00 00 	movabs $0x801842,%rax
+  805547:	00 00 00 
+  80554a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80554c:	85 c0                	test   %eax,%eax
+  80554e:	78 02                	js     805552 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  805550:	5d                   	pop    %rbp
+  805551:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  805552:	89 c1                	mov    %eax,%ecx
+  805554:	48 ba 78 5f 80 00 00 	movabs $0x805f78,%rdx
+  80555b:	00 00 00 
+  80555e:	be 50 00 00 00       	mov    $0x50,%esi
+  805563:	48 bf 8c 5f 80 00 00 	movabs $0x805f8c,%rdi
+  80556a:	00 00 00 
+  80556d:	b8 00 00 00 00       	mov    $0x0,%eax
+  805572:	49 b8 3b 06 80 00 00 	movabs $0x80063b,%r8
+  805579:	00 00 00 
+  80557c:	41 ff d0             	call   *%r8
+
+000000000080557f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80557f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  805584:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80558b:	00 00 00 
+  80558e:	48 89 d0             	mov    %rdx,%rax
+  805591:	48 c1 e0 04          	shl    $0x4,%rax
+  805595:	48 29 d0             	sub    %rdx,%rax
+  805598:	48 c1 e0 05          	shl    $0x5,%rax
+  80559c:	48 01 c8             	add    %rcx,%rax
+  80559f:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8055a5:	39 f8                	cmp    %edi,%eax
+  8055a7:	74 13                	je     8055bc <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8055a9:	48 83 c2 01          	add    $0x1,%rdx
+  8055ad:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8055b4:	75 d8                	jne    80558e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8055b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8055bb:	c3                   	ret
+            return envs[i].env_id;
+  8055bc:	48 89 d0             	mov    %rdx,%rax
+  8055bf:	48 c1 e0 04          	shl    $0x4,%rax
+  8055c3:	48 29 d0             	sub    %rdx,%rax
+  8055c6:	48 c1 e0 05          	shl    $0x5,%rax
+  8055ca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8055d1:	00 00 00 
+  8055d4:	48 01 d0             	add    %rdx,%rax
+  8055d7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8055dd:	c3                   	ret
+  8055de:	66 90                	xchg   %ax,%ax
+
+00000000008055e0 <__rodata_start>:
+  8055e0:	69 6e 69 74 3a 20 72 	imul   $0x72203a74,0x69(%rsi),%ebp
+  8055e7:	75 6e                	jne    805657 <__rodata_start+0x77>
+  8055e9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8055ea:	69 6e 67 0a 00 69 6e 	imul   $0x6e69000a,0x67(%rsi),%ebp
+  8055f1:	69 74 3a 20 64 61 74 	imul   $0x61746164,0x20(%rdx,%rdi,1),%esi
+  8055f8:	61 
+  8055f9:	20 73 65             	and    %dh,0x65(%rbx)
+  8055fc:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8055fe:	73 20                	jae    805620 <__rodata_start+0x40>
+  805600:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805601:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  805605:	00 69 6e             	add    %ch,0x6e(%rcx)
+  805608:	69 74 3a 20 62 73 73 	imul   $0x20737362,0x20(%rdx,%rdi,1),%esi
+  80560f:	20 
+  805610:	73 65                	jae    805677 <__rodata_start+0x97>
+  805612:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805614:	73 20                	jae    805636 <__rodata_start+0x56>
+  805616:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805617:	6b 61 79 0a          	imul   $0xa,0x79(%rcx),%esp
+  80561b:	00 69 6e             	add    %ch,0x6e(%rcx)
+  80561e:	69 74 3a 20 61 72 67 	imul   $0x73677261,0x20(%rdx,%rdi,1),%esi
+  805625:	73 
+  805626:	3a 00                	cmp    (%rax),%al
+  805628:	20 27                	and    %ah,(%rdi)
+  80562a:	00 25 73 0a 00 69    	add    %ah,0x69000a73(%rip)        # 698060a3 <__bss_end+0x68fc40a3>
+  805630:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805631:	69 74 3a 20 72 75 6e 	imul   $0x6e6e7572,0x20(%rdx,%rdi,1),%esi
+  805638:	6e 
+  805639:	69 6e 67 20 73 68 0a 	imul   $0xa687320,0x67(%rsi),%ebp
+  805640:	00 6f 70             	add    %ch,0x70(%rdi)
+  805643:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805645:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  805648:	73 3a                	jae    805684 <__rodata_start+0xa4>
+  80564a:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f556b9 <__bss_end+0x737136b9>
+  805650:	65 72 2f             	gs jb  805682 <__rodata_start+0xa2>
+  805653:	69 6e 69 74 2e 63 00 	imul   $0x632e74,0x69(%rsi),%ebp
+  80565a:	66 69 72 73 74 20    	imul   $0x2074,0x73(%rdx),%si
+  805660:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805661:	70 65                	jo     8056c8 <__rodata_start+0xe8>
+  805663:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805664:	63 6f 6e             	movsxd 0x6e(%rdi),%ebp
+  805667:	73 20                	jae    805689 <__rodata_start+0xa9>
+  805669:	75 73                	jne    8056de <__rodata_start+0xfe>
+  80566b:	65 64 20 66 64       	gs and %ah,%fs:0x64(%rsi)
+  805670:	20 25 64 00 64 75    	and    %ah,0x75640064(%rip)        # 75e456da <__bss_end+0x756036da>
+  805676:	70 3a                	jo     8056b2 <__rodata_start+0xd2>
+  805678:	20 25 69 00 69 6e    	and    %ah,0x6e690069(%rip)        # 6ee956e7 <__bss_end+0x6e6536e7>
+  80567e:	69 74 3a 20 73 74 61 	imul   $0x72617473,0x20(%rdx,%rdi,1),%esi
+  805685:	72 
+  805686:	74 69                	je     8056f1 <__rodata_start+0x111>
+  805688:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805689:	67 20 73 68          	and    %dh,0x68(%ebx)
+  80568d:	0a 00                	or     (%rax),%al
+  80568f:	2f                   	(bad)
+  805690:	73 68                	jae    8056fa <__rodata_start+0x11a>
+  805692:	00 69 6e             	add    %ch,0x6e(%rcx)
+  805695:	69 74 3a 20 73 70 61 	imul   $0x77617073,0x20(%rdx,%rdi,1),%esi
+  80569c:	77 
+  80569d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80569e:	20 73 68             	and    %dh,0x68(%rbx)
+  8056a1:	3a 20                	cmp    (%rax),%ah
+  8056a3:	25 69 0a 00 90       	and    $0x90000a69,%eax
+  8056a8:	69 6e 69 74 3a 20 64 	imul   $0x64203a74,0x69(%rsi),%ebp
+  8056af:	61                   	(bad)
+  8056b0:	74 61                	je     805713 <__rodata_start+0x133>
+  8056b2:	20 69 73             	and    %ch,0x73(%rcx)
+  8056b5:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8056b8:	74 20                	je     8056da <__rodata_start+0xfa>
+  8056ba:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  8056c1:	69 7a 65 64 3a 20 67 	imul   $0x67203a64,0x65(%rdx),%edi
+  8056c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056c9:	74 20                	je     8056eb <__rodata_start+0x10b>
+  8056cb:	73 75                	jae    805742 <__rodata_start+0x162>
+  8056cd:	6d                   	insl   (%dx),%es:(%rdi)
+  8056ce:	20 25 30 38 78 20    	and    %ah,0x20783830(%rip)        # 20f88f04 <__bss_end+0x20746f04>
+  8056d4:	77 61                	ja     805737 <__rodata_start+0x157>
+  8056d6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8056d7:	74 65                	je     80573e <__rodata_start+0x15e>
+  8056d9:	64 20 25 30 38 78 0a 	and    %ah,%fs:0xa783830(%rip)        # af88f10 <__bss_end+0xa746f10>
+	...
+  8056e8:	62 73                	(bad)
+  8056ea:	73 20                	jae    80570c <__rodata_start+0x12c>
+  8056ec:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8056f3:	69 6e 69 74 69 61 6c 	imul   $0x6c616974,0x69(%rsi),%ebp
+  8056fa:	69 7a 65 64 3a 20 77 	imul   $0x77203a64,0x65(%rdx),%edi
+  805701:	61                   	(bad)
+  805702:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805703:	74 65                	je     80576a <__rodata_start+0x18a>
+  805705:	64 20 73 75          	and    %dh,%fs:0x75(%rbx)
+  805709:	6d                   	insl   (%dx),%es:(%rdi)
+  80570a:	20 30                	and    %dh,(%rax)
+  80570c:	20 67 6f             	and    %ah,0x6f(%rdi)
+  80570f:	74 20                	je     805731 <__rodata_start+0x151>
+  805711:	25 30 38 78 0a       	and    $0xa783830,%eax
+  805716:	00 3c 63             	add    %bh,(%rbx,%riz,2)
+  805719:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80571a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80571b:	73 3e                	jae    80575b <__rodata_start+0x17b>
+  80571d:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805720:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805721:	73 00                	jae    805723 <__rodata_start+0x143>
+  805723:	3c 75                	cmp    $0x75,%al
+  805725:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805726:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80572a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80572b:	3e 00 0f             	ds add %cl,(%rdi)
+  80572e:	1f                   	(bad)
+  80572f:	00 5b 25             	add    %bl,0x25(%rbx)
+  805732:	30 38                	xor    %bh,(%rax)
+  805734:	78 5d                	js     805793 <__rodata_start+0x1b3>
+  805736:	20 75 73             	and    %dh,0x73(%rbp)
+  805739:	65 72 20             	gs jb  80575c <__rodata_start+0x17c>
+  80573c:	70 61                	jo     80579f <__rodata_start+0x1bf>
+  80573e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80573f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805746:	73 20                	jae    805768 <__rodata_start+0x188>
+  805748:	61                   	(bad)
+  805749:	74 20                	je     80576b <__rodata_start+0x18b>
+  80574b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805750:	3a 20                	cmp    (%rax),%ah
+  805752:	00 30                	add    %dh,(%rax)
+  805754:	31 32                	xor    %esi,(%rdx)
+  805756:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80575d:	41                   	rex.B
+  80575e:	42                   	rex.X
+  80575f:	43                   	rex.XB
+  805760:	44                   	rex.R
+  805761:	45                   	rex.RB
+  805762:	46 00 30             	rex.RX add %r14b,(%rax)
+  805765:	31 32                	xor    %esi,(%rdx)
+  805767:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80576e:	61                   	(bad)
+  80576f:	62 63 64 65 66       	(bad)
+  805774:	00 28                	add    %ch,(%rax)
+  805776:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805777:	75 6c                	jne    8057e5 <__rodata_start+0x205>
+  805779:	6c                   	insb   (%dx),%es:(%rdi)
+  80577a:	29 00                	sub    %eax,(%rax)
+  80577c:	65 72 72             	gs jb  8057f1 <__rodata_start+0x211>
+  80577f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805780:	72 20                	jb     8057a2 <__rodata_start+0x1c2>
+  805782:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805787:	73 70                	jae    8057f9 <__rodata_start+0x219>
+  805789:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80578d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805794:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805795:	72 00                	jb     805797 <__rodata_start+0x1b7>
+  805797:	62 61 64 20 65       	(bad)
+  80579c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80579d:	76 69                	jbe    805808 <__rodata_start+0x228>
+  80579f:	72 6f                	jb     805810 <__rodata_start+0x230>
+  8057a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8057a3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8057a5:	74 00                	je     8057a7 <__rodata_start+0x1c7>
+  8057a7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8057ae:	20 70 61             	and    %dh,0x61(%rax)
+  8057b1:	72 61                	jb     805814 <__rodata_start+0x234>
+  8057b3:	6d                   	insl   (%dx),%es:(%rdi)
+  8057b4:	65 74 65             	gs je  80581c <__rodata_start+0x23c>
+  8057b7:	72 00                	jb     8057b9 <__rodata_start+0x1d9>
+  8057b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057ba:	75 74                	jne    805830 <__rodata_start+0x250>
+  8057bc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8057bf:	20 6d 65             	and    %ch,0x65(%rbp)
+  8057c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8057c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057c4:	72 79                	jb     80583f <__rodata_start+0x25f>
+  8057c6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8057c9:	74 20                	je     8057eb <__rodata_start+0x20b>
+  8057cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057cc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8057d0:	76 69                	jbe    80583b <__rodata_start+0x25b>
+  8057d2:	72 6f                	jb     805843 <__rodata_start+0x263>
+  8057d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057d5:	6d                   	insl   (%dx),%es:(%rdi)
+  8057d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8057d8:	74 73                	je     80584d <__rodata_start+0x26d>
+  8057da:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8057dd:	72 72                	jb     805851 <__rodata_start+0x271>
+  8057df:	75 70                	jne    805851 <__rodata_start+0x271>
+  8057e1:	74 65                	je     805848 <__rodata_start+0x268>
+  8057e3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8057e8:	75 67                	jne    805851 <__rodata_start+0x271>
+  8057ea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8057ed:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8057ef:	00 73 65             	add    %dh,0x65(%rbx)
+  8057f2:	67 6d                	insl   (%dx),%es:(%edi)
+  8057f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8057f6:	74 61                	je     805859 <__rodata_start+0x279>
+  8057f8:	74 69                	je     805863 <__rodata_start+0x283>
+  8057fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8057fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057fc:	20 66 61             	and    %ah,0x61(%rsi)
+  8057ff:	75 6c                	jne    80586d <__rodata_start+0x28d>
+  805801:	74 00                	je     805803 <__rodata_start+0x223>
+  805803:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80580a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80580d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805811:	61                   	(bad)
+  805812:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805817:	20 73 75             	and    %dh,0x75(%rbx)
+  80581a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80581d:	73 79                	jae    805898 <__rodata_start+0x2b8>
+  80581f:	73 74                	jae    805895 <__rodata_start+0x2b5>
+  805821:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805823:	20 63 61             	and    %ah,0x61(%rbx)
+  805826:	6c                   	insb   (%dx),%es:(%rdi)
+  805827:	6c                   	insb   (%dx),%es:(%rdi)
+  805828:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80582b:	74 72                	je     80589f <__rodata_start+0x2bf>
+  80582d:	79 20                	jns    80584f <__rodata_start+0x26f>
+  80582f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805830:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805831:	74 20                	je     805853 <__rodata_start+0x273>
+  805833:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805835:	75 6e                	jne    8058a5 <__rodata_start+0x2c5>
+  805837:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80583b:	76 20                	jbe    80585d <__rodata_start+0x27d>
+  80583d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805844:	72 65                	jb     8058ab <__rodata_start+0x2cb>
+  805846:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805849:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80584a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80584e:	65 78 70             	gs js  8058c1 <__rodata_start+0x2e1>
+  805851:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805856:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805859:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80585d:	20 66 69             	and    %ah,0x69(%rsi)
+  805860:	6c                   	insb   (%dx),%es:(%rdi)
+  805861:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805865:	20 66 72             	and    %ah,0x72(%rsi)
+  805868:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80586d:	61                   	(bad)
+  80586e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805871:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805872:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805873:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805877:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80587a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80587b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80587c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80587f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805880:	79 20                	jns    8058a2 <__rodata_start+0x2c2>
+  805882:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805889:	72 65                	jb     8058f0 <__rodata_start+0x310>
+  80588b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80588e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805890:	00 66 69             	add    %ah,0x69(%rsi)
+  805893:	6c                   	insb   (%dx),%es:(%rdi)
+  805894:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805898:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80589b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80589c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80589f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058a1:	74 20                	je     8058c3 <__rodata_start+0x2e3>
+  8058a3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8058a5:	75 6e                	jne    805915 <__rodata_start+0x335>
+  8058a7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8058ab:	76 61                	jbe    80590e <__rodata_start+0x32e>
+  8058ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8058ae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8058b5:	00 
+  8058b6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8058bd:	72 65                	jb     805924 <__rodata_start+0x344>
+  8058bf:	61                   	(bad)
+  8058c0:	64 79 20             	fs jns 8058e3 <__rodata_start+0x303>
+  8058c3:	65 78 69             	gs js  80592f <__rodata_start+0x34f>
+  8058c6:	73 74                	jae    80593c <__rodata_start+0x35c>
+  8058c8:	73 00                	jae    8058ca <__rodata_start+0x2ea>
+  8058ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058cb:	70 65                	jo     805932 <__rodata_start+0x352>
+  8058cd:	72 61                	jb     805930 <__rodata_start+0x350>
+  8058cf:	74 69                	je     80593a <__rodata_start+0x35a>
+  8058d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058d3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8058d6:	74 20                	je     8058f8 <__rodata_start+0x318>
+  8058d8:	73 75                	jae    80594f <__rodata_start+0x36f>
+  8058da:	70 70                	jo     80594c <__rodata_start+0x36c>
+  8058dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058dd:	72 74                	jb     805953 <__rodata_start+0x373>
+  8058df:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8058e5:	20 61 67             	and    %ah,0x67(%rcx)
+  8058e8:	61                   	(bad)
+  8058e9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8058f0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8058f4:	74 00                	je     8058f6 <__rodata_start+0x316>
+  8058f6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8058fd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805900:	20 75 73             	and    %dh,0x73(%rbp)
+  805903:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  805907:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80590e:	00 
+  80590f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  805916:	00 00 00 
+  805919:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  805920:	78 09                	js     80592b <__rodata_start+0x34b>
+  805922:	80 00 00             	addb   $0x0,(%rax)
+  805925:	00 00                	add    %al,(%rax)
+  805927:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  80592d:	00 00                	add    %al,(%rax)
+  80592f:	00 a9 0f 80 00 00    	add    %ch,0x800f(%rcx)
+  805935:	00 00                	add    %al,(%rax)
+  805937:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  80593d:	00 00                	add    %al,(%rax)
+  80593f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805945:	00 00                	add    %al,(%rax)
+  805947:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  80594d:	00 00                	add    %al,(%rax)
+  80594f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805955:	00 00                	add    %al,(%rax)
+  805957:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  80595d:	00 00                	add    %al,(%rax)
+  80595f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805965:	00 00                	add    %al,(%rax)
+  805967:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  80596d:	00 00                	add    %al,(%rax)
+  80596f:	00 8b 09 80 00 00    	add    %cl,0x8009(%rbx)
+  805975:	00 00                	add    %al,(%rax)
+  805977:	00 05 0a 80 00 00    	add    %al,0x800a(%rip)        # 80d987 <__ctors_end+0x6127>
+  80597d:	00 00                	add    %al,(%rax)
+  80597f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805985:	00 00                	add    %al,(%rax)
+  805987:	00 8b 09 80 00 00    	add    %cl,0x8009(%rbx)
+  80598d:	00 00                	add    %al,(%rax)
+  80598f:	00 d1                	add    %dl,%cl
+  805991:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  805997:	00 d1                	add    %dl,%cl
+  805999:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  80599f:	00 d1                	add    %dl,%cl
+  8059a1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059a7:	00 d1                	add    %dl,%cl
+  8059a9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059af:	00 d1                	add    %dl,%cl
+  8059b1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059b7:	00 d1                	add    %dl,%cl
+  8059b9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059bf:	00 d1                	add    %dl,%cl
+  8059c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059c7:	00 d1                	add    %dl,%cl
+  8059c9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059cf:	00 d1                	add    %dl,%cl
+  8059d1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8059d7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  8059fd:	00 00                	add    %al,(%rax)
+  8059ff:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 dc                	add    %bl,%ah
+  805ac9:	0e                   	(bad)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 28                	add    %ch,(%rax)
+  805b21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805b27:	00 f7                	add    %dh,%bh
+  805b29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805b2f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 57 0a             	add    %dl,0xa(%rdi)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 1d 0a 80 00 00    	add    %bl,0x800a(%rip)        # 80db77 <__ctors_end+0x6317>
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 9f 0d 80 00 00    	add    %bl,0x800d(%rdi)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 69 0e             	add    %ch,0xe(%rcx)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 ee                	add    %ch,%dh
+  805ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805ba7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 cb                	add    %cl,%bl
+  805bb1:	0c 80                	or     $0x80,%al
+  805bb3:	00 00                	add    %al,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 dc                	add    %bl,%ah
+  805bc9:	0e                   	(bad)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 b9 0f 80 00 00    	add    %bh,0x800f(%rcx)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 81 09 80 00 00    	add    %al,0x8009(%rcx)
+  805bdd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805be0 <error_string>:
+	...
+  805be8:	85 57 80 00 00 00 00 00 97 57 80 00 00 00 00 00     .W.......W......
+  805bf8:	a7 57 80 00 00 00 00 00 b9 57 80 00 00 00 00 00     .W.......W......
+  805c08:	c7 57 80 00 00 00 00 00 db 57 80 00 00 00 00 00     .W.......W......
+  805c18:	f0 57 80 00 00 00 00 00 03 58 80 00 00 00 00 00     .W.......X......
+  805c28:	15 58 80 00 00 00 00 00 29 58 80 00 00 00 00 00     .X......)X......
+  805c38:	39 58 80 00 00 00 00 00 4c 58 80 00 00 00 00 00     9X......LX......
+  805c48:	63 58 80 00 00 00 00 00 79 58 80 00 00 00 00 00     cX......yX......
+  805c58:	91 58 80 00 00 00 00 00 a9 58 80 00 00 00 00 00     .X.......X......
+  805c68:	b6 58 80 00 00 00 00 00 98 5c 80 00 00 00 00 00     .X.......\......
+  805c78:	ca 58 80 00 00 00 00 00 e2 58 80 00 00 00 00 00     .X.......X......
+  805c88:	ec 58 80 00 00 00 00 00 f6 58 80 00 00 00 00 00     .X.......X......
+  805c98:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805ca8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805cb8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805cc8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805cd8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805ce8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805cf8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805d08:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805d18:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805d28:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805d38:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805d48:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805d58:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805d68:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d78:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805d80 <devtab>:
+  805d80:	e0 77 80 00 00 00 00 00 20 78 80 00 00 00 00 00     .w...... x......
+  805d90:	80 77 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .w..............
+  805da0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805db0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805dc0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805dd0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805de0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805df0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805e00:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805e10:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805e20:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805e30:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  805e40:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  805e50:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  805e60:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  805e70:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  805e80:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  805e90:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805ea0:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805eb0:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805ec0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805ed0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805ee0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  805ef0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805f00:	63 00 66 0f 1f 44 00 00 55 73 65 72 73 70 61 63     c.f..D..Userspac
+  805f10:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805f20:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805f30:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805f40:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805f50:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805f60:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805f70:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805f80:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805f90:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
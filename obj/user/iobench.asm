@@ -0,0 +1,10006 @@
+
+obj/user/iobench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 bc 03 00 00       	call   8003df <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+#include <inc/lib.h>
+
+#define NLINES 1024
+
+static void
+bench(const char *prog, const volatile struct Env *fs) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+  800030:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  800037:	48 89 fb             	mov    %rdi,%rbx
+  80003a:	49 89 f6             	mov    %rsi,%r14
+    int fd, res;
+
+    if ((fd = open("/iobench.out", O_WRONLY | O_CREAT | O_TRUNC)) < 0)
+  80003d:	be 01 03 00 00       	mov    $0x301,%esi
+  800042:	48 bf 88 56 80 00 00 	movabs $0x805688,%rdi
+  800049:	00 00 00 
+  80004c:	48 b8 d6 32 80 00 00 	movabs $0x8032d6,%rax
+  800053:	00 00 00 
+  800056:	ff d0                	call   *%rax
+  800058:	41 89 c4             	mov    %eax,%r12d
+  80005b:	85 c0                	test   %eax,%eax
+  80005d:	0f 88 2b 01 00 00    	js     80018e <bench+0x169>
+        panic("open /iobench.out: %i", fd);
+    if ((res = dup(fd, 1)) < 0) panic("dup: %i", res);
+  800063:	be 01 00 00 00       	mov    $0x1,%esi
+  800068:	89 c7                	mov    %eax,%edi
+  80006a:	48 b8 d1 1c 80 00 00 	movabs $0x801cd1,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+  800076:	85 c0                	test   %eax,%eax
+  800078:	0f 88 3d 01 00 00    	js     8001bb <bench+0x196>
+    close(fd);
+  80007e:	44 89 e7             	mov    %r12d,%edi
+  800081:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  800088:	00 00 00 
+  80008b:	ff d0                	call   *%rax
+
+    uint64_t fs_replies = fs->env_ipc_sends;
+  80008d:	4d 8b a6 d8 01 00 00 	mov    0x1d8(%r14),%r12
+    envid_t child = spawnl(prog, prog, "/iobench.txt", (char *)0);
+  800094:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800099:	48 ba c2 56 80 00 00 	movabs $0x8056c2,%rdx
+  8000a0:	00 00 00 
+  8000a3:	48 89 de             	mov    %rbx,%rsi
+  8000a6:	48 89 df             	mov    %rbx,%rdi
+  8000a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ae:	49 b8 2d 43 80 00 00 	movabs $0x80432d,%r8
+  8000b5:	00 00 00 
+  8000b8:	41 ff d0             	call   *%r8
+  8000bb:	41 89 c5             	mov    %eax,%r13d
+    if (child < 0) panic("spawn %s: %i", prog, child);
+  8000be:	85 c0                	test   %eax,%eax
+  8000c0:	0f 88 22 01 00 00    	js     8001e8 <bench+0x1c3>
+    close(1);
+  8000c6:	bf 01 00 00 00       	mov    $0x1,%edi
+  8000cb:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  8000d2:	00 00 00 
+  8000d5:	ff d0                	call   *%rax
+    wait(child);
+  8000d7:	44 89 ef             	mov    %r13d,%edi
+  8000da:	48 b8 46 4a 80 00 00 	movabs $0x804a46,%rax
+  8000e1:	00 00 00 
+  8000e4:	ff d0                	call   *%rax
+
+    const volatile struct Env *env = &envs[ENVX(child)];
+  8000e6:	41 81 e5 ff 03 00 00 	and    $0x3ff,%r13d
+    struct Stat st;
+    if ((res = stat("/iobench.out", &st)) < 0) panic("stat /iobench.out: %i", res);
+  8000ed:	48 8d b5 50 ff ff ff 	lea    -0xb0(%rbp),%rsi
+  8000f4:	48 bf 88 56 80 00 00 	movabs $0x805688,%rdi
+  8000fb:	00 00 00 
+  8000fe:	48 b8 68 21 80 00 00 	movabs $0x802168,%rax
+  800105:	00 00 00 
+  800108:	ff d0                	call   *%rax
+  80010a:	85 c0                	test   %eax,%eax
+  80010c:	0f 88 07 01 00 00    	js     800219 <bench+0x1f4>
+
+    cprintf("iobench: %s: %lu KB written, %lu system calls, %lu IPC messages, %lu file server requests\n",
+            prog, (unsigned long)(st.st_size / 1024), (unsigned long)env->env_syscalls,
+            (unsigned long)env->env_ipc_sends, (unsigned long)(fs->env_ipc_sends - fs_replies));
+  800112:	4d 8b 8e d8 01 00 00 	mov    0x1d8(%r14),%r9
+  800119:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  800120:	00 00 00 
+  800123:	4d 63 ed             	movslq %r13d,%r13
+  800126:	4c 89 e8             	mov    %r13,%rax
+  800129:	48 c1 e0 04          	shl    $0x4,%rax
+  80012d:	48 89 c2             	mov    %rax,%rdx
+  800130:	4c 29 ea             	sub    %r13,%rdx
+  800133:	48 c1 e2 05          	shl    $0x5,%rdx
+  800137:	48 01 ca             	add    %rcx,%rdx
+  80013a:	4c 8b 82 d8 01 00 00 	mov    0x1d8(%rdx),%r8
+            prog, (unsigned long)(st.st_size / 1024), (unsigned long)env->env_syscalls,
+  800141:	48 8b 8a c8 01 00 00 	mov    0x1c8(%rdx),%rcx
+  800148:	8b 45 d0             	mov    -0x30(%rbp),%eax
+  80014b:	8d 90 ff 03 00 00    	lea    0x3ff(%rax),%edx
+  800151:	85 c0                	test   %eax,%eax
+  800153:	0f 49 d0             	cmovns %eax,%edx
+  800156:	c1 fa 0a             	sar    $0xa,%edx
+    cprintf("iobench: %s: %lu KB written, %lu system calls, %lu IPC messages, %lu file server requests\n",
+  800159:	48 63 d2             	movslq %edx,%rdx
+  80015c:	4d 29 e1             	sub    %r12,%r9
+  80015f:	48 89 de             	mov    %rbx,%rsi
+  800162:	48 bf 38 57 80 00 00 	movabs $0x805738,%rdi
+  800169:	00 00 00 
+  80016c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800171:	49 ba 05 06 80 00 00 	movabs $0x800605,%r10
+  800178:	00 00 00 
+  80017b:	41 ff d2             	call   *%r10
+}
+  80017e:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  800185:	5b                   	pop    %rbx
+  800186:	41 5c                	pop    %r12
+  800188:	41 5d                	pop    %r13
+  80018a:	41 5e                	pop    %r14
+  80018c:	5d                   	pop    %rbp
+  80018d:	c3                   	ret
+        panic("open /iobench.out: %i", fd);
+  80018e:	89 c1                	mov    %eax,%ecx
+  800190:	48 ba 95 56 80 00 00 	movabs $0x805695,%rdx
+  800197:	00 00 00 
+  80019a:	be 10 00 00 00       	mov    $0x10,%esi
+  80019f:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  8001a6:	00 00 00 
+  8001a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001ae:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8001b5:	00 00 00 
+  8001b8:	41 ff d0             	call   *%r8
+    if ((res = dup(fd, 1)) < 0) panic("dup: %i", res);
+  8001bb:	89 c1                	mov    %eax,%ecx
+  8001bd:	48 ba ba 56 80 00 00 	movabs $0x8056ba,%rdx
+  8001c4:	00 00 00 
+  8001c7:	be 11 00 00 00       	mov    $0x11,%esi
+  8001cc:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  8001d3:	00 00 00 
+  8001d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001db:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8001e2:	00 00 00 
+  8001e5:	41 ff d0             	call   *%r8
+    if (child < 0) panic("spawn %s: %i", prog, child);
+  8001e8:	41 89 c0             	mov    %eax,%r8d
+  8001eb:	48 89 d9             	mov    %rbx,%rcx
+  8001ee:	48 ba cf 56 80 00 00 	movabs $0x8056cf,%rdx
+  8001f5:	00 00 00 
+  8001f8:	be 16 00 00 00       	mov    $0x16,%esi
+  8001fd:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  800204:	00 00 00 
+  800207:	b8 00 00 00 00       	mov    $0x0,%eax
+  80020c:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  800213:	00 00 00 
+  800216:	41 ff d1             	call   *%r9
+    if ((res = stat("/iobench.out", &st)) < 0) panic("stat /iobench.out: %i", res);
+  800219:	89 c1                	mov    %eax,%ecx
+  80021b:	48 ba dc 56 80 00 00 	movabs $0x8056dc,%rdx
+  800222:	00 00 00 
+  800225:	be 1c 00 00 00       	mov    $0x1c,%esi
+  80022a:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  800231:	00 00 00 
+  800234:	b8 00 00 00 00       	mov    $0x0,%eax
+  800239:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  800240:	00 00 00 
+  800243:	41 ff d0             	call   *%r8
+
+0000000000800246 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800246:	55                   	push   %rbp
+  800247:	48 89 e5             	mov    %rsp,%rbp
+  80024a:	41 57                	push   %r15
+  80024c:	41 56                	push   %r14
+  80024e:	41 55                	push   %r13
+  800250:	41 54                	push   %r12
+  800252:	53                   	push   %rbx
+  800253:	48 83 ec 58          	sub    $0x58,%rsp
+    int fd, res;
+    char line[64];
+
+    envid_t fsenv = ipc_find_env(ENV_TYPE_FS);
+  800257:	bf 03 00 00 00       	mov    $0x3,%edi
+  80025c:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  800263:	00 00 00 
+  800266:	ff d0                	call   *%rax
+  800268:	89 45 8c             	mov    %eax,-0x74(%rbp)
+    if (!fsenv) panic("no file server");
+  80026b:	85 c0                	test   %eax,%eax
+  80026d:	0f 84 ef 00 00 00    	je     800362 <umain+0x11c>
+
+    if ((fd = open("/iobench.txt", O_WRONLY | O_CREAT | O_TRUNC)) < 0)
+  800273:	be 01 03 00 00       	mov    $0x301,%esi
+  800278:	48 bf c2 56 80 00 00 	movabs $0x8056c2,%rdi
+  80027f:	00 00 00 
+  800282:	48 b8 d6 32 80 00 00 	movabs $0x8032d6,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+  80028e:	41 89 c5             	mov    %eax,%r13d
+  800291:	85 c0                	test   %eax,%eax
+  800293:	0f 88 ee 00 00 00    	js     800387 <umain+0x141>
+        panic("open /iobench.txt: %i", fd);
+    for (int i = 0; i < NLINES; i++) {
+  800299:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int n = snprintf(line, sizeof(line), "%d: the quick brown fox jumps over the lazy dog\n", i);
+  80029f:	49 bf af 0e 80 00 00 	movabs $0x800eaf,%r15
+  8002a6:	00 00 00 
+        if ((res = write(fd, line, n)) != n) panic("write /iobench.txt: %i", res);
+  8002a9:	49 be 23 1f 80 00 00 	movabs $0x801f23,%r14
+  8002b0:	00 00 00 
+        int n = snprintf(line, sizeof(line), "%d: the quick brown fox jumps over the lazy dog\n", i);
+  8002b3:	44 89 e1             	mov    %r12d,%ecx
+  8002b6:	48 ba 98 57 80 00 00 	movabs $0x805798,%rdx
+  8002bd:	00 00 00 
+  8002c0:	be 40 00 00 00       	mov    $0x40,%esi
+  8002c5:	48 8d 7d 90          	lea    -0x70(%rbp),%rdi
+  8002c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ce:	41 ff d7             	call   *%r15
+  8002d1:	89 c3                	mov    %eax,%ebx
+        if ((res = write(fd, line, n)) != n) panic("write /iobench.txt: %i", res);
+  8002d3:	48 63 d0             	movslq %eax,%rdx
+  8002d6:	48 8d 75 90          	lea    -0x70(%rbp),%rsi
+  8002da:	44 89 ef             	mov    %r13d,%edi
+  8002dd:	41 ff d6             	call   *%r14
+  8002e0:	89 c1                	mov    %eax,%ecx
+  8002e2:	39 c3                	cmp    %eax,%ebx
+  8002e4:	0f 85 ca 00 00 00    	jne    8003b4 <umain+0x16e>
+    for (int i = 0; i < NLINES; i++) {
+  8002ea:	41 83 c4 01          	add    $0x1,%r12d
+  8002ee:	41 81 fc 00 04 00 00 	cmp    $0x400,%r12d
+  8002f5:	75 bc                	jne    8002b3 <umain+0x6d>
+    }
+    close(fd);
+  8002f7:	44 89 ef             	mov    %r13d,%edi
+  8002fa:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  800301:	00 00 00 
+  800304:	ff d0                	call   *%rax
+
+    bench("/cat", &envs[ENVX(fsenv)]);
+  800306:	8b 45 8c             	mov    -0x74(%rbp),%eax
+  800309:	25 ff 03 00 00       	and    $0x3ff,%eax
+  80030e:	48 89 c3             	mov    %rax,%rbx
+  800311:	48 c1 e3 04          	shl    $0x4,%rbx
+  800315:	48 29 c3             	sub    %rax,%rbx
+  800318:	48 c1 e3 05          	shl    $0x5,%rbx
+  80031c:	48 b8 00 00 c0 1f 80 	movabs $0x801fc00000,%rax
+  800323:	00 00 00 
+  800326:	48 01 c3             	add    %rax,%rbx
+  800329:	48 89 de             	mov    %rbx,%rsi
+  80032c:	48 bf 2e 57 80 00 00 	movabs $0x80572e,%rdi
+  800333:	00 00 00 
+  800336:	49 bc 25 00 80 00 00 	movabs $0x800025,%r12
+  80033d:	00 00 00 
+  800340:	41 ff d4             	call   *%r12
+    bench("/num", &envs[ENVX(fsenv)]);
+  800343:	48 89 de             	mov    %rbx,%rsi
+  800346:	48 bf 33 57 80 00 00 	movabs $0x805733,%rdi
+  80034d:	00 00 00 
+  800350:	41 ff d4             	call   *%r12
+}
+  800353:	48 83 c4 58          	add    $0x58,%rsp
+  800357:	5b                   	pop    %rbx
+  800358:	41 5c                	pop    %r12
+  80035a:	41 5d                	pop    %r13
+  80035c:	41 5e                	pop    %r14
+  80035e:	41 5f                	pop    %r15
+  800360:	5d                   	pop    %rbp
+  800361:	c3                   	ret
+    if (!fsenv) panic("no file server");
+  800362:	48 ba f2 56 80 00 00 	movabs $0x8056f2,%rdx
+  800369:	00 00 00 
+  80036c:	be 29 00 00 00       	mov    $0x29,%esi
+  800371:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  800378:	00 00 00 
+  80037b:	48 b9 b5 04 80 00 00 	movabs $0x8004b5,%rcx
+  800382:	00 00 00 
+  800385:	ff d1                	call   *%rcx
+        panic("open /iobench.txt: %i", fd);
+  800387:	89 c1                	mov    %eax,%ecx
+  800389:	48 ba 01 57 80 00 00 	movabs $0x805701,%rdx
+  800390:	00 00 00 
+  800393:	be 2c 00 00 00       	mov    $0x2c,%esi
+  800398:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  80039f:	00 00 00 
+  8003a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a7:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8003ae:	00 00 00 
+  8003b1:	41 ff d0             	call   *%r8
+        if ((res = write(fd, line, n)) != n) panic("write /iobench.txt: %i", res);
+  8003b4:	48 ba 17 57 80 00 00 	movabs $0x805717,%rdx
+  8003bb:	00 00 00 
+  8003be:	be 2f 00 00 00       	mov    $0x2f,%esi
+  8003c3:	48 bf ab 56 80 00 00 	movabs $0x8056ab,%rdi
+  8003ca:	00 00 00 
+  8003cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003d2:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8003d9:	00 00 00 
+  8003dc:	41 ff d0             	call   *%r8
+
+00000000008003df <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8003df:	55                   	push   %rbp
+  8003e0:	48 89 e5             	mov    %rsp,%rbp
+  8003e3:	41 56                	push   %r14
+  8003e5:	41 55                	push   %r13
+  8003e7:	41 54                	push   %r12
+  8003e9:	53                   	push   %rbx
+  8003ea:	41 89 fd             	mov    %edi,%r13d
+  8003ed:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003f0:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  8003f7:	00 00 00 
+  8003fa:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  800401:	00 00 00 
+  800404:	48 39 c2             	cmp    %rax,%rdx
+  800407:	73 17                	jae    800420 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800409:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80040c:	49 89 c4             	mov    %rax,%r12
+  80040f:	48 83 c3 08          	add    $0x8,%rbx
+  800413:	b8 00 00 00 00       	mov    $0x0,%eax
+  800418:	ff 53 f8             	call   *-0x8(%rbx)
+  80041b:	4c 39 e3             	cmp    %r12,%rbx
+  80041e:	72 ef                	jb     80040f <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800420:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  800427:	00 00 00 
+  80042a:	ff d0                	call   *%rax
+  80042c:	89 c2                	mov    %eax,%edx
+  80042e:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800434:	48 89 d0             	mov    %rdx,%rax
+  800437:	48 c1 e0 04          	shl    $0x4,%rax
+  80043b:	48 29 d0             	sub    %rdx,%rax
+  80043e:	48 c1 e0 05          	shl    $0x5,%rax
+  800442:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800449:	00 00 00 
+  80044c:	48 01 d0             	add    %rdx,%rax
+  80044f:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800456:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800459:	45 85 ed             	test   %r13d,%r13d
+  80045c:	7e 0d                	jle    80046b <libmain+0x8c>
+  80045e:	49 8b 06             	mov    (%r14),%rax
+  800461:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800468:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80046b:	4c 89 f6             	mov    %r14,%rsi
+  80046e:	44 89 ef             	mov    %r13d,%edi
+  800471:	48 b8 46 02 80 00 00 	movabs $0x800246,%rax
+  800478:	00 00 00 
+  80047b:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80047d:	48 b8 92 04 80 00 00 	movabs $0x800492,%rax
+  800484:	00 00 00 
+  800487:	ff d0                	call   *%rax
+#endif
+}
+  800489:	5b                   	pop    %rbx
+  80048a:	41 5c                	pop    %r12
+  80048c:	41 5d                	pop    %r13
+  80048e:	41 5e                	pop    %r14
+  800490:	5d                   	pop    %rbp
+  800491:	c3                   	ret
+
+0000000000800492 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800492:	55                   	push   %rbp
+  800493:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800496:	48 b8 a9 1c 80 00 00 	movabs $0x801ca9,%rax
+  80049d:	00 00 00 
+  8004a0:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004a7:	48 b8 99 13 80 00 00 	movabs $0x801399,%rax
+  8004ae:	00 00 00 
+  8004b1:	ff d0                	call   *%rax
+}
+  8004b3:	5d                   	pop    %rbp
+  8004b4:	c3                   	ret
+
+00000000008004b5 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004b5:	55                   	push   %rbp
+  8004b6:	48 89 e5             	mov    %rsp,%rbp
+  8004b9:	41 56                	push   %r14
+  8004bb:	41 55                	push   %r13
+  8004bd:	41 54                	push   %r12
+  8004bf:	53                   	push   %rbx
+  8004c0:	48 83 ec 50          	sub    $0x50,%rsp
+  8004c4:	49 89 fc             	mov    %rdi,%r12
+  8004c7:	41 89 f5             	mov    %esi,%r13d
+  8004ca:	48 89 d3             	mov    %rdx,%rbx
+  8004cd:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004d1:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004d5:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8004d9:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8004e0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e4:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8004e8:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8004ec:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8004f0:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8004f7:	00 00 00 
+  8004fa:	4c 8b 30             	mov    (%rax),%r14
+  8004fd:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  800504:	00 00 00 
+  800507:	ff d0                	call   *%rax
+  800509:	89 c6                	mov    %eax,%esi
+  80050b:	45 89 e8             	mov    %r13d,%r8d
+  80050e:	4c 89 e1             	mov    %r12,%rcx
+  800511:	4c 89 f2             	mov    %r14,%rdx
+  800514:	48 bf d8 57 80 00 00 	movabs $0x8057d8,%rdi
+  80051b:	00 00 00 
+  80051e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800523:	49 bc 05 06 80 00 00 	movabs $0x800605,%r12
+  80052a:	00 00 00 
+  80052d:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800530:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800534:	48 89 df             	mov    %rbx,%rdi
+  800537:	48 b8 a1 05 80 00 00 	movabs $0x8005a1,%rax
+  80053e:	00 00 00 
+  800541:	ff d0                	call   *%rax
+    cprintf("\n");
+  800543:	48 bf 03 5e 80 00 00 	movabs $0x805e03,%rdi
+  80054a:	00 00 00 
+  80054d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800552:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800555:	cc                   	int3
+  800556:	eb fd                	jmp    800555 <_panic+0xa0>
+
+0000000000800558 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800558:	55                   	push   %rbp
+  800559:	48 89 e5             	mov    %rsp,%rbp
+  80055c:	53                   	push   %rbx
+  80055d:	48 83 ec 08          	sub    $0x8,%rsp
+  800561:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800564:	8b 06                	mov    (%rsi),%eax
+  800566:	8d 50 01             	lea    0x1(%rax),%edx
+  800569:	89 16                	mov    %edx,(%rsi)
+  80056b:	48 98                	cltq
+  80056d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800572:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800578:	74 0a                	je     800584 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80057a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80057e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800582:	c9                   	leave
+  800583:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800584:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800588:	be ff 00 00 00       	mov    $0xff,%esi
+  80058d:	48 b8 51 13 80 00 00 	movabs $0x801351,%rax
+  800594:	00 00 00 
+  800597:	ff d0                	call   *%rax
+        state->offset = 0;
+  800599:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80059f:	eb d9                	jmp    80057a <putch+0x22>
+
+00000000008005a1 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005a1:	55                   	push   %rbp
+  8005a2:	48 89 e5             	mov    %rsp,%rbp
+  8005a5:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005ac:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005af:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005b6:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005c0:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005c3:	48 89 f1             	mov    %rsi,%rcx
+  8005c6:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005cd:	48 bf 58 05 80 00 00 	movabs $0x800558,%rdi
+  8005d4:	00 00 00 
+  8005d7:	48 b8 55 07 80 00 00 	movabs $0x800755,%rax
+  8005de:	00 00 00 
+  8005e1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8005e3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8005ea:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8005f1:	48 b8 51 13 80 00 00 	movabs $0x801351,%rax
+  8005f8:	00 00 00 
+  8005fb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8005fd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800603:	c9                   	leave
+  800604:	c3                   	ret
+
+0000000000800605 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800605:	55                   	push   %rbp
+  800606:	48 89 e5             	mov    %rsp,%rbp
+  800609:	48 83 ec 50          	sub    $0x50,%rsp
+  80060d:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800611:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800615:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800619:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80061d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800621:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800628:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80062c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800630:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800634:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800638:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80063c:	48 b8 a1 05 80 00 00 	movabs $0x8005a1,%rax
+  800643:	00 00 00 
+  800646:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800648:	c9                   	leave
+  800649:	c3                   	ret
+
+000000000080064a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80064a:	55                   	push   %rbp
+  80064b:	48 89 e5             	mov    %rsp,%rbp
+  80064e:	41 57                	push   %r15
+  800650:	41 56                	push   %r14
+  800652:	41 55                	push   %r13
+  800654:	41 54                	push   %r12
+  800656:	53                   	push   %rbx
+  800657:	48 83 ec 18          	sub    $0x18,%rsp
+  80065b:	49 89 fc             	mov    %rdi,%r12
+  80065e:	49 89 f5             	mov    %rsi,%r13
+  800661:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800665:	8b 45 10             	mov    0x10(%rbp),%eax
+  800668:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80066b:	41 89 cf             	mov    %ecx,%r15d
+  80066e:	4c 39 fa             	cmp    %r15,%rdx
+  800671:	73 5b                	jae    8006ce <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800673:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800677:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80067b:	85 db                	test   %ebx,%ebx
+  80067d:	7e 0e                	jle    80068d <print_num+0x43>
+            putch(padc, put_arg);
+  80067f:	4c 89 ee             	mov    %r13,%rsi
+  800682:	44 89 f7             	mov    %r14d,%edi
+  800685:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800688:	83 eb 01             	sub    $0x1,%ebx
+  80068b:	75 f2                	jne    80067f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80068d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800691:	48 b9 0c 58 80 00 00 	movabs $0x80580c,%rcx
+  800698:	00 00 00 
+  80069b:	48 b8 fb 57 80 00 00 	movabs $0x8057fb,%rax
+  8006a2:	00 00 00 
+  8006a5:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006b2:	49 f7 f7             	div    %r15
+  8006b5:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006b9:	4c 89 ee             	mov    %r13,%rsi
+  8006bc:	41 ff d4             	call   *%r12
+}
+  8006bf:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006c3:	5b                   	pop    %rbx
+  8006c4:	41 5c                	pop    %r12
+  8006c6:	41 5d                	pop    %r13
+  8006c8:	41 5e                	pop    %r14
+  8006ca:	41 5f                	pop    %r15
+  8006cc:	5d                   	pop    %rbp
+  8006cd:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006ce:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006d2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006d7:	49 f7 f7             	div    %r15
+  8006da:	48 83 ec 08          	sub    $0x8,%rsp
+  8006de:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8006e2:	52                   	push   %rdx
+  8006e3:	45 0f be c9          	movsbl %r9b,%r9d
+  8006e7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8006eb:	48 89 c2             	mov    %rax,%rdx
+  8006ee:	48 b8 4a 06 80 00 00 	movabs $0x80064a,%rax
+  8006f5:	00 00 00 
+  8006f8:	ff d0                	call   *%rax
+  8006fa:	48 83 c4 10          	add    $0x10,%rsp
+  8006fe:	eb 8d                	jmp    80068d <print_num+0x43>
+
+0000000000800700 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800700:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800704:	48 8b 06             	mov    (%rsi),%rax
+  800707:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  80070b:	73 0a                	jae    800717 <sprintputch+0x17>
+        *state->start++ = ch;
+  80070d:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800711:	48 89 16             	mov    %rdx,(%rsi)
+  800714:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800717:	c3                   	ret
+
+0000000000800718 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800718:	55                   	push   %rbp
+  800719:	48 89 e5             	mov    %rsp,%rbp
+  80071c:	48 83 ec 50          	sub    $0x50,%rsp
+  800720:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800724:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800728:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80072c:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800733:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800737:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80073b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80073f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800743:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800747:	48 b8 55 07 80 00 00 	movabs $0x800755,%rax
+  80074e:	00 00 00 
+  800751:	ff d0                	call   *%rax
+}
+  800753:	c9                   	leave
+  800754:	c3                   	ret
+
+0000000000800755 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800755:	55                   	push   %rbp
+  800756:	48 89 e5             	mov    %rsp,%rbp
+  800759:	41 57                	push   %r15
+  80075b:	41 56                	push   %r14
+  80075d:	41 55                	push   %r13
+  80075f:	41 54                	push   %r12
+  800761:	53                   	push   %rbx
+  800762:	48 83 ec 38          	sub    $0x38,%rsp
+  800766:	49 89 fe             	mov    %rdi,%r14
+  800769:	49 89 f5             	mov    %rsi,%r13
+  80076c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80076f:	48 8b 01             	mov    (%rcx),%rax
+  800772:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800776:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80077a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80077e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800782:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800786:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80078a:	0f b6 3b             	movzbl (%rbx),%edi
+  80078d:	40 80 ff 25          	cmp    $0x25,%dil
+  800791:	74 18                	je     8007ab <vprintfmt+0x56>
+            if (!ch) return;
+  800793:	40 84 ff             	test   %dil,%dil
+  800796:	0f 84 b1 06 00 00    	je     800e4d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80079c:	40 0f b6 ff          	movzbl %dil,%edi
+  8007a0:	4c 89 ee             	mov    %r13,%rsi
+  8007a3:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007a6:	4c 89 e3             	mov    %r12,%rbx
+  8007a9:	eb db                	jmp    800786 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8007b0:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007b4:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007b9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007bf:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007c6:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007ca:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007cf:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007d4:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007d7:	83 e8 23             	sub    $0x23,%eax
+  8007da:	3c 57                	cmp    $0x57,%al
+  8007dc:	0f 87 51 06 00 00    	ja     800e33 <vprintfmt+0x6de>
+  8007e2:	0f b6 c0             	movzbl %al,%eax
+  8007e5:	48 b9 c0 59 80 00 00 	movabs $0x8059c0,%rcx
+  8007ec:	00 00 00 
+  8007ef:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8007f2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8007f5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8007f9:	eb cf                	jmp    8007ca <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8007fb:	49 89 dc             	mov    %rbx,%r12
+  8007fe:	be 01 00 00 00       	mov    $0x1,%esi
+  800803:	eb c5                	jmp    8007ca <vprintfmt+0x75>
+            padc = ch;
+  800805:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800809:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80080c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80080f:	eb b9                	jmp    8007ca <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800811:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800814:	83 f8 2f             	cmp    $0x2f,%eax
+  800817:	77 24                	ja     80083d <vprintfmt+0xe8>
+  800819:	89 c1                	mov    %eax,%ecx
+  80081b:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80081f:	83 c0 08             	add    $0x8,%eax
+  800822:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800825:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800828:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  80082b:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80082f:	79 99                	jns    8007ca <vprintfmt+0x75>
+                width = precision;
+  800831:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800835:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80083b:	eb 8d                	jmp    8007ca <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80083d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800841:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800845:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800849:	eb da                	jmp    800825 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80084b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800850:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800854:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80085a:	3c 39                	cmp    $0x39,%al
+  80085c:	77 1c                	ja     80087a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80085e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800862:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800866:	0f b6 c0             	movzbl %al,%eax
+  800869:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80086e:	0f b6 03             	movzbl (%rbx),%eax
+  800871:	3c 39                	cmp    $0x39,%al
+  800873:	76 e9                	jbe    80085e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800875:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800878:	eb b1                	jmp    80082b <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80087a:	49 89 dc             	mov    %rbx,%r12
+  80087d:	eb ac                	jmp    80082b <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80087f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800882:	85 c9                	test   %ecx,%ecx
+  800884:	b8 00 00 00 00       	mov    $0x0,%eax
+  800889:	0f 49 c1             	cmovns %ecx,%eax
+  80088c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80088f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800892:	e9 33 ff ff ff       	jmp    8007ca <vprintfmt+0x75>
+            lflag++;
+  800897:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80089a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80089d:	e9 28 ff ff ff       	jmp    8007ca <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008a8:	77 19                	ja     8008c3 <vprintfmt+0x16e>
+  8008aa:	89 c2                	mov    %eax,%edx
+  8008ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b0:	83 c0 08             	add    $0x8,%eax
+  8008b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008b6:	8b 3a                	mov    (%rdx),%edi
+  8008b8:	4c 89 ee             	mov    %r13,%rsi
+  8008bb:	41 ff d6             	call   *%r14
+            break;
+  8008be:	e9 c3 fe ff ff       	jmp    800786 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cf:	eb e5                	jmp    8008b6 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d7:	77 5a                	ja     800933 <vprintfmt+0x1de>
+  8008d9:	89 c2                	mov    %eax,%edx
+  8008db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008df:	83 c0 08             	add    $0x8,%eax
+  8008e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8008e5:	8b 02                	mov    (%rdx),%eax
+  8008e7:	89 c1                	mov    %eax,%ecx
+  8008e9:	f7 d9                	neg    %ecx
+  8008eb:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8008ee:	83 f9 16             	cmp    $0x16,%ecx
+  8008f1:	7f 4e                	jg     800941 <vprintfmt+0x1ec>
+  8008f3:	48 63 c1             	movslq %ecx,%rax
+  8008f6:	48 ba 80 5c 80 00 00 	movabs $0x805c80,%rdx
+  8008fd:	00 00 00 
+  800900:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800904:	48 85 c0             	test   %rax,%rax
+  800907:	74 38                	je     800941 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800909:	48 89 c1             	mov    %rax,%rcx
+  80090c:	48 ba 43 5f 80 00 00 	movabs $0x805f43,%rdx
+  800913:	00 00 00 
+  800916:	4c 89 ee             	mov    %r13,%rsi
+  800919:	4c 89 f7             	mov    %r14,%rdi
+  80091c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800921:	49 b8 18 07 80 00 00 	movabs $0x800718,%r8
+  800928:	00 00 00 
+  80092b:	41 ff d0             	call   *%r8
+  80092e:	e9 53 fe ff ff       	jmp    800786 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800933:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800937:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80093b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80093f:	eb a4                	jmp    8008e5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800941:	48 ba 24 58 80 00 00 	movabs $0x805824,%rdx
+  800948:	00 00 00 
+  80094b:	4c 89 ee             	mov    %r13,%rsi
+  80094e:	4c 89 f7             	mov    %r14,%rdi
+  800951:	b8 00 00 00 00       	mov    $0x0,%eax
+  800956:	49 b8 18 07 80 00 00 	movabs $0x800718,%r8
+  80095d:	00 00 00 
+  800960:	41 ff d0             	call   *%r8
+  800963:	e9 1e fe ff ff       	jmp    800786 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800968:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096b:	83 f8 2f             	cmp    $0x2f,%eax
+  80096e:	77 6c                	ja     8009dc <vprintfmt+0x287>
+  800970:	89 c2                	mov    %eax,%edx
+  800972:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800976:	83 c0 08             	add    $0x8,%eax
+  800979:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80097f:	48 85 d2             	test   %rdx,%rdx
+  800982:	48 b8 1d 58 80 00 00 	movabs $0x80581d,%rax
+  800989:	00 00 00 
+  80098c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800990:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800994:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800998:	7e 06                	jle    8009a0 <vprintfmt+0x24b>
+  80099a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80099e:	75 4a                	jne    8009ea <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009a0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009a4:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009a8:	0f b6 00             	movzbl (%rax),%eax
+  8009ab:	84 c0                	test   %al,%al
+  8009ad:	0f 85 9a 00 00 00    	jne    800a4d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009b3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009b6:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009ba:	85 c0                	test   %eax,%eax
+  8009bc:	0f 8e c4 fd ff ff    	jle    800786 <vprintfmt+0x31>
+  8009c2:	4c 89 ee             	mov    %r13,%rsi
+  8009c5:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009ca:	41 ff d6             	call   *%r14
+  8009cd:	41 83 ec 01          	sub    $0x1,%r12d
+  8009d1:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009d5:	75 eb                	jne    8009c2 <vprintfmt+0x26d>
+  8009d7:	e9 aa fd ff ff       	jmp    800786 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009dc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e8:	eb 92                	jmp    80097c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8009ea:	49 63 f7             	movslq %r15d,%rsi
+  8009ed:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8009f1:	48 b8 07 0f 80 00 00 	movabs $0x800f07,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+  8009fd:	48 89 c2             	mov    %rax,%rdx
+  800a00:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a03:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a05:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a08:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a0b:	85 c0                	test   %eax,%eax
+  800a0d:	7e 91                	jle    8009a0 <vprintfmt+0x24b>
+  800a0f:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a14:	4c 89 ee             	mov    %r13,%rsi
+  800a17:	44 89 e7             	mov    %r12d,%edi
+  800a1a:	41 ff d6             	call   *%r14
+  800a1d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a21:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a24:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a27:	75 eb                	jne    800a14 <vprintfmt+0x2bf>
+  800a29:	e9 72 ff ff ff       	jmp    8009a0 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a2e:	0f b6 f8             	movzbl %al,%edi
+  800a31:	4c 89 ee             	mov    %r13,%rsi
+  800a34:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a37:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a3b:	49 83 c4 01          	add    $0x1,%r12
+  800a3f:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a45:	84 c0                	test   %al,%al
+  800a47:	0f 84 66 ff ff ff    	je     8009b3 <vprintfmt+0x25e>
+  800a4d:	45 85 ff             	test   %r15d,%r15d
+  800a50:	78 0a                	js     800a5c <vprintfmt+0x307>
+  800a52:	41 83 ef 01          	sub    $0x1,%r15d
+  800a56:	0f 88 57 ff ff ff    	js     8009b3 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a5c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a60:	74 cc                	je     800a2e <vprintfmt+0x2d9>
+  800a62:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a65:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a6a:	80 fa 5e             	cmp    $0x5e,%dl
+  800a6d:	77 c2                	ja     800a31 <vprintfmt+0x2dc>
+  800a6f:	eb bd                	jmp    800a2e <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a71:	40 84 f6             	test   %sil,%sil
+  800a74:	75 26                	jne    800a9c <vprintfmt+0x347>
+    switch (lflag) {
+  800a76:	85 d2                	test   %edx,%edx
+  800a78:	74 59                	je     800ad3 <vprintfmt+0x37e>
+  800a7a:	83 fa 01             	cmp    $0x1,%edx
+  800a7d:	74 7b                	je     800afa <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a82:	83 f8 2f             	cmp    $0x2f,%eax
+  800a85:	0f 87 96 00 00 00    	ja     800b21 <vprintfmt+0x3cc>
+  800a8b:	89 c2                	mov    %eax,%edx
+  800a8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a91:	83 c0 08             	add    $0x8,%eax
+  800a94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a97:	4c 8b 22             	mov    (%rdx),%r12
+  800a9a:	eb 17                	jmp    800ab3 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a9c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9f:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa2:	77 21                	ja     800ac5 <vprintfmt+0x370>
+  800aa4:	89 c2                	mov    %eax,%edx
+  800aa6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaa:	83 c0 08             	add    $0x8,%eax
+  800aad:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab0:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800ab3:	4d 85 e4             	test   %r12,%r12
+  800ab6:	78 7a                	js     800b32 <vprintfmt+0x3dd>
+            num = i;
+  800ab8:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800abb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ac0:	e9 50 02 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad1:	eb dd                	jmp    800ab0 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800ad3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad9:	77 11                	ja     800aec <vprintfmt+0x397>
+  800adb:	89 c2                	mov    %eax,%edx
+  800add:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae1:	83 c0 08             	add    $0x8,%eax
+  800ae4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae7:	4c 63 22             	movslq (%rdx),%r12
+  800aea:	eb c7                	jmp    800ab3 <vprintfmt+0x35e>
+  800aec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af8:	eb ed                	jmp    800ae7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800afa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afd:	83 f8 2f             	cmp    $0x2f,%eax
+  800b00:	77 11                	ja     800b13 <vprintfmt+0x3be>
+  800b02:	89 c2                	mov    %eax,%edx
+  800b04:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b08:	83 c0 08             	add    $0x8,%eax
+  800b0b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0e:	4c 8b 22             	mov    (%rdx),%r12
+  800b11:	eb a0                	jmp    800ab3 <vprintfmt+0x35e>
+  800b13:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b17:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1f:	eb ed                	jmp    800b0e <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2d:	e9 65 ff ff ff       	jmp    800a97 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b32:	4c 89 ee             	mov    %r13,%rsi
+  800b35:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b3a:	41 ff d6             	call   *%r14
+                i = -i;
+  800b3d:	49 f7 dc             	neg    %r12
+  800b40:	e9 73 ff ff ff       	jmp    800ab8 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b45:	40 84 f6             	test   %sil,%sil
+  800b48:	75 32                	jne    800b7c <vprintfmt+0x427>
+    switch (lflag) {
+  800b4a:	85 d2                	test   %edx,%edx
+  800b4c:	74 5d                	je     800bab <vprintfmt+0x456>
+  800b4e:	83 fa 01             	cmp    $0x1,%edx
+  800b51:	0f 84 82 00 00 00    	je     800bd9 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b57:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b5a:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5d:	0f 87 a5 00 00 00    	ja     800c08 <vprintfmt+0x4b3>
+  800b63:	89 c2                	mov    %eax,%edx
+  800b65:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b69:	83 c0 08             	add    $0x8,%eax
+  800b6c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b72:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b77:	e9 99 01 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b7c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b7f:	83 f8 2f             	cmp    $0x2f,%eax
+  800b82:	77 19                	ja     800b9d <vprintfmt+0x448>
+  800b84:	89 c2                	mov    %eax,%edx
+  800b86:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b8a:	83 c0 08             	add    $0x8,%eax
+  800b8d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b90:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b93:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b98:	e9 78 01 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+  800b9d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ba9:	eb e5                	jmp    800b90 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bae:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb1:	77 18                	ja     800bcb <vprintfmt+0x476>
+  800bb3:	89 c2                	mov    %eax,%edx
+  800bb5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb9:	83 c0 08             	add    $0x8,%eax
+  800bbc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bbf:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800bc1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bc6:	e9 4a 01 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+  800bcb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bcf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bd3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd7:	eb e6                	jmp    800bbf <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800bd9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bdc:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdf:	77 19                	ja     800bfa <vprintfmt+0x4a5>
+  800be1:	89 c2                	mov    %eax,%edx
+  800be3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be7:	83 c0 08             	add    $0x8,%eax
+  800bea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bf0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800bf5:	e9 1b 01 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+  800bfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c06:	eb e5                	jmp    800bed <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c14:	e9 56 ff ff ff       	jmp    800b6f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c19:	40 84 f6             	test   %sil,%sil
+  800c1c:	75 2e                	jne    800c4c <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c1e:	85 d2                	test   %edx,%edx
+  800c20:	74 59                	je     800c7b <vprintfmt+0x526>
+  800c22:	83 fa 01             	cmp    $0x1,%edx
+  800c25:	74 7f                	je     800ca6 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800c2d:	0f 87 9f 00 00 00    	ja     800cd2 <vprintfmt+0x57d>
+  800c33:	89 c2                	mov    %eax,%edx
+  800c35:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c39:	83 c0 08             	add    $0x8,%eax
+  800c3c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c3f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c42:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c47:	e9 c9 00 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c4c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c4f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c52:	77 19                	ja     800c6d <vprintfmt+0x518>
+  800c54:	89 c2                	mov    %eax,%edx
+  800c56:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c5a:	83 c0 08             	add    $0x8,%eax
+  800c5d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c60:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c63:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c68:	e9 a8 00 00 00       	jmp    800d15 <vprintfmt+0x5c0>
+  800c6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c79:	eb e5                	jmp    800c60 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c7b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c7e:	83 f8 2f             	cmp    $0x2f,%eax
+  800c81:	77 15                	ja     800c98 <vprintfmt+0x543>
+  800c83:	89 c2                	mov    %eax,%edx
+  800c85:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c89:	83 c0 08             	add    $0x8,%eax
+  800c8c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c8f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c91:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c96:	eb 7d                	jmp    800d15 <vprintfmt+0x5c0>
+  800c98:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c9c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ca0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca4:	eb e9                	jmp    800c8f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800ca6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cac:	77 16                	ja     800cc4 <vprintfmt+0x56f>
+  800cae:	89 c2                	mov    %eax,%edx
+  800cb0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb4:	83 c0 08             	add    $0x8,%eax
+  800cb7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cba:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cbd:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cc2:	eb 51                	jmp    800d15 <vprintfmt+0x5c0>
+  800cc4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ccc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd0:	eb e8                	jmp    800cba <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800cd2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cd6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cda:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cde:	e9 5c ff ff ff       	jmp    800c3f <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800ce3:	4c 89 ee             	mov    %r13,%rsi
+  800ce6:	bf 30 00 00 00       	mov    $0x30,%edi
+  800ceb:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800cee:	4c 89 ee             	mov    %r13,%rsi
+  800cf1:	bf 78 00 00 00       	mov    $0x78,%edi
+  800cf6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800cf9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfc:	83 f8 2f             	cmp    $0x2f,%eax
+  800cff:	77 47                	ja     800d48 <vprintfmt+0x5f3>
+  800d01:	89 c2                	mov    %eax,%edx
+  800d03:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d07:	83 c0 08             	add    $0x8,%eax
+  800d0a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d0d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d10:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d15:	48 83 ec 08          	sub    $0x8,%rsp
+  800d19:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d1d:	0f 94 c0             	sete   %al
+  800d20:	0f b6 c0             	movzbl %al,%eax
+  800d23:	50                   	push   %rax
+  800d24:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d29:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d2d:	4c 89 ee             	mov    %r13,%rsi
+  800d30:	4c 89 f7             	mov    %r14,%rdi
+  800d33:	48 b8 4a 06 80 00 00 	movabs $0x80064a,%rax
+  800d3a:	00 00 00 
+  800d3d:	ff d0                	call   *%rax
+            break;
+  800d3f:	48 83 c4 10          	add    $0x10,%rsp
+  800d43:	e9 3e fa ff ff       	jmp    800786 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d48:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d4c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d50:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d54:	eb b7                	jmp    800d0d <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d56:	40 84 f6             	test   %sil,%sil
+  800d59:	75 2b                	jne    800d86 <vprintfmt+0x631>
+    switch (lflag) {
+  800d5b:	85 d2                	test   %edx,%edx
+  800d5d:	74 56                	je     800db5 <vprintfmt+0x660>
+  800d5f:	83 fa 01             	cmp    $0x1,%edx
+  800d62:	74 7f                	je     800de3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d64:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d67:	83 f8 2f             	cmp    $0x2f,%eax
+  800d6a:	0f 87 a2 00 00 00    	ja     800e12 <vprintfmt+0x6bd>
+  800d70:	89 c2                	mov    %eax,%edx
+  800d72:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d76:	83 c0 08             	add    $0x8,%eax
+  800d79:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d7c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d84:	eb 8f                	jmp    800d15 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d86:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d89:	83 f8 2f             	cmp    $0x2f,%eax
+  800d8c:	77 19                	ja     800da7 <vprintfmt+0x652>
+  800d8e:	89 c2                	mov    %eax,%edx
+  800d90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d94:	83 c0 08             	add    $0x8,%eax
+  800d97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d9d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800da2:	e9 6e ff ff ff       	jmp    800d15 <vprintfmt+0x5c0>
+  800da7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db3:	eb e5                	jmp    800d9a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800db5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db8:	83 f8 2f             	cmp    $0x2f,%eax
+  800dbb:	77 18                	ja     800dd5 <vprintfmt+0x680>
+  800dbd:	89 c2                	mov    %eax,%edx
+  800dbf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dc3:	83 c0 08             	add    $0x8,%eax
+  800dc6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc9:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800dcb:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800dd0:	e9 40 ff ff ff       	jmp    800d15 <vprintfmt+0x5c0>
+  800dd5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ddd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de1:	eb e6                	jmp    800dc9 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800de3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de6:	83 f8 2f             	cmp    $0x2f,%eax
+  800de9:	77 19                	ja     800e04 <vprintfmt+0x6af>
+  800deb:	89 c2                	mov    %eax,%edx
+  800ded:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df1:	83 c0 08             	add    $0x8,%eax
+  800df4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dfa:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800dff:	e9 11 ff ff ff       	jmp    800d15 <vprintfmt+0x5c0>
+  800e04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e10:	eb e5                	jmp    800df7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1e:	e9 59 ff ff ff       	jmp    800d7c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e23:	4c 89 ee             	mov    %r13,%rsi
+  800e26:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e2b:	41 ff d6             	call   *%r14
+            break;
+  800e2e:	e9 53 f9 ff ff       	jmp    800786 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e33:	4c 89 ee             	mov    %r13,%rsi
+  800e36:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e3b:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e3e:	48 83 eb 01          	sub    $0x1,%rbx
+  800e42:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e46:	75 f6                	jne    800e3e <vprintfmt+0x6e9>
+  800e48:	e9 39 f9 ff ff       	jmp    800786 <vprintfmt+0x31>
+}
+  800e4d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e51:	5b                   	pop    %rbx
+  800e52:	41 5c                	pop    %r12
+  800e54:	41 5d                	pop    %r13
+  800e56:	41 5e                	pop    %r14
+  800e58:	41 5f                	pop    %r15
+  800e5a:	5d                   	pop    %rbp
+  800e5b:	c3                   	ret
+
+0000000000800e5c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e5c:	55                   	push   %rbp
+  800e5d:	48 89 e5             	mov    %rsp,%rbp
+  800e60:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e64:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e68:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e6d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e71:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e78:	48 85 ff             	test   %rdi,%rdi
+  800e7b:	74 2b                	je     800ea8 <vsnprintf+0x4c>
+  800e7d:	48 85 f6             	test   %rsi,%rsi
+  800e80:	74 26                	je     800ea8 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e82:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e86:	48 bf 00 07 80 00 00 	movabs $0x800700,%rdi
+  800e8d:	00 00 00 
+  800e90:	48 b8 55 07 80 00 00 	movabs $0x800755,%rax
+  800e97:	00 00 00 
+  800e9a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e9c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ea0:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ea3:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ea6:	c9                   	leave
+  800ea7:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ea8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ead:	eb f7                	jmp    800ea6 <vsnprintf+0x4a>
+
+0000000000800eaf <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800eaf:	55                   	push   %rbp
+  800eb0:	48 89 e5             	mov    %rsp,%rbp
+  800eb3:	48 83 ec 50          	sub    $0x50,%rsp
+  800eb7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ebb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ebf:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800ec3:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800eca:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ece:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ed2:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800ed6:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800eda:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800ede:	48 b8 5c 0e 80 00 00 	movabs $0x800e5c,%rax
+  800ee5:	00 00 00 
+  800ee8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800eea:	c9                   	leave
+  800eeb:	c3                   	ret
+
+0000000000800eec <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800eec:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800eef:	74 10                	je     800f01 <strlen+0x15>
+    size_t n = 0;
+  800ef1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ef6:	48 83 c0 01          	add    $0x1,%rax
+  800efa:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800efe:	75 f6                	jne    800ef6 <strlen+0xa>
+  800f00:	c3                   	ret
+    size_t n = 0;
+  800f01:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f06:	c3                   	ret
+
+0000000000800f07 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f07:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f0a:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f0f:	48 85 f6             	test   %rsi,%rsi
+  800f12:	74 11                	je     800f25 <strnlen+0x1e>
+  800f14:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f18:	74 0c                	je     800f26 <strnlen+0x1f>
+  800f1a:	48 83 c2 01          	add    $0x1,%rdx
+  800f1e:	48 39 d0             	cmp    %rdx,%rax
+  800f21:	75 f1                	jne    800f14 <strnlen+0xd>
+  800f23:	eb 04                	jmp    800f29 <strnlen+0x22>
+  800f25:	c3                   	ret
+  800f26:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f29:	c3                   	ret
+
+0000000000800f2a <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f2a:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f32:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f36:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f39:	48 83 c2 01          	add    $0x1,%rdx
+  800f3d:	84 c9                	test   %cl,%cl
+  800f3f:	75 f1                	jne    800f32 <strcpy+0x8>
+        ;
+    return res;
+}
+  800f41:	c3                   	ret
+
+0000000000800f42 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f42:	55                   	push   %rbp
+  800f43:	48 89 e5             	mov    %rsp,%rbp
+  800f46:	41 54                	push   %r12
+  800f48:	53                   	push   %rbx
+  800f49:	48 89 fb             	mov    %rdi,%rbx
+  800f4c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f4f:	48 b8 ec 0e 80 00 00 	movabs $0x800eec,%rax
+  800f56:	00 00 00 
+  800f59:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f5b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f5f:	4c 89 e6             	mov    %r12,%rsi
+  800f62:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  800f69:	00 00 00 
+  800f6c:	ff d0                	call   *%rax
+    return dst;
+}
+  800f6e:	48 89 d8             	mov    %rbx,%rax
+  800f71:	5b                   	pop    %rbx
+  800f72:	41 5c                	pop    %r12
+  800f74:	5d                   	pop    %rbp
+  800f75:	c3                   	ret
+
+0000000000800f76 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f76:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f79:	48 85 d2             	test   %rdx,%rdx
+  800f7c:	74 1f                	je     800f9d <strncpy+0x27>
+  800f7e:	48 01 fa             	add    %rdi,%rdx
+  800f81:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f84:	48 83 c1 01          	add    $0x1,%rcx
+  800f88:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f8c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f90:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f94:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f98:	48 39 ca             	cmp    %rcx,%rdx
+  800f9b:	75 e7                	jne    800f84 <strncpy+0xe>
+    }
+    return ret;
+}
+  800f9d:	c3                   	ret
+
+0000000000800f9e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f9e:	48 89 f8             	mov    %rdi,%rax
+  800fa1:	48 85 d2             	test   %rdx,%rdx
+  800fa4:	74 24                	je     800fca <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fa6:	48 83 ea 01          	sub    $0x1,%rdx
+  800faa:	74 1b                	je     800fc7 <strlcpy+0x29>
+  800fac:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fb0:	0f b6 16             	movzbl (%rsi),%edx
+  800fb3:	84 d2                	test   %dl,%dl
+  800fb5:	74 10                	je     800fc7 <strlcpy+0x29>
+            *dst++ = *src++;
+  800fb7:	48 83 c6 01          	add    $0x1,%rsi
+  800fbb:	48 83 c0 01          	add    $0x1,%rax
+  800fbf:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fc2:	48 39 c8             	cmp    %rcx,%rax
+  800fc5:	75 e9                	jne    800fb0 <strlcpy+0x12>
+        *dst = '\0';
+  800fc7:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800fca:	48 29 f8             	sub    %rdi,%rax
+}
+  800fcd:	c3                   	ret
+
+0000000000800fce <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800fce:	0f b6 07             	movzbl (%rdi),%eax
+  800fd1:	84 c0                	test   %al,%al
+  800fd3:	74 13                	je     800fe8 <strcmp+0x1a>
+  800fd5:	38 06                	cmp    %al,(%rsi)
+  800fd7:	75 0f                	jne    800fe8 <strcmp+0x1a>
+  800fd9:	48 83 c7 01          	add    $0x1,%rdi
+  800fdd:	48 83 c6 01          	add    $0x1,%rsi
+  800fe1:	0f b6 07             	movzbl (%rdi),%eax
+  800fe4:	84 c0                	test   %al,%al
+  800fe6:	75 ed                	jne    800fd5 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fe8:	0f b6 c0             	movzbl %al,%eax
+  800feb:	0f b6 16             	movzbl (%rsi),%edx
+  800fee:	29 d0                	sub    %edx,%eax
+}
+  800ff0:	c3                   	ret
+
+0000000000800ff1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ff1:	48 85 d2             	test   %rdx,%rdx
+  800ff4:	74 1f                	je     801015 <strncmp+0x24>
+  800ff6:	0f b6 07             	movzbl (%rdi),%eax
+  800ff9:	84 c0                	test   %al,%al
+  800ffb:	74 1e                	je     80101b <strncmp+0x2a>
+  800ffd:	3a 06                	cmp    (%rsi),%al
+  800fff:	75 1a                	jne    80101b <strncmp+0x2a>
+  801001:	48 83 c7 01          	add    $0x1,%rdi
+  801005:	48 83 c6 01          	add    $0x1,%rsi
+  801009:	48 83 ea 01          	sub    $0x1,%rdx
+  80100d:	75 e7                	jne    800ff6 <strncmp+0x5>
+
+    if (!n) return 0;
+  80100f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801014:	c3                   	ret
+  801015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80101a:	c3                   	ret
+  80101b:	48 85 d2             	test   %rdx,%rdx
+  80101e:	74 09                	je     801029 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801020:	0f b6 07             	movzbl (%rdi),%eax
+  801023:	0f b6 16             	movzbl (%rsi),%edx
+  801026:	29 d0                	sub    %edx,%eax
+  801028:	c3                   	ret
+    if (!n) return 0;
+  801029:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80102e:	c3                   	ret
+
+000000000080102f <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80102f:	0f b6 17             	movzbl (%rdi),%edx
+  801032:	84 d2                	test   %dl,%dl
+  801034:	74 18                	je     80104e <strchr+0x1f>
+        if (*str == c) {
+  801036:	0f be d2             	movsbl %dl,%edx
+  801039:	39 f2                	cmp    %esi,%edx
+  80103b:	74 17                	je     801054 <strchr+0x25>
+    for (; *str; str++) {
+  80103d:	48 83 c7 01          	add    $0x1,%rdi
+  801041:	0f b6 17             	movzbl (%rdi),%edx
+  801044:	84 d2                	test   %dl,%dl
+  801046:	75 ee                	jne    801036 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801048:	b8 00 00 00 00       	mov    $0x0,%eax
+  80104d:	c3                   	ret
+  80104e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801053:	c3                   	ret
+  801054:	48 89 f8             	mov    %rdi,%rax
+}
+  801057:	c3                   	ret
+
+0000000000801058 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801058:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80105b:	0f b6 17             	movzbl (%rdi),%edx
+  80105e:	84 d2                	test   %dl,%dl
+  801060:	74 13                	je     801075 <strfind+0x1d>
+  801062:	0f be d2             	movsbl %dl,%edx
+  801065:	39 f2                	cmp    %esi,%edx
+  801067:	74 0b                	je     801074 <strfind+0x1c>
+  801069:	48 83 c0 01          	add    $0x1,%rax
+  80106d:	0f b6 10             	movzbl (%rax),%edx
+  801070:	84 d2                	test   %dl,%dl
+  801072:	75 ee                	jne    801062 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801074:	c3                   	ret
+  801075:	c3                   	ret
+
+0000000000801076 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801076:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801079:	48 89 f8             	mov    %rdi,%rax
+  80107c:	48 f7 d8             	neg    %rax
+  80107f:	83 e0 07             	and    $0x7,%eax
+  801082:	49 89 d1             	mov    %rdx,%r9
+  801085:	49 29 c1             	sub    %rax,%r9
+  801088:	78 36                	js     8010c0 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80108a:	40 0f b6 c6          	movzbl %sil,%eax
+  80108e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801095:	01 01 01 
+  801098:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80109c:	40 f6 c7 07          	test   $0x7,%dil
+  8010a0:	75 38                	jne    8010da <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010a2:	4c 89 c9             	mov    %r9,%rcx
+  8010a5:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010a9:	74 0c                	je     8010b7 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010ab:	fc                   	cld
+  8010ac:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010af:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010b3:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010b7:	4d 85 c9             	test   %r9,%r9
+  8010ba:	75 45                	jne    801101 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010bc:	4c 89 c0             	mov    %r8,%rax
+  8010bf:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010c0:	48 85 d2             	test   %rdx,%rdx
+  8010c3:	74 f7                	je     8010bc <memset+0x46>
+  8010c5:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010c8:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010cb:	48 83 c0 01          	add    $0x1,%rax
+  8010cf:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010d3:	48 39 c2             	cmp    %rax,%rdx
+  8010d6:	75 f3                	jne    8010cb <memset+0x55>
+  8010d8:	eb e2                	jmp    8010bc <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8010da:	40 f6 c7 01          	test   $0x1,%dil
+  8010de:	74 06                	je     8010e6 <memset+0x70>
+  8010e0:	88 07                	mov    %al,(%rdi)
+  8010e2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010e6:	40 f6 c7 02          	test   $0x2,%dil
+  8010ea:	74 07                	je     8010f3 <memset+0x7d>
+  8010ec:	66 89 07             	mov    %ax,(%rdi)
+  8010ef:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8010f3:	40 f6 c7 04          	test   $0x4,%dil
+  8010f7:	74 a9                	je     8010a2 <memset+0x2c>
+  8010f9:	89 07                	mov    %eax,(%rdi)
+  8010fb:	48 83 c7 04          	add    $0x4,%rdi
+  8010ff:	eb a1                	jmp    8010a2 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801101:	41 f6 c1 04          	test   $0x4,%r9b
+  801105:	74 06                	je     80110d <memset+0x97>
+  801107:	89 07                	mov    %eax,(%rdi)
+  801109:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80110d:	41 f6 c1 02          	test   $0x2,%r9b
+  801111:	74 07                	je     80111a <memset+0xa4>
+  801113:	66 89 07             	mov    %ax,(%rdi)
+  801116:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  80111a:	41 f6 c1 01          	test   $0x1,%r9b
+  80111e:	74 9c                	je     8010bc <memset+0x46>
+  801120:	88 07                	mov    %al,(%rdi)
+  801122:	eb 98                	jmp    8010bc <memset+0x46>
+
+0000000000801124 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801124:	48 89 f8             	mov    %rdi,%rax
+  801127:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  80112a:	48 39 fe             	cmp    %rdi,%rsi
+  80112d:	73 3b                	jae    80116a <memmove+0x46>
+  80112f:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801133:	48 39 d7             	cmp    %rdx,%rdi
+  801136:	73 32                	jae    80116a <memmove+0x46>
+        s += n;
+        d += n;
+  801138:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80113c:	48 89 d6             	mov    %rdx,%rsi
+  80113f:	48 09 fe             	or     %rdi,%rsi
+  801142:	48 09 ce             	or     %rcx,%rsi
+  801145:	40 f6 c6 07          	test   $0x7,%sil
+  801149:	75 12                	jne    80115d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80114b:	48 83 ef 08          	sub    $0x8,%rdi
+  80114f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801153:	48 c1 e9 03          	shr    $0x3,%rcx
+  801157:	fd                   	std
+  801158:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80115b:	fc                   	cld
+  80115c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80115d:	48 83 ef 01          	sub    $0x1,%rdi
+  801161:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801165:	fd                   	std
+  801166:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801168:	eb f1                	jmp    80115b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80116a:	48 89 f2             	mov    %rsi,%rdx
+  80116d:	48 09 c2             	or     %rax,%rdx
+  801170:	48 09 ca             	or     %rcx,%rdx
+  801173:	f6 c2 07             	test   $0x7,%dl
+  801176:	75 0c                	jne    801184 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801178:	48 c1 e9 03          	shr    $0x3,%rcx
+  80117c:	48 89 c7             	mov    %rax,%rdi
+  80117f:	fc                   	cld
+  801180:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801183:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801184:	48 89 c7             	mov    %rax,%rdi
+  801187:	fc                   	cld
+  801188:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80118a:	c3                   	ret
+
+000000000080118b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80118b:	55                   	push   %rbp
+  80118c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80118f:	48 b8 24 11 80 00 00 	movabs $0x801124,%rax
+  801196:	00 00 00 
+  801199:	ff d0                	call   *%rax
+}
+  80119b:	5d                   	pop    %rbp
+  80119c:	c3                   	ret
+
+000000000080119d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	41 57                	push   %r15
+  8011a3:	41 56                	push   %r14
+  8011a5:	41 55                	push   %r13
+  8011a7:	41 54                	push   %r12
+  8011a9:	53                   	push   %rbx
+  8011aa:	48 83 ec 08          	sub    $0x8,%rsp
+  8011ae:	49 89 fe             	mov    %rdi,%r14
+  8011b1:	49 89 f7             	mov    %rsi,%r15
+  8011b4:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011b7:	48 89 f7             	mov    %rsi,%rdi
+  8011ba:	48 b8 ec 0e 80 00 00 	movabs $0x800eec,%rax
+  8011c1:	00 00 00 
+  8011c4:	ff d0                	call   *%rax
+  8011c6:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011c9:	48 89 de             	mov    %rbx,%rsi
+  8011cc:	4c 89 f7             	mov    %r14,%rdi
+  8011cf:	48 b8 07 0f 80 00 00 	movabs $0x800f07,%rax
+  8011d6:	00 00 00 
+  8011d9:	ff d0                	call   *%rax
+  8011db:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011de:	48 39 c3             	cmp    %rax,%rbx
+  8011e1:	74 36                	je     801219 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8011e3:	48 89 d8             	mov    %rbx,%rax
+  8011e6:	4c 29 e8             	sub    %r13,%rax
+  8011e9:	49 39 c4             	cmp    %rax,%r12
+  8011ec:	73 31                	jae    80121f <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8011ee:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8011f3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011f7:	4c 89 fe             	mov    %r15,%rsi
+  8011fa:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  801201:	00 00 00 
+  801204:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801206:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  80120a:	48 83 c4 08          	add    $0x8,%rsp
+  80120e:	5b                   	pop    %rbx
+  80120f:	41 5c                	pop    %r12
+  801211:	41 5d                	pop    %r13
+  801213:	41 5e                	pop    %r14
+  801215:	41 5f                	pop    %r15
+  801217:	5d                   	pop    %rbp
+  801218:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801219:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80121d:	eb eb                	jmp    80120a <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80121f:	48 83 eb 01          	sub    $0x1,%rbx
+  801223:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801227:	48 89 da             	mov    %rbx,%rdx
+  80122a:	4c 89 fe             	mov    %r15,%rsi
+  80122d:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  801234:	00 00 00 
+  801237:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801239:	49 01 de             	add    %rbx,%r14
+  80123c:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801241:	eb c3                	jmp    801206 <strlcat+0x69>
+
+0000000000801243 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801243:	48 85 d2             	test   %rdx,%rdx
+  801246:	74 2d                	je     801275 <memcmp+0x32>
+  801248:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80124d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801251:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801256:	44 38 c1             	cmp    %r8b,%cl
+  801259:	75 0f                	jne    80126a <memcmp+0x27>
+    while (n-- > 0) {
+  80125b:	48 83 c0 01          	add    $0x1,%rax
+  80125f:	48 39 c2             	cmp    %rax,%rdx
+  801262:	75 e9                	jne    80124d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801264:	b8 00 00 00 00       	mov    $0x0,%eax
+  801269:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80126a:	0f b6 c1             	movzbl %cl,%eax
+  80126d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801271:	44 29 c0             	sub    %r8d,%eax
+  801274:	c3                   	ret
+    return 0;
+  801275:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80127a:	c3                   	ret
+
+000000000080127b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80127b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80127f:	48 39 c7             	cmp    %rax,%rdi
+  801282:	73 0f                	jae    801293 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801284:	40 38 37             	cmp    %sil,(%rdi)
+  801287:	74 0e                	je     801297 <memfind+0x1c>
+    for (; src < end; src++) {
+  801289:	48 83 c7 01          	add    $0x1,%rdi
+  80128d:	48 39 f8             	cmp    %rdi,%rax
+  801290:	75 f2                	jne    801284 <memfind+0x9>
+  801292:	c3                   	ret
+  801293:	48 89 f8             	mov    %rdi,%rax
+  801296:	c3                   	ret
+  801297:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80129a:	c3                   	ret
+
+000000000080129b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80129b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80129e:	0f b6 37             	movzbl (%rdi),%esi
+  8012a1:	40 80 fe 20          	cmp    $0x20,%sil
+  8012a5:	74 06                	je     8012ad <strtol+0x12>
+  8012a7:	40 80 fe 09          	cmp    $0x9,%sil
+  8012ab:	75 13                	jne    8012c0 <strtol+0x25>
+  8012ad:	48 83 c7 01          	add    $0x1,%rdi
+  8012b1:	0f b6 37             	movzbl (%rdi),%esi
+  8012b4:	40 80 fe 20          	cmp    $0x20,%sil
+  8012b8:	74 f3                	je     8012ad <strtol+0x12>
+  8012ba:	40 80 fe 09          	cmp    $0x9,%sil
+  8012be:	74 ed                	je     8012ad <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012c0:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012c3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012c6:	3c 01                	cmp    $0x1,%al
+  8012c8:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012cc:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012d2:	75 0f                	jne    8012e3 <strtol+0x48>
+  8012d4:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012d7:	74 14                	je     8012ed <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8012d9:	85 d2                	test   %edx,%edx
+  8012db:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8012e0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8012e3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8012e8:	4c 63 ca             	movslq %edx,%r9
+  8012eb:	eb 36                	jmp    801323 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012ed:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8012f1:	74 0f                	je     801302 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8012f3:	85 d2                	test   %edx,%edx
+  8012f5:	75 ec                	jne    8012e3 <strtol+0x48>
+        s++;
+  8012f7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8012fb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801300:	eb e1                	jmp    8012e3 <strtol+0x48>
+        s += 2;
+  801302:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801306:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  80130b:	eb d6                	jmp    8012e3 <strtol+0x48>
+            dig -= '0';
+  80130d:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801310:	44 0f b6 c1          	movzbl %cl,%r8d
+  801314:	41 39 d0             	cmp    %edx,%r8d
+  801317:	7d 21                	jge    80133a <strtol+0x9f>
+        val = val * base + dig;
+  801319:	49 0f af c1          	imul   %r9,%rax
+  80131d:	0f b6 c9             	movzbl %cl,%ecx
+  801320:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801323:	48 83 c7 01          	add    $0x1,%rdi
+  801327:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  80132b:	80 f9 39             	cmp    $0x39,%cl
+  80132e:	76 dd                	jbe    80130d <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801330:	80 f9 7b             	cmp    $0x7b,%cl
+  801333:	77 05                	ja     80133a <strtol+0x9f>
+            dig -= 'a' - 10;
+  801335:	83 e9 57             	sub    $0x57,%ecx
+  801338:	eb d6                	jmp    801310 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  80133a:	4d 85 d2             	test   %r10,%r10
+  80133d:	74 03                	je     801342 <strtol+0xa7>
+  80133f:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801342:	48 89 c2             	mov    %rax,%rdx
+  801345:	48 f7 da             	neg    %rdx
+  801348:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80134c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801350:	c3                   	ret
+
+0000000000801351 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801351:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801356:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801361:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801367:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80136d:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80136f:	c3                   	ret
+
+0000000000801370 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801370:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801375:	bf 00 00 00 00       	mov    $0x0,%edi
+  80137a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80137f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801384:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80138a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801390:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801396:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801398:	c3                   	ret
+
+0000000000801399 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801399:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80139c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013a1:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ab:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013bf:	48 85 c0             	test   %rax,%rax
+  8013c2:	7f 01                	jg     8013c5 <sys_env_destroy+0x2c>
+}
+  8013c4:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8013c5:	55                   	push   %rbp
+  8013c6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c9:	49 89 c0             	mov    %rax,%r8
+  8013cc:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013d1:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  8013d8:	00 00 00 
+  8013db:	be 29 00 00 00       	mov    $0x29,%esi
+  8013e0:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  8013e7:	00 00 00 
+  8013ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ef:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  8013f6:	00 00 00 
+  8013f9:	41 ff d1             	call   *%r9
+
+00000000008013fc <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013fc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801401:	bf 00 00 00 00       	mov    $0x0,%edi
+  801406:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801410:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801416:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80141c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801422:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801424:	c3                   	ret
+
+0000000000801425 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801425:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80142a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801434:	ba 00 00 00 00       	mov    $0x0,%edx
+  801439:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801445:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144b:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144d:	c3                   	ret
+
+000000000080144e <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801453:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80145a:	00 00 00 
+  80145d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801463:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801469:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80146f:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801471:	c3                   	ret
+
+0000000000801472 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801472:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801475:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80147a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801480:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801486:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801488:	c3                   	ret
+
+0000000000801489 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801489:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80148c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801491:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801494:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80149a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014a0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014a2:	48 85 c0             	test   %rax,%rax
+  8014a5:	7f 01                	jg     8014a8 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014a7:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014a8:	55                   	push   %rbp
+  8014a9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ac:	49 89 c0             	mov    %rax,%r8
+  8014af:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014b4:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  8014bb:	00 00 00 
+  8014be:	be 29 00 00 00       	mov    $0x29,%esi
+  8014c3:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  8014ca:	00 00 00 
+  8014cd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014d2:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  8014d9:	00 00 00 
+  8014dc:	41 ff d1             	call   *%r9
+
+00000000008014df <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014df:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8014e2:	48 63 d2             	movslq %edx,%rdx
+  8014e5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014e8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ed:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8014f0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014f2:	48 85 c0             	test   %rax,%rax
+  8014f5:	7f 01                	jg     8014f8 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8014f7:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8014f8:	55                   	push   %rbp
+  8014f9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014fc:	49 89 c0             	mov    %rax,%r8
+  8014ff:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801504:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  80150b:	00 00 00 
+  80150e:	be 29 00 00 00       	mov    $0x29,%esi
+  801513:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  80151a:	00 00 00 
+  80151d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801522:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  801529:	00 00 00 
+  80152c:	41 ff d1             	call   *%r9
+
+000000000080152f <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80152f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801532:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801537:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80153d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801543:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801549:	0f 05                	syscall
+    if (check && ret > 0) {
+  80154b:	48 85 c0             	test   %rax,%rax
+  80154e:	7f 01                	jg     801551 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801550:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801551:	55                   	push   %rbp
+  801552:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801555:	49 89 c0             	mov    %rax,%r8
+  801558:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80155d:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  801564:	00 00 00 
+  801567:	be 29 00 00 00       	mov    $0x29,%esi
+  80156c:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  801573:	00 00 00 
+  801576:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157b:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  801582:	00 00 00 
+  801585:	41 ff d1             	call   *%r9
+
+0000000000801588 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801588:	48 63 f6             	movslq %esi,%rsi
+  80158b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80158e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801593:	ba 00 00 00 00       	mov    $0x0,%edx
+  801598:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80159e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015aa:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015ac:	48 85 c0             	test   %rax,%rax
+  8015af:	7f 01                	jg     8015b2 <sys_env_set_status+0x2a>
+}
+  8015b1:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8015b2:	55                   	push   %rbp
+  8015b3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b6:	49 89 c0             	mov    %rax,%r8
+  8015b9:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015be:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  8015c5:	00 00 00 
+  8015c8:	be 29 00 00 00       	mov    $0x29,%esi
+  8015cd:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  8015d4:	00 00 00 
+  8015d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015dc:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  8015e3:	00 00 00 
+  8015e6:	41 ff d1             	call   *%r9
+
+00000000008015e9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8015e9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015ec:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015fc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801602:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801608:	0f 05                	syscall
+    if (check && ret > 0) {
+  80160a:	48 85 c0             	test   %rax,%rax
+  80160d:	7f 01                	jg     801610 <sys_env_set_trapframe+0x27>
+}
+  80160f:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801610:	55                   	push   %rbp
+  801611:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801614:	49 89 c0             	mov    %rax,%r8
+  801617:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80161c:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  801623:	00 00 00 
+  801626:	be 29 00 00 00       	mov    $0x29,%esi
+  80162b:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  801632:	00 00 00 
+  801635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163a:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  801641:	00 00 00 
+  801644:	41 ff d1             	call   *%r9
+
+0000000000801647 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801647:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80164a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80164f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801654:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80165a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801660:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801666:	0f 05                	syscall
+    if (check && ret > 0) {
+  801668:	48 85 c0             	test   %rax,%rax
+  80166b:	7f 01                	jg     80166e <sys_env_set_pgfault_upcall+0x27>
+}
+  80166d:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801672:	49 89 c0             	mov    %rax,%r8
+  801675:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80167a:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  801681:	00 00 00 
+  801684:	be 29 00 00 00       	mov    $0x29,%esi
+  801689:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  801690:	00 00 00 
+  801693:	b8 00 00 00 00       	mov    $0x0,%eax
+  801698:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  80169f:	00 00 00 
+  8016a2:	41 ff d1             	call   *%r9
+
+00000000008016a5 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016a5:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016a8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ab:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b0:	4d 63 c0             	movslq %r8d,%r8
+  8016b3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016b9:	0f 05                	syscall
+}
+  8016bb:	c3                   	ret
+
+00000000008016bc <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016bc:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016bf:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016c2:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016c7:	4d 63 c0             	movslq %r8d,%r8
+  8016ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016d0:	0f 05                	syscall
+}
+  8016d2:	c3                   	ret
+
+00000000008016d3 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016d3:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016d8:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016db:	45 89 c0             	mov    %r8d,%r8d
+  8016de:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016e6:	48 85 c0             	test   %rax,%rax
+  8016e9:	7f 01                	jg     8016ec <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8016eb:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8016ec:	55                   	push   %rbp
+  8016ed:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016f0:	49 89 c0             	mov    %rax,%r8
+  8016f3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8016f8:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  8016ff:	00 00 00 
+  801702:	be 29 00 00 00       	mov    $0x29,%esi
+  801707:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  80170e:	00 00 00 
+  801711:	b8 00 00 00 00       	mov    $0x0,%eax
+  801716:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  80171d:	00 00 00 
+  801720:	41 ff d1             	call   *%r9
+
+0000000000801723 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801723:	55                   	push   %rbp
+  801724:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801727:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80172d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801732:	ba 00 00 00 00       	mov    $0x0,%edx
+  801737:	48 b8 d3 16 80 00 00 	movabs $0x8016d3,%rax
+  80173e:	00 00 00 
+  801741:	ff d0                	call   *%rax
+}
+  801743:	5d                   	pop    %rbp
+  801744:	c3                   	ret
+
+0000000000801745 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801745:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80174a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80174f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801754:	ba 00 00 00 00       	mov    $0x0,%edx
+  801759:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80175f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801765:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80176b:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80176d:	c3                   	ret
+
+000000000080176e <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80176e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801773:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801778:	ba 00 00 00 00       	mov    $0x0,%edx
+  80177d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801783:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801789:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80178f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801791:	48 85 c0             	test   %rax,%rax
+  801794:	7f 01                	jg     801797 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801796:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801797:	55                   	push   %rbp
+  801798:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179b:	49 89 c0             	mov    %rax,%r8
+  80179e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017a3:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  8017aa:	00 00 00 
+  8017ad:	be 29 00 00 00       	mov    $0x29,%esi
+  8017b2:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  8017b9:	00 00 00 
+  8017bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c1:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  8017c8:	00 00 00 
+  8017cb:	41 ff d1             	call   *%r9
+
+00000000008017ce <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017ce:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017d8:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017f4:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017f6:	c3                   	ret
+
+00000000008017f7 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8017f7:	89 d2                	mov    %edx,%edx
+  8017f9:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8017fb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801800:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801806:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80180c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801812:	0f 05                	syscall
+}
+  801814:	c3                   	ret
+
+0000000000801815 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801815:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801818:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80181d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801822:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801828:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80182e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801834:	0f 05                	syscall
+}
+  801836:	c3                   	ret
+
+0000000000801837 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801837:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80183a:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80183f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801844:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80184a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801850:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801856:	0f 05                	syscall
+}
+  801858:	c3                   	ret
+
+0000000000801859 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801859:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80185c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801861:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801866:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801871:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801877:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80187d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80187f:	48 85 c0             	test   %rax,%rax
+  801882:	7f 01                	jg     801885 <sys_irq_ack+0x2c>
+}
+  801884:	c3                   	ret
+sys_irq_ack(int irq) {
+  801885:	55                   	push   %rbp
+  801886:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801889:	49 89 c0             	mov    %rax,%r8
+  80188c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801891:	48 ba 58 5d 80 00 00 	movabs $0x805d58,%rdx
+  801898:	00 00 00 
+  80189b:	be 29 00 00 00       	mov    $0x29,%esi
+  8018a0:	48 bf 77 5d 80 00 00 	movabs $0x805d77,%rdi
+  8018a7:	00 00 00 
+  8018aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018af:	49 b9 b5 04 80 00 00 	movabs $0x8004b5,%r9
+  8018b6:	00 00 00 
+  8018b9:	41 ff d1             	call   *%r9
+
+00000000008018bc <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8018bc:	55                   	push   %rbp
+  8018bd:	48 89 e5             	mov    %rsp,%rbp
+  8018c0:	41 55                	push   %r13
+  8018c2:	41 54                	push   %r12
+  8018c4:	53                   	push   %rbx
+  8018c5:	48 83 ec 08          	sub    $0x8,%rsp
+  8018c9:	49 89 fd             	mov    %rdi,%r13
+  8018cc:	48 89 f7             	mov    %rsi,%rdi
+  8018cf:	48 89 d3             	mov    %rdx,%rbx
+  8018d2:	49 89 cc             	mov    %rcx,%r12
+  8018d5:	4c 89 c2             	mov    %r8,%rdx
+  8018d8:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8018db:	48 85 f6             	test   %rsi,%rsi
+  8018de:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018e5:	00 00 00 
+  8018e8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8018ec:	be 00 10 00 00       	mov    $0x1000,%esi
+  8018f1:	48 85 db             	test   %rbx,%rbx
+  8018f4:	74 03                	je     8018f9 <ipc_recv_futex+0x3d>
+  8018f6:	48 8b 33             	mov    (%rbx),%rsi
+  8018f9:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8018fd:	48 b8 d3 16 80 00 00 	movabs $0x8016d3,%rax
+  801904:	00 00 00 
+  801907:	ff d0                	call   *%rax
+    if (res < 0) {
+  801909:	85 c0                	test   %eax,%eax
+  80190b:	78 75                	js     801982 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80190d:	4d 85 ed             	test   %r13,%r13
+  801910:	74 14                	je     801926 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  801912:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801919:	00 00 00 
+  80191c:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801922:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801926:	4d 85 e4             	test   %r12,%r12
+  801929:	74 14                	je     80193f <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80192b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801932:	00 00 00 
+  801935:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80193b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80193f:	48 85 db             	test   %rbx,%rbx
+  801942:	74 23                	je     801967 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801944:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80194b:	00 00 00 
+  80194e:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801954:	ba 00 00 00 00       	mov    $0x0,%edx
+  801959:	85 c9                	test   %ecx,%ecx
+  80195b:	74 07                	je     801964 <ipc_recv_futex+0xa8>
+  80195d:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801964:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801967:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80196e:	00 00 00 
+  801971:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801977:	48 83 c4 08          	add    $0x8,%rsp
+  80197b:	5b                   	pop    %rbx
+  80197c:	41 5c                	pop    %r12
+  80197e:	41 5d                	pop    %r13
+  801980:	5d                   	pop    %rbp
+  801981:	c3                   	ret
+        if (from_env_store != NULL) {
+  801982:	4d 85 ed             	test   %r13,%r13
+  801985:	74 08                	je     80198f <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801987:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80198e:	00 
+        if (perm_store != NULL) {
+  80198f:	4d 85 e4             	test   %r12,%r12
+  801992:	74 08                	je     80199c <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801994:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80199b:	00 
+        if (size != NULL) {
+  80199c:	48 85 db             	test   %rbx,%rbx
+  80199f:	74 d6                	je     801977 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8019a1:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8019a8:	eb cd                	jmp    801977 <ipc_recv_futex+0xbb>
+
+00000000008019aa <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8019aa:	55                   	push   %rbp
+  8019ab:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8019ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b2:	6a 00                	push   $0x0
+  8019b4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8019ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8019c0:	48 b8 bc 18 80 00 00 	movabs $0x8018bc,%rax
+  8019c7:	00 00 00 
+  8019ca:	ff d0                	call   *%rax
+}
+  8019cc:	c9                   	leave
+  8019cd:	c3                   	ret
+
+00000000008019ce <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8019ce:	55                   	push   %rbp
+  8019cf:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8019d2:	48 85 d2             	test   %rdx,%rdx
+  8019d5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8019dc:	00 00 00 
+  8019df:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8019e3:	89 f6                	mov    %esi,%esi
+  8019e5:	48 b8 bc 16 80 00 00 	movabs $0x8016bc,%rax
+  8019ec:	00 00 00 
+  8019ef:	ff d0                	call   *%rax
+    if (res < 0) {
+  8019f1:	85 c0                	test   %eax,%eax
+  8019f3:	78 02                	js     8019f7 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8019f5:	5d                   	pop    %rbp
+  8019f6:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8019f7:	89 c1                	mov    %eax,%ecx
+  8019f9:	48 ba 85 5d 80 00 00 	movabs $0x805d85,%rdx
+  801a00:	00 00 00 
+  801a03:	be 50 00 00 00       	mov    $0x50,%esi
+  801a08:	48 bf 99 5d 80 00 00 	movabs $0x805d99,%rdi
+  801a0f:	00 00 00 
+  801a12:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a17:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  801a1e:	00 00 00 
+  801a21:	41 ff d0             	call   *%r8
+
+0000000000801a24 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801a24:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801a29:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801a30:	00 00 00 
+  801a33:	48 89 d0             	mov    %rdx,%rax
+  801a36:	48 c1 e0 04          	shl    $0x4,%rax
+  801a3a:	48 29 d0             	sub    %rdx,%rax
+  801a3d:	48 c1 e0 05          	shl    $0x5,%rax
+  801a41:	48 01 c8             	add    %rcx,%rax
+  801a44:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801a4a:	39 f8                	cmp    %edi,%eax
+  801a4c:	74 13                	je     801a61 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  801a4e:	48 83 c2 01          	add    $0x1,%rdx
+  801a52:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801a59:	75 d8                	jne    801a33 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801a5b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a60:	c3                   	ret
+            return envs[i].env_id;
+  801a61:	48 89 d0             	mov    %rdx,%rax
+  801a64:	48 c1 e0 04          	shl    $0x4,%rax
+  801a68:	48 29 d0             	sub    %rdx,%rax
+  801a6b:	48 c1 e0 05          	shl    $0x5,%rax
+  801a6f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a76:	00 00 00 
+  801a79:	48 01 d0             	add    %rdx,%rax
+  801a7c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801a82:	c3                   	ret
+
+0000000000801a83 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a83:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a8a:	ff ff ff 
+  801a8d:	48 01 f8             	add    %rdi,%rax
+  801a90:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a94:	c3                   	ret
+
+0000000000801a95 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a95:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a9c:	ff ff ff 
+  801a9f:	48 01 f8             	add    %rdi,%rax
+  801aa2:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801aa6:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801aac:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	41 57                	push   %r15
+  801ab7:	41 56                	push   %r14
+  801ab9:	41 55                	push   %r13
+  801abb:	41 54                	push   %r12
+  801abd:	53                   	push   %rbx
+  801abe:	48 83 ec 08          	sub    $0x8,%rsp
+  801ac2:	49 89 ff             	mov    %rdi,%r15
+  801ac5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801aca:	49 bd f9 4b 80 00 00 	movabs $0x804bf9,%r13
+  801ad1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ad4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ada:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801add:	48 89 df             	mov    %rbx,%rdi
+  801ae0:	41 ff d5             	call   *%r13
+  801ae3:	83 e0 04             	and    $0x4,%eax
+  801ae6:	74 17                	je     801aff <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801ae8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801aef:	4c 39 f3             	cmp    %r14,%rbx
+  801af2:	75 e6                	jne    801ada <fd_alloc+0x29>
+  801af4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801afa:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801aff:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b02:	48 83 c4 08          	add    $0x8,%rsp
+  801b06:	5b                   	pop    %rbx
+  801b07:	41 5c                	pop    %r12
+  801b09:	41 5d                	pop    %r13
+  801b0b:	41 5e                	pop    %r14
+  801b0d:	41 5f                	pop    %r15
+  801b0f:	5d                   	pop    %rbp
+  801b10:	c3                   	ret
+
+0000000000801b11 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b11:	83 ff 1f             	cmp    $0x1f,%edi
+  801b14:	77 39                	ja     801b4f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b16:	55                   	push   %rbp
+  801b17:	48 89 e5             	mov    %rsp,%rbp
+  801b1a:	41 54                	push   %r12
+  801b1c:	53                   	push   %rbx
+  801b1d:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b20:	48 63 df             	movslq %edi,%rbx
+  801b23:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b2a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b2e:	48 89 df             	mov    %rbx,%rdi
+  801b31:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  801b38:	00 00 00 
+  801b3b:	ff d0                	call   *%rax
+  801b3d:	a8 04                	test   $0x4,%al
+  801b3f:	74 14                	je     801b55 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b41:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b45:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b4a:	5b                   	pop    %rbx
+  801b4b:	41 5c                	pop    %r12
+  801b4d:	5d                   	pop    %rbp
+  801b4e:	c3                   	ret
+        return -E_INVAL;
+  801b4f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b54:	c3                   	ret
+        return -E_INVAL;
+  801b55:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b5a:	eb ee                	jmp    801b4a <fd_lookup+0x39>
+
+0000000000801b5c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b5c:	55                   	push   %rbp
+  801b5d:	48 89 e5             	mov    %rsp,%rbp
+  801b60:	41 54                	push   %r12
+  801b62:	53                   	push   %rbx
+  801b63:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b66:	48 b8 40 5e 80 00 00 	movabs $0x805e40,%rax
+  801b6d:	00 00 00 
+  801b70:	48 bb 20 70 80 00 00 	movabs $0x807020,%rbx
+  801b77:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b7a:	39 3b                	cmp    %edi,(%rbx)
+  801b7c:	74 47                	je     801bc5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b7e:	48 83 c0 08          	add    $0x8,%rax
+  801b82:	48 8b 18             	mov    (%rax),%rbx
+  801b85:	48 85 db             	test   %rbx,%rbx
+  801b88:	75 f0                	jne    801b7a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b8a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b91:	00 00 00 
+  801b94:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b9a:	89 fa                	mov    %edi,%edx
+  801b9c:	48 bf a8 5d 80 00 00 	movabs $0x805da8,%rdi
+  801ba3:	00 00 00 
+  801ba6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bab:	48 b9 05 06 80 00 00 	movabs $0x800605,%rcx
+  801bb2:	00 00 00 
+  801bb5:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bb7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bbc:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bc0:	5b                   	pop    %rbx
+  801bc1:	41 5c                	pop    %r12
+  801bc3:	5d                   	pop    %rbp
+  801bc4:	c3                   	ret
+            return 0;
+  801bc5:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bca:	eb f0                	jmp    801bbc <dev_lookup+0x60>
+
+0000000000801bcc <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bcc:	55                   	push   %rbp
+  801bcd:	48 89 e5             	mov    %rsp,%rbp
+  801bd0:	41 55                	push   %r13
+  801bd2:	41 54                	push   %r12
+  801bd4:	53                   	push   %rbx
+  801bd5:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd9:	48 89 fb             	mov    %rdi,%rbx
+  801bdc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bdf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801be6:	ff ff ff 
+  801be9:	48 01 df             	add    %rbx,%rdi
+  801bec:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bf0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bf4:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801bfb:	00 00 00 
+  801bfe:	ff d0                	call   *%rax
+  801c00:	41 89 c5             	mov    %eax,%r13d
+  801c03:	85 c0                	test   %eax,%eax
+  801c05:	78 06                	js     801c0d <fd_close+0x41>
+  801c07:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c0b:	74 1a                	je     801c27 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c0d:	45 84 e4             	test   %r12b,%r12b
+  801c10:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c15:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c19:	44 89 e8             	mov    %r13d,%eax
+  801c1c:	48 83 c4 18          	add    $0x18,%rsp
+  801c20:	5b                   	pop    %rbx
+  801c21:	41 5c                	pop    %r12
+  801c23:	41 5d                	pop    %r13
+  801c25:	5d                   	pop    %rbp
+  801c26:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c27:	8b 3b                	mov    (%rbx),%edi
+  801c29:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c2d:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801c34:	00 00 00 
+  801c37:	ff d0                	call   *%rax
+  801c39:	41 89 c5             	mov    %eax,%r13d
+  801c3c:	85 c0                	test   %eax,%eax
+  801c3e:	78 1b                	js     801c5b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c40:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c44:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c48:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c4e:	48 85 c0             	test   %rax,%rax
+  801c51:	74 08                	je     801c5b <fd_close+0x8f>
+  801c53:	48 89 df             	mov    %rbx,%rdi
+  801c56:	ff d0                	call   *%rax
+  801c58:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c5b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c60:	48 89 de             	mov    %rbx,%rsi
+  801c63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c68:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+    return res;
+  801c74:	eb a3                	jmp    801c19 <fd_close+0x4d>
+
+0000000000801c76 <close>:
+
+int
+close(int fdnum) {
+  801c76:	55                   	push   %rbp
+  801c77:	48 89 e5             	mov    %rsp,%rbp
+  801c7a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c7e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c82:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801c89:	00 00 00 
+  801c8c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c8e:	85 c0                	test   %eax,%eax
+  801c90:	78 15                	js     801ca7 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c92:	be 01 00 00 00       	mov    $0x1,%esi
+  801c97:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c9b:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  801ca2:	00 00 00 
+  801ca5:	ff d0                	call   *%rax
+}
+  801ca7:	c9                   	leave
+  801ca8:	c3                   	ret
+
+0000000000801ca9 <close_all>:
+
+void
+close_all(void) {
+  801ca9:	55                   	push   %rbp
+  801caa:	48 89 e5             	mov    %rsp,%rbp
+  801cad:	41 54                	push   %r12
+  801caf:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cb0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cb5:	49 bc 76 1c 80 00 00 	movabs $0x801c76,%r12
+  801cbc:	00 00 00 
+  801cbf:	89 df                	mov    %ebx,%edi
+  801cc1:	41 ff d4             	call   *%r12
+  801cc4:	83 c3 01             	add    $0x1,%ebx
+  801cc7:	83 fb 20             	cmp    $0x20,%ebx
+  801cca:	75 f3                	jne    801cbf <close_all+0x16>
+}
+  801ccc:	5b                   	pop    %rbx
+  801ccd:	41 5c                	pop    %r12
+  801ccf:	5d                   	pop    %rbp
+  801cd0:	c3                   	ret
+
+0000000000801cd1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cd1:	55                   	push   %rbp
+  801cd2:	48 89 e5             	mov    %rsp,%rbp
+  801cd5:	41 57                	push   %r15
+  801cd7:	41 56                	push   %r14
+  801cd9:	41 55                	push   %r13
+  801cdb:	41 54                	push   %r12
+  801cdd:	53                   	push   %rbx
+  801cde:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ce5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ce9:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801cf0:	00 00 00 
+  801cf3:	ff d0                	call   *%rax
+  801cf5:	89 c3                	mov    %eax,%ebx
+  801cf7:	85 c0                	test   %eax,%eax
+  801cf9:	0f 88 b8 00 00 00    	js     801db7 <dup+0xe6>
+    close(newfdnum);
+  801cff:	44 89 e7             	mov    %r12d,%edi
+  801d02:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d0e:	4d 63 ec             	movslq %r12d,%r13
+  801d11:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d18:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d1c:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d20:	4c 89 ff             	mov    %r15,%rdi
+  801d23:	49 be 95 1a 80 00 00 	movabs $0x801a95,%r14
+  801d2a:	00 00 00 
+  801d2d:	41 ff d6             	call   *%r14
+  801d30:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d33:	4c 89 ef             	mov    %r13,%rdi
+  801d36:	41 ff d6             	call   *%r14
+  801d39:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d3c:	48 89 df             	mov    %rbx,%rdi
+  801d3f:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  801d46:	00 00 00 
+  801d49:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d4b:	a8 04                	test   $0x4,%al
+  801d4d:	74 2b                	je     801d7a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d4f:	41 89 c1             	mov    %eax,%r9d
+  801d52:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d58:	4c 89 f1             	mov    %r14,%rcx
+  801d5b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d60:	48 89 de             	mov    %rbx,%rsi
+  801d63:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d68:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	89 c3                	mov    %eax,%ebx
+  801d76:	85 c0                	test   %eax,%eax
+  801d78:	78 4e                	js     801dc8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d7a:	4c 89 ff             	mov    %r15,%rdi
+  801d7d:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  801d84:	00 00 00 
+  801d87:	ff d0                	call   *%rax
+  801d89:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d8c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d92:	4c 89 e9             	mov    %r13,%rcx
+  801d95:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d9a:	4c 89 fe             	mov    %r15,%rsi
+  801d9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801da2:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  801da9:	00 00 00 
+  801dac:	ff d0                	call   *%rax
+  801dae:	89 c3                	mov    %eax,%ebx
+  801db0:	85 c0                	test   %eax,%eax
+  801db2:	78 14                	js     801dc8 <dup+0xf7>
+
+    return newfdnum;
+  801db4:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801db7:	89 d8                	mov    %ebx,%eax
+  801db9:	48 83 c4 18          	add    $0x18,%rsp
+  801dbd:	5b                   	pop    %rbx
+  801dbe:	41 5c                	pop    %r12
+  801dc0:	41 5d                	pop    %r13
+  801dc2:	41 5e                	pop    %r14
+  801dc4:	41 5f                	pop    %r15
+  801dc6:	5d                   	pop    %rbp
+  801dc7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dc8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801dcd:	4c 89 ee             	mov    %r13,%rsi
+  801dd0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dd5:	49 bc 2f 15 80 00 00 	movabs $0x80152f,%r12
+  801ddc:	00 00 00 
+  801ddf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801de2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801de7:	4c 89 f6             	mov    %r14,%rsi
+  801dea:	bf 00 00 00 00       	mov    $0x0,%edi
+  801def:	41 ff d4             	call   *%r12
+    return res;
+  801df2:	eb c3                	jmp    801db7 <dup+0xe6>
+
+0000000000801df4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801df4:	55                   	push   %rbp
+  801df5:	48 89 e5             	mov    %rsp,%rbp
+  801df8:	41 56                	push   %r14
+  801dfa:	41 55                	push   %r13
+  801dfc:	41 54                	push   %r12
+  801dfe:	53                   	push   %rbx
+  801dff:	48 83 ec 10          	sub    $0x10,%rsp
+  801e03:	89 fb                	mov    %edi,%ebx
+  801e05:	49 89 f4             	mov    %rsi,%r12
+  801e08:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e0f:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801e16:	00 00 00 
+  801e19:	ff d0                	call   *%rax
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	78 4c                	js     801e6b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1f:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e23:	41 8b 3e             	mov    (%r14),%edi
+  801e26:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2a:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801e31:	00 00 00 
+  801e34:	ff d0                	call   *%rax
+  801e36:	85 c0                	test   %eax,%eax
+  801e38:	78 35                	js     801e6f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e3a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e3e:	83 e0 03             	and    $0x3,%eax
+  801e41:	83 f8 01             	cmp    $0x1,%eax
+  801e44:	74 2d                	je     801e73 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e46:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e4a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e4e:	48 85 c0             	test   %rax,%rax
+  801e51:	74 56                	je     801ea9 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e53:	4c 89 ea             	mov    %r13,%rdx
+  801e56:	4c 89 e6             	mov    %r12,%rsi
+  801e59:	4c 89 f7             	mov    %r14,%rdi
+  801e5c:	ff d0                	call   *%rax
+}
+  801e5e:	48 83 c4 10          	add    $0x10,%rsp
+  801e62:	5b                   	pop    %rbx
+  801e63:	41 5c                	pop    %r12
+  801e65:	41 5d                	pop    %r13
+  801e67:	41 5e                	pop    %r14
+  801e69:	5d                   	pop    %rbp
+  801e6a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e6b:	48 98                	cltq
+  801e6d:	eb ef                	jmp    801e5e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e6f:	48 98                	cltq
+  801e71:	eb eb                	jmp    801e5e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e73:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e7a:	00 00 00 
+  801e7d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e83:	89 da                	mov    %ebx,%edx
+  801e85:	48 bf e9 5d 80 00 00 	movabs $0x805de9,%rdi
+  801e8c:	00 00 00 
+  801e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e94:	48 b9 05 06 80 00 00 	movabs $0x800605,%rcx
+  801e9b:	00 00 00 
+  801e9e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801ea0:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ea7:	eb b5                	jmp    801e5e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ea9:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801eb0:	eb ac                	jmp    801e5e <read+0x6a>
+
+0000000000801eb2 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801eb2:	55                   	push   %rbp
+  801eb3:	48 89 e5             	mov    %rsp,%rbp
+  801eb6:	41 57                	push   %r15
+  801eb8:	41 56                	push   %r14
+  801eba:	41 55                	push   %r13
+  801ebc:	41 54                	push   %r12
+  801ebe:	53                   	push   %rbx
+  801ebf:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ec3:	48 85 d2             	test   %rdx,%rdx
+  801ec6:	74 54                	je     801f1c <readn+0x6a>
+  801ec8:	41 89 fd             	mov    %edi,%r13d
+  801ecb:	49 89 f6             	mov    %rsi,%r14
+  801ece:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ed1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ed6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801edb:	49 bf f4 1d 80 00 00 	movabs $0x801df4,%r15
+  801ee2:	00 00 00 
+  801ee5:	4c 89 e2             	mov    %r12,%rdx
+  801ee8:	48 29 f2             	sub    %rsi,%rdx
+  801eeb:	4c 01 f6             	add    %r14,%rsi
+  801eee:	44 89 ef             	mov    %r13d,%edi
+  801ef1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801ef4:	85 c0                	test   %eax,%eax
+  801ef6:	78 20                	js     801f18 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ef8:	01 c3                	add    %eax,%ebx
+  801efa:	85 c0                	test   %eax,%eax
+  801efc:	74 08                	je     801f06 <readn+0x54>
+  801efe:	48 63 f3             	movslq %ebx,%rsi
+  801f01:	4c 39 e6             	cmp    %r12,%rsi
+  801f04:	72 df                	jb     801ee5 <readn+0x33>
+    }
+    return res;
+  801f06:	48 63 c3             	movslq %ebx,%rax
+}
+  801f09:	48 83 c4 08          	add    $0x8,%rsp
+  801f0d:	5b                   	pop    %rbx
+  801f0e:	41 5c                	pop    %r12
+  801f10:	41 5d                	pop    %r13
+  801f12:	41 5e                	pop    %r14
+  801f14:	41 5f                	pop    %r15
+  801f16:	5d                   	pop    %rbp
+  801f17:	c3                   	ret
+        if (inc < 0) return inc;
+  801f18:	48 98                	cltq
+  801f1a:	eb ed                	jmp    801f09 <readn+0x57>
+    int inc = 1, res = 0;
+  801f1c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f21:	eb e3                	jmp    801f06 <readn+0x54>
+
+0000000000801f23 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f23:	55                   	push   %rbp
+  801f24:	48 89 e5             	mov    %rsp,%rbp
+  801f27:	41 56                	push   %r14
+  801f29:	41 55                	push   %r13
+  801f2b:	41 54                	push   %r12
+  801f2d:	53                   	push   %rbx
+  801f2e:	48 83 ec 10          	sub    $0x10,%rsp
+  801f32:	89 fb                	mov    %edi,%ebx
+  801f34:	49 89 f4             	mov    %rsi,%r12
+  801f37:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f3a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f3e:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801f45:	00 00 00 
+  801f48:	ff d0                	call   *%rax
+  801f4a:	85 c0                	test   %eax,%eax
+  801f4c:	78 47                	js     801f95 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f4e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f52:	41 8b 3e             	mov    (%r14),%edi
+  801f55:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f59:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  801f60:	00 00 00 
+  801f63:	ff d0                	call   *%rax
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 30                	js     801f99 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f69:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f6e:	74 2d                	je     801f9d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f70:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f74:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f78:	48 85 c0             	test   %rax,%rax
+  801f7b:	74 56                	je     801fd3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f7d:	4c 89 ea             	mov    %r13,%rdx
+  801f80:	4c 89 e6             	mov    %r12,%rsi
+  801f83:	4c 89 f7             	mov    %r14,%rdi
+  801f86:	ff d0                	call   *%rax
+}
+  801f88:	48 83 c4 10          	add    $0x10,%rsp
+  801f8c:	5b                   	pop    %rbx
+  801f8d:	41 5c                	pop    %r12
+  801f8f:	41 5d                	pop    %r13
+  801f91:	41 5e                	pop    %r14
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f95:	48 98                	cltq
+  801f97:	eb ef                	jmp    801f88 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f99:	48 98                	cltq
+  801f9b:	eb eb                	jmp    801f88 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fa4:	00 00 00 
+  801fa7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fad:	89 da                	mov    %ebx,%edx
+  801faf:	48 bf 05 5e 80 00 00 	movabs $0x805e05,%rdi
+  801fb6:	00 00 00 
+  801fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbe:	48 b9 05 06 80 00 00 	movabs $0x800605,%rcx
+  801fc5:	00 00 00 
+  801fc8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fca:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fd1:	eb b5                	jmp    801f88 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fd3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fda:	eb ac                	jmp    801f88 <write+0x65>
+
+0000000000801fdc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fdc:	55                   	push   %rbp
+  801fdd:	48 89 e5             	mov    %rsp,%rbp
+  801fe0:	41 54                	push   %r12
+  801fe2:	53                   	push   %rbx
+  801fe3:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fed:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  801ff4:	00 00 00 
+  801ff7:	ff d0                	call   *%rax
+  801ff9:	85 c0                	test   %eax,%eax
+  801ffb:	78 3e                	js     80203b <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ffd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802001:	41 8b 3c 24          	mov    (%r12),%edi
+  802005:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802009:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  802010:	00 00 00 
+  802013:	ff d0                	call   *%rax
+  802015:	85 c0                	test   %eax,%eax
+  802017:	78 22                	js     80203b <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802019:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80201d:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802021:	48 85 c0             	test   %rax,%rax
+  802024:	74 0b                	je     802031 <seek+0x55>
+  802026:	89 de                	mov    %ebx,%esi
+  802028:	4c 89 e7             	mov    %r12,%rdi
+  80202b:	ff d0                	call   *%rax
+  80202d:	85 c0                	test   %eax,%eax
+  80202f:	78 0a                	js     80203b <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802031:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802036:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80203b:	48 83 c4 10          	add    $0x10,%rsp
+  80203f:	5b                   	pop    %rbx
+  802040:	41 5c                	pop    %r12
+  802042:	5d                   	pop    %rbp
+  802043:	c3                   	ret
+
+0000000000802044 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802044:	55                   	push   %rbp
+  802045:	48 89 e5             	mov    %rsp,%rbp
+  802048:	41 55                	push   %r13
+  80204a:	41 54                	push   %r12
+  80204c:	53                   	push   %rbx
+  80204d:	48 83 ec 18          	sub    $0x18,%rsp
+  802051:	89 fb                	mov    %edi,%ebx
+  802053:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802056:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80205a:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	85 c0                	test   %eax,%eax
+  802068:	78 38                	js     8020a2 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80206a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80206e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802072:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802076:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  80207d:	00 00 00 
+  802080:	ff d0                	call   *%rax
+  802082:	85 c0                	test   %eax,%eax
+  802084:	78 1c                	js     8020a2 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802086:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  80208b:	74 20                	je     8020ad <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80208d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802091:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802095:	48 85 c0             	test   %rax,%rax
+  802098:	74 47                	je     8020e1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  80209a:	44 89 e6             	mov    %r12d,%esi
+  80209d:	4c 89 ef             	mov    %r13,%rdi
+  8020a0:	ff d0                	call   *%rax
+}
+  8020a2:	48 83 c4 18          	add    $0x18,%rsp
+  8020a6:	5b                   	pop    %rbx
+  8020a7:	41 5c                	pop    %r12
+  8020a9:	41 5d                	pop    %r13
+  8020ab:	5d                   	pop    %rbp
+  8020ac:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020ad:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020b4:	00 00 00 
+  8020b7:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020bd:	89 da                	mov    %ebx,%edx
+  8020bf:	48 bf c8 5d 80 00 00 	movabs $0x805dc8,%rdi
+  8020c6:	00 00 00 
+  8020c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020ce:	48 b9 05 06 80 00 00 	movabs $0x800605,%rcx
+  8020d5:	00 00 00 
+  8020d8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020df:	eb c1                	jmp    8020a2 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020e1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020e6:	eb ba                	jmp    8020a2 <ftruncate+0x5e>
+
+00000000008020e8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020e8:	55                   	push   %rbp
+  8020e9:	48 89 e5             	mov    %rsp,%rbp
+  8020ec:	41 54                	push   %r12
+  8020ee:	53                   	push   %rbx
+  8020ef:	48 83 ec 10          	sub    $0x10,%rsp
+  8020f3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020f6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  8020fa:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+  802106:	85 c0                	test   %eax,%eax
+  802108:	78 4e                	js     802158 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80210a:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80210e:	41 8b 3c 24          	mov    (%r12),%edi
+  802112:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802116:	48 b8 5c 1b 80 00 00 	movabs $0x801b5c,%rax
+  80211d:	00 00 00 
+  802120:	ff d0                	call   *%rax
+  802122:	85 c0                	test   %eax,%eax
+  802124:	78 32                	js     802158 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802126:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80212a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80212f:	74 30                	je     802161 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802131:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802134:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80213b:	00 00 00 
+    stat->st_isdir = 0;
+  80213e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802145:	00 00 00 
+    stat->st_dev = dev;
+  802148:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80214f:	48 89 de             	mov    %rbx,%rsi
+  802152:	4c 89 e7             	mov    %r12,%rdi
+  802155:	ff 50 28             	call   *0x28(%rax)
+}
+  802158:	48 83 c4 10          	add    $0x10,%rsp
+  80215c:	5b                   	pop    %rbx
+  80215d:	41 5c                	pop    %r12
+  80215f:	5d                   	pop    %rbp
+  802160:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802161:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802166:	eb f0                	jmp    802158 <fstat+0x70>
+
+0000000000802168 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802168:	55                   	push   %rbp
+  802169:	48 89 e5             	mov    %rsp,%rbp
+  80216c:	41 54                	push   %r12
+  80216e:	53                   	push   %rbx
+  80216f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802172:	be 00 00 00 00       	mov    $0x0,%esi
+  802177:	48 b8 d6 32 80 00 00 	movabs $0x8032d6,%rax
+  80217e:	00 00 00 
+  802181:	ff d0                	call   *%rax
+  802183:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802185:	85 c0                	test   %eax,%eax
+  802187:	78 25                	js     8021ae <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802189:	4c 89 e6             	mov    %r12,%rsi
+  80218c:	89 c7                	mov    %eax,%edi
+  80218e:	48 b8 e8 20 80 00 00 	movabs $0x8020e8,%rax
+  802195:	00 00 00 
+  802198:	ff d0                	call   *%rax
+  80219a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80219d:	89 df                	mov    %ebx,%edi
+  80219f:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  8021a6:	00 00 00 
+  8021a9:	ff d0                	call   *%rax
+
+    return res;
+  8021ab:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021ae:	89 d8                	mov    %ebx,%eax
+  8021b0:	5b                   	pop    %rbx
+  8021b1:	41 5c                	pop    %r12
+  8021b3:	5d                   	pop    %rbp
+  8021b4:	c3                   	ret
+
+00000000008021b5 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021b5:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8021bc:	00 00 00 
+  8021bf:	83 38 00             	cmpl   $0x0,(%rax)
+  8021c2:	74 0a                	je     8021ce <fsenv+0x19>
+    return envid;
+}
+  8021c4:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8021cb:	00 00 
+  8021cd:	c3                   	ret
+fsenv(void) {
+  8021ce:	55                   	push   %rbp
+  8021cf:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021d2:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021d7:	48 b8 24 1a 80 00 00 	movabs $0x801a24,%rax
+  8021de:	00 00 00 
+  8021e1:	ff d0                	call   *%rax
+  8021e3:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8021ea:	00 00 
+}
+  8021ec:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8021f3:	00 00 
+  8021f5:	5d                   	pop    %rbp
+  8021f6:	c3                   	ret
+
+00000000008021f7 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8021f7:	55                   	push   %rbp
+  8021f8:	48 89 e5             	mov    %rsp,%rbp
+  8021fb:	41 54                	push   %r12
+  8021fd:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021fe:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802203:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802208:	48 89 de             	mov    %rbx,%rsi
+  80220b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802210:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  802217:	00 00 00 
+  80221a:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80221c:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802223:	00 00 00 
+  802226:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80222c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802231:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802236:	48 89 de             	mov    %rbx,%rsi
+  802239:	bf 00 00 00 00       	mov    $0x0,%edi
+  80223e:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  802245:	00 00 00 
+  802248:	ff d0                	call   *%rax
+  80224a:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80224c:	85 c0                	test   %eax,%eax
+  80224e:	0f 88 a2 00 00 00    	js     8022f6 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802254:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80225b:	00 00 00 
+  80225e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802264:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802269:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80226b:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802270:	49 bc 50 50 80 00 00 	movabs $0x805050,%r12
+  802277:	00 00 00 
+  80227a:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80227d:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802282:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802285:	48 b8 b5 21 80 00 00 	movabs $0x8021b5,%rax
+  80228c:	00 00 00 
+  80228f:	ff d0                	call   *%rax
+  802291:	89 c7                	mov    %eax,%edi
+  802293:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802299:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80229e:	48 89 da             	mov    %rbx,%rdx
+  8022a1:	be 09 00 00 00       	mov    $0x9,%esi
+  8022a6:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8022b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022bc:	be 00 00 00 00       	mov    $0x0,%esi
+  8022c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022c6:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+  8022d2:	89 c3                	mov    %eax,%ebx
+  8022d4:	85 c0                	test   %eax,%eax
+  8022d6:	78 25                	js     8022fd <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8022d8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8022df:	00 00 00 
+  8022e2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022e8:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8022ef:	00 00 
+    return 0;
+  8022f1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8022f6:	89 d8                	mov    %ebx,%eax
+  8022f8:	5b                   	pop    %rbx
+  8022f9:	41 5c                	pop    %r12
+  8022fb:	5d                   	pop    %rbp
+  8022fc:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8022fd:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802302:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802307:	bf 00 00 00 00       	mov    $0x0,%edi
+  80230c:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+        return res;
+  802318:	eb dc                	jmp    8022f6 <fschan_setup+0xff>
+
+000000000080231a <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80231a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802321:	00 00 00 
+  802324:	80 38 00             	cmpb   $0x0,(%rax)
+  802327:	74 55                	je     80237e <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802329:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802330:	00 00 00 
+  802333:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802339:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80233e:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802345:	00 00 00 
+  802348:	3b 0a                	cmp    (%rdx),%ecx
+  80234a:	75 01                	jne    80234d <fschan+0x33>
+}
+  80234c:	c3                   	ret
+fschan(void) {
+  80234d:	55                   	push   %rbp
+  80234e:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802351:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  802358:	00 00 00 
+  80235b:	ff d0                	call   *%rax
+  80235d:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80235f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802364:	85 d2                	test   %edx,%edx
+  802366:	78 02                	js     80236a <fschan+0x50>
+}
+  802368:	5d                   	pop    %rbp
+  802369:	c3                   	ret
+        fschan_enabled = 0;
+  80236a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802371:	00 00 00 
+  802374:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802377:	b8 00 00 00 00       	mov    $0x0,%eax
+  80237c:	eb ea                	jmp    802368 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80237e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802383:	c3                   	ret
+
+0000000000802384 <fbuf>:
+fbuf(struct Fd *fd) {
+  802384:	55                   	push   %rbp
+  802385:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802388:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  80238f:	00 00 00 
+  802392:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802394:	ba 00 00 00 00       	mov    $0x0,%edx
+  802399:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80239d:	77 12                	ja     8023b1 <fbuf+0x2d>
+  80239f:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8023a3:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8023aa:	00 00 00 
+  8023ad:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8023b1:	48 89 d0             	mov    %rdx,%rax
+  8023b4:	5d                   	pop    %rbp
+  8023b5:	c3                   	ret
+
+00000000008023b6 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8023b6:	55                   	push   %rbp
+  8023b7:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8023ba:	48 83 c7 40          	add    $0x40,%rdi
+  8023be:	48 b8 8a 50 80 00 00 	movabs $0x80508a,%rax
+  8023c5:	00 00 00 
+  8023c8:	ff d0                	call   *%rax
+  8023ca:	84 c0                	test   %al,%al
+  8023cc:	75 02                	jne    8023d0 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8023ce:	5d                   	pop    %rbp
+  8023cf:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8023d0:	48 b8 b5 21 80 00 00 	movabs $0x8021b5,%rax
+  8023d7:	00 00 00 
+  8023da:	ff d0                	call   *%rax
+  8023dc:	89 c7                	mov    %eax,%edi
+  8023de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023e4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023ee:	be 0a 00 00 00       	mov    $0xa,%esi
+  8023f3:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  8023fa:	00 00 00 
+  8023fd:	ff d0                	call   *%rax
+}
+  8023ff:	eb cd                	jmp    8023ce <fschan_publish+0x18>
+
+0000000000802401 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802401:	55                   	push   %rbp
+  802402:	48 89 e5             	mov    %rsp,%rbp
+  802405:	41 57                	push   %r15
+  802407:	41 56                	push   %r14
+  802409:	41 55                	push   %r13
+  80240b:	41 54                	push   %r12
+  80240d:	53                   	push   %rbx
+  80240e:	48 83 ec 48          	sub    $0x48,%rsp
+  802412:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802416:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80241a:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80241d:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802421:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802424:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80242b:	00 00 00 
+  80242e:	8b 02                	mov    (%rdx),%eax
+  802430:	83 c0 01             	add    $0x1,%eax
+  802433:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802438:	0f 44 c1             	cmove  %ecx,%eax
+  80243b:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80243d:	4d 85 c0             	test   %r8,%r8
+  802440:	74 2c                	je     80246e <fschan_rw+0x6d>
+  802442:	45 89 ce             	mov    %r9d,%r14d
+  802445:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80244c:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802450:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802456:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80245d:	00 
+  80245e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802464:	b8 01 00 00 00       	mov    $0x1,%eax
+  802469:	e9 41 01 00 00       	jmp    8025af <fschan_rw+0x1ae>
+  80246e:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802472:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802476:	e9 9c 01 00 00       	jmp    802617 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80247b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80247f:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802482:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802485:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802488:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80248c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802490:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802494:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802498:	48 89 da             	mov    %rbx,%rdx
+  80249b:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  8024a2:	00 00 00 
+  8024a5:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8024a7:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8024ab:	48 b8 b6 23 80 00 00 	movabs $0x8023b6,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+            queued += blk;
+  8024b7:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8024ba:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8024be:	4d 39 fc             	cmp    %r15,%r12
+  8024c1:	73 6b                	jae    80252e <fschan_rw+0x12d>
+  8024c3:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8024c7:	77 65                	ja     80252e <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024c9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024cd:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024d1:	48 b8 65 50 80 00 00 	movabs $0x805065,%rax
+  8024d8:	00 00 00 
+  8024db:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8024dd:	4c 89 fb             	mov    %r15,%rbx
+  8024e0:	4c 29 e3             	sub    %r12,%rbx
+  8024e3:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8024e8:	48 39 d3             	cmp    %rdx,%rbx
+  8024eb:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8024ef:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8024f3:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8024f7:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8024fb:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8024fe:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802500:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802507:	00 00 00 
+  80250a:	8b 09                	mov    (%rcx),%ecx
+  80250c:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80250f:	83 fe 03             	cmp    $0x3,%esi
+  802512:	0f 85 63 ff ff ff    	jne    80247b <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802518:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80251c:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80251f:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802522:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802525:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802529:	e9 79 ff ff ff       	jmp    8024a7 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80252e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802532:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802539:	48 89 df             	mov    %rbx,%rdi
+  80253c:	48 b8 28 51 80 00 00 	movabs $0x805128,%rax
+  802543:	00 00 00 
+  802546:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802548:	48 89 df             	mov    %rbx,%rdi
+  80254b:	48 b8 b6 50 80 00 00 	movabs $0x8050b6,%rax
+  802552:	00 00 00 
+  802555:	ff d0                	call   *%rax
+  802557:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80255b:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80255f:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802563:	75 25                	jne    80258a <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802565:	8b 40 04             	mov    0x4(%rax),%eax
+  802568:	85 c0                	test   %eax,%eax
+  80256a:	0f 88 86 00 00 00    	js     8025f6 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802570:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802574:	74 5b                	je     8025d1 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802576:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80257a:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80257e:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802582:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802586:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80258a:	48 89 df             	mov    %rbx,%rdi
+  80258d:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  802594:	00 00 00 
+  802597:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802599:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80259d:	83 f0 01             	xor    $0x1,%eax
+  8025a0:	4d 39 fc             	cmp    %r15,%r12
+  8025a3:	0f 92 c2             	setb   %dl
+  8025a6:	84 c2                	test   %al,%dl
+  8025a8:	75 05                	jne    8025af <fschan_rw+0x1ae>
+  8025aa:	45 85 ed             	test   %r13d,%r13d
+  8025ad:	74 50                	je     8025ff <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8025af:	4d 39 fc             	cmp    %r15,%r12
+  8025b2:	0f 92 c1             	setb   %cl
+  8025b5:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8025b9:	0f 96 c2             	setbe  %dl
+  8025bc:	84 d1                	test   %dl,%cl
+  8025be:	0f 84 6a ff ff ff    	je     80252e <fschan_rw+0x12d>
+  8025c4:	84 c0                	test   %al,%al
+  8025c6:	0f 85 fd fe ff ff    	jne    8024c9 <fschan_rw+0xc8>
+  8025cc:	e9 5d ff ff ff       	jmp    80252e <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8025d1:	48 63 d0             	movslq %eax,%rdx
+  8025d4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8025d8:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025dc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8025e0:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8025e4:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8025e8:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+  8025f4:	eb 80                	jmp    802576 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8025f6:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8025f9:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8025fd:	eb 8b                	jmp    80258a <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8025ff:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802604:	0f 85 68 fe ff ff    	jne    802472 <fschan_rw+0x71>
+  80260a:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80260d:	85 c0                	test   %eax,%eax
+  80260f:	0f 84 5d fe ff ff    	je     802472 <fschan_rw+0x71>
+  802615:	48 98                	cltq
+}
+  802617:	48 83 c4 48          	add    $0x48,%rsp
+  80261b:	5b                   	pop    %rbx
+  80261c:	41 5c                	pop    %r12
+  80261e:	41 5d                	pop    %r13
+  802620:	41 5e                	pop    %r14
+  802622:	41 5f                	pop    %r15
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+
+0000000000802626 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802626:	55                   	push   %rbp
+  802627:	48 89 e5             	mov    %rsp,%rbp
+  80262a:	41 56                	push   %r14
+  80262c:	41 55                	push   %r13
+  80262e:	41 54                	push   %r12
+  802630:	53                   	push   %rbx
+  802631:	48 83 ec 10          	sub    $0x10,%rsp
+  802635:	49 89 fe             	mov    %rdi,%r14
+  802638:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80263b:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80263f:	48 29 f3             	sub    %rsi,%rbx
+  802642:	48 39 d3             	cmp    %rdx,%rbx
+  802645:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802649:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802650:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802651:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802656:	49 bd 58 4c 80 00 00 	movabs $0x804c58,%r13
+  80265d:	00 00 00 
+  802660:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802667:	76 1e                	jbe    802687 <mmap_fault+0x61>
+  802669:	4c 01 e7             	add    %r12,%rdi
+  80266c:	41 ff d5             	call   *%r13
+  80266f:	84 c0                	test   %al,%al
+  802671:	75 14                	jne    802687 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802673:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802677:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80267e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802682:	48 39 df             	cmp    %rbx,%rdi
+  802685:	72 e2                	jb     802669 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802687:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80268e:	00 00 00 
+  802691:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802698:	00 00 00 
+  80269b:	4c 89 f0             	mov    %r14,%rax
+  80269e:	48 29 d0             	sub    %rdx,%rax
+  8026a1:	48 c1 f8 03          	sar    $0x3,%rax
+  8026a5:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8026ac:	aa aa aa 
+  8026af:	48 0f af c2          	imul   %rdx,%rax
+  8026b3:	48 c1 e0 0c          	shl    $0xc,%rax
+  8026b7:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8026bc:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8026c0:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8026c2:	44 89 e0             	mov    %r12d,%eax
+  8026c5:	41 03 46 10          	add    0x10(%r14),%eax
+  8026c9:	41 2b 06             	sub    (%r14),%eax
+  8026cc:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8026cf:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026d3:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8026d7:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8026db:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8026de:	48 b8 b5 21 80 00 00 	movabs $0x8021b5,%rax
+  8026e5:	00 00 00 
+  8026e8:	ff d0                	call   *%rax
+  8026ea:	89 c7                	mov    %eax,%edi
+  8026ec:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026f2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8026f7:	48 89 da             	mov    %rbx,%rdx
+  8026fa:	be 0f 00 00 00       	mov    $0xf,%esi
+  8026ff:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  802706:	00 00 00 
+  802709:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80270b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802710:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802714:	4c 89 e6             	mov    %r12,%rsi
+  802717:	bf 00 00 00 00       	mov    $0x0,%edi
+  80271c:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  802723:	00 00 00 
+  802726:	ff d0                	call   *%rax
+  802728:	48 98                	cltq
+}
+  80272a:	48 83 c4 10          	add    $0x10,%rsp
+  80272e:	5b                   	pop    %rbx
+  80272f:	41 5c                	pop    %r12
+  802731:	41 5d                	pop    %r13
+  802733:	41 5e                	pop    %r14
+  802735:	5d                   	pop    %rbp
+  802736:	c3                   	ret
+
+0000000000802737 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802737:	48 8b 37             	mov    (%rdi),%rsi
+  80273a:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802741:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802748:	00 00 00 
+  80274b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802750:	eb 0f                	jmp    802761 <mmap_pgfault+0x2a>
+  802752:	c3                   	ret
+  802753:	48 83 c1 01          	add    $0x1,%rcx
+  802757:	48 83 c2 18          	add    $0x18,%rdx
+  80275b:	48 83 f9 20          	cmp    $0x20,%rcx
+  80275f:	74 6e                	je     8027cf <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802761:	48 8b 02             	mov    (%rdx),%rax
+  802764:	48 83 e8 01          	sub    $0x1,%rax
+  802768:	48 39 f0             	cmp    %rsi,%rax
+  80276b:	73 e6                	jae    802753 <mmap_pgfault+0x1c>
+  80276d:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802771:	73 e0                	jae    802753 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802773:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80277c:	f6 c2 01             	test   $0x1,%dl
+  80277f:	75 d1                	jne    802752 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802781:	f6 c2 02             	test   $0x2,%dl
+  802784:	74 1a                	je     8027a0 <mmap_pgfault+0x69>
+  802786:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80278a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278f:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802796:	00 00 00 
+  802799:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80279e:	74 35                	je     8027d5 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8027a0:	55                   	push   %rbp
+  8027a1:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8027a4:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8027a8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027af:	00 00 00 
+  8027b2:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8027b6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8027bb:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  8027c2:	00 00 00 
+  8027c5:	ff d0                	call   *%rax
+  8027c7:	48 85 c0             	test   %rax,%rax
+  8027ca:	0f 9f c0             	setg   %al
+}
+  8027cd:	5d                   	pop    %rbp
+  8027ce:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8027cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027d4:	c3                   	ret
+}
+  8027d5:	c3                   	ret
+
+00000000008027d6 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8027d6:	55                   	push   %rbp
+  8027d7:	48 89 e5             	mov    %rsp,%rbp
+  8027da:	41 54                	push   %r12
+  8027dc:	53                   	push   %rbx
+  8027dd:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8027e0:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027e7:	00 00 00 
+  8027ea:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8027ef:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8027f3:	74 15                	je     80280a <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8027f5:	48 83 c3 01          	add    $0x1,%rbx
+  8027f9:	48 83 c0 18          	add    $0x18,%rax
+  8027fd:	48 83 fb 20          	cmp    $0x20,%rbx
+  802801:	75 ec                	jne    8027ef <mmap_alloc+0x19>
+    return NULL;
+  802803:	b8 00 00 00 00       	mov    $0x0,%eax
+  802808:	eb 52                	jmp    80285c <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80280a:	4c 89 e7             	mov    %r12,%rdi
+  80280d:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  802814:	00 00 00 
+  802817:	ff d0                	call   *%rax
+  802819:	41 89 c1             	mov    %eax,%r9d
+  80281c:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802823:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802827:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80282d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802832:	4c 89 e6             	mov    %r12,%rsi
+  802835:	bf 00 00 00 00       	mov    $0x0,%edi
+  80283a:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  802841:	00 00 00 
+  802844:	ff d0                	call   *%rax
+  802846:	85 c0                	test   %eax,%eax
+  802848:	78 17                	js     802861 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80284a:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80284e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802855:	00 00 00 
+  802858:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80285c:	5b                   	pop    %rbx
+  80285d:	41 5c                	pop    %r12
+  80285f:	5d                   	pop    %rbp
+  802860:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802861:	b8 00 00 00 00       	mov    $0x0,%eax
+  802866:	eb f4                	jmp    80285c <mmap_alloc+0x86>
+
+0000000000802868 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802868:	55                   	push   %rbp
+  802869:	48 89 e5             	mov    %rsp,%rbp
+  80286c:	41 56                	push   %r14
+  80286e:	41 55                	push   %r13
+  802870:	41 54                	push   %r12
+  802872:	53                   	push   %rbx
+  802873:	48 83 ec 10          	sub    $0x10,%rsp
+  802877:	41 89 fc             	mov    %edi,%r12d
+  80287a:	49 89 f5             	mov    %rsi,%r13
+  80287d:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802880:	48 89 f0             	mov    %rsi,%rax
+  802883:	48 09 d0             	or     %rdx,%rax
+  802886:	75 0d                	jne    802895 <fsipc+0x2d>
+  802888:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80288b:	83 f8 04             	cmp    $0x4,%eax
+  80288e:	76 7d                	jbe    80290d <fsipc+0xa5>
+  802890:	83 ff 0d             	cmp    $0xd,%edi
+  802893:	74 78                	je     80290d <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802895:	48 b8 b5 21 80 00 00 	movabs $0x8021b5,%rax
+  80289c:	00 00 00 
+  80289f:	ff d0                	call   *%rax
+  8028a1:	89 c7                	mov    %eax,%edi
+  8028a3:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8028aa:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8028b1:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8028b8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028be:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8028c5:	00 00 00 
+  8028c8:	44 89 e6             	mov    %r12d,%esi
+  8028cb:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  8028d2:	00 00 00 
+  8028d5:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8028d7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8028de:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8028df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028e4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8028e8:	4c 89 ee             	mov    %r13,%rsi
+  8028eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028f0:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  8028f7:	00 00 00 
+  8028fa:	ff d0                	call   *%rax
+  8028fc:	89 c3                	mov    %eax,%ebx
+}
+  8028fe:	89 d8                	mov    %ebx,%eax
+  802900:	48 83 c4 10          	add    $0x10,%rsp
+  802904:	5b                   	pop    %rbx
+  802905:	41 5c                	pop    %r12
+  802907:	41 5d                	pop    %r13
+  802909:	41 5e                	pop    %r14
+  80290b:	5d                   	pop    %rbp
+  80290c:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80290d:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+  802919:	49 89 c6             	mov    %rax,%r14
+  80291c:	48 85 c0             	test   %rax,%rax
+  80291f:	0f 84 70 ff ff ff    	je     802895 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802925:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802929:	48 b8 65 50 80 00 00 	movabs $0x805065,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802935:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802938:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80293f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802943:	ba 10 00 00 00       	mov    $0x10,%edx
+  802948:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80294f:	00 00 00 
+  802952:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80295e:	4c 89 f7             	mov    %r14,%rdi
+  802961:	48 b8 b6 23 80 00 00 	movabs $0x8023b6,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80296d:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802974:	4c 89 f7             	mov    %r14,%rdi
+  802977:	48 b8 28 51 80 00 00 	movabs $0x805128,%rax
+  80297e:	00 00 00 
+  802981:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802983:	4c 89 f7             	mov    %r14,%rdi
+  802986:	48 b8 b6 50 80 00 00 	movabs $0x8050b6,%rax
+  80298d:	00 00 00 
+  802990:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802992:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802995:	41 83 fc 05          	cmp    $0x5,%r12d
+  802999:	75 04                	jne    80299f <fsipc+0x137>
+  80299b:	85 db                	test   %ebx,%ebx
+  80299d:	79 14                	jns    8029b3 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80299f:	4c 89 f7             	mov    %r14,%rdi
+  8029a2:	48 b8 dd 50 80 00 00 	movabs $0x8050dd,%rax
+  8029a9:	00 00 00 
+  8029ac:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8029ae:	e9 4b ff ff ff       	jmp    8028fe <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8029b3:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8029b7:	ba 88 00 00 00       	mov    $0x88,%edx
+  8029bc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8029c3:	00 00 00 
+  8029c6:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  8029cd:	00 00 00 
+  8029d0:	ff d0                	call   *%rax
+  8029d2:	eb cb                	jmp    80299f <fsipc+0x137>
+
+00000000008029d4 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029d4:	55                   	push   %rbp
+  8029d5:	48 89 e5             	mov    %rsp,%rbp
+  8029d8:	41 57                	push   %r15
+  8029da:	41 56                	push   %r14
+  8029dc:	41 55                	push   %r13
+  8029de:	41 54                	push   %r12
+  8029e0:	53                   	push   %rbx
+  8029e1:	48 83 ec 18          	sub    $0x18,%rsp
+  8029e5:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8029e9:	49 89 f6             	mov    %rsi,%r14
+  8029ec:	49 89 d4             	mov    %rdx,%r12
+  8029ef:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8029f2:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8029fe:	48 85 c0             	test   %rax,%rax
+  802a01:	0f 85 96 00 00 00    	jne    802a9d <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802a07:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a0e:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a0f:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802a16:	00 00 00 
+    while (n) {
+  802a19:	4d 85 e4             	test   %r12,%r12
+  802a1c:	74 79                	je     802a97 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a1e:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802a23:	49 39 dc             	cmp    %rbx,%r12
+  802a26:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802a2a:	48 89 da             	mov    %rbx,%rdx
+  802a2d:	4c 89 f6             	mov    %r14,%rsi
+  802a30:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802a37:	00 00 00 
+  802a3a:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  802a41:	00 00 00 
+  802a44:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a46:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a4a:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a4d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802a50:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802a53:	44 01 e8             	add    %r13d,%eax
+  802a56:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802a5a:	41 0f 44 c5          	cmove  %r13d,%eax
+  802a5e:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802a62:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802a66:	48 89 da             	mov    %rbx,%rdx
+  802a69:	be 00 00 00 00       	mov    $0x0,%esi
+  802a6e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a73:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  802a7a:	00 00 00 
+  802a7d:	ff d0                	call   *%rax
+        if (res < 0)
+  802a7f:	85 c0                	test   %eax,%eax
+  802a81:	78 4a                	js     802acd <devfile_write_direct+0xf9>
+        buf += res;
+  802a83:	48 98                	cltq
+  802a85:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a88:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a8c:	49 29 c4             	sub    %rax,%r12
+  802a8f:	75 8d                	jne    802a1e <devfile_write_direct+0x4a>
+    return write;
+  802a91:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a95:	eb 27                	jmp    802abe <devfile_write_direct+0xea>
+    size_t write = 0;
+  802a97:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802a9b:	eb f4                	jmp    802a91 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a9d:	45 89 e9             	mov    %r13d,%r9d
+  802aa0:	4d 89 e0             	mov    %r12,%r8
+  802aa3:	4c 89 f1             	mov    %r14,%rcx
+  802aa6:	ba 04 00 00 00       	mov    $0x4,%edx
+  802aab:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802aaf:	48 89 c7             	mov    %rax,%rdi
+  802ab2:	48 b8 01 24 80 00 00 	movabs $0x802401,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+}
+  802abe:	48 83 c4 18          	add    $0x18,%rsp
+  802ac2:	5b                   	pop    %rbx
+  802ac3:	41 5c                	pop    %r12
+  802ac5:	41 5d                	pop    %r13
+  802ac7:	41 5e                	pop    %r14
+  802ac9:	41 5f                	pop    %r15
+  802acb:	5d                   	pop    %rbp
+  802acc:	c3                   	ret
+            return res;
+  802acd:	48 98                	cltq
+  802acf:	eb ed                	jmp    802abe <devfile_write_direct+0xea>
+
+0000000000802ad1 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802ad1:	55                   	push   %rbp
+  802ad2:	48 89 e5             	mov    %rsp,%rbp
+  802ad5:	41 54                	push   %r12
+  802ad7:	53                   	push   %rbx
+  802ad8:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802adb:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  802ae2:	00 00 00 
+  802ae5:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802ae7:	48 85 c0             	test   %rax,%rax
+  802aea:	74 71                	je     802b5d <fbuf_flush+0x8c>
+  802aec:	48 89 c3             	mov    %rax,%rbx
+  802aef:	b8 00 00 00 00       	mov    $0x0,%eax
+  802af4:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802af8:	75 05                	jne    802aff <fbuf_flush+0x2e>
+}
+  802afa:	5b                   	pop    %rbx
+  802afb:	41 5c                	pop    %r12
+  802afd:	5d                   	pop    %rbp
+  802afe:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802aff:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802b02:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802b06:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802b0d:	00 00 00 
+  802b10:	48 89 de             	mov    %rbx,%rsi
+  802b13:	48 29 c6             	sub    %rax,%rsi
+  802b16:	48 c1 fe 03          	sar    $0x3,%rsi
+  802b1a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b21:	aa aa aa 
+  802b24:	48 0f af f0          	imul   %rax,%rsi
+  802b28:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802b2c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b31:	48 01 c6             	add    %rax,%rsi
+  802b34:	4c 89 e7             	mov    %r12,%rdi
+  802b37:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802b43:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802b47:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b4e:	00 
+    return res < 0 ? res : 0;
+  802b4f:	48 85 c0             	test   %rax,%rax
+  802b52:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b57:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802b5b:	eb 9d                	jmp    802afa <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b62:	eb 96                	jmp    802afa <fbuf_flush+0x29>
+
+0000000000802b64 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802b64:	55                   	push   %rbp
+  802b65:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802b68:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+}
+  802b74:	5d                   	pop    %rbp
+  802b75:	c3                   	ret
+
+0000000000802b76 <devfile_write>:
+    if (!fd || !buf)
+  802b76:	48 85 ff             	test   %rdi,%rdi
+  802b79:	0f 84 d3 01 00 00    	je     802d52 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b7f:	55                   	push   %rbp
+  802b80:	48 89 e5             	mov    %rsp,%rbp
+  802b83:	41 57                	push   %r15
+  802b85:	41 56                	push   %r14
+  802b87:	41 55                	push   %r13
+  802b89:	41 54                	push   %r12
+  802b8b:	53                   	push   %rbx
+  802b8c:	48 83 ec 08          	sub    $0x8,%rsp
+  802b90:	49 89 fc             	mov    %rdi,%r12
+  802b93:	49 89 f6             	mov    %rsi,%r14
+  802b96:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802b99:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b9e:	48 85 f6             	test   %rsi,%rsi
+  802ba1:	0f 84 9c 01 00 00    	je     802d43 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802ba7:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  802bae:	00 00 00 
+  802bb1:	ff d0                	call   *%rax
+  802bb3:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802bb6:	48 85 c0             	test   %rax,%rax
+  802bb9:	0f 84 a2 00 00 00    	je     802c61 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802bbf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bc4:	4c 89 e7             	mov    %r12,%rdi
+  802bc7:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  802bce:	00 00 00 
+  802bd1:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802bd3:	83 f8 02             	cmp    $0x2,%eax
+  802bd6:	0f 8f 85 00 00 00    	jg     802c61 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802bdc:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802be3:	00 00 00 
+  802be6:	4d 89 ef             	mov    %r13,%r15
+  802be9:	49 29 c7             	sub    %rax,%r15
+  802bec:	49 c1 ff 03          	sar    $0x3,%r15
+  802bf0:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802bf7:	aa aa aa 
+  802bfa:	4c 0f af f8          	imul   %rax,%r15
+  802bfe:	49 c1 e7 0e          	shl    $0xe,%r15
+  802c02:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c07:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802c0a:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c0f:	0f 84 d7 00 00 00    	je     802cec <devfile_write+0x176>
+  802c15:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802c19:	89 c2                	mov    %eax,%edx
+  802c1b:	41 03 55 0c          	add    0xc(%r13),%edx
+  802c1f:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802c24:	75 0f                	jne    802c35 <devfile_write+0xbf>
+  802c26:	48 01 d8             	add    %rbx,%rax
+  802c29:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802c2f:	0f 86 92 00 00 00    	jbe    802cc7 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c35:	4c 89 e7             	mov    %r12,%rdi
+  802c38:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  802c3f:	00 00 00 
+  802c42:	ff d0                	call   *%rax
+  802c44:	85 c0                	test   %eax,%eax
+  802c46:	78 52                	js     802c9a <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c48:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c4f:	77 7f                	ja     802cd0 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802c51:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c56:	0f 85 c2 00 00 00    	jne    802d1e <devfile_write+0x1a8>
+  802c5c:	e9 94 00 00 00       	jmp    802cf5 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802c61:	4c 89 e7             	mov    %r12,%rdi
+  802c64:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  802c6b:	00 00 00 
+  802c6e:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c70:	85 c0                	test   %eax,%eax
+  802c72:	79 07                	jns    802c7b <devfile_write+0x105>
+  802c74:	48 98                	cltq
+  802c76:	e9 c8 00 00 00       	jmp    802d43 <devfile_write+0x1cd>
+  802c7b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c80:	48 89 da             	mov    %rbx,%rdx
+  802c83:	4c 89 f6             	mov    %r14,%rsi
+  802c86:	4c 89 e7             	mov    %r12,%rdi
+  802c89:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+  802c95:	e9 a9 00 00 00       	jmp    802d43 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c9a:	48 98                	cltq
+  802c9c:	e9 a2 00 00 00       	jmp    802d43 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ca1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ca6:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802cab:	4c 89 fe             	mov    %r15,%rsi
+  802cae:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cb3:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  802cba:	00 00 00 
+  802cbd:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802cbf:	85 c0                	test   %eax,%eax
+  802cc1:	79 45                	jns    802d08 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802cc3:	48 98                	cltq
+  802cc5:	eb 7c                	jmp    802d43 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cc7:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802cce:	76 4e                	jbe    802d1e <devfile_write+0x1a8>
+  802cd0:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802cd5:	48 89 da             	mov    %rbx,%rdx
+  802cd8:	4c 89 f6             	mov    %r14,%rsi
+  802cdb:	4c 89 e7             	mov    %r12,%rdi
+  802cde:	48 b8 d4 29 80 00 00 	movabs $0x8029d4,%rax
+  802ce5:	00 00 00 
+  802ce8:	ff d0                	call   *%rax
+  802cea:	eb 57                	jmp    802d43 <devfile_write+0x1cd>
+  802cec:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802cf3:	77 db                	ja     802cd0 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802cf5:	4c 89 ff             	mov    %r15,%rdi
+  802cf8:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+  802d04:	84 c0                	test   %al,%al
+  802d06:	74 99                	je     802ca1 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802d08:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802d0d:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d12:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802d16:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802d1d:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802d1e:	4c 89 ff             	mov    %r15,%rdi
+  802d21:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802d25:	48 89 da             	mov    %rbx,%rdx
+  802d28:	4c 89 f6             	mov    %r14,%rsi
+  802d2b:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  802d32:	00 00 00 
+  802d35:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802d37:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802d3b:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802d40:	48 89 d8             	mov    %rbx,%rax
+}
+  802d43:	48 83 c4 08          	add    $0x8,%rsp
+  802d47:	5b                   	pop    %rbx
+  802d48:	41 5c                	pop    %r12
+  802d4a:	41 5d                	pop    %r13
+  802d4c:	41 5e                	pop    %r14
+  802d4e:	41 5f                	pop    %r15
+  802d50:	5d                   	pop    %rbp
+  802d51:	c3                   	ret
+        return E_INVAL;
+  802d52:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d57:	c3                   	ret
+
+0000000000802d58 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d58:	55                   	push   %rbp
+  802d59:	48 89 e5             	mov    %rsp,%rbp
+  802d5c:	41 54                	push   %r12
+  802d5e:	53                   	push   %rbx
+  802d5f:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802d62:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  802d69:	00 00 00 
+  802d6c:	ff d0                	call   *%rax
+  802d6e:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802d71:	48 89 df             	mov    %rbx,%rdi
+  802d74:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  802d7b:	00 00 00 
+  802d7e:	ff d0                	call   *%rax
+  802d80:	48 85 c0             	test   %rax,%rax
+  802d83:	74 17                	je     802d9c <devfile_flush+0x44>
+  802d85:	48 89 df             	mov    %rbx,%rdi
+  802d88:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  802d8f:	00 00 00 
+  802d92:	ff d0                	call   *%rax
+  802d94:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802d9b:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d9c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d9f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802da6:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802da8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dad:	be 00 00 00 00       	mov    $0x0,%esi
+  802db2:	bf 06 00 00 00       	mov    $0x6,%edi
+  802db7:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  802dbe:	00 00 00 
+  802dc1:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802dc3:	45 85 e4             	test   %r12d,%r12d
+  802dc6:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802dca:	5b                   	pop    %rbx
+  802dcb:	41 5c                	pop    %r12
+  802dcd:	5d                   	pop    %rbp
+  802dce:	c3                   	ret
+
+0000000000802dcf <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802dcf:	55                   	push   %rbp
+  802dd0:	48 89 e5             	mov    %rsp,%rbp
+  802dd3:	41 57                	push   %r15
+  802dd5:	41 56                	push   %r14
+  802dd7:	41 55                	push   %r13
+  802dd9:	41 54                	push   %r12
+  802ddb:	53                   	push   %rbx
+  802ddc:	48 83 ec 38          	sub    $0x38,%rsp
+  802de0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802de4:	49 89 f7             	mov    %rsi,%r15
+  802de7:	48 89 d3             	mov    %rdx,%rbx
+  802dea:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802ded:	48 b8 1a 23 80 00 00 	movabs $0x80231a,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802df9:	48 85 c0             	test   %rax,%rax
+  802dfc:	75 20                	jne    802e1e <devfile_read_direct+0x4f>
+    bool map = 1;
+  802dfe:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802e03:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802e0a:	00 
+    while (n) {
+  802e0b:	48 85 db             	test   %rbx,%rbx
+  802e0e:	0f 85 df 00 00 00    	jne    802ef3 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802e14:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802e18:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e1c:	eb 21                	jmp    802e3f <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e1e:	45 89 f1             	mov    %r14d,%r9d
+  802e21:	49 89 d8             	mov    %rbx,%r8
+  802e24:	4c 89 f9             	mov    %r15,%rcx
+  802e27:	ba 03 00 00 00       	mov    $0x3,%edx
+  802e2c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e30:	48 89 c7             	mov    %rax,%rdi
+  802e33:	48 b8 01 24 80 00 00 	movabs $0x802401,%rax
+  802e3a:	00 00 00 
+  802e3d:	ff d0                	call   *%rax
+}
+  802e3f:	48 83 c4 38          	add    $0x38,%rsp
+  802e43:	5b                   	pop    %rbx
+  802e44:	41 5c                	pop    %r12
+  802e46:	41 5d                	pop    %r13
+  802e48:	41 5e                	pop    %r14
+  802e4a:	41 5f                	pop    %r15
+  802e4c:	5d                   	pop    %rbp
+  802e4d:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e4e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e52:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e58:	75 1e                	jne    802e78 <devfile_read_direct+0xa9>
+  802e5a:	e9 e2 00 00 00       	jmp    802f41 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802e5f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e63:	eb da                	jmp    802e3f <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802e65:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802e69:	0f 85 d0 01 00 00    	jne    80303f <devfile_read_direct+0x270>
+            map = 0;
+  802e6f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e73:	eb 03                	jmp    802e78 <devfile_read_direct+0xa9>
+  802e75:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e78:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e7d:	48 39 d3             	cmp    %rdx,%rbx
+  802e80:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e84:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e88:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e8b:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802e92:	00 00 00 
+  802e95:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802e97:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802e9b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802e9f:	be 00 00 00 00       	mov    $0x0,%esi
+  802ea4:	bf 03 00 00 00       	mov    $0x3,%edi
+  802ea9:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  802eb0:	00 00 00 
+  802eb3:	ff d0                	call   *%rax
+        if (res <= 0)
+  802eb5:	85 c0                	test   %eax,%eax
+  802eb7:	0f 8e 63 01 00 00    	jle    803020 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ebd:	4c 63 e0             	movslq %eax,%r12
+  802ec0:	4c 89 e2             	mov    %r12,%rdx
+  802ec3:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802eca:	00 00 00 
+  802ecd:	4c 89 ff             	mov    %r15,%rdi
+  802ed0:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  802ed7:	00 00 00 
+  802eda:	ff d0                	call   *%rax
+        buf += res;
+  802edc:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802edf:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802ee2:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802ee6:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802eea:	48 85 db             	test   %rbx,%rbx
+  802eed:	0f 84 25 ff ff ff    	je     802e18 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802ef3:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802ef6:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802efa:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802efe:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f02:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802f09:	0f 97 c2             	seta   %dl
+  802f0c:	20 c2                	and    %al,%dl
+  802f0e:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802f11:	0f 84 5e ff ff ff    	je     802e75 <devfile_read_direct+0xa6>
+  802f17:	4c 89 fa             	mov    %r15,%rdx
+  802f1a:	4d 89 fd             	mov    %r15,%r13
+  802f1d:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802f24:	0f 85 4e ff ff ff    	jne    802e78 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802f2a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802f2e:	0f 84 1a ff ff ff    	je     802e4e <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f34:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f3b:	0f 85 37 ff ff ff    	jne    802e78 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802f41:	48 89 d8             	mov    %rbx,%rax
+  802f44:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f4a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802f4f:	48 39 c8             	cmp    %rcx,%rax
+  802f52:	48 0f 47 c1          	cmova  %rcx,%rax
+  802f56:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802f5a:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802f5e:	49 89 d4             	mov    %rdx,%r12
+  802f61:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802f65:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  802f6c:	00 00 00 
+  802f6f:	ff d0                	call   *%rax
+  802f71:	a8 40                	test   $0x40,%al
+  802f73:	0f 85 b9 00 00 00    	jne    803032 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f79:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802f80:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f84:	49 39 c5             	cmp    %rax,%r13
+  802f87:	72 d8                	jb     802f61 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f89:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f8d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f94:	00 00 00 
+  802f97:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f9b:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802f9e:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802fa0:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802fa4:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802fa8:	48 b8 b5 21 80 00 00 	movabs $0x8021b5,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+  802fb4:	89 c7                	mov    %eax,%edi
+  802fb6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802fbc:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fc1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802fc8:	00 00 00 
+  802fcb:	be 0e 00 00 00       	mov    $0xe,%esi
+  802fd0:	48 b8 ce 19 80 00 00 	movabs $0x8019ce,%rax
+  802fd7:	00 00 00 
+  802fda:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802fdc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fe1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802fe5:	4c 89 fe             	mov    %r15,%rsi
+  802fe8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fed:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  802ff4:	00 00 00 
+  802ff7:	ff d0                	call   *%rax
+  802ff9:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ffc:	48 85 d2             	test   %rdx,%rdx
+  802fff:	0f 84 5a fe ff ff    	je     802e5f <devfile_read_direct+0x90>
+            if (res > 0) {
+  803005:	0f 8e 5a fe ff ff    	jle    802e65 <devfile_read_direct+0x96>
+                buf += res;
+  80300b:	48 98                	cltq
+  80300d:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803010:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803013:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803017:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  80301b:	e9 ca fe ff ff       	jmp    802eea <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803020:	41 89 c5             	mov    %eax,%r13d
+  803023:	48 98                	cltq
+  803025:	45 85 ed             	test   %r13d,%r13d
+  803028:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80302d:	e9 0d fe ff ff       	jmp    802e3f <devfile_read_direct+0x70>
+            map = 0;
+  803032:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803036:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  80303a:	e9 39 fe ff ff       	jmp    802e78 <devfile_read_direct+0xa9>
+  80303f:	48 89 d0             	mov    %rdx,%rax
+  803042:	e9 f8 fd ff ff       	jmp    802e3f <devfile_read_direct+0x70>
+
+0000000000803047 <devfile_read>:
+    if (!fd || !buf)
+  803047:	48 85 ff             	test   %rdi,%rdi
+  80304a:	0f 84 21 02 00 00    	je     803271 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803050:	55                   	push   %rbp
+  803051:	48 89 e5             	mov    %rsp,%rbp
+  803054:	41 57                	push   %r15
+  803056:	41 56                	push   %r14
+  803058:	41 55                	push   %r13
+  80305a:	41 54                	push   %r12
+  80305c:	53                   	push   %rbx
+  80305d:	48 83 ec 28          	sub    $0x28,%rsp
+  803061:	48 89 fb             	mov    %rdi,%rbx
+  803064:	49 89 f4             	mov    %rsi,%r12
+  803067:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  80306a:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80306f:	48 85 f6             	test   %rsi,%rsi
+  803072:	74 4b                	je     8030bf <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803074:	48 b8 84 23 80 00 00 	movabs $0x802384,%rax
+  80307b:	00 00 00 
+  80307e:	ff d0                	call   *%rax
+  803080:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803083:	48 85 c0             	test   %rax,%rax
+  803086:	74 22                	je     8030aa <devfile_read+0x63>
+  803088:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80308f:	77 19                	ja     8030aa <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803091:	be 00 10 00 00       	mov    $0x1000,%esi
+  803096:	48 89 df             	mov    %rbx,%rdi
+  803099:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  8030a0:	00 00 00 
+  8030a3:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8030a5:	83 f8 02             	cmp    $0x2,%eax
+  8030a8:	7e 40                	jle    8030ea <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8030aa:	48 89 df             	mov    %rbx,%rdi
+  8030ad:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  8030b4:	00 00 00 
+  8030b7:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030b9:	85 c0                	test   %eax,%eax
+  8030bb:	79 11                	jns    8030ce <devfile_read+0x87>
+  8030bd:	48 98                	cltq
+}
+  8030bf:	48 83 c4 28          	add    $0x28,%rsp
+  8030c3:	5b                   	pop    %rbx
+  8030c4:	41 5c                	pop    %r12
+  8030c6:	41 5d                	pop    %r13
+  8030c8:	41 5e                	pop    %r14
+  8030ca:	41 5f                	pop    %r15
+  8030cc:	5d                   	pop    %rbp
+  8030cd:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030ce:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8030d3:	4c 89 ea             	mov    %r13,%rdx
+  8030d6:	4c 89 e6             	mov    %r12,%rsi
+  8030d9:	48 89 df             	mov    %rbx,%rdi
+  8030dc:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+  8030e8:	eb d5                	jmp    8030bf <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  8030ea:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8030ee:	48 89 df             	mov    %rbx,%rdi
+  8030f1:	48 b8 d1 2a 80 00 00 	movabs $0x802ad1,%rax
+  8030f8:	00 00 00 
+  8030fb:	ff d0                	call   *%rax
+  8030fd:	85 c0                	test   %eax,%eax
+  8030ff:	0f 88 33 01 00 00    	js     803238 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803105:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  80310c:	00 00 00 
+  80310f:	4c 89 f0             	mov    %r14,%rax
+  803112:	48 29 d0             	sub    %rdx,%rax
+  803115:	48 c1 f8 03          	sar    $0x3,%rax
+  803119:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803120:	aa aa aa 
+  803123:	48 0f af c2          	imul   %rdx,%rax
+  803127:	48 c1 e0 0e          	shl    $0xe,%rax
+  80312b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80312f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803132:	41 39 06             	cmp    %eax,(%r14)
+  803135:	75 0d                	jne    803144 <devfile_read+0xfd>
+  803137:	8b 43 10             	mov    0x10(%rbx),%eax
+  80313a:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80313e:	0f 84 fb 00 00 00    	je     80323f <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803144:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803149:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80314d:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803150:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803154:	48 89 c7             	mov    %rax,%rdi
+  803157:	48 b8 58 4c 80 00 00 	movabs $0x804c58,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+  803163:	84 c0                	test   %al,%al
+  803165:	75 27                	jne    80318e <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803167:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80316c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803171:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803175:	bf 00 00 00 00       	mov    $0x0,%edi
+  80317a:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  803181:	00 00 00 
+  803184:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803186:	85 c0                	test   %eax,%eax
+  803188:	0f 88 dc 00 00 00    	js     80326a <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80318e:	44 89 f8             	mov    %r15d,%eax
+  803191:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803196:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803198:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80319f:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8031a0:	8b 43 10             	mov    0x10(%rbx),%eax
+  8031a3:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8031a7:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8031aa:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8031af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031b3:	48 89 df             	mov    %rbx,%rdi
+  8031b6:	48 b8 cf 2d 80 00 00 	movabs $0x802dcf,%rax
+  8031bd:	00 00 00 
+  8031c0:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8031c2:	48 85 c0             	test   %rax,%rax
+  8031c5:	0f 88 f4 fe ff ff    	js     8030bf <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8031cb:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8031ce:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8031d1:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8031d4:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8031d8:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8031dc:	48 63 d1             	movslq %ecx,%rdx
+  8031df:	48 01 d0             	add    %rdx,%rax
+  8031e2:	4d 63 ff             	movslq %r15d,%r15
+  8031e5:	4c 29 f8             	sub    %r15,%rax
+  8031e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ed:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8031f1:	48 85 c0             	test   %rax,%rax
+  8031f4:	0f 8e c5 fe ff ff    	jle    8030bf <devfile_read+0x78>
+    n = MIN(n, res);
+  8031fa:	4c 39 e8             	cmp    %r13,%rax
+  8031fd:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803201:	8b 73 04             	mov    0x4(%rbx),%esi
+  803204:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803208:	48 63 f6             	movslq %esi,%rsi
+  80320b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803210:	48 01 c6             	add    %rax,%rsi
+  803213:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803217:	48 01 c6             	add    %rax,%rsi
+  80321a:	4c 89 ea             	mov    %r13,%rdx
+  80321d:	4c 89 e7             	mov    %r12,%rdi
+  803220:	48 b8 8b 11 80 00 00 	movabs $0x80118b,%rax
+  803227:	00 00 00 
+  80322a:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80322c:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803230:	4c 89 e8             	mov    %r13,%rax
+  803233:	e9 87 fe ff ff       	jmp    8030bf <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803238:	48 98                	cltq
+  80323a:	e9 80 fe ff ff       	jmp    8030bf <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80323f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803243:	41 39 d7             	cmp    %edx,%r15d
+  803246:	0f 8c f8 fe ff ff    	jl     803144 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80324c:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803250:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803253:	41 39 cf             	cmp    %ecx,%r15d
+  803256:	0f 8d e8 fe ff ff    	jge    803144 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80325c:	4d 63 ff             	movslq %r15d,%r15
+  80325f:	4c 29 f8             	sub    %r15,%rax
+  803262:	48 63 d2             	movslq %edx,%rdx
+  803265:	48 01 d0             	add    %rdx,%rax
+  803268:	eb 87                	jmp    8031f1 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80326a:	48 98                	cltq
+  80326c:	e9 4e fe ff ff       	jmp    8030bf <devfile_read+0x78>
+        return E_INVAL;
+  803271:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803276:	c3                   	ret
+
+0000000000803277 <fs_channel>:
+fs_channel(bool enable) {
+  803277:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803279:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803280:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803282:	ba 00 00 00 00       	mov    $0x0,%edx
+  803287:	40 84 ff             	test   %dil,%dil
+  80328a:	74 47                	je     8032d3 <fs_channel+0x5c>
+  80328c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803293:	00 00 00 
+  803296:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80329c:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8032a3:	00 00 00 
+  8032a6:	3b 08                	cmp    (%rax),%ecx
+  8032a8:	74 29                	je     8032d3 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8032aa:	55                   	push   %rbp
+  8032ab:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8032ae:	48 b8 f7 21 80 00 00 	movabs $0x8021f7,%rax
+  8032b5:	00 00 00 
+  8032b8:	ff d0                	call   *%rax
+  8032ba:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8032bc:	85 c0                	test   %eax,%eax
+  8032be:	78 04                	js     8032c4 <fs_channel+0x4d>
+}
+  8032c0:	89 d0                	mov    %edx,%eax
+  8032c2:	5d                   	pop    %rbp
+  8032c3:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8032c4:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8032cb:	00 00 00 
+  8032ce:	c6 00 00             	movb   $0x0,(%rax)
+  8032d1:	eb ed                	jmp    8032c0 <fs_channel+0x49>
+}
+  8032d3:	89 d0                	mov    %edx,%eax
+  8032d5:	c3                   	ret
+
+00000000008032d6 <open>:
+open(const char *path, int mode) {
+  8032d6:	55                   	push   %rbp
+  8032d7:	48 89 e5             	mov    %rsp,%rbp
+  8032da:	41 55                	push   %r13
+  8032dc:	41 54                	push   %r12
+  8032de:	53                   	push   %rbx
+  8032df:	48 83 ec 18          	sub    $0x18,%rsp
+  8032e3:	49 89 fc             	mov    %rdi,%r12
+  8032e6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032e9:	48 b8 ec 0e 80 00 00 	movabs $0x800eec,%rax
+  8032f0:	00 00 00 
+  8032f3:	ff d0                	call   *%rax
+  8032f5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032fb:	0f 87 8f 00 00 00    	ja     803390 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803301:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803305:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  80330c:	00 00 00 
+  80330f:	ff d0                	call   *%rax
+  803311:	89 c3                	mov    %eax,%ebx
+  803313:	85 c0                	test   %eax,%eax
+  803315:	78 55                	js     80336c <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803317:	4c 89 e6             	mov    %r12,%rsi
+  80331a:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803321:	00 00 00 
+  803324:	48 89 df             	mov    %rbx,%rdi
+  803327:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  80332e:	00 00 00 
+  803331:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803333:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80333a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80333f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803343:	bf 01 00 00 00       	mov    $0x1,%edi
+  803348:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  80334f:	00 00 00 
+  803352:	ff d0                	call   *%rax
+  803354:	89 c3                	mov    %eax,%ebx
+  803356:	85 c0                	test   %eax,%eax
+  803358:	78 1f                	js     803379 <open+0xa3>
+    return fd2num(fd);
+  80335a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80335e:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  803365:	00 00 00 
+  803368:	ff d0                	call   *%rax
+  80336a:	89 c3                	mov    %eax,%ebx
+}
+  80336c:	89 d8                	mov    %ebx,%eax
+  80336e:	48 83 c4 18          	add    $0x18,%rsp
+  803372:	5b                   	pop    %rbx
+  803373:	41 5c                	pop    %r12
+  803375:	41 5d                	pop    %r13
+  803377:	5d                   	pop    %rbp
+  803378:	c3                   	ret
+        fd_close(fd, 0);
+  803379:	be 00 00 00 00       	mov    $0x0,%esi
+  80337e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803382:	48 b8 cc 1b 80 00 00 	movabs $0x801bcc,%rax
+  803389:	00 00 00 
+  80338c:	ff d0                	call   *%rax
+        return res;
+  80338e:	eb dc                	jmp    80336c <open+0x96>
+        return -E_BAD_PATH;
+  803390:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803395:	eb d5                	jmp    80336c <open+0x96>
+
+0000000000803397 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803397:	55                   	push   %rbp
+  803398:	48 89 e5             	mov    %rsp,%rbp
+  80339b:	41 56                	push   %r14
+  80339d:	41 55                	push   %r13
+  80339f:	41 54                	push   %r12
+  8033a1:	53                   	push   %rbx
+  8033a2:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8033a6:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8033ad:	00 00 00 
+  8033b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033b5:	49 bd 11 1b 80 00 00 	movabs $0x801b11,%r13
+  8033bc:	00 00 00 
+  8033bf:	49 be d1 2a 80 00 00 	movabs $0x802ad1,%r14
+  8033c6:	00 00 00 
+  8033c9:	eb 0c                	jmp    8033d7 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8033cb:	83 c3 01             	add    $0x1,%ebx
+  8033ce:	49 83 c4 18          	add    $0x18,%r12
+  8033d2:	83 fb 20             	cmp    $0x20,%ebx
+  8033d5:	74 1d                	je     8033f4 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033d7:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8033dc:	74 ed                	je     8033cb <file_flush_buffers+0x34>
+  8033de:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033e2:	89 df                	mov    %ebx,%edi
+  8033e4:	41 ff d5             	call   *%r13
+  8033e7:	85 c0                	test   %eax,%eax
+  8033e9:	78 e0                	js     8033cb <file_flush_buffers+0x34>
+  8033eb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033ef:	41 ff d6             	call   *%r14
+  8033f2:	eb d7                	jmp    8033cb <file_flush_buffers+0x34>
+}
+  8033f4:	48 83 c4 10          	add    $0x10,%rsp
+  8033f8:	5b                   	pop    %rbx
+  8033f9:	41 5c                	pop    %r12
+  8033fb:	41 5d                	pop    %r13
+  8033fd:	41 5e                	pop    %r14
+  8033ff:	5d                   	pop    %rbp
+  803400:	c3                   	ret
+
+0000000000803401 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803401:	55                   	push   %rbp
+  803402:	48 89 e5             	mov    %rsp,%rbp
+  803405:	41 54                	push   %r12
+  803407:	53                   	push   %rbx
+  803408:	49 89 fc             	mov    %rdi,%r12
+  80340b:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80340d:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  803414:	00 00 00 
+  803417:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803419:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803420:	00 00 00 
+  803423:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803428:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80342a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80342d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803432:	be 00 00 00 00       	mov    $0x0,%esi
+  803437:	bf 02 00 00 00       	mov    $0x2,%edi
+  80343c:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  803443:	00 00 00 
+  803446:	ff d0                	call   *%rax
+}
+  803448:	5b                   	pop    %rbx
+  803449:	41 5c                	pop    %r12
+  80344b:	5d                   	pop    %rbp
+  80344c:	c3                   	ret
+
+000000000080344d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80344d:	55                   	push   %rbp
+  80344e:	48 89 e5             	mov    %rsp,%rbp
+  803451:	41 54                	push   %r12
+  803453:	53                   	push   %rbx
+  803454:	49 89 fc             	mov    %rdi,%r12
+  803457:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80345a:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  803461:	00 00 00 
+  803464:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803466:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80346b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803472:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803474:	ba 00 00 00 00       	mov    $0x0,%edx
+  803479:	be 00 00 00 00       	mov    $0x0,%esi
+  80347e:	bf 05 00 00 00       	mov    $0x5,%edi
+  803483:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  80348a:	00 00 00 
+  80348d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80348f:	85 c0                	test   %eax,%eax
+  803491:	78 3d                	js     8034d0 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803493:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80349a:	00 00 00 
+  80349d:	4c 89 e6             	mov    %r12,%rsi
+  8034a0:	48 89 df             	mov    %rbx,%rdi
+  8034a3:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  8034aa:	00 00 00 
+  8034ad:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8034af:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8034b6:	00 
+  8034b7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8034bd:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8034c4:	00 
+  8034c5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8034cb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034d0:	5b                   	pop    %rbx
+  8034d1:	41 5c                	pop    %r12
+  8034d3:	5d                   	pop    %rbp
+  8034d4:	c3                   	ret
+
+00000000008034d5 <remove>:
+remove(const char *path) {
+  8034d5:	55                   	push   %rbp
+  8034d6:	48 89 e5             	mov    %rsp,%rbp
+  8034d9:	53                   	push   %rbx
+  8034da:	48 83 ec 08          	sub    $0x8,%rsp
+  8034de:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034e1:	48 b8 ec 0e 80 00 00 	movabs $0x800eec,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+  8034ed:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8034f3:	77 3a                	ja     80352f <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8034f5:	48 89 de             	mov    %rbx,%rsi
+  8034f8:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8034ff:	00 00 00 
+  803502:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  803509:	00 00 00 
+  80350c:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80350e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803513:	be 00 00 00 00       	mov    $0x0,%esi
+  803518:	bf 07 00 00 00       	mov    $0x7,%edi
+  80351d:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  803524:	00 00 00 
+  803527:	ff d0                	call   *%rax
+}
+  803529:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80352d:	c9                   	leave
+  80352e:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80352f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803534:	eb f3                	jmp    803529 <remove+0x54>
+
+0000000000803536 <sync>:
+sync(void) {
+  803536:	55                   	push   %rbp
+  803537:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80353a:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  803541:	00 00 00 
+  803544:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803546:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354b:	be 00 00 00 00       	mov    $0x0,%esi
+  803550:	bf 08 00 00 00       	mov    $0x8,%edi
+  803555:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  80355c:	00 00 00 
+  80355f:	ff d0                	call   *%rax
+}
+  803561:	5d                   	pop    %rbp
+  803562:	c3                   	ret
+
+0000000000803563 <fsync>:
+fsync(int fdnum) {
+  803563:	55                   	push   %rbp
+  803564:	48 89 e5             	mov    %rsp,%rbp
+  803567:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80356b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80356f:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  803576:	00 00 00 
+  803579:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80357b:	85 c0                	test   %eax,%eax
+  80357d:	78 4b                	js     8035ca <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80357f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803583:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  80358a:	00 00 00 
+  80358d:	8b 00                	mov    (%rax),%eax
+  80358f:	39 02                	cmp    %eax,(%rdx)
+  803591:	75 39                	jne    8035cc <fsync+0x69>
+    file_flush_buffers();
+  803593:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  80359a:	00 00 00 
+  80359d:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80359f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035a3:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035a6:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8035ad:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8035af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035b4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035b9:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8035be:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  8035c5:	00 00 00 
+  8035c8:	ff d0                	call   *%rax
+}
+  8035ca:	c9                   	leave
+  8035cb:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8035cc:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035d1:	eb f7                	jmp    8035ca <fsync+0x67>
+
+00000000008035d3 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8035d3:	55                   	push   %rbp
+  8035d4:	48 89 e5             	mov    %rsp,%rbp
+  8035d7:	53                   	push   %rbx
+  8035d8:	48 83 ec 08          	sub    $0x8,%rsp
+  8035dc:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8035df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035ee:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  8035f5:	00 00 00 
+  8035f8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035fa:	85 c0                	test   %eax,%eax
+  8035fc:	78 2d                	js     80362b <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8035fe:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803605:	00 00 00 
+  803608:	48 8b 10             	mov    (%rax),%rdx
+  80360b:	48 89 13             	mov    %rdx,(%rbx)
+  80360e:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803612:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803616:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80361a:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80361e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803622:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803626:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80362b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80362f:	c9                   	leave
+  803630:	c3                   	ret
+
+0000000000803631 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803631:	55                   	push   %rbp
+  803632:	48 89 e5             	mov    %rsp,%rbp
+  803635:	53                   	push   %rbx
+  803636:	48 83 ec 08          	sub    $0x8,%rsp
+  80363a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80363d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803642:	be 00 00 00 00       	mov    $0x0,%esi
+  803647:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80364c:	48 b8 68 28 80 00 00 	movabs $0x802868,%rax
+  803653:	00 00 00 
+  803656:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803658:	85 c0                	test   %eax,%eax
+  80365a:	78 3d                	js     803699 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80365c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803663:	00 00 00 
+  803666:	48 8b 10             	mov    (%rax),%rdx
+  803669:	48 89 13             	mov    %rdx,(%rbx)
+  80366c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803670:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803674:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803678:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80367c:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803680:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803684:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803688:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80368c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803690:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803694:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803699:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80369d:	c9                   	leave
+  80369e:	c3                   	ret
+
+000000000080369f <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80369f:	55                   	push   %rbp
+  8036a0:	48 89 e5             	mov    %rsp,%rbp
+  8036a3:	41 57                	push   %r15
+  8036a5:	41 56                	push   %r14
+  8036a7:	41 55                	push   %r13
+  8036a9:	41 54                	push   %r12
+  8036ab:	53                   	push   %rbx
+  8036ac:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8036b0:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8036b7:	00 
+  8036b8:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036bf:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036c5:	0f 85 43 01 00 00    	jne    80380e <munmap+0x16f>
+  8036cb:	49 89 ff             	mov    %rdi,%r15
+  8036ce:	4c 39 f7             	cmp    %r14,%rdi
+  8036d1:	0f 87 37 01 00 00    	ja     80380e <munmap+0x16f>
+  8036d7:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8036de:	00 00 00 
+  8036e1:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8036e7:	eb 2c                	jmp    803715 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8036e9:	4c 39 f8             	cmp    %r15,%rax
+  8036ec:	0f 83 85 00 00 00    	jae    803777 <munmap+0xd8>
+            m->mm_end = start;
+  8036f2:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8036f7:	48 83 c3 18          	add    $0x18,%rbx
+  8036fb:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803702:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803709:	00 00 00 
+  80370c:	48 39 c3             	cmp    %rax,%rbx
+  80370f:	0f 84 d0 00 00 00    	je     8037e5 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803715:	49 89 dc             	mov    %rbx,%r12
+  803718:	48 8b 03             	mov    (%rbx),%rax
+  80371b:	4c 39 f0             	cmp    %r14,%rax
+  80371e:	73 d7                	jae    8036f7 <munmap+0x58>
+  803720:	48 85 c0             	test   %rax,%rax
+  803723:	74 d2                	je     8036f7 <munmap+0x58>
+  803725:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803729:	49 39 d7             	cmp    %rdx,%r15
+  80372c:	73 c9                	jae    8036f7 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80372e:	49 39 d6             	cmp    %rdx,%r14
+  803731:	73 b6                	jae    8036e9 <munmap+0x4a>
+  803733:	49 39 c7             	cmp    %rax,%r15
+  803736:	76 b1                	jbe    8036e9 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803738:	4c 89 ef             	mov    %r13,%rdi
+  80373b:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  803742:	00 00 00 
+  803745:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803747:	48 85 c0             	test   %rax,%rax
+  80374a:	0f 84 c5 00 00 00    	je     803815 <munmap+0x176>
+            *tail = *m;
+  803750:	48 8b 13             	mov    (%rbx),%rdx
+  803753:	48 89 10             	mov    %rdx,(%rax)
+  803756:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80375a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80375e:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803762:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803766:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803769:	44 89 f2             	mov    %r14d,%edx
+  80376c:	2b 13                	sub    (%rbx),%edx
+  80376e:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803771:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803775:	eb 80                	jmp    8036f7 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803777:	49 39 d6             	cmp    %rdx,%r14
+  80377a:	73 18                	jae    803794 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80377c:	44 89 f2             	mov    %r14d,%edx
+  80377f:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803784:	29 c2                	sub    %eax,%edx
+  803786:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80378b:	4d 89 34 24          	mov    %r14,(%r12)
+  80378f:	e9 63 ff ff ff       	jmp    8036f7 <munmap+0x58>
+    m->mm_start = 0;
+  803794:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80379b:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80379c:	4c 89 e6             	mov    %r12,%rsi
+  80379f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8037a6:	00 00 00 
+  8037a9:	48 29 c6             	sub    %rax,%rsi
+  8037ac:	48 c1 fe 03          	sar    $0x3,%rsi
+  8037b0:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8037b7:	aa aa aa 
+  8037ba:	48 0f af f0          	imul   %rax,%rsi
+  8037be:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8037c2:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8037c7:	48 01 c6             	add    %rax,%rsi
+  8037ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037d4:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  8037db:	00 00 00 
+  8037de:	ff d0                	call   *%rax
+}
+  8037e0:	e9 12 ff ff ff       	jmp    8036f7 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8037e5:	4c 89 f2             	mov    %r14,%rdx
+  8037e8:	4c 29 fa             	sub    %r15,%rdx
+  8037eb:	4c 89 fe             	mov    %r15,%rsi
+  8037ee:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037f3:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  8037fa:	00 00 00 
+  8037fd:	ff d0                	call   *%rax
+}
+  8037ff:	48 83 c4 08          	add    $0x8,%rsp
+  803803:	5b                   	pop    %rbx
+  803804:	41 5c                	pop    %r12
+  803806:	41 5d                	pop    %r13
+  803808:	41 5e                	pop    %r14
+  80380a:	41 5f                	pop    %r15
+  80380c:	5d                   	pop    %rbp
+  80380d:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80380e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803813:	eb ea                	jmp    8037ff <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803815:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80381a:	eb e3                	jmp    8037ff <munmap+0x160>
+
+000000000080381c <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80381c:	55                   	push   %rbp
+  80381d:	48 89 e5             	mov    %rsp,%rbp
+  803820:	41 57                	push   %r15
+  803822:	41 56                	push   %r14
+  803824:	41 55                	push   %r13
+  803826:	41 54                	push   %r12
+  803828:	53                   	push   %rbx
+  803829:	48 83 ec 28          	sub    $0x28,%rsp
+  80382d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803831:	49 89 f5             	mov    %rsi,%r13
+  803834:	41 89 d6             	mov    %edx,%r14d
+  803837:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80383a:	41 89 cc             	mov    %ecx,%r12d
+  80383d:	44 89 c7             	mov    %r8d,%edi
+  803840:	44 89 cb             	mov    %r9d,%ebx
+  803843:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803847:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80384b:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  803852:	00 00 00 
+  803855:	ff d0                	call   *%rax
+  803857:	41 89 c7             	mov    %eax,%r15d
+  80385a:	85 c0                	test   %eax,%eax
+  80385c:	0f 88 ae 01 00 00    	js     803a10 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803862:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803866:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  80386d:	00 00 00 
+  803870:	8b 32                	mov    (%rdx),%esi
+  803872:	39 30                	cmp    %esi,(%rax)
+  803874:	0f 85 7a 02 00 00    	jne    803af4 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80387a:	8b 40 08             	mov    0x8(%rax),%eax
+  80387d:	83 e0 03             	and    $0x3,%eax
+  803880:	83 f8 01             	cmp    $0x1,%eax
+  803883:	0f 84 76 02 00 00    	je     803aff <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803889:	4d 85 ed             	test   %r13,%r13
+  80388c:	0f 84 78 02 00 00    	je     803b0a <mmap+0x2ee>
+  803892:	85 db                	test   %ebx,%ebx
+  803894:	0f 88 70 02 00 00    	js     803b0a <mmap+0x2ee>
+  80389a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8038a0:	41 89 df             	mov    %ebx,%r15d
+  8038a3:	0f 85 6c 02 00 00    	jne    803b15 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8038a9:	44 89 f0             	mov    %r14d,%eax
+  8038ac:	83 e0 fd             	and    $0xfffffffd,%eax
+  8038af:	83 f8 04             	cmp    $0x4,%eax
+  8038b2:	0f 85 68 02 00 00    	jne    803b20 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8038b8:	44 89 e1             	mov    %r12d,%ecx
+  8038bb:	83 e1 01             	and    $0x1,%ecx
+  8038be:	0f 95 c2             	setne  %dl
+  8038c1:	44 89 e0             	mov    %r12d,%eax
+  8038c4:	d1 e8                	shr    %eax
+  8038c6:	83 f0 01             	xor    $0x1,%eax
+  8038c9:	83 e0 01             	and    $0x1,%eax
+  8038cc:	38 c2                	cmp    %al,%dl
+  8038ce:	0f 85 57 02 00 00    	jne    803b2b <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8038d4:	85 c9                	test   %ecx,%ecx
+  8038d6:	74 0a                	je     8038e2 <mmap+0xc6>
+  8038d8:	41 f6 c6 02          	test   $0x2,%r14b
+  8038dc:	0f 85 54 02 00 00    	jne    803b36 <mmap+0x31a>
+    file_flush_buffers();
+  8038e2:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  8038e9:	00 00 00 
+  8038ec:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8038ee:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8038f5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8038fc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803900:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803903:	41 f6 c4 04          	test   $0x4,%r12b
+  803907:	0f 84 15 01 00 00    	je     803a22 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80390d:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803910:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803916:	0f 85 25 02 00 00    	jne    803b41 <mmap+0x325>
+  80391c:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803920:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803927:	00 00 00 
+  80392a:	48 39 c2             	cmp    %rax,%rdx
+  80392d:	0f 82 19 02 00 00    	jb     803b4c <mmap+0x330>
+  803933:	48 39 c7             	cmp    %rax,%rdi
+  803936:	0f 87 10 02 00 00    	ja     803b4c <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80393c:	4c 89 ee             	mov    %r13,%rsi
+  80393f:	48 b8 9f 36 80 00 00 	movabs $0x80369f,%rax
+  803946:	00 00 00 
+  803949:	ff d0                	call   *%rax
+  80394b:	85 c0                	test   %eax,%eax
+  80394d:	0f 88 04 02 00 00    	js     803b57 <mmap+0x33b>
+    if (!handler) {
+  803953:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80395a:	00 00 00 
+  80395d:	80 38 00             	cmpb   $0x0,(%rax)
+  803960:	75 2b                	jne    80398d <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803962:	48 bf 37 27 80 00 00 	movabs $0x802737,%rdi
+  803969:	00 00 00 
+  80396c:	48 b8 40 54 80 00 00 	movabs $0x805440,%rax
+  803973:	00 00 00 
+  803976:	ff d0                	call   *%rax
+  803978:	85 c0                	test   %eax,%eax
+  80397a:	0f 88 ea 01 00 00    	js     803b6a <mmap+0x34e>
+        handler = 1;
+  803980:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803987:	00 00 00 
+  80398a:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80398d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803991:	48 b8 d6 27 80 00 00 	movabs $0x8027d6,%rax
+  803998:	00 00 00 
+  80399b:	ff d0                	call   *%rax
+  80399d:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8039a0:	48 85 c0             	test   %rax,%rax
+  8039a3:	0f 84 c9 01 00 00    	je     803b72 <mmap+0x356>
+    m->mm_start = va;
+  8039a9:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8039ac:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8039b0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8039b4:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8039b7:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8039bb:	44 89 e0             	mov    %r12d,%eax
+  8039be:	c1 e0 06             	shl    $0x6,%eax
+  8039c1:	25 80 00 00 00       	and    $0x80,%eax
+  8039c6:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8039c9:	09 f0                	or     %esi,%eax
+  8039cb:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8039cf:	41 f6 c4 08          	test   $0x8,%r12b
+  8039d3:	74 31                	je     803a06 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8039d5:	48 39 d3             	cmp    %rdx,%rbx
+  8039d8:	73 2c                	jae    803a06 <mmap+0x1ea>
+  8039da:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8039df:	48 89 de             	mov    %rbx,%rsi
+  8039e2:	4c 89 f7             	mov    %r14,%rdi
+  8039e5:	48 b8 26 26 80 00 00 	movabs $0x802626,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+  8039f1:	49 89 c4             	mov    %rax,%r12
+  8039f4:	48 85 c0             	test   %rax,%rax
+  8039f7:	0f 8e d7 00 00 00    	jle    803ad4 <mmap+0x2b8>
+            va += n;
+  8039fd:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803a00:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803a04:	72 d4                	jb     8039da <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803a06:	49 8b 06             	mov    (%r14),%rax
+  803a09:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803a0d:	48 89 06             	mov    %rax,(%rsi)
+}
+  803a10:	44 89 f8             	mov    %r15d,%eax
+  803a13:	48 83 c4 28          	add    $0x28,%rsp
+  803a17:	5b                   	pop    %rbx
+  803a18:	41 5c                	pop    %r12
+  803a1a:	41 5d                	pop    %r13
+  803a1c:	41 5e                	pop    %r14
+  803a1e:	41 5f                	pop    %r15
+  803a20:	5d                   	pop    %rbp
+  803a21:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a22:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803a29:	00 00 00 
+  803a2c:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803a2f:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803a36:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a39:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a3e:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803a45:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a48:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803a4f:	00 00 00 
+  803a52:	48 39 d7             	cmp    %rdx,%rdi
+  803a55:	73 1c                	jae    803a73 <mmap+0x257>
+        return -E_NO_MEM;
+  803a57:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a5d:	eb b1                	jmp    803a10 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a5f:	48 83 c0 01          	add    $0x1,%rax
+  803a63:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a67:	77 3f                	ja     803aa8 <mmap+0x28c>
+  803a69:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803a6e:	48 39 d7             	cmp    %rdx,%rdi
+  803a71:	72 2a                	jb     803a9d <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a73:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a77:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a7b:	48 39 d1             	cmp    %rdx,%rcx
+  803a7e:	73 df                	jae    803a5f <mmap+0x243>
+  803a80:	48 85 c9             	test   %rcx,%rcx
+  803a83:	74 da                	je     803a5f <mmap+0x243>
+  803a85:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a89:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a8e:	48 39 d3             	cmp    %rdx,%rbx
+  803a91:	73 cc                	jae    803a5f <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803a93:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a96:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a9b:	eb cc                	jmp    803a69 <mmap+0x24d>
+        return -E_NO_MEM;
+  803a9d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803aa3:	e9 68 ff ff ff       	jmp    803a10 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803aa8:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803aad:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803ab4:	00 00 00 
+  803ab7:	48 39 c2             	cmp    %rax,%rdx
+  803aba:	0f 82 9f 00 00 00    	jb     803b5f <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803ac0:	48 85 db             	test   %rbx,%rbx
+  803ac3:	0f 85 8a fe ff ff    	jne    803953 <mmap+0x137>
+        return -E_NO_MEM;
+  803ac9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803acf:	e9 3c ff ff ff       	jmp    803a10 <mmap+0x1f4>
+        if (n < 0) {
+  803ad4:	0f 89 2c ff ff ff    	jns    803a06 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803ada:	49 8b 3e             	mov    (%r14),%rdi
+  803add:	4c 89 ee             	mov    %r13,%rsi
+  803ae0:	48 b8 9f 36 80 00 00 	movabs $0x80369f,%rax
+  803ae7:	00 00 00 
+  803aea:	ff d0                	call   *%rax
+            return n;
+  803aec:	45 89 e7             	mov    %r12d,%r15d
+  803aef:	e9 1c ff ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803af4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803afa:	e9 11 ff ff ff       	jmp    803a10 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803aff:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b05:	e9 06 ff ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803b0a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b10:	e9 fb fe ff ff       	jmp    803a10 <mmap+0x1f4>
+  803b15:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b1b:	e9 f0 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803b20:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b26:	e9 e5 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803b2b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b31:	e9 da fe ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803b36:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803b3c:	e9 cf fe ff ff       	jmp    803a10 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b41:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b47:	e9 c4 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+  803b4c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b52:	e9 b9 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803b57:	41 89 c7             	mov    %eax,%r15d
+  803b5a:	e9 b1 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803b5f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b65:	e9 a6 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803b6a:	41 89 c7             	mov    %eax,%r15d
+  803b6d:	e9 9e fe ff ff       	jmp    803a10 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b72:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b78:	e9 93 fe ff ff       	jmp    803a10 <mmap+0x1f4>
+
+0000000000803b7d <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803b7d:	55                   	push   %rbp
+  803b7e:	48 89 e5             	mov    %rsp,%rbp
+  803b81:	41 55                	push   %r13
+  803b83:	41 54                	push   %r12
+  803b85:	53                   	push   %rbx
+  803b86:	48 83 ec 08          	sub    $0x8,%rsp
+  803b8a:	48 89 fb             	mov    %rdi,%rbx
+  803b8d:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803b90:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803b93:	48 b8 f9 4b 80 00 00 	movabs $0x804bf9,%rax
+  803b9a:	00 00 00 
+  803b9d:	ff d0                	call   *%rax
+  803b9f:	41 89 c1             	mov    %eax,%r9d
+  803ba2:	4d 89 e0             	mov    %r12,%r8
+  803ba5:	49 29 d8             	sub    %rbx,%r8
+  803ba8:	48 89 d9             	mov    %rbx,%rcx
+  803bab:	44 89 ea             	mov    %r13d,%edx
+  803bae:	48 89 de             	mov    %rbx,%rsi
+  803bb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bb6:	48 b8 6e 4f 80 00 00 	movabs $0x804f6e,%rax
+  803bbd:	00 00 00 
+  803bc0:	ff d0                	call   *%rax
+    return 0;
+}
+  803bc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc7:	48 83 c4 08          	add    $0x8,%rsp
+  803bcb:	5b                   	pop    %rbx
+  803bcc:	41 5c                	pop    %r12
+  803bce:	41 5d                	pop    %r13
+  803bd0:	5d                   	pop    %rbp
+  803bd1:	c3                   	ret
+
+0000000000803bd2 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803bd2:	55                   	push   %rbp
+  803bd3:	48 89 e5             	mov    %rsp,%rbp
+  803bd6:	41 57                	push   %r15
+  803bd8:	41 56                	push   %r14
+  803bda:	41 55                	push   %r13
+  803bdc:	41 54                	push   %r12
+  803bde:	53                   	push   %rbx
+  803bdf:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803be6:	48 89 fb             	mov    %rdi,%rbx
+  803be9:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803bec:	48 b8 97 33 80 00 00 	movabs $0x803397,%rax
+  803bf3:	00 00 00 
+  803bf6:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  803bf8:	be 00 00 00 00       	mov    $0x0,%esi
+  803bfd:	48 89 df             	mov    %rbx,%rdi
+  803c00:	48 b8 d6 32 80 00 00 	movabs $0x8032d6,%rax
+  803c07:	00 00 00 
+  803c0a:	ff d0                	call   *%rax
+  803c0c:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803c12:	85 c0                	test   %eax,%eax
+  803c14:	0f 88 06 04 00 00    	js     804020 <spawn+0x44e>
+  803c1a:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803c1c:	ba 00 02 00 00       	mov    $0x200,%edx
+  803c21:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803c28:	48 b8 b2 1e 80 00 00 	movabs $0x801eb2,%rax
+  803c2f:	00 00 00 
+  803c32:	ff d0                	call   *%rax
+  803c34:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803c36:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803c3b:	0f 85 93 02 00 00    	jne    803ed4 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803c41:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803c48:	ff ff 00 
+  803c4b:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803c52:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803c59:	01 01 00 
+  803c5c:	48 39 d0             	cmp    %rdx,%rax
+  803c5f:	0f 85 ab 02 00 00    	jne    803f10 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803c65:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803c6c:	00 3e 00 
+  803c6f:	0f 85 9b 02 00 00    	jne    803f10 <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  803c75:	b8 08 00 00 00       	mov    $0x8,%eax
+  803c7a:	0f 05                	syscall
+  803c7c:	41 89 c6             	mov    %eax,%r14d
+  803c7f:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803c85:	85 c0                	test   %eax,%eax
+  803c87:	0f 88 75 03 00 00    	js     804002 <spawn+0x430>
+    envid_t child = res;
+  803c8d:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803c93:	89 c2                	mov    %eax,%edx
+  803c95:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803c9b:	48 89 d0             	mov    %rdx,%rax
+  803c9e:	48 c1 e0 04          	shl    $0x4,%rax
+  803ca2:	48 29 d0             	sub    %rdx,%rax
+  803ca5:	48 c1 e0 05          	shl    $0x5,%rax
+  803ca9:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803cb0:	00 00 00 
+  803cb3:	48 01 c6             	add    %rax,%rsi
+  803cb6:	48 8b 06             	mov    (%rsi),%rax
+  803cb9:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803cc0:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803cc7:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803cce:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803cd5:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803cdc:	48 29 ce             	sub    %rcx,%rsi
+  803cdf:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803ce5:	c1 e9 03             	shr    $0x3,%ecx
+  803ce8:	89 c9                	mov    %ecx,%ecx
+  803cea:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803ced:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803cf4:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803cfb:	49 8b 3c 24          	mov    (%r12),%rdi
+  803cff:	48 85 ff             	test   %rdi,%rdi
+  803d02:	0f 84 d6 05 00 00    	je     8042de <spawn+0x70c>
+  803d08:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803d0e:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803d14:	48 bb ec 0e 80 00 00 	movabs $0x800eec,%rbx
+  803d1b:	00 00 00 
+  803d1e:	ff d3                	call   *%rbx
+  803d20:	4c 01 f8             	add    %r15,%rax
+  803d23:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803d27:	4c 89 ea             	mov    %r13,%rdx
+  803d2a:	49 83 c5 01          	add    $0x1,%r13
+  803d2e:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803d33:	48 85 ff             	test   %rdi,%rdi
+  803d36:	75 e6                	jne    803d1e <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803d38:	49 89 d5             	mov    %rdx,%r13
+  803d3b:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803d42:	48 f7 d0             	not    %rax
+  803d45:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803d4c:	49 89 df             	mov    %rbx,%r15
+  803d4f:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803d53:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803d5a:	89 d0                	mov    %edx,%eax
+  803d5c:	83 c0 01             	add    $0x1,%eax
+  803d5f:	48 98                	cltq
+  803d61:	48 c1 e0 03          	shl    $0x3,%rax
+  803d65:	49 29 c7             	sub    %rax,%r15
+  803d68:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803d6f:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803d73:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803d79:	0f 86 4f 05 00 00    	jbe    8042ce <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803d7f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803d84:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803d89:	be 00 00 40 00       	mov    $0x400000,%esi
+  803d8e:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  803d95:	00 00 00 
+  803d98:	ff d0                	call   *%rax
+  803d9a:	85 c0                	test   %eax,%eax
+  803d9c:	0f 88 31 05 00 00    	js     8042d3 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  803da2:	4c 89 e8             	mov    %r13,%rax
+  803da5:	45 85 ed             	test   %r13d,%r13d
+  803da8:	7e 65                	jle    803e0f <spawn+0x23d>
+  803daa:	4d 89 fd             	mov    %r15,%r13
+  803dad:	48 98                	cltq
+  803daf:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803db3:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803dba:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803dbd:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803dc4:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803dc7:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803dce:	ff 
+  803dcf:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803dd3:	49 8b 34 24          	mov    (%r12),%rsi
+  803dd7:	48 89 df             	mov    %rbx,%rdi
+  803dda:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803de6:	49 8b 3c 24          	mov    (%r12),%rdi
+  803dea:	48 b8 ec 0e 80 00 00 	movabs $0x800eec,%rax
+  803df1:	00 00 00 
+  803df4:	ff d0                	call   *%rax
+  803df6:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803dfb:	49 83 c5 08          	add    $0x8,%r13
+  803dff:	49 83 c4 08          	add    $0x8,%r12
+  803e03:	4d 39 ee             	cmp    %r13,%r14
+  803e06:	75 bf                	jne    803dc7 <spawn+0x1f5>
+  803e08:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803e0f:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803e16:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803e1d:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803e1e:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803e25:	0f 85 2c 01 00 00    	jne    803f57 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803e2b:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803e32:	00 00 00 
+  803e35:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803e3c:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803e43:	ff 
+  803e44:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803e48:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803e4f:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803e53:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803e5a:	00 00 00 
+  803e5d:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803e64:	ff 
+  803e65:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803e6c:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803e72:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803e78:	44 89 f2             	mov    %r14d,%edx
+  803e7b:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e80:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e85:	48 b8 6e 4f 80 00 00 	movabs $0x804f6e,%rax
+  803e8c:	00 00 00 
+  803e8f:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803e91:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803e96:	be 00 00 40 00       	mov    $0x400000,%esi
+  803e9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea0:	48 b8 a7 4f 80 00 00 	movabs $0x804fa7,%rax
+  803ea7:	00 00 00 
+  803eaa:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803eac:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803eb3:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803eba:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803ebb:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803ec2:	00 
+  803ec3:	0f 84 5d 03 00 00    	je     804226 <spawn+0x654>
+  803ec9:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803ecf:	e9 1b 02 00 00       	jmp    8040ef <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803ed4:	48 bf 60 5e 80 00 00 	movabs $0x805e60,%rdi
+  803edb:	00 00 00 
+  803ede:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ee3:	48 ba 05 06 80 00 00 	movabs $0x800605,%rdx
+  803eea:	00 00 00 
+  803eed:	ff d2                	call   *%rdx
+        close(fd);
+  803eef:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803ef5:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  803efc:	00 00 00 
+  803eff:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803f01:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803f08:	ff ff ff 
+  803f0b:	e9 10 01 00 00       	jmp    804020 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  803f10:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  803f15:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  803f1b:	48 bf 17 5f 80 00 00 	movabs $0x805f17,%rdi
+  803f22:	00 00 00 
+  803f25:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f2a:	48 b9 05 06 80 00 00 	movabs $0x800605,%rcx
+  803f31:	00 00 00 
+  803f34:	ff d1                	call   *%rcx
+        close(fd);
+  803f36:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  803f3c:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  803f43:	00 00 00 
+  803f46:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  803f48:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  803f4f:	ff ff ff 
+  803f52:	e9 c9 00 00 00       	jmp    804020 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803f57:	48 b9 90 5e 80 00 00 	movabs $0x805e90,%rcx
+  803f5e:	00 00 00 
+  803f61:	48 ba 31 5f 80 00 00 	movabs $0x805f31,%rdx
+  803f68:	00 00 00 
+  803f6b:	be f9 00 00 00       	mov    $0xf9,%esi
+  803f70:	48 bf 46 5f 80 00 00 	movabs $0x805f46,%rdi
+  803f77:	00 00 00 
+  803f7a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f7f:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  803f86:	00 00 00 
+  803f89:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  803f8c:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  803f90:	48 29 f2             	sub    %rsi,%rdx
+  803f93:	89 d9                	mov    %ebx,%ecx
+  803f95:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  803f9b:	48 b8 38 4f 80 00 00 	movabs $0x804f38,%rax
+  803fa2:	00 00 00 
+  803fa5:	ff d0                	call   *%rax
+  803fa7:	e9 f0 01 00 00       	jmp    80419c <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  803fac:	89 c6                	mov    %eax,%esi
+  803fae:	48 bf c0 5e 80 00 00 	movabs $0x805ec0,%rdi
+  803fb5:	00 00 00 
+  803fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803fbd:	48 ba 05 06 80 00 00 	movabs $0x800605,%rdx
+  803fc4:	00 00 00 
+  803fc7:	ff d2                	call   *%rdx
+    scring_discard();
+  803fc9:	48 b8 18 4f 80 00 00 	movabs $0x804f18,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803fd5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803fda:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fe4:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  803feb:	00 00 00 
+  803fee:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  803ff0:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  803ff6:	48 b8 99 13 80 00 00 	movabs $0x801399,%rax
+  803ffd:	00 00 00 
+  804000:	ff d0                	call   *%rax
+    close(fd);
+  804002:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804008:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  80400f:	00 00 00 
+  804012:	ff d0                	call   *%rax
+    return res;
+  804014:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  80401a:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  804020:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  804026:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  80402d:	5b                   	pop    %rbx
+  80402e:	41 5c                	pop    %r12
+  804030:	41 5d                	pop    %r13
+  804032:	41 5e                	pop    %r14
+  804034:	41 5f                	pop    %r15
+  804036:	5d                   	pop    %rbp
+  804037:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  804038:	89 c6                	mov    %eax,%esi
+  80403a:	48 bf 52 5f 80 00 00 	movabs $0x805f52,%rdi
+  804041:	00 00 00 
+  804044:	b8 00 00 00 00       	mov    $0x0,%eax
+  804049:	48 ba 05 06 80 00 00 	movabs $0x800605,%rdx
+  804050:	00 00 00 
+  804053:	ff d2                	call   *%rdx
+        return res;
+  804055:	e9 6f ff ff ff       	jmp    803fc9 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  80405a:	4c 89 e2             	mov    %r12,%rdx
+  80405d:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804064:	48 29 c2             	sub    %rax,%rdx
+  804067:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  80406e:	be 00 00 00 00       	mov    $0x0,%esi
+  804073:	48 b8 76 10 80 00 00 	movabs $0x801076,%rax
+  80407a:	00 00 00 
+  80407d:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  80407f:	80 cb 80             	or     $0x80,%bl
+  804082:	41 89 d9             	mov    %ebx,%r9d
+  804085:	4d 89 e0             	mov    %r12,%r8
+  804088:	4c 89 f1             	mov    %r14,%rcx
+  80408b:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  804091:	be 00 00 40 00       	mov    $0x400000,%esi
+  804096:	bf 00 00 00 00       	mov    $0x0,%edi
+  80409b:	48 b8 6e 4f 80 00 00 	movabs $0x804f6e,%rax
+  8040a2:	00 00 00 
+  8040a5:	ff d0                	call   *%rax
+    res = scring_submit();
+  8040a7:	48 b8 cc 4e 80 00 00 	movabs $0x804ecc,%rax
+  8040ae:	00 00 00 
+  8040b1:	ff d0                	call   *%rax
+  8040b3:	89 c3                	mov    %eax,%ebx
+  8040b5:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  8040bb:	4c 89 e6             	mov    %r12,%rsi
+  8040be:	bf 00 00 40 00       	mov    $0x400000,%edi
+  8040c3:	48 b8 9f 36 80 00 00 	movabs $0x80369f,%rax
+  8040ca:	00 00 00 
+  8040cd:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8040cf:	85 db                	test   %ebx,%ebx
+  8040d1:	0f 88 f2 fe ff ff    	js     803fc9 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8040d7:	49 83 c7 01          	add    $0x1,%r15
+  8040db:	49 83 c5 38          	add    $0x38,%r13
+  8040df:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  8040e6:	49 39 c7             	cmp    %rax,%r15
+  8040e9:	0f 83 37 01 00 00    	jae    804226 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  8040ef:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  8040f4:	75 e1                	jne    8040d7 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  8040f6:	41 8b 45 04          	mov    0x4(%r13),%eax
+  8040fa:	89 c3                	mov    %eax,%ebx
+  8040fc:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  8040ff:	89 da                	mov    %ebx,%edx
+  804101:	83 ca 04             	or     $0x4,%edx
+  804104:	a8 04                	test   $0x4,%al
+  804106:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  804109:	89 da                	mov    %ebx,%edx
+  80410b:	83 ca 01             	or     $0x1,%edx
+  80410e:	a8 01                	test   $0x1,%al
+  804110:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804113:	49 8b 45 08          	mov    0x8(%r13),%rax
+  804117:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  80411d:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  804121:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  804128:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  80412c:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804133:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  804137:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  80413d:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  804143:	44 89 f2             	mov    %r14d,%edx
+  804146:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  80414c:	74 22                	je     804170 <spawn+0x59e>
+        va -= res;
+  80414e:	48 63 ca             	movslq %edx,%rcx
+  804151:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  804154:	48 01 cf             	add    %rcx,%rdi
+  804157:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  80415e:	48 01 ce             	add    %rcx,%rsi
+  804161:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  804168:	29 d0                	sub    %edx,%eax
+  80416a:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  804170:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804177:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  80417e:	00 
+  80417f:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804186:	49 89 f4             	mov    %rsi,%r12
+  804189:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  80418c:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804193:	49 39 c4             	cmp    %rax,%r12
+  804196:	0f 82 f0 fd ff ff    	jb     803f8c <spawn+0x3ba>
+    res = scring_submit();
+  80419c:	48 b8 cc 4e 80 00 00 	movabs $0x804ecc,%rax
+  8041a3:	00 00 00 
+  8041a6:	ff d0                	call   *%rax
+  8041a8:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  8041ae:	85 c0                	test   %eax,%eax
+  8041b0:	0f 88 f6 fd ff ff    	js     803fac <spawn+0x3da>
+    if (!filesz) return 0;
+  8041b6:	4d 85 e4             	test   %r12,%r12
+  8041b9:	0f 84 18 ff ff ff    	je     8040d7 <spawn+0x505>
+    void *addr = UTEMP;
+  8041bf:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  8041c6:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  8041ca:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  8041d1:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  8041d8:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8041dd:	ba 06 00 00 00       	mov    $0x6,%edx
+  8041e2:	4c 89 e6             	mov    %r12,%rsi
+  8041e5:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  8041ec:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  8041f3:	00 00 00 
+  8041f6:	ff d0                	call   *%rax
+  8041f8:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  8041fe:	85 c0                	test   %eax,%eax
+  804200:	0f 88 32 fe ff ff    	js     804038 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  804206:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  80420d:	49 39 c4             	cmp    %rax,%r12
+  804210:	49 0f 46 c4          	cmovbe %r12,%rax
+  804214:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  80421b:	0f 83 5e fe ff ff    	jae    80407f <spawn+0x4ad>
+  804221:	e9 34 fe ff ff       	jmp    80405a <spawn+0x488>
+    close(fd);
+  804226:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  80422c:	48 b8 76 1c 80 00 00 	movabs $0x801c76,%rax
+  804233:	00 00 00 
+  804236:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  804238:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  80423f:	48 bf 7d 3b 80 00 00 	movabs $0x803b7d,%rdi
+  804246:	00 00 00 
+  804249:	48 b8 6d 4c 80 00 00 	movabs $0x804c6d,%rax
+  804250:	00 00 00 
+  804253:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  804255:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80425c:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804262:	48 b8 18 50 80 00 00 	movabs $0x805018,%rax
+  804269:	00 00 00 
+  80426c:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  80426e:	be 02 00 00 00       	mov    $0x2,%esi
+  804273:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804279:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  804280:	00 00 00 
+  804283:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  804285:	48 b8 cc 4e 80 00 00 	movabs $0x804ecc,%rax
+  80428c:	00 00 00 
+  80428f:	ff d0                	call   *%rax
+  804291:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804297:	85 c0                	test   %eax,%eax
+  804299:	78 11                	js     8042ac <spawn+0x6da>
+    return child;
+  80429b:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8042a1:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  8042a7:	e9 74 fd ff ff       	jmp    804020 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  8042ac:	89 c6                	mov    %eax,%esi
+  8042ae:	48 bf f0 5e 80 00 00 	movabs $0x805ef0,%rdi
+  8042b5:	00 00 00 
+  8042b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042bd:	48 ba 05 06 80 00 00 	movabs $0x800605,%rdx
+  8042c4:	00 00 00 
+  8042c7:	ff d2                	call   *%rdx
+        goto error;
+  8042c9:	e9 fb fc ff ff       	jmp    803fc9 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8042ce:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8042d3:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8042d9:	e9 eb fc ff ff       	jmp    803fc9 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  8042de:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8042e3:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8042e8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8042ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042f2:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  8042f9:	00 00 00 
+  8042fc:	ff d0                	call   *%rax
+  8042fe:	85 c0                	test   %eax,%eax
+  804300:	78 d1                	js     8042d3 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804302:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804309:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  80430d:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  804314:	f8 ff 40 00 
+  804318:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  80431f:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804323:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  804328:	e9 e2 fa ff ff       	jmp    803e0f <spawn+0x23d>
+
+000000000080432d <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  80432d:	55                   	push   %rbp
+  80432e:	48 89 e5             	mov    %rsp,%rbp
+  804331:	48 83 ec 50          	sub    $0x50,%rsp
+  804335:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804339:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80433d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804341:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  804345:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80434c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804350:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804354:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804358:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80435c:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804361:	eb 15                	jmp    804378 <spawnl+0x4b>
+  804363:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  804367:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80436b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80436f:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  804373:	74 1c                	je     804391 <spawnl+0x64>
+  804375:	83 c1 01             	add    $0x1,%ecx
+  804378:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80437b:	83 f8 2f             	cmp    $0x2f,%eax
+  80437e:	77 e3                	ja     804363 <spawnl+0x36>
+  804380:	89 c2                	mov    %eax,%edx
+  804382:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  804386:	4c 01 d2             	add    %r10,%rdx
+  804389:	83 c0 08             	add    $0x8,%eax
+  80438c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80438f:	eb de                	jmp    80436f <spawnl+0x42>
+    const char *argv[argc + 2];
+  804391:	8d 41 02             	lea    0x2(%rcx),%eax
+  804394:	48 98                	cltq
+  804396:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80439d:	00 
+  80439e:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8043a2:	48 29 c4             	sub    %rax,%rsp
+  8043a5:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8043aa:	4c 89 c0             	mov    %r8,%rax
+  8043ad:	48 c1 e8 03          	shr    $0x3,%rax
+  8043b1:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8043b5:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8043bc:	00 
+    argv[argc + 1] = NULL;
+  8043bd:	8d 41 01             	lea    0x1(%rcx),%eax
+  8043c0:	48 98                	cltq
+  8043c2:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8043c9:	00 
+    va_start(vl, arg0);
+  8043ca:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8043d1:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8043d9:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8043dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8043e1:	85 c9                	test   %ecx,%ecx
+  8043e3:	74 41                	je     804426 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8043e5:	49 89 c1             	mov    %rax,%r9
+  8043e8:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8043ec:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8043ef:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8043f4:	eb 1b                	jmp    804411 <spawnl+0xe4>
+  8043f6:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8043fa:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8043fe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804402:	48 8b 11             	mov    (%rcx),%rdx
+  804405:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  804408:	48 83 c0 08          	add    $0x8,%rax
+  80440c:	48 39 f0             	cmp    %rsi,%rax
+  80440f:	74 15                	je     804426 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804411:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  804414:	83 fa 2f             	cmp    $0x2f,%edx
+  804417:	77 dd                	ja     8043f6 <spawnl+0xc9>
+  804419:	89 d1                	mov    %edx,%ecx
+  80441b:	4c 01 c9             	add    %r9,%rcx
+  80441e:	83 c2 08             	add    $0x8,%edx
+  804421:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  804424:	eb dc                	jmp    804402 <spawnl+0xd5>
+    return spawn(prog, argv);
+  804426:	4c 89 c6             	mov    %r8,%rsi
+  804429:	48 b8 d2 3b 80 00 00 	movabs $0x803bd2,%rax
+  804430:	00 00 00 
+  804433:	ff d0                	call   *%rax
+}
+  804435:	c9                   	leave
+  804436:	c3                   	ret
+
+0000000000804437 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  804437:	55                   	push   %rbp
+  804438:	48 89 e5             	mov    %rsp,%rbp
+  80443b:	41 54                	push   %r12
+  80443d:	53                   	push   %rbx
+  80443e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804441:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  804448:	00 00 00 
+  80444b:	ff d0                	call   *%rax
+  80444d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804450:	48 be 6f 5f 80 00 00 	movabs $0x805f6f,%rsi
+  804457:	00 00 00 
+  80445a:	48 89 df             	mov    %rbx,%rdi
+  80445d:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  804464:	00 00 00 
+  804467:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804469:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80446e:	41 2b 04 24          	sub    (%r12),%eax
+  804472:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  804478:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80447f:	00 00 00 
+    stat->st_dev = &devpipe;
+  804482:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  804489:	00 00 00 
+  80448c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  804493:	b8 00 00 00 00       	mov    $0x0,%eax
+  804498:	5b                   	pop    %rbx
+  804499:	41 5c                	pop    %r12
+  80449b:	5d                   	pop    %rbp
+  80449c:	c3                   	ret
+
+000000000080449d <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80449d:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8044a0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8044a6:	8b 17                	mov    (%rdi),%edx
+  8044a8:	85 d2                	test   %edx,%edx
+  8044aa:	75 01                	jne    8044ad <pipe_wakeup+0x10>
+  8044ac:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8044ad:	55                   	push   %rbp
+  8044ae:	48 89 e5             	mov    %rsp,%rbp
+  8044b1:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8044b4:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8044ba:	be 00 04 00 00       	mov    $0x400,%esi
+  8044bf:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  8044c6:	00 00 00 
+  8044c9:	ff d0                	call   *%rax
+}
+  8044cb:	5d                   	pop    %rbp
+  8044cc:	c3                   	ret
+
+00000000008044cd <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8044cd:	55                   	push   %rbp
+  8044ce:	48 89 e5             	mov    %rsp,%rbp
+  8044d1:	41 55                	push   %r13
+  8044d3:	41 54                	push   %r12
+  8044d5:	53                   	push   %rbx
+  8044d6:	48 83 ec 08          	sub    $0x8,%rsp
+  8044da:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8044dd:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8044e4:	00 00 00 
+  8044e7:	ff d0                	call   *%rax
+  8044e9:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8044ec:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8044f1:	4c 89 e6             	mov    %r12,%rsi
+  8044f4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044f9:	49 bc 2f 15 80 00 00 	movabs $0x80152f,%r12
+  804500:	00 00 00 
+  804503:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804506:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  80450a:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  80450e:	49 bd 9d 44 80 00 00 	movabs $0x80449d,%r13
+  804515:	00 00 00 
+  804518:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80451b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80451f:	48 89 de             	mov    %rbx,%rsi
+  804522:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  804525:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80452a:	48 89 de             	mov    %rbx,%rsi
+  80452d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804532:	41 ff d4             	call   *%r12
+  804535:	48 83 c4 08          	add    $0x8,%rsp
+  804539:	5b                   	pop    %rbx
+  80453a:	41 5c                	pop    %r12
+  80453c:	41 5d                	pop    %r13
+  80453e:	5d                   	pop    %rbp
+  80453f:	c3                   	ret
+
+0000000000804540 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804540:	55                   	push   %rbp
+  804541:	48 89 e5             	mov    %rsp,%rbp
+  804544:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  804547:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80454c:	be 00 10 00 00       	mov    $0x1000,%esi
+  804551:	48 b8 72 14 80 00 00 	movabs $0x801472,%rax
+  804558:	00 00 00 
+  80455b:	ff d0                	call   *%rax
+  80455d:	85 c0                	test   %eax,%eax
+  80455f:	0f 94 c0             	sete   %al
+  804562:	0f b6 c0             	movzbl %al,%eax
+}
+  804565:	5d                   	pop    %rbp
+  804566:	c3                   	ret
+
+0000000000804567 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804567:	55                   	push   %rbp
+  804568:	48 89 e5             	mov    %rsp,%rbp
+  80456b:	41 57                	push   %r15
+  80456d:	41 56                	push   %r14
+  80456f:	41 55                	push   %r13
+  804571:	41 54                	push   %r12
+  804573:	53                   	push   %rbx
+  804574:	48 83 ec 38          	sub    $0x38,%rsp
+  804578:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80457c:	49 89 f4             	mov    %rsi,%r12
+  80457f:	49 89 d7             	mov    %rdx,%r15
+  804582:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804586:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80458d:	00 00 00 
+  804590:	ff d0                	call   *%rax
+  804592:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804595:	4d 85 ff             	test   %r15,%r15
+  804598:	0f 84 f1 00 00 00    	je     80468f <devpipe_write+0x128>
+  80459e:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8045a2:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8045a6:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8045aa:	49 bd 40 45 80 00 00 	movabs $0x804540,%r13
+  8045b1:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8045b4:	49 bf 9d 44 80 00 00 	movabs $0x80449d,%r15
+  8045bb:	00 00 00 
+  8045be:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8045c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8045c6:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8045ca:	8b 73 04             	mov    0x4(%rbx),%esi
+  8045cd:	48 63 ce             	movslq %esi,%rcx
+  8045d0:	48 63 03             	movslq (%rbx),%rax
+  8045d3:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  8045d9:	48 39 c1             	cmp    %rax,%rcx
+  8045dc:	72 64                	jb     804642 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  8045de:	48 89 de             	mov    %rbx,%rsi
+  8045e1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8045e5:	41 ff d5             	call   *%r13
+  8045e8:	85 c0                	test   %eax,%eax
+  8045ea:	0f 85 b9 00 00 00    	jne    8046a9 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8045f0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8045f4:	4c 89 f7             	mov    %r14,%rdi
+  8045f7:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8045fa:	8b 43 04             	mov    0x4(%rbx),%eax
+  8045fd:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  804604:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80460b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804611:	8b 03                	mov    (%rbx),%eax
+  804613:	41 39 c4             	cmp    %eax,%r12d
+  804616:	75 b2                	jne    8045ca <devpipe_write+0x63>
+  804618:	48 89 de             	mov    %rbx,%rsi
+  80461b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80461f:	41 ff d5             	call   *%r13
+  804622:	85 c0                	test   %eax,%eax
+  804624:	75 a0                	jne    8045c6 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804626:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80462b:	44 89 e6             	mov    %r12d,%esi
+  80462e:	48 89 df             	mov    %rbx,%rdi
+  804631:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  804638:	00 00 00 
+  80463b:	ff d0                	call   *%rax
+  80463d:	e9 7c ff ff ff       	jmp    8045be <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804642:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  804646:	41 0f b6 38          	movzbl (%r8),%edi
+  80464a:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804651:	80 80 80 
+  804654:	48 89 c8             	mov    %rcx,%rax
+  804657:	48 f7 e2             	mul    %rdx
+  80465a:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80465e:	48 89 d0             	mov    %rdx,%rax
+  804661:	48 c1 e0 08          	shl    $0x8,%rax
+  804665:	48 29 d0             	sub    %rdx,%rax
+  804668:	48 c1 e0 04          	shl    $0x4,%rax
+  80466c:	48 29 c1             	sub    %rax,%rcx
+  80466f:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  804674:	83 c6 01             	add    $0x1,%esi
+  804677:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80467a:	49 83 c0 01          	add    $0x1,%r8
+  80467e:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  804682:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  804686:	49 39 c0             	cmp    %rax,%r8
+  804689:	0f 85 2f ff ff ff    	jne    8045be <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80468f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804693:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804697:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  80469e:	00 00 00 
+  8046a1:	ff d0                	call   *%rax
+    return n;
+  8046a3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8046a7:	eb 05                	jmp    8046ae <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8046a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8046ae:	48 83 c4 38          	add    $0x38,%rsp
+  8046b2:	5b                   	pop    %rbx
+  8046b3:	41 5c                	pop    %r12
+  8046b5:	41 5d                	pop    %r13
+  8046b7:	41 5e                	pop    %r14
+  8046b9:	41 5f                	pop    %r15
+  8046bb:	5d                   	pop    %rbp
+  8046bc:	c3                   	ret
+
+00000000008046bd <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8046bd:	55                   	push   %rbp
+  8046be:	48 89 e5             	mov    %rsp,%rbp
+  8046c1:	41 57                	push   %r15
+  8046c3:	41 56                	push   %r14
+  8046c5:	41 55                	push   %r13
+  8046c7:	41 54                	push   %r12
+  8046c9:	53                   	push   %rbx
+  8046ca:	48 83 ec 28          	sub    $0x28,%rsp
+  8046ce:	49 89 fd             	mov    %rdi,%r13
+  8046d1:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8046d5:	49 89 d4             	mov    %rdx,%r12
+  8046d8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046dc:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8046e3:	00 00 00 
+  8046e6:	ff d0                	call   *%rax
+  8046e8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046eb:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8046f1:	49 bf 40 45 80 00 00 	movabs $0x804540,%r15
+  8046f8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8046fb:	4d 85 e4             	test   %r12,%r12
+  8046fe:	0f 84 d5 00 00 00    	je     8047d9 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804704:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804708:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  80470c:	8b 03                	mov    (%rbx),%eax
+  80470e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804711:	75 7a                	jne    80478d <devpipe_read+0xd0>
+            if (i > 0) {
+  804713:	4d 85 f6             	test   %r14,%r14
+  804716:	75 50                	jne    804768 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804718:	48 89 de             	mov    %rbx,%rsi
+  80471b:	4c 89 ef             	mov    %r13,%rdi
+  80471e:	41 ff d7             	call   *%r15
+  804721:	85 c0                	test   %eax,%eax
+  804723:	0f 85 c9 00 00 00    	jne    8047f2 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804729:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  80472c:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804733:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804739:	8b 43 04             	mov    0x4(%rbx),%eax
+  80473c:	41 39 c4             	cmp    %eax,%r12d
+  80473f:	75 cb                	jne    80470c <devpipe_read+0x4f>
+  804741:	48 89 de             	mov    %rbx,%rsi
+  804744:	4c 89 ef             	mov    %r13,%rdi
+  804747:	41 ff d7             	call   *%r15
+  80474a:	85 c0                	test   %eax,%eax
+  80474c:	75 be                	jne    80470c <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80474e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804753:	44 89 e6             	mov    %r12d,%esi
+  804756:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80475a:	48 b8 f7 17 80 00 00 	movabs $0x8017f7,%rax
+  804761:	00 00 00 
+  804764:	ff d0                	call   *%rax
+  804766:	eb a4                	jmp    80470c <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804768:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80476c:	48 89 de             	mov    %rbx,%rsi
+  80476f:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  804776:	00 00 00 
+  804779:	ff d0                	call   *%rax
+                return i;
+  80477b:	4c 89 f0             	mov    %r14,%rax
+}
+  80477e:	48 83 c4 28          	add    $0x28,%rsp
+  804782:	5b                   	pop    %rbx
+  804783:	41 5c                	pop    %r12
+  804785:	41 5d                	pop    %r13
+  804787:	41 5e                	pop    %r14
+  804789:	41 5f                	pop    %r15
+  80478b:	5d                   	pop    %rbp
+  80478c:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80478d:	48 63 c8             	movslq %eax,%rcx
+  804790:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804797:	80 80 80 
+  80479a:	48 89 c8             	mov    %rcx,%rax
+  80479d:	48 f7 e2             	mul    %rdx
+  8047a0:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8047a4:	48 89 d0             	mov    %rdx,%rax
+  8047a7:	48 c1 e0 08          	shl    $0x8,%rax
+  8047ab:	48 29 d0             	sub    %rdx,%rax
+  8047ae:	48 c1 e0 04          	shl    $0x4,%rax
+  8047b2:	48 89 c2             	mov    %rax,%rdx
+  8047b5:	48 89 c8             	mov    %rcx,%rax
+  8047b8:	48 29 d0             	sub    %rdx,%rax
+  8047bb:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8047c0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8047c4:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8047c8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047cb:	49 83 c6 01          	add    $0x1,%r14
+  8047cf:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8047d3:	0f 85 2b ff ff ff    	jne    804704 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8047d9:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8047dd:	48 89 de             	mov    %rbx,%rsi
+  8047e0:	48 b8 9d 44 80 00 00 	movabs $0x80449d,%rax
+  8047e7:	00 00 00 
+  8047ea:	ff d0                	call   *%rax
+    return n;
+  8047ec:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8047f0:	eb 8c                	jmp    80477e <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8047f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f7:	eb 85                	jmp    80477e <devpipe_read+0xc1>
+
+00000000008047f9 <pipe>:
+pipe(int pfd[2]) {
+  8047f9:	55                   	push   %rbp
+  8047fa:	48 89 e5             	mov    %rsp,%rbp
+  8047fd:	41 55                	push   %r13
+  8047ff:	41 54                	push   %r12
+  804801:	53                   	push   %rbx
+  804802:	48 83 ec 18          	sub    $0x18,%rsp
+  804806:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804809:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80480d:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  804814:	00 00 00 
+  804817:	ff d0                	call   *%rax
+  804819:	89 c3                	mov    %eax,%ebx
+  80481b:	85 c0                	test   %eax,%eax
+  80481d:	0f 88 a0 01 00 00    	js     8049c3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  804823:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804828:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80482d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804831:	bf 00 00 00 00       	mov    $0x0,%edi
+  804836:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  80483d:	00 00 00 
+  804840:	ff d0                	call   *%rax
+  804842:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804844:	85 c0                	test   %eax,%eax
+  804846:	0f 88 77 01 00 00    	js     8049c3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80484c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804850:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  804857:	00 00 00 
+  80485a:	ff d0                	call   *%rax
+  80485c:	89 c3                	mov    %eax,%ebx
+  80485e:	85 c0                	test   %eax,%eax
+  804860:	0f 88 43 01 00 00    	js     8049a9 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  804866:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80486b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804870:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804874:	bf 00 00 00 00       	mov    $0x0,%edi
+  804879:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  804880:	00 00 00 
+  804883:	ff d0                	call   *%rax
+  804885:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804887:	85 c0                	test   %eax,%eax
+  804889:	0f 88 1a 01 00 00    	js     8049a9 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80488f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804893:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  80489a:	00 00 00 
+  80489d:	ff d0                	call   *%rax
+  80489f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8048a2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048a7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048ac:	48 89 c6             	mov    %rax,%rsi
+  8048af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048b4:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  8048bb:	00 00 00 
+  8048be:	ff d0                	call   *%rax
+  8048c0:	89 c3                	mov    %eax,%ebx
+  8048c2:	85 c0                	test   %eax,%eax
+  8048c4:	0f 88 c5 00 00 00    	js     80498f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8048ca:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8048ce:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  8048d5:	00 00 00 
+  8048d8:	ff d0                	call   *%rax
+  8048da:	48 89 c1             	mov    %rax,%rcx
+  8048dd:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8048e3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8048e9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8048ee:	4c 89 ee             	mov    %r13,%rsi
+  8048f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048f6:	48 b8 df 14 80 00 00 	movabs $0x8014df,%rax
+  8048fd:	00 00 00 
+  804900:	ff d0                	call   *%rax
+  804902:	89 c3                	mov    %eax,%ebx
+  804904:	85 c0                	test   %eax,%eax
+  804906:	78 6e                	js     804976 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804908:	be 00 10 00 00       	mov    $0x1000,%esi
+  80490d:	4c 89 ef             	mov    %r13,%rdi
+  804910:	48 b8 4e 14 80 00 00 	movabs $0x80144e,%rax
+  804917:	00 00 00 
+  80491a:	ff d0                	call   *%rax
+  80491c:	83 f8 02             	cmp    $0x2,%eax
+  80491f:	0f 85 ab 00 00 00    	jne    8049d0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804925:	a1 60 70 80 00 00 00 	movabs 0x807060,%eax
+  80492c:	00 00 
+  80492e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804932:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804934:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804938:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80493f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804943:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804945:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804949:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804950:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804954:	48 bb 83 1a 80 00 00 	movabs $0x801a83,%rbx
+  80495b:	00 00 00 
+  80495e:	ff d3                	call   *%rbx
+  804960:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804964:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804968:	ff d3                	call   *%rbx
+  80496a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80496f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804974:	eb 4d                	jmp    8049c3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804976:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80497b:	4c 89 ee             	mov    %r13,%rsi
+  80497e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804983:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  80498a:	00 00 00 
+  80498d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80498f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804994:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804998:	bf 00 00 00 00       	mov    $0x0,%edi
+  80499d:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  8049a4:	00 00 00 
+  8049a7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8049a9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049ae:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8049b2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049b7:	48 b8 2f 15 80 00 00 	movabs $0x80152f,%rax
+  8049be:	00 00 00 
+  8049c1:	ff d0                	call   *%rax
+}
+  8049c3:	89 d8                	mov    %ebx,%eax
+  8049c5:	48 83 c4 18          	add    $0x18,%rsp
+  8049c9:	5b                   	pop    %rbx
+  8049ca:	41 5c                	pop    %r12
+  8049cc:	41 5d                	pop    %r13
+  8049ce:	5d                   	pop    %rbp
+  8049cf:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8049d0:	48 b9 88 5f 80 00 00 	movabs $0x805f88,%rcx
+  8049d7:	00 00 00 
+  8049da:	48 ba 31 5f 80 00 00 	movabs $0x805f31,%rdx
+  8049e1:	00 00 00 
+  8049e4:	be 50 00 00 00       	mov    $0x50,%esi
+  8049e9:	48 bf 76 5f 80 00 00 	movabs $0x805f76,%rdi
+  8049f0:	00 00 00 
+  8049f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f8:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8049ff:	00 00 00 
+  804a02:	41 ff d0             	call   *%r8
+
+0000000000804a05 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804a05:	55                   	push   %rbp
+  804a06:	48 89 e5             	mov    %rsp,%rbp
+  804a09:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804a0d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804a11:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  804a18:	00 00 00 
+  804a1b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804a1d:	85 c0                	test   %eax,%eax
+  804a1f:	78 23                	js     804a44 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804a21:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a25:	48 b8 95 1a 80 00 00 	movabs $0x801a95,%rax
+  804a2c:	00 00 00 
+  804a2f:	ff d0                	call   *%rax
+  804a31:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804a34:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804a38:	48 b8 40 45 80 00 00 	movabs $0x804540,%rax
+  804a3f:	00 00 00 
+  804a42:	ff d0                	call   *%rax
+}
+  804a44:	c9                   	leave
+  804a45:	c3                   	ret
+
+0000000000804a46 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804a46:	55                   	push   %rbp
+  804a47:	48 89 e5             	mov    %rsp,%rbp
+  804a4a:	41 56                	push   %r14
+  804a4c:	41 55                	push   %r13
+  804a4e:	41 54                	push   %r12
+  804a50:	53                   	push   %rbx
+    assert(envid != 0);
+  804a51:	85 ff                	test   %edi,%edi
+  804a53:	0f 84 b7 00 00 00    	je     804b10 <wait+0xca>
+  804a59:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804a5c:	89 f9                	mov    %edi,%ecx
+  804a5e:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804a64:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804a6b:	00 00 00 
+  804a6e:	45 89 e0             	mov    %r12d,%r8d
+  804a71:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804a78:	4c 89 c0             	mov    %r8,%rax
+  804a7b:	48 c1 e0 04          	shl    $0x4,%rax
+  804a7f:	48 89 c2             	mov    %rax,%rdx
+  804a82:	4c 29 c2             	sub    %r8,%rdx
+  804a85:	48 c1 e2 05          	shl    $0x5,%rdx
+  804a89:	48 01 fa             	add    %rdi,%rdx
+  804a8c:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804a92:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804a98:	41 39 c4             	cmp    %eax,%r12d
+  804a9b:	75 6a                	jne    804b07 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804a9d:	48 63 d1             	movslq %ecx,%rdx
+  804aa0:	48 89 d0             	mov    %rdx,%rax
+  804aa3:	48 c1 e0 04          	shl    $0x4,%rax
+  804aa7:	48 29 d0             	sub    %rdx,%rax
+  804aaa:	48 c1 e0 05          	shl    $0x5,%rax
+  804aae:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ab5:	00 00 00 
+  804ab8:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804abf:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804ac0:	48 63 c9             	movslq %ecx,%rcx
+  804ac3:	48 89 c8             	mov    %rcx,%rax
+  804ac6:	48 c1 e0 04          	shl    $0x4,%rax
+  804aca:	48 29 c8             	sub    %rcx,%rax
+  804acd:	48 c1 e0 05          	shl    $0x5,%rax
+  804ad1:	48 89 d3             	mov    %rdx,%rbx
+  804ad4:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804ad7:	49 bd f7 17 80 00 00 	movabs $0x8017f7,%r13
+  804ade:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804ae1:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804ae7:	85 c0                	test   %eax,%eax
+  804ae9:	74 1c                	je     804b07 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804aeb:	ba 00 00 00 00       	mov    $0x0,%edx
+  804af0:	4c 89 f7             	mov    %r14,%rdi
+  804af3:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  804af6:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804afc:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804b02:	44 39 e0             	cmp    %r12d,%eax
+  804b05:	74 da                	je     804ae1 <wait+0x9b>
+    }
+}
+  804b07:	5b                   	pop    %rbx
+  804b08:	41 5c                	pop    %r12
+  804b0a:	41 5d                	pop    %r13
+  804b0c:	41 5e                	pop    %r14
+  804b0e:	5d                   	pop    %rbp
+  804b0f:	c3                   	ret
+    assert(envid != 0);
+  804b10:	48 b9 ac 5f 80 00 00 	movabs $0x805fac,%rcx
+  804b17:	00 00 00 
+  804b1a:	48 ba 31 5f 80 00 00 	movabs $0x805f31,%rdx
+  804b21:	00 00 00 
+  804b24:	be 06 00 00 00       	mov    $0x6,%esi
+  804b29:	48 bf b7 5f 80 00 00 	movabs $0x805fb7,%rdi
+  804b30:	00 00 00 
+  804b33:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b38:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  804b3f:	00 00 00 
+  804b42:	41 ff d0             	call   *%r8
+
+0000000000804b45 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804b45:	48 89 f8             	mov    %rdi,%rax
+  804b48:	48 c1 e8 27          	shr    $0x27,%rax
+  804b4c:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804b53:	01 00 00 
+  804b56:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b5a:	f6 c2 01             	test   $0x1,%dl
+  804b5d:	74 6d                	je     804bcc <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804b5f:	48 89 f8             	mov    %rdi,%rax
+  804b62:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804b66:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b6d:	01 00 00 
+  804b70:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b74:	f6 c2 01             	test   $0x1,%dl
+  804b77:	74 62                	je     804bdb <get_uvpt_entry+0x96>
+  804b79:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804b80:	01 00 00 
+  804b83:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804b87:	f6 c2 80             	test   $0x80,%dl
+  804b8a:	75 4f                	jne    804bdb <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804b8c:	48 89 f8             	mov    %rdi,%rax
+  804b8f:	48 c1 e8 15          	shr    $0x15,%rax
+  804b93:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804b9a:	01 00 00 
+  804b9d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804ba1:	f6 c2 01             	test   $0x1,%dl
+  804ba4:	74 44                	je     804bea <get_uvpt_entry+0xa5>
+  804ba6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bad:	01 00 00 
+  804bb0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804bb4:	f6 c2 80             	test   $0x80,%dl
+  804bb7:	75 31                	jne    804bea <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804bb9:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804bbd:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804bc4:	01 00 00 
+  804bc7:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804bcb:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804bcc:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804bd3:	01 00 00 
+  804bd6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bda:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804bdb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804be2:	01 00 00 
+  804be5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804be9:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804bea:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804bf1:	01 00 00 
+  804bf4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804bf8:	c3                   	ret
+
+0000000000804bf9 <get_prot>:
+
+int
+get_prot(void *va) {
+  804bf9:	55                   	push   %rbp
+  804bfa:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804bfd:	48 b8 45 4b 80 00 00 	movabs $0x804b45,%rax
+  804c04:	00 00 00 
+  804c07:	ff d0                	call   *%rax
+  804c09:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804c0c:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804c11:	89 c1                	mov    %eax,%ecx
+  804c13:	83 c9 04             	or     $0x4,%ecx
+  804c16:	f6 c2 01             	test   $0x1,%dl
+  804c19:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804c1c:	89 c1                	mov    %eax,%ecx
+  804c1e:	83 c9 02             	or     $0x2,%ecx
+  804c21:	f6 c2 02             	test   $0x2,%dl
+  804c24:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804c27:	89 c1                	mov    %eax,%ecx
+  804c29:	83 c9 01             	or     $0x1,%ecx
+  804c2c:	48 85 d2             	test   %rdx,%rdx
+  804c2f:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804c32:	89 c1                	mov    %eax,%ecx
+  804c34:	83 c9 40             	or     $0x40,%ecx
+  804c37:	f6 c6 04             	test   $0x4,%dh
+  804c3a:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804c3d:	5d                   	pop    %rbp
+  804c3e:	c3                   	ret
+
+0000000000804c3f <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804c3f:	55                   	push   %rbp
+  804c40:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804c43:	48 b8 45 4b 80 00 00 	movabs $0x804b45,%rax
+  804c4a:	00 00 00 
+  804c4d:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804c4f:	48 c1 e8 06          	shr    $0x6,%rax
+  804c53:	83 e0 01             	and    $0x1,%eax
+}
+  804c56:	5d                   	pop    %rbp
+  804c57:	c3                   	ret
+
+0000000000804c58 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804c58:	55                   	push   %rbp
+  804c59:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804c5c:	48 b8 45 4b 80 00 00 	movabs $0x804b45,%rax
+  804c63:	00 00 00 
+  804c66:	ff d0                	call   *%rax
+  804c68:	83 e0 01             	and    $0x1,%eax
+}
+  804c6b:	5d                   	pop    %rbp
+  804c6c:	c3                   	ret
+
+0000000000804c6d <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804c6d:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804c74:	01 00 00 
+  804c77:	a8 01                	test   $0x1,%al
+  804c79:	75 06                	jne    804c81 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804c7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c80:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804c81:	55                   	push   %rbp
+  804c82:	48 89 e5             	mov    %rsp,%rbp
+  804c85:	41 57                	push   %r15
+  804c87:	41 56                	push   %r14
+  804c89:	41 55                	push   %r13
+  804c8b:	41 54                	push   %r12
+  804c8d:	53                   	push   %rbx
+  804c8e:	48 83 ec 28          	sub    $0x28,%rsp
+  804c92:	49 89 fe             	mov    %rdi,%r14
+  804c95:	49 89 f7             	mov    %rsi,%r15
+  804c98:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804c9f:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804ca0:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804ca7:	01 00 00 
+  804caa:	e9 ae 00 00 00       	jmp    804d5d <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804caf:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804cb6:	49 83 ec 01          	sub    $0x1,%r12
+  804cba:	74 2d                	je     804ce9 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804cbc:	48 89 d8             	mov    %rbx,%rax
+  804cbf:	48 c1 e8 0c          	shr    $0xc,%rax
+  804cc3:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804cc8:	f6 c2 01             	test   $0x1,%dl
+  804ccb:	74 e2                	je     804caf <foreach_shared_region+0x42>
+  804ccd:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804cd2:	f6 c4 04             	test   $0x4,%ah
+  804cd5:	74 d8                	je     804caf <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804cd7:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804cde:	4c 89 fa             	mov    %r15,%rdx
+  804ce1:	48 89 df             	mov    %rbx,%rdi
+  804ce4:	41 ff d6             	call   *%r14
+  804ce7:	eb c6                	jmp    804caf <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804ce9:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804cf0:	00 
+  804cf1:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804cf6:	74 4a                	je     804d42 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804cf8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804cfc:	48 c1 e8 15          	shr    $0x15,%rax
+  804d00:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804d07:	01 00 00 
+  804d0a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d0e:	a8 01                	test   $0x1,%al
+  804d10:	74 d7                	je     804ce9 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804d12:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804d16:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804d1d:	48 39 c3             	cmp    %rax,%rbx
+  804d20:	73 c7                	jae    804ce9 <foreach_shared_region+0x7c>
+  804d22:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804d29:	48 39 d0             	cmp    %rdx,%rax
+  804d2c:	4d 19 e4             	sbb    %r12,%r12
+  804d2f:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804d36:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804d3d:	e9 7a ff ff ff       	jmp    804cbc <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804d42:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804d49:	40 
+  804d4a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804d4e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d55:	00 00 00 
+  804d58:	48 39 c1             	cmp    %rax,%rcx
+  804d5b:	74 50                	je     804dad <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804d5d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804d61:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804d65:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804d6c:	01 00 00 
+  804d6f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804d73:	a8 01                	test   $0x1,%al
+  804d75:	74 cb                	je     804d42 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804d77:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804d7b:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804d82:	48 39 c1             	cmp    %rax,%rcx
+  804d85:	73 bb                	jae    804d42 <foreach_shared_region+0xd5>
+  804d87:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804d8e:	48 39 d0             	cmp    %rdx,%rax
+  804d91:	48 19 c0             	sbb    %rax,%rax
+  804d94:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804d9a:	48 05 00 02 00 00    	add    $0x200,%rax
+  804da0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804da4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804da8:	e9 4b ff ff ff       	jmp    804cf8 <foreach_shared_region+0x8b>
+  804dad:	b8 00 00 00 00       	mov    $0x0,%eax
+  804db2:	48 83 c4 28          	add    $0x28,%rsp
+  804db6:	5b                   	pop    %rbx
+  804db7:	41 5c                	pop    %r12
+  804db9:	41 5d                	pop    %r13
+  804dbb:	41 5e                	pop    %r14
+  804dbd:	41 5f                	pop    %r15
+  804dbf:	5d                   	pop    %rbp
+  804dc0:	c3                   	ret
+
+0000000000804dc1 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804dc1:	55                   	push   %rbp
+  804dc2:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804dc5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804dcc:	00 00 00 
+  804dcf:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804dd6:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804ddd:	00 00 00 
+  804de0:	48 39 c2             	cmp    %rax,%rdx
+  804de3:	74 13                	je     804df8 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804de5:	48 89 c7             	mov    %rax,%rdi
+  804de8:	48 b8 6e 17 80 00 00 	movabs $0x80176e,%rax
+  804def:	00 00 00 
+  804df2:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  804df4:	85 c0                	test   %eax,%eax
+  804df6:	78 0c                	js     804e04 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  804df8:	48 b8 ce 17 80 00 00 	movabs $0x8017ce,%rax
+  804dff:	00 00 00 
+  804e02:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804e04:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804e0b:	00 00 00 
+  804e0e:	8b 0a                	mov    (%rdx),%ecx
+  804e10:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804e13:	5d                   	pop    %rbp
+  804e14:	c3                   	ret
+
+0000000000804e15 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  804e15:	55                   	push   %rbp
+  804e16:	48 89 e5             	mov    %rsp,%rbp
+  804e19:	41 57                	push   %r15
+  804e1b:	41 56                	push   %r14
+  804e1d:	41 55                	push   %r13
+  804e1f:	41 54                	push   %r12
+  804e21:	53                   	push   %rbx
+  804e22:	48 83 ec 18          	sub    $0x18,%rsp
+  804e26:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804e2a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804e31:	00 00 00 
+  804e34:	83 38 00             	cmpl   $0x0,(%rax)
+  804e37:	75 69                	jne    804ea2 <scring_push+0x8d>
+  804e39:	49 89 ff             	mov    %rdi,%r15
+  804e3c:	49 89 f6             	mov    %rsi,%r14
+  804e3f:	49 89 d5             	mov    %rdx,%r13
+  804e42:	49 89 cc             	mov    %rcx,%r12
+  804e45:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804e48:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804e4f:	00 00 00 
+  804e52:	8b 42 04             	mov    0x4(%rdx),%eax
+  804e55:	8b 12                	mov    (%rdx),%edx
+  804e57:	29 d0                	sub    %edx,%eax
+  804e59:	83 f8 20             	cmp    $0x20,%eax
+  804e5c:	74 53                	je     804eb1 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804e5e:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804e65:	00 00 00 
+  804e68:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804e6b:	83 e0 1f             	and    $0x1f,%eax
+  804e6e:	48 c1 e0 06          	shl    $0x6,%rax
+  804e72:	48 01 d0             	add    %rdx,%rax
+  804e75:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804e79:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804e7d:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804e81:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804e85:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804e89:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804e8d:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804e91:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804e95:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804e99:	8b 42 04             	mov    0x4(%rdx),%eax
+  804e9c:	83 c0 01             	add    $0x1,%eax
+  804e9f:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804ea2:	48 83 c4 18          	add    $0x18,%rsp
+  804ea6:	5b                   	pop    %rbx
+  804ea7:	41 5c                	pop    %r12
+  804ea9:	41 5d                	pop    %r13
+  804eab:	41 5e                	pop    %r14
+  804ead:	41 5f                	pop    %r15
+  804eaf:	5d                   	pop    %rbp
+  804eb0:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804eb1:	48 b8 c1 4d 80 00 00 	movabs $0x804dc1,%rax
+  804eb8:	00 00 00 
+  804ebb:	ff d0                	call   *%rax
+  804ebd:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  804ec4:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804ec6:	85 c0                	test   %eax,%eax
+  804ec8:	79 94                	jns    804e5e <scring_push+0x49>
+  804eca:	eb d6                	jmp    804ea2 <scring_push+0x8d>
+
+0000000000804ecc <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804ecc:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804ed3:	00 00 00 
+  804ed6:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804ed8:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  804ede:	85 c0                	test   %eax,%eax
+  804ee0:	78 14                	js     804ef6 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  804ee2:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804ee9:	00 00 00 
+  804eec:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  804eef:	8b 12                	mov    (%rdx),%edx
+  804ef1:	39 d1                	cmp    %edx,%ecx
+  804ef3:	75 11                	jne    804f06 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  804ef5:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  804ef6:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  804efd:	00 00 00 
+  804f00:	8b 0a                	mov    (%rdx),%ecx
+  804f02:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  804f05:	c3                   	ret
+scring_submit(void) {
+  804f06:	55                   	push   %rbp
+  804f07:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  804f0a:	48 b8 c1 4d 80 00 00 	movabs $0x804dc1,%rax
+  804f11:	00 00 00 
+  804f14:	ff d0                	call   *%rax
+}
+  804f16:	5d                   	pop    %rbp
+  804f17:	c3                   	ret
+
+0000000000804f18 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  804f18:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804f1f:	00 00 00 
+  804f22:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  804f28:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804f2f:	00 00 00 
+  804f32:	8b 10                	mov    (%rax),%edx
+  804f34:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  804f37:	c3                   	ret
+
+0000000000804f38 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  804f38:	55                   	push   %rbp
+  804f39:	48 89 e5             	mov    %rsp,%rbp
+  804f3c:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  804f3f:	48 63 f7             	movslq %edi,%rsi
+  804f42:	48 83 ec 08          	sub    $0x8,%rsp
+  804f46:	6a 00                	push   $0x0
+  804f48:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804f4e:	4c 63 c1             	movslq %ecx,%r8
+  804f51:	48 89 d1             	mov    %rdx,%rcx
+  804f54:	48 89 c2             	mov    %rax,%rdx
+  804f57:	bf 04 00 00 00       	mov    $0x4,%edi
+  804f5c:	48 b8 15 4e 80 00 00 	movabs $0x804e15,%rax
+  804f63:	00 00 00 
+  804f66:	ff d0                	call   *%rax
+}
+  804f68:	48 83 c4 10          	add    $0x10,%rsp
+  804f6c:	c9                   	leave
+  804f6d:	c3                   	ret
+
+0000000000804f6e <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  804f6e:	55                   	push   %rbp
+  804f6f:	48 89 e5             	mov    %rsp,%rbp
+  804f72:	48 89 f0             	mov    %rsi,%rax
+  804f75:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  804f78:	48 63 ca             	movslq %edx,%rcx
+  804f7b:	48 63 f7             	movslq %edi,%rsi
+  804f7e:	48 83 ec 08          	sub    $0x8,%rsp
+  804f82:	4d 63 c9             	movslq %r9d,%r9
+  804f85:	41 51                	push   %r9
+  804f87:	4d 89 c1             	mov    %r8,%r9
+  804f8a:	4d 89 d0             	mov    %r10,%r8
+  804f8d:	48 89 c2             	mov    %rax,%rdx
+  804f90:	bf 05 00 00 00       	mov    $0x5,%edi
+  804f95:	48 b8 15 4e 80 00 00 	movabs $0x804e15,%rax
+  804f9c:	00 00 00 
+  804f9f:	ff d0                	call   *%rax
+}
+  804fa1:	48 83 c4 10          	add    $0x10,%rsp
+  804fa5:	c9                   	leave
+  804fa6:	c3                   	ret
+
+0000000000804fa7 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  804fa7:	55                   	push   %rbp
+  804fa8:	48 89 e5             	mov    %rsp,%rbp
+  804fab:	48 89 f0             	mov    %rsi,%rax
+  804fae:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  804fb1:	48 63 f7             	movslq %edi,%rsi
+  804fb4:	48 83 ec 08          	sub    $0x8,%rsp
+  804fb8:	6a 00                	push   $0x0
+  804fba:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804fc0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804fc6:	48 89 c2             	mov    %rax,%rdx
+  804fc9:	bf 06 00 00 00       	mov    $0x6,%edi
+  804fce:	48 b8 15 4e 80 00 00 	movabs $0x804e15,%rax
+  804fd5:	00 00 00 
+  804fd8:	ff d0                	call   *%rax
+}
+  804fda:	48 83 c4 10          	add    $0x10,%rsp
+  804fde:	c9                   	leave
+  804fdf:	c3                   	ret
+
+0000000000804fe0 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  804fe0:	55                   	push   %rbp
+  804fe1:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  804fe4:	48 63 d6             	movslq %esi,%rdx
+  804fe7:	48 63 f7             	movslq %edi,%rsi
+  804fea:	48 83 ec 08          	sub    $0x8,%rsp
+  804fee:	6a 00                	push   $0x0
+  804ff0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ff6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804ffc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805001:	bf 09 00 00 00       	mov    $0x9,%edi
+  805006:	48 b8 15 4e 80 00 00 	movabs $0x804e15,%rax
+  80500d:	00 00 00 
+  805010:	ff d0                	call   *%rax
+}
+  805012:	48 83 c4 10          	add    $0x10,%rsp
+  805016:	c9                   	leave
+  805017:	c3                   	ret
+
+0000000000805018 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  805018:	55                   	push   %rbp
+  805019:	48 89 e5             	mov    %rsp,%rbp
+  80501c:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80501f:	48 63 f7             	movslq %edi,%rsi
+  805022:	48 83 ec 08          	sub    $0x8,%rsp
+  805026:	6a 00                	push   $0x0
+  805028:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80502e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805034:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805039:	bf 0a 00 00 00       	mov    $0xa,%edi
+  80503e:	48 b8 15 4e 80 00 00 	movabs $0x804e15,%rax
+  805045:	00 00 00 
+  805048:	ff d0                	call   *%rax
+}
+  80504a:	48 83 c4 10          	add    $0x10,%rsp
+  80504e:	c9                   	leave
+  80504f:	c3                   	ret
+
+0000000000805050 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  805050:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  805056:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80505d:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  805064:	c3                   	ret
+
+0000000000805065 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  805065:	8b 47 40             	mov    0x40(%rdi),%eax
+  805068:	8b 17                	mov    (%rdi),%edx
+  80506a:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80506c:	83 f8 0f             	cmp    $0xf,%eax
+  80506f:	77 13                	ja     805084 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  805071:	8b 47 40             	mov    0x40(%rdi),%eax
+  805074:	83 e0 0f             	and    $0xf,%eax
+  805077:	48 c1 e0 09          	shl    $0x9,%rax
+  80507b:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805082:	00 
+  805083:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805084:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805089:	c3                   	ret
+
+000000000080508a <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80508a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80508d:	83 c0 01             	add    $0x1,%eax
+  805090:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805093:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  805099:	8b 57 04             	mov    0x4(%rdi),%edx
+  80509c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8050a1:	85 d2                	test   %edx,%edx
+  8050a3:	75 04                	jne    8050a9 <chan_publish+0x1f>
+  8050a5:	83 e0 01             	and    $0x1,%eax
+}
+  8050a8:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8050a9:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8050ac:	85 c0                	test   %eax,%eax
+  8050ae:	0f 95 c0             	setne  %al
+  8050b1:	0f b6 c0             	movzbl %al,%eax
+  8050b4:	eb ef                	jmp    8050a5 <chan_publish+0x1b>
+
+00000000008050b6 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8050b6:	8b 47 40             	mov    0x40(%rdi),%eax
+  8050b9:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8050bb:	29 d0                	sub    %edx,%eax
+  8050bd:	83 e8 01             	sub    $0x1,%eax
+  8050c0:	83 f8 0f             	cmp    $0xf,%eax
+  8050c3:	77 12                	ja     8050d7 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8050c5:	8b 07                	mov    (%rdi),%eax
+  8050c7:	83 e0 0f             	and    $0xf,%eax
+  8050ca:	48 c1 e0 09          	shl    $0x9,%rax
+  8050ce:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8050d5:	00 
+  8050d6:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8050d7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8050dc:	c3                   	ret
+
+00000000008050dd <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8050dd:	8b 07                	mov    (%rdi),%eax
+  8050df:	83 c0 01             	add    $0x1,%eax
+  8050e2:	89 07                	mov    %eax,(%rdi)
+}
+  8050e4:	c3                   	ret
+
+00000000008050e5 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8050e5:	55                   	push   %rbp
+  8050e6:	48 89 e5             	mov    %rsp,%rbp
+  8050e9:	53                   	push   %rbx
+  8050ea:	48 83 ec 08          	sub    $0x8,%rsp
+  8050ee:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8050f1:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8050f8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8050fe:	48 b8 b6 50 80 00 00 	movabs $0x8050b6,%rax
+  805105:	00 00 00 
+  805108:	ff d0                	call   *%rax
+  80510a:	48 85 c0             	test   %rax,%rax
+  80510d:	74 12                	je     805121 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80510f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  805116:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80511b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80511f:	c9                   	leave
+  805120:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  805121:	b8 01 00 00 00       	mov    $0x1,%eax
+  805126:	eb f3                	jmp    80511b <chan_arm+0x36>
+
+0000000000805128 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  805128:	55                   	push   %rbp
+  805129:	48 89 e5             	mov    %rsp,%rbp
+  80512c:	41 56                	push   %r14
+  80512e:	41 55                	push   %r13
+  805130:	41 54                	push   %r12
+  805132:	53                   	push   %rbx
+  805133:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  805136:	49 bc e5 50 80 00 00 	movabs $0x8050e5,%r12
+  80513d:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805140:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  805144:	49 bd f7 17 80 00 00 	movabs $0x8017f7,%r13
+  80514b:	00 00 00 
+    while (chan_arm(r))
+  80514e:	eb 0d                	jmp    80515d <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805150:	8b 33                	mov    (%rbx),%esi
+  805152:	ba 00 00 00 00       	mov    $0x0,%edx
+  805157:	4c 89 f7             	mov    %r14,%rdi
+  80515a:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80515d:	48 89 df             	mov    %rbx,%rdi
+  805160:	41 ff d4             	call   *%r12
+  805163:	84 c0                	test   %al,%al
+  805165:	75 e9                	jne    805150 <chan_wait+0x28>
+}
+  805167:	5b                   	pop    %rbx
+  805168:	41 5c                	pop    %r12
+  80516a:	41 5d                	pop    %r13
+  80516c:	41 5e                	pop    %r14
+  80516e:	5d                   	pop    %rbp
+  80516f:	c3                   	ret
+
+0000000000805170 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  805170:	55                   	push   %rbp
+  805171:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  805174:	48 83 c7 40          	add    $0x40,%rdi
+  805178:	be 01 00 00 00       	mov    $0x1,%esi
+  80517d:	48 b8 15 18 80 00 00 	movabs $0x801815,%rax
+  805184:	00 00 00 
+  805187:	ff d0                	call   *%rax
+}
+  805189:	5d                   	pop    %rbp
+  80518a:	c3                   	ret
+
+000000000080518b <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80518b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805190:	c3                   	ret
+
+0000000000805191 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  805191:	55                   	push   %rbp
+  805192:	48 89 e5             	mov    %rsp,%rbp
+  805195:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  805198:	48 be c2 5f 80 00 00 	movabs $0x805fc2,%rsi
+  80519f:	00 00 00 
+  8051a2:	48 b8 2a 0f 80 00 00 	movabs $0x800f2a,%rax
+  8051a9:	00 00 00 
+  8051ac:	ff d0                	call   *%rax
+    return 0;
+}
+  8051ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051b3:	5d                   	pop    %rbp
+  8051b4:	c3                   	ret
+
+00000000008051b5 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8051b5:	55                   	push   %rbp
+  8051b6:	48 89 e5             	mov    %rsp,%rbp
+  8051b9:	41 57                	push   %r15
+  8051bb:	41 56                	push   %r14
+  8051bd:	41 55                	push   %r13
+  8051bf:	41 54                	push   %r12
+  8051c1:	53                   	push   %rbx
+  8051c2:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8051c9:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8051d0:	48 85 d2             	test   %rdx,%rdx
+  8051d3:	74 7a                	je     80524f <devcons_write+0x9a>
+  8051d5:	49 89 d6             	mov    %rdx,%r14
+  8051d8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8051de:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8051e3:	49 bf 24 11 80 00 00 	movabs $0x801124,%r15
+  8051ea:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8051ed:	4c 89 f3             	mov    %r14,%rbx
+  8051f0:	48 29 f3             	sub    %rsi,%rbx
+  8051f3:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8051f8:	48 39 c3             	cmp    %rax,%rbx
+  8051fb:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8051ff:	4c 63 eb             	movslq %ebx,%r13
+  805202:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805209:	48 01 c6             	add    %rax,%rsi
+  80520c:	4c 89 ea             	mov    %r13,%rdx
+  80520f:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805216:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805219:	4c 89 ee             	mov    %r13,%rsi
+  80521c:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  805223:	48 b8 51 13 80 00 00 	movabs $0x801351,%rax
+  80522a:	00 00 00 
+  80522d:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80522f:	41 01 dc             	add    %ebx,%r12d
+  805232:	49 63 f4             	movslq %r12d,%rsi
+  805235:	4c 39 f6             	cmp    %r14,%rsi
+  805238:	72 b3                	jb     8051ed <devcons_write+0x38>
+    return res;
+  80523a:	49 63 c4             	movslq %r12d,%rax
+}
+  80523d:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  805244:	5b                   	pop    %rbx
+  805245:	41 5c                	pop    %r12
+  805247:	41 5d                	pop    %r13
+  805249:	41 5e                	pop    %r14
+  80524b:	41 5f                	pop    %r15
+  80524d:	5d                   	pop    %rbp
+  80524e:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80524f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805255:	eb e3                	jmp    80523a <devcons_write+0x85>
+
+0000000000805257 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805257:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80525a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80525f:	48 85 c0             	test   %rax,%rax
+  805262:	74 55                	je     8052b9 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  805264:	55                   	push   %rbp
+  805265:	48 89 e5             	mov    %rsp,%rbp
+  805268:	41 55                	push   %r13
+  80526a:	41 54                	push   %r12
+  80526c:	53                   	push   %rbx
+  80526d:	48 83 ec 08          	sub    $0x8,%rsp
+  805271:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  805274:	48 bb 70 13 80 00 00 	movabs $0x801370,%rbx
+  80527b:	00 00 00 
+  80527e:	49 bc 25 14 80 00 00 	movabs $0x801425,%r12
+  805285:	00 00 00 
+  805288:	eb 03                	jmp    80528d <devcons_read+0x36>
+  80528a:	41 ff d4             	call   *%r12
+  80528d:	ff d3                	call   *%rbx
+  80528f:	85 c0                	test   %eax,%eax
+  805291:	74 f7                	je     80528a <devcons_read+0x33>
+    if (c < 0) return c;
+  805293:	48 63 d0             	movslq %eax,%rdx
+  805296:	78 13                	js     8052ab <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  805298:	ba 00 00 00 00       	mov    $0x0,%edx
+  80529d:	83 f8 04             	cmp    $0x4,%eax
+  8052a0:	74 09                	je     8052ab <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8052a2:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8052a6:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8052ab:	48 89 d0             	mov    %rdx,%rax
+  8052ae:	48 83 c4 08          	add    $0x8,%rsp
+  8052b2:	5b                   	pop    %rbx
+  8052b3:	41 5c                	pop    %r12
+  8052b5:	41 5d                	pop    %r13
+  8052b7:	5d                   	pop    %rbp
+  8052b8:	c3                   	ret
+  8052b9:	48 89 d0             	mov    %rdx,%rax
+  8052bc:	c3                   	ret
+
+00000000008052bd <cputchar>:
+cputchar(int ch) {
+  8052bd:	55                   	push   %rbp
+  8052be:	48 89 e5             	mov    %rsp,%rbp
+  8052c1:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8052c5:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8052c9:	be 01 00 00 00       	mov    $0x1,%esi
+  8052ce:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8052d2:	48 b8 51 13 80 00 00 	movabs $0x801351,%rax
+  8052d9:	00 00 00 
+  8052dc:	ff d0                	call   *%rax
+}
+  8052de:	c9                   	leave
+  8052df:	c3                   	ret
+
+00000000008052e0 <getchar>:
+getchar(void) {
+  8052e0:	55                   	push   %rbp
+  8052e1:	48 89 e5             	mov    %rsp,%rbp
+  8052e4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8052e8:	ba 01 00 00 00       	mov    $0x1,%edx
+  8052ed:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8052f1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f6:	48 b8 f4 1d 80 00 00 	movabs $0x801df4,%rax
+  8052fd:	00 00 00 
+  805300:	ff d0                	call   *%rax
+  805302:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  805304:	85 c0                	test   %eax,%eax
+  805306:	78 06                	js     80530e <getchar+0x2e>
+  805308:	74 08                	je     805312 <getchar+0x32>
+  80530a:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80530e:	89 d0                	mov    %edx,%eax
+  805310:	c9                   	leave
+  805311:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805312:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  805317:	eb f5                	jmp    80530e <getchar+0x2e>
+
+0000000000805319 <iscons>:
+iscons(int fdnum) {
+  805319:	55                   	push   %rbp
+  80531a:	48 89 e5             	mov    %rsp,%rbp
+  80531d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805321:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  805325:	48 b8 11 1b 80 00 00 	movabs $0x801b11,%rax
+  80532c:	00 00 00 
+  80532f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805331:	85 c0                	test   %eax,%eax
+  805333:	78 18                	js     80534d <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  805335:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805339:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  805340:	00 00 00 
+  805343:	8b 00                	mov    (%rax),%eax
+  805345:	39 02                	cmp    %eax,(%rdx)
+  805347:	0f 94 c0             	sete   %al
+  80534a:	0f b6 c0             	movzbl %al,%eax
+}
+  80534d:	c9                   	leave
+  80534e:	c3                   	ret
+
+000000000080534f <opencons>:
+opencons(void) {
+  80534f:	55                   	push   %rbp
+  805350:	48 89 e5             	mov    %rsp,%rbp
+  805353:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  805357:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80535b:	48 b8 b1 1a 80 00 00 	movabs $0x801ab1,%rax
+  805362:	00 00 00 
+  805365:	ff d0                	call   *%rax
+  805367:	85 c0                	test   %eax,%eax
+  805369:	78 49                	js     8053b4 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80536b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805370:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805375:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  805379:	bf 00 00 00 00       	mov    $0x0,%edi
+  80537e:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  805385:	00 00 00 
+  805388:	ff d0                	call   *%rax
+  80538a:	85 c0                	test   %eax,%eax
+  80538c:	78 26                	js     8053b4 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80538e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805392:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  805399:	00 00 
+  80539b:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80539d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8053a1:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8053a8:	48 b8 83 1a 80 00 00 	movabs $0x801a83,%rax
+  8053af:	00 00 00 
+  8053b2:	ff d0                	call   *%rax
+}
+  8053b4:	c9                   	leave
+  8053b5:	c3                   	ret
+
+00000000008053b6 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8053b6:	55                   	push   %rbp
+  8053b7:	48 89 e5             	mov    %rsp,%rbp
+  8053ba:	41 56                	push   %r14
+  8053bc:	41 55                	push   %r13
+  8053be:	41 54                	push   %r12
+  8053c0:	53                   	push   %rbx
+  8053c1:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053c4:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8053cb:	00 00 00 
+  8053ce:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8053d2:	74 27                	je     8053fb <_handle_vectored_pagefault+0x45>
+  8053d4:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8053d9:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  8053e0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053e3:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8053e6:	4c 89 e7             	mov    %r12,%rdi
+  8053e9:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8053ee:	84 c0                	test   %al,%al
+  8053f0:	75 45                	jne    805437 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8053f2:	48 83 c3 01          	add    $0x1,%rbx
+  8053f6:	49 3b 1e             	cmp    (%r14),%rbx
+  8053f9:	72 eb                	jb     8053e6 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8053fb:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805402:	00 
+  805403:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805408:	4d 8b 04 24          	mov    (%r12),%r8
+  80540c:	48 ba d0 5f 80 00 00 	movabs $0x805fd0,%rdx
+  805413:	00 00 00 
+  805416:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80541b:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  805422:	00 00 00 
+  805425:	b8 00 00 00 00       	mov    $0x0,%eax
+  80542a:	49 ba b5 04 80 00 00 	movabs $0x8004b5,%r10
+  805431:	00 00 00 
+  805434:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805437:	5b                   	pop    %rbx
+  805438:	41 5c                	pop    %r12
+  80543a:	41 5d                	pop    %r13
+  80543c:	41 5e                	pop    %r14
+  80543e:	5d                   	pop    %rbp
+  80543f:	c3                   	ret
+
+0000000000805440 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805440:	55                   	push   %rbp
+  805441:	48 89 e5             	mov    %rsp,%rbp
+  805444:	53                   	push   %rbx
+  805445:	48 83 ec 08          	sub    $0x8,%rsp
+  805449:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80544c:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805453:	00 00 00 
+  805456:	80 38 00             	cmpb   $0x0,(%rax)
+  805459:	0f 84 84 00 00 00    	je     8054e3 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80545f:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805466:	00 00 00 
+  805469:	48 8b 10             	mov    (%rax),%rdx
+  80546c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  805471:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  805478:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80547b:	48 85 d2             	test   %rdx,%rdx
+  80547e:	74 19                	je     805499 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  805480:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  805484:	0f 84 e8 00 00 00    	je     805572 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80548a:	48 83 c0 01          	add    $0x1,%rax
+  80548e:	48 39 d0             	cmp    %rdx,%rax
+  805491:	75 ed                	jne    805480 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  805493:	48 83 fa 08          	cmp    $0x8,%rdx
+  805497:	74 1c                	je     8054b5 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805499:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80549d:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  8054a4:	00 00 00 
+  8054a7:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  8054ae:	00 00 00 
+  8054b1:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8054b5:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  8054bc:	00 00 00 
+  8054bf:	ff d0                	call   *%rax
+  8054c1:	89 c7                	mov    %eax,%edi
+  8054c3:	48 be 38 56 80 00 00 	movabs $0x805638,%rsi
+  8054ca:	00 00 00 
+  8054cd:	48 b8 47 16 80 00 00 	movabs $0x801647,%rax
+  8054d4:	00 00 00 
+  8054d7:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8054d9:	85 c0                	test   %eax,%eax
+  8054db:	78 68                	js     805545 <add_pgfault_handler+0x105>
+    return res;
+}
+  8054dd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8054e1:	c9                   	leave
+  8054e2:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8054e3:	48 b8 fc 13 80 00 00 	movabs $0x8013fc,%rax
+  8054ea:	00 00 00 
+  8054ed:	ff d0                	call   *%rax
+  8054ef:	89 c7                	mov    %eax,%edi
+  8054f1:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8054f6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8054fb:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  805502:	00 00 00 
+  805505:	48 b8 89 14 80 00 00 	movabs $0x801489,%rax
+  80550c:	00 00 00 
+  80550f:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805511:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  805518:	00 00 00 
+  80551b:	48 8b 02             	mov    (%rdx),%rax
+  80551e:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805522:	48 89 0a             	mov    %rcx,(%rdx)
+  805525:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  80552c:	00 00 00 
+  80552f:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  805533:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  80553a:	00 00 00 
+  80553d:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805540:	e9 70 ff ff ff       	jmp    8054b5 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805545:	89 c1                	mov    %eax,%ecx
+  805547:	48 ba 0e 60 80 00 00 	movabs $0x80600e,%rdx
+  80554e:	00 00 00 
+  805551:	be 3d 00 00 00       	mov    $0x3d,%esi
+  805556:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  80555d:	00 00 00 
+  805560:	b8 00 00 00 00       	mov    $0x0,%eax
+  805565:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  80556c:	00 00 00 
+  80556f:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805572:	b8 00 00 00 00       	mov    $0x0,%eax
+  805577:	e9 61 ff ff ff       	jmp    8054dd <add_pgfault_handler+0x9d>
+
+000000000080557c <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80557c:	55                   	push   %rbp
+  80557d:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  805580:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805587:	00 00 00 
+  80558a:	80 38 00             	cmpb   $0x0,(%rax)
+  80558d:	74 33                	je     8055c2 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80558f:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  805596:	00 00 00 
+  805599:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80559e:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8055a5:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055a8:	48 85 c0             	test   %rax,%rax
+  8055ab:	0f 84 85 00 00 00    	je     805636 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8055b1:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8055b5:	74 40                	je     8055f7 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8055b7:	48 83 c1 01          	add    $0x1,%rcx
+  8055bb:	48 39 c1             	cmp    %rax,%rcx
+  8055be:	75 f1                	jne    8055b1 <remove_pgfault_handler+0x35>
+  8055c0:	eb 74                	jmp    805636 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8055c2:	48 b9 26 60 80 00 00 	movabs $0x806026,%rcx
+  8055c9:	00 00 00 
+  8055cc:	48 ba 31 5f 80 00 00 	movabs $0x805f31,%rdx
+  8055d3:	00 00 00 
+  8055d6:	be 43 00 00 00       	mov    $0x43,%esi
+  8055db:	48 bf 00 60 80 00 00 	movabs $0x806000,%rdi
+  8055e2:	00 00 00 
+  8055e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055ea:	49 b8 b5 04 80 00 00 	movabs $0x8004b5,%r8
+  8055f1:	00 00 00 
+  8055f4:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8055f7:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8055fe:	00 
+  8055ff:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  805603:	48 29 ca             	sub    %rcx,%rdx
+  805606:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  80560d:	00 00 00 
+  805610:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  805614:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805619:	48 89 ce             	mov    %rcx,%rsi
+  80561c:	48 b8 24 11 80 00 00 	movabs $0x801124,%rax
+  805623:	00 00 00 
+  805626:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  805628:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  80562f:	00 00 00 
+  805632:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  805636:	5d                   	pop    %rbp
+  805637:	c3                   	ret
+
+0000000000805638 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  805638:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80563b:	48 b8 b6 53 80 00 00 	movabs $0x8053b6,%rax
+  805642:	00 00 00 
+    call *%rax
+  805645:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  805647:	41 5f                	pop    %r15
+	popq %r15
+  805649:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80564b:	41 5f                	pop    %r15
+	popq %r14
+  80564d:	41 5e                	pop    %r14
+	popq %r13
+  80564f:	41 5d                	pop    %r13
+	popq %r12
+  805651:	41 5c                	pop    %r12
+	popq %r11
+  805653:	41 5b                	pop    %r11
+	popq %r10
+  805655:	41 5a                	pop    %r10
+	popq %r9
+  805657:	41 59                	pop    %r9
+	popq %r8
+  805659:	41 58                	pop    %r8
+	popq %rsi
+  80565b:	5e                   	pop    %rsi
+	popq %rdi
+  80565c:	5f                   	pop    %rdi
+	popq %rbp
+  80565d:	5d                   	pop    %rbp
+	popq %rdx
+  80565e:	5a                   	pop    %rdx
+	popq %rcx
+  80565f:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  805660:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  805665:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80566a:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80566e:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805671:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  805676:	5b                   	pop    %rbx
+	popq %rax
+  805677:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  805678:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80567c:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80567d:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  805682:	c3                   	ret
+  805683:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000805688 <__rodata_start>:
+  805688:	2f                   	(bad)
+  805689:	69 6f 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdi),%ebp
+  805690:	2e 6f                	outsl  %ds:(%rsi),(%dx)
+  805692:	75 74                	jne    805708 <__rodata_start+0x80>
+  805694:	00 6f 70             	add    %ch,0x70(%rdi)
+  805697:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805699:	20 2f                	and    %ch,(%rdi)
+  80569b:	69 6f 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdi),%ebp
+  8056a2:	2e 6f                	outsl  %ds:(%rsi),(%dx)
+  8056a4:	75 74                	jne    80571a <__rodata_start+0x92>
+  8056a6:	3a 20                	cmp    (%rax),%ah
+  8056a8:	25 69 00 75 73       	and    $0x73750069,%eax
+  8056ad:	65 72 2f             	gs jb  8056df <__rodata_start+0x57>
+  8056b0:	69 6f 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdi),%ebp
+  8056b7:	2e 63 00             	cs movsxd (%rax),%eax
+  8056ba:	64 75 70             	fs jne 80572d <__rodata_start+0xa5>
+  8056bd:	3a 20                	cmp    (%rax),%ah
+  8056bf:	25 69 00 2f 69       	and    $0x692f0069,%eax
+  8056c4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8056c5:	62 65 6e 63 68       	(bad)
+  8056ca:	2e 74 78             	je,pn  805745 <__rodata_start+0xbd>
+  8056cd:	74 00                	je     8056cf <__rodata_start+0x47>
+  8056cf:	73 70                	jae    805741 <__rodata_start+0xb9>
+  8056d1:	61                   	(bad)
+  8056d2:	77 6e                	ja     805742 <__rodata_start+0xba>
+  8056d4:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0914d <__bss_end+0x251c714d>
+  8056da:	69 00 73 74 61 74    	imul   $0x74617473,(%rax),%eax
+  8056e0:	20 2f                	and    %ch,(%rdi)
+  8056e2:	69 6f 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdi),%ebp
+  8056e9:	2e 6f                	outsl  %ds:(%rsi),(%dx)
+  8056eb:	75 74                	jne    805761 <__rodata_start+0xd9>
+  8056ed:	3a 20                	cmp    (%rax),%ah
+  8056ef:	25 69 00 6e 6f       	and    $0x6f6e0069,%eax
+  8056f4:	20 66 69             	and    %ah,0x69(%rsi)
+  8056f7:	6c                   	insb   (%dx),%es:(%rdi)
+  8056f8:	65 20 73 65          	and    %dh,%gs:0x65(%rbx)
+  8056fc:	72 76                	jb     805774 <__rodata_start+0xec>
+  8056fe:	65 72 00             	gs jb  805701 <__rodata_start+0x79>
+  805701:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805702:	70 65                	jo     805769 <__rodata_start+0xe1>
+  805704:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805705:	20 2f                	and    %ch,(%rdi)
+  805707:	69 6f 62 65 6e 63 68 	imul   $0x68636e65,0x62(%rdi),%ebp
+  80570e:	2e 74 78             	je,pn  805789 <__rodata_start+0x101>
+  805711:	74 3a                	je     80574d <__rodata_start+0xc5>
+  805713:	20 25 69 00 77 72    	and    %ah,0x72770069(%rip)        # 72f75782 <__bss_end+0x72733782>
+  805719:	69 74 65 20 2f 69 6f 	imul   $0x626f692f,0x20(%rbp,%riz,2),%esi
+  805720:	62 
+  805721:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805723:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  805726:	74 78                	je     8057a0 <__rodata_start+0x118>
+  805728:	74 3a                	je     805764 <__rodata_start+0xdc>
+  80572a:	20 25 69 00 2f 63    	and    %ah,0x632f0069(%rip)        # 63af5799 <__bss_end+0x632b3799>
+  805730:	61                   	(bad)
+  805731:	74 00                	je     805733 <__rodata_start+0xab>
+  805733:	2f                   	(bad)
+  805734:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805735:	75 6d                	jne    8057a4 <__rodata_start+0x11c>
+  805737:	00 69 6f             	add    %ch,0x6f(%rcx)
+  80573a:	62 65 6e 63 68       	(bad)
+  80573f:	3a 20                	cmp    (%rax),%ah
+  805741:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  805746:	6c                   	insb   (%dx),%es:(%rdi)
+  805747:	75 20                	jne    805769 <__rodata_start+0xe1>
+  805749:	4b                   	rex.WXB
+  80574a:	42 20 77 72          	rex.X and %sil,0x72(%rdi)
+  80574e:	69 74 74 65 6e 2c 20 	imul   $0x25202c6e,0x65(%rsp,%rsi,2),%esi
+  805755:	25 
+  805756:	6c                   	insb   (%dx),%es:(%rdi)
+  805757:	75 20                	jne    805779 <__rodata_start+0xf1>
+  805759:	73 79                	jae    8057d4 <__rodata_start+0x14c>
+  80575b:	73 74                	jae    8057d1 <__rodata_start+0x149>
+  80575d:	65 6d                	gs insl (%dx),%es:(%rdi)
+  80575f:	20 63 61             	and    %ah,0x61(%rbx)
+  805762:	6c                   	insb   (%dx),%es:(%rdi)
+  805763:	6c                   	insb   (%dx),%es:(%rdi)
+  805764:	73 2c                	jae    805792 <__rodata_start+0x10a>
+  805766:	20 25 6c 75 20 49    	and    %ah,0x4920756c(%rip)        # 49a0ccd8 <__bss_end+0x491cacd8>
+  80576c:	50                   	push   %rax
+  80576d:	43 20 6d 65          	rex.XB and %bpl,0x65(%r13)
+  805771:	73 73                	jae    8057e6 <__rodata_start+0x15e>
+  805773:	61                   	(bad)
+  805774:	67 65 73 2c          	addr32 gs jae 8057a4 <__rodata_start+0x11c>
+  805778:	20 25 6c 75 20 66    	and    %ah,0x6620756c(%rip)        # 66a0ccea <__bss_end+0x661cacea>
+  80577e:	69 6c 65 20 73 65 72 	imul   $0x76726573,0x20(%rbp,%riz,2),%ebp
+  805785:	76 
+  805786:	65 72 20             	gs jb  8057a9 <__rodata_start+0x121>
+  805789:	72 65                	jb     8057f0 <__rodata_start+0x168>
+  80578b:	71 75                	jno    805802 <__rodata_start+0x17a>
+  80578d:	65 73 74             	gs jae 805804 <__rodata_start+0x17c>
+  805790:	73 0a                	jae    80579c <__rodata_start+0x114>
+  805792:	00 00                	add    %al,(%rax)
+  805794:	00 00                	add    %al,(%rax)
+  805796:	00 00                	add    %al,(%rax)
+  805798:	25 64 3a 20 74       	and    $0x74203a64,%eax
+  80579d:	68 65 20 71 75       	push   $0x75712065
+  8057a2:	69 63 6b 20 62 72 6f 	imul   $0x6f726220,0x6b(%rbx),%esp
+  8057a9:	77 6e                	ja     805819 <__rodata_start+0x191>
+  8057ab:	20 66 6f             	and    %ah,0x6f(%rsi)
+  8057ae:	78 20                	js     8057d0 <__rodata_start+0x148>
+  8057b0:	6a 75                	push   $0x75
+  8057b2:	6d                   	insl   (%dx),%es:(%rdi)
+  8057b3:	70 73                	jo     805828 <__rodata_start+0x1a0>
+  8057b5:	20 6f 76             	and    %ch,0x76(%rdi)
+  8057b8:	65 72 20             	gs jb  8057db <__rodata_start+0x153>
+  8057bb:	74 68                	je     805825 <__rodata_start+0x19d>
+  8057bd:	65 20 6c 61 7a       	and    %ch,%gs:0x7a(%rcx,%riz,2)
+  8057c2:	79 20                	jns    8057e4 <__rodata_start+0x15c>
+  8057c4:	64 6f                	outsl  %fs:(%rsi),(%dx)
+  8057c6:	67 0a 00             	or     (%eax),%al
+  8057c9:	3c 75                	cmp    $0x75,%al
+  8057cb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057cc:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8057d0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057d1:	3e 00 0f             	ds add %cl,(%rdi)
+  8057d4:	1f                   	(bad)
+  8057d5:	44 00 00             	add    %r8b,(%rax)
+  8057d8:	5b                   	pop    %rbx
+  8057d9:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  8057de:	20 75 73             	and    %dh,0x73(%rbp)
+  8057e1:	65 72 20             	gs jb  805804 <__rodata_start+0x17c>
+  8057e4:	70 61                	jo     805847 <__rodata_start+0x1bf>
+  8057e6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8057e7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  8057ee:	73 20                	jae    805810 <__rodata_start+0x188>
+  8057f0:	61                   	(bad)
+  8057f1:	74 20                	je     805813 <__rodata_start+0x18b>
+  8057f3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  8057f8:	3a 20                	cmp    (%rax),%ah
+  8057fa:	00 30                	add    %dh,(%rax)
+  8057fc:	31 32                	xor    %esi,(%rdx)
+  8057fe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805805:	41                   	rex.B
+  805806:	42                   	rex.X
+  805807:	43                   	rex.XB
+  805808:	44                   	rex.R
+  805809:	45                   	rex.RB
+  80580a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80580d:	31 32                	xor    %esi,(%rdx)
+  80580f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805816:	61                   	(bad)
+  805817:	62 63 64 65 66       	(bad)
+  80581c:	00 28                	add    %ch,(%rax)
+  80581e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80581f:	75 6c                	jne    80588d <__rodata_start+0x205>
+  805821:	6c                   	insb   (%dx),%es:(%rdi)
+  805822:	29 00                	sub    %eax,(%rax)
+  805824:	65 72 72             	gs jb  805899 <__rodata_start+0x211>
+  805827:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805828:	72 20                	jb     80584a <__rodata_start+0x1c2>
+  80582a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80582f:	73 70                	jae    8058a1 <__rodata_start+0x219>
+  805831:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805835:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80583c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80583d:	72 00                	jb     80583f <__rodata_start+0x1b7>
+  80583f:	62 61 64 20 65       	(bad)
+  805844:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805845:	76 69                	jbe    8058b0 <__rodata_start+0x228>
+  805847:	72 6f                	jb     8058b8 <__rodata_start+0x230>
+  805849:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80584a:	6d                   	insl   (%dx),%es:(%rdi)
+  80584b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80584d:	74 00                	je     80584f <__rodata_start+0x1c7>
+  80584f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805856:	20 70 61             	and    %dh,0x61(%rax)
+  805859:	72 61                	jb     8058bc <__rodata_start+0x234>
+  80585b:	6d                   	insl   (%dx),%es:(%rdi)
+  80585c:	65 74 65             	gs je  8058c4 <__rodata_start+0x23c>
+  80585f:	72 00                	jb     805861 <__rodata_start+0x1d9>
+  805861:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805862:	75 74                	jne    8058d8 <__rodata_start+0x250>
+  805864:	20 6f 66             	and    %ch,0x66(%rdi)
+  805867:	20 6d 65             	and    %ch,0x65(%rbp)
+  80586a:	6d                   	insl   (%dx),%es:(%rdi)
+  80586b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80586c:	72 79                	jb     8058e7 <__rodata_start+0x25f>
+  80586e:	00 6f 75             	add    %ch,0x75(%rdi)
+  805871:	74 20                	je     805893 <__rodata_start+0x20b>
+  805873:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805874:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805878:	76 69                	jbe    8058e3 <__rodata_start+0x25b>
+  80587a:	72 6f                	jb     8058eb <__rodata_start+0x263>
+  80587c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80587d:	6d                   	insl   (%dx),%es:(%rdi)
+  80587e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805880:	74 73                	je     8058f5 <__rodata_start+0x26d>
+  805882:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805885:	72 72                	jb     8058f9 <__rodata_start+0x271>
+  805887:	75 70                	jne    8058f9 <__rodata_start+0x271>
+  805889:	74 65                	je     8058f0 <__rodata_start+0x268>
+  80588b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805890:	75 67                	jne    8058f9 <__rodata_start+0x271>
+  805892:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805895:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805897:	00 73 65             	add    %dh,0x65(%rbx)
+  80589a:	67 6d                	insl   (%dx),%es:(%edi)
+  80589c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80589e:	74 61                	je     805901 <__rodata_start+0x279>
+  8058a0:	74 69                	je     80590b <__rodata_start+0x283>
+  8058a2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058a3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058a4:	20 66 61             	and    %ah,0x61(%rsi)
+  8058a7:	75 6c                	jne    805915 <__rodata_start+0x28d>
+  8058a9:	74 00                	je     8058ab <__rodata_start+0x223>
+  8058ab:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8058b2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8058b5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8058b9:	61                   	(bad)
+  8058ba:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8058bf:	20 73 75             	and    %dh,0x75(%rbx)
+  8058c2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8058c5:	73 79                	jae    805940 <__rodata_start+0x2b8>
+  8058c7:	73 74                	jae    80593d <__rodata_start+0x2b5>
+  8058c9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8058cb:	20 63 61             	and    %ah,0x61(%rbx)
+  8058ce:	6c                   	insb   (%dx),%es:(%rdi)
+  8058cf:	6c                   	insb   (%dx),%es:(%rdi)
+  8058d0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8058d3:	74 72                	je     805947 <__rodata_start+0x2bf>
+  8058d5:	79 20                	jns    8058f7 <__rodata_start+0x26f>
+  8058d7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058d8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8058d9:	74 20                	je     8058fb <__rodata_start+0x273>
+  8058db:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8058dd:	75 6e                	jne    80594d <__rodata_start+0x2c5>
+  8058df:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8058e3:	76 20                	jbe    805905 <__rodata_start+0x27d>
+  8058e5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8058ec:	72 65                	jb     805953 <__rodata_start+0x2cb>
+  8058ee:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8058f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8058f2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8058f6:	65 78 70             	gs js  805969 <__rodata_start+0x2e1>
+  8058f9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8058fe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805901:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805905:	20 66 69             	and    %ah,0x69(%rsi)
+  805908:	6c                   	insb   (%dx),%es:(%rdi)
+  805909:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  80590d:	20 66 72             	and    %ah,0x72(%rsi)
+  805910:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805915:	61                   	(bad)
+  805916:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805919:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80591a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80591b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  80591f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805922:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805923:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805924:	20 6d 61             	and    %ch,0x61(%rbp)
+  805927:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805928:	79 20                	jns    80594a <__rodata_start+0x2c2>
+  80592a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805931:	72 65                	jb     805998 <__rodata_start+0x310>
+  805933:	20 6f 70             	and    %ch,0x70(%rdi)
+  805936:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805938:	00 66 69             	add    %ah,0x69(%rsi)
+  80593b:	6c                   	insb   (%dx),%es:(%rdi)
+  80593c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805940:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805943:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805944:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805947:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805948:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805949:	74 20                	je     80596b <__rodata_start+0x2e3>
+  80594b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  80594d:	75 6e                	jne    8059bd <__rodata_start+0x335>
+  80594f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805953:	76 61                	jbe    8059b6 <__rodata_start+0x32e>
+  805955:	6c                   	insb   (%dx),%es:(%rdi)
+  805956:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  80595d:	00 
+  80595e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805965:	72 65                	jb     8059cc <__rodata_start+0x344>
+  805967:	61                   	(bad)
+  805968:	64 79 20             	fs jns 80598b <__rodata_start+0x303>
+  80596b:	65 78 69             	gs js  8059d7 <__rodata_start+0x34f>
+  80596e:	73 74                	jae    8059e4 <__rodata_start+0x35c>
+  805970:	73 00                	jae    805972 <__rodata_start+0x2ea>
+  805972:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805973:	70 65                	jo     8059da <__rodata_start+0x352>
+  805975:	72 61                	jb     8059d8 <__rodata_start+0x350>
+  805977:	74 69                	je     8059e2 <__rodata_start+0x35a>
+  805979:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80597a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80597b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  80597e:	74 20                	je     8059a0 <__rodata_start+0x318>
+  805980:	73 75                	jae    8059f7 <__rodata_start+0x36f>
+  805982:	70 70                	jo     8059f4 <__rodata_start+0x36c>
+  805984:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805985:	72 74                	jb     8059fb <__rodata_start+0x373>
+  805987:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  80598d:	20 61 67             	and    %ah,0x67(%rcx)
+  805990:	61                   	(bad)
+  805991:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805998:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  80599c:	74 00                	je     80599e <__rodata_start+0x316>
+  80599e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8059a5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8059a8:	20 75 73             	and    %dh,0x73(%rbp)
+  8059ab:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  8059af:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  8059b6:	00 
+  8059b7:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  8059be:	00 00 
+  8059c0:	f2 07                	repnz (bad)
+  8059c2:	80 00 00             	addb   $0x0,(%rax)
+  8059c5:	00 00                	add    %al,(%rax)
+  8059c7:	00 33                	add    %dh,(%rbx)
+  8059c9:	0e                   	(bad)
+  8059ca:	80 00 00             	addb   $0x0,(%rax)
+  8059cd:	00 00                	add    %al,(%rax)
+  8059cf:	00 23                	add    %ah,(%rbx)
+  8059d1:	0e                   	(bad)
+  8059d2:	80 00 00             	addb   $0x0,(%rax)
+  8059d5:	00 00                	add    %al,(%rax)
+  8059d7:	00 33                	add    %dh,(%rbx)
+  8059d9:	0e                   	(bad)
+  8059da:	80 00 00             	addb   $0x0,(%rax)
+  8059dd:	00 00                	add    %al,(%rax)
+  8059df:	00 33                	add    %dh,(%rbx)
+  8059e1:	0e                   	(bad)
+  8059e2:	80 00 00             	addb   $0x0,(%rax)
+  8059e5:	00 00                	add    %al,(%rax)
+  8059e7:	00 33                	add    %dh,(%rbx)
+  8059e9:	0e                   	(bad)
+  8059ea:	80 00 00             	addb   $0x0,(%rax)
+  8059ed:	00 00                	add    %al,(%rax)
+  8059ef:	00 33                	add    %dh,(%rbx)
+  8059f1:	0e                   	(bad)
+  8059f2:	80 00 00             	addb   $0x0,(%rax)
+  8059f5:	00 00                	add    %al,(%rax)
+  8059f7:	00 11                	add    %dl,(%rcx)
+  8059f9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  8059ff:	00 33                	add    %dh,(%rbx)
+  805a01:	0e                   	(bad)
+  805a02:	80 00 00             	addb   $0x0,(%rax)
+  805a05:	00 00                	add    %al,(%rax)
+  805a07:	00 33                	add    %dh,(%rbx)
+  805a09:	0e                   	(bad)
+  805a0a:	80 00 00             	addb   $0x0,(%rax)
+  805a0d:	00 00                	add    %al,(%rax)
+  805a0f:	00 05 08 80 00 00    	add    %al,0x8008(%rip)        # 80da1d <__ctors_end+0x693d>
+  805a15:	00 00                	add    %al,(%rax)
+  805a17:	00 7f 08             	add    %bh,0x8(%rdi)
+  805a1a:	80 00 00             	addb   $0x0,(%rax)
+  805a1d:	00 00                	add    %al,(%rax)
+  805a1f:	00 33                	add    %dh,(%rbx)
+  805a21:	0e                   	(bad)
+  805a22:	80 00 00             	addb   $0x0,(%rax)
+  805a25:	00 00                	add    %al,(%rax)
+  805a27:	00 05 08 80 00 00    	add    %al,0x8008(%rip)        # 80da35 <__ctors_end+0x6955>
+  805a2d:	00 00                	add    %al,(%rax)
+  805a2f:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a32:	80 00 00             	addb   $0x0,(%rax)
+  805a35:	00 00                	add    %al,(%rax)
+  805a37:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a3a:	80 00 00             	addb   $0x0,(%rax)
+  805a3d:	00 00                	add    %al,(%rax)
+  805a3f:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a42:	80 00 00             	addb   $0x0,(%rax)
+  805a45:	00 00                	add    %al,(%rax)
+  805a47:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a4a:	80 00 00             	addb   $0x0,(%rax)
+  805a4d:	00 00                	add    %al,(%rax)
+  805a4f:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a52:	80 00 00             	addb   $0x0,(%rax)
+  805a55:	00 00                	add    %al,(%rax)
+  805a57:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a5a:	80 00 00             	addb   $0x0,(%rax)
+  805a5d:	00 00                	add    %al,(%rax)
+  805a5f:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a62:	80 00 00             	addb   $0x0,(%rax)
+  805a65:	00 00                	add    %al,(%rax)
+  805a67:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a6a:	80 00 00             	addb   $0x0,(%rax)
+  805a6d:	00 00                	add    %al,(%rax)
+  805a6f:	00 4b 08             	add    %cl,0x8(%rbx)
+  805a72:	80 00 00             	addb   $0x0,(%rax)
+  805a75:	00 00                	add    %al,(%rax)
+  805a77:	00 33                	add    %dh,(%rbx)
+  805a79:	0e                   	(bad)
+  805a7a:	80 00 00             	addb   $0x0,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 33                	add    %dh,(%rbx)
+  805a81:	0e                   	(bad)
+  805a82:	80 00 00             	addb   $0x0,(%rax)
+  805a85:	00 00                	add    %al,(%rax)
+  805a87:	00 33                	add    %dh,(%rbx)
+  805a89:	0e                   	(bad)
+  805a8a:	80 00 00             	addb   $0x0,(%rax)
+  805a8d:	00 00                	add    %al,(%rax)
+  805a8f:	00 33                	add    %dh,(%rbx)
+  805a91:	0e                   	(bad)
+  805a92:	80 00 00             	addb   $0x0,(%rax)
+  805a95:	00 00                	add    %al,(%rax)
+  805a97:	00 33                	add    %dh,(%rbx)
+  805a99:	0e                   	(bad)
+  805a9a:	80 00 00             	addb   $0x0,(%rax)
+  805a9d:	00 00                	add    %al,(%rax)
+  805a9f:	00 33                	add    %dh,(%rbx)
+  805aa1:	0e                   	(bad)
+  805aa2:	80 00 00             	addb   $0x0,(%rax)
+  805aa5:	00 00                	add    %al,(%rax)
+  805aa7:	00 33                	add    %dh,(%rbx)
+  805aa9:	0e                   	(bad)
+  805aaa:	80 00 00             	addb   $0x0,(%rax)
+  805aad:	00 00                	add    %al,(%rax)
+  805aaf:	00 33                	add    %dh,(%rbx)
+  805ab1:	0e                   	(bad)
+  805ab2:	80 00 00             	addb   $0x0,(%rax)
+  805ab5:	00 00                	add    %al,(%rax)
+  805ab7:	00 33                	add    %dh,(%rbx)
+  805ab9:	0e                   	(bad)
+  805aba:	80 00 00             	addb   $0x0,(%rax)
+  805abd:	00 00                	add    %al,(%rax)
+  805abf:	00 33                	add    %dh,(%rbx)
+  805ac1:	0e                   	(bad)
+  805ac2:	80 00 00             	addb   $0x0,(%rax)
+  805ac5:	00 00                	add    %al,(%rax)
+  805ac7:	00 33                	add    %dh,(%rbx)
+  805ac9:	0e                   	(bad)
+  805aca:	80 00 00             	addb   $0x0,(%rax)
+  805acd:	00 00                	add    %al,(%rax)
+  805acf:	00 33                	add    %dh,(%rbx)
+  805ad1:	0e                   	(bad)
+  805ad2:	80 00 00             	addb   $0x0,(%rax)
+  805ad5:	00 00                	add    %al,(%rax)
+  805ad7:	00 33                	add    %dh,(%rbx)
+  805ad9:	0e                   	(bad)
+  805ada:	80 00 00             	addb   $0x0,(%rax)
+  805add:	00 00                	add    %al,(%rax)
+  805adf:	00 33                	add    %dh,(%rbx)
+  805ae1:	0e                   	(bad)
+  805ae2:	80 00 00             	addb   $0x0,(%rax)
+  805ae5:	00 00                	add    %al,(%rax)
+  805ae7:	00 33                	add    %dh,(%rbx)
+  805ae9:	0e                   	(bad)
+  805aea:	80 00 00             	addb   $0x0,(%rax)
+  805aed:	00 00                	add    %al,(%rax)
+  805aef:	00 33                	add    %dh,(%rbx)
+  805af1:	0e                   	(bad)
+  805af2:	80 00 00             	addb   $0x0,(%rax)
+  805af5:	00 00                	add    %al,(%rax)
+  805af7:	00 33                	add    %dh,(%rbx)
+  805af9:	0e                   	(bad)
+  805afa:	80 00 00             	addb   $0x0,(%rax)
+  805afd:	00 00                	add    %al,(%rax)
+  805aff:	00 33                	add    %dh,(%rbx)
+  805b01:	0e                   	(bad)
+  805b02:	80 00 00             	addb   $0x0,(%rax)
+  805b05:	00 00                	add    %al,(%rax)
+  805b07:	00 33                	add    %dh,(%rbx)
+  805b09:	0e                   	(bad)
+  805b0a:	80 00 00             	addb   $0x0,(%rax)
+  805b0d:	00 00                	add    %al,(%rax)
+  805b0f:	00 33                	add    %dh,(%rbx)
+  805b11:	0e                   	(bad)
+  805b12:	80 00 00             	addb   $0x0,(%rax)
+  805b15:	00 00                	add    %al,(%rax)
+  805b17:	00 33                	add    %dh,(%rbx)
+  805b19:	0e                   	(bad)
+  805b1a:	80 00 00             	addb   $0x0,(%rax)
+  805b1d:	00 00                	add    %al,(%rax)
+  805b1f:	00 33                	add    %dh,(%rbx)
+  805b21:	0e                   	(bad)
+  805b22:	80 00 00             	addb   $0x0,(%rax)
+  805b25:	00 00                	add    %al,(%rax)
+  805b27:	00 33                	add    %dh,(%rbx)
+  805b29:	0e                   	(bad)
+  805b2a:	80 00 00             	addb   $0x0,(%rax)
+  805b2d:	00 00                	add    %al,(%rax)
+  805b2f:	00 33                	add    %dh,(%rbx)
+  805b31:	0e                   	(bad)
+  805b32:	80 00 00             	addb   $0x0,(%rax)
+  805b35:	00 00                	add    %al,(%rax)
+  805b37:	00 33                	add    %dh,(%rbx)
+  805b39:	0e                   	(bad)
+  805b3a:	80 00 00             	addb   $0x0,(%rax)
+  805b3d:	00 00                	add    %al,(%rax)
+  805b3f:	00 33                	add    %dh,(%rbx)
+  805b41:	0e                   	(bad)
+  805b42:	80 00 00             	addb   $0x0,(%rax)
+  805b45:	00 00                	add    %al,(%rax)
+  805b47:	00 33                	add    %dh,(%rbx)
+  805b49:	0e                   	(bad)
+  805b4a:	80 00 00             	addb   $0x0,(%rax)
+  805b4d:	00 00                	add    %al,(%rax)
+  805b4f:	00 33                	add    %dh,(%rbx)
+  805b51:	0e                   	(bad)
+  805b52:	80 00 00             	addb   $0x0,(%rax)
+  805b55:	00 00                	add    %al,(%rax)
+  805b57:	00 33                	add    %dh,(%rbx)
+  805b59:	0e                   	(bad)
+  805b5a:	80 00 00             	addb   $0x0,(%rax)
+  805b5d:	00 00                	add    %al,(%rax)
+  805b5f:	00 33                	add    %dh,(%rbx)
+  805b61:	0e                   	(bad)
+  805b62:	80 00 00             	addb   $0x0,(%rax)
+  805b65:	00 00                	add    %al,(%rax)
+  805b67:	00 56 0d             	add    %dl,0xd(%rsi)
+  805b6a:	80 00 00             	addb   $0x0,(%rax)
+  805b6d:	00 00                	add    %al,(%rax)
+  805b6f:	00 33                	add    %dh,(%rbx)
+  805b71:	0e                   	(bad)
+  805b72:	80 00 00             	addb   $0x0,(%rax)
+  805b75:	00 00                	add    %al,(%rax)
+  805b77:	00 33                	add    %dh,(%rbx)
+  805b79:	0e                   	(bad)
+  805b7a:	80 00 00             	addb   $0x0,(%rax)
+  805b7d:	00 00                	add    %al,(%rax)
+  805b7f:	00 33                	add    %dh,(%rbx)
+  805b81:	0e                   	(bad)
+  805b82:	80 00 00             	addb   $0x0,(%rax)
+  805b85:	00 00                	add    %al,(%rax)
+  805b87:	00 33                	add    %dh,(%rbx)
+  805b89:	0e                   	(bad)
+  805b8a:	80 00 00             	addb   $0x0,(%rax)
+  805b8d:	00 00                	add    %al,(%rax)
+  805b8f:	00 33                	add    %dh,(%rbx)
+  805b91:	0e                   	(bad)
+  805b92:	80 00 00             	addb   $0x0,(%rax)
+  805b95:	00 00                	add    %al,(%rax)
+  805b97:	00 33                	add    %dh,(%rbx)
+  805b99:	0e                   	(bad)
+  805b9a:	80 00 00             	addb   $0x0,(%rax)
+  805b9d:	00 00                	add    %al,(%rax)
+  805b9f:	00 33                	add    %dh,(%rbx)
+  805ba1:	0e                   	(bad)
+  805ba2:	80 00 00             	addb   $0x0,(%rax)
+  805ba5:	00 00                	add    %al,(%rax)
+  805ba7:	00 33                	add    %dh,(%rbx)
+  805ba9:	0e                   	(bad)
+  805baa:	80 00 00             	addb   $0x0,(%rax)
+  805bad:	00 00                	add    %al,(%rax)
+  805baf:	00 33                	add    %dh,(%rbx)
+  805bb1:	0e                   	(bad)
+  805bb2:	80 00 00             	addb   $0x0,(%rax)
+  805bb5:	00 00                	add    %al,(%rax)
+  805bb7:	00 33                	add    %dh,(%rbx)
+  805bb9:	0e                   	(bad)
+  805bba:	80 00 00             	addb   $0x0,(%rax)
+  805bbd:	00 00                	add    %al,(%rax)
+  805bbf:	00 a2 08 80 00 00    	add    %ah,0x8008(%rdx)
+  805bc5:	00 00                	add    %al,(%rax)
+  805bc7:	00 71 0a             	add    %dh,0xa(%rcx)
+  805bca:	80 00 00             	addb   $0x0,(%rax)
+  805bcd:	00 00                	add    %al,(%rax)
+  805bcf:	00 33                	add    %dh,(%rbx)
+  805bd1:	0e                   	(bad)
+  805bd2:	80 00 00             	addb   $0x0,(%rax)
+  805bd5:	00 00                	add    %al,(%rax)
+  805bd7:	00 33                	add    %dh,(%rbx)
+  805bd9:	0e                   	(bad)
+  805bda:	80 00 00             	addb   $0x0,(%rax)
+  805bdd:	00 00                	add    %al,(%rax)
+  805bdf:	00 33                	add    %dh,(%rbx)
+  805be1:	0e                   	(bad)
+  805be2:	80 00 00             	addb   $0x0,(%rax)
+  805be5:	00 00                	add    %al,(%rax)
+  805be7:	00 33                	add    %dh,(%rbx)
+  805be9:	0e                   	(bad)
+  805bea:	80 00 00             	addb   $0x0,(%rax)
+  805bed:	00 00                	add    %al,(%rax)
+  805bef:	00 d1                	add    %dl,%cl
+  805bf1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805bf7:	00 33                	add    %dh,(%rbx)
+  805bf9:	0e                   	(bad)
+  805bfa:	80 00 00             	addb   $0x0,(%rax)
+  805bfd:	00 00                	add    %al,(%rax)
+  805bff:	00 33                	add    %dh,(%rbx)
+  805c01:	0e                   	(bad)
+  805c02:	80 00 00             	addb   $0x0,(%rax)
+  805c05:	00 00                	add    %al,(%rax)
+  805c07:	00 97 08 80 00 00    	add    %dl,0x8008(%rdi)
+  805c0d:	00 00                	add    %al,(%rax)
+  805c0f:	00 33                	add    %dh,(%rbx)
+  805c11:	0e                   	(bad)
+  805c12:	80 00 00             	addb   $0x0,(%rax)
+  805c15:	00 00                	add    %al,(%rax)
+  805c17:	00 33                	add    %dh,(%rbx)
+  805c19:	0e                   	(bad)
+  805c1a:	80 00 00             	addb   $0x0,(%rax)
+  805c1d:	00 00                	add    %al,(%rax)
+  805c1f:	00 19                	add    %bl,(%rcx)
+  805c21:	0c 80                	or     $0x80,%al
+  805c23:	00 00                	add    %al,(%rax)
+  805c25:	00 00                	add    %al,(%rax)
+  805c27:	00 e3                	add    %ah,%bl
+  805c29:	0c 80                	or     $0x80,%al
+  805c2b:	00 00                	add    %al,(%rax)
+  805c2d:	00 00                	add    %al,(%rax)
+  805c2f:	00 33                	add    %dh,(%rbx)
+  805c31:	0e                   	(bad)
+  805c32:	80 00 00             	addb   $0x0,(%rax)
+  805c35:	00 00                	add    %al,(%rax)
+  805c37:	00 33                	add    %dh,(%rbx)
+  805c39:	0e                   	(bad)
+  805c3a:	80 00 00             	addb   $0x0,(%rax)
+  805c3d:	00 00                	add    %al,(%rax)
+  805c3f:	00 68 09             	add    %ch,0x9(%rax)
+  805c42:	80 00 00             	addb   $0x0,(%rax)
+  805c45:	00 00                	add    %al,(%rax)
+  805c47:	00 33                	add    %dh,(%rbx)
+  805c49:	0e                   	(bad)
+  805c4a:	80 00 00             	addb   $0x0,(%rax)
+  805c4d:	00 00                	add    %al,(%rax)
+  805c4f:	00 45 0b             	add    %al,0xb(%rbp)
+  805c52:	80 00 00             	addb   $0x0,(%rax)
+  805c55:	00 00                	add    %al,(%rax)
+  805c57:	00 33                	add    %dh,(%rbx)
+  805c59:	0e                   	(bad)
+  805c5a:	80 00 00             	addb   $0x0,(%rax)
+  805c5d:	00 00                	add    %al,(%rax)
+  805c5f:	00 33                	add    %dh,(%rbx)
+  805c61:	0e                   	(bad)
+  805c62:	80 00 00             	addb   $0x0,(%rax)
+  805c65:	00 00                	add    %al,(%rax)
+  805c67:	00 56 0d             	add    %dl,0xd(%rsi)
+  805c6a:	80 00 00             	addb   $0x0,(%rax)
+  805c6d:	00 00                	add    %al,(%rax)
+  805c6f:	00 33                	add    %dh,(%rbx)
+  805c71:	0e                   	(bad)
+  805c72:	80 00 00             	addb   $0x0,(%rax)
+  805c75:	00 00                	add    %al,(%rax)
+  805c77:	00 fb                	add    %bh,%bl
+  805c79:	07                   	(bad)
+  805c7a:	80 00 00             	addb   $0x0,(%rax)
+  805c7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805c80 <error_string>:
+	...
+  805c88:	2d 58 80 00 00 00 00 00 3f 58 80 00 00 00 00 00     -X......?X......
+  805c98:	4f 58 80 00 00 00 00 00 61 58 80 00 00 00 00 00     OX......aX......
+  805ca8:	6f 58 80 00 00 00 00 00 83 58 80 00 00 00 00 00     oX.......X......
+  805cb8:	98 58 80 00 00 00 00 00 ab 58 80 00 00 00 00 00     .X.......X......
+  805cc8:	bd 58 80 00 00 00 00 00 d1 58 80 00 00 00 00 00     .X.......X......
+  805cd8:	e1 58 80 00 00 00 00 00 f4 58 80 00 00 00 00 00     .X.......X......
+  805ce8:	0b 59 80 00 00 00 00 00 21 59 80 00 00 00 00 00     .Y......!Y......
+  805cf8:	39 59 80 00 00 00 00 00 51 59 80 00 00 00 00 00     9Y......QY......
+  805d08:	5e 59 80 00 00 00 00 00 38 5d 80 00 00 00 00 00     ^Y......8]......
+  805d18:	72 59 80 00 00 00 00 00 8a 59 80 00 00 00 00 00     rY.......Y......
+  805d28:	94 59 80 00 00 00 00 00 9e 59 80 00 00 00 00 00     .Y.......Y......
+  805d38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805d48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805d58:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805d68:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805d78:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 69 70 63     ib/syscall.c.ipc
+  805d88:	5f 73 65 6e 64 20 65 72 72 6f 72 3a 20 25 69 0a     _send error: %i.
+  805d98:	00 6c 69 62 2f 69 70 63 2e 63 00 0f 1f 44 00 00     .lib/ipc.c...D..
+  805da8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805db8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805dc8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805dd8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805de8:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805df8:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805e08:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805e18:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805e28:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e38:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805e40 <devtab>:
+  805e40:	20 70 80 00 00 00 00 00 60 70 80 00 00 00 00 00      p......`p......
+  805e50:	a0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  805e60:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  805e70:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  805e80:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  805e90:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  805ea0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  805eb0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  805ec0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  805ed0:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  805ee0:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  805ef0:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  805f00:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  805f10:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  805f20:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  805f30:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  805f40:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  805f50:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  805f60:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  805f70:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  805f80:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  805f90:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805fa0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  805fb0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  805fc0:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 66 90     c.<cons>.cons.f.
+  805fd0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805fe0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805ff0:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806000:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806010:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806020:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806030:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806040:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806050:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806060:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806070:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806080:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806090:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8060a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8060b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8060c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8060d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8060e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8060f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806100:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806110:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806120:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806130:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806140:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806150:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806160:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806170:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806180:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806190:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8061a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8061b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8061c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8061d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8061e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8061f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8062a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8062b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8062c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8062d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8062e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8062f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,8714 @@
+
+obj/user/lockbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 02 00 00       	call   800259 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+    for (int i = 0; i < NSENDS; i++)
+        ipc_send(parent, i, NULL, 0, 0);
+}
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 08          	sub    $0x8,%rsp
+    envid_t parent = sys_getenvid();
+  800036:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	41 89 c5             	mov    %eax,%r13d
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800045:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800047:	48 c1 e2 20          	shl    $0x20,%rdx
+  80004b:	89 c0                	mov    %eax,%eax
+  80004d:	48 09 c2             	or     %rax,%rdx
+  800050:	49 89 d6             	mov    %rdx,%r14
+  800053:	41 bc 08 00 00 00    	mov    $0x8,%r12d
+    int i;
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NWORKERS; i++) {
+        envid_t id = fork();
+  800059:	49 bf 36 17 80 00 00 	movabs $0x801736,%r15
+  800060:	00 00 00 
+  800063:	41 ff d7             	call   *%r15
+  800066:	89 c3                	mov    %eax,%ebx
+        if (id < 0) panic("fork: %i", id);
+  800068:	85 c0                	test   %eax,%eax
+  80006a:	0f 88 e0 00 00 00    	js     800150 <umain+0x12b>
+        if (!id) {
+  800070:	0f 84 07 01 00 00    	je     80017d <umain+0x158>
+    for (i = 0; i < NWORKERS; i++) {
+  800076:	41 83 ec 01          	sub    $0x1,%r12d
+  80007a:	75 e7                	jne    800063 <umain+0x3e>
+  80007c:	bb 08 00 00 00       	mov    $0x8,%ebx
+            return;
+        }
+    }
+
+    for (i = 0; i < NWORKERS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+  800081:	49 bc 44 19 80 00 00 	movabs $0x801944,%r12
+  800088:	00 00 00 
+  80008b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800090:	ba 00 00 00 00       	mov    $0x0,%edx
+  800095:	be 00 00 00 00       	mov    $0x0,%esi
+  80009a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80009f:	41 ff d4             	call   *%r12
+    for (i = 0; i < NWORKERS; i++)
+  8000a2:	83 eb 01             	sub    $0x1,%ebx
+  8000a5:	75 e4                	jne    80008b <umain+0x66>
+    asm volatile("rdtsc"
+  8000a7:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000a9:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ad:	89 c0                	mov    %eax,%eax
+  8000af:	48 09 c2             	or     %rax,%rdx
+    uint64_t alloc = read_tsc() - start;
+  8000b2:	4c 29 f2             	sub    %r14,%rdx
+  8000b5:	49 89 d5             	mov    %rdx,%r13
+    asm volatile("rdtsc"
+  8000b8:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ba:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000be:	89 c0                	mov    %eax,%eax
+  8000c0:	48 09 c2             	or     %rax,%rdx
+  8000c3:	49 89 d6             	mov    %rdx,%r14
+  8000c6:	bb a0 0f 00 00       	mov    $0xfa0,%ebx
+
+    start = read_tsc();
+    for (i = 0; i < NWORKERS * NSENDS; i++)
+        ipc_recv(NULL, NULL, NULL, NULL);
+  8000cb:	49 bc 44 19 80 00 00 	movabs $0x801944,%r12
+  8000d2:	00 00 00 
+  8000d5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000df:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8000e9:	41 ff d4             	call   *%r12
+    for (i = 0; i < NWORKERS * NSENDS; i++)
+  8000ec:	83 eb 01             	sub    $0x1,%ebx
+  8000ef:	75 e4                	jne    8000d5 <umain+0xb0>
+    asm volatile("rdtsc"
+  8000f1:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000f3:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000f7:	89 c0                	mov    %eax,%eax
+  8000f9:	48 09 c2             	or     %rax,%rdx
+    uint64_t ipc = read_tsc() - start;
+  8000fc:	4c 29 f2             	sub    %r14,%rdx
+
+    cprintf("lockbench: %d workers: alloc %lu Mcycles, ipc %lu Mcycles\n",
+            NWORKERS, (unsigned long)(alloc / 1000000), (unsigned long)(ipc / 1000000));
+  8000ff:	48 be db 34 b6 d7 82 	movabs $0x431bde82d7b634db,%rsi
+  800106:	de 1b 43 
+  800109:	48 89 d0             	mov    %rdx,%rax
+  80010c:	48 f7 e6             	mul    %rsi
+  80010f:	48 89 d1             	mov    %rdx,%rcx
+  800112:	48 c1 e9 12          	shr    $0x12,%rcx
+  800116:	4c 89 e8             	mov    %r13,%rax
+  800119:	48 f7 e6             	mul    %rsi
+  80011c:	48 c1 ea 12          	shr    $0x12,%rdx
+    cprintf("lockbench: %d workers: alloc %lu Mcycles, ipc %lu Mcycles\n",
+  800120:	be 08 00 00 00       	mov    $0x8,%esi
+  800125:	48 bf 08 4a 80 00 00 	movabs $0x804a08,%rdi
+  80012c:	00 00 00 
+  80012f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800134:	49 b8 7f 04 80 00 00 	movabs $0x80047f,%r8
+  80013b:	00 00 00 
+  80013e:	41 ff d0             	call   *%r8
+}
+  800141:	48 83 c4 08          	add    $0x8,%rsp
+  800145:	5b                   	pop    %rbx
+  800146:	41 5c                	pop    %r12
+  800148:	41 5d                	pop    %r13
+  80014a:	41 5e                	pop    %r14
+  80014c:	41 5f                	pop    %r15
+  80014e:	5d                   	pop    %rbp
+  80014f:	c3                   	ret
+        if (id < 0) panic("fork: %i", id);
+  800150:	89 c1                	mov    %eax,%ecx
+  800152:	48 ba d8 49 80 00 00 	movabs $0x8049d8,%rdx
+  800159:	00 00 00 
+  80015c:	be 24 00 00 00       	mov    $0x24,%esi
+  800161:	48 bf e1 49 80 00 00 	movabs $0x8049e1,%rdi
+  800168:	00 00 00 
+  80016b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800170:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  800177:	00 00 00 
+  80017a:	41 ff d0             	call   *%r8
+    for (int i = 0; i < NALLOCS; i++) {
+  80017d:	41 89 c4             	mov    %eax,%r12d
+        int res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW);
+  800180:	49 bf 03 13 80 00 00 	movabs $0x801303,%r15
+  800187:	00 00 00 
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+  80018a:	49 be a9 13 80 00 00 	movabs $0x8013a9,%r14
+  800191:	00 00 00 
+        int res = sys_alloc_region(0, UTEMP, PAGE_SIZE, PROT_RW);
+  800194:	b9 06 00 00 00       	mov    $0x6,%ecx
+  800199:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80019e:	be 00 00 40 00       	mov    $0x400000,%esi
+  8001a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001a8:	41 ff d7             	call   *%r15
+        if (res < 0) panic("sys_alloc_region: %i", res);
+  8001ab:	85 c0                	test   %eax,%eax
+  8001ad:	78 7d                	js     80022c <umain+0x207>
+        *(volatile int *)UTEMP = i;
+  8001af:	44 89 24 25 00 00 40 	mov    %r12d,0x400000
+  8001b6:	00 
+        sys_unmap_region(0, UTEMP, PAGE_SIZE);
+  8001b7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001bc:	be 00 00 40 00       	mov    $0x400000,%esi
+  8001c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001c6:	41 ff d6             	call   *%r14
+    for (int i = 0; i < NALLOCS; i++) {
+  8001c9:	41 83 c4 01          	add    $0x1,%r12d
+  8001cd:	41 81 fc d0 07 00 00 	cmp    $0x7d0,%r12d
+  8001d4:	75 be                	jne    800194 <umain+0x16f>
+    ipc_send(parent, 0, NULL, 0, 0);
+  8001d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8001dc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8001e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001eb:	44 89 ef             	mov    %r13d,%edi
+  8001ee:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8001f5:	00 00 00 
+  8001f8:	ff d0                	call   *%rax
+        ipc_send(parent, i, NULL, 0, 0);
+  8001fa:	49 bc 68 19 80 00 00 	movabs $0x801968,%r12
+  800201:	00 00 00 
+  800204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80020a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80020f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800214:	89 de                	mov    %ebx,%esi
+  800216:	44 89 ef             	mov    %r13d,%edi
+  800219:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NSENDS; i++)
+  80021c:	83 c3 01             	add    $0x1,%ebx
+  80021f:	81 fb f4 01 00 00    	cmp    $0x1f4,%ebx
+  800225:	75 dd                	jne    800204 <umain+0x1df>
+  800227:	e9 15 ff ff ff       	jmp    800141 <umain+0x11c>
+        if (res < 0) panic("sys_alloc_region: %i", res);
+  80022c:	89 c1                	mov    %eax,%ecx
+  80022e:	48 ba f2 49 80 00 00 	movabs $0x8049f2,%rdx
+  800235:	00 00 00 
+  800238:	be 11 00 00 00       	mov    $0x11,%esi
+  80023d:	48 bf e1 49 80 00 00 	movabs $0x8049e1,%rdi
+  800244:	00 00 00 
+  800247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80024c:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  800253:	00 00 00 
+  800256:	41 ff d0             	call   *%r8
+
+0000000000800259 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800259:	55                   	push   %rbp
+  80025a:	48 89 e5             	mov    %rsp,%rbp
+  80025d:	41 56                	push   %r14
+  80025f:	41 55                	push   %r13
+  800261:	41 54                	push   %r12
+  800263:	53                   	push   %rbx
+  800264:	41 89 fd             	mov    %edi,%r13d
+  800267:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80026a:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800271:	00 00 00 
+  800274:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80027b:	00 00 00 
+  80027e:	48 39 c2             	cmp    %rax,%rdx
+  800281:	73 17                	jae    80029a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800283:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800286:	49 89 c4             	mov    %rax,%r12
+  800289:	48 83 c3 08          	add    $0x8,%rbx
+  80028d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800292:	ff 53 f8             	call   *-0x8(%rbx)
+  800295:	4c 39 e3             	cmp    %r12,%rbx
+  800298:	72 ef                	jb     800289 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80029a:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  8002a1:	00 00 00 
+  8002a4:	ff d0                	call   *%rax
+  8002a6:	89 c2                	mov    %eax,%edx
+  8002a8:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8002ae:	48 89 d0             	mov    %rdx,%rax
+  8002b1:	48 c1 e0 04          	shl    $0x4,%rax
+  8002b5:	48 29 d0             	sub    %rdx,%rax
+  8002b8:	48 c1 e0 05          	shl    $0x5,%rax
+  8002bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002c3:	00 00 00 
+  8002c6:	48 01 d0             	add    %rdx,%rax
+  8002c9:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8002d0:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002d3:	45 85 ed             	test   %r13d,%r13d
+  8002d6:	7e 0d                	jle    8002e5 <libmain+0x8c>
+  8002d8:	49 8b 06             	mov    (%r14),%rax
+  8002db:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8002e2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002e5:	4c 89 f6             	mov    %r14,%rsi
+  8002e8:	44 89 ef             	mov    %r13d,%edi
+  8002eb:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002f2:	00 00 00 
+  8002f5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002f7:	48 b8 0c 03 80 00 00 	movabs $0x80030c,%rax
+  8002fe:	00 00 00 
+  800301:	ff d0                	call   *%rax
+#endif
+}
+  800303:	5b                   	pop    %rbx
+  800304:	41 5c                	pop    %r12
+  800306:	41 5d                	pop    %r13
+  800308:	41 5e                	pop    %r14
+  80030a:	5d                   	pop    %rbp
+  80030b:	c3                   	ret
+
+000000000080030c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80030c:	55                   	push   %rbp
+  80030d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800310:	48 b8 43 1c 80 00 00 	movabs $0x801c43,%rax
+  800317:	00 00 00 
+  80031a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80031c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800321:	48 b8 13 12 80 00 00 	movabs $0x801213,%rax
+  800328:	00 00 00 
+  80032b:	ff d0                	call   *%rax
+}
+  80032d:	5d                   	pop    %rbp
+  80032e:	c3                   	ret
+
+000000000080032f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80032f:	55                   	push   %rbp
+  800330:	48 89 e5             	mov    %rsp,%rbp
+  800333:	41 56                	push   %r14
+  800335:	41 55                	push   %r13
+  800337:	41 54                	push   %r12
+  800339:	53                   	push   %rbx
+  80033a:	48 83 ec 50          	sub    $0x50,%rsp
+  80033e:	49 89 fc             	mov    %rdi,%r12
+  800341:	41 89 f5             	mov    %esi,%r13d
+  800344:	48 89 d3             	mov    %rdx,%rbx
+  800347:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80034b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80034f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800353:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80035a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80035e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800362:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800366:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80036a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800371:	00 00 00 
+  800374:	4c 8b 30             	mov    (%rax),%r14
+  800377:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  80037e:	00 00 00 
+  800381:	ff d0                	call   *%rax
+  800383:	89 c6                	mov    %eax,%esi
+  800385:	45 89 e8             	mov    %r13d,%r8d
+  800388:	4c 89 e1             	mov    %r12,%rcx
+  80038b:	4c 89 f2             	mov    %r14,%rdx
+  80038e:	48 bf 50 4a 80 00 00 	movabs $0x804a50,%rdi
+  800395:	00 00 00 
+  800398:	b8 00 00 00 00       	mov    $0x0,%eax
+  80039d:	49 bc 7f 04 80 00 00 	movabs $0x80047f,%r12
+  8003a4:	00 00 00 
+  8003a7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8003aa:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8003ae:	48 89 df             	mov    %rbx,%rdi
+  8003b1:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  8003b8:	00 00 00 
+  8003bb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003bd:	48 bf ab 50 80 00 00 	movabs $0x8050ab,%rdi
+  8003c4:	00 00 00 
+  8003c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003cc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003cf:	cc                   	int3
+  8003d0:	eb fd                	jmp    8003cf <_panic+0xa0>
+
+00000000008003d2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003d2:	55                   	push   %rbp
+  8003d3:	48 89 e5             	mov    %rsp,%rbp
+  8003d6:	53                   	push   %rbx
+  8003d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8003db:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003de:	8b 06                	mov    (%rsi),%eax
+  8003e0:	8d 50 01             	lea    0x1(%rax),%edx
+  8003e3:	89 16                	mov    %edx,(%rsi)
+  8003e5:	48 98                	cltq
+  8003e7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003ec:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003f2:	74 0a                	je     8003fe <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003f4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003fc:	c9                   	leave
+  8003fd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003fe:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800402:	be ff 00 00 00       	mov    $0xff,%esi
+  800407:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  80040e:	00 00 00 
+  800411:	ff d0                	call   *%rax
+        state->offset = 0;
+  800413:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800419:	eb d9                	jmp    8003f4 <putch+0x22>
+
+000000000080041b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80041b:	55                   	push   %rbp
+  80041c:	48 89 e5             	mov    %rsp,%rbp
+  80041f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800426:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800429:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800430:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800435:	b8 00 00 00 00       	mov    $0x0,%eax
+  80043a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80043d:	48 89 f1             	mov    %rsi,%rcx
+  800440:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800447:	48 bf d2 03 80 00 00 	movabs $0x8003d2,%rdi
+  80044e:	00 00 00 
+  800451:	48 b8 cf 05 80 00 00 	movabs $0x8005cf,%rax
+  800458:	00 00 00 
+  80045b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80045d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800464:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80046b:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  800472:	00 00 00 
+  800475:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800477:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80047d:	c9                   	leave
+  80047e:	c3                   	ret
+
+000000000080047f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80047f:	55                   	push   %rbp
+  800480:	48 89 e5             	mov    %rsp,%rbp
+  800483:	48 83 ec 50          	sub    $0x50,%rsp
+  800487:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80048b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80048f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800493:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800497:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80049b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8004a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8004b2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8004b6:	48 b8 1b 04 80 00 00 	movabs $0x80041b,%rax
+  8004bd:	00 00 00 
+  8004c0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004c2:	c9                   	leave
+  8004c3:	c3                   	ret
+
+00000000008004c4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004c4:	55                   	push   %rbp
+  8004c5:	48 89 e5             	mov    %rsp,%rbp
+  8004c8:	41 57                	push   %r15
+  8004ca:	41 56                	push   %r14
+  8004cc:	41 55                	push   %r13
+  8004ce:	41 54                	push   %r12
+  8004d0:	53                   	push   %rbx
+  8004d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8004d5:	49 89 fc             	mov    %rdi,%r12
+  8004d8:	49 89 f5             	mov    %rsi,%r13
+  8004db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004df:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004e2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004e5:	41 89 cf             	mov    %ecx,%r15d
+  8004e8:	4c 39 fa             	cmp    %r15,%rdx
+  8004eb:	73 5b                	jae    800548 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004ed:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004f1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004f5:	85 db                	test   %ebx,%ebx
+  8004f7:	7e 0e                	jle    800507 <print_num+0x43>
+            putch(padc, put_arg);
+  8004f9:	4c 89 ee             	mov    %r13,%rsi
+  8004fc:	44 89 f7             	mov    %r14d,%edi
+  8004ff:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800502:	83 eb 01             	sub    $0x1,%ebx
+  800505:	75 f2                	jne    8004f9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800507:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80050b:	48 b9 84 4a 80 00 00 	movabs $0x804a84,%rcx
+  800512:	00 00 00 
+  800515:	48 b8 73 4a 80 00 00 	movabs $0x804a73,%rax
+  80051c:	00 00 00 
+  80051f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800523:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800527:	ba 00 00 00 00       	mov    $0x0,%edx
+  80052c:	49 f7 f7             	div    %r15
+  80052f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800533:	4c 89 ee             	mov    %r13,%rsi
+  800536:	41 ff d4             	call   *%r12
+}
+  800539:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80053d:	5b                   	pop    %rbx
+  80053e:	41 5c                	pop    %r12
+  800540:	41 5d                	pop    %r13
+  800542:	41 5e                	pop    %r14
+  800544:	41 5f                	pop    %r15
+  800546:	5d                   	pop    %rbp
+  800547:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800548:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80054c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800551:	49 f7 f7             	div    %r15
+  800554:	48 83 ec 08          	sub    $0x8,%rsp
+  800558:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80055c:	52                   	push   %rdx
+  80055d:	45 0f be c9          	movsbl %r9b,%r9d
+  800561:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800565:	48 89 c2             	mov    %rax,%rdx
+  800568:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  80056f:	00 00 00 
+  800572:	ff d0                	call   *%rax
+  800574:	48 83 c4 10          	add    $0x10,%rsp
+  800578:	eb 8d                	jmp    800507 <print_num+0x43>
+
+000000000080057a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80057a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80057e:	48 8b 06             	mov    (%rsi),%rax
+  800581:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800585:	73 0a                	jae    800591 <sprintputch+0x17>
+        *state->start++ = ch;
+  800587:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80058b:	48 89 16             	mov    %rdx,(%rsi)
+  80058e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800591:	c3                   	ret
+
+0000000000800592 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800592:	55                   	push   %rbp
+  800593:	48 89 e5             	mov    %rsp,%rbp
+  800596:	48 83 ec 50          	sub    $0x50,%rsp
+  80059a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80059e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8005a6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8005ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005bd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005c1:	48 b8 cf 05 80 00 00 	movabs $0x8005cf,%rax
+  8005c8:	00 00 00 
+  8005cb:	ff d0                	call   *%rax
+}
+  8005cd:	c9                   	leave
+  8005ce:	c3                   	ret
+
+00000000008005cf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005cf:	55                   	push   %rbp
+  8005d0:	48 89 e5             	mov    %rsp,%rbp
+  8005d3:	41 57                	push   %r15
+  8005d5:	41 56                	push   %r14
+  8005d7:	41 55                	push   %r13
+  8005d9:	41 54                	push   %r12
+  8005db:	53                   	push   %rbx
+  8005dc:	48 83 ec 38          	sub    $0x38,%rsp
+  8005e0:	49 89 fe             	mov    %rdi,%r14
+  8005e3:	49 89 f5             	mov    %rsi,%r13
+  8005e6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005e9:	48 8b 01             	mov    (%rcx),%rax
+  8005ec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005f0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800600:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800604:	0f b6 3b             	movzbl (%rbx),%edi
+  800607:	40 80 ff 25          	cmp    $0x25,%dil
+  80060b:	74 18                	je     800625 <vprintfmt+0x56>
+            if (!ch) return;
+  80060d:	40 84 ff             	test   %dil,%dil
+  800610:	0f 84 b1 06 00 00    	je     800cc7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800616:	40 0f b6 ff          	movzbl %dil,%edi
+  80061a:	4c 89 ee             	mov    %r13,%rsi
+  80061d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800620:	4c 89 e3             	mov    %r12,%rbx
+  800623:	eb db                	jmp    800600 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800625:	be 00 00 00 00       	mov    $0x0,%esi
+  80062a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80062e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800633:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800639:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800640:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800644:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800649:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80064e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800651:	83 e8 23             	sub    $0x23,%eax
+  800654:	3c 57                	cmp    $0x57,%al
+  800656:	0f 87 51 06 00 00    	ja     800cad <vprintfmt+0x6de>
+  80065c:	0f b6 c0             	movzbl %al,%eax
+  80065f:	48 b9 40 4c 80 00 00 	movabs $0x804c40,%rcx
+  800666:	00 00 00 
+  800669:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80066c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80066f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800673:	eb cf                	jmp    800644 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800675:	49 89 dc             	mov    %rbx,%r12
+  800678:	be 01 00 00 00       	mov    $0x1,%esi
+  80067d:	eb c5                	jmp    800644 <vprintfmt+0x75>
+            padc = ch;
+  80067f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800683:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800686:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800689:	eb b9                	jmp    800644 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80068b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80068e:	83 f8 2f             	cmp    $0x2f,%eax
+  800691:	77 24                	ja     8006b7 <vprintfmt+0xe8>
+  800693:	89 c1                	mov    %eax,%ecx
+  800695:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800699:	83 c0 08             	add    $0x8,%eax
+  80069c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80069f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8006a2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8006a5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a9:	79 99                	jns    800644 <vprintfmt+0x75>
+                width = precision;
+  8006ab:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8006af:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8006b5:	eb 8d                	jmp    800644 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8006b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8006bb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006c3:	eb da                	jmp    80069f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006c5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006ca:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006ce:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006d4:	3c 39                	cmp    $0x39,%al
+  8006d6:	77 1c                	ja     8006f4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006d8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006dc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006e0:	0f b6 c0             	movzbl %al,%eax
+  8006e3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006e8:	0f b6 03             	movzbl (%rbx),%eax
+  8006eb:	3c 39                	cmp    $0x39,%al
+  8006ed:	76 e9                	jbe    8006d8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006ef:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006f2:	eb b1                	jmp    8006a5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006f4:	49 89 dc             	mov    %rbx,%r12
+  8006f7:	eb ac                	jmp    8006a5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006f9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006fc:	85 c9                	test   %ecx,%ecx
+  8006fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800703:	0f 49 c1             	cmovns %ecx,%eax
+  800706:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800709:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80070c:	e9 33 ff ff ff       	jmp    800644 <vprintfmt+0x75>
+            lflag++;
+  800711:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800714:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800717:	e9 28 ff ff ff       	jmp    800644 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80071c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80071f:	83 f8 2f             	cmp    $0x2f,%eax
+  800722:	77 19                	ja     80073d <vprintfmt+0x16e>
+  800724:	89 c2                	mov    %eax,%edx
+  800726:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80072a:	83 c0 08             	add    $0x8,%eax
+  80072d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800730:	8b 3a                	mov    (%rdx),%edi
+  800732:	4c 89 ee             	mov    %r13,%rsi
+  800735:	41 ff d6             	call   *%r14
+            break;
+  800738:	e9 c3 fe ff ff       	jmp    800600 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80073d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800741:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800745:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800749:	eb e5                	jmp    800730 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80074b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80074e:	83 f8 2f             	cmp    $0x2f,%eax
+  800751:	77 5a                	ja     8007ad <vprintfmt+0x1de>
+  800753:	89 c2                	mov    %eax,%edx
+  800755:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800759:	83 c0 08             	add    $0x8,%eax
+  80075c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80075f:	8b 02                	mov    (%rdx),%eax
+  800761:	89 c1                	mov    %eax,%ecx
+  800763:	f7 d9                	neg    %ecx
+  800765:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800768:	83 f9 16             	cmp    $0x16,%ecx
+  80076b:	7f 4e                	jg     8007bb <vprintfmt+0x1ec>
+  80076d:	48 63 c1             	movslq %ecx,%rax
+  800770:	48 ba 00 4f 80 00 00 	movabs $0x804f00,%rdx
+  800777:	00 00 00 
+  80077a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80077e:	48 85 c0             	test   %rax,%rax
+  800781:	74 38                	je     8007bb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800783:	48 89 c1             	mov    %rax,%rcx
+  800786:	48 ba 19 51 80 00 00 	movabs $0x805119,%rdx
+  80078d:	00 00 00 
+  800790:	4c 89 ee             	mov    %r13,%rsi
+  800793:	4c 89 f7             	mov    %r14,%rdi
+  800796:	b8 00 00 00 00       	mov    $0x0,%eax
+  80079b:	49 b8 92 05 80 00 00 	movabs $0x800592,%r8
+  8007a2:	00 00 00 
+  8007a5:	41 ff d0             	call   *%r8
+  8007a8:	e9 53 fe ff ff       	jmp    800600 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8007ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b9:	eb a4                	jmp    80075f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8007bb:	48 ba 9c 4a 80 00 00 	movabs $0x804a9c,%rdx
+  8007c2:	00 00 00 
+  8007c5:	4c 89 ee             	mov    %r13,%rsi
+  8007c8:	4c 89 f7             	mov    %r14,%rdi
+  8007cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007d0:	49 b8 92 05 80 00 00 	movabs $0x800592,%r8
+  8007d7:	00 00 00 
+  8007da:	41 ff d0             	call   *%r8
+  8007dd:	e9 1e fe ff ff       	jmp    800600 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e8:	77 6c                	ja     800856 <vprintfmt+0x287>
+  8007ea:	89 c2                	mov    %eax,%edx
+  8007ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f0:	83 c0 08             	add    $0x8,%eax
+  8007f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007f9:	48 85 d2             	test   %rdx,%rdx
+  8007fc:	48 b8 95 4a 80 00 00 	movabs $0x804a95,%rax
+  800803:	00 00 00 
+  800806:	48 0f 45 c2          	cmovne %rdx,%rax
+  80080a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80080e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800812:	7e 06                	jle    80081a <vprintfmt+0x24b>
+  800814:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800818:	75 4a                	jne    800864 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80081a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80081e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800822:	0f b6 00             	movzbl (%rax),%eax
+  800825:	84 c0                	test   %al,%al
+  800827:	0f 85 9a 00 00 00    	jne    8008c7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80082d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800830:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800834:	85 c0                	test   %eax,%eax
+  800836:	0f 8e c4 fd ff ff    	jle    800600 <vprintfmt+0x31>
+  80083c:	4c 89 ee             	mov    %r13,%rsi
+  80083f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800844:	41 ff d6             	call   *%r14
+  800847:	41 83 ec 01          	sub    $0x1,%r12d
+  80084b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80084f:	75 eb                	jne    80083c <vprintfmt+0x26d>
+  800851:	e9 aa fd ff ff       	jmp    800600 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800856:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80085e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800862:	eb 92                	jmp    8007f6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800864:	49 63 f7             	movslq %r15d,%rsi
+  800867:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80086b:	48 b8 81 0d 80 00 00 	movabs $0x800d81,%rax
+  800872:	00 00 00 
+  800875:	ff d0                	call   *%rax
+  800877:	48 89 c2             	mov    %rax,%rdx
+  80087a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80087d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80087f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800882:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800885:	85 c0                	test   %eax,%eax
+  800887:	7e 91                	jle    80081a <vprintfmt+0x24b>
+  800889:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80088e:	4c 89 ee             	mov    %r13,%rsi
+  800891:	44 89 e7             	mov    %r12d,%edi
+  800894:	41 ff d6             	call   *%r14
+  800897:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80089b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80089e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8008a1:	75 eb                	jne    80088e <vprintfmt+0x2bf>
+  8008a3:	e9 72 ff ff ff       	jmp    80081a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008a8:	0f b6 f8             	movzbl %al,%edi
+  8008ab:	4c 89 ee             	mov    %r13,%rsi
+  8008ae:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8008b1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8008b5:	49 83 c4 01          	add    $0x1,%r12
+  8008b9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008bf:	84 c0                	test   %al,%al
+  8008c1:	0f 84 66 ff ff ff    	je     80082d <vprintfmt+0x25e>
+  8008c7:	45 85 ff             	test   %r15d,%r15d
+  8008ca:	78 0a                	js     8008d6 <vprintfmt+0x307>
+  8008cc:	41 83 ef 01          	sub    $0x1,%r15d
+  8008d0:	0f 88 57 ff ff ff    	js     80082d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008d6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008da:	74 cc                	je     8008a8 <vprintfmt+0x2d9>
+  8008dc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008df:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008e4:	80 fa 5e             	cmp    $0x5e,%dl
+  8008e7:	77 c2                	ja     8008ab <vprintfmt+0x2dc>
+  8008e9:	eb bd                	jmp    8008a8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008eb:	40 84 f6             	test   %sil,%sil
+  8008ee:	75 26                	jne    800916 <vprintfmt+0x347>
+    switch (lflag) {
+  8008f0:	85 d2                	test   %edx,%edx
+  8008f2:	74 59                	je     80094d <vprintfmt+0x37e>
+  8008f4:	83 fa 01             	cmp    $0x1,%edx
+  8008f7:	74 7b                	je     800974 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	0f 87 96 00 00 00    	ja     80099b <vprintfmt+0x3cc>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	4c 8b 22             	mov    (%rdx),%r12
+  800914:	eb 17                	jmp    80092d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800916:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800919:	83 f8 2f             	cmp    $0x2f,%eax
+  80091c:	77 21                	ja     80093f <vprintfmt+0x370>
+  80091e:	89 c2                	mov    %eax,%edx
+  800920:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800924:	83 c0 08             	add    $0x8,%eax
+  800927:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80092d:	4d 85 e4             	test   %r12,%r12
+  800930:	78 7a                	js     8009ac <vprintfmt+0x3dd>
+            num = i;
+  800932:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800935:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80093a:	e9 50 02 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80093f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800943:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800947:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80094b:	eb dd                	jmp    80092a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80094d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800950:	83 f8 2f             	cmp    $0x2f,%eax
+  800953:	77 11                	ja     800966 <vprintfmt+0x397>
+  800955:	89 c2                	mov    %eax,%edx
+  800957:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80095b:	83 c0 08             	add    $0x8,%eax
+  80095e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800961:	4c 63 22             	movslq (%rdx),%r12
+  800964:	eb c7                	jmp    80092d <vprintfmt+0x35e>
+  800966:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80096a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80096e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800972:	eb ed                	jmp    800961 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800974:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800977:	83 f8 2f             	cmp    $0x2f,%eax
+  80097a:	77 11                	ja     80098d <vprintfmt+0x3be>
+  80097c:	89 c2                	mov    %eax,%edx
+  80097e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800982:	83 c0 08             	add    $0x8,%eax
+  800985:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800988:	4c 8b 22             	mov    (%rdx),%r12
+  80098b:	eb a0                	jmp    80092d <vprintfmt+0x35e>
+  80098d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800991:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800995:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800999:	eb ed                	jmp    800988 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80099b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80099f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009a7:	e9 65 ff ff ff       	jmp    800911 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8009ac:	4c 89 ee             	mov    %r13,%rsi
+  8009af:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8009b4:	41 ff d6             	call   *%r14
+                i = -i;
+  8009b7:	49 f7 dc             	neg    %r12
+  8009ba:	e9 73 ff ff ff       	jmp    800932 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009bf:	40 84 f6             	test   %sil,%sil
+  8009c2:	75 32                	jne    8009f6 <vprintfmt+0x427>
+    switch (lflag) {
+  8009c4:	85 d2                	test   %edx,%edx
+  8009c6:	74 5d                	je     800a25 <vprintfmt+0x456>
+  8009c8:	83 fa 01             	cmp    $0x1,%edx
+  8009cb:	0f 84 82 00 00 00    	je     800a53 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d7:	0f 87 a5 00 00 00    	ja     800a82 <vprintfmt+0x4b3>
+  8009dd:	89 c2                	mov    %eax,%edx
+  8009df:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e3:	83 c0 08             	add    $0x8,%eax
+  8009e6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009e9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009ec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f1:	e9 99 01 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009f9:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fc:	77 19                	ja     800a17 <vprintfmt+0x448>
+  8009fe:	89 c2                	mov    %eax,%edx
+  800a00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a04:	83 c0 08             	add    $0x8,%eax
+  800a07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a12:	e9 78 01 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+  800a17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a23:	eb e5                	jmp    800a0a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a28:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2b:	77 18                	ja     800a45 <vprintfmt+0x476>
+  800a2d:	89 c2                	mov    %eax,%edx
+  800a2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a33:	83 c0 08             	add    $0x8,%eax
+  800a36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a39:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a40:	e9 4a 01 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+  800a45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a51:	eb e6                	jmp    800a39 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a56:	83 f8 2f             	cmp    $0x2f,%eax
+  800a59:	77 19                	ja     800a74 <vprintfmt+0x4a5>
+  800a5b:	89 c2                	mov    %eax,%edx
+  800a5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a61:	83 c0 08             	add    $0x8,%eax
+  800a64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a67:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a6f:	e9 1b 01 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+  800a74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a80:	eb e5                	jmp    800a67 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8e:	e9 56 ff ff ff       	jmp    8009e9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a93:	40 84 f6             	test   %sil,%sil
+  800a96:	75 2e                	jne    800ac6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a98:	85 d2                	test   %edx,%edx
+  800a9a:	74 59                	je     800af5 <vprintfmt+0x526>
+  800a9c:	83 fa 01             	cmp    $0x1,%edx
+  800a9f:	74 7f                	je     800b20 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	0f 87 9f 00 00 00    	ja     800b4c <vprintfmt+0x57d>
+  800aad:	89 c2                	mov    %eax,%edx
+  800aaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab3:	83 c0 08             	add    $0x8,%eax
+  800ab6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800abc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ac1:	e9 c9 00 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac9:	83 f8 2f             	cmp    $0x2f,%eax
+  800acc:	77 19                	ja     800ae7 <vprintfmt+0x518>
+  800ace:	89 c2                	mov    %eax,%edx
+  800ad0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad4:	83 c0 08             	add    $0x8,%eax
+  800ad7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ada:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800add:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ae2:	e9 a8 00 00 00       	jmp    800b8f <vprintfmt+0x5c0>
+  800ae7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aeb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af3:	eb e5                	jmp    800ada <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800af5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af8:	83 f8 2f             	cmp    $0x2f,%eax
+  800afb:	77 15                	ja     800b12 <vprintfmt+0x543>
+  800afd:	89 c2                	mov    %eax,%edx
+  800aff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b03:	83 c0 08             	add    $0x8,%eax
+  800b06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b09:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800b0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800b10:	eb 7d                	jmp    800b8f <vprintfmt+0x5c0>
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb e9                	jmp    800b09 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b23:	83 f8 2f             	cmp    $0x2f,%eax
+  800b26:	77 16                	ja     800b3e <vprintfmt+0x56f>
+  800b28:	89 c2                	mov    %eax,%edx
+  800b2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b2e:	83 c0 08             	add    $0x8,%eax
+  800b31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b37:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b3c:	eb 51                	jmp    800b8f <vprintfmt+0x5c0>
+  800b3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b4a:	eb e8                	jmp    800b34 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b58:	e9 5c ff ff ff       	jmp    800ab9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b5d:	4c 89 ee             	mov    %r13,%rsi
+  800b60:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b65:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b68:	4c 89 ee             	mov    %r13,%rsi
+  800b6b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b70:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b76:	83 f8 2f             	cmp    $0x2f,%eax
+  800b79:	77 47                	ja     800bc2 <vprintfmt+0x5f3>
+  800b7b:	89 c2                	mov    %eax,%edx
+  800b7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b81:	83 c0 08             	add    $0x8,%eax
+  800b84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b8f:	48 83 ec 08          	sub    $0x8,%rsp
+  800b93:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b97:	0f 94 c0             	sete   %al
+  800b9a:	0f b6 c0             	movzbl %al,%eax
+  800b9d:	50                   	push   %rax
+  800b9e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ba3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ba7:	4c 89 ee             	mov    %r13,%rsi
+  800baa:	4c 89 f7             	mov    %r14,%rdi
+  800bad:	48 b8 c4 04 80 00 00 	movabs $0x8004c4,%rax
+  800bb4:	00 00 00 
+  800bb7:	ff d0                	call   *%rax
+            break;
+  800bb9:	48 83 c4 10          	add    $0x10,%rsp
+  800bbd:	e9 3e fa ff ff       	jmp    800600 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800bc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bce:	eb b7                	jmp    800b87 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd0:	40 84 f6             	test   %sil,%sil
+  800bd3:	75 2b                	jne    800c00 <vprintfmt+0x631>
+    switch (lflag) {
+  800bd5:	85 d2                	test   %edx,%edx
+  800bd7:	74 56                	je     800c2f <vprintfmt+0x660>
+  800bd9:	83 fa 01             	cmp    $0x1,%edx
+  800bdc:	74 7f                	je     800c5d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be1:	83 f8 2f             	cmp    $0x2f,%eax
+  800be4:	0f 87 a2 00 00 00    	ja     800c8c <vprintfmt+0x6bd>
+  800bea:	89 c2                	mov    %eax,%edx
+  800bec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf0:	83 c0 08             	add    $0x8,%eax
+  800bf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bf9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bfe:	eb 8f                	jmp    800b8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c03:	83 f8 2f             	cmp    $0x2f,%eax
+  800c06:	77 19                	ja     800c21 <vprintfmt+0x652>
+  800c08:	89 c2                	mov    %eax,%edx
+  800c0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0e:	83 c0 08             	add    $0x8,%eax
+  800c11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c17:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c1c:	e9 6e ff ff ff       	jmp    800b8f <vprintfmt+0x5c0>
+  800c21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2d:	eb e5                	jmp    800c14 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c32:	83 f8 2f             	cmp    $0x2f,%eax
+  800c35:	77 18                	ja     800c4f <vprintfmt+0x680>
+  800c37:	89 c2                	mov    %eax,%edx
+  800c39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c3d:	83 c0 08             	add    $0x8,%eax
+  800c40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c43:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c4a:	e9 40 ff ff ff       	jmp    800b8f <vprintfmt+0x5c0>
+  800c4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c5b:	eb e6                	jmp    800c43 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c60:	83 f8 2f             	cmp    $0x2f,%eax
+  800c63:	77 19                	ja     800c7e <vprintfmt+0x6af>
+  800c65:	89 c2                	mov    %eax,%edx
+  800c67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c6b:	83 c0 08             	add    $0x8,%eax
+  800c6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c79:	e9 11 ff ff ff       	jmp    800b8f <vprintfmt+0x5c0>
+  800c7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c8a:	eb e5                	jmp    800c71 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c98:	e9 59 ff ff ff       	jmp    800bf6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c9d:	4c 89 ee             	mov    %r13,%rsi
+  800ca0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800ca5:	41 ff d6             	call   *%r14
+            break;
+  800ca8:	e9 53 f9 ff ff       	jmp    800600 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800cad:	4c 89 ee             	mov    %r13,%rsi
+  800cb0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800cb5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800cb8:	48 83 eb 01          	sub    $0x1,%rbx
+  800cbc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800cc0:	75 f6                	jne    800cb8 <vprintfmt+0x6e9>
+  800cc2:	e9 39 f9 ff ff       	jmp    800600 <vprintfmt+0x31>
+}
+  800cc7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800ccb:	5b                   	pop    %rbx
+  800ccc:	41 5c                	pop    %r12
+  800cce:	41 5d                	pop    %r13
+  800cd0:	41 5e                	pop    %r14
+  800cd2:	41 5f                	pop    %r15
+  800cd4:	5d                   	pop    %rbp
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cd6:	55                   	push   %rbp
+  800cd7:	48 89 e5             	mov    %rsp,%rbp
+  800cda:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ce2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ce7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ceb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cf2:	48 85 ff             	test   %rdi,%rdi
+  800cf5:	74 2b                	je     800d22 <vsnprintf+0x4c>
+  800cf7:	48 85 f6             	test   %rsi,%rsi
+  800cfa:	74 26                	je     800d22 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cfc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800d00:	48 bf 7a 05 80 00 00 	movabs $0x80057a,%rdi
+  800d07:	00 00 00 
+  800d0a:	48 b8 cf 05 80 00 00 	movabs $0x8005cf,%rax
+  800d11:	00 00 00 
+  800d14:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800d16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800d1a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d20:	c9                   	leave
+  800d21:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d27:	eb f7                	jmp    800d20 <vsnprintf+0x4a>
+
+0000000000800d29 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d29:	55                   	push   %rbp
+  800d2a:	48 89 e5             	mov    %rsp,%rbp
+  800d2d:	48 83 ec 50          	sub    $0x50,%rsp
+  800d31:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d35:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d39:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d3d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d44:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d4c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d50:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d54:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d58:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800d5f:	00 00 00 
+  800d62:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d64:	c9                   	leave
+  800d65:	c3                   	ret
+
+0000000000800d66 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d66:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d69:	74 10                	je     800d7b <strlen+0x15>
+    size_t n = 0;
+  800d6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d70:	48 83 c0 01          	add    $0x1,%rax
+  800d74:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d78:	75 f6                	jne    800d70 <strlen+0xa>
+  800d7a:	c3                   	ret
+    size_t n = 0;
+  800d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d80:	c3                   	ret
+
+0000000000800d81 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d81:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d84:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d89:	48 85 f6             	test   %rsi,%rsi
+  800d8c:	74 11                	je     800d9f <strnlen+0x1e>
+  800d8e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d92:	74 0c                	je     800da0 <strnlen+0x1f>
+  800d94:	48 83 c2 01          	add    $0x1,%rdx
+  800d98:	48 39 d0             	cmp    %rdx,%rax
+  800d9b:	75 f1                	jne    800d8e <strnlen+0xd>
+  800d9d:	eb 04                	jmp    800da3 <strnlen+0x22>
+  800d9f:	c3                   	ret
+  800da0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800da3:	c3                   	ret
+
+0000000000800da4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800da4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800da7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800dac:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800db0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800db3:	48 83 c2 01          	add    $0x1,%rdx
+  800db7:	84 c9                	test   %cl,%cl
+  800db9:	75 f1                	jne    800dac <strcpy+0x8>
+        ;
+    return res;
+}
+  800dbb:	c3                   	ret
+
+0000000000800dbc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800dbc:	55                   	push   %rbp
+  800dbd:	48 89 e5             	mov    %rsp,%rbp
+  800dc0:	41 54                	push   %r12
+  800dc2:	53                   	push   %rbx
+  800dc3:	48 89 fb             	mov    %rdi,%rbx
+  800dc6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800dc9:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  800dd0:	00 00 00 
+  800dd3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800dd5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800dd9:	4c 89 e6             	mov    %r12,%rsi
+  800ddc:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  800de3:	00 00 00 
+  800de6:	ff d0                	call   *%rax
+    return dst;
+}
+  800de8:	48 89 d8             	mov    %rbx,%rax
+  800deb:	5b                   	pop    %rbx
+  800dec:	41 5c                	pop    %r12
+  800dee:	5d                   	pop    %rbp
+  800def:	c3                   	ret
+
+0000000000800df0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800df0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800df3:	48 85 d2             	test   %rdx,%rdx
+  800df6:	74 1f                	je     800e17 <strncpy+0x27>
+  800df8:	48 01 fa             	add    %rdi,%rdx
+  800dfb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800dfe:	48 83 c1 01          	add    $0x1,%rcx
+  800e02:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800e06:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800e0a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800e0e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800e12:	48 39 ca             	cmp    %rcx,%rdx
+  800e15:	75 e7                	jne    800dfe <strncpy+0xe>
+    }
+    return ret;
+}
+  800e17:	c3                   	ret
+
+0000000000800e18 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800e18:	48 89 f8             	mov    %rdi,%rax
+  800e1b:	48 85 d2             	test   %rdx,%rdx
+  800e1e:	74 24                	je     800e44 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e20:	48 83 ea 01          	sub    $0x1,%rdx
+  800e24:	74 1b                	je     800e41 <strlcpy+0x29>
+  800e26:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e2a:	0f b6 16             	movzbl (%rsi),%edx
+  800e2d:	84 d2                	test   %dl,%dl
+  800e2f:	74 10                	je     800e41 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e31:	48 83 c6 01          	add    $0x1,%rsi
+  800e35:	48 83 c0 01          	add    $0x1,%rax
+  800e39:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e3c:	48 39 c8             	cmp    %rcx,%rax
+  800e3f:	75 e9                	jne    800e2a <strlcpy+0x12>
+        *dst = '\0';
+  800e41:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e44:	48 29 f8             	sub    %rdi,%rax
+}
+  800e47:	c3                   	ret
+
+0000000000800e48 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e48:	0f b6 07             	movzbl (%rdi),%eax
+  800e4b:	84 c0                	test   %al,%al
+  800e4d:	74 13                	je     800e62 <strcmp+0x1a>
+  800e4f:	38 06                	cmp    %al,(%rsi)
+  800e51:	75 0f                	jne    800e62 <strcmp+0x1a>
+  800e53:	48 83 c7 01          	add    $0x1,%rdi
+  800e57:	48 83 c6 01          	add    $0x1,%rsi
+  800e5b:	0f b6 07             	movzbl (%rdi),%eax
+  800e5e:	84 c0                	test   %al,%al
+  800e60:	75 ed                	jne    800e4f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e62:	0f b6 c0             	movzbl %al,%eax
+  800e65:	0f b6 16             	movzbl (%rsi),%edx
+  800e68:	29 d0                	sub    %edx,%eax
+}
+  800e6a:	c3                   	ret
+
+0000000000800e6b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e6b:	48 85 d2             	test   %rdx,%rdx
+  800e6e:	74 1f                	je     800e8f <strncmp+0x24>
+  800e70:	0f b6 07             	movzbl (%rdi),%eax
+  800e73:	84 c0                	test   %al,%al
+  800e75:	74 1e                	je     800e95 <strncmp+0x2a>
+  800e77:	3a 06                	cmp    (%rsi),%al
+  800e79:	75 1a                	jne    800e95 <strncmp+0x2a>
+  800e7b:	48 83 c7 01          	add    $0x1,%rdi
+  800e7f:	48 83 c6 01          	add    $0x1,%rsi
+  800e83:	48 83 ea 01          	sub    $0x1,%rdx
+  800e87:	75 e7                	jne    800e70 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e8e:	c3                   	ret
+  800e8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e94:	c3                   	ret
+  800e95:	48 85 d2             	test   %rdx,%rdx
+  800e98:	74 09                	je     800ea3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e9a:	0f b6 07             	movzbl (%rdi),%eax
+  800e9d:	0f b6 16             	movzbl (%rsi),%edx
+  800ea0:	29 d0                	sub    %edx,%eax
+  800ea2:	c3                   	ret
+    if (!n) return 0;
+  800ea3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ea8:	c3                   	ret
+
+0000000000800ea9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ea9:	0f b6 17             	movzbl (%rdi),%edx
+  800eac:	84 d2                	test   %dl,%dl
+  800eae:	74 18                	je     800ec8 <strchr+0x1f>
+        if (*str == c) {
+  800eb0:	0f be d2             	movsbl %dl,%edx
+  800eb3:	39 f2                	cmp    %esi,%edx
+  800eb5:	74 17                	je     800ece <strchr+0x25>
+    for (; *str; str++) {
+  800eb7:	48 83 c7 01          	add    $0x1,%rdi
+  800ebb:	0f b6 17             	movzbl (%rdi),%edx
+  800ebe:	84 d2                	test   %dl,%dl
+  800ec0:	75 ee                	jne    800eb0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ec2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ec7:	c3                   	ret
+  800ec8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ecd:	c3                   	ret
+  800ece:	48 89 f8             	mov    %rdi,%rax
+}
+  800ed1:	c3                   	ret
+
+0000000000800ed2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800ed2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ed5:	0f b6 17             	movzbl (%rdi),%edx
+  800ed8:	84 d2                	test   %dl,%dl
+  800eda:	74 13                	je     800eef <strfind+0x1d>
+  800edc:	0f be d2             	movsbl %dl,%edx
+  800edf:	39 f2                	cmp    %esi,%edx
+  800ee1:	74 0b                	je     800eee <strfind+0x1c>
+  800ee3:	48 83 c0 01          	add    $0x1,%rax
+  800ee7:	0f b6 10             	movzbl (%rax),%edx
+  800eea:	84 d2                	test   %dl,%dl
+  800eec:	75 ee                	jne    800edc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800eee:	c3                   	ret
+  800eef:	c3                   	ret
+
+0000000000800ef0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ef0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ef3:	48 89 f8             	mov    %rdi,%rax
+  800ef6:	48 f7 d8             	neg    %rax
+  800ef9:	83 e0 07             	and    $0x7,%eax
+  800efc:	49 89 d1             	mov    %rdx,%r9
+  800eff:	49 29 c1             	sub    %rax,%r9
+  800f02:	78 36                	js     800f3a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800f04:	40 0f b6 c6          	movzbl %sil,%eax
+  800f08:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800f0f:	01 01 01 
+  800f12:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800f16:	40 f6 c7 07          	test   $0x7,%dil
+  800f1a:	75 38                	jne    800f54 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800f1c:	4c 89 c9             	mov    %r9,%rcx
+  800f1f:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f23:	74 0c                	je     800f31 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f25:	fc                   	cld
+  800f26:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f29:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f2d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f31:	4d 85 c9             	test   %r9,%r9
+  800f34:	75 45                	jne    800f7b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f36:	4c 89 c0             	mov    %r8,%rax
+  800f39:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f3a:	48 85 d2             	test   %rdx,%rdx
+  800f3d:	74 f7                	je     800f36 <memset+0x46>
+  800f3f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f42:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f45:	48 83 c0 01          	add    $0x1,%rax
+  800f49:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f4d:	48 39 c2             	cmp    %rax,%rdx
+  800f50:	75 f3                	jne    800f45 <memset+0x55>
+  800f52:	eb e2                	jmp    800f36 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f54:	40 f6 c7 01          	test   $0x1,%dil
+  800f58:	74 06                	je     800f60 <memset+0x70>
+  800f5a:	88 07                	mov    %al,(%rdi)
+  800f5c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f60:	40 f6 c7 02          	test   $0x2,%dil
+  800f64:	74 07                	je     800f6d <memset+0x7d>
+  800f66:	66 89 07             	mov    %ax,(%rdi)
+  800f69:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f6d:	40 f6 c7 04          	test   $0x4,%dil
+  800f71:	74 a9                	je     800f1c <memset+0x2c>
+  800f73:	89 07                	mov    %eax,(%rdi)
+  800f75:	48 83 c7 04          	add    $0x4,%rdi
+  800f79:	eb a1                	jmp    800f1c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f7b:	41 f6 c1 04          	test   $0x4,%r9b
+  800f7f:	74 06                	je     800f87 <memset+0x97>
+  800f81:	89 07                	mov    %eax,(%rdi)
+  800f83:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f87:	41 f6 c1 02          	test   $0x2,%r9b
+  800f8b:	74 07                	je     800f94 <memset+0xa4>
+  800f8d:	66 89 07             	mov    %ax,(%rdi)
+  800f90:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f94:	41 f6 c1 01          	test   $0x1,%r9b
+  800f98:	74 9c                	je     800f36 <memset+0x46>
+  800f9a:	88 07                	mov    %al,(%rdi)
+  800f9c:	eb 98                	jmp    800f36 <memset+0x46>
+
+0000000000800f9e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f9e:	48 89 f8             	mov    %rdi,%rax
+  800fa1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800fa4:	48 39 fe             	cmp    %rdi,%rsi
+  800fa7:	73 3b                	jae    800fe4 <memmove+0x46>
+  800fa9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800fad:	48 39 d7             	cmp    %rdx,%rdi
+  800fb0:	73 32                	jae    800fe4 <memmove+0x46>
+        s += n;
+        d += n;
+  800fb2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fb6:	48 89 d6             	mov    %rdx,%rsi
+  800fb9:	48 09 fe             	or     %rdi,%rsi
+  800fbc:	48 09 ce             	or     %rcx,%rsi
+  800fbf:	40 f6 c6 07          	test   $0x7,%sil
+  800fc3:	75 12                	jne    800fd7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fc5:	48 83 ef 08          	sub    $0x8,%rdi
+  800fc9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fcd:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd1:	fd                   	std
+  800fd2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fd5:	fc                   	cld
+  800fd6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fd7:	48 83 ef 01          	sub    $0x1,%rdi
+  800fdb:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fdf:	fd                   	std
+  800fe0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fe2:	eb f1                	jmp    800fd5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fe4:	48 89 f2             	mov    %rsi,%rdx
+  800fe7:	48 09 c2             	or     %rax,%rdx
+  800fea:	48 09 ca             	or     %rcx,%rdx
+  800fed:	f6 c2 07             	test   $0x7,%dl
+  800ff0:	75 0c                	jne    800ffe <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800ff2:	48 c1 e9 03          	shr    $0x3,%rcx
+  800ff6:	48 89 c7             	mov    %rax,%rdi
+  800ff9:	fc                   	cld
+  800ffa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800ffd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800ffe:	48 89 c7             	mov    %rax,%rdi
+  801001:	fc                   	cld
+  801002:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801004:	c3                   	ret
+
+0000000000801005 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801005:	55                   	push   %rbp
+  801006:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801009:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  801010:	00 00 00 
+  801013:	ff d0                	call   *%rax
+}
+  801015:	5d                   	pop    %rbp
+  801016:	c3                   	ret
+
+0000000000801017 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801017:	55                   	push   %rbp
+  801018:	48 89 e5             	mov    %rsp,%rbp
+  80101b:	41 57                	push   %r15
+  80101d:	41 56                	push   %r14
+  80101f:	41 55                	push   %r13
+  801021:	41 54                	push   %r12
+  801023:	53                   	push   %rbx
+  801024:	48 83 ec 08          	sub    $0x8,%rsp
+  801028:	49 89 fe             	mov    %rdi,%r14
+  80102b:	49 89 f7             	mov    %rsi,%r15
+  80102e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801031:	48 89 f7             	mov    %rsi,%rdi
+  801034:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  80103b:	00 00 00 
+  80103e:	ff d0                	call   *%rax
+  801040:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801043:	48 89 de             	mov    %rbx,%rsi
+  801046:	4c 89 f7             	mov    %r14,%rdi
+  801049:	48 b8 81 0d 80 00 00 	movabs $0x800d81,%rax
+  801050:	00 00 00 
+  801053:	ff d0                	call   *%rax
+  801055:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801058:	48 39 c3             	cmp    %rax,%rbx
+  80105b:	74 36                	je     801093 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80105d:	48 89 d8             	mov    %rbx,%rax
+  801060:	4c 29 e8             	sub    %r13,%rax
+  801063:	49 39 c4             	cmp    %rax,%r12
+  801066:	73 31                	jae    801099 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801068:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80106d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801071:	4c 89 fe             	mov    %r15,%rsi
+  801074:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  80107b:	00 00 00 
+  80107e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801080:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801084:	48 83 c4 08          	add    $0x8,%rsp
+  801088:	5b                   	pop    %rbx
+  801089:	41 5c                	pop    %r12
+  80108b:	41 5d                	pop    %r13
+  80108d:	41 5e                	pop    %r14
+  80108f:	41 5f                	pop    %r15
+  801091:	5d                   	pop    %rbp
+  801092:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801093:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801097:	eb eb                	jmp    801084 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801099:	48 83 eb 01          	sub    $0x1,%rbx
+  80109d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8010a1:	48 89 da             	mov    %rbx,%rdx
+  8010a4:	4c 89 fe             	mov    %r15,%rsi
+  8010a7:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8010ae:	00 00 00 
+  8010b1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8010b3:	49 01 de             	add    %rbx,%r14
+  8010b6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8010bb:	eb c3                	jmp    801080 <strlcat+0x69>
+
+00000000008010bd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010bd:	48 85 d2             	test   %rdx,%rdx
+  8010c0:	74 2d                	je     8010ef <memcmp+0x32>
+  8010c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010c7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010cb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010d0:	44 38 c1             	cmp    %r8b,%cl
+  8010d3:	75 0f                	jne    8010e4 <memcmp+0x27>
+    while (n-- > 0) {
+  8010d5:	48 83 c0 01          	add    $0x1,%rax
+  8010d9:	48 39 c2             	cmp    %rax,%rdx
+  8010dc:	75 e9                	jne    8010c7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010e3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010e4:	0f b6 c1             	movzbl %cl,%eax
+  8010e7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010eb:	44 29 c0             	sub    %r8d,%eax
+  8010ee:	c3                   	ret
+    return 0;
+  8010ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010f4:	c3                   	ret
+
+00000000008010f5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010f5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010f9:	48 39 c7             	cmp    %rax,%rdi
+  8010fc:	73 0f                	jae    80110d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010fe:	40 38 37             	cmp    %sil,(%rdi)
+  801101:	74 0e                	je     801111 <memfind+0x1c>
+    for (; src < end; src++) {
+  801103:	48 83 c7 01          	add    $0x1,%rdi
+  801107:	48 39 f8             	cmp    %rdi,%rax
+  80110a:	75 f2                	jne    8010fe <memfind+0x9>
+  80110c:	c3                   	ret
+  80110d:	48 89 f8             	mov    %rdi,%rax
+  801110:	c3                   	ret
+  801111:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801114:	c3                   	ret
+
+0000000000801115 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801115:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801118:	0f b6 37             	movzbl (%rdi),%esi
+  80111b:	40 80 fe 20          	cmp    $0x20,%sil
+  80111f:	74 06                	je     801127 <strtol+0x12>
+  801121:	40 80 fe 09          	cmp    $0x9,%sil
+  801125:	75 13                	jne    80113a <strtol+0x25>
+  801127:	48 83 c7 01          	add    $0x1,%rdi
+  80112b:	0f b6 37             	movzbl (%rdi),%esi
+  80112e:	40 80 fe 20          	cmp    $0x20,%sil
+  801132:	74 f3                	je     801127 <strtol+0x12>
+  801134:	40 80 fe 09          	cmp    $0x9,%sil
+  801138:	74 ed                	je     801127 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80113a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80113d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801140:	3c 01                	cmp    $0x1,%al
+  801142:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801146:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80114c:	75 0f                	jne    80115d <strtol+0x48>
+  80114e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801151:	74 14                	je     801167 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801153:	85 d2                	test   %edx,%edx
+  801155:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80115a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80115d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801162:	4c 63 ca             	movslq %edx,%r9
+  801165:	eb 36                	jmp    80119d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801167:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80116b:	74 0f                	je     80117c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80116d:	85 d2                	test   %edx,%edx
+  80116f:	75 ec                	jne    80115d <strtol+0x48>
+        s++;
+  801171:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801175:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80117a:	eb e1                	jmp    80115d <strtol+0x48>
+        s += 2;
+  80117c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801180:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801185:	eb d6                	jmp    80115d <strtol+0x48>
+            dig -= '0';
+  801187:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80118a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80118e:	41 39 d0             	cmp    %edx,%r8d
+  801191:	7d 21                	jge    8011b4 <strtol+0x9f>
+        val = val * base + dig;
+  801193:	49 0f af c1          	imul   %r9,%rax
+  801197:	0f b6 c9             	movzbl %cl,%ecx
+  80119a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80119d:	48 83 c7 01          	add    $0x1,%rdi
+  8011a1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8011a5:	80 f9 39             	cmp    $0x39,%cl
+  8011a8:	76 dd                	jbe    801187 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8011aa:	80 f9 7b             	cmp    $0x7b,%cl
+  8011ad:	77 05                	ja     8011b4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8011af:	83 e9 57             	sub    $0x57,%ecx
+  8011b2:	eb d6                	jmp    80118a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8011b4:	4d 85 d2             	test   %r10,%r10
+  8011b7:	74 03                	je     8011bc <strtol+0xa7>
+  8011b9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8011bc:	48 89 c2             	mov    %rax,%rdx
+  8011bf:	48 f7 da             	neg    %rdx
+  8011c2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011c6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011ca:	c3                   	ret
+
+00000000008011cb <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8011cb:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011d5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8011e7:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011e9:	c3                   	ret
+
+00000000008011ea <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011ea:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011f4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801204:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80120a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801210:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801212:	c3                   	ret
+
+0000000000801213 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801213:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801216:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80121b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801220:	ba 00 00 00 00       	mov    $0x0,%edx
+  801225:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80122b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801231:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801237:	0f 05                	syscall
+    if (check && ret > 0) {
+  801239:	48 85 c0             	test   %rax,%rax
+  80123c:	7f 01                	jg     80123f <sys_env_destroy+0x2c>
+}
+  80123e:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80123f:	55                   	push   %rbp
+  801240:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801243:	49 89 c0             	mov    %rax,%r8
+  801246:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80124b:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801252:	00 00 00 
+  801255:	be 29 00 00 00       	mov    $0x29,%esi
+  80125a:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801261:	00 00 00 
+  801264:	b8 00 00 00 00       	mov    $0x0,%eax
+  801269:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801270:	00 00 00 
+  801273:	41 ff d1             	call   *%r9
+
+0000000000801276 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801276:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80127b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801280:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801285:	ba 00 00 00 00       	mov    $0x0,%edx
+  80128a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801290:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801296:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80129c:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80129e:	c3                   	ret
+
+000000000080129f <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80129f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012a9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c5:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012c7:	c3                   	ret
+
+00000000008012c8 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012cd:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8012d4:	00 00 00 
+  8012d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e9:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012eb:	c3                   	ret
+
+00000000008012ec <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012ec:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8012ef:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801300:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801302:	c3                   	ret
+
+0000000000801303 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801303:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801306:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130b:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80130e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801314:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80131c:	48 85 c0             	test   %rax,%rax
+  80131f:	7f 01                	jg     801322 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801321:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801322:	55                   	push   %rbp
+  801323:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801326:	49 89 c0             	mov    %rax,%r8
+  801329:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80132e:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801335:	00 00 00 
+  801338:	be 29 00 00 00       	mov    $0x29,%esi
+  80133d:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801344:	00 00 00 
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801353:	00 00 00 
+  801356:	41 ff d1             	call   *%r9
+
+0000000000801359 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801359:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80135c:	48 63 d2             	movslq %edx,%rdx
+  80135f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801362:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801367:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80136a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80136c:	48 85 c0             	test   %rax,%rax
+  80136f:	7f 01                	jg     801372 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801371:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801372:	55                   	push   %rbp
+  801373:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801376:	49 89 c0             	mov    %rax,%r8
+  801379:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80137e:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801385:	00 00 00 
+  801388:	be 29 00 00 00       	mov    $0x29,%esi
+  80138d:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801394:	00 00 00 
+  801397:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139c:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  8013a3:	00 00 00 
+  8013a6:	41 ff d1             	call   *%r9
+
+00000000008013a9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8013a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013c5:	48 85 c0             	test   %rax,%rax
+  8013c8:	7f 01                	jg     8013cb <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013ca:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013cb:	55                   	push   %rbp
+  8013cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013cf:	49 89 c0             	mov    %rax,%r8
+  8013d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013d7:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  8013de:	00 00 00 
+  8013e1:	be 29 00 00 00       	mov    $0x29,%esi
+  8013e6:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  8013ed:	00 00 00 
+  8013f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013f5:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  8013fc:	00 00 00 
+  8013ff:	41 ff d1             	call   *%r9
+
+0000000000801402 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801402:	48 63 f6             	movslq %esi,%rsi
+  801405:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801408:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801412:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801418:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80141e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801424:	0f 05                	syscall
+    if (check && ret > 0) {
+  801426:	48 85 c0             	test   %rax,%rax
+  801429:	7f 01                	jg     80142c <sys_env_set_status+0x2a>
+}
+  80142b:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80142c:	55                   	push   %rbp
+  80142d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801430:	49 89 c0             	mov    %rax,%r8
+  801433:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801438:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  80143f:	00 00 00 
+  801442:	be 29 00 00 00       	mov    $0x29,%esi
+  801447:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  80144e:	00 00 00 
+  801451:	b8 00 00 00 00       	mov    $0x0,%eax
+  801456:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  80145d:	00 00 00 
+  801460:	41 ff d1             	call   *%r9
+
+0000000000801463 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801463:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801466:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80146b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801470:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801476:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80147c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801482:	0f 05                	syscall
+    if (check && ret > 0) {
+  801484:	48 85 c0             	test   %rax,%rax
+  801487:	7f 01                	jg     80148a <sys_env_set_trapframe+0x27>
+}
+  801489:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80148a:	55                   	push   %rbp
+  80148b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80148e:	49 89 c0             	mov    %rax,%r8
+  801491:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801496:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  80149d:	00 00 00 
+  8014a0:	be 29 00 00 00       	mov    $0x29,%esi
+  8014a5:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  8014ac:	00 00 00 
+  8014af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b4:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  8014bb:	00 00 00 
+  8014be:	41 ff d1             	call   *%r9
+
+00000000008014c1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014c1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014e2:	48 85 c0             	test   %rax,%rax
+  8014e5:	7f 01                	jg     8014e8 <sys_env_set_pgfault_upcall+0x27>
+}
+  8014e7:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014e8:	55                   	push   %rbp
+  8014e9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014ec:	49 89 c0             	mov    %rax,%r8
+  8014ef:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014f4:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  8014fb:	00 00 00 
+  8014fe:	be 29 00 00 00       	mov    $0x29,%esi
+  801503:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  80150a:	00 00 00 
+  80150d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801512:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801519:	00 00 00 
+  80151c:	41 ff d1             	call   *%r9
+
+000000000080151f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80151f:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801522:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801525:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152a:	4d 63 c0             	movslq %r8d,%r8
+  80152d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801533:	0f 05                	syscall
+}
+  801535:	c3                   	ret
+
+0000000000801536 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801536:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801539:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80153c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801541:	4d 63 c0             	movslq %r8d,%r8
+  801544:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80154a:	0f 05                	syscall
+}
+  80154c:	c3                   	ret
+
+000000000080154d <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80154d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801552:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801555:	45 89 c0             	mov    %r8d,%r8d
+  801558:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80155e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801560:	48 85 c0             	test   %rax,%rax
+  801563:	7f 01                	jg     801566 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801565:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801566:	55                   	push   %rbp
+  801567:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80156a:	49 89 c0             	mov    %rax,%r8
+  80156d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801572:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801579:	00 00 00 
+  80157c:	be 29 00 00 00       	mov    $0x29,%esi
+  801581:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801588:	00 00 00 
+  80158b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801590:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801597:	00 00 00 
+  80159a:	41 ff d1             	call   *%r9
+
+000000000080159d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80159d:	55                   	push   %rbp
+  80159e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8015a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b1:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  8015b8:	00 00 00 
+  8015bb:	ff d0                	call   *%rax
+}
+  8015bd:	5d                   	pop    %rbp
+  8015be:	c3                   	ret
+
+00000000008015bf <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015d3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e5:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015e7:	c3                   	ret
+
+00000000008015e8 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015e8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015ed:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801603:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801609:	0f 05                	syscall
+    if (check && ret > 0) {
+  80160b:	48 85 c0             	test   %rax,%rax
+  80160e:	7f 01                	jg     801611 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801610:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801611:	55                   	push   %rbp
+  801612:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801615:	49 89 c0             	mov    %rax,%r8
+  801618:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80161d:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801624:	00 00 00 
+  801627:	be 29 00 00 00       	mov    $0x29,%esi
+  80162c:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801633:	00 00 00 
+  801636:	b8 00 00 00 00       	mov    $0x0,%eax
+  80163b:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801642:	00 00 00 
+  801645:	41 ff d1             	call   *%r9
+
+0000000000801648 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801648:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80164d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801652:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801657:	ba 00 00 00 00       	mov    $0x0,%edx
+  80165c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801662:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801668:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166e:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801670:	c3                   	ret
+
+0000000000801671 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801671:	89 d2                	mov    %edx,%edx
+  801673:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801675:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80167a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801680:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801686:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168c:	0f 05                	syscall
+}
+  80168e:	c3                   	ret
+
+000000000080168f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80168f:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801692:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801697:	ba 00 00 00 00       	mov    $0x0,%edx
+  80169c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016ae:	0f 05                	syscall
+}
+  8016b0:	c3                   	ret
+
+00000000008016b1 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8016b1:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8016b4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016be:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016d0:	0f 05                	syscall
+}
+  8016d2:	c3                   	ret
+
+00000000008016d3 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8016d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016d6:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016db:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016f9:	48 85 c0             	test   %rax,%rax
+  8016fc:	7f 01                	jg     8016ff <sys_irq_ack+0x2c>
+}
+  8016fe:	c3                   	ret
+sys_irq_ack(int irq) {
+  8016ff:	55                   	push   %rbp
+  801700:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801703:	49 89 c0             	mov    %rax,%r8
+  801706:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80170b:	48 ba d8 4f 80 00 00 	movabs $0x804fd8,%rdx
+  801712:	00 00 00 
+  801715:	be 29 00 00 00       	mov    $0x29,%esi
+  80171a:	48 bf f7 4f 80 00 00 	movabs $0x804ff7,%rdi
+  801721:	00 00 00 
+  801724:	b8 00 00 00 00       	mov    $0x0,%eax
+  801729:	49 b9 2f 03 80 00 00 	movabs $0x80032f,%r9
+  801730:	00 00 00 
+  801733:	41 ff d1             	call   *%r9
+
+0000000000801736 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801736:	55                   	push   %rbp
+  801737:	48 89 e5             	mov    %rsp,%rbp
+  80173a:	41 54                	push   %r12
+  80173c:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80173d:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  801744:	00 00 00 
+  801747:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801749:	b8 08 00 00 00       	mov    $0x8,%eax
+  80174e:	0f 05                	syscall
+  801750:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801753:	85 c0                	test   %eax,%eax
+  801755:	78 7e                	js     8017d5 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801757:	0f 84 80 00 00 00    	je     8017dd <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80175d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801763:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80176a:	00 00 00 
+  80176d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801772:	89 c2                	mov    %eax,%edx
+  801774:	be 00 00 00 00       	mov    $0x0,%esi
+  801779:	bf 00 00 00 00       	mov    $0x0,%edi
+  80177e:	48 b8 59 13 80 00 00 	movabs $0x801359,%rax
+  801785:	00 00 00 
+  801788:	ff d0                	call   *%rax
+  80178a:	85 c0                	test   %eax,%eax
+  80178c:	0f 88 86 00 00 00    	js     801818 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801792:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801799:	00 00 00 
+  80179c:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8017a3:	44 89 e7             	mov    %r12d,%edi
+  8017a6:	48 b8 c1 14 80 00 00 	movabs $0x8014c1,%rax
+  8017ad:	00 00 00 
+  8017b0:	ff d0                	call   *%rax
+  8017b2:	85 c0                	test   %eax,%eax
+  8017b4:	78 6a                	js     801820 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8017b6:	be 02 00 00 00       	mov    $0x2,%esi
+  8017bb:	44 89 e7             	mov    %r12d,%edi
+  8017be:	48 b8 02 14 80 00 00 	movabs $0x801402,%rax
+  8017c5:	00 00 00 
+  8017c8:	ff d0                	call   *%rax
+		return -1;
+  8017ca:	85 c0                	test   %eax,%eax
+  8017cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8017d1:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8017d5:	44 89 e0             	mov    %r12d,%eax
+  8017d8:	5b                   	pop    %rbx
+  8017d9:	41 5c                	pop    %r12
+  8017db:	5d                   	pop    %rbp
+  8017dc:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8017dd:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  8017e4:	00 00 00 
+  8017e7:	ff d0                	call   *%rax
+  8017e9:	89 c2                	mov    %eax,%edx
+  8017eb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8017f1:	48 89 d0             	mov    %rdx,%rax
+  8017f4:	48 c1 e0 04          	shl    $0x4,%rax
+  8017f8:	48 29 d0             	sub    %rdx,%rax
+  8017fb:	48 c1 e0 05          	shl    $0x5,%rax
+  8017ff:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801806:	00 00 00 
+  801809:	48 01 d0             	add    %rdx,%rax
+  80180c:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801813:	00 00 00 
+        return 0;
+  801816:	eb bd                	jmp    8017d5 <fork+0x9f>
+		return -1;
+  801818:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80181e:	eb b5                	jmp    8017d5 <fork+0x9f>
+		return -1;
+  801820:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801826:	eb ad                	jmp    8017d5 <fork+0x9f>
+
+0000000000801828 <sfork>:
+
+envid_t
+sfork() {
+  801828:	55                   	push   %rbp
+  801829:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80182c:	48 ba 05 50 80 00 00 	movabs $0x805005,%rdx
+  801833:	00 00 00 
+  801836:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80183b:	48 bf 20 50 80 00 00 	movabs $0x805020,%rdi
+  801842:	00 00 00 
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184a:	48 b9 2f 03 80 00 00 	movabs $0x80032f,%rcx
+  801851:	00 00 00 
+  801854:	ff d1                	call   *%rcx
+
+0000000000801856 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801856:	55                   	push   %rbp
+  801857:	48 89 e5             	mov    %rsp,%rbp
+  80185a:	41 55                	push   %r13
+  80185c:	41 54                	push   %r12
+  80185e:	53                   	push   %rbx
+  80185f:	48 83 ec 08          	sub    $0x8,%rsp
+  801863:	49 89 fd             	mov    %rdi,%r13
+  801866:	48 89 f7             	mov    %rsi,%rdi
+  801869:	48 89 d3             	mov    %rdx,%rbx
+  80186c:	49 89 cc             	mov    %rcx,%r12
+  80186f:	4c 89 c2             	mov    %r8,%rdx
+  801872:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801875:	48 85 f6             	test   %rsi,%rsi
+  801878:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80187f:	00 00 00 
+  801882:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  801886:	be 00 10 00 00       	mov    $0x1000,%esi
+  80188b:	48 85 db             	test   %rbx,%rbx
+  80188e:	74 03                	je     801893 <ipc_recv_futex+0x3d>
+  801890:	48 8b 33             	mov    (%rbx),%rsi
+  801893:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  801897:	48 b8 4d 15 80 00 00 	movabs $0x80154d,%rax
+  80189e:	00 00 00 
+  8018a1:	ff d0                	call   *%rax
+    if (res < 0) {
+  8018a3:	85 c0                	test   %eax,%eax
+  8018a5:	78 75                	js     80191c <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8018a7:	4d 85 ed             	test   %r13,%r13
+  8018aa:	74 14                	je     8018c0 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8018ac:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018b3:	00 00 00 
+  8018b6:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8018bc:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8018c0:	4d 85 e4             	test   %r12,%r12
+  8018c3:	74 14                	je     8018d9 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8018c5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018cc:	00 00 00 
+  8018cf:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8018d5:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8018d9:	48 85 db             	test   %rbx,%rbx
+  8018dc:	74 23                	je     801901 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8018de:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018e5:	00 00 00 
+  8018e8:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8018ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018f3:	85 c9                	test   %ecx,%ecx
+  8018f5:	74 07                	je     8018fe <ipc_recv_futex+0xa8>
+  8018f7:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8018fe:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801901:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801908:	00 00 00 
+  80190b:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801911:	48 83 c4 08          	add    $0x8,%rsp
+  801915:	5b                   	pop    %rbx
+  801916:	41 5c                	pop    %r12
+  801918:	41 5d                	pop    %r13
+  80191a:	5d                   	pop    %rbp
+  80191b:	c3                   	ret
+        if (from_env_store != NULL) {
+  80191c:	4d 85 ed             	test   %r13,%r13
+  80191f:	74 08                	je     801929 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801921:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801928:	00 
+        if (perm_store != NULL) {
+  801929:	4d 85 e4             	test   %r12,%r12
+  80192c:	74 08                	je     801936 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80192e:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801935:	00 
+        if (size != NULL) {
+  801936:	48 85 db             	test   %rbx,%rbx
+  801939:	74 d6                	je     801911 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80193b:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801942:	eb cd                	jmp    801911 <ipc_recv_futex+0xbb>
+
+0000000000801944 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  801948:	48 83 ec 08          	sub    $0x8,%rsp
+  80194c:	6a 00                	push   $0x0
+  80194e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801954:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80195a:	48 b8 56 18 80 00 00 	movabs $0x801856,%rax
+  801961:	00 00 00 
+  801964:	ff d0                	call   *%rax
+}
+  801966:	c9                   	leave
+  801967:	c3                   	ret
+
+0000000000801968 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  801968:	55                   	push   %rbp
+  801969:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80196c:	48 85 d2             	test   %rdx,%rdx
+  80196f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801976:	00 00 00 
+  801979:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80197d:	89 f6                	mov    %esi,%esi
+  80197f:	48 b8 36 15 80 00 00 	movabs $0x801536,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+    if (res < 0) {
+  80198b:	85 c0                	test   %eax,%eax
+  80198d:	78 02                	js     801991 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  80198f:	5d                   	pop    %rbp
+  801990:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801991:	89 c1                	mov    %eax,%ecx
+  801993:	48 ba 2b 50 80 00 00 	movabs $0x80502b,%rdx
+  80199a:	00 00 00 
+  80199d:	be 50 00 00 00       	mov    $0x50,%esi
+  8019a2:	48 bf 3f 50 80 00 00 	movabs $0x80503f,%rdi
+  8019a9:	00 00 00 
+  8019ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019b1:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  8019b8:	00 00 00 
+  8019bb:	41 ff d0             	call   *%r8
+
+00000000008019be <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8019be:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8019c3:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8019ca:	00 00 00 
+  8019cd:	48 89 d0             	mov    %rdx,%rax
+  8019d0:	48 c1 e0 04          	shl    $0x4,%rax
+  8019d4:	48 29 d0             	sub    %rdx,%rax
+  8019d7:	48 c1 e0 05          	shl    $0x5,%rax
+  8019db:	48 01 c8             	add    %rcx,%rax
+  8019de:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8019e4:	39 f8                	cmp    %edi,%eax
+  8019e6:	74 13                	je     8019fb <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8019e8:	48 83 c2 01          	add    $0x1,%rdx
+  8019ec:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8019f3:	75 d8                	jne    8019cd <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8019f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019fa:	c3                   	ret
+            return envs[i].env_id;
+  8019fb:	48 89 d0             	mov    %rdx,%rax
+  8019fe:	48 c1 e0 04          	shl    $0x4,%rax
+  801a02:	48 29 d0             	sub    %rdx,%rax
+  801a05:	48 c1 e0 05          	shl    $0x5,%rax
+  801a09:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801a10:	00 00 00 
+  801a13:	48 01 d0             	add    %rdx,%rax
+  801a16:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801a1c:	c3                   	ret
+
+0000000000801a1d <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a1d:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a24:	ff ff ff 
+  801a27:	48 01 f8             	add    %rdi,%rax
+  801a2a:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801a2e:	c3                   	ret
+
+0000000000801a2f <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a2f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a36:	ff ff ff 
+  801a39:	48 01 f8             	add    %rdi,%rax
+  801a3c:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801a40:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801a46:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801a4a:	c3                   	ret
+
+0000000000801a4b <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	41 57                	push   %r15
+  801a51:	41 56                	push   %r14
+  801a53:	41 55                	push   %r13
+  801a55:	41 54                	push   %r12
+  801a57:	53                   	push   %rbx
+  801a58:	48 83 ec 08          	sub    $0x8,%rsp
+  801a5c:	49 89 ff             	mov    %rdi,%r15
+  801a5f:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801a64:	49 bd da 41 80 00 00 	movabs $0x8041da,%r13
+  801a6b:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801a6e:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801a74:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801a77:	48 89 df             	mov    %rbx,%rdi
+  801a7a:	41 ff d5             	call   *%r13
+  801a7d:	83 e0 04             	and    $0x4,%eax
+  801a80:	74 17                	je     801a99 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801a82:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801a89:	4c 39 f3             	cmp    %r14,%rbx
+  801a8c:	75 e6                	jne    801a74 <fd_alloc+0x29>
+  801a8e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801a94:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801a99:	4d 89 27             	mov    %r12,(%r15)
+}
+  801a9c:	48 83 c4 08          	add    $0x8,%rsp
+  801aa0:	5b                   	pop    %rbx
+  801aa1:	41 5c                	pop    %r12
+  801aa3:	41 5d                	pop    %r13
+  801aa5:	41 5e                	pop    %r14
+  801aa7:	41 5f                	pop    %r15
+  801aa9:	5d                   	pop    %rbp
+  801aaa:	c3                   	ret
+
+0000000000801aab <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801aab:	83 ff 1f             	cmp    $0x1f,%edi
+  801aae:	77 39                	ja     801ae9 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801ab0:	55                   	push   %rbp
+  801ab1:	48 89 e5             	mov    %rsp,%rbp
+  801ab4:	41 54                	push   %r12
+  801ab6:	53                   	push   %rbx
+  801ab7:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801aba:	48 63 df             	movslq %edi,%rbx
+  801abd:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801ac4:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801ac8:	48 89 df             	mov    %rbx,%rdi
+  801acb:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  801ad2:	00 00 00 
+  801ad5:	ff d0                	call   *%rax
+  801ad7:	a8 04                	test   $0x4,%al
+  801ad9:	74 14                	je     801aef <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801adb:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801adf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801ae4:	5b                   	pop    %rbx
+  801ae5:	41 5c                	pop    %r12
+  801ae7:	5d                   	pop    %rbp
+  801ae8:	c3                   	ret
+        return -E_INVAL;
+  801ae9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801aee:	c3                   	ret
+        return -E_INVAL;
+  801aef:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801af4:	eb ee                	jmp    801ae4 <fd_lookup+0x39>
+
+0000000000801af6 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801af6:	55                   	push   %rbp
+  801af7:	48 89 e5             	mov    %rsp,%rbp
+  801afa:	41 54                	push   %r12
+  801afc:	53                   	push   %rbx
+  801afd:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b00:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  801b07:	00 00 00 
+  801b0a:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b11:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b14:	39 3b                	cmp    %edi,(%rbx)
+  801b16:	74 47                	je     801b5f <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b18:	48 83 c0 08          	add    $0x8,%rax
+  801b1c:	48 8b 18             	mov    (%rax),%rbx
+  801b1f:	48 85 db             	test   %rbx,%rbx
+  801b22:	75 f0                	jne    801b14 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b24:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b2b:	00 00 00 
+  801b2e:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b34:	89 fa                	mov    %edi,%edx
+  801b36:	48 bf 50 50 80 00 00 	movabs $0x805050,%rdi
+  801b3d:	00 00 00 
+  801b40:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b45:	48 b9 7f 04 80 00 00 	movabs $0x80047f,%rcx
+  801b4c:	00 00 00 
+  801b4f:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801b51:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801b56:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801b5a:	5b                   	pop    %rbx
+  801b5b:	41 5c                	pop    %r12
+  801b5d:	5d                   	pop    %rbp
+  801b5e:	c3                   	ret
+            return 0;
+  801b5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b64:	eb f0                	jmp    801b56 <dev_lookup+0x60>
+
+0000000000801b66 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801b66:	55                   	push   %rbp
+  801b67:	48 89 e5             	mov    %rsp,%rbp
+  801b6a:	41 55                	push   %r13
+  801b6c:	41 54                	push   %r12
+  801b6e:	53                   	push   %rbx
+  801b6f:	48 83 ec 18          	sub    $0x18,%rsp
+  801b73:	48 89 fb             	mov    %rdi,%rbx
+  801b76:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801b79:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801b80:	ff ff ff 
+  801b83:	48 01 df             	add    %rbx,%rdi
+  801b86:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801b8a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b8e:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801b95:	00 00 00 
+  801b98:	ff d0                	call   *%rax
+  801b9a:	41 89 c5             	mov    %eax,%r13d
+  801b9d:	85 c0                	test   %eax,%eax
+  801b9f:	78 06                	js     801ba7 <fd_close+0x41>
+  801ba1:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ba5:	74 1a                	je     801bc1 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ba7:	45 84 e4             	test   %r12b,%r12b
+  801baa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801baf:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801bb3:	44 89 e8             	mov    %r13d,%eax
+  801bb6:	48 83 c4 18          	add    $0x18,%rsp
+  801bba:	5b                   	pop    %rbx
+  801bbb:	41 5c                	pop    %r12
+  801bbd:	41 5d                	pop    %r13
+  801bbf:	5d                   	pop    %rbp
+  801bc0:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801bc1:	8b 3b                	mov    (%rbx),%edi
+  801bc3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bc7:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  801bce:	00 00 00 
+  801bd1:	ff d0                	call   *%rax
+  801bd3:	41 89 c5             	mov    %eax,%r13d
+  801bd6:	85 c0                	test   %eax,%eax
+  801bd8:	78 1b                	js     801bf5 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801bda:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bde:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801be2:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801be8:	48 85 c0             	test   %rax,%rax
+  801beb:	74 08                	je     801bf5 <fd_close+0x8f>
+  801bed:	48 89 df             	mov    %rbx,%rdi
+  801bf0:	ff d0                	call   *%rax
+  801bf2:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801bf5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bfa:	48 89 de             	mov    %rbx,%rsi
+  801bfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c02:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+    return res;
+  801c0e:	eb a3                	jmp    801bb3 <fd_close+0x4d>
+
+0000000000801c10 <close>:
+
+int
+close(int fdnum) {
+  801c10:	55                   	push   %rbp
+  801c11:	48 89 e5             	mov    %rsp,%rbp
+  801c14:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c18:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c1c:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801c23:	00 00 00 
+  801c26:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c28:	85 c0                	test   %eax,%eax
+  801c2a:	78 15                	js     801c41 <close+0x31>
+
+    return fd_close(fd, 1);
+  801c2c:	be 01 00 00 00       	mov    $0x1,%esi
+  801c31:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801c35:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  801c3c:	00 00 00 
+  801c3f:	ff d0                	call   *%rax
+}
+  801c41:	c9                   	leave
+  801c42:	c3                   	ret
+
+0000000000801c43 <close_all>:
+
+void
+close_all(void) {
+  801c43:	55                   	push   %rbp
+  801c44:	48 89 e5             	mov    %rsp,%rbp
+  801c47:	41 54                	push   %r12
+  801c49:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801c4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801c4f:	49 bc 10 1c 80 00 00 	movabs $0x801c10,%r12
+  801c56:	00 00 00 
+  801c59:	89 df                	mov    %ebx,%edi
+  801c5b:	41 ff d4             	call   *%r12
+  801c5e:	83 c3 01             	add    $0x1,%ebx
+  801c61:	83 fb 20             	cmp    $0x20,%ebx
+  801c64:	75 f3                	jne    801c59 <close_all+0x16>
+}
+  801c66:	5b                   	pop    %rbx
+  801c67:	41 5c                	pop    %r12
+  801c69:	5d                   	pop    %rbp
+  801c6a:	c3                   	ret
+
+0000000000801c6b <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801c6b:	55                   	push   %rbp
+  801c6c:	48 89 e5             	mov    %rsp,%rbp
+  801c6f:	41 57                	push   %r15
+  801c71:	41 56                	push   %r14
+  801c73:	41 55                	push   %r13
+  801c75:	41 54                	push   %r12
+  801c77:	53                   	push   %rbx
+  801c78:	48 83 ec 18          	sub    $0x18,%rsp
+  801c7c:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801c7f:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801c83:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+  801c8f:	89 c3                	mov    %eax,%ebx
+  801c91:	85 c0                	test   %eax,%eax
+  801c93:	0f 88 b8 00 00 00    	js     801d51 <dup+0xe6>
+    close(newfdnum);
+  801c99:	44 89 e7             	mov    %r12d,%edi
+  801c9c:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  801ca3:	00 00 00 
+  801ca6:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ca8:	4d 63 ec             	movslq %r12d,%r13
+  801cab:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801cb2:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801cb6:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801cba:	4c 89 ff             	mov    %r15,%rdi
+  801cbd:	49 be 2f 1a 80 00 00 	movabs $0x801a2f,%r14
+  801cc4:	00 00 00 
+  801cc7:	41 ff d6             	call   *%r14
+  801cca:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801ccd:	4c 89 ef             	mov    %r13,%rdi
+  801cd0:	41 ff d6             	call   *%r14
+  801cd3:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801cd6:	48 89 df             	mov    %rbx,%rdi
+  801cd9:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  801ce0:	00 00 00 
+  801ce3:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801ce5:	a8 04                	test   $0x4,%al
+  801ce7:	74 2b                	je     801d14 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801ce9:	41 89 c1             	mov    %eax,%r9d
+  801cec:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801cf2:	4c 89 f1             	mov    %r14,%rcx
+  801cf5:	ba 00 00 00 00       	mov    $0x0,%edx
+  801cfa:	48 89 de             	mov    %rbx,%rsi
+  801cfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d02:	48 b8 59 13 80 00 00 	movabs $0x801359,%rax
+  801d09:	00 00 00 
+  801d0c:	ff d0                	call   *%rax
+  801d0e:	89 c3                	mov    %eax,%ebx
+  801d10:	85 c0                	test   %eax,%eax
+  801d12:	78 4e                	js     801d62 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d14:	4c 89 ff             	mov    %r15,%rdi
+  801d17:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  801d1e:	00 00 00 
+  801d21:	ff d0                	call   *%rax
+  801d23:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d26:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d2c:	4c 89 e9             	mov    %r13,%rcx
+  801d2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d34:	4c 89 fe             	mov    %r15,%rsi
+  801d37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d3c:	48 b8 59 13 80 00 00 	movabs $0x801359,%rax
+  801d43:	00 00 00 
+  801d46:	ff d0                	call   *%rax
+  801d48:	89 c3                	mov    %eax,%ebx
+  801d4a:	85 c0                	test   %eax,%eax
+  801d4c:	78 14                	js     801d62 <dup+0xf7>
+
+    return newfdnum;
+  801d4e:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801d51:	89 d8                	mov    %ebx,%eax
+  801d53:	48 83 c4 18          	add    $0x18,%rsp
+  801d57:	5b                   	pop    %rbx
+  801d58:	41 5c                	pop    %r12
+  801d5a:	41 5d                	pop    %r13
+  801d5c:	41 5e                	pop    %r14
+  801d5e:	41 5f                	pop    %r15
+  801d60:	5d                   	pop    %rbp
+  801d61:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801d62:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d67:	4c 89 ee             	mov    %r13,%rsi
+  801d6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d6f:	49 bc a9 13 80 00 00 	movabs $0x8013a9,%r12
+  801d76:	00 00 00 
+  801d79:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801d7c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d81:	4c 89 f6             	mov    %r14,%rsi
+  801d84:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d89:	41 ff d4             	call   *%r12
+    return res;
+  801d8c:	eb c3                	jmp    801d51 <dup+0xe6>
+
+0000000000801d8e <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801d8e:	55                   	push   %rbp
+  801d8f:	48 89 e5             	mov    %rsp,%rbp
+  801d92:	41 56                	push   %r14
+  801d94:	41 55                	push   %r13
+  801d96:	41 54                	push   %r12
+  801d98:	53                   	push   %rbx
+  801d99:	48 83 ec 10          	sub    $0x10,%rsp
+  801d9d:	89 fb                	mov    %edi,%ebx
+  801d9f:	49 89 f4             	mov    %rsi,%r12
+  801da2:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801da5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801da9:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 4c                	js     801e05 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801db9:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801dbd:	41 8b 3e             	mov    (%r14),%edi
+  801dc0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dc4:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  801dcb:	00 00 00 
+  801dce:	ff d0                	call   *%rax
+  801dd0:	85 c0                	test   %eax,%eax
+  801dd2:	78 35                	js     801e09 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801dd4:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801dd8:	83 e0 03             	and    $0x3,%eax
+  801ddb:	83 f8 01             	cmp    $0x1,%eax
+  801dde:	74 2d                	je     801e0d <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801de0:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801de4:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801de8:	48 85 c0             	test   %rax,%rax
+  801deb:	74 56                	je     801e43 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ded:	4c 89 ea             	mov    %r13,%rdx
+  801df0:	4c 89 e6             	mov    %r12,%rsi
+  801df3:	4c 89 f7             	mov    %r14,%rdi
+  801df6:	ff d0                	call   *%rax
+}
+  801df8:	48 83 c4 10          	add    $0x10,%rsp
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	41 5e                	pop    %r14
+  801e03:	5d                   	pop    %rbp
+  801e04:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e05:	48 98                	cltq
+  801e07:	eb ef                	jmp    801df8 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e09:	48 98                	cltq
+  801e0b:	eb eb                	jmp    801df8 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e0d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e14:	00 00 00 
+  801e17:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e1d:	89 da                	mov    %ebx,%edx
+  801e1f:	48 bf 91 50 80 00 00 	movabs $0x805091,%rdi
+  801e26:	00 00 00 
+  801e29:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e2e:	48 b9 7f 04 80 00 00 	movabs $0x80047f,%rcx
+  801e35:	00 00 00 
+  801e38:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e3a:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e41:	eb b5                	jmp    801df8 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e43:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e4a:	eb ac                	jmp    801df8 <read+0x6a>
+
+0000000000801e4c <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801e4c:	55                   	push   %rbp
+  801e4d:	48 89 e5             	mov    %rsp,%rbp
+  801e50:	41 57                	push   %r15
+  801e52:	41 56                	push   %r14
+  801e54:	41 55                	push   %r13
+  801e56:	41 54                	push   %r12
+  801e58:	53                   	push   %rbx
+  801e59:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801e5d:	48 85 d2             	test   %rdx,%rdx
+  801e60:	74 54                	je     801eb6 <readn+0x6a>
+  801e62:	41 89 fd             	mov    %edi,%r13d
+  801e65:	49 89 f6             	mov    %rsi,%r14
+  801e68:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801e6b:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801e70:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801e75:	49 bf 8e 1d 80 00 00 	movabs $0x801d8e,%r15
+  801e7c:	00 00 00 
+  801e7f:	4c 89 e2             	mov    %r12,%rdx
+  801e82:	48 29 f2             	sub    %rsi,%rdx
+  801e85:	4c 01 f6             	add    %r14,%rsi
+  801e88:	44 89 ef             	mov    %r13d,%edi
+  801e8b:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	78 20                	js     801eb2 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801e92:	01 c3                	add    %eax,%ebx
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	74 08                	je     801ea0 <readn+0x54>
+  801e98:	48 63 f3             	movslq %ebx,%rsi
+  801e9b:	4c 39 e6             	cmp    %r12,%rsi
+  801e9e:	72 df                	jb     801e7f <readn+0x33>
+    }
+    return res;
+  801ea0:	48 63 c3             	movslq %ebx,%rax
+}
+  801ea3:	48 83 c4 08          	add    $0x8,%rsp
+  801ea7:	5b                   	pop    %rbx
+  801ea8:	41 5c                	pop    %r12
+  801eaa:	41 5d                	pop    %r13
+  801eac:	41 5e                	pop    %r14
+  801eae:	41 5f                	pop    %r15
+  801eb0:	5d                   	pop    %rbp
+  801eb1:	c3                   	ret
+        if (inc < 0) return inc;
+  801eb2:	48 98                	cltq
+  801eb4:	eb ed                	jmp    801ea3 <readn+0x57>
+    int inc = 1, res = 0;
+  801eb6:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ebb:	eb e3                	jmp    801ea0 <readn+0x54>
+
+0000000000801ebd <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801ebd:	55                   	push   %rbp
+  801ebe:	48 89 e5             	mov    %rsp,%rbp
+  801ec1:	41 56                	push   %r14
+  801ec3:	41 55                	push   %r13
+  801ec5:	41 54                	push   %r12
+  801ec7:	53                   	push   %rbx
+  801ec8:	48 83 ec 10          	sub    $0x10,%rsp
+  801ecc:	89 fb                	mov    %edi,%ebx
+  801ece:	49 89 f4             	mov    %rsi,%r12
+  801ed1:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ed8:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801edf:	00 00 00 
+  801ee2:	ff d0                	call   *%rax
+  801ee4:	85 c0                	test   %eax,%eax
+  801ee6:	78 47                	js     801f2f <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ee8:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801eec:	41 8b 3e             	mov    (%r14),%edi
+  801eef:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ef3:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  801efa:	00 00 00 
+  801efd:	ff d0                	call   *%rax
+  801eff:	85 c0                	test   %eax,%eax
+  801f01:	78 30                	js     801f33 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f03:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f08:	74 2d                	je     801f37 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f0a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f0e:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f12:	48 85 c0             	test   %rax,%rax
+  801f15:	74 56                	je     801f6d <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f17:	4c 89 ea             	mov    %r13,%rdx
+  801f1a:	4c 89 e6             	mov    %r12,%rsi
+  801f1d:	4c 89 f7             	mov    %r14,%rdi
+  801f20:	ff d0                	call   *%rax
+}
+  801f22:	48 83 c4 10          	add    $0x10,%rsp
+  801f26:	5b                   	pop    %rbx
+  801f27:	41 5c                	pop    %r12
+  801f29:	41 5d                	pop    %r13
+  801f2b:	41 5e                	pop    %r14
+  801f2d:	5d                   	pop    %rbp
+  801f2e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f2f:	48 98                	cltq
+  801f31:	eb ef                	jmp    801f22 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f33:	48 98                	cltq
+  801f35:	eb eb                	jmp    801f22 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f37:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f3e:	00 00 00 
+  801f41:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801f47:	89 da                	mov    %ebx,%edx
+  801f49:	48 bf ad 50 80 00 00 	movabs $0x8050ad,%rdi
+  801f50:	00 00 00 
+  801f53:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f58:	48 b9 7f 04 80 00 00 	movabs $0x80047f,%rcx
+  801f5f:	00 00 00 
+  801f62:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f64:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801f6b:	eb b5                	jmp    801f22 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f6d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801f74:	eb ac                	jmp    801f22 <write+0x65>
+
+0000000000801f76 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801f76:	55                   	push   %rbp
+  801f77:	48 89 e5             	mov    %rsp,%rbp
+  801f7a:	41 54                	push   %r12
+  801f7c:	53                   	push   %rbx
+  801f7d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f81:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f83:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f87:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801f8e:	00 00 00 
+  801f91:	ff d0                	call   *%rax
+  801f93:	85 c0                	test   %eax,%eax
+  801f95:	78 3e                	js     801fd5 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f97:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f9b:	41 8b 3c 24          	mov    (%r12),%edi
+  801f9f:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fa3:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  801faa:	00 00 00 
+  801fad:	ff d0                	call   *%rax
+  801faf:	85 c0                	test   %eax,%eax
+  801fb1:	78 22                	js     801fd5 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801fb3:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801fb7:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801fbb:	48 85 c0             	test   %rax,%rax
+  801fbe:	74 0b                	je     801fcb <seek+0x55>
+  801fc0:	89 de                	mov    %ebx,%esi
+  801fc2:	4c 89 e7             	mov    %r12,%rdi
+  801fc5:	ff d0                	call   *%rax
+  801fc7:	85 c0                	test   %eax,%eax
+  801fc9:	78 0a                	js     801fd5 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801fcb:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801fd0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801fd5:	48 83 c4 10          	add    $0x10,%rsp
+  801fd9:	5b                   	pop    %rbx
+  801fda:	41 5c                	pop    %r12
+  801fdc:	5d                   	pop    %rbp
+  801fdd:	c3                   	ret
+
+0000000000801fde <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801fde:	55                   	push   %rbp
+  801fdf:	48 89 e5             	mov    %rsp,%rbp
+  801fe2:	41 55                	push   %r13
+  801fe4:	41 54                	push   %r12
+  801fe6:	53                   	push   %rbx
+  801fe7:	48 83 ec 18          	sub    $0x18,%rsp
+  801feb:	89 fb                	mov    %edi,%ebx
+  801fed:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ff4:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  801ffb:	00 00 00 
+  801ffe:	ff d0                	call   *%rax
+  802000:	85 c0                	test   %eax,%eax
+  802002:	78 38                	js     80203c <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802004:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802008:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  80200c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802010:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  802017:	00 00 00 
+  80201a:	ff d0                	call   *%rax
+  80201c:	85 c0                	test   %eax,%eax
+  80201e:	78 1c                	js     80203c <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802020:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802025:	74 20                	je     802047 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802027:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80202b:	48 8b 40 30          	mov    0x30(%rax),%rax
+  80202f:	48 85 c0             	test   %rax,%rax
+  802032:	74 47                	je     80207b <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802034:	44 89 e6             	mov    %r12d,%esi
+  802037:	4c 89 ef             	mov    %r13,%rdi
+  80203a:	ff d0                	call   *%rax
+}
+  80203c:	48 83 c4 18          	add    $0x18,%rsp
+  802040:	5b                   	pop    %rbx
+  802041:	41 5c                	pop    %r12
+  802043:	41 5d                	pop    %r13
+  802045:	5d                   	pop    %rbp
+  802046:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802047:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80204e:	00 00 00 
+  802051:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802057:	89 da                	mov    %ebx,%edx
+  802059:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  802060:	00 00 00 
+  802063:	b8 00 00 00 00       	mov    $0x0,%eax
+  802068:	48 b9 7f 04 80 00 00 	movabs $0x80047f,%rcx
+  80206f:	00 00 00 
+  802072:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802074:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802079:	eb c1                	jmp    80203c <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80207b:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802080:	eb ba                	jmp    80203c <ftruncate+0x5e>
+
+0000000000802082 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802082:	55                   	push   %rbp
+  802083:	48 89 e5             	mov    %rsp,%rbp
+  802086:	41 54                	push   %r12
+  802088:	53                   	push   %rbx
+  802089:	48 83 ec 10          	sub    $0x10,%rsp
+  80208d:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802090:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802094:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  80209b:	00 00 00 
+  80209e:	ff d0                	call   *%rax
+  8020a0:	85 c0                	test   %eax,%eax
+  8020a2:	78 4e                	js     8020f2 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020a4:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  8020a8:	41 8b 3c 24          	mov    (%r12),%edi
+  8020ac:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  8020b0:	48 b8 f6 1a 80 00 00 	movabs $0x801af6,%rax
+  8020b7:	00 00 00 
+  8020ba:	ff d0                	call   *%rax
+  8020bc:	85 c0                	test   %eax,%eax
+  8020be:	78 32                	js     8020f2 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020c0:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  8020c4:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  8020c9:	74 30                	je     8020fb <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  8020cb:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  8020ce:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  8020d5:	00 00 00 
+    stat->st_isdir = 0;
+  8020d8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8020df:	00 00 00 
+    stat->st_dev = dev;
+  8020e2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  8020e9:	48 89 de             	mov    %rbx,%rsi
+  8020ec:	4c 89 e7             	mov    %r12,%rdi
+  8020ef:	ff 50 28             	call   *0x28(%rax)
+}
+  8020f2:	48 83 c4 10          	add    $0x10,%rsp
+  8020f6:	5b                   	pop    %rbx
+  8020f7:	41 5c                	pop    %r12
+  8020f9:	5d                   	pop    %rbp
+  8020fa:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  8020fb:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802100:	eb f0                	jmp    8020f2 <fstat+0x70>
+
+0000000000802102 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802102:	55                   	push   %rbp
+  802103:	48 89 e5             	mov    %rsp,%rbp
+  802106:	41 54                	push   %r12
+  802108:	53                   	push   %rbx
+  802109:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80210c:	be 00 00 00 00       	mov    $0x0,%esi
+  802111:	48 b8 70 32 80 00 00 	movabs $0x803270,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+  80211d:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	78 25                	js     802148 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802123:	4c 89 e6             	mov    %r12,%rsi
+  802126:	89 c7                	mov    %eax,%edi
+  802128:	48 b8 82 20 80 00 00 	movabs $0x802082,%rax
+  80212f:	00 00 00 
+  802132:	ff d0                	call   *%rax
+  802134:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802137:	89 df                	mov    %ebx,%edi
+  802139:	48 b8 10 1c 80 00 00 	movabs $0x801c10,%rax
+  802140:	00 00 00 
+  802143:	ff d0                	call   *%rax
+
+    return res;
+  802145:	44 89 e3             	mov    %r12d,%ebx
+}
+  802148:	89 d8                	mov    %ebx,%eax
+  80214a:	5b                   	pop    %rbx
+  80214b:	41 5c                	pop    %r12
+  80214d:	5d                   	pop    %rbp
+  80214e:	c3                   	ret
+
+000000000080214f <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80214f:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802156:	00 00 00 
+  802159:	83 38 00             	cmpl   $0x0,(%rax)
+  80215c:	74 0a                	je     802168 <fsenv+0x19>
+    return envid;
+}
+  80215e:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802165:	00 00 
+  802167:	c3                   	ret
+fsenv(void) {
+  802168:	55                   	push   %rbp
+  802169:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80216c:	bf 03 00 00 00       	mov    $0x3,%edi
+  802171:	48 b8 be 19 80 00 00 	movabs $0x8019be,%rax
+  802178:	00 00 00 
+  80217b:	ff d0                	call   *%rax
+  80217d:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802184:	00 00 
+}
+  802186:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80218d:	00 00 
+  80218f:	5d                   	pop    %rbp
+  802190:	c3                   	ret
+
+0000000000802191 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802191:	55                   	push   %rbp
+  802192:	48 89 e5             	mov    %rsp,%rbp
+  802195:	41 54                	push   %r12
+  802197:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802198:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80219d:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8021a2:	48 89 de             	mov    %rbx,%rsi
+  8021a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021aa:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8021b6:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8021bd:	00 00 00 
+  8021c0:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8021c6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8021cb:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021d0:	48 89 de             	mov    %rbx,%rsi
+  8021d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d8:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+  8021e4:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8021e6:	85 c0                	test   %eax,%eax
+  8021e8:	0f 88 a2 00 00 00    	js     802290 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8021ee:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021f5:	00 00 00 
+  8021f8:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021fe:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802203:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802205:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80220a:	49 bc a2 43 80 00 00 	movabs $0x8043a2,%r12
+  802211:	00 00 00 
+  802214:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802217:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  80221c:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80221f:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	89 c7                	mov    %eax,%edi
+  80222d:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802233:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802238:	48 89 da             	mov    %rbx,%rdx
+  80223b:	be 09 00 00 00       	mov    $0x9,%esi
+  802240:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80224c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802251:	ba 00 00 00 00       	mov    $0x0,%edx
+  802256:	be 00 00 00 00       	mov    $0x0,%esi
+  80225b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802260:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  802267:	00 00 00 
+  80226a:	ff d0                	call   *%rax
+  80226c:	89 c3                	mov    %eax,%ebx
+  80226e:	85 c0                	test   %eax,%eax
+  802270:	78 25                	js     802297 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802272:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802279:	00 00 00 
+  80227c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802282:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802289:	00 00 
+    return 0;
+  80228b:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802290:	89 d8                	mov    %ebx,%eax
+  802292:	5b                   	pop    %rbx
+  802293:	41 5c                	pop    %r12
+  802295:	5d                   	pop    %rbp
+  802296:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802297:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80229c:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8022a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022a6:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  8022ad:	00 00 00 
+  8022b0:	ff d0                	call   *%rax
+        return res;
+  8022b2:	eb dc                	jmp    802290 <fschan_setup+0xff>
+
+00000000008022b4 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8022b4:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8022bb:	00 00 00 
+  8022be:	80 38 00             	cmpb   $0x0,(%rax)
+  8022c1:	74 55                	je     802318 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022c3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8022ca:	00 00 00 
+  8022cd:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  8022d3:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022d8:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8022df:	00 00 00 
+  8022e2:	3b 0a                	cmp    (%rdx),%ecx
+  8022e4:	75 01                	jne    8022e7 <fschan+0x33>
+}
+  8022e6:	c3                   	ret
+fschan(void) {
+  8022e7:	55                   	push   %rbp
+  8022e8:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022eb:	48 b8 91 21 80 00 00 	movabs $0x802191,%rax
+  8022f2:	00 00 00 
+  8022f5:	ff d0                	call   *%rax
+  8022f7:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8022f9:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8022fe:	85 d2                	test   %edx,%edx
+  802300:	78 02                	js     802304 <fschan+0x50>
+}
+  802302:	5d                   	pop    %rbp
+  802303:	c3                   	ret
+        fschan_enabled = 0;
+  802304:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80230b:	00 00 00 
+  80230e:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802311:	b8 00 00 00 00       	mov    $0x0,%eax
+  802316:	eb ea                	jmp    802302 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802318:	b8 00 00 00 00       	mov    $0x0,%eax
+  80231d:	c3                   	ret
+
+000000000080231e <fbuf>:
+fbuf(struct Fd *fd) {
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802322:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  802329:	00 00 00 
+  80232c:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  80232e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802333:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802337:	77 12                	ja     80234b <fbuf+0x2d>
+  802339:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80233d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802344:	00 00 00 
+  802347:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80234b:	48 89 d0             	mov    %rdx,%rax
+  80234e:	5d                   	pop    %rbp
+  80234f:	c3                   	ret
+
+0000000000802350 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802350:	55                   	push   %rbp
+  802351:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802354:	48 83 c7 40          	add    $0x40,%rdi
+  802358:	48 b8 dc 43 80 00 00 	movabs $0x8043dc,%rax
+  80235f:	00 00 00 
+  802362:	ff d0                	call   *%rax
+  802364:	84 c0                	test   %al,%al
+  802366:	75 02                	jne    80236a <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802368:	5d                   	pop    %rbp
+  802369:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80236a:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+  802376:	89 c7                	mov    %eax,%edi
+  802378:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80237e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802383:	ba 00 00 00 00       	mov    $0x0,%edx
+  802388:	be 0a 00 00 00       	mov    $0xa,%esi
+  80238d:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  802394:	00 00 00 
+  802397:	ff d0                	call   *%rax
+}
+  802399:	eb cd                	jmp    802368 <fschan_publish+0x18>
+
+000000000080239b <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80239b:	55                   	push   %rbp
+  80239c:	48 89 e5             	mov    %rsp,%rbp
+  80239f:	41 57                	push   %r15
+  8023a1:	41 56                	push   %r14
+  8023a3:	41 55                	push   %r13
+  8023a5:	41 54                	push   %r12
+  8023a7:	53                   	push   %rbx
+  8023a8:	48 83 ec 48          	sub    $0x48,%rsp
+  8023ac:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8023b0:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8023b4:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8023b7:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8023bb:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8023be:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8023c5:	00 00 00 
+  8023c8:	8b 02                	mov    (%rdx),%eax
+  8023ca:	83 c0 01             	add    $0x1,%eax
+  8023cd:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8023d2:	0f 44 c1             	cmove  %ecx,%eax
+  8023d5:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8023d7:	4d 85 c0             	test   %r8,%r8
+  8023da:	74 2c                	je     802408 <fschan_rw+0x6d>
+  8023dc:	45 89 ce             	mov    %r9d,%r14d
+  8023df:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8023e6:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8023ea:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8023f0:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8023f7:	00 
+  8023f8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8023fe:	b8 01 00 00 00       	mov    $0x1,%eax
+  802403:	e9 41 01 00 00       	jmp    802549 <fschan_rw+0x1ae>
+  802408:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80240c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802410:	e9 9c 01 00 00       	jmp    8025b1 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802415:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802419:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80241c:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80241f:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802422:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802426:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80242a:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80242e:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802432:	48 89 da             	mov    %rbx,%rdx
+  802435:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  80243c:	00 00 00 
+  80243f:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802441:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802445:	48 b8 50 23 80 00 00 	movabs $0x802350,%rax
+  80244c:	00 00 00 
+  80244f:	ff d0                	call   *%rax
+            queued += blk;
+  802451:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802454:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802458:	4d 39 fc             	cmp    %r15,%r12
+  80245b:	73 6b                	jae    8024c8 <fschan_rw+0x12d>
+  80245d:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802461:	77 65                	ja     8024c8 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802463:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802467:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80246b:	48 b8 b7 43 80 00 00 	movabs $0x8043b7,%rax
+  802472:	00 00 00 
+  802475:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802477:	4c 89 fb             	mov    %r15,%rbx
+  80247a:	4c 29 e3             	sub    %r12,%rbx
+  80247d:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802482:	48 39 d3             	cmp    %rdx,%rbx
+  802485:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802489:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80248d:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802491:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802495:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802498:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80249a:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8024a1:	00 00 00 
+  8024a4:	8b 09                	mov    (%rcx),%ecx
+  8024a6:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8024a9:	83 fe 03             	cmp    $0x3,%esi
+  8024ac:	0f 85 63 ff ff ff    	jne    802415 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8024b2:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8024b6:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8024b9:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8024bc:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8024bf:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8024c3:	e9 79 ff ff ff       	jmp    802441 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8024c8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024cc:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8024d3:	48 89 df             	mov    %rbx,%rdi
+  8024d6:	48 b8 7a 44 80 00 00 	movabs $0x80447a,%rax
+  8024dd:	00 00 00 
+  8024e0:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8024e2:	48 89 df             	mov    %rbx,%rdi
+  8024e5:	48 b8 08 44 80 00 00 	movabs $0x804408,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+  8024f1:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8024f5:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8024f9:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8024fd:	75 25                	jne    802524 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8024ff:	8b 40 04             	mov    0x4(%rax),%eax
+  802502:	85 c0                	test   %eax,%eax
+  802504:	0f 88 86 00 00 00    	js     802590 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80250a:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80250e:	74 5b                	je     80256b <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802510:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802514:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802518:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80251c:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802520:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802524:	48 89 df             	mov    %rbx,%rdi
+  802527:	48 b8 2f 44 80 00 00 	movabs $0x80442f,%rax
+  80252e:	00 00 00 
+  802531:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802533:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802537:	83 f0 01             	xor    $0x1,%eax
+  80253a:	4d 39 fc             	cmp    %r15,%r12
+  80253d:	0f 92 c2             	setb   %dl
+  802540:	84 c2                	test   %al,%dl
+  802542:	75 05                	jne    802549 <fschan_rw+0x1ae>
+  802544:	45 85 ed             	test   %r13d,%r13d
+  802547:	74 50                	je     802599 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802549:	4d 39 fc             	cmp    %r15,%r12
+  80254c:	0f 92 c1             	setb   %cl
+  80254f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802553:	0f 96 c2             	setbe  %dl
+  802556:	84 d1                	test   %dl,%cl
+  802558:	0f 84 6a ff ff ff    	je     8024c8 <fschan_rw+0x12d>
+  80255e:	84 c0                	test   %al,%al
+  802560:	0f 85 fd fe ff ff    	jne    802463 <fschan_rw+0xc8>
+  802566:	e9 5d ff ff ff       	jmp    8024c8 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80256b:	48 63 d0             	movslq %eax,%rdx
+  80256e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802572:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802576:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80257a:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80257e:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802582:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  802589:	00 00 00 
+  80258c:	ff d0                	call   *%rax
+  80258e:	eb 80                	jmp    802510 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802590:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802593:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802597:	eb 8b                	jmp    802524 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802599:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80259e:	0f 85 68 fe ff ff    	jne    80240c <fschan_rw+0x71>
+  8025a4:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8025a7:	85 c0                	test   %eax,%eax
+  8025a9:	0f 84 5d fe ff ff    	je     80240c <fschan_rw+0x71>
+  8025af:	48 98                	cltq
+}
+  8025b1:	48 83 c4 48          	add    $0x48,%rsp
+  8025b5:	5b                   	pop    %rbx
+  8025b6:	41 5c                	pop    %r12
+  8025b8:	41 5d                	pop    %r13
+  8025ba:	41 5e                	pop    %r14
+  8025bc:	41 5f                	pop    %r15
+  8025be:	5d                   	pop    %rbp
+  8025bf:	c3                   	ret
+
+00000000008025c0 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8025c0:	55                   	push   %rbp
+  8025c1:	48 89 e5             	mov    %rsp,%rbp
+  8025c4:	41 56                	push   %r14
+  8025c6:	41 55                	push   %r13
+  8025c8:	41 54                	push   %r12
+  8025ca:	53                   	push   %rbx
+  8025cb:	48 83 ec 10          	sub    $0x10,%rsp
+  8025cf:	49 89 fe             	mov    %rdi,%r14
+  8025d2:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8025d5:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8025d9:	48 29 f3             	sub    %rsi,%rbx
+  8025dc:	48 39 d3             	cmp    %rdx,%rbx
+  8025df:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8025e3:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8025ea:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8025eb:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8025f0:	49 bd 39 42 80 00 00 	movabs $0x804239,%r13
+  8025f7:	00 00 00 
+  8025fa:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802601:	76 1e                	jbe    802621 <mmap_fault+0x61>
+  802603:	4c 01 e7             	add    %r12,%rdi
+  802606:	41 ff d5             	call   *%r13
+  802609:	84 c0                	test   %al,%al
+  80260b:	75 14                	jne    802621 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80260d:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802611:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802618:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80261c:	48 39 df             	cmp    %rbx,%rdi
+  80261f:	72 e2                	jb     802603 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802621:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802628:	00 00 00 
+  80262b:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802632:	00 00 00 
+  802635:	4c 89 f0             	mov    %r14,%rax
+  802638:	48 29 d0             	sub    %rdx,%rax
+  80263b:	48 c1 f8 03          	sar    $0x3,%rax
+  80263f:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802646:	aa aa aa 
+  802649:	48 0f af c2          	imul   %rdx,%rax
+  80264d:	48 c1 e0 0c          	shl    $0xc,%rax
+  802651:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802656:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80265a:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80265c:	44 89 e0             	mov    %r12d,%eax
+  80265f:	41 03 46 10          	add    0x10(%r14),%eax
+  802663:	41 2b 06             	sub    (%r14),%eax
+  802666:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802669:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80266d:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802671:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802675:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802678:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  80267f:	00 00 00 
+  802682:	ff d0                	call   *%rax
+  802684:	89 c7                	mov    %eax,%edi
+  802686:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80268c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802691:	48 89 da             	mov    %rbx,%rdx
+  802694:	be 0f 00 00 00       	mov    $0xf,%esi
+  802699:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8026a5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026aa:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026ae:	4c 89 e6             	mov    %r12,%rsi
+  8026b1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026b6:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  8026bd:	00 00 00 
+  8026c0:	ff d0                	call   *%rax
+  8026c2:	48 98                	cltq
+}
+  8026c4:	48 83 c4 10          	add    $0x10,%rsp
+  8026c8:	5b                   	pop    %rbx
+  8026c9:	41 5c                	pop    %r12
+  8026cb:	41 5d                	pop    %r13
+  8026cd:	41 5e                	pop    %r14
+  8026cf:	5d                   	pop    %rbp
+  8026d0:	c3                   	ret
+
+00000000008026d1 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8026d1:	48 8b 37             	mov    (%rdi),%rsi
+  8026d4:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8026db:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8026e2:	00 00 00 
+  8026e5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026ea:	eb 0f                	jmp    8026fb <mmap_pgfault+0x2a>
+  8026ec:	c3                   	ret
+  8026ed:	48 83 c1 01          	add    $0x1,%rcx
+  8026f1:	48 83 c2 18          	add    $0x18,%rdx
+  8026f5:	48 83 f9 20          	cmp    $0x20,%rcx
+  8026f9:	74 6e                	je     802769 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8026fb:	48 8b 02             	mov    (%rdx),%rax
+  8026fe:	48 83 e8 01          	sub    $0x1,%rax
+  802702:	48 39 f0             	cmp    %rsi,%rax
+  802705:	73 e6                	jae    8026ed <mmap_pgfault+0x1c>
+  802707:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80270b:	73 e0                	jae    8026ed <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80270d:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802711:	b8 00 00 00 00       	mov    $0x0,%eax
+  802716:	f6 c2 01             	test   $0x1,%dl
+  802719:	75 d1                	jne    8026ec <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80271b:	f6 c2 02             	test   $0x2,%dl
+  80271e:	74 1a                	je     80273a <mmap_pgfault+0x69>
+  802720:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802724:	b8 00 00 00 00       	mov    $0x0,%eax
+  802729:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802730:	00 00 00 
+  802733:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802738:	74 35                	je     80276f <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80273a:	55                   	push   %rbp
+  80273b:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80273e:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802742:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802749:	00 00 00 
+  80274c:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802750:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802755:	48 b8 c0 25 80 00 00 	movabs $0x8025c0,%rax
+  80275c:	00 00 00 
+  80275f:	ff d0                	call   *%rax
+  802761:	48 85 c0             	test   %rax,%rax
+  802764:	0f 9f c0             	setg   %al
+}
+  802767:	5d                   	pop    %rbp
+  802768:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802769:	b8 00 00 00 00       	mov    $0x0,%eax
+  80276e:	c3                   	ret
+}
+  80276f:	c3                   	ret
+
+0000000000802770 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802770:	55                   	push   %rbp
+  802771:	48 89 e5             	mov    %rsp,%rbp
+  802774:	41 54                	push   %r12
+  802776:	53                   	push   %rbx
+  802777:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80277a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802781:	00 00 00 
+  802784:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802789:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80278d:	74 15                	je     8027a4 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80278f:	48 83 c3 01          	add    $0x1,%rbx
+  802793:	48 83 c0 18          	add    $0x18,%rax
+  802797:	48 83 fb 20          	cmp    $0x20,%rbx
+  80279b:	75 ec                	jne    802789 <mmap_alloc+0x19>
+    return NULL;
+  80279d:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027a2:	eb 52                	jmp    8027f6 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027a4:	4c 89 e7             	mov    %r12,%rdi
+  8027a7:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  8027ae:	00 00 00 
+  8027b1:	ff d0                	call   *%rax
+  8027b3:	41 89 c1             	mov    %eax,%r9d
+  8027b6:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8027bd:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8027c1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8027c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027cc:	4c 89 e6             	mov    %r12,%rsi
+  8027cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027d4:	48 b8 59 13 80 00 00 	movabs $0x801359,%rax
+  8027db:	00 00 00 
+  8027de:	ff d0                	call   *%rax
+  8027e0:	85 c0                	test   %eax,%eax
+  8027e2:	78 17                	js     8027fb <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8027e4:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8027e8:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027ef:	00 00 00 
+  8027f2:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8027f6:	5b                   	pop    %rbx
+  8027f7:	41 5c                	pop    %r12
+  8027f9:	5d                   	pop    %rbp
+  8027fa:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8027fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  802800:	eb f4                	jmp    8027f6 <mmap_alloc+0x86>
+
+0000000000802802 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	41 56                	push   %r14
+  802808:	41 55                	push   %r13
+  80280a:	41 54                	push   %r12
+  80280c:	53                   	push   %rbx
+  80280d:	48 83 ec 10          	sub    $0x10,%rsp
+  802811:	41 89 fc             	mov    %edi,%r12d
+  802814:	49 89 f5             	mov    %rsi,%r13
+  802817:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80281a:	48 89 f0             	mov    %rsi,%rax
+  80281d:	48 09 d0             	or     %rdx,%rax
+  802820:	75 0d                	jne    80282f <fsipc+0x2d>
+  802822:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802825:	83 f8 04             	cmp    $0x4,%eax
+  802828:	76 7d                	jbe    8028a7 <fsipc+0xa5>
+  80282a:	83 ff 0d             	cmp    $0xd,%edi
+  80282d:	74 78                	je     8028a7 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80282f:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  802836:	00 00 00 
+  802839:	ff d0                	call   *%rax
+  80283b:	89 c7                	mov    %eax,%edi
+  80283d:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802844:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80284b:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802852:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802858:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80285f:	00 00 00 
+  802862:	44 89 e6             	mov    %r12d,%esi
+  802865:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  80286c:	00 00 00 
+  80286f:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802871:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802878:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802879:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80287e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802882:	4c 89 ee             	mov    %r13,%rsi
+  802885:	bf 00 00 00 00       	mov    $0x0,%edi
+  80288a:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  802891:	00 00 00 
+  802894:	ff d0                	call   *%rax
+  802896:	89 c3                	mov    %eax,%ebx
+}
+  802898:	89 d8                	mov    %ebx,%eax
+  80289a:	48 83 c4 10          	add    $0x10,%rsp
+  80289e:	5b                   	pop    %rbx
+  80289f:	41 5c                	pop    %r12
+  8028a1:	41 5d                	pop    %r13
+  8028a3:	41 5e                	pop    %r14
+  8028a5:	5d                   	pop    %rbp
+  8028a6:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8028a7:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  8028ae:	00 00 00 
+  8028b1:	ff d0                	call   *%rax
+  8028b3:	49 89 c6             	mov    %rax,%r14
+  8028b6:	48 85 c0             	test   %rax,%rax
+  8028b9:	0f 84 70 ff ff ff    	je     80282f <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8028bf:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8028c3:	48 b8 b7 43 80 00 00 	movabs $0x8043b7,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8028cf:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8028d2:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8028d9:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8028dd:	ba 10 00 00 00       	mov    $0x10,%edx
+  8028e2:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8028e9:	00 00 00 
+  8028ec:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8028f3:	00 00 00 
+  8028f6:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8028f8:	4c 89 f7             	mov    %r14,%rdi
+  8028fb:	48 b8 50 23 80 00 00 	movabs $0x802350,%rax
+  802902:	00 00 00 
+  802905:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802907:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80290e:	4c 89 f7             	mov    %r14,%rdi
+  802911:	48 b8 7a 44 80 00 00 	movabs $0x80447a,%rax
+  802918:	00 00 00 
+  80291b:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80291d:	4c 89 f7             	mov    %r14,%rdi
+  802920:	48 b8 08 44 80 00 00 	movabs $0x804408,%rax
+  802927:	00 00 00 
+  80292a:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80292c:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80292f:	41 83 fc 05          	cmp    $0x5,%r12d
+  802933:	75 04                	jne    802939 <fsipc+0x137>
+  802935:	85 db                	test   %ebx,%ebx
+  802937:	79 14                	jns    80294d <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802939:	4c 89 f7             	mov    %r14,%rdi
+  80293c:	48 b8 2f 44 80 00 00 	movabs $0x80442f,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802948:	e9 4b ff ff ff       	jmp    802898 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80294d:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802951:	ba 88 00 00 00       	mov    $0x88,%edx
+  802956:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80295d:	00 00 00 
+  802960:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+  80296c:	eb cb                	jmp    802939 <fsipc+0x137>
+
+000000000080296e <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80296e:	55                   	push   %rbp
+  80296f:	48 89 e5             	mov    %rsp,%rbp
+  802972:	41 57                	push   %r15
+  802974:	41 56                	push   %r14
+  802976:	41 55                	push   %r13
+  802978:	41 54                	push   %r12
+  80297a:	53                   	push   %rbx
+  80297b:	48 83 ec 18          	sub    $0x18,%rsp
+  80297f:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802983:	49 89 f6             	mov    %rsi,%r14
+  802986:	49 89 d4             	mov    %rdx,%r12
+  802989:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80298c:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802993:	00 00 00 
+  802996:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802998:	48 85 c0             	test   %rax,%rax
+  80299b:	0f 85 96 00 00 00    	jne    802a37 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8029a1:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8029a8:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029a9:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8029b0:	00 00 00 
+    while (n) {
+  8029b3:	4d 85 e4             	test   %r12,%r12
+  8029b6:	74 79                	je     802a31 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8029b8:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8029bd:	49 39 dc             	cmp    %rbx,%r12
+  8029c0:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8029c4:	48 89 da             	mov    %rbx,%rdx
+  8029c7:	4c 89 f6             	mov    %r14,%rsi
+  8029ca:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8029d1:	00 00 00 
+  8029d4:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8029e0:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8029e4:	8b 40 0c             	mov    0xc(%rax),%eax
+  8029e7:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8029ea:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8029ed:	44 01 e8             	add    %r13d,%eax
+  8029f0:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8029f4:	41 0f 44 c5          	cmove  %r13d,%eax
+  8029f8:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8029fc:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802a00:	48 89 da             	mov    %rbx,%rdx
+  802a03:	be 00 00 00 00       	mov    $0x0,%esi
+  802a08:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a0d:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802a14:	00 00 00 
+  802a17:	ff d0                	call   *%rax
+        if (res < 0)
+  802a19:	85 c0                	test   %eax,%eax
+  802a1b:	78 4a                	js     802a67 <devfile_write_direct+0xf9>
+        buf += res;
+  802a1d:	48 98                	cltq
+  802a1f:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a22:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a26:	49 29 c4             	sub    %rax,%r12
+  802a29:	75 8d                	jne    8029b8 <devfile_write_direct+0x4a>
+    return write;
+  802a2b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802a2f:	eb 27                	jmp    802a58 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802a31:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802a35:	eb f4                	jmp    802a2b <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a37:	45 89 e9             	mov    %r13d,%r9d
+  802a3a:	4d 89 e0             	mov    %r12,%r8
+  802a3d:	4c 89 f1             	mov    %r14,%rcx
+  802a40:	ba 04 00 00 00       	mov    $0x4,%edx
+  802a45:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802a49:	48 89 c7             	mov    %rax,%rdi
+  802a4c:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+}
+  802a58:	48 83 c4 18          	add    $0x18,%rsp
+  802a5c:	5b                   	pop    %rbx
+  802a5d:	41 5c                	pop    %r12
+  802a5f:	41 5d                	pop    %r13
+  802a61:	41 5e                	pop    %r14
+  802a63:	41 5f                	pop    %r15
+  802a65:	5d                   	pop    %rbp
+  802a66:	c3                   	ret
+            return res;
+  802a67:	48 98                	cltq
+  802a69:	eb ed                	jmp    802a58 <devfile_write_direct+0xea>
+
+0000000000802a6b <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802a6b:	55                   	push   %rbp
+  802a6c:	48 89 e5             	mov    %rsp,%rbp
+  802a6f:	41 54                	push   %r12
+  802a71:	53                   	push   %rbx
+  802a72:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802a75:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802a7c:	00 00 00 
+  802a7f:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802a81:	48 85 c0             	test   %rax,%rax
+  802a84:	74 71                	je     802af7 <fbuf_flush+0x8c>
+  802a86:	48 89 c3             	mov    %rax,%rbx
+  802a89:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a8e:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802a92:	75 05                	jne    802a99 <fbuf_flush+0x2e>
+}
+  802a94:	5b                   	pop    %rbx
+  802a95:	41 5c                	pop    %r12
+  802a97:	5d                   	pop    %rbp
+  802a98:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802a99:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802a9c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802aa0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802aa7:	00 00 00 
+  802aaa:	48 89 de             	mov    %rbx,%rsi
+  802aad:	48 29 c6             	sub    %rax,%rsi
+  802ab0:	48 c1 fe 03          	sar    $0x3,%rsi
+  802ab4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802abb:	aa aa aa 
+  802abe:	48 0f af f0          	imul   %rax,%rsi
+  802ac2:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802ac6:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802acb:	48 01 c6             	add    %rax,%rsi
+  802ace:	4c 89 e7             	mov    %r12,%rdi
+  802ad1:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802ad8:	00 00 00 
+  802adb:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802add:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802ae1:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802ae8:	00 
+    return res < 0 ? res : 0;
+  802ae9:	48 85 c0             	test   %rax,%rax
+  802aec:	ba 00 00 00 00       	mov    $0x0,%edx
+  802af1:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802af5:	eb 9d                	jmp    802a94 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802af7:	b8 00 00 00 00       	mov    $0x0,%eax
+  802afc:	eb 96                	jmp    802a94 <fbuf_flush+0x29>
+
+0000000000802afe <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802afe:	55                   	push   %rbp
+  802aff:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802b02:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  802b09:	00 00 00 
+  802b0c:	ff d0                	call   *%rax
+}
+  802b0e:	5d                   	pop    %rbp
+  802b0f:	c3                   	ret
+
+0000000000802b10 <devfile_write>:
+    if (!fd || !buf)
+  802b10:	48 85 ff             	test   %rdi,%rdi
+  802b13:	0f 84 d3 01 00 00    	je     802cec <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b19:	55                   	push   %rbp
+  802b1a:	48 89 e5             	mov    %rsp,%rbp
+  802b1d:	41 57                	push   %r15
+  802b1f:	41 56                	push   %r14
+  802b21:	41 55                	push   %r13
+  802b23:	41 54                	push   %r12
+  802b25:	53                   	push   %rbx
+  802b26:	48 83 ec 08          	sub    $0x8,%rsp
+  802b2a:	49 89 fc             	mov    %rdi,%r12
+  802b2d:	49 89 f6             	mov    %rsi,%r14
+  802b30:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802b33:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802b38:	48 85 f6             	test   %rsi,%rsi
+  802b3b:	0f 84 9c 01 00 00    	je     802cdd <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802b41:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802b48:	00 00 00 
+  802b4b:	ff d0                	call   *%rax
+  802b4d:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802b50:	48 85 c0             	test   %rax,%rax
+  802b53:	0f 84 a2 00 00 00    	je     802bfb <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802b59:	be 00 10 00 00       	mov    $0x1000,%esi
+  802b5e:	4c 89 e7             	mov    %r12,%rdi
+  802b61:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802b6d:	83 f8 02             	cmp    $0x2,%eax
+  802b70:	0f 8f 85 00 00 00    	jg     802bfb <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802b76:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802b7d:	00 00 00 
+  802b80:	4d 89 ef             	mov    %r13,%r15
+  802b83:	49 29 c7             	sub    %rax,%r15
+  802b86:	49 c1 ff 03          	sar    $0x3,%r15
+  802b8a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b91:	aa aa aa 
+  802b94:	4c 0f af f8          	imul   %rax,%r15
+  802b98:	49 c1 e7 0e          	shl    $0xe,%r15
+  802b9c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ba1:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802ba4:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ba9:	0f 84 d7 00 00 00    	je     802c86 <devfile_write+0x176>
+  802baf:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802bb3:	89 c2                	mov    %eax,%edx
+  802bb5:	41 03 55 0c          	add    0xc(%r13),%edx
+  802bb9:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802bbe:	75 0f                	jne    802bcf <devfile_write+0xbf>
+  802bc0:	48 01 d8             	add    %rbx,%rax
+  802bc3:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802bc9:	0f 86 92 00 00 00    	jbe    802c61 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802bcf:	4c 89 e7             	mov    %r12,%rdi
+  802bd2:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  802bd9:	00 00 00 
+  802bdc:	ff d0                	call   *%rax
+  802bde:	85 c0                	test   %eax,%eax
+  802be0:	78 52                	js     802c34 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802be2:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802be9:	77 7f                	ja     802c6a <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802beb:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802bf0:	0f 85 c2 00 00 00    	jne    802cb8 <devfile_write+0x1a8>
+  802bf6:	e9 94 00 00 00       	jmp    802c8f <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802bfb:	4c 89 e7             	mov    %r12,%rdi
+  802bfe:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c0a:	85 c0                	test   %eax,%eax
+  802c0c:	79 07                	jns    802c15 <devfile_write+0x105>
+  802c0e:	48 98                	cltq
+  802c10:	e9 c8 00 00 00       	jmp    802cdd <devfile_write+0x1cd>
+  802c15:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c1a:	48 89 da             	mov    %rbx,%rdx
+  802c1d:	4c 89 f6             	mov    %r14,%rsi
+  802c20:	4c 89 e7             	mov    %r12,%rdi
+  802c23:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802c2a:	00 00 00 
+  802c2d:	ff d0                	call   *%rax
+  802c2f:	e9 a9 00 00 00       	jmp    802cdd <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c34:	48 98                	cltq
+  802c36:	e9 a2 00 00 00       	jmp    802cdd <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c3b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802c40:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802c45:	4c 89 fe             	mov    %r15,%rsi
+  802c48:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4d:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  802c54:	00 00 00 
+  802c57:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802c59:	85 c0                	test   %eax,%eax
+  802c5b:	79 45                	jns    802ca2 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802c5d:	48 98                	cltq
+  802c5f:	eb 7c                	jmp    802cdd <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c61:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c68:	76 4e                	jbe    802cb8 <devfile_write+0x1a8>
+  802c6a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c6f:	48 89 da             	mov    %rbx,%rdx
+  802c72:	4c 89 f6             	mov    %r14,%rsi
+  802c75:	4c 89 e7             	mov    %r12,%rdi
+  802c78:	48 b8 6e 29 80 00 00 	movabs $0x80296e,%rax
+  802c7f:	00 00 00 
+  802c82:	ff d0                	call   *%rax
+  802c84:	eb 57                	jmp    802cdd <devfile_write+0x1cd>
+  802c86:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c8d:	77 db                	ja     802c6a <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802c8f:	4c 89 ff             	mov    %r15,%rdi
+  802c92:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  802c99:	00 00 00 
+  802c9c:	ff d0                	call   *%rax
+  802c9e:	84 c0                	test   %al,%al
+  802ca0:	74 99                	je     802c3b <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802ca2:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802ca7:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802cac:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802cb0:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802cb7:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802cb8:	4c 89 ff             	mov    %r15,%rdi
+  802cbb:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802cbf:	48 89 da             	mov    %rbx,%rdx
+  802cc2:	4c 89 f6             	mov    %r14,%rsi
+  802cc5:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  802ccc:	00 00 00 
+  802ccf:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802cd1:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802cd5:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802cda:	48 89 d8             	mov    %rbx,%rax
+}
+  802cdd:	48 83 c4 08          	add    $0x8,%rsp
+  802ce1:	5b                   	pop    %rbx
+  802ce2:	41 5c                	pop    %r12
+  802ce4:	41 5d                	pop    %r13
+  802ce6:	41 5e                	pop    %r14
+  802ce8:	41 5f                	pop    %r15
+  802cea:	5d                   	pop    %rbp
+  802ceb:	c3                   	ret
+        return E_INVAL;
+  802cec:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802cf1:	c3                   	ret
+
+0000000000802cf2 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802cf2:	55                   	push   %rbp
+  802cf3:	48 89 e5             	mov    %rsp,%rbp
+  802cf6:	41 54                	push   %r12
+  802cf8:	53                   	push   %rbx
+  802cf9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802cfc:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  802d03:	00 00 00 
+  802d06:	ff d0                	call   *%rax
+  802d08:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802d0b:	48 89 df             	mov    %rbx,%rdi
+  802d0e:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802d15:	00 00 00 
+  802d18:	ff d0                	call   *%rax
+  802d1a:	48 85 c0             	test   %rax,%rax
+  802d1d:	74 17                	je     802d36 <devfile_flush+0x44>
+  802d1f:	48 89 df             	mov    %rbx,%rdi
+  802d22:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+  802d2e:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802d35:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802d36:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d39:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802d40:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802d42:	ba 00 00 00 00       	mov    $0x0,%edx
+  802d47:	be 00 00 00 00       	mov    $0x0,%esi
+  802d4c:	bf 06 00 00 00       	mov    $0x6,%edi
+  802d51:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802d58:	00 00 00 
+  802d5b:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802d5d:	45 85 e4             	test   %r12d,%r12d
+  802d60:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802d64:	5b                   	pop    %rbx
+  802d65:	41 5c                	pop    %r12
+  802d67:	5d                   	pop    %rbp
+  802d68:	c3                   	ret
+
+0000000000802d69 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802d69:	55                   	push   %rbp
+  802d6a:	48 89 e5             	mov    %rsp,%rbp
+  802d6d:	41 57                	push   %r15
+  802d6f:	41 56                	push   %r14
+  802d71:	41 55                	push   %r13
+  802d73:	41 54                	push   %r12
+  802d75:	53                   	push   %rbx
+  802d76:	48 83 ec 38          	sub    $0x38,%rsp
+  802d7a:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802d7e:	49 89 f7             	mov    %rsi,%r15
+  802d81:	48 89 d3             	mov    %rdx,%rbx
+  802d84:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802d87:	48 b8 b4 22 80 00 00 	movabs $0x8022b4,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d93:	48 85 c0             	test   %rax,%rax
+  802d96:	75 20                	jne    802db8 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802d98:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802d9d:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802da4:	00 
+    while (n) {
+  802da5:	48 85 db             	test   %rbx,%rbx
+  802da8:	0f 85 df 00 00 00    	jne    802e8d <devfile_read_direct+0x124>
+    size_t read = 0;
+  802dae:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802db2:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802db6:	eb 21                	jmp    802dd9 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802db8:	45 89 f1             	mov    %r14d,%r9d
+  802dbb:	49 89 d8             	mov    %rbx,%r8
+  802dbe:	4c 89 f9             	mov    %r15,%rcx
+  802dc1:	ba 03 00 00 00       	mov    $0x3,%edx
+  802dc6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dca:	48 89 c7             	mov    %rax,%rdi
+  802dcd:	48 b8 9b 23 80 00 00 	movabs $0x80239b,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+}
+  802dd9:	48 83 c4 38          	add    $0x38,%rsp
+  802ddd:	5b                   	pop    %rbx
+  802dde:	41 5c                	pop    %r12
+  802de0:	41 5d                	pop    %r13
+  802de2:	41 5e                	pop    %r14
+  802de4:	41 5f                	pop    %r15
+  802de6:	5d                   	pop    %rbp
+  802de7:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802de8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802dec:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802df2:	75 1e                	jne    802e12 <devfile_read_direct+0xa9>
+  802df4:	e9 e2 00 00 00       	jmp    802edb <devfile_read_direct+0x172>
+            if (!res) return read;
+  802df9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802dfd:	eb da                	jmp    802dd9 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802dff:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802e03:	0f 85 d0 01 00 00    	jne    802fd9 <devfile_read_direct+0x270>
+            map = 0;
+  802e09:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e0d:	eb 03                	jmp    802e12 <devfile_read_direct+0xa9>
+  802e0f:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e12:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e17:	48 39 d3             	cmp    %rdx,%rbx
+  802e1a:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e1e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e22:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e25:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802e2c:	00 00 00 
+  802e2f:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802e31:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802e35:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802e39:	be 00 00 00 00       	mov    $0x0,%esi
+  802e3e:	bf 03 00 00 00       	mov    $0x3,%edi
+  802e43:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802e4a:	00 00 00 
+  802e4d:	ff d0                	call   *%rax
+        if (res <= 0)
+  802e4f:	85 c0                	test   %eax,%eax
+  802e51:	0f 8e 63 01 00 00    	jle    802fba <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802e57:	4c 63 e0             	movslq %eax,%r12
+  802e5a:	4c 89 e2             	mov    %r12,%rdx
+  802e5d:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802e64:	00 00 00 
+  802e67:	4c 89 ff             	mov    %r15,%rdi
+  802e6a:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  802e71:	00 00 00 
+  802e74:	ff d0                	call   *%rax
+        buf += res;
+  802e76:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802e79:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802e7c:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802e80:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802e84:	48 85 db             	test   %rbx,%rbx
+  802e87:	0f 84 25 ff ff ff    	je     802db2 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802e8d:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802e90:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802e94:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802e98:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e9c:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ea3:	0f 97 c2             	seta   %dl
+  802ea6:	20 c2                	and    %al,%dl
+  802ea8:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802eab:	0f 84 5e ff ff ff    	je     802e0f <devfile_read_direct+0xa6>
+  802eb1:	4c 89 fa             	mov    %r15,%rdx
+  802eb4:	4d 89 fd             	mov    %r15,%r13
+  802eb7:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802ebe:	0f 85 4e ff ff ff    	jne    802e12 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802ec4:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802ec8:	0f 84 1a ff ff ff    	je     802de8 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ece:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802ed5:	0f 85 37 ff ff ff    	jne    802e12 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802edb:	48 89 d8             	mov    %rbx,%rax
+  802ede:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ee4:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802ee9:	48 39 c8             	cmp    %rcx,%rax
+  802eec:	48 0f 47 c1          	cmova  %rcx,%rax
+  802ef0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802ef4:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802ef8:	49 89 d4             	mov    %rdx,%r12
+  802efb:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802eff:	48 b8 da 41 80 00 00 	movabs $0x8041da,%rax
+  802f06:	00 00 00 
+  802f09:	ff d0                	call   *%rax
+  802f0b:	a8 40                	test   $0x40,%al
+  802f0d:	0f 85 b9 00 00 00    	jne    802fcc <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f13:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802f1a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f1e:	49 39 c5             	cmp    %rax,%r13
+  802f21:	72 d8                	jb     802efb <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f23:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f27:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f2e:	00 00 00 
+  802f31:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f35:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802f38:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802f3a:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802f3e:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802f42:	48 b8 4f 21 80 00 00 	movabs $0x80214f,%rax
+  802f49:	00 00 00 
+  802f4c:	ff d0                	call   *%rax
+  802f4e:	89 c7                	mov    %eax,%edi
+  802f50:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802f56:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802f5b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802f62:	00 00 00 
+  802f65:	be 0e 00 00 00       	mov    $0xe,%esi
+  802f6a:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  802f71:	00 00 00 
+  802f74:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802f76:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802f7b:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802f7f:	4c 89 fe             	mov    %r15,%rsi
+  802f82:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f87:	48 b8 44 19 80 00 00 	movabs $0x801944,%rax
+  802f8e:	00 00 00 
+  802f91:	ff d0                	call   *%rax
+  802f93:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802f96:	48 85 d2             	test   %rdx,%rdx
+  802f99:	0f 84 5a fe ff ff    	je     802df9 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802f9f:	0f 8e 5a fe ff ff    	jle    802dff <devfile_read_direct+0x96>
+                buf += res;
+  802fa5:	48 98                	cltq
+  802fa7:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802faa:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802fad:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802fb1:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802fb5:	e9 ca fe ff ff       	jmp    802e84 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802fba:	41 89 c5             	mov    %eax,%r13d
+  802fbd:	48 98                	cltq
+  802fbf:	45 85 ed             	test   %r13d,%r13d
+  802fc2:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802fc7:	e9 0d fe ff ff       	jmp    802dd9 <devfile_read_direct+0x70>
+            map = 0;
+  802fcc:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802fd0:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802fd4:	e9 39 fe ff ff       	jmp    802e12 <devfile_read_direct+0xa9>
+  802fd9:	48 89 d0             	mov    %rdx,%rax
+  802fdc:	e9 f8 fd ff ff       	jmp    802dd9 <devfile_read_direct+0x70>
+
+0000000000802fe1 <devfile_read>:
+    if (!fd || !buf)
+  802fe1:	48 85 ff             	test   %rdi,%rdi
+  802fe4:	0f 84 21 02 00 00    	je     80320b <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802fea:	55                   	push   %rbp
+  802feb:	48 89 e5             	mov    %rsp,%rbp
+  802fee:	41 57                	push   %r15
+  802ff0:	41 56                	push   %r14
+  802ff2:	41 55                	push   %r13
+  802ff4:	41 54                	push   %r12
+  802ff6:	53                   	push   %rbx
+  802ff7:	48 83 ec 28          	sub    $0x28,%rsp
+  802ffb:	48 89 fb             	mov    %rdi,%rbx
+  802ffe:	49 89 f4             	mov    %rsi,%r12
+  803001:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803004:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803009:	48 85 f6             	test   %rsi,%rsi
+  80300c:	74 4b                	je     803059 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  80300e:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+  80301a:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  80301d:	48 85 c0             	test   %rax,%rax
+  803020:	74 22                	je     803044 <devfile_read+0x63>
+  803022:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  803029:	77 19                	ja     803044 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80302b:	be 00 10 00 00       	mov    $0x1000,%esi
+  803030:	48 89 df             	mov    %rbx,%rdi
+  803033:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  80303a:	00 00 00 
+  80303d:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  80303f:	83 f8 02             	cmp    $0x2,%eax
+  803042:	7e 40                	jle    803084 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803044:	48 89 df             	mov    %rbx,%rdi
+  803047:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  80304e:	00 00 00 
+  803051:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803053:	85 c0                	test   %eax,%eax
+  803055:	79 11                	jns    803068 <devfile_read+0x87>
+  803057:	48 98                	cltq
+}
+  803059:	48 83 c4 28          	add    $0x28,%rsp
+  80305d:	5b                   	pop    %rbx
+  80305e:	41 5c                	pop    %r12
+  803060:	41 5d                	pop    %r13
+  803062:	41 5e                	pop    %r14
+  803064:	41 5f                	pop    %r15
+  803066:	5d                   	pop    %rbp
+  803067:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803068:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80306d:	4c 89 ea             	mov    %r13,%rdx
+  803070:	4c 89 e6             	mov    %r12,%rsi
+  803073:	48 89 df             	mov    %rbx,%rdi
+  803076:	48 b8 69 2d 80 00 00 	movabs $0x802d69,%rax
+  80307d:	00 00 00 
+  803080:	ff d0                	call   *%rax
+  803082:	eb d5                	jmp    803059 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803084:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803088:	48 89 df             	mov    %rbx,%rdi
+  80308b:	48 b8 6b 2a 80 00 00 	movabs $0x802a6b,%rax
+  803092:	00 00 00 
+  803095:	ff d0                	call   *%rax
+  803097:	85 c0                	test   %eax,%eax
+  803099:	0f 88 33 01 00 00    	js     8031d2 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  80309f:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  8030a6:	00 00 00 
+  8030a9:	4c 89 f0             	mov    %r14,%rax
+  8030ac:	48 29 d0             	sub    %rdx,%rax
+  8030af:	48 c1 f8 03          	sar    $0x3,%rax
+  8030b3:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8030ba:	aa aa aa 
+  8030bd:	48 0f af c2          	imul   %rdx,%rax
+  8030c1:	48 c1 e0 0e          	shl    $0xe,%rax
+  8030c5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030c9:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8030cc:	41 39 06             	cmp    %eax,(%r14)
+  8030cf:	75 0d                	jne    8030de <devfile_read+0xfd>
+  8030d1:	8b 43 10             	mov    0x10(%rbx),%eax
+  8030d4:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  8030d8:	0f 84 fb 00 00 00    	je     8031d9 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  8030de:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030e3:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  8030e7:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  8030ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8030ee:	48 89 c7             	mov    %rax,%rdi
+  8030f1:	48 b8 39 42 80 00 00 	movabs $0x804239,%rax
+  8030f8:	00 00 00 
+  8030fb:	ff d0                	call   *%rax
+  8030fd:	84 c0                	test   %al,%al
+  8030ff:	75 27                	jne    803128 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803101:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803106:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80310b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80310f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803114:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803120:	85 c0                	test   %eax,%eax
+  803122:	0f 88 dc 00 00 00    	js     803204 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803128:	44 89 f8             	mov    %r15d,%eax
+  80312b:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803130:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803132:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803139:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80313a:	8b 43 10             	mov    0x10(%rbx),%eax
+  80313d:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803141:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803144:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803149:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80314d:	48 89 df             	mov    %rbx,%rdi
+  803150:	48 b8 69 2d 80 00 00 	movabs $0x802d69,%rax
+  803157:	00 00 00 
+  80315a:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80315c:	48 85 c0             	test   %rax,%rax
+  80315f:	0f 88 f4 fe ff ff    	js     803059 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803165:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803168:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80316b:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  80316e:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803172:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803176:	48 63 d1             	movslq %ecx,%rdx
+  803179:	48 01 d0             	add    %rdx,%rax
+  80317c:	4d 63 ff             	movslq %r15d,%r15
+  80317f:	4c 29 f8             	sub    %r15,%rax
+  803182:	ba 00 00 00 00       	mov    $0x0,%edx
+  803187:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80318b:	48 85 c0             	test   %rax,%rax
+  80318e:	0f 8e c5 fe ff ff    	jle    803059 <devfile_read+0x78>
+    n = MIN(n, res);
+  803194:	4c 39 e8             	cmp    %r13,%rax
+  803197:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80319b:	8b 73 04             	mov    0x4(%rbx),%esi
+  80319e:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8031a2:	48 63 f6             	movslq %esi,%rsi
+  8031a5:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8031aa:	48 01 c6             	add    %rax,%rsi
+  8031ad:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8031b1:	48 01 c6             	add    %rax,%rsi
+  8031b4:	4c 89 ea             	mov    %r13,%rdx
+  8031b7:	4c 89 e7             	mov    %r12,%rdi
+  8031ba:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8031c1:	00 00 00 
+  8031c4:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8031c6:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8031ca:	4c 89 e8             	mov    %r13,%rax
+  8031cd:	e9 87 fe ff ff       	jmp    803059 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8031d2:	48 98                	cltq
+  8031d4:	e9 80 fe ff ff       	jmp    803059 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031d9:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8031dd:	41 39 d7             	cmp    %edx,%r15d
+  8031e0:	0f 8c f8 fe ff ff    	jl     8030de <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8031e6:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8031ea:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8031ed:	41 39 cf             	cmp    %ecx,%r15d
+  8031f0:	0f 8d e8 fe ff ff    	jge    8030de <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8031f6:	4d 63 ff             	movslq %r15d,%r15
+  8031f9:	4c 29 f8             	sub    %r15,%rax
+  8031fc:	48 63 d2             	movslq %edx,%rdx
+  8031ff:	48 01 d0             	add    %rdx,%rax
+  803202:	eb 87                	jmp    80318b <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803204:	48 98                	cltq
+  803206:	e9 4e fe ff ff       	jmp    803059 <devfile_read+0x78>
+        return E_INVAL;
+  80320b:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803210:	c3                   	ret
+
+0000000000803211 <fs_channel>:
+fs_channel(bool enable) {
+  803211:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803213:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80321a:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  80321c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803221:	40 84 ff             	test   %dil,%dil
+  803224:	74 47                	je     80326d <fs_channel+0x5c>
+  803226:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80322d:	00 00 00 
+  803230:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803236:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  80323d:	00 00 00 
+  803240:	3b 08                	cmp    (%rax),%ecx
+  803242:	74 29                	je     80326d <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803244:	55                   	push   %rbp
+  803245:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803248:	48 b8 91 21 80 00 00 	movabs $0x802191,%rax
+  80324f:	00 00 00 
+  803252:	ff d0                	call   *%rax
+  803254:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803256:	85 c0                	test   %eax,%eax
+  803258:	78 04                	js     80325e <fs_channel+0x4d>
+}
+  80325a:	89 d0                	mov    %edx,%eax
+  80325c:	5d                   	pop    %rbp
+  80325d:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  80325e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803265:	00 00 00 
+  803268:	c6 00 00             	movb   $0x0,(%rax)
+  80326b:	eb ed                	jmp    80325a <fs_channel+0x49>
+}
+  80326d:	89 d0                	mov    %edx,%eax
+  80326f:	c3                   	ret
+
+0000000000803270 <open>:
+open(const char *path, int mode) {
+  803270:	55                   	push   %rbp
+  803271:	48 89 e5             	mov    %rsp,%rbp
+  803274:	41 55                	push   %r13
+  803276:	41 54                	push   %r12
+  803278:	53                   	push   %rbx
+  803279:	48 83 ec 18          	sub    $0x18,%rsp
+  80327d:	49 89 fc             	mov    %rdi,%r12
+  803280:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803283:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+  80328f:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803295:	0f 87 8f 00 00 00    	ja     80332a <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80329b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80329f:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  8032a6:	00 00 00 
+  8032a9:	ff d0                	call   *%rax
+  8032ab:	89 c3                	mov    %eax,%ebx
+  8032ad:	85 c0                	test   %eax,%eax
+  8032af:	78 55                	js     803306 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8032b1:	4c 89 e6             	mov    %r12,%rsi
+  8032b4:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8032bb:	00 00 00 
+  8032be:	48 89 df             	mov    %rbx,%rdi
+  8032c1:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  8032c8:	00 00 00 
+  8032cb:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8032cd:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  8032d4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d9:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8032dd:	bf 01 00 00 00       	mov    $0x1,%edi
+  8032e2:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+  8032ee:	89 c3                	mov    %eax,%ebx
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	78 1f                	js     803313 <open+0xa3>
+    return fd2num(fd);
+  8032f4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032f8:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  8032ff:	00 00 00 
+  803302:	ff d0                	call   *%rax
+  803304:	89 c3                	mov    %eax,%ebx
+}
+  803306:	89 d8                	mov    %ebx,%eax
+  803308:	48 83 c4 18          	add    $0x18,%rsp
+  80330c:	5b                   	pop    %rbx
+  80330d:	41 5c                	pop    %r12
+  80330f:	41 5d                	pop    %r13
+  803311:	5d                   	pop    %rbp
+  803312:	c3                   	ret
+        fd_close(fd, 0);
+  803313:	be 00 00 00 00       	mov    $0x0,%esi
+  803318:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80331c:	48 b8 66 1b 80 00 00 	movabs $0x801b66,%rax
+  803323:	00 00 00 
+  803326:	ff d0                	call   *%rax
+        return res;
+  803328:	eb dc                	jmp    803306 <open+0x96>
+        return -E_BAD_PATH;
+  80332a:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80332f:	eb d5                	jmp    803306 <open+0x96>
+
+0000000000803331 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803331:	55                   	push   %rbp
+  803332:	48 89 e5             	mov    %rsp,%rbp
+  803335:	41 56                	push   %r14
+  803337:	41 55                	push   %r13
+  803339:	41 54                	push   %r12
+  80333b:	53                   	push   %rbx
+  80333c:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803340:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803347:	00 00 00 
+  80334a:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80334f:	49 bd ab 1a 80 00 00 	movabs $0x801aab,%r13
+  803356:	00 00 00 
+  803359:	49 be 6b 2a 80 00 00 	movabs $0x802a6b,%r14
+  803360:	00 00 00 
+  803363:	eb 0c                	jmp    803371 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803365:	83 c3 01             	add    $0x1,%ebx
+  803368:	49 83 c4 18          	add    $0x18,%r12
+  80336c:	83 fb 20             	cmp    $0x20,%ebx
+  80336f:	74 1d                	je     80338e <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803371:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803376:	74 ed                	je     803365 <file_flush_buffers+0x34>
+  803378:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80337c:	89 df                	mov    %ebx,%edi
+  80337e:	41 ff d5             	call   *%r13
+  803381:	85 c0                	test   %eax,%eax
+  803383:	78 e0                	js     803365 <file_flush_buffers+0x34>
+  803385:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803389:	41 ff d6             	call   *%r14
+  80338c:	eb d7                	jmp    803365 <file_flush_buffers+0x34>
+}
+  80338e:	48 83 c4 10          	add    $0x10,%rsp
+  803392:	5b                   	pop    %rbx
+  803393:	41 5c                	pop    %r12
+  803395:	41 5d                	pop    %r13
+  803397:	41 5e                	pop    %r14
+  803399:	5d                   	pop    %rbp
+  80339a:	c3                   	ret
+
+000000000080339b <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80339b:	55                   	push   %rbp
+  80339c:	48 89 e5             	mov    %rsp,%rbp
+  80339f:	41 54                	push   %r12
+  8033a1:	53                   	push   %rbx
+  8033a2:	49 89 fc             	mov    %rdi,%r12
+  8033a5:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8033a7:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  8033ae:	00 00 00 
+  8033b1:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8033b3:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033ba:	00 00 00 
+  8033bd:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8033c2:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8033c4:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8033c7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033cc:	be 00 00 00 00       	mov    $0x0,%esi
+  8033d1:	bf 02 00 00 00       	mov    $0x2,%edi
+  8033d6:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+}
+  8033e2:	5b                   	pop    %rbx
+  8033e3:	41 5c                	pop    %r12
+  8033e5:	5d                   	pop    %rbp
+  8033e6:	c3                   	ret
+
+00000000008033e7 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8033e7:	55                   	push   %rbp
+  8033e8:	48 89 e5             	mov    %rsp,%rbp
+  8033eb:	41 54                	push   %r12
+  8033ed:	53                   	push   %rbx
+  8033ee:	49 89 fc             	mov    %rdi,%r12
+  8033f1:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8033f4:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803400:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803405:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80340c:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80340e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803413:	be 00 00 00 00       	mov    $0x0,%esi
+  803418:	bf 05 00 00 00       	mov    $0x5,%edi
+  80341d:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  803424:	00 00 00 
+  803427:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803429:	85 c0                	test   %eax,%eax
+  80342b:	78 3d                	js     80346a <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80342d:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803434:	00 00 00 
+  803437:	4c 89 e6             	mov    %r12,%rsi
+  80343a:	48 89 df             	mov    %rbx,%rdi
+  80343d:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  803444:	00 00 00 
+  803447:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803449:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803450:	00 
+  803451:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803457:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80345e:	00 
+  80345f:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803465:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346a:	5b                   	pop    %rbx
+  80346b:	41 5c                	pop    %r12
+  80346d:	5d                   	pop    %rbp
+  80346e:	c3                   	ret
+
+000000000080346f <remove>:
+remove(const char *path) {
+  80346f:	55                   	push   %rbp
+  803470:	48 89 e5             	mov    %rsp,%rbp
+  803473:	53                   	push   %rbx
+  803474:	48 83 ec 08          	sub    $0x8,%rsp
+  803478:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80347b:	48 b8 66 0d 80 00 00 	movabs $0x800d66,%rax
+  803482:	00 00 00 
+  803485:	ff d0                	call   *%rax
+  803487:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80348d:	77 3a                	ja     8034c9 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80348f:	48 89 de             	mov    %rbx,%rsi
+  803492:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803499:	00 00 00 
+  80349c:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  8034a3:	00 00 00 
+  8034a6:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8034a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034ad:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b2:	bf 07 00 00 00       	mov    $0x7,%edi
+  8034b7:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8034be:	00 00 00 
+  8034c1:	ff d0                	call   *%rax
+}
+  8034c3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034c7:	c9                   	leave
+  8034c8:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034c9:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8034ce:	eb f3                	jmp    8034c3 <remove+0x54>
+
+00000000008034d0 <sync>:
+sync(void) {
+  8034d0:	55                   	push   %rbp
+  8034d1:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8034d4:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  8034db:	00 00 00 
+  8034de:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8034e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034e5:	be 00 00 00 00       	mov    $0x0,%esi
+  8034ea:	bf 08 00 00 00       	mov    $0x8,%edi
+  8034ef:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+}
+  8034fb:	5d                   	pop    %rbp
+  8034fc:	c3                   	ret
+
+00000000008034fd <fsync>:
+fsync(int fdnum) {
+  8034fd:	55                   	push   %rbp
+  8034fe:	48 89 e5             	mov    %rsp,%rbp
+  803501:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803505:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803509:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  803510:	00 00 00 
+  803513:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803515:	85 c0                	test   %eax,%eax
+  803517:	78 4b                	js     803564 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803519:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80351d:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803524:	00 00 00 
+  803527:	8b 00                	mov    (%rax),%eax
+  803529:	39 02                	cmp    %eax,(%rdx)
+  80352b:	75 39                	jne    803566 <fsync+0x69>
+    file_flush_buffers();
+  80352d:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  803534:	00 00 00 
+  803537:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803539:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80353d:	8b 40 0c             	mov    0xc(%rax),%eax
+  803540:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803547:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803549:	ba 00 00 00 00       	mov    $0x0,%edx
+  80354e:	be 00 00 00 00       	mov    $0x0,%esi
+  803553:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803558:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80355f:	00 00 00 
+  803562:	ff d0                	call   *%rax
+}
+  803564:	c9                   	leave
+  803565:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803566:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80356b:	eb f7                	jmp    803564 <fsync+0x67>
+
+000000000080356d <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80356d:	55                   	push   %rbp
+  80356e:	48 89 e5             	mov    %rsp,%rbp
+  803571:	53                   	push   %rbx
+  803572:	48 83 ec 08          	sub    $0x8,%rsp
+  803576:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803579:	ba 00 00 00 00       	mov    $0x0,%edx
+  80357e:	be 00 00 00 00       	mov    $0x0,%esi
+  803583:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803588:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80358f:	00 00 00 
+  803592:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803594:	85 c0                	test   %eax,%eax
+  803596:	78 2d                	js     8035c5 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803598:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80359f:	00 00 00 
+  8035a2:	48 8b 10             	mov    (%rax),%rdx
+  8035a5:	48 89 13             	mov    %rdx,(%rbx)
+  8035a8:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8035ac:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8035b0:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8035b4:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8035b8:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8035bc:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8035c0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035c5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8035c9:	c9                   	leave
+  8035ca:	c3                   	ret
+
+00000000008035cb <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8035cb:	55                   	push   %rbp
+  8035cc:	48 89 e5             	mov    %rsp,%rbp
+  8035cf:	53                   	push   %rbx
+  8035d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8035d4:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8035d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035dc:	be 00 00 00 00       	mov    $0x0,%esi
+  8035e1:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8035e6:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  8035ed:	00 00 00 
+  8035f0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035f2:	85 c0                	test   %eax,%eax
+  8035f4:	78 3d                	js     803633 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8035f6:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8035fd:	00 00 00 
+  803600:	48 8b 10             	mov    (%rax),%rdx
+  803603:	48 89 13             	mov    %rdx,(%rbx)
+  803606:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80360a:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80360e:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803612:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803616:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80361a:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80361e:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803622:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803626:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80362a:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80362e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803633:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803637:	c9                   	leave
+  803638:	c3                   	ret
+
+0000000000803639 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803639:	55                   	push   %rbp
+  80363a:	48 89 e5             	mov    %rsp,%rbp
+  80363d:	41 57                	push   %r15
+  80363f:	41 56                	push   %r14
+  803641:	41 55                	push   %r13
+  803643:	41 54                	push   %r12
+  803645:	53                   	push   %rbx
+  803646:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80364a:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803651:	00 
+  803652:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803659:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80365f:	0f 85 43 01 00 00    	jne    8037a8 <munmap+0x16f>
+  803665:	49 89 ff             	mov    %rdi,%r15
+  803668:	4c 39 f7             	cmp    %r14,%rdi
+  80366b:	0f 87 37 01 00 00    	ja     8037a8 <munmap+0x16f>
+  803671:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803678:	00 00 00 
+  80367b:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803681:	eb 2c                	jmp    8036af <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803683:	4c 39 f8             	cmp    %r15,%rax
+  803686:	0f 83 85 00 00 00    	jae    803711 <munmap+0xd8>
+            m->mm_end = start;
+  80368c:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803691:	48 83 c3 18          	add    $0x18,%rbx
+  803695:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80369c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8036a3:	00 00 00 
+  8036a6:	48 39 c3             	cmp    %rax,%rbx
+  8036a9:	0f 84 d0 00 00 00    	je     80377f <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8036af:	49 89 dc             	mov    %rbx,%r12
+  8036b2:	48 8b 03             	mov    (%rbx),%rax
+  8036b5:	4c 39 f0             	cmp    %r14,%rax
+  8036b8:	73 d7                	jae    803691 <munmap+0x58>
+  8036ba:	48 85 c0             	test   %rax,%rax
+  8036bd:	74 d2                	je     803691 <munmap+0x58>
+  8036bf:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036c3:	49 39 d7             	cmp    %rdx,%r15
+  8036c6:	73 c9                	jae    803691 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8036c8:	49 39 d6             	cmp    %rdx,%r14
+  8036cb:	73 b6                	jae    803683 <munmap+0x4a>
+  8036cd:	49 39 c7             	cmp    %rax,%r15
+  8036d0:	76 b1                	jbe    803683 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8036d2:	4c 89 ef             	mov    %r13,%rdi
+  8036d5:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  8036dc:	00 00 00 
+  8036df:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8036e1:	48 85 c0             	test   %rax,%rax
+  8036e4:	0f 84 c5 00 00 00    	je     8037af <munmap+0x176>
+            *tail = *m;
+  8036ea:	48 8b 13             	mov    (%rbx),%rdx
+  8036ed:	48 89 10             	mov    %rdx,(%rax)
+  8036f0:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8036f4:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8036f8:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8036fc:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803700:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803703:	44 89 f2             	mov    %r14d,%edx
+  803706:	2b 13                	sub    (%rbx),%edx
+  803708:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80370b:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80370f:	eb 80                	jmp    803691 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803711:	49 39 d6             	cmp    %rdx,%r14
+  803714:	73 18                	jae    80372e <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803716:	44 89 f2             	mov    %r14d,%edx
+  803719:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80371e:	29 c2                	sub    %eax,%edx
+  803720:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803725:	4d 89 34 24          	mov    %r14,(%r12)
+  803729:	e9 63 ff ff ff       	jmp    803691 <munmap+0x58>
+    m->mm_start = 0;
+  80372e:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803735:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803736:	4c 89 e6             	mov    %r12,%rsi
+  803739:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803740:	00 00 00 
+  803743:	48 29 c6             	sub    %rax,%rsi
+  803746:	48 c1 fe 03          	sar    $0x3,%rsi
+  80374a:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803751:	aa aa aa 
+  803754:	48 0f af f0          	imul   %rax,%rsi
+  803758:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80375c:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803761:	48 01 c6             	add    %rax,%rsi
+  803764:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80376e:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  803775:	00 00 00 
+  803778:	ff d0                	call   *%rax
+}
+  80377a:	e9 12 ff ff ff       	jmp    803691 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80377f:	4c 89 f2             	mov    %r14,%rdx
+  803782:	4c 29 fa             	sub    %r15,%rdx
+  803785:	4c 89 fe             	mov    %r15,%rsi
+  803788:	bf 00 00 00 00       	mov    $0x0,%edi
+  80378d:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  803794:	00 00 00 
+  803797:	ff d0                	call   *%rax
+}
+  803799:	48 83 c4 08          	add    $0x8,%rsp
+  80379d:	5b                   	pop    %rbx
+  80379e:	41 5c                	pop    %r12
+  8037a0:	41 5d                	pop    %r13
+  8037a2:	41 5e                	pop    %r14
+  8037a4:	41 5f                	pop    %r15
+  8037a6:	5d                   	pop    %rbp
+  8037a7:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8037a8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8037ad:	eb ea                	jmp    803799 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8037af:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8037b4:	eb e3                	jmp    803799 <munmap+0x160>
+
+00000000008037b6 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8037b6:	55                   	push   %rbp
+  8037b7:	48 89 e5             	mov    %rsp,%rbp
+  8037ba:	41 57                	push   %r15
+  8037bc:	41 56                	push   %r14
+  8037be:	41 55                	push   %r13
+  8037c0:	41 54                	push   %r12
+  8037c2:	53                   	push   %rbx
+  8037c3:	48 83 ec 28          	sub    $0x28,%rsp
+  8037c7:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8037cb:	49 89 f5             	mov    %rsi,%r13
+  8037ce:	41 89 d6             	mov    %edx,%r14d
+  8037d1:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8037d4:	41 89 cc             	mov    %ecx,%r12d
+  8037d7:	44 89 c7             	mov    %r8d,%edi
+  8037da:	44 89 cb             	mov    %r9d,%ebx
+  8037dd:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8037e1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8037e5:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  8037ec:	00 00 00 
+  8037ef:	ff d0                	call   *%rax
+  8037f1:	41 89 c7             	mov    %eax,%r15d
+  8037f4:	85 c0                	test   %eax,%eax
+  8037f6:	0f 88 ae 01 00 00    	js     8039aa <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8037fc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803800:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803807:	00 00 00 
+  80380a:	8b 32                	mov    (%rdx),%esi
+  80380c:	39 30                	cmp    %esi,(%rax)
+  80380e:	0f 85 7a 02 00 00    	jne    803a8e <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803814:	8b 40 08             	mov    0x8(%rax),%eax
+  803817:	83 e0 03             	and    $0x3,%eax
+  80381a:	83 f8 01             	cmp    $0x1,%eax
+  80381d:	0f 84 76 02 00 00    	je     803a99 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803823:	4d 85 ed             	test   %r13,%r13
+  803826:	0f 84 78 02 00 00    	je     803aa4 <mmap+0x2ee>
+  80382c:	85 db                	test   %ebx,%ebx
+  80382e:	0f 88 70 02 00 00    	js     803aa4 <mmap+0x2ee>
+  803834:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80383a:	41 89 df             	mov    %ebx,%r15d
+  80383d:	0f 85 6c 02 00 00    	jne    803aaf <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803843:	44 89 f0             	mov    %r14d,%eax
+  803846:	83 e0 fd             	and    $0xfffffffd,%eax
+  803849:	83 f8 04             	cmp    $0x4,%eax
+  80384c:	0f 85 68 02 00 00    	jne    803aba <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803852:	44 89 e1             	mov    %r12d,%ecx
+  803855:	83 e1 01             	and    $0x1,%ecx
+  803858:	0f 95 c2             	setne  %dl
+  80385b:	44 89 e0             	mov    %r12d,%eax
+  80385e:	d1 e8                	shr    %eax
+  803860:	83 f0 01             	xor    $0x1,%eax
+  803863:	83 e0 01             	and    $0x1,%eax
+  803866:	38 c2                	cmp    %al,%dl
+  803868:	0f 85 57 02 00 00    	jne    803ac5 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80386e:	85 c9                	test   %ecx,%ecx
+  803870:	74 0a                	je     80387c <mmap+0xc6>
+  803872:	41 f6 c6 02          	test   $0x2,%r14b
+  803876:	0f 85 54 02 00 00    	jne    803ad0 <mmap+0x31a>
+    file_flush_buffers();
+  80387c:	48 b8 31 33 80 00 00 	movabs $0x803331,%rax
+  803883:	00 00 00 
+  803886:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803888:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80388f:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803896:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80389a:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80389d:	41 f6 c4 04          	test   $0x4,%r12b
+  8038a1:	0f 84 15 01 00 00    	je     8039bc <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8038a7:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8038aa:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8038b0:	0f 85 25 02 00 00    	jne    803adb <mmap+0x325>
+  8038b6:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8038ba:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8038c1:	00 00 00 
+  8038c4:	48 39 c2             	cmp    %rax,%rdx
+  8038c7:	0f 82 19 02 00 00    	jb     803ae6 <mmap+0x330>
+  8038cd:	48 39 c7             	cmp    %rax,%rdi
+  8038d0:	0f 87 10 02 00 00    	ja     803ae6 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8038d6:	4c 89 ee             	mov    %r13,%rsi
+  8038d9:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  8038e0:	00 00 00 
+  8038e3:	ff d0                	call   *%rax
+  8038e5:	85 c0                	test   %eax,%eax
+  8038e7:	0f 88 04 02 00 00    	js     803af1 <mmap+0x33b>
+    if (!handler) {
+  8038ed:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8038f4:	00 00 00 
+  8038f7:	80 38 00             	cmpb   $0x0,(%rax)
+  8038fa:	75 2b                	jne    803927 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8038fc:	48 bf d1 26 80 00 00 	movabs $0x8026d1,%rdi
+  803903:	00 00 00 
+  803906:	48 b8 92 47 80 00 00 	movabs $0x804792,%rax
+  80390d:	00 00 00 
+  803910:	ff d0                	call   *%rax
+  803912:	85 c0                	test   %eax,%eax
+  803914:	0f 88 ea 01 00 00    	js     803b04 <mmap+0x34e>
+        handler = 1;
+  80391a:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803921:	00 00 00 
+  803924:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803927:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80392b:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+  803937:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80393a:	48 85 c0             	test   %rax,%rax
+  80393d:	0f 84 c9 01 00 00    	je     803b0c <mmap+0x356>
+    m->mm_start = va;
+  803943:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803946:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80394a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80394e:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803951:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803955:	44 89 e0             	mov    %r12d,%eax
+  803958:	c1 e0 06             	shl    $0x6,%eax
+  80395b:	25 80 00 00 00       	and    $0x80,%eax
+  803960:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803963:	09 f0                	or     %esi,%eax
+  803965:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803969:	41 f6 c4 08          	test   $0x8,%r12b
+  80396d:	74 31                	je     8039a0 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80396f:	48 39 d3             	cmp    %rdx,%rbx
+  803972:	73 2c                	jae    8039a0 <mmap+0x1ea>
+  803974:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803979:	48 89 de             	mov    %rbx,%rsi
+  80397c:	4c 89 f7             	mov    %r14,%rdi
+  80397f:	48 b8 c0 25 80 00 00 	movabs $0x8025c0,%rax
+  803986:	00 00 00 
+  803989:	ff d0                	call   *%rax
+  80398b:	49 89 c4             	mov    %rax,%r12
+  80398e:	48 85 c0             	test   %rax,%rax
+  803991:	0f 8e d7 00 00 00    	jle    803a6e <mmap+0x2b8>
+            va += n;
+  803997:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80399a:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80399e:	72 d4                	jb     803974 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8039a0:	49 8b 06             	mov    (%r14),%rax
+  8039a3:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8039a7:	48 89 06             	mov    %rax,(%rsi)
+}
+  8039aa:	44 89 f8             	mov    %r15d,%eax
+  8039ad:	48 83 c4 28          	add    $0x28,%rsp
+  8039b1:	5b                   	pop    %rbx
+  8039b2:	41 5c                	pop    %r12
+  8039b4:	41 5d                	pop    %r13
+  8039b6:	41 5e                	pop    %r14
+  8039b8:	41 5f                	pop    %r15
+  8039ba:	5d                   	pop    %rbp
+  8039bb:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039bc:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8039c3:	00 00 00 
+  8039c6:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8039c9:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8039d0:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039d3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8039d8:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8039df:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039e2:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8039e9:	00 00 00 
+  8039ec:	48 39 d7             	cmp    %rdx,%rdi
+  8039ef:	73 1c                	jae    803a0d <mmap+0x257>
+        return -E_NO_MEM;
+  8039f1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039f7:	eb b1                	jmp    8039aa <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8039f9:	48 83 c0 01          	add    $0x1,%rax
+  8039fd:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a01:	77 3f                	ja     803a42 <mmap+0x28c>
+  803a03:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803a08:	48 39 d7             	cmp    %rdx,%rdi
+  803a0b:	72 2a                	jb     803a37 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a0d:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a11:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a15:	48 39 d1             	cmp    %rdx,%rcx
+  803a18:	73 df                	jae    8039f9 <mmap+0x243>
+  803a1a:	48 85 c9             	test   %rcx,%rcx
+  803a1d:	74 da                	je     8039f9 <mmap+0x243>
+  803a1f:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a23:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a28:	48 39 d3             	cmp    %rdx,%rbx
+  803a2b:	73 cc                	jae    8039f9 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803a2d:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a35:	eb cc                	jmp    803a03 <mmap+0x24d>
+        return -E_NO_MEM;
+  803a37:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a3d:	e9 68 ff ff ff       	jmp    8039aa <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803a42:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803a47:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803a4e:	00 00 00 
+  803a51:	48 39 c2             	cmp    %rax,%rdx
+  803a54:	0f 82 9f 00 00 00    	jb     803af9 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803a5a:	48 85 db             	test   %rbx,%rbx
+  803a5d:	0f 85 8a fe ff ff    	jne    8038ed <mmap+0x137>
+        return -E_NO_MEM;
+  803a63:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a69:	e9 3c ff ff ff       	jmp    8039aa <mmap+0x1f4>
+        if (n < 0) {
+  803a6e:	0f 89 2c ff ff ff    	jns    8039a0 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803a74:	49 8b 3e             	mov    (%r14),%rdi
+  803a77:	4c 89 ee             	mov    %r13,%rsi
+  803a7a:	48 b8 39 36 80 00 00 	movabs $0x803639,%rax
+  803a81:	00 00 00 
+  803a84:	ff d0                	call   *%rax
+            return n;
+  803a86:	45 89 e7             	mov    %r12d,%r15d
+  803a89:	e9 1c ff ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803a8e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a94:	e9 11 ff ff ff       	jmp    8039aa <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803a99:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a9f:	e9 06 ff ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803aa4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803aaa:	e9 fb fe ff ff       	jmp    8039aa <mmap+0x1f4>
+  803aaf:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ab5:	e9 f0 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803aba:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ac0:	e9 e5 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803ac5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803acb:	e9 da fe ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803ad0:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803ad6:	e9 cf fe ff ff       	jmp    8039aa <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803adb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803ae1:	e9 c4 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+  803ae6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803aec:	e9 b9 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803af1:	41 89 c7             	mov    %eax,%r15d
+  803af4:	e9 b1 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+        return -E_NO_MEM;
+  803af9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803aff:	e9 a6 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803b04:	41 89 c7             	mov    %eax,%r15d
+  803b07:	e9 9e fe ff ff       	jmp    8039aa <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b0c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b12:	e9 93 fe ff ff       	jmp    8039aa <mmap+0x1f4>
+
+0000000000803b17 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803b17:	55                   	push   %rbp
+  803b18:	48 89 e5             	mov    %rsp,%rbp
+  803b1b:	41 54                	push   %r12
+  803b1d:	53                   	push   %rbx
+  803b1e:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b21:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803b28:	00 00 00 
+  803b2b:	ff d0                	call   *%rax
+  803b2d:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803b30:	48 be 00 51 80 00 00 	movabs $0x805100,%rsi
+  803b37:	00 00 00 
+  803b3a:	48 89 df             	mov    %rbx,%rdi
+  803b3d:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  803b44:	00 00 00 
+  803b47:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803b49:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803b4e:	41 2b 04 24          	sub    (%r12),%eax
+  803b52:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803b58:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803b5f:	00 00 00 
+    stat->st_dev = &devpipe;
+  803b62:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803b69:	00 00 00 
+  803b6c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803b73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b78:	5b                   	pop    %rbx
+  803b79:	41 5c                	pop    %r12
+  803b7b:	5d                   	pop    %rbp
+  803b7c:	c3                   	ret
+
+0000000000803b7d <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b7d:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b80:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803b86:	8b 17                	mov    (%rdi),%edx
+  803b88:	85 d2                	test   %edx,%edx
+  803b8a:	75 01                	jne    803b8d <pipe_wakeup+0x10>
+  803b8c:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803b8d:	55                   	push   %rbp
+  803b8e:	48 89 e5             	mov    %rsp,%rbp
+  803b91:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803b94:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803b9a:	be 00 04 00 00       	mov    $0x400,%esi
+  803b9f:	48 b8 8f 16 80 00 00 	movabs $0x80168f,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+}
+  803bab:	5d                   	pop    %rbp
+  803bac:	c3                   	ret
+
+0000000000803bad <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803bad:	55                   	push   %rbp
+  803bae:	48 89 e5             	mov    %rsp,%rbp
+  803bb1:	41 55                	push   %r13
+  803bb3:	41 54                	push   %r12
+  803bb5:	53                   	push   %rbx
+  803bb6:	48 83 ec 08          	sub    $0x8,%rsp
+  803bba:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bbd:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803bc4:	00 00 00 
+  803bc7:	ff d0                	call   *%rax
+  803bc9:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803bcc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bd1:	4c 89 e6             	mov    %r12,%rsi
+  803bd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bd9:	49 bc a9 13 80 00 00 	movabs $0x8013a9,%r12
+  803be0:	00 00 00 
+  803be3:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803be6:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803bea:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803bee:	49 bd 7d 3b 80 00 00 	movabs $0x803b7d,%r13
+  803bf5:	00 00 00 
+  803bf8:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803bfb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803bff:	48 89 de             	mov    %rbx,%rsi
+  803c02:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803c05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c0a:	48 89 de             	mov    %rbx,%rsi
+  803c0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c12:	41 ff d4             	call   *%r12
+  803c15:	48 83 c4 08          	add    $0x8,%rsp
+  803c19:	5b                   	pop    %rbx
+  803c1a:	41 5c                	pop    %r12
+  803c1c:	41 5d                	pop    %r13
+  803c1e:	5d                   	pop    %rbp
+  803c1f:	c3                   	ret
+
+0000000000803c20 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803c20:	55                   	push   %rbp
+  803c21:	48 89 e5             	mov    %rsp,%rbp
+  803c24:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803c27:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803c2c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803c31:	48 b8 ec 12 80 00 00 	movabs $0x8012ec,%rax
+  803c38:	00 00 00 
+  803c3b:	ff d0                	call   *%rax
+  803c3d:	85 c0                	test   %eax,%eax
+  803c3f:	0f 94 c0             	sete   %al
+  803c42:	0f b6 c0             	movzbl %al,%eax
+}
+  803c45:	5d                   	pop    %rbp
+  803c46:	c3                   	ret
+
+0000000000803c47 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803c47:	55                   	push   %rbp
+  803c48:	48 89 e5             	mov    %rsp,%rbp
+  803c4b:	41 57                	push   %r15
+  803c4d:	41 56                	push   %r14
+  803c4f:	41 55                	push   %r13
+  803c51:	41 54                	push   %r12
+  803c53:	53                   	push   %rbx
+  803c54:	48 83 ec 38          	sub    $0x38,%rsp
+  803c58:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803c5c:	49 89 f4             	mov    %rsi,%r12
+  803c5f:	49 89 d7             	mov    %rdx,%r15
+  803c62:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c66:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c75:	4d 85 ff             	test   %r15,%r15
+  803c78:	0f 84 f1 00 00 00    	je     803d6f <devpipe_write+0x128>
+  803c7e:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803c82:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803c86:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803c8a:	49 bd 20 3c 80 00 00 	movabs $0x803c20,%r13
+  803c91:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c94:	49 bf 7d 3b 80 00 00 	movabs $0x803b7d,%r15
+  803c9b:	00 00 00 
+  803c9e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803ca2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ca6:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803caa:	8b 73 04             	mov    0x4(%rbx),%esi
+  803cad:	48 63 ce             	movslq %esi,%rcx
+  803cb0:	48 63 03             	movslq (%rbx),%rax
+  803cb3:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803cb9:	48 39 c1             	cmp    %rax,%rcx
+  803cbc:	72 64                	jb     803d22 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cbe:	48 89 de             	mov    %rbx,%rsi
+  803cc1:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cc5:	41 ff d5             	call   *%r13
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	0f 85 b9 00 00 00    	jne    803d89 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cd0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803cd4:	4c 89 f7             	mov    %r14,%rdi
+  803cd7:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803cda:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cdd:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803ce4:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ceb:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cf1:	8b 03                	mov    (%rbx),%eax
+  803cf3:	41 39 c4             	cmp    %eax,%r12d
+  803cf6:	75 b2                	jne    803caa <devpipe_write+0x63>
+  803cf8:	48 89 de             	mov    %rbx,%rsi
+  803cfb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cff:	41 ff d5             	call   *%r13
+  803d02:	85 c0                	test   %eax,%eax
+  803d04:	75 a0                	jne    803ca6 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d06:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d0b:	44 89 e6             	mov    %r12d,%esi
+  803d0e:	48 89 df             	mov    %rbx,%rdi
+  803d11:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+  803d1d:	e9 7c ff ff ff       	jmp    803c9e <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803d22:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803d26:	41 0f b6 38          	movzbl (%r8),%edi
+  803d2a:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d31:	80 80 80 
+  803d34:	48 89 c8             	mov    %rcx,%rax
+  803d37:	48 f7 e2             	mul    %rdx
+  803d3a:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d3e:	48 89 d0             	mov    %rdx,%rax
+  803d41:	48 c1 e0 08          	shl    $0x8,%rax
+  803d45:	48 29 d0             	sub    %rdx,%rax
+  803d48:	48 c1 e0 04          	shl    $0x4,%rax
+  803d4c:	48 29 c1             	sub    %rax,%rcx
+  803d4f:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803d54:	83 c6 01             	add    $0x1,%esi
+  803d57:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d5a:	49 83 c0 01          	add    $0x1,%r8
+  803d5e:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803d62:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803d66:	49 39 c0             	cmp    %rax,%r8
+  803d69:	0f 85 2f ff ff ff    	jne    803c9e <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803d6f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803d73:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803d77:	48 b8 7d 3b 80 00 00 	movabs $0x803b7d,%rax
+  803d7e:	00 00 00 
+  803d81:	ff d0                	call   *%rax
+    return n;
+  803d83:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803d87:	eb 05                	jmp    803d8e <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d89:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803d8e:	48 83 c4 38          	add    $0x38,%rsp
+  803d92:	5b                   	pop    %rbx
+  803d93:	41 5c                	pop    %r12
+  803d95:	41 5d                	pop    %r13
+  803d97:	41 5e                	pop    %r14
+  803d99:	41 5f                	pop    %r15
+  803d9b:	5d                   	pop    %rbp
+  803d9c:	c3                   	ret
+
+0000000000803d9d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803d9d:	55                   	push   %rbp
+  803d9e:	48 89 e5             	mov    %rsp,%rbp
+  803da1:	41 57                	push   %r15
+  803da3:	41 56                	push   %r14
+  803da5:	41 55                	push   %r13
+  803da7:	41 54                	push   %r12
+  803da9:	53                   	push   %rbx
+  803daa:	48 83 ec 28          	sub    $0x28,%rsp
+  803dae:	49 89 fd             	mov    %rdi,%r13
+  803db1:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803db5:	49 89 d4             	mov    %rdx,%r12
+  803db8:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dbc:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803dc3:	00 00 00 
+  803dc6:	ff d0                	call   *%rax
+  803dc8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803dcb:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803dd1:	49 bf 20 3c 80 00 00 	movabs $0x803c20,%r15
+  803dd8:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ddb:	4d 85 e4             	test   %r12,%r12
+  803dde:	0f 84 d5 00 00 00    	je     803eb9 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803de4:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803de8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803dec:	8b 03                	mov    (%rbx),%eax
+  803dee:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803df1:	75 7a                	jne    803e6d <devpipe_read+0xd0>
+            if (i > 0) {
+  803df3:	4d 85 f6             	test   %r14,%r14
+  803df6:	75 50                	jne    803e48 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803df8:	48 89 de             	mov    %rbx,%rsi
+  803dfb:	4c 89 ef             	mov    %r13,%rdi
+  803dfe:	41 ff d7             	call   *%r15
+  803e01:	85 c0                	test   %eax,%eax
+  803e03:	0f 85 c9 00 00 00    	jne    803ed2 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803e09:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803e0c:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803e13:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803e19:	8b 43 04             	mov    0x4(%rbx),%eax
+  803e1c:	41 39 c4             	cmp    %eax,%r12d
+  803e1f:	75 cb                	jne    803dec <devpipe_read+0x4f>
+  803e21:	48 89 de             	mov    %rbx,%rsi
+  803e24:	4c 89 ef             	mov    %r13,%rdi
+  803e27:	41 ff d7             	call   *%r15
+  803e2a:	85 c0                	test   %eax,%eax
+  803e2c:	75 be                	jne    803dec <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803e2e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803e33:	44 89 e6             	mov    %r12d,%esi
+  803e36:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803e3a:	48 b8 71 16 80 00 00 	movabs $0x801671,%rax
+  803e41:	00 00 00 
+  803e44:	ff d0                	call   *%rax
+  803e46:	eb a4                	jmp    803dec <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e48:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e4c:	48 89 de             	mov    %rbx,%rsi
+  803e4f:	48 b8 7d 3b 80 00 00 	movabs $0x803b7d,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+                return i;
+  803e5b:	4c 89 f0             	mov    %r14,%rax
+}
+  803e5e:	48 83 c4 28          	add    $0x28,%rsp
+  803e62:	5b                   	pop    %rbx
+  803e63:	41 5c                	pop    %r12
+  803e65:	41 5d                	pop    %r13
+  803e67:	41 5e                	pop    %r14
+  803e69:	41 5f                	pop    %r15
+  803e6b:	5d                   	pop    %rbp
+  803e6c:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803e6d:	48 63 c8             	movslq %eax,%rcx
+  803e70:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803e77:	80 80 80 
+  803e7a:	48 89 c8             	mov    %rcx,%rax
+  803e7d:	48 f7 e2             	mul    %rdx
+  803e80:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803e84:	48 89 d0             	mov    %rdx,%rax
+  803e87:	48 c1 e0 08          	shl    $0x8,%rax
+  803e8b:	48 29 d0             	sub    %rdx,%rax
+  803e8e:	48 c1 e0 04          	shl    $0x4,%rax
+  803e92:	48 89 c2             	mov    %rax,%rdx
+  803e95:	48 89 c8             	mov    %rcx,%rax
+  803e98:	48 29 d0             	sub    %rdx,%rax
+  803e9b:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803ea0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ea4:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803ea8:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803eab:	49 83 c6 01          	add    $0x1,%r14
+  803eaf:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803eb3:	0f 85 2b ff ff ff    	jne    803de4 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803eb9:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ebd:	48 89 de             	mov    %rbx,%rsi
+  803ec0:	48 b8 7d 3b 80 00 00 	movabs $0x803b7d,%rax
+  803ec7:	00 00 00 
+  803eca:	ff d0                	call   *%rax
+    return n;
+  803ecc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803ed0:	eb 8c                	jmp    803e5e <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ed2:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ed7:	eb 85                	jmp    803e5e <devpipe_read+0xc1>
+
+0000000000803ed9 <pipe>:
+pipe(int pfd[2]) {
+  803ed9:	55                   	push   %rbp
+  803eda:	48 89 e5             	mov    %rsp,%rbp
+  803edd:	41 55                	push   %r13
+  803edf:	41 54                	push   %r12
+  803ee1:	53                   	push   %rbx
+  803ee2:	48 83 ec 18          	sub    $0x18,%rsp
+  803ee6:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803ee9:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803eed:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  803ef4:	00 00 00 
+  803ef7:	ff d0                	call   *%rax
+  803ef9:	89 c3                	mov    %eax,%ebx
+  803efb:	85 c0                	test   %eax,%eax
+  803efd:	0f 88 a0 01 00 00    	js     8040a3 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803f03:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f08:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f0d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f16:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  803f1d:	00 00 00 
+  803f20:	ff d0                	call   *%rax
+  803f22:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803f24:	85 c0                	test   %eax,%eax
+  803f26:	0f 88 77 01 00 00    	js     8040a3 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f2c:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803f30:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  803f37:	00 00 00 
+  803f3a:	ff d0                	call   *%rax
+  803f3c:	89 c3                	mov    %eax,%ebx
+  803f3e:	85 c0                	test   %eax,%eax
+  803f40:	0f 88 43 01 00 00    	js     804089 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803f46:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f50:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f54:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f59:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  803f60:	00 00 00 
+  803f63:	ff d0                	call   *%rax
+  803f65:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803f67:	85 c0                	test   %eax,%eax
+  803f69:	0f 88 1a 01 00 00    	js     804089 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803f6f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f73:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803f7a:	00 00 00 
+  803f7d:	ff d0                	call   *%rax
+  803f7f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803f82:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803f87:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f8c:	48 89 c6             	mov    %rax,%rsi
+  803f8f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f94:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  803f9b:	00 00 00 
+  803f9e:	ff d0                	call   *%rax
+  803fa0:	89 c3                	mov    %eax,%ebx
+  803fa2:	85 c0                	test   %eax,%eax
+  803fa4:	0f 88 c5 00 00 00    	js     80406f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803faa:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803fae:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  803fb5:	00 00 00 
+  803fb8:	ff d0                	call   *%rax
+  803fba:	48 89 c1             	mov    %rax,%rcx
+  803fbd:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803fc3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803fc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803fce:	4c 89 ee             	mov    %r13,%rsi
+  803fd1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd6:	48 b8 59 13 80 00 00 	movabs $0x801359,%rax
+  803fdd:	00 00 00 
+  803fe0:	ff d0                	call   *%rax
+  803fe2:	89 c3                	mov    %eax,%ebx
+  803fe4:	85 c0                	test   %eax,%eax
+  803fe6:	78 6e                	js     804056 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fe8:	be 00 10 00 00       	mov    $0x1000,%esi
+  803fed:	4c 89 ef             	mov    %r13,%rdi
+  803ff0:	48 b8 c8 12 80 00 00 	movabs $0x8012c8,%rax
+  803ff7:	00 00 00 
+  803ffa:	ff d0                	call   *%rax
+  803ffc:	83 f8 02             	cmp    $0x2,%eax
+  803fff:	0f 85 ab 00 00 00    	jne    8040b0 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804005:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  80400c:	00 00 
+  80400e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804012:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804014:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804018:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  80401f:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804023:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804025:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804029:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804030:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804034:	48 bb 1d 1a 80 00 00 	movabs $0x801a1d,%rbx
+  80403b:	00 00 00 
+  80403e:	ff d3                	call   *%rbx
+  804040:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804044:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804048:	ff d3                	call   *%rbx
+  80404a:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80404f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804054:	eb 4d                	jmp    8040a3 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804056:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80405b:	4c 89 ee             	mov    %r13,%rsi
+  80405e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804063:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  80406a:	00 00 00 
+  80406d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80406f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804074:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804078:	bf 00 00 00 00       	mov    $0x0,%edi
+  80407d:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  804084:	00 00 00 
+  804087:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804089:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80408e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804092:	bf 00 00 00 00       	mov    $0x0,%edi
+  804097:	48 b8 a9 13 80 00 00 	movabs $0x8013a9,%rax
+  80409e:	00 00 00 
+  8040a1:	ff d0                	call   *%rax
+}
+  8040a3:	89 d8                	mov    %ebx,%eax
+  8040a5:	48 83 c4 18          	add    $0x18,%rsp
+  8040a9:	5b                   	pop    %rbx
+  8040aa:	41 5c                	pop    %r12
+  8040ac:	41 5d                	pop    %r13
+  8040ae:	5d                   	pop    %rbp
+  8040af:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8040b0:	48 b9 30 51 80 00 00 	movabs $0x805130,%rcx
+  8040b7:	00 00 00 
+  8040ba:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  8040c1:	00 00 00 
+  8040c4:	be 50 00 00 00       	mov    $0x50,%esi
+  8040c9:	48 bf 1c 51 80 00 00 	movabs $0x80511c,%rdi
+  8040d0:	00 00 00 
+  8040d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040d8:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  8040df:	00 00 00 
+  8040e2:	41 ff d0             	call   *%r8
+
+00000000008040e5 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8040e5:	55                   	push   %rbp
+  8040e6:	48 89 e5             	mov    %rsp,%rbp
+  8040e9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8040ed:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8040f1:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  8040f8:	00 00 00 
+  8040fb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040fd:	85 c0                	test   %eax,%eax
+  8040ff:	78 23                	js     804124 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804101:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804105:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+  804111:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804114:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804118:	48 b8 20 3c 80 00 00 	movabs $0x803c20,%rax
+  80411f:	00 00 00 
+  804122:	ff d0                	call   *%rax
+}
+  804124:	c9                   	leave
+  804125:	c3                   	ret
+
+0000000000804126 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804126:	48 89 f8             	mov    %rdi,%rax
+  804129:	48 c1 e8 27          	shr    $0x27,%rax
+  80412d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804134:	01 00 00 
+  804137:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80413b:	f6 c2 01             	test   $0x1,%dl
+  80413e:	74 6d                	je     8041ad <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804140:	48 89 f8             	mov    %rdi,%rax
+  804143:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804147:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80414e:	01 00 00 
+  804151:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804155:	f6 c2 01             	test   $0x1,%dl
+  804158:	74 62                	je     8041bc <get_uvpt_entry+0x96>
+  80415a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804161:	01 00 00 
+  804164:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804168:	f6 c2 80             	test   $0x80,%dl
+  80416b:	75 4f                	jne    8041bc <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80416d:	48 89 f8             	mov    %rdi,%rax
+  804170:	48 c1 e8 15          	shr    $0x15,%rax
+  804174:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80417b:	01 00 00 
+  80417e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804182:	f6 c2 01             	test   $0x1,%dl
+  804185:	74 44                	je     8041cb <get_uvpt_entry+0xa5>
+  804187:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80418e:	01 00 00 
+  804191:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804195:	f6 c2 80             	test   $0x80,%dl
+  804198:	75 31                	jne    8041cb <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80419a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80419e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8041a5:	01 00 00 
+  8041a8:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8041ac:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8041ad:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8041b4:	01 00 00 
+  8041b7:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041bb:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8041bc:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8041c3:	01 00 00 
+  8041c6:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041ca:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8041cb:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8041d2:	01 00 00 
+  8041d5:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8041d9:	c3                   	ret
+
+00000000008041da <get_prot>:
+
+int
+get_prot(void *va) {
+  8041da:	55                   	push   %rbp
+  8041db:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8041de:	48 b8 26 41 80 00 00 	movabs $0x804126,%rax
+  8041e5:	00 00 00 
+  8041e8:	ff d0                	call   *%rax
+  8041ea:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8041ed:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8041f2:	89 c1                	mov    %eax,%ecx
+  8041f4:	83 c9 04             	or     $0x4,%ecx
+  8041f7:	f6 c2 01             	test   $0x1,%dl
+  8041fa:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8041fd:	89 c1                	mov    %eax,%ecx
+  8041ff:	83 c9 02             	or     $0x2,%ecx
+  804202:	f6 c2 02             	test   $0x2,%dl
+  804205:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804208:	89 c1                	mov    %eax,%ecx
+  80420a:	83 c9 01             	or     $0x1,%ecx
+  80420d:	48 85 d2             	test   %rdx,%rdx
+  804210:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804213:	89 c1                	mov    %eax,%ecx
+  804215:	83 c9 40             	or     $0x40,%ecx
+  804218:	f6 c6 04             	test   $0x4,%dh
+  80421b:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  80421e:	5d                   	pop    %rbp
+  80421f:	c3                   	ret
+
+0000000000804220 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804220:	55                   	push   %rbp
+  804221:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804224:	48 b8 26 41 80 00 00 	movabs $0x804126,%rax
+  80422b:	00 00 00 
+  80422e:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804230:	48 c1 e8 06          	shr    $0x6,%rax
+  804234:	83 e0 01             	and    $0x1,%eax
+}
+  804237:	5d                   	pop    %rbp
+  804238:	c3                   	ret
+
+0000000000804239 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804239:	55                   	push   %rbp
+  80423a:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80423d:	48 b8 26 41 80 00 00 	movabs $0x804126,%rax
+  804244:	00 00 00 
+  804247:	ff d0                	call   *%rax
+  804249:	83 e0 01             	and    $0x1,%eax
+}
+  80424c:	5d                   	pop    %rbp
+  80424d:	c3                   	ret
+
+000000000080424e <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  80424e:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804255:	01 00 00 
+  804258:	a8 01                	test   $0x1,%al
+  80425a:	75 06                	jne    804262 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80425c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804261:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804262:	55                   	push   %rbp
+  804263:	48 89 e5             	mov    %rsp,%rbp
+  804266:	41 57                	push   %r15
+  804268:	41 56                	push   %r14
+  80426a:	41 55                	push   %r13
+  80426c:	41 54                	push   %r12
+  80426e:	53                   	push   %rbx
+  80426f:	48 83 ec 28          	sub    $0x28,%rsp
+  804273:	49 89 fe             	mov    %rdi,%r14
+  804276:	49 89 f7             	mov    %rsi,%r15
+  804279:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804280:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804281:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804288:	01 00 00 
+  80428b:	e9 ae 00 00 00       	jmp    80433e <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804290:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804297:	49 83 ec 01          	sub    $0x1,%r12
+  80429b:	74 2d                	je     8042ca <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80429d:	48 89 d8             	mov    %rbx,%rax
+  8042a0:	48 c1 e8 0c          	shr    $0xc,%rax
+  8042a4:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8042a9:	f6 c2 01             	test   $0x1,%dl
+  8042ac:	74 e2                	je     804290 <foreach_shared_region+0x42>
+  8042ae:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8042b3:	f6 c4 04             	test   $0x4,%ah
+  8042b6:	74 d8                	je     804290 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8042b8:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8042bf:	4c 89 fa             	mov    %r15,%rdx
+  8042c2:	48 89 df             	mov    %rbx,%rdi
+  8042c5:	41 ff d6             	call   *%r14
+  8042c8:	eb c6                	jmp    804290 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8042ca:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8042d1:	00 
+  8042d2:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8042d7:	74 4a                	je     804323 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8042d9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8042dd:	48 c1 e8 15          	shr    $0x15,%rax
+  8042e1:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8042e8:	01 00 00 
+  8042eb:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042ef:	a8 01                	test   $0x1,%al
+  8042f1:	74 d7                	je     8042ca <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8042f3:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8042f7:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8042fe:	48 39 c3             	cmp    %rax,%rbx
+  804301:	73 c7                	jae    8042ca <foreach_shared_region+0x7c>
+  804303:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80430a:	48 39 d0             	cmp    %rdx,%rax
+  80430d:	4d 19 e4             	sbb    %r12,%r12
+  804310:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804317:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  80431e:	e9 7a ff ff ff       	jmp    80429d <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804323:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80432a:	40 
+  80432b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80432f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804336:	00 00 00 
+  804339:	48 39 c1             	cmp    %rax,%rcx
+  80433c:	74 50                	je     80438e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  80433e:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804342:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804346:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80434d:	01 00 00 
+  804350:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804354:	a8 01                	test   $0x1,%al
+  804356:	74 cb                	je     804323 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804358:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80435c:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804363:	48 39 c1             	cmp    %rax,%rcx
+  804366:	73 bb                	jae    804323 <foreach_shared_region+0xd5>
+  804368:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80436f:	48 39 d0             	cmp    %rdx,%rax
+  804372:	48 19 c0             	sbb    %rax,%rax
+  804375:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80437b:	48 05 00 02 00 00    	add    $0x200,%rax
+  804381:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804385:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804389:	e9 4b ff ff ff       	jmp    8042d9 <foreach_shared_region+0x8b>
+  80438e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804393:	48 83 c4 28          	add    $0x28,%rsp
+  804397:	5b                   	pop    %rbx
+  804398:	41 5c                	pop    %r12
+  80439a:	41 5d                	pop    %r13
+  80439c:	41 5e                	pop    %r14
+  80439e:	41 5f                	pop    %r15
+  8043a0:	5d                   	pop    %rbp
+  8043a1:	c3                   	ret
+
+00000000008043a2 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8043a2:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8043a8:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8043af:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8043b6:	c3                   	ret
+
+00000000008043b7 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8043b7:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043ba:	8b 17                	mov    (%rdi),%edx
+  8043bc:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8043be:	83 f8 0f             	cmp    $0xf,%eax
+  8043c1:	77 13                	ja     8043d6 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8043c3:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043c6:	83 e0 0f             	and    $0xf,%eax
+  8043c9:	48 c1 e0 09          	shl    $0x9,%rax
+  8043cd:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8043d4:	00 
+  8043d5:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8043d6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043db:	c3                   	ret
+
+00000000008043dc <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8043dc:	8b 47 40             	mov    0x40(%rdi),%eax
+  8043df:	83 c0 01             	add    $0x1,%eax
+  8043e2:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8043e5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043eb:	8b 57 04             	mov    0x4(%rdi),%edx
+  8043ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043f3:	85 d2                	test   %edx,%edx
+  8043f5:	75 04                	jne    8043fb <chan_publish+0x1f>
+  8043f7:	83 e0 01             	and    $0x1,%eax
+}
+  8043fa:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8043fb:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8043fe:	85 c0                	test   %eax,%eax
+  804400:	0f 95 c0             	setne  %al
+  804403:	0f b6 c0             	movzbl %al,%eax
+  804406:	eb ef                	jmp    8043f7 <chan_publish+0x1b>
+
+0000000000804408 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804408:	8b 47 40             	mov    0x40(%rdi),%eax
+  80440b:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80440d:	29 d0                	sub    %edx,%eax
+  80440f:	83 e8 01             	sub    $0x1,%eax
+  804412:	83 f8 0f             	cmp    $0xf,%eax
+  804415:	77 12                	ja     804429 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804417:	8b 07                	mov    (%rdi),%eax
+  804419:	83 e0 0f             	and    $0xf,%eax
+  80441c:	48 c1 e0 09          	shl    $0x9,%rax
+  804420:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804427:	00 
+  804428:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804429:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80442e:	c3                   	ret
+
+000000000080442f <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  80442f:	8b 07                	mov    (%rdi),%eax
+  804431:	83 c0 01             	add    $0x1,%eax
+  804434:	89 07                	mov    %eax,(%rdi)
+}
+  804436:	c3                   	ret
+
+0000000000804437 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804437:	55                   	push   %rbp
+  804438:	48 89 e5             	mov    %rsp,%rbp
+  80443b:	53                   	push   %rbx
+  80443c:	48 83 ec 08          	sub    $0x8,%rsp
+  804440:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804443:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80444a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804450:	48 b8 08 44 80 00 00 	movabs $0x804408,%rax
+  804457:	00 00 00 
+  80445a:	ff d0                	call   *%rax
+  80445c:	48 85 c0             	test   %rax,%rax
+  80445f:	74 12                	je     804473 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804461:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80446d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804471:	c9                   	leave
+  804472:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804473:	b8 01 00 00 00       	mov    $0x1,%eax
+  804478:	eb f3                	jmp    80446d <chan_arm+0x36>
+
+000000000080447a <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80447a:	55                   	push   %rbp
+  80447b:	48 89 e5             	mov    %rsp,%rbp
+  80447e:	41 56                	push   %r14
+  804480:	41 55                	push   %r13
+  804482:	41 54                	push   %r12
+  804484:	53                   	push   %rbx
+  804485:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804488:	49 bc 37 44 80 00 00 	movabs $0x804437,%r12
+  80448f:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804492:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804496:	49 bd 71 16 80 00 00 	movabs $0x801671,%r13
+  80449d:	00 00 00 
+    while (chan_arm(r))
+  8044a0:	eb 0d                	jmp    8044af <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8044a2:	8b 33                	mov    (%rbx),%esi
+  8044a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044a9:	4c 89 f7             	mov    %r14,%rdi
+  8044ac:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8044af:	48 89 df             	mov    %rbx,%rdi
+  8044b2:	41 ff d4             	call   *%r12
+  8044b5:	84 c0                	test   %al,%al
+  8044b7:	75 e9                	jne    8044a2 <chan_wait+0x28>
+}
+  8044b9:	5b                   	pop    %rbx
+  8044ba:	41 5c                	pop    %r12
+  8044bc:	41 5d                	pop    %r13
+  8044be:	41 5e                	pop    %r14
+  8044c0:	5d                   	pop    %rbp
+  8044c1:	c3                   	ret
+
+00000000008044c2 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8044c2:	55                   	push   %rbp
+  8044c3:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8044c6:	48 83 c7 40          	add    $0x40,%rdi
+  8044ca:	be 01 00 00 00       	mov    $0x1,%esi
+  8044cf:	48 b8 8f 16 80 00 00 	movabs $0x80168f,%rax
+  8044d6:	00 00 00 
+  8044d9:	ff d0                	call   *%rax
+}
+  8044db:	5d                   	pop    %rbp
+  8044dc:	c3                   	ret
+
+00000000008044dd <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8044dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e2:	c3                   	ret
+
+00000000008044e3 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8044e3:	55                   	push   %rbp
+  8044e4:	48 89 e5             	mov    %rsp,%rbp
+  8044e7:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8044ea:	48 be 54 51 80 00 00 	movabs $0x805154,%rsi
+  8044f1:	00 00 00 
+  8044f4:	48 b8 a4 0d 80 00 00 	movabs $0x800da4,%rax
+  8044fb:	00 00 00 
+  8044fe:	ff d0                	call   *%rax
+    return 0;
+}
+  804500:	b8 00 00 00 00       	mov    $0x0,%eax
+  804505:	5d                   	pop    %rbp
+  804506:	c3                   	ret
+
+0000000000804507 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804507:	55                   	push   %rbp
+  804508:	48 89 e5             	mov    %rsp,%rbp
+  80450b:	41 57                	push   %r15
+  80450d:	41 56                	push   %r14
+  80450f:	41 55                	push   %r13
+  804511:	41 54                	push   %r12
+  804513:	53                   	push   %rbx
+  804514:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80451b:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804522:	48 85 d2             	test   %rdx,%rdx
+  804525:	74 7a                	je     8045a1 <devcons_write+0x9a>
+  804527:	49 89 d6             	mov    %rdx,%r14
+  80452a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804530:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804535:	49 bf 9e 0f 80 00 00 	movabs $0x800f9e,%r15
+  80453c:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  80453f:	4c 89 f3             	mov    %r14,%rbx
+  804542:	48 29 f3             	sub    %rsi,%rbx
+  804545:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80454a:	48 39 c3             	cmp    %rax,%rbx
+  80454d:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804551:	4c 63 eb             	movslq %ebx,%r13
+  804554:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80455b:	48 01 c6             	add    %rax,%rsi
+  80455e:	4c 89 ea             	mov    %r13,%rdx
+  804561:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804568:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80456b:	4c 89 ee             	mov    %r13,%rsi
+  80456e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804575:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  80457c:	00 00 00 
+  80457f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804581:	41 01 dc             	add    %ebx,%r12d
+  804584:	49 63 f4             	movslq %r12d,%rsi
+  804587:	4c 39 f6             	cmp    %r14,%rsi
+  80458a:	72 b3                	jb     80453f <devcons_write+0x38>
+    return res;
+  80458c:	49 63 c4             	movslq %r12d,%rax
+}
+  80458f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804596:	5b                   	pop    %rbx
+  804597:	41 5c                	pop    %r12
+  804599:	41 5d                	pop    %r13
+  80459b:	41 5e                	pop    %r14
+  80459d:	41 5f                	pop    %r15
+  80459f:	5d                   	pop    %rbp
+  8045a0:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8045a1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8045a7:	eb e3                	jmp    80458c <devcons_write+0x85>
+
+00000000008045a9 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045a9:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8045ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045b1:	48 85 c0             	test   %rax,%rax
+  8045b4:	74 55                	je     80460b <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8045b6:	55                   	push   %rbp
+  8045b7:	48 89 e5             	mov    %rsp,%rbp
+  8045ba:	41 55                	push   %r13
+  8045bc:	41 54                	push   %r12
+  8045be:	53                   	push   %rbx
+  8045bf:	48 83 ec 08          	sub    $0x8,%rsp
+  8045c3:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8045c6:	48 bb ea 11 80 00 00 	movabs $0x8011ea,%rbx
+  8045cd:	00 00 00 
+  8045d0:	49 bc 9f 12 80 00 00 	movabs $0x80129f,%r12
+  8045d7:	00 00 00 
+  8045da:	eb 03                	jmp    8045df <devcons_read+0x36>
+  8045dc:	41 ff d4             	call   *%r12
+  8045df:	ff d3                	call   *%rbx
+  8045e1:	85 c0                	test   %eax,%eax
+  8045e3:	74 f7                	je     8045dc <devcons_read+0x33>
+    if (c < 0) return c;
+  8045e5:	48 63 d0             	movslq %eax,%rdx
+  8045e8:	78 13                	js     8045fd <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8045ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8045ef:	83 f8 04             	cmp    $0x4,%eax
+  8045f2:	74 09                	je     8045fd <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8045f4:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8045f8:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8045fd:	48 89 d0             	mov    %rdx,%rax
+  804600:	48 83 c4 08          	add    $0x8,%rsp
+  804604:	5b                   	pop    %rbx
+  804605:	41 5c                	pop    %r12
+  804607:	41 5d                	pop    %r13
+  804609:	5d                   	pop    %rbp
+  80460a:	c3                   	ret
+  80460b:	48 89 d0             	mov    %rdx,%rax
+  80460e:	c3                   	ret
+
+000000000080460f <cputchar>:
+cputchar(int ch) {
+  80460f:	55                   	push   %rbp
+  804610:	48 89 e5             	mov    %rsp,%rbp
+  804613:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804617:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80461b:	be 01 00 00 00       	mov    $0x1,%esi
+  804620:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804624:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  80462b:	00 00 00 
+  80462e:	ff d0                	call   *%rax
+}
+  804630:	c9                   	leave
+  804631:	c3                   	ret
+
+0000000000804632 <getchar>:
+getchar(void) {
+  804632:	55                   	push   %rbp
+  804633:	48 89 e5             	mov    %rsp,%rbp
+  804636:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80463a:	ba 01 00 00 00       	mov    $0x1,%edx
+  80463f:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804643:	bf 00 00 00 00       	mov    $0x0,%edi
+  804648:	48 b8 8e 1d 80 00 00 	movabs $0x801d8e,%rax
+  80464f:	00 00 00 
+  804652:	ff d0                	call   *%rax
+  804654:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804656:	85 c0                	test   %eax,%eax
+  804658:	78 06                	js     804660 <getchar+0x2e>
+  80465a:	74 08                	je     804664 <getchar+0x32>
+  80465c:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804660:	89 d0                	mov    %edx,%eax
+  804662:	c9                   	leave
+  804663:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804664:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804669:	eb f5                	jmp    804660 <getchar+0x2e>
+
+000000000080466b <iscons>:
+iscons(int fdnum) {
+  80466b:	55                   	push   %rbp
+  80466c:	48 89 e5             	mov    %rsp,%rbp
+  80466f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804673:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804677:	48 b8 ab 1a 80 00 00 	movabs $0x801aab,%rax
+  80467e:	00 00 00 
+  804681:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804683:	85 c0                	test   %eax,%eax
+  804685:	78 18                	js     80469f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804687:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80468b:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804692:	00 00 00 
+  804695:	8b 00                	mov    (%rax),%eax
+  804697:	39 02                	cmp    %eax,(%rdx)
+  804699:	0f 94 c0             	sete   %al
+  80469c:	0f b6 c0             	movzbl %al,%eax
+}
+  80469f:	c9                   	leave
+  8046a0:	c3                   	ret
+
+00000000008046a1 <opencons>:
+opencons(void) {
+  8046a1:	55                   	push   %rbp
+  8046a2:	48 89 e5             	mov    %rsp,%rbp
+  8046a5:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8046a9:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8046ad:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  8046b4:	00 00 00 
+  8046b7:	ff d0                	call   *%rax
+  8046b9:	85 c0                	test   %eax,%eax
+  8046bb:	78 49                	js     804706 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8046bd:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8046c2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046c7:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8046cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8046d0:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  8046d7:	00 00 00 
+  8046da:	ff d0                	call   *%rax
+  8046dc:	85 c0                	test   %eax,%eax
+  8046de:	78 26                	js     804706 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8046e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8046e4:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8046eb:	00 00 
+  8046ed:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8046ef:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8046f3:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8046fa:	48 b8 1d 1a 80 00 00 	movabs $0x801a1d,%rax
+  804701:	00 00 00 
+  804704:	ff d0                	call   *%rax
+}
+  804706:	c9                   	leave
+  804707:	c3                   	ret
+
+0000000000804708 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804708:	55                   	push   %rbp
+  804709:	48 89 e5             	mov    %rsp,%rbp
+  80470c:	41 56                	push   %r14
+  80470e:	41 55                	push   %r13
+  804710:	41 54                	push   %r12
+  804712:	53                   	push   %rbx
+  804713:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804716:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80471d:	00 00 00 
+  804720:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804724:	74 27                	je     80474d <_handle_vectored_pagefault+0x45>
+  804726:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80472b:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804732:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804735:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804738:	4c 89 e7             	mov    %r12,%rdi
+  80473b:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804740:	84 c0                	test   %al,%al
+  804742:	75 45                	jne    804789 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804744:	48 83 c3 01          	add    $0x1,%rbx
+  804748:	49 3b 1e             	cmp    (%r14),%rbx
+  80474b:	72 eb                	jb     804738 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80474d:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804754:	00 
+  804755:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80475a:	4d 8b 04 24          	mov    (%r12),%r8
+  80475e:	48 ba 60 51 80 00 00 	movabs $0x805160,%rdx
+  804765:	00 00 00 
+  804768:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80476d:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  804774:	00 00 00 
+  804777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477c:	49 ba 2f 03 80 00 00 	movabs $0x80032f,%r10
+  804783:	00 00 00 
+  804786:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804789:	5b                   	pop    %rbx
+  80478a:	41 5c                	pop    %r12
+  80478c:	41 5d                	pop    %r13
+  80478e:	41 5e                	pop    %r14
+  804790:	5d                   	pop    %rbp
+  804791:	c3                   	ret
+
+0000000000804792 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804792:	55                   	push   %rbp
+  804793:	48 89 e5             	mov    %rsp,%rbp
+  804796:	53                   	push   %rbx
+  804797:	48 83 ec 08          	sub    $0x8,%rsp
+  80479b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80479e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047a5:	00 00 00 
+  8047a8:	80 38 00             	cmpb   $0x0,(%rax)
+  8047ab:	0f 84 84 00 00 00    	je     804835 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047b1:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8047b8:	00 00 00 
+  8047bb:	48 8b 10             	mov    (%rax),%rdx
+  8047be:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047c3:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8047ca:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047cd:	48 85 d2             	test   %rdx,%rdx
+  8047d0:	74 19                	je     8047eb <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047d2:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8047d6:	0f 84 e8 00 00 00    	je     8048c4 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8047dc:	48 83 c0 01          	add    $0x1,%rax
+  8047e0:	48 39 d0             	cmp    %rdx,%rax
+  8047e3:	75 ed                	jne    8047d2 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8047e5:	48 83 fa 08          	cmp    $0x8,%rdx
+  8047e9:	74 1c                	je     804807 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047eb:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8047ef:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8047f6:	00 00 00 
+  8047f9:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804800:	00 00 00 
+  804803:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804807:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  80480e:	00 00 00 
+  804811:	ff d0                	call   *%rax
+  804813:	89 c7                	mov    %eax,%edi
+  804815:	48 be 8a 49 80 00 00 	movabs $0x80498a,%rsi
+  80481c:	00 00 00 
+  80481f:	48 b8 c1 14 80 00 00 	movabs $0x8014c1,%rax
+  804826:	00 00 00 
+  804829:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80482b:	85 c0                	test   %eax,%eax
+  80482d:	78 68                	js     804897 <add_pgfault_handler+0x105>
+    return res;
+}
+  80482f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804833:	c9                   	leave
+  804834:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804835:	48 b8 76 12 80 00 00 	movabs $0x801276,%rax
+  80483c:	00 00 00 
+  80483f:	ff d0                	call   *%rax
+  804841:	89 c7                	mov    %eax,%edi
+  804843:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804848:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80484d:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804854:	00 00 00 
+  804857:	48 b8 03 13 80 00 00 	movabs $0x801303,%rax
+  80485e:	00 00 00 
+  804861:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804863:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80486a:	00 00 00 
+  80486d:	48 8b 02             	mov    (%rdx),%rax
+  804870:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804874:	48 89 0a             	mov    %rcx,(%rdx)
+  804877:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80487e:	00 00 00 
+  804881:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804885:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80488c:	00 00 00 
+  80488f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804892:	e9 70 ff ff ff       	jmp    804807 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804897:	89 c1                	mov    %eax,%ecx
+  804899:	48 ba 9e 51 80 00 00 	movabs $0x80519e,%rdx
+  8048a0:	00 00 00 
+  8048a3:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8048a8:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  8048af:	00 00 00 
+  8048b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048b7:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  8048be:	00 00 00 
+  8048c1:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8048c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8048c9:	e9 61 ff ff ff       	jmp    80482f <add_pgfault_handler+0x9d>
+
+00000000008048ce <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8048ce:	55                   	push   %rbp
+  8048cf:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8048d2:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8048d9:	00 00 00 
+  8048dc:	80 38 00             	cmpb   $0x0,(%rax)
+  8048df:	74 33                	je     804914 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048e1:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8048e8:	00 00 00 
+  8048eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8048f0:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8048f7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8048fa:	48 85 c0             	test   %rax,%rax
+  8048fd:	0f 84 85 00 00 00    	je     804988 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804903:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804907:	74 40                	je     804949 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804909:	48 83 c1 01          	add    $0x1,%rcx
+  80490d:	48 39 c1             	cmp    %rax,%rcx
+  804910:	75 f1                	jne    804903 <remove_pgfault_handler+0x35>
+  804912:	eb 74                	jmp    804988 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804914:	48 b9 b6 51 80 00 00 	movabs $0x8051b6,%rcx
+  80491b:	00 00 00 
+  80491e:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  804925:	00 00 00 
+  804928:	be 43 00 00 00       	mov    $0x43,%esi
+  80492d:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  804934:	00 00 00 
+  804937:	b8 00 00 00 00       	mov    $0x0,%eax
+  80493c:	49 b8 2f 03 80 00 00 	movabs $0x80032f,%r8
+  804943:	00 00 00 
+  804946:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804949:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804950:	00 
+  804951:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804955:	48 29 ca             	sub    %rcx,%rdx
+  804958:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80495f:	00 00 00 
+  804962:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804966:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80496b:	48 89 ce             	mov    %rcx,%rsi
+  80496e:	48 b8 9e 0f 80 00 00 	movabs $0x800f9e,%rax
+  804975:	00 00 00 
+  804978:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80497a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804981:	00 00 00 
+  804984:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804988:	5d                   	pop    %rbp
+  804989:	c3                   	ret
+
+000000000080498a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80498a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80498d:	48 b8 08 47 80 00 00 	movabs $0x804708,%rax
+  804994:	00 00 00 
+    call *%rax
+  804997:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804999:	41 5f                	pop    %r15
+	popq %r15
+  80499b:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80499d:	41 5f                	pop    %r15
+	popq %r14
+  80499f:	41 5e                	pop    %r14
+	popq %r13
+  8049a1:	41 5d                	pop    %r13
+	popq %r12
+  8049a3:	41 5c                	pop    %r12
+	popq %r11
+  8049a5:	41 5b                	pop    %r11
+	popq %r10
+  8049a7:	41 5a                	pop    %r10
+	popq %r9
+  8049a9:	41 59                	pop    %r9
+	popq %r8
+  8049ab:	41 58                	pop    %r8
+	popq %rsi
+  8049ad:	5e                   	pop    %rsi
+	popq %rdi
+  8049ae:	5f                   	pop    %rdi
+	popq %rbp
+  8049af:	5d                   	pop    %rbp
+	popq %rdx
+  8049b0:	5a                   	pop    %rdx
+	popq %rcx
+  8049b1:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8049b2:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8049b7:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8049bc:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8049c0:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8049c3:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8049c8:	5b                   	pop    %rbx
+	popq %rax
+  8049c9:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8049ca:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8049ce:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8049cf:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8049d4:	c3                   	ret
+  8049d5:	0f 1f 00             	nopl   (%rax)
+
+00000000008049d8 <__rodata_start>:
+  8049d8:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049da:	72 6b                	jb     804a47 <__rodata_start+0x6f>
+  8049dc:	3a 20                	cmp    (%rax),%ah
+  8049de:	25 69 00 75 73       	and    $0x73750069,%eax
+  8049e3:	65 72 2f             	gs jb  804a15 <__rodata_start+0x3d>
+  8049e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8049e7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e8:	63 6b 62             	movsxd 0x62(%rbx),%ebp
+  8049eb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049ed:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  8049f0:	63 00                	movsxd (%rax),%eax
+  8049f2:	73 79                	jae    804a6d <__rodata_start+0x95>
+  8049f4:	73 5f                	jae    804a55 <__rodata_start+0x7d>
+  8049f6:	61                   	(bad)
+  8049f7:	6c                   	insb   (%dx),%es:(%rdi)
+  8049f8:	6c                   	insb   (%dx),%es:(%rdi)
+  8049f9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049fa:	63 5f 72             	movsxd 0x72(%rdi),%ebx
+  8049fd:	65 67 69 6f 6e 3a 20 	imul   $0x6925203a,%gs:0x6e(%edi),%ebp
+  804a04:	25 69 
+  804a06:	00 90 6c 6f 63 6b    	add    %dl,0x6b636f6c(%rax)
+  804a0c:	62 65 6e 63 68       	(bad)
+  804a11:	3a 20                	cmp    (%rax),%ah
+  804a13:	25 64 20 77 6f       	and    $0x6f772064,%eax
+  804a18:	72 6b                	jb     804a85 <__rodata_start+0xad>
+  804a1a:	65 72 73             	gs jb  804a90 <__rodata_start+0xb8>
+  804a1d:	3a 20                	cmp    (%rax),%ah
+  804a1f:	61                   	(bad)
+  804a20:	6c                   	insb   (%dx),%es:(%rdi)
+  804a21:	6c                   	insb   (%dx),%es:(%rdi)
+  804a22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a23:	63 20                	movsxd (%rax),%esp
+  804a25:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  804a2a:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804a2d:	6c                   	insb   (%dx),%es:(%rdi)
+  804a2e:	65 73 2c             	gs jae 804a5d <__rodata_start+0x85>
+  804a31:	20 69 70             	and    %ch,0x70(%rcx)
+  804a34:	63 20                	movsxd (%rax),%esp
+  804a36:	25 6c 75 20 4d       	and    $0x4d20756c,%eax
+  804a3b:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804a3e:	6c                   	insb   (%dx),%es:(%rdi)
+  804a3f:	65 73 0a             	gs jae 804a4c <__rodata_start+0x74>
+  804a42:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804a49:	77 6e                	ja     804ab9 <__rodata_start+0xe1>
+  804a4b:	3e 00 0f             	ds add %cl,(%rdi)
+  804a4e:	1f                   	(bad)
+  804a4f:	00 5b 25             	add    %bl,0x25(%rbx)
+  804a52:	30 38                	xor    %bh,(%rax)
+  804a54:	78 5d                	js     804ab3 <__rodata_start+0xdb>
+  804a56:	20 75 73             	and    %dh,0x73(%rbp)
+  804a59:	65 72 20             	gs jb  804a7c <__rodata_start+0xa4>
+  804a5c:	70 61                	jo     804abf <__rodata_start+0xe7>
+  804a5e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a5f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804a66:	73 20                	jae    804a88 <__rodata_start+0xb0>
+  804a68:	61                   	(bad)
+  804a69:	74 20                	je     804a8b <__rodata_start+0xb3>
+  804a6b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804a70:	3a 20                	cmp    (%rax),%ah
+  804a72:	00 30                	add    %dh,(%rax)
+  804a74:	31 32                	xor    %esi,(%rdx)
+  804a76:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a7d:	41                   	rex.B
+  804a7e:	42                   	rex.X
+  804a7f:	43                   	rex.XB
+  804a80:	44                   	rex.R
+  804a81:	45                   	rex.RB
+  804a82:	46 00 30             	rex.RX add %r14b,(%rax)
+  804a85:	31 32                	xor    %esi,(%rdx)
+  804a87:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804a8e:	61                   	(bad)
+  804a8f:	62 63 64 65 66       	(bad)
+  804a94:	00 28                	add    %ch,(%rax)
+  804a96:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a97:	75 6c                	jne    804b05 <__rodata_start+0x12d>
+  804a99:	6c                   	insb   (%dx),%es:(%rdi)
+  804a9a:	29 00                	sub    %eax,(%rax)
+  804a9c:	65 72 72             	gs jb  804b11 <__rodata_start+0x139>
+  804a9f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aa0:	72 20                	jb     804ac2 <__rodata_start+0xea>
+  804aa2:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804aa7:	73 70                	jae    804b19 <__rodata_start+0x141>
+  804aa9:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804aad:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804ab4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ab5:	72 00                	jb     804ab7 <__rodata_start+0xdf>
+  804ab7:	62 61 64 20 65       	(bad)
+  804abc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804abd:	76 69                	jbe    804b28 <__rodata_start+0x150>
+  804abf:	72 6f                	jb     804b30 <__rodata_start+0x158>
+  804ac1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ac2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ac3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ac5:	74 00                	je     804ac7 <__rodata_start+0xef>
+  804ac7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ace:	20 70 61             	and    %dh,0x61(%rax)
+  804ad1:	72 61                	jb     804b34 <__rodata_start+0x15c>
+  804ad3:	6d                   	insl   (%dx),%es:(%rdi)
+  804ad4:	65 74 65             	gs je  804b3c <__rodata_start+0x164>
+  804ad7:	72 00                	jb     804ad9 <__rodata_start+0x101>
+  804ad9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ada:	75 74                	jne    804b50 <__rodata_start+0x178>
+  804adc:	20 6f 66             	and    %ch,0x66(%rdi)
+  804adf:	20 6d 65             	and    %ch,0x65(%rbp)
+  804ae2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ae3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ae4:	72 79                	jb     804b5f <__rodata_start+0x187>
+  804ae6:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ae9:	74 20                	je     804b0b <__rodata_start+0x133>
+  804aeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aec:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804af0:	76 69                	jbe    804b5b <__rodata_start+0x183>
+  804af2:	72 6f                	jb     804b63 <__rodata_start+0x18b>
+  804af4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804af5:	6d                   	insl   (%dx),%es:(%rdi)
+  804af6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804af8:	74 73                	je     804b6d <__rodata_start+0x195>
+  804afa:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804afd:	72 72                	jb     804b71 <__rodata_start+0x199>
+  804aff:	75 70                	jne    804b71 <__rodata_start+0x199>
+  804b01:	74 65                	je     804b68 <__rodata_start+0x190>
+  804b03:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804b08:	75 67                	jne    804b71 <__rodata_start+0x199>
+  804b0a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804b0d:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b0f:	00 73 65             	add    %dh,0x65(%rbx)
+  804b12:	67 6d                	insl   (%dx),%es:(%edi)
+  804b14:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b16:	74 61                	je     804b79 <__rodata_start+0x1a1>
+  804b18:	74 69                	je     804b83 <__rodata_start+0x1ab>
+  804b1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b1b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b1c:	20 66 61             	and    %ah,0x61(%rsi)
+  804b1f:	75 6c                	jne    804b8d <__rodata_start+0x1b5>
+  804b21:	74 00                	je     804b23 <__rodata_start+0x14b>
+  804b23:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b2a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804b2d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804b31:	61                   	(bad)
+  804b32:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804b37:	20 73 75             	and    %dh,0x75(%rbx)
+  804b3a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804b3d:	73 79                	jae    804bb8 <__rodata_start+0x1e0>
+  804b3f:	73 74                	jae    804bb5 <__rodata_start+0x1dd>
+  804b41:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b43:	20 63 61             	and    %ah,0x61(%rbx)
+  804b46:	6c                   	insb   (%dx),%es:(%rdi)
+  804b47:	6c                   	insb   (%dx),%es:(%rdi)
+  804b48:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804b4b:	74 72                	je     804bbf <__rodata_start+0x1e7>
+  804b4d:	79 20                	jns    804b6f <__rodata_start+0x197>
+  804b4f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b51:	74 20                	je     804b73 <__rodata_start+0x19b>
+  804b53:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b55:	75 6e                	jne    804bc5 <__rodata_start+0x1ed>
+  804b57:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804b5b:	76 20                	jbe    804b7d <__rodata_start+0x1a5>
+  804b5d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804b64:	72 65                	jb     804bcb <__rodata_start+0x1f3>
+  804b66:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804b69:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b6a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804b6e:	65 78 70             	gs js  804be1 <__rodata_start+0x209>
+  804b71:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804b76:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804b79:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804b7d:	20 66 69             	and    %ah,0x69(%rsi)
+  804b80:	6c                   	insb   (%dx),%es:(%rdi)
+  804b81:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804b85:	20 66 72             	and    %ah,0x72(%rsi)
+  804b88:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804b8d:	61                   	(bad)
+  804b8e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804b91:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b92:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b93:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804b97:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804b9a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b9c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804b9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ba0:	79 20                	jns    804bc2 <__rodata_start+0x1ea>
+  804ba2:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804ba9:	72 65                	jb     804c10 <__rodata_start+0x238>
+  804bab:	20 6f 70             	and    %ch,0x70(%rdi)
+  804bae:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bb0:	00 66 69             	add    %ah,0x69(%rsi)
+  804bb3:	6c                   	insb   (%dx),%es:(%rdi)
+  804bb4:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804bb8:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bbc:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804bbf:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bc0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bc1:	74 20                	je     804be3 <__rodata_start+0x20b>
+  804bc3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804bc5:	75 6e                	jne    804c35 <__rodata_start+0x25d>
+  804bc7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804bcb:	76 61                	jbe    804c2e <__rodata_start+0x256>
+  804bcd:	6c                   	insb   (%dx),%es:(%rdi)
+  804bce:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804bd5:	00 
+  804bd6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804bdd:	72 65                	jb     804c44 <__rodata_start+0x26c>
+  804bdf:	61                   	(bad)
+  804be0:	64 79 20             	fs jns 804c03 <__rodata_start+0x22b>
+  804be3:	65 78 69             	gs js  804c4f <__rodata_start+0x277>
+  804be6:	73 74                	jae    804c5c <__rodata_start+0x284>
+  804be8:	73 00                	jae    804bea <__rodata_start+0x212>
+  804bea:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804beb:	70 65                	jo     804c52 <__rodata_start+0x27a>
+  804bed:	72 61                	jb     804c50 <__rodata_start+0x278>
+  804bef:	74 69                	je     804c5a <__rodata_start+0x282>
+  804bf1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bf2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bf3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804bf6:	74 20                	je     804c18 <__rodata_start+0x240>
+  804bf8:	73 75                	jae    804c6f <__rodata_start+0x297>
+  804bfa:	70 70                	jo     804c6c <__rodata_start+0x294>
+  804bfc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bfd:	72 74                	jb     804c73 <__rodata_start+0x29b>
+  804bff:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804c05:	20 61 67             	and    %ah,0x67(%rcx)
+  804c08:	61                   	(bad)
+  804c09:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804c10:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804c14:	74 00                	je     804c16 <__rodata_start+0x23e>
+  804c16:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804c1d:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c20:	20 75 73             	and    %dh,0x73(%rbp)
+  804c23:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804c27:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804c2e:	00 
+  804c2f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804c36:	00 00 00 
+  804c39:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  804c40:	6c                   	insb   (%dx),%es:(%rdi)
+  804c41:	06                   	(bad)
+  804c42:	80 00 00             	addb   $0x0,(%rax)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 9d 0c 80 00 00    	add    %bl,0x800c(%rbp)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 8b 06 80 00 00    	add    %cl,0x8006(%rbx)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 7f 06             	add    %bh,0x6(%rdi)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 f9                	add    %bh,%cl
+  804c99:	06                   	(bad)
+  804c9a:	80 00 00             	addb   $0x0,(%rax)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 7f 06             	add    %bh,0x6(%rdi)
+  804caa:	80 00 00             	addb   $0x0,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 c5                	add    %al,%ch
+  804cb1:	06                   	(bad)
+  804cb2:	80 00 00             	addb   $0x0,(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 c5                	add    %al,%ch
+  804cb9:	06                   	(bad)
+  804cba:	80 00 00             	addb   $0x0,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 c5                	add    %al,%ch
+  804cc1:	06                   	(bad)
+  804cc2:	80 00 00             	addb   $0x0,(%rax)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 c5                	add    %al,%ch
+  804cc9:	06                   	(bad)
+  804cca:	80 00 00             	addb   $0x0,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 c5                	add    %al,%ch
+  804cd1:	06                   	(bad)
+  804cd2:	80 00 00             	addb   $0x0,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 c5                	add    %al,%ch
+  804cd9:	06                   	(bad)
+  804cda:	80 00 00             	addb   $0x0,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 c5                	add    %al,%ch
+  804ce1:	06                   	(bad)
+  804ce2:	80 00 00             	addb   $0x0,(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 c5                	add    %al,%ch
+  804ce9:	06                   	(bad)
+  804cea:	80 00 00             	addb   $0x0,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 c5                	add    %al,%ch
+  804cf1:	06                   	(bad)
+  804cf2:	80 00 00             	addb   $0x0,(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 d0                	add    %dl,%al
+  804de9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804def:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 1c 07             	add    %bl,(%rdi,%rax,1)
+  804e42:	80 00 00             	addb   $0x0,(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 eb                	add    %ch,%bl
+  804e49:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804e4f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 4b 07             	add    %cl,0x7(%rbx)
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 11                	add    %dl,(%rcx)
+  804e89:	07                   	(bad)
+  804e8a:	80 00 00             	addb   $0x0,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 93 0a 80 00 00    	add    %dl,0x800a(%rbx)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 5d 0b             	add    %bl,0xb(%rbp)
+  804eaa:	80 00 00             	addb   $0x0,(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 e2                	add    %ah,%dl
+  804ec1:	07                   	(bad)
+  804ec2:	80 00 00             	addb   $0x0,(%rax)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 bf 09 80 00 00    	add    %bh,0x8009(%rdi)
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 d0                	add    %dl,%al
+  804ee9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804eef:	00 ad 0c 80 00 00    	add    %ch,0x800c(%rbp)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 75 06             	add    %dh,0x6(%rbp)
+  804efa:	80 00 00             	addb   $0x0,(%rax)
+  804efd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804f00 <error_string>:
+	...
+  804f08:	a5 4a 80 00 00 00 00 00 b7 4a 80 00 00 00 00 00     .J.......J......
+  804f18:	c7 4a 80 00 00 00 00 00 d9 4a 80 00 00 00 00 00     .J.......J......
+  804f28:	e7 4a 80 00 00 00 00 00 fb 4a 80 00 00 00 00 00     .J.......J......
+  804f38:	10 4b 80 00 00 00 00 00 23 4b 80 00 00 00 00 00     .K......#K......
+  804f48:	35 4b 80 00 00 00 00 00 49 4b 80 00 00 00 00 00     5K......IK......
+  804f58:	59 4b 80 00 00 00 00 00 6c 4b 80 00 00 00 00 00     YK......lK......
+  804f68:	83 4b 80 00 00 00 00 00 99 4b 80 00 00 00 00 00     .K.......K......
+  804f78:	b1 4b 80 00 00 00 00 00 c9 4b 80 00 00 00 00 00     .K.......K......
+  804f88:	d6 4b 80 00 00 00 00 00 b8 4f 80 00 00 00 00 00     .K.......O......
+  804f98:	ea 4b 80 00 00 00 00 00 02 4c 80 00 00 00 00 00     .K.......L......
+  804fa8:	0c 4c 80 00 00 00 00 00 16 4c 80 00 00 00 00 00     .L.......L......
+  804fb8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804fc8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804fd8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804fe8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804ff8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805008:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805018:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805028:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  805038:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  805048:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  805058:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805068:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805078:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805088:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805098:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8050a8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8050b8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8050c8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050d8:	84 00 00 00 00 00 66 90                             ......f.
+
+00000000008050e0 <devtab>:
+  8050e0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8050f0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805100:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805110:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805120:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805130:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805140:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805150:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805160:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805170:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805180:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805190:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8051a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8051b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8051c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8051d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
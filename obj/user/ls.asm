@@ -0,0 +1,9085 @@
+
+obj/user/ls:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 17 04 00 00       	call   80043a <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <ls1>:
+    if (n < 0)
+        panic("error reading directory %s: %i", path, n);
+}
+
+void
+ls1(const char *prefix, bool isdir, off_t size, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 08          	sub    $0x8,%rsp
+  800032:	48 89 fb             	mov    %rdi,%rbx
+  800035:	41 89 f4             	mov    %esi,%r12d
+  800038:	49 89 cd             	mov    %rcx,%r13
+    const char *sep;
+
+    if (flag['l'])
+  80003b:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  800042:	00 00 00 
+  800045:	83 b8 b0 01 00 00 00 	cmpl   $0x0,0x1b0(%rax)
+  80004c:	74 29                	je     800077 <ls1+0x52>
+  80004e:	89 d6                	mov    %edx,%esi
+        printf("%11d %c ", size, isdir ? 'd' : '-');
+  800050:	41 80 fc 01          	cmp    $0x1,%r12b
+  800054:	19 d2                	sbb    %edx,%edx
+  800056:	83 e2 c9             	and    $0xffffffc9,%edx
+  800059:	83 c2 64             	add    $0x64,%edx
+  80005c:	48 bf ba 4d 80 00 00 	movabs $0x804dba,%rdi
+  800063:	00 00 00 
+  800066:	b8 00 00 00 00       	mov    $0x0,%eax
+  80006b:	48 b9 e2 3c 80 00 00 	movabs $0x803ce2,%rcx
+  800072:	00 00 00 
+  800075:	ff d1                	call   *%rcx
+    if (prefix) {
+  800077:	48 85 db             	test   %rbx,%rbx
+  80007a:	74 2d                	je     8000a9 <ls1+0x84>
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+            sep = "/";
+        else
+            sep = "";
+  80007c:	48 ba 20 4e 80 00 00 	movabs $0x804e20,%rdx
+  800083:	00 00 00 
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800086:	80 3b 00             	cmpb   $0x0,(%rbx)
+  800089:	75 7a                	jne    800105 <ls1+0xe0>
+        printf("%s%s", prefix, sep);
+  80008b:	48 89 de             	mov    %rbx,%rsi
+  80008e:	48 bf c3 4d 80 00 00 	movabs $0x804dc3,%rdi
+  800095:	00 00 00 
+  800098:	b8 00 00 00 00       	mov    $0x0,%eax
+  80009d:	48 b9 e2 3c 80 00 00 	movabs $0x803ce2,%rcx
+  8000a4:	00 00 00 
+  8000a7:	ff d1                	call   *%rcx
+    }
+    printf("%s", name);
+  8000a9:	4c 89 ee             	mov    %r13,%rsi
+  8000ac:	48 bf d9 54 80 00 00 	movabs $0x8054d9,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	48 ba e2 3c 80 00 00 	movabs $0x803ce2,%rdx
+  8000c2:	00 00 00 
+  8000c5:	ff d2                	call   *%rdx
+    if (flag['F'] && isdir)
+  8000c7:	48 b8 00 00 81 00 00 	movabs $0x810000,%rax
+  8000ce:	00 00 00 
+  8000d1:	83 b8 18 01 00 00 00 	cmpl   $0x0,0x118(%rax)
+  8000d8:	74 05                	je     8000df <ls1+0xba>
+  8000da:	45 84 e4             	test   %r12b,%r12b
+  8000dd:	75 57                	jne    800136 <ls1+0x111>
+        printf("/");
+    printf("\n");
+  8000df:	48 bf 1f 4e 80 00 00 	movabs $0x804e1f,%rdi
+  8000e6:	00 00 00 
+  8000e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ee:	48 ba e2 3c 80 00 00 	movabs $0x803ce2,%rdx
+  8000f5:	00 00 00 
+  8000f8:	ff d2                	call   *%rdx
+}
+  8000fa:	48 83 c4 08          	add    $0x8,%rsp
+  8000fe:	5b                   	pop    %rbx
+  8000ff:	41 5c                	pop    %r12
+  800101:	41 5d                	pop    %r13
+  800103:	5d                   	pop    %rbp
+  800104:	c3                   	ret
+        if (prefix[0] && prefix[strlen(prefix) - 1] != '/')
+  800105:	48 89 df             	mov    %rbx,%rdi
+  800108:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  80010f:	00 00 00 
+  800112:	ff d0                	call   *%rax
+            sep = "/";
+  800114:	80 7c 03 ff 2f       	cmpb   $0x2f,-0x1(%rbx,%rax,1)
+  800119:	48 ba 20 4e 80 00 00 	movabs $0x804e20,%rdx
+  800120:	00 00 00 
+  800123:	48 b8 b8 4d 80 00 00 	movabs $0x804db8,%rax
+  80012a:	00 00 00 
+  80012d:	48 0f 45 d0          	cmovne %rax,%rdx
+  800131:	e9 55 ff ff ff       	jmp    80008b <ls1+0x66>
+        printf("/");
+  800136:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  80013d:	00 00 00 
+  800140:	b8 00 00 00 00       	mov    $0x0,%eax
+  800145:	48 ba e2 3c 80 00 00 	movabs $0x803ce2,%rdx
+  80014c:	00 00 00 
+  80014f:	ff d2                	call   *%rdx
+  800151:	eb 8c                	jmp    8000df <ls1+0xba>
+
+0000000000800153 <lsdir>:
+lsdir(const char *path, const char *prefix) {
+  800153:	55                   	push   %rbp
+  800154:	48 89 e5             	mov    %rsp,%rbp
+  800157:	41 56                	push   %r14
+  800159:	41 55                	push   %r13
+  80015b:	41 54                	push   %r12
+  80015d:	53                   	push   %rbx
+  80015e:	48 81 ec 00 01 00 00 	sub    $0x100,%rsp
+  800165:	49 89 fd             	mov    %rdi,%r13
+  800168:	49 89 f6             	mov    %rsi,%r14
+    if ((fd = open(path, O_RDONLY)) < 0)
+  80016b:	be 00 00 00 00       	mov    $0x0,%esi
+  800170:	48 b8 e4 32 80 00 00 	movabs $0x8032e4,%rax
+  800177:	00 00 00 
+  80017a:	ff d0                	call   *%rax
+  80017c:	89 c3                	mov    %eax,%ebx
+  80017e:	85 c0                	test   %eax,%eax
+  800180:	78 58                	js     8001da <lsdir+0x87>
+    while ((n = readn(fd, &f, sizeof f)) == sizeof f)
+  800182:	49 bc c0 1e 80 00 00 	movabs $0x801ec0,%r12
+  800189:	00 00 00 
+  80018c:	ba 00 01 00 00       	mov    $0x100,%edx
+  800191:	48 8d b5 e0 fe ff ff 	lea    -0x120(%rbp),%rsi
+  800198:	89 df                	mov    %ebx,%edi
+  80019a:	41 ff d4             	call   *%r12
+  80019d:	3d 00 01 00 00       	cmp    $0x100,%eax
+  8001a2:	75 67                	jne    80020b <lsdir+0xb8>
+        if (f.f_name[0])
+  8001a4:	80 bd e0 fe ff ff 00 	cmpb   $0x0,-0x120(%rbp)
+  8001ab:	74 df                	je     80018c <lsdir+0x39>
+            ls1(prefix, f.f_type == FTYPE_DIR, f.f_size, f.f_name);
+  8001ad:	83 bd 64 ff ff ff 01 	cmpl   $0x1,-0x9c(%rbp)
+  8001b4:	40 0f 94 c6          	sete   %sil
+  8001b8:	40 0f b6 f6          	movzbl %sil,%esi
+  8001bc:	48 8d 8d e0 fe ff ff 	lea    -0x120(%rbp),%rcx
+  8001c3:	8b 95 60 ff ff ff    	mov    -0xa0(%rbp),%edx
+  8001c9:	4c 89 f7             	mov    %r14,%rdi
+  8001cc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	eb b2                	jmp    80018c <lsdir+0x39>
+        panic("open %s: %i", path, fd);
+  8001da:	41 89 c0             	mov    %eax,%r8d
+  8001dd:	4c 89 e9             	mov    %r13,%rcx
+  8001e0:	48 ba c8 4d 80 00 00 	movabs $0x804dc8,%rdx
+  8001e7:	00 00 00 
+  8001ea:	be 1b 00 00 00       	mov    $0x1b,%esi
+  8001ef:	48 bf d4 4d 80 00 00 	movabs $0x804dd4,%rdi
+  8001f6:	00 00 00 
+  8001f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001fe:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  800205:	00 00 00 
+  800208:	41 ff d1             	call   *%r9
+    if (n > 0)
+  80020b:	85 c0                	test   %eax,%eax
+  80020d:	7f 12                	jg     800221 <lsdir+0xce>
+    if (n < 0)
+  80020f:	78 3e                	js     80024f <lsdir+0xfc>
+}
+  800211:	48 81 c4 00 01 00 00 	add    $0x100,%rsp
+  800218:	5b                   	pop    %rbx
+  800219:	41 5c                	pop    %r12
+  80021b:	41 5d                	pop    %r13
+  80021d:	41 5e                	pop    %r14
+  80021f:	5d                   	pop    %rbp
+  800220:	c3                   	ret
+        panic("short read in directory %s", path);
+  800221:	4c 89 e9             	mov    %r13,%rcx
+  800224:	48 ba de 4d 80 00 00 	movabs $0x804dde,%rdx
+  80022b:	00 00 00 
+  80022e:	be 20 00 00 00       	mov    $0x20,%esi
+  800233:	48 bf d4 4d 80 00 00 	movabs $0x804dd4,%rdi
+  80023a:	00 00 00 
+  80023d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800242:	49 b8 10 05 80 00 00 	movabs $0x800510,%r8
+  800249:	00 00 00 
+  80024c:	41 ff d0             	call   *%r8
+        panic("error reading directory %s: %i", path, n);
+  80024f:	41 89 c0             	mov    %eax,%r8d
+  800252:	4c 89 e9             	mov    %r13,%rcx
+  800255:	48 ba 28 4e 80 00 00 	movabs $0x804e28,%rdx
+  80025c:	00 00 00 
+  80025f:	be 22 00 00 00       	mov    $0x22,%esi
+  800264:	48 bf d4 4d 80 00 00 	movabs $0x804dd4,%rdi
+  80026b:	00 00 00 
+  80026e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800273:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  80027a:	00 00 00 
+  80027d:	41 ff d1             	call   *%r9
+
+0000000000800280 <ls>:
+ls(const char *path, const char *prefix) {
+  800280:	55                   	push   %rbp
+  800281:	48 89 e5             	mov    %rsp,%rbp
+  800284:	41 54                	push   %r12
+  800286:	53                   	push   %rbx
+  800287:	48 81 ec 90 00 00 00 	sub    $0x90,%rsp
+  80028e:	48 89 fb             	mov    %rdi,%rbx
+  800291:	49 89 f4             	mov    %rsi,%r12
+    if ((r = stat(path, &st)) < 0)
+  800294:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  80029b:	48 b8 76 21 80 00 00 	movabs $0x802176,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	85 c0                	test   %eax,%eax
+  8002a9:	78 47                	js     8002f2 <ls+0x72>
+    if (st.st_isdir && !flag['d'])
+  8002ab:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  8002ae:	85 c0                	test   %eax,%eax
+  8002b0:	74 13                	je     8002c5 <ls+0x45>
+  8002b2:	48 ba 00 00 81 00 00 	movabs $0x810000,%rdx
+  8002b9:	00 00 00 
+  8002bc:	83 ba 90 01 00 00 00 	cmpl   $0x0,0x190(%rdx)
+  8002c3:	74 5e                	je     800323 <ls+0xa3>
+        ls1(0, st.st_isdir, st.st_size, path);
+  8002c5:	85 c0                	test   %eax,%eax
+  8002c7:	40 0f 95 c6          	setne  %sil
+  8002cb:	40 0f b6 f6          	movzbl %sil,%esi
+  8002cf:	48 89 d9             	mov    %rbx,%rcx
+  8002d2:	8b 55 e0             	mov    -0x20(%rbp),%edx
+  8002d5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8002da:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+}
+  8002e6:	48 81 c4 90 00 00 00 	add    $0x90,%rsp
+  8002ed:	5b                   	pop    %rbx
+  8002ee:	41 5c                	pop    %r12
+  8002f0:	5d                   	pop    %rbp
+  8002f1:	c3                   	ret
+        panic("stat %s: %i", path, r);
+  8002f2:	41 89 c0             	mov    %eax,%r8d
+  8002f5:	48 89 d9             	mov    %rbx,%rcx
+  8002f8:	48 ba f9 4d 80 00 00 	movabs $0x804df9,%rdx
+  8002ff:	00 00 00 
+  800302:	be 0e 00 00 00       	mov    $0xe,%esi
+  800307:	48 bf d4 4d 80 00 00 	movabs $0x804dd4,%rdi
+  80030e:	00 00 00 
+  800311:	b8 00 00 00 00       	mov    $0x0,%eax
+  800316:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  80031d:	00 00 00 
+  800320:	41 ff d1             	call   *%r9
+        lsdir(path, prefix);
+  800323:	4c 89 e6             	mov    %r12,%rsi
+  800326:	48 89 df             	mov    %rbx,%rdi
+  800329:	48 b8 53 01 80 00 00 	movabs $0x800153,%rax
+  800330:	00 00 00 
+  800333:	ff d0                	call   *%rax
+  800335:	eb af                	jmp    8002e6 <ls+0x66>
+
+0000000000800337 <usage>:
+
+void
+usage(void) {
+  800337:	55                   	push   %rbp
+  800338:	48 89 e5             	mov    %rsp,%rbp
+    printf("usage: ls [-dFl] [file...]\n");
+  80033b:	48 bf 05 4e 80 00 00 	movabs $0x804e05,%rdi
+  800342:	00 00 00 
+  800345:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034a:	48 ba e2 3c 80 00 00 	movabs $0x803ce2,%rdx
+  800351:	00 00 00 
+  800354:	ff d2                	call   *%rdx
+    exit();
+  800356:	48 b8 ed 04 80 00 00 	movabs $0x8004ed,%rax
+  80035d:	00 00 00 
+  800360:	ff d0                	call   *%rax
+}
+  800362:	5d                   	pop    %rbp
+  800363:	c3                   	ret
+
+0000000000800364 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800364:	55                   	push   %rbp
+  800365:	48 89 e5             	mov    %rsp,%rbp
+  800368:	41 57                	push   %r15
+  80036a:	41 56                	push   %r14
+  80036c:	41 55                	push   %r13
+  80036e:	41 54                	push   %r12
+  800370:	53                   	push   %rbx
+  800371:	48 83 ec 38          	sub    $0x38,%rsp
+  800375:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  800378:	49 89 f4             	mov    %rsi,%r12
+    int i;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80037b:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  80037f:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800383:	48 b8 17 19 80 00 00 	movabs $0x801917,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+    while ((i = argnext(&args)) >= 0)
+  80038f:	49 bd 44 19 80 00 00 	movabs $0x801944,%r13
+  800396:	00 00 00 
+        case 'F':
+        case 'l':
+            flag[i]++;
+            break;
+        default:
+            usage();
+  800399:	49 bf 37 03 80 00 00 	movabs $0x800337,%r15
+  8003a0:	00 00 00 
+        switch (i) {
+  8003a3:	49 be 01 00 00 40 40 	movabs $0x4040000001,%r14
+  8003aa:	00 00 00 
+            flag[i]++;
+  8003ad:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  8003b4:	00 00 00 
+    while ((i = argnext(&args)) >= 0)
+  8003b7:	eb 06                	jmp    8003bf <umain+0x5b>
+            flag[i]++;
+  8003b9:	48 98                	cltq
+  8003bb:	83 04 83 01          	addl   $0x1,(%rbx,%rax,4)
+    while ((i = argnext(&args)) >= 0)
+  8003bf:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8003c3:	41 ff d5             	call   *%r13
+  8003c6:	85 c0                	test   %eax,%eax
+  8003c8:	78 13                	js     8003dd <umain+0x79>
+        switch (i) {
+  8003ca:	8d 50 ba             	lea    -0x46(%rax),%edx
+  8003cd:	83 fa 26             	cmp    $0x26,%edx
+  8003d0:	77 06                	ja     8003d8 <umain+0x74>
+  8003d2:	49 0f a3 d6          	bt     %rdx,%r14
+  8003d6:	72 e1                	jb     8003b9 <umain+0x55>
+            usage();
+  8003d8:	41 ff d7             	call   *%r15
+  8003db:	eb e2                	jmp    8003bf <umain+0x5b>
+        }
+
+    if (argc == 1)
+  8003dd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8003e0:	83 f8 01             	cmp    $0x1,%eax
+  8003e3:	74 33                	je     800418 <umain+0xb4>
+        ls("/", "");
+    else {
+        for (i = 1; i < argc; i++)
+  8003e5:	bb 01 00 00 00       	mov    $0x1,%ebx
+            ls(argv[i], argv[i]);
+  8003ea:	49 bd 80 02 80 00 00 	movabs $0x800280,%r13
+  8003f1:	00 00 00 
+        for (i = 1; i < argc; i++)
+  8003f4:	7e 13                	jle    800409 <umain+0xa5>
+            ls(argv[i], argv[i]);
+  8003f6:	49 8b 3c dc          	mov    (%r12,%rbx,8),%rdi
+  8003fa:	48 89 fe             	mov    %rdi,%rsi
+  8003fd:	41 ff d5             	call   *%r13
+        for (i = 1; i < argc; i++)
+  800400:	48 83 c3 01          	add    $0x1,%rbx
+  800404:	39 5d ac             	cmp    %ebx,-0x54(%rbp)
+  800407:	7f ed                	jg     8003f6 <umain+0x92>
+    }
+}
+  800409:	48 83 c4 38          	add    $0x38,%rsp
+  80040d:	5b                   	pop    %rbx
+  80040e:	41 5c                	pop    %r12
+  800410:	41 5d                	pop    %r13
+  800412:	41 5e                	pop    %r14
+  800414:	41 5f                	pop    %r15
+  800416:	5d                   	pop    %rbp
+  800417:	c3                   	ret
+        ls("/", "");
+  800418:	48 be 20 4e 80 00 00 	movabs $0x804e20,%rsi
+  80041f:	00 00 00 
+  800422:	48 bf b8 4d 80 00 00 	movabs $0x804db8,%rdi
+  800429:	00 00 00 
+  80042c:	48 b8 80 02 80 00 00 	movabs $0x800280,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+  800438:	eb cf                	jmp    800409 <umain+0xa5>
+
+000000000080043a <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80043a:	55                   	push   %rbp
+  80043b:	48 89 e5             	mov    %rsp,%rbp
+  80043e:	41 56                	push   %r14
+  800440:	41 55                	push   %r13
+  800442:	41 54                	push   %r12
+  800444:	53                   	push   %rbx
+  800445:	41 89 fd             	mov    %edi,%r13d
+  800448:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80044b:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800452:	00 00 00 
+  800455:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80045c:	00 00 00 
+  80045f:	48 39 c2             	cmp    %rax,%rdx
+  800462:	73 17                	jae    80047b <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800464:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800467:	49 89 c4             	mov    %rax,%r12
+  80046a:	48 83 c3 08          	add    $0x8,%rbx
+  80046e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800473:	ff 53 f8             	call   *-0x8(%rbx)
+  800476:	4c 39 e3             	cmp    %r12,%rbx
+  800479:	72 ef                	jb     80046a <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80047b:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  800482:	00 00 00 
+  800485:	ff d0                	call   *%rax
+  800487:	89 c2                	mov    %eax,%edx
+  800489:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80048f:	48 89 d0             	mov    %rdx,%rax
+  800492:	48 c1 e0 04          	shl    $0x4,%rax
+  800496:	48 29 d0             	sub    %rdx,%rax
+  800499:	48 c1 e0 05          	shl    $0x5,%rax
+  80049d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8004a4:	00 00 00 
+  8004a7:	48 01 d0             	add    %rdx,%rax
+  8004aa:	48 a3 00 04 81 00 00 	movabs %rax,0x810400
+  8004b1:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8004b4:	45 85 ed             	test   %r13d,%r13d
+  8004b7:	7e 0d                	jle    8004c6 <libmain+0x8c>
+  8004b9:	49 8b 06             	mov    (%r14),%rax
+  8004bc:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8004c3:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8004c6:	4c 89 f6             	mov    %r14,%rsi
+  8004c9:	44 89 ef             	mov    %r13d,%edi
+  8004cc:	48 b8 64 03 80 00 00 	movabs $0x800364,%rax
+  8004d3:	00 00 00 
+  8004d6:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004d8:	48 b8 ed 04 80 00 00 	movabs $0x8004ed,%rax
+  8004df:	00 00 00 
+  8004e2:	ff d0                	call   *%rax
+#endif
+}
+  8004e4:	5b                   	pop    %rbx
+  8004e5:	41 5c                	pop    %r12
+  8004e7:	41 5d                	pop    %r13
+  8004e9:	41 5e                	pop    %r14
+  8004eb:	5d                   	pop    %rbp
+  8004ec:	c3                   	ret
+
+00000000008004ed <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004ed:	55                   	push   %rbp
+  8004ee:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004f1:	48 b8 b7 1c 80 00 00 	movabs $0x801cb7,%rax
+  8004f8:	00 00 00 
+  8004fb:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  800502:	48 b8 f4 13 80 00 00 	movabs $0x8013f4,%rax
+  800509:	00 00 00 
+  80050c:	ff d0                	call   *%rax
+}
+  80050e:	5d                   	pop    %rbp
+  80050f:	c3                   	ret
+
+0000000000800510 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800510:	55                   	push   %rbp
+  800511:	48 89 e5             	mov    %rsp,%rbp
+  800514:	41 56                	push   %r14
+  800516:	41 55                	push   %r13
+  800518:	41 54                	push   %r12
+  80051a:	53                   	push   %rbx
+  80051b:	48 83 ec 50          	sub    $0x50,%rsp
+  80051f:	49 89 fc             	mov    %rdi,%r12
+  800522:	41 89 f5             	mov    %esi,%r13d
+  800525:	48 89 d3             	mov    %rdx,%rbx
+  800528:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80052c:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800530:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800534:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80053b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80053f:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800543:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800547:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80054b:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800552:	00 00 00 
+  800555:	4c 8b 30             	mov    (%rax),%r14
+  800558:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  80055f:	00 00 00 
+  800562:	ff d0                	call   *%rax
+  800564:	89 c6                	mov    %eax,%esi
+  800566:	45 89 e8             	mov    %r13d,%r8d
+  800569:	4c 89 e1             	mov    %r12,%rcx
+  80056c:	4c 89 f2             	mov    %r14,%rdx
+  80056f:	48 bf 58 4e 80 00 00 	movabs $0x804e58,%rdi
+  800576:	00 00 00 
+  800579:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057e:	49 bc 60 06 80 00 00 	movabs $0x800660,%r12
+  800585:	00 00 00 
+  800588:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80058b:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80058f:	48 89 df             	mov    %rbx,%rdi
+  800592:	48 b8 fc 05 80 00 00 	movabs $0x8005fc,%rax
+  800599:	00 00 00 
+  80059c:	ff d0                	call   *%rax
+    cprintf("\n");
+  80059e:	48 bf 1f 4e 80 00 00 	movabs $0x804e1f,%rdi
+  8005a5:	00 00 00 
+  8005a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005ad:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8005b0:	cc                   	int3
+  8005b1:	eb fd                	jmp    8005b0 <_panic+0xa0>
+
+00000000008005b3 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8005b3:	55                   	push   %rbp
+  8005b4:	48 89 e5             	mov    %rsp,%rbp
+  8005b7:	53                   	push   %rbx
+  8005b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8005bc:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8005bf:	8b 06                	mov    (%rsi),%eax
+  8005c1:	8d 50 01             	lea    0x1(%rax),%edx
+  8005c4:	89 16                	mov    %edx,(%rsi)
+  8005c6:	48 98                	cltq
+  8005c8:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8005cd:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005d3:	74 0a                	je     8005df <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005d5:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005d9:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005dd:	c9                   	leave
+  8005de:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005df:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005e3:	be ff 00 00 00       	mov    $0xff,%esi
+  8005e8:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  8005ef:	00 00 00 
+  8005f2:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005f4:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005fa:	eb d9                	jmp    8005d5 <putch+0x22>
+
+00000000008005fc <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005fc:	55                   	push   %rbp
+  8005fd:	48 89 e5             	mov    %rsp,%rbp
+  800600:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800607:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80060a:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800611:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800616:	b8 00 00 00 00       	mov    $0x0,%eax
+  80061b:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80061e:	48 89 f1             	mov    %rsi,%rcx
+  800621:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800628:	48 bf b3 05 80 00 00 	movabs $0x8005b3,%rdi
+  80062f:	00 00 00 
+  800632:	48 b8 b0 07 80 00 00 	movabs $0x8007b0,%rax
+  800639:	00 00 00 
+  80063c:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80063e:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800645:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80064c:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  800653:	00 00 00 
+  800656:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800658:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80065e:	c9                   	leave
+  80065f:	c3                   	ret
+
+0000000000800660 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800660:	55                   	push   %rbp
+  800661:	48 89 e5             	mov    %rsp,%rbp
+  800664:	48 83 ec 50          	sub    $0x50,%rsp
+  800668:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80066c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800670:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800674:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800678:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80067c:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800683:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800687:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80068b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80068f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800693:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800697:	48 b8 fc 05 80 00 00 	movabs $0x8005fc,%rax
+  80069e:	00 00 00 
+  8006a1:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8006a3:	c9                   	leave
+  8006a4:	c3                   	ret
+
+00000000008006a5 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8006a5:	55                   	push   %rbp
+  8006a6:	48 89 e5             	mov    %rsp,%rbp
+  8006a9:	41 57                	push   %r15
+  8006ab:	41 56                	push   %r14
+  8006ad:	41 55                	push   %r13
+  8006af:	41 54                	push   %r12
+  8006b1:	53                   	push   %rbx
+  8006b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8006b6:	49 89 fc             	mov    %rdi,%r12
+  8006b9:	49 89 f5             	mov    %rsi,%r13
+  8006bc:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8006c0:	8b 45 10             	mov    0x10(%rbp),%eax
+  8006c3:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8006c6:	41 89 cf             	mov    %ecx,%r15d
+  8006c9:	4c 39 fa             	cmp    %r15,%rdx
+  8006cc:	73 5b                	jae    800729 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8006ce:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8006d2:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006d6:	85 db                	test   %ebx,%ebx
+  8006d8:	7e 0e                	jle    8006e8 <print_num+0x43>
+            putch(padc, put_arg);
+  8006da:	4c 89 ee             	mov    %r13,%rsi
+  8006dd:	44 89 f7             	mov    %r14d,%edi
+  8006e0:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006e3:	83 eb 01             	sub    $0x1,%ebx
+  8006e6:	75 f2                	jne    8006da <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006e8:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006ec:	48 b9 8c 4e 80 00 00 	movabs $0x804e8c,%rcx
+  8006f3:	00 00 00 
+  8006f6:	48 b8 7b 4e 80 00 00 	movabs $0x804e7b,%rax
+  8006fd:	00 00 00 
+  800700:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800704:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800708:	ba 00 00 00 00       	mov    $0x0,%edx
+  80070d:	49 f7 f7             	div    %r15
+  800710:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800714:	4c 89 ee             	mov    %r13,%rsi
+  800717:	41 ff d4             	call   *%r12
+}
+  80071a:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80071e:	5b                   	pop    %rbx
+  80071f:	41 5c                	pop    %r12
+  800721:	41 5d                	pop    %r13
+  800723:	41 5e                	pop    %r14
+  800725:	41 5f                	pop    %r15
+  800727:	5d                   	pop    %rbp
+  800728:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800729:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80072d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800732:	49 f7 f7             	div    %r15
+  800735:	48 83 ec 08          	sub    $0x8,%rsp
+  800739:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80073d:	52                   	push   %rdx
+  80073e:	45 0f be c9          	movsbl %r9b,%r9d
+  800742:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800746:	48 89 c2             	mov    %rax,%rdx
+  800749:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  800750:	00 00 00 
+  800753:	ff d0                	call   *%rax
+  800755:	48 83 c4 10          	add    $0x10,%rsp
+  800759:	eb 8d                	jmp    8006e8 <print_num+0x43>
+
+000000000080075b <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80075b:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80075f:	48 8b 06             	mov    (%rsi),%rax
+  800762:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800766:	73 0a                	jae    800772 <sprintputch+0x17>
+        *state->start++ = ch;
+  800768:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80076c:	48 89 16             	mov    %rdx,(%rsi)
+  80076f:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800772:	c3                   	ret
+
+0000000000800773 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800773:	55                   	push   %rbp
+  800774:	48 89 e5             	mov    %rsp,%rbp
+  800777:	48 83 ec 50          	sub    $0x50,%rsp
+  80077b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80077f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800783:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800787:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80078e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800792:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800796:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80079a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80079e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8007a2:	48 b8 b0 07 80 00 00 	movabs $0x8007b0,%rax
+  8007a9:	00 00 00 
+  8007ac:	ff d0                	call   *%rax
+}
+  8007ae:	c9                   	leave
+  8007af:	c3                   	ret
+
+00000000008007b0 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8007b0:	55                   	push   %rbp
+  8007b1:	48 89 e5             	mov    %rsp,%rbp
+  8007b4:	41 57                	push   %r15
+  8007b6:	41 56                	push   %r14
+  8007b8:	41 55                	push   %r13
+  8007ba:	41 54                	push   %r12
+  8007bc:	53                   	push   %rbx
+  8007bd:	48 83 ec 38          	sub    $0x38,%rsp
+  8007c1:	49 89 fe             	mov    %rdi,%r14
+  8007c4:	49 89 f5             	mov    %rsi,%r13
+  8007c7:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8007ca:	48 8b 01             	mov    (%rcx),%rax
+  8007cd:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8007d1:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d9:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007dd:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007e1:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007e5:	0f b6 3b             	movzbl (%rbx),%edi
+  8007e8:	40 80 ff 25          	cmp    $0x25,%dil
+  8007ec:	74 18                	je     800806 <vprintfmt+0x56>
+            if (!ch) return;
+  8007ee:	40 84 ff             	test   %dil,%dil
+  8007f1:	0f 84 b1 06 00 00    	je     800ea8 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007f7:	40 0f b6 ff          	movzbl %dil,%edi
+  8007fb:	4c 89 ee             	mov    %r13,%rsi
+  8007fe:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800801:	4c 89 e3             	mov    %r12,%rbx
+  800804:	eb db                	jmp    8007e1 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800806:	be 00 00 00 00       	mov    $0x0,%esi
+  80080b:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80080f:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800814:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80081a:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800821:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800825:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80082a:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80082f:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800832:	83 e8 23             	sub    $0x23,%eax
+  800835:	3c 57                	cmp    $0x57,%al
+  800837:	0f 87 51 06 00 00    	ja     800e8e <vprintfmt+0x6de>
+  80083d:	0f b6 c0             	movzbl %al,%eax
+  800840:	48 b9 40 50 80 00 00 	movabs $0x805040,%rcx
+  800847:	00 00 00 
+  80084a:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80084d:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800850:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800854:	eb cf                	jmp    800825 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800856:	49 89 dc             	mov    %rbx,%r12
+  800859:	be 01 00 00 00       	mov    $0x1,%esi
+  80085e:	eb c5                	jmp    800825 <vprintfmt+0x75>
+            padc = ch;
+  800860:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800864:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800867:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80086a:	eb b9                	jmp    800825 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80086c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086f:	83 f8 2f             	cmp    $0x2f,%eax
+  800872:	77 24                	ja     800898 <vprintfmt+0xe8>
+  800874:	89 c1                	mov    %eax,%ecx
+  800876:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80087a:	83 c0 08             	add    $0x8,%eax
+  80087d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800880:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800883:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800886:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80088a:	79 99                	jns    800825 <vprintfmt+0x75>
+                width = precision;
+  80088c:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800890:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800896:	eb 8d                	jmp    800825 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800898:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80089c:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	eb da                	jmp    800880 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8008a6:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8008ab:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008af:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8008b5:	3c 39                	cmp    $0x39,%al
+  8008b7:	77 1c                	ja     8008d5 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8008b9:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8008bd:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8008c1:	0f b6 c0             	movzbl %al,%eax
+  8008c4:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8008c9:	0f b6 03             	movzbl (%rbx),%eax
+  8008cc:	3c 39                	cmp    $0x39,%al
+  8008ce:	76 e9                	jbe    8008b9 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8008d0:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008d3:	eb b1                	jmp    800886 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008d5:	49 89 dc             	mov    %rbx,%r12
+  8008d8:	eb ac                	jmp    800886 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008da:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008dd:	85 c9                	test   %ecx,%ecx
+  8008df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008e4:	0f 49 c1             	cmovns %ecx,%eax
+  8008e7:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008ea:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ed:	e9 33 ff ff ff       	jmp    800825 <vprintfmt+0x75>
+            lflag++;
+  8008f2:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008f5:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008f8:	e9 28 ff ff ff       	jmp    800825 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800900:	83 f8 2f             	cmp    $0x2f,%eax
+  800903:	77 19                	ja     80091e <vprintfmt+0x16e>
+  800905:	89 c2                	mov    %eax,%edx
+  800907:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090b:	83 c0 08             	add    $0x8,%eax
+  80090e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800911:	8b 3a                	mov    (%rdx),%edi
+  800913:	4c 89 ee             	mov    %r13,%rsi
+  800916:	41 ff d6             	call   *%r14
+            break;
+  800919:	e9 c3 fe ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80091e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800922:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800926:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092a:	eb e5                	jmp    800911 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80092c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092f:	83 f8 2f             	cmp    $0x2f,%eax
+  800932:	77 5a                	ja     80098e <vprintfmt+0x1de>
+  800934:	89 c2                	mov    %eax,%edx
+  800936:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093a:	83 c0 08             	add    $0x8,%eax
+  80093d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800940:	8b 02                	mov    (%rdx),%eax
+  800942:	89 c1                	mov    %eax,%ecx
+  800944:	f7 d9                	neg    %ecx
+  800946:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800949:	83 f9 16             	cmp    $0x16,%ecx
+  80094c:	7f 4e                	jg     80099c <vprintfmt+0x1ec>
+  80094e:	48 63 c1             	movslq %ecx,%rax
+  800951:	48 ba 00 53 80 00 00 	movabs $0x805300,%rdx
+  800958:	00 00 00 
+  80095b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80095f:	48 85 c0             	test   %rax,%rax
+  800962:	74 38                	je     80099c <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800964:	48 89 c1             	mov    %rax,%rcx
+  800967:	48 ba d9 54 80 00 00 	movabs $0x8054d9,%rdx
+  80096e:	00 00 00 
+  800971:	4c 89 ee             	mov    %r13,%rsi
+  800974:	4c 89 f7             	mov    %r14,%rdi
+  800977:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097c:	49 b8 73 07 80 00 00 	movabs $0x800773,%r8
+  800983:	00 00 00 
+  800986:	41 ff d0             	call   *%r8
+  800989:	e9 53 fe ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80098e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800992:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800996:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099a:	eb a4                	jmp    800940 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80099c:	48 ba a4 4e 80 00 00 	movabs $0x804ea4,%rdx
+  8009a3:	00 00 00 
+  8009a6:	4c 89 ee             	mov    %r13,%rsi
+  8009a9:	4c 89 f7             	mov    %r14,%rdi
+  8009ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8009b1:	49 b8 73 07 80 00 00 	movabs $0x800773,%r8
+  8009b8:	00 00 00 
+  8009bb:	41 ff d0             	call   *%r8
+  8009be:	e9 1e fe ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8009c3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009c6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009c9:	77 6c                	ja     800a37 <vprintfmt+0x287>
+  8009cb:	89 c2                	mov    %eax,%edx
+  8009cd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009d1:	83 c0 08             	add    $0x8,%eax
+  8009d4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009d7:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009da:	48 85 d2             	test   %rdx,%rdx
+  8009dd:	48 b8 9d 4e 80 00 00 	movabs $0x804e9d,%rax
+  8009e4:	00 00 00 
+  8009e7:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009eb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009ef:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009f3:	7e 06                	jle    8009fb <vprintfmt+0x24b>
+  8009f5:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009f9:	75 4a                	jne    800a45 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009fb:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009ff:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800a03:	0f b6 00             	movzbl (%rax),%eax
+  800a06:	84 c0                	test   %al,%al
+  800a08:	0f 85 9a 00 00 00    	jne    800aa8 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800a0e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a11:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800a15:	85 c0                	test   %eax,%eax
+  800a17:	0f 8e c4 fd ff ff    	jle    8007e1 <vprintfmt+0x31>
+  800a1d:	4c 89 ee             	mov    %r13,%rsi
+  800a20:	bf 20 00 00 00       	mov    $0x20,%edi
+  800a25:	41 ff d6             	call   *%r14
+  800a28:	41 83 ec 01          	sub    $0x1,%r12d
+  800a2c:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800a30:	75 eb                	jne    800a1d <vprintfmt+0x26d>
+  800a32:	e9 aa fd ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a37:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a3b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a43:	eb 92                	jmp    8009d7 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a45:	49 63 f7             	movslq %r15d,%rsi
+  800a48:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a4c:	48 b8 62 0f 80 00 00 	movabs $0x800f62,%rax
+  800a53:	00 00 00 
+  800a56:	ff d0                	call   *%rax
+  800a58:	48 89 c2             	mov    %rax,%rdx
+  800a5b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a5e:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a60:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a63:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a66:	85 c0                	test   %eax,%eax
+  800a68:	7e 91                	jle    8009fb <vprintfmt+0x24b>
+  800a6a:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a6f:	4c 89 ee             	mov    %r13,%rsi
+  800a72:	44 89 e7             	mov    %r12d,%edi
+  800a75:	41 ff d6             	call   *%r14
+  800a78:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a7c:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a7f:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a82:	75 eb                	jne    800a6f <vprintfmt+0x2bf>
+  800a84:	e9 72 ff ff ff       	jmp    8009fb <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a89:	0f b6 f8             	movzbl %al,%edi
+  800a8c:	4c 89 ee             	mov    %r13,%rsi
+  800a8f:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a92:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a96:	49 83 c4 01          	add    $0x1,%r12
+  800a9a:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800aa0:	84 c0                	test   %al,%al
+  800aa2:	0f 84 66 ff ff ff    	je     800a0e <vprintfmt+0x25e>
+  800aa8:	45 85 ff             	test   %r15d,%r15d
+  800aab:	78 0a                	js     800ab7 <vprintfmt+0x307>
+  800aad:	41 83 ef 01          	sub    $0x1,%r15d
+  800ab1:	0f 88 57 ff ff ff    	js     800a0e <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800ab7:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800abb:	74 cc                	je     800a89 <vprintfmt+0x2d9>
+  800abd:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800ac0:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800ac5:	80 fa 5e             	cmp    $0x5e,%dl
+  800ac8:	77 c2                	ja     800a8c <vprintfmt+0x2dc>
+  800aca:	eb bd                	jmp    800a89 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800acc:	40 84 f6             	test   %sil,%sil
+  800acf:	75 26                	jne    800af7 <vprintfmt+0x347>
+    switch (lflag) {
+  800ad1:	85 d2                	test   %edx,%edx
+  800ad3:	74 59                	je     800b2e <vprintfmt+0x37e>
+  800ad5:	83 fa 01             	cmp    $0x1,%edx
+  800ad8:	74 7b                	je     800b55 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800ada:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800add:	83 f8 2f             	cmp    $0x2f,%eax
+  800ae0:	0f 87 96 00 00 00    	ja     800b7c <vprintfmt+0x3cc>
+  800ae6:	89 c2                	mov    %eax,%edx
+  800ae8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aec:	83 c0 08             	add    $0x8,%eax
+  800aef:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800af2:	4c 8b 22             	mov    (%rdx),%r12
+  800af5:	eb 17                	jmp    800b0e <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800af7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afa:	83 f8 2f             	cmp    $0x2f,%eax
+  800afd:	77 21                	ja     800b20 <vprintfmt+0x370>
+  800aff:	89 c2                	mov    %eax,%edx
+  800b01:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b05:	83 c0 08             	add    $0x8,%eax
+  800b08:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0b:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800b0e:	4d 85 e4             	test   %r12,%r12
+  800b11:	78 7a                	js     800b8d <vprintfmt+0x3dd>
+            num = i;
+  800b13:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800b16:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800b1b:	e9 50 02 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2c:	eb dd                	jmp    800b0b <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800b2e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b31:	83 f8 2f             	cmp    $0x2f,%eax
+  800b34:	77 11                	ja     800b47 <vprintfmt+0x397>
+  800b36:	89 c2                	mov    %eax,%edx
+  800b38:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b3c:	83 c0 08             	add    $0x8,%eax
+  800b3f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b42:	4c 63 22             	movslq (%rdx),%r12
+  800b45:	eb c7                	jmp    800b0e <vprintfmt+0x35e>
+  800b47:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b53:	eb ed                	jmp    800b42 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b55:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b58:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5b:	77 11                	ja     800b6e <vprintfmt+0x3be>
+  800b5d:	89 c2                	mov    %eax,%edx
+  800b5f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b63:	83 c0 08             	add    $0x8,%eax
+  800b66:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b69:	4c 8b 22             	mov    (%rdx),%r12
+  800b6c:	eb a0                	jmp    800b0e <vprintfmt+0x35e>
+  800b6e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b72:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b76:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b7a:	eb ed                	jmp    800b69 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b7c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b80:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b84:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b88:	e9 65 ff ff ff       	jmp    800af2 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b8d:	4c 89 ee             	mov    %r13,%rsi
+  800b90:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b95:	41 ff d6             	call   *%r14
+                i = -i;
+  800b98:	49 f7 dc             	neg    %r12
+  800b9b:	e9 73 ff ff ff       	jmp    800b13 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba0:	40 84 f6             	test   %sil,%sil
+  800ba3:	75 32                	jne    800bd7 <vprintfmt+0x427>
+    switch (lflag) {
+  800ba5:	85 d2                	test   %edx,%edx
+  800ba7:	74 5d                	je     800c06 <vprintfmt+0x456>
+  800ba9:	83 fa 01             	cmp    $0x1,%edx
+  800bac:	0f 84 82 00 00 00    	je     800c34 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800bb2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bb5:	83 f8 2f             	cmp    $0x2f,%eax
+  800bb8:	0f 87 a5 00 00 00    	ja     800c63 <vprintfmt+0x4b3>
+  800bbe:	89 c2                	mov    %eax,%edx
+  800bc0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bc4:	83 c0 08             	add    $0x8,%eax
+  800bc7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bca:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bcd:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bd2:	e9 99 01 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bd7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bda:	83 f8 2f             	cmp    $0x2f,%eax
+  800bdd:	77 19                	ja     800bf8 <vprintfmt+0x448>
+  800bdf:	89 c2                	mov    %eax,%edx
+  800be1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be5:	83 c0 08             	add    $0x8,%eax
+  800be8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800beb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bee:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bf3:	e9 78 01 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+  800bf8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bfc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c00:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c04:	eb e5                	jmp    800beb <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800c06:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c09:	83 f8 2f             	cmp    $0x2f,%eax
+  800c0c:	77 18                	ja     800c26 <vprintfmt+0x476>
+  800c0e:	89 c2                	mov    %eax,%edx
+  800c10:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c14:	83 c0 08             	add    $0x8,%eax
+  800c17:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c1a:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800c1c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800c21:	e9 4a 01 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+  800c26:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c2a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c32:	eb e6                	jmp    800c1a <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c34:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c37:	83 f8 2f             	cmp    $0x2f,%eax
+  800c3a:	77 19                	ja     800c55 <vprintfmt+0x4a5>
+  800c3c:	89 c2                	mov    %eax,%edx
+  800c3e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c42:	83 c0 08             	add    $0x8,%eax
+  800c45:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c48:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c4b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c50:	e9 1b 01 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+  800c55:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c59:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c5d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c61:	eb e5                	jmp    800c48 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c63:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c67:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6f:	e9 56 ff ff ff       	jmp    800bca <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c74:	40 84 f6             	test   %sil,%sil
+  800c77:	75 2e                	jne    800ca7 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c79:	85 d2                	test   %edx,%edx
+  800c7b:	74 59                	je     800cd6 <vprintfmt+0x526>
+  800c7d:	83 fa 01             	cmp    $0x1,%edx
+  800c80:	74 7f                	je     800d01 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c82:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c85:	83 f8 2f             	cmp    $0x2f,%eax
+  800c88:	0f 87 9f 00 00 00    	ja     800d2d <vprintfmt+0x57d>
+  800c8e:	89 c2                	mov    %eax,%edx
+  800c90:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c94:	83 c0 08             	add    $0x8,%eax
+  800c97:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c9a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c9d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ca2:	e9 c9 00 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ca7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800caa:	83 f8 2f             	cmp    $0x2f,%eax
+  800cad:	77 19                	ja     800cc8 <vprintfmt+0x518>
+  800caf:	89 c2                	mov    %eax,%edx
+  800cb1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb5:	83 c0 08             	add    $0x8,%eax
+  800cb8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cbb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800cbe:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800cc3:	e9 a8 00 00 00       	jmp    800d70 <vprintfmt+0x5c0>
+  800cc8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ccc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd4:	eb e5                	jmp    800cbb <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800cd6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd9:	83 f8 2f             	cmp    $0x2f,%eax
+  800cdc:	77 15                	ja     800cf3 <vprintfmt+0x543>
+  800cde:	89 c2                	mov    %eax,%edx
+  800ce0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ce4:	83 c0 08             	add    $0x8,%eax
+  800ce7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cea:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800cec:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800cf1:	eb 7d                	jmp    800d70 <vprintfmt+0x5c0>
+  800cf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cff:	eb e9                	jmp    800cea <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800d01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d04:	83 f8 2f             	cmp    $0x2f,%eax
+  800d07:	77 16                	ja     800d1f <vprintfmt+0x56f>
+  800d09:	89 c2                	mov    %eax,%edx
+  800d0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0f:	83 c0 08             	add    $0x8,%eax
+  800d12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d15:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800d18:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800d1d:	eb 51                	jmp    800d70 <vprintfmt+0x5c0>
+  800d1f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d23:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d27:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2b:	eb e8                	jmp    800d15 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800d2d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d31:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d35:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d39:	e9 5c ff ff ff       	jmp    800c9a <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d3e:	4c 89 ee             	mov    %r13,%rsi
+  800d41:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d46:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d49:	4c 89 ee             	mov    %r13,%rsi
+  800d4c:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d51:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d54:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d57:	83 f8 2f             	cmp    $0x2f,%eax
+  800d5a:	77 47                	ja     800da3 <vprintfmt+0x5f3>
+  800d5c:	89 c2                	mov    %eax,%edx
+  800d5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d62:	83 c0 08             	add    $0x8,%eax
+  800d65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d70:	48 83 ec 08          	sub    $0x8,%rsp
+  800d74:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d78:	0f 94 c0             	sete   %al
+  800d7b:	0f b6 c0             	movzbl %al,%eax
+  800d7e:	50                   	push   %rax
+  800d7f:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d84:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d88:	4c 89 ee             	mov    %r13,%rsi
+  800d8b:	4c 89 f7             	mov    %r14,%rdi
+  800d8e:	48 b8 a5 06 80 00 00 	movabs $0x8006a5,%rax
+  800d95:	00 00 00 
+  800d98:	ff d0                	call   *%rax
+            break;
+  800d9a:	48 83 c4 10          	add    $0x10,%rsp
+  800d9e:	e9 3e fa ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800da3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800da7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800daf:	eb b7                	jmp    800d68 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800db1:	40 84 f6             	test   %sil,%sil
+  800db4:	75 2b                	jne    800de1 <vprintfmt+0x631>
+    switch (lflag) {
+  800db6:	85 d2                	test   %edx,%edx
+  800db8:	74 56                	je     800e10 <vprintfmt+0x660>
+  800dba:	83 fa 01             	cmp    $0x1,%edx
+  800dbd:	74 7f                	je     800e3e <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800dbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc5:	0f 87 a2 00 00 00    	ja     800e6d <vprintfmt+0x6bd>
+  800dcb:	89 c2                	mov    %eax,%edx
+  800dcd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dd1:	83 c0 08             	add    $0x8,%eax
+  800dd4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dda:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800ddf:	eb 8f                	jmp    800d70 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800de1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de4:	83 f8 2f             	cmp    $0x2f,%eax
+  800de7:	77 19                	ja     800e02 <vprintfmt+0x652>
+  800de9:	89 c2                	mov    %eax,%edx
+  800deb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800def:	83 c0 08             	add    $0x8,%eax
+  800df2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800df8:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dfd:	e9 6e ff ff ff       	jmp    800d70 <vprintfmt+0x5c0>
+  800e02:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e06:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e0a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0e:	eb e5                	jmp    800df5 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800e10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e13:	83 f8 2f             	cmp    $0x2f,%eax
+  800e16:	77 18                	ja     800e30 <vprintfmt+0x680>
+  800e18:	89 c2                	mov    %eax,%edx
+  800e1a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e1e:	83 c0 08             	add    $0x8,%eax
+  800e21:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e24:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800e26:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800e2b:	e9 40 ff ff ff       	jmp    800d70 <vprintfmt+0x5c0>
+  800e30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e3c:	eb e6                	jmp    800e24 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e3e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e41:	83 f8 2f             	cmp    $0x2f,%eax
+  800e44:	77 19                	ja     800e5f <vprintfmt+0x6af>
+  800e46:	89 c2                	mov    %eax,%edx
+  800e48:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e4c:	83 c0 08             	add    $0x8,%eax
+  800e4f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e52:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e55:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e5a:	e9 11 ff ff ff       	jmp    800d70 <vprintfmt+0x5c0>
+  800e5f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e63:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e67:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e6b:	eb e5                	jmp    800e52 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e6d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e71:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e75:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e79:	e9 59 ff ff ff       	jmp    800dd7 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e7e:	4c 89 ee             	mov    %r13,%rsi
+  800e81:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e86:	41 ff d6             	call   *%r14
+            break;
+  800e89:	e9 53 f9 ff ff       	jmp    8007e1 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e8e:	4c 89 ee             	mov    %r13,%rsi
+  800e91:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e96:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e99:	48 83 eb 01          	sub    $0x1,%rbx
+  800e9d:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ea1:	75 f6                	jne    800e99 <vprintfmt+0x6e9>
+  800ea3:	e9 39 f9 ff ff       	jmp    8007e1 <vprintfmt+0x31>
+}
+  800ea8:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800eac:	5b                   	pop    %rbx
+  800ead:	41 5c                	pop    %r12
+  800eaf:	41 5d                	pop    %r13
+  800eb1:	41 5e                	pop    %r14
+  800eb3:	41 5f                	pop    %r15
+  800eb5:	5d                   	pop    %rbp
+  800eb6:	c3                   	ret
+
+0000000000800eb7 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800eb7:	55                   	push   %rbp
+  800eb8:	48 89 e5             	mov    %rsp,%rbp
+  800ebb:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800ebf:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800ec3:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800ec8:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800ecc:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ed3:	48 85 ff             	test   %rdi,%rdi
+  800ed6:	74 2b                	je     800f03 <vsnprintf+0x4c>
+  800ed8:	48 85 f6             	test   %rsi,%rsi
+  800edb:	74 26                	je     800f03 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800edd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ee1:	48 bf 5b 07 80 00 00 	movabs $0x80075b,%rdi
+  800ee8:	00 00 00 
+  800eeb:	48 b8 b0 07 80 00 00 	movabs $0x8007b0,%rax
+  800ef2:	00 00 00 
+  800ef5:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ef7:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800efb:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800efe:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800f01:	c9                   	leave
+  800f02:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800f03:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800f08:	eb f7                	jmp    800f01 <vsnprintf+0x4a>
+
+0000000000800f0a <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800f0a:	55                   	push   %rbp
+  800f0b:	48 89 e5             	mov    %rsp,%rbp
+  800f0e:	48 83 ec 50          	sub    $0x50,%rsp
+  800f12:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800f16:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800f1a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800f1e:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800f25:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800f29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f2d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800f31:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f35:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f39:	48 b8 b7 0e 80 00 00 	movabs $0x800eb7,%rax
+  800f40:	00 00 00 
+  800f43:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f45:	c9                   	leave
+  800f46:	c3                   	ret
+
+0000000000800f47 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f47:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f4a:	74 10                	je     800f5c <strlen+0x15>
+    size_t n = 0;
+  800f4c:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f51:	48 83 c0 01          	add    $0x1,%rax
+  800f55:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f59:	75 f6                	jne    800f51 <strlen+0xa>
+  800f5b:	c3                   	ret
+    size_t n = 0;
+  800f5c:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f61:	c3                   	ret
+
+0000000000800f62 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f62:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f65:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f6a:	48 85 f6             	test   %rsi,%rsi
+  800f6d:	74 11                	je     800f80 <strnlen+0x1e>
+  800f6f:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f73:	74 0c                	je     800f81 <strnlen+0x1f>
+  800f75:	48 83 c2 01          	add    $0x1,%rdx
+  800f79:	48 39 d0             	cmp    %rdx,%rax
+  800f7c:	75 f1                	jne    800f6f <strnlen+0xd>
+  800f7e:	eb 04                	jmp    800f84 <strnlen+0x22>
+  800f80:	c3                   	ret
+  800f81:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f84:	c3                   	ret
+
+0000000000800f85 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f85:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f88:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f8d:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f91:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f94:	48 83 c2 01          	add    $0x1,%rdx
+  800f98:	84 c9                	test   %cl,%cl
+  800f9a:	75 f1                	jne    800f8d <strcpy+0x8>
+        ;
+    return res;
+}
+  800f9c:	c3                   	ret
+
+0000000000800f9d <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f9d:	55                   	push   %rbp
+  800f9e:	48 89 e5             	mov    %rsp,%rbp
+  800fa1:	41 54                	push   %r12
+  800fa3:	53                   	push   %rbx
+  800fa4:	48 89 fb             	mov    %rdi,%rbx
+  800fa7:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800faa:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  800fb1:	00 00 00 
+  800fb4:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800fb6:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800fba:	4c 89 e6             	mov    %r12,%rsi
+  800fbd:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  800fc4:	00 00 00 
+  800fc7:	ff d0                	call   *%rax
+    return dst;
+}
+  800fc9:	48 89 d8             	mov    %rbx,%rax
+  800fcc:	5b                   	pop    %rbx
+  800fcd:	41 5c                	pop    %r12
+  800fcf:	5d                   	pop    %rbp
+  800fd0:	c3                   	ret
+
+0000000000800fd1 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800fd1:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800fd4:	48 85 d2             	test   %rdx,%rdx
+  800fd7:	74 1f                	je     800ff8 <strncpy+0x27>
+  800fd9:	48 01 fa             	add    %rdi,%rdx
+  800fdc:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800fdf:	48 83 c1 01          	add    $0x1,%rcx
+  800fe3:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fe7:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800feb:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fef:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ff3:	48 39 ca             	cmp    %rcx,%rdx
+  800ff6:	75 e7                	jne    800fdf <strncpy+0xe>
+    }
+    return ret;
+}
+  800ff8:	c3                   	ret
+
+0000000000800ff9 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ff9:	48 89 f8             	mov    %rdi,%rax
+  800ffc:	48 85 d2             	test   %rdx,%rdx
+  800fff:	74 24                	je     801025 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801001:	48 83 ea 01          	sub    $0x1,%rdx
+  801005:	74 1b                	je     801022 <strlcpy+0x29>
+  801007:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80100b:	0f b6 16             	movzbl (%rsi),%edx
+  80100e:	84 d2                	test   %dl,%dl
+  801010:	74 10                	je     801022 <strlcpy+0x29>
+            *dst++ = *src++;
+  801012:	48 83 c6 01          	add    $0x1,%rsi
+  801016:	48 83 c0 01          	add    $0x1,%rax
+  80101a:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  80101d:	48 39 c8             	cmp    %rcx,%rax
+  801020:	75 e9                	jne    80100b <strlcpy+0x12>
+        *dst = '\0';
+  801022:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  801025:	48 29 f8             	sub    %rdi,%rax
+}
+  801028:	c3                   	ret
+
+0000000000801029 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  801029:	0f b6 07             	movzbl (%rdi),%eax
+  80102c:	84 c0                	test   %al,%al
+  80102e:	74 13                	je     801043 <strcmp+0x1a>
+  801030:	38 06                	cmp    %al,(%rsi)
+  801032:	75 0f                	jne    801043 <strcmp+0x1a>
+  801034:	48 83 c7 01          	add    $0x1,%rdi
+  801038:	48 83 c6 01          	add    $0x1,%rsi
+  80103c:	0f b6 07             	movzbl (%rdi),%eax
+  80103f:	84 c0                	test   %al,%al
+  801041:	75 ed                	jne    801030 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801043:	0f b6 c0             	movzbl %al,%eax
+  801046:	0f b6 16             	movzbl (%rsi),%edx
+  801049:	29 d0                	sub    %edx,%eax
+}
+  80104b:	c3                   	ret
+
+000000000080104c <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  80104c:	48 85 d2             	test   %rdx,%rdx
+  80104f:	74 1f                	je     801070 <strncmp+0x24>
+  801051:	0f b6 07             	movzbl (%rdi),%eax
+  801054:	84 c0                	test   %al,%al
+  801056:	74 1e                	je     801076 <strncmp+0x2a>
+  801058:	3a 06                	cmp    (%rsi),%al
+  80105a:	75 1a                	jne    801076 <strncmp+0x2a>
+  80105c:	48 83 c7 01          	add    $0x1,%rdi
+  801060:	48 83 c6 01          	add    $0x1,%rsi
+  801064:	48 83 ea 01          	sub    $0x1,%rdx
+  801068:	75 e7                	jne    801051 <strncmp+0x5>
+
+    if (!n) return 0;
+  80106a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80106f:	c3                   	ret
+  801070:	b8 00 00 00 00       	mov    $0x0,%eax
+  801075:	c3                   	ret
+  801076:	48 85 d2             	test   %rdx,%rdx
+  801079:	74 09                	je     801084 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80107b:	0f b6 07             	movzbl (%rdi),%eax
+  80107e:	0f b6 16             	movzbl (%rsi),%edx
+  801081:	29 d0                	sub    %edx,%eax
+  801083:	c3                   	ret
+    if (!n) return 0;
+  801084:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801089:	c3                   	ret
+
+000000000080108a <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80108a:	0f b6 17             	movzbl (%rdi),%edx
+  80108d:	84 d2                	test   %dl,%dl
+  80108f:	74 18                	je     8010a9 <strchr+0x1f>
+        if (*str == c) {
+  801091:	0f be d2             	movsbl %dl,%edx
+  801094:	39 f2                	cmp    %esi,%edx
+  801096:	74 17                	je     8010af <strchr+0x25>
+    for (; *str; str++) {
+  801098:	48 83 c7 01          	add    $0x1,%rdi
+  80109c:	0f b6 17             	movzbl (%rdi),%edx
+  80109f:	84 d2                	test   %dl,%dl
+  8010a1:	75 ee                	jne    801091 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  8010a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a8:	c3                   	ret
+  8010a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010ae:	c3                   	ret
+  8010af:	48 89 f8             	mov    %rdi,%rax
+}
+  8010b2:	c3                   	ret
+
+00000000008010b3 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  8010b3:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  8010b6:	0f b6 17             	movzbl (%rdi),%edx
+  8010b9:	84 d2                	test   %dl,%dl
+  8010bb:	74 13                	je     8010d0 <strfind+0x1d>
+  8010bd:	0f be d2             	movsbl %dl,%edx
+  8010c0:	39 f2                	cmp    %esi,%edx
+  8010c2:	74 0b                	je     8010cf <strfind+0x1c>
+  8010c4:	48 83 c0 01          	add    $0x1,%rax
+  8010c8:	0f b6 10             	movzbl (%rax),%edx
+  8010cb:	84 d2                	test   %dl,%dl
+  8010cd:	75 ee                	jne    8010bd <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  8010cf:	c3                   	ret
+  8010d0:	c3                   	ret
+
+00000000008010d1 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  8010d1:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010d4:	48 89 f8             	mov    %rdi,%rax
+  8010d7:	48 f7 d8             	neg    %rax
+  8010da:	83 e0 07             	and    $0x7,%eax
+  8010dd:	49 89 d1             	mov    %rdx,%r9
+  8010e0:	49 29 c1             	sub    %rax,%r9
+  8010e3:	78 36                	js     80111b <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010e5:	40 0f b6 c6          	movzbl %sil,%eax
+  8010e9:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010f0:	01 01 01 
+  8010f3:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010f7:	40 f6 c7 07          	test   $0x7,%dil
+  8010fb:	75 38                	jne    801135 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010fd:	4c 89 c9             	mov    %r9,%rcx
+  801100:	48 c1 f9 03          	sar    $0x3,%rcx
+  801104:	74 0c                	je     801112 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801106:	fc                   	cld
+  801107:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80110a:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80110e:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801112:	4d 85 c9             	test   %r9,%r9
+  801115:	75 45                	jne    80115c <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801117:	4c 89 c0             	mov    %r8,%rax
+  80111a:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80111b:	48 85 d2             	test   %rdx,%rdx
+  80111e:	74 f7                	je     801117 <memset+0x46>
+  801120:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801123:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801126:	48 83 c0 01          	add    $0x1,%rax
+  80112a:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80112e:	48 39 c2             	cmp    %rax,%rdx
+  801131:	75 f3                	jne    801126 <memset+0x55>
+  801133:	eb e2                	jmp    801117 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801135:	40 f6 c7 01          	test   $0x1,%dil
+  801139:	74 06                	je     801141 <memset+0x70>
+  80113b:	88 07                	mov    %al,(%rdi)
+  80113d:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801141:	40 f6 c7 02          	test   $0x2,%dil
+  801145:	74 07                	je     80114e <memset+0x7d>
+  801147:	66 89 07             	mov    %ax,(%rdi)
+  80114a:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80114e:	40 f6 c7 04          	test   $0x4,%dil
+  801152:	74 a9                	je     8010fd <memset+0x2c>
+  801154:	89 07                	mov    %eax,(%rdi)
+  801156:	48 83 c7 04          	add    $0x4,%rdi
+  80115a:	eb a1                	jmp    8010fd <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80115c:	41 f6 c1 04          	test   $0x4,%r9b
+  801160:	74 06                	je     801168 <memset+0x97>
+  801162:	89 07                	mov    %eax,(%rdi)
+  801164:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801168:	41 f6 c1 02          	test   $0x2,%r9b
+  80116c:	74 07                	je     801175 <memset+0xa4>
+  80116e:	66 89 07             	mov    %ax,(%rdi)
+  801171:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801175:	41 f6 c1 01          	test   $0x1,%r9b
+  801179:	74 9c                	je     801117 <memset+0x46>
+  80117b:	88 07                	mov    %al,(%rdi)
+  80117d:	eb 98                	jmp    801117 <memset+0x46>
+
+000000000080117f <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80117f:	48 89 f8             	mov    %rdi,%rax
+  801182:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801185:	48 39 fe             	cmp    %rdi,%rsi
+  801188:	73 3b                	jae    8011c5 <memmove+0x46>
+  80118a:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80118e:	48 39 d7             	cmp    %rdx,%rdi
+  801191:	73 32                	jae    8011c5 <memmove+0x46>
+        s += n;
+        d += n;
+  801193:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801197:	48 89 d6             	mov    %rdx,%rsi
+  80119a:	48 09 fe             	or     %rdi,%rsi
+  80119d:	48 09 ce             	or     %rcx,%rsi
+  8011a0:	40 f6 c6 07          	test   $0x7,%sil
+  8011a4:	75 12                	jne    8011b8 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8011a6:	48 83 ef 08          	sub    $0x8,%rdi
+  8011aa:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8011ae:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011b2:	fd                   	std
+  8011b3:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8011b6:	fc                   	cld
+  8011b7:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8011b8:	48 83 ef 01          	sub    $0x1,%rdi
+  8011bc:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8011c0:	fd                   	std
+  8011c1:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8011c3:	eb f1                	jmp    8011b6 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8011c5:	48 89 f2             	mov    %rsi,%rdx
+  8011c8:	48 09 c2             	or     %rax,%rdx
+  8011cb:	48 09 ca             	or     %rcx,%rdx
+  8011ce:	f6 c2 07             	test   $0x7,%dl
+  8011d1:	75 0c                	jne    8011df <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011d3:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011d7:	48 89 c7             	mov    %rax,%rdi
+  8011da:	fc                   	cld
+  8011db:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011de:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011df:	48 89 c7             	mov    %rax,%rdi
+  8011e2:	fc                   	cld
+  8011e3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011e5:	c3                   	ret
+
+00000000008011e6 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011e6:	55                   	push   %rbp
+  8011e7:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011ea:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8011f1:	00 00 00 
+  8011f4:	ff d0                	call   *%rax
+}
+  8011f6:	5d                   	pop    %rbp
+  8011f7:	c3                   	ret
+
+00000000008011f8 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011f8:	55                   	push   %rbp
+  8011f9:	48 89 e5             	mov    %rsp,%rbp
+  8011fc:	41 57                	push   %r15
+  8011fe:	41 56                	push   %r14
+  801200:	41 55                	push   %r13
+  801202:	41 54                	push   %r12
+  801204:	53                   	push   %rbx
+  801205:	48 83 ec 08          	sub    $0x8,%rsp
+  801209:	49 89 fe             	mov    %rdi,%r14
+  80120c:	49 89 f7             	mov    %rsi,%r15
+  80120f:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801212:	48 89 f7             	mov    %rsi,%rdi
+  801215:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  80121c:	00 00 00 
+  80121f:	ff d0                	call   *%rax
+  801221:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801224:	48 89 de             	mov    %rbx,%rsi
+  801227:	4c 89 f7             	mov    %r14,%rdi
+  80122a:	48 b8 62 0f 80 00 00 	movabs $0x800f62,%rax
+  801231:	00 00 00 
+  801234:	ff d0                	call   *%rax
+  801236:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801239:	48 39 c3             	cmp    %rax,%rbx
+  80123c:	74 36                	je     801274 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80123e:	48 89 d8             	mov    %rbx,%rax
+  801241:	4c 29 e8             	sub    %r13,%rax
+  801244:	49 39 c4             	cmp    %rax,%r12
+  801247:	73 31                	jae    80127a <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801249:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80124e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801252:	4c 89 fe             	mov    %r15,%rsi
+  801255:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  80125c:	00 00 00 
+  80125f:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801261:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801265:	48 83 c4 08          	add    $0x8,%rsp
+  801269:	5b                   	pop    %rbx
+  80126a:	41 5c                	pop    %r12
+  80126c:	41 5d                	pop    %r13
+  80126e:	41 5e                	pop    %r14
+  801270:	41 5f                	pop    %r15
+  801272:	5d                   	pop    %rbp
+  801273:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801274:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801278:	eb eb                	jmp    801265 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80127a:	48 83 eb 01          	sub    $0x1,%rbx
+  80127e:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801282:	48 89 da             	mov    %rbx,%rdx
+  801285:	4c 89 fe             	mov    %r15,%rsi
+  801288:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  80128f:	00 00 00 
+  801292:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801294:	49 01 de             	add    %rbx,%r14
+  801297:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80129c:	eb c3                	jmp    801261 <strlcat+0x69>
+
+000000000080129e <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80129e:	48 85 d2             	test   %rdx,%rdx
+  8012a1:	74 2d                	je     8012d0 <memcmp+0x32>
+  8012a3:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8012a8:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8012ac:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8012b1:	44 38 c1             	cmp    %r8b,%cl
+  8012b4:	75 0f                	jne    8012c5 <memcmp+0x27>
+    while (n-- > 0) {
+  8012b6:	48 83 c0 01          	add    $0x1,%rax
+  8012ba:	48 39 c2             	cmp    %rax,%rdx
+  8012bd:	75 e9                	jne    8012a8 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8012bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c4:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8012c5:	0f b6 c1             	movzbl %cl,%eax
+  8012c8:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8012cc:	44 29 c0             	sub    %r8d,%eax
+  8012cf:	c3                   	ret
+    return 0;
+  8012d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012d5:	c3                   	ret
+
+00000000008012d6 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012d6:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012da:	48 39 c7             	cmp    %rax,%rdi
+  8012dd:	73 0f                	jae    8012ee <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012df:	40 38 37             	cmp    %sil,(%rdi)
+  8012e2:	74 0e                	je     8012f2 <memfind+0x1c>
+    for (; src < end; src++) {
+  8012e4:	48 83 c7 01          	add    $0x1,%rdi
+  8012e8:	48 39 f8             	cmp    %rdi,%rax
+  8012eb:	75 f2                	jne    8012df <memfind+0x9>
+  8012ed:	c3                   	ret
+  8012ee:	48 89 f8             	mov    %rdi,%rax
+  8012f1:	c3                   	ret
+  8012f2:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012f5:	c3                   	ret
+
+00000000008012f6 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012f6:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012f9:	0f b6 37             	movzbl (%rdi),%esi
+  8012fc:	40 80 fe 20          	cmp    $0x20,%sil
+  801300:	74 06                	je     801308 <strtol+0x12>
+  801302:	40 80 fe 09          	cmp    $0x9,%sil
+  801306:	75 13                	jne    80131b <strtol+0x25>
+  801308:	48 83 c7 01          	add    $0x1,%rdi
+  80130c:	0f b6 37             	movzbl (%rdi),%esi
+  80130f:	40 80 fe 20          	cmp    $0x20,%sil
+  801313:	74 f3                	je     801308 <strtol+0x12>
+  801315:	40 80 fe 09          	cmp    $0x9,%sil
+  801319:	74 ed                	je     801308 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80131b:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80131e:	83 e0 fd             	and    $0xfffffffd,%eax
+  801321:	3c 01                	cmp    $0x1,%al
+  801323:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801327:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80132d:	75 0f                	jne    80133e <strtol+0x48>
+  80132f:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801332:	74 14                	je     801348 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801334:	85 d2                	test   %edx,%edx
+  801336:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80133b:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80133e:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801343:	4c 63 ca             	movslq %edx,%r9
+  801346:	eb 36                	jmp    80137e <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801348:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80134c:	74 0f                	je     80135d <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80134e:	85 d2                	test   %edx,%edx
+  801350:	75 ec                	jne    80133e <strtol+0x48>
+        s++;
+  801352:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801356:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80135b:	eb e1                	jmp    80133e <strtol+0x48>
+        s += 2;
+  80135d:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801361:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801366:	eb d6                	jmp    80133e <strtol+0x48>
+            dig -= '0';
+  801368:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80136b:	44 0f b6 c1          	movzbl %cl,%r8d
+  80136f:	41 39 d0             	cmp    %edx,%r8d
+  801372:	7d 21                	jge    801395 <strtol+0x9f>
+        val = val * base + dig;
+  801374:	49 0f af c1          	imul   %r9,%rax
+  801378:	0f b6 c9             	movzbl %cl,%ecx
+  80137b:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80137e:	48 83 c7 01          	add    $0x1,%rdi
+  801382:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801386:	80 f9 39             	cmp    $0x39,%cl
+  801389:	76 dd                	jbe    801368 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80138b:	80 f9 7b             	cmp    $0x7b,%cl
+  80138e:	77 05                	ja     801395 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801390:	83 e9 57             	sub    $0x57,%ecx
+  801393:	eb d6                	jmp    80136b <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801395:	4d 85 d2             	test   %r10,%r10
+  801398:	74 03                	je     80139d <strtol+0xa7>
+  80139a:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80139d:	48 89 c2             	mov    %rax,%rdx
+  8013a0:	48 f7 da             	neg    %rdx
+  8013a3:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8013a7:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8013ab:	c3                   	ret
+
+00000000008013ac <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8013ac:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8013c8:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8013ca:	c3                   	ret
+
+00000000008013cb <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013cb:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013d0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013d5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013df:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013eb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f1:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013f3:	c3                   	ret
+
+00000000008013f4 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013f4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f7:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013fc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801401:	ba 00 00 00 00       	mov    $0x0,%edx
+  801406:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80140c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801412:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801418:	0f 05                	syscall
+    if (check && ret > 0) {
+  80141a:	48 85 c0             	test   %rax,%rax
+  80141d:	7f 01                	jg     801420 <sys_env_destroy+0x2c>
+}
+  80141f:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801420:	55                   	push   %rbp
+  801421:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801424:	49 89 c0             	mov    %rax,%r8
+  801427:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80142c:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  801433:	00 00 00 
+  801436:	be 29 00 00 00       	mov    $0x29,%esi
+  80143b:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801442:	00 00 00 
+  801445:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144a:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801451:	00 00 00 
+  801454:	41 ff d1             	call   *%r9
+
+0000000000801457 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80145c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801461:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801466:	ba 00 00 00 00       	mov    $0x0,%edx
+  80146b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801471:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801477:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80147d:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80147f:	c3                   	ret
+
+0000000000801480 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801480:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801485:	bf 00 00 00 00       	mov    $0x0,%edi
+  80148a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80148f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801494:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80149a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014a6:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014a8:	c3                   	ret
+
+00000000008014a9 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014a9:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ae:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8014b5:	00 00 00 
+  8014b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ca:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8014cc:	c3                   	ret
+
+00000000008014cd <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8014cd:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8014d0:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e1:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014e3:	c3                   	ret
+
+00000000008014e4 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014e4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ec:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ef:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014fb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014fd:	48 85 c0             	test   %rax,%rax
+  801500:	7f 01                	jg     801503 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801502:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801503:	55                   	push   %rbp
+  801504:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801507:	49 89 c0             	mov    %rax,%r8
+  80150a:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80150f:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  801516:	00 00 00 
+  801519:	be 29 00 00 00       	mov    $0x29,%esi
+  80151e:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801525:	00 00 00 
+  801528:	b8 00 00 00 00       	mov    $0x0,%eax
+  80152d:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801534:	00 00 00 
+  801537:	41 ff d1             	call   *%r9
+
+000000000080153a <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80153a:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80153d:	48 63 d2             	movslq %edx,%rdx
+  801540:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801543:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801548:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80154b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80154d:	48 85 c0             	test   %rax,%rax
+  801550:	7f 01                	jg     801553 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801552:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801553:	55                   	push   %rbp
+  801554:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801557:	49 89 c0             	mov    %rax,%r8
+  80155a:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80155f:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  801566:	00 00 00 
+  801569:	be 29 00 00 00       	mov    $0x29,%esi
+  80156e:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801575:	00 00 00 
+  801578:	b8 00 00 00 00       	mov    $0x0,%eax
+  80157d:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801584:	00 00 00 
+  801587:	41 ff d1             	call   *%r9
+
+000000000080158a <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80158a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80158d:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801592:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801598:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80159e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015a6:	48 85 c0             	test   %rax,%rax
+  8015a9:	7f 01                	jg     8015ac <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8015ab:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8015ac:	55                   	push   %rbp
+  8015ad:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015b0:	49 89 c0             	mov    %rax,%r8
+  8015b3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8015b8:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  8015bf:	00 00 00 
+  8015c2:	be 29 00 00 00       	mov    $0x29,%esi
+  8015c7:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  8015ce:	00 00 00 
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d6:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  8015dd:	00 00 00 
+  8015e0:	41 ff d1             	call   *%r9
+
+00000000008015e3 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015e3:	48 63 f6             	movslq %esi,%rsi
+  8015e6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e9:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801605:	0f 05                	syscall
+    if (check && ret > 0) {
+  801607:	48 85 c0             	test   %rax,%rax
+  80160a:	7f 01                	jg     80160d <sys_env_set_status+0x2a>
+}
+  80160c:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80160d:	55                   	push   %rbp
+  80160e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801611:	49 89 c0             	mov    %rax,%r8
+  801614:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801619:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  801620:	00 00 00 
+  801623:	be 29 00 00 00       	mov    $0x29,%esi
+  801628:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  80162f:	00 00 00 
+  801632:	b8 00 00 00 00       	mov    $0x0,%eax
+  801637:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  80163e:	00 00 00 
+  801641:	41 ff d1             	call   *%r9
+
+0000000000801644 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801644:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801647:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80164c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801651:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801657:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80165d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801663:	0f 05                	syscall
+    if (check && ret > 0) {
+  801665:	48 85 c0             	test   %rax,%rax
+  801668:	7f 01                	jg     80166b <sys_env_set_trapframe+0x27>
+}
+  80166a:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80166b:	55                   	push   %rbp
+  80166c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166f:	49 89 c0             	mov    %rax,%r8
+  801672:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801677:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  80167e:	00 00 00 
+  801681:	be 29 00 00 00       	mov    $0x29,%esi
+  801686:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  80168d:	00 00 00 
+  801690:	b8 00 00 00 00       	mov    $0x0,%eax
+  801695:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  80169c:	00 00 00 
+  80169f:	41 ff d1             	call   *%r9
+
+00000000008016a2 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8016a2:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016a5:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016af:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016b5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016bb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016c1:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016c3:	48 85 c0             	test   %rax,%rax
+  8016c6:	7f 01                	jg     8016c9 <sys_env_set_pgfault_upcall+0x27>
+}
+  8016c8:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8016c9:	55                   	push   %rbp
+  8016ca:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016cd:	49 89 c0             	mov    %rax,%r8
+  8016d0:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016d5:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  8016dc:	00 00 00 
+  8016df:	be 29 00 00 00       	mov    $0x29,%esi
+  8016e4:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  8016eb:	00 00 00 
+  8016ee:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016f3:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  8016fa:	00 00 00 
+  8016fd:	41 ff d1             	call   *%r9
+
+0000000000801700 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801700:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801703:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801706:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80170b:	4d 63 c0             	movslq %r8d,%r8
+  80170e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801714:	0f 05                	syscall
+}
+  801716:	c3                   	ret
+
+0000000000801717 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801717:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80171a:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80171d:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801722:	4d 63 c0             	movslq %r8d,%r8
+  801725:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80172b:	0f 05                	syscall
+}
+  80172d:	c3                   	ret
+
+000000000080172e <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80172e:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801733:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801736:	45 89 c0             	mov    %r8d,%r8d
+  801739:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80173f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801741:	48 85 c0             	test   %rax,%rax
+  801744:	7f 01                	jg     801747 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801746:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801747:	55                   	push   %rbp
+  801748:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80174b:	49 89 c0             	mov    %rax,%r8
+  80174e:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801753:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  80175a:	00 00 00 
+  80175d:	be 29 00 00 00       	mov    $0x29,%esi
+  801762:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801769:	00 00 00 
+  80176c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801771:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801778:	00 00 00 
+  80177b:	41 ff d1             	call   *%r9
+
+000000000080177e <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801788:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80178d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801792:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  801799:	00 00 00 
+  80179c:	ff d0                	call   *%rax
+}
+  80179e:	5d                   	pop    %rbp
+  80179f:	c3                   	ret
+
+00000000008017a0 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017a0:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017a5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8017aa:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017c6:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8017c8:	c3                   	ret
+
+00000000008017c9 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017c9:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017ce:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017d8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017de:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ea:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017ec:	48 85 c0             	test   %rax,%rax
+  8017ef:	7f 01                	jg     8017f2 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8017f1:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017f6:	49 89 c0             	mov    %rax,%r8
+  8017f9:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017fe:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  801805:	00 00 00 
+  801808:	be 29 00 00 00       	mov    $0x29,%esi
+  80180d:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801814:	00 00 00 
+  801817:	b8 00 00 00 00       	mov    $0x0,%eax
+  80181c:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801823:	00 00 00 
+  801826:	41 ff d1             	call   *%r9
+
+0000000000801829 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801829:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80182e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801833:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801838:	ba 00 00 00 00       	mov    $0x0,%edx
+  80183d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801843:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801849:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80184f:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801851:	c3                   	ret
+
+0000000000801852 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801852:	89 d2                	mov    %edx,%edx
+  801854:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801856:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80185b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801861:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801867:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80186d:	0f 05                	syscall
+}
+  80186f:	c3                   	ret
+
+0000000000801870 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801870:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801873:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801878:	ba 00 00 00 00       	mov    $0x0,%edx
+  80187d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801883:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801889:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80188f:	0f 05                	syscall
+}
+  801891:	c3                   	ret
+
+0000000000801892 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801892:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801895:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80189a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80189f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018a5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018b1:	0f 05                	syscall
+}
+  8018b3:	c3                   	ret
+
+00000000008018b4 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8018b4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018b7:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8018bc:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018c1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018c6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018cc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018d2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018d8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018da:	48 85 c0             	test   %rax,%rax
+  8018dd:	7f 01                	jg     8018e0 <sys_irq_ack+0x2c>
+}
+  8018df:	c3                   	ret
+sys_irq_ack(int irq) {
+  8018e0:	55                   	push   %rbp
+  8018e1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018e4:	49 89 c0             	mov    %rax,%r8
+  8018e7:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8018ec:	48 ba d8 53 80 00 00 	movabs $0x8053d8,%rdx
+  8018f3:	00 00 00 
+  8018f6:	be 29 00 00 00       	mov    $0x29,%esi
+  8018fb:	48 bf f7 53 80 00 00 	movabs $0x8053f7,%rdi
+  801902:	00 00 00 
+  801905:	b8 00 00 00 00       	mov    $0x0,%eax
+  80190a:	49 b9 10 05 80 00 00 	movabs $0x800510,%r9
+  801911:	00 00 00 
+  801914:	41 ff d1             	call   *%r9
+
+0000000000801917 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  801917:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  80191a:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  80191e:	83 3f 01             	cmpl   $0x1,(%rdi)
+  801921:	7e 0f                	jle    801932 <argstart+0x1b>
+  801923:	48 b8 20 4e 80 00 00 	movabs $0x804e20,%rax
+  80192a:	00 00 00 
+  80192d:	48 85 f6             	test   %rsi,%rsi
+  801930:	75 05                	jne    801937 <argstart+0x20>
+  801932:	b8 00 00 00 00       	mov    $0x0,%eax
+  801937:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  80193b:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  801942:	00 
+}
+  801943:	c3                   	ret
+
+0000000000801944 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  801944:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  80194b:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  80194c:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801950:	48 85 c0             	test   %rax,%rax
+  801953:	0f 84 8f 00 00 00    	je     8019e8 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  801959:	55                   	push   %rbp
+  80195a:	48 89 e5             	mov    %rsp,%rbp
+  80195d:	53                   	push   %rbx
+  80195e:	48 83 ec 08          	sub    $0x8,%rsp
+  801962:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  801965:	80 38 00             	cmpb   $0x0,(%rax)
+  801968:	75 52                	jne    8019bc <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  80196a:	48 8b 17             	mov    (%rdi),%rdx
+  80196d:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801970:	74 67                	je     8019d9 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801972:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801976:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80197a:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80197d:	75 5a                	jne    8019d9 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80197f:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801983:	74 54                	je     8019d9 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801985:	48 83 c0 01          	add    $0x1,%rax
+  801989:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80198d:	8b 12                	mov    (%rdx),%edx
+  80198f:	83 ea 01             	sub    $0x1,%edx
+  801992:	48 63 d2             	movslq %edx,%rdx
+  801995:	48 c1 e2 03          	shl    $0x3,%rdx
+  801999:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80199d:	48 83 c7 08          	add    $0x8,%rdi
+  8019a1:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8019ad:	48 8b 03             	mov    (%rbx),%rax
+  8019b0:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8019b3:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8019b7:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8019ba:	74 17                	je     8019d3 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8019bc:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8019c0:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8019c3:	48 83 c0 01          	add    $0x1,%rax
+  8019c7:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8019cb:	89 d0                	mov    %edx,%eax
+  8019cd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8019d1:	c9                   	leave
+  8019d2:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  8019d3:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8019d7:	75 e3                	jne    8019bc <argnext+0x78>
+    args->curarg = 0;
+  8019d9:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8019e0:	00 
+    return -1;
+  8019e1:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8019e6:	eb e3                	jmp    8019cb <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  8019e8:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  8019ed:	89 d0                	mov    %edx,%eax
+  8019ef:	c3                   	ret
+
+00000000008019f0 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  8019f0:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8019f4:	48 85 c0             	test   %rax,%rax
+  8019f7:	74 7b                	je     801a74 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  8019f9:	55                   	push   %rbp
+  8019fa:	48 89 e5             	mov    %rsp,%rbp
+  8019fd:	53                   	push   %rbx
+  8019fe:	48 83 ec 08          	sub    $0x8,%rsp
+  801a02:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801a05:	80 38 00             	cmpb   $0x0,(%rax)
+  801a08:	74 1c                	je     801a26 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  801a0a:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  801a0e:	48 b8 20 4e 80 00 00 	movabs $0x804e20,%rax
+  801a15:	00 00 00 
+  801a18:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  801a1c:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  801a20:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801a24:	c9                   	leave
+  801a25:	c3                   	ret
+    } else if (*args->argc > 1) {
+  801a26:	48 8b 07             	mov    (%rdi),%rax
+  801a29:	83 38 01             	cmpl   $0x1,(%rax)
+  801a2c:	7f 12                	jg     801a40 <argnextvalue+0x50>
+        args->argvalue = 0;
+  801a2e:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  801a35:	00 
+        args->curarg = 0;
+  801a36:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  801a3d:	00 
+  801a3e:	eb dc                	jmp    801a1c <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  801a40:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801a44:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  801a48:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  801a4c:	8b 10                	mov    (%rax),%edx
+  801a4e:	83 ea 01             	sub    $0x1,%edx
+  801a51:	48 63 d2             	movslq %edx,%rdx
+  801a54:	48 c1 e2 03          	shl    $0x3,%rdx
+  801a58:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  801a5c:	48 83 c7 08          	add    $0x8,%rdi
+  801a60:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  801a67:	00 00 00 
+  801a6a:	ff d0                	call   *%rax
+        (*args->argc)--;
+  801a6c:	48 8b 03             	mov    (%rbx),%rax
+  801a6f:	83 28 01             	subl   $0x1,(%rax)
+  801a72:	eb a8                	jmp    801a1c <argnextvalue+0x2c>
+}
+  801a74:	c3                   	ret
+
+0000000000801a75 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801a75:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  801a79:	48 85 c0             	test   %rax,%rax
+  801a7c:	74 01                	je     801a7f <argvalue+0xa>
+}
+  801a7e:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801a7f:	55                   	push   %rbp
+  801a80:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801a83:	48 b8 f0 19 80 00 00 	movabs $0x8019f0,%rax
+  801a8a:	00 00 00 
+  801a8d:	ff d0                	call   *%rax
+}
+  801a8f:	5d                   	pop    %rbp
+  801a90:	c3                   	ret
+
+0000000000801a91 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a91:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801a98:	ff ff ff 
+  801a9b:	48 01 f8             	add    %rdi,%rax
+  801a9e:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801aa2:	c3                   	ret
+
+0000000000801aa3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aa3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801aaa:	ff ff ff 
+  801aad:	48 01 f8             	add    %rdi,%rax
+  801ab0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801ab4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801aba:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801abe:	c3                   	ret
+
+0000000000801abf <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801abf:	55                   	push   %rbp
+  801ac0:	48 89 e5             	mov    %rsp,%rbp
+  801ac3:	41 57                	push   %r15
+  801ac5:	41 56                	push   %r14
+  801ac7:	41 55                	push   %r13
+  801ac9:	41 54                	push   %r12
+  801acb:	53                   	push   %rbx
+  801acc:	48 83 ec 08          	sub    $0x8,%rsp
+  801ad0:	49 89 ff             	mov    %rdi,%r15
+  801ad3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801ad8:	49 bd f2 43 80 00 00 	movabs $0x8043f2,%r13
+  801adf:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801ae2:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801ae8:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801aeb:	48 89 df             	mov    %rbx,%rdi
+  801aee:	41 ff d5             	call   *%r13
+  801af1:	83 e0 04             	and    $0x4,%eax
+  801af4:	74 17                	je     801b0d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801af6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801afd:	4c 39 f3             	cmp    %r14,%rbx
+  801b00:	75 e6                	jne    801ae8 <fd_alloc+0x29>
+  801b02:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801b08:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801b0d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801b10:	48 83 c4 08          	add    $0x8,%rsp
+  801b14:	5b                   	pop    %rbx
+  801b15:	41 5c                	pop    %r12
+  801b17:	41 5d                	pop    %r13
+  801b19:	41 5e                	pop    %r14
+  801b1b:	41 5f                	pop    %r15
+  801b1d:	5d                   	pop    %rbp
+  801b1e:	c3                   	ret
+
+0000000000801b1f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801b1f:	83 ff 1f             	cmp    $0x1f,%edi
+  801b22:	77 39                	ja     801b5d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801b24:	55                   	push   %rbp
+  801b25:	48 89 e5             	mov    %rsp,%rbp
+  801b28:	41 54                	push   %r12
+  801b2a:	53                   	push   %rbx
+  801b2b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801b2e:	48 63 df             	movslq %edi,%rbx
+  801b31:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801b38:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801b3c:	48 89 df             	mov    %rbx,%rdi
+  801b3f:	48 b8 f2 43 80 00 00 	movabs $0x8043f2,%rax
+  801b46:	00 00 00 
+  801b49:	ff d0                	call   *%rax
+  801b4b:	a8 04                	test   $0x4,%al
+  801b4d:	74 14                	je     801b63 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801b4f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801b53:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801b58:	5b                   	pop    %rbx
+  801b59:	41 5c                	pop    %r12
+  801b5b:	5d                   	pop    %rbp
+  801b5c:	c3                   	ret
+        return -E_INVAL;
+  801b5d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801b62:	c3                   	ret
+        return -E_INVAL;
+  801b63:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801b68:	eb ee                	jmp    801b58 <fd_lookup+0x39>
+
+0000000000801b6a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801b6a:	55                   	push   %rbp
+  801b6b:	48 89 e5             	mov    %rsp,%rbp
+  801b6e:	41 54                	push   %r12
+  801b70:	53                   	push   %rbx
+  801b71:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801b74:	48 b8 a0 54 80 00 00 	movabs $0x8054a0,%rax
+  801b7b:	00 00 00 
+  801b7e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801b85:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801b88:	39 3b                	cmp    %edi,(%rbx)
+  801b8a:	74 47                	je     801bd3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801b8c:	48 83 c0 08          	add    $0x8,%rax
+  801b90:	48 8b 18             	mov    (%rax),%rbx
+  801b93:	48 85 db             	test   %rbx,%rbx
+  801b96:	75 f0                	jne    801b88 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801b98:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801b9f:	00 00 00 
+  801ba2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ba8:	89 fa                	mov    %edi,%edx
+  801baa:	48 bf 08 54 80 00 00 	movabs $0x805408,%rdi
+  801bb1:	00 00 00 
+  801bb4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bb9:	48 b9 60 06 80 00 00 	movabs $0x800660,%rcx
+  801bc0:	00 00 00 
+  801bc3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801bc5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801bca:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801bce:	5b                   	pop    %rbx
+  801bcf:	41 5c                	pop    %r12
+  801bd1:	5d                   	pop    %rbp
+  801bd2:	c3                   	ret
+            return 0;
+  801bd3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801bd8:	eb f0                	jmp    801bca <dev_lookup+0x60>
+
+0000000000801bda <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801bda:	55                   	push   %rbp
+  801bdb:	48 89 e5             	mov    %rsp,%rbp
+  801bde:	41 55                	push   %r13
+  801be0:	41 54                	push   %r12
+  801be2:	53                   	push   %rbx
+  801be3:	48 83 ec 18          	sub    $0x18,%rsp
+  801be7:	48 89 fb             	mov    %rdi,%rbx
+  801bea:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bed:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801bf4:	ff ff ff 
+  801bf7:	48 01 df             	add    %rbx,%rdi
+  801bfa:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801bfe:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c02:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801c09:	00 00 00 
+  801c0c:	ff d0                	call   *%rax
+  801c0e:	41 89 c5             	mov    %eax,%r13d
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 06                	js     801c1b <fd_close+0x41>
+  801c15:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801c19:	74 1a                	je     801c35 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801c1b:	45 84 e4             	test   %r12b,%r12b
+  801c1e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c23:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801c27:	44 89 e8             	mov    %r13d,%eax
+  801c2a:	48 83 c4 18          	add    $0x18,%rsp
+  801c2e:	5b                   	pop    %rbx
+  801c2f:	41 5c                	pop    %r12
+  801c31:	41 5d                	pop    %r13
+  801c33:	5d                   	pop    %rbp
+  801c34:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801c35:	8b 3b                	mov    (%rbx),%edi
+  801c37:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c3b:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  801c42:	00 00 00 
+  801c45:	ff d0                	call   *%rax
+  801c47:	41 89 c5             	mov    %eax,%r13d
+  801c4a:	85 c0                	test   %eax,%eax
+  801c4c:	78 1b                	js     801c69 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801c4e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c52:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801c56:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801c5c:	48 85 c0             	test   %rax,%rax
+  801c5f:	74 08                	je     801c69 <fd_close+0x8f>
+  801c61:	48 89 df             	mov    %rbx,%rdi
+  801c64:	ff d0                	call   *%rax
+  801c66:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801c69:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c6e:	48 89 de             	mov    %rbx,%rsi
+  801c71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c76:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  801c7d:	00 00 00 
+  801c80:	ff d0                	call   *%rax
+    return res;
+  801c82:	eb a3                	jmp    801c27 <fd_close+0x4d>
+
+0000000000801c84 <close>:
+
+int
+close(int fdnum) {
+  801c84:	55                   	push   %rbp
+  801c85:	48 89 e5             	mov    %rsp,%rbp
+  801c88:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801c8c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801c90:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801c97:	00 00 00 
+  801c9a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801c9c:	85 c0                	test   %eax,%eax
+  801c9e:	78 15                	js     801cb5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ca0:	be 01 00 00 00       	mov    $0x1,%esi
+  801ca5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ca9:	48 b8 da 1b 80 00 00 	movabs $0x801bda,%rax
+  801cb0:	00 00 00 
+  801cb3:	ff d0                	call   *%rax
+}
+  801cb5:	c9                   	leave
+  801cb6:	c3                   	ret
+
+0000000000801cb7 <close_all>:
+
+void
+close_all(void) {
+  801cb7:	55                   	push   %rbp
+  801cb8:	48 89 e5             	mov    %rsp,%rbp
+  801cbb:	41 54                	push   %r12
+  801cbd:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801cbe:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cc3:	49 bc 84 1c 80 00 00 	movabs $0x801c84,%r12
+  801cca:	00 00 00 
+  801ccd:	89 df                	mov    %ebx,%edi
+  801ccf:	41 ff d4             	call   *%r12
+  801cd2:	83 c3 01             	add    $0x1,%ebx
+  801cd5:	83 fb 20             	cmp    $0x20,%ebx
+  801cd8:	75 f3                	jne    801ccd <close_all+0x16>
+}
+  801cda:	5b                   	pop    %rbx
+  801cdb:	41 5c                	pop    %r12
+  801cdd:	5d                   	pop    %rbp
+  801cde:	c3                   	ret
+
+0000000000801cdf <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801cdf:	55                   	push   %rbp
+  801ce0:	48 89 e5             	mov    %rsp,%rbp
+  801ce3:	41 57                	push   %r15
+  801ce5:	41 56                	push   %r14
+  801ce7:	41 55                	push   %r13
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 18          	sub    $0x18,%rsp
+  801cf0:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801cf3:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801cf7:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801cfe:	00 00 00 
+  801d01:	ff d0                	call   *%rax
+  801d03:	89 c3                	mov    %eax,%ebx
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	0f 88 b8 00 00 00    	js     801dc5 <dup+0xe6>
+    close(newfdnum);
+  801d0d:	44 89 e7             	mov    %r12d,%edi
+  801d10:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  801d17:	00 00 00 
+  801d1a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801d1c:	4d 63 ec             	movslq %r12d,%r13
+  801d1f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801d26:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801d2a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801d2e:	4c 89 ff             	mov    %r15,%rdi
+  801d31:	49 be a3 1a 80 00 00 	movabs $0x801aa3,%r14
+  801d38:	00 00 00 
+  801d3b:	41 ff d6             	call   *%r14
+  801d3e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801d41:	4c 89 ef             	mov    %r13,%rdi
+  801d44:	41 ff d6             	call   *%r14
+  801d47:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801d4a:	48 89 df             	mov    %rbx,%rdi
+  801d4d:	48 b8 f2 43 80 00 00 	movabs $0x8043f2,%rax
+  801d54:	00 00 00 
+  801d57:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801d59:	a8 04                	test   $0x4,%al
+  801d5b:	74 2b                	je     801d88 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801d5d:	41 89 c1             	mov    %eax,%r9d
+  801d60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801d66:	4c 89 f1             	mov    %r14,%rcx
+  801d69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801d6e:	48 89 de             	mov    %rbx,%rsi
+  801d71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d76:	48 b8 3a 15 80 00 00 	movabs $0x80153a,%rax
+  801d7d:	00 00 00 
+  801d80:	ff d0                	call   *%rax
+  801d82:	89 c3                	mov    %eax,%ebx
+  801d84:	85 c0                	test   %eax,%eax
+  801d86:	78 4e                	js     801dd6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801d88:	4c 89 ff             	mov    %r15,%rdi
+  801d8b:	48 b8 f2 43 80 00 00 	movabs $0x8043f2,%rax
+  801d92:	00 00 00 
+  801d95:	ff d0                	call   *%rax
+  801d97:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801d9a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801da0:	4c 89 e9             	mov    %r13,%rcx
+  801da3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801da8:	4c 89 fe             	mov    %r15,%rsi
+  801dab:	bf 00 00 00 00       	mov    $0x0,%edi
+  801db0:	48 b8 3a 15 80 00 00 	movabs $0x80153a,%rax
+  801db7:	00 00 00 
+  801dba:	ff d0                	call   *%rax
+  801dbc:	89 c3                	mov    %eax,%ebx
+  801dbe:	85 c0                	test   %eax,%eax
+  801dc0:	78 14                	js     801dd6 <dup+0xf7>
+
+    return newfdnum;
+  801dc2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801dc5:	89 d8                	mov    %ebx,%eax
+  801dc7:	48 83 c4 18          	add    $0x18,%rsp
+  801dcb:	5b                   	pop    %rbx
+  801dcc:	41 5c                	pop    %r12
+  801dce:	41 5d                	pop    %r13
+  801dd0:	41 5e                	pop    %r14
+  801dd2:	41 5f                	pop    %r15
+  801dd4:	5d                   	pop    %rbp
+  801dd5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801dd6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ddb:	4c 89 ee             	mov    %r13,%rsi
+  801dde:	bf 00 00 00 00       	mov    $0x0,%edi
+  801de3:	49 bc 8a 15 80 00 00 	movabs $0x80158a,%r12
+  801dea:	00 00 00 
+  801ded:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801df0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801df5:	4c 89 f6             	mov    %r14,%rsi
+  801df8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801dfd:	41 ff d4             	call   *%r12
+    return res;
+  801e00:	eb c3                	jmp    801dc5 <dup+0xe6>
+
+0000000000801e02 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801e02:	55                   	push   %rbp
+  801e03:	48 89 e5             	mov    %rsp,%rbp
+  801e06:	41 56                	push   %r14
+  801e08:	41 55                	push   %r13
+  801e0a:	41 54                	push   %r12
+  801e0c:	53                   	push   %rbx
+  801e0d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e11:	89 fb                	mov    %edi,%ebx
+  801e13:	49 89 f4             	mov    %rsi,%r12
+  801e16:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e19:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e1d:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801e24:	00 00 00 
+  801e27:	ff d0                	call   *%rax
+  801e29:	85 c0                	test   %eax,%eax
+  801e2b:	78 4c                	js     801e79 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e2d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e31:	41 8b 3e             	mov    (%r14),%edi
+  801e34:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e38:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  801e3f:	00 00 00 
+  801e42:	ff d0                	call   *%rax
+  801e44:	85 c0                	test   %eax,%eax
+  801e46:	78 35                	js     801e7d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801e48:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801e4c:	83 e0 03             	and    $0x3,%eax
+  801e4f:	83 f8 01             	cmp    $0x1,%eax
+  801e52:	74 2d                	je     801e81 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801e54:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e58:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801e5c:	48 85 c0             	test   %rax,%rax
+  801e5f:	74 56                	je     801eb7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801e61:	4c 89 ea             	mov    %r13,%rdx
+  801e64:	4c 89 e6             	mov    %r12,%rsi
+  801e67:	4c 89 f7             	mov    %r14,%rdi
+  801e6a:	ff d0                	call   *%rax
+}
+  801e6c:	48 83 c4 10          	add    $0x10,%rsp
+  801e70:	5b                   	pop    %rbx
+  801e71:	41 5c                	pop    %r12
+  801e73:	41 5d                	pop    %r13
+  801e75:	41 5e                	pop    %r14
+  801e77:	5d                   	pop    %rbp
+  801e78:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e79:	48 98                	cltq
+  801e7b:	eb ef                	jmp    801e6c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e7d:	48 98                	cltq
+  801e7f:	eb eb                	jmp    801e6c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e81:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801e88:	00 00 00 
+  801e8b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e91:	89 da                	mov    %ebx,%edx
+  801e93:	48 bf 49 54 80 00 00 	movabs $0x805449,%rdi
+  801e9a:	00 00 00 
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea2:	48 b9 60 06 80 00 00 	movabs $0x800660,%rcx
+  801ea9:	00 00 00 
+  801eac:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eae:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801eb5:	eb b5                	jmp    801e6c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801eb7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ebe:	eb ac                	jmp    801e6c <read+0x6a>
+
+0000000000801ec0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ec0:	55                   	push   %rbp
+  801ec1:	48 89 e5             	mov    %rsp,%rbp
+  801ec4:	41 57                	push   %r15
+  801ec6:	41 56                	push   %r14
+  801ec8:	41 55                	push   %r13
+  801eca:	41 54                	push   %r12
+  801ecc:	53                   	push   %rbx
+  801ecd:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ed1:	48 85 d2             	test   %rdx,%rdx
+  801ed4:	74 54                	je     801f2a <readn+0x6a>
+  801ed6:	41 89 fd             	mov    %edi,%r13d
+  801ed9:	49 89 f6             	mov    %rsi,%r14
+  801edc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801edf:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ee4:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801ee9:	49 bf 02 1e 80 00 00 	movabs $0x801e02,%r15
+  801ef0:	00 00 00 
+  801ef3:	4c 89 e2             	mov    %r12,%rdx
+  801ef6:	48 29 f2             	sub    %rsi,%rdx
+  801ef9:	4c 01 f6             	add    %r14,%rsi
+  801efc:	44 89 ef             	mov    %r13d,%edi
+  801eff:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 20                	js     801f26 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801f06:	01 c3                	add    %eax,%ebx
+  801f08:	85 c0                	test   %eax,%eax
+  801f0a:	74 08                	je     801f14 <readn+0x54>
+  801f0c:	48 63 f3             	movslq %ebx,%rsi
+  801f0f:	4c 39 e6             	cmp    %r12,%rsi
+  801f12:	72 df                	jb     801ef3 <readn+0x33>
+    }
+    return res;
+  801f14:	48 63 c3             	movslq %ebx,%rax
+}
+  801f17:	48 83 c4 08          	add    $0x8,%rsp
+  801f1b:	5b                   	pop    %rbx
+  801f1c:	41 5c                	pop    %r12
+  801f1e:	41 5d                	pop    %r13
+  801f20:	41 5e                	pop    %r14
+  801f22:	41 5f                	pop    %r15
+  801f24:	5d                   	pop    %rbp
+  801f25:	c3                   	ret
+        if (inc < 0) return inc;
+  801f26:	48 98                	cltq
+  801f28:	eb ed                	jmp    801f17 <readn+0x57>
+    int inc = 1, res = 0;
+  801f2a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801f2f:	eb e3                	jmp    801f14 <readn+0x54>
+
+0000000000801f31 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801f31:	55                   	push   %rbp
+  801f32:	48 89 e5             	mov    %rsp,%rbp
+  801f35:	41 56                	push   %r14
+  801f37:	41 55                	push   %r13
+  801f39:	41 54                	push   %r12
+  801f3b:	53                   	push   %rbx
+  801f3c:	48 83 ec 10          	sub    $0x10,%rsp
+  801f40:	89 fb                	mov    %edi,%ebx
+  801f42:	49 89 f4             	mov    %rsi,%r12
+  801f45:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f48:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f4c:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  801f53:	00 00 00 
+  801f56:	ff d0                	call   *%rax
+  801f58:	85 c0                	test   %eax,%eax
+  801f5a:	78 47                	js     801fa3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f5c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f60:	41 8b 3e             	mov    (%r14),%edi
+  801f63:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f67:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  801f6e:	00 00 00 
+  801f71:	ff d0                	call   *%rax
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 30                	js     801fa7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f77:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801f7c:	74 2d                	je     801fab <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801f7e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f82:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801f86:	48 85 c0             	test   %rax,%rax
+  801f89:	74 56                	je     801fe1 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801f8b:	4c 89 ea             	mov    %r13,%rdx
+  801f8e:	4c 89 e6             	mov    %r12,%rsi
+  801f91:	4c 89 f7             	mov    %r14,%rdi
+  801f94:	ff d0                	call   *%rax
+}
+  801f96:	48 83 c4 10          	add    $0x10,%rsp
+  801f9a:	5b                   	pop    %rbx
+  801f9b:	41 5c                	pop    %r12
+  801f9d:	41 5d                	pop    %r13
+  801f9f:	41 5e                	pop    %r14
+  801fa1:	5d                   	pop    %rbp
+  801fa2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fa3:	48 98                	cltq
+  801fa5:	eb ef                	jmp    801f96 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fa7:	48 98                	cltq
+  801fa9:	eb eb                	jmp    801f96 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801fab:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  801fb2:	00 00 00 
+  801fb5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801fbb:	89 da                	mov    %ebx,%edx
+  801fbd:	48 bf 65 54 80 00 00 	movabs $0x805465,%rdi
+  801fc4:	00 00 00 
+  801fc7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fcc:	48 b9 60 06 80 00 00 	movabs $0x800660,%rcx
+  801fd3:	00 00 00 
+  801fd6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fd8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fdf:	eb b5                	jmp    801f96 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801fe1:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fe8:	eb ac                	jmp    801f96 <write+0x65>
+
+0000000000801fea <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801fea:	55                   	push   %rbp
+  801feb:	48 89 e5             	mov    %rsp,%rbp
+  801fee:	41 54                	push   %r12
+  801ff0:	53                   	push   %rbx
+  801ff1:	48 83 ec 10          	sub    $0x10,%rsp
+  801ff5:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ff7:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ffb:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  802002:	00 00 00 
+  802005:	ff d0                	call   *%rax
+  802007:	85 c0                	test   %eax,%eax
+  802009:	78 3e                	js     802049 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  80200b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80200f:	41 8b 3c 24          	mov    (%r12),%edi
+  802013:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802017:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  80201e:	00 00 00 
+  802021:	ff d0                	call   *%rax
+  802023:	85 c0                	test   %eax,%eax
+  802025:	78 22                	js     802049 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802027:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  80202b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  80202f:	48 85 c0             	test   %rax,%rax
+  802032:	74 0b                	je     80203f <seek+0x55>
+  802034:	89 de                	mov    %ebx,%esi
+  802036:	4c 89 e7             	mov    %r12,%rdi
+  802039:	ff d0                	call   *%rax
+  80203b:	85 c0                	test   %eax,%eax
+  80203d:	78 0a                	js     802049 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  80203f:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802044:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802049:	48 83 c4 10          	add    $0x10,%rsp
+  80204d:	5b                   	pop    %rbx
+  80204e:	41 5c                	pop    %r12
+  802050:	5d                   	pop    %rbp
+  802051:	c3                   	ret
+
+0000000000802052 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802052:	55                   	push   %rbp
+  802053:	48 89 e5             	mov    %rsp,%rbp
+  802056:	41 55                	push   %r13
+  802058:	41 54                	push   %r12
+  80205a:	53                   	push   %rbx
+  80205b:	48 83 ec 18          	sub    $0x18,%rsp
+  80205f:	89 fb                	mov    %edi,%ebx
+  802061:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802064:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802068:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  80206f:	00 00 00 
+  802072:	ff d0                	call   *%rax
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 38                	js     8020b0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802078:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  80207c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802080:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802084:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  80208b:	00 00 00 
+  80208e:	ff d0                	call   *%rax
+  802090:	85 c0                	test   %eax,%eax
+  802092:	78 1c                	js     8020b0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802094:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802099:	74 20                	je     8020bb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  80209b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209f:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8020a3:	48 85 c0             	test   %rax,%rax
+  8020a6:	74 47                	je     8020ef <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8020a8:	44 89 e6             	mov    %r12d,%esi
+  8020ab:	4c 89 ef             	mov    %r13,%rdi
+  8020ae:	ff d0                	call   *%rax
+}
+  8020b0:	48 83 c4 18          	add    $0x18,%rsp
+  8020b4:	5b                   	pop    %rbx
+  8020b5:	41 5c                	pop    %r12
+  8020b7:	41 5d                	pop    %r13
+  8020b9:	5d                   	pop    %rbp
+  8020ba:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8020bb:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8020c2:	00 00 00 
+  8020c5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8020cb:	89 da                	mov    %ebx,%edx
+  8020cd:	48 bf 28 54 80 00 00 	movabs $0x805428,%rdi
+  8020d4:	00 00 00 
+  8020d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020dc:	48 b9 60 06 80 00 00 	movabs $0x800660,%rcx
+  8020e3:	00 00 00 
+  8020e6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020e8:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8020ed:	eb c1                	jmp    8020b0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8020ef:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  8020f4:	eb ba                	jmp    8020b0 <ftruncate+0x5e>
+
+00000000008020f6 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  8020f6:	55                   	push   %rbp
+  8020f7:	48 89 e5             	mov    %rsp,%rbp
+  8020fa:	41 54                	push   %r12
+  8020fc:	53                   	push   %rbx
+  8020fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802101:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802104:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802108:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  80210f:	00 00 00 
+  802112:	ff d0                	call   *%rax
+  802114:	85 c0                	test   %eax,%eax
+  802116:	78 4e                	js     802166 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802118:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  80211c:	41 8b 3c 24          	mov    (%r12),%edi
+  802120:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802124:	48 b8 6a 1b 80 00 00 	movabs $0x801b6a,%rax
+  80212b:	00 00 00 
+  80212e:	ff d0                	call   *%rax
+  802130:	85 c0                	test   %eax,%eax
+  802132:	78 32                	js     802166 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802134:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802138:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80213d:	74 30                	je     80216f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  80213f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802142:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802149:	00 00 00 
+    stat->st_isdir = 0;
+  80214c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802153:	00 00 00 
+    stat->st_dev = dev;
+  802156:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80215d:	48 89 de             	mov    %rbx,%rsi
+  802160:	4c 89 e7             	mov    %r12,%rdi
+  802163:	ff 50 28             	call   *0x28(%rax)
+}
+  802166:	48 83 c4 10          	add    $0x10,%rsp
+  80216a:	5b                   	pop    %rbx
+  80216b:	41 5c                	pop    %r12
+  80216d:	5d                   	pop    %rbp
+  80216e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80216f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802174:	eb f0                	jmp    802166 <fstat+0x70>
+
+0000000000802176 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802176:	55                   	push   %rbp
+  802177:	48 89 e5             	mov    %rsp,%rbp
+  80217a:	41 54                	push   %r12
+  80217c:	53                   	push   %rbx
+  80217d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802180:	be 00 00 00 00       	mov    $0x0,%esi
+  802185:	48 b8 e4 32 80 00 00 	movabs $0x8032e4,%rax
+  80218c:	00 00 00 
+  80218f:	ff d0                	call   *%rax
+  802191:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802193:	85 c0                	test   %eax,%eax
+  802195:	78 25                	js     8021bc <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802197:	4c 89 e6             	mov    %r12,%rsi
+  80219a:	89 c7                	mov    %eax,%edi
+  80219c:	48 b8 f6 20 80 00 00 	movabs $0x8020f6,%rax
+  8021a3:	00 00 00 
+  8021a6:	ff d0                	call   *%rax
+  8021a8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8021ab:	89 df                	mov    %ebx,%edi
+  8021ad:	48 b8 84 1c 80 00 00 	movabs $0x801c84,%rax
+  8021b4:	00 00 00 
+  8021b7:	ff d0                	call   *%rax
+
+    return res;
+  8021b9:	44 89 e3             	mov    %r12d,%ebx
+}
+  8021bc:	89 d8                	mov    %ebx,%eax
+  8021be:	5b                   	pop    %rbx
+  8021bf:	41 5c                	pop    %r12
+  8021c1:	5d                   	pop    %rbp
+  8021c2:	c3                   	ret
+
+00000000008021c3 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021c3:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8021ca:	00 00 00 
+  8021cd:	83 38 00             	cmpl   $0x0,(%rax)
+  8021d0:	74 0a                	je     8021dc <fsenv+0x19>
+    return envid;
+}
+  8021d2:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8021d9:	00 00 
+  8021db:	c3                   	ret
+fsenv(void) {
+  8021dc:	55                   	push   %rbp
+  8021dd:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8021e0:	bf 03 00 00 00       	mov    $0x3,%edi
+  8021e5:	48 b8 55 4d 80 00 00 	movabs $0x804d55,%rax
+  8021ec:	00 00 00 
+  8021ef:	ff d0                	call   *%rax
+  8021f1:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8021f8:	00 00 
+}
+  8021fa:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802201:	00 00 
+  802203:	5d                   	pop    %rbp
+  802204:	c3                   	ret
+
+0000000000802205 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802205:	55                   	push   %rbp
+  802206:	48 89 e5             	mov    %rsp,%rbp
+  802209:	41 54                	push   %r12
+  80220b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80220c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802211:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802216:	48 89 de             	mov    %rbx,%rsi
+  802219:	bf 00 00 00 00       	mov    $0x0,%edi
+  80221e:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  802225:	00 00 00 
+  802228:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80222a:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802231:	00 00 00 
+  802234:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80223a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80223f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802244:	48 89 de             	mov    %rbx,%rsi
+  802247:	bf 00 00 00 00       	mov    $0x0,%edi
+  80224c:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  802253:	00 00 00 
+  802256:	ff d0                	call   *%rax
+  802258:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80225a:	85 c0                	test   %eax,%eax
+  80225c:	0f 88 a2 00 00 00    	js     802304 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802262:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  802269:	00 00 00 
+  80226c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802272:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802277:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802279:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80227e:	49 bc ba 45 80 00 00 	movabs $0x8045ba,%r12
+  802285:	00 00 00 
+  802288:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80228b:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802290:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802293:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  80229a:	00 00 00 
+  80229d:	ff d0                	call   *%rax
+  80229f:	89 c7                	mov    %eax,%edi
+  8022a1:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8022a7:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8022ac:	48 89 da             	mov    %rbx,%rdx
+  8022af:	be 09 00 00 00       	mov    $0x9,%esi
+  8022b4:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  8022bb:	00 00 00 
+  8022be:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8022c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022c5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8022cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8022d4:	48 b8 db 4c 80 00 00 	movabs $0x804cdb,%rax
+  8022db:	00 00 00 
+  8022de:	ff d0                	call   *%rax
+  8022e0:	89 c3                	mov    %eax,%ebx
+  8022e2:	85 c0                	test   %eax,%eax
+  8022e4:	78 25                	js     80230b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8022e6:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8022ed:	00 00 00 
+  8022f0:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8022f6:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8022fd:	00 00 
+    return 0;
+  8022ff:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802304:	89 d8                	mov    %ebx,%eax
+  802306:	5b                   	pop    %rbx
+  802307:	41 5c                	pop    %r12
+  802309:	5d                   	pop    %rbp
+  80230a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80230b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802310:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802315:	bf 00 00 00 00       	mov    $0x0,%edi
+  80231a:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  802321:	00 00 00 
+  802324:	ff d0                	call   *%rax
+        return res;
+  802326:	eb dc                	jmp    802304 <fschan_setup+0xff>
+
+0000000000802328 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802328:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80232f:	00 00 00 
+  802332:	80 38 00             	cmpb   $0x0,(%rax)
+  802335:	74 55                	je     80238c <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802337:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  80233e:	00 00 00 
+  802341:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802347:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80234c:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802353:	00 00 00 
+  802356:	3b 0a                	cmp    (%rdx),%ecx
+  802358:	75 01                	jne    80235b <fschan+0x33>
+}
+  80235a:	c3                   	ret
+fschan(void) {
+  80235b:	55                   	push   %rbp
+  80235c:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80235f:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  802366:	00 00 00 
+  802369:	ff d0                	call   *%rax
+  80236b:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80236d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802372:	85 d2                	test   %edx,%edx
+  802374:	78 02                	js     802378 <fschan+0x50>
+}
+  802376:	5d                   	pop    %rbp
+  802377:	c3                   	ret
+        fschan_enabled = 0;
+  802378:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80237f:	00 00 00 
+  802382:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802385:	b8 00 00 00 00       	mov    $0x0,%eax
+  80238a:	eb ea                	jmp    802376 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80238c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802391:	c3                   	ret
+
+0000000000802392 <fbuf>:
+fbuf(struct Fd *fd) {
+  802392:	55                   	push   %rbp
+  802393:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802396:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  80239d:	00 00 00 
+  8023a0:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8023a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023a7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8023ab:	77 12                	ja     8023bf <fbuf+0x2d>
+  8023ad:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8023b1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8023b8:	00 00 00 
+  8023bb:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8023bf:	48 89 d0             	mov    %rdx,%rax
+  8023c2:	5d                   	pop    %rbp
+  8023c3:	c3                   	ret
+
+00000000008023c4 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8023c4:	55                   	push   %rbp
+  8023c5:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8023c8:	48 83 c7 40          	add    $0x40,%rdi
+  8023cc:	48 b8 f4 45 80 00 00 	movabs $0x8045f4,%rax
+  8023d3:	00 00 00 
+  8023d6:	ff d0                	call   *%rax
+  8023d8:	84 c0                	test   %al,%al
+  8023da:	75 02                	jne    8023de <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8023dc:	5d                   	pop    %rbp
+  8023dd:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8023de:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  8023e5:	00 00 00 
+  8023e8:	ff d0                	call   *%rax
+  8023ea:	89 c7                	mov    %eax,%edi
+  8023ec:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023f2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023fc:	be 0a 00 00 00       	mov    $0xa,%esi
+  802401:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  802408:	00 00 00 
+  80240b:	ff d0                	call   *%rax
+}
+  80240d:	eb cd                	jmp    8023dc <fschan_publish+0x18>
+
+000000000080240f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80240f:	55                   	push   %rbp
+  802410:	48 89 e5             	mov    %rsp,%rbp
+  802413:	41 57                	push   %r15
+  802415:	41 56                	push   %r14
+  802417:	41 55                	push   %r13
+  802419:	41 54                	push   %r12
+  80241b:	53                   	push   %rbx
+  80241c:	48 83 ec 48          	sub    $0x48,%rsp
+  802420:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802424:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802428:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80242b:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80242f:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802432:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802439:	00 00 00 
+  80243c:	8b 02                	mov    (%rdx),%eax
+  80243e:	83 c0 01             	add    $0x1,%eax
+  802441:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802446:	0f 44 c1             	cmove  %ecx,%eax
+  802449:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80244b:	4d 85 c0             	test   %r8,%r8
+  80244e:	74 2c                	je     80247c <fschan_rw+0x6d>
+  802450:	45 89 ce             	mov    %r9d,%r14d
+  802453:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80245a:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80245e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802464:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80246b:	00 
+  80246c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802472:	b8 01 00 00 00       	mov    $0x1,%eax
+  802477:	e9 41 01 00 00       	jmp    8025bd <fschan_rw+0x1ae>
+  80247c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802480:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802484:	e9 9c 01 00 00       	jmp    802625 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802489:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80248d:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802490:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802493:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802496:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80249a:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80249e:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8024a2:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8024a6:	48 89 da             	mov    %rbx,%rdx
+  8024a9:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  8024b0:	00 00 00 
+  8024b3:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8024b5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8024b9:	48 b8 c4 23 80 00 00 	movabs $0x8023c4,%rax
+  8024c0:	00 00 00 
+  8024c3:	ff d0                	call   *%rax
+            queued += blk;
+  8024c5:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8024c8:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8024cc:	4d 39 fc             	cmp    %r15,%r12
+  8024cf:	73 6b                	jae    80253c <fschan_rw+0x12d>
+  8024d1:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8024d5:	77 65                	ja     80253c <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8024d7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8024db:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8024df:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8024eb:	4c 89 fb             	mov    %r15,%rbx
+  8024ee:	4c 29 e3             	sub    %r12,%rbx
+  8024f1:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8024f6:	48 39 d3             	cmp    %rdx,%rbx
+  8024f9:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8024fd:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802501:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802505:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802509:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80250c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80250e:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802515:	00 00 00 
+  802518:	8b 09                	mov    (%rcx),%ecx
+  80251a:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80251d:	83 fe 03             	cmp    $0x3,%esi
+  802520:	0f 85 63 ff ff ff    	jne    802489 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802526:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80252a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80252d:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802530:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802533:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802537:	e9 79 ff ff ff       	jmp    8024b5 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80253c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802540:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802547:	48 89 df             	mov    %rbx,%rdi
+  80254a:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802556:	48 89 df             	mov    %rbx,%rdi
+  802559:	48 b8 20 46 80 00 00 	movabs $0x804620,%rax
+  802560:	00 00 00 
+  802563:	ff d0                	call   *%rax
+  802565:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802569:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80256d:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802571:	75 25                	jne    802598 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802573:	8b 40 04             	mov    0x4(%rax),%eax
+  802576:	85 c0                	test   %eax,%eax
+  802578:	0f 88 86 00 00 00    	js     802604 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80257e:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802582:	74 5b                	je     8025df <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802584:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802588:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80258c:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802590:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802594:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802598:	48 89 df             	mov    %rbx,%rdi
+  80259b:	48 b8 47 46 80 00 00 	movabs $0x804647,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8025a7:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8025ab:	83 f0 01             	xor    $0x1,%eax
+  8025ae:	4d 39 fc             	cmp    %r15,%r12
+  8025b1:	0f 92 c2             	setb   %dl
+  8025b4:	84 c2                	test   %al,%dl
+  8025b6:	75 05                	jne    8025bd <fschan_rw+0x1ae>
+  8025b8:	45 85 ed             	test   %r13d,%r13d
+  8025bb:	74 50                	je     80260d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8025bd:	4d 39 fc             	cmp    %r15,%r12
+  8025c0:	0f 92 c1             	setb   %cl
+  8025c3:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8025c7:	0f 96 c2             	setbe  %dl
+  8025ca:	84 d1                	test   %dl,%cl
+  8025cc:	0f 84 6a ff ff ff    	je     80253c <fschan_rw+0x12d>
+  8025d2:	84 c0                	test   %al,%al
+  8025d4:	0f 85 fd fe ff ff    	jne    8024d7 <fschan_rw+0xc8>
+  8025da:	e9 5d ff ff ff       	jmp    80253c <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8025df:	48 63 d0             	movslq %eax,%rdx
+  8025e2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8025e6:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8025ea:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8025ee:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8025f2:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8025f6:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  8025fd:	00 00 00 
+  802600:	ff d0                	call   *%rax
+  802602:	eb 80                	jmp    802584 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802604:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802607:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80260b:	eb 8b                	jmp    802598 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80260d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802612:	0f 85 68 fe ff ff    	jne    802480 <fschan_rw+0x71>
+  802618:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80261b:	85 c0                	test   %eax,%eax
+  80261d:	0f 84 5d fe ff ff    	je     802480 <fschan_rw+0x71>
+  802623:	48 98                	cltq
+}
+  802625:	48 83 c4 48          	add    $0x48,%rsp
+  802629:	5b                   	pop    %rbx
+  80262a:	41 5c                	pop    %r12
+  80262c:	41 5d                	pop    %r13
+  80262e:	41 5e                	pop    %r14
+  802630:	41 5f                	pop    %r15
+  802632:	5d                   	pop    %rbp
+  802633:	c3                   	ret
+
+0000000000802634 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802634:	55                   	push   %rbp
+  802635:	48 89 e5             	mov    %rsp,%rbp
+  802638:	41 56                	push   %r14
+  80263a:	41 55                	push   %r13
+  80263c:	41 54                	push   %r12
+  80263e:	53                   	push   %rbx
+  80263f:	48 83 ec 10          	sub    $0x10,%rsp
+  802643:	49 89 fe             	mov    %rdi,%r14
+  802646:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802649:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80264d:	48 29 f3             	sub    %rsi,%rbx
+  802650:	48 39 d3             	cmp    %rdx,%rbx
+  802653:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802657:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80265e:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80265f:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802664:	49 bd 51 44 80 00 00 	movabs $0x804451,%r13
+  80266b:	00 00 00 
+  80266e:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802675:	76 1e                	jbe    802695 <mmap_fault+0x61>
+  802677:	4c 01 e7             	add    %r12,%rdi
+  80267a:	41 ff d5             	call   *%r13
+  80267d:	84 c0                	test   %al,%al
+  80267f:	75 14                	jne    802695 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802681:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802685:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80268c:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802690:	48 39 df             	cmp    %rbx,%rdi
+  802693:	72 e2                	jb     802677 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802695:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80269c:	00 00 00 
+  80269f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8026a6:	00 00 00 
+  8026a9:	4c 89 f0             	mov    %r14,%rax
+  8026ac:	48 29 d0             	sub    %rdx,%rax
+  8026af:	48 c1 f8 03          	sar    $0x3,%rax
+  8026b3:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8026ba:	aa aa aa 
+  8026bd:	48 0f af c2          	imul   %rdx,%rax
+  8026c1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8026c5:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8026ca:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8026ce:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8026d0:	44 89 e0             	mov    %r12d,%eax
+  8026d3:	41 03 46 10          	add    0x10(%r14),%eax
+  8026d7:	41 2b 06             	sub    (%r14),%eax
+  8026da:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8026dd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8026e1:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8026e5:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8026e9:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8026ec:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  8026f3:	00 00 00 
+  8026f6:	ff d0                	call   *%rax
+  8026f8:	89 c7                	mov    %eax,%edi
+  8026fa:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802700:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802705:	48 89 da             	mov    %rbx,%rdx
+  802708:	be 0f 00 00 00       	mov    $0xf,%esi
+  80270d:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802719:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80271e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802722:	4c 89 e6             	mov    %r12,%rsi
+  802725:	bf 00 00 00 00       	mov    $0x0,%edi
+  80272a:	48 b8 db 4c 80 00 00 	movabs $0x804cdb,%rax
+  802731:	00 00 00 
+  802734:	ff d0                	call   *%rax
+  802736:	48 98                	cltq
+}
+  802738:	48 83 c4 10          	add    $0x10,%rsp
+  80273c:	5b                   	pop    %rbx
+  80273d:	41 5c                	pop    %r12
+  80273f:	41 5d                	pop    %r13
+  802741:	41 5e                	pop    %r14
+  802743:	5d                   	pop    %rbp
+  802744:	c3                   	ret
+
+0000000000802745 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802745:	48 8b 37             	mov    (%rdi),%rsi
+  802748:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80274f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802756:	00 00 00 
+  802759:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80275e:	eb 0f                	jmp    80276f <mmap_pgfault+0x2a>
+  802760:	c3                   	ret
+  802761:	48 83 c1 01          	add    $0x1,%rcx
+  802765:	48 83 c2 18          	add    $0x18,%rdx
+  802769:	48 83 f9 20          	cmp    $0x20,%rcx
+  80276d:	74 6e                	je     8027dd <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80276f:	48 8b 02             	mov    (%rdx),%rax
+  802772:	48 83 e8 01          	sub    $0x1,%rax
+  802776:	48 39 f0             	cmp    %rsi,%rax
+  802779:	73 e6                	jae    802761 <mmap_pgfault+0x1c>
+  80277b:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80277f:	73 e0                	jae    802761 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802781:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278a:	f6 c2 01             	test   $0x1,%dl
+  80278d:	75 d1                	jne    802760 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80278f:	f6 c2 02             	test   $0x2,%dl
+  802792:	74 1a                	je     8027ae <mmap_pgfault+0x69>
+  802794:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802798:	b8 00 00 00 00       	mov    $0x0,%eax
+  80279d:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8027a4:	00 00 00 
+  8027a7:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8027ac:	74 35                	je     8027e3 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8027ae:	55                   	push   %rbp
+  8027af:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8027b2:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8027b6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027bd:	00 00 00 
+  8027c0:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8027c4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8027c9:	48 b8 34 26 80 00 00 	movabs $0x802634,%rax
+  8027d0:	00 00 00 
+  8027d3:	ff d0                	call   *%rax
+  8027d5:	48 85 c0             	test   %rax,%rax
+  8027d8:	0f 9f c0             	setg   %al
+}
+  8027db:	5d                   	pop    %rbp
+  8027dc:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8027dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e2:	c3                   	ret
+}
+  8027e3:	c3                   	ret
+
+00000000008027e4 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8027e4:	55                   	push   %rbp
+  8027e5:	48 89 e5             	mov    %rsp,%rbp
+  8027e8:	41 54                	push   %r12
+  8027ea:	53                   	push   %rbx
+  8027eb:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8027ee:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8027f5:	00 00 00 
+  8027f8:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8027fd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802801:	74 15                	je     802818 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802803:	48 83 c3 01          	add    $0x1,%rbx
+  802807:	48 83 c0 18          	add    $0x18,%rax
+  80280b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80280f:	75 ec                	jne    8027fd <mmap_alloc+0x19>
+    return NULL;
+  802811:	b8 00 00 00 00       	mov    $0x0,%eax
+  802816:	eb 52                	jmp    80286a <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802818:	4c 89 e7             	mov    %r12,%rdi
+  80281b:	48 b8 f2 43 80 00 00 	movabs $0x8043f2,%rax
+  802822:	00 00 00 
+  802825:	ff d0                	call   *%rax
+  802827:	41 89 c1             	mov    %eax,%r9d
+  80282a:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802831:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802835:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80283b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802840:	4c 89 e6             	mov    %r12,%rsi
+  802843:	bf 00 00 00 00       	mov    $0x0,%edi
+  802848:	48 b8 3a 15 80 00 00 	movabs $0x80153a,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+  802854:	85 c0                	test   %eax,%eax
+  802856:	78 17                	js     80286f <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802858:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80285c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802863:	00 00 00 
+  802866:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80286a:	5b                   	pop    %rbx
+  80286b:	41 5c                	pop    %r12
+  80286d:	5d                   	pop    %rbp
+  80286e:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80286f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802874:	eb f4                	jmp    80286a <mmap_alloc+0x86>
+
+0000000000802876 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802876:	55                   	push   %rbp
+  802877:	48 89 e5             	mov    %rsp,%rbp
+  80287a:	41 56                	push   %r14
+  80287c:	41 55                	push   %r13
+  80287e:	41 54                	push   %r12
+  802880:	53                   	push   %rbx
+  802881:	48 83 ec 10          	sub    $0x10,%rsp
+  802885:	41 89 fc             	mov    %edi,%r12d
+  802888:	49 89 f5             	mov    %rsi,%r13
+  80288b:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80288e:	48 89 f0             	mov    %rsi,%rax
+  802891:	48 09 d0             	or     %rdx,%rax
+  802894:	75 0d                	jne    8028a3 <fsipc+0x2d>
+  802896:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802899:	83 f8 04             	cmp    $0x4,%eax
+  80289c:	76 7d                	jbe    80291b <fsipc+0xa5>
+  80289e:	83 ff 0d             	cmp    $0xd,%edi
+  8028a1:	74 78                	je     80291b <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8028a3:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  8028aa:	00 00 00 
+  8028ad:	ff d0                	call   *%rax
+  8028af:	89 c7                	mov    %eax,%edi
+  8028b1:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8028b8:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8028bf:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8028c6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8028cc:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8028d3:	00 00 00 
+  8028d6:	44 89 e6             	mov    %r12d,%esi
+  8028d9:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  8028e0:	00 00 00 
+  8028e3:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8028e5:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8028ec:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8028ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8028f2:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8028f6:	4c 89 ee             	mov    %r13,%rsi
+  8028f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8028fe:	48 b8 db 4c 80 00 00 	movabs $0x804cdb,%rax
+  802905:	00 00 00 
+  802908:	ff d0                	call   *%rax
+  80290a:	89 c3                	mov    %eax,%ebx
+}
+  80290c:	89 d8                	mov    %ebx,%eax
+  80290e:	48 83 c4 10          	add    $0x10,%rsp
+  802912:	5b                   	pop    %rbx
+  802913:	41 5c                	pop    %r12
+  802915:	41 5d                	pop    %r13
+  802917:	41 5e                	pop    %r14
+  802919:	5d                   	pop    %rbp
+  80291a:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80291b:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  802922:	00 00 00 
+  802925:	ff d0                	call   *%rax
+  802927:	49 89 c6             	mov    %rax,%r14
+  80292a:	48 85 c0             	test   %rax,%rax
+  80292d:	0f 84 70 ff ff ff    	je     8028a3 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802933:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802937:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  80293e:	00 00 00 
+  802941:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802943:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802946:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80294d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802951:	ba 10 00 00 00       	mov    $0x10,%edx
+  802956:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80295d:	00 00 00 
+  802960:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  802967:	00 00 00 
+  80296a:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80296c:	4c 89 f7             	mov    %r14,%rdi
+  80296f:	48 b8 c4 23 80 00 00 	movabs $0x8023c4,%rax
+  802976:	00 00 00 
+  802979:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80297b:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802982:	4c 89 f7             	mov    %r14,%rdi
+  802985:	48 b8 92 46 80 00 00 	movabs $0x804692,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802991:	4c 89 f7             	mov    %r14,%rdi
+  802994:	48 b8 20 46 80 00 00 	movabs $0x804620,%rax
+  80299b:	00 00 00 
+  80299e:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8029a0:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8029a3:	41 83 fc 05          	cmp    $0x5,%r12d
+  8029a7:	75 04                	jne    8029ad <fsipc+0x137>
+  8029a9:	85 db                	test   %ebx,%ebx
+  8029ab:	79 14                	jns    8029c1 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8029ad:	4c 89 f7             	mov    %r14,%rdi
+  8029b0:	48 b8 47 46 80 00 00 	movabs $0x804647,%rax
+  8029b7:	00 00 00 
+  8029ba:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8029bc:	e9 4b ff ff ff       	jmp    80290c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8029c1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8029c5:	ba 88 00 00 00       	mov    $0x88,%edx
+  8029ca:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8029d1:	00 00 00 
+  8029d4:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  8029db:	00 00 00 
+  8029de:	ff d0                	call   *%rax
+  8029e0:	eb cb                	jmp    8029ad <fsipc+0x137>
+
+00000000008029e2 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8029e2:	55                   	push   %rbp
+  8029e3:	48 89 e5             	mov    %rsp,%rbp
+  8029e6:	41 57                	push   %r15
+  8029e8:	41 56                	push   %r14
+  8029ea:	41 55                	push   %r13
+  8029ec:	41 54                	push   %r12
+  8029ee:	53                   	push   %rbx
+  8029ef:	48 83 ec 18          	sub    $0x18,%rsp
+  8029f3:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8029f7:	49 89 f6             	mov    %rsi,%r14
+  8029fa:	49 89 d4             	mov    %rdx,%r12
+  8029fd:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802a00:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  802a07:	00 00 00 
+  802a0a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802a0c:	48 85 c0             	test   %rax,%rax
+  802a0f:	0f 85 96 00 00 00    	jne    802aab <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802a15:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802a1c:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a1d:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802a24:	00 00 00 
+    while (n) {
+  802a27:	4d 85 e4             	test   %r12,%r12
+  802a2a:	74 79                	je     802aa5 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802a2c:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802a31:	49 39 dc             	cmp    %rbx,%r12
+  802a34:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802a38:	48 89 da             	mov    %rbx,%rdx
+  802a3b:	4c 89 f6             	mov    %r14,%rsi
+  802a3e:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802a45:	00 00 00 
+  802a48:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  802a4f:	00 00 00 
+  802a52:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802a54:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802a58:	8b 40 0c             	mov    0xc(%rax),%eax
+  802a5b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802a5e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802a61:	44 01 e8             	add    %r13d,%eax
+  802a64:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802a68:	41 0f 44 c5          	cmove  %r13d,%eax
+  802a6c:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802a70:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802a74:	48 89 da             	mov    %rbx,%rdx
+  802a77:	be 00 00 00 00       	mov    $0x0,%esi
+  802a7c:	bf 04 00 00 00       	mov    $0x4,%edi
+  802a81:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  802a88:	00 00 00 
+  802a8b:	ff d0                	call   *%rax
+        if (res < 0)
+  802a8d:	85 c0                	test   %eax,%eax
+  802a8f:	78 4a                	js     802adb <devfile_write_direct+0xf9>
+        buf += res;
+  802a91:	48 98                	cltq
+  802a93:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802a96:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802a9a:	49 29 c4             	sub    %rax,%r12
+  802a9d:	75 8d                	jne    802a2c <devfile_write_direct+0x4a>
+    return write;
+  802a9f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802aa3:	eb 27                	jmp    802acc <devfile_write_direct+0xea>
+    size_t write = 0;
+  802aa5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802aa9:	eb f4                	jmp    802a9f <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802aab:	45 89 e9             	mov    %r13d,%r9d
+  802aae:	4d 89 e0             	mov    %r12,%r8
+  802ab1:	4c 89 f1             	mov    %r14,%rcx
+  802ab4:	ba 04 00 00 00       	mov    $0x4,%edx
+  802ab9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802abd:	48 89 c7             	mov    %rax,%rdi
+  802ac0:	48 b8 0f 24 80 00 00 	movabs $0x80240f,%rax
+  802ac7:	00 00 00 
+  802aca:	ff d0                	call   *%rax
+}
+  802acc:	48 83 c4 18          	add    $0x18,%rsp
+  802ad0:	5b                   	pop    %rbx
+  802ad1:	41 5c                	pop    %r12
+  802ad3:	41 5d                	pop    %r13
+  802ad5:	41 5e                	pop    %r14
+  802ad7:	41 5f                	pop    %r15
+  802ad9:	5d                   	pop    %rbp
+  802ada:	c3                   	ret
+            return res;
+  802adb:	48 98                	cltq
+  802add:	eb ed                	jmp    802acc <devfile_write_direct+0xea>
+
+0000000000802adf <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802adf:	55                   	push   %rbp
+  802ae0:	48 89 e5             	mov    %rsp,%rbp
+  802ae3:	41 54                	push   %r12
+  802ae5:	53                   	push   %rbx
+  802ae6:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802ae9:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802af0:	00 00 00 
+  802af3:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802af5:	48 85 c0             	test   %rax,%rax
+  802af8:	74 71                	je     802b6b <fbuf_flush+0x8c>
+  802afa:	48 89 c3             	mov    %rax,%rbx
+  802afd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b02:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802b06:	75 05                	jne    802b0d <fbuf_flush+0x2e>
+}
+  802b08:	5b                   	pop    %rbx
+  802b09:	41 5c                	pop    %r12
+  802b0b:	5d                   	pop    %rbp
+  802b0c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802b0d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802b10:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802b14:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802b1b:	00 00 00 
+  802b1e:	48 89 de             	mov    %rbx,%rsi
+  802b21:	48 29 c6             	sub    %rax,%rsi
+  802b24:	48 c1 fe 03          	sar    $0x3,%rsi
+  802b28:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802b2f:	aa aa aa 
+  802b32:	48 0f af f0          	imul   %rax,%rsi
+  802b36:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802b3a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802b3f:	48 01 c6             	add    %rax,%rsi
+  802b42:	4c 89 e7             	mov    %r12,%rdi
+  802b45:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802b4c:	00 00 00 
+  802b4f:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802b51:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802b55:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802b5c:	00 
+    return res < 0 ? res : 0;
+  802b5d:	48 85 c0             	test   %rax,%rax
+  802b60:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b65:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802b69:	eb 9d                	jmp    802b08 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802b6b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802b70:	eb 96                	jmp    802b08 <fbuf_flush+0x29>
+
+0000000000802b72 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802b72:	55                   	push   %rbp
+  802b73:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802b76:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  802b7d:	00 00 00 
+  802b80:	ff d0                	call   *%rax
+}
+  802b82:	5d                   	pop    %rbp
+  802b83:	c3                   	ret
+
+0000000000802b84 <devfile_write>:
+    if (!fd || !buf)
+  802b84:	48 85 ff             	test   %rdi,%rdi
+  802b87:	0f 84 d3 01 00 00    	je     802d60 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802b8d:	55                   	push   %rbp
+  802b8e:	48 89 e5             	mov    %rsp,%rbp
+  802b91:	41 57                	push   %r15
+  802b93:	41 56                	push   %r14
+  802b95:	41 55                	push   %r13
+  802b97:	41 54                	push   %r12
+  802b99:	53                   	push   %rbx
+  802b9a:	48 83 ec 08          	sub    $0x8,%rsp
+  802b9e:	49 89 fc             	mov    %rdi,%r12
+  802ba1:	49 89 f6             	mov    %rsi,%r14
+  802ba4:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802ba7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802bac:	48 85 f6             	test   %rsi,%rsi
+  802baf:	0f 84 9c 01 00 00    	je     802d51 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802bb5:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802bbc:	00 00 00 
+  802bbf:	ff d0                	call   *%rax
+  802bc1:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802bc4:	48 85 c0             	test   %rax,%rax
+  802bc7:	0f 84 a2 00 00 00    	je     802c6f <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802bcd:	be 00 10 00 00       	mov    $0x1000,%esi
+  802bd2:	4c 89 e7             	mov    %r12,%rdi
+  802bd5:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  802bdc:	00 00 00 
+  802bdf:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802be1:	83 f8 02             	cmp    $0x2,%eax
+  802be4:	0f 8f 85 00 00 00    	jg     802c6f <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802bea:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802bf1:	00 00 00 
+  802bf4:	4d 89 ef             	mov    %r13,%r15
+  802bf7:	49 29 c7             	sub    %rax,%r15
+  802bfa:	49 c1 ff 03          	sar    $0x3,%r15
+  802bfe:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c05:	aa aa aa 
+  802c08:	4c 0f af f8          	imul   %rax,%r15
+  802c0c:	49 c1 e7 0e          	shl    $0xe,%r15
+  802c10:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c15:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802c18:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c1d:	0f 84 d7 00 00 00    	je     802cfa <devfile_write+0x176>
+  802c23:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802c27:	89 c2                	mov    %eax,%edx
+  802c29:	41 03 55 0c          	add    0xc(%r13),%edx
+  802c2d:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802c32:	75 0f                	jne    802c43 <devfile_write+0xbf>
+  802c34:	48 01 d8             	add    %rbx,%rax
+  802c37:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802c3d:	0f 86 92 00 00 00    	jbe    802cd5 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802c43:	4c 89 e7             	mov    %r12,%rdi
+  802c46:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  802c4d:	00 00 00 
+  802c50:	ff d0                	call   *%rax
+  802c52:	85 c0                	test   %eax,%eax
+  802c54:	78 52                	js     802ca8 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c56:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802c5d:	77 7f                	ja     802cde <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802c5f:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802c64:	0f 85 c2 00 00 00    	jne    802d2c <devfile_write+0x1a8>
+  802c6a:	e9 94 00 00 00       	jmp    802d03 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802c6f:	4c 89 e7             	mov    %r12,%rdi
+  802c72:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  802c79:	00 00 00 
+  802c7c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802c7e:	85 c0                	test   %eax,%eax
+  802c80:	79 07                	jns    802c89 <devfile_write+0x105>
+  802c82:	48 98                	cltq
+  802c84:	e9 c8 00 00 00       	jmp    802d51 <devfile_write+0x1cd>
+  802c89:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802c8e:	48 89 da             	mov    %rbx,%rdx
+  802c91:	4c 89 f6             	mov    %r14,%rsi
+  802c94:	4c 89 e7             	mov    %r12,%rdi
+  802c97:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802c9e:	00 00 00 
+  802ca1:	ff d0                	call   *%rax
+  802ca3:	e9 a9 00 00 00       	jmp    802d51 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802ca8:	48 98                	cltq
+  802caa:	e9 a2 00 00 00       	jmp    802d51 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802caf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802cb4:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802cb9:	4c 89 fe             	mov    %r15,%rsi
+  802cbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802cc1:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  802cc8:	00 00 00 
+  802ccb:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802ccd:	85 c0                	test   %eax,%eax
+  802ccf:	79 45                	jns    802d16 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802cd1:	48 98                	cltq
+  802cd3:	eb 7c                	jmp    802d51 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802cd5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802cdc:	76 4e                	jbe    802d2c <devfile_write+0x1a8>
+  802cde:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ce3:	48 89 da             	mov    %rbx,%rdx
+  802ce6:	4c 89 f6             	mov    %r14,%rsi
+  802ce9:	4c 89 e7             	mov    %r12,%rdi
+  802cec:	48 b8 e2 29 80 00 00 	movabs $0x8029e2,%rax
+  802cf3:	00 00 00 
+  802cf6:	ff d0                	call   *%rax
+  802cf8:	eb 57                	jmp    802d51 <devfile_write+0x1cd>
+  802cfa:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d01:	77 db                	ja     802cde <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802d03:	4c 89 ff             	mov    %r15,%rdi
+  802d06:	48 b8 51 44 80 00 00 	movabs $0x804451,%rax
+  802d0d:	00 00 00 
+  802d10:	ff d0                	call   *%rax
+  802d12:	84 c0                	test   %al,%al
+  802d14:	74 99                	je     802caf <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802d16:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802d1b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802d20:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802d24:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802d2b:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802d2c:	4c 89 ff             	mov    %r15,%rdi
+  802d2f:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802d33:	48 89 da             	mov    %rbx,%rdx
+  802d36:	4c 89 f6             	mov    %r14,%rsi
+  802d39:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  802d40:	00 00 00 
+  802d43:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802d45:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802d49:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802d4e:	48 89 d8             	mov    %rbx,%rax
+}
+  802d51:	48 83 c4 08          	add    $0x8,%rsp
+  802d55:	5b                   	pop    %rbx
+  802d56:	41 5c                	pop    %r12
+  802d58:	41 5d                	pop    %r13
+  802d5a:	41 5e                	pop    %r14
+  802d5c:	41 5f                	pop    %r15
+  802d5e:	5d                   	pop    %rbp
+  802d5f:	c3                   	ret
+        return E_INVAL;
+  802d60:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802d65:	c3                   	ret
+
+0000000000802d66 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802d66:	55                   	push   %rbp
+  802d67:	48 89 e5             	mov    %rsp,%rbp
+  802d6a:	41 54                	push   %r12
+  802d6c:	53                   	push   %rbx
+  802d6d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802d70:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  802d77:	00 00 00 
+  802d7a:	ff d0                	call   *%rax
+  802d7c:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802d7f:	48 89 df             	mov    %rbx,%rdi
+  802d82:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802d89:	00 00 00 
+  802d8c:	ff d0                	call   *%rax
+  802d8e:	48 85 c0             	test   %rax,%rax
+  802d91:	74 17                	je     802daa <devfile_flush+0x44>
+  802d93:	48 89 df             	mov    %rbx,%rdi
+  802d96:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  802d9d:	00 00 00 
+  802da0:	ff d0                	call   *%rax
+  802da2:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802da9:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802daa:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dad:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802db4:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802db6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802dbb:	be 00 00 00 00       	mov    $0x0,%esi
+  802dc0:	bf 06 00 00 00       	mov    $0x6,%edi
+  802dc5:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  802dcc:	00 00 00 
+  802dcf:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802dd1:	45 85 e4             	test   %r12d,%r12d
+  802dd4:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802dd8:	5b                   	pop    %rbx
+  802dd9:	41 5c                	pop    %r12
+  802ddb:	5d                   	pop    %rbp
+  802ddc:	c3                   	ret
+
+0000000000802ddd <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802ddd:	55                   	push   %rbp
+  802dde:	48 89 e5             	mov    %rsp,%rbp
+  802de1:	41 57                	push   %r15
+  802de3:	41 56                	push   %r14
+  802de5:	41 55                	push   %r13
+  802de7:	41 54                	push   %r12
+  802de9:	53                   	push   %rbx
+  802dea:	48 83 ec 38          	sub    $0x38,%rsp
+  802dee:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802df2:	49 89 f7             	mov    %rsi,%r15
+  802df5:	48 89 d3             	mov    %rdx,%rbx
+  802df8:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802dfb:	48 b8 28 23 80 00 00 	movabs $0x802328,%rax
+  802e02:	00 00 00 
+  802e05:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e07:	48 85 c0             	test   %rax,%rax
+  802e0a:	75 20                	jne    802e2c <devfile_read_direct+0x4f>
+    bool map = 1;
+  802e0c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802e11:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802e18:	00 
+    while (n) {
+  802e19:	48 85 db             	test   %rbx,%rbx
+  802e1c:	0f 85 df 00 00 00    	jne    802f01 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802e22:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802e26:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e2a:	eb 21                	jmp    802e4d <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802e2c:	45 89 f1             	mov    %r14d,%r9d
+  802e2f:	49 89 d8             	mov    %rbx,%r8
+  802e32:	4c 89 f9             	mov    %r15,%rcx
+  802e35:	ba 03 00 00 00       	mov    $0x3,%edx
+  802e3a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e3e:	48 89 c7             	mov    %rax,%rdi
+  802e41:	48 b8 0f 24 80 00 00 	movabs $0x80240f,%rax
+  802e48:	00 00 00 
+  802e4b:	ff d0                	call   *%rax
+}
+  802e4d:	48 83 c4 38          	add    $0x38,%rsp
+  802e51:	5b                   	pop    %rbx
+  802e52:	41 5c                	pop    %r12
+  802e54:	41 5d                	pop    %r13
+  802e56:	41 5e                	pop    %r14
+  802e58:	41 5f                	pop    %r15
+  802e5a:	5d                   	pop    %rbp
+  802e5b:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e5c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e60:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802e66:	75 1e                	jne    802e86 <devfile_read_direct+0xa9>
+  802e68:	e9 e2 00 00 00       	jmp    802f4f <devfile_read_direct+0x172>
+            if (!res) return read;
+  802e6d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802e71:	eb da                	jmp    802e4d <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802e73:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802e77:	0f 85 d0 01 00 00    	jne    80304d <devfile_read_direct+0x270>
+            map = 0;
+  802e7d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e81:	eb 03                	jmp    802e86 <devfile_read_direct+0xa9>
+  802e83:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802e86:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802e8b:	48 39 d3             	cmp    %rdx,%rbx
+  802e8e:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e92:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802e96:	8b 40 0c             	mov    0xc(%rax),%eax
+  802e99:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802ea0:	00 00 00 
+  802ea3:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802ea5:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802ea9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ead:	be 00 00 00 00       	mov    $0x0,%esi
+  802eb2:	bf 03 00 00 00       	mov    $0x3,%edi
+  802eb7:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  802ebe:	00 00 00 
+  802ec1:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ec3:	85 c0                	test   %eax,%eax
+  802ec5:	0f 8e 63 01 00 00    	jle    80302e <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ecb:	4c 63 e0             	movslq %eax,%r12
+  802ece:	4c 89 e2             	mov    %r12,%rdx
+  802ed1:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802ed8:	00 00 00 
+  802edb:	4c 89 ff             	mov    %r15,%rdi
+  802ede:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  802ee5:	00 00 00 
+  802ee8:	ff d0                	call   *%rax
+        buf += res;
+  802eea:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802eed:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802ef0:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802ef4:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802ef8:	48 85 db             	test   %rbx,%rbx
+  802efb:	0f 84 25 ff ff ff    	je     802e26 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802f01:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802f04:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802f08:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802f0c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f10:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802f17:	0f 97 c2             	seta   %dl
+  802f1a:	20 c2                	and    %al,%dl
+  802f1c:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802f1f:	0f 84 5e ff ff ff    	je     802e83 <devfile_read_direct+0xa6>
+  802f25:	4c 89 fa             	mov    %r15,%rdx
+  802f28:	4d 89 fd             	mov    %r15,%r13
+  802f2b:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802f32:	0f 85 4e ff ff ff    	jne    802e86 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802f38:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802f3c:	0f 84 1a ff ff ff    	je     802e5c <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f42:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802f49:	0f 85 37 ff ff ff    	jne    802e86 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802f4f:	48 89 d8             	mov    %rbx,%rax
+  802f52:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802f58:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802f5d:	48 39 c8             	cmp    %rcx,%rax
+  802f60:	48 0f 47 c1          	cmova  %rcx,%rax
+  802f64:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802f68:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802f6c:	49 89 d4             	mov    %rdx,%r12
+  802f6f:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802f73:	48 b8 f2 43 80 00 00 	movabs $0x8043f2,%rax
+  802f7a:	00 00 00 
+  802f7d:	ff d0                	call   *%rax
+  802f7f:	a8 40                	test   $0x40,%al
+  802f81:	0f 85 b9 00 00 00    	jne    803040 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802f87:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802f8e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802f92:	49 39 c5             	cmp    %rax,%r13
+  802f95:	72 d8                	jb     802f6f <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802f97:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f9b:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802fa2:	00 00 00 
+  802fa5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802fa9:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802fac:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802fae:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802fb2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802fb6:	48 b8 c3 21 80 00 00 	movabs $0x8021c3,%rax
+  802fbd:	00 00 00 
+  802fc0:	ff d0                	call   *%rax
+  802fc2:	89 c7                	mov    %eax,%edi
+  802fc4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802fca:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802fcf:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802fd6:	00 00 00 
+  802fd9:	be 0e 00 00 00       	mov    $0xe,%esi
+  802fde:	48 b8 ff 4c 80 00 00 	movabs $0x804cff,%rax
+  802fe5:	00 00 00 
+  802fe8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802fea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802fef:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ff3:	4c 89 fe             	mov    %r15,%rsi
+  802ff6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ffb:	48 b8 db 4c 80 00 00 	movabs $0x804cdb,%rax
+  803002:	00 00 00 
+  803005:	ff d0                	call   *%rax
+  803007:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  80300a:	48 85 d2             	test   %rdx,%rdx
+  80300d:	0f 84 5a fe ff ff    	je     802e6d <devfile_read_direct+0x90>
+            if (res > 0) {
+  803013:	0f 8e 5a fe ff ff    	jle    802e73 <devfile_read_direct+0x96>
+                buf += res;
+  803019:	48 98                	cltq
+  80301b:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  80301e:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803021:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803025:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803029:	e9 ca fe ff ff       	jmp    802ef8 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  80302e:	41 89 c5             	mov    %eax,%r13d
+  803031:	48 98                	cltq
+  803033:	45 85 ed             	test   %r13d,%r13d
+  803036:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  80303b:	e9 0d fe ff ff       	jmp    802e4d <devfile_read_direct+0x70>
+            map = 0;
+  803040:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803044:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803048:	e9 39 fe ff ff       	jmp    802e86 <devfile_read_direct+0xa9>
+  80304d:	48 89 d0             	mov    %rdx,%rax
+  803050:	e9 f8 fd ff ff       	jmp    802e4d <devfile_read_direct+0x70>
+
+0000000000803055 <devfile_read>:
+    if (!fd || !buf)
+  803055:	48 85 ff             	test   %rdi,%rdi
+  803058:	0f 84 21 02 00 00    	je     80327f <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  80305e:	55                   	push   %rbp
+  80305f:	48 89 e5             	mov    %rsp,%rbp
+  803062:	41 57                	push   %r15
+  803064:	41 56                	push   %r14
+  803066:	41 55                	push   %r13
+  803068:	41 54                	push   %r12
+  80306a:	53                   	push   %rbx
+  80306b:	48 83 ec 28          	sub    $0x28,%rsp
+  80306f:	48 89 fb             	mov    %rdi,%rbx
+  803072:	49 89 f4             	mov    %rsi,%r12
+  803075:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803078:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80307d:	48 85 f6             	test   %rsi,%rsi
+  803080:	74 4b                	je     8030cd <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803082:	48 b8 92 23 80 00 00 	movabs $0x802392,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+  80308e:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803091:	48 85 c0             	test   %rax,%rax
+  803094:	74 22                	je     8030b8 <devfile_read+0x63>
+  803096:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  80309d:	77 19                	ja     8030b8 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80309f:	be 00 10 00 00       	mov    $0x1000,%esi
+  8030a4:	48 89 df             	mov    %rbx,%rdi
+  8030a7:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8030ae:	00 00 00 
+  8030b1:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8030b3:	83 f8 02             	cmp    $0x2,%eax
+  8030b6:	7e 40                	jle    8030f8 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8030b8:	48 89 df             	mov    %rbx,%rdi
+  8030bb:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  8030c2:	00 00 00 
+  8030c5:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030c7:	85 c0                	test   %eax,%eax
+  8030c9:	79 11                	jns    8030dc <devfile_read+0x87>
+  8030cb:	48 98                	cltq
+}
+  8030cd:	48 83 c4 28          	add    $0x28,%rsp
+  8030d1:	5b                   	pop    %rbx
+  8030d2:	41 5c                	pop    %r12
+  8030d4:	41 5d                	pop    %r13
+  8030d6:	41 5e                	pop    %r14
+  8030d8:	41 5f                	pop    %r15
+  8030da:	5d                   	pop    %rbp
+  8030db:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8030dc:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8030e1:	4c 89 ea             	mov    %r13,%rdx
+  8030e4:	4c 89 e6             	mov    %r12,%rsi
+  8030e7:	48 89 df             	mov    %rbx,%rdi
+  8030ea:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  8030f1:	00 00 00 
+  8030f4:	ff d0                	call   *%rax
+  8030f6:	eb d5                	jmp    8030cd <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  8030f8:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  8030fc:	48 89 df             	mov    %rbx,%rdi
+  8030ff:	48 b8 df 2a 80 00 00 	movabs $0x802adf,%rax
+  803106:	00 00 00 
+  803109:	ff d0                	call   *%rax
+  80310b:	85 c0                	test   %eax,%eax
+  80310d:	0f 88 33 01 00 00    	js     803246 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803113:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  80311a:	00 00 00 
+  80311d:	4c 89 f0             	mov    %r14,%rax
+  803120:	48 29 d0             	sub    %rdx,%rax
+  803123:	48 c1 f8 03          	sar    $0x3,%rax
+  803127:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80312e:	aa aa aa 
+  803131:	48 0f af c2          	imul   %rdx,%rax
+  803135:	48 c1 e0 0e          	shl    $0xe,%rax
+  803139:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80313d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803140:	41 39 06             	cmp    %eax,(%r14)
+  803143:	75 0d                	jne    803152 <devfile_read+0xfd>
+  803145:	8b 43 10             	mov    0x10(%rbx),%eax
+  803148:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80314c:	0f 84 fb 00 00 00    	je     80324d <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803152:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803157:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80315b:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80315e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803162:	48 89 c7             	mov    %rax,%rdi
+  803165:	48 b8 51 44 80 00 00 	movabs $0x804451,%rax
+  80316c:	00 00 00 
+  80316f:	ff d0                	call   *%rax
+  803171:	84 c0                	test   %al,%al
+  803173:	75 27                	jne    80319c <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803175:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80317a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80317f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803183:	bf 00 00 00 00       	mov    $0x0,%edi
+  803188:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803194:	85 c0                	test   %eax,%eax
+  803196:	0f 88 dc 00 00 00    	js     803278 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80319c:	44 89 f8             	mov    %r15d,%eax
+  80319f:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8031a4:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8031a6:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8031ad:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8031ae:	8b 43 10             	mov    0x10(%rbx),%eax
+  8031b1:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8031b5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8031b8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8031bd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8031c1:	48 89 df             	mov    %rbx,%rdi
+  8031c4:	48 b8 dd 2d 80 00 00 	movabs $0x802ddd,%rax
+  8031cb:	00 00 00 
+  8031ce:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8031d0:	48 85 c0             	test   %rax,%rax
+  8031d3:	0f 88 f4 fe ff ff    	js     8030cd <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8031d9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8031dc:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8031df:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8031e2:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8031e6:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8031ea:	48 63 d1             	movslq %ecx,%rdx
+  8031ed:	48 01 d0             	add    %rdx,%rax
+  8031f0:	4d 63 ff             	movslq %r15d,%r15
+  8031f3:	4c 29 f8             	sub    %r15,%rax
+  8031f6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031fb:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8031ff:	48 85 c0             	test   %rax,%rax
+  803202:	0f 8e c5 fe ff ff    	jle    8030cd <devfile_read+0x78>
+    n = MIN(n, res);
+  803208:	4c 39 e8             	cmp    %r13,%rax
+  80320b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80320f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803212:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803216:	48 63 f6             	movslq %esi,%rsi
+  803219:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80321e:	48 01 c6             	add    %rax,%rsi
+  803221:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803225:	48 01 c6             	add    %rax,%rsi
+  803228:	4c 89 ea             	mov    %r13,%rdx
+  80322b:	4c 89 e7             	mov    %r12,%rdi
+  80322e:	48 b8 e6 11 80 00 00 	movabs $0x8011e6,%rax
+  803235:	00 00 00 
+  803238:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80323a:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80323e:	4c 89 e8             	mov    %r13,%rax
+  803241:	e9 87 fe ff ff       	jmp    8030cd <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803246:	48 98                	cltq
+  803248:	e9 80 fe ff ff       	jmp    8030cd <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80324d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803251:	41 39 d7             	cmp    %edx,%r15d
+  803254:	0f 8c f8 fe ff ff    	jl     803152 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80325a:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80325e:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803261:	41 39 cf             	cmp    %ecx,%r15d
+  803264:	0f 8d e8 fe ff ff    	jge    803152 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80326a:	4d 63 ff             	movslq %r15d,%r15
+  80326d:	4c 29 f8             	sub    %r15,%rax
+  803270:	48 63 d2             	movslq %edx,%rdx
+  803273:	48 01 d0             	add    %rdx,%rax
+  803276:	eb 87                	jmp    8031ff <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803278:	48 98                	cltq
+  80327a:	e9 4e fe ff ff       	jmp    8030cd <devfile_read+0x78>
+        return E_INVAL;
+  80327f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803284:	c3                   	ret
+
+0000000000803285 <fs_channel>:
+fs_channel(bool enable) {
+  803285:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803287:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80328e:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803290:	ba 00 00 00 00       	mov    $0x0,%edx
+  803295:	40 84 ff             	test   %dil,%dil
+  803298:	74 47                	je     8032e1 <fs_channel+0x5c>
+  80329a:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  8032a1:	00 00 00 
+  8032a4:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8032aa:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8032b1:	00 00 00 
+  8032b4:	3b 08                	cmp    (%rax),%ecx
+  8032b6:	74 29                	je     8032e1 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8032b8:	55                   	push   %rbp
+  8032b9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8032bc:	48 b8 05 22 80 00 00 	movabs $0x802205,%rax
+  8032c3:	00 00 00 
+  8032c6:	ff d0                	call   *%rax
+  8032c8:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8032ca:	85 c0                	test   %eax,%eax
+  8032cc:	78 04                	js     8032d2 <fs_channel+0x4d>
+}
+  8032ce:	89 d0                	mov    %edx,%eax
+  8032d0:	5d                   	pop    %rbp
+  8032d1:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8032d2:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8032d9:	00 00 00 
+  8032dc:	c6 00 00             	movb   $0x0,(%rax)
+  8032df:	eb ed                	jmp    8032ce <fs_channel+0x49>
+}
+  8032e1:	89 d0                	mov    %edx,%eax
+  8032e3:	c3                   	ret
+
+00000000008032e4 <open>:
+open(const char *path, int mode) {
+  8032e4:	55                   	push   %rbp
+  8032e5:	48 89 e5             	mov    %rsp,%rbp
+  8032e8:	41 55                	push   %r13
+  8032ea:	41 54                	push   %r12
+  8032ec:	53                   	push   %rbx
+  8032ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8032f1:	49 89 fc             	mov    %rdi,%r12
+  8032f4:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8032f7:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  8032fe:	00 00 00 
+  803301:	ff d0                	call   *%rax
+  803303:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803309:	0f 87 8f 00 00 00    	ja     80339e <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80330f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803313:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  80331a:	00 00 00 
+  80331d:	ff d0                	call   *%rax
+  80331f:	89 c3                	mov    %eax,%ebx
+  803321:	85 c0                	test   %eax,%eax
+  803323:	78 55                	js     80337a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803325:	4c 89 e6             	mov    %r12,%rsi
+  803328:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80332f:	00 00 00 
+  803332:	48 89 df             	mov    %rbx,%rdi
+  803335:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803341:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803348:	ba 00 00 00 00       	mov    $0x0,%edx
+  80334d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803351:	bf 01 00 00 00       	mov    $0x1,%edi
+  803356:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+  803362:	89 c3                	mov    %eax,%ebx
+  803364:	85 c0                	test   %eax,%eax
+  803366:	78 1f                	js     803387 <open+0xa3>
+    return fd2num(fd);
+  803368:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80336c:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  803373:	00 00 00 
+  803376:	ff d0                	call   *%rax
+  803378:	89 c3                	mov    %eax,%ebx
+}
+  80337a:	89 d8                	mov    %ebx,%eax
+  80337c:	48 83 c4 18          	add    $0x18,%rsp
+  803380:	5b                   	pop    %rbx
+  803381:	41 5c                	pop    %r12
+  803383:	41 5d                	pop    %r13
+  803385:	5d                   	pop    %rbp
+  803386:	c3                   	ret
+        fd_close(fd, 0);
+  803387:	be 00 00 00 00       	mov    $0x0,%esi
+  80338c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803390:	48 b8 da 1b 80 00 00 	movabs $0x801bda,%rax
+  803397:	00 00 00 
+  80339a:	ff d0                	call   *%rax
+        return res;
+  80339c:	eb dc                	jmp    80337a <open+0x96>
+        return -E_BAD_PATH;
+  80339e:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8033a3:	eb d5                	jmp    80337a <open+0x96>
+
+00000000008033a5 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8033a5:	55                   	push   %rbp
+  8033a6:	48 89 e5             	mov    %rsp,%rbp
+  8033a9:	41 56                	push   %r14
+  8033ab:	41 55                	push   %r13
+  8033ad:	41 54                	push   %r12
+  8033af:	53                   	push   %rbx
+  8033b0:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8033b4:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8033bb:	00 00 00 
+  8033be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033c3:	49 bd 1f 1b 80 00 00 	movabs $0x801b1f,%r13
+  8033ca:	00 00 00 
+  8033cd:	49 be df 2a 80 00 00 	movabs $0x802adf,%r14
+  8033d4:	00 00 00 
+  8033d7:	eb 0c                	jmp    8033e5 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8033d9:	83 c3 01             	add    $0x1,%ebx
+  8033dc:	49 83 c4 18          	add    $0x18,%r12
+  8033e0:	83 fb 20             	cmp    $0x20,%ebx
+  8033e3:	74 1d                	je     803402 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8033e5:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8033ea:	74 ed                	je     8033d9 <file_flush_buffers+0x34>
+  8033ec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8033f0:	89 df                	mov    %ebx,%edi
+  8033f2:	41 ff d5             	call   *%r13
+  8033f5:	85 c0                	test   %eax,%eax
+  8033f7:	78 e0                	js     8033d9 <file_flush_buffers+0x34>
+  8033f9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8033fd:	41 ff d6             	call   *%r14
+  803400:	eb d7                	jmp    8033d9 <file_flush_buffers+0x34>
+}
+  803402:	48 83 c4 10          	add    $0x10,%rsp
+  803406:	5b                   	pop    %rbx
+  803407:	41 5c                	pop    %r12
+  803409:	41 5d                	pop    %r13
+  80340b:	41 5e                	pop    %r14
+  80340d:	5d                   	pop    %rbp
+  80340e:	c3                   	ret
+
+000000000080340f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80340f:	55                   	push   %rbp
+  803410:	48 89 e5             	mov    %rsp,%rbp
+  803413:	41 54                	push   %r12
+  803415:	53                   	push   %rbx
+  803416:	49 89 fc             	mov    %rdi,%r12
+  803419:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80341b:	48 b8 a5 33 80 00 00 	movabs $0x8033a5,%rax
+  803422:	00 00 00 
+  803425:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803427:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80342e:	00 00 00 
+  803431:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803436:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803438:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80343b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803440:	be 00 00 00 00       	mov    $0x0,%esi
+  803445:	bf 02 00 00 00       	mov    $0x2,%edi
+  80344a:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  803451:	00 00 00 
+  803454:	ff d0                	call   *%rax
+}
+  803456:	5b                   	pop    %rbx
+  803457:	41 5c                	pop    %r12
+  803459:	5d                   	pop    %rbp
+  80345a:	c3                   	ret
+
+000000000080345b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80345b:	55                   	push   %rbp
+  80345c:	48 89 e5             	mov    %rsp,%rbp
+  80345f:	41 54                	push   %r12
+  803461:	53                   	push   %rbx
+  803462:	49 89 fc             	mov    %rdi,%r12
+  803465:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803468:	48 b8 a5 33 80 00 00 	movabs $0x8033a5,%rax
+  80346f:	00 00 00 
+  803472:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803474:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803479:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803480:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803482:	ba 00 00 00 00       	mov    $0x0,%edx
+  803487:	be 00 00 00 00       	mov    $0x0,%esi
+  80348c:	bf 05 00 00 00       	mov    $0x5,%edi
+  803491:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80349d:	85 c0                	test   %eax,%eax
+  80349f:	78 3d                	js     8034de <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8034a1:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8034a8:	00 00 00 
+  8034ab:	4c 89 e6             	mov    %r12,%rsi
+  8034ae:	48 89 df             	mov    %rbx,%rdi
+  8034b1:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  8034b8:	00 00 00 
+  8034bb:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8034bd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8034c4:	00 
+  8034c5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8034cb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8034d2:	00 
+  8034d3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8034d9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034de:	5b                   	pop    %rbx
+  8034df:	41 5c                	pop    %r12
+  8034e1:	5d                   	pop    %rbp
+  8034e2:	c3                   	ret
+
+00000000008034e3 <remove>:
+remove(const char *path) {
+  8034e3:	55                   	push   %rbp
+  8034e4:	48 89 e5             	mov    %rsp,%rbp
+  8034e7:	53                   	push   %rbx
+  8034e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8034ec:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8034ef:	48 b8 47 0f 80 00 00 	movabs $0x800f47,%rax
+  8034f6:	00 00 00 
+  8034f9:	ff d0                	call   *%rax
+  8034fb:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803501:	77 3a                	ja     80353d <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803503:	48 89 de             	mov    %rbx,%rsi
+  803506:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80350d:	00 00 00 
+  803510:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  803517:	00 00 00 
+  80351a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80351c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803521:	be 00 00 00 00       	mov    $0x0,%esi
+  803526:	bf 07 00 00 00       	mov    $0x7,%edi
+  80352b:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  803532:	00 00 00 
+  803535:	ff d0                	call   *%rax
+}
+  803537:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80353b:	c9                   	leave
+  80353c:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80353d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803542:	eb f3                	jmp    803537 <remove+0x54>
+
+0000000000803544 <sync>:
+sync(void) {
+  803544:	55                   	push   %rbp
+  803545:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803548:	48 b8 a5 33 80 00 00 	movabs $0x8033a5,%rax
+  80354f:	00 00 00 
+  803552:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803554:	ba 00 00 00 00       	mov    $0x0,%edx
+  803559:	be 00 00 00 00       	mov    $0x0,%esi
+  80355e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803563:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+}
+  80356f:	5d                   	pop    %rbp
+  803570:	c3                   	ret
+
+0000000000803571 <fsync>:
+fsync(int fdnum) {
+  803571:	55                   	push   %rbp
+  803572:	48 89 e5             	mov    %rsp,%rbp
+  803575:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803579:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80357d:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  803584:	00 00 00 
+  803587:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803589:	85 c0                	test   %eax,%eax
+  80358b:	78 4b                	js     8035d8 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80358d:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803591:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803598:	00 00 00 
+  80359b:	8b 00                	mov    (%rax),%eax
+  80359d:	39 02                	cmp    %eax,(%rdx)
+  80359f:	75 39                	jne    8035da <fsync+0x69>
+    file_flush_buffers();
+  8035a1:	48 b8 a5 33 80 00 00 	movabs $0x8033a5,%rax
+  8035a8:	00 00 00 
+  8035ab:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8035ad:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8035b1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8035b4:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8035bb:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8035bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035c2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035c7:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8035cc:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  8035d3:	00 00 00 
+  8035d6:	ff d0                	call   *%rax
+}
+  8035d8:	c9                   	leave
+  8035d9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8035da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035df:	eb f7                	jmp    8035d8 <fsync+0x67>
+
+00000000008035e1 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8035e1:	55                   	push   %rbp
+  8035e2:	48 89 e5             	mov    %rsp,%rbp
+  8035e5:	53                   	push   %rbx
+  8035e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8035ea:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8035ed:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035f2:	be 00 00 00 00       	mov    $0x0,%esi
+  8035f7:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8035fc:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  803603:	00 00 00 
+  803606:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803608:	85 c0                	test   %eax,%eax
+  80360a:	78 2d                	js     803639 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80360c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803613:	00 00 00 
+  803616:	48 8b 10             	mov    (%rax),%rdx
+  803619:	48 89 13             	mov    %rdx,(%rbx)
+  80361c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803620:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803624:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803628:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80362c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803630:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803634:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803639:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80363d:	c9                   	leave
+  80363e:	c3                   	ret
+
+000000000080363f <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80363f:	55                   	push   %rbp
+  803640:	48 89 e5             	mov    %rsp,%rbp
+  803643:	53                   	push   %rbx
+  803644:	48 83 ec 08          	sub    $0x8,%rsp
+  803648:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80364b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803650:	be 00 00 00 00       	mov    $0x0,%esi
+  803655:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80365a:	48 b8 76 28 80 00 00 	movabs $0x802876,%rax
+  803661:	00 00 00 
+  803664:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803666:	85 c0                	test   %eax,%eax
+  803668:	78 3d                	js     8036a7 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80366a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803671:	00 00 00 
+  803674:	48 8b 10             	mov    (%rax),%rdx
+  803677:	48 89 13             	mov    %rdx,(%rbx)
+  80367a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80367e:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803682:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803686:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80368a:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80368e:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803692:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803696:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80369a:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80369e:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8036a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8036a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8036ab:	c9                   	leave
+  8036ac:	c3                   	ret
+
+00000000008036ad <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8036ad:	55                   	push   %rbp
+  8036ae:	48 89 e5             	mov    %rsp,%rbp
+  8036b1:	41 57                	push   %r15
+  8036b3:	41 56                	push   %r14
+  8036b5:	41 55                	push   %r13
+  8036b7:	41 54                	push   %r12
+  8036b9:	53                   	push   %rbx
+  8036ba:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8036be:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8036c5:	00 
+  8036c6:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036cd:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036d3:	0f 85 43 01 00 00    	jne    80381c <munmap+0x16f>
+  8036d9:	49 89 ff             	mov    %rdi,%r15
+  8036dc:	4c 39 f7             	cmp    %r14,%rdi
+  8036df:	0f 87 37 01 00 00    	ja     80381c <munmap+0x16f>
+  8036e5:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8036ec:	00 00 00 
+  8036ef:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8036f5:	eb 2c                	jmp    803723 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8036f7:	4c 39 f8             	cmp    %r15,%rax
+  8036fa:	0f 83 85 00 00 00    	jae    803785 <munmap+0xd8>
+            m->mm_end = start;
+  803700:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803705:	48 83 c3 18          	add    $0x18,%rbx
+  803709:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803710:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803717:	00 00 00 
+  80371a:	48 39 c3             	cmp    %rax,%rbx
+  80371d:	0f 84 d0 00 00 00    	je     8037f3 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803723:	49 89 dc             	mov    %rbx,%r12
+  803726:	48 8b 03             	mov    (%rbx),%rax
+  803729:	4c 39 f0             	cmp    %r14,%rax
+  80372c:	73 d7                	jae    803705 <munmap+0x58>
+  80372e:	48 85 c0             	test   %rax,%rax
+  803731:	74 d2                	je     803705 <munmap+0x58>
+  803733:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803737:	49 39 d7             	cmp    %rdx,%r15
+  80373a:	73 c9                	jae    803705 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80373c:	49 39 d6             	cmp    %rdx,%r14
+  80373f:	73 b6                	jae    8036f7 <munmap+0x4a>
+  803741:	49 39 c7             	cmp    %rax,%r15
+  803744:	76 b1                	jbe    8036f7 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803746:	4c 89 ef             	mov    %r13,%rdi
+  803749:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  803750:	00 00 00 
+  803753:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803755:	48 85 c0             	test   %rax,%rax
+  803758:	0f 84 c5 00 00 00    	je     803823 <munmap+0x176>
+            *tail = *m;
+  80375e:	48 8b 13             	mov    (%rbx),%rdx
+  803761:	48 89 10             	mov    %rdx,(%rax)
+  803764:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803768:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80376c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803770:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803774:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803777:	44 89 f2             	mov    %r14d,%edx
+  80377a:	2b 13                	sub    (%rbx),%edx
+  80377c:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80377f:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803783:	eb 80                	jmp    803705 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803785:	49 39 d6             	cmp    %rdx,%r14
+  803788:	73 18                	jae    8037a2 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80378a:	44 89 f2             	mov    %r14d,%edx
+  80378d:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803792:	29 c2                	sub    %eax,%edx
+  803794:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803799:	4d 89 34 24          	mov    %r14,(%r12)
+  80379d:	e9 63 ff ff ff       	jmp    803705 <munmap+0x58>
+    m->mm_start = 0;
+  8037a2:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8037a9:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8037aa:	4c 89 e6             	mov    %r12,%rsi
+  8037ad:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8037b4:	00 00 00 
+  8037b7:	48 29 c6             	sub    %rax,%rsi
+  8037ba:	48 c1 fe 03          	sar    $0x3,%rsi
+  8037be:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8037c5:	aa aa aa 
+  8037c8:	48 0f af f0          	imul   %rax,%rsi
+  8037cc:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8037d0:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8037d5:	48 01 c6             	add    %rax,%rsi
+  8037d8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8037dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8037e2:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+}
+  8037ee:	e9 12 ff ff ff       	jmp    803705 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8037f3:	4c 89 f2             	mov    %r14,%rdx
+  8037f6:	4c 29 fa             	sub    %r15,%rdx
+  8037f9:	4c 89 fe             	mov    %r15,%rsi
+  8037fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803801:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  803808:	00 00 00 
+  80380b:	ff d0                	call   *%rax
+}
+  80380d:	48 83 c4 08          	add    $0x8,%rsp
+  803811:	5b                   	pop    %rbx
+  803812:	41 5c                	pop    %r12
+  803814:	41 5d                	pop    %r13
+  803816:	41 5e                	pop    %r14
+  803818:	41 5f                	pop    %r15
+  80381a:	5d                   	pop    %rbp
+  80381b:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80381c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803821:	eb ea                	jmp    80380d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803823:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803828:	eb e3                	jmp    80380d <munmap+0x160>
+
+000000000080382a <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80382a:	55                   	push   %rbp
+  80382b:	48 89 e5             	mov    %rsp,%rbp
+  80382e:	41 57                	push   %r15
+  803830:	41 56                	push   %r14
+  803832:	41 55                	push   %r13
+  803834:	41 54                	push   %r12
+  803836:	53                   	push   %rbx
+  803837:	48 83 ec 28          	sub    $0x28,%rsp
+  80383b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80383f:	49 89 f5             	mov    %rsi,%r13
+  803842:	41 89 d6             	mov    %edx,%r14d
+  803845:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803848:	41 89 cc             	mov    %ecx,%r12d
+  80384b:	44 89 c7             	mov    %r8d,%edi
+  80384e:	44 89 cb             	mov    %r9d,%ebx
+  803851:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803855:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803859:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  803860:	00 00 00 
+  803863:	ff d0                	call   *%rax
+  803865:	41 89 c7             	mov    %eax,%r15d
+  803868:	85 c0                	test   %eax,%eax
+  80386a:	0f 88 ae 01 00 00    	js     803a1e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803870:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803874:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80387b:	00 00 00 
+  80387e:	8b 32                	mov    (%rdx),%esi
+  803880:	39 30                	cmp    %esi,(%rax)
+  803882:	0f 85 7a 02 00 00    	jne    803b02 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803888:	8b 40 08             	mov    0x8(%rax),%eax
+  80388b:	83 e0 03             	and    $0x3,%eax
+  80388e:	83 f8 01             	cmp    $0x1,%eax
+  803891:	0f 84 76 02 00 00    	je     803b0d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803897:	4d 85 ed             	test   %r13,%r13
+  80389a:	0f 84 78 02 00 00    	je     803b18 <mmap+0x2ee>
+  8038a0:	85 db                	test   %ebx,%ebx
+  8038a2:	0f 88 70 02 00 00    	js     803b18 <mmap+0x2ee>
+  8038a8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8038ae:	41 89 df             	mov    %ebx,%r15d
+  8038b1:	0f 85 6c 02 00 00    	jne    803b23 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8038b7:	44 89 f0             	mov    %r14d,%eax
+  8038ba:	83 e0 fd             	and    $0xfffffffd,%eax
+  8038bd:	83 f8 04             	cmp    $0x4,%eax
+  8038c0:	0f 85 68 02 00 00    	jne    803b2e <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8038c6:	44 89 e1             	mov    %r12d,%ecx
+  8038c9:	83 e1 01             	and    $0x1,%ecx
+  8038cc:	0f 95 c2             	setne  %dl
+  8038cf:	44 89 e0             	mov    %r12d,%eax
+  8038d2:	d1 e8                	shr    %eax
+  8038d4:	83 f0 01             	xor    $0x1,%eax
+  8038d7:	83 e0 01             	and    $0x1,%eax
+  8038da:	38 c2                	cmp    %al,%dl
+  8038dc:	0f 85 57 02 00 00    	jne    803b39 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8038e2:	85 c9                	test   %ecx,%ecx
+  8038e4:	74 0a                	je     8038f0 <mmap+0xc6>
+  8038e6:	41 f6 c6 02          	test   $0x2,%r14b
+  8038ea:	0f 85 54 02 00 00    	jne    803b44 <mmap+0x31a>
+    file_flush_buffers();
+  8038f0:	48 b8 a5 33 80 00 00 	movabs $0x8033a5,%rax
+  8038f7:	00 00 00 
+  8038fa:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8038fc:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803903:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80390a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80390e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803911:	41 f6 c4 04          	test   $0x4,%r12b
+  803915:	0f 84 15 01 00 00    	je     803a30 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80391b:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80391e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803924:	0f 85 25 02 00 00    	jne    803b4f <mmap+0x325>
+  80392a:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80392e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803935:	00 00 00 
+  803938:	48 39 c2             	cmp    %rax,%rdx
+  80393b:	0f 82 19 02 00 00    	jb     803b5a <mmap+0x330>
+  803941:	48 39 c7             	cmp    %rax,%rdi
+  803944:	0f 87 10 02 00 00    	ja     803b5a <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80394a:	4c 89 ee             	mov    %r13,%rsi
+  80394d:	48 b8 ad 36 80 00 00 	movabs $0x8036ad,%rax
+  803954:	00 00 00 
+  803957:	ff d0                	call   *%rax
+  803959:	85 c0                	test   %eax,%eax
+  80395b:	0f 88 04 02 00 00    	js     803b65 <mmap+0x33b>
+    if (!handler) {
+  803961:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803968:	00 00 00 
+  80396b:	80 38 00             	cmpb   $0x0,(%rax)
+  80396e:	75 2b                	jne    80399b <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803970:	48 bf 45 27 80 00 00 	movabs $0x802745,%rdi
+  803977:	00 00 00 
+  80397a:	48 b8 aa 49 80 00 00 	movabs $0x8049aa,%rax
+  803981:	00 00 00 
+  803984:	ff d0                	call   *%rax
+  803986:	85 c0                	test   %eax,%eax
+  803988:	0f 88 ea 01 00 00    	js     803b78 <mmap+0x34e>
+        handler = 1;
+  80398e:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803995:	00 00 00 
+  803998:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80399b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80399f:	48 b8 e4 27 80 00 00 	movabs $0x8027e4,%rax
+  8039a6:	00 00 00 
+  8039a9:	ff d0                	call   *%rax
+  8039ab:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8039ae:	48 85 c0             	test   %rax,%rax
+  8039b1:	0f 84 c9 01 00 00    	je     803b80 <mmap+0x356>
+    m->mm_start = va;
+  8039b7:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8039ba:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8039be:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8039c2:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8039c5:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8039c9:	44 89 e0             	mov    %r12d,%eax
+  8039cc:	c1 e0 06             	shl    $0x6,%eax
+  8039cf:	25 80 00 00 00       	and    $0x80,%eax
+  8039d4:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8039d7:	09 f0                	or     %esi,%eax
+  8039d9:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8039dd:	41 f6 c4 08          	test   $0x8,%r12b
+  8039e1:	74 31                	je     803a14 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8039e3:	48 39 d3             	cmp    %rdx,%rbx
+  8039e6:	73 2c                	jae    803a14 <mmap+0x1ea>
+  8039e8:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8039ed:	48 89 de             	mov    %rbx,%rsi
+  8039f0:	4c 89 f7             	mov    %r14,%rdi
+  8039f3:	48 b8 34 26 80 00 00 	movabs $0x802634,%rax
+  8039fa:	00 00 00 
+  8039fd:	ff d0                	call   *%rax
+  8039ff:	49 89 c4             	mov    %rax,%r12
+  803a02:	48 85 c0             	test   %rax,%rax
+  803a05:	0f 8e d7 00 00 00    	jle    803ae2 <mmap+0x2b8>
+            va += n;
+  803a0b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803a0e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803a12:	72 d4                	jb     8039e8 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803a14:	49 8b 06             	mov    (%r14),%rax
+  803a17:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803a1b:	48 89 06             	mov    %rax,(%rsi)
+}
+  803a1e:	44 89 f8             	mov    %r15d,%eax
+  803a21:	48 83 c4 28          	add    $0x28,%rsp
+  803a25:	5b                   	pop    %rbx
+  803a26:	41 5c                	pop    %r12
+  803a28:	41 5d                	pop    %r13
+  803a2a:	41 5e                	pop    %r14
+  803a2c:	41 5f                	pop    %r15
+  803a2e:	5d                   	pop    %rbp
+  803a2f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a30:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803a37:	00 00 00 
+  803a3a:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803a3d:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803a44:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a47:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a4c:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803a53:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a56:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803a5d:	00 00 00 
+  803a60:	48 39 d7             	cmp    %rdx,%rdi
+  803a63:	73 1c                	jae    803a81 <mmap+0x257>
+        return -E_NO_MEM;
+  803a65:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a6b:	eb b1                	jmp    803a1e <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803a6d:	48 83 c0 01          	add    $0x1,%rax
+  803a71:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803a75:	77 3f                	ja     803ab6 <mmap+0x28c>
+  803a77:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803a7c:	48 39 d7             	cmp    %rdx,%rdi
+  803a7f:	72 2a                	jb     803aab <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803a81:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803a85:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803a89:	48 39 d1             	cmp    %rdx,%rcx
+  803a8c:	73 df                	jae    803a6d <mmap+0x243>
+  803a8e:	48 85 c9             	test   %rcx,%rcx
+  803a91:	74 da                	je     803a6d <mmap+0x243>
+  803a93:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803a97:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803a9c:	48 39 d3             	cmp    %rdx,%rbx
+  803a9f:	73 cc                	jae    803a6d <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803aa1:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803aa4:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aa9:	eb cc                	jmp    803a77 <mmap+0x24d>
+        return -E_NO_MEM;
+  803aab:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803ab1:	e9 68 ff ff ff       	jmp    803a1e <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803ab6:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803abb:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803ac2:	00 00 00 
+  803ac5:	48 39 c2             	cmp    %rax,%rdx
+  803ac8:	0f 82 9f 00 00 00    	jb     803b6d <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803ace:	48 85 db             	test   %rbx,%rbx
+  803ad1:	0f 85 8a fe ff ff    	jne    803961 <mmap+0x137>
+        return -E_NO_MEM;
+  803ad7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803add:	e9 3c ff ff ff       	jmp    803a1e <mmap+0x1f4>
+        if (n < 0) {
+  803ae2:	0f 89 2c ff ff ff    	jns    803a14 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803ae8:	49 8b 3e             	mov    (%r14),%rdi
+  803aeb:	4c 89 ee             	mov    %r13,%rsi
+  803aee:	48 b8 ad 36 80 00 00 	movabs $0x8036ad,%rax
+  803af5:	00 00 00 
+  803af8:	ff d0                	call   *%rax
+            return n;
+  803afa:	45 89 e7             	mov    %r12d,%r15d
+  803afd:	e9 1c ff ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803b02:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b08:	e9 11 ff ff ff       	jmp    803a1e <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803b0d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b13:	e9 06 ff ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803b18:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b1e:	e9 fb fe ff ff       	jmp    803a1e <mmap+0x1f4>
+  803b23:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b29:	e9 f0 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803b2e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b34:	e9 e5 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803b39:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b3f:	e9 da fe ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803b44:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803b4a:	e9 cf fe ff ff       	jmp    803a1e <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803b4f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b55:	e9 c4 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+  803b5a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803b60:	e9 b9 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803b65:	41 89 c7             	mov    %eax,%r15d
+  803b68:	e9 b1 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+        return -E_NO_MEM;
+  803b6d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b73:	e9 a6 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803b78:	41 89 c7             	mov    %eax,%r15d
+  803b7b:	e9 9e fe ff ff       	jmp    803a1e <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803b80:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b86:	e9 93 fe ff ff       	jmp    803a1e <mmap+0x1f4>
+
+0000000000803b8b <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803b8b:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803b8f:	7f 01                	jg     803b92 <writebuf+0x7>
+  803b91:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803b92:	55                   	push   %rbp
+  803b93:	48 89 e5             	mov    %rsp,%rbp
+  803b96:	53                   	push   %rbx
+  803b97:	48 83 ec 08          	sub    $0x8,%rsp
+  803b9b:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803b9e:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803ba2:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803ba6:	8b 3f                	mov    (%rdi),%edi
+  803ba8:	48 b8 31 1f 80 00 00 	movabs $0x801f31,%rax
+  803baf:	00 00 00 
+  803bb2:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803bb4:	48 85 c0             	test   %rax,%rax
+  803bb7:	7e 04                	jle    803bbd <writebuf+0x32>
+  803bb9:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803bbd:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803bc1:	48 39 c2             	cmp    %rax,%rdx
+  803bc4:	74 0f                	je     803bd5 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803bc6:	48 85 c0             	test   %rax,%rax
+  803bc9:	ba 00 00 00 00       	mov    $0x0,%edx
+  803bce:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803bd2:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803bd5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803bd9:	c9                   	leave
+  803bda:	c3                   	ret
+
+0000000000803bdb <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803bdb:	8b 46 04             	mov    0x4(%rsi),%eax
+  803bde:	8d 50 01             	lea    0x1(%rax),%edx
+  803be1:	89 56 04             	mov    %edx,0x4(%rsi)
+  803be4:	48 98                	cltq
+  803be6:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803beb:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803bf1:	74 01                	je     803bf4 <putch+0x19>
+  803bf3:	c3                   	ret
+putch(int ch, void *arg) {
+  803bf4:	55                   	push   %rbp
+  803bf5:	48 89 e5             	mov    %rsp,%rbp
+  803bf8:	53                   	push   %rbx
+  803bf9:	48 83 ec 08          	sub    $0x8,%rsp
+  803bfd:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803c00:	48 89 f7             	mov    %rsi,%rdi
+  803c03:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803c0a:	00 00 00 
+  803c0d:	ff d0                	call   *%rax
+        state->offset = 0;
+  803c0f:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  803c16:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803c1a:	c9                   	leave
+  803c1b:	c3                   	ret
+
+0000000000803c1c <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  803c1c:	55                   	push   %rbp
+  803c1d:	48 89 e5             	mov    %rsp,%rbp
+  803c20:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  803c27:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  803c2a:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  803c30:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  803c37:	00 00 00 
+    state.result = 0;
+  803c3a:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  803c41:	00 00 00 00 
+    state.error = 1;
+  803c45:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  803c4c:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  803c4f:	48 89 f2             	mov    %rsi,%rdx
+  803c52:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  803c59:	48 bf db 3b 80 00 00 	movabs $0x803bdb,%rdi
+  803c60:	00 00 00 
+  803c63:	48 b8 b0 07 80 00 00 	movabs $0x8007b0,%rax
+  803c6a:	00 00 00 
+  803c6d:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803c6f:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803c76:	7f 14                	jg     803c8c <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803c78:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803c7f:	48 85 c0             	test   %rax,%rax
+  803c82:	75 06                	jne    803c8a <vfprintf+0x6e>
+  803c84:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803c8a:	c9                   	leave
+  803c8b:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803c8c:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803c93:	48 b8 8b 3b 80 00 00 	movabs $0x803b8b,%rax
+  803c9a:	00 00 00 
+  803c9d:	ff d0                	call   *%rax
+  803c9f:	eb d7                	jmp    803c78 <vfprintf+0x5c>
+
+0000000000803ca1 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803ca1:	55                   	push   %rbp
+  803ca2:	48 89 e5             	mov    %rsp,%rbp
+  803ca5:	48 83 ec 50          	sub    $0x50,%rsp
+  803ca9:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cad:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cb1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cb5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cb9:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803cc0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803cc4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803cc8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803ccc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803cd0:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803cd4:	48 b8 1c 3c 80 00 00 	movabs $0x803c1c,%rax
+  803cdb:	00 00 00 
+  803cde:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803ce0:	c9                   	leave
+  803ce1:	c3                   	ret
+
+0000000000803ce2 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803ce2:	55                   	push   %rbp
+  803ce3:	48 89 e5             	mov    %rsp,%rbp
+  803ce6:	48 83 ec 50          	sub    $0x50,%rsp
+  803cea:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803cee:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803cf2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803cf6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803cfa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803cfe:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803d05:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803d09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d0d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803d11:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  803d15:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803d19:	48 89 fe             	mov    %rdi,%rsi
+  803d1c:	bf 01 00 00 00       	mov    $0x1,%edi
+  803d21:	48 b8 1c 3c 80 00 00 	movabs $0x803c1c,%rax
+  803d28:	00 00 00 
+  803d2b:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803d2d:	c9                   	leave
+  803d2e:	c3                   	ret
+
+0000000000803d2f <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803d2f:	55                   	push   %rbp
+  803d30:	48 89 e5             	mov    %rsp,%rbp
+  803d33:	41 54                	push   %r12
+  803d35:	53                   	push   %rbx
+  803d36:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d39:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  803d40:	00 00 00 
+  803d43:	ff d0                	call   *%rax
+  803d45:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803d48:	48 be c0 54 80 00 00 	movabs $0x8054c0,%rsi
+  803d4f:	00 00 00 
+  803d52:	48 89 df             	mov    %rbx,%rdi
+  803d55:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  803d5c:	00 00 00 
+  803d5f:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803d61:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803d66:	41 2b 04 24          	sub    (%r12),%eax
+  803d6a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803d70:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803d77:	00 00 00 
+    stat->st_dev = &devpipe;
+  803d7a:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803d81:	00 00 00 
+  803d84:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803d8b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d90:	5b                   	pop    %rbx
+  803d91:	41 5c                	pop    %r12
+  803d93:	5d                   	pop    %rbp
+  803d94:	c3                   	ret
+
+0000000000803d95 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803d95:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d98:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803d9e:	8b 17                	mov    (%rdi),%edx
+  803da0:	85 d2                	test   %edx,%edx
+  803da2:	75 01                	jne    803da5 <pipe_wakeup+0x10>
+  803da4:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803da5:	55                   	push   %rbp
+  803da6:	48 89 e5             	mov    %rsp,%rbp
+  803da9:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803dac:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803db2:	be 00 04 00 00       	mov    $0x400,%esi
+  803db7:	48 b8 70 18 80 00 00 	movabs $0x801870,%rax
+  803dbe:	00 00 00 
+  803dc1:	ff d0                	call   *%rax
+}
+  803dc3:	5d                   	pop    %rbp
+  803dc4:	c3                   	ret
+
+0000000000803dc5 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803dc5:	55                   	push   %rbp
+  803dc6:	48 89 e5             	mov    %rsp,%rbp
+  803dc9:	41 55                	push   %r13
+  803dcb:	41 54                	push   %r12
+  803dcd:	53                   	push   %rbx
+  803dce:	48 83 ec 08          	sub    $0x8,%rsp
+  803dd2:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803dd5:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  803ddc:	00 00 00 
+  803ddf:	ff d0                	call   *%rax
+  803de1:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803de4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de9:	4c 89 e6             	mov    %r12,%rsi
+  803dec:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df1:	49 bc 8a 15 80 00 00 	movabs $0x80158a,%r12
+  803df8:	00 00 00 
+  803dfb:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803dfe:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803e02:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803e06:	49 bd 95 3d 80 00 00 	movabs $0x803d95,%r13
+  803e0d:	00 00 00 
+  803e10:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e13:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e17:	48 89 de             	mov    %rbx,%rsi
+  803e1a:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803e1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e22:	48 89 de             	mov    %rbx,%rsi
+  803e25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e2a:	41 ff d4             	call   *%r12
+  803e2d:	48 83 c4 08          	add    $0x8,%rsp
+  803e31:	5b                   	pop    %rbx
+  803e32:	41 5c                	pop    %r12
+  803e34:	41 5d                	pop    %r13
+  803e36:	5d                   	pop    %rbp
+  803e37:	c3                   	ret
+
+0000000000803e38 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803e38:	55                   	push   %rbp
+  803e39:	48 89 e5             	mov    %rsp,%rbp
+  803e3c:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803e3f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803e44:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e49:	48 b8 cd 14 80 00 00 	movabs $0x8014cd,%rax
+  803e50:	00 00 00 
+  803e53:	ff d0                	call   *%rax
+  803e55:	85 c0                	test   %eax,%eax
+  803e57:	0f 94 c0             	sete   %al
+  803e5a:	0f b6 c0             	movzbl %al,%eax
+}
+  803e5d:	5d                   	pop    %rbp
+  803e5e:	c3                   	ret
+
+0000000000803e5f <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803e5f:	55                   	push   %rbp
+  803e60:	48 89 e5             	mov    %rsp,%rbp
+  803e63:	41 57                	push   %r15
+  803e65:	41 56                	push   %r14
+  803e67:	41 55                	push   %r13
+  803e69:	41 54                	push   %r12
+  803e6b:	53                   	push   %rbx
+  803e6c:	48 83 ec 38          	sub    $0x38,%rsp
+  803e70:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803e74:	49 89 f4             	mov    %rsi,%r12
+  803e77:	49 89 d7             	mov    %rdx,%r15
+  803e7a:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803e7e:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  803e85:	00 00 00 
+  803e88:	ff d0                	call   *%rax
+  803e8a:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803e8d:	4d 85 ff             	test   %r15,%r15
+  803e90:	0f 84 f1 00 00 00    	je     803f87 <devpipe_write+0x128>
+  803e96:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803e9a:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803e9e:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803ea2:	49 bd 38 3e 80 00 00 	movabs $0x803e38,%r13
+  803ea9:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803eac:	49 bf 95 3d 80 00 00 	movabs $0x803d95,%r15
+  803eb3:	00 00 00 
+  803eb6:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803eba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ebe:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ec2:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ec5:	48 63 ce             	movslq %esi,%rcx
+  803ec8:	48 63 03             	movslq (%rbx),%rax
+  803ecb:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803ed1:	48 39 c1             	cmp    %rax,%rcx
+  803ed4:	72 64                	jb     803f3a <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ed6:	48 89 de             	mov    %rbx,%rsi
+  803ed9:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803edd:	41 ff d5             	call   *%r13
+  803ee0:	85 c0                	test   %eax,%eax
+  803ee2:	0f 85 b9 00 00 00    	jne    803fa1 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ee8:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803eec:	4c 89 f7             	mov    %r14,%rdi
+  803eef:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803ef2:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ef5:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803efc:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803f03:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803f09:	8b 03                	mov    (%rbx),%eax
+  803f0b:	41 39 c4             	cmp    %eax,%r12d
+  803f0e:	75 b2                	jne    803ec2 <devpipe_write+0x63>
+  803f10:	48 89 de             	mov    %rbx,%rsi
+  803f13:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803f17:	41 ff d5             	call   *%r13
+  803f1a:	85 c0                	test   %eax,%eax
+  803f1c:	75 a0                	jne    803ebe <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803f1e:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803f23:	44 89 e6             	mov    %r12d,%esi
+  803f26:	48 89 df             	mov    %rbx,%rdi
+  803f29:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+  803f35:	e9 7c ff ff ff       	jmp    803eb6 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803f3a:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803f3e:	41 0f b6 38          	movzbl (%r8),%edi
+  803f42:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803f49:	80 80 80 
+  803f4c:	48 89 c8             	mov    %rcx,%rax
+  803f4f:	48 f7 e2             	mul    %rdx
+  803f52:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803f56:	48 89 d0             	mov    %rdx,%rax
+  803f59:	48 c1 e0 08          	shl    $0x8,%rax
+  803f5d:	48 29 d0             	sub    %rdx,%rax
+  803f60:	48 c1 e0 04          	shl    $0x4,%rax
+  803f64:	48 29 c1             	sub    %rax,%rcx
+  803f67:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803f6c:	83 c6 01             	add    $0x1,%esi
+  803f6f:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803f72:	49 83 c0 01          	add    $0x1,%r8
+  803f76:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803f7a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803f7e:	49 39 c0             	cmp    %rax,%r8
+  803f81:	0f 85 2f ff ff ff    	jne    803eb6 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803f87:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803f8b:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803f8f:	48 b8 95 3d 80 00 00 	movabs $0x803d95,%rax
+  803f96:	00 00 00 
+  803f99:	ff d0                	call   *%rax
+    return n;
+  803f9b:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803f9f:	eb 05                	jmp    803fa6 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803fa1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803fa6:	48 83 c4 38          	add    $0x38,%rsp
+  803faa:	5b                   	pop    %rbx
+  803fab:	41 5c                	pop    %r12
+  803fad:	41 5d                	pop    %r13
+  803faf:	41 5e                	pop    %r14
+  803fb1:	41 5f                	pop    %r15
+  803fb3:	5d                   	pop    %rbp
+  803fb4:	c3                   	ret
+
+0000000000803fb5 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803fb5:	55                   	push   %rbp
+  803fb6:	48 89 e5             	mov    %rsp,%rbp
+  803fb9:	41 57                	push   %r15
+  803fbb:	41 56                	push   %r14
+  803fbd:	41 55                	push   %r13
+  803fbf:	41 54                	push   %r12
+  803fc1:	53                   	push   %rbx
+  803fc2:	48 83 ec 28          	sub    $0x28,%rsp
+  803fc6:	49 89 fd             	mov    %rdi,%r13
+  803fc9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803fcd:	49 89 d4             	mov    %rdx,%r12
+  803fd0:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803fd4:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  803fdb:	00 00 00 
+  803fde:	ff d0                	call   *%rax
+  803fe0:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803fe3:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803fe9:	49 bf 38 3e 80 00 00 	movabs $0x803e38,%r15
+  803ff0:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ff3:	4d 85 e4             	test   %r12,%r12
+  803ff6:	0f 84 d5 00 00 00    	je     8040d1 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ffc:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  804000:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804004:	8b 03                	mov    (%rbx),%eax
+  804006:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804009:	75 7a                	jne    804085 <devpipe_read+0xd0>
+            if (i > 0) {
+  80400b:	4d 85 f6             	test   %r14,%r14
+  80400e:	75 50                	jne    804060 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  804010:	48 89 de             	mov    %rbx,%rsi
+  804013:	4c 89 ef             	mov    %r13,%rdi
+  804016:	41 ff d7             	call   *%r15
+  804019:	85 c0                	test   %eax,%eax
+  80401b:	0f 85 c9 00 00 00    	jne    8040ea <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804021:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804024:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80402b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804031:	8b 43 04             	mov    0x4(%rbx),%eax
+  804034:	41 39 c4             	cmp    %eax,%r12d
+  804037:	75 cb                	jne    804004 <devpipe_read+0x4f>
+  804039:	48 89 de             	mov    %rbx,%rsi
+  80403c:	4c 89 ef             	mov    %r13,%rdi
+  80403f:	41 ff d7             	call   *%r15
+  804042:	85 c0                	test   %eax,%eax
+  804044:	75 be                	jne    804004 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804046:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80404b:	44 89 e6             	mov    %r12d,%esi
+  80404e:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804052:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  804059:	00 00 00 
+  80405c:	ff d0                	call   *%rax
+  80405e:	eb a4                	jmp    804004 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804060:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804064:	48 89 de             	mov    %rbx,%rsi
+  804067:	48 b8 95 3d 80 00 00 	movabs $0x803d95,%rax
+  80406e:	00 00 00 
+  804071:	ff d0                	call   *%rax
+                return i;
+  804073:	4c 89 f0             	mov    %r14,%rax
+}
+  804076:	48 83 c4 28          	add    $0x28,%rsp
+  80407a:	5b                   	pop    %rbx
+  80407b:	41 5c                	pop    %r12
+  80407d:	41 5d                	pop    %r13
+  80407f:	41 5e                	pop    %r14
+  804081:	41 5f                	pop    %r15
+  804083:	5d                   	pop    %rbp
+  804084:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  804085:	48 63 c8             	movslq %eax,%rcx
+  804088:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  80408f:	80 80 80 
+  804092:	48 89 c8             	mov    %rcx,%rax
+  804095:	48 f7 e2             	mul    %rdx
+  804098:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80409c:	48 89 d0             	mov    %rdx,%rax
+  80409f:	48 c1 e0 08          	shl    $0x8,%rax
+  8040a3:	48 29 d0             	sub    %rdx,%rax
+  8040a6:	48 c1 e0 04          	shl    $0x4,%rax
+  8040aa:	48 89 c2             	mov    %rax,%rdx
+  8040ad:	48 89 c8             	mov    %rcx,%rax
+  8040b0:	48 29 d0             	sub    %rdx,%rax
+  8040b3:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8040b8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8040bc:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8040c0:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8040c3:	49 83 c6 01          	add    $0x1,%r14
+  8040c7:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8040cb:	0f 85 2b ff ff ff    	jne    803ffc <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8040d1:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8040d5:	48 89 de             	mov    %rbx,%rsi
+  8040d8:	48 b8 95 3d 80 00 00 	movabs $0x803d95,%rax
+  8040df:	00 00 00 
+  8040e2:	ff d0                	call   *%rax
+    return n;
+  8040e4:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8040e8:	eb 8c                	jmp    804076 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8040ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040ef:	eb 85                	jmp    804076 <devpipe_read+0xc1>
+
+00000000008040f1 <pipe>:
+pipe(int pfd[2]) {
+  8040f1:	55                   	push   %rbp
+  8040f2:	48 89 e5             	mov    %rsp,%rbp
+  8040f5:	41 55                	push   %r13
+  8040f7:	41 54                	push   %r12
+  8040f9:	53                   	push   %rbx
+  8040fa:	48 83 ec 18          	sub    $0x18,%rsp
+  8040fe:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804101:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804105:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  80410c:	00 00 00 
+  80410f:	ff d0                	call   *%rax
+  804111:	89 c3                	mov    %eax,%ebx
+  804113:	85 c0                	test   %eax,%eax
+  804115:	0f 88 a0 01 00 00    	js     8042bb <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80411b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804120:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804125:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804129:	bf 00 00 00 00       	mov    $0x0,%edi
+  80412e:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  804135:	00 00 00 
+  804138:	ff d0                	call   *%rax
+  80413a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80413c:	85 c0                	test   %eax,%eax
+  80413e:	0f 88 77 01 00 00    	js     8042bb <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804144:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804148:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  80414f:	00 00 00 
+  804152:	ff d0                	call   *%rax
+  804154:	89 c3                	mov    %eax,%ebx
+  804156:	85 c0                	test   %eax,%eax
+  804158:	0f 88 43 01 00 00    	js     8042a1 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80415e:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804163:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804168:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80416c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804171:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  804178:	00 00 00 
+  80417b:	ff d0                	call   *%rax
+  80417d:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80417f:	85 c0                	test   %eax,%eax
+  804181:	0f 88 1a 01 00 00    	js     8042a1 <pipe+0x1b0>
+    va = fd2data(fd0);
+  804187:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80418b:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  804192:	00 00 00 
+  804195:	ff d0                	call   *%rax
+  804197:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  80419a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80419f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8041a4:	48 89 c6             	mov    %rax,%rsi
+  8041a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ac:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  8041b3:	00 00 00 
+  8041b6:	ff d0                	call   *%rax
+  8041b8:	89 c3                	mov    %eax,%ebx
+  8041ba:	85 c0                	test   %eax,%eax
+  8041bc:	0f 88 c5 00 00 00    	js     804287 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8041c2:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8041c6:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  8041cd:	00 00 00 
+  8041d0:	ff d0                	call   *%rax
+  8041d2:	48 89 c1             	mov    %rax,%rcx
+  8041d5:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8041db:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8041e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041e6:	4c 89 ee             	mov    %r13,%rsi
+  8041e9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041ee:	48 b8 3a 15 80 00 00 	movabs $0x80153a,%rax
+  8041f5:	00 00 00 
+  8041f8:	ff d0                	call   *%rax
+  8041fa:	89 c3                	mov    %eax,%ebx
+  8041fc:	85 c0                	test   %eax,%eax
+  8041fe:	78 6e                	js     80426e <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804200:	be 00 10 00 00       	mov    $0x1000,%esi
+  804205:	4c 89 ef             	mov    %r13,%rdi
+  804208:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  80420f:	00 00 00 
+  804212:	ff d0                	call   *%rax
+  804214:	83 f8 02             	cmp    $0x2,%eax
+  804217:	0f 85 ab 00 00 00    	jne    8042c8 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  80421d:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  804224:	00 00 
+  804226:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  80422a:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  80422c:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804230:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804237:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  80423b:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  80423d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804241:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804248:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80424c:	48 bb 91 1a 80 00 00 	movabs $0x801a91,%rbx
+  804253:	00 00 00 
+  804256:	ff d3                	call   *%rbx
+  804258:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  80425c:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804260:	ff d3                	call   *%rbx
+  804262:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804267:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80426c:	eb 4d                	jmp    8042bb <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  80426e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804273:	4c 89 ee             	mov    %r13,%rsi
+  804276:	bf 00 00 00 00       	mov    $0x0,%edi
+  80427b:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  804282:	00 00 00 
+  804285:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804287:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80428c:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804290:	bf 00 00 00 00       	mov    $0x0,%edi
+  804295:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  80429c:	00 00 00 
+  80429f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  8042a1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8042a6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8042aa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8042af:	48 b8 8a 15 80 00 00 	movabs $0x80158a,%rax
+  8042b6:	00 00 00 
+  8042b9:	ff d0                	call   *%rax
+}
+  8042bb:	89 d8                	mov    %ebx,%eax
+  8042bd:	48 83 c4 18          	add    $0x18,%rsp
+  8042c1:	5b                   	pop    %rbx
+  8042c2:	41 5c                	pop    %r12
+  8042c4:	41 5d                	pop    %r13
+  8042c6:	5d                   	pop    %rbp
+  8042c7:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8042c8:	48 b9 f0 54 80 00 00 	movabs $0x8054f0,%rcx
+  8042cf:	00 00 00 
+  8042d2:	48 ba c7 54 80 00 00 	movabs $0x8054c7,%rdx
+  8042d9:	00 00 00 
+  8042dc:	be 50 00 00 00       	mov    $0x50,%esi
+  8042e1:	48 bf dc 54 80 00 00 	movabs $0x8054dc,%rdi
+  8042e8:	00 00 00 
+  8042eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042f0:	49 b8 10 05 80 00 00 	movabs $0x800510,%r8
+  8042f7:	00 00 00 
+  8042fa:	41 ff d0             	call   *%r8
+
+00000000008042fd <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8042fd:	55                   	push   %rbp
+  8042fe:	48 89 e5             	mov    %rsp,%rbp
+  804301:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804305:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804309:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804315:	85 c0                	test   %eax,%eax
+  804317:	78 23                	js     80433c <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804319:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80431d:	48 b8 a3 1a 80 00 00 	movabs $0x801aa3,%rax
+  804324:	00 00 00 
+  804327:	ff d0                	call   *%rax
+  804329:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80432c:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804330:	48 b8 38 3e 80 00 00 	movabs $0x803e38,%rax
+  804337:	00 00 00 
+  80433a:	ff d0                	call   *%rax
+}
+  80433c:	c9                   	leave
+  80433d:	c3                   	ret
+
+000000000080433e <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80433e:	48 89 f8             	mov    %rdi,%rax
+  804341:	48 c1 e8 27          	shr    $0x27,%rax
+  804345:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80434c:	01 00 00 
+  80434f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804353:	f6 c2 01             	test   $0x1,%dl
+  804356:	74 6d                	je     8043c5 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804358:	48 89 f8             	mov    %rdi,%rax
+  80435b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80435f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804366:	01 00 00 
+  804369:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80436d:	f6 c2 01             	test   $0x1,%dl
+  804370:	74 62                	je     8043d4 <get_uvpt_entry+0x96>
+  804372:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804379:	01 00 00 
+  80437c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804380:	f6 c2 80             	test   $0x80,%dl
+  804383:	75 4f                	jne    8043d4 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804385:	48 89 f8             	mov    %rdi,%rax
+  804388:	48 c1 e8 15          	shr    $0x15,%rax
+  80438c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804393:	01 00 00 
+  804396:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80439a:	f6 c2 01             	test   $0x1,%dl
+  80439d:	74 44                	je     8043e3 <get_uvpt_entry+0xa5>
+  80439f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8043a6:	01 00 00 
+  8043a9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8043ad:	f6 c2 80             	test   $0x80,%dl
+  8043b0:	75 31                	jne    8043e3 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8043b2:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8043b6:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8043bd:	01 00 00 
+  8043c0:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8043c4:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8043c5:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8043cc:	01 00 00 
+  8043cf:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043d3:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8043d4:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8043db:	01 00 00 
+  8043de:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043e2:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8043e3:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8043ea:	01 00 00 
+  8043ed:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8043f1:	c3                   	ret
+
+00000000008043f2 <get_prot>:
+
+int
+get_prot(void *va) {
+  8043f2:	55                   	push   %rbp
+  8043f3:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8043f6:	48 b8 3e 43 80 00 00 	movabs $0x80433e,%rax
+  8043fd:	00 00 00 
+  804400:	ff d0                	call   *%rax
+  804402:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804405:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80440a:	89 c1                	mov    %eax,%ecx
+  80440c:	83 c9 04             	or     $0x4,%ecx
+  80440f:	f6 c2 01             	test   $0x1,%dl
+  804412:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804415:	89 c1                	mov    %eax,%ecx
+  804417:	83 c9 02             	or     $0x2,%ecx
+  80441a:	f6 c2 02             	test   $0x2,%dl
+  80441d:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804420:	89 c1                	mov    %eax,%ecx
+  804422:	83 c9 01             	or     $0x1,%ecx
+  804425:	48 85 d2             	test   %rdx,%rdx
+  804428:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80442b:	89 c1                	mov    %eax,%ecx
+  80442d:	83 c9 40             	or     $0x40,%ecx
+  804430:	f6 c6 04             	test   $0x4,%dh
+  804433:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804436:	5d                   	pop    %rbp
+  804437:	c3                   	ret
+
+0000000000804438 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804438:	55                   	push   %rbp
+  804439:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80443c:	48 b8 3e 43 80 00 00 	movabs $0x80433e,%rax
+  804443:	00 00 00 
+  804446:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804448:	48 c1 e8 06          	shr    $0x6,%rax
+  80444c:	83 e0 01             	and    $0x1,%eax
+}
+  80444f:	5d                   	pop    %rbp
+  804450:	c3                   	ret
+
+0000000000804451 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804451:	55                   	push   %rbp
+  804452:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804455:	48 b8 3e 43 80 00 00 	movabs $0x80433e,%rax
+  80445c:	00 00 00 
+  80445f:	ff d0                	call   *%rax
+  804461:	83 e0 01             	and    $0x1,%eax
+}
+  804464:	5d                   	pop    %rbp
+  804465:	c3                   	ret
+
+0000000000804466 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804466:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80446d:	01 00 00 
+  804470:	a8 01                	test   $0x1,%al
+  804472:	75 06                	jne    80447a <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804474:	b8 00 00 00 00       	mov    $0x0,%eax
+  804479:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80447a:	55                   	push   %rbp
+  80447b:	48 89 e5             	mov    %rsp,%rbp
+  80447e:	41 57                	push   %r15
+  804480:	41 56                	push   %r14
+  804482:	41 55                	push   %r13
+  804484:	41 54                	push   %r12
+  804486:	53                   	push   %rbx
+  804487:	48 83 ec 28          	sub    $0x28,%rsp
+  80448b:	49 89 fe             	mov    %rdi,%r14
+  80448e:	49 89 f7             	mov    %rsi,%r15
+  804491:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804498:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804499:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8044a0:	01 00 00 
+  8044a3:	e9 ae 00 00 00       	jmp    804556 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8044a8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8044af:	49 83 ec 01          	sub    $0x1,%r12
+  8044b3:	74 2d                	je     8044e2 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8044b5:	48 89 d8             	mov    %rbx,%rax
+  8044b8:	48 c1 e8 0c          	shr    $0xc,%rax
+  8044bc:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8044c1:	f6 c2 01             	test   $0x1,%dl
+  8044c4:	74 e2                	je     8044a8 <foreach_shared_region+0x42>
+  8044c6:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8044cb:	f6 c4 04             	test   $0x4,%ah
+  8044ce:	74 d8                	je     8044a8 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8044d0:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8044d7:	4c 89 fa             	mov    %r15,%rdx
+  8044da:	48 89 df             	mov    %rbx,%rdi
+  8044dd:	41 ff d6             	call   *%r14
+  8044e0:	eb c6                	jmp    8044a8 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8044e2:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  8044e9:	00 
+  8044ea:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  8044ef:	74 4a                	je     80453b <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8044f1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8044f5:	48 c1 e8 15          	shr    $0x15,%rax
+  8044f9:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804500:	01 00 00 
+  804503:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804507:	a8 01                	test   $0x1,%al
+  804509:	74 d7                	je     8044e2 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80450b:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80450f:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804516:	48 39 c3             	cmp    %rax,%rbx
+  804519:	73 c7                	jae    8044e2 <foreach_shared_region+0x7c>
+  80451b:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804522:	48 39 d0             	cmp    %rdx,%rax
+  804525:	4d 19 e4             	sbb    %r12,%r12
+  804528:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80452f:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804536:	e9 7a ff ff ff       	jmp    8044b5 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  80453b:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804542:	40 
+  804543:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804547:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80454e:	00 00 00 
+  804551:	48 39 c1             	cmp    %rax,%rcx
+  804554:	74 50                	je     8045a6 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804556:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80455a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80455e:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804565:	01 00 00 
+  804568:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80456c:	a8 01                	test   $0x1,%al
+  80456e:	74 cb                	je     80453b <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804570:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804574:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80457b:	48 39 c1             	cmp    %rax,%rcx
+  80457e:	73 bb                	jae    80453b <foreach_shared_region+0xd5>
+  804580:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804587:	48 39 d0             	cmp    %rdx,%rax
+  80458a:	48 19 c0             	sbb    %rax,%rax
+  80458d:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804593:	48 05 00 02 00 00    	add    $0x200,%rax
+  804599:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80459d:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8045a1:	e9 4b ff ff ff       	jmp    8044f1 <foreach_shared_region+0x8b>
+  8045a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045ab:	48 83 c4 28          	add    $0x28,%rsp
+  8045af:	5b                   	pop    %rbx
+  8045b0:	41 5c                	pop    %r12
+  8045b2:	41 5d                	pop    %r13
+  8045b4:	41 5e                	pop    %r14
+  8045b6:	41 5f                	pop    %r15
+  8045b8:	5d                   	pop    %rbp
+  8045b9:	c3                   	ret
+
+00000000008045ba <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8045ba:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8045c0:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8045c7:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8045ce:	c3                   	ret
+
+00000000008045cf <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8045cf:	8b 47 40             	mov    0x40(%rdi),%eax
+  8045d2:	8b 17                	mov    (%rdi),%edx
+  8045d4:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8045d6:	83 f8 0f             	cmp    $0xf,%eax
+  8045d9:	77 13                	ja     8045ee <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8045db:	8b 47 40             	mov    0x40(%rdi),%eax
+  8045de:	83 e0 0f             	and    $0xf,%eax
+  8045e1:	48 c1 e0 09          	shl    $0x9,%rax
+  8045e5:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8045ec:	00 
+  8045ed:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8045ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8045f3:	c3                   	ret
+
+00000000008045f4 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8045f4:	8b 47 40             	mov    0x40(%rdi),%eax
+  8045f7:	83 c0 01             	add    $0x1,%eax
+  8045fa:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045fd:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804603:	8b 57 04             	mov    0x4(%rdi),%edx
+  804606:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460b:	85 d2                	test   %edx,%edx
+  80460d:	75 04                	jne    804613 <chan_publish+0x1f>
+  80460f:	83 e0 01             	and    $0x1,%eax
+}
+  804612:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804613:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804616:	85 c0                	test   %eax,%eax
+  804618:	0f 95 c0             	setne  %al
+  80461b:	0f b6 c0             	movzbl %al,%eax
+  80461e:	eb ef                	jmp    80460f <chan_publish+0x1b>
+
+0000000000804620 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804620:	8b 47 40             	mov    0x40(%rdi),%eax
+  804623:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804625:	29 d0                	sub    %edx,%eax
+  804627:	83 e8 01             	sub    $0x1,%eax
+  80462a:	83 f8 0f             	cmp    $0xf,%eax
+  80462d:	77 12                	ja     804641 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80462f:	8b 07                	mov    (%rdi),%eax
+  804631:	83 e0 0f             	and    $0xf,%eax
+  804634:	48 c1 e0 09          	shl    $0x9,%rax
+  804638:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80463f:	00 
+  804640:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804641:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804646:	c3                   	ret
+
+0000000000804647 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804647:	8b 07                	mov    (%rdi),%eax
+  804649:	83 c0 01             	add    $0x1,%eax
+  80464c:	89 07                	mov    %eax,(%rdi)
+}
+  80464e:	c3                   	ret
+
+000000000080464f <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80464f:	55                   	push   %rbp
+  804650:	48 89 e5             	mov    %rsp,%rbp
+  804653:	53                   	push   %rbx
+  804654:	48 83 ec 08          	sub    $0x8,%rsp
+  804658:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80465b:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804662:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804668:	48 b8 20 46 80 00 00 	movabs $0x804620,%rax
+  80466f:	00 00 00 
+  804672:	ff d0                	call   *%rax
+  804674:	48 85 c0             	test   %rax,%rax
+  804677:	74 12                	je     80468b <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804679:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804680:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804685:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804689:	c9                   	leave
+  80468a:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80468b:	b8 01 00 00 00       	mov    $0x1,%eax
+  804690:	eb f3                	jmp    804685 <chan_arm+0x36>
+
+0000000000804692 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804692:	55                   	push   %rbp
+  804693:	48 89 e5             	mov    %rsp,%rbp
+  804696:	41 56                	push   %r14
+  804698:	41 55                	push   %r13
+  80469a:	41 54                	push   %r12
+  80469c:	53                   	push   %rbx
+  80469d:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8046a0:	49 bc 4f 46 80 00 00 	movabs $0x80464f,%r12
+  8046a7:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8046aa:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8046ae:	49 bd 52 18 80 00 00 	movabs $0x801852,%r13
+  8046b5:	00 00 00 
+    while (chan_arm(r))
+  8046b8:	eb 0d                	jmp    8046c7 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8046ba:	8b 33                	mov    (%rbx),%esi
+  8046bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8046c1:	4c 89 f7             	mov    %r14,%rdi
+  8046c4:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8046c7:	48 89 df             	mov    %rbx,%rdi
+  8046ca:	41 ff d4             	call   *%r12
+  8046cd:	84 c0                	test   %al,%al
+  8046cf:	75 e9                	jne    8046ba <chan_wait+0x28>
+}
+  8046d1:	5b                   	pop    %rbx
+  8046d2:	41 5c                	pop    %r12
+  8046d4:	41 5d                	pop    %r13
+  8046d6:	41 5e                	pop    %r14
+  8046d8:	5d                   	pop    %rbp
+  8046d9:	c3                   	ret
+
+00000000008046da <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8046da:	55                   	push   %rbp
+  8046db:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8046de:	48 83 c7 40          	add    $0x40,%rdi
+  8046e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8046e7:	48 b8 70 18 80 00 00 	movabs $0x801870,%rax
+  8046ee:	00 00 00 
+  8046f1:	ff d0                	call   *%rax
+}
+  8046f3:	5d                   	pop    %rbp
+  8046f4:	c3                   	ret
+
+00000000008046f5 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8046f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046fa:	c3                   	ret
+
+00000000008046fb <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8046fb:	55                   	push   %rbp
+  8046fc:	48 89 e5             	mov    %rsp,%rbp
+  8046ff:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804702:	48 be 14 55 80 00 00 	movabs $0x805514,%rsi
+  804709:	00 00 00 
+  80470c:	48 b8 85 0f 80 00 00 	movabs $0x800f85,%rax
+  804713:	00 00 00 
+  804716:	ff d0                	call   *%rax
+    return 0;
+}
+  804718:	b8 00 00 00 00       	mov    $0x0,%eax
+  80471d:	5d                   	pop    %rbp
+  80471e:	c3                   	ret
+
+000000000080471f <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80471f:	55                   	push   %rbp
+  804720:	48 89 e5             	mov    %rsp,%rbp
+  804723:	41 57                	push   %r15
+  804725:	41 56                	push   %r14
+  804727:	41 55                	push   %r13
+  804729:	41 54                	push   %r12
+  80472b:	53                   	push   %rbx
+  80472c:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804733:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80473a:	48 85 d2             	test   %rdx,%rdx
+  80473d:	74 7a                	je     8047b9 <devcons_write+0x9a>
+  80473f:	49 89 d6             	mov    %rdx,%r14
+  804742:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804748:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80474d:	49 bf 7f 11 80 00 00 	movabs $0x80117f,%r15
+  804754:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804757:	4c 89 f3             	mov    %r14,%rbx
+  80475a:	48 29 f3             	sub    %rsi,%rbx
+  80475d:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804762:	48 39 c3             	cmp    %rax,%rbx
+  804765:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804769:	4c 63 eb             	movslq %ebx,%r13
+  80476c:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804773:	48 01 c6             	add    %rax,%rsi
+  804776:	4c 89 ea             	mov    %r13,%rdx
+  804779:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804780:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804783:	4c 89 ee             	mov    %r13,%rsi
+  804786:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80478d:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  804794:	00 00 00 
+  804797:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804799:	41 01 dc             	add    %ebx,%r12d
+  80479c:	49 63 f4             	movslq %r12d,%rsi
+  80479f:	4c 39 f6             	cmp    %r14,%rsi
+  8047a2:	72 b3                	jb     804757 <devcons_write+0x38>
+    return res;
+  8047a4:	49 63 c4             	movslq %r12d,%rax
+}
+  8047a7:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8047ae:	5b                   	pop    %rbx
+  8047af:	41 5c                	pop    %r12
+  8047b1:	41 5d                	pop    %r13
+  8047b3:	41 5e                	pop    %r14
+  8047b5:	41 5f                	pop    %r15
+  8047b7:	5d                   	pop    %rbp
+  8047b8:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8047b9:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8047bf:	eb e3                	jmp    8047a4 <devcons_write+0x85>
+
+00000000008047c1 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8047c1:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8047c4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047c9:	48 85 c0             	test   %rax,%rax
+  8047cc:	74 55                	je     804823 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8047ce:	55                   	push   %rbp
+  8047cf:	48 89 e5             	mov    %rsp,%rbp
+  8047d2:	41 55                	push   %r13
+  8047d4:	41 54                	push   %r12
+  8047d6:	53                   	push   %rbx
+  8047d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8047db:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8047de:	48 bb cb 13 80 00 00 	movabs $0x8013cb,%rbx
+  8047e5:	00 00 00 
+  8047e8:	49 bc 80 14 80 00 00 	movabs $0x801480,%r12
+  8047ef:	00 00 00 
+  8047f2:	eb 03                	jmp    8047f7 <devcons_read+0x36>
+  8047f4:	41 ff d4             	call   *%r12
+  8047f7:	ff d3                	call   *%rbx
+  8047f9:	85 c0                	test   %eax,%eax
+  8047fb:	74 f7                	je     8047f4 <devcons_read+0x33>
+    if (c < 0) return c;
+  8047fd:	48 63 d0             	movslq %eax,%rdx
+  804800:	78 13                	js     804815 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804802:	ba 00 00 00 00       	mov    $0x0,%edx
+  804807:	83 f8 04             	cmp    $0x4,%eax
+  80480a:	74 09                	je     804815 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80480c:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804810:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804815:	48 89 d0             	mov    %rdx,%rax
+  804818:	48 83 c4 08          	add    $0x8,%rsp
+  80481c:	5b                   	pop    %rbx
+  80481d:	41 5c                	pop    %r12
+  80481f:	41 5d                	pop    %r13
+  804821:	5d                   	pop    %rbp
+  804822:	c3                   	ret
+  804823:	48 89 d0             	mov    %rdx,%rax
+  804826:	c3                   	ret
+
+0000000000804827 <cputchar>:
+cputchar(int ch) {
+  804827:	55                   	push   %rbp
+  804828:	48 89 e5             	mov    %rsp,%rbp
+  80482b:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80482f:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804833:	be 01 00 00 00       	mov    $0x1,%esi
+  804838:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80483c:	48 b8 ac 13 80 00 00 	movabs $0x8013ac,%rax
+  804843:	00 00 00 
+  804846:	ff d0                	call   *%rax
+}
+  804848:	c9                   	leave
+  804849:	c3                   	ret
+
+000000000080484a <getchar>:
+getchar(void) {
+  80484a:	55                   	push   %rbp
+  80484b:	48 89 e5             	mov    %rsp,%rbp
+  80484e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804852:	ba 01 00 00 00       	mov    $0x1,%edx
+  804857:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80485b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804860:	48 b8 02 1e 80 00 00 	movabs $0x801e02,%rax
+  804867:	00 00 00 
+  80486a:	ff d0                	call   *%rax
+  80486c:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80486e:	85 c0                	test   %eax,%eax
+  804870:	78 06                	js     804878 <getchar+0x2e>
+  804872:	74 08                	je     80487c <getchar+0x32>
+  804874:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804878:	89 d0                	mov    %edx,%eax
+  80487a:	c9                   	leave
+  80487b:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80487c:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804881:	eb f5                	jmp    804878 <getchar+0x2e>
+
+0000000000804883 <iscons>:
+iscons(int fdnum) {
+  804883:	55                   	push   %rbp
+  804884:	48 89 e5             	mov    %rsp,%rbp
+  804887:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80488b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80488f:	48 b8 1f 1b 80 00 00 	movabs $0x801b1f,%rax
+  804896:	00 00 00 
+  804899:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80489b:	85 c0                	test   %eax,%eax
+  80489d:	78 18                	js     8048b7 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80489f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048a3:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8048aa:	00 00 00 
+  8048ad:	8b 00                	mov    (%rax),%eax
+  8048af:	39 02                	cmp    %eax,(%rdx)
+  8048b1:	0f 94 c0             	sete   %al
+  8048b4:	0f b6 c0             	movzbl %al,%eax
+}
+  8048b7:	c9                   	leave
+  8048b8:	c3                   	ret
+
+00000000008048b9 <opencons>:
+opencons(void) {
+  8048b9:	55                   	push   %rbp
+  8048ba:	48 89 e5             	mov    %rsp,%rbp
+  8048bd:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8048c1:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8048c5:	48 b8 bf 1a 80 00 00 	movabs $0x801abf,%rax
+  8048cc:	00 00 00 
+  8048cf:	ff d0                	call   *%rax
+  8048d1:	85 c0                	test   %eax,%eax
+  8048d3:	78 49                	js     80491e <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8048d5:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8048da:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8048df:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8048e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8048e8:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  8048ef:	00 00 00 
+  8048f2:	ff d0                	call   *%rax
+  8048f4:	85 c0                	test   %eax,%eax
+  8048f6:	78 26                	js     80491e <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8048f8:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8048fc:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804903:	00 00 
+  804905:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804907:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80490b:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804912:	48 b8 91 1a 80 00 00 	movabs $0x801a91,%rax
+  804919:	00 00 00 
+  80491c:	ff d0                	call   *%rax
+}
+  80491e:	c9                   	leave
+  80491f:	c3                   	ret
+
+0000000000804920 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804920:	55                   	push   %rbp
+  804921:	48 89 e5             	mov    %rsp,%rbp
+  804924:	41 56                	push   %r14
+  804926:	41 55                	push   %r13
+  804928:	41 54                	push   %r12
+  80492a:	53                   	push   %rbx
+  80492b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80492e:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804935:	00 00 00 
+  804938:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80493c:	74 27                	je     804965 <_handle_vectored_pagefault+0x45>
+  80493e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804943:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80494a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80494d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804950:	4c 89 e7             	mov    %r12,%rdi
+  804953:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804958:	84 c0                	test   %al,%al
+  80495a:	75 45                	jne    8049a1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80495c:	48 83 c3 01          	add    $0x1,%rbx
+  804960:	49 3b 1e             	cmp    (%r14),%rbx
+  804963:	72 eb                	jb     804950 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804965:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80496c:	00 
+  80496d:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804972:	4d 8b 04 24          	mov    (%r12),%r8
+  804976:	48 ba 20 55 80 00 00 	movabs $0x805520,%rdx
+  80497d:	00 00 00 
+  804980:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804985:	48 bf 50 55 80 00 00 	movabs $0x805550,%rdi
+  80498c:	00 00 00 
+  80498f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804994:	49 ba 10 05 80 00 00 	movabs $0x800510,%r10
+  80499b:	00 00 00 
+  80499e:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8049a1:	5b                   	pop    %rbx
+  8049a2:	41 5c                	pop    %r12
+  8049a4:	41 5d                	pop    %r13
+  8049a6:	41 5e                	pop    %r14
+  8049a8:	5d                   	pop    %rbp
+  8049a9:	c3                   	ret
+
+00000000008049aa <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8049aa:	55                   	push   %rbp
+  8049ab:	48 89 e5             	mov    %rsp,%rbp
+  8049ae:	53                   	push   %rbx
+  8049af:	48 83 ec 08          	sub    $0x8,%rsp
+  8049b3:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8049b6:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8049bd:	00 00 00 
+  8049c0:	80 38 00             	cmpb   $0x0,(%rax)
+  8049c3:	0f 84 84 00 00 00    	je     804a4d <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8049c9:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8049d0:	00 00 00 
+  8049d3:	48 8b 10             	mov    (%rax),%rdx
+  8049d6:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8049db:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8049e2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8049e5:	48 85 d2             	test   %rdx,%rdx
+  8049e8:	74 19                	je     804a03 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8049ea:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8049ee:	0f 84 e8 00 00 00    	je     804adc <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8049f4:	48 83 c0 01          	add    $0x1,%rax
+  8049f8:	48 39 d0             	cmp    %rdx,%rax
+  8049fb:	75 ed                	jne    8049ea <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8049fd:	48 83 fa 08          	cmp    $0x8,%rdx
+  804a01:	74 1c                	je     804a1f <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804a03:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804a07:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804a0e:	00 00 00 
+  804a11:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804a18:	00 00 00 
+  804a1b:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804a1f:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  804a26:	00 00 00 
+  804a29:	ff d0                	call   *%rax
+  804a2b:	89 c7                	mov    %eax,%edi
+  804a2d:	48 be a2 4b 80 00 00 	movabs $0x804ba2,%rsi
+  804a34:	00 00 00 
+  804a37:	48 b8 a2 16 80 00 00 	movabs $0x8016a2,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804a43:	85 c0                	test   %eax,%eax
+  804a45:	78 68                	js     804aaf <add_pgfault_handler+0x105>
+    return res;
+}
+  804a47:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804a4b:	c9                   	leave
+  804a4c:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804a4d:	48 b8 57 14 80 00 00 	movabs $0x801457,%rax
+  804a54:	00 00 00 
+  804a57:	ff d0                	call   *%rax
+  804a59:	89 c7                	mov    %eax,%edi
+  804a5b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804a60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804a65:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804a6c:	00 00 00 
+  804a6f:	48 b8 e4 14 80 00 00 	movabs $0x8014e4,%rax
+  804a76:	00 00 00 
+  804a79:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804a7b:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804a82:	00 00 00 
+  804a85:	48 8b 02             	mov    (%rdx),%rax
+  804a88:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804a8c:	48 89 0a             	mov    %rcx,(%rdx)
+  804a8f:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804a96:	00 00 00 
+  804a99:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804a9d:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804aa4:	00 00 00 
+  804aa7:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804aaa:	e9 70 ff ff ff       	jmp    804a1f <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804aaf:	89 c1                	mov    %eax,%ecx
+  804ab1:	48 ba 5e 55 80 00 00 	movabs $0x80555e,%rdx
+  804ab8:	00 00 00 
+  804abb:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804ac0:	48 bf 50 55 80 00 00 	movabs $0x805550,%rdi
+  804ac7:	00 00 00 
+  804aca:	b8 00 00 00 00       	mov    $0x0,%eax
+  804acf:	49 b8 10 05 80 00 00 	movabs $0x800510,%r8
+  804ad6:	00 00 00 
+  804ad9:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ae1:	e9 61 ff ff ff       	jmp    804a47 <add_pgfault_handler+0x9d>
+
+0000000000804ae6 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804ae6:	55                   	push   %rbp
+  804ae7:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804aea:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804af1:	00 00 00 
+  804af4:	80 38 00             	cmpb   $0x0,(%rax)
+  804af7:	74 33                	je     804b2c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804af9:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804b00:	00 00 00 
+  804b03:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804b08:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804b0f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804b12:	48 85 c0             	test   %rax,%rax
+  804b15:	0f 84 85 00 00 00    	je     804ba0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804b1b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804b1f:	74 40                	je     804b61 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804b21:	48 83 c1 01          	add    $0x1,%rcx
+  804b25:	48 39 c1             	cmp    %rax,%rcx
+  804b28:	75 f1                	jne    804b1b <remove_pgfault_handler+0x35>
+  804b2a:	eb 74                	jmp    804ba0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804b2c:	48 b9 76 55 80 00 00 	movabs $0x805576,%rcx
+  804b33:	00 00 00 
+  804b36:	48 ba c7 54 80 00 00 	movabs $0x8054c7,%rdx
+  804b3d:	00 00 00 
+  804b40:	be 43 00 00 00       	mov    $0x43,%esi
+  804b45:	48 bf 50 55 80 00 00 	movabs $0x805550,%rdi
+  804b4c:	00 00 00 
+  804b4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b54:	49 b8 10 05 80 00 00 	movabs $0x800510,%r8
+  804b5b:	00 00 00 
+  804b5e:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804b61:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804b68:	00 
+  804b69:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804b6d:	48 29 ca             	sub    %rcx,%rdx
+  804b70:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804b77:	00 00 00 
+  804b7a:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804b7e:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804b83:	48 89 ce             	mov    %rcx,%rsi
+  804b86:	48 b8 7f 11 80 00 00 	movabs $0x80117f,%rax
+  804b8d:	00 00 00 
+  804b90:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804b92:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804b99:	00 00 00 
+  804b9c:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804ba0:	5d                   	pop    %rbp
+  804ba1:	c3                   	ret
+
+0000000000804ba2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804ba2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804ba5:	48 b8 20 49 80 00 00 	movabs $0x804920,%rax
+  804bac:	00 00 00 
+    call *%rax
+  804baf:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804bb1:	41 5f                	pop    %r15
+	popq %r15
+  804bb3:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804bb5:	41 5f                	pop    %r15
+	popq %r14
+  804bb7:	41 5e                	pop    %r14
+	popq %r13
+  804bb9:	41 5d                	pop    %r13
+	popq %r12
+  804bbb:	41 5c                	pop    %r12
+	popq %r11
+  804bbd:	41 5b                	pop    %r11
+	popq %r10
+  804bbf:	41 5a                	pop    %r10
+	popq %r9
+  804bc1:	41 59                	pop    %r9
+	popq %r8
+  804bc3:	41 58                	pop    %r8
+	popq %rsi
+  804bc5:	5e                   	pop    %rsi
+	popq %rdi
+  804bc6:	5f                   	pop    %rdi
+	popq %rbp
+  804bc7:	5d                   	pop    %rbp
+	popq %rdx
+  804bc8:	5a                   	pop    %rdx
+	popq %rcx
+  804bc9:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804bca:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804bcf:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804bd4:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804bd8:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804bdb:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804be0:	5b                   	pop    %rbx
+	popq %rax
+  804be1:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804be2:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804be6:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804be7:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804bec:	c3                   	ret
+
+0000000000804bed <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804bed:	55                   	push   %rbp
+  804bee:	48 89 e5             	mov    %rsp,%rbp
+  804bf1:	41 55                	push   %r13
+  804bf3:	41 54                	push   %r12
+  804bf5:	53                   	push   %rbx
+  804bf6:	48 83 ec 08          	sub    $0x8,%rsp
+  804bfa:	49 89 fd             	mov    %rdi,%r13
+  804bfd:	48 89 f7             	mov    %rsi,%rdi
+  804c00:	48 89 d3             	mov    %rdx,%rbx
+  804c03:	49 89 cc             	mov    %rcx,%r12
+  804c06:	4c 89 c2             	mov    %r8,%rdx
+  804c09:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804c0c:	48 85 f6             	test   %rsi,%rsi
+  804c0f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804c16:	00 00 00 
+  804c19:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804c1d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804c22:	48 85 db             	test   %rbx,%rbx
+  804c25:	74 03                	je     804c2a <ipc_recv_futex+0x3d>
+  804c27:	48 8b 33             	mov    (%rbx),%rsi
+  804c2a:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804c2e:	48 b8 2e 17 80 00 00 	movabs $0x80172e,%rax
+  804c35:	00 00 00 
+  804c38:	ff d0                	call   *%rax
+    if (res < 0) {
+  804c3a:	85 c0                	test   %eax,%eax
+  804c3c:	78 75                	js     804cb3 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804c3e:	4d 85 ed             	test   %r13,%r13
+  804c41:	74 14                	je     804c57 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804c43:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804c4a:	00 00 00 
+  804c4d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804c53:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804c57:	4d 85 e4             	test   %r12,%r12
+  804c5a:	74 14                	je     804c70 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804c5c:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804c63:	00 00 00 
+  804c66:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  804c6c:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804c70:	48 85 db             	test   %rbx,%rbx
+  804c73:	74 23                	je     804c98 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804c75:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804c7c:	00 00 00 
+  804c7f:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804c85:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c8a:	85 c9                	test   %ecx,%ecx
+  804c8c:	74 07                	je     804c95 <ipc_recv_futex+0xa8>
+  804c8e:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804c95:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804c98:	48 a1 00 04 81 00 00 	movabs 0x810400,%rax
+  804c9f:	00 00 00 
+  804ca2:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804ca8:	48 83 c4 08          	add    $0x8,%rsp
+  804cac:	5b                   	pop    %rbx
+  804cad:	41 5c                	pop    %r12
+  804caf:	41 5d                	pop    %r13
+  804cb1:	5d                   	pop    %rbp
+  804cb2:	c3                   	ret
+        if (from_env_store != NULL) {
+  804cb3:	4d 85 ed             	test   %r13,%r13
+  804cb6:	74 08                	je     804cc0 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804cb8:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804cbf:	00 
+        if (perm_store != NULL) {
+  804cc0:	4d 85 e4             	test   %r12,%r12
+  804cc3:	74 08                	je     804ccd <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804cc5:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804ccc:	00 
+        if (size != NULL) {
+  804ccd:	48 85 db             	test   %rbx,%rbx
+  804cd0:	74 d6                	je     804ca8 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804cd2:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804cd9:	eb cd                	jmp    804ca8 <ipc_recv_futex+0xbb>
+
+0000000000804cdb <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804cdb:	55                   	push   %rbp
+  804cdc:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804cdf:	48 83 ec 08          	sub    $0x8,%rsp
+  804ce3:	6a 00                	push   $0x0
+  804ce5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804ceb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804cf1:	48 b8 ed 4b 80 00 00 	movabs $0x804bed,%rax
+  804cf8:	00 00 00 
+  804cfb:	ff d0                	call   *%rax
+}
+  804cfd:	c9                   	leave
+  804cfe:	c3                   	ret
+
+0000000000804cff <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804cff:	55                   	push   %rbp
+  804d00:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804d03:	48 85 d2             	test   %rdx,%rdx
+  804d06:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804d0d:	00 00 00 
+  804d10:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804d14:	89 f6                	mov    %esi,%esi
+  804d16:	48 b8 17 17 80 00 00 	movabs $0x801717,%rax
+  804d1d:	00 00 00 
+  804d20:	ff d0                	call   *%rax
+    if (res < 0) {
+  804d22:	85 c0                	test   %eax,%eax
+  804d24:	78 02                	js     804d28 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804d26:	5d                   	pop    %rbp
+  804d27:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804d28:	89 c1                	mov    %eax,%ecx
+  804d2a:	48 ba 90 55 80 00 00 	movabs $0x805590,%rdx
+  804d31:	00 00 00 
+  804d34:	be 50 00 00 00       	mov    $0x50,%esi
+  804d39:	48 bf a4 55 80 00 00 	movabs $0x8055a4,%rdi
+  804d40:	00 00 00 
+  804d43:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d48:	49 b8 10 05 80 00 00 	movabs $0x800510,%r8
+  804d4f:	00 00 00 
+  804d52:	41 ff d0             	call   *%r8
+
+0000000000804d55 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804d55:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804d5a:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804d61:	00 00 00 
+  804d64:	48 89 d0             	mov    %rdx,%rax
+  804d67:	48 c1 e0 04          	shl    $0x4,%rax
+  804d6b:	48 29 d0             	sub    %rdx,%rax
+  804d6e:	48 c1 e0 05          	shl    $0x5,%rax
+  804d72:	48 01 c8             	add    %rcx,%rax
+  804d75:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804d7b:	39 f8                	cmp    %edi,%eax
+  804d7d:	74 13                	je     804d92 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804d7f:	48 83 c2 01          	add    $0x1,%rdx
+  804d83:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804d8a:	75 d8                	jne    804d64 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804d8c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804d91:	c3                   	ret
+            return envs[i].env_id;
+  804d92:	48 89 d0             	mov    %rdx,%rax
+  804d95:	48 c1 e0 04          	shl    $0x4,%rax
+  804d99:	48 29 d0             	sub    %rdx,%rax
+  804d9c:	48 c1 e0 05          	shl    $0x5,%rax
+  804da0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804da7:	00 00 00 
+  804daa:	48 01 d0             	add    %rdx,%rax
+  804dad:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804db3:	c3                   	ret
+  804db4:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804db8 <__rodata_start>:
+  804db8:	2f                   	(bad)
+  804db9:	00 25 31 31 64 20    	add    %ah,0x20643131(%rip)        # 20e47ef0 <__bss_end+0x20605ef0>
+  804dbf:	25 63 20 00 25       	and    $0x25002063,%eax
+  804dc4:	73 25                	jae    804deb <__rodata_start+0x33>
+  804dc6:	73 00                	jae    804dc8 <__rodata_start+0x10>
+  804dc8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dc9:	70 65                	jo     804e30 <__rodata_start+0x78>
+  804dcb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804dcc:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a08845 <__bss_end+0x251c6845>
+  804dd2:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  804dd8:	2f                   	(bad)
+  804dd9:	6c                   	insb   (%dx),%es:(%rdi)
+  804dda:	73 2e                	jae    804e0a <__rodata_start+0x52>
+  804ddc:	63 00                	movsxd (%rax),%eax
+  804dde:	73 68                	jae    804e48 <__rodata_start+0x90>
+  804de0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804de1:	72 74                	jb     804e57 <__rodata_start+0x9f>
+  804de3:	20 72 65             	and    %dh,0x65(%rdx)
+  804de6:	61                   	(bad)
+  804de7:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804deb:	20 64 69 72          	and    %ah,0x72(%rcx,%rbp,2)
+  804def:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  804df4:	79 20                	jns    804e16 <__rodata_start+0x5e>
+  804df6:	25 73 00 73 74       	and    $0x74730073,%eax
+  804dfb:	61                   	(bad)
+  804dfc:	74 20                	je     804e1e <__rodata_start+0x66>
+  804dfe:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  804e03:	69 00 75 73 61 67    	imul   $0x67617375,(%rax),%eax
+  804e09:	65 3a 20             	cmp    %gs:(%rax),%ah
+  804e0c:	6c                   	insb   (%dx),%es:(%rdi)
+  804e0d:	73 20                	jae    804e2f <__rodata_start+0x77>
+  804e0f:	5b                   	pop    %rbx
+  804e10:	2d 64 46 6c 5d       	sub    $0x5d6c4664,%eax
+  804e15:	20 5b 66             	and    %bl,0x66(%rbx)
+  804e18:	69 6c 65 2e 2e 2e 5d 	imul   $0xa5d2e2e,0x2e(%rbp,%riz,2),%ebp
+  804e1f:	0a 
+  804e20:	00 0f                	add    %cl,(%rdi)
+  804e22:	1f                   	(bad)
+  804e23:	80 00 00             	addb   $0x0,(%rax)
+  804e26:	00 00                	add    %al,(%rax)
+  804e28:	65 72 72             	gs jb  804e9d <__rodata_start+0xe5>
+  804e2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e2c:	72 20                	jb     804e4e <__rodata_start+0x96>
+  804e2e:	72 65                	jb     804e95 <__rodata_start+0xdd>
+  804e30:	61                   	(bad)
+  804e31:	64 69 6e 67 20 64 69 	imul   $0x72696420,%fs:0x67(%rsi),%ebp
+  804e38:	72 
+  804e39:	65 63 74 6f 72       	movsxd %gs:0x72(%rdi,%rbp,2),%esi
+  804e3e:	79 20                	jns    804e60 <__rodata_start+0xa8>
+  804e40:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  804e45:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  804e4b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804e4d:	77 6e                	ja     804ebd <__rodata_start+0x105>
+  804e4f:	3e 00 0f             	ds add %cl,(%rdi)
+  804e52:	1f                   	(bad)
+  804e53:	80 00 00             	addb   $0x0,(%rax)
+  804e56:	00 00                	add    %al,(%rax)
+  804e58:	5b                   	pop    %rbx
+  804e59:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804e5e:	20 75 73             	and    %dh,0x73(%rbp)
+  804e61:	65 72 20             	gs jb  804e84 <__rodata_start+0xcc>
+  804e64:	70 61                	jo     804ec7 <__rodata_start+0x10f>
+  804e66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e67:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804e6e:	73 20                	jae    804e90 <__rodata_start+0xd8>
+  804e70:	61                   	(bad)
+  804e71:	74 20                	je     804e93 <__rodata_start+0xdb>
+  804e73:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804e78:	3a 20                	cmp    (%rax),%ah
+  804e7a:	00 30                	add    %dh,(%rax)
+  804e7c:	31 32                	xor    %esi,(%rdx)
+  804e7e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804e85:	41                   	rex.B
+  804e86:	42                   	rex.X
+  804e87:	43                   	rex.XB
+  804e88:	44                   	rex.R
+  804e89:	45                   	rex.RB
+  804e8a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804e8d:	31 32                	xor    %esi,(%rdx)
+  804e8f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804e96:	61                   	(bad)
+  804e97:	62 63 64 65 66       	(bad)
+  804e9c:	00 28                	add    %ch,(%rax)
+  804e9e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804e9f:	75 6c                	jne    804f0d <__rodata_start+0x155>
+  804ea1:	6c                   	insb   (%dx),%es:(%rdi)
+  804ea2:	29 00                	sub    %eax,(%rax)
+  804ea4:	65 72 72             	gs jb  804f19 <__rodata_start+0x161>
+  804ea7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ea8:	72 20                	jb     804eca <__rodata_start+0x112>
+  804eaa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804eaf:	73 70                	jae    804f21 <__rodata_start+0x169>
+  804eb1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804eb5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804ebc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ebd:	72 00                	jb     804ebf <__rodata_start+0x107>
+  804ebf:	62 61 64 20 65       	(bad)
+  804ec4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ec5:	76 69                	jbe    804f30 <__rodata_start+0x178>
+  804ec7:	72 6f                	jb     804f38 <__rodata_start+0x180>
+  804ec9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804eca:	6d                   	insl   (%dx),%es:(%rdi)
+  804ecb:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804ecd:	74 00                	je     804ecf <__rodata_start+0x117>
+  804ecf:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ed6:	20 70 61             	and    %dh,0x61(%rax)
+  804ed9:	72 61                	jb     804f3c <__rodata_start+0x184>
+  804edb:	6d                   	insl   (%dx),%es:(%rdi)
+  804edc:	65 74 65             	gs je  804f44 <__rodata_start+0x18c>
+  804edf:	72 00                	jb     804ee1 <__rodata_start+0x129>
+  804ee1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ee2:	75 74                	jne    804f58 <__rodata_start+0x1a0>
+  804ee4:	20 6f 66             	and    %ch,0x66(%rdi)
+  804ee7:	20 6d 65             	and    %ch,0x65(%rbp)
+  804eea:	6d                   	insl   (%dx),%es:(%rdi)
+  804eeb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804eec:	72 79                	jb     804f67 <__rodata_start+0x1af>
+  804eee:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ef1:	74 20                	je     804f13 <__rodata_start+0x15b>
+  804ef3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ef4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804ef8:	76 69                	jbe    804f63 <__rodata_start+0x1ab>
+  804efa:	72 6f                	jb     804f6b <__rodata_start+0x1b3>
+  804efc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804efd:	6d                   	insl   (%dx),%es:(%rdi)
+  804efe:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f00:	74 73                	je     804f75 <__rodata_start+0x1bd>
+  804f02:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804f05:	72 72                	jb     804f79 <__rodata_start+0x1c1>
+  804f07:	75 70                	jne    804f79 <__rodata_start+0x1c1>
+  804f09:	74 65                	je     804f70 <__rodata_start+0x1b8>
+  804f0b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804f10:	75 67                	jne    804f79 <__rodata_start+0x1c1>
+  804f12:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804f15:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f17:	00 73 65             	add    %dh,0x65(%rbx)
+  804f1a:	67 6d                	insl   (%dx),%es:(%edi)
+  804f1c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804f1e:	74 61                	je     804f81 <__rodata_start+0x1c9>
+  804f20:	74 69                	je     804f8b <__rodata_start+0x1d3>
+  804f22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f24:	20 66 61             	and    %ah,0x61(%rsi)
+  804f27:	75 6c                	jne    804f95 <__rodata_start+0x1dd>
+  804f29:	74 00                	je     804f2b <__rodata_start+0x173>
+  804f2b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804f32:	20 45 4c             	and    %al,0x4c(%rbp)
+  804f35:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804f39:	61                   	(bad)
+  804f3a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804f3f:	20 73 75             	and    %dh,0x75(%rbx)
+  804f42:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804f45:	73 79                	jae    804fc0 <__rodata_start+0x208>
+  804f47:	73 74                	jae    804fbd <__rodata_start+0x205>
+  804f49:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804f4b:	20 63 61             	and    %ah,0x61(%rbx)
+  804f4e:	6c                   	insb   (%dx),%es:(%rdi)
+  804f4f:	6c                   	insb   (%dx),%es:(%rdi)
+  804f50:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804f53:	74 72                	je     804fc7 <__rodata_start+0x20f>
+  804f55:	79 20                	jns    804f77 <__rodata_start+0x1bf>
+  804f57:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f58:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f59:	74 20                	je     804f7b <__rodata_start+0x1c3>
+  804f5b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804f5d:	75 6e                	jne    804fcd <__rodata_start+0x215>
+  804f5f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804f63:	76 20                	jbe    804f85 <__rodata_start+0x1cd>
+  804f65:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804f6c:	72 65                	jb     804fd3 <__rodata_start+0x21b>
+  804f6e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804f71:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f72:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804f76:	65 78 70             	gs js  804fe9 <__rodata_start+0x231>
+  804f79:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804f7e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804f81:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804f85:	20 66 69             	and    %ah,0x69(%rsi)
+  804f88:	6c                   	insb   (%dx),%es:(%rdi)
+  804f89:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804f8d:	20 66 72             	and    %ah,0x72(%rsi)
+  804f90:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804f95:	61                   	(bad)
+  804f96:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804f99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804f9a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804f9b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804f9f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804fa2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fa3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fa4:	20 6d 61             	and    %ch,0x61(%rbp)
+  804fa7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fa8:	79 20                	jns    804fca <__rodata_start+0x212>
+  804faa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804fb1:	72 65                	jb     805018 <__rodata_start+0x260>
+  804fb3:	20 6f 70             	and    %ch,0x70(%rdi)
+  804fb6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804fb8:	00 66 69             	add    %ah,0x69(%rsi)
+  804fbb:	6c                   	insb   (%dx),%es:(%rdi)
+  804fbc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804fc0:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804fc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fc4:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804fc7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804fc8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804fc9:	74 20                	je     804feb <__rodata_start+0x233>
+  804fcb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804fcd:	75 6e                	jne    80503d <__rodata_start+0x285>
+  804fcf:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804fd3:	76 61                	jbe    805036 <__rodata_start+0x27e>
+  804fd5:	6c                   	insb   (%dx),%es:(%rdi)
+  804fd6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804fdd:	00 
+  804fde:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804fe5:	72 65                	jb     80504c <__rodata_start+0x294>
+  804fe7:	61                   	(bad)
+  804fe8:	64 79 20             	fs jns 80500b <__rodata_start+0x253>
+  804feb:	65 78 69             	gs js  805057 <__rodata_start+0x29f>
+  804fee:	73 74                	jae    805064 <__rodata_start+0x2ac>
+  804ff0:	73 00                	jae    804ff2 <__rodata_start+0x23a>
+  804ff2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ff3:	70 65                	jo     80505a <__rodata_start+0x2a2>
+  804ff5:	72 61                	jb     805058 <__rodata_start+0x2a0>
+  804ff7:	74 69                	je     805062 <__rodata_start+0x2aa>
+  804ff9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ffa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ffb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804ffe:	74 20                	je     805020 <__rodata_start+0x268>
+  805000:	73 75                	jae    805077 <__rodata_start+0x2bf>
+  805002:	70 70                	jo     805074 <__rodata_start+0x2bc>
+  805004:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805005:	72 74                	jb     80507b <__rodata_start+0x2c3>
+  805007:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  80500d:	20 61 67             	and    %ah,0x67(%rcx)
+  805010:	61                   	(bad)
+  805011:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805018:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  80501c:	74 00                	je     80501e <__rodata_start+0x266>
+  80501e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805025:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805028:	20 75 73             	and    %dh,0x73(%rbp)
+  80502b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  80502f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  805036:	00 
+  805037:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  80503e:	00 00 
+  805040:	4d 08 80 00 00 00 00 	rex.WRB or %r8b,0x0(%r8)
+  805047:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80504d:	00 00                	add    %al,(%rax)
+  80504f:	00 7e 0e             	add    %bh,0xe(%rsi)
+  805052:	80 00 00             	addb   $0x0,(%rax)
+  805055:	00 00                	add    %al,(%rax)
+  805057:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80505d:	00 00                	add    %al,(%rax)
+  80505f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805065:	00 00                	add    %al,(%rax)
+  805067:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805075:	00 00                	add    %al,(%rax)
+  805077:	00 6c 08 80          	add    %ch,-0x80(%rax,%rcx,1)
+  80507b:	00 00                	add    %al,(%rax)
+  80507d:	00 00                	add    %al,(%rax)
+  80507f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80508d:	00 00                	add    %al,(%rax)
+  80508f:	00 60 08             	add    %ah,0x8(%rax)
+  805092:	80 00 00             	addb   $0x0,(%rax)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 da                	add    %bl,%dl
+  805099:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80509f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8050a5:	00 00                	add    %al,(%rax)
+  8050a7:	00 60 08             	add    %ah,0x8(%rax)
+  8050aa:	80 00 00             	addb   $0x0,(%rax)
+  8050ad:	00 00                	add    %al,(%rax)
+  8050af:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050b5:	00 00                	add    %al,(%rax)
+  8050b7:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050bd:	00 00                	add    %al,(%rax)
+  8050bf:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050c5:	00 00                	add    %al,(%rax)
+  8050c7:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050cd:	00 00                	add    %al,(%rax)
+  8050cf:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050d5:	00 00                	add    %al,(%rax)
+  8050d7:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050dd:	00 00                	add    %al,(%rax)
+  8050df:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050e5:	00 00                	add    %al,(%rax)
+  8050e7:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050ed:	00 00                	add    %al,(%rax)
+  8050ef:	00 a6 08 80 00 00    	add    %ah,0x8008(%rsi)
+  8050f5:	00 00                	add    %al,(%rax)
+  8050f7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8050fd:	00 00                	add    %al,(%rax)
+  8050ff:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805105:	00 00                	add    %al,(%rax)
+  805107:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80510d:	00 00                	add    %al,(%rax)
+  80510f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805115:	00 00                	add    %al,(%rax)
+  805117:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80511d:	00 00                	add    %al,(%rax)
+  80511f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805125:	00 00                	add    %al,(%rax)
+  805127:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80512d:	00 00                	add    %al,(%rax)
+  80512f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805135:	00 00                	add    %al,(%rax)
+  805137:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80513d:	00 00                	add    %al,(%rax)
+  80513f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805145:	00 00                	add    %al,(%rax)
+  805147:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80514d:	00 00                	add    %al,(%rax)
+  80514f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805155:	00 00                	add    %al,(%rax)
+  805157:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80515d:	00 00                	add    %al,(%rax)
+  80515f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805165:	00 00                	add    %al,(%rax)
+  805167:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80516d:	00 00                	add    %al,(%rax)
+  80516f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805175:	00 00                	add    %al,(%rax)
+  805177:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80517d:	00 00                	add    %al,(%rax)
+  80517f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805185:	00 00                	add    %al,(%rax)
+  805187:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80518d:	00 00                	add    %al,(%rax)
+  80518f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805195:	00 00                	add    %al,(%rax)
+  805197:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80519d:	00 00                	add    %al,(%rax)
+  80519f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051a5:	00 00                	add    %al,(%rax)
+  8051a7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051ad:	00 00                	add    %al,(%rax)
+  8051af:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051b5:	00 00                	add    %al,(%rax)
+  8051b7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051bd:	00 00                	add    %al,(%rax)
+  8051bf:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051c5:	00 00                	add    %al,(%rax)
+  8051c7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051cd:	00 00                	add    %al,(%rax)
+  8051cf:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051d5:	00 00                	add    %al,(%rax)
+  8051d7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051dd:	00 00                	add    %al,(%rax)
+  8051df:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051e5:	00 00                	add    %al,(%rax)
+  8051e7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  8051ed:	00 00                	add    %al,(%rax)
+  8051ef:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051f5:	00 00                	add    %al,(%rax)
+  8051f7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8051fd:	00 00                	add    %al,(%rax)
+  8051ff:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805205:	00 00                	add    %al,(%rax)
+  805207:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80520d:	00 00                	add    %al,(%rax)
+  80520f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805215:	00 00                	add    %al,(%rax)
+  805217:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80521d:	00 00                	add    %al,(%rax)
+  80521f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805225:	00 00                	add    %al,(%rax)
+  805227:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80522d:	00 00                	add    %al,(%rax)
+  80522f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805235:	00 00                	add    %al,(%rax)
+  805237:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80523d:	00 00                	add    %al,(%rax)
+  80523f:	00 fd                	add    %bh,%ch
+  805241:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805247:	00 cc                	add    %cl,%ah
+  805249:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80524f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805255:	00 00                	add    %al,(%rax)
+  805257:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80525d:	00 00                	add    %al,(%rax)
+  80525f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805265:	00 00                	add    %al,(%rax)
+  805267:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80526d:	00 00                	add    %al,(%rax)
+  80526f:	00 2c 09             	add    %ch,(%rcx,%rcx,1)
+  805272:	80 00 00             	addb   $0x0,(%rax)
+  805275:	00 00                	add    %al,(%rax)
+  805277:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80527d:	00 00                	add    %al,(%rax)
+  80527f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805285:	00 00                	add    %al,(%rax)
+  805287:	00 f2                	add    %dh,%dl
+  805289:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  80528f:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  805295:	00 00                	add    %al,(%rax)
+  805297:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  80529d:	00 00                	add    %al,(%rax)
+  80529f:	00 74 0c 80          	add    %dh,-0x80(%rsp,%rcx,1)
+  8052a3:	00 00                	add    %al,(%rax)
+  8052a5:	00 00                	add    %al,(%rax)
+  8052a7:	00 3e                	add    %bh,(%rsi)
+  8052a9:	0d 80 00 00 00       	or     $0x80,%eax
+  8052ae:	00 00                	add    %al,(%rax)
+  8052b0:	8e 0e                	mov    (%rsi),%cs
+  8052b2:	80 00 00             	addb   $0x0,(%rax)
+  8052b5:	00 00                	add    %al,(%rax)
+  8052b7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8052bd:	00 00                	add    %al,(%rax)
+  8052bf:	00 c3                	add    %al,%bl
+  8052c1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  8052c7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8052cd:	00 00                	add    %al,(%rax)
+  8052cf:	00 a0 0b 80 00 00    	add    %ah,0x800b(%rax)
+  8052d5:	00 00                	add    %al,(%rax)
+  8052d7:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8052dd:	00 00                	add    %al,(%rax)
+  8052df:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8052e5:	00 00                	add    %al,(%rax)
+  8052e7:	00 b1 0d 80 00 00    	add    %dh,0x800d(%rcx)
+  8052ed:	00 00                	add    %al,(%rax)
+  8052ef:	00 8e 0e 80 00 00    	add    %cl,0x800e(%rsi)
+  8052f5:	00 00                	add    %al,(%rax)
+  8052f7:	00 56 08             	add    %dl,0x8(%rsi)
+  8052fa:	80 00 00             	addb   $0x0,(%rax)
+  8052fd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805300 <error_string>:
+	...
+  805308:	ad 4e 80 00 00 00 00 00 bf 4e 80 00 00 00 00 00     .N.......N......
+  805318:	cf 4e 80 00 00 00 00 00 e1 4e 80 00 00 00 00 00     .N.......N......
+  805328:	ef 4e 80 00 00 00 00 00 03 4f 80 00 00 00 00 00     .N.......O......
+  805338:	18 4f 80 00 00 00 00 00 2b 4f 80 00 00 00 00 00     .O......+O......
+  805348:	3d 4f 80 00 00 00 00 00 51 4f 80 00 00 00 00 00     =O......QO......
+  805358:	61 4f 80 00 00 00 00 00 74 4f 80 00 00 00 00 00     aO......tO......
+  805368:	8b 4f 80 00 00 00 00 00 a1 4f 80 00 00 00 00 00     .O.......O......
+  805378:	b9 4f 80 00 00 00 00 00 d1 4f 80 00 00 00 00 00     .O.......O......
+  805388:	de 4f 80 00 00 00 00 00 b8 53 80 00 00 00 00 00     .O.......S......
+  805398:	f2 4f 80 00 00 00 00 00 0a 50 80 00 00 00 00 00     .O.......P......
+  8053a8:	14 50 80 00 00 00 00 00 1e 50 80 00 00 00 00 00     .P.......P......
+  8053b8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  8053c8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  8053d8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8053e8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8053f8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805408:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805418:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805428:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805438:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805448:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805458:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805468:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805478:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805488:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805498:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008054a0 <devtab>:
+  8054a0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8054b0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8054c0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8054d0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8054e0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8054f0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805500:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805510:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805520:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805530:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805540:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805550:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805560:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805570:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805580:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805590:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8055a0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
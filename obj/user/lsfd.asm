@@ -0,0 +1,8861 @@
+
+obj/user/lsfd:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 4b 01 00 00       	call   80016e <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <usage>:
+#include <inc/lib.h>
+
+void
+usage(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: lsfd [-1]\n");
+  800029:	48 bf e8 4a 80 00 00 	movabs $0x804ae8,%rdi
+  800030:	00 00 00 
+  800033:	b8 00 00 00 00       	mov    $0x0,%eax
+  800038:	48 ba f1 02 80 00 00 	movabs $0x8002f1,%rdx
+  80003f:	00 00 00 
+  800042:	ff d2                	call   *%rdx
+    exit();
+  800044:	48 b8 21 02 80 00 00 	movabs $0x800221,%rax
+  80004b:	00 00 00 
+  80004e:	ff d0                	call   *%rax
+}
+  800050:	5d                   	pop    %rbp
+  800051:	c3                   	ret
+
+0000000000800052 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800052:	55                   	push   %rbp
+  800053:	48 89 e5             	mov    %rsp,%rbp
+  800056:	41 57                	push   %r15
+  800058:	41 56                	push   %r14
+  80005a:	41 55                	push   %r13
+  80005c:	41 54                	push   %r12
+  80005e:	53                   	push   %rbx
+  80005f:	48 81 ec c8 00 00 00 	sub    $0xc8,%rsp
+  800066:	89 bd 1c ff ff ff    	mov    %edi,-0xe4(%rbp)
+    int i, usefprint = 0;
+    struct Stat st;
+    struct Argstate args;
+
+    argstart(&argc, argv, &args);
+  80006c:	48 8d 95 20 ff ff ff 	lea    -0xe0(%rbp),%rdx
+  800073:	48 8d bd 1c ff ff ff 	lea    -0xe4(%rbp),%rdi
+  80007a:	48 b8 a8 15 80 00 00 	movabs $0x8015a8,%rax
+  800081:	00 00 00 
+  800084:	ff d0                	call   *%rax
+    int i, usefprint = 0;
+  800086:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+    while ((i = argnext(&args)) >= 0) {
+  80008c:	48 bb d5 15 80 00 00 	movabs $0x8015d5,%rbx
+  800093:	00 00 00 
+  800096:	48 8d bd 20 ff ff ff 	lea    -0xe0(%rbp),%rdi
+  80009d:	ff d3                	call   *%rbx
+  80009f:	85 c0                	test   %eax,%eax
+  8000a1:	78 1b                	js     8000be <umain+0x6c>
+        if (i == '1')
+  8000a3:	83 f8 31             	cmp    $0x31,%eax
+  8000a6:	75 08                	jne    8000b0 <umain+0x5e>
+            usefprint = 1;
+  8000a8:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+  8000ae:	eb e6                	jmp    800096 <umain+0x44>
+        else
+            usage();
+  8000b0:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8000b7:	00 00 00 
+  8000ba:	ff d0                	call   *%rax
+  8000bc:	eb d8                	jmp    800096 <umain+0x44>
+    }
+
+    for (i = 0; i < 32; i++) {
+  8000be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fstat(i, &st) >= 0) {
+  8000c3:	49 bd 87 1d 80 00 00 	movabs $0x801d87,%r13
+  8000ca:	00 00 00 
+            if (usefprint) {
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            } else {
+                cprintf("fd %d: name %s isdir %d size %d dev %s\n",
+  8000cd:	49 be 00 4b 80 00 00 	movabs $0x804b00,%r14
+  8000d4:	00 00 00 
+  8000d7:	49 bf f1 02 80 00 00 	movabs $0x8002f1,%r15
+  8000de:	00 00 00 
+  8000e1:	eb 2b                	jmp    80010e <umain+0xbc>
+  8000e3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000e7:	4c 8b 48 08          	mov    0x8(%rax),%r9
+  8000eb:	44 8b 45 c0          	mov    -0x40(%rbp),%r8d
+  8000ef:	8b 4d c4             	mov    -0x3c(%rbp),%ecx
+  8000f2:	48 8d 95 40 ff ff ff 	lea    -0xc0(%rbp),%rdx
+  8000f9:	89 de                	mov    %ebx,%esi
+  8000fb:	4c 89 f7             	mov    %r14,%rdi
+  8000fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800103:	41 ff d7             	call   *%r15
+    for (i = 0; i < 32; i++) {
+  800106:	83 c3 01             	add    $0x1,%ebx
+  800109:	83 fb 20             	cmp    $0x20,%ebx
+  80010c:	74 51                	je     80015f <umain+0x10d>
+        if (fstat(i, &st) >= 0) {
+  80010e:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  800115:	89 df                	mov    %ebx,%edi
+  800117:	41 ff d5             	call   *%r13
+  80011a:	85 c0                	test   %eax,%eax
+  80011c:	78 e8                	js     800106 <umain+0xb4>
+            if (usefprint) {
+  80011e:	45 85 e4             	test   %r12d,%r12d
+  800121:	74 c0                	je     8000e3 <umain+0x91>
+                fprintf(1, "fd %d: name %s isdir %d size %d dev %s\n",
+  800123:	48 83 ec 08          	sub    $0x8,%rsp
+  800127:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80012b:	ff 70 08             	push   0x8(%rax)
+  80012e:	44 8b 4d c0          	mov    -0x40(%rbp),%r9d
+  800132:	44 8b 45 c4          	mov    -0x3c(%rbp),%r8d
+  800136:	48 8d 8d 40 ff ff ff 	lea    -0xc0(%rbp),%rcx
+  80013d:	89 da                	mov    %ebx,%edx
+  80013f:	4c 89 f6             	mov    %r14,%rsi
+  800142:	bf 01 00 00 00       	mov    $0x1,%edi
+  800147:	b8 00 00 00 00       	mov    $0x0,%eax
+  80014c:	49 ba 32 39 80 00 00 	movabs $0x803932,%r10
+  800153:	00 00 00 
+  800156:	41 ff d2             	call   *%r10
+  800159:	48 83 c4 10          	add    $0x10,%rsp
+  80015d:	eb a7                	jmp    800106 <umain+0xb4>
+                        i, st.st_name, st.st_isdir,
+                        st.st_size, st.st_dev->dev_name);
+            }
+        }
+    }
+}
+  80015f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800163:	5b                   	pop    %rbx
+  800164:	41 5c                	pop    %r12
+  800166:	41 5d                	pop    %r13
+  800168:	41 5e                	pop    %r14
+  80016a:	41 5f                	pop    %r15
+  80016c:	5d                   	pop    %rbp
+  80016d:	c3                   	ret
+
+000000000080016e <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80016e:	55                   	push   %rbp
+  80016f:	48 89 e5             	mov    %rsp,%rbp
+  800172:	41 56                	push   %r14
+  800174:	41 55                	push   %r13
+  800176:	41 54                	push   %r12
+  800178:	53                   	push   %rbx
+  800179:	41 89 fd             	mov    %edi,%r13d
+  80017c:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80017f:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800186:	00 00 00 
+  800189:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800190:	00 00 00 
+  800193:	48 39 c2             	cmp    %rax,%rdx
+  800196:	73 17                	jae    8001af <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800198:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019b:	49 89 c4             	mov    %rax,%r12
+  80019e:	48 83 c3 08          	add    $0x8,%rbx
+  8001a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001a7:	ff 53 f8             	call   *-0x8(%rbx)
+  8001aa:	4c 39 e3             	cmp    %r12,%rbx
+  8001ad:	72 ef                	jb     80019e <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001af:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	89 c2                	mov    %eax,%edx
+  8001bd:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001c3:	48 89 d0             	mov    %rdx,%rax
+  8001c6:	48 c1 e0 04          	shl    $0x4,%rax
+  8001ca:	48 29 d0             	sub    %rdx,%rax
+  8001cd:	48 c1 e0 05          	shl    $0x5,%rax
+  8001d1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001d8:	00 00 00 
+  8001db:	48 01 d0             	add    %rdx,%rax
+  8001de:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001e5:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001e8:	45 85 ed             	test   %r13d,%r13d
+  8001eb:	7e 0d                	jle    8001fa <libmain+0x8c>
+  8001ed:	49 8b 06             	mov    (%r14),%rax
+  8001f0:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001f7:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001fa:	4c 89 f6             	mov    %r14,%rsi
+  8001fd:	44 89 ef             	mov    %r13d,%edi
+  800200:	48 b8 52 00 80 00 00 	movabs $0x800052,%rax
+  800207:	00 00 00 
+  80020a:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80020c:	48 b8 21 02 80 00 00 	movabs $0x800221,%rax
+  800213:	00 00 00 
+  800216:	ff d0                	call   *%rax
+#endif
+}
+  800218:	5b                   	pop    %rbx
+  800219:	41 5c                	pop    %r12
+  80021b:	41 5d                	pop    %r13
+  80021d:	41 5e                	pop    %r14
+  80021f:	5d                   	pop    %rbp
+  800220:	c3                   	ret
+
+0000000000800221 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800221:	55                   	push   %rbp
+  800222:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800225:	48 b8 48 19 80 00 00 	movabs $0x801948,%rax
+  80022c:	00 00 00 
+  80022f:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800231:	bf 00 00 00 00       	mov    $0x0,%edi
+  800236:	48 b8 85 10 80 00 00 	movabs $0x801085,%rax
+  80023d:	00 00 00 
+  800240:	ff d0                	call   *%rax
+}
+  800242:	5d                   	pop    %rbp
+  800243:	c3                   	ret
+
+0000000000800244 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800244:	55                   	push   %rbp
+  800245:	48 89 e5             	mov    %rsp,%rbp
+  800248:	53                   	push   %rbx
+  800249:	48 83 ec 08          	sub    $0x8,%rsp
+  80024d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800250:	8b 06                	mov    (%rsi),%eax
+  800252:	8d 50 01             	lea    0x1(%rax),%edx
+  800255:	89 16                	mov    %edx,(%rsi)
+  800257:	48 98                	cltq
+  800259:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80025e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800264:	74 0a                	je     800270 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800266:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80026a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80026e:	c9                   	leave
+  80026f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800270:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800274:	be ff 00 00 00       	mov    $0xff,%esi
+  800279:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  800280:	00 00 00 
+  800283:	ff d0                	call   *%rax
+        state->offset = 0;
+  800285:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80028b:	eb d9                	jmp    800266 <putch+0x22>
+
+000000000080028d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80028d:	55                   	push   %rbp
+  80028e:	48 89 e5             	mov    %rsp,%rbp
+  800291:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800298:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80029b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002a2:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ac:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002af:	48 89 f1             	mov    %rsi,%rcx
+  8002b2:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002b9:	48 bf 44 02 80 00 00 	movabs $0x800244,%rdi
+  8002c0:	00 00 00 
+  8002c3:	48 b8 41 04 80 00 00 	movabs $0x800441,%rax
+  8002ca:	00 00 00 
+  8002cd:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002cf:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002d6:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002dd:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002e9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002ef:	c9                   	leave
+  8002f0:	c3                   	ret
+
+00000000008002f1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002f1:	55                   	push   %rbp
+  8002f2:	48 89 e5             	mov    %rsp,%rbp
+  8002f5:	48 83 ec 50          	sub    $0x50,%rsp
+  8002f9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002fd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800301:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800305:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800309:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80030d:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800314:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800318:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80031c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800320:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800324:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800328:	48 b8 8d 02 80 00 00 	movabs $0x80028d,%rax
+  80032f:	00 00 00 
+  800332:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800334:	c9                   	leave
+  800335:	c3                   	ret
+
+0000000000800336 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800336:	55                   	push   %rbp
+  800337:	48 89 e5             	mov    %rsp,%rbp
+  80033a:	41 57                	push   %r15
+  80033c:	41 56                	push   %r14
+  80033e:	41 55                	push   %r13
+  800340:	41 54                	push   %r12
+  800342:	53                   	push   %rbx
+  800343:	48 83 ec 18          	sub    $0x18,%rsp
+  800347:	49 89 fc             	mov    %rdi,%r12
+  80034a:	49 89 f5             	mov    %rsi,%r13
+  80034d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800351:	8b 45 10             	mov    0x10(%rbp),%eax
+  800354:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800357:	41 89 cf             	mov    %ecx,%r15d
+  80035a:	4c 39 fa             	cmp    %r15,%rdx
+  80035d:	73 5b                	jae    8003ba <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80035f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800363:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800367:	85 db                	test   %ebx,%ebx
+  800369:	7e 0e                	jle    800379 <print_num+0x43>
+            putch(padc, put_arg);
+  80036b:	4c 89 ee             	mov    %r13,%rsi
+  80036e:	44 89 f7             	mov    %r14d,%edi
+  800371:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800374:	83 eb 01             	sub    $0x1,%ebx
+  800377:	75 f2                	jne    80036b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800379:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80037d:	48 b9 43 4b 80 00 00 	movabs $0x804b43,%rcx
+  800384:	00 00 00 
+  800387:	48 b8 32 4b 80 00 00 	movabs $0x804b32,%rax
+  80038e:	00 00 00 
+  800391:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800395:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800399:	ba 00 00 00 00       	mov    $0x0,%edx
+  80039e:	49 f7 f7             	div    %r15
+  8003a1:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003a5:	4c 89 ee             	mov    %r13,%rsi
+  8003a8:	41 ff d4             	call   *%r12
+}
+  8003ab:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003af:	5b                   	pop    %rbx
+  8003b0:	41 5c                	pop    %r12
+  8003b2:	41 5d                	pop    %r13
+  8003b4:	41 5e                	pop    %r14
+  8003b6:	41 5f                	pop    %r15
+  8003b8:	5d                   	pop    %rbp
+  8003b9:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003ba:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003be:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c3:	49 f7 f7             	div    %r15
+  8003c6:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ca:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003ce:	52                   	push   %rdx
+  8003cf:	45 0f be c9          	movsbl %r9b,%r9d
+  8003d3:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003d7:	48 89 c2             	mov    %rax,%rdx
+  8003da:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  8003e1:	00 00 00 
+  8003e4:	ff d0                	call   *%rax
+  8003e6:	48 83 c4 10          	add    $0x10,%rsp
+  8003ea:	eb 8d                	jmp    800379 <print_num+0x43>
+
+00000000008003ec <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003ec:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003f0:	48 8b 06             	mov    (%rsi),%rax
+  8003f3:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003f7:	73 0a                	jae    800403 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003f9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003fd:	48 89 16             	mov    %rdx,(%rsi)
+  800400:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800403:	c3                   	ret
+
+0000000000800404 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800404:	55                   	push   %rbp
+  800405:	48 89 e5             	mov    %rsp,%rbp
+  800408:	48 83 ec 50          	sub    $0x50,%rsp
+  80040c:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800410:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800414:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800418:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80041f:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800423:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800427:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80042b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80042f:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800433:	48 b8 41 04 80 00 00 	movabs $0x800441,%rax
+  80043a:	00 00 00 
+  80043d:	ff d0                	call   *%rax
+}
+  80043f:	c9                   	leave
+  800440:	c3                   	ret
+
+0000000000800441 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800441:	55                   	push   %rbp
+  800442:	48 89 e5             	mov    %rsp,%rbp
+  800445:	41 57                	push   %r15
+  800447:	41 56                	push   %r14
+  800449:	41 55                	push   %r13
+  80044b:	41 54                	push   %r12
+  80044d:	53                   	push   %rbx
+  80044e:	48 83 ec 38          	sub    $0x38,%rsp
+  800452:	49 89 fe             	mov    %rdi,%r14
+  800455:	49 89 f5             	mov    %rsi,%r13
+  800458:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80045b:	48 8b 01             	mov    (%rcx),%rax
+  80045e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800462:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800466:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80046a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80046e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800472:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800476:	0f b6 3b             	movzbl (%rbx),%edi
+  800479:	40 80 ff 25          	cmp    $0x25,%dil
+  80047d:	74 18                	je     800497 <vprintfmt+0x56>
+            if (!ch) return;
+  80047f:	40 84 ff             	test   %dil,%dil
+  800482:	0f 84 b1 06 00 00    	je     800b39 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800488:	40 0f b6 ff          	movzbl %dil,%edi
+  80048c:	4c 89 ee             	mov    %r13,%rsi
+  80048f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800492:	4c 89 e3             	mov    %r12,%rbx
+  800495:	eb db                	jmp    800472 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800497:	be 00 00 00 00       	mov    $0x0,%esi
+  80049c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004a0:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004a5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ab:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004b2:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004b6:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004bb:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004c0:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004c3:	83 e8 23             	sub    $0x23,%eax
+  8004c6:	3c 57                	cmp    $0x57,%al
+  8004c8:	0f 87 51 06 00 00    	ja     800b1f <vprintfmt+0x6de>
+  8004ce:	0f b6 c0             	movzbl %al,%eax
+  8004d1:	48 b9 00 4d 80 00 00 	movabs $0x804d00,%rcx
+  8004d8:	00 00 00 
+  8004db:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004de:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004e1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004e5:	eb cf                	jmp    8004b6 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004e7:	49 89 dc             	mov    %rbx,%r12
+  8004ea:	be 01 00 00 00       	mov    $0x1,%esi
+  8004ef:	eb c5                	jmp    8004b6 <vprintfmt+0x75>
+            padc = ch;
+  8004f1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004f5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004f8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004fb:	eb b9                	jmp    8004b6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004fd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800500:	83 f8 2f             	cmp    $0x2f,%eax
+  800503:	77 24                	ja     800529 <vprintfmt+0xe8>
+  800505:	89 c1                	mov    %eax,%ecx
+  800507:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80050b:	83 c0 08             	add    $0x8,%eax
+  80050e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800511:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800514:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800517:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80051b:	79 99                	jns    8004b6 <vprintfmt+0x75>
+                width = precision;
+  80051d:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800521:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800527:	eb 8d                	jmp    8004b6 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800529:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80052d:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800531:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800535:	eb da                	jmp    800511 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800537:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80053c:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800540:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800546:	3c 39                	cmp    $0x39,%al
+  800548:	77 1c                	ja     800566 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80054a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80054e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800552:	0f b6 c0             	movzbl %al,%eax
+  800555:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80055a:	0f b6 03             	movzbl (%rbx),%eax
+  80055d:	3c 39                	cmp    $0x39,%al
+  80055f:	76 e9                	jbe    80054a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800561:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800564:	eb b1                	jmp    800517 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800566:	49 89 dc             	mov    %rbx,%r12
+  800569:	eb ac                	jmp    800517 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80056b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80056e:	85 c9                	test   %ecx,%ecx
+  800570:	b8 00 00 00 00       	mov    $0x0,%eax
+  800575:	0f 49 c1             	cmovns %ecx,%eax
+  800578:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80057b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80057e:	e9 33 ff ff ff       	jmp    8004b6 <vprintfmt+0x75>
+            lflag++;
+  800583:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800586:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800589:	e9 28 ff ff ff       	jmp    8004b6 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80058e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800591:	83 f8 2f             	cmp    $0x2f,%eax
+  800594:	77 19                	ja     8005af <vprintfmt+0x16e>
+  800596:	89 c2                	mov    %eax,%edx
+  800598:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80059c:	83 c0 08             	add    $0x8,%eax
+  80059f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005a2:	8b 3a                	mov    (%rdx),%edi
+  8005a4:	4c 89 ee             	mov    %r13,%rsi
+  8005a7:	41 ff d6             	call   *%r14
+            break;
+  8005aa:	e9 c3 fe ff ff       	jmp    800472 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005af:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005b3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005b7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005bb:	eb e5                	jmp    8005a2 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c3:	77 5a                	ja     80061f <vprintfmt+0x1de>
+  8005c5:	89 c2                	mov    %eax,%edx
+  8005c7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005cb:	83 c0 08             	add    $0x8,%eax
+  8005ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005d1:	8b 02                	mov    (%rdx),%eax
+  8005d3:	89 c1                	mov    %eax,%ecx
+  8005d5:	f7 d9                	neg    %ecx
+  8005d7:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005da:	83 f9 16             	cmp    $0x16,%ecx
+  8005dd:	7f 4e                	jg     80062d <vprintfmt+0x1ec>
+  8005df:	48 63 c1             	movslq %ecx,%rax
+  8005e2:	48 ba c0 4f 80 00 00 	movabs $0x804fc0,%rdx
+  8005e9:	00 00 00 
+  8005ec:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005f0:	48 85 c0             	test   %rax,%rax
+  8005f3:	74 38                	je     80062d <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005f5:	48 89 c1             	mov    %rax,%rcx
+  8005f8:	48 ba 99 51 80 00 00 	movabs $0x805199,%rdx
+  8005ff:	00 00 00 
+  800602:	4c 89 ee             	mov    %r13,%rsi
+  800605:	4c 89 f7             	mov    %r14,%rdi
+  800608:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060d:	49 b8 04 04 80 00 00 	movabs $0x800404,%r8
+  800614:	00 00 00 
+  800617:	41 ff d0             	call   *%r8
+  80061a:	e9 53 fe ff ff       	jmp    800472 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80061f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800623:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800627:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80062b:	eb a4                	jmp    8005d1 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80062d:	48 ba 5b 4b 80 00 00 	movabs $0x804b5b,%rdx
+  800634:	00 00 00 
+  800637:	4c 89 ee             	mov    %r13,%rsi
+  80063a:	4c 89 f7             	mov    %r14,%rdi
+  80063d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800642:	49 b8 04 04 80 00 00 	movabs $0x800404,%r8
+  800649:	00 00 00 
+  80064c:	41 ff d0             	call   *%r8
+  80064f:	e9 1e fe ff ff       	jmp    800472 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800654:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800657:	83 f8 2f             	cmp    $0x2f,%eax
+  80065a:	77 6c                	ja     8006c8 <vprintfmt+0x287>
+  80065c:	89 c2                	mov    %eax,%edx
+  80065e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800662:	83 c0 08             	add    $0x8,%eax
+  800665:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800668:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80066b:	48 85 d2             	test   %rdx,%rdx
+  80066e:	48 b8 54 4b 80 00 00 	movabs $0x804b54,%rax
+  800675:	00 00 00 
+  800678:	48 0f 45 c2          	cmovne %rdx,%rax
+  80067c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800680:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800684:	7e 06                	jle    80068c <vprintfmt+0x24b>
+  800686:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80068a:	75 4a                	jne    8006d6 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80068c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800690:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800694:	0f b6 00             	movzbl (%rax),%eax
+  800697:	84 c0                	test   %al,%al
+  800699:	0f 85 9a 00 00 00    	jne    800739 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80069f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006a2:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006a6:	85 c0                	test   %eax,%eax
+  8006a8:	0f 8e c4 fd ff ff    	jle    800472 <vprintfmt+0x31>
+  8006ae:	4c 89 ee             	mov    %r13,%rsi
+  8006b1:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006b6:	41 ff d6             	call   *%r14
+  8006b9:	41 83 ec 01          	sub    $0x1,%r12d
+  8006bd:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006c1:	75 eb                	jne    8006ae <vprintfmt+0x26d>
+  8006c3:	e9 aa fd ff ff       	jmp    800472 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d4:	eb 92                	jmp    800668 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006d6:	49 63 f7             	movslq %r15d,%rsi
+  8006d9:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006dd:	48 b8 f3 0b 80 00 00 	movabs $0x800bf3,%rax
+  8006e4:	00 00 00 
+  8006e7:	ff d0                	call   *%rax
+  8006e9:	48 89 c2             	mov    %rax,%rdx
+  8006ec:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006ef:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006f1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006f4:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006f7:	85 c0                	test   %eax,%eax
+  8006f9:	7e 91                	jle    80068c <vprintfmt+0x24b>
+  8006fb:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800700:	4c 89 ee             	mov    %r13,%rsi
+  800703:	44 89 e7             	mov    %r12d,%edi
+  800706:	41 ff d6             	call   *%r14
+  800709:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80070d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800710:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800713:	75 eb                	jne    800700 <vprintfmt+0x2bf>
+  800715:	e9 72 ff ff ff       	jmp    80068c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80071a:	0f b6 f8             	movzbl %al,%edi
+  80071d:	4c 89 ee             	mov    %r13,%rsi
+  800720:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800723:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800727:	49 83 c4 01          	add    $0x1,%r12
+  80072b:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800731:	84 c0                	test   %al,%al
+  800733:	0f 84 66 ff ff ff    	je     80069f <vprintfmt+0x25e>
+  800739:	45 85 ff             	test   %r15d,%r15d
+  80073c:	78 0a                	js     800748 <vprintfmt+0x307>
+  80073e:	41 83 ef 01          	sub    $0x1,%r15d
+  800742:	0f 88 57 ff ff ff    	js     80069f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800748:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80074c:	74 cc                	je     80071a <vprintfmt+0x2d9>
+  80074e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800751:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800756:	80 fa 5e             	cmp    $0x5e,%dl
+  800759:	77 c2                	ja     80071d <vprintfmt+0x2dc>
+  80075b:	eb bd                	jmp    80071a <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80075d:	40 84 f6             	test   %sil,%sil
+  800760:	75 26                	jne    800788 <vprintfmt+0x347>
+    switch (lflag) {
+  800762:	85 d2                	test   %edx,%edx
+  800764:	74 59                	je     8007bf <vprintfmt+0x37e>
+  800766:	83 fa 01             	cmp    $0x1,%edx
+  800769:	74 7b                	je     8007e6 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80076b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80076e:	83 f8 2f             	cmp    $0x2f,%eax
+  800771:	0f 87 96 00 00 00    	ja     80080d <vprintfmt+0x3cc>
+  800777:	89 c2                	mov    %eax,%edx
+  800779:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80077d:	83 c0 08             	add    $0x8,%eax
+  800780:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800783:	4c 8b 22             	mov    (%rdx),%r12
+  800786:	eb 17                	jmp    80079f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800788:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078b:	83 f8 2f             	cmp    $0x2f,%eax
+  80078e:	77 21                	ja     8007b1 <vprintfmt+0x370>
+  800790:	89 c2                	mov    %eax,%edx
+  800792:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800796:	83 c0 08             	add    $0x8,%eax
+  800799:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80079f:	4d 85 e4             	test   %r12,%r12
+  8007a2:	78 7a                	js     80081e <vprintfmt+0x3dd>
+            num = i;
+  8007a4:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007a7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007ac:	e9 50 02 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007b1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007bd:	eb dd                	jmp    80079c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007bf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c2:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c5:	77 11                	ja     8007d8 <vprintfmt+0x397>
+  8007c7:	89 c2                	mov    %eax,%edx
+  8007c9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007cd:	83 c0 08             	add    $0x8,%eax
+  8007d0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d3:	4c 63 22             	movslq (%rdx),%r12
+  8007d6:	eb c7                	jmp    80079f <vprintfmt+0x35e>
+  8007d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e4:	eb ed                	jmp    8007d3 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007e6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e9:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ec:	77 11                	ja     8007ff <vprintfmt+0x3be>
+  8007ee:	89 c2                	mov    %eax,%edx
+  8007f0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007f4:	83 c0 08             	add    $0x8,%eax
+  8007f7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007fa:	4c 8b 22             	mov    (%rdx),%r12
+  8007fd:	eb a0                	jmp    80079f <vprintfmt+0x35e>
+  8007ff:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800803:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800807:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80080b:	eb ed                	jmp    8007fa <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80080d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800811:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800815:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800819:	e9 65 ff ff ff       	jmp    800783 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80081e:	4c 89 ee             	mov    %r13,%rsi
+  800821:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800826:	41 ff d6             	call   *%r14
+                i = -i;
+  800829:	49 f7 dc             	neg    %r12
+  80082c:	e9 73 ff ff ff       	jmp    8007a4 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800831:	40 84 f6             	test   %sil,%sil
+  800834:	75 32                	jne    800868 <vprintfmt+0x427>
+    switch (lflag) {
+  800836:	85 d2                	test   %edx,%edx
+  800838:	74 5d                	je     800897 <vprintfmt+0x456>
+  80083a:	83 fa 01             	cmp    $0x1,%edx
+  80083d:	0f 84 82 00 00 00    	je     8008c5 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800843:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800846:	83 f8 2f             	cmp    $0x2f,%eax
+  800849:	0f 87 a5 00 00 00    	ja     8008f4 <vprintfmt+0x4b3>
+  80084f:	89 c2                	mov    %eax,%edx
+  800851:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800855:	83 c0 08             	add    $0x8,%eax
+  800858:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80085e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800863:	e9 99 01 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800868:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086b:	83 f8 2f             	cmp    $0x2f,%eax
+  80086e:	77 19                	ja     800889 <vprintfmt+0x448>
+  800870:	89 c2                	mov    %eax,%edx
+  800872:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800876:	83 c0 08             	add    $0x8,%eax
+  800879:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80087f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800884:	e9 78 01 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+  800889:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800891:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800895:	eb e5                	jmp    80087c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800897:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089a:	83 f8 2f             	cmp    $0x2f,%eax
+  80089d:	77 18                	ja     8008b7 <vprintfmt+0x476>
+  80089f:	89 c2                	mov    %eax,%edx
+  8008a1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a5:	83 c0 08             	add    $0x8,%eax
+  8008a8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ab:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008b2:	e9 4a 01 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+  8008b7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008bb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c3:	eb e6                	jmp    8008ab <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8008cb:	77 19                	ja     8008e6 <vprintfmt+0x4a5>
+  8008cd:	89 c2                	mov    %eax,%edx
+  8008cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d3:	83 c0 08             	add    $0x8,%eax
+  8008d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008d9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008dc:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008e1:	e9 1b 01 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+  8008e6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ea:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ee:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f2:	eb e5                	jmp    8008d9 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008f4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008f8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800900:	e9 56 ff ff ff       	jmp    80085b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800905:	40 84 f6             	test   %sil,%sil
+  800908:	75 2e                	jne    800938 <vprintfmt+0x4f7>
+    switch (lflag) {
+  80090a:	85 d2                	test   %edx,%edx
+  80090c:	74 59                	je     800967 <vprintfmt+0x526>
+  80090e:	83 fa 01             	cmp    $0x1,%edx
+  800911:	74 7f                	je     800992 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800913:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800916:	83 f8 2f             	cmp    $0x2f,%eax
+  800919:	0f 87 9f 00 00 00    	ja     8009be <vprintfmt+0x57d>
+  80091f:	89 c2                	mov    %eax,%edx
+  800921:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800925:	83 c0 08             	add    $0x8,%eax
+  800928:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80092b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80092e:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800933:	e9 c9 00 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800938:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093b:	83 f8 2f             	cmp    $0x2f,%eax
+  80093e:	77 19                	ja     800959 <vprintfmt+0x518>
+  800940:	89 c2                	mov    %eax,%edx
+  800942:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800946:	83 c0 08             	add    $0x8,%eax
+  800949:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80094f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800954:	e9 a8 00 00 00       	jmp    800a01 <vprintfmt+0x5c0>
+  800959:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800961:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800965:	eb e5                	jmp    80094c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800967:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80096a:	83 f8 2f             	cmp    $0x2f,%eax
+  80096d:	77 15                	ja     800984 <vprintfmt+0x543>
+  80096f:	89 c2                	mov    %eax,%edx
+  800971:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800975:	83 c0 08             	add    $0x8,%eax
+  800978:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80097d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800982:	eb 7d                	jmp    800a01 <vprintfmt+0x5c0>
+  800984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800990:	eb e9                	jmp    80097b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800992:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800995:	83 f8 2f             	cmp    $0x2f,%eax
+  800998:	77 16                	ja     8009b0 <vprintfmt+0x56f>
+  80099a:	89 c2                	mov    %eax,%edx
+  80099c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009a0:	83 c0 08             	add    $0x8,%eax
+  8009a3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009a9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009ae:	eb 51                	jmp    800a01 <vprintfmt+0x5c0>
+  8009b0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009b8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009bc:	eb e8                	jmp    8009a6 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ca:	e9 5c ff ff ff       	jmp    80092b <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009cf:	4c 89 ee             	mov    %r13,%rsi
+  8009d2:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009d7:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009da:	4c 89 ee             	mov    %r13,%rsi
+  8009dd:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009e2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009e5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009e8:	83 f8 2f             	cmp    $0x2f,%eax
+  8009eb:	77 47                	ja     800a34 <vprintfmt+0x5f3>
+  8009ed:	89 c2                	mov    %eax,%edx
+  8009ef:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009f3:	83 c0 08             	add    $0x8,%eax
+  8009f6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009f9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009fc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a01:	48 83 ec 08          	sub    $0x8,%rsp
+  800a05:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a09:	0f 94 c0             	sete   %al
+  800a0c:	0f b6 c0             	movzbl %al,%eax
+  800a0f:	50                   	push   %rax
+  800a10:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a15:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a19:	4c 89 ee             	mov    %r13,%rsi
+  800a1c:	4c 89 f7             	mov    %r14,%rdi
+  800a1f:	48 b8 36 03 80 00 00 	movabs $0x800336,%rax
+  800a26:	00 00 00 
+  800a29:	ff d0                	call   *%rax
+            break;
+  800a2b:	48 83 c4 10          	add    $0x10,%rsp
+  800a2f:	e9 3e fa ff ff       	jmp    800472 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a34:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a38:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a3c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a40:	eb b7                	jmp    8009f9 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a42:	40 84 f6             	test   %sil,%sil
+  800a45:	75 2b                	jne    800a72 <vprintfmt+0x631>
+    switch (lflag) {
+  800a47:	85 d2                	test   %edx,%edx
+  800a49:	74 56                	je     800aa1 <vprintfmt+0x660>
+  800a4b:	83 fa 01             	cmp    $0x1,%edx
+  800a4e:	74 7f                	je     800acf <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a50:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a53:	83 f8 2f             	cmp    $0x2f,%eax
+  800a56:	0f 87 a2 00 00 00    	ja     800afe <vprintfmt+0x6bd>
+  800a5c:	89 c2                	mov    %eax,%edx
+  800a5e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a62:	83 c0 08             	add    $0x8,%eax
+  800a65:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a68:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a6b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a70:	eb 8f                	jmp    800a01 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	77 19                	ja     800a93 <vprintfmt+0x652>
+  800a7a:	89 c2                	mov    %eax,%edx
+  800a7c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a80:	83 c0 08             	add    $0x8,%eax
+  800a83:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a86:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a89:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a8e:	e9 6e ff ff ff       	jmp    800a01 <vprintfmt+0x5c0>
+  800a93:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a97:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a9f:	eb e5                	jmp    800a86 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800aa1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa4:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa7:	77 18                	ja     800ac1 <vprintfmt+0x680>
+  800aa9:	89 c2                	mov    %eax,%edx
+  800aab:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aaf:	83 c0 08             	add    $0x8,%eax
+  800ab2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab5:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ab7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800abc:	e9 40 ff ff ff       	jmp    800a01 <vprintfmt+0x5c0>
+  800ac1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800acd:	eb e6                	jmp    800ab5 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800acf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad2:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad5:	77 19                	ja     800af0 <vprintfmt+0x6af>
+  800ad7:	89 c2                	mov    %eax,%edx
+  800ad9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800add:	83 c0 08             	add    $0x8,%eax
+  800ae0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ae6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800aeb:	e9 11 ff ff ff       	jmp    800a01 <vprintfmt+0x5c0>
+  800af0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800afc:	eb e5                	jmp    800ae3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800afe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b02:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b06:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b0a:	e9 59 ff ff ff       	jmp    800a68 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b0f:	4c 89 ee             	mov    %r13,%rsi
+  800b12:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b17:	41 ff d6             	call   *%r14
+            break;
+  800b1a:	e9 53 f9 ff ff       	jmp    800472 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b1f:	4c 89 ee             	mov    %r13,%rsi
+  800b22:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b27:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b2a:	48 83 eb 01          	sub    $0x1,%rbx
+  800b2e:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b32:	75 f6                	jne    800b2a <vprintfmt+0x6e9>
+  800b34:	e9 39 f9 ff ff       	jmp    800472 <vprintfmt+0x31>
+}
+  800b39:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b3d:	5b                   	pop    %rbx
+  800b3e:	41 5c                	pop    %r12
+  800b40:	41 5d                	pop    %r13
+  800b42:	41 5e                	pop    %r14
+  800b44:	41 5f                	pop    %r15
+  800b46:	5d                   	pop    %rbp
+  800b47:	c3                   	ret
+
+0000000000800b48 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b48:	55                   	push   %rbp
+  800b49:	48 89 e5             	mov    %rsp,%rbp
+  800b4c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b50:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b54:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b59:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b5d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b64:	48 85 ff             	test   %rdi,%rdi
+  800b67:	74 2b                	je     800b94 <vsnprintf+0x4c>
+  800b69:	48 85 f6             	test   %rsi,%rsi
+  800b6c:	74 26                	je     800b94 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b6e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b72:	48 bf ec 03 80 00 00 	movabs $0x8003ec,%rdi
+  800b79:	00 00 00 
+  800b7c:	48 b8 41 04 80 00 00 	movabs $0x800441,%rax
+  800b83:	00 00 00 
+  800b86:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b88:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b8c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b8f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b92:	c9                   	leave
+  800b93:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b94:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b99:	eb f7                	jmp    800b92 <vsnprintf+0x4a>
+
+0000000000800b9b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b9b:	55                   	push   %rbp
+  800b9c:	48 89 e5             	mov    %rsp,%rbp
+  800b9f:	48 83 ec 50          	sub    $0x50,%rsp
+  800ba3:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ba7:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bab:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800baf:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bb6:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbe:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bc2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800bc6:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bca:	48 b8 48 0b 80 00 00 	movabs $0x800b48,%rax
+  800bd1:	00 00 00 
+  800bd4:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bd6:	c9                   	leave
+  800bd7:	c3                   	ret
+
+0000000000800bd8 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bd8:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bdb:	74 10                	je     800bed <strlen+0x15>
+    size_t n = 0;
+  800bdd:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800be2:	48 83 c0 01          	add    $0x1,%rax
+  800be6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bea:	75 f6                	jne    800be2 <strlen+0xa>
+  800bec:	c3                   	ret
+    size_t n = 0;
+  800bed:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bf2:	c3                   	ret
+
+0000000000800bf3 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bf3:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bfb:	48 85 f6             	test   %rsi,%rsi
+  800bfe:	74 11                	je     800c11 <strnlen+0x1e>
+  800c00:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c04:	74 0c                	je     800c12 <strnlen+0x1f>
+  800c06:	48 83 c2 01          	add    $0x1,%rdx
+  800c0a:	48 39 d0             	cmp    %rdx,%rax
+  800c0d:	75 f1                	jne    800c00 <strnlen+0xd>
+  800c0f:	eb 04                	jmp    800c15 <strnlen+0x22>
+  800c11:	c3                   	ret
+  800c12:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c15:	c3                   	ret
+
+0000000000800c16 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c16:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c19:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c1e:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c22:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c25:	48 83 c2 01          	add    $0x1,%rdx
+  800c29:	84 c9                	test   %cl,%cl
+  800c2b:	75 f1                	jne    800c1e <strcpy+0x8>
+        ;
+    return res;
+}
+  800c2d:	c3                   	ret
+
+0000000000800c2e <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c2e:	55                   	push   %rbp
+  800c2f:	48 89 e5             	mov    %rsp,%rbp
+  800c32:	41 54                	push   %r12
+  800c34:	53                   	push   %rbx
+  800c35:	48 89 fb             	mov    %rdi,%rbx
+  800c38:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c3b:	48 b8 d8 0b 80 00 00 	movabs $0x800bd8,%rax
+  800c42:	00 00 00 
+  800c45:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c47:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c4b:	4c 89 e6             	mov    %r12,%rsi
+  800c4e:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  800c55:	00 00 00 
+  800c58:	ff d0                	call   *%rax
+    return dst;
+}
+  800c5a:	48 89 d8             	mov    %rbx,%rax
+  800c5d:	5b                   	pop    %rbx
+  800c5e:	41 5c                	pop    %r12
+  800c60:	5d                   	pop    %rbp
+  800c61:	c3                   	ret
+
+0000000000800c62 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c62:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c65:	48 85 d2             	test   %rdx,%rdx
+  800c68:	74 1f                	je     800c89 <strncpy+0x27>
+  800c6a:	48 01 fa             	add    %rdi,%rdx
+  800c6d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c70:	48 83 c1 01          	add    $0x1,%rcx
+  800c74:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c78:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c7c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c80:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c84:	48 39 ca             	cmp    %rcx,%rdx
+  800c87:	75 e7                	jne    800c70 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c89:	c3                   	ret
+
+0000000000800c8a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c8a:	48 89 f8             	mov    %rdi,%rax
+  800c8d:	48 85 d2             	test   %rdx,%rdx
+  800c90:	74 24                	je     800cb6 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c92:	48 83 ea 01          	sub    $0x1,%rdx
+  800c96:	74 1b                	je     800cb3 <strlcpy+0x29>
+  800c98:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c9c:	0f b6 16             	movzbl (%rsi),%edx
+  800c9f:	84 d2                	test   %dl,%dl
+  800ca1:	74 10                	je     800cb3 <strlcpy+0x29>
+            *dst++ = *src++;
+  800ca3:	48 83 c6 01          	add    $0x1,%rsi
+  800ca7:	48 83 c0 01          	add    $0x1,%rax
+  800cab:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cae:	48 39 c8             	cmp    %rcx,%rax
+  800cb1:	75 e9                	jne    800c9c <strlcpy+0x12>
+        *dst = '\0';
+  800cb3:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cb6:	48 29 f8             	sub    %rdi,%rax
+}
+  800cb9:	c3                   	ret
+
+0000000000800cba <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cba:	0f b6 07             	movzbl (%rdi),%eax
+  800cbd:	84 c0                	test   %al,%al
+  800cbf:	74 13                	je     800cd4 <strcmp+0x1a>
+  800cc1:	38 06                	cmp    %al,(%rsi)
+  800cc3:	75 0f                	jne    800cd4 <strcmp+0x1a>
+  800cc5:	48 83 c7 01          	add    $0x1,%rdi
+  800cc9:	48 83 c6 01          	add    $0x1,%rsi
+  800ccd:	0f b6 07             	movzbl (%rdi),%eax
+  800cd0:	84 c0                	test   %al,%al
+  800cd2:	75 ed                	jne    800cc1 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cd4:	0f b6 c0             	movzbl %al,%eax
+  800cd7:	0f b6 16             	movzbl (%rsi),%edx
+  800cda:	29 d0                	sub    %edx,%eax
+}
+  800cdc:	c3                   	ret
+
+0000000000800cdd <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cdd:	48 85 d2             	test   %rdx,%rdx
+  800ce0:	74 1f                	je     800d01 <strncmp+0x24>
+  800ce2:	0f b6 07             	movzbl (%rdi),%eax
+  800ce5:	84 c0                	test   %al,%al
+  800ce7:	74 1e                	je     800d07 <strncmp+0x2a>
+  800ce9:	3a 06                	cmp    (%rsi),%al
+  800ceb:	75 1a                	jne    800d07 <strncmp+0x2a>
+  800ced:	48 83 c7 01          	add    $0x1,%rdi
+  800cf1:	48 83 c6 01          	add    $0x1,%rsi
+  800cf5:	48 83 ea 01          	sub    $0x1,%rdx
+  800cf9:	75 e7                	jne    800ce2 <strncmp+0x5>
+
+    if (!n) return 0;
+  800cfb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d00:	c3                   	ret
+  800d01:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d06:	c3                   	ret
+  800d07:	48 85 d2             	test   %rdx,%rdx
+  800d0a:	74 09                	je     800d15 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d0c:	0f b6 07             	movzbl (%rdi),%eax
+  800d0f:	0f b6 16             	movzbl (%rsi),%edx
+  800d12:	29 d0                	sub    %edx,%eax
+  800d14:	c3                   	ret
+    if (!n) return 0;
+  800d15:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d1a:	c3                   	ret
+
+0000000000800d1b <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d1b:	0f b6 17             	movzbl (%rdi),%edx
+  800d1e:	84 d2                	test   %dl,%dl
+  800d20:	74 18                	je     800d3a <strchr+0x1f>
+        if (*str == c) {
+  800d22:	0f be d2             	movsbl %dl,%edx
+  800d25:	39 f2                	cmp    %esi,%edx
+  800d27:	74 17                	je     800d40 <strchr+0x25>
+    for (; *str; str++) {
+  800d29:	48 83 c7 01          	add    $0x1,%rdi
+  800d2d:	0f b6 17             	movzbl (%rdi),%edx
+  800d30:	84 d2                	test   %dl,%dl
+  800d32:	75 ee                	jne    800d22 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d34:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d39:	c3                   	ret
+  800d3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d3f:	c3                   	ret
+  800d40:	48 89 f8             	mov    %rdi,%rax
+}
+  800d43:	c3                   	ret
+
+0000000000800d44 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d44:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d47:	0f b6 17             	movzbl (%rdi),%edx
+  800d4a:	84 d2                	test   %dl,%dl
+  800d4c:	74 13                	je     800d61 <strfind+0x1d>
+  800d4e:	0f be d2             	movsbl %dl,%edx
+  800d51:	39 f2                	cmp    %esi,%edx
+  800d53:	74 0b                	je     800d60 <strfind+0x1c>
+  800d55:	48 83 c0 01          	add    $0x1,%rax
+  800d59:	0f b6 10             	movzbl (%rax),%edx
+  800d5c:	84 d2                	test   %dl,%dl
+  800d5e:	75 ee                	jne    800d4e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d60:	c3                   	ret
+  800d61:	c3                   	ret
+
+0000000000800d62 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d62:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d65:	48 89 f8             	mov    %rdi,%rax
+  800d68:	48 f7 d8             	neg    %rax
+  800d6b:	83 e0 07             	and    $0x7,%eax
+  800d6e:	49 89 d1             	mov    %rdx,%r9
+  800d71:	49 29 c1             	sub    %rax,%r9
+  800d74:	78 36                	js     800dac <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d76:	40 0f b6 c6          	movzbl %sil,%eax
+  800d7a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d81:	01 01 01 
+  800d84:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d88:	40 f6 c7 07          	test   $0x7,%dil
+  800d8c:	75 38                	jne    800dc6 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d8e:	4c 89 c9             	mov    %r9,%rcx
+  800d91:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d95:	74 0c                	je     800da3 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d97:	fc                   	cld
+  800d98:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d9b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d9f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800da3:	4d 85 c9             	test   %r9,%r9
+  800da6:	75 45                	jne    800ded <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800da8:	4c 89 c0             	mov    %r8,%rax
+  800dab:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dac:	48 85 d2             	test   %rdx,%rdx
+  800daf:	74 f7                	je     800da8 <memset+0x46>
+  800db1:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800db4:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800db7:	48 83 c0 01          	add    $0x1,%rax
+  800dbb:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dbf:	48 39 c2             	cmp    %rax,%rdx
+  800dc2:	75 f3                	jne    800db7 <memset+0x55>
+  800dc4:	eb e2                	jmp    800da8 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800dc6:	40 f6 c7 01          	test   $0x1,%dil
+  800dca:	74 06                	je     800dd2 <memset+0x70>
+  800dcc:	88 07                	mov    %al,(%rdi)
+  800dce:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dd2:	40 f6 c7 02          	test   $0x2,%dil
+  800dd6:	74 07                	je     800ddf <memset+0x7d>
+  800dd8:	66 89 07             	mov    %ax,(%rdi)
+  800ddb:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ddf:	40 f6 c7 04          	test   $0x4,%dil
+  800de3:	74 a9                	je     800d8e <memset+0x2c>
+  800de5:	89 07                	mov    %eax,(%rdi)
+  800de7:	48 83 c7 04          	add    $0x4,%rdi
+  800deb:	eb a1                	jmp    800d8e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ded:	41 f6 c1 04          	test   $0x4,%r9b
+  800df1:	74 06                	je     800df9 <memset+0x97>
+  800df3:	89 07                	mov    %eax,(%rdi)
+  800df5:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800df9:	41 f6 c1 02          	test   $0x2,%r9b
+  800dfd:	74 07                	je     800e06 <memset+0xa4>
+  800dff:	66 89 07             	mov    %ax,(%rdi)
+  800e02:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e06:	41 f6 c1 01          	test   $0x1,%r9b
+  800e0a:	74 9c                	je     800da8 <memset+0x46>
+  800e0c:	88 07                	mov    %al,(%rdi)
+  800e0e:	eb 98                	jmp    800da8 <memset+0x46>
+
+0000000000800e10 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e10:	48 89 f8             	mov    %rdi,%rax
+  800e13:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e16:	48 39 fe             	cmp    %rdi,%rsi
+  800e19:	73 3b                	jae    800e56 <memmove+0x46>
+  800e1b:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e1f:	48 39 d7             	cmp    %rdx,%rdi
+  800e22:	73 32                	jae    800e56 <memmove+0x46>
+        s += n;
+        d += n;
+  800e24:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e28:	48 89 d6             	mov    %rdx,%rsi
+  800e2b:	48 09 fe             	or     %rdi,%rsi
+  800e2e:	48 09 ce             	or     %rcx,%rsi
+  800e31:	40 f6 c6 07          	test   $0x7,%sil
+  800e35:	75 12                	jne    800e49 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e37:	48 83 ef 08          	sub    $0x8,%rdi
+  800e3b:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e3f:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e43:	fd                   	std
+  800e44:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e47:	fc                   	cld
+  800e48:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e49:	48 83 ef 01          	sub    $0x1,%rdi
+  800e4d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e51:	fd                   	std
+  800e52:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e54:	eb f1                	jmp    800e47 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e56:	48 89 f2             	mov    %rsi,%rdx
+  800e59:	48 09 c2             	or     %rax,%rdx
+  800e5c:	48 09 ca             	or     %rcx,%rdx
+  800e5f:	f6 c2 07             	test   $0x7,%dl
+  800e62:	75 0c                	jne    800e70 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e64:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e68:	48 89 c7             	mov    %rax,%rdi
+  800e6b:	fc                   	cld
+  800e6c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e6f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e70:	48 89 c7             	mov    %rax,%rdi
+  800e73:	fc                   	cld
+  800e74:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e76:	c3                   	ret
+
+0000000000800e77 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e77:	55                   	push   %rbp
+  800e78:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e7b:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  800e82:	00 00 00 
+  800e85:	ff d0                	call   *%rax
+}
+  800e87:	5d                   	pop    %rbp
+  800e88:	c3                   	ret
+
+0000000000800e89 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e89:	55                   	push   %rbp
+  800e8a:	48 89 e5             	mov    %rsp,%rbp
+  800e8d:	41 57                	push   %r15
+  800e8f:	41 56                	push   %r14
+  800e91:	41 55                	push   %r13
+  800e93:	41 54                	push   %r12
+  800e95:	53                   	push   %rbx
+  800e96:	48 83 ec 08          	sub    $0x8,%rsp
+  800e9a:	49 89 fe             	mov    %rdi,%r14
+  800e9d:	49 89 f7             	mov    %rsi,%r15
+  800ea0:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ea3:	48 89 f7             	mov    %rsi,%rdi
+  800ea6:	48 b8 d8 0b 80 00 00 	movabs $0x800bd8,%rax
+  800ead:	00 00 00 
+  800eb0:	ff d0                	call   *%rax
+  800eb2:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800eb5:	48 89 de             	mov    %rbx,%rsi
+  800eb8:	4c 89 f7             	mov    %r14,%rdi
+  800ebb:	48 b8 f3 0b 80 00 00 	movabs $0x800bf3,%rax
+  800ec2:	00 00 00 
+  800ec5:	ff d0                	call   *%rax
+  800ec7:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eca:	48 39 c3             	cmp    %rax,%rbx
+  800ecd:	74 36                	je     800f05 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ecf:	48 89 d8             	mov    %rbx,%rax
+  800ed2:	4c 29 e8             	sub    %r13,%rax
+  800ed5:	49 39 c4             	cmp    %rax,%r12
+  800ed8:	73 31                	jae    800f0b <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800eda:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800edf:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ee3:	4c 89 fe             	mov    %r15,%rsi
+  800ee6:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  800eed:	00 00 00 
+  800ef0:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ef2:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ef6:	48 83 c4 08          	add    $0x8,%rsp
+  800efa:	5b                   	pop    %rbx
+  800efb:	41 5c                	pop    %r12
+  800efd:	41 5d                	pop    %r13
+  800eff:	41 5e                	pop    %r14
+  800f01:	41 5f                	pop    %r15
+  800f03:	5d                   	pop    %rbp
+  800f04:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f05:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f09:	eb eb                	jmp    800ef6 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f0b:	48 83 eb 01          	sub    $0x1,%rbx
+  800f0f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f13:	48 89 da             	mov    %rbx,%rdx
+  800f16:	4c 89 fe             	mov    %r15,%rsi
+  800f19:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  800f20:	00 00 00 
+  800f23:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f25:	49 01 de             	add    %rbx,%r14
+  800f28:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f2d:	eb c3                	jmp    800ef2 <strlcat+0x69>
+
+0000000000800f2f <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f2f:	48 85 d2             	test   %rdx,%rdx
+  800f32:	74 2d                	je     800f61 <memcmp+0x32>
+  800f34:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f39:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f3d:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f42:	44 38 c1             	cmp    %r8b,%cl
+  800f45:	75 0f                	jne    800f56 <memcmp+0x27>
+    while (n-- > 0) {
+  800f47:	48 83 c0 01          	add    $0x1,%rax
+  800f4b:	48 39 c2             	cmp    %rax,%rdx
+  800f4e:	75 e9                	jne    800f39 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f50:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f55:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f56:	0f b6 c1             	movzbl %cl,%eax
+  800f59:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f5d:	44 29 c0             	sub    %r8d,%eax
+  800f60:	c3                   	ret
+    return 0;
+  800f61:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f66:	c3                   	ret
+
+0000000000800f67 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f67:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f6b:	48 39 c7             	cmp    %rax,%rdi
+  800f6e:	73 0f                	jae    800f7f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f70:	40 38 37             	cmp    %sil,(%rdi)
+  800f73:	74 0e                	je     800f83 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f75:	48 83 c7 01          	add    $0x1,%rdi
+  800f79:	48 39 f8             	cmp    %rdi,%rax
+  800f7c:	75 f2                	jne    800f70 <memfind+0x9>
+  800f7e:	c3                   	ret
+  800f7f:	48 89 f8             	mov    %rdi,%rax
+  800f82:	c3                   	ret
+  800f83:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f86:	c3                   	ret
+
+0000000000800f87 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f87:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f8a:	0f b6 37             	movzbl (%rdi),%esi
+  800f8d:	40 80 fe 20          	cmp    $0x20,%sil
+  800f91:	74 06                	je     800f99 <strtol+0x12>
+  800f93:	40 80 fe 09          	cmp    $0x9,%sil
+  800f97:	75 13                	jne    800fac <strtol+0x25>
+  800f99:	48 83 c7 01          	add    $0x1,%rdi
+  800f9d:	0f b6 37             	movzbl (%rdi),%esi
+  800fa0:	40 80 fe 20          	cmp    $0x20,%sil
+  800fa4:	74 f3                	je     800f99 <strtol+0x12>
+  800fa6:	40 80 fe 09          	cmp    $0x9,%sil
+  800faa:	74 ed                	je     800f99 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fac:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800faf:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fb2:	3c 01                	cmp    $0x1,%al
+  800fb4:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fb8:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fbe:	75 0f                	jne    800fcf <strtol+0x48>
+  800fc0:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fc3:	74 14                	je     800fd9 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fc5:	85 d2                	test   %edx,%edx
+  800fc7:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fcc:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fcf:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fd4:	4c 63 ca             	movslq %edx,%r9
+  800fd7:	eb 36                	jmp    80100f <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd9:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fdd:	74 0f                	je     800fee <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fdf:	85 d2                	test   %edx,%edx
+  800fe1:	75 ec                	jne    800fcf <strtol+0x48>
+        s++;
+  800fe3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fe7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fec:	eb e1                	jmp    800fcf <strtol+0x48>
+        s += 2;
+  800fee:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800ff2:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800ff7:	eb d6                	jmp    800fcf <strtol+0x48>
+            dig -= '0';
+  800ff9:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800ffc:	44 0f b6 c1          	movzbl %cl,%r8d
+  801000:	41 39 d0             	cmp    %edx,%r8d
+  801003:	7d 21                	jge    801026 <strtol+0x9f>
+        val = val * base + dig;
+  801005:	49 0f af c1          	imul   %r9,%rax
+  801009:	0f b6 c9             	movzbl %cl,%ecx
+  80100c:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80100f:	48 83 c7 01          	add    $0x1,%rdi
+  801013:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801017:	80 f9 39             	cmp    $0x39,%cl
+  80101a:	76 dd                	jbe    800ff9 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80101c:	80 f9 7b             	cmp    $0x7b,%cl
+  80101f:	77 05                	ja     801026 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801021:	83 e9 57             	sub    $0x57,%ecx
+  801024:	eb d6                	jmp    800ffc <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801026:	4d 85 d2             	test   %r10,%r10
+  801029:	74 03                	je     80102e <strtol+0xa7>
+  80102b:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80102e:	48 89 c2             	mov    %rax,%rdx
+  801031:	48 f7 da             	neg    %rdx
+  801034:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801038:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80103c:	c3                   	ret
+
+000000000080103d <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80103d:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801042:	ba 00 00 00 00       	mov    $0x0,%edx
+  801047:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80104d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801053:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801059:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80105b:	c3                   	ret
+
+000000000080105c <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80105c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801061:	bf 00 00 00 00       	mov    $0x0,%edi
+  801066:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80106b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801070:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801076:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80107c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801082:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801084:	c3                   	ret
+
+0000000000801085 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801085:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801088:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80108d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801092:	ba 00 00 00 00       	mov    $0x0,%edx
+  801097:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80109d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010a3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010a9:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010ab:	48 85 c0             	test   %rax,%rax
+  8010ae:	7f 01                	jg     8010b1 <sys_env_destroy+0x2c>
+}
+  8010b0:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8010b1:	55                   	push   %rbp
+  8010b2:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010b5:	49 89 c0             	mov    %rax,%r8
+  8010b8:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010bd:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8010c4:	00 00 00 
+  8010c7:	be 29 00 00 00       	mov    $0x29,%esi
+  8010cc:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8010d3:	00 00 00 
+  8010d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010db:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  8010e2:	00 00 00 
+  8010e5:	41 ff d1             	call   *%r9
+
+00000000008010e8 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010e8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010ed:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010f2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010fc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801102:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801108:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110e:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801110:	c3                   	ret
+
+0000000000801111 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801111:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801116:	bf 00 00 00 00       	mov    $0x0,%edi
+  80111b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801120:	ba 00 00 00 00       	mov    $0x0,%edx
+  801125:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80112b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801131:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801137:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801139:	c3                   	ret
+
+000000000080113a <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80113a:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80113f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801146:	00 00 00 
+  801149:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80114f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801155:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80115b:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80115d:	c3                   	ret
+
+000000000080115e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80115e:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801161:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801166:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80116c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801172:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801174:	c3                   	ret
+
+0000000000801175 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801175:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801178:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80117d:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80118c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80118e:	48 85 c0             	test   %rax,%rax
+  801191:	7f 01                	jg     801194 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801193:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801194:	55                   	push   %rbp
+  801195:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801198:	49 89 c0             	mov    %rax,%r8
+  80119b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011a0:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8011a7:	00 00 00 
+  8011aa:	be 29 00 00 00       	mov    $0x29,%esi
+  8011af:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8011b6:	00 00 00 
+  8011b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011be:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  8011c5:	00 00 00 
+  8011c8:	41 ff d1             	call   *%r9
+
+00000000008011cb <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011cb:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011ce:	48 63 d2             	movslq %edx,%rdx
+  8011d1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011d4:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011d9:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011dc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011de:	48 85 c0             	test   %rax,%rax
+  8011e1:	7f 01                	jg     8011e4 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011e3:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e4:	55                   	push   %rbp
+  8011e5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011e8:	49 89 c0             	mov    %rax,%r8
+  8011eb:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011f0:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8011f7:	00 00 00 
+  8011fa:	be 29 00 00 00       	mov    $0x29,%esi
+  8011ff:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  801206:	00 00 00 
+  801209:	b8 00 00 00 00       	mov    $0x0,%eax
+  80120e:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  801215:	00 00 00 
+  801218:	41 ff d1             	call   *%r9
+
+000000000080121b <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80121b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80121e:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801223:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801229:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80122f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801235:	0f 05                	syscall
+    if (check && ret > 0) {
+  801237:	48 85 c0             	test   %rax,%rax
+  80123a:	7f 01                	jg     80123d <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80123c:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80123d:	55                   	push   %rbp
+  80123e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801241:	49 89 c0             	mov    %rax,%r8
+  801244:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801249:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801250:	00 00 00 
+  801253:	be 29 00 00 00       	mov    $0x29,%esi
+  801258:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80125f:	00 00 00 
+  801262:	b8 00 00 00 00       	mov    $0x0,%eax
+  801267:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  80126e:	00 00 00 
+  801271:	41 ff d1             	call   *%r9
+
+0000000000801274 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801274:	48 63 f6             	movslq %esi,%rsi
+  801277:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80127a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80127f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801284:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80128a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801290:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801296:	0f 05                	syscall
+    if (check && ret > 0) {
+  801298:	48 85 c0             	test   %rax,%rax
+  80129b:	7f 01                	jg     80129e <sys_env_set_status+0x2a>
+}
+  80129d:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80129e:	55                   	push   %rbp
+  80129f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a2:	49 89 c0             	mov    %rax,%r8
+  8012a5:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012aa:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8012b1:	00 00 00 
+  8012b4:	be 29 00 00 00       	mov    $0x29,%esi
+  8012b9:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8012c0:	00 00 00 
+  8012c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012c8:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  8012cf:	00 00 00 
+  8012d2:	41 ff d1             	call   *%r9
+
+00000000008012d5 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8012d5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012d8:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012f4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012f6:	48 85 c0             	test   %rax,%rax
+  8012f9:	7f 01                	jg     8012fc <sys_env_set_trapframe+0x27>
+}
+  8012fb:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8012fc:	55                   	push   %rbp
+  8012fd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801300:	49 89 c0             	mov    %rax,%r8
+  801303:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801308:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  80130f:	00 00 00 
+  801312:	be 29 00 00 00       	mov    $0x29,%esi
+  801317:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80131e:	00 00 00 
+  801321:	b8 00 00 00 00       	mov    $0x0,%eax
+  801326:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  80132d:	00 00 00 
+  801330:	41 ff d1             	call   *%r9
+
+0000000000801333 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801333:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801336:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80133b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801340:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801346:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80134c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801352:	0f 05                	syscall
+    if (check && ret > 0) {
+  801354:	48 85 c0             	test   %rax,%rax
+  801357:	7f 01                	jg     80135a <sys_env_set_pgfault_upcall+0x27>
+}
+  801359:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80135a:	55                   	push   %rbp
+  80135b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135e:	49 89 c0             	mov    %rax,%r8
+  801361:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801366:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  80136d:	00 00 00 
+  801370:	be 29 00 00 00       	mov    $0x29,%esi
+  801375:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80137c:	00 00 00 
+  80137f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801384:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  80138b:	00 00 00 
+  80138e:	41 ff d1             	call   *%r9
+
+0000000000801391 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801391:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801394:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801397:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80139c:	4d 63 c0             	movslq %r8d,%r8
+  80139f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a5:	0f 05                	syscall
+}
+  8013a7:	c3                   	ret
+
+00000000008013a8 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013a8:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013ab:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013ae:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b3:	4d 63 c0             	movslq %r8d,%r8
+  8013b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bc:	0f 05                	syscall
+}
+  8013be:	c3                   	ret
+
+00000000008013bf <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013bf:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013c4:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013c7:	45 89 c0             	mov    %r8d,%r8d
+  8013ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013d2:	48 85 c0             	test   %rax,%rax
+  8013d5:	7f 01                	jg     8013d8 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8013d7:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013d8:	55                   	push   %rbp
+  8013d9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013dc:	49 89 c0             	mov    %rax,%r8
+  8013df:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013e4:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8013eb:	00 00 00 
+  8013ee:	be 29 00 00 00       	mov    $0x29,%esi
+  8013f3:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8013fa:	00 00 00 
+  8013fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801402:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  801409:	00 00 00 
+  80140c:	41 ff d1             	call   *%r9
+
+000000000080140f <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801413:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801419:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80141e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801423:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  80142a:	00 00 00 
+  80142d:	ff d0                	call   *%rax
+}
+  80142f:	5d                   	pop    %rbp
+  801430:	c3                   	ret
+
+0000000000801431 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801431:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801436:	bf 00 00 00 00       	mov    $0x0,%edi
+  80143b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+  801445:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80144b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801451:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801457:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801459:	c3                   	ret
+
+000000000080145a <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80145a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80145f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801464:	ba 00 00 00 00       	mov    $0x0,%edx
+  801469:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80146f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801475:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80147b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80147d:	48 85 c0             	test   %rax,%rax
+  801480:	7f 01                	jg     801483 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801482:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801483:	55                   	push   %rbp
+  801484:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801487:	49 89 c0             	mov    %rax,%r8
+  80148a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80148f:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801496:	00 00 00 
+  801499:	be 29 00 00 00       	mov    $0x29,%esi
+  80149e:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8014a5:	00 00 00 
+  8014a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014ad:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  8014b4:	00 00 00 
+  8014b7:	41 ff d1             	call   *%r9
+
+00000000008014ba <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014ba:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014c4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e0:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014e2:	c3                   	ret
+
+00000000008014e3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8014e3:	89 d2                	mov    %edx,%edx
+  8014e5:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8014e7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ec:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014fe:	0f 05                	syscall
+}
+  801500:	c3                   	ret
+
+0000000000801501 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801501:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801504:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80150e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801520:	0f 05                	syscall
+}
+  801522:	c3                   	ret
+
+0000000000801523 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801523:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80152b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801530:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801542:	0f 05                	syscall
+}
+  801544:	c3                   	ret
+
+0000000000801545 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801545:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801548:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80154d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801552:	ba 00 00 00 00       	mov    $0x0,%edx
+  801557:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80155d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801563:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801569:	0f 05                	syscall
+    if (check && ret > 0) {
+  80156b:	48 85 c0             	test   %rax,%rax
+  80156e:	7f 01                	jg     801571 <sys_irq_ack+0x2c>
+}
+  801570:	c3                   	ret
+sys_irq_ack(int irq) {
+  801571:	55                   	push   %rbp
+  801572:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801575:	49 89 c0             	mov    %rax,%r8
+  801578:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80157d:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801584:	00 00 00 
+  801587:	be 29 00 00 00       	mov    $0x29,%esi
+  80158c:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  801593:	00 00 00 
+  801596:	b8 00 00 00 00       	mov    $0x0,%eax
+  80159b:	49 b9 b1 45 80 00 00 	movabs $0x8045b1,%r9
+  8015a2:	00 00 00 
+  8015a5:	41 ff d1             	call   *%r9
+
+00000000008015a8 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  8015a8:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  8015ab:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  8015af:	83 3f 01             	cmpl   $0x1,(%rdi)
+  8015b2:	7e 0f                	jle    8015c3 <argstart+0x1b>
+  8015b4:	48 b8 f9 4a 80 00 00 	movabs $0x804af9,%rax
+  8015bb:	00 00 00 
+  8015be:	48 85 f6             	test   %rsi,%rsi
+  8015c1:	75 05                	jne    8015c8 <argstart+0x20>
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015c8:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  8015cc:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  8015d3:	00 
+}
+  8015d4:	c3                   	ret
+
+00000000008015d5 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  8015d5:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8015dc:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  8015dd:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  8015e1:	48 85 c0             	test   %rax,%rax
+  8015e4:	0f 84 8f 00 00 00    	je     801679 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  8015ea:	55                   	push   %rbp
+  8015eb:	48 89 e5             	mov    %rsp,%rbp
+  8015ee:	53                   	push   %rbx
+  8015ef:	48 83 ec 08          	sub    $0x8,%rsp
+  8015f3:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  8015f6:	80 38 00             	cmpb   $0x0,(%rax)
+  8015f9:	75 52                	jne    80164d <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  8015fb:	48 8b 17             	mov    (%rdi),%rdx
+  8015fe:	83 3a 01             	cmpl   $0x1,(%rdx)
+  801601:	74 67                	je     80166a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801603:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  801607:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  80160b:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80160e:	75 5a                	jne    80166a <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  801610:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801614:	74 54                	je     80166a <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  801616:	48 83 c0 01          	add    $0x1,%rax
+  80161a:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80161e:	8b 12                	mov    (%rdx),%edx
+  801620:	83 ea 01             	sub    $0x1,%edx
+  801623:	48 63 d2             	movslq %edx,%rdx
+  801626:	48 c1 e2 03          	shl    $0x3,%rdx
+  80162a:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  80162e:	48 83 c7 08          	add    $0x8,%rdi
+  801632:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  801639:	00 00 00 
+  80163c:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  80163e:	48 8b 03             	mov    (%rbx),%rax
+  801641:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  801644:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801648:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80164b:	74 17                	je     801664 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  80164d:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  801651:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  801654:	48 83 c0 01          	add    $0x1,%rax
+  801658:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  80165c:	89 d0                	mov    %edx,%eax
+  80165e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801662:	c9                   	leave
+  801663:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  801664:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  801668:	75 e3                	jne    80164d <argnext+0x78>
+    args->curarg = 0;
+  80166a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  801671:	00 
+    return -1;
+  801672:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  801677:	eb e3                	jmp    80165c <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  801679:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  80167e:	89 d0                	mov    %edx,%eax
+  801680:	c3                   	ret
+
+0000000000801681 <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  801681:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  801685:	48 85 c0             	test   %rax,%rax
+  801688:	74 7b                	je     801705 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  80168a:	55                   	push   %rbp
+  80168b:	48 89 e5             	mov    %rsp,%rbp
+  80168e:	53                   	push   %rbx
+  80168f:	48 83 ec 08          	sub    $0x8,%rsp
+  801693:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  801696:	80 38 00             	cmpb   $0x0,(%rax)
+  801699:	74 1c                	je     8016b7 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  80169b:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80169f:	48 b8 f9 4a 80 00 00 	movabs $0x804af9,%rax
+  8016a6:	00 00 00 
+  8016a9:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  8016ad:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  8016b1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8016b5:	c9                   	leave
+  8016b6:	c3                   	ret
+    } else if (*args->argc > 1) {
+  8016b7:	48 8b 07             	mov    (%rdi),%rax
+  8016ba:	83 38 01             	cmpl   $0x1,(%rax)
+  8016bd:	7f 12                	jg     8016d1 <argnextvalue+0x50>
+        args->argvalue = 0;
+  8016bf:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  8016c6:	00 
+        args->curarg = 0;
+  8016c7:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  8016ce:	00 
+  8016cf:	eb dc                	jmp    8016ad <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  8016d1:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  8016d5:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8016d9:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  8016dd:	8b 10                	mov    (%rax),%edx
+  8016df:	83 ea 01             	sub    $0x1,%edx
+  8016e2:	48 63 d2             	movslq %edx,%rdx
+  8016e5:	48 c1 e2 03          	shl    $0x3,%rdx
+  8016e9:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8016ed:	48 83 c7 08          	add    $0x8,%rdi
+  8016f1:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  8016f8:	00 00 00 
+  8016fb:	ff d0                	call   *%rax
+        (*args->argc)--;
+  8016fd:	48 8b 03             	mov    (%rbx),%rax
+  801700:	83 28 01             	subl   $0x1,(%rax)
+  801703:	eb a8                	jmp    8016ad <argnextvalue+0x2c>
+}
+  801705:	c3                   	ret
+
+0000000000801706 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801706:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  80170a:	48 85 c0             	test   %rax,%rax
+  80170d:	74 01                	je     801710 <argvalue+0xa>
+}
+  80170f:	c3                   	ret
+argvalue(struct Argstate *args) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  801714:	48 b8 81 16 80 00 00 	movabs $0x801681,%rax
+  80171b:	00 00 00 
+  80171e:	ff d0                	call   *%rax
+}
+  801720:	5d                   	pop    %rbp
+  801721:	c3                   	ret
+
+0000000000801722 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801722:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801729:	ff ff ff 
+  80172c:	48 01 f8             	add    %rdi,%rax
+  80172f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801733:	c3                   	ret
+
+0000000000801734 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801734:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80173b:	ff ff ff 
+  80173e:	48 01 f8             	add    %rdi,%rax
+  801741:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801745:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80174b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80174f:	c3                   	ret
+
+0000000000801750 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801750:	55                   	push   %rbp
+  801751:	48 89 e5             	mov    %rsp,%rbp
+  801754:	41 57                	push   %r15
+  801756:	41 56                	push   %r14
+  801758:	41 55                	push   %r13
+  80175a:	41 54                	push   %r12
+  80175c:	53                   	push   %rbx
+  80175d:	48 83 ec 08          	sub    $0x8,%rsp
+  801761:	49 89 ff             	mov    %rdi,%r15
+  801764:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801769:	49 bd 83 40 80 00 00 	movabs $0x804083,%r13
+  801770:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801773:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801779:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80177c:	48 89 df             	mov    %rbx,%rdi
+  80177f:	41 ff d5             	call   *%r13
+  801782:	83 e0 04             	and    $0x4,%eax
+  801785:	74 17                	je     80179e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801787:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80178e:	4c 39 f3             	cmp    %r14,%rbx
+  801791:	75 e6                	jne    801779 <fd_alloc+0x29>
+  801793:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801799:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80179e:	4d 89 27             	mov    %r12,(%r15)
+}
+  8017a1:	48 83 c4 08          	add    $0x8,%rsp
+  8017a5:	5b                   	pop    %rbx
+  8017a6:	41 5c                	pop    %r12
+  8017a8:	41 5d                	pop    %r13
+  8017aa:	41 5e                	pop    %r14
+  8017ac:	41 5f                	pop    %r15
+  8017ae:	5d                   	pop    %rbp
+  8017af:	c3                   	ret
+
+00000000008017b0 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017b0:	83 ff 1f             	cmp    $0x1f,%edi
+  8017b3:	77 39                	ja     8017ee <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017b5:	55                   	push   %rbp
+  8017b6:	48 89 e5             	mov    %rsp,%rbp
+  8017b9:	41 54                	push   %r12
+  8017bb:	53                   	push   %rbx
+  8017bc:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017bf:	48 63 df             	movslq %edi,%rbx
+  8017c2:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017c9:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017cd:	48 89 df             	mov    %rbx,%rdi
+  8017d0:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  8017d7:	00 00 00 
+  8017da:	ff d0                	call   *%rax
+  8017dc:	a8 04                	test   $0x4,%al
+  8017de:	74 14                	je     8017f4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017e0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e9:	5b                   	pop    %rbx
+  8017ea:	41 5c                	pop    %r12
+  8017ec:	5d                   	pop    %rbp
+  8017ed:	c3                   	ret
+        return -E_INVAL;
+  8017ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017f3:	c3                   	ret
+        return -E_INVAL;
+  8017f4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f9:	eb ee                	jmp    8017e9 <fd_lookup+0x39>
+
+00000000008017fb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017fb:	55                   	push   %rbp
+  8017fc:	48 89 e5             	mov    %rsp,%rbp
+  8017ff:	41 54                	push   %r12
+  801801:	53                   	push   %rbx
+  801802:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801805:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  80180c:	00 00 00 
+  80180f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801816:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801819:	39 3b                	cmp    %edi,(%rbx)
+  80181b:	74 47                	je     801864 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80181d:	48 83 c0 08          	add    $0x8,%rax
+  801821:	48 8b 18             	mov    (%rax),%rbx
+  801824:	48 85 db             	test   %rbx,%rbx
+  801827:	75 f0                	jne    801819 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801829:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801830:	00 00 00 
+  801833:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801839:	89 fa                	mov    %edi,%edx
+  80183b:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  801842:	00 00 00 
+  801845:	b8 00 00 00 00       	mov    $0x0,%eax
+  80184a:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  801851:	00 00 00 
+  801854:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801856:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80185b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80185f:	5b                   	pop    %rbx
+  801860:	41 5c                	pop    %r12
+  801862:	5d                   	pop    %rbp
+  801863:	c3                   	ret
+            return 0;
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+  801869:	eb f0                	jmp    80185b <dev_lookup+0x60>
+
+000000000080186b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80186b:	55                   	push   %rbp
+  80186c:	48 89 e5             	mov    %rsp,%rbp
+  80186f:	41 55                	push   %r13
+  801871:	41 54                	push   %r12
+  801873:	53                   	push   %rbx
+  801874:	48 83 ec 18          	sub    $0x18,%rsp
+  801878:	48 89 fb             	mov    %rdi,%rbx
+  80187b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80187e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801885:	ff ff ff 
+  801888:	48 01 df             	add    %rbx,%rdi
+  80188b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80188f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801893:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  80189a:	00 00 00 
+  80189d:	ff d0                	call   *%rax
+  80189f:	41 89 c5             	mov    %eax,%r13d
+  8018a2:	85 c0                	test   %eax,%eax
+  8018a4:	78 06                	js     8018ac <fd_close+0x41>
+  8018a6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018aa:	74 1a                	je     8018c6 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018ac:	45 84 e4             	test   %r12b,%r12b
+  8018af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018b4:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018b8:	44 89 e8             	mov    %r13d,%eax
+  8018bb:	48 83 c4 18          	add    $0x18,%rsp
+  8018bf:	5b                   	pop    %rbx
+  8018c0:	41 5c                	pop    %r12
+  8018c2:	41 5d                	pop    %r13
+  8018c4:	5d                   	pop    %rbp
+  8018c5:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018c6:	8b 3b                	mov    (%rbx),%edi
+  8018c8:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018cc:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+  8018d8:	41 89 c5             	mov    %eax,%r13d
+  8018db:	85 c0                	test   %eax,%eax
+  8018dd:	78 1b                	js     8018fa <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018df:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018e3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018e7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018ed:	48 85 c0             	test   %rax,%rax
+  8018f0:	74 08                	je     8018fa <fd_close+0x8f>
+  8018f2:	48 89 df             	mov    %rbx,%rdi
+  8018f5:	ff d0                	call   *%rax
+  8018f7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018fa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018ff:	48 89 de             	mov    %rbx,%rsi
+  801902:	bf 00 00 00 00       	mov    $0x0,%edi
+  801907:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80190e:	00 00 00 
+  801911:	ff d0                	call   *%rax
+    return res;
+  801913:	eb a3                	jmp    8018b8 <fd_close+0x4d>
+
+0000000000801915 <close>:
+
+int
+close(int fdnum) {
+  801915:	55                   	push   %rbp
+  801916:	48 89 e5             	mov    %rsp,%rbp
+  801919:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  80191d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801921:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801928:	00 00 00 
+  80192b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80192d:	85 c0                	test   %eax,%eax
+  80192f:	78 15                	js     801946 <close+0x31>
+
+    return fd_close(fd, 1);
+  801931:	be 01 00 00 00       	mov    $0x1,%esi
+  801936:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80193a:	48 b8 6b 18 80 00 00 	movabs $0x80186b,%rax
+  801941:	00 00 00 
+  801944:	ff d0                	call   *%rax
+}
+  801946:	c9                   	leave
+  801947:	c3                   	ret
+
+0000000000801948 <close_all>:
+
+void
+close_all(void) {
+  801948:	55                   	push   %rbp
+  801949:	48 89 e5             	mov    %rsp,%rbp
+  80194c:	41 54                	push   %r12
+  80194e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80194f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801954:	49 bc 15 19 80 00 00 	movabs $0x801915,%r12
+  80195b:	00 00 00 
+  80195e:	89 df                	mov    %ebx,%edi
+  801960:	41 ff d4             	call   *%r12
+  801963:	83 c3 01             	add    $0x1,%ebx
+  801966:	83 fb 20             	cmp    $0x20,%ebx
+  801969:	75 f3                	jne    80195e <close_all+0x16>
+}
+  80196b:	5b                   	pop    %rbx
+  80196c:	41 5c                	pop    %r12
+  80196e:	5d                   	pop    %rbp
+  80196f:	c3                   	ret
+
+0000000000801970 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801970:	55                   	push   %rbp
+  801971:	48 89 e5             	mov    %rsp,%rbp
+  801974:	41 57                	push   %r15
+  801976:	41 56                	push   %r14
+  801978:	41 55                	push   %r13
+  80197a:	41 54                	push   %r12
+  80197c:	53                   	push   %rbx
+  80197d:	48 83 ec 18          	sub    $0x18,%rsp
+  801981:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801984:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801988:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  80198f:	00 00 00 
+  801992:	ff d0                	call   *%rax
+  801994:	89 c3                	mov    %eax,%ebx
+  801996:	85 c0                	test   %eax,%eax
+  801998:	0f 88 b8 00 00 00    	js     801a56 <dup+0xe6>
+    close(newfdnum);
+  80199e:	44 89 e7             	mov    %r12d,%edi
+  8019a1:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  8019a8:	00 00 00 
+  8019ab:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019ad:	4d 63 ec             	movslq %r12d,%r13
+  8019b0:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019b7:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019bb:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019bf:	4c 89 ff             	mov    %r15,%rdi
+  8019c2:	49 be 34 17 80 00 00 	movabs $0x801734,%r14
+  8019c9:	00 00 00 
+  8019cc:	41 ff d6             	call   *%r14
+  8019cf:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019d2:	4c 89 ef             	mov    %r13,%rdi
+  8019d5:	41 ff d6             	call   *%r14
+  8019d8:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019db:	48 89 df             	mov    %rbx,%rdi
+  8019de:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  8019e5:	00 00 00 
+  8019e8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019ea:	a8 04                	test   $0x4,%al
+  8019ec:	74 2b                	je     801a19 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019ee:	41 89 c1             	mov    %eax,%r9d
+  8019f1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019f7:	4c 89 f1             	mov    %r14,%rcx
+  8019fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019ff:	48 89 de             	mov    %rbx,%rsi
+  801a02:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a07:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  801a0e:	00 00 00 
+  801a11:	ff d0                	call   *%rax
+  801a13:	89 c3                	mov    %eax,%ebx
+  801a15:	85 c0                	test   %eax,%eax
+  801a17:	78 4e                	js     801a67 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a19:	4c 89 ff             	mov    %r15,%rdi
+  801a1c:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  801a23:	00 00 00 
+  801a26:	ff d0                	call   *%rax
+  801a28:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a2b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a31:	4c 89 e9             	mov    %r13,%rcx
+  801a34:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a39:	4c 89 fe             	mov    %r15,%rsi
+  801a3c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a41:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  801a48:	00 00 00 
+  801a4b:	ff d0                	call   *%rax
+  801a4d:	89 c3                	mov    %eax,%ebx
+  801a4f:	85 c0                	test   %eax,%eax
+  801a51:	78 14                	js     801a67 <dup+0xf7>
+
+    return newfdnum;
+  801a53:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a56:	89 d8                	mov    %ebx,%eax
+  801a58:	48 83 c4 18          	add    $0x18,%rsp
+  801a5c:	5b                   	pop    %rbx
+  801a5d:	41 5c                	pop    %r12
+  801a5f:	41 5d                	pop    %r13
+  801a61:	41 5e                	pop    %r14
+  801a63:	41 5f                	pop    %r15
+  801a65:	5d                   	pop    %rbp
+  801a66:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a67:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a6c:	4c 89 ee             	mov    %r13,%rsi
+  801a6f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a74:	49 bc 1b 12 80 00 00 	movabs $0x80121b,%r12
+  801a7b:	00 00 00 
+  801a7e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a81:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a86:	4c 89 f6             	mov    %r14,%rsi
+  801a89:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a8e:	41 ff d4             	call   *%r12
+    return res;
+  801a91:	eb c3                	jmp    801a56 <dup+0xe6>
+
+0000000000801a93 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a93:	55                   	push   %rbp
+  801a94:	48 89 e5             	mov    %rsp,%rbp
+  801a97:	41 56                	push   %r14
+  801a99:	41 55                	push   %r13
+  801a9b:	41 54                	push   %r12
+  801a9d:	53                   	push   %rbx
+  801a9e:	48 83 ec 10          	sub    $0x10,%rsp
+  801aa2:	89 fb                	mov    %edi,%ebx
+  801aa4:	49 89 f4             	mov    %rsi,%r12
+  801aa7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aaa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aae:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801ab5:	00 00 00 
+  801ab8:	ff d0                	call   *%rax
+  801aba:	85 c0                	test   %eax,%eax
+  801abc:	78 4c                	js     801b0a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801abe:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ac2:	41 8b 3e             	mov    (%r14),%edi
+  801ac5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ac9:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+  801ad5:	85 c0                	test   %eax,%eax
+  801ad7:	78 35                	js     801b0e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad9:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801add:	83 e0 03             	and    $0x3,%eax
+  801ae0:	83 f8 01             	cmp    $0x1,%eax
+  801ae3:	74 2d                	je     801b12 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ae5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801aed:	48 85 c0             	test   %rax,%rax
+  801af0:	74 56                	je     801b48 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801af2:	4c 89 ea             	mov    %r13,%rdx
+  801af5:	4c 89 e6             	mov    %r12,%rsi
+  801af8:	4c 89 f7             	mov    %r14,%rdi
+  801afb:	ff d0                	call   *%rax
+}
+  801afd:	48 83 c4 10          	add    $0x10,%rsp
+  801b01:	5b                   	pop    %rbx
+  801b02:	41 5c                	pop    %r12
+  801b04:	41 5d                	pop    %r13
+  801b06:	41 5e                	pop    %r14
+  801b08:	5d                   	pop    %rbp
+  801b09:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b0a:	48 98                	cltq
+  801b0c:	eb ef                	jmp    801afd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b0e:	48 98                	cltq
+  801b10:	eb eb                	jmp    801afd <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b12:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801b19:	00 00 00 
+  801b1c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b22:	89 da                	mov    %ebx,%edx
+  801b24:	48 bf 09 51 80 00 00 	movabs $0x805109,%rdi
+  801b2b:	00 00 00 
+  801b2e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b33:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  801b3a:	00 00 00 
+  801b3d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b3f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b46:	eb b5                	jmp    801afd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b48:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b4f:	eb ac                	jmp    801afd <read+0x6a>
+
+0000000000801b51 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b51:	55                   	push   %rbp
+  801b52:	48 89 e5             	mov    %rsp,%rbp
+  801b55:	41 57                	push   %r15
+  801b57:	41 56                	push   %r14
+  801b59:	41 55                	push   %r13
+  801b5b:	41 54                	push   %r12
+  801b5d:	53                   	push   %rbx
+  801b5e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b62:	48 85 d2             	test   %rdx,%rdx
+  801b65:	74 54                	je     801bbb <readn+0x6a>
+  801b67:	41 89 fd             	mov    %edi,%r13d
+  801b6a:	49 89 f6             	mov    %rsi,%r14
+  801b6d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b70:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b75:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b7a:	49 bf 93 1a 80 00 00 	movabs $0x801a93,%r15
+  801b81:	00 00 00 
+  801b84:	4c 89 e2             	mov    %r12,%rdx
+  801b87:	48 29 f2             	sub    %rsi,%rdx
+  801b8a:	4c 01 f6             	add    %r14,%rsi
+  801b8d:	44 89 ef             	mov    %r13d,%edi
+  801b90:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b93:	85 c0                	test   %eax,%eax
+  801b95:	78 20                	js     801bb7 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b97:	01 c3                	add    %eax,%ebx
+  801b99:	85 c0                	test   %eax,%eax
+  801b9b:	74 08                	je     801ba5 <readn+0x54>
+  801b9d:	48 63 f3             	movslq %ebx,%rsi
+  801ba0:	4c 39 e6             	cmp    %r12,%rsi
+  801ba3:	72 df                	jb     801b84 <readn+0x33>
+    }
+    return res;
+  801ba5:	48 63 c3             	movslq %ebx,%rax
+}
+  801ba8:	48 83 c4 08          	add    $0x8,%rsp
+  801bac:	5b                   	pop    %rbx
+  801bad:	41 5c                	pop    %r12
+  801baf:	41 5d                	pop    %r13
+  801bb1:	41 5e                	pop    %r14
+  801bb3:	41 5f                	pop    %r15
+  801bb5:	5d                   	pop    %rbp
+  801bb6:	c3                   	ret
+        if (inc < 0) return inc;
+  801bb7:	48 98                	cltq
+  801bb9:	eb ed                	jmp    801ba8 <readn+0x57>
+    int inc = 1, res = 0;
+  801bbb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bc0:	eb e3                	jmp    801ba5 <readn+0x54>
+
+0000000000801bc2 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801bc2:	55                   	push   %rbp
+  801bc3:	48 89 e5             	mov    %rsp,%rbp
+  801bc6:	41 56                	push   %r14
+  801bc8:	41 55                	push   %r13
+  801bca:	41 54                	push   %r12
+  801bcc:	53                   	push   %rbx
+  801bcd:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd1:	89 fb                	mov    %edi,%ebx
+  801bd3:	49 89 f4             	mov    %rsi,%r12
+  801bd6:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bdd:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801be4:	00 00 00 
+  801be7:	ff d0                	call   *%rax
+  801be9:	85 c0                	test   %eax,%eax
+  801beb:	78 47                	js     801c34 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bed:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bf1:	41 8b 3e             	mov    (%r14),%edi
+  801bf4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bf8:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801bff:	00 00 00 
+  801c02:	ff d0                	call   *%rax
+  801c04:	85 c0                	test   %eax,%eax
+  801c06:	78 30                	js     801c38 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801c08:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c0d:	74 2d                	je     801c3c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c0f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c13:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c17:	48 85 c0             	test   %rax,%rax
+  801c1a:	74 56                	je     801c72 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c1c:	4c 89 ea             	mov    %r13,%rdx
+  801c1f:	4c 89 e6             	mov    %r12,%rsi
+  801c22:	4c 89 f7             	mov    %r14,%rdi
+  801c25:	ff d0                	call   *%rax
+}
+  801c27:	48 83 c4 10          	add    $0x10,%rsp
+  801c2b:	5b                   	pop    %rbx
+  801c2c:	41 5c                	pop    %r12
+  801c2e:	41 5d                	pop    %r13
+  801c30:	41 5e                	pop    %r14
+  801c32:	5d                   	pop    %rbp
+  801c33:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c34:	48 98                	cltq
+  801c36:	eb ef                	jmp    801c27 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c38:	48 98                	cltq
+  801c3a:	eb eb                	jmp    801c27 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c3c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c43:	00 00 00 
+  801c46:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c4c:	89 da                	mov    %ebx,%edx
+  801c4e:	48 bf 25 51 80 00 00 	movabs $0x805125,%rdi
+  801c55:	00 00 00 
+  801c58:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c5d:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  801c64:	00 00 00 
+  801c67:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c69:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c70:	eb b5                	jmp    801c27 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c72:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c79:	eb ac                	jmp    801c27 <write+0x65>
+
+0000000000801c7b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c7b:	55                   	push   %rbp
+  801c7c:	48 89 e5             	mov    %rsp,%rbp
+  801c7f:	41 54                	push   %r12
+  801c81:	53                   	push   %rbx
+  801c82:	48 83 ec 10          	sub    $0x10,%rsp
+  801c86:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c88:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c8c:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801c93:	00 00 00 
+  801c96:	ff d0                	call   *%rax
+  801c98:	85 c0                	test   %eax,%eax
+  801c9a:	78 3e                	js     801cda <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ca0:	41 8b 3c 24          	mov    (%r12),%edi
+  801ca4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ca8:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801caf:	00 00 00 
+  801cb2:	ff d0                	call   *%rax
+  801cb4:	85 c0                	test   %eax,%eax
+  801cb6:	78 22                	js     801cda <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801cb8:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cbc:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801cc0:	48 85 c0             	test   %rax,%rax
+  801cc3:	74 0b                	je     801cd0 <seek+0x55>
+  801cc5:	89 de                	mov    %ebx,%esi
+  801cc7:	4c 89 e7             	mov    %r12,%rdi
+  801cca:	ff d0                	call   *%rax
+  801ccc:	85 c0                	test   %eax,%eax
+  801cce:	78 0a                	js     801cda <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801cd0:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cda:	48 83 c4 10          	add    $0x10,%rsp
+  801cde:	5b                   	pop    %rbx
+  801cdf:	41 5c                	pop    %r12
+  801ce1:	5d                   	pop    %rbp
+  801ce2:	c3                   	ret
+
+0000000000801ce3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ce3:	55                   	push   %rbp
+  801ce4:	48 89 e5             	mov    %rsp,%rbp
+  801ce7:	41 55                	push   %r13
+  801ce9:	41 54                	push   %r12
+  801ceb:	53                   	push   %rbx
+  801cec:	48 83 ec 18          	sub    $0x18,%rsp
+  801cf0:	89 fb                	mov    %edi,%ebx
+  801cf2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cf5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cf9:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801d00:	00 00 00 
+  801d03:	ff d0                	call   *%rax
+  801d05:	85 c0                	test   %eax,%eax
+  801d07:	78 38                	js     801d41 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d09:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d0d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d11:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d15:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801d1c:	00 00 00 
+  801d1f:	ff d0                	call   *%rax
+  801d21:	85 c0                	test   %eax,%eax
+  801d23:	78 1c                	js     801d41 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d25:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d2a:	74 20                	je     801d4c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d2c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d30:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d34:	48 85 c0             	test   %rax,%rax
+  801d37:	74 47                	je     801d80 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d39:	44 89 e6             	mov    %r12d,%esi
+  801d3c:	4c 89 ef             	mov    %r13,%rdi
+  801d3f:	ff d0                	call   *%rax
+}
+  801d41:	48 83 c4 18          	add    $0x18,%rsp
+  801d45:	5b                   	pop    %rbx
+  801d46:	41 5c                	pop    %r12
+  801d48:	41 5d                	pop    %r13
+  801d4a:	5d                   	pop    %rbp
+  801d4b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d4c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d53:	00 00 00 
+  801d56:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d5c:	89 da                	mov    %ebx,%edx
+  801d5e:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  801d65:	00 00 00 
+  801d68:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d6d:	48 b9 f1 02 80 00 00 	movabs $0x8002f1,%rcx
+  801d74:	00 00 00 
+  801d77:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d79:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d7e:	eb c1                	jmp    801d41 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d80:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d85:	eb ba                	jmp    801d41 <ftruncate+0x5e>
+
+0000000000801d87 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d87:	55                   	push   %rbp
+  801d88:	48 89 e5             	mov    %rsp,%rbp
+  801d8b:	41 54                	push   %r12
+  801d8d:	53                   	push   %rbx
+  801d8e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d92:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d95:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d99:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  801da0:	00 00 00 
+  801da3:	ff d0                	call   *%rax
+  801da5:	85 c0                	test   %eax,%eax
+  801da7:	78 4e                	js     801df7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801dad:	41 8b 3c 24          	mov    (%r12),%edi
+  801db1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801db5:	48 b8 fb 17 80 00 00 	movabs $0x8017fb,%rax
+  801dbc:	00 00 00 
+  801dbf:	ff d0                	call   *%rax
+  801dc1:	85 c0                	test   %eax,%eax
+  801dc3:	78 32                	js     801df7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dc5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dc9:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801dce:	74 30                	je     801e00 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dd0:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dd3:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801dda:	00 00 00 
+    stat->st_isdir = 0;
+  801ddd:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801de4:	00 00 00 
+    stat->st_dev = dev;
+  801de7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dee:	48 89 de             	mov    %rbx,%rsi
+  801df1:	4c 89 e7             	mov    %r12,%rdi
+  801df4:	ff 50 28             	call   *0x28(%rax)
+}
+  801df7:	48 83 c4 10          	add    $0x10,%rsp
+  801dfb:	5b                   	pop    %rbx
+  801dfc:	41 5c                	pop    %r12
+  801dfe:	5d                   	pop    %rbp
+  801dff:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801e00:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801e05:	eb f0                	jmp    801df7 <fstat+0x70>
+
+0000000000801e07 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801e07:	55                   	push   %rbp
+  801e08:	48 89 e5             	mov    %rsp,%rbp
+  801e0b:	41 54                	push   %r12
+  801e0d:	53                   	push   %rbx
+  801e0e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e11:	be 00 00 00 00       	mov    $0x0,%esi
+  801e16:	48 b8 75 2f 80 00 00 	movabs $0x802f75,%rax
+  801e1d:	00 00 00 
+  801e20:	ff d0                	call   *%rax
+  801e22:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e24:	85 c0                	test   %eax,%eax
+  801e26:	78 25                	js     801e4d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e28:	4c 89 e6             	mov    %r12,%rsi
+  801e2b:	89 c7                	mov    %eax,%edi
+  801e2d:	48 b8 87 1d 80 00 00 	movabs $0x801d87,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+  801e39:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e3c:	89 df                	mov    %ebx,%edi
+  801e3e:	48 b8 15 19 80 00 00 	movabs $0x801915,%rax
+  801e45:	00 00 00 
+  801e48:	ff d0                	call   *%rax
+
+    return res;
+  801e4a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e4d:	89 d8                	mov    %ebx,%eax
+  801e4f:	5b                   	pop    %rbx
+  801e50:	41 5c                	pop    %r12
+  801e52:	5d                   	pop    %rbp
+  801e53:	c3                   	ret
+
+0000000000801e54 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e54:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e5b:	00 00 00 
+  801e5e:	83 38 00             	cmpl   $0x0,(%rax)
+  801e61:	74 0a                	je     801e6d <fsenv+0x19>
+    return envid;
+}
+  801e63:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e6a:	00 00 
+  801e6c:	c3                   	ret
+fsenv(void) {
+  801e6d:	55                   	push   %rbp
+  801e6e:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e71:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e76:	48 b8 89 4a 80 00 00 	movabs $0x804a89,%rax
+  801e7d:	00 00 00 
+  801e80:	ff d0                	call   *%rax
+  801e82:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e89:	00 00 
+}
+  801e8b:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e92:	00 00 
+  801e94:	5d                   	pop    %rbp
+  801e95:	c3                   	ret
+
+0000000000801e96 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e96:	55                   	push   %rbp
+  801e97:	48 89 e5             	mov    %rsp,%rbp
+  801e9a:	41 54                	push   %r12
+  801e9c:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e9d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ea2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ea7:	48 89 de             	mov    %rbx,%rsi
+  801eaa:	bf 00 00 00 00       	mov    $0x0,%edi
+  801eaf:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801eb6:	00 00 00 
+  801eb9:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801ebb:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ec2:	00 00 00 
+  801ec5:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ecb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ed0:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ed5:	48 89 de             	mov    %rbx,%rsi
+  801ed8:	bf 00 00 00 00       	mov    $0x0,%edi
+  801edd:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  801ee4:	00 00 00 
+  801ee7:	ff d0                	call   *%rax
+  801ee9:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801eeb:	85 c0                	test   %eax,%eax
+  801eed:	0f 88 a2 00 00 00    	js     801f95 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801ef3:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801efa:	00 00 00 
+  801efd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f03:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801f08:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801f0a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801f0f:	49 bc 4b 42 80 00 00 	movabs $0x80424b,%r12
+  801f16:	00 00 00 
+  801f19:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801f1c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801f21:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f24:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  801f2b:	00 00 00 
+  801f2e:	ff d0                	call   *%rax
+  801f30:	89 c7                	mov    %eax,%edi
+  801f32:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801f38:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801f3d:	48 89 da             	mov    %rbx,%rdx
+  801f40:	be 09 00 00 00       	mov    $0x9,%esi
+  801f45:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  801f4c:	00 00 00 
+  801f4f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801f51:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f56:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f5b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f60:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f65:	48 b8 0f 4a 80 00 00 	movabs $0x804a0f,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	89 c3                	mov    %eax,%ebx
+  801f73:	85 c0                	test   %eax,%eax
+  801f75:	78 25                	js     801f9c <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801f77:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f7e:	00 00 00 
+  801f81:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f87:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f8e:	00 00 
+    return 0;
+  801f90:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f95:	89 d8                	mov    %ebx,%eax
+  801f97:	5b                   	pop    %rbx
+  801f98:	41 5c                	pop    %r12
+  801f9a:	5d                   	pop    %rbp
+  801f9b:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f9c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801fa1:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801fa6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fab:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+        return res;
+  801fb7:	eb dc                	jmp    801f95 <fschan_setup+0xff>
+
+0000000000801fb9 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801fb9:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fc0:	00 00 00 
+  801fc3:	80 38 00             	cmpb   $0x0,(%rax)
+  801fc6:	74 55                	je     80201d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fc8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fcf:	00 00 00 
+  801fd2:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801fd8:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fdd:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801fe4:	00 00 00 
+  801fe7:	3b 0a                	cmp    (%rdx),%ecx
+  801fe9:	75 01                	jne    801fec <fschan+0x33>
+}
+  801feb:	c3                   	ret
+fschan(void) {
+  801fec:	55                   	push   %rbp
+  801fed:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ff0:	48 b8 96 1e 80 00 00 	movabs $0x801e96,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+  801ffc:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801ffe:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802003:	85 d2                	test   %edx,%edx
+  802005:	78 02                	js     802009 <fschan+0x50>
+}
+  802007:	5d                   	pop    %rbp
+  802008:	c3                   	ret
+        fschan_enabled = 0;
+  802009:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802010:	00 00 00 
+  802013:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802016:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201b:	eb ea                	jmp    802007 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80201d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802022:	c3                   	ret
+
+0000000000802023 <fbuf>:
+fbuf(struct Fd *fd) {
+  802023:	55                   	push   %rbp
+  802024:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802027:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  80202e:	00 00 00 
+  802031:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802033:	ba 00 00 00 00       	mov    $0x0,%edx
+  802038:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80203c:	77 12                	ja     802050 <fbuf+0x2d>
+  80203e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802042:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802049:	00 00 00 
+  80204c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802050:	48 89 d0             	mov    %rdx,%rax
+  802053:	5d                   	pop    %rbp
+  802054:	c3                   	ret
+
+0000000000802055 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802055:	55                   	push   %rbp
+  802056:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802059:	48 83 c7 40          	add    $0x40,%rdi
+  80205d:	48 b8 85 42 80 00 00 	movabs $0x804285,%rax
+  802064:	00 00 00 
+  802067:	ff d0                	call   *%rax
+  802069:	84 c0                	test   %al,%al
+  80206b:	75 02                	jne    80206f <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80206d:	5d                   	pop    %rbp
+  80206e:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80206f:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802076:	00 00 00 
+  802079:	ff d0                	call   *%rax
+  80207b:	89 c7                	mov    %eax,%edi
+  80207d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802083:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802088:	ba 00 00 00 00       	mov    $0x0,%edx
+  80208d:	be 0a 00 00 00       	mov    $0xa,%esi
+  802092:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  802099:	00 00 00 
+  80209c:	ff d0                	call   *%rax
+}
+  80209e:	eb cd                	jmp    80206d <fschan_publish+0x18>
+
+00000000008020a0 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8020a0:	55                   	push   %rbp
+  8020a1:	48 89 e5             	mov    %rsp,%rbp
+  8020a4:	41 57                	push   %r15
+  8020a6:	41 56                	push   %r14
+  8020a8:	41 55                	push   %r13
+  8020aa:	41 54                	push   %r12
+  8020ac:	53                   	push   %rbx
+  8020ad:	48 83 ec 48          	sub    $0x48,%rsp
+  8020b1:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020b5:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8020b9:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8020bc:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8020c0:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8020c3:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8020ca:	00 00 00 
+  8020cd:	8b 02                	mov    (%rdx),%eax
+  8020cf:	83 c0 01             	add    $0x1,%eax
+  8020d2:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020d7:	0f 44 c1             	cmove  %ecx,%eax
+  8020da:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8020dc:	4d 85 c0             	test   %r8,%r8
+  8020df:	74 2c                	je     80210d <fschan_rw+0x6d>
+  8020e1:	45 89 ce             	mov    %r9d,%r14d
+  8020e4:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8020eb:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8020ef:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8020f5:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8020fc:	00 
+  8020fd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802103:	b8 01 00 00 00       	mov    $0x1,%eax
+  802108:	e9 41 01 00 00       	jmp    80224e <fschan_rw+0x1ae>
+  80210d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802111:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802115:	e9 9c 01 00 00       	jmp    8022b6 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80211a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80211e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802121:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802124:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802127:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80212b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80212f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802133:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802137:	48 89 da             	mov    %rbx,%rdx
+  80213a:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802146:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80214a:	48 b8 55 20 80 00 00 	movabs $0x802055,%rax
+  802151:	00 00 00 
+  802154:	ff d0                	call   *%rax
+            queued += blk;
+  802156:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802159:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80215d:	4d 39 fc             	cmp    %r15,%r12
+  802160:	73 6b                	jae    8021cd <fschan_rw+0x12d>
+  802162:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802166:	77 65                	ja     8021cd <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802168:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80216c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802170:	48 b8 60 42 80 00 00 	movabs $0x804260,%rax
+  802177:	00 00 00 
+  80217a:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80217c:	4c 89 fb             	mov    %r15,%rbx
+  80217f:	4c 29 e3             	sub    %r12,%rbx
+  802182:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802187:	48 39 d3             	cmp    %rdx,%rbx
+  80218a:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80218e:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802192:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802196:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80219a:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80219d:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80219f:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8021a6:	00 00 00 
+  8021a9:	8b 09                	mov    (%rcx),%ecx
+  8021ab:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8021ae:	83 fe 03             	cmp    $0x3,%esi
+  8021b1:	0f 85 63 ff ff ff    	jne    80211a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8021b7:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021bb:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021be:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8021c1:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8021c4:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8021c8:	e9 79 ff ff ff       	jmp    802146 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8021cd:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021d1:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8021d8:	48 89 df             	mov    %rbx,%rdi
+  8021db:	48 b8 23 43 80 00 00 	movabs $0x804323,%rax
+  8021e2:	00 00 00 
+  8021e5:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8021e7:	48 89 df             	mov    %rbx,%rdi
+  8021ea:	48 b8 b1 42 80 00 00 	movabs $0x8042b1,%rax
+  8021f1:	00 00 00 
+  8021f4:	ff d0                	call   *%rax
+  8021f6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8021fa:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8021fe:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802202:	75 25                	jne    802229 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802204:	8b 40 04             	mov    0x4(%rax),%eax
+  802207:	85 c0                	test   %eax,%eax
+  802209:	0f 88 86 00 00 00    	js     802295 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80220f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802213:	74 5b                	je     802270 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802215:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802219:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80221d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802221:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802225:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802229:	48 89 df             	mov    %rbx,%rdi
+  80222c:	48 b8 d8 42 80 00 00 	movabs $0x8042d8,%rax
+  802233:	00 00 00 
+  802236:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802238:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80223c:	83 f0 01             	xor    $0x1,%eax
+  80223f:	4d 39 fc             	cmp    %r15,%r12
+  802242:	0f 92 c2             	setb   %dl
+  802245:	84 c2                	test   %al,%dl
+  802247:	75 05                	jne    80224e <fschan_rw+0x1ae>
+  802249:	45 85 ed             	test   %r13d,%r13d
+  80224c:	74 50                	je     80229e <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80224e:	4d 39 fc             	cmp    %r15,%r12
+  802251:	0f 92 c1             	setb   %cl
+  802254:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802258:	0f 96 c2             	setbe  %dl
+  80225b:	84 d1                	test   %dl,%cl
+  80225d:	0f 84 6a ff ff ff    	je     8021cd <fschan_rw+0x12d>
+  802263:	84 c0                	test   %al,%al
+  802265:	0f 85 fd fe ff ff    	jne    802168 <fschan_rw+0xc8>
+  80226b:	e9 5d ff ff ff       	jmp    8021cd <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802270:	48 63 d0             	movslq %eax,%rdx
+  802273:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802277:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80227b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80227f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802283:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802287:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  80228e:	00 00 00 
+  802291:	ff d0                	call   *%rax
+  802293:	eb 80                	jmp    802215 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802295:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802298:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80229c:	eb 8b                	jmp    802229 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80229e:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8022a3:	0f 85 68 fe ff ff    	jne    802111 <fschan_rw+0x71>
+  8022a9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	0f 84 5d fe ff ff    	je     802111 <fschan_rw+0x71>
+  8022b4:	48 98                	cltq
+}
+  8022b6:	48 83 c4 48          	add    $0x48,%rsp
+  8022ba:	5b                   	pop    %rbx
+  8022bb:	41 5c                	pop    %r12
+  8022bd:	41 5d                	pop    %r13
+  8022bf:	41 5e                	pop    %r14
+  8022c1:	41 5f                	pop    %r15
+  8022c3:	5d                   	pop    %rbp
+  8022c4:	c3                   	ret
+
+00000000008022c5 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8022c5:	55                   	push   %rbp
+  8022c6:	48 89 e5             	mov    %rsp,%rbp
+  8022c9:	41 56                	push   %r14
+  8022cb:	41 55                	push   %r13
+  8022cd:	41 54                	push   %r12
+  8022cf:	53                   	push   %rbx
+  8022d0:	48 83 ec 10          	sub    $0x10,%rsp
+  8022d4:	49 89 fe             	mov    %rdi,%r14
+  8022d7:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8022da:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8022de:	48 29 f3             	sub    %rsi,%rbx
+  8022e1:	48 39 d3             	cmp    %rdx,%rbx
+  8022e4:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8022e8:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022ef:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8022f0:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8022f5:	49 bd e2 40 80 00 00 	movabs $0x8040e2,%r13
+  8022fc:	00 00 00 
+  8022ff:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802306:	76 1e                	jbe    802326 <mmap_fault+0x61>
+  802308:	4c 01 e7             	add    %r12,%rdi
+  80230b:	41 ff d5             	call   *%r13
+  80230e:	84 c0                	test   %al,%al
+  802310:	75 14                	jne    802326 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802312:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802316:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80231d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802321:	48 39 df             	cmp    %rbx,%rdi
+  802324:	72 e2                	jb     802308 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802326:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80232d:	00 00 00 
+  802330:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802337:	00 00 00 
+  80233a:	4c 89 f0             	mov    %r14,%rax
+  80233d:	48 29 d0             	sub    %rdx,%rax
+  802340:	48 c1 f8 03          	sar    $0x3,%rax
+  802344:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80234b:	aa aa aa 
+  80234e:	48 0f af c2          	imul   %rdx,%rax
+  802352:	48 c1 e0 0c          	shl    $0xc,%rax
+  802356:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80235b:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80235f:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802361:	44 89 e0             	mov    %r12d,%eax
+  802364:	41 03 46 10          	add    0x10(%r14),%eax
+  802368:	41 2b 06             	sub    (%r14),%eax
+  80236b:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80236e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802372:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802376:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80237a:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80237d:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802384:	00 00 00 
+  802387:	ff d0                	call   *%rax
+  802389:	89 c7                	mov    %eax,%edi
+  80238b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802391:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802396:	48 89 da             	mov    %rbx,%rdx
+  802399:	be 0f 00 00 00       	mov    $0xf,%esi
+  80239e:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  8023a5:	00 00 00 
+  8023a8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8023aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023af:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8023b3:	4c 89 e6             	mov    %r12,%rsi
+  8023b6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023bb:	48 b8 0f 4a 80 00 00 	movabs $0x804a0f,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+  8023c7:	48 98                	cltq
+}
+  8023c9:	48 83 c4 10          	add    $0x10,%rsp
+  8023cd:	5b                   	pop    %rbx
+  8023ce:	41 5c                	pop    %r12
+  8023d0:	41 5d                	pop    %r13
+  8023d2:	41 5e                	pop    %r14
+  8023d4:	5d                   	pop    %rbp
+  8023d5:	c3                   	ret
+
+00000000008023d6 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8023d6:	48 8b 37             	mov    (%rdi),%rsi
+  8023d9:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8023e0:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023e7:	00 00 00 
+  8023ea:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023ef:	eb 0f                	jmp    802400 <mmap_pgfault+0x2a>
+  8023f1:	c3                   	ret
+  8023f2:	48 83 c1 01          	add    $0x1,%rcx
+  8023f6:	48 83 c2 18          	add    $0x18,%rdx
+  8023fa:	48 83 f9 20          	cmp    $0x20,%rcx
+  8023fe:	74 6e                	je     80246e <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802400:	48 8b 02             	mov    (%rdx),%rax
+  802403:	48 83 e8 01          	sub    $0x1,%rax
+  802407:	48 39 f0             	cmp    %rsi,%rax
+  80240a:	73 e6                	jae    8023f2 <mmap_pgfault+0x1c>
+  80240c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802410:	73 e0                	jae    8023f2 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802412:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80241b:	f6 c2 01             	test   $0x1,%dl
+  80241e:	75 d1                	jne    8023f1 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802420:	f6 c2 02             	test   $0x2,%dl
+  802423:	74 1a                	je     80243f <mmap_pgfault+0x69>
+  802425:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802429:	b8 00 00 00 00       	mov    $0x0,%eax
+  80242e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802435:	00 00 00 
+  802438:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80243d:	74 35                	je     802474 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80243f:	55                   	push   %rbp
+  802440:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802443:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802447:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80244e:	00 00 00 
+  802451:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802455:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80245a:	48 b8 c5 22 80 00 00 	movabs $0x8022c5,%rax
+  802461:	00 00 00 
+  802464:	ff d0                	call   *%rax
+  802466:	48 85 c0             	test   %rax,%rax
+  802469:	0f 9f c0             	setg   %al
+}
+  80246c:	5d                   	pop    %rbp
+  80246d:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80246e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802473:	c3                   	ret
+}
+  802474:	c3                   	ret
+
+0000000000802475 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802475:	55                   	push   %rbp
+  802476:	48 89 e5             	mov    %rsp,%rbp
+  802479:	41 54                	push   %r12
+  80247b:	53                   	push   %rbx
+  80247c:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80247f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802486:	00 00 00 
+  802489:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80248e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802492:	74 15                	je     8024a9 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802494:	48 83 c3 01          	add    $0x1,%rbx
+  802498:	48 83 c0 18          	add    $0x18,%rax
+  80249c:	48 83 fb 20          	cmp    $0x20,%rbx
+  8024a0:	75 ec                	jne    80248e <mmap_alloc+0x19>
+    return NULL;
+  8024a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a7:	eb 52                	jmp    8024fb <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024a9:	4c 89 e7             	mov    %r12,%rdi
+  8024ac:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  8024b3:	00 00 00 
+  8024b6:	ff d0                	call   *%rax
+  8024b8:	41 89 c1             	mov    %eax,%r9d
+  8024bb:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8024c2:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024c6:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024d1:	4c 89 e6             	mov    %r12,%rsi
+  8024d4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d9:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  8024e0:	00 00 00 
+  8024e3:	ff d0                	call   *%rax
+  8024e5:	85 c0                	test   %eax,%eax
+  8024e7:	78 17                	js     802500 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8024e9:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8024ed:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024f4:	00 00 00 
+  8024f7:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8024fb:	5b                   	pop    %rbx
+  8024fc:	41 5c                	pop    %r12
+  8024fe:	5d                   	pop    %rbp
+  8024ff:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802500:	b8 00 00 00 00       	mov    $0x0,%eax
+  802505:	eb f4                	jmp    8024fb <mmap_alloc+0x86>
+
+0000000000802507 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802507:	55                   	push   %rbp
+  802508:	48 89 e5             	mov    %rsp,%rbp
+  80250b:	41 56                	push   %r14
+  80250d:	41 55                	push   %r13
+  80250f:	41 54                	push   %r12
+  802511:	53                   	push   %rbx
+  802512:	48 83 ec 10          	sub    $0x10,%rsp
+  802516:	41 89 fc             	mov    %edi,%r12d
+  802519:	49 89 f5             	mov    %rsi,%r13
+  80251c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80251f:	48 89 f0             	mov    %rsi,%rax
+  802522:	48 09 d0             	or     %rdx,%rax
+  802525:	75 0d                	jne    802534 <fsipc+0x2d>
+  802527:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80252a:	83 f8 04             	cmp    $0x4,%eax
+  80252d:	76 7d                	jbe    8025ac <fsipc+0xa5>
+  80252f:	83 ff 0d             	cmp    $0xd,%edi
+  802532:	74 78                	je     8025ac <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802534:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  80253b:	00 00 00 
+  80253e:	ff d0                	call   *%rax
+  802540:	89 c7                	mov    %eax,%edi
+  802542:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802549:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802550:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802557:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80255d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802564:	00 00 00 
+  802567:	44 89 e6             	mov    %r12d,%esi
+  80256a:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  802571:	00 00 00 
+  802574:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802576:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80257d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80257e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802583:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802587:	4c 89 ee             	mov    %r13,%rsi
+  80258a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80258f:	48 b8 0f 4a 80 00 00 	movabs $0x804a0f,%rax
+  802596:	00 00 00 
+  802599:	ff d0                	call   *%rax
+  80259b:	89 c3                	mov    %eax,%ebx
+}
+  80259d:	89 d8                	mov    %ebx,%eax
+  80259f:	48 83 c4 10          	add    $0x10,%rsp
+  8025a3:	5b                   	pop    %rbx
+  8025a4:	41 5c                	pop    %r12
+  8025a6:	41 5d                	pop    %r13
+  8025a8:	41 5e                	pop    %r14
+  8025aa:	5d                   	pop    %rbp
+  8025ab:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8025ac:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  8025b3:	00 00 00 
+  8025b6:	ff d0                	call   *%rax
+  8025b8:	49 89 c6             	mov    %rax,%r14
+  8025bb:	48 85 c0             	test   %rax,%rax
+  8025be:	0f 84 70 ff ff ff    	je     802534 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025c4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025c8:	48 b8 60 42 80 00 00 	movabs $0x804260,%rax
+  8025cf:	00 00 00 
+  8025d2:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8025d4:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8025d7:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8025de:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8025e2:	ba 10 00 00 00       	mov    $0x10,%edx
+  8025e7:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8025ee:	00 00 00 
+  8025f1:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  8025f8:	00 00 00 
+  8025fb:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8025fd:	4c 89 f7             	mov    %r14,%rdi
+  802600:	48 b8 55 20 80 00 00 	movabs $0x802055,%rax
+  802607:	00 00 00 
+  80260a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80260c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802613:	4c 89 f7             	mov    %r14,%rdi
+  802616:	48 b8 23 43 80 00 00 	movabs $0x804323,%rax
+  80261d:	00 00 00 
+  802620:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802622:	4c 89 f7             	mov    %r14,%rdi
+  802625:	48 b8 b1 42 80 00 00 	movabs $0x8042b1,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802631:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802634:	41 83 fc 05          	cmp    $0x5,%r12d
+  802638:	75 04                	jne    80263e <fsipc+0x137>
+  80263a:	85 db                	test   %ebx,%ebx
+  80263c:	79 14                	jns    802652 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80263e:	4c 89 f7             	mov    %r14,%rdi
+  802641:	48 b8 d8 42 80 00 00 	movabs $0x8042d8,%rax
+  802648:	00 00 00 
+  80264b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80264d:	e9 4b ff ff ff       	jmp    80259d <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802652:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802656:	ba 88 00 00 00       	mov    $0x88,%edx
+  80265b:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802662:	00 00 00 
+  802665:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  80266c:	00 00 00 
+  80266f:	ff d0                	call   *%rax
+  802671:	eb cb                	jmp    80263e <fsipc+0x137>
+
+0000000000802673 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802673:	55                   	push   %rbp
+  802674:	48 89 e5             	mov    %rsp,%rbp
+  802677:	41 57                	push   %r15
+  802679:	41 56                	push   %r14
+  80267b:	41 55                	push   %r13
+  80267d:	41 54                	push   %r12
+  80267f:	53                   	push   %rbx
+  802680:	48 83 ec 18          	sub    $0x18,%rsp
+  802684:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802688:	49 89 f6             	mov    %rsi,%r14
+  80268b:	49 89 d4             	mov    %rdx,%r12
+  80268e:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802691:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  802698:	00 00 00 
+  80269b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80269d:	48 85 c0             	test   %rax,%rax
+  8026a0:	0f 85 96 00 00 00    	jne    80273c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8026a6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8026ad:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026ae:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8026b5:	00 00 00 
+    while (n) {
+  8026b8:	4d 85 e4             	test   %r12,%r12
+  8026bb:	74 79                	je     802736 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8026bd:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8026c2:	49 39 dc             	cmp    %rbx,%r12
+  8026c5:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8026c9:	48 89 da             	mov    %rbx,%rdx
+  8026cc:	4c 89 f6             	mov    %r14,%rsi
+  8026cf:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8026d6:	00 00 00 
+  8026d9:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026e5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026e9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8026ec:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8026ef:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8026f2:	44 01 e8             	add    %r13d,%eax
+  8026f5:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8026f9:	41 0f 44 c5          	cmove  %r13d,%eax
+  8026fd:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802701:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802705:	48 89 da             	mov    %rbx,%rdx
+  802708:	be 00 00 00 00       	mov    $0x0,%esi
+  80270d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802712:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802719:	00 00 00 
+  80271c:	ff d0                	call   *%rax
+        if (res < 0)
+  80271e:	85 c0                	test   %eax,%eax
+  802720:	78 4a                	js     80276c <devfile_write_direct+0xf9>
+        buf += res;
+  802722:	48 98                	cltq
+  802724:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802727:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80272b:	49 29 c4             	sub    %rax,%r12
+  80272e:	75 8d                	jne    8026bd <devfile_write_direct+0x4a>
+    return write;
+  802730:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802734:	eb 27                	jmp    80275d <devfile_write_direct+0xea>
+    size_t write = 0;
+  802736:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80273a:	eb f4                	jmp    802730 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80273c:	45 89 e9             	mov    %r13d,%r9d
+  80273f:	4d 89 e0             	mov    %r12,%r8
+  802742:	4c 89 f1             	mov    %r14,%rcx
+  802745:	ba 04 00 00 00       	mov    $0x4,%edx
+  80274a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80274e:	48 89 c7             	mov    %rax,%rdi
+  802751:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  802758:	00 00 00 
+  80275b:	ff d0                	call   *%rax
+}
+  80275d:	48 83 c4 18          	add    $0x18,%rsp
+  802761:	5b                   	pop    %rbx
+  802762:	41 5c                	pop    %r12
+  802764:	41 5d                	pop    %r13
+  802766:	41 5e                	pop    %r14
+  802768:	41 5f                	pop    %r15
+  80276a:	5d                   	pop    %rbp
+  80276b:	c3                   	ret
+            return res;
+  80276c:	48 98                	cltq
+  80276e:	eb ed                	jmp    80275d <devfile_write_direct+0xea>
+
+0000000000802770 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802770:	55                   	push   %rbp
+  802771:	48 89 e5             	mov    %rsp,%rbp
+  802774:	41 54                	push   %r12
+  802776:	53                   	push   %rbx
+  802777:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80277a:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  802781:	00 00 00 
+  802784:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802786:	48 85 c0             	test   %rax,%rax
+  802789:	74 71                	je     8027fc <fbuf_flush+0x8c>
+  80278b:	48 89 c3             	mov    %rax,%rbx
+  80278e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802793:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802797:	75 05                	jne    80279e <fbuf_flush+0x2e>
+}
+  802799:	5b                   	pop    %rbx
+  80279a:	41 5c                	pop    %r12
+  80279c:	5d                   	pop    %rbp
+  80279d:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80279e:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8027a1:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8027a5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8027ac:	00 00 00 
+  8027af:	48 89 de             	mov    %rbx,%rsi
+  8027b2:	48 29 c6             	sub    %rax,%rsi
+  8027b5:	48 c1 fe 03          	sar    $0x3,%rsi
+  8027b9:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027c0:	aa aa aa 
+  8027c3:	48 0f af f0          	imul   %rax,%rsi
+  8027c7:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8027cb:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027d0:	48 01 c6             	add    %rax,%rsi
+  8027d3:	4c 89 e7             	mov    %r12,%rdi
+  8027d6:	48 b8 73 26 80 00 00 	movabs $0x802673,%rax
+  8027dd:	00 00 00 
+  8027e0:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8027e2:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8027e6:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8027ed:	00 
+    return res < 0 ? res : 0;
+  8027ee:	48 85 c0             	test   %rax,%rax
+  8027f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027f6:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8027fa:	eb 9d                	jmp    802799 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8027fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  802801:	eb 96                	jmp    802799 <fbuf_flush+0x29>
+
+0000000000802803 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802803:	55                   	push   %rbp
+  802804:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802807:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  80280e:	00 00 00 
+  802811:	ff d0                	call   *%rax
+}
+  802813:	5d                   	pop    %rbp
+  802814:	c3                   	ret
+
+0000000000802815 <devfile_write>:
+    if (!fd || !buf)
+  802815:	48 85 ff             	test   %rdi,%rdi
+  802818:	0f 84 d3 01 00 00    	je     8029f1 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80281e:	55                   	push   %rbp
+  80281f:	48 89 e5             	mov    %rsp,%rbp
+  802822:	41 57                	push   %r15
+  802824:	41 56                	push   %r14
+  802826:	41 55                	push   %r13
+  802828:	41 54                	push   %r12
+  80282a:	53                   	push   %rbx
+  80282b:	48 83 ec 08          	sub    $0x8,%rsp
+  80282f:	49 89 fc             	mov    %rdi,%r12
+  802832:	49 89 f6             	mov    %rsi,%r14
+  802835:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802838:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80283d:	48 85 f6             	test   %rsi,%rsi
+  802840:	0f 84 9c 01 00 00    	je     8029e2 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802846:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  80284d:	00 00 00 
+  802850:	ff d0                	call   *%rax
+  802852:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802855:	48 85 c0             	test   %rax,%rax
+  802858:	0f 84 a2 00 00 00    	je     802900 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80285e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802863:	4c 89 e7             	mov    %r12,%rdi
+  802866:	48 b8 3a 11 80 00 00 	movabs $0x80113a,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802872:	83 f8 02             	cmp    $0x2,%eax
+  802875:	0f 8f 85 00 00 00    	jg     802900 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  80287b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802882:	00 00 00 
+  802885:	4d 89 ef             	mov    %r13,%r15
+  802888:	49 29 c7             	sub    %rax,%r15
+  80288b:	49 c1 ff 03          	sar    $0x3,%r15
+  80288f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802896:	aa aa aa 
+  802899:	4c 0f af f8          	imul   %rax,%r15
+  80289d:	49 c1 e7 0e          	shl    $0xe,%r15
+  8028a1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8028a6:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8028a9:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028ae:	0f 84 d7 00 00 00    	je     80298b <devfile_write+0x176>
+  8028b4:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8028b8:	89 c2                	mov    %eax,%edx
+  8028ba:	41 03 55 0c          	add    0xc(%r13),%edx
+  8028be:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8028c3:	75 0f                	jne    8028d4 <devfile_write+0xbf>
+  8028c5:	48 01 d8             	add    %rbx,%rax
+  8028c8:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8028ce:	0f 86 92 00 00 00    	jbe    802966 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028d4:	4c 89 e7             	mov    %r12,%rdi
+  8028d7:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  8028de:	00 00 00 
+  8028e1:	ff d0                	call   *%rax
+  8028e3:	85 c0                	test   %eax,%eax
+  8028e5:	78 52                	js     802939 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028e7:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028ee:	77 7f                	ja     80296f <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8028f0:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028f5:	0f 85 c2 00 00 00    	jne    8029bd <devfile_write+0x1a8>
+  8028fb:	e9 94 00 00 00       	jmp    802994 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802900:	4c 89 e7             	mov    %r12,%rdi
+  802903:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  80290a:	00 00 00 
+  80290d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80290f:	85 c0                	test   %eax,%eax
+  802911:	79 07                	jns    80291a <devfile_write+0x105>
+  802913:	48 98                	cltq
+  802915:	e9 c8 00 00 00       	jmp    8029e2 <devfile_write+0x1cd>
+  80291a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80291f:	48 89 da             	mov    %rbx,%rdx
+  802922:	4c 89 f6             	mov    %r14,%rsi
+  802925:	4c 89 e7             	mov    %r12,%rdi
+  802928:	48 b8 73 26 80 00 00 	movabs $0x802673,%rax
+  80292f:	00 00 00 
+  802932:	ff d0                	call   *%rax
+  802934:	e9 a9 00 00 00       	jmp    8029e2 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802939:	48 98                	cltq
+  80293b:	e9 a2 00 00 00       	jmp    8029e2 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802940:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802945:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80294a:	4c 89 fe             	mov    %r15,%rsi
+  80294d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802952:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  802959:	00 00 00 
+  80295c:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80295e:	85 c0                	test   %eax,%eax
+  802960:	79 45                	jns    8029a7 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802962:	48 98                	cltq
+  802964:	eb 7c                	jmp    8029e2 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802966:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80296d:	76 4e                	jbe    8029bd <devfile_write+0x1a8>
+  80296f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802974:	48 89 da             	mov    %rbx,%rdx
+  802977:	4c 89 f6             	mov    %r14,%rsi
+  80297a:	4c 89 e7             	mov    %r12,%rdi
+  80297d:	48 b8 73 26 80 00 00 	movabs $0x802673,%rax
+  802984:	00 00 00 
+  802987:	ff d0                	call   *%rax
+  802989:	eb 57                	jmp    8029e2 <devfile_write+0x1cd>
+  80298b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802992:	77 db                	ja     80296f <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802994:	4c 89 ff             	mov    %r15,%rdi
+  802997:	48 b8 e2 40 80 00 00 	movabs $0x8040e2,%rax
+  80299e:	00 00 00 
+  8029a1:	ff d0                	call   *%rax
+  8029a3:	84 c0                	test   %al,%al
+  8029a5:	74 99                	je     802940 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  8029a7:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8029ac:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8029b1:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8029b5:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8029bc:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8029bd:	4c 89 ff             	mov    %r15,%rdi
+  8029c0:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8029c4:	48 89 da             	mov    %rbx,%rdx
+  8029c7:	4c 89 f6             	mov    %r14,%rsi
+  8029ca:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8029d6:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8029da:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8029df:	48 89 d8             	mov    %rbx,%rax
+}
+  8029e2:	48 83 c4 08          	add    $0x8,%rsp
+  8029e6:	5b                   	pop    %rbx
+  8029e7:	41 5c                	pop    %r12
+  8029e9:	41 5d                	pop    %r13
+  8029eb:	41 5e                	pop    %r14
+  8029ed:	41 5f                	pop    %r15
+  8029ef:	5d                   	pop    %rbp
+  8029f0:	c3                   	ret
+        return E_INVAL;
+  8029f1:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029f6:	c3                   	ret
+
+00000000008029f7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029f7:	55                   	push   %rbp
+  8029f8:	48 89 e5             	mov    %rsp,%rbp
+  8029fb:	41 54                	push   %r12
+  8029fd:	53                   	push   %rbx
+  8029fe:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802a01:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  802a08:	00 00 00 
+  802a0b:	ff d0                	call   *%rax
+  802a0d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802a10:	48 89 df             	mov    %rbx,%rdi
+  802a13:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  802a1a:	00 00 00 
+  802a1d:	ff d0                	call   *%rax
+  802a1f:	48 85 c0             	test   %rax,%rax
+  802a22:	74 17                	je     802a3b <devfile_flush+0x44>
+  802a24:	48 89 df             	mov    %rbx,%rdi
+  802a27:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  802a2e:	00 00 00 
+  802a31:	ff d0                	call   *%rax
+  802a33:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802a3a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a3b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a3e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802a45:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802a47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a4c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a51:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a56:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802a5d:	00 00 00 
+  802a60:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a62:	45 85 e4             	test   %r12d,%r12d
+  802a65:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a69:	5b                   	pop    %rbx
+  802a6a:	41 5c                	pop    %r12
+  802a6c:	5d                   	pop    %rbp
+  802a6d:	c3                   	ret
+
+0000000000802a6e <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a6e:	55                   	push   %rbp
+  802a6f:	48 89 e5             	mov    %rsp,%rbp
+  802a72:	41 57                	push   %r15
+  802a74:	41 56                	push   %r14
+  802a76:	41 55                	push   %r13
+  802a78:	41 54                	push   %r12
+  802a7a:	53                   	push   %rbx
+  802a7b:	48 83 ec 38          	sub    $0x38,%rsp
+  802a7f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a83:	49 89 f7             	mov    %rsi,%r15
+  802a86:	48 89 d3             	mov    %rdx,%rbx
+  802a89:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a8c:	48 b8 b9 1f 80 00 00 	movabs $0x801fb9,%rax
+  802a93:	00 00 00 
+  802a96:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a98:	48 85 c0             	test   %rax,%rax
+  802a9b:	75 20                	jne    802abd <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a9d:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802aa2:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802aa9:	00 
+    while (n) {
+  802aaa:	48 85 db             	test   %rbx,%rbx
+  802aad:	0f 85 df 00 00 00    	jne    802b92 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802ab3:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802ab7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802abb:	eb 21                	jmp    802ade <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802abd:	45 89 f1             	mov    %r14d,%r9d
+  802ac0:	49 89 d8             	mov    %rbx,%r8
+  802ac3:	4c 89 f9             	mov    %r15,%rcx
+  802ac6:	ba 03 00 00 00       	mov    $0x3,%edx
+  802acb:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802acf:	48 89 c7             	mov    %rax,%rdi
+  802ad2:	48 b8 a0 20 80 00 00 	movabs $0x8020a0,%rax
+  802ad9:	00 00 00 
+  802adc:	ff d0                	call   *%rax
+}
+  802ade:	48 83 c4 38          	add    $0x38,%rsp
+  802ae2:	5b                   	pop    %rbx
+  802ae3:	41 5c                	pop    %r12
+  802ae5:	41 5d                	pop    %r13
+  802ae7:	41 5e                	pop    %r14
+  802ae9:	41 5f                	pop    %r15
+  802aeb:	5d                   	pop    %rbp
+  802aec:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802aed:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802af1:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802af7:	75 1e                	jne    802b17 <devfile_read_direct+0xa9>
+  802af9:	e9 e2 00 00 00       	jmp    802be0 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802afe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802b02:	eb da                	jmp    802ade <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802b04:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802b08:	0f 85 d0 01 00 00    	jne    802cde <devfile_read_direct+0x270>
+            map = 0;
+  802b0e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802b12:	eb 03                	jmp    802b17 <devfile_read_direct+0xa9>
+  802b14:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b17:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b1c:	48 39 d3             	cmp    %rdx,%rbx
+  802b1f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b27:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b2a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802b31:	00 00 00 
+  802b34:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802b36:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802b3a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802b3e:	be 00 00 00 00       	mov    $0x0,%esi
+  802b43:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b48:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802b4f:	00 00 00 
+  802b52:	ff d0                	call   *%rax
+        if (res <= 0)
+  802b54:	85 c0                	test   %eax,%eax
+  802b56:	0f 8e 63 01 00 00    	jle    802cbf <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b5c:	4c 63 e0             	movslq %eax,%r12
+  802b5f:	4c 89 e2             	mov    %r12,%rdx
+  802b62:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b69:	00 00 00 
+  802b6c:	4c 89 ff             	mov    %r15,%rdi
+  802b6f:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  802b76:	00 00 00 
+  802b79:	ff d0                	call   *%rax
+        buf += res;
+  802b7b:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b7e:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b81:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b85:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b89:	48 85 db             	test   %rbx,%rbx
+  802b8c:	0f 84 25 ff ff ff    	je     802ab7 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b92:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b95:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b99:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b9d:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ba1:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ba8:	0f 97 c2             	seta   %dl
+  802bab:	20 c2                	and    %al,%dl
+  802bad:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802bb0:	0f 84 5e ff ff ff    	je     802b14 <devfile_read_direct+0xa6>
+  802bb6:	4c 89 fa             	mov    %r15,%rdx
+  802bb9:	4d 89 fd             	mov    %r15,%r13
+  802bbc:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802bc3:	0f 85 4e ff ff ff    	jne    802b17 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802bc9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802bcd:	0f 84 1a ff ff ff    	je     802aed <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802bd3:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802bda:	0f 85 37 ff ff ff    	jne    802b17 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802be0:	48 89 d8             	mov    %rbx,%rax
+  802be3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802be9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802bee:	48 39 c8             	cmp    %rcx,%rax
+  802bf1:	48 0f 47 c1          	cmova  %rcx,%rax
+  802bf5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802bf9:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802bfd:	49 89 d4             	mov    %rdx,%r12
+  802c00:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802c04:	48 b8 83 40 80 00 00 	movabs $0x804083,%rax
+  802c0b:	00 00 00 
+  802c0e:	ff d0                	call   *%rax
+  802c10:	a8 40                	test   $0x40,%al
+  802c12:	0f 85 b9 00 00 00    	jne    802cd1 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802c18:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802c1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c23:	49 39 c5             	cmp    %rax,%r13
+  802c26:	72 d8                	jb     802c00 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c28:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c2c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c33:	00 00 00 
+  802c36:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c3a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802c3d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802c3f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802c43:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802c47:	48 b8 54 1e 80 00 00 	movabs $0x801e54,%rax
+  802c4e:	00 00 00 
+  802c51:	ff d0                	call   *%rax
+  802c53:	89 c7                	mov    %eax,%edi
+  802c55:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c5b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c60:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c67:	00 00 00 
+  802c6a:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c6f:	48 b8 33 4a 80 00 00 	movabs $0x804a33,%rax
+  802c76:	00 00 00 
+  802c79:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802c7b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c80:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c84:	4c 89 fe             	mov    %r15,%rsi
+  802c87:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c8c:	48 b8 0f 4a 80 00 00 	movabs $0x804a0f,%rax
+  802c93:	00 00 00 
+  802c96:	ff d0                	call   *%rax
+  802c98:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c9b:	48 85 d2             	test   %rdx,%rdx
+  802c9e:	0f 84 5a fe ff ff    	je     802afe <devfile_read_direct+0x90>
+            if (res > 0) {
+  802ca4:	0f 8e 5a fe ff ff    	jle    802b04 <devfile_read_direct+0x96>
+                buf += res;
+  802caa:	48 98                	cltq
+  802cac:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802caf:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802cb2:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802cb6:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802cba:	e9 ca fe ff ff       	jmp    802b89 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802cbf:	41 89 c5             	mov    %eax,%r13d
+  802cc2:	48 98                	cltq
+  802cc4:	45 85 ed             	test   %r13d,%r13d
+  802cc7:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802ccc:	e9 0d fe ff ff       	jmp    802ade <devfile_read_direct+0x70>
+            map = 0;
+  802cd1:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802cd5:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cd9:	e9 39 fe ff ff       	jmp    802b17 <devfile_read_direct+0xa9>
+  802cde:	48 89 d0             	mov    %rdx,%rax
+  802ce1:	e9 f8 fd ff ff       	jmp    802ade <devfile_read_direct+0x70>
+
+0000000000802ce6 <devfile_read>:
+    if (!fd || !buf)
+  802ce6:	48 85 ff             	test   %rdi,%rdi
+  802ce9:	0f 84 21 02 00 00    	je     802f10 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802cef:	55                   	push   %rbp
+  802cf0:	48 89 e5             	mov    %rsp,%rbp
+  802cf3:	41 57                	push   %r15
+  802cf5:	41 56                	push   %r14
+  802cf7:	41 55                	push   %r13
+  802cf9:	41 54                	push   %r12
+  802cfb:	53                   	push   %rbx
+  802cfc:	48 83 ec 28          	sub    $0x28,%rsp
+  802d00:	48 89 fb             	mov    %rdi,%rbx
+  802d03:	49 89 f4             	mov    %rsi,%r12
+  802d06:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802d09:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802d0e:	48 85 f6             	test   %rsi,%rsi
+  802d11:	74 4b                	je     802d5e <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802d13:	48 b8 23 20 80 00 00 	movabs $0x802023,%rax
+  802d1a:	00 00 00 
+  802d1d:	ff d0                	call   *%rax
+  802d1f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d22:	48 85 c0             	test   %rax,%rax
+  802d25:	74 22                	je     802d49 <devfile_read+0x63>
+  802d27:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802d2e:	77 19                	ja     802d49 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802d30:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d35:	48 89 df             	mov    %rbx,%rdi
+  802d38:	48 b8 3a 11 80 00 00 	movabs $0x80113a,%rax
+  802d3f:	00 00 00 
+  802d42:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d44:	83 f8 02             	cmp    $0x2,%eax
+  802d47:	7e 40                	jle    802d89 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802d49:	48 89 df             	mov    %rbx,%rdi
+  802d4c:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  802d53:	00 00 00 
+  802d56:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d58:	85 c0                	test   %eax,%eax
+  802d5a:	79 11                	jns    802d6d <devfile_read+0x87>
+  802d5c:	48 98                	cltq
+}
+  802d5e:	48 83 c4 28          	add    $0x28,%rsp
+  802d62:	5b                   	pop    %rbx
+  802d63:	41 5c                	pop    %r12
+  802d65:	41 5d                	pop    %r13
+  802d67:	41 5e                	pop    %r14
+  802d69:	41 5f                	pop    %r15
+  802d6b:	5d                   	pop    %rbp
+  802d6c:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d6d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d72:	4c 89 ea             	mov    %r13,%rdx
+  802d75:	4c 89 e6             	mov    %r12,%rsi
+  802d78:	48 89 df             	mov    %rbx,%rdi
+  802d7b:	48 b8 6e 2a 80 00 00 	movabs $0x802a6e,%rax
+  802d82:	00 00 00 
+  802d85:	ff d0                	call   *%rax
+  802d87:	eb d5                	jmp    802d5e <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d89:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d8d:	48 89 df             	mov    %rbx,%rdi
+  802d90:	48 b8 70 27 80 00 00 	movabs $0x802770,%rax
+  802d97:	00 00 00 
+  802d9a:	ff d0                	call   *%rax
+  802d9c:	85 c0                	test   %eax,%eax
+  802d9e:	0f 88 33 01 00 00    	js     802ed7 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802da4:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802dab:	00 00 00 
+  802dae:	4c 89 f0             	mov    %r14,%rax
+  802db1:	48 29 d0             	sub    %rdx,%rax
+  802db4:	48 c1 f8 03          	sar    $0x3,%rax
+  802db8:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802dbf:	aa aa aa 
+  802dc2:	48 0f af c2          	imul   %rdx,%rax
+  802dc6:	48 c1 e0 0e          	shl    $0xe,%rax
+  802dca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dce:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dd1:	41 39 06             	cmp    %eax,(%r14)
+  802dd4:	75 0d                	jne    802de3 <devfile_read+0xfd>
+  802dd6:	8b 43 10             	mov    0x10(%rbx),%eax
+  802dd9:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802ddd:	0f 84 fb 00 00 00    	je     802ede <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802de3:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802de8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802dec:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802def:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802df3:	48 89 c7             	mov    %rax,%rdi
+  802df6:	48 b8 e2 40 80 00 00 	movabs $0x8040e2,%rax
+  802dfd:	00 00 00 
+  802e00:	ff d0                	call   *%rax
+  802e02:	84 c0                	test   %al,%al
+  802e04:	75 27                	jne    802e2d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802e06:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e0b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e10:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e14:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e19:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  802e20:	00 00 00 
+  802e23:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802e25:	85 c0                	test   %eax,%eax
+  802e27:	0f 88 dc 00 00 00    	js     802f09 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802e2d:	44 89 f8             	mov    %r15d,%eax
+  802e30:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e35:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802e37:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802e3e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802e3f:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e42:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802e46:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802e49:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e4e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e52:	48 89 df             	mov    %rbx,%rdi
+  802e55:	48 b8 6e 2a 80 00 00 	movabs $0x802a6e,%rax
+  802e5c:	00 00 00 
+  802e5f:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e61:	48 85 c0             	test   %rax,%rax
+  802e64:	0f 88 f4 fe ff ff    	js     802d5e <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e6a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e6d:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e70:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802e73:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802e77:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802e7b:	48 63 d1             	movslq %ecx,%rdx
+  802e7e:	48 01 d0             	add    %rdx,%rax
+  802e81:	4d 63 ff             	movslq %r15d,%r15
+  802e84:	4c 29 f8             	sub    %r15,%rax
+  802e87:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e8c:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e90:	48 85 c0             	test   %rax,%rax
+  802e93:	0f 8e c5 fe ff ff    	jle    802d5e <devfile_read+0x78>
+    n = MIN(n, res);
+  802e99:	4c 39 e8             	cmp    %r13,%rax
+  802e9c:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802ea0:	8b 73 04             	mov    0x4(%rbx),%esi
+  802ea3:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802ea7:	48 63 f6             	movslq %esi,%rsi
+  802eaa:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802eaf:	48 01 c6             	add    %rax,%rsi
+  802eb2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802eb6:	48 01 c6             	add    %rax,%rsi
+  802eb9:	4c 89 ea             	mov    %r13,%rdx
+  802ebc:	4c 89 e7             	mov    %r12,%rdi
+  802ebf:	48 b8 77 0e 80 00 00 	movabs $0x800e77,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802ecb:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802ecf:	4c 89 e8             	mov    %r13,%rax
+  802ed2:	e9 87 fe ff ff       	jmp    802d5e <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ed7:	48 98                	cltq
+  802ed9:	e9 80 fe ff ff       	jmp    802d5e <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802ede:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ee2:	41 39 d7             	cmp    %edx,%r15d
+  802ee5:	0f 8c f8 fe ff ff    	jl     802de3 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802eeb:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802eef:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802ef2:	41 39 cf             	cmp    %ecx,%r15d
+  802ef5:	0f 8d e8 fe ff ff    	jge    802de3 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802efb:	4d 63 ff             	movslq %r15d,%r15
+  802efe:	4c 29 f8             	sub    %r15,%rax
+  802f01:	48 63 d2             	movslq %edx,%rdx
+  802f04:	48 01 d0             	add    %rdx,%rax
+  802f07:	eb 87                	jmp    802e90 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f09:	48 98                	cltq
+  802f0b:	e9 4e fe ff ff       	jmp    802d5e <devfile_read+0x78>
+        return E_INVAL;
+  802f10:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802f15:	c3                   	ret
+
+0000000000802f16 <fs_channel>:
+fs_channel(bool enable) {
+  802f16:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802f18:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802f1f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802f21:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f26:	40 84 ff             	test   %dil,%dil
+  802f29:	74 47                	je     802f72 <fs_channel+0x5c>
+  802f2b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802f32:	00 00 00 
+  802f35:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802f3b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802f42:	00 00 00 
+  802f45:	3b 08                	cmp    (%rax),%ecx
+  802f47:	74 29                	je     802f72 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802f49:	55                   	push   %rbp
+  802f4a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802f4d:	48 b8 96 1e 80 00 00 	movabs $0x801e96,%rax
+  802f54:	00 00 00 
+  802f57:	ff d0                	call   *%rax
+  802f59:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f5b:	85 c0                	test   %eax,%eax
+  802f5d:	78 04                	js     802f63 <fs_channel+0x4d>
+}
+  802f5f:	89 d0                	mov    %edx,%eax
+  802f61:	5d                   	pop    %rbp
+  802f62:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f63:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f6a:	00 00 00 
+  802f6d:	c6 00 00             	movb   $0x0,(%rax)
+  802f70:	eb ed                	jmp    802f5f <fs_channel+0x49>
+}
+  802f72:	89 d0                	mov    %edx,%eax
+  802f74:	c3                   	ret
+
+0000000000802f75 <open>:
+open(const char *path, int mode) {
+  802f75:	55                   	push   %rbp
+  802f76:	48 89 e5             	mov    %rsp,%rbp
+  802f79:	41 55                	push   %r13
+  802f7b:	41 54                	push   %r12
+  802f7d:	53                   	push   %rbx
+  802f7e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f82:	49 89 fc             	mov    %rdi,%r12
+  802f85:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f88:	48 b8 d8 0b 80 00 00 	movabs $0x800bd8,%rax
+  802f8f:	00 00 00 
+  802f92:	ff d0                	call   *%rax
+  802f94:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f9a:	0f 87 8f 00 00 00    	ja     80302f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802fa0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802fa4:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  802fab:	00 00 00 
+  802fae:	ff d0                	call   *%rax
+  802fb0:	89 c3                	mov    %eax,%ebx
+  802fb2:	85 c0                	test   %eax,%eax
+  802fb4:	78 55                	js     80300b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fb6:	4c 89 e6             	mov    %r12,%rsi
+  802fb9:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802fc0:	00 00 00 
+  802fc3:	48 89 df             	mov    %rbx,%rdi
+  802fc6:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  802fcd:	00 00 00 
+  802fd0:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802fd2:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802fd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fde:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fe2:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fe7:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  802fee:	00 00 00 
+  802ff1:	ff d0                	call   *%rax
+  802ff3:	89 c3                	mov    %eax,%ebx
+  802ff5:	85 c0                	test   %eax,%eax
+  802ff7:	78 1f                	js     803018 <open+0xa3>
+    return fd2num(fd);
+  802ff9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ffd:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  803004:	00 00 00 
+  803007:	ff d0                	call   *%rax
+  803009:	89 c3                	mov    %eax,%ebx
+}
+  80300b:	89 d8                	mov    %ebx,%eax
+  80300d:	48 83 c4 18          	add    $0x18,%rsp
+  803011:	5b                   	pop    %rbx
+  803012:	41 5c                	pop    %r12
+  803014:	41 5d                	pop    %r13
+  803016:	5d                   	pop    %rbp
+  803017:	c3                   	ret
+        fd_close(fd, 0);
+  803018:	be 00 00 00 00       	mov    $0x0,%esi
+  80301d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803021:	48 b8 6b 18 80 00 00 	movabs $0x80186b,%rax
+  803028:	00 00 00 
+  80302b:	ff d0                	call   *%rax
+        return res;
+  80302d:	eb dc                	jmp    80300b <open+0x96>
+        return -E_BAD_PATH;
+  80302f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803034:	eb d5                	jmp    80300b <open+0x96>
+
+0000000000803036 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803036:	55                   	push   %rbp
+  803037:	48 89 e5             	mov    %rsp,%rbp
+  80303a:	41 56                	push   %r14
+  80303c:	41 55                	push   %r13
+  80303e:	41 54                	push   %r12
+  803040:	53                   	push   %rbx
+  803041:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803045:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80304c:	00 00 00 
+  80304f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803054:	49 bd b0 17 80 00 00 	movabs $0x8017b0,%r13
+  80305b:	00 00 00 
+  80305e:	49 be 70 27 80 00 00 	movabs $0x802770,%r14
+  803065:	00 00 00 
+  803068:	eb 0c                	jmp    803076 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80306a:	83 c3 01             	add    $0x1,%ebx
+  80306d:	49 83 c4 18          	add    $0x18,%r12
+  803071:	83 fb 20             	cmp    $0x20,%ebx
+  803074:	74 1d                	je     803093 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803076:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80307b:	74 ed                	je     80306a <file_flush_buffers+0x34>
+  80307d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803081:	89 df                	mov    %ebx,%edi
+  803083:	41 ff d5             	call   *%r13
+  803086:	85 c0                	test   %eax,%eax
+  803088:	78 e0                	js     80306a <file_flush_buffers+0x34>
+  80308a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80308e:	41 ff d6             	call   *%r14
+  803091:	eb d7                	jmp    80306a <file_flush_buffers+0x34>
+}
+  803093:	48 83 c4 10          	add    $0x10,%rsp
+  803097:	5b                   	pop    %rbx
+  803098:	41 5c                	pop    %r12
+  80309a:	41 5d                	pop    %r13
+  80309c:	41 5e                	pop    %r14
+  80309e:	5d                   	pop    %rbp
+  80309f:	c3                   	ret
+
+00000000008030a0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8030a0:	55                   	push   %rbp
+  8030a1:	48 89 e5             	mov    %rsp,%rbp
+  8030a4:	41 54                	push   %r12
+  8030a6:	53                   	push   %rbx
+  8030a7:	49 89 fc             	mov    %rdi,%r12
+  8030aa:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8030ac:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  8030b3:	00 00 00 
+  8030b6:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8030b8:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8030bf:	00 00 00 
+  8030c2:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8030c7:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030c9:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8030cc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d1:	be 00 00 00 00       	mov    $0x0,%esi
+  8030d6:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030db:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  8030e2:	00 00 00 
+  8030e5:	ff d0                	call   *%rax
+}
+  8030e7:	5b                   	pop    %rbx
+  8030e8:	41 5c                	pop    %r12
+  8030ea:	5d                   	pop    %rbp
+  8030eb:	c3                   	ret
+
+00000000008030ec <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8030ec:	55                   	push   %rbp
+  8030ed:	48 89 e5             	mov    %rsp,%rbp
+  8030f0:	41 54                	push   %r12
+  8030f2:	53                   	push   %rbx
+  8030f3:	49 89 fc             	mov    %rdi,%r12
+  8030f6:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8030f9:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  803100:	00 00 00 
+  803103:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803105:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80310a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803111:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803113:	ba 00 00 00 00       	mov    $0x0,%edx
+  803118:	be 00 00 00 00       	mov    $0x0,%esi
+  80311d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803122:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  803129:	00 00 00 
+  80312c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80312e:	85 c0                	test   %eax,%eax
+  803130:	78 3d                	js     80316f <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803132:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803139:	00 00 00 
+  80313c:	4c 89 e6             	mov    %r12,%rsi
+  80313f:	48 89 df             	mov    %rbx,%rdi
+  803142:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  803149:	00 00 00 
+  80314c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80314e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803155:	00 
+  803156:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80315c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803163:	00 
+  803164:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80316a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80316f:	5b                   	pop    %rbx
+  803170:	41 5c                	pop    %r12
+  803172:	5d                   	pop    %rbp
+  803173:	c3                   	ret
+
+0000000000803174 <remove>:
+remove(const char *path) {
+  803174:	55                   	push   %rbp
+  803175:	48 89 e5             	mov    %rsp,%rbp
+  803178:	53                   	push   %rbx
+  803179:	48 83 ec 08          	sub    $0x8,%rsp
+  80317d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803180:	48 b8 d8 0b 80 00 00 	movabs $0x800bd8,%rax
+  803187:	00 00 00 
+  80318a:	ff d0                	call   *%rax
+  80318c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803192:	77 3a                	ja     8031ce <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803194:	48 89 de             	mov    %rbx,%rsi
+  803197:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80319e:	00 00 00 
+  8031a1:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  8031a8:	00 00 00 
+  8031ab:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8031ad:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031b2:	be 00 00 00 00       	mov    $0x0,%esi
+  8031b7:	bf 07 00 00 00       	mov    $0x7,%edi
+  8031bc:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+}
+  8031c8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031cc:	c9                   	leave
+  8031cd:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031ce:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031d3:	eb f3                	jmp    8031c8 <remove+0x54>
+
+00000000008031d5 <sync>:
+sync(void) {
+  8031d5:	55                   	push   %rbp
+  8031d6:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8031d9:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  8031e0:	00 00 00 
+  8031e3:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8031e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ef:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031f4:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+}
+  803200:	5d                   	pop    %rbp
+  803201:	c3                   	ret
+
+0000000000803202 <fsync>:
+fsync(int fdnum) {
+  803202:	55                   	push   %rbp
+  803203:	48 89 e5             	mov    %rsp,%rbp
+  803206:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80320a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80320e:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  803215:	00 00 00 
+  803218:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80321a:	85 c0                	test   %eax,%eax
+  80321c:	78 4b                	js     803269 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80321e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803222:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803229:	00 00 00 
+  80322c:	8b 00                	mov    (%rax),%eax
+  80322e:	39 02                	cmp    %eax,(%rdx)
+  803230:	75 39                	jne    80326b <fsync+0x69>
+    file_flush_buffers();
+  803232:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  803239:	00 00 00 
+  80323c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80323e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803242:	8b 40 0c             	mov    0xc(%rax),%eax
+  803245:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80324c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80324e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803253:	be 00 00 00 00       	mov    $0x0,%esi
+  803258:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80325d:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  803264:	00 00 00 
+  803267:	ff d0                	call   *%rax
+}
+  803269:	c9                   	leave
+  80326a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80326b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803270:	eb f7                	jmp    803269 <fsync+0x67>
+
+0000000000803272 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803272:	55                   	push   %rbp
+  803273:	48 89 e5             	mov    %rsp,%rbp
+  803276:	53                   	push   %rbx
+  803277:	48 83 ec 08          	sub    $0x8,%rsp
+  80327b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80327e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803283:	be 00 00 00 00       	mov    $0x0,%esi
+  803288:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80328d:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  803294:	00 00 00 
+  803297:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803299:	85 c0                	test   %eax,%eax
+  80329b:	78 2d                	js     8032ca <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80329d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032a4:	00 00 00 
+  8032a7:	48 8b 10             	mov    (%rax),%rdx
+  8032aa:	48 89 13             	mov    %rdx,(%rbx)
+  8032ad:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032b1:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032b5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032b9:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032bd:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032c1:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8032c5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032ca:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032ce:	c9                   	leave
+  8032cf:	c3                   	ret
+
+00000000008032d0 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8032d0:	55                   	push   %rbp
+  8032d1:	48 89 e5             	mov    %rsp,%rbp
+  8032d4:	53                   	push   %rbx
+  8032d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8032d9:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8032dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8032e6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8032eb:	48 b8 07 25 80 00 00 	movabs $0x802507,%rax
+  8032f2:	00 00 00 
+  8032f5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f7:	85 c0                	test   %eax,%eax
+  8032f9:	78 3d                	js     803338 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8032fb:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803302:	00 00 00 
+  803305:	48 8b 10             	mov    (%rax),%rdx
+  803308:	48 89 13             	mov    %rdx,(%rbx)
+  80330b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80330f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803313:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803317:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80331b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80331f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803323:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803327:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80332b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80332f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803333:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803338:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80333c:	c9                   	leave
+  80333d:	c3                   	ret
+
+000000000080333e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80333e:	55                   	push   %rbp
+  80333f:	48 89 e5             	mov    %rsp,%rbp
+  803342:	41 57                	push   %r15
+  803344:	41 56                	push   %r14
+  803346:	41 55                	push   %r13
+  803348:	41 54                	push   %r12
+  80334a:	53                   	push   %rbx
+  80334b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80334f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803356:	00 
+  803357:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80335e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803364:	0f 85 43 01 00 00    	jne    8034ad <munmap+0x16f>
+  80336a:	49 89 ff             	mov    %rdi,%r15
+  80336d:	4c 39 f7             	cmp    %r14,%rdi
+  803370:	0f 87 37 01 00 00    	ja     8034ad <munmap+0x16f>
+  803376:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80337d:	00 00 00 
+  803380:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803386:	eb 2c                	jmp    8033b4 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803388:	4c 39 f8             	cmp    %r15,%rax
+  80338b:	0f 83 85 00 00 00    	jae    803416 <munmap+0xd8>
+            m->mm_end = start;
+  803391:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803396:	48 83 c3 18          	add    $0x18,%rbx
+  80339a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8033a1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8033a8:	00 00 00 
+  8033ab:	48 39 c3             	cmp    %rax,%rbx
+  8033ae:	0f 84 d0 00 00 00    	je     803484 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8033b4:	49 89 dc             	mov    %rbx,%r12
+  8033b7:	48 8b 03             	mov    (%rbx),%rax
+  8033ba:	4c 39 f0             	cmp    %r14,%rax
+  8033bd:	73 d7                	jae    803396 <munmap+0x58>
+  8033bf:	48 85 c0             	test   %rax,%rax
+  8033c2:	74 d2                	je     803396 <munmap+0x58>
+  8033c4:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033c8:	49 39 d7             	cmp    %rdx,%r15
+  8033cb:	73 c9                	jae    803396 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8033cd:	49 39 d6             	cmp    %rdx,%r14
+  8033d0:	73 b6                	jae    803388 <munmap+0x4a>
+  8033d2:	49 39 c7             	cmp    %rax,%r15
+  8033d5:	76 b1                	jbe    803388 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8033d7:	4c 89 ef             	mov    %r13,%rdi
+  8033da:	48 b8 75 24 80 00 00 	movabs $0x802475,%rax
+  8033e1:	00 00 00 
+  8033e4:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8033e6:	48 85 c0             	test   %rax,%rax
+  8033e9:	0f 84 c5 00 00 00    	je     8034b4 <munmap+0x176>
+            *tail = *m;
+  8033ef:	48 8b 13             	mov    (%rbx),%rdx
+  8033f2:	48 89 10             	mov    %rdx,(%rax)
+  8033f5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033f9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8033fd:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803401:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803405:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803408:	44 89 f2             	mov    %r14d,%edx
+  80340b:	2b 13                	sub    (%rbx),%edx
+  80340d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803410:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803414:	eb 80                	jmp    803396 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803416:	49 39 d6             	cmp    %rdx,%r14
+  803419:	73 18                	jae    803433 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80341b:	44 89 f2             	mov    %r14d,%edx
+  80341e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803423:	29 c2                	sub    %eax,%edx
+  803425:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80342a:	4d 89 34 24          	mov    %r14,(%r12)
+  80342e:	e9 63 ff ff ff       	jmp    803396 <munmap+0x58>
+    m->mm_start = 0;
+  803433:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80343a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80343b:	4c 89 e6             	mov    %r12,%rsi
+  80343e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803445:	00 00 00 
+  803448:	48 29 c6             	sub    %rax,%rsi
+  80344b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80344f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803456:	aa aa aa 
+  803459:	48 0f af f0          	imul   %rax,%rsi
+  80345d:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803461:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803466:	48 01 c6             	add    %rax,%rsi
+  803469:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80346e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803473:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  80347a:	00 00 00 
+  80347d:	ff d0                	call   *%rax
+}
+  80347f:	e9 12 ff ff ff       	jmp    803396 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803484:	4c 89 f2             	mov    %r14,%rdx
+  803487:	4c 29 fa             	sub    %r15,%rdx
+  80348a:	4c 89 fe             	mov    %r15,%rsi
+  80348d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803492:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  803499:	00 00 00 
+  80349c:	ff d0                	call   *%rax
+}
+  80349e:	48 83 c4 08          	add    $0x8,%rsp
+  8034a2:	5b                   	pop    %rbx
+  8034a3:	41 5c                	pop    %r12
+  8034a5:	41 5d                	pop    %r13
+  8034a7:	41 5e                	pop    %r14
+  8034a9:	41 5f                	pop    %r15
+  8034ab:	5d                   	pop    %rbp
+  8034ac:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034ad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034b2:	eb ea                	jmp    80349e <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8034b4:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8034b9:	eb e3                	jmp    80349e <munmap+0x160>
+
+00000000008034bb <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8034bb:	55                   	push   %rbp
+  8034bc:	48 89 e5             	mov    %rsp,%rbp
+  8034bf:	41 57                	push   %r15
+  8034c1:	41 56                	push   %r14
+  8034c3:	41 55                	push   %r13
+  8034c5:	41 54                	push   %r12
+  8034c7:	53                   	push   %rbx
+  8034c8:	48 83 ec 28          	sub    $0x28,%rsp
+  8034cc:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8034d0:	49 89 f5             	mov    %rsi,%r13
+  8034d3:	41 89 d6             	mov    %edx,%r14d
+  8034d6:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8034d9:	41 89 cc             	mov    %ecx,%r12d
+  8034dc:	44 89 c7             	mov    %r8d,%edi
+  8034df:	44 89 cb             	mov    %r9d,%ebx
+  8034e2:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034e6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034ea:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  8034f1:	00 00 00 
+  8034f4:	ff d0                	call   *%rax
+  8034f6:	41 89 c7             	mov    %eax,%r15d
+  8034f9:	85 c0                	test   %eax,%eax
+  8034fb:	0f 88 ae 01 00 00    	js     8036af <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803501:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803505:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80350c:	00 00 00 
+  80350f:	8b 32                	mov    (%rdx),%esi
+  803511:	39 30                	cmp    %esi,(%rax)
+  803513:	0f 85 7a 02 00 00    	jne    803793 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803519:	8b 40 08             	mov    0x8(%rax),%eax
+  80351c:	83 e0 03             	and    $0x3,%eax
+  80351f:	83 f8 01             	cmp    $0x1,%eax
+  803522:	0f 84 76 02 00 00    	je     80379e <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803528:	4d 85 ed             	test   %r13,%r13
+  80352b:	0f 84 78 02 00 00    	je     8037a9 <mmap+0x2ee>
+  803531:	85 db                	test   %ebx,%ebx
+  803533:	0f 88 70 02 00 00    	js     8037a9 <mmap+0x2ee>
+  803539:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80353f:	41 89 df             	mov    %ebx,%r15d
+  803542:	0f 85 6c 02 00 00    	jne    8037b4 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803548:	44 89 f0             	mov    %r14d,%eax
+  80354b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80354e:	83 f8 04             	cmp    $0x4,%eax
+  803551:	0f 85 68 02 00 00    	jne    8037bf <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803557:	44 89 e1             	mov    %r12d,%ecx
+  80355a:	83 e1 01             	and    $0x1,%ecx
+  80355d:	0f 95 c2             	setne  %dl
+  803560:	44 89 e0             	mov    %r12d,%eax
+  803563:	d1 e8                	shr    %eax
+  803565:	83 f0 01             	xor    $0x1,%eax
+  803568:	83 e0 01             	and    $0x1,%eax
+  80356b:	38 c2                	cmp    %al,%dl
+  80356d:	0f 85 57 02 00 00    	jne    8037ca <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803573:	85 c9                	test   %ecx,%ecx
+  803575:	74 0a                	je     803581 <mmap+0xc6>
+  803577:	41 f6 c6 02          	test   $0x2,%r14b
+  80357b:	0f 85 54 02 00 00    	jne    8037d5 <mmap+0x31a>
+    file_flush_buffers();
+  803581:	48 b8 36 30 80 00 00 	movabs $0x803036,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80358d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803594:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80359b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80359f:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8035a2:	41 f6 c4 04          	test   $0x4,%r12b
+  8035a6:	0f 84 15 01 00 00    	je     8036c1 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8035ac:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8035af:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035b5:	0f 85 25 02 00 00    	jne    8037e0 <mmap+0x325>
+  8035bb:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8035bf:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8035c6:	00 00 00 
+  8035c9:	48 39 c2             	cmp    %rax,%rdx
+  8035cc:	0f 82 19 02 00 00    	jb     8037eb <mmap+0x330>
+  8035d2:	48 39 c7             	cmp    %rax,%rdi
+  8035d5:	0f 87 10 02 00 00    	ja     8037eb <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8035db:	4c 89 ee             	mov    %r13,%rsi
+  8035de:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  8035e5:	00 00 00 
+  8035e8:	ff d0                	call   *%rax
+  8035ea:	85 c0                	test   %eax,%eax
+  8035ec:	0f 88 04 02 00 00    	js     8037f6 <mmap+0x33b>
+    if (!handler) {
+  8035f2:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035f9:	00 00 00 
+  8035fc:	80 38 00             	cmpb   $0x0,(%rax)
+  8035ff:	75 2b                	jne    80362c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803601:	48 bf d6 23 80 00 00 	movabs $0x8023d6,%rdi
+  803608:	00 00 00 
+  80360b:	48 b8 de 46 80 00 00 	movabs $0x8046de,%rax
+  803612:	00 00 00 
+  803615:	ff d0                	call   *%rax
+  803617:	85 c0                	test   %eax,%eax
+  803619:	0f 88 ea 01 00 00    	js     803809 <mmap+0x34e>
+        handler = 1;
+  80361f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803626:	00 00 00 
+  803629:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80362c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803630:	48 b8 75 24 80 00 00 	movabs $0x802475,%rax
+  803637:	00 00 00 
+  80363a:	ff d0                	call   *%rax
+  80363c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80363f:	48 85 c0             	test   %rax,%rax
+  803642:	0f 84 c9 01 00 00    	je     803811 <mmap+0x356>
+    m->mm_start = va;
+  803648:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80364b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80364f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803653:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803656:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80365a:	44 89 e0             	mov    %r12d,%eax
+  80365d:	c1 e0 06             	shl    $0x6,%eax
+  803660:	25 80 00 00 00       	and    $0x80,%eax
+  803665:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803668:	09 f0                	or     %esi,%eax
+  80366a:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80366e:	41 f6 c4 08          	test   $0x8,%r12b
+  803672:	74 31                	je     8036a5 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803674:	48 39 d3             	cmp    %rdx,%rbx
+  803677:	73 2c                	jae    8036a5 <mmap+0x1ea>
+  803679:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80367e:	48 89 de             	mov    %rbx,%rsi
+  803681:	4c 89 f7             	mov    %r14,%rdi
+  803684:	48 b8 c5 22 80 00 00 	movabs $0x8022c5,%rax
+  80368b:	00 00 00 
+  80368e:	ff d0                	call   *%rax
+  803690:	49 89 c4             	mov    %rax,%r12
+  803693:	48 85 c0             	test   %rax,%rax
+  803696:	0f 8e d7 00 00 00    	jle    803773 <mmap+0x2b8>
+            va += n;
+  80369c:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80369f:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8036a3:	72 d4                	jb     803679 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8036a5:	49 8b 06             	mov    (%r14),%rax
+  8036a8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8036ac:	48 89 06             	mov    %rax,(%rsi)
+}
+  8036af:	44 89 f8             	mov    %r15d,%eax
+  8036b2:	48 83 c4 28          	add    $0x28,%rsp
+  8036b6:	5b                   	pop    %rbx
+  8036b7:	41 5c                	pop    %r12
+  8036b9:	41 5d                	pop    %r13
+  8036bb:	41 5e                	pop    %r14
+  8036bd:	41 5f                	pop    %r15
+  8036bf:	5d                   	pop    %rbp
+  8036c0:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036c1:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8036c8:	00 00 00 
+  8036cb:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8036ce:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8036d5:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036d8:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036dd:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8036e4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036e7:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8036ee:	00 00 00 
+  8036f1:	48 39 d7             	cmp    %rdx,%rdi
+  8036f4:	73 1c                	jae    803712 <mmap+0x257>
+        return -E_NO_MEM;
+  8036f6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036fc:	eb b1                	jmp    8036af <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036fe:	48 83 c0 01          	add    $0x1,%rax
+  803702:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803706:	77 3f                	ja     803747 <mmap+0x28c>
+  803708:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80370d:	48 39 d7             	cmp    %rdx,%rdi
+  803710:	72 2a                	jb     80373c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803712:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803716:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80371a:	48 39 d1             	cmp    %rdx,%rcx
+  80371d:	73 df                	jae    8036fe <mmap+0x243>
+  80371f:	48 85 c9             	test   %rcx,%rcx
+  803722:	74 da                	je     8036fe <mmap+0x243>
+  803724:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803728:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80372d:	48 39 d3             	cmp    %rdx,%rbx
+  803730:	73 cc                	jae    8036fe <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803732:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803735:	b8 00 00 00 00       	mov    $0x0,%eax
+  80373a:	eb cc                	jmp    803708 <mmap+0x24d>
+        return -E_NO_MEM;
+  80373c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803742:	e9 68 ff ff ff       	jmp    8036af <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803747:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80374c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803753:	00 00 00 
+  803756:	48 39 c2             	cmp    %rax,%rdx
+  803759:	0f 82 9f 00 00 00    	jb     8037fe <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80375f:	48 85 db             	test   %rbx,%rbx
+  803762:	0f 85 8a fe ff ff    	jne    8035f2 <mmap+0x137>
+        return -E_NO_MEM;
+  803768:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80376e:	e9 3c ff ff ff       	jmp    8036af <mmap+0x1f4>
+        if (n < 0) {
+  803773:	0f 89 2c ff ff ff    	jns    8036a5 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803779:	49 8b 3e             	mov    (%r14),%rdi
+  80377c:	4c 89 ee             	mov    %r13,%rsi
+  80377f:	48 b8 3e 33 80 00 00 	movabs $0x80333e,%rax
+  803786:	00 00 00 
+  803789:	ff d0                	call   *%rax
+            return n;
+  80378b:	45 89 e7             	mov    %r12d,%r15d
+  80378e:	e9 1c ff ff ff       	jmp    8036af <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803793:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803799:	e9 11 ff ff ff       	jmp    8036af <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80379e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037a4:	e9 06 ff ff ff       	jmp    8036af <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8037a9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037af:	e9 fb fe ff ff       	jmp    8036af <mmap+0x1f4>
+  8037b4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037ba:	e9 f0 fe ff ff       	jmp    8036af <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8037bf:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037c5:	e9 e5 fe ff ff       	jmp    8036af <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037ca:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037d0:	e9 da fe ff ff       	jmp    8036af <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037d5:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8037db:	e9 cf fe ff ff       	jmp    8036af <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037e0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037e6:	e9 c4 fe ff ff       	jmp    8036af <mmap+0x1f4>
+  8037eb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037f1:	e9 b9 fe ff ff       	jmp    8036af <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8037f6:	41 89 c7             	mov    %eax,%r15d
+  8037f9:	e9 b1 fe ff ff       	jmp    8036af <mmap+0x1f4>
+        return -E_NO_MEM;
+  8037fe:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803804:	e9 a6 fe ff ff       	jmp    8036af <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803809:	41 89 c7             	mov    %eax,%r15d
+  80380c:	e9 9e fe ff ff       	jmp    8036af <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803811:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803817:	e9 93 fe ff ff       	jmp    8036af <mmap+0x1f4>
+
+000000000080381c <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  80381c:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803820:	7f 01                	jg     803823 <writebuf+0x7>
+  803822:	c3                   	ret
+writebuf(struct printbuf *state) {
+  803823:	55                   	push   %rbp
+  803824:	48 89 e5             	mov    %rsp,%rbp
+  803827:	53                   	push   %rbx
+  803828:	48 83 ec 08          	sub    $0x8,%rsp
+  80382c:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  80382f:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  803833:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  803837:	8b 3f                	mov    (%rdi),%edi
+  803839:	48 b8 c2 1b 80 00 00 	movabs $0x801bc2,%rax
+  803840:	00 00 00 
+  803843:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  803845:	48 85 c0             	test   %rax,%rax
+  803848:	7e 04                	jle    80384e <writebuf+0x32>
+  80384a:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  80384e:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803852:	48 39 c2             	cmp    %rax,%rdx
+  803855:	74 0f                	je     803866 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  803857:	48 85 c0             	test   %rax,%rax
+  80385a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80385f:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803863:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  803866:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80386a:	c9                   	leave
+  80386b:	c3                   	ret
+
+000000000080386c <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  80386c:	8b 46 04             	mov    0x4(%rsi),%eax
+  80386f:	8d 50 01             	lea    0x1(%rax),%edx
+  803872:	89 56 04             	mov    %edx,0x4(%rsi)
+  803875:	48 98                	cltq
+  803877:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  80387c:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803882:	74 01                	je     803885 <putch+0x19>
+  803884:	c3                   	ret
+putch(int ch, void *arg) {
+  803885:	55                   	push   %rbp
+  803886:	48 89 e5             	mov    %rsp,%rbp
+  803889:	53                   	push   %rbx
+  80388a:	48 83 ec 08          	sub    $0x8,%rsp
+  80388e:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803891:	48 89 f7             	mov    %rsi,%rdi
+  803894:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  80389b:	00 00 00 
+  80389e:	ff d0                	call   *%rax
+        state->offset = 0;
+  8038a0:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  8038a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038ab:	c9                   	leave
+  8038ac:	c3                   	ret
+
+00000000008038ad <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8038ad:	55                   	push   %rbp
+  8038ae:	48 89 e5             	mov    %rsp,%rbp
+  8038b1:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8038b8:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8038bb:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8038c1:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8038c8:	00 00 00 
+    state.result = 0;
+  8038cb:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8038d2:	00 00 00 00 
+    state.error = 1;
+  8038d6:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8038dd:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8038e0:	48 89 f2             	mov    %rsi,%rdx
+  8038e3:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8038ea:	48 bf 6c 38 80 00 00 	movabs $0x80386c,%rdi
+  8038f1:	00 00 00 
+  8038f4:	48 b8 41 04 80 00 00 	movabs $0x800441,%rax
+  8038fb:	00 00 00 
+  8038fe:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  803900:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  803907:	7f 14                	jg     80391d <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803909:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803910:	48 85 c0             	test   %rax,%rax
+  803913:	75 06                	jne    80391b <vfprintf+0x6e>
+  803915:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  80391b:	c9                   	leave
+  80391c:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  80391d:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  803924:	48 b8 1c 38 80 00 00 	movabs $0x80381c,%rax
+  80392b:	00 00 00 
+  80392e:	ff d0                	call   *%rax
+  803930:	eb d7                	jmp    803909 <vfprintf+0x5c>
+
+0000000000803932 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803932:	55                   	push   %rbp
+  803933:	48 89 e5             	mov    %rsp,%rbp
+  803936:	48 83 ec 50          	sub    $0x50,%rsp
+  80393a:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80393e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803942:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803946:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80394a:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803951:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803955:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803959:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80395d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803961:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  803965:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  80396c:	00 00 00 
+  80396f:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803971:	c9                   	leave
+  803972:	c3                   	ret
+
+0000000000803973 <printf>:
+
+int
+printf(const char *fmt, ...) {
+  803973:	55                   	push   %rbp
+  803974:	48 89 e5             	mov    %rsp,%rbp
+  803977:	48 83 ec 50          	sub    $0x50,%rsp
+  80397b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80397f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803983:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803987:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80398b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80398f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  803996:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80399a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80399e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8039a2:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  8039a6:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8039aa:	48 89 fe             	mov    %rdi,%rsi
+  8039ad:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039b2:	48 b8 ad 38 80 00 00 	movabs $0x8038ad,%rax
+  8039b9:	00 00 00 
+  8039bc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8039be:	c9                   	leave
+  8039bf:	c3                   	ret
+
+00000000008039c0 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039c0:	55                   	push   %rbp
+  8039c1:	48 89 e5             	mov    %rsp,%rbp
+  8039c4:	41 54                	push   %r12
+  8039c6:	53                   	push   %rbx
+  8039c7:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039ca:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  8039d1:	00 00 00 
+  8039d4:	ff d0                	call   *%rax
+  8039d6:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039d9:	48 be 80 51 80 00 00 	movabs $0x805180,%rsi
+  8039e0:	00 00 00 
+  8039e3:	48 89 df             	mov    %rbx,%rdi
+  8039e6:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  8039ed:	00 00 00 
+  8039f0:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039f2:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039f7:	41 2b 04 24          	sub    (%r12),%eax
+  8039fb:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a01:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a08:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a0b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a12:	00 00 00 
+  803a15:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a1c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a21:	5b                   	pop    %rbx
+  803a22:	41 5c                	pop    %r12
+  803a24:	5d                   	pop    %rbp
+  803a25:	c3                   	ret
+
+0000000000803a26 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a26:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a29:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a2f:	8b 17                	mov    (%rdi),%edx
+  803a31:	85 d2                	test   %edx,%edx
+  803a33:	75 01                	jne    803a36 <pipe_wakeup+0x10>
+  803a35:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a36:	55                   	push   %rbp
+  803a37:	48 89 e5             	mov    %rsp,%rbp
+  803a3a:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a3d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a43:	be 00 04 00 00       	mov    $0x400,%esi
+  803a48:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  803a4f:	00 00 00 
+  803a52:	ff d0                	call   *%rax
+}
+  803a54:	5d                   	pop    %rbp
+  803a55:	c3                   	ret
+
+0000000000803a56 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a56:	55                   	push   %rbp
+  803a57:	48 89 e5             	mov    %rsp,%rbp
+  803a5a:	41 55                	push   %r13
+  803a5c:	41 54                	push   %r12
+  803a5e:	53                   	push   %rbx
+  803a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  803a63:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a66:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803a6d:	00 00 00 
+  803a70:	ff d0                	call   *%rax
+  803a72:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a75:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a7a:	4c 89 e6             	mov    %r12,%rsi
+  803a7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a82:	49 bc 1b 12 80 00 00 	movabs $0x80121b,%r12
+  803a89:	00 00 00 
+  803a8c:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a8f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a93:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a97:	49 bd 26 3a 80 00 00 	movabs $0x803a26,%r13
+  803a9e:	00 00 00 
+  803aa1:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803aa4:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803aa8:	48 89 de             	mov    %rbx,%rsi
+  803aab:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803aae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ab3:	48 89 de             	mov    %rbx,%rsi
+  803ab6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803abb:	41 ff d4             	call   *%r12
+  803abe:	48 83 c4 08          	add    $0x8,%rsp
+  803ac2:	5b                   	pop    %rbx
+  803ac3:	41 5c                	pop    %r12
+  803ac5:	41 5d                	pop    %r13
+  803ac7:	5d                   	pop    %rbp
+  803ac8:	c3                   	ret
+
+0000000000803ac9 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ac9:	55                   	push   %rbp
+  803aca:	48 89 e5             	mov    %rsp,%rbp
+  803acd:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ad0:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ad5:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ada:	48 b8 5e 11 80 00 00 	movabs $0x80115e,%rax
+  803ae1:	00 00 00 
+  803ae4:	ff d0                	call   *%rax
+  803ae6:	85 c0                	test   %eax,%eax
+  803ae8:	0f 94 c0             	sete   %al
+  803aeb:	0f b6 c0             	movzbl %al,%eax
+}
+  803aee:	5d                   	pop    %rbp
+  803aef:	c3                   	ret
+
+0000000000803af0 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803af0:	55                   	push   %rbp
+  803af1:	48 89 e5             	mov    %rsp,%rbp
+  803af4:	41 57                	push   %r15
+  803af6:	41 56                	push   %r14
+  803af8:	41 55                	push   %r13
+  803afa:	41 54                	push   %r12
+  803afc:	53                   	push   %rbx
+  803afd:	48 83 ec 38          	sub    $0x38,%rsp
+  803b01:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b05:	49 89 f4             	mov    %rsi,%r12
+  803b08:	49 89 d7             	mov    %rdx,%r15
+  803b0b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b0f:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803b16:	00 00 00 
+  803b19:	ff d0                	call   *%rax
+  803b1b:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b1e:	4d 85 ff             	test   %r15,%r15
+  803b21:	0f 84 f1 00 00 00    	je     803c18 <devpipe_write+0x128>
+  803b27:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b2b:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b2f:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b33:	49 bd c9 3a 80 00 00 	movabs $0x803ac9,%r13
+  803b3a:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b3d:	49 bf 26 3a 80 00 00 	movabs $0x803a26,%r15
+  803b44:	00 00 00 
+  803b47:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b4b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b4f:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b53:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b56:	48 63 ce             	movslq %esi,%rcx
+  803b59:	48 63 03             	movslq (%rbx),%rax
+  803b5c:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b62:	48 39 c1             	cmp    %rax,%rcx
+  803b65:	72 64                	jb     803bcb <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b67:	48 89 de             	mov    %rbx,%rsi
+  803b6a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b6e:	41 ff d5             	call   *%r13
+  803b71:	85 c0                	test   %eax,%eax
+  803b73:	0f 85 b9 00 00 00    	jne    803c32 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b79:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b7d:	4c 89 f7             	mov    %r14,%rdi
+  803b80:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b83:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b86:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b8d:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b94:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b9a:	8b 03                	mov    (%rbx),%eax
+  803b9c:	41 39 c4             	cmp    %eax,%r12d
+  803b9f:	75 b2                	jne    803b53 <devpipe_write+0x63>
+  803ba1:	48 89 de             	mov    %rbx,%rsi
+  803ba4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ba8:	41 ff d5             	call   *%r13
+  803bab:	85 c0                	test   %eax,%eax
+  803bad:	75 a0                	jne    803b4f <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803baf:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bb4:	44 89 e6             	mov    %r12d,%esi
+  803bb7:	48 89 df             	mov    %rbx,%rdi
+  803bba:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  803bc1:	00 00 00 
+  803bc4:	ff d0                	call   *%rax
+  803bc6:	e9 7c ff ff ff       	jmp    803b47 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bcb:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bcf:	41 0f b6 38          	movzbl (%r8),%edi
+  803bd3:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bda:	80 80 80 
+  803bdd:	48 89 c8             	mov    %rcx,%rax
+  803be0:	48 f7 e2             	mul    %rdx
+  803be3:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803be7:	48 89 d0             	mov    %rdx,%rax
+  803bea:	48 c1 e0 08          	shl    $0x8,%rax
+  803bee:	48 29 d0             	sub    %rdx,%rax
+  803bf1:	48 c1 e0 04          	shl    $0x4,%rax
+  803bf5:	48 29 c1             	sub    %rax,%rcx
+  803bf8:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803bfd:	83 c6 01             	add    $0x1,%esi
+  803c00:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c03:	49 83 c0 01          	add    $0x1,%r8
+  803c07:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c0b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c0f:	49 39 c0             	cmp    %rax,%r8
+  803c12:	0f 85 2f ff ff ff    	jne    803b47 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c18:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c1c:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c20:	48 b8 26 3a 80 00 00 	movabs $0x803a26,%rax
+  803c27:	00 00 00 
+  803c2a:	ff d0                	call   *%rax
+    return n;
+  803c2c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c30:	eb 05                	jmp    803c37 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c32:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c37:	48 83 c4 38          	add    $0x38,%rsp
+  803c3b:	5b                   	pop    %rbx
+  803c3c:	41 5c                	pop    %r12
+  803c3e:	41 5d                	pop    %r13
+  803c40:	41 5e                	pop    %r14
+  803c42:	41 5f                	pop    %r15
+  803c44:	5d                   	pop    %rbp
+  803c45:	c3                   	ret
+
+0000000000803c46 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c46:	55                   	push   %rbp
+  803c47:	48 89 e5             	mov    %rsp,%rbp
+  803c4a:	41 57                	push   %r15
+  803c4c:	41 56                	push   %r14
+  803c4e:	41 55                	push   %r13
+  803c50:	41 54                	push   %r12
+  803c52:	53                   	push   %rbx
+  803c53:	48 83 ec 28          	sub    $0x28,%rsp
+  803c57:	49 89 fd             	mov    %rdi,%r13
+  803c5a:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c5e:	49 89 d4             	mov    %rdx,%r12
+  803c61:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c65:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803c6c:	00 00 00 
+  803c6f:	ff d0                	call   *%rax
+  803c71:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c74:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c7a:	49 bf c9 3a 80 00 00 	movabs $0x803ac9,%r15
+  803c81:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c84:	4d 85 e4             	test   %r12,%r12
+  803c87:	0f 84 d5 00 00 00    	je     803d62 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c8d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c91:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c95:	8b 03                	mov    (%rbx),%eax
+  803c97:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c9a:	75 7a                	jne    803d16 <devpipe_read+0xd0>
+            if (i > 0) {
+  803c9c:	4d 85 f6             	test   %r14,%r14
+  803c9f:	75 50                	jne    803cf1 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803ca1:	48 89 de             	mov    %rbx,%rsi
+  803ca4:	4c 89 ef             	mov    %r13,%rdi
+  803ca7:	41 ff d7             	call   *%r15
+  803caa:	85 c0                	test   %eax,%eax
+  803cac:	0f 85 c9 00 00 00    	jne    803d7b <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cb2:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803cb5:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cbc:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cc2:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cc5:	41 39 c4             	cmp    %eax,%r12d
+  803cc8:	75 cb                	jne    803c95 <devpipe_read+0x4f>
+  803cca:	48 89 de             	mov    %rbx,%rsi
+  803ccd:	4c 89 ef             	mov    %r13,%rdi
+  803cd0:	41 ff d7             	call   *%r15
+  803cd3:	85 c0                	test   %eax,%eax
+  803cd5:	75 be                	jne    803c95 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cd7:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cdc:	44 89 e6             	mov    %r12d,%esi
+  803cdf:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ce3:	48 b8 e3 14 80 00 00 	movabs $0x8014e3,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+  803cef:	eb a4                	jmp    803c95 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803cf1:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803cf5:	48 89 de             	mov    %rbx,%rsi
+  803cf8:	48 b8 26 3a 80 00 00 	movabs $0x803a26,%rax
+  803cff:	00 00 00 
+  803d02:	ff d0                	call   *%rax
+                return i;
+  803d04:	4c 89 f0             	mov    %r14,%rax
+}
+  803d07:	48 83 c4 28          	add    $0x28,%rsp
+  803d0b:	5b                   	pop    %rbx
+  803d0c:	41 5c                	pop    %r12
+  803d0e:	41 5d                	pop    %r13
+  803d10:	41 5e                	pop    %r14
+  803d12:	41 5f                	pop    %r15
+  803d14:	5d                   	pop    %rbp
+  803d15:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d16:	48 63 c8             	movslq %eax,%rcx
+  803d19:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d20:	80 80 80 
+  803d23:	48 89 c8             	mov    %rcx,%rax
+  803d26:	48 f7 e2             	mul    %rdx
+  803d29:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d2d:	48 89 d0             	mov    %rdx,%rax
+  803d30:	48 c1 e0 08          	shl    $0x8,%rax
+  803d34:	48 29 d0             	sub    %rdx,%rax
+  803d37:	48 c1 e0 04          	shl    $0x4,%rax
+  803d3b:	48 89 c2             	mov    %rax,%rdx
+  803d3e:	48 89 c8             	mov    %rcx,%rax
+  803d41:	48 29 d0             	sub    %rdx,%rax
+  803d44:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d49:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d4d:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d51:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d54:	49 83 c6 01          	add    $0x1,%r14
+  803d58:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d5c:	0f 85 2b ff ff ff    	jne    803c8d <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d62:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d66:	48 89 de             	mov    %rbx,%rsi
+  803d69:	48 b8 26 3a 80 00 00 	movabs $0x803a26,%rax
+  803d70:	00 00 00 
+  803d73:	ff d0                	call   *%rax
+    return n;
+  803d75:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d79:	eb 8c                	jmp    803d07 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d7b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d80:	eb 85                	jmp    803d07 <devpipe_read+0xc1>
+
+0000000000803d82 <pipe>:
+pipe(int pfd[2]) {
+  803d82:	55                   	push   %rbp
+  803d83:	48 89 e5             	mov    %rsp,%rbp
+  803d86:	41 55                	push   %r13
+  803d88:	41 54                	push   %r12
+  803d8a:	53                   	push   %rbx
+  803d8b:	48 83 ec 18          	sub    $0x18,%rsp
+  803d8f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d92:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d96:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  803d9d:	00 00 00 
+  803da0:	ff d0                	call   *%rax
+  803da2:	89 c3                	mov    %eax,%ebx
+  803da4:	85 c0                	test   %eax,%eax
+  803da6:	0f 88 a0 01 00 00    	js     803f4c <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803dac:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803db1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803db6:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dba:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dbf:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803dc6:	00 00 00 
+  803dc9:	ff d0                	call   *%rax
+  803dcb:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803dcd:	85 c0                	test   %eax,%eax
+  803dcf:	0f 88 77 01 00 00    	js     803f4c <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dd5:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dd9:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  803de0:	00 00 00 
+  803de3:	ff d0                	call   *%rax
+  803de5:	89 c3                	mov    %eax,%ebx
+  803de7:	85 c0                	test   %eax,%eax
+  803de9:	0f 88 43 01 00 00    	js     803f32 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803def:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803df4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803dfd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e02:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803e09:	00 00 00 
+  803e0c:	ff d0                	call   *%rax
+  803e0e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e10:	85 c0                	test   %eax,%eax
+  803e12:	0f 88 1a 01 00 00    	js     803f32 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e18:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e1c:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+  803e28:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e2b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e30:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e35:	48 89 c6             	mov    %rax,%rsi
+  803e38:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e3d:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  803e44:	00 00 00 
+  803e47:	ff d0                	call   *%rax
+  803e49:	89 c3                	mov    %eax,%ebx
+  803e4b:	85 c0                	test   %eax,%eax
+  803e4d:	0f 88 c5 00 00 00    	js     803f18 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e53:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e57:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803e5e:	00 00 00 
+  803e61:	ff d0                	call   *%rax
+  803e63:	48 89 c1             	mov    %rax,%rcx
+  803e66:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e6c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e72:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e77:	4c 89 ee             	mov    %r13,%rsi
+  803e7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e7f:	48 b8 cb 11 80 00 00 	movabs $0x8011cb,%rax
+  803e86:	00 00 00 
+  803e89:	ff d0                	call   *%rax
+  803e8b:	89 c3                	mov    %eax,%ebx
+  803e8d:	85 c0                	test   %eax,%eax
+  803e8f:	78 6e                	js     803eff <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e91:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e96:	4c 89 ef             	mov    %r13,%rdi
+  803e99:	48 b8 3a 11 80 00 00 	movabs $0x80113a,%rax
+  803ea0:	00 00 00 
+  803ea3:	ff d0                	call   *%rax
+  803ea5:	83 f8 02             	cmp    $0x2,%eax
+  803ea8:	0f 85 ab 00 00 00    	jne    803f59 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803eae:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803eb5:	00 00 
+  803eb7:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ebb:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ebd:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ec1:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ec8:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ecc:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ece:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ed2:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ed9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803edd:	48 bb 22 17 80 00 00 	movabs $0x801722,%rbx
+  803ee4:	00 00 00 
+  803ee7:	ff d3                	call   *%rbx
+  803ee9:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803eed:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ef1:	ff d3                	call   *%rbx
+  803ef3:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ef8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803efd:	eb 4d                	jmp    803f4c <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803eff:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f04:	4c 89 ee             	mov    %r13,%rsi
+  803f07:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0c:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  803f13:	00 00 00 
+  803f16:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f18:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f1d:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f21:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f26:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  803f2d:	00 00 00 
+  803f30:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f32:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f37:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f3b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f40:	48 b8 1b 12 80 00 00 	movabs $0x80121b,%rax
+  803f47:	00 00 00 
+  803f4a:	ff d0                	call   *%rax
+}
+  803f4c:	89 d8                	mov    %ebx,%eax
+  803f4e:	48 83 c4 18          	add    $0x18,%rsp
+  803f52:	5b                   	pop    %rbx
+  803f53:	41 5c                	pop    %r12
+  803f55:	41 5d                	pop    %r13
+  803f57:	5d                   	pop    %rbp
+  803f58:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f59:	48 b9 b0 51 80 00 00 	movabs $0x8051b0,%rcx
+  803f60:	00 00 00 
+  803f63:	48 ba 87 51 80 00 00 	movabs $0x805187,%rdx
+  803f6a:	00 00 00 
+  803f6d:	be 50 00 00 00       	mov    $0x50,%esi
+  803f72:	48 bf 9c 51 80 00 00 	movabs $0x80519c,%rdi
+  803f79:	00 00 00 
+  803f7c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f81:	49 b8 b1 45 80 00 00 	movabs $0x8045b1,%r8
+  803f88:	00 00 00 
+  803f8b:	41 ff d0             	call   *%r8
+
+0000000000803f8e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f8e:	55                   	push   %rbp
+  803f8f:	48 89 e5             	mov    %rsp,%rbp
+  803f92:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f96:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f9a:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  803fa1:	00 00 00 
+  803fa4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fa6:	85 c0                	test   %eax,%eax
+  803fa8:	78 23                	js     803fcd <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803faa:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fae:	48 b8 34 17 80 00 00 	movabs $0x801734,%rax
+  803fb5:	00 00 00 
+  803fb8:	ff d0                	call   *%rax
+  803fba:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fbd:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fc1:	48 b8 c9 3a 80 00 00 	movabs $0x803ac9,%rax
+  803fc8:	00 00 00 
+  803fcb:	ff d0                	call   *%rax
+}
+  803fcd:	c9                   	leave
+  803fce:	c3                   	ret
+
+0000000000803fcf <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fcf:	48 89 f8             	mov    %rdi,%rax
+  803fd2:	48 c1 e8 27          	shr    $0x27,%rax
+  803fd6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fdd:	01 00 00 
+  803fe0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fe4:	f6 c2 01             	test   $0x1,%dl
+  803fe7:	74 6d                	je     804056 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fe9:	48 89 f8             	mov    %rdi,%rax
+  803fec:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803ff0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ff7:	01 00 00 
+  803ffa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ffe:	f6 c2 01             	test   $0x1,%dl
+  804001:	74 62                	je     804065 <get_uvpt_entry+0x96>
+  804003:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80400a:	01 00 00 
+  80400d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804011:	f6 c2 80             	test   $0x80,%dl
+  804014:	75 4f                	jne    804065 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804016:	48 89 f8             	mov    %rdi,%rax
+  804019:	48 c1 e8 15          	shr    $0x15,%rax
+  80401d:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804024:	01 00 00 
+  804027:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80402b:	f6 c2 01             	test   $0x1,%dl
+  80402e:	74 44                	je     804074 <get_uvpt_entry+0xa5>
+  804030:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804037:	01 00 00 
+  80403a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80403e:	f6 c2 80             	test   $0x80,%dl
+  804041:	75 31                	jne    804074 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804043:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804047:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80404e:	01 00 00 
+  804051:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804055:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804056:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80405d:	01 00 00 
+  804060:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804064:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804065:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80406c:	01 00 00 
+  80406f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804073:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804074:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80407b:	01 00 00 
+  80407e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804082:	c3                   	ret
+
+0000000000804083 <get_prot>:
+
+int
+get_prot(void *va) {
+  804083:	55                   	push   %rbp
+  804084:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804087:	48 b8 cf 3f 80 00 00 	movabs $0x803fcf,%rax
+  80408e:	00 00 00 
+  804091:	ff d0                	call   *%rax
+  804093:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804096:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80409b:	89 c1                	mov    %eax,%ecx
+  80409d:	83 c9 04             	or     $0x4,%ecx
+  8040a0:	f6 c2 01             	test   $0x1,%dl
+  8040a3:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040a6:	89 c1                	mov    %eax,%ecx
+  8040a8:	83 c9 02             	or     $0x2,%ecx
+  8040ab:	f6 c2 02             	test   $0x2,%dl
+  8040ae:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040b1:	89 c1                	mov    %eax,%ecx
+  8040b3:	83 c9 01             	or     $0x1,%ecx
+  8040b6:	48 85 d2             	test   %rdx,%rdx
+  8040b9:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040bc:	89 c1                	mov    %eax,%ecx
+  8040be:	83 c9 40             	or     $0x40,%ecx
+  8040c1:	f6 c6 04             	test   $0x4,%dh
+  8040c4:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040c7:	5d                   	pop    %rbp
+  8040c8:	c3                   	ret
+
+00000000008040c9 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040c9:	55                   	push   %rbp
+  8040ca:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040cd:	48 b8 cf 3f 80 00 00 	movabs $0x803fcf,%rax
+  8040d4:	00 00 00 
+  8040d7:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040d9:	48 c1 e8 06          	shr    $0x6,%rax
+  8040dd:	83 e0 01             	and    $0x1,%eax
+}
+  8040e0:	5d                   	pop    %rbp
+  8040e1:	c3                   	ret
+
+00000000008040e2 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040e2:	55                   	push   %rbp
+  8040e3:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040e6:	48 b8 cf 3f 80 00 00 	movabs $0x803fcf,%rax
+  8040ed:	00 00 00 
+  8040f0:	ff d0                	call   *%rax
+  8040f2:	83 e0 01             	and    $0x1,%eax
+}
+  8040f5:	5d                   	pop    %rbp
+  8040f6:	c3                   	ret
+
+00000000008040f7 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8040f7:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8040fe:	01 00 00 
+  804101:	a8 01                	test   $0x1,%al
+  804103:	75 06                	jne    80410b <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804105:	b8 00 00 00 00       	mov    $0x0,%eax
+  80410a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80410b:	55                   	push   %rbp
+  80410c:	48 89 e5             	mov    %rsp,%rbp
+  80410f:	41 57                	push   %r15
+  804111:	41 56                	push   %r14
+  804113:	41 55                	push   %r13
+  804115:	41 54                	push   %r12
+  804117:	53                   	push   %rbx
+  804118:	48 83 ec 28          	sub    $0x28,%rsp
+  80411c:	49 89 fe             	mov    %rdi,%r14
+  80411f:	49 89 f7             	mov    %rsi,%r15
+  804122:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804129:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80412a:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804131:	01 00 00 
+  804134:	e9 ae 00 00 00       	jmp    8041e7 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804139:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804140:	49 83 ec 01          	sub    $0x1,%r12
+  804144:	74 2d                	je     804173 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804146:	48 89 d8             	mov    %rbx,%rax
+  804149:	48 c1 e8 0c          	shr    $0xc,%rax
+  80414d:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804152:	f6 c2 01             	test   $0x1,%dl
+  804155:	74 e2                	je     804139 <foreach_shared_region+0x42>
+  804157:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80415c:	f6 c4 04             	test   $0x4,%ah
+  80415f:	74 d8                	je     804139 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804161:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804168:	4c 89 fa             	mov    %r15,%rdx
+  80416b:	48 89 df             	mov    %rbx,%rdi
+  80416e:	41 ff d6             	call   *%r14
+  804171:	eb c6                	jmp    804139 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804173:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80417a:	00 
+  80417b:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804180:	74 4a                	je     8041cc <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804182:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804186:	48 c1 e8 15          	shr    $0x15,%rax
+  80418a:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804191:	01 00 00 
+  804194:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804198:	a8 01                	test   $0x1,%al
+  80419a:	74 d7                	je     804173 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80419c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8041a0:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8041a7:	48 39 c3             	cmp    %rax,%rbx
+  8041aa:	73 c7                	jae    804173 <foreach_shared_region+0x7c>
+  8041ac:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041b3:	48 39 d0             	cmp    %rdx,%rax
+  8041b6:	4d 19 e4             	sbb    %r12,%r12
+  8041b9:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041c0:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041c7:	e9 7a ff ff ff       	jmp    804146 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041cc:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041d3:	40 
+  8041d4:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041d8:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041df:	00 00 00 
+  8041e2:	48 39 c1             	cmp    %rax,%rcx
+  8041e5:	74 50                	je     804237 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041e7:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041eb:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041ef:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8041f6:	01 00 00 
+  8041f9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041fd:	a8 01                	test   $0x1,%al
+  8041ff:	74 cb                	je     8041cc <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804201:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804205:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80420c:	48 39 c1             	cmp    %rax,%rcx
+  80420f:	73 bb                	jae    8041cc <foreach_shared_region+0xd5>
+  804211:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804218:	48 39 d0             	cmp    %rdx,%rax
+  80421b:	48 19 c0             	sbb    %rax,%rax
+  80421e:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804224:	48 05 00 02 00 00    	add    $0x200,%rax
+  80422a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80422e:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804232:	e9 4b ff ff ff       	jmp    804182 <foreach_shared_region+0x8b>
+  804237:	b8 00 00 00 00       	mov    $0x0,%eax
+  80423c:	48 83 c4 28          	add    $0x28,%rsp
+  804240:	5b                   	pop    %rbx
+  804241:	41 5c                	pop    %r12
+  804243:	41 5d                	pop    %r13
+  804245:	41 5e                	pop    %r14
+  804247:	41 5f                	pop    %r15
+  804249:	5d                   	pop    %rbp
+  80424a:	c3                   	ret
+
+000000000080424b <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  80424b:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804251:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804258:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80425f:	c3                   	ret
+
+0000000000804260 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804260:	8b 47 40             	mov    0x40(%rdi),%eax
+  804263:	8b 17                	mov    (%rdi),%edx
+  804265:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804267:	83 f8 0f             	cmp    $0xf,%eax
+  80426a:	77 13                	ja     80427f <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80426c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80426f:	83 e0 0f             	and    $0xf,%eax
+  804272:	48 c1 e0 09          	shl    $0x9,%rax
+  804276:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80427d:	00 
+  80427e:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80427f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804284:	c3                   	ret
+
+0000000000804285 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804285:	8b 47 40             	mov    0x40(%rdi),%eax
+  804288:	83 c0 01             	add    $0x1,%eax
+  80428b:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80428e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804294:	8b 57 04             	mov    0x4(%rdi),%edx
+  804297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80429c:	85 d2                	test   %edx,%edx
+  80429e:	75 04                	jne    8042a4 <chan_publish+0x1f>
+  8042a0:	83 e0 01             	and    $0x1,%eax
+}
+  8042a3:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042a4:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8042a7:	85 c0                	test   %eax,%eax
+  8042a9:	0f 95 c0             	setne  %al
+  8042ac:	0f b6 c0             	movzbl %al,%eax
+  8042af:	eb ef                	jmp    8042a0 <chan_publish+0x1b>
+
+00000000008042b1 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042b1:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042b4:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042b6:	29 d0                	sub    %edx,%eax
+  8042b8:	83 e8 01             	sub    $0x1,%eax
+  8042bb:	83 f8 0f             	cmp    $0xf,%eax
+  8042be:	77 12                	ja     8042d2 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042c0:	8b 07                	mov    (%rdi),%eax
+  8042c2:	83 e0 0f             	and    $0xf,%eax
+  8042c5:	48 c1 e0 09          	shl    $0x9,%rax
+  8042c9:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042d0:	00 
+  8042d1:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042d7:	c3                   	ret
+
+00000000008042d8 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042d8:	8b 07                	mov    (%rdi),%eax
+  8042da:	83 c0 01             	add    $0x1,%eax
+  8042dd:	89 07                	mov    %eax,(%rdi)
+}
+  8042df:	c3                   	ret
+
+00000000008042e0 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042e0:	55                   	push   %rbp
+  8042e1:	48 89 e5             	mov    %rsp,%rbp
+  8042e4:	53                   	push   %rbx
+  8042e5:	48 83 ec 08          	sub    $0x8,%rsp
+  8042e9:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8042ec:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042f3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8042f9:	48 b8 b1 42 80 00 00 	movabs $0x8042b1,%rax
+  804300:	00 00 00 
+  804303:	ff d0                	call   *%rax
+  804305:	48 85 c0             	test   %rax,%rax
+  804308:	74 12                	je     80431c <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80430a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804311:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804316:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80431a:	c9                   	leave
+  80431b:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80431c:	b8 01 00 00 00       	mov    $0x1,%eax
+  804321:	eb f3                	jmp    804316 <chan_arm+0x36>
+
+0000000000804323 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804323:	55                   	push   %rbp
+  804324:	48 89 e5             	mov    %rsp,%rbp
+  804327:	41 56                	push   %r14
+  804329:	41 55                	push   %r13
+  80432b:	41 54                	push   %r12
+  80432d:	53                   	push   %rbx
+  80432e:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804331:	49 bc e0 42 80 00 00 	movabs $0x8042e0,%r12
+  804338:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80433b:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80433f:	49 bd e3 14 80 00 00 	movabs $0x8014e3,%r13
+  804346:	00 00 00 
+    while (chan_arm(r))
+  804349:	eb 0d                	jmp    804358 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  80434b:	8b 33                	mov    (%rbx),%esi
+  80434d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804352:	4c 89 f7             	mov    %r14,%rdi
+  804355:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804358:	48 89 df             	mov    %rbx,%rdi
+  80435b:	41 ff d4             	call   *%r12
+  80435e:	84 c0                	test   %al,%al
+  804360:	75 e9                	jne    80434b <chan_wait+0x28>
+}
+  804362:	5b                   	pop    %rbx
+  804363:	41 5c                	pop    %r12
+  804365:	41 5d                	pop    %r13
+  804367:	41 5e                	pop    %r14
+  804369:	5d                   	pop    %rbp
+  80436a:	c3                   	ret
+
+000000000080436b <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  80436b:	55                   	push   %rbp
+  80436c:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80436f:	48 83 c7 40          	add    $0x40,%rdi
+  804373:	be 01 00 00 00       	mov    $0x1,%esi
+  804378:	48 b8 01 15 80 00 00 	movabs $0x801501,%rax
+  80437f:	00 00 00 
+  804382:	ff d0                	call   *%rax
+}
+  804384:	5d                   	pop    %rbp
+  804385:	c3                   	ret
+
+0000000000804386 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804386:	b8 00 00 00 00       	mov    $0x0,%eax
+  80438b:	c3                   	ret
+
+000000000080438c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80438c:	55                   	push   %rbp
+  80438d:	48 89 e5             	mov    %rsp,%rbp
+  804390:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804393:	48 be d4 51 80 00 00 	movabs $0x8051d4,%rsi
+  80439a:	00 00 00 
+  80439d:	48 b8 16 0c 80 00 00 	movabs $0x800c16,%rax
+  8043a4:	00 00 00 
+  8043a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8043a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043ae:	5d                   	pop    %rbp
+  8043af:	c3                   	ret
+
+00000000008043b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043b0:	55                   	push   %rbp
+  8043b1:	48 89 e5             	mov    %rsp,%rbp
+  8043b4:	41 57                	push   %r15
+  8043b6:	41 56                	push   %r14
+  8043b8:	41 55                	push   %r13
+  8043ba:	41 54                	push   %r12
+  8043bc:	53                   	push   %rbx
+  8043bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043cb:	48 85 d2             	test   %rdx,%rdx
+  8043ce:	74 7a                	je     80444a <devcons_write+0x9a>
+  8043d0:	49 89 d6             	mov    %rdx,%r14
+  8043d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043d9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043de:	49 bf 10 0e 80 00 00 	movabs $0x800e10,%r15
+  8043e5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043e8:	4c 89 f3             	mov    %r14,%rbx
+  8043eb:	48 29 f3             	sub    %rsi,%rbx
+  8043ee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043f3:	48 39 c3             	cmp    %rax,%rbx
+  8043f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8043fa:	4c 63 eb             	movslq %ebx,%r13
+  8043fd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804404:	48 01 c6             	add    %rax,%rsi
+  804407:	4c 89 ea             	mov    %r13,%rdx
+  80440a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804411:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804414:	4c 89 ee             	mov    %r13,%rsi
+  804417:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80441e:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  804425:	00 00 00 
+  804428:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80442a:	41 01 dc             	add    %ebx,%r12d
+  80442d:	49 63 f4             	movslq %r12d,%rsi
+  804430:	4c 39 f6             	cmp    %r14,%rsi
+  804433:	72 b3                	jb     8043e8 <devcons_write+0x38>
+    return res;
+  804435:	49 63 c4             	movslq %r12d,%rax
+}
+  804438:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80443f:	5b                   	pop    %rbx
+  804440:	41 5c                	pop    %r12
+  804442:	41 5d                	pop    %r13
+  804444:	41 5e                	pop    %r14
+  804446:	41 5f                	pop    %r15
+  804448:	5d                   	pop    %rbp
+  804449:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80444a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804450:	eb e3                	jmp    804435 <devcons_write+0x85>
+
+0000000000804452 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804452:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804455:	ba 00 00 00 00       	mov    $0x0,%edx
+  80445a:	48 85 c0             	test   %rax,%rax
+  80445d:	74 55                	je     8044b4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80445f:	55                   	push   %rbp
+  804460:	48 89 e5             	mov    %rsp,%rbp
+  804463:	41 55                	push   %r13
+  804465:	41 54                	push   %r12
+  804467:	53                   	push   %rbx
+  804468:	48 83 ec 08          	sub    $0x8,%rsp
+  80446c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80446f:	48 bb 5c 10 80 00 00 	movabs $0x80105c,%rbx
+  804476:	00 00 00 
+  804479:	49 bc 11 11 80 00 00 	movabs $0x801111,%r12
+  804480:	00 00 00 
+  804483:	eb 03                	jmp    804488 <devcons_read+0x36>
+  804485:	41 ff d4             	call   *%r12
+  804488:	ff d3                	call   *%rbx
+  80448a:	85 c0                	test   %eax,%eax
+  80448c:	74 f7                	je     804485 <devcons_read+0x33>
+    if (c < 0) return c;
+  80448e:	48 63 d0             	movslq %eax,%rdx
+  804491:	78 13                	js     8044a6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804493:	ba 00 00 00 00       	mov    $0x0,%edx
+  804498:	83 f8 04             	cmp    $0x4,%eax
+  80449b:	74 09                	je     8044a6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80449d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044a1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044a6:	48 89 d0             	mov    %rdx,%rax
+  8044a9:	48 83 c4 08          	add    $0x8,%rsp
+  8044ad:	5b                   	pop    %rbx
+  8044ae:	41 5c                	pop    %r12
+  8044b0:	41 5d                	pop    %r13
+  8044b2:	5d                   	pop    %rbp
+  8044b3:	c3                   	ret
+  8044b4:	48 89 d0             	mov    %rdx,%rax
+  8044b7:	c3                   	ret
+
+00000000008044b8 <cputchar>:
+cputchar(int ch) {
+  8044b8:	55                   	push   %rbp
+  8044b9:	48 89 e5             	mov    %rsp,%rbp
+  8044bc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044c0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8044c9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044cd:	48 b8 3d 10 80 00 00 	movabs $0x80103d,%rax
+  8044d4:	00 00 00 
+  8044d7:	ff d0                	call   *%rax
+}
+  8044d9:	c9                   	leave
+  8044da:	c3                   	ret
+
+00000000008044db <getchar>:
+getchar(void) {
+  8044db:	55                   	push   %rbp
+  8044dc:	48 89 e5             	mov    %rsp,%rbp
+  8044df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044e8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044f1:	48 b8 93 1a 80 00 00 	movabs $0x801a93,%rax
+  8044f8:	00 00 00 
+  8044fb:	ff d0                	call   *%rax
+  8044fd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8044ff:	85 c0                	test   %eax,%eax
+  804501:	78 06                	js     804509 <getchar+0x2e>
+  804503:	74 08                	je     80450d <getchar+0x32>
+  804505:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804509:	89 d0                	mov    %edx,%eax
+  80450b:	c9                   	leave
+  80450c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80450d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804512:	eb f5                	jmp    804509 <getchar+0x2e>
+
+0000000000804514 <iscons>:
+iscons(int fdnum) {
+  804514:	55                   	push   %rbp
+  804515:	48 89 e5             	mov    %rsp,%rbp
+  804518:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80451c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804520:	48 b8 b0 17 80 00 00 	movabs $0x8017b0,%rax
+  804527:	00 00 00 
+  80452a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80452c:	85 c0                	test   %eax,%eax
+  80452e:	78 18                	js     804548 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804530:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804534:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  80453b:	00 00 00 
+  80453e:	8b 00                	mov    (%rax),%eax
+  804540:	39 02                	cmp    %eax,(%rdx)
+  804542:	0f 94 c0             	sete   %al
+  804545:	0f b6 c0             	movzbl %al,%eax
+}
+  804548:	c9                   	leave
+  804549:	c3                   	ret
+
+000000000080454a <opencons>:
+opencons(void) {
+  80454a:	55                   	push   %rbp
+  80454b:	48 89 e5             	mov    %rsp,%rbp
+  80454e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804552:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804556:	48 b8 50 17 80 00 00 	movabs $0x801750,%rax
+  80455d:	00 00 00 
+  804560:	ff d0                	call   *%rax
+  804562:	85 c0                	test   %eax,%eax
+  804564:	78 49                	js     8045af <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804566:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80456b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804570:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804574:	bf 00 00 00 00       	mov    $0x0,%edi
+  804579:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  804580:	00 00 00 
+  804583:	ff d0                	call   *%rax
+  804585:	85 c0                	test   %eax,%eax
+  804587:	78 26                	js     8045af <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804589:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80458d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804594:	00 00 
+  804596:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804598:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80459c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045a3:	48 b8 22 17 80 00 00 	movabs $0x801722,%rax
+  8045aa:	00 00 00 
+  8045ad:	ff d0                	call   *%rax
+}
+  8045af:	c9                   	leave
+  8045b0:	c3                   	ret
+
+00000000008045b1 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8045b1:	55                   	push   %rbp
+  8045b2:	48 89 e5             	mov    %rsp,%rbp
+  8045b5:	41 56                	push   %r14
+  8045b7:	41 55                	push   %r13
+  8045b9:	41 54                	push   %r12
+  8045bb:	53                   	push   %rbx
+  8045bc:	48 83 ec 50          	sub    $0x50,%rsp
+  8045c0:	49 89 fc             	mov    %rdi,%r12
+  8045c3:	41 89 f5             	mov    %esi,%r13d
+  8045c6:	48 89 d3             	mov    %rdx,%rbx
+  8045c9:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8045cd:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8045d1:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8045d5:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8045dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8045e0:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8045e4:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8045e8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8045ec:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8045f3:	00 00 00 
+  8045f6:	4c 8b 30             	mov    (%rax),%r14
+  8045f9:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  804600:	00 00 00 
+  804603:	ff d0                	call   *%rax
+  804605:	89 c6                	mov    %eax,%esi
+  804607:	45 89 e8             	mov    %r13d,%r8d
+  80460a:	4c 89 e1             	mov    %r12,%rcx
+  80460d:	4c 89 f2             	mov    %r14,%rdx
+  804610:	48 bf e0 51 80 00 00 	movabs $0x8051e0,%rdi
+  804617:	00 00 00 
+  80461a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461f:	49 bc f1 02 80 00 00 	movabs $0x8002f1,%r12
+  804626:	00 00 00 
+  804629:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80462c:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  804630:	48 89 df             	mov    %rbx,%rdi
+  804633:	48 b8 8d 02 80 00 00 	movabs $0x80028d,%rax
+  80463a:	00 00 00 
+  80463d:	ff d0                	call   *%rax
+    cprintf("\n");
+  80463f:	48 bf f8 4a 80 00 00 	movabs $0x804af8,%rdi
+  804646:	00 00 00 
+  804649:	b8 00 00 00 00       	mov    $0x0,%eax
+  80464e:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  804651:	cc                   	int3
+  804652:	eb fd                	jmp    804651 <_panic+0xa0>
+
+0000000000804654 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804654:	55                   	push   %rbp
+  804655:	48 89 e5             	mov    %rsp,%rbp
+  804658:	41 56                	push   %r14
+  80465a:	41 55                	push   %r13
+  80465c:	41 54                	push   %r12
+  80465e:	53                   	push   %rbx
+  80465f:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804662:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804669:	00 00 00 
+  80466c:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804670:	74 27                	je     804699 <_handle_vectored_pagefault+0x45>
+  804672:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804677:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80467e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804681:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804684:	4c 89 e7             	mov    %r12,%rdi
+  804687:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80468c:	84 c0                	test   %al,%al
+  80468e:	75 45                	jne    8046d5 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804690:	48 83 c3 01          	add    $0x1,%rbx
+  804694:	49 3b 1e             	cmp    (%r14),%rbx
+  804697:	72 eb                	jb     804684 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804699:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8046a0:	00 
+  8046a1:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8046a6:	4d 8b 04 24          	mov    (%r12),%r8
+  8046aa:	48 ba 08 52 80 00 00 	movabs $0x805208,%rdx
+  8046b1:	00 00 00 
+  8046b4:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8046b9:	48 bf 38 52 80 00 00 	movabs $0x805238,%rdi
+  8046c0:	00 00 00 
+  8046c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046c8:	49 ba b1 45 80 00 00 	movabs $0x8045b1,%r10
+  8046cf:	00 00 00 
+  8046d2:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046d5:	5b                   	pop    %rbx
+  8046d6:	41 5c                	pop    %r12
+  8046d8:	41 5d                	pop    %r13
+  8046da:	41 5e                	pop    %r14
+  8046dc:	5d                   	pop    %rbp
+  8046dd:	c3                   	ret
+
+00000000008046de <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046de:	55                   	push   %rbp
+  8046df:	48 89 e5             	mov    %rsp,%rbp
+  8046e2:	53                   	push   %rbx
+  8046e3:	48 83 ec 08          	sub    $0x8,%rsp
+  8046e7:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046ea:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046f1:	00 00 00 
+  8046f4:	80 38 00             	cmpb   $0x0,(%rax)
+  8046f7:	0f 84 84 00 00 00    	je     804781 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046fd:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804704:	00 00 00 
+  804707:	48 8b 10             	mov    (%rax),%rdx
+  80470a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80470f:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804716:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804719:	48 85 d2             	test   %rdx,%rdx
+  80471c:	74 19                	je     804737 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80471e:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804722:	0f 84 e8 00 00 00    	je     804810 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804728:	48 83 c0 01          	add    $0x1,%rax
+  80472c:	48 39 d0             	cmp    %rdx,%rax
+  80472f:	75 ed                	jne    80471e <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804731:	48 83 fa 08          	cmp    $0x8,%rdx
+  804735:	74 1c                	je     804753 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804737:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80473b:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804742:	00 00 00 
+  804745:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80474c:	00 00 00 
+  80474f:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804753:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  80475a:	00 00 00 
+  80475d:	ff d0                	call   *%rax
+  80475f:	89 c7                	mov    %eax,%edi
+  804761:	48 be d6 48 80 00 00 	movabs $0x8048d6,%rsi
+  804768:	00 00 00 
+  80476b:	48 b8 33 13 80 00 00 	movabs $0x801333,%rax
+  804772:	00 00 00 
+  804775:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804777:	85 c0                	test   %eax,%eax
+  804779:	78 68                	js     8047e3 <add_pgfault_handler+0x105>
+    return res;
+}
+  80477b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80477f:	c9                   	leave
+  804780:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804781:	48 b8 e8 10 80 00 00 	movabs $0x8010e8,%rax
+  804788:	00 00 00 
+  80478b:	ff d0                	call   *%rax
+  80478d:	89 c7                	mov    %eax,%edi
+  80478f:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804794:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804799:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8047a0:	00 00 00 
+  8047a3:	48 b8 75 11 80 00 00 	movabs $0x801175,%rax
+  8047aa:	00 00 00 
+  8047ad:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047af:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8047b6:	00 00 00 
+  8047b9:	48 8b 02             	mov    (%rdx),%rax
+  8047bc:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047c0:	48 89 0a             	mov    %rcx,(%rdx)
+  8047c3:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047ca:	00 00 00 
+  8047cd:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047d1:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047d8:	00 00 00 
+  8047db:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047de:	e9 70 ff ff ff       	jmp    804753 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047e3:	89 c1                	mov    %eax,%ecx
+  8047e5:	48 ba 46 52 80 00 00 	movabs $0x805246,%rdx
+  8047ec:	00 00 00 
+  8047ef:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047f4:	48 bf 38 52 80 00 00 	movabs $0x805238,%rdi
+  8047fb:	00 00 00 
+  8047fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804803:	49 b8 b1 45 80 00 00 	movabs $0x8045b1,%r8
+  80480a:	00 00 00 
+  80480d:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804810:	b8 00 00 00 00       	mov    $0x0,%eax
+  804815:	e9 61 ff ff ff       	jmp    80477b <add_pgfault_handler+0x9d>
+
+000000000080481a <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80481a:	55                   	push   %rbp
+  80481b:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80481e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804825:	00 00 00 
+  804828:	80 38 00             	cmpb   $0x0,(%rax)
+  80482b:	74 33                	je     804860 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80482d:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804834:	00 00 00 
+  804837:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  80483c:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804843:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804846:	48 85 c0             	test   %rax,%rax
+  804849:	0f 84 85 00 00 00    	je     8048d4 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80484f:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804853:	74 40                	je     804895 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804855:	48 83 c1 01          	add    $0x1,%rcx
+  804859:	48 39 c1             	cmp    %rax,%rcx
+  80485c:	75 f1                	jne    80484f <remove_pgfault_handler+0x35>
+  80485e:	eb 74                	jmp    8048d4 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804860:	48 b9 5e 52 80 00 00 	movabs $0x80525e,%rcx
+  804867:	00 00 00 
+  80486a:	48 ba 87 51 80 00 00 	movabs $0x805187,%rdx
+  804871:	00 00 00 
+  804874:	be 43 00 00 00       	mov    $0x43,%esi
+  804879:	48 bf 38 52 80 00 00 	movabs $0x805238,%rdi
+  804880:	00 00 00 
+  804883:	b8 00 00 00 00       	mov    $0x0,%eax
+  804888:	49 b8 b1 45 80 00 00 	movabs $0x8045b1,%r8
+  80488f:	00 00 00 
+  804892:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804895:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80489c:	00 
+  80489d:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8048a1:	48 29 ca             	sub    %rcx,%rdx
+  8048a4:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8048ab:	00 00 00 
+  8048ae:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8048b2:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8048b7:	48 89 ce             	mov    %rcx,%rsi
+  8048ba:	48 b8 10 0e 80 00 00 	movabs $0x800e10,%rax
+  8048c1:	00 00 00 
+  8048c4:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048c6:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048cd:	00 00 00 
+  8048d0:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048d4:	5d                   	pop    %rbp
+  8048d5:	c3                   	ret
+
+00000000008048d6 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048d6:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048d9:	48 b8 54 46 80 00 00 	movabs $0x804654,%rax
+  8048e0:	00 00 00 
+    call *%rax
+  8048e3:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048e5:	41 5f                	pop    %r15
+	popq %r15
+  8048e7:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048e9:	41 5f                	pop    %r15
+	popq %r14
+  8048eb:	41 5e                	pop    %r14
+	popq %r13
+  8048ed:	41 5d                	pop    %r13
+	popq %r12
+  8048ef:	41 5c                	pop    %r12
+	popq %r11
+  8048f1:	41 5b                	pop    %r11
+	popq %r10
+  8048f3:	41 5a                	pop    %r10
+	popq %r9
+  8048f5:	41 59                	pop    %r9
+	popq %r8
+  8048f7:	41 58                	pop    %r8
+	popq %rsi
+  8048f9:	5e                   	pop    %rsi
+	popq %rdi
+  8048fa:	5f                   	pop    %rdi
+	popq %rbp
+  8048fb:	5d                   	pop    %rbp
+	popq %rdx
+  8048fc:	5a                   	pop    %rdx
+	popq %rcx
+  8048fd:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8048fe:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804903:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804908:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80490c:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80490f:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804914:	5b                   	pop    %rbx
+	popq %rax
+  804915:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804916:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80491a:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80491b:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804920:	c3                   	ret
+
+0000000000804921 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804921:	55                   	push   %rbp
+  804922:	48 89 e5             	mov    %rsp,%rbp
+  804925:	41 55                	push   %r13
+  804927:	41 54                	push   %r12
+  804929:	53                   	push   %rbx
+  80492a:	48 83 ec 08          	sub    $0x8,%rsp
+  80492e:	49 89 fd             	mov    %rdi,%r13
+  804931:	48 89 f7             	mov    %rsi,%rdi
+  804934:	48 89 d3             	mov    %rdx,%rbx
+  804937:	49 89 cc             	mov    %rcx,%r12
+  80493a:	4c 89 c2             	mov    %r8,%rdx
+  80493d:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804940:	48 85 f6             	test   %rsi,%rsi
+  804943:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80494a:	00 00 00 
+  80494d:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  804951:	be 00 10 00 00       	mov    $0x1000,%esi
+  804956:	48 85 db             	test   %rbx,%rbx
+  804959:	74 03                	je     80495e <ipc_recv_futex+0x3d>
+  80495b:	48 8b 33             	mov    (%rbx),%rsi
+  80495e:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  804962:	48 b8 bf 13 80 00 00 	movabs $0x8013bf,%rax
+  804969:	00 00 00 
+  80496c:	ff d0                	call   *%rax
+    if (res < 0) {
+  80496e:	85 c0                	test   %eax,%eax
+  804970:	78 75                	js     8049e7 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  804972:	4d 85 ed             	test   %r13,%r13
+  804975:	74 14                	je     80498b <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804977:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80497e:	00 00 00 
+  804981:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804987:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  80498b:	4d 85 e4             	test   %r12,%r12
+  80498e:	74 14                	je     8049a4 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804990:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804997:	00 00 00 
+  80499a:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8049a0:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8049a4:	48 85 db             	test   %rbx,%rbx
+  8049a7:	74 23                	je     8049cc <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8049a9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049b0:	00 00 00 
+  8049b3:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8049b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049be:	85 c9                	test   %ecx,%ecx
+  8049c0:	74 07                	je     8049c9 <ipc_recv_futex+0xa8>
+  8049c2:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8049c9:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8049cc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049d3:	00 00 00 
+  8049d6:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8049dc:	48 83 c4 08          	add    $0x8,%rsp
+  8049e0:	5b                   	pop    %rbx
+  8049e1:	41 5c                	pop    %r12
+  8049e3:	41 5d                	pop    %r13
+  8049e5:	5d                   	pop    %rbp
+  8049e6:	c3                   	ret
+        if (from_env_store != NULL) {
+  8049e7:	4d 85 ed             	test   %r13,%r13
+  8049ea:	74 08                	je     8049f4 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8049ec:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8049f3:	00 
+        if (perm_store != NULL) {
+  8049f4:	4d 85 e4             	test   %r12,%r12
+  8049f7:	74 08                	je     804a01 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8049f9:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a00:	00 
+        if (size != NULL) {
+  804a01:	48 85 db             	test   %rbx,%rbx
+  804a04:	74 d6                	je     8049dc <ipc_recv_futex+0xbb>
+            *size = 0;
+  804a06:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804a0d:	eb cd                	jmp    8049dc <ipc_recv_futex+0xbb>
+
+0000000000804a0f <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804a0f:	55                   	push   %rbp
+  804a10:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804a13:	48 83 ec 08          	sub    $0x8,%rsp
+  804a17:	6a 00                	push   $0x0
+  804a19:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a1f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a25:	48 b8 21 49 80 00 00 	movabs $0x804921,%rax
+  804a2c:	00 00 00 
+  804a2f:	ff d0                	call   *%rax
+}
+  804a31:	c9                   	leave
+  804a32:	c3                   	ret
+
+0000000000804a33 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804a33:	55                   	push   %rbp
+  804a34:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804a37:	48 85 d2             	test   %rdx,%rdx
+  804a3a:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a41:	00 00 00 
+  804a44:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804a48:	89 f6                	mov    %esi,%esi
+  804a4a:	48 b8 a8 13 80 00 00 	movabs $0x8013a8,%rax
+  804a51:	00 00 00 
+  804a54:	ff d0                	call   *%rax
+    if (res < 0) {
+  804a56:	85 c0                	test   %eax,%eax
+  804a58:	78 02                	js     804a5c <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804a5a:	5d                   	pop    %rbp
+  804a5b:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804a5c:	89 c1                	mov    %eax,%ecx
+  804a5e:	48 ba 78 52 80 00 00 	movabs $0x805278,%rdx
+  804a65:	00 00 00 
+  804a68:	be 50 00 00 00       	mov    $0x50,%esi
+  804a6d:	48 bf 8c 52 80 00 00 	movabs $0x80528c,%rdi
+  804a74:	00 00 00 
+  804a77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a7c:	49 b8 b1 45 80 00 00 	movabs $0x8045b1,%r8
+  804a83:	00 00 00 
+  804a86:	41 ff d0             	call   *%r8
+
+0000000000804a89 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804a89:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804a8e:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804a95:	00 00 00 
+  804a98:	48 89 d0             	mov    %rdx,%rax
+  804a9b:	48 c1 e0 04          	shl    $0x4,%rax
+  804a9f:	48 29 d0             	sub    %rdx,%rax
+  804aa2:	48 c1 e0 05          	shl    $0x5,%rax
+  804aa6:	48 01 c8             	add    %rcx,%rax
+  804aa9:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804aaf:	39 f8                	cmp    %edi,%eax
+  804ab1:	74 13                	je     804ac6 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804ab3:	48 83 c2 01          	add    $0x1,%rdx
+  804ab7:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804abe:	75 d8                	jne    804a98 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804ac0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ac5:	c3                   	ret
+            return envs[i].env_id;
+  804ac6:	48 89 d0             	mov    %rdx,%rax
+  804ac9:	48 c1 e0 04          	shl    $0x4,%rax
+  804acd:	48 29 d0             	sub    %rdx,%rax
+  804ad0:	48 c1 e0 05          	shl    $0x5,%rax
+  804ad4:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804adb:	00 00 00 
+  804ade:	48 01 d0             	add    %rdx,%rax
+  804ae1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804ae7:	c3                   	ret
+
+0000000000804ae8 <__rodata_start>:
+  804ae8:	75 73                	jne    804b5d <__rodata_start+0x75>
+  804aea:	61                   	(bad)
+  804aeb:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  804aef:	6c                   	insb   (%dx),%es:(%rdi)
+  804af0:	73 66                	jae    804b58 <__rodata_start+0x70>
+  804af2:	64 20 5b 2d          	and    %bl,%fs:0x2d(%rbx)
+  804af6:	31 5d 0a             	xor    %ebx,0xa(%rbp)
+  804af9:	00 66 0f             	add    %ah,0xf(%rsi)
+  804afc:	1f                   	(bad)
+  804afd:	44 00 00             	add    %r8b,(%rax)
+  804b00:	66 64 20 25 64 3a 20 	data16 and %ah,%fs:0x6e203a64(%rip)        # 6ea0856c <__bss_end+0x6e1c656c>
+  804b07:	6e 
+  804b08:	61                   	(bad)
+  804b09:	6d                   	insl   (%dx),%es:(%rdi)
+  804b0a:	65 20 25 73 20 69 73 	and    %ah,%gs:0x73692073(%rip)        # 73e96b84 <__bss_end+0x73654b84>
+  804b11:	64 69 72 20 25 64 20 	imul   $0x73206425,%fs:0x20(%rdx),%esi
+  804b18:	73 
+  804b19:	69 7a 65 20 25 64 20 	imul   $0x20642520,0x65(%rdx),%edi
+  804b20:	64 65 76 20          	fs gs jbe 804b44 <__rodata_start+0x5c>
+  804b24:	25 73 0a 00 3c       	and    $0x3c000a73,%eax
+  804b29:	75 6e                	jne    804b99 <__rodata_start+0xb1>
+  804b2b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804b2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b30:	3e 00 30             	ds add %dh,(%rax)
+  804b33:	31 32                	xor    %esi,(%rdx)
+  804b35:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b3c:	41                   	rex.B
+  804b3d:	42                   	rex.X
+  804b3e:	43                   	rex.XB
+  804b3f:	44                   	rex.R
+  804b40:	45                   	rex.RB
+  804b41:	46 00 30             	rex.RX add %r14b,(%rax)
+  804b44:	31 32                	xor    %esi,(%rdx)
+  804b46:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b4d:	61                   	(bad)
+  804b4e:	62 63 64 65 66       	(bad)
+  804b53:	00 28                	add    %ch,(%rax)
+  804b55:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b56:	75 6c                	jne    804bc4 <__rodata_start+0xdc>
+  804b58:	6c                   	insb   (%dx),%es:(%rdi)
+  804b59:	29 00                	sub    %eax,(%rax)
+  804b5b:	65 72 72             	gs jb  804bd0 <__rodata_start+0xe8>
+  804b5e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b5f:	72 20                	jb     804b81 <__rodata_start+0x99>
+  804b61:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804b66:	73 70                	jae    804bd8 <__rodata_start+0xf0>
+  804b68:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804b6c:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804b73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b74:	72 00                	jb     804b76 <__rodata_start+0x8e>
+  804b76:	62 61 64 20 65       	(bad)
+  804b7b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b7c:	76 69                	jbe    804be7 <__rodata_start+0xff>
+  804b7e:	72 6f                	jb     804bef <__rodata_start+0x107>
+  804b80:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b81:	6d                   	insl   (%dx),%es:(%rdi)
+  804b82:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b84:	74 00                	je     804b86 <__rodata_start+0x9e>
+  804b86:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b8d:	20 70 61             	and    %dh,0x61(%rax)
+  804b90:	72 61                	jb     804bf3 <__rodata_start+0x10b>
+  804b92:	6d                   	insl   (%dx),%es:(%rdi)
+  804b93:	65 74 65             	gs je  804bfb <__rodata_start+0x113>
+  804b96:	72 00                	jb     804b98 <__rodata_start+0xb0>
+  804b98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b99:	75 74                	jne    804c0f <__rodata_start+0x127>
+  804b9b:	20 6f 66             	and    %ch,0x66(%rdi)
+  804b9e:	20 6d 65             	and    %ch,0x65(%rbp)
+  804ba1:	6d                   	insl   (%dx),%es:(%rdi)
+  804ba2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba3:	72 79                	jb     804c1e <__rodata_start+0x136>
+  804ba5:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ba8:	74 20                	je     804bca <__rodata_start+0xe2>
+  804baa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bab:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804baf:	76 69                	jbe    804c1a <__rodata_start+0x132>
+  804bb1:	72 6f                	jb     804c22 <__rodata_start+0x13a>
+  804bb3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bb4:	6d                   	insl   (%dx),%es:(%rdi)
+  804bb5:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bb7:	74 73                	je     804c2c <__rodata_start+0x144>
+  804bb9:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804bbc:	72 72                	jb     804c30 <__rodata_start+0x148>
+  804bbe:	75 70                	jne    804c30 <__rodata_start+0x148>
+  804bc0:	74 65                	je     804c27 <__rodata_start+0x13f>
+  804bc2:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804bc7:	75 67                	jne    804c30 <__rodata_start+0x148>
+  804bc9:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804bcc:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804bce:	00 73 65             	add    %dh,0x65(%rbx)
+  804bd1:	67 6d                	insl   (%dx),%es:(%edi)
+  804bd3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bd5:	74 61                	je     804c38 <__rodata_start+0x150>
+  804bd7:	74 69                	je     804c42 <__rodata_start+0x15a>
+  804bd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bdb:	20 66 61             	and    %ah,0x61(%rsi)
+  804bde:	75 6c                	jne    804c4c <__rodata_start+0x164>
+  804be0:	74 00                	je     804be2 <__rodata_start+0xfa>
+  804be2:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804be9:	20 45 4c             	and    %al,0x4c(%rbp)
+  804bec:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804bf0:	61                   	(bad)
+  804bf1:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804bf6:	20 73 75             	and    %dh,0x75(%rbx)
+  804bf9:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804bfc:	73 79                	jae    804c77 <__rodata_start+0x18f>
+  804bfe:	73 74                	jae    804c74 <__rodata_start+0x18c>
+  804c00:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804c02:	20 63 61             	and    %ah,0x61(%rbx)
+  804c05:	6c                   	insb   (%dx),%es:(%rdi)
+  804c06:	6c                   	insb   (%dx),%es:(%rdi)
+  804c07:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804c0a:	74 72                	je     804c7e <__rodata_start+0x196>
+  804c0c:	79 20                	jns    804c2e <__rodata_start+0x146>
+  804c0e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c0f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c10:	74 20                	je     804c32 <__rodata_start+0x14a>
+  804c12:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c14:	75 6e                	jne    804c84 <__rodata_start+0x19c>
+  804c16:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804c1a:	76 20                	jbe    804c3c <__rodata_start+0x154>
+  804c1c:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804c23:	72 65                	jb     804c8a <__rodata_start+0x1a2>
+  804c25:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804c28:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c29:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804c2d:	65 78 70             	gs js  804ca0 <__rodata_start+0x1b8>
+  804c30:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804c35:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804c38:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804c3c:	20 66 69             	and    %ah,0x69(%rsi)
+  804c3f:	6c                   	insb   (%dx),%es:(%rdi)
+  804c40:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804c44:	20 66 72             	and    %ah,0x72(%rsi)
+  804c47:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804c4c:	61                   	(bad)
+  804c4d:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804c50:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c51:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c52:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804c56:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804c59:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c5b:	20 6d 61             	and    %ch,0x61(%rbp)
+  804c5e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c5f:	79 20                	jns    804c81 <__rodata_start+0x199>
+  804c61:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804c68:	72 65                	jb     804ccf <__rodata_start+0x1e7>
+  804c6a:	20 6f 70             	and    %ch,0x70(%rdi)
+  804c6d:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c6f:	00 66 69             	add    %ah,0x69(%rsi)
+  804c72:	6c                   	insb   (%dx),%es:(%rdi)
+  804c73:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804c77:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804c7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c7b:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804c7e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c7f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c80:	74 20                	je     804ca2 <__rodata_start+0x1ba>
+  804c82:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c84:	75 6e                	jne    804cf4 <__rodata_start+0x20c>
+  804c86:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804c8a:	76 61                	jbe    804ced <__rodata_start+0x205>
+  804c8c:	6c                   	insb   (%dx),%es:(%rdi)
+  804c8d:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804c94:	00 
+  804c95:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804c9c:	72 65                	jb     804d03 <__rodata_start+0x21b>
+  804c9e:	61                   	(bad)
+  804c9f:	64 79 20             	fs jns 804cc2 <__rodata_start+0x1da>
+  804ca2:	65 78 69             	gs js  804d0e <__rodata_start+0x226>
+  804ca5:	73 74                	jae    804d1b <__rodata_start+0x233>
+  804ca7:	73 00                	jae    804ca9 <__rodata_start+0x1c1>
+  804ca9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804caa:	70 65                	jo     804d11 <__rodata_start+0x229>
+  804cac:	72 61                	jb     804d0f <__rodata_start+0x227>
+  804cae:	74 69                	je     804d19 <__rodata_start+0x231>
+  804cb0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb2:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804cb5:	74 20                	je     804cd7 <__rodata_start+0x1ef>
+  804cb7:	73 75                	jae    804d2e <__rodata_start+0x246>
+  804cb9:	70 70                	jo     804d2b <__rodata_start+0x243>
+  804cbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cbc:	72 74                	jb     804d32 <__rodata_start+0x24a>
+  804cbe:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804cc4:	20 61 67             	and    %ah,0x67(%rcx)
+  804cc7:	61                   	(bad)
+  804cc8:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804ccf:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804cd3:	74 00                	je     804cd5 <__rodata_start+0x1ed>
+  804cd5:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804cdc:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804cdf:	20 75 73             	and    %dh,0x73(%rbp)
+  804ce2:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804ce6:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804ced:	00 
+  804cee:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804cf5:	00 00 00 
+  804cf8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804cff:	00 
+  804d00:	de 04 80             	fiadds (%rax,%rax,4)
+  804d03:	00 00                	add    %al,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 1f                	add    %bl,(%rdi)
+  804d09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d0f:	00 0f                	add    %cl,(%rdi)
+  804d11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d17:	00 1f                	add    %bl,(%rdi)
+  804d19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d1f:	00 1f                	add    %bl,(%rdi)
+  804d21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d27:	00 1f                	add    %bl,(%rdi)
+  804d29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d2f:	00 1f                	add    %bl,(%rdi)
+  804d31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d37:	00 fd                	add    %bh,%ch
+  804d39:	04 80                	add    $0x80,%al
+  804d3b:	00 00                	add    %al,(%rax)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 1f                	add    %bl,(%rdi)
+  804d41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d47:	00 1f                	add    %bl,(%rdi)
+  804d49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d4f:	00 f1                	add    %dh,%cl
+  804d51:	04 80                	add    $0x80,%al
+  804d53:	00 00                	add    %al,(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 6b 05             	add    %ch,0x5(%rbx)
+  804d5a:	80 00 00             	addb   $0x0,(%rax)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 1f                	add    %bl,(%rdi)
+  804d61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d67:	00 f1                	add    %dh,%cl
+  804d69:	04 80                	add    $0x80,%al
+  804d6b:	00 00                	add    %al,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 37                	add    %dh,(%rdi)
+  804d71:	05 80 00 00 00       	add    $0x80,%eax
+  804d76:	00 00                	add    %al,(%rax)
+  804d78:	37                   	(bad)
+  804d79:	05 80 00 00 00       	add    $0x80,%eax
+  804d7e:	00 00                	add    %al,(%rax)
+  804d80:	37                   	(bad)
+  804d81:	05 80 00 00 00       	add    $0x80,%eax
+  804d86:	00 00                	add    %al,(%rax)
+  804d88:	37                   	(bad)
+  804d89:	05 80 00 00 00       	add    $0x80,%eax
+  804d8e:	00 00                	add    %al,(%rax)
+  804d90:	37                   	(bad)
+  804d91:	05 80 00 00 00       	add    $0x80,%eax
+  804d96:	00 00                	add    %al,(%rax)
+  804d98:	37                   	(bad)
+  804d99:	05 80 00 00 00       	add    $0x80,%eax
+  804d9e:	00 00                	add    %al,(%rax)
+  804da0:	37                   	(bad)
+  804da1:	05 80 00 00 00       	add    $0x80,%eax
+  804da6:	00 00                	add    %al,(%rax)
+  804da8:	37                   	(bad)
+  804da9:	05 80 00 00 00       	add    $0x80,%eax
+  804dae:	00 00                	add    %al,(%rax)
+  804db0:	37                   	(bad)
+  804db1:	05 80 00 00 00       	add    $0x80,%eax
+  804db6:	00 00                	add    %al,(%rax)
+  804db8:	1f                   	(bad)
+  804db9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dbf:	00 1f                	add    %bl,(%rdi)
+  804dc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dc7:	00 1f                	add    %bl,(%rdi)
+  804dc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dcf:	00 1f                	add    %bl,(%rdi)
+  804dd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dd7:	00 1f                	add    %bl,(%rdi)
+  804dd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ddf:	00 1f                	add    %bl,(%rdi)
+  804de1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804de7:	00 1f                	add    %bl,(%rdi)
+  804de9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804def:	00 1f                	add    %bl,(%rdi)
+  804df1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804df7:	00 1f                	add    %bl,(%rdi)
+  804df9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dff:	00 1f                	add    %bl,(%rdi)
+  804e01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e07:	00 1f                	add    %bl,(%rdi)
+  804e09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e0f:	00 1f                	add    %bl,(%rdi)
+  804e11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e17:	00 1f                	add    %bl,(%rdi)
+  804e19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e1f:	00 1f                	add    %bl,(%rdi)
+  804e21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e27:	00 1f                	add    %bl,(%rdi)
+  804e29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e2f:	00 1f                	add    %bl,(%rdi)
+  804e31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e37:	00 1f                	add    %bl,(%rdi)
+  804e39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e3f:	00 1f                	add    %bl,(%rdi)
+  804e41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e47:	00 1f                	add    %bl,(%rdi)
+  804e49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e4f:	00 1f                	add    %bl,(%rdi)
+  804e51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e57:	00 1f                	add    %bl,(%rdi)
+  804e59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e5f:	00 1f                	add    %bl,(%rdi)
+  804e61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e67:	00 1f                	add    %bl,(%rdi)
+  804e69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e6f:	00 1f                	add    %bl,(%rdi)
+  804e71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e77:	00 1f                	add    %bl,(%rdi)
+  804e79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e7f:	00 1f                	add    %bl,(%rdi)
+  804e81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e87:	00 1f                	add    %bl,(%rdi)
+  804e89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e8f:	00 1f                	add    %bl,(%rdi)
+  804e91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e97:	00 1f                	add    %bl,(%rdi)
+  804e99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804e9f:	00 1f                	add    %bl,(%rdi)
+  804ea1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ea7:	00 42 0a             	add    %al,0xa(%rdx)
+  804eaa:	80 00 00             	addb   $0x0,(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 1f                	add    %bl,(%rdi)
+  804eb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804eb7:	00 1f                	add    %bl,(%rdi)
+  804eb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ebf:	00 1f                	add    %bl,(%rdi)
+  804ec1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ec7:	00 1f                	add    %bl,(%rdi)
+  804ec9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ecf:	00 1f                	add    %bl,(%rdi)
+  804ed1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ed7:	00 1f                	add    %bl,(%rdi)
+  804ed9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804edf:	00 1f                	add    %bl,(%rdi)
+  804ee1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ee7:	00 1f                	add    %bl,(%rdi)
+  804ee9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804eef:	00 1f                	add    %bl,(%rdi)
+  804ef1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ef7:	00 1f                	add    %bl,(%rdi)
+  804ef9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804eff:	00 8e 05 80 00 00    	add    %cl,0x8005(%rsi)
+  804f05:	00 00                	add    %al,(%rax)
+  804f07:	00 5d 07             	add    %bl,0x7(%rbp)
+  804f0a:	80 00 00             	addb   $0x0,(%rax)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 1f                	add    %bl,(%rdi)
+  804f11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f17:	00 1f                	add    %bl,(%rdi)
+  804f19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f1f:	00 1f                	add    %bl,(%rdi)
+  804f21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f27:	00 1f                	add    %bl,(%rdi)
+  804f29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f2f:	00 bd 05 80 00 00    	add    %bh,0x8005(%rbp)
+  804f35:	00 00                	add    %al,(%rax)
+  804f37:	00 1f                	add    %bl,(%rdi)
+  804f39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f3f:	00 1f                	add    %bl,(%rdi)
+  804f41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f47:	00 83 05 80 00 00    	add    %al,0x8005(%rbx)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 1f                	add    %bl,(%rdi)
+  804f51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f57:	00 1f                	add    %bl,(%rdi)
+  804f59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f5f:	00 05 09 80 00 00    	add    %al,0x8009(%rip)        # 80cf6e <__ctors_end+0x6e8e>
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 cf                	add    %cl,%bh
+  804f69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804f6f:	00 1f                	add    %bl,(%rdi)
+  804f71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f77:	00 1f                	add    %bl,(%rdi)
+  804f79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f7f:	00 54 06 80          	add    %dl,-0x80(%rsi,%rax,1)
+  804f83:	00 00                	add    %al,(%rax)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 1f                	add    %bl,(%rdi)
+  804f89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f8f:	00 31                	add    %dh,(%rcx)
+  804f91:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804f97:	00 1f                	add    %bl,(%rdi)
+  804f99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804f9f:	00 1f                	add    %bl,(%rdi)
+  804fa1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804fa7:	00 42 0a             	add    %al,0xa(%rdx)
+  804faa:	80 00 00             	addb   $0x0,(%rax)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 1f                	add    %bl,(%rdi)
+  804fb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804fb7:	00 e7                	add    %ah,%bh
+  804fb9:	04 80                	add    $0x80,%al
+  804fbb:	00 00                	add    %al,(%rax)
+  804fbd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804fc0 <error_string>:
+	...
+  804fc8:	64 4b 80 00 00 00 00 00 76 4b 80 00 00 00 00 00     dK......vK......
+  804fd8:	86 4b 80 00 00 00 00 00 98 4b 80 00 00 00 00 00     .K.......K......
+  804fe8:	a6 4b 80 00 00 00 00 00 ba 4b 80 00 00 00 00 00     .K.......K......
+  804ff8:	cf 4b 80 00 00 00 00 00 e2 4b 80 00 00 00 00 00     .K.......K......
+  805008:	f4 4b 80 00 00 00 00 00 08 4c 80 00 00 00 00 00     .K.......L......
+  805018:	18 4c 80 00 00 00 00 00 2b 4c 80 00 00 00 00 00     .L......+L......
+  805028:	42 4c 80 00 00 00 00 00 58 4c 80 00 00 00 00 00     BL......XL......
+  805038:	70 4c 80 00 00 00 00 00 88 4c 80 00 00 00 00 00     pL.......L......
+  805048:	95 4c 80 00 00 00 00 00 78 50 80 00 00 00 00 00     .L......xP......
+  805058:	a9 4c 80 00 00 00 00 00 c1 4c 80 00 00 00 00 00     .L.......L......
+  805068:	cb 4c 80 00 00 00 00 00 d5 4c 80 00 00 00 00 00     .L.......L......
+  805078:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805088:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805098:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8050a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8050b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8050c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8050d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8050e8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8050f8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805108:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805118:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805128:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805138:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805148:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805158:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805160 <devtab>:
+  805160:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805170:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8051a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8051b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8051c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8051d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8051e0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  8051f0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805200:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  805210:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805220:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805230:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805240:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805250:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805260:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805270:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  805280:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805290:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
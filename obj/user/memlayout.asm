@@ -0,0 +1,8896 @@
+
+obj/user/memlayout:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 52 03 00 00       	call   800375 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <memlayout>:
+#ifndef PROT_SHARE
+#define PROT_SHARE 0x400
+#endif
+
+void
+memlayout(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 48          	sub    $0x48,%rsp
+    size_t total_p = 0;
+    size_t total_u = 0;
+    size_t total_w = 0;
+    size_t total_cow = 0;
+
+    cprintf("EID: %d, PEID: %d\n", thisenv->env_id, thisenv->env_parent_id);
+  800036:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  80003d:	00 00 00 
+  800040:	49 8b 04 24          	mov    (%r12),%rax
+  800044:	8b 90 cc 00 00 00    	mov    0xcc(%rax),%edx
+  80004a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  800050:	48 bf 04 4b 80 00 00 	movabs $0x804b04,%rdi
+  800057:	00 00 00 
+  80005a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80005f:	48 bb 9b 05 80 00 00 	movabs $0x80059b,%rbx
+  800066:	00 00 00 
+  800069:	ff d3                	call   *%rbx
+    cprintf("pml4=%p uvpml4=%p uvpdp=%p uvpd=%p uvpt=%p\n", thisenv->address_space.pml4,
+  80006b:	49 8b 04 24          	mov    (%r12),%rax
+  80006f:	48 8b b0 08 01 00 00 	mov    0x108(%rax),%rsi
+  800076:	49 b9 00 00 00 80 00 	movabs $0x10080000000,%r9
+  80007d:	01 00 00 
+  800080:	49 b8 00 00 00 00 00 	movabs $0x10000000000,%r8
+  800087:	01 00 00 
+  80008a:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  800091:	01 00 00 
+  800094:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80009b:	01 00 00 
+  80009e:	48 bf b0 4b 80 00 00 	movabs $0x804bb0,%rdi
+  8000a5:	00 00 00 
+  8000a8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ad:	ff d3                	call   *%rbx
+    size_t total_cow = 0;
+  8000af:	48 c7 45 90 00 00 00 	movq   $0x0,-0x70(%rbp)
+  8000b6:	00 
+    size_t total_w = 0;
+  8000b7:	48 c7 45 98 00 00 00 	movq   $0x0,-0x68(%rbp)
+  8000be:	00 
+    size_t total_u = 0;
+  8000bf:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8000c6:	00 
+    size_t total_p = 0;
+  8000c7:	48 c7 45 a8 00 00 00 	movq   $0x0,-0x58(%rbp)
+  8000ce:	00 
+            (void *)UVPML4, (void *)UVPDP, (void *)UVPT, (void *)UVPD);
+
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  8000cf:	41 be 00 00 00 00    	mov    $0x0,%r14d
+        pte_t ent = get_uvpt_entry((void *)addr);
+  8000d5:	49 bd 7b 40 80 00 00 	movabs $0x80407b,%r13
+  8000dc:	00 00 00 
+        if (ent) {
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000df:	49 bc 2d 4b 80 00 00 	movabs $0x804b2d,%r12
+  8000e6:	00 00 00 
+  8000e9:	eb 5f                	jmp    80014a <memlayout+0x125>
+                    (void *)get_uvpt_entry((void *)addr), (unsigned long)addr, (unsigned long)ent,
+  8000eb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8000ef:	41 ff d5             	call   *%r13
+  8000f2:	48 89 c6             	mov    %rax,%rsi
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8000f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8000f9:	41 57                	push   %r15
+  8000fb:	ff 75 c0             	push   -0x40(%rbp)
+  8000fe:	8b 45 bc             	mov    -0x44(%rbp),%eax
+  800101:	50                   	push   %rax
+  800102:	44 8b 4d b8          	mov    -0x48(%rbp),%r9d
+  800106:	44 8b 45 b4          	mov    -0x4c(%rbp),%r8d
+  80010a:	48 89 d9             	mov    %rbx,%rcx
+  80010d:	4c 89 f2             	mov    %r14,%rdx
+  800110:	48 bf e0 4b 80 00 00 	movabs $0x804be0,%rdi
+  800117:	00 00 00 
+  80011a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80011f:	49 ba 9b 05 80 00 00 	movabs $0x80059b,%r10
+  800126:	00 00 00 
+  800129:	41 ff d2             	call   *%r10
+  80012c:	48 83 c4 20          	add    $0x20,%rsp
+    for (addr = 0; addr < KERN_BASE_ADDR; addr += PAGE_SIZE) {
+  800130:	49 81 c6 00 10 00 00 	add    $0x1000,%r14
+  800137:	48 b8 00 00 00 40 80 	movabs $0x8040000000,%rax
+  80013e:	00 00 00 
+  800141:	49 39 c6             	cmp    %rax,%r14
+  800144:	0f 84 8f 00 00 00    	je     8001d9 <memlayout+0x1b4>
+        pte_t ent = get_uvpt_entry((void *)addr);
+  80014a:	4c 89 75 c8          	mov    %r14,-0x38(%rbp)
+  80014e:	4c 89 f7             	mov    %r14,%rdi
+  800151:	41 ff d5             	call   *%r13
+  800154:	48 89 c3             	mov    %rax,%rbx
+        if (ent) {
+  800157:	48 85 c0             	test   %rax,%rax
+  80015a:	74 d4                	je     800130 <memlayout+0x10b>
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80015c:	a8 40                	test   $0x40,%al
+  80015e:	49 bf f8 4a 80 00 00 	movabs $0x804af8,%r15
+  800165:	00 00 00 
+  800168:	4d 0f 44 fc          	cmove  %r12,%r15
+  80016c:	4c 89 65 c0          	mov    %r12,-0x40(%rbp)
+  800170:	f6 c4 08             	test   $0x8,%ah
+  800173:	74 13                	je     800188 <memlayout+0x163>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+                    (ent & PROT_COW) ? total_cow++, " COW" : "",
+  800175:	48 83 45 90 01       	addq   $0x1,-0x70(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  80017a:	48 b8 ff 4a 80 00 00 	movabs $0x804aff,%rax
+  800181:	00 00 00 
+  800184:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800188:	c7 45 bc 2d 00 00 00 	movl   $0x2d,-0x44(%rbp)
+  80018f:	f6 c3 02             	test   $0x2,%bl
+  800192:	74 0c                	je     8001a0 <memlayout+0x17b>
+                    (ent & PTE_W)    ? total_w++, 'W' : '-',
+  800194:	48 83 45 98 01       	addq   $0x1,-0x68(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  800199:	c7 45 bc 57 00 00 00 	movl   $0x57,-0x44(%rbp)
+  8001a0:	c7 45 b8 2d 00 00 00 	movl   $0x2d,-0x48(%rbp)
+  8001a7:	f6 c3 04             	test   $0x4,%bl
+  8001aa:	74 0c                	je     8001b8 <memlayout+0x193>
+                    (ent & PTE_U)    ? total_u++, 'U' : '-',
+  8001ac:	48 83 45 a0 01       	addq   $0x1,-0x60(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001b1:	c7 45 b8 55 00 00 00 	movl   $0x55,-0x48(%rbp)
+  8001b8:	c7 45 b4 2d 00 00 00 	movl   $0x2d,-0x4c(%rbp)
+  8001bf:	f6 c3 01             	test   $0x1,%bl
+  8001c2:	0f 84 23 ff ff ff    	je     8000eb <memlayout+0xc6>
+                    (ent & PTE_P)    ? total_p++, 'P' : '-',
+  8001c8:	48 83 45 a8 01       	addq   $0x1,-0x58(%rbp)
+            cprintf("[%p] %lx -> %08lx: %c %c %c |%s%s\n",
+  8001cd:	c7 45 b4 50 00 00 00 	movl   $0x50,-0x4c(%rbp)
+  8001d4:	e9 12 ff ff ff       	jmp    8000eb <memlayout+0xc6>
+                    (ent & PROT_SHARE) ? " SHARE" : "");
+        }
+    }
+
+    cprintf("Memory usage summary:\n");
+  8001d9:	48 bf 17 4b 80 00 00 	movabs $0x804b17,%rdi
+  8001e0:	00 00 00 
+  8001e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001e8:	48 bb 9b 05 80 00 00 	movabs $0x80059b,%rbx
+  8001ef:	00 00 00 
+  8001f2:	ff d3                	call   *%rbx
+    cprintf("  PTE_P: %lu\n", (unsigned long)total_p);
+  8001f4:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8001f8:	48 bf 2e 4b 80 00 00 	movabs $0x804b2e,%rdi
+  8001ff:	00 00 00 
+  800202:	b8 00 00 00 00       	mov    $0x0,%eax
+  800207:	ff d3                	call   *%rbx
+    cprintf("  PTE_U: %lu\n", (unsigned long)total_u);
+  800209:	48 8b 75 a0          	mov    -0x60(%rbp),%rsi
+  80020d:	48 bf 3c 4b 80 00 00 	movabs $0x804b3c,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	ff d3                	call   *%rbx
+    cprintf("  PTE_W: %lu\n", (unsigned long)total_w);
+  80021e:	48 8b 75 98          	mov    -0x68(%rbp),%rsi
+  800222:	48 bf 4a 4b 80 00 00 	movabs $0x804b4a,%rdi
+  800229:	00 00 00 
+  80022c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800231:	ff d3                	call   *%rbx
+    cprintf("  PTE_COW: %lu\n", (unsigned long)total_cow);
+  800233:	48 8b 75 90          	mov    -0x70(%rbp),%rsi
+  800237:	48 bf 58 4b 80 00 00 	movabs $0x804b58,%rdi
+  80023e:	00 00 00 
+  800241:	b8 00 00 00 00       	mov    $0x0,%eax
+  800246:	ff d3                	call   *%rbx
+}
+  800248:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80024c:	5b                   	pop    %rbx
+  80024d:	41 5c                	pop    %r12
+  80024f:	41 5d                	pop    %r13
+  800251:	41 5e                	pop    %r14
+  800253:	41 5f                	pop    %r15
+  800255:	5d                   	pop    %rbp
+  800256:	c3                   	ret
+
+0000000000800257 <umain>:
+
+void
+umain(int argc, char *argv[]) {
+  800257:	55                   	push   %rbp
+  800258:	48 89 e5             	mov    %rsp,%rbp
+  80025b:	41 54                	push   %r12
+  80025d:	53                   	push   %rbx
+  80025e:	48 83 ec 10          	sub    $0x10,%rsp
+    envid_t ceid;
+    int pipefd[2];
+    int res;
+
+    memlayout();
+  800262:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800269:	00 00 00 
+  80026c:	ff d0                	call   *%rax
+
+    res = pipe(pipefd);
+  80026e:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  800272:	48 b8 2e 3e 80 00 00 	movabs $0x803e2e,%rax
+  800279:	00 00 00 
+  80027c:	ff d0                	call   *%rax
+    if (res < 0) panic("pipe() failed\n");
+  80027e:	85 c0                	test   %eax,%eax
+  800280:	78 46                	js     8002c8 <umain+0x71>
+    ceid = fork();
+  800282:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  800289:	00 00 00 
+  80028c:	ff d0                	call   *%rax
+    if (ceid < 0) panic("fork() failed\n");
+  80028e:	85 c0                	test   %eax,%eax
+  800290:	78 60                	js     8002f2 <umain+0x9b>
+
+    if (!ceid) {
+  800292:	0f 84 84 00 00 00    	je     80031c <umain+0xc5>
+        cprintf("==== Child\n");
+        memlayout();
+        return;
+    }
+
+    cprintf("==== Parent\n");
+  800298:	48 bf a3 4b 80 00 00 	movabs $0x804ba3,%rdi
+  80029f:	00 00 00 
+  8002a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002a7:	48 ba 9b 05 80 00 00 	movabs $0x80059b,%rdx
+  8002ae:	00 00 00 
+  8002b1:	ff d2                	call   *%rdx
+    memlayout();
+  8002b3:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8002ba:	00 00 00 
+  8002bd:	ff d0                	call   *%rax
+}
+  8002bf:	48 83 c4 10          	add    $0x10,%rsp
+  8002c3:	5b                   	pop    %rbx
+  8002c4:	41 5c                	pop    %r12
+  8002c6:	5d                   	pop    %rbp
+  8002c7:	c3                   	ret
+    if (res < 0) panic("pipe() failed\n");
+  8002c8:	48 ba 68 4b 80 00 00 	movabs $0x804b68,%rdx
+  8002cf:	00 00 00 
+  8002d2:	be 33 00 00 00       	mov    $0x33,%esi
+  8002d7:	48 bf 77 4b 80 00 00 	movabs $0x804b77,%rdi
+  8002de:	00 00 00 
+  8002e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002e6:	48 b9 4b 04 80 00 00 	movabs $0x80044b,%rcx
+  8002ed:	00 00 00 
+  8002f0:	ff d1                	call   *%rcx
+    if (ceid < 0) panic("fork() failed\n");
+  8002f2:	48 ba 88 4b 80 00 00 	movabs $0x804b88,%rdx
+  8002f9:	00 00 00 
+  8002fc:	be 35 00 00 00       	mov    $0x35,%esi
+  800301:	48 bf 77 4b 80 00 00 	movabs $0x804b77,%rdi
+  800308:	00 00 00 
+  80030b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800310:	48 b9 4b 04 80 00 00 	movabs $0x80044b,%rcx
+  800317:	00 00 00 
+  80031a:	ff d1                	call   *%rcx
+        cprintf("\n");
+  80031c:	48 bf 2c 4b 80 00 00 	movabs $0x804b2c,%rdi
+  800323:	00 00 00 
+  800326:	48 ba 9b 05 80 00 00 	movabs $0x80059b,%rdx
+  80032d:	00 00 00 
+  800330:	ff d2                	call   *%rdx
+  800332:	bb 00 90 01 00       	mov    $0x19000,%ebx
+            sys_yield();
+  800337:	49 bc bb 13 80 00 00 	movabs $0x8013bb,%r12
+  80033e:	00 00 00 
+  800341:	41 ff d4             	call   *%r12
+        for (i = 0; i < 102400; i++)
+  800344:	83 eb 01             	sub    $0x1,%ebx
+  800347:	75 f8                	jne    800341 <umain+0xea>
+        cprintf("==== Child\n");
+  800349:	48 bf 97 4b 80 00 00 	movabs $0x804b97,%rdi
+  800350:	00 00 00 
+  800353:	b8 00 00 00 00       	mov    $0x0,%eax
+  800358:	48 ba 9b 05 80 00 00 	movabs $0x80059b,%rdx
+  80035f:	00 00 00 
+  800362:	ff d2                	call   *%rdx
+        memlayout();
+  800364:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80036b:	00 00 00 
+  80036e:	ff d0                	call   *%rax
+        return;
+  800370:	e9 4a ff ff ff       	jmp    8002bf <umain+0x68>
+
+0000000000800375 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800375:	55                   	push   %rbp
+  800376:	48 89 e5             	mov    %rsp,%rbp
+  800379:	41 56                	push   %r14
+  80037b:	41 55                	push   %r13
+  80037d:	41 54                	push   %r12
+  80037f:	53                   	push   %rbx
+  800380:	41 89 fd             	mov    %edi,%r13d
+  800383:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80038d:	00 00 00 
+  800390:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800397:	00 00 00 
+  80039a:	48 39 c2             	cmp    %rax,%rdx
+  80039d:	73 17                	jae    8003b6 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80039f:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8003a2:	49 89 c4             	mov    %rax,%r12
+  8003a5:	48 83 c3 08          	add    $0x8,%rbx
+  8003a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003ae:	ff 53 f8             	call   *-0x8(%rbx)
+  8003b1:	4c 39 e3             	cmp    %r12,%rbx
+  8003b4:	72 ef                	jb     8003a5 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8003b6:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  8003bd:	00 00 00 
+  8003c0:	ff d0                	call   *%rax
+  8003c2:	89 c2                	mov    %eax,%edx
+  8003c4:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003ca:	48 89 d0             	mov    %rdx,%rax
+  8003cd:	48 c1 e0 04          	shl    $0x4,%rax
+  8003d1:	48 29 d0             	sub    %rdx,%rax
+  8003d4:	48 c1 e0 05          	shl    $0x5,%rax
+  8003d8:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003df:	00 00 00 
+  8003e2:	48 01 d0             	add    %rdx,%rax
+  8003e5:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8003ec:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003ef:	45 85 ed             	test   %r13d,%r13d
+  8003f2:	7e 0d                	jle    800401 <libmain+0x8c>
+  8003f4:	49 8b 06             	mov    (%r14),%rax
+  8003f7:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003fe:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800401:	4c 89 f6             	mov    %r14,%rsi
+  800404:	44 89 ef             	mov    %r13d,%edi
+  800407:	48 b8 57 02 80 00 00 	movabs $0x800257,%rax
+  80040e:	00 00 00 
+  800411:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800413:	48 b8 28 04 80 00 00 	movabs $0x800428,%rax
+  80041a:	00 00 00 
+  80041d:	ff d0                	call   *%rax
+#endif
+}
+  80041f:	5b                   	pop    %rbx
+  800420:	41 5c                	pop    %r12
+  800422:	41 5d                	pop    %r13
+  800424:	41 5e                	pop    %r14
+  800426:	5d                   	pop    %rbp
+  800427:	c3                   	ret
+
+0000000000800428 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800428:	55                   	push   %rbp
+  800429:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80042c:	48 b8 98 1b 80 00 00 	movabs $0x801b98,%rax
+  800433:	00 00 00 
+  800436:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800438:	bf 00 00 00 00       	mov    $0x0,%edi
+  80043d:	48 b8 2f 13 80 00 00 	movabs $0x80132f,%rax
+  800444:	00 00 00 
+  800447:	ff d0                	call   *%rax
+}
+  800449:	5d                   	pop    %rbp
+  80044a:	c3                   	ret
+
+000000000080044b <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80044b:	55                   	push   %rbp
+  80044c:	48 89 e5             	mov    %rsp,%rbp
+  80044f:	41 56                	push   %r14
+  800451:	41 55                	push   %r13
+  800453:	41 54                	push   %r12
+  800455:	53                   	push   %rbx
+  800456:	48 83 ec 50          	sub    $0x50,%rsp
+  80045a:	49 89 fc             	mov    %rdi,%r12
+  80045d:	41 89 f5             	mov    %esi,%r13d
+  800460:	48 89 d3             	mov    %rdx,%rbx
+  800463:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800467:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80046b:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  80046f:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800476:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80047a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  80047e:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800482:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800486:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80048d:	00 00 00 
+  800490:	4c 8b 30             	mov    (%rax),%r14
+  800493:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+  80049f:	89 c6                	mov    %eax,%esi
+  8004a1:	45 89 e8             	mov    %r13d,%r8d
+  8004a4:	4c 89 e1             	mov    %r12,%rcx
+  8004a7:	4c 89 f2             	mov    %r14,%rdx
+  8004aa:	48 bf 10 4c 80 00 00 	movabs $0x804c10,%rdi
+  8004b1:	00 00 00 
+  8004b4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004b9:	49 bc 9b 05 80 00 00 	movabs $0x80059b,%r12
+  8004c0:	00 00 00 
+  8004c3:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004c6:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004ca:	48 89 df             	mov    %rbx,%rdi
+  8004cd:	48 b8 37 05 80 00 00 	movabs $0x800537,%rax
+  8004d4:	00 00 00 
+  8004d7:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004d9:	48 bf 2c 4b 80 00 00 	movabs $0x804b2c,%rdi
+  8004e0:	00 00 00 
+  8004e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004e8:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004eb:	cc                   	int3
+  8004ec:	eb fd                	jmp    8004eb <_panic+0xa0>
+
+00000000008004ee <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004ee:	55                   	push   %rbp
+  8004ef:	48 89 e5             	mov    %rsp,%rbp
+  8004f2:	53                   	push   %rbx
+  8004f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8004f7:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004fa:	8b 06                	mov    (%rsi),%eax
+  8004fc:	8d 50 01             	lea    0x1(%rax),%edx
+  8004ff:	89 16                	mov    %edx,(%rsi)
+  800501:	48 98                	cltq
+  800503:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800508:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80050e:	74 0a                	je     80051a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800510:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800514:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800518:	c9                   	leave
+  800519:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80051a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80051e:	be ff 00 00 00       	mov    $0xff,%esi
+  800523:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  80052a:	00 00 00 
+  80052d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80052f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800535:	eb d9                	jmp    800510 <putch+0x22>
+
+0000000000800537 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800537:	55                   	push   %rbp
+  800538:	48 89 e5             	mov    %rsp,%rbp
+  80053b:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800542:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800545:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80054c:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800551:	b8 00 00 00 00       	mov    $0x0,%eax
+  800556:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800559:	48 89 f1             	mov    %rsi,%rcx
+  80055c:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800563:	48 bf ee 04 80 00 00 	movabs $0x8004ee,%rdi
+  80056a:	00 00 00 
+  80056d:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  800574:	00 00 00 
+  800577:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800579:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800580:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800587:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800593:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800599:	c9                   	leave
+  80059a:	c3                   	ret
+
+000000000080059b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80059b:	55                   	push   %rbp
+  80059c:	48 89 e5             	mov    %rsp,%rbp
+  80059f:	48 83 ec 50          	sub    $0x50,%rsp
+  8005a3:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8005a7:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8005ab:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8005af:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8005b3:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8005b7:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005be:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005c6:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005ca:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005ce:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005d2:	48 b8 37 05 80 00 00 	movabs $0x800537,%rax
+  8005d9:	00 00 00 
+  8005dc:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005de:	c9                   	leave
+  8005df:	c3                   	ret
+
+00000000008005e0 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005e0:	55                   	push   %rbp
+  8005e1:	48 89 e5             	mov    %rsp,%rbp
+  8005e4:	41 57                	push   %r15
+  8005e6:	41 56                	push   %r14
+  8005e8:	41 55                	push   %r13
+  8005ea:	41 54                	push   %r12
+  8005ec:	53                   	push   %rbx
+  8005ed:	48 83 ec 18          	sub    $0x18,%rsp
+  8005f1:	49 89 fc             	mov    %rdi,%r12
+  8005f4:	49 89 f5             	mov    %rsi,%r13
+  8005f7:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005fb:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005fe:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800601:	41 89 cf             	mov    %ecx,%r15d
+  800604:	4c 39 fa             	cmp    %r15,%rdx
+  800607:	73 5b                	jae    800664 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800609:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80060d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800611:	85 db                	test   %ebx,%ebx
+  800613:	7e 0e                	jle    800623 <print_num+0x43>
+            putch(padc, put_arg);
+  800615:	4c 89 ee             	mov    %r13,%rsi
+  800618:	44 89 f7             	mov    %r14d,%edi
+  80061b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80061e:	83 eb 01             	sub    $0x1,%ebx
+  800621:	75 f2                	jne    800615 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800623:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800627:	48 b9 44 4c 80 00 00 	movabs $0x804c44,%rcx
+  80062e:	00 00 00 
+  800631:	48 b8 33 4c 80 00 00 	movabs $0x804c33,%rax
+  800638:	00 00 00 
+  80063b:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80063f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800643:	ba 00 00 00 00       	mov    $0x0,%edx
+  800648:	49 f7 f7             	div    %r15
+  80064b:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80064f:	4c 89 ee             	mov    %r13,%rsi
+  800652:	41 ff d4             	call   *%r12
+}
+  800655:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800659:	5b                   	pop    %rbx
+  80065a:	41 5c                	pop    %r12
+  80065c:	41 5d                	pop    %r13
+  80065e:	41 5e                	pop    %r14
+  800660:	41 5f                	pop    %r15
+  800662:	5d                   	pop    %rbp
+  800663:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800664:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800668:	ba 00 00 00 00       	mov    $0x0,%edx
+  80066d:	49 f7 f7             	div    %r15
+  800670:	48 83 ec 08          	sub    $0x8,%rsp
+  800674:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800678:	52                   	push   %rdx
+  800679:	45 0f be c9          	movsbl %r9b,%r9d
+  80067d:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800681:	48 89 c2             	mov    %rax,%rdx
+  800684:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  80068b:	00 00 00 
+  80068e:	ff d0                	call   *%rax
+  800690:	48 83 c4 10          	add    $0x10,%rsp
+  800694:	eb 8d                	jmp    800623 <print_num+0x43>
+
+0000000000800696 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800696:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80069a:	48 8b 06             	mov    (%rsi),%rax
+  80069d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8006a1:	73 0a                	jae    8006ad <sprintputch+0x17>
+        *state->start++ = ch;
+  8006a3:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8006a7:	48 89 16             	mov    %rdx,(%rsi)
+  8006aa:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8006ad:	c3                   	ret
+
+00000000008006ae <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8006ae:	55                   	push   %rbp
+  8006af:	48 89 e5             	mov    %rsp,%rbp
+  8006b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8006b6:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8006ba:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006be:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006c2:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006c9:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006cd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006d1:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006d5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006d9:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006dd:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  8006e4:	00 00 00 
+  8006e7:	ff d0                	call   *%rax
+}
+  8006e9:	c9                   	leave
+  8006ea:	c3                   	ret
+
+00000000008006eb <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006eb:	55                   	push   %rbp
+  8006ec:	48 89 e5             	mov    %rsp,%rbp
+  8006ef:	41 57                	push   %r15
+  8006f1:	41 56                	push   %r14
+  8006f3:	41 55                	push   %r13
+  8006f5:	41 54                	push   %r12
+  8006f7:	53                   	push   %rbx
+  8006f8:	48 83 ec 38          	sub    $0x38,%rsp
+  8006fc:	49 89 fe             	mov    %rdi,%r14
+  8006ff:	49 89 f5             	mov    %rsi,%r13
+  800702:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800705:	48 8b 01             	mov    (%rcx),%rax
+  800708:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80070c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800710:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800714:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800718:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80071c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800720:	0f b6 3b             	movzbl (%rbx),%edi
+  800723:	40 80 ff 25          	cmp    $0x25,%dil
+  800727:	74 18                	je     800741 <vprintfmt+0x56>
+            if (!ch) return;
+  800729:	40 84 ff             	test   %dil,%dil
+  80072c:	0f 84 b1 06 00 00    	je     800de3 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800732:	40 0f b6 ff          	movzbl %dil,%edi
+  800736:	4c 89 ee             	mov    %r13,%rsi
+  800739:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80073c:	4c 89 e3             	mov    %r12,%rbx
+  80073f:	eb db                	jmp    80071c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800741:	be 00 00 00 00       	mov    $0x0,%esi
+  800746:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80074a:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80074f:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800755:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80075c:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800760:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800765:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80076a:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80076d:	83 e8 23             	sub    $0x23,%eax
+  800770:	3c 57                	cmp    $0x57,%al
+  800772:	0f 87 51 06 00 00    	ja     800dc9 <vprintfmt+0x6de>
+  800778:	0f b6 c0             	movzbl %al,%eax
+  80077b:	48 b9 00 4e 80 00 00 	movabs $0x804e00,%rcx
+  800782:	00 00 00 
+  800785:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800788:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80078b:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  80078f:	eb cf                	jmp    800760 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800791:	49 89 dc             	mov    %rbx,%r12
+  800794:	be 01 00 00 00       	mov    $0x1,%esi
+  800799:	eb c5                	jmp    800760 <vprintfmt+0x75>
+            padc = ch;
+  80079b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80079f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8007a5:	eb b9                	jmp    800760 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007a7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007aa:	83 f8 2f             	cmp    $0x2f,%eax
+  8007ad:	77 24                	ja     8007d3 <vprintfmt+0xe8>
+  8007af:	89 c1                	mov    %eax,%ecx
+  8007b1:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8007b5:	83 c0 08             	add    $0x8,%eax
+  8007b8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007bb:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007be:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007c1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007c5:	79 99                	jns    800760 <vprintfmt+0x75>
+                width = precision;
+  8007c7:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007cb:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007d1:	eb 8d                	jmp    800760 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007d3:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007d7:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb da                	jmp    8007bb <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007e1:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007e6:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ea:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007f0:	3c 39                	cmp    $0x39,%al
+  8007f2:	77 1c                	ja     800810 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007f4:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007f8:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007fc:	0f b6 c0             	movzbl %al,%eax
+  8007ff:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800804:	0f b6 03             	movzbl (%rbx),%eax
+  800807:	3c 39                	cmp    $0x39,%al
+  800809:	76 e9                	jbe    8007f4 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80080b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80080e:	eb b1                	jmp    8007c1 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800810:	49 89 dc             	mov    %rbx,%r12
+  800813:	eb ac                	jmp    8007c1 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800815:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800818:	85 c9                	test   %ecx,%ecx
+  80081a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80081f:	0f 49 c1             	cmovns %ecx,%eax
+  800822:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800825:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800828:	e9 33 ff ff ff       	jmp    800760 <vprintfmt+0x75>
+            lflag++;
+  80082d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800830:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800833:	e9 28 ff ff ff       	jmp    800760 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800838:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083b:	83 f8 2f             	cmp    $0x2f,%eax
+  80083e:	77 19                	ja     800859 <vprintfmt+0x16e>
+  800840:	89 c2                	mov    %eax,%edx
+  800842:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800846:	83 c0 08             	add    $0x8,%eax
+  800849:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084c:	8b 3a                	mov    (%rdx),%edi
+  80084e:	4c 89 ee             	mov    %r13,%rsi
+  800851:	41 ff d6             	call   *%r14
+            break;
+  800854:	e9 c3 fe ff ff       	jmp    80071c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800859:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80085d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800861:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800865:	eb e5                	jmp    80084c <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800867:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086a:	83 f8 2f             	cmp    $0x2f,%eax
+  80086d:	77 5a                	ja     8008c9 <vprintfmt+0x1de>
+  80086f:	89 c2                	mov    %eax,%edx
+  800871:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800875:	83 c0 08             	add    $0x8,%eax
+  800878:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80087b:	8b 02                	mov    (%rdx),%eax
+  80087d:	89 c1                	mov    %eax,%ecx
+  80087f:	f7 d9                	neg    %ecx
+  800881:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800884:	83 f9 16             	cmp    $0x16,%ecx
+  800887:	7f 4e                	jg     8008d7 <vprintfmt+0x1ec>
+  800889:	48 63 c1             	movslq %ecx,%rax
+  80088c:	48 ba c0 50 80 00 00 	movabs $0x8050c0,%rdx
+  800893:	00 00 00 
+  800896:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80089a:	48 85 c0             	test   %rax,%rax
+  80089d:	74 38                	je     8008d7 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80089f:	48 89 c1             	mov    %rax,%rcx
+  8008a2:	48 ba b9 52 80 00 00 	movabs $0x8052b9,%rdx
+  8008a9:	00 00 00 
+  8008ac:	4c 89 ee             	mov    %r13,%rsi
+  8008af:	4c 89 f7             	mov    %r14,%rdi
+  8008b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b7:	49 b8 ae 06 80 00 00 	movabs $0x8006ae,%r8
+  8008be:	00 00 00 
+  8008c1:	41 ff d0             	call   *%r8
+  8008c4:	e9 53 fe ff ff       	jmp    80071c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d5:	eb a4                	jmp    80087b <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008d7:	48 ba 5c 4c 80 00 00 	movabs $0x804c5c,%rdx
+  8008de:	00 00 00 
+  8008e1:	4c 89 ee             	mov    %r13,%rsi
+  8008e4:	4c 89 f7             	mov    %r14,%rdi
+  8008e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ec:	49 b8 ae 06 80 00 00 	movabs $0x8006ae,%r8
+  8008f3:	00 00 00 
+  8008f6:	41 ff d0             	call   *%r8
+  8008f9:	e9 1e fe ff ff       	jmp    80071c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008fe:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800901:	83 f8 2f             	cmp    $0x2f,%eax
+  800904:	77 6c                	ja     800972 <vprintfmt+0x287>
+  800906:	89 c2                	mov    %eax,%edx
+  800908:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090c:	83 c0 08             	add    $0x8,%eax
+  80090f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800912:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800915:	48 85 d2             	test   %rdx,%rdx
+  800918:	48 b8 55 4c 80 00 00 	movabs $0x804c55,%rax
+  80091f:	00 00 00 
+  800922:	48 0f 45 c2          	cmovne %rdx,%rax
+  800926:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80092a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80092e:	7e 06                	jle    800936 <vprintfmt+0x24b>
+  800930:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800934:	75 4a                	jne    800980 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800936:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80093a:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80093e:	0f b6 00             	movzbl (%rax),%eax
+  800941:	84 c0                	test   %al,%al
+  800943:	0f 85 9a 00 00 00    	jne    8009e3 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800949:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80094c:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800950:	85 c0                	test   %eax,%eax
+  800952:	0f 8e c4 fd ff ff    	jle    80071c <vprintfmt+0x31>
+  800958:	4c 89 ee             	mov    %r13,%rsi
+  80095b:	bf 20 00 00 00       	mov    $0x20,%edi
+  800960:	41 ff d6             	call   *%r14
+  800963:	41 83 ec 01          	sub    $0x1,%r12d
+  800967:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80096b:	75 eb                	jne    800958 <vprintfmt+0x26d>
+  80096d:	e9 aa fd ff ff       	jmp    80071c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800972:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800976:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097e:	eb 92                	jmp    800912 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800980:	49 63 f7             	movslq %r15d,%rsi
+  800983:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800987:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  80098e:	00 00 00 
+  800991:	ff d0                	call   *%rax
+  800993:	48 89 c2             	mov    %rax,%rdx
+  800996:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800999:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80099b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80099e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8009a1:	85 c0                	test   %eax,%eax
+  8009a3:	7e 91                	jle    800936 <vprintfmt+0x24b>
+  8009a5:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8009aa:	4c 89 ee             	mov    %r13,%rsi
+  8009ad:	44 89 e7             	mov    %r12d,%edi
+  8009b0:	41 ff d6             	call   *%r14
+  8009b3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b7:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009ba:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009bd:	75 eb                	jne    8009aa <vprintfmt+0x2bf>
+  8009bf:	e9 72 ff ff ff       	jmp    800936 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009c4:	0f b6 f8             	movzbl %al,%edi
+  8009c7:	4c 89 ee             	mov    %r13,%rsi
+  8009ca:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009cd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009d1:	49 83 c4 01          	add    $0x1,%r12
+  8009d5:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009db:	84 c0                	test   %al,%al
+  8009dd:	0f 84 66 ff ff ff    	je     800949 <vprintfmt+0x25e>
+  8009e3:	45 85 ff             	test   %r15d,%r15d
+  8009e6:	78 0a                	js     8009f2 <vprintfmt+0x307>
+  8009e8:	41 83 ef 01          	sub    $0x1,%r15d
+  8009ec:	0f 88 57 ff ff ff    	js     800949 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009f2:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009f6:	74 cc                	je     8009c4 <vprintfmt+0x2d9>
+  8009f8:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009fb:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a00:	80 fa 5e             	cmp    $0x5e,%dl
+  800a03:	77 c2                	ja     8009c7 <vprintfmt+0x2dc>
+  800a05:	eb bd                	jmp    8009c4 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a07:	40 84 f6             	test   %sil,%sil
+  800a0a:	75 26                	jne    800a32 <vprintfmt+0x347>
+    switch (lflag) {
+  800a0c:	85 d2                	test   %edx,%edx
+  800a0e:	74 59                	je     800a69 <vprintfmt+0x37e>
+  800a10:	83 fa 01             	cmp    $0x1,%edx
+  800a13:	74 7b                	je     800a90 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800a15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a18:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1b:	0f 87 96 00 00 00    	ja     800ab7 <vprintfmt+0x3cc>
+  800a21:	89 c2                	mov    %eax,%edx
+  800a23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a27:	83 c0 08             	add    $0x8,%eax
+  800a2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2d:	4c 8b 22             	mov    (%rdx),%r12
+  800a30:	eb 17                	jmp    800a49 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a35:	83 f8 2f             	cmp    $0x2f,%eax
+  800a38:	77 21                	ja     800a5b <vprintfmt+0x370>
+  800a3a:	89 c2                	mov    %eax,%edx
+  800a3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a40:	83 c0 08             	add    $0x8,%eax
+  800a43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a46:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a49:	4d 85 e4             	test   %r12,%r12
+  800a4c:	78 7a                	js     800ac8 <vprintfmt+0x3dd>
+            num = i;
+  800a4e:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a51:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a56:	e9 50 02 00 00       	jmp    800cab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb dd                	jmp    800a46 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6f:	77 11                	ja     800a82 <vprintfmt+0x397>
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a77:	83 c0 08             	add    $0x8,%eax
+  800a7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7d:	4c 63 22             	movslq (%rdx),%r12
+  800a80:	eb c7                	jmp    800a49 <vprintfmt+0x35e>
+  800a82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8e:	eb ed                	jmp    800a7d <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a93:	83 f8 2f             	cmp    $0x2f,%eax
+  800a96:	77 11                	ja     800aa9 <vprintfmt+0x3be>
+  800a98:	89 c2                	mov    %eax,%edx
+  800a9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9e:	83 c0 08             	add    $0x8,%eax
+  800aa1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa4:	4c 8b 22             	mov    (%rdx),%r12
+  800aa7:	eb a0                	jmp    800a49 <vprintfmt+0x35e>
+  800aa9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aad:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab5:	eb ed                	jmp    800aa4 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800ab7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac3:	e9 65 ff ff ff       	jmp    800a2d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800ac8:	4c 89 ee             	mov    %r13,%rsi
+  800acb:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ad0:	41 ff d6             	call   *%r14
+                i = -i;
+  800ad3:	49 f7 dc             	neg    %r12
+  800ad6:	e9 73 ff ff ff       	jmp    800a4e <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800adb:	40 84 f6             	test   %sil,%sil
+  800ade:	75 32                	jne    800b12 <vprintfmt+0x427>
+    switch (lflag) {
+  800ae0:	85 d2                	test   %edx,%edx
+  800ae2:	74 5d                	je     800b41 <vprintfmt+0x456>
+  800ae4:	83 fa 01             	cmp    $0x1,%edx
+  800ae7:	0f 84 82 00 00 00    	je     800b6f <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800aed:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af0:	83 f8 2f             	cmp    $0x2f,%eax
+  800af3:	0f 87 a5 00 00 00    	ja     800b9e <vprintfmt+0x4b3>
+  800af9:	89 c2                	mov    %eax,%edx
+  800afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aff:	83 c0 08             	add    $0x8,%eax
+  800b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b05:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b08:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b0d:	e9 99 01 00 00       	jmp    800cab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b15:	83 f8 2f             	cmp    $0x2f,%eax
+  800b18:	77 19                	ja     800b33 <vprintfmt+0x448>
+  800b1a:	89 c2                	mov    %eax,%edx
+  800b1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b20:	83 c0 08             	add    $0x8,%eax
+  800b23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b26:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b29:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b2e:	e9 78 01 00 00       	jmp    800cab <vprintfmt+0x5c0>
+  800b33:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b37:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b3b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3f:	eb e5                	jmp    800b26 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b41:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b44:	83 f8 2f             	cmp    $0x2f,%eax
+  800b47:	77 18                	ja     800b61 <vprintfmt+0x476>
+  800b49:	89 c2                	mov    %eax,%edx
+  800b4b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b4f:	83 c0 08             	add    $0x8,%eax
+  800b52:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b55:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b57:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b5c:	e9 4a 01 00 00       	jmp    800cab <vprintfmt+0x5c0>
+  800b61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b6d:	eb e6                	jmp    800b55 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b6f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b72:	83 f8 2f             	cmp    $0x2f,%eax
+  800b75:	77 19                	ja     800b90 <vprintfmt+0x4a5>
+  800b77:	89 c2                	mov    %eax,%edx
+  800b79:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b7d:	83 c0 08             	add    $0x8,%eax
+  800b80:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b83:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b86:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b8b:	e9 1b 01 00 00       	jmp    800cab <vprintfmt+0x5c0>
+  800b90:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b94:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b98:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b9c:	eb e5                	jmp    800b83 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b9e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ba6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800baa:	e9 56 ff ff ff       	jmp    800b05 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800baf:	40 84 f6             	test   %sil,%sil
+  800bb2:	75 2e                	jne    800be2 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800bb4:	85 d2                	test   %edx,%edx
+  800bb6:	74 59                	je     800c11 <vprintfmt+0x526>
+  800bb8:	83 fa 01             	cmp    $0x1,%edx
+  800bbb:	74 7f                	je     800c3c <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800bbd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc0:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc3:	0f 87 9f 00 00 00    	ja     800c68 <vprintfmt+0x57d>
+  800bc9:	89 c2                	mov    %eax,%edx
+  800bcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcf:	83 c0 08             	add    $0x8,%eax
+  800bd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bd8:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bdd:	e9 c9 00 00 00       	jmp    800cab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800be2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be5:	83 f8 2f             	cmp    $0x2f,%eax
+  800be8:	77 19                	ja     800c03 <vprintfmt+0x518>
+  800bea:	89 c2                	mov    %eax,%edx
+  800bec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf0:	83 c0 08             	add    $0x8,%eax
+  800bf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bf9:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bfe:	e9 a8 00 00 00       	jmp    800cab <vprintfmt+0x5c0>
+  800c03:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c07:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c0f:	eb e5                	jmp    800bf6 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800c11:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c14:	83 f8 2f             	cmp    $0x2f,%eax
+  800c17:	77 15                	ja     800c2e <vprintfmt+0x543>
+  800c19:	89 c2                	mov    %eax,%edx
+  800c1b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c1f:	83 c0 08             	add    $0x8,%eax
+  800c22:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c25:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c27:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c2c:	eb 7d                	jmp    800cab <vprintfmt+0x5c0>
+  800c2e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c32:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3a:	eb e9                	jmp    800c25 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c3c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c3f:	83 f8 2f             	cmp    $0x2f,%eax
+  800c42:	77 16                	ja     800c5a <vprintfmt+0x56f>
+  800c44:	89 c2                	mov    %eax,%edx
+  800c46:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4a:	83 c0 08             	add    $0x8,%eax
+  800c4d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c50:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c53:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c58:	eb 51                	jmp    800cab <vprintfmt+0x5c0>
+  800c5a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c5e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c62:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c66:	eb e8                	jmp    800c50 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c68:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c6c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c70:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c74:	e9 5c ff ff ff       	jmp    800bd5 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c79:	4c 89 ee             	mov    %r13,%rsi
+  800c7c:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c81:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c84:	4c 89 ee             	mov    %r13,%rsi
+  800c87:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c8c:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c92:	83 f8 2f             	cmp    $0x2f,%eax
+  800c95:	77 47                	ja     800cde <vprintfmt+0x5f3>
+  800c97:	89 c2                	mov    %eax,%edx
+  800c99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c9d:	83 c0 08             	add    $0x8,%eax
+  800ca0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ca3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ca6:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800cab:	48 83 ec 08          	sub    $0x8,%rsp
+  800caf:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800cb3:	0f 94 c0             	sete   %al
+  800cb6:	0f b6 c0             	movzbl %al,%eax
+  800cb9:	50                   	push   %rax
+  800cba:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800cbf:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800cc3:	4c 89 ee             	mov    %r13,%rsi
+  800cc6:	4c 89 f7             	mov    %r14,%rdi
+  800cc9:	48 b8 e0 05 80 00 00 	movabs $0x8005e0,%rax
+  800cd0:	00 00 00 
+  800cd3:	ff d0                	call   *%rax
+            break;
+  800cd5:	48 83 c4 10          	add    $0x10,%rsp
+  800cd9:	e9 3e fa ff ff       	jmp    80071c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cde:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ce2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ce6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cea:	eb b7                	jmp    800ca3 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cec:	40 84 f6             	test   %sil,%sil
+  800cef:	75 2b                	jne    800d1c <vprintfmt+0x631>
+    switch (lflag) {
+  800cf1:	85 d2                	test   %edx,%edx
+  800cf3:	74 56                	je     800d4b <vprintfmt+0x660>
+  800cf5:	83 fa 01             	cmp    $0x1,%edx
+  800cf8:	74 7f                	je     800d79 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cfa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cfd:	83 f8 2f             	cmp    $0x2f,%eax
+  800d00:	0f 87 a2 00 00 00    	ja     800da8 <vprintfmt+0x6bd>
+  800d06:	89 c2                	mov    %eax,%edx
+  800d08:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0c:	83 c0 08             	add    $0x8,%eax
+  800d0f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d12:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d15:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800d1a:	eb 8f                	jmp    800cab <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d1c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d1f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d22:	77 19                	ja     800d3d <vprintfmt+0x652>
+  800d24:	89 c2                	mov    %eax,%edx
+  800d26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2a:	83 c0 08             	add    $0x8,%eax
+  800d2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d33:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d38:	e9 6e ff ff ff       	jmp    800cab <vprintfmt+0x5c0>
+  800d3d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d41:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d45:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d49:	eb e5                	jmp    800d30 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d4b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d4e:	83 f8 2f             	cmp    $0x2f,%eax
+  800d51:	77 18                	ja     800d6b <vprintfmt+0x680>
+  800d53:	89 c2                	mov    %eax,%edx
+  800d55:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d59:	83 c0 08             	add    $0x8,%eax
+  800d5c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d5f:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d61:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d66:	e9 40 ff ff ff       	jmp    800cab <vprintfmt+0x5c0>
+  800d6b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d6f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d73:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d77:	eb e6                	jmp    800d5f <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d79:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d7c:	83 f8 2f             	cmp    $0x2f,%eax
+  800d7f:	77 19                	ja     800d9a <vprintfmt+0x6af>
+  800d81:	89 c2                	mov    %eax,%edx
+  800d83:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d87:	83 c0 08             	add    $0x8,%eax
+  800d8a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d8d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d90:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d95:	e9 11 ff ff ff       	jmp    800cab <vprintfmt+0x5c0>
+  800d9a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d9e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800da2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800da6:	eb e5                	jmp    800d8d <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800da8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dac:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800db0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800db4:	e9 59 ff ff ff       	jmp    800d12 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800db9:	4c 89 ee             	mov    %r13,%rsi
+  800dbc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dc1:	41 ff d6             	call   *%r14
+            break;
+  800dc4:	e9 53 f9 ff ff       	jmp    80071c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dc9:	4c 89 ee             	mov    %r13,%rsi
+  800dcc:	bf 25 00 00 00       	mov    $0x25,%edi
+  800dd1:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800dd4:	48 83 eb 01          	sub    $0x1,%rbx
+  800dd8:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ddc:	75 f6                	jne    800dd4 <vprintfmt+0x6e9>
+  800dde:	e9 39 f9 ff ff       	jmp    80071c <vprintfmt+0x31>
+}
+  800de3:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800de7:	5b                   	pop    %rbx
+  800de8:	41 5c                	pop    %r12
+  800dea:	41 5d                	pop    %r13
+  800dec:	41 5e                	pop    %r14
+  800dee:	41 5f                	pop    %r15
+  800df0:	5d                   	pop    %rbp
+  800df1:	c3                   	ret
+
+0000000000800df2 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800df2:	55                   	push   %rbp
+  800df3:	48 89 e5             	mov    %rsp,%rbp
+  800df6:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dfa:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800dfe:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e03:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e07:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800e0e:	48 85 ff             	test   %rdi,%rdi
+  800e11:	74 2b                	je     800e3e <vsnprintf+0x4c>
+  800e13:	48 85 f6             	test   %rsi,%rsi
+  800e16:	74 26                	je     800e3e <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800e18:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e1c:	48 bf 96 06 80 00 00 	movabs $0x800696,%rdi
+  800e23:	00 00 00 
+  800e26:	48 b8 eb 06 80 00 00 	movabs $0x8006eb,%rax
+  800e2d:	00 00 00 
+  800e30:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e32:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e36:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e39:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e3c:	c9                   	leave
+  800e3d:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e43:	eb f7                	jmp    800e3c <vsnprintf+0x4a>
+
+0000000000800e45 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e45:	55                   	push   %rbp
+  800e46:	48 89 e5             	mov    %rsp,%rbp
+  800e49:	48 83 ec 50          	sub    $0x50,%rsp
+  800e4d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e51:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e55:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e59:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e60:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e64:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e68:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e6c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e70:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e74:	48 b8 f2 0d 80 00 00 	movabs $0x800df2,%rax
+  800e7b:	00 00 00 
+  800e7e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e80:	c9                   	leave
+  800e81:	c3                   	ret
+
+0000000000800e82 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e82:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e85:	74 10                	je     800e97 <strlen+0x15>
+    size_t n = 0;
+  800e87:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e8c:	48 83 c0 01          	add    $0x1,%rax
+  800e90:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e94:	75 f6                	jne    800e8c <strlen+0xa>
+  800e96:	c3                   	ret
+    size_t n = 0;
+  800e97:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e9c:	c3                   	ret
+
+0000000000800e9d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e9d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800ea0:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800ea5:	48 85 f6             	test   %rsi,%rsi
+  800ea8:	74 11                	je     800ebb <strnlen+0x1e>
+  800eaa:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800eae:	74 0c                	je     800ebc <strnlen+0x1f>
+  800eb0:	48 83 c2 01          	add    $0x1,%rdx
+  800eb4:	48 39 d0             	cmp    %rdx,%rax
+  800eb7:	75 f1                	jne    800eaa <strnlen+0xd>
+  800eb9:	eb 04                	jmp    800ebf <strnlen+0x22>
+  800ebb:	c3                   	ret
+  800ebc:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ebf:	c3                   	ret
+
+0000000000800ec0 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ec0:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ec3:	ba 00 00 00 00       	mov    $0x0,%edx
+  800ec8:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ecc:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ecf:	48 83 c2 01          	add    $0x1,%rdx
+  800ed3:	84 c9                	test   %cl,%cl
+  800ed5:	75 f1                	jne    800ec8 <strcpy+0x8>
+        ;
+    return res;
+}
+  800ed7:	c3                   	ret
+
+0000000000800ed8 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ed8:	55                   	push   %rbp
+  800ed9:	48 89 e5             	mov    %rsp,%rbp
+  800edc:	41 54                	push   %r12
+  800ede:	53                   	push   %rbx
+  800edf:	48 89 fb             	mov    %rdi,%rbx
+  800ee2:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ee5:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  800eec:	00 00 00 
+  800eef:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ef1:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ef5:	4c 89 e6             	mov    %r12,%rsi
+  800ef8:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  800eff:	00 00 00 
+  800f02:	ff d0                	call   *%rax
+    return dst;
+}
+  800f04:	48 89 d8             	mov    %rbx,%rax
+  800f07:	5b                   	pop    %rbx
+  800f08:	41 5c                	pop    %r12
+  800f0a:	5d                   	pop    %rbp
+  800f0b:	c3                   	ret
+
+0000000000800f0c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f0c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800f0f:	48 85 d2             	test   %rdx,%rdx
+  800f12:	74 1f                	je     800f33 <strncpy+0x27>
+  800f14:	48 01 fa             	add    %rdi,%rdx
+  800f17:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800f1a:	48 83 c1 01          	add    $0x1,%rcx
+  800f1e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f22:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f26:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f2a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f2e:	48 39 ca             	cmp    %rcx,%rdx
+  800f31:	75 e7                	jne    800f1a <strncpy+0xe>
+    }
+    return ret;
+}
+  800f33:	c3                   	ret
+
+0000000000800f34 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f34:	48 89 f8             	mov    %rdi,%rax
+  800f37:	48 85 d2             	test   %rdx,%rdx
+  800f3a:	74 24                	je     800f60 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f3c:	48 83 ea 01          	sub    $0x1,%rdx
+  800f40:	74 1b                	je     800f5d <strlcpy+0x29>
+  800f42:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f46:	0f b6 16             	movzbl (%rsi),%edx
+  800f49:	84 d2                	test   %dl,%dl
+  800f4b:	74 10                	je     800f5d <strlcpy+0x29>
+            *dst++ = *src++;
+  800f4d:	48 83 c6 01          	add    $0x1,%rsi
+  800f51:	48 83 c0 01          	add    $0x1,%rax
+  800f55:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f58:	48 39 c8             	cmp    %rcx,%rax
+  800f5b:	75 e9                	jne    800f46 <strlcpy+0x12>
+        *dst = '\0';
+  800f5d:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f60:	48 29 f8             	sub    %rdi,%rax
+}
+  800f63:	c3                   	ret
+
+0000000000800f64 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f64:	0f b6 07             	movzbl (%rdi),%eax
+  800f67:	84 c0                	test   %al,%al
+  800f69:	74 13                	je     800f7e <strcmp+0x1a>
+  800f6b:	38 06                	cmp    %al,(%rsi)
+  800f6d:	75 0f                	jne    800f7e <strcmp+0x1a>
+  800f6f:	48 83 c7 01          	add    $0x1,%rdi
+  800f73:	48 83 c6 01          	add    $0x1,%rsi
+  800f77:	0f b6 07             	movzbl (%rdi),%eax
+  800f7a:	84 c0                	test   %al,%al
+  800f7c:	75 ed                	jne    800f6b <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f7e:	0f b6 c0             	movzbl %al,%eax
+  800f81:	0f b6 16             	movzbl (%rsi),%edx
+  800f84:	29 d0                	sub    %edx,%eax
+}
+  800f86:	c3                   	ret
+
+0000000000800f87 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f87:	48 85 d2             	test   %rdx,%rdx
+  800f8a:	74 1f                	je     800fab <strncmp+0x24>
+  800f8c:	0f b6 07             	movzbl (%rdi),%eax
+  800f8f:	84 c0                	test   %al,%al
+  800f91:	74 1e                	je     800fb1 <strncmp+0x2a>
+  800f93:	3a 06                	cmp    (%rsi),%al
+  800f95:	75 1a                	jne    800fb1 <strncmp+0x2a>
+  800f97:	48 83 c7 01          	add    $0x1,%rdi
+  800f9b:	48 83 c6 01          	add    $0x1,%rsi
+  800f9f:	48 83 ea 01          	sub    $0x1,%rdx
+  800fa3:	75 e7                	jne    800f8c <strncmp+0x5>
+
+    if (!n) return 0;
+  800fa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800faa:	c3                   	ret
+  800fab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fb0:	c3                   	ret
+  800fb1:	48 85 d2             	test   %rdx,%rdx
+  800fb4:	74 09                	je     800fbf <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800fb6:	0f b6 07             	movzbl (%rdi),%eax
+  800fb9:	0f b6 16             	movzbl (%rsi),%edx
+  800fbc:	29 d0                	sub    %edx,%eax
+  800fbe:	c3                   	ret
+    if (!n) return 0;
+  800fbf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fc4:	c3                   	ret
+
+0000000000800fc5 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fc5:	0f b6 17             	movzbl (%rdi),%edx
+  800fc8:	84 d2                	test   %dl,%dl
+  800fca:	74 18                	je     800fe4 <strchr+0x1f>
+        if (*str == c) {
+  800fcc:	0f be d2             	movsbl %dl,%edx
+  800fcf:	39 f2                	cmp    %esi,%edx
+  800fd1:	74 17                	je     800fea <strchr+0x25>
+    for (; *str; str++) {
+  800fd3:	48 83 c7 01          	add    $0x1,%rdi
+  800fd7:	0f b6 17             	movzbl (%rdi),%edx
+  800fda:	84 d2                	test   %dl,%dl
+  800fdc:	75 ee                	jne    800fcc <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fde:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe3:	c3                   	ret
+  800fe4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fe9:	c3                   	ret
+  800fea:	48 89 f8             	mov    %rdi,%rax
+}
+  800fed:	c3                   	ret
+
+0000000000800fee <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fee:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800ff1:	0f b6 17             	movzbl (%rdi),%edx
+  800ff4:	84 d2                	test   %dl,%dl
+  800ff6:	74 13                	je     80100b <strfind+0x1d>
+  800ff8:	0f be d2             	movsbl %dl,%edx
+  800ffb:	39 f2                	cmp    %esi,%edx
+  800ffd:	74 0b                	je     80100a <strfind+0x1c>
+  800fff:	48 83 c0 01          	add    $0x1,%rax
+  801003:	0f b6 10             	movzbl (%rax),%edx
+  801006:	84 d2                	test   %dl,%dl
+  801008:	75 ee                	jne    800ff8 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80100a:	c3                   	ret
+  80100b:	c3                   	ret
+
+000000000080100c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80100c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80100f:	48 89 f8             	mov    %rdi,%rax
+  801012:	48 f7 d8             	neg    %rax
+  801015:	83 e0 07             	and    $0x7,%eax
+  801018:	49 89 d1             	mov    %rdx,%r9
+  80101b:	49 29 c1             	sub    %rax,%r9
+  80101e:	78 36                	js     801056 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801020:	40 0f b6 c6          	movzbl %sil,%eax
+  801024:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80102b:	01 01 01 
+  80102e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801032:	40 f6 c7 07          	test   $0x7,%dil
+  801036:	75 38                	jne    801070 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801038:	4c 89 c9             	mov    %r9,%rcx
+  80103b:	48 c1 f9 03          	sar    $0x3,%rcx
+  80103f:	74 0c                	je     80104d <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801041:	fc                   	cld
+  801042:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801045:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801049:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  80104d:	4d 85 c9             	test   %r9,%r9
+  801050:	75 45                	jne    801097 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801052:	4c 89 c0             	mov    %r8,%rax
+  801055:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801056:	48 85 d2             	test   %rdx,%rdx
+  801059:	74 f7                	je     801052 <memset+0x46>
+  80105b:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80105e:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801061:	48 83 c0 01          	add    $0x1,%rax
+  801065:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  801069:	48 39 c2             	cmp    %rax,%rdx
+  80106c:	75 f3                	jne    801061 <memset+0x55>
+  80106e:	eb e2                	jmp    801052 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801070:	40 f6 c7 01          	test   $0x1,%dil
+  801074:	74 06                	je     80107c <memset+0x70>
+  801076:	88 07                	mov    %al,(%rdi)
+  801078:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80107c:	40 f6 c7 02          	test   $0x2,%dil
+  801080:	74 07                	je     801089 <memset+0x7d>
+  801082:	66 89 07             	mov    %ax,(%rdi)
+  801085:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801089:	40 f6 c7 04          	test   $0x4,%dil
+  80108d:	74 a9                	je     801038 <memset+0x2c>
+  80108f:	89 07                	mov    %eax,(%rdi)
+  801091:	48 83 c7 04          	add    $0x4,%rdi
+  801095:	eb a1                	jmp    801038 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801097:	41 f6 c1 04          	test   $0x4,%r9b
+  80109b:	74 06                	je     8010a3 <memset+0x97>
+  80109d:	89 07                	mov    %eax,(%rdi)
+  80109f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8010a3:	41 f6 c1 02          	test   $0x2,%r9b
+  8010a7:	74 07                	je     8010b0 <memset+0xa4>
+  8010a9:	66 89 07             	mov    %ax,(%rdi)
+  8010ac:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8010b0:	41 f6 c1 01          	test   $0x1,%r9b
+  8010b4:	74 9c                	je     801052 <memset+0x46>
+  8010b6:	88 07                	mov    %al,(%rdi)
+  8010b8:	eb 98                	jmp    801052 <memset+0x46>
+
+00000000008010ba <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8010ba:	48 89 f8             	mov    %rdi,%rax
+  8010bd:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010c0:	48 39 fe             	cmp    %rdi,%rsi
+  8010c3:	73 3b                	jae    801100 <memmove+0x46>
+  8010c5:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010c9:	48 39 d7             	cmp    %rdx,%rdi
+  8010cc:	73 32                	jae    801100 <memmove+0x46>
+        s += n;
+        d += n;
+  8010ce:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010d2:	48 89 d6             	mov    %rdx,%rsi
+  8010d5:	48 09 fe             	or     %rdi,%rsi
+  8010d8:	48 09 ce             	or     %rcx,%rsi
+  8010db:	40 f6 c6 07          	test   $0x7,%sil
+  8010df:	75 12                	jne    8010f3 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010e1:	48 83 ef 08          	sub    $0x8,%rdi
+  8010e5:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010e9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010ed:	fd                   	std
+  8010ee:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010f1:	fc                   	cld
+  8010f2:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010f3:	48 83 ef 01          	sub    $0x1,%rdi
+  8010f7:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010fb:	fd                   	std
+  8010fc:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010fe:	eb f1                	jmp    8010f1 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801100:	48 89 f2             	mov    %rsi,%rdx
+  801103:	48 09 c2             	or     %rax,%rdx
+  801106:	48 09 ca             	or     %rcx,%rdx
+  801109:	f6 c2 07             	test   $0x7,%dl
+  80110c:	75 0c                	jne    80111a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80110e:	48 c1 e9 03          	shr    $0x3,%rcx
+  801112:	48 89 c7             	mov    %rax,%rdi
+  801115:	fc                   	cld
+  801116:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801119:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  80111a:	48 89 c7             	mov    %rax,%rdi
+  80111d:	fc                   	cld
+  80111e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801120:	c3                   	ret
+
+0000000000801121 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801121:	55                   	push   %rbp
+  801122:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801125:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  80112c:	00 00 00 
+  80112f:	ff d0                	call   *%rax
+}
+  801131:	5d                   	pop    %rbp
+  801132:	c3                   	ret
+
+0000000000801133 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801133:	55                   	push   %rbp
+  801134:	48 89 e5             	mov    %rsp,%rbp
+  801137:	41 57                	push   %r15
+  801139:	41 56                	push   %r14
+  80113b:	41 55                	push   %r13
+  80113d:	41 54                	push   %r12
+  80113f:	53                   	push   %rbx
+  801140:	48 83 ec 08          	sub    $0x8,%rsp
+  801144:	49 89 fe             	mov    %rdi,%r14
+  801147:	49 89 f7             	mov    %rsi,%r15
+  80114a:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  80114d:	48 89 f7             	mov    %rsi,%rdi
+  801150:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  801157:	00 00 00 
+  80115a:	ff d0                	call   *%rax
+  80115c:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80115f:	48 89 de             	mov    %rbx,%rsi
+  801162:	4c 89 f7             	mov    %r14,%rdi
+  801165:	48 b8 9d 0e 80 00 00 	movabs $0x800e9d,%rax
+  80116c:	00 00 00 
+  80116f:	ff d0                	call   *%rax
+  801171:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801174:	48 39 c3             	cmp    %rax,%rbx
+  801177:	74 36                	je     8011af <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801179:	48 89 d8             	mov    %rbx,%rax
+  80117c:	4c 29 e8             	sub    %r13,%rax
+  80117f:	49 39 c4             	cmp    %rax,%r12
+  801182:	73 31                	jae    8011b5 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801184:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801189:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80118d:	4c 89 fe             	mov    %r15,%rsi
+  801190:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  801197:	00 00 00 
+  80119a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80119c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8011a0:	48 83 c4 08          	add    $0x8,%rsp
+  8011a4:	5b                   	pop    %rbx
+  8011a5:	41 5c                	pop    %r12
+  8011a7:	41 5d                	pop    %r13
+  8011a9:	41 5e                	pop    %r14
+  8011ab:	41 5f                	pop    %r15
+  8011ad:	5d                   	pop    %rbp
+  8011ae:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8011af:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8011b3:	eb eb                	jmp    8011a0 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8011b5:	48 83 eb 01          	sub    $0x1,%rbx
+  8011b9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011bd:	48 89 da             	mov    %rbx,%rdx
+  8011c0:	4c 89 fe             	mov    %r15,%rsi
+  8011c3:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  8011ca:	00 00 00 
+  8011cd:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011cf:	49 01 de             	add    %rbx,%r14
+  8011d2:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011d7:	eb c3                	jmp    80119c <strlcat+0x69>
+
+00000000008011d9 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011d9:	48 85 d2             	test   %rdx,%rdx
+  8011dc:	74 2d                	je     80120b <memcmp+0x32>
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011e3:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011e7:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011ec:	44 38 c1             	cmp    %r8b,%cl
+  8011ef:	75 0f                	jne    801200 <memcmp+0x27>
+    while (n-- > 0) {
+  8011f1:	48 83 c0 01          	add    $0x1,%rax
+  8011f5:	48 39 c2             	cmp    %rax,%rdx
+  8011f8:	75 e9                	jne    8011e3 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011ff:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801200:	0f b6 c1             	movzbl %cl,%eax
+  801203:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801207:	44 29 c0             	sub    %r8d,%eax
+  80120a:	c3                   	ret
+    return 0;
+  80120b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801210:	c3                   	ret
+
+0000000000801211 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801211:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801215:	48 39 c7             	cmp    %rax,%rdi
+  801218:	73 0f                	jae    801229 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  80121a:	40 38 37             	cmp    %sil,(%rdi)
+  80121d:	74 0e                	je     80122d <memfind+0x1c>
+    for (; src < end; src++) {
+  80121f:	48 83 c7 01          	add    $0x1,%rdi
+  801223:	48 39 f8             	cmp    %rdi,%rax
+  801226:	75 f2                	jne    80121a <memfind+0x9>
+  801228:	c3                   	ret
+  801229:	48 89 f8             	mov    %rdi,%rax
+  80122c:	c3                   	ret
+  80122d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801230:	c3                   	ret
+
+0000000000801231 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801231:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801234:	0f b6 37             	movzbl (%rdi),%esi
+  801237:	40 80 fe 20          	cmp    $0x20,%sil
+  80123b:	74 06                	je     801243 <strtol+0x12>
+  80123d:	40 80 fe 09          	cmp    $0x9,%sil
+  801241:	75 13                	jne    801256 <strtol+0x25>
+  801243:	48 83 c7 01          	add    $0x1,%rdi
+  801247:	0f b6 37             	movzbl (%rdi),%esi
+  80124a:	40 80 fe 20          	cmp    $0x20,%sil
+  80124e:	74 f3                	je     801243 <strtol+0x12>
+  801250:	40 80 fe 09          	cmp    $0x9,%sil
+  801254:	74 ed                	je     801243 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801256:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801259:	83 e0 fd             	and    $0xfffffffd,%eax
+  80125c:	3c 01                	cmp    $0x1,%al
+  80125e:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801262:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  801268:	75 0f                	jne    801279 <strtol+0x48>
+  80126a:	80 3f 30             	cmpb   $0x30,(%rdi)
+  80126d:	74 14                	je     801283 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  80126f:	85 d2                	test   %edx,%edx
+  801271:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801276:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801279:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  80127e:	4c 63 ca             	movslq %edx,%r9
+  801281:	eb 36                	jmp    8012b9 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801283:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801287:	74 0f                	je     801298 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801289:	85 d2                	test   %edx,%edx
+  80128b:	75 ec                	jne    801279 <strtol+0x48>
+        s++;
+  80128d:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801291:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801296:	eb e1                	jmp    801279 <strtol+0x48>
+        s += 2;
+  801298:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80129c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8012a1:	eb d6                	jmp    801279 <strtol+0x48>
+            dig -= '0';
+  8012a3:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8012a6:	44 0f b6 c1          	movzbl %cl,%r8d
+  8012aa:	41 39 d0             	cmp    %edx,%r8d
+  8012ad:	7d 21                	jge    8012d0 <strtol+0x9f>
+        val = val * base + dig;
+  8012af:	49 0f af c1          	imul   %r9,%rax
+  8012b3:	0f b6 c9             	movzbl %cl,%ecx
+  8012b6:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8012b9:	48 83 c7 01          	add    $0x1,%rdi
+  8012bd:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012c1:	80 f9 39             	cmp    $0x39,%cl
+  8012c4:	76 dd                	jbe    8012a3 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012c6:	80 f9 7b             	cmp    $0x7b,%cl
+  8012c9:	77 05                	ja     8012d0 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012cb:	83 e9 57             	sub    $0x57,%ecx
+  8012ce:	eb d6                	jmp    8012a6 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012d0:	4d 85 d2             	test   %r10,%r10
+  8012d3:	74 03                	je     8012d8 <strtol+0xa7>
+  8012d5:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012d8:	48 89 c2             	mov    %rax,%rdx
+  8012db:	48 f7 da             	neg    %rdx
+  8012de:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012e2:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012e6:	c3                   	ret
+
+00000000008012e7 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8012e7:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012f1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012f7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012fd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801303:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801305:	c3                   	ret
+
+0000000000801306 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801306:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80130b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801310:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801315:	ba 00 00 00 00       	mov    $0x0,%edx
+  80131a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801320:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801326:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80132c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80132e:	c3                   	ret
+
+000000000080132f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80132f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801332:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801337:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80133c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801341:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801347:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80134d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801353:	0f 05                	syscall
+    if (check && ret > 0) {
+  801355:	48 85 c0             	test   %rax,%rax
+  801358:	7f 01                	jg     80135b <sys_env_destroy+0x2c>
+}
+  80135a:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80135b:	55                   	push   %rbp
+  80135c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80135f:	49 89 c0             	mov    %rax,%r8
+  801362:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801367:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  80136e:	00 00 00 
+  801371:	be 29 00 00 00       	mov    $0x29,%esi
+  801376:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  80137d:	00 00 00 
+  801380:	b8 00 00 00 00       	mov    $0x0,%eax
+  801385:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  80138c:	00 00 00 
+  80138f:	41 ff d1             	call   *%r9
+
+0000000000801392 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801392:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801397:	bf 00 00 00 00       	mov    $0x0,%edi
+  80139c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b8:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013ba:	c3                   	ret
+
+00000000008013bb <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013bb:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013c0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013c5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013cf:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e1:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013e3:	c3                   	ret
+
+00000000008013e4 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013e4:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013e9:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8013f0:	00 00 00 
+  8013f3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801405:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801407:	c3                   	ret
+
+0000000000801408 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801408:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80140b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801410:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801416:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80141c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80141e:	c3                   	ret
+
+000000000080141f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80141f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801427:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80142a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801430:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801436:	0f 05                	syscall
+    if (check && ret > 0) {
+  801438:	48 85 c0             	test   %rax,%rax
+  80143b:	7f 01                	jg     80143e <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80143d:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80143e:	55                   	push   %rbp
+  80143f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801442:	49 89 c0             	mov    %rax,%r8
+  801445:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80144a:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  801451:	00 00 00 
+  801454:	be 29 00 00 00       	mov    $0x29,%esi
+  801459:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  801460:	00 00 00 
+  801463:	b8 00 00 00 00       	mov    $0x0,%eax
+  801468:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  80146f:	00 00 00 
+  801472:	41 ff d1             	call   *%r9
+
+0000000000801475 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801475:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801478:	48 63 d2             	movslq %edx,%rdx
+  80147b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80147e:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801483:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801486:	0f 05                	syscall
+    if (check && ret > 0) {
+  801488:	48 85 c0             	test   %rax,%rax
+  80148b:	7f 01                	jg     80148e <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80148d:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80148e:	55                   	push   %rbp
+  80148f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801492:	49 89 c0             	mov    %rax,%r8
+  801495:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80149a:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  8014a1:	00 00 00 
+  8014a4:	be 29 00 00 00       	mov    $0x29,%esi
+  8014a9:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  8014b0:	00 00 00 
+  8014b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014b8:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  8014bf:	00 00 00 
+  8014c2:	41 ff d1             	call   *%r9
+
+00000000008014c5 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014c5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014c8:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014cd:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014df:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014e1:	48 85 c0             	test   %rax,%rax
+  8014e4:	7f 01                	jg     8014e7 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014e6:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014e7:	55                   	push   %rbp
+  8014e8:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014eb:	49 89 c0             	mov    %rax,%r8
+  8014ee:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014f3:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  8014fa:	00 00 00 
+  8014fd:	be 29 00 00 00       	mov    $0x29,%esi
+  801502:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  801509:	00 00 00 
+  80150c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801511:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  801518:	00 00 00 
+  80151b:	41 ff d1             	call   *%r9
+
+000000000080151e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80151e:	48 63 f6             	movslq %esi,%rsi
+  801521:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801524:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801529:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801534:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801540:	0f 05                	syscall
+    if (check && ret > 0) {
+  801542:	48 85 c0             	test   %rax,%rax
+  801545:	7f 01                	jg     801548 <sys_env_set_status+0x2a>
+}
+  801547:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801548:	55                   	push   %rbp
+  801549:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154c:	49 89 c0             	mov    %rax,%r8
+  80154f:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801554:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  80155b:	00 00 00 
+  80155e:	be 29 00 00 00       	mov    $0x29,%esi
+  801563:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  80156a:	00 00 00 
+  80156d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801572:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  801579:	00 00 00 
+  80157c:	41 ff d1             	call   *%r9
+
+000000000080157f <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80157f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801582:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801587:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801592:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801598:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80159e:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015a0:	48 85 c0             	test   %rax,%rax
+  8015a3:	7f 01                	jg     8015a6 <sys_env_set_trapframe+0x27>
+}
+  8015a5:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8015a6:	55                   	push   %rbp
+  8015a7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015aa:	49 89 c0             	mov    %rax,%r8
+  8015ad:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8015b2:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  8015b9:	00 00 00 
+  8015bc:	be 29 00 00 00       	mov    $0x29,%esi
+  8015c1:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  8015c8:	00 00 00 
+  8015cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015d0:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  8015d7:	00 00 00 
+  8015da:	41 ff d1             	call   *%r9
+
+00000000008015dd <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015dd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e0:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ea:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015f6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015fc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015fe:	48 85 c0             	test   %rax,%rax
+  801601:	7f 01                	jg     801604 <sys_env_set_pgfault_upcall+0x27>
+}
+  801603:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801604:	55                   	push   %rbp
+  801605:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801608:	49 89 c0             	mov    %rax,%r8
+  80160b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801610:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  801617:	00 00 00 
+  80161a:	be 29 00 00 00       	mov    $0x29,%esi
+  80161f:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  801626:	00 00 00 
+  801629:	b8 00 00 00 00       	mov    $0x0,%eax
+  80162e:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  801635:	00 00 00 
+  801638:	41 ff d1             	call   *%r9
+
+000000000080163b <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80163b:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80163e:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801641:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801646:	4d 63 c0             	movslq %r8d,%r8
+  801649:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164f:	0f 05                	syscall
+}
+  801651:	c3                   	ret
+
+0000000000801652 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801652:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801655:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801658:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80165d:	4d 63 c0             	movslq %r8d,%r8
+  801660:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801666:	0f 05                	syscall
+}
+  801668:	c3                   	ret
+
+0000000000801669 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801669:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80166e:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801671:	45 89 c0             	mov    %r8d,%r8d
+  801674:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80167a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80167c:	48 85 c0             	test   %rax,%rax
+  80167f:	7f 01                	jg     801682 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801681:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801682:	55                   	push   %rbp
+  801683:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801686:	49 89 c0             	mov    %rax,%r8
+  801689:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  80168e:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  801695:	00 00 00 
+  801698:	be 29 00 00 00       	mov    $0x29,%esi
+  80169d:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  8016a4:	00 00 00 
+  8016a7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ac:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  8016b3:	00 00 00 
+  8016b6:	41 ff d1             	call   *%r9
+
+00000000008016b9 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8016b9:	55                   	push   %rbp
+  8016ba:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8016bd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016c3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016c8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016cd:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  8016d4:	00 00 00 
+  8016d7:	ff d0                	call   *%rax
+}
+  8016d9:	5d                   	pop    %rbp
+  8016da:	c3                   	ret
+
+00000000008016db <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016db:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016e0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016e5:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016ef:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016f5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801701:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801703:	c3                   	ret
+
+0000000000801704 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801704:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801709:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80170e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801713:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801719:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80171f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801725:	0f 05                	syscall
+    if (check && ret > 0) {
+  801727:	48 85 c0             	test   %rax,%rax
+  80172a:	7f 01                	jg     80172d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80172c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80172d:	55                   	push   %rbp
+  80172e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801731:	49 89 c0             	mov    %rax,%r8
+  801734:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801739:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  801740:	00 00 00 
+  801743:	be 29 00 00 00       	mov    $0x29,%esi
+  801748:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  80174f:	00 00 00 
+  801752:	b8 00 00 00 00       	mov    $0x0,%eax
+  801757:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  80175e:	00 00 00 
+  801761:	41 ff d1             	call   *%r9
+
+0000000000801764 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801764:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801769:	bf 00 00 00 00       	mov    $0x0,%edi
+  80176e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801773:	ba 00 00 00 00       	mov    $0x0,%edx
+  801778:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80177e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801784:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80178a:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80178c:	c3                   	ret
+
+000000000080178d <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80178d:	89 d2                	mov    %edx,%edx
+  80178f:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801791:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801796:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80179c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017a8:	0f 05                	syscall
+}
+  8017aa:	c3                   	ret
+
+00000000008017ab <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8017ab:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017ae:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ca:	0f 05                	syscall
+}
+  8017cc:	c3                   	ret
+
+00000000008017cd <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8017cd:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017d0:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ec:	0f 05                	syscall
+}
+  8017ee:	c3                   	ret
+
+00000000008017ef <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8017ef:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017f2:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017f7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017fc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801801:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801807:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80180d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801813:	0f 05                	syscall
+    if (check && ret > 0) {
+  801815:	48 85 c0             	test   %rax,%rax
+  801818:	7f 01                	jg     80181b <sys_irq_ack+0x2c>
+}
+  80181a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80181b:	55                   	push   %rbp
+  80181c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80181f:	49 89 c0             	mov    %rax,%r8
+  801822:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801827:	48 ba 98 51 80 00 00 	movabs $0x805198,%rdx
+  80182e:	00 00 00 
+  801831:	be 29 00 00 00       	mov    $0x29,%esi
+  801836:	48 bf b7 51 80 00 00 	movabs $0x8051b7,%rdi
+  80183d:	00 00 00 
+  801840:	b8 00 00 00 00       	mov    $0x0,%eax
+  801845:	49 b9 4b 04 80 00 00 	movabs $0x80044b,%r9
+  80184c:	00 00 00 
+  80184f:	41 ff d1             	call   *%r9
+
+0000000000801852 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801852:	55                   	push   %rbp
+  801853:	48 89 e5             	mov    %rsp,%rbp
+  801856:	41 54                	push   %r12
+  801858:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801859:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  801860:	00 00 00 
+  801863:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801865:	b8 08 00 00 00       	mov    $0x8,%eax
+  80186a:	0f 05                	syscall
+  80186c:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  80186f:	85 c0                	test   %eax,%eax
+  801871:	78 7e                	js     8018f1 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801873:	0f 84 80 00 00 00    	je     8018f9 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801879:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80187f:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  801886:	00 00 00 
+  801889:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80188e:	89 c2                	mov    %eax,%edx
+  801890:	be 00 00 00 00       	mov    $0x0,%esi
+  801895:	bf 00 00 00 00       	mov    $0x0,%edi
+  80189a:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  8018a1:	00 00 00 
+  8018a4:	ff d0                	call   *%rax
+  8018a6:	85 c0                	test   %eax,%eax
+  8018a8:	0f 88 86 00 00 00    	js     801934 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8018ae:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8018b5:	00 00 00 
+  8018b8:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8018bf:	44 89 e7             	mov    %r12d,%edi
+  8018c2:	48 b8 dd 15 80 00 00 	movabs $0x8015dd,%rax
+  8018c9:	00 00 00 
+  8018cc:	ff d0                	call   *%rax
+  8018ce:	85 c0                	test   %eax,%eax
+  8018d0:	78 6a                	js     80193c <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8018d2:	be 02 00 00 00       	mov    $0x2,%esi
+  8018d7:	44 89 e7             	mov    %r12d,%edi
+  8018da:	48 b8 1e 15 80 00 00 	movabs $0x80151e,%rax
+  8018e1:	00 00 00 
+  8018e4:	ff d0                	call   *%rax
+		return -1;
+  8018e6:	85 c0                	test   %eax,%eax
+  8018e8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018ed:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8018f1:	44 89 e0             	mov    %r12d,%eax
+  8018f4:	5b                   	pop    %rbx
+  8018f5:	41 5c                	pop    %r12
+  8018f7:	5d                   	pop    %rbp
+  8018f8:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018f9:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  801900:	00 00 00 
+  801903:	ff d0                	call   *%rax
+  801905:	89 c2                	mov    %eax,%edx
+  801907:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80190d:	48 89 d0             	mov    %rdx,%rax
+  801910:	48 c1 e0 04          	shl    $0x4,%rax
+  801914:	48 29 d0             	sub    %rdx,%rax
+  801917:	48 c1 e0 05          	shl    $0x5,%rax
+  80191b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801922:	00 00 00 
+  801925:	48 01 d0             	add    %rdx,%rax
+  801928:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80192f:	00 00 00 
+        return 0;
+  801932:	eb bd                	jmp    8018f1 <fork+0x9f>
+		return -1;
+  801934:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80193a:	eb b5                	jmp    8018f1 <fork+0x9f>
+		return -1;
+  80193c:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801942:	eb ad                	jmp    8018f1 <fork+0x9f>
+
+0000000000801944 <sfork>:
+
+envid_t
+sfork() {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801948:	48 ba c5 51 80 00 00 	movabs $0x8051c5,%rdx
+  80194f:	00 00 00 
+  801952:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801957:	48 bf e0 51 80 00 00 	movabs $0x8051e0,%rdi
+  80195e:	00 00 00 
+  801961:	b8 00 00 00 00       	mov    $0x0,%eax
+  801966:	48 b9 4b 04 80 00 00 	movabs $0x80044b,%rcx
+  80196d:	00 00 00 
+  801970:	ff d1                	call   *%rcx
+
+0000000000801972 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801972:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801979:	ff ff ff 
+  80197c:	48 01 f8             	add    %rdi,%rax
+  80197f:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801983:	c3                   	ret
+
+0000000000801984 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801984:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80198b:	ff ff ff 
+  80198e:	48 01 f8             	add    %rdi,%rax
+  801991:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801995:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80199b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80199f:	c3                   	ret
+
+00000000008019a0 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8019a0:	55                   	push   %rbp
+  8019a1:	48 89 e5             	mov    %rsp,%rbp
+  8019a4:	41 57                	push   %r15
+  8019a6:	41 56                	push   %r14
+  8019a8:	41 55                	push   %r13
+  8019aa:	41 54                	push   %r12
+  8019ac:	53                   	push   %rbx
+  8019ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8019b1:	49 89 ff             	mov    %rdi,%r15
+  8019b4:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b9:	49 bd 2f 41 80 00 00 	movabs $0x80412f,%r13
+  8019c0:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019c3:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019c9:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019cc:	48 89 df             	mov    %rbx,%rdi
+  8019cf:	41 ff d5             	call   *%r13
+  8019d2:	83 e0 04             	and    $0x4,%eax
+  8019d5:	74 17                	je     8019ee <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019d7:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019de:	4c 39 f3             	cmp    %r14,%rbx
+  8019e1:	75 e6                	jne    8019c9 <fd_alloc+0x29>
+  8019e3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019e9:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019ee:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019f1:	48 83 c4 08          	add    $0x8,%rsp
+  8019f5:	5b                   	pop    %rbx
+  8019f6:	41 5c                	pop    %r12
+  8019f8:	41 5d                	pop    %r13
+  8019fa:	41 5e                	pop    %r14
+  8019fc:	41 5f                	pop    %r15
+  8019fe:	5d                   	pop    %rbp
+  8019ff:	c3                   	ret
+
+0000000000801a00 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801a00:	83 ff 1f             	cmp    $0x1f,%edi
+  801a03:	77 39                	ja     801a3e <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801a05:	55                   	push   %rbp
+  801a06:	48 89 e5             	mov    %rsp,%rbp
+  801a09:	41 54                	push   %r12
+  801a0b:	53                   	push   %rbx
+  801a0c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801a0f:	48 63 df             	movslq %edi,%rbx
+  801a12:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801a19:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a1d:	48 89 df             	mov    %rbx,%rdi
+  801a20:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801a27:	00 00 00 
+  801a2a:	ff d0                	call   *%rax
+  801a2c:	a8 04                	test   $0x4,%al
+  801a2e:	74 14                	je     801a44 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a30:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a34:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a39:	5b                   	pop    %rbx
+  801a3a:	41 5c                	pop    %r12
+  801a3c:	5d                   	pop    %rbp
+  801a3d:	c3                   	ret
+        return -E_INVAL;
+  801a3e:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a43:	c3                   	ret
+        return -E_INVAL;
+  801a44:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a49:	eb ee                	jmp    801a39 <fd_lookup+0x39>
+
+0000000000801a4b <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a4b:	55                   	push   %rbp
+  801a4c:	48 89 e5             	mov    %rsp,%rbp
+  801a4f:	41 54                	push   %r12
+  801a51:	53                   	push   %rbx
+  801a52:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a55:	48 b8 80 52 80 00 00 	movabs $0x805280,%rax
+  801a5c:	00 00 00 
+  801a5f:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801a66:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a69:	39 3b                	cmp    %edi,(%rbx)
+  801a6b:	74 47                	je     801ab4 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a6d:	48 83 c0 08          	add    $0x8,%rax
+  801a71:	48 8b 18             	mov    (%rax),%rbx
+  801a74:	48 85 db             	test   %rbx,%rbx
+  801a77:	75 f0                	jne    801a69 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a79:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a80:	00 00 00 
+  801a83:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a89:	89 fa                	mov    %edi,%edx
+  801a8b:	48 bf f0 51 80 00 00 	movabs $0x8051f0,%rdi
+  801a92:	00 00 00 
+  801a95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9a:	48 b9 9b 05 80 00 00 	movabs $0x80059b,%rcx
+  801aa1:	00 00 00 
+  801aa4:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801aa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801aab:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801aaf:	5b                   	pop    %rbx
+  801ab0:	41 5c                	pop    %r12
+  801ab2:	5d                   	pop    %rbp
+  801ab3:	c3                   	ret
+            return 0;
+  801ab4:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ab9:	eb f0                	jmp    801aab <dev_lookup+0x60>
+
+0000000000801abb <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801abb:	55                   	push   %rbp
+  801abc:	48 89 e5             	mov    %rsp,%rbp
+  801abf:	41 55                	push   %r13
+  801ac1:	41 54                	push   %r12
+  801ac3:	53                   	push   %rbx
+  801ac4:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac8:	48 89 fb             	mov    %rdi,%rbx
+  801acb:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ace:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ad5:	ff ff ff 
+  801ad8:	48 01 df             	add    %rbx,%rdi
+  801adb:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801adf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ae3:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+  801aef:	41 89 c5             	mov    %eax,%r13d
+  801af2:	85 c0                	test   %eax,%eax
+  801af4:	78 06                	js     801afc <fd_close+0x41>
+  801af6:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801afa:	74 1a                	je     801b16 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801afc:	45 84 e4             	test   %r12b,%r12b
+  801aff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b04:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801b08:	44 89 e8             	mov    %r13d,%eax
+  801b0b:	48 83 c4 18          	add    $0x18,%rsp
+  801b0f:	5b                   	pop    %rbx
+  801b10:	41 5c                	pop    %r12
+  801b12:	41 5d                	pop    %r13
+  801b14:	5d                   	pop    %rbp
+  801b15:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801b16:	8b 3b                	mov    (%rbx),%edi
+  801b18:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b1c:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801b23:	00 00 00 
+  801b26:	ff d0                	call   *%rax
+  801b28:	41 89 c5             	mov    %eax,%r13d
+  801b2b:	85 c0                	test   %eax,%eax
+  801b2d:	78 1b                	js     801b4a <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b2f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b33:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b37:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b3d:	48 85 c0             	test   %rax,%rax
+  801b40:	74 08                	je     801b4a <fd_close+0x8f>
+  801b42:	48 89 df             	mov    %rbx,%rdi
+  801b45:	ff d0                	call   *%rax
+  801b47:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b4a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b4f:	48 89 de             	mov    %rbx,%rsi
+  801b52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b57:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  801b5e:	00 00 00 
+  801b61:	ff d0                	call   *%rax
+    return res;
+  801b63:	eb a3                	jmp    801b08 <fd_close+0x4d>
+
+0000000000801b65 <close>:
+
+int
+close(int fdnum) {
+  801b65:	55                   	push   %rbp
+  801b66:	48 89 e5             	mov    %rsp,%rbp
+  801b69:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b6d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b71:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801b78:	00 00 00 
+  801b7b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b7d:	85 c0                	test   %eax,%eax
+  801b7f:	78 15                	js     801b96 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b81:	be 01 00 00 00       	mov    $0x1,%esi
+  801b86:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b8a:	48 b8 bb 1a 80 00 00 	movabs $0x801abb,%rax
+  801b91:	00 00 00 
+  801b94:	ff d0                	call   *%rax
+}
+  801b96:	c9                   	leave
+  801b97:	c3                   	ret
+
+0000000000801b98 <close_all>:
+
+void
+close_all(void) {
+  801b98:	55                   	push   %rbp
+  801b99:	48 89 e5             	mov    %rsp,%rbp
+  801b9c:	41 54                	push   %r12
+  801b9e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b9f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ba4:	49 bc 65 1b 80 00 00 	movabs $0x801b65,%r12
+  801bab:	00 00 00 
+  801bae:	89 df                	mov    %ebx,%edi
+  801bb0:	41 ff d4             	call   *%r12
+  801bb3:	83 c3 01             	add    $0x1,%ebx
+  801bb6:	83 fb 20             	cmp    $0x20,%ebx
+  801bb9:	75 f3                	jne    801bae <close_all+0x16>
+}
+  801bbb:	5b                   	pop    %rbx
+  801bbc:	41 5c                	pop    %r12
+  801bbe:	5d                   	pop    %rbp
+  801bbf:	c3                   	ret
+
+0000000000801bc0 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801bc0:	55                   	push   %rbp
+  801bc1:	48 89 e5             	mov    %rsp,%rbp
+  801bc4:	41 57                	push   %r15
+  801bc6:	41 56                	push   %r14
+  801bc8:	41 55                	push   %r13
+  801bca:	41 54                	push   %r12
+  801bcc:	53                   	push   %rbx
+  801bcd:	48 83 ec 18          	sub    $0x18,%rsp
+  801bd1:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bd4:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bd8:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801bdf:	00 00 00 
+  801be2:	ff d0                	call   *%rax
+  801be4:	89 c3                	mov    %eax,%ebx
+  801be6:	85 c0                	test   %eax,%eax
+  801be8:	0f 88 b8 00 00 00    	js     801ca6 <dup+0xe6>
+    close(newfdnum);
+  801bee:	44 89 e7             	mov    %r12d,%edi
+  801bf1:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bfd:	4d 63 ec             	movslq %r12d,%r13
+  801c00:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801c07:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801c0b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801c0f:	4c 89 ff             	mov    %r15,%rdi
+  801c12:	49 be 84 19 80 00 00 	movabs $0x801984,%r14
+  801c19:	00 00 00 
+  801c1c:	41 ff d6             	call   *%r14
+  801c1f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c22:	4c 89 ef             	mov    %r13,%rdi
+  801c25:	41 ff d6             	call   *%r14
+  801c28:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c2b:	48 89 df             	mov    %rbx,%rdi
+  801c2e:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801c35:	00 00 00 
+  801c38:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c3a:	a8 04                	test   $0x4,%al
+  801c3c:	74 2b                	je     801c69 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c3e:	41 89 c1             	mov    %eax,%r9d
+  801c41:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c47:	4c 89 f1             	mov    %r14,%rcx
+  801c4a:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c4f:	48 89 de             	mov    %rbx,%rsi
+  801c52:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c57:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801c5e:	00 00 00 
+  801c61:	ff d0                	call   *%rax
+  801c63:	89 c3                	mov    %eax,%ebx
+  801c65:	85 c0                	test   %eax,%eax
+  801c67:	78 4e                	js     801cb7 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c69:	4c 89 ff             	mov    %r15,%rdi
+  801c6c:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  801c73:	00 00 00 
+  801c76:	ff d0                	call   *%rax
+  801c78:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c7b:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c81:	4c 89 e9             	mov    %r13,%rcx
+  801c84:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c89:	4c 89 fe             	mov    %r15,%rsi
+  801c8c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c91:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+  801c9d:	89 c3                	mov    %eax,%ebx
+  801c9f:	85 c0                	test   %eax,%eax
+  801ca1:	78 14                	js     801cb7 <dup+0xf7>
+
+    return newfdnum;
+  801ca3:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ca6:	89 d8                	mov    %ebx,%eax
+  801ca8:	48 83 c4 18          	add    $0x18,%rsp
+  801cac:	5b                   	pop    %rbx
+  801cad:	41 5c                	pop    %r12
+  801caf:	41 5d                	pop    %r13
+  801cb1:	41 5e                	pop    %r14
+  801cb3:	41 5f                	pop    %r15
+  801cb5:	5d                   	pop    %rbp
+  801cb6:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801cb7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cbc:	4c 89 ee             	mov    %r13,%rsi
+  801cbf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc4:	49 bc c5 14 80 00 00 	movabs $0x8014c5,%r12
+  801ccb:	00 00 00 
+  801cce:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cd1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cd6:	4c 89 f6             	mov    %r14,%rsi
+  801cd9:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cde:	41 ff d4             	call   *%r12
+    return res;
+  801ce1:	eb c3                	jmp    801ca6 <dup+0xe6>
+
+0000000000801ce3 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801ce3:	55                   	push   %rbp
+  801ce4:	48 89 e5             	mov    %rsp,%rbp
+  801ce7:	41 56                	push   %r14
+  801ce9:	41 55                	push   %r13
+  801ceb:	41 54                	push   %r12
+  801ced:	53                   	push   %rbx
+  801cee:	48 83 ec 10          	sub    $0x10,%rsp
+  801cf2:	89 fb                	mov    %edi,%ebx
+  801cf4:	49 89 f4             	mov    %rsi,%r12
+  801cf7:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cfa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cfe:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	78 4c                	js     801d5a <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d0e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d12:	41 8b 3e             	mov    (%r14),%edi
+  801d15:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d19:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801d20:	00 00 00 
+  801d23:	ff d0                	call   *%rax
+  801d25:	85 c0                	test   %eax,%eax
+  801d27:	78 35                	js     801d5e <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d29:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d2d:	83 e0 03             	and    $0x3,%eax
+  801d30:	83 f8 01             	cmp    $0x1,%eax
+  801d33:	74 2d                	je     801d62 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d35:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d39:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d3d:	48 85 c0             	test   %rax,%rax
+  801d40:	74 56                	je     801d98 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d42:	4c 89 ea             	mov    %r13,%rdx
+  801d45:	4c 89 e6             	mov    %r12,%rsi
+  801d48:	4c 89 f7             	mov    %r14,%rdi
+  801d4b:	ff d0                	call   *%rax
+}
+  801d4d:	48 83 c4 10          	add    $0x10,%rsp
+  801d51:	5b                   	pop    %rbx
+  801d52:	41 5c                	pop    %r12
+  801d54:	41 5d                	pop    %r13
+  801d56:	41 5e                	pop    %r14
+  801d58:	5d                   	pop    %rbp
+  801d59:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d5a:	48 98                	cltq
+  801d5c:	eb ef                	jmp    801d4d <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d5e:	48 98                	cltq
+  801d60:	eb eb                	jmp    801d4d <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d62:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d69:	00 00 00 
+  801d6c:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d72:	89 da                	mov    %ebx,%edx
+  801d74:	48 bf 31 52 80 00 00 	movabs $0x805231,%rdi
+  801d7b:	00 00 00 
+  801d7e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d83:	48 b9 9b 05 80 00 00 	movabs $0x80059b,%rcx
+  801d8a:	00 00 00 
+  801d8d:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d8f:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d96:	eb b5                	jmp    801d4d <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d98:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d9f:	eb ac                	jmp    801d4d <read+0x6a>
+
+0000000000801da1 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801da1:	55                   	push   %rbp
+  801da2:	48 89 e5             	mov    %rsp,%rbp
+  801da5:	41 57                	push   %r15
+  801da7:	41 56                	push   %r14
+  801da9:	41 55                	push   %r13
+  801dab:	41 54                	push   %r12
+  801dad:	53                   	push   %rbx
+  801dae:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801db2:	48 85 d2             	test   %rdx,%rdx
+  801db5:	74 54                	je     801e0b <readn+0x6a>
+  801db7:	41 89 fd             	mov    %edi,%r13d
+  801dba:	49 89 f6             	mov    %rsi,%r14
+  801dbd:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801dc0:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801dc5:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dca:	49 bf e3 1c 80 00 00 	movabs $0x801ce3,%r15
+  801dd1:	00 00 00 
+  801dd4:	4c 89 e2             	mov    %r12,%rdx
+  801dd7:	48 29 f2             	sub    %rsi,%rdx
+  801dda:	4c 01 f6             	add    %r14,%rsi
+  801ddd:	44 89 ef             	mov    %r13d,%edi
+  801de0:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801de3:	85 c0                	test   %eax,%eax
+  801de5:	78 20                	js     801e07 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801de7:	01 c3                	add    %eax,%ebx
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	74 08                	je     801df5 <readn+0x54>
+  801ded:	48 63 f3             	movslq %ebx,%rsi
+  801df0:	4c 39 e6             	cmp    %r12,%rsi
+  801df3:	72 df                	jb     801dd4 <readn+0x33>
+    }
+    return res;
+  801df5:	48 63 c3             	movslq %ebx,%rax
+}
+  801df8:	48 83 c4 08          	add    $0x8,%rsp
+  801dfc:	5b                   	pop    %rbx
+  801dfd:	41 5c                	pop    %r12
+  801dff:	41 5d                	pop    %r13
+  801e01:	41 5e                	pop    %r14
+  801e03:	41 5f                	pop    %r15
+  801e05:	5d                   	pop    %rbp
+  801e06:	c3                   	ret
+        if (inc < 0) return inc;
+  801e07:	48 98                	cltq
+  801e09:	eb ed                	jmp    801df8 <readn+0x57>
+    int inc = 1, res = 0;
+  801e0b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801e10:	eb e3                	jmp    801df5 <readn+0x54>
+
+0000000000801e12 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801e12:	55                   	push   %rbp
+  801e13:	48 89 e5             	mov    %rsp,%rbp
+  801e16:	41 56                	push   %r14
+  801e18:	41 55                	push   %r13
+  801e1a:	41 54                	push   %r12
+  801e1c:	53                   	push   %rbx
+  801e1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801e21:	89 fb                	mov    %edi,%ebx
+  801e23:	49 89 f4             	mov    %rsi,%r12
+  801e26:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2d:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801e34:	00 00 00 
+  801e37:	ff d0                	call   *%rax
+  801e39:	85 c0                	test   %eax,%eax
+  801e3b:	78 47                	js     801e84 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e41:	41 8b 3e             	mov    (%r14),%edi
+  801e44:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e48:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801e4f:	00 00 00 
+  801e52:	ff d0                	call   *%rax
+  801e54:	85 c0                	test   %eax,%eax
+  801e56:	78 30                	js     801e88 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e58:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e5d:	74 2d                	je     801e8c <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e63:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e67:	48 85 c0             	test   %rax,%rax
+  801e6a:	74 56                	je     801ec2 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e6c:	4c 89 ea             	mov    %r13,%rdx
+  801e6f:	4c 89 e6             	mov    %r12,%rsi
+  801e72:	4c 89 f7             	mov    %r14,%rdi
+  801e75:	ff d0                	call   *%rax
+}
+  801e77:	48 83 c4 10          	add    $0x10,%rsp
+  801e7b:	5b                   	pop    %rbx
+  801e7c:	41 5c                	pop    %r12
+  801e7e:	41 5d                	pop    %r13
+  801e80:	41 5e                	pop    %r14
+  801e82:	5d                   	pop    %rbp
+  801e83:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e84:	48 98                	cltq
+  801e86:	eb ef                	jmp    801e77 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e88:	48 98                	cltq
+  801e8a:	eb eb                	jmp    801e77 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e8c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e93:	00 00 00 
+  801e96:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e9c:	89 da                	mov    %ebx,%edx
+  801e9e:	48 bf 4d 52 80 00 00 	movabs $0x80524d,%rdi
+  801ea5:	00 00 00 
+  801ea8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ead:	48 b9 9b 05 80 00 00 	movabs $0x80059b,%rcx
+  801eb4:	00 00 00 
+  801eb7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eb9:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ec0:	eb b5                	jmp    801e77 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ec2:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ec9:	eb ac                	jmp    801e77 <write+0x65>
+
+0000000000801ecb <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ecb:	55                   	push   %rbp
+  801ecc:	48 89 e5             	mov    %rsp,%rbp
+  801ecf:	41 54                	push   %r12
+  801ed1:	53                   	push   %rbx
+  801ed2:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed6:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed8:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801edc:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	78 3e                	js     801f2a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eec:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ef0:	41 8b 3c 24          	mov    (%r12),%edi
+  801ef4:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ef8:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801eff:	00 00 00 
+  801f02:	ff d0                	call   *%rax
+  801f04:	85 c0                	test   %eax,%eax
+  801f06:	78 22                	js     801f2a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801f08:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f0c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801f10:	48 85 c0             	test   %rax,%rax
+  801f13:	74 0b                	je     801f20 <seek+0x55>
+  801f15:	89 de                	mov    %ebx,%esi
+  801f17:	4c 89 e7             	mov    %r12,%rdi
+  801f1a:	ff d0                	call   *%rax
+  801f1c:	85 c0                	test   %eax,%eax
+  801f1e:	78 0a                	js     801f2a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801f20:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801f25:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f2a:	48 83 c4 10          	add    $0x10,%rsp
+  801f2e:	5b                   	pop    %rbx
+  801f2f:	41 5c                	pop    %r12
+  801f31:	5d                   	pop    %rbp
+  801f32:	c3                   	ret
+
+0000000000801f33 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f33:	55                   	push   %rbp
+  801f34:	48 89 e5             	mov    %rsp,%rbp
+  801f37:	41 55                	push   %r13
+  801f39:	41 54                	push   %r12
+  801f3b:	53                   	push   %rbx
+  801f3c:	48 83 ec 18          	sub    $0x18,%rsp
+  801f40:	89 fb                	mov    %edi,%ebx
+  801f42:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f45:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f49:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801f50:	00 00 00 
+  801f53:	ff d0                	call   *%rax
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 38                	js     801f91 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f59:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f5d:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f61:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f65:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  801f6c:	00 00 00 
+  801f6f:	ff d0                	call   *%rax
+  801f71:	85 c0                	test   %eax,%eax
+  801f73:	78 1c                	js     801f91 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f75:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f7a:	74 20                	je     801f9c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f7c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f80:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f84:	48 85 c0             	test   %rax,%rax
+  801f87:	74 47                	je     801fd0 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f89:	44 89 e6             	mov    %r12d,%esi
+  801f8c:	4c 89 ef             	mov    %r13,%rdi
+  801f8f:	ff d0                	call   *%rax
+}
+  801f91:	48 83 c4 18          	add    $0x18,%rsp
+  801f95:	5b                   	pop    %rbx
+  801f96:	41 5c                	pop    %r12
+  801f98:	41 5d                	pop    %r13
+  801f9a:	5d                   	pop    %rbp
+  801f9b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f9c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801fa3:	00 00 00 
+  801fa6:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801fac:	89 da                	mov    %ebx,%edx
+  801fae:	48 bf 10 52 80 00 00 	movabs $0x805210,%rdi
+  801fb5:	00 00 00 
+  801fb8:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbd:	48 b9 9b 05 80 00 00 	movabs $0x80059b,%rcx
+  801fc4:	00 00 00 
+  801fc7:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc9:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fce:	eb c1                	jmp    801f91 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fd0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fd5:	eb ba                	jmp    801f91 <ftruncate+0x5e>
+
+0000000000801fd7 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  801fdb:	41 54                	push   %r12
+  801fdd:	53                   	push   %rbx
+  801fde:	48 83 ec 10          	sub    $0x10,%rsp
+  801fe2:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fe5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fe9:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 4e                	js     802047 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ff9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ffd:	41 8b 3c 24          	mov    (%r12),%edi
+  802001:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802005:	48 b8 4b 1a 80 00 00 	movabs $0x801a4b,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	85 c0                	test   %eax,%eax
+  802013:	78 32                	js     802047 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802015:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802019:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  80201e:	74 30                	je     802050 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802020:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802023:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80202a:	00 00 00 
+    stat->st_isdir = 0;
+  80202d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802034:	00 00 00 
+    stat->st_dev = dev;
+  802037:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80203e:	48 89 de             	mov    %rbx,%rsi
+  802041:	4c 89 e7             	mov    %r12,%rdi
+  802044:	ff 50 28             	call   *0x28(%rax)
+}
+  802047:	48 83 c4 10          	add    $0x10,%rsp
+  80204b:	5b                   	pop    %rbx
+  80204c:	41 5c                	pop    %r12
+  80204e:	5d                   	pop    %rbp
+  80204f:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802050:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802055:	eb f0                	jmp    802047 <fstat+0x70>
+
+0000000000802057 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802057:	55                   	push   %rbp
+  802058:	48 89 e5             	mov    %rsp,%rbp
+  80205b:	41 54                	push   %r12
+  80205d:	53                   	push   %rbx
+  80205e:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802061:	be 00 00 00 00       	mov    $0x0,%esi
+  802066:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+  802072:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802074:	85 c0                	test   %eax,%eax
+  802076:	78 25                	js     80209d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802078:	4c 89 e6             	mov    %r12,%rsi
+  80207b:	89 c7                	mov    %eax,%edi
+  80207d:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  802084:	00 00 00 
+  802087:	ff d0                	call   *%rax
+  802089:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  80208c:	89 df                	mov    %ebx,%edi
+  80208e:	48 b8 65 1b 80 00 00 	movabs $0x801b65,%rax
+  802095:	00 00 00 
+  802098:	ff d0                	call   *%rax
+
+    return res;
+  80209a:	44 89 e3             	mov    %r12d,%ebx
+}
+  80209d:	89 d8                	mov    %ebx,%eax
+  80209f:	5b                   	pop    %rbx
+  8020a0:	41 5c                	pop    %r12
+  8020a2:	5d                   	pop    %rbp
+  8020a3:	c3                   	ret
+
+00000000008020a4 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8020a4:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  8020ab:	00 00 00 
+  8020ae:	83 38 00             	cmpl   $0x0,(%rax)
+  8020b1:	74 0a                	je     8020bd <fsenv+0x19>
+    return envid;
+}
+  8020b3:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020ba:	00 00 
+  8020bc:	c3                   	ret
+fsenv(void) {
+  8020bd:	55                   	push   %rbp
+  8020be:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8020c1:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020c6:	48 b8 92 4a 80 00 00 	movabs $0x804a92,%rax
+  8020cd:	00 00 00 
+  8020d0:	ff d0                	call   *%rax
+  8020d2:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8020d9:	00 00 
+}
+  8020db:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020e2:	00 00 
+  8020e4:	5d                   	pop    %rbp
+  8020e5:	c3                   	ret
+
+00000000008020e6 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8020e6:	55                   	push   %rbp
+  8020e7:	48 89 e5             	mov    %rsp,%rbp
+  8020ea:	41 54                	push   %r12
+  8020ec:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020ed:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020f2:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020f7:	48 89 de             	mov    %rbx,%rsi
+  8020fa:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ff:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  802106:	00 00 00 
+  802109:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80210b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802112:	00 00 00 
+  802115:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80211b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802120:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802125:	48 89 de             	mov    %rbx,%rsi
+  802128:	bf 00 00 00 00       	mov    $0x0,%edi
+  80212d:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  802134:	00 00 00 
+  802137:	ff d0                	call   *%rax
+  802139:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80213b:	85 c0                	test   %eax,%eax
+  80213d:	0f 88 a2 00 00 00    	js     8021e5 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802143:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80214a:	00 00 00 
+  80214d:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802153:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802158:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80215a:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80215f:	49 bc f7 42 80 00 00 	movabs $0x8042f7,%r12
+  802166:	00 00 00 
+  802169:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80216c:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802171:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802174:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80217b:	00 00 00 
+  80217e:	ff d0                	call   *%rax
+  802180:	89 c7                	mov    %eax,%edi
+  802182:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802188:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80218d:	48 89 da             	mov    %rbx,%rdx
+  802190:	be 09 00 00 00       	mov    $0x9,%esi
+  802195:	48 b8 3c 4a 80 00 00 	movabs $0x804a3c,%rax
+  80219c:	00 00 00 
+  80219f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8021a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ab:	be 00 00 00 00       	mov    $0x0,%esi
+  8021b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021b5:	48 b8 18 4a 80 00 00 	movabs $0x804a18,%rax
+  8021bc:	00 00 00 
+  8021bf:	ff d0                	call   *%rax
+  8021c1:	89 c3                	mov    %eax,%ebx
+  8021c3:	85 c0                	test   %eax,%eax
+  8021c5:	78 25                	js     8021ec <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8021c7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021ce:	00 00 00 
+  8021d1:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021d7:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8021de:	00 00 
+    return 0;
+  8021e0:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8021e5:	89 d8                	mov    %ebx,%eax
+  8021e7:	5b                   	pop    %rbx
+  8021e8:	41 5c                	pop    %r12
+  8021ea:	5d                   	pop    %rbp
+  8021eb:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021ec:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021f1:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8021f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021fb:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  802202:	00 00 00 
+  802205:	ff d0                	call   *%rax
+        return res;
+  802207:	eb dc                	jmp    8021e5 <fschan_setup+0xff>
+
+0000000000802209 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802209:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802210:	00 00 00 
+  802213:	80 38 00             	cmpb   $0x0,(%rax)
+  802216:	74 55                	je     80226d <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802218:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80221f:	00 00 00 
+  802222:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802228:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80222d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802234:	00 00 00 
+  802237:	3b 0a                	cmp    (%rdx),%ecx
+  802239:	75 01                	jne    80223c <fschan+0x33>
+}
+  80223b:	c3                   	ret
+fschan(void) {
+  80223c:	55                   	push   %rbp
+  80223d:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802240:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  802247:	00 00 00 
+  80224a:	ff d0                	call   *%rax
+  80224c:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80224e:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802253:	85 d2                	test   %edx,%edx
+  802255:	78 02                	js     802259 <fschan+0x50>
+}
+  802257:	5d                   	pop    %rbp
+  802258:	c3                   	ret
+        fschan_enabled = 0;
+  802259:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802260:	00 00 00 
+  802263:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802266:	b8 00 00 00 00       	mov    $0x0,%eax
+  80226b:	eb ea                	jmp    802257 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80226d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802272:	c3                   	ret
+
+0000000000802273 <fbuf>:
+fbuf(struct Fd *fd) {
+  802273:	55                   	push   %rbp
+  802274:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802277:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  80227e:	00 00 00 
+  802281:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802283:	ba 00 00 00 00       	mov    $0x0,%edx
+  802288:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80228c:	77 12                	ja     8022a0 <fbuf+0x2d>
+  80228e:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802292:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802299:	00 00 00 
+  80229c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8022a0:	48 89 d0             	mov    %rdx,%rax
+  8022a3:	5d                   	pop    %rbp
+  8022a4:	c3                   	ret
+
+00000000008022a5 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8022a5:	55                   	push   %rbp
+  8022a6:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8022a9:	48 83 c7 40          	add    $0x40,%rdi
+  8022ad:	48 b8 31 43 80 00 00 	movabs $0x804331,%rax
+  8022b4:	00 00 00 
+  8022b7:	ff d0                	call   *%rax
+  8022b9:	84 c0                	test   %al,%al
+  8022bb:	75 02                	jne    8022bf <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8022bd:	5d                   	pop    %rbp
+  8022be:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8022bf:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+  8022cb:	89 c7                	mov    %eax,%edi
+  8022cd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022dd:	be 0a 00 00 00       	mov    $0xa,%esi
+  8022e2:	48 b8 3c 4a 80 00 00 	movabs $0x804a3c,%rax
+  8022e9:	00 00 00 
+  8022ec:	ff d0                	call   *%rax
+}
+  8022ee:	eb cd                	jmp    8022bd <fschan_publish+0x18>
+
+00000000008022f0 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8022f0:	55                   	push   %rbp
+  8022f1:	48 89 e5             	mov    %rsp,%rbp
+  8022f4:	41 57                	push   %r15
+  8022f6:	41 56                	push   %r14
+  8022f8:	41 55                	push   %r13
+  8022fa:	41 54                	push   %r12
+  8022fc:	53                   	push   %rbx
+  8022fd:	48 83 ec 48          	sub    $0x48,%rsp
+  802301:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802305:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802309:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80230c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802310:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802313:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80231a:	00 00 00 
+  80231d:	8b 02                	mov    (%rdx),%eax
+  80231f:	83 c0 01             	add    $0x1,%eax
+  802322:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802327:	0f 44 c1             	cmove  %ecx,%eax
+  80232a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80232c:	4d 85 c0             	test   %r8,%r8
+  80232f:	74 2c                	je     80235d <fschan_rw+0x6d>
+  802331:	45 89 ce             	mov    %r9d,%r14d
+  802334:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80233b:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80233f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802345:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80234c:	00 
+  80234d:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802353:	b8 01 00 00 00       	mov    $0x1,%eax
+  802358:	e9 41 01 00 00       	jmp    80249e <fschan_rw+0x1ae>
+  80235d:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802361:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802365:	e9 9c 01 00 00       	jmp    802506 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80236a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80236e:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802371:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802374:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802377:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80237b:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80237f:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802383:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802387:	48 89 da             	mov    %rbx,%rdx
+  80238a:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  802391:	00 00 00 
+  802394:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802396:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80239a:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  8023a1:	00 00 00 
+  8023a4:	ff d0                	call   *%rax
+            queued += blk;
+  8023a6:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8023a9:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8023ad:	4d 39 fc             	cmp    %r15,%r12
+  8023b0:	73 6b                	jae    80241d <fschan_rw+0x12d>
+  8023b2:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8023b6:	77 65                	ja     80241d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8023b8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023bc:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8023c0:	48 b8 0c 43 80 00 00 	movabs $0x80430c,%rax
+  8023c7:	00 00 00 
+  8023ca:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8023cc:	4c 89 fb             	mov    %r15,%rbx
+  8023cf:	4c 29 e3             	sub    %r12,%rbx
+  8023d2:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8023d7:	48 39 d3             	cmp    %rdx,%rbx
+  8023da:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8023de:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8023e2:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8023e6:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8023ea:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8023ed:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8023ef:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8023f6:	00 00 00 
+  8023f9:	8b 09                	mov    (%rcx),%ecx
+  8023fb:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8023fe:	83 fe 03             	cmp    $0x3,%esi
+  802401:	0f 85 63 ff ff ff    	jne    80236a <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802407:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80240b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80240e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802411:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802414:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802418:	e9 79 ff ff ff       	jmp    802396 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80241d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802421:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802428:	48 89 df             	mov    %rbx,%rdi
+  80242b:	48 b8 cf 43 80 00 00 	movabs $0x8043cf,%rax
+  802432:	00 00 00 
+  802435:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802437:	48 89 df             	mov    %rbx,%rdi
+  80243a:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  802441:	00 00 00 
+  802444:	ff d0                	call   *%rax
+  802446:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80244a:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80244e:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802452:	75 25                	jne    802479 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802454:	8b 40 04             	mov    0x4(%rax),%eax
+  802457:	85 c0                	test   %eax,%eax
+  802459:	0f 88 86 00 00 00    	js     8024e5 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80245f:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802463:	74 5b                	je     8024c0 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802465:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802469:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80246d:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802471:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802475:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802479:	48 89 df             	mov    %rbx,%rdi
+  80247c:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  802483:	00 00 00 
+  802486:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802488:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80248c:	83 f0 01             	xor    $0x1,%eax
+  80248f:	4d 39 fc             	cmp    %r15,%r12
+  802492:	0f 92 c2             	setb   %dl
+  802495:	84 c2                	test   %al,%dl
+  802497:	75 05                	jne    80249e <fschan_rw+0x1ae>
+  802499:	45 85 ed             	test   %r13d,%r13d
+  80249c:	74 50                	je     8024ee <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80249e:	4d 39 fc             	cmp    %r15,%r12
+  8024a1:	0f 92 c1             	setb   %cl
+  8024a4:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8024a8:	0f 96 c2             	setbe  %dl
+  8024ab:	84 d1                	test   %dl,%cl
+  8024ad:	0f 84 6a ff ff ff    	je     80241d <fschan_rw+0x12d>
+  8024b3:	84 c0                	test   %al,%al
+  8024b5:	0f 85 fd fe ff ff    	jne    8023b8 <fschan_rw+0xc8>
+  8024bb:	e9 5d ff ff ff       	jmp    80241d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024c0:	48 63 d0             	movslq %eax,%rdx
+  8024c3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024c7:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8024cb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8024cf:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8024d3:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8024d7:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  8024de:	00 00 00 
+  8024e1:	ff d0                	call   *%rax
+  8024e3:	eb 80                	jmp    802465 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8024e5:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8024e8:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8024ec:	eb 8b                	jmp    802479 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8024ee:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8024f3:	0f 85 68 fe ff ff    	jne    802361 <fschan_rw+0x71>
+  8024f9:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8024fc:	85 c0                	test   %eax,%eax
+  8024fe:	0f 84 5d fe ff ff    	je     802361 <fschan_rw+0x71>
+  802504:	48 98                	cltq
+}
+  802506:	48 83 c4 48          	add    $0x48,%rsp
+  80250a:	5b                   	pop    %rbx
+  80250b:	41 5c                	pop    %r12
+  80250d:	41 5d                	pop    %r13
+  80250f:	41 5e                	pop    %r14
+  802511:	41 5f                	pop    %r15
+  802513:	5d                   	pop    %rbp
+  802514:	c3                   	ret
+
+0000000000802515 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802515:	55                   	push   %rbp
+  802516:	48 89 e5             	mov    %rsp,%rbp
+  802519:	41 56                	push   %r14
+  80251b:	41 55                	push   %r13
+  80251d:	41 54                	push   %r12
+  80251f:	53                   	push   %rbx
+  802520:	48 83 ec 10          	sub    $0x10,%rsp
+  802524:	49 89 fe             	mov    %rdi,%r14
+  802527:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80252a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80252e:	48 29 f3             	sub    %rsi,%rbx
+  802531:	48 39 d3             	cmp    %rdx,%rbx
+  802534:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802538:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80253f:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802540:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802545:	49 bd 8e 41 80 00 00 	movabs $0x80418e,%r13
+  80254c:	00 00 00 
+  80254f:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802556:	76 1e                	jbe    802576 <mmap_fault+0x61>
+  802558:	4c 01 e7             	add    %r12,%rdi
+  80255b:	41 ff d5             	call   *%r13
+  80255e:	84 c0                	test   %al,%al
+  802560:	75 14                	jne    802576 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802562:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802566:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80256d:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802571:	48 39 df             	cmp    %rbx,%rdi
+  802574:	72 e2                	jb     802558 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802576:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80257d:	00 00 00 
+  802580:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802587:	00 00 00 
+  80258a:	4c 89 f0             	mov    %r14,%rax
+  80258d:	48 29 d0             	sub    %rdx,%rax
+  802590:	48 c1 f8 03          	sar    $0x3,%rax
+  802594:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80259b:	aa aa aa 
+  80259e:	48 0f af c2          	imul   %rdx,%rax
+  8025a2:	48 c1 e0 0c          	shl    $0xc,%rax
+  8025a6:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8025ab:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8025af:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8025b1:	44 89 e0             	mov    %r12d,%eax
+  8025b4:	41 03 46 10          	add    0x10(%r14),%eax
+  8025b8:	41 2b 06             	sub    (%r14),%eax
+  8025bb:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8025be:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025c2:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8025c6:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8025ca:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8025cd:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  8025d4:	00 00 00 
+  8025d7:	ff d0                	call   *%rax
+  8025d9:	89 c7                	mov    %eax,%edi
+  8025db:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025e1:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025e6:	48 89 da             	mov    %rbx,%rdx
+  8025e9:	be 0f 00 00 00       	mov    $0xf,%esi
+  8025ee:	48 b8 3c 4a 80 00 00 	movabs $0x804a3c,%rax
+  8025f5:	00 00 00 
+  8025f8:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8025fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025ff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802603:	4c 89 e6             	mov    %r12,%rsi
+  802606:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260b:	48 b8 18 4a 80 00 00 	movabs $0x804a18,%rax
+  802612:	00 00 00 
+  802615:	ff d0                	call   *%rax
+  802617:	48 98                	cltq
+}
+  802619:	48 83 c4 10          	add    $0x10,%rsp
+  80261d:	5b                   	pop    %rbx
+  80261e:	41 5c                	pop    %r12
+  802620:	41 5d                	pop    %r13
+  802622:	41 5e                	pop    %r14
+  802624:	5d                   	pop    %rbp
+  802625:	c3                   	ret
+
+0000000000802626 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802626:	48 8b 37             	mov    (%rdi),%rsi
+  802629:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802630:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802637:	00 00 00 
+  80263a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80263f:	eb 0f                	jmp    802650 <mmap_pgfault+0x2a>
+  802641:	c3                   	ret
+  802642:	48 83 c1 01          	add    $0x1,%rcx
+  802646:	48 83 c2 18          	add    $0x18,%rdx
+  80264a:	48 83 f9 20          	cmp    $0x20,%rcx
+  80264e:	74 6e                	je     8026be <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802650:	48 8b 02             	mov    (%rdx),%rax
+  802653:	48 83 e8 01          	sub    $0x1,%rax
+  802657:	48 39 f0             	cmp    %rsi,%rax
+  80265a:	73 e6                	jae    802642 <mmap_pgfault+0x1c>
+  80265c:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802660:	73 e0                	jae    802642 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802662:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802666:	b8 00 00 00 00       	mov    $0x0,%eax
+  80266b:	f6 c2 01             	test   $0x1,%dl
+  80266e:	75 d1                	jne    802641 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802670:	f6 c2 02             	test   $0x2,%dl
+  802673:	74 1a                	je     80268f <mmap_pgfault+0x69>
+  802675:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802679:	b8 00 00 00 00       	mov    $0x0,%eax
+  80267e:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802685:	00 00 00 
+  802688:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80268d:	74 35                	je     8026c4 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80268f:	55                   	push   %rbp
+  802690:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802693:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802697:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80269e:	00 00 00 
+  8026a1:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8026a5:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8026aa:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8026b1:	00 00 00 
+  8026b4:	ff d0                	call   *%rax
+  8026b6:	48 85 c0             	test   %rax,%rax
+  8026b9:	0f 9f c0             	setg   %al
+}
+  8026bc:	5d                   	pop    %rbp
+  8026bd:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8026be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c3:	c3                   	ret
+}
+  8026c4:	c3                   	ret
+
+00000000008026c5 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8026c5:	55                   	push   %rbp
+  8026c6:	48 89 e5             	mov    %rsp,%rbp
+  8026c9:	41 54                	push   %r12
+  8026cb:	53                   	push   %rbx
+  8026cc:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026cf:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026d6:	00 00 00 
+  8026d9:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8026de:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8026e2:	74 15                	je     8026f9 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026e4:	48 83 c3 01          	add    $0x1,%rbx
+  8026e8:	48 83 c0 18          	add    $0x18,%rax
+  8026ec:	48 83 fb 20          	cmp    $0x20,%rbx
+  8026f0:	75 ec                	jne    8026de <mmap_alloc+0x19>
+    return NULL;
+  8026f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026f7:	eb 52                	jmp    80274b <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026f9:	4c 89 e7             	mov    %r12,%rdi
+  8026fc:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  802703:	00 00 00 
+  802706:	ff d0                	call   *%rax
+  802708:	41 89 c1             	mov    %eax,%r9d
+  80270b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802712:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802716:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80271c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802721:	4c 89 e6             	mov    %r12,%rsi
+  802724:	bf 00 00 00 00       	mov    $0x0,%edi
+  802729:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  802730:	00 00 00 
+  802733:	ff d0                	call   *%rax
+  802735:	85 c0                	test   %eax,%eax
+  802737:	78 17                	js     802750 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802739:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80273d:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802744:	00 00 00 
+  802747:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80274b:	5b                   	pop    %rbx
+  80274c:	41 5c                	pop    %r12
+  80274e:	5d                   	pop    %rbp
+  80274f:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802750:	b8 00 00 00 00       	mov    $0x0,%eax
+  802755:	eb f4                	jmp    80274b <mmap_alloc+0x86>
+
+0000000000802757 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802757:	55                   	push   %rbp
+  802758:	48 89 e5             	mov    %rsp,%rbp
+  80275b:	41 56                	push   %r14
+  80275d:	41 55                	push   %r13
+  80275f:	41 54                	push   %r12
+  802761:	53                   	push   %rbx
+  802762:	48 83 ec 10          	sub    $0x10,%rsp
+  802766:	41 89 fc             	mov    %edi,%r12d
+  802769:	49 89 f5             	mov    %rsi,%r13
+  80276c:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80276f:	48 89 f0             	mov    %rsi,%rax
+  802772:	48 09 d0             	or     %rdx,%rax
+  802775:	75 0d                	jne    802784 <fsipc+0x2d>
+  802777:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80277a:	83 f8 04             	cmp    $0x4,%eax
+  80277d:	76 7d                	jbe    8027fc <fsipc+0xa5>
+  80277f:	83 ff 0d             	cmp    $0xd,%edi
+  802782:	74 78                	je     8027fc <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802784:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  80278b:	00 00 00 
+  80278e:	ff d0                	call   *%rax
+  802790:	89 c7                	mov    %eax,%edi
+  802792:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802799:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8027a0:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8027a7:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8027ad:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8027b4:	00 00 00 
+  8027b7:	44 89 e6             	mov    %r12d,%esi
+  8027ba:	48 b8 3c 4a 80 00 00 	movabs $0x804a3c,%rax
+  8027c1:	00 00 00 
+  8027c4:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8027c6:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8027cd:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8027ce:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027d3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027d7:	4c 89 ee             	mov    %r13,%rsi
+  8027da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027df:	48 b8 18 4a 80 00 00 	movabs $0x804a18,%rax
+  8027e6:	00 00 00 
+  8027e9:	ff d0                	call   *%rax
+  8027eb:	89 c3                	mov    %eax,%ebx
+}
+  8027ed:	89 d8                	mov    %ebx,%eax
+  8027ef:	48 83 c4 10          	add    $0x10,%rsp
+  8027f3:	5b                   	pop    %rbx
+  8027f4:	41 5c                	pop    %r12
+  8027f6:	41 5d                	pop    %r13
+  8027f8:	41 5e                	pop    %r14
+  8027fa:	5d                   	pop    %rbp
+  8027fb:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027fc:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+  802808:	49 89 c6             	mov    %rax,%r14
+  80280b:	48 85 c0             	test   %rax,%rax
+  80280e:	0f 84 70 ff ff ff    	je     802784 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802814:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802818:	48 b8 0c 43 80 00 00 	movabs $0x80430c,%rax
+  80281f:	00 00 00 
+  802822:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802824:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802827:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80282e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802832:	ba 10 00 00 00       	mov    $0x10,%edx
+  802837:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80283e:	00 00 00 
+  802841:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  802848:	00 00 00 
+  80284b:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80284d:	4c 89 f7             	mov    %r14,%rdi
+  802850:	48 b8 a5 22 80 00 00 	movabs $0x8022a5,%rax
+  802857:	00 00 00 
+  80285a:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80285c:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802863:	4c 89 f7             	mov    %r14,%rdi
+  802866:	48 b8 cf 43 80 00 00 	movabs $0x8043cf,%rax
+  80286d:	00 00 00 
+  802870:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802872:	4c 89 f7             	mov    %r14,%rdi
+  802875:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802881:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802884:	41 83 fc 05          	cmp    $0x5,%r12d
+  802888:	75 04                	jne    80288e <fsipc+0x137>
+  80288a:	85 db                	test   %ebx,%ebx
+  80288c:	79 14                	jns    8028a2 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80288e:	4c 89 f7             	mov    %r14,%rdi
+  802891:	48 b8 84 43 80 00 00 	movabs $0x804384,%rax
+  802898:	00 00 00 
+  80289b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80289d:	e9 4b ff ff ff       	jmp    8027ed <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8028a2:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8028a6:	ba 88 00 00 00       	mov    $0x88,%edx
+  8028ab:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8028b2:	00 00 00 
+  8028b5:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  8028bc:	00 00 00 
+  8028bf:	ff d0                	call   *%rax
+  8028c1:	eb cb                	jmp    80288e <fsipc+0x137>
+
+00000000008028c3 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028c3:	55                   	push   %rbp
+  8028c4:	48 89 e5             	mov    %rsp,%rbp
+  8028c7:	41 57                	push   %r15
+  8028c9:	41 56                	push   %r14
+  8028cb:	41 55                	push   %r13
+  8028cd:	41 54                	push   %r12
+  8028cf:	53                   	push   %rbx
+  8028d0:	48 83 ec 18          	sub    $0x18,%rsp
+  8028d4:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8028d8:	49 89 f6             	mov    %rsi,%r14
+  8028db:	49 89 d4             	mov    %rdx,%r12
+  8028de:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8028e1:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  8028e8:	00 00 00 
+  8028eb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028ed:	48 85 c0             	test   %rax,%rax
+  8028f0:	0f 85 96 00 00 00    	jne    80298c <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8028f6:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8028fd:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028fe:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802905:	00 00 00 
+    while (n) {
+  802908:	4d 85 e4             	test   %r12,%r12
+  80290b:	74 79                	je     802986 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80290d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802912:	49 39 dc             	cmp    %rbx,%r12
+  802915:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802919:	48 89 da             	mov    %rbx,%rdx
+  80291c:	4c 89 f6             	mov    %r14,%rsi
+  80291f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802926:	00 00 00 
+  802929:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  802930:	00 00 00 
+  802933:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802935:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802939:	8b 40 0c             	mov    0xc(%rax),%eax
+  80293c:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80293f:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802942:	44 01 e8             	add    %r13d,%eax
+  802945:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802949:	41 0f 44 c5          	cmove  %r13d,%eax
+  80294d:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802951:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802955:	48 89 da             	mov    %rbx,%rdx
+  802958:	be 00 00 00 00       	mov    $0x0,%esi
+  80295d:	bf 04 00 00 00       	mov    $0x4,%edi
+  802962:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802969:	00 00 00 
+  80296c:	ff d0                	call   *%rax
+        if (res < 0)
+  80296e:	85 c0                	test   %eax,%eax
+  802970:	78 4a                	js     8029bc <devfile_write_direct+0xf9>
+        buf += res;
+  802972:	48 98                	cltq
+  802974:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802977:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80297b:	49 29 c4             	sub    %rax,%r12
+  80297e:	75 8d                	jne    80290d <devfile_write_direct+0x4a>
+    return write;
+  802980:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802984:	eb 27                	jmp    8029ad <devfile_write_direct+0xea>
+    size_t write = 0;
+  802986:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80298a:	eb f4                	jmp    802980 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80298c:	45 89 e9             	mov    %r13d,%r9d
+  80298f:	4d 89 e0             	mov    %r12,%r8
+  802992:	4c 89 f1             	mov    %r14,%rcx
+  802995:	ba 04 00 00 00       	mov    $0x4,%edx
+  80299a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80299e:	48 89 c7             	mov    %rax,%rdi
+  8029a1:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  8029a8:	00 00 00 
+  8029ab:	ff d0                	call   *%rax
+}
+  8029ad:	48 83 c4 18          	add    $0x18,%rsp
+  8029b1:	5b                   	pop    %rbx
+  8029b2:	41 5c                	pop    %r12
+  8029b4:	41 5d                	pop    %r13
+  8029b6:	41 5e                	pop    %r14
+  8029b8:	41 5f                	pop    %r15
+  8029ba:	5d                   	pop    %rbp
+  8029bb:	c3                   	ret
+            return res;
+  8029bc:	48 98                	cltq
+  8029be:	eb ed                	jmp    8029ad <devfile_write_direct+0xea>
+
+00000000008029c0 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8029c0:	55                   	push   %rbp
+  8029c1:	48 89 e5             	mov    %rsp,%rbp
+  8029c4:	41 54                	push   %r12
+  8029c6:	53                   	push   %rbx
+  8029c7:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8029ca:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  8029d1:	00 00 00 
+  8029d4:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8029d6:	48 85 c0             	test   %rax,%rax
+  8029d9:	74 71                	je     802a4c <fbuf_flush+0x8c>
+  8029db:	48 89 c3             	mov    %rax,%rbx
+  8029de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029e3:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8029e7:	75 05                	jne    8029ee <fbuf_flush+0x2e>
+}
+  8029e9:	5b                   	pop    %rbx
+  8029ea:	41 5c                	pop    %r12
+  8029ec:	5d                   	pop    %rbp
+  8029ed:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8029ee:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8029f1:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8029f5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029fc:	00 00 00 
+  8029ff:	48 89 de             	mov    %rbx,%rsi
+  802a02:	48 29 c6             	sub    %rax,%rsi
+  802a05:	48 c1 fe 03          	sar    $0x3,%rsi
+  802a09:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a10:	aa aa aa 
+  802a13:	48 0f af f0          	imul   %rax,%rsi
+  802a17:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802a1b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a20:	48 01 c6             	add    %rax,%rsi
+  802a23:	4c 89 e7             	mov    %r12,%rdi
+  802a26:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802a2d:	00 00 00 
+  802a30:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802a32:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802a36:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802a3d:	00 
+    return res < 0 ? res : 0;
+  802a3e:	48 85 c0             	test   %rax,%rax
+  802a41:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a46:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802a4a:	eb 9d                	jmp    8029e9 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802a4c:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a51:	eb 96                	jmp    8029e9 <fbuf_flush+0x29>
+
+0000000000802a53 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802a53:	55                   	push   %rbp
+  802a54:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802a57:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802a5e:	00 00 00 
+  802a61:	ff d0                	call   *%rax
+}
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+
+0000000000802a65 <devfile_write>:
+    if (!fd || !buf)
+  802a65:	48 85 ff             	test   %rdi,%rdi
+  802a68:	0f 84 d3 01 00 00    	je     802c41 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802a6e:	55                   	push   %rbp
+  802a6f:	48 89 e5             	mov    %rsp,%rbp
+  802a72:	41 57                	push   %r15
+  802a74:	41 56                	push   %r14
+  802a76:	41 55                	push   %r13
+  802a78:	41 54                	push   %r12
+  802a7a:	53                   	push   %rbx
+  802a7b:	48 83 ec 08          	sub    $0x8,%rsp
+  802a7f:	49 89 fc             	mov    %rdi,%r12
+  802a82:	49 89 f6             	mov    %rsi,%r14
+  802a85:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802a88:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a8d:	48 85 f6             	test   %rsi,%rsi
+  802a90:	0f 84 9c 01 00 00    	je     802c32 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a96:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802a9d:	00 00 00 
+  802aa0:	ff d0                	call   *%rax
+  802aa2:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802aa5:	48 85 c0             	test   %rax,%rax
+  802aa8:	0f 84 a2 00 00 00    	je     802b50 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802aae:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ab3:	4c 89 e7             	mov    %r12,%rdi
+  802ab6:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  802abd:	00 00 00 
+  802ac0:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802ac2:	83 f8 02             	cmp    $0x2,%eax
+  802ac5:	0f 8f 85 00 00 00    	jg     802b50 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802acb:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802ad2:	00 00 00 
+  802ad5:	4d 89 ef             	mov    %r13,%r15
+  802ad8:	49 29 c7             	sub    %rax,%r15
+  802adb:	49 c1 ff 03          	sar    $0x3,%r15
+  802adf:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802ae6:	aa aa aa 
+  802ae9:	4c 0f af f8          	imul   %rax,%r15
+  802aed:	49 c1 e7 0e          	shl    $0xe,%r15
+  802af1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802af6:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802af9:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802afe:	0f 84 d7 00 00 00    	je     802bdb <devfile_write+0x176>
+  802b04:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802b08:	89 c2                	mov    %eax,%edx
+  802b0a:	41 03 55 0c          	add    0xc(%r13),%edx
+  802b0e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802b13:	75 0f                	jne    802b24 <devfile_write+0xbf>
+  802b15:	48 01 d8             	add    %rbx,%rax
+  802b18:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802b1e:	0f 86 92 00 00 00    	jbe    802bb6 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b24:	4c 89 e7             	mov    %r12,%rdi
+  802b27:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802b2e:	00 00 00 
+  802b31:	ff d0                	call   *%rax
+  802b33:	85 c0                	test   %eax,%eax
+  802b35:	78 52                	js     802b89 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b37:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b3e:	77 7f                	ja     802bbf <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802b40:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b45:	0f 85 c2 00 00 00    	jne    802c0d <devfile_write+0x1a8>
+  802b4b:	e9 94 00 00 00       	jmp    802be4 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802b50:	4c 89 e7             	mov    %r12,%rdi
+  802b53:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802b5a:	00 00 00 
+  802b5d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b5f:	85 c0                	test   %eax,%eax
+  802b61:	79 07                	jns    802b6a <devfile_write+0x105>
+  802b63:	48 98                	cltq
+  802b65:	e9 c8 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+  802b6a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b6f:	48 89 da             	mov    %rbx,%rdx
+  802b72:	4c 89 f6             	mov    %r14,%rsi
+  802b75:	4c 89 e7             	mov    %r12,%rdi
+  802b78:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802b7f:	00 00 00 
+  802b82:	ff d0                	call   *%rax
+  802b84:	e9 a9 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b89:	48 98                	cltq
+  802b8b:	e9 a2 00 00 00       	jmp    802c32 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b90:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b95:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b9a:	4c 89 fe             	mov    %r15,%rsi
+  802b9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ba2:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802bae:	85 c0                	test   %eax,%eax
+  802bb0:	79 45                	jns    802bf7 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802bb2:	48 98                	cltq
+  802bb4:	eb 7c                	jmp    802c32 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802bb6:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bbd:	76 4e                	jbe    802c0d <devfile_write+0x1a8>
+  802bbf:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802bc4:	48 89 da             	mov    %rbx,%rdx
+  802bc7:	4c 89 f6             	mov    %r14,%rsi
+  802bca:	4c 89 e7             	mov    %r12,%rdi
+  802bcd:	48 b8 c3 28 80 00 00 	movabs $0x8028c3,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+  802bd9:	eb 57                	jmp    802c32 <devfile_write+0x1cd>
+  802bdb:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802be2:	77 db                	ja     802bbf <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802be4:	4c 89 ff             	mov    %r15,%rdi
+  802be7:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  802bee:	00 00 00 
+  802bf1:	ff d0                	call   *%rax
+  802bf3:	84 c0                	test   %al,%al
+  802bf5:	74 99                	je     802b90 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802bf7:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802bfc:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802c01:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802c05:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802c0c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802c0d:	4c 89 ff             	mov    %r15,%rdi
+  802c10:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802c14:	48 89 da             	mov    %rbx,%rdx
+  802c17:	4c 89 f6             	mov    %r14,%rsi
+  802c1a:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  802c21:	00 00 00 
+  802c24:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802c26:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802c2a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802c2f:	48 89 d8             	mov    %rbx,%rax
+}
+  802c32:	48 83 c4 08          	add    $0x8,%rsp
+  802c36:	5b                   	pop    %rbx
+  802c37:	41 5c                	pop    %r12
+  802c39:	41 5d                	pop    %r13
+  802c3b:	41 5e                	pop    %r14
+  802c3d:	41 5f                	pop    %r15
+  802c3f:	5d                   	pop    %rbp
+  802c40:	c3                   	ret
+        return E_INVAL;
+  802c41:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c46:	c3                   	ret
+
+0000000000802c47 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c47:	55                   	push   %rbp
+  802c48:	48 89 e5             	mov    %rsp,%rbp
+  802c4b:	41 54                	push   %r12
+  802c4d:	53                   	push   %rbx
+  802c4e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802c51:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802c58:	00 00 00 
+  802c5b:	ff d0                	call   *%rax
+  802c5d:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802c60:	48 89 df             	mov    %rbx,%rdi
+  802c63:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802c6a:	00 00 00 
+  802c6d:	ff d0                	call   *%rax
+  802c6f:	48 85 c0             	test   %rax,%rax
+  802c72:	74 17                	je     802c8b <devfile_flush+0x44>
+  802c74:	48 89 df             	mov    %rbx,%rdi
+  802c77:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802c7e:	00 00 00 
+  802c81:	ff d0                	call   *%rax
+  802c83:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802c8a:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c8b:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c8e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c95:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c97:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c9c:	be 00 00 00 00       	mov    $0x0,%esi
+  802ca1:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ca6:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802cad:	00 00 00 
+  802cb0:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802cb2:	45 85 e4             	test   %r12d,%r12d
+  802cb5:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802cb9:	5b                   	pop    %rbx
+  802cba:	41 5c                	pop    %r12
+  802cbc:	5d                   	pop    %rbp
+  802cbd:	c3                   	ret
+
+0000000000802cbe <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802cbe:	55                   	push   %rbp
+  802cbf:	48 89 e5             	mov    %rsp,%rbp
+  802cc2:	41 57                	push   %r15
+  802cc4:	41 56                	push   %r14
+  802cc6:	41 55                	push   %r13
+  802cc8:	41 54                	push   %r12
+  802cca:	53                   	push   %rbx
+  802ccb:	48 83 ec 38          	sub    $0x38,%rsp
+  802ccf:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802cd3:	49 89 f7             	mov    %rsi,%r15
+  802cd6:	48 89 d3             	mov    %rdx,%rbx
+  802cd9:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802cdc:	48 b8 09 22 80 00 00 	movabs $0x802209,%rax
+  802ce3:	00 00 00 
+  802ce6:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ce8:	48 85 c0             	test   %rax,%rax
+  802ceb:	75 20                	jne    802d0d <devfile_read_direct+0x4f>
+    bool map = 1;
+  802ced:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802cf2:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802cf9:	00 
+    while (n) {
+  802cfa:	48 85 db             	test   %rbx,%rbx
+  802cfd:	0f 85 df 00 00 00    	jne    802de2 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802d03:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802d07:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d0b:	eb 21                	jmp    802d2e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802d0d:	45 89 f1             	mov    %r14d,%r9d
+  802d10:	49 89 d8             	mov    %rbx,%r8
+  802d13:	4c 89 f9             	mov    %r15,%rcx
+  802d16:	ba 03 00 00 00       	mov    $0x3,%edx
+  802d1b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d1f:	48 89 c7             	mov    %rax,%rdi
+  802d22:	48 b8 f0 22 80 00 00 	movabs $0x8022f0,%rax
+  802d29:	00 00 00 
+  802d2c:	ff d0                	call   *%rax
+}
+  802d2e:	48 83 c4 38          	add    $0x38,%rsp
+  802d32:	5b                   	pop    %rbx
+  802d33:	41 5c                	pop    %r12
+  802d35:	41 5d                	pop    %r13
+  802d37:	41 5e                	pop    %r14
+  802d39:	41 5f                	pop    %r15
+  802d3b:	5d                   	pop    %rbp
+  802d3c:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d3d:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d41:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d47:	75 1e                	jne    802d67 <devfile_read_direct+0xa9>
+  802d49:	e9 e2 00 00 00       	jmp    802e30 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802d4e:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d52:	eb da                	jmp    802d2e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802d54:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802d58:	0f 85 d0 01 00 00    	jne    802f2e <devfile_read_direct+0x270>
+            map = 0;
+  802d5e:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d62:	eb 03                	jmp    802d67 <devfile_read_direct+0xa9>
+  802d64:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802d67:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802d6c:	48 39 d3             	cmp    %rdx,%rbx
+  802d6f:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d73:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d77:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d7a:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802d81:	00 00 00 
+  802d84:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802d86:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802d8a:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d8e:	be 00 00 00 00       	mov    $0x0,%esi
+  802d93:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d98:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  802d9f:	00 00 00 
+  802da2:	ff d0                	call   *%rax
+        if (res <= 0)
+  802da4:	85 c0                	test   %eax,%eax
+  802da6:	0f 8e 63 01 00 00    	jle    802f0f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802dac:	4c 63 e0             	movslq %eax,%r12
+  802daf:	4c 89 e2             	mov    %r12,%rdx
+  802db2:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802db9:	00 00 00 
+  802dbc:	4c 89 ff             	mov    %r15,%rdi
+  802dbf:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  802dc6:	00 00 00 
+  802dc9:	ff d0                	call   *%rax
+        buf += res;
+  802dcb:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802dce:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802dd1:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802dd5:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802dd9:	48 85 db             	test   %rbx,%rbx
+  802ddc:	0f 84 25 ff ff ff    	je     802d07 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802de2:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802de5:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802de9:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802ded:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802df1:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802df8:	0f 97 c2             	seta   %dl
+  802dfb:	20 c2                	and    %al,%dl
+  802dfd:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802e00:	0f 84 5e ff ff ff    	je     802d64 <devfile_read_direct+0xa6>
+  802e06:	4c 89 fa             	mov    %r15,%rdx
+  802e09:	4d 89 fd             	mov    %r15,%r13
+  802e0c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802e13:	0f 85 4e ff ff ff    	jne    802d67 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802e19:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802e1d:	0f 84 1a ff ff ff    	je     802d3d <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e23:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e2a:	0f 85 37 ff ff ff    	jne    802d67 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802e30:	48 89 d8             	mov    %rbx,%rax
+  802e33:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e39:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802e3e:	48 39 c8             	cmp    %rcx,%rax
+  802e41:	48 0f 47 c1          	cmova  %rcx,%rax
+  802e45:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802e49:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802e4d:	49 89 d4             	mov    %rdx,%r12
+  802e50:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802e54:	48 b8 2f 41 80 00 00 	movabs $0x80412f,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	a8 40                	test   $0x40,%al
+  802e62:	0f 85 b9 00 00 00    	jne    802f21 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802e68:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802e6f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e73:	49 39 c5             	cmp    %rax,%r13
+  802e76:	72 d8                	jb     802e50 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e78:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e7c:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e83:	00 00 00 
+  802e86:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e8a:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802e8d:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e8f:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e93:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e97:	48 b8 a4 20 80 00 00 	movabs $0x8020a4,%rax
+  802e9e:	00 00 00 
+  802ea1:	ff d0                	call   *%rax
+  802ea3:	89 c7                	mov    %eax,%edi
+  802ea5:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802eab:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802eb0:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802eb7:	00 00 00 
+  802eba:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ebf:	48 b8 3c 4a 80 00 00 	movabs $0x804a3c,%rax
+  802ec6:	00 00 00 
+  802ec9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ecb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed0:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802ed4:	4c 89 fe             	mov    %r15,%rsi
+  802ed7:	bf 00 00 00 00       	mov    $0x0,%edi
+  802edc:	48 b8 18 4a 80 00 00 	movabs $0x804a18,%rax
+  802ee3:	00 00 00 
+  802ee6:	ff d0                	call   *%rax
+  802ee8:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802eeb:	48 85 d2             	test   %rdx,%rdx
+  802eee:	0f 84 5a fe ff ff    	je     802d4e <devfile_read_direct+0x90>
+            if (res > 0) {
+  802ef4:	0f 8e 5a fe ff ff    	jle    802d54 <devfile_read_direct+0x96>
+                buf += res;
+  802efa:	48 98                	cltq
+  802efc:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802eff:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802f02:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802f06:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802f0a:	e9 ca fe ff ff       	jmp    802dd9 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802f0f:	41 89 c5             	mov    %eax,%r13d
+  802f12:	48 98                	cltq
+  802f14:	45 85 ed             	test   %r13d,%r13d
+  802f17:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802f1c:	e9 0d fe ff ff       	jmp    802d2e <devfile_read_direct+0x70>
+            map = 0;
+  802f21:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f25:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f29:	e9 39 fe ff ff       	jmp    802d67 <devfile_read_direct+0xa9>
+  802f2e:	48 89 d0             	mov    %rdx,%rax
+  802f31:	e9 f8 fd ff ff       	jmp    802d2e <devfile_read_direct+0x70>
+
+0000000000802f36 <devfile_read>:
+    if (!fd || !buf)
+  802f36:	48 85 ff             	test   %rdi,%rdi
+  802f39:	0f 84 21 02 00 00    	je     803160 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f3f:	55                   	push   %rbp
+  802f40:	48 89 e5             	mov    %rsp,%rbp
+  802f43:	41 57                	push   %r15
+  802f45:	41 56                	push   %r14
+  802f47:	41 55                	push   %r13
+  802f49:	41 54                	push   %r12
+  802f4b:	53                   	push   %rbx
+  802f4c:	48 83 ec 28          	sub    $0x28,%rsp
+  802f50:	48 89 fb             	mov    %rdi,%rbx
+  802f53:	49 89 f4             	mov    %rsi,%r12
+  802f56:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802f59:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802f5e:	48 85 f6             	test   %rsi,%rsi
+  802f61:	74 4b                	je     802fae <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802f63:	48 b8 73 22 80 00 00 	movabs $0x802273,%rax
+  802f6a:	00 00 00 
+  802f6d:	ff d0                	call   *%rax
+  802f6f:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f72:	48 85 c0             	test   %rax,%rax
+  802f75:	74 22                	je     802f99 <devfile_read+0x63>
+  802f77:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802f7e:	77 19                	ja     802f99 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802f80:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f85:	48 89 df             	mov    %rbx,%rdi
+  802f88:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  802f8f:	00 00 00 
+  802f92:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f94:	83 f8 02             	cmp    $0x2,%eax
+  802f97:	7e 40                	jle    802fd9 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f99:	48 89 df             	mov    %rbx,%rdi
+  802f9c:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802fa3:	00 00 00 
+  802fa6:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fa8:	85 c0                	test   %eax,%eax
+  802faa:	79 11                	jns    802fbd <devfile_read+0x87>
+  802fac:	48 98                	cltq
+}
+  802fae:	48 83 c4 28          	add    $0x28,%rsp
+  802fb2:	5b                   	pop    %rbx
+  802fb3:	41 5c                	pop    %r12
+  802fb5:	41 5d                	pop    %r13
+  802fb7:	41 5e                	pop    %r14
+  802fb9:	41 5f                	pop    %r15
+  802fbb:	5d                   	pop    %rbp
+  802fbc:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fbd:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802fc2:	4c 89 ea             	mov    %r13,%rdx
+  802fc5:	4c 89 e6             	mov    %r12,%rsi
+  802fc8:	48 89 df             	mov    %rbx,%rdi
+  802fcb:	48 b8 be 2c 80 00 00 	movabs $0x802cbe,%rax
+  802fd2:	00 00 00 
+  802fd5:	ff d0                	call   *%rax
+  802fd7:	eb d5                	jmp    802fae <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802fd9:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802fdd:	48 89 df             	mov    %rbx,%rdi
+  802fe0:	48 b8 c0 29 80 00 00 	movabs $0x8029c0,%rax
+  802fe7:	00 00 00 
+  802fea:	ff d0                	call   *%rax
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	0f 88 33 01 00 00    	js     803127 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ff4:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802ffb:	00 00 00 
+  802ffe:	4c 89 f0             	mov    %r14,%rax
+  803001:	48 29 d0             	sub    %rdx,%rax
+  803004:	48 c1 f8 03          	sar    $0x3,%rax
+  803008:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80300f:	aa aa aa 
+  803012:	48 0f af c2          	imul   %rdx,%rax
+  803016:	48 c1 e0 0e          	shl    $0xe,%rax
+  80301a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80301e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803021:	41 39 06             	cmp    %eax,(%r14)
+  803024:	75 0d                	jne    803033 <devfile_read+0xfd>
+  803026:	8b 43 10             	mov    0x10(%rbx),%eax
+  803029:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80302d:	0f 84 fb 00 00 00    	je     80312e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803033:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803038:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  80303c:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80303f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803043:	48 89 c7             	mov    %rax,%rdi
+  803046:	48 b8 8e 41 80 00 00 	movabs $0x80418e,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+  803052:	84 c0                	test   %al,%al
+  803054:	75 27                	jne    80307d <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803056:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80305b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803060:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803064:	bf 00 00 00 00       	mov    $0x0,%edi
+  803069:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  803070:	00 00 00 
+  803073:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803075:	85 c0                	test   %eax,%eax
+  803077:	0f 88 dc 00 00 00    	js     803159 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80307d:	44 89 f8             	mov    %r15d,%eax
+  803080:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803085:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803087:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80308e:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80308f:	8b 43 10             	mov    0x10(%rbx),%eax
+  803092:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803096:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803099:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80309e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8030a2:	48 89 df             	mov    %rbx,%rdi
+  8030a5:	48 b8 be 2c 80 00 00 	movabs $0x802cbe,%rax
+  8030ac:	00 00 00 
+  8030af:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8030b1:	48 85 c0             	test   %rax,%rax
+  8030b4:	0f 88 f4 fe ff ff    	js     802fae <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8030ba:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8030bd:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8030c0:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8030c3:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8030c7:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8030cb:	48 63 d1             	movslq %ecx,%rdx
+  8030ce:	48 01 d0             	add    %rdx,%rax
+  8030d1:	4d 63 ff             	movslq %r15d,%r15
+  8030d4:	4c 29 f8             	sub    %r15,%rax
+  8030d7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030dc:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8030e0:	48 85 c0             	test   %rax,%rax
+  8030e3:	0f 8e c5 fe ff ff    	jle    802fae <devfile_read+0x78>
+    n = MIN(n, res);
+  8030e9:	4c 39 e8             	cmp    %r13,%rax
+  8030ec:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  8030f0:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030f3:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8030f7:	48 63 f6             	movslq %esi,%rsi
+  8030fa:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030ff:	48 01 c6             	add    %rax,%rsi
+  803102:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803106:	48 01 c6             	add    %rax,%rsi
+  803109:	4c 89 ea             	mov    %r13,%rdx
+  80310c:	4c 89 e7             	mov    %r12,%rdi
+  80310f:	48 b8 21 11 80 00 00 	movabs $0x801121,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80311b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80311f:	4c 89 e8             	mov    %r13,%rax
+  803122:	e9 87 fe ff ff       	jmp    802fae <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803127:	48 98                	cltq
+  803129:	e9 80 fe ff ff       	jmp    802fae <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80312e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803132:	41 39 d7             	cmp    %edx,%r15d
+  803135:	0f 8c f8 fe ff ff    	jl     803033 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80313b:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80313f:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803142:	41 39 cf             	cmp    %ecx,%r15d
+  803145:	0f 8d e8 fe ff ff    	jge    803033 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80314b:	4d 63 ff             	movslq %r15d,%r15
+  80314e:	4c 29 f8             	sub    %r15,%rax
+  803151:	48 63 d2             	movslq %edx,%rdx
+  803154:	48 01 d0             	add    %rdx,%rax
+  803157:	eb 87                	jmp    8030e0 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803159:	48 98                	cltq
+  80315b:	e9 4e fe ff ff       	jmp    802fae <devfile_read+0x78>
+        return E_INVAL;
+  803160:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803165:	c3                   	ret
+
+0000000000803166 <fs_channel>:
+fs_channel(bool enable) {
+  803166:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803168:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80316f:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803171:	ba 00 00 00 00       	mov    $0x0,%edx
+  803176:	40 84 ff             	test   %dil,%dil
+  803179:	74 47                	je     8031c2 <fs_channel+0x5c>
+  80317b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803182:	00 00 00 
+  803185:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80318b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803192:	00 00 00 
+  803195:	3b 08                	cmp    (%rax),%ecx
+  803197:	74 29                	je     8031c2 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803199:	55                   	push   %rbp
+  80319a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80319d:	48 b8 e6 20 80 00 00 	movabs $0x8020e6,%rax
+  8031a4:	00 00 00 
+  8031a7:	ff d0                	call   *%rax
+  8031a9:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8031ab:	85 c0                	test   %eax,%eax
+  8031ad:	78 04                	js     8031b3 <fs_channel+0x4d>
+}
+  8031af:	89 d0                	mov    %edx,%eax
+  8031b1:	5d                   	pop    %rbp
+  8031b2:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8031b3:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8031ba:	00 00 00 
+  8031bd:	c6 00 00             	movb   $0x0,(%rax)
+  8031c0:	eb ed                	jmp    8031af <fs_channel+0x49>
+}
+  8031c2:	89 d0                	mov    %edx,%eax
+  8031c4:	c3                   	ret
+
+00000000008031c5 <open>:
+open(const char *path, int mode) {
+  8031c5:	55                   	push   %rbp
+  8031c6:	48 89 e5             	mov    %rsp,%rbp
+  8031c9:	41 55                	push   %r13
+  8031cb:	41 54                	push   %r12
+  8031cd:	53                   	push   %rbx
+  8031ce:	48 83 ec 18          	sub    $0x18,%rsp
+  8031d2:	49 89 fc             	mov    %rdi,%r12
+  8031d5:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031d8:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+  8031e4:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031ea:	0f 87 8f 00 00 00    	ja     80327f <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031f0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031f4:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  8031fb:	00 00 00 
+  8031fe:	ff d0                	call   *%rax
+  803200:	89 c3                	mov    %eax,%ebx
+  803202:	85 c0                	test   %eax,%eax
+  803204:	78 55                	js     80325b <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803206:	4c 89 e6             	mov    %r12,%rsi
+  803209:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803210:	00 00 00 
+  803213:	48 89 df             	mov    %rbx,%rdi
+  803216:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  80321d:	00 00 00 
+  803220:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803222:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803229:	ba 00 00 00 00       	mov    $0x0,%edx
+  80322e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803232:	bf 01 00 00 00       	mov    $0x1,%edi
+  803237:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  80323e:	00 00 00 
+  803241:	ff d0                	call   *%rax
+  803243:	89 c3                	mov    %eax,%ebx
+  803245:	85 c0                	test   %eax,%eax
+  803247:	78 1f                	js     803268 <open+0xa3>
+    return fd2num(fd);
+  803249:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80324d:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+  803259:	89 c3                	mov    %eax,%ebx
+}
+  80325b:	89 d8                	mov    %ebx,%eax
+  80325d:	48 83 c4 18          	add    $0x18,%rsp
+  803261:	5b                   	pop    %rbx
+  803262:	41 5c                	pop    %r12
+  803264:	41 5d                	pop    %r13
+  803266:	5d                   	pop    %rbp
+  803267:	c3                   	ret
+        fd_close(fd, 0);
+  803268:	be 00 00 00 00       	mov    $0x0,%esi
+  80326d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803271:	48 b8 bb 1a 80 00 00 	movabs $0x801abb,%rax
+  803278:	00 00 00 
+  80327b:	ff d0                	call   *%rax
+        return res;
+  80327d:	eb dc                	jmp    80325b <open+0x96>
+        return -E_BAD_PATH;
+  80327f:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803284:	eb d5                	jmp    80325b <open+0x96>
+
+0000000000803286 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803286:	55                   	push   %rbp
+  803287:	48 89 e5             	mov    %rsp,%rbp
+  80328a:	41 56                	push   %r14
+  80328c:	41 55                	push   %r13
+  80328e:	41 54                	push   %r12
+  803290:	53                   	push   %rbx
+  803291:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803295:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80329c:	00 00 00 
+  80329f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032a4:	49 bd 00 1a 80 00 00 	movabs $0x801a00,%r13
+  8032ab:	00 00 00 
+  8032ae:	49 be c0 29 80 00 00 	movabs $0x8029c0,%r14
+  8032b5:	00 00 00 
+  8032b8:	eb 0c                	jmp    8032c6 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8032ba:	83 c3 01             	add    $0x1,%ebx
+  8032bd:	49 83 c4 18          	add    $0x18,%r12
+  8032c1:	83 fb 20             	cmp    $0x20,%ebx
+  8032c4:	74 1d                	je     8032e3 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032c6:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8032cb:	74 ed                	je     8032ba <file_flush_buffers+0x34>
+  8032cd:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032d1:	89 df                	mov    %ebx,%edi
+  8032d3:	41 ff d5             	call   *%r13
+  8032d6:	85 c0                	test   %eax,%eax
+  8032d8:	78 e0                	js     8032ba <file_flush_buffers+0x34>
+  8032da:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032de:	41 ff d6             	call   *%r14
+  8032e1:	eb d7                	jmp    8032ba <file_flush_buffers+0x34>
+}
+  8032e3:	48 83 c4 10          	add    $0x10,%rsp
+  8032e7:	5b                   	pop    %rbx
+  8032e8:	41 5c                	pop    %r12
+  8032ea:	41 5d                	pop    %r13
+  8032ec:	41 5e                	pop    %r14
+  8032ee:	5d                   	pop    %rbp
+  8032ef:	c3                   	ret
+
+00000000008032f0 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8032f0:	55                   	push   %rbp
+  8032f1:	48 89 e5             	mov    %rsp,%rbp
+  8032f4:	41 54                	push   %r12
+  8032f6:	53                   	push   %rbx
+  8032f7:	49 89 fc             	mov    %rdi,%r12
+  8032fa:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8032fc:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803303:	00 00 00 
+  803306:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803308:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80330f:	00 00 00 
+  803312:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803317:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803319:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80331c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803321:	be 00 00 00 00       	mov    $0x0,%esi
+  803326:	bf 02 00 00 00       	mov    $0x2,%edi
+  80332b:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803332:	00 00 00 
+  803335:	ff d0                	call   *%rax
+}
+  803337:	5b                   	pop    %rbx
+  803338:	41 5c                	pop    %r12
+  80333a:	5d                   	pop    %rbp
+  80333b:	c3                   	ret
+
+000000000080333c <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80333c:	55                   	push   %rbp
+  80333d:	48 89 e5             	mov    %rsp,%rbp
+  803340:	41 54                	push   %r12
+  803342:	53                   	push   %rbx
+  803343:	49 89 fc             	mov    %rdi,%r12
+  803346:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803349:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803350:	00 00 00 
+  803353:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803355:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80335a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803361:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803363:	ba 00 00 00 00       	mov    $0x0,%edx
+  803368:	be 00 00 00 00       	mov    $0x0,%esi
+  80336d:	bf 05 00 00 00       	mov    $0x5,%edi
+  803372:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803379:	00 00 00 
+  80337c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80337e:	85 c0                	test   %eax,%eax
+  803380:	78 3d                	js     8033bf <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803382:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803389:	00 00 00 
+  80338c:	4c 89 e6             	mov    %r12,%rsi
+  80338f:	48 89 df             	mov    %rbx,%rdi
+  803392:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80339e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8033a5:	00 
+  8033a6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8033ac:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8033b3:	00 
+  8033b4:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8033ba:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033bf:	5b                   	pop    %rbx
+  8033c0:	41 5c                	pop    %r12
+  8033c2:	5d                   	pop    %rbp
+  8033c3:	c3                   	ret
+
+00000000008033c4 <remove>:
+remove(const char *path) {
+  8033c4:	55                   	push   %rbp
+  8033c5:	48 89 e5             	mov    %rsp,%rbp
+  8033c8:	53                   	push   %rbx
+  8033c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8033cd:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8033d0:	48 b8 82 0e 80 00 00 	movabs $0x800e82,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+  8033dc:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033e2:	77 3a                	ja     80341e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8033e4:	48 89 de             	mov    %rbx,%rsi
+  8033e7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033ee:	00 00 00 
+  8033f1:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  8033f8:	00 00 00 
+  8033fb:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8033fd:	ba 00 00 00 00       	mov    $0x0,%edx
+  803402:	be 00 00 00 00       	mov    $0x0,%esi
+  803407:	bf 07 00 00 00       	mov    $0x7,%edi
+  80340c:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803413:	00 00 00 
+  803416:	ff d0                	call   *%rax
+}
+  803418:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80341c:	c9                   	leave
+  80341d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80341e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803423:	eb f3                	jmp    803418 <remove+0x54>
+
+0000000000803425 <sync>:
+sync(void) {
+  803425:	55                   	push   %rbp
+  803426:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803429:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803430:	00 00 00 
+  803433:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803435:	ba 00 00 00 00       	mov    $0x0,%edx
+  80343a:	be 00 00 00 00       	mov    $0x0,%esi
+  80343f:	bf 08 00 00 00       	mov    $0x8,%edi
+  803444:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  80344b:	00 00 00 
+  80344e:	ff d0                	call   *%rax
+}
+  803450:	5d                   	pop    %rbp
+  803451:	c3                   	ret
+
+0000000000803452 <fsync>:
+fsync(int fdnum) {
+  803452:	55                   	push   %rbp
+  803453:	48 89 e5             	mov    %rsp,%rbp
+  803456:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80345a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80345e:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  803465:	00 00 00 
+  803468:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80346a:	85 c0                	test   %eax,%eax
+  80346c:	78 4b                	js     8034b9 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80346e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803472:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803479:	00 00 00 
+  80347c:	8b 00                	mov    (%rax),%eax
+  80347e:	39 02                	cmp    %eax,(%rdx)
+  803480:	75 39                	jne    8034bb <fsync+0x69>
+    file_flush_buffers();
+  803482:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  803489:	00 00 00 
+  80348c:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80348e:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803492:	8b 40 0c             	mov    0xc(%rax),%eax
+  803495:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80349c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80349e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a8:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8034ad:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+}
+  8034b9:	c9                   	leave
+  8034ba:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034bb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034c0:	eb f7                	jmp    8034b9 <fsync+0x67>
+
+00000000008034c2 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8034c2:	55                   	push   %rbp
+  8034c3:	48 89 e5             	mov    %rsp,%rbp
+  8034c6:	53                   	push   %rbx
+  8034c7:	48 83 ec 08          	sub    $0x8,%rsp
+  8034cb:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8034ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034d8:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034dd:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  8034e4:	00 00 00 
+  8034e7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034e9:	85 c0                	test   %eax,%eax
+  8034eb:	78 2d                	js     80351a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8034ed:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034f4:	00 00 00 
+  8034f7:	48 8b 10             	mov    (%rax),%rdx
+  8034fa:	48 89 13             	mov    %rdx,(%rbx)
+  8034fd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803501:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803505:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803509:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80350d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803511:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803515:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80351a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80351e:	c9                   	leave
+  80351f:	c3                   	ret
+
+0000000000803520 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803520:	55                   	push   %rbp
+  803521:	48 89 e5             	mov    %rsp,%rbp
+  803524:	53                   	push   %rbx
+  803525:	48 83 ec 08          	sub    $0x8,%rsp
+  803529:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80352c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803531:	be 00 00 00 00       	mov    $0x0,%esi
+  803536:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80353b:	48 b8 57 27 80 00 00 	movabs $0x802757,%rax
+  803542:	00 00 00 
+  803545:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803547:	85 c0                	test   %eax,%eax
+  803549:	78 3d                	js     803588 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80354b:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803552:	00 00 00 
+  803555:	48 8b 10             	mov    (%rax),%rdx
+  803558:	48 89 13             	mov    %rdx,(%rbx)
+  80355b:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80355f:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803563:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803567:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80356b:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80356f:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803573:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803577:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80357b:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80357f:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803583:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803588:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80358c:	c9                   	leave
+  80358d:	c3                   	ret
+
+000000000080358e <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80358e:	55                   	push   %rbp
+  80358f:	48 89 e5             	mov    %rsp,%rbp
+  803592:	41 57                	push   %r15
+  803594:	41 56                	push   %r14
+  803596:	41 55                	push   %r13
+  803598:	41 54                	push   %r12
+  80359a:	53                   	push   %rbx
+  80359b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80359f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8035a6:	00 
+  8035a7:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8035ae:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035b4:	0f 85 43 01 00 00    	jne    8036fd <munmap+0x16f>
+  8035ba:	49 89 ff             	mov    %rdi,%r15
+  8035bd:	4c 39 f7             	cmp    %r14,%rdi
+  8035c0:	0f 87 37 01 00 00    	ja     8036fd <munmap+0x16f>
+  8035c6:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8035cd:	00 00 00 
+  8035d0:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8035d6:	eb 2c                	jmp    803604 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8035d8:	4c 39 f8             	cmp    %r15,%rax
+  8035db:	0f 83 85 00 00 00    	jae    803666 <munmap+0xd8>
+            m->mm_end = start;
+  8035e1:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8035e6:	48 83 c3 18          	add    $0x18,%rbx
+  8035ea:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8035f1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035f8:	00 00 00 
+  8035fb:	48 39 c3             	cmp    %rax,%rbx
+  8035fe:	0f 84 d0 00 00 00    	je     8036d4 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803604:	49 89 dc             	mov    %rbx,%r12
+  803607:	48 8b 03             	mov    (%rbx),%rax
+  80360a:	4c 39 f0             	cmp    %r14,%rax
+  80360d:	73 d7                	jae    8035e6 <munmap+0x58>
+  80360f:	48 85 c0             	test   %rax,%rax
+  803612:	74 d2                	je     8035e6 <munmap+0x58>
+  803614:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803618:	49 39 d7             	cmp    %rdx,%r15
+  80361b:	73 c9                	jae    8035e6 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80361d:	49 39 d6             	cmp    %rdx,%r14
+  803620:	73 b6                	jae    8035d8 <munmap+0x4a>
+  803622:	49 39 c7             	cmp    %rax,%r15
+  803625:	76 b1                	jbe    8035d8 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803627:	4c 89 ef             	mov    %r13,%rdi
+  80362a:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803631:	00 00 00 
+  803634:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803636:	48 85 c0             	test   %rax,%rax
+  803639:	0f 84 c5 00 00 00    	je     803704 <munmap+0x176>
+            *tail = *m;
+  80363f:	48 8b 13             	mov    (%rbx),%rdx
+  803642:	48 89 10             	mov    %rdx,(%rax)
+  803645:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803649:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80364d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803651:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803655:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803658:	44 89 f2             	mov    %r14d,%edx
+  80365b:	2b 13                	sub    (%rbx),%edx
+  80365d:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803660:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803664:	eb 80                	jmp    8035e6 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803666:	49 39 d6             	cmp    %rdx,%r14
+  803669:	73 18                	jae    803683 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80366b:	44 89 f2             	mov    %r14d,%edx
+  80366e:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803673:	29 c2                	sub    %eax,%edx
+  803675:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80367a:	4d 89 34 24          	mov    %r14,(%r12)
+  80367e:	e9 63 ff ff ff       	jmp    8035e6 <munmap+0x58>
+    m->mm_start = 0;
+  803683:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80368a:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80368b:	4c 89 e6             	mov    %r12,%rsi
+  80368e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803695:	00 00 00 
+  803698:	48 29 c6             	sub    %rax,%rsi
+  80369b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80369f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8036a6:	aa aa aa 
+  8036a9:	48 0f af f0          	imul   %rax,%rsi
+  8036ad:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8036b1:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8036b6:	48 01 c6             	add    %rax,%rsi
+  8036b9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c3:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8036ca:	00 00 00 
+  8036cd:	ff d0                	call   *%rax
+}
+  8036cf:	e9 12 ff ff ff       	jmp    8035e6 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8036d4:	4c 89 f2             	mov    %r14,%rdx
+  8036d7:	4c 29 fa             	sub    %r15,%rdx
+  8036da:	4c 89 fe             	mov    %r15,%rsi
+  8036dd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036e2:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  8036e9:	00 00 00 
+  8036ec:	ff d0                	call   *%rax
+}
+  8036ee:	48 83 c4 08          	add    $0x8,%rsp
+  8036f2:	5b                   	pop    %rbx
+  8036f3:	41 5c                	pop    %r12
+  8036f5:	41 5d                	pop    %r13
+  8036f7:	41 5e                	pop    %r14
+  8036f9:	41 5f                	pop    %r15
+  8036fb:	5d                   	pop    %rbp
+  8036fc:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036fd:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803702:	eb ea                	jmp    8036ee <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803704:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803709:	eb e3                	jmp    8036ee <munmap+0x160>
+
+000000000080370b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80370b:	55                   	push   %rbp
+  80370c:	48 89 e5             	mov    %rsp,%rbp
+  80370f:	41 57                	push   %r15
+  803711:	41 56                	push   %r14
+  803713:	41 55                	push   %r13
+  803715:	41 54                	push   %r12
+  803717:	53                   	push   %rbx
+  803718:	48 83 ec 28          	sub    $0x28,%rsp
+  80371c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803720:	49 89 f5             	mov    %rsi,%r13
+  803723:	41 89 d6             	mov    %edx,%r14d
+  803726:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803729:	41 89 cc             	mov    %ecx,%r12d
+  80372c:	44 89 c7             	mov    %r8d,%edi
+  80372f:	44 89 cb             	mov    %r9d,%ebx
+  803732:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803736:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80373a:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  803741:	00 00 00 
+  803744:	ff d0                	call   *%rax
+  803746:	41 89 c7             	mov    %eax,%r15d
+  803749:	85 c0                	test   %eax,%eax
+  80374b:	0f 88 ae 01 00 00    	js     8038ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803751:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803755:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80375c:	00 00 00 
+  80375f:	8b 32                	mov    (%rdx),%esi
+  803761:	39 30                	cmp    %esi,(%rax)
+  803763:	0f 85 7a 02 00 00    	jne    8039e3 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803769:	8b 40 08             	mov    0x8(%rax),%eax
+  80376c:	83 e0 03             	and    $0x3,%eax
+  80376f:	83 f8 01             	cmp    $0x1,%eax
+  803772:	0f 84 76 02 00 00    	je     8039ee <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803778:	4d 85 ed             	test   %r13,%r13
+  80377b:	0f 84 78 02 00 00    	je     8039f9 <mmap+0x2ee>
+  803781:	85 db                	test   %ebx,%ebx
+  803783:	0f 88 70 02 00 00    	js     8039f9 <mmap+0x2ee>
+  803789:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80378f:	41 89 df             	mov    %ebx,%r15d
+  803792:	0f 85 6c 02 00 00    	jne    803a04 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803798:	44 89 f0             	mov    %r14d,%eax
+  80379b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80379e:	83 f8 04             	cmp    $0x4,%eax
+  8037a1:	0f 85 68 02 00 00    	jne    803a0f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037a7:	44 89 e1             	mov    %r12d,%ecx
+  8037aa:	83 e1 01             	and    $0x1,%ecx
+  8037ad:	0f 95 c2             	setne  %dl
+  8037b0:	44 89 e0             	mov    %r12d,%eax
+  8037b3:	d1 e8                	shr    %eax
+  8037b5:	83 f0 01             	xor    $0x1,%eax
+  8037b8:	83 e0 01             	and    $0x1,%eax
+  8037bb:	38 c2                	cmp    %al,%dl
+  8037bd:	0f 85 57 02 00 00    	jne    803a1a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037c3:	85 c9                	test   %ecx,%ecx
+  8037c5:	74 0a                	je     8037d1 <mmap+0xc6>
+  8037c7:	41 f6 c6 02          	test   $0x2,%r14b
+  8037cb:	0f 85 54 02 00 00    	jne    803a25 <mmap+0x31a>
+    file_flush_buffers();
+  8037d1:	48 b8 86 32 80 00 00 	movabs $0x803286,%rax
+  8037d8:	00 00 00 
+  8037db:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8037dd:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8037e4:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8037eb:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8037ef:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8037f2:	41 f6 c4 04          	test   $0x4,%r12b
+  8037f6:	0f 84 15 01 00 00    	je     803911 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8037fc:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037ff:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803805:	0f 85 25 02 00 00    	jne    803a30 <mmap+0x325>
+  80380b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80380f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803816:	00 00 00 
+  803819:	48 39 c2             	cmp    %rax,%rdx
+  80381c:	0f 82 19 02 00 00    	jb     803a3b <mmap+0x330>
+  803822:	48 39 c7             	cmp    %rax,%rdi
+  803825:	0f 87 10 02 00 00    	ja     803a3b <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80382b:	4c 89 ee             	mov    %r13,%rsi
+  80382e:	48 b8 8e 35 80 00 00 	movabs $0x80358e,%rax
+  803835:	00 00 00 
+  803838:	ff d0                	call   *%rax
+  80383a:	85 c0                	test   %eax,%eax
+  80383c:	0f 88 04 02 00 00    	js     803a46 <mmap+0x33b>
+    if (!handler) {
+  803842:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803849:	00 00 00 
+  80384c:	80 38 00             	cmpb   $0x0,(%rax)
+  80384f:	75 2b                	jne    80387c <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803851:	48 bf 26 26 80 00 00 	movabs $0x802626,%rdi
+  803858:	00 00 00 
+  80385b:	48 b8 e7 46 80 00 00 	movabs $0x8046e7,%rax
+  803862:	00 00 00 
+  803865:	ff d0                	call   *%rax
+  803867:	85 c0                	test   %eax,%eax
+  803869:	0f 88 ea 01 00 00    	js     803a59 <mmap+0x34e>
+        handler = 1;
+  80386f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803876:	00 00 00 
+  803879:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80387c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803880:	48 b8 c5 26 80 00 00 	movabs $0x8026c5,%rax
+  803887:	00 00 00 
+  80388a:	ff d0                	call   *%rax
+  80388c:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80388f:	48 85 c0             	test   %rax,%rax
+  803892:	0f 84 c9 01 00 00    	je     803a61 <mmap+0x356>
+    m->mm_start = va;
+  803898:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80389b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80389f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8038a3:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8038a6:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8038aa:	44 89 e0             	mov    %r12d,%eax
+  8038ad:	c1 e0 06             	shl    $0x6,%eax
+  8038b0:	25 80 00 00 00       	and    $0x80,%eax
+  8038b5:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8038b8:	09 f0                	or     %esi,%eax
+  8038ba:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8038be:	41 f6 c4 08          	test   $0x8,%r12b
+  8038c2:	74 31                	je     8038f5 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038c4:	48 39 d3             	cmp    %rdx,%rbx
+  8038c7:	73 2c                	jae    8038f5 <mmap+0x1ea>
+  8038c9:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8038ce:	48 89 de             	mov    %rbx,%rsi
+  8038d1:	4c 89 f7             	mov    %r14,%rdi
+  8038d4:	48 b8 15 25 80 00 00 	movabs $0x802515,%rax
+  8038db:	00 00 00 
+  8038de:	ff d0                	call   *%rax
+  8038e0:	49 89 c4             	mov    %rax,%r12
+  8038e3:	48 85 c0             	test   %rax,%rax
+  8038e6:	0f 8e d7 00 00 00    	jle    8039c3 <mmap+0x2b8>
+            va += n;
+  8038ec:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038ef:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8038f3:	72 d4                	jb     8038c9 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8038f5:	49 8b 06             	mov    (%r14),%rax
+  8038f8:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8038fc:	48 89 06             	mov    %rax,(%rsi)
+}
+  8038ff:	44 89 f8             	mov    %r15d,%eax
+  803902:	48 83 c4 28          	add    $0x28,%rsp
+  803906:	5b                   	pop    %rbx
+  803907:	41 5c                	pop    %r12
+  803909:	41 5d                	pop    %r13
+  80390b:	41 5e                	pop    %r14
+  80390d:	41 5f                	pop    %r15
+  80390f:	5d                   	pop    %rbp
+  803910:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803911:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803918:	00 00 00 
+  80391b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80391e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803925:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803928:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80392d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803934:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803937:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80393e:	00 00 00 
+  803941:	48 39 d7             	cmp    %rdx,%rdi
+  803944:	73 1c                	jae    803962 <mmap+0x257>
+        return -E_NO_MEM;
+  803946:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80394c:	eb b1                	jmp    8038ff <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80394e:	48 83 c0 01          	add    $0x1,%rax
+  803952:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803956:	77 3f                	ja     803997 <mmap+0x28c>
+  803958:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80395d:	48 39 d7             	cmp    %rdx,%rdi
+  803960:	72 2a                	jb     80398c <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803962:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803966:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80396a:	48 39 d1             	cmp    %rdx,%rcx
+  80396d:	73 df                	jae    80394e <mmap+0x243>
+  80396f:	48 85 c9             	test   %rcx,%rcx
+  803972:	74 da                	je     80394e <mmap+0x243>
+  803974:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803978:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80397d:	48 39 d3             	cmp    %rdx,%rbx
+  803980:	73 cc                	jae    80394e <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803982:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803985:	b8 00 00 00 00       	mov    $0x0,%eax
+  80398a:	eb cc                	jmp    803958 <mmap+0x24d>
+        return -E_NO_MEM;
+  80398c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803992:	e9 68 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803997:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80399c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8039a3:	00 00 00 
+  8039a6:	48 39 c2             	cmp    %rax,%rdx
+  8039a9:	0f 82 9f 00 00 00    	jb     803a4e <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8039af:	48 85 db             	test   %rbx,%rbx
+  8039b2:	0f 85 8a fe ff ff    	jne    803842 <mmap+0x137>
+        return -E_NO_MEM;
+  8039b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039be:	e9 3c ff ff ff       	jmp    8038ff <mmap+0x1f4>
+        if (n < 0) {
+  8039c3:	0f 89 2c ff ff ff    	jns    8038f5 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8039c9:	49 8b 3e             	mov    (%r14),%rdi
+  8039cc:	4c 89 ee             	mov    %r13,%rsi
+  8039cf:	48 b8 8e 35 80 00 00 	movabs $0x80358e,%rax
+  8039d6:	00 00 00 
+  8039d9:	ff d0                	call   *%rax
+            return n;
+  8039db:	45 89 e7             	mov    %r12d,%r15d
+  8039de:	e9 1c ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8039e3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039e9:	e9 11 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039ee:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039f4:	e9 06 ff ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039f9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039ff:	e9 fb fe ff ff       	jmp    8038ff <mmap+0x1f4>
+  803a04:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a0a:	e9 f0 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803a0f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a15:	e9 e5 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803a1a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a20:	e9 da fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a25:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803a2b:	e9 cf fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a30:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a36:	e9 c4 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+  803a3b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a41:	e9 b9 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a46:	41 89 c7             	mov    %eax,%r15d
+  803a49:	e9 b1 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        return -E_NO_MEM;
+  803a4e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a54:	e9 a6 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a59:	41 89 c7             	mov    %eax,%r15d
+  803a5c:	e9 9e fe ff ff       	jmp    8038ff <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803a61:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a67:	e9 93 fe ff ff       	jmp    8038ff <mmap+0x1f4>
+
+0000000000803a6c <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a6c:	55                   	push   %rbp
+  803a6d:	48 89 e5             	mov    %rsp,%rbp
+  803a70:	41 54                	push   %r12
+  803a72:	53                   	push   %rbx
+  803a73:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a76:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803a7d:	00 00 00 
+  803a80:	ff d0                	call   *%rax
+  803a82:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a85:	48 be a0 52 80 00 00 	movabs $0x8052a0,%rsi
+  803a8c:	00 00 00 
+  803a8f:	48 89 df             	mov    %rbx,%rdi
+  803a92:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  803a99:	00 00 00 
+  803a9c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a9e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803aa3:	41 2b 04 24          	sub    (%r12),%eax
+  803aa7:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803aad:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803ab4:	00 00 00 
+    stat->st_dev = &devpipe;
+  803ab7:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803abe:	00 00 00 
+  803ac1:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803ac8:	b8 00 00 00 00       	mov    $0x0,%eax
+  803acd:	5b                   	pop    %rbx
+  803ace:	41 5c                	pop    %r12
+  803ad0:	5d                   	pop    %rbp
+  803ad1:	c3                   	ret
+
+0000000000803ad2 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ad2:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ad5:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803adb:	8b 17                	mov    (%rdi),%edx
+  803add:	85 d2                	test   %edx,%edx
+  803adf:	75 01                	jne    803ae2 <pipe_wakeup+0x10>
+  803ae1:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ae2:	55                   	push   %rbp
+  803ae3:	48 89 e5             	mov    %rsp,%rbp
+  803ae6:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803ae9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803aef:	be 00 04 00 00       	mov    $0x400,%esi
+  803af4:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  803afb:	00 00 00 
+  803afe:	ff d0                	call   *%rax
+}
+  803b00:	5d                   	pop    %rbp
+  803b01:	c3                   	ret
+
+0000000000803b02 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803b02:	55                   	push   %rbp
+  803b03:	48 89 e5             	mov    %rsp,%rbp
+  803b06:	41 55                	push   %r13
+  803b08:	41 54                	push   %r12
+  803b0a:	53                   	push   %rbx
+  803b0b:	48 83 ec 08          	sub    $0x8,%rsp
+  803b0f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b12:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803b19:	00 00 00 
+  803b1c:	ff d0                	call   *%rax
+  803b1e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b21:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b26:	4c 89 e6             	mov    %r12,%rsi
+  803b29:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b2e:	49 bc c5 14 80 00 00 	movabs $0x8014c5,%r12
+  803b35:	00 00 00 
+  803b38:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b3b:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b3f:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b43:	49 bd d2 3a 80 00 00 	movabs $0x803ad2,%r13
+  803b4a:	00 00 00 
+  803b4d:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b50:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b54:	48 89 de             	mov    %rbx,%rsi
+  803b57:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803b5a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b5f:	48 89 de             	mov    %rbx,%rsi
+  803b62:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b67:	41 ff d4             	call   *%r12
+  803b6a:	48 83 c4 08          	add    $0x8,%rsp
+  803b6e:	5b                   	pop    %rbx
+  803b6f:	41 5c                	pop    %r12
+  803b71:	41 5d                	pop    %r13
+  803b73:	5d                   	pop    %rbp
+  803b74:	c3                   	ret
+
+0000000000803b75 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803b75:	55                   	push   %rbp
+  803b76:	48 89 e5             	mov    %rsp,%rbp
+  803b79:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b7c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b81:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b86:	48 b8 08 14 80 00 00 	movabs $0x801408,%rax
+  803b8d:	00 00 00 
+  803b90:	ff d0                	call   *%rax
+  803b92:	85 c0                	test   %eax,%eax
+  803b94:	0f 94 c0             	sete   %al
+  803b97:	0f b6 c0             	movzbl %al,%eax
+}
+  803b9a:	5d                   	pop    %rbp
+  803b9b:	c3                   	ret
+
+0000000000803b9c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b9c:	55                   	push   %rbp
+  803b9d:	48 89 e5             	mov    %rsp,%rbp
+  803ba0:	41 57                	push   %r15
+  803ba2:	41 56                	push   %r14
+  803ba4:	41 55                	push   %r13
+  803ba6:	41 54                	push   %r12
+  803ba8:	53                   	push   %rbx
+  803ba9:	48 83 ec 38          	sub    $0x38,%rsp
+  803bad:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803bb1:	49 89 f4             	mov    %rsi,%r12
+  803bb4:	49 89 d7             	mov    %rdx,%r15
+  803bb7:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bbb:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803bc2:	00 00 00 
+  803bc5:	ff d0                	call   *%rax
+  803bc7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803bca:	4d 85 ff             	test   %r15,%r15
+  803bcd:	0f 84 f1 00 00 00    	je     803cc4 <devpipe_write+0x128>
+  803bd3:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803bd7:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803bdb:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803bdf:	49 bd 75 3b 80 00 00 	movabs $0x803b75,%r13
+  803be6:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803be9:	49 bf d2 3a 80 00 00 	movabs $0x803ad2,%r15
+  803bf0:	00 00 00 
+  803bf3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803bf7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bfb:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803bff:	8b 73 04             	mov    0x4(%rbx),%esi
+  803c02:	48 63 ce             	movslq %esi,%rcx
+  803c05:	48 63 03             	movslq (%rbx),%rax
+  803c08:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803c0e:	48 39 c1             	cmp    %rax,%rcx
+  803c11:	72 64                	jb     803c77 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c13:	48 89 de             	mov    %rbx,%rsi
+  803c16:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c1a:	41 ff d5             	call   *%r13
+  803c1d:	85 c0                	test   %eax,%eax
+  803c1f:	0f 85 b9 00 00 00    	jne    803cde <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c25:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c29:	4c 89 f7             	mov    %r14,%rdi
+  803c2c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803c2f:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c32:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803c39:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c40:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c46:	8b 03                	mov    (%rbx),%eax
+  803c48:	41 39 c4             	cmp    %eax,%r12d
+  803c4b:	75 b2                	jne    803bff <devpipe_write+0x63>
+  803c4d:	48 89 de             	mov    %rbx,%rsi
+  803c50:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c54:	41 ff d5             	call   *%r13
+  803c57:	85 c0                	test   %eax,%eax
+  803c59:	75 a0                	jne    803bfb <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c5b:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c60:	44 89 e6             	mov    %r12d,%esi
+  803c63:	48 89 df             	mov    %rbx,%rdi
+  803c66:	48 b8 8d 17 80 00 00 	movabs $0x80178d,%rax
+  803c6d:	00 00 00 
+  803c70:	ff d0                	call   *%rax
+  803c72:	e9 7c ff ff ff       	jmp    803bf3 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c77:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803c7b:	41 0f b6 38          	movzbl (%r8),%edi
+  803c7f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c86:	80 80 80 
+  803c89:	48 89 c8             	mov    %rcx,%rax
+  803c8c:	48 f7 e2             	mul    %rdx
+  803c8f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c93:	48 89 d0             	mov    %rdx,%rax
+  803c96:	48 c1 e0 08          	shl    $0x8,%rax
+  803c9a:	48 29 d0             	sub    %rdx,%rax
+  803c9d:	48 c1 e0 04          	shl    $0x4,%rax
+  803ca1:	48 29 c1             	sub    %rax,%rcx
+  803ca4:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803ca9:	83 c6 01             	add    $0x1,%esi
+  803cac:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803caf:	49 83 c0 01          	add    $0x1,%r8
+  803cb3:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803cb7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803cbb:	49 39 c0             	cmp    %rax,%r8
+  803cbe:	0f 85 2f ff ff ff    	jne    803bf3 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803cc4:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803cc8:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ccc:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803cd3:	00 00 00 
+  803cd6:	ff d0                	call   *%rax
+    return n;
+  803cd8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cdc:	eb 05                	jmp    803ce3 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cde:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803ce3:	48 83 c4 38          	add    $0x38,%rsp
+  803ce7:	5b                   	pop    %rbx
+  803ce8:	41 5c                	pop    %r12
+  803cea:	41 5d                	pop    %r13
+  803cec:	41 5e                	pop    %r14
+  803cee:	41 5f                	pop    %r15
+  803cf0:	5d                   	pop    %rbp
+  803cf1:	c3                   	ret
+
+0000000000803cf2 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cf2:	55                   	push   %rbp
+  803cf3:	48 89 e5             	mov    %rsp,%rbp
+  803cf6:	41 57                	push   %r15
+  803cf8:	41 56                	push   %r14
+  803cfa:	41 55                	push   %r13
+  803cfc:	41 54                	push   %r12
+  803cfe:	53                   	push   %rbx
+  803cff:	48 83 ec 28          	sub    $0x28,%rsp
+  803d03:	49 89 fd             	mov    %rdi,%r13
+  803d06:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803d0a:	49 89 d4             	mov    %rdx,%r12
+  803d0d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803d11:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803d18:	00 00 00 
+  803d1b:	ff d0                	call   *%rax
+  803d1d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d20:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803d26:	49 bf 75 3b 80 00 00 	movabs $0x803b75,%r15
+  803d2d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803d30:	4d 85 e4             	test   %r12,%r12
+  803d33:	0f 84 d5 00 00 00    	je     803e0e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d39:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d3d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803d41:	8b 03                	mov    (%rbx),%eax
+  803d43:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803d46:	75 7a                	jne    803dc2 <devpipe_read+0xd0>
+            if (i > 0) {
+  803d48:	4d 85 f6             	test   %r14,%r14
+  803d4b:	75 50                	jne    803d9d <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d4d:	48 89 de             	mov    %rbx,%rsi
+  803d50:	4c 89 ef             	mov    %r13,%rdi
+  803d53:	41 ff d7             	call   *%r15
+  803d56:	85 c0                	test   %eax,%eax
+  803d58:	0f 85 c9 00 00 00    	jne    803e27 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d5e:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803d61:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d68:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803d6e:	8b 43 04             	mov    0x4(%rbx),%eax
+  803d71:	41 39 c4             	cmp    %eax,%r12d
+  803d74:	75 cb                	jne    803d41 <devpipe_read+0x4f>
+  803d76:	48 89 de             	mov    %rbx,%rsi
+  803d79:	4c 89 ef             	mov    %r13,%rdi
+  803d7c:	41 ff d7             	call   *%r15
+  803d7f:	85 c0                	test   %eax,%eax
+  803d81:	75 be                	jne    803d41 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d83:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d88:	44 89 e6             	mov    %r12d,%esi
+  803d8b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d8f:	48 b8 8d 17 80 00 00 	movabs $0x80178d,%rax
+  803d96:	00 00 00 
+  803d99:	ff d0                	call   *%rax
+  803d9b:	eb a4                	jmp    803d41 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d9d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803da1:	48 89 de             	mov    %rbx,%rsi
+  803da4:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803dab:	00 00 00 
+  803dae:	ff d0                	call   *%rax
+                return i;
+  803db0:	4c 89 f0             	mov    %r14,%rax
+}
+  803db3:	48 83 c4 28          	add    $0x28,%rsp
+  803db7:	5b                   	pop    %rbx
+  803db8:	41 5c                	pop    %r12
+  803dba:	41 5d                	pop    %r13
+  803dbc:	41 5e                	pop    %r14
+  803dbe:	41 5f                	pop    %r15
+  803dc0:	5d                   	pop    %rbp
+  803dc1:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803dc2:	48 63 c8             	movslq %eax,%rcx
+  803dc5:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803dcc:	80 80 80 
+  803dcf:	48 89 c8             	mov    %rcx,%rax
+  803dd2:	48 f7 e2             	mul    %rdx
+  803dd5:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803dd9:	48 89 d0             	mov    %rdx,%rax
+  803ddc:	48 c1 e0 08          	shl    $0x8,%rax
+  803de0:	48 29 d0             	sub    %rdx,%rax
+  803de3:	48 c1 e0 04          	shl    $0x4,%rax
+  803de7:	48 89 c2             	mov    %rax,%rdx
+  803dea:	48 89 c8             	mov    %rcx,%rax
+  803ded:	48 29 d0             	sub    %rdx,%rax
+  803df0:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803df5:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803df9:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803dfd:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803e00:	49 83 c6 01          	add    $0x1,%r14
+  803e04:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803e08:	0f 85 2b ff ff ff    	jne    803d39 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803e0e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803e12:	48 89 de             	mov    %rbx,%rsi
+  803e15:	48 b8 d2 3a 80 00 00 	movabs $0x803ad2,%rax
+  803e1c:	00 00 00 
+  803e1f:	ff d0                	call   *%rax
+    return n;
+  803e21:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e25:	eb 8c                	jmp    803db3 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e27:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e2c:	eb 85                	jmp    803db3 <devpipe_read+0xc1>
+
+0000000000803e2e <pipe>:
+pipe(int pfd[2]) {
+  803e2e:	55                   	push   %rbp
+  803e2f:	48 89 e5             	mov    %rsp,%rbp
+  803e32:	41 55                	push   %r13
+  803e34:	41 54                	push   %r12
+  803e36:	53                   	push   %rbx
+  803e37:	48 83 ec 18          	sub    $0x18,%rsp
+  803e3b:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e3e:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e42:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803e49:	00 00 00 
+  803e4c:	ff d0                	call   *%rax
+  803e4e:	89 c3                	mov    %eax,%ebx
+  803e50:	85 c0                	test   %eax,%eax
+  803e52:	0f 88 a0 01 00 00    	js     803ff8 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803e58:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e5d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e62:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e66:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e6b:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  803e72:	00 00 00 
+  803e75:	ff d0                	call   *%rax
+  803e77:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e79:	85 c0                	test   %eax,%eax
+  803e7b:	0f 88 77 01 00 00    	js     803ff8 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e81:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803e85:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  803e8c:	00 00 00 
+  803e8f:	ff d0                	call   *%rax
+  803e91:	89 c3                	mov    %eax,%ebx
+  803e93:	85 c0                	test   %eax,%eax
+  803e95:	0f 88 43 01 00 00    	js     803fde <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e9b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ea0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea5:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ea9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eae:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  803eb5:	00 00 00 
+  803eb8:	ff d0                	call   *%rax
+  803eba:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ebc:	85 c0                	test   %eax,%eax
+  803ebe:	0f 88 1a 01 00 00    	js     803fde <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ec4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec8:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803ecf:	00 00 00 
+  803ed2:	ff d0                	call   *%rax
+  803ed4:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ed7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803edc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ee1:	48 89 c6             	mov    %rax,%rsi
+  803ee4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ee9:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+  803ef5:	89 c3                	mov    %eax,%ebx
+  803ef7:	85 c0                	test   %eax,%eax
+  803ef9:	0f 88 c5 00 00 00    	js     803fc4 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803eff:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f03:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803f0a:	00 00 00 
+  803f0d:	ff d0                	call   *%rax
+  803f0f:	48 89 c1             	mov    %rax,%rcx
+  803f12:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803f18:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f23:	4c 89 ee             	mov    %r13,%rsi
+  803f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f2b:	48 b8 75 14 80 00 00 	movabs $0x801475,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+  803f37:	89 c3                	mov    %eax,%ebx
+  803f39:	85 c0                	test   %eax,%eax
+  803f3b:	78 6e                	js     803fab <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f3d:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f42:	4c 89 ef             	mov    %r13,%rdi
+  803f45:	48 b8 e4 13 80 00 00 	movabs $0x8013e4,%rax
+  803f4c:	00 00 00 
+  803f4f:	ff d0                	call   *%rax
+  803f51:	83 f8 02             	cmp    $0x2,%eax
+  803f54:	0f 85 ab 00 00 00    	jne    804005 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803f5a:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803f61:	00 00 
+  803f63:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f67:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803f69:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f6d:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803f74:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f78:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803f7a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f7e:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803f85:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f89:	48 bb 72 19 80 00 00 	movabs $0x801972,%rbx
+  803f90:	00 00 00 
+  803f93:	ff d3                	call   *%rbx
+  803f95:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f99:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f9d:	ff d3                	call   *%rbx
+  803f9f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803fa4:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803fa9:	eb 4d                	jmp    803ff8 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803fab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fb0:	4c 89 ee             	mov    %r13,%rsi
+  803fb3:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fb8:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803fc4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc9:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fcd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd2:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803fd9:	00 00 00 
+  803fdc:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803fde:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fe3:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fe7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fec:	48 b8 c5 14 80 00 00 	movabs $0x8014c5,%rax
+  803ff3:	00 00 00 
+  803ff6:	ff d0                	call   *%rax
+}
+  803ff8:	89 d8                	mov    %ebx,%eax
+  803ffa:	48 83 c4 18          	add    $0x18,%rsp
+  803ffe:	5b                   	pop    %rbx
+  803fff:	41 5c                	pop    %r12
+  804001:	41 5d                	pop    %r13
+  804003:	5d                   	pop    %rbp
+  804004:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804005:	48 b9 d0 52 80 00 00 	movabs $0x8052d0,%rcx
+  80400c:	00 00 00 
+  80400f:	48 ba a7 52 80 00 00 	movabs $0x8052a7,%rdx
+  804016:	00 00 00 
+  804019:	be 50 00 00 00       	mov    $0x50,%esi
+  80401e:	48 bf bc 52 80 00 00 	movabs $0x8052bc,%rdi
+  804025:	00 00 00 
+  804028:	b8 00 00 00 00       	mov    $0x0,%eax
+  80402d:	49 b8 4b 04 80 00 00 	movabs $0x80044b,%r8
+  804034:	00 00 00 
+  804037:	41 ff d0             	call   *%r8
+
+000000000080403a <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80403a:	55                   	push   %rbp
+  80403b:	48 89 e5             	mov    %rsp,%rbp
+  80403e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804042:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804046:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  80404d:	00 00 00 
+  804050:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804052:	85 c0                	test   %eax,%eax
+  804054:	78 23                	js     804079 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804056:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80405a:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  804061:	00 00 00 
+  804064:	ff d0                	call   *%rax
+  804066:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804069:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80406d:	48 b8 75 3b 80 00 00 	movabs $0x803b75,%rax
+  804074:	00 00 00 
+  804077:	ff d0                	call   *%rax
+}
+  804079:	c9                   	leave
+  80407a:	c3                   	ret
+
+000000000080407b <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80407b:	48 89 f8             	mov    %rdi,%rax
+  80407e:	48 c1 e8 27          	shr    $0x27,%rax
+  804082:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804089:	01 00 00 
+  80408c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804090:	f6 c2 01             	test   $0x1,%dl
+  804093:	74 6d                	je     804102 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804095:	48 89 f8             	mov    %rdi,%rax
+  804098:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80409c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040a3:	01 00 00 
+  8040a6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040aa:	f6 c2 01             	test   $0x1,%dl
+  8040ad:	74 62                	je     804111 <get_uvpt_entry+0x96>
+  8040af:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040b6:	01 00 00 
+  8040b9:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040bd:	f6 c2 80             	test   $0x80,%dl
+  8040c0:	75 4f                	jne    804111 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8040c2:	48 89 f8             	mov    %rdi,%rax
+  8040c5:	48 c1 e8 15          	shr    $0x15,%rax
+  8040c9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040d0:	01 00 00 
+  8040d3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040d7:	f6 c2 01             	test   $0x1,%dl
+  8040da:	74 44                	je     804120 <get_uvpt_entry+0xa5>
+  8040dc:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040e3:	01 00 00 
+  8040e6:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040ea:	f6 c2 80             	test   $0x80,%dl
+  8040ed:	75 31                	jne    804120 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8040ef:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8040f3:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8040fa:	01 00 00 
+  8040fd:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804101:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804102:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804109:	01 00 00 
+  80410c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804110:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804111:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804118:	01 00 00 
+  80411b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80411f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804120:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804127:	01 00 00 
+  80412a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80412e:	c3                   	ret
+
+000000000080412f <get_prot>:
+
+int
+get_prot(void *va) {
+  80412f:	55                   	push   %rbp
+  804130:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804133:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  80413a:	00 00 00 
+  80413d:	ff d0                	call   *%rax
+  80413f:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804142:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804147:	89 c1                	mov    %eax,%ecx
+  804149:	83 c9 04             	or     $0x4,%ecx
+  80414c:	f6 c2 01             	test   $0x1,%dl
+  80414f:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804152:	89 c1                	mov    %eax,%ecx
+  804154:	83 c9 02             	or     $0x2,%ecx
+  804157:	f6 c2 02             	test   $0x2,%dl
+  80415a:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80415d:	89 c1                	mov    %eax,%ecx
+  80415f:	83 c9 01             	or     $0x1,%ecx
+  804162:	48 85 d2             	test   %rdx,%rdx
+  804165:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804168:	89 c1                	mov    %eax,%ecx
+  80416a:	83 c9 40             	or     $0x40,%ecx
+  80416d:	f6 c6 04             	test   $0x4,%dh
+  804170:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804173:	5d                   	pop    %rbp
+  804174:	c3                   	ret
+
+0000000000804175 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804175:	55                   	push   %rbp
+  804176:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804179:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  804180:	00 00 00 
+  804183:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804185:	48 c1 e8 06          	shr    $0x6,%rax
+  804189:	83 e0 01             	and    $0x1,%eax
+}
+  80418c:	5d                   	pop    %rbp
+  80418d:	c3                   	ret
+
+000000000080418e <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80418e:	55                   	push   %rbp
+  80418f:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804192:	48 b8 7b 40 80 00 00 	movabs $0x80407b,%rax
+  804199:	00 00 00 
+  80419c:	ff d0                	call   *%rax
+  80419e:	83 e0 01             	and    $0x1,%eax
+}
+  8041a1:	5d                   	pop    %rbp
+  8041a2:	c3                   	ret
+
+00000000008041a3 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8041a3:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8041aa:	01 00 00 
+  8041ad:	a8 01                	test   $0x1,%al
+  8041af:	75 06                	jne    8041b7 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8041b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041b6:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8041b7:	55                   	push   %rbp
+  8041b8:	48 89 e5             	mov    %rsp,%rbp
+  8041bb:	41 57                	push   %r15
+  8041bd:	41 56                	push   %r14
+  8041bf:	41 55                	push   %r13
+  8041c1:	41 54                	push   %r12
+  8041c3:	53                   	push   %rbx
+  8041c4:	48 83 ec 28          	sub    $0x28,%rsp
+  8041c8:	49 89 fe             	mov    %rdi,%r14
+  8041cb:	49 89 f7             	mov    %rsi,%r15
+  8041ce:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8041d5:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041d6:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8041dd:	01 00 00 
+  8041e0:	e9 ae 00 00 00       	jmp    804293 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041e5:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041ec:	49 83 ec 01          	sub    $0x1,%r12
+  8041f0:	74 2d                	je     80421f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041f2:	48 89 d8             	mov    %rbx,%rax
+  8041f5:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041f9:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8041fe:	f6 c2 01             	test   $0x1,%dl
+  804201:	74 e2                	je     8041e5 <foreach_shared_region+0x42>
+  804203:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804208:	f6 c4 04             	test   $0x4,%ah
+  80420b:	74 d8                	je     8041e5 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80420d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804214:	4c 89 fa             	mov    %r15,%rdx
+  804217:	48 89 df             	mov    %rbx,%rdi
+  80421a:	41 ff d6             	call   *%r14
+  80421d:	eb c6                	jmp    8041e5 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80421f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804226:	00 
+  804227:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80422c:	74 4a                	je     804278 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80422e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804232:	48 c1 e8 15          	shr    $0x15,%rax
+  804236:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80423d:	01 00 00 
+  804240:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804244:	a8 01                	test   $0x1,%al
+  804246:	74 d7                	je     80421f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804248:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80424c:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804253:	48 39 c3             	cmp    %rax,%rbx
+  804256:	73 c7                	jae    80421f <foreach_shared_region+0x7c>
+  804258:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80425f:	48 39 d0             	cmp    %rdx,%rax
+  804262:	4d 19 e4             	sbb    %r12,%r12
+  804265:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80426c:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804273:	e9 7a ff ff ff       	jmp    8041f2 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804278:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80427f:	40 
+  804280:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804284:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80428b:	00 00 00 
+  80428e:	48 39 c1             	cmp    %rax,%rcx
+  804291:	74 50                	je     8042e3 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804293:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804297:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80429b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8042a2:	01 00 00 
+  8042a5:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8042a9:	a8 01                	test   $0x1,%al
+  8042ab:	74 cb                	je     804278 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8042ad:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8042b1:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8042b8:	48 39 c1             	cmp    %rax,%rcx
+  8042bb:	73 bb                	jae    804278 <foreach_shared_region+0xd5>
+  8042bd:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8042c4:	48 39 d0             	cmp    %rdx,%rax
+  8042c7:	48 19 c0             	sbb    %rax,%rax
+  8042ca:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8042d0:	48 05 00 02 00 00    	add    $0x200,%rax
+  8042d6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042da:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8042de:	e9 4b ff ff ff       	jmp    80422e <foreach_shared_region+0x8b>
+  8042e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042e8:	48 83 c4 28          	add    $0x28,%rsp
+  8042ec:	5b                   	pop    %rbx
+  8042ed:	41 5c                	pop    %r12
+  8042ef:	41 5d                	pop    %r13
+  8042f1:	41 5e                	pop    %r14
+  8042f3:	41 5f                	pop    %r15
+  8042f5:	5d                   	pop    %rbp
+  8042f6:	c3                   	ret
+
+00000000008042f7 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8042f7:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8042fd:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804304:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80430b:	c3                   	ret
+
+000000000080430c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80430c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80430f:	8b 17                	mov    (%rdi),%edx
+  804311:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804313:	83 f8 0f             	cmp    $0xf,%eax
+  804316:	77 13                	ja     80432b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804318:	8b 47 40             	mov    0x40(%rdi),%eax
+  80431b:	83 e0 0f             	and    $0xf,%eax
+  80431e:	48 c1 e0 09          	shl    $0x9,%rax
+  804322:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804329:	00 
+  80432a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80432b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804330:	c3                   	ret
+
+0000000000804331 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804331:	8b 47 40             	mov    0x40(%rdi),%eax
+  804334:	83 c0 01             	add    $0x1,%eax
+  804337:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80433a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804340:	8b 57 04             	mov    0x4(%rdi),%edx
+  804343:	b8 00 00 00 00       	mov    $0x0,%eax
+  804348:	85 d2                	test   %edx,%edx
+  80434a:	75 04                	jne    804350 <chan_publish+0x1f>
+  80434c:	83 e0 01             	and    $0x1,%eax
+}
+  80434f:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804350:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804353:	85 c0                	test   %eax,%eax
+  804355:	0f 95 c0             	setne  %al
+  804358:	0f b6 c0             	movzbl %al,%eax
+  80435b:	eb ef                	jmp    80434c <chan_publish+0x1b>
+
+000000000080435d <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80435d:	8b 47 40             	mov    0x40(%rdi),%eax
+  804360:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804362:	29 d0                	sub    %edx,%eax
+  804364:	83 e8 01             	sub    $0x1,%eax
+  804367:	83 f8 0f             	cmp    $0xf,%eax
+  80436a:	77 12                	ja     80437e <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80436c:	8b 07                	mov    (%rdi),%eax
+  80436e:	83 e0 0f             	and    $0xf,%eax
+  804371:	48 c1 e0 09          	shl    $0x9,%rax
+  804375:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80437c:	00 
+  80437d:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80437e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804383:	c3                   	ret
+
+0000000000804384 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804384:	8b 07                	mov    (%rdi),%eax
+  804386:	83 c0 01             	add    $0x1,%eax
+  804389:	89 07                	mov    %eax,(%rdi)
+}
+  80438b:	c3                   	ret
+
+000000000080438c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80438c:	55                   	push   %rbp
+  80438d:	48 89 e5             	mov    %rsp,%rbp
+  804390:	53                   	push   %rbx
+  804391:	48 83 ec 08          	sub    $0x8,%rsp
+  804395:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804398:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80439f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8043a5:	48 b8 5d 43 80 00 00 	movabs $0x80435d,%rax
+  8043ac:	00 00 00 
+  8043af:	ff d0                	call   *%rax
+  8043b1:	48 85 c0             	test   %rax,%rax
+  8043b4:	74 12                	je     8043c8 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8043b6:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8043bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043c2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043c6:	c9                   	leave
+  8043c7:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8043c8:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043cd:	eb f3                	jmp    8043c2 <chan_arm+0x36>
+
+00000000008043cf <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8043cf:	55                   	push   %rbp
+  8043d0:	48 89 e5             	mov    %rsp,%rbp
+  8043d3:	41 56                	push   %r14
+  8043d5:	41 55                	push   %r13
+  8043d7:	41 54                	push   %r12
+  8043d9:	53                   	push   %rbx
+  8043da:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8043dd:	49 bc 8c 43 80 00 00 	movabs $0x80438c,%r12
+  8043e4:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043e7:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8043eb:	49 bd 8d 17 80 00 00 	movabs $0x80178d,%r13
+  8043f2:	00 00 00 
+    while (chan_arm(r))
+  8043f5:	eb 0d                	jmp    804404 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043f7:	8b 33                	mov    (%rbx),%esi
+  8043f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043fe:	4c 89 f7             	mov    %r14,%rdi
+  804401:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804404:	48 89 df             	mov    %rbx,%rdi
+  804407:	41 ff d4             	call   *%r12
+  80440a:	84 c0                	test   %al,%al
+  80440c:	75 e9                	jne    8043f7 <chan_wait+0x28>
+}
+  80440e:	5b                   	pop    %rbx
+  80440f:	41 5c                	pop    %r12
+  804411:	41 5d                	pop    %r13
+  804413:	41 5e                	pop    %r14
+  804415:	5d                   	pop    %rbp
+  804416:	c3                   	ret
+
+0000000000804417 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804417:	55                   	push   %rbp
+  804418:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80441b:	48 83 c7 40          	add    $0x40,%rdi
+  80441f:	be 01 00 00 00       	mov    $0x1,%esi
+  804424:	48 b8 ab 17 80 00 00 	movabs $0x8017ab,%rax
+  80442b:	00 00 00 
+  80442e:	ff d0                	call   *%rax
+}
+  804430:	5d                   	pop    %rbp
+  804431:	c3                   	ret
+
+0000000000804432 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804432:	b8 00 00 00 00       	mov    $0x0,%eax
+  804437:	c3                   	ret
+
+0000000000804438 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804438:	55                   	push   %rbp
+  804439:	48 89 e5             	mov    %rsp,%rbp
+  80443c:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80443f:	48 be f4 52 80 00 00 	movabs $0x8052f4,%rsi
+  804446:	00 00 00 
+  804449:	48 b8 c0 0e 80 00 00 	movabs $0x800ec0,%rax
+  804450:	00 00 00 
+  804453:	ff d0                	call   *%rax
+    return 0;
+}
+  804455:	b8 00 00 00 00       	mov    $0x0,%eax
+  80445a:	5d                   	pop    %rbp
+  80445b:	c3                   	ret
+
+000000000080445c <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80445c:	55                   	push   %rbp
+  80445d:	48 89 e5             	mov    %rsp,%rbp
+  804460:	41 57                	push   %r15
+  804462:	41 56                	push   %r14
+  804464:	41 55                	push   %r13
+  804466:	41 54                	push   %r12
+  804468:	53                   	push   %rbx
+  804469:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804470:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804477:	48 85 d2             	test   %rdx,%rdx
+  80447a:	74 7a                	je     8044f6 <devcons_write+0x9a>
+  80447c:	49 89 d6             	mov    %rdx,%r14
+  80447f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804485:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80448a:	49 bf ba 10 80 00 00 	movabs $0x8010ba,%r15
+  804491:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804494:	4c 89 f3             	mov    %r14,%rbx
+  804497:	48 29 f3             	sub    %rsi,%rbx
+  80449a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80449f:	48 39 c3             	cmp    %rax,%rbx
+  8044a2:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8044a6:	4c 63 eb             	movslq %ebx,%r13
+  8044a9:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8044b0:	48 01 c6             	add    %rax,%rsi
+  8044b3:	4c 89 ea             	mov    %r13,%rdx
+  8044b6:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044bd:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8044c0:	4c 89 ee             	mov    %r13,%rsi
+  8044c3:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044ca:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  8044d1:	00 00 00 
+  8044d4:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8044d6:	41 01 dc             	add    %ebx,%r12d
+  8044d9:	49 63 f4             	movslq %r12d,%rsi
+  8044dc:	4c 39 f6             	cmp    %r14,%rsi
+  8044df:	72 b3                	jb     804494 <devcons_write+0x38>
+    return res;
+  8044e1:	49 63 c4             	movslq %r12d,%rax
+}
+  8044e4:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8044eb:	5b                   	pop    %rbx
+  8044ec:	41 5c                	pop    %r12
+  8044ee:	41 5d                	pop    %r13
+  8044f0:	41 5e                	pop    %r14
+  8044f2:	41 5f                	pop    %r15
+  8044f4:	5d                   	pop    %rbp
+  8044f5:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8044f6:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044fc:	eb e3                	jmp    8044e1 <devcons_write+0x85>
+
+00000000008044fe <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044fe:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804501:	ba 00 00 00 00       	mov    $0x0,%edx
+  804506:	48 85 c0             	test   %rax,%rax
+  804509:	74 55                	je     804560 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80450b:	55                   	push   %rbp
+  80450c:	48 89 e5             	mov    %rsp,%rbp
+  80450f:	41 55                	push   %r13
+  804511:	41 54                	push   %r12
+  804513:	53                   	push   %rbx
+  804514:	48 83 ec 08          	sub    $0x8,%rsp
+  804518:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80451b:	48 bb 06 13 80 00 00 	movabs $0x801306,%rbx
+  804522:	00 00 00 
+  804525:	49 bc bb 13 80 00 00 	movabs $0x8013bb,%r12
+  80452c:	00 00 00 
+  80452f:	eb 03                	jmp    804534 <devcons_read+0x36>
+  804531:	41 ff d4             	call   *%r12
+  804534:	ff d3                	call   *%rbx
+  804536:	85 c0                	test   %eax,%eax
+  804538:	74 f7                	je     804531 <devcons_read+0x33>
+    if (c < 0) return c;
+  80453a:	48 63 d0             	movslq %eax,%rdx
+  80453d:	78 13                	js     804552 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80453f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804544:	83 f8 04             	cmp    $0x4,%eax
+  804547:	74 09                	je     804552 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804549:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80454d:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804552:	48 89 d0             	mov    %rdx,%rax
+  804555:	48 83 c4 08          	add    $0x8,%rsp
+  804559:	5b                   	pop    %rbx
+  80455a:	41 5c                	pop    %r12
+  80455c:	41 5d                	pop    %r13
+  80455e:	5d                   	pop    %rbp
+  80455f:	c3                   	ret
+  804560:	48 89 d0             	mov    %rdx,%rax
+  804563:	c3                   	ret
+
+0000000000804564 <cputchar>:
+cputchar(int ch) {
+  804564:	55                   	push   %rbp
+  804565:	48 89 e5             	mov    %rsp,%rbp
+  804568:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80456c:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804570:	be 01 00 00 00       	mov    $0x1,%esi
+  804575:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804579:	48 b8 e7 12 80 00 00 	movabs $0x8012e7,%rax
+  804580:	00 00 00 
+  804583:	ff d0                	call   *%rax
+}
+  804585:	c9                   	leave
+  804586:	c3                   	ret
+
+0000000000804587 <getchar>:
+getchar(void) {
+  804587:	55                   	push   %rbp
+  804588:	48 89 e5             	mov    %rsp,%rbp
+  80458b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80458f:	ba 01 00 00 00       	mov    $0x1,%edx
+  804594:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804598:	bf 00 00 00 00       	mov    $0x0,%edi
+  80459d:	48 b8 e3 1c 80 00 00 	movabs $0x801ce3,%rax
+  8045a4:	00 00 00 
+  8045a7:	ff d0                	call   *%rax
+  8045a9:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8045ab:	85 c0                	test   %eax,%eax
+  8045ad:	78 06                	js     8045b5 <getchar+0x2e>
+  8045af:	74 08                	je     8045b9 <getchar+0x32>
+  8045b1:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8045b5:	89 d0                	mov    %edx,%eax
+  8045b7:	c9                   	leave
+  8045b8:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8045b9:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8045be:	eb f5                	jmp    8045b5 <getchar+0x2e>
+
+00000000008045c0 <iscons>:
+iscons(int fdnum) {
+  8045c0:	55                   	push   %rbp
+  8045c1:	48 89 e5             	mov    %rsp,%rbp
+  8045c4:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045c8:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045cc:	48 b8 00 1a 80 00 00 	movabs $0x801a00,%rax
+  8045d3:	00 00 00 
+  8045d6:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045d8:	85 c0                	test   %eax,%eax
+  8045da:	78 18                	js     8045f4 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8045dc:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045e0:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8045e7:	00 00 00 
+  8045ea:	8b 00                	mov    (%rax),%eax
+  8045ec:	39 02                	cmp    %eax,(%rdx)
+  8045ee:	0f 94 c0             	sete   %al
+  8045f1:	0f b6 c0             	movzbl %al,%eax
+}
+  8045f4:	c9                   	leave
+  8045f5:	c3                   	ret
+
+00000000008045f6 <opencons>:
+opencons(void) {
+  8045f6:	55                   	push   %rbp
+  8045f7:	48 89 e5             	mov    %rsp,%rbp
+  8045fa:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8045fe:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804602:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	85 c0                	test   %eax,%eax
+  804610:	78 49                	js     80465b <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804612:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804617:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80461c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804620:	bf 00 00 00 00       	mov    $0x0,%edi
+  804625:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  80462c:	00 00 00 
+  80462f:	ff d0                	call   *%rax
+  804631:	85 c0                	test   %eax,%eax
+  804633:	78 26                	js     80465b <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804635:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804639:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804640:	00 00 
+  804642:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804644:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804648:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80464f:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  804656:	00 00 00 
+  804659:	ff d0                	call   *%rax
+}
+  80465b:	c9                   	leave
+  80465c:	c3                   	ret
+
+000000000080465d <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80465d:	55                   	push   %rbp
+  80465e:	48 89 e5             	mov    %rsp,%rbp
+  804661:	41 56                	push   %r14
+  804663:	41 55                	push   %r13
+  804665:	41 54                	push   %r12
+  804667:	53                   	push   %rbx
+  804668:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80466b:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804672:	00 00 00 
+  804675:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804679:	74 27                	je     8046a2 <_handle_vectored_pagefault+0x45>
+  80467b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804680:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804687:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80468a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80468d:	4c 89 e7             	mov    %r12,%rdi
+  804690:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804695:	84 c0                	test   %al,%al
+  804697:	75 45                	jne    8046de <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804699:	48 83 c3 01          	add    $0x1,%rbx
+  80469d:	49 3b 1e             	cmp    (%r14),%rbx
+  8046a0:	72 eb                	jb     80468d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8046a2:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8046a9:	00 
+  8046aa:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8046af:	4d 8b 04 24          	mov    (%r12),%r8
+  8046b3:	48 ba 00 53 80 00 00 	movabs $0x805300,%rdx
+  8046ba:	00 00 00 
+  8046bd:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8046c2:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  8046c9:	00 00 00 
+  8046cc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046d1:	49 ba 4b 04 80 00 00 	movabs $0x80044b,%r10
+  8046d8:	00 00 00 
+  8046db:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046de:	5b                   	pop    %rbx
+  8046df:	41 5c                	pop    %r12
+  8046e1:	41 5d                	pop    %r13
+  8046e3:	41 5e                	pop    %r14
+  8046e5:	5d                   	pop    %rbp
+  8046e6:	c3                   	ret
+
+00000000008046e7 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046e7:	55                   	push   %rbp
+  8046e8:	48 89 e5             	mov    %rsp,%rbp
+  8046eb:	53                   	push   %rbx
+  8046ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8046f0:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046f3:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046fa:	00 00 00 
+  8046fd:	80 38 00             	cmpb   $0x0,(%rax)
+  804700:	0f 84 84 00 00 00    	je     80478a <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804706:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80470d:	00 00 00 
+  804710:	48 8b 10             	mov    (%rax),%rdx
+  804713:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804718:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80471f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804722:	48 85 d2             	test   %rdx,%rdx
+  804725:	74 19                	je     804740 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804727:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80472b:	0f 84 e8 00 00 00    	je     804819 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804731:	48 83 c0 01          	add    $0x1,%rax
+  804735:	48 39 d0             	cmp    %rdx,%rax
+  804738:	75 ed                	jne    804727 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80473a:	48 83 fa 08          	cmp    $0x8,%rdx
+  80473e:	74 1c                	je     80475c <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804740:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804744:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80474b:	00 00 00 
+  80474e:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804755:	00 00 00 
+  804758:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80475c:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  804763:	00 00 00 
+  804766:	ff d0                	call   *%rax
+  804768:	89 c7                	mov    %eax,%edi
+  80476a:	48 be df 48 80 00 00 	movabs $0x8048df,%rsi
+  804771:	00 00 00 
+  804774:	48 b8 dd 15 80 00 00 	movabs $0x8015dd,%rax
+  80477b:	00 00 00 
+  80477e:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804780:	85 c0                	test   %eax,%eax
+  804782:	78 68                	js     8047ec <add_pgfault_handler+0x105>
+    return res;
+}
+  804784:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804788:	c9                   	leave
+  804789:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80478a:	48 b8 92 13 80 00 00 	movabs $0x801392,%rax
+  804791:	00 00 00 
+  804794:	ff d0                	call   *%rax
+  804796:	89 c7                	mov    %eax,%edi
+  804798:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80479d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8047a2:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8047a9:	00 00 00 
+  8047ac:	48 b8 1f 14 80 00 00 	movabs $0x80141f,%rax
+  8047b3:	00 00 00 
+  8047b6:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8047b8:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8047bf:	00 00 00 
+  8047c2:	48 8b 02             	mov    (%rdx),%rax
+  8047c5:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047c9:	48 89 0a             	mov    %rcx,(%rdx)
+  8047cc:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047d3:	00 00 00 
+  8047d6:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047da:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047e1:	00 00 00 
+  8047e4:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047e7:	e9 70 ff ff ff       	jmp    80475c <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047ec:	89 c1                	mov    %eax,%ecx
+  8047ee:	48 ba 3e 53 80 00 00 	movabs $0x80533e,%rdx
+  8047f5:	00 00 00 
+  8047f8:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047fd:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  804804:	00 00 00 
+  804807:	b8 00 00 00 00       	mov    $0x0,%eax
+  80480c:	49 b8 4b 04 80 00 00 	movabs $0x80044b,%r8
+  804813:	00 00 00 
+  804816:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804819:	b8 00 00 00 00       	mov    $0x0,%eax
+  80481e:	e9 61 ff ff ff       	jmp    804784 <add_pgfault_handler+0x9d>
+
+0000000000804823 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804823:	55                   	push   %rbp
+  804824:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804827:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80482e:	00 00 00 
+  804831:	80 38 00             	cmpb   $0x0,(%rax)
+  804834:	74 33                	je     804869 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804836:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80483d:	00 00 00 
+  804840:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804845:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80484c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80484f:	48 85 c0             	test   %rax,%rax
+  804852:	0f 84 85 00 00 00    	je     8048dd <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804858:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80485c:	74 40                	je     80489e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80485e:	48 83 c1 01          	add    $0x1,%rcx
+  804862:	48 39 c1             	cmp    %rax,%rcx
+  804865:	75 f1                	jne    804858 <remove_pgfault_handler+0x35>
+  804867:	eb 74                	jmp    8048dd <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804869:	48 b9 56 53 80 00 00 	movabs $0x805356,%rcx
+  804870:	00 00 00 
+  804873:	48 ba a7 52 80 00 00 	movabs $0x8052a7,%rdx
+  80487a:	00 00 00 
+  80487d:	be 43 00 00 00       	mov    $0x43,%esi
+  804882:	48 bf 30 53 80 00 00 	movabs $0x805330,%rdi
+  804889:	00 00 00 
+  80488c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804891:	49 b8 4b 04 80 00 00 	movabs $0x80044b,%r8
+  804898:	00 00 00 
+  80489b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80489e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8048a5:	00 
+  8048a6:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8048aa:	48 29 ca             	sub    %rcx,%rdx
+  8048ad:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8048b4:	00 00 00 
+  8048b7:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8048bb:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8048c0:	48 89 ce             	mov    %rcx,%rsi
+  8048c3:	48 b8 ba 10 80 00 00 	movabs $0x8010ba,%rax
+  8048ca:	00 00 00 
+  8048cd:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048cf:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048d6:	00 00 00 
+  8048d9:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048dd:	5d                   	pop    %rbp
+  8048de:	c3                   	ret
+
+00000000008048df <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048df:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048e2:	48 b8 5d 46 80 00 00 	movabs $0x80465d,%rax
+  8048e9:	00 00 00 
+    call *%rax
+  8048ec:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048ee:	41 5f                	pop    %r15
+	popq %r15
+  8048f0:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048f2:	41 5f                	pop    %r15
+	popq %r14
+  8048f4:	41 5e                	pop    %r14
+	popq %r13
+  8048f6:	41 5d                	pop    %r13
+	popq %r12
+  8048f8:	41 5c                	pop    %r12
+	popq %r11
+  8048fa:	41 5b                	pop    %r11
+	popq %r10
+  8048fc:	41 5a                	pop    %r10
+	popq %r9
+  8048fe:	41 59                	pop    %r9
+	popq %r8
+  804900:	41 58                	pop    %r8
+	popq %rsi
+  804902:	5e                   	pop    %rsi
+	popq %rdi
+  804903:	5f                   	pop    %rdi
+	popq %rbp
+  804904:	5d                   	pop    %rbp
+	popq %rdx
+  804905:	5a                   	pop    %rdx
+	popq %rcx
+  804906:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804907:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80490c:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804911:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804915:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804918:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80491d:	5b                   	pop    %rbx
+	popq %rax
+  80491e:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80491f:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804923:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804924:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804929:	c3                   	ret
+
+000000000080492a <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80492a:	55                   	push   %rbp
+  80492b:	48 89 e5             	mov    %rsp,%rbp
+  80492e:	41 55                	push   %r13
+  804930:	41 54                	push   %r12
+  804932:	53                   	push   %rbx
+  804933:	48 83 ec 08          	sub    $0x8,%rsp
+  804937:	49 89 fd             	mov    %rdi,%r13
+  80493a:	48 89 f7             	mov    %rsi,%rdi
+  80493d:	48 89 d3             	mov    %rdx,%rbx
+  804940:	49 89 cc             	mov    %rcx,%r12
+  804943:	4c 89 c2             	mov    %r8,%rdx
+  804946:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804949:	48 85 f6             	test   %rsi,%rsi
+  80494c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804953:	00 00 00 
+  804956:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80495a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80495f:	48 85 db             	test   %rbx,%rbx
+  804962:	74 03                	je     804967 <ipc_recv_futex+0x3d>
+  804964:	48 8b 33             	mov    (%rbx),%rsi
+  804967:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80496b:	48 b8 69 16 80 00 00 	movabs $0x801669,%rax
+  804972:	00 00 00 
+  804975:	ff d0                	call   *%rax
+    if (res < 0) {
+  804977:	85 c0                	test   %eax,%eax
+  804979:	78 75                	js     8049f0 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80497b:	4d 85 ed             	test   %r13,%r13
+  80497e:	74 14                	je     804994 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804980:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804987:	00 00 00 
+  80498a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804990:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804994:	4d 85 e4             	test   %r12,%r12
+  804997:	74 14                	je     8049ad <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  804999:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049a0:	00 00 00 
+  8049a3:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8049a9:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8049ad:	48 85 db             	test   %rbx,%rbx
+  8049b0:	74 23                	je     8049d5 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8049b2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049b9:	00 00 00 
+  8049bc:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8049c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049c7:	85 c9                	test   %ecx,%ecx
+  8049c9:	74 07                	je     8049d2 <ipc_recv_futex+0xa8>
+  8049cb:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8049d2:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8049d5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049dc:	00 00 00 
+  8049df:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8049e5:	48 83 c4 08          	add    $0x8,%rsp
+  8049e9:	5b                   	pop    %rbx
+  8049ea:	41 5c                	pop    %r12
+  8049ec:	41 5d                	pop    %r13
+  8049ee:	5d                   	pop    %rbp
+  8049ef:	c3                   	ret
+        if (from_env_store != NULL) {
+  8049f0:	4d 85 ed             	test   %r13,%r13
+  8049f3:	74 08                	je     8049fd <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8049f5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8049fc:	00 
+        if (perm_store != NULL) {
+  8049fd:	4d 85 e4             	test   %r12,%r12
+  804a00:	74 08                	je     804a0a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804a02:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804a09:	00 
+        if (size != NULL) {
+  804a0a:	48 85 db             	test   %rbx,%rbx
+  804a0d:	74 d6                	je     8049e5 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804a0f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804a16:	eb cd                	jmp    8049e5 <ipc_recv_futex+0xbb>
+
+0000000000804a18 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804a18:	55                   	push   %rbp
+  804a19:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804a1c:	48 83 ec 08          	sub    $0x8,%rsp
+  804a20:	6a 00                	push   $0x0
+  804a22:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a28:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a2e:	48 b8 2a 49 80 00 00 	movabs $0x80492a,%rax
+  804a35:	00 00 00 
+  804a38:	ff d0                	call   *%rax
+}
+  804a3a:	c9                   	leave
+  804a3b:	c3                   	ret
+
+0000000000804a3c <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804a3c:	55                   	push   %rbp
+  804a3d:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804a40:	48 85 d2             	test   %rdx,%rdx
+  804a43:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a4a:	00 00 00 
+  804a4d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804a51:	89 f6                	mov    %esi,%esi
+  804a53:	48 b8 52 16 80 00 00 	movabs $0x801652,%rax
+  804a5a:	00 00 00 
+  804a5d:	ff d0                	call   *%rax
+    if (res < 0) {
+  804a5f:	85 c0                	test   %eax,%eax
+  804a61:	78 02                	js     804a65 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804a63:	5d                   	pop    %rbp
+  804a64:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804a65:	89 c1                	mov    %eax,%ecx
+  804a67:	48 ba 70 53 80 00 00 	movabs $0x805370,%rdx
+  804a6e:	00 00 00 
+  804a71:	be 50 00 00 00       	mov    $0x50,%esi
+  804a76:	48 bf 84 53 80 00 00 	movabs $0x805384,%rdi
+  804a7d:	00 00 00 
+  804a80:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a85:	49 b8 4b 04 80 00 00 	movabs $0x80044b,%r8
+  804a8c:	00 00 00 
+  804a8f:	41 ff d0             	call   *%r8
+
+0000000000804a92 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804a92:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804a97:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804a9e:	00 00 00 
+  804aa1:	48 89 d0             	mov    %rdx,%rax
+  804aa4:	48 c1 e0 04          	shl    $0x4,%rax
+  804aa8:	48 29 d0             	sub    %rdx,%rax
+  804aab:	48 c1 e0 05          	shl    $0x5,%rax
+  804aaf:	48 01 c8             	add    %rcx,%rax
+  804ab2:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804ab8:	39 f8                	cmp    %edi,%eax
+  804aba:	74 13                	je     804acf <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804abc:	48 83 c2 01          	add    $0x1,%rdx
+  804ac0:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804ac7:	75 d8                	jne    804aa1 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804ac9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ace:	c3                   	ret
+            return envs[i].env_id;
+  804acf:	48 89 d0             	mov    %rdx,%rax
+  804ad2:	48 c1 e0 04          	shl    $0x4,%rax
+  804ad6:	48 29 d0             	sub    %rdx,%rax
+  804ad9:	48 c1 e0 05          	shl    $0x5,%rax
+  804add:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ae4:	00 00 00 
+  804ae7:	48 01 d0             	add    %rdx,%rax
+  804aea:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804af0:	c3                   	ret
+  804af1:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000804af8 <__rodata_start>:
+  804af8:	20 53 48             	and    %dl,0x48(%rbx)
+  804afb:	41 52                	push   %r10
+  804afd:	45 00 20             	add    %r12b,(%r8)
+  804b00:	43                   	rex.XB
+  804b01:	4f 57                	rex.WRXB push %r15
+  804b03:	00 45 49             	add    %al,0x49(%rbp)
+  804b06:	44 3a 20             	cmp    (%rax),%r12b
+  804b09:	25 64 2c 20 50       	and    $0x50202c64,%eax
+  804b0e:	45                   	rex.RB
+  804b0f:	49                   	rex.WB
+  804b10:	44 3a 20             	cmp    (%rax),%r12b
+  804b13:	25 64 0a 00 4d       	and    $0x4d000a64,%eax
+  804b18:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b1a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b1b:	72 79                	jb     804b96 <__rodata_start+0x9e>
+  804b1d:	20 75 73             	and    %dh,0x73(%rbp)
+  804b20:	61                   	(bad)
+  804b21:	67 65 20 73 75       	and    %dh,%gs:0x75(%ebx)
+  804b26:	6d                   	insl   (%dx),%es:(%rdi)
+  804b27:	6d                   	insl   (%dx),%es:(%rdi)
+  804b28:	61                   	(bad)
+  804b29:	72 79                	jb     804ba4 <__rodata_start+0xac>
+  804b2b:	3a 0a                	cmp    (%rdx),%cl
+  804b2d:	00 20                	add    %ah,(%rax)
+  804b2f:	20 50 54             	and    %dl,0x54(%rax)
+  804b32:	45 5f                	rex.RB pop %r15
+  804b34:	50                   	push   %rax
+  804b35:	3a 20                	cmp    (%rax),%ah
+  804b37:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  804b3c:	20 20                	and    %ah,(%rax)
+  804b3e:	50                   	push   %rax
+  804b3f:	54                   	push   %rsp
+  804b40:	45 5f                	rex.RB pop %r15
+  804b42:	55                   	push   %rbp
+  804b43:	3a 20                	cmp    (%rax),%ah
+  804b45:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  804b4a:	20 20                	and    %ah,(%rax)
+  804b4c:	50                   	push   %rax
+  804b4d:	54                   	push   %rsp
+  804b4e:	45 5f                	rex.RB pop %r15
+  804b50:	57                   	push   %rdi
+  804b51:	3a 20                	cmp    (%rax),%ah
+  804b53:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  804b58:	20 20                	and    %ah,(%rax)
+  804b5a:	50                   	push   %rax
+  804b5b:	54                   	push   %rsp
+  804b5c:	45 5f                	rex.RB pop %r15
+  804b5e:	43                   	rex.XB
+  804b5f:	4f 57                	rex.WRXB push %r15
+  804b61:	3a 20                	cmp    (%rax),%ah
+  804b63:	25 6c 75 0a 00       	and    $0xa756c,%eax
+  804b68:	70 69                	jo     804bd3 <__rodata_start+0xdb>
+  804b6a:	70 65                	jo     804bd1 <__rodata_start+0xd9>
+  804b6c:	28 29                	sub    %ch,(%rcx)
+  804b6e:	20 66 61             	and    %ah,0x61(%rsi)
+  804b71:	69 6c 65 64 0a 00 75 	imul   $0x7375000a,0x64(%rbp,%riz,2),%ebp
+  804b78:	73 
+  804b79:	65 72 2f             	gs jb  804bab <__rodata_start+0xb3>
+  804b7c:	6d                   	insl   (%dx),%es:(%rdi)
+  804b7d:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b7f:	6c                   	insb   (%dx),%es:(%rdi)
+  804b80:	61                   	(bad)
+  804b81:	79 6f                	jns    804bf2 <__rodata_start+0xfa>
+  804b83:	75 74                	jne    804bf9 <__rodata_start+0x101>
+  804b85:	2e 63 00             	cs movsxd (%rax),%eax
+  804b88:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b8a:	72 6b                	jb     804bf7 <__rodata_start+0xff>
+  804b8c:	28 29                	sub    %ch,(%rcx)
+  804b8e:	20 66 61             	and    %ah,0x61(%rsi)
+  804b91:	69 6c 65 64 0a 00 3d 	imul   $0x3d3d000a,0x64(%rbp,%riz,2),%ebp
+  804b98:	3d 
+  804b99:	3d 3d 20 43 68       	cmp    $0x6843203d,%eax
+  804b9e:	69 6c 64 0a 00 3d 3d 	imul   $0x3d3d3d00,0xa(%rsp,%riz,2),%ebp
+  804ba5:	3d 
+  804ba6:	3d 20 50 61 72       	cmp    $0x72615020,%eax
+  804bab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bad:	74 0a                	je     804bb9 <__rodata_start+0xc1>
+  804baf:	00 70 6d             	add    %dh,0x6d(%rax)
+  804bb2:	6c                   	insb   (%dx),%es:(%rdi)
+  804bb3:	34 3d                	xor    $0x3d,%al
+  804bb5:	25 70 20 75 76       	and    $0x76752070,%eax
+  804bba:	70 6d                	jo     804c29 <__rodata_start+0x131>
+  804bbc:	6c                   	insb   (%dx),%es:(%rdi)
+  804bbd:	34 3d                	xor    $0x3d,%al
+  804bbf:	25 70 20 75 76       	and    $0x76752070,%eax
+  804bc4:	70 64                	jo     804c2a <__rodata_start+0x132>
+  804bc6:	70 3d                	jo     804c05 <__rodata_start+0x10d>
+  804bc8:	25 70 20 75 76       	and    $0x76752070,%eax
+  804bcd:	70 64                	jo     804c33 <__rodata_start+0x13b>
+  804bcf:	3d 25 70 20 75       	cmp    $0x75207025,%eax
+  804bd4:	76 70                	jbe    804c46 <__rodata_start+0x14e>
+  804bd6:	74 3d                	je     804c15 <__rodata_start+0x11d>
+  804bd8:	25 70 0a 00 00       	and    $0xa70,%eax
+  804bdd:	00 00                	add    %al,(%rax)
+  804bdf:	00 5b 25             	add    %bl,0x25(%rbx)
+  804be2:	70 5d                	jo     804c41 <__rodata_start+0x149>
+  804be4:	20 25 6c 78 20 2d    	and    %ah,0x2d20786c(%rip)        # 2da0c456 <__bss_end+0x2d1ca456>
+  804bea:	3e 20 25 30 38 6c 78 	ds and %ah,0x786c3830(%rip)        # 78ec8421 <__bss_end+0x78686421>
+  804bf1:	3a 20                	cmp    (%rax),%ah
+  804bf3:	25 63 20 25 63       	and    $0x63252063,%eax
+  804bf8:	20 25 63 20 7c 25    	and    %ah,0x257c2063(%rip)        # 25fc6c61 <__bss_end+0x25784c61>
+  804bfe:	73 25                	jae    804c25 <__rodata_start+0x12d>
+  804c00:	73 0a                	jae    804c0c <__rodata_start+0x114>
+  804c02:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804c09:	77 6e                	ja     804c79 <__rodata_start+0x181>
+  804c0b:	3e 00 0f             	ds add %cl,(%rdi)
+  804c0e:	1f                   	(bad)
+  804c0f:	00 5b 25             	add    %bl,0x25(%rbx)
+  804c12:	30 38                	xor    %bh,(%rax)
+  804c14:	78 5d                	js     804c73 <__rodata_start+0x17b>
+  804c16:	20 75 73             	and    %dh,0x73(%rbp)
+  804c19:	65 72 20             	gs jb  804c3c <__rodata_start+0x144>
+  804c1c:	70 61                	jo     804c7f <__rodata_start+0x187>
+  804c1e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c1f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804c26:	73 20                	jae    804c48 <__rodata_start+0x150>
+  804c28:	61                   	(bad)
+  804c29:	74 20                	je     804c4b <__rodata_start+0x153>
+  804c2b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804c30:	3a 20                	cmp    (%rax),%ah
+  804c32:	00 30                	add    %dh,(%rax)
+  804c34:	31 32                	xor    %esi,(%rdx)
+  804c36:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804c3d:	41                   	rex.B
+  804c3e:	42                   	rex.X
+  804c3f:	43                   	rex.XB
+  804c40:	44                   	rex.R
+  804c41:	45                   	rex.RB
+  804c42:	46 00 30             	rex.RX add %r14b,(%rax)
+  804c45:	31 32                	xor    %esi,(%rdx)
+  804c47:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804c4e:	61                   	(bad)
+  804c4f:	62 63 64 65 66       	(bad)
+  804c54:	00 28                	add    %ch,(%rax)
+  804c56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c57:	75 6c                	jne    804cc5 <__rodata_start+0x1cd>
+  804c59:	6c                   	insb   (%dx),%es:(%rdi)
+  804c5a:	29 00                	sub    %eax,(%rax)
+  804c5c:	65 72 72             	gs jb  804cd1 <__rodata_start+0x1d9>
+  804c5f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c60:	72 20                	jb     804c82 <__rodata_start+0x18a>
+  804c62:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804c67:	73 70                	jae    804cd9 <__rodata_start+0x1e1>
+  804c69:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804c6d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804c74:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c75:	72 00                	jb     804c77 <__rodata_start+0x17f>
+  804c77:	62 61 64 20 65       	(bad)
+  804c7c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c7d:	76 69                	jbe    804ce8 <__rodata_start+0x1f0>
+  804c7f:	72 6f                	jb     804cf0 <__rodata_start+0x1f8>
+  804c81:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c82:	6d                   	insl   (%dx),%es:(%rdi)
+  804c83:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c85:	74 00                	je     804c87 <__rodata_start+0x18f>
+  804c87:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c8e:	20 70 61             	and    %dh,0x61(%rax)
+  804c91:	72 61                	jb     804cf4 <__rodata_start+0x1fc>
+  804c93:	6d                   	insl   (%dx),%es:(%rdi)
+  804c94:	65 74 65             	gs je  804cfc <__rodata_start+0x204>
+  804c97:	72 00                	jb     804c99 <__rodata_start+0x1a1>
+  804c99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c9a:	75 74                	jne    804d10 <__rodata_start+0x218>
+  804c9c:	20 6f 66             	and    %ch,0x66(%rdi)
+  804c9f:	20 6d 65             	and    %ch,0x65(%rbp)
+  804ca2:	6d                   	insl   (%dx),%es:(%rdi)
+  804ca3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ca4:	72 79                	jb     804d1f <__rodata_start+0x227>
+  804ca6:	00 6f 75             	add    %ch,0x75(%rdi)
+  804ca9:	74 20                	je     804ccb <__rodata_start+0x1d3>
+  804cab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cac:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804cb0:	76 69                	jbe    804d1b <__rodata_start+0x223>
+  804cb2:	72 6f                	jb     804d23 <__rodata_start+0x22b>
+  804cb4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb5:	6d                   	insl   (%dx),%es:(%rdi)
+  804cb6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804cb8:	74 73                	je     804d2d <__rodata_start+0x235>
+  804cba:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804cbd:	72 72                	jb     804d31 <__rodata_start+0x239>
+  804cbf:	75 70                	jne    804d31 <__rodata_start+0x239>
+  804cc1:	74 65                	je     804d28 <__rodata_start+0x230>
+  804cc3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804cc8:	75 67                	jne    804d31 <__rodata_start+0x239>
+  804cca:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804ccd:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ccf:	00 73 65             	add    %dh,0x65(%rbx)
+  804cd2:	67 6d                	insl   (%dx),%es:(%edi)
+  804cd4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804cd6:	74 61                	je     804d39 <__rodata_start+0x241>
+  804cd8:	74 69                	je     804d43 <__rodata_start+0x24b>
+  804cda:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cdb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cdc:	20 66 61             	and    %ah,0x61(%rsi)
+  804cdf:	75 6c                	jne    804d4d <__rodata_start+0x255>
+  804ce1:	74 00                	je     804ce3 <__rodata_start+0x1eb>
+  804ce3:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804cea:	20 45 4c             	and    %al,0x4c(%rbp)
+  804ced:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804cf1:	61                   	(bad)
+  804cf2:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804cf7:	20 73 75             	and    %dh,0x75(%rbx)
+  804cfa:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804cfd:	73 79                	jae    804d78 <__rodata_start+0x280>
+  804cff:	73 74                	jae    804d75 <__rodata_start+0x27d>
+  804d01:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804d03:	20 63 61             	and    %ah,0x61(%rbx)
+  804d06:	6c                   	insb   (%dx),%es:(%rdi)
+  804d07:	6c                   	insb   (%dx),%es:(%rdi)
+  804d08:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804d0b:	74 72                	je     804d7f <__rodata_start+0x287>
+  804d0d:	79 20                	jns    804d2f <__rodata_start+0x237>
+  804d0f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d10:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d11:	74 20                	je     804d33 <__rodata_start+0x23b>
+  804d13:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d15:	75 6e                	jne    804d85 <__rodata_start+0x28d>
+  804d17:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804d1b:	76 20                	jbe    804d3d <__rodata_start+0x245>
+  804d1d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804d24:	72 65                	jb     804d8b <__rodata_start+0x293>
+  804d26:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804d29:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d2a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804d2e:	65 78 70             	gs js  804da1 <__rodata_start+0x2a9>
+  804d31:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804d36:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804d39:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804d3d:	20 66 69             	and    %ah,0x69(%rsi)
+  804d40:	6c                   	insb   (%dx),%es:(%rdi)
+  804d41:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804d45:	20 66 72             	and    %ah,0x72(%rsi)
+  804d48:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804d4d:	61                   	(bad)
+  804d4e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804d51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d52:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d53:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804d57:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804d5a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d5b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d5c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804d5f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d60:	79 20                	jns    804d82 <__rodata_start+0x28a>
+  804d62:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804d69:	72 65                	jb     804dd0 <__rodata_start+0x2d8>
+  804d6b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804d6e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804d70:	00 66 69             	add    %ah,0x69(%rsi)
+  804d73:	6c                   	insb   (%dx),%es:(%rdi)
+  804d74:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804d78:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804d7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d7c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804d7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d80:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d81:	74 20                	je     804da3 <__rodata_start+0x2ab>
+  804d83:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d85:	75 6e                	jne    804df5 <__rodata_start+0x2fd>
+  804d87:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804d8b:	76 61                	jbe    804dee <__rodata_start+0x2f6>
+  804d8d:	6c                   	insb   (%dx),%es:(%rdi)
+  804d8e:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804d95:	00 
+  804d96:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804d9d:	72 65                	jb     804e04 <__rodata_start+0x30c>
+  804d9f:	61                   	(bad)
+  804da0:	64 79 20             	fs jns 804dc3 <__rodata_start+0x2cb>
+  804da3:	65 78 69             	gs js  804e0f <__rodata_start+0x317>
+  804da6:	73 74                	jae    804e1c <__rodata_start+0x324>
+  804da8:	73 00                	jae    804daa <__rodata_start+0x2b2>
+  804daa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dab:	70 65                	jo     804e12 <__rodata_start+0x31a>
+  804dad:	72 61                	jb     804e10 <__rodata_start+0x318>
+  804daf:	74 69                	je     804e1a <__rodata_start+0x322>
+  804db1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804db2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804db3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804db6:	74 20                	je     804dd8 <__rodata_start+0x2e0>
+  804db8:	73 75                	jae    804e2f <__rodata_start+0x337>
+  804dba:	70 70                	jo     804e2c <__rodata_start+0x334>
+  804dbc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804dbd:	72 74                	jb     804e33 <__rodata_start+0x33b>
+  804dbf:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804dc5:	20 61 67             	and    %ah,0x67(%rcx)
+  804dc8:	61                   	(bad)
+  804dc9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804dd0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804dd4:	74 00                	je     804dd6 <__rodata_start+0x2de>
+  804dd6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804ddd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804de0:	20 75 73             	and    %dh,0x73(%rbp)
+  804de3:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804de7:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804dee:	00 
+  804def:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804df6:	00 00 00 
+  804df9:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  804e00:	88 07                	mov    %al,(%rdi)
+  804e02:	80 00 00             	addb   $0x0,(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 c9                	add    %cl,%cl
+  804e09:	0d 80 00 00 00       	or     $0x80,%eax
+  804e0e:	00 00                	add    %al,(%rax)
+  804e10:	b9 0d 80 00 00       	mov    $0x800d,%ecx
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 c9                	add    %cl,%cl
+  804e19:	0d 80 00 00 00       	or     $0x80,%eax
+  804e1e:	00 00                	add    %al,(%rax)
+  804e20:	c9                   	leave
+  804e21:	0d 80 00 00 00       	or     $0x80,%eax
+  804e26:	00 00                	add    %al,(%rax)
+  804e28:	c9                   	leave
+  804e29:	0d 80 00 00 00       	or     $0x80,%eax
+  804e2e:	00 00                	add    %al,(%rax)
+  804e30:	c9                   	leave
+  804e31:	0d 80 00 00 00       	or     $0x80,%eax
+  804e36:	00 00                	add    %al,(%rax)
+  804e38:	a7                   	cmpsl  %es:(%rdi),%ds:(%rsi)
+  804e39:	07                   	(bad)
+  804e3a:	80 00 00             	addb   $0x0,(%rax)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 c9                	add    %cl,%cl
+  804e41:	0d 80 00 00 00       	or     $0x80,%eax
+  804e46:	00 00                	add    %al,(%rax)
+  804e48:	c9                   	leave
+  804e49:	0d 80 00 00 00       	or     $0x80,%eax
+  804e4e:	00 00                	add    %al,(%rax)
+  804e50:	9b                   	fwait
+  804e51:	07                   	(bad)
+  804e52:	80 00 00             	addb   $0x0,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 15 08 80 00 00    	add    %dl,0x8008(%rip)        # 80ce65 <__ctors_end+0x6d85>
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 c9                	add    %cl,%cl
+  804e61:	0d 80 00 00 00       	or     $0x80,%eax
+  804e66:	00 00                	add    %al,(%rax)
+  804e68:	9b                   	fwait
+  804e69:	07                   	(bad)
+  804e6a:	80 00 00             	addb   $0x0,(%rax)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 e1                	add    %ah,%cl
+  804e71:	07                   	(bad)
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 e1                	add    %ah,%cl
+  804e79:	07                   	(bad)
+  804e7a:	80 00 00             	addb   $0x0,(%rax)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 e1                	add    %ah,%cl
+  804e81:	07                   	(bad)
+  804e82:	80 00 00             	addb   $0x0,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 e1                	add    %ah,%cl
+  804e89:	07                   	(bad)
+  804e8a:	80 00 00             	addb   $0x0,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 e1                	add    %ah,%cl
+  804e91:	07                   	(bad)
+  804e92:	80 00 00             	addb   $0x0,(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 e1                	add    %ah,%cl
+  804e99:	07                   	(bad)
+  804e9a:	80 00 00             	addb   $0x0,(%rax)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 e1                	add    %ah,%cl
+  804ea1:	07                   	(bad)
+  804ea2:	80 00 00             	addb   $0x0,(%rax)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 e1                	add    %ah,%cl
+  804ea9:	07                   	(bad)
+  804eaa:	80 00 00             	addb   $0x0,(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 e1                	add    %ah,%cl
+  804eb1:	07                   	(bad)
+  804eb2:	80 00 00             	addb   $0x0,(%rax)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 c9                	add    %cl,%cl
+  804eb9:	0d 80 00 00 00       	or     $0x80,%eax
+  804ebe:	00 00                	add    %al,(%rax)
+  804ec0:	c9                   	leave
+  804ec1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ec6:	00 00                	add    %al,(%rax)
+  804ec8:	c9                   	leave
+  804ec9:	0d 80 00 00 00       	or     $0x80,%eax
+  804ece:	00 00                	add    %al,(%rax)
+  804ed0:	c9                   	leave
+  804ed1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ed6:	00 00                	add    %al,(%rax)
+  804ed8:	c9                   	leave
+  804ed9:	0d 80 00 00 00       	or     $0x80,%eax
+  804ede:	00 00                	add    %al,(%rax)
+  804ee0:	c9                   	leave
+  804ee1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ee6:	00 00                	add    %al,(%rax)
+  804ee8:	c9                   	leave
+  804ee9:	0d 80 00 00 00       	or     $0x80,%eax
+  804eee:	00 00                	add    %al,(%rax)
+  804ef0:	c9                   	leave
+  804ef1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ef6:	00 00                	add    %al,(%rax)
+  804ef8:	c9                   	leave
+  804ef9:	0d 80 00 00 00       	or     $0x80,%eax
+  804efe:	00 00                	add    %al,(%rax)
+  804f00:	c9                   	leave
+  804f01:	0d 80 00 00 00       	or     $0x80,%eax
+  804f06:	00 00                	add    %al,(%rax)
+  804f08:	c9                   	leave
+  804f09:	0d 80 00 00 00       	or     $0x80,%eax
+  804f0e:	00 00                	add    %al,(%rax)
+  804f10:	c9                   	leave
+  804f11:	0d 80 00 00 00       	or     $0x80,%eax
+  804f16:	00 00                	add    %al,(%rax)
+  804f18:	c9                   	leave
+  804f19:	0d 80 00 00 00       	or     $0x80,%eax
+  804f1e:	00 00                	add    %al,(%rax)
+  804f20:	c9                   	leave
+  804f21:	0d 80 00 00 00       	or     $0x80,%eax
+  804f26:	00 00                	add    %al,(%rax)
+  804f28:	c9                   	leave
+  804f29:	0d 80 00 00 00       	or     $0x80,%eax
+  804f2e:	00 00                	add    %al,(%rax)
+  804f30:	c9                   	leave
+  804f31:	0d 80 00 00 00       	or     $0x80,%eax
+  804f36:	00 00                	add    %al,(%rax)
+  804f38:	c9                   	leave
+  804f39:	0d 80 00 00 00       	or     $0x80,%eax
+  804f3e:	00 00                	add    %al,(%rax)
+  804f40:	c9                   	leave
+  804f41:	0d 80 00 00 00       	or     $0x80,%eax
+  804f46:	00 00                	add    %al,(%rax)
+  804f48:	c9                   	leave
+  804f49:	0d 80 00 00 00       	or     $0x80,%eax
+  804f4e:	00 00                	add    %al,(%rax)
+  804f50:	c9                   	leave
+  804f51:	0d 80 00 00 00       	or     $0x80,%eax
+  804f56:	00 00                	add    %al,(%rax)
+  804f58:	c9                   	leave
+  804f59:	0d 80 00 00 00       	or     $0x80,%eax
+  804f5e:	00 00                	add    %al,(%rax)
+  804f60:	c9                   	leave
+  804f61:	0d 80 00 00 00       	or     $0x80,%eax
+  804f66:	00 00                	add    %al,(%rax)
+  804f68:	c9                   	leave
+  804f69:	0d 80 00 00 00       	or     $0x80,%eax
+  804f6e:	00 00                	add    %al,(%rax)
+  804f70:	c9                   	leave
+  804f71:	0d 80 00 00 00       	or     $0x80,%eax
+  804f76:	00 00                	add    %al,(%rax)
+  804f78:	c9                   	leave
+  804f79:	0d 80 00 00 00       	or     $0x80,%eax
+  804f7e:	00 00                	add    %al,(%rax)
+  804f80:	c9                   	leave
+  804f81:	0d 80 00 00 00       	or     $0x80,%eax
+  804f86:	00 00                	add    %al,(%rax)
+  804f88:	c9                   	leave
+  804f89:	0d 80 00 00 00       	or     $0x80,%eax
+  804f8e:	00 00                	add    %al,(%rax)
+  804f90:	c9                   	leave
+  804f91:	0d 80 00 00 00       	or     $0x80,%eax
+  804f96:	00 00                	add    %al,(%rax)
+  804f98:	c9                   	leave
+  804f99:	0d 80 00 00 00       	or     $0x80,%eax
+  804f9e:	00 00                	add    %al,(%rax)
+  804fa0:	c9                   	leave
+  804fa1:	0d 80 00 00 00       	or     $0x80,%eax
+  804fa6:	00 00                	add    %al,(%rax)
+  804fa8:	ec                   	in     (%dx),%al
+  804fa9:	0c 80                	or     $0x80,%al
+  804fab:	00 00                	add    %al,(%rax)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 c9                	add    %cl,%cl
+  804fb1:	0d 80 00 00 00       	or     $0x80,%eax
+  804fb6:	00 00                	add    %al,(%rax)
+  804fb8:	c9                   	leave
+  804fb9:	0d 80 00 00 00       	or     $0x80,%eax
+  804fbe:	00 00                	add    %al,(%rax)
+  804fc0:	c9                   	leave
+  804fc1:	0d 80 00 00 00       	or     $0x80,%eax
+  804fc6:	00 00                	add    %al,(%rax)
+  804fc8:	c9                   	leave
+  804fc9:	0d 80 00 00 00       	or     $0x80,%eax
+  804fce:	00 00                	add    %al,(%rax)
+  804fd0:	c9                   	leave
+  804fd1:	0d 80 00 00 00       	or     $0x80,%eax
+  804fd6:	00 00                	add    %al,(%rax)
+  804fd8:	c9                   	leave
+  804fd9:	0d 80 00 00 00       	or     $0x80,%eax
+  804fde:	00 00                	add    %al,(%rax)
+  804fe0:	c9                   	leave
+  804fe1:	0d 80 00 00 00       	or     $0x80,%eax
+  804fe6:	00 00                	add    %al,(%rax)
+  804fe8:	c9                   	leave
+  804fe9:	0d 80 00 00 00       	or     $0x80,%eax
+  804fee:	00 00                	add    %al,(%rax)
+  804ff0:	c9                   	leave
+  804ff1:	0d 80 00 00 00       	or     $0x80,%eax
+  804ff6:	00 00                	add    %al,(%rax)
+  804ff8:	c9                   	leave
+  804ff9:	0d 80 00 00 00       	or     $0x80,%eax
+  804ffe:	00 00                	add    %al,(%rax)
+  805000:	38 08                	cmp    %cl,(%rax)
+  805002:	80 00 00             	addb   $0x0,(%rax)
+  805005:	00 00                	add    %al,(%rax)
+  805007:	00 07                	add    %al,(%rdi)
+  805009:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  80500f:	00 c9                	add    %cl,%cl
+  805011:	0d 80 00 00 00       	or     $0x80,%eax
+  805016:	00 00                	add    %al,(%rax)
+  805018:	c9                   	leave
+  805019:	0d 80 00 00 00       	or     $0x80,%eax
+  80501e:	00 00                	add    %al,(%rax)
+  805020:	c9                   	leave
+  805021:	0d 80 00 00 00       	or     $0x80,%eax
+  805026:	00 00                	add    %al,(%rax)
+  805028:	c9                   	leave
+  805029:	0d 80 00 00 00       	or     $0x80,%eax
+  80502e:	00 00                	add    %al,(%rax)
+  805030:	67 08 80 00 00 00 00 	or     %al,0x0(%eax)
+  805037:	00 c9                	add    %cl,%cl
+  805039:	0d 80 00 00 00       	or     $0x80,%eax
+  80503e:	00 00                	add    %al,(%rax)
+  805040:	c9                   	leave
+  805041:	0d 80 00 00 00       	or     $0x80,%eax
+  805046:	00 00                	add    %al,(%rax)
+  805048:	2d 08 80 00 00       	sub    $0x8008,%eax
+  80504d:	00 00                	add    %al,(%rax)
+  80504f:	00 c9                	add    %cl,%cl
+  805051:	0d 80 00 00 00       	or     $0x80,%eax
+  805056:	00 00                	add    %al,(%rax)
+  805058:	c9                   	leave
+  805059:	0d 80 00 00 00       	or     $0x80,%eax
+  80505e:	00 00                	add    %al,(%rax)
+  805060:	af                   	scas   %es:(%rdi),%eax
+  805061:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805067:	00 79 0c             	add    %bh,0xc(%rcx)
+  80506a:	80 00 00             	addb   $0x0,(%rax)
+  80506d:	00 00                	add    %al,(%rax)
+  80506f:	00 c9                	add    %cl,%cl
+  805071:	0d 80 00 00 00       	or     $0x80,%eax
+  805076:	00 00                	add    %al,(%rax)
+  805078:	c9                   	leave
+  805079:	0d 80 00 00 00       	or     $0x80,%eax
+  80507e:	00 00                	add    %al,(%rax)
+  805080:	fe 08                	decb   (%rax)
+  805082:	80 00 00             	addb   $0x0,(%rax)
+  805085:	00 00                	add    %al,(%rax)
+  805087:	00 c9                	add    %cl,%cl
+  805089:	0d 80 00 00 00       	or     $0x80,%eax
+  80508e:	00 00                	add    %al,(%rax)
+  805090:	db 0a                	fisttpl (%rdx)
+  805092:	80 00 00             	addb   $0x0,(%rax)
+  805095:	00 00                	add    %al,(%rax)
+  805097:	00 c9                	add    %cl,%cl
+  805099:	0d 80 00 00 00       	or     $0x80,%eax
+  80509e:	00 00                	add    %al,(%rax)
+  8050a0:	c9                   	leave
+  8050a1:	0d 80 00 00 00       	or     $0x80,%eax
+  8050a6:	00 00                	add    %al,(%rax)
+  8050a8:	ec                   	in     (%dx),%al
+  8050a9:	0c 80                	or     $0x80,%al
+  8050ab:	00 00                	add    %al,(%rax)
+  8050ad:	00 00                	add    %al,(%rax)
+  8050af:	00 c9                	add    %cl,%cl
+  8050b1:	0d 80 00 00 00       	or     $0x80,%eax
+  8050b6:	00 00                	add    %al,(%rax)
+  8050b8:	91                   	xchg   %eax,%ecx
+  8050b9:	07                   	(bad)
+  8050ba:	80 00 00             	addb   $0x0,(%rax)
+  8050bd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008050c0 <error_string>:
+	...
+  8050c8:	65 4c 80 00 00 00 00 00 77 4c 80 00 00 00 00 00     eL......wL......
+  8050d8:	87 4c 80 00 00 00 00 00 99 4c 80 00 00 00 00 00     .L.......L......
+  8050e8:	a7 4c 80 00 00 00 00 00 bb 4c 80 00 00 00 00 00     .L.......L......
+  8050f8:	d0 4c 80 00 00 00 00 00 e3 4c 80 00 00 00 00 00     .L.......L......
+  805108:	f5 4c 80 00 00 00 00 00 09 4d 80 00 00 00 00 00     .L.......M......
+  805118:	19 4d 80 00 00 00 00 00 2c 4d 80 00 00 00 00 00     .M......,M......
+  805128:	43 4d 80 00 00 00 00 00 59 4d 80 00 00 00 00 00     CM......YM......
+  805138:	71 4d 80 00 00 00 00 00 89 4d 80 00 00 00 00 00     qM.......M......
+  805148:	96 4d 80 00 00 00 00 00 78 51 80 00 00 00 00 00     .M......xQ......
+  805158:	aa 4d 80 00 00 00 00 00 c2 4d 80 00 00 00 00 00     .M.......M......
+  805168:	cc 4d 80 00 00 00 00 00 d6 4d 80 00 00 00 00 00     .M.......M......
+  805178:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805188:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805198:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8051a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8051b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  8051c8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  8051d8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  8051e8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  8051f8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805208:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805218:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  805228:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  805238:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  805248:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  805258:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  805268:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805278:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805280 <devtab>:
+  805280:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805290:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  8052a0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  8052b0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8052c0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8052d0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8052e0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8052f0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805300:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805310:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805320:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805330:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805340:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805350:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805360:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805370:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805380:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
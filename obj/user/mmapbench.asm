@@ -0,0 +1,10106 @@
+
+obj/user/mmapbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 aa 06 00 00       	call   8006cd <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench_mmap>:
+    if (res < 0) panic("read /bigfile: %i", res);
+    return s;
+}
+
+static uint64_t
+bench_mmap(int fd, off_t size, int prot, int flags, const char *name) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fe             	mov    %edi,%r14d
+  800039:	41 89 d7             	mov    %edx,%r15d
+  80003c:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+    void *addr = NULL;
+  800040:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  800047:	00 
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800048:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80004a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80004e:	89 c0                	mov    %eax,%eax
+  800050:	48 09 c2             	or     %rax,%rdx
+  800053:	49 89 d5             	mov    %rdx,%r13
+
+    uint64_t start = read_tsc();
+    int res = mmap(&addr, size, prot, flags, fd, 0);
+  800056:	4c 63 e6             	movslq %esi,%r12
+  800059:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80005f:	41 89 f8             	mov    %edi,%r8d
+  800062:	44 89 fa             	mov    %r15d,%edx
+  800065:	4c 89 e6             	mov    %r12,%rsi
+  800068:	48 8d 7d c8          	lea    -0x38(%rbp),%rdi
+  80006c:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  800073:	00 00 00 
+  800076:	ff d0                	call   *%rax
+    if (res < 0) panic("mmap /bigfile: %i", res);
+  800078:	85 c0                	test   %eax,%eax
+  80007a:	0f 88 70 01 00 00    	js     8001f0 <bench_mmap+0x1cb>
+    uint64_t s = sum(addr, size);
+  800080:	48 8b 55 c8          	mov    -0x38(%rbp),%rdx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  800084:	4c 89 e1             	mov    %r12,%rcx
+  800087:	48 c1 e9 03          	shr    $0x3,%rcx
+  80008b:	49 83 fc 07          	cmp    $0x7,%r12
+  80008f:	0f 86 88 01 00 00    	jbe    80021d <bench_mmap+0x1f8>
+    uint64_t s = 0;
+  800095:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  80009a:	b8 00 00 00 00       	mov    $0x0,%eax
+        s += p[i];
+  80009f:	48 03 1c c2          	add    (%rdx,%rax,8),%rbx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  8000a3:	48 83 c0 01          	add    $0x1,%rax
+  8000a7:	48 39 c8             	cmp    %rcx,%rax
+  8000aa:	72 f3                	jb     80009f <bench_mmap+0x7a>
+    asm volatile("rdtsc"
+  8000ac:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ae:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000b2:	89 c0                	mov    %eax,%eax
+  8000b4:	48 09 c2             	or     %rax,%rdx
+    report(name, read_tsc() - start, size);
+  8000b7:	48 89 d1             	mov    %rdx,%rcx
+  8000ba:	4c 29 e9             	sub    %r13,%rcx
+            (unsigned long)(cycles * 100 / total % 100));
+  8000bd:	48 8d 04 89          	lea    (%rcx,%rcx,4),%rax
+  8000c1:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  8000c5:	48 c1 e0 02          	shl    $0x2,%rax
+  8000c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000ce:	49 f7 f4             	div    %r12
+  8000d1:	49 89 c0             	mov    %rax,%r8
+    cprintf("mmapbench: %s: %lu KB, %lu.%02lu cycles per byte\n", name,
+  8000d4:	48 89 c2             	mov    %rax,%rdx
+  8000d7:	48 c1 ea 02          	shr    $0x2,%rdx
+  8000db:	48 be c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rsi
+  8000e2:	c2 f5 28 
+  8000e5:	48 89 d0             	mov    %rdx,%rax
+  8000e8:	48 f7 e6             	mul    %rsi
+  8000eb:	48 89 d0             	mov    %rdx,%rax
+  8000ee:	48 c1 e8 02          	shr    $0x2,%rax
+  8000f2:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  8000f6:	48 01 c2             	add    %rax,%rdx
+  8000f9:	48 8d 34 92          	lea    (%rdx,%rdx,4),%rsi
+  8000fd:	48 c1 e6 02          	shl    $0x2,%rsi
+  800101:	48 89 c8             	mov    %rcx,%rax
+  800104:	ba 00 00 00 00       	mov    $0x0,%edx
+  800109:	49 f7 f4             	div    %r12
+  80010c:	48 89 c1             	mov    %rax,%rcx
+            (unsigned long)(total / 1024), (unsigned long)(cycles / total),
+  80010f:	4c 89 e2             	mov    %r12,%rdx
+  800112:	48 c1 ea 0a          	shr    $0xa,%rdx
+    cprintf("mmapbench: %s: %lu KB, %lu.%02lu cycles per byte\n", name,
+  800116:	49 29 f0             	sub    %rsi,%r8
+  800119:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80011d:	48 bf 20 5a 80 00 00 	movabs $0x805a20,%rdi
+  800124:	00 00 00 
+  800127:	b8 00 00 00 00       	mov    $0x0,%eax
+  80012c:	49 b9 f3 08 80 00 00 	movabs $0x8008f3,%r9
+  800133:	00 00 00 
+  800136:	41 ff d1             	call   *%r9
+
+    if (prot & PROT_W) {
+  800139:	41 f6 c7 02          	test   $0x2,%r15b
+  80013d:	0f 84 80 00 00 00    	je     8001c3 <bench_mmap+0x19e>
+        memset(addr, 'x', PAGE_SIZE);
+  800143:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800148:	be 78 00 00 00       	mov    $0x78,%esi
+  80014d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  800151:	48 b8 64 13 80 00 00 	movabs $0x801364,%rax
+  800158:	00 00 00 
+  80015b:	ff d0                	call   *%rax
+        seek(fd, 0);
+  80015d:	be 00 00 00 00       	mov    $0x0,%esi
+  800162:	44 89 f7             	mov    %r14d,%edi
+  800165:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  80016c:	00 00 00 
+  80016f:	ff d0                	call   *%rax
+        if ((res = readn(fd, buf, PAGE_SIZE)) != PAGE_SIZE) panic("read /bigfile: %i", res);
+  800171:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800176:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  80017d:	00 00 00 
+  800180:	44 89 f7             	mov    %r14d,%edi
+  800183:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  80018a:	00 00 00 
+  80018d:	ff d0                	call   *%rax
+  80018f:	89 c1                	mov    %eax,%ecx
+  800191:	3d 00 10 00 00       	cmp    $0x1000,%eax
+  800196:	0f 85 8b 00 00 00    	jne    800227 <bench_mmap+0x202>
+        if (!memcmp(buf, addr, PAGE_SIZE)) panic("private mapping wrote to the file");
+  80019c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8001a1:	48 8b 75 c8          	mov    -0x38(%rbp),%rsi
+  8001a5:	48 bf 00 00 81 00 00 	movabs $0x810000,%rdi
+  8001ac:	00 00 00 
+  8001af:	48 b8 31 15 80 00 00 	movabs $0x801531,%rax
+  8001b6:	00 00 00 
+  8001b9:	ff d0                	call   *%rax
+  8001bb:	85 c0                	test   %eax,%eax
+  8001bd:	0f 84 8f 00 00 00    	je     800252 <bench_mmap+0x22d>
+    }
+
+    if ((res = munmap(addr, size)) < 0) panic("munmap: %i", res);
+  8001c3:	4c 89 e6             	mov    %r12,%rsi
+  8001c6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8001ca:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  8001d1:	00 00 00 
+  8001d4:	ff d0                	call   *%rax
+  8001d6:	85 c0                	test   %eax,%eax
+  8001d8:	0f 88 99 00 00 00    	js     800277 <bench_mmap+0x252>
+    return s;
+}
+  8001de:	48 89 d8             	mov    %rbx,%rax
+  8001e1:	48 83 c4 28          	add    $0x28,%rsp
+  8001e5:	5b                   	pop    %rbx
+  8001e6:	41 5c                	pop    %r12
+  8001e8:	41 5d                	pop    %r13
+  8001ea:	41 5e                	pop    %r14
+  8001ec:	41 5f                	pop    %r15
+  8001ee:	5d                   	pop    %rbp
+  8001ef:	c3                   	ret
+    if (res < 0) panic("mmap /bigfile: %i", res);
+  8001f0:	89 c1                	mov    %eax,%ecx
+  8001f2:	48 ba 78 59 80 00 00 	movabs $0x805978,%rdx
+  8001f9:	00 00 00 
+  8001fc:	be 31 00 00 00       	mov    $0x31,%esi
+  800201:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800208:	00 00 00 
+  80020b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800210:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  800217:	00 00 00 
+  80021a:	41 ff d0             	call   *%r8
+    uint64_t s = 0;
+  80021d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  800222:	e9 85 fe ff ff       	jmp    8000ac <bench_mmap+0x87>
+        if ((res = readn(fd, buf, PAGE_SIZE)) != PAGE_SIZE) panic("read /bigfile: %i", res);
+  800227:	48 ba 9b 59 80 00 00 	movabs $0x80599b,%rdx
+  80022e:	00 00 00 
+  800231:	be 38 00 00 00       	mov    $0x38,%esi
+  800236:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  80023d:	00 00 00 
+  800240:	b8 00 00 00 00       	mov    $0x0,%eax
+  800245:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  80024c:	00 00 00 
+  80024f:	41 ff d0             	call   *%r8
+        if (!memcmp(buf, addr, PAGE_SIZE)) panic("private mapping wrote to the file");
+  800252:	48 ba 58 5a 80 00 00 	movabs $0x805a58,%rdx
+  800259:	00 00 00 
+  80025c:	be 39 00 00 00       	mov    $0x39,%esi
+  800261:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800268:	00 00 00 
+  80026b:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  800272:	00 00 00 
+  800275:	ff d1                	call   *%rcx
+    if ((res = munmap(addr, size)) < 0) panic("munmap: %i", res);
+  800277:	89 c1                	mov    %eax,%ecx
+  800279:	48 ba ad 59 80 00 00 	movabs $0x8059ad,%rdx
+  800280:	00 00 00 
+  800283:	be 3c 00 00 00       	mov    $0x3c,%esi
+  800288:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  80028f:	00 00 00 
+  800292:	b8 00 00 00 00       	mov    $0x0,%eax
+  800297:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  80029e:	00 00 00 
+  8002a1:	41 ff d0             	call   *%r8
+
+00000000008002a4 <umain>:
+
+void
+umain(int argc, char **argv) {
+  8002a4:	55                   	push   %rbp
+  8002a5:	48 89 e5             	mov    %rsp,%rbp
+  8002a8:	41 57                	push   %r15
+  8002aa:	41 56                	push   %r14
+  8002ac:	41 55                	push   %r13
+  8002ae:	41 54                	push   %r12
+  8002b0:	53                   	push   %rbx
+  8002b1:	48 81 ec b8 00 00 00 	sub    $0xb8,%rsp
+    int fd;
+    struct Stat st;
+
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  8002b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8002bd:	48 bf d0 59 80 00 00 	movabs $0x8059d0,%rdi
+  8002c4:	00 00 00 
+  8002c7:	48 b8 fd 33 80 00 00 	movabs $0x8033fd,%rax
+  8002ce:	00 00 00 
+  8002d1:	ff d0                	call   *%rax
+  8002d3:	41 89 c6             	mov    %eax,%r14d
+  8002d6:	85 c0                	test   %eax,%eax
+  8002d8:	78 67                	js     800341 <umain+0x9d>
+    if (fstat(fd, &st) < 0) panic("fstat /bigfile");
+  8002da:	48 8d b5 40 ff ff ff 	lea    -0xc0(%rbp),%rsi
+  8002e1:	89 c7                	mov    %eax,%edi
+  8002e3:	48 b8 0f 22 80 00 00 	movabs $0x80220f,%rax
+  8002ea:	00 00 00 
+  8002ed:	ff d0                	call   *%rax
+  8002ef:	85 c0                	test   %eax,%eax
+  8002f1:	78 7b                	js     80036e <umain+0xca>
+    off_t size = ROUNDDOWN(st.st_size, sizeof(uint64_t));
+  8002f3:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  8002f6:	83 e0 f8             	and    $0xfffffff8,%eax
+  8002f9:	89 85 34 ff ff ff    	mov    %eax,-0xcc(%rbp)
+    seek(fd, 0);
+  8002ff:	be 00 00 00 00       	mov    $0x0,%esi
+  800304:	44 89 f7             	mov    %r14d,%edi
+  800307:	48 b8 03 21 80 00 00 	movabs $0x802103,%rax
+  80030e:	00 00 00 
+  800311:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800313:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800315:	48 c1 e2 20          	shl    $0x20,%rdx
+  800319:	89 c0                	mov    %eax,%eax
+  80031b:	48 09 c2             	or     %rax,%rdx
+  80031e:	48 89 95 28 ff ff ff 	mov    %rdx,-0xd8(%rbp)
+    uint64_t s = 0;
+  800325:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  80032b:	49 bc 00 00 81 00 00 	movabs $0x810000,%r12
+  800332:	00 00 00 
+  800335:	49 bf 1b 1f 80 00 00 	movabs $0x801f1b,%r15
+  80033c:	00 00 00 
+  80033f:	eb 67                	jmp    8003a8 <umain+0x104>
+    if ((fd = open("/bigfile", O_RDONLY)) < 0) panic("open /bigfile: %i", fd);
+  800341:	89 c1                	mov    %eax,%ecx
+  800343:	48 ba b8 59 80 00 00 	movabs $0x8059b8,%rdx
+  80034a:	00 00 00 
+  80034d:	be 45 00 00 00       	mov    $0x45,%esi
+  800352:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800359:	00 00 00 
+  80035c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800361:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  800368:	00 00 00 
+  80036b:	41 ff d0             	call   *%r8
+    if (fstat(fd, &st) < 0) panic("fstat /bigfile");
+  80036e:	48 ba ca 59 80 00 00 	movabs $0x8059ca,%rdx
+  800375:	00 00 00 
+  800378:	be 46 00 00 00       	mov    $0x46,%esi
+  80037d:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800384:	00 00 00 
+  800387:	b8 00 00 00 00       	mov    $0x0,%eax
+  80038c:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  800393:	00 00 00 
+  800396:	ff d1                	call   *%rcx
+        s += p[i];
+  800398:	49 03 14 c4          	add    (%r12,%rax,8),%rdx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  80039c:	48 83 c0 01          	add    $0x1,%rax
+  8003a0:	48 39 c8             	cmp    %rcx,%rax
+  8003a3:	72 f3                	jb     800398 <umain+0xf4>
+        s += sum((uint64_t *)buf, res);
+  8003a5:	49 01 d5             	add    %rdx,%r13
+    while ((res = read(fd, buf, sizeof(buf))) > 0)
+  8003a8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8003ad:	4c 89 e6             	mov    %r12,%rsi
+  8003b0:	44 89 f7             	mov    %r14d,%edi
+  8003b3:	41 ff d7             	call   *%r15
+  8003b6:	48 89 c3             	mov    %rax,%rbx
+  8003b9:	89 85 38 ff ff ff    	mov    %eax,-0xc8(%rbp)
+  8003bf:	85 c0                	test   %eax,%eax
+  8003c1:	7e 23                	jle    8003e6 <umain+0x142>
+        s += sum((uint64_t *)buf, res);
+  8003c3:	48 63 db             	movslq %ebx,%rbx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  8003c6:	48 89 d9             	mov    %rbx,%rcx
+  8003c9:	48 c1 e9 03          	shr    $0x3,%rcx
+  8003cd:	48 83 fb 07          	cmp    $0x7,%rbx
+  8003d1:	76 0c                	jbe    8003df <umain+0x13b>
+    uint64_t s = 0;
+  8003d3:	ba 00 00 00 00       	mov    $0x0,%edx
+    for (size_t i = 0; i < n / sizeof(*p); i++)
+  8003d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dd:	eb b9                	jmp    800398 <umain+0xf4>
+    uint64_t s = 0;
+  8003df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e4:	eb bf                	jmp    8003a5 <umain+0x101>
+    report("read", read_tsc() - start, size);
+  8003e6:	48 63 b5 34 ff ff ff 	movslq -0xcc(%rbp),%rsi
+    asm volatile("rdtsc"
+  8003ed:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8003ef:	48 c1 e2 20          	shl    $0x20,%rdx
+  8003f3:	89 c0                	mov    %eax,%eax
+  8003f5:	48 09 c2             	or     %rax,%rdx
+  8003f8:	48 89 d1             	mov    %rdx,%rcx
+  8003fb:	48 8b 85 28 ff ff ff 	mov    -0xd8(%rbp),%rax
+  800402:	48 29 c1             	sub    %rax,%rcx
+            (unsigned long)(cycles * 100 / total % 100));
+  800405:	48 8d 04 89          	lea    (%rcx,%rcx,4),%rax
+  800409:	48 8d 04 80          	lea    (%rax,%rax,4),%rax
+  80040d:	48 c1 e0 02          	shl    $0x2,%rax
+  800411:	ba 00 00 00 00       	mov    $0x0,%edx
+  800416:	48 f7 f6             	div    %rsi
+  800419:	49 89 c0             	mov    %rax,%r8
+    cprintf("mmapbench: %s: %lu KB, %lu.%02lu cycles per byte\n", name,
+  80041c:	48 89 c2             	mov    %rax,%rdx
+  80041f:	48 c1 ea 02          	shr    $0x2,%rdx
+  800423:	48 bf c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rdi
+  80042a:	c2 f5 28 
+  80042d:	48 89 d0             	mov    %rdx,%rax
+  800430:	48 f7 e7             	mul    %rdi
+  800433:	48 89 d0             	mov    %rdx,%rax
+  800436:	48 c1 e8 02          	shr    $0x2,%rax
+  80043a:	48 83 e2 fc          	and    $0xfffffffffffffffc,%rdx
+  80043e:	48 01 c2             	add    %rax,%rdx
+  800441:	48 8d 3c 92          	lea    (%rdx,%rdx,4),%rdi
+  800445:	48 c1 e7 02          	shl    $0x2,%rdi
+  800449:	48 89 c8             	mov    %rcx,%rax
+  80044c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800451:	48 f7 f6             	div    %rsi
+  800454:	48 89 c1             	mov    %rax,%rcx
+            (unsigned long)(total / 1024), (unsigned long)(cycles / total),
+  800457:	48 c1 ee 0a          	shr    $0xa,%rsi
+  80045b:	48 89 f2             	mov    %rsi,%rdx
+    cprintf("mmapbench: %s: %lu KB, %lu.%02lu cycles per byte\n", name,
+  80045e:	49 29 f8             	sub    %rdi,%r8
+  800461:	48 be d9 59 80 00 00 	movabs $0x8059d9,%rsi
+  800468:	00 00 00 
+  80046b:	48 bf 20 5a 80 00 00 	movabs $0x805a20,%rdi
+  800472:	00 00 00 
+  800475:	b8 00 00 00 00       	mov    $0x0,%eax
+  80047a:	49 b9 f3 08 80 00 00 	movabs $0x8008f3,%r9
+  800481:	00 00 00 
+  800484:	41 ff d1             	call   *%r9
+    if (res < 0) panic("read /bigfile: %i", res);
+  800487:	85 db                	test   %ebx,%ebx
+  800489:	0f 88 62 01 00 00    	js     8005f1 <umain+0x34d>
+
+    uint64_t s = bench_read(fd, size);
+    if (bench_mmap(fd, size, PROT_R, MAP_SHARED, "shared mmap") != s)
+  80048f:	49 b8 de 59 80 00 00 	movabs $0x8059de,%r8
+  800496:	00 00 00 
+  800499:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80049e:	ba 04 00 00 00       	mov    $0x4,%edx
+  8004a3:	8b b5 34 ff ff ff    	mov    -0xcc(%rbp),%esi
+  8004a9:	44 89 f7             	mov    %r14d,%edi
+  8004ac:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8004b3:	00 00 00 
+  8004b6:	ff d0                	call   *%rax
+  8004b8:	4c 39 e8             	cmp    %r13,%rax
+  8004bb:	0f 85 61 01 00 00    	jne    800622 <umain+0x37e>
+        panic("shared mapping differs from the file");
+    if (bench_mmap(fd, size, PROT_RW, MAP_PRIVATE, "private mmap") != s)
+  8004c1:	49 b8 ea 59 80 00 00 	movabs $0x8059ea,%r8
+  8004c8:	00 00 00 
+  8004cb:	b9 02 00 00 00       	mov    $0x2,%ecx
+  8004d0:	ba 06 00 00 00       	mov    $0x6,%edx
+  8004d5:	8b b5 34 ff ff ff    	mov    -0xcc(%rbp),%esi
+  8004db:	44 89 f7             	mov    %r14d,%edi
+  8004de:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8004e5:	00 00 00 
+  8004e8:	ff d0                	call   *%rax
+  8004ea:	4c 39 e8             	cmp    %r13,%rax
+  8004ed:	0f 85 59 01 00 00    	jne    80064c <umain+0x3a8>
+        panic("private mapping differs from the file");
+    if (bench_mmap(fd, size, PROT_R, MAP_SHARED | MAP_POPULATE, "populated mmap") != s)
+  8004f3:	49 b8 f7 59 80 00 00 	movabs $0x8059f7,%r8
+  8004fa:	00 00 00 
+  8004fd:	b9 09 00 00 00       	mov    $0x9,%ecx
+  800502:	ba 04 00 00 00       	mov    $0x4,%edx
+  800507:	8b b5 34 ff ff ff    	mov    -0xcc(%rbp),%esi
+  80050d:	44 89 f7             	mov    %r14d,%edi
+  800510:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800517:	00 00 00 
+  80051a:	ff d0                	call   *%rax
+  80051c:	4c 39 e8             	cmp    %r13,%rax
+  80051f:	0f 85 51 01 00 00    	jne    800676 <umain+0x3d2>
+        panic("populated mapping differs from the file");
+    close(fd);
+  800525:	44 89 f7             	mov    %r14d,%edi
+  800528:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  80052f:	00 00 00 
+  800532:	ff d0                	call   *%rax
+    asm volatile("rdtsc"
+  800534:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800536:	48 c1 e2 20          	shl    $0x20,%rdx
+  80053a:	89 c0                	mov    %eax,%eax
+  80053c:	48 09 c2             	or     %rax,%rdx
+  80053f:	48 89 95 38 ff ff ff 	mov    %rdx,-0xc8(%rbp)
+  800546:	bb 08 00 00 00       	mov    $0x8,%ebx
+
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NSPAWNS; i++) {
+        envid_t child = spawnl("/hello", "hello", (char *)0);
+  80054b:	49 bf 07 5a 80 00 00 	movabs $0x805a07,%r15
+  800552:	00 00 00 
+  800555:	49 be 06 5a 80 00 00 	movabs $0x805a06,%r14
+  80055c:	00 00 00 
+  80055f:	49 bd 54 44 80 00 00 	movabs $0x804454,%r13
+  800566:	00 00 00 
+        if (child < 0) panic("spawn /hello: %i", child);
+        wait(child);
+  800569:	49 bc 6d 4b 80 00 00 	movabs $0x804b6d,%r12
+  800570:	00 00 00 
+        envid_t child = spawnl("/hello", "hello", (char *)0);
+  800573:	ba 00 00 00 00       	mov    $0x0,%edx
+  800578:	4c 89 fe             	mov    %r15,%rsi
+  80057b:	4c 89 f7             	mov    %r14,%rdi
+  80057e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800583:	41 ff d5             	call   *%r13
+  800586:	89 c7                	mov    %eax,%edi
+        if (child < 0) panic("spawn /hello: %i", child);
+  800588:	85 c0                	test   %eax,%eax
+  80058a:	0f 88 10 01 00 00    	js     8006a0 <umain+0x3fc>
+        wait(child);
+  800590:	41 ff d4             	call   *%r12
+    for (int i = 0; i < NSPAWNS; i++) {
+  800593:	83 eb 01             	sub    $0x1,%ebx
+  800596:	75 db                	jne    800573 <umain+0x2cf>
+    asm volatile("rdtsc"
+  800598:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80059a:	48 c1 e2 20          	shl    $0x20,%rdx
+  80059e:	89 c0                	mov    %eax,%eax
+  8005a0:	48 09 c2             	or     %rax,%rdx
+    }
+    cprintf("mmapbench: spawn: %lu Kcycles\n",
+            (unsigned long)((read_tsc() - start) / NSPAWNS / 1000));
+  8005a3:	48 8b 85 38 ff ff ff 	mov    -0xc8(%rbp),%rax
+  8005aa:	48 29 c2             	sub    %rax,%rdx
+  8005ad:	48 c1 ea 06          	shr    $0x6,%rdx
+  8005b1:	48 b9 7d 3f 35 5e ba 	movabs $0x20c49ba5e353f7d,%rcx
+  8005b8:	49 0c 02 
+  8005bb:	48 89 d0             	mov    %rdx,%rax
+  8005be:	48 f7 e1             	mul    %rcx
+  8005c1:	48 89 d6             	mov    %rdx,%rsi
+    cprintf("mmapbench: spawn: %lu Kcycles\n",
+  8005c4:	48 bf f8 5a 80 00 00 	movabs $0x805af8,%rdi
+  8005cb:	00 00 00 
+  8005ce:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d3:	48 ba f3 08 80 00 00 	movabs $0x8008f3,%rdx
+  8005da:	00 00 00 
+  8005dd:	ff d2                	call   *%rdx
+}
+  8005df:	48 81 c4 b8 00 00 00 	add    $0xb8,%rsp
+  8005e6:	5b                   	pop    %rbx
+  8005e7:	41 5c                	pop    %r12
+  8005e9:	41 5d                	pop    %r13
+  8005eb:	41 5e                	pop    %r14
+  8005ed:	41 5f                	pop    %r15
+  8005ef:	5d                   	pop    %rbp
+  8005f0:	c3                   	ret
+    if (res < 0) panic("read /bigfile: %i", res);
+  8005f1:	8b 8d 38 ff ff ff    	mov    -0xc8(%rbp),%ecx
+  8005f7:	48 ba 9b 59 80 00 00 	movabs $0x80599b,%rdx
+  8005fe:	00 00 00 
+  800601:	be 27 00 00 00       	mov    $0x27,%esi
+  800606:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  80060d:	00 00 00 
+  800610:	b8 00 00 00 00       	mov    $0x0,%eax
+  800615:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  80061c:	00 00 00 
+  80061f:	41 ff d0             	call   *%r8
+        panic("shared mapping differs from the file");
+  800622:	48 ba 80 5a 80 00 00 	movabs $0x805a80,%rdx
+  800629:	00 00 00 
+  80062c:	be 4b 00 00 00       	mov    $0x4b,%esi
+  800631:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800638:	00 00 00 
+  80063b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800640:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  800647:	00 00 00 
+  80064a:	ff d1                	call   *%rcx
+        panic("private mapping differs from the file");
+  80064c:	48 ba a8 5a 80 00 00 	movabs $0x805aa8,%rdx
+  800653:	00 00 00 
+  800656:	be 4d 00 00 00       	mov    $0x4d,%esi
+  80065b:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  800662:	00 00 00 
+  800665:	b8 00 00 00 00       	mov    $0x0,%eax
+  80066a:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  800671:	00 00 00 
+  800674:	ff d1                	call   *%rcx
+        panic("populated mapping differs from the file");
+  800676:	48 ba d0 5a 80 00 00 	movabs $0x805ad0,%rdx
+  80067d:	00 00 00 
+  800680:	be 4f 00 00 00       	mov    $0x4f,%esi
+  800685:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  80068c:	00 00 00 
+  80068f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800694:	48 b9 a3 07 80 00 00 	movabs $0x8007a3,%rcx
+  80069b:	00 00 00 
+  80069e:	ff d1                	call   *%rcx
+        if (child < 0) panic("spawn /hello: %i", child);
+  8006a0:	89 c1                	mov    %eax,%ecx
+  8006a2:	48 ba 0d 5a 80 00 00 	movabs $0x805a0d,%rdx
+  8006a9:	00 00 00 
+  8006ac:	be 55 00 00 00       	mov    $0x55,%esi
+  8006b1:	48 bf 8a 59 80 00 00 	movabs $0x80598a,%rdi
+  8006b8:	00 00 00 
+  8006bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006c0:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  8006c7:	00 00 00 
+  8006ca:	41 ff d0             	call   *%r8
+
+00000000008006cd <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  8006cd:	55                   	push   %rbp
+  8006ce:	48 89 e5             	mov    %rsp,%rbp
+  8006d1:	41 56                	push   %r14
+  8006d3:	41 55                	push   %r13
+  8006d5:	41 54                	push   %r12
+  8006d7:	53                   	push   %rbx
+  8006d8:	41 89 fd             	mov    %edi,%r13d
+  8006db:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8006de:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  8006e5:	00 00 00 
+  8006e8:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  8006ef:	00 00 00 
+  8006f2:	48 39 c2             	cmp    %rax,%rdx
+  8006f5:	73 17                	jae    80070e <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8006f7:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8006fa:	49 89 c4             	mov    %rax,%r12
+  8006fd:	48 83 c3 08          	add    $0x8,%rbx
+  800701:	b8 00 00 00 00       	mov    $0x0,%eax
+  800706:	ff 53 f8             	call   *-0x8(%rbx)
+  800709:	4c 39 e3             	cmp    %r12,%rbx
+  80070c:	72 ef                	jb     8006fd <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80070e:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  800715:	00 00 00 
+  800718:	ff d0                	call   *%rax
+  80071a:	89 c2                	mov    %eax,%edx
+  80071c:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800722:	48 89 d0             	mov    %rdx,%rax
+  800725:	48 c1 e0 04          	shl    $0x4,%rax
+  800729:	48 29 d0             	sub    %rdx,%rax
+  80072c:	48 c1 e0 05          	shl    $0x5,%rax
+  800730:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800737:	00 00 00 
+  80073a:	48 01 d0             	add    %rdx,%rax
+  80073d:	48 a3 00 00 82 00 00 	movabs %rax,0x820000
+  800744:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800747:	45 85 ed             	test   %r13d,%r13d
+  80074a:	7e 0d                	jle    800759 <libmain+0x8c>
+  80074c:	49 8b 06             	mov    (%r14),%rax
+  80074f:	48 a3 00 70 80 00 00 	movabs %rax,0x807000
+  800756:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800759:	4c 89 f6             	mov    %r14,%rsi
+  80075c:	44 89 ef             	mov    %r13d,%edi
+  80075f:	48 b8 a4 02 80 00 00 	movabs $0x8002a4,%rax
+  800766:	00 00 00 
+  800769:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80076b:	48 b8 80 07 80 00 00 	movabs $0x800780,%rax
+  800772:	00 00 00 
+  800775:	ff d0                	call   *%rax
+#endif
+}
+  800777:	5b                   	pop    %rbx
+  800778:	41 5c                	pop    %r12
+  80077a:	41 5d                	pop    %r13
+  80077c:	41 5e                	pop    %r14
+  80077e:	5d                   	pop    %rbp
+  80077f:	c3                   	ret
+
+0000000000800780 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800780:	55                   	push   %rbp
+  800781:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800784:	48 b8 d0 1d 80 00 00 	movabs $0x801dd0,%rax
+  80078b:	00 00 00 
+  80078e:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800790:	bf 00 00 00 00       	mov    $0x0,%edi
+  800795:	48 b8 87 16 80 00 00 	movabs $0x801687,%rax
+  80079c:	00 00 00 
+  80079f:	ff d0                	call   *%rax
+}
+  8007a1:	5d                   	pop    %rbp
+  8007a2:	c3                   	ret
+
+00000000008007a3 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8007a3:	55                   	push   %rbp
+  8007a4:	48 89 e5             	mov    %rsp,%rbp
+  8007a7:	41 56                	push   %r14
+  8007a9:	41 55                	push   %r13
+  8007ab:	41 54                	push   %r12
+  8007ad:	53                   	push   %rbx
+  8007ae:	48 83 ec 50          	sub    $0x50,%rsp
+  8007b2:	49 89 fc             	mov    %rdi,%r12
+  8007b5:	41 89 f5             	mov    %esi,%r13d
+  8007b8:	48 89 d3             	mov    %rdx,%rbx
+  8007bb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8007bf:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8007c3:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8007c7:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8007ce:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8007d2:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8007d6:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8007da:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8007de:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  8007e5:	00 00 00 
+  8007e8:	4c 8b 30             	mov    (%rax),%r14
+  8007eb:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  8007f2:	00 00 00 
+  8007f5:	ff d0                	call   *%rax
+  8007f7:	89 c6                	mov    %eax,%esi
+  8007f9:	45 89 e8             	mov    %r13d,%r8d
+  8007fc:	4c 89 e1             	mov    %r12,%rcx
+  8007ff:	4c 89 f2             	mov    %r14,%rdx
+  800802:	48 bf 28 5b 80 00 00 	movabs $0x805b28,%rdi
+  800809:	00 00 00 
+  80080c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800811:	49 bc f3 08 80 00 00 	movabs $0x8008f3,%r12
+  800818:	00 00 00 
+  80081b:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80081e:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800822:	48 89 df             	mov    %rbx,%rdi
+  800825:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  80082c:	00 00 00 
+  80082f:	ff d0                	call   *%rax
+    cprintf("\n");
+  800831:	48 bf 23 61 80 00 00 	movabs $0x806123,%rdi
+  800838:	00 00 00 
+  80083b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800840:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800843:	cc                   	int3
+  800844:	eb fd                	jmp    800843 <_panic+0xa0>
+
+0000000000800846 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800846:	55                   	push   %rbp
+  800847:	48 89 e5             	mov    %rsp,%rbp
+  80084a:	53                   	push   %rbx
+  80084b:	48 83 ec 08          	sub    $0x8,%rsp
+  80084f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800852:	8b 06                	mov    (%rsi),%eax
+  800854:	8d 50 01             	lea    0x1(%rax),%edx
+  800857:	89 16                	mov    %edx,(%rsi)
+  800859:	48 98                	cltq
+  80085b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800860:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800866:	74 0a                	je     800872 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800868:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80086c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800870:	c9                   	leave
+  800871:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800872:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800876:	be ff 00 00 00       	mov    $0xff,%esi
+  80087b:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  800882:	00 00 00 
+  800885:	ff d0                	call   *%rax
+        state->offset = 0;
+  800887:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80088d:	eb d9                	jmp    800868 <putch+0x22>
+
+000000000080088f <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80088f:	55                   	push   %rbp
+  800890:	48 89 e5             	mov    %rsp,%rbp
+  800893:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80089a:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80089d:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8008a4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8008b1:	48 89 f1             	mov    %rsi,%rcx
+  8008b4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8008bb:	48 bf 46 08 80 00 00 	movabs $0x800846,%rdi
+  8008c2:	00 00 00 
+  8008c5:	48 b8 43 0a 80 00 00 	movabs $0x800a43,%rax
+  8008cc:	00 00 00 
+  8008cf:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8008d1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8008d8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8008df:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  8008e6:	00 00 00 
+  8008e9:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8008eb:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8008f1:	c9                   	leave
+  8008f2:	c3                   	ret
+
+00000000008008f3 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8008f3:	55                   	push   %rbp
+  8008f4:	48 89 e5             	mov    %rsp,%rbp
+  8008f7:	48 83 ec 50          	sub    $0x50,%rsp
+  8008fb:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8008ff:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800903:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800907:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80090b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80090f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800916:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80091a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800922:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800926:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80092a:	48 b8 8f 08 80 00 00 	movabs $0x80088f,%rax
+  800931:	00 00 00 
+  800934:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800936:	c9                   	leave
+  800937:	c3                   	ret
+
+0000000000800938 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800938:	55                   	push   %rbp
+  800939:	48 89 e5             	mov    %rsp,%rbp
+  80093c:	41 57                	push   %r15
+  80093e:	41 56                	push   %r14
+  800940:	41 55                	push   %r13
+  800942:	41 54                	push   %r12
+  800944:	53                   	push   %rbx
+  800945:	48 83 ec 18          	sub    $0x18,%rsp
+  800949:	49 89 fc             	mov    %rdi,%r12
+  80094c:	49 89 f5             	mov    %rsi,%r13
+  80094f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800953:	8b 45 10             	mov    0x10(%rbp),%eax
+  800956:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800959:	41 89 cf             	mov    %ecx,%r15d
+  80095c:	4c 39 fa             	cmp    %r15,%rdx
+  80095f:	73 5b                	jae    8009bc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800961:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800965:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800969:	85 db                	test   %ebx,%ebx
+  80096b:	7e 0e                	jle    80097b <print_num+0x43>
+            putch(padc, put_arg);
+  80096d:	4c 89 ee             	mov    %r13,%rsi
+  800970:	44 89 f7             	mov    %r14d,%edi
+  800973:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800976:	83 eb 01             	sub    $0x1,%ebx
+  800979:	75 f2                	jne    80096d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80097b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80097f:	48 b9 5c 5b 80 00 00 	movabs $0x805b5c,%rcx
+  800986:	00 00 00 
+  800989:	48 b8 4b 5b 80 00 00 	movabs $0x805b4b,%rax
+  800990:	00 00 00 
+  800993:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800997:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80099b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009a0:	49 f7 f7             	div    %r15
+  8009a3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8009a7:	4c 89 ee             	mov    %r13,%rsi
+  8009aa:	41 ff d4             	call   *%r12
+}
+  8009ad:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8009b1:	5b                   	pop    %rbx
+  8009b2:	41 5c                	pop    %r12
+  8009b4:	41 5d                	pop    %r13
+  8009b6:	41 5e                	pop    %r14
+  8009b8:	41 5f                	pop    %r15
+  8009ba:	5d                   	pop    %rbp
+  8009bb:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8009bc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8009c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8009c5:	49 f7 f7             	div    %r15
+  8009c8:	48 83 ec 08          	sub    $0x8,%rsp
+  8009cc:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8009d0:	52                   	push   %rdx
+  8009d1:	45 0f be c9          	movsbl %r9b,%r9d
+  8009d5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8009d9:	48 89 c2             	mov    %rax,%rdx
+  8009dc:	48 b8 38 09 80 00 00 	movabs $0x800938,%rax
+  8009e3:	00 00 00 
+  8009e6:	ff d0                	call   *%rax
+  8009e8:	48 83 c4 10          	add    $0x10,%rsp
+  8009ec:	eb 8d                	jmp    80097b <print_num+0x43>
+
+00000000008009ee <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8009ee:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8009f2:	48 8b 06             	mov    (%rsi),%rax
+  8009f5:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8009f9:	73 0a                	jae    800a05 <sprintputch+0x17>
+        *state->start++ = ch;
+  8009fb:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8009ff:	48 89 16             	mov    %rdx,(%rsi)
+  800a02:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800a05:	c3                   	ret
+
+0000000000800a06 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800a06:	55                   	push   %rbp
+  800a07:	48 89 e5             	mov    %rsp,%rbp
+  800a0a:	48 83 ec 50          	sub    $0x50,%rsp
+  800a0e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800a12:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800a16:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800a1a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800a21:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800a25:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a29:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800a2d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800a31:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800a35:	48 b8 43 0a 80 00 00 	movabs $0x800a43,%rax
+  800a3c:	00 00 00 
+  800a3f:	ff d0                	call   *%rax
+}
+  800a41:	c9                   	leave
+  800a42:	c3                   	ret
+
+0000000000800a43 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800a43:	55                   	push   %rbp
+  800a44:	48 89 e5             	mov    %rsp,%rbp
+  800a47:	41 57                	push   %r15
+  800a49:	41 56                	push   %r14
+  800a4b:	41 55                	push   %r13
+  800a4d:	41 54                	push   %r12
+  800a4f:	53                   	push   %rbx
+  800a50:	48 83 ec 38          	sub    $0x38,%rsp
+  800a54:	49 89 fe             	mov    %rdi,%r14
+  800a57:	49 89 f5             	mov    %rsi,%r13
+  800a5a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800a5d:	48 8b 01             	mov    (%rcx),%rax
+  800a60:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800a64:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800a68:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a6c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800a70:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800a74:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800a78:	0f b6 3b             	movzbl (%rbx),%edi
+  800a7b:	40 80 ff 25          	cmp    $0x25,%dil
+  800a7f:	74 18                	je     800a99 <vprintfmt+0x56>
+            if (!ch) return;
+  800a81:	40 84 ff             	test   %dil,%dil
+  800a84:	0f 84 b1 06 00 00    	je     80113b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800a8a:	40 0f b6 ff          	movzbl %dil,%edi
+  800a8e:	4c 89 ee             	mov    %r13,%rsi
+  800a91:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800a94:	4c 89 e3             	mov    %r12,%rbx
+  800a97:	eb db                	jmp    800a74 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800a99:	be 00 00 00 00       	mov    $0x0,%esi
+  800a9e:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800aa2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800aa7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800aad:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800ab4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ab8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800abd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800ac2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800ac5:	83 e8 23             	sub    $0x23,%eax
+  800ac8:	3c 57                	cmp    $0x57,%al
+  800aca:	0f 87 51 06 00 00    	ja     801121 <vprintfmt+0x6de>
+  800ad0:	0f b6 c0             	movzbl %al,%eax
+  800ad3:	48 b9 00 5d 80 00 00 	movabs $0x805d00,%rcx
+  800ada:	00 00 00 
+  800add:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800ae0:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800ae3:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ae7:	eb cf                	jmp    800ab8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ae9:	49 89 dc             	mov    %rbx,%r12
+  800aec:	be 01 00 00 00       	mov    $0x1,%esi
+  800af1:	eb c5                	jmp    800ab8 <vprintfmt+0x75>
+            padc = ch;
+  800af3:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800af7:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800afa:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800afd:	eb b9                	jmp    800ab8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800aff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b02:	83 f8 2f             	cmp    $0x2f,%eax
+  800b05:	77 24                	ja     800b2b <vprintfmt+0xe8>
+  800b07:	89 c1                	mov    %eax,%ecx
+  800b09:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800b0d:	83 c0 08             	add    $0x8,%eax
+  800b10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b13:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800b16:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800b19:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800b1d:	79 99                	jns    800ab8 <vprintfmt+0x75>
+                width = precision;
+  800b1f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800b23:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800b29:	eb 8d                	jmp    800ab8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800b2b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800b2f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800b33:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b37:	eb da                	jmp    800b13 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800b39:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800b3e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b42:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800b48:	3c 39                	cmp    $0x39,%al
+  800b4a:	77 1c                	ja     800b68 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800b4c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800b50:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800b54:	0f b6 c0             	movzbl %al,%eax
+  800b57:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800b5c:	0f b6 03             	movzbl (%rbx),%eax
+  800b5f:	3c 39                	cmp    $0x39,%al
+  800b61:	76 e9                	jbe    800b4c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800b63:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800b66:	eb b1                	jmp    800b19 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800b68:	49 89 dc             	mov    %rbx,%r12
+  800b6b:	eb ac                	jmp    800b19 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800b6d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800b70:	85 c9                	test   %ecx,%ecx
+  800b72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800b77:	0f 49 c1             	cmovns %ecx,%eax
+  800b7a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800b7d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b80:	e9 33 ff ff ff       	jmp    800ab8 <vprintfmt+0x75>
+            lflag++;
+  800b85:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800b88:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800b8b:	e9 28 ff ff ff       	jmp    800ab8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800b90:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b93:	83 f8 2f             	cmp    $0x2f,%eax
+  800b96:	77 19                	ja     800bb1 <vprintfmt+0x16e>
+  800b98:	89 c2                	mov    %eax,%edx
+  800b9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9e:	83 c0 08             	add    $0x8,%eax
+  800ba1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba4:	8b 3a                	mov    (%rdx),%edi
+  800ba6:	4c 89 ee             	mov    %r13,%rsi
+  800ba9:	41 ff d6             	call   *%r14
+            break;
+  800bac:	e9 c3 fe ff ff       	jmp    800a74 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800bb1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbd:	eb e5                	jmp    800ba4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800bbf:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc2:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc5:	77 5a                	ja     800c21 <vprintfmt+0x1de>
+  800bc7:	89 c2                	mov    %eax,%edx
+  800bc9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bcd:	83 c0 08             	add    $0x8,%eax
+  800bd0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800bd3:	8b 02                	mov    (%rdx),%eax
+  800bd5:	89 c1                	mov    %eax,%ecx
+  800bd7:	f7 d9                	neg    %ecx
+  800bd9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800bdc:	83 f9 16             	cmp    $0x16,%ecx
+  800bdf:	7f 4e                	jg     800c2f <vprintfmt+0x1ec>
+  800be1:	48 63 c1             	movslq %ecx,%rax
+  800be4:	48 ba c0 5f 80 00 00 	movabs $0x805fc0,%rdx
+  800beb:	00 00 00 
+  800bee:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800bf2:	48 85 c0             	test   %rax,%rax
+  800bf5:	74 38                	je     800c2f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800bf7:	48 89 c1             	mov    %rax,%rcx
+  800bfa:	48 ba 63 62 80 00 00 	movabs $0x806263,%rdx
+  800c01:	00 00 00 
+  800c04:	4c 89 ee             	mov    %r13,%rsi
+  800c07:	4c 89 f7             	mov    %r14,%rdi
+  800c0a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c0f:	49 b8 06 0a 80 00 00 	movabs $0x800a06,%r8
+  800c16:	00 00 00 
+  800c19:	41 ff d0             	call   *%r8
+  800c1c:	e9 53 fe ff ff       	jmp    800a74 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800c21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2d:	eb a4                	jmp    800bd3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800c2f:	48 ba 74 5b 80 00 00 	movabs $0x805b74,%rdx
+  800c36:	00 00 00 
+  800c39:	4c 89 ee             	mov    %r13,%rsi
+  800c3c:	4c 89 f7             	mov    %r14,%rdi
+  800c3f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c44:	49 b8 06 0a 80 00 00 	movabs $0x800a06,%r8
+  800c4b:	00 00 00 
+  800c4e:	41 ff d0             	call   *%r8
+  800c51:	e9 1e fe ff ff       	jmp    800a74 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800c56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c59:	83 f8 2f             	cmp    $0x2f,%eax
+  800c5c:	77 6c                	ja     800cca <vprintfmt+0x287>
+  800c5e:	89 c2                	mov    %eax,%edx
+  800c60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c64:	83 c0 08             	add    $0x8,%eax
+  800c67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c6a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800c6d:	48 85 d2             	test   %rdx,%rdx
+  800c70:	48 b8 6d 5b 80 00 00 	movabs $0x805b6d,%rax
+  800c77:	00 00 00 
+  800c7a:	48 0f 45 c2          	cmovne %rdx,%rax
+  800c7e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800c82:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800c86:	7e 06                	jle    800c8e <vprintfmt+0x24b>
+  800c88:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800c8c:	75 4a                	jne    800cd8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800c8e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800c92:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800c96:	0f b6 00             	movzbl (%rax),%eax
+  800c99:	84 c0                	test   %al,%al
+  800c9b:	0f 85 9a 00 00 00    	jne    800d3b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800ca1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800ca4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800ca8:	85 c0                	test   %eax,%eax
+  800caa:	0f 8e c4 fd ff ff    	jle    800a74 <vprintfmt+0x31>
+  800cb0:	4c 89 ee             	mov    %r13,%rsi
+  800cb3:	bf 20 00 00 00       	mov    $0x20,%edi
+  800cb8:	41 ff d6             	call   *%r14
+  800cbb:	41 83 ec 01          	sub    $0x1,%r12d
+  800cbf:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800cc3:	75 eb                	jne    800cb0 <vprintfmt+0x26d>
+  800cc5:	e9 aa fd ff ff       	jmp    800a74 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800cca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cd2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cd6:	eb 92                	jmp    800c6a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800cd8:	49 63 f7             	movslq %r15d,%rsi
+  800cdb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800cdf:	48 b8 f5 11 80 00 00 	movabs $0x8011f5,%rax
+  800ce6:	00 00 00 
+  800ce9:	ff d0                	call   *%rax
+  800ceb:	48 89 c2             	mov    %rax,%rdx
+  800cee:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800cf1:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800cf3:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800cf6:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800cf9:	85 c0                	test   %eax,%eax
+  800cfb:	7e 91                	jle    800c8e <vprintfmt+0x24b>
+  800cfd:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800d02:	4c 89 ee             	mov    %r13,%rsi
+  800d05:	44 89 e7             	mov    %r12d,%edi
+  800d08:	41 ff d6             	call   *%r14
+  800d0b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d0f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800d12:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800d15:	75 eb                	jne    800d02 <vprintfmt+0x2bf>
+  800d17:	e9 72 ff ff ff       	jmp    800c8e <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d1c:	0f b6 f8             	movzbl %al,%edi
+  800d1f:	4c 89 ee             	mov    %r13,%rsi
+  800d22:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800d25:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800d29:	49 83 c4 01          	add    $0x1,%r12
+  800d2d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800d33:	84 c0                	test   %al,%al
+  800d35:	0f 84 66 ff ff ff    	je     800ca1 <vprintfmt+0x25e>
+  800d3b:	45 85 ff             	test   %r15d,%r15d
+  800d3e:	78 0a                	js     800d4a <vprintfmt+0x307>
+  800d40:	41 83 ef 01          	sub    $0x1,%r15d
+  800d44:	0f 88 57 ff ff ff    	js     800ca1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800d4a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800d4e:	74 cc                	je     800d1c <vprintfmt+0x2d9>
+  800d50:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800d53:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800d58:	80 fa 5e             	cmp    $0x5e,%dl
+  800d5b:	77 c2                	ja     800d1f <vprintfmt+0x2dc>
+  800d5d:	eb bd                	jmp    800d1c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800d5f:	40 84 f6             	test   %sil,%sil
+  800d62:	75 26                	jne    800d8a <vprintfmt+0x347>
+    switch (lflag) {
+  800d64:	85 d2                	test   %edx,%edx
+  800d66:	74 59                	je     800dc1 <vprintfmt+0x37e>
+  800d68:	83 fa 01             	cmp    $0x1,%edx
+  800d6b:	74 7b                	je     800de8 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800d6d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d70:	83 f8 2f             	cmp    $0x2f,%eax
+  800d73:	0f 87 96 00 00 00    	ja     800e0f <vprintfmt+0x3cc>
+  800d79:	89 c2                	mov    %eax,%edx
+  800d7b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d7f:	83 c0 08             	add    $0x8,%eax
+  800d82:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d85:	4c 8b 22             	mov    (%rdx),%r12
+  800d88:	eb 17                	jmp    800da1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800d8a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8d:	83 f8 2f             	cmp    $0x2f,%eax
+  800d90:	77 21                	ja     800db3 <vprintfmt+0x370>
+  800d92:	89 c2                	mov    %eax,%edx
+  800d94:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d98:	83 c0 08             	add    $0x8,%eax
+  800d9b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d9e:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800da1:	4d 85 e4             	test   %r12,%r12
+  800da4:	78 7a                	js     800e20 <vprintfmt+0x3dd>
+            num = i;
+  800da6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800da9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800dae:	e9 50 02 00 00       	jmp    801003 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800db3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800db7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dbb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800dbf:	eb dd                	jmp    800d9e <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800dc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800dc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800dc7:	77 11                	ja     800dda <vprintfmt+0x397>
+  800dc9:	89 c2                	mov    %eax,%edx
+  800dcb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dcf:	83 c0 08             	add    $0x8,%eax
+  800dd2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dd5:	4c 63 22             	movslq (%rdx),%r12
+  800dd8:	eb c7                	jmp    800da1 <vprintfmt+0x35e>
+  800dda:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dde:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800de2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800de6:	eb ed                	jmp    800dd5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800de8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800deb:	83 f8 2f             	cmp    $0x2f,%eax
+  800dee:	77 11                	ja     800e01 <vprintfmt+0x3be>
+  800df0:	89 c2                	mov    %eax,%edx
+  800df2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800df6:	83 c0 08             	add    $0x8,%eax
+  800df9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dfc:	4c 8b 22             	mov    (%rdx),%r12
+  800dff:	eb a0                	jmp    800da1 <vprintfmt+0x35e>
+  800e01:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e05:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0d:	eb ed                	jmp    800dfc <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800e0f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e13:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e1b:	e9 65 ff ff ff       	jmp    800d85 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800e20:	4c 89 ee             	mov    %r13,%rsi
+  800e23:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800e28:	41 ff d6             	call   *%r14
+                i = -i;
+  800e2b:	49 f7 dc             	neg    %r12
+  800e2e:	e9 73 ff ff ff       	jmp    800da6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800e33:	40 84 f6             	test   %sil,%sil
+  800e36:	75 32                	jne    800e6a <vprintfmt+0x427>
+    switch (lflag) {
+  800e38:	85 d2                	test   %edx,%edx
+  800e3a:	74 5d                	je     800e99 <vprintfmt+0x456>
+  800e3c:	83 fa 01             	cmp    $0x1,%edx
+  800e3f:	0f 84 82 00 00 00    	je     800ec7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800e45:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e48:	83 f8 2f             	cmp    $0x2f,%eax
+  800e4b:	0f 87 a5 00 00 00    	ja     800ef6 <vprintfmt+0x4b3>
+  800e51:	89 c2                	mov    %eax,%edx
+  800e53:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e57:	83 c0 08             	add    $0x8,%eax
+  800e5a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e5d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e60:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800e65:	e9 99 01 00 00       	jmp    801003 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800e6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800e70:	77 19                	ja     800e8b <vprintfmt+0x448>
+  800e72:	89 c2                	mov    %eax,%edx
+  800e74:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e78:	83 c0 08             	add    $0x8,%eax
+  800e7b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e7e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800e81:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800e86:	e9 78 01 00 00       	jmp    801003 <vprintfmt+0x5c0>
+  800e8b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e8f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e93:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e97:	eb e5                	jmp    800e7e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800e99:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e9c:	83 f8 2f             	cmp    $0x2f,%eax
+  800e9f:	77 18                	ja     800eb9 <vprintfmt+0x476>
+  800ea1:	89 c2                	mov    %eax,%edx
+  800ea3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ea7:	83 c0 08             	add    $0x8,%eax
+  800eaa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ead:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800eaf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800eb4:	e9 4a 01 00 00       	jmp    801003 <vprintfmt+0x5c0>
+  800eb9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ebd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ec1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ec5:	eb e6                	jmp    800ead <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800ec7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800eca:	83 f8 2f             	cmp    $0x2f,%eax
+  800ecd:	77 19                	ja     800ee8 <vprintfmt+0x4a5>
+  800ecf:	89 c2                	mov    %eax,%edx
+  800ed1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ed5:	83 c0 08             	add    $0x8,%eax
+  800ed8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800edb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800ede:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800ee3:	e9 1b 01 00 00       	jmp    801003 <vprintfmt+0x5c0>
+  800ee8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800eec:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ef0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ef4:	eb e5                	jmp    800edb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800ef6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800efa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800efe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f02:	e9 56 ff ff ff       	jmp    800e5d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800f07:	40 84 f6             	test   %sil,%sil
+  800f0a:	75 2e                	jne    800f3a <vprintfmt+0x4f7>
+    switch (lflag) {
+  800f0c:	85 d2                	test   %edx,%edx
+  800f0e:	74 59                	je     800f69 <vprintfmt+0x526>
+  800f10:	83 fa 01             	cmp    $0x1,%edx
+  800f13:	74 7f                	je     800f94 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800f15:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f18:	83 f8 2f             	cmp    $0x2f,%eax
+  800f1b:	0f 87 9f 00 00 00    	ja     800fc0 <vprintfmt+0x57d>
+  800f21:	89 c2                	mov    %eax,%edx
+  800f23:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f27:	83 c0 08             	add    $0x8,%eax
+  800f2a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f2d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f30:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800f35:	e9 c9 00 00 00       	jmp    801003 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800f3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800f40:	77 19                	ja     800f5b <vprintfmt+0x518>
+  800f42:	89 c2                	mov    %eax,%edx
+  800f44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f48:	83 c0 08             	add    $0x8,%eax
+  800f4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800f51:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800f56:	e9 a8 00 00 00       	jmp    801003 <vprintfmt+0x5c0>
+  800f5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f67:	eb e5                	jmp    800f4e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800f69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800f6f:	77 15                	ja     800f86 <vprintfmt+0x543>
+  800f71:	89 c2                	mov    %eax,%edx
+  800f73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f77:	83 c0 08             	add    $0x8,%eax
+  800f7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f7d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800f7f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800f84:	eb 7d                	jmp    801003 <vprintfmt+0x5c0>
+  800f86:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f8a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f92:	eb e9                	jmp    800f7d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800f94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f97:	83 f8 2f             	cmp    $0x2f,%eax
+  800f9a:	77 16                	ja     800fb2 <vprintfmt+0x56f>
+  800f9c:	89 c2                	mov    %eax,%edx
+  800f9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fa2:	83 c0 08             	add    $0x8,%eax
+  800fa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800fa8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800fab:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800fb0:	eb 51                	jmp    801003 <vprintfmt+0x5c0>
+  800fb2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fb6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fbe:	eb e8                	jmp    800fa8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800fc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800fc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800fc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fcc:	e9 5c ff ff ff       	jmp    800f2d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800fd1:	4c 89 ee             	mov    %r13,%rsi
+  800fd4:	bf 30 00 00 00       	mov    $0x30,%edi
+  800fd9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800fdc:	4c 89 ee             	mov    %r13,%rsi
+  800fdf:	bf 78 00 00 00       	mov    $0x78,%edi
+  800fe4:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800fe7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fea:	83 f8 2f             	cmp    $0x2f,%eax
+  800fed:	77 47                	ja     801036 <vprintfmt+0x5f3>
+  800fef:	89 c2                	mov    %eax,%edx
+  800ff1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ff5:	83 c0 08             	add    $0x8,%eax
+  800ff8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ffb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ffe:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  801003:	48 83 ec 08          	sub    $0x8,%rsp
+  801007:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  80100b:	0f 94 c0             	sete   %al
+  80100e:	0f b6 c0             	movzbl %al,%eax
+  801011:	50                   	push   %rax
+  801012:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  801017:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  80101b:	4c 89 ee             	mov    %r13,%rsi
+  80101e:	4c 89 f7             	mov    %r14,%rdi
+  801021:	48 b8 38 09 80 00 00 	movabs $0x800938,%rax
+  801028:	00 00 00 
+  80102b:	ff d0                	call   *%rax
+            break;
+  80102d:	48 83 c4 10          	add    $0x10,%rsp
+  801031:	e9 3e fa ff ff       	jmp    800a74 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  801036:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80103a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80103e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801042:	eb b7                	jmp    800ffb <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801044:	40 84 f6             	test   %sil,%sil
+  801047:	75 2b                	jne    801074 <vprintfmt+0x631>
+    switch (lflag) {
+  801049:	85 d2                	test   %edx,%edx
+  80104b:	74 56                	je     8010a3 <vprintfmt+0x660>
+  80104d:	83 fa 01             	cmp    $0x1,%edx
+  801050:	74 7f                	je     8010d1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801052:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801055:	83 f8 2f             	cmp    $0x2f,%eax
+  801058:	0f 87 a2 00 00 00    	ja     801100 <vprintfmt+0x6bd>
+  80105e:	89 c2                	mov    %eax,%edx
+  801060:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801064:	83 c0 08             	add    $0x8,%eax
+  801067:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80106a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80106d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801072:	eb 8f                	jmp    801003 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801074:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801077:	83 f8 2f             	cmp    $0x2f,%eax
+  80107a:	77 19                	ja     801095 <vprintfmt+0x652>
+  80107c:	89 c2                	mov    %eax,%edx
+  80107e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801082:	83 c0 08             	add    $0x8,%eax
+  801085:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801088:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80108b:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801090:	e9 6e ff ff ff       	jmp    801003 <vprintfmt+0x5c0>
+  801095:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801099:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80109d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010a1:	eb e5                	jmp    801088 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  8010a3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010a6:	83 f8 2f             	cmp    $0x2f,%eax
+  8010a9:	77 18                	ja     8010c3 <vprintfmt+0x680>
+  8010ab:	89 c2                	mov    %eax,%edx
+  8010ad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010b1:	83 c0 08             	add    $0x8,%eax
+  8010b4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010b7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  8010b9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8010be:	e9 40 ff ff ff       	jmp    801003 <vprintfmt+0x5c0>
+  8010c3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010c7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010cb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010cf:	eb e6                	jmp    8010b7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8010d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8010d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8010d7:	77 19                	ja     8010f2 <vprintfmt+0x6af>
+  8010d9:	89 c2                	mov    %eax,%edx
+  8010db:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8010df:	83 c0 08             	add    $0x8,%eax
+  8010e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8010e5:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8010e8:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8010ed:	e9 11 ff ff ff       	jmp    801003 <vprintfmt+0x5c0>
+  8010f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010fe:	eb e5                	jmp    8010e5 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  801100:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801104:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801108:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80110c:	e9 59 ff ff ff       	jmp    80106a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  801111:	4c 89 ee             	mov    %r13,%rsi
+  801114:	bf 25 00 00 00       	mov    $0x25,%edi
+  801119:	41 ff d6             	call   *%r14
+            break;
+  80111c:	e9 53 f9 ff ff       	jmp    800a74 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801121:	4c 89 ee             	mov    %r13,%rsi
+  801124:	bf 25 00 00 00       	mov    $0x25,%edi
+  801129:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  80112c:	48 83 eb 01          	sub    $0x1,%rbx
+  801130:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801134:	75 f6                	jne    80112c <vprintfmt+0x6e9>
+  801136:	e9 39 f9 ff ff       	jmp    800a74 <vprintfmt+0x31>
+}
+  80113b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80113f:	5b                   	pop    %rbx
+  801140:	41 5c                	pop    %r12
+  801142:	41 5d                	pop    %r13
+  801144:	41 5e                	pop    %r14
+  801146:	41 5f                	pop    %r15
+  801148:	5d                   	pop    %rbp
+  801149:	c3                   	ret
+
+000000000080114a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80114a:	55                   	push   %rbp
+  80114b:	48 89 e5             	mov    %rsp,%rbp
+  80114e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801152:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  801156:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80115b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  80115f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  801166:	48 85 ff             	test   %rdi,%rdi
+  801169:	74 2b                	je     801196 <vsnprintf+0x4c>
+  80116b:	48 85 f6             	test   %rsi,%rsi
+  80116e:	74 26                	je     801196 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801170:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801174:	48 bf ee 09 80 00 00 	movabs $0x8009ee,%rdi
+  80117b:	00 00 00 
+  80117e:	48 b8 43 0a 80 00 00 	movabs $0x800a43,%rax
+  801185:	00 00 00 
+  801188:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80118a:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  80118e:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801191:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801194:	c9                   	leave
+  801195:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  801196:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80119b:	eb f7                	jmp    801194 <vsnprintf+0x4a>
+
+000000000080119d <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  80119d:	55                   	push   %rbp
+  80119e:	48 89 e5             	mov    %rsp,%rbp
+  8011a1:	48 83 ec 50          	sub    $0x50,%rsp
+  8011a5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8011a9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8011ad:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8011b1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8011b8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8011bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011c0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8011c4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8011c8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8011cc:	48 b8 4a 11 80 00 00 	movabs $0x80114a,%rax
+  8011d3:	00 00 00 
+  8011d6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8011d8:	c9                   	leave
+  8011d9:	c3                   	ret
+
+00000000008011da <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8011da:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8011dd:	74 10                	je     8011ef <strlen+0x15>
+    size_t n = 0;
+  8011df:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8011e4:	48 83 c0 01          	add    $0x1,%rax
+  8011e8:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8011ec:	75 f6                	jne    8011e4 <strlen+0xa>
+  8011ee:	c3                   	ret
+    size_t n = 0;
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8011f4:	c3                   	ret
+
+00000000008011f5 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8011f5:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8011f8:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8011fd:	48 85 f6             	test   %rsi,%rsi
+  801200:	74 11                	je     801213 <strnlen+0x1e>
+  801202:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  801206:	74 0c                	je     801214 <strnlen+0x1f>
+  801208:	48 83 c2 01          	add    $0x1,%rdx
+  80120c:	48 39 d0             	cmp    %rdx,%rax
+  80120f:	75 f1                	jne    801202 <strnlen+0xd>
+  801211:	eb 04                	jmp    801217 <strnlen+0x22>
+  801213:	c3                   	ret
+  801214:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  801217:	c3                   	ret
+
+0000000000801218 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  801218:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  80121b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801220:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801224:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  801227:	48 83 c2 01          	add    $0x1,%rdx
+  80122b:	84 c9                	test   %cl,%cl
+  80122d:	75 f1                	jne    801220 <strcpy+0x8>
+        ;
+    return res;
+}
+  80122f:	c3                   	ret
+
+0000000000801230 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801230:	55                   	push   %rbp
+  801231:	48 89 e5             	mov    %rsp,%rbp
+  801234:	41 54                	push   %r12
+  801236:	53                   	push   %rbx
+  801237:	48 89 fb             	mov    %rdi,%rbx
+  80123a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  80123d:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  801244:	00 00 00 
+  801247:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  801249:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  80124d:	4c 89 e6             	mov    %r12,%rsi
+  801250:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  801257:	00 00 00 
+  80125a:	ff d0                	call   *%rax
+    return dst;
+}
+  80125c:	48 89 d8             	mov    %rbx,%rax
+  80125f:	5b                   	pop    %rbx
+  801260:	41 5c                	pop    %r12
+  801262:	5d                   	pop    %rbp
+  801263:	c3                   	ret
+
+0000000000801264 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801264:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  801267:	48 85 d2             	test   %rdx,%rdx
+  80126a:	74 1f                	je     80128b <strncpy+0x27>
+  80126c:	48 01 fa             	add    %rdi,%rdx
+  80126f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801272:	48 83 c1 01          	add    $0x1,%rcx
+  801276:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80127a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  80127e:	41 80 f8 01          	cmp    $0x1,%r8b
+  801282:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  801286:	48 39 ca             	cmp    %rcx,%rdx
+  801289:	75 e7                	jne    801272 <strncpy+0xe>
+    }
+    return ret;
+}
+  80128b:	c3                   	ret
+
+000000000080128c <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  80128c:	48 89 f8             	mov    %rdi,%rax
+  80128f:	48 85 d2             	test   %rdx,%rdx
+  801292:	74 24                	je     8012b8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801294:	48 83 ea 01          	sub    $0x1,%rdx
+  801298:	74 1b                	je     8012b5 <strlcpy+0x29>
+  80129a:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  80129e:	0f b6 16             	movzbl (%rsi),%edx
+  8012a1:	84 d2                	test   %dl,%dl
+  8012a3:	74 10                	je     8012b5 <strlcpy+0x29>
+            *dst++ = *src++;
+  8012a5:	48 83 c6 01          	add    $0x1,%rsi
+  8012a9:	48 83 c0 01          	add    $0x1,%rax
+  8012ad:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  8012b0:	48 39 c8             	cmp    %rcx,%rax
+  8012b3:	75 e9                	jne    80129e <strlcpy+0x12>
+        *dst = '\0';
+  8012b5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  8012b8:	48 29 f8             	sub    %rdi,%rax
+}
+  8012bb:	c3                   	ret
+
+00000000008012bc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8012bc:	0f b6 07             	movzbl (%rdi),%eax
+  8012bf:	84 c0                	test   %al,%al
+  8012c1:	74 13                	je     8012d6 <strcmp+0x1a>
+  8012c3:	38 06                	cmp    %al,(%rsi)
+  8012c5:	75 0f                	jne    8012d6 <strcmp+0x1a>
+  8012c7:	48 83 c7 01          	add    $0x1,%rdi
+  8012cb:	48 83 c6 01          	add    $0x1,%rsi
+  8012cf:	0f b6 07             	movzbl (%rdi),%eax
+  8012d2:	84 c0                	test   %al,%al
+  8012d4:	75 ed                	jne    8012c3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8012d6:	0f b6 c0             	movzbl %al,%eax
+  8012d9:	0f b6 16             	movzbl (%rsi),%edx
+  8012dc:	29 d0                	sub    %edx,%eax
+}
+  8012de:	c3                   	ret
+
+00000000008012df <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8012df:	48 85 d2             	test   %rdx,%rdx
+  8012e2:	74 1f                	je     801303 <strncmp+0x24>
+  8012e4:	0f b6 07             	movzbl (%rdi),%eax
+  8012e7:	84 c0                	test   %al,%al
+  8012e9:	74 1e                	je     801309 <strncmp+0x2a>
+  8012eb:	3a 06                	cmp    (%rsi),%al
+  8012ed:	75 1a                	jne    801309 <strncmp+0x2a>
+  8012ef:	48 83 c7 01          	add    $0x1,%rdi
+  8012f3:	48 83 c6 01          	add    $0x1,%rsi
+  8012f7:	48 83 ea 01          	sub    $0x1,%rdx
+  8012fb:	75 e7                	jne    8012e4 <strncmp+0x5>
+
+    if (!n) return 0;
+  8012fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801302:	c3                   	ret
+  801303:	b8 00 00 00 00       	mov    $0x0,%eax
+  801308:	c3                   	ret
+  801309:	48 85 d2             	test   %rdx,%rdx
+  80130c:	74 09                	je     801317 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  80130e:	0f b6 07             	movzbl (%rdi),%eax
+  801311:	0f b6 16             	movzbl (%rsi),%edx
+  801314:	29 d0                	sub    %edx,%eax
+  801316:	c3                   	ret
+    if (!n) return 0;
+  801317:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80131c:	c3                   	ret
+
+000000000080131d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  80131d:	0f b6 17             	movzbl (%rdi),%edx
+  801320:	84 d2                	test   %dl,%dl
+  801322:	74 18                	je     80133c <strchr+0x1f>
+        if (*str == c) {
+  801324:	0f be d2             	movsbl %dl,%edx
+  801327:	39 f2                	cmp    %esi,%edx
+  801329:	74 17                	je     801342 <strchr+0x25>
+    for (; *str; str++) {
+  80132b:	48 83 c7 01          	add    $0x1,%rdi
+  80132f:	0f b6 17             	movzbl (%rdi),%edx
+  801332:	84 d2                	test   %dl,%dl
+  801334:	75 ee                	jne    801324 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801336:	b8 00 00 00 00       	mov    $0x0,%eax
+  80133b:	c3                   	ret
+  80133c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801341:	c3                   	ret
+  801342:	48 89 f8             	mov    %rdi,%rax
+}
+  801345:	c3                   	ret
+
+0000000000801346 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801346:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801349:	0f b6 17             	movzbl (%rdi),%edx
+  80134c:	84 d2                	test   %dl,%dl
+  80134e:	74 13                	je     801363 <strfind+0x1d>
+  801350:	0f be d2             	movsbl %dl,%edx
+  801353:	39 f2                	cmp    %esi,%edx
+  801355:	74 0b                	je     801362 <strfind+0x1c>
+  801357:	48 83 c0 01          	add    $0x1,%rax
+  80135b:	0f b6 10             	movzbl (%rax),%edx
+  80135e:	84 d2                	test   %dl,%dl
+  801360:	75 ee                	jne    801350 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801362:	c3                   	ret
+  801363:	c3                   	ret
+
+0000000000801364 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801364:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  801367:	48 89 f8             	mov    %rdi,%rax
+  80136a:	48 f7 d8             	neg    %rax
+  80136d:	83 e0 07             	and    $0x7,%eax
+  801370:	49 89 d1             	mov    %rdx,%r9
+  801373:	49 29 c1             	sub    %rax,%r9
+  801376:	78 36                	js     8013ae <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801378:	40 0f b6 c6          	movzbl %sil,%eax
+  80137c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801383:	01 01 01 
+  801386:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80138a:	40 f6 c7 07          	test   $0x7,%dil
+  80138e:	75 38                	jne    8013c8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801390:	4c 89 c9             	mov    %r9,%rcx
+  801393:	48 c1 f9 03          	sar    $0x3,%rcx
+  801397:	74 0c                	je     8013a5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801399:	fc                   	cld
+  80139a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  80139d:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8013a1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8013a5:	4d 85 c9             	test   %r9,%r9
+  8013a8:	75 45                	jne    8013ef <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8013aa:	4c 89 c0             	mov    %r8,%rax
+  8013ad:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8013ae:	48 85 d2             	test   %rdx,%rdx
+  8013b1:	74 f7                	je     8013aa <memset+0x46>
+  8013b3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8013b6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8013b9:	48 83 c0 01          	add    $0x1,%rax
+  8013bd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8013c1:	48 39 c2             	cmp    %rax,%rdx
+  8013c4:	75 f3                	jne    8013b9 <memset+0x55>
+  8013c6:	eb e2                	jmp    8013aa <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8013c8:	40 f6 c7 01          	test   $0x1,%dil
+  8013cc:	74 06                	je     8013d4 <memset+0x70>
+  8013ce:	88 07                	mov    %al,(%rdi)
+  8013d0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8013d4:	40 f6 c7 02          	test   $0x2,%dil
+  8013d8:	74 07                	je     8013e1 <memset+0x7d>
+  8013da:	66 89 07             	mov    %ax,(%rdi)
+  8013dd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8013e1:	40 f6 c7 04          	test   $0x4,%dil
+  8013e5:	74 a9                	je     801390 <memset+0x2c>
+  8013e7:	89 07                	mov    %eax,(%rdi)
+  8013e9:	48 83 c7 04          	add    $0x4,%rdi
+  8013ed:	eb a1                	jmp    801390 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8013ef:	41 f6 c1 04          	test   $0x4,%r9b
+  8013f3:	74 06                	je     8013fb <memset+0x97>
+  8013f5:	89 07                	mov    %eax,(%rdi)
+  8013f7:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8013fb:	41 f6 c1 02          	test   $0x2,%r9b
+  8013ff:	74 07                	je     801408 <memset+0xa4>
+  801401:	66 89 07             	mov    %ax,(%rdi)
+  801404:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801408:	41 f6 c1 01          	test   $0x1,%r9b
+  80140c:	74 9c                	je     8013aa <memset+0x46>
+  80140e:	88 07                	mov    %al,(%rdi)
+  801410:	eb 98                	jmp    8013aa <memset+0x46>
+
+0000000000801412 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  801412:	48 89 f8             	mov    %rdi,%rax
+  801415:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801418:	48 39 fe             	cmp    %rdi,%rsi
+  80141b:	73 3b                	jae    801458 <memmove+0x46>
+  80141d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801421:	48 39 d7             	cmp    %rdx,%rdi
+  801424:	73 32                	jae    801458 <memmove+0x46>
+        s += n;
+        d += n;
+  801426:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80142a:	48 89 d6             	mov    %rdx,%rsi
+  80142d:	48 09 fe             	or     %rdi,%rsi
+  801430:	48 09 ce             	or     %rcx,%rsi
+  801433:	40 f6 c6 07          	test   $0x7,%sil
+  801437:	75 12                	jne    80144b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801439:	48 83 ef 08          	sub    $0x8,%rdi
+  80143d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801441:	48 c1 e9 03          	shr    $0x3,%rcx
+  801445:	fd                   	std
+  801446:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801449:	fc                   	cld
+  80144a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80144b:	48 83 ef 01          	sub    $0x1,%rdi
+  80144f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801453:	fd                   	std
+  801454:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801456:	eb f1                	jmp    801449 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801458:	48 89 f2             	mov    %rsi,%rdx
+  80145b:	48 09 c2             	or     %rax,%rdx
+  80145e:	48 09 ca             	or     %rcx,%rdx
+  801461:	f6 c2 07             	test   $0x7,%dl
+  801464:	75 0c                	jne    801472 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  801466:	48 c1 e9 03          	shr    $0x3,%rcx
+  80146a:	48 89 c7             	mov    %rax,%rdi
+  80146d:	fc                   	cld
+  80146e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801471:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801472:	48 89 c7             	mov    %rax,%rdi
+  801475:	fc                   	cld
+  801476:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801478:	c3                   	ret
+
+0000000000801479 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801479:	55                   	push   %rbp
+  80147a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  80147d:	48 b8 12 14 80 00 00 	movabs $0x801412,%rax
+  801484:	00 00 00 
+  801487:	ff d0                	call   *%rax
+}
+  801489:	5d                   	pop    %rbp
+  80148a:	c3                   	ret
+
+000000000080148b <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80148b:	55                   	push   %rbp
+  80148c:	48 89 e5             	mov    %rsp,%rbp
+  80148f:	41 57                	push   %r15
+  801491:	41 56                	push   %r14
+  801493:	41 55                	push   %r13
+  801495:	41 54                	push   %r12
+  801497:	53                   	push   %rbx
+  801498:	48 83 ec 08          	sub    $0x8,%rsp
+  80149c:	49 89 fe             	mov    %rdi,%r14
+  80149f:	49 89 f7             	mov    %rsi,%r15
+  8014a2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8014a5:	48 89 f7             	mov    %rsi,%rdi
+  8014a8:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  8014af:	00 00 00 
+  8014b2:	ff d0                	call   *%rax
+  8014b4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8014b7:	48 89 de             	mov    %rbx,%rsi
+  8014ba:	4c 89 f7             	mov    %r14,%rdi
+  8014bd:	48 b8 f5 11 80 00 00 	movabs $0x8011f5,%rax
+  8014c4:	00 00 00 
+  8014c7:	ff d0                	call   *%rax
+  8014c9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8014cc:	48 39 c3             	cmp    %rax,%rbx
+  8014cf:	74 36                	je     801507 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8014d1:	48 89 d8             	mov    %rbx,%rax
+  8014d4:	4c 29 e8             	sub    %r13,%rax
+  8014d7:	49 39 c4             	cmp    %rax,%r12
+  8014da:	73 31                	jae    80150d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8014dc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8014e1:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8014e5:	4c 89 fe             	mov    %r15,%rsi
+  8014e8:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  8014ef:	00 00 00 
+  8014f2:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8014f4:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8014f8:	48 83 c4 08          	add    $0x8,%rsp
+  8014fc:	5b                   	pop    %rbx
+  8014fd:	41 5c                	pop    %r12
+  8014ff:	41 5d                	pop    %r13
+  801501:	41 5e                	pop    %r14
+  801503:	41 5f                	pop    %r15
+  801505:	5d                   	pop    %rbp
+  801506:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801507:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80150b:	eb eb                	jmp    8014f8 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80150d:	48 83 eb 01          	sub    $0x1,%rbx
+  801511:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801515:	48 89 da             	mov    %rbx,%rdx
+  801518:	4c 89 fe             	mov    %r15,%rsi
+  80151b:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  801522:	00 00 00 
+  801525:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801527:	49 01 de             	add    %rbx,%r14
+  80152a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80152f:	eb c3                	jmp    8014f4 <strlcat+0x69>
+
+0000000000801531 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801531:	48 85 d2             	test   %rdx,%rdx
+  801534:	74 2d                	je     801563 <memcmp+0x32>
+  801536:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80153b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  80153f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801544:	44 38 c1             	cmp    %r8b,%cl
+  801547:	75 0f                	jne    801558 <memcmp+0x27>
+    while (n-- > 0) {
+  801549:	48 83 c0 01          	add    $0x1,%rax
+  80154d:	48 39 c2             	cmp    %rax,%rdx
+  801550:	75 e9                	jne    80153b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801552:	b8 00 00 00 00       	mov    $0x0,%eax
+  801557:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801558:	0f b6 c1             	movzbl %cl,%eax
+  80155b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80155f:	44 29 c0             	sub    %r8d,%eax
+  801562:	c3                   	ret
+    return 0;
+  801563:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801568:	c3                   	ret
+
+0000000000801569 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801569:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80156d:	48 39 c7             	cmp    %rax,%rdi
+  801570:	73 0f                	jae    801581 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801572:	40 38 37             	cmp    %sil,(%rdi)
+  801575:	74 0e                	je     801585 <memfind+0x1c>
+    for (; src < end; src++) {
+  801577:	48 83 c7 01          	add    $0x1,%rdi
+  80157b:	48 39 f8             	cmp    %rdi,%rax
+  80157e:	75 f2                	jne    801572 <memfind+0x9>
+  801580:	c3                   	ret
+  801581:	48 89 f8             	mov    %rdi,%rax
+  801584:	c3                   	ret
+  801585:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801588:	c3                   	ret
+
+0000000000801589 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801589:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80158c:	0f b6 37             	movzbl (%rdi),%esi
+  80158f:	40 80 fe 20          	cmp    $0x20,%sil
+  801593:	74 06                	je     80159b <strtol+0x12>
+  801595:	40 80 fe 09          	cmp    $0x9,%sil
+  801599:	75 13                	jne    8015ae <strtol+0x25>
+  80159b:	48 83 c7 01          	add    $0x1,%rdi
+  80159f:	0f b6 37             	movzbl (%rdi),%esi
+  8015a2:	40 80 fe 20          	cmp    $0x20,%sil
+  8015a6:	74 f3                	je     80159b <strtol+0x12>
+  8015a8:	40 80 fe 09          	cmp    $0x9,%sil
+  8015ac:	74 ed                	je     80159b <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8015ae:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8015b1:	83 e0 fd             	and    $0xfffffffd,%eax
+  8015b4:	3c 01                	cmp    $0x1,%al
+  8015b6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8015ba:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8015c0:	75 0f                	jne    8015d1 <strtol+0x48>
+  8015c2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8015c5:	74 14                	je     8015db <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8015c7:	85 d2                	test   %edx,%edx
+  8015c9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8015ce:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8015d1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8015d6:	4c 63 ca             	movslq %edx,%r9
+  8015d9:	eb 36                	jmp    801611 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8015db:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8015df:	74 0f                	je     8015f0 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8015e1:	85 d2                	test   %edx,%edx
+  8015e3:	75 ec                	jne    8015d1 <strtol+0x48>
+        s++;
+  8015e5:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8015e9:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8015ee:	eb e1                	jmp    8015d1 <strtol+0x48>
+        s += 2;
+  8015f0:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8015f4:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8015f9:	eb d6                	jmp    8015d1 <strtol+0x48>
+            dig -= '0';
+  8015fb:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8015fe:	44 0f b6 c1          	movzbl %cl,%r8d
+  801602:	41 39 d0             	cmp    %edx,%r8d
+  801605:	7d 21                	jge    801628 <strtol+0x9f>
+        val = val * base + dig;
+  801607:	49 0f af c1          	imul   %r9,%rax
+  80160b:	0f b6 c9             	movzbl %cl,%ecx
+  80160e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801611:	48 83 c7 01          	add    $0x1,%rdi
+  801615:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801619:	80 f9 39             	cmp    $0x39,%cl
+  80161c:	76 dd                	jbe    8015fb <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80161e:	80 f9 7b             	cmp    $0x7b,%cl
+  801621:	77 05                	ja     801628 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801623:	83 e9 57             	sub    $0x57,%ecx
+  801626:	eb d6                	jmp    8015fe <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801628:	4d 85 d2             	test   %r10,%r10
+  80162b:	74 03                	je     801630 <strtol+0xa7>
+  80162d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801630:	48 89 c2             	mov    %rax,%rdx
+  801633:	48 f7 da             	neg    %rdx
+  801636:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80163a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80163e:	c3                   	ret
+
+000000000080163f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80163f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801644:	ba 00 00 00 00       	mov    $0x0,%edx
+  801649:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80164f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801655:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80165b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80165d:	c3                   	ret
+
+000000000080165e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80165e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801663:	bf 00 00 00 00       	mov    $0x0,%edi
+  801668:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80166d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801672:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801678:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80167e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801684:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801686:	c3                   	ret
+
+0000000000801687 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801687:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80168a:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80168f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801694:	ba 00 00 00 00       	mov    $0x0,%edx
+  801699:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80169f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016ab:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016ad:	48 85 c0             	test   %rax,%rax
+  8016b0:	7f 01                	jg     8016b3 <sys_env_destroy+0x2c>
+}
+  8016b2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8016b3:	55                   	push   %rbp
+  8016b4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016b7:	49 89 c0             	mov    %rax,%r8
+  8016ba:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8016bf:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  8016c6:	00 00 00 
+  8016c9:	be 29 00 00 00       	mov    $0x29,%esi
+  8016ce:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  8016d5:	00 00 00 
+  8016d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016dd:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  8016e4:	00 00 00 
+  8016e7:	41 ff d1             	call   *%r9
+
+00000000008016ea <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016ea:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016f4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801704:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80170a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801710:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801712:	c3                   	ret
+
+0000000000801713 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801713:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801718:	bf 00 00 00 00       	mov    $0x0,%edi
+  80171d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801722:	ba 00 00 00 00       	mov    $0x0,%edx
+  801727:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80172d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801733:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801739:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80173b:	c3                   	ret
+
+000000000080173c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80173c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801741:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801748:	00 00 00 
+  80174b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801751:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801757:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80175d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80175f:	c3                   	ret
+
+0000000000801760 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801760:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801763:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801768:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80176e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801774:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801776:	c3                   	ret
+
+0000000000801777 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801777:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80177a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801782:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80178e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801790:	48 85 c0             	test   %rax,%rax
+  801793:	7f 01                	jg     801796 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801795:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801796:	55                   	push   %rbp
+  801797:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80179a:	49 89 c0             	mov    %rax,%r8
+  80179d:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8017a2:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  8017a9:	00 00 00 
+  8017ac:	be 29 00 00 00       	mov    $0x29,%esi
+  8017b1:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  8017b8:	00 00 00 
+  8017bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017c0:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  8017c7:	00 00 00 
+  8017ca:	41 ff d1             	call   *%r9
+
+00000000008017cd <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8017cd:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8017d0:	48 63 d2             	movslq %edx,%rdx
+  8017d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017d6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017db:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8017de:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017e0:	48 85 c0             	test   %rax,%rax
+  8017e3:	7f 01                	jg     8017e6 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8017e5:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8017e6:	55                   	push   %rbp
+  8017e7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017ea:	49 89 c0             	mov    %rax,%r8
+  8017ed:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8017f2:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  8017f9:	00 00 00 
+  8017fc:	be 29 00 00 00       	mov    $0x29,%esi
+  801801:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  801808:	00 00 00 
+  80180b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801810:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  801817:	00 00 00 
+  80181a:	41 ff d1             	call   *%r9
+
+000000000080181d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80181d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801820:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801825:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80182b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801831:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801837:	0f 05                	syscall
+    if (check && ret > 0) {
+  801839:	48 85 c0             	test   %rax,%rax
+  80183c:	7f 01                	jg     80183f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80183e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80183f:	55                   	push   %rbp
+  801840:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801843:	49 89 c0             	mov    %rax,%r8
+  801846:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80184b:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  801852:	00 00 00 
+  801855:	be 29 00 00 00       	mov    $0x29,%esi
+  80185a:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  801861:	00 00 00 
+  801864:	b8 00 00 00 00       	mov    $0x0,%eax
+  801869:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  801870:	00 00 00 
+  801873:	41 ff d1             	call   *%r9
+
+0000000000801876 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801876:	48 63 f6             	movslq %esi,%rsi
+  801879:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80187c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801881:	ba 00 00 00 00       	mov    $0x0,%edx
+  801886:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80188c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801892:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801898:	0f 05                	syscall
+    if (check && ret > 0) {
+  80189a:	48 85 c0             	test   %rax,%rax
+  80189d:	7f 01                	jg     8018a0 <sys_env_set_status+0x2a>
+}
+  80189f:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8018a0:	55                   	push   %rbp
+  8018a1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018a4:	49 89 c0             	mov    %rax,%r8
+  8018a7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8018ac:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  8018b3:	00 00 00 
+  8018b6:	be 29 00 00 00       	mov    $0x29,%esi
+  8018bb:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  8018c2:	00 00 00 
+  8018c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ca:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  8018d1:	00 00 00 
+  8018d4:	41 ff d1             	call   *%r9
+
+00000000008018d7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8018d7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8018da:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8018df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8018e4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8018ea:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8018f0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018f8:	48 85 c0             	test   %rax,%rax
+  8018fb:	7f 01                	jg     8018fe <sys_env_set_trapframe+0x27>
+}
+  8018fd:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8018fe:	55                   	push   %rbp
+  8018ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801902:	49 89 c0             	mov    %rax,%r8
+  801905:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80190a:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  801911:	00 00 00 
+  801914:	be 29 00 00 00       	mov    $0x29,%esi
+  801919:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  801920:	00 00 00 
+  801923:	b8 00 00 00 00       	mov    $0x0,%eax
+  801928:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  80192f:	00 00 00 
+  801932:	41 ff d1             	call   *%r9
+
+0000000000801935 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801935:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801938:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80193d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801942:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801948:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80194e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801954:	0f 05                	syscall
+    if (check && ret > 0) {
+  801956:	48 85 c0             	test   %rax,%rax
+  801959:	7f 01                	jg     80195c <sys_env_set_pgfault_upcall+0x27>
+}
+  80195b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80195c:	55                   	push   %rbp
+  80195d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801960:	49 89 c0             	mov    %rax,%r8
+  801963:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801968:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  80196f:	00 00 00 
+  801972:	be 29 00 00 00       	mov    $0x29,%esi
+  801977:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  80197e:	00 00 00 
+  801981:	b8 00 00 00 00       	mov    $0x0,%eax
+  801986:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  80198d:	00 00 00 
+  801990:	41 ff d1             	call   *%r9
+
+0000000000801993 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801993:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801996:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801999:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80199e:	4d 63 c0             	movslq %r8d,%r8
+  8019a1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019a7:	0f 05                	syscall
+}
+  8019a9:	c3                   	ret
+
+00000000008019aa <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8019aa:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8019ad:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8019b0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019b5:	4d 63 c0             	movslq %r8d,%r8
+  8019b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019be:	0f 05                	syscall
+}
+  8019c0:	c3                   	ret
+
+00000000008019c1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8019c1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8019c6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8019c9:	45 89 c0             	mov    %r8d,%r8d
+  8019cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8019d2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8019d4:	48 85 c0             	test   %rax,%rax
+  8019d7:	7f 01                	jg     8019da <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8019d9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8019da:	55                   	push   %rbp
+  8019db:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8019de:	49 89 c0             	mov    %rax,%r8
+  8019e1:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8019e6:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  8019ed:	00 00 00 
+  8019f0:	be 29 00 00 00       	mov    $0x29,%esi
+  8019f5:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  8019fc:	00 00 00 
+  8019ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a04:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  801a0b:	00 00 00 
+  801a0e:	41 ff d1             	call   *%r9
+
+0000000000801a11 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801a11:	55                   	push   %rbp
+  801a12:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801a15:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a1b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801a20:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a25:	48 b8 c1 19 80 00 00 	movabs $0x8019c1,%rax
+  801a2c:	00 00 00 
+  801a2f:	ff d0                	call   *%rax
+}
+  801a31:	5d                   	pop    %rbp
+  801a32:	c3                   	ret
+
+0000000000801a33 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a33:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a38:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a42:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a47:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a4d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a53:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a59:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801a5b:	c3                   	ret
+
+0000000000801a5c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801a5c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801a61:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801a66:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a6b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801a71:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801a77:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801a7d:	0f 05                	syscall
+    if (check && ret > 0) {
+  801a7f:	48 85 c0             	test   %rax,%rax
+  801a82:	7f 01                	jg     801a85 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801a84:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801a85:	55                   	push   %rbp
+  801a86:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801a89:	49 89 c0             	mov    %rax,%r8
+  801a8c:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801a91:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  801a98:	00 00 00 
+  801a9b:	be 29 00 00 00       	mov    $0x29,%esi
+  801aa0:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  801aa7:	00 00 00 
+  801aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  801aaf:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  801ab6:	00 00 00 
+  801ab9:	41 ff d1             	call   *%r9
+
+0000000000801abc <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801abc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801ac1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801acb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ad0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ad6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801adc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ae2:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ae4:	c3                   	ret
+
+0000000000801ae5 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801ae5:	89 d2                	mov    %edx,%edx
+  801ae7:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801ae9:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801aee:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801af4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801afa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b00:	0f 05                	syscall
+}
+  801b02:	c3                   	ret
+
+0000000000801b03 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801b03:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b06:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b0b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b10:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b16:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b1c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b22:	0f 05                	syscall
+}
+  801b24:	c3                   	ret
+
+0000000000801b25 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801b25:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801b28:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b2d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b32:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b38:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b3e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b44:	0f 05                	syscall
+}
+  801b46:	c3                   	ret
+
+0000000000801b47 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801b47:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801b4a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801b4f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801b54:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b59:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801b5f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801b65:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801b6b:	0f 05                	syscall
+    if (check && ret > 0) {
+  801b6d:	48 85 c0             	test   %rax,%rax
+  801b70:	7f 01                	jg     801b73 <sys_irq_ack+0x2c>
+}
+  801b72:	c3                   	ret
+sys_irq_ack(int irq) {
+  801b73:	55                   	push   %rbp
+  801b74:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801b77:	49 89 c0             	mov    %rax,%r8
+  801b7a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801b7f:	48 ba 98 60 80 00 00 	movabs $0x806098,%rdx
+  801b86:	00 00 00 
+  801b89:	be 29 00 00 00       	mov    $0x29,%esi
+  801b8e:	48 bf b7 60 80 00 00 	movabs $0x8060b7,%rdi
+  801b95:	00 00 00 
+  801b98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b9d:	49 b9 a3 07 80 00 00 	movabs $0x8007a3,%r9
+  801ba4:	00 00 00 
+  801ba7:	41 ff d1             	call   *%r9
+
+0000000000801baa <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801baa:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bb1:	ff ff ff 
+  801bb4:	48 01 f8             	add    %rdi,%rax
+  801bb7:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801bbb:	c3                   	ret
+
+0000000000801bbc <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801bbc:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801bc3:	ff ff ff 
+  801bc6:	48 01 f8             	add    %rdi,%rax
+  801bc9:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801bcd:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801bd3:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801bd7:	c3                   	ret
+
+0000000000801bd8 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801bd8:	55                   	push   %rbp
+  801bd9:	48 89 e5             	mov    %rsp,%rbp
+  801bdc:	41 57                	push   %r15
+  801bde:	41 56                	push   %r14
+  801be0:	41 55                	push   %r13
+  801be2:	41 54                	push   %r12
+  801be4:	53                   	push   %rbx
+  801be5:	48 83 ec 08          	sub    $0x8,%rsp
+  801be9:	49 89 ff             	mov    %rdi,%r15
+  801bec:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801bf1:	49 bd 20 4d 80 00 00 	movabs $0x804d20,%r13
+  801bf8:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801bfb:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801c01:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801c04:	48 89 df             	mov    %rbx,%rdi
+  801c07:	41 ff d5             	call   *%r13
+  801c0a:	83 e0 04             	and    $0x4,%eax
+  801c0d:	74 17                	je     801c26 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801c0f:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801c16:	4c 39 f3             	cmp    %r14,%rbx
+  801c19:	75 e6                	jne    801c01 <fd_alloc+0x29>
+  801c1b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801c21:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801c26:	4d 89 27             	mov    %r12,(%r15)
+}
+  801c29:	48 83 c4 08          	add    $0x8,%rsp
+  801c2d:	5b                   	pop    %rbx
+  801c2e:	41 5c                	pop    %r12
+  801c30:	41 5d                	pop    %r13
+  801c32:	41 5e                	pop    %r14
+  801c34:	41 5f                	pop    %r15
+  801c36:	5d                   	pop    %rbp
+  801c37:	c3                   	ret
+
+0000000000801c38 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801c38:	83 ff 1f             	cmp    $0x1f,%edi
+  801c3b:	77 39                	ja     801c76 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801c3d:	55                   	push   %rbp
+  801c3e:	48 89 e5             	mov    %rsp,%rbp
+  801c41:	41 54                	push   %r12
+  801c43:	53                   	push   %rbx
+  801c44:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801c47:	48 63 df             	movslq %edi,%rbx
+  801c4a:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801c51:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801c55:	48 89 df             	mov    %rbx,%rdi
+  801c58:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  801c5f:	00 00 00 
+  801c62:	ff d0                	call   *%rax
+  801c64:	a8 04                	test   $0x4,%al
+  801c66:	74 14                	je     801c7c <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801c68:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801c6c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c71:	5b                   	pop    %rbx
+  801c72:	41 5c                	pop    %r12
+  801c74:	5d                   	pop    %rbp
+  801c75:	c3                   	ret
+        return -E_INVAL;
+  801c76:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801c7b:	c3                   	ret
+        return -E_INVAL;
+  801c7c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801c81:	eb ee                	jmp    801c71 <fd_lookup+0x39>
+
+0000000000801c83 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801c83:	55                   	push   %rbp
+  801c84:	48 89 e5             	mov    %rsp,%rbp
+  801c87:	41 54                	push   %r12
+  801c89:	53                   	push   %rbx
+  801c8a:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801c8d:	48 b8 60 61 80 00 00 	movabs $0x806160,%rax
+  801c94:	00 00 00 
+  801c97:	48 bb 20 70 80 00 00 	movabs $0x807020,%rbx
+  801c9e:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801ca1:	39 3b                	cmp    %edi,(%rbx)
+  801ca3:	74 47                	je     801cec <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801ca5:	48 83 c0 08          	add    $0x8,%rax
+  801ca9:	48 8b 18             	mov    (%rax),%rbx
+  801cac:	48 85 db             	test   %rbx,%rbx
+  801caf:	75 f0                	jne    801ca1 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801cb1:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801cb8:	00 00 00 
+  801cbb:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cc1:	89 fa                	mov    %edi,%edx
+  801cc3:	48 bf c8 60 80 00 00 	movabs $0x8060c8,%rdi
+  801cca:	00 00 00 
+  801ccd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cd2:	48 b9 f3 08 80 00 00 	movabs $0x8008f3,%rcx
+  801cd9:	00 00 00 
+  801cdc:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801cde:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801ce3:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801ce7:	5b                   	pop    %rbx
+  801ce8:	41 5c                	pop    %r12
+  801cea:	5d                   	pop    %rbp
+  801ceb:	c3                   	ret
+            return 0;
+  801cec:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf1:	eb f0                	jmp    801ce3 <dev_lookup+0x60>
+
+0000000000801cf3 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801cf3:	55                   	push   %rbp
+  801cf4:	48 89 e5             	mov    %rsp,%rbp
+  801cf7:	41 55                	push   %r13
+  801cf9:	41 54                	push   %r12
+  801cfb:	53                   	push   %rbx
+  801cfc:	48 83 ec 18          	sub    $0x18,%rsp
+  801d00:	48 89 fb             	mov    %rdi,%rbx
+  801d03:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801d06:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801d0d:	ff ff ff 
+  801d10:	48 01 df             	add    %rbx,%rdi
+  801d13:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801d17:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d1b:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+  801d27:	41 89 c5             	mov    %eax,%r13d
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 06                	js     801d34 <fd_close+0x41>
+  801d2e:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801d32:	74 1a                	je     801d4e <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801d34:	45 84 e4             	test   %r12b,%r12b
+  801d37:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d3c:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801d40:	44 89 e8             	mov    %r13d,%eax
+  801d43:	48 83 c4 18          	add    $0x18,%rsp
+  801d47:	5b                   	pop    %rbx
+  801d48:	41 5c                	pop    %r12
+  801d4a:	41 5d                	pop    %r13
+  801d4c:	5d                   	pop    %rbp
+  801d4d:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801d4e:	8b 3b                	mov    (%rbx),%edi
+  801d50:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d54:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  801d5b:	00 00 00 
+  801d5e:	ff d0                	call   *%rax
+  801d60:	41 89 c5             	mov    %eax,%r13d
+  801d63:	85 c0                	test   %eax,%eax
+  801d65:	78 1b                	js     801d82 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801d67:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d6b:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801d6f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801d75:	48 85 c0             	test   %rax,%rax
+  801d78:	74 08                	je     801d82 <fd_close+0x8f>
+  801d7a:	48 89 df             	mov    %rbx,%rdi
+  801d7d:	ff d0                	call   *%rax
+  801d7f:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801d82:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801d87:	48 89 de             	mov    %rbx,%rsi
+  801d8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801d8f:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  801d96:	00 00 00 
+  801d99:	ff d0                	call   *%rax
+    return res;
+  801d9b:	eb a3                	jmp    801d40 <fd_close+0x4d>
+
+0000000000801d9d <close>:
+
+int
+close(int fdnum) {
+  801d9d:	55                   	push   %rbp
+  801d9e:	48 89 e5             	mov    %rsp,%rbp
+  801da1:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801da5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801da9:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  801db0:	00 00 00 
+  801db3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801db5:	85 c0                	test   %eax,%eax
+  801db7:	78 15                	js     801dce <close+0x31>
+
+    return fd_close(fd, 1);
+  801db9:	be 01 00 00 00       	mov    $0x1,%esi
+  801dbe:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801dc2:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  801dc9:	00 00 00 
+  801dcc:	ff d0                	call   *%rax
+}
+  801dce:	c9                   	leave
+  801dcf:	c3                   	ret
+
+0000000000801dd0 <close_all>:
+
+void
+close_all(void) {
+  801dd0:	55                   	push   %rbp
+  801dd1:	48 89 e5             	mov    %rsp,%rbp
+  801dd4:	41 54                	push   %r12
+  801dd6:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801dd7:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ddc:	49 bc 9d 1d 80 00 00 	movabs $0x801d9d,%r12
+  801de3:	00 00 00 
+  801de6:	89 df                	mov    %ebx,%edi
+  801de8:	41 ff d4             	call   *%r12
+  801deb:	83 c3 01             	add    $0x1,%ebx
+  801dee:	83 fb 20             	cmp    $0x20,%ebx
+  801df1:	75 f3                	jne    801de6 <close_all+0x16>
+}
+  801df3:	5b                   	pop    %rbx
+  801df4:	41 5c                	pop    %r12
+  801df6:	5d                   	pop    %rbp
+  801df7:	c3                   	ret
+
+0000000000801df8 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801df8:	55                   	push   %rbp
+  801df9:	48 89 e5             	mov    %rsp,%rbp
+  801dfc:	41 57                	push   %r15
+  801dfe:	41 56                	push   %r14
+  801e00:	41 55                	push   %r13
+  801e02:	41 54                	push   %r12
+  801e04:	53                   	push   %rbx
+  801e05:	48 83 ec 18          	sub    $0x18,%rsp
+  801e09:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801e0c:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801e10:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  801e17:	00 00 00 
+  801e1a:	ff d0                	call   *%rax
+  801e1c:	89 c3                	mov    %eax,%ebx
+  801e1e:	85 c0                	test   %eax,%eax
+  801e20:	0f 88 b8 00 00 00    	js     801ede <dup+0xe6>
+    close(newfdnum);
+  801e26:	44 89 e7             	mov    %r12d,%edi
+  801e29:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  801e30:	00 00 00 
+  801e33:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801e35:	4d 63 ec             	movslq %r12d,%r13
+  801e38:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801e3f:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801e43:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801e47:	4c 89 ff             	mov    %r15,%rdi
+  801e4a:	49 be bc 1b 80 00 00 	movabs $0x801bbc,%r14
+  801e51:	00 00 00 
+  801e54:	41 ff d6             	call   *%r14
+  801e57:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801e5a:	4c 89 ef             	mov    %r13,%rdi
+  801e5d:	41 ff d6             	call   *%r14
+  801e60:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801e63:	48 89 df             	mov    %rbx,%rdi
+  801e66:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  801e6d:	00 00 00 
+  801e70:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801e72:	a8 04                	test   $0x4,%al
+  801e74:	74 2b                	je     801ea1 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801e76:	41 89 c1             	mov    %eax,%r9d
+  801e79:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801e7f:	4c 89 f1             	mov    %r14,%rcx
+  801e82:	ba 00 00 00 00       	mov    $0x0,%edx
+  801e87:	48 89 de             	mov    %rbx,%rsi
+  801e8a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e8f:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  801e96:	00 00 00 
+  801e99:	ff d0                	call   *%rax
+  801e9b:	89 c3                	mov    %eax,%ebx
+  801e9d:	85 c0                	test   %eax,%eax
+  801e9f:	78 4e                	js     801eef <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ea1:	4c 89 ff             	mov    %r15,%rdi
+  801ea4:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+  801eb0:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801eb3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801eb9:	4c 89 e9             	mov    %r13,%rcx
+  801ebc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ec1:	4c 89 fe             	mov    %r15,%rsi
+  801ec4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec9:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  801ed0:	00 00 00 
+  801ed3:	ff d0                	call   *%rax
+  801ed5:	89 c3                	mov    %eax,%ebx
+  801ed7:	85 c0                	test   %eax,%eax
+  801ed9:	78 14                	js     801eef <dup+0xf7>
+
+    return newfdnum;
+  801edb:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801ede:	89 d8                	mov    %ebx,%eax
+  801ee0:	48 83 c4 18          	add    $0x18,%rsp
+  801ee4:	5b                   	pop    %rbx
+  801ee5:	41 5c                	pop    %r12
+  801ee7:	41 5d                	pop    %r13
+  801ee9:	41 5e                	pop    %r14
+  801eeb:	41 5f                	pop    %r15
+  801eed:	5d                   	pop    %rbp
+  801eee:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801eef:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ef4:	4c 89 ee             	mov    %r13,%rsi
+  801ef7:	bf 00 00 00 00       	mov    $0x0,%edi
+  801efc:	49 bc 1d 18 80 00 00 	movabs $0x80181d,%r12
+  801f03:	00 00 00 
+  801f06:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801f09:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801f0e:	4c 89 f6             	mov    %r14,%rsi
+  801f11:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f16:	41 ff d4             	call   *%r12
+    return res;
+  801f19:	eb c3                	jmp    801ede <dup+0xe6>
+
+0000000000801f1b <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801f1b:	55                   	push   %rbp
+  801f1c:	48 89 e5             	mov    %rsp,%rbp
+  801f1f:	41 56                	push   %r14
+  801f21:	41 55                	push   %r13
+  801f23:	41 54                	push   %r12
+  801f25:	53                   	push   %rbx
+  801f26:	48 83 ec 10          	sub    $0x10,%rsp
+  801f2a:	89 fb                	mov    %edi,%ebx
+  801f2c:	49 89 f4             	mov    %rsi,%r12
+  801f2f:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f32:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f36:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  801f3d:	00 00 00 
+  801f40:	ff d0                	call   *%rax
+  801f42:	85 c0                	test   %eax,%eax
+  801f44:	78 4c                	js     801f92 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f46:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801f4a:	41 8b 3e             	mov    (%r14),%edi
+  801f4d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f51:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  801f58:	00 00 00 
+  801f5b:	ff d0                	call   *%rax
+  801f5d:	85 c0                	test   %eax,%eax
+  801f5f:	78 35                	js     801f96 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801f61:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801f65:	83 e0 03             	and    $0x3,%eax
+  801f68:	83 f8 01             	cmp    $0x1,%eax
+  801f6b:	74 2d                	je     801f9a <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801f6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f71:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801f75:	48 85 c0             	test   %rax,%rax
+  801f78:	74 56                	je     801fd0 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801f7a:	4c 89 ea             	mov    %r13,%rdx
+  801f7d:	4c 89 e6             	mov    %r12,%rsi
+  801f80:	4c 89 f7             	mov    %r14,%rdi
+  801f83:	ff d0                	call   *%rax
+}
+  801f85:	48 83 c4 10          	add    $0x10,%rsp
+  801f89:	5b                   	pop    %rbx
+  801f8a:	41 5c                	pop    %r12
+  801f8c:	41 5d                	pop    %r13
+  801f8e:	41 5e                	pop    %r14
+  801f90:	5d                   	pop    %rbp
+  801f91:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f92:	48 98                	cltq
+  801f94:	eb ef                	jmp    801f85 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f96:	48 98                	cltq
+  801f98:	eb eb                	jmp    801f85 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801f9a:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  801fa1:	00 00 00 
+  801fa4:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801faa:	89 da                	mov    %ebx,%edx
+  801fac:	48 bf 09 61 80 00 00 	movabs $0x806109,%rdi
+  801fb3:	00 00 00 
+  801fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fbb:	48 b9 f3 08 80 00 00 	movabs $0x8008f3,%rcx
+  801fc2:	00 00 00 
+  801fc5:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fc7:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801fce:	eb b5                	jmp    801f85 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801fd0:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801fd7:	eb ac                	jmp    801f85 <read+0x6a>
+
+0000000000801fd9 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801fd9:	55                   	push   %rbp
+  801fda:	48 89 e5             	mov    %rsp,%rbp
+  801fdd:	41 57                	push   %r15
+  801fdf:	41 56                	push   %r14
+  801fe1:	41 55                	push   %r13
+  801fe3:	41 54                	push   %r12
+  801fe5:	53                   	push   %rbx
+  801fe6:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801fea:	48 85 d2             	test   %rdx,%rdx
+  801fed:	74 54                	je     802043 <readn+0x6a>
+  801fef:	41 89 fd             	mov    %edi,%r13d
+  801ff2:	49 89 f6             	mov    %rsi,%r14
+  801ff5:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ff8:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801ffd:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802002:	49 bf 1b 1f 80 00 00 	movabs $0x801f1b,%r15
+  802009:	00 00 00 
+  80200c:	4c 89 e2             	mov    %r12,%rdx
+  80200f:	48 29 f2             	sub    %rsi,%rdx
+  802012:	4c 01 f6             	add    %r14,%rsi
+  802015:	44 89 ef             	mov    %r13d,%edi
+  802018:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  80201b:	85 c0                	test   %eax,%eax
+  80201d:	78 20                	js     80203f <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  80201f:	01 c3                	add    %eax,%ebx
+  802021:	85 c0                	test   %eax,%eax
+  802023:	74 08                	je     80202d <readn+0x54>
+  802025:	48 63 f3             	movslq %ebx,%rsi
+  802028:	4c 39 e6             	cmp    %r12,%rsi
+  80202b:	72 df                	jb     80200c <readn+0x33>
+    }
+    return res;
+  80202d:	48 63 c3             	movslq %ebx,%rax
+}
+  802030:	48 83 c4 08          	add    $0x8,%rsp
+  802034:	5b                   	pop    %rbx
+  802035:	41 5c                	pop    %r12
+  802037:	41 5d                	pop    %r13
+  802039:	41 5e                	pop    %r14
+  80203b:	41 5f                	pop    %r15
+  80203d:	5d                   	pop    %rbp
+  80203e:	c3                   	ret
+        if (inc < 0) return inc;
+  80203f:	48 98                	cltq
+  802041:	eb ed                	jmp    802030 <readn+0x57>
+    int inc = 1, res = 0;
+  802043:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802048:	eb e3                	jmp    80202d <readn+0x54>
+
+000000000080204a <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  80204a:	55                   	push   %rbp
+  80204b:	48 89 e5             	mov    %rsp,%rbp
+  80204e:	41 56                	push   %r14
+  802050:	41 55                	push   %r13
+  802052:	41 54                	push   %r12
+  802054:	53                   	push   %rbx
+  802055:	48 83 ec 10          	sub    $0x10,%rsp
+  802059:	89 fb                	mov    %edi,%ebx
+  80205b:	49 89 f4             	mov    %rsi,%r12
+  80205e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802061:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802065:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+  802071:	85 c0                	test   %eax,%eax
+  802073:	78 47                	js     8020bc <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802075:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802079:	41 8b 3e             	mov    (%r14),%edi
+  80207c:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802080:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  802087:	00 00 00 
+  80208a:	ff d0                	call   *%rax
+  80208c:	85 c0                	test   %eax,%eax
+  80208e:	78 30                	js     8020c0 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802090:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802095:	74 2d                	je     8020c4 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802097:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80209b:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80209f:	48 85 c0             	test   %rax,%rax
+  8020a2:	74 56                	je     8020fa <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  8020a4:	4c 89 ea             	mov    %r13,%rdx
+  8020a7:	4c 89 e6             	mov    %r12,%rsi
+  8020aa:	4c 89 f7             	mov    %r14,%rdi
+  8020ad:	ff d0                	call   *%rax
+}
+  8020af:	48 83 c4 10          	add    $0x10,%rsp
+  8020b3:	5b                   	pop    %rbx
+  8020b4:	41 5c                	pop    %r12
+  8020b6:	41 5d                	pop    %r13
+  8020b8:	41 5e                	pop    %r14
+  8020ba:	5d                   	pop    %rbp
+  8020bb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8020bc:	48 98                	cltq
+  8020be:	eb ef                	jmp    8020af <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  8020c0:	48 98                	cltq
+  8020c2:	eb eb                	jmp    8020af <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  8020c4:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8020cb:	00 00 00 
+  8020ce:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8020d4:	89 da                	mov    %ebx,%edx
+  8020d6:	48 bf 25 61 80 00 00 	movabs $0x806125,%rdi
+  8020dd:	00 00 00 
+  8020e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020e5:	48 b9 f3 08 80 00 00 	movabs $0x8008f3,%rcx
+  8020ec:	00 00 00 
+  8020ef:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  8020f1:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  8020f8:	eb b5                	jmp    8020af <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  8020fa:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802101:	eb ac                	jmp    8020af <write+0x65>
+
+0000000000802103 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802103:	55                   	push   %rbp
+  802104:	48 89 e5             	mov    %rsp,%rbp
+  802107:	41 54                	push   %r12
+  802109:	53                   	push   %rbx
+  80210a:	48 83 ec 10          	sub    $0x10,%rsp
+  80210e:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802110:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802114:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  80211b:	00 00 00 
+  80211e:	ff d0                	call   *%rax
+  802120:	85 c0                	test   %eax,%eax
+  802122:	78 3e                	js     802162 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802124:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802128:	41 8b 3c 24          	mov    (%r12),%edi
+  80212c:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802130:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+  80213c:	85 c0                	test   %eax,%eax
+  80213e:	78 22                	js     802162 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802140:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802144:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802148:	48 85 c0             	test   %rax,%rax
+  80214b:	74 0b                	je     802158 <seek+0x55>
+  80214d:	89 de                	mov    %ebx,%esi
+  80214f:	4c 89 e7             	mov    %r12,%rdi
+  802152:	ff d0                	call   *%rax
+  802154:	85 c0                	test   %eax,%eax
+  802156:	78 0a                	js     802162 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802158:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  80215d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802162:	48 83 c4 10          	add    $0x10,%rsp
+  802166:	5b                   	pop    %rbx
+  802167:	41 5c                	pop    %r12
+  802169:	5d                   	pop    %rbp
+  80216a:	c3                   	ret
+
+000000000080216b <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  80216b:	55                   	push   %rbp
+  80216c:	48 89 e5             	mov    %rsp,%rbp
+  80216f:	41 55                	push   %r13
+  802171:	41 54                	push   %r12
+  802173:	53                   	push   %rbx
+  802174:	48 83 ec 18          	sub    $0x18,%rsp
+  802178:	89 fb                	mov    %edi,%ebx
+  80217a:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80217d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802181:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  802188:	00 00 00 
+  80218b:	ff d0                	call   *%rax
+  80218d:	85 c0                	test   %eax,%eax
+  80218f:	78 38                	js     8021c9 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802191:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802195:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802199:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80219d:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  8021a4:	00 00 00 
+  8021a7:	ff d0                	call   *%rax
+  8021a9:	85 c0                	test   %eax,%eax
+  8021ab:	78 1c                	js     8021c9 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  8021ad:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  8021b2:	74 20                	je     8021d4 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  8021b4:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8021b8:	48 8b 40 30          	mov    0x30(%rax),%rax
+  8021bc:	48 85 c0             	test   %rax,%rax
+  8021bf:	74 47                	je     802208 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  8021c1:	44 89 e6             	mov    %r12d,%esi
+  8021c4:	4c 89 ef             	mov    %r13,%rdi
+  8021c7:	ff d0                	call   *%rax
+}
+  8021c9:	48 83 c4 18          	add    $0x18,%rsp
+  8021cd:	5b                   	pop    %rbx
+  8021ce:	41 5c                	pop    %r12
+  8021d0:	41 5d                	pop    %r13
+  8021d2:	5d                   	pop    %rbp
+  8021d3:	c3                   	ret
+                thisenv->env_id, fdnum);
+  8021d4:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8021db:	00 00 00 
+  8021de:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  8021e4:	89 da                	mov    %ebx,%edx
+  8021e6:	48 bf e8 60 80 00 00 	movabs $0x8060e8,%rdi
+  8021ed:	00 00 00 
+  8021f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021f5:	48 b9 f3 08 80 00 00 	movabs $0x8008f3,%rcx
+  8021fc:	00 00 00 
+  8021ff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802201:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802206:	eb c1                	jmp    8021c9 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802208:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80220d:	eb ba                	jmp    8021c9 <ftruncate+0x5e>
+
+000000000080220f <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  80220f:	55                   	push   %rbp
+  802210:	48 89 e5             	mov    %rsp,%rbp
+  802213:	41 54                	push   %r12
+  802215:	53                   	push   %rbx
+  802216:	48 83 ec 10          	sub    $0x10,%rsp
+  80221a:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80221d:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802221:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+  80222d:	85 c0                	test   %eax,%eax
+  80222f:	78 4e                	js     80227f <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802231:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802235:	41 8b 3c 24          	mov    (%r12),%edi
+  802239:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  80223d:	48 b8 83 1c 80 00 00 	movabs $0x801c83,%rax
+  802244:	00 00 00 
+  802247:	ff d0                	call   *%rax
+  802249:	85 c0                	test   %eax,%eax
+  80224b:	78 32                	js     80227f <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80224d:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802251:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802256:	74 30                	je     802288 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802258:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  80225b:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802262:	00 00 00 
+    stat->st_isdir = 0;
+  802265:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80226c:	00 00 00 
+    stat->st_dev = dev;
+  80226f:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802276:	48 89 de             	mov    %rbx,%rsi
+  802279:	4c 89 e7             	mov    %r12,%rdi
+  80227c:	ff 50 28             	call   *0x28(%rax)
+}
+  80227f:	48 83 c4 10          	add    $0x10,%rsp
+  802283:	5b                   	pop    %rbx
+  802284:	41 5c                	pop    %r12
+  802286:	5d                   	pop    %rbp
+  802287:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802288:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  80228d:	eb f0                	jmp    80227f <fstat+0x70>
+
+000000000080228f <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80228f:	55                   	push   %rbp
+  802290:	48 89 e5             	mov    %rsp,%rbp
+  802293:	41 54                	push   %r12
+  802295:	53                   	push   %rbx
+  802296:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802299:	be 00 00 00 00       	mov    $0x0,%esi
+  80229e:	48 b8 fd 33 80 00 00 	movabs $0x8033fd,%rax
+  8022a5:	00 00 00 
+  8022a8:	ff d0                	call   *%rax
+  8022aa:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  8022ac:	85 c0                	test   %eax,%eax
+  8022ae:	78 25                	js     8022d5 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  8022b0:	4c 89 e6             	mov    %r12,%rsi
+  8022b3:	89 c7                	mov    %eax,%edi
+  8022b5:	48 b8 0f 22 80 00 00 	movabs $0x80220f,%rax
+  8022bc:	00 00 00 
+  8022bf:	ff d0                	call   *%rax
+  8022c1:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  8022c4:	89 df                	mov    %ebx,%edi
+  8022c6:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+
+    return res;
+  8022d2:	44 89 e3             	mov    %r12d,%ebx
+}
+  8022d5:	89 d8                	mov    %ebx,%eax
+  8022d7:	5b                   	pop    %rbx
+  8022d8:	41 5c                	pop    %r12
+  8022da:	5d                   	pop    %rbp
+  8022db:	c3                   	ret
+
+00000000008022dc <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8022dc:	48 b8 08 00 83 00 00 	movabs $0x830008,%rax
+  8022e3:	00 00 00 
+  8022e6:	83 38 00             	cmpl   $0x0,(%rax)
+  8022e9:	74 0a                	je     8022f5 <fsenv+0x19>
+    return envid;
+}
+  8022eb:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  8022f2:	00 00 
+  8022f4:	c3                   	ret
+fsenv(void) {
+  8022f5:	55                   	push   %rbp
+  8022f6:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8022f9:	bf 03 00 00 00       	mov    $0x3,%edi
+  8022fe:	48 b8 12 59 80 00 00 	movabs $0x805912,%rax
+  802305:	00 00 00 
+  802308:	ff d0                	call   *%rax
+  80230a:	a3 08 00 83 00 00 00 	movabs %eax,0x830008
+  802311:	00 00 
+}
+  802313:	a1 08 00 83 00 00 00 	movabs 0x830008,%eax
+  80231a:	00 00 
+  80231c:	5d                   	pop    %rbp
+  80231d:	c3                   	ret
+
+000000000080231e <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  80231e:	55                   	push   %rbp
+  80231f:	48 89 e5             	mov    %rsp,%rbp
+  802322:	41 54                	push   %r12
+  802324:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802325:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80232a:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80232f:	48 89 de             	mov    %rbx,%rsi
+  802332:	bf 00 00 00 00       	mov    $0x0,%edi
+  802337:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  80233e:	00 00 00 
+  802341:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802343:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  80234a:	00 00 00 
+  80234d:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802353:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802358:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80235d:	48 89 de             	mov    %rbx,%rsi
+  802360:	bf 00 00 00 00       	mov    $0x0,%edi
+  802365:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  80236c:	00 00 00 
+  80236f:	ff d0                	call   *%rax
+  802371:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802373:	85 c0                	test   %eax,%eax
+  802375:	0f 88 a2 00 00 00    	js     80241d <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  80237b:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802382:	00 00 00 
+  802385:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80238b:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802390:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802392:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802397:	49 bc 77 51 80 00 00 	movabs $0x805177,%r12
+  80239e:	00 00 00 
+  8023a1:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8023a4:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8023a9:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8023ac:	48 b8 dc 22 80 00 00 	movabs $0x8022dc,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+  8023b8:	89 c7                	mov    %eax,%edi
+  8023ba:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8023c0:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8023c5:	48 89 da             	mov    %rbx,%rdx
+  8023c8:	be 09 00 00 00       	mov    $0x9,%esi
+  8023cd:	48 b8 bc 58 80 00 00 	movabs $0x8058bc,%rax
+  8023d4:	00 00 00 
+  8023d7:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8023d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023e3:	be 00 00 00 00       	mov    $0x0,%esi
+  8023e8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023ed:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  8023f4:	00 00 00 
+  8023f7:	ff d0                	call   *%rax
+  8023f9:	89 c3                	mov    %eax,%ebx
+  8023fb:	85 c0                	test   %eax,%eax
+  8023fd:	78 25                	js     802424 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8023ff:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802406:	00 00 00 
+  802409:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80240f:	a3 00 26 83 00 00 00 	movabs %eax,0x832600
+  802416:	00 00 
+    return 0;
+  802418:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  80241d:	89 d8                	mov    %ebx,%eax
+  80241f:	5b                   	pop    %rbx
+  802420:	41 5c                	pop    %r12
+  802422:	5d                   	pop    %rbp
+  802423:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802424:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802429:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  80242e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802433:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  80243a:	00 00 00 
+  80243d:	ff d0                	call   *%rax
+        return res;
+  80243f:	eb dc                	jmp    80241d <fschan_setup+0xff>
+
+0000000000802441 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802441:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  802448:	00 00 00 
+  80244b:	80 38 00             	cmpb   $0x0,(%rax)
+  80244e:	74 55                	je     8024a5 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802450:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  802457:	00 00 00 
+  80245a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802460:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802465:	48 ba 00 26 83 00 00 	movabs $0x832600,%rdx
+  80246c:	00 00 00 
+  80246f:	3b 0a                	cmp    (%rdx),%ecx
+  802471:	75 01                	jne    802474 <fschan+0x33>
+}
+  802473:	c3                   	ret
+fschan(void) {
+  802474:	55                   	push   %rbp
+  802475:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802478:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  80247f:	00 00 00 
+  802482:	ff d0                	call   *%rax
+  802484:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802486:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80248b:	85 d2                	test   %edx,%edx
+  80248d:	78 02                	js     802491 <fschan+0x50>
+}
+  80248f:	5d                   	pop    %rbp
+  802490:	c3                   	ret
+        fschan_enabled = 0;
+  802491:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  802498:	00 00 00 
+  80249b:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  80249e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024a3:	eb ea                	jmp    80248f <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8024a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024aa:	c3                   	ret
+
+00000000008024ab <fbuf>:
+fbuf(struct Fd *fd) {
+  8024ab:	55                   	push   %rbp
+  8024ac:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8024af:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  8024b6:	00 00 00 
+  8024b9:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8024bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c0:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8024c4:	77 12                	ja     8024d8 <fbuf+0x2d>
+  8024c6:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8024ca:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  8024d1:	00 00 00 
+  8024d4:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8024d8:	48 89 d0             	mov    %rdx,%rax
+  8024db:	5d                   	pop    %rbp
+  8024dc:	c3                   	ret
+
+00000000008024dd <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8024dd:	55                   	push   %rbp
+  8024de:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8024e1:	48 83 c7 40          	add    $0x40,%rdi
+  8024e5:	48 b8 b1 51 80 00 00 	movabs $0x8051b1,%rax
+  8024ec:	00 00 00 
+  8024ef:	ff d0                	call   *%rax
+  8024f1:	84 c0                	test   %al,%al
+  8024f3:	75 02                	jne    8024f7 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8024f5:	5d                   	pop    %rbp
+  8024f6:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8024f7:	48 b8 dc 22 80 00 00 	movabs $0x8022dc,%rax
+  8024fe:	00 00 00 
+  802501:	ff d0                	call   *%rax
+  802503:	89 c7                	mov    %eax,%edi
+  802505:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80250b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802510:	ba 00 00 00 00       	mov    $0x0,%edx
+  802515:	be 0a 00 00 00       	mov    $0xa,%esi
+  80251a:	48 b8 bc 58 80 00 00 	movabs $0x8058bc,%rax
+  802521:	00 00 00 
+  802524:	ff d0                	call   *%rax
+}
+  802526:	eb cd                	jmp    8024f5 <fschan_publish+0x18>
+
+0000000000802528 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802528:	55                   	push   %rbp
+  802529:	48 89 e5             	mov    %rsp,%rbp
+  80252c:	41 57                	push   %r15
+  80252e:	41 56                	push   %r14
+  802530:	41 55                	push   %r13
+  802532:	41 54                	push   %r12
+  802534:	53                   	push   %rbx
+  802535:	48 83 ec 48          	sub    $0x48,%rsp
+  802539:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80253d:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802541:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  802544:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802548:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80254b:	48 ba 04 00 83 00 00 	movabs $0x830004,%rdx
+  802552:	00 00 00 
+  802555:	8b 02                	mov    (%rdx),%eax
+  802557:	83 c0 01             	add    $0x1,%eax
+  80255a:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80255f:	0f 44 c1             	cmove  %ecx,%eax
+  802562:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802564:	4d 85 c0             	test   %r8,%r8
+  802567:	74 2c                	je     802595 <fschan_rw+0x6d>
+  802569:	45 89 ce             	mov    %r9d,%r14d
+  80256c:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802573:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802577:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80257d:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802584:	00 
+  802585:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80258b:	b8 01 00 00 00       	mov    $0x1,%eax
+  802590:	e9 41 01 00 00       	jmp    8026d6 <fschan_rw+0x1ae>
+  802595:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802599:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80259d:	e9 9c 01 00 00       	jmp    80273e <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8025a2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8025a6:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8025a9:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8025ac:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8025af:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8025b3:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8025b7:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8025bb:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8025bf:	48 89 da             	mov    %rbx,%rdx
+  8025c2:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  8025c9:	00 00 00 
+  8025cc:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8025ce:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8025d2:	48 b8 dd 24 80 00 00 	movabs $0x8024dd,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+            queued += blk;
+  8025de:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8025e1:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8025e5:	4d 39 fc             	cmp    %r15,%r12
+  8025e8:	73 6b                	jae    802655 <fschan_rw+0x12d>
+  8025ea:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8025ee:	77 65                	ja     802655 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8025f4:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025f8:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  8025ff:	00 00 00 
+  802602:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802604:	4c 89 fb             	mov    %r15,%rbx
+  802607:	4c 29 e3             	sub    %r12,%rbx
+  80260a:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80260f:	48 39 d3             	cmp    %rdx,%rbx
+  802612:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802616:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80261a:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80261e:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802622:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802625:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802627:	48 b9 04 00 83 00 00 	movabs $0x830004,%rcx
+  80262e:	00 00 00 
+  802631:	8b 09                	mov    (%rcx),%ecx
+  802633:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802636:	83 fe 03             	cmp    $0x3,%esi
+  802639:	0f 85 63 ff ff ff    	jne    8025a2 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  80263f:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  802643:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802646:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802649:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  80264c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802650:	e9 79 ff ff ff       	jmp    8025ce <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802655:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802659:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802660:	48 89 df             	mov    %rbx,%rdi
+  802663:	48 b8 4f 52 80 00 00 	movabs $0x80524f,%rax
+  80266a:	00 00 00 
+  80266d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80266f:	48 89 df             	mov    %rbx,%rdi
+  802672:	48 b8 dd 51 80 00 00 	movabs $0x8051dd,%rax
+  802679:	00 00 00 
+  80267c:	ff d0                	call   *%rax
+  80267e:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802682:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802686:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80268a:	75 25                	jne    8026b1 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  80268c:	8b 40 04             	mov    0x4(%rax),%eax
+  80268f:	85 c0                	test   %eax,%eax
+  802691:	0f 88 86 00 00 00    	js     80271d <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802697:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80269b:	74 5b                	je     8026f8 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80269d:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8026a1:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8026a5:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8026a9:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8026ad:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8026b1:	48 89 df             	mov    %rbx,%rdi
+  8026b4:	48 b8 04 52 80 00 00 	movabs $0x805204,%rax
+  8026bb:	00 00 00 
+  8026be:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8026c0:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8026c4:	83 f0 01             	xor    $0x1,%eax
+  8026c7:	4d 39 fc             	cmp    %r15,%r12
+  8026ca:	0f 92 c2             	setb   %dl
+  8026cd:	84 c2                	test   %al,%dl
+  8026cf:	75 05                	jne    8026d6 <fschan_rw+0x1ae>
+  8026d1:	45 85 ed             	test   %r13d,%r13d
+  8026d4:	74 50                	je     802726 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8026d6:	4d 39 fc             	cmp    %r15,%r12
+  8026d9:	0f 92 c1             	setb   %cl
+  8026dc:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8026e0:	0f 96 c2             	setbe  %dl
+  8026e3:	84 d1                	test   %dl,%cl
+  8026e5:	0f 84 6a ff ff ff    	je     802655 <fschan_rw+0x12d>
+  8026eb:	84 c0                	test   %al,%al
+  8026ed:	0f 85 fd fe ff ff    	jne    8025f0 <fschan_rw+0xc8>
+  8026f3:	e9 5d ff ff ff       	jmp    802655 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8026f8:	48 63 d0             	movslq %eax,%rdx
+  8026fb:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8026ff:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802703:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802707:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80270b:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80270f:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802716:	00 00 00 
+  802719:	ff d0                	call   *%rax
+  80271b:	eb 80                	jmp    80269d <fschan_rw+0x175>
+                err = msg->fm_res;
+  80271d:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802720:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802724:	eb 8b                	jmp    8026b1 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802726:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80272b:	0f 85 68 fe ff ff    	jne    802599 <fschan_rw+0x71>
+  802731:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  802734:	85 c0                	test   %eax,%eax
+  802736:	0f 84 5d fe ff ff    	je     802599 <fschan_rw+0x71>
+  80273c:	48 98                	cltq
+}
+  80273e:	48 83 c4 48          	add    $0x48,%rsp
+  802742:	5b                   	pop    %rbx
+  802743:	41 5c                	pop    %r12
+  802745:	41 5d                	pop    %r13
+  802747:	41 5e                	pop    %r14
+  802749:	41 5f                	pop    %r15
+  80274b:	5d                   	pop    %rbp
+  80274c:	c3                   	ret
+
+000000000080274d <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  80274d:	55                   	push   %rbp
+  80274e:	48 89 e5             	mov    %rsp,%rbp
+  802751:	41 56                	push   %r14
+  802753:	41 55                	push   %r13
+  802755:	41 54                	push   %r12
+  802757:	53                   	push   %rbx
+  802758:	48 83 ec 10          	sub    $0x10,%rsp
+  80275c:	49 89 fe             	mov    %rdi,%r14
+  80275f:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802762:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802766:	48 29 f3             	sub    %rsi,%rbx
+  802769:	48 39 d3             	cmp    %rdx,%rbx
+  80276c:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802770:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802777:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802778:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80277d:	49 bd 7f 4d 80 00 00 	movabs $0x804d7f,%r13
+  802784:	00 00 00 
+  802787:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80278e:	76 1e                	jbe    8027ae <mmap_fault+0x61>
+  802790:	4c 01 e7             	add    %r12,%rdi
+  802793:	41 ff d5             	call   *%r13
+  802796:	84 c0                	test   %al,%al
+  802798:	75 14                	jne    8027ae <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80279a:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80279e:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8027a5:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8027a9:	48 39 df             	cmp    %rbx,%rdi
+  8027ac:	72 e2                	jb     802790 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8027ae:	48 bb 00 10 83 00 00 	movabs $0x831000,%rbx
+  8027b5:	00 00 00 
+  8027b8:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  8027bf:	00 00 00 
+  8027c2:	4c 89 f0             	mov    %r14,%rax
+  8027c5:	48 29 d0             	sub    %rdx,%rax
+  8027c8:	48 c1 f8 03          	sar    $0x3,%rax
+  8027cc:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8027d3:	aa aa aa 
+  8027d6:	48 0f af c2          	imul   %rdx,%rax
+  8027da:	48 c1 e0 0c          	shl    $0xc,%rax
+  8027de:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8027e3:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8027e7:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8027e9:	44 89 e0             	mov    %r12d,%eax
+  8027ec:	41 03 46 10          	add    0x10(%r14),%eax
+  8027f0:	41 2b 06             	sub    (%r14),%eax
+  8027f3:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8027f6:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8027fa:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8027fe:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802802:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802805:	48 b8 dc 22 80 00 00 	movabs $0x8022dc,%rax
+  80280c:	00 00 00 
+  80280f:	ff d0                	call   *%rax
+  802811:	89 c7                	mov    %eax,%edi
+  802813:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802819:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80281e:	48 89 da             	mov    %rbx,%rdx
+  802821:	be 0f 00 00 00       	mov    $0xf,%esi
+  802826:	48 b8 bc 58 80 00 00 	movabs $0x8058bc,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802832:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802837:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80283b:	4c 89 e6             	mov    %r12,%rsi
+  80283e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802843:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+  80284f:	48 98                	cltq
+}
+  802851:	48 83 c4 10          	add    $0x10,%rsp
+  802855:	5b                   	pop    %rbx
+  802856:	41 5c                	pop    %r12
+  802858:	41 5d                	pop    %r13
+  80285a:	41 5e                	pop    %r14
+  80285c:	5d                   	pop    %rbp
+  80285d:	c3                   	ret
+
+000000000080285e <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80285e:	48 8b 37             	mov    (%rdi),%rsi
+  802861:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802868:	48 ba 00 20 83 00 00 	movabs $0x832000,%rdx
+  80286f:	00 00 00 
+  802872:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802877:	eb 0f                	jmp    802888 <mmap_pgfault+0x2a>
+  802879:	c3                   	ret
+  80287a:	48 83 c1 01          	add    $0x1,%rcx
+  80287e:	48 83 c2 18          	add    $0x18,%rdx
+  802882:	48 83 f9 20          	cmp    $0x20,%rcx
+  802886:	74 6e                	je     8028f6 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802888:	48 8b 02             	mov    (%rdx),%rax
+  80288b:	48 83 e8 01          	sub    $0x1,%rax
+  80288f:	48 39 f0             	cmp    %rsi,%rax
+  802892:	73 e6                	jae    80287a <mmap_pgfault+0x1c>
+  802894:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802898:	73 e0                	jae    80287a <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80289a:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80289e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028a3:	f6 c2 01             	test   $0x1,%dl
+  8028a6:	75 d1                	jne    802879 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8028a8:	f6 c2 02             	test   $0x2,%dl
+  8028ab:	74 1a                	je     8028c7 <mmap_pgfault+0x69>
+  8028ad:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8028b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028b6:	48 bf 00 20 83 00 00 	movabs $0x832000,%rdi
+  8028bd:	00 00 00 
+  8028c0:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8028c5:	74 35                	je     8028fc <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8028c7:	55                   	push   %rbp
+  8028c8:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8028cb:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8028cf:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8028d6:	00 00 00 
+  8028d9:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8028dd:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8028e2:	48 b8 4d 27 80 00 00 	movabs $0x80274d,%rax
+  8028e9:	00 00 00 
+  8028ec:	ff d0                	call   *%rax
+  8028ee:	48 85 c0             	test   %rax,%rax
+  8028f1:	0f 9f c0             	setg   %al
+}
+  8028f4:	5d                   	pop    %rbp
+  8028f5:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8028f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028fb:	c3                   	ret
+}
+  8028fc:	c3                   	ret
+
+00000000008028fd <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8028fd:	55                   	push   %rbp
+  8028fe:	48 89 e5             	mov    %rsp,%rbp
+  802901:	41 54                	push   %r12
+  802903:	53                   	push   %rbx
+  802904:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802907:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  80290e:	00 00 00 
+  802911:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802916:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80291a:	74 15                	je     802931 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80291c:	48 83 c3 01          	add    $0x1,%rbx
+  802920:	48 83 c0 18          	add    $0x18,%rax
+  802924:	48 83 fb 20          	cmp    $0x20,%rbx
+  802928:	75 ec                	jne    802916 <mmap_alloc+0x19>
+    return NULL;
+  80292a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80292f:	eb 52                	jmp    802983 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802931:	4c 89 e7             	mov    %r12,%rdi
+  802934:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  80293b:	00 00 00 
+  80293e:	ff d0                	call   *%rax
+  802940:	41 89 c1             	mov    %eax,%r9d
+  802943:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80294a:	48 c1 e1 0c          	shl    $0xc,%rcx
+  80294e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802954:	ba 00 00 00 00       	mov    $0x0,%edx
+  802959:	4c 89 e6             	mov    %r12,%rsi
+  80295c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802961:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  802968:	00 00 00 
+  80296b:	ff d0                	call   *%rax
+  80296d:	85 c0                	test   %eax,%eax
+  80296f:	78 17                	js     802988 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802971:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802975:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  80297c:	00 00 00 
+  80297f:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802983:	5b                   	pop    %rbx
+  802984:	41 5c                	pop    %r12
+  802986:	5d                   	pop    %rbp
+  802987:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802988:	b8 00 00 00 00       	mov    $0x0,%eax
+  80298d:	eb f4                	jmp    802983 <mmap_alloc+0x86>
+
+000000000080298f <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80298f:	55                   	push   %rbp
+  802990:	48 89 e5             	mov    %rsp,%rbp
+  802993:	41 56                	push   %r14
+  802995:	41 55                	push   %r13
+  802997:	41 54                	push   %r12
+  802999:	53                   	push   %rbx
+  80299a:	48 83 ec 10          	sub    $0x10,%rsp
+  80299e:	41 89 fc             	mov    %edi,%r12d
+  8029a1:	49 89 f5             	mov    %rsi,%r13
+  8029a4:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8029a7:	48 89 f0             	mov    %rsi,%rax
+  8029aa:	48 09 d0             	or     %rdx,%rax
+  8029ad:	75 0d                	jne    8029bc <fsipc+0x2d>
+  8029af:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8029b2:	83 f8 04             	cmp    $0x4,%eax
+  8029b5:	76 7d                	jbe    802a34 <fsipc+0xa5>
+  8029b7:	83 ff 0d             	cmp    $0xd,%edi
+  8029ba:	74 78                	je     802a34 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8029bc:	48 b8 dc 22 80 00 00 	movabs $0x8022dc,%rax
+  8029c3:	00 00 00 
+  8029c6:	ff d0                	call   *%rax
+  8029c8:	89 c7                	mov    %eax,%edi
+  8029ca:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8029d1:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8029d8:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8029df:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8029e5:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  8029ec:	00 00 00 
+  8029ef:	44 89 e6             	mov    %r12d,%esi
+  8029f2:	48 b8 bc 58 80 00 00 	movabs $0x8058bc,%rax
+  8029f9:	00 00 00 
+  8029fc:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8029fe:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802a05:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802a06:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802a0b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802a0f:	4c 89 ee             	mov    %r13,%rsi
+  802a12:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a17:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  802a1e:	00 00 00 
+  802a21:	ff d0                	call   *%rax
+  802a23:	89 c3                	mov    %eax,%ebx
+}
+  802a25:	89 d8                	mov    %ebx,%eax
+  802a27:	48 83 c4 10          	add    $0x10,%rsp
+  802a2b:	5b                   	pop    %rbx
+  802a2c:	41 5c                	pop    %r12
+  802a2e:	41 5d                	pop    %r13
+  802a30:	41 5e                	pop    %r14
+  802a32:	5d                   	pop    %rbp
+  802a33:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802a34:	48 b8 41 24 80 00 00 	movabs $0x802441,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+  802a40:	49 89 c6             	mov    %rax,%r14
+  802a43:	48 85 c0             	test   %rax,%rax
+  802a46:	0f 84 70 ff ff ff    	je     8029bc <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802a4c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802a50:	48 b8 8c 51 80 00 00 	movabs $0x80518c,%rax
+  802a57:	00 00 00 
+  802a5a:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802a5c:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802a5f:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802a66:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802a6a:	ba 10 00 00 00       	mov    $0x10,%edx
+  802a6f:	48 be 00 00 84 00 00 	movabs $0x840000,%rsi
+  802a76:	00 00 00 
+  802a79:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802a80:	00 00 00 
+  802a83:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802a85:	4c 89 f7             	mov    %r14,%rdi
+  802a88:	48 b8 dd 24 80 00 00 	movabs $0x8024dd,%rax
+  802a8f:	00 00 00 
+  802a92:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802a94:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802a9b:	4c 89 f7             	mov    %r14,%rdi
+  802a9e:	48 b8 4f 52 80 00 00 	movabs $0x80524f,%rax
+  802aa5:	00 00 00 
+  802aa8:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802aaa:	4c 89 f7             	mov    %r14,%rdi
+  802aad:	48 b8 dd 51 80 00 00 	movabs $0x8051dd,%rax
+  802ab4:	00 00 00 
+  802ab7:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802ab9:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802abc:	41 83 fc 05          	cmp    $0x5,%r12d
+  802ac0:	75 04                	jne    802ac6 <fsipc+0x137>
+  802ac2:	85 db                	test   %ebx,%ebx
+  802ac4:	79 14                	jns    802ada <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802ac6:	4c 89 f7             	mov    %r14,%rdi
+  802ac9:	48 b8 04 52 80 00 00 	movabs $0x805204,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802ad5:	e9 4b ff ff ff       	jmp    802a25 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802ada:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802ade:	ba 88 00 00 00       	mov    $0x88,%edx
+  802ae3:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  802aea:	00 00 00 
+  802aed:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802af4:	00 00 00 
+  802af7:	ff d0                	call   *%rax
+  802af9:	eb cb                	jmp    802ac6 <fsipc+0x137>
+
+0000000000802afb <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802afb:	55                   	push   %rbp
+  802afc:	48 89 e5             	mov    %rsp,%rbp
+  802aff:	41 57                	push   %r15
+  802b01:	41 56                	push   %r14
+  802b03:	41 55                	push   %r13
+  802b05:	41 54                	push   %r12
+  802b07:	53                   	push   %rbx
+  802b08:	48 83 ec 18          	sub    $0x18,%rsp
+  802b0c:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802b10:	49 89 f6             	mov    %rsi,%r14
+  802b13:	49 89 d4             	mov    %rdx,%r12
+  802b16:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802b19:	48 b8 41 24 80 00 00 	movabs $0x802441,%rax
+  802b20:	00 00 00 
+  802b23:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802b25:	48 85 c0             	test   %rax,%rax
+  802b28:	0f 85 96 00 00 00    	jne    802bc4 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802b2e:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  802b35:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b36:	49 bf 00 00 84 00 00 	movabs $0x840000,%r15
+  802b3d:	00 00 00 
+    while (n) {
+  802b40:	4d 85 e4             	test   %r12,%r12
+  802b43:	74 79                	je     802bbe <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b45:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802b4a:	49 39 dc             	cmp    %rbx,%r12
+  802b4d:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802b51:	48 89 da             	mov    %rbx,%rdx
+  802b54:	4c 89 f6             	mov    %r14,%rsi
+  802b57:	48 bf 00 10 84 00 00 	movabs $0x841000,%rdi
+  802b5e:	00 00 00 
+  802b61:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802b68:	00 00 00 
+  802b6b:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802b6d:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802b71:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b74:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802b77:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802b7a:	44 01 e8             	add    %r13d,%eax
+  802b7d:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802b81:	41 0f 44 c5          	cmove  %r13d,%eax
+  802b85:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802b89:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802b8d:	48 89 da             	mov    %rbx,%rdx
+  802b90:	be 00 00 00 00       	mov    $0x0,%esi
+  802b95:	bf 04 00 00 00       	mov    $0x4,%edi
+  802b9a:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  802ba1:	00 00 00 
+  802ba4:	ff d0                	call   *%rax
+        if (res < 0)
+  802ba6:	85 c0                	test   %eax,%eax
+  802ba8:	78 4a                	js     802bf4 <devfile_write_direct+0xf9>
+        buf += res;
+  802baa:	48 98                	cltq
+  802bac:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802baf:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802bb3:	49 29 c4             	sub    %rax,%r12
+  802bb6:	75 8d                	jne    802b45 <devfile_write_direct+0x4a>
+    return write;
+  802bb8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802bbc:	eb 27                	jmp    802be5 <devfile_write_direct+0xea>
+    size_t write = 0;
+  802bbe:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802bc2:	eb f4                	jmp    802bb8 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802bc4:	45 89 e9             	mov    %r13d,%r9d
+  802bc7:	4d 89 e0             	mov    %r12,%r8
+  802bca:	4c 89 f1             	mov    %r14,%rcx
+  802bcd:	ba 04 00 00 00       	mov    $0x4,%edx
+  802bd2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802bd6:	48 89 c7             	mov    %rax,%rdi
+  802bd9:	48 b8 28 25 80 00 00 	movabs $0x802528,%rax
+  802be0:	00 00 00 
+  802be3:	ff d0                	call   *%rax
+}
+  802be5:	48 83 c4 18          	add    $0x18,%rsp
+  802be9:	5b                   	pop    %rbx
+  802bea:	41 5c                	pop    %r12
+  802bec:	41 5d                	pop    %r13
+  802bee:	41 5e                	pop    %r14
+  802bf0:	41 5f                	pop    %r15
+  802bf2:	5d                   	pop    %rbp
+  802bf3:	c3                   	ret
+            return res;
+  802bf4:	48 98                	cltq
+  802bf6:	eb ed                	jmp    802be5 <devfile_write_direct+0xea>
+
+0000000000802bf8 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802bf8:	55                   	push   %rbp
+  802bf9:	48 89 e5             	mov    %rsp,%rbp
+  802bfc:	41 54                	push   %r12
+  802bfe:	53                   	push   %rbx
+  802bff:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802c02:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802c09:	00 00 00 
+  802c0c:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802c0e:	48 85 c0             	test   %rax,%rax
+  802c11:	74 71                	je     802c84 <fbuf_flush+0x8c>
+  802c13:	48 89 c3             	mov    %rax,%rbx
+  802c16:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c1b:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802c1f:	75 05                	jne    802c26 <fbuf_flush+0x2e>
+}
+  802c21:	5b                   	pop    %rbx
+  802c22:	41 5c                	pop    %r12
+  802c24:	5d                   	pop    %rbp
+  802c25:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802c26:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802c29:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802c2d:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802c34:	00 00 00 
+  802c37:	48 89 de             	mov    %rbx,%rsi
+  802c3a:	48 29 c6             	sub    %rax,%rsi
+  802c3d:	48 c1 fe 03          	sar    $0x3,%rsi
+  802c41:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802c48:	aa aa aa 
+  802c4b:	48 0f af f0          	imul   %rax,%rsi
+  802c4f:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802c53:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802c58:	48 01 c6             	add    %rax,%rsi
+  802c5b:	4c 89 e7             	mov    %r12,%rdi
+  802c5e:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  802c65:	00 00 00 
+  802c68:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802c6a:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802c6e:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802c75:	00 
+    return res < 0 ? res : 0;
+  802c76:	48 85 c0             	test   %rax,%rax
+  802c79:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c7e:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802c82:	eb 9d                	jmp    802c21 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802c84:	b8 00 00 00 00       	mov    $0x0,%eax
+  802c89:	eb 96                	jmp    802c21 <fbuf_flush+0x29>
+
+0000000000802c8b <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802c8b:	55                   	push   %rbp
+  802c8c:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802c8f:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  802c96:	00 00 00 
+  802c99:	ff d0                	call   *%rax
+}
+  802c9b:	5d                   	pop    %rbp
+  802c9c:	c3                   	ret
+
+0000000000802c9d <devfile_write>:
+    if (!fd || !buf)
+  802c9d:	48 85 ff             	test   %rdi,%rdi
+  802ca0:	0f 84 d3 01 00 00    	je     802e79 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802ca6:	55                   	push   %rbp
+  802ca7:	48 89 e5             	mov    %rsp,%rbp
+  802caa:	41 57                	push   %r15
+  802cac:	41 56                	push   %r14
+  802cae:	41 55                	push   %r13
+  802cb0:	41 54                	push   %r12
+  802cb2:	53                   	push   %rbx
+  802cb3:	48 83 ec 08          	sub    $0x8,%rsp
+  802cb7:	49 89 fc             	mov    %rdi,%r12
+  802cba:	49 89 f6             	mov    %rsi,%r14
+  802cbd:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802cc0:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802cc5:	48 85 f6             	test   %rsi,%rsi
+  802cc8:	0f 84 9c 01 00 00    	je     802e6a <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802cce:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802cd5:	00 00 00 
+  802cd8:	ff d0                	call   *%rax
+  802cda:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802cdd:	48 85 c0             	test   %rax,%rax
+  802ce0:	0f 84 a2 00 00 00    	je     802d88 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ce6:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ceb:	4c 89 e7             	mov    %r12,%rdi
+  802cee:	48 b8 3c 17 80 00 00 	movabs $0x80173c,%rax
+  802cf5:	00 00 00 
+  802cf8:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802cfa:	83 f8 02             	cmp    $0x2,%eax
+  802cfd:	0f 8f 85 00 00 00    	jg     802d88 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802d03:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  802d0a:	00 00 00 
+  802d0d:	4d 89 ef             	mov    %r13,%r15
+  802d10:	49 29 c7             	sub    %rax,%r15
+  802d13:	49 c1 ff 03          	sar    $0x3,%r15
+  802d17:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802d1e:	aa aa aa 
+  802d21:	4c 0f af f8          	imul   %rax,%r15
+  802d25:	49 c1 e7 0e          	shl    $0xe,%r15
+  802d29:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802d2e:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802d31:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802d36:	0f 84 d7 00 00 00    	je     802e13 <devfile_write+0x176>
+  802d3c:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802d40:	89 c2                	mov    %eax,%edx
+  802d42:	41 03 55 0c          	add    0xc(%r13),%edx
+  802d46:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802d4b:	75 0f                	jne    802d5c <devfile_write+0xbf>
+  802d4d:	48 01 d8             	add    %rbx,%rax
+  802d50:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802d56:	0f 86 92 00 00 00    	jbe    802dee <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802d5c:	4c 89 e7             	mov    %r12,%rdi
+  802d5f:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  802d66:	00 00 00 
+  802d69:	ff d0                	call   *%rax
+  802d6b:	85 c0                	test   %eax,%eax
+  802d6d:	78 52                	js     802dc1 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d6f:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802d76:	77 7f                	ja     802df7 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802d78:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802d7d:	0f 85 c2 00 00 00    	jne    802e45 <devfile_write+0x1a8>
+  802d83:	e9 94 00 00 00       	jmp    802e1c <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802d88:	4c 89 e7             	mov    %r12,%rdi
+  802d8b:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  802d92:	00 00 00 
+  802d95:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d97:	85 c0                	test   %eax,%eax
+  802d99:	79 07                	jns    802da2 <devfile_write+0x105>
+  802d9b:	48 98                	cltq
+  802d9d:	e9 c8 00 00 00       	jmp    802e6a <devfile_write+0x1cd>
+  802da2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802da7:	48 89 da             	mov    %rbx,%rdx
+  802daa:	4c 89 f6             	mov    %r14,%rsi
+  802dad:	4c 89 e7             	mov    %r12,%rdi
+  802db0:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  802db7:	00 00 00 
+  802dba:	ff d0                	call   *%rax
+  802dbc:	e9 a9 00 00 00       	jmp    802e6a <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802dc1:	48 98                	cltq
+  802dc3:	e9 a2 00 00 00       	jmp    802e6a <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dc8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802dcd:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802dd2:	4c 89 fe             	mov    %r15,%rsi
+  802dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dda:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  802de1:	00 00 00 
+  802de4:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802de6:	85 c0                	test   %eax,%eax
+  802de8:	79 45                	jns    802e2f <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dea:	48 98                	cltq
+  802dec:	eb 7c                	jmp    802e6a <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802dee:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802df5:	76 4e                	jbe    802e45 <devfile_write+0x1a8>
+  802df7:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802dfc:	48 89 da             	mov    %rbx,%rdx
+  802dff:	4c 89 f6             	mov    %r14,%rsi
+  802e02:	4c 89 e7             	mov    %r12,%rdi
+  802e05:	48 b8 fb 2a 80 00 00 	movabs $0x802afb,%rax
+  802e0c:	00 00 00 
+  802e0f:	ff d0                	call   *%rax
+  802e11:	eb 57                	jmp    802e6a <devfile_write+0x1cd>
+  802e13:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802e1a:	77 db                	ja     802df7 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802e1c:	4c 89 ff             	mov    %r15,%rdi
+  802e1f:	48 b8 7f 4d 80 00 00 	movabs $0x804d7f,%rax
+  802e26:	00 00 00 
+  802e29:	ff d0                	call   *%rax
+  802e2b:	84 c0                	test   %al,%al
+  802e2d:	74 99                	je     802dc8 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802e2f:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802e34:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802e39:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802e3d:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802e44:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802e45:	4c 89 ff             	mov    %r15,%rdi
+  802e48:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802e4c:	48 89 da             	mov    %rbx,%rdx
+  802e4f:	4c 89 f6             	mov    %r14,%rsi
+  802e52:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802e59:	00 00 00 
+  802e5c:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802e5e:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802e62:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802e67:	48 89 d8             	mov    %rbx,%rax
+}
+  802e6a:	48 83 c4 08          	add    $0x8,%rsp
+  802e6e:	5b                   	pop    %rbx
+  802e6f:	41 5c                	pop    %r12
+  802e71:	41 5d                	pop    %r13
+  802e73:	41 5e                	pop    %r14
+  802e75:	41 5f                	pop    %r15
+  802e77:	5d                   	pop    %rbp
+  802e78:	c3                   	ret
+        return E_INVAL;
+  802e79:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802e7e:	c3                   	ret
+
+0000000000802e7f <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802e7f:	55                   	push   %rbp
+  802e80:	48 89 e5             	mov    %rsp,%rbp
+  802e83:	41 54                	push   %r12
+  802e85:	53                   	push   %rbx
+  802e86:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802e89:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  802e90:	00 00 00 
+  802e93:	ff d0                	call   *%rax
+  802e95:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802e98:	48 89 df             	mov    %rbx,%rdi
+  802e9b:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802ea2:	00 00 00 
+  802ea5:	ff d0                	call   *%rax
+  802ea7:	48 85 c0             	test   %rax,%rax
+  802eaa:	74 17                	je     802ec3 <devfile_flush+0x44>
+  802eac:	48 89 df             	mov    %rbx,%rdi
+  802eaf:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  802eb6:	00 00 00 
+  802eb9:	ff d0                	call   *%rax
+  802ebb:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802ec2:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802ec3:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ec6:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  802ecd:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802ecf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed4:	be 00 00 00 00       	mov    $0x0,%esi
+  802ed9:	bf 06 00 00 00       	mov    $0x6,%edi
+  802ede:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  802ee5:	00 00 00 
+  802ee8:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802eea:	45 85 e4             	test   %r12d,%r12d
+  802eed:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802ef1:	5b                   	pop    %rbx
+  802ef2:	41 5c                	pop    %r12
+  802ef4:	5d                   	pop    %rbp
+  802ef5:	c3                   	ret
+
+0000000000802ef6 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802ef6:	55                   	push   %rbp
+  802ef7:	48 89 e5             	mov    %rsp,%rbp
+  802efa:	41 57                	push   %r15
+  802efc:	41 56                	push   %r14
+  802efe:	41 55                	push   %r13
+  802f00:	41 54                	push   %r12
+  802f02:	53                   	push   %rbx
+  802f03:	48 83 ec 38          	sub    $0x38,%rsp
+  802f07:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802f0b:	49 89 f7             	mov    %rsi,%r15
+  802f0e:	48 89 d3             	mov    %rdx,%rbx
+  802f11:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802f14:	48 b8 41 24 80 00 00 	movabs $0x802441,%rax
+  802f1b:	00 00 00 
+  802f1e:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f20:	48 85 c0             	test   %rax,%rax
+  802f23:	75 20                	jne    802f45 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802f25:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802f2a:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802f31:	00 
+    while (n) {
+  802f32:	48 85 db             	test   %rbx,%rbx
+  802f35:	0f 85 df 00 00 00    	jne    80301a <devfile_read_direct+0x124>
+    size_t read = 0;
+  802f3b:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802f3f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f43:	eb 21                	jmp    802f66 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802f45:	45 89 f1             	mov    %r14d,%r9d
+  802f48:	49 89 d8             	mov    %rbx,%r8
+  802f4b:	4c 89 f9             	mov    %r15,%rcx
+  802f4e:	ba 03 00 00 00       	mov    $0x3,%edx
+  802f53:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802f57:	48 89 c7             	mov    %rax,%rdi
+  802f5a:	48 b8 28 25 80 00 00 	movabs $0x802528,%rax
+  802f61:	00 00 00 
+  802f64:	ff d0                	call   *%rax
+}
+  802f66:	48 83 c4 38          	add    $0x38,%rsp
+  802f6a:	5b                   	pop    %rbx
+  802f6b:	41 5c                	pop    %r12
+  802f6d:	41 5d                	pop    %r13
+  802f6f:	41 5e                	pop    %r14
+  802f71:	41 5f                	pop    %r15
+  802f73:	5d                   	pop    %rbp
+  802f74:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802f75:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802f79:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802f7f:	75 1e                	jne    802f9f <devfile_read_direct+0xa9>
+  802f81:	e9 e2 00 00 00       	jmp    803068 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802f86:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802f8a:	eb da                	jmp    802f66 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802f8c:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802f90:	0f 85 d0 01 00 00    	jne    803166 <devfile_read_direct+0x270>
+            map = 0;
+  802f96:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f9a:	eb 03                	jmp    802f9f <devfile_read_direct+0xa9>
+  802f9c:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802f9f:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802fa4:	48 39 d3             	cmp    %rdx,%rbx
+  802fa7:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802fab:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802faf:	8b 40 0c             	mov    0xc(%rax),%eax
+  802fb2:	48 b9 00 00 84 00 00 	movabs $0x840000,%rcx
+  802fb9:	00 00 00 
+  802fbc:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802fbe:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802fc2:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802fc6:	be 00 00 00 00       	mov    $0x0,%esi
+  802fcb:	bf 03 00 00 00       	mov    $0x3,%edi
+  802fd0:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  802fd7:	00 00 00 
+  802fda:	ff d0                	call   *%rax
+        if (res <= 0)
+  802fdc:	85 c0                	test   %eax,%eax
+  802fde:	0f 8e 63 01 00 00    	jle    803147 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802fe4:	4c 63 e0             	movslq %eax,%r12
+  802fe7:	4c 89 e2             	mov    %r12,%rdx
+  802fea:	48 be 00 10 84 00 00 	movabs $0x841000,%rsi
+  802ff1:	00 00 00 
+  802ff4:	4c 89 ff             	mov    %r15,%rdi
+  802ff7:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  802ffe:	00 00 00 
+  803001:	ff d0                	call   *%rax
+        buf += res;
+  803003:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  803006:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  803009:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  80300d:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  803011:	48 85 db             	test   %rbx,%rbx
+  803014:	0f 84 25 ff ff ff    	je     802f3f <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  80301a:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  80301d:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  803021:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803025:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803029:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  803030:	0f 97 c2             	seta   %dl
+  803033:	20 c2                	and    %al,%dl
+  803035:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803038:	0f 84 5e ff ff ff    	je     802f9c <devfile_read_direct+0xa6>
+  80303e:	4c 89 fa             	mov    %r15,%rdx
+  803041:	4d 89 fd             	mov    %r15,%r13
+  803044:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  80304b:	0f 85 4e ff ff ff    	jne    802f9f <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  803051:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803055:	0f 84 1a ff ff ff    	je     802f75 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  80305b:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803062:	0f 85 37 ff ff ff    	jne    802f9f <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  803068:	48 89 d8             	mov    %rbx,%rax
+  80306b:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803071:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  803076:	48 39 c8             	cmp    %rcx,%rax
+  803079:	48 0f 47 c1          	cmova  %rcx,%rax
+  80307d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  803081:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  803085:	49 89 d4             	mov    %rdx,%r12
+  803088:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  80308c:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  803093:	00 00 00 
+  803096:	ff d0                	call   *%rax
+  803098:	a8 40                	test   $0x40,%al
+  80309a:	0f 85 b9 00 00 00    	jne    803159 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  8030a0:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8030a7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030ab:	49 39 c5             	cmp    %rax,%r13
+  8030ae:	72 d8                	jb     803088 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  8030b0:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  8030b4:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  8030bb:	00 00 00 
+  8030be:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  8030c2:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  8030c5:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  8030c7:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  8030cb:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  8030cf:	48 b8 dc 22 80 00 00 	movabs $0x8022dc,%rax
+  8030d6:	00 00 00 
+  8030d9:	ff d0                	call   *%rax
+  8030db:	89 c7                	mov    %eax,%edi
+  8030dd:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8030e3:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8030e8:	48 ba 00 00 84 00 00 	movabs $0x840000,%rdx
+  8030ef:	00 00 00 
+  8030f2:	be 0e 00 00 00       	mov    $0xe,%esi
+  8030f7:	48 b8 bc 58 80 00 00 	movabs $0x8058bc,%rax
+  8030fe:	00 00 00 
+  803101:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  803103:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803108:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  80310c:	4c 89 fe             	mov    %r15,%rsi
+  80310f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803114:	48 b8 98 58 80 00 00 	movabs $0x805898,%rax
+  80311b:	00 00 00 
+  80311e:	ff d0                	call   *%rax
+  803120:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803123:	48 85 d2             	test   %rdx,%rdx
+  803126:	0f 84 5a fe ff ff    	je     802f86 <devfile_read_direct+0x90>
+            if (res > 0) {
+  80312c:	0f 8e 5a fe ff ff    	jle    802f8c <devfile_read_direct+0x96>
+                buf += res;
+  803132:	48 98                	cltq
+  803134:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803137:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  80313a:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  80313e:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803142:	e9 ca fe ff ff       	jmp    803011 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803147:	41 89 c5             	mov    %eax,%r13d
+  80314a:	48 98                	cltq
+  80314c:	45 85 ed             	test   %r13d,%r13d
+  80314f:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  803154:	e9 0d fe ff ff       	jmp    802f66 <devfile_read_direct+0x70>
+            map = 0;
+  803159:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  80315d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803161:	e9 39 fe ff ff       	jmp    802f9f <devfile_read_direct+0xa9>
+  803166:	48 89 d0             	mov    %rdx,%rax
+  803169:	e9 f8 fd ff ff       	jmp    802f66 <devfile_read_direct+0x70>
+
+000000000080316e <devfile_read>:
+    if (!fd || !buf)
+  80316e:	48 85 ff             	test   %rdi,%rdi
+  803171:	0f 84 21 02 00 00    	je     803398 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803177:	55                   	push   %rbp
+  803178:	48 89 e5             	mov    %rsp,%rbp
+  80317b:	41 57                	push   %r15
+  80317d:	41 56                	push   %r14
+  80317f:	41 55                	push   %r13
+  803181:	41 54                	push   %r12
+  803183:	53                   	push   %rbx
+  803184:	48 83 ec 28          	sub    $0x28,%rsp
+  803188:	48 89 fb             	mov    %rdi,%rbx
+  80318b:	49 89 f4             	mov    %rsi,%r12
+  80318e:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803191:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803196:	48 85 f6             	test   %rsi,%rsi
+  803199:	74 4b                	je     8031e6 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  80319b:	48 b8 ab 24 80 00 00 	movabs $0x8024ab,%rax
+  8031a2:	00 00 00 
+  8031a5:	ff d0                	call   *%rax
+  8031a7:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8031aa:	48 85 c0             	test   %rax,%rax
+  8031ad:	74 22                	je     8031d1 <devfile_read+0x63>
+  8031af:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  8031b6:	77 19                	ja     8031d1 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8031b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8031bd:	48 89 df             	mov    %rbx,%rdi
+  8031c0:	48 b8 3c 17 80 00 00 	movabs $0x80173c,%rax
+  8031c7:	00 00 00 
+  8031ca:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  8031cc:	83 f8 02             	cmp    $0x2,%eax
+  8031cf:	7e 40                	jle    803211 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  8031d1:	48 89 df             	mov    %rbx,%rdi
+  8031d4:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  8031db:	00 00 00 
+  8031de:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8031e0:	85 c0                	test   %eax,%eax
+  8031e2:	79 11                	jns    8031f5 <devfile_read+0x87>
+  8031e4:	48 98                	cltq
+}
+  8031e6:	48 83 c4 28          	add    $0x28,%rsp
+  8031ea:	5b                   	pop    %rbx
+  8031eb:	41 5c                	pop    %r12
+  8031ed:	41 5d                	pop    %r13
+  8031ef:	41 5e                	pop    %r14
+  8031f1:	41 5f                	pop    %r15
+  8031f3:	5d                   	pop    %rbp
+  8031f4:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8031f5:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8031fa:	4c 89 ea             	mov    %r13,%rdx
+  8031fd:	4c 89 e6             	mov    %r12,%rsi
+  803200:	48 89 df             	mov    %rbx,%rdi
+  803203:	48 b8 f6 2e 80 00 00 	movabs $0x802ef6,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	eb d5                	jmp    8031e6 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803211:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803215:	48 89 df             	mov    %rbx,%rdi
+  803218:	48 b8 f8 2b 80 00 00 	movabs $0x802bf8,%rax
+  80321f:	00 00 00 
+  803222:	ff d0                	call   *%rax
+  803224:	85 c0                	test   %eax,%eax
+  803226:	0f 88 33 01 00 00    	js     80335f <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  80322c:	48 ba 00 23 83 00 00 	movabs $0x832300,%rdx
+  803233:	00 00 00 
+  803236:	4c 89 f0             	mov    %r14,%rax
+  803239:	48 29 d0             	sub    %rdx,%rax
+  80323c:	48 c1 f8 03          	sar    $0x3,%rax
+  803240:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803247:	aa aa aa 
+  80324a:	48 0f af c2          	imul   %rdx,%rax
+  80324e:	48 c1 e0 0e          	shl    $0xe,%rax
+  803252:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803256:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803259:	41 39 06             	cmp    %eax,(%r14)
+  80325c:	75 0d                	jne    80326b <devfile_read+0xfd>
+  80325e:	8b 43 10             	mov    0x10(%rbx),%eax
+  803261:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803265:	0f 84 fb 00 00 00    	je     803366 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  80326b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803270:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803274:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803277:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80327b:	48 89 c7             	mov    %rax,%rdi
+  80327e:	48 b8 7f 4d 80 00 00 	movabs $0x804d7f,%rax
+  803285:	00 00 00 
+  803288:	ff d0                	call   *%rax
+  80328a:	84 c0                	test   %al,%al
+  80328c:	75 27                	jne    8032b5 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80328e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803293:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803298:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80329c:	bf 00 00 00 00       	mov    $0x0,%edi
+  8032a1:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8032a8:	00 00 00 
+  8032ab:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  8032ad:	85 c0                	test   %eax,%eax
+  8032af:	0f 88 dc 00 00 00    	js     803391 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  8032b5:	44 89 f8             	mov    %r15d,%eax
+  8032b8:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  8032bd:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  8032bf:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  8032c6:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  8032c7:	8b 43 10             	mov    0x10(%rbx),%eax
+  8032ca:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  8032ce:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  8032d1:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8032d6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8032da:	48 89 df             	mov    %rbx,%rdi
+  8032dd:	48 b8 f6 2e 80 00 00 	movabs $0x802ef6,%rax
+  8032e4:	00 00 00 
+  8032e7:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  8032e9:	48 85 c0             	test   %rax,%rax
+  8032ec:	0f 88 f4 fe ff ff    	js     8031e6 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  8032f2:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8032f5:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8032f8:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8032fb:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8032ff:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803303:	48 63 d1             	movslq %ecx,%rdx
+  803306:	48 01 d0             	add    %rdx,%rax
+  803309:	4d 63 ff             	movslq %r15d,%r15
+  80330c:	4c 29 f8             	sub    %r15,%rax
+  80330f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803314:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803318:	48 85 c0             	test   %rax,%rax
+  80331b:	0f 8e c5 fe ff ff    	jle    8031e6 <devfile_read+0x78>
+    n = MIN(n, res);
+  803321:	4c 39 e8             	cmp    %r13,%rax
+  803324:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803328:	8b 73 04             	mov    0x4(%rbx),%esi
+  80332b:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  80332f:	48 63 f6             	movslq %esi,%rsi
+  803332:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803337:	48 01 c6             	add    %rax,%rsi
+  80333a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80333e:	48 01 c6             	add    %rax,%rsi
+  803341:	4c 89 ea             	mov    %r13,%rdx
+  803344:	4c 89 e7             	mov    %r12,%rdi
+  803347:	48 b8 79 14 80 00 00 	movabs $0x801479,%rax
+  80334e:	00 00 00 
+  803351:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803353:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803357:	4c 89 e8             	mov    %r13,%rax
+  80335a:	e9 87 fe ff ff       	jmp    8031e6 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80335f:	48 98                	cltq
+  803361:	e9 80 fe ff ff       	jmp    8031e6 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803366:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80336a:	41 39 d7             	cmp    %edx,%r15d
+  80336d:	0f 8c f8 fe ff ff    	jl     80326b <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803373:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803377:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  80337a:	41 39 cf             	cmp    %ecx,%r15d
+  80337d:	0f 8d e8 fe ff ff    	jge    80326b <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803383:	4d 63 ff             	movslq %r15d,%r15
+  803386:	4c 29 f8             	sub    %r15,%rax
+  803389:	48 63 d2             	movslq %edx,%rdx
+  80338c:	48 01 d0             	add    %rdx,%rax
+  80338f:	eb 87                	jmp    803318 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803391:	48 98                	cltq
+  803393:	e9 4e fe ff ff       	jmp    8031e6 <devfile_read+0x78>
+        return E_INVAL;
+  803398:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80339d:	c3                   	ret
+
+000000000080339e <fs_channel>:
+fs_channel(bool enable) {
+  80339e:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8033a0:	a2 04 26 83 00 00 00 	movabs %al,0x832604
+  8033a7:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8033a9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ae:	40 84 ff             	test   %dil,%dil
+  8033b1:	74 47                	je     8033fa <fs_channel+0x5c>
+  8033b3:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  8033ba:	00 00 00 
+  8033bd:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8033c3:	48 b8 00 26 83 00 00 	movabs $0x832600,%rax
+  8033ca:	00 00 00 
+  8033cd:	3b 08                	cmp    (%rax),%ecx
+  8033cf:	74 29                	je     8033fa <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8033d1:	55                   	push   %rbp
+  8033d2:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8033d5:	48 b8 1e 23 80 00 00 	movabs $0x80231e,%rax
+  8033dc:	00 00 00 
+  8033df:	ff d0                	call   *%rax
+  8033e1:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8033e3:	85 c0                	test   %eax,%eax
+  8033e5:	78 04                	js     8033eb <fs_channel+0x4d>
+}
+  8033e7:	89 d0                	mov    %edx,%eax
+  8033e9:	5d                   	pop    %rbp
+  8033ea:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8033eb:	48 b8 04 26 83 00 00 	movabs $0x832604,%rax
+  8033f2:	00 00 00 
+  8033f5:	c6 00 00             	movb   $0x0,(%rax)
+  8033f8:	eb ed                	jmp    8033e7 <fs_channel+0x49>
+}
+  8033fa:	89 d0                	mov    %edx,%eax
+  8033fc:	c3                   	ret
+
+00000000008033fd <open>:
+open(const char *path, int mode) {
+  8033fd:	55                   	push   %rbp
+  8033fe:	48 89 e5             	mov    %rsp,%rbp
+  803401:	41 55                	push   %r13
+  803403:	41 54                	push   %r12
+  803405:	53                   	push   %rbx
+  803406:	48 83 ec 18          	sub    $0x18,%rsp
+  80340a:	49 89 fc             	mov    %rdi,%r12
+  80340d:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803410:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  803417:	00 00 00 
+  80341a:	ff d0                	call   *%rax
+  80341c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803422:	0f 87 8f 00 00 00    	ja     8034b7 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803428:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  80342c:	48 b8 d8 1b 80 00 00 	movabs $0x801bd8,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+  803438:	89 c3                	mov    %eax,%ebx
+  80343a:	85 c0                	test   %eax,%eax
+  80343c:	78 55                	js     803493 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  80343e:	4c 89 e6             	mov    %r12,%rsi
+  803441:	48 bb 00 00 84 00 00 	movabs $0x840000,%rbx
+  803448:	00 00 00 
+  80344b:	48 89 df             	mov    %rbx,%rdi
+  80344e:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803455:	00 00 00 
+  803458:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  80345a:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803461:	ba 00 00 00 00       	mov    $0x0,%edx
+  803466:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80346a:	bf 01 00 00 00       	mov    $0x1,%edi
+  80346f:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  803476:	00 00 00 
+  803479:	ff d0                	call   *%rax
+  80347b:	89 c3                	mov    %eax,%ebx
+  80347d:	85 c0                	test   %eax,%eax
+  80347f:	78 1f                	js     8034a0 <open+0xa3>
+    return fd2num(fd);
+  803481:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803485:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  80348c:	00 00 00 
+  80348f:	ff d0                	call   *%rax
+  803491:	89 c3                	mov    %eax,%ebx
+}
+  803493:	89 d8                	mov    %ebx,%eax
+  803495:	48 83 c4 18          	add    $0x18,%rsp
+  803499:	5b                   	pop    %rbx
+  80349a:	41 5c                	pop    %r12
+  80349c:	41 5d                	pop    %r13
+  80349e:	5d                   	pop    %rbp
+  80349f:	c3                   	ret
+        fd_close(fd, 0);
+  8034a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8034a9:	48 b8 f3 1c 80 00 00 	movabs $0x801cf3,%rax
+  8034b0:	00 00 00 
+  8034b3:	ff d0                	call   *%rax
+        return res;
+  8034b5:	eb dc                	jmp    803493 <open+0x96>
+        return -E_BAD_PATH;
+  8034b7:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8034bc:	eb d5                	jmp    803493 <open+0x96>
+
+00000000008034be <file_flush_buffers>:
+file_flush_buffers(void) {
+  8034be:	55                   	push   %rbp
+  8034bf:	48 89 e5             	mov    %rsp,%rbp
+  8034c2:	41 56                	push   %r14
+  8034c4:	41 55                	push   %r13
+  8034c6:	41 54                	push   %r12
+  8034c8:	53                   	push   %rbx
+  8034c9:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8034cd:	49 bc 08 23 83 00 00 	movabs $0x832308,%r12
+  8034d4:	00 00 00 
+  8034d7:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8034dc:	49 bd 38 1c 80 00 00 	movabs $0x801c38,%r13
+  8034e3:	00 00 00 
+  8034e6:	49 be f8 2b 80 00 00 	movabs $0x802bf8,%r14
+  8034ed:	00 00 00 
+  8034f0:	eb 0c                	jmp    8034fe <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8034f2:	83 c3 01             	add    $0x1,%ebx
+  8034f5:	49 83 c4 18          	add    $0x18,%r12
+  8034f9:	83 fb 20             	cmp    $0x20,%ebx
+  8034fc:	74 1d                	je     80351b <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8034fe:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803503:	74 ed                	je     8034f2 <file_flush_buffers+0x34>
+  803505:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803509:	89 df                	mov    %ebx,%edi
+  80350b:	41 ff d5             	call   *%r13
+  80350e:	85 c0                	test   %eax,%eax
+  803510:	78 e0                	js     8034f2 <file_flush_buffers+0x34>
+  803512:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803516:	41 ff d6             	call   *%r14
+  803519:	eb d7                	jmp    8034f2 <file_flush_buffers+0x34>
+}
+  80351b:	48 83 c4 10          	add    $0x10,%rsp
+  80351f:	5b                   	pop    %rbx
+  803520:	41 5c                	pop    %r12
+  803522:	41 5d                	pop    %r13
+  803524:	41 5e                	pop    %r14
+  803526:	5d                   	pop    %rbp
+  803527:	c3                   	ret
+
+0000000000803528 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803528:	55                   	push   %rbp
+  803529:	48 89 e5             	mov    %rsp,%rbp
+  80352c:	41 54                	push   %r12
+  80352e:	53                   	push   %rbx
+  80352f:	49 89 fc             	mov    %rdi,%r12
+  803532:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  803534:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  80353b:	00 00 00 
+  80353e:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803540:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  803547:	00 00 00 
+  80354a:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  80354f:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803551:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803554:	ba 00 00 00 00       	mov    $0x0,%edx
+  803559:	be 00 00 00 00       	mov    $0x0,%esi
+  80355e:	bf 02 00 00 00       	mov    $0x2,%edi
+  803563:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  80356a:	00 00 00 
+  80356d:	ff d0                	call   *%rax
+}
+  80356f:	5b                   	pop    %rbx
+  803570:	41 5c                	pop    %r12
+  803572:	5d                   	pop    %rbp
+  803573:	c3                   	ret
+
+0000000000803574 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803574:	55                   	push   %rbp
+  803575:	48 89 e5             	mov    %rsp,%rbp
+  803578:	41 54                	push   %r12
+  80357a:	53                   	push   %rbx
+  80357b:	49 89 fc             	mov    %rdi,%r12
+  80357e:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803581:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  803588:	00 00 00 
+  80358b:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80358d:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803592:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  803599:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80359b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8035a0:	be 00 00 00 00       	mov    $0x0,%esi
+  8035a5:	bf 05 00 00 00       	mov    $0x5,%edi
+  8035aa:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  8035b1:	00 00 00 
+  8035b4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8035b6:	85 c0                	test   %eax,%eax
+  8035b8:	78 3d                	js     8035f7 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8035ba:	49 bc 00 00 84 00 00 	movabs $0x840000,%r12
+  8035c1:	00 00 00 
+  8035c4:	4c 89 e6             	mov    %r12,%rsi
+  8035c7:	48 89 df             	mov    %rbx,%rdi
+  8035ca:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  8035d1:	00 00 00 
+  8035d4:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8035d6:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8035dd:	00 
+  8035de:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8035e4:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8035eb:	00 
+  8035ec:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8035f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8035f7:	5b                   	pop    %rbx
+  8035f8:	41 5c                	pop    %r12
+  8035fa:	5d                   	pop    %rbp
+  8035fb:	c3                   	ret
+
+00000000008035fc <remove>:
+remove(const char *path) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+  803600:	53                   	push   %rbx
+  803601:	48 83 ec 08          	sub    $0x8,%rsp
+  803605:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803608:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  80360f:	00 00 00 
+  803612:	ff d0                	call   *%rax
+  803614:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80361a:	77 3a                	ja     803656 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80361c:	48 89 de             	mov    %rbx,%rsi
+  80361f:	48 bf 00 00 84 00 00 	movabs $0x840000,%rdi
+  803626:	00 00 00 
+  803629:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803630:	00 00 00 
+  803633:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  803635:	ba 00 00 00 00       	mov    $0x0,%edx
+  80363a:	be 00 00 00 00       	mov    $0x0,%esi
+  80363f:	bf 07 00 00 00       	mov    $0x7,%edi
+  803644:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  80364b:	00 00 00 
+  80364e:	ff d0                	call   *%rax
+}
+  803650:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803654:	c9                   	leave
+  803655:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803656:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80365b:	eb f3                	jmp    803650 <remove+0x54>
+
+000000000080365d <sync>:
+sync(void) {
+  80365d:	55                   	push   %rbp
+  80365e:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803661:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  803668:	00 00 00 
+  80366b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80366d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803672:	be 00 00 00 00       	mov    $0x0,%esi
+  803677:	bf 08 00 00 00       	mov    $0x8,%edi
+  80367c:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  803683:	00 00 00 
+  803686:	ff d0                	call   *%rax
+}
+  803688:	5d                   	pop    %rbp
+  803689:	c3                   	ret
+
+000000000080368a <fsync>:
+fsync(int fdnum) {
+  80368a:	55                   	push   %rbp
+  80368b:	48 89 e5             	mov    %rsp,%rbp
+  80368e:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803692:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803696:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  80369d:	00 00 00 
+  8036a0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8036a2:	85 c0                	test   %eax,%eax
+  8036a4:	78 4b                	js     8036f1 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036a6:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8036aa:	48 b8 20 70 80 00 00 	movabs $0x807020,%rax
+  8036b1:	00 00 00 
+  8036b4:	8b 00                	mov    (%rax),%eax
+  8036b6:	39 02                	cmp    %eax,(%rdx)
+  8036b8:	75 39                	jne    8036f3 <fsync+0x69>
+    file_flush_buffers();
+  8036ba:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  8036c1:	00 00 00 
+  8036c4:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8036c6:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8036ca:	8b 40 0c             	mov    0xc(%rax),%eax
+  8036cd:	a3 00 00 84 00 00 00 	movabs %eax,0x840000
+  8036d4:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8036d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8036db:	be 00 00 00 00       	mov    $0x0,%esi
+  8036e0:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8036e5:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  8036ec:	00 00 00 
+  8036ef:	ff d0                	call   *%rax
+}
+  8036f1:	c9                   	leave
+  8036f2:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036f3:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036f8:	eb f7                	jmp    8036f1 <fsync+0x67>
+
+00000000008036fa <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8036fa:	55                   	push   %rbp
+  8036fb:	48 89 e5             	mov    %rsp,%rbp
+  8036fe:	53                   	push   %rbx
+  8036ff:	48 83 ec 08          	sub    $0x8,%rsp
+  803703:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803706:	ba 00 00 00 00       	mov    $0x0,%edx
+  80370b:	be 00 00 00 00       	mov    $0x0,%esi
+  803710:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803715:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  80371c:	00 00 00 
+  80371f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803721:	85 c0                	test   %eax,%eax
+  803723:	78 2d                	js     803752 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803725:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80372c:	00 00 00 
+  80372f:	48 8b 10             	mov    (%rax),%rdx
+  803732:	48 89 13             	mov    %rdx,(%rbx)
+  803735:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803739:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80373d:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803741:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803745:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803749:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  80374d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803752:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803756:	c9                   	leave
+  803757:	c3                   	ret
+
+0000000000803758 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803758:	55                   	push   %rbp
+  803759:	48 89 e5             	mov    %rsp,%rbp
+  80375c:	53                   	push   %rbx
+  80375d:	48 83 ec 08          	sub    $0x8,%rsp
+  803761:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803764:	ba 00 00 00 00       	mov    $0x0,%edx
+  803769:	be 00 00 00 00       	mov    $0x0,%esi
+  80376e:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803773:	48 b8 8f 29 80 00 00 	movabs $0x80298f,%rax
+  80377a:	00 00 00 
+  80377d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80377f:	85 c0                	test   %eax,%eax
+  803781:	78 3d                	js     8037c0 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803783:	48 b8 00 00 84 00 00 	movabs $0x840000,%rax
+  80378a:	00 00 00 
+  80378d:	48 8b 10             	mov    (%rax),%rdx
+  803790:	48 89 13             	mov    %rdx,(%rbx)
+  803793:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803797:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80379b:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80379f:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8037a3:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8037a7:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8037ab:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8037af:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8037b3:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8037b7:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8037bb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8037c0:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8037c4:	c9                   	leave
+  8037c5:	c3                   	ret
+
+00000000008037c6 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8037c6:	55                   	push   %rbp
+  8037c7:	48 89 e5             	mov    %rsp,%rbp
+  8037ca:	41 57                	push   %r15
+  8037cc:	41 56                	push   %r14
+  8037ce:	41 55                	push   %r13
+  8037d0:	41 54                	push   %r12
+  8037d2:	53                   	push   %rbx
+  8037d3:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8037d7:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8037de:	00 
+  8037df:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8037e6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8037ec:	0f 85 43 01 00 00    	jne    803935 <munmap+0x16f>
+  8037f2:	49 89 ff             	mov    %rdi,%r15
+  8037f5:	4c 39 f7             	cmp    %r14,%rdi
+  8037f8:	0f 87 37 01 00 00    	ja     803935 <munmap+0x16f>
+  8037fe:	48 bb 00 20 83 00 00 	movabs $0x832000,%rbx
+  803805:	00 00 00 
+  803808:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80380e:	eb 2c                	jmp    80383c <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803810:	4c 39 f8             	cmp    %r15,%rax
+  803813:	0f 83 85 00 00 00    	jae    80389e <munmap+0xd8>
+            m->mm_end = start;
+  803819:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80381e:	48 83 c3 18          	add    $0x18,%rbx
+  803822:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803829:	48 b8 00 23 83 00 00 	movabs $0x832300,%rax
+  803830:	00 00 00 
+  803833:	48 39 c3             	cmp    %rax,%rbx
+  803836:	0f 84 d0 00 00 00    	je     80390c <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  80383c:	49 89 dc             	mov    %rbx,%r12
+  80383f:	48 8b 03             	mov    (%rbx),%rax
+  803842:	4c 39 f0             	cmp    %r14,%rax
+  803845:	73 d7                	jae    80381e <munmap+0x58>
+  803847:	48 85 c0             	test   %rax,%rax
+  80384a:	74 d2                	je     80381e <munmap+0x58>
+  80384c:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803850:	49 39 d7             	cmp    %rdx,%r15
+  803853:	73 c9                	jae    80381e <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803855:	49 39 d6             	cmp    %rdx,%r14
+  803858:	73 b6                	jae    803810 <munmap+0x4a>
+  80385a:	49 39 c7             	cmp    %rax,%r15
+  80385d:	76 b1                	jbe    803810 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80385f:	4c 89 ef             	mov    %r13,%rdi
+  803862:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  803869:	00 00 00 
+  80386c:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80386e:	48 85 c0             	test   %rax,%rax
+  803871:	0f 84 c5 00 00 00    	je     80393c <munmap+0x176>
+            *tail = *m;
+  803877:	48 8b 13             	mov    (%rbx),%rdx
+  80387a:	48 89 10             	mov    %rdx,(%rax)
+  80387d:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803881:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803885:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803889:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80388d:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803890:	44 89 f2             	mov    %r14d,%edx
+  803893:	2b 13                	sub    (%rbx),%edx
+  803895:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803898:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80389c:	eb 80                	jmp    80381e <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80389e:	49 39 d6             	cmp    %rdx,%r14
+  8038a1:	73 18                	jae    8038bb <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8038a3:	44 89 f2             	mov    %r14d,%edx
+  8038a6:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8038ab:	29 c2                	sub    %eax,%edx
+  8038ad:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8038b2:	4d 89 34 24          	mov    %r14,(%r12)
+  8038b6:	e9 63 ff ff ff       	jmp    80381e <munmap+0x58>
+    m->mm_start = 0;
+  8038bb:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8038c2:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8038c3:	4c 89 e6             	mov    %r12,%rsi
+  8038c6:	48 b8 00 20 83 00 00 	movabs $0x832000,%rax
+  8038cd:	00 00 00 
+  8038d0:	48 29 c6             	sub    %rax,%rsi
+  8038d3:	48 c1 fe 03          	sar    $0x3,%rsi
+  8038d7:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8038de:	aa aa aa 
+  8038e1:	48 0f af f0          	imul   %rax,%rsi
+  8038e5:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8038e9:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8038ee:	48 01 c6             	add    %rax,%rsi
+  8038f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038fb:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  803902:	00 00 00 
+  803905:	ff d0                	call   *%rax
+}
+  803907:	e9 12 ff ff ff       	jmp    80381e <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80390c:	4c 89 f2             	mov    %r14,%rdx
+  80390f:	4c 29 fa             	sub    %r15,%rdx
+  803912:	4c 89 fe             	mov    %r15,%rsi
+  803915:	bf 00 00 00 00       	mov    $0x0,%edi
+  80391a:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  803921:	00 00 00 
+  803924:	ff d0                	call   *%rax
+}
+  803926:	48 83 c4 08          	add    $0x8,%rsp
+  80392a:	5b                   	pop    %rbx
+  80392b:	41 5c                	pop    %r12
+  80392d:	41 5d                	pop    %r13
+  80392f:	41 5e                	pop    %r14
+  803931:	41 5f                	pop    %r15
+  803933:	5d                   	pop    %rbp
+  803934:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803935:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80393a:	eb ea                	jmp    803926 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  80393c:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803941:	eb e3                	jmp    803926 <munmap+0x160>
+
+0000000000803943 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  803943:	55                   	push   %rbp
+  803944:	48 89 e5             	mov    %rsp,%rbp
+  803947:	41 57                	push   %r15
+  803949:	41 56                	push   %r14
+  80394b:	41 55                	push   %r13
+  80394d:	41 54                	push   %r12
+  80394f:	53                   	push   %rbx
+  803950:	48 83 ec 28          	sub    $0x28,%rsp
+  803954:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803958:	49 89 f5             	mov    %rsi,%r13
+  80395b:	41 89 d6             	mov    %edx,%r14d
+  80395e:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803961:	41 89 cc             	mov    %ecx,%r12d
+  803964:	44 89 c7             	mov    %r8d,%edi
+  803967:	44 89 cb             	mov    %r9d,%ebx
+  80396a:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80396e:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803972:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  803979:	00 00 00 
+  80397c:	ff d0                	call   *%rax
+  80397e:	41 89 c7             	mov    %eax,%r15d
+  803981:	85 c0                	test   %eax,%eax
+  803983:	0f 88 ae 01 00 00    	js     803b37 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803989:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80398d:	48 ba 20 70 80 00 00 	movabs $0x807020,%rdx
+  803994:	00 00 00 
+  803997:	8b 32                	mov    (%rdx),%esi
+  803999:	39 30                	cmp    %esi,(%rax)
+  80399b:	0f 85 7a 02 00 00    	jne    803c1b <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039a1:	8b 40 08             	mov    0x8(%rax),%eax
+  8039a4:	83 e0 03             	and    $0x3,%eax
+  8039a7:	83 f8 01             	cmp    $0x1,%eax
+  8039aa:	0f 84 76 02 00 00    	je     803c26 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039b0:	4d 85 ed             	test   %r13,%r13
+  8039b3:	0f 84 78 02 00 00    	je     803c31 <mmap+0x2ee>
+  8039b9:	85 db                	test   %ebx,%ebx
+  8039bb:	0f 88 70 02 00 00    	js     803c31 <mmap+0x2ee>
+  8039c1:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8039c7:	41 89 df             	mov    %ebx,%r15d
+  8039ca:	0f 85 6c 02 00 00    	jne    803c3c <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8039d0:	44 89 f0             	mov    %r14d,%eax
+  8039d3:	83 e0 fd             	and    $0xfffffffd,%eax
+  8039d6:	83 f8 04             	cmp    $0x4,%eax
+  8039d9:	0f 85 68 02 00 00    	jne    803c47 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8039df:	44 89 e1             	mov    %r12d,%ecx
+  8039e2:	83 e1 01             	and    $0x1,%ecx
+  8039e5:	0f 95 c2             	setne  %dl
+  8039e8:	44 89 e0             	mov    %r12d,%eax
+  8039eb:	d1 e8                	shr    %eax
+  8039ed:	83 f0 01             	xor    $0x1,%eax
+  8039f0:	83 e0 01             	and    $0x1,%eax
+  8039f3:	38 c2                	cmp    %al,%dl
+  8039f5:	0f 85 57 02 00 00    	jne    803c52 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8039fb:	85 c9                	test   %ecx,%ecx
+  8039fd:	74 0a                	je     803a09 <mmap+0xc6>
+  8039ff:	41 f6 c6 02          	test   $0x2,%r14b
+  803a03:	0f 85 54 02 00 00    	jne    803c5d <mmap+0x31a>
+    file_flush_buffers();
+  803a09:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  803a10:	00 00 00 
+  803a13:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803a15:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803a1c:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803a23:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803a27:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803a2a:	41 f6 c4 04          	test   $0x4,%r12b
+  803a2e:	0f 84 15 01 00 00    	je     803b49 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  803a34:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a37:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803a3d:	0f 85 25 02 00 00    	jne    803c68 <mmap+0x325>
+  803a43:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803a47:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803a4e:	00 00 00 
+  803a51:	48 39 c2             	cmp    %rax,%rdx
+  803a54:	0f 82 19 02 00 00    	jb     803c73 <mmap+0x330>
+  803a5a:	48 39 c7             	cmp    %rax,%rdi
+  803a5d:	0f 87 10 02 00 00    	ja     803c73 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a63:	4c 89 ee             	mov    %r13,%rsi
+  803a66:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  803a6d:	00 00 00 
+  803a70:	ff d0                	call   *%rax
+  803a72:	85 c0                	test   %eax,%eax
+  803a74:	0f 88 04 02 00 00    	js     803c7e <mmap+0x33b>
+    if (!handler) {
+  803a7a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803a81:	00 00 00 
+  803a84:	80 38 00             	cmpb   $0x0,(%rax)
+  803a87:	75 2b                	jne    803ab4 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a89:	48 bf 5e 28 80 00 00 	movabs $0x80285e,%rdi
+  803a90:	00 00 00 
+  803a93:	48 b8 67 55 80 00 00 	movabs $0x805567,%rax
+  803a9a:	00 00 00 
+  803a9d:	ff d0                	call   *%rax
+  803a9f:	85 c0                	test   %eax,%eax
+  803aa1:	0f 88 ea 01 00 00    	js     803c91 <mmap+0x34e>
+        handler = 1;
+  803aa7:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803aae:	00 00 00 
+  803ab1:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803ab4:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803ab8:	48 b8 fd 28 80 00 00 	movabs $0x8028fd,%rax
+  803abf:	00 00 00 
+  803ac2:	ff d0                	call   *%rax
+  803ac4:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803ac7:	48 85 c0             	test   %rax,%rax
+  803aca:	0f 84 c9 01 00 00    	je     803c99 <mmap+0x356>
+    m->mm_start = va;
+  803ad0:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803ad3:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803ad7:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803adb:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803ade:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803ae2:	44 89 e0             	mov    %r12d,%eax
+  803ae5:	c1 e0 06             	shl    $0x6,%eax
+  803ae8:	25 80 00 00 00       	and    $0x80,%eax
+  803aed:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803af0:	09 f0                	or     %esi,%eax
+  803af2:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803af6:	41 f6 c4 08          	test   $0x8,%r12b
+  803afa:	74 31                	je     803b2d <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803afc:	48 39 d3             	cmp    %rdx,%rbx
+  803aff:	73 2c                	jae    803b2d <mmap+0x1ea>
+  803b01:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803b06:	48 89 de             	mov    %rbx,%rsi
+  803b09:	4c 89 f7             	mov    %r14,%rdi
+  803b0c:	48 b8 4d 27 80 00 00 	movabs $0x80274d,%rax
+  803b13:	00 00 00 
+  803b16:	ff d0                	call   *%rax
+  803b18:	49 89 c4             	mov    %rax,%r12
+  803b1b:	48 85 c0             	test   %rax,%rax
+  803b1e:	0f 8e d7 00 00 00    	jle    803bfb <mmap+0x2b8>
+            va += n;
+  803b24:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803b27:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803b2b:	72 d4                	jb     803b01 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803b2d:	49 8b 06             	mov    (%r14),%rax
+  803b30:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  803b34:	48 89 06             	mov    %rax,(%rsi)
+}
+  803b37:	44 89 f8             	mov    %r15d,%eax
+  803b3a:	48 83 c4 28          	add    $0x28,%rsp
+  803b3e:	5b                   	pop    %rbx
+  803b3f:	41 5c                	pop    %r12
+  803b41:	41 5d                	pop    %r13
+  803b43:	41 5e                	pop    %r14
+  803b45:	41 5f                	pop    %r15
+  803b47:	5d                   	pop    %rbp
+  803b48:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b49:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803b50:	00 00 00 
+  803b53:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803b56:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803b5d:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b60:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803b65:	48 be 00 20 83 00 00 	movabs $0x832000,%rsi
+  803b6c:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b6f:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803b76:	00 00 00 
+  803b79:	48 39 d7             	cmp    %rdx,%rdi
+  803b7c:	73 1c                	jae    803b9a <mmap+0x257>
+        return -E_NO_MEM;
+  803b7e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803b84:	eb b1                	jmp    803b37 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803b86:	48 83 c0 01          	add    $0x1,%rax
+  803b8a:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803b8e:	77 3f                	ja     803bcf <mmap+0x28c>
+  803b90:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803b95:	48 39 d7             	cmp    %rdx,%rdi
+  803b98:	72 2a                	jb     803bc4 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803b9a:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803b9e:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803ba2:	48 39 d1             	cmp    %rdx,%rcx
+  803ba5:	73 df                	jae    803b86 <mmap+0x243>
+  803ba7:	48 85 c9             	test   %rcx,%rcx
+  803baa:	74 da                	je     803b86 <mmap+0x243>
+  803bac:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803bb0:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803bb5:	48 39 d3             	cmp    %rdx,%rbx
+  803bb8:	73 cc                	jae    803b86 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803bba:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803bbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  803bc2:	eb cc                	jmp    803b90 <mmap+0x24d>
+        return -E_NO_MEM;
+  803bc4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803bca:	e9 68 ff ff ff       	jmp    803b37 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803bcf:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803bd4:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803bdb:	00 00 00 
+  803bde:	48 39 c2             	cmp    %rax,%rdx
+  803be1:	0f 82 9f 00 00 00    	jb     803c86 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803be7:	48 85 db             	test   %rbx,%rbx
+  803bea:	0f 85 8a fe ff ff    	jne    803a7a <mmap+0x137>
+        return -E_NO_MEM;
+  803bf0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803bf6:	e9 3c ff ff ff       	jmp    803b37 <mmap+0x1f4>
+        if (n < 0) {
+  803bfb:	0f 89 2c ff ff ff    	jns    803b2d <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803c01:	49 8b 3e             	mov    (%r14),%rdi
+  803c04:	4c 89 ee             	mov    %r13,%rsi
+  803c07:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  803c0e:	00 00 00 
+  803c11:	ff d0                	call   *%rax
+            return n;
+  803c13:	45 89 e7             	mov    %r12d,%r15d
+  803c16:	e9 1c ff ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803c1b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c21:	e9 11 ff ff ff       	jmp    803b37 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803c26:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c2c:	e9 06 ff ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803c31:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c37:	e9 fb fe ff ff       	jmp    803b37 <mmap+0x1f4>
+  803c3c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c42:	e9 f0 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803c47:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c4d:	e9 e5 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803c52:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c58:	e9 da fe ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803c5d:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803c63:	e9 cf fe ff ff       	jmp    803b37 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803c68:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c6e:	e9 c4 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+  803c73:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803c79:	e9 b9 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803c7e:	41 89 c7             	mov    %eax,%r15d
+  803c81:	e9 b1 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803c86:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c8c:	e9 a6 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803c91:	41 89 c7             	mov    %eax,%r15d
+  803c94:	e9 9e fe ff ff       	jmp    803b37 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803c99:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803c9f:	e9 93 fe ff ff       	jmp    803b37 <mmap+0x1f4>
+
+0000000000803ca4 <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  803ca4:	55                   	push   %rbp
+  803ca5:	48 89 e5             	mov    %rsp,%rbp
+  803ca8:	41 55                	push   %r13
+  803caa:	41 54                	push   %r12
+  803cac:	53                   	push   %rbx
+  803cad:	48 83 ec 08          	sub    $0x8,%rsp
+  803cb1:	48 89 fb             	mov    %rdi,%rbx
+  803cb4:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  803cb7:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  803cba:	48 b8 20 4d 80 00 00 	movabs $0x804d20,%rax
+  803cc1:	00 00 00 
+  803cc4:	ff d0                	call   *%rax
+  803cc6:	41 89 c1             	mov    %eax,%r9d
+  803cc9:	4d 89 e0             	mov    %r12,%r8
+  803ccc:	49 29 d8             	sub    %rbx,%r8
+  803ccf:	48 89 d9             	mov    %rbx,%rcx
+  803cd2:	44 89 ea             	mov    %r13d,%edx
+  803cd5:	48 89 de             	mov    %rbx,%rsi
+  803cd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803cdd:	48 b8 95 50 80 00 00 	movabs $0x805095,%rax
+  803ce4:	00 00 00 
+  803ce7:	ff d0                	call   *%rax
+    return 0;
+}
+  803ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+  803cee:	48 83 c4 08          	add    $0x8,%rsp
+  803cf2:	5b                   	pop    %rbx
+  803cf3:	41 5c                	pop    %r12
+  803cf5:	41 5d                	pop    %r13
+  803cf7:	5d                   	pop    %rbp
+  803cf8:	c3                   	ret
+
+0000000000803cf9 <spawn>:
+spawn(const char *prog, const char **argv) {
+  803cf9:	55                   	push   %rbp
+  803cfa:	48 89 e5             	mov    %rsp,%rbp
+  803cfd:	41 57                	push   %r15
+  803cff:	41 56                	push   %r14
+  803d01:	41 55                	push   %r13
+  803d03:	41 54                	push   %r12
+  803d05:	53                   	push   %rbx
+  803d06:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  803d0d:	48 89 fb             	mov    %rdi,%rbx
+  803d10:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  803d13:	48 b8 be 34 80 00 00 	movabs $0x8034be,%rax
+  803d1a:	00 00 00 
+  803d1d:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  803d1f:	be 00 00 00 00       	mov    $0x0,%esi
+  803d24:	48 89 df             	mov    %rbx,%rdi
+  803d27:	48 b8 fd 33 80 00 00 	movabs $0x8033fd,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+  803d33:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  803d39:	85 c0                	test   %eax,%eax
+  803d3b:	0f 88 06 04 00 00    	js     804147 <spawn+0x44e>
+  803d41:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  803d43:	ba 00 02 00 00       	mov    $0x200,%edx
+  803d48:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  803d4f:	48 b8 d9 1f 80 00 00 	movabs $0x801fd9,%rax
+  803d56:	00 00 00 
+  803d59:	ff d0                	call   *%rax
+  803d5b:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  803d5d:	3d 00 02 00 00       	cmp    $0x200,%eax
+  803d62:	0f 85 93 02 00 00    	jne    803ffb <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  803d68:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  803d6f:	ff ff 00 
+  803d72:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  803d79:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  803d80:	01 01 00 
+  803d83:	48 39 d0             	cmp    %rdx,%rax
+  803d86:	0f 85 ab 02 00 00    	jne    804037 <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  803d8c:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  803d93:	00 3e 00 
+  803d96:	0f 85 9b 02 00 00    	jne    804037 <spawn+0x33e>
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  803d9c:	b8 08 00 00 00       	mov    $0x8,%eax
+  803da1:	0f 05                	syscall
+  803da3:	41 89 c6             	mov    %eax,%r14d
+  803da6:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  803dac:	85 c0                	test   %eax,%eax
+  803dae:	0f 88 75 03 00 00    	js     804129 <spawn+0x430>
+    envid_t child = res;
+  803db4:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  803dba:	89 c2                	mov    %eax,%edx
+  803dbc:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  803dc2:	48 89 d0             	mov    %rdx,%rax
+  803dc5:	48 c1 e0 04          	shl    $0x4,%rax
+  803dc9:	48 29 d0             	sub    %rdx,%rax
+  803dcc:	48 c1 e0 05          	shl    $0x5,%rax
+  803dd0:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  803dd7:	00 00 00 
+  803dda:	48 01 c6             	add    %rax,%rsi
+  803ddd:	48 8b 06             	mov    (%rsi),%rax
+  803de0:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  803de7:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  803dee:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  803df5:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  803dfc:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  803e03:	48 29 ce             	sub    %rcx,%rsi
+  803e06:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  803e0c:	c1 e9 03             	shr    $0x3,%ecx
+  803e0f:	89 c9                	mov    %ecx,%ecx
+  803e11:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  803e14:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  803e1b:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e22:	49 8b 3c 24          	mov    (%r12),%rdi
+  803e26:	48 85 ff             	test   %rdi,%rdi
+  803e29:	0f 84 d6 05 00 00    	je     804405 <spawn+0x70c>
+  803e2f:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  803e35:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  803e3b:	48 bb da 11 80 00 00 	movabs $0x8011da,%rbx
+  803e42:	00 00 00 
+  803e45:	ff d3                	call   *%rbx
+  803e47:	4c 01 f8             	add    %r15,%rax
+  803e4a:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  803e4e:	4c 89 ea             	mov    %r13,%rdx
+  803e51:	49 83 c5 01          	add    $0x1,%r13
+  803e55:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  803e5a:	48 85 ff             	test   %rdi,%rdi
+  803e5d:	75 e6                	jne    803e45 <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  803e5f:	49 89 d5             	mov    %rdx,%r13
+  803e62:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  803e69:	48 f7 d0             	not    %rax
+  803e6c:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  803e73:	49 89 df             	mov    %rbx,%r15
+  803e76:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  803e7a:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  803e81:	89 d0                	mov    %edx,%eax
+  803e83:	83 c0 01             	add    $0x1,%eax
+  803e86:	48 98                	cltq
+  803e88:	48 c1 e0 03          	shl    $0x3,%rax
+  803e8c:	49 29 c7             	sub    %rax,%r15
+  803e8f:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  803e96:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  803e9a:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  803ea0:	0f 86 4f 05 00 00    	jbe    8043f5 <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  803ea6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803eab:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803eb0:	be 00 00 40 00       	mov    $0x400000,%esi
+  803eb5:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  803ebc:	00 00 00 
+  803ebf:	ff d0                	call   *%rax
+  803ec1:	85 c0                	test   %eax,%eax
+  803ec3:	0f 88 31 05 00 00    	js     8043fa <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  803ec9:	4c 89 e8             	mov    %r13,%rax
+  803ecc:	45 85 ed             	test   %r13d,%r13d
+  803ecf:	7e 65                	jle    803f36 <spawn+0x23d>
+  803ed1:	4d 89 fd             	mov    %r15,%r13
+  803ed4:	48 98                	cltq
+  803ed6:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803eda:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  803ee1:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  803ee4:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  803eeb:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  803eee:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  803ef5:	ff 
+  803ef6:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  803efa:	49 8b 34 24          	mov    (%r12),%rsi
+  803efe:	48 89 df             	mov    %rbx,%rdi
+  803f01:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  803f08:	00 00 00 
+  803f0b:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  803f0d:	49 8b 3c 24          	mov    (%r12),%rdi
+  803f11:	48 b8 da 11 80 00 00 	movabs $0x8011da,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+  803f1d:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  803f22:	49 83 c5 08          	add    $0x8,%r13
+  803f26:	49 83 c4 08          	add    $0x8,%r12
+  803f2a:	4d 39 ee             	cmp    %r13,%r14
+  803f2d:	75 bf                	jne    803eee <spawn+0x1f5>
+  803f2f:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  803f36:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  803f3d:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  803f44:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  803f45:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  803f4c:	0f 85 2c 01 00 00    	jne    80407e <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  803f52:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  803f59:	00 00 00 
+  803f5c:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  803f63:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  803f6a:	ff 
+  803f6b:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  803f6f:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  803f76:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  803f7a:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  803f81:	00 00 00 
+  803f84:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  803f8b:	ff 
+  803f8c:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  803f93:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  803f99:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  803f9f:	44 89 f2             	mov    %r14d,%edx
+  803fa2:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fa7:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fac:	48 b8 95 50 80 00 00 	movabs $0x805095,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  803fb8:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803fbd:	be 00 00 40 00       	mov    $0x400000,%esi
+  803fc2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc7:	48 b8 ce 50 80 00 00 	movabs $0x8050ce,%rax
+  803fce:	00 00 00 
+  803fd1:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  803fd3:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  803fda:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  803fe1:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  803fe2:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  803fe9:	00 
+  803fea:	0f 84 5d 03 00 00    	je     80434d <spawn+0x654>
+  803ff0:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  803ff6:	e9 1b 02 00 00       	jmp    804216 <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  803ffb:	48 bf 80 61 80 00 00 	movabs $0x806180,%rdi
+  804002:	00 00 00 
+  804005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400a:	48 ba f3 08 80 00 00 	movabs $0x8008f3,%rdx
+  804011:	00 00 00 
+  804014:	ff d2                	call   *%rdx
+        close(fd);
+  804016:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  80401c:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  804023:	00 00 00 
+  804026:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804028:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  80402f:	ff ff ff 
+  804032:	e9 10 01 00 00       	jmp    804147 <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804037:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  80403c:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  804042:	48 bf 37 62 80 00 00 	movabs $0x806237,%rdi
+  804049:	00 00 00 
+  80404c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804051:	48 b9 f3 08 80 00 00 	movabs $0x8008f3,%rcx
+  804058:	00 00 00 
+  80405b:	ff d1                	call   *%rcx
+        close(fd);
+  80405d:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804063:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  80406a:	00 00 00 
+  80406d:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  80406f:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  804076:	ff ff ff 
+  804079:	e9 c9 00 00 00       	jmp    804147 <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  80407e:	48 b9 b0 61 80 00 00 	movabs $0x8061b0,%rcx
+  804085:	00 00 00 
+  804088:	48 ba 51 62 80 00 00 	movabs $0x806251,%rdx
+  80408f:	00 00 00 
+  804092:	be f9 00 00 00       	mov    $0xf9,%esi
+  804097:	48 bf 66 62 80 00 00 	movabs $0x806266,%rdi
+  80409e:	00 00 00 
+  8040a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a6:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  8040ad:	00 00 00 
+  8040b0:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  8040b3:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  8040b7:	48 29 f2             	sub    %rsi,%rdx
+  8040ba:	89 d9                	mov    %ebx,%ecx
+  8040bc:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  8040c2:	48 b8 5f 50 80 00 00 	movabs $0x80505f,%rax
+  8040c9:	00 00 00 
+  8040cc:	ff d0                	call   *%rax
+  8040ce:	e9 f0 01 00 00       	jmp    8042c3 <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  8040d3:	89 c6                	mov    %eax,%esi
+  8040d5:	48 bf e0 61 80 00 00 	movabs $0x8061e0,%rdi
+  8040dc:	00 00 00 
+  8040df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040e4:	48 ba f3 08 80 00 00 	movabs $0x8008f3,%rdx
+  8040eb:	00 00 00 
+  8040ee:	ff d2                	call   *%rdx
+    scring_discard();
+  8040f0:	48 b8 3f 50 80 00 00 	movabs $0x80503f,%rax
+  8040f7:	00 00 00 
+  8040fa:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  8040fc:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804101:	be 00 00 40 00       	mov    $0x400000,%esi
+  804106:	bf 00 00 00 00       	mov    $0x0,%edi
+  80410b:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  804112:	00 00 00 
+  804115:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  804117:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  80411d:	48 b8 87 16 80 00 00 	movabs $0x801687,%rax
+  804124:	00 00 00 
+  804127:	ff d0                	call   *%rax
+    close(fd);
+  804129:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  80412f:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  804136:	00 00 00 
+  804139:	ff d0                	call   *%rax
+    return res;
+  80413b:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  804141:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  804147:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  80414d:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  804154:	5b                   	pop    %rbx
+  804155:	41 5c                	pop    %r12
+  804157:	41 5d                	pop    %r13
+  804159:	41 5e                	pop    %r14
+  80415b:	41 5f                	pop    %r15
+  80415d:	5d                   	pop    %rbp
+  80415e:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  80415f:	89 c6                	mov    %eax,%esi
+  804161:	48 bf 72 62 80 00 00 	movabs $0x806272,%rdi
+  804168:	00 00 00 
+  80416b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804170:	48 ba f3 08 80 00 00 	movabs $0x8008f3,%rdx
+  804177:	00 00 00 
+  80417a:	ff d2                	call   *%rdx
+        return res;
+  80417c:	e9 6f ff ff ff       	jmp    8040f0 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  804181:	4c 89 e2             	mov    %r12,%rdx
+  804184:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80418b:	48 29 c2             	sub    %rax,%rdx
+  80418e:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  804195:	be 00 00 00 00       	mov    $0x0,%esi
+  80419a:	48 b8 64 13 80 00 00 	movabs $0x801364,%rax
+  8041a1:	00 00 00 
+  8041a4:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  8041a6:	80 cb 80             	or     $0x80,%bl
+  8041a9:	41 89 d9             	mov    %ebx,%r9d
+  8041ac:	4d 89 e0             	mov    %r12,%r8
+  8041af:	4c 89 f1             	mov    %r14,%rcx
+  8041b2:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  8041b8:	be 00 00 40 00       	mov    $0x400000,%esi
+  8041bd:	bf 00 00 00 00       	mov    $0x0,%edi
+  8041c2:	48 b8 95 50 80 00 00 	movabs $0x805095,%rax
+  8041c9:	00 00 00 
+  8041cc:	ff d0                	call   *%rax
+    res = scring_submit();
+  8041ce:	48 b8 f3 4f 80 00 00 	movabs $0x804ff3,%rax
+  8041d5:	00 00 00 
+  8041d8:	ff d0                	call   *%rax
+  8041da:	89 c3                	mov    %eax,%ebx
+  8041dc:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  8041e2:	4c 89 e6             	mov    %r12,%rsi
+  8041e5:	bf 00 00 40 00       	mov    $0x400000,%edi
+  8041ea:	48 b8 c6 37 80 00 00 	movabs $0x8037c6,%rax
+  8041f1:	00 00 00 
+  8041f4:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  8041f6:	85 db                	test   %ebx,%ebx
+  8041f8:	0f 88 f2 fe ff ff    	js     8040f0 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8041fe:	49 83 c7 01          	add    $0x1,%r15
+  804202:	49 83 c5 38          	add    $0x38,%r13
+  804206:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  80420d:	49 39 c7             	cmp    %rax,%r15
+  804210:	0f 83 37 01 00 00    	jae    80434d <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  804216:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  80421b:	75 e1                	jne    8041fe <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  80421d:	41 8b 45 04          	mov    0x4(%r13),%eax
+  804221:	89 c3                	mov    %eax,%ebx
+  804223:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804226:	89 da                	mov    %ebx,%edx
+  804228:	83 ca 04             	or     $0x4,%edx
+  80422b:	a8 04                	test   $0x4,%al
+  80422d:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  804230:	89 da                	mov    %ebx,%edx
+  804232:	83 ca 01             	or     $0x1,%edx
+  804235:	a8 01                	test   $0x1,%al
+  804237:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  80423a:	49 8b 45 08          	mov    0x8(%r13),%rax
+  80423e:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  804244:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  804248:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  80424f:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  804253:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  80425a:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  80425e:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  804264:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  80426a:	44 89 f2             	mov    %r14d,%edx
+  80426d:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804273:	74 22                	je     804297 <spawn+0x59e>
+        va -= res;
+  804275:	48 63 ca             	movslq %edx,%rcx
+  804278:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  80427b:	48 01 cf             	add    %rcx,%rdi
+  80427e:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  804285:	48 01 ce             	add    %rcx,%rsi
+  804288:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  80428f:	29 d0                	sub    %edx,%eax
+  804291:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  804297:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  80429e:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  8042a5:	00 
+  8042a6:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  8042ad:	49 89 f4             	mov    %rsi,%r12
+  8042b0:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  8042b3:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  8042ba:	49 39 c4             	cmp    %rax,%r12
+  8042bd:	0f 82 f0 fd ff ff    	jb     8040b3 <spawn+0x3ba>
+    res = scring_submit();
+  8042c3:	48 b8 f3 4f 80 00 00 	movabs $0x804ff3,%rax
+  8042ca:	00 00 00 
+  8042cd:	ff d0                	call   *%rax
+  8042cf:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  8042d5:	85 c0                	test   %eax,%eax
+  8042d7:	0f 88 f6 fd ff ff    	js     8040d3 <spawn+0x3da>
+    if (!filesz) return 0;
+  8042dd:	4d 85 e4             	test   %r12,%r12
+  8042e0:	0f 84 18 ff ff ff    	je     8041fe <spawn+0x505>
+    void *addr = UTEMP;
+  8042e6:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  8042ed:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  8042f1:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  8042f8:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  8042ff:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  804304:	ba 06 00 00 00       	mov    $0x6,%edx
+  804309:	4c 89 e6             	mov    %r12,%rsi
+  80430c:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  804313:	48 b8 43 39 80 00 00 	movabs $0x803943,%rax
+  80431a:	00 00 00 
+  80431d:	ff d0                	call   *%rax
+  80431f:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  804325:	85 c0                	test   %eax,%eax
+  804327:	0f 88 32 fe ff ff    	js     80415f <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  80432d:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804334:	49 39 c4             	cmp    %rax,%r12
+  804337:	49 0f 46 c4          	cmovbe %r12,%rax
+  80433b:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  804342:	0f 83 5e fe ff ff    	jae    8041a6 <spawn+0x4ad>
+  804348:	e9 34 fe ff ff       	jmp    804181 <spawn+0x488>
+    close(fd);
+  80434d:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804353:	48 b8 9d 1d 80 00 00 	movabs $0x801d9d,%rax
+  80435a:	00 00 00 
+  80435d:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  80435f:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  804366:	48 bf a4 3c 80 00 00 	movabs $0x803ca4,%rdi
+  80436d:	00 00 00 
+  804370:	48 b8 94 4d 80 00 00 	movabs $0x804d94,%rax
+  804377:	00 00 00 
+  80437a:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  80437c:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  804383:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804389:	48 b8 3f 51 80 00 00 	movabs $0x80513f,%rax
+  804390:	00 00 00 
+  804393:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  804395:	be 02 00 00 00       	mov    $0x2,%esi
+  80439a:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  8043a0:	48 b8 07 51 80 00 00 	movabs $0x805107,%rax
+  8043a7:	00 00 00 
+  8043aa:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  8043ac:	48 b8 f3 4f 80 00 00 	movabs $0x804ff3,%rax
+  8043b3:	00 00 00 
+  8043b6:	ff d0                	call   *%rax
+  8043b8:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  8043be:	85 c0                	test   %eax,%eax
+  8043c0:	78 11                	js     8043d3 <spawn+0x6da>
+    return child;
+  8043c2:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  8043c8:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  8043ce:	e9 74 fd ff ff       	jmp    804147 <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  8043d3:	89 c6                	mov    %eax,%esi
+  8043d5:	48 bf 10 62 80 00 00 	movabs $0x806210,%rdi
+  8043dc:	00 00 00 
+  8043df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043e4:	48 ba f3 08 80 00 00 	movabs $0x8008f3,%rdx
+  8043eb:	00 00 00 
+  8043ee:	ff d2                	call   *%rdx
+        goto error;
+  8043f0:	e9 fb fc ff ff       	jmp    8040f0 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  8043f5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  8043fa:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  804400:	e9 eb fc ff ff       	jmp    8040f0 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804405:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80440a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80440f:	be 00 00 40 00       	mov    $0x400000,%esi
+  804414:	bf 00 00 00 00       	mov    $0x0,%edi
+  804419:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  804420:	00 00 00 
+  804423:	ff d0                	call   *%rax
+  804425:	85 c0                	test   %eax,%eax
+  804427:	78 d1                	js     8043fa <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  804429:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  804430:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804434:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  80443b:	f8 ff 40 00 
+  80443f:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  804446:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  80444a:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  80444f:	e9 e2 fa ff ff       	jmp    803f36 <spawn+0x23d>
+
+0000000000804454 <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  804454:	55                   	push   %rbp
+  804455:	48 89 e5             	mov    %rsp,%rbp
+  804458:	48 83 ec 50          	sub    $0x50,%rsp
+  80445c:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  804460:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804464:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804468:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  80446c:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  804473:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804477:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80447b:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80447f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  804483:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  804488:	eb 15                	jmp    80449f <spawnl+0x4b>
+  80448a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80448e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  804492:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804496:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  80449a:	74 1c                	je     8044b8 <spawnl+0x64>
+  80449c:	83 c1 01             	add    $0x1,%ecx
+  80449f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8044a2:	83 f8 2f             	cmp    $0x2f,%eax
+  8044a5:	77 e3                	ja     80448a <spawnl+0x36>
+  8044a7:	89 c2                	mov    %eax,%edx
+  8044a9:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  8044ad:	4c 01 d2             	add    %r10,%rdx
+  8044b0:	83 c0 08             	add    $0x8,%eax
+  8044b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8044b6:	eb de                	jmp    804496 <spawnl+0x42>
+    const char *argv[argc + 2];
+  8044b8:	8d 41 02             	lea    0x2(%rcx),%eax
+  8044bb:	48 98                	cltq
+  8044bd:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  8044c4:	00 
+  8044c5:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  8044c9:	48 29 c4             	sub    %rax,%rsp
+  8044cc:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  8044d1:	4c 89 c0             	mov    %r8,%rax
+  8044d4:	48 c1 e8 03          	shr    $0x3,%rax
+  8044d8:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  8044dc:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  8044e3:	00 
+    argv[argc + 1] = NULL;
+  8044e4:	8d 41 01             	lea    0x1(%rcx),%eax
+  8044e7:	48 98                	cltq
+  8044e9:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  8044f0:	00 
+    va_start(vl, arg0);
+  8044f1:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8044f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8044fc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804500:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  804504:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  804508:	85 c9                	test   %ecx,%ecx
+  80450a:	74 41                	je     80454d <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  80450c:	49 89 c1             	mov    %rax,%r9
+  80450f:	49 8d 40 08          	lea    0x8(%r8),%rax
+  804513:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  804516:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  80451b:	eb 1b                	jmp    804538 <spawnl+0xe4>
+  80451d:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  804521:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  804525:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  804529:	48 8b 11             	mov    (%rcx),%rdx
+  80452c:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  80452f:	48 83 c0 08          	add    $0x8,%rax
+  804533:	48 39 f0             	cmp    %rsi,%rax
+  804536:	74 15                	je     80454d <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  804538:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  80453b:	83 fa 2f             	cmp    $0x2f,%edx
+  80453e:	77 dd                	ja     80451d <spawnl+0xc9>
+  804540:	89 d1                	mov    %edx,%ecx
+  804542:	4c 01 c9             	add    %r9,%rcx
+  804545:	83 c2 08             	add    $0x8,%edx
+  804548:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  80454b:	eb dc                	jmp    804529 <spawnl+0xd5>
+    return spawn(prog, argv);
+  80454d:	4c 89 c6             	mov    %r8,%rsi
+  804550:	48 b8 f9 3c 80 00 00 	movabs $0x803cf9,%rax
+  804557:	00 00 00 
+  80455a:	ff d0                	call   *%rax
+}
+  80455c:	c9                   	leave
+  80455d:	c3                   	ret
+
+000000000080455e <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80455e:	55                   	push   %rbp
+  80455f:	48 89 e5             	mov    %rsp,%rbp
+  804562:	41 54                	push   %r12
+  804564:	53                   	push   %rbx
+  804565:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804568:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  80456f:	00 00 00 
+  804572:	ff d0                	call   *%rax
+  804574:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  804577:	48 be 8f 62 80 00 00 	movabs $0x80628f,%rsi
+  80457e:	00 00 00 
+  804581:	48 89 df             	mov    %rbx,%rdi
+  804584:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  80458b:	00 00 00 
+  80458e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  804590:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  804595:	41 2b 04 24          	sub    (%r12),%eax
+  804599:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80459f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8045a6:	00 00 00 
+    stat->st_dev = &devpipe;
+  8045a9:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8045b0:	00 00 00 
+  8045b3:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8045ba:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045bf:	5b                   	pop    %rbx
+  8045c0:	41 5c                	pop    %r12
+  8045c2:	5d                   	pop    %rbp
+  8045c3:	c3                   	ret
+
+00000000008045c4 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045c4:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8045c7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8045cd:	8b 17                	mov    (%rdi),%edx
+  8045cf:	85 d2                	test   %edx,%edx
+  8045d1:	75 01                	jne    8045d4 <pipe_wakeup+0x10>
+  8045d3:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8045d4:	55                   	push   %rbp
+  8045d5:	48 89 e5             	mov    %rsp,%rbp
+  8045d8:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8045db:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8045e1:	be 00 04 00 00       	mov    $0x400,%esi
+  8045e6:	48 b8 03 1b 80 00 00 	movabs $0x801b03,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+}
+  8045f2:	5d                   	pop    %rbp
+  8045f3:	c3                   	ret
+
+00000000008045f4 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8045f4:	55                   	push   %rbp
+  8045f5:	48 89 e5             	mov    %rsp,%rbp
+  8045f8:	41 55                	push   %r13
+  8045fa:	41 54                	push   %r12
+  8045fc:	53                   	push   %rbx
+  8045fd:	48 83 ec 08          	sub    $0x8,%rsp
+  804601:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804604:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  80460b:	00 00 00 
+  80460e:	ff d0                	call   *%rax
+  804610:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  804613:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804618:	4c 89 e6             	mov    %r12,%rsi
+  80461b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804620:	49 bc 1d 18 80 00 00 	movabs $0x80181d,%r12
+  804627:	00 00 00 
+  80462a:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80462d:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  804631:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  804635:	49 bd c4 45 80 00 00 	movabs $0x8045c4,%r13
+  80463c:	00 00 00 
+  80463f:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804642:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804646:	48 89 de             	mov    %rbx,%rsi
+  804649:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  80464c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804651:	48 89 de             	mov    %rbx,%rsi
+  804654:	bf 00 00 00 00       	mov    $0x0,%edi
+  804659:	41 ff d4             	call   *%r12
+  80465c:	48 83 c4 08          	add    $0x8,%rsp
+  804660:	5b                   	pop    %rbx
+  804661:	41 5c                	pop    %r12
+  804663:	41 5d                	pop    %r13
+  804665:	5d                   	pop    %rbp
+  804666:	c3                   	ret
+
+0000000000804667 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  804667:	55                   	push   %rbp
+  804668:	48 89 e5             	mov    %rsp,%rbp
+  80466b:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  80466e:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  804673:	be 00 10 00 00       	mov    $0x1000,%esi
+  804678:	48 b8 60 17 80 00 00 	movabs $0x801760,%rax
+  80467f:	00 00 00 
+  804682:	ff d0                	call   *%rax
+  804684:	85 c0                	test   %eax,%eax
+  804686:	0f 94 c0             	sete   %al
+  804689:	0f b6 c0             	movzbl %al,%eax
+}
+  80468c:	5d                   	pop    %rbp
+  80468d:	c3                   	ret
+
+000000000080468e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80468e:	55                   	push   %rbp
+  80468f:	48 89 e5             	mov    %rsp,%rbp
+  804692:	41 57                	push   %r15
+  804694:	41 56                	push   %r14
+  804696:	41 55                	push   %r13
+  804698:	41 54                	push   %r12
+  80469a:	53                   	push   %rbx
+  80469b:	48 83 ec 38          	sub    $0x38,%rsp
+  80469f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8046a3:	49 89 f4             	mov    %rsi,%r12
+  8046a6:	49 89 d7             	mov    %rdx,%r15
+  8046a9:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8046ad:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  8046b4:	00 00 00 
+  8046b7:	ff d0                	call   *%rax
+  8046b9:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8046bc:	4d 85 ff             	test   %r15,%r15
+  8046bf:	0f 84 f1 00 00 00    	je     8047b6 <devpipe_write+0x128>
+  8046c5:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  8046c9:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  8046cd:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  8046d1:	49 bd 67 46 80 00 00 	movabs $0x804667,%r13
+  8046d8:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8046db:	49 bf c4 45 80 00 00 	movabs $0x8045c4,%r15
+  8046e2:	00 00 00 
+  8046e5:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8046e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8046ed:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  8046f1:	8b 73 04             	mov    0x4(%rbx),%esi
+  8046f4:	48 63 ce             	movslq %esi,%rcx
+  8046f7:	48 63 03             	movslq (%rbx),%rax
+  8046fa:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  804700:	48 39 c1             	cmp    %rax,%rcx
+  804703:	72 64                	jb     804769 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  804705:	48 89 de             	mov    %rbx,%rsi
+  804708:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80470c:	41 ff d5             	call   *%r13
+  80470f:	85 c0                	test   %eax,%eax
+  804711:	0f 85 b9 00 00 00    	jne    8047d0 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  804717:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80471b:	4c 89 f7             	mov    %r14,%rdi
+  80471e:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  804721:	8b 43 04             	mov    0x4(%rbx),%eax
+  804724:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  80472b:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804732:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804738:	8b 03                	mov    (%rbx),%eax
+  80473a:	41 39 c4             	cmp    %eax,%r12d
+  80473d:	75 b2                	jne    8046f1 <devpipe_write+0x63>
+  80473f:	48 89 de             	mov    %rbx,%rsi
+  804742:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804746:	41 ff d5             	call   *%r13
+  804749:	85 c0                	test   %eax,%eax
+  80474b:	75 a0                	jne    8046ed <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80474d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  804752:	44 89 e6             	mov    %r12d,%esi
+  804755:	48 89 df             	mov    %rbx,%rdi
+  804758:	48 b8 e5 1a 80 00 00 	movabs $0x801ae5,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+  804764:	e9 7c ff ff ff       	jmp    8046e5 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  804769:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  80476d:	41 0f b6 38          	movzbl (%r8),%edi
+  804771:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  804778:	80 80 80 
+  80477b:	48 89 c8             	mov    %rcx,%rax
+  80477e:	48 f7 e2             	mul    %rdx
+  804781:	48 c1 ea 0b          	shr    $0xb,%rdx
+  804785:	48 89 d0             	mov    %rdx,%rax
+  804788:	48 c1 e0 08          	shl    $0x8,%rax
+  80478c:	48 29 d0             	sub    %rdx,%rax
+  80478f:	48 c1 e0 04          	shl    $0x4,%rax
+  804793:	48 29 c1             	sub    %rax,%rcx
+  804796:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  80479b:	83 c6 01             	add    $0x1,%esi
+  80479e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8047a1:	49 83 c0 01          	add    $0x1,%r8
+  8047a5:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  8047a9:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8047ad:	49 39 c0             	cmp    %rax,%r8
+  8047b0:	0f 85 2f ff ff ff    	jne    8046e5 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8047b6:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8047ba:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8047be:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  8047c5:	00 00 00 
+  8047c8:	ff d0                	call   *%rax
+    return n;
+  8047ca:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8047ce:	eb 05                	jmp    8047d5 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  8047d0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8047d5:	48 83 c4 38          	add    $0x38,%rsp
+  8047d9:	5b                   	pop    %rbx
+  8047da:	41 5c                	pop    %r12
+  8047dc:	41 5d                	pop    %r13
+  8047de:	41 5e                	pop    %r14
+  8047e0:	41 5f                	pop    %r15
+  8047e2:	5d                   	pop    %rbp
+  8047e3:	c3                   	ret
+
+00000000008047e4 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  8047e4:	55                   	push   %rbp
+  8047e5:	48 89 e5             	mov    %rsp,%rbp
+  8047e8:	41 57                	push   %r15
+  8047ea:	41 56                	push   %r14
+  8047ec:	41 55                	push   %r13
+  8047ee:	41 54                	push   %r12
+  8047f0:	53                   	push   %rbx
+  8047f1:	48 83 ec 28          	sub    $0x28,%rsp
+  8047f5:	49 89 fd             	mov    %rdi,%r13
+  8047f8:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8047fc:	49 89 d4             	mov    %rdx,%r12
+  8047ff:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  804803:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  80480a:	00 00 00 
+  80480d:	ff d0                	call   *%rax
+  80480f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  804812:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  804818:	49 bf 67 46 80 00 00 	movabs $0x804667,%r15
+  80481f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  804822:	4d 85 e4             	test   %r12,%r12
+  804825:	0f 84 d5 00 00 00    	je     804900 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  80482b:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  80482f:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  804833:	8b 03                	mov    (%rbx),%eax
+  804835:	3b 43 04             	cmp    0x4(%rbx),%eax
+  804838:	75 7a                	jne    8048b4 <devpipe_read+0xd0>
+            if (i > 0) {
+  80483a:	4d 85 f6             	test   %r14,%r14
+  80483d:	75 50                	jne    80488f <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  80483f:	48 89 de             	mov    %rbx,%rsi
+  804842:	4c 89 ef             	mov    %r13,%rdi
+  804845:	41 ff d7             	call   *%r15
+  804848:	85 c0                	test   %eax,%eax
+  80484a:	0f 85 c9 00 00 00    	jne    804919 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  804850:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  804853:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80485a:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  804860:	8b 43 04             	mov    0x4(%rbx),%eax
+  804863:	41 39 c4             	cmp    %eax,%r12d
+  804866:	75 cb                	jne    804833 <devpipe_read+0x4f>
+  804868:	48 89 de             	mov    %rbx,%rsi
+  80486b:	4c 89 ef             	mov    %r13,%rdi
+  80486e:	41 ff d7             	call   *%r15
+  804871:	85 c0                	test   %eax,%eax
+  804873:	75 be                	jne    804833 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  804875:	ba 0a 00 00 00       	mov    $0xa,%edx
+  80487a:	44 89 e6             	mov    %r12d,%esi
+  80487d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  804881:	48 b8 e5 1a 80 00 00 	movabs $0x801ae5,%rax
+  804888:	00 00 00 
+  80488b:	ff d0                	call   *%rax
+  80488d:	eb a4                	jmp    804833 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  80488f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804893:	48 89 de             	mov    %rbx,%rsi
+  804896:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  80489d:	00 00 00 
+  8048a0:	ff d0                	call   *%rax
+                return i;
+  8048a2:	4c 89 f0             	mov    %r14,%rax
+}
+  8048a5:	48 83 c4 28          	add    $0x28,%rsp
+  8048a9:	5b                   	pop    %rbx
+  8048aa:	41 5c                	pop    %r12
+  8048ac:	41 5d                	pop    %r13
+  8048ae:	41 5e                	pop    %r14
+  8048b0:	41 5f                	pop    %r15
+  8048b2:	5d                   	pop    %rbp
+  8048b3:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  8048b4:	48 63 c8             	movslq %eax,%rcx
+  8048b7:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8048be:	80 80 80 
+  8048c1:	48 89 c8             	mov    %rcx,%rax
+  8048c4:	48 f7 e2             	mul    %rdx
+  8048c7:	48 c1 ea 0b          	shr    $0xb,%rdx
+  8048cb:	48 89 d0             	mov    %rdx,%rax
+  8048ce:	48 c1 e0 08          	shl    $0x8,%rax
+  8048d2:	48 29 d0             	sub    %rdx,%rax
+  8048d5:	48 c1 e0 04          	shl    $0x4,%rax
+  8048d9:	48 89 c2             	mov    %rax,%rdx
+  8048dc:	48 89 c8             	mov    %rcx,%rax
+  8048df:	48 29 d0             	sub    %rdx,%rax
+  8048e2:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  8048e7:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8048eb:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  8048ef:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  8048f2:	49 83 c6 01          	add    $0x1,%r14
+  8048f6:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  8048fa:	0f 85 2b ff ff ff    	jne    80482b <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  804900:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  804904:	48 89 de             	mov    %rbx,%rsi
+  804907:	48 b8 c4 45 80 00 00 	movabs $0x8045c4,%rax
+  80490e:	00 00 00 
+  804911:	ff d0                	call   *%rax
+    return n;
+  804913:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  804917:	eb 8c                	jmp    8048a5 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  804919:	b8 00 00 00 00       	mov    $0x0,%eax
+  80491e:	eb 85                	jmp    8048a5 <devpipe_read+0xc1>
+
+0000000000804920 <pipe>:
+pipe(int pfd[2]) {
+  804920:	55                   	push   %rbp
+  804921:	48 89 e5             	mov    %rsp,%rbp
+  804924:	41 55                	push   %r13
+  804926:	41 54                	push   %r12
+  804928:	53                   	push   %rbx
+  804929:	48 83 ec 18          	sub    $0x18,%rsp
+  80492d:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  804930:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  804934:	48 b8 d8 1b 80 00 00 	movabs $0x801bd8,%rax
+  80493b:	00 00 00 
+  80493e:	ff d0                	call   *%rax
+  804940:	89 c3                	mov    %eax,%ebx
+  804942:	85 c0                	test   %eax,%eax
+  804944:	0f 88 a0 01 00 00    	js     804aea <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  80494a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80494f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804954:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804958:	bf 00 00 00 00       	mov    $0x0,%edi
+  80495d:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  804964:	00 00 00 
+  804967:	ff d0                	call   *%rax
+  804969:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  80496b:	85 c0                	test   %eax,%eax
+  80496d:	0f 88 77 01 00 00    	js     804aea <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  804973:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  804977:	48 b8 d8 1b 80 00 00 	movabs $0x801bd8,%rax
+  80497e:	00 00 00 
+  804981:	ff d0                	call   *%rax
+  804983:	89 c3                	mov    %eax,%ebx
+  804985:	85 c0                	test   %eax,%eax
+  804987:	0f 88 43 01 00 00    	js     804ad0 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  80498d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804992:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804997:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  80499b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049a0:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8049a7:	00 00 00 
+  8049aa:	ff d0                	call   *%rax
+  8049ac:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  8049ae:	85 c0                	test   %eax,%eax
+  8049b0:	0f 88 1a 01 00 00    	js     804ad0 <pipe+0x1b0>
+    va = fd2data(fd0);
+  8049b6:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8049ba:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  8049c1:	00 00 00 
+  8049c4:	ff d0                	call   *%rax
+  8049c6:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  8049c9:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8049ce:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8049d3:	48 89 c6             	mov    %rax,%rsi
+  8049d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8049db:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8049e2:	00 00 00 
+  8049e5:	ff d0                	call   *%rax
+  8049e7:	89 c3                	mov    %eax,%ebx
+  8049e9:	85 c0                	test   %eax,%eax
+  8049eb:	0f 88 c5 00 00 00    	js     804ab6 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  8049f1:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  8049f5:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  8049fc:	00 00 00 
+  8049ff:	ff d0                	call   *%rax
+  804a01:	48 89 c1             	mov    %rax,%rcx
+  804a04:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  804a0a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  804a10:	ba 00 00 00 00       	mov    $0x0,%edx
+  804a15:	4c 89 ee             	mov    %r13,%rsi
+  804a18:	bf 00 00 00 00       	mov    $0x0,%edi
+  804a1d:	48 b8 cd 17 80 00 00 	movabs $0x8017cd,%rax
+  804a24:	00 00 00 
+  804a27:	ff d0                	call   *%rax
+  804a29:	89 c3                	mov    %eax,%ebx
+  804a2b:	85 c0                	test   %eax,%eax
+  804a2d:	78 6e                	js     804a9d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804a2f:	be 00 10 00 00       	mov    $0x1000,%esi
+  804a34:	4c 89 ef             	mov    %r13,%rdi
+  804a37:	48 b8 3c 17 80 00 00 	movabs $0x80173c,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+  804a43:	83 f8 02             	cmp    $0x2,%eax
+  804a46:	0f 85 ab 00 00 00    	jne    804af7 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  804a4c:	a1 60 70 80 00 00 00 	movabs 0x807060,%eax
+  804a53:	00 00 
+  804a55:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a59:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  804a5b:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  804a5f:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  804a66:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  804a6a:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  804a6c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  804a70:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  804a77:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  804a7b:	48 bb aa 1b 80 00 00 	movabs $0x801baa,%rbx
+  804a82:	00 00 00 
+  804a85:	ff d3                	call   *%rbx
+  804a87:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  804a8b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  804a8f:	ff d3                	call   *%rbx
+  804a91:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  804a96:	bb 00 00 00 00       	mov    $0x0,%ebx
+  804a9b:	eb 4d                	jmp    804aea <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  804a9d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804aa2:	4c 89 ee             	mov    %r13,%rsi
+  804aa5:	bf 00 00 00 00       	mov    $0x0,%edi
+  804aaa:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  804ab1:	00 00 00 
+  804ab4:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  804ab6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804abb:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  804abf:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ac4:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  804acb:	00 00 00 
+  804ace:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  804ad0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804ad5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  804ad9:	bf 00 00 00 00       	mov    $0x0,%edi
+  804ade:	48 b8 1d 18 80 00 00 	movabs $0x80181d,%rax
+  804ae5:	00 00 00 
+  804ae8:	ff d0                	call   *%rax
+}
+  804aea:	89 d8                	mov    %ebx,%eax
+  804aec:	48 83 c4 18          	add    $0x18,%rsp
+  804af0:	5b                   	pop    %rbx
+  804af1:	41 5c                	pop    %r12
+  804af3:	41 5d                	pop    %r13
+  804af5:	5d                   	pop    %rbp
+  804af6:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  804af7:	48 b9 a8 62 80 00 00 	movabs $0x8062a8,%rcx
+  804afe:	00 00 00 
+  804b01:	48 ba 51 62 80 00 00 	movabs $0x806251,%rdx
+  804b08:	00 00 00 
+  804b0b:	be 50 00 00 00       	mov    $0x50,%esi
+  804b10:	48 bf 96 62 80 00 00 	movabs $0x806296,%rdi
+  804b17:	00 00 00 
+  804b1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804b1f:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  804b26:	00 00 00 
+  804b29:	41 ff d0             	call   *%r8
+
+0000000000804b2c <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804b2c:	55                   	push   %rbp
+  804b2d:	48 89 e5             	mov    %rsp,%rbp
+  804b30:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804b34:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804b38:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  804b3f:	00 00 00 
+  804b42:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804b44:	85 c0                	test   %eax,%eax
+  804b46:	78 23                	js     804b6b <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804b48:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b4c:	48 b8 bc 1b 80 00 00 	movabs $0x801bbc,%rax
+  804b53:	00 00 00 
+  804b56:	ff d0                	call   *%rax
+  804b58:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804b5b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804b5f:	48 b8 67 46 80 00 00 	movabs $0x804667,%rax
+  804b66:	00 00 00 
+  804b69:	ff d0                	call   *%rax
+}
+  804b6b:	c9                   	leave
+  804b6c:	c3                   	ret
+
+0000000000804b6d <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  804b6d:	55                   	push   %rbp
+  804b6e:	48 89 e5             	mov    %rsp,%rbp
+  804b71:	41 56                	push   %r14
+  804b73:	41 55                	push   %r13
+  804b75:	41 54                	push   %r12
+  804b77:	53                   	push   %rbx
+    assert(envid != 0);
+  804b78:	85 ff                	test   %edi,%edi
+  804b7a:	0f 84 b7 00 00 00    	je     804c37 <wait+0xca>
+  804b80:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  804b83:	89 f9                	mov    %edi,%ecx
+  804b85:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  804b8b:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  804b92:	00 00 00 
+  804b95:	45 89 e0             	mov    %r12d,%r8d
+  804b98:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  804b9f:	4c 89 c0             	mov    %r8,%rax
+  804ba2:	48 c1 e0 04          	shl    $0x4,%rax
+  804ba6:	48 89 c2             	mov    %rax,%rdx
+  804ba9:	4c 29 c2             	sub    %r8,%rdx
+  804bac:	48 c1 e2 05          	shl    $0x5,%rdx
+  804bb0:	48 01 fa             	add    %rdi,%rdx
+  804bb3:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804bb9:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  804bbf:	41 39 c4             	cmp    %eax,%r12d
+  804bc2:	75 6a                	jne    804c2e <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804bc4:	48 63 d1             	movslq %ecx,%rdx
+  804bc7:	48 89 d0             	mov    %rdx,%rax
+  804bca:	48 c1 e0 04          	shl    $0x4,%rax
+  804bce:	48 29 d0             	sub    %rdx,%rax
+  804bd1:	48 c1 e0 05          	shl    $0x5,%rax
+  804bd5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804bdc:	00 00 00 
+  804bdf:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  804be6:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804be7:	48 63 c9             	movslq %ecx,%rcx
+  804bea:	48 89 c8             	mov    %rcx,%rax
+  804bed:	48 c1 e0 04          	shl    $0x4,%rax
+  804bf1:	48 29 c8             	sub    %rcx,%rax
+  804bf4:	48 c1 e0 05          	shl    $0x5,%rax
+  804bf8:	48 89 d3             	mov    %rdx,%rbx
+  804bfb:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804bfe:	49 bd e5 1a 80 00 00 	movabs $0x801ae5,%r13
+  804c05:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804c08:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  804c0e:	85 c0                	test   %eax,%eax
+  804c10:	74 1c                	je     804c2e <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  804c12:	ba 00 00 00 00       	mov    $0x0,%edx
+  804c17:	4c 89 f7             	mov    %r14,%rdi
+  804c1a:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  804c1d:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  804c23:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  804c29:	44 39 e0             	cmp    %r12d,%eax
+  804c2c:	74 da                	je     804c08 <wait+0x9b>
+    }
+}
+  804c2e:	5b                   	pop    %rbx
+  804c2f:	41 5c                	pop    %r12
+  804c31:	41 5d                	pop    %r13
+  804c33:	41 5e                	pop    %r14
+  804c35:	5d                   	pop    %rbp
+  804c36:	c3                   	ret
+    assert(envid != 0);
+  804c37:	48 b9 cc 62 80 00 00 	movabs $0x8062cc,%rcx
+  804c3e:	00 00 00 
+  804c41:	48 ba 51 62 80 00 00 	movabs $0x806251,%rdx
+  804c48:	00 00 00 
+  804c4b:	be 06 00 00 00       	mov    $0x6,%esi
+  804c50:	48 bf d7 62 80 00 00 	movabs $0x8062d7,%rdi
+  804c57:	00 00 00 
+  804c5a:	b8 00 00 00 00       	mov    $0x0,%eax
+  804c5f:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  804c66:	00 00 00 
+  804c69:	41 ff d0             	call   *%r8
+
+0000000000804c6c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804c6c:	48 89 f8             	mov    %rdi,%rax
+  804c6f:	48 c1 e8 27          	shr    $0x27,%rax
+  804c73:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804c7a:	01 00 00 
+  804c7d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c81:	f6 c2 01             	test   $0x1,%dl
+  804c84:	74 6d                	je     804cf3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804c86:	48 89 f8             	mov    %rdi,%rax
+  804c89:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804c8d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804c94:	01 00 00 
+  804c97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804c9b:	f6 c2 01             	test   $0x1,%dl
+  804c9e:	74 62                	je     804d02 <get_uvpt_entry+0x96>
+  804ca0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804ca7:	01 00 00 
+  804caa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804cae:	f6 c2 80             	test   $0x80,%dl
+  804cb1:	75 4f                	jne    804d02 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804cb3:	48 89 f8             	mov    %rdi,%rax
+  804cb6:	48 c1 e8 15          	shr    $0x15,%rax
+  804cba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804cc1:	01 00 00 
+  804cc4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804cc8:	f6 c2 01             	test   $0x1,%dl
+  804ccb:	74 44                	je     804d11 <get_uvpt_entry+0xa5>
+  804ccd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804cd4:	01 00 00 
+  804cd7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804cdb:	f6 c2 80             	test   $0x80,%dl
+  804cde:	75 31                	jne    804d11 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804ce0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804ce4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804ceb:	01 00 00 
+  804cee:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804cf2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804cf3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804cfa:	01 00 00 
+  804cfd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804d01:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804d02:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804d09:	01 00 00 
+  804d0c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804d10:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804d11:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804d18:	01 00 00 
+  804d1b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804d1f:	c3                   	ret
+
+0000000000804d20 <get_prot>:
+
+int
+get_prot(void *va) {
+  804d20:	55                   	push   %rbp
+  804d21:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d24:	48 b8 6c 4c 80 00 00 	movabs $0x804c6c,%rax
+  804d2b:	00 00 00 
+  804d2e:	ff d0                	call   *%rax
+  804d30:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804d33:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804d38:	89 c1                	mov    %eax,%ecx
+  804d3a:	83 c9 04             	or     $0x4,%ecx
+  804d3d:	f6 c2 01             	test   $0x1,%dl
+  804d40:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804d43:	89 c1                	mov    %eax,%ecx
+  804d45:	83 c9 02             	or     $0x2,%ecx
+  804d48:	f6 c2 02             	test   $0x2,%dl
+  804d4b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804d4e:	89 c1                	mov    %eax,%ecx
+  804d50:	83 c9 01             	or     $0x1,%ecx
+  804d53:	48 85 d2             	test   %rdx,%rdx
+  804d56:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804d59:	89 c1                	mov    %eax,%ecx
+  804d5b:	83 c9 40             	or     $0x40,%ecx
+  804d5e:	f6 c6 04             	test   $0x4,%dh
+  804d61:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804d64:	5d                   	pop    %rbp
+  804d65:	c3                   	ret
+
+0000000000804d66 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804d66:	55                   	push   %rbp
+  804d67:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804d6a:	48 b8 6c 4c 80 00 00 	movabs $0x804c6c,%rax
+  804d71:	00 00 00 
+  804d74:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804d76:	48 c1 e8 06          	shr    $0x6,%rax
+  804d7a:	83 e0 01             	and    $0x1,%eax
+}
+  804d7d:	5d                   	pop    %rbp
+  804d7e:	c3                   	ret
+
+0000000000804d7f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804d7f:	55                   	push   %rbp
+  804d80:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804d83:	48 b8 6c 4c 80 00 00 	movabs $0x804c6c,%rax
+  804d8a:	00 00 00 
+  804d8d:	ff d0                	call   *%rax
+  804d8f:	83 e0 01             	and    $0x1,%eax
+}
+  804d92:	5d                   	pop    %rbp
+  804d93:	c3                   	ret
+
+0000000000804d94 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804d94:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804d9b:	01 00 00 
+  804d9e:	a8 01                	test   $0x1,%al
+  804da0:	75 06                	jne    804da8 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804da2:	b8 00 00 00 00       	mov    $0x0,%eax
+  804da7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804da8:	55                   	push   %rbp
+  804da9:	48 89 e5             	mov    %rsp,%rbp
+  804dac:	41 57                	push   %r15
+  804dae:	41 56                	push   %r14
+  804db0:	41 55                	push   %r13
+  804db2:	41 54                	push   %r12
+  804db4:	53                   	push   %rbx
+  804db5:	48 83 ec 28          	sub    $0x28,%rsp
+  804db9:	49 89 fe             	mov    %rdi,%r14
+  804dbc:	49 89 f7             	mov    %rsi,%r15
+  804dbf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804dc6:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804dc7:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804dce:	01 00 00 
+  804dd1:	e9 ae 00 00 00       	jmp    804e84 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804dd6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804ddd:	49 83 ec 01          	sub    $0x1,%r12
+  804de1:	74 2d                	je     804e10 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804de3:	48 89 d8             	mov    %rbx,%rax
+  804de6:	48 c1 e8 0c          	shr    $0xc,%rax
+  804dea:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804def:	f6 c2 01             	test   $0x1,%dl
+  804df2:	74 e2                	je     804dd6 <foreach_shared_region+0x42>
+  804df4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804df9:	f6 c4 04             	test   $0x4,%ah
+  804dfc:	74 d8                	je     804dd6 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804dfe:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804e05:	4c 89 fa             	mov    %r15,%rdx
+  804e08:	48 89 df             	mov    %rbx,%rdi
+  804e0b:	41 ff d6             	call   *%r14
+  804e0e:	eb c6                	jmp    804dd6 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804e10:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804e17:	00 
+  804e18:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804e1d:	74 4a                	je     804e69 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804e1f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804e23:	48 c1 e8 15          	shr    $0x15,%rax
+  804e27:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804e2e:	01 00 00 
+  804e31:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e35:	a8 01                	test   $0x1,%al
+  804e37:	74 d7                	je     804e10 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804e39:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804e3d:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804e44:	48 39 c3             	cmp    %rax,%rbx
+  804e47:	73 c7                	jae    804e10 <foreach_shared_region+0x7c>
+  804e49:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804e50:	48 39 d0             	cmp    %rdx,%rax
+  804e53:	4d 19 e4             	sbb    %r12,%r12
+  804e56:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804e5d:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804e64:	e9 7a ff ff ff       	jmp    804de3 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804e69:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804e70:	40 
+  804e71:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804e75:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804e7c:	00 00 00 
+  804e7f:	48 39 c1             	cmp    %rax,%rcx
+  804e82:	74 50                	je     804ed4 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804e84:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804e88:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804e8c:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804e93:	01 00 00 
+  804e96:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804e9a:	a8 01                	test   $0x1,%al
+  804e9c:	74 cb                	je     804e69 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804e9e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804ea2:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804ea9:	48 39 c1             	cmp    %rax,%rcx
+  804eac:	73 bb                	jae    804e69 <foreach_shared_region+0xd5>
+  804eae:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804eb5:	48 39 d0             	cmp    %rdx,%rax
+  804eb8:	48 19 c0             	sbb    %rax,%rax
+  804ebb:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804ec1:	48 05 00 02 00 00    	add    $0x200,%rax
+  804ec7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804ecb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804ecf:	e9 4b ff ff ff       	jmp    804e1f <foreach_shared_region+0x8b>
+  804ed4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ed9:	48 83 c4 28          	add    $0x28,%rsp
+  804edd:	5b                   	pop    %rbx
+  804ede:	41 5c                	pop    %r12
+  804ee0:	41 5d                	pop    %r13
+  804ee2:	41 5e                	pop    %r14
+  804ee4:	41 5f                	pop    %r15
+  804ee6:	5d                   	pop    %rbp
+  804ee7:	c3                   	ret
+
+0000000000804ee8 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  804ee8:	55                   	push   %rbp
+  804ee9:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  804eec:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  804ef3:	00 00 00 
+  804ef6:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  804efd:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  804f04:	00 00 00 
+  804f07:	48 39 c2             	cmp    %rax,%rdx
+  804f0a:	74 13                	je     804f1f <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  804f0c:	48 89 c7             	mov    %rax,%rdi
+  804f0f:	48 b8 5c 1a 80 00 00 	movabs $0x801a5c,%rax
+  804f16:	00 00 00 
+  804f19:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  804f1b:	85 c0                	test   %eax,%eax
+  804f1d:	78 0c                	js     804f2b <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  804f1f:	48 b8 bc 1a 80 00 00 	movabs $0x801abc,%rax
+  804f26:	00 00 00 
+  804f29:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  804f2b:	48 ba 40 10 85 00 00 	movabs $0x851040,%rdx
+  804f32:	00 00 00 
+  804f35:	8b 0a                	mov    (%rdx),%ecx
+  804f37:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  804f3a:	5d                   	pop    %rbp
+  804f3b:	c3                   	ret
+
+0000000000804f3c <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  804f3c:	55                   	push   %rbp
+  804f3d:	48 89 e5             	mov    %rsp,%rbp
+  804f40:	41 57                	push   %r15
+  804f42:	41 56                	push   %r14
+  804f44:	41 55                	push   %r13
+  804f46:	41 54                	push   %r12
+  804f48:	53                   	push   %rbx
+  804f49:	48 83 ec 18          	sub    $0x18,%rsp
+  804f4d:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  804f51:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  804f58:	00 00 00 
+  804f5b:	83 38 00             	cmpl   $0x0,(%rax)
+  804f5e:	75 69                	jne    804fc9 <scring_push+0x8d>
+  804f60:	49 89 ff             	mov    %rdi,%r15
+  804f63:	49 89 f6             	mov    %rsi,%r14
+  804f66:	49 89 d5             	mov    %rdx,%r13
+  804f69:	49 89 cc             	mov    %rcx,%r12
+  804f6c:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804f6f:	48 ba 40 10 85 00 00 	movabs $0x851040,%rdx
+  804f76:	00 00 00 
+  804f79:	8b 42 04             	mov    0x4(%rdx),%eax
+  804f7c:	8b 12                	mov    (%rdx),%edx
+  804f7e:	29 d0                	sub    %edx,%eax
+  804f80:	83 f8 20             	cmp    $0x20,%eax
+  804f83:	74 53                	je     804fd8 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  804f85:	48 ba 40 10 85 00 00 	movabs $0x851040,%rdx
+  804f8c:	00 00 00 
+  804f8f:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  804f92:	83 e0 1f             	and    $0x1f,%eax
+  804f95:	48 c1 e0 06          	shl    $0x6,%rax
+  804f99:	48 01 d0             	add    %rdx,%rax
+  804f9c:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  804fa0:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  804fa4:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  804fa8:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  804fac:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  804fb0:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804fb4:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  804fb8:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  804fbc:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  804fc0:	8b 42 04             	mov    0x4(%rdx),%eax
+  804fc3:	83 c0 01             	add    $0x1,%eax
+  804fc6:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  804fc9:	48 83 c4 18          	add    $0x18,%rsp
+  804fcd:	5b                   	pop    %rbx
+  804fce:	41 5c                	pop    %r12
+  804fd0:	41 5d                	pop    %r13
+  804fd2:	41 5e                	pop    %r14
+  804fd4:	41 5f                	pop    %r15
+  804fd6:	5d                   	pop    %rbp
+  804fd7:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  804fd8:	48 b8 e8 4e 80 00 00 	movabs $0x804ee8,%rax
+  804fdf:	00 00 00 
+  804fe2:	ff d0                	call   *%rax
+  804fe4:	a3 00 10 85 00 00 00 	movabs %eax,0x851000
+  804feb:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  804fed:	85 c0                	test   %eax,%eax
+  804fef:	79 94                	jns    804f85 <scring_push+0x49>
+  804ff1:	eb d6                	jmp    804fc9 <scring_push+0x8d>
+
+0000000000804ff3 <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  804ff3:	48 ba 00 10 85 00 00 	movabs $0x851000,%rdx
+  804ffa:	00 00 00 
+  804ffd:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  804fff:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  805005:	85 c0                	test   %eax,%eax
+  805007:	78 14                	js     80501d <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  805009:	48 ba 40 10 85 00 00 	movabs $0x851040,%rdx
+  805010:	00 00 00 
+  805013:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  805016:	8b 12                	mov    (%rdx),%edx
+  805018:	39 d1                	cmp    %edx,%ecx
+  80501a:	75 11                	jne    80502d <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  80501c:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  80501d:	48 ba 40 10 85 00 00 	movabs $0x851040,%rdx
+  805024:	00 00 00 
+  805027:	8b 0a                	mov    (%rdx),%ecx
+  805029:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  80502c:	c3                   	ret
+scring_submit(void) {
+  80502d:	55                   	push   %rbp
+  80502e:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  805031:	48 b8 e8 4e 80 00 00 	movabs $0x804ee8,%rax
+  805038:	00 00 00 
+  80503b:	ff d0                	call   *%rax
+}
+  80503d:	5d                   	pop    %rbp
+  80503e:	c3                   	ret
+
+000000000080503f <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  80503f:	48 b8 00 10 85 00 00 	movabs $0x851000,%rax
+  805046:	00 00 00 
+  805049:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  80504f:	48 b8 40 10 85 00 00 	movabs $0x851040,%rax
+  805056:	00 00 00 
+  805059:	8b 10                	mov    (%rax),%edx
+  80505b:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  80505e:	c3                   	ret
+
+000000000080505f <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80505f:	55                   	push   %rbp
+  805060:	48 89 e5             	mov    %rsp,%rbp
+  805063:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  805066:	48 63 f7             	movslq %edi,%rsi
+  805069:	48 83 ec 08          	sub    $0x8,%rsp
+  80506d:	6a 00                	push   $0x0
+  80506f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805075:	4c 63 c1             	movslq %ecx,%r8
+  805078:	48 89 d1             	mov    %rdx,%rcx
+  80507b:	48 89 c2             	mov    %rax,%rdx
+  80507e:	bf 04 00 00 00       	mov    $0x4,%edi
+  805083:	48 b8 3c 4f 80 00 00 	movabs $0x804f3c,%rax
+  80508a:	00 00 00 
+  80508d:	ff d0                	call   *%rax
+}
+  80508f:	48 83 c4 10          	add    $0x10,%rsp
+  805093:	c9                   	leave
+  805094:	c3                   	ret
+
+0000000000805095 <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  805095:	55                   	push   %rbp
+  805096:	48 89 e5             	mov    %rsp,%rbp
+  805099:	48 89 f0             	mov    %rsi,%rax
+  80509c:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80509f:	48 63 ca             	movslq %edx,%rcx
+  8050a2:	48 63 f7             	movslq %edi,%rsi
+  8050a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8050a9:	4d 63 c9             	movslq %r9d,%r9
+  8050ac:	41 51                	push   %r9
+  8050ae:	4d 89 c1             	mov    %r8,%r9
+  8050b1:	4d 89 d0             	mov    %r10,%r8
+  8050b4:	48 89 c2             	mov    %rax,%rdx
+  8050b7:	bf 05 00 00 00       	mov    $0x5,%edi
+  8050bc:	48 b8 3c 4f 80 00 00 	movabs $0x804f3c,%rax
+  8050c3:	00 00 00 
+  8050c6:	ff d0                	call   *%rax
+}
+  8050c8:	48 83 c4 10          	add    $0x10,%rsp
+  8050cc:	c9                   	leave
+  8050cd:	c3                   	ret
+
+00000000008050ce <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  8050ce:	55                   	push   %rbp
+  8050cf:	48 89 e5             	mov    %rsp,%rbp
+  8050d2:	48 89 f0             	mov    %rsi,%rax
+  8050d5:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  8050d8:	48 63 f7             	movslq %edi,%rsi
+  8050db:	48 83 ec 08          	sub    $0x8,%rsp
+  8050df:	6a 00                	push   $0x0
+  8050e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8050e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8050ed:	48 89 c2             	mov    %rax,%rdx
+  8050f0:	bf 06 00 00 00       	mov    $0x6,%edi
+  8050f5:	48 b8 3c 4f 80 00 00 	movabs $0x804f3c,%rax
+  8050fc:	00 00 00 
+  8050ff:	ff d0                	call   *%rax
+}
+  805101:	48 83 c4 10          	add    $0x10,%rsp
+  805105:	c9                   	leave
+  805106:	c3                   	ret
+
+0000000000805107 <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  805107:	55                   	push   %rbp
+  805108:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  80510b:	48 63 d6             	movslq %esi,%rdx
+  80510e:	48 63 f7             	movslq %edi,%rsi
+  805111:	48 83 ec 08          	sub    $0x8,%rsp
+  805115:	6a 00                	push   $0x0
+  805117:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80511d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805123:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805128:	bf 09 00 00 00       	mov    $0x9,%edi
+  80512d:	48 b8 3c 4f 80 00 00 	movabs $0x804f3c,%rax
+  805134:	00 00 00 
+  805137:	ff d0                	call   *%rax
+}
+  805139:	48 83 c4 10          	add    $0x10,%rsp
+  80513d:	c9                   	leave
+  80513e:	c3                   	ret
+
+000000000080513f <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80513f:	55                   	push   %rbp
+  805140:	48 89 e5             	mov    %rsp,%rbp
+  805143:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  805146:	48 63 f7             	movslq %edi,%rsi
+  805149:	48 83 ec 08          	sub    $0x8,%rsp
+  80514d:	6a 00                	push   $0x0
+  80514f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805155:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80515b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805160:	bf 0a 00 00 00       	mov    $0xa,%edi
+  805165:	48 b8 3c 4f 80 00 00 	movabs $0x804f3c,%rax
+  80516c:	00 00 00 
+  80516f:	ff d0                	call   *%rax
+}
+  805171:	48 83 c4 10          	add    $0x10,%rsp
+  805175:	c9                   	leave
+  805176:	c3                   	ret
+
+0000000000805177 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  805177:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80517d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  805184:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80518b:	c3                   	ret
+
+000000000080518c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80518c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80518f:	8b 17                	mov    (%rdi),%edx
+  805191:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805193:	83 f8 0f             	cmp    $0xf,%eax
+  805196:	77 13                	ja     8051ab <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  805198:	8b 47 40             	mov    0x40(%rdi),%eax
+  80519b:	83 e0 0f             	and    $0xf,%eax
+  80519e:	48 c1 e0 09          	shl    $0x9,%rax
+  8051a2:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8051a9:	00 
+  8051aa:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8051ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8051b0:	c3                   	ret
+
+00000000008051b1 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8051b1:	8b 47 40             	mov    0x40(%rdi),%eax
+  8051b4:	83 c0 01             	add    $0x1,%eax
+  8051b7:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8051ba:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8051c0:	8b 57 04             	mov    0x4(%rdi),%edx
+  8051c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8051c8:	85 d2                	test   %edx,%edx
+  8051ca:	75 04                	jne    8051d0 <chan_publish+0x1f>
+  8051cc:	83 e0 01             	and    $0x1,%eax
+}
+  8051cf:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8051d0:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8051d3:	85 c0                	test   %eax,%eax
+  8051d5:	0f 95 c0             	setne  %al
+  8051d8:	0f b6 c0             	movzbl %al,%eax
+  8051db:	eb ef                	jmp    8051cc <chan_publish+0x1b>
+
+00000000008051dd <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8051dd:	8b 47 40             	mov    0x40(%rdi),%eax
+  8051e0:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8051e2:	29 d0                	sub    %edx,%eax
+  8051e4:	83 e8 01             	sub    $0x1,%eax
+  8051e7:	83 f8 0f             	cmp    $0xf,%eax
+  8051ea:	77 12                	ja     8051fe <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8051ec:	8b 07                	mov    (%rdi),%eax
+  8051ee:	83 e0 0f             	and    $0xf,%eax
+  8051f1:	48 c1 e0 09          	shl    $0x9,%rax
+  8051f5:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8051fc:	00 
+  8051fd:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8051fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805203:	c3                   	ret
+
+0000000000805204 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  805204:	8b 07                	mov    (%rdi),%eax
+  805206:	83 c0 01             	add    $0x1,%eax
+  805209:	89 07                	mov    %eax,(%rdi)
+}
+  80520b:	c3                   	ret
+
+000000000080520c <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80520c:	55                   	push   %rbp
+  80520d:	48 89 e5             	mov    %rsp,%rbp
+  805210:	53                   	push   %rbx
+  805211:	48 83 ec 08          	sub    $0x8,%rsp
+  805215:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  805218:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80521f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  805225:	48 b8 dd 51 80 00 00 	movabs $0x8051dd,%rax
+  80522c:	00 00 00 
+  80522f:	ff d0                	call   *%rax
+  805231:	48 85 c0             	test   %rax,%rax
+  805234:	74 12                	je     805248 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  805236:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80523d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805242:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805246:	c9                   	leave
+  805247:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  805248:	b8 01 00 00 00       	mov    $0x1,%eax
+  80524d:	eb f3                	jmp    805242 <chan_arm+0x36>
+
+000000000080524f <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80524f:	55                   	push   %rbp
+  805250:	48 89 e5             	mov    %rsp,%rbp
+  805253:	41 56                	push   %r14
+  805255:	41 55                	push   %r13
+  805257:	41 54                	push   %r12
+  805259:	53                   	push   %rbx
+  80525a:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80525d:	49 bc 0c 52 80 00 00 	movabs $0x80520c,%r12
+  805264:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805267:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80526b:	49 bd e5 1a 80 00 00 	movabs $0x801ae5,%r13
+  805272:	00 00 00 
+    while (chan_arm(r))
+  805275:	eb 0d                	jmp    805284 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805277:	8b 33                	mov    (%rbx),%esi
+  805279:	ba 00 00 00 00       	mov    $0x0,%edx
+  80527e:	4c 89 f7             	mov    %r14,%rdi
+  805281:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  805284:	48 89 df             	mov    %rbx,%rdi
+  805287:	41 ff d4             	call   *%r12
+  80528a:	84 c0                	test   %al,%al
+  80528c:	75 e9                	jne    805277 <chan_wait+0x28>
+}
+  80528e:	5b                   	pop    %rbx
+  80528f:	41 5c                	pop    %r12
+  805291:	41 5d                	pop    %r13
+  805293:	41 5e                	pop    %r14
+  805295:	5d                   	pop    %rbp
+  805296:	c3                   	ret
+
+0000000000805297 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  805297:	55                   	push   %rbp
+  805298:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80529b:	48 83 c7 40          	add    $0x40,%rdi
+  80529f:	be 01 00 00 00       	mov    $0x1,%esi
+  8052a4:	48 b8 03 1b 80 00 00 	movabs $0x801b03,%rax
+  8052ab:	00 00 00 
+  8052ae:	ff d0                	call   *%rax
+}
+  8052b0:	5d                   	pop    %rbp
+  8052b1:	c3                   	ret
+
+00000000008052b2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8052b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052b7:	c3                   	ret
+
+00000000008052b8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8052b8:	55                   	push   %rbp
+  8052b9:	48 89 e5             	mov    %rsp,%rbp
+  8052bc:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8052bf:	48 be e2 62 80 00 00 	movabs $0x8062e2,%rsi
+  8052c6:	00 00 00 
+  8052c9:	48 b8 18 12 80 00 00 	movabs $0x801218,%rax
+  8052d0:	00 00 00 
+  8052d3:	ff d0                	call   *%rax
+    return 0;
+}
+  8052d5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8052da:	5d                   	pop    %rbp
+  8052db:	c3                   	ret
+
+00000000008052dc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8052dc:	55                   	push   %rbp
+  8052dd:	48 89 e5             	mov    %rsp,%rbp
+  8052e0:	41 57                	push   %r15
+  8052e2:	41 56                	push   %r14
+  8052e4:	41 55                	push   %r13
+  8052e6:	41 54                	push   %r12
+  8052e8:	53                   	push   %rbx
+  8052e9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8052f0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8052f7:	48 85 d2             	test   %rdx,%rdx
+  8052fa:	74 7a                	je     805376 <devcons_write+0x9a>
+  8052fc:	49 89 d6             	mov    %rdx,%r14
+  8052ff:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  805305:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80530a:	49 bf 12 14 80 00 00 	movabs $0x801412,%r15
+  805311:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  805314:	4c 89 f3             	mov    %r14,%rbx
+  805317:	48 29 f3             	sub    %rsi,%rbx
+  80531a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80531f:	48 39 c3             	cmp    %rax,%rbx
+  805322:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  805326:	4c 63 eb             	movslq %ebx,%r13
+  805329:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  805330:	48 01 c6             	add    %rax,%rsi
+  805333:	4c 89 ea             	mov    %r13,%rdx
+  805336:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80533d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  805340:	4c 89 ee             	mov    %r13,%rsi
+  805343:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80534a:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  805351:	00 00 00 
+  805354:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  805356:	41 01 dc             	add    %ebx,%r12d
+  805359:	49 63 f4             	movslq %r12d,%rsi
+  80535c:	4c 39 f6             	cmp    %r14,%rsi
+  80535f:	72 b3                	jb     805314 <devcons_write+0x38>
+    return res;
+  805361:	49 63 c4             	movslq %r12d,%rax
+}
+  805364:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80536b:	5b                   	pop    %rbx
+  80536c:	41 5c                	pop    %r12
+  80536e:	41 5d                	pop    %r13
+  805370:	41 5e                	pop    %r14
+  805372:	41 5f                	pop    %r15
+  805374:	5d                   	pop    %rbp
+  805375:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  805376:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80537c:	eb e3                	jmp    805361 <devcons_write+0x85>
+
+000000000080537e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80537e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  805381:	ba 00 00 00 00       	mov    $0x0,%edx
+  805386:	48 85 c0             	test   %rax,%rax
+  805389:	74 55                	je     8053e0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80538b:	55                   	push   %rbp
+  80538c:	48 89 e5             	mov    %rsp,%rbp
+  80538f:	41 55                	push   %r13
+  805391:	41 54                	push   %r12
+  805393:	53                   	push   %rbx
+  805394:	48 83 ec 08          	sub    $0x8,%rsp
+  805398:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80539b:	48 bb 5e 16 80 00 00 	movabs $0x80165e,%rbx
+  8053a2:	00 00 00 
+  8053a5:	49 bc 13 17 80 00 00 	movabs $0x801713,%r12
+  8053ac:	00 00 00 
+  8053af:	eb 03                	jmp    8053b4 <devcons_read+0x36>
+  8053b1:	41 ff d4             	call   *%r12
+  8053b4:	ff d3                	call   *%rbx
+  8053b6:	85 c0                	test   %eax,%eax
+  8053b8:	74 f7                	je     8053b1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8053ba:	48 63 d0             	movslq %eax,%rdx
+  8053bd:	78 13                	js     8053d2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8053bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8053c4:	83 f8 04             	cmp    $0x4,%eax
+  8053c7:	74 09                	je     8053d2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8053c9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8053cd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8053d2:	48 89 d0             	mov    %rdx,%rax
+  8053d5:	48 83 c4 08          	add    $0x8,%rsp
+  8053d9:	5b                   	pop    %rbx
+  8053da:	41 5c                	pop    %r12
+  8053dc:	41 5d                	pop    %r13
+  8053de:	5d                   	pop    %rbp
+  8053df:	c3                   	ret
+  8053e0:	48 89 d0             	mov    %rdx,%rax
+  8053e3:	c3                   	ret
+
+00000000008053e4 <cputchar>:
+cputchar(int ch) {
+  8053e4:	55                   	push   %rbp
+  8053e5:	48 89 e5             	mov    %rsp,%rbp
+  8053e8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8053ec:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8053f0:	be 01 00 00 00       	mov    $0x1,%esi
+  8053f5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8053f9:	48 b8 3f 16 80 00 00 	movabs $0x80163f,%rax
+  805400:	00 00 00 
+  805403:	ff d0                	call   *%rax
+}
+  805405:	c9                   	leave
+  805406:	c3                   	ret
+
+0000000000805407 <getchar>:
+getchar(void) {
+  805407:	55                   	push   %rbp
+  805408:	48 89 e5             	mov    %rsp,%rbp
+  80540b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80540f:	ba 01 00 00 00       	mov    $0x1,%edx
+  805414:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  805418:	bf 00 00 00 00       	mov    $0x0,%edi
+  80541d:	48 b8 1b 1f 80 00 00 	movabs $0x801f1b,%rax
+  805424:	00 00 00 
+  805427:	ff d0                	call   *%rax
+  805429:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80542b:	85 c0                	test   %eax,%eax
+  80542d:	78 06                	js     805435 <getchar+0x2e>
+  80542f:	74 08                	je     805439 <getchar+0x32>
+  805431:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  805435:	89 d0                	mov    %edx,%eax
+  805437:	c9                   	leave
+  805438:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  805439:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80543e:	eb f5                	jmp    805435 <getchar+0x2e>
+
+0000000000805440 <iscons>:
+iscons(int fdnum) {
+  805440:	55                   	push   %rbp
+  805441:	48 89 e5             	mov    %rsp,%rbp
+  805444:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  805448:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80544c:	48 b8 38 1c 80 00 00 	movabs $0x801c38,%rax
+  805453:	00 00 00 
+  805456:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  805458:	85 c0                	test   %eax,%eax
+  80545a:	78 18                	js     805474 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80545c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  805460:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  805467:	00 00 00 
+  80546a:	8b 00                	mov    (%rax),%eax
+  80546c:	39 02                	cmp    %eax,(%rdx)
+  80546e:	0f 94 c0             	sete   %al
+  805471:	0f b6 c0             	movzbl %al,%eax
+}
+  805474:	c9                   	leave
+  805475:	c3                   	ret
+
+0000000000805476 <opencons>:
+opencons(void) {
+  805476:	55                   	push   %rbp
+  805477:	48 89 e5             	mov    %rsp,%rbp
+  80547a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80547e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  805482:	48 b8 d8 1b 80 00 00 	movabs $0x801bd8,%rax
+  805489:	00 00 00 
+  80548c:	ff d0                	call   *%rax
+  80548e:	85 c0                	test   %eax,%eax
+  805490:	78 49                	js     8054db <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  805492:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805497:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80549c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8054a0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8054a5:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  8054ac:	00 00 00 
+  8054af:	ff d0                	call   *%rax
+  8054b1:	85 c0                	test   %eax,%eax
+  8054b3:	78 26                	js     8054db <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8054b5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8054b9:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  8054c0:	00 00 
+  8054c2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8054c4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8054c8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8054cf:	48 b8 aa 1b 80 00 00 	movabs $0x801baa,%rax
+  8054d6:	00 00 00 
+  8054d9:	ff d0                	call   *%rax
+}
+  8054db:	c9                   	leave
+  8054dc:	c3                   	ret
+
+00000000008054dd <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8054dd:	55                   	push   %rbp
+  8054de:	48 89 e5             	mov    %rsp,%rbp
+  8054e1:	41 56                	push   %r14
+  8054e3:	41 55                	push   %r13
+  8054e5:	41 54                	push   %r12
+  8054e7:	53                   	push   %rbx
+  8054e8:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8054eb:	48 b8 a8 18 85 00 00 	movabs $0x8518a8,%rax
+  8054f2:	00 00 00 
+  8054f5:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8054f9:	74 27                	je     805522 <_handle_vectored_pagefault+0x45>
+  8054fb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805500:	49 bd 60 18 85 00 00 	movabs $0x851860,%r13
+  805507:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80550a:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80550d:	4c 89 e7             	mov    %r12,%rdi
+  805510:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805515:	84 c0                	test   %al,%al
+  805517:	75 45                	jne    80555e <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805519:	48 83 c3 01          	add    $0x1,%rbx
+  80551d:	49 3b 1e             	cmp    (%r14),%rbx
+  805520:	72 eb                	jb     80550d <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805522:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805529:	00 
+  80552a:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80552f:	4d 8b 04 24          	mov    (%r12),%r8
+  805533:	48 ba f0 62 80 00 00 	movabs $0x8062f0,%rdx
+  80553a:	00 00 00 
+  80553d:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805542:	48 bf 20 63 80 00 00 	movabs $0x806320,%rdi
+  805549:	00 00 00 
+  80554c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805551:	49 ba a3 07 80 00 00 	movabs $0x8007a3,%r10
+  805558:	00 00 00 
+  80555b:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  80555e:	5b                   	pop    %rbx
+  80555f:	41 5c                	pop    %r12
+  805561:	41 5d                	pop    %r13
+  805563:	41 5e                	pop    %r14
+  805565:	5d                   	pop    %rbp
+  805566:	c3                   	ret
+
+0000000000805567 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805567:	55                   	push   %rbp
+  805568:	48 89 e5             	mov    %rsp,%rbp
+  80556b:	53                   	push   %rbx
+  80556c:	48 83 ec 08          	sub    $0x8,%rsp
+  805570:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  805573:	48 b8 a0 18 85 00 00 	movabs $0x8518a0,%rax
+  80557a:	00 00 00 
+  80557d:	80 38 00             	cmpb   $0x0,(%rax)
+  805580:	0f 84 84 00 00 00    	je     80560a <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805586:	48 b8 a8 18 85 00 00 	movabs $0x8518a8,%rax
+  80558d:	00 00 00 
+  805590:	48 8b 10             	mov    (%rax),%rdx
+  805593:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  805598:	48 b9 60 18 85 00 00 	movabs $0x851860,%rcx
+  80559f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8055a2:	48 85 d2             	test   %rdx,%rdx
+  8055a5:	74 19                	je     8055c0 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8055a7:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8055ab:	0f 84 e8 00 00 00    	je     805699 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8055b1:	48 83 c0 01          	add    $0x1,%rax
+  8055b5:	48 39 d0             	cmp    %rdx,%rax
+  8055b8:	75 ed                	jne    8055a7 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8055ba:	48 83 fa 08          	cmp    $0x8,%rdx
+  8055be:	74 1c                	je     8055dc <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8055c0:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8055c4:	48 a3 a8 18 85 00 00 	movabs %rax,0x8518a8
+  8055cb:	00 00 00 
+  8055ce:	48 b8 60 18 85 00 00 	movabs $0x851860,%rax
+  8055d5:	00 00 00 
+  8055d8:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8055dc:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  8055e3:	00 00 00 
+  8055e6:	ff d0                	call   *%rax
+  8055e8:	89 c7                	mov    %eax,%edi
+  8055ea:	48 be 5f 57 80 00 00 	movabs $0x80575f,%rsi
+  8055f1:	00 00 00 
+  8055f4:	48 b8 35 19 80 00 00 	movabs $0x801935,%rax
+  8055fb:	00 00 00 
+  8055fe:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  805600:	85 c0                	test   %eax,%eax
+  805602:	78 68                	js     80566c <add_pgfault_handler+0x105>
+    return res;
+}
+  805604:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805608:	c9                   	leave
+  805609:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80560a:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  805611:	00 00 00 
+  805614:	ff d0                	call   *%rax
+  805616:	89 c7                	mov    %eax,%edi
+  805618:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80561d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805622:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  805629:	00 00 00 
+  80562c:	48 b8 77 17 80 00 00 	movabs $0x801777,%rax
+  805633:	00 00 00 
+  805636:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  805638:	48 ba a8 18 85 00 00 	movabs $0x8518a8,%rdx
+  80563f:	00 00 00 
+  805642:	48 8b 02             	mov    (%rdx),%rax
+  805645:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  805649:	48 89 0a             	mov    %rcx,(%rdx)
+  80564c:	48 ba 60 18 85 00 00 	movabs $0x851860,%rdx
+  805653:	00 00 00 
+  805656:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80565a:	48 b8 a0 18 85 00 00 	movabs $0x8518a0,%rax
+  805661:	00 00 00 
+  805664:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  805667:	e9 70 ff ff ff       	jmp    8055dc <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80566c:	89 c1                	mov    %eax,%ecx
+  80566e:	48 ba 2e 63 80 00 00 	movabs $0x80632e,%rdx
+  805675:	00 00 00 
+  805678:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80567d:	48 bf 20 63 80 00 00 	movabs $0x806320,%rdi
+  805684:	00 00 00 
+  805687:	b8 00 00 00 00       	mov    $0x0,%eax
+  80568c:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  805693:	00 00 00 
+  805696:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  805699:	b8 00 00 00 00       	mov    $0x0,%eax
+  80569e:	e9 61 ff ff ff       	jmp    805604 <add_pgfault_handler+0x9d>
+
+00000000008056a3 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8056a3:	55                   	push   %rbp
+  8056a4:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8056a7:	48 b8 a0 18 85 00 00 	movabs $0x8518a0,%rax
+  8056ae:	00 00 00 
+  8056b1:	80 38 00             	cmpb   $0x0,(%rax)
+  8056b4:	74 33                	je     8056e9 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056b6:	48 a1 a8 18 85 00 00 	movabs 0x8518a8,%rax
+  8056bd:	00 00 00 
+  8056c0:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8056c5:	48 ba 60 18 85 00 00 	movabs $0x851860,%rdx
+  8056cc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056cf:	48 85 c0             	test   %rax,%rax
+  8056d2:	0f 84 85 00 00 00    	je     80575d <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8056d8:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8056dc:	74 40                	je     80571e <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8056de:	48 83 c1 01          	add    $0x1,%rcx
+  8056e2:	48 39 c1             	cmp    %rax,%rcx
+  8056e5:	75 f1                	jne    8056d8 <remove_pgfault_handler+0x35>
+  8056e7:	eb 74                	jmp    80575d <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8056e9:	48 b9 46 63 80 00 00 	movabs $0x806346,%rcx
+  8056f0:	00 00 00 
+  8056f3:	48 ba 51 62 80 00 00 	movabs $0x806251,%rdx
+  8056fa:	00 00 00 
+  8056fd:	be 43 00 00 00       	mov    $0x43,%esi
+  805702:	48 bf 20 63 80 00 00 	movabs $0x806320,%rdi
+  805709:	00 00 00 
+  80570c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805711:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  805718:	00 00 00 
+  80571b:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80571e:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  805725:	00 
+  805726:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80572a:	48 29 ca             	sub    %rcx,%rdx
+  80572d:	48 b8 60 18 85 00 00 	movabs $0x851860,%rax
+  805734:	00 00 00 
+  805737:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80573b:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  805740:	48 89 ce             	mov    %rcx,%rsi
+  805743:	48 b8 12 14 80 00 00 	movabs $0x801412,%rax
+  80574a:	00 00 00 
+  80574d:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80574f:	48 b8 a8 18 85 00 00 	movabs $0x8518a8,%rax
+  805756:	00 00 00 
+  805759:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80575d:	5d                   	pop    %rbp
+  80575e:	c3                   	ret
+
+000000000080575f <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80575f:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  805762:	48 b8 dd 54 80 00 00 	movabs $0x8054dd,%rax
+  805769:	00 00 00 
+    call *%rax
+  80576c:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  80576e:	41 5f                	pop    %r15
+	popq %r15
+  805770:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  805772:	41 5f                	pop    %r15
+	popq %r14
+  805774:	41 5e                	pop    %r14
+	popq %r13
+  805776:	41 5d                	pop    %r13
+	popq %r12
+  805778:	41 5c                	pop    %r12
+	popq %r11
+  80577a:	41 5b                	pop    %r11
+	popq %r10
+  80577c:	41 5a                	pop    %r10
+	popq %r9
+  80577e:	41 59                	pop    %r9
+	popq %r8
+  805780:	41 58                	pop    %r8
+	popq %rsi
+  805782:	5e                   	pop    %rsi
+	popq %rdi
+  805783:	5f                   	pop    %rdi
+	popq %rbp
+  805784:	5d                   	pop    %rbp
+	popq %rdx
+  805785:	5a                   	pop    %rdx
+	popq %rcx
+  805786:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  805787:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80578c:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  805791:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  805795:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  805798:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80579d:	5b                   	pop    %rbx
+	popq %rax
+  80579e:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80579f:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8057a3:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8057a4:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8057a9:	c3                   	ret
+
+00000000008057aa <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8057aa:	55                   	push   %rbp
+  8057ab:	48 89 e5             	mov    %rsp,%rbp
+  8057ae:	41 55                	push   %r13
+  8057b0:	41 54                	push   %r12
+  8057b2:	53                   	push   %rbx
+  8057b3:	48 83 ec 08          	sub    $0x8,%rsp
+  8057b7:	49 89 fd             	mov    %rdi,%r13
+  8057ba:	48 89 f7             	mov    %rsi,%rdi
+  8057bd:	48 89 d3             	mov    %rdx,%rbx
+  8057c0:	49 89 cc             	mov    %rcx,%r12
+  8057c3:	4c 89 c2             	mov    %r8,%rdx
+  8057c6:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8057c9:	48 85 f6             	test   %rsi,%rsi
+  8057cc:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8057d3:	00 00 00 
+  8057d6:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8057da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8057df:	48 85 db             	test   %rbx,%rbx
+  8057e2:	74 03                	je     8057e7 <ipc_recv_futex+0x3d>
+  8057e4:	48 8b 33             	mov    (%rbx),%rsi
+  8057e7:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8057eb:	48 b8 c1 19 80 00 00 	movabs $0x8019c1,%rax
+  8057f2:	00 00 00 
+  8057f5:	ff d0                	call   *%rax
+    if (res < 0) {
+  8057f7:	85 c0                	test   %eax,%eax
+  8057f9:	78 75                	js     805870 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8057fb:	4d 85 ed             	test   %r13,%r13
+  8057fe:	74 14                	je     805814 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  805800:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  805807:	00 00 00 
+  80580a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  805810:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  805814:	4d 85 e4             	test   %r12,%r12
+  805817:	74 14                	je     80582d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  805819:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  805820:	00 00 00 
+  805823:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  805829:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80582d:	48 85 db             	test   %rbx,%rbx
+  805830:	74 23                	je     805855 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  805832:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  805839:	00 00 00 
+  80583c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  805842:	ba 00 00 00 00       	mov    $0x0,%edx
+  805847:	85 c9                	test   %ecx,%ecx
+  805849:	74 07                	je     805852 <ipc_recv_futex+0xa8>
+  80584b:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  805852:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  805855:	48 a1 00 00 82 00 00 	movabs 0x820000,%rax
+  80585c:	00 00 00 
+  80585f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  805865:	48 83 c4 08          	add    $0x8,%rsp
+  805869:	5b                   	pop    %rbx
+  80586a:	41 5c                	pop    %r12
+  80586c:	41 5d                	pop    %r13
+  80586e:	5d                   	pop    %rbp
+  80586f:	c3                   	ret
+        if (from_env_store != NULL) {
+  805870:	4d 85 ed             	test   %r13,%r13
+  805873:	74 08                	je     80587d <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  805875:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80587c:	00 
+        if (perm_store != NULL) {
+  80587d:	4d 85 e4             	test   %r12,%r12
+  805880:	74 08                	je     80588a <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  805882:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  805889:	00 
+        if (size != NULL) {
+  80588a:	48 85 db             	test   %rbx,%rbx
+  80588d:	74 d6                	je     805865 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80588f:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  805896:	eb cd                	jmp    805865 <ipc_recv_futex+0xbb>
+
+0000000000805898 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  805898:	55                   	push   %rbp
+  805899:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80589c:	48 83 ec 08          	sub    $0x8,%rsp
+  8058a0:	6a 00                	push   $0x0
+  8058a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8058a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8058ae:	48 b8 aa 57 80 00 00 	movabs $0x8057aa,%rax
+  8058b5:	00 00 00 
+  8058b8:	ff d0                	call   *%rax
+}
+  8058ba:	c9                   	leave
+  8058bb:	c3                   	ret
+
+00000000008058bc <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8058bc:	55                   	push   %rbp
+  8058bd:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8058c0:	48 85 d2             	test   %rdx,%rdx
+  8058c3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8058ca:	00 00 00 
+  8058cd:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8058d1:	89 f6                	mov    %esi,%esi
+  8058d3:	48 b8 aa 19 80 00 00 	movabs $0x8019aa,%rax
+  8058da:	00 00 00 
+  8058dd:	ff d0                	call   *%rax
+    if (res < 0) {
+  8058df:	85 c0                	test   %eax,%eax
+  8058e1:	78 02                	js     8058e5 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8058e3:	5d                   	pop    %rbp
+  8058e4:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8058e5:	89 c1                	mov    %eax,%ecx
+  8058e7:	48 ba 60 63 80 00 00 	movabs $0x806360,%rdx
+  8058ee:	00 00 00 
+  8058f1:	be 50 00 00 00       	mov    $0x50,%esi
+  8058f6:	48 bf 74 63 80 00 00 	movabs $0x806374,%rdi
+  8058fd:	00 00 00 
+  805900:	b8 00 00 00 00       	mov    $0x0,%eax
+  805905:	49 b8 a3 07 80 00 00 	movabs $0x8007a3,%r8
+  80590c:	00 00 00 
+  80590f:	41 ff d0             	call   *%r8
+
+0000000000805912 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  805912:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  805917:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80591e:	00 00 00 
+  805921:	48 89 d0             	mov    %rdx,%rax
+  805924:	48 c1 e0 04          	shl    $0x4,%rax
+  805928:	48 29 d0             	sub    %rdx,%rax
+  80592b:	48 c1 e0 05          	shl    $0x5,%rax
+  80592f:	48 01 c8             	add    %rcx,%rax
+  805932:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  805938:	39 f8                	cmp    %edi,%eax
+  80593a:	74 13                	je     80594f <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80593c:	48 83 c2 01          	add    $0x1,%rdx
+  805940:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  805947:	75 d8                	jne    805921 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  805949:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80594e:	c3                   	ret
+            return envs[i].env_id;
+  80594f:	48 89 d0             	mov    %rdx,%rax
+  805952:	48 c1 e0 04          	shl    $0x4,%rax
+  805956:	48 29 d0             	sub    %rdx,%rax
+  805959:	48 c1 e0 05          	shl    $0x5,%rax
+  80595d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805964:	00 00 00 
+  805967:	48 01 d0             	add    %rdx,%rax
+  80596a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  805970:	c3                   	ret
+  805971:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+
+0000000000805978 <__rodata_start>:
+  805978:	6d                   	insl   (%dx),%es:(%rdi)
+  805979:	6d                   	insl   (%dx),%es:(%rdi)
+  80597a:	61                   	(bad)
+  80597b:	70 20                	jo     80599d <__rodata_start+0x25>
+  80597d:	2f                   	(bad)
+  80597e:	62                   	(bad)
+  80597f:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  805986:	20 25 69 00 75 73    	and    %ah,0x73750069(%rip)        # 73f559f5 <__bss_end+0x737039f5>
+  80598c:	65 72 2f             	gs jb  8059be <__rodata_start+0x46>
+  80598f:	6d                   	insl   (%dx),%es:(%rdi)
+  805990:	6d                   	insl   (%dx),%es:(%rdi)
+  805991:	61                   	(bad)
+  805992:	70 62                	jo     8059f6 <__rodata_start+0x7e>
+  805994:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805996:	63 68 2e             	movsxd 0x2e(%rax),%ebp
+  805999:	63 00                	movsxd (%rax),%eax
+  80599b:	72 65                	jb     805a02 <__rodata_start+0x8a>
+  80599d:	61                   	(bad)
+  80599e:	64 20 2f             	and    %ch,%fs:(%rdi)
+  8059a1:	62                   	(bad)
+  8059a2:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  8059a9:	20 25 69 00 6d 75    	and    %ah,0x756d0069(%rip)        # 75ed5a18 <__bss_end+0x75683a18>
+  8059af:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8059b0:	6d                   	insl   (%dx),%es:(%rdi)
+  8059b1:	61                   	(bad)
+  8059b2:	70 3a                	jo     8059ee <__rodata_start+0x76>
+  8059b4:	20 25 69 00 6f 70    	and    %ah,0x706f0069(%rip)        # 70ef5a23 <__bss_end+0x706a3a23>
+  8059ba:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8059bc:	20 2f                	and    %ch,(%rdi)
+  8059be:	62                   	(bad)
+  8059bf:	69 67 66 69 6c 65 3a 	imul   $0x3a656c69,0x66(%rdi),%esp
+  8059c6:	20 25 69 00 66 73    	and    %ah,0x73660069(%rip)        # 73e65a35 <__bss_end+0x73613a35>
+  8059cc:	74 61                	je     805a2f <__rodata_start+0xb7>
+  8059ce:	74 20                	je     8059f0 <__rodata_start+0x78>
+  8059d0:	2f                   	(bad)
+  8059d1:	62                   	(bad)
+  8059d2:	69 67 66 69 6c 65 00 	imul   $0x656c69,0x66(%rdi),%esp
+  8059d9:	72 65                	jb     805a40 <__rodata_start+0xc8>
+  8059db:	61                   	(bad)
+  8059dc:	64 00 73 68          	add    %dh,%fs:0x68(%rbx)
+  8059e0:	61                   	(bad)
+  8059e1:	72 65                	jb     805a48 <__rodata_start+0xd0>
+  8059e3:	64 20 6d 6d          	and    %ch,%fs:0x6d(%rbp)
+  8059e7:	61                   	(bad)
+  8059e8:	70 00                	jo     8059ea <__rodata_start+0x72>
+  8059ea:	70 72                	jo     805a5e <__rodata_start+0xe6>
+  8059ec:	69 76 61 74 65 20 6d 	imul   $0x6d206574,0x61(%rsi),%esi
+  8059f3:	6d                   	insl   (%dx),%es:(%rdi)
+  8059f4:	61                   	(bad)
+  8059f5:	70 00                	jo     8059f7 <__rodata_start+0x7f>
+  8059f7:	70 6f                	jo     805a68 <__rodata_start+0xf0>
+  8059f9:	70 75                	jo     805a70 <__rodata_start+0xf8>
+  8059fb:	6c                   	insb   (%dx),%es:(%rdi)
+  8059fc:	61                   	(bad)
+  8059fd:	74 65                	je     805a64 <__rodata_start+0xec>
+  8059ff:	64 20 6d 6d          	and    %ch,%fs:0x6d(%rbp)
+  805a03:	61                   	(bad)
+  805a04:	70 00                	jo     805a06 <__rodata_start+0x8e>
+  805a06:	2f                   	(bad)
+  805a07:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  805a0c:	00 73 70             	add    %dh,0x70(%rbx)
+  805a0f:	61                   	(bad)
+  805a10:	77 6e                	ja     805a80 <__rodata_start+0x108>
+  805a12:	20 2f                	and    %ch,(%rdi)
+  805a14:	68 65 6c 6c 6f       	push   $0x6f6c6c65
+  805a19:	3a 20                	cmp    (%rax),%ah
+  805a1b:	25 69 00 66 90       	and    $0x90660069,%eax
+  805a20:	6d                   	insl   (%dx),%es:(%rdi)
+  805a21:	6d                   	insl   (%dx),%es:(%rdi)
+  805a22:	61                   	(bad)
+  805a23:	70 62                	jo     805a87 <__rodata_start+0x10f>
+  805a25:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805a27:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  805a2a:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a094a3 <__bss_end+0x251b74a3>
+  805a30:	6c                   	insb   (%dx),%es:(%rdi)
+  805a31:	75 20                	jne    805a53 <__rodata_start+0xdb>
+  805a33:	4b                   	rex.WXB
+  805a34:	42 2c 20             	rex.X sub $0x20,%al
+  805a37:	25 6c 75 2e 25       	and    $0x252e756c,%eax
+  805a3c:	30 32                	xor    %dh,(%rdx)
+  805a3e:	6c                   	insb   (%dx),%es:(%rdi)
+  805a3f:	75 20                	jne    805a61 <__rodata_start+0xe9>
+  805a41:	63 79 63             	movsxd 0x63(%rcx),%edi
+  805a44:	6c                   	insb   (%dx),%es:(%rdi)
+  805a45:	65 73 20             	gs jae 805a68 <__rodata_start+0xf0>
+  805a48:	70 65                	jo     805aaf <__rodata_start+0x137>
+  805a4a:	72 20                	jb     805a6c <__rodata_start+0xf4>
+  805a4c:	62                   	(bad)
+  805a4d:	79 74                	jns    805ac3 <__rodata_start+0x14b>
+  805a4f:	65 0a 00             	or     %gs:(%rax),%al
+  805a52:	00 00                	add    %al,(%rax)
+  805a54:	00 00                	add    %al,(%rax)
+  805a56:	00 00                	add    %al,(%rax)
+  805a58:	70 72                	jo     805acc <__rodata_start+0x154>
+  805a5a:	69 76 61 74 65 20 6d 	imul   $0x6d206574,0x61(%rsi),%esi
+  805a61:	61                   	(bad)
+  805a62:	70 70                	jo     805ad4 <__rodata_start+0x15c>
+  805a64:	69 6e 67 20 77 72 6f 	imul   $0x6f727720,0x67(%rsi),%ebp
+  805a6b:	74 65                	je     805ad2 <__rodata_start+0x15a>
+  805a6d:	20 74 6f 20          	and    %dh,0x20(%rdi,%rbp,2)
+  805a71:	74 68                	je     805adb <__rodata_start+0x163>
+  805a73:	65 20 66 69          	and    %ah,%gs:0x69(%rsi)
+  805a77:	6c                   	insb   (%dx),%es:(%rdi)
+  805a78:	65 00 00             	add    %al,%gs:(%rax)
+  805a7b:	00 00                	add    %al,(%rax)
+  805a7d:	00 00                	add    %al,(%rax)
+  805a7f:	00 73 68             	add    %dh,0x68(%rbx)
+  805a82:	61                   	(bad)
+  805a83:	72 65                	jb     805aea <__rodata_start+0x172>
+  805a85:	64 20 6d 61          	and    %ch,%fs:0x61(%rbp)
+  805a89:	70 70                	jo     805afb <__rodata_start+0x183>
+  805a8b:	69 6e 67 20 64 69 66 	imul   $0x66696420,0x67(%rsi),%ebp
+  805a92:	66 65 72 73          	data16 gs jb 805b09 <__rodata_start+0x191>
+  805a96:	20 66 72             	and    %ah,0x72(%rsi)
+  805a99:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805a9a:	6d                   	insl   (%dx),%es:(%rdi)
+  805a9b:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  805a9f:	20 66 69             	and    %ah,0x69(%rsi)
+  805aa2:	6c                   	insb   (%dx),%es:(%rdi)
+  805aa3:	65 00 00             	add    %al,%gs:(%rax)
+  805aa6:	00 00                	add    %al,(%rax)
+  805aa8:	70 72                	jo     805b1c <__rodata_start+0x1a4>
+  805aaa:	69 76 61 74 65 20 6d 	imul   $0x6d206574,0x61(%rsi),%esi
+  805ab1:	61                   	(bad)
+  805ab2:	70 70                	jo     805b24 <__rodata_start+0x1ac>
+  805ab4:	69 6e 67 20 64 69 66 	imul   $0x66696420,0x67(%rsi),%ebp
+  805abb:	66 65 72 73          	data16 gs jb 805b32 <__rodata_start+0x1ba>
+  805abf:	20 66 72             	and    %ah,0x72(%rsi)
+  805ac2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805ac3:	6d                   	insl   (%dx),%es:(%rdi)
+  805ac4:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  805ac8:	20 66 69             	and    %ah,0x69(%rsi)
+  805acb:	6c                   	insb   (%dx),%es:(%rdi)
+  805acc:	65 00 00             	add    %al,%gs:(%rax)
+  805acf:	00 70 6f             	add    %dh,0x6f(%rax)
+  805ad2:	70 75                	jo     805b49 <__rodata_start+0x1d1>
+  805ad4:	6c                   	insb   (%dx),%es:(%rdi)
+  805ad5:	61                   	(bad)
+  805ad6:	74 65                	je     805b3d <__rodata_start+0x1c5>
+  805ad8:	64 20 6d 61          	and    %ch,%fs:0x61(%rbp)
+  805adc:	70 70                	jo     805b4e <__rodata_start+0x1d6>
+  805ade:	69 6e 67 20 64 69 66 	imul   $0x66696420,0x67(%rsi),%ebp
+  805ae5:	66 65 72 73          	data16 gs jb 805b5c <__rodata_start+0x1e4>
+  805ae9:	20 66 72             	and    %ah,0x72(%rsi)
+  805aec:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805aed:	6d                   	insl   (%dx),%es:(%rdi)
+  805aee:	20 74 68 65          	and    %dh,0x65(%rax,%rbp,2)
+  805af2:	20 66 69             	and    %ah,0x69(%rsi)
+  805af5:	6c                   	insb   (%dx),%es:(%rdi)
+  805af6:	65 00 6d 6d          	add    %ch,%gs:0x6d(%rbp)
+  805afa:	61                   	(bad)
+  805afb:	70 62                	jo     805b5f <__rodata_start+0x1e7>
+  805afd:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805aff:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  805b02:	20 73 70             	and    %dh,0x70(%rbx)
+  805b05:	61                   	(bad)
+  805b06:	77 6e                	ja     805b76 <__rodata_start+0x1fe>
+  805b08:	3a 20                	cmp    (%rax),%ah
+  805b0a:	25 6c 75 20 4b       	and    $0x4b20756c,%eax
+  805b0f:	63 79 63             	movsxd 0x63(%rcx),%edi
+  805b12:	6c                   	insb   (%dx),%es:(%rdi)
+  805b13:	65 73 0a             	gs jae 805b20 <__rodata_start+0x1a8>
+  805b16:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  805b1d:	77 6e                	ja     805b8d <__rodata_start+0x215>
+  805b1f:	3e 00 0f             	ds add %cl,(%rdi)
+  805b22:	1f                   	(bad)
+  805b23:	80 00 00             	addb   $0x0,(%rax)
+  805b26:	00 00                	add    %al,(%rax)
+  805b28:	5b                   	pop    %rbx
+  805b29:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  805b2e:	20 75 73             	and    %dh,0x73(%rbp)
+  805b31:	65 72 20             	gs jb  805b54 <__rodata_start+0x1dc>
+  805b34:	70 61                	jo     805b97 <__rodata_start+0x21f>
+  805b36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b37:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  805b3e:	73 20                	jae    805b60 <__rodata_start+0x1e8>
+  805b40:	61                   	(bad)
+  805b41:	74 20                	je     805b63 <__rodata_start+0x1eb>
+  805b43:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  805b48:	3a 20                	cmp    (%rax),%ah
+  805b4a:	00 30                	add    %dh,(%rax)
+  805b4c:	31 32                	xor    %esi,(%rdx)
+  805b4e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805b55:	41                   	rex.B
+  805b56:	42                   	rex.X
+  805b57:	43                   	rex.XB
+  805b58:	44                   	rex.R
+  805b59:	45                   	rex.RB
+  805b5a:	46 00 30             	rex.RX add %r14b,(%rax)
+  805b5d:	31 32                	xor    %esi,(%rdx)
+  805b5f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  805b66:	61                   	(bad)
+  805b67:	62 63 64 65 66       	(bad)
+  805b6c:	00 28                	add    %ch,(%rax)
+  805b6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b6f:	75 6c                	jne    805bdd <__rodata_start+0x265>
+  805b71:	6c                   	insb   (%dx),%es:(%rdi)
+  805b72:	29 00                	sub    %eax,(%rax)
+  805b74:	65 72 72             	gs jb  805be9 <__rodata_start+0x271>
+  805b77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b78:	72 20                	jb     805b9a <__rodata_start+0x222>
+  805b7a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  805b7f:	73 70                	jae    805bf1 <__rodata_start+0x279>
+  805b81:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  805b85:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  805b8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805b8d:	72 00                	jb     805b8f <__rodata_start+0x217>
+  805b8f:	62 61 64 20 65       	(bad)
+  805b94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b95:	76 69                	jbe    805c00 <__rodata_start+0x288>
+  805b97:	72 6f                	jb     805c08 <__rodata_start+0x290>
+  805b99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805b9a:	6d                   	insl   (%dx),%es:(%rdi)
+  805b9b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805b9d:	74 00                	je     805b9f <__rodata_start+0x227>
+  805b9f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805ba6:	20 70 61             	and    %dh,0x61(%rax)
+  805ba9:	72 61                	jb     805c0c <__rodata_start+0x294>
+  805bab:	6d                   	insl   (%dx),%es:(%rdi)
+  805bac:	65 74 65             	gs je  805c14 <__rodata_start+0x29c>
+  805baf:	72 00                	jb     805bb1 <__rodata_start+0x239>
+  805bb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bb2:	75 74                	jne    805c28 <__rodata_start+0x2b0>
+  805bb4:	20 6f 66             	and    %ch,0x66(%rdi)
+  805bb7:	20 6d 65             	and    %ch,0x65(%rbp)
+  805bba:	6d                   	insl   (%dx),%es:(%rdi)
+  805bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bbc:	72 79                	jb     805c37 <__rodata_start+0x2bf>
+  805bbe:	00 6f 75             	add    %ch,0x75(%rdi)
+  805bc1:	74 20                	je     805be3 <__rodata_start+0x26b>
+  805bc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bc4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  805bc8:	76 69                	jbe    805c33 <__rodata_start+0x2bb>
+  805bca:	72 6f                	jb     805c3b <__rodata_start+0x2c3>
+  805bcc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bcd:	6d                   	insl   (%dx),%es:(%rdi)
+  805bce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805bd0:	74 73                	je     805c45 <__rodata_start+0x2cd>
+  805bd2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  805bd5:	72 72                	jb     805c49 <__rodata_start+0x2d1>
+  805bd7:	75 70                	jne    805c49 <__rodata_start+0x2d1>
+  805bd9:	74 65                	je     805c40 <__rodata_start+0x2c8>
+  805bdb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  805be0:	75 67                	jne    805c49 <__rodata_start+0x2d1>
+  805be2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805be5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805be7:	00 73 65             	add    %dh,0x65(%rbx)
+  805bea:	67 6d                	insl   (%dx),%es:(%edi)
+  805bec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805bee:	74 61                	je     805c51 <__rodata_start+0x2d9>
+  805bf0:	74 69                	je     805c5b <__rodata_start+0x2e3>
+  805bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805bf3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805bf4:	20 66 61             	and    %ah,0x61(%rsi)
+  805bf7:	75 6c                	jne    805c65 <__rodata_start+0x2ed>
+  805bf9:	74 00                	je     805bfb <__rodata_start+0x283>
+  805bfb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  805c02:	20 45 4c             	and    %al,0x4c(%rbp)
+  805c05:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  805c09:	61                   	(bad)
+  805c0a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  805c0f:	20 73 75             	and    %dh,0x75(%rbx)
+  805c12:	63 68 20             	movsxd 0x20(%rax),%ebp
+  805c15:	73 79                	jae    805c90 <__rodata_start+0x318>
+  805c17:	73 74                	jae    805c8d <__rodata_start+0x315>
+  805c19:	65 6d                	gs insl (%dx),%es:(%rdi)
+  805c1b:	20 63 61             	and    %ah,0x61(%rbx)
+  805c1e:	6c                   	insb   (%dx),%es:(%rdi)
+  805c1f:	6c                   	insb   (%dx),%es:(%rdi)
+  805c20:	00 65 6e             	add    %ah,0x6e(%rbp)
+  805c23:	74 72                	je     805c97 <__rodata_start+0x31f>
+  805c25:	79 20                	jns    805c47 <__rodata_start+0x2cf>
+  805c27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c29:	74 20                	je     805c4b <__rodata_start+0x2d3>
+  805c2b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805c2d:	75 6e                	jne    805c9d <__rodata_start+0x325>
+  805c2f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  805c33:	76 20                	jbe    805c55 <__rodata_start+0x2dd>
+  805c35:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  805c3c:	72 65                	jb     805ca3 <__rodata_start+0x32b>
+  805c3e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  805c41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c42:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  805c46:	65 78 70             	gs js  805cb9 <__rodata_start+0x341>
+  805c49:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  805c4e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  805c51:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  805c55:	20 66 69             	and    %ah,0x69(%rsi)
+  805c58:	6c                   	insb   (%dx),%es:(%rdi)
+  805c59:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  805c5d:	20 66 72             	and    %ah,0x72(%rsi)
+  805c60:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  805c65:	61                   	(bad)
+  805c66:	63 65 20             	movsxd 0x20(%rbp),%esp
+  805c69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c6b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  805c6f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  805c72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c74:	20 6d 61             	and    %ch,0x61(%rbp)
+  805c77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c78:	79 20                	jns    805c9a <__rodata_start+0x322>
+  805c7a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  805c81:	72 65                	jb     805ce8 <__rodata_start+0x370>
+  805c83:	20 6f 70             	and    %ch,0x70(%rdi)
+  805c86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  805c88:	00 66 69             	add    %ah,0x69(%rsi)
+  805c8b:	6c                   	insb   (%dx),%es:(%rdi)
+  805c8c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  805c90:	20 62 6c             	and    %ah,0x6c(%rdx)
+  805c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c94:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  805c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805c98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805c99:	74 20                	je     805cbb <__rodata_start+0x343>
+  805c9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  805c9d:	75 6e                	jne    805d0d <__rodata_start+0x395>
+  805c9f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  805ca3:	76 61                	jbe    805d06 <__rodata_start+0x38e>
+  805ca5:	6c                   	insb   (%dx),%es:(%rdi)
+  805ca6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  805cad:	00 
+  805cae:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  805cb5:	72 65                	jb     805d1c <__rodata_start+0x3a4>
+  805cb7:	61                   	(bad)
+  805cb8:	64 79 20             	fs jns 805cdb <__rodata_start+0x363>
+  805cbb:	65 78 69             	gs js  805d27 <__rodata_start+0x3af>
+  805cbe:	73 74                	jae    805d34 <__rodata_start+0x3bc>
+  805cc0:	73 00                	jae    805cc2 <__rodata_start+0x34a>
+  805cc2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805cc3:	70 65                	jo     805d2a <__rodata_start+0x3b2>
+  805cc5:	72 61                	jb     805d28 <__rodata_start+0x3b0>
+  805cc7:	74 69                	je     805d32 <__rodata_start+0x3ba>
+  805cc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805cca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  805ccb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  805cce:	74 20                	je     805cf0 <__rodata_start+0x378>
+  805cd0:	73 75                	jae    805d47 <__rodata_start+0x3cf>
+  805cd2:	70 70                	jo     805d44 <__rodata_start+0x3cc>
+  805cd4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  805cd5:	72 74                	jb     805d4b <__rodata_start+0x3d3>
+  805cd7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  805cdd:	20 61 67             	and    %ah,0x67(%rcx)
+  805ce0:	61                   	(bad)
+  805ce1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  805ce8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  805cec:	74 00                	je     805cee <__rodata_start+0x376>
+  805cee:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  805cf5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  805cf8:	20 75 73             	and    %dh,0x73(%rbp)
+  805cfb:	65 00 0f             	add    %cl,%gs:(%rdi)
+  805cfe:	1f                   	(bad)
+  805cff:	00 e0                	add    %ah,%al
+  805d01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d07:	00 21                	add    %ah,(%rcx)
+  805d09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d0f:	00 11                	add    %dl,(%rcx)
+  805d11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d17:	00 21                	add    %ah,(%rcx)
+  805d19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d1f:	00 21                	add    %ah,(%rcx)
+  805d21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d27:	00 21                	add    %ah,(%rcx)
+  805d29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d2f:	00 21                	add    %ah,(%rcx)
+  805d31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d37:	00 ff                	add    %bh,%bh
+  805d39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d3f:	00 21                	add    %ah,(%rcx)
+  805d41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d47:	00 21                	add    %ah,(%rcx)
+  805d49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d4f:	00 f3                	add    %dh,%bl
+  805d51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d57:	00 6d 0b             	add    %ch,0xb(%rbp)
+  805d5a:	80 00 00             	addb   $0x0,(%rax)
+  805d5d:	00 00                	add    %al,(%rax)
+  805d5f:	00 21                	add    %ah,(%rcx)
+  805d61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805d67:	00 f3                	add    %dh,%bl
+  805d69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  805d6f:	00 39                	add    %bh,(%rcx)
+  805d71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d77:	00 39                	add    %bh,(%rcx)
+  805d79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d7f:	00 39                	add    %bh,(%rcx)
+  805d81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d87:	00 39                	add    %bh,(%rcx)
+  805d89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d8f:	00 39                	add    %bh,(%rcx)
+  805d91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d97:	00 39                	add    %bh,(%rcx)
+  805d99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805d9f:	00 39                	add    %bh,(%rcx)
+  805da1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805da7:	00 39                	add    %bh,(%rcx)
+  805da9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805daf:	00 39                	add    %bh,(%rcx)
+  805db1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  805db7:	00 21                	add    %ah,(%rcx)
+  805db9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dbf:	00 21                	add    %ah,(%rcx)
+  805dc1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dc7:	00 21                	add    %ah,(%rcx)
+  805dc9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dcf:	00 21                	add    %ah,(%rcx)
+  805dd1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dd7:	00 21                	add    %ah,(%rcx)
+  805dd9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ddf:	00 21                	add    %ah,(%rcx)
+  805de1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805de7:	00 21                	add    %ah,(%rcx)
+  805de9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805def:	00 21                	add    %ah,(%rcx)
+  805df1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805df7:	00 21                	add    %ah,(%rcx)
+  805df9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805dff:	00 21                	add    %ah,(%rcx)
+  805e01:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e07:	00 21                	add    %ah,(%rcx)
+  805e09:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e0f:	00 21                	add    %ah,(%rcx)
+  805e11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e17:	00 21                	add    %ah,(%rcx)
+  805e19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e1f:	00 21                	add    %ah,(%rcx)
+  805e21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e27:	00 21                	add    %ah,(%rcx)
+  805e29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e2f:	00 21                	add    %ah,(%rcx)
+  805e31:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e37:	00 21                	add    %ah,(%rcx)
+  805e39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e3f:	00 21                	add    %ah,(%rcx)
+  805e41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e47:	00 21                	add    %ah,(%rcx)
+  805e49:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e4f:	00 21                	add    %ah,(%rcx)
+  805e51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e57:	00 21                	add    %ah,(%rcx)
+  805e59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e5f:	00 21                	add    %ah,(%rcx)
+  805e61:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e67:	00 21                	add    %ah,(%rcx)
+  805e69:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e6f:	00 21                	add    %ah,(%rcx)
+  805e71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e77:	00 21                	add    %ah,(%rcx)
+  805e79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e7f:	00 21                	add    %ah,(%rcx)
+  805e81:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e87:	00 21                	add    %ah,(%rcx)
+  805e89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e8f:	00 21                	add    %ah,(%rcx)
+  805e91:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e97:	00 21                	add    %ah,(%rcx)
+  805e99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805e9f:	00 21                	add    %ah,(%rcx)
+  805ea1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ea7:	00 44 10 80          	add    %al,-0x80(%rax,%rdx,1)
+  805eab:	00 00                	add    %al,(%rax)
+  805ead:	00 00                	add    %al,(%rax)
+  805eaf:	00 21                	add    %ah,(%rcx)
+  805eb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eb7:	00 21                	add    %ah,(%rcx)
+  805eb9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ebf:	00 21                	add    %ah,(%rcx)
+  805ec1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ec7:	00 21                	add    %ah,(%rcx)
+  805ec9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ecf:	00 21                	add    %ah,(%rcx)
+  805ed1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ed7:	00 21                	add    %ah,(%rcx)
+  805ed9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805edf:	00 21                	add    %ah,(%rcx)
+  805ee1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ee7:	00 21                	add    %ah,(%rcx)
+  805ee9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eef:	00 21                	add    %ah,(%rcx)
+  805ef1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805ef7:	00 21                	add    %ah,(%rcx)
+  805ef9:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805eff:	00 90 0b 80 00 00    	add    %dl,0x800b(%rax)
+  805f05:	00 00                	add    %al,(%rax)
+  805f07:	00 5f 0d             	add    %bl,0xd(%rdi)
+  805f0a:	80 00 00             	addb   $0x0,(%rax)
+  805f0d:	00 00                	add    %al,(%rax)
+  805f0f:	00 21                	add    %ah,(%rcx)
+  805f11:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f17:	00 21                	add    %ah,(%rcx)
+  805f19:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f1f:	00 21                	add    %ah,(%rcx)
+  805f21:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f27:	00 21                	add    %ah,(%rcx)
+  805f29:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f2f:	00 bf 0b 80 00 00    	add    %bh,0x800b(%rdi)
+  805f35:	00 00                	add    %al,(%rax)
+  805f37:	00 21                	add    %ah,(%rcx)
+  805f39:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f3f:	00 21                	add    %ah,(%rcx)
+  805f41:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f47:	00 85 0b 80 00 00    	add    %al,0x800b(%rbp)
+  805f4d:	00 00                	add    %al,(%rax)
+  805f4f:	00 21                	add    %ah,(%rcx)
+  805f51:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f57:	00 21                	add    %ah,(%rcx)
+  805f59:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f5f:	00 07                	add    %al,(%rdi)
+  805f61:	0f 80 00 00 00 00    	jo     805f67 <__rodata_start+0x5ef>
+  805f67:	00 d1                	add    %dl,%cl
+  805f69:	0f 80 00 00 00 00    	jo     805f6f <__rodata_start+0x5f7>
+  805f6f:	00 21                	add    %ah,(%rcx)
+  805f71:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f77:	00 21                	add    %ah,(%rcx)
+  805f79:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f7f:	00 56 0c             	add    %dl,0xc(%rsi)
+  805f82:	80 00 00             	addb   $0x0,(%rax)
+  805f85:	00 00                	add    %al,(%rax)
+  805f87:	00 21                	add    %ah,(%rcx)
+  805f89:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f8f:	00 33                	add    %dh,(%rbx)
+  805f91:	0e                   	(bad)
+  805f92:	80 00 00             	addb   $0x0,(%rax)
+  805f95:	00 00                	add    %al,(%rax)
+  805f97:	00 21                	add    %ah,(%rcx)
+  805f99:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805f9f:	00 21                	add    %ah,(%rcx)
+  805fa1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fa7:	00 44 10 80          	add    %al,-0x80(%rax,%rdx,1)
+  805fab:	00 00                	add    %al,(%rax)
+  805fad:	00 00                	add    %al,(%rax)
+  805faf:	00 21                	add    %ah,(%rcx)
+  805fb1:	11 80 00 00 00 00    	adc    %eax,0x0(%rax)
+  805fb7:	00 e9                	add    %ch,%cl
+  805fb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+	...
+
+0000000000805fc0 <error_string>:
+	...
+  805fc8:	7d 5b 80 00 00 00 00 00 8f 5b 80 00 00 00 00 00     }[.......[......
+  805fd8:	9f 5b 80 00 00 00 00 00 b1 5b 80 00 00 00 00 00     .[.......[......
+  805fe8:	bf 5b 80 00 00 00 00 00 d3 5b 80 00 00 00 00 00     .[.......[......
+  805ff8:	e8 5b 80 00 00 00 00 00 fb 5b 80 00 00 00 00 00     .[.......[......
+  806008:	0d 5c 80 00 00 00 00 00 21 5c 80 00 00 00 00 00     .\......!\......
+  806018:	31 5c 80 00 00 00 00 00 44 5c 80 00 00 00 00 00     1\......D\......
+  806028:	5b 5c 80 00 00 00 00 00 71 5c 80 00 00 00 00 00     [\......q\......
+  806038:	89 5c 80 00 00 00 00 00 a1 5c 80 00 00 00 00 00     .\.......\......
+  806048:	ae 5c 80 00 00 00 00 00 78 60 80 00 00 00 00 00     .\......x`......
+  806058:	c2 5c 80 00 00 00 00 00 da 5c 80 00 00 00 00 00     .\.......\......
+  806068:	e4 5c 80 00 00 00 00 00 ee 5c 80 00 00 00 00 00     .\.......\......
+  806078:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  806088:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  806098:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8060a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8060b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8060c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8060d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8060e8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8060f8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  806108:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  806118:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  806128:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  806138:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  806148:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806158:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000806160 <devtab>:
+  806160:	20 70 80 00 00 00 00 00 60 70 80 00 00 00 00 00      p......`p......
+  806170:	a0 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806180:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806190:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  8061a0:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  8061b0:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  8061c0:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  8061d0:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  8061e0:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  8061f0:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  806200:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  806210:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  806220:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  806230:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  806240:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  806250:	00 61 73 73 65 72 74 69 6f 6e 20 66 61 69 6c 65     .assertion faile
+  806260:	64 3a 20 25 73 00 6c 69 62 2f 73 70 61 77 6e 2e     d: %s.lib/spawn.
+  806270:	63 00 6d 61 70 5f 73 65 67 6d 65 6e 74 2e 6d 6d     c.map_segment.mm
+  806280:	61 70 20 66 61 69 6c 65 64 3a 20 25 69 0a 00 3c     ap failed: %i..<
+  806290:	70 69 70 65 3e 00 6c 69 62 2f 70 69 70 65 2e 63     pipe>.lib/pipe.c
+  8062a0:	00 70 69 70 65 00 66 90 73 79 73 5f 72 65 67 69     .pipe.f.sys_regi
+  8062b0:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  8062c0:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  8062d0:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  8062e0:	63 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00 66 90     c.<cons>.cons.f.
+  8062f0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  806300:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  806310:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  806320:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  806330:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  806340:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  806350:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  806360:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  806370:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  806380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8063b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8063c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8063d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8063e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8063f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8064b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8064c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8064d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8064e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8064f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8065b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8065c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8065d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8065e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8065f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8066b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8066c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8066d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8066e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8066f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8067b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8067c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8067d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8067e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8067f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8068b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8068c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8068d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8068e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8068f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8069b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8069c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8069d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8069e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8069f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
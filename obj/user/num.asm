@@ -0,0 +1,8742 @@
+
+obj/user/num:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 19 02 00 00       	call   80023c <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <num>:
+
+int bol = 1;
+int line = 0;
+
+void
+num(int f, const char *s) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 28          	sub    $0x28,%rsp
+  800036:	41 89 fc             	mov    %edi,%r12d
+  800039:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+    long n;
+    int r;
+    char c;
+
+    while ((n = read(f, &c, 1)) > 0) {
+  80003d:	49 bd 8a 1a 80 00 00 	movabs $0x801a8a,%r13
+  800044:	00 00 00 
+        if (bol) {
+  800047:	48 bb 00 60 80 00 00 	movabs $0x806000,%rbx
+  80004e:	00 00 00 
+            printf("%5d ", ++line);
+  800051:	49 be 00 00 81 00 00 	movabs $0x810000,%r14
+  800058:	00 00 00 
+  80005b:	49 bf 40 4a 80 00 00 	movabs $0x804a40,%r15
+  800062:	00 00 00 
+  800065:	eb 25                	jmp    80008c <num+0x67>
+            bol = 0;
+        }
+        if ((r = write(1, &c, 1)) != 1)
+  800067:	ba 01 00 00 00       	mov    $0x1,%edx
+  80006c:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800070:	bf 01 00 00 00       	mov    $0x1,%edi
+  800075:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  80007c:	00 00 00 
+  80007f:	ff d0                	call   *%rax
+  800081:	83 f8 01             	cmp    $0x1,%eax
+  800084:	75 44                	jne    8000ca <num+0xa5>
+            panic("write error copying %s: %i", s, r);
+        if (c == '\n')
+  800086:	80 7d cf 0a          	cmpb   $0xa,-0x31(%rbp)
+  80008a:	74 70                	je     8000fc <num+0xd7>
+    while ((n = read(f, &c, 1)) > 0) {
+  80008c:	ba 01 00 00 00       	mov    $0x1,%edx
+  800091:	48 8d 75 cf          	lea    -0x31(%rbp),%rsi
+  800095:	44 89 e7             	mov    %r12d,%edi
+  800098:	41 ff d5             	call   *%r13
+  80009b:	48 85 c0             	test   %rax,%rax
+  80009e:	7e 71                	jle    800111 <num+0xec>
+        if (bol) {
+  8000a0:	83 3b 00             	cmpl   $0x0,(%rbx)
+  8000a3:	74 c2                	je     800067 <num+0x42>
+            printf("%5d ", ++line);
+  8000a5:	41 8b 06             	mov    (%r14),%eax
+  8000a8:	8d 70 01             	lea    0x1(%rax),%esi
+  8000ab:	41 89 36             	mov    %esi,(%r14)
+  8000ae:	4c 89 ff             	mov    %r15,%rdi
+  8000b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b6:	48 ba 6a 39 80 00 00 	movabs $0x80396a,%rdx
+  8000bd:	00 00 00 
+  8000c0:	ff d2                	call   *%rdx
+            bol = 0;
+  8000c2:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8000c8:	eb 9d                	jmp    800067 <num+0x42>
+            panic("write error copying %s: %i", s, r);
+  8000ca:	41 89 c0             	mov    %eax,%r8d
+  8000cd:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8000d1:	48 ba 45 4a 80 00 00 	movabs $0x804a45,%rdx
+  8000d8:	00 00 00 
+  8000db:	be 12 00 00 00       	mov    $0x12,%esi
+  8000e0:	48 bf 60 4a 80 00 00 	movabs $0x804a60,%rdi
+  8000e7:	00 00 00 
+  8000ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ef:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  8000f6:	00 00 00 
+  8000f9:	41 ff d1             	call   *%r9
+            bol = 1;
+  8000fc:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800103:	00 00 00 
+  800106:	c7 00 01 00 00 00    	movl   $0x1,(%rax)
+  80010c:	e9 4a ff ff ff       	jmp    80005b <num+0x36>
+    }
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800111:	78 0f                	js     800122 <num+0xfd>
+}
+  800113:	48 83 c4 28          	add    $0x28,%rsp
+  800117:	5b                   	pop    %rbx
+  800118:	41 5c                	pop    %r12
+  80011a:	41 5d                	pop    %r13
+  80011c:	41 5e                	pop    %r14
+  80011e:	41 5f                	pop    %r15
+  800120:	5d                   	pop    %rbp
+  800121:	c3                   	ret
+    if (n < 0) panic("error reading %s: %i", s, (int)n);
+  800122:	41 89 c0             	mov    %eax,%r8d
+  800125:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  800129:	48 ba 6b 4a 80 00 00 	movabs $0x804a6b,%rdx
+  800130:	00 00 00 
+  800133:	be 16 00 00 00       	mov    $0x16,%esi
+  800138:	48 bf 60 4a 80 00 00 	movabs $0x804a60,%rdi
+  80013f:	00 00 00 
+  800142:	b8 00 00 00 00       	mov    $0x0,%eax
+  800147:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  80014e:	00 00 00 
+  800151:	41 ff d1             	call   *%r9
+
+0000000000800154 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800154:	55                   	push   %rbp
+  800155:	48 89 e5             	mov    %rsp,%rbp
+  800158:	41 57                	push   %r15
+  80015a:	41 56                	push   %r14
+  80015c:	41 55                	push   %r13
+  80015e:	41 54                	push   %r12
+  800160:	53                   	push   %rbx
+  800161:	48 83 ec 08          	sub    $0x8,%rsp
+    binaryname = "num";
+  800165:	48 b8 80 4a 80 00 00 	movabs $0x804a80,%rax
+  80016c:	00 00 00 
+  80016f:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  800176:	00 00 00 
+    if (argc == 1)
+  800179:	83 ff 01             	cmp    $0x1,%edi
+  80017c:	74 6f                	je     8001ed <umain+0x99>
+        num(0, "<stdin>");
+    else {
+        for (int i = 1; i < argc; i++) {
+  80017e:	7e 52                	jle    8001d2 <umain+0x7e>
+  800180:	4c 8d 66 08          	lea    0x8(%rsi),%r12
+  800184:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  800187:	4c 8d 7c c6 10       	lea    0x10(%rsi,%rax,8),%r15
+            int f = open(argv[i], O_RDONLY);
+  80018c:	49 bd 6c 2f 80 00 00 	movabs $0x802f6c,%r13
+  800193:	00 00 00 
+            if (f < 0)
+                panic("can't open %s: %i", argv[i], f);
+            else {
+                num(f, argv[i]);
+  800196:	49 be 25 00 80 00 00 	movabs $0x800025,%r14
+  80019d:	00 00 00 
+            int f = open(argv[i], O_RDONLY);
+  8001a0:	49 8b 3c 24          	mov    (%r12),%rdi
+  8001a4:	be 00 00 00 00       	mov    $0x0,%esi
+  8001a9:	41 ff d5             	call   *%r13
+  8001ac:	89 c3                	mov    %eax,%ebx
+            if (f < 0)
+  8001ae:	85 c0                	test   %eax,%eax
+  8001b0:	78 58                	js     80020a <umain+0xb6>
+                num(f, argv[i]);
+  8001b2:	49 8b 34 24          	mov    (%r12),%rsi
+  8001b6:	89 c7                	mov    %eax,%edi
+  8001b8:	41 ff d6             	call   *%r14
+                close(f);
+  8001bb:	89 df                	mov    %ebx,%edi
+  8001bd:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  8001c4:	00 00 00 
+  8001c7:	ff d0                	call   *%rax
+        for (int i = 1; i < argc; i++) {
+  8001c9:	49 83 c4 08          	add    $0x8,%r12
+  8001cd:	4d 39 fc             	cmp    %r15,%r12
+  8001d0:	75 ce                	jne    8001a0 <umain+0x4c>
+            }
+        }
+    }
+    exit();
+  8001d2:	48 b8 ef 02 80 00 00 	movabs $0x8002ef,%rax
+  8001d9:	00 00 00 
+  8001dc:	ff d0                	call   *%rax
+}
+  8001de:	48 83 c4 08          	add    $0x8,%rsp
+  8001e2:	5b                   	pop    %rbx
+  8001e3:	41 5c                	pop    %r12
+  8001e5:	41 5d                	pop    %r13
+  8001e7:	41 5e                	pop    %r14
+  8001e9:	41 5f                	pop    %r15
+  8001eb:	5d                   	pop    %rbp
+  8001ec:	c3                   	ret
+        num(0, "<stdin>");
+  8001ed:	48 be 84 4a 80 00 00 	movabs $0x804a84,%rsi
+  8001f4:	00 00 00 
+  8001f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fc:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800203:	00 00 00 
+  800206:	ff d0                	call   *%rax
+  800208:	eb c8                	jmp    8001d2 <umain+0x7e>
+                panic("can't open %s: %i", argv[i], f);
+  80020a:	49 8b 0c 24          	mov    (%r12),%rcx
+  80020e:	41 89 c0             	mov    %eax,%r8d
+  800211:	48 ba 8c 4a 80 00 00 	movabs $0x804a8c,%rdx
+  800218:	00 00 00 
+  80021b:	be 22 00 00 00       	mov    $0x22,%esi
+  800220:	48 bf 60 4a 80 00 00 	movabs $0x804a60,%rdi
+  800227:	00 00 00 
+  80022a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80022f:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  800236:	00 00 00 
+  800239:	41 ff d1             	call   *%r9
+
+000000000080023c <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80023c:	55                   	push   %rbp
+  80023d:	48 89 e5             	mov    %rsp,%rbp
+  800240:	41 56                	push   %r14
+  800242:	41 55                	push   %r13
+  800244:	41 54                	push   %r12
+  800246:	53                   	push   %rbx
+  800247:	41 89 fd             	mov    %edi,%r13d
+  80024a:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80024d:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800254:	00 00 00 
+  800257:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80025e:	00 00 00 
+  800261:	48 39 c2             	cmp    %rax,%rdx
+  800264:	73 17                	jae    80027d <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800266:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800269:	49 89 c4             	mov    %rax,%r12
+  80026c:	48 83 c3 08          	add    $0x8,%rbx
+  800270:	b8 00 00 00 00       	mov    $0x0,%eax
+  800275:	ff 53 f8             	call   *-0x8(%rbx)
+  800278:	4c 39 e3             	cmp    %r12,%rbx
+  80027b:	72 ef                	jb     80026c <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80027d:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  800284:	00 00 00 
+  800287:	ff d0                	call   *%rax
+  800289:	89 c2                	mov    %eax,%edx
+  80028b:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800291:	48 89 d0             	mov    %rdx,%rax
+  800294:	48 c1 e0 04          	shl    $0x4,%rax
+  800298:	48 29 d0             	sub    %rdx,%rax
+  80029b:	48 c1 e0 05          	shl    $0x5,%rax
+  80029f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8002a6:	00 00 00 
+  8002a9:	48 01 d0             	add    %rdx,%rax
+  8002ac:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  8002b3:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8002b6:	45 85 ed             	test   %r13d,%r13d
+  8002b9:	7e 0d                	jle    8002c8 <libmain+0x8c>
+  8002bb:	49 8b 06             	mov    (%r14),%rax
+  8002be:	48 a3 08 60 80 00 00 	movabs %rax,0x806008
+  8002c5:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8002c8:	4c 89 f6             	mov    %r14,%rsi
+  8002cb:	44 89 ef             	mov    %r13d,%edi
+  8002ce:	48 b8 54 01 80 00 00 	movabs $0x800154,%rax
+  8002d5:	00 00 00 
+  8002d8:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8002da:	48 b8 ef 02 80 00 00 	movabs $0x8002ef,%rax
+  8002e1:	00 00 00 
+  8002e4:	ff d0                	call   *%rax
+#endif
+}
+  8002e6:	5b                   	pop    %rbx
+  8002e7:	41 5c                	pop    %r12
+  8002e9:	41 5d                	pop    %r13
+  8002eb:	41 5e                	pop    %r14
+  8002ed:	5d                   	pop    %rbp
+  8002ee:	c3                   	ret
+
+00000000008002ef <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8002ef:	55                   	push   %rbp
+  8002f0:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8002f3:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  8002fa:	00 00 00 
+  8002fd:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8002ff:	bf 00 00 00 00       	mov    $0x0,%edi
+  800304:	48 b8 f6 11 80 00 00 	movabs $0x8011f6,%rax
+  80030b:	00 00 00 
+  80030e:	ff d0                	call   *%rax
+}
+  800310:	5d                   	pop    %rbp
+  800311:	c3                   	ret
+
+0000000000800312 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800312:	55                   	push   %rbp
+  800313:	48 89 e5             	mov    %rsp,%rbp
+  800316:	41 56                	push   %r14
+  800318:	41 55                	push   %r13
+  80031a:	41 54                	push   %r12
+  80031c:	53                   	push   %rbx
+  80031d:	48 83 ec 50          	sub    $0x50,%rsp
+  800321:	49 89 fc             	mov    %rdi,%r12
+  800324:	41 89 f5             	mov    %esi,%r13d
+  800327:	48 89 d3             	mov    %rdx,%rbx
+  80032a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80032e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800332:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800336:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80033d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800341:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800345:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800349:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80034d:	48 b8 08 60 80 00 00 	movabs $0x806008,%rax
+  800354:	00 00 00 
+  800357:	4c 8b 30             	mov    (%rax),%r14
+  80035a:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  800361:	00 00 00 
+  800364:	ff d0                	call   *%rax
+  800366:	89 c6                	mov    %eax,%esi
+  800368:	45 89 e8             	mov    %r13d,%r8d
+  80036b:	4c 89 e1             	mov    %r12,%rcx
+  80036e:	4c 89 f2             	mov    %r14,%rdx
+  800371:	48 bf a8 4a 80 00 00 	movabs $0x804aa8,%rdi
+  800378:	00 00 00 
+  80037b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800380:	49 bc 62 04 80 00 00 	movabs $0x800462,%r12
+  800387:	00 00 00 
+  80038a:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  80038d:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800391:	48 89 df             	mov    %rbx,%rdi
+  800394:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  80039b:	00 00 00 
+  80039e:	ff d0                	call   *%rax
+    cprintf("\n");
+  8003a0:	48 bf a3 50 80 00 00 	movabs $0x8050a3,%rdi
+  8003a7:	00 00 00 
+  8003aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003af:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8003b2:	cc                   	int3
+  8003b3:	eb fd                	jmp    8003b2 <_panic+0xa0>
+
+00000000008003b5 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8003b5:	55                   	push   %rbp
+  8003b6:	48 89 e5             	mov    %rsp,%rbp
+  8003b9:	53                   	push   %rbx
+  8003ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8003be:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8003c1:	8b 06                	mov    (%rsi),%eax
+  8003c3:	8d 50 01             	lea    0x1(%rax),%edx
+  8003c6:	89 16                	mov    %edx,(%rsi)
+  8003c8:	48 98                	cltq
+  8003ca:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8003cf:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8003d5:	74 0a                	je     8003e1 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8003d7:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8003db:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8003df:	c9                   	leave
+  8003e0:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8003e1:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8003e5:	be ff 00 00 00       	mov    $0xff,%esi
+  8003ea:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  8003f1:	00 00 00 
+  8003f4:	ff d0                	call   *%rax
+        state->offset = 0;
+  8003f6:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8003fc:	eb d9                	jmp    8003d7 <putch+0x22>
+
+00000000008003fe <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8003fe:	55                   	push   %rbp
+  8003ff:	48 89 e5             	mov    %rsp,%rbp
+  800402:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800409:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80040c:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800413:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800418:	b8 00 00 00 00       	mov    $0x0,%eax
+  80041d:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800420:	48 89 f1             	mov    %rsi,%rcx
+  800423:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80042a:	48 bf b5 03 80 00 00 	movabs $0x8003b5,%rdi
+  800431:	00 00 00 
+  800434:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  80043b:	00 00 00 
+  80043e:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800440:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800447:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80044e:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  800455:	00 00 00 
+  800458:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80045a:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800460:	c9                   	leave
+  800461:	c3                   	ret
+
+0000000000800462 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800462:	55                   	push   %rbp
+  800463:	48 89 e5             	mov    %rsp,%rbp
+  800466:	48 83 ec 50          	sub    $0x50,%rsp
+  80046a:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80046e:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800472:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800476:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80047a:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80047e:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800485:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800489:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800491:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800495:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800499:	48 b8 fe 03 80 00 00 	movabs $0x8003fe,%rax
+  8004a0:	00 00 00 
+  8004a3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8004a5:	c9                   	leave
+  8004a6:	c3                   	ret
+
+00000000008004a7 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8004a7:	55                   	push   %rbp
+  8004a8:	48 89 e5             	mov    %rsp,%rbp
+  8004ab:	41 57                	push   %r15
+  8004ad:	41 56                	push   %r14
+  8004af:	41 55                	push   %r13
+  8004b1:	41 54                	push   %r12
+  8004b3:	53                   	push   %rbx
+  8004b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8004b8:	49 89 fc             	mov    %rdi,%r12
+  8004bb:	49 89 f5             	mov    %rsi,%r13
+  8004be:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8004c2:	8b 45 10             	mov    0x10(%rbp),%eax
+  8004c5:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8004c8:	41 89 cf             	mov    %ecx,%r15d
+  8004cb:	4c 39 fa             	cmp    %r15,%rdx
+  8004ce:	73 5b                	jae    80052b <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8004d0:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8004d4:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8004d8:	85 db                	test   %ebx,%ebx
+  8004da:	7e 0e                	jle    8004ea <print_num+0x43>
+            putch(padc, put_arg);
+  8004dc:	4c 89 ee             	mov    %r13,%rsi
+  8004df:	44 89 f7             	mov    %r14d,%edi
+  8004e2:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8004e5:	83 eb 01             	sub    $0x1,%ebx
+  8004e8:	75 f2                	jne    8004dc <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8004ea:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8004ee:	48 b9 dc 4a 80 00 00 	movabs $0x804adc,%rcx
+  8004f5:	00 00 00 
+  8004f8:	48 b8 cb 4a 80 00 00 	movabs $0x804acb,%rax
+  8004ff:	00 00 00 
+  800502:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800506:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80050a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80050f:	49 f7 f7             	div    %r15
+  800512:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800516:	4c 89 ee             	mov    %r13,%rsi
+  800519:	41 ff d4             	call   *%r12
+}
+  80051c:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800520:	5b                   	pop    %rbx
+  800521:	41 5c                	pop    %r12
+  800523:	41 5d                	pop    %r13
+  800525:	41 5e                	pop    %r14
+  800527:	41 5f                	pop    %r15
+  800529:	5d                   	pop    %rbp
+  80052a:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80052b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80052f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800534:	49 f7 f7             	div    %r15
+  800537:	48 83 ec 08          	sub    $0x8,%rsp
+  80053b:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80053f:	52                   	push   %rdx
+  800540:	45 0f be c9          	movsbl %r9b,%r9d
+  800544:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800548:	48 89 c2             	mov    %rax,%rdx
+  80054b:	48 b8 a7 04 80 00 00 	movabs $0x8004a7,%rax
+  800552:	00 00 00 
+  800555:	ff d0                	call   *%rax
+  800557:	48 83 c4 10          	add    $0x10,%rsp
+  80055b:	eb 8d                	jmp    8004ea <print_num+0x43>
+
+000000000080055d <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80055d:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800561:	48 8b 06             	mov    (%rsi),%rax
+  800564:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800568:	73 0a                	jae    800574 <sprintputch+0x17>
+        *state->start++ = ch;
+  80056a:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80056e:	48 89 16             	mov    %rdx,(%rsi)
+  800571:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800574:	c3                   	ret
+
+0000000000800575 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800575:	55                   	push   %rbp
+  800576:	48 89 e5             	mov    %rsp,%rbp
+  800579:	48 83 ec 50          	sub    $0x50,%rsp
+  80057d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800581:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800585:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800589:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800590:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800594:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800598:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80059c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8005a0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8005a4:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  8005ab:	00 00 00 
+  8005ae:	ff d0                	call   *%rax
+}
+  8005b0:	c9                   	leave
+  8005b1:	c3                   	ret
+
+00000000008005b2 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8005b2:	55                   	push   %rbp
+  8005b3:	48 89 e5             	mov    %rsp,%rbp
+  8005b6:	41 57                	push   %r15
+  8005b8:	41 56                	push   %r14
+  8005ba:	41 55                	push   %r13
+  8005bc:	41 54                	push   %r12
+  8005be:	53                   	push   %rbx
+  8005bf:	48 83 ec 38          	sub    $0x38,%rsp
+  8005c3:	49 89 fe             	mov    %rdi,%r14
+  8005c6:	49 89 f5             	mov    %rsi,%r13
+  8005c9:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8005cc:	48 8b 01             	mov    (%rcx),%rax
+  8005cf:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8005d3:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8005d7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005db:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8005df:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8005e3:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8005e7:	0f b6 3b             	movzbl (%rbx),%edi
+  8005ea:	40 80 ff 25          	cmp    $0x25,%dil
+  8005ee:	74 18                	je     800608 <vprintfmt+0x56>
+            if (!ch) return;
+  8005f0:	40 84 ff             	test   %dil,%dil
+  8005f3:	0f 84 b1 06 00 00    	je     800caa <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8005f9:	40 0f b6 ff          	movzbl %dil,%edi
+  8005fd:	4c 89 ee             	mov    %r13,%rsi
+  800600:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800603:	4c 89 e3             	mov    %r12,%rbx
+  800606:	eb db                	jmp    8005e3 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800608:	be 00 00 00 00       	mov    $0x0,%esi
+  80060d:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800611:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800616:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80061c:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800623:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800627:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80062c:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800631:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800634:	83 e8 23             	sub    $0x23,%eax
+  800637:	3c 57                	cmp    $0x57,%al
+  800639:	0f 87 51 06 00 00    	ja     800c90 <vprintfmt+0x6de>
+  80063f:	0f b6 c0             	movzbl %al,%eax
+  800642:	48 b9 80 4c 80 00 00 	movabs $0x804c80,%rcx
+  800649:	00 00 00 
+  80064c:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80064f:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800652:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800656:	eb cf                	jmp    800627 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800658:	49 89 dc             	mov    %rbx,%r12
+  80065b:	be 01 00 00 00       	mov    $0x1,%esi
+  800660:	eb c5                	jmp    800627 <vprintfmt+0x75>
+            padc = ch;
+  800662:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800666:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800669:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80066c:	eb b9                	jmp    800627 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80066e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800671:	83 f8 2f             	cmp    $0x2f,%eax
+  800674:	77 24                	ja     80069a <vprintfmt+0xe8>
+  800676:	89 c1                	mov    %eax,%ecx
+  800678:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80067c:	83 c0 08             	add    $0x8,%eax
+  80067f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800682:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800685:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800688:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80068c:	79 99                	jns    800627 <vprintfmt+0x75>
+                width = precision;
+  80068e:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800692:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800698:	eb 8d                	jmp    800627 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80069a:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80069e:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8006a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a6:	eb da                	jmp    800682 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8006a8:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8006ad:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006b1:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8006b7:	3c 39                	cmp    $0x39,%al
+  8006b9:	77 1c                	ja     8006d7 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8006bb:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8006bf:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8006c3:	0f b6 c0             	movzbl %al,%eax
+  8006c6:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8006cb:	0f b6 03             	movzbl (%rbx),%eax
+  8006ce:	3c 39                	cmp    $0x39,%al
+  8006d0:	76 e9                	jbe    8006bb <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8006d2:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8006d5:	eb b1                	jmp    800688 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8006d7:	49 89 dc             	mov    %rbx,%r12
+  8006da:	eb ac                	jmp    800688 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8006dc:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8006df:	85 c9                	test   %ecx,%ecx
+  8006e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006e6:	0f 49 c1             	cmovns %ecx,%eax
+  8006e9:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8006ec:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006ef:	e9 33 ff ff ff       	jmp    800627 <vprintfmt+0x75>
+            lflag++;
+  8006f4:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8006f7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8006fa:	e9 28 ff ff ff       	jmp    800627 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8006ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800702:	83 f8 2f             	cmp    $0x2f,%eax
+  800705:	77 19                	ja     800720 <vprintfmt+0x16e>
+  800707:	89 c2                	mov    %eax,%edx
+  800709:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80070d:	83 c0 08             	add    $0x8,%eax
+  800710:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800713:	8b 3a                	mov    (%rdx),%edi
+  800715:	4c 89 ee             	mov    %r13,%rsi
+  800718:	41 ff d6             	call   *%r14
+            break;
+  80071b:	e9 c3 fe ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800720:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800724:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800728:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80072c:	eb e5                	jmp    800713 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80072e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800731:	83 f8 2f             	cmp    $0x2f,%eax
+  800734:	77 5a                	ja     800790 <vprintfmt+0x1de>
+  800736:	89 c2                	mov    %eax,%edx
+  800738:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80073c:	83 c0 08             	add    $0x8,%eax
+  80073f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800742:	8b 02                	mov    (%rdx),%eax
+  800744:	89 c1                	mov    %eax,%ecx
+  800746:	f7 d9                	neg    %ecx
+  800748:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80074b:	83 f9 16             	cmp    $0x16,%ecx
+  80074e:	7f 4e                	jg     80079e <vprintfmt+0x1ec>
+  800750:	48 63 c1             	movslq %ecx,%rax
+  800753:	48 ba 40 4f 80 00 00 	movabs $0x804f40,%rdx
+  80075a:	00 00 00 
+  80075d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800761:	48 85 c0             	test   %rax,%rax
+  800764:	74 38                	je     80079e <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800766:	48 89 c1             	mov    %rax,%rcx
+  800769:	48 ba 19 51 80 00 00 	movabs $0x805119,%rdx
+  800770:	00 00 00 
+  800773:	4c 89 ee             	mov    %r13,%rsi
+  800776:	4c 89 f7             	mov    %r14,%rdi
+  800779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80077e:	49 b8 75 05 80 00 00 	movabs $0x800575,%r8
+  800785:	00 00 00 
+  800788:	41 ff d0             	call   *%r8
+  80078b:	e9 53 fe ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800790:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800794:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800798:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80079c:	eb a4                	jmp    800742 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80079e:	48 ba f4 4a 80 00 00 	movabs $0x804af4,%rdx
+  8007a5:	00 00 00 
+  8007a8:	4c 89 ee             	mov    %r13,%rsi
+  8007ab:	4c 89 f7             	mov    %r14,%rdi
+  8007ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007b3:	49 b8 75 05 80 00 00 	movabs $0x800575,%r8
+  8007ba:	00 00 00 
+  8007bd:	41 ff d0             	call   *%r8
+  8007c0:	e9 1e fe ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8007c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8007cb:	77 6c                	ja     800839 <vprintfmt+0x287>
+  8007cd:	89 c2                	mov    %eax,%edx
+  8007cf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007d3:	83 c0 08             	add    $0x8,%eax
+  8007d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007d9:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8007dc:	48 85 d2             	test   %rdx,%rdx
+  8007df:	48 b8 ed 4a 80 00 00 	movabs $0x804aed,%rax
+  8007e6:	00 00 00 
+  8007e9:	48 0f 45 c2          	cmovne %rdx,%rax
+  8007ed:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8007f1:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007f5:	7e 06                	jle    8007fd <vprintfmt+0x24b>
+  8007f7:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8007fb:	75 4a                	jne    800847 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007fd:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800801:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800805:	0f b6 00             	movzbl (%rax),%eax
+  800808:	84 c0                	test   %al,%al
+  80080a:	0f 85 9a 00 00 00    	jne    8008aa <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800810:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800813:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800817:	85 c0                	test   %eax,%eax
+  800819:	0f 8e c4 fd ff ff    	jle    8005e3 <vprintfmt+0x31>
+  80081f:	4c 89 ee             	mov    %r13,%rsi
+  800822:	bf 20 00 00 00       	mov    $0x20,%edi
+  800827:	41 ff d6             	call   *%r14
+  80082a:	41 83 ec 01          	sub    $0x1,%r12d
+  80082e:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800832:	75 eb                	jne    80081f <vprintfmt+0x26d>
+  800834:	e9 aa fd ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800839:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80083d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800841:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800845:	eb 92                	jmp    8007d9 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800847:	49 63 f7             	movslq %r15d,%rsi
+  80084a:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80084e:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  800855:	00 00 00 
+  800858:	ff d0                	call   *%rax
+  80085a:	48 89 c2             	mov    %rax,%rdx
+  80085d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800860:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800862:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800865:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800868:	85 c0                	test   %eax,%eax
+  80086a:	7e 91                	jle    8007fd <vprintfmt+0x24b>
+  80086c:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800871:	4c 89 ee             	mov    %r13,%rsi
+  800874:	44 89 e7             	mov    %r12d,%edi
+  800877:	41 ff d6             	call   *%r14
+  80087a:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80087e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800881:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800884:	75 eb                	jne    800871 <vprintfmt+0x2bf>
+  800886:	e9 72 ff ff ff       	jmp    8007fd <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80088b:	0f b6 f8             	movzbl %al,%edi
+  80088e:	4c 89 ee             	mov    %r13,%rsi
+  800891:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800894:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800898:	49 83 c4 01          	add    $0x1,%r12
+  80089c:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8008a2:	84 c0                	test   %al,%al
+  8008a4:	0f 84 66 ff ff ff    	je     800810 <vprintfmt+0x25e>
+  8008aa:	45 85 ff             	test   %r15d,%r15d
+  8008ad:	78 0a                	js     8008b9 <vprintfmt+0x307>
+  8008af:	41 83 ef 01          	sub    $0x1,%r15d
+  8008b3:	0f 88 57 ff ff ff    	js     800810 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8008b9:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8008bd:	74 cc                	je     80088b <vprintfmt+0x2d9>
+  8008bf:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8008c2:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8008c7:	80 fa 5e             	cmp    $0x5e,%dl
+  8008ca:	77 c2                	ja     80088e <vprintfmt+0x2dc>
+  8008cc:	eb bd                	jmp    80088b <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8008ce:	40 84 f6             	test   %sil,%sil
+  8008d1:	75 26                	jne    8008f9 <vprintfmt+0x347>
+    switch (lflag) {
+  8008d3:	85 d2                	test   %edx,%edx
+  8008d5:	74 59                	je     800930 <vprintfmt+0x37e>
+  8008d7:	83 fa 01             	cmp    $0x1,%edx
+  8008da:	74 7b                	je     800957 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8008dc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008df:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e2:	0f 87 96 00 00 00    	ja     80097e <vprintfmt+0x3cc>
+  8008e8:	89 c2                	mov    %eax,%edx
+  8008ea:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ee:	83 c0 08             	add    $0x8,%eax
+  8008f1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f4:	4c 8b 22             	mov    (%rdx),%r12
+  8008f7:	eb 17                	jmp    800910 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 21                	ja     800922 <vprintfmt+0x370>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80090d:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800910:	4d 85 e4             	test   %r12,%r12
+  800913:	78 7a                	js     80098f <vprintfmt+0x3dd>
+            num = i;
+  800915:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800918:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80091d:	e9 50 02 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800922:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800926:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80092a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092e:	eb dd                	jmp    80090d <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800930:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800933:	83 f8 2f             	cmp    $0x2f,%eax
+  800936:	77 11                	ja     800949 <vprintfmt+0x397>
+  800938:	89 c2                	mov    %eax,%edx
+  80093a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093e:	83 c0 08             	add    $0x8,%eax
+  800941:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800944:	4c 63 22             	movslq (%rdx),%r12
+  800947:	eb c7                	jmp    800910 <vprintfmt+0x35e>
+  800949:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800951:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800955:	eb ed                	jmp    800944 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800957:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095a:	83 f8 2f             	cmp    $0x2f,%eax
+  80095d:	77 11                	ja     800970 <vprintfmt+0x3be>
+  80095f:	89 c2                	mov    %eax,%edx
+  800961:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800965:	83 c0 08             	add    $0x8,%eax
+  800968:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096b:	4c 8b 22             	mov    (%rdx),%r12
+  80096e:	eb a0                	jmp    800910 <vprintfmt+0x35e>
+  800970:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800974:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800978:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097c:	eb ed                	jmp    80096b <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80097e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800982:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800986:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80098a:	e9 65 ff ff ff       	jmp    8008f4 <vprintfmt+0x342>
+                putch('-', put_arg);
+  80098f:	4c 89 ee             	mov    %r13,%rsi
+  800992:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800997:	41 ff d6             	call   *%r14
+                i = -i;
+  80099a:	49 f7 dc             	neg    %r12
+  80099d:	e9 73 ff ff ff       	jmp    800915 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8009a2:	40 84 f6             	test   %sil,%sil
+  8009a5:	75 32                	jne    8009d9 <vprintfmt+0x427>
+    switch (lflag) {
+  8009a7:	85 d2                	test   %edx,%edx
+  8009a9:	74 5d                	je     800a08 <vprintfmt+0x456>
+  8009ab:	83 fa 01             	cmp    $0x1,%edx
+  8009ae:	0f 84 82 00 00 00    	je     800a36 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  8009b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ba:	0f 87 a5 00 00 00    	ja     800a65 <vprintfmt+0x4b3>
+  8009c0:	89 c2                	mov    %eax,%edx
+  8009c2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c6:	83 c0 08             	add    $0x8,%eax
+  8009c9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cc:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009d4:	e9 99 01 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009df:	77 19                	ja     8009fa <vprintfmt+0x448>
+  8009e1:	89 c2                	mov    %eax,%edx
+  8009e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e7:	83 c0 08             	add    $0x8,%eax
+  8009ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009ed:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8009f0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8009f5:	e9 78 01 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+  8009fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a06:	eb e5                	jmp    8009ed <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800a08:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0e:	77 18                	ja     800a28 <vprintfmt+0x476>
+  800a10:	89 c2                	mov    %eax,%edx
+  800a12:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a16:	83 c0 08             	add    $0x8,%eax
+  800a19:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1c:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800a1e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800a23:	e9 4a 01 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+  800a28:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a2c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a34:	eb e6                	jmp    800a1c <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800a36:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a39:	83 f8 2f             	cmp    $0x2f,%eax
+  800a3c:	77 19                	ja     800a57 <vprintfmt+0x4a5>
+  800a3e:	89 c2                	mov    %eax,%edx
+  800a40:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a44:	83 c0 08             	add    $0x8,%eax
+  800a47:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800a4d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800a52:	e9 1b 01 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+  800a57:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a63:	eb e5                	jmp    800a4a <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800a65:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a69:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a71:	e9 56 ff ff ff       	jmp    8009cc <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800a76:	40 84 f6             	test   %sil,%sil
+  800a79:	75 2e                	jne    800aa9 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800a7b:	85 d2                	test   %edx,%edx
+  800a7d:	74 59                	je     800ad8 <vprintfmt+0x526>
+  800a7f:	83 fa 01             	cmp    $0x1,%edx
+  800a82:	74 7f                	je     800b03 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800a84:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a87:	83 f8 2f             	cmp    $0x2f,%eax
+  800a8a:	0f 87 9f 00 00 00    	ja     800b2f <vprintfmt+0x57d>
+  800a90:	89 c2                	mov    %eax,%edx
+  800a92:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a96:	83 c0 08             	add    $0x8,%eax
+  800a99:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a9c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a9f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800aa4:	e9 c9 00 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aa9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aac:	83 f8 2f             	cmp    $0x2f,%eax
+  800aaf:	77 19                	ja     800aca <vprintfmt+0x518>
+  800ab1:	89 c2                	mov    %eax,%edx
+  800ab3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab7:	83 c0 08             	add    $0x8,%eax
+  800aba:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ac0:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ac5:	e9 a8 00 00 00       	jmp    800b72 <vprintfmt+0x5c0>
+  800aca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ace:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ad2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad6:	eb e5                	jmp    800abd <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ad8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800adb:	83 f8 2f             	cmp    $0x2f,%eax
+  800ade:	77 15                	ja     800af5 <vprintfmt+0x543>
+  800ae0:	89 c2                	mov    %eax,%edx
+  800ae2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae6:	83 c0 08             	add    $0x8,%eax
+  800ae9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aec:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800aee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800af3:	eb 7d                	jmp    800b72 <vprintfmt+0x5c0>
+  800af5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b01:	eb e9                	jmp    800aec <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800b03:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b06:	83 f8 2f             	cmp    $0x2f,%eax
+  800b09:	77 16                	ja     800b21 <vprintfmt+0x56f>
+  800b0b:	89 c2                	mov    %eax,%edx
+  800b0d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b11:	83 c0 08             	add    $0x8,%eax
+  800b14:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b17:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800b1a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800b1f:	eb 51                	jmp    800b72 <vprintfmt+0x5c0>
+  800b21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2d:	eb e8                	jmp    800b17 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800b2f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b33:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b37:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b3b:	e9 5c ff ff ff       	jmp    800a9c <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800b40:	4c 89 ee             	mov    %r13,%rsi
+  800b43:	bf 30 00 00 00       	mov    $0x30,%edi
+  800b48:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800b4b:	4c 89 ee             	mov    %r13,%rsi
+  800b4e:	bf 78 00 00 00       	mov    $0x78,%edi
+  800b53:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800b56:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b59:	83 f8 2f             	cmp    $0x2f,%eax
+  800b5c:	77 47                	ja     800ba5 <vprintfmt+0x5f3>
+  800b5e:	89 c2                	mov    %eax,%edx
+  800b60:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b64:	83 c0 08             	add    $0x8,%eax
+  800b67:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b6a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b6d:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800b72:	48 83 ec 08          	sub    $0x8,%rsp
+  800b76:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800b7a:	0f 94 c0             	sete   %al
+  800b7d:	0f b6 c0             	movzbl %al,%eax
+  800b80:	50                   	push   %rax
+  800b81:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800b86:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800b8a:	4c 89 ee             	mov    %r13,%rsi
+  800b8d:	4c 89 f7             	mov    %r14,%rdi
+  800b90:	48 b8 a7 04 80 00 00 	movabs $0x8004a7,%rax
+  800b97:	00 00 00 
+  800b9a:	ff d0                	call   *%rax
+            break;
+  800b9c:	48 83 c4 10          	add    $0x10,%rsp
+  800ba0:	e9 3e fa ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800ba5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ba9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bad:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bb1:	eb b7                	jmp    800b6a <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800bb3:	40 84 f6             	test   %sil,%sil
+  800bb6:	75 2b                	jne    800be3 <vprintfmt+0x631>
+    switch (lflag) {
+  800bb8:	85 d2                	test   %edx,%edx
+  800bba:	74 56                	je     800c12 <vprintfmt+0x660>
+  800bbc:	83 fa 01             	cmp    $0x1,%edx
+  800bbf:	74 7f                	je     800c40 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800bc1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc4:	83 f8 2f             	cmp    $0x2f,%eax
+  800bc7:	0f 87 a2 00 00 00    	ja     800c6f <vprintfmt+0x6bd>
+  800bcd:	89 c2                	mov    %eax,%edx
+  800bcf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd3:	83 c0 08             	add    $0x8,%eax
+  800bd6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bd9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bdc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800be1:	eb 8f                	jmp    800b72 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800be3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800be6:	83 f8 2f             	cmp    $0x2f,%eax
+  800be9:	77 19                	ja     800c04 <vprintfmt+0x652>
+  800beb:	89 c2                	mov    %eax,%edx
+  800bed:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bf1:	83 c0 08             	add    $0x8,%eax
+  800bf4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bf7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800bfa:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bff:	e9 6e ff ff ff       	jmp    800b72 <vprintfmt+0x5c0>
+  800c04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c10:	eb e5                	jmp    800bf7 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800c12:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c15:	83 f8 2f             	cmp    $0x2f,%eax
+  800c18:	77 18                	ja     800c32 <vprintfmt+0x680>
+  800c1a:	89 c2                	mov    %eax,%edx
+  800c1c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c20:	83 c0 08             	add    $0x8,%eax
+  800c23:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c26:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800c28:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800c2d:	e9 40 ff ff ff       	jmp    800b72 <vprintfmt+0x5c0>
+  800c32:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c36:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c3a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3e:	eb e6                	jmp    800c26 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800c40:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c43:	83 f8 2f             	cmp    $0x2f,%eax
+  800c46:	77 19                	ja     800c61 <vprintfmt+0x6af>
+  800c48:	89 c2                	mov    %eax,%edx
+  800c4a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c4e:	83 c0 08             	add    $0x8,%eax
+  800c51:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c54:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c57:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800c5c:	e9 11 ff ff ff       	jmp    800b72 <vprintfmt+0x5c0>
+  800c61:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c65:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c6d:	eb e5                	jmp    800c54 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800c6f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c73:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c77:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7b:	e9 59 ff ff ff       	jmp    800bd9 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800c80:	4c 89 ee             	mov    %r13,%rsi
+  800c83:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c88:	41 ff d6             	call   *%r14
+            break;
+  800c8b:	e9 53 f9 ff ff       	jmp    8005e3 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800c90:	4c 89 ee             	mov    %r13,%rsi
+  800c93:	bf 25 00 00 00       	mov    $0x25,%edi
+  800c98:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800c9b:	48 83 eb 01          	sub    $0x1,%rbx
+  800c9f:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800ca3:	75 f6                	jne    800c9b <vprintfmt+0x6e9>
+  800ca5:	e9 39 f9 ff ff       	jmp    8005e3 <vprintfmt+0x31>
+}
+  800caa:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800cae:	5b                   	pop    %rbx
+  800caf:	41 5c                	pop    %r12
+  800cb1:	41 5d                	pop    %r13
+  800cb3:	41 5e                	pop    %r14
+  800cb5:	41 5f                	pop    %r15
+  800cb7:	5d                   	pop    %rbp
+  800cb8:	c3                   	ret
+
+0000000000800cb9 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800cb9:	55                   	push   %rbp
+  800cba:	48 89 e5             	mov    %rsp,%rbp
+  800cbd:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800cc1:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800cc5:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800cca:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800cce:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800cd5:	48 85 ff             	test   %rdi,%rdi
+  800cd8:	74 2b                	je     800d05 <vsnprintf+0x4c>
+  800cda:	48 85 f6             	test   %rsi,%rsi
+  800cdd:	74 26                	je     800d05 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800cdf:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800ce3:	48 bf 5d 05 80 00 00 	movabs $0x80055d,%rdi
+  800cea:	00 00 00 
+  800ced:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  800cf4:	00 00 00 
+  800cf7:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800cf9:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800cfd:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800d00:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800d03:	c9                   	leave
+  800d04:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800d05:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800d0a:	eb f7                	jmp    800d03 <vsnprintf+0x4a>
+
+0000000000800d0c <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800d0c:	55                   	push   %rbp
+  800d0d:	48 89 e5             	mov    %rsp,%rbp
+  800d10:	48 83 ec 50          	sub    $0x50,%rsp
+  800d14:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800d18:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800d1c:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800d20:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800d27:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800d2b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2f:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d33:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800d37:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800d3b:	48 b8 b9 0c 80 00 00 	movabs $0x800cb9,%rax
+  800d42:	00 00 00 
+  800d45:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800d47:	c9                   	leave
+  800d48:	c3                   	ret
+
+0000000000800d49 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800d49:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800d4c:	74 10                	je     800d5e <strlen+0x15>
+    size_t n = 0;
+  800d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800d53:	48 83 c0 01          	add    $0x1,%rax
+  800d57:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800d5b:	75 f6                	jne    800d53 <strlen+0xa>
+  800d5d:	c3                   	ret
+    size_t n = 0;
+  800d5e:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800d63:	c3                   	ret
+
+0000000000800d64 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800d64:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800d67:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800d6c:	48 85 f6             	test   %rsi,%rsi
+  800d6f:	74 11                	je     800d82 <strnlen+0x1e>
+  800d71:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800d75:	74 0c                	je     800d83 <strnlen+0x1f>
+  800d77:	48 83 c2 01          	add    $0x1,%rdx
+  800d7b:	48 39 d0             	cmp    %rdx,%rax
+  800d7e:	75 f1                	jne    800d71 <strnlen+0xd>
+  800d80:	eb 04                	jmp    800d86 <strnlen+0x22>
+  800d82:	c3                   	ret
+  800d83:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800d86:	c3                   	ret
+
+0000000000800d87 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800d87:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800d8a:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d8f:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800d93:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800d96:	48 83 c2 01          	add    $0x1,%rdx
+  800d9a:	84 c9                	test   %cl,%cl
+  800d9c:	75 f1                	jne    800d8f <strcpy+0x8>
+        ;
+    return res;
+}
+  800d9e:	c3                   	ret
+
+0000000000800d9f <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800d9f:	55                   	push   %rbp
+  800da0:	48 89 e5             	mov    %rsp,%rbp
+  800da3:	41 54                	push   %r12
+  800da5:	53                   	push   %rbx
+  800da6:	48 89 fb             	mov    %rdi,%rbx
+  800da9:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800dac:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  800db3:	00 00 00 
+  800db6:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800db8:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800dbc:	4c 89 e6             	mov    %r12,%rsi
+  800dbf:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  800dc6:	00 00 00 
+  800dc9:	ff d0                	call   *%rax
+    return dst;
+}
+  800dcb:	48 89 d8             	mov    %rbx,%rax
+  800dce:	5b                   	pop    %rbx
+  800dcf:	41 5c                	pop    %r12
+  800dd1:	5d                   	pop    %rbp
+  800dd2:	c3                   	ret
+
+0000000000800dd3 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800dd3:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800dd6:	48 85 d2             	test   %rdx,%rdx
+  800dd9:	74 1f                	je     800dfa <strncpy+0x27>
+  800ddb:	48 01 fa             	add    %rdi,%rdx
+  800dde:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800de1:	48 83 c1 01          	add    $0x1,%rcx
+  800de5:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800de9:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800ded:	41 80 f8 01          	cmp    $0x1,%r8b
+  800df1:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800df5:	48 39 ca             	cmp    %rcx,%rdx
+  800df8:	75 e7                	jne    800de1 <strncpy+0xe>
+    }
+    return ret;
+}
+  800dfa:	c3                   	ret
+
+0000000000800dfb <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800dfb:	48 89 f8             	mov    %rdi,%rax
+  800dfe:	48 85 d2             	test   %rdx,%rdx
+  800e01:	74 24                	je     800e27 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800e03:	48 83 ea 01          	sub    $0x1,%rdx
+  800e07:	74 1b                	je     800e24 <strlcpy+0x29>
+  800e09:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800e0d:	0f b6 16             	movzbl (%rsi),%edx
+  800e10:	84 d2                	test   %dl,%dl
+  800e12:	74 10                	je     800e24 <strlcpy+0x29>
+            *dst++ = *src++;
+  800e14:	48 83 c6 01          	add    $0x1,%rsi
+  800e18:	48 83 c0 01          	add    $0x1,%rax
+  800e1c:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800e1f:	48 39 c8             	cmp    %rcx,%rax
+  800e22:	75 e9                	jne    800e0d <strlcpy+0x12>
+        *dst = '\0';
+  800e24:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800e27:	48 29 f8             	sub    %rdi,%rax
+}
+  800e2a:	c3                   	ret
+
+0000000000800e2b <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800e2b:	0f b6 07             	movzbl (%rdi),%eax
+  800e2e:	84 c0                	test   %al,%al
+  800e30:	74 13                	je     800e45 <strcmp+0x1a>
+  800e32:	38 06                	cmp    %al,(%rsi)
+  800e34:	75 0f                	jne    800e45 <strcmp+0x1a>
+  800e36:	48 83 c7 01          	add    $0x1,%rdi
+  800e3a:	48 83 c6 01          	add    $0x1,%rsi
+  800e3e:	0f b6 07             	movzbl (%rdi),%eax
+  800e41:	84 c0                	test   %al,%al
+  800e43:	75 ed                	jne    800e32 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e45:	0f b6 c0             	movzbl %al,%eax
+  800e48:	0f b6 16             	movzbl (%rsi),%edx
+  800e4b:	29 d0                	sub    %edx,%eax
+}
+  800e4d:	c3                   	ret
+
+0000000000800e4e <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800e4e:	48 85 d2             	test   %rdx,%rdx
+  800e51:	74 1f                	je     800e72 <strncmp+0x24>
+  800e53:	0f b6 07             	movzbl (%rdi),%eax
+  800e56:	84 c0                	test   %al,%al
+  800e58:	74 1e                	je     800e78 <strncmp+0x2a>
+  800e5a:	3a 06                	cmp    (%rsi),%al
+  800e5c:	75 1a                	jne    800e78 <strncmp+0x2a>
+  800e5e:	48 83 c7 01          	add    $0x1,%rdi
+  800e62:	48 83 c6 01          	add    $0x1,%rsi
+  800e66:	48 83 ea 01          	sub    $0x1,%rdx
+  800e6a:	75 e7                	jne    800e53 <strncmp+0x5>
+
+    if (!n) return 0;
+  800e6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e71:	c3                   	ret
+  800e72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800e77:	c3                   	ret
+  800e78:	48 85 d2             	test   %rdx,%rdx
+  800e7b:	74 09                	je     800e86 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800e7d:	0f b6 07             	movzbl (%rdi),%eax
+  800e80:	0f b6 16             	movzbl (%rsi),%edx
+  800e83:	29 d0                	sub    %edx,%eax
+  800e85:	c3                   	ret
+    if (!n) return 0;
+  800e86:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800e8b:	c3                   	ret
+
+0000000000800e8c <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800e8c:	0f b6 17             	movzbl (%rdi),%edx
+  800e8f:	84 d2                	test   %dl,%dl
+  800e91:	74 18                	je     800eab <strchr+0x1f>
+        if (*str == c) {
+  800e93:	0f be d2             	movsbl %dl,%edx
+  800e96:	39 f2                	cmp    %esi,%edx
+  800e98:	74 17                	je     800eb1 <strchr+0x25>
+    for (; *str; str++) {
+  800e9a:	48 83 c7 01          	add    $0x1,%rdi
+  800e9e:	0f b6 17             	movzbl (%rdi),%edx
+  800ea1:	84 d2                	test   %dl,%dl
+  800ea3:	75 ee                	jne    800e93 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800ea5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eaa:	c3                   	ret
+  800eab:	b8 00 00 00 00       	mov    $0x0,%eax
+  800eb0:	c3                   	ret
+  800eb1:	48 89 f8             	mov    %rdi,%rax
+}
+  800eb4:	c3                   	ret
+
+0000000000800eb5 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800eb5:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800eb8:	0f b6 17             	movzbl (%rdi),%edx
+  800ebb:	84 d2                	test   %dl,%dl
+  800ebd:	74 13                	je     800ed2 <strfind+0x1d>
+  800ebf:	0f be d2             	movsbl %dl,%edx
+  800ec2:	39 f2                	cmp    %esi,%edx
+  800ec4:	74 0b                	je     800ed1 <strfind+0x1c>
+  800ec6:	48 83 c0 01          	add    $0x1,%rax
+  800eca:	0f b6 10             	movzbl (%rax),%edx
+  800ecd:	84 d2                	test   %dl,%dl
+  800ecf:	75 ee                	jne    800ebf <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800ed1:	c3                   	ret
+  800ed2:	c3                   	ret
+
+0000000000800ed3 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ed3:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ed6:	48 89 f8             	mov    %rdi,%rax
+  800ed9:	48 f7 d8             	neg    %rax
+  800edc:	83 e0 07             	and    $0x7,%eax
+  800edf:	49 89 d1             	mov    %rdx,%r9
+  800ee2:	49 29 c1             	sub    %rax,%r9
+  800ee5:	78 36                	js     800f1d <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800ee7:	40 0f b6 c6          	movzbl %sil,%eax
+  800eeb:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800ef2:	01 01 01 
+  800ef5:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800ef9:	40 f6 c7 07          	test   $0x7,%dil
+  800efd:	75 38                	jne    800f37 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800eff:	4c 89 c9             	mov    %r9,%rcx
+  800f02:	48 c1 f9 03          	sar    $0x3,%rcx
+  800f06:	74 0c                	je     800f14 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800f08:	fc                   	cld
+  800f09:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800f0c:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800f10:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800f14:	4d 85 c9             	test   %r9,%r9
+  800f17:	75 45                	jne    800f5e <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800f19:	4c 89 c0             	mov    %r8,%rax
+  800f1c:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800f1d:	48 85 d2             	test   %rdx,%rdx
+  800f20:	74 f7                	je     800f19 <memset+0x46>
+  800f22:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800f25:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800f28:	48 83 c0 01          	add    $0x1,%rax
+  800f2c:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800f30:	48 39 c2             	cmp    %rax,%rdx
+  800f33:	75 f3                	jne    800f28 <memset+0x55>
+  800f35:	eb e2                	jmp    800f19 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800f37:	40 f6 c7 01          	test   $0x1,%dil
+  800f3b:	74 06                	je     800f43 <memset+0x70>
+  800f3d:	88 07                	mov    %al,(%rdi)
+  800f3f:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f43:	40 f6 c7 02          	test   $0x2,%dil
+  800f47:	74 07                	je     800f50 <memset+0x7d>
+  800f49:	66 89 07             	mov    %ax,(%rdi)
+  800f4c:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f50:	40 f6 c7 04          	test   $0x4,%dil
+  800f54:	74 a9                	je     800eff <memset+0x2c>
+  800f56:	89 07                	mov    %eax,(%rdi)
+  800f58:	48 83 c7 04          	add    $0x4,%rdi
+  800f5c:	eb a1                	jmp    800eff <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800f5e:	41 f6 c1 04          	test   $0x4,%r9b
+  800f62:	74 06                	je     800f6a <memset+0x97>
+  800f64:	89 07                	mov    %eax,(%rdi)
+  800f66:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800f6a:	41 f6 c1 02          	test   $0x2,%r9b
+  800f6e:	74 07                	je     800f77 <memset+0xa4>
+  800f70:	66 89 07             	mov    %ax,(%rdi)
+  800f73:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800f77:	41 f6 c1 01          	test   $0x1,%r9b
+  800f7b:	74 9c                	je     800f19 <memset+0x46>
+  800f7d:	88 07                	mov    %al,(%rdi)
+  800f7f:	eb 98                	jmp    800f19 <memset+0x46>
+
+0000000000800f81 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800f81:	48 89 f8             	mov    %rdi,%rax
+  800f84:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800f87:	48 39 fe             	cmp    %rdi,%rsi
+  800f8a:	73 3b                	jae    800fc7 <memmove+0x46>
+  800f8c:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800f90:	48 39 d7             	cmp    %rdx,%rdi
+  800f93:	73 32                	jae    800fc7 <memmove+0x46>
+        s += n;
+        d += n;
+  800f95:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f99:	48 89 d6             	mov    %rdx,%rsi
+  800f9c:	48 09 fe             	or     %rdi,%rsi
+  800f9f:	48 09 ce             	or     %rcx,%rsi
+  800fa2:	40 f6 c6 07          	test   $0x7,%sil
+  800fa6:	75 12                	jne    800fba <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800fa8:	48 83 ef 08          	sub    $0x8,%rdi
+  800fac:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800fb0:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fb4:	fd                   	std
+  800fb5:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800fb8:	fc                   	cld
+  800fb9:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800fba:	48 83 ef 01          	sub    $0x1,%rdi
+  800fbe:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800fc2:	fd                   	std
+  800fc3:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800fc5:	eb f1                	jmp    800fb8 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800fc7:	48 89 f2             	mov    %rsi,%rdx
+  800fca:	48 09 c2             	or     %rax,%rdx
+  800fcd:	48 09 ca             	or     %rcx,%rdx
+  800fd0:	f6 c2 07             	test   $0x7,%dl
+  800fd3:	75 0c                	jne    800fe1 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800fd5:	48 c1 e9 03          	shr    $0x3,%rcx
+  800fd9:	48 89 c7             	mov    %rax,%rdi
+  800fdc:	fc                   	cld
+  800fdd:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800fe0:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800fe1:	48 89 c7             	mov    %rax,%rdi
+  800fe4:	fc                   	cld
+  800fe5:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800fe7:	c3                   	ret
+
+0000000000800fe8 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800fe8:	55                   	push   %rbp
+  800fe9:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800fec:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  800ff3:	00 00 00 
+  800ff6:	ff d0                	call   *%rax
+}
+  800ff8:	5d                   	pop    %rbp
+  800ff9:	c3                   	ret
+
+0000000000800ffa <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ffa:	55                   	push   %rbp
+  800ffb:	48 89 e5             	mov    %rsp,%rbp
+  800ffe:	41 57                	push   %r15
+  801000:	41 56                	push   %r14
+  801002:	41 55                	push   %r13
+  801004:	41 54                	push   %r12
+  801006:	53                   	push   %rbx
+  801007:	48 83 ec 08          	sub    $0x8,%rsp
+  80100b:	49 89 fe             	mov    %rdi,%r14
+  80100e:	49 89 f7             	mov    %rsi,%r15
+  801011:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801014:	48 89 f7             	mov    %rsi,%rdi
+  801017:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80101e:	00 00 00 
+  801021:	ff d0                	call   *%rax
+  801023:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801026:	48 89 de             	mov    %rbx,%rsi
+  801029:	4c 89 f7             	mov    %r14,%rdi
+  80102c:	48 b8 64 0d 80 00 00 	movabs $0x800d64,%rax
+  801033:	00 00 00 
+  801036:	ff d0                	call   *%rax
+  801038:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  80103b:	48 39 c3             	cmp    %rax,%rbx
+  80103e:	74 36                	je     801076 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  801040:	48 89 d8             	mov    %rbx,%rax
+  801043:	4c 29 e8             	sub    %r13,%rax
+  801046:	49 39 c4             	cmp    %rax,%r12
+  801049:	73 31                	jae    80107c <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  80104b:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  801050:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801054:	4c 89 fe             	mov    %r15,%rsi
+  801057:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  80105e:	00 00 00 
+  801061:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801063:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801067:	48 83 c4 08          	add    $0x8,%rsp
+  80106b:	5b                   	pop    %rbx
+  80106c:	41 5c                	pop    %r12
+  80106e:	41 5d                	pop    %r13
+  801070:	41 5e                	pop    %r14
+  801072:	41 5f                	pop    %r15
+  801074:	5d                   	pop    %rbp
+  801075:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801076:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  80107a:	eb eb                	jmp    801067 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  80107c:	48 83 eb 01          	sub    $0x1,%rbx
+  801080:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801084:	48 89 da             	mov    %rbx,%rdx
+  801087:	4c 89 fe             	mov    %r15,%rsi
+  80108a:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  801091:	00 00 00 
+  801094:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801096:	49 01 de             	add    %rbx,%r14
+  801099:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  80109e:	eb c3                	jmp    801063 <strlcat+0x69>
+
+00000000008010a0 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8010a0:	48 85 d2             	test   %rdx,%rdx
+  8010a3:	74 2d                	je     8010d2 <memcmp+0x32>
+  8010a5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8010aa:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8010ae:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8010b3:	44 38 c1             	cmp    %r8b,%cl
+  8010b6:	75 0f                	jne    8010c7 <memcmp+0x27>
+    while (n-- > 0) {
+  8010b8:	48 83 c0 01          	add    $0x1,%rax
+  8010bc:	48 39 c2             	cmp    %rax,%rdx
+  8010bf:	75 e9                	jne    8010aa <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8010c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010c6:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8010c7:	0f b6 c1             	movzbl %cl,%eax
+  8010ca:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8010ce:	44 29 c0             	sub    %r8d,%eax
+  8010d1:	c3                   	ret
+    return 0;
+  8010d2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8010d7:	c3                   	ret
+
+00000000008010d8 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8010d8:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8010dc:	48 39 c7             	cmp    %rax,%rdi
+  8010df:	73 0f                	jae    8010f0 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8010e1:	40 38 37             	cmp    %sil,(%rdi)
+  8010e4:	74 0e                	je     8010f4 <memfind+0x1c>
+    for (; src < end; src++) {
+  8010e6:	48 83 c7 01          	add    $0x1,%rdi
+  8010ea:	48 39 f8             	cmp    %rdi,%rax
+  8010ed:	75 f2                	jne    8010e1 <memfind+0x9>
+  8010ef:	c3                   	ret
+  8010f0:	48 89 f8             	mov    %rdi,%rax
+  8010f3:	c3                   	ret
+  8010f4:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8010f7:	c3                   	ret
+
+00000000008010f8 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8010f8:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8010fb:	0f b6 37             	movzbl (%rdi),%esi
+  8010fe:	40 80 fe 20          	cmp    $0x20,%sil
+  801102:	74 06                	je     80110a <strtol+0x12>
+  801104:	40 80 fe 09          	cmp    $0x9,%sil
+  801108:	75 13                	jne    80111d <strtol+0x25>
+  80110a:	48 83 c7 01          	add    $0x1,%rdi
+  80110e:	0f b6 37             	movzbl (%rdi),%esi
+  801111:	40 80 fe 20          	cmp    $0x20,%sil
+  801115:	74 f3                	je     80110a <strtol+0x12>
+  801117:	40 80 fe 09          	cmp    $0x9,%sil
+  80111b:	74 ed                	je     80110a <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80111d:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801120:	83 e0 fd             	and    $0xfffffffd,%eax
+  801123:	3c 01                	cmp    $0x1,%al
+  801125:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801129:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80112f:	75 0f                	jne    801140 <strtol+0x48>
+  801131:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801134:	74 14                	je     80114a <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801136:	85 d2                	test   %edx,%edx
+  801138:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80113d:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  801140:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801145:	4c 63 ca             	movslq %edx,%r9
+  801148:	eb 36                	jmp    801180 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80114a:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80114e:	74 0f                	je     80115f <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801150:	85 d2                	test   %edx,%edx
+  801152:	75 ec                	jne    801140 <strtol+0x48>
+        s++;
+  801154:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801158:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80115d:	eb e1                	jmp    801140 <strtol+0x48>
+        s += 2;
+  80115f:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801163:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801168:	eb d6                	jmp    801140 <strtol+0x48>
+            dig -= '0';
+  80116a:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80116d:	44 0f b6 c1          	movzbl %cl,%r8d
+  801171:	41 39 d0             	cmp    %edx,%r8d
+  801174:	7d 21                	jge    801197 <strtol+0x9f>
+        val = val * base + dig;
+  801176:	49 0f af c1          	imul   %r9,%rax
+  80117a:	0f b6 c9             	movzbl %cl,%ecx
+  80117d:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801180:	48 83 c7 01          	add    $0x1,%rdi
+  801184:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801188:	80 f9 39             	cmp    $0x39,%cl
+  80118b:	76 dd                	jbe    80116a <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80118d:	80 f9 7b             	cmp    $0x7b,%cl
+  801190:	77 05                	ja     801197 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801192:	83 e9 57             	sub    $0x57,%ecx
+  801195:	eb d6                	jmp    80116d <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801197:	4d 85 d2             	test   %r10,%r10
+  80119a:	74 03                	je     80119f <strtol+0xa7>
+  80119c:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80119f:	48 89 c2             	mov    %rax,%rdx
+  8011a2:	48 f7 da             	neg    %rdx
+  8011a5:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8011a9:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8011ad:	c3                   	ret
+
+00000000008011ae <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8011ae:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011b8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8011ca:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8011cc:	c3                   	ret
+
+00000000008011cd <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011cd:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011d7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011ed:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f3:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f5:	c3                   	ret
+
+00000000008011f6 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8011f6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f9:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011fe:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801203:	ba 00 00 00 00       	mov    $0x0,%edx
+  801208:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801214:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80121a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80121c:	48 85 c0             	test   %rax,%rax
+  80121f:	7f 01                	jg     801222 <sys_env_destroy+0x2c>
+}
+  801221:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801222:	55                   	push   %rbp
+  801223:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801226:	49 89 c0             	mov    %rax,%r8
+  801229:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80122e:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801235:	00 00 00 
+  801238:	be 29 00 00 00       	mov    $0x29,%esi
+  80123d:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801244:	00 00 00 
+  801247:	b8 00 00 00 00       	mov    $0x0,%eax
+  80124c:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801253:	00 00 00 
+  801256:	41 ff d1             	call   *%r9
+
+0000000000801259 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801259:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80125e:	bf 00 00 00 00       	mov    $0x0,%edi
+  801263:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801268:	ba 00 00 00 00       	mov    $0x0,%edx
+  80126d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801273:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801279:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80127f:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801281:	c3                   	ret
+
+0000000000801282 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801282:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801287:	bf 00 00 00 00       	mov    $0x0,%edi
+  80128c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801291:	ba 00 00 00 00       	mov    $0x0,%edx
+  801296:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80129c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012a8:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8012aa:	c3                   	ret
+
+00000000008012ab <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012ab:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b0:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8012b7:	00 00 00 
+  8012ba:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012c0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012c6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012cc:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8012ce:	c3                   	ret
+
+00000000008012cf <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8012cf:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8012d2:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012d7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012dd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012e3:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8012e5:	c3                   	ret
+
+00000000008012e6 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8012e6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012e9:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ee:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012fd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012ff:	48 85 c0             	test   %rax,%rax
+  801302:	7f 01                	jg     801305 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801304:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801305:	55                   	push   %rbp
+  801306:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801309:	49 89 c0             	mov    %rax,%r8
+  80130c:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801311:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801318:	00 00 00 
+  80131b:	be 29 00 00 00       	mov    $0x29,%esi
+  801320:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801327:	00 00 00 
+  80132a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80132f:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801336:	00 00 00 
+  801339:	41 ff d1             	call   *%r9
+
+000000000080133c <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80133c:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80133f:	48 63 d2             	movslq %edx,%rdx
+  801342:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801345:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134a:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80134d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80134f:	48 85 c0             	test   %rax,%rax
+  801352:	7f 01                	jg     801355 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801354:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801355:	55                   	push   %rbp
+  801356:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801359:	49 89 c0             	mov    %rax,%r8
+  80135c:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801361:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801368:	00 00 00 
+  80136b:	be 29 00 00 00       	mov    $0x29,%esi
+  801370:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801377:	00 00 00 
+  80137a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80137f:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801386:	00 00 00 
+  801389:	41 ff d1             	call   *%r9
+
+000000000080138c <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80138c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80138f:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801394:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80139a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a8:	48 85 c0             	test   %rax,%rax
+  8013ab:	7f 01                	jg     8013ae <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8013ad:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8013ae:	55                   	push   %rbp
+  8013af:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b2:	49 89 c0             	mov    %rax,%r8
+  8013b5:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8013ba:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8013c1:	00 00 00 
+  8013c4:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c9:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8013d0:	00 00 00 
+  8013d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d8:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  8013df:	00 00 00 
+  8013e2:	41 ff d1             	call   *%r9
+
+00000000008013e5 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8013e5:	48 63 f6             	movslq %esi,%rsi
+  8013e8:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013eb:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013f0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013fb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801401:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801407:	0f 05                	syscall
+    if (check && ret > 0) {
+  801409:	48 85 c0             	test   %rax,%rax
+  80140c:	7f 01                	jg     80140f <sys_env_set_status+0x2a>
+}
+  80140e:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80140f:	55                   	push   %rbp
+  801410:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801413:	49 89 c0             	mov    %rax,%r8
+  801416:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80141b:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801422:	00 00 00 
+  801425:	be 29 00 00 00       	mov    $0x29,%esi
+  80142a:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801431:	00 00 00 
+  801434:	b8 00 00 00 00       	mov    $0x0,%eax
+  801439:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801440:	00 00 00 
+  801443:	41 ff d1             	call   *%r9
+
+0000000000801446 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801446:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801449:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80144e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801453:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801459:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80145f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801465:	0f 05                	syscall
+    if (check && ret > 0) {
+  801467:	48 85 c0             	test   %rax,%rax
+  80146a:	7f 01                	jg     80146d <sys_env_set_trapframe+0x27>
+}
+  80146c:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80146d:	55                   	push   %rbp
+  80146e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801471:	49 89 c0             	mov    %rax,%r8
+  801474:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801479:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801480:	00 00 00 
+  801483:	be 29 00 00 00       	mov    $0x29,%esi
+  801488:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  80148f:	00 00 00 
+  801492:	b8 00 00 00 00       	mov    $0x0,%eax
+  801497:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  80149e:	00 00 00 
+  8014a1:	41 ff d1             	call   *%r9
+
+00000000008014a4 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8014a4:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014a7:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014c5:	48 85 c0             	test   %rax,%rax
+  8014c8:	7f 01                	jg     8014cb <sys_env_set_pgfault_upcall+0x27>
+}
+  8014ca:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cf:	49 89 c0             	mov    %rax,%r8
+  8014d2:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8014d7:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8014de:	00 00 00 
+  8014e1:	be 29 00 00 00       	mov    $0x29,%esi
+  8014e6:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  8014ed:	00 00 00 
+  8014f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f5:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  8014fc:	00 00 00 
+  8014ff:	41 ff d1             	call   *%r9
+
+0000000000801502 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801502:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801505:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801508:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80150d:	4d 63 c0             	movslq %r8d,%r8
+  801510:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801516:	0f 05                	syscall
+}
+  801518:	c3                   	ret
+
+0000000000801519 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801519:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80151c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80151f:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801524:	4d 63 c0             	movslq %r8d,%r8
+  801527:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80152d:	0f 05                	syscall
+}
+  80152f:	c3                   	ret
+
+0000000000801530 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801530:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801535:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801538:	45 89 c0             	mov    %r8d,%r8d
+  80153b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801541:	0f 05                	syscall
+    if (check && ret > 0) {
+  801543:	48 85 c0             	test   %rax,%rax
+  801546:	7f 01                	jg     801549 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801548:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801549:	55                   	push   %rbp
+  80154a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80154d:	49 89 c0             	mov    %rax,%r8
+  801550:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801555:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  80155c:	00 00 00 
+  80155f:	be 29 00 00 00       	mov    $0x29,%esi
+  801564:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  80156b:	00 00 00 
+  80156e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801573:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  80157a:	00 00 00 
+  80157d:	41 ff d1             	call   *%r9
+
+0000000000801580 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801580:	55                   	push   %rbp
+  801581:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801584:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80158a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80158f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801594:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  80159b:	00 00 00 
+  80159e:	ff d0                	call   *%rax
+}
+  8015a0:	5d                   	pop    %rbp
+  8015a1:	c3                   	ret
+
+00000000008015a2 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015a2:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015a7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015ac:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015c8:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015ca:	c3                   	ret
+
+00000000008015cb <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8015cb:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8015d0:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015da:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015e0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015e6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015ec:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015ee:	48 85 c0             	test   %rax,%rax
+  8015f1:	7f 01                	jg     8015f4 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8015f3:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8015f4:	55                   	push   %rbp
+  8015f5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015f8:	49 89 c0             	mov    %rax,%r8
+  8015fb:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801600:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  801607:	00 00 00 
+  80160a:	be 29 00 00 00       	mov    $0x29,%esi
+  80160f:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801616:	00 00 00 
+  801619:	b8 00 00 00 00       	mov    $0x0,%eax
+  80161e:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801625:	00 00 00 
+  801628:	41 ff d1             	call   *%r9
+
+000000000080162b <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80162b:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801630:	bf 00 00 00 00       	mov    $0x0,%edi
+  801635:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80163a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80163f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801645:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80164b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801651:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801653:	c3                   	ret
+
+0000000000801654 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801654:	89 d2                	mov    %edx,%edx
+  801656:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801658:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80165d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801663:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801669:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80166f:	0f 05                	syscall
+}
+  801671:	c3                   	ret
+
+0000000000801672 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801672:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801675:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80167a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801685:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80168b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801691:	0f 05                	syscall
+}
+  801693:	c3                   	ret
+
+0000000000801694 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801694:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801697:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80169c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016a1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016b3:	0f 05                	syscall
+}
+  8016b5:	c3                   	ret
+
+00000000008016b6 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8016b6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016b9:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016be:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016c8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ce:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016d4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016da:	0f 05                	syscall
+    if (check && ret > 0) {
+  8016dc:	48 85 c0             	test   %rax,%rax
+  8016df:	7f 01                	jg     8016e2 <sys_irq_ack+0x2c>
+}
+  8016e1:	c3                   	ret
+sys_irq_ack(int irq) {
+  8016e2:	55                   	push   %rbp
+  8016e3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8016e6:	49 89 c0             	mov    %rax,%r8
+  8016e9:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8016ee:	48 ba 18 50 80 00 00 	movabs $0x805018,%rdx
+  8016f5:	00 00 00 
+  8016f8:	be 29 00 00 00       	mov    $0x29,%esi
+  8016fd:	48 bf 37 50 80 00 00 	movabs $0x805037,%rdi
+  801704:	00 00 00 
+  801707:	b8 00 00 00 00       	mov    $0x0,%eax
+  80170c:	49 b9 12 03 80 00 00 	movabs $0x800312,%r9
+  801713:	00 00 00 
+  801716:	41 ff d1             	call   *%r9
+
+0000000000801719 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801719:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801720:	ff ff ff 
+  801723:	48 01 f8             	add    %rdi,%rax
+  801726:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  80172a:	c3                   	ret
+
+000000000080172b <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80172b:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801732:	ff ff ff 
+  801735:	48 01 f8             	add    %rdi,%rax
+  801738:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80173c:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801742:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801746:	c3                   	ret
+
+0000000000801747 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801747:	55                   	push   %rbp
+  801748:	48 89 e5             	mov    %rsp,%rbp
+  80174b:	41 57                	push   %r15
+  80174d:	41 56                	push   %r14
+  80174f:	41 55                	push   %r13
+  801751:	41 54                	push   %r12
+  801753:	53                   	push   %rbx
+  801754:	48 83 ec 08          	sub    $0x8,%rsp
+  801758:	49 89 ff             	mov    %rdi,%r15
+  80175b:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801760:	49 bd 7a 40 80 00 00 	movabs $0x80407a,%r13
+  801767:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  80176a:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801770:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  801773:	48 89 df             	mov    %rbx,%rdi
+  801776:	41 ff d5             	call   *%r13
+  801779:	83 e0 04             	and    $0x4,%eax
+  80177c:	74 17                	je     801795 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  80177e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801785:	4c 39 f3             	cmp    %r14,%rbx
+  801788:	75 e6                	jne    801770 <fd_alloc+0x29>
+  80178a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801790:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801795:	4d 89 27             	mov    %r12,(%r15)
+}
+  801798:	48 83 c4 08          	add    $0x8,%rsp
+  80179c:	5b                   	pop    %rbx
+  80179d:	41 5c                	pop    %r12
+  80179f:	41 5d                	pop    %r13
+  8017a1:	41 5e                	pop    %r14
+  8017a3:	41 5f                	pop    %r15
+  8017a5:	5d                   	pop    %rbp
+  8017a6:	c3                   	ret
+
+00000000008017a7 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8017a7:	83 ff 1f             	cmp    $0x1f,%edi
+  8017aa:	77 39                	ja     8017e5 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8017ac:	55                   	push   %rbp
+  8017ad:	48 89 e5             	mov    %rsp,%rbp
+  8017b0:	41 54                	push   %r12
+  8017b2:	53                   	push   %rbx
+  8017b3:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8017b6:	48 63 df             	movslq %edi,%rbx
+  8017b9:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8017c0:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8017c4:	48 89 df             	mov    %rbx,%rdi
+  8017c7:	48 b8 7a 40 80 00 00 	movabs $0x80407a,%rax
+  8017ce:	00 00 00 
+  8017d1:	ff d0                	call   *%rax
+  8017d3:	a8 04                	test   $0x4,%al
+  8017d5:	74 14                	je     8017eb <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017d7:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017db:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017e0:	5b                   	pop    %rbx
+  8017e1:	41 5c                	pop    %r12
+  8017e3:	5d                   	pop    %rbp
+  8017e4:	c3                   	ret
+        return -E_INVAL;
+  8017e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017ea:	c3                   	ret
+        return -E_INVAL;
+  8017eb:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017f0:	eb ee                	jmp    8017e0 <fd_lookup+0x39>
+
+00000000008017f2 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017f2:	55                   	push   %rbp
+  8017f3:	48 89 e5             	mov    %rsp,%rbp
+  8017f6:	41 54                	push   %r12
+  8017f8:	53                   	push   %rbx
+  8017f9:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017fc:	48 b8 e0 50 80 00 00 	movabs $0x8050e0,%rax
+  801803:	00 00 00 
+  801806:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80180d:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801810:	39 3b                	cmp    %edi,(%rbx)
+  801812:	74 47                	je     80185b <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801814:	48 83 c0 08          	add    $0x8,%rax
+  801818:	48 8b 18             	mov    (%rax),%rbx
+  80181b:	48 85 db             	test   %rbx,%rbx
+  80181e:	75 f0                	jne    801810 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801820:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801827:	00 00 00 
+  80182a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801830:	89 fa                	mov    %edi,%edx
+  801832:	48 bf 48 50 80 00 00 	movabs $0x805048,%rdi
+  801839:	00 00 00 
+  80183c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801841:	48 b9 62 04 80 00 00 	movabs $0x800462,%rcx
+  801848:	00 00 00 
+  80184b:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80184d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801852:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801856:	5b                   	pop    %rbx
+  801857:	41 5c                	pop    %r12
+  801859:	5d                   	pop    %rbp
+  80185a:	c3                   	ret
+            return 0;
+  80185b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801860:	eb f0                	jmp    801852 <dev_lookup+0x60>
+
+0000000000801862 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801862:	55                   	push   %rbp
+  801863:	48 89 e5             	mov    %rsp,%rbp
+  801866:	41 55                	push   %r13
+  801868:	41 54                	push   %r12
+  80186a:	53                   	push   %rbx
+  80186b:	48 83 ec 18          	sub    $0x18,%rsp
+  80186f:	48 89 fb             	mov    %rdi,%rbx
+  801872:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801875:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  80187c:	ff ff ff 
+  80187f:	48 01 df             	add    %rbx,%rdi
+  801882:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801886:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80188a:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801891:	00 00 00 
+  801894:	ff d0                	call   *%rax
+  801896:	41 89 c5             	mov    %eax,%r13d
+  801899:	85 c0                	test   %eax,%eax
+  80189b:	78 06                	js     8018a3 <fd_close+0x41>
+  80189d:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8018a1:	74 1a                	je     8018bd <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8018a3:	45 84 e4             	test   %r12b,%r12b
+  8018a6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018ab:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8018af:	44 89 e8             	mov    %r13d,%eax
+  8018b2:	48 83 c4 18          	add    $0x18,%rsp
+  8018b6:	5b                   	pop    %rbx
+  8018b7:	41 5c                	pop    %r12
+  8018b9:	41 5d                	pop    %r13
+  8018bb:	5d                   	pop    %rbp
+  8018bc:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8018bd:	8b 3b                	mov    (%rbx),%edi
+  8018bf:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  8018c3:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  8018ca:	00 00 00 
+  8018cd:	ff d0                	call   *%rax
+  8018cf:	41 89 c5             	mov    %eax,%r13d
+  8018d2:	85 c0                	test   %eax,%eax
+  8018d4:	78 1b                	js     8018f1 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  8018d6:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018da:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018de:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018e4:	48 85 c0             	test   %rax,%rax
+  8018e7:	74 08                	je     8018f1 <fd_close+0x8f>
+  8018e9:	48 89 df             	mov    %rbx,%rdi
+  8018ec:	ff d0                	call   *%rax
+  8018ee:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018f1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018f6:	48 89 de             	mov    %rbx,%rsi
+  8018f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018fe:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  801905:	00 00 00 
+  801908:	ff d0                	call   *%rax
+    return res;
+  80190a:	eb a3                	jmp    8018af <fd_close+0x4d>
+
+000000000080190c <close>:
+
+int
+close(int fdnum) {
+  80190c:	55                   	push   %rbp
+  80190d:	48 89 e5             	mov    %rsp,%rbp
+  801910:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801914:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801918:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  80191f:	00 00 00 
+  801922:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801924:	85 c0                	test   %eax,%eax
+  801926:	78 15                	js     80193d <close+0x31>
+
+    return fd_close(fd, 1);
+  801928:	be 01 00 00 00       	mov    $0x1,%esi
+  80192d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801931:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  801938:	00 00 00 
+  80193b:	ff d0                	call   *%rax
+}
+  80193d:	c9                   	leave
+  80193e:	c3                   	ret
+
+000000000080193f <close_all>:
+
+void
+close_all(void) {
+  80193f:	55                   	push   %rbp
+  801940:	48 89 e5             	mov    %rsp,%rbp
+  801943:	41 54                	push   %r12
+  801945:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801946:	bb 00 00 00 00       	mov    $0x0,%ebx
+  80194b:	49 bc 0c 19 80 00 00 	movabs $0x80190c,%r12
+  801952:	00 00 00 
+  801955:	89 df                	mov    %ebx,%edi
+  801957:	41 ff d4             	call   *%r12
+  80195a:	83 c3 01             	add    $0x1,%ebx
+  80195d:	83 fb 20             	cmp    $0x20,%ebx
+  801960:	75 f3                	jne    801955 <close_all+0x16>
+}
+  801962:	5b                   	pop    %rbx
+  801963:	41 5c                	pop    %r12
+  801965:	5d                   	pop    %rbp
+  801966:	c3                   	ret
+
+0000000000801967 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801967:	55                   	push   %rbp
+  801968:	48 89 e5             	mov    %rsp,%rbp
+  80196b:	41 57                	push   %r15
+  80196d:	41 56                	push   %r14
+  80196f:	41 55                	push   %r13
+  801971:	41 54                	push   %r12
+  801973:	53                   	push   %rbx
+  801974:	48 83 ec 18          	sub    $0x18,%rsp
+  801978:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  80197b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80197f:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801986:	00 00 00 
+  801989:	ff d0                	call   *%rax
+  80198b:	89 c3                	mov    %eax,%ebx
+  80198d:	85 c0                	test   %eax,%eax
+  80198f:	0f 88 b8 00 00 00    	js     801a4d <dup+0xe6>
+    close(newfdnum);
+  801995:	44 89 e7             	mov    %r12d,%edi
+  801998:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  80199f:	00 00 00 
+  8019a2:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  8019a4:	4d 63 ec             	movslq %r12d,%r13
+  8019a7:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  8019ae:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  8019b2:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  8019b6:	4c 89 ff             	mov    %r15,%rdi
+  8019b9:	49 be 2b 17 80 00 00 	movabs $0x80172b,%r14
+  8019c0:	00 00 00 
+  8019c3:	41 ff d6             	call   *%r14
+  8019c6:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  8019c9:	4c 89 ef             	mov    %r13,%rdi
+  8019cc:	41 ff d6             	call   *%r14
+  8019cf:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  8019d2:	48 89 df             	mov    %rbx,%rdi
+  8019d5:	48 b8 7a 40 80 00 00 	movabs $0x80407a,%rax
+  8019dc:	00 00 00 
+  8019df:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019e1:	a8 04                	test   $0x4,%al
+  8019e3:	74 2b                	je     801a10 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019e5:	41 89 c1             	mov    %eax,%r9d
+  8019e8:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019ee:	4c 89 f1             	mov    %r14,%rcx
+  8019f1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f6:	48 89 de             	mov    %rbx,%rsi
+  8019f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019fe:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  801a05:	00 00 00 
+  801a08:	ff d0                	call   *%rax
+  801a0a:	89 c3                	mov    %eax,%ebx
+  801a0c:	85 c0                	test   %eax,%eax
+  801a0e:	78 4e                	js     801a5e <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801a10:	4c 89 ff             	mov    %r15,%rdi
+  801a13:	48 b8 7a 40 80 00 00 	movabs $0x80407a,%rax
+  801a1a:	00 00 00 
+  801a1d:	ff d0                	call   *%rax
+  801a1f:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801a22:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801a28:	4c 89 e9             	mov    %r13,%rcx
+  801a2b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801a30:	4c 89 fe             	mov    %r15,%rsi
+  801a33:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a38:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  801a3f:	00 00 00 
+  801a42:	ff d0                	call   *%rax
+  801a44:	89 c3                	mov    %eax,%ebx
+  801a46:	85 c0                	test   %eax,%eax
+  801a48:	78 14                	js     801a5e <dup+0xf7>
+
+    return newfdnum;
+  801a4a:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a4d:	89 d8                	mov    %ebx,%eax
+  801a4f:	48 83 c4 18          	add    $0x18,%rsp
+  801a53:	5b                   	pop    %rbx
+  801a54:	41 5c                	pop    %r12
+  801a56:	41 5d                	pop    %r13
+  801a58:	41 5e                	pop    %r14
+  801a5a:	41 5f                	pop    %r15
+  801a5c:	5d                   	pop    %rbp
+  801a5d:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a5e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a63:	4c 89 ee             	mov    %r13,%rsi
+  801a66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a6b:	49 bc 8c 13 80 00 00 	movabs $0x80138c,%r12
+  801a72:	00 00 00 
+  801a75:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a78:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a7d:	4c 89 f6             	mov    %r14,%rsi
+  801a80:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a85:	41 ff d4             	call   *%r12
+    return res;
+  801a88:	eb c3                	jmp    801a4d <dup+0xe6>
+
+0000000000801a8a <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a8a:	55                   	push   %rbp
+  801a8b:	48 89 e5             	mov    %rsp,%rbp
+  801a8e:	41 56                	push   %r14
+  801a90:	41 55                	push   %r13
+  801a92:	41 54                	push   %r12
+  801a94:	53                   	push   %rbx
+  801a95:	48 83 ec 10          	sub    $0x10,%rsp
+  801a99:	89 fb                	mov    %edi,%ebx
+  801a9b:	49 89 f4             	mov    %rsi,%r12
+  801a9e:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aa1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801aa5:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801aac:	00 00 00 
+  801aaf:	ff d0                	call   *%rax
+  801ab1:	85 c0                	test   %eax,%eax
+  801ab3:	78 4c                	js     801b01 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ab5:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801ab9:	41 8b 3e             	mov    (%r14),%edi
+  801abc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ac0:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	85 c0                	test   %eax,%eax
+  801ace:	78 35                	js     801b05 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801ad0:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801ad4:	83 e0 03             	and    $0x3,%eax
+  801ad7:	83 f8 01             	cmp    $0x1,%eax
+  801ada:	74 2d                	je     801b09 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801adc:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ae0:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801ae4:	48 85 c0             	test   %rax,%rax
+  801ae7:	74 56                	je     801b3f <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ae9:	4c 89 ea             	mov    %r13,%rdx
+  801aec:	4c 89 e6             	mov    %r12,%rsi
+  801aef:	4c 89 f7             	mov    %r14,%rdi
+  801af2:	ff d0                	call   *%rax
+}
+  801af4:	48 83 c4 10          	add    $0x10,%rsp
+  801af8:	5b                   	pop    %rbx
+  801af9:	41 5c                	pop    %r12
+  801afb:	41 5d                	pop    %r13
+  801afd:	41 5e                	pop    %r14
+  801aff:	5d                   	pop    %rbp
+  801b00:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b01:	48 98                	cltq
+  801b03:	eb ef                	jmp    801af4 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801b05:	48 98                	cltq
+  801b07:	eb eb                	jmp    801af4 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801b09:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801b10:	00 00 00 
+  801b13:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801b19:	89 da                	mov    %ebx,%edx
+  801b1b:	48 bf 89 50 80 00 00 	movabs $0x805089,%rdi
+  801b22:	00 00 00 
+  801b25:	b8 00 00 00 00       	mov    $0x0,%eax
+  801b2a:	48 b9 62 04 80 00 00 	movabs $0x800462,%rcx
+  801b31:	00 00 00 
+  801b34:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801b36:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b3d:	eb b5                	jmp    801af4 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b3f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b46:	eb ac                	jmp    801af4 <read+0x6a>
+
+0000000000801b48 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b48:	55                   	push   %rbp
+  801b49:	48 89 e5             	mov    %rsp,%rbp
+  801b4c:	41 57                	push   %r15
+  801b4e:	41 56                	push   %r14
+  801b50:	41 55                	push   %r13
+  801b52:	41 54                	push   %r12
+  801b54:	53                   	push   %rbx
+  801b55:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b59:	48 85 d2             	test   %rdx,%rdx
+  801b5c:	74 54                	je     801bb2 <readn+0x6a>
+  801b5e:	41 89 fd             	mov    %edi,%r13d
+  801b61:	49 89 f6             	mov    %rsi,%r14
+  801b64:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b67:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b6c:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b71:	49 bf 8a 1a 80 00 00 	movabs $0x801a8a,%r15
+  801b78:	00 00 00 
+  801b7b:	4c 89 e2             	mov    %r12,%rdx
+  801b7e:	48 29 f2             	sub    %rsi,%rdx
+  801b81:	4c 01 f6             	add    %r14,%rsi
+  801b84:	44 89 ef             	mov    %r13d,%edi
+  801b87:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b8a:	85 c0                	test   %eax,%eax
+  801b8c:	78 20                	js     801bae <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b8e:	01 c3                	add    %eax,%ebx
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	74 08                	je     801b9c <readn+0x54>
+  801b94:	48 63 f3             	movslq %ebx,%rsi
+  801b97:	4c 39 e6             	cmp    %r12,%rsi
+  801b9a:	72 df                	jb     801b7b <readn+0x33>
+    }
+    return res;
+  801b9c:	48 63 c3             	movslq %ebx,%rax
+}
+  801b9f:	48 83 c4 08          	add    $0x8,%rsp
+  801ba3:	5b                   	pop    %rbx
+  801ba4:	41 5c                	pop    %r12
+  801ba6:	41 5d                	pop    %r13
+  801ba8:	41 5e                	pop    %r14
+  801baa:	41 5f                	pop    %r15
+  801bac:	5d                   	pop    %rbp
+  801bad:	c3                   	ret
+        if (inc < 0) return inc;
+  801bae:	48 98                	cltq
+  801bb0:	eb ed                	jmp    801b9f <readn+0x57>
+    int inc = 1, res = 0;
+  801bb2:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801bb7:	eb e3                	jmp    801b9c <readn+0x54>
+
+0000000000801bb9 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801bb9:	55                   	push   %rbp
+  801bba:	48 89 e5             	mov    %rsp,%rbp
+  801bbd:	41 56                	push   %r14
+  801bbf:	41 55                	push   %r13
+  801bc1:	41 54                	push   %r12
+  801bc3:	53                   	push   %rbx
+  801bc4:	48 83 ec 10          	sub    $0x10,%rsp
+  801bc8:	89 fb                	mov    %edi,%ebx
+  801bca:	49 89 f4             	mov    %rsi,%r12
+  801bcd:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bd0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bd4:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801bdb:	00 00 00 
+  801bde:	ff d0                	call   *%rax
+  801be0:	85 c0                	test   %eax,%eax
+  801be2:	78 47                	js     801c2b <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801be4:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801be8:	41 8b 3e             	mov    (%r14),%edi
+  801beb:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bef:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 30                	js     801c2f <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bff:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801c04:	74 2d                	je     801c33 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c06:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c0a:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801c0e:	48 85 c0             	test   %rax,%rax
+  801c11:	74 56                	je     801c69 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801c13:	4c 89 ea             	mov    %r13,%rdx
+  801c16:	4c 89 e6             	mov    %r12,%rsi
+  801c19:	4c 89 f7             	mov    %r14,%rdi
+  801c1c:	ff d0                	call   *%rax
+}
+  801c1e:	48 83 c4 10          	add    $0x10,%rsp
+  801c22:	5b                   	pop    %rbx
+  801c23:	41 5c                	pop    %r12
+  801c25:	41 5d                	pop    %r13
+  801c27:	41 5e                	pop    %r14
+  801c29:	5d                   	pop    %rbp
+  801c2a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c2b:	48 98                	cltq
+  801c2d:	eb ef                	jmp    801c1e <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c2f:	48 98                	cltq
+  801c31:	eb eb                	jmp    801c1e <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c33:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801c3a:	00 00 00 
+  801c3d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c43:	89 da                	mov    %ebx,%edx
+  801c45:	48 bf a5 50 80 00 00 	movabs $0x8050a5,%rdi
+  801c4c:	00 00 00 
+  801c4f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c54:	48 b9 62 04 80 00 00 	movabs $0x800462,%rcx
+  801c5b:	00 00 00 
+  801c5e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c60:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c67:	eb b5                	jmp    801c1e <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c69:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c70:	eb ac                	jmp    801c1e <write+0x65>
+
+0000000000801c72 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c72:	55                   	push   %rbp
+  801c73:	48 89 e5             	mov    %rsp,%rbp
+  801c76:	41 54                	push   %r12
+  801c78:	53                   	push   %rbx
+  801c79:	48 83 ec 10          	sub    $0x10,%rsp
+  801c7d:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c7f:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c83:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801c8a:	00 00 00 
+  801c8d:	ff d0                	call   *%rax
+  801c8f:	85 c0                	test   %eax,%eax
+  801c91:	78 3e                	js     801cd1 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c93:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c97:	41 8b 3c 24          	mov    (%r12),%edi
+  801c9b:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c9f:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801ca6:	00 00 00 
+  801ca9:	ff d0                	call   *%rax
+  801cab:	85 c0                	test   %eax,%eax
+  801cad:	78 22                	js     801cd1 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801caf:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801cb3:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801cb7:	48 85 c0             	test   %rax,%rax
+  801cba:	74 0b                	je     801cc7 <seek+0x55>
+  801cbc:	89 de                	mov    %ebx,%esi
+  801cbe:	4c 89 e7             	mov    %r12,%rdi
+  801cc1:	ff d0                	call   *%rax
+  801cc3:	85 c0                	test   %eax,%eax
+  801cc5:	78 0a                	js     801cd1 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801cc7:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801ccc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801cd1:	48 83 c4 10          	add    $0x10,%rsp
+  801cd5:	5b                   	pop    %rbx
+  801cd6:	41 5c                	pop    %r12
+  801cd8:	5d                   	pop    %rbp
+  801cd9:	c3                   	ret
+
+0000000000801cda <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801cda:	55                   	push   %rbp
+  801cdb:	48 89 e5             	mov    %rsp,%rbp
+  801cde:	41 55                	push   %r13
+  801ce0:	41 54                	push   %r12
+  801ce2:	53                   	push   %rbx
+  801ce3:	48 83 ec 18          	sub    $0x18,%rsp
+  801ce7:	89 fb                	mov    %edi,%ebx
+  801ce9:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cec:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cf0:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801cf7:	00 00 00 
+  801cfa:	ff d0                	call   *%rax
+  801cfc:	85 c0                	test   %eax,%eax
+  801cfe:	78 38                	js     801d38 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d00:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801d04:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801d08:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d0c:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801d13:	00 00 00 
+  801d16:	ff d0                	call   *%rax
+  801d18:	85 c0                	test   %eax,%eax
+  801d1a:	78 1c                	js     801d38 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d1c:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801d21:	74 20                	je     801d43 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d23:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d27:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801d2b:	48 85 c0             	test   %rax,%rax
+  801d2e:	74 47                	je     801d77 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801d30:	44 89 e6             	mov    %r12d,%esi
+  801d33:	4c 89 ef             	mov    %r13,%rdi
+  801d36:	ff d0                	call   *%rax
+}
+  801d38:	48 83 c4 18          	add    $0x18,%rsp
+  801d3c:	5b                   	pop    %rbx
+  801d3d:	41 5c                	pop    %r12
+  801d3f:	41 5d                	pop    %r13
+  801d41:	5d                   	pop    %rbp
+  801d42:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d43:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801d4a:	00 00 00 
+  801d4d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d53:	89 da                	mov    %ebx,%edx
+  801d55:	48 bf 68 50 80 00 00 	movabs $0x805068,%rdi
+  801d5c:	00 00 00 
+  801d5f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d64:	48 b9 62 04 80 00 00 	movabs $0x800462,%rcx
+  801d6b:	00 00 00 
+  801d6e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d70:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d75:	eb c1                	jmp    801d38 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d77:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d7c:	eb ba                	jmp    801d38 <ftruncate+0x5e>
+
+0000000000801d7e <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	41 54                	push   %r12
+  801d84:	53                   	push   %rbx
+  801d85:	48 83 ec 10          	sub    $0x10,%rsp
+  801d89:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d8c:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d90:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  801d97:	00 00 00 
+  801d9a:	ff d0                	call   *%rax
+  801d9c:	85 c0                	test   %eax,%eax
+  801d9e:	78 4e                	js     801dee <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801da0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801da4:	41 8b 3c 24          	mov    (%r12),%edi
+  801da8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801dac:	48 b8 f2 17 80 00 00 	movabs $0x8017f2,%rax
+  801db3:	00 00 00 
+  801db6:	ff d0                	call   *%rax
+  801db8:	85 c0                	test   %eax,%eax
+  801dba:	78 32                	js     801dee <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dbc:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dc0:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801dc5:	74 30                	je     801df7 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801dc7:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801dca:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801dd1:	00 00 00 
+    stat->st_isdir = 0;
+  801dd4:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801ddb:	00 00 00 
+    stat->st_dev = dev;
+  801dde:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801de5:	48 89 de             	mov    %rbx,%rsi
+  801de8:	4c 89 e7             	mov    %r12,%rdi
+  801deb:	ff 50 28             	call   *0x28(%rax)
+}
+  801dee:	48 83 c4 10          	add    $0x10,%rsp
+  801df2:	5b                   	pop    %rbx
+  801df3:	41 5c                	pop    %r12
+  801df5:	5d                   	pop    %rbp
+  801df6:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801df7:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dfc:	eb f0                	jmp    801dee <fstat+0x70>
+
+0000000000801dfe <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801dfe:	55                   	push   %rbp
+  801dff:	48 89 e5             	mov    %rsp,%rbp
+  801e02:	41 54                	push   %r12
+  801e04:	53                   	push   %rbx
+  801e05:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801e08:	be 00 00 00 00       	mov    $0x0,%esi
+  801e0d:	48 b8 6c 2f 80 00 00 	movabs $0x802f6c,%rax
+  801e14:	00 00 00 
+  801e17:	ff d0                	call   *%rax
+  801e19:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801e1b:	85 c0                	test   %eax,%eax
+  801e1d:	78 25                	js     801e44 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801e1f:	4c 89 e6             	mov    %r12,%rsi
+  801e22:	89 c7                	mov    %eax,%edi
+  801e24:	48 b8 7e 1d 80 00 00 	movabs $0x801d7e,%rax
+  801e2b:	00 00 00 
+  801e2e:	ff d0                	call   *%rax
+  801e30:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801e33:	89 df                	mov    %ebx,%edi
+  801e35:	48 b8 0c 19 80 00 00 	movabs $0x80190c,%rax
+  801e3c:	00 00 00 
+  801e3f:	ff d0                	call   *%rax
+
+    return res;
+  801e41:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e44:	89 d8                	mov    %ebx,%eax
+  801e46:	5b                   	pop    %rbx
+  801e47:	41 5c                	pop    %r12
+  801e49:	5d                   	pop    %rbp
+  801e4a:	c3                   	ret
+
+0000000000801e4b <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e4b:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e52:	00 00 00 
+  801e55:	83 38 00             	cmpl   $0x0,(%rax)
+  801e58:	74 0a                	je     801e64 <fsenv+0x19>
+    return envid;
+}
+  801e5a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e61:	00 00 
+  801e63:	c3                   	ret
+fsenv(void) {
+  801e64:	55                   	push   %rbp
+  801e65:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e68:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e6d:	48 b8 dd 49 80 00 00 	movabs $0x8049dd,%rax
+  801e74:	00 00 00 
+  801e77:	ff d0                	call   *%rax
+  801e79:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e80:	00 00 
+}
+  801e82:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e89:	00 00 
+  801e8b:	5d                   	pop    %rbp
+  801e8c:	c3                   	ret
+
+0000000000801e8d <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e8d:	55                   	push   %rbp
+  801e8e:	48 89 e5             	mov    %rsp,%rbp
+  801e91:	41 54                	push   %r12
+  801e93:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e94:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e99:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e9e:	48 89 de             	mov    %rbx,%rsi
+  801ea1:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ea6:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  801ead:	00 00 00 
+  801eb0:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801eb2:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801eb9:	00 00 00 
+  801ebc:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ec2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801ec7:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801ecc:	48 89 de             	mov    %rbx,%rsi
+  801ecf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ed4:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  801edb:	00 00 00 
+  801ede:	ff d0                	call   *%rax
+  801ee0:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801ee2:	85 c0                	test   %eax,%eax
+  801ee4:	0f 88 a2 00 00 00    	js     801f8c <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801eea:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801ef1:	00 00 00 
+  801ef4:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801efa:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801eff:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801f01:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801f06:	49 bc 42 42 80 00 00 	movabs $0x804242,%r12
+  801f0d:	00 00 00 
+  801f10:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801f13:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801f18:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801f1b:	48 b8 4b 1e 80 00 00 	movabs $0x801e4b,%rax
+  801f22:	00 00 00 
+  801f25:	ff d0                	call   *%rax
+  801f27:	89 c7                	mov    %eax,%edi
+  801f29:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801f2f:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801f34:	48 89 da             	mov    %rbx,%rdx
+  801f37:	be 09 00 00 00       	mov    $0x9,%esi
+  801f3c:	48 b8 87 49 80 00 00 	movabs $0x804987,%rax
+  801f43:	00 00 00 
+  801f46:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801f48:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f4d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f52:	be 00 00 00 00       	mov    $0x0,%esi
+  801f57:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f5c:	48 b8 63 49 80 00 00 	movabs $0x804963,%rax
+  801f63:	00 00 00 
+  801f66:	ff d0                	call   *%rax
+  801f68:	89 c3                	mov    %eax,%ebx
+  801f6a:	85 c0                	test   %eax,%eax
+  801f6c:	78 25                	js     801f93 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801f6e:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801f75:	00 00 00 
+  801f78:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f7e:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f85:	00 00 
+    return 0;
+  801f87:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f8c:	89 d8                	mov    %ebx,%eax
+  801f8e:	5b                   	pop    %rbx
+  801f8f:	41 5c                	pop    %r12
+  801f91:	5d                   	pop    %rbp
+  801f92:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f93:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f98:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f9d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fa2:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  801fa9:	00 00 00 
+  801fac:	ff d0                	call   *%rax
+        return res;
+  801fae:	eb dc                	jmp    801f8c <fschan_setup+0xff>
+
+0000000000801fb0 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801fb0:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fb7:	00 00 00 
+  801fba:	80 38 00             	cmpb   $0x0,(%rax)
+  801fbd:	74 55                	je     802014 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fbf:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801fc6:	00 00 00 
+  801fc9:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801fcf:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fd4:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801fdb:	00 00 00 
+  801fde:	3b 0a                	cmp    (%rdx),%ecx
+  801fe0:	75 01                	jne    801fe3 <fschan+0x33>
+}
+  801fe2:	c3                   	ret
+fschan(void) {
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fe7:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+  801ff3:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801ff5:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801ffa:	85 d2                	test   %edx,%edx
+  801ffc:	78 02                	js     802000 <fschan+0x50>
+}
+  801ffe:	5d                   	pop    %rbp
+  801fff:	c3                   	ret
+        fschan_enabled = 0;
+  802000:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802007:	00 00 00 
+  80200a:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  80200d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802012:	eb ea                	jmp    801ffe <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802014:	b8 00 00 00 00       	mov    $0x0,%eax
+  802019:	c3                   	ret
+
+000000000080201a <fbuf>:
+fbuf(struct Fd *fd) {
+  80201a:	55                   	push   %rbp
+  80201b:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  80201e:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  80202a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80202f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802033:	77 12                	ja     802047 <fbuf+0x2d>
+  802035:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802039:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802040:	00 00 00 
+  802043:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802047:	48 89 d0             	mov    %rdx,%rax
+  80204a:	5d                   	pop    %rbp
+  80204b:	c3                   	ret
+
+000000000080204c <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  80204c:	55                   	push   %rbp
+  80204d:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802050:	48 83 c7 40          	add    $0x40,%rdi
+  802054:	48 b8 7c 42 80 00 00 	movabs $0x80427c,%rax
+  80205b:	00 00 00 
+  80205e:	ff d0                	call   *%rax
+  802060:	84 c0                	test   %al,%al
+  802062:	75 02                	jne    802066 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802064:	5d                   	pop    %rbp
+  802065:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802066:	48 b8 4b 1e 80 00 00 	movabs $0x801e4b,%rax
+  80206d:	00 00 00 
+  802070:	ff d0                	call   *%rax
+  802072:	89 c7                	mov    %eax,%edi
+  802074:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80207a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80207f:	ba 00 00 00 00       	mov    $0x0,%edx
+  802084:	be 0a 00 00 00       	mov    $0xa,%esi
+  802089:	48 b8 87 49 80 00 00 	movabs $0x804987,%rax
+  802090:	00 00 00 
+  802093:	ff d0                	call   *%rax
+}
+  802095:	eb cd                	jmp    802064 <fschan_publish+0x18>
+
+0000000000802097 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802097:	55                   	push   %rbp
+  802098:	48 89 e5             	mov    %rsp,%rbp
+  80209b:	41 57                	push   %r15
+  80209d:	41 56                	push   %r14
+  80209f:	41 55                	push   %r13
+  8020a1:	41 54                	push   %r12
+  8020a3:	53                   	push   %rbx
+  8020a4:	48 83 ec 48          	sub    $0x48,%rsp
+  8020a8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8020ac:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8020b0:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8020b3:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8020b7:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8020ba:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8020c1:	00 00 00 
+  8020c4:	8b 02                	mov    (%rdx),%eax
+  8020c6:	83 c0 01             	add    $0x1,%eax
+  8020c9:	b9 01 00 00 00       	mov    $0x1,%ecx
+  8020ce:	0f 44 c1             	cmove  %ecx,%eax
+  8020d1:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  8020d3:	4d 85 c0             	test   %r8,%r8
+  8020d6:	74 2c                	je     802104 <fschan_rw+0x6d>
+  8020d8:	45 89 ce             	mov    %r9d,%r14d
+  8020db:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8020e2:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8020e6:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8020ec:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8020f3:	00 
+  8020f4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020fa:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020ff:	e9 41 01 00 00       	jmp    802245 <fschan_rw+0x1ae>
+  802104:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802108:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80210c:	e9 9c 01 00 00       	jmp    8022ad <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802111:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802115:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802118:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  80211b:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80211e:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802122:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802126:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  80212a:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80212e:	48 89 da             	mov    %rbx,%rdx
+  802131:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80213d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802141:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  802148:	00 00 00 
+  80214b:	ff d0                	call   *%rax
+            queued += blk;
+  80214d:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802150:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802154:	4d 39 fc             	cmp    %r15,%r12
+  802157:	73 6b                	jae    8021c4 <fschan_rw+0x12d>
+  802159:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80215d:	77 65                	ja     8021c4 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80215f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802163:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802167:	48 b8 57 42 80 00 00 	movabs $0x804257,%rax
+  80216e:	00 00 00 
+  802171:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  802173:	4c 89 fb             	mov    %r15,%rbx
+  802176:	4c 29 e3             	sub    %r12,%rbx
+  802179:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  80217e:	48 39 d3             	cmp    %rdx,%rbx
+  802181:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802185:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802189:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  80218d:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802191:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  802194:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802196:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  80219d:	00 00 00 
+  8021a0:	8b 09                	mov    (%rcx),%ecx
+  8021a2:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8021a5:	83 fe 03             	cmp    $0x3,%esi
+  8021a8:	0f 85 63 ff ff ff    	jne    802111 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8021ae:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8021b2:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8021b5:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8021b8:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8021bb:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8021bf:	e9 79 ff ff ff       	jmp    80213d <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8021c4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8021c8:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  8021cf:	48 89 df             	mov    %rbx,%rdi
+  8021d2:	48 b8 1a 43 80 00 00 	movabs $0x80431a,%rax
+  8021d9:	00 00 00 
+  8021dc:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8021de:	48 89 df             	mov    %rbx,%rdi
+  8021e1:	48 b8 a8 42 80 00 00 	movabs $0x8042a8,%rax
+  8021e8:	00 00 00 
+  8021eb:	ff d0                	call   *%rax
+  8021ed:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8021f1:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8021f5:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8021f9:	75 25                	jne    802220 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8021fb:	8b 40 04             	mov    0x4(%rax),%eax
+  8021fe:	85 c0                	test   %eax,%eax
+  802200:	0f 88 86 00 00 00    	js     80228c <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802206:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80220a:	74 5b                	je     802267 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80220c:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802210:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802214:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802218:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80221c:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802220:	48 89 df             	mov    %rbx,%rdi
+  802223:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  80222a:	00 00 00 
+  80222d:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80222f:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802233:	83 f0 01             	xor    $0x1,%eax
+  802236:	4d 39 fc             	cmp    %r15,%r12
+  802239:	0f 92 c2             	setb   %dl
+  80223c:	84 c2                	test   %al,%dl
+  80223e:	75 05                	jne    802245 <fschan_rw+0x1ae>
+  802240:	45 85 ed             	test   %r13d,%r13d
+  802243:	74 50                	je     802295 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802245:	4d 39 fc             	cmp    %r15,%r12
+  802248:	0f 92 c1             	setb   %cl
+  80224b:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80224f:	0f 96 c2             	setbe  %dl
+  802252:	84 d1                	test   %dl,%cl
+  802254:	0f 84 6a ff ff ff    	je     8021c4 <fschan_rw+0x12d>
+  80225a:	84 c0                	test   %al,%al
+  80225c:	0f 85 fd fe ff ff    	jne    80215f <fschan_rw+0xc8>
+  802262:	e9 5d ff ff ff       	jmp    8021c4 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802267:	48 63 d0             	movslq %eax,%rdx
+  80226a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  80226e:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802272:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802276:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  80227a:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  80227e:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  802285:	00 00 00 
+  802288:	ff d0                	call   *%rax
+  80228a:	eb 80                	jmp    80220c <fschan_rw+0x175>
+                err = msg->fm_res;
+  80228c:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80228f:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  802293:	eb 8b                	jmp    802220 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802295:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80229a:	0f 85 68 fe ff ff    	jne    802108 <fschan_rw+0x71>
+  8022a0:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8022a3:	85 c0                	test   %eax,%eax
+  8022a5:	0f 84 5d fe ff ff    	je     802108 <fschan_rw+0x71>
+  8022ab:	48 98                	cltq
+}
+  8022ad:	48 83 c4 48          	add    $0x48,%rsp
+  8022b1:	5b                   	pop    %rbx
+  8022b2:	41 5c                	pop    %r12
+  8022b4:	41 5d                	pop    %r13
+  8022b6:	41 5e                	pop    %r14
+  8022b8:	41 5f                	pop    %r15
+  8022ba:	5d                   	pop    %rbp
+  8022bb:	c3                   	ret
+
+00000000008022bc <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8022bc:	55                   	push   %rbp
+  8022bd:	48 89 e5             	mov    %rsp,%rbp
+  8022c0:	41 56                	push   %r14
+  8022c2:	41 55                	push   %r13
+  8022c4:	41 54                	push   %r12
+  8022c6:	53                   	push   %rbx
+  8022c7:	48 83 ec 10          	sub    $0x10,%rsp
+  8022cb:	49 89 fe             	mov    %rdi,%r14
+  8022ce:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  8022d1:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8022d5:	48 29 f3             	sub    %rsi,%rbx
+  8022d8:	48 39 d3             	cmp    %rdx,%rbx
+  8022db:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8022df:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022e6:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8022e7:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8022ec:	49 bd d9 40 80 00 00 	movabs $0x8040d9,%r13
+  8022f3:	00 00 00 
+  8022f6:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8022fd:	76 1e                	jbe    80231d <mmap_fault+0x61>
+  8022ff:	4c 01 e7             	add    %r12,%rdi
+  802302:	41 ff d5             	call   *%r13
+  802305:	84 c0                	test   %al,%al
+  802307:	75 14                	jne    80231d <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802309:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80230d:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802314:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802318:	48 39 df             	cmp    %rbx,%rdi
+  80231b:	72 e2                	jb     8022ff <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80231d:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802324:	00 00 00 
+  802327:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80232e:	00 00 00 
+  802331:	4c 89 f0             	mov    %r14,%rax
+  802334:	48 29 d0             	sub    %rdx,%rax
+  802337:	48 c1 f8 03          	sar    $0x3,%rax
+  80233b:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802342:	aa aa aa 
+  802345:	48 0f af c2          	imul   %rdx,%rax
+  802349:	48 c1 e0 0c          	shl    $0xc,%rax
+  80234d:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802352:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802356:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802358:	44 89 e0             	mov    %r12d,%eax
+  80235b:	41 03 46 10          	add    0x10(%r14),%eax
+  80235f:	41 2b 06             	sub    (%r14),%eax
+  802362:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802365:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802369:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  80236d:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802371:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  802374:	48 b8 4b 1e 80 00 00 	movabs $0x801e4b,%rax
+  80237b:	00 00 00 
+  80237e:	ff d0                	call   *%rax
+  802380:	89 c7                	mov    %eax,%edi
+  802382:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802388:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80238d:	48 89 da             	mov    %rbx,%rdx
+  802390:	be 0f 00 00 00       	mov    $0xf,%esi
+  802395:	48 b8 87 49 80 00 00 	movabs $0x804987,%rax
+  80239c:	00 00 00 
+  80239f:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8023a1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023a6:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8023aa:	4c 89 e6             	mov    %r12,%rsi
+  8023ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8023b2:	48 b8 63 49 80 00 00 	movabs $0x804963,%rax
+  8023b9:	00 00 00 
+  8023bc:	ff d0                	call   *%rax
+  8023be:	48 98                	cltq
+}
+  8023c0:	48 83 c4 10          	add    $0x10,%rsp
+  8023c4:	5b                   	pop    %rbx
+  8023c5:	41 5c                	pop    %r12
+  8023c7:	41 5d                	pop    %r13
+  8023c9:	41 5e                	pop    %r14
+  8023cb:	5d                   	pop    %rbp
+  8023cc:	c3                   	ret
+
+00000000008023cd <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  8023cd:	48 8b 37             	mov    (%rdi),%rsi
+  8023d0:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8023d7:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023de:	00 00 00 
+  8023e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023e6:	eb 0f                	jmp    8023f7 <mmap_pgfault+0x2a>
+  8023e8:	c3                   	ret
+  8023e9:	48 83 c1 01          	add    $0x1,%rcx
+  8023ed:	48 83 c2 18          	add    $0x18,%rdx
+  8023f1:	48 83 f9 20          	cmp    $0x20,%rcx
+  8023f5:	74 6e                	je     802465 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023f7:	48 8b 02             	mov    (%rdx),%rax
+  8023fa:	48 83 e8 01          	sub    $0x1,%rax
+  8023fe:	48 39 f0             	cmp    %rsi,%rax
+  802401:	73 e6                	jae    8023e9 <mmap_pgfault+0x1c>
+  802403:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802407:	73 e0                	jae    8023e9 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802409:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80240d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802412:	f6 c2 01             	test   $0x1,%dl
+  802415:	75 d1                	jne    8023e8 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802417:	f6 c2 02             	test   $0x2,%dl
+  80241a:	74 1a                	je     802436 <mmap_pgfault+0x69>
+  80241c:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802420:	b8 00 00 00 00       	mov    $0x0,%eax
+  802425:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80242c:	00 00 00 
+  80242f:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802434:	74 35                	je     80246b <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802436:	55                   	push   %rbp
+  802437:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80243a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80243e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802445:	00 00 00 
+  802448:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80244c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802451:	48 b8 bc 22 80 00 00 	movabs $0x8022bc,%rax
+  802458:	00 00 00 
+  80245b:	ff d0                	call   *%rax
+  80245d:	48 85 c0             	test   %rax,%rax
+  802460:	0f 9f c0             	setg   %al
+}
+  802463:	5d                   	pop    %rbp
+  802464:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80246a:	c3                   	ret
+}
+  80246b:	c3                   	ret
+
+000000000080246c <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  80246c:	55                   	push   %rbp
+  80246d:	48 89 e5             	mov    %rsp,%rbp
+  802470:	41 54                	push   %r12
+  802472:	53                   	push   %rbx
+  802473:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802476:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80247d:	00 00 00 
+  802480:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802485:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802489:	74 15                	je     8024a0 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80248b:	48 83 c3 01          	add    $0x1,%rbx
+  80248f:	48 83 c0 18          	add    $0x18,%rax
+  802493:	48 83 fb 20          	cmp    $0x20,%rbx
+  802497:	75 ec                	jne    802485 <mmap_alloc+0x19>
+    return NULL;
+  802499:	b8 00 00 00 00       	mov    $0x0,%eax
+  80249e:	eb 52                	jmp    8024f2 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024a0:	4c 89 e7             	mov    %r12,%rdi
+  8024a3:	48 b8 7a 40 80 00 00 	movabs $0x80407a,%rax
+  8024aa:	00 00 00 
+  8024ad:	ff d0                	call   *%rax
+  8024af:	41 89 c1             	mov    %eax,%r9d
+  8024b2:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8024b9:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8024bd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8024c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8024c8:	4c 89 e6             	mov    %r12,%rsi
+  8024cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024d0:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  8024d7:	00 00 00 
+  8024da:	ff d0                	call   *%rax
+  8024dc:	85 c0                	test   %eax,%eax
+  8024de:	78 17                	js     8024f7 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8024e0:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8024e4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024eb:	00 00 00 
+  8024ee:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8024f2:	5b                   	pop    %rbx
+  8024f3:	41 5c                	pop    %r12
+  8024f5:	5d                   	pop    %rbp
+  8024f6:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024fc:	eb f4                	jmp    8024f2 <mmap_alloc+0x86>
+
+00000000008024fe <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8024fe:	55                   	push   %rbp
+  8024ff:	48 89 e5             	mov    %rsp,%rbp
+  802502:	41 56                	push   %r14
+  802504:	41 55                	push   %r13
+  802506:	41 54                	push   %r12
+  802508:	53                   	push   %rbx
+  802509:	48 83 ec 10          	sub    $0x10,%rsp
+  80250d:	41 89 fc             	mov    %edi,%r12d
+  802510:	49 89 f5             	mov    %rsi,%r13
+  802513:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802516:	48 89 f0             	mov    %rsi,%rax
+  802519:	48 09 d0             	or     %rdx,%rax
+  80251c:	75 0d                	jne    80252b <fsipc+0x2d>
+  80251e:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802521:	83 f8 04             	cmp    $0x4,%eax
+  802524:	76 7d                	jbe    8025a3 <fsipc+0xa5>
+  802526:	83 ff 0d             	cmp    $0xd,%edi
+  802529:	74 78                	je     8025a3 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  80252b:	48 b8 4b 1e 80 00 00 	movabs $0x801e4b,%rax
+  802532:	00 00 00 
+  802535:	ff d0                	call   *%rax
+  802537:	89 c7                	mov    %eax,%edi
+  802539:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802540:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802547:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80254e:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802554:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  80255b:	00 00 00 
+  80255e:	44 89 e6             	mov    %r12d,%esi
+  802561:	48 b8 87 49 80 00 00 	movabs $0x804987,%rax
+  802568:	00 00 00 
+  80256b:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  80256d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802574:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802575:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257a:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80257e:	4c 89 ee             	mov    %r13,%rsi
+  802581:	bf 00 00 00 00       	mov    $0x0,%edi
+  802586:	48 b8 63 49 80 00 00 	movabs $0x804963,%rax
+  80258d:	00 00 00 
+  802590:	ff d0                	call   *%rax
+  802592:	89 c3                	mov    %eax,%ebx
+}
+  802594:	89 d8                	mov    %ebx,%eax
+  802596:	48 83 c4 10          	add    $0x10,%rsp
+  80259a:	5b                   	pop    %rbx
+  80259b:	41 5c                	pop    %r12
+  80259d:	41 5d                	pop    %r13
+  80259f:	41 5e                	pop    %r14
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8025a3:	48 b8 b0 1f 80 00 00 	movabs $0x801fb0,%rax
+  8025aa:	00 00 00 
+  8025ad:	ff d0                	call   *%rax
+  8025af:	49 89 c6             	mov    %rax,%r14
+  8025b2:	48 85 c0             	test   %rax,%rax
+  8025b5:	0f 84 70 ff ff ff    	je     80252b <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8025bb:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8025bf:	48 b8 57 42 80 00 00 	movabs $0x804257,%rax
+  8025c6:	00 00 00 
+  8025c9:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  8025cb:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  8025ce:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8025d5:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8025d9:	ba 10 00 00 00       	mov    $0x10,%edx
+  8025de:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8025e5:	00 00 00 
+  8025e8:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8025f4:	4c 89 f7             	mov    %r14,%rdi
+  8025f7:	48 b8 4c 20 80 00 00 	movabs $0x80204c,%rax
+  8025fe:	00 00 00 
+  802601:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802603:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80260a:	4c 89 f7             	mov    %r14,%rdi
+  80260d:	48 b8 1a 43 80 00 00 	movabs $0x80431a,%rax
+  802614:	00 00 00 
+  802617:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802619:	4c 89 f7             	mov    %r14,%rdi
+  80261c:	48 b8 a8 42 80 00 00 	movabs $0x8042a8,%rax
+  802623:	00 00 00 
+  802626:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802628:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  80262b:	41 83 fc 05          	cmp    $0x5,%r12d
+  80262f:	75 04                	jne    802635 <fsipc+0x137>
+  802631:	85 db                	test   %ebx,%ebx
+  802633:	79 14                	jns    802649 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802635:	4c 89 f7             	mov    %r14,%rdi
+  802638:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  80263f:	00 00 00 
+  802642:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802644:	e9 4b ff ff ff       	jmp    802594 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802649:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80264d:	ba 88 00 00 00       	mov    $0x88,%edx
+  802652:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802659:	00 00 00 
+  80265c:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  802663:	00 00 00 
+  802666:	ff d0                	call   *%rax
+  802668:	eb cb                	jmp    802635 <fsipc+0x137>
+
+000000000080266a <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  80266a:	55                   	push   %rbp
+  80266b:	48 89 e5             	mov    %rsp,%rbp
+  80266e:	41 57                	push   %r15
+  802670:	41 56                	push   %r14
+  802672:	41 55                	push   %r13
+  802674:	41 54                	push   %r12
+  802676:	53                   	push   %rbx
+  802677:	48 83 ec 18          	sub    $0x18,%rsp
+  80267b:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80267f:	49 89 f6             	mov    %rsi,%r14
+  802682:	49 89 d4             	mov    %rdx,%r12
+  802685:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802688:	48 b8 b0 1f 80 00 00 	movabs $0x801fb0,%rax
+  80268f:	00 00 00 
+  802692:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802694:	48 85 c0             	test   %rax,%rax
+  802697:	0f 85 96 00 00 00    	jne    802733 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  80269d:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8026a4:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026a5:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8026ac:	00 00 00 
+    while (n) {
+  8026af:	4d 85 e4             	test   %r12,%r12
+  8026b2:	74 79                	je     80272d <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8026b4:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8026b9:	49 39 dc             	cmp    %rbx,%r12
+  8026bc:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8026c0:	48 89 da             	mov    %rbx,%rdx
+  8026c3:	4c 89 f6             	mov    %r14,%rsi
+  8026c6:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  8026cd:	00 00 00 
+  8026d0:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026dc:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026e0:	8b 40 0c             	mov    0xc(%rax),%eax
+  8026e3:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8026e6:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8026e9:	44 01 e8             	add    %r13d,%eax
+  8026ec:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8026f0:	41 0f 44 c5          	cmove  %r13d,%eax
+  8026f4:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8026f8:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8026fc:	48 89 da             	mov    %rbx,%rdx
+  8026ff:	be 00 00 00 00       	mov    $0x0,%esi
+  802704:	bf 04 00 00 00       	mov    $0x4,%edi
+  802709:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+        if (res < 0)
+  802715:	85 c0                	test   %eax,%eax
+  802717:	78 4a                	js     802763 <devfile_write_direct+0xf9>
+        buf += res;
+  802719:	48 98                	cltq
+  80271b:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80271e:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802722:	49 29 c4             	sub    %rax,%r12
+  802725:	75 8d                	jne    8026b4 <devfile_write_direct+0x4a>
+    return write;
+  802727:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80272b:	eb 27                	jmp    802754 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80272d:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802731:	eb f4                	jmp    802727 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802733:	45 89 e9             	mov    %r13d,%r9d
+  802736:	4d 89 e0             	mov    %r12,%r8
+  802739:	4c 89 f1             	mov    %r14,%rcx
+  80273c:	ba 04 00 00 00       	mov    $0x4,%edx
+  802741:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802745:	48 89 c7             	mov    %rax,%rdi
+  802748:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  80274f:	00 00 00 
+  802752:	ff d0                	call   *%rax
+}
+  802754:	48 83 c4 18          	add    $0x18,%rsp
+  802758:	5b                   	pop    %rbx
+  802759:	41 5c                	pop    %r12
+  80275b:	41 5d                	pop    %r13
+  80275d:	41 5e                	pop    %r14
+  80275f:	41 5f                	pop    %r15
+  802761:	5d                   	pop    %rbp
+  802762:	c3                   	ret
+            return res;
+  802763:	48 98                	cltq
+  802765:	eb ed                	jmp    802754 <devfile_write_direct+0xea>
+
+0000000000802767 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802767:	55                   	push   %rbp
+  802768:	48 89 e5             	mov    %rsp,%rbp
+  80276b:	41 54                	push   %r12
+  80276d:	53                   	push   %rbx
+  80276e:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802771:	48 b8 1a 20 80 00 00 	movabs $0x80201a,%rax
+  802778:	00 00 00 
+  80277b:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  80277d:	48 85 c0             	test   %rax,%rax
+  802780:	74 71                	je     8027f3 <fbuf_flush+0x8c>
+  802782:	48 89 c3             	mov    %rax,%rbx
+  802785:	b8 00 00 00 00       	mov    $0x0,%eax
+  80278a:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  80278e:	75 05                	jne    802795 <fbuf_flush+0x2e>
+}
+  802790:	5b                   	pop    %rbx
+  802791:	41 5c                	pop    %r12
+  802793:	5d                   	pop    %rbp
+  802794:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802795:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802798:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80279c:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8027a3:	00 00 00 
+  8027a6:	48 89 de             	mov    %rbx,%rsi
+  8027a9:	48 29 c6             	sub    %rax,%rsi
+  8027ac:	48 c1 fe 03          	sar    $0x3,%rsi
+  8027b0:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8027b7:	aa aa aa 
+  8027ba:	48 0f af f0          	imul   %rax,%rsi
+  8027be:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8027c2:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8027c7:	48 01 c6             	add    %rax,%rsi
+  8027ca:	4c 89 e7             	mov    %r12,%rdi
+  8027cd:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  8027d4:	00 00 00 
+  8027d7:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8027d9:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8027dd:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8027e4:	00 
+    return res < 0 ? res : 0;
+  8027e5:	48 85 c0             	test   %rax,%rax
+  8027e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027ed:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8027f1:	eb 9d                	jmp    802790 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8027f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027f8:	eb 96                	jmp    802790 <fbuf_flush+0x29>
+
+00000000008027fa <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8027fa:	55                   	push   %rbp
+  8027fb:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8027fe:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  802805:	00 00 00 
+  802808:	ff d0                	call   *%rax
+}
+  80280a:	5d                   	pop    %rbp
+  80280b:	c3                   	ret
+
+000000000080280c <devfile_write>:
+    if (!fd || !buf)
+  80280c:	48 85 ff             	test   %rdi,%rdi
+  80280f:	0f 84 d3 01 00 00    	je     8029e8 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802815:	55                   	push   %rbp
+  802816:	48 89 e5             	mov    %rsp,%rbp
+  802819:	41 57                	push   %r15
+  80281b:	41 56                	push   %r14
+  80281d:	41 55                	push   %r13
+  80281f:	41 54                	push   %r12
+  802821:	53                   	push   %rbx
+  802822:	48 83 ec 08          	sub    $0x8,%rsp
+  802826:	49 89 fc             	mov    %rdi,%r12
+  802829:	49 89 f6             	mov    %rsi,%r14
+  80282c:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80282f:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802834:	48 85 f6             	test   %rsi,%rsi
+  802837:	0f 84 9c 01 00 00    	je     8029d9 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80283d:	48 b8 1a 20 80 00 00 	movabs $0x80201a,%rax
+  802844:	00 00 00 
+  802847:	ff d0                	call   *%rax
+  802849:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  80284c:	48 85 c0             	test   %rax,%rax
+  80284f:	0f 84 a2 00 00 00    	je     8028f7 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802855:	be 00 10 00 00       	mov    $0x1000,%esi
+  80285a:	4c 89 e7             	mov    %r12,%rdi
+  80285d:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  802864:	00 00 00 
+  802867:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802869:	83 f8 02             	cmp    $0x2,%eax
+  80286c:	0f 8f 85 00 00 00    	jg     8028f7 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802872:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802879:	00 00 00 
+  80287c:	4d 89 ef             	mov    %r13,%r15
+  80287f:	49 29 c7             	sub    %rax,%r15
+  802882:	49 c1 ff 03          	sar    $0x3,%r15
+  802886:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80288d:	aa aa aa 
+  802890:	4c 0f af f8          	imul   %rax,%r15
+  802894:	49 c1 e7 0e          	shl    $0xe,%r15
+  802898:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80289d:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8028a0:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028a5:	0f 84 d7 00 00 00    	je     802982 <devfile_write+0x176>
+  8028ab:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8028af:	89 c2                	mov    %eax,%edx
+  8028b1:	41 03 55 0c          	add    0xc(%r13),%edx
+  8028b5:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8028ba:	75 0f                	jne    8028cb <devfile_write+0xbf>
+  8028bc:	48 01 d8             	add    %rbx,%rax
+  8028bf:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  8028c5:	0f 86 92 00 00 00    	jbe    80295d <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028cb:	4c 89 e7             	mov    %r12,%rdi
+  8028ce:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8028d5:	00 00 00 
+  8028d8:	ff d0                	call   *%rax
+  8028da:	85 c0                	test   %eax,%eax
+  8028dc:	78 52                	js     802930 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028de:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028e5:	77 7f                	ja     802966 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8028e7:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028ec:	0f 85 c2 00 00 00    	jne    8029b4 <devfile_write+0x1a8>
+  8028f2:	e9 94 00 00 00       	jmp    80298b <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8028f7:	4c 89 e7             	mov    %r12,%rdi
+  8028fa:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  802901:	00 00 00 
+  802904:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802906:	85 c0                	test   %eax,%eax
+  802908:	79 07                	jns    802911 <devfile_write+0x105>
+  80290a:	48 98                	cltq
+  80290c:	e9 c8 00 00 00       	jmp    8029d9 <devfile_write+0x1cd>
+  802911:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802916:	48 89 da             	mov    %rbx,%rdx
+  802919:	4c 89 f6             	mov    %r14,%rsi
+  80291c:	4c 89 e7             	mov    %r12,%rdi
+  80291f:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  802926:	00 00 00 
+  802929:	ff d0                	call   *%rax
+  80292b:	e9 a9 00 00 00       	jmp    8029d9 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802930:	48 98                	cltq
+  802932:	e9 a2 00 00 00       	jmp    8029d9 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802937:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80293c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802941:	4c 89 fe             	mov    %r15,%rsi
+  802944:	bf 00 00 00 00       	mov    $0x0,%edi
+  802949:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  802950:	00 00 00 
+  802953:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802955:	85 c0                	test   %eax,%eax
+  802957:	79 45                	jns    80299e <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802959:	48 98                	cltq
+  80295b:	eb 7c                	jmp    8029d9 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80295d:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802964:	76 4e                	jbe    8029b4 <devfile_write+0x1a8>
+  802966:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80296b:	48 89 da             	mov    %rbx,%rdx
+  80296e:	4c 89 f6             	mov    %r14,%rsi
+  802971:	4c 89 e7             	mov    %r12,%rdi
+  802974:	48 b8 6a 26 80 00 00 	movabs $0x80266a,%rax
+  80297b:	00 00 00 
+  80297e:	ff d0                	call   *%rax
+  802980:	eb 57                	jmp    8029d9 <devfile_write+0x1cd>
+  802982:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802989:	77 db                	ja     802966 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  80298b:	4c 89 ff             	mov    %r15,%rdi
+  80298e:	48 b8 d9 40 80 00 00 	movabs $0x8040d9,%rax
+  802995:	00 00 00 
+  802998:	ff d0                	call   *%rax
+  80299a:	84 c0                	test   %al,%al
+  80299c:	74 99                	je     802937 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  80299e:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  8029a3:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8029a8:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  8029ac:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  8029b3:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  8029b4:	4c 89 ff             	mov    %r15,%rdi
+  8029b7:	49 03 7d 10          	add    0x10(%r13),%rdi
+  8029bb:	48 89 da             	mov    %rbx,%rdx
+  8029be:	4c 89 f6             	mov    %r14,%rsi
+  8029c1:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  8029cd:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  8029d1:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  8029d6:	48 89 d8             	mov    %rbx,%rax
+}
+  8029d9:	48 83 c4 08          	add    $0x8,%rsp
+  8029dd:	5b                   	pop    %rbx
+  8029de:	41 5c                	pop    %r12
+  8029e0:	41 5d                	pop    %r13
+  8029e2:	41 5e                	pop    %r14
+  8029e4:	41 5f                	pop    %r15
+  8029e6:	5d                   	pop    %rbp
+  8029e7:	c3                   	ret
+        return E_INVAL;
+  8029e8:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029ed:	c3                   	ret
+
+00000000008029ee <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029ee:	55                   	push   %rbp
+  8029ef:	48 89 e5             	mov    %rsp,%rbp
+  8029f2:	41 54                	push   %r12
+  8029f4:	53                   	push   %rbx
+  8029f5:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8029f8:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  8029ff:	00 00 00 
+  802a02:	ff d0                	call   *%rax
+  802a04:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802a07:	48 89 df             	mov    %rbx,%rdi
+  802a0a:	48 b8 1a 20 80 00 00 	movabs $0x80201a,%rax
+  802a11:	00 00 00 
+  802a14:	ff d0                	call   *%rax
+  802a16:	48 85 c0             	test   %rax,%rax
+  802a19:	74 17                	je     802a32 <devfile_flush+0x44>
+  802a1b:	48 89 df             	mov    %rbx,%rdi
+  802a1e:	48 b8 1a 20 80 00 00 	movabs $0x80201a,%rax
+  802a25:	00 00 00 
+  802a28:	ff d0                	call   *%rax
+  802a2a:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802a31:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802a32:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802a35:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802a3c:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802a3e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a43:	be 00 00 00 00       	mov    $0x0,%esi
+  802a48:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a4d:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802a54:	00 00 00 
+  802a57:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a59:	45 85 e4             	test   %r12d,%r12d
+  802a5c:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a60:	5b                   	pop    %rbx
+  802a61:	41 5c                	pop    %r12
+  802a63:	5d                   	pop    %rbp
+  802a64:	c3                   	ret
+
+0000000000802a65 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a65:	55                   	push   %rbp
+  802a66:	48 89 e5             	mov    %rsp,%rbp
+  802a69:	41 57                	push   %r15
+  802a6b:	41 56                	push   %r14
+  802a6d:	41 55                	push   %r13
+  802a6f:	41 54                	push   %r12
+  802a71:	53                   	push   %rbx
+  802a72:	48 83 ec 38          	sub    $0x38,%rsp
+  802a76:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a7a:	49 89 f7             	mov    %rsi,%r15
+  802a7d:	48 89 d3             	mov    %rdx,%rbx
+  802a80:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a83:	48 b8 b0 1f 80 00 00 	movabs $0x801fb0,%rax
+  802a8a:	00 00 00 
+  802a8d:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a8f:	48 85 c0             	test   %rax,%rax
+  802a92:	75 20                	jne    802ab4 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a94:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a99:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802aa0:	00 
+    while (n) {
+  802aa1:	48 85 db             	test   %rbx,%rbx
+  802aa4:	0f 85 df 00 00 00    	jne    802b89 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802aaa:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802aae:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ab2:	eb 21                	jmp    802ad5 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ab4:	45 89 f1             	mov    %r14d,%r9d
+  802ab7:	49 89 d8             	mov    %rbx,%r8
+  802aba:	4c 89 f9             	mov    %r15,%rcx
+  802abd:	ba 03 00 00 00       	mov    $0x3,%edx
+  802ac2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802ac6:	48 89 c7             	mov    %rax,%rdi
+  802ac9:	48 b8 97 20 80 00 00 	movabs $0x802097,%rax
+  802ad0:	00 00 00 
+  802ad3:	ff d0                	call   *%rax
+}
+  802ad5:	48 83 c4 38          	add    $0x38,%rsp
+  802ad9:	5b                   	pop    %rbx
+  802ada:	41 5c                	pop    %r12
+  802adc:	41 5d                	pop    %r13
+  802ade:	41 5e                	pop    %r14
+  802ae0:	41 5f                	pop    %r15
+  802ae2:	5d                   	pop    %rbp
+  802ae3:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ae4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ae8:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802aee:	75 1e                	jne    802b0e <devfile_read_direct+0xa9>
+  802af0:	e9 e2 00 00 00       	jmp    802bd7 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802af5:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802af9:	eb da                	jmp    802ad5 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802afb:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802aff:	0f 85 d0 01 00 00    	jne    802cd5 <devfile_read_direct+0x270>
+            map = 0;
+  802b05:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802b09:	eb 03                	jmp    802b0e <devfile_read_direct+0xa9>
+  802b0b:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802b0e:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802b13:	48 39 d3             	cmp    %rdx,%rbx
+  802b16:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802b1a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802b1e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802b21:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802b28:	00 00 00 
+  802b2b:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802b2d:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802b31:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802b35:	be 00 00 00 00       	mov    $0x0,%esi
+  802b3a:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b3f:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+        if (res <= 0)
+  802b4b:	85 c0                	test   %eax,%eax
+  802b4d:	0f 8e 63 01 00 00    	jle    802cb6 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b53:	4c 63 e0             	movslq %eax,%r12
+  802b56:	4c 89 e2             	mov    %r12,%rdx
+  802b59:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b60:	00 00 00 
+  802b63:	4c 89 ff             	mov    %r15,%rdi
+  802b66:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  802b6d:	00 00 00 
+  802b70:	ff d0                	call   *%rax
+        buf += res;
+  802b72:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b75:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b78:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b7c:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b80:	48 85 db             	test   %rbx,%rbx
+  802b83:	0f 84 25 ff ff ff    	je     802aae <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b89:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b8c:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b90:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b94:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b98:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b9f:	0f 97 c2             	seta   %dl
+  802ba2:	20 c2                	and    %al,%dl
+  802ba4:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802ba7:	0f 84 5e ff ff ff    	je     802b0b <devfile_read_direct+0xa6>
+  802bad:	4c 89 fa             	mov    %r15,%rdx
+  802bb0:	4d 89 fd             	mov    %r15,%r13
+  802bb3:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802bba:	0f 85 4e ff ff ff    	jne    802b0e <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802bc0:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802bc4:	0f 84 1a ff ff ff    	je     802ae4 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802bca:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802bd1:	0f 85 37 ff ff ff    	jne    802b0e <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802bd7:	48 89 d8             	mov    %rbx,%rax
+  802bda:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802be0:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802be5:	48 39 c8             	cmp    %rcx,%rax
+  802be8:	48 0f 47 c1          	cmova  %rcx,%rax
+  802bec:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802bf0:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802bf4:	49 89 d4             	mov    %rdx,%r12
+  802bf7:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802bfb:	48 b8 7a 40 80 00 00 	movabs $0x80407a,%rax
+  802c02:	00 00 00 
+  802c05:	ff d0                	call   *%rax
+  802c07:	a8 40                	test   $0x40,%al
+  802c09:	0f 85 b9 00 00 00    	jne    802cc8 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802c0f:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802c16:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802c1a:	49 39 c5             	cmp    %rax,%r13
+  802c1d:	72 d8                	jb     802bf7 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c1f:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c23:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c2a:	00 00 00 
+  802c2d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c31:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802c34:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802c36:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802c3a:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802c3e:	48 b8 4b 1e 80 00 00 	movabs $0x801e4b,%rax
+  802c45:	00 00 00 
+  802c48:	ff d0                	call   *%rax
+  802c4a:	89 c7                	mov    %eax,%edi
+  802c4c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c52:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c57:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c5e:	00 00 00 
+  802c61:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c66:	48 b8 87 49 80 00 00 	movabs $0x804987,%rax
+  802c6d:	00 00 00 
+  802c70:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802c72:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c77:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c7b:	4c 89 fe             	mov    %r15,%rsi
+  802c7e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c83:	48 b8 63 49 80 00 00 	movabs $0x804963,%rax
+  802c8a:	00 00 00 
+  802c8d:	ff d0                	call   *%rax
+  802c8f:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c92:	48 85 d2             	test   %rdx,%rdx
+  802c95:	0f 84 5a fe ff ff    	je     802af5 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c9b:	0f 8e 5a fe ff ff    	jle    802afb <devfile_read_direct+0x96>
+                buf += res;
+  802ca1:	48 98                	cltq
+  802ca3:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802ca6:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802ca9:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802cad:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802cb1:	e9 ca fe ff ff       	jmp    802b80 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802cb6:	41 89 c5             	mov    %eax,%r13d
+  802cb9:	48 98                	cltq
+  802cbb:	45 85 ed             	test   %r13d,%r13d
+  802cbe:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802cc3:	e9 0d fe ff ff       	jmp    802ad5 <devfile_read_direct+0x70>
+            map = 0;
+  802cc8:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802ccc:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cd0:	e9 39 fe ff ff       	jmp    802b0e <devfile_read_direct+0xa9>
+  802cd5:	48 89 d0             	mov    %rdx,%rax
+  802cd8:	e9 f8 fd ff ff       	jmp    802ad5 <devfile_read_direct+0x70>
+
+0000000000802cdd <devfile_read>:
+    if (!fd || !buf)
+  802cdd:	48 85 ff             	test   %rdi,%rdi
+  802ce0:	0f 84 21 02 00 00    	je     802f07 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802ce6:	55                   	push   %rbp
+  802ce7:	48 89 e5             	mov    %rsp,%rbp
+  802cea:	41 57                	push   %r15
+  802cec:	41 56                	push   %r14
+  802cee:	41 55                	push   %r13
+  802cf0:	41 54                	push   %r12
+  802cf2:	53                   	push   %rbx
+  802cf3:	48 83 ec 28          	sub    $0x28,%rsp
+  802cf7:	48 89 fb             	mov    %rdi,%rbx
+  802cfa:	49 89 f4             	mov    %rsi,%r12
+  802cfd:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802d00:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802d05:	48 85 f6             	test   %rsi,%rsi
+  802d08:	74 4b                	je     802d55 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802d0a:	48 b8 1a 20 80 00 00 	movabs $0x80201a,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+  802d16:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d19:	48 85 c0             	test   %rax,%rax
+  802d1c:	74 22                	je     802d40 <devfile_read+0x63>
+  802d1e:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802d25:	77 19                	ja     802d40 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802d27:	be 00 10 00 00       	mov    $0x1000,%esi
+  802d2c:	48 89 df             	mov    %rbx,%rdi
+  802d2f:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  802d36:	00 00 00 
+  802d39:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d3b:	83 f8 02             	cmp    $0x2,%eax
+  802d3e:	7e 40                	jle    802d80 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802d40:	48 89 df             	mov    %rbx,%rdi
+  802d43:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  802d4a:	00 00 00 
+  802d4d:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d4f:	85 c0                	test   %eax,%eax
+  802d51:	79 11                	jns    802d64 <devfile_read+0x87>
+  802d53:	48 98                	cltq
+}
+  802d55:	48 83 c4 28          	add    $0x28,%rsp
+  802d59:	5b                   	pop    %rbx
+  802d5a:	41 5c                	pop    %r12
+  802d5c:	41 5d                	pop    %r13
+  802d5e:	41 5e                	pop    %r14
+  802d60:	41 5f                	pop    %r15
+  802d62:	5d                   	pop    %rbp
+  802d63:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d64:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d69:	4c 89 ea             	mov    %r13,%rdx
+  802d6c:	4c 89 e6             	mov    %r12,%rsi
+  802d6f:	48 89 df             	mov    %rbx,%rdi
+  802d72:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  802d79:	00 00 00 
+  802d7c:	ff d0                	call   *%rax
+  802d7e:	eb d5                	jmp    802d55 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d80:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d84:	48 89 df             	mov    %rbx,%rdi
+  802d87:	48 b8 67 27 80 00 00 	movabs $0x802767,%rax
+  802d8e:	00 00 00 
+  802d91:	ff d0                	call   *%rax
+  802d93:	85 c0                	test   %eax,%eax
+  802d95:	0f 88 33 01 00 00    	js     802ece <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d9b:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802da2:	00 00 00 
+  802da5:	4c 89 f0             	mov    %r14,%rax
+  802da8:	48 29 d0             	sub    %rdx,%rax
+  802dab:	48 c1 f8 03          	sar    $0x3,%rax
+  802daf:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802db6:	aa aa aa 
+  802db9:	48 0f af c2          	imul   %rdx,%rax
+  802dbd:	48 c1 e0 0e          	shl    $0xe,%rax
+  802dc1:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802dc5:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802dc8:	41 39 06             	cmp    %eax,(%r14)
+  802dcb:	75 0d                	jne    802dda <devfile_read+0xfd>
+  802dcd:	8b 43 10             	mov    0x10(%rbx),%eax
+  802dd0:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802dd4:	0f 84 fb 00 00 00    	je     802ed5 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802dda:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ddf:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802de3:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802de6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802dea:	48 89 c7             	mov    %rax,%rdi
+  802ded:	48 b8 d9 40 80 00 00 	movabs $0x8040d9,%rax
+  802df4:	00 00 00 
+  802df7:	ff d0                	call   *%rax
+  802df9:	84 c0                	test   %al,%al
+  802dfb:	75 27                	jne    802e24 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dfd:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802e02:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e07:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e10:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  802e17:	00 00 00 
+  802e1a:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802e1c:	85 c0                	test   %eax,%eax
+  802e1e:	0f 88 dc 00 00 00    	js     802f00 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802e24:	44 89 f8             	mov    %r15d,%eax
+  802e27:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802e2c:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802e2e:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802e35:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802e36:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e39:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802e3d:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802e40:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e45:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e49:	48 89 df             	mov    %rbx,%rdi
+  802e4c:	48 b8 65 2a 80 00 00 	movabs $0x802a65,%rax
+  802e53:	00 00 00 
+  802e56:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e58:	48 85 c0             	test   %rax,%rax
+  802e5b:	0f 88 f4 fe ff ff    	js     802d55 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e61:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e64:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e67:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802e6a:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802e6e:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802e72:	48 63 d1             	movslq %ecx,%rdx
+  802e75:	48 01 d0             	add    %rdx,%rax
+  802e78:	4d 63 ff             	movslq %r15d,%r15
+  802e7b:	4c 29 f8             	sub    %r15,%rax
+  802e7e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e83:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e87:	48 85 c0             	test   %rax,%rax
+  802e8a:	0f 8e c5 fe ff ff    	jle    802d55 <devfile_read+0x78>
+    n = MIN(n, res);
+  802e90:	4c 39 e8             	cmp    %r13,%rax
+  802e93:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e97:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e9a:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e9e:	48 63 f6             	movslq %esi,%rsi
+  802ea1:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ea6:	48 01 c6             	add    %rax,%rsi
+  802ea9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ead:	48 01 c6             	add    %rax,%rsi
+  802eb0:	4c 89 ea             	mov    %r13,%rdx
+  802eb3:	4c 89 e7             	mov    %r12,%rdi
+  802eb6:	48 b8 e8 0f 80 00 00 	movabs $0x800fe8,%rax
+  802ebd:	00 00 00 
+  802ec0:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802ec2:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802ec6:	4c 89 e8             	mov    %r13,%rax
+  802ec9:	e9 87 fe ff ff       	jmp    802d55 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ece:	48 98                	cltq
+  802ed0:	e9 80 fe ff ff       	jmp    802d55 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802ed5:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ed9:	41 39 d7             	cmp    %edx,%r15d
+  802edc:	0f 8c f8 fe ff ff    	jl     802dda <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802ee2:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802ee6:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802ee9:	41 39 cf             	cmp    %ecx,%r15d
+  802eec:	0f 8d e8 fe ff ff    	jge    802dda <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802ef2:	4d 63 ff             	movslq %r15d,%r15
+  802ef5:	4c 29 f8             	sub    %r15,%rax
+  802ef8:	48 63 d2             	movslq %edx,%rdx
+  802efb:	48 01 d0             	add    %rdx,%rax
+  802efe:	eb 87                	jmp    802e87 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f00:	48 98                	cltq
+  802f02:	e9 4e fe ff ff       	jmp    802d55 <devfile_read+0x78>
+        return E_INVAL;
+  802f07:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802f0c:	c3                   	ret
+
+0000000000802f0d <fs_channel>:
+fs_channel(bool enable) {
+  802f0d:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802f0f:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802f16:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802f18:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f1d:	40 84 ff             	test   %dil,%dil
+  802f20:	74 47                	je     802f69 <fs_channel+0x5c>
+  802f22:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  802f29:	00 00 00 
+  802f2c:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802f32:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802f39:	00 00 00 
+  802f3c:	3b 08                	cmp    (%rax),%ecx
+  802f3e:	74 29                	je     802f69 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802f40:	55                   	push   %rbp
+  802f41:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802f44:	48 b8 8d 1e 80 00 00 	movabs $0x801e8d,%rax
+  802f4b:	00 00 00 
+  802f4e:	ff d0                	call   *%rax
+  802f50:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f52:	85 c0                	test   %eax,%eax
+  802f54:	78 04                	js     802f5a <fs_channel+0x4d>
+}
+  802f56:	89 d0                	mov    %edx,%eax
+  802f58:	5d                   	pop    %rbp
+  802f59:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f5a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f61:	00 00 00 
+  802f64:	c6 00 00             	movb   $0x0,(%rax)
+  802f67:	eb ed                	jmp    802f56 <fs_channel+0x49>
+}
+  802f69:	89 d0                	mov    %edx,%eax
+  802f6b:	c3                   	ret
+
+0000000000802f6c <open>:
+open(const char *path, int mode) {
+  802f6c:	55                   	push   %rbp
+  802f6d:	48 89 e5             	mov    %rsp,%rbp
+  802f70:	41 55                	push   %r13
+  802f72:	41 54                	push   %r12
+  802f74:	53                   	push   %rbx
+  802f75:	48 83 ec 18          	sub    $0x18,%rsp
+  802f79:	49 89 fc             	mov    %rdi,%r12
+  802f7c:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f7f:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  802f86:	00 00 00 
+  802f89:	ff d0                	call   *%rax
+  802f8b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f91:	0f 87 8f 00 00 00    	ja     803026 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f97:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f9b:	48 b8 47 17 80 00 00 	movabs $0x801747,%rax
+  802fa2:	00 00 00 
+  802fa5:	ff d0                	call   *%rax
+  802fa7:	89 c3                	mov    %eax,%ebx
+  802fa9:	85 c0                	test   %eax,%eax
+  802fab:	78 55                	js     803002 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802fad:	4c 89 e6             	mov    %r12,%rsi
+  802fb0:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802fb7:	00 00 00 
+  802fba:	48 89 df             	mov    %rbx,%rdi
+  802fbd:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802fc9:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802fd0:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fd5:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fd9:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fde:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  802fe5:	00 00 00 
+  802fe8:	ff d0                	call   *%rax
+  802fea:	89 c3                	mov    %eax,%ebx
+  802fec:	85 c0                	test   %eax,%eax
+  802fee:	78 1f                	js     80300f <open+0xa3>
+    return fd2num(fd);
+  802ff0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802ff4:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+  803000:	89 c3                	mov    %eax,%ebx
+}
+  803002:	89 d8                	mov    %ebx,%eax
+  803004:	48 83 c4 18          	add    $0x18,%rsp
+  803008:	5b                   	pop    %rbx
+  803009:	41 5c                	pop    %r12
+  80300b:	41 5d                	pop    %r13
+  80300d:	5d                   	pop    %rbp
+  80300e:	c3                   	ret
+        fd_close(fd, 0);
+  80300f:	be 00 00 00 00       	mov    $0x0,%esi
+  803014:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803018:	48 b8 62 18 80 00 00 	movabs $0x801862,%rax
+  80301f:	00 00 00 
+  803022:	ff d0                	call   *%rax
+        return res;
+  803024:	eb dc                	jmp    803002 <open+0x96>
+        return -E_BAD_PATH;
+  803026:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  80302b:	eb d5                	jmp    803002 <open+0x96>
+
+000000000080302d <file_flush_buffers>:
+file_flush_buffers(void) {
+  80302d:	55                   	push   %rbp
+  80302e:	48 89 e5             	mov    %rsp,%rbp
+  803031:	41 56                	push   %r14
+  803033:	41 55                	push   %r13
+  803035:	41 54                	push   %r12
+  803037:	53                   	push   %rbx
+  803038:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  80303c:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803043:	00 00 00 
+  803046:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80304b:	49 bd a7 17 80 00 00 	movabs $0x8017a7,%r13
+  803052:	00 00 00 
+  803055:	49 be 67 27 80 00 00 	movabs $0x802767,%r14
+  80305c:	00 00 00 
+  80305f:	eb 0c                	jmp    80306d <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803061:	83 c3 01             	add    $0x1,%ebx
+  803064:	49 83 c4 18          	add    $0x18,%r12
+  803068:	83 fb 20             	cmp    $0x20,%ebx
+  80306b:	74 1d                	je     80308a <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  80306d:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803072:	74 ed                	je     803061 <file_flush_buffers+0x34>
+  803074:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803078:	89 df                	mov    %ebx,%edi
+  80307a:	41 ff d5             	call   *%r13
+  80307d:	85 c0                	test   %eax,%eax
+  80307f:	78 e0                	js     803061 <file_flush_buffers+0x34>
+  803081:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803085:	41 ff d6             	call   *%r14
+  803088:	eb d7                	jmp    803061 <file_flush_buffers+0x34>
+}
+  80308a:	48 83 c4 10          	add    $0x10,%rsp
+  80308e:	5b                   	pop    %rbx
+  80308f:	41 5c                	pop    %r12
+  803091:	41 5d                	pop    %r13
+  803093:	41 5e                	pop    %r14
+  803095:	5d                   	pop    %rbp
+  803096:	c3                   	ret
+
+0000000000803097 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803097:	55                   	push   %rbp
+  803098:	48 89 e5             	mov    %rsp,%rbp
+  80309b:	41 54                	push   %r12
+  80309d:	53                   	push   %rbx
+  80309e:	49 89 fc             	mov    %rdi,%r12
+  8030a1:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8030a3:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  8030aa:	00 00 00 
+  8030ad:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8030af:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8030b6:	00 00 00 
+  8030b9:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8030be:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8030c0:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8030c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030cd:	bf 02 00 00 00       	mov    $0x2,%edi
+  8030d2:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  8030d9:	00 00 00 
+  8030dc:	ff d0                	call   *%rax
+}
+  8030de:	5b                   	pop    %rbx
+  8030df:	41 5c                	pop    %r12
+  8030e1:	5d                   	pop    %rbp
+  8030e2:	c3                   	ret
+
+00000000008030e3 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8030e3:	55                   	push   %rbp
+  8030e4:	48 89 e5             	mov    %rsp,%rbp
+  8030e7:	41 54                	push   %r12
+  8030e9:	53                   	push   %rbx
+  8030ea:	49 89 fc             	mov    %rdi,%r12
+  8030ed:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8030f0:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  8030f7:	00 00 00 
+  8030fa:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8030fc:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803101:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803108:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80310a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80310f:	be 00 00 00 00       	mov    $0x0,%esi
+  803114:	bf 05 00 00 00       	mov    $0x5,%edi
+  803119:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  803120:	00 00 00 
+  803123:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803125:	85 c0                	test   %eax,%eax
+  803127:	78 3d                	js     803166 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803129:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803130:	00 00 00 
+  803133:	4c 89 e6             	mov    %r12,%rsi
+  803136:	48 89 df             	mov    %rbx,%rdi
+  803139:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  803140:	00 00 00 
+  803143:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803145:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80314c:	00 
+  80314d:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803153:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  80315a:	00 
+  80315b:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803161:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803166:	5b                   	pop    %rbx
+  803167:	41 5c                	pop    %r12
+  803169:	5d                   	pop    %rbp
+  80316a:	c3                   	ret
+
+000000000080316b <remove>:
+remove(const char *path) {
+  80316b:	55                   	push   %rbp
+  80316c:	48 89 e5             	mov    %rsp,%rbp
+  80316f:	53                   	push   %rbx
+  803170:	48 83 ec 08          	sub    $0x8,%rsp
+  803174:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803177:	48 b8 49 0d 80 00 00 	movabs $0x800d49,%rax
+  80317e:	00 00 00 
+  803181:	ff d0                	call   *%rax
+  803183:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803189:	77 3a                	ja     8031c5 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  80318b:	48 89 de             	mov    %rbx,%rsi
+  80318e:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803195:	00 00 00 
+  803198:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  80319f:	00 00 00 
+  8031a2:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8031a4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a9:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ae:	bf 07 00 00 00       	mov    $0x7,%edi
+  8031b3:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  8031ba:	00 00 00 
+  8031bd:	ff d0                	call   *%rax
+}
+  8031bf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8031c3:	c9                   	leave
+  8031c4:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8031c5:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  8031ca:	eb f3                	jmp    8031bf <remove+0x54>
+
+00000000008031cc <sync>:
+sync(void) {
+  8031cc:	55                   	push   %rbp
+  8031cd:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  8031d0:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  8031d7:	00 00 00 
+  8031da:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8031dc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031e1:	be 00 00 00 00       	mov    $0x0,%esi
+  8031e6:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031eb:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  8031f2:	00 00 00 
+  8031f5:	ff d0                	call   *%rax
+}
+  8031f7:	5d                   	pop    %rbp
+  8031f8:	c3                   	ret
+
+00000000008031f9 <fsync>:
+fsync(int fdnum) {
+  8031f9:	55                   	push   %rbp
+  8031fa:	48 89 e5             	mov    %rsp,%rbp
+  8031fd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803201:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803205:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  80320c:	00 00 00 
+  80320f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803211:	85 c0                	test   %eax,%eax
+  803213:	78 4b                	js     803260 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803215:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803219:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803220:	00 00 00 
+  803223:	8b 00                	mov    (%rax),%eax
+  803225:	39 02                	cmp    %eax,(%rdx)
+  803227:	75 39                	jne    803262 <fsync+0x69>
+    file_flush_buffers();
+  803229:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  803230:	00 00 00 
+  803233:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803235:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803239:	8b 40 0c             	mov    0xc(%rax),%eax
+  80323c:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803243:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803245:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324a:	be 00 00 00 00       	mov    $0x0,%esi
+  80324f:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803254:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  80325b:	00 00 00 
+  80325e:	ff d0                	call   *%rax
+}
+  803260:	c9                   	leave
+  803261:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803262:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803267:	eb f7                	jmp    803260 <fsync+0x67>
+
+0000000000803269 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803269:	55                   	push   %rbp
+  80326a:	48 89 e5             	mov    %rsp,%rbp
+  80326d:	53                   	push   %rbx
+  80326e:	48 83 ec 08          	sub    $0x8,%rsp
+  803272:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803275:	ba 00 00 00 00       	mov    $0x0,%edx
+  80327a:	be 00 00 00 00       	mov    $0x0,%esi
+  80327f:	bf 0b 00 00 00       	mov    $0xb,%edi
+  803284:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  80328b:	00 00 00 
+  80328e:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803290:	85 c0                	test   %eax,%eax
+  803292:	78 2d                	js     8032c1 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  803294:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80329b:	00 00 00 
+  80329e:	48 8b 10             	mov    (%rax),%rdx
+  8032a1:	48 89 13             	mov    %rdx,(%rbx)
+  8032a4:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032a8:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032ac:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032b0:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032b4:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8032b8:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8032bc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032c1:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032c5:	c9                   	leave
+  8032c6:	c3                   	ret
+
+00000000008032c7 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8032c7:	55                   	push   %rbp
+  8032c8:	48 89 e5             	mov    %rsp,%rbp
+  8032cb:	53                   	push   %rbx
+  8032cc:	48 83 ec 08          	sub    $0x8,%rsp
+  8032d0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  8032d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8032dd:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8032e2:	48 b8 fe 24 80 00 00 	movabs $0x8024fe,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032ee:	85 c0                	test   %eax,%eax
+  8032f0:	78 3d                	js     80332f <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8032f2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032f9:	00 00 00 
+  8032fc:	48 8b 10             	mov    (%rax),%rdx
+  8032ff:	48 89 13             	mov    %rdx,(%rbx)
+  803302:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803306:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80330a:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80330e:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803312:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803316:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80331a:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80331e:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803322:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803326:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  80332a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80332f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803333:	c9                   	leave
+  803334:	c3                   	ret
+
+0000000000803335 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803335:	55                   	push   %rbp
+  803336:	48 89 e5             	mov    %rsp,%rbp
+  803339:	41 57                	push   %r15
+  80333b:	41 56                	push   %r14
+  80333d:	41 55                	push   %r13
+  80333f:	41 54                	push   %r12
+  803341:	53                   	push   %rbx
+  803342:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803346:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80334d:	00 
+  80334e:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803355:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  80335b:	0f 85 43 01 00 00    	jne    8034a4 <munmap+0x16f>
+  803361:	49 89 ff             	mov    %rdi,%r15
+  803364:	4c 39 f7             	cmp    %r14,%rdi
+  803367:	0f 87 37 01 00 00    	ja     8034a4 <munmap+0x16f>
+  80336d:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  803374:	00 00 00 
+  803377:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  80337d:	eb 2c                	jmp    8033ab <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80337f:	4c 39 f8             	cmp    %r15,%rax
+  803382:	0f 83 85 00 00 00    	jae    80340d <munmap+0xd8>
+            m->mm_end = start;
+  803388:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80338d:	48 83 c3 18          	add    $0x18,%rbx
+  803391:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803398:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80339f:	00 00 00 
+  8033a2:	48 39 c3             	cmp    %rax,%rbx
+  8033a5:	0f 84 d0 00 00 00    	je     80347b <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8033ab:	49 89 dc             	mov    %rbx,%r12
+  8033ae:	48 8b 03             	mov    (%rbx),%rax
+  8033b1:	4c 39 f0             	cmp    %r14,%rax
+  8033b4:	73 d7                	jae    80338d <munmap+0x58>
+  8033b6:	48 85 c0             	test   %rax,%rax
+  8033b9:	74 d2                	je     80338d <munmap+0x58>
+  8033bb:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033bf:	49 39 d7             	cmp    %rdx,%r15
+  8033c2:	73 c9                	jae    80338d <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8033c4:	49 39 d6             	cmp    %rdx,%r14
+  8033c7:	73 b6                	jae    80337f <munmap+0x4a>
+  8033c9:	49 39 c7             	cmp    %rax,%r15
+  8033cc:	76 b1                	jbe    80337f <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  8033ce:	4c 89 ef             	mov    %r13,%rdi
+  8033d1:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  8033d8:	00 00 00 
+  8033db:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8033dd:	48 85 c0             	test   %rax,%rax
+  8033e0:	0f 84 c5 00 00 00    	je     8034ab <munmap+0x176>
+            *tail = *m;
+  8033e6:	48 8b 13             	mov    (%rbx),%rdx
+  8033e9:	48 89 10             	mov    %rdx,(%rax)
+  8033ec:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033f0:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8033f4:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8033f8:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8033fc:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8033ff:	44 89 f2             	mov    %r14d,%edx
+  803402:	2b 13                	sub    (%rbx),%edx
+  803404:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803407:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  80340b:	eb 80                	jmp    80338d <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80340d:	49 39 d6             	cmp    %rdx,%r14
+  803410:	73 18                	jae    80342a <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803412:	44 89 f2             	mov    %r14d,%edx
+  803415:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80341a:	29 c2                	sub    %eax,%edx
+  80341c:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803421:	4d 89 34 24          	mov    %r14,(%r12)
+  803425:	e9 63 ff ff ff       	jmp    80338d <munmap+0x58>
+    m->mm_start = 0;
+  80342a:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803431:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803432:	4c 89 e6             	mov    %r12,%rsi
+  803435:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80343c:	00 00 00 
+  80343f:	48 29 c6             	sub    %rax,%rsi
+  803442:	48 c1 fe 03          	sar    $0x3,%rsi
+  803446:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80344d:	aa aa aa 
+  803450:	48 0f af f0          	imul   %rax,%rsi
+  803454:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803458:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80345d:	48 01 c6             	add    %rax,%rsi
+  803460:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803465:	bf 00 00 00 00       	mov    $0x0,%edi
+  80346a:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  803471:	00 00 00 
+  803474:	ff d0                	call   *%rax
+}
+  803476:	e9 12 ff ff ff       	jmp    80338d <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  80347b:	4c 89 f2             	mov    %r14,%rdx
+  80347e:	4c 29 fa             	sub    %r15,%rdx
+  803481:	4c 89 fe             	mov    %r15,%rsi
+  803484:	bf 00 00 00 00       	mov    $0x0,%edi
+  803489:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  803490:	00 00 00 
+  803493:	ff d0                	call   *%rax
+}
+  803495:	48 83 c4 08          	add    $0x8,%rsp
+  803499:	5b                   	pop    %rbx
+  80349a:	41 5c                	pop    %r12
+  80349c:	41 5d                	pop    %r13
+  80349e:	41 5e                	pop    %r14
+  8034a0:	41 5f                	pop    %r15
+  8034a2:	5d                   	pop    %rbp
+  8034a3:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034a4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034a9:	eb ea                	jmp    803495 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8034ab:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8034b0:	eb e3                	jmp    803495 <munmap+0x160>
+
+00000000008034b2 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8034b2:	55                   	push   %rbp
+  8034b3:	48 89 e5             	mov    %rsp,%rbp
+  8034b6:	41 57                	push   %r15
+  8034b8:	41 56                	push   %r14
+  8034ba:	41 55                	push   %r13
+  8034bc:	41 54                	push   %r12
+  8034be:	53                   	push   %rbx
+  8034bf:	48 83 ec 28          	sub    $0x28,%rsp
+  8034c3:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8034c7:	49 89 f5             	mov    %rsi,%r13
+  8034ca:	41 89 d6             	mov    %edx,%r14d
+  8034cd:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  8034d0:	41 89 cc             	mov    %ecx,%r12d
+  8034d3:	44 89 c7             	mov    %r8d,%edi
+  8034d6:	44 89 cb             	mov    %r9d,%ebx
+  8034d9:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034dd:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034e1:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  8034e8:	00 00 00 
+  8034eb:	ff d0                	call   *%rax
+  8034ed:	41 89 c7             	mov    %eax,%r15d
+  8034f0:	85 c0                	test   %eax,%eax
+  8034f2:	0f 88 ae 01 00 00    	js     8036a6 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034f8:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034fc:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803503:	00 00 00 
+  803506:	8b 32                	mov    (%rdx),%esi
+  803508:	39 30                	cmp    %esi,(%rax)
+  80350a:	0f 85 7a 02 00 00    	jne    80378a <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803510:	8b 40 08             	mov    0x8(%rax),%eax
+  803513:	83 e0 03             	and    $0x3,%eax
+  803516:	83 f8 01             	cmp    $0x1,%eax
+  803519:	0f 84 76 02 00 00    	je     803795 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80351f:	4d 85 ed             	test   %r13,%r13
+  803522:	0f 84 78 02 00 00    	je     8037a0 <mmap+0x2ee>
+  803528:	85 db                	test   %ebx,%ebx
+  80352a:	0f 88 70 02 00 00    	js     8037a0 <mmap+0x2ee>
+  803530:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803536:	41 89 df             	mov    %ebx,%r15d
+  803539:	0f 85 6c 02 00 00    	jne    8037ab <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80353f:	44 89 f0             	mov    %r14d,%eax
+  803542:	83 e0 fd             	and    $0xfffffffd,%eax
+  803545:	83 f8 04             	cmp    $0x4,%eax
+  803548:	0f 85 68 02 00 00    	jne    8037b6 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80354e:	44 89 e1             	mov    %r12d,%ecx
+  803551:	83 e1 01             	and    $0x1,%ecx
+  803554:	0f 95 c2             	setne  %dl
+  803557:	44 89 e0             	mov    %r12d,%eax
+  80355a:	d1 e8                	shr    %eax
+  80355c:	83 f0 01             	xor    $0x1,%eax
+  80355f:	83 e0 01             	and    $0x1,%eax
+  803562:	38 c2                	cmp    %al,%dl
+  803564:	0f 85 57 02 00 00    	jne    8037c1 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80356a:	85 c9                	test   %ecx,%ecx
+  80356c:	74 0a                	je     803578 <mmap+0xc6>
+  80356e:	41 f6 c6 02          	test   $0x2,%r14b
+  803572:	0f 85 54 02 00 00    	jne    8037cc <mmap+0x31a>
+    file_flush_buffers();
+  803578:	48 b8 2d 30 80 00 00 	movabs $0x80302d,%rax
+  80357f:	00 00 00 
+  803582:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  803584:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  80358b:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  803592:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803596:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803599:	41 f6 c4 04          	test   $0x4,%r12b
+  80359d:	0f 84 15 01 00 00    	je     8036b8 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8035a3:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8035a6:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8035ac:	0f 85 25 02 00 00    	jne    8037d7 <mmap+0x325>
+  8035b2:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8035b6:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8035bd:	00 00 00 
+  8035c0:	48 39 c2             	cmp    %rax,%rdx
+  8035c3:	0f 82 19 02 00 00    	jb     8037e2 <mmap+0x330>
+  8035c9:	48 39 c7             	cmp    %rax,%rdi
+  8035cc:	0f 87 10 02 00 00    	ja     8037e2 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8035d2:	4c 89 ee             	mov    %r13,%rsi
+  8035d5:	48 b8 35 33 80 00 00 	movabs $0x803335,%rax
+  8035dc:	00 00 00 
+  8035df:	ff d0                	call   *%rax
+  8035e1:	85 c0                	test   %eax,%eax
+  8035e3:	0f 88 04 02 00 00    	js     8037ed <mmap+0x33b>
+    if (!handler) {
+  8035e9:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035f0:	00 00 00 
+  8035f3:	80 38 00             	cmpb   $0x0,(%rax)
+  8035f6:	75 2b                	jne    803623 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8035f8:	48 bf cd 23 80 00 00 	movabs $0x8023cd,%rdi
+  8035ff:	00 00 00 
+  803602:	48 b8 32 46 80 00 00 	movabs $0x804632,%rax
+  803609:	00 00 00 
+  80360c:	ff d0                	call   *%rax
+  80360e:	85 c0                	test   %eax,%eax
+  803610:	0f 88 ea 01 00 00    	js     803800 <mmap+0x34e>
+        handler = 1;
+  803616:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80361d:	00 00 00 
+  803620:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803623:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803627:	48 b8 6c 24 80 00 00 	movabs $0x80246c,%rax
+  80362e:	00 00 00 
+  803631:	ff d0                	call   *%rax
+  803633:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803636:	48 85 c0             	test   %rax,%rax
+  803639:	0f 84 c9 01 00 00    	je     803808 <mmap+0x356>
+    m->mm_start = va;
+  80363f:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803642:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803646:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  80364a:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80364d:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803651:	44 89 e0             	mov    %r12d,%eax
+  803654:	c1 e0 06             	shl    $0x6,%eax
+  803657:	25 80 00 00 00       	and    $0x80,%eax
+  80365c:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80365f:	09 f0                	or     %esi,%eax
+  803661:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803665:	41 f6 c4 08          	test   $0x8,%r12b
+  803669:	74 31                	je     80369c <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80366b:	48 39 d3             	cmp    %rdx,%rbx
+  80366e:	73 2c                	jae    80369c <mmap+0x1ea>
+  803670:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803675:	48 89 de             	mov    %rbx,%rsi
+  803678:	4c 89 f7             	mov    %r14,%rdi
+  80367b:	48 b8 bc 22 80 00 00 	movabs $0x8022bc,%rax
+  803682:	00 00 00 
+  803685:	ff d0                	call   *%rax
+  803687:	49 89 c4             	mov    %rax,%r12
+  80368a:	48 85 c0             	test   %rax,%rax
+  80368d:	0f 8e d7 00 00 00    	jle    80376a <mmap+0x2b8>
+            va += n;
+  803693:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803696:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80369a:	72 d4                	jb     803670 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  80369c:	49 8b 06             	mov    (%r14),%rax
+  80369f:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8036a3:	48 89 06             	mov    %rax,(%rsi)
+}
+  8036a6:	44 89 f8             	mov    %r15d,%eax
+  8036a9:	48 83 c4 28          	add    $0x28,%rsp
+  8036ad:	5b                   	pop    %rbx
+  8036ae:	41 5c                	pop    %r12
+  8036b0:	41 5d                	pop    %r13
+  8036b2:	41 5e                	pop    %r14
+  8036b4:	41 5f                	pop    %r15
+  8036b6:	5d                   	pop    %rbp
+  8036b7:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036b8:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8036bf:	00 00 00 
+  8036c2:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8036c5:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  8036cc:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036cf:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036d4:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8036db:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036de:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8036e5:	00 00 00 
+  8036e8:	48 39 d7             	cmp    %rdx,%rdi
+  8036eb:	73 1c                	jae    803709 <mmap+0x257>
+        return -E_NO_MEM;
+  8036ed:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036f3:	eb b1                	jmp    8036a6 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036f5:	48 83 c0 01          	add    $0x1,%rax
+  8036f9:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8036fd:	77 3f                	ja     80373e <mmap+0x28c>
+  8036ff:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803704:	48 39 d7             	cmp    %rdx,%rdi
+  803707:	72 2a                	jb     803733 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803709:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80370d:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803711:	48 39 d1             	cmp    %rdx,%rcx
+  803714:	73 df                	jae    8036f5 <mmap+0x243>
+  803716:	48 85 c9             	test   %rcx,%rcx
+  803719:	74 da                	je     8036f5 <mmap+0x243>
+  80371b:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80371f:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803724:	48 39 d3             	cmp    %rdx,%rbx
+  803727:	73 cc                	jae    8036f5 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803729:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80372c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803731:	eb cc                	jmp    8036ff <mmap+0x24d>
+        return -E_NO_MEM;
+  803733:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803739:	e9 68 ff ff ff       	jmp    8036a6 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80373e:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803743:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  80374a:	00 00 00 
+  80374d:	48 39 c2             	cmp    %rax,%rdx
+  803750:	0f 82 9f 00 00 00    	jb     8037f5 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803756:	48 85 db             	test   %rbx,%rbx
+  803759:	0f 85 8a fe ff ff    	jne    8035e9 <mmap+0x137>
+        return -E_NO_MEM;
+  80375f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803765:	e9 3c ff ff ff       	jmp    8036a6 <mmap+0x1f4>
+        if (n < 0) {
+  80376a:	0f 89 2c ff ff ff    	jns    80369c <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803770:	49 8b 3e             	mov    (%r14),%rdi
+  803773:	4c 89 ee             	mov    %r13,%rsi
+  803776:	48 b8 35 33 80 00 00 	movabs $0x803335,%rax
+  80377d:	00 00 00 
+  803780:	ff d0                	call   *%rax
+            return n;
+  803782:	45 89 e7             	mov    %r12d,%r15d
+  803785:	e9 1c ff ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80378a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803790:	e9 11 ff ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803795:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80379b:	e9 06 ff ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8037a0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037a6:	e9 fb fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+  8037ab:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037b1:	e9 f0 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8037b6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037bc:	e9 e5 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8037c1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037c7:	e9 da fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037cc:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  8037d2:	e9 cf fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037d7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037dd:	e9 c4 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+  8037e2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037e8:	e9 b9 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8037ed:	41 89 c7             	mov    %eax,%r15d
+  8037f0:	e9 b1 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8037f5:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037fb:	e9 a6 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803800:	41 89 c7             	mov    %eax,%r15d
+  803803:	e9 9e fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803808:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80380e:	e9 93 fe ff ff       	jmp    8036a6 <mmap+0x1f4>
+
+0000000000803813 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  803813:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  803817:	7f 01                	jg     80381a <writebuf+0x7>
+  803819:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80381a:	55                   	push   %rbp
+  80381b:	48 89 e5             	mov    %rsp,%rbp
+  80381e:	53                   	push   %rbx
+  80381f:	48 83 ec 08          	sub    $0x8,%rsp
+  803823:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  803826:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  80382a:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  80382e:	8b 3f                	mov    (%rdi),%edi
+  803830:	48 b8 b9 1b 80 00 00 	movabs $0x801bb9,%rax
+  803837:	00 00 00 
+  80383a:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  80383c:	48 85 c0             	test   %rax,%rax
+  80383f:	7e 04                	jle    803845 <writebuf+0x32>
+  803841:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  803845:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  803849:	48 39 c2             	cmp    %rax,%rdx
+  80384c:	74 0f                	je     80385d <writebuf+0x4a>
+            state->error = MIN(0, result);
+  80384e:	48 85 c0             	test   %rax,%rax
+  803851:	ba 00 00 00 00       	mov    $0x0,%edx
+  803856:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80385a:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  80385d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803861:	c9                   	leave
+  803862:	c3                   	ret
+
+0000000000803863 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  803863:	8b 46 04             	mov    0x4(%rsi),%eax
+  803866:	8d 50 01             	lea    0x1(%rax),%edx
+  803869:	89 56 04             	mov    %edx,0x4(%rsi)
+  80386c:	48 98                	cltq
+  80386e:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  803873:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  803879:	74 01                	je     80387c <putch+0x19>
+  80387b:	c3                   	ret
+putch(int ch, void *arg) {
+  80387c:	55                   	push   %rbp
+  80387d:	48 89 e5             	mov    %rsp,%rbp
+  803880:	53                   	push   %rbx
+  803881:	48 83 ec 08          	sub    $0x8,%rsp
+  803885:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  803888:	48 89 f7             	mov    %rsi,%rdi
+  80388b:	48 b8 13 38 80 00 00 	movabs $0x803813,%rax
+  803892:	00 00 00 
+  803895:	ff d0                	call   *%rax
+        state->offset = 0;
+  803897:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  80389e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8038a2:	c9                   	leave
+  8038a3:	c3                   	ret
+
+00000000008038a4 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  8038a4:	55                   	push   %rbp
+  8038a5:	48 89 e5             	mov    %rsp,%rbp
+  8038a8:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  8038af:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  8038b2:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  8038b8:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  8038bf:	00 00 00 
+    state.result = 0;
+  8038c2:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  8038c9:	00 00 00 00 
+    state.error = 1;
+  8038cd:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  8038d4:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  8038d7:	48 89 f2             	mov    %rsi,%rdx
+  8038da:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  8038e1:	48 bf 63 38 80 00 00 	movabs $0x803863,%rdi
+  8038e8:	00 00 00 
+  8038eb:	48 b8 b2 05 80 00 00 	movabs $0x8005b2,%rax
+  8038f2:	00 00 00 
+  8038f5:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  8038f7:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  8038fe:	7f 14                	jg     803914 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  803900:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  803907:	48 85 c0             	test   %rax,%rax
+  80390a:	75 06                	jne    803912 <vfprintf+0x6e>
+  80390c:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  803912:	c9                   	leave
+  803913:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  803914:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  80391b:	48 b8 13 38 80 00 00 	movabs $0x803813,%rax
+  803922:	00 00 00 
+  803925:	ff d0                	call   *%rax
+  803927:	eb d7                	jmp    803900 <vfprintf+0x5c>
+
+0000000000803929 <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  803929:	55                   	push   %rbp
+  80392a:	48 89 e5             	mov    %rsp,%rbp
+  80392d:	48 83 ec 50          	sub    $0x50,%rsp
+  803931:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  803935:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  803939:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80393d:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803941:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  803948:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80394c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803950:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803954:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  803958:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  80395c:	48 b8 a4 38 80 00 00 	movabs $0x8038a4,%rax
+  803963:	00 00 00 
+  803966:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  803968:	c9                   	leave
+  803969:	c3                   	ret
+
+000000000080396a <printf>:
+
+int
+printf(const char *fmt, ...) {
+  80396a:	55                   	push   %rbp
+  80396b:	48 89 e5             	mov    %rsp,%rbp
+  80396e:	48 83 ec 50          	sub    $0x50,%rsp
+  803972:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  803976:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80397a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80397e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  803982:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  803986:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80398d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  803991:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803995:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  803999:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  80399d:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8039a1:	48 89 fe             	mov    %rdi,%rsi
+  8039a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8039a9:	48 b8 a4 38 80 00 00 	movabs $0x8038a4,%rax
+  8039b0:	00 00 00 
+  8039b3:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8039b5:	c9                   	leave
+  8039b6:	c3                   	ret
+
+00000000008039b7 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039b7:	55                   	push   %rbp
+  8039b8:	48 89 e5             	mov    %rsp,%rbp
+  8039bb:	41 54                	push   %r12
+  8039bd:	53                   	push   %rbx
+  8039be:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039c1:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  8039c8:	00 00 00 
+  8039cb:	ff d0                	call   *%rax
+  8039cd:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039d0:	48 be 00 51 80 00 00 	movabs $0x805100,%rsi
+  8039d7:	00 00 00 
+  8039da:	48 89 df             	mov    %rbx,%rdi
+  8039dd:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  8039e4:	00 00 00 
+  8039e7:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039e9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039ee:	41 2b 04 24          	sub    (%r12),%eax
+  8039f2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039f8:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039ff:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a02:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a09:	00 00 00 
+  803a0c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a13:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a18:	5b                   	pop    %rbx
+  803a19:	41 5c                	pop    %r12
+  803a1b:	5d                   	pop    %rbp
+  803a1c:	c3                   	ret
+
+0000000000803a1d <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a1d:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a20:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a26:	8b 17                	mov    (%rdi),%edx
+  803a28:	85 d2                	test   %edx,%edx
+  803a2a:	75 01                	jne    803a2d <pipe_wakeup+0x10>
+  803a2c:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a2d:	55                   	push   %rbp
+  803a2e:	48 89 e5             	mov    %rsp,%rbp
+  803a31:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a34:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a3a:	be 00 04 00 00       	mov    $0x400,%esi
+  803a3f:	48 b8 72 16 80 00 00 	movabs $0x801672,%rax
+  803a46:	00 00 00 
+  803a49:	ff d0                	call   *%rax
+}
+  803a4b:	5d                   	pop    %rbp
+  803a4c:	c3                   	ret
+
+0000000000803a4d <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a4d:	55                   	push   %rbp
+  803a4e:	48 89 e5             	mov    %rsp,%rbp
+  803a51:	41 55                	push   %r13
+  803a53:	41 54                	push   %r12
+  803a55:	53                   	push   %rbx
+  803a56:	48 83 ec 08          	sub    $0x8,%rsp
+  803a5a:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a5d:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803a64:	00 00 00 
+  803a67:	ff d0                	call   *%rax
+  803a69:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a6c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a71:	4c 89 e6             	mov    %r12,%rsi
+  803a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a79:	49 bc 8c 13 80 00 00 	movabs $0x80138c,%r12
+  803a80:	00 00 00 
+  803a83:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a86:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a8a:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a8e:	49 bd 1d 3a 80 00 00 	movabs $0x803a1d,%r13
+  803a95:	00 00 00 
+  803a98:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a9b:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a9f:	48 89 de             	mov    %rbx,%rsi
+  803aa2:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803aa5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803aaa:	48 89 de             	mov    %rbx,%rsi
+  803aad:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ab2:	41 ff d4             	call   *%r12
+  803ab5:	48 83 c4 08          	add    $0x8,%rsp
+  803ab9:	5b                   	pop    %rbx
+  803aba:	41 5c                	pop    %r12
+  803abc:	41 5d                	pop    %r13
+  803abe:	5d                   	pop    %rbp
+  803abf:	c3                   	ret
+
+0000000000803ac0 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ac0:	55                   	push   %rbp
+  803ac1:	48 89 e5             	mov    %rsp,%rbp
+  803ac4:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803ac7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803acc:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ad1:	48 b8 cf 12 80 00 00 	movabs $0x8012cf,%rax
+  803ad8:	00 00 00 
+  803adb:	ff d0                	call   *%rax
+  803add:	85 c0                	test   %eax,%eax
+  803adf:	0f 94 c0             	sete   %al
+  803ae2:	0f b6 c0             	movzbl %al,%eax
+}
+  803ae5:	5d                   	pop    %rbp
+  803ae6:	c3                   	ret
+
+0000000000803ae7 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803ae7:	55                   	push   %rbp
+  803ae8:	48 89 e5             	mov    %rsp,%rbp
+  803aeb:	41 57                	push   %r15
+  803aed:	41 56                	push   %r14
+  803aef:	41 55                	push   %r13
+  803af1:	41 54                	push   %r12
+  803af3:	53                   	push   %rbx
+  803af4:	48 83 ec 38          	sub    $0x38,%rsp
+  803af8:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803afc:	49 89 f4             	mov    %rsi,%r12
+  803aff:	49 89 d7             	mov    %rdx,%r15
+  803b02:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b06:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803b0d:	00 00 00 
+  803b10:	ff d0                	call   *%rax
+  803b12:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b15:	4d 85 ff             	test   %r15,%r15
+  803b18:	0f 84 f1 00 00 00    	je     803c0f <devpipe_write+0x128>
+  803b1e:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b22:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b26:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b2a:	49 bd c0 3a 80 00 00 	movabs $0x803ac0,%r13
+  803b31:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b34:	49 bf 1d 3a 80 00 00 	movabs $0x803a1d,%r15
+  803b3b:	00 00 00 
+  803b3e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b46:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b4a:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b4d:	48 63 ce             	movslq %esi,%rcx
+  803b50:	48 63 03             	movslq (%rbx),%rax
+  803b53:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b59:	48 39 c1             	cmp    %rax,%rcx
+  803b5c:	72 64                	jb     803bc2 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b5e:	48 89 de             	mov    %rbx,%rsi
+  803b61:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b65:	41 ff d5             	call   *%r13
+  803b68:	85 c0                	test   %eax,%eax
+  803b6a:	0f 85 b9 00 00 00    	jne    803c29 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b70:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b74:	4c 89 f7             	mov    %r14,%rdi
+  803b77:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b7a:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b7d:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b84:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b8b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b91:	8b 03                	mov    (%rbx),%eax
+  803b93:	41 39 c4             	cmp    %eax,%r12d
+  803b96:	75 b2                	jne    803b4a <devpipe_write+0x63>
+  803b98:	48 89 de             	mov    %rbx,%rsi
+  803b9b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b9f:	41 ff d5             	call   *%r13
+  803ba2:	85 c0                	test   %eax,%eax
+  803ba4:	75 a0                	jne    803b46 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803ba6:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bab:	44 89 e6             	mov    %r12d,%esi
+  803bae:	48 89 df             	mov    %rbx,%rdi
+  803bb1:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  803bb8:	00 00 00 
+  803bbb:	ff d0                	call   *%rax
+  803bbd:	e9 7c ff ff ff       	jmp    803b3e <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bc2:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bc6:	41 0f b6 38          	movzbl (%r8),%edi
+  803bca:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bd1:	80 80 80 
+  803bd4:	48 89 c8             	mov    %rcx,%rax
+  803bd7:	48 f7 e2             	mul    %rdx
+  803bda:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bde:	48 89 d0             	mov    %rdx,%rax
+  803be1:	48 c1 e0 08          	shl    $0x8,%rax
+  803be5:	48 29 d0             	sub    %rdx,%rax
+  803be8:	48 c1 e0 04          	shl    $0x4,%rax
+  803bec:	48 29 c1             	sub    %rax,%rcx
+  803bef:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803bf4:	83 c6 01             	add    $0x1,%esi
+  803bf7:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bfa:	49 83 c0 01          	add    $0x1,%r8
+  803bfe:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c02:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c06:	49 39 c0             	cmp    %rax,%r8
+  803c09:	0f 85 2f ff ff ff    	jne    803b3e <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c0f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c13:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c17:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803c1e:	00 00 00 
+  803c21:	ff d0                	call   *%rax
+    return n;
+  803c23:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c27:	eb 05                	jmp    803c2e <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c2e:	48 83 c4 38          	add    $0x38,%rsp
+  803c32:	5b                   	pop    %rbx
+  803c33:	41 5c                	pop    %r12
+  803c35:	41 5d                	pop    %r13
+  803c37:	41 5e                	pop    %r14
+  803c39:	41 5f                	pop    %r15
+  803c3b:	5d                   	pop    %rbp
+  803c3c:	c3                   	ret
+
+0000000000803c3d <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c3d:	55                   	push   %rbp
+  803c3e:	48 89 e5             	mov    %rsp,%rbp
+  803c41:	41 57                	push   %r15
+  803c43:	41 56                	push   %r14
+  803c45:	41 55                	push   %r13
+  803c47:	41 54                	push   %r12
+  803c49:	53                   	push   %rbx
+  803c4a:	48 83 ec 28          	sub    $0x28,%rsp
+  803c4e:	49 89 fd             	mov    %rdi,%r13
+  803c51:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c55:	49 89 d4             	mov    %rdx,%r12
+  803c58:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c5c:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803c63:	00 00 00 
+  803c66:	ff d0                	call   *%rax
+  803c68:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c6b:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c71:	49 bf c0 3a 80 00 00 	movabs $0x803ac0,%r15
+  803c78:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c7b:	4d 85 e4             	test   %r12,%r12
+  803c7e:	0f 84 d5 00 00 00    	je     803d59 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c84:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c88:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c8c:	8b 03                	mov    (%rbx),%eax
+  803c8e:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c91:	75 7a                	jne    803d0d <devpipe_read+0xd0>
+            if (i > 0) {
+  803c93:	4d 85 f6             	test   %r14,%r14
+  803c96:	75 50                	jne    803ce8 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c98:	48 89 de             	mov    %rbx,%rsi
+  803c9b:	4c 89 ef             	mov    %r13,%rdi
+  803c9e:	41 ff d7             	call   *%r15
+  803ca1:	85 c0                	test   %eax,%eax
+  803ca3:	0f 85 c9 00 00 00    	jne    803d72 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ca9:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803cac:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cb3:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cb9:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cbc:	41 39 c4             	cmp    %eax,%r12d
+  803cbf:	75 cb                	jne    803c8c <devpipe_read+0x4f>
+  803cc1:	48 89 de             	mov    %rbx,%rsi
+  803cc4:	4c 89 ef             	mov    %r13,%rdi
+  803cc7:	41 ff d7             	call   *%r15
+  803cca:	85 c0                	test   %eax,%eax
+  803ccc:	75 be                	jne    803c8c <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cce:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cd3:	44 89 e6             	mov    %r12d,%esi
+  803cd6:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cda:	48 b8 54 16 80 00 00 	movabs $0x801654,%rax
+  803ce1:	00 00 00 
+  803ce4:	ff d0                	call   *%rax
+  803ce6:	eb a4                	jmp    803c8c <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ce8:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803cec:	48 89 de             	mov    %rbx,%rsi
+  803cef:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803cf6:	00 00 00 
+  803cf9:	ff d0                	call   *%rax
+                return i;
+  803cfb:	4c 89 f0             	mov    %r14,%rax
+}
+  803cfe:	48 83 c4 28          	add    $0x28,%rsp
+  803d02:	5b                   	pop    %rbx
+  803d03:	41 5c                	pop    %r12
+  803d05:	41 5d                	pop    %r13
+  803d07:	41 5e                	pop    %r14
+  803d09:	41 5f                	pop    %r15
+  803d0b:	5d                   	pop    %rbp
+  803d0c:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d0d:	48 63 c8             	movslq %eax,%rcx
+  803d10:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d17:	80 80 80 
+  803d1a:	48 89 c8             	mov    %rcx,%rax
+  803d1d:	48 f7 e2             	mul    %rdx
+  803d20:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d24:	48 89 d0             	mov    %rdx,%rax
+  803d27:	48 c1 e0 08          	shl    $0x8,%rax
+  803d2b:	48 29 d0             	sub    %rdx,%rax
+  803d2e:	48 c1 e0 04          	shl    $0x4,%rax
+  803d32:	48 89 c2             	mov    %rax,%rdx
+  803d35:	48 89 c8             	mov    %rcx,%rax
+  803d38:	48 29 d0             	sub    %rdx,%rax
+  803d3b:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d40:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d44:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d48:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d4b:	49 83 c6 01          	add    $0x1,%r14
+  803d4f:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d53:	0f 85 2b ff ff ff    	jne    803c84 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d59:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d5d:	48 89 de             	mov    %rbx,%rsi
+  803d60:	48 b8 1d 3a 80 00 00 	movabs $0x803a1d,%rax
+  803d67:	00 00 00 
+  803d6a:	ff d0                	call   *%rax
+    return n;
+  803d6c:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d70:	eb 8c                	jmp    803cfe <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d72:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d77:	eb 85                	jmp    803cfe <devpipe_read+0xc1>
+
+0000000000803d79 <pipe>:
+pipe(int pfd[2]) {
+  803d79:	55                   	push   %rbp
+  803d7a:	48 89 e5             	mov    %rsp,%rbp
+  803d7d:	41 55                	push   %r13
+  803d7f:	41 54                	push   %r12
+  803d81:	53                   	push   %rbx
+  803d82:	48 83 ec 18          	sub    $0x18,%rsp
+  803d86:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d89:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d8d:	48 b8 47 17 80 00 00 	movabs $0x801747,%rax
+  803d94:	00 00 00 
+  803d97:	ff d0                	call   *%rax
+  803d99:	89 c3                	mov    %eax,%ebx
+  803d9b:	85 c0                	test   %eax,%eax
+  803d9d:	0f 88 a0 01 00 00    	js     803f43 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803da3:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803da8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dad:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803db1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803db6:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+  803dc2:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803dc4:	85 c0                	test   %eax,%eax
+  803dc6:	0f 88 77 01 00 00    	js     803f43 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dcc:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dd0:	48 b8 47 17 80 00 00 	movabs $0x801747,%rax
+  803dd7:	00 00 00 
+  803dda:	ff d0                	call   *%rax
+  803ddc:	89 c3                	mov    %eax,%ebx
+  803dde:	85 c0                	test   %eax,%eax
+  803de0:	0f 88 43 01 00 00    	js     803f29 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803de6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803deb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803df0:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803df4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803df9:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+  803e05:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e07:	85 c0                	test   %eax,%eax
+  803e09:	0f 88 1a 01 00 00    	js     803f29 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e0f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e13:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803e1a:	00 00 00 
+  803e1d:	ff d0                	call   *%rax
+  803e1f:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e22:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e2c:	48 89 c6             	mov    %rax,%rsi
+  803e2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e34:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  803e3b:	00 00 00 
+  803e3e:	ff d0                	call   *%rax
+  803e40:	89 c3                	mov    %eax,%ebx
+  803e42:	85 c0                	test   %eax,%eax
+  803e44:	0f 88 c5 00 00 00    	js     803f0f <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e4a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e4e:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803e55:	00 00 00 
+  803e58:	ff d0                	call   *%rax
+  803e5a:	48 89 c1             	mov    %rax,%rcx
+  803e5d:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e63:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e69:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e6e:	4c 89 ee             	mov    %r13,%rsi
+  803e71:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e76:	48 b8 3c 13 80 00 00 	movabs $0x80133c,%rax
+  803e7d:	00 00 00 
+  803e80:	ff d0                	call   *%rax
+  803e82:	89 c3                	mov    %eax,%ebx
+  803e84:	85 c0                	test   %eax,%eax
+  803e86:	78 6e                	js     803ef6 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e88:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e8d:	4c 89 ef             	mov    %r13,%rdi
+  803e90:	48 b8 ab 12 80 00 00 	movabs $0x8012ab,%rax
+  803e97:	00 00 00 
+  803e9a:	ff d0                	call   *%rax
+  803e9c:	83 f8 02             	cmp    $0x2,%eax
+  803e9f:	0f 85 ab 00 00 00    	jne    803f50 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ea5:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803eac:	00 00 
+  803eae:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eb2:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803eb4:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eb8:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ebf:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ec3:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803ec5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ec9:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ed0:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ed4:	48 bb 19 17 80 00 00 	movabs $0x801719,%rbx
+  803edb:	00 00 00 
+  803ede:	ff d3                	call   *%rbx
+  803ee0:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ee4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ee8:	ff d3                	call   *%rbx
+  803eea:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803eef:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ef4:	eb 4d                	jmp    803f43 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803ef6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803efb:	4c 89 ee             	mov    %r13,%rsi
+  803efe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f03:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  803f0a:	00 00 00 
+  803f0d:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f0f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f14:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f18:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f1d:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  803f24:	00 00 00 
+  803f27:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f2e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f32:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f37:	48 b8 8c 13 80 00 00 	movabs $0x80138c,%rax
+  803f3e:	00 00 00 
+  803f41:	ff d0                	call   *%rax
+}
+  803f43:	89 d8                	mov    %ebx,%eax
+  803f45:	48 83 c4 18          	add    $0x18,%rsp
+  803f49:	5b                   	pop    %rbx
+  803f4a:	41 5c                	pop    %r12
+  803f4c:	41 5d                	pop    %r13
+  803f4e:	5d                   	pop    %rbp
+  803f4f:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f50:	48 b9 30 51 80 00 00 	movabs $0x805130,%rcx
+  803f57:	00 00 00 
+  803f5a:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  803f61:	00 00 00 
+  803f64:	be 50 00 00 00       	mov    $0x50,%esi
+  803f69:	48 bf 1c 51 80 00 00 	movabs $0x80511c,%rdi
+  803f70:	00 00 00 
+  803f73:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f78:	49 b8 12 03 80 00 00 	movabs $0x800312,%r8
+  803f7f:	00 00 00 
+  803f82:	41 ff d0             	call   *%r8
+
+0000000000803f85 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f85:	55                   	push   %rbp
+  803f86:	48 89 e5             	mov    %rsp,%rbp
+  803f89:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f8d:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f91:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  803f98:	00 00 00 
+  803f9b:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f9d:	85 c0                	test   %eax,%eax
+  803f9f:	78 23                	js     803fc4 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fa1:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fa5:	48 b8 2b 17 80 00 00 	movabs $0x80172b,%rax
+  803fac:	00 00 00 
+  803faf:	ff d0                	call   *%rax
+  803fb1:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fb4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fb8:	48 b8 c0 3a 80 00 00 	movabs $0x803ac0,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+}
+  803fc4:	c9                   	leave
+  803fc5:	c3                   	ret
+
+0000000000803fc6 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fc6:	48 89 f8             	mov    %rdi,%rax
+  803fc9:	48 c1 e8 27          	shr    $0x27,%rax
+  803fcd:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fd4:	01 00 00 
+  803fd7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fdb:	f6 c2 01             	test   $0x1,%dl
+  803fde:	74 6d                	je     80404d <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fe0:	48 89 f8             	mov    %rdi,%rax
+  803fe3:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fe7:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fee:	01 00 00 
+  803ff1:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ff5:	f6 c2 01             	test   $0x1,%dl
+  803ff8:	74 62                	je     80405c <get_uvpt_entry+0x96>
+  803ffa:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804001:	01 00 00 
+  804004:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804008:	f6 c2 80             	test   $0x80,%dl
+  80400b:	75 4f                	jne    80405c <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80400d:	48 89 f8             	mov    %rdi,%rax
+  804010:	48 c1 e8 15          	shr    $0x15,%rax
+  804014:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80401b:	01 00 00 
+  80401e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804022:	f6 c2 01             	test   $0x1,%dl
+  804025:	74 44                	je     80406b <get_uvpt_entry+0xa5>
+  804027:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80402e:	01 00 00 
+  804031:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804035:	f6 c2 80             	test   $0x80,%dl
+  804038:	75 31                	jne    80406b <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80403a:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80403e:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804045:	01 00 00 
+  804048:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80404c:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80404d:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804054:	01 00 00 
+  804057:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80405b:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80405c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804063:	01 00 00 
+  804066:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80406a:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80406b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804072:	01 00 00 
+  804075:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804079:	c3                   	ret
+
+000000000080407a <get_prot>:
+
+int
+get_prot(void *va) {
+  80407a:	55                   	push   %rbp
+  80407b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80407e:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  804085:	00 00 00 
+  804088:	ff d0                	call   *%rax
+  80408a:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80408d:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804092:	89 c1                	mov    %eax,%ecx
+  804094:	83 c9 04             	or     $0x4,%ecx
+  804097:	f6 c2 01             	test   $0x1,%dl
+  80409a:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80409d:	89 c1                	mov    %eax,%ecx
+  80409f:	83 c9 02             	or     $0x2,%ecx
+  8040a2:	f6 c2 02             	test   $0x2,%dl
+  8040a5:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040a8:	89 c1                	mov    %eax,%ecx
+  8040aa:	83 c9 01             	or     $0x1,%ecx
+  8040ad:	48 85 d2             	test   %rdx,%rdx
+  8040b0:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040b3:	89 c1                	mov    %eax,%ecx
+  8040b5:	83 c9 40             	or     $0x40,%ecx
+  8040b8:	f6 c6 04             	test   $0x4,%dh
+  8040bb:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040be:	5d                   	pop    %rbp
+  8040bf:	c3                   	ret
+
+00000000008040c0 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040c0:	55                   	push   %rbp
+  8040c1:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040c4:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  8040cb:	00 00 00 
+  8040ce:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040d0:	48 c1 e8 06          	shr    $0x6,%rax
+  8040d4:	83 e0 01             	and    $0x1,%eax
+}
+  8040d7:	5d                   	pop    %rbp
+  8040d8:	c3                   	ret
+
+00000000008040d9 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040d9:	55                   	push   %rbp
+  8040da:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040dd:	48 b8 c6 3f 80 00 00 	movabs $0x803fc6,%rax
+  8040e4:	00 00 00 
+  8040e7:	ff d0                	call   *%rax
+  8040e9:	83 e0 01             	and    $0x1,%eax
+}
+  8040ec:	5d                   	pop    %rbp
+  8040ed:	c3                   	ret
+
+00000000008040ee <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8040ee:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8040f5:	01 00 00 
+  8040f8:	a8 01                	test   $0x1,%al
+  8040fa:	75 06                	jne    804102 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8040fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  804101:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804102:	55                   	push   %rbp
+  804103:	48 89 e5             	mov    %rsp,%rbp
+  804106:	41 57                	push   %r15
+  804108:	41 56                	push   %r14
+  80410a:	41 55                	push   %r13
+  80410c:	41 54                	push   %r12
+  80410e:	53                   	push   %rbx
+  80410f:	48 83 ec 28          	sub    $0x28,%rsp
+  804113:	49 89 fe             	mov    %rdi,%r14
+  804116:	49 89 f7             	mov    %rsi,%r15
+  804119:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804120:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804121:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  804128:	01 00 00 
+  80412b:	e9 ae 00 00 00       	jmp    8041de <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804130:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  804137:	49 83 ec 01          	sub    $0x1,%r12
+  80413b:	74 2d                	je     80416a <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  80413d:	48 89 d8             	mov    %rbx,%rax
+  804140:	48 c1 e8 0c          	shr    $0xc,%rax
+  804144:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804149:	f6 c2 01             	test   $0x1,%dl
+  80414c:	74 e2                	je     804130 <foreach_shared_region+0x42>
+  80414e:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804153:	f6 c4 04             	test   $0x4,%ah
+  804156:	74 d8                	je     804130 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  804158:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  80415f:	4c 89 fa             	mov    %r15,%rdx
+  804162:	48 89 df             	mov    %rbx,%rdi
+  804165:	41 ff d6             	call   *%r14
+  804168:	eb c6                	jmp    804130 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80416a:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804171:	00 
+  804172:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804177:	74 4a                	je     8041c3 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804179:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80417d:	48 c1 e8 15          	shr    $0x15,%rax
+  804181:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804188:	01 00 00 
+  80418b:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80418f:	a8 01                	test   $0x1,%al
+  804191:	74 d7                	je     80416a <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804193:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804197:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  80419e:	48 39 c3             	cmp    %rax,%rbx
+  8041a1:	73 c7                	jae    80416a <foreach_shared_region+0x7c>
+  8041a3:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041aa:	48 39 d0             	cmp    %rdx,%rax
+  8041ad:	4d 19 e4             	sbb    %r12,%r12
+  8041b0:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041b7:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041be:	e9 7a ff ff ff       	jmp    80413d <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041c3:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041ca:	40 
+  8041cb:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041cf:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041d6:	00 00 00 
+  8041d9:	48 39 c1             	cmp    %rax,%rcx
+  8041dc:	74 50                	je     80422e <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041de:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041e2:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041e6:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8041ed:	01 00 00 
+  8041f0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041f4:	a8 01                	test   $0x1,%al
+  8041f6:	74 cb                	je     8041c3 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8041f8:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041fc:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804203:	48 39 c1             	cmp    %rax,%rcx
+  804206:	73 bb                	jae    8041c3 <foreach_shared_region+0xd5>
+  804208:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  80420f:	48 39 d0             	cmp    %rdx,%rax
+  804212:	48 19 c0             	sbb    %rax,%rax
+  804215:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80421b:	48 05 00 02 00 00    	add    $0x200,%rax
+  804221:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804225:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804229:	e9 4b ff ff ff       	jmp    804179 <foreach_shared_region+0x8b>
+  80422e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804233:	48 83 c4 28          	add    $0x28,%rsp
+  804237:	5b                   	pop    %rbx
+  804238:	41 5c                	pop    %r12
+  80423a:	41 5d                	pop    %r13
+  80423c:	41 5e                	pop    %r14
+  80423e:	41 5f                	pop    %r15
+  804240:	5d                   	pop    %rbp
+  804241:	c3                   	ret
+
+0000000000804242 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804242:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  804248:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  80424f:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  804256:	c3                   	ret
+
+0000000000804257 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  804257:	8b 47 40             	mov    0x40(%rdi),%eax
+  80425a:	8b 17                	mov    (%rdi),%edx
+  80425c:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80425e:	83 f8 0f             	cmp    $0xf,%eax
+  804261:	77 13                	ja     804276 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804263:	8b 47 40             	mov    0x40(%rdi),%eax
+  804266:	83 e0 0f             	and    $0xf,%eax
+  804269:	48 c1 e0 09          	shl    $0x9,%rax
+  80426d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804274:	00 
+  804275:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804276:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80427b:	c3                   	ret
+
+000000000080427c <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80427c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80427f:	83 c0 01             	add    $0x1,%eax
+  804282:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804285:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80428b:	8b 57 04             	mov    0x4(%rdi),%edx
+  80428e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804293:	85 d2                	test   %edx,%edx
+  804295:	75 04                	jne    80429b <chan_publish+0x1f>
+  804297:	83 e0 01             	and    $0x1,%eax
+}
+  80429a:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80429b:	87 47 04             	xchg   %eax,0x4(%rdi)
+  80429e:	85 c0                	test   %eax,%eax
+  8042a0:	0f 95 c0             	setne  %al
+  8042a3:	0f b6 c0             	movzbl %al,%eax
+  8042a6:	eb ef                	jmp    804297 <chan_publish+0x1b>
+
+00000000008042a8 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042a8:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042ab:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042ad:	29 d0                	sub    %edx,%eax
+  8042af:	83 e8 01             	sub    $0x1,%eax
+  8042b2:	83 f8 0f             	cmp    $0xf,%eax
+  8042b5:	77 12                	ja     8042c9 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042b7:	8b 07                	mov    (%rdi),%eax
+  8042b9:	83 e0 0f             	and    $0xf,%eax
+  8042bc:	48 c1 e0 09          	shl    $0x9,%rax
+  8042c0:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042c7:	00 
+  8042c8:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042c9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042ce:	c3                   	ret
+
+00000000008042cf <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042cf:	8b 07                	mov    (%rdi),%eax
+  8042d1:	83 c0 01             	add    $0x1,%eax
+  8042d4:	89 07                	mov    %eax,(%rdi)
+}
+  8042d6:	c3                   	ret
+
+00000000008042d7 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042d7:	55                   	push   %rbp
+  8042d8:	48 89 e5             	mov    %rsp,%rbp
+  8042db:	53                   	push   %rbx
+  8042dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8042e0:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8042e3:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042ea:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8042f0:	48 b8 a8 42 80 00 00 	movabs $0x8042a8,%rax
+  8042f7:	00 00 00 
+  8042fa:	ff d0                	call   *%rax
+  8042fc:	48 85 c0             	test   %rax,%rax
+  8042ff:	74 12                	je     804313 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804301:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  804308:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80430d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804311:	c9                   	leave
+  804312:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804313:	b8 01 00 00 00       	mov    $0x1,%eax
+  804318:	eb f3                	jmp    80430d <chan_arm+0x36>
+
+000000000080431a <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80431a:	55                   	push   %rbp
+  80431b:	48 89 e5             	mov    %rsp,%rbp
+  80431e:	41 56                	push   %r14
+  804320:	41 55                	push   %r13
+  804322:	41 54                	push   %r12
+  804324:	53                   	push   %rbx
+  804325:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  804328:	49 bc d7 42 80 00 00 	movabs $0x8042d7,%r12
+  80432f:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804332:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  804336:	49 bd 54 16 80 00 00 	movabs $0x801654,%r13
+  80433d:	00 00 00 
+    while (chan_arm(r))
+  804340:	eb 0d                	jmp    80434f <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804342:	8b 33                	mov    (%rbx),%esi
+  804344:	ba 00 00 00 00       	mov    $0x0,%edx
+  804349:	4c 89 f7             	mov    %r14,%rdi
+  80434c:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  80434f:	48 89 df             	mov    %rbx,%rdi
+  804352:	41 ff d4             	call   *%r12
+  804355:	84 c0                	test   %al,%al
+  804357:	75 e9                	jne    804342 <chan_wait+0x28>
+}
+  804359:	5b                   	pop    %rbx
+  80435a:	41 5c                	pop    %r12
+  80435c:	41 5d                	pop    %r13
+  80435e:	41 5e                	pop    %r14
+  804360:	5d                   	pop    %rbp
+  804361:	c3                   	ret
+
+0000000000804362 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804362:	55                   	push   %rbp
+  804363:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804366:	48 83 c7 40          	add    $0x40,%rdi
+  80436a:	be 01 00 00 00       	mov    $0x1,%esi
+  80436f:	48 b8 72 16 80 00 00 	movabs $0x801672,%rax
+  804376:	00 00 00 
+  804379:	ff d0                	call   *%rax
+}
+  80437b:	5d                   	pop    %rbp
+  80437c:	c3                   	ret
+
+000000000080437d <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80437d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804382:	c3                   	ret
+
+0000000000804383 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804383:	55                   	push   %rbp
+  804384:	48 89 e5             	mov    %rsp,%rbp
+  804387:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80438a:	48 be 54 51 80 00 00 	movabs $0x805154,%rsi
+  804391:	00 00 00 
+  804394:	48 b8 87 0d 80 00 00 	movabs $0x800d87,%rax
+  80439b:	00 00 00 
+  80439e:	ff d0                	call   *%rax
+    return 0;
+}
+  8043a0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a5:	5d                   	pop    %rbp
+  8043a6:	c3                   	ret
+
+00000000008043a7 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043a7:	55                   	push   %rbp
+  8043a8:	48 89 e5             	mov    %rsp,%rbp
+  8043ab:	41 57                	push   %r15
+  8043ad:	41 56                	push   %r14
+  8043af:	41 55                	push   %r13
+  8043b1:	41 54                	push   %r12
+  8043b3:	53                   	push   %rbx
+  8043b4:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043bb:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043c2:	48 85 d2             	test   %rdx,%rdx
+  8043c5:	74 7a                	je     804441 <devcons_write+0x9a>
+  8043c7:	49 89 d6             	mov    %rdx,%r14
+  8043ca:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043d0:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043d5:	49 bf 81 0f 80 00 00 	movabs $0x800f81,%r15
+  8043dc:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043df:	4c 89 f3             	mov    %r14,%rbx
+  8043e2:	48 29 f3             	sub    %rsi,%rbx
+  8043e5:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043ea:	48 39 c3             	cmp    %rax,%rbx
+  8043ed:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8043f1:	4c 63 eb             	movslq %ebx,%r13
+  8043f4:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8043fb:	48 01 c6             	add    %rax,%rsi
+  8043fe:	4c 89 ea             	mov    %r13,%rdx
+  804401:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804408:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80440b:	4c 89 ee             	mov    %r13,%rsi
+  80440e:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804415:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  80441c:	00 00 00 
+  80441f:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804421:	41 01 dc             	add    %ebx,%r12d
+  804424:	49 63 f4             	movslq %r12d,%rsi
+  804427:	4c 39 f6             	cmp    %r14,%rsi
+  80442a:	72 b3                	jb     8043df <devcons_write+0x38>
+    return res;
+  80442c:	49 63 c4             	movslq %r12d,%rax
+}
+  80442f:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  804436:	5b                   	pop    %rbx
+  804437:	41 5c                	pop    %r12
+  804439:	41 5d                	pop    %r13
+  80443b:	41 5e                	pop    %r14
+  80443d:	41 5f                	pop    %r15
+  80443f:	5d                   	pop    %rbp
+  804440:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804441:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804447:	eb e3                	jmp    80442c <devcons_write+0x85>
+
+0000000000804449 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804449:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  80444c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804451:	48 85 c0             	test   %rax,%rax
+  804454:	74 55                	je     8044ab <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804456:	55                   	push   %rbp
+  804457:	48 89 e5             	mov    %rsp,%rbp
+  80445a:	41 55                	push   %r13
+  80445c:	41 54                	push   %r12
+  80445e:	53                   	push   %rbx
+  80445f:	48 83 ec 08          	sub    $0x8,%rsp
+  804463:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804466:	48 bb cd 11 80 00 00 	movabs $0x8011cd,%rbx
+  80446d:	00 00 00 
+  804470:	49 bc 82 12 80 00 00 	movabs $0x801282,%r12
+  804477:	00 00 00 
+  80447a:	eb 03                	jmp    80447f <devcons_read+0x36>
+  80447c:	41 ff d4             	call   *%r12
+  80447f:	ff d3                	call   *%rbx
+  804481:	85 c0                	test   %eax,%eax
+  804483:	74 f7                	je     80447c <devcons_read+0x33>
+    if (c < 0) return c;
+  804485:	48 63 d0             	movslq %eax,%rdx
+  804488:	78 13                	js     80449d <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80448a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80448f:	83 f8 04             	cmp    $0x4,%eax
+  804492:	74 09                	je     80449d <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804494:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804498:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80449d:	48 89 d0             	mov    %rdx,%rax
+  8044a0:	48 83 c4 08          	add    $0x8,%rsp
+  8044a4:	5b                   	pop    %rbx
+  8044a5:	41 5c                	pop    %r12
+  8044a7:	41 5d                	pop    %r13
+  8044a9:	5d                   	pop    %rbp
+  8044aa:	c3                   	ret
+  8044ab:	48 89 d0             	mov    %rdx,%rax
+  8044ae:	c3                   	ret
+
+00000000008044af <cputchar>:
+cputchar(int ch) {
+  8044af:	55                   	push   %rbp
+  8044b0:	48 89 e5             	mov    %rsp,%rbp
+  8044b3:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044b7:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044bb:	be 01 00 00 00       	mov    $0x1,%esi
+  8044c0:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044c4:	48 b8 ae 11 80 00 00 	movabs $0x8011ae,%rax
+  8044cb:	00 00 00 
+  8044ce:	ff d0                	call   *%rax
+}
+  8044d0:	c9                   	leave
+  8044d1:	c3                   	ret
+
+00000000008044d2 <getchar>:
+getchar(void) {
+  8044d2:	55                   	push   %rbp
+  8044d3:	48 89 e5             	mov    %rsp,%rbp
+  8044d6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044da:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044df:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044e8:	48 b8 8a 1a 80 00 00 	movabs $0x801a8a,%rax
+  8044ef:	00 00 00 
+  8044f2:	ff d0                	call   *%rax
+  8044f4:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8044f6:	85 c0                	test   %eax,%eax
+  8044f8:	78 06                	js     804500 <getchar+0x2e>
+  8044fa:	74 08                	je     804504 <getchar+0x32>
+  8044fc:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804500:	89 d0                	mov    %edx,%eax
+  804502:	c9                   	leave
+  804503:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804504:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804509:	eb f5                	jmp    804500 <getchar+0x2e>
+
+000000000080450b <iscons>:
+iscons(int fdnum) {
+  80450b:	55                   	push   %rbp
+  80450c:	48 89 e5             	mov    %rsp,%rbp
+  80450f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804513:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804517:	48 b8 a7 17 80 00 00 	movabs $0x8017a7,%rax
+  80451e:	00 00 00 
+  804521:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804523:	85 c0                	test   %eax,%eax
+  804525:	78 18                	js     80453f <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  804527:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80452b:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804532:	00 00 00 
+  804535:	8b 00                	mov    (%rax),%eax
+  804537:	39 02                	cmp    %eax,(%rdx)
+  804539:	0f 94 c0             	sete   %al
+  80453c:	0f b6 c0             	movzbl %al,%eax
+}
+  80453f:	c9                   	leave
+  804540:	c3                   	ret
+
+0000000000804541 <opencons>:
+opencons(void) {
+  804541:	55                   	push   %rbp
+  804542:	48 89 e5             	mov    %rsp,%rbp
+  804545:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804549:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  80454d:	48 b8 47 17 80 00 00 	movabs $0x801747,%rax
+  804554:	00 00 00 
+  804557:	ff d0                	call   *%rax
+  804559:	85 c0                	test   %eax,%eax
+  80455b:	78 49                	js     8045a6 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  80455d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804562:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804567:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80456b:	bf 00 00 00 00       	mov    $0x0,%edi
+  804570:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  804577:	00 00 00 
+  80457a:	ff d0                	call   *%rax
+  80457c:	85 c0                	test   %eax,%eax
+  80457e:	78 26                	js     8045a6 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804580:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804584:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80458b:	00 00 
+  80458d:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  80458f:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804593:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80459a:	48 b8 19 17 80 00 00 	movabs $0x801719,%rax
+  8045a1:	00 00 00 
+  8045a4:	ff d0                	call   *%rax
+}
+  8045a6:	c9                   	leave
+  8045a7:	c3                   	ret
+
+00000000008045a8 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8045a8:	55                   	push   %rbp
+  8045a9:	48 89 e5             	mov    %rsp,%rbp
+  8045ac:	41 56                	push   %r14
+  8045ae:	41 55                	push   %r13
+  8045b0:	41 54                	push   %r12
+  8045b2:	53                   	push   %rbx
+  8045b3:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045b6:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045bd:	00 00 00 
+  8045c0:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8045c4:	74 27                	je     8045ed <_handle_vectored_pagefault+0x45>
+  8045c6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8045cb:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8045d2:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045d5:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8045d8:	4c 89 e7             	mov    %r12,%rdi
+  8045db:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8045e0:	84 c0                	test   %al,%al
+  8045e2:	75 45                	jne    804629 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045e4:	48 83 c3 01          	add    $0x1,%rbx
+  8045e8:	49 3b 1e             	cmp    (%r14),%rbx
+  8045eb:	72 eb                	jb     8045d8 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8045ed:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8045f4:	00 
+  8045f5:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8045fa:	4d 8b 04 24          	mov    (%r12),%r8
+  8045fe:	48 ba 60 51 80 00 00 	movabs $0x805160,%rdx
+  804605:	00 00 00 
+  804608:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80460d:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  804614:	00 00 00 
+  804617:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461c:	49 ba 12 03 80 00 00 	movabs $0x800312,%r10
+  804623:	00 00 00 
+  804626:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804629:	5b                   	pop    %rbx
+  80462a:	41 5c                	pop    %r12
+  80462c:	41 5d                	pop    %r13
+  80462e:	41 5e                	pop    %r14
+  804630:	5d                   	pop    %rbp
+  804631:	c3                   	ret
+
+0000000000804632 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804632:	55                   	push   %rbp
+  804633:	48 89 e5             	mov    %rsp,%rbp
+  804636:	53                   	push   %rbx
+  804637:	48 83 ec 08          	sub    $0x8,%rsp
+  80463b:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80463e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804645:	00 00 00 
+  804648:	80 38 00             	cmpb   $0x0,(%rax)
+  80464b:	0f 84 84 00 00 00    	je     8046d5 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804651:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804658:	00 00 00 
+  80465b:	48 8b 10             	mov    (%rax),%rdx
+  80465e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  804663:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  80466a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80466d:	48 85 d2             	test   %rdx,%rdx
+  804670:	74 19                	je     80468b <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804672:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804676:	0f 84 e8 00 00 00    	je     804764 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80467c:	48 83 c0 01          	add    $0x1,%rax
+  804680:	48 39 d0             	cmp    %rdx,%rax
+  804683:	75 ed                	jne    804672 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804685:	48 83 fa 08          	cmp    $0x8,%rdx
+  804689:	74 1c                	je     8046a7 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80468b:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  80468f:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804696:	00 00 00 
+  804699:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046a0:	00 00 00 
+  8046a3:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8046a7:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  8046ae:	00 00 00 
+  8046b1:	ff d0                	call   *%rax
+  8046b3:	89 c7                	mov    %eax,%edi
+  8046b5:	48 be 2a 48 80 00 00 	movabs $0x80482a,%rsi
+  8046bc:	00 00 00 
+  8046bf:	48 b8 a4 14 80 00 00 	movabs $0x8014a4,%rax
+  8046c6:	00 00 00 
+  8046c9:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8046cb:	85 c0                	test   %eax,%eax
+  8046cd:	78 68                	js     804737 <add_pgfault_handler+0x105>
+    return res;
+}
+  8046cf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8046d3:	c9                   	leave
+  8046d4:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8046d5:	48 b8 59 12 80 00 00 	movabs $0x801259,%rax
+  8046dc:	00 00 00 
+  8046df:	ff d0                	call   *%rax
+  8046e1:	89 c7                	mov    %eax,%edi
+  8046e3:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8046e8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8046ed:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8046f4:	00 00 00 
+  8046f7:	48 b8 e6 12 80 00 00 	movabs $0x8012e6,%rax
+  8046fe:	00 00 00 
+  804701:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804703:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80470a:	00 00 00 
+  80470d:	48 8b 02             	mov    (%rdx),%rax
+  804710:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804714:	48 89 0a             	mov    %rcx,(%rdx)
+  804717:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80471e:	00 00 00 
+  804721:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804725:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80472c:	00 00 00 
+  80472f:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804732:	e9 70 ff ff ff       	jmp    8046a7 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804737:	89 c1                	mov    %eax,%ecx
+  804739:	48 ba 9e 51 80 00 00 	movabs $0x80519e,%rdx
+  804740:	00 00 00 
+  804743:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804748:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  80474f:	00 00 00 
+  804752:	b8 00 00 00 00       	mov    $0x0,%eax
+  804757:	49 b8 12 03 80 00 00 	movabs $0x800312,%r8
+  80475e:	00 00 00 
+  804761:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  804764:	b8 00 00 00 00       	mov    $0x0,%eax
+  804769:	e9 61 ff ff ff       	jmp    8046cf <add_pgfault_handler+0x9d>
+
+000000000080476e <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  80476e:	55                   	push   %rbp
+  80476f:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804772:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804779:	00 00 00 
+  80477c:	80 38 00             	cmpb   $0x0,(%rax)
+  80477f:	74 33                	je     8047b4 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804781:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804788:	00 00 00 
+  80478b:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804790:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804797:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80479a:	48 85 c0             	test   %rax,%rax
+  80479d:	0f 84 85 00 00 00    	je     804828 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8047a3:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8047a7:	74 40                	je     8047e9 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047a9:	48 83 c1 01          	add    $0x1,%rcx
+  8047ad:	48 39 c1             	cmp    %rax,%rcx
+  8047b0:	75 f1                	jne    8047a3 <remove_pgfault_handler+0x35>
+  8047b2:	eb 74                	jmp    804828 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8047b4:	48 b9 b6 51 80 00 00 	movabs $0x8051b6,%rcx
+  8047bb:	00 00 00 
+  8047be:	48 ba 07 51 80 00 00 	movabs $0x805107,%rdx
+  8047c5:	00 00 00 
+  8047c8:	be 43 00 00 00       	mov    $0x43,%esi
+  8047cd:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  8047d4:	00 00 00 
+  8047d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047dc:	49 b8 12 03 80 00 00 	movabs $0x800312,%r8
+  8047e3:	00 00 00 
+  8047e6:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8047e9:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8047f0:	00 
+  8047f1:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8047f5:	48 29 ca             	sub    %rcx,%rdx
+  8047f8:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8047ff:	00 00 00 
+  804802:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804806:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80480b:	48 89 ce             	mov    %rcx,%rsi
+  80480e:	48 b8 81 0f 80 00 00 	movabs $0x800f81,%rax
+  804815:	00 00 00 
+  804818:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  80481a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804821:	00 00 00 
+  804824:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804828:	5d                   	pop    %rbp
+  804829:	c3                   	ret
+
+000000000080482a <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  80482a:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80482d:	48 b8 a8 45 80 00 00 	movabs $0x8045a8,%rax
+  804834:	00 00 00 
+    call *%rax
+  804837:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804839:	41 5f                	pop    %r15
+	popq %r15
+  80483b:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80483d:	41 5f                	pop    %r15
+	popq %r14
+  80483f:	41 5e                	pop    %r14
+	popq %r13
+  804841:	41 5d                	pop    %r13
+	popq %r12
+  804843:	41 5c                	pop    %r12
+	popq %r11
+  804845:	41 5b                	pop    %r11
+	popq %r10
+  804847:	41 5a                	pop    %r10
+	popq %r9
+  804849:	41 59                	pop    %r9
+	popq %r8
+  80484b:	41 58                	pop    %r8
+	popq %rsi
+  80484d:	5e                   	pop    %rsi
+	popq %rdi
+  80484e:	5f                   	pop    %rdi
+	popq %rbp
+  80484f:	5d                   	pop    %rbp
+	popq %rdx
+  804850:	5a                   	pop    %rdx
+	popq %rcx
+  804851:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804852:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804857:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  80485c:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804860:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  804863:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804868:	5b                   	pop    %rbx
+	popq %rax
+  804869:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80486a:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  80486e:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  80486f:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804874:	c3                   	ret
+
+0000000000804875 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  804875:	55                   	push   %rbp
+  804876:	48 89 e5             	mov    %rsp,%rbp
+  804879:	41 55                	push   %r13
+  80487b:	41 54                	push   %r12
+  80487d:	53                   	push   %rbx
+  80487e:	48 83 ec 08          	sub    $0x8,%rsp
+  804882:	49 89 fd             	mov    %rdi,%r13
+  804885:	48 89 f7             	mov    %rsi,%rdi
+  804888:	48 89 d3             	mov    %rdx,%rbx
+  80488b:	49 89 cc             	mov    %rcx,%r12
+  80488e:	4c 89 c2             	mov    %r8,%rdx
+  804891:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804894:	48 85 f6             	test   %rsi,%rsi
+  804897:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80489e:	00 00 00 
+  8048a1:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8048a5:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048aa:	48 85 db             	test   %rbx,%rbx
+  8048ad:	74 03                	je     8048b2 <ipc_recv_futex+0x3d>
+  8048af:	48 8b 33             	mov    (%rbx),%rsi
+  8048b2:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8048b6:	48 b8 30 15 80 00 00 	movabs $0x801530,%rax
+  8048bd:	00 00 00 
+  8048c0:	ff d0                	call   *%rax
+    if (res < 0) {
+  8048c2:	85 c0                	test   %eax,%eax
+  8048c4:	78 75                	js     80493b <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8048c6:	4d 85 ed             	test   %r13,%r13
+  8048c9:	74 14                	je     8048df <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8048cb:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8048d2:	00 00 00 
+  8048d5:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8048db:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8048df:	4d 85 e4             	test   %r12,%r12
+  8048e2:	74 14                	je     8048f8 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8048e4:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8048eb:	00 00 00 
+  8048ee:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8048f4:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8048f8:	48 85 db             	test   %rbx,%rbx
+  8048fb:	74 23                	je     804920 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8048fd:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804904:	00 00 00 
+  804907:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  80490d:	ba 00 00 00 00       	mov    $0x0,%edx
+  804912:	85 c9                	test   %ecx,%ecx
+  804914:	74 07                	je     80491d <ipc_recv_futex+0xa8>
+  804916:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  80491d:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804920:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  804927:	00 00 00 
+  80492a:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804930:	48 83 c4 08          	add    $0x8,%rsp
+  804934:	5b                   	pop    %rbx
+  804935:	41 5c                	pop    %r12
+  804937:	41 5d                	pop    %r13
+  804939:	5d                   	pop    %rbp
+  80493a:	c3                   	ret
+        if (from_env_store != NULL) {
+  80493b:	4d 85 ed             	test   %r13,%r13
+  80493e:	74 08                	je     804948 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804940:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  804947:	00 
+        if (perm_store != NULL) {
+  804948:	4d 85 e4             	test   %r12,%r12
+  80494b:	74 08                	je     804955 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  80494d:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  804954:	00 
+        if (size != NULL) {
+  804955:	48 85 db             	test   %rbx,%rbx
+  804958:	74 d6                	je     804930 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80495a:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804961:	eb cd                	jmp    804930 <ipc_recv_futex+0xbb>
+
+0000000000804963 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  804963:	55                   	push   %rbp
+  804964:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804967:	48 83 ec 08          	sub    $0x8,%rsp
+  80496b:	6a 00                	push   $0x0
+  80496d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804973:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804979:	48 b8 75 48 80 00 00 	movabs $0x804875,%rax
+  804980:	00 00 00 
+  804983:	ff d0                	call   *%rax
+}
+  804985:	c9                   	leave
+  804986:	c3                   	ret
+
+0000000000804987 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804987:	55                   	push   %rbp
+  804988:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80498b:	48 85 d2             	test   %rdx,%rdx
+  80498e:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804995:	00 00 00 
+  804998:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80499c:	89 f6                	mov    %esi,%esi
+  80499e:	48 b8 19 15 80 00 00 	movabs $0x801519,%rax
+  8049a5:	00 00 00 
+  8049a8:	ff d0                	call   *%rax
+    if (res < 0) {
+  8049aa:	85 c0                	test   %eax,%eax
+  8049ac:	78 02                	js     8049b0 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8049ae:	5d                   	pop    %rbp
+  8049af:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8049b0:	89 c1                	mov    %eax,%ecx
+  8049b2:	48 ba d0 51 80 00 00 	movabs $0x8051d0,%rdx
+  8049b9:	00 00 00 
+  8049bc:	be 50 00 00 00       	mov    $0x50,%esi
+  8049c1:	48 bf e4 51 80 00 00 	movabs $0x8051e4,%rdi
+  8049c8:	00 00 00 
+  8049cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049d0:	49 b8 12 03 80 00 00 	movabs $0x800312,%r8
+  8049d7:	00 00 00 
+  8049da:	41 ff d0             	call   *%r8
+
+00000000008049dd <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8049dd:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8049e2:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8049e9:	00 00 00 
+  8049ec:	48 89 d0             	mov    %rdx,%rax
+  8049ef:	48 c1 e0 04          	shl    $0x4,%rax
+  8049f3:	48 29 d0             	sub    %rdx,%rax
+  8049f6:	48 c1 e0 05          	shl    $0x5,%rax
+  8049fa:	48 01 c8             	add    %rcx,%rax
+  8049fd:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804a03:	39 f8                	cmp    %edi,%eax
+  804a05:	74 13                	je     804a1a <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804a07:	48 83 c2 01          	add    $0x1,%rdx
+  804a0b:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804a12:	75 d8                	jne    8049ec <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804a14:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a19:	c3                   	ret
+            return envs[i].env_id;
+  804a1a:	48 89 d0             	mov    %rdx,%rax
+  804a1d:	48 c1 e0 04          	shl    $0x4,%rax
+  804a21:	48 29 d0             	sub    %rdx,%rax
+  804a24:	48 c1 e0 05          	shl    $0x5,%rax
+  804a28:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a2f:	00 00 00 
+  804a32:	48 01 d0             	add    %rdx,%rax
+  804a35:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804a3b:	c3                   	ret
+  804a3c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804a40 <__rodata_start>:
+  804a40:	25 35 64 20 00       	and    $0x206435,%eax
+  804a45:	77 72                	ja     804ab9 <__rodata_start+0x79>
+  804a47:	69 74 65 20 65 72 72 	imul   $0x6f727265,0x20(%rbp,%riz,2),%esi
+  804a4e:	6f 
+  804a4f:	72 20                	jb     804a71 <__rodata_start+0x31>
+  804a51:	63 6f 70             	movsxd 0x70(%rdi),%ebp
+  804a54:	79 69                	jns    804abf <__rodata_start+0x7f>
+  804a56:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a57:	67 20 25 73 3a 20 25 	and    %ah,0x25203a73(%eip)        # 25a084d1 <__bss_end+0x251c64d1>
+  804a5e:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  804a64:	2f                   	(bad)
+  804a65:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a66:	75 6d                	jne    804ad5 <__rodata_start+0x95>
+  804a68:	2e 63 00             	cs movsxd (%rax),%eax
+  804a6b:	65 72 72             	gs jb  804ae0 <__rodata_start+0xa0>
+  804a6e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a6f:	72 20                	jb     804a91 <__rodata_start+0x51>
+  804a71:	72 65                	jb     804ad8 <__rodata_start+0x98>
+  804a73:	61                   	(bad)
+  804a74:	64 69 6e 67 20 25 73 	imul   $0x3a732520,%fs:0x67(%rsi),%ebp
+  804a7b:	3a 
+  804a7c:	20 25 69 00 6e 75    	and    %ah,0x756e0069(%rip)        # 75ee4aeb <__bss_end+0x756a2aeb>
+  804a82:	6d                   	insl   (%dx),%es:(%rdi)
+  804a83:	00 3c 73             	add    %bh,(%rbx,%rsi,2)
+  804a86:	74 64                	je     804aec <__rodata_start+0xac>
+  804a88:	69 6e 3e 00 63 61 6e 	imul   $0x6e616300,0x3e(%rsi),%ebp
+  804a8f:	27                   	(bad)
+  804a90:	74 20                	je     804ab2 <__rodata_start+0x72>
+  804a92:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a93:	70 65                	jo     804afa <__rodata_start+0xba>
+  804a95:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a96:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a0850f <__bss_end+0x251c650f>
+  804a9c:	69 00 3c 75 6e 6b    	imul   $0x6b6e753c,(%rax),%eax
+  804aa2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aa3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aa4:	77 6e                	ja     804b14 <__rodata_start+0xd4>
+  804aa6:	3e 00 5b 25          	ds add %bl,0x25(%rbx)
+  804aaa:	30 38                	xor    %bh,(%rax)
+  804aac:	78 5d                	js     804b0b <__rodata_start+0xcb>
+  804aae:	20 75 73             	and    %dh,0x73(%rbp)
+  804ab1:	65 72 20             	gs jb  804ad4 <__rodata_start+0x94>
+  804ab4:	70 61                	jo     804b17 <__rodata_start+0xd7>
+  804ab6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ab7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804abe:	73 20                	jae    804ae0 <__rodata_start+0xa0>
+  804ac0:	61                   	(bad)
+  804ac1:	74 20                	je     804ae3 <__rodata_start+0xa3>
+  804ac3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804ac8:	3a 20                	cmp    (%rax),%ah
+  804aca:	00 30                	add    %dh,(%rax)
+  804acc:	31 32                	xor    %esi,(%rdx)
+  804ace:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ad5:	41                   	rex.B
+  804ad6:	42                   	rex.X
+  804ad7:	43                   	rex.XB
+  804ad8:	44                   	rex.R
+  804ad9:	45                   	rex.RB
+  804ada:	46 00 30             	rex.RX add %r14b,(%rax)
+  804add:	31 32                	xor    %esi,(%rdx)
+  804adf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804ae6:	61                   	(bad)
+  804ae7:	62 63 64 65 66       	(bad)
+  804aec:	00 28                	add    %ch,(%rax)
+  804aee:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aef:	75 6c                	jne    804b5d <__rodata_start+0x11d>
+  804af1:	6c                   	insb   (%dx),%es:(%rdi)
+  804af2:	29 00                	sub    %eax,(%rax)
+  804af4:	65 72 72             	gs jb  804b69 <__rodata_start+0x129>
+  804af7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804af8:	72 20                	jb     804b1a <__rodata_start+0xda>
+  804afa:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804aff:	73 70                	jae    804b71 <__rodata_start+0x131>
+  804b01:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804b05:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804b0c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b0d:	72 00                	jb     804b0f <__rodata_start+0xcf>
+  804b0f:	62 61 64 20 65       	(bad)
+  804b14:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b15:	76 69                	jbe    804b80 <__rodata_start+0x140>
+  804b17:	72 6f                	jb     804b88 <__rodata_start+0x148>
+  804b19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b1a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b1b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b1d:	74 00                	je     804b1f <__rodata_start+0xdf>
+  804b1f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b26:	20 70 61             	and    %dh,0x61(%rax)
+  804b29:	72 61                	jb     804b8c <__rodata_start+0x14c>
+  804b2b:	6d                   	insl   (%dx),%es:(%rdi)
+  804b2c:	65 74 65             	gs je  804b94 <__rodata_start+0x154>
+  804b2f:	72 00                	jb     804b31 <__rodata_start+0xf1>
+  804b31:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b32:	75 74                	jne    804ba8 <__rodata_start+0x168>
+  804b34:	20 6f 66             	and    %ch,0x66(%rdi)
+  804b37:	20 6d 65             	and    %ch,0x65(%rbp)
+  804b3a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b3b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b3c:	72 79                	jb     804bb7 <__rodata_start+0x177>
+  804b3e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804b41:	74 20                	je     804b63 <__rodata_start+0x123>
+  804b43:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b44:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804b48:	76 69                	jbe    804bb3 <__rodata_start+0x173>
+  804b4a:	72 6f                	jb     804bbb <__rodata_start+0x17b>
+  804b4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b4d:	6d                   	insl   (%dx),%es:(%rdi)
+  804b4e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b50:	74 73                	je     804bc5 <__rodata_start+0x185>
+  804b52:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804b55:	72 72                	jb     804bc9 <__rodata_start+0x189>
+  804b57:	75 70                	jne    804bc9 <__rodata_start+0x189>
+  804b59:	74 65                	je     804bc0 <__rodata_start+0x180>
+  804b5b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804b60:	75 67                	jne    804bc9 <__rodata_start+0x189>
+  804b62:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804b65:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804b67:	00 73 65             	add    %dh,0x65(%rbx)
+  804b6a:	67 6d                	insl   (%dx),%es:(%edi)
+  804b6c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b6e:	74 61                	je     804bd1 <__rodata_start+0x191>
+  804b70:	74 69                	je     804bdb <__rodata_start+0x19b>
+  804b72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b73:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b74:	20 66 61             	and    %ah,0x61(%rsi)
+  804b77:	75 6c                	jne    804be5 <__rodata_start+0x1a5>
+  804b79:	74 00                	je     804b7b <__rodata_start+0x13b>
+  804b7b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804b82:	20 45 4c             	and    %al,0x4c(%rbp)
+  804b85:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804b89:	61                   	(bad)
+  804b8a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804b8f:	20 73 75             	and    %dh,0x75(%rbx)
+  804b92:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804b95:	73 79                	jae    804c10 <__rodata_start+0x1d0>
+  804b97:	73 74                	jae    804c0d <__rodata_start+0x1cd>
+  804b99:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804b9b:	20 63 61             	and    %ah,0x61(%rbx)
+  804b9e:	6c                   	insb   (%dx),%es:(%rdi)
+  804b9f:	6c                   	insb   (%dx),%es:(%rdi)
+  804ba0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804ba3:	74 72                	je     804c17 <__rodata_start+0x1d7>
+  804ba5:	79 20                	jns    804bc7 <__rodata_start+0x187>
+  804ba7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ba8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ba9:	74 20                	je     804bcb <__rodata_start+0x18b>
+  804bab:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804bad:	75 6e                	jne    804c1d <__rodata_start+0x1dd>
+  804baf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804bb3:	76 20                	jbe    804bd5 <__rodata_start+0x195>
+  804bb5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804bbc:	72 65                	jb     804c23 <__rodata_start+0x1e3>
+  804bbe:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804bc1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bc2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804bc6:	65 78 70             	gs js  804c39 <__rodata_start+0x1f9>
+  804bc9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804bce:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804bd1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804bd5:	20 66 69             	and    %ah,0x69(%rsi)
+  804bd8:	6c                   	insb   (%dx),%es:(%rdi)
+  804bd9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804bdd:	20 66 72             	and    %ah,0x72(%rsi)
+  804be0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804be5:	61                   	(bad)
+  804be6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804be9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bea:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804beb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804bef:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bf3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bf4:	20 6d 61             	and    %ch,0x61(%rbp)
+  804bf7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bf8:	79 20                	jns    804c1a <__rodata_start+0x1da>
+  804bfa:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804c01:	72 65                	jb     804c68 <__rodata_start+0x228>
+  804c03:	20 6f 70             	and    %ch,0x70(%rdi)
+  804c06:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c08:	00 66 69             	add    %ah,0x69(%rsi)
+  804c0b:	6c                   	insb   (%dx),%es:(%rdi)
+  804c0c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804c10:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804c13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c14:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804c17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c18:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c19:	74 20                	je     804c3b <__rodata_start+0x1fb>
+  804c1b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c1d:	75 6e                	jne    804c8d <__rodata_start+0x24d>
+  804c1f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804c23:	76 61                	jbe    804c86 <__rodata_start+0x246>
+  804c25:	6c                   	insb   (%dx),%es:(%rdi)
+  804c26:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804c2d:	00 
+  804c2e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804c35:	72 65                	jb     804c9c <__rodata_start+0x25c>
+  804c37:	61                   	(bad)
+  804c38:	64 79 20             	fs jns 804c5b <__rodata_start+0x21b>
+  804c3b:	65 78 69             	gs js  804ca7 <__rodata_start+0x267>
+  804c3e:	73 74                	jae    804cb4 <__rodata_start+0x274>
+  804c40:	73 00                	jae    804c42 <__rodata_start+0x202>
+  804c42:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c43:	70 65                	jo     804caa <__rodata_start+0x26a>
+  804c45:	72 61                	jb     804ca8 <__rodata_start+0x268>
+  804c47:	74 69                	je     804cb2 <__rodata_start+0x272>
+  804c49:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c4a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c4b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804c4e:	74 20                	je     804c70 <__rodata_start+0x230>
+  804c50:	73 75                	jae    804cc7 <__rodata_start+0x287>
+  804c52:	70 70                	jo     804cc4 <__rodata_start+0x284>
+  804c54:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c55:	72 74                	jb     804ccb <__rodata_start+0x28b>
+  804c57:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804c5d:	20 61 67             	and    %ah,0x67(%rcx)
+  804c60:	61                   	(bad)
+  804c61:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804c68:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804c6c:	74 00                	je     804c6e <__rodata_start+0x22e>
+  804c6e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804c75:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c78:	20 75 73             	and    %dh,0x73(%rbp)
+  804c7b:	65 00 0f             	add    %cl,%gs:(%rdi)
+  804c7e:	1f                   	(bad)
+  804c7f:	00 4f 06             	add    %cl,0x6(%rdi)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 80 0c 80 00 00    	add    %al,0x800c(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 6e 06             	add    %ch,0x6(%rsi)
+  804cba:	80 00 00             	addb   $0x0,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 62 06             	add    %ah,0x6(%rdx)
+  804cd2:	80 00 00             	addb   $0x0,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 dc                	add    %bl,%ah
+  804cd9:	06                   	(bad)
+  804cda:	80 00 00             	addb   $0x0,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 62 06             	add    %ah,0x6(%rdx)
+  804cea:	80 00 00             	addb   $0x0,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 a8 06 80 00 00    	add    %ch,0x8006(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 b3 0b 80 00 00    	add    %dh,0x800b(%rbx)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 ff                	add    %bh,%bh
+  804e81:	06                   	(bad)
+  804e82:	80 00 00             	addb   $0x0,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 ce                	add    %cl,%dh
+  804e89:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804e8f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 2e                	add    %ch,(%rsi)
+  804eb1:	07                   	(bad)
+  804eb2:	80 00 00             	addb   $0x0,(%rax)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 f4                	add    %dh,%ah
+  804ec9:	06                   	(bad)
+  804eca:	80 00 00             	addb   $0x0,(%rax)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 76 0a             	add    %dh,0xa(%rsi)
+  804ee2:	80 00 00             	addb   $0x0,(%rax)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 40 0b             	add    %al,0xb(%rax)
+  804eea:	80 00 00             	addb   $0x0,(%rax)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 c5                	add    %al,%ch
+  804f01:	07                   	(bad)
+  804f02:	80 00 00             	addb   $0x0,(%rax)
+  804f05:	00 00                	add    %al,(%rax)
+  804f07:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 a2 09 80 00 00    	add    %ah,0x8009(%rdx)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 b3 0b 80 00 00    	add    %dh,0x800b(%rbx)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 90 0c 80 00 00    	add    %dl,0x800c(%rax)
+  804f35:	00 00                	add    %al,(%rax)
+  804f37:	00 58 06             	add    %bl,0x6(%rax)
+  804f3a:	80 00 00             	addb   $0x0,(%rax)
+  804f3d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804f40 <error_string>:
+	...
+  804f48:	fd 4a 80 00 00 00 00 00 0f 4b 80 00 00 00 00 00     .J.......K......
+  804f58:	1f 4b 80 00 00 00 00 00 31 4b 80 00 00 00 00 00     .K......1K......
+  804f68:	3f 4b 80 00 00 00 00 00 53 4b 80 00 00 00 00 00     ?K......SK......
+  804f78:	68 4b 80 00 00 00 00 00 7b 4b 80 00 00 00 00 00     hK......{K......
+  804f88:	8d 4b 80 00 00 00 00 00 a1 4b 80 00 00 00 00 00     .K.......K......
+  804f98:	b1 4b 80 00 00 00 00 00 c4 4b 80 00 00 00 00 00     .K.......K......
+  804fa8:	db 4b 80 00 00 00 00 00 f1 4b 80 00 00 00 00 00     .K.......K......
+  804fb8:	09 4c 80 00 00 00 00 00 21 4c 80 00 00 00 00 00     .L......!L......
+  804fc8:	2e 4c 80 00 00 00 00 00 f8 4f 80 00 00 00 00 00     .L.......O......
+  804fd8:	42 4c 80 00 00 00 00 00 5a 4c 80 00 00 00 00 00     BL......ZL......
+  804fe8:	64 4c 80 00 00 00 00 00 6e 4c 80 00 00 00 00 00     dL......nL......
+  804ff8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805008:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805018:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805028:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805038:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  805048:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  805058:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  805068:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  805078:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805088:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805098:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  8050a8:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  8050b8:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  8050c8:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050d8:	0f 1f 84 00 00 00 00 00                             ........
+
+00000000008050e0 <devtab>:
+  8050e0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  8050f0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805100:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805110:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805120:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805130:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805140:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805150:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805160:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805170:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805180:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805190:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  8051a0:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  8051b0:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8051c0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8051d0:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  8051e0:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  8051f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805200:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805210:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805220:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805230:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805240:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805250:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805260:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805270:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805280:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805290:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805300:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
@@ -0,0 +1,8769 @@
+
+obj/user/pathbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 e4 03 00 00       	call   800407 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+
+static char dirs[DEPTH][MAXPATHLEN];
+static char leaf[MAXPATHLEN], missing[MAXPATHLEN];
+
+static void
+bench(const char *what, const char *path, int expect) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80003a:	49 89 f4             	mov    %rsi,%r12
+  80003d:	41 89 d5             	mov    %edx,%r13d
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800040:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800042:	48 c1 e2 20          	shl    $0x20,%rdx
+  800046:	89 c0                	mov    %eax,%eax
+  800048:	48 09 c2             	or     %rax,%rdx
+  80004b:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80004f:	bb e8 03 00 00       	mov    $0x3e8,%ebx
+    uint64_t start = read_tsc();
+    for (int i = 0; i < NOPENS; i++) {
+        int fd = open(path, O_RDONLY);
+  800054:	49 be 37 31 80 00 00 	movabs $0x803137,%r14
+  80005b:	00 00 00 
+        if ((fd < 0 ? fd : 0) != expect) panic("open %s: %i", path, fd);
+        if (fd >= 0) close(fd);
+  80005e:	49 bf d7 1a 80 00 00 	movabs $0x801ad7,%r15
+  800065:	00 00 00 
+  800068:	eb 39                	jmp    8000a3 <bench+0x7e>
+        if ((fd < 0 ? fd : 0) != expect) panic("open %s: %i", path, fd);
+  80006a:	41 89 f8             	mov    %edi,%r8d
+  80006d:	4c 89 e1             	mov    %r12,%rcx
+  800070:	48 ba 68 4a 80 00 00 	movabs $0x804a68,%rdx
+  800077:	00 00 00 
+  80007a:	be 13 00 00 00       	mov    $0x13,%esi
+  80007f:	48 bf 74 4a 80 00 00 	movabs $0x804a74,%rdi
+  800086:	00 00 00 
+  800089:	b8 00 00 00 00       	mov    $0x0,%eax
+  80008e:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  800095:	00 00 00 
+  800098:	41 ff d1             	call   *%r9
+        if (fd >= 0) close(fd);
+  80009b:	41 ff d7             	call   *%r15
+    for (int i = 0; i < NOPENS; i++) {
+  80009e:	83 eb 01             	sub    $0x1,%ebx
+  8000a1:	74 22                	je     8000c5 <bench+0xa0>
+        int fd = open(path, O_RDONLY);
+  8000a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8000a8:	4c 89 e7             	mov    %r12,%rdi
+  8000ab:	41 ff d6             	call   *%r14
+  8000ae:	89 c7                	mov    %eax,%edi
+        if ((fd < 0 ? fd : 0) != expect) panic("open %s: %i", path, fd);
+  8000b0:	85 c0                	test   %eax,%eax
+  8000b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000b7:	0f 4e c7             	cmovle %edi,%eax
+  8000ba:	44 39 e8             	cmp    %r13d,%eax
+  8000bd:	75 ab                	jne    80006a <bench+0x45>
+        if (fd >= 0) close(fd);
+  8000bf:	85 ff                	test   %edi,%edi
+  8000c1:	78 db                	js     80009e <bench+0x79>
+  8000c3:	eb d6                	jmp    80009b <bench+0x76>
+    asm volatile("rdtsc"
+  8000c5:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000c7:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000cb:	89 c0                	mov    %eax,%eax
+  8000cd:	48 09 c2             	or     %rax,%rdx
+    }
+    uint64_t cycles = read_tsc() - start;
+  8000d0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8000d4:	48 29 c2             	sub    %rax,%rdx
+
+    cprintf("pathbench: %s: %lu cycles per open\n", what, (unsigned long)(cycles / NOPENS));
+  8000d7:	48 c1 ea 03          	shr    $0x3,%rdx
+  8000db:	48 b9 cf f7 53 e3 a5 	movabs $0x20c49ba5e353f7cf,%rcx
+  8000e2:	9b c4 20 
+  8000e5:	48 89 d0             	mov    %rdx,%rax
+  8000e8:	48 f7 e1             	mul    %rcx
+  8000eb:	48 c1 ea 04          	shr    $0x4,%rdx
+  8000ef:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8000f3:	48 bf f8 4a 80 00 00 	movabs $0x804af8,%rdi
+  8000fa:	00 00 00 
+  8000fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800102:	48 b9 2d 06 80 00 00 	movabs $0x80062d,%rcx
+  800109:	00 00 00 
+  80010c:	ff d1                	call   *%rcx
+}
+  80010e:	48 83 c4 18          	add    $0x18,%rsp
+  800112:	5b                   	pop    %rbx
+  800113:	41 5c                	pop    %r12
+  800115:	41 5d                	pop    %r13
+  800117:	41 5e                	pop    %r14
+  800119:	41 5f                	pop    %r15
+  80011b:	5d                   	pop    %rbp
+  80011c:	c3                   	ret
+
+000000000080011d <umain>:
+
+void
+umain(int argc, char **argv) {
+  80011d:	55                   	push   %rbp
+  80011e:	48 89 e5             	mov    %rsp,%rbp
+  800121:	41 57                	push   %r15
+  800123:	41 56                	push   %r14
+  800125:	41 55                	push   %r13
+  800127:	41 54                	push   %r12
+  800129:	53                   	push   %rbx
+  80012a:	48 83 ec 18          	sub    $0x18,%rsp
+    int fd;
+
+    for (int i = 0; i < DEPTH; i++) {
+  80012e:	49 bd 00 08 81 00 00 	movabs $0x810800,%r13
+  800135:	00 00 00 
+umain(int argc, char **argv) {
+  800138:	4c 89 eb             	mov    %r13,%rbx
+    for (int i = 0; i < DEPTH; i++) {
+  80013b:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        if (i)
+            snprintf(dirs[i], MAXPATHLEN, "%s/dir%d", dirs[i - 1], i);
+        else
+            strcpy(dirs[i], "/pathbench");
+  800141:	49 bf 52 0f 80 00 00 	movabs $0x800f52,%r15
+  800148:	00 00 00 
+        if ((fd = open(dirs[i], O_RDONLY | O_CREAT | O_MKDIR)) < 0)
+  80014b:	49 be 37 31 80 00 00 	movabs $0x803137,%r14
+  800152:	00 00 00 
+  800155:	eb 47                	jmp    80019e <umain+0x81>
+            strcpy(dirs[i], "/pathbench");
+  800157:	48 be 8e 4a 80 00 00 	movabs $0x804a8e,%rsi
+  80015e:	00 00 00 
+  800161:	48 bf 00 08 81 00 00 	movabs $0x810800,%rdi
+  800168:	00 00 00 
+  80016b:	41 ff d7             	call   *%r15
+        if ((fd = open(dirs[i], O_RDONLY | O_CREAT | O_MKDIR)) < 0)
+  80016e:	48 89 5d c8          	mov    %rbx,-0x38(%rbp)
+  800172:	be 00 09 00 00       	mov    $0x900,%esi
+  800177:	48 89 df             	mov    %rbx,%rdi
+  80017a:	41 ff d6             	call   *%r14
+  80017d:	89 c7                	mov    %eax,%edi
+  80017f:	85 c0                	test   %eax,%eax
+  800181:	0f 88 93 01 00 00    	js     80031a <umain+0x1fd>
+            panic("mkdir %s: %i", dirs[i], fd);
+        close(fd);
+  800187:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  80018e:	00 00 00 
+  800191:	ff d0                	call   *%rax
+    for (int i = 0; i < DEPTH; i++) {
+  800193:	41 83 c4 01          	add    $0x1,%r12d
+  800197:	48 81 c3 00 04 00 00 	add    $0x400,%rbx
+        if (i)
+  80019e:	45 85 e4             	test   %r12d,%r12d
+  8001a1:	74 b4                	je     800157 <umain+0x3a>
+            snprintf(dirs[i], MAXPATHLEN, "%s/dir%d", dirs[i - 1], i);
+  8001a3:	48 8d 8b 00 fc ff ff 	lea    -0x400(%rbx),%rcx
+  8001aa:	45 89 e0             	mov    %r12d,%r8d
+  8001ad:	48 ba 85 4a 80 00 00 	movabs $0x804a85,%rdx
+  8001b4:	00 00 00 
+  8001b7:	be 00 04 00 00       	mov    $0x400,%esi
+  8001bc:	48 89 df             	mov    %rbx,%rdi
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	49 b9 d7 0e 80 00 00 	movabs $0x800ed7,%r9
+  8001cb:	00 00 00 
+  8001ce:	41 ff d1             	call   *%r9
+        if ((fd = open(dirs[i], O_RDONLY | O_CREAT | O_MKDIR)) < 0)
+  8001d1:	48 89 5d c8          	mov    %rbx,-0x38(%rbp)
+  8001d5:	be 00 09 00 00       	mov    $0x900,%esi
+  8001da:	48 89 df             	mov    %rbx,%rdi
+  8001dd:	41 ff d6             	call   *%r14
+  8001e0:	89 c7                	mov    %eax,%edi
+  8001e2:	85 c0                	test   %eax,%eax
+  8001e4:	0f 88 30 01 00 00    	js     80031a <umain+0x1fd>
+        close(fd);
+  8001ea:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  8001f1:	00 00 00 
+  8001f4:	ff d0                	call   *%rax
+    for (int i = 0; i < DEPTH; i++) {
+  8001f6:	41 83 c4 01          	add    $0x1,%r12d
+  8001fa:	48 81 c3 00 04 00 00 	add    $0x400,%rbx
+  800201:	41 83 fc 08          	cmp    $0x8,%r12d
+  800205:	75 97                	jne    80019e <umain+0x81>
+    }
+    snprintf(leaf, MAXPATHLEN, "%s/leaf", dirs[DEPTH - 1]);
+  800207:	49 be 00 24 81 00 00 	movabs $0x812400,%r14
+  80020e:	00 00 00 
+  800211:	4c 89 f1             	mov    %r14,%rcx
+  800214:	48 ba a6 4a 80 00 00 	movabs $0x804aa6,%rdx
+  80021b:	00 00 00 
+  80021e:	be 00 04 00 00       	mov    $0x400,%esi
+  800223:	48 bb 00 04 81 00 00 	movabs $0x810400,%rbx
+  80022a:	00 00 00 
+  80022d:	48 89 df             	mov    %rbx,%rdi
+  800230:	b8 00 00 00 00       	mov    $0x0,%eax
+  800235:	49 bc d7 0e 80 00 00 	movabs $0x800ed7,%r12
+  80023c:	00 00 00 
+  80023f:	41 ff d4             	call   *%r12
+    snprintf(missing, MAXPATHLEN, "%s/missing", dirs[DEPTH - 1]);
+  800242:	4c 89 f1             	mov    %r14,%rcx
+  800245:	48 ba ae 4a 80 00 00 	movabs $0x804aae,%rdx
+  80024c:	00 00 00 
+  80024f:	be 00 04 00 00       	mov    $0x400,%esi
+  800254:	48 bf 00 00 81 00 00 	movabs $0x810000,%rdi
+  80025b:	00 00 00 
+  80025e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800263:	41 ff d4             	call   *%r12
+    if ((fd = open(leaf, O_RDWR | O_CREAT)) < 0) panic("create %s: %i", leaf, fd);
+  800266:	be 02 01 00 00       	mov    $0x102,%esi
+  80026b:	48 89 df             	mov    %rbx,%rdi
+  80026e:	48 b8 37 31 80 00 00 	movabs $0x803137,%rax
+  800275:	00 00 00 
+  800278:	ff d0                	call   *%rax
+  80027a:	89 c7                	mov    %eax,%edi
+  80027c:	85 c0                	test   %eax,%eax
+  80027e:	0f 88 c8 00 00 00    	js     80034c <umain+0x22f>
+    close(fd);
+  800284:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  80028b:	00 00 00 
+  80028e:	ff d0                	call   *%rax
+
+    bench("deep path", leaf, 0);
+  800290:	ba 00 00 00 00       	mov    $0x0,%edx
+  800295:	49 bc 00 04 81 00 00 	movabs $0x810400,%r12
+  80029c:	00 00 00 
+  80029f:	4c 89 e6             	mov    %r12,%rsi
+  8002a2:	48 bf cf 4a 80 00 00 	movabs $0x804acf,%rdi
+  8002a9:	00 00 00 
+  8002ac:	48 bb 25 00 80 00 00 	movabs $0x800025,%rbx
+  8002b3:	00 00 00 
+  8002b6:	ff d3                	call   *%rbx
+    bench("missing deep path", missing, -E_NOT_FOUND);
+  8002b8:	ba f1 ff ff ff       	mov    $0xfffffff1,%edx
+  8002bd:	48 be 00 00 81 00 00 	movabs $0x810000,%rsi
+  8002c4:	00 00 00 
+  8002c7:	48 bf c7 4a 80 00 00 	movabs $0x804ac7,%rdi
+  8002ce:	00 00 00 
+  8002d1:	ff d3                	call   *%rbx
+    bench("short path", "/pathbench", 0);
+  8002d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8002d8:	48 be 8e 4a 80 00 00 	movabs $0x804a8e,%rsi
+  8002df:	00 00 00 
+  8002e2:	48 bf d9 4a 80 00 00 	movabs $0x804ad9,%rdi
+  8002e9:	00 00 00 
+  8002ec:	ff d3                	call   *%rbx
+
+    int res;
+    if ((res = remove(leaf)) < 0) panic("remove %s: %i", leaf, res);
+  8002ee:	4c 89 e7             	mov    %r12,%rdi
+  8002f1:	48 b8 36 33 80 00 00 	movabs $0x803336,%rax
+  8002f8:	00 00 00 
+  8002fb:	ff d0                	call   *%rax
+  8002fd:	85 c0                	test   %eax,%eax
+  8002ff:	78 7c                	js     80037d <umain+0x260>
+  800301:	48 bb 00 24 81 00 00 	movabs $0x812400,%rbx
+  800308:	00 00 00 
+    for (int i = DEPTH - 1; i >= 0; i--)
+        if ((res = remove(dirs[i])) < 0) panic("remove %s: %i", dirs[i], res);
+  80030b:	49 bc 36 33 80 00 00 	movabs $0x803336,%r12
+  800312:	00 00 00 
+  800315:	e9 97 00 00 00       	jmp    8003b1 <umain+0x294>
+            panic("mkdir %s: %i", dirs[i], fd);
+  80031a:	41 89 f8             	mov    %edi,%r8d
+  80031d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  800321:	48 ba 99 4a 80 00 00 	movabs $0x804a99,%rdx
+  800328:	00 00 00 
+  80032b:	be 25 00 00 00       	mov    $0x25,%esi
+  800330:	48 bf 74 4a 80 00 00 	movabs $0x804a74,%rdi
+  800337:	00 00 00 
+  80033a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80033f:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  800346:	00 00 00 
+  800349:	41 ff d1             	call   *%r9
+    if ((fd = open(leaf, O_RDWR | O_CREAT)) < 0) panic("create %s: %i", leaf, fd);
+  80034c:	41 89 c0             	mov    %eax,%r8d
+  80034f:	48 89 d9             	mov    %rbx,%rcx
+  800352:	48 ba b9 4a 80 00 00 	movabs $0x804ab9,%rdx
+  800359:	00 00 00 
+  80035c:	be 2a 00 00 00       	mov    $0x2a,%esi
+  800361:	48 bf 74 4a 80 00 00 	movabs $0x804a74,%rdi
+  800368:	00 00 00 
+  80036b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800370:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  800377:	00 00 00 
+  80037a:	41 ff d1             	call   *%r9
+    if ((res = remove(leaf)) < 0) panic("remove %s: %i", leaf, res);
+  80037d:	41 89 c0             	mov    %eax,%r8d
+  800380:	4c 89 e1             	mov    %r12,%rcx
+  800383:	48 ba e4 4a 80 00 00 	movabs $0x804ae4,%rdx
+  80038a:	00 00 00 
+  80038d:	be 32 00 00 00       	mov    $0x32,%esi
+  800392:	48 bf 74 4a 80 00 00 	movabs $0x804a74,%rdi
+  800399:	00 00 00 
+  80039c:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003a1:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  8003a8:	00 00 00 
+  8003ab:	41 ff d1             	call   *%r9
+  8003ae:	48 89 c3             	mov    %rax,%rbx
+        if ((res = remove(dirs[i])) < 0) panic("remove %s: %i", dirs[i], res);
+  8003b1:	48 89 df             	mov    %rbx,%rdi
+  8003b4:	41 ff d4             	call   *%r12
+  8003b7:	85 c0                	test   %eax,%eax
+  8003b9:	78 1b                	js     8003d6 <umain+0x2b9>
+    for (int i = DEPTH - 1; i >= 0; i--)
+  8003bb:	48 8d 83 00 fc ff ff 	lea    -0x400(%rbx),%rax
+  8003c2:	4c 39 eb             	cmp    %r13,%rbx
+  8003c5:	75 e7                	jne    8003ae <umain+0x291>
+}
+  8003c7:	48 83 c4 18          	add    $0x18,%rsp
+  8003cb:	5b                   	pop    %rbx
+  8003cc:	41 5c                	pop    %r12
+  8003ce:	41 5d                	pop    %r13
+  8003d0:	41 5e                	pop    %r14
+  8003d2:	41 5f                	pop    %r15
+  8003d4:	5d                   	pop    %rbp
+  8003d5:	c3                   	ret
+        if ((res = remove(dirs[i])) < 0) panic("remove %s: %i", dirs[i], res);
+  8003d6:	41 89 c0             	mov    %eax,%r8d
+  8003d9:	48 89 d9             	mov    %rbx,%rcx
+  8003dc:	48 ba e4 4a 80 00 00 	movabs $0x804ae4,%rdx
+  8003e3:	00 00 00 
+  8003e6:	be 34 00 00 00       	mov    $0x34,%esi
+  8003eb:	48 bf 74 4a 80 00 00 	movabs $0x804a74,%rdi
+  8003f2:	00 00 00 
+  8003f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003fa:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  800401:	00 00 00 
+  800404:	41 ff d1             	call   *%r9
+
+0000000000800407 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800407:	55                   	push   %rbp
+  800408:	48 89 e5             	mov    %rsp,%rbp
+  80040b:	41 56                	push   %r14
+  80040d:	41 55                	push   %r13
+  80040f:	41 54                	push   %r12
+  800411:	53                   	push   %rbx
+  800412:	41 89 fd             	mov    %edi,%r13d
+  800415:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800418:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80041f:	00 00 00 
+  800422:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800429:	00 00 00 
+  80042c:	48 39 c2             	cmp    %rax,%rdx
+  80042f:	73 17                	jae    800448 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800431:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800434:	49 89 c4             	mov    %rax,%r12
+  800437:	48 83 c3 08          	add    $0x8,%rbx
+  80043b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800440:	ff 53 f8             	call   *-0x8(%rbx)
+  800443:	4c 39 e3             	cmp    %r12,%rbx
+  800446:	72 ef                	jb     800437 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800448:	48 b8 24 14 80 00 00 	movabs $0x801424,%rax
+  80044f:	00 00 00 
+  800452:	ff d0                	call   *%rax
+  800454:	89 c2                	mov    %eax,%edx
+  800456:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80045c:	48 89 d0             	mov    %rdx,%rax
+  80045f:	48 c1 e0 04          	shl    $0x4,%rax
+  800463:	48 29 d0             	sub    %rdx,%rax
+  800466:	48 c1 e0 05          	shl    $0x5,%rax
+  80046a:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800471:	00 00 00 
+  800474:	48 01 d0             	add    %rdx,%rax
+  800477:	48 a3 00 28 81 00 00 	movabs %rax,0x812800
+  80047e:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800481:	45 85 ed             	test   %r13d,%r13d
+  800484:	7e 0d                	jle    800493 <libmain+0x8c>
+  800486:	49 8b 06             	mov    (%r14),%rax
+  800489:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800490:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800493:	4c 89 f6             	mov    %r14,%rsi
+  800496:	44 89 ef             	mov    %r13d,%edi
+  800499:	48 b8 1d 01 80 00 00 	movabs $0x80011d,%rax
+  8004a0:	00 00 00 
+  8004a3:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8004a5:	48 b8 ba 04 80 00 00 	movabs $0x8004ba,%rax
+  8004ac:	00 00 00 
+  8004af:	ff d0                	call   *%rax
+#endif
+}
+  8004b1:	5b                   	pop    %rbx
+  8004b2:	41 5c                	pop    %r12
+  8004b4:	41 5d                	pop    %r13
+  8004b6:	41 5e                	pop    %r14
+  8004b8:	5d                   	pop    %rbp
+  8004b9:	c3                   	ret
+
+00000000008004ba <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8004ba:	55                   	push   %rbp
+  8004bb:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8004be:	48 b8 0a 1b 80 00 00 	movabs $0x801b0a,%rax
+  8004c5:	00 00 00 
+  8004c8:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8004ca:	bf 00 00 00 00       	mov    $0x0,%edi
+  8004cf:	48 b8 c1 13 80 00 00 	movabs $0x8013c1,%rax
+  8004d6:	00 00 00 
+  8004d9:	ff d0                	call   *%rax
+}
+  8004db:	5d                   	pop    %rbp
+  8004dc:	c3                   	ret
+
+00000000008004dd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8004dd:	55                   	push   %rbp
+  8004de:	48 89 e5             	mov    %rsp,%rbp
+  8004e1:	41 56                	push   %r14
+  8004e3:	41 55                	push   %r13
+  8004e5:	41 54                	push   %r12
+  8004e7:	53                   	push   %rbx
+  8004e8:	48 83 ec 50          	sub    $0x50,%rsp
+  8004ec:	49 89 fc             	mov    %rdi,%r12
+  8004ef:	41 89 f5             	mov    %esi,%r13d
+  8004f2:	48 89 d3             	mov    %rdx,%rbx
+  8004f5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8004f9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8004fd:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800501:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800508:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80050c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800510:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800514:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800518:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80051f:	00 00 00 
+  800522:	4c 8b 30             	mov    (%rax),%r14
+  800525:	48 b8 24 14 80 00 00 	movabs $0x801424,%rax
+  80052c:	00 00 00 
+  80052f:	ff d0                	call   *%rax
+  800531:	89 c6                	mov    %eax,%esi
+  800533:	45 89 e8             	mov    %r13d,%r8d
+  800536:	4c 89 e1             	mov    %r12,%rcx
+  800539:	4c 89 f2             	mov    %r14,%rdx
+  80053c:	48 bf 28 4b 80 00 00 	movabs $0x804b28,%rdi
+  800543:	00 00 00 
+  800546:	b8 00 00 00 00       	mov    $0x0,%eax
+  80054b:	49 bc 2d 06 80 00 00 	movabs $0x80062d,%r12
+  800552:	00 00 00 
+  800555:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800558:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80055c:	48 89 df             	mov    %rbx,%rdi
+  80055f:	48 b8 c9 05 80 00 00 	movabs $0x8005c9,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+    cprintf("\n");
+  80056b:	48 bf 23 51 80 00 00 	movabs $0x805123,%rdi
+  800572:	00 00 00 
+  800575:	b8 00 00 00 00       	mov    $0x0,%eax
+  80057a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80057d:	cc                   	int3
+  80057e:	eb fd                	jmp    80057d <_panic+0xa0>
+
+0000000000800580 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800580:	55                   	push   %rbp
+  800581:	48 89 e5             	mov    %rsp,%rbp
+  800584:	53                   	push   %rbx
+  800585:	48 83 ec 08          	sub    $0x8,%rsp
+  800589:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80058c:	8b 06                	mov    (%rsi),%eax
+  80058e:	8d 50 01             	lea    0x1(%rax),%edx
+  800591:	89 16                	mov    %edx,(%rsi)
+  800593:	48 98                	cltq
+  800595:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80059a:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8005a0:	74 0a                	je     8005ac <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8005a2:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8005a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8005aa:	c9                   	leave
+  8005ab:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8005ac:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  8005b0:	be ff 00 00 00       	mov    $0xff,%esi
+  8005b5:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  8005bc:	00 00 00 
+  8005bf:	ff d0                	call   *%rax
+        state->offset = 0;
+  8005c1:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8005c7:	eb d9                	jmp    8005a2 <putch+0x22>
+
+00000000008005c9 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8005c9:	55                   	push   %rbp
+  8005ca:	48 89 e5             	mov    %rsp,%rbp
+  8005cd:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8005d4:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8005d7:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8005de:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8005e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e8:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8005eb:	48 89 f1             	mov    %rsi,%rcx
+  8005ee:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8005f5:	48 bf 80 05 80 00 00 	movabs $0x800580,%rdi
+  8005fc:	00 00 00 
+  8005ff:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800606:	00 00 00 
+  800609:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80060b:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800612:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800619:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  800620:	00 00 00 
+  800623:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800625:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80062b:	c9                   	leave
+  80062c:	c3                   	ret
+
+000000000080062d <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80062d:	55                   	push   %rbp
+  80062e:	48 89 e5             	mov    %rsp,%rbp
+  800631:	48 83 ec 50          	sub    $0x50,%rsp
+  800635:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800639:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80063d:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800641:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800645:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800649:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800650:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800654:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800658:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80065c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800660:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800664:	48 b8 c9 05 80 00 00 	movabs $0x8005c9,%rax
+  80066b:	00 00 00 
+  80066e:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800670:	c9                   	leave
+  800671:	c3                   	ret
+
+0000000000800672 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800672:	55                   	push   %rbp
+  800673:	48 89 e5             	mov    %rsp,%rbp
+  800676:	41 57                	push   %r15
+  800678:	41 56                	push   %r14
+  80067a:	41 55                	push   %r13
+  80067c:	41 54                	push   %r12
+  80067e:	53                   	push   %rbx
+  80067f:	48 83 ec 18          	sub    $0x18,%rsp
+  800683:	49 89 fc             	mov    %rdi,%r12
+  800686:	49 89 f5             	mov    %rsi,%r13
+  800689:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80068d:	8b 45 10             	mov    0x10(%rbp),%eax
+  800690:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800693:	41 89 cf             	mov    %ecx,%r15d
+  800696:	4c 39 fa             	cmp    %r15,%rdx
+  800699:	73 5b                	jae    8006f6 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80069b:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80069f:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8006a3:	85 db                	test   %ebx,%ebx
+  8006a5:	7e 0e                	jle    8006b5 <print_num+0x43>
+            putch(padc, put_arg);
+  8006a7:	4c 89 ee             	mov    %r13,%rsi
+  8006aa:	44 89 f7             	mov    %r14d,%edi
+  8006ad:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  8006b0:	83 eb 01             	sub    $0x1,%ebx
+  8006b3:	75 f2                	jne    8006a7 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  8006b5:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  8006b9:	48 b9 5c 4b 80 00 00 	movabs $0x804b5c,%rcx
+  8006c0:	00 00 00 
+  8006c3:	48 b8 4b 4b 80 00 00 	movabs $0x804b4b,%rax
+  8006ca:	00 00 00 
+  8006cd:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8006d1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006da:	49 f7 f7             	div    %r15
+  8006dd:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8006e1:	4c 89 ee             	mov    %r13,%rsi
+  8006e4:	41 ff d4             	call   *%r12
+}
+  8006e7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8006eb:	5b                   	pop    %rbx
+  8006ec:	41 5c                	pop    %r12
+  8006ee:	41 5d                	pop    %r13
+  8006f0:	41 5e                	pop    %r14
+  8006f2:	41 5f                	pop    %r15
+  8006f4:	5d                   	pop    %rbp
+  8006f5:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8006f6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8006fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8006ff:	49 f7 f7             	div    %r15
+  800702:	48 83 ec 08          	sub    $0x8,%rsp
+  800706:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80070a:	52                   	push   %rdx
+  80070b:	45 0f be c9          	movsbl %r9b,%r9d
+  80070f:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800713:	48 89 c2             	mov    %rax,%rdx
+  800716:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  80071d:	00 00 00 
+  800720:	ff d0                	call   *%rax
+  800722:	48 83 c4 10          	add    $0x10,%rsp
+  800726:	eb 8d                	jmp    8006b5 <print_num+0x43>
+
+0000000000800728 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800728:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80072c:	48 8b 06             	mov    (%rsi),%rax
+  80072f:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800733:	73 0a                	jae    80073f <sprintputch+0x17>
+        *state->start++ = ch;
+  800735:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800739:	48 89 16             	mov    %rdx,(%rsi)
+  80073c:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80073f:	c3                   	ret
+
+0000000000800740 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800740:	55                   	push   %rbp
+  800741:	48 89 e5             	mov    %rsp,%rbp
+  800744:	48 83 ec 50          	sub    $0x50,%rsp
+  800748:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80074c:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800750:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800754:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80075b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80075f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800763:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800767:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  80076b:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80076f:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800776:	00 00 00 
+  800779:	ff d0                	call   *%rax
+}
+  80077b:	c9                   	leave
+  80077c:	c3                   	ret
+
+000000000080077d <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80077d:	55                   	push   %rbp
+  80077e:	48 89 e5             	mov    %rsp,%rbp
+  800781:	41 57                	push   %r15
+  800783:	41 56                	push   %r14
+  800785:	41 55                	push   %r13
+  800787:	41 54                	push   %r12
+  800789:	53                   	push   %rbx
+  80078a:	48 83 ec 38          	sub    $0x38,%rsp
+  80078e:	49 89 fe             	mov    %rdi,%r14
+  800791:	49 89 f5             	mov    %rsi,%r13
+  800794:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800797:	48 8b 01             	mov    (%rcx),%rax
+  80079a:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80079e:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8007a2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007a6:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8007aa:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  8007ae:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  8007b2:	0f b6 3b             	movzbl (%rbx),%edi
+  8007b5:	40 80 ff 25          	cmp    $0x25,%dil
+  8007b9:	74 18                	je     8007d3 <vprintfmt+0x56>
+            if (!ch) return;
+  8007bb:	40 84 ff             	test   %dil,%dil
+  8007be:	0f 84 b1 06 00 00    	je     800e75 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8007c4:	40 0f b6 ff          	movzbl %dil,%edi
+  8007c8:	4c 89 ee             	mov    %r13,%rsi
+  8007cb:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8007ce:	4c 89 e3             	mov    %r12,%rbx
+  8007d1:	eb db                	jmp    8007ae <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8007d3:	be 00 00 00 00       	mov    $0x0,%esi
+  8007d8:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8007dc:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8007e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007e7:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8007ee:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8007f2:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8007f7:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8007fc:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8007ff:	83 e8 23             	sub    $0x23,%eax
+  800802:	3c 57                	cmp    $0x57,%al
+  800804:	0f 87 51 06 00 00    	ja     800e5b <vprintfmt+0x6de>
+  80080a:	0f b6 c0             	movzbl %al,%eax
+  80080d:	48 b9 00 4d 80 00 00 	movabs $0x804d00,%rcx
+  800814:	00 00 00 
+  800817:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80081a:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80081d:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800821:	eb cf                	jmp    8007f2 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800823:	49 89 dc             	mov    %rbx,%r12
+  800826:	be 01 00 00 00       	mov    $0x1,%esi
+  80082b:	eb c5                	jmp    8007f2 <vprintfmt+0x75>
+            padc = ch;
+  80082d:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800831:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800834:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800837:	eb b9                	jmp    8007f2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800839:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083c:	83 f8 2f             	cmp    $0x2f,%eax
+  80083f:	77 24                	ja     800865 <vprintfmt+0xe8>
+  800841:	89 c1                	mov    %eax,%ecx
+  800843:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800847:	83 c0 08             	add    $0x8,%eax
+  80084a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80084d:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800850:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800853:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800857:	79 99                	jns    8007f2 <vprintfmt+0x75>
+                width = precision;
+  800859:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80085d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800863:	eb 8d                	jmp    8007f2 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800865:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800869:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80086d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800871:	eb da                	jmp    80084d <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800873:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800878:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80087c:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800882:	3c 39                	cmp    $0x39,%al
+  800884:	77 1c                	ja     8008a2 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800886:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80088a:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80088e:	0f b6 c0             	movzbl %al,%eax
+  800891:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800896:	0f b6 03             	movzbl (%rbx),%eax
+  800899:	3c 39                	cmp    $0x39,%al
+  80089b:	76 e9                	jbe    800886 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80089d:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8008a0:	eb b1                	jmp    800853 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8008a2:	49 89 dc             	mov    %rbx,%r12
+  8008a5:	eb ac                	jmp    800853 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8008a7:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8008aa:	85 c9                	test   %ecx,%ecx
+  8008ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008b1:	0f 49 c1             	cmovns %ecx,%eax
+  8008b4:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  8008b7:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008ba:	e9 33 ff ff ff       	jmp    8007f2 <vprintfmt+0x75>
+            lflag++;
+  8008bf:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8008c2:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8008c5:	e9 28 ff ff ff       	jmp    8007f2 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8008ca:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008cd:	83 f8 2f             	cmp    $0x2f,%eax
+  8008d0:	77 19                	ja     8008eb <vprintfmt+0x16e>
+  8008d2:	89 c2                	mov    %eax,%edx
+  8008d4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008d8:	83 c0 08             	add    $0x8,%eax
+  8008db:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008de:	8b 3a                	mov    (%rdx),%edi
+  8008e0:	4c 89 ee             	mov    %r13,%rsi
+  8008e3:	41 ff d6             	call   *%r14
+            break;
+  8008e6:	e9 c3 fe ff ff       	jmp    8007ae <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8008eb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008ef:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008f3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008f7:	eb e5                	jmp    8008de <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8008f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ff:	77 5a                	ja     80095b <vprintfmt+0x1de>
+  800901:	89 c2                	mov    %eax,%edx
+  800903:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800907:	83 c0 08             	add    $0x8,%eax
+  80090a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80090d:	8b 02                	mov    (%rdx),%eax
+  80090f:	89 c1                	mov    %eax,%ecx
+  800911:	f7 d9                	neg    %ecx
+  800913:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800916:	83 f9 16             	cmp    $0x16,%ecx
+  800919:	7f 4e                	jg     800969 <vprintfmt+0x1ec>
+  80091b:	48 63 c1             	movslq %ecx,%rax
+  80091e:	48 ba c0 4f 80 00 00 	movabs $0x804fc0,%rdx
+  800925:	00 00 00 
+  800928:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80092c:	48 85 c0             	test   %rax,%rax
+  80092f:	74 38                	je     800969 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800931:	48 89 c1             	mov    %rax,%rcx
+  800934:	48 ba 99 51 80 00 00 	movabs $0x805199,%rdx
+  80093b:	00 00 00 
+  80093e:	4c 89 ee             	mov    %r13,%rsi
+  800941:	4c 89 f7             	mov    %r14,%rdi
+  800944:	b8 00 00 00 00       	mov    $0x0,%eax
+  800949:	49 b8 40 07 80 00 00 	movabs $0x800740,%r8
+  800950:	00 00 00 
+  800953:	41 ff d0             	call   *%r8
+  800956:	e9 53 fe ff ff       	jmp    8007ae <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  80095b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800963:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800967:	eb a4                	jmp    80090d <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800969:	48 ba 74 4b 80 00 00 	movabs $0x804b74,%rdx
+  800970:	00 00 00 
+  800973:	4c 89 ee             	mov    %r13,%rsi
+  800976:	4c 89 f7             	mov    %r14,%rdi
+  800979:	b8 00 00 00 00       	mov    $0x0,%eax
+  80097e:	49 b8 40 07 80 00 00 	movabs $0x800740,%r8
+  800985:	00 00 00 
+  800988:	41 ff d0             	call   *%r8
+  80098b:	e9 1e fe ff ff       	jmp    8007ae <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800990:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800993:	83 f8 2f             	cmp    $0x2f,%eax
+  800996:	77 6c                	ja     800a04 <vprintfmt+0x287>
+  800998:	89 c2                	mov    %eax,%edx
+  80099a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80099e:	83 c0 08             	add    $0x8,%eax
+  8009a1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009a4:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8009a7:	48 85 d2             	test   %rdx,%rdx
+  8009aa:	48 b8 6d 4b 80 00 00 	movabs $0x804b6d,%rax
+  8009b1:	00 00 00 
+  8009b4:	48 0f 45 c2          	cmovne %rdx,%rax
+  8009b8:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8009bc:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8009c0:	7e 06                	jle    8009c8 <vprintfmt+0x24b>
+  8009c2:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8009c6:	75 4a                	jne    800a12 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009c8:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8009cc:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8009d0:	0f b6 00             	movzbl (%rax),%eax
+  8009d3:	84 c0                	test   %al,%al
+  8009d5:	0f 85 9a 00 00 00    	jne    800a75 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8009db:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8009de:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8009e2:	85 c0                	test   %eax,%eax
+  8009e4:	0f 8e c4 fd ff ff    	jle    8007ae <vprintfmt+0x31>
+  8009ea:	4c 89 ee             	mov    %r13,%rsi
+  8009ed:	bf 20 00 00 00       	mov    $0x20,%edi
+  8009f2:	41 ff d6             	call   *%r14
+  8009f5:	41 83 ec 01          	sub    $0x1,%r12d
+  8009f9:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8009fd:	75 eb                	jne    8009ea <vprintfmt+0x26d>
+  8009ff:	e9 aa fd ff ff       	jmp    8007ae <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800a04:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a08:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a0c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a10:	eb 92                	jmp    8009a4 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800a12:	49 63 f7             	movslq %r15d,%rsi
+  800a15:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  800a19:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  800a20:	00 00 00 
+  800a23:	ff d0                	call   *%rax
+  800a25:	48 89 c2             	mov    %rax,%rdx
+  800a28:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a2b:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800a2d:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800a30:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800a33:	85 c0                	test   %eax,%eax
+  800a35:	7e 91                	jle    8009c8 <vprintfmt+0x24b>
+  800a37:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800a3c:	4c 89 ee             	mov    %r13,%rsi
+  800a3f:	44 89 e7             	mov    %r12d,%edi
+  800a42:	41 ff d6             	call   *%r14
+  800a45:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a49:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800a4c:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800a4f:	75 eb                	jne    800a3c <vprintfmt+0x2bf>
+  800a51:	e9 72 ff ff ff       	jmp    8009c8 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a56:	0f b6 f8             	movzbl %al,%edi
+  800a59:	4c 89 ee             	mov    %r13,%rsi
+  800a5c:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800a5f:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800a63:	49 83 c4 01          	add    $0x1,%r12
+  800a67:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800a6d:	84 c0                	test   %al,%al
+  800a6f:	0f 84 66 ff ff ff    	je     8009db <vprintfmt+0x25e>
+  800a75:	45 85 ff             	test   %r15d,%r15d
+  800a78:	78 0a                	js     800a84 <vprintfmt+0x307>
+  800a7a:	41 83 ef 01          	sub    $0x1,%r15d
+  800a7e:	0f 88 57 ff ff ff    	js     8009db <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800a84:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800a88:	74 cc                	je     800a56 <vprintfmt+0x2d9>
+  800a8a:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800a8d:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800a92:	80 fa 5e             	cmp    $0x5e,%dl
+  800a95:	77 c2                	ja     800a59 <vprintfmt+0x2dc>
+  800a97:	eb bd                	jmp    800a56 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800a99:	40 84 f6             	test   %sil,%sil
+  800a9c:	75 26                	jne    800ac4 <vprintfmt+0x347>
+    switch (lflag) {
+  800a9e:	85 d2                	test   %edx,%edx
+  800aa0:	74 59                	je     800afb <vprintfmt+0x37e>
+  800aa2:	83 fa 01             	cmp    $0x1,%edx
+  800aa5:	74 7b                	je     800b22 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800aa7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aaa:	83 f8 2f             	cmp    $0x2f,%eax
+  800aad:	0f 87 96 00 00 00    	ja     800b49 <vprintfmt+0x3cc>
+  800ab3:	89 c2                	mov    %eax,%edx
+  800ab5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab9:	83 c0 08             	add    $0x8,%eax
+  800abc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800abf:	4c 8b 22             	mov    (%rdx),%r12
+  800ac2:	eb 17                	jmp    800adb <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800ac4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac7:	83 f8 2f             	cmp    $0x2f,%eax
+  800aca:	77 21                	ja     800aed <vprintfmt+0x370>
+  800acc:	89 c2                	mov    %eax,%edx
+  800ace:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad2:	83 c0 08             	add    $0x8,%eax
+  800ad5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad8:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800adb:	4d 85 e4             	test   %r12,%r12
+  800ade:	78 7a                	js     800b5a <vprintfmt+0x3dd>
+            num = i;
+  800ae0:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800ae3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800ae8:	e9 50 02 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800aed:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800af5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800af9:	eb dd                	jmp    800ad8 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800afb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800afe:	83 f8 2f             	cmp    $0x2f,%eax
+  800b01:	77 11                	ja     800b14 <vprintfmt+0x397>
+  800b03:	89 c2                	mov    %eax,%edx
+  800b05:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b09:	83 c0 08             	add    $0x8,%eax
+  800b0c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0f:	4c 63 22             	movslq (%rdx),%r12
+  800b12:	eb c7                	jmp    800adb <vprintfmt+0x35e>
+  800b14:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b18:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b20:	eb ed                	jmp    800b0f <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800b22:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b25:	83 f8 2f             	cmp    $0x2f,%eax
+  800b28:	77 11                	ja     800b3b <vprintfmt+0x3be>
+  800b2a:	89 c2                	mov    %eax,%edx
+  800b2c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b30:	83 c0 08             	add    $0x8,%eax
+  800b33:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b36:	4c 8b 22             	mov    (%rdx),%r12
+  800b39:	eb a0                	jmp    800adb <vprintfmt+0x35e>
+  800b3b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b3f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b43:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b47:	eb ed                	jmp    800b36 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800b49:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b4d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b51:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b55:	e9 65 ff ff ff       	jmp    800abf <vprintfmt+0x342>
+                putch('-', put_arg);
+  800b5a:	4c 89 ee             	mov    %r13,%rsi
+  800b5d:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800b62:	41 ff d6             	call   *%r14
+                i = -i;
+  800b65:	49 f7 dc             	neg    %r12
+  800b68:	e9 73 ff ff ff       	jmp    800ae0 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800b6d:	40 84 f6             	test   %sil,%sil
+  800b70:	75 32                	jne    800ba4 <vprintfmt+0x427>
+    switch (lflag) {
+  800b72:	85 d2                	test   %edx,%edx
+  800b74:	74 5d                	je     800bd3 <vprintfmt+0x456>
+  800b76:	83 fa 01             	cmp    $0x1,%edx
+  800b79:	0f 84 82 00 00 00    	je     800c01 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800b7f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b82:	83 f8 2f             	cmp    $0x2f,%eax
+  800b85:	0f 87 a5 00 00 00    	ja     800c30 <vprintfmt+0x4b3>
+  800b8b:	89 c2                	mov    %eax,%edx
+  800b8d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b91:	83 c0 08             	add    $0x8,%eax
+  800b94:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b97:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b9a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b9f:	e9 99 01 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800ba4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba7:	83 f8 2f             	cmp    $0x2f,%eax
+  800baa:	77 19                	ja     800bc5 <vprintfmt+0x448>
+  800bac:	89 c2                	mov    %eax,%edx
+  800bae:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb2:	83 c0 08             	add    $0x8,%eax
+  800bb5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb8:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800bbb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800bc0:	e9 78 01 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+  800bc5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bcd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd1:	eb e5                	jmp    800bb8 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800bd3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bd6:	83 f8 2f             	cmp    $0x2f,%eax
+  800bd9:	77 18                	ja     800bf3 <vprintfmt+0x476>
+  800bdb:	89 c2                	mov    %eax,%edx
+  800bdd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800be1:	83 c0 08             	add    $0x8,%eax
+  800be4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800be7:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800be9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800bee:	e9 4a 01 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+  800bf3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bf7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bfb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bff:	eb e6                	jmp    800be7 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800c01:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c04:	83 f8 2f             	cmp    $0x2f,%eax
+  800c07:	77 19                	ja     800c22 <vprintfmt+0x4a5>
+  800c09:	89 c2                	mov    %eax,%edx
+  800c0b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c0f:	83 c0 08             	add    $0x8,%eax
+  800c12:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c15:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800c18:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800c1d:	e9 1b 01 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+  800c22:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c26:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c2a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c2e:	eb e5                	jmp    800c15 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800c30:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c34:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c38:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c3c:	e9 56 ff ff ff       	jmp    800b97 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800c41:	40 84 f6             	test   %sil,%sil
+  800c44:	75 2e                	jne    800c74 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800c46:	85 d2                	test   %edx,%edx
+  800c48:	74 59                	je     800ca3 <vprintfmt+0x526>
+  800c4a:	83 fa 01             	cmp    $0x1,%edx
+  800c4d:	74 7f                	je     800cce <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800c4f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c52:	83 f8 2f             	cmp    $0x2f,%eax
+  800c55:	0f 87 9f 00 00 00    	ja     800cfa <vprintfmt+0x57d>
+  800c5b:	89 c2                	mov    %eax,%edx
+  800c5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c61:	83 c0 08             	add    $0x8,%eax
+  800c64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c67:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c6a:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800c6f:	e9 c9 00 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800c74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c77:	83 f8 2f             	cmp    $0x2f,%eax
+  800c7a:	77 19                	ja     800c95 <vprintfmt+0x518>
+  800c7c:	89 c2                	mov    %eax,%edx
+  800c7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c82:	83 c0 08             	add    $0x8,%eax
+  800c85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c88:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c8b:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800c90:	e9 a8 00 00 00       	jmp    800d3d <vprintfmt+0x5c0>
+  800c95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ca1:	eb e5                	jmp    800c88 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800ca3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ca6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ca9:	77 15                	ja     800cc0 <vprintfmt+0x543>
+  800cab:	89 c2                	mov    %eax,%edx
+  800cad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cb1:	83 c0 08             	add    $0x8,%eax
+  800cb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cb7:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800cb9:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800cbe:	eb 7d                	jmp    800d3d <vprintfmt+0x5c0>
+  800cc0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cc8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ccc:	eb e9                	jmp    800cb7 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800cce:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800cd1:	83 f8 2f             	cmp    $0x2f,%eax
+  800cd4:	77 16                	ja     800cec <vprintfmt+0x56f>
+  800cd6:	89 c2                	mov    %eax,%edx
+  800cd8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cdc:	83 c0 08             	add    $0x8,%eax
+  800cdf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ce2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800ce5:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800cea:	eb 51                	jmp    800d3d <vprintfmt+0x5c0>
+  800cec:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cf0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cf4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cf8:	eb e8                	jmp    800ce2 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800cfa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cfe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d02:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d06:	e9 5c ff ff ff       	jmp    800c67 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800d0b:	4c 89 ee             	mov    %r13,%rsi
+  800d0e:	bf 30 00 00 00       	mov    $0x30,%edi
+  800d13:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800d16:	4c 89 ee             	mov    %r13,%rsi
+  800d19:	bf 78 00 00 00       	mov    $0x78,%edi
+  800d1e:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800d21:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d24:	83 f8 2f             	cmp    $0x2f,%eax
+  800d27:	77 47                	ja     800d70 <vprintfmt+0x5f3>
+  800d29:	89 c2                	mov    %eax,%edx
+  800d2b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d2f:	83 c0 08             	add    $0x8,%eax
+  800d32:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d35:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d38:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800d3d:	48 83 ec 08          	sub    $0x8,%rsp
+  800d41:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800d45:	0f 94 c0             	sete   %al
+  800d48:	0f b6 c0             	movzbl %al,%eax
+  800d4b:	50                   	push   %rax
+  800d4c:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800d51:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800d55:	4c 89 ee             	mov    %r13,%rsi
+  800d58:	4c 89 f7             	mov    %r14,%rdi
+  800d5b:	48 b8 72 06 80 00 00 	movabs $0x800672,%rax
+  800d62:	00 00 00 
+  800d65:	ff d0                	call   *%rax
+            break;
+  800d67:	48 83 c4 10          	add    $0x10,%rsp
+  800d6b:	e9 3e fa ff ff       	jmp    8007ae <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800d70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d7c:	eb b7                	jmp    800d35 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800d7e:	40 84 f6             	test   %sil,%sil
+  800d81:	75 2b                	jne    800dae <vprintfmt+0x631>
+    switch (lflag) {
+  800d83:	85 d2                	test   %edx,%edx
+  800d85:	74 56                	je     800ddd <vprintfmt+0x660>
+  800d87:	83 fa 01             	cmp    $0x1,%edx
+  800d8a:	74 7f                	je     800e0b <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800d8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800d92:	0f 87 a2 00 00 00    	ja     800e3a <vprintfmt+0x6bd>
+  800d98:	89 c2                	mov    %eax,%edx
+  800d9a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d9e:	83 c0 08             	add    $0x8,%eax
+  800da1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800da4:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800da7:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800dac:	eb 8f                	jmp    800d3d <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800dae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800db1:	83 f8 2f             	cmp    $0x2f,%eax
+  800db4:	77 19                	ja     800dcf <vprintfmt+0x652>
+  800db6:	89 c2                	mov    %eax,%edx
+  800db8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800dbc:	83 c0 08             	add    $0x8,%eax
+  800dbf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800dc2:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800dc5:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800dca:	e9 6e ff ff ff       	jmp    800d3d <vprintfmt+0x5c0>
+  800dcf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800dd3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800dd7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ddb:	eb e5                	jmp    800dc2 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ddd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800de0:	83 f8 2f             	cmp    $0x2f,%eax
+  800de3:	77 18                	ja     800dfd <vprintfmt+0x680>
+  800de5:	89 c2                	mov    %eax,%edx
+  800de7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800deb:	83 c0 08             	add    $0x8,%eax
+  800dee:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800df1:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800df3:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800df8:	e9 40 ff ff ff       	jmp    800d3d <vprintfmt+0x5c0>
+  800dfd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e01:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e05:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e09:	eb e6                	jmp    800df1 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800e0b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800e0e:	83 f8 2f             	cmp    $0x2f,%eax
+  800e11:	77 19                	ja     800e2c <vprintfmt+0x6af>
+  800e13:	89 c2                	mov    %eax,%edx
+  800e15:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800e19:	83 c0 08             	add    $0x8,%eax
+  800e1c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800e1f:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800e22:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800e27:	e9 11 ff ff ff       	jmp    800d3d <vprintfmt+0x5c0>
+  800e2c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e30:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e34:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e38:	eb e5                	jmp    800e1f <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800e3a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800e3e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800e42:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e46:	e9 59 ff ff ff       	jmp    800da4 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800e4b:	4c 89 ee             	mov    %r13,%rsi
+  800e4e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e53:	41 ff d6             	call   *%r14
+            break;
+  800e56:	e9 53 f9 ff ff       	jmp    8007ae <vprintfmt+0x31>
+            putch('%', put_arg);
+  800e5b:	4c 89 ee             	mov    %r13,%rsi
+  800e5e:	bf 25 00 00 00       	mov    $0x25,%edi
+  800e63:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800e66:	48 83 eb 01          	sub    $0x1,%rbx
+  800e6a:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800e6e:	75 f6                	jne    800e66 <vprintfmt+0x6e9>
+  800e70:	e9 39 f9 ff ff       	jmp    8007ae <vprintfmt+0x31>
+}
+  800e75:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800e79:	5b                   	pop    %rbx
+  800e7a:	41 5c                	pop    %r12
+  800e7c:	41 5d                	pop    %r13
+  800e7e:	41 5e                	pop    %r14
+  800e80:	41 5f                	pop    %r15
+  800e82:	5d                   	pop    %rbp
+  800e83:	c3                   	ret
+
+0000000000800e84 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800e84:	55                   	push   %rbp
+  800e85:	48 89 e5             	mov    %rsp,%rbp
+  800e88:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800e8c:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800e90:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800e95:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800e99:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800ea0:	48 85 ff             	test   %rdi,%rdi
+  800ea3:	74 2b                	je     800ed0 <vsnprintf+0x4c>
+  800ea5:	48 85 f6             	test   %rsi,%rsi
+  800ea8:	74 26                	je     800ed0 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800eaa:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800eae:	48 bf 28 07 80 00 00 	movabs $0x800728,%rdi
+  800eb5:	00 00 00 
+  800eb8:	48 b8 7d 07 80 00 00 	movabs $0x80077d,%rax
+  800ebf:	00 00 00 
+  800ec2:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ec4:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ec8:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ecb:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800ece:	c9                   	leave
+  800ecf:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800ed0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800ed5:	eb f7                	jmp    800ece <vsnprintf+0x4a>
+
+0000000000800ed7 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800ed7:	55                   	push   %rbp
+  800ed8:	48 89 e5             	mov    %rsp,%rbp
+  800edb:	48 83 ec 50          	sub    $0x50,%rsp
+  800edf:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ee3:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800ee7:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800eeb:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800ef2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800ef6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800efa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800efe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800f02:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800f06:	48 b8 84 0e 80 00 00 	movabs $0x800e84,%rax
+  800f0d:	00 00 00 
+  800f10:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800f12:	c9                   	leave
+  800f13:	c3                   	ret
+
+0000000000800f14 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800f14:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800f17:	74 10                	je     800f29 <strlen+0x15>
+    size_t n = 0;
+  800f19:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800f1e:	48 83 c0 01          	add    $0x1,%rax
+  800f22:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800f26:	75 f6                	jne    800f1e <strlen+0xa>
+  800f28:	c3                   	ret
+    size_t n = 0;
+  800f29:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800f2f:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800f32:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800f37:	48 85 f6             	test   %rsi,%rsi
+  800f3a:	74 11                	je     800f4d <strnlen+0x1e>
+  800f3c:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800f40:	74 0c                	je     800f4e <strnlen+0x1f>
+  800f42:	48 83 c2 01          	add    $0x1,%rdx
+  800f46:	48 39 d0             	cmp    %rdx,%rax
+  800f49:	75 f1                	jne    800f3c <strnlen+0xd>
+  800f4b:	eb 04                	jmp    800f51 <strnlen+0x22>
+  800f4d:	c3                   	ret
+  800f4e:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800f51:	c3                   	ret
+
+0000000000800f52 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800f52:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  800f5a:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800f5e:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800f61:	48 83 c2 01          	add    $0x1,%rdx
+  800f65:	84 c9                	test   %cl,%cl
+  800f67:	75 f1                	jne    800f5a <strcpy+0x8>
+        ;
+    return res;
+}
+  800f69:	c3                   	ret
+
+0000000000800f6a <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800f6a:	55                   	push   %rbp
+  800f6b:	48 89 e5             	mov    %rsp,%rbp
+  800f6e:	41 54                	push   %r12
+  800f70:	53                   	push   %rbx
+  800f71:	48 89 fb             	mov    %rdi,%rbx
+  800f74:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800f77:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  800f7e:	00 00 00 
+  800f81:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800f83:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800f87:	4c 89 e6             	mov    %r12,%rsi
+  800f8a:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  800f91:	00 00 00 
+  800f94:	ff d0                	call   *%rax
+    return dst;
+}
+  800f96:	48 89 d8             	mov    %rbx,%rax
+  800f99:	5b                   	pop    %rbx
+  800f9a:	41 5c                	pop    %r12
+  800f9c:	5d                   	pop    %rbp
+  800f9d:	c3                   	ret
+
+0000000000800f9e <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800f9e:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800fa1:	48 85 d2             	test   %rdx,%rdx
+  800fa4:	74 1f                	je     800fc5 <strncpy+0x27>
+  800fa6:	48 01 fa             	add    %rdi,%rdx
+  800fa9:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800fac:	48 83 c1 01          	add    $0x1,%rcx
+  800fb0:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800fb4:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800fb8:	41 80 f8 01          	cmp    $0x1,%r8b
+  800fbc:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800fc0:	48 39 ca             	cmp    %rcx,%rdx
+  800fc3:	75 e7                	jne    800fac <strncpy+0xe>
+    }
+    return ret;
+}
+  800fc5:	c3                   	ret
+
+0000000000800fc6 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800fc6:	48 89 f8             	mov    %rdi,%rax
+  800fc9:	48 85 d2             	test   %rdx,%rdx
+  800fcc:	74 24                	je     800ff2 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800fce:	48 83 ea 01          	sub    $0x1,%rdx
+  800fd2:	74 1b                	je     800fef <strlcpy+0x29>
+  800fd4:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800fd8:	0f b6 16             	movzbl (%rsi),%edx
+  800fdb:	84 d2                	test   %dl,%dl
+  800fdd:	74 10                	je     800fef <strlcpy+0x29>
+            *dst++ = *src++;
+  800fdf:	48 83 c6 01          	add    $0x1,%rsi
+  800fe3:	48 83 c0 01          	add    $0x1,%rax
+  800fe7:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800fea:	48 39 c8             	cmp    %rcx,%rax
+  800fed:	75 e9                	jne    800fd8 <strlcpy+0x12>
+        *dst = '\0';
+  800fef:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800ff2:	48 29 f8             	sub    %rdi,%rax
+}
+  800ff5:	c3                   	ret
+
+0000000000800ff6 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800ff6:	0f b6 07             	movzbl (%rdi),%eax
+  800ff9:	84 c0                	test   %al,%al
+  800ffb:	74 13                	je     801010 <strcmp+0x1a>
+  800ffd:	38 06                	cmp    %al,(%rsi)
+  800fff:	75 0f                	jne    801010 <strcmp+0x1a>
+  801001:	48 83 c7 01          	add    $0x1,%rdi
+  801005:	48 83 c6 01          	add    $0x1,%rsi
+  801009:	0f b6 07             	movzbl (%rdi),%eax
+  80100c:	84 c0                	test   %al,%al
+  80100e:	75 ed                	jne    800ffd <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801010:	0f b6 c0             	movzbl %al,%eax
+  801013:	0f b6 16             	movzbl (%rsi),%edx
+  801016:	29 d0                	sub    %edx,%eax
+}
+  801018:	c3                   	ret
+
+0000000000801019 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  801019:	48 85 d2             	test   %rdx,%rdx
+  80101c:	74 1f                	je     80103d <strncmp+0x24>
+  80101e:	0f b6 07             	movzbl (%rdi),%eax
+  801021:	84 c0                	test   %al,%al
+  801023:	74 1e                	je     801043 <strncmp+0x2a>
+  801025:	3a 06                	cmp    (%rsi),%al
+  801027:	75 1a                	jne    801043 <strncmp+0x2a>
+  801029:	48 83 c7 01          	add    $0x1,%rdi
+  80102d:	48 83 c6 01          	add    $0x1,%rsi
+  801031:	48 83 ea 01          	sub    $0x1,%rdx
+  801035:	75 e7                	jne    80101e <strncmp+0x5>
+
+    if (!n) return 0;
+  801037:	b8 00 00 00 00       	mov    $0x0,%eax
+  80103c:	c3                   	ret
+  80103d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801042:	c3                   	ret
+  801043:	48 85 d2             	test   %rdx,%rdx
+  801046:	74 09                	je     801051 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  801048:	0f b6 07             	movzbl (%rdi),%eax
+  80104b:	0f b6 16             	movzbl (%rsi),%edx
+  80104e:	29 d0                	sub    %edx,%eax
+  801050:	c3                   	ret
+    if (!n) return 0;
+  801051:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801056:	c3                   	ret
+
+0000000000801057 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801057:	0f b6 17             	movzbl (%rdi),%edx
+  80105a:	84 d2                	test   %dl,%dl
+  80105c:	74 18                	je     801076 <strchr+0x1f>
+        if (*str == c) {
+  80105e:	0f be d2             	movsbl %dl,%edx
+  801061:	39 f2                	cmp    %esi,%edx
+  801063:	74 17                	je     80107c <strchr+0x25>
+    for (; *str; str++) {
+  801065:	48 83 c7 01          	add    $0x1,%rdi
+  801069:	0f b6 17             	movzbl (%rdi),%edx
+  80106c:	84 d2                	test   %dl,%dl
+  80106e:	75 ee                	jne    80105e <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  801070:	b8 00 00 00 00       	mov    $0x0,%eax
+  801075:	c3                   	ret
+  801076:	b8 00 00 00 00       	mov    $0x0,%eax
+  80107b:	c3                   	ret
+  80107c:	48 89 f8             	mov    %rdi,%rax
+}
+  80107f:	c3                   	ret
+
+0000000000801080 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  801080:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  801083:	0f b6 17             	movzbl (%rdi),%edx
+  801086:	84 d2                	test   %dl,%dl
+  801088:	74 13                	je     80109d <strfind+0x1d>
+  80108a:	0f be d2             	movsbl %dl,%edx
+  80108d:	39 f2                	cmp    %esi,%edx
+  80108f:	74 0b                	je     80109c <strfind+0x1c>
+  801091:	48 83 c0 01          	add    $0x1,%rax
+  801095:	0f b6 10             	movzbl (%rax),%edx
+  801098:	84 d2                	test   %dl,%dl
+  80109a:	75 ee                	jne    80108a <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  80109c:	c3                   	ret
+  80109d:	c3                   	ret
+
+000000000080109e <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  80109e:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  8010a1:	48 89 f8             	mov    %rdi,%rax
+  8010a4:	48 f7 d8             	neg    %rax
+  8010a7:	83 e0 07             	and    $0x7,%eax
+  8010aa:	49 89 d1             	mov    %rdx,%r9
+  8010ad:	49 29 c1             	sub    %rax,%r9
+  8010b0:	78 36                	js     8010e8 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  8010b2:	40 0f b6 c6          	movzbl %sil,%eax
+  8010b6:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  8010bd:	01 01 01 
+  8010c0:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  8010c4:	40 f6 c7 07          	test   $0x7,%dil
+  8010c8:	75 38                	jne    801102 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  8010ca:	4c 89 c9             	mov    %r9,%rcx
+  8010cd:	48 c1 f9 03          	sar    $0x3,%rcx
+  8010d1:	74 0c                	je     8010df <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  8010d3:	fc                   	cld
+  8010d4:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  8010d7:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  8010db:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  8010df:	4d 85 c9             	test   %r9,%r9
+  8010e2:	75 45                	jne    801129 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  8010e4:	4c 89 c0             	mov    %r8,%rax
+  8010e7:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  8010e8:	48 85 d2             	test   %rdx,%rdx
+  8010eb:	74 f7                	je     8010e4 <memset+0x46>
+  8010ed:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  8010f0:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  8010f3:	48 83 c0 01          	add    $0x1,%rax
+  8010f7:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8010fb:	48 39 c2             	cmp    %rax,%rdx
+  8010fe:	75 f3                	jne    8010f3 <memset+0x55>
+  801100:	eb e2                	jmp    8010e4 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801102:	40 f6 c7 01          	test   $0x1,%dil
+  801106:	74 06                	je     80110e <memset+0x70>
+  801108:	88 07                	mov    %al,(%rdi)
+  80110a:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  80110e:	40 f6 c7 02          	test   $0x2,%dil
+  801112:	74 07                	je     80111b <memset+0x7d>
+  801114:	66 89 07             	mov    %ax,(%rdi)
+  801117:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80111b:	40 f6 c7 04          	test   $0x4,%dil
+  80111f:	74 a9                	je     8010ca <memset+0x2c>
+  801121:	89 07                	mov    %eax,(%rdi)
+  801123:	48 83 c7 04          	add    $0x4,%rdi
+  801127:	eb a1                	jmp    8010ca <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  801129:	41 f6 c1 04          	test   $0x4,%r9b
+  80112d:	74 06                	je     801135 <memset+0x97>
+  80112f:	89 07                	mov    %eax,(%rdi)
+  801131:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801135:	41 f6 c1 02          	test   $0x2,%r9b
+  801139:	74 07                	je     801142 <memset+0xa4>
+  80113b:	66 89 07             	mov    %ax,(%rdi)
+  80113e:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801142:	41 f6 c1 01          	test   $0x1,%r9b
+  801146:	74 9c                	je     8010e4 <memset+0x46>
+  801148:	88 07                	mov    %al,(%rdi)
+  80114a:	eb 98                	jmp    8010e4 <memset+0x46>
+
+000000000080114c <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80114c:	48 89 f8             	mov    %rdi,%rax
+  80114f:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  801152:	48 39 fe             	cmp    %rdi,%rsi
+  801155:	73 3b                	jae    801192 <memmove+0x46>
+  801157:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  80115b:	48 39 d7             	cmp    %rdx,%rdi
+  80115e:	73 32                	jae    801192 <memmove+0x46>
+        s += n;
+        d += n;
+  801160:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801164:	48 89 d6             	mov    %rdx,%rsi
+  801167:	48 09 fe             	or     %rdi,%rsi
+  80116a:	48 09 ce             	or     %rcx,%rsi
+  80116d:	40 f6 c6 07          	test   $0x7,%sil
+  801171:	75 12                	jne    801185 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  801173:	48 83 ef 08          	sub    $0x8,%rdi
+  801177:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  80117b:	48 c1 e9 03          	shr    $0x3,%rcx
+  80117f:	fd                   	std
+  801180:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  801183:	fc                   	cld
+  801184:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  801185:	48 83 ef 01          	sub    $0x1,%rdi
+  801189:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  80118d:	fd                   	std
+  80118e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  801190:	eb f1                	jmp    801183 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  801192:	48 89 f2             	mov    %rsi,%rdx
+  801195:	48 09 c2             	or     %rax,%rdx
+  801198:	48 09 ca             	or     %rcx,%rdx
+  80119b:	f6 c2 07             	test   $0x7,%dl
+  80119e:	75 0c                	jne    8011ac <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8011a0:	48 c1 e9 03          	shr    $0x3,%rcx
+  8011a4:	48 89 c7             	mov    %rax,%rdi
+  8011a7:	fc                   	cld
+  8011a8:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8011ab:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8011ac:	48 89 c7             	mov    %rax,%rdi
+  8011af:	fc                   	cld
+  8011b0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  8011b2:	c3                   	ret
+
+00000000008011b3 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  8011b3:	55                   	push   %rbp
+  8011b4:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  8011b7:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  8011be:	00 00 00 
+  8011c1:	ff d0                	call   *%rax
+}
+  8011c3:	5d                   	pop    %rbp
+  8011c4:	c3                   	ret
+
+00000000008011c5 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  8011c5:	55                   	push   %rbp
+  8011c6:	48 89 e5             	mov    %rsp,%rbp
+  8011c9:	41 57                	push   %r15
+  8011cb:	41 56                	push   %r14
+  8011cd:	41 55                	push   %r13
+  8011cf:	41 54                	push   %r12
+  8011d1:	53                   	push   %rbx
+  8011d2:	48 83 ec 08          	sub    $0x8,%rsp
+  8011d6:	49 89 fe             	mov    %rdi,%r14
+  8011d9:	49 89 f7             	mov    %rsi,%r15
+  8011dc:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  8011df:	48 89 f7             	mov    %rsi,%rdi
+  8011e2:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  8011e9:	00 00 00 
+  8011ec:	ff d0                	call   *%rax
+  8011ee:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  8011f1:	48 89 de             	mov    %rbx,%rsi
+  8011f4:	4c 89 f7             	mov    %r14,%rdi
+  8011f7:	48 b8 2f 0f 80 00 00 	movabs $0x800f2f,%rax
+  8011fe:	00 00 00 
+  801201:	ff d0                	call   *%rax
+  801203:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801206:	48 39 c3             	cmp    %rax,%rbx
+  801209:	74 36                	je     801241 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80120b:	48 89 d8             	mov    %rbx,%rax
+  80120e:	4c 29 e8             	sub    %r13,%rax
+  801211:	49 39 c4             	cmp    %rax,%r12
+  801214:	73 31                	jae    801247 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801216:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80121b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80121f:	4c 89 fe             	mov    %r15,%rsi
+  801222:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  801229:	00 00 00 
+  80122c:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  80122e:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801232:	48 83 c4 08          	add    $0x8,%rsp
+  801236:	5b                   	pop    %rbx
+  801237:	41 5c                	pop    %r12
+  801239:	41 5d                	pop    %r13
+  80123b:	41 5e                	pop    %r14
+  80123d:	41 5f                	pop    %r15
+  80123f:	5d                   	pop    %rbp
+  801240:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801241:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801245:	eb eb                	jmp    801232 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801247:	48 83 eb 01          	sub    $0x1,%rbx
+  80124b:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  80124f:	48 89 da             	mov    %rbx,%rdx
+  801252:	4c 89 fe             	mov    %r15,%rsi
+  801255:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  80125c:	00 00 00 
+  80125f:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  801261:	49 01 de             	add    %rbx,%r14
+  801264:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801269:	eb c3                	jmp    80122e <strlcat+0x69>
+
+000000000080126b <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  80126b:	48 85 d2             	test   %rdx,%rdx
+  80126e:	74 2d                	je     80129d <memcmp+0x32>
+  801270:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  801275:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801279:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  80127e:	44 38 c1             	cmp    %r8b,%cl
+  801281:	75 0f                	jne    801292 <memcmp+0x27>
+    while (n-- > 0) {
+  801283:	48 83 c0 01          	add    $0x1,%rax
+  801287:	48 39 c2             	cmp    %rax,%rdx
+  80128a:	75 e9                	jne    801275 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  80128c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801291:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801292:	0f b6 c1             	movzbl %cl,%eax
+  801295:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801299:	44 29 c0             	sub    %r8d,%eax
+  80129c:	c3                   	ret
+    return 0;
+  80129d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8012a2:	c3                   	ret
+
+00000000008012a3 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8012a3:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8012a7:	48 39 c7             	cmp    %rax,%rdi
+  8012aa:	73 0f                	jae    8012bb <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8012ac:	40 38 37             	cmp    %sil,(%rdi)
+  8012af:	74 0e                	je     8012bf <memfind+0x1c>
+    for (; src < end; src++) {
+  8012b1:	48 83 c7 01          	add    $0x1,%rdi
+  8012b5:	48 39 f8             	cmp    %rdi,%rax
+  8012b8:	75 f2                	jne    8012ac <memfind+0x9>
+  8012ba:	c3                   	ret
+  8012bb:	48 89 f8             	mov    %rdi,%rax
+  8012be:	c3                   	ret
+  8012bf:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  8012c2:	c3                   	ret
+
+00000000008012c3 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  8012c3:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  8012c6:	0f b6 37             	movzbl (%rdi),%esi
+  8012c9:	40 80 fe 20          	cmp    $0x20,%sil
+  8012cd:	74 06                	je     8012d5 <strtol+0x12>
+  8012cf:	40 80 fe 09          	cmp    $0x9,%sil
+  8012d3:	75 13                	jne    8012e8 <strtol+0x25>
+  8012d5:	48 83 c7 01          	add    $0x1,%rdi
+  8012d9:	0f b6 37             	movzbl (%rdi),%esi
+  8012dc:	40 80 fe 20          	cmp    $0x20,%sil
+  8012e0:	74 f3                	je     8012d5 <strtol+0x12>
+  8012e2:	40 80 fe 09          	cmp    $0x9,%sil
+  8012e6:	74 ed                	je     8012d5 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  8012e8:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  8012eb:	83 e0 fd             	and    $0xfffffffd,%eax
+  8012ee:	3c 01                	cmp    $0x1,%al
+  8012f0:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8012f4:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8012fa:	75 0f                	jne    80130b <strtol+0x48>
+  8012fc:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8012ff:	74 14                	je     801315 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801301:	85 d2                	test   %edx,%edx
+  801303:	b8 0a 00 00 00       	mov    $0xa,%eax
+  801308:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80130b:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801310:	4c 63 ca             	movslq %edx,%r9
+  801313:	eb 36                	jmp    80134b <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801315:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  801319:	74 0f                	je     80132a <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80131b:	85 d2                	test   %edx,%edx
+  80131d:	75 ec                	jne    80130b <strtol+0x48>
+        s++;
+  80131f:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801323:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801328:	eb e1                	jmp    80130b <strtol+0x48>
+        s += 2;
+  80132a:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80132e:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801333:	eb d6                	jmp    80130b <strtol+0x48>
+            dig -= '0';
+  801335:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801338:	44 0f b6 c1          	movzbl %cl,%r8d
+  80133c:	41 39 d0             	cmp    %edx,%r8d
+  80133f:	7d 21                	jge    801362 <strtol+0x9f>
+        val = val * base + dig;
+  801341:	49 0f af c1          	imul   %r9,%rax
+  801345:	0f b6 c9             	movzbl %cl,%ecx
+  801348:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80134b:	48 83 c7 01          	add    $0x1,%rdi
+  80134f:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801353:	80 f9 39             	cmp    $0x39,%cl
+  801356:	76 dd                	jbe    801335 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801358:	80 f9 7b             	cmp    $0x7b,%cl
+  80135b:	77 05                	ja     801362 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80135d:	83 e9 57             	sub    $0x57,%ecx
+  801360:	eb d6                	jmp    801338 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801362:	4d 85 d2             	test   %r10,%r10
+  801365:	74 03                	je     80136a <strtol+0xa7>
+  801367:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  80136a:	48 89 c2             	mov    %rax,%rdx
+  80136d:	48 f7 da             	neg    %rdx
+  801370:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801374:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801378:	c3                   	ret
+
+0000000000801379 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801379:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80137e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801383:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801389:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80138f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801395:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801397:	c3                   	ret
+
+0000000000801398 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801398:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80139d:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013be:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c0:	c3                   	ret
+
+00000000008013c1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8013c1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013c9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013d3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013e7:	48 85 c0             	test   %rax,%rax
+  8013ea:	7f 01                	jg     8013ed <sys_env_destroy+0x2c>
+}
+  8013ec:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8013ed:	55                   	push   %rbp
+  8013ee:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f1:	49 89 c0             	mov    %rax,%r8
+  8013f4:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8013f9:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801400:	00 00 00 
+  801403:	be 29 00 00 00       	mov    $0x29,%esi
+  801408:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80140f:	00 00 00 
+  801412:	b8 00 00 00 00       	mov    $0x0,%eax
+  801417:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  80141e:	00 00 00 
+  801421:	41 ff d1             	call   *%r9
+
+0000000000801424 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801424:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801429:	bf 00 00 00 00       	mov    $0x0,%edi
+  80142e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801433:	ba 00 00 00 00       	mov    $0x0,%edx
+  801438:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80143e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801444:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144a:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80144c:	c3                   	ret
+
+000000000080144d <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801452:	bf 00 00 00 00       	mov    $0x0,%edi
+  801457:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80145c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801461:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801467:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801473:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801475:	c3                   	ret
+
+0000000000801476 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801476:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80147b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801482:	00 00 00 
+  801485:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80148b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801491:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801497:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801499:	c3                   	ret
+
+000000000080149a <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80149a:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80149d:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014ae:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  8014b0:	c3                   	ret
+
+00000000008014b1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  8014b1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014b4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b9:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014ca:	48 85 c0             	test   %rax,%rax
+  8014cd:	7f 01                	jg     8014d0 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8014cf:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8014d0:	55                   	push   %rbp
+  8014d1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014d4:	49 89 c0             	mov    %rax,%r8
+  8014d7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8014dc:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8014e3:	00 00 00 
+  8014e6:	be 29 00 00 00       	mov    $0x29,%esi
+  8014eb:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8014f2:	00 00 00 
+  8014f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014fa:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  801501:	00 00 00 
+  801504:	41 ff d1             	call   *%r9
+
+0000000000801507 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801507:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80150a:	48 63 d2             	movslq %edx,%rdx
+  80150d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801510:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801515:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  801518:	0f 05                	syscall
+    if (check && ret > 0) {
+  80151a:	48 85 c0             	test   %rax,%rax
+  80151d:	7f 01                	jg     801520 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80151f:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801520:	55                   	push   %rbp
+  801521:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801524:	49 89 c0             	mov    %rax,%r8
+  801527:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80152c:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801533:	00 00 00 
+  801536:	be 29 00 00 00       	mov    $0x29,%esi
+  80153b:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  801542:	00 00 00 
+  801545:	b8 00 00 00 00       	mov    $0x0,%eax
+  80154a:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  801551:	00 00 00 
+  801554:	41 ff d1             	call   *%r9
+
+0000000000801557 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801557:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80155a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80155f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801565:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80156b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801571:	0f 05                	syscall
+    if (check && ret > 0) {
+  801573:	48 85 c0             	test   %rax,%rax
+  801576:	7f 01                	jg     801579 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801578:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801579:	55                   	push   %rbp
+  80157a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80157d:	49 89 c0             	mov    %rax,%r8
+  801580:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801585:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  80158c:	00 00 00 
+  80158f:	be 29 00 00 00       	mov    $0x29,%esi
+  801594:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80159b:	00 00 00 
+  80159e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015a3:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  8015aa:	00 00 00 
+  8015ad:	41 ff d1             	call   *%r9
+
+00000000008015b0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8015b0:	48 63 f6             	movslq %esi,%rsi
+  8015b3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015b6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015d2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015d4:	48 85 c0             	test   %rax,%rax
+  8015d7:	7f 01                	jg     8015da <sys_env_set_status+0x2a>
+}
+  8015d9:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8015da:	55                   	push   %rbp
+  8015db:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015de:	49 89 c0             	mov    %rax,%r8
+  8015e1:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8015e6:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8015ed:	00 00 00 
+  8015f0:	be 29 00 00 00       	mov    $0x29,%esi
+  8015f5:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8015fc:	00 00 00 
+  8015ff:	b8 00 00 00 00       	mov    $0x0,%eax
+  801604:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  80160b:	00 00 00 
+  80160e:	41 ff d1             	call   *%r9
+
+0000000000801611 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801611:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801614:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801619:	ba 00 00 00 00       	mov    $0x0,%edx
+  80161e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801624:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80162a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801630:	0f 05                	syscall
+    if (check && ret > 0) {
+  801632:	48 85 c0             	test   %rax,%rax
+  801635:	7f 01                	jg     801638 <sys_env_set_trapframe+0x27>
+}
+  801637:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801638:	55                   	push   %rbp
+  801639:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80163c:	49 89 c0             	mov    %rax,%r8
+  80163f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801644:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  80164b:	00 00 00 
+  80164e:	be 29 00 00 00       	mov    $0x29,%esi
+  801653:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  80165a:	00 00 00 
+  80165d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801662:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  801669:	00 00 00 
+  80166c:	41 ff d1             	call   *%r9
+
+000000000080166f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80166f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801672:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801677:	ba 00 00 00 00       	mov    $0x0,%edx
+  80167c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801682:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801688:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80168e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801690:	48 85 c0             	test   %rax,%rax
+  801693:	7f 01                	jg     801696 <sys_env_set_pgfault_upcall+0x27>
+}
+  801695:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801696:	55                   	push   %rbp
+  801697:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80169a:	49 89 c0             	mov    %rax,%r8
+  80169d:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8016a2:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8016a9:	00 00 00 
+  8016ac:	be 29 00 00 00       	mov    $0x29,%esi
+  8016b1:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8016b8:	00 00 00 
+  8016bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016c0:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  8016c7:	00 00 00 
+  8016ca:	41 ff d1             	call   *%r9
+
+00000000008016cd <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016cd:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016d0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016d3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016d8:	4d 63 c0             	movslq %r8d,%r8
+  8016db:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e1:	0f 05                	syscall
+}
+  8016e3:	c3                   	ret
+
+00000000008016e4 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8016e4:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8016e7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8016ea:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016ef:	4d 63 c0             	movslq %r8d,%r8
+  8016f2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016f8:	0f 05                	syscall
+}
+  8016fa:	c3                   	ret
+
+00000000008016fb <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016fb:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801700:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801703:	45 89 c0             	mov    %r8d,%r8d
+  801706:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80170c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80170e:	48 85 c0             	test   %rax,%rax
+  801711:	7f 01                	jg     801714 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801713:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801714:	55                   	push   %rbp
+  801715:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801718:	49 89 c0             	mov    %rax,%r8
+  80171b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801720:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  801727:	00 00 00 
+  80172a:	be 29 00 00 00       	mov    $0x29,%esi
+  80172f:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  801736:	00 00 00 
+  801739:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173e:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  801745:	00 00 00 
+  801748:	41 ff d1             	call   *%r9
+
+000000000080174b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80174b:	55                   	push   %rbp
+  80174c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80174f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801755:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80175a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175f:	48 b8 fb 16 80 00 00 	movabs $0x8016fb,%rax
+  801766:	00 00 00 
+  801769:	ff d0                	call   *%rax
+}
+  80176b:	5d                   	pop    %rbp
+  80176c:	c3                   	ret
+
+000000000080176d <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80176d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801772:	bf 00 00 00 00       	mov    $0x0,%edi
+  801777:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801781:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801787:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80178d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801793:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801795:	c3                   	ret
+
+0000000000801796 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801796:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80179b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017a0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017a5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017b1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017b7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017b9:	48 85 c0             	test   %rax,%rax
+  8017bc:	7f 01                	jg     8017bf <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8017be:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8017bf:	55                   	push   %rbp
+  8017c0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8017c3:	49 89 c0             	mov    %rax,%r8
+  8017c6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8017cb:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8017d2:	00 00 00 
+  8017d5:	be 29 00 00 00       	mov    $0x29,%esi
+  8017da:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8017e1:	00 00 00 
+  8017e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017e9:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  8017f0:	00 00 00 
+  8017f3:	41 ff d1             	call   *%r9
+
+00000000008017f6 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8017f6:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017fb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801800:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801805:	ba 00 00 00 00       	mov    $0x0,%edx
+  80180a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801810:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801816:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80181c:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80181e:	c3                   	ret
+
+000000000080181f <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80181f:	89 d2                	mov    %edx,%edx
+  801821:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801823:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801828:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80182e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801834:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80183a:	0f 05                	syscall
+}
+  80183c:	c3                   	ret
+
+000000000080183d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80183d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801840:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801845:	ba 00 00 00 00       	mov    $0x0,%edx
+  80184a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801850:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801856:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80185c:	0f 05                	syscall
+}
+  80185e:	c3                   	ret
+
+000000000080185f <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80185f:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801862:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801867:	ba 00 00 00 00       	mov    $0x0,%edx
+  80186c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801872:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801878:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80187e:	0f 05                	syscall
+}
+  801880:	c3                   	ret
+
+0000000000801881 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801881:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801884:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801889:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80188e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801893:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801899:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80189f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8018a5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8018a7:	48 85 c0             	test   %rax,%rax
+  8018aa:	7f 01                	jg     8018ad <sys_irq_ack+0x2c>
+}
+  8018ac:	c3                   	ret
+sys_irq_ack(int irq) {
+  8018ad:	55                   	push   %rbp
+  8018ae:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8018b1:	49 89 c0             	mov    %rax,%r8
+  8018b4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8018b9:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  8018c0:	00 00 00 
+  8018c3:	be 29 00 00 00       	mov    $0x29,%esi
+  8018c8:	48 bf b7 50 80 00 00 	movabs $0x8050b7,%rdi
+  8018cf:	00 00 00 
+  8018d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018d7:	49 b9 dd 04 80 00 00 	movabs $0x8004dd,%r9
+  8018de:	00 00 00 
+  8018e1:	41 ff d1             	call   *%r9
+
+00000000008018e4 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018e4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018eb:	ff ff ff 
+  8018ee:	48 01 f8             	add    %rdi,%rax
+  8018f1:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018f5:	c3                   	ret
+
+00000000008018f6 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018f6:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018fd:	ff ff ff 
+  801900:	48 01 f8             	add    %rdi,%rax
+  801903:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801907:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80190d:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801911:	c3                   	ret
+
+0000000000801912 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801912:	55                   	push   %rbp
+  801913:	48 89 e5             	mov    %rsp,%rbp
+  801916:	41 57                	push   %r15
+  801918:	41 56                	push   %r14
+  80191a:	41 55                	push   %r13
+  80191c:	41 54                	push   %r12
+  80191e:	53                   	push   %rbx
+  80191f:	48 83 ec 08          	sub    $0x8,%rsp
+  801923:	49 89 ff             	mov    %rdi,%r15
+  801926:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80192b:	49 bd a1 40 80 00 00 	movabs $0x8040a1,%r13
+  801932:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801935:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  80193b:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80193e:	48 89 df             	mov    %rbx,%rdi
+  801941:	41 ff d5             	call   *%r13
+  801944:	83 e0 04             	and    $0x4,%eax
+  801947:	74 17                	je     801960 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801949:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  801950:	4c 39 f3             	cmp    %r14,%rbx
+  801953:	75 e6                	jne    80193b <fd_alloc+0x29>
+  801955:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  80195b:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  801960:	4d 89 27             	mov    %r12,(%r15)
+}
+  801963:	48 83 c4 08          	add    $0x8,%rsp
+  801967:	5b                   	pop    %rbx
+  801968:	41 5c                	pop    %r12
+  80196a:	41 5d                	pop    %r13
+  80196c:	41 5e                	pop    %r14
+  80196e:	41 5f                	pop    %r15
+  801970:	5d                   	pop    %rbp
+  801971:	c3                   	ret
+
+0000000000801972 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801972:	83 ff 1f             	cmp    $0x1f,%edi
+  801975:	77 39                	ja     8019b0 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801977:	55                   	push   %rbp
+  801978:	48 89 e5             	mov    %rsp,%rbp
+  80197b:	41 54                	push   %r12
+  80197d:	53                   	push   %rbx
+  80197e:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801981:	48 63 df             	movslq %edi,%rbx
+  801984:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80198b:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80198f:	48 89 df             	mov    %rbx,%rdi
+  801992:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  801999:	00 00 00 
+  80199c:	ff d0                	call   *%rax
+  80199e:	a8 04                	test   $0x4,%al
+  8019a0:	74 14                	je     8019b6 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8019a2:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8019a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8019ab:	5b                   	pop    %rbx
+  8019ac:	41 5c                	pop    %r12
+  8019ae:	5d                   	pop    %rbp
+  8019af:	c3                   	ret
+        return -E_INVAL;
+  8019b0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8019b5:	c3                   	ret
+        return -E_INVAL;
+  8019b6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8019bb:	eb ee                	jmp    8019ab <fd_lookup+0x39>
+
+00000000008019bd <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8019bd:	55                   	push   %rbp
+  8019be:	48 89 e5             	mov    %rsp,%rbp
+  8019c1:	41 54                	push   %r12
+  8019c3:	53                   	push   %rbx
+  8019c4:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8019c7:	48 b8 60 51 80 00 00 	movabs $0x805160,%rax
+  8019ce:	00 00 00 
+  8019d1:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8019d8:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019db:	39 3b                	cmp    %edi,(%rbx)
+  8019dd:	74 47                	je     801a26 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019df:	48 83 c0 08          	add    $0x8,%rax
+  8019e3:	48 8b 18             	mov    (%rax),%rbx
+  8019e6:	48 85 db             	test   %rbx,%rbx
+  8019e9:	75 f0                	jne    8019db <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019eb:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  8019f2:	00 00 00 
+  8019f5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019fb:	89 fa                	mov    %edi,%edx
+  8019fd:	48 bf c8 50 80 00 00 	movabs $0x8050c8,%rdi
+  801a04:	00 00 00 
+  801a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a0c:	48 b9 2d 06 80 00 00 	movabs $0x80062d,%rcx
+  801a13:	00 00 00 
+  801a16:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a18:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a1d:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a21:	5b                   	pop    %rbx
+  801a22:	41 5c                	pop    %r12
+  801a24:	5d                   	pop    %rbp
+  801a25:	c3                   	ret
+            return 0;
+  801a26:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a2b:	eb f0                	jmp    801a1d <dev_lookup+0x60>
+
+0000000000801a2d <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a2d:	55                   	push   %rbp
+  801a2e:	48 89 e5             	mov    %rsp,%rbp
+  801a31:	41 55                	push   %r13
+  801a33:	41 54                	push   %r12
+  801a35:	53                   	push   %rbx
+  801a36:	48 83 ec 18          	sub    $0x18,%rsp
+  801a3a:	48 89 fb             	mov    %rdi,%rbx
+  801a3d:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a40:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a47:	ff ff ff 
+  801a4a:	48 01 df             	add    %rbx,%rdi
+  801a4d:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a51:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a55:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801a5c:	00 00 00 
+  801a5f:	ff d0                	call   *%rax
+  801a61:	41 89 c5             	mov    %eax,%r13d
+  801a64:	85 c0                	test   %eax,%eax
+  801a66:	78 06                	js     801a6e <fd_close+0x41>
+  801a68:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a6c:	74 1a                	je     801a88 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a6e:	45 84 e4             	test   %r12b,%r12b
+  801a71:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a76:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a7a:	44 89 e8             	mov    %r13d,%eax
+  801a7d:	48 83 c4 18          	add    $0x18,%rsp
+  801a81:	5b                   	pop    %rbx
+  801a82:	41 5c                	pop    %r12
+  801a84:	41 5d                	pop    %r13
+  801a86:	5d                   	pop    %rbp
+  801a87:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a88:	8b 3b                	mov    (%rbx),%edi
+  801a8a:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a8e:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801a95:	00 00 00 
+  801a98:	ff d0                	call   *%rax
+  801a9a:	41 89 c5             	mov    %eax,%r13d
+  801a9d:	85 c0                	test   %eax,%eax
+  801a9f:	78 1b                	js     801abc <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801aa1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa5:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801aa9:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801aaf:	48 85 c0             	test   %rax,%rax
+  801ab2:	74 08                	je     801abc <fd_close+0x8f>
+  801ab4:	48 89 df             	mov    %rbx,%rdi
+  801ab7:	ff d0                	call   *%rax
+  801ab9:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801abc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ac1:	48 89 de             	mov    %rbx,%rsi
+  801ac4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ac9:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+    return res;
+  801ad5:	eb a3                	jmp    801a7a <fd_close+0x4d>
+
+0000000000801ad7 <close>:
+
+int
+close(int fdnum) {
+  801ad7:	55                   	push   %rbp
+  801ad8:	48 89 e5             	mov    %rsp,%rbp
+  801adb:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801adf:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ae3:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801aea:	00 00 00 
+  801aed:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801aef:	85 c0                	test   %eax,%eax
+  801af1:	78 15                	js     801b08 <close+0x31>
+
+    return fd_close(fd, 1);
+  801af3:	be 01 00 00 00       	mov    $0x1,%esi
+  801af8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801afc:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  801b03:	00 00 00 
+  801b06:	ff d0                	call   *%rax
+}
+  801b08:	c9                   	leave
+  801b09:	c3                   	ret
+
+0000000000801b0a <close_all>:
+
+void
+close_all(void) {
+  801b0a:	55                   	push   %rbp
+  801b0b:	48 89 e5             	mov    %rsp,%rbp
+  801b0e:	41 54                	push   %r12
+  801b10:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b11:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b16:	49 bc d7 1a 80 00 00 	movabs $0x801ad7,%r12
+  801b1d:	00 00 00 
+  801b20:	89 df                	mov    %ebx,%edi
+  801b22:	41 ff d4             	call   *%r12
+  801b25:	83 c3 01             	add    $0x1,%ebx
+  801b28:	83 fb 20             	cmp    $0x20,%ebx
+  801b2b:	75 f3                	jne    801b20 <close_all+0x16>
+}
+  801b2d:	5b                   	pop    %rbx
+  801b2e:	41 5c                	pop    %r12
+  801b30:	5d                   	pop    %rbp
+  801b31:	c3                   	ret
+
+0000000000801b32 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b32:	55                   	push   %rbp
+  801b33:	48 89 e5             	mov    %rsp,%rbp
+  801b36:	41 57                	push   %r15
+  801b38:	41 56                	push   %r14
+  801b3a:	41 55                	push   %r13
+  801b3c:	41 54                	push   %r12
+  801b3e:	53                   	push   %rbx
+  801b3f:	48 83 ec 18          	sub    $0x18,%rsp
+  801b43:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b46:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b4a:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801b51:	00 00 00 
+  801b54:	ff d0                	call   *%rax
+  801b56:	89 c3                	mov    %eax,%ebx
+  801b58:	85 c0                	test   %eax,%eax
+  801b5a:	0f 88 b8 00 00 00    	js     801c18 <dup+0xe6>
+    close(newfdnum);
+  801b60:	44 89 e7             	mov    %r12d,%edi
+  801b63:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  801b6a:	00 00 00 
+  801b6d:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b6f:	4d 63 ec             	movslq %r12d,%r13
+  801b72:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b79:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b7d:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b81:	4c 89 ff             	mov    %r15,%rdi
+  801b84:	49 be f6 18 80 00 00 	movabs $0x8018f6,%r14
+  801b8b:	00 00 00 
+  801b8e:	41 ff d6             	call   *%r14
+  801b91:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b94:	4c 89 ef             	mov    %r13,%rdi
+  801b97:	41 ff d6             	call   *%r14
+  801b9a:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b9d:	48 89 df             	mov    %rbx,%rdi
+  801ba0:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  801ba7:	00 00 00 
+  801baa:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801bac:	a8 04                	test   $0x4,%al
+  801bae:	74 2b                	je     801bdb <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801bb0:	41 89 c1             	mov    %eax,%r9d
+  801bb3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bb9:	4c 89 f1             	mov    %r14,%rcx
+  801bbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc1:	48 89 de             	mov    %rbx,%rsi
+  801bc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc9:	48 b8 07 15 80 00 00 	movabs $0x801507,%rax
+  801bd0:	00 00 00 
+  801bd3:	ff d0                	call   *%rax
+  801bd5:	89 c3                	mov    %eax,%ebx
+  801bd7:	85 c0                	test   %eax,%eax
+  801bd9:	78 4e                	js     801c29 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801bdb:	4c 89 ff             	mov    %r15,%rdi
+  801bde:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  801be5:	00 00 00 
+  801be8:	ff d0                	call   *%rax
+  801bea:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bed:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bf3:	4c 89 e9             	mov    %r13,%rcx
+  801bf6:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bfb:	4c 89 fe             	mov    %r15,%rsi
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	48 b8 07 15 80 00 00 	movabs $0x801507,%rax
+  801c0a:	00 00 00 
+  801c0d:	ff d0                	call   *%rax
+  801c0f:	89 c3                	mov    %eax,%ebx
+  801c11:	85 c0                	test   %eax,%eax
+  801c13:	78 14                	js     801c29 <dup+0xf7>
+
+    return newfdnum;
+  801c15:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c18:	89 d8                	mov    %ebx,%eax
+  801c1a:	48 83 c4 18          	add    $0x18,%rsp
+  801c1e:	5b                   	pop    %rbx
+  801c1f:	41 5c                	pop    %r12
+  801c21:	41 5d                	pop    %r13
+  801c23:	41 5e                	pop    %r14
+  801c25:	41 5f                	pop    %r15
+  801c27:	5d                   	pop    %rbp
+  801c28:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c29:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c2e:	4c 89 ee             	mov    %r13,%rsi
+  801c31:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c36:	49 bc 57 15 80 00 00 	movabs $0x801557,%r12
+  801c3d:	00 00 00 
+  801c40:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c43:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c48:	4c 89 f6             	mov    %r14,%rsi
+  801c4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c50:	41 ff d4             	call   *%r12
+    return res;
+  801c53:	eb c3                	jmp    801c18 <dup+0xe6>
+
+0000000000801c55 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c55:	55                   	push   %rbp
+  801c56:	48 89 e5             	mov    %rsp,%rbp
+  801c59:	41 56                	push   %r14
+  801c5b:	41 55                	push   %r13
+  801c5d:	41 54                	push   %r12
+  801c5f:	53                   	push   %rbx
+  801c60:	48 83 ec 10          	sub    $0x10,%rsp
+  801c64:	89 fb                	mov    %edi,%ebx
+  801c66:	49 89 f4             	mov    %rsi,%r12
+  801c69:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c6c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c70:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801c77:	00 00 00 
+  801c7a:	ff d0                	call   *%rax
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	78 4c                	js     801ccc <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c80:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c84:	41 8b 3e             	mov    (%r14),%edi
+  801c87:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c8b:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801c92:	00 00 00 
+  801c95:	ff d0                	call   *%rax
+  801c97:	85 c0                	test   %eax,%eax
+  801c99:	78 35                	js     801cd0 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c9b:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c9f:	83 e0 03             	and    $0x3,%eax
+  801ca2:	83 f8 01             	cmp    $0x1,%eax
+  801ca5:	74 2d                	je     801cd4 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801ca7:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cab:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801caf:	48 85 c0             	test   %rax,%rax
+  801cb2:	74 56                	je     801d0a <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801cb4:	4c 89 ea             	mov    %r13,%rdx
+  801cb7:	4c 89 e6             	mov    %r12,%rsi
+  801cba:	4c 89 f7             	mov    %r14,%rdi
+  801cbd:	ff d0                	call   *%rax
+}
+  801cbf:	48 83 c4 10          	add    $0x10,%rsp
+  801cc3:	5b                   	pop    %rbx
+  801cc4:	41 5c                	pop    %r12
+  801cc6:	41 5d                	pop    %r13
+  801cc8:	41 5e                	pop    %r14
+  801cca:	5d                   	pop    %rbp
+  801ccb:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ccc:	48 98                	cltq
+  801cce:	eb ef                	jmp    801cbf <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cd0:	48 98                	cltq
+  801cd2:	eb eb                	jmp    801cbf <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801cd4:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  801cdb:	00 00 00 
+  801cde:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ce4:	89 da                	mov    %ebx,%edx
+  801ce6:	48 bf 09 51 80 00 00 	movabs $0x805109,%rdi
+  801ced:	00 00 00 
+  801cf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cf5:	48 b9 2d 06 80 00 00 	movabs $0x80062d,%rcx
+  801cfc:	00 00 00 
+  801cff:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d01:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d08:	eb b5                	jmp    801cbf <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d0a:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d11:	eb ac                	jmp    801cbf <read+0x6a>
+
+0000000000801d13 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d13:	55                   	push   %rbp
+  801d14:	48 89 e5             	mov    %rsp,%rbp
+  801d17:	41 57                	push   %r15
+  801d19:	41 56                	push   %r14
+  801d1b:	41 55                	push   %r13
+  801d1d:	41 54                	push   %r12
+  801d1f:	53                   	push   %rbx
+  801d20:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d24:	48 85 d2             	test   %rdx,%rdx
+  801d27:	74 54                	je     801d7d <readn+0x6a>
+  801d29:	41 89 fd             	mov    %edi,%r13d
+  801d2c:	49 89 f6             	mov    %rsi,%r14
+  801d2f:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d32:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d37:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d3c:	49 bf 55 1c 80 00 00 	movabs $0x801c55,%r15
+  801d43:	00 00 00 
+  801d46:	4c 89 e2             	mov    %r12,%rdx
+  801d49:	48 29 f2             	sub    %rsi,%rdx
+  801d4c:	4c 01 f6             	add    %r14,%rsi
+  801d4f:	44 89 ef             	mov    %r13d,%edi
+  801d52:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d55:	85 c0                	test   %eax,%eax
+  801d57:	78 20                	js     801d79 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d59:	01 c3                	add    %eax,%ebx
+  801d5b:	85 c0                	test   %eax,%eax
+  801d5d:	74 08                	je     801d67 <readn+0x54>
+  801d5f:	48 63 f3             	movslq %ebx,%rsi
+  801d62:	4c 39 e6             	cmp    %r12,%rsi
+  801d65:	72 df                	jb     801d46 <readn+0x33>
+    }
+    return res;
+  801d67:	48 63 c3             	movslq %ebx,%rax
+}
+  801d6a:	48 83 c4 08          	add    $0x8,%rsp
+  801d6e:	5b                   	pop    %rbx
+  801d6f:	41 5c                	pop    %r12
+  801d71:	41 5d                	pop    %r13
+  801d73:	41 5e                	pop    %r14
+  801d75:	41 5f                	pop    %r15
+  801d77:	5d                   	pop    %rbp
+  801d78:	c3                   	ret
+        if (inc < 0) return inc;
+  801d79:	48 98                	cltq
+  801d7b:	eb ed                	jmp    801d6a <readn+0x57>
+    int inc = 1, res = 0;
+  801d7d:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d82:	eb e3                	jmp    801d67 <readn+0x54>
+
+0000000000801d84 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d84:	55                   	push   %rbp
+  801d85:	48 89 e5             	mov    %rsp,%rbp
+  801d88:	41 56                	push   %r14
+  801d8a:	41 55                	push   %r13
+  801d8c:	41 54                	push   %r12
+  801d8e:	53                   	push   %rbx
+  801d8f:	48 83 ec 10          	sub    $0x10,%rsp
+  801d93:	89 fb                	mov    %edi,%ebx
+  801d95:	49 89 f4             	mov    %rsi,%r12
+  801d98:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d9b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d9f:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801da6:	00 00 00 
+  801da9:	ff d0                	call   *%rax
+  801dab:	85 c0                	test   %eax,%eax
+  801dad:	78 47                	js     801df6 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801daf:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801db3:	41 8b 3e             	mov    (%r14),%edi
+  801db6:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801dba:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801dc1:	00 00 00 
+  801dc4:	ff d0                	call   *%rax
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	78 30                	js     801dfa <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801dca:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801dcf:	74 2d                	je     801dfe <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801dd1:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801dd5:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801dd9:	48 85 c0             	test   %rax,%rax
+  801ddc:	74 56                	je     801e34 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dde:	4c 89 ea             	mov    %r13,%rdx
+  801de1:	4c 89 e6             	mov    %r12,%rsi
+  801de4:	4c 89 f7             	mov    %r14,%rdi
+  801de7:	ff d0                	call   *%rax
+}
+  801de9:	48 83 c4 10          	add    $0x10,%rsp
+  801ded:	5b                   	pop    %rbx
+  801dee:	41 5c                	pop    %r12
+  801df0:	41 5d                	pop    %r13
+  801df2:	41 5e                	pop    %r14
+  801df4:	5d                   	pop    %rbp
+  801df5:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801df6:	48 98                	cltq
+  801df8:	eb ef                	jmp    801de9 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dfa:	48 98                	cltq
+  801dfc:	eb eb                	jmp    801de9 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dfe:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  801e05:	00 00 00 
+  801e08:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e0e:	89 da                	mov    %ebx,%edx
+  801e10:	48 bf 25 51 80 00 00 	movabs $0x805125,%rdi
+  801e17:	00 00 00 
+  801e1a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e1f:	48 b9 2d 06 80 00 00 	movabs $0x80062d,%rcx
+  801e26:	00 00 00 
+  801e29:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e2b:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e32:	eb b5                	jmp    801de9 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e34:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e3b:	eb ac                	jmp    801de9 <write+0x65>
+
+0000000000801e3d <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e3d:	55                   	push   %rbp
+  801e3e:	48 89 e5             	mov    %rsp,%rbp
+  801e41:	41 54                	push   %r12
+  801e43:	53                   	push   %rbx
+  801e44:	48 83 ec 10          	sub    $0x10,%rsp
+  801e48:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e4a:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e4e:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801e55:	00 00 00 
+  801e58:	ff d0                	call   *%rax
+  801e5a:	85 c0                	test   %eax,%eax
+  801e5c:	78 3e                	js     801e9c <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e5e:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e62:	41 8b 3c 24          	mov    (%r12),%edi
+  801e66:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e6a:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801e71:	00 00 00 
+  801e74:	ff d0                	call   *%rax
+  801e76:	85 c0                	test   %eax,%eax
+  801e78:	78 22                	js     801e9c <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e7a:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e7e:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e82:	48 85 c0             	test   %rax,%rax
+  801e85:	74 0b                	je     801e92 <seek+0x55>
+  801e87:	89 de                	mov    %ebx,%esi
+  801e89:	4c 89 e7             	mov    %r12,%rdi
+  801e8c:	ff d0                	call   *%rax
+  801e8e:	85 c0                	test   %eax,%eax
+  801e90:	78 0a                	js     801e9c <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e92:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e97:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e9c:	48 83 c4 10          	add    $0x10,%rsp
+  801ea0:	5b                   	pop    %rbx
+  801ea1:	41 5c                	pop    %r12
+  801ea3:	5d                   	pop    %rbp
+  801ea4:	c3                   	ret
+
+0000000000801ea5 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ea5:	55                   	push   %rbp
+  801ea6:	48 89 e5             	mov    %rsp,%rbp
+  801ea9:	41 55                	push   %r13
+  801eab:	41 54                	push   %r12
+  801ead:	53                   	push   %rbx
+  801eae:	48 83 ec 18          	sub    $0x18,%rsp
+  801eb2:	89 fb                	mov    %edi,%ebx
+  801eb4:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ebb:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801ec2:	00 00 00 
+  801ec5:	ff d0                	call   *%rax
+  801ec7:	85 c0                	test   %eax,%eax
+  801ec9:	78 38                	js     801f03 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ecb:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ecf:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ed3:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ed7:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801ede:	00 00 00 
+  801ee1:	ff d0                	call   *%rax
+  801ee3:	85 c0                	test   %eax,%eax
+  801ee5:	78 1c                	js     801f03 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ee7:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801eec:	74 20                	je     801f0e <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801eee:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ef2:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ef6:	48 85 c0             	test   %rax,%rax
+  801ef9:	74 47                	je     801f42 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801efb:	44 89 e6             	mov    %r12d,%esi
+  801efe:	4c 89 ef             	mov    %r13,%rdi
+  801f01:	ff d0                	call   *%rax
+}
+  801f03:	48 83 c4 18          	add    $0x18,%rsp
+  801f07:	5b                   	pop    %rbx
+  801f08:	41 5c                	pop    %r12
+  801f0a:	41 5d                	pop    %r13
+  801f0c:	5d                   	pop    %rbp
+  801f0d:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f0e:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  801f15:	00 00 00 
+  801f18:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f1e:	89 da                	mov    %ebx,%edx
+  801f20:	48 bf e8 50 80 00 00 	movabs $0x8050e8,%rdi
+  801f27:	00 00 00 
+  801f2a:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f2f:	48 b9 2d 06 80 00 00 	movabs $0x80062d,%rcx
+  801f36:	00 00 00 
+  801f39:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f3b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f40:	eb c1                	jmp    801f03 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f42:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f47:	eb ba                	jmp    801f03 <ftruncate+0x5e>
+
+0000000000801f49 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f49:	55                   	push   %rbp
+  801f4a:	48 89 e5             	mov    %rsp,%rbp
+  801f4d:	41 54                	push   %r12
+  801f4f:	53                   	push   %rbx
+  801f50:	48 83 ec 10          	sub    $0x10,%rsp
+  801f54:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f57:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f5b:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  801f62:	00 00 00 
+  801f65:	ff d0                	call   *%rax
+  801f67:	85 c0                	test   %eax,%eax
+  801f69:	78 4e                	js     801fb9 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f6b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f6f:	41 8b 3c 24          	mov    (%r12),%edi
+  801f73:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f77:	48 b8 bd 19 80 00 00 	movabs $0x8019bd,%rax
+  801f7e:	00 00 00 
+  801f81:	ff d0                	call   *%rax
+  801f83:	85 c0                	test   %eax,%eax
+  801f85:	78 32                	js     801fb9 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f87:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f8b:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f90:	74 30                	je     801fc2 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f92:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f95:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f9c:	00 00 00 
+    stat->st_isdir = 0;
+  801f9f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801fa6:	00 00 00 
+    stat->st_dev = dev;
+  801fa9:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801fb0:	48 89 de             	mov    %rbx,%rsi
+  801fb3:	4c 89 e7             	mov    %r12,%rdi
+  801fb6:	ff 50 28             	call   *0x28(%rax)
+}
+  801fb9:	48 83 c4 10          	add    $0x10,%rsp
+  801fbd:	5b                   	pop    %rbx
+  801fbe:	41 5c                	pop    %r12
+  801fc0:	5d                   	pop    %rbp
+  801fc1:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801fc2:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fc7:	eb f0                	jmp    801fb9 <fstat+0x70>
+
+0000000000801fc9 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801fc9:	55                   	push   %rbp
+  801fca:	48 89 e5             	mov    %rsp,%rbp
+  801fcd:	41 54                	push   %r12
+  801fcf:	53                   	push   %rbx
+  801fd0:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fd3:	be 00 00 00 00       	mov    $0x0,%esi
+  801fd8:	48 b8 37 31 80 00 00 	movabs $0x803137,%rax
+  801fdf:	00 00 00 
+  801fe2:	ff d0                	call   *%rax
+  801fe4:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fe6:	85 c0                	test   %eax,%eax
+  801fe8:	78 25                	js     80200f <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fea:	4c 89 e6             	mov    %r12,%rsi
+  801fed:	89 c7                	mov    %eax,%edi
+  801fef:	48 b8 49 1f 80 00 00 	movabs $0x801f49,%rax
+  801ff6:	00 00 00 
+  801ff9:	ff d0                	call   *%rax
+  801ffb:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801ffe:	89 df                	mov    %ebx,%edi
+  802000:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  802007:	00 00 00 
+  80200a:	ff d0                	call   *%rax
+
+    return res;
+  80200c:	44 89 e3             	mov    %r12d,%ebx
+}
+  80200f:	89 d8                	mov    %ebx,%eax
+  802011:	5b                   	pop    %rbx
+  802012:	41 5c                	pop    %r12
+  802014:	5d                   	pop    %rbp
+  802015:	c3                   	ret
+
+0000000000802016 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802016:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80201d:	00 00 00 
+  802020:	83 38 00             	cmpl   $0x0,(%rax)
+  802023:	74 0a                	je     80202f <fsenv+0x19>
+    return envid;
+}
+  802025:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80202c:	00 00 
+  80202e:	c3                   	ret
+fsenv(void) {
+  80202f:	55                   	push   %rbp
+  802030:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802033:	bf 03 00 00 00       	mov    $0x3,%edi
+  802038:	48 b8 04 4a 80 00 00 	movabs $0x804a04,%rax
+  80203f:	00 00 00 
+  802042:	ff d0                	call   *%rax
+  802044:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  80204b:	00 00 
+}
+  80204d:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802054:	00 00 
+  802056:	5d                   	pop    %rbp
+  802057:	c3                   	ret
+
+0000000000802058 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802058:	55                   	push   %rbp
+  802059:	48 89 e5             	mov    %rsp,%rbp
+  80205c:	41 54                	push   %r12
+  80205e:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80205f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802064:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802069:	48 89 de             	mov    %rbx,%rsi
+  80206c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802071:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  802078:	00 00 00 
+  80207b:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80207d:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802084:	00 00 00 
+  802087:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80208d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802092:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802097:	48 89 de             	mov    %rbx,%rsi
+  80209a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209f:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  8020a6:	00 00 00 
+  8020a9:	ff d0                	call   *%rax
+  8020ab:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  8020ad:	85 c0                	test   %eax,%eax
+  8020af:	0f 88 a2 00 00 00    	js     802157 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  8020b5:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  8020bc:	00 00 00 
+  8020bf:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020c5:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020ca:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  8020cc:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  8020d1:	49 bc 69 42 80 00 00 	movabs $0x804269,%r12
+  8020d8:	00 00 00 
+  8020db:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020de:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020e3:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020e6:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  8020ed:	00 00 00 
+  8020f0:	ff d0                	call   *%rax
+  8020f2:	89 c7                	mov    %eax,%edi
+  8020f4:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8020fa:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8020ff:	48 89 da             	mov    %rbx,%rdx
+  802102:	be 09 00 00 00       	mov    $0x9,%esi
+  802107:	48 b8 ae 49 80 00 00 	movabs $0x8049ae,%rax
+  80210e:	00 00 00 
+  802111:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80211d:	be 00 00 00 00       	mov    $0x0,%esi
+  802122:	bf 00 00 00 00       	mov    $0x0,%edi
+  802127:	48 b8 8a 49 80 00 00 	movabs $0x80498a,%rax
+  80212e:	00 00 00 
+  802131:	ff d0                	call   *%rax
+  802133:	89 c3                	mov    %eax,%ebx
+  802135:	85 c0                	test   %eax,%eax
+  802137:	78 25                	js     80215e <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802139:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  802140:	00 00 00 
+  802143:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802149:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802150:	00 00 
+    return 0;
+  802152:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802157:	89 d8                	mov    %ebx,%eax
+  802159:	5b                   	pop    %rbx
+  80215a:	41 5c                	pop    %r12
+  80215c:	5d                   	pop    %rbp
+  80215d:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80215e:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802163:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802168:	bf 00 00 00 00       	mov    $0x0,%edi
+  80216d:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  802174:	00 00 00 
+  802177:	ff d0                	call   *%rax
+        return res;
+  802179:	eb dc                	jmp    802157 <fschan_setup+0xff>
+
+000000000080217b <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  80217b:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802182:	00 00 00 
+  802185:	80 38 00             	cmpb   $0x0,(%rax)
+  802188:	74 55                	je     8021df <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80218a:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  802191:	00 00 00 
+  802194:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80219a:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80219f:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  8021a6:	00 00 00 
+  8021a9:	3b 0a                	cmp    (%rdx),%ecx
+  8021ab:	75 01                	jne    8021ae <fschan+0x33>
+}
+  8021ad:	c3                   	ret
+fschan(void) {
+  8021ae:	55                   	push   %rbp
+  8021af:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021b2:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  8021b9:	00 00 00 
+  8021bc:	ff d0                	call   *%rax
+  8021be:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  8021c0:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021c5:	85 d2                	test   %edx,%edx
+  8021c7:	78 02                	js     8021cb <fschan+0x50>
+}
+  8021c9:	5d                   	pop    %rbp
+  8021ca:	c3                   	ret
+        fschan_enabled = 0;
+  8021cb:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021d2:	00 00 00 
+  8021d5:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021dd:	eb ea                	jmp    8021c9 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e4:	c3                   	ret
+
+00000000008021e5 <fbuf>:
+fbuf(struct Fd *fd) {
+  8021e5:	55                   	push   %rbp
+  8021e6:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021e9:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8021f0:	00 00 00 
+  8021f3:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8021f5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021fa:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8021fe:	77 12                	ja     802212 <fbuf+0x2d>
+  802200:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802204:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80220b:	00 00 00 
+  80220e:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802212:	48 89 d0             	mov    %rdx,%rax
+  802215:	5d                   	pop    %rbp
+  802216:	c3                   	ret
+
+0000000000802217 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802217:	55                   	push   %rbp
+  802218:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80221b:	48 83 c7 40          	add    $0x40,%rdi
+  80221f:	48 b8 a3 42 80 00 00 	movabs $0x8042a3,%rax
+  802226:	00 00 00 
+  802229:	ff d0                	call   *%rax
+  80222b:	84 c0                	test   %al,%al
+  80222d:	75 02                	jne    802231 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80222f:	5d                   	pop    %rbp
+  802230:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802231:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  802238:	00 00 00 
+  80223b:	ff d0                	call   *%rax
+  80223d:	89 c7                	mov    %eax,%edi
+  80223f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802245:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80224a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80224f:	be 0a 00 00 00       	mov    $0xa,%esi
+  802254:	48 b8 ae 49 80 00 00 	movabs $0x8049ae,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+}
+  802260:	eb cd                	jmp    80222f <fschan_publish+0x18>
+
+0000000000802262 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802262:	55                   	push   %rbp
+  802263:	48 89 e5             	mov    %rsp,%rbp
+  802266:	41 57                	push   %r15
+  802268:	41 56                	push   %r14
+  80226a:	41 55                	push   %r13
+  80226c:	41 54                	push   %r12
+  80226e:	53                   	push   %rbx
+  80226f:	48 83 ec 48          	sub    $0x48,%rsp
+  802273:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802277:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  80227b:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80227e:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802282:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802285:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80228c:	00 00 00 
+  80228f:	8b 02                	mov    (%rdx),%eax
+  802291:	83 c0 01             	add    $0x1,%eax
+  802294:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802299:	0f 44 c1             	cmove  %ecx,%eax
+  80229c:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80229e:	4d 85 c0             	test   %r8,%r8
+  8022a1:	74 2c                	je     8022cf <fschan_rw+0x6d>
+  8022a3:	45 89 ce             	mov    %r9d,%r14d
+  8022a6:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8022ad:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8022b1:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8022b7:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8022be:	00 
+  8022bf:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8022c5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8022ca:	e9 41 01 00 00       	jmp    802410 <fschan_rw+0x1ae>
+  8022cf:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022d3:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022d7:	e9 9c 01 00 00       	jmp    802478 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022dc:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022e0:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022e3:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022e6:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022e9:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022ed:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022f1:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8022f5:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8022f9:	48 89 da             	mov    %rbx,%rdx
+  8022fc:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  802303:	00 00 00 
+  802306:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802308:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80230c:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  802313:	00 00 00 
+  802316:	ff d0                	call   *%rax
+            queued += blk;
+  802318:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80231b:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80231f:	4d 39 fc             	cmp    %r15,%r12
+  802322:	73 6b                	jae    80238f <fschan_rw+0x12d>
+  802324:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802328:	77 65                	ja     80238f <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80232a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80232e:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802332:	48 b8 7e 42 80 00 00 	movabs $0x80427e,%rax
+  802339:	00 00 00 
+  80233c:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80233e:	4c 89 fb             	mov    %r15,%rbx
+  802341:	4c 29 e3             	sub    %r12,%rbx
+  802344:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802349:	48 39 d3             	cmp    %rdx,%rbx
+  80234c:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  802350:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802354:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802358:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80235c:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80235f:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  802361:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802368:	00 00 00 
+  80236b:	8b 09                	mov    (%rcx),%ecx
+  80236d:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  802370:	83 fe 03             	cmp    $0x3,%esi
+  802373:	0f 85 63 ff ff ff    	jne    8022dc <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802379:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80237d:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  802380:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802383:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802386:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  80238a:	e9 79 ff ff ff       	jmp    802308 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80238f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802393:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80239a:	48 89 df             	mov    %rbx,%rdi
+  80239d:	48 b8 41 43 80 00 00 	movabs $0x804341,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8023a9:	48 89 df             	mov    %rbx,%rdi
+  8023ac:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  8023b3:	00 00 00 
+  8023b6:	ff d0                	call   *%rax
+  8023b8:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8023bc:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8023c0:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8023c4:	75 25                	jne    8023eb <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8023c6:	8b 40 04             	mov    0x4(%rax),%eax
+  8023c9:	85 c0                	test   %eax,%eax
+  8023cb:	0f 88 86 00 00 00    	js     802457 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023d1:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023d5:	74 5b                	je     802432 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023d7:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023db:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023df:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023e3:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023e7:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023eb:	48 89 df             	mov    %rbx,%rdi
+  8023ee:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  8023f5:	00 00 00 
+  8023f8:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8023fa:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8023fe:	83 f0 01             	xor    $0x1,%eax
+  802401:	4d 39 fc             	cmp    %r15,%r12
+  802404:	0f 92 c2             	setb   %dl
+  802407:	84 c2                	test   %al,%dl
+  802409:	75 05                	jne    802410 <fschan_rw+0x1ae>
+  80240b:	45 85 ed             	test   %r13d,%r13d
+  80240e:	74 50                	je     802460 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802410:	4d 39 fc             	cmp    %r15,%r12
+  802413:	0f 92 c1             	setb   %cl
+  802416:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80241a:	0f 96 c2             	setbe  %dl
+  80241d:	84 d1                	test   %dl,%cl
+  80241f:	0f 84 6a ff ff ff    	je     80238f <fschan_rw+0x12d>
+  802425:	84 c0                	test   %al,%al
+  802427:	0f 85 fd fe ff ff    	jne    80232a <fschan_rw+0xc8>
+  80242d:	e9 5d ff ff ff       	jmp    80238f <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802432:	48 63 d0             	movslq %eax,%rdx
+  802435:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802439:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80243d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802441:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802445:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802449:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  802450:	00 00 00 
+  802453:	ff d0                	call   *%rax
+  802455:	eb 80                	jmp    8023d7 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802457:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  80245a:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80245e:	eb 8b                	jmp    8023eb <fschan_rw+0x189>
+    return done || !err ? done : err;
+  802460:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802465:	0f 85 68 fe ff ff    	jne    8022d3 <fschan_rw+0x71>
+  80246b:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80246e:	85 c0                	test   %eax,%eax
+  802470:	0f 84 5d fe ff ff    	je     8022d3 <fschan_rw+0x71>
+  802476:	48 98                	cltq
+}
+  802478:	48 83 c4 48          	add    $0x48,%rsp
+  80247c:	5b                   	pop    %rbx
+  80247d:	41 5c                	pop    %r12
+  80247f:	41 5d                	pop    %r13
+  802481:	41 5e                	pop    %r14
+  802483:	41 5f                	pop    %r15
+  802485:	5d                   	pop    %rbp
+  802486:	c3                   	ret
+
+0000000000802487 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802487:	55                   	push   %rbp
+  802488:	48 89 e5             	mov    %rsp,%rbp
+  80248b:	41 56                	push   %r14
+  80248d:	41 55                	push   %r13
+  80248f:	41 54                	push   %r12
+  802491:	53                   	push   %rbx
+  802492:	48 83 ec 10          	sub    $0x10,%rsp
+  802496:	49 89 fe             	mov    %rdi,%r14
+  802499:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80249c:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  8024a0:	48 29 f3             	sub    %rsi,%rbx
+  8024a3:	48 39 d3             	cmp    %rdx,%rbx
+  8024a6:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8024aa:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8024b1:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8024b2:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8024b7:	49 bd 00 41 80 00 00 	movabs $0x804100,%r13
+  8024be:	00 00 00 
+  8024c1:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8024c8:	76 1e                	jbe    8024e8 <mmap_fault+0x61>
+  8024ca:	4c 01 e7             	add    %r12,%rdi
+  8024cd:	41 ff d5             	call   *%r13
+  8024d0:	84 c0                	test   %al,%al
+  8024d2:	75 14                	jne    8024e8 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024d4:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024d8:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024df:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024e3:	48 39 df             	cmp    %rbx,%rdi
+  8024e6:	72 e2                	jb     8024ca <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024e8:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024ef:	00 00 00 
+  8024f2:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8024f9:	00 00 00 
+  8024fc:	4c 89 f0             	mov    %r14,%rax
+  8024ff:	48 29 d0             	sub    %rdx,%rax
+  802502:	48 c1 f8 03          	sar    $0x3,%rax
+  802506:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80250d:	aa aa aa 
+  802510:	48 0f af c2          	imul   %rdx,%rax
+  802514:	48 c1 e0 0c          	shl    $0xc,%rax
+  802518:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80251d:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802521:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802523:	44 89 e0             	mov    %r12d,%eax
+  802526:	41 03 46 10          	add    0x10(%r14),%eax
+  80252a:	41 2b 06             	sub    (%r14),%eax
+  80252d:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  802530:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802534:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802538:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80253c:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80253f:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  802546:	00 00 00 
+  802549:	ff d0                	call   *%rax
+  80254b:	89 c7                	mov    %eax,%edi
+  80254d:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802553:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802558:	48 89 da             	mov    %rbx,%rdx
+  80255b:	be 0f 00 00 00       	mov    $0xf,%esi
+  802560:	48 b8 ae 49 80 00 00 	movabs $0x8049ae,%rax
+  802567:	00 00 00 
+  80256a:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80256c:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802571:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802575:	4c 89 e6             	mov    %r12,%rsi
+  802578:	bf 00 00 00 00       	mov    $0x0,%edi
+  80257d:	48 b8 8a 49 80 00 00 	movabs $0x80498a,%rax
+  802584:	00 00 00 
+  802587:	ff d0                	call   *%rax
+  802589:	48 98                	cltq
+}
+  80258b:	48 83 c4 10          	add    $0x10,%rsp
+  80258f:	5b                   	pop    %rbx
+  802590:	41 5c                	pop    %r12
+  802592:	41 5d                	pop    %r13
+  802594:	41 5e                	pop    %r14
+  802596:	5d                   	pop    %rbp
+  802597:	c3                   	ret
+
+0000000000802598 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802598:	48 8b 37             	mov    (%rdi),%rsi
+  80259b:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8025a2:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8025a9:	00 00 00 
+  8025ac:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025b1:	eb 0f                	jmp    8025c2 <mmap_pgfault+0x2a>
+  8025b3:	c3                   	ret
+  8025b4:	48 83 c1 01          	add    $0x1,%rcx
+  8025b8:	48 83 c2 18          	add    $0x18,%rdx
+  8025bc:	48 83 f9 20          	cmp    $0x20,%rcx
+  8025c0:	74 6e                	je     802630 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025c2:	48 8b 02             	mov    (%rdx),%rax
+  8025c5:	48 83 e8 01          	sub    $0x1,%rax
+  8025c9:	48 39 f0             	cmp    %rsi,%rax
+  8025cc:	73 e6                	jae    8025b4 <mmap_pgfault+0x1c>
+  8025ce:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8025d2:	73 e0                	jae    8025b4 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025d4:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025d8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025dd:	f6 c2 01             	test   $0x1,%dl
+  8025e0:	75 d1                	jne    8025b3 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025e2:	f6 c2 02             	test   $0x2,%dl
+  8025e5:	74 1a                	je     802601 <mmap_pgfault+0x69>
+  8025e7:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025f0:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8025f7:	00 00 00 
+  8025fa:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8025ff:	74 35                	je     802636 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802601:	55                   	push   %rbp
+  802602:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802605:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802609:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802610:	00 00 00 
+  802613:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802617:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80261c:	48 b8 87 24 80 00 00 	movabs $0x802487,%rax
+  802623:	00 00 00 
+  802626:	ff d0                	call   *%rax
+  802628:	48 85 c0             	test   %rax,%rax
+  80262b:	0f 9f c0             	setg   %al
+}
+  80262e:	5d                   	pop    %rbp
+  80262f:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802630:	b8 00 00 00 00       	mov    $0x0,%eax
+  802635:	c3                   	ret
+}
+  802636:	c3                   	ret
+
+0000000000802637 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802637:	55                   	push   %rbp
+  802638:	48 89 e5             	mov    %rsp,%rbp
+  80263b:	41 54                	push   %r12
+  80263d:	53                   	push   %rbx
+  80263e:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802641:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802648:	00 00 00 
+  80264b:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  802650:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802654:	74 15                	je     80266b <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802656:	48 83 c3 01          	add    $0x1,%rbx
+  80265a:	48 83 c0 18          	add    $0x18,%rax
+  80265e:	48 83 fb 20          	cmp    $0x20,%rbx
+  802662:	75 ec                	jne    802650 <mmap_alloc+0x19>
+    return NULL;
+  802664:	b8 00 00 00 00       	mov    $0x0,%eax
+  802669:	eb 52                	jmp    8026bd <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80266b:	4c 89 e7             	mov    %r12,%rdi
+  80266e:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  802675:	00 00 00 
+  802678:	ff d0                	call   *%rax
+  80267a:	41 89 c1             	mov    %eax,%r9d
+  80267d:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802684:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802688:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80268e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802693:	4c 89 e6             	mov    %r12,%rsi
+  802696:	bf 00 00 00 00       	mov    $0x0,%edi
+  80269b:	48 b8 07 15 80 00 00 	movabs $0x801507,%rax
+  8026a2:	00 00 00 
+  8026a5:	ff d0                	call   *%rax
+  8026a7:	85 c0                	test   %eax,%eax
+  8026a9:	78 17                	js     8026c2 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8026ab:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8026af:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026b6:	00 00 00 
+  8026b9:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8026bd:	5b                   	pop    %rbx
+  8026be:	41 5c                	pop    %r12
+  8026c0:	5d                   	pop    %rbp
+  8026c1:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026c7:	eb f4                	jmp    8026bd <mmap_alloc+0x86>
+
+00000000008026c9 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8026c9:	55                   	push   %rbp
+  8026ca:	48 89 e5             	mov    %rsp,%rbp
+  8026cd:	41 56                	push   %r14
+  8026cf:	41 55                	push   %r13
+  8026d1:	41 54                	push   %r12
+  8026d3:	53                   	push   %rbx
+  8026d4:	48 83 ec 10          	sub    $0x10,%rsp
+  8026d8:	41 89 fc             	mov    %edi,%r12d
+  8026db:	49 89 f5             	mov    %rsi,%r13
+  8026de:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026e1:	48 89 f0             	mov    %rsi,%rax
+  8026e4:	48 09 d0             	or     %rdx,%rax
+  8026e7:	75 0d                	jne    8026f6 <fsipc+0x2d>
+  8026e9:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026ec:	83 f8 04             	cmp    $0x4,%eax
+  8026ef:	76 7d                	jbe    80276e <fsipc+0xa5>
+  8026f1:	83 ff 0d             	cmp    $0xd,%edi
+  8026f4:	74 78                	je     80276e <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8026f6:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  8026fd:	00 00 00 
+  802700:	ff d0                	call   *%rax
+  802702:	89 c7                	mov    %eax,%edi
+  802704:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80270b:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802712:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802719:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80271f:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802726:	00 00 00 
+  802729:	44 89 e6             	mov    %r12d,%esi
+  80272c:	48 b8 ae 49 80 00 00 	movabs $0x8049ae,%rax
+  802733:	00 00 00 
+  802736:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802738:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80273f:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  802740:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802745:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802749:	4c 89 ee             	mov    %r13,%rsi
+  80274c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802751:	48 b8 8a 49 80 00 00 	movabs $0x80498a,%rax
+  802758:	00 00 00 
+  80275b:	ff d0                	call   *%rax
+  80275d:	89 c3                	mov    %eax,%ebx
+}
+  80275f:	89 d8                	mov    %ebx,%eax
+  802761:	48 83 c4 10          	add    $0x10,%rsp
+  802765:	5b                   	pop    %rbx
+  802766:	41 5c                	pop    %r12
+  802768:	41 5d                	pop    %r13
+  80276a:	41 5e                	pop    %r14
+  80276c:	5d                   	pop    %rbp
+  80276d:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80276e:	48 b8 7b 21 80 00 00 	movabs $0x80217b,%rax
+  802775:	00 00 00 
+  802778:	ff d0                	call   *%rax
+  80277a:	49 89 c6             	mov    %rax,%r14
+  80277d:	48 85 c0             	test   %rax,%rax
+  802780:	0f 84 70 ff ff ff    	je     8026f6 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802786:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80278a:	48 b8 7e 42 80 00 00 	movabs $0x80427e,%rax
+  802791:	00 00 00 
+  802794:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802796:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802799:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  8027a0:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8027a4:	ba 10 00 00 00       	mov    $0x10,%edx
+  8027a9:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8027b0:	00 00 00 
+  8027b3:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  8027ba:	00 00 00 
+  8027bd:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8027bf:	4c 89 f7             	mov    %r14,%rdi
+  8027c2:	48 b8 17 22 80 00 00 	movabs $0x802217,%rax
+  8027c9:	00 00 00 
+  8027cc:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8027ce:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027d5:	4c 89 f7             	mov    %r14,%rdi
+  8027d8:	48 b8 41 43 80 00 00 	movabs $0x804341,%rax
+  8027df:	00 00 00 
+  8027e2:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027e4:	4c 89 f7             	mov    %r14,%rdi
+  8027e7:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  8027ee:	00 00 00 
+  8027f1:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027f3:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8027f6:	41 83 fc 05          	cmp    $0x5,%r12d
+  8027fa:	75 04                	jne    802800 <fsipc+0x137>
+  8027fc:	85 db                	test   %ebx,%ebx
+  8027fe:	79 14                	jns    802814 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802800:	4c 89 f7             	mov    %r14,%rdi
+  802803:	48 b8 f6 42 80 00 00 	movabs $0x8042f6,%rax
+  80280a:	00 00 00 
+  80280d:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80280f:	e9 4b ff ff ff       	jmp    80275f <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802814:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802818:	ba 88 00 00 00       	mov    $0x88,%edx
+  80281d:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802824:	00 00 00 
+  802827:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  80282e:	00 00 00 
+  802831:	ff d0                	call   *%rax
+  802833:	eb cb                	jmp    802800 <fsipc+0x137>
+
+0000000000802835 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802835:	55                   	push   %rbp
+  802836:	48 89 e5             	mov    %rsp,%rbp
+  802839:	41 57                	push   %r15
+  80283b:	41 56                	push   %r14
+  80283d:	41 55                	push   %r13
+  80283f:	41 54                	push   %r12
+  802841:	53                   	push   %rbx
+  802842:	48 83 ec 18          	sub    $0x18,%rsp
+  802846:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  80284a:	49 89 f6             	mov    %rsi,%r14
+  80284d:	49 89 d4             	mov    %rdx,%r12
+  802850:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802853:	48 b8 7b 21 80 00 00 	movabs $0x80217b,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80285f:	48 85 c0             	test   %rax,%rax
+  802862:	0f 85 96 00 00 00    	jne    8028fe <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802868:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80286f:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802870:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802877:	00 00 00 
+    while (n) {
+  80287a:	4d 85 e4             	test   %r12,%r12
+  80287d:	74 79                	je     8028f8 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80287f:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802884:	49 39 dc             	cmp    %rbx,%r12
+  802887:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80288b:	48 89 da             	mov    %rbx,%rdx
+  80288e:	4c 89 f6             	mov    %r14,%rsi
+  802891:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802898:	00 00 00 
+  80289b:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  8028a2:	00 00 00 
+  8028a5:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028a7:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8028ab:	8b 40 0c             	mov    0xc(%rax),%eax
+  8028ae:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8028b1:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8028b4:	44 01 e8             	add    %r13d,%eax
+  8028b7:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8028bb:	41 0f 44 c5          	cmove  %r13d,%eax
+  8028bf:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8028c3:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8028c7:	48 89 da             	mov    %rbx,%rdx
+  8028ca:	be 00 00 00 00       	mov    $0x0,%esi
+  8028cf:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028d4:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8028db:	00 00 00 
+  8028de:	ff d0                	call   *%rax
+        if (res < 0)
+  8028e0:	85 c0                	test   %eax,%eax
+  8028e2:	78 4a                	js     80292e <devfile_write_direct+0xf9>
+        buf += res;
+  8028e4:	48 98                	cltq
+  8028e6:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028e9:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028ed:	49 29 c4             	sub    %rax,%r12
+  8028f0:	75 8d                	jne    80287f <devfile_write_direct+0x4a>
+    return write;
+  8028f2:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028f6:	eb 27                	jmp    80291f <devfile_write_direct+0xea>
+    size_t write = 0;
+  8028f8:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8028fc:	eb f4                	jmp    8028f2 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028fe:	45 89 e9             	mov    %r13d,%r9d
+  802901:	4d 89 e0             	mov    %r12,%r8
+  802904:	4c 89 f1             	mov    %r14,%rcx
+  802907:	ba 04 00 00 00       	mov    $0x4,%edx
+  80290c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802910:	48 89 c7             	mov    %rax,%rdi
+  802913:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  80291a:	00 00 00 
+  80291d:	ff d0                	call   *%rax
+}
+  80291f:	48 83 c4 18          	add    $0x18,%rsp
+  802923:	5b                   	pop    %rbx
+  802924:	41 5c                	pop    %r12
+  802926:	41 5d                	pop    %r13
+  802928:	41 5e                	pop    %r14
+  80292a:	41 5f                	pop    %r15
+  80292c:	5d                   	pop    %rbp
+  80292d:	c3                   	ret
+            return res;
+  80292e:	48 98                	cltq
+  802930:	eb ed                	jmp    80291f <devfile_write_direct+0xea>
+
+0000000000802932 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802932:	55                   	push   %rbp
+  802933:	48 89 e5             	mov    %rsp,%rbp
+  802936:	41 54                	push   %r12
+  802938:	53                   	push   %rbx
+  802939:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80293c:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802948:	48 85 c0             	test   %rax,%rax
+  80294b:	74 71                	je     8029be <fbuf_flush+0x8c>
+  80294d:	48 89 c3             	mov    %rax,%rbx
+  802950:	b8 00 00 00 00       	mov    $0x0,%eax
+  802955:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802959:	75 05                	jne    802960 <fbuf_flush+0x2e>
+}
+  80295b:	5b                   	pop    %rbx
+  80295c:	41 5c                	pop    %r12
+  80295e:	5d                   	pop    %rbp
+  80295f:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  802960:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802963:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802967:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80296e:	00 00 00 
+  802971:	48 89 de             	mov    %rbx,%rsi
+  802974:	48 29 c6             	sub    %rax,%rsi
+  802977:	48 c1 fe 03          	sar    $0x3,%rsi
+  80297b:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802982:	aa aa aa 
+  802985:	48 0f af f0          	imul   %rax,%rsi
+  802989:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80298d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802992:	48 01 c6             	add    %rax,%rsi
+  802995:	4c 89 e7             	mov    %r12,%rdi
+  802998:	48 b8 35 28 80 00 00 	movabs $0x802835,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8029a4:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8029a8:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8029af:	00 
+    return res < 0 ? res : 0;
+  8029b0:	48 85 c0             	test   %rax,%rax
+  8029b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b8:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8029bc:	eb 9d                	jmp    80295b <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8029be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c3:	eb 96                	jmp    80295b <fbuf_flush+0x29>
+
+00000000008029c5 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8029c5:	55                   	push   %rbp
+  8029c6:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8029c9:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  8029d0:	00 00 00 
+  8029d3:	ff d0                	call   *%rax
+}
+  8029d5:	5d                   	pop    %rbp
+  8029d6:	c3                   	ret
+
+00000000008029d7 <devfile_write>:
+    if (!fd || !buf)
+  8029d7:	48 85 ff             	test   %rdi,%rdi
+  8029da:	0f 84 d3 01 00 00    	je     802bb3 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029e0:	55                   	push   %rbp
+  8029e1:	48 89 e5             	mov    %rsp,%rbp
+  8029e4:	41 57                	push   %r15
+  8029e6:	41 56                	push   %r14
+  8029e8:	41 55                	push   %r13
+  8029ea:	41 54                	push   %r12
+  8029ec:	53                   	push   %rbx
+  8029ed:	48 83 ec 08          	sub    $0x8,%rsp
+  8029f1:	49 89 fc             	mov    %rdi,%r12
+  8029f4:	49 89 f6             	mov    %rsi,%r14
+  8029f7:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8029fa:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8029ff:	48 85 f6             	test   %rsi,%rsi
+  802a02:	0f 84 9c 01 00 00    	je     802ba4 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a08:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802a0f:	00 00 00 
+  802a12:	ff d0                	call   *%rax
+  802a14:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a17:	48 85 c0             	test   %rax,%rax
+  802a1a:	0f 84 a2 00 00 00    	je     802ac2 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a20:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a25:	4c 89 e7             	mov    %r12,%rdi
+  802a28:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802a2f:	00 00 00 
+  802a32:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a34:	83 f8 02             	cmp    $0x2,%eax
+  802a37:	0f 8f 85 00 00 00    	jg     802ac2 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a3d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a44:	00 00 00 
+  802a47:	4d 89 ef             	mov    %r13,%r15
+  802a4a:	49 29 c7             	sub    %rax,%r15
+  802a4d:	49 c1 ff 03          	sar    $0x3,%r15
+  802a51:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a58:	aa aa aa 
+  802a5b:	4c 0f af f8          	imul   %rax,%r15
+  802a5f:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a63:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a68:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a6b:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a70:	0f 84 d7 00 00 00    	je     802b4d <devfile_write+0x176>
+  802a76:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a7a:	89 c2                	mov    %eax,%edx
+  802a7c:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a80:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a85:	75 0f                	jne    802a96 <devfile_write+0xbf>
+  802a87:	48 01 d8             	add    %rbx,%rax
+  802a8a:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a90:	0f 86 92 00 00 00    	jbe    802b28 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a96:	4c 89 e7             	mov    %r12,%rdi
+  802a99:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  802aa0:	00 00 00 
+  802aa3:	ff d0                	call   *%rax
+  802aa5:	85 c0                	test   %eax,%eax
+  802aa7:	78 52                	js     802afb <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802aa9:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ab0:	77 7f                	ja     802b31 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802ab2:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ab7:	0f 85 c2 00 00 00    	jne    802b7f <devfile_write+0x1a8>
+  802abd:	e9 94 00 00 00       	jmp    802b56 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802ac2:	4c 89 e7             	mov    %r12,%rdi
+  802ac5:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  802acc:	00 00 00 
+  802acf:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ad1:	85 c0                	test   %eax,%eax
+  802ad3:	79 07                	jns    802adc <devfile_write+0x105>
+  802ad5:	48 98                	cltq
+  802ad7:	e9 c8 00 00 00       	jmp    802ba4 <devfile_write+0x1cd>
+  802adc:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ae1:	48 89 da             	mov    %rbx,%rdx
+  802ae4:	4c 89 f6             	mov    %r14,%rsi
+  802ae7:	4c 89 e7             	mov    %r12,%rdi
+  802aea:	48 b8 35 28 80 00 00 	movabs $0x802835,%rax
+  802af1:	00 00 00 
+  802af4:	ff d0                	call   *%rax
+  802af6:	e9 a9 00 00 00       	jmp    802ba4 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802afb:	48 98                	cltq
+  802afd:	e9 a2 00 00 00       	jmp    802ba4 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b02:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b07:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b0c:	4c 89 fe             	mov    %r15,%rsi
+  802b0f:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b14:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  802b1b:	00 00 00 
+  802b1e:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b20:	85 c0                	test   %eax,%eax
+  802b22:	79 45                	jns    802b69 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b24:	48 98                	cltq
+  802b26:	eb 7c                	jmp    802ba4 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b28:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b2f:	76 4e                	jbe    802b7f <devfile_write+0x1a8>
+  802b31:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b36:	48 89 da             	mov    %rbx,%rdx
+  802b39:	4c 89 f6             	mov    %r14,%rsi
+  802b3c:	4c 89 e7             	mov    %r12,%rdi
+  802b3f:	48 b8 35 28 80 00 00 	movabs $0x802835,%rax
+  802b46:	00 00 00 
+  802b49:	ff d0                	call   *%rax
+  802b4b:	eb 57                	jmp    802ba4 <devfile_write+0x1cd>
+  802b4d:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b54:	77 db                	ja     802b31 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b56:	4c 89 ff             	mov    %r15,%rdi
+  802b59:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	84 c0                	test   %al,%al
+  802b67:	74 99                	je     802b02 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b69:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b6e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b73:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b77:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b7e:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b7f:	4c 89 ff             	mov    %r15,%rdi
+  802b82:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b86:	48 89 da             	mov    %rbx,%rdx
+  802b89:	4c 89 f6             	mov    %r14,%rsi
+  802b8c:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  802b93:	00 00 00 
+  802b96:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b98:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b9c:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802ba1:	48 89 d8             	mov    %rbx,%rax
+}
+  802ba4:	48 83 c4 08          	add    $0x8,%rsp
+  802ba8:	5b                   	pop    %rbx
+  802ba9:	41 5c                	pop    %r12
+  802bab:	41 5d                	pop    %r13
+  802bad:	41 5e                	pop    %r14
+  802baf:	41 5f                	pop    %r15
+  802bb1:	5d                   	pop    %rbp
+  802bb2:	c3                   	ret
+        return E_INVAL;
+  802bb3:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802bb8:	c3                   	ret
+
+0000000000802bb9 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802bb9:	55                   	push   %rbp
+  802bba:	48 89 e5             	mov    %rsp,%rbp
+  802bbd:	41 54                	push   %r12
+  802bbf:	53                   	push   %rbx
+  802bc0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802bc3:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  802bca:	00 00 00 
+  802bcd:	ff d0                	call   *%rax
+  802bcf:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802bd2:	48 89 df             	mov    %rbx,%rdi
+  802bd5:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802bdc:	00 00 00 
+  802bdf:	ff d0                	call   *%rax
+  802be1:	48 85 c0             	test   %rax,%rax
+  802be4:	74 17                	je     802bfd <devfile_flush+0x44>
+  802be6:	48 89 df             	mov    %rbx,%rdi
+  802be9:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802bf0:	00 00 00 
+  802bf3:	ff d0                	call   *%rax
+  802bf5:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802bfc:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bfd:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c00:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c07:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c09:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c0e:	be 00 00 00 00       	mov    $0x0,%esi
+  802c13:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c18:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  802c1f:	00 00 00 
+  802c22:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c24:	45 85 e4             	test   %r12d,%r12d
+  802c27:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c2b:	5b                   	pop    %rbx
+  802c2c:	41 5c                	pop    %r12
+  802c2e:	5d                   	pop    %rbp
+  802c2f:	c3                   	ret
+
+0000000000802c30 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c30:	55                   	push   %rbp
+  802c31:	48 89 e5             	mov    %rsp,%rbp
+  802c34:	41 57                	push   %r15
+  802c36:	41 56                	push   %r14
+  802c38:	41 55                	push   %r13
+  802c3a:	41 54                	push   %r12
+  802c3c:	53                   	push   %rbx
+  802c3d:	48 83 ec 38          	sub    $0x38,%rsp
+  802c41:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c45:	49 89 f7             	mov    %rsi,%r15
+  802c48:	48 89 d3             	mov    %rdx,%rbx
+  802c4b:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c4e:	48 b8 7b 21 80 00 00 	movabs $0x80217b,%rax
+  802c55:	00 00 00 
+  802c58:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c5a:	48 85 c0             	test   %rax,%rax
+  802c5d:	75 20                	jne    802c7f <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c5f:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c64:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c6b:	00 
+    while (n) {
+  802c6c:	48 85 db             	test   %rbx,%rbx
+  802c6f:	0f 85 df 00 00 00    	jne    802d54 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c75:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c79:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c7d:	eb 21                	jmp    802ca0 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c7f:	45 89 f1             	mov    %r14d,%r9d
+  802c82:	49 89 d8             	mov    %rbx,%r8
+  802c85:	4c 89 f9             	mov    %r15,%rcx
+  802c88:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c8d:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c91:	48 89 c7             	mov    %rax,%rdi
+  802c94:	48 b8 62 22 80 00 00 	movabs $0x802262,%rax
+  802c9b:	00 00 00 
+  802c9e:	ff d0                	call   *%rax
+}
+  802ca0:	48 83 c4 38          	add    $0x38,%rsp
+  802ca4:	5b                   	pop    %rbx
+  802ca5:	41 5c                	pop    %r12
+  802ca7:	41 5d                	pop    %r13
+  802ca9:	41 5e                	pop    %r14
+  802cab:	41 5f                	pop    %r15
+  802cad:	5d                   	pop    %rbp
+  802cae:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802caf:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cb3:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802cb9:	75 1e                	jne    802cd9 <devfile_read_direct+0xa9>
+  802cbb:	e9 e2 00 00 00       	jmp    802da2 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802cc0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cc4:	eb da                	jmp    802ca0 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802cc6:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802cca:	0f 85 d0 01 00 00    	jne    802ea0 <devfile_read_direct+0x270>
+            map = 0;
+  802cd0:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802cd4:	eb 03                	jmp    802cd9 <devfile_read_direct+0xa9>
+  802cd6:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802cd9:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cde:	48 39 d3             	cmp    %rdx,%rbx
+  802ce1:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ce5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ce9:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cec:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802cf3:	00 00 00 
+  802cf6:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802cf8:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802cfc:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d00:	be 00 00 00 00       	mov    $0x0,%esi
+  802d05:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d0a:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  802d11:	00 00 00 
+  802d14:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d16:	85 c0                	test   %eax,%eax
+  802d18:	0f 8e 63 01 00 00    	jle    802e81 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d1e:	4c 63 e0             	movslq %eax,%r12
+  802d21:	4c 89 e2             	mov    %r12,%rdx
+  802d24:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d2b:	00 00 00 
+  802d2e:	4c 89 ff             	mov    %r15,%rdi
+  802d31:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  802d38:	00 00 00 
+  802d3b:	ff d0                	call   *%rax
+        buf += res;
+  802d3d:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d40:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d43:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d47:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d4b:	48 85 db             	test   %rbx,%rbx
+  802d4e:	0f 84 25 ff ff ff    	je     802c79 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d54:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d57:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d5b:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d5f:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d63:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d6a:	0f 97 c2             	seta   %dl
+  802d6d:	20 c2                	and    %al,%dl
+  802d6f:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d72:	0f 84 5e ff ff ff    	je     802cd6 <devfile_read_direct+0xa6>
+  802d78:	4c 89 fa             	mov    %r15,%rdx
+  802d7b:	4d 89 fd             	mov    %r15,%r13
+  802d7e:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d85:	0f 85 4e ff ff ff    	jne    802cd9 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d8b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d8f:	0f 84 1a ff ff ff    	je     802caf <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d95:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d9c:	0f 85 37 ff ff ff    	jne    802cd9 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802da2:	48 89 d8             	mov    %rbx,%rax
+  802da5:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802dab:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802db0:	48 39 c8             	cmp    %rcx,%rax
+  802db3:	48 0f 47 c1          	cmova  %rcx,%rax
+  802db7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802dbb:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802dbf:	49 89 d4             	mov    %rdx,%r12
+  802dc2:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802dc6:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  802dcd:	00 00 00 
+  802dd0:	ff d0                	call   *%rax
+  802dd2:	a8 40                	test   $0x40,%al
+  802dd4:	0f 85 b9 00 00 00    	jne    802e93 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802dda:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802de1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802de5:	49 39 c5             	cmp    %rax,%r13
+  802de8:	72 d8                	jb     802dc2 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802dea:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802dee:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802df5:	00 00 00 
+  802df8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dfc:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802dff:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e01:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e05:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e09:	48 b8 16 20 80 00 00 	movabs $0x802016,%rax
+  802e10:	00 00 00 
+  802e13:	ff d0                	call   *%rax
+  802e15:	89 c7                	mov    %eax,%edi
+  802e17:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e1d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e22:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e29:	00 00 00 
+  802e2c:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e31:	48 b8 ae 49 80 00 00 	movabs $0x8049ae,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e3d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e42:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e46:	4c 89 fe             	mov    %r15,%rsi
+  802e49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e4e:	48 b8 8a 49 80 00 00 	movabs $0x80498a,%rax
+  802e55:	00 00 00 
+  802e58:	ff d0                	call   *%rax
+  802e5a:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e5d:	48 85 d2             	test   %rdx,%rdx
+  802e60:	0f 84 5a fe ff ff    	je     802cc0 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e66:	0f 8e 5a fe ff ff    	jle    802cc6 <devfile_read_direct+0x96>
+                buf += res;
+  802e6c:	48 98                	cltq
+  802e6e:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e71:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e74:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e78:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e7c:	e9 ca fe ff ff       	jmp    802d4b <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e81:	41 89 c5             	mov    %eax,%r13d
+  802e84:	48 98                	cltq
+  802e86:	45 85 ed             	test   %r13d,%r13d
+  802e89:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e8e:	e9 0d fe ff ff       	jmp    802ca0 <devfile_read_direct+0x70>
+            map = 0;
+  802e93:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e97:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e9b:	e9 39 fe ff ff       	jmp    802cd9 <devfile_read_direct+0xa9>
+  802ea0:	48 89 d0             	mov    %rdx,%rax
+  802ea3:	e9 f8 fd ff ff       	jmp    802ca0 <devfile_read_direct+0x70>
+
+0000000000802ea8 <devfile_read>:
+    if (!fd || !buf)
+  802ea8:	48 85 ff             	test   %rdi,%rdi
+  802eab:	0f 84 21 02 00 00    	je     8030d2 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802eb1:	55                   	push   %rbp
+  802eb2:	48 89 e5             	mov    %rsp,%rbp
+  802eb5:	41 57                	push   %r15
+  802eb7:	41 56                	push   %r14
+  802eb9:	41 55                	push   %r13
+  802ebb:	41 54                	push   %r12
+  802ebd:	53                   	push   %rbx
+  802ebe:	48 83 ec 28          	sub    $0x28,%rsp
+  802ec2:	48 89 fb             	mov    %rdi,%rbx
+  802ec5:	49 89 f4             	mov    %rsi,%r12
+  802ec8:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802ecb:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802ed0:	48 85 f6             	test   %rsi,%rsi
+  802ed3:	74 4b                	je     802f20 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ed5:	48 b8 e5 21 80 00 00 	movabs $0x8021e5,%rax
+  802edc:	00 00 00 
+  802edf:	ff d0                	call   *%rax
+  802ee1:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ee4:	48 85 c0             	test   %rax,%rax
+  802ee7:	74 22                	je     802f0b <devfile_read+0x63>
+  802ee9:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ef0:	77 19                	ja     802f0b <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ef2:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ef7:	48 89 df             	mov    %rbx,%rdi
+  802efa:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  802f01:	00 00 00 
+  802f04:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f06:	83 f8 02             	cmp    $0x2,%eax
+  802f09:	7e 40                	jle    802f4b <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f0b:	48 89 df             	mov    %rbx,%rdi
+  802f0e:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  802f15:	00 00 00 
+  802f18:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f1a:	85 c0                	test   %eax,%eax
+  802f1c:	79 11                	jns    802f2f <devfile_read+0x87>
+  802f1e:	48 98                	cltq
+}
+  802f20:	48 83 c4 28          	add    $0x28,%rsp
+  802f24:	5b                   	pop    %rbx
+  802f25:	41 5c                	pop    %r12
+  802f27:	41 5d                	pop    %r13
+  802f29:	41 5e                	pop    %r14
+  802f2b:	41 5f                	pop    %r15
+  802f2d:	5d                   	pop    %rbp
+  802f2e:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f2f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f34:	4c 89 ea             	mov    %r13,%rdx
+  802f37:	4c 89 e6             	mov    %r12,%rsi
+  802f3a:	48 89 df             	mov    %rbx,%rdi
+  802f3d:	48 b8 30 2c 80 00 00 	movabs $0x802c30,%rax
+  802f44:	00 00 00 
+  802f47:	ff d0                	call   *%rax
+  802f49:	eb d5                	jmp    802f20 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f4b:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f4f:	48 89 df             	mov    %rbx,%rdi
+  802f52:	48 b8 32 29 80 00 00 	movabs $0x802932,%rax
+  802f59:	00 00 00 
+  802f5c:	ff d0                	call   *%rax
+  802f5e:	85 c0                	test   %eax,%eax
+  802f60:	0f 88 33 01 00 00    	js     803099 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f66:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f6d:	00 00 00 
+  802f70:	4c 89 f0             	mov    %r14,%rax
+  802f73:	48 29 d0             	sub    %rdx,%rax
+  802f76:	48 c1 f8 03          	sar    $0x3,%rax
+  802f7a:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f81:	aa aa aa 
+  802f84:	48 0f af c2          	imul   %rdx,%rax
+  802f88:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f8c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f90:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f93:	41 39 06             	cmp    %eax,(%r14)
+  802f96:	75 0d                	jne    802fa5 <devfile_read+0xfd>
+  802f98:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f9b:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f9f:	0f 84 fb 00 00 00    	je     8030a0 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802fa5:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802faa:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802fae:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802fb1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802fb5:	48 89 c7             	mov    %rax,%rdi
+  802fb8:	48 b8 00 41 80 00 00 	movabs $0x804100,%rax
+  802fbf:	00 00 00 
+  802fc2:	ff d0                	call   *%rax
+  802fc4:	84 c0                	test   %al,%al
+  802fc6:	75 27                	jne    802fef <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802fc8:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802fcd:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fd2:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fdb:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  802fe2:	00 00 00 
+  802fe5:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802fe7:	85 c0                	test   %eax,%eax
+  802fe9:	0f 88 dc 00 00 00    	js     8030cb <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802fef:	44 89 f8             	mov    %r15d,%eax
+  802ff2:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802ff7:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802ff9:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803000:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803001:	8b 43 10             	mov    0x10(%rbx),%eax
+  803004:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803008:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80300b:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803010:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803014:	48 89 df             	mov    %rbx,%rdi
+  803017:	48 b8 30 2c 80 00 00 	movabs $0x802c30,%rax
+  80301e:	00 00 00 
+  803021:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803023:	48 85 c0             	test   %rax,%rax
+  803026:	0f 88 f4 fe ff ff    	js     802f20 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80302c:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80302f:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803032:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803035:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803039:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80303d:	48 63 d1             	movslq %ecx,%rdx
+  803040:	48 01 d0             	add    %rdx,%rax
+  803043:	4d 63 ff             	movslq %r15d,%r15
+  803046:	4c 29 f8             	sub    %r15,%rax
+  803049:	ba 00 00 00 00       	mov    $0x0,%edx
+  80304e:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803052:	48 85 c0             	test   %rax,%rax
+  803055:	0f 8e c5 fe ff ff    	jle    802f20 <devfile_read+0x78>
+    n = MIN(n, res);
+  80305b:	4c 39 e8             	cmp    %r13,%rax
+  80305e:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803062:	8b 73 04             	mov    0x4(%rbx),%esi
+  803065:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803069:	48 63 f6             	movslq %esi,%rsi
+  80306c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803071:	48 01 c6             	add    %rax,%rsi
+  803074:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803078:	48 01 c6             	add    %rax,%rsi
+  80307b:	4c 89 ea             	mov    %r13,%rdx
+  80307e:	4c 89 e7             	mov    %r12,%rdi
+  803081:	48 b8 b3 11 80 00 00 	movabs $0x8011b3,%rax
+  803088:	00 00 00 
+  80308b:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80308d:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803091:	4c 89 e8             	mov    %r13,%rax
+  803094:	e9 87 fe ff ff       	jmp    802f20 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803099:	48 98                	cltq
+  80309b:	e9 80 fe ff ff       	jmp    802f20 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030a0:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  8030a4:	41 39 d7             	cmp    %edx,%r15d
+  8030a7:	0f 8c f8 fe ff ff    	jl     802fa5 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  8030ad:	49 8b 46 10          	mov    0x10(%r14),%rax
+  8030b1:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  8030b4:	41 39 cf             	cmp    %ecx,%r15d
+  8030b7:	0f 8d e8 fe ff ff    	jge    802fa5 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  8030bd:	4d 63 ff             	movslq %r15d,%r15
+  8030c0:	4c 29 f8             	sub    %r15,%rax
+  8030c3:	48 63 d2             	movslq %edx,%rdx
+  8030c6:	48 01 d0             	add    %rdx,%rax
+  8030c9:	eb 87                	jmp    803052 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8030cb:	48 98                	cltq
+  8030cd:	e9 4e fe ff ff       	jmp    802f20 <devfile_read+0x78>
+        return E_INVAL;
+  8030d2:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030d7:	c3                   	ret
+
+00000000008030d8 <fs_channel>:
+fs_channel(bool enable) {
+  8030d8:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030da:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030e1:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030e8:	40 84 ff             	test   %dil,%dil
+  8030eb:	74 47                	je     803134 <fs_channel+0x5c>
+  8030ed:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  8030f4:	00 00 00 
+  8030f7:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8030fd:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803104:	00 00 00 
+  803107:	3b 08                	cmp    (%rax),%ecx
+  803109:	74 29                	je     803134 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80310b:	55                   	push   %rbp
+  80310c:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80310f:	48 b8 58 20 80 00 00 	movabs $0x802058,%rax
+  803116:	00 00 00 
+  803119:	ff d0                	call   *%rax
+  80311b:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80311d:	85 c0                	test   %eax,%eax
+  80311f:	78 04                	js     803125 <fs_channel+0x4d>
+}
+  803121:	89 d0                	mov    %edx,%eax
+  803123:	5d                   	pop    %rbp
+  803124:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803125:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80312c:	00 00 00 
+  80312f:	c6 00 00             	movb   $0x0,(%rax)
+  803132:	eb ed                	jmp    803121 <fs_channel+0x49>
+}
+  803134:	89 d0                	mov    %edx,%eax
+  803136:	c3                   	ret
+
+0000000000803137 <open>:
+open(const char *path, int mode) {
+  803137:	55                   	push   %rbp
+  803138:	48 89 e5             	mov    %rsp,%rbp
+  80313b:	41 55                	push   %r13
+  80313d:	41 54                	push   %r12
+  80313f:	53                   	push   %rbx
+  803140:	48 83 ec 18          	sub    $0x18,%rsp
+  803144:	49 89 fc             	mov    %rdi,%r12
+  803147:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  80314a:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  803151:	00 00 00 
+  803154:	ff d0                	call   *%rax
+  803156:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80315c:	0f 87 8f 00 00 00    	ja     8031f1 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803162:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803166:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  80316d:	00 00 00 
+  803170:	ff d0                	call   *%rax
+  803172:	89 c3                	mov    %eax,%ebx
+  803174:	85 c0                	test   %eax,%eax
+  803176:	78 55                	js     8031cd <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803178:	4c 89 e6             	mov    %r12,%rsi
+  80317b:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803182:	00 00 00 
+  803185:	48 89 df             	mov    %rbx,%rdi
+  803188:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  80318f:	00 00 00 
+  803192:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803194:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80319b:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031a0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8031a4:	bf 01 00 00 00       	mov    $0x1,%edi
+  8031a9:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8031b0:	00 00 00 
+  8031b3:	ff d0                	call   *%rax
+  8031b5:	89 c3                	mov    %eax,%ebx
+  8031b7:	85 c0                	test   %eax,%eax
+  8031b9:	78 1f                	js     8031da <open+0xa3>
+    return fd2num(fd);
+  8031bb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031bf:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8031c6:	00 00 00 
+  8031c9:	ff d0                	call   *%rax
+  8031cb:	89 c3                	mov    %eax,%ebx
+}
+  8031cd:	89 d8                	mov    %ebx,%eax
+  8031cf:	48 83 c4 18          	add    $0x18,%rsp
+  8031d3:	5b                   	pop    %rbx
+  8031d4:	41 5c                	pop    %r12
+  8031d6:	41 5d                	pop    %r13
+  8031d8:	5d                   	pop    %rbp
+  8031d9:	c3                   	ret
+        fd_close(fd, 0);
+  8031da:	be 00 00 00 00       	mov    $0x0,%esi
+  8031df:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031e3:	48 b8 2d 1a 80 00 00 	movabs $0x801a2d,%rax
+  8031ea:	00 00 00 
+  8031ed:	ff d0                	call   *%rax
+        return res;
+  8031ef:	eb dc                	jmp    8031cd <open+0x96>
+        return -E_BAD_PATH;
+  8031f1:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031f6:	eb d5                	jmp    8031cd <open+0x96>
+
+00000000008031f8 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8031f8:	55                   	push   %rbp
+  8031f9:	48 89 e5             	mov    %rsp,%rbp
+  8031fc:	41 56                	push   %r14
+  8031fe:	41 55                	push   %r13
+  803200:	41 54                	push   %r12
+  803202:	53                   	push   %rbx
+  803203:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803207:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80320e:	00 00 00 
+  803211:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803216:	49 bd 72 19 80 00 00 	movabs $0x801972,%r13
+  80321d:	00 00 00 
+  803220:	49 be 32 29 80 00 00 	movabs $0x802932,%r14
+  803227:	00 00 00 
+  80322a:	eb 0c                	jmp    803238 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80322c:	83 c3 01             	add    $0x1,%ebx
+  80322f:	49 83 c4 18          	add    $0x18,%r12
+  803233:	83 fb 20             	cmp    $0x20,%ebx
+  803236:	74 1d                	je     803255 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803238:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80323d:	74 ed                	je     80322c <file_flush_buffers+0x34>
+  80323f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803243:	89 df                	mov    %ebx,%edi
+  803245:	41 ff d5             	call   *%r13
+  803248:	85 c0                	test   %eax,%eax
+  80324a:	78 e0                	js     80322c <file_flush_buffers+0x34>
+  80324c:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803250:	41 ff d6             	call   *%r14
+  803253:	eb d7                	jmp    80322c <file_flush_buffers+0x34>
+}
+  803255:	48 83 c4 10          	add    $0x10,%rsp
+  803259:	5b                   	pop    %rbx
+  80325a:	41 5c                	pop    %r12
+  80325c:	41 5d                	pop    %r13
+  80325e:	41 5e                	pop    %r14
+  803260:	5d                   	pop    %rbp
+  803261:	c3                   	ret
+
+0000000000803262 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803262:	55                   	push   %rbp
+  803263:	48 89 e5             	mov    %rsp,%rbp
+  803266:	41 54                	push   %r12
+  803268:	53                   	push   %rbx
+  803269:	49 89 fc             	mov    %rdi,%r12
+  80326c:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80326e:	48 b8 f8 31 80 00 00 	movabs $0x8031f8,%rax
+  803275:	00 00 00 
+  803278:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  80327a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803281:	00 00 00 
+  803284:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803289:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80328b:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80328e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803293:	be 00 00 00 00       	mov    $0x0,%esi
+  803298:	bf 02 00 00 00       	mov    $0x2,%edi
+  80329d:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8032a4:	00 00 00 
+  8032a7:	ff d0                	call   *%rax
+}
+  8032a9:	5b                   	pop    %rbx
+  8032aa:	41 5c                	pop    %r12
+  8032ac:	5d                   	pop    %rbp
+  8032ad:	c3                   	ret
+
+00000000008032ae <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8032ae:	55                   	push   %rbp
+  8032af:	48 89 e5             	mov    %rsp,%rbp
+  8032b2:	41 54                	push   %r12
+  8032b4:	53                   	push   %rbx
+  8032b5:	49 89 fc             	mov    %rdi,%r12
+  8032b8:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8032bb:	48 b8 f8 31 80 00 00 	movabs $0x8031f8,%rax
+  8032c2:	00 00 00 
+  8032c5:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8032c7:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8032cc:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032d3:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032da:	be 00 00 00 00       	mov    $0x0,%esi
+  8032df:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032e4:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8032eb:	00 00 00 
+  8032ee:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032f0:	85 c0                	test   %eax,%eax
+  8032f2:	78 3d                	js     803331 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032f4:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8032fb:	00 00 00 
+  8032fe:	4c 89 e6             	mov    %r12,%rsi
+  803301:	48 89 df             	mov    %rbx,%rdi
+  803304:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  80330b:	00 00 00 
+  80330e:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803310:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803317:	00 
+  803318:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80331e:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803325:	00 
+  803326:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80332c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803331:	5b                   	pop    %rbx
+  803332:	41 5c                	pop    %r12
+  803334:	5d                   	pop    %rbp
+  803335:	c3                   	ret
+
+0000000000803336 <remove>:
+remove(const char *path) {
+  803336:	55                   	push   %rbp
+  803337:	48 89 e5             	mov    %rsp,%rbp
+  80333a:	53                   	push   %rbx
+  80333b:	48 83 ec 08          	sub    $0x8,%rsp
+  80333f:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803342:	48 b8 14 0f 80 00 00 	movabs $0x800f14,%rax
+  803349:	00 00 00 
+  80334c:	ff d0                	call   *%rax
+  80334e:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803354:	77 3a                	ja     803390 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803356:	48 89 de             	mov    %rbx,%rsi
+  803359:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  803360:	00 00 00 
+  803363:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  80336a:	00 00 00 
+  80336d:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80336f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803374:	be 00 00 00 00       	mov    $0x0,%esi
+  803379:	bf 07 00 00 00       	mov    $0x7,%edi
+  80337e:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  803385:	00 00 00 
+  803388:	ff d0                	call   *%rax
+}
+  80338a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80338e:	c9                   	leave
+  80338f:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803390:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803395:	eb f3                	jmp    80338a <remove+0x54>
+
+0000000000803397 <sync>:
+sync(void) {
+  803397:	55                   	push   %rbp
+  803398:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80339b:	48 b8 f8 31 80 00 00 	movabs $0x8031f8,%rax
+  8033a2:	00 00 00 
+  8033a5:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8033a7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033ac:	be 00 00 00 00       	mov    $0x0,%esi
+  8033b1:	bf 08 00 00 00       	mov    $0x8,%edi
+  8033b6:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8033bd:	00 00 00 
+  8033c0:	ff d0                	call   *%rax
+}
+  8033c2:	5d                   	pop    %rbp
+  8033c3:	c3                   	ret
+
+00000000008033c4 <fsync>:
+fsync(int fdnum) {
+  8033c4:	55                   	push   %rbp
+  8033c5:	48 89 e5             	mov    %rsp,%rbp
+  8033c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8033cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8033d0:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  8033d7:	00 00 00 
+  8033da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033dc:	85 c0                	test   %eax,%eax
+  8033de:	78 4b                	js     80342b <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033e0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033e4:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033eb:	00 00 00 
+  8033ee:	8b 00                	mov    (%rax),%eax
+  8033f0:	39 02                	cmp    %eax,(%rdx)
+  8033f2:	75 39                	jne    80342d <fsync+0x69>
+    file_flush_buffers();
+  8033f4:	48 b8 f8 31 80 00 00 	movabs $0x8031f8,%rax
+  8033fb:	00 00 00 
+  8033fe:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803400:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803404:	8b 40 0c             	mov    0xc(%rax),%eax
+  803407:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80340e:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803410:	ba 00 00 00 00       	mov    $0x0,%edx
+  803415:	be 00 00 00 00       	mov    $0x0,%esi
+  80341a:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80341f:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  803426:	00 00 00 
+  803429:	ff d0                	call   *%rax
+}
+  80342b:	c9                   	leave
+  80342c:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80342d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803432:	eb f7                	jmp    80342b <fsync+0x67>
+
+0000000000803434 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803434:	55                   	push   %rbp
+  803435:	48 89 e5             	mov    %rsp,%rbp
+  803438:	53                   	push   %rbx
+  803439:	48 83 ec 08          	sub    $0x8,%rsp
+  80343d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  803440:	ba 00 00 00 00       	mov    $0x0,%edx
+  803445:	be 00 00 00 00       	mov    $0x0,%esi
+  80344a:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80344f:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  803456:	00 00 00 
+  803459:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80345b:	85 c0                	test   %eax,%eax
+  80345d:	78 2d                	js     80348c <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80345f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803466:	00 00 00 
+  803469:	48 8b 10             	mov    (%rax),%rdx
+  80346c:	48 89 13             	mov    %rdx,(%rbx)
+  80346f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803473:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803477:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80347b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80347f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803483:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803487:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80348c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803490:	c9                   	leave
+  803491:	c3                   	ret
+
+0000000000803492 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803492:	55                   	push   %rbp
+  803493:	48 89 e5             	mov    %rsp,%rbp
+  803496:	53                   	push   %rbx
+  803497:	48 83 ec 08          	sub    $0x8,%rsp
+  80349b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80349e:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034a3:	be 00 00 00 00       	mov    $0x0,%esi
+  8034a8:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8034ad:	48 b8 c9 26 80 00 00 	movabs $0x8026c9,%rax
+  8034b4:	00 00 00 
+  8034b7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	78 3d                	js     8034fa <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8034bd:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034c4:	00 00 00 
+  8034c7:	48 8b 10             	mov    (%rax),%rdx
+  8034ca:	48 89 13             	mov    %rdx,(%rbx)
+  8034cd:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034d1:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034d5:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034d9:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034dd:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034e1:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034e5:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034e9:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034ed:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034f1:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8034f5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034fa:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034fe:	c9                   	leave
+  8034ff:	c3                   	ret
+
+0000000000803500 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803500:	55                   	push   %rbp
+  803501:	48 89 e5             	mov    %rsp,%rbp
+  803504:	41 57                	push   %r15
+  803506:	41 56                	push   %r14
+  803508:	41 55                	push   %r13
+  80350a:	41 54                	push   %r12
+  80350c:	53                   	push   %rbx
+  80350d:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803511:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803518:	00 
+  803519:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803520:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803526:	0f 85 43 01 00 00    	jne    80366f <munmap+0x16f>
+  80352c:	49 89 ff             	mov    %rdi,%r15
+  80352f:	4c 39 f7             	cmp    %r14,%rdi
+  803532:	0f 87 37 01 00 00    	ja     80366f <munmap+0x16f>
+  803538:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80353f:	00 00 00 
+  803542:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803548:	eb 2c                	jmp    803576 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  80354a:	4c 39 f8             	cmp    %r15,%rax
+  80354d:	0f 83 85 00 00 00    	jae    8035d8 <munmap+0xd8>
+            m->mm_end = start;
+  803553:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803558:	48 83 c3 18          	add    $0x18,%rbx
+  80355c:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803563:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80356a:	00 00 00 
+  80356d:	48 39 c3             	cmp    %rax,%rbx
+  803570:	0f 84 d0 00 00 00    	je     803646 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803576:	49 89 dc             	mov    %rbx,%r12
+  803579:	48 8b 03             	mov    (%rbx),%rax
+  80357c:	4c 39 f0             	cmp    %r14,%rax
+  80357f:	73 d7                	jae    803558 <munmap+0x58>
+  803581:	48 85 c0             	test   %rax,%rax
+  803584:	74 d2                	je     803558 <munmap+0x58>
+  803586:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80358a:	49 39 d7             	cmp    %rdx,%r15
+  80358d:	73 c9                	jae    803558 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80358f:	49 39 d6             	cmp    %rdx,%r14
+  803592:	73 b6                	jae    80354a <munmap+0x4a>
+  803594:	49 39 c7             	cmp    %rax,%r15
+  803597:	76 b1                	jbe    80354a <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803599:	4c 89 ef             	mov    %r13,%rdi
+  80359c:	48 b8 37 26 80 00 00 	movabs $0x802637,%rax
+  8035a3:	00 00 00 
+  8035a6:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8035a8:	48 85 c0             	test   %rax,%rax
+  8035ab:	0f 84 c5 00 00 00    	je     803676 <munmap+0x176>
+            *tail = *m;
+  8035b1:	48 8b 13             	mov    (%rbx),%rdx
+  8035b4:	48 89 10             	mov    %rdx,(%rax)
+  8035b7:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035bb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8035bf:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8035c3:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8035c7:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8035ca:	44 89 f2             	mov    %r14d,%edx
+  8035cd:	2b 13                	sub    (%rbx),%edx
+  8035cf:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8035d2:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035d6:	eb 80                	jmp    803558 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035d8:	49 39 d6             	cmp    %rdx,%r14
+  8035db:	73 18                	jae    8035f5 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035dd:	44 89 f2             	mov    %r14d,%edx
+  8035e0:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035e5:	29 c2                	sub    %eax,%edx
+  8035e7:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035ec:	4d 89 34 24          	mov    %r14,(%r12)
+  8035f0:	e9 63 ff ff ff       	jmp    803558 <munmap+0x58>
+    m->mm_start = 0;
+  8035f5:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8035fc:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8035fd:	4c 89 e6             	mov    %r12,%rsi
+  803600:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803607:	00 00 00 
+  80360a:	48 29 c6             	sub    %rax,%rsi
+  80360d:	48 c1 fe 03          	sar    $0x3,%rsi
+  803611:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803618:	aa aa aa 
+  80361b:	48 0f af f0          	imul   %rax,%rsi
+  80361f:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803623:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803628:	48 01 c6             	add    %rax,%rsi
+  80362b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803630:	bf 00 00 00 00       	mov    $0x0,%edi
+  803635:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  80363c:	00 00 00 
+  80363f:	ff d0                	call   *%rax
+}
+  803641:	e9 12 ff ff ff       	jmp    803558 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803646:	4c 89 f2             	mov    %r14,%rdx
+  803649:	4c 29 fa             	sub    %r15,%rdx
+  80364c:	4c 89 fe             	mov    %r15,%rsi
+  80364f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803654:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  80365b:	00 00 00 
+  80365e:	ff d0                	call   *%rax
+}
+  803660:	48 83 c4 08          	add    $0x8,%rsp
+  803664:	5b                   	pop    %rbx
+  803665:	41 5c                	pop    %r12
+  803667:	41 5d                	pop    %r13
+  803669:	41 5e                	pop    %r14
+  80366b:	41 5f                	pop    %r15
+  80366d:	5d                   	pop    %rbp
+  80366e:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80366f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803674:	eb ea                	jmp    803660 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803676:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  80367b:	eb e3                	jmp    803660 <munmap+0x160>
+
+000000000080367d <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80367d:	55                   	push   %rbp
+  80367e:	48 89 e5             	mov    %rsp,%rbp
+  803681:	41 57                	push   %r15
+  803683:	41 56                	push   %r14
+  803685:	41 55                	push   %r13
+  803687:	41 54                	push   %r12
+  803689:	53                   	push   %rbx
+  80368a:	48 83 ec 28          	sub    $0x28,%rsp
+  80368e:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803692:	49 89 f5             	mov    %rsi,%r13
+  803695:	41 89 d6             	mov    %edx,%r14d
+  803698:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80369b:	41 89 cc             	mov    %ecx,%r12d
+  80369e:	44 89 c7             	mov    %r8d,%edi
+  8036a1:	44 89 cb             	mov    %r9d,%ebx
+  8036a4:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8036a8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8036ac:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  8036b3:	00 00 00 
+  8036b6:	ff d0                	call   *%rax
+  8036b8:	41 89 c7             	mov    %eax,%r15d
+  8036bb:	85 c0                	test   %eax,%eax
+  8036bd:	0f 88 ae 01 00 00    	js     803871 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8036c3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036c7:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8036ce:	00 00 00 
+  8036d1:	8b 32                	mov    (%rdx),%esi
+  8036d3:	39 30                	cmp    %esi,(%rax)
+  8036d5:	0f 85 7a 02 00 00    	jne    803955 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036db:	8b 40 08             	mov    0x8(%rax),%eax
+  8036de:	83 e0 03             	and    $0x3,%eax
+  8036e1:	83 f8 01             	cmp    $0x1,%eax
+  8036e4:	0f 84 76 02 00 00    	je     803960 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036ea:	4d 85 ed             	test   %r13,%r13
+  8036ed:	0f 84 78 02 00 00    	je     80396b <mmap+0x2ee>
+  8036f3:	85 db                	test   %ebx,%ebx
+  8036f5:	0f 88 70 02 00 00    	js     80396b <mmap+0x2ee>
+  8036fb:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803701:	41 89 df             	mov    %ebx,%r15d
+  803704:	0f 85 6c 02 00 00    	jne    803976 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80370a:	44 89 f0             	mov    %r14d,%eax
+  80370d:	83 e0 fd             	and    $0xfffffffd,%eax
+  803710:	83 f8 04             	cmp    $0x4,%eax
+  803713:	0f 85 68 02 00 00    	jne    803981 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803719:	44 89 e1             	mov    %r12d,%ecx
+  80371c:	83 e1 01             	and    $0x1,%ecx
+  80371f:	0f 95 c2             	setne  %dl
+  803722:	44 89 e0             	mov    %r12d,%eax
+  803725:	d1 e8                	shr    %eax
+  803727:	83 f0 01             	xor    $0x1,%eax
+  80372a:	83 e0 01             	and    $0x1,%eax
+  80372d:	38 c2                	cmp    %al,%dl
+  80372f:	0f 85 57 02 00 00    	jne    80398c <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803735:	85 c9                	test   %ecx,%ecx
+  803737:	74 0a                	je     803743 <mmap+0xc6>
+  803739:	41 f6 c6 02          	test   $0x2,%r14b
+  80373d:	0f 85 54 02 00 00    	jne    803997 <mmap+0x31a>
+    file_flush_buffers();
+  803743:	48 b8 f8 31 80 00 00 	movabs $0x8031f8,%rax
+  80374a:	00 00 00 
+  80374d:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80374f:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803756:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80375d:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  803761:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803764:	41 f6 c4 04          	test   $0x4,%r12b
+  803768:	0f 84 15 01 00 00    	je     803883 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80376e:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803771:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803777:	0f 85 25 02 00 00    	jne    8039a2 <mmap+0x325>
+  80377d:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803781:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803788:	00 00 00 
+  80378b:	48 39 c2             	cmp    %rax,%rdx
+  80378e:	0f 82 19 02 00 00    	jb     8039ad <mmap+0x330>
+  803794:	48 39 c7             	cmp    %rax,%rdi
+  803797:	0f 87 10 02 00 00    	ja     8039ad <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80379d:	4c 89 ee             	mov    %r13,%rsi
+  8037a0:	48 b8 00 35 80 00 00 	movabs $0x803500,%rax
+  8037a7:	00 00 00 
+  8037aa:	ff d0                	call   *%rax
+  8037ac:	85 c0                	test   %eax,%eax
+  8037ae:	0f 88 04 02 00 00    	js     8039b8 <mmap+0x33b>
+    if (!handler) {
+  8037b4:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037bb:	00 00 00 
+  8037be:	80 38 00             	cmpb   $0x0,(%rax)
+  8037c1:	75 2b                	jne    8037ee <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037c3:	48 bf 98 25 80 00 00 	movabs $0x802598,%rdi
+  8037ca:	00 00 00 
+  8037cd:	48 b8 59 46 80 00 00 	movabs $0x804659,%rax
+  8037d4:	00 00 00 
+  8037d7:	ff d0                	call   *%rax
+  8037d9:	85 c0                	test   %eax,%eax
+  8037db:	0f 88 ea 01 00 00    	js     8039cb <mmap+0x34e>
+        handler = 1;
+  8037e1:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037e8:	00 00 00 
+  8037eb:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037ee:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037f2:	48 b8 37 26 80 00 00 	movabs $0x802637,%rax
+  8037f9:	00 00 00 
+  8037fc:	ff d0                	call   *%rax
+  8037fe:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803801:	48 85 c0             	test   %rax,%rax
+  803804:	0f 84 c9 01 00 00    	je     8039d3 <mmap+0x356>
+    m->mm_start = va;
+  80380a:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80380d:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803811:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803815:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803818:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80381c:	44 89 e0             	mov    %r12d,%eax
+  80381f:	c1 e0 06             	shl    $0x6,%eax
+  803822:	25 80 00 00 00       	and    $0x80,%eax
+  803827:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80382a:	09 f0                	or     %esi,%eax
+  80382c:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  803830:	41 f6 c4 08          	test   $0x8,%r12b
+  803834:	74 31                	je     803867 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803836:	48 39 d3             	cmp    %rdx,%rbx
+  803839:	73 2c                	jae    803867 <mmap+0x1ea>
+  80383b:	ba 00 00 04 00       	mov    $0x40000,%edx
+  803840:	48 89 de             	mov    %rbx,%rsi
+  803843:	4c 89 f7             	mov    %r14,%rdi
+  803846:	48 b8 87 24 80 00 00 	movabs $0x802487,%rax
+  80384d:	00 00 00 
+  803850:	ff d0                	call   *%rax
+  803852:	49 89 c4             	mov    %rax,%r12
+  803855:	48 85 c0             	test   %rax,%rax
+  803858:	0f 8e d7 00 00 00    	jle    803935 <mmap+0x2b8>
+            va += n;
+  80385e:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803861:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803865:	72 d4                	jb     80383b <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803867:	49 8b 06             	mov    (%r14),%rax
+  80386a:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80386e:	48 89 06             	mov    %rax,(%rsi)
+}
+  803871:	44 89 f8             	mov    %r15d,%eax
+  803874:	48 83 c4 28          	add    $0x28,%rsp
+  803878:	5b                   	pop    %rbx
+  803879:	41 5c                	pop    %r12
+  80387b:	41 5d                	pop    %r13
+  80387d:	41 5e                	pop    %r14
+  80387f:	41 5f                	pop    %r15
+  803881:	5d                   	pop    %rbp
+  803882:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803883:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  80388a:	00 00 00 
+  80388d:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803890:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803897:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80389a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80389f:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8038a6:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038a9:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8038b0:	00 00 00 
+  8038b3:	48 39 d7             	cmp    %rdx,%rdi
+  8038b6:	73 1c                	jae    8038d4 <mmap+0x257>
+        return -E_NO_MEM;
+  8038b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038be:	eb b1                	jmp    803871 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038c0:	48 83 c0 01          	add    $0x1,%rax
+  8038c4:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8038c8:	77 3f                	ja     803909 <mmap+0x28c>
+  8038ca:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8038cf:	48 39 d7             	cmp    %rdx,%rdi
+  8038d2:	72 2a                	jb     8038fe <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038d4:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038d8:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038dc:	48 39 d1             	cmp    %rdx,%rcx
+  8038df:	73 df                	jae    8038c0 <mmap+0x243>
+  8038e1:	48 85 c9             	test   %rcx,%rcx
+  8038e4:	74 da                	je     8038c0 <mmap+0x243>
+  8038e6:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038ea:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038ef:	48 39 d3             	cmp    %rdx,%rbx
+  8038f2:	73 cc                	jae    8038c0 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038f4:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038f7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038fc:	eb cc                	jmp    8038ca <mmap+0x24d>
+        return -E_NO_MEM;
+  8038fe:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803904:	e9 68 ff ff ff       	jmp    803871 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803909:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80390e:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803915:	00 00 00 
+  803918:	48 39 c2             	cmp    %rax,%rdx
+  80391b:	0f 82 9f 00 00 00    	jb     8039c0 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803921:	48 85 db             	test   %rbx,%rbx
+  803924:	0f 85 8a fe ff ff    	jne    8037b4 <mmap+0x137>
+        return -E_NO_MEM;
+  80392a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803930:	e9 3c ff ff ff       	jmp    803871 <mmap+0x1f4>
+        if (n < 0) {
+  803935:	0f 89 2c ff ff ff    	jns    803867 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  80393b:	49 8b 3e             	mov    (%r14),%rdi
+  80393e:	4c 89 ee             	mov    %r13,%rsi
+  803941:	48 b8 00 35 80 00 00 	movabs $0x803500,%rax
+  803948:	00 00 00 
+  80394b:	ff d0                	call   *%rax
+            return n;
+  80394d:	45 89 e7             	mov    %r12d,%r15d
+  803950:	e9 1c ff ff ff       	jmp    803871 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803955:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80395b:	e9 11 ff ff ff       	jmp    803871 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803960:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803966:	e9 06 ff ff ff       	jmp    803871 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80396b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803971:	e9 fb fe ff ff       	jmp    803871 <mmap+0x1f4>
+  803976:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80397c:	e9 f0 fe ff ff       	jmp    803871 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803981:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803987:	e9 e5 fe ff ff       	jmp    803871 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80398c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803992:	e9 da fe ff ff       	jmp    803871 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803997:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80399d:	e9 cf fe ff ff       	jmp    803871 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8039a2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039a8:	e9 c4 fe ff ff       	jmp    803871 <mmap+0x1f4>
+  8039ad:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039b3:	e9 b9 fe ff ff       	jmp    803871 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8039b8:	41 89 c7             	mov    %eax,%r15d
+  8039bb:	e9 b1 fe ff ff       	jmp    803871 <mmap+0x1f4>
+        return -E_NO_MEM;
+  8039c0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039c6:	e9 a6 fe ff ff       	jmp    803871 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8039cb:	41 89 c7             	mov    %eax,%r15d
+  8039ce:	e9 9e fe ff ff       	jmp    803871 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039d3:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039d9:	e9 93 fe ff ff       	jmp    803871 <mmap+0x1f4>
+
+00000000008039de <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039de:	55                   	push   %rbp
+  8039df:	48 89 e5             	mov    %rsp,%rbp
+  8039e2:	41 54                	push   %r12
+  8039e4:	53                   	push   %rbx
+  8039e5:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039e8:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  8039ef:	00 00 00 
+  8039f2:	ff d0                	call   *%rax
+  8039f4:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039f7:	48 be 80 51 80 00 00 	movabs $0x805180,%rsi
+  8039fe:	00 00 00 
+  803a01:	48 89 df             	mov    %rbx,%rdi
+  803a04:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  803a0b:	00 00 00 
+  803a0e:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a10:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a15:	41 2b 04 24          	sub    (%r12),%eax
+  803a19:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a1f:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a26:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a29:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a30:	00 00 00 
+  803a33:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a3f:	5b                   	pop    %rbx
+  803a40:	41 5c                	pop    %r12
+  803a42:	5d                   	pop    %rbp
+  803a43:	c3                   	ret
+
+0000000000803a44 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a44:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a47:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a4d:	8b 17                	mov    (%rdi),%edx
+  803a4f:	85 d2                	test   %edx,%edx
+  803a51:	75 01                	jne    803a54 <pipe_wakeup+0x10>
+  803a53:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a54:	55                   	push   %rbp
+  803a55:	48 89 e5             	mov    %rsp,%rbp
+  803a58:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a5b:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a61:	be 00 04 00 00       	mov    $0x400,%esi
+  803a66:	48 b8 3d 18 80 00 00 	movabs $0x80183d,%rax
+  803a6d:	00 00 00 
+  803a70:	ff d0                	call   *%rax
+}
+  803a72:	5d                   	pop    %rbp
+  803a73:	c3                   	ret
+
+0000000000803a74 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a74:	55                   	push   %rbp
+  803a75:	48 89 e5             	mov    %rsp,%rbp
+  803a78:	41 55                	push   %r13
+  803a7a:	41 54                	push   %r12
+  803a7c:	53                   	push   %rbx
+  803a7d:	48 83 ec 08          	sub    $0x8,%rsp
+  803a81:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a84:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803a8b:	00 00 00 
+  803a8e:	ff d0                	call   *%rax
+  803a90:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a93:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a98:	4c 89 e6             	mov    %r12,%rsi
+  803a9b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aa0:	49 bc 57 15 80 00 00 	movabs $0x801557,%r12
+  803aa7:	00 00 00 
+  803aaa:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803aad:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803ab1:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ab5:	49 bd 44 3a 80 00 00 	movabs $0x803a44,%r13
+  803abc:	00 00 00 
+  803abf:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803ac2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ac6:	48 89 de             	mov    %rbx,%rsi
+  803ac9:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803acc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ad1:	48 89 de             	mov    %rbx,%rsi
+  803ad4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ad9:	41 ff d4             	call   *%r12
+  803adc:	48 83 c4 08          	add    $0x8,%rsp
+  803ae0:	5b                   	pop    %rbx
+  803ae1:	41 5c                	pop    %r12
+  803ae3:	41 5d                	pop    %r13
+  803ae5:	5d                   	pop    %rbp
+  803ae6:	c3                   	ret
+
+0000000000803ae7 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ae7:	55                   	push   %rbp
+  803ae8:	48 89 e5             	mov    %rsp,%rbp
+  803aeb:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803aee:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803af3:	be 00 10 00 00       	mov    $0x1000,%esi
+  803af8:	48 b8 9a 14 80 00 00 	movabs $0x80149a,%rax
+  803aff:	00 00 00 
+  803b02:	ff d0                	call   *%rax
+  803b04:	85 c0                	test   %eax,%eax
+  803b06:	0f 94 c0             	sete   %al
+  803b09:	0f b6 c0             	movzbl %al,%eax
+}
+  803b0c:	5d                   	pop    %rbp
+  803b0d:	c3                   	ret
+
+0000000000803b0e <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b0e:	55                   	push   %rbp
+  803b0f:	48 89 e5             	mov    %rsp,%rbp
+  803b12:	41 57                	push   %r15
+  803b14:	41 56                	push   %r14
+  803b16:	41 55                	push   %r13
+  803b18:	41 54                	push   %r12
+  803b1a:	53                   	push   %rbx
+  803b1b:	48 83 ec 38          	sub    $0x38,%rsp
+  803b1f:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b23:	49 89 f4             	mov    %rsi,%r12
+  803b26:	49 89 d7             	mov    %rdx,%r15
+  803b29:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b2d:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803b34:	00 00 00 
+  803b37:	ff d0                	call   *%rax
+  803b39:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b3c:	4d 85 ff             	test   %r15,%r15
+  803b3f:	0f 84 f1 00 00 00    	je     803c36 <devpipe_write+0x128>
+  803b45:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b49:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b4d:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b51:	49 bd e7 3a 80 00 00 	movabs $0x803ae7,%r13
+  803b58:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b5b:	49 bf 44 3a 80 00 00 	movabs $0x803a44,%r15
+  803b62:	00 00 00 
+  803b65:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b69:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b6d:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b71:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b74:	48 63 ce             	movslq %esi,%rcx
+  803b77:	48 63 03             	movslq (%rbx),%rax
+  803b7a:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b80:	48 39 c1             	cmp    %rax,%rcx
+  803b83:	72 64                	jb     803be9 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b85:	48 89 de             	mov    %rbx,%rsi
+  803b88:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b8c:	41 ff d5             	call   *%r13
+  803b8f:	85 c0                	test   %eax,%eax
+  803b91:	0f 85 b9 00 00 00    	jne    803c50 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b97:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b9b:	4c 89 f7             	mov    %r14,%rdi
+  803b9e:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803ba1:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ba4:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803bab:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803bb2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803bb8:	8b 03                	mov    (%rbx),%eax
+  803bba:	41 39 c4             	cmp    %eax,%r12d
+  803bbd:	75 b2                	jne    803b71 <devpipe_write+0x63>
+  803bbf:	48 89 de             	mov    %rbx,%rsi
+  803bc2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bc6:	41 ff d5             	call   *%r13
+  803bc9:	85 c0                	test   %eax,%eax
+  803bcb:	75 a0                	jne    803b6d <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803bcd:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803bd2:	44 89 e6             	mov    %r12d,%esi
+  803bd5:	48 89 df             	mov    %rbx,%rdi
+  803bd8:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  803bdf:	00 00 00 
+  803be2:	ff d0                	call   *%rax
+  803be4:	e9 7c ff ff ff       	jmp    803b65 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803be9:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bed:	41 0f b6 38          	movzbl (%r8),%edi
+  803bf1:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bf8:	80 80 80 
+  803bfb:	48 89 c8             	mov    %rcx,%rax
+  803bfe:	48 f7 e2             	mul    %rdx
+  803c01:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c05:	48 89 d0             	mov    %rdx,%rax
+  803c08:	48 c1 e0 08          	shl    $0x8,%rax
+  803c0c:	48 29 d0             	sub    %rdx,%rax
+  803c0f:	48 c1 e0 04          	shl    $0x4,%rax
+  803c13:	48 29 c1             	sub    %rax,%rcx
+  803c16:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c1b:	83 c6 01             	add    $0x1,%esi
+  803c1e:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c21:	49 83 c0 01          	add    $0x1,%r8
+  803c25:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c29:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c2d:	49 39 c0             	cmp    %rax,%r8
+  803c30:	0f 85 2f ff ff ff    	jne    803b65 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c36:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c3a:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c3e:	48 b8 44 3a 80 00 00 	movabs $0x803a44,%rax
+  803c45:	00 00 00 
+  803c48:	ff d0                	call   *%rax
+    return n;
+  803c4a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c4e:	eb 05                	jmp    803c55 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c50:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c55:	48 83 c4 38          	add    $0x38,%rsp
+  803c59:	5b                   	pop    %rbx
+  803c5a:	41 5c                	pop    %r12
+  803c5c:	41 5d                	pop    %r13
+  803c5e:	41 5e                	pop    %r14
+  803c60:	41 5f                	pop    %r15
+  803c62:	5d                   	pop    %rbp
+  803c63:	c3                   	ret
+
+0000000000803c64 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c64:	55                   	push   %rbp
+  803c65:	48 89 e5             	mov    %rsp,%rbp
+  803c68:	41 57                	push   %r15
+  803c6a:	41 56                	push   %r14
+  803c6c:	41 55                	push   %r13
+  803c6e:	41 54                	push   %r12
+  803c70:	53                   	push   %rbx
+  803c71:	48 83 ec 28          	sub    $0x28,%rsp
+  803c75:	49 89 fd             	mov    %rdi,%r13
+  803c78:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c7c:	49 89 d4             	mov    %rdx,%r12
+  803c7f:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c83:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803c8a:	00 00 00 
+  803c8d:	ff d0                	call   *%rax
+  803c8f:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c92:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c98:	49 bf e7 3a 80 00 00 	movabs $0x803ae7,%r15
+  803c9f:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803ca2:	4d 85 e4             	test   %r12,%r12
+  803ca5:	0f 84 d5 00 00 00    	je     803d80 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cab:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803caf:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803cb3:	8b 03                	mov    (%rbx),%eax
+  803cb5:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803cb8:	75 7a                	jne    803d34 <devpipe_read+0xd0>
+            if (i > 0) {
+  803cba:	4d 85 f6             	test   %r14,%r14
+  803cbd:	75 50                	jne    803d0f <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cbf:	48 89 de             	mov    %rbx,%rsi
+  803cc2:	4c 89 ef             	mov    %r13,%rdi
+  803cc5:	41 ff d7             	call   *%r15
+  803cc8:	85 c0                	test   %eax,%eax
+  803cca:	0f 85 c9 00 00 00    	jne    803d99 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803cd0:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803cd3:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803cda:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ce0:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ce3:	41 39 c4             	cmp    %eax,%r12d
+  803ce6:	75 cb                	jne    803cb3 <devpipe_read+0x4f>
+  803ce8:	48 89 de             	mov    %rbx,%rsi
+  803ceb:	4c 89 ef             	mov    %r13,%rdi
+  803cee:	41 ff d7             	call   *%r15
+  803cf1:	85 c0                	test   %eax,%eax
+  803cf3:	75 be                	jne    803cb3 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cf5:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cfa:	44 89 e6             	mov    %r12d,%esi
+  803cfd:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d01:	48 b8 1f 18 80 00 00 	movabs $0x80181f,%rax
+  803d08:	00 00 00 
+  803d0b:	ff d0                	call   *%rax
+  803d0d:	eb a4                	jmp    803cb3 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d0f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d13:	48 89 de             	mov    %rbx,%rsi
+  803d16:	48 b8 44 3a 80 00 00 	movabs $0x803a44,%rax
+  803d1d:	00 00 00 
+  803d20:	ff d0                	call   *%rax
+                return i;
+  803d22:	4c 89 f0             	mov    %r14,%rax
+}
+  803d25:	48 83 c4 28          	add    $0x28,%rsp
+  803d29:	5b                   	pop    %rbx
+  803d2a:	41 5c                	pop    %r12
+  803d2c:	41 5d                	pop    %r13
+  803d2e:	41 5e                	pop    %r14
+  803d30:	41 5f                	pop    %r15
+  803d32:	5d                   	pop    %rbp
+  803d33:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d34:	48 63 c8             	movslq %eax,%rcx
+  803d37:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d3e:	80 80 80 
+  803d41:	48 89 c8             	mov    %rcx,%rax
+  803d44:	48 f7 e2             	mul    %rdx
+  803d47:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d4b:	48 89 d0             	mov    %rdx,%rax
+  803d4e:	48 c1 e0 08          	shl    $0x8,%rax
+  803d52:	48 29 d0             	sub    %rdx,%rax
+  803d55:	48 c1 e0 04          	shl    $0x4,%rax
+  803d59:	48 89 c2             	mov    %rax,%rdx
+  803d5c:	48 89 c8             	mov    %rcx,%rax
+  803d5f:	48 29 d0             	sub    %rdx,%rax
+  803d62:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d67:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d6b:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d6f:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d72:	49 83 c6 01          	add    $0x1,%r14
+  803d76:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d7a:	0f 85 2b ff ff ff    	jne    803cab <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d80:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d84:	48 89 de             	mov    %rbx,%rsi
+  803d87:	48 b8 44 3a 80 00 00 	movabs $0x803a44,%rax
+  803d8e:	00 00 00 
+  803d91:	ff d0                	call   *%rax
+    return n;
+  803d93:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d97:	eb 8c                	jmp    803d25 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9e:	eb 85                	jmp    803d25 <devpipe_read+0xc1>
+
+0000000000803da0 <pipe>:
+pipe(int pfd[2]) {
+  803da0:	55                   	push   %rbp
+  803da1:	48 89 e5             	mov    %rsp,%rbp
+  803da4:	41 55                	push   %r13
+  803da6:	41 54                	push   %r12
+  803da8:	53                   	push   %rbx
+  803da9:	48 83 ec 18          	sub    $0x18,%rsp
+  803dad:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803db0:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803db4:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  803dbb:	00 00 00 
+  803dbe:	ff d0                	call   *%rax
+  803dc0:	89 c3                	mov    %eax,%ebx
+  803dc2:	85 c0                	test   %eax,%eax
+  803dc4:	0f 88 a0 01 00 00    	js     803f6a <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803dca:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dcf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803dd8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ddd:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+  803de9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803deb:	85 c0                	test   %eax,%eax
+  803ded:	0f 88 77 01 00 00    	js     803f6a <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803df3:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803df7:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  803dfe:	00 00 00 
+  803e01:	ff d0                	call   *%rax
+  803e03:	89 c3                	mov    %eax,%ebx
+  803e05:	85 c0                	test   %eax,%eax
+  803e07:	0f 88 43 01 00 00    	js     803f50 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e0d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e17:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e1b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e20:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  803e27:	00 00 00 
+  803e2a:	ff d0                	call   *%rax
+  803e2c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e2e:	85 c0                	test   %eax,%eax
+  803e30:	0f 88 1a 01 00 00    	js     803f50 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e36:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e3a:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803e41:	00 00 00 
+  803e44:	ff d0                	call   *%rax
+  803e46:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e49:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e53:	48 89 c6             	mov    %rax,%rsi
+  803e56:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e5b:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  803e62:	00 00 00 
+  803e65:	ff d0                	call   *%rax
+  803e67:	89 c3                	mov    %eax,%ebx
+  803e69:	85 c0                	test   %eax,%eax
+  803e6b:	0f 88 c5 00 00 00    	js     803f36 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e71:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e75:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803e7c:	00 00 00 
+  803e7f:	ff d0                	call   *%rax
+  803e81:	48 89 c1             	mov    %rax,%rcx
+  803e84:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e8a:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e90:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e95:	4c 89 ee             	mov    %r13,%rsi
+  803e98:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e9d:	48 b8 07 15 80 00 00 	movabs $0x801507,%rax
+  803ea4:	00 00 00 
+  803ea7:	ff d0                	call   *%rax
+  803ea9:	89 c3                	mov    %eax,%ebx
+  803eab:	85 c0                	test   %eax,%eax
+  803ead:	78 6e                	js     803f1d <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803eaf:	be 00 10 00 00       	mov    $0x1000,%esi
+  803eb4:	4c 89 ef             	mov    %r13,%rdi
+  803eb7:	48 b8 76 14 80 00 00 	movabs $0x801476,%rax
+  803ebe:	00 00 00 
+  803ec1:	ff d0                	call   *%rax
+  803ec3:	83 f8 02             	cmp    $0x2,%eax
+  803ec6:	0f 85 ab 00 00 00    	jne    803f77 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803ecc:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ed3:	00 00 
+  803ed5:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ed9:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803edb:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803edf:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ee6:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803eea:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803eec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ef0:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ef7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803efb:	48 bb e4 18 80 00 00 	movabs $0x8018e4,%rbx
+  803f02:	00 00 00 
+  803f05:	ff d3                	call   *%rbx
+  803f07:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f0b:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f0f:	ff d3                	call   *%rbx
+  803f11:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f16:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f1b:	eb 4d                	jmp    803f6a <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f22:	4c 89 ee             	mov    %r13,%rsi
+  803f25:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f2a:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  803f31:	00 00 00 
+  803f34:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f36:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f3b:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f44:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  803f4b:	00 00 00 
+  803f4e:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f50:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f55:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f59:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f5e:	48 b8 57 15 80 00 00 	movabs $0x801557,%rax
+  803f65:	00 00 00 
+  803f68:	ff d0                	call   *%rax
+}
+  803f6a:	89 d8                	mov    %ebx,%eax
+  803f6c:	48 83 c4 18          	add    $0x18,%rsp
+  803f70:	5b                   	pop    %rbx
+  803f71:	41 5c                	pop    %r12
+  803f73:	41 5d                	pop    %r13
+  803f75:	5d                   	pop    %rbp
+  803f76:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f77:	48 b9 b0 51 80 00 00 	movabs $0x8051b0,%rcx
+  803f7e:	00 00 00 
+  803f81:	48 ba 87 51 80 00 00 	movabs $0x805187,%rdx
+  803f88:	00 00 00 
+  803f8b:	be 50 00 00 00       	mov    $0x50,%esi
+  803f90:	48 bf 9c 51 80 00 00 	movabs $0x80519c,%rdi
+  803f97:	00 00 00 
+  803f9a:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f9f:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  803fa6:	00 00 00 
+  803fa9:	41 ff d0             	call   *%r8
+
+0000000000803fac <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803fac:	55                   	push   %rbp
+  803fad:	48 89 e5             	mov    %rsp,%rbp
+  803fb0:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803fb4:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803fb8:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  803fbf:	00 00 00 
+  803fc2:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803fc4:	85 c0                	test   %eax,%eax
+  803fc6:	78 23                	js     803feb <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803fc8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fcc:	48 b8 f6 18 80 00 00 	movabs $0x8018f6,%rax
+  803fd3:	00 00 00 
+  803fd6:	ff d0                	call   *%rax
+  803fd8:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fdb:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fdf:	48 b8 e7 3a 80 00 00 	movabs $0x803ae7,%rax
+  803fe6:	00 00 00 
+  803fe9:	ff d0                	call   *%rax
+}
+  803feb:	c9                   	leave
+  803fec:	c3                   	ret
+
+0000000000803fed <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fed:	48 89 f8             	mov    %rdi,%rax
+  803ff0:	48 c1 e8 27          	shr    $0x27,%rax
+  803ff4:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ffb:	01 00 00 
+  803ffe:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804002:	f6 c2 01             	test   $0x1,%dl
+  804005:	74 6d                	je     804074 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804007:	48 89 f8             	mov    %rdi,%rax
+  80400a:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80400e:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804015:	01 00 00 
+  804018:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80401c:	f6 c2 01             	test   $0x1,%dl
+  80401f:	74 62                	je     804083 <get_uvpt_entry+0x96>
+  804021:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804028:	01 00 00 
+  80402b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80402f:	f6 c2 80             	test   $0x80,%dl
+  804032:	75 4f                	jne    804083 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804034:	48 89 f8             	mov    %rdi,%rax
+  804037:	48 c1 e8 15          	shr    $0x15,%rax
+  80403b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804042:	01 00 00 
+  804045:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804049:	f6 c2 01             	test   $0x1,%dl
+  80404c:	74 44                	je     804092 <get_uvpt_entry+0xa5>
+  80404e:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804055:	01 00 00 
+  804058:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80405c:	f6 c2 80             	test   $0x80,%dl
+  80405f:	75 31                	jne    804092 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  804061:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804065:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  80406c:	01 00 00 
+  80406f:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804073:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804074:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80407b:	01 00 00 
+  80407e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804082:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804083:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80408a:	01 00 00 
+  80408d:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804091:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804092:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804099:	01 00 00 
+  80409c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040a0:	c3                   	ret
+
+00000000008040a1 <get_prot>:
+
+int
+get_prot(void *va) {
+  8040a1:	55                   	push   %rbp
+  8040a2:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040a5:	48 b8 ed 3f 80 00 00 	movabs $0x803fed,%rax
+  8040ac:	00 00 00 
+  8040af:	ff d0                	call   *%rax
+  8040b1:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8040b4:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8040b9:	89 c1                	mov    %eax,%ecx
+  8040bb:	83 c9 04             	or     $0x4,%ecx
+  8040be:	f6 c2 01             	test   $0x1,%dl
+  8040c1:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8040c4:	89 c1                	mov    %eax,%ecx
+  8040c6:	83 c9 02             	or     $0x2,%ecx
+  8040c9:	f6 c2 02             	test   $0x2,%dl
+  8040cc:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8040cf:	89 c1                	mov    %eax,%ecx
+  8040d1:	83 c9 01             	or     $0x1,%ecx
+  8040d4:	48 85 d2             	test   %rdx,%rdx
+  8040d7:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040da:	89 c1                	mov    %eax,%ecx
+  8040dc:	83 c9 40             	or     $0x40,%ecx
+  8040df:	f6 c6 04             	test   $0x4,%dh
+  8040e2:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040e5:	5d                   	pop    %rbp
+  8040e6:	c3                   	ret
+
+00000000008040e7 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040e7:	55                   	push   %rbp
+  8040e8:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040eb:	48 b8 ed 3f 80 00 00 	movabs $0x803fed,%rax
+  8040f2:	00 00 00 
+  8040f5:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040f7:	48 c1 e8 06          	shr    $0x6,%rax
+  8040fb:	83 e0 01             	and    $0x1,%eax
+}
+  8040fe:	5d                   	pop    %rbp
+  8040ff:	c3                   	ret
+
+0000000000804100 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804100:	55                   	push   %rbp
+  804101:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804104:	48 b8 ed 3f 80 00 00 	movabs $0x803fed,%rax
+  80410b:	00 00 00 
+  80410e:	ff d0                	call   *%rax
+  804110:	83 e0 01             	and    $0x1,%eax
+}
+  804113:	5d                   	pop    %rbp
+  804114:	c3                   	ret
+
+0000000000804115 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804115:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80411c:	01 00 00 
+  80411f:	a8 01                	test   $0x1,%al
+  804121:	75 06                	jne    804129 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804123:	b8 00 00 00 00       	mov    $0x0,%eax
+  804128:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804129:	55                   	push   %rbp
+  80412a:	48 89 e5             	mov    %rsp,%rbp
+  80412d:	41 57                	push   %r15
+  80412f:	41 56                	push   %r14
+  804131:	41 55                	push   %r13
+  804133:	41 54                	push   %r12
+  804135:	53                   	push   %rbx
+  804136:	48 83 ec 28          	sub    $0x28,%rsp
+  80413a:	49 89 fe             	mov    %rdi,%r14
+  80413d:	49 89 f7             	mov    %rsi,%r15
+  804140:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804147:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804148:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80414f:	01 00 00 
+  804152:	e9 ae 00 00 00       	jmp    804205 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804157:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80415e:	49 83 ec 01          	sub    $0x1,%r12
+  804162:	74 2d                	je     804191 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804164:	48 89 d8             	mov    %rbx,%rax
+  804167:	48 c1 e8 0c          	shr    $0xc,%rax
+  80416b:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  804170:	f6 c2 01             	test   $0x1,%dl
+  804173:	74 e2                	je     804157 <foreach_shared_region+0x42>
+  804175:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  80417a:	f6 c4 04             	test   $0x4,%ah
+  80417d:	74 d8                	je     804157 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80417f:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804186:	4c 89 fa             	mov    %r15,%rdx
+  804189:	48 89 df             	mov    %rbx,%rdi
+  80418c:	41 ff d6             	call   *%r14
+  80418f:	eb c6                	jmp    804157 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804191:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804198:	00 
+  804199:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80419e:	74 4a                	je     8041ea <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  8041a0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8041a4:	48 c1 e8 15          	shr    $0x15,%rax
+  8041a8:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  8041af:	01 00 00 
+  8041b2:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041b6:	a8 01                	test   $0x1,%al
+  8041b8:	74 d7                	je     804191 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041ba:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  8041be:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  8041c5:	48 39 c3             	cmp    %rax,%rbx
+  8041c8:	73 c7                	jae    804191 <foreach_shared_region+0x7c>
+  8041ca:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  8041d1:	48 39 d0             	cmp    %rdx,%rax
+  8041d4:	4d 19 e4             	sbb    %r12,%r12
+  8041d7:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041de:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041e5:	e9 7a ff ff ff       	jmp    804164 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041ea:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041f1:	40 
+  8041f2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041f6:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041fd:	00 00 00 
+  804200:	48 39 c1             	cmp    %rax,%rcx
+  804203:	74 50                	je     804255 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804205:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804209:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80420d:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804214:	01 00 00 
+  804217:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80421b:	a8 01                	test   $0x1,%al
+  80421d:	74 cb                	je     8041ea <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80421f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804223:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80422a:	48 39 c1             	cmp    %rax,%rcx
+  80422d:	73 bb                	jae    8041ea <foreach_shared_region+0xd5>
+  80422f:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804236:	48 39 d0             	cmp    %rdx,%rax
+  804239:	48 19 c0             	sbb    %rax,%rax
+  80423c:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804242:	48 05 00 02 00 00    	add    $0x200,%rax
+  804248:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80424c:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  804250:	e9 4b ff ff ff       	jmp    8041a0 <foreach_shared_region+0x8b>
+  804255:	b8 00 00 00 00       	mov    $0x0,%eax
+  80425a:	48 83 c4 28          	add    $0x28,%rsp
+  80425e:	5b                   	pop    %rbx
+  80425f:	41 5c                	pop    %r12
+  804261:	41 5d                	pop    %r13
+  804263:	41 5e                	pop    %r14
+  804265:	41 5f                	pop    %r15
+  804267:	5d                   	pop    %rbp
+  804268:	c3                   	ret
+
+0000000000804269 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804269:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80426f:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804276:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80427d:	c3                   	ret
+
+000000000080427e <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80427e:	8b 47 40             	mov    0x40(%rdi),%eax
+  804281:	8b 17                	mov    (%rdi),%edx
+  804283:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804285:	83 f8 0f             	cmp    $0xf,%eax
+  804288:	77 13                	ja     80429d <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  80428a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80428d:	83 e0 0f             	and    $0xf,%eax
+  804290:	48 c1 e0 09          	shl    $0x9,%rax
+  804294:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80429b:	00 
+  80429c:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80429d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042a2:	c3                   	ret
+
+00000000008042a3 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8042a3:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042a6:	83 c0 01             	add    $0x1,%eax
+  8042a9:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042ac:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042b2:	8b 57 04             	mov    0x4(%rdi),%edx
+  8042b5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042ba:	85 d2                	test   %edx,%edx
+  8042bc:	75 04                	jne    8042c2 <chan_publish+0x1f>
+  8042be:	83 e0 01             	and    $0x1,%eax
+}
+  8042c1:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8042c2:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8042c5:	85 c0                	test   %eax,%eax
+  8042c7:	0f 95 c0             	setne  %al
+  8042ca:	0f b6 c0             	movzbl %al,%eax
+  8042cd:	eb ef                	jmp    8042be <chan_publish+0x1b>
+
+00000000008042cf <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8042cf:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042d2:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042d4:	29 d0                	sub    %edx,%eax
+  8042d6:	83 e8 01             	sub    $0x1,%eax
+  8042d9:	83 f8 0f             	cmp    $0xf,%eax
+  8042dc:	77 12                	ja     8042f0 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042de:	8b 07                	mov    (%rdi),%eax
+  8042e0:	83 e0 0f             	and    $0xf,%eax
+  8042e3:	48 c1 e0 09          	shl    $0x9,%rax
+  8042e7:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042ee:	00 
+  8042ef:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042f0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042f5:	c3                   	ret
+
+00000000008042f6 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042f6:	8b 07                	mov    (%rdi),%eax
+  8042f8:	83 c0 01             	add    $0x1,%eax
+  8042fb:	89 07                	mov    %eax,(%rdi)
+}
+  8042fd:	c3                   	ret
+
+00000000008042fe <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042fe:	55                   	push   %rbp
+  8042ff:	48 89 e5             	mov    %rsp,%rbp
+  804302:	53                   	push   %rbx
+  804303:	48 83 ec 08          	sub    $0x8,%rsp
+  804307:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80430a:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804311:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804317:	48 b8 cf 42 80 00 00 	movabs $0x8042cf,%rax
+  80431e:	00 00 00 
+  804321:	ff d0                	call   *%rax
+  804323:	48 85 c0             	test   %rax,%rax
+  804326:	74 12                	je     80433a <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804328:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80432f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804334:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804338:	c9                   	leave
+  804339:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  80433a:	b8 01 00 00 00       	mov    $0x1,%eax
+  80433f:	eb f3                	jmp    804334 <chan_arm+0x36>
+
+0000000000804341 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  804341:	55                   	push   %rbp
+  804342:	48 89 e5             	mov    %rsp,%rbp
+  804345:	41 56                	push   %r14
+  804347:	41 55                	push   %r13
+  804349:	41 54                	push   %r12
+  80434b:	53                   	push   %rbx
+  80434c:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80434f:	49 bc fe 42 80 00 00 	movabs $0x8042fe,%r12
+  804356:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804359:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80435d:	49 bd 1f 18 80 00 00 	movabs $0x80181f,%r13
+  804364:	00 00 00 
+    while (chan_arm(r))
+  804367:	eb 0d                	jmp    804376 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804369:	8b 33                	mov    (%rbx),%esi
+  80436b:	ba 00 00 00 00       	mov    $0x0,%edx
+  804370:	4c 89 f7             	mov    %r14,%rdi
+  804373:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804376:	48 89 df             	mov    %rbx,%rdi
+  804379:	41 ff d4             	call   *%r12
+  80437c:	84 c0                	test   %al,%al
+  80437e:	75 e9                	jne    804369 <chan_wait+0x28>
+}
+  804380:	5b                   	pop    %rbx
+  804381:	41 5c                	pop    %r12
+  804383:	41 5d                	pop    %r13
+  804385:	41 5e                	pop    %r14
+  804387:	5d                   	pop    %rbp
+  804388:	c3                   	ret
+
+0000000000804389 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804389:	55                   	push   %rbp
+  80438a:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80438d:	48 83 c7 40          	add    $0x40,%rdi
+  804391:	be 01 00 00 00       	mov    $0x1,%esi
+  804396:	48 b8 3d 18 80 00 00 	movabs $0x80183d,%rax
+  80439d:	00 00 00 
+  8043a0:	ff d0                	call   *%rax
+}
+  8043a2:	5d                   	pop    %rbp
+  8043a3:	c3                   	ret
+
+00000000008043a4 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8043a4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043a9:	c3                   	ret
+
+00000000008043aa <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8043aa:	55                   	push   %rbp
+  8043ab:	48 89 e5             	mov    %rsp,%rbp
+  8043ae:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8043b1:	48 be d4 51 80 00 00 	movabs $0x8051d4,%rsi
+  8043b8:	00 00 00 
+  8043bb:	48 b8 52 0f 80 00 00 	movabs $0x800f52,%rax
+  8043c2:	00 00 00 
+  8043c5:	ff d0                	call   *%rax
+    return 0;
+}
+  8043c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8043cc:	5d                   	pop    %rbp
+  8043cd:	c3                   	ret
+
+00000000008043ce <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8043ce:	55                   	push   %rbp
+  8043cf:	48 89 e5             	mov    %rsp,%rbp
+  8043d2:	41 57                	push   %r15
+  8043d4:	41 56                	push   %r14
+  8043d6:	41 55                	push   %r13
+  8043d8:	41 54                	push   %r12
+  8043da:	53                   	push   %rbx
+  8043db:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043e2:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043e9:	48 85 d2             	test   %rdx,%rdx
+  8043ec:	74 7a                	je     804468 <devcons_write+0x9a>
+  8043ee:	49 89 d6             	mov    %rdx,%r14
+  8043f1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043f7:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043fc:	49 bf 4c 11 80 00 00 	movabs $0x80114c,%r15
+  804403:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804406:	4c 89 f3             	mov    %r14,%rbx
+  804409:	48 29 f3             	sub    %rsi,%rbx
+  80440c:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804411:	48 39 c3             	cmp    %rax,%rbx
+  804414:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804418:	4c 63 eb             	movslq %ebx,%r13
+  80441b:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804422:	48 01 c6             	add    %rax,%rsi
+  804425:	4c 89 ea             	mov    %r13,%rdx
+  804428:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80442f:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804432:	4c 89 ee             	mov    %r13,%rsi
+  804435:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80443c:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  804443:	00 00 00 
+  804446:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804448:	41 01 dc             	add    %ebx,%r12d
+  80444b:	49 63 f4             	movslq %r12d,%rsi
+  80444e:	4c 39 f6             	cmp    %r14,%rsi
+  804451:	72 b3                	jb     804406 <devcons_write+0x38>
+    return res;
+  804453:	49 63 c4             	movslq %r12d,%rax
+}
+  804456:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80445d:	5b                   	pop    %rbx
+  80445e:	41 5c                	pop    %r12
+  804460:	41 5d                	pop    %r13
+  804462:	41 5e                	pop    %r14
+  804464:	41 5f                	pop    %r15
+  804466:	5d                   	pop    %rbp
+  804467:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804468:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80446e:	eb e3                	jmp    804453 <devcons_write+0x85>
+
+0000000000804470 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  804470:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804473:	ba 00 00 00 00       	mov    $0x0,%edx
+  804478:	48 85 c0             	test   %rax,%rax
+  80447b:	74 55                	je     8044d2 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80447d:	55                   	push   %rbp
+  80447e:	48 89 e5             	mov    %rsp,%rbp
+  804481:	41 55                	push   %r13
+  804483:	41 54                	push   %r12
+  804485:	53                   	push   %rbx
+  804486:	48 83 ec 08          	sub    $0x8,%rsp
+  80448a:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80448d:	48 bb 98 13 80 00 00 	movabs $0x801398,%rbx
+  804494:	00 00 00 
+  804497:	49 bc 4d 14 80 00 00 	movabs $0x80144d,%r12
+  80449e:	00 00 00 
+  8044a1:	eb 03                	jmp    8044a6 <devcons_read+0x36>
+  8044a3:	41 ff d4             	call   *%r12
+  8044a6:	ff d3                	call   *%rbx
+  8044a8:	85 c0                	test   %eax,%eax
+  8044aa:	74 f7                	je     8044a3 <devcons_read+0x33>
+    if (c < 0) return c;
+  8044ac:	48 63 d0             	movslq %eax,%rdx
+  8044af:	78 13                	js     8044c4 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8044b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044b6:	83 f8 04             	cmp    $0x4,%eax
+  8044b9:	74 09                	je     8044c4 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8044bb:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8044bf:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8044c4:	48 89 d0             	mov    %rdx,%rax
+  8044c7:	48 83 c4 08          	add    $0x8,%rsp
+  8044cb:	5b                   	pop    %rbx
+  8044cc:	41 5c                	pop    %r12
+  8044ce:	41 5d                	pop    %r13
+  8044d0:	5d                   	pop    %rbp
+  8044d1:	c3                   	ret
+  8044d2:	48 89 d0             	mov    %rdx,%rax
+  8044d5:	c3                   	ret
+
+00000000008044d6 <cputchar>:
+cputchar(int ch) {
+  8044d6:	55                   	push   %rbp
+  8044d7:	48 89 e5             	mov    %rsp,%rbp
+  8044da:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044de:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044e2:	be 01 00 00 00       	mov    $0x1,%esi
+  8044e7:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044eb:	48 b8 79 13 80 00 00 	movabs $0x801379,%rax
+  8044f2:	00 00 00 
+  8044f5:	ff d0                	call   *%rax
+}
+  8044f7:	c9                   	leave
+  8044f8:	c3                   	ret
+
+00000000008044f9 <getchar>:
+getchar(void) {
+  8044f9:	55                   	push   %rbp
+  8044fa:	48 89 e5             	mov    %rsp,%rbp
+  8044fd:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804501:	ba 01 00 00 00       	mov    $0x1,%edx
+  804506:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80450a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450f:	48 b8 55 1c 80 00 00 	movabs $0x801c55,%rax
+  804516:	00 00 00 
+  804519:	ff d0                	call   *%rax
+  80451b:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80451d:	85 c0                	test   %eax,%eax
+  80451f:	78 06                	js     804527 <getchar+0x2e>
+  804521:	74 08                	je     80452b <getchar+0x32>
+  804523:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804527:	89 d0                	mov    %edx,%eax
+  804529:	c9                   	leave
+  80452a:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80452b:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  804530:	eb f5                	jmp    804527 <getchar+0x2e>
+
+0000000000804532 <iscons>:
+iscons(int fdnum) {
+  804532:	55                   	push   %rbp
+  804533:	48 89 e5             	mov    %rsp,%rbp
+  804536:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80453a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80453e:	48 b8 72 19 80 00 00 	movabs $0x801972,%rax
+  804545:	00 00 00 
+  804548:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80454a:	85 c0                	test   %eax,%eax
+  80454c:	78 18                	js     804566 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80454e:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804552:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804559:	00 00 00 
+  80455c:	8b 00                	mov    (%rax),%eax
+  80455e:	39 02                	cmp    %eax,(%rdx)
+  804560:	0f 94 c0             	sete   %al
+  804563:	0f b6 c0             	movzbl %al,%eax
+}
+  804566:	c9                   	leave
+  804567:	c3                   	ret
+
+0000000000804568 <opencons>:
+opencons(void) {
+  804568:	55                   	push   %rbp
+  804569:	48 89 e5             	mov    %rsp,%rbp
+  80456c:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  804570:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804574:	48 b8 12 19 80 00 00 	movabs $0x801912,%rax
+  80457b:	00 00 00 
+  80457e:	ff d0                	call   *%rax
+  804580:	85 c0                	test   %eax,%eax
+  804582:	78 49                	js     8045cd <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804584:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804589:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80458e:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804592:	bf 00 00 00 00       	mov    $0x0,%edi
+  804597:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  80459e:	00 00 00 
+  8045a1:	ff d0                	call   *%rax
+  8045a3:	85 c0                	test   %eax,%eax
+  8045a5:	78 26                	js     8045cd <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8045a7:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045ab:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8045b2:	00 00 
+  8045b4:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8045b6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8045ba:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8045c1:	48 b8 e4 18 80 00 00 	movabs $0x8018e4,%rax
+  8045c8:	00 00 00 
+  8045cb:	ff d0                	call   *%rax
+}
+  8045cd:	c9                   	leave
+  8045ce:	c3                   	ret
+
+00000000008045cf <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8045cf:	55                   	push   %rbp
+  8045d0:	48 89 e5             	mov    %rsp,%rbp
+  8045d3:	41 56                	push   %r14
+  8045d5:	41 55                	push   %r13
+  8045d7:	41 54                	push   %r12
+  8045d9:	53                   	push   %rbx
+  8045da:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045dd:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045e4:	00 00 00 
+  8045e7:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8045eb:	74 27                	je     804614 <_handle_vectored_pagefault+0x45>
+  8045ed:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  8045f2:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  8045f9:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045fc:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8045ff:	4c 89 e7             	mov    %r12,%rdi
+  804602:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804607:	84 c0                	test   %al,%al
+  804609:	75 45                	jne    804650 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80460b:	48 83 c3 01          	add    $0x1,%rbx
+  80460f:	49 3b 1e             	cmp    (%r14),%rbx
+  804612:	72 eb                	jb     8045ff <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804614:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80461b:	00 
+  80461c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804621:	4d 8b 04 24          	mov    (%r12),%r8
+  804625:	48 ba e0 51 80 00 00 	movabs $0x8051e0,%rdx
+  80462c:	00 00 00 
+  80462f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804634:	48 bf 10 52 80 00 00 	movabs $0x805210,%rdi
+  80463b:	00 00 00 
+  80463e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804643:	49 ba dd 04 80 00 00 	movabs $0x8004dd,%r10
+  80464a:	00 00 00 
+  80464d:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804650:	5b                   	pop    %rbx
+  804651:	41 5c                	pop    %r12
+  804653:	41 5d                	pop    %r13
+  804655:	41 5e                	pop    %r14
+  804657:	5d                   	pop    %rbp
+  804658:	c3                   	ret
+
+0000000000804659 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  804659:	55                   	push   %rbp
+  80465a:	48 89 e5             	mov    %rsp,%rbp
+  80465d:	53                   	push   %rbx
+  80465e:	48 83 ec 08          	sub    $0x8,%rsp
+  804662:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804665:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80466c:	00 00 00 
+  80466f:	80 38 00             	cmpb   $0x0,(%rax)
+  804672:	0f 84 84 00 00 00    	je     8046fc <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804678:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80467f:	00 00 00 
+  804682:	48 8b 10             	mov    (%rax),%rdx
+  804685:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80468a:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804691:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804694:	48 85 d2             	test   %rdx,%rdx
+  804697:	74 19                	je     8046b2 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804699:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80469d:	0f 84 e8 00 00 00    	je     80478b <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046a3:	48 83 c0 01          	add    $0x1,%rax
+  8046a7:	48 39 d0             	cmp    %rdx,%rax
+  8046aa:	75 ed                	jne    804699 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8046ac:	48 83 fa 08          	cmp    $0x8,%rdx
+  8046b0:	74 1c                	je     8046ce <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8046b2:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8046b6:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8046bd:	00 00 00 
+  8046c0:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046c7:	00 00 00 
+  8046ca:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8046ce:	48 b8 24 14 80 00 00 	movabs $0x801424,%rax
+  8046d5:	00 00 00 
+  8046d8:	ff d0                	call   *%rax
+  8046da:	89 c7                	mov    %eax,%edi
+  8046dc:	48 be 51 48 80 00 00 	movabs $0x804851,%rsi
+  8046e3:	00 00 00 
+  8046e6:	48 b8 6f 16 80 00 00 	movabs $0x80166f,%rax
+  8046ed:	00 00 00 
+  8046f0:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8046f2:	85 c0                	test   %eax,%eax
+  8046f4:	78 68                	js     80475e <add_pgfault_handler+0x105>
+    return res;
+}
+  8046f6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8046fa:	c9                   	leave
+  8046fb:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  8046fc:	48 b8 24 14 80 00 00 	movabs $0x801424,%rax
+  804703:	00 00 00 
+  804706:	ff d0                	call   *%rax
+  804708:	89 c7                	mov    %eax,%edi
+  80470a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80470f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804714:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80471b:	00 00 00 
+  80471e:	48 b8 b1 14 80 00 00 	movabs $0x8014b1,%rax
+  804725:	00 00 00 
+  804728:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80472a:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804731:	00 00 00 
+  804734:	48 8b 02             	mov    (%rdx),%rax
+  804737:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80473b:	48 89 0a             	mov    %rcx,(%rdx)
+  80473e:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804745:	00 00 00 
+  804748:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80474c:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804753:	00 00 00 
+  804756:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  804759:	e9 70 ff ff ff       	jmp    8046ce <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80475e:	89 c1                	mov    %eax,%ecx
+  804760:	48 ba 1e 52 80 00 00 	movabs $0x80521e,%rdx
+  804767:	00 00 00 
+  80476a:	be 3d 00 00 00       	mov    $0x3d,%esi
+  80476f:	48 bf 10 52 80 00 00 	movabs $0x805210,%rdi
+  804776:	00 00 00 
+  804779:	b8 00 00 00 00       	mov    $0x0,%eax
+  80477e:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  804785:	00 00 00 
+  804788:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80478b:	b8 00 00 00 00       	mov    $0x0,%eax
+  804790:	e9 61 ff ff ff       	jmp    8046f6 <add_pgfault_handler+0x9d>
+
+0000000000804795 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804795:	55                   	push   %rbp
+  804796:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804799:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047a0:	00 00 00 
+  8047a3:	80 38 00             	cmpb   $0x0,(%rax)
+  8047a6:	74 33                	je     8047db <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047a8:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8047af:	00 00 00 
+  8047b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8047b7:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047be:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047c1:	48 85 c0             	test   %rax,%rax
+  8047c4:	0f 84 85 00 00 00    	je     80484f <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8047ca:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8047ce:	74 40                	je     804810 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047d0:	48 83 c1 01          	add    $0x1,%rcx
+  8047d4:	48 39 c1             	cmp    %rax,%rcx
+  8047d7:	75 f1                	jne    8047ca <remove_pgfault_handler+0x35>
+  8047d9:	eb 74                	jmp    80484f <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8047db:	48 b9 36 52 80 00 00 	movabs $0x805236,%rcx
+  8047e2:	00 00 00 
+  8047e5:	48 ba 87 51 80 00 00 	movabs $0x805187,%rdx
+  8047ec:	00 00 00 
+  8047ef:	be 43 00 00 00       	mov    $0x43,%esi
+  8047f4:	48 bf 10 52 80 00 00 	movabs $0x805210,%rdi
+  8047fb:	00 00 00 
+  8047fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  804803:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  80480a:	00 00 00 
+  80480d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804810:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804817:	00 
+  804818:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80481c:	48 29 ca             	sub    %rcx,%rdx
+  80481f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804826:	00 00 00 
+  804829:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80482d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804832:	48 89 ce             	mov    %rcx,%rsi
+  804835:	48 b8 4c 11 80 00 00 	movabs $0x80114c,%rax
+  80483c:	00 00 00 
+  80483f:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804841:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804848:	00 00 00 
+  80484b:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  80484f:	5d                   	pop    %rbp
+  804850:	c3                   	ret
+
+0000000000804851 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804851:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804854:	48 b8 cf 45 80 00 00 	movabs $0x8045cf,%rax
+  80485b:	00 00 00 
+    call *%rax
+  80485e:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804860:	41 5f                	pop    %r15
+	popq %r15
+  804862:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804864:	41 5f                	pop    %r15
+	popq %r14
+  804866:	41 5e                	pop    %r14
+	popq %r13
+  804868:	41 5d                	pop    %r13
+	popq %r12
+  80486a:	41 5c                	pop    %r12
+	popq %r11
+  80486c:	41 5b                	pop    %r11
+	popq %r10
+  80486e:	41 5a                	pop    %r10
+	popq %r9
+  804870:	41 59                	pop    %r9
+	popq %r8
+  804872:	41 58                	pop    %r8
+	popq %rsi
+  804874:	5e                   	pop    %rsi
+	popq %rdi
+  804875:	5f                   	pop    %rdi
+	popq %rbp
+  804876:	5d                   	pop    %rbp
+	popq %rdx
+  804877:	5a                   	pop    %rdx
+	popq %rcx
+  804878:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  804879:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80487e:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804883:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804887:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80488a:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80488f:	5b                   	pop    %rbx
+	popq %rax
+  804890:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804891:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804895:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804896:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80489b:	c3                   	ret
+
+000000000080489c <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80489c:	55                   	push   %rbp
+  80489d:	48 89 e5             	mov    %rsp,%rbp
+  8048a0:	41 55                	push   %r13
+  8048a2:	41 54                	push   %r12
+  8048a4:	53                   	push   %rbx
+  8048a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8048a9:	49 89 fd             	mov    %rdi,%r13
+  8048ac:	48 89 f7             	mov    %rsi,%rdi
+  8048af:	48 89 d3             	mov    %rdx,%rbx
+  8048b2:	49 89 cc             	mov    %rcx,%r12
+  8048b5:	4c 89 c2             	mov    %r8,%rdx
+  8048b8:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8048bb:	48 85 f6             	test   %rsi,%rsi
+  8048be:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8048c5:	00 00 00 
+  8048c8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8048cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8048d1:	48 85 db             	test   %rbx,%rbx
+  8048d4:	74 03                	je     8048d9 <ipc_recv_futex+0x3d>
+  8048d6:	48 8b 33             	mov    (%rbx),%rsi
+  8048d9:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8048dd:	48 b8 fb 16 80 00 00 	movabs $0x8016fb,%rax
+  8048e4:	00 00 00 
+  8048e7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8048e9:	85 c0                	test   %eax,%eax
+  8048eb:	78 75                	js     804962 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8048ed:	4d 85 ed             	test   %r13,%r13
+  8048f0:	74 14                	je     804906 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8048f2:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  8048f9:	00 00 00 
+  8048fc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804902:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804906:	4d 85 e4             	test   %r12,%r12
+  804909:	74 14                	je     80491f <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80490b:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  804912:	00 00 00 
+  804915:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80491b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80491f:	48 85 db             	test   %rbx,%rbx
+  804922:	74 23                	je     804947 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804924:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  80492b:	00 00 00 
+  80492e:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  804934:	ba 00 00 00 00       	mov    $0x0,%edx
+  804939:	85 c9                	test   %ecx,%ecx
+  80493b:	74 07                	je     804944 <ipc_recv_futex+0xa8>
+  80493d:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  804944:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  804947:	48 a1 00 28 81 00 00 	movabs 0x812800,%rax
+  80494e:	00 00 00 
+  804951:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  804957:	48 83 c4 08          	add    $0x8,%rsp
+  80495b:	5b                   	pop    %rbx
+  80495c:	41 5c                	pop    %r12
+  80495e:	41 5d                	pop    %r13
+  804960:	5d                   	pop    %rbp
+  804961:	c3                   	ret
+        if (from_env_store != NULL) {
+  804962:	4d 85 ed             	test   %r13,%r13
+  804965:	74 08                	je     80496f <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804967:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80496e:	00 
+        if (perm_store != NULL) {
+  80496f:	4d 85 e4             	test   %r12,%r12
+  804972:	74 08                	je     80497c <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804974:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80497b:	00 
+        if (size != NULL) {
+  80497c:	48 85 db             	test   %rbx,%rbx
+  80497f:	74 d6                	je     804957 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804981:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804988:	eb cd                	jmp    804957 <ipc_recv_futex+0xbb>
+
+000000000080498a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80498a:	55                   	push   %rbp
+  80498b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80498e:	48 83 ec 08          	sub    $0x8,%rsp
+  804992:	6a 00                	push   $0x0
+  804994:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80499a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8049a0:	48 b8 9c 48 80 00 00 	movabs $0x80489c,%rax
+  8049a7:	00 00 00 
+  8049aa:	ff d0                	call   *%rax
+}
+  8049ac:	c9                   	leave
+  8049ad:	c3                   	ret
+
+00000000008049ae <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8049ae:	55                   	push   %rbp
+  8049af:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8049b2:	48 85 d2             	test   %rdx,%rdx
+  8049b5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8049bc:	00 00 00 
+  8049bf:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8049c3:	89 f6                	mov    %esi,%esi
+  8049c5:	48 b8 e4 16 80 00 00 	movabs $0x8016e4,%rax
+  8049cc:	00 00 00 
+  8049cf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8049d1:	85 c0                	test   %eax,%eax
+  8049d3:	78 02                	js     8049d7 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8049d5:	5d                   	pop    %rbp
+  8049d6:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8049d7:	89 c1                	mov    %eax,%ecx
+  8049d9:	48 ba 50 52 80 00 00 	movabs $0x805250,%rdx
+  8049e0:	00 00 00 
+  8049e3:	be 50 00 00 00       	mov    $0x50,%esi
+  8049e8:	48 bf 64 52 80 00 00 	movabs $0x805264,%rdi
+  8049ef:	00 00 00 
+  8049f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8049f7:	49 b8 dd 04 80 00 00 	movabs $0x8004dd,%r8
+  8049fe:	00 00 00 
+  804a01:	41 ff d0             	call   *%r8
+
+0000000000804a04 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804a04:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804a09:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804a10:	00 00 00 
+  804a13:	48 89 d0             	mov    %rdx,%rax
+  804a16:	48 c1 e0 04          	shl    $0x4,%rax
+  804a1a:	48 29 d0             	sub    %rdx,%rax
+  804a1d:	48 c1 e0 05          	shl    $0x5,%rax
+  804a21:	48 01 c8             	add    %rcx,%rax
+  804a24:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804a2a:	39 f8                	cmp    %edi,%eax
+  804a2c:	74 13                	je     804a41 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804a2e:	48 83 c2 01          	add    $0x1,%rdx
+  804a32:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804a39:	75 d8                	jne    804a13 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804a3b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804a40:	c3                   	ret
+            return envs[i].env_id;
+  804a41:	48 89 d0             	mov    %rdx,%rax
+  804a44:	48 c1 e0 04          	shl    $0x4,%rax
+  804a48:	48 29 d0             	sub    %rdx,%rax
+  804a4b:	48 c1 e0 05          	shl    $0x5,%rax
+  804a4f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804a56:	00 00 00 
+  804a59:	48 01 d0             	add    %rdx,%rax
+  804a5c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804a62:	c3                   	ret
+  804a63:	0f 1f 44 00 00       	nopl   0x0(%rax,%rax,1)
+
+0000000000804a68 <__rodata_start>:
+  804a68:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a69:	70 65                	jo     804ad0 <__rodata_start+0x68>
+  804a6b:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a6c:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a084e5 <__bss_end+0x251c64e5>
+  804a72:	69 00 75 73 65 72    	imul   $0x72657375,(%rax),%eax
+  804a78:	2f                   	(bad)
+  804a79:	70 61                	jo     804adc <__rodata_start+0x74>
+  804a7b:	74 68                	je     804ae5 <__rodata_start+0x7d>
+  804a7d:	62 65 6e 63 68       	(bad)
+  804a82:	2e 63 00             	cs movsxd (%rax),%eax
+  804a85:	25 73 2f 64 69       	and    $0x69642f73,%eax
+  804a8a:	72 25                	jb     804ab1 <__rodata_start+0x49>
+  804a8c:	64 00 2f             	add    %ch,%fs:(%rdi)
+  804a8f:	70 61                	jo     804af2 <__rodata_start+0x8a>
+  804a91:	74 68                	je     804afb <__rodata_start+0x93>
+  804a93:	62 65 6e 63 68       	(bad)
+  804a98:	00 6d 6b             	add    %ch,0x6b(%rbp)
+  804a9b:	64 69 72 20 25 73 3a 	imul   $0x203a7325,%fs:0x20(%rdx),%esi
+  804aa2:	20 
+  804aa3:	25 69 00 25 73       	and    $0x73250069,%eax
+  804aa8:	2f                   	(bad)
+  804aa9:	6c                   	insb   (%dx),%es:(%rdi)
+  804aaa:	65 61                	gs (bad)
+  804aac:	66 00 25 73 2f 6d 69 	data16 add %ah,0x696d2f73(%rip)        # 69ed7a26 <__bss_end+0x69695a26>
+  804ab3:	73 73                	jae    804b28 <__rodata_start+0xc0>
+  804ab5:	69 6e 67 00 63 72 65 	imul   $0x65726300,0x67(%rsi),%ebp
+  804abc:	61                   	(bad)
+  804abd:	74 65                	je     804b24 <__rodata_start+0xbc>
+  804abf:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a08538 <__bss_end+0x251c6538>
+  804ac5:	69 00 6d 69 73 73    	imul   $0x7373696d,(%rax),%eax
+  804acb:	69 6e 67 20 64 65 65 	imul   $0x65656420,0x67(%rsi),%ebp
+  804ad2:	70 20                	jo     804af4 <__rodata_start+0x8c>
+  804ad4:	70 61                	jo     804b37 <__rodata_start+0xcf>
+  804ad6:	74 68                	je     804b40 <__rodata_start+0xd8>
+  804ad8:	00 73 68             	add    %dh,0x68(%rbx)
+  804adb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804adc:	72 74                	jb     804b52 <__rodata_start+0xea>
+  804ade:	20 70 61             	and    %dh,0x61(%rax)
+  804ae1:	74 68                	je     804b4b <__rodata_start+0xe3>
+  804ae3:	00 72 65             	add    %dh,0x65(%rdx)
+  804ae6:	6d                   	insl   (%dx),%es:(%rdi)
+  804ae7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ae8:	76 65                	jbe    804b4f <__rodata_start+0xe7>
+  804aea:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a08563 <__bss_end+0x251c6563>
+  804af0:	69 00 66 0f 1f 44    	imul   $0x441f0f66,(%rax),%eax
+  804af6:	00 00                	add    %al,(%rax)
+  804af8:	70 61                	jo     804b5b <__rodata_start+0xf3>
+  804afa:	74 68                	je     804b64 <__rodata_start+0xfc>
+  804afc:	62 65 6e 63 68       	(bad)
+  804b01:	3a 20                	cmp    (%rax),%ah
+  804b03:	25 73 3a 20 25       	and    $0x25203a73,%eax
+  804b08:	6c                   	insb   (%dx),%es:(%rdi)
+  804b09:	75 20                	jne    804b2b <__rodata_start+0xc3>
+  804b0b:	63 79 63             	movsxd 0x63(%rcx),%edi
+  804b0e:	6c                   	insb   (%dx),%es:(%rdi)
+  804b0f:	65 73 20             	gs jae 804b32 <__rodata_start+0xca>
+  804b12:	70 65                	jo     804b79 <__rodata_start+0x111>
+  804b14:	72 20                	jb     804b36 <__rodata_start+0xce>
+  804b16:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b17:	70 65                	jo     804b7e <__rodata_start+0x116>
+  804b19:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b1a:	0a 00                	or     (%rax),%al
+  804b1c:	3c 75                	cmp    $0x75,%al
+  804b1e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b1f:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804b23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b24:	3e 00 66 90          	ds add %ah,-0x70(%rsi)
+  804b28:	5b                   	pop    %rbx
+  804b29:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804b2e:	20 75 73             	and    %dh,0x73(%rbp)
+  804b31:	65 72 20             	gs jb  804b54 <__rodata_start+0xec>
+  804b34:	70 61                	jo     804b97 <__rodata_start+0x12f>
+  804b36:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b37:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804b3e:	73 20                	jae    804b60 <__rodata_start+0xf8>
+  804b40:	61                   	(bad)
+  804b41:	74 20                	je     804b63 <__rodata_start+0xfb>
+  804b43:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804b48:	3a 20                	cmp    (%rax),%ah
+  804b4a:	00 30                	add    %dh,(%rax)
+  804b4c:	31 32                	xor    %esi,(%rdx)
+  804b4e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b55:	41                   	rex.B
+  804b56:	42                   	rex.X
+  804b57:	43                   	rex.XB
+  804b58:	44                   	rex.R
+  804b59:	45                   	rex.RB
+  804b5a:	46 00 30             	rex.RX add %r14b,(%rax)
+  804b5d:	31 32                	xor    %esi,(%rdx)
+  804b5f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804b66:	61                   	(bad)
+  804b67:	62 63 64 65 66       	(bad)
+  804b6c:	00 28                	add    %ch,(%rax)
+  804b6e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b6f:	75 6c                	jne    804bdd <__rodata_start+0x175>
+  804b71:	6c                   	insb   (%dx),%es:(%rdi)
+  804b72:	29 00                	sub    %eax,(%rax)
+  804b74:	65 72 72             	gs jb  804be9 <__rodata_start+0x181>
+  804b77:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b78:	72 20                	jb     804b9a <__rodata_start+0x132>
+  804b7a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804b7f:	73 70                	jae    804bf1 <__rodata_start+0x189>
+  804b81:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804b85:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804b8c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804b8d:	72 00                	jb     804b8f <__rodata_start+0x127>
+  804b8f:	62 61 64 20 65       	(bad)
+  804b94:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b95:	76 69                	jbe    804c00 <__rodata_start+0x198>
+  804b97:	72 6f                	jb     804c08 <__rodata_start+0x1a0>
+  804b99:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b9a:	6d                   	insl   (%dx),%es:(%rdi)
+  804b9b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804b9d:	74 00                	je     804b9f <__rodata_start+0x137>
+  804b9f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804ba6:	20 70 61             	and    %dh,0x61(%rax)
+  804ba9:	72 61                	jb     804c0c <__rodata_start+0x1a4>
+  804bab:	6d                   	insl   (%dx),%es:(%rdi)
+  804bac:	65 74 65             	gs je  804c14 <__rodata_start+0x1ac>
+  804baf:	72 00                	jb     804bb1 <__rodata_start+0x149>
+  804bb1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bb2:	75 74                	jne    804c28 <__rodata_start+0x1c0>
+  804bb4:	20 6f 66             	and    %ch,0x66(%rdi)
+  804bb7:	20 6d 65             	and    %ch,0x65(%rbp)
+  804bba:	6d                   	insl   (%dx),%es:(%rdi)
+  804bbb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bbc:	72 79                	jb     804c37 <__rodata_start+0x1cf>
+  804bbe:	00 6f 75             	add    %ch,0x75(%rdi)
+  804bc1:	74 20                	je     804be3 <__rodata_start+0x17b>
+  804bc3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bc4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804bc8:	76 69                	jbe    804c33 <__rodata_start+0x1cb>
+  804bca:	72 6f                	jb     804c3b <__rodata_start+0x1d3>
+  804bcc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bcd:	6d                   	insl   (%dx),%es:(%rdi)
+  804bce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bd0:	74 73                	je     804c45 <__rodata_start+0x1dd>
+  804bd2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804bd5:	72 72                	jb     804c49 <__rodata_start+0x1e1>
+  804bd7:	75 70                	jne    804c49 <__rodata_start+0x1e1>
+  804bd9:	74 65                	je     804c40 <__rodata_start+0x1d8>
+  804bdb:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804be0:	75 67                	jne    804c49 <__rodata_start+0x1e1>
+  804be2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804be5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804be7:	00 73 65             	add    %dh,0x65(%rbx)
+  804bea:	67 6d                	insl   (%dx),%es:(%edi)
+  804bec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804bee:	74 61                	je     804c51 <__rodata_start+0x1e9>
+  804bf0:	74 69                	je     804c5b <__rodata_start+0x1f3>
+  804bf2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bf3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bf4:	20 66 61             	and    %ah,0x61(%rsi)
+  804bf7:	75 6c                	jne    804c65 <__rodata_start+0x1fd>
+  804bf9:	74 00                	je     804bfb <__rodata_start+0x193>
+  804bfb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c02:	20 45 4c             	and    %al,0x4c(%rbp)
+  804c05:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804c09:	61                   	(bad)
+  804c0a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804c0f:	20 73 75             	and    %dh,0x75(%rbx)
+  804c12:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804c15:	73 79                	jae    804c90 <__rodata_start+0x228>
+  804c17:	73 74                	jae    804c8d <__rodata_start+0x225>
+  804c19:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804c1b:	20 63 61             	and    %ah,0x61(%rbx)
+  804c1e:	6c                   	insb   (%dx),%es:(%rdi)
+  804c1f:	6c                   	insb   (%dx),%es:(%rdi)
+  804c20:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804c23:	74 72                	je     804c97 <__rodata_start+0x22f>
+  804c25:	79 20                	jns    804c47 <__rodata_start+0x1df>
+  804c27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c29:	74 20                	je     804c4b <__rodata_start+0x1e3>
+  804c2b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c2d:	75 6e                	jne    804c9d <__rodata_start+0x235>
+  804c2f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804c33:	76 20                	jbe    804c55 <__rodata_start+0x1ed>
+  804c35:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804c3c:	72 65                	jb     804ca3 <__rodata_start+0x23b>
+  804c3e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804c41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c42:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804c46:	65 78 70             	gs js  804cb9 <__rodata_start+0x251>
+  804c49:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804c4e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804c51:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804c55:	20 66 69             	and    %ah,0x69(%rsi)
+  804c58:	6c                   	insb   (%dx),%es:(%rdi)
+  804c59:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804c5d:	20 66 72             	and    %ah,0x72(%rsi)
+  804c60:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804c65:	61                   	(bad)
+  804c66:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804c69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c6b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804c6f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804c72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c74:	20 6d 61             	and    %ch,0x61(%rbp)
+  804c77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c78:	79 20                	jns    804c9a <__rodata_start+0x232>
+  804c7a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804c81:	72 65                	jb     804ce8 <__rodata_start+0x280>
+  804c83:	20 6f 70             	and    %ch,0x70(%rdi)
+  804c86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c88:	00 66 69             	add    %ah,0x69(%rsi)
+  804c8b:	6c                   	insb   (%dx),%es:(%rdi)
+  804c8c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804c90:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804c93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c94:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c99:	74 20                	je     804cbb <__rodata_start+0x253>
+  804c9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c9d:	75 6e                	jne    804d0d <__rodata_start+0x2a5>
+  804c9f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804ca3:	76 61                	jbe    804d06 <__rodata_start+0x29e>
+  804ca5:	6c                   	insb   (%dx),%es:(%rdi)
+  804ca6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804cad:	00 
+  804cae:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804cb5:	72 65                	jb     804d1c <__rodata_start+0x2b4>
+  804cb7:	61                   	(bad)
+  804cb8:	64 79 20             	fs jns 804cdb <__rodata_start+0x273>
+  804cbb:	65 78 69             	gs js  804d27 <__rodata_start+0x2bf>
+  804cbe:	73 74                	jae    804d34 <__rodata_start+0x2cc>
+  804cc0:	73 00                	jae    804cc2 <__rodata_start+0x25a>
+  804cc2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cc3:	70 65                	jo     804d2a <__rodata_start+0x2c2>
+  804cc5:	72 61                	jb     804d28 <__rodata_start+0x2c0>
+  804cc7:	74 69                	je     804d32 <__rodata_start+0x2ca>
+  804cc9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ccb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804cce:	74 20                	je     804cf0 <__rodata_start+0x288>
+  804cd0:	73 75                	jae    804d47 <__rodata_start+0x2df>
+  804cd2:	70 70                	jo     804d44 <__rodata_start+0x2dc>
+  804cd4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cd5:	72 74                	jb     804d4b <__rodata_start+0x2e3>
+  804cd7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804cdd:	20 61 67             	and    %ah,0x67(%rcx)
+  804ce0:	61                   	(bad)
+  804ce1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804ce8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804cec:	74 00                	je     804cee <__rodata_start+0x286>
+  804cee:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804cf5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804cf8:	20 75 73             	and    %dh,0x73(%rbp)
+  804cfb:	65 00 0f             	add    %cl,%gs:(%rdi)
+  804cfe:	1f                   	(bad)
+  804cff:	00 1a                	add    %bl,(%rdx)
+  804d01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804d07:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 4b 0e             	add    %cl,0xe(%rbx)
+  804d12:	80 00 00             	addb   $0x0,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d1a:	80 00 00             	addb   $0x0,(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d2a:	80 00 00             	addb   $0x0,(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 39                	add    %bh,(%rcx)
+  804d39:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804d3f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d42:	80 00 00             	addb   $0x0,(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d4a:	80 00 00             	addb   $0x0,(%rax)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 2d 08 80 00 00    	add    %ch,0x8008(%rip)        # 80cd5d <__ctors_end+0x6c7d>
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 a7 08 80 00 00    	add    %ah,0x8008(%rdi)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804d62:	80 00 00             	addb   $0x0,(%rax)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 2d 08 80 00 00    	add    %ch,0x8008(%rip)        # 80cd75 <__ctors_end+0x6c95>
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 73 08             	add    %dh,0x8(%rbx)
+  804d72:	80 00 00             	addb   $0x0,(%rax)
+  804d75:	00 00                	add    %al,(%rax)
+  804d77:	00 73 08             	add    %dh,0x8(%rbx)
+  804d7a:	80 00 00             	addb   $0x0,(%rax)
+  804d7d:	00 00                	add    %al,(%rax)
+  804d7f:	00 73 08             	add    %dh,0x8(%rbx)
+  804d82:	80 00 00             	addb   $0x0,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 73 08             	add    %dh,0x8(%rbx)
+  804d8a:	80 00 00             	addb   $0x0,(%rax)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 73 08             	add    %dh,0x8(%rbx)
+  804d92:	80 00 00             	addb   $0x0,(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 73 08             	add    %dh,0x8(%rbx)
+  804d9a:	80 00 00             	addb   $0x0,(%rax)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 73 08             	add    %dh,0x8(%rbx)
+  804da2:	80 00 00             	addb   $0x0,(%rax)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 73 08             	add    %dh,0x8(%rbx)
+  804daa:	80 00 00             	addb   $0x0,(%rax)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 73 08             	add    %dh,0x8(%rbx)
+  804db2:	80 00 00             	addb   $0x0,(%rax)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dba:	80 00 00             	addb   $0x0,(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dc2:	80 00 00             	addb   $0x0,(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dca:	80 00 00             	addb   $0x0,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dd2:	80 00 00             	addb   $0x0,(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dda:	80 00 00             	addb   $0x0,(%rax)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dea:	80 00 00             	addb   $0x0,(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804df2:	80 00 00             	addb   $0x0,(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804dfa:	80 00 00             	addb   $0x0,(%rax)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e02:	80 00 00             	addb   $0x0,(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e0a:	80 00 00             	addb   $0x0,(%rax)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e12:	80 00 00             	addb   $0x0,(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e1a:	80 00 00             	addb   $0x0,(%rax)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e22:	80 00 00             	addb   $0x0,(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e2a:	80 00 00             	addb   $0x0,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e32:	80 00 00             	addb   $0x0,(%rax)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e3a:	80 00 00             	addb   $0x0,(%rax)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e42:	80 00 00             	addb   $0x0,(%rax)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e4a:	80 00 00             	addb   $0x0,(%rax)
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e52:	80 00 00             	addb   $0x0,(%rax)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e5a:	80 00 00             	addb   $0x0,(%rax)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e62:	80 00 00             	addb   $0x0,(%rax)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e6a:	80 00 00             	addb   $0x0,(%rax)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e72:	80 00 00             	addb   $0x0,(%rax)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e7a:	80 00 00             	addb   $0x0,(%rax)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e82:	80 00 00             	addb   $0x0,(%rax)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e8a:	80 00 00             	addb   $0x0,(%rax)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e92:	80 00 00             	addb   $0x0,(%rax)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804e9a:	80 00 00             	addb   $0x0,(%rax)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804ea2:	80 00 00             	addb   $0x0,(%rax)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 7e 0d             	add    %bh,0xd(%rsi)
+  804eaa:	80 00 00             	addb   $0x0,(%rax)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804eb2:	80 00 00             	addb   $0x0,(%rax)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804eba:	80 00 00             	addb   $0x0,(%rax)
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804ec2:	80 00 00             	addb   $0x0,(%rax)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804eca:	80 00 00             	addb   $0x0,(%rax)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804ed2:	80 00 00             	addb   $0x0,(%rax)
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804eda:	80 00 00             	addb   $0x0,(%rax)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804ee2:	80 00 00             	addb   $0x0,(%rax)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804eea:	80 00 00             	addb   $0x0,(%rax)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804ef2:	80 00 00             	addb   $0x0,(%rax)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804efa:	80 00 00             	addb   $0x0,(%rax)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 ca                	add    %cl,%dl
+  804f01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804f07:	00 99 0a 80 00 00    	add    %bl,0x800a(%rcx)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f12:	80 00 00             	addb   $0x0,(%rax)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f1a:	80 00 00             	addb   $0x0,(%rax)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f22:	80 00 00             	addb   $0x0,(%rax)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f2a:	80 00 00             	addb   $0x0,(%rax)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 f9                	add    %bh,%cl
+  804f31:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804f37:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f3a:	80 00 00             	addb   $0x0,(%rax)
+  804f3d:	00 00                	add    %al,(%rax)
+  804f3f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f42:	80 00 00             	addb   $0x0,(%rax)
+  804f45:	00 00                	add    %al,(%rax)
+  804f47:	00 bf 08 80 00 00    	add    %bh,0x8008(%rdi)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f52:	80 00 00             	addb   $0x0,(%rax)
+  804f55:	00 00                	add    %al,(%rax)
+  804f57:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f5a:	80 00 00             	addb   $0x0,(%rax)
+  804f5d:	00 00                	add    %al,(%rax)
+  804f5f:	00 41 0c             	add    %al,0xc(%rcx)
+  804f62:	80 00 00             	addb   $0x0,(%rax)
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 0b                	add    %cl,(%rbx)
+  804f69:	0d 80 00 00 00       	or     $0x80,%eax
+  804f6e:	00 00                	add    %al,(%rax)
+  804f70:	5b                   	pop    %rbx
+  804f71:	0e                   	(bad)
+  804f72:	80 00 00             	addb   $0x0,(%rax)
+  804f75:	00 00                	add    %al,(%rax)
+  804f77:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f7a:	80 00 00             	addb   $0x0,(%rax)
+  804f7d:	00 00                	add    %al,(%rax)
+  804f7f:	00 90 09 80 00 00    	add    %dl,0x8009(%rax)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f8a:	80 00 00             	addb   $0x0,(%rax)
+  804f8d:	00 00                	add    %al,(%rax)
+  804f8f:	00 6d 0b             	add    %ch,0xb(%rbp)
+  804f92:	80 00 00             	addb   $0x0,(%rax)
+  804f95:	00 00                	add    %al,(%rax)
+  804f97:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804f9a:	80 00 00             	addb   $0x0,(%rax)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804fa2:	80 00 00             	addb   $0x0,(%rax)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 7e 0d             	add    %bh,0xd(%rsi)
+  804faa:	80 00 00             	addb   $0x0,(%rax)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 5b 0e             	add    %bl,0xe(%rbx)
+  804fb2:	80 00 00             	addb   $0x0,(%rax)
+  804fb5:	00 00                	add    %al,(%rax)
+  804fb7:	00 23                	add    %ah,(%rbx)
+  804fb9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+	...
+
+0000000000804fc0 <error_string>:
+	...
+  804fc8:	7d 4b 80 00 00 00 00 00 8f 4b 80 00 00 00 00 00     }K.......K......
+  804fd8:	9f 4b 80 00 00 00 00 00 b1 4b 80 00 00 00 00 00     .K.......K......
+  804fe8:	bf 4b 80 00 00 00 00 00 d3 4b 80 00 00 00 00 00     .K.......K......
+  804ff8:	e8 4b 80 00 00 00 00 00 fb 4b 80 00 00 00 00 00     .K.......K......
+  805008:	0d 4c 80 00 00 00 00 00 21 4c 80 00 00 00 00 00     .L......!L......
+  805018:	31 4c 80 00 00 00 00 00 44 4c 80 00 00 00 00 00     1L......DL......
+  805028:	5b 4c 80 00 00 00 00 00 71 4c 80 00 00 00 00 00     [L......qL......
+  805038:	89 4c 80 00 00 00 00 00 a1 4c 80 00 00 00 00 00     .L.......L......
+  805048:	ae 4c 80 00 00 00 00 00 78 50 80 00 00 00 00 00     .L......xP......
+  805058:	c2 4c 80 00 00 00 00 00 da 4c 80 00 00 00 00 00     .L.......L......
+  805068:	e4 4c 80 00 00 00 00 00 ee 4c 80 00 00 00 00 00     .L.......L......
+  805078:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805088:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805098:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  8050a8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  8050b8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 0f 1f 00     ib/syscall.c....
+  8050c8:	5b 25 30 38 78 5d 20 75 6e 6b 6e 6f 77 6e 20 64     [%08x] unknown d
+  8050d8:	65 76 69 63 65 20 74 79 70 65 20 25 64 0a 00 00     evice type %d...
+  8050e8:	5b 25 30 38 78 5d 20 66 74 72 75 6e 63 61 74 65     [%08x] ftruncate
+  8050f8:	20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65 0a      %d -- bad mode.
+  805108:	00 5b 25 30 38 78 5d 20 72 65 61 64 20 25 64 20     .[%08x] read %d 
+  805118:	2d 2d 20 62 61 64 20 6d 6f 64 65 0a 00 5b 25 30     -- bad mode..[%0
+  805128:	38 78 5d 20 77 72 69 74 65 20 25 64 20 2d 2d 20     8x] write %d -- 
+  805138:	62 61 64 20 6d 6f 64 65 0a 00 66 2e 0f 1f 84 00     bad mode..f.....
+  805148:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805158:	0f 1f 84 00 00 00 00 00                             ........
+
+0000000000805160 <devtab>:
+  805160:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805170:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805180:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805190:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  8051a0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  8051b0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  8051c0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  8051d0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  8051e0:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  8051f0:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805200:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805210:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805220:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805230:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  805240:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  805250:	69 70 63 5f 73 65 6e 64 20 65 72 72 6f 72 3a 20     ipc_send error: 
+  805260:	25 69 0a 00 6c 69 62 2f 69 70 63 2e 63 00 66 2e     %i..lib/ipc.c.f.
+  805270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,8584 @@
+
+obj/user/pingpong:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 13 01 00 00       	call   800136 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+ * Only need to start one of these -- splits into two with fork. */
+
+#include <inc/lib.h>
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) != 0) {
+  800036:	48 b8 70 15 80 00 00 	movabs $0x801570,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 93 00 00 00    	jne    8000e0 <umain+0xbb>
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80004d:	49 bf 7e 17 80 00 00 	movabs $0x80177e,%r15
+  800054:	00 00 00 
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800057:	49 be b0 10 80 00 00 	movabs $0x8010b0,%r14
+  80005e:	00 00 00 
+  800061:	49 bd b9 02 80 00 00 	movabs $0x8002b9,%r13
+  800068:	00 00 00 
+        uint32_t i = ipc_recv(&who, 0, 0, 0);
+  80006b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800070:	ba 00 00 00 00       	mov    $0x0,%edx
+  800075:	be 00 00 00 00       	mov    $0x0,%esi
+  80007a:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80007e:	41 ff d7             	call   *%r15
+  800081:	89 c3                	mov    %eax,%ebx
+        cprintf("%x got %d from %x\n", sys_getenvid(), i, who);
+  800083:	44 8b 65 cc          	mov    -0x34(%rbp),%r12d
+  800087:	41 ff d6             	call   *%r14
+  80008a:	89 c6                	mov    %eax,%esi
+  80008c:	44 89 e1             	mov    %r12d,%ecx
+  80008f:	89 da                	mov    %ebx,%edx
+  800091:	48 bf ce 48 80 00 00 	movabs $0x8048ce,%rdi
+  800098:	00 00 00 
+  80009b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000a0:	41 ff d5             	call   *%r13
+        if (i == 10) return;
+  8000a3:	83 fb 0a             	cmp    $0xa,%ebx
+  8000a6:	74 29                	je     8000d1 <umain+0xac>
+        i++;
+  8000a8:	83 c3 01             	add    $0x1,%ebx
+        ipc_send(who, i, 0, 0, 0);
+  8000ab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000b1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000b6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000bb:	89 de                	mov    %ebx,%esi
+  8000bd:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000c0:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  8000c7:	00 00 00 
+  8000ca:	ff d0                	call   *%rax
+        if (i == 10) return;
+  8000cc:	83 fb 0a             	cmp    $0xa,%ebx
+  8000cf:	75 9a                	jne    80006b <umain+0x46>
+    }
+}
+  8000d1:	48 83 c4 18          	add    $0x18,%rsp
+  8000d5:	5b                   	pop    %rbx
+  8000d6:	41 5c                	pop    %r12
+  8000d8:	41 5d                	pop    %r13
+  8000da:	41 5e                	pop    %r14
+  8000dc:	41 5f                	pop    %r15
+  8000de:	5d                   	pop    %rbp
+  8000df:	c3                   	ret
+  8000e0:	89 c3                	mov    %eax,%ebx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  8000e2:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  8000e9:	00 00 00 
+  8000ec:	ff d0                	call   *%rax
+  8000ee:	89 c6                	mov    %eax,%esi
+  8000f0:	89 da                	mov    %ebx,%edx
+  8000f2:	48 bf b8 48 80 00 00 	movabs $0x8048b8,%rdi
+  8000f9:	00 00 00 
+  8000fc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800101:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  800108:	00 00 00 
+  80010b:	ff d1                	call   *%rcx
+        ipc_send(who, 0, 0, 0, 0);
+  80010d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800113:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800118:	ba 00 00 00 00       	mov    $0x0,%edx
+  80011d:	be 00 00 00 00       	mov    $0x0,%esi
+  800122:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  800125:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  80012c:	00 00 00 
+  80012f:	ff d0                	call   *%rax
+  800131:	e9 17 ff ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800136 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800136:	55                   	push   %rbp
+  800137:	48 89 e5             	mov    %rsp,%rbp
+  80013a:	41 56                	push   %r14
+  80013c:	41 55                	push   %r13
+  80013e:	41 54                	push   %r12
+  800140:	53                   	push   %rbx
+  800141:	41 89 fd             	mov    %edi,%r13d
+  800144:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800147:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80014e:	00 00 00 
+  800151:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800158:	00 00 00 
+  80015b:	48 39 c2             	cmp    %rax,%rdx
+  80015e:	73 17                	jae    800177 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800160:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800163:	49 89 c4             	mov    %rax,%r12
+  800166:	48 83 c3 08          	add    $0x8,%rbx
+  80016a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80016f:	ff 53 f8             	call   *-0x8(%rbx)
+  800172:	4c 39 e3             	cmp    %r12,%rbx
+  800175:	72 ef                	jb     800166 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800177:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80017e:	00 00 00 
+  800181:	ff d0                	call   *%rax
+  800183:	89 c2                	mov    %eax,%edx
+  800185:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80018b:	48 89 d0             	mov    %rdx,%rax
+  80018e:	48 c1 e0 04          	shl    $0x4,%rax
+  800192:	48 29 d0             	sub    %rdx,%rax
+  800195:	48 c1 e0 05          	shl    $0x5,%rax
+  800199:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001a0:	00 00 00 
+  8001a3:	48 01 d0             	add    %rdx,%rax
+  8001a6:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001ad:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001b0:	45 85 ed             	test   %r13d,%r13d
+  8001b3:	7e 0d                	jle    8001c2 <libmain+0x8c>
+  8001b5:	49 8b 06             	mov    (%r14),%rax
+  8001b8:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001bf:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001c2:	4c 89 f6             	mov    %r14,%rsi
+  8001c5:	44 89 ef             	mov    %r13d,%edi
+  8001c8:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001cf:	00 00 00 
+  8001d2:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001d4:	48 b8 e9 01 80 00 00 	movabs $0x8001e9,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+#endif
+}
+  8001e0:	5b                   	pop    %rbx
+  8001e1:	41 5c                	pop    %r12
+  8001e3:	41 5d                	pop    %r13
+  8001e5:	41 5e                	pop    %r14
+  8001e7:	5d                   	pop    %rbp
+  8001e8:	c3                   	ret
+
+00000000008001e9 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001e9:	55                   	push   %rbp
+  8001ea:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001ed:	48 b8 7d 1a 80 00 00 	movabs $0x801a7d,%rax
+  8001f4:	00 00 00 
+  8001f7:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  8001f9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001fe:	48 b8 4d 10 80 00 00 	movabs $0x80104d,%rax
+  800205:	00 00 00 
+  800208:	ff d0                	call   *%rax
+}
+  80020a:	5d                   	pop    %rbp
+  80020b:	c3                   	ret
+
+000000000080020c <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80020c:	55                   	push   %rbp
+  80020d:	48 89 e5             	mov    %rsp,%rbp
+  800210:	53                   	push   %rbx
+  800211:	48 83 ec 08          	sub    $0x8,%rsp
+  800215:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800218:	8b 06                	mov    (%rsi),%eax
+  80021a:	8d 50 01             	lea    0x1(%rax),%edx
+  80021d:	89 16                	mov    %edx,(%rsi)
+  80021f:	48 98                	cltq
+  800221:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800226:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80022c:	74 0a                	je     800238 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80022e:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800232:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800236:	c9                   	leave
+  800237:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800238:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80023c:	be ff 00 00 00       	mov    $0xff,%esi
+  800241:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  800248:	00 00 00 
+  80024b:	ff d0                	call   *%rax
+        state->offset = 0;
+  80024d:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800253:	eb d9                	jmp    80022e <putch+0x22>
+
+0000000000800255 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800255:	55                   	push   %rbp
+  800256:	48 89 e5             	mov    %rsp,%rbp
+  800259:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800260:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800263:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  80026a:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80026f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800274:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800277:	48 89 f1             	mov    %rsi,%rcx
+  80027a:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800281:	48 bf 0c 02 80 00 00 	movabs $0x80020c,%rdi
+  800288:	00 00 00 
+  80028b:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  800292:	00 00 00 
+  800295:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800297:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  80029e:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002a5:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8002ac:	00 00 00 
+  8002af:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002b1:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002b7:	c9                   	leave
+  8002b8:	c3                   	ret
+
+00000000008002b9 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002b9:	55                   	push   %rbp
+  8002ba:	48 89 e5             	mov    %rsp,%rbp
+  8002bd:	48 83 ec 50          	sub    $0x50,%rsp
+  8002c1:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002c5:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002c9:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002cd:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002d1:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002d5:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002dc:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002e4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002e8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002ec:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002f0:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  8002f7:	00 00 00 
+  8002fa:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8002fc:	c9                   	leave
+  8002fd:	c3                   	ret
+
+00000000008002fe <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8002fe:	55                   	push   %rbp
+  8002ff:	48 89 e5             	mov    %rsp,%rbp
+  800302:	41 57                	push   %r15
+  800304:	41 56                	push   %r14
+  800306:	41 55                	push   %r13
+  800308:	41 54                	push   %r12
+  80030a:	53                   	push   %rbx
+  80030b:	48 83 ec 18          	sub    $0x18,%rsp
+  80030f:	49 89 fc             	mov    %rdi,%r12
+  800312:	49 89 f5             	mov    %rsi,%r13
+  800315:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800319:	8b 45 10             	mov    0x10(%rbp),%eax
+  80031c:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80031f:	41 89 cf             	mov    %ecx,%r15d
+  800322:	4c 39 fa             	cmp    %r15,%rdx
+  800325:	73 5b                	jae    800382 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800327:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80032b:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80032f:	85 db                	test   %ebx,%ebx
+  800331:	7e 0e                	jle    800341 <print_num+0x43>
+            putch(padc, put_arg);
+  800333:	4c 89 ee             	mov    %r13,%rsi
+  800336:	44 89 f7             	mov    %r14d,%edi
+  800339:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80033c:	83 eb 01             	sub    $0x1,%ebx
+  80033f:	75 f2                	jne    800333 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800341:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800345:	48 b9 fc 48 80 00 00 	movabs $0x8048fc,%rcx
+  80034c:	00 00 00 
+  80034f:	48 b8 eb 48 80 00 00 	movabs $0x8048eb,%rax
+  800356:	00 00 00 
+  800359:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  80035d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800361:	ba 00 00 00 00       	mov    $0x0,%edx
+  800366:	49 f7 f7             	div    %r15
+  800369:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  80036d:	4c 89 ee             	mov    %r13,%rsi
+  800370:	41 ff d4             	call   *%r12
+}
+  800373:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800377:	5b                   	pop    %rbx
+  800378:	41 5c                	pop    %r12
+  80037a:	41 5d                	pop    %r13
+  80037c:	41 5e                	pop    %r14
+  80037e:	41 5f                	pop    %r15
+  800380:	5d                   	pop    %rbp
+  800381:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800382:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800386:	ba 00 00 00 00       	mov    $0x0,%edx
+  80038b:	49 f7 f7             	div    %r15
+  80038e:	48 83 ec 08          	sub    $0x8,%rsp
+  800392:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800396:	52                   	push   %rdx
+  800397:	45 0f be c9          	movsbl %r9b,%r9d
+  80039b:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  80039f:	48 89 c2             	mov    %rax,%rdx
+  8003a2:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  8003a9:	00 00 00 
+  8003ac:	ff d0                	call   *%rax
+  8003ae:	48 83 c4 10          	add    $0x10,%rsp
+  8003b2:	eb 8d                	jmp    800341 <print_num+0x43>
+
+00000000008003b4 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003b4:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003b8:	48 8b 06             	mov    (%rsi),%rax
+  8003bb:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003bf:	73 0a                	jae    8003cb <sprintputch+0x17>
+        *state->start++ = ch;
+  8003c1:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003c5:	48 89 16             	mov    %rdx,(%rsi)
+  8003c8:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003cb:	c3                   	ret
+
+00000000008003cc <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003cc:	55                   	push   %rbp
+  8003cd:	48 89 e5             	mov    %rsp,%rbp
+  8003d0:	48 83 ec 50          	sub    $0x50,%rsp
+  8003d4:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003d8:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003dc:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003e0:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003e7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003eb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003ef:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003f3:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8003f7:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8003fb:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  800402:	00 00 00 
+  800405:	ff d0                	call   *%rax
+}
+  800407:	c9                   	leave
+  800408:	c3                   	ret
+
+0000000000800409 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800409:	55                   	push   %rbp
+  80040a:	48 89 e5             	mov    %rsp,%rbp
+  80040d:	41 57                	push   %r15
+  80040f:	41 56                	push   %r14
+  800411:	41 55                	push   %r13
+  800413:	41 54                	push   %r12
+  800415:	53                   	push   %rbx
+  800416:	48 83 ec 38          	sub    $0x38,%rsp
+  80041a:	49 89 fe             	mov    %rdi,%r14
+  80041d:	49 89 f5             	mov    %rsi,%r13
+  800420:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800423:	48 8b 01             	mov    (%rcx),%rax
+  800426:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80042a:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80042e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800432:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800436:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80043a:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80043e:	0f b6 3b             	movzbl (%rbx),%edi
+  800441:	40 80 ff 25          	cmp    $0x25,%dil
+  800445:	74 18                	je     80045f <vprintfmt+0x56>
+            if (!ch) return;
+  800447:	40 84 ff             	test   %dil,%dil
+  80044a:	0f 84 b1 06 00 00    	je     800b01 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800450:	40 0f b6 ff          	movzbl %dil,%edi
+  800454:	4c 89 ee             	mov    %r13,%rsi
+  800457:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  80045a:	4c 89 e3             	mov    %r12,%rbx
+  80045d:	eb db                	jmp    80043a <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80045f:	be 00 00 00 00       	mov    $0x0,%esi
+  800464:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800468:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  80046d:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800473:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  80047a:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80047e:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800483:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800488:	88 45 a0             	mov    %al,-0x60(%rbp)
+  80048b:	83 e8 23             	sub    $0x23,%eax
+  80048e:	3c 57                	cmp    $0x57,%al
+  800490:	0f 87 51 06 00 00    	ja     800ae7 <vprintfmt+0x6de>
+  800496:	0f b6 c0             	movzbl %al,%eax
+  800499:	48 b9 a0 4a 80 00 00 	movabs $0x804aa0,%rcx
+  8004a0:	00 00 00 
+  8004a3:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004a6:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004a9:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004ad:	eb cf                	jmp    80047e <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004af:	49 89 dc             	mov    %rbx,%r12
+  8004b2:	be 01 00 00 00       	mov    $0x1,%esi
+  8004b7:	eb c5                	jmp    80047e <vprintfmt+0x75>
+            padc = ch;
+  8004b9:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004bd:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004c0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004c3:	eb b9                	jmp    80047e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004c5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004c8:	83 f8 2f             	cmp    $0x2f,%eax
+  8004cb:	77 24                	ja     8004f1 <vprintfmt+0xe8>
+  8004cd:	89 c1                	mov    %eax,%ecx
+  8004cf:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004d3:	83 c0 08             	add    $0x8,%eax
+  8004d6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004d9:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004dc:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004df:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004e3:	79 99                	jns    80047e <vprintfmt+0x75>
+                width = precision;
+  8004e5:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004e9:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004ef:	eb 8d                	jmp    80047e <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004f1:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8004f5:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8004f9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004fd:	eb da                	jmp    8004d9 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8004ff:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800504:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800508:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80050e:	3c 39                	cmp    $0x39,%al
+  800510:	77 1c                	ja     80052e <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800512:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800516:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80051a:	0f b6 c0             	movzbl %al,%eax
+  80051d:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800522:	0f b6 03             	movzbl (%rbx),%eax
+  800525:	3c 39                	cmp    $0x39,%al
+  800527:	76 e9                	jbe    800512 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800529:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80052c:	eb b1                	jmp    8004df <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80052e:	49 89 dc             	mov    %rbx,%r12
+  800531:	eb ac                	jmp    8004df <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800533:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800536:	85 c9                	test   %ecx,%ecx
+  800538:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053d:	0f 49 c1             	cmovns %ecx,%eax
+  800540:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800543:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800546:	e9 33 ff ff ff       	jmp    80047e <vprintfmt+0x75>
+            lflag++;
+  80054b:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80054e:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800551:	e9 28 ff ff ff       	jmp    80047e <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800556:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800559:	83 f8 2f             	cmp    $0x2f,%eax
+  80055c:	77 19                	ja     800577 <vprintfmt+0x16e>
+  80055e:	89 c2                	mov    %eax,%edx
+  800560:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800564:	83 c0 08             	add    $0x8,%eax
+  800567:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80056a:	8b 3a                	mov    (%rdx),%edi
+  80056c:	4c 89 ee             	mov    %r13,%rsi
+  80056f:	41 ff d6             	call   *%r14
+            break;
+  800572:	e9 c3 fe ff ff       	jmp    80043a <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800577:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80057b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80057f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800583:	eb e5                	jmp    80056a <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800585:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800588:	83 f8 2f             	cmp    $0x2f,%eax
+  80058b:	77 5a                	ja     8005e7 <vprintfmt+0x1de>
+  80058d:	89 c2                	mov    %eax,%edx
+  80058f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800593:	83 c0 08             	add    $0x8,%eax
+  800596:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800599:	8b 02                	mov    (%rdx),%eax
+  80059b:	89 c1                	mov    %eax,%ecx
+  80059d:	f7 d9                	neg    %ecx
+  80059f:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005a2:	83 f9 16             	cmp    $0x16,%ecx
+  8005a5:	7f 4e                	jg     8005f5 <vprintfmt+0x1ec>
+  8005a7:	48 63 c1             	movslq %ecx,%rax
+  8005aa:	48 ba 60 4d 80 00 00 	movabs $0x804d60,%rdx
+  8005b1:	00 00 00 
+  8005b4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005b8:	48 85 c0             	test   %rax,%rax
+  8005bb:	74 38                	je     8005f5 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005bd:	48 89 c1             	mov    %rax,%rcx
+  8005c0:	48 ba 79 4f 80 00 00 	movabs $0x804f79,%rdx
+  8005c7:	00 00 00 
+  8005ca:	4c 89 ee             	mov    %r13,%rsi
+  8005cd:	4c 89 f7             	mov    %r14,%rdi
+  8005d0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005d5:	49 b8 cc 03 80 00 00 	movabs $0x8003cc,%r8
+  8005dc:	00 00 00 
+  8005df:	41 ff d0             	call   *%r8
+  8005e2:	e9 53 fe ff ff       	jmp    80043a <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005e7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005eb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005ef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f3:	eb a4                	jmp    800599 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8005f5:	48 ba 14 49 80 00 00 	movabs $0x804914,%rdx
+  8005fc:	00 00 00 
+  8005ff:	4c 89 ee             	mov    %r13,%rsi
+  800602:	4c 89 f7             	mov    %r14,%rdi
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	49 b8 cc 03 80 00 00 	movabs $0x8003cc,%r8
+  800611:	00 00 00 
+  800614:	41 ff d0             	call   *%r8
+  800617:	e9 1e fe ff ff       	jmp    80043a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80061c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80061f:	83 f8 2f             	cmp    $0x2f,%eax
+  800622:	77 6c                	ja     800690 <vprintfmt+0x287>
+  800624:	89 c2                	mov    %eax,%edx
+  800626:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80062a:	83 c0 08             	add    $0x8,%eax
+  80062d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800630:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800633:	48 85 d2             	test   %rdx,%rdx
+  800636:	48 b8 0d 49 80 00 00 	movabs $0x80490d,%rax
+  80063d:	00 00 00 
+  800640:	48 0f 45 c2          	cmovne %rdx,%rax
+  800644:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800648:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80064c:	7e 06                	jle    800654 <vprintfmt+0x24b>
+  80064e:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800652:	75 4a                	jne    80069e <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800654:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800658:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80065c:	0f b6 00             	movzbl (%rax),%eax
+  80065f:	84 c0                	test   %al,%al
+  800661:	0f 85 9a 00 00 00    	jne    800701 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800667:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80066a:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80066e:	85 c0                	test   %eax,%eax
+  800670:	0f 8e c4 fd ff ff    	jle    80043a <vprintfmt+0x31>
+  800676:	4c 89 ee             	mov    %r13,%rsi
+  800679:	bf 20 00 00 00       	mov    $0x20,%edi
+  80067e:	41 ff d6             	call   *%r14
+  800681:	41 83 ec 01          	sub    $0x1,%r12d
+  800685:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800689:	75 eb                	jne    800676 <vprintfmt+0x26d>
+  80068b:	e9 aa fd ff ff       	jmp    80043a <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800690:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800694:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800698:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80069c:	eb 92                	jmp    800630 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  80069e:	49 63 f7             	movslq %r15d,%rsi
+  8006a1:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006a5:	48 b8 bb 0b 80 00 00 	movabs $0x800bbb,%rax
+  8006ac:	00 00 00 
+  8006af:	ff d0                	call   *%rax
+  8006b1:	48 89 c2             	mov    %rax,%rdx
+  8006b4:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006b7:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006b9:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006bc:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006bf:	85 c0                	test   %eax,%eax
+  8006c1:	7e 91                	jle    800654 <vprintfmt+0x24b>
+  8006c3:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006c8:	4c 89 ee             	mov    %r13,%rsi
+  8006cb:	44 89 e7             	mov    %r12d,%edi
+  8006ce:	41 ff d6             	call   *%r14
+  8006d1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006d5:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006d8:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006db:	75 eb                	jne    8006c8 <vprintfmt+0x2bf>
+  8006dd:	e9 72 ff ff ff       	jmp    800654 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006e2:	0f b6 f8             	movzbl %al,%edi
+  8006e5:	4c 89 ee             	mov    %r13,%rsi
+  8006e8:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006eb:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006ef:	49 83 c4 01          	add    $0x1,%r12
+  8006f3:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8006f9:	84 c0                	test   %al,%al
+  8006fb:	0f 84 66 ff ff ff    	je     800667 <vprintfmt+0x25e>
+  800701:	45 85 ff             	test   %r15d,%r15d
+  800704:	78 0a                	js     800710 <vprintfmt+0x307>
+  800706:	41 83 ef 01          	sub    $0x1,%r15d
+  80070a:	0f 88 57 ff ff ff    	js     800667 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800710:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800714:	74 cc                	je     8006e2 <vprintfmt+0x2d9>
+  800716:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800719:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80071e:	80 fa 5e             	cmp    $0x5e,%dl
+  800721:	77 c2                	ja     8006e5 <vprintfmt+0x2dc>
+  800723:	eb bd                	jmp    8006e2 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800725:	40 84 f6             	test   %sil,%sil
+  800728:	75 26                	jne    800750 <vprintfmt+0x347>
+    switch (lflag) {
+  80072a:	85 d2                	test   %edx,%edx
+  80072c:	74 59                	je     800787 <vprintfmt+0x37e>
+  80072e:	83 fa 01             	cmp    $0x1,%edx
+  800731:	74 7b                	je     8007ae <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800733:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800736:	83 f8 2f             	cmp    $0x2f,%eax
+  800739:	0f 87 96 00 00 00    	ja     8007d5 <vprintfmt+0x3cc>
+  80073f:	89 c2                	mov    %eax,%edx
+  800741:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800745:	83 c0 08             	add    $0x8,%eax
+  800748:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80074b:	4c 8b 22             	mov    (%rdx),%r12
+  80074e:	eb 17                	jmp    800767 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800750:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800753:	83 f8 2f             	cmp    $0x2f,%eax
+  800756:	77 21                	ja     800779 <vprintfmt+0x370>
+  800758:	89 c2                	mov    %eax,%edx
+  80075a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80075e:	83 c0 08             	add    $0x8,%eax
+  800761:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800764:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800767:	4d 85 e4             	test   %r12,%r12
+  80076a:	78 7a                	js     8007e6 <vprintfmt+0x3dd>
+            num = i;
+  80076c:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80076f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800774:	e9 50 02 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800779:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80077d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800781:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800785:	eb dd                	jmp    800764 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800787:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078a:	83 f8 2f             	cmp    $0x2f,%eax
+  80078d:	77 11                	ja     8007a0 <vprintfmt+0x397>
+  80078f:	89 c2                	mov    %eax,%edx
+  800791:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800795:	83 c0 08             	add    $0x8,%eax
+  800798:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079b:	4c 63 22             	movslq (%rdx),%r12
+  80079e:	eb c7                	jmp    800767 <vprintfmt+0x35e>
+  8007a0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007a4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007a8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ac:	eb ed                	jmp    80079b <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007ae:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007b1:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b4:	77 11                	ja     8007c7 <vprintfmt+0x3be>
+  8007b6:	89 c2                	mov    %eax,%edx
+  8007b8:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007bc:	83 c0 08             	add    $0x8,%eax
+  8007bf:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007c2:	4c 8b 22             	mov    (%rdx),%r12
+  8007c5:	eb a0                	jmp    800767 <vprintfmt+0x35e>
+  8007c7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007cf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d3:	eb ed                	jmp    8007c2 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007d5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007dd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007e1:	e9 65 ff ff ff       	jmp    80074b <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007e6:	4c 89 ee             	mov    %r13,%rsi
+  8007e9:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007ee:	41 ff d6             	call   *%r14
+                i = -i;
+  8007f1:	49 f7 dc             	neg    %r12
+  8007f4:	e9 73 ff ff ff       	jmp    80076c <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8007f9:	40 84 f6             	test   %sil,%sil
+  8007fc:	75 32                	jne    800830 <vprintfmt+0x427>
+    switch (lflag) {
+  8007fe:	85 d2                	test   %edx,%edx
+  800800:	74 5d                	je     80085f <vprintfmt+0x456>
+  800802:	83 fa 01             	cmp    $0x1,%edx
+  800805:	0f 84 82 00 00 00    	je     80088d <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80080b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080e:	83 f8 2f             	cmp    $0x2f,%eax
+  800811:	0f 87 a5 00 00 00    	ja     8008bc <vprintfmt+0x4b3>
+  800817:	89 c2                	mov    %eax,%edx
+  800819:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80081d:	83 c0 08             	add    $0x8,%eax
+  800820:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800823:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800826:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80082b:	e9 99 01 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800830:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800833:	83 f8 2f             	cmp    $0x2f,%eax
+  800836:	77 19                	ja     800851 <vprintfmt+0x448>
+  800838:	89 c2                	mov    %eax,%edx
+  80083a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083e:	83 c0 08             	add    $0x8,%eax
+  800841:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800844:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800847:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80084c:	e9 78 01 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+  800851:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800855:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800859:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80085d:	eb e5                	jmp    800844 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80085f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800862:	83 f8 2f             	cmp    $0x2f,%eax
+  800865:	77 18                	ja     80087f <vprintfmt+0x476>
+  800867:	89 c2                	mov    %eax,%edx
+  800869:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086d:	83 c0 08             	add    $0x8,%eax
+  800870:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800873:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800875:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  80087a:	e9 4a 01 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+  80087f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800883:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800887:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80088b:	eb e6                	jmp    800873 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  80088d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800890:	83 f8 2f             	cmp    $0x2f,%eax
+  800893:	77 19                	ja     8008ae <vprintfmt+0x4a5>
+  800895:	89 c2                	mov    %eax,%edx
+  800897:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80089b:	83 c0 08             	add    $0x8,%eax
+  80089e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008a1:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a4:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008a9:	e9 1b 01 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+  8008ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008ba:	eb e5                	jmp    8008a1 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008bc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c8:	e9 56 ff ff ff       	jmp    800823 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008cd:	40 84 f6             	test   %sil,%sil
+  8008d0:	75 2e                	jne    800900 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008d2:	85 d2                	test   %edx,%edx
+  8008d4:	74 59                	je     80092f <vprintfmt+0x526>
+  8008d6:	83 fa 01             	cmp    $0x1,%edx
+  8008d9:	74 7f                	je     80095a <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008db:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008de:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e1:	0f 87 9f 00 00 00    	ja     800986 <vprintfmt+0x57d>
+  8008e7:	89 c2                	mov    %eax,%edx
+  8008e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ed:	83 c0 08             	add    $0x8,%eax
+  8008f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8008f6:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8008fb:	e9 c9 00 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800900:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800903:	83 f8 2f             	cmp    $0x2f,%eax
+  800906:	77 19                	ja     800921 <vprintfmt+0x518>
+  800908:	89 c2                	mov    %eax,%edx
+  80090a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80090e:	83 c0 08             	add    $0x8,%eax
+  800911:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800914:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800917:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80091c:	e9 a8 00 00 00       	jmp    8009c9 <vprintfmt+0x5c0>
+  800921:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800925:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800929:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80092d:	eb e5                	jmp    800914 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80092f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800932:	83 f8 2f             	cmp    $0x2f,%eax
+  800935:	77 15                	ja     80094c <vprintfmt+0x543>
+  800937:	89 c2                	mov    %eax,%edx
+  800939:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093d:	83 c0 08             	add    $0x8,%eax
+  800940:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800943:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800945:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80094a:	eb 7d                	jmp    8009c9 <vprintfmt+0x5c0>
+  80094c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800950:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800954:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800958:	eb e9                	jmp    800943 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	77 16                	ja     800978 <vprintfmt+0x56f>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800971:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800976:	eb 51                	jmp    8009c9 <vprintfmt+0x5c0>
+  800978:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800980:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800984:	eb e8                	jmp    80096e <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800986:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80098a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800992:	e9 5c ff ff ff       	jmp    8008f3 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800997:	4c 89 ee             	mov    %r13,%rsi
+  80099a:	bf 30 00 00 00       	mov    $0x30,%edi
+  80099f:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009a2:	4c 89 ee             	mov    %r13,%rsi
+  8009a5:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009aa:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ad:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b0:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b3:	77 47                	ja     8009fc <vprintfmt+0x5f3>
+  8009b5:	89 c2                	mov    %eax,%edx
+  8009b7:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009bb:	83 c0 08             	add    $0x8,%eax
+  8009be:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c1:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009c4:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8009cd:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009d1:	0f 94 c0             	sete   %al
+  8009d4:	0f b6 c0             	movzbl %al,%eax
+  8009d7:	50                   	push   %rax
+  8009d8:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009dd:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009e1:	4c 89 ee             	mov    %r13,%rsi
+  8009e4:	4c 89 f7             	mov    %r14,%rdi
+  8009e7:	48 b8 fe 02 80 00 00 	movabs $0x8002fe,%rax
+  8009ee:	00 00 00 
+  8009f1:	ff d0                	call   *%rax
+            break;
+  8009f3:	48 83 c4 10          	add    $0x10,%rsp
+  8009f7:	e9 3e fa ff ff       	jmp    80043a <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  8009fc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a00:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a04:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a08:	eb b7                	jmp    8009c1 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a0a:	40 84 f6             	test   %sil,%sil
+  800a0d:	75 2b                	jne    800a3a <vprintfmt+0x631>
+    switch (lflag) {
+  800a0f:	85 d2                	test   %edx,%edx
+  800a11:	74 56                	je     800a69 <vprintfmt+0x660>
+  800a13:	83 fa 01             	cmp    $0x1,%edx
+  800a16:	74 7f                	je     800a97 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a18:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a1b:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1e:	0f 87 a2 00 00 00    	ja     800ac6 <vprintfmt+0x6bd>
+  800a24:	89 c2                	mov    %eax,%edx
+  800a26:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a2a:	83 c0 08             	add    $0x8,%eax
+  800a2d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a30:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a33:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a38:	eb 8f                	jmp    8009c9 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a3d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a40:	77 19                	ja     800a5b <vprintfmt+0x652>
+  800a42:	89 c2                	mov    %eax,%edx
+  800a44:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a48:	83 c0 08             	add    $0x8,%eax
+  800a4b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a4e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a51:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a56:	e9 6e ff ff ff       	jmp    8009c9 <vprintfmt+0x5c0>
+  800a5b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a63:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a67:	eb e5                	jmp    800a4e <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a69:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6c:	83 f8 2f             	cmp    $0x2f,%eax
+  800a6f:	77 18                	ja     800a89 <vprintfmt+0x680>
+  800a71:	89 c2                	mov    %eax,%edx
+  800a73:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a77:	83 c0 08             	add    $0x8,%eax
+  800a7a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a7d:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a7f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a84:	e9 40 ff ff ff       	jmp    8009c9 <vprintfmt+0x5c0>
+  800a89:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a8d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a91:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a95:	eb e6                	jmp    800a7d <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800a97:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a9a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9d:	77 19                	ja     800ab8 <vprintfmt+0x6af>
+  800a9f:	89 c2                	mov    %eax,%edx
+  800aa1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa5:	83 c0 08             	add    $0x8,%eax
+  800aa8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aab:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aae:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800ab3:	e9 11 ff ff ff       	jmp    8009c9 <vprintfmt+0x5c0>
+  800ab8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800abc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ac0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac4:	eb e5                	jmp    800aab <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ac6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800aca:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ace:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad2:	e9 59 ff ff ff       	jmp    800a30 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ad7:	4c 89 ee             	mov    %r13,%rsi
+  800ada:	bf 25 00 00 00       	mov    $0x25,%edi
+  800adf:	41 ff d6             	call   *%r14
+            break;
+  800ae2:	e9 53 f9 ff ff       	jmp    80043a <vprintfmt+0x31>
+            putch('%', put_arg);
+  800ae7:	4c 89 ee             	mov    %r13,%rsi
+  800aea:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aef:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800af2:	48 83 eb 01          	sub    $0x1,%rbx
+  800af6:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800afa:	75 f6                	jne    800af2 <vprintfmt+0x6e9>
+  800afc:	e9 39 f9 ff ff       	jmp    80043a <vprintfmt+0x31>
+}
+  800b01:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b05:	5b                   	pop    %rbx
+  800b06:	41 5c                	pop    %r12
+  800b08:	41 5d                	pop    %r13
+  800b0a:	41 5e                	pop    %r14
+  800b0c:	41 5f                	pop    %r15
+  800b0e:	5d                   	pop    %rbp
+  800b0f:	c3                   	ret
+
+0000000000800b10 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b10:	55                   	push   %rbp
+  800b11:	48 89 e5             	mov    %rsp,%rbp
+  800b14:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b18:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b1c:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b21:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b25:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b2c:	48 85 ff             	test   %rdi,%rdi
+  800b2f:	74 2b                	je     800b5c <vsnprintf+0x4c>
+  800b31:	48 85 f6             	test   %rsi,%rsi
+  800b34:	74 26                	je     800b5c <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b36:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b3a:	48 bf b4 03 80 00 00 	movabs $0x8003b4,%rdi
+  800b41:	00 00 00 
+  800b44:	48 b8 09 04 80 00 00 	movabs $0x800409,%rax
+  800b4b:	00 00 00 
+  800b4e:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b50:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b54:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b57:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b5a:	c9                   	leave
+  800b5b:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b5c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b61:	eb f7                	jmp    800b5a <vsnprintf+0x4a>
+
+0000000000800b63 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b63:	55                   	push   %rbp
+  800b64:	48 89 e5             	mov    %rsp,%rbp
+  800b67:	48 83 ec 50          	sub    $0x50,%rsp
+  800b6b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b6f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b73:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b77:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b7e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b82:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b86:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b8e:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b92:	48 b8 10 0b 80 00 00 	movabs $0x800b10,%rax
+  800b99:	00 00 00 
+  800b9c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800b9e:	c9                   	leave
+  800b9f:	c3                   	ret
+
+0000000000800ba0 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800ba0:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800ba3:	74 10                	je     800bb5 <strlen+0x15>
+    size_t n = 0;
+  800ba5:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800baa:	48 83 c0 01          	add    $0x1,%rax
+  800bae:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bb2:	75 f6                	jne    800baa <strlen+0xa>
+  800bb4:	c3                   	ret
+    size_t n = 0;
+  800bb5:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bba:	c3                   	ret
+
+0000000000800bbb <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bbb:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bbe:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bc3:	48 85 f6             	test   %rsi,%rsi
+  800bc6:	74 11                	je     800bd9 <strnlen+0x1e>
+  800bc8:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bcc:	74 0c                	je     800bda <strnlen+0x1f>
+  800bce:	48 83 c2 01          	add    $0x1,%rdx
+  800bd2:	48 39 d0             	cmp    %rdx,%rax
+  800bd5:	75 f1                	jne    800bc8 <strnlen+0xd>
+  800bd7:	eb 04                	jmp    800bdd <strnlen+0x22>
+  800bd9:	c3                   	ret
+  800bda:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800bdd:	c3                   	ret
+
+0000000000800bde <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bde:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800be1:	ba 00 00 00 00       	mov    $0x0,%edx
+  800be6:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bea:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bed:	48 83 c2 01          	add    $0x1,%rdx
+  800bf1:	84 c9                	test   %cl,%cl
+  800bf3:	75 f1                	jne    800be6 <strcpy+0x8>
+        ;
+    return res;
+}
+  800bf5:	c3                   	ret
+
+0000000000800bf6 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800bf6:	55                   	push   %rbp
+  800bf7:	48 89 e5             	mov    %rsp,%rbp
+  800bfa:	41 54                	push   %r12
+  800bfc:	53                   	push   %rbx
+  800bfd:	48 89 fb             	mov    %rdi,%rbx
+  800c00:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c03:	48 b8 a0 0b 80 00 00 	movabs $0x800ba0,%rax
+  800c0a:	00 00 00 
+  800c0d:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c0f:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c13:	4c 89 e6             	mov    %r12,%rsi
+  800c16:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  800c1d:	00 00 00 
+  800c20:	ff d0                	call   *%rax
+    return dst;
+}
+  800c22:	48 89 d8             	mov    %rbx,%rax
+  800c25:	5b                   	pop    %rbx
+  800c26:	41 5c                	pop    %r12
+  800c28:	5d                   	pop    %rbp
+  800c29:	c3                   	ret
+
+0000000000800c2a <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c2a:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c2d:	48 85 d2             	test   %rdx,%rdx
+  800c30:	74 1f                	je     800c51 <strncpy+0x27>
+  800c32:	48 01 fa             	add    %rdi,%rdx
+  800c35:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c38:	48 83 c1 01          	add    $0x1,%rcx
+  800c3c:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c40:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c44:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c48:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c4c:	48 39 ca             	cmp    %rcx,%rdx
+  800c4f:	75 e7                	jne    800c38 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c51:	c3                   	ret
+
+0000000000800c52 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c52:	48 89 f8             	mov    %rdi,%rax
+  800c55:	48 85 d2             	test   %rdx,%rdx
+  800c58:	74 24                	je     800c7e <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c5a:	48 83 ea 01          	sub    $0x1,%rdx
+  800c5e:	74 1b                	je     800c7b <strlcpy+0x29>
+  800c60:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c64:	0f b6 16             	movzbl (%rsi),%edx
+  800c67:	84 d2                	test   %dl,%dl
+  800c69:	74 10                	je     800c7b <strlcpy+0x29>
+            *dst++ = *src++;
+  800c6b:	48 83 c6 01          	add    $0x1,%rsi
+  800c6f:	48 83 c0 01          	add    $0x1,%rax
+  800c73:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c76:	48 39 c8             	cmp    %rcx,%rax
+  800c79:	75 e9                	jne    800c64 <strlcpy+0x12>
+        *dst = '\0';
+  800c7b:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c7e:	48 29 f8             	sub    %rdi,%rax
+}
+  800c81:	c3                   	ret
+
+0000000000800c82 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c82:	0f b6 07             	movzbl (%rdi),%eax
+  800c85:	84 c0                	test   %al,%al
+  800c87:	74 13                	je     800c9c <strcmp+0x1a>
+  800c89:	38 06                	cmp    %al,(%rsi)
+  800c8b:	75 0f                	jne    800c9c <strcmp+0x1a>
+  800c8d:	48 83 c7 01          	add    $0x1,%rdi
+  800c91:	48 83 c6 01          	add    $0x1,%rsi
+  800c95:	0f b6 07             	movzbl (%rdi),%eax
+  800c98:	84 c0                	test   %al,%al
+  800c9a:	75 ed                	jne    800c89 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800c9c:	0f b6 c0             	movzbl %al,%eax
+  800c9f:	0f b6 16             	movzbl (%rsi),%edx
+  800ca2:	29 d0                	sub    %edx,%eax
+}
+  800ca4:	c3                   	ret
+
+0000000000800ca5 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800ca5:	48 85 d2             	test   %rdx,%rdx
+  800ca8:	74 1f                	je     800cc9 <strncmp+0x24>
+  800caa:	0f b6 07             	movzbl (%rdi),%eax
+  800cad:	84 c0                	test   %al,%al
+  800caf:	74 1e                	je     800ccf <strncmp+0x2a>
+  800cb1:	3a 06                	cmp    (%rsi),%al
+  800cb3:	75 1a                	jne    800ccf <strncmp+0x2a>
+  800cb5:	48 83 c7 01          	add    $0x1,%rdi
+  800cb9:	48 83 c6 01          	add    $0x1,%rsi
+  800cbd:	48 83 ea 01          	sub    $0x1,%rdx
+  800cc1:	75 e7                	jne    800caa <strncmp+0x5>
+
+    if (!n) return 0;
+  800cc3:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cc8:	c3                   	ret
+  800cc9:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cce:	c3                   	ret
+  800ccf:	48 85 d2             	test   %rdx,%rdx
+  800cd2:	74 09                	je     800cdd <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cd4:	0f b6 07             	movzbl (%rdi),%eax
+  800cd7:	0f b6 16             	movzbl (%rsi),%edx
+  800cda:	29 d0                	sub    %edx,%eax
+  800cdc:	c3                   	ret
+    if (!n) return 0;
+  800cdd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800ce2:	c3                   	ret
+
+0000000000800ce3 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ce3:	0f b6 17             	movzbl (%rdi),%edx
+  800ce6:	84 d2                	test   %dl,%dl
+  800ce8:	74 18                	je     800d02 <strchr+0x1f>
+        if (*str == c) {
+  800cea:	0f be d2             	movsbl %dl,%edx
+  800ced:	39 f2                	cmp    %esi,%edx
+  800cef:	74 17                	je     800d08 <strchr+0x25>
+    for (; *str; str++) {
+  800cf1:	48 83 c7 01          	add    $0x1,%rdi
+  800cf5:	0f b6 17             	movzbl (%rdi),%edx
+  800cf8:	84 d2                	test   %dl,%dl
+  800cfa:	75 ee                	jne    800cea <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800cfc:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d01:	c3                   	ret
+  800d02:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d07:	c3                   	ret
+  800d08:	48 89 f8             	mov    %rdi,%rax
+}
+  800d0b:	c3                   	ret
+
+0000000000800d0c <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d0c:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d0f:	0f b6 17             	movzbl (%rdi),%edx
+  800d12:	84 d2                	test   %dl,%dl
+  800d14:	74 13                	je     800d29 <strfind+0x1d>
+  800d16:	0f be d2             	movsbl %dl,%edx
+  800d19:	39 f2                	cmp    %esi,%edx
+  800d1b:	74 0b                	je     800d28 <strfind+0x1c>
+  800d1d:	48 83 c0 01          	add    $0x1,%rax
+  800d21:	0f b6 10             	movzbl (%rax),%edx
+  800d24:	84 d2                	test   %dl,%dl
+  800d26:	75 ee                	jne    800d16 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d28:	c3                   	ret
+  800d29:	c3                   	ret
+
+0000000000800d2a <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d2a:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d2d:	48 89 f8             	mov    %rdi,%rax
+  800d30:	48 f7 d8             	neg    %rax
+  800d33:	83 e0 07             	and    $0x7,%eax
+  800d36:	49 89 d1             	mov    %rdx,%r9
+  800d39:	49 29 c1             	sub    %rax,%r9
+  800d3c:	78 36                	js     800d74 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d3e:	40 0f b6 c6          	movzbl %sil,%eax
+  800d42:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d49:	01 01 01 
+  800d4c:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d50:	40 f6 c7 07          	test   $0x7,%dil
+  800d54:	75 38                	jne    800d8e <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d56:	4c 89 c9             	mov    %r9,%rcx
+  800d59:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d5d:	74 0c                	je     800d6b <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d5f:	fc                   	cld
+  800d60:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d63:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d67:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d6b:	4d 85 c9             	test   %r9,%r9
+  800d6e:	75 45                	jne    800db5 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d70:	4c 89 c0             	mov    %r8,%rax
+  800d73:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d74:	48 85 d2             	test   %rdx,%rdx
+  800d77:	74 f7                	je     800d70 <memset+0x46>
+  800d79:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d7c:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d7f:	48 83 c0 01          	add    $0x1,%rax
+  800d83:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d87:	48 39 c2             	cmp    %rax,%rdx
+  800d8a:	75 f3                	jne    800d7f <memset+0x55>
+  800d8c:	eb e2                	jmp    800d70 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d8e:	40 f6 c7 01          	test   $0x1,%dil
+  800d92:	74 06                	je     800d9a <memset+0x70>
+  800d94:	88 07                	mov    %al,(%rdi)
+  800d96:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800d9a:	40 f6 c7 02          	test   $0x2,%dil
+  800d9e:	74 07                	je     800da7 <memset+0x7d>
+  800da0:	66 89 07             	mov    %ax,(%rdi)
+  800da3:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800da7:	40 f6 c7 04          	test   $0x4,%dil
+  800dab:	74 a9                	je     800d56 <memset+0x2c>
+  800dad:	89 07                	mov    %eax,(%rdi)
+  800daf:	48 83 c7 04          	add    $0x4,%rdi
+  800db3:	eb a1                	jmp    800d56 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db5:	41 f6 c1 04          	test   $0x4,%r9b
+  800db9:	74 06                	je     800dc1 <memset+0x97>
+  800dbb:	89 07                	mov    %eax,(%rdi)
+  800dbd:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dc1:	41 f6 c1 02          	test   $0x2,%r9b
+  800dc5:	74 07                	je     800dce <memset+0xa4>
+  800dc7:	66 89 07             	mov    %ax,(%rdi)
+  800dca:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dce:	41 f6 c1 01          	test   $0x1,%r9b
+  800dd2:	74 9c                	je     800d70 <memset+0x46>
+  800dd4:	88 07                	mov    %al,(%rdi)
+  800dd6:	eb 98                	jmp    800d70 <memset+0x46>
+
+0000000000800dd8 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800dd8:	48 89 f8             	mov    %rdi,%rax
+  800ddb:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dde:	48 39 fe             	cmp    %rdi,%rsi
+  800de1:	73 3b                	jae    800e1e <memmove+0x46>
+  800de3:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800de7:	48 39 d7             	cmp    %rdx,%rdi
+  800dea:	73 32                	jae    800e1e <memmove+0x46>
+        s += n;
+        d += n;
+  800dec:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800df0:	48 89 d6             	mov    %rdx,%rsi
+  800df3:	48 09 fe             	or     %rdi,%rsi
+  800df6:	48 09 ce             	or     %rcx,%rsi
+  800df9:	40 f6 c6 07          	test   $0x7,%sil
+  800dfd:	75 12                	jne    800e11 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800dff:	48 83 ef 08          	sub    $0x8,%rdi
+  800e03:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e07:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e0b:	fd                   	std
+  800e0c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e0f:	fc                   	cld
+  800e10:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e11:	48 83 ef 01          	sub    $0x1,%rdi
+  800e15:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e19:	fd                   	std
+  800e1a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e1c:	eb f1                	jmp    800e0f <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e1e:	48 89 f2             	mov    %rsi,%rdx
+  800e21:	48 09 c2             	or     %rax,%rdx
+  800e24:	48 09 ca             	or     %rcx,%rdx
+  800e27:	f6 c2 07             	test   $0x7,%dl
+  800e2a:	75 0c                	jne    800e38 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e2c:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e30:	48 89 c7             	mov    %rax,%rdi
+  800e33:	fc                   	cld
+  800e34:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e37:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e38:	48 89 c7             	mov    %rax,%rdi
+  800e3b:	fc                   	cld
+  800e3c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e3e:	c3                   	ret
+
+0000000000800e3f <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e3f:	55                   	push   %rbp
+  800e40:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e43:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  800e4a:	00 00 00 
+  800e4d:	ff d0                	call   *%rax
+}
+  800e4f:	5d                   	pop    %rbp
+  800e50:	c3                   	ret
+
+0000000000800e51 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e51:	55                   	push   %rbp
+  800e52:	48 89 e5             	mov    %rsp,%rbp
+  800e55:	41 57                	push   %r15
+  800e57:	41 56                	push   %r14
+  800e59:	41 55                	push   %r13
+  800e5b:	41 54                	push   %r12
+  800e5d:	53                   	push   %rbx
+  800e5e:	48 83 ec 08          	sub    $0x8,%rsp
+  800e62:	49 89 fe             	mov    %rdi,%r14
+  800e65:	49 89 f7             	mov    %rsi,%r15
+  800e68:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e6b:	48 89 f7             	mov    %rsi,%rdi
+  800e6e:	48 b8 a0 0b 80 00 00 	movabs $0x800ba0,%rax
+  800e75:	00 00 00 
+  800e78:	ff d0                	call   *%rax
+  800e7a:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e7d:	48 89 de             	mov    %rbx,%rsi
+  800e80:	4c 89 f7             	mov    %r14,%rdi
+  800e83:	48 b8 bb 0b 80 00 00 	movabs $0x800bbb,%rax
+  800e8a:	00 00 00 
+  800e8d:	ff d0                	call   *%rax
+  800e8f:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e92:	48 39 c3             	cmp    %rax,%rbx
+  800e95:	74 36                	je     800ecd <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800e97:	48 89 d8             	mov    %rbx,%rax
+  800e9a:	4c 29 e8             	sub    %r13,%rax
+  800e9d:	49 39 c4             	cmp    %rax,%r12
+  800ea0:	73 31                	jae    800ed3 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ea2:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ea7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eab:	4c 89 fe             	mov    %r15,%rsi
+  800eae:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  800eb5:	00 00 00 
+  800eb8:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800eba:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800ebe:	48 83 c4 08          	add    $0x8,%rsp
+  800ec2:	5b                   	pop    %rbx
+  800ec3:	41 5c                	pop    %r12
+  800ec5:	41 5d                	pop    %r13
+  800ec7:	41 5e                	pop    %r14
+  800ec9:	41 5f                	pop    %r15
+  800ecb:	5d                   	pop    %rbp
+  800ecc:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ecd:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800ed1:	eb eb                	jmp    800ebe <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800ed3:	48 83 eb 01          	sub    $0x1,%rbx
+  800ed7:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800edb:	48 89 da             	mov    %rbx,%rdx
+  800ede:	4c 89 fe             	mov    %r15,%rsi
+  800ee1:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  800ee8:	00 00 00 
+  800eeb:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800eed:	49 01 de             	add    %rbx,%r14
+  800ef0:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800ef5:	eb c3                	jmp    800eba <strlcat+0x69>
+
+0000000000800ef7 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800ef7:	48 85 d2             	test   %rdx,%rdx
+  800efa:	74 2d                	je     800f29 <memcmp+0x32>
+  800efc:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f01:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f05:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f0a:	44 38 c1             	cmp    %r8b,%cl
+  800f0d:	75 0f                	jne    800f1e <memcmp+0x27>
+    while (n-- > 0) {
+  800f0f:	48 83 c0 01          	add    $0x1,%rax
+  800f13:	48 39 c2             	cmp    %rax,%rdx
+  800f16:	75 e9                	jne    800f01 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f18:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f1d:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f1e:	0f b6 c1             	movzbl %cl,%eax
+  800f21:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f25:	44 29 c0             	sub    %r8d,%eax
+  800f28:	c3                   	ret
+    return 0;
+  800f29:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f2e:	c3                   	ret
+
+0000000000800f2f <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f2f:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f33:	48 39 c7             	cmp    %rax,%rdi
+  800f36:	73 0f                	jae    800f47 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f38:	40 38 37             	cmp    %sil,(%rdi)
+  800f3b:	74 0e                	je     800f4b <memfind+0x1c>
+    for (; src < end; src++) {
+  800f3d:	48 83 c7 01          	add    $0x1,%rdi
+  800f41:	48 39 f8             	cmp    %rdi,%rax
+  800f44:	75 f2                	jne    800f38 <memfind+0x9>
+  800f46:	c3                   	ret
+  800f47:	48 89 f8             	mov    %rdi,%rax
+  800f4a:	c3                   	ret
+  800f4b:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f4e:	c3                   	ret
+
+0000000000800f4f <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f4f:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f52:	0f b6 37             	movzbl (%rdi),%esi
+  800f55:	40 80 fe 20          	cmp    $0x20,%sil
+  800f59:	74 06                	je     800f61 <strtol+0x12>
+  800f5b:	40 80 fe 09          	cmp    $0x9,%sil
+  800f5f:	75 13                	jne    800f74 <strtol+0x25>
+  800f61:	48 83 c7 01          	add    $0x1,%rdi
+  800f65:	0f b6 37             	movzbl (%rdi),%esi
+  800f68:	40 80 fe 20          	cmp    $0x20,%sil
+  800f6c:	74 f3                	je     800f61 <strtol+0x12>
+  800f6e:	40 80 fe 09          	cmp    $0x9,%sil
+  800f72:	74 ed                	je     800f61 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f74:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f77:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f7a:	3c 01                	cmp    $0x1,%al
+  800f7c:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f80:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f86:	75 0f                	jne    800f97 <strtol+0x48>
+  800f88:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f8b:	74 14                	je     800fa1 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f8d:	85 d2                	test   %edx,%edx
+  800f8f:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800f94:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800f97:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800f9c:	4c 63 ca             	movslq %edx,%r9
+  800f9f:	eb 36                	jmp    800fd7 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fa1:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fa5:	74 0f                	je     800fb6 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fa7:	85 d2                	test   %edx,%edx
+  800fa9:	75 ec                	jne    800f97 <strtol+0x48>
+        s++;
+  800fab:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800faf:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fb4:	eb e1                	jmp    800f97 <strtol+0x48>
+        s += 2;
+  800fb6:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fba:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fbf:	eb d6                	jmp    800f97 <strtol+0x48>
+            dig -= '0';
+  800fc1:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fc4:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fc8:	41 39 d0             	cmp    %edx,%r8d
+  800fcb:	7d 21                	jge    800fee <strtol+0x9f>
+        val = val * base + dig;
+  800fcd:	49 0f af c1          	imul   %r9,%rax
+  800fd1:	0f b6 c9             	movzbl %cl,%ecx
+  800fd4:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fd7:	48 83 c7 01          	add    $0x1,%rdi
+  800fdb:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800fdf:	80 f9 39             	cmp    $0x39,%cl
+  800fe2:	76 dd                	jbe    800fc1 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800fe4:	80 f9 7b             	cmp    $0x7b,%cl
+  800fe7:	77 05                	ja     800fee <strtol+0x9f>
+            dig -= 'a' - 10;
+  800fe9:	83 e9 57             	sub    $0x57,%ecx
+  800fec:	eb d6                	jmp    800fc4 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800fee:	4d 85 d2             	test   %r10,%r10
+  800ff1:	74 03                	je     800ff6 <strtol+0xa7>
+  800ff3:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  800ff6:	48 89 c2             	mov    %rax,%rdx
+  800ff9:	48 f7 da             	neg    %rdx
+  800ffc:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801000:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801004:	c3                   	ret
+
+0000000000801005 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801005:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80100a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80100f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801015:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80101b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801021:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801023:	c3                   	ret
+
+0000000000801024 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801024:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801029:	bf 00 00 00 00       	mov    $0x0,%edi
+  80102e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801033:	ba 00 00 00 00       	mov    $0x0,%edx
+  801038:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80103e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801044:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80104a:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80104c:	c3                   	ret
+
+000000000080104d <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80104d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801050:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801055:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80105a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80105f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801065:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80106b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801071:	0f 05                	syscall
+    if (check && ret > 0) {
+  801073:	48 85 c0             	test   %rax,%rax
+  801076:	7f 01                	jg     801079 <sys_env_destroy+0x2c>
+}
+  801078:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801079:	55                   	push   %rbp
+  80107a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80107d:	49 89 c0             	mov    %rax,%r8
+  801080:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801085:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  80108c:	00 00 00 
+  80108f:	be 29 00 00 00       	mov    $0x29,%esi
+  801094:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  80109b:	00 00 00 
+  80109e:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010a3:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  8010aa:	00 00 00 
+  8010ad:	41 ff d1             	call   *%r9
+
+00000000008010b0 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010b0:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010b5:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ba:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010c4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010ca:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010d6:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010d8:	c3                   	ret
+
+00000000008010d9 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010d9:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010e3:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010e8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010ed:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010f3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010f9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010ff:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801101:	c3                   	ret
+
+0000000000801102 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801102:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801107:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80110e:	00 00 00 
+  801111:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801117:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80111d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801123:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801125:	c3                   	ret
+
+0000000000801126 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801126:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801129:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80112e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801134:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80113a:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80113c:	c3                   	ret
+
+000000000080113d <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80113d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801140:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801145:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801148:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80114e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801154:	0f 05                	syscall
+    if (check && ret > 0) {
+  801156:	48 85 c0             	test   %rax,%rax
+  801159:	7f 01                	jg     80115c <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  80115b:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  80115c:	55                   	push   %rbp
+  80115d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801160:	49 89 c0             	mov    %rax,%r8
+  801163:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801168:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  80116f:	00 00 00 
+  801172:	be 29 00 00 00       	mov    $0x29,%esi
+  801177:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  80117e:	00 00 00 
+  801181:	b8 00 00 00 00       	mov    $0x0,%eax
+  801186:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  80118d:	00 00 00 
+  801190:	41 ff d1             	call   *%r9
+
+0000000000801193 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801193:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  801196:	48 63 d2             	movslq %edx,%rdx
+  801199:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80119c:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011a1:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011a4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011a6:	48 85 c0             	test   %rax,%rax
+  8011a9:	7f 01                	jg     8011ac <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011ab:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011ac:	55                   	push   %rbp
+  8011ad:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b0:	49 89 c0             	mov    %rax,%r8
+  8011b3:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011b8:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  8011bf:	00 00 00 
+  8011c2:	be 29 00 00 00       	mov    $0x29,%esi
+  8011c7:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  8011ce:	00 00 00 
+  8011d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d6:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  8011dd:	00 00 00 
+  8011e0:	41 ff d1             	call   *%r9
+
+00000000008011e3 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011e3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011e6:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011eb:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011f1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011fd:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011ff:	48 85 c0             	test   %rax,%rax
+  801202:	7f 01                	jg     801205 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801204:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801205:	55                   	push   %rbp
+  801206:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801209:	49 89 c0             	mov    %rax,%r8
+  80120c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801211:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  801218:	00 00 00 
+  80121b:	be 29 00 00 00       	mov    $0x29,%esi
+  801220:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  801227:	00 00 00 
+  80122a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80122f:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  801236:	00 00 00 
+  801239:	41 ff d1             	call   *%r9
+
+000000000080123c <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80123c:	48 63 f6             	movslq %esi,%rsi
+  80123f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801242:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801247:	ba 00 00 00 00       	mov    $0x0,%edx
+  80124c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801252:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801258:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80125e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801260:	48 85 c0             	test   %rax,%rax
+  801263:	7f 01                	jg     801266 <sys_env_set_status+0x2a>
+}
+  801265:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801266:	55                   	push   %rbp
+  801267:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80126a:	49 89 c0             	mov    %rax,%r8
+  80126d:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801272:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  801279:	00 00 00 
+  80127c:	be 29 00 00 00       	mov    $0x29,%esi
+  801281:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  801288:	00 00 00 
+  80128b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801290:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  801297:	00 00 00 
+  80129a:	41 ff d1             	call   *%r9
+
+000000000080129d <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  80129d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012a0:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012aa:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012b0:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b6:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012bc:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012be:	48 85 c0             	test   %rax,%rax
+  8012c1:	7f 01                	jg     8012c4 <sys_env_set_trapframe+0x27>
+}
+  8012c3:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8012c4:	55                   	push   %rbp
+  8012c5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c8:	49 89 c0             	mov    %rax,%r8
+  8012cb:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8012d0:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  8012d7:	00 00 00 
+  8012da:	be 29 00 00 00       	mov    $0x29,%esi
+  8012df:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  8012e6:	00 00 00 
+  8012e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ee:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  8012f5:	00 00 00 
+  8012f8:	41 ff d1             	call   *%r9
+
+00000000008012fb <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8012fb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012fe:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801303:	ba 00 00 00 00       	mov    $0x0,%edx
+  801308:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80130e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801314:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80131a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80131c:	48 85 c0             	test   %rax,%rax
+  80131f:	7f 01                	jg     801322 <sys_env_set_pgfault_upcall+0x27>
+}
+  801321:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801322:	55                   	push   %rbp
+  801323:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801326:	49 89 c0             	mov    %rax,%r8
+  801329:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80132e:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  801335:	00 00 00 
+  801338:	be 29 00 00 00       	mov    $0x29,%esi
+  80133d:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  801344:	00 00 00 
+  801347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80134c:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  801353:	00 00 00 
+  801356:	41 ff d1             	call   *%r9
+
+0000000000801359 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801359:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80135c:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80135f:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801364:	4d 63 c0             	movslq %r8d,%r8
+  801367:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80136d:	0f 05                	syscall
+}
+  80136f:	c3                   	ret
+
+0000000000801370 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801370:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801373:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80137b:	4d 63 c0             	movslq %r8d,%r8
+  80137e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801384:	0f 05                	syscall
+}
+  801386:	c3                   	ret
+
+0000000000801387 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801387:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80138c:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80138f:	45 89 c0             	mov    %r8d,%r8d
+  801392:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801398:	0f 05                	syscall
+    if (check && ret > 0) {
+  80139a:	48 85 c0             	test   %rax,%rax
+  80139d:	7f 01                	jg     8013a0 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  80139f:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013a0:	55                   	push   %rbp
+  8013a1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013a4:	49 89 c0             	mov    %rax,%r8
+  8013a7:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013ac:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  8013b3:	00 00 00 
+  8013b6:	be 29 00 00 00       	mov    $0x29,%esi
+  8013bb:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  8013c2:	00 00 00 
+  8013c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013ca:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  8013d1:	00 00 00 
+  8013d4:	41 ff d1             	call   *%r9
+
+00000000008013d7 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8013d7:	55                   	push   %rbp
+  8013d8:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8013db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e1:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013eb:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  8013f2:	00 00 00 
+  8013f5:	ff d0                	call   *%rax
+}
+  8013f7:	5d                   	pop    %rbp
+  8013f8:	c3                   	ret
+
+00000000008013f9 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013f9:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013fe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801403:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801408:	ba 00 00 00 00       	mov    $0x0,%edx
+  80140d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801413:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801419:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80141f:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801421:	c3                   	ret
+
+0000000000801422 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801422:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801427:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80142c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801431:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801437:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80143d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801443:	0f 05                	syscall
+    if (check && ret > 0) {
+  801445:	48 85 c0             	test   %rax,%rax
+  801448:	7f 01                	jg     80144b <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80144a:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80144b:	55                   	push   %rbp
+  80144c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80144f:	49 89 c0             	mov    %rax,%r8
+  801452:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801457:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  80145e:	00 00 00 
+  801461:	be 29 00 00 00       	mov    $0x29,%esi
+  801466:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  80146d:	00 00 00 
+  801470:	b8 00 00 00 00       	mov    $0x0,%eax
+  801475:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  80147c:	00 00 00 
+  80147f:	41 ff d1             	call   *%r9
+
+0000000000801482 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801482:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801487:	bf 00 00 00 00       	mov    $0x0,%edi
+  80148c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801491:	ba 00 00 00 00       	mov    $0x0,%edx
+  801496:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80149c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014a2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014a8:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014aa:	c3                   	ret
+
+00000000008014ab <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8014ab:	89 d2                	mov    %edx,%edx
+  8014ad:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8014af:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b4:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ba:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014c0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c6:	0f 05                	syscall
+}
+  8014c8:	c3                   	ret
+
+00000000008014c9 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8014c9:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014cc:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014d1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014d6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014dc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014e8:	0f 05                	syscall
+}
+  8014ea:	c3                   	ret
+
+00000000008014eb <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8014eb:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ee:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014f3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014fe:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801504:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80150a:	0f 05                	syscall
+}
+  80150c:	c3                   	ret
+
+000000000080150d <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80150d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801510:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801515:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80151a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80151f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801525:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80152b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801531:	0f 05                	syscall
+    if (check && ret > 0) {
+  801533:	48 85 c0             	test   %rax,%rax
+  801536:	7f 01                	jg     801539 <sys_irq_ack+0x2c>
+}
+  801538:	c3                   	ret
+sys_irq_ack(int irq) {
+  801539:	55                   	push   %rbp
+  80153a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80153d:	49 89 c0             	mov    %rax,%r8
+  801540:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801545:	48 ba 38 4e 80 00 00 	movabs $0x804e38,%rdx
+  80154c:	00 00 00 
+  80154f:	be 29 00 00 00       	mov    $0x29,%esi
+  801554:	48 bf 57 4e 80 00 00 	movabs $0x804e57,%rdi
+  80155b:	00 00 00 
+  80155e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801563:	49 b9 42 45 80 00 00 	movabs $0x804542,%r9
+  80156a:	00 00 00 
+  80156d:	41 ff d1             	call   *%r9
+
+0000000000801570 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801570:	55                   	push   %rbp
+  801571:	48 89 e5             	mov    %rsp,%rbp
+  801574:	41 54                	push   %r12
+  801576:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801577:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  80157e:	00 00 00 
+  801581:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801583:	b8 08 00 00 00       	mov    $0x8,%eax
+  801588:	0f 05                	syscall
+  80158a:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  80158d:	85 c0                	test   %eax,%eax
+  80158f:	78 7e                	js     80160f <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801591:	0f 84 80 00 00 00    	je     801617 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  801597:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  80159d:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015a4:	00 00 00 
+  8015a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015ac:	89 c2                	mov    %eax,%edx
+  8015ae:	be 00 00 00 00       	mov    $0x0,%esi
+  8015b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015b8:	48 b8 93 11 80 00 00 	movabs $0x801193,%rax
+  8015bf:	00 00 00 
+  8015c2:	ff d0                	call   *%rax
+  8015c4:	85 c0                	test   %eax,%eax
+  8015c6:	0f 88 86 00 00 00    	js     801652 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8015cc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015d3:	00 00 00 
+  8015d6:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8015dd:	44 89 e7             	mov    %r12d,%edi
+  8015e0:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  8015e7:	00 00 00 
+  8015ea:	ff d0                	call   *%rax
+  8015ec:	85 c0                	test   %eax,%eax
+  8015ee:	78 6a                	js     80165a <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8015f0:	be 02 00 00 00       	mov    $0x2,%esi
+  8015f5:	44 89 e7             	mov    %r12d,%edi
+  8015f8:	48 b8 3c 12 80 00 00 	movabs $0x80123c,%rax
+  8015ff:	00 00 00 
+  801602:	ff d0                	call   *%rax
+		return -1;
+  801604:	85 c0                	test   %eax,%eax
+  801606:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80160b:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  80160f:	44 89 e0             	mov    %r12d,%eax
+  801612:	5b                   	pop    %rbx
+  801613:	41 5c                	pop    %r12
+  801615:	5d                   	pop    %rbp
+  801616:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801617:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  80161e:	00 00 00 
+  801621:	ff d0                	call   *%rax
+  801623:	89 c2                	mov    %eax,%edx
+  801625:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80162b:	48 89 d0             	mov    %rdx,%rax
+  80162e:	48 c1 e0 04          	shl    $0x4,%rax
+  801632:	48 29 d0             	sub    %rdx,%rax
+  801635:	48 c1 e0 05          	shl    $0x5,%rax
+  801639:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801640:	00 00 00 
+  801643:	48 01 d0             	add    %rdx,%rax
+  801646:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  80164d:	00 00 00 
+        return 0;
+  801650:	eb bd                	jmp    80160f <fork+0x9f>
+		return -1;
+  801652:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801658:	eb b5                	jmp    80160f <fork+0x9f>
+		return -1;
+  80165a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801660:	eb ad                	jmp    80160f <fork+0x9f>
+
+0000000000801662 <sfork>:
+
+envid_t
+sfork() {
+  801662:	55                   	push   %rbp
+  801663:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801666:	48 ba 65 4e 80 00 00 	movabs $0x804e65,%rdx
+  80166d:	00 00 00 
+  801670:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801675:	48 bf 80 4e 80 00 00 	movabs $0x804e80,%rdi
+  80167c:	00 00 00 
+  80167f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801684:	48 b9 42 45 80 00 00 	movabs $0x804542,%rcx
+  80168b:	00 00 00 
+  80168e:	ff d1                	call   *%rcx
+
+0000000000801690 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801690:	55                   	push   %rbp
+  801691:	48 89 e5             	mov    %rsp,%rbp
+  801694:	41 55                	push   %r13
+  801696:	41 54                	push   %r12
+  801698:	53                   	push   %rbx
+  801699:	48 83 ec 08          	sub    $0x8,%rsp
+  80169d:	49 89 fd             	mov    %rdi,%r13
+  8016a0:	48 89 f7             	mov    %rsi,%rdi
+  8016a3:	48 89 d3             	mov    %rdx,%rbx
+  8016a6:	49 89 cc             	mov    %rcx,%r12
+  8016a9:	4c 89 c2             	mov    %r8,%rdx
+  8016ac:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8016af:	48 85 f6             	test   %rsi,%rsi
+  8016b2:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8016b9:	00 00 00 
+  8016bc:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8016c0:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016c5:	48 85 db             	test   %rbx,%rbx
+  8016c8:	74 03                	je     8016cd <ipc_recv_futex+0x3d>
+  8016ca:	48 8b 33             	mov    (%rbx),%rsi
+  8016cd:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8016d1:	48 b8 87 13 80 00 00 	movabs $0x801387,%rax
+  8016d8:	00 00 00 
+  8016db:	ff d0                	call   *%rax
+    if (res < 0) {
+  8016dd:	85 c0                	test   %eax,%eax
+  8016df:	78 75                	js     801756 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8016e1:	4d 85 ed             	test   %r13,%r13
+  8016e4:	74 14                	je     8016fa <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8016e6:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8016ed:	00 00 00 
+  8016f0:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8016f6:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8016fa:	4d 85 e4             	test   %r12,%r12
+  8016fd:	74 14                	je     801713 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8016ff:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801706:	00 00 00 
+  801709:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80170f:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  801713:	48 85 db             	test   %rbx,%rbx
+  801716:	74 23                	je     80173b <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801718:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80171f:	00 00 00 
+  801722:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801728:	ba 00 00 00 00       	mov    $0x0,%edx
+  80172d:	85 c9                	test   %ecx,%ecx
+  80172f:	74 07                	je     801738 <ipc_recv_futex+0xa8>
+  801731:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801738:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  80173b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801742:	00 00 00 
+  801745:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  80174b:	48 83 c4 08          	add    $0x8,%rsp
+  80174f:	5b                   	pop    %rbx
+  801750:	41 5c                	pop    %r12
+  801752:	41 5d                	pop    %r13
+  801754:	5d                   	pop    %rbp
+  801755:	c3                   	ret
+        if (from_env_store != NULL) {
+  801756:	4d 85 ed             	test   %r13,%r13
+  801759:	74 08                	je     801763 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  80175b:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  801762:	00 
+        if (perm_store != NULL) {
+  801763:	4d 85 e4             	test   %r12,%r12
+  801766:	74 08                	je     801770 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801768:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80176f:	00 
+        if (size != NULL) {
+  801770:	48 85 db             	test   %rbx,%rbx
+  801773:	74 d6                	je     80174b <ipc_recv_futex+0xbb>
+            *size = 0;
+  801775:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  80177c:	eb cd                	jmp    80174b <ipc_recv_futex+0xbb>
+
+000000000080177e <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80177e:	55                   	push   %rbp
+  80177f:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  801782:	48 83 ec 08          	sub    $0x8,%rsp
+  801786:	6a 00                	push   $0x0
+  801788:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80178e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801794:	48 b8 90 16 80 00 00 	movabs $0x801690,%rax
+  80179b:	00 00 00 
+  80179e:	ff d0                	call   *%rax
+}
+  8017a0:	c9                   	leave
+  8017a1:	c3                   	ret
+
+00000000008017a2 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8017a2:	55                   	push   %rbp
+  8017a3:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8017a6:	48 85 d2             	test   %rdx,%rdx
+  8017a9:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017b0:	00 00 00 
+  8017b3:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8017b7:	89 f6                	mov    %esi,%esi
+  8017b9:	48 b8 70 13 80 00 00 	movabs $0x801370,%rax
+  8017c0:	00 00 00 
+  8017c3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017c5:	85 c0                	test   %eax,%eax
+  8017c7:	78 02                	js     8017cb <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8017c9:	5d                   	pop    %rbp
+  8017ca:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8017cb:	89 c1                	mov    %eax,%ecx
+  8017cd:	48 ba 8b 4e 80 00 00 	movabs $0x804e8b,%rdx
+  8017d4:	00 00 00 
+  8017d7:	be 50 00 00 00       	mov    $0x50,%esi
+  8017dc:	48 bf 9f 4e 80 00 00 	movabs $0x804e9f,%rdi
+  8017e3:	00 00 00 
+  8017e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017eb:	49 b8 42 45 80 00 00 	movabs $0x804542,%r8
+  8017f2:	00 00 00 
+  8017f5:	41 ff d0             	call   *%r8
+
+00000000008017f8 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8017f8:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8017fd:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801804:	00 00 00 
+  801807:	48 89 d0             	mov    %rdx,%rax
+  80180a:	48 c1 e0 04          	shl    $0x4,%rax
+  80180e:	48 29 d0             	sub    %rdx,%rax
+  801811:	48 c1 e0 05          	shl    $0x5,%rax
+  801815:	48 01 c8             	add    %rcx,%rax
+  801818:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80181e:	39 f8                	cmp    %edi,%eax
+  801820:	74 13                	je     801835 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  801822:	48 83 c2 01          	add    $0x1,%rdx
+  801826:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  80182d:	75 d8                	jne    801807 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80182f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801834:	c3                   	ret
+            return envs[i].env_id;
+  801835:	48 89 d0             	mov    %rdx,%rax
+  801838:	48 c1 e0 04          	shl    $0x4,%rax
+  80183c:	48 29 d0             	sub    %rdx,%rax
+  80183f:	48 c1 e0 05          	shl    $0x5,%rax
+  801843:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80184a:	00 00 00 
+  80184d:	48 01 d0             	add    %rdx,%rax
+  801850:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801856:	c3                   	ret
+
+0000000000801857 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801857:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80185e:	ff ff ff 
+  801861:	48 01 f8             	add    %rdi,%rax
+  801864:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801868:	c3                   	ret
+
+0000000000801869 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801869:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801870:	ff ff ff 
+  801873:	48 01 f8             	add    %rdi,%rax
+  801876:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  80187a:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801880:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801884:	c3                   	ret
+
+0000000000801885 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801885:	55                   	push   %rbp
+  801886:	48 89 e5             	mov    %rsp,%rbp
+  801889:	41 57                	push   %r15
+  80188b:	41 56                	push   %r14
+  80188d:	41 55                	push   %r13
+  80188f:	41 54                	push   %r12
+  801891:	53                   	push   %rbx
+  801892:	48 83 ec 08          	sub    $0x8,%rsp
+  801896:	49 89 ff             	mov    %rdi,%r15
+  801899:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80189e:	49 bd 14 40 80 00 00 	movabs $0x804014,%r13
+  8018a5:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018a8:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018ae:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018b1:	48 89 df             	mov    %rbx,%rdi
+  8018b4:	41 ff d5             	call   *%r13
+  8018b7:	83 e0 04             	and    $0x4,%eax
+  8018ba:	74 17                	je     8018d3 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018bc:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018c3:	4c 39 f3             	cmp    %r14,%rbx
+  8018c6:	75 e6                	jne    8018ae <fd_alloc+0x29>
+  8018c8:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018ce:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018d3:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018d6:	48 83 c4 08          	add    $0x8,%rsp
+  8018da:	5b                   	pop    %rbx
+  8018db:	41 5c                	pop    %r12
+  8018dd:	41 5d                	pop    %r13
+  8018df:	41 5e                	pop    %r14
+  8018e1:	41 5f                	pop    %r15
+  8018e3:	5d                   	pop    %rbp
+  8018e4:	c3                   	ret
+
+00000000008018e5 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018e5:	83 ff 1f             	cmp    $0x1f,%edi
+  8018e8:	77 39                	ja     801923 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018ea:	55                   	push   %rbp
+  8018eb:	48 89 e5             	mov    %rsp,%rbp
+  8018ee:	41 54                	push   %r12
+  8018f0:	53                   	push   %rbx
+  8018f1:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8018f4:	48 63 df             	movslq %edi,%rbx
+  8018f7:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8018fe:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801902:	48 89 df             	mov    %rbx,%rdi
+  801905:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  80190c:	00 00 00 
+  80190f:	ff d0                	call   *%rax
+  801911:	a8 04                	test   $0x4,%al
+  801913:	74 14                	je     801929 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801915:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801919:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80191e:	5b                   	pop    %rbx
+  80191f:	41 5c                	pop    %r12
+  801921:	5d                   	pop    %rbp
+  801922:	c3                   	ret
+        return -E_INVAL;
+  801923:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801928:	c3                   	ret
+        return -E_INVAL;
+  801929:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80192e:	eb ee                	jmp    80191e <fd_lookup+0x39>
+
+0000000000801930 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801930:	55                   	push   %rbp
+  801931:	48 89 e5             	mov    %rsp,%rbp
+  801934:	41 54                	push   %r12
+  801936:	53                   	push   %rbx
+  801937:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  80193a:	48 b8 40 4f 80 00 00 	movabs $0x804f40,%rax
+  801941:	00 00 00 
+  801944:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  80194b:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80194e:	39 3b                	cmp    %edi,(%rbx)
+  801950:	74 47                	je     801999 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801952:	48 83 c0 08          	add    $0x8,%rax
+  801956:	48 8b 18             	mov    (%rax),%rbx
+  801959:	48 85 db             	test   %rbx,%rbx
+  80195c:	75 f0                	jne    80194e <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80195e:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801965:	00 00 00 
+  801968:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80196e:	89 fa                	mov    %edi,%edx
+  801970:	48 bf b0 4e 80 00 00 	movabs $0x804eb0,%rdi
+  801977:	00 00 00 
+  80197a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80197f:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  801986:	00 00 00 
+  801989:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  80198b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801990:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801994:	5b                   	pop    %rbx
+  801995:	41 5c                	pop    %r12
+  801997:	5d                   	pop    %rbp
+  801998:	c3                   	ret
+            return 0;
+  801999:	b8 00 00 00 00       	mov    $0x0,%eax
+  80199e:	eb f0                	jmp    801990 <dev_lookup+0x60>
+
+00000000008019a0 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019a0:	55                   	push   %rbp
+  8019a1:	48 89 e5             	mov    %rsp,%rbp
+  8019a4:	41 55                	push   %r13
+  8019a6:	41 54                	push   %r12
+  8019a8:	53                   	push   %rbx
+  8019a9:	48 83 ec 18          	sub    $0x18,%rsp
+  8019ad:	48 89 fb             	mov    %rdi,%rbx
+  8019b0:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019b3:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019ba:	ff ff ff 
+  8019bd:	48 01 df             	add    %rbx,%rdi
+  8019c0:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019c4:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019c8:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  8019cf:	00 00 00 
+  8019d2:	ff d0                	call   *%rax
+  8019d4:	41 89 c5             	mov    %eax,%r13d
+  8019d7:	85 c0                	test   %eax,%eax
+  8019d9:	78 06                	js     8019e1 <fd_close+0x41>
+  8019db:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019df:	74 1a                	je     8019fb <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019e1:	45 84 e4             	test   %r12b,%r12b
+  8019e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019e9:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019ed:	44 89 e8             	mov    %r13d,%eax
+  8019f0:	48 83 c4 18          	add    $0x18,%rsp
+  8019f4:	5b                   	pop    %rbx
+  8019f5:	41 5c                	pop    %r12
+  8019f7:	41 5d                	pop    %r13
+  8019f9:	5d                   	pop    %rbp
+  8019fa:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  8019fb:	8b 3b                	mov    (%rbx),%edi
+  8019fd:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a01:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+  801a0d:	41 89 c5             	mov    %eax,%r13d
+  801a10:	85 c0                	test   %eax,%eax
+  801a12:	78 1b                	js     801a2f <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a14:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a18:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a1c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a22:	48 85 c0             	test   %rax,%rax
+  801a25:	74 08                	je     801a2f <fd_close+0x8f>
+  801a27:	48 89 df             	mov    %rbx,%rdi
+  801a2a:	ff d0                	call   *%rax
+  801a2c:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a2f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a34:	48 89 de             	mov    %rbx,%rsi
+  801a37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a3c:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801a43:	00 00 00 
+  801a46:	ff d0                	call   *%rax
+    return res;
+  801a48:	eb a3                	jmp    8019ed <fd_close+0x4d>
+
+0000000000801a4a <close>:
+
+int
+close(int fdnum) {
+  801a4a:	55                   	push   %rbp
+  801a4b:	48 89 e5             	mov    %rsp,%rbp
+  801a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a52:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a56:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801a5d:	00 00 00 
+  801a60:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a62:	85 c0                	test   %eax,%eax
+  801a64:	78 15                	js     801a7b <close+0x31>
+
+    return fd_close(fd, 1);
+  801a66:	be 01 00 00 00       	mov    $0x1,%esi
+  801a6b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a6f:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  801a76:	00 00 00 
+  801a79:	ff d0                	call   *%rax
+}
+  801a7b:	c9                   	leave
+  801a7c:	c3                   	ret
+
+0000000000801a7d <close_all>:
+
+void
+close_all(void) {
+  801a7d:	55                   	push   %rbp
+  801a7e:	48 89 e5             	mov    %rsp,%rbp
+  801a81:	41 54                	push   %r12
+  801a83:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a84:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a89:	49 bc 4a 1a 80 00 00 	movabs $0x801a4a,%r12
+  801a90:	00 00 00 
+  801a93:	89 df                	mov    %ebx,%edi
+  801a95:	41 ff d4             	call   *%r12
+  801a98:	83 c3 01             	add    $0x1,%ebx
+  801a9b:	83 fb 20             	cmp    $0x20,%ebx
+  801a9e:	75 f3                	jne    801a93 <close_all+0x16>
+}
+  801aa0:	5b                   	pop    %rbx
+  801aa1:	41 5c                	pop    %r12
+  801aa3:	5d                   	pop    %rbp
+  801aa4:	c3                   	ret
+
+0000000000801aa5 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801aa5:	55                   	push   %rbp
+  801aa6:	48 89 e5             	mov    %rsp,%rbp
+  801aa9:	41 57                	push   %r15
+  801aab:	41 56                	push   %r14
+  801aad:	41 55                	push   %r13
+  801aaf:	41 54                	push   %r12
+  801ab1:	53                   	push   %rbx
+  801ab2:	48 83 ec 18          	sub    $0x18,%rsp
+  801ab6:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ab9:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801abd:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801ac4:	00 00 00 
+  801ac7:	ff d0                	call   *%rax
+  801ac9:	89 c3                	mov    %eax,%ebx
+  801acb:	85 c0                	test   %eax,%eax
+  801acd:	0f 88 b8 00 00 00    	js     801b8b <dup+0xe6>
+    close(newfdnum);
+  801ad3:	44 89 e7             	mov    %r12d,%edi
+  801ad6:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  801add:	00 00 00 
+  801ae0:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801ae2:	4d 63 ec             	movslq %r12d,%r13
+  801ae5:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801aec:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801af0:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801af4:	4c 89 ff             	mov    %r15,%rdi
+  801af7:	49 be 69 18 80 00 00 	movabs $0x801869,%r14
+  801afe:	00 00 00 
+  801b01:	41 ff d6             	call   *%r14
+  801b04:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b07:	4c 89 ef             	mov    %r13,%rdi
+  801b0a:	41 ff d6             	call   *%r14
+  801b0d:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b10:	48 89 df             	mov    %rbx,%rdi
+  801b13:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  801b1a:	00 00 00 
+  801b1d:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b1f:	a8 04                	test   $0x4,%al
+  801b21:	74 2b                	je     801b4e <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b23:	41 89 c1             	mov    %eax,%r9d
+  801b26:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b2c:	4c 89 f1             	mov    %r14,%rcx
+  801b2f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b34:	48 89 de             	mov    %rbx,%rsi
+  801b37:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3c:	48 b8 93 11 80 00 00 	movabs $0x801193,%rax
+  801b43:	00 00 00 
+  801b46:	ff d0                	call   *%rax
+  801b48:	89 c3                	mov    %eax,%ebx
+  801b4a:	85 c0                	test   %eax,%eax
+  801b4c:	78 4e                	js     801b9c <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b4e:	4c 89 ff             	mov    %r15,%rdi
+  801b51:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  801b58:	00 00 00 
+  801b5b:	ff d0                	call   *%rax
+  801b5d:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b60:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b66:	4c 89 e9             	mov    %r13,%rcx
+  801b69:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b6e:	4c 89 fe             	mov    %r15,%rsi
+  801b71:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b76:	48 b8 93 11 80 00 00 	movabs $0x801193,%rax
+  801b7d:	00 00 00 
+  801b80:	ff d0                	call   *%rax
+  801b82:	89 c3                	mov    %eax,%ebx
+  801b84:	85 c0                	test   %eax,%eax
+  801b86:	78 14                	js     801b9c <dup+0xf7>
+
+    return newfdnum;
+  801b88:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b8b:	89 d8                	mov    %ebx,%eax
+  801b8d:	48 83 c4 18          	add    $0x18,%rsp
+  801b91:	5b                   	pop    %rbx
+  801b92:	41 5c                	pop    %r12
+  801b94:	41 5d                	pop    %r13
+  801b96:	41 5e                	pop    %r14
+  801b98:	41 5f                	pop    %r15
+  801b9a:	5d                   	pop    %rbp
+  801b9b:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801b9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ba1:	4c 89 ee             	mov    %r13,%rsi
+  801ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba9:	49 bc e3 11 80 00 00 	movabs $0x8011e3,%r12
+  801bb0:	00 00 00 
+  801bb3:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bb6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bbb:	4c 89 f6             	mov    %r14,%rsi
+  801bbe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bc3:	41 ff d4             	call   *%r12
+    return res;
+  801bc6:	eb c3                	jmp    801b8b <dup+0xe6>
+
+0000000000801bc8 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bc8:	55                   	push   %rbp
+  801bc9:	48 89 e5             	mov    %rsp,%rbp
+  801bcc:	41 56                	push   %r14
+  801bce:	41 55                	push   %r13
+  801bd0:	41 54                	push   %r12
+  801bd2:	53                   	push   %rbx
+  801bd3:	48 83 ec 10          	sub    $0x10,%rsp
+  801bd7:	89 fb                	mov    %edi,%ebx
+  801bd9:	49 89 f4             	mov    %rsi,%r12
+  801bdc:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bdf:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801be3:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801bea:	00 00 00 
+  801bed:	ff d0                	call   *%rax
+  801bef:	85 c0                	test   %eax,%eax
+  801bf1:	78 4c                	js     801c3f <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf3:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bf7:	41 8b 3e             	mov    (%r14),%edi
+  801bfa:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bfe:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801c05:	00 00 00 
+  801c08:	ff d0                	call   *%rax
+  801c0a:	85 c0                	test   %eax,%eax
+  801c0c:	78 35                	js     801c43 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c0e:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c12:	83 e0 03             	and    $0x3,%eax
+  801c15:	83 f8 01             	cmp    $0x1,%eax
+  801c18:	74 2d                	je     801c47 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c1a:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c1e:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c22:	48 85 c0             	test   %rax,%rax
+  801c25:	74 56                	je     801c7d <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c27:	4c 89 ea             	mov    %r13,%rdx
+  801c2a:	4c 89 e6             	mov    %r12,%rsi
+  801c2d:	4c 89 f7             	mov    %r14,%rdi
+  801c30:	ff d0                	call   *%rax
+}
+  801c32:	48 83 c4 10          	add    $0x10,%rsp
+  801c36:	5b                   	pop    %rbx
+  801c37:	41 5c                	pop    %r12
+  801c39:	41 5d                	pop    %r13
+  801c3b:	41 5e                	pop    %r14
+  801c3d:	5d                   	pop    %rbp
+  801c3e:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c3f:	48 98                	cltq
+  801c41:	eb ef                	jmp    801c32 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c43:	48 98                	cltq
+  801c45:	eb eb                	jmp    801c32 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c47:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c4e:	00 00 00 
+  801c51:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c57:	89 da                	mov    %ebx,%edx
+  801c59:	48 bf f1 4e 80 00 00 	movabs $0x804ef1,%rdi
+  801c60:	00 00 00 
+  801c63:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c68:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  801c6f:	00 00 00 
+  801c72:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c74:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c7b:	eb b5                	jmp    801c32 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c7d:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c84:	eb ac                	jmp    801c32 <read+0x6a>
+
+0000000000801c86 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c86:	55                   	push   %rbp
+  801c87:	48 89 e5             	mov    %rsp,%rbp
+  801c8a:	41 57                	push   %r15
+  801c8c:	41 56                	push   %r14
+  801c8e:	41 55                	push   %r13
+  801c90:	41 54                	push   %r12
+  801c92:	53                   	push   %rbx
+  801c93:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801c97:	48 85 d2             	test   %rdx,%rdx
+  801c9a:	74 54                	je     801cf0 <readn+0x6a>
+  801c9c:	41 89 fd             	mov    %edi,%r13d
+  801c9f:	49 89 f6             	mov    %rsi,%r14
+  801ca2:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801ca5:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801caa:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801caf:	49 bf c8 1b 80 00 00 	movabs $0x801bc8,%r15
+  801cb6:	00 00 00 
+  801cb9:	4c 89 e2             	mov    %r12,%rdx
+  801cbc:	48 29 f2             	sub    %rsi,%rdx
+  801cbf:	4c 01 f6             	add    %r14,%rsi
+  801cc2:	44 89 ef             	mov    %r13d,%edi
+  801cc5:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cc8:	85 c0                	test   %eax,%eax
+  801cca:	78 20                	js     801cec <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801ccc:	01 c3                	add    %eax,%ebx
+  801cce:	85 c0                	test   %eax,%eax
+  801cd0:	74 08                	je     801cda <readn+0x54>
+  801cd2:	48 63 f3             	movslq %ebx,%rsi
+  801cd5:	4c 39 e6             	cmp    %r12,%rsi
+  801cd8:	72 df                	jb     801cb9 <readn+0x33>
+    }
+    return res;
+  801cda:	48 63 c3             	movslq %ebx,%rax
+}
+  801cdd:	48 83 c4 08          	add    $0x8,%rsp
+  801ce1:	5b                   	pop    %rbx
+  801ce2:	41 5c                	pop    %r12
+  801ce4:	41 5d                	pop    %r13
+  801ce6:	41 5e                	pop    %r14
+  801ce8:	41 5f                	pop    %r15
+  801cea:	5d                   	pop    %rbp
+  801ceb:	c3                   	ret
+        if (inc < 0) return inc;
+  801cec:	48 98                	cltq
+  801cee:	eb ed                	jmp    801cdd <readn+0x57>
+    int inc = 1, res = 0;
+  801cf0:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801cf5:	eb e3                	jmp    801cda <readn+0x54>
+
+0000000000801cf7 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801cf7:	55                   	push   %rbp
+  801cf8:	48 89 e5             	mov    %rsp,%rbp
+  801cfb:	41 56                	push   %r14
+  801cfd:	41 55                	push   %r13
+  801cff:	41 54                	push   %r12
+  801d01:	53                   	push   %rbx
+  801d02:	48 83 ec 10          	sub    $0x10,%rsp
+  801d06:	89 fb                	mov    %edi,%ebx
+  801d08:	49 89 f4             	mov    %rsi,%r12
+  801d0b:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d0e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d12:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801d19:	00 00 00 
+  801d1c:	ff d0                	call   *%rax
+  801d1e:	85 c0                	test   %eax,%eax
+  801d20:	78 47                	js     801d69 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d22:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d26:	41 8b 3e             	mov    (%r14),%edi
+  801d29:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d2d:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801d34:	00 00 00 
+  801d37:	ff d0                	call   *%rax
+  801d39:	85 c0                	test   %eax,%eax
+  801d3b:	78 30                	js     801d6d <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d3d:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d42:	74 2d                	je     801d71 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d44:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d48:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d4c:	48 85 c0             	test   %rax,%rax
+  801d4f:	74 56                	je     801da7 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d51:	4c 89 ea             	mov    %r13,%rdx
+  801d54:	4c 89 e6             	mov    %r12,%rsi
+  801d57:	4c 89 f7             	mov    %r14,%rdi
+  801d5a:	ff d0                	call   *%rax
+}
+  801d5c:	48 83 c4 10          	add    $0x10,%rsp
+  801d60:	5b                   	pop    %rbx
+  801d61:	41 5c                	pop    %r12
+  801d63:	41 5d                	pop    %r13
+  801d65:	41 5e                	pop    %r14
+  801d67:	5d                   	pop    %rbp
+  801d68:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d69:	48 98                	cltq
+  801d6b:	eb ef                	jmp    801d5c <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d6d:	48 98                	cltq
+  801d6f:	eb eb                	jmp    801d5c <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d71:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d78:	00 00 00 
+  801d7b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d81:	89 da                	mov    %ebx,%edx
+  801d83:	48 bf 0d 4f 80 00 00 	movabs $0x804f0d,%rdi
+  801d8a:	00 00 00 
+  801d8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d92:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  801d99:	00 00 00 
+  801d9c:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d9e:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801da5:	eb b5                	jmp    801d5c <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801da7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dae:	eb ac                	jmp    801d5c <write+0x65>
+
+0000000000801db0 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801db0:	55                   	push   %rbp
+  801db1:	48 89 e5             	mov    %rsp,%rbp
+  801db4:	41 54                	push   %r12
+  801db6:	53                   	push   %rbx
+  801db7:	48 83 ec 10          	sub    $0x10,%rsp
+  801dbb:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dbd:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dc1:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801dc8:	00 00 00 
+  801dcb:	ff d0                	call   *%rax
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	78 3e                	js     801e0f <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dd1:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801dd5:	41 8b 3c 24          	mov    (%r12),%edi
+  801dd9:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ddd:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801de4:	00 00 00 
+  801de7:	ff d0                	call   *%rax
+  801de9:	85 c0                	test   %eax,%eax
+  801deb:	78 22                	js     801e0f <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801ded:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801df1:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801df5:	48 85 c0             	test   %rax,%rax
+  801df8:	74 0b                	je     801e05 <seek+0x55>
+  801dfa:	89 de                	mov    %ebx,%esi
+  801dfc:	4c 89 e7             	mov    %r12,%rdi
+  801dff:	ff d0                	call   *%rax
+  801e01:	85 c0                	test   %eax,%eax
+  801e03:	78 0a                	js     801e0f <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e05:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e0a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e0f:	48 83 c4 10          	add    $0x10,%rsp
+  801e13:	5b                   	pop    %rbx
+  801e14:	41 5c                	pop    %r12
+  801e16:	5d                   	pop    %rbp
+  801e17:	c3                   	ret
+
+0000000000801e18 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e18:	55                   	push   %rbp
+  801e19:	48 89 e5             	mov    %rsp,%rbp
+  801e1c:	41 55                	push   %r13
+  801e1e:	41 54                	push   %r12
+  801e20:	53                   	push   %rbx
+  801e21:	48 83 ec 18          	sub    $0x18,%rsp
+  801e25:	89 fb                	mov    %edi,%ebx
+  801e27:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e2a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e2e:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801e35:	00 00 00 
+  801e38:	ff d0                	call   *%rax
+  801e3a:	85 c0                	test   %eax,%eax
+  801e3c:	78 38                	js     801e76 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e3e:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e42:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e46:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e4a:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801e51:	00 00 00 
+  801e54:	ff d0                	call   *%rax
+  801e56:	85 c0                	test   %eax,%eax
+  801e58:	78 1c                	js     801e76 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e5a:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e5f:	74 20                	je     801e81 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e65:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e69:	48 85 c0             	test   %rax,%rax
+  801e6c:	74 47                	je     801eb5 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e6e:	44 89 e6             	mov    %r12d,%esi
+  801e71:	4c 89 ef             	mov    %r13,%rdi
+  801e74:	ff d0                	call   *%rax
+}
+  801e76:	48 83 c4 18          	add    $0x18,%rsp
+  801e7a:	5b                   	pop    %rbx
+  801e7b:	41 5c                	pop    %r12
+  801e7d:	41 5d                	pop    %r13
+  801e7f:	5d                   	pop    %rbp
+  801e80:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e81:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e88:	00 00 00 
+  801e8b:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e91:	89 da                	mov    %ebx,%edx
+  801e93:	48 bf d0 4e 80 00 00 	movabs $0x804ed0,%rdi
+  801e9a:	00 00 00 
+  801e9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ea2:	48 b9 b9 02 80 00 00 	movabs $0x8002b9,%rcx
+  801ea9:	00 00 00 
+  801eac:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801eb3:	eb c1                	jmp    801e76 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801eb5:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801eba:	eb ba                	jmp    801e76 <ftruncate+0x5e>
+
+0000000000801ebc <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ebc:	55                   	push   %rbp
+  801ebd:	48 89 e5             	mov    %rsp,%rbp
+  801ec0:	41 54                	push   %r12
+  801ec2:	53                   	push   %rbx
+  801ec3:	48 83 ec 10          	sub    $0x10,%rsp
+  801ec7:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eca:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ece:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  801ed5:	00 00 00 
+  801ed8:	ff d0                	call   *%rax
+  801eda:	85 c0                	test   %eax,%eax
+  801edc:	78 4e                	js     801f2c <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ede:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ee2:	41 8b 3c 24          	mov    (%r12),%edi
+  801ee6:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801eea:	48 b8 30 19 80 00 00 	movabs $0x801930,%rax
+  801ef1:	00 00 00 
+  801ef4:	ff d0                	call   *%rax
+  801ef6:	85 c0                	test   %eax,%eax
+  801ef8:	78 32                	js     801f2c <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801efa:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801efe:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f03:	74 30                	je     801f35 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f05:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f08:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f0f:	00 00 00 
+    stat->st_isdir = 0;
+  801f12:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f19:	00 00 00 
+    stat->st_dev = dev;
+  801f1c:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f23:	48 89 de             	mov    %rbx,%rsi
+  801f26:	4c 89 e7             	mov    %r12,%rdi
+  801f29:	ff 50 28             	call   *0x28(%rax)
+}
+  801f2c:	48 83 c4 10          	add    $0x10,%rsp
+  801f30:	5b                   	pop    %rbx
+  801f31:	41 5c                	pop    %r12
+  801f33:	5d                   	pop    %rbp
+  801f34:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f35:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f3a:	eb f0                	jmp    801f2c <fstat+0x70>
+
+0000000000801f3c <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f3c:	55                   	push   %rbp
+  801f3d:	48 89 e5             	mov    %rsp,%rbp
+  801f40:	41 54                	push   %r12
+  801f42:	53                   	push   %rbx
+  801f43:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f46:	be 00 00 00 00       	mov    $0x0,%esi
+  801f4b:	48 b8 aa 30 80 00 00 	movabs $0x8030aa,%rax
+  801f52:	00 00 00 
+  801f55:	ff d0                	call   *%rax
+  801f57:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f59:	85 c0                	test   %eax,%eax
+  801f5b:	78 25                	js     801f82 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f5d:	4c 89 e6             	mov    %r12,%rsi
+  801f60:	89 c7                	mov    %eax,%edi
+  801f62:	48 b8 bc 1e 80 00 00 	movabs $0x801ebc,%rax
+  801f69:	00 00 00 
+  801f6c:	ff d0                	call   *%rax
+  801f6e:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f71:	89 df                	mov    %ebx,%edi
+  801f73:	48 b8 4a 1a 80 00 00 	movabs $0x801a4a,%rax
+  801f7a:	00 00 00 
+  801f7d:	ff d0                	call   *%rax
+
+    return res;
+  801f7f:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f82:	89 d8                	mov    %ebx,%eax
+  801f84:	5b                   	pop    %rbx
+  801f85:	41 5c                	pop    %r12
+  801f87:	5d                   	pop    %rbp
+  801f88:	c3                   	ret
+
+0000000000801f89 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801f89:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801f90:	00 00 00 
+  801f93:	83 38 00             	cmpl   $0x0,(%rax)
+  801f96:	74 0a                	je     801fa2 <fsenv+0x19>
+    return envid;
+}
+  801f98:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801f9f:	00 00 
+  801fa1:	c3                   	ret
+fsenv(void) {
+  801fa2:	55                   	push   %rbp
+  801fa3:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fa6:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fab:	48 b8 f8 17 80 00 00 	movabs $0x8017f8,%rax
+  801fb2:	00 00 00 
+  801fb5:	ff d0                	call   *%rax
+  801fb7:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801fbe:	00 00 
+}
+  801fc0:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fc7:	00 00 
+  801fc9:	5d                   	pop    %rbp
+  801fca:	c3                   	ret
+
+0000000000801fcb <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801fcb:	55                   	push   %rbp
+  801fcc:	48 89 e5             	mov    %rsp,%rbp
+  801fcf:	41 54                	push   %r12
+  801fd1:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801fd2:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801fd7:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fdc:	48 89 de             	mov    %rbx,%rsi
+  801fdf:	bf 00 00 00 00       	mov    $0x0,%edi
+  801fe4:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  801feb:	00 00 00 
+  801fee:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801ff0:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801ff7:	00 00 00 
+  801ffa:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802000:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802005:	ba 00 50 00 00       	mov    $0x5000,%edx
+  80200a:	48 89 de             	mov    %rbx,%rsi
+  80200d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802012:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  802019:	00 00 00 
+  80201c:	ff d0                	call   *%rax
+  80201e:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802020:	85 c0                	test   %eax,%eax
+  802022:	0f 88 a2 00 00 00    	js     8020ca <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802028:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80202f:	00 00 00 
+  802032:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802038:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80203d:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80203f:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802044:	49 bc dc 41 80 00 00 	movabs $0x8041dc,%r12
+  80204b:	00 00 00 
+  80204e:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802051:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802056:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802059:	48 b8 89 1f 80 00 00 	movabs $0x801f89,%rax
+  802060:	00 00 00 
+  802063:	ff d0                	call   *%rax
+  802065:	89 c7                	mov    %eax,%edi
+  802067:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  80206d:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802072:	48 89 da             	mov    %rbx,%rdx
+  802075:	be 09 00 00 00       	mov    $0x9,%esi
+  80207a:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  802081:	00 00 00 
+  802084:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802086:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80208b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802090:	be 00 00 00 00       	mov    $0x0,%esi
+  802095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80209a:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  8020a1:	00 00 00 
+  8020a4:	ff d0                	call   *%rax
+  8020a6:	89 c3                	mov    %eax,%ebx
+  8020a8:	85 c0                	test   %eax,%eax
+  8020aa:	78 25                	js     8020d1 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8020ac:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020b3:	00 00 00 
+  8020b6:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020bc:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8020c3:	00 00 
+    return 0;
+  8020c5:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8020ca:	89 d8                	mov    %ebx,%eax
+  8020cc:	5b                   	pop    %rbx
+  8020cd:	41 5c                	pop    %r12
+  8020cf:	5d                   	pop    %rbp
+  8020d0:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020d1:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020d6:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8020db:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e0:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  8020e7:	00 00 00 
+  8020ea:	ff d0                	call   *%rax
+        return res;
+  8020ec:	eb dc                	jmp    8020ca <fschan_setup+0xff>
+
+00000000008020ee <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8020ee:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8020f5:	00 00 00 
+  8020f8:	80 38 00             	cmpb   $0x0,(%rax)
+  8020fb:	74 55                	je     802152 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8020fd:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802104:	00 00 00 
+  802107:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80210d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802112:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802119:	00 00 00 
+  80211c:	3b 0a                	cmp    (%rdx),%ecx
+  80211e:	75 01                	jne    802121 <fschan+0x33>
+}
+  802120:	c3                   	ret
+fschan(void) {
+  802121:	55                   	push   %rbp
+  802122:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802125:	48 b8 cb 1f 80 00 00 	movabs $0x801fcb,%rax
+  80212c:	00 00 00 
+  80212f:	ff d0                	call   *%rax
+  802131:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802133:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802138:	85 d2                	test   %edx,%edx
+  80213a:	78 02                	js     80213e <fschan+0x50>
+}
+  80213c:	5d                   	pop    %rbp
+  80213d:	c3                   	ret
+        fschan_enabled = 0;
+  80213e:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802145:	00 00 00 
+  802148:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  80214b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802150:	eb ea                	jmp    80213c <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802152:	b8 00 00 00 00       	mov    $0x0,%eax
+  802157:	c3                   	ret
+
+0000000000802158 <fbuf>:
+fbuf(struct Fd *fd) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  80215c:	48 b8 57 18 80 00 00 	movabs $0x801857,%rax
+  802163:	00 00 00 
+  802166:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80216d:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802171:	77 12                	ja     802185 <fbuf+0x2d>
+  802173:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802177:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80217e:	00 00 00 
+  802181:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802185:	48 89 d0             	mov    %rdx,%rax
+  802188:	5d                   	pop    %rbp
+  802189:	c3                   	ret
+
+000000000080218a <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  80218a:	55                   	push   %rbp
+  80218b:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80218e:	48 83 c7 40          	add    $0x40,%rdi
+  802192:	48 b8 16 42 80 00 00 	movabs $0x804216,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+  80219e:	84 c0                	test   %al,%al
+  8021a0:	75 02                	jne    8021a4 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8021a2:	5d                   	pop    %rbp
+  8021a3:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8021a4:	48 b8 89 1f 80 00 00 	movabs $0x801f89,%rax
+  8021ab:	00 00 00 
+  8021ae:	ff d0                	call   *%rax
+  8021b0:	89 c7                	mov    %eax,%edi
+  8021b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021b8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021bd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c2:	be 0a 00 00 00       	mov    $0xa,%esi
+  8021c7:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  8021ce:	00 00 00 
+  8021d1:	ff d0                	call   *%rax
+}
+  8021d3:	eb cd                	jmp    8021a2 <fschan_publish+0x18>
+
+00000000008021d5 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8021d5:	55                   	push   %rbp
+  8021d6:	48 89 e5             	mov    %rsp,%rbp
+  8021d9:	41 57                	push   %r15
+  8021db:	41 56                	push   %r14
+  8021dd:	41 55                	push   %r13
+  8021df:	41 54                	push   %r12
+  8021e1:	53                   	push   %rbx
+  8021e2:	48 83 ec 48          	sub    $0x48,%rsp
+  8021e6:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8021ea:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8021ee:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8021f1:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8021f5:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8021f8:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8021ff:	00 00 00 
+  802202:	8b 02                	mov    (%rdx),%eax
+  802204:	83 c0 01             	add    $0x1,%eax
+  802207:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80220c:	0f 44 c1             	cmove  %ecx,%eax
+  80220f:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802211:	4d 85 c0             	test   %r8,%r8
+  802214:	74 2c                	je     802242 <fschan_rw+0x6d>
+  802216:	45 89 ce             	mov    %r9d,%r14d
+  802219:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802220:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802224:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  80222a:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802231:	00 
+  802232:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802238:	b8 01 00 00 00       	mov    $0x1,%eax
+  80223d:	e9 41 01 00 00       	jmp    802383 <fschan_rw+0x1ae>
+  802242:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802246:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80224a:	e9 9c 01 00 00       	jmp    8023eb <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80224f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802253:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802256:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802259:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80225c:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802260:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802264:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802268:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80226c:	48 89 da             	mov    %rbx,%rdx
+  80226f:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  802276:	00 00 00 
+  802279:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80227b:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80227f:	48 b8 8a 21 80 00 00 	movabs $0x80218a,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+            queued += blk;
+  80228b:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80228e:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802292:	4d 39 fc             	cmp    %r15,%r12
+  802295:	73 6b                	jae    802302 <fschan_rw+0x12d>
+  802297:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80229b:	77 65                	ja     802302 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80229d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022a1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8022a5:	48 b8 f1 41 80 00 00 	movabs $0x8041f1,%rax
+  8022ac:	00 00 00 
+  8022af:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8022b1:	4c 89 fb             	mov    %r15,%rbx
+  8022b4:	4c 29 e3             	sub    %r12,%rbx
+  8022b7:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8022bc:	48 39 d3             	cmp    %rdx,%rbx
+  8022bf:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8022c3:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8022c7:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8022cb:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8022cf:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8022d2:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8022d4:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8022db:	00 00 00 
+  8022de:	8b 09                	mov    (%rcx),%ecx
+  8022e0:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8022e3:	83 fe 03             	cmp    $0x3,%esi
+  8022e6:	0f 85 63 ff ff ff    	jne    80224f <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8022ec:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8022f0:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8022f3:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8022f6:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8022f9:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8022fd:	e9 79 ff ff ff       	jmp    80227b <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802302:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802306:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80230d:	48 89 df             	mov    %rbx,%rdi
+  802310:	48 b8 b4 42 80 00 00 	movabs $0x8042b4,%rax
+  802317:	00 00 00 
+  80231a:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80231c:	48 89 df             	mov    %rbx,%rdi
+  80231f:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  802326:	00 00 00 
+  802329:	ff d0                	call   *%rax
+  80232b:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80232f:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802333:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802337:	75 25                	jne    80235e <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802339:	8b 40 04             	mov    0x4(%rax),%eax
+  80233c:	85 c0                	test   %eax,%eax
+  80233e:	0f 88 86 00 00 00    	js     8023ca <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802344:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802348:	74 5b                	je     8023a5 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  80234a:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80234e:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802352:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802356:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  80235a:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80235e:	48 89 df             	mov    %rbx,%rdi
+  802361:	48 b8 69 42 80 00 00 	movabs $0x804269,%rax
+  802368:	00 00 00 
+  80236b:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80236d:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802371:	83 f0 01             	xor    $0x1,%eax
+  802374:	4d 39 fc             	cmp    %r15,%r12
+  802377:	0f 92 c2             	setb   %dl
+  80237a:	84 c2                	test   %al,%dl
+  80237c:	75 05                	jne    802383 <fschan_rw+0x1ae>
+  80237e:	45 85 ed             	test   %r13d,%r13d
+  802381:	74 50                	je     8023d3 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802383:	4d 39 fc             	cmp    %r15,%r12
+  802386:	0f 92 c1             	setb   %cl
+  802389:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80238d:	0f 96 c2             	setbe  %dl
+  802390:	84 d1                	test   %dl,%cl
+  802392:	0f 84 6a ff ff ff    	je     802302 <fschan_rw+0x12d>
+  802398:	84 c0                	test   %al,%al
+  80239a:	0f 85 fd fe ff ff    	jne    80229d <fschan_rw+0xc8>
+  8023a0:	e9 5d ff ff ff       	jmp    802302 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023a5:	48 63 d0             	movslq %eax,%rdx
+  8023a8:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023ac:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023b0:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8023b4:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8023b8:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8023bc:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  8023c3:	00 00 00 
+  8023c6:	ff d0                	call   *%rax
+  8023c8:	eb 80                	jmp    80234a <fschan_rw+0x175>
+                err = msg->fm_res;
+  8023ca:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8023cd:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8023d1:	eb 8b                	jmp    80235e <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8023d3:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8023d8:	0f 85 68 fe ff ff    	jne    802246 <fschan_rw+0x71>
+  8023de:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8023e1:	85 c0                	test   %eax,%eax
+  8023e3:	0f 84 5d fe ff ff    	je     802246 <fschan_rw+0x71>
+  8023e9:	48 98                	cltq
+}
+  8023eb:	48 83 c4 48          	add    $0x48,%rsp
+  8023ef:	5b                   	pop    %rbx
+  8023f0:	41 5c                	pop    %r12
+  8023f2:	41 5d                	pop    %r13
+  8023f4:	41 5e                	pop    %r14
+  8023f6:	41 5f                	pop    %r15
+  8023f8:	5d                   	pop    %rbp
+  8023f9:	c3                   	ret
+
+00000000008023fa <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8023fa:	55                   	push   %rbp
+  8023fb:	48 89 e5             	mov    %rsp,%rbp
+  8023fe:	41 56                	push   %r14
+  802400:	41 55                	push   %r13
+  802402:	41 54                	push   %r12
+  802404:	53                   	push   %rbx
+  802405:	48 83 ec 10          	sub    $0x10,%rsp
+  802409:	49 89 fe             	mov    %rdi,%r14
+  80240c:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80240f:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802413:	48 29 f3             	sub    %rsi,%rbx
+  802416:	48 39 d3             	cmp    %rdx,%rbx
+  802419:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80241d:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802424:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802425:	bf 00 10 00 00       	mov    $0x1000,%edi
+  80242a:	49 bd 73 40 80 00 00 	movabs $0x804073,%r13
+  802431:	00 00 00 
+  802434:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80243b:	76 1e                	jbe    80245b <mmap_fault+0x61>
+  80243d:	4c 01 e7             	add    %r12,%rdi
+  802440:	41 ff d5             	call   *%r13
+  802443:	84 c0                	test   %al,%al
+  802445:	75 14                	jne    80245b <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802447:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80244b:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802452:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802456:	48 39 df             	cmp    %rbx,%rdi
+  802459:	72 e2                	jb     80243d <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80245b:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802462:	00 00 00 
+  802465:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80246c:	00 00 00 
+  80246f:	4c 89 f0             	mov    %r14,%rax
+  802472:	48 29 d0             	sub    %rdx,%rax
+  802475:	48 c1 f8 03          	sar    $0x3,%rax
+  802479:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802480:	aa aa aa 
+  802483:	48 0f af c2          	imul   %rdx,%rax
+  802487:	48 c1 e0 0c          	shl    $0xc,%rax
+  80248b:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802490:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802494:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802496:	44 89 e0             	mov    %r12d,%eax
+  802499:	41 03 46 10          	add    0x10(%r14),%eax
+  80249d:	41 2b 06             	sub    (%r14),%eax
+  8024a0:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8024a3:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024a7:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8024ab:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8024af:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8024b2:	48 b8 89 1f 80 00 00 	movabs $0x801f89,%rax
+  8024b9:	00 00 00 
+  8024bc:	ff d0                	call   *%rax
+  8024be:	89 c7                	mov    %eax,%edi
+  8024c0:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024c6:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024cb:	48 89 da             	mov    %rbx,%rdx
+  8024ce:	be 0f 00 00 00       	mov    $0xf,%esi
+  8024d3:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  8024da:	00 00 00 
+  8024dd:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8024df:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024e4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8024e8:	4c 89 e6             	mov    %r12,%rsi
+  8024eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024f0:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  8024f7:	00 00 00 
+  8024fa:	ff d0                	call   *%rax
+  8024fc:	48 98                	cltq
+}
+  8024fe:	48 83 c4 10          	add    $0x10,%rsp
+  802502:	5b                   	pop    %rbx
+  802503:	41 5c                	pop    %r12
+  802505:	41 5d                	pop    %r13
+  802507:	41 5e                	pop    %r14
+  802509:	5d                   	pop    %rbp
+  80250a:	c3                   	ret
+
+000000000080250b <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80250b:	48 8b 37             	mov    (%rdi),%rsi
+  80250e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802515:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80251c:	00 00 00 
+  80251f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802524:	eb 0f                	jmp    802535 <mmap_pgfault+0x2a>
+  802526:	c3                   	ret
+  802527:	48 83 c1 01          	add    $0x1,%rcx
+  80252b:	48 83 c2 18          	add    $0x18,%rdx
+  80252f:	48 83 f9 20          	cmp    $0x20,%rcx
+  802533:	74 6e                	je     8025a3 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802535:	48 8b 02             	mov    (%rdx),%rax
+  802538:	48 83 e8 01          	sub    $0x1,%rax
+  80253c:	48 39 f0             	cmp    %rsi,%rax
+  80253f:	73 e6                	jae    802527 <mmap_pgfault+0x1c>
+  802541:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802545:	73 e0                	jae    802527 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802547:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80254b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802550:	f6 c2 01             	test   $0x1,%dl
+  802553:	75 d1                	jne    802526 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802555:	f6 c2 02             	test   $0x2,%dl
+  802558:	74 1a                	je     802574 <mmap_pgfault+0x69>
+  80255a:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80255e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802563:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  80256a:	00 00 00 
+  80256d:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802572:	74 35                	je     8025a9 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802574:	55                   	push   %rbp
+  802575:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802578:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80257c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802583:	00 00 00 
+  802586:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  80258a:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80258f:	48 b8 fa 23 80 00 00 	movabs $0x8023fa,%rax
+  802596:	00 00 00 
+  802599:	ff d0                	call   *%rax
+  80259b:	48 85 c0             	test   %rax,%rax
+  80259e:	0f 9f c0             	setg   %al
+}
+  8025a1:	5d                   	pop    %rbp
+  8025a2:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025a3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025a8:	c3                   	ret
+}
+  8025a9:	c3                   	ret
+
+00000000008025aa <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8025aa:	55                   	push   %rbp
+  8025ab:	48 89 e5             	mov    %rsp,%rbp
+  8025ae:	41 54                	push   %r12
+  8025b0:	53                   	push   %rbx
+  8025b1:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025b4:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025bb:	00 00 00 
+  8025be:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8025c3:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8025c7:	74 15                	je     8025de <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025c9:	48 83 c3 01          	add    $0x1,%rbx
+  8025cd:	48 83 c0 18          	add    $0x18,%rax
+  8025d1:	48 83 fb 20          	cmp    $0x20,%rbx
+  8025d5:	75 ec                	jne    8025c3 <mmap_alloc+0x19>
+    return NULL;
+  8025d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025dc:	eb 52                	jmp    802630 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8025de:	4c 89 e7             	mov    %r12,%rdi
+  8025e1:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  8025e8:	00 00 00 
+  8025eb:	ff d0                	call   *%rax
+  8025ed:	41 89 c1             	mov    %eax,%r9d
+  8025f0:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8025f7:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8025fb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802601:	ba 00 00 00 00       	mov    $0x0,%edx
+  802606:	4c 89 e6             	mov    %r12,%rsi
+  802609:	bf 00 00 00 00       	mov    $0x0,%edi
+  80260e:	48 b8 93 11 80 00 00 	movabs $0x801193,%rax
+  802615:	00 00 00 
+  802618:	ff d0                	call   *%rax
+  80261a:	85 c0                	test   %eax,%eax
+  80261c:	78 17                	js     802635 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80261e:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802622:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802629:	00 00 00 
+  80262c:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802630:	5b                   	pop    %rbx
+  802631:	41 5c                	pop    %r12
+  802633:	5d                   	pop    %rbp
+  802634:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802635:	b8 00 00 00 00       	mov    $0x0,%eax
+  80263a:	eb f4                	jmp    802630 <mmap_alloc+0x86>
+
+000000000080263c <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80263c:	55                   	push   %rbp
+  80263d:	48 89 e5             	mov    %rsp,%rbp
+  802640:	41 56                	push   %r14
+  802642:	41 55                	push   %r13
+  802644:	41 54                	push   %r12
+  802646:	53                   	push   %rbx
+  802647:	48 83 ec 10          	sub    $0x10,%rsp
+  80264b:	41 89 fc             	mov    %edi,%r12d
+  80264e:	49 89 f5             	mov    %rsi,%r13
+  802651:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802654:	48 89 f0             	mov    %rsi,%rax
+  802657:	48 09 d0             	or     %rdx,%rax
+  80265a:	75 0d                	jne    802669 <fsipc+0x2d>
+  80265c:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80265f:	83 f8 04             	cmp    $0x4,%eax
+  802662:	76 7d                	jbe    8026e1 <fsipc+0xa5>
+  802664:	83 ff 0d             	cmp    $0xd,%edi
+  802667:	74 78                	je     8026e1 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802669:	48 b8 89 1f 80 00 00 	movabs $0x801f89,%rax
+  802670:	00 00 00 
+  802673:	ff d0                	call   *%rax
+  802675:	89 c7                	mov    %eax,%edi
+  802677:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80267e:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802685:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80268c:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802692:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802699:	00 00 00 
+  80269c:	44 89 e6             	mov    %r12d,%esi
+  80269f:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  8026a6:	00 00 00 
+  8026a9:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8026ab:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8026b2:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8026b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026b8:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026bc:	4c 89 ee             	mov    %r13,%rsi
+  8026bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026c4:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  8026cb:	00 00 00 
+  8026ce:	ff d0                	call   *%rax
+  8026d0:	89 c3                	mov    %eax,%ebx
+}
+  8026d2:	89 d8                	mov    %ebx,%eax
+  8026d4:	48 83 c4 10          	add    $0x10,%rsp
+  8026d8:	5b                   	pop    %rbx
+  8026d9:	41 5c                	pop    %r12
+  8026db:	41 5d                	pop    %r13
+  8026dd:	41 5e                	pop    %r14
+  8026df:	5d                   	pop    %rbp
+  8026e0:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026e1:	48 b8 ee 20 80 00 00 	movabs $0x8020ee,%rax
+  8026e8:	00 00 00 
+  8026eb:	ff d0                	call   *%rax
+  8026ed:	49 89 c6             	mov    %rax,%r14
+  8026f0:	48 85 c0             	test   %rax,%rax
+  8026f3:	0f 84 70 ff ff ff    	je     802669 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8026f9:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8026fd:	48 b8 f1 41 80 00 00 	movabs $0x8041f1,%rax
+  802704:	00 00 00 
+  802707:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802709:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80270c:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802713:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802717:	ba 10 00 00 00       	mov    $0x10,%edx
+  80271c:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802723:	00 00 00 
+  802726:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  80272d:	00 00 00 
+  802730:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802732:	4c 89 f7             	mov    %r14,%rdi
+  802735:	48 b8 8a 21 80 00 00 	movabs $0x80218a,%rax
+  80273c:	00 00 00 
+  80273f:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802741:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802748:	4c 89 f7             	mov    %r14,%rdi
+  80274b:	48 b8 b4 42 80 00 00 	movabs $0x8042b4,%rax
+  802752:	00 00 00 
+  802755:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802757:	4c 89 f7             	mov    %r14,%rdi
+  80275a:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  802761:	00 00 00 
+  802764:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802766:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802769:	41 83 fc 05          	cmp    $0x5,%r12d
+  80276d:	75 04                	jne    802773 <fsipc+0x137>
+  80276f:	85 db                	test   %ebx,%ebx
+  802771:	79 14                	jns    802787 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802773:	4c 89 f7             	mov    %r14,%rdi
+  802776:	48 b8 69 42 80 00 00 	movabs $0x804269,%rax
+  80277d:	00 00 00 
+  802780:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802782:	e9 4b ff ff ff       	jmp    8026d2 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802787:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80278b:	ba 88 00 00 00       	mov    $0x88,%edx
+  802790:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802797:	00 00 00 
+  80279a:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  8027a1:	00 00 00 
+  8027a4:	ff d0                	call   *%rax
+  8027a6:	eb cb                	jmp    802773 <fsipc+0x137>
+
+00000000008027a8 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8027a8:	55                   	push   %rbp
+  8027a9:	48 89 e5             	mov    %rsp,%rbp
+  8027ac:	41 57                	push   %r15
+  8027ae:	41 56                	push   %r14
+  8027b0:	41 55                	push   %r13
+  8027b2:	41 54                	push   %r12
+  8027b4:	53                   	push   %rbx
+  8027b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8027b9:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8027bd:	49 89 f6             	mov    %rsi,%r14
+  8027c0:	49 89 d4             	mov    %rdx,%r12
+  8027c3:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8027c6:	48 b8 ee 20 80 00 00 	movabs $0x8020ee,%rax
+  8027cd:	00 00 00 
+  8027d0:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027d2:	48 85 c0             	test   %rax,%rax
+  8027d5:	0f 85 96 00 00 00    	jne    802871 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8027db:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027e2:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027e3:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8027ea:	00 00 00 
+    while (n) {
+  8027ed:	4d 85 e4             	test   %r12,%r12
+  8027f0:	74 79                	je     80286b <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8027f2:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8027f7:	49 39 dc             	cmp    %rbx,%r12
+  8027fa:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8027fe:	48 89 da             	mov    %rbx,%rdx
+  802801:	4c 89 f6             	mov    %r14,%rsi
+  802804:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80280b:	00 00 00 
+  80280e:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  802815:	00 00 00 
+  802818:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80281a:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80281e:	8b 40 0c             	mov    0xc(%rax),%eax
+  802821:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802824:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802827:	44 01 e8             	add    %r13d,%eax
+  80282a:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80282e:	41 0f 44 c5          	cmove  %r13d,%eax
+  802832:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802836:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  80283a:	48 89 da             	mov    %rbx,%rdx
+  80283d:	be 00 00 00 00       	mov    $0x0,%esi
+  802842:	bf 04 00 00 00       	mov    $0x4,%edi
+  802847:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  80284e:	00 00 00 
+  802851:	ff d0                	call   *%rax
+        if (res < 0)
+  802853:	85 c0                	test   %eax,%eax
+  802855:	78 4a                	js     8028a1 <devfile_write_direct+0xf9>
+        buf += res;
+  802857:	48 98                	cltq
+  802859:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80285c:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802860:	49 29 c4             	sub    %rax,%r12
+  802863:	75 8d                	jne    8027f2 <devfile_write_direct+0x4a>
+    return write;
+  802865:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802869:	eb 27                	jmp    802892 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80286b:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80286f:	eb f4                	jmp    802865 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802871:	45 89 e9             	mov    %r13d,%r9d
+  802874:	4d 89 e0             	mov    %r12,%r8
+  802877:	4c 89 f1             	mov    %r14,%rcx
+  80287a:	ba 04 00 00 00       	mov    $0x4,%edx
+  80287f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802883:	48 89 c7             	mov    %rax,%rdi
+  802886:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  80288d:	00 00 00 
+  802890:	ff d0                	call   *%rax
+}
+  802892:	48 83 c4 18          	add    $0x18,%rsp
+  802896:	5b                   	pop    %rbx
+  802897:	41 5c                	pop    %r12
+  802899:	41 5d                	pop    %r13
+  80289b:	41 5e                	pop    %r14
+  80289d:	41 5f                	pop    %r15
+  80289f:	5d                   	pop    %rbp
+  8028a0:	c3                   	ret
+            return res;
+  8028a1:	48 98                	cltq
+  8028a3:	eb ed                	jmp    802892 <devfile_write_direct+0xea>
+
+00000000008028a5 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8028a5:	55                   	push   %rbp
+  8028a6:	48 89 e5             	mov    %rsp,%rbp
+  8028a9:	41 54                	push   %r12
+  8028ab:	53                   	push   %rbx
+  8028ac:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8028af:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  8028b6:	00 00 00 
+  8028b9:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8028bb:	48 85 c0             	test   %rax,%rax
+  8028be:	74 71                	je     802931 <fbuf_flush+0x8c>
+  8028c0:	48 89 c3             	mov    %rax,%rbx
+  8028c3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028c8:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8028cc:	75 05                	jne    8028d3 <fbuf_flush+0x2e>
+}
+  8028ce:	5b                   	pop    %rbx
+  8028cf:	41 5c                	pop    %r12
+  8028d1:	5d                   	pop    %rbp
+  8028d2:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8028d3:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8028d6:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8028da:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8028e1:	00 00 00 
+  8028e4:	48 89 de             	mov    %rbx,%rsi
+  8028e7:	48 29 c6             	sub    %rax,%rsi
+  8028ea:	48 c1 fe 03          	sar    $0x3,%rsi
+  8028ee:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8028f5:	aa aa aa 
+  8028f8:	48 0f af f0          	imul   %rax,%rsi
+  8028fc:	48 c1 e6 0e          	shl    $0xe,%rsi
+  802900:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802905:	48 01 c6             	add    %rax,%rsi
+  802908:	4c 89 e7             	mov    %r12,%rdi
+  80290b:	48 b8 a8 27 80 00 00 	movabs $0x8027a8,%rax
+  802912:	00 00 00 
+  802915:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802917:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  80291b:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802922:	00 
+    return res < 0 ? res : 0;
+  802923:	48 85 c0             	test   %rax,%rax
+  802926:	ba 00 00 00 00       	mov    $0x0,%edx
+  80292b:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80292f:	eb 9d                	jmp    8028ce <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802931:	b8 00 00 00 00       	mov    $0x0,%eax
+  802936:	eb 96                	jmp    8028ce <fbuf_flush+0x29>
+
+0000000000802938 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802938:	55                   	push   %rbp
+  802939:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  80293c:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802943:	00 00 00 
+  802946:	ff d0                	call   *%rax
+}
+  802948:	5d                   	pop    %rbp
+  802949:	c3                   	ret
+
+000000000080294a <devfile_write>:
+    if (!fd || !buf)
+  80294a:	48 85 ff             	test   %rdi,%rdi
+  80294d:	0f 84 d3 01 00 00    	je     802b26 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802953:	55                   	push   %rbp
+  802954:	48 89 e5             	mov    %rsp,%rbp
+  802957:	41 57                	push   %r15
+  802959:	41 56                	push   %r14
+  80295b:	41 55                	push   %r13
+  80295d:	41 54                	push   %r12
+  80295f:	53                   	push   %rbx
+  802960:	48 83 ec 08          	sub    $0x8,%rsp
+  802964:	49 89 fc             	mov    %rdi,%r12
+  802967:	49 89 f6             	mov    %rsi,%r14
+  80296a:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  80296d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802972:	48 85 f6             	test   %rsi,%rsi
+  802975:	0f 84 9c 01 00 00    	je     802b17 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  80297b:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  802982:	00 00 00 
+  802985:	ff d0                	call   *%rax
+  802987:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  80298a:	48 85 c0             	test   %rax,%rax
+  80298d:	0f 84 a2 00 00 00    	je     802a35 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802993:	be 00 10 00 00       	mov    $0x1000,%esi
+  802998:	4c 89 e7             	mov    %r12,%rdi
+  80299b:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  8029a2:	00 00 00 
+  8029a5:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8029a7:	83 f8 02             	cmp    $0x2,%eax
+  8029aa:	0f 8f 85 00 00 00    	jg     802a35 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8029b0:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029b7:	00 00 00 
+  8029ba:	4d 89 ef             	mov    %r13,%r15
+  8029bd:	49 29 c7             	sub    %rax,%r15
+  8029c0:	49 c1 ff 03          	sar    $0x3,%r15
+  8029c4:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8029cb:	aa aa aa 
+  8029ce:	4c 0f af f8          	imul   %rax,%r15
+  8029d2:	49 c1 e7 0e          	shl    $0xe,%r15
+  8029d6:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8029db:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8029de:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8029e3:	0f 84 d7 00 00 00    	je     802ac0 <devfile_write+0x176>
+  8029e9:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8029ed:	89 c2                	mov    %eax,%edx
+  8029ef:	41 03 55 0c          	add    0xc(%r13),%edx
+  8029f3:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  8029f8:	75 0f                	jne    802a09 <devfile_write+0xbf>
+  8029fa:	48 01 d8             	add    %rbx,%rax
+  8029fd:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a03:	0f 86 92 00 00 00    	jbe    802a9b <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a09:	4c 89 e7             	mov    %r12,%rdi
+  802a0c:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802a13:	00 00 00 
+  802a16:	ff d0                	call   *%rax
+  802a18:	85 c0                	test   %eax,%eax
+  802a1a:	78 52                	js     802a6e <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a1c:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a23:	77 7f                	ja     802aa4 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802a25:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a2a:	0f 85 c2 00 00 00    	jne    802af2 <devfile_write+0x1a8>
+  802a30:	e9 94 00 00 00       	jmp    802ac9 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802a35:	4c 89 e7             	mov    %r12,%rdi
+  802a38:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802a3f:	00 00 00 
+  802a42:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a44:	85 c0                	test   %eax,%eax
+  802a46:	79 07                	jns    802a4f <devfile_write+0x105>
+  802a48:	48 98                	cltq
+  802a4a:	e9 c8 00 00 00       	jmp    802b17 <devfile_write+0x1cd>
+  802a4f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802a54:	48 89 da             	mov    %rbx,%rdx
+  802a57:	4c 89 f6             	mov    %r14,%rsi
+  802a5a:	4c 89 e7             	mov    %r12,%rdi
+  802a5d:	48 b8 a8 27 80 00 00 	movabs $0x8027a8,%rax
+  802a64:	00 00 00 
+  802a67:	ff d0                	call   *%rax
+  802a69:	e9 a9 00 00 00       	jmp    802b17 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a6e:	48 98                	cltq
+  802a70:	e9 a2 00 00 00       	jmp    802b17 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802a75:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a7a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802a7f:	4c 89 fe             	mov    %r15,%rsi
+  802a82:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a87:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  802a8e:	00 00 00 
+  802a91:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802a93:	85 c0                	test   %eax,%eax
+  802a95:	79 45                	jns    802adc <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802a97:	48 98                	cltq
+  802a99:	eb 7c                	jmp    802b17 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a9b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802aa2:	76 4e                	jbe    802af2 <devfile_write+0x1a8>
+  802aa4:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802aa9:	48 89 da             	mov    %rbx,%rdx
+  802aac:	4c 89 f6             	mov    %r14,%rsi
+  802aaf:	4c 89 e7             	mov    %r12,%rdi
+  802ab2:	48 b8 a8 27 80 00 00 	movabs $0x8027a8,%rax
+  802ab9:	00 00 00 
+  802abc:	ff d0                	call   *%rax
+  802abe:	eb 57                	jmp    802b17 <devfile_write+0x1cd>
+  802ac0:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ac7:	77 db                	ja     802aa4 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802ac9:	4c 89 ff             	mov    %r15,%rdi
+  802acc:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  802ad3:	00 00 00 
+  802ad6:	ff d0                	call   *%rax
+  802ad8:	84 c0                	test   %al,%al
+  802ada:	74 99                	je     802a75 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802adc:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802ae1:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802ae6:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802aea:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802af1:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802af2:	4c 89 ff             	mov    %r15,%rdi
+  802af5:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802af9:	48 89 da             	mov    %rbx,%rdx
+  802afc:	4c 89 f6             	mov    %r14,%rsi
+  802aff:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  802b06:	00 00 00 
+  802b09:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b0b:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b0f:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b14:	48 89 d8             	mov    %rbx,%rax
+}
+  802b17:	48 83 c4 08          	add    $0x8,%rsp
+  802b1b:	5b                   	pop    %rbx
+  802b1c:	41 5c                	pop    %r12
+  802b1e:	41 5d                	pop    %r13
+  802b20:	41 5e                	pop    %r14
+  802b22:	41 5f                	pop    %r15
+  802b24:	5d                   	pop    %rbp
+  802b25:	c3                   	ret
+        return E_INVAL;
+  802b26:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802b2b:	c3                   	ret
+
+0000000000802b2c <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b2c:	55                   	push   %rbp
+  802b2d:	48 89 e5             	mov    %rsp,%rbp
+  802b30:	41 54                	push   %r12
+  802b32:	53                   	push   %rbx
+  802b33:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802b36:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802b3d:	00 00 00 
+  802b40:	ff d0                	call   *%rax
+  802b42:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802b45:	48 89 df             	mov    %rbx,%rdi
+  802b48:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  802b4f:	00 00 00 
+  802b52:	ff d0                	call   *%rax
+  802b54:	48 85 c0             	test   %rax,%rax
+  802b57:	74 17                	je     802b70 <devfile_flush+0x44>
+  802b59:	48 89 df             	mov    %rbx,%rdi
+  802b5c:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  802b63:	00 00 00 
+  802b66:	ff d0                	call   *%rax
+  802b68:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802b6f:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802b70:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b73:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802b7a:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802b7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b81:	be 00 00 00 00       	mov    $0x0,%esi
+  802b86:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b8b:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  802b92:	00 00 00 
+  802b95:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802b97:	45 85 e4             	test   %r12d,%r12d
+  802b9a:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802b9e:	5b                   	pop    %rbx
+  802b9f:	41 5c                	pop    %r12
+  802ba1:	5d                   	pop    %rbp
+  802ba2:	c3                   	ret
+
+0000000000802ba3 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802ba3:	55                   	push   %rbp
+  802ba4:	48 89 e5             	mov    %rsp,%rbp
+  802ba7:	41 57                	push   %r15
+  802ba9:	41 56                	push   %r14
+  802bab:	41 55                	push   %r13
+  802bad:	41 54                	push   %r12
+  802baf:	53                   	push   %rbx
+  802bb0:	48 83 ec 38          	sub    $0x38,%rsp
+  802bb4:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802bb8:	49 89 f7             	mov    %rsi,%r15
+  802bbb:	48 89 d3             	mov    %rdx,%rbx
+  802bbe:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802bc1:	48 b8 ee 20 80 00 00 	movabs $0x8020ee,%rax
+  802bc8:	00 00 00 
+  802bcb:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802bcd:	48 85 c0             	test   %rax,%rax
+  802bd0:	75 20                	jne    802bf2 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802bd2:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802bd7:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802bde:	00 
+    while (n) {
+  802bdf:	48 85 db             	test   %rbx,%rbx
+  802be2:	0f 85 df 00 00 00    	jne    802cc7 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802be8:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802bec:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bf0:	eb 21                	jmp    802c13 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802bf2:	45 89 f1             	mov    %r14d,%r9d
+  802bf5:	49 89 d8             	mov    %rbx,%r8
+  802bf8:	4c 89 f9             	mov    %r15,%rcx
+  802bfb:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c00:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c04:	48 89 c7             	mov    %rax,%rdi
+  802c07:	48 b8 d5 21 80 00 00 	movabs $0x8021d5,%rax
+  802c0e:	00 00 00 
+  802c11:	ff d0                	call   *%rax
+}
+  802c13:	48 83 c4 38          	add    $0x38,%rsp
+  802c17:	5b                   	pop    %rbx
+  802c18:	41 5c                	pop    %r12
+  802c1a:	41 5d                	pop    %r13
+  802c1c:	41 5e                	pop    %r14
+  802c1e:	41 5f                	pop    %r15
+  802c20:	5d                   	pop    %rbp
+  802c21:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c22:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c26:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c2c:	75 1e                	jne    802c4c <devfile_read_direct+0xa9>
+  802c2e:	e9 e2 00 00 00       	jmp    802d15 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802c33:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c37:	eb da                	jmp    802c13 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802c39:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802c3d:	0f 85 d0 01 00 00    	jne    802e13 <devfile_read_direct+0x270>
+            map = 0;
+  802c43:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c47:	eb 03                	jmp    802c4c <devfile_read_direct+0xa9>
+  802c49:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802c4c:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802c51:	48 39 d3             	cmp    %rdx,%rbx
+  802c54:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c58:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c5c:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c5f:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802c66:	00 00 00 
+  802c69:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802c6b:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802c6f:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802c73:	be 00 00 00 00       	mov    $0x0,%esi
+  802c78:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c7d:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  802c84:	00 00 00 
+  802c87:	ff d0                	call   *%rax
+        if (res <= 0)
+  802c89:	85 c0                	test   %eax,%eax
+  802c8b:	0f 8e 63 01 00 00    	jle    802df4 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802c91:	4c 63 e0             	movslq %eax,%r12
+  802c94:	4c 89 e2             	mov    %r12,%rdx
+  802c97:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802c9e:	00 00 00 
+  802ca1:	4c 89 ff             	mov    %r15,%rdi
+  802ca4:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  802cab:	00 00 00 
+  802cae:	ff d0                	call   *%rax
+        buf += res;
+  802cb0:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802cb3:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802cb6:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802cba:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802cbe:	48 85 db             	test   %rbx,%rbx
+  802cc1:	0f 84 25 ff ff ff    	je     802bec <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802cc7:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802cca:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802cce:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802cd2:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802cd6:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802cdd:	0f 97 c2             	seta   %dl
+  802ce0:	20 c2                	and    %al,%dl
+  802ce2:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802ce5:	0f 84 5e ff ff ff    	je     802c49 <devfile_read_direct+0xa6>
+  802ceb:	4c 89 fa             	mov    %r15,%rdx
+  802cee:	4d 89 fd             	mov    %r15,%r13
+  802cf1:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802cf8:	0f 85 4e ff ff ff    	jne    802c4c <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802cfe:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d02:	0f 84 1a ff ff ff    	je     802c22 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d08:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d0f:	0f 85 37 ff ff ff    	jne    802c4c <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d15:	48 89 d8             	mov    %rbx,%rax
+  802d18:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d1e:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d23:	48 39 c8             	cmp    %rcx,%rax
+  802d26:	48 0f 47 c1          	cmova  %rcx,%rax
+  802d2a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802d2e:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802d32:	49 89 d4             	mov    %rdx,%r12
+  802d35:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802d39:	48 b8 14 40 80 00 00 	movabs $0x804014,%rax
+  802d40:	00 00 00 
+  802d43:	ff d0                	call   *%rax
+  802d45:	a8 40                	test   $0x40,%al
+  802d47:	0f 85 b9 00 00 00    	jne    802e06 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802d4d:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802d54:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d58:	49 39 c5             	cmp    %rax,%r13
+  802d5b:	72 d8                	jb     802d35 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d5d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d61:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802d68:	00 00 00 
+  802d6b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d6f:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802d72:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802d74:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802d78:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802d7c:	48 b8 89 1f 80 00 00 	movabs $0x801f89,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+  802d88:	89 c7                	mov    %eax,%edi
+  802d8a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802d90:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802d95:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802d9c:	00 00 00 
+  802d9f:	be 0e 00 00 00       	mov    $0xe,%esi
+  802da4:	48 b8 a2 17 80 00 00 	movabs $0x8017a2,%rax
+  802dab:	00 00 00 
+  802dae:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802db0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802db5:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802db9:	4c 89 fe             	mov    %r15,%rsi
+  802dbc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dc1:	48 b8 7e 17 80 00 00 	movabs $0x80177e,%rax
+  802dc8:	00 00 00 
+  802dcb:	ff d0                	call   *%rax
+  802dcd:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802dd0:	48 85 d2             	test   %rdx,%rdx
+  802dd3:	0f 84 5a fe ff ff    	je     802c33 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802dd9:	0f 8e 5a fe ff ff    	jle    802c39 <devfile_read_direct+0x96>
+                buf += res;
+  802ddf:	48 98                	cltq
+  802de1:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802de4:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802de7:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802deb:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802def:	e9 ca fe ff ff       	jmp    802cbe <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802df4:	41 89 c5             	mov    %eax,%r13d
+  802df7:	48 98                	cltq
+  802df9:	45 85 ed             	test   %r13d,%r13d
+  802dfc:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e01:	e9 0d fe ff ff       	jmp    802c13 <devfile_read_direct+0x70>
+            map = 0;
+  802e06:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e0a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e0e:	e9 39 fe ff ff       	jmp    802c4c <devfile_read_direct+0xa9>
+  802e13:	48 89 d0             	mov    %rdx,%rax
+  802e16:	e9 f8 fd ff ff       	jmp    802c13 <devfile_read_direct+0x70>
+
+0000000000802e1b <devfile_read>:
+    if (!fd || !buf)
+  802e1b:	48 85 ff             	test   %rdi,%rdi
+  802e1e:	0f 84 21 02 00 00    	je     803045 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e24:	55                   	push   %rbp
+  802e25:	48 89 e5             	mov    %rsp,%rbp
+  802e28:	41 57                	push   %r15
+  802e2a:	41 56                	push   %r14
+  802e2c:	41 55                	push   %r13
+  802e2e:	41 54                	push   %r12
+  802e30:	53                   	push   %rbx
+  802e31:	48 83 ec 28          	sub    $0x28,%rsp
+  802e35:	48 89 fb             	mov    %rdi,%rbx
+  802e38:	49 89 f4             	mov    %rsi,%r12
+  802e3b:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802e3e:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e43:	48 85 f6             	test   %rsi,%rsi
+  802e46:	74 4b                	je     802e93 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802e48:	48 b8 58 21 80 00 00 	movabs $0x802158,%rax
+  802e4f:	00 00 00 
+  802e52:	ff d0                	call   *%rax
+  802e54:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e57:	48 85 c0             	test   %rax,%rax
+  802e5a:	74 22                	je     802e7e <devfile_read+0x63>
+  802e5c:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802e63:	77 19                	ja     802e7e <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802e65:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e6a:	48 89 df             	mov    %rbx,%rdi
+  802e6d:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  802e74:	00 00 00 
+  802e77:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e79:	83 f8 02             	cmp    $0x2,%eax
+  802e7c:	7e 40                	jle    802ebe <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802e7e:	48 89 df             	mov    %rbx,%rdi
+  802e81:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802e88:	00 00 00 
+  802e8b:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802e8d:	85 c0                	test   %eax,%eax
+  802e8f:	79 11                	jns    802ea2 <devfile_read+0x87>
+  802e91:	48 98                	cltq
+}
+  802e93:	48 83 c4 28          	add    $0x28,%rsp
+  802e97:	5b                   	pop    %rbx
+  802e98:	41 5c                	pop    %r12
+  802e9a:	41 5d                	pop    %r13
+  802e9c:	41 5e                	pop    %r14
+  802e9e:	41 5f                	pop    %r15
+  802ea0:	5d                   	pop    %rbp
+  802ea1:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ea2:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ea7:	4c 89 ea             	mov    %r13,%rdx
+  802eaa:	4c 89 e6             	mov    %r12,%rsi
+  802ead:	48 89 df             	mov    %rbx,%rdi
+  802eb0:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  802eb7:	00 00 00 
+  802eba:	ff d0                	call   *%rax
+  802ebc:	eb d5                	jmp    802e93 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802ebe:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ec2:	48 89 df             	mov    %rbx,%rdi
+  802ec5:	48 b8 a5 28 80 00 00 	movabs $0x8028a5,%rax
+  802ecc:	00 00 00 
+  802ecf:	ff d0                	call   *%rax
+  802ed1:	85 c0                	test   %eax,%eax
+  802ed3:	0f 88 33 01 00 00    	js     80300c <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ed9:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802ee0:	00 00 00 
+  802ee3:	4c 89 f0             	mov    %r14,%rax
+  802ee6:	48 29 d0             	sub    %rdx,%rax
+  802ee9:	48 c1 f8 03          	sar    $0x3,%rax
+  802eed:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802ef4:	aa aa aa 
+  802ef7:	48 0f af c2          	imul   %rdx,%rax
+  802efb:	48 c1 e0 0e          	shl    $0xe,%rax
+  802eff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f03:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f06:	41 39 06             	cmp    %eax,(%r14)
+  802f09:	75 0d                	jne    802f18 <devfile_read+0xfd>
+  802f0b:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f0e:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f12:	0f 84 fb 00 00 00    	je     803013 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f18:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f1d:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f21:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802f24:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f28:	48 89 c7             	mov    %rax,%rdi
+  802f2b:	48 b8 73 40 80 00 00 	movabs $0x804073,%rax
+  802f32:	00 00 00 
+  802f35:	ff d0                	call   *%rax
+  802f37:	84 c0                	test   %al,%al
+  802f39:	75 27                	jne    802f62 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f3b:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f40:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f45:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f49:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f4e:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  802f55:	00 00 00 
+  802f58:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802f5a:	85 c0                	test   %eax,%eax
+  802f5c:	0f 88 dc 00 00 00    	js     80303e <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802f62:	44 89 f8             	mov    %r15d,%eax
+  802f65:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802f6a:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802f6c:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802f73:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802f74:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f77:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802f7b:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802f7e:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f83:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f87:	48 89 df             	mov    %rbx,%rdi
+  802f8a:	48 b8 a3 2b 80 00 00 	movabs $0x802ba3,%rax
+  802f91:	00 00 00 
+  802f94:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802f96:	48 85 c0             	test   %rax,%rax
+  802f99:	0f 88 f4 fe ff ff    	js     802e93 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802f9f:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802fa2:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802fa5:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802fa8:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802fac:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802fb0:	48 63 d1             	movslq %ecx,%rdx
+  802fb3:	48 01 d0             	add    %rdx,%rax
+  802fb6:	4d 63 ff             	movslq %r15d,%r15
+  802fb9:	4c 29 f8             	sub    %r15,%rax
+  802fbc:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fc1:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802fc5:	48 85 c0             	test   %rax,%rax
+  802fc8:	0f 8e c5 fe ff ff    	jle    802e93 <devfile_read+0x78>
+    n = MIN(n, res);
+  802fce:	4c 39 e8             	cmp    %r13,%rax
+  802fd1:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802fd5:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fd8:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802fdc:	48 63 f6             	movslq %esi,%rsi
+  802fdf:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802fe4:	48 01 c6             	add    %rax,%rsi
+  802fe7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802feb:	48 01 c6             	add    %rax,%rsi
+  802fee:	4c 89 ea             	mov    %r13,%rdx
+  802ff1:	4c 89 e7             	mov    %r12,%rdi
+  802ff4:	48 b8 3f 0e 80 00 00 	movabs $0x800e3f,%rax
+  802ffb:	00 00 00 
+  802ffe:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803000:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803004:	4c 89 e8             	mov    %r13,%rax
+  803007:	e9 87 fe ff ff       	jmp    802e93 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80300c:	48 98                	cltq
+  80300e:	e9 80 fe ff ff       	jmp    802e93 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803013:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803017:	41 39 d7             	cmp    %edx,%r15d
+  80301a:	0f 8c f8 fe ff ff    	jl     802f18 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803020:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803024:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803027:	41 39 cf             	cmp    %ecx,%r15d
+  80302a:	0f 8d e8 fe ff ff    	jge    802f18 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803030:	4d 63 ff             	movslq %r15d,%r15
+  803033:	4c 29 f8             	sub    %r15,%rax
+  803036:	48 63 d2             	movslq %edx,%rdx
+  803039:	48 01 d0             	add    %rdx,%rax
+  80303c:	eb 87                	jmp    802fc5 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80303e:	48 98                	cltq
+  803040:	e9 4e fe ff ff       	jmp    802e93 <devfile_read+0x78>
+        return E_INVAL;
+  803045:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  80304a:	c3                   	ret
+
+000000000080304b <fs_channel>:
+fs_channel(bool enable) {
+  80304b:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  80304d:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803054:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803056:	ba 00 00 00 00       	mov    $0x0,%edx
+  80305b:	40 84 ff             	test   %dil,%dil
+  80305e:	74 47                	je     8030a7 <fs_channel+0x5c>
+  803060:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803067:	00 00 00 
+  80306a:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803070:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803077:	00 00 00 
+  80307a:	3b 08                	cmp    (%rax),%ecx
+  80307c:	74 29                	je     8030a7 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80307e:	55                   	push   %rbp
+  80307f:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803082:	48 b8 cb 1f 80 00 00 	movabs $0x801fcb,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+  80308e:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803090:	85 c0                	test   %eax,%eax
+  803092:	78 04                	js     803098 <fs_channel+0x4d>
+}
+  803094:	89 d0                	mov    %edx,%eax
+  803096:	5d                   	pop    %rbp
+  803097:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803098:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80309f:	00 00 00 
+  8030a2:	c6 00 00             	movb   $0x0,(%rax)
+  8030a5:	eb ed                	jmp    803094 <fs_channel+0x49>
+}
+  8030a7:	89 d0                	mov    %edx,%eax
+  8030a9:	c3                   	ret
+
+00000000008030aa <open>:
+open(const char *path, int mode) {
+  8030aa:	55                   	push   %rbp
+  8030ab:	48 89 e5             	mov    %rsp,%rbp
+  8030ae:	41 55                	push   %r13
+  8030b0:	41 54                	push   %r12
+  8030b2:	53                   	push   %rbx
+  8030b3:	48 83 ec 18          	sub    $0x18,%rsp
+  8030b7:	49 89 fc             	mov    %rdi,%r12
+  8030ba:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8030bd:	48 b8 a0 0b 80 00 00 	movabs $0x800ba0,%rax
+  8030c4:	00 00 00 
+  8030c7:	ff d0                	call   *%rax
+  8030c9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030cf:	0f 87 8f 00 00 00    	ja     803164 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8030d5:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030d9:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  8030e0:	00 00 00 
+  8030e3:	ff d0                	call   *%rax
+  8030e5:	89 c3                	mov    %eax,%ebx
+  8030e7:	85 c0                	test   %eax,%eax
+  8030e9:	78 55                	js     803140 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8030eb:	4c 89 e6             	mov    %r12,%rsi
+  8030ee:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8030f5:	00 00 00 
+  8030f8:	48 89 df             	mov    %rbx,%rdi
+  8030fb:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  803102:	00 00 00 
+  803105:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803107:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80310e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803113:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803117:	bf 01 00 00 00       	mov    $0x1,%edi
+  80311c:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  803123:	00 00 00 
+  803126:	ff d0                	call   *%rax
+  803128:	89 c3                	mov    %eax,%ebx
+  80312a:	85 c0                	test   %eax,%eax
+  80312c:	78 1f                	js     80314d <open+0xa3>
+    return fd2num(fd);
+  80312e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803132:	48 b8 57 18 80 00 00 	movabs $0x801857,%rax
+  803139:	00 00 00 
+  80313c:	ff d0                	call   *%rax
+  80313e:	89 c3                	mov    %eax,%ebx
+}
+  803140:	89 d8                	mov    %ebx,%eax
+  803142:	48 83 c4 18          	add    $0x18,%rsp
+  803146:	5b                   	pop    %rbx
+  803147:	41 5c                	pop    %r12
+  803149:	41 5d                	pop    %r13
+  80314b:	5d                   	pop    %rbp
+  80314c:	c3                   	ret
+        fd_close(fd, 0);
+  80314d:	be 00 00 00 00       	mov    $0x0,%esi
+  803152:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803156:	48 b8 a0 19 80 00 00 	movabs $0x8019a0,%rax
+  80315d:	00 00 00 
+  803160:	ff d0                	call   *%rax
+        return res;
+  803162:	eb dc                	jmp    803140 <open+0x96>
+        return -E_BAD_PATH;
+  803164:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803169:	eb d5                	jmp    803140 <open+0x96>
+
+000000000080316b <file_flush_buffers>:
+file_flush_buffers(void) {
+  80316b:	55                   	push   %rbp
+  80316c:	48 89 e5             	mov    %rsp,%rbp
+  80316f:	41 56                	push   %r14
+  803171:	41 55                	push   %r13
+  803173:	41 54                	push   %r12
+  803175:	53                   	push   %rbx
+  803176:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  80317a:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803181:	00 00 00 
+  803184:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803189:	49 bd e5 18 80 00 00 	movabs $0x8018e5,%r13
+  803190:	00 00 00 
+  803193:	49 be a5 28 80 00 00 	movabs $0x8028a5,%r14
+  80319a:	00 00 00 
+  80319d:	eb 0c                	jmp    8031ab <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80319f:	83 c3 01             	add    $0x1,%ebx
+  8031a2:	49 83 c4 18          	add    $0x18,%r12
+  8031a6:	83 fb 20             	cmp    $0x20,%ebx
+  8031a9:	74 1d                	je     8031c8 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031ab:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8031b0:	74 ed                	je     80319f <file_flush_buffers+0x34>
+  8031b2:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031b6:	89 df                	mov    %ebx,%edi
+  8031b8:	41 ff d5             	call   *%r13
+  8031bb:	85 c0                	test   %eax,%eax
+  8031bd:	78 e0                	js     80319f <file_flush_buffers+0x34>
+  8031bf:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031c3:	41 ff d6             	call   *%r14
+  8031c6:	eb d7                	jmp    80319f <file_flush_buffers+0x34>
+}
+  8031c8:	48 83 c4 10          	add    $0x10,%rsp
+  8031cc:	5b                   	pop    %rbx
+  8031cd:	41 5c                	pop    %r12
+  8031cf:	41 5d                	pop    %r13
+  8031d1:	41 5e                	pop    %r14
+  8031d3:	5d                   	pop    %rbp
+  8031d4:	c3                   	ret
+
+00000000008031d5 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8031d5:	55                   	push   %rbp
+  8031d6:	48 89 e5             	mov    %rsp,%rbp
+  8031d9:	41 54                	push   %r12
+  8031db:	53                   	push   %rbx
+  8031dc:	49 89 fc             	mov    %rdi,%r12
+  8031df:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8031e1:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8031e8:	00 00 00 
+  8031eb:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8031ed:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8031f4:	00 00 00 
+  8031f7:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8031fc:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8031fe:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803201:	ba 00 00 00 00       	mov    $0x0,%edx
+  803206:	be 00 00 00 00       	mov    $0x0,%esi
+  80320b:	bf 02 00 00 00       	mov    $0x2,%edi
+  803210:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  803217:	00 00 00 
+  80321a:	ff d0                	call   *%rax
+}
+  80321c:	5b                   	pop    %rbx
+  80321d:	41 5c                	pop    %r12
+  80321f:	5d                   	pop    %rbp
+  803220:	c3                   	ret
+
+0000000000803221 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803221:	55                   	push   %rbp
+  803222:	48 89 e5             	mov    %rsp,%rbp
+  803225:	41 54                	push   %r12
+  803227:	53                   	push   %rbx
+  803228:	49 89 fc             	mov    %rdi,%r12
+  80322b:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80322e:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  803235:	00 00 00 
+  803238:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  80323a:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80323f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803246:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803248:	ba 00 00 00 00       	mov    $0x0,%edx
+  80324d:	be 00 00 00 00       	mov    $0x0,%esi
+  803252:	bf 05 00 00 00       	mov    $0x5,%edi
+  803257:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  80325e:	00 00 00 
+  803261:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803263:	85 c0                	test   %eax,%eax
+  803265:	78 3d                	js     8032a4 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803267:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80326e:	00 00 00 
+  803271:	4c 89 e6             	mov    %r12,%rsi
+  803274:	48 89 df             	mov    %rbx,%rdi
+  803277:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  80327e:	00 00 00 
+  803281:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803283:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  80328a:	00 
+  80328b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803291:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803298:	00 
+  803299:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80329f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032a4:	5b                   	pop    %rbx
+  8032a5:	41 5c                	pop    %r12
+  8032a7:	5d                   	pop    %rbp
+  8032a8:	c3                   	ret
+
+00000000008032a9 <remove>:
+remove(const char *path) {
+  8032a9:	55                   	push   %rbp
+  8032aa:	48 89 e5             	mov    %rsp,%rbp
+  8032ad:	53                   	push   %rbx
+  8032ae:	48 83 ec 08          	sub    $0x8,%rsp
+  8032b2:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8032b5:	48 b8 a0 0b 80 00 00 	movabs $0x800ba0,%rax
+  8032bc:	00 00 00 
+  8032bf:	ff d0                	call   *%rax
+  8032c1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032c7:	77 3a                	ja     803303 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8032c9:	48 89 de             	mov    %rbx,%rsi
+  8032cc:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8032d3:	00 00 00 
+  8032d6:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  8032dd:	00 00 00 
+  8032e0:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8032e2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032e7:	be 00 00 00 00       	mov    $0x0,%esi
+  8032ec:	bf 07 00 00 00       	mov    $0x7,%edi
+  8032f1:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8032f8:	00 00 00 
+  8032fb:	ff d0                	call   *%rax
+}
+  8032fd:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803301:	c9                   	leave
+  803302:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803303:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803308:	eb f3                	jmp    8032fd <remove+0x54>
+
+000000000080330a <sync>:
+sync(void) {
+  80330a:	55                   	push   %rbp
+  80330b:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80330e:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  803315:	00 00 00 
+  803318:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  80331a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80331f:	be 00 00 00 00       	mov    $0x0,%esi
+  803324:	bf 08 00 00 00       	mov    $0x8,%edi
+  803329:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  803330:	00 00 00 
+  803333:	ff d0                	call   *%rax
+}
+  803335:	5d                   	pop    %rbp
+  803336:	c3                   	ret
+
+0000000000803337 <fsync>:
+fsync(int fdnum) {
+  803337:	55                   	push   %rbp
+  803338:	48 89 e5             	mov    %rsp,%rbp
+  80333b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80333f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803343:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  80334a:	00 00 00 
+  80334d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80334f:	85 c0                	test   %eax,%eax
+  803351:	78 4b                	js     80339e <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803353:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803357:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80335e:	00 00 00 
+  803361:	8b 00                	mov    (%rax),%eax
+  803363:	39 02                	cmp    %eax,(%rdx)
+  803365:	75 39                	jne    8033a0 <fsync+0x69>
+    file_flush_buffers();
+  803367:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  80336e:	00 00 00 
+  803371:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803373:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803377:	8b 40 0c             	mov    0xc(%rax),%eax
+  80337a:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803381:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803383:	ba 00 00 00 00       	mov    $0x0,%edx
+  803388:	be 00 00 00 00       	mov    $0x0,%esi
+  80338d:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803392:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  803399:	00 00 00 
+  80339c:	ff d0                	call   *%rax
+}
+  80339e:	c9                   	leave
+  80339f:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033a0:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033a5:	eb f7                	jmp    80339e <fsync+0x67>
+
+00000000008033a7 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8033a7:	55                   	push   %rbp
+  8033a8:	48 89 e5             	mov    %rsp,%rbp
+  8033ab:	53                   	push   %rbx
+  8033ac:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b0:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8033b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033b8:	be 00 00 00 00       	mov    $0x0,%esi
+  8033bd:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8033c2:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  8033c9:	00 00 00 
+  8033cc:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033ce:	85 c0                	test   %eax,%eax
+  8033d0:	78 2d                	js     8033ff <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8033d2:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033d9:	00 00 00 
+  8033dc:	48 8b 10             	mov    (%rax),%rdx
+  8033df:	48 89 13             	mov    %rdx,(%rbx)
+  8033e2:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8033e6:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8033ea:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033ee:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8033f2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8033f6:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8033fa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033ff:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803403:	c9                   	leave
+  803404:	c3                   	ret
+
+0000000000803405 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803405:	55                   	push   %rbp
+  803406:	48 89 e5             	mov    %rsp,%rbp
+  803409:	53                   	push   %rbx
+  80340a:	48 83 ec 08          	sub    $0x8,%rsp
+  80340e:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803411:	ba 00 00 00 00       	mov    $0x0,%edx
+  803416:	be 00 00 00 00       	mov    $0x0,%esi
+  80341b:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803420:	48 b8 3c 26 80 00 00 	movabs $0x80263c,%rax
+  803427:	00 00 00 
+  80342a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80342c:	85 c0                	test   %eax,%eax
+  80342e:	78 3d                	js     80346d <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803430:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803437:	00 00 00 
+  80343a:	48 8b 10             	mov    (%rax),%rdx
+  80343d:	48 89 13             	mov    %rdx,(%rbx)
+  803440:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803444:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803448:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80344c:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803450:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803454:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803458:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80345c:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803460:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803464:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80346d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803471:	c9                   	leave
+  803472:	c3                   	ret
+
+0000000000803473 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803473:	55                   	push   %rbp
+  803474:	48 89 e5             	mov    %rsp,%rbp
+  803477:	41 57                	push   %r15
+  803479:	41 56                	push   %r14
+  80347b:	41 55                	push   %r13
+  80347d:	41 54                	push   %r12
+  80347f:	53                   	push   %rbx
+  803480:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803484:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80348b:	00 
+  80348c:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803493:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803499:	0f 85 43 01 00 00    	jne    8035e2 <munmap+0x16f>
+  80349f:	49 89 ff             	mov    %rdi,%r15
+  8034a2:	4c 39 f7             	cmp    %r14,%rdi
+  8034a5:	0f 87 37 01 00 00    	ja     8035e2 <munmap+0x16f>
+  8034ab:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8034b2:	00 00 00 
+  8034b5:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8034bb:	eb 2c                	jmp    8034e9 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8034bd:	4c 39 f8             	cmp    %r15,%rax
+  8034c0:	0f 83 85 00 00 00    	jae    80354b <munmap+0xd8>
+            m->mm_end = start;
+  8034c6:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8034cb:	48 83 c3 18          	add    $0x18,%rbx
+  8034cf:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8034d6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8034dd:	00 00 00 
+  8034e0:	48 39 c3             	cmp    %rax,%rbx
+  8034e3:	0f 84 d0 00 00 00    	je     8035b9 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8034e9:	49 89 dc             	mov    %rbx,%r12
+  8034ec:	48 8b 03             	mov    (%rbx),%rax
+  8034ef:	4c 39 f0             	cmp    %r14,%rax
+  8034f2:	73 d7                	jae    8034cb <munmap+0x58>
+  8034f4:	48 85 c0             	test   %rax,%rax
+  8034f7:	74 d2                	je     8034cb <munmap+0x58>
+  8034f9:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8034fd:	49 39 d7             	cmp    %rdx,%r15
+  803500:	73 c9                	jae    8034cb <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803502:	49 39 d6             	cmp    %rdx,%r14
+  803505:	73 b6                	jae    8034bd <munmap+0x4a>
+  803507:	49 39 c7             	cmp    %rax,%r15
+  80350a:	76 b1                	jbe    8034bd <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80350c:	4c 89 ef             	mov    %r13,%rdi
+  80350f:	48 b8 aa 25 80 00 00 	movabs $0x8025aa,%rax
+  803516:	00 00 00 
+  803519:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80351b:	48 85 c0             	test   %rax,%rax
+  80351e:	0f 84 c5 00 00 00    	je     8035e9 <munmap+0x176>
+            *tail = *m;
+  803524:	48 8b 13             	mov    (%rbx),%rdx
+  803527:	48 89 10             	mov    %rdx,(%rax)
+  80352a:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80352e:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803532:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803536:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  80353a:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80353d:	44 89 f2             	mov    %r14d,%edx
+  803540:	2b 13                	sub    (%rbx),%edx
+  803542:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803545:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803549:	eb 80                	jmp    8034cb <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80354b:	49 39 d6             	cmp    %rdx,%r14
+  80354e:	73 18                	jae    803568 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803550:	44 89 f2             	mov    %r14d,%edx
+  803553:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803558:	29 c2                	sub    %eax,%edx
+  80355a:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80355f:	4d 89 34 24          	mov    %r14,(%r12)
+  803563:	e9 63 ff ff ff       	jmp    8034cb <munmap+0x58>
+    m->mm_start = 0;
+  803568:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80356f:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803570:	4c 89 e6             	mov    %r12,%rsi
+  803573:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80357a:	00 00 00 
+  80357d:	48 29 c6             	sub    %rax,%rsi
+  803580:	48 c1 fe 03          	sar    $0x3,%rsi
+  803584:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80358b:	aa aa aa 
+  80358e:	48 0f af f0          	imul   %rax,%rsi
+  803592:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803596:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80359b:	48 01 c6             	add    %rax,%rsi
+  80359e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035a3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035a8:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  8035af:	00 00 00 
+  8035b2:	ff d0                	call   *%rax
+}
+  8035b4:	e9 12 ff ff ff       	jmp    8034cb <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8035b9:	4c 89 f2             	mov    %r14,%rdx
+  8035bc:	4c 29 fa             	sub    %r15,%rdx
+  8035bf:	4c 89 fe             	mov    %r15,%rsi
+  8035c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035c7:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  8035ce:	00 00 00 
+  8035d1:	ff d0                	call   *%rax
+}
+  8035d3:	48 83 c4 08          	add    $0x8,%rsp
+  8035d7:	5b                   	pop    %rbx
+  8035d8:	41 5c                	pop    %r12
+  8035da:	41 5d                	pop    %r13
+  8035dc:	41 5e                	pop    %r14
+  8035de:	41 5f                	pop    %r15
+  8035e0:	5d                   	pop    %rbp
+  8035e1:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8035e2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035e7:	eb ea                	jmp    8035d3 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8035e9:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8035ee:	eb e3                	jmp    8035d3 <munmap+0x160>
+
+00000000008035f0 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8035f0:	55                   	push   %rbp
+  8035f1:	48 89 e5             	mov    %rsp,%rbp
+  8035f4:	41 57                	push   %r15
+  8035f6:	41 56                	push   %r14
+  8035f8:	41 55                	push   %r13
+  8035fa:	41 54                	push   %r12
+  8035fc:	53                   	push   %rbx
+  8035fd:	48 83 ec 28          	sub    $0x28,%rsp
+  803601:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803605:	49 89 f5             	mov    %rsi,%r13
+  803608:	41 89 d6             	mov    %edx,%r14d
+  80360b:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80360e:	41 89 cc             	mov    %ecx,%r12d
+  803611:	44 89 c7             	mov    %r8d,%edi
+  803614:	44 89 cb             	mov    %r9d,%ebx
+  803617:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80361b:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80361f:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  803626:	00 00 00 
+  803629:	ff d0                	call   *%rax
+  80362b:	41 89 c7             	mov    %eax,%r15d
+  80362e:	85 c0                	test   %eax,%eax
+  803630:	0f 88 ae 01 00 00    	js     8037e4 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803636:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80363a:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803641:	00 00 00 
+  803644:	8b 32                	mov    (%rdx),%esi
+  803646:	39 30                	cmp    %esi,(%rax)
+  803648:	0f 85 7a 02 00 00    	jne    8038c8 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80364e:	8b 40 08             	mov    0x8(%rax),%eax
+  803651:	83 e0 03             	and    $0x3,%eax
+  803654:	83 f8 01             	cmp    $0x1,%eax
+  803657:	0f 84 76 02 00 00    	je     8038d3 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80365d:	4d 85 ed             	test   %r13,%r13
+  803660:	0f 84 78 02 00 00    	je     8038de <mmap+0x2ee>
+  803666:	85 db                	test   %ebx,%ebx
+  803668:	0f 88 70 02 00 00    	js     8038de <mmap+0x2ee>
+  80366e:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803674:	41 89 df             	mov    %ebx,%r15d
+  803677:	0f 85 6c 02 00 00    	jne    8038e9 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80367d:	44 89 f0             	mov    %r14d,%eax
+  803680:	83 e0 fd             	and    $0xfffffffd,%eax
+  803683:	83 f8 04             	cmp    $0x4,%eax
+  803686:	0f 85 68 02 00 00    	jne    8038f4 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80368c:	44 89 e1             	mov    %r12d,%ecx
+  80368f:	83 e1 01             	and    $0x1,%ecx
+  803692:	0f 95 c2             	setne  %dl
+  803695:	44 89 e0             	mov    %r12d,%eax
+  803698:	d1 e8                	shr    %eax
+  80369a:	83 f0 01             	xor    $0x1,%eax
+  80369d:	83 e0 01             	and    $0x1,%eax
+  8036a0:	38 c2                	cmp    %al,%dl
+  8036a2:	0f 85 57 02 00 00    	jne    8038ff <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036a8:	85 c9                	test   %ecx,%ecx
+  8036aa:	74 0a                	je     8036b6 <mmap+0xc6>
+  8036ac:	41 f6 c6 02          	test   $0x2,%r14b
+  8036b0:	0f 85 54 02 00 00    	jne    80390a <mmap+0x31a>
+    file_flush_buffers();
+  8036b6:	48 b8 6b 31 80 00 00 	movabs $0x80316b,%rax
+  8036bd:	00 00 00 
+  8036c0:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8036c2:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8036c9:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8036d0:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8036d4:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8036d7:	41 f6 c4 04          	test   $0x4,%r12b
+  8036db:	0f 84 15 01 00 00    	je     8037f6 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8036e1:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036e4:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036ea:	0f 85 25 02 00 00    	jne    803915 <mmap+0x325>
+  8036f0:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8036f4:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8036fb:	00 00 00 
+  8036fe:	48 39 c2             	cmp    %rax,%rdx
+  803701:	0f 82 19 02 00 00    	jb     803920 <mmap+0x330>
+  803707:	48 39 c7             	cmp    %rax,%rdi
+  80370a:	0f 87 10 02 00 00    	ja     803920 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803710:	4c 89 ee             	mov    %r13,%rsi
+  803713:	48 b8 73 34 80 00 00 	movabs $0x803473,%rax
+  80371a:	00 00 00 
+  80371d:	ff d0                	call   *%rax
+  80371f:	85 c0                	test   %eax,%eax
+  803721:	0f 88 04 02 00 00    	js     80392b <mmap+0x33b>
+    if (!handler) {
+  803727:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80372e:	00 00 00 
+  803731:	80 38 00             	cmpb   $0x0,(%rax)
+  803734:	75 2b                	jne    803761 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803736:	48 bf 0b 25 80 00 00 	movabs $0x80250b,%rdi
+  80373d:	00 00 00 
+  803740:	48 b8 6f 46 80 00 00 	movabs $0x80466f,%rax
+  803747:	00 00 00 
+  80374a:	ff d0                	call   *%rax
+  80374c:	85 c0                	test   %eax,%eax
+  80374e:	0f 88 ea 01 00 00    	js     80393e <mmap+0x34e>
+        handler = 1;
+  803754:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80375b:	00 00 00 
+  80375e:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803761:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803765:	48 b8 aa 25 80 00 00 	movabs $0x8025aa,%rax
+  80376c:	00 00 00 
+  80376f:	ff d0                	call   *%rax
+  803771:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803774:	48 85 c0             	test   %rax,%rax
+  803777:	0f 84 c9 01 00 00    	je     803946 <mmap+0x356>
+    m->mm_start = va;
+  80377d:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803780:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803784:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803788:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80378b:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80378f:	44 89 e0             	mov    %r12d,%eax
+  803792:	c1 e0 06             	shl    $0x6,%eax
+  803795:	25 80 00 00 00       	and    $0x80,%eax
+  80379a:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80379d:	09 f0                	or     %esi,%eax
+  80379f:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8037a3:	41 f6 c4 08          	test   $0x8,%r12b
+  8037a7:	74 31                	je     8037da <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037a9:	48 39 d3             	cmp    %rdx,%rbx
+  8037ac:	73 2c                	jae    8037da <mmap+0x1ea>
+  8037ae:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8037b3:	48 89 de             	mov    %rbx,%rsi
+  8037b6:	4c 89 f7             	mov    %r14,%rdi
+  8037b9:	48 b8 fa 23 80 00 00 	movabs $0x8023fa,%rax
+  8037c0:	00 00 00 
+  8037c3:	ff d0                	call   *%rax
+  8037c5:	49 89 c4             	mov    %rax,%r12
+  8037c8:	48 85 c0             	test   %rax,%rax
+  8037cb:	0f 8e d7 00 00 00    	jle    8038a8 <mmap+0x2b8>
+            va += n;
+  8037d1:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037d4:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8037d8:	72 d4                	jb     8037ae <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8037da:	49 8b 06             	mov    (%r14),%rax
+  8037dd:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8037e1:	48 89 06             	mov    %rax,(%rsi)
+}
+  8037e4:	44 89 f8             	mov    %r15d,%eax
+  8037e7:	48 83 c4 28          	add    $0x28,%rsp
+  8037eb:	5b                   	pop    %rbx
+  8037ec:	41 5c                	pop    %r12
+  8037ee:	41 5d                	pop    %r13
+  8037f0:	41 5e                	pop    %r14
+  8037f2:	41 5f                	pop    %r15
+  8037f4:	5d                   	pop    %rbp
+  8037f5:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8037f6:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8037fd:	00 00 00 
+  803800:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803803:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  80380a:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80380d:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803812:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803819:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80381c:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803823:	00 00 00 
+  803826:	48 39 d7             	cmp    %rdx,%rdi
+  803829:	73 1c                	jae    803847 <mmap+0x257>
+        return -E_NO_MEM;
+  80382b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803831:	eb b1                	jmp    8037e4 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803833:	48 83 c0 01          	add    $0x1,%rax
+  803837:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80383b:	77 3f                	ja     80387c <mmap+0x28c>
+  80383d:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803842:	48 39 d7             	cmp    %rdx,%rdi
+  803845:	72 2a                	jb     803871 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803847:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80384b:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80384f:	48 39 d1             	cmp    %rdx,%rcx
+  803852:	73 df                	jae    803833 <mmap+0x243>
+  803854:	48 85 c9             	test   %rcx,%rcx
+  803857:	74 da                	je     803833 <mmap+0x243>
+  803859:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80385d:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803862:	48 39 d3             	cmp    %rdx,%rbx
+  803865:	73 cc                	jae    803833 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803867:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80386a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80386f:	eb cc                	jmp    80383d <mmap+0x24d>
+        return -E_NO_MEM;
+  803871:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803877:	e9 68 ff ff ff       	jmp    8037e4 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80387c:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803881:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803888:	00 00 00 
+  80388b:	48 39 c2             	cmp    %rax,%rdx
+  80388e:	0f 82 9f 00 00 00    	jb     803933 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803894:	48 85 db             	test   %rbx,%rbx
+  803897:	0f 85 8a fe ff ff    	jne    803727 <mmap+0x137>
+        return -E_NO_MEM;
+  80389d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038a3:	e9 3c ff ff ff       	jmp    8037e4 <mmap+0x1f4>
+        if (n < 0) {
+  8038a8:	0f 89 2c ff ff ff    	jns    8037da <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8038ae:	49 8b 3e             	mov    (%r14),%rdi
+  8038b1:	4c 89 ee             	mov    %r13,%rsi
+  8038b4:	48 b8 73 34 80 00 00 	movabs $0x803473,%rax
+  8038bb:	00 00 00 
+  8038be:	ff d0                	call   *%rax
+            return n;
+  8038c0:	45 89 e7             	mov    %r12d,%r15d
+  8038c3:	e9 1c ff ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8038c8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038ce:	e9 11 ff ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8038d3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038d9:	e9 06 ff ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8038de:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038e4:	e9 fb fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+  8038e9:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038ef:	e9 f0 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8038f4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038fa:	e9 e5 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8038ff:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803905:	e9 da fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  80390a:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803910:	e9 cf fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803915:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80391b:	e9 c4 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+  803920:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803926:	e9 b9 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80392b:	41 89 c7             	mov    %eax,%r15d
+  80392e:	e9 b1 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803933:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803939:	e9 a6 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80393e:	41 89 c7             	mov    %eax,%r15d
+  803941:	e9 9e fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803946:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80394c:	e9 93 fe ff ff       	jmp    8037e4 <mmap+0x1f4>
+
+0000000000803951 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803951:	55                   	push   %rbp
+  803952:	48 89 e5             	mov    %rsp,%rbp
+  803955:	41 54                	push   %r12
+  803957:	53                   	push   %rbx
+  803958:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80395b:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803962:	00 00 00 
+  803965:	ff d0                	call   *%rax
+  803967:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80396a:	48 be 60 4f 80 00 00 	movabs $0x804f60,%rsi
+  803971:	00 00 00 
+  803974:	48 89 df             	mov    %rbx,%rdi
+  803977:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  80397e:	00 00 00 
+  803981:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803983:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803988:	41 2b 04 24          	sub    (%r12),%eax
+  80398c:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803992:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803999:	00 00 00 
+    stat->st_dev = &devpipe;
+  80399c:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039a3:	00 00 00 
+  8039a6:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039b2:	5b                   	pop    %rbx
+  8039b3:	41 5c                	pop    %r12
+  8039b5:	5d                   	pop    %rbp
+  8039b6:	c3                   	ret
+
+00000000008039b7 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039b7:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8039ba:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8039c0:	8b 17                	mov    (%rdi),%edx
+  8039c2:	85 d2                	test   %edx,%edx
+  8039c4:	75 01                	jne    8039c7 <pipe_wakeup+0x10>
+  8039c6:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039c7:	55                   	push   %rbp
+  8039c8:	48 89 e5             	mov    %rsp,%rbp
+  8039cb:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8039ce:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8039d4:	be 00 04 00 00       	mov    $0x400,%esi
+  8039d9:	48 b8 c9 14 80 00 00 	movabs $0x8014c9,%rax
+  8039e0:	00 00 00 
+  8039e3:	ff d0                	call   *%rax
+}
+  8039e5:	5d                   	pop    %rbp
+  8039e6:	c3                   	ret
+
+00000000008039e7 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039e7:	55                   	push   %rbp
+  8039e8:	48 89 e5             	mov    %rsp,%rbp
+  8039eb:	41 55                	push   %r13
+  8039ed:	41 54                	push   %r12
+  8039ef:	53                   	push   %rbx
+  8039f0:	48 83 ec 08          	sub    $0x8,%rsp
+  8039f4:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039f7:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  8039fe:	00 00 00 
+  803a01:	ff d0                	call   *%rax
+  803a03:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a06:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a0b:	4c 89 e6             	mov    %r12,%rsi
+  803a0e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a13:	49 bc e3 11 80 00 00 	movabs $0x8011e3,%r12
+  803a1a:	00 00 00 
+  803a1d:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a20:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a24:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a28:	49 bd b7 39 80 00 00 	movabs $0x8039b7,%r13
+  803a2f:	00 00 00 
+  803a32:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a35:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a39:	48 89 de             	mov    %rbx,%rsi
+  803a3c:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803a3f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a44:	48 89 de             	mov    %rbx,%rsi
+  803a47:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a4c:	41 ff d4             	call   *%r12
+  803a4f:	48 83 c4 08          	add    $0x8,%rsp
+  803a53:	5b                   	pop    %rbx
+  803a54:	41 5c                	pop    %r12
+  803a56:	41 5d                	pop    %r13
+  803a58:	5d                   	pop    %rbp
+  803a59:	c3                   	ret
+
+0000000000803a5a <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803a5a:	55                   	push   %rbp
+  803a5b:	48 89 e5             	mov    %rsp,%rbp
+  803a5e:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a61:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a66:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a6b:	48 b8 26 11 80 00 00 	movabs $0x801126,%rax
+  803a72:	00 00 00 
+  803a75:	ff d0                	call   *%rax
+  803a77:	85 c0                	test   %eax,%eax
+  803a79:	0f 94 c0             	sete   %al
+  803a7c:	0f b6 c0             	movzbl %al,%eax
+}
+  803a7f:	5d                   	pop    %rbp
+  803a80:	c3                   	ret
+
+0000000000803a81 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a81:	55                   	push   %rbp
+  803a82:	48 89 e5             	mov    %rsp,%rbp
+  803a85:	41 57                	push   %r15
+  803a87:	41 56                	push   %r14
+  803a89:	41 55                	push   %r13
+  803a8b:	41 54                	push   %r12
+  803a8d:	53                   	push   %rbx
+  803a8e:	48 83 ec 38          	sub    $0x38,%rsp
+  803a92:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803a96:	49 89 f4             	mov    %rsi,%r12
+  803a99:	49 89 d7             	mov    %rdx,%r15
+  803a9c:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803aa0:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803aa7:	00 00 00 
+  803aaa:	ff d0                	call   *%rax
+  803aac:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803aaf:	4d 85 ff             	test   %r15,%r15
+  803ab2:	0f 84 f1 00 00 00    	je     803ba9 <devpipe_write+0x128>
+  803ab8:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803abc:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803ac0:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803ac4:	49 bd 5a 3a 80 00 00 	movabs $0x803a5a,%r13
+  803acb:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ace:	49 bf b7 39 80 00 00 	movabs $0x8039b7,%r15
+  803ad5:	00 00 00 
+  803ad8:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803adc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803ae0:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803ae4:	8b 73 04             	mov    0x4(%rbx),%esi
+  803ae7:	48 63 ce             	movslq %esi,%rcx
+  803aea:	48 63 03             	movslq (%rbx),%rax
+  803aed:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803af3:	48 39 c1             	cmp    %rax,%rcx
+  803af6:	72 64                	jb     803b5c <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803af8:	48 89 de             	mov    %rbx,%rsi
+  803afb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aff:	41 ff d5             	call   *%r13
+  803b02:	85 c0                	test   %eax,%eax
+  803b04:	0f 85 b9 00 00 00    	jne    803bc3 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b0a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b0e:	4c 89 f7             	mov    %r14,%rdi
+  803b11:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b14:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b17:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b1e:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b25:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b2b:	8b 03                	mov    (%rbx),%eax
+  803b2d:	41 39 c4             	cmp    %eax,%r12d
+  803b30:	75 b2                	jne    803ae4 <devpipe_write+0x63>
+  803b32:	48 89 de             	mov    %rbx,%rsi
+  803b35:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b39:	41 ff d5             	call   *%r13
+  803b3c:	85 c0                	test   %eax,%eax
+  803b3e:	75 a0                	jne    803ae0 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b40:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b45:	44 89 e6             	mov    %r12d,%esi
+  803b48:	48 89 df             	mov    %rbx,%rdi
+  803b4b:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  803b52:	00 00 00 
+  803b55:	ff d0                	call   *%rax
+  803b57:	e9 7c ff ff ff       	jmp    803ad8 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b5c:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803b60:	41 0f b6 38          	movzbl (%r8),%edi
+  803b64:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803b6b:	80 80 80 
+  803b6e:	48 89 c8             	mov    %rcx,%rax
+  803b71:	48 f7 e2             	mul    %rdx
+  803b74:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803b78:	48 89 d0             	mov    %rdx,%rax
+  803b7b:	48 c1 e0 08          	shl    $0x8,%rax
+  803b7f:	48 29 d0             	sub    %rdx,%rax
+  803b82:	48 c1 e0 04          	shl    $0x4,%rax
+  803b86:	48 29 c1             	sub    %rax,%rcx
+  803b89:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b8e:	83 c6 01             	add    $0x1,%esi
+  803b91:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b94:	49 83 c0 01          	add    $0x1,%r8
+  803b98:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803b9c:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803ba0:	49 39 c0             	cmp    %rax,%r8
+  803ba3:	0f 85 2f ff ff ff    	jne    803ad8 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ba9:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803bad:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803bb1:	48 b8 b7 39 80 00 00 	movabs $0x8039b7,%rax
+  803bb8:	00 00 00 
+  803bbb:	ff d0                	call   *%rax
+    return n;
+  803bbd:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803bc1:	eb 05                	jmp    803bc8 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bc3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bc8:	48 83 c4 38          	add    $0x38,%rsp
+  803bcc:	5b                   	pop    %rbx
+  803bcd:	41 5c                	pop    %r12
+  803bcf:	41 5d                	pop    %r13
+  803bd1:	41 5e                	pop    %r14
+  803bd3:	41 5f                	pop    %r15
+  803bd5:	5d                   	pop    %rbp
+  803bd6:	c3                   	ret
+
+0000000000803bd7 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803bd7:	55                   	push   %rbp
+  803bd8:	48 89 e5             	mov    %rsp,%rbp
+  803bdb:	41 57                	push   %r15
+  803bdd:	41 56                	push   %r14
+  803bdf:	41 55                	push   %r13
+  803be1:	41 54                	push   %r12
+  803be3:	53                   	push   %rbx
+  803be4:	48 83 ec 28          	sub    $0x28,%rsp
+  803be8:	49 89 fd             	mov    %rdi,%r13
+  803beb:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803bef:	49 89 d4             	mov    %rdx,%r12
+  803bf2:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803bf6:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803bfd:	00 00 00 
+  803c00:	ff d0                	call   *%rax
+  803c02:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c05:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c0b:	49 bf 5a 3a 80 00 00 	movabs $0x803a5a,%r15
+  803c12:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c15:	4d 85 e4             	test   %r12,%r12
+  803c18:	0f 84 d5 00 00 00    	je     803cf3 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c1e:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c26:	8b 03                	mov    (%rbx),%eax
+  803c28:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c2b:	75 7a                	jne    803ca7 <devpipe_read+0xd0>
+            if (i > 0) {
+  803c2d:	4d 85 f6             	test   %r14,%r14
+  803c30:	75 50                	jne    803c82 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c32:	48 89 de             	mov    %rbx,%rsi
+  803c35:	4c 89 ef             	mov    %r13,%rdi
+  803c38:	41 ff d7             	call   *%r15
+  803c3b:	85 c0                	test   %eax,%eax
+  803c3d:	0f 85 c9 00 00 00    	jne    803d0c <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c43:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803c46:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c4d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c53:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c56:	41 39 c4             	cmp    %eax,%r12d
+  803c59:	75 cb                	jne    803c26 <devpipe_read+0x4f>
+  803c5b:	48 89 de             	mov    %rbx,%rsi
+  803c5e:	4c 89 ef             	mov    %r13,%rdi
+  803c61:	41 ff d7             	call   *%r15
+  803c64:	85 c0                	test   %eax,%eax
+  803c66:	75 be                	jne    803c26 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c68:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c6d:	44 89 e6             	mov    %r12d,%esi
+  803c70:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c74:	48 b8 ab 14 80 00 00 	movabs $0x8014ab,%rax
+  803c7b:	00 00 00 
+  803c7e:	ff d0                	call   *%rax
+  803c80:	eb a4                	jmp    803c26 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c82:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c86:	48 89 de             	mov    %rbx,%rsi
+  803c89:	48 b8 b7 39 80 00 00 	movabs $0x8039b7,%rax
+  803c90:	00 00 00 
+  803c93:	ff d0                	call   *%rax
+                return i;
+  803c95:	4c 89 f0             	mov    %r14,%rax
+}
+  803c98:	48 83 c4 28          	add    $0x28,%rsp
+  803c9c:	5b                   	pop    %rbx
+  803c9d:	41 5c                	pop    %r12
+  803c9f:	41 5d                	pop    %r13
+  803ca1:	41 5e                	pop    %r14
+  803ca3:	41 5f                	pop    %r15
+  803ca5:	5d                   	pop    %rbp
+  803ca6:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803ca7:	48 63 c8             	movslq %eax,%rcx
+  803caa:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803cb1:	80 80 80 
+  803cb4:	48 89 c8             	mov    %rcx,%rax
+  803cb7:	48 f7 e2             	mul    %rdx
+  803cba:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803cbe:	48 89 d0             	mov    %rdx,%rax
+  803cc1:	48 c1 e0 08          	shl    $0x8,%rax
+  803cc5:	48 29 d0             	sub    %rdx,%rax
+  803cc8:	48 c1 e0 04          	shl    $0x4,%rax
+  803ccc:	48 89 c2             	mov    %rax,%rdx
+  803ccf:	48 89 c8             	mov    %rcx,%rax
+  803cd2:	48 29 d0             	sub    %rdx,%rax
+  803cd5:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803cda:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803cde:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803ce2:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ce5:	49 83 c6 01          	add    $0x1,%r14
+  803ce9:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803ced:	0f 85 2b ff ff ff    	jne    803c1e <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803cf3:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803cf7:	48 89 de             	mov    %rbx,%rsi
+  803cfa:	48 b8 b7 39 80 00 00 	movabs $0x8039b7,%rax
+  803d01:	00 00 00 
+  803d04:	ff d0                	call   *%rax
+    return n;
+  803d06:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d0a:	eb 8c                	jmp    803c98 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d0c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d11:	eb 85                	jmp    803c98 <devpipe_read+0xc1>
+
+0000000000803d13 <pipe>:
+pipe(int pfd[2]) {
+  803d13:	55                   	push   %rbp
+  803d14:	48 89 e5             	mov    %rsp,%rbp
+  803d17:	41 55                	push   %r13
+  803d19:	41 54                	push   %r12
+  803d1b:	53                   	push   %rbx
+  803d1c:	48 83 ec 18          	sub    $0x18,%rsp
+  803d20:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d23:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d27:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  803d2e:	00 00 00 
+  803d31:	ff d0                	call   *%rax
+  803d33:	89 c3                	mov    %eax,%ebx
+  803d35:	85 c0                	test   %eax,%eax
+  803d37:	0f 88 a0 01 00 00    	js     803edd <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d3d:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d42:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d47:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d4b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d50:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  803d57:	00 00 00 
+  803d5a:	ff d0                	call   *%rax
+  803d5c:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d5e:	85 c0                	test   %eax,%eax
+  803d60:	0f 88 77 01 00 00    	js     803edd <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d66:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803d6a:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  803d71:	00 00 00 
+  803d74:	ff d0                	call   *%rax
+  803d76:	89 c3                	mov    %eax,%ebx
+  803d78:	85 c0                	test   %eax,%eax
+  803d7a:	0f 88 43 01 00 00    	js     803ec3 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803d80:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d85:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d8a:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d93:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  803d9a:	00 00 00 
+  803d9d:	ff d0                	call   *%rax
+  803d9f:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803da1:	85 c0                	test   %eax,%eax
+  803da3:	0f 88 1a 01 00 00    	js     803ec3 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803da9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803dad:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803db4:	00 00 00 
+  803db7:	ff d0                	call   *%rax
+  803db9:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803dbc:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dc1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dc6:	48 89 c6             	mov    %rax,%rsi
+  803dc9:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dce:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  803dd5:	00 00 00 
+  803dd8:	ff d0                	call   *%rax
+  803dda:	89 c3                	mov    %eax,%ebx
+  803ddc:	85 c0                	test   %eax,%eax
+  803dde:	0f 88 c5 00 00 00    	js     803ea9 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803de4:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803de8:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803def:	00 00 00 
+  803df2:	ff d0                	call   *%rax
+  803df4:	48 89 c1             	mov    %rax,%rcx
+  803df7:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803dfd:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e08:	4c 89 ee             	mov    %r13,%rsi
+  803e0b:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e10:	48 b8 93 11 80 00 00 	movabs $0x801193,%rax
+  803e17:	00 00 00 
+  803e1a:	ff d0                	call   *%rax
+  803e1c:	89 c3                	mov    %eax,%ebx
+  803e1e:	85 c0                	test   %eax,%eax
+  803e20:	78 6e                	js     803e90 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e22:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e27:	4c 89 ef             	mov    %r13,%rdi
+  803e2a:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  803e31:	00 00 00 
+  803e34:	ff d0                	call   *%rax
+  803e36:	83 f8 02             	cmp    $0x2,%eax
+  803e39:	0f 85 ab 00 00 00    	jne    803eea <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e3f:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803e46:	00 00 
+  803e48:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e4c:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803e4e:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e52:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803e59:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e5d:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803e5f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e63:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803e6a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e6e:	48 bb 57 18 80 00 00 	movabs $0x801857,%rbx
+  803e75:	00 00 00 
+  803e78:	ff d3                	call   *%rbx
+  803e7a:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803e7e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e82:	ff d3                	call   *%rbx
+  803e84:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803e89:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e8e:	eb 4d                	jmp    803edd <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803e90:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e95:	4c 89 ee             	mov    %r13,%rsi
+  803e98:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e9d:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  803ea4:	00 00 00 
+  803ea7:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803ea9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eae:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803eb2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803eb7:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  803ebe:	00 00 00 
+  803ec1:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ec3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec8:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ecc:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ed1:	48 b8 e3 11 80 00 00 	movabs $0x8011e3,%rax
+  803ed8:	00 00 00 
+  803edb:	ff d0                	call   *%rax
+}
+  803edd:	89 d8                	mov    %ebx,%eax
+  803edf:	48 83 c4 18          	add    $0x18,%rsp
+  803ee3:	5b                   	pop    %rbx
+  803ee4:	41 5c                	pop    %r12
+  803ee6:	41 5d                	pop    %r13
+  803ee8:	5d                   	pop    %rbp
+  803ee9:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803eea:	48 b9 90 4f 80 00 00 	movabs $0x804f90,%rcx
+  803ef1:	00 00 00 
+  803ef4:	48 ba 67 4f 80 00 00 	movabs $0x804f67,%rdx
+  803efb:	00 00 00 
+  803efe:	be 50 00 00 00       	mov    $0x50,%esi
+  803f03:	48 bf 7c 4f 80 00 00 	movabs $0x804f7c,%rdi
+  803f0a:	00 00 00 
+  803f0d:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f12:	49 b8 42 45 80 00 00 	movabs $0x804542,%r8
+  803f19:	00 00 00 
+  803f1c:	41 ff d0             	call   *%r8
+
+0000000000803f1f <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f1f:	55                   	push   %rbp
+  803f20:	48 89 e5             	mov    %rsp,%rbp
+  803f23:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f27:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f2b:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f37:	85 c0                	test   %eax,%eax
+  803f39:	78 23                	js     803f5e <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f3b:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f3f:	48 b8 69 18 80 00 00 	movabs $0x801869,%rax
+  803f46:	00 00 00 
+  803f49:	ff d0                	call   *%rax
+  803f4b:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803f4e:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f52:	48 b8 5a 3a 80 00 00 	movabs $0x803a5a,%rax
+  803f59:	00 00 00 
+  803f5c:	ff d0                	call   *%rax
+}
+  803f5e:	c9                   	leave
+  803f5f:	c3                   	ret
+
+0000000000803f60 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f60:	48 89 f8             	mov    %rdi,%rax
+  803f63:	48 c1 e8 27          	shr    $0x27,%rax
+  803f67:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f6e:	01 00 00 
+  803f71:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f75:	f6 c2 01             	test   $0x1,%dl
+  803f78:	74 6d                	je     803fe7 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f7a:	48 89 f8             	mov    %rdi,%rax
+  803f7d:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f81:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f88:	01 00 00 
+  803f8b:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f8f:	f6 c2 01             	test   $0x1,%dl
+  803f92:	74 62                	je     803ff6 <get_uvpt_entry+0x96>
+  803f94:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f9b:	01 00 00 
+  803f9e:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fa2:	f6 c2 80             	test   $0x80,%dl
+  803fa5:	75 4f                	jne    803ff6 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803fa7:	48 89 f8             	mov    %rdi,%rax
+  803faa:	48 c1 e8 15          	shr    $0x15,%rax
+  803fae:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fb5:	01 00 00 
+  803fb8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fbc:	f6 c2 01             	test   $0x1,%dl
+  803fbf:	74 44                	je     804005 <get_uvpt_entry+0xa5>
+  803fc1:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fc8:	01 00 00 
+  803fcb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fcf:	f6 c2 80             	test   $0x80,%dl
+  803fd2:	75 31                	jne    804005 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803fd4:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803fd8:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803fdf:	01 00 00 
+  803fe2:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803fe6:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fe7:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fee:	01 00 00 
+  803ff1:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803ff5:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803ff6:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ffd:	01 00 00 
+  804000:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804004:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804005:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80400c:	01 00 00 
+  80400f:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804013:	c3                   	ret
+
+0000000000804014 <get_prot>:
+
+int
+get_prot(void *va) {
+  804014:	55                   	push   %rbp
+  804015:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804018:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  80401f:	00 00 00 
+  804022:	ff d0                	call   *%rax
+  804024:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804027:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80402c:	89 c1                	mov    %eax,%ecx
+  80402e:	83 c9 04             	or     $0x4,%ecx
+  804031:	f6 c2 01             	test   $0x1,%dl
+  804034:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804037:	89 c1                	mov    %eax,%ecx
+  804039:	83 c9 02             	or     $0x2,%ecx
+  80403c:	f6 c2 02             	test   $0x2,%dl
+  80403f:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804042:	89 c1                	mov    %eax,%ecx
+  804044:	83 c9 01             	or     $0x1,%ecx
+  804047:	48 85 d2             	test   %rdx,%rdx
+  80404a:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80404d:	89 c1                	mov    %eax,%ecx
+  80404f:	83 c9 40             	or     $0x40,%ecx
+  804052:	f6 c6 04             	test   $0x4,%dh
+  804055:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804058:	5d                   	pop    %rbp
+  804059:	c3                   	ret
+
+000000000080405a <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  80405a:	55                   	push   %rbp
+  80405b:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80405e:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  804065:	00 00 00 
+  804068:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  80406a:	48 c1 e8 06          	shr    $0x6,%rax
+  80406e:	83 e0 01             	and    $0x1,%eax
+}
+  804071:	5d                   	pop    %rbp
+  804072:	c3                   	ret
+
+0000000000804073 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804073:	55                   	push   %rbp
+  804074:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804077:	48 b8 60 3f 80 00 00 	movabs $0x803f60,%rax
+  80407e:	00 00 00 
+  804081:	ff d0                	call   *%rax
+  804083:	83 e0 01             	and    $0x1,%eax
+}
+  804086:	5d                   	pop    %rbp
+  804087:	c3                   	ret
+
+0000000000804088 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804088:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80408f:	01 00 00 
+  804092:	a8 01                	test   $0x1,%al
+  804094:	75 06                	jne    80409c <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804096:	b8 00 00 00 00       	mov    $0x0,%eax
+  80409b:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80409c:	55                   	push   %rbp
+  80409d:	48 89 e5             	mov    %rsp,%rbp
+  8040a0:	41 57                	push   %r15
+  8040a2:	41 56                	push   %r14
+  8040a4:	41 55                	push   %r13
+  8040a6:	41 54                	push   %r12
+  8040a8:	53                   	push   %rbx
+  8040a9:	48 83 ec 28          	sub    $0x28,%rsp
+  8040ad:	49 89 fe             	mov    %rdi,%r14
+  8040b0:	49 89 f7             	mov    %rsi,%r15
+  8040b3:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8040ba:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040bb:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8040c2:	01 00 00 
+  8040c5:	e9 ae 00 00 00       	jmp    804178 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8040ca:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040d1:	49 83 ec 01          	sub    $0x1,%r12
+  8040d5:	74 2d                	je     804104 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040d7:	48 89 d8             	mov    %rbx,%rax
+  8040da:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040de:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040e3:	f6 c2 01             	test   $0x1,%dl
+  8040e6:	74 e2                	je     8040ca <foreach_shared_region+0x42>
+  8040e8:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040ed:	f6 c4 04             	test   $0x4,%ah
+  8040f0:	74 d8                	je     8040ca <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8040f2:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8040f9:	4c 89 fa             	mov    %r15,%rdx
+  8040fc:	48 89 df             	mov    %rbx,%rdi
+  8040ff:	41 ff d6             	call   *%r14
+  804102:	eb c6                	jmp    8040ca <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804104:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80410b:	00 
+  80410c:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804111:	74 4a                	je     80415d <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804113:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804117:	48 c1 e8 15          	shr    $0x15,%rax
+  80411b:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804122:	01 00 00 
+  804125:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804129:	a8 01                	test   $0x1,%al
+  80412b:	74 d7                	je     804104 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80412d:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804131:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804138:	48 39 c3             	cmp    %rax,%rbx
+  80413b:	73 c7                	jae    804104 <foreach_shared_region+0x7c>
+  80413d:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804144:	48 39 d0             	cmp    %rdx,%rax
+  804147:	4d 19 e4             	sbb    %r12,%r12
+  80414a:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804151:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804158:	e9 7a ff ff ff       	jmp    8040d7 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  80415d:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804164:	40 
+  804165:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804169:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804170:	00 00 00 
+  804173:	48 39 c1             	cmp    %rax,%rcx
+  804176:	74 50                	je     8041c8 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804178:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80417c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804180:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804187:	01 00 00 
+  80418a:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80418e:	a8 01                	test   $0x1,%al
+  804190:	74 cb                	je     80415d <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804192:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804196:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80419d:	48 39 c1             	cmp    %rax,%rcx
+  8041a0:	73 bb                	jae    80415d <foreach_shared_region+0xd5>
+  8041a2:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8041a9:	48 39 d0             	cmp    %rdx,%rax
+  8041ac:	48 19 c0             	sbb    %rax,%rax
+  8041af:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8041b5:	48 05 00 02 00 00    	add    $0x200,%rax
+  8041bb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041bf:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041c3:	e9 4b ff ff ff       	jmp    804113 <foreach_shared_region+0x8b>
+  8041c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041cd:	48 83 c4 28          	add    $0x28,%rsp
+  8041d1:	5b                   	pop    %rbx
+  8041d2:	41 5c                	pop    %r12
+  8041d4:	41 5d                	pop    %r13
+  8041d6:	41 5e                	pop    %r14
+  8041d8:	41 5f                	pop    %r15
+  8041da:	5d                   	pop    %rbp
+  8041db:	c3                   	ret
+
+00000000008041dc <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8041dc:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8041e2:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8041e9:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8041f0:	c3                   	ret
+
+00000000008041f1 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8041f1:	8b 47 40             	mov    0x40(%rdi),%eax
+  8041f4:	8b 17                	mov    (%rdi),%edx
+  8041f6:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8041f8:	83 f8 0f             	cmp    $0xf,%eax
+  8041fb:	77 13                	ja     804210 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8041fd:	8b 47 40             	mov    0x40(%rdi),%eax
+  804200:	83 e0 0f             	and    $0xf,%eax
+  804203:	48 c1 e0 09          	shl    $0x9,%rax
+  804207:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80420e:	00 
+  80420f:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804210:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804215:	c3                   	ret
+
+0000000000804216 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804216:	8b 47 40             	mov    0x40(%rdi),%eax
+  804219:	83 c0 01             	add    $0x1,%eax
+  80421c:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80421f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804225:	8b 57 04             	mov    0x4(%rdi),%edx
+  804228:	b8 00 00 00 00       	mov    $0x0,%eax
+  80422d:	85 d2                	test   %edx,%edx
+  80422f:	75 04                	jne    804235 <chan_publish+0x1f>
+  804231:	83 e0 01             	and    $0x1,%eax
+}
+  804234:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804235:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804238:	85 c0                	test   %eax,%eax
+  80423a:	0f 95 c0             	setne  %al
+  80423d:	0f b6 c0             	movzbl %al,%eax
+  804240:	eb ef                	jmp    804231 <chan_publish+0x1b>
+
+0000000000804242 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804242:	8b 47 40             	mov    0x40(%rdi),%eax
+  804245:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804247:	29 d0                	sub    %edx,%eax
+  804249:	83 e8 01             	sub    $0x1,%eax
+  80424c:	83 f8 0f             	cmp    $0xf,%eax
+  80424f:	77 12                	ja     804263 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804251:	8b 07                	mov    (%rdi),%eax
+  804253:	83 e0 0f             	and    $0xf,%eax
+  804256:	48 c1 e0 09          	shl    $0x9,%rax
+  80425a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804261:	00 
+  804262:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804263:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804268:	c3                   	ret
+
+0000000000804269 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804269:	8b 07                	mov    (%rdi),%eax
+  80426b:	83 c0 01             	add    $0x1,%eax
+  80426e:	89 07                	mov    %eax,(%rdi)
+}
+  804270:	c3                   	ret
+
+0000000000804271 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804271:	55                   	push   %rbp
+  804272:	48 89 e5             	mov    %rsp,%rbp
+  804275:	53                   	push   %rbx
+  804276:	48 83 ec 08          	sub    $0x8,%rsp
+  80427a:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80427d:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804284:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  80428a:	48 b8 42 42 80 00 00 	movabs $0x804242,%rax
+  804291:	00 00 00 
+  804294:	ff d0                	call   *%rax
+  804296:	48 85 c0             	test   %rax,%rax
+  804299:	74 12                	je     8042ad <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80429b:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8042a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042a7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042ab:	c9                   	leave
+  8042ac:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8042ad:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042b2:	eb f3                	jmp    8042a7 <chan_arm+0x36>
+
+00000000008042b4 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8042b4:	55                   	push   %rbp
+  8042b5:	48 89 e5             	mov    %rsp,%rbp
+  8042b8:	41 56                	push   %r14
+  8042ba:	41 55                	push   %r13
+  8042bc:	41 54                	push   %r12
+  8042be:	53                   	push   %rbx
+  8042bf:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8042c2:	49 bc 71 42 80 00 00 	movabs $0x804271,%r12
+  8042c9:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042cc:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8042d0:	49 bd ab 14 80 00 00 	movabs $0x8014ab,%r13
+  8042d7:	00 00 00 
+    while (chan_arm(r))
+  8042da:	eb 0d                	jmp    8042e9 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042dc:	8b 33                	mov    (%rbx),%esi
+  8042de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042e3:	4c 89 f7             	mov    %r14,%rdi
+  8042e6:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8042e9:	48 89 df             	mov    %rbx,%rdi
+  8042ec:	41 ff d4             	call   *%r12
+  8042ef:	84 c0                	test   %al,%al
+  8042f1:	75 e9                	jne    8042dc <chan_wait+0x28>
+}
+  8042f3:	5b                   	pop    %rbx
+  8042f4:	41 5c                	pop    %r12
+  8042f6:	41 5d                	pop    %r13
+  8042f8:	41 5e                	pop    %r14
+  8042fa:	5d                   	pop    %rbp
+  8042fb:	c3                   	ret
+
+00000000008042fc <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8042fc:	55                   	push   %rbp
+  8042fd:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  804300:	48 83 c7 40          	add    $0x40,%rdi
+  804304:	be 01 00 00 00       	mov    $0x1,%esi
+  804309:	48 b8 c9 14 80 00 00 	movabs $0x8014c9,%rax
+  804310:	00 00 00 
+  804313:	ff d0                	call   *%rax
+}
+  804315:	5d                   	pop    %rbp
+  804316:	c3                   	ret
+
+0000000000804317 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804317:	b8 00 00 00 00       	mov    $0x0,%eax
+  80431c:	c3                   	ret
+
+000000000080431d <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80431d:	55                   	push   %rbp
+  80431e:	48 89 e5             	mov    %rsp,%rbp
+  804321:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804324:	48 be b4 4f 80 00 00 	movabs $0x804fb4,%rsi
+  80432b:	00 00 00 
+  80432e:	48 b8 de 0b 80 00 00 	movabs $0x800bde,%rax
+  804335:	00 00 00 
+  804338:	ff d0                	call   *%rax
+    return 0;
+}
+  80433a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80433f:	5d                   	pop    %rbp
+  804340:	c3                   	ret
+
+0000000000804341 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804341:	55                   	push   %rbp
+  804342:	48 89 e5             	mov    %rsp,%rbp
+  804345:	41 57                	push   %r15
+  804347:	41 56                	push   %r14
+  804349:	41 55                	push   %r13
+  80434b:	41 54                	push   %r12
+  80434d:	53                   	push   %rbx
+  80434e:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804355:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80435c:	48 85 d2             	test   %rdx,%rdx
+  80435f:	74 7a                	je     8043db <devcons_write+0x9a>
+  804361:	49 89 d6             	mov    %rdx,%r14
+  804364:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80436a:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80436f:	49 bf d8 0d 80 00 00 	movabs $0x800dd8,%r15
+  804376:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804379:	4c 89 f3             	mov    %r14,%rbx
+  80437c:	48 29 f3             	sub    %rsi,%rbx
+  80437f:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804384:	48 39 c3             	cmp    %rax,%rbx
+  804387:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80438b:	4c 63 eb             	movslq %ebx,%r13
+  80438e:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804395:	48 01 c6             	add    %rax,%rsi
+  804398:	4c 89 ea             	mov    %r13,%rdx
+  80439b:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043a2:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8043a5:	4c 89 ee             	mov    %r13,%rsi
+  8043a8:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043af:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  8043b6:	00 00 00 
+  8043b9:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8043bb:	41 01 dc             	add    %ebx,%r12d
+  8043be:	49 63 f4             	movslq %r12d,%rsi
+  8043c1:	4c 39 f6             	cmp    %r14,%rsi
+  8043c4:	72 b3                	jb     804379 <devcons_write+0x38>
+    return res;
+  8043c6:	49 63 c4             	movslq %r12d,%rax
+}
+  8043c9:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8043d0:	5b                   	pop    %rbx
+  8043d1:	41 5c                	pop    %r12
+  8043d3:	41 5d                	pop    %r13
+  8043d5:	41 5e                	pop    %r14
+  8043d7:	41 5f                	pop    %r15
+  8043d9:	5d                   	pop    %rbp
+  8043da:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8043db:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043e1:	eb e3                	jmp    8043c6 <devcons_write+0x85>
+
+00000000008043e3 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043e3:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8043e6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043eb:	48 85 c0             	test   %rax,%rax
+  8043ee:	74 55                	je     804445 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043f0:	55                   	push   %rbp
+  8043f1:	48 89 e5             	mov    %rsp,%rbp
+  8043f4:	41 55                	push   %r13
+  8043f6:	41 54                	push   %r12
+  8043f8:	53                   	push   %rbx
+  8043f9:	48 83 ec 08          	sub    $0x8,%rsp
+  8043fd:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  804400:	48 bb 24 10 80 00 00 	movabs $0x801024,%rbx
+  804407:	00 00 00 
+  80440a:	49 bc d9 10 80 00 00 	movabs $0x8010d9,%r12
+  804411:	00 00 00 
+  804414:	eb 03                	jmp    804419 <devcons_read+0x36>
+  804416:	41 ff d4             	call   *%r12
+  804419:	ff d3                	call   *%rbx
+  80441b:	85 c0                	test   %eax,%eax
+  80441d:	74 f7                	je     804416 <devcons_read+0x33>
+    if (c < 0) return c;
+  80441f:	48 63 d0             	movslq %eax,%rdx
+  804422:	78 13                	js     804437 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804424:	ba 00 00 00 00       	mov    $0x0,%edx
+  804429:	83 f8 04             	cmp    $0x4,%eax
+  80442c:	74 09                	je     804437 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80442e:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804432:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804437:	48 89 d0             	mov    %rdx,%rax
+  80443a:	48 83 c4 08          	add    $0x8,%rsp
+  80443e:	5b                   	pop    %rbx
+  80443f:	41 5c                	pop    %r12
+  804441:	41 5d                	pop    %r13
+  804443:	5d                   	pop    %rbp
+  804444:	c3                   	ret
+  804445:	48 89 d0             	mov    %rdx,%rax
+  804448:	c3                   	ret
+
+0000000000804449 <cputchar>:
+cputchar(int ch) {
+  804449:	55                   	push   %rbp
+  80444a:	48 89 e5             	mov    %rsp,%rbp
+  80444d:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804451:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804455:	be 01 00 00 00       	mov    $0x1,%esi
+  80445a:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80445e:	48 b8 05 10 80 00 00 	movabs $0x801005,%rax
+  804465:	00 00 00 
+  804468:	ff d0                	call   *%rax
+}
+  80446a:	c9                   	leave
+  80446b:	c3                   	ret
+
+000000000080446c <getchar>:
+getchar(void) {
+  80446c:	55                   	push   %rbp
+  80446d:	48 89 e5             	mov    %rsp,%rbp
+  804470:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804474:	ba 01 00 00 00       	mov    $0x1,%edx
+  804479:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80447d:	bf 00 00 00 00       	mov    $0x0,%edi
+  804482:	48 b8 c8 1b 80 00 00 	movabs $0x801bc8,%rax
+  804489:	00 00 00 
+  80448c:	ff d0                	call   *%rax
+  80448e:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804490:	85 c0                	test   %eax,%eax
+  804492:	78 06                	js     80449a <getchar+0x2e>
+  804494:	74 08                	je     80449e <getchar+0x32>
+  804496:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  80449a:	89 d0                	mov    %edx,%eax
+  80449c:	c9                   	leave
+  80449d:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80449e:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8044a3:	eb f5                	jmp    80449a <getchar+0x2e>
+
+00000000008044a5 <iscons>:
+iscons(int fdnum) {
+  8044a5:	55                   	push   %rbp
+  8044a6:	48 89 e5             	mov    %rsp,%rbp
+  8044a9:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044ad:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8044b1:	48 b8 e5 18 80 00 00 	movabs $0x8018e5,%rax
+  8044b8:	00 00 00 
+  8044bb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044bd:	85 c0                	test   %eax,%eax
+  8044bf:	78 18                	js     8044d9 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8044c1:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044c5:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8044cc:	00 00 00 
+  8044cf:	8b 00                	mov    (%rax),%eax
+  8044d1:	39 02                	cmp    %eax,(%rdx)
+  8044d3:	0f 94 c0             	sete   %al
+  8044d6:	0f b6 c0             	movzbl %al,%eax
+}
+  8044d9:	c9                   	leave
+  8044da:	c3                   	ret
+
+00000000008044db <opencons>:
+opencons(void) {
+  8044db:	55                   	push   %rbp
+  8044dc:	48 89 e5             	mov    %rsp,%rbp
+  8044df:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8044e3:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8044e7:	48 b8 85 18 80 00 00 	movabs $0x801885,%rax
+  8044ee:	00 00 00 
+  8044f1:	ff d0                	call   *%rax
+  8044f3:	85 c0                	test   %eax,%eax
+  8044f5:	78 49                	js     804540 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8044f7:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8044fc:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804501:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804505:	bf 00 00 00 00       	mov    $0x0,%edi
+  80450a:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  804511:	00 00 00 
+  804514:	ff d0                	call   *%rax
+  804516:	85 c0                	test   %eax,%eax
+  804518:	78 26                	js     804540 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  80451a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80451e:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804525:	00 00 
+  804527:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804529:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80452d:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804534:	48 b8 57 18 80 00 00 	movabs $0x801857,%rax
+  80453b:	00 00 00 
+  80453e:	ff d0                	call   *%rax
+}
+  804540:	c9                   	leave
+  804541:	c3                   	ret
+
+0000000000804542 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  804542:	55                   	push   %rbp
+  804543:	48 89 e5             	mov    %rsp,%rbp
+  804546:	41 56                	push   %r14
+  804548:	41 55                	push   %r13
+  80454a:	41 54                	push   %r12
+  80454c:	53                   	push   %rbx
+  80454d:	48 83 ec 50          	sub    $0x50,%rsp
+  804551:	49 89 fc             	mov    %rdi,%r12
+  804554:	41 89 f5             	mov    %esi,%r13d
+  804557:	48 89 d3             	mov    %rdx,%rbx
+  80455a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80455e:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  804562:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804566:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80456d:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804571:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804575:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804579:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80457d:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804584:	00 00 00 
+  804587:	4c 8b 30             	mov    (%rax),%r14
+  80458a:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  804591:	00 00 00 
+  804594:	ff d0                	call   *%rax
+  804596:	89 c6                	mov    %eax,%esi
+  804598:	45 89 e8             	mov    %r13d,%r8d
+  80459b:	4c 89 e1             	mov    %r12,%rcx
+  80459e:	4c 89 f2             	mov    %r14,%rdx
+  8045a1:	48 bf c0 4f 80 00 00 	movabs $0x804fc0,%rdi
+  8045a8:	00 00 00 
+  8045ab:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045b0:	49 bc b9 02 80 00 00 	movabs $0x8002b9,%r12
+  8045b7:	00 00 00 
+  8045ba:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8045bd:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8045c1:	48 89 df             	mov    %rbx,%rdi
+  8045c4:	48 b8 55 02 80 00 00 	movabs $0x800255,%rax
+  8045cb:	00 00 00 
+  8045ce:	ff d0                	call   *%rax
+    cprintf("\n");
+  8045d0:	48 bf 0b 4f 80 00 00 	movabs $0x804f0b,%rdi
+  8045d7:	00 00 00 
+  8045da:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045df:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8045e2:	cc                   	int3
+  8045e3:	eb fd                	jmp    8045e2 <_panic+0xa0>
+
+00000000008045e5 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8045e5:	55                   	push   %rbp
+  8045e6:	48 89 e5             	mov    %rsp,%rbp
+  8045e9:	41 56                	push   %r14
+  8045eb:	41 55                	push   %r13
+  8045ed:	41 54                	push   %r12
+  8045ef:	53                   	push   %rbx
+  8045f0:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045f3:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8045fa:	00 00 00 
+  8045fd:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804601:	74 27                	je     80462a <_handle_vectored_pagefault+0x45>
+  804603:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804608:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80460f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804612:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804615:	4c 89 e7             	mov    %r12,%rdi
+  804618:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  80461d:	84 c0                	test   %al,%al
+  80461f:	75 45                	jne    804666 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804621:	48 83 c3 01          	add    $0x1,%rbx
+  804625:	49 3b 1e             	cmp    (%r14),%rbx
+  804628:	72 eb                	jb     804615 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80462a:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804631:	00 
+  804632:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804637:	4d 8b 04 24          	mov    (%r12),%r8
+  80463b:	48 ba e8 4f 80 00 00 	movabs $0x804fe8,%rdx
+  804642:	00 00 00 
+  804645:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80464a:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  804651:	00 00 00 
+  804654:	b8 00 00 00 00       	mov    $0x0,%eax
+  804659:	49 ba 42 45 80 00 00 	movabs $0x804542,%r10
+  804660:	00 00 00 
+  804663:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804666:	5b                   	pop    %rbx
+  804667:	41 5c                	pop    %r12
+  804669:	41 5d                	pop    %r13
+  80466b:	41 5e                	pop    %r14
+  80466d:	5d                   	pop    %rbp
+  80466e:	c3                   	ret
+
+000000000080466f <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80466f:	55                   	push   %rbp
+  804670:	48 89 e5             	mov    %rsp,%rbp
+  804673:	53                   	push   %rbx
+  804674:	48 83 ec 08          	sub    $0x8,%rsp
+  804678:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  80467b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804682:	00 00 00 
+  804685:	80 38 00             	cmpb   $0x0,(%rax)
+  804688:	0f 84 84 00 00 00    	je     804712 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80468e:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804695:	00 00 00 
+  804698:	48 8b 10             	mov    (%rax),%rdx
+  80469b:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046a0:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8046a7:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046aa:	48 85 d2             	test   %rdx,%rdx
+  8046ad:	74 19                	je     8046c8 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046af:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8046b3:	0f 84 e8 00 00 00    	je     8047a1 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046b9:	48 83 c0 01          	add    $0x1,%rax
+  8046bd:	48 39 d0             	cmp    %rdx,%rax
+  8046c0:	75 ed                	jne    8046af <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8046c2:	48 83 fa 08          	cmp    $0x8,%rdx
+  8046c6:	74 1c                	je     8046e4 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8046c8:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8046cc:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8046d3:	00 00 00 
+  8046d6:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046dd:	00 00 00 
+  8046e0:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8046e4:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  8046eb:	00 00 00 
+  8046ee:	ff d0                	call   *%rax
+  8046f0:	89 c7                	mov    %eax,%edi
+  8046f2:	48 be 67 48 80 00 00 	movabs $0x804867,%rsi
+  8046f9:	00 00 00 
+  8046fc:	48 b8 fb 12 80 00 00 	movabs $0x8012fb,%rax
+  804703:	00 00 00 
+  804706:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804708:	85 c0                	test   %eax,%eax
+  80470a:	78 68                	js     804774 <add_pgfault_handler+0x105>
+    return res;
+}
+  80470c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804710:	c9                   	leave
+  804711:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804712:	48 b8 b0 10 80 00 00 	movabs $0x8010b0,%rax
+  804719:	00 00 00 
+  80471c:	ff d0                	call   *%rax
+  80471e:	89 c7                	mov    %eax,%edi
+  804720:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804725:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80472a:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804731:	00 00 00 
+  804734:	48 b8 3d 11 80 00 00 	movabs $0x80113d,%rax
+  80473b:	00 00 00 
+  80473e:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804740:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804747:	00 00 00 
+  80474a:	48 8b 02             	mov    (%rdx),%rax
+  80474d:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  804751:	48 89 0a             	mov    %rcx,(%rdx)
+  804754:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80475b:	00 00 00 
+  80475e:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  804762:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804769:	00 00 00 
+  80476c:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80476f:	e9 70 ff ff ff       	jmp    8046e4 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804774:	89 c1                	mov    %eax,%ecx
+  804776:	48 ba 26 50 80 00 00 	movabs $0x805026,%rdx
+  80477d:	00 00 00 
+  804780:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804785:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  80478c:	00 00 00 
+  80478f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804794:	49 b8 42 45 80 00 00 	movabs $0x804542,%r8
+  80479b:	00 00 00 
+  80479e:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a6:	e9 61 ff ff ff       	jmp    80470c <add_pgfault_handler+0x9d>
+
+00000000008047ab <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8047ab:	55                   	push   %rbp
+  8047ac:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8047af:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047b6:	00 00 00 
+  8047b9:	80 38 00             	cmpb   $0x0,(%rax)
+  8047bc:	74 33                	je     8047f1 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047be:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8047c5:	00 00 00 
+  8047c8:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8047cd:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047d4:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047d7:	48 85 c0             	test   %rax,%rax
+  8047da:	0f 84 85 00 00 00    	je     804865 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8047e0:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8047e4:	74 40                	je     804826 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047e6:	48 83 c1 01          	add    $0x1,%rcx
+  8047ea:	48 39 c1             	cmp    %rax,%rcx
+  8047ed:	75 f1                	jne    8047e0 <remove_pgfault_handler+0x35>
+  8047ef:	eb 74                	jmp    804865 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8047f1:	48 b9 3e 50 80 00 00 	movabs $0x80503e,%rcx
+  8047f8:	00 00 00 
+  8047fb:	48 ba 67 4f 80 00 00 	movabs $0x804f67,%rdx
+  804802:	00 00 00 
+  804805:	be 43 00 00 00       	mov    $0x43,%esi
+  80480a:	48 bf 18 50 80 00 00 	movabs $0x805018,%rdi
+  804811:	00 00 00 
+  804814:	b8 00 00 00 00       	mov    $0x0,%eax
+  804819:	49 b8 42 45 80 00 00 	movabs $0x804542,%r8
+  804820:	00 00 00 
+  804823:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804826:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  80482d:	00 
+  80482e:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804832:	48 29 ca             	sub    %rcx,%rdx
+  804835:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  80483c:	00 00 00 
+  80483f:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804843:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804848:	48 89 ce             	mov    %rcx,%rsi
+  80484b:	48 b8 d8 0d 80 00 00 	movabs $0x800dd8,%rax
+  804852:	00 00 00 
+  804855:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804857:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80485e:	00 00 00 
+  804861:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804865:	5d                   	pop    %rbp
+  804866:	c3                   	ret
+
+0000000000804867 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804867:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  80486a:	48 b8 e5 45 80 00 00 	movabs $0x8045e5,%rax
+  804871:	00 00 00 
+    call *%rax
+  804874:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804876:	41 5f                	pop    %r15
+	popq %r15
+  804878:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  80487a:	41 5f                	pop    %r15
+	popq %r14
+  80487c:	41 5e                	pop    %r14
+	popq %r13
+  80487e:	41 5d                	pop    %r13
+	popq %r12
+  804880:	41 5c                	pop    %r12
+	popq %r11
+  804882:	41 5b                	pop    %r11
+	popq %r10
+  804884:	41 5a                	pop    %r10
+	popq %r9
+  804886:	41 59                	pop    %r9
+	popq %r8
+  804888:	41 58                	pop    %r8
+	popq %rsi
+  80488a:	5e                   	pop    %rsi
+	popq %rdi
+  80488b:	5f                   	pop    %rdi
+	popq %rbp
+  80488c:	5d                   	pop    %rbp
+	popq %rdx
+  80488d:	5a                   	pop    %rdx
+	popq %rcx
+  80488e:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80488f:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  804894:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804899:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  80489d:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8048a0:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8048a5:	5b                   	pop    %rbx
+	popq %rax
+  8048a6:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8048a7:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8048ab:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8048ac:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8048b1:	c3                   	ret
+  8048b2:	66 0f 1f 44 00 00    	nopw   0x0(%rax,%rax,1)
+
+00000000008048b8 <__rodata_start>:
+  8048b8:	73 65                	jae    80491f <__rodata_start+0x67>
+  8048ba:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048bb:	64 20 30             	and    %dh,%fs:(%rax)
+  8048be:	20 66 72             	and    %ah,0x72(%rsi)
+  8048c1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8048c3:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff46941 <__bss_end+0x6f704941>
+  8048c9:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 25805347 <__bss_end+0x24fc3347>
+  8048cf:	78 20                	js     8048f1 <__rodata_start+0x39>
+  8048d1:	67 6f                	outsl  %ds:(%esi),(%dx)
+  8048d3:	74 20                	je     8048f5 <__rodata_start+0x3d>
+  8048d5:	25 64 20 66 72       	and    $0x72662064,%eax
+  8048da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8048db:	6d                   	insl   (%dx),%es:(%rdi)
+  8048dc:	20 25 78 0a 00 3c    	and    %ah,0x3c000a78(%rip)        # 3c80535a <__bss_end+0x3bfc335a>
+  8048e2:	75 6e                	jne    804952 <__rodata_start+0x9a>
+  8048e4:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  8048e8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048e9:	3e 00 30             	ds add %dh,(%rax)
+  8048ec:	31 32                	xor    %esi,(%rdx)
+  8048ee:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  8048f5:	41                   	rex.B
+  8048f6:	42                   	rex.X
+  8048f7:	43                   	rex.XB
+  8048f8:	44                   	rex.R
+  8048f9:	45                   	rex.RB
+  8048fa:	46 00 30             	rex.RX add %r14b,(%rax)
+  8048fd:	31 32                	xor    %esi,(%rdx)
+  8048ff:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804906:	61                   	(bad)
+  804907:	62 63 64 65 66       	(bad)
+  80490c:	00 28                	add    %ch,(%rax)
+  80490e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80490f:	75 6c                	jne    80497d <__rodata_start+0xc5>
+  804911:	6c                   	insb   (%dx),%es:(%rdi)
+  804912:	29 00                	sub    %eax,(%rax)
+  804914:	65 72 72             	gs jb  804989 <__rodata_start+0xd1>
+  804917:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804918:	72 20                	jb     80493a <__rodata_start+0x82>
+  80491a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80491f:	73 70                	jae    804991 <__rodata_start+0xd9>
+  804921:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804925:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80492c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80492d:	72 00                	jb     80492f <__rodata_start+0x77>
+  80492f:	62 61 64 20 65       	(bad)
+  804934:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804935:	76 69                	jbe    8049a0 <__rodata_start+0xe8>
+  804937:	72 6f                	jb     8049a8 <__rodata_start+0xf0>
+  804939:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80493a:	6d                   	insl   (%dx),%es:(%rdi)
+  80493b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80493d:	74 00                	je     80493f <__rodata_start+0x87>
+  80493f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804946:	20 70 61             	and    %dh,0x61(%rax)
+  804949:	72 61                	jb     8049ac <__rodata_start+0xf4>
+  80494b:	6d                   	insl   (%dx),%es:(%rdi)
+  80494c:	65 74 65             	gs je  8049b4 <__rodata_start+0xfc>
+  80494f:	72 00                	jb     804951 <__rodata_start+0x99>
+  804951:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804952:	75 74                	jne    8049c8 <__rodata_start+0x110>
+  804954:	20 6f 66             	and    %ch,0x66(%rdi)
+  804957:	20 6d 65             	and    %ch,0x65(%rbp)
+  80495a:	6d                   	insl   (%dx),%es:(%rdi)
+  80495b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80495c:	72 79                	jb     8049d7 <__rodata_start+0x11f>
+  80495e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804961:	74 20                	je     804983 <__rodata_start+0xcb>
+  804963:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804964:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804968:	76 69                	jbe    8049d3 <__rodata_start+0x11b>
+  80496a:	72 6f                	jb     8049db <__rodata_start+0x123>
+  80496c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80496d:	6d                   	insl   (%dx),%es:(%rdi)
+  80496e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804970:	74 73                	je     8049e5 <__rodata_start+0x12d>
+  804972:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804975:	72 72                	jb     8049e9 <__rodata_start+0x131>
+  804977:	75 70                	jne    8049e9 <__rodata_start+0x131>
+  804979:	74 65                	je     8049e0 <__rodata_start+0x128>
+  80497b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804980:	75 67                	jne    8049e9 <__rodata_start+0x131>
+  804982:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804985:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804987:	00 73 65             	add    %dh,0x65(%rbx)
+  80498a:	67 6d                	insl   (%dx),%es:(%edi)
+  80498c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80498e:	74 61                	je     8049f1 <__rodata_start+0x139>
+  804990:	74 69                	je     8049fb <__rodata_start+0x143>
+  804992:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804993:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804994:	20 66 61             	and    %ah,0x61(%rsi)
+  804997:	75 6c                	jne    804a05 <__rodata_start+0x14d>
+  804999:	74 00                	je     80499b <__rodata_start+0xe3>
+  80499b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049a2:	20 45 4c             	and    %al,0x4c(%rbp)
+  8049a5:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8049a9:	61                   	(bad)
+  8049aa:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8049af:	20 73 75             	and    %dh,0x75(%rbx)
+  8049b2:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8049b5:	73 79                	jae    804a30 <__rodata_start+0x178>
+  8049b7:	73 74                	jae    804a2d <__rodata_start+0x175>
+  8049b9:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8049bb:	20 63 61             	and    %ah,0x61(%rbx)
+  8049be:	6c                   	insb   (%dx),%es:(%rdi)
+  8049bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8049c0:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8049c3:	74 72                	je     804a37 <__rodata_start+0x17f>
+  8049c5:	79 20                	jns    8049e7 <__rodata_start+0x12f>
+  8049c7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049c8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049c9:	74 20                	je     8049eb <__rodata_start+0x133>
+  8049cb:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049cd:	75 6e                	jne    804a3d <__rodata_start+0x185>
+  8049cf:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8049d3:	76 20                	jbe    8049f5 <__rodata_start+0x13d>
+  8049d5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8049dc:	72 65                	jb     804a43 <__rodata_start+0x18b>
+  8049de:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8049e1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8049e6:	65 78 70             	gs js  804a59 <__rodata_start+0x1a1>
+  8049e9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  8049ee:	20 65 6e             	and    %ah,0x6e(%rbp)
+  8049f1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  8049f5:	20 66 69             	and    %ah,0x69(%rsi)
+  8049f8:	6c                   	insb   (%dx),%es:(%rdi)
+  8049f9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  8049fd:	20 66 72             	and    %ah,0x72(%rsi)
+  804a00:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a05:	61                   	(bad)
+  804a06:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a09:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a0a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a0b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a0f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a12:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a13:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a14:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a17:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a18:	79 20                	jns    804a3a <__rodata_start+0x182>
+  804a1a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a21:	72 65                	jb     804a88 <__rodata_start+0x1d0>
+  804a23:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a26:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a28:	00 66 69             	add    %ah,0x69(%rsi)
+  804a2b:	6c                   	insb   (%dx),%es:(%rdi)
+  804a2c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a30:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a34:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a37:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a38:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a39:	74 20                	je     804a5b <__rodata_start+0x1a3>
+  804a3b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a3d:	75 6e                	jne    804aad <__rodata_start+0x1f5>
+  804a3f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804a43:	76 61                	jbe    804aa6 <__rodata_start+0x1ee>
+  804a45:	6c                   	insb   (%dx),%es:(%rdi)
+  804a46:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a4d:	00 
+  804a4e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804a55:	72 65                	jb     804abc <__rodata_start+0x204>
+  804a57:	61                   	(bad)
+  804a58:	64 79 20             	fs jns 804a7b <__rodata_start+0x1c3>
+  804a5b:	65 78 69             	gs js  804ac7 <__rodata_start+0x20f>
+  804a5e:	73 74                	jae    804ad4 <__rodata_start+0x21c>
+  804a60:	73 00                	jae    804a62 <__rodata_start+0x1aa>
+  804a62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a63:	70 65                	jo     804aca <__rodata_start+0x212>
+  804a65:	72 61                	jb     804ac8 <__rodata_start+0x210>
+  804a67:	74 69                	je     804ad2 <__rodata_start+0x21a>
+  804a69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a6b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a6e:	74 20                	je     804a90 <__rodata_start+0x1d8>
+  804a70:	73 75                	jae    804ae7 <__rodata_start+0x22f>
+  804a72:	70 70                	jo     804ae4 <__rodata_start+0x22c>
+  804a74:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a75:	72 74                	jb     804aeb <__rodata_start+0x233>
+  804a77:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a7d:	20 61 67             	and    %ah,0x67(%rcx)
+  804a80:	61                   	(bad)
+  804a81:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804a88:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804a8c:	74 00                	je     804a8e <__rodata_start+0x1d6>
+  804a8e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804a95:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a98:	20 75 73             	and    %dh,0x73(%rbp)
+  804a9b:	65 00 0f             	add    %cl,%gs:(%rdi)
+  804a9e:	1f                   	(bad)
+  804a9f:	00 a6 04 80 00 00    	add    %ah,0x8004(%rsi)
+  804aa5:	00 00                	add    %al,(%rax)
+  804aa7:	00 e7                	add    %ah,%bh
+  804aa9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aaf:	00 d7                	add    %dl,%bh
+  804ab1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ab7:	00 e7                	add    %ah,%bh
+  804ab9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804abf:	00 e7                	add    %ah,%bh
+  804ac1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ac7:	00 e7                	add    %ah,%bh
+  804ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804acf:	00 e7                	add    %ah,%bh
+  804ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ad7:	00 c5                	add    %al,%ch
+  804ad9:	04 80                	add    $0x80,%al
+  804adb:	00 00                	add    %al,(%rax)
+  804add:	00 00                	add    %al,(%rax)
+  804adf:	00 e7                	add    %ah,%bh
+  804ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ae7:	00 e7                	add    %ah,%bh
+  804ae9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aef:	00 b9 04 80 00 00    	add    %bh,0x8004(%rcx)
+  804af5:	00 00                	add    %al,(%rax)
+  804af7:	00 33                	add    %dh,(%rbx)
+  804af9:	05 80 00 00 00       	add    $0x80,%eax
+  804afe:	00 00                	add    %al,(%rax)
+  804b00:	e7 0a                	out    %eax,$0xa
+  804b02:	80 00 00             	addb   $0x0,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 b9 04 80 00 00    	add    %bh,0x8004(%rcx)
+  804b0d:	00 00                	add    %al,(%rax)
+  804b0f:	00 ff                	add    %bh,%bh
+  804b11:	04 80                	add    $0x80,%al
+  804b13:	00 00                	add    %al,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 ff                	add    %bh,%bh
+  804b19:	04 80                	add    $0x80,%al
+  804b1b:	00 00                	add    %al,(%rax)
+  804b1d:	00 00                	add    %al,(%rax)
+  804b1f:	00 ff                	add    %bh,%bh
+  804b21:	04 80                	add    $0x80,%al
+  804b23:	00 00                	add    %al,(%rax)
+  804b25:	00 00                	add    %al,(%rax)
+  804b27:	00 ff                	add    %bh,%bh
+  804b29:	04 80                	add    $0x80,%al
+  804b2b:	00 00                	add    %al,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 ff                	add    %bh,%bh
+  804b31:	04 80                	add    $0x80,%al
+  804b33:	00 00                	add    %al,(%rax)
+  804b35:	00 00                	add    %al,(%rax)
+  804b37:	00 ff                	add    %bh,%bh
+  804b39:	04 80                	add    $0x80,%al
+  804b3b:	00 00                	add    %al,(%rax)
+  804b3d:	00 00                	add    %al,(%rax)
+  804b3f:	00 ff                	add    %bh,%bh
+  804b41:	04 80                	add    $0x80,%al
+  804b43:	00 00                	add    %al,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 ff                	add    %bh,%bh
+  804b49:	04 80                	add    $0x80,%al
+  804b4b:	00 00                	add    %al,(%rax)
+  804b4d:	00 00                	add    %al,(%rax)
+  804b4f:	00 ff                	add    %bh,%bh
+  804b51:	04 80                	add    $0x80,%al
+  804b53:	00 00                	add    %al,(%rax)
+  804b55:	00 00                	add    %al,(%rax)
+  804b57:	00 e7                	add    %ah,%bh
+  804b59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b5f:	00 e7                	add    %ah,%bh
+  804b61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b67:	00 e7                	add    %ah,%bh
+  804b69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b6f:	00 e7                	add    %ah,%bh
+  804b71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b77:	00 e7                	add    %ah,%bh
+  804b79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b7f:	00 e7                	add    %ah,%bh
+  804b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b87:	00 e7                	add    %ah,%bh
+  804b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b8f:	00 e7                	add    %ah,%bh
+  804b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b97:	00 e7                	add    %ah,%bh
+  804b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b9f:	00 e7                	add    %ah,%bh
+  804ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ba7:	00 e7                	add    %ah,%bh
+  804ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804baf:	00 e7                	add    %ah,%bh
+  804bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bb7:	00 e7                	add    %ah,%bh
+  804bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bbf:	00 e7                	add    %ah,%bh
+  804bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bc7:	00 e7                	add    %ah,%bh
+  804bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bcf:	00 e7                	add    %ah,%bh
+  804bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bd7:	00 e7                	add    %ah,%bh
+  804bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bdf:	00 e7                	add    %ah,%bh
+  804be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804be7:	00 e7                	add    %ah,%bh
+  804be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bef:	00 e7                	add    %ah,%bh
+  804bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bf7:	00 e7                	add    %ah,%bh
+  804bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bff:	00 e7                	add    %ah,%bh
+  804c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c07:	00 e7                	add    %ah,%bh
+  804c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c0f:	00 e7                	add    %ah,%bh
+  804c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c17:	00 e7                	add    %ah,%bh
+  804c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c1f:	00 e7                	add    %ah,%bh
+  804c21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c27:	00 e7                	add    %ah,%bh
+  804c29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c2f:	00 e7                	add    %ah,%bh
+  804c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c37:	00 e7                	add    %ah,%bh
+  804c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c3f:	00 e7                	add    %ah,%bh
+  804c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c47:	00 0a                	add    %cl,(%rdx)
+  804c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c4f:	00 e7                	add    %ah,%bh
+  804c51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c57:	00 e7                	add    %ah,%bh
+  804c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c5f:	00 e7                	add    %ah,%bh
+  804c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c67:	00 e7                	add    %ah,%bh
+  804c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c6f:	00 e7                	add    %ah,%bh
+  804c71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c77:	00 e7                	add    %ah,%bh
+  804c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c7f:	00 e7                	add    %ah,%bh
+  804c81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c87:	00 e7                	add    %ah,%bh
+  804c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c8f:	00 e7                	add    %ah,%bh
+  804c91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c97:	00 e7                	add    %ah,%bh
+  804c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c9f:	00 56 05             	add    %dl,0x5(%rsi)
+  804ca2:	80 00 00             	addb   $0x0,(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 25 07 80 00 00    	add    %ah,0x8007(%rip)        # 80ccb4 <__ctors_end+0x6bd4>
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 e7                	add    %ah,%bh
+  804cb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cb7:	00 e7                	add    %ah,%bh
+  804cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cbf:	00 e7                	add    %ah,%bh
+  804cc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cc7:	00 e7                	add    %ah,%bh
+  804cc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ccf:	00 85 05 80 00 00    	add    %al,0x8005(%rbp)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 e7                	add    %ah,%bh
+  804cd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cdf:	00 e7                	add    %ah,%bh
+  804ce1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ce7:	00 4b 05             	add    %cl,0x5(%rbx)
+  804cea:	80 00 00             	addb   $0x0,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 e7                	add    %ah,%bh
+  804cf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cf7:	00 e7                	add    %ah,%bh
+  804cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cff:	00 cd                	add    %cl,%ch
+  804d01:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804d07:	00 97 09 80 00 00    	add    %dl,0x8009(%rdi)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 e7                	add    %ah,%bh
+  804d11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d17:	00 e7                	add    %ah,%bh
+  804d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d1f:	00 1c 06             	add    %bl,(%rsi,%rax,1)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 e7                	add    %ah,%bh
+  804d29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d2f:	00 f9                	add    %bh,%cl
+  804d31:	07                   	(bad)
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 e7                	add    %ah,%bh
+  804d39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d3f:	00 e7                	add    %ah,%bh
+  804d41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d47:	00 0a                	add    %cl,(%rdx)
+  804d49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d4f:	00 e7                	add    %ah,%bh
+  804d51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d57:	00 af 04 80 00 00    	add    %ch,0x8004(%rdi)
+  804d5d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804d60 <error_string>:
+	...
+  804d68:	1d 49 80 00 00 00 00 00 2f 49 80 00 00 00 00 00     .I....../I......
+  804d78:	3f 49 80 00 00 00 00 00 51 49 80 00 00 00 00 00     ?I......QI......
+  804d88:	5f 49 80 00 00 00 00 00 73 49 80 00 00 00 00 00     _I......sI......
+  804d98:	88 49 80 00 00 00 00 00 9b 49 80 00 00 00 00 00     .I.......I......
+  804da8:	ad 49 80 00 00 00 00 00 c1 49 80 00 00 00 00 00     .I.......I......
+  804db8:	d1 49 80 00 00 00 00 00 e4 49 80 00 00 00 00 00     .I.......I......
+  804dc8:	fb 49 80 00 00 00 00 00 11 4a 80 00 00 00 00 00     .I.......J......
+  804dd8:	29 4a 80 00 00 00 00 00 41 4a 80 00 00 00 00 00     )J......AJ......
+  804de8:	4e 4a 80 00 00 00 00 00 18 4e 80 00 00 00 00 00     NJ.......N......
+  804df8:	62 4a 80 00 00 00 00 00 7a 4a 80 00 00 00 00 00     bJ......zJ......
+  804e08:	84 4a 80 00 00 00 00 00 8e 4a 80 00 00 00 00 00     .J.......J......
+  804e18:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e28:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e38:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e48:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e58:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804e68:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804e78:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804e88:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804e98:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804ea8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  804eb8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804ec8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804ed8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804ee8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804ef8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f08:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f18:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804f28:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f38:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f40 <devtab>:
+  804f40:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f50:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804f60:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804f70:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804f80:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804f90:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804fa0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804fb0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804fc0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804fd0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  804fe0:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  804ff0:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805000:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805010:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805020:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805030:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805040:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805050:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  805060:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805070:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805080:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805090:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805100:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805110:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805120:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805130:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805140:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805150:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805160:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805170:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805180:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805190:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
@@ -0,0 +1,8590 @@
+
+obj/user/pingpongbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 1f 01 00 00       	call   800142 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/x86.h>
+
+#define NROUNDS 10000
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 55                	push   %r13
+  80002b:	41 54                	push   %r12
+  80002d:	53                   	push   %rbx
+  80002e:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = fork()) == 0) {
+  800032:	48 b8 7c 15 80 00 00 	movabs $0x80157c,%rax
+  800039:	00 00 00 
+  80003c:	ff d0                	call   *%rax
+  80003e:	89 45 dc             	mov    %eax,-0x24(%rbp)
+  800041:	85 c0                	test   %eax,%eax
+  800043:	0f 84 aa 00 00 00    	je     8000f3 <umain+0xce>
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800049:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  80004b:	48 c1 e2 20          	shl    $0x20,%rdx
+  80004f:	89 c0                	mov    %eax,%eax
+  800051:	48 89 d3             	mov    %rdx,%rbx
+  800054:	48 09 c3             	or     %rax,%rbx
+            if (i + 1 >= NROUNDS) return;
+        }
+    }
+
+    uint64_t start = read_tsc();
+    for (uint32_t i = 0; i < NROUNDS;) {
+  800057:	be 00 00 00 00       	mov    $0x0,%esi
+        ipc_send(who, i, 0, 0, 0);
+  80005c:	49 bd ae 17 80 00 00 	movabs $0x8017ae,%r13
+  800063:	00 00 00 
+        i = ipc_recv(NULL, 0, 0, 0);
+  800066:	49 bc 8a 17 80 00 00 	movabs $0x80178a,%r12
+  80006d:	00 00 00 
+        ipc_send(who, i, 0, 0, 0);
+  800070:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800076:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80007b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800080:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800083:	41 ff d5             	call   *%r13
+        i = ipc_recv(NULL, 0, 0, 0);
+  800086:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80008b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800090:	be 00 00 00 00       	mov    $0x0,%esi
+  800095:	bf 00 00 00 00       	mov    $0x0,%edi
+  80009a:	41 ff d4             	call   *%r12
+  80009d:	89 c6                	mov    %eax,%esi
+    for (uint32_t i = 0; i < NROUNDS;) {
+  80009f:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+  8000a4:	76 ca                	jbe    800070 <umain+0x4b>
+    asm volatile("rdtsc"
+  8000a6:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000a8:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000ac:	89 c0                	mov    %eax,%eax
+  8000ae:	48 09 c2             	or     %rax,%rdx
+    }
+    uint64_t cycles = read_tsc() - start;
+  8000b1:	48 29 da             	sub    %rbx,%rdx
+
+    cprintf("pingpongbench: %d round trips, %lu cycles per round trip\n",
+            NROUNDS, (unsigned long)(cycles / NROUNDS));
+  8000b4:	48 b9 4b 59 86 38 d6 	movabs $0x346dc5d63886594b,%rcx
+  8000bb:	c5 6d 34 
+  8000be:	48 89 d0             	mov    %rdx,%rax
+  8000c1:	48 f7 e1             	mul    %rcx
+  8000c4:	48 c1 ea 0b          	shr    $0xb,%rdx
+    cprintf("pingpongbench: %d round trips, %lu cycles per round trip\n",
+  8000c8:	be 10 27 00 00       	mov    $0x2710,%esi
+  8000cd:	48 bf c0 48 80 00 00 	movabs $0x8048c0,%rdi
+  8000d4:	00 00 00 
+  8000d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000dc:	48 b9 c5 02 80 00 00 	movabs $0x8002c5,%rcx
+  8000e3:	00 00 00 
+  8000e6:	ff d1                	call   *%rcx
+}
+  8000e8:	48 83 c4 18          	add    $0x18,%rsp
+  8000ec:	5b                   	pop    %rbx
+  8000ed:	41 5c                	pop    %r12
+  8000ef:	41 5d                	pop    %r13
+  8000f1:	5d                   	pop    %rbp
+  8000f2:	c3                   	ret
+            uint32_t i = ipc_recv(&who, 0, 0, 0);
+  8000f3:	49 bd 8a 17 80 00 00 	movabs $0x80178a,%r13
+  8000fa:	00 00 00 
+            ipc_send(who, i + 1, 0, 0, 0);
+  8000fd:	49 bc ae 17 80 00 00 	movabs $0x8017ae,%r12
+  800104:	00 00 00 
+            uint32_t i = ipc_recv(&who, 0, 0, 0);
+  800107:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80010c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800111:	be 00 00 00 00       	mov    $0x0,%esi
+  800116:	48 8d 7d dc          	lea    -0x24(%rbp),%rdi
+  80011a:	41 ff d5             	call   *%r13
+            ipc_send(who, i + 1, 0, 0, 0);
+  80011d:	8d 58 01             	lea    0x1(%rax),%ebx
+  800120:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  800126:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80012b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800130:	89 de                	mov    %ebx,%esi
+  800132:	8b 7d dc             	mov    -0x24(%rbp),%edi
+  800135:	41 ff d4             	call   *%r12
+            if (i + 1 >= NROUNDS) return;
+  800138:	81 fb 0f 27 00 00    	cmp    $0x270f,%ebx
+  80013e:	76 c7                	jbe    800107 <umain+0xe2>
+  800140:	eb a6                	jmp    8000e8 <umain+0xc3>
+
+0000000000800142 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800142:	55                   	push   %rbp
+  800143:	48 89 e5             	mov    %rsp,%rbp
+  800146:	41 56                	push   %r14
+  800148:	41 55                	push   %r13
+  80014a:	41 54                	push   %r12
+  80014c:	53                   	push   %rbx
+  80014d:	41 89 fd             	mov    %edi,%r13d
+  800150:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800153:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  80015a:	00 00 00 
+  80015d:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  800164:	00 00 00 
+  800167:	48 39 c2             	cmp    %rax,%rdx
+  80016a:	73 17                	jae    800183 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  80016c:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  80016f:	49 89 c4             	mov    %rax,%r12
+  800172:	48 83 c3 08          	add    $0x8,%rbx
+  800176:	b8 00 00 00 00       	mov    $0x0,%eax
+  80017b:	ff 53 f8             	call   *-0x8(%rbx)
+  80017e:	4c 39 e3             	cmp    %r12,%rbx
+  800181:	72 ef                	jb     800172 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800183:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80018a:	00 00 00 
+  80018d:	ff d0                	call   *%rax
+  80018f:	89 c2                	mov    %eax,%edx
+  800191:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800197:	48 89 d0             	mov    %rdx,%rax
+  80019a:	48 c1 e0 04          	shl    $0x4,%rax
+  80019e:	48 29 d0             	sub    %rdx,%rax
+  8001a1:	48 c1 e0 05          	shl    $0x5,%rax
+  8001a5:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001ac:	00 00 00 
+  8001af:	48 01 d0             	add    %rdx,%rax
+  8001b2:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8001b9:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8001bc:	45 85 ed             	test   %r13d,%r13d
+  8001bf:	7e 0d                	jle    8001ce <libmain+0x8c>
+  8001c1:	49 8b 06             	mov    (%r14),%rax
+  8001c4:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8001cb:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8001ce:	4c 89 f6             	mov    %r14,%rsi
+  8001d1:	44 89 ef             	mov    %r13d,%edi
+  8001d4:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  8001db:	00 00 00 
+  8001de:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8001e0:	48 b8 f5 01 80 00 00 	movabs $0x8001f5,%rax
+  8001e7:	00 00 00 
+  8001ea:	ff d0                	call   *%rax
+#endif
+}
+  8001ec:	5b                   	pop    %rbx
+  8001ed:	41 5c                	pop    %r12
+  8001ef:	41 5d                	pop    %r13
+  8001f1:	41 5e                	pop    %r14
+  8001f3:	5d                   	pop    %rbp
+  8001f4:	c3                   	ret
+
+00000000008001f5 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  8001f5:	55                   	push   %rbp
+  8001f6:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  8001f9:	48 b8 89 1a 80 00 00 	movabs $0x801a89,%rax
+  800200:	00 00 00 
+  800203:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800205:	bf 00 00 00 00       	mov    $0x0,%edi
+  80020a:	48 b8 59 10 80 00 00 	movabs $0x801059,%rax
+  800211:	00 00 00 
+  800214:	ff d0                	call   *%rax
+}
+  800216:	5d                   	pop    %rbp
+  800217:	c3                   	ret
+
+0000000000800218 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800218:	55                   	push   %rbp
+  800219:	48 89 e5             	mov    %rsp,%rbp
+  80021c:	53                   	push   %rbx
+  80021d:	48 83 ec 08          	sub    $0x8,%rsp
+  800221:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800224:	8b 06                	mov    (%rsi),%eax
+  800226:	8d 50 01             	lea    0x1(%rax),%edx
+  800229:	89 16                	mov    %edx,(%rsi)
+  80022b:	48 98                	cltq
+  80022d:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800232:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800238:	74 0a                	je     800244 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  80023a:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80023e:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800242:	c9                   	leave
+  800243:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800244:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800248:	be ff 00 00 00       	mov    $0xff,%esi
+  80024d:	48 b8 11 10 80 00 00 	movabs $0x801011,%rax
+  800254:	00 00 00 
+  800257:	ff d0                	call   *%rax
+        state->offset = 0;
+  800259:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80025f:	eb d9                	jmp    80023a <putch+0x22>
+
+0000000000800261 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800261:	55                   	push   %rbp
+  800262:	48 89 e5             	mov    %rsp,%rbp
+  800265:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  80026c:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80026f:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800276:	b9 21 00 00 00       	mov    $0x21,%ecx
+  80027b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800280:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800283:	48 89 f1             	mov    %rsi,%rcx
+  800286:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  80028d:	48 bf 18 02 80 00 00 	movabs $0x800218,%rdi
+  800294:	00 00 00 
+  800297:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  80029e:	00 00 00 
+  8002a1:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002a3:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002aa:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002b1:	48 b8 11 10 80 00 00 	movabs $0x801011,%rax
+  8002b8:	00 00 00 
+  8002bb:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8002bd:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8002c3:	c9                   	leave
+  8002c4:	c3                   	ret
+
+00000000008002c5 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8002c5:	55                   	push   %rbp
+  8002c6:	48 89 e5             	mov    %rsp,%rbp
+  8002c9:	48 83 ec 50          	sub    $0x50,%rsp
+  8002cd:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8002d1:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8002d5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8002d9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8002dd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8002e1:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8002e8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8002ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8002f0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8002f4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8002f8:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8002fc:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  800303:	00 00 00 
+  800306:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800308:	c9                   	leave
+  800309:	c3                   	ret
+
+000000000080030a <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  80030a:	55                   	push   %rbp
+  80030b:	48 89 e5             	mov    %rsp,%rbp
+  80030e:	41 57                	push   %r15
+  800310:	41 56                	push   %r14
+  800312:	41 55                	push   %r13
+  800314:	41 54                	push   %r12
+  800316:	53                   	push   %rbx
+  800317:	48 83 ec 18          	sub    $0x18,%rsp
+  80031b:	49 89 fc             	mov    %rdi,%r12
+  80031e:	49 89 f5             	mov    %rsi,%r13
+  800321:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800325:	8b 45 10             	mov    0x10(%rbp),%eax
+  800328:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  80032b:	41 89 cf             	mov    %ecx,%r15d
+  80032e:	4c 39 fa             	cmp    %r15,%rdx
+  800331:	73 5b                	jae    80038e <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800333:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800337:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  80033b:	85 db                	test   %ebx,%ebx
+  80033d:	7e 0e                	jle    80034d <print_num+0x43>
+            putch(padc, put_arg);
+  80033f:	4c 89 ee             	mov    %r13,%rsi
+  800342:	44 89 f7             	mov    %r14d,%edi
+  800345:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800348:	83 eb 01             	sub    $0x1,%ebx
+  80034b:	75 f2                	jne    80033f <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80034d:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800351:	48 b9 15 49 80 00 00 	movabs $0x804915,%rcx
+  800358:	00 00 00 
+  80035b:	48 b8 04 49 80 00 00 	movabs $0x804904,%rax
+  800362:	00 00 00 
+  800365:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800369:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80036d:	ba 00 00 00 00       	mov    $0x0,%edx
+  800372:	49 f7 f7             	div    %r15
+  800375:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800379:	4c 89 ee             	mov    %r13,%rsi
+  80037c:	41 ff d4             	call   *%r12
+}
+  80037f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800383:	5b                   	pop    %rbx
+  800384:	41 5c                	pop    %r12
+  800386:	41 5d                	pop    %r13
+  800388:	41 5e                	pop    %r14
+  80038a:	41 5f                	pop    %r15
+  80038c:	5d                   	pop    %rbp
+  80038d:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80038e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800392:	ba 00 00 00 00       	mov    $0x0,%edx
+  800397:	49 f7 f7             	div    %r15
+  80039a:	48 83 ec 08          	sub    $0x8,%rsp
+  80039e:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003a2:	52                   	push   %rdx
+  8003a3:	45 0f be c9          	movsbl %r9b,%r9d
+  8003a7:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003ab:	48 89 c2             	mov    %rax,%rdx
+  8003ae:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  8003b5:	00 00 00 
+  8003b8:	ff d0                	call   *%rax
+  8003ba:	48 83 c4 10          	add    $0x10,%rsp
+  8003be:	eb 8d                	jmp    80034d <print_num+0x43>
+
+00000000008003c0 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8003c0:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8003c4:	48 8b 06             	mov    (%rsi),%rax
+  8003c7:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8003cb:	73 0a                	jae    8003d7 <sprintputch+0x17>
+        *state->start++ = ch;
+  8003cd:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8003d1:	48 89 16             	mov    %rdx,(%rsi)
+  8003d4:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8003d7:	c3                   	ret
+
+00000000008003d8 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8003d8:	55                   	push   %rbp
+  8003d9:	48 89 e5             	mov    %rsp,%rbp
+  8003dc:	48 83 ec 50          	sub    $0x50,%rsp
+  8003e0:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003e4:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003e8:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8003ec:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8003f3:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003f7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003fb:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003ff:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800403:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800407:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  80040e:	00 00 00 
+  800411:	ff d0                	call   *%rax
+}
+  800413:	c9                   	leave
+  800414:	c3                   	ret
+
+0000000000800415 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800415:	55                   	push   %rbp
+  800416:	48 89 e5             	mov    %rsp,%rbp
+  800419:	41 57                	push   %r15
+  80041b:	41 56                	push   %r14
+  80041d:	41 55                	push   %r13
+  80041f:	41 54                	push   %r12
+  800421:	53                   	push   %rbx
+  800422:	48 83 ec 38          	sub    $0x38,%rsp
+  800426:	49 89 fe             	mov    %rdi,%r14
+  800429:	49 89 f5             	mov    %rsi,%r13
+  80042c:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80042f:	48 8b 01             	mov    (%rcx),%rax
+  800432:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800436:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  80043a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80043e:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800442:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800446:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  80044a:	0f b6 3b             	movzbl (%rbx),%edi
+  80044d:	40 80 ff 25          	cmp    $0x25,%dil
+  800451:	74 18                	je     80046b <vprintfmt+0x56>
+            if (!ch) return;
+  800453:	40 84 ff             	test   %dil,%dil
+  800456:	0f 84 b1 06 00 00    	je     800b0d <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  80045c:	40 0f b6 ff          	movzbl %dil,%edi
+  800460:	4c 89 ee             	mov    %r13,%rsi
+  800463:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800466:	4c 89 e3             	mov    %r12,%rbx
+  800469:	eb db                	jmp    800446 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  80046b:	be 00 00 00 00       	mov    $0x0,%esi
+  800470:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800474:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800479:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80047f:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800486:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80048a:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80048f:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800494:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800497:	83 e8 23             	sub    $0x23,%eax
+  80049a:	3c 57                	cmp    $0x57,%al
+  80049c:	0f 87 51 06 00 00    	ja     800af3 <vprintfmt+0x6de>
+  8004a2:	0f b6 c0             	movzbl %al,%eax
+  8004a5:	48 b9 c0 4a 80 00 00 	movabs $0x804ac0,%rcx
+  8004ac:	00 00 00 
+  8004af:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004b2:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004b5:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004b9:	eb cf                	jmp    80048a <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8004bb:	49 89 dc             	mov    %rbx,%r12
+  8004be:	be 01 00 00 00       	mov    $0x1,%esi
+  8004c3:	eb c5                	jmp    80048a <vprintfmt+0x75>
+            padc = ch;
+  8004c5:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8004c9:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004cc:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8004cf:	eb b9                	jmp    80048a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004d1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8004d4:	83 f8 2f             	cmp    $0x2f,%eax
+  8004d7:	77 24                	ja     8004fd <vprintfmt+0xe8>
+  8004d9:	89 c1                	mov    %eax,%ecx
+  8004db:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8004df:	83 c0 08             	add    $0x8,%eax
+  8004e2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8004e5:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8004e8:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8004eb:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8004ef:	79 99                	jns    80048a <vprintfmt+0x75>
+                width = precision;
+  8004f1:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8004f5:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004fb:	eb 8d                	jmp    80048a <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8004fd:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800501:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800505:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800509:	eb da                	jmp    8004e5 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  80050b:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800510:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800514:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  80051a:	3c 39                	cmp    $0x39,%al
+  80051c:	77 1c                	ja     80053a <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80051e:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800522:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800526:	0f b6 c0             	movzbl %al,%eax
+  800529:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80052e:	0f b6 03             	movzbl (%rbx),%eax
+  800531:	3c 39                	cmp    $0x39,%al
+  800533:	76 e9                	jbe    80051e <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800535:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800538:	eb b1                	jmp    8004eb <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  80053a:	49 89 dc             	mov    %rbx,%r12
+  80053d:	eb ac                	jmp    8004eb <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80053f:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800542:	85 c9                	test   %ecx,%ecx
+  800544:	b8 00 00 00 00       	mov    $0x0,%eax
+  800549:	0f 49 c1             	cmovns %ecx,%eax
+  80054c:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80054f:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800552:	e9 33 ff ff ff       	jmp    80048a <vprintfmt+0x75>
+            lflag++;
+  800557:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  80055a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80055d:	e9 28 ff ff ff       	jmp    80048a <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800562:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800565:	83 f8 2f             	cmp    $0x2f,%eax
+  800568:	77 19                	ja     800583 <vprintfmt+0x16e>
+  80056a:	89 c2                	mov    %eax,%edx
+  80056c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800570:	83 c0 08             	add    $0x8,%eax
+  800573:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800576:	8b 3a                	mov    (%rdx),%edi
+  800578:	4c 89 ee             	mov    %r13,%rsi
+  80057b:	41 ff d6             	call   *%r14
+            break;
+  80057e:	e9 c3 fe ff ff       	jmp    800446 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800583:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800587:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80058b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80058f:	eb e5                	jmp    800576 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800591:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800594:	83 f8 2f             	cmp    $0x2f,%eax
+  800597:	77 5a                	ja     8005f3 <vprintfmt+0x1de>
+  800599:	89 c2                	mov    %eax,%edx
+  80059b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80059f:	83 c0 08             	add    $0x8,%eax
+  8005a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005a5:	8b 02                	mov    (%rdx),%eax
+  8005a7:	89 c1                	mov    %eax,%ecx
+  8005a9:	f7 d9                	neg    %ecx
+  8005ab:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005ae:	83 f9 16             	cmp    $0x16,%ecx
+  8005b1:	7f 4e                	jg     800601 <vprintfmt+0x1ec>
+  8005b3:	48 63 c1             	movslq %ecx,%rax
+  8005b6:	48 ba 80 4d 80 00 00 	movabs $0x804d80,%rdx
+  8005bd:	00 00 00 
+  8005c0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8005c4:	48 85 c0             	test   %rax,%rax
+  8005c7:	74 38                	je     800601 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8005c9:	48 89 c1             	mov    %rax,%rcx
+  8005cc:	48 ba 99 4f 80 00 00 	movabs $0x804f99,%rdx
+  8005d3:	00 00 00 
+  8005d6:	4c 89 ee             	mov    %r13,%rsi
+  8005d9:	4c 89 f7             	mov    %r14,%rdi
+  8005dc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005e1:	49 b8 d8 03 80 00 00 	movabs $0x8003d8,%r8
+  8005e8:	00 00 00 
+  8005eb:	41 ff d0             	call   *%r8
+  8005ee:	e9 53 fe ff ff       	jmp    800446 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8005f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005ff:	eb a4                	jmp    8005a5 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800601:	48 ba 2d 49 80 00 00 	movabs $0x80492d,%rdx
+  800608:	00 00 00 
+  80060b:	4c 89 ee             	mov    %r13,%rsi
+  80060e:	4c 89 f7             	mov    %r14,%rdi
+  800611:	b8 00 00 00 00       	mov    $0x0,%eax
+  800616:	49 b8 d8 03 80 00 00 	movabs $0x8003d8,%r8
+  80061d:	00 00 00 
+  800620:	41 ff d0             	call   *%r8
+  800623:	e9 1e fe ff ff       	jmp    800446 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800628:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80062b:	83 f8 2f             	cmp    $0x2f,%eax
+  80062e:	77 6c                	ja     80069c <vprintfmt+0x287>
+  800630:	89 c2                	mov    %eax,%edx
+  800632:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800636:	83 c0 08             	add    $0x8,%eax
+  800639:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80063c:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80063f:	48 85 d2             	test   %rdx,%rdx
+  800642:	48 b8 26 49 80 00 00 	movabs $0x804926,%rax
+  800649:	00 00 00 
+  80064c:	48 0f 45 c2          	cmovne %rdx,%rax
+  800650:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800654:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800658:	7e 06                	jle    800660 <vprintfmt+0x24b>
+  80065a:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80065e:	75 4a                	jne    8006aa <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800660:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800664:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800668:	0f b6 00             	movzbl (%rax),%eax
+  80066b:	84 c0                	test   %al,%al
+  80066d:	0f 85 9a 00 00 00    	jne    80070d <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  800673:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800676:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80067a:	85 c0                	test   %eax,%eax
+  80067c:	0f 8e c4 fd ff ff    	jle    800446 <vprintfmt+0x31>
+  800682:	4c 89 ee             	mov    %r13,%rsi
+  800685:	bf 20 00 00 00       	mov    $0x20,%edi
+  80068a:	41 ff d6             	call   *%r14
+  80068d:	41 83 ec 01          	sub    $0x1,%r12d
+  800691:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800695:	75 eb                	jne    800682 <vprintfmt+0x26d>
+  800697:	e9 aa fd ff ff       	jmp    800446 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80069c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006a0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006a4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006a8:	eb 92                	jmp    80063c <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006aa:	49 63 f7             	movslq %r15d,%rsi
+  8006ad:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006b1:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  8006b8:	00 00 00 
+  8006bb:	ff d0                	call   *%rax
+  8006bd:	48 89 c2             	mov    %rax,%rdx
+  8006c0:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c3:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8006c5:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8006c8:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8006cb:	85 c0                	test   %eax,%eax
+  8006cd:	7e 91                	jle    800660 <vprintfmt+0x24b>
+  8006cf:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8006d4:	4c 89 ee             	mov    %r13,%rsi
+  8006d7:	44 89 e7             	mov    %r12d,%edi
+  8006da:	41 ff d6             	call   *%r14
+  8006dd:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006e1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006e4:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8006e7:	75 eb                	jne    8006d4 <vprintfmt+0x2bf>
+  8006e9:	e9 72 ff ff ff       	jmp    800660 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8006ee:	0f b6 f8             	movzbl %al,%edi
+  8006f1:	4c 89 ee             	mov    %r13,%rsi
+  8006f4:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006f7:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8006fb:	49 83 c4 01          	add    $0x1,%r12
+  8006ff:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800705:	84 c0                	test   %al,%al
+  800707:	0f 84 66 ff ff ff    	je     800673 <vprintfmt+0x25e>
+  80070d:	45 85 ff             	test   %r15d,%r15d
+  800710:	78 0a                	js     80071c <vprintfmt+0x307>
+  800712:	41 83 ef 01          	sub    $0x1,%r15d
+  800716:	0f 88 57 ff ff ff    	js     800673 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80071c:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800720:	74 cc                	je     8006ee <vprintfmt+0x2d9>
+  800722:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800725:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80072a:	80 fa 5e             	cmp    $0x5e,%dl
+  80072d:	77 c2                	ja     8006f1 <vprintfmt+0x2dc>
+  80072f:	eb bd                	jmp    8006ee <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800731:	40 84 f6             	test   %sil,%sil
+  800734:	75 26                	jne    80075c <vprintfmt+0x347>
+    switch (lflag) {
+  800736:	85 d2                	test   %edx,%edx
+  800738:	74 59                	je     800793 <vprintfmt+0x37e>
+  80073a:	83 fa 01             	cmp    $0x1,%edx
+  80073d:	74 7b                	je     8007ba <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80073f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800742:	83 f8 2f             	cmp    $0x2f,%eax
+  800745:	0f 87 96 00 00 00    	ja     8007e1 <vprintfmt+0x3cc>
+  80074b:	89 c2                	mov    %eax,%edx
+  80074d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800751:	83 c0 08             	add    $0x8,%eax
+  800754:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800757:	4c 8b 22             	mov    (%rdx),%r12
+  80075a:	eb 17                	jmp    800773 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80075c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80075f:	83 f8 2f             	cmp    $0x2f,%eax
+  800762:	77 21                	ja     800785 <vprintfmt+0x370>
+  800764:	89 c2                	mov    %eax,%edx
+  800766:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80076a:	83 c0 08             	add    $0x8,%eax
+  80076d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800770:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800773:	4d 85 e4             	test   %r12,%r12
+  800776:	78 7a                	js     8007f2 <vprintfmt+0x3dd>
+            num = i;
+  800778:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80077b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800780:	e9 50 02 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800785:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800789:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80078d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800791:	eb dd                	jmp    800770 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800793:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800796:	83 f8 2f             	cmp    $0x2f,%eax
+  800799:	77 11                	ja     8007ac <vprintfmt+0x397>
+  80079b:	89 c2                	mov    %eax,%edx
+  80079d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007a1:	83 c0 08             	add    $0x8,%eax
+  8007a4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a7:	4c 63 22             	movslq (%rdx),%r12
+  8007aa:	eb c7                	jmp    800773 <vprintfmt+0x35e>
+  8007ac:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007b0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007b4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007b8:	eb ed                	jmp    8007a7 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8007ba:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007bd:	83 f8 2f             	cmp    $0x2f,%eax
+  8007c0:	77 11                	ja     8007d3 <vprintfmt+0x3be>
+  8007c2:	89 c2                	mov    %eax,%edx
+  8007c4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007c8:	83 c0 08             	add    $0x8,%eax
+  8007cb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ce:	4c 8b 22             	mov    (%rdx),%r12
+  8007d1:	eb a0                	jmp    800773 <vprintfmt+0x35e>
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb ed                	jmp    8007ce <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8007e1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007e5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007e9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007ed:	e9 65 ff ff ff       	jmp    800757 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8007f2:	4c 89 ee             	mov    %r13,%rsi
+  8007f5:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8007fa:	41 ff d6             	call   *%r14
+                i = -i;
+  8007fd:	49 f7 dc             	neg    %r12
+  800800:	e9 73 ff ff ff       	jmp    800778 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800805:	40 84 f6             	test   %sil,%sil
+  800808:	75 32                	jne    80083c <vprintfmt+0x427>
+    switch (lflag) {
+  80080a:	85 d2                	test   %edx,%edx
+  80080c:	74 5d                	je     80086b <vprintfmt+0x456>
+  80080e:	83 fa 01             	cmp    $0x1,%edx
+  800811:	0f 84 82 00 00 00    	je     800899 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800817:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081a:	83 f8 2f             	cmp    $0x2f,%eax
+  80081d:	0f 87 a5 00 00 00    	ja     8008c8 <vprintfmt+0x4b3>
+  800823:	89 c2                	mov    %eax,%edx
+  800825:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800829:	83 c0 08             	add    $0x8,%eax
+  80082c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80082f:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800832:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800837:	e9 99 01 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80083c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80083f:	83 f8 2f             	cmp    $0x2f,%eax
+  800842:	77 19                	ja     80085d <vprintfmt+0x448>
+  800844:	89 c2                	mov    %eax,%edx
+  800846:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80084a:	83 c0 08             	add    $0x8,%eax
+  80084d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800850:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800853:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800858:	e9 78 01 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+  80085d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800861:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800865:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800869:	eb e5                	jmp    800850 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80086b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80086e:	83 f8 2f             	cmp    $0x2f,%eax
+  800871:	77 18                	ja     80088b <vprintfmt+0x476>
+  800873:	89 c2                	mov    %eax,%edx
+  800875:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800879:	83 c0 08             	add    $0x8,%eax
+  80087c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087f:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800881:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800886:	e9 4a 01 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+  80088b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80088f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800893:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800897:	eb e6                	jmp    80087f <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800899:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80089c:	83 f8 2f             	cmp    $0x2f,%eax
+  80089f:	77 19                	ja     8008ba <vprintfmt+0x4a5>
+  8008a1:	89 c2                	mov    %eax,%edx
+  8008a3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008a7:	83 c0 08             	add    $0x8,%eax
+  8008aa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ad:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008b0:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008b5:	e9 1b 01 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+  8008ba:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008be:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008c6:	eb e5                	jmp    8008ad <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8008c8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008cc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d4:	e9 56 ff ff ff       	jmp    80082f <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8008d9:	40 84 f6             	test   %sil,%sil
+  8008dc:	75 2e                	jne    80090c <vprintfmt+0x4f7>
+    switch (lflag) {
+  8008de:	85 d2                	test   %edx,%edx
+  8008e0:	74 59                	je     80093b <vprintfmt+0x526>
+  8008e2:	83 fa 01             	cmp    $0x1,%edx
+  8008e5:	74 7f                	je     800966 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8008e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ed:	0f 87 9f 00 00 00    	ja     800992 <vprintfmt+0x57d>
+  8008f3:	89 c2                	mov    %eax,%edx
+  8008f5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f9:	83 c0 08             	add    $0x8,%eax
+  8008fc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ff:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800902:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800907:	e9 c9 00 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80090c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80090f:	83 f8 2f             	cmp    $0x2f,%eax
+  800912:	77 19                	ja     80092d <vprintfmt+0x518>
+  800914:	89 c2                	mov    %eax,%edx
+  800916:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80091a:	83 c0 08             	add    $0x8,%eax
+  80091d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800920:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800923:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	e9 a8 00 00 00       	jmp    8009d5 <vprintfmt+0x5c0>
+  80092d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800931:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800935:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800939:	eb e5                	jmp    800920 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80093b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80093e:	83 f8 2f             	cmp    $0x2f,%eax
+  800941:	77 15                	ja     800958 <vprintfmt+0x543>
+  800943:	89 c2                	mov    %eax,%edx
+  800945:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800949:	83 c0 08             	add    $0x8,%eax
+  80094c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094f:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800951:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800956:	eb 7d                	jmp    8009d5 <vprintfmt+0x5c0>
+  800958:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800960:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800964:	eb e9                	jmp    80094f <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800966:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800969:	83 f8 2f             	cmp    $0x2f,%eax
+  80096c:	77 16                	ja     800984 <vprintfmt+0x56f>
+  80096e:	89 c2                	mov    %eax,%edx
+  800970:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800974:	83 c0 08             	add    $0x8,%eax
+  800977:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80097a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80097d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800982:	eb 51                	jmp    8009d5 <vprintfmt+0x5c0>
+  800984:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800988:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80098c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800990:	eb e8                	jmp    80097a <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800992:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800996:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80099a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80099e:	e9 5c ff ff ff       	jmp    8008ff <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009a3:	4c 89 ee             	mov    %r13,%rsi
+  8009a6:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009ab:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009ae:	4c 89 ee             	mov    %r13,%rsi
+  8009b1:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009b6:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009bf:	77 47                	ja     800a08 <vprintfmt+0x5f3>
+  8009c1:	89 c2                	mov    %eax,%edx
+  8009c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c7:	83 c0 08             	add    $0x8,%eax
+  8009ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009cd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8009d0:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8009d5:	48 83 ec 08          	sub    $0x8,%rsp
+  8009d9:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8009dd:	0f 94 c0             	sete   %al
+  8009e0:	0f b6 c0             	movzbl %al,%eax
+  8009e3:	50                   	push   %rax
+  8009e4:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8009e9:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8009ed:	4c 89 ee             	mov    %r13,%rsi
+  8009f0:	4c 89 f7             	mov    %r14,%rdi
+  8009f3:	48 b8 0a 03 80 00 00 	movabs $0x80030a,%rax
+  8009fa:	00 00 00 
+  8009fd:	ff d0                	call   *%rax
+            break;
+  8009ff:	48 83 c4 10          	add    $0x10,%rsp
+  800a03:	e9 3e fa ff ff       	jmp    800446 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a08:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a0c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a10:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a14:	eb b7                	jmp    8009cd <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a16:	40 84 f6             	test   %sil,%sil
+  800a19:	75 2b                	jne    800a46 <vprintfmt+0x631>
+    switch (lflag) {
+  800a1b:	85 d2                	test   %edx,%edx
+  800a1d:	74 56                	je     800a75 <vprintfmt+0x660>
+  800a1f:	83 fa 01             	cmp    $0x1,%edx
+  800a22:	74 7f                	je     800aa3 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a24:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a27:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2a:	0f 87 a2 00 00 00    	ja     800ad2 <vprintfmt+0x6bd>
+  800a30:	89 c2                	mov    %eax,%edx
+  800a32:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a36:	83 c0 08             	add    $0x8,%eax
+  800a39:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a3f:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a44:	eb 8f                	jmp    8009d5 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a46:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a49:	83 f8 2f             	cmp    $0x2f,%eax
+  800a4c:	77 19                	ja     800a67 <vprintfmt+0x652>
+  800a4e:	89 c2                	mov    %eax,%edx
+  800a50:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a54:	83 c0 08             	add    $0x8,%eax
+  800a57:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a5a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a5d:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a62:	e9 6e ff ff ff       	jmp    8009d5 <vprintfmt+0x5c0>
+  800a67:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a73:	eb e5                	jmp    800a5a <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800a75:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a78:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7b:	77 18                	ja     800a95 <vprintfmt+0x680>
+  800a7d:	89 c2                	mov    %eax,%edx
+  800a7f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a83:	83 c0 08             	add    $0x8,%eax
+  800a86:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a89:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800a8b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800a90:	e9 40 ff ff ff       	jmp    8009d5 <vprintfmt+0x5c0>
+  800a95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa1:	eb e6                	jmp    800a89 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800aa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa6:	83 f8 2f             	cmp    $0x2f,%eax
+  800aa9:	77 19                	ja     800ac4 <vprintfmt+0x6af>
+  800aab:	89 c2                	mov    %eax,%edx
+  800aad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab1:	83 c0 08             	add    $0x8,%eax
+  800ab4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab7:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aba:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800abf:	e9 11 ff ff ff       	jmp    8009d5 <vprintfmt+0x5c0>
+  800ac4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ac8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800acc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ad0:	eb e5                	jmp    800ab7 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800ad2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ad6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ada:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ade:	e9 59 ff ff ff       	jmp    800a3c <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800ae3:	4c 89 ee             	mov    %r13,%rsi
+  800ae6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800aeb:	41 ff d6             	call   *%r14
+            break;
+  800aee:	e9 53 f9 ff ff       	jmp    800446 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800af3:	4c 89 ee             	mov    %r13,%rsi
+  800af6:	bf 25 00 00 00       	mov    $0x25,%edi
+  800afb:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800afe:	48 83 eb 01          	sub    $0x1,%rbx
+  800b02:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b06:	75 f6                	jne    800afe <vprintfmt+0x6e9>
+  800b08:	e9 39 f9 ff ff       	jmp    800446 <vprintfmt+0x31>
+}
+  800b0d:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b11:	5b                   	pop    %rbx
+  800b12:	41 5c                	pop    %r12
+  800b14:	41 5d                	pop    %r13
+  800b16:	41 5e                	pop    %r14
+  800b18:	41 5f                	pop    %r15
+  800b1a:	5d                   	pop    %rbp
+  800b1b:	c3                   	ret
+
+0000000000800b1c <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b1c:	55                   	push   %rbp
+  800b1d:	48 89 e5             	mov    %rsp,%rbp
+  800b20:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b24:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b28:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b2d:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b31:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b38:	48 85 ff             	test   %rdi,%rdi
+  800b3b:	74 2b                	je     800b68 <vsnprintf+0x4c>
+  800b3d:	48 85 f6             	test   %rsi,%rsi
+  800b40:	74 26                	je     800b68 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b42:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b46:	48 bf c0 03 80 00 00 	movabs $0x8003c0,%rdi
+  800b4d:	00 00 00 
+  800b50:	48 b8 15 04 80 00 00 	movabs $0x800415,%rax
+  800b57:	00 00 00 
+  800b5a:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800b5c:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800b60:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800b63:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800b66:	c9                   	leave
+  800b67:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800b68:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800b6d:	eb f7                	jmp    800b66 <vsnprintf+0x4a>
+
+0000000000800b6f <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800b6f:	55                   	push   %rbp
+  800b70:	48 89 e5             	mov    %rsp,%rbp
+  800b73:	48 83 ec 50          	sub    $0x50,%rsp
+  800b77:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800b7b:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800b7f:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800b83:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800b8a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800b8e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b92:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800b96:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800b9a:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800b9e:	48 b8 1c 0b 80 00 00 	movabs $0x800b1c,%rax
+  800ba5:	00 00 00 
+  800ba8:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800baa:	c9                   	leave
+  800bab:	c3                   	ret
+
+0000000000800bac <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bac:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800baf:	74 10                	je     800bc1 <strlen+0x15>
+    size_t n = 0;
+  800bb1:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bb6:	48 83 c0 01          	add    $0x1,%rax
+  800bba:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800bbe:	75 f6                	jne    800bb6 <strlen+0xa>
+  800bc0:	c3                   	ret
+    size_t n = 0;
+  800bc1:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800bc6:	c3                   	ret
+
+0000000000800bc7 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800bc7:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800bca:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800bcf:	48 85 f6             	test   %rsi,%rsi
+  800bd2:	74 11                	je     800be5 <strnlen+0x1e>
+  800bd4:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800bd8:	74 0c                	je     800be6 <strnlen+0x1f>
+  800bda:	48 83 c2 01          	add    $0x1,%rdx
+  800bde:	48 39 d0             	cmp    %rdx,%rax
+  800be1:	75 f1                	jne    800bd4 <strnlen+0xd>
+  800be3:	eb 04                	jmp    800be9 <strnlen+0x22>
+  800be5:	c3                   	ret
+  800be6:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800be9:	c3                   	ret
+
+0000000000800bea <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800bea:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800bed:	ba 00 00 00 00       	mov    $0x0,%edx
+  800bf2:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800bf6:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800bf9:	48 83 c2 01          	add    $0x1,%rdx
+  800bfd:	84 c9                	test   %cl,%cl
+  800bff:	75 f1                	jne    800bf2 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c01:	c3                   	ret
+
+0000000000800c02 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c02:	55                   	push   %rbp
+  800c03:	48 89 e5             	mov    %rsp,%rbp
+  800c06:	41 54                	push   %r12
+  800c08:	53                   	push   %rbx
+  800c09:	48 89 fb             	mov    %rdi,%rbx
+  800c0c:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c0f:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  800c16:	00 00 00 
+  800c19:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c1b:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c1f:	4c 89 e6             	mov    %r12,%rsi
+  800c22:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  800c29:	00 00 00 
+  800c2c:	ff d0                	call   *%rax
+    return dst;
+}
+  800c2e:	48 89 d8             	mov    %rbx,%rax
+  800c31:	5b                   	pop    %rbx
+  800c32:	41 5c                	pop    %r12
+  800c34:	5d                   	pop    %rbp
+  800c35:	c3                   	ret
+
+0000000000800c36 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c36:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c39:	48 85 d2             	test   %rdx,%rdx
+  800c3c:	74 1f                	je     800c5d <strncpy+0x27>
+  800c3e:	48 01 fa             	add    %rdi,%rdx
+  800c41:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c44:	48 83 c1 01          	add    $0x1,%rcx
+  800c48:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c4c:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c50:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c54:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c58:	48 39 ca             	cmp    %rcx,%rdx
+  800c5b:	75 e7                	jne    800c44 <strncpy+0xe>
+    }
+    return ret;
+}
+  800c5d:	c3                   	ret
+
+0000000000800c5e <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800c5e:	48 89 f8             	mov    %rdi,%rax
+  800c61:	48 85 d2             	test   %rdx,%rdx
+  800c64:	74 24                	je     800c8a <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800c66:	48 83 ea 01          	sub    $0x1,%rdx
+  800c6a:	74 1b                	je     800c87 <strlcpy+0x29>
+  800c6c:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800c70:	0f b6 16             	movzbl (%rsi),%edx
+  800c73:	84 d2                	test   %dl,%dl
+  800c75:	74 10                	je     800c87 <strlcpy+0x29>
+            *dst++ = *src++;
+  800c77:	48 83 c6 01          	add    $0x1,%rsi
+  800c7b:	48 83 c0 01          	add    $0x1,%rax
+  800c7f:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800c82:	48 39 c8             	cmp    %rcx,%rax
+  800c85:	75 e9                	jne    800c70 <strlcpy+0x12>
+        *dst = '\0';
+  800c87:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800c8a:	48 29 f8             	sub    %rdi,%rax
+}
+  800c8d:	c3                   	ret
+
+0000000000800c8e <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800c8e:	0f b6 07             	movzbl (%rdi),%eax
+  800c91:	84 c0                	test   %al,%al
+  800c93:	74 13                	je     800ca8 <strcmp+0x1a>
+  800c95:	38 06                	cmp    %al,(%rsi)
+  800c97:	75 0f                	jne    800ca8 <strcmp+0x1a>
+  800c99:	48 83 c7 01          	add    $0x1,%rdi
+  800c9d:	48 83 c6 01          	add    $0x1,%rsi
+  800ca1:	0f b6 07             	movzbl (%rdi),%eax
+  800ca4:	84 c0                	test   %al,%al
+  800ca6:	75 ed                	jne    800c95 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ca8:	0f b6 c0             	movzbl %al,%eax
+  800cab:	0f b6 16             	movzbl (%rsi),%edx
+  800cae:	29 d0                	sub    %edx,%eax
+}
+  800cb0:	c3                   	ret
+
+0000000000800cb1 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cb1:	48 85 d2             	test   %rdx,%rdx
+  800cb4:	74 1f                	je     800cd5 <strncmp+0x24>
+  800cb6:	0f b6 07             	movzbl (%rdi),%eax
+  800cb9:	84 c0                	test   %al,%al
+  800cbb:	74 1e                	je     800cdb <strncmp+0x2a>
+  800cbd:	3a 06                	cmp    (%rsi),%al
+  800cbf:	75 1a                	jne    800cdb <strncmp+0x2a>
+  800cc1:	48 83 c7 01          	add    $0x1,%rdi
+  800cc5:	48 83 c6 01          	add    $0x1,%rsi
+  800cc9:	48 83 ea 01          	sub    $0x1,%rdx
+  800ccd:	75 e7                	jne    800cb6 <strncmp+0x5>
+
+    if (!n) return 0;
+  800ccf:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cd4:	c3                   	ret
+  800cd5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800cda:	c3                   	ret
+  800cdb:	48 85 d2             	test   %rdx,%rdx
+  800cde:	74 09                	je     800ce9 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800ce0:	0f b6 07             	movzbl (%rdi),%eax
+  800ce3:	0f b6 16             	movzbl (%rsi),%edx
+  800ce6:	29 d0                	sub    %edx,%eax
+  800ce8:	c3                   	ret
+    if (!n) return 0;
+  800ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800cee:	c3                   	ret
+
+0000000000800cef <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800cef:	0f b6 17             	movzbl (%rdi),%edx
+  800cf2:	84 d2                	test   %dl,%dl
+  800cf4:	74 18                	je     800d0e <strchr+0x1f>
+        if (*str == c) {
+  800cf6:	0f be d2             	movsbl %dl,%edx
+  800cf9:	39 f2                	cmp    %esi,%edx
+  800cfb:	74 17                	je     800d14 <strchr+0x25>
+    for (; *str; str++) {
+  800cfd:	48 83 c7 01          	add    $0x1,%rdi
+  800d01:	0f b6 17             	movzbl (%rdi),%edx
+  800d04:	84 d2                	test   %dl,%dl
+  800d06:	75 ee                	jne    800cf6 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d08:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d0d:	c3                   	ret
+  800d0e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d13:	c3                   	ret
+  800d14:	48 89 f8             	mov    %rdi,%rax
+}
+  800d17:	c3                   	ret
+
+0000000000800d18 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d18:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d1b:	0f b6 17             	movzbl (%rdi),%edx
+  800d1e:	84 d2                	test   %dl,%dl
+  800d20:	74 13                	je     800d35 <strfind+0x1d>
+  800d22:	0f be d2             	movsbl %dl,%edx
+  800d25:	39 f2                	cmp    %esi,%edx
+  800d27:	74 0b                	je     800d34 <strfind+0x1c>
+  800d29:	48 83 c0 01          	add    $0x1,%rax
+  800d2d:	0f b6 10             	movzbl (%rax),%edx
+  800d30:	84 d2                	test   %dl,%dl
+  800d32:	75 ee                	jne    800d22 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d34:	c3                   	ret
+  800d35:	c3                   	ret
+
+0000000000800d36 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d36:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d39:	48 89 f8             	mov    %rdi,%rax
+  800d3c:	48 f7 d8             	neg    %rax
+  800d3f:	83 e0 07             	and    $0x7,%eax
+  800d42:	49 89 d1             	mov    %rdx,%r9
+  800d45:	49 29 c1             	sub    %rax,%r9
+  800d48:	78 36                	js     800d80 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d4a:	40 0f b6 c6          	movzbl %sil,%eax
+  800d4e:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d55:	01 01 01 
+  800d58:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800d5c:	40 f6 c7 07          	test   $0x7,%dil
+  800d60:	75 38                	jne    800d9a <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800d62:	4c 89 c9             	mov    %r9,%rcx
+  800d65:	48 c1 f9 03          	sar    $0x3,%rcx
+  800d69:	74 0c                	je     800d77 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800d6b:	fc                   	cld
+  800d6c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800d6f:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800d73:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800d77:	4d 85 c9             	test   %r9,%r9
+  800d7a:	75 45                	jne    800dc1 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800d7c:	4c 89 c0             	mov    %r8,%rax
+  800d7f:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800d80:	48 85 d2             	test   %rdx,%rdx
+  800d83:	74 f7                	je     800d7c <memset+0x46>
+  800d85:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800d88:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800d8b:	48 83 c0 01          	add    $0x1,%rax
+  800d8f:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800d93:	48 39 c2             	cmp    %rax,%rdx
+  800d96:	75 f3                	jne    800d8b <memset+0x55>
+  800d98:	eb e2                	jmp    800d7c <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800d9a:	40 f6 c7 01          	test   $0x1,%dil
+  800d9e:	74 06                	je     800da6 <memset+0x70>
+  800da0:	88 07                	mov    %al,(%rdi)
+  800da2:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800da6:	40 f6 c7 02          	test   $0x2,%dil
+  800daa:	74 07                	je     800db3 <memset+0x7d>
+  800dac:	66 89 07             	mov    %ax,(%rdi)
+  800daf:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800db3:	40 f6 c7 04          	test   $0x4,%dil
+  800db7:	74 a9                	je     800d62 <memset+0x2c>
+  800db9:	89 07                	mov    %eax,(%rdi)
+  800dbb:	48 83 c7 04          	add    $0x4,%rdi
+  800dbf:	eb a1                	jmp    800d62 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800dc1:	41 f6 c1 04          	test   $0x4,%r9b
+  800dc5:	74 06                	je     800dcd <memset+0x97>
+  800dc7:	89 07                	mov    %eax,(%rdi)
+  800dc9:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dcd:	41 f6 c1 02          	test   $0x2,%r9b
+  800dd1:	74 07                	je     800dda <memset+0xa4>
+  800dd3:	66 89 07             	mov    %ax,(%rdi)
+  800dd6:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800dda:	41 f6 c1 01          	test   $0x1,%r9b
+  800dde:	74 9c                	je     800d7c <memset+0x46>
+  800de0:	88 07                	mov    %al,(%rdi)
+  800de2:	eb 98                	jmp    800d7c <memset+0x46>
+
+0000000000800de4 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800de4:	48 89 f8             	mov    %rdi,%rax
+  800de7:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800dea:	48 39 fe             	cmp    %rdi,%rsi
+  800ded:	73 3b                	jae    800e2a <memmove+0x46>
+  800def:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800df3:	48 39 d7             	cmp    %rdx,%rdi
+  800df6:	73 32                	jae    800e2a <memmove+0x46>
+        s += n;
+        d += n;
+  800df8:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800dfc:	48 89 d6             	mov    %rdx,%rsi
+  800dff:	48 09 fe             	or     %rdi,%rsi
+  800e02:	48 09 ce             	or     %rcx,%rsi
+  800e05:	40 f6 c6 07          	test   $0x7,%sil
+  800e09:	75 12                	jne    800e1d <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e0b:	48 83 ef 08          	sub    $0x8,%rdi
+  800e0f:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e13:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e17:	fd                   	std
+  800e18:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e1b:	fc                   	cld
+  800e1c:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e1d:	48 83 ef 01          	sub    $0x1,%rdi
+  800e21:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e25:	fd                   	std
+  800e26:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e28:	eb f1                	jmp    800e1b <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e2a:	48 89 f2             	mov    %rsi,%rdx
+  800e2d:	48 09 c2             	or     %rax,%rdx
+  800e30:	48 09 ca             	or     %rcx,%rdx
+  800e33:	f6 c2 07             	test   $0x7,%dl
+  800e36:	75 0c                	jne    800e44 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e38:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e3c:	48 89 c7             	mov    %rax,%rdi
+  800e3f:	fc                   	cld
+  800e40:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e43:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e44:	48 89 c7             	mov    %rax,%rdi
+  800e47:	fc                   	cld
+  800e48:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e4a:	c3                   	ret
+
+0000000000800e4b <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e4b:	55                   	push   %rbp
+  800e4c:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e4f:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  800e56:	00 00 00 
+  800e59:	ff d0                	call   *%rax
+}
+  800e5b:	5d                   	pop    %rbp
+  800e5c:	c3                   	ret
+
+0000000000800e5d <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800e5d:	55                   	push   %rbp
+  800e5e:	48 89 e5             	mov    %rsp,%rbp
+  800e61:	41 57                	push   %r15
+  800e63:	41 56                	push   %r14
+  800e65:	41 55                	push   %r13
+  800e67:	41 54                	push   %r12
+  800e69:	53                   	push   %rbx
+  800e6a:	48 83 ec 08          	sub    $0x8,%rsp
+  800e6e:	49 89 fe             	mov    %rdi,%r14
+  800e71:	49 89 f7             	mov    %rsi,%r15
+  800e74:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800e77:	48 89 f7             	mov    %rsi,%rdi
+  800e7a:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  800e81:	00 00 00 
+  800e84:	ff d0                	call   *%rax
+  800e86:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800e89:	48 89 de             	mov    %rbx,%rsi
+  800e8c:	4c 89 f7             	mov    %r14,%rdi
+  800e8f:	48 b8 c7 0b 80 00 00 	movabs $0x800bc7,%rax
+  800e96:	00 00 00 
+  800e99:	ff d0                	call   *%rax
+  800e9b:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800e9e:	48 39 c3             	cmp    %rax,%rbx
+  800ea1:	74 36                	je     800ed9 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ea3:	48 89 d8             	mov    %rbx,%rax
+  800ea6:	4c 29 e8             	sub    %r13,%rax
+  800ea9:	49 39 c4             	cmp    %rax,%r12
+  800eac:	73 31                	jae    800edf <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800eae:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800eb3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800eb7:	4c 89 fe             	mov    %r15,%rsi
+  800eba:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  800ec1:	00 00 00 
+  800ec4:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800ec6:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800eca:	48 83 c4 08          	add    $0x8,%rsp
+  800ece:	5b                   	pop    %rbx
+  800ecf:	41 5c                	pop    %r12
+  800ed1:	41 5d                	pop    %r13
+  800ed3:	41 5e                	pop    %r14
+  800ed5:	41 5f                	pop    %r15
+  800ed7:	5d                   	pop    %rbp
+  800ed8:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ed9:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800edd:	eb eb                	jmp    800eca <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800edf:	48 83 eb 01          	sub    $0x1,%rbx
+  800ee3:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800ee7:	48 89 da             	mov    %rbx,%rdx
+  800eea:	4c 89 fe             	mov    %r15,%rsi
+  800eed:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  800ef4:	00 00 00 
+  800ef7:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800ef9:	49 01 de             	add    %rbx,%r14
+  800efc:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f01:	eb c3                	jmp    800ec6 <strlcat+0x69>
+
+0000000000800f03 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f03:	48 85 d2             	test   %rdx,%rdx
+  800f06:	74 2d                	je     800f35 <memcmp+0x32>
+  800f08:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f0d:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f11:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f16:	44 38 c1             	cmp    %r8b,%cl
+  800f19:	75 0f                	jne    800f2a <memcmp+0x27>
+    while (n-- > 0) {
+  800f1b:	48 83 c0 01          	add    $0x1,%rax
+  800f1f:	48 39 c2             	cmp    %rax,%rdx
+  800f22:	75 e9                	jne    800f0d <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f24:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f29:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f2a:	0f b6 c1             	movzbl %cl,%eax
+  800f2d:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f31:	44 29 c0             	sub    %r8d,%eax
+  800f34:	c3                   	ret
+    return 0;
+  800f35:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f3a:	c3                   	ret
+
+0000000000800f3b <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f3b:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f3f:	48 39 c7             	cmp    %rax,%rdi
+  800f42:	73 0f                	jae    800f53 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f44:	40 38 37             	cmp    %sil,(%rdi)
+  800f47:	74 0e                	je     800f57 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f49:	48 83 c7 01          	add    $0x1,%rdi
+  800f4d:	48 39 f8             	cmp    %rdi,%rax
+  800f50:	75 f2                	jne    800f44 <memfind+0x9>
+  800f52:	c3                   	ret
+  800f53:	48 89 f8             	mov    %rdi,%rax
+  800f56:	c3                   	ret
+  800f57:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800f5a:	c3                   	ret
+
+0000000000800f5b <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800f5b:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800f5e:	0f b6 37             	movzbl (%rdi),%esi
+  800f61:	40 80 fe 20          	cmp    $0x20,%sil
+  800f65:	74 06                	je     800f6d <strtol+0x12>
+  800f67:	40 80 fe 09          	cmp    $0x9,%sil
+  800f6b:	75 13                	jne    800f80 <strtol+0x25>
+  800f6d:	48 83 c7 01          	add    $0x1,%rdi
+  800f71:	0f b6 37             	movzbl (%rdi),%esi
+  800f74:	40 80 fe 20          	cmp    $0x20,%sil
+  800f78:	74 f3                	je     800f6d <strtol+0x12>
+  800f7a:	40 80 fe 09          	cmp    $0x9,%sil
+  800f7e:	74 ed                	je     800f6d <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800f80:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800f83:	83 e0 fd             	and    $0xfffffffd,%eax
+  800f86:	3c 01                	cmp    $0x1,%al
+  800f88:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800f8c:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800f92:	75 0f                	jne    800fa3 <strtol+0x48>
+  800f94:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800f97:	74 14                	je     800fad <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800f99:	85 d2                	test   %edx,%edx
+  800f9b:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fa0:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fa8:	4c 63 ca             	movslq %edx,%r9
+  800fab:	eb 36                	jmp    800fe3 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fad:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fb1:	74 0f                	je     800fc2 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800fb3:	85 d2                	test   %edx,%edx
+  800fb5:	75 ec                	jne    800fa3 <strtol+0x48>
+        s++;
+  800fb7:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  800fbb:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  800fc0:	eb e1                	jmp    800fa3 <strtol+0x48>
+        s += 2;
+  800fc2:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  800fc6:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  800fcb:	eb d6                	jmp    800fa3 <strtol+0x48>
+            dig -= '0';
+  800fcd:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  800fd0:	44 0f b6 c1          	movzbl %cl,%r8d
+  800fd4:	41 39 d0             	cmp    %edx,%r8d
+  800fd7:	7d 21                	jge    800ffa <strtol+0x9f>
+        val = val * base + dig;
+  800fd9:	49 0f af c1          	imul   %r9,%rax
+  800fdd:	0f b6 c9             	movzbl %cl,%ecx
+  800fe0:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  800fe3:	48 83 c7 01          	add    $0x1,%rdi
+  800fe7:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  800feb:	80 f9 39             	cmp    $0x39,%cl
+  800fee:	76 dd                	jbe    800fcd <strtol+0x72>
+        else if (dig - 'a' < 27)
+  800ff0:	80 f9 7b             	cmp    $0x7b,%cl
+  800ff3:	77 05                	ja     800ffa <strtol+0x9f>
+            dig -= 'a' - 10;
+  800ff5:	83 e9 57             	sub    $0x57,%ecx
+  800ff8:	eb d6                	jmp    800fd0 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  800ffa:	4d 85 d2             	test   %r10,%r10
+  800ffd:	74 03                	je     801002 <strtol+0xa7>
+  800fff:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801002:	48 89 c2             	mov    %rax,%rdx
+  801005:	48 f7 da             	neg    %rdx
+  801008:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80100c:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801010:	c3                   	ret
+
+0000000000801011 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801011:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80101b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801021:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801027:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80102d:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80102f:	c3                   	ret
+
+0000000000801030 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801030:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801035:	bf 00 00 00 00       	mov    $0x0,%edi
+  80103a:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80103f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801044:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80104a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801050:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801056:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801058:	c3                   	ret
+
+0000000000801059 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801059:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80105c:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801061:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801066:	ba 00 00 00 00       	mov    $0x0,%edx
+  80106b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801071:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801077:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80107d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80107f:	48 85 c0             	test   %rax,%rax
+  801082:	7f 01                	jg     801085 <sys_env_destroy+0x2c>
+}
+  801084:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801085:	55                   	push   %rbp
+  801086:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801089:	49 89 c0             	mov    %rax,%r8
+  80108c:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801091:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801098:	00 00 00 
+  80109b:	be 29 00 00 00       	mov    $0x29,%esi
+  8010a0:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8010a7:	00 00 00 
+  8010aa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010af:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  8010b6:	00 00 00 
+  8010b9:	41 ff d1             	call   *%r9
+
+00000000008010bc <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010bc:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010c6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010cb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010d0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010d6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010dc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010e2:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010e4:	c3                   	ret
+
+00000000008010e5 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8010e5:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8010ef:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010f9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010ff:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801105:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80110b:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80110d:	c3                   	ret
+
+000000000080110e <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80110e:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801113:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  80111a:	00 00 00 
+  80111d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801123:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801129:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80112f:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801131:	c3                   	ret
+
+0000000000801132 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801132:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801135:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80113a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801140:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801146:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801148:	c3                   	ret
+
+0000000000801149 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801149:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80114c:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801151:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801154:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80115a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801160:	0f 05                	syscall
+    if (check && ret > 0) {
+  801162:	48 85 c0             	test   %rax,%rax
+  801165:	7f 01                	jg     801168 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801167:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801168:	55                   	push   %rbp
+  801169:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80116c:	49 89 c0             	mov    %rax,%r8
+  80116f:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801174:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80117b:	00 00 00 
+  80117e:	be 29 00 00 00       	mov    $0x29,%esi
+  801183:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  80118a:	00 00 00 
+  80118d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801192:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  801199:	00 00 00 
+  80119c:	41 ff d1             	call   *%r9
+
+000000000080119f <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80119f:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011a2:	48 63 d2             	movslq %edx,%rdx
+  8011a5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011a8:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011ad:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011b0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011b2:	48 85 c0             	test   %rax,%rax
+  8011b5:	7f 01                	jg     8011b8 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011b7:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011b8:	55                   	push   %rbp
+  8011b9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011bc:	49 89 c0             	mov    %rax,%r8
+  8011bf:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8011c4:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8011cb:	00 00 00 
+  8011ce:	be 29 00 00 00       	mov    $0x29,%esi
+  8011d3:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8011da:	00 00 00 
+  8011dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e2:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  8011e9:	00 00 00 
+  8011ec:	41 ff d1             	call   *%r9
+
+00000000008011ef <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8011ef:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f2:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801203:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801209:	0f 05                	syscall
+    if (check && ret > 0) {
+  80120b:	48 85 c0             	test   %rax,%rax
+  80120e:	7f 01                	jg     801211 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801210:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801211:	55                   	push   %rbp
+  801212:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801215:	49 89 c0             	mov    %rax,%r8
+  801218:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80121d:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801224:	00 00 00 
+  801227:	be 29 00 00 00       	mov    $0x29,%esi
+  80122c:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801233:	00 00 00 
+  801236:	b8 00 00 00 00       	mov    $0x0,%eax
+  80123b:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  801242:	00 00 00 
+  801245:	41 ff d1             	call   *%r9
+
+0000000000801248 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801248:	48 63 f6             	movslq %esi,%rsi
+  80124b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80124e:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801253:	ba 00 00 00 00       	mov    $0x0,%edx
+  801258:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80125e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801264:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80126a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80126c:	48 85 c0             	test   %rax,%rax
+  80126f:	7f 01                	jg     801272 <sys_env_set_status+0x2a>
+}
+  801271:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  801272:	55                   	push   %rbp
+  801273:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801276:	49 89 c0             	mov    %rax,%r8
+  801279:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80127e:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801285:	00 00 00 
+  801288:	be 29 00 00 00       	mov    $0x29,%esi
+  80128d:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801294:	00 00 00 
+  801297:	b8 00 00 00 00       	mov    $0x0,%eax
+  80129c:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  8012a3:	00 00 00 
+  8012a6:	41 ff d1             	call   *%r9
+
+00000000008012a9 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8012a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012ac:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012b6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012bc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012c2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012c8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012ca:	48 85 c0             	test   %rax,%rax
+  8012cd:	7f 01                	jg     8012d0 <sys_env_set_trapframe+0x27>
+}
+  8012cf:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8012d0:	55                   	push   %rbp
+  8012d1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012d4:	49 89 c0             	mov    %rax,%r8
+  8012d7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8012dc:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8012e3:	00 00 00 
+  8012e6:	be 29 00 00 00       	mov    $0x29,%esi
+  8012eb:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8012f2:	00 00 00 
+  8012f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012fa:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  801301:	00 00 00 
+  801304:	41 ff d1             	call   *%r9
+
+0000000000801307 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801307:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80130a:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80130f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801314:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80131a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801320:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801326:	0f 05                	syscall
+    if (check && ret > 0) {
+  801328:	48 85 c0             	test   %rax,%rax
+  80132b:	7f 01                	jg     80132e <sys_env_set_pgfault_upcall+0x27>
+}
+  80132d:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80132e:	55                   	push   %rbp
+  80132f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801332:	49 89 c0             	mov    %rax,%r8
+  801335:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  80133a:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801341:	00 00 00 
+  801344:	be 29 00 00 00       	mov    $0x29,%esi
+  801349:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801350:	00 00 00 
+  801353:	b8 00 00 00 00       	mov    $0x0,%eax
+  801358:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  80135f:	00 00 00 
+  801362:	41 ff d1             	call   *%r9
+
+0000000000801365 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801365:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801368:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80136b:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801370:	4d 63 c0             	movslq %r8d,%r8
+  801373:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801379:	0f 05                	syscall
+}
+  80137b:	c3                   	ret
+
+000000000080137c <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80137c:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80137f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801382:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801387:	4d 63 c0             	movslq %r8d,%r8
+  80138a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801390:	0f 05                	syscall
+}
+  801392:	c3                   	ret
+
+0000000000801393 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  801393:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801398:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80139b:	45 89 c0             	mov    %r8d,%r8d
+  80139e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013a4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013a6:	48 85 c0             	test   %rax,%rax
+  8013a9:	7f 01                	jg     8013ac <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8013ab:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013ac:	55                   	push   %rbp
+  8013ad:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013b0:	49 89 c0             	mov    %rax,%r8
+  8013b3:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013b8:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  8013bf:	00 00 00 
+  8013c2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013c7:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  8013ce:	00 00 00 
+  8013d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013d6:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  8013dd:	00 00 00 
+  8013e0:	41 ff d1             	call   *%r9
+
+00000000008013e3 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8013e3:	55                   	push   %rbp
+  8013e4:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8013e7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ed:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8013f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013f7:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  8013fe:	00 00 00 
+  801401:	ff d0                	call   *%rax
+}
+  801403:	5d                   	pop    %rbp
+  801404:	c3                   	ret
+
+0000000000801405 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801405:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80140a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80140f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801414:	ba 00 00 00 00       	mov    $0x0,%edx
+  801419:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80141f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801425:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80142b:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80142d:	c3                   	ret
+
+000000000080142e <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80142e:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801433:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801443:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801449:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80144f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801451:	48 85 c0             	test   %rax,%rax
+  801454:	7f 01                	jg     801457 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801456:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801457:	55                   	push   %rbp
+  801458:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80145b:	49 89 c0             	mov    %rax,%r8
+  80145e:	b9 10 00 00 00       	mov    $0x10,%ecx
+  801463:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  80146a:	00 00 00 
+  80146d:	be 29 00 00 00       	mov    $0x29,%esi
+  801472:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801479:	00 00 00 
+  80147c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801481:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  801488:	00 00 00 
+  80148b:	41 ff d1             	call   *%r9
+
+000000000080148e <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80148e:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801493:	bf 00 00 00 00       	mov    $0x0,%edi
+  801498:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80149d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014a2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014b4:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014b6:	c3                   	ret
+
+00000000008014b7 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8014b7:	89 d2                	mov    %edx,%edx
+  8014b9:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8014bb:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014c0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014c6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014cc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014d2:	0f 05                	syscall
+}
+  8014d4:	c3                   	ret
+
+00000000008014d5 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8014d5:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014d8:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014ee:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014f4:	0f 05                	syscall
+}
+  8014f6:	c3                   	ret
+
+00000000008014f7 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8014f7:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8014fa:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801504:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80150a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801510:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801516:	0f 05                	syscall
+}
+  801518:	c3                   	ret
+
+0000000000801519 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801519:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80151c:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801521:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801526:	ba 00 00 00 00       	mov    $0x0,%edx
+  80152b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801531:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801537:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80153d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80153f:	48 85 c0             	test   %rax,%rax
+  801542:	7f 01                	jg     801545 <sys_irq_ack+0x2c>
+}
+  801544:	c3                   	ret
+sys_irq_ack(int irq) {
+  801545:	55                   	push   %rbp
+  801546:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801549:	49 89 c0             	mov    %rax,%r8
+  80154c:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801551:	48 ba 58 4e 80 00 00 	movabs $0x804e58,%rdx
+  801558:	00 00 00 
+  80155b:	be 29 00 00 00       	mov    $0x29,%esi
+  801560:	48 bf 77 4e 80 00 00 	movabs $0x804e77,%rdi
+  801567:	00 00 00 
+  80156a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156f:	49 b9 4e 45 80 00 00 	movabs $0x80454e,%r9
+  801576:	00 00 00 
+  801579:	41 ff d1             	call   *%r9
+
+000000000080157c <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  80157c:	55                   	push   %rbp
+  80157d:	48 89 e5             	mov    %rsp,%rbp
+  801580:	41 54                	push   %r12
+  801582:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  801583:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  80158a:	00 00 00 
+  80158d:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80158f:	b8 08 00 00 00       	mov    $0x8,%eax
+  801594:	0f 05                	syscall
+  801596:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801599:	85 c0                	test   %eax,%eax
+  80159b:	78 7e                	js     80161b <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  80159d:	0f 84 80 00 00 00    	je     801623 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8015a3:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8015a9:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015b0:	00 00 00 
+  8015b3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015b8:	89 c2                	mov    %eax,%edx
+  8015ba:	be 00 00 00 00       	mov    $0x0,%esi
+  8015bf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8015c4:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  8015cb:	00 00 00 
+  8015ce:	ff d0                	call   *%rax
+  8015d0:	85 c0                	test   %eax,%eax
+  8015d2:	0f 88 86 00 00 00    	js     80165e <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8015d8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8015df:	00 00 00 
+  8015e2:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8015e9:	44 89 e7             	mov    %r12d,%edi
+  8015ec:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  8015f3:	00 00 00 
+  8015f6:	ff d0                	call   *%rax
+  8015f8:	85 c0                	test   %eax,%eax
+  8015fa:	78 6a                	js     801666 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8015fc:	be 02 00 00 00       	mov    $0x2,%esi
+  801601:	44 89 e7             	mov    %r12d,%edi
+  801604:	48 b8 48 12 80 00 00 	movabs $0x801248,%rax
+  80160b:	00 00 00 
+  80160e:	ff d0                	call   *%rax
+		return -1;
+  801610:	85 c0                	test   %eax,%eax
+  801612:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801617:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  80161b:	44 89 e0             	mov    %r12d,%eax
+  80161e:	5b                   	pop    %rbx
+  80161f:	41 5c                	pop    %r12
+  801621:	5d                   	pop    %rbp
+  801622:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801623:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80162a:	00 00 00 
+  80162d:	ff d0                	call   *%rax
+  80162f:	89 c2                	mov    %eax,%edx
+  801631:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801637:	48 89 d0             	mov    %rdx,%rax
+  80163a:	48 c1 e0 04          	shl    $0x4,%rax
+  80163e:	48 29 d0             	sub    %rdx,%rax
+  801641:	48 c1 e0 05          	shl    $0x5,%rax
+  801645:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80164c:	00 00 00 
+  80164f:	48 01 d0             	add    %rdx,%rax
+  801652:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801659:	00 00 00 
+        return 0;
+  80165c:	eb bd                	jmp    80161b <fork+0x9f>
+		return -1;
+  80165e:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801664:	eb b5                	jmp    80161b <fork+0x9f>
+		return -1;
+  801666:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80166c:	eb ad                	jmp    80161b <fork+0x9f>
+
+000000000080166e <sfork>:
+
+envid_t
+sfork() {
+  80166e:	55                   	push   %rbp
+  80166f:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  801672:	48 ba 85 4e 80 00 00 	movabs $0x804e85,%rdx
+  801679:	00 00 00 
+  80167c:	be 2d 00 00 00       	mov    $0x2d,%esi
+  801681:	48 bf a0 4e 80 00 00 	movabs $0x804ea0,%rdi
+  801688:	00 00 00 
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	48 b9 4e 45 80 00 00 	movabs $0x80454e,%rcx
+  801697:	00 00 00 
+  80169a:	ff d1                	call   *%rcx
+
+000000000080169c <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80169c:	55                   	push   %rbp
+  80169d:	48 89 e5             	mov    %rsp,%rbp
+  8016a0:	41 55                	push   %r13
+  8016a2:	41 54                	push   %r12
+  8016a4:	53                   	push   %rbx
+  8016a5:	48 83 ec 08          	sub    $0x8,%rsp
+  8016a9:	49 89 fd             	mov    %rdi,%r13
+  8016ac:	48 89 f7             	mov    %rsi,%rdi
+  8016af:	48 89 d3             	mov    %rdx,%rbx
+  8016b2:	49 89 cc             	mov    %rcx,%r12
+  8016b5:	4c 89 c2             	mov    %r8,%rdx
+  8016b8:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8016bb:	48 85 f6             	test   %rsi,%rsi
+  8016be:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8016c5:	00 00 00 
+  8016c8:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8016cc:	be 00 10 00 00       	mov    $0x1000,%esi
+  8016d1:	48 85 db             	test   %rbx,%rbx
+  8016d4:	74 03                	je     8016d9 <ipc_recv_futex+0x3d>
+  8016d6:	48 8b 33             	mov    (%rbx),%rsi
+  8016d9:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8016dd:	48 b8 93 13 80 00 00 	movabs $0x801393,%rax
+  8016e4:	00 00 00 
+  8016e7:	ff d0                	call   *%rax
+    if (res < 0) {
+  8016e9:	85 c0                	test   %eax,%eax
+  8016eb:	78 75                	js     801762 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8016ed:	4d 85 ed             	test   %r13,%r13
+  8016f0:	74 14                	je     801706 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8016f2:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8016f9:	00 00 00 
+  8016fc:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801702:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801706:	4d 85 e4             	test   %r12,%r12
+  801709:	74 14                	je     80171f <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80170b:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801712:	00 00 00 
+  801715:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80171b:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80171f:	48 85 db             	test   %rbx,%rbx
+  801722:	74 23                	je     801747 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801724:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80172b:	00 00 00 
+  80172e:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801734:	ba 00 00 00 00       	mov    $0x0,%edx
+  801739:	85 c9                	test   %ecx,%ecx
+  80173b:	74 07                	je     801744 <ipc_recv_futex+0xa8>
+  80173d:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801744:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801747:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80174e:	00 00 00 
+  801751:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801757:	48 83 c4 08          	add    $0x8,%rsp
+  80175b:	5b                   	pop    %rbx
+  80175c:	41 5c                	pop    %r12
+  80175e:	41 5d                	pop    %r13
+  801760:	5d                   	pop    %rbp
+  801761:	c3                   	ret
+        if (from_env_store != NULL) {
+  801762:	4d 85 ed             	test   %r13,%r13
+  801765:	74 08                	je     80176f <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801767:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80176e:	00 
+        if (perm_store != NULL) {
+  80176f:	4d 85 e4             	test   %r12,%r12
+  801772:	74 08                	je     80177c <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801774:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80177b:	00 
+        if (size != NULL) {
+  80177c:	48 85 db             	test   %rbx,%rbx
+  80177f:	74 d6                	je     801757 <ipc_recv_futex+0xbb>
+            *size = 0;
+  801781:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801788:	eb cd                	jmp    801757 <ipc_recv_futex+0xbb>
+
+000000000080178a <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80178a:	55                   	push   %rbp
+  80178b:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80178e:	48 83 ec 08          	sub    $0x8,%rsp
+  801792:	6a 00                	push   $0x0
+  801794:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80179a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017a0:	48 b8 9c 16 80 00 00 	movabs $0x80169c,%rax
+  8017a7:	00 00 00 
+  8017aa:	ff d0                	call   *%rax
+}
+  8017ac:	c9                   	leave
+  8017ad:	c3                   	ret
+
+00000000008017ae <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8017ae:	55                   	push   %rbp
+  8017af:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8017b2:	48 85 d2             	test   %rdx,%rdx
+  8017b5:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017bc:	00 00 00 
+  8017bf:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8017c3:	89 f6                	mov    %esi,%esi
+  8017c5:	48 b8 7c 13 80 00 00 	movabs $0x80137c,%rax
+  8017cc:	00 00 00 
+  8017cf:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017d1:	85 c0                	test   %eax,%eax
+  8017d3:	78 02                	js     8017d7 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8017d5:	5d                   	pop    %rbp
+  8017d6:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8017d7:	89 c1                	mov    %eax,%ecx
+  8017d9:	48 ba ab 4e 80 00 00 	movabs $0x804eab,%rdx
+  8017e0:	00 00 00 
+  8017e3:	be 50 00 00 00       	mov    $0x50,%esi
+  8017e8:	48 bf bf 4e 80 00 00 	movabs $0x804ebf,%rdi
+  8017ef:	00 00 00 
+  8017f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8017f7:	49 b8 4e 45 80 00 00 	movabs $0x80454e,%r8
+  8017fe:	00 00 00 
+  801801:	41 ff d0             	call   *%r8
+
+0000000000801804 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801804:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801809:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  801810:	00 00 00 
+  801813:	48 89 d0             	mov    %rdx,%rax
+  801816:	48 c1 e0 04          	shl    $0x4,%rax
+  80181a:	48 29 d0             	sub    %rdx,%rax
+  80181d:	48 c1 e0 05          	shl    $0x5,%rax
+  801821:	48 01 c8             	add    %rcx,%rax
+  801824:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  80182a:	39 f8                	cmp    %edi,%eax
+  80182c:	74 13                	je     801841 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80182e:	48 83 c2 01          	add    $0x1,%rdx
+  801832:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801839:	75 d8                	jne    801813 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  80183b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801840:	c3                   	ret
+            return envs[i].env_id;
+  801841:	48 89 d0             	mov    %rdx,%rax
+  801844:	48 c1 e0 04          	shl    $0x4,%rax
+  801848:	48 29 d0             	sub    %rdx,%rax
+  80184b:	48 c1 e0 05          	shl    $0x5,%rax
+  80184f:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801856:	00 00 00 
+  801859:	48 01 d0             	add    %rdx,%rax
+  80185c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801862:	c3                   	ret
+
+0000000000801863 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801863:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80186a:	ff ff ff 
+  80186d:	48 01 f8             	add    %rdi,%rax
+  801870:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801874:	c3                   	ret
+
+0000000000801875 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801875:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80187c:	ff ff ff 
+  80187f:	48 01 f8             	add    %rdi,%rax
+  801882:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801886:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80188c:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801890:	c3                   	ret
+
+0000000000801891 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801891:	55                   	push   %rbp
+  801892:	48 89 e5             	mov    %rsp,%rbp
+  801895:	41 57                	push   %r15
+  801897:	41 56                	push   %r14
+  801899:	41 55                	push   %r13
+  80189b:	41 54                	push   %r12
+  80189d:	53                   	push   %rbx
+  80189e:	48 83 ec 08          	sub    $0x8,%rsp
+  8018a2:	49 89 ff             	mov    %rdi,%r15
+  8018a5:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018aa:	49 bd 20 40 80 00 00 	movabs $0x804020,%r13
+  8018b1:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8018b4:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8018ba:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8018bd:	48 89 df             	mov    %rbx,%rdi
+  8018c0:	41 ff d5             	call   *%r13
+  8018c3:	83 e0 04             	and    $0x4,%eax
+  8018c6:	74 17                	je     8018df <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8018c8:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8018cf:	4c 39 f3             	cmp    %r14,%rbx
+  8018d2:	75 e6                	jne    8018ba <fd_alloc+0x29>
+  8018d4:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8018da:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8018df:	4d 89 27             	mov    %r12,(%r15)
+}
+  8018e2:	48 83 c4 08          	add    $0x8,%rsp
+  8018e6:	5b                   	pop    %rbx
+  8018e7:	41 5c                	pop    %r12
+  8018e9:	41 5d                	pop    %r13
+  8018eb:	41 5e                	pop    %r14
+  8018ed:	41 5f                	pop    %r15
+  8018ef:	5d                   	pop    %rbp
+  8018f0:	c3                   	ret
+
+00000000008018f1 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8018f1:	83 ff 1f             	cmp    $0x1f,%edi
+  8018f4:	77 39                	ja     80192f <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8018f6:	55                   	push   %rbp
+  8018f7:	48 89 e5             	mov    %rsp,%rbp
+  8018fa:	41 54                	push   %r12
+  8018fc:	53                   	push   %rbx
+  8018fd:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  801900:	48 63 df             	movslq %edi,%rbx
+  801903:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  80190a:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80190e:	48 89 df             	mov    %rbx,%rdi
+  801911:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801918:	00 00 00 
+  80191b:	ff d0                	call   *%rax
+  80191d:	a8 04                	test   $0x4,%al
+  80191f:	74 14                	je     801935 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801921:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801925:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80192a:	5b                   	pop    %rbx
+  80192b:	41 5c                	pop    %r12
+  80192d:	5d                   	pop    %rbp
+  80192e:	c3                   	ret
+        return -E_INVAL;
+  80192f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801934:	c3                   	ret
+        return -E_INVAL;
+  801935:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80193a:	eb ee                	jmp    80192a <fd_lookup+0x39>
+
+000000000080193c <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80193c:	55                   	push   %rbp
+  80193d:	48 89 e5             	mov    %rsp,%rbp
+  801940:	41 54                	push   %r12
+  801942:	53                   	push   %rbx
+  801943:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801946:	48 b8 60 4f 80 00 00 	movabs $0x804f60,%rax
+  80194d:	00 00 00 
+  801950:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801957:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  80195a:	39 3b                	cmp    %edi,(%rbx)
+  80195c:	74 47                	je     8019a5 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  80195e:	48 83 c0 08          	add    $0x8,%rax
+  801962:	48 8b 18             	mov    (%rax),%rbx
+  801965:	48 85 db             	test   %rbx,%rbx
+  801968:	75 f0                	jne    80195a <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  80196a:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801971:	00 00 00 
+  801974:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  80197a:	89 fa                	mov    %edi,%edx
+  80197c:	48 bf d0 4e 80 00 00 	movabs $0x804ed0,%rdi
+  801983:	00 00 00 
+  801986:	b8 00 00 00 00       	mov    $0x0,%eax
+  80198b:	48 b9 c5 02 80 00 00 	movabs $0x8002c5,%rcx
+  801992:	00 00 00 
+  801995:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801997:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80199c:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019a0:	5b                   	pop    %rbx
+  8019a1:	41 5c                	pop    %r12
+  8019a3:	5d                   	pop    %rbp
+  8019a4:	c3                   	ret
+            return 0;
+  8019a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019aa:	eb f0                	jmp    80199c <dev_lookup+0x60>
+
+00000000008019ac <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019ac:	55                   	push   %rbp
+  8019ad:	48 89 e5             	mov    %rsp,%rbp
+  8019b0:	41 55                	push   %r13
+  8019b2:	41 54                	push   %r12
+  8019b4:	53                   	push   %rbx
+  8019b5:	48 83 ec 18          	sub    $0x18,%rsp
+  8019b9:	48 89 fb             	mov    %rdi,%rbx
+  8019bc:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8019bf:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  8019c6:	ff ff ff 
+  8019c9:	48 01 df             	add    %rbx,%rdi
+  8019cc:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  8019d0:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8019d4:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  8019db:	00 00 00 
+  8019de:	ff d0                	call   *%rax
+  8019e0:	41 89 c5             	mov    %eax,%r13d
+  8019e3:	85 c0                	test   %eax,%eax
+  8019e5:	78 06                	js     8019ed <fd_close+0x41>
+  8019e7:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  8019eb:	74 1a                	je     801a07 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  8019ed:	45 84 e4             	test   %r12b,%r12b
+  8019f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f5:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  8019f9:	44 89 e8             	mov    %r13d,%eax
+  8019fc:	48 83 c4 18          	add    $0x18,%rsp
+  801a00:	5b                   	pop    %rbx
+  801a01:	41 5c                	pop    %r12
+  801a03:	41 5d                	pop    %r13
+  801a05:	5d                   	pop    %rbp
+  801a06:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a07:	8b 3b                	mov    (%rbx),%edi
+  801a09:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a0d:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801a14:	00 00 00 
+  801a17:	ff d0                	call   *%rax
+  801a19:	41 89 c5             	mov    %eax,%r13d
+  801a1c:	85 c0                	test   %eax,%eax
+  801a1e:	78 1b                	js     801a3b <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a20:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a24:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a28:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a2e:	48 85 c0             	test   %rax,%rax
+  801a31:	74 08                	je     801a3b <fd_close+0x8f>
+  801a33:	48 89 df             	mov    %rbx,%rdi
+  801a36:	ff d0                	call   *%rax
+  801a38:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a3b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a40:	48 89 de             	mov    %rbx,%rsi
+  801a43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a48:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  801a4f:	00 00 00 
+  801a52:	ff d0                	call   *%rax
+    return res;
+  801a54:	eb a3                	jmp    8019f9 <fd_close+0x4d>
+
+0000000000801a56 <close>:
+
+int
+close(int fdnum) {
+  801a56:	55                   	push   %rbp
+  801a57:	48 89 e5             	mov    %rsp,%rbp
+  801a5a:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801a5e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801a62:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801a69:	00 00 00 
+  801a6c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801a6e:	85 c0                	test   %eax,%eax
+  801a70:	78 15                	js     801a87 <close+0x31>
+
+    return fd_close(fd, 1);
+  801a72:	be 01 00 00 00       	mov    $0x1,%esi
+  801a77:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801a7b:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  801a82:	00 00 00 
+  801a85:	ff d0                	call   *%rax
+}
+  801a87:	c9                   	leave
+  801a88:	c3                   	ret
+
+0000000000801a89 <close_all>:
+
+void
+close_all(void) {
+  801a89:	55                   	push   %rbp
+  801a8a:	48 89 e5             	mov    %rsp,%rbp
+  801a8d:	41 54                	push   %r12
+  801a8f:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801a90:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801a95:	49 bc 56 1a 80 00 00 	movabs $0x801a56,%r12
+  801a9c:	00 00 00 
+  801a9f:	89 df                	mov    %ebx,%edi
+  801aa1:	41 ff d4             	call   *%r12
+  801aa4:	83 c3 01             	add    $0x1,%ebx
+  801aa7:	83 fb 20             	cmp    $0x20,%ebx
+  801aaa:	75 f3                	jne    801a9f <close_all+0x16>
+}
+  801aac:	5b                   	pop    %rbx
+  801aad:	41 5c                	pop    %r12
+  801aaf:	5d                   	pop    %rbp
+  801ab0:	c3                   	ret
+
+0000000000801ab1 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ab1:	55                   	push   %rbp
+  801ab2:	48 89 e5             	mov    %rsp,%rbp
+  801ab5:	41 57                	push   %r15
+  801ab7:	41 56                	push   %r14
+  801ab9:	41 55                	push   %r13
+  801abb:	41 54                	push   %r12
+  801abd:	53                   	push   %rbx
+  801abe:	48 83 ec 18          	sub    $0x18,%rsp
+  801ac2:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801ac5:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801ac9:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+  801ad5:	89 c3                	mov    %eax,%ebx
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	0f 88 b8 00 00 00    	js     801b97 <dup+0xe6>
+    close(newfdnum);
+  801adf:	44 89 e7             	mov    %r12d,%edi
+  801ae2:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  801ae9:	00 00 00 
+  801aec:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801aee:	4d 63 ec             	movslq %r12d,%r13
+  801af1:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801af8:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801afc:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b00:	4c 89 ff             	mov    %r15,%rdi
+  801b03:	49 be 75 18 80 00 00 	movabs $0x801875,%r14
+  801b0a:	00 00 00 
+  801b0d:	41 ff d6             	call   *%r14
+  801b10:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b13:	4c 89 ef             	mov    %r13,%rdi
+  801b16:	41 ff d6             	call   *%r14
+  801b19:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b1c:	48 89 df             	mov    %rbx,%rdi
+  801b1f:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801b26:	00 00 00 
+  801b29:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b2b:	a8 04                	test   $0x4,%al
+  801b2d:	74 2b                	je     801b5a <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b2f:	41 89 c1             	mov    %eax,%r9d
+  801b32:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b38:	4c 89 f1             	mov    %r14,%rcx
+  801b3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b40:	48 89 de             	mov    %rbx,%rsi
+  801b43:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b48:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  801b4f:	00 00 00 
+  801b52:	ff d0                	call   *%rax
+  801b54:	89 c3                	mov    %eax,%ebx
+  801b56:	85 c0                	test   %eax,%eax
+  801b58:	78 4e                	js     801ba8 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801b5a:	4c 89 ff             	mov    %r15,%rdi
+  801b5d:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  801b64:	00 00 00 
+  801b67:	ff d0                	call   *%rax
+  801b69:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801b6c:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b72:	4c 89 e9             	mov    %r13,%rcx
+  801b75:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b7a:	4c 89 fe             	mov    %r15,%rsi
+  801b7d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b82:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  801b89:	00 00 00 
+  801b8c:	ff d0                	call   *%rax
+  801b8e:	89 c3                	mov    %eax,%ebx
+  801b90:	85 c0                	test   %eax,%eax
+  801b92:	78 14                	js     801ba8 <dup+0xf7>
+
+    return newfdnum;
+  801b94:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801b97:	89 d8                	mov    %ebx,%eax
+  801b99:	48 83 c4 18          	add    $0x18,%rsp
+  801b9d:	5b                   	pop    %rbx
+  801b9e:	41 5c                	pop    %r12
+  801ba0:	41 5d                	pop    %r13
+  801ba2:	41 5e                	pop    %r14
+  801ba4:	41 5f                	pop    %r15
+  801ba6:	5d                   	pop    %rbp
+  801ba7:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801ba8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bad:	4c 89 ee             	mov    %r13,%rsi
+  801bb0:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bb5:	49 bc ef 11 80 00 00 	movabs $0x8011ef,%r12
+  801bbc:	00 00 00 
+  801bbf:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801bc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bc7:	4c 89 f6             	mov    %r14,%rsi
+  801bca:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bcf:	41 ff d4             	call   *%r12
+    return res;
+  801bd2:	eb c3                	jmp    801b97 <dup+0xe6>
+
+0000000000801bd4 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801bd4:	55                   	push   %rbp
+  801bd5:	48 89 e5             	mov    %rsp,%rbp
+  801bd8:	41 56                	push   %r14
+  801bda:	41 55                	push   %r13
+  801bdc:	41 54                	push   %r12
+  801bde:	53                   	push   %rbx
+  801bdf:	48 83 ec 10          	sub    $0x10,%rsp
+  801be3:	89 fb                	mov    %edi,%ebx
+  801be5:	49 89 f4             	mov    %rsi,%r12
+  801be8:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801beb:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801bef:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801bf6:	00 00 00 
+  801bf9:	ff d0                	call   *%rax
+  801bfb:	85 c0                	test   %eax,%eax
+  801bfd:	78 4c                	js     801c4b <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bff:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c03:	41 8b 3e             	mov    (%r14),%edi
+  801c06:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c0a:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801c11:	00 00 00 
+  801c14:	ff d0                	call   *%rax
+  801c16:	85 c0                	test   %eax,%eax
+  801c18:	78 35                	js     801c4f <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c1a:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c1e:	83 e0 03             	and    $0x3,%eax
+  801c21:	83 f8 01             	cmp    $0x1,%eax
+  801c24:	74 2d                	je     801c53 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c26:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c2a:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c2e:	48 85 c0             	test   %rax,%rax
+  801c31:	74 56                	je     801c89 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c33:	4c 89 ea             	mov    %r13,%rdx
+  801c36:	4c 89 e6             	mov    %r12,%rsi
+  801c39:	4c 89 f7             	mov    %r14,%rdi
+  801c3c:	ff d0                	call   *%rax
+}
+  801c3e:	48 83 c4 10          	add    $0x10,%rsp
+  801c42:	5b                   	pop    %rbx
+  801c43:	41 5c                	pop    %r12
+  801c45:	41 5d                	pop    %r13
+  801c47:	41 5e                	pop    %r14
+  801c49:	5d                   	pop    %rbp
+  801c4a:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c4b:	48 98                	cltq
+  801c4d:	eb ef                	jmp    801c3e <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4f:	48 98                	cltq
+  801c51:	eb eb                	jmp    801c3e <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801c53:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801c5a:	00 00 00 
+  801c5d:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c63:	89 da                	mov    %ebx,%edx
+  801c65:	48 bf 11 4f 80 00 00 	movabs $0x804f11,%rdi
+  801c6c:	00 00 00 
+  801c6f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c74:	48 b9 c5 02 80 00 00 	movabs $0x8002c5,%rcx
+  801c7b:	00 00 00 
+  801c7e:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c80:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c87:	eb b5                	jmp    801c3e <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c89:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c90:	eb ac                	jmp    801c3e <read+0x6a>
+
+0000000000801c92 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801c92:	55                   	push   %rbp
+  801c93:	48 89 e5             	mov    %rsp,%rbp
+  801c96:	41 57                	push   %r15
+  801c98:	41 56                	push   %r14
+  801c9a:	41 55                	push   %r13
+  801c9c:	41 54                	push   %r12
+  801c9e:	53                   	push   %rbx
+  801c9f:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801ca3:	48 85 d2             	test   %rdx,%rdx
+  801ca6:	74 54                	je     801cfc <readn+0x6a>
+  801ca8:	41 89 fd             	mov    %edi,%r13d
+  801cab:	49 89 f6             	mov    %rsi,%r14
+  801cae:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cb1:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801cb6:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801cbb:	49 bf d4 1b 80 00 00 	movabs $0x801bd4,%r15
+  801cc2:	00 00 00 
+  801cc5:	4c 89 e2             	mov    %r12,%rdx
+  801cc8:	48 29 f2             	sub    %rsi,%rdx
+  801ccb:	4c 01 f6             	add    %r14,%rsi
+  801cce:	44 89 ef             	mov    %r13d,%edi
+  801cd1:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801cd4:	85 c0                	test   %eax,%eax
+  801cd6:	78 20                	js     801cf8 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801cd8:	01 c3                	add    %eax,%ebx
+  801cda:	85 c0                	test   %eax,%eax
+  801cdc:	74 08                	je     801ce6 <readn+0x54>
+  801cde:	48 63 f3             	movslq %ebx,%rsi
+  801ce1:	4c 39 e6             	cmp    %r12,%rsi
+  801ce4:	72 df                	jb     801cc5 <readn+0x33>
+    }
+    return res;
+  801ce6:	48 63 c3             	movslq %ebx,%rax
+}
+  801ce9:	48 83 c4 08          	add    $0x8,%rsp
+  801ced:	5b                   	pop    %rbx
+  801cee:	41 5c                	pop    %r12
+  801cf0:	41 5d                	pop    %r13
+  801cf2:	41 5e                	pop    %r14
+  801cf4:	41 5f                	pop    %r15
+  801cf6:	5d                   	pop    %rbp
+  801cf7:	c3                   	ret
+        if (inc < 0) return inc;
+  801cf8:	48 98                	cltq
+  801cfa:	eb ed                	jmp    801ce9 <readn+0x57>
+    int inc = 1, res = 0;
+  801cfc:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d01:	eb e3                	jmp    801ce6 <readn+0x54>
+
+0000000000801d03 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d03:	55                   	push   %rbp
+  801d04:	48 89 e5             	mov    %rsp,%rbp
+  801d07:	41 56                	push   %r14
+  801d09:	41 55                	push   %r13
+  801d0b:	41 54                	push   %r12
+  801d0d:	53                   	push   %rbx
+  801d0e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d12:	89 fb                	mov    %edi,%ebx
+  801d14:	49 89 f4             	mov    %rsi,%r12
+  801d17:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d1a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d1e:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801d25:	00 00 00 
+  801d28:	ff d0                	call   *%rax
+  801d2a:	85 c0                	test   %eax,%eax
+  801d2c:	78 47                	js     801d75 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d2e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d32:	41 8b 3e             	mov    (%r14),%edi
+  801d35:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d39:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801d40:	00 00 00 
+  801d43:	ff d0                	call   *%rax
+  801d45:	85 c0                	test   %eax,%eax
+  801d47:	78 30                	js     801d79 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d49:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d4e:	74 2d                	je     801d7d <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d50:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d54:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801d58:	48 85 c0             	test   %rax,%rax
+  801d5b:	74 56                	je     801db3 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801d5d:	4c 89 ea             	mov    %r13,%rdx
+  801d60:	4c 89 e6             	mov    %r12,%rsi
+  801d63:	4c 89 f7             	mov    %r14,%rdi
+  801d66:	ff d0                	call   *%rax
+}
+  801d68:	48 83 c4 10          	add    $0x10,%rsp
+  801d6c:	5b                   	pop    %rbx
+  801d6d:	41 5c                	pop    %r12
+  801d6f:	41 5d                	pop    %r13
+  801d71:	41 5e                	pop    %r14
+  801d73:	5d                   	pop    %rbp
+  801d74:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d75:	48 98                	cltq
+  801d77:	eb ef                	jmp    801d68 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d79:	48 98                	cltq
+  801d7b:	eb eb                	jmp    801d68 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d7d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d84:	00 00 00 
+  801d87:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d8d:	89 da                	mov    %ebx,%edx
+  801d8f:	48 bf 2d 4f 80 00 00 	movabs $0x804f2d,%rdi
+  801d96:	00 00 00 
+  801d99:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d9e:	48 b9 c5 02 80 00 00 	movabs $0x8002c5,%rcx
+  801da5:	00 00 00 
+  801da8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801daa:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801db1:	eb b5                	jmp    801d68 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801db3:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801dba:	eb ac                	jmp    801d68 <write+0x65>
+
+0000000000801dbc <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801dbc:	55                   	push   %rbp
+  801dbd:	48 89 e5             	mov    %rsp,%rbp
+  801dc0:	41 54                	push   %r12
+  801dc2:	53                   	push   %rbx
+  801dc3:	48 83 ec 10          	sub    $0x10,%rsp
+  801dc7:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801dcd:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801dd4:	00 00 00 
+  801dd7:	ff d0                	call   *%rax
+  801dd9:	85 c0                	test   %eax,%eax
+  801ddb:	78 3e                	js     801e1b <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ddd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801de1:	41 8b 3c 24          	mov    (%r12),%edi
+  801de5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801de9:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801df0:	00 00 00 
+  801df3:	ff d0                	call   *%rax
+  801df5:	85 c0                	test   %eax,%eax
+  801df7:	78 22                	js     801e1b <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801df9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801dfd:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e01:	48 85 c0             	test   %rax,%rax
+  801e04:	74 0b                	je     801e11 <seek+0x55>
+  801e06:	89 de                	mov    %ebx,%esi
+  801e08:	4c 89 e7             	mov    %r12,%rdi
+  801e0b:	ff d0                	call   *%rax
+  801e0d:	85 c0                	test   %eax,%eax
+  801e0f:	78 0a                	js     801e1b <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e11:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e16:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e1b:	48 83 c4 10          	add    $0x10,%rsp
+  801e1f:	5b                   	pop    %rbx
+  801e20:	41 5c                	pop    %r12
+  801e22:	5d                   	pop    %rbp
+  801e23:	c3                   	ret
+
+0000000000801e24 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e24:	55                   	push   %rbp
+  801e25:	48 89 e5             	mov    %rsp,%rbp
+  801e28:	41 55                	push   %r13
+  801e2a:	41 54                	push   %r12
+  801e2c:	53                   	push   %rbx
+  801e2d:	48 83 ec 18          	sub    $0x18,%rsp
+  801e31:	89 fb                	mov    %edi,%ebx
+  801e33:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e36:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e3a:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801e41:	00 00 00 
+  801e44:	ff d0                	call   *%rax
+  801e46:	85 c0                	test   %eax,%eax
+  801e48:	78 38                	js     801e82 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e4a:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e4e:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801e52:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e56:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801e5d:	00 00 00 
+  801e60:	ff d0                	call   *%rax
+  801e62:	85 c0                	test   %eax,%eax
+  801e64:	78 1c                	js     801e82 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e66:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801e6b:	74 20                	je     801e8d <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801e6d:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e71:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801e75:	48 85 c0             	test   %rax,%rax
+  801e78:	74 47                	je     801ec1 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801e7a:	44 89 e6             	mov    %r12d,%esi
+  801e7d:	4c 89 ef             	mov    %r13,%rdi
+  801e80:	ff d0                	call   *%rax
+}
+  801e82:	48 83 c4 18          	add    $0x18,%rsp
+  801e86:	5b                   	pop    %rbx
+  801e87:	41 5c                	pop    %r12
+  801e89:	41 5d                	pop    %r13
+  801e8b:	5d                   	pop    %rbp
+  801e8c:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801e8d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e94:	00 00 00 
+  801e97:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801e9d:	89 da                	mov    %ebx,%edx
+  801e9f:	48 bf f0 4e 80 00 00 	movabs $0x804ef0,%rdi
+  801ea6:	00 00 00 
+  801ea9:	b8 00 00 00 00       	mov    $0x0,%eax
+  801eae:	48 b9 c5 02 80 00 00 	movabs $0x8002c5,%rcx
+  801eb5:	00 00 00 
+  801eb8:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801eba:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801ebf:	eb c1                	jmp    801e82 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ec1:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801ec6:	eb ba                	jmp    801e82 <ftruncate+0x5e>
+
+0000000000801ec8 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801ec8:	55                   	push   %rbp
+  801ec9:	48 89 e5             	mov    %rsp,%rbp
+  801ecc:	41 54                	push   %r12
+  801ece:	53                   	push   %rbx
+  801ecf:	48 83 ec 10          	sub    $0x10,%rsp
+  801ed3:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ed6:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eda:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  801ee1:	00 00 00 
+  801ee4:	ff d0                	call   *%rax
+  801ee6:	85 c0                	test   %eax,%eax
+  801ee8:	78 4e                	js     801f38 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801eea:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801eee:	41 8b 3c 24          	mov    (%r12),%edi
+  801ef2:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ef6:	48 b8 3c 19 80 00 00 	movabs $0x80193c,%rax
+  801efd:	00 00 00 
+  801f00:	ff d0                	call   *%rax
+  801f02:	85 c0                	test   %eax,%eax
+  801f04:	78 32                	js     801f38 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f06:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f0a:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f0f:	74 30                	je     801f41 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f11:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f14:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f1b:	00 00 00 
+    stat->st_isdir = 0;
+  801f1e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f25:	00 00 00 
+    stat->st_dev = dev;
+  801f28:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f2f:	48 89 de             	mov    %rbx,%rsi
+  801f32:	4c 89 e7             	mov    %r12,%rdi
+  801f35:	ff 50 28             	call   *0x28(%rax)
+}
+  801f38:	48 83 c4 10          	add    $0x10,%rsp
+  801f3c:	5b                   	pop    %rbx
+  801f3d:	41 5c                	pop    %r12
+  801f3f:	5d                   	pop    %rbp
+  801f40:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f41:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f46:	eb f0                	jmp    801f38 <fstat+0x70>
+
+0000000000801f48 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f48:	55                   	push   %rbp
+  801f49:	48 89 e5             	mov    %rsp,%rbp
+  801f4c:	41 54                	push   %r12
+  801f4e:	53                   	push   %rbx
+  801f4f:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801f52:	be 00 00 00 00       	mov    $0x0,%esi
+  801f57:	48 b8 b6 30 80 00 00 	movabs $0x8030b6,%rax
+  801f5e:	00 00 00 
+  801f61:	ff d0                	call   *%rax
+  801f63:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801f65:	85 c0                	test   %eax,%eax
+  801f67:	78 25                	js     801f8e <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801f69:	4c 89 e6             	mov    %r12,%rsi
+  801f6c:	89 c7                	mov    %eax,%edi
+  801f6e:	48 b8 c8 1e 80 00 00 	movabs $0x801ec8,%rax
+  801f75:	00 00 00 
+  801f78:	ff d0                	call   *%rax
+  801f7a:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801f7d:	89 df                	mov    %ebx,%edi
+  801f7f:	48 b8 56 1a 80 00 00 	movabs $0x801a56,%rax
+  801f86:	00 00 00 
+  801f89:	ff d0                	call   *%rax
+
+    return res;
+  801f8b:	44 89 e3             	mov    %r12d,%ebx
+}
+  801f8e:	89 d8                	mov    %ebx,%eax
+  801f90:	5b                   	pop    %rbx
+  801f91:	41 5c                	pop    %r12
+  801f93:	5d                   	pop    %rbp
+  801f94:	c3                   	ret
+
+0000000000801f95 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801f95:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801f9c:	00 00 00 
+  801f9f:	83 38 00             	cmpl   $0x0,(%rax)
+  801fa2:	74 0a                	je     801fae <fsenv+0x19>
+    return envid;
+}
+  801fa4:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fab:	00 00 
+  801fad:	c3                   	ret
+fsenv(void) {
+  801fae:	55                   	push   %rbp
+  801faf:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fb2:	bf 03 00 00 00       	mov    $0x3,%edi
+  801fb7:	48 b8 04 18 80 00 00 	movabs $0x801804,%rax
+  801fbe:	00 00 00 
+  801fc1:	ff d0                	call   *%rax
+  801fc3:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801fca:	00 00 
+}
+  801fcc:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801fd3:	00 00 
+  801fd5:	5d                   	pop    %rbp
+  801fd6:	c3                   	ret
+
+0000000000801fd7 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801fd7:	55                   	push   %rbp
+  801fd8:	48 89 e5             	mov    %rsp,%rbp
+  801fdb:	41 54                	push   %r12
+  801fdd:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801fde:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801fe3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801fe8:	48 89 de             	mov    %rbx,%rsi
+  801feb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ff0:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  801ff7:	00 00 00 
+  801ffa:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801ffc:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802003:	00 00 00 
+  802006:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80200c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802011:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802016:	48 89 de             	mov    %rbx,%rsi
+  802019:	bf 00 00 00 00       	mov    $0x0,%edi
+  80201e:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  802025:	00 00 00 
+  802028:	ff d0                	call   *%rax
+  80202a:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80202c:	85 c0                	test   %eax,%eax
+  80202e:	0f 88 a2 00 00 00    	js     8020d6 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802034:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80203b:	00 00 00 
+  80203e:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802044:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802049:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80204b:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802050:	49 bc e8 41 80 00 00 	movabs $0x8041e8,%r12
+  802057:	00 00 00 
+  80205a:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  80205d:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802062:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802065:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  80206c:	00 00 00 
+  80206f:	ff d0                	call   *%rax
+  802071:	89 c7                	mov    %eax,%edi
+  802073:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802079:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80207e:	48 89 da             	mov    %rbx,%rdx
+  802081:	be 09 00 00 00       	mov    $0x9,%esi
+  802086:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  80208d:	00 00 00 
+  802090:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802092:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802097:	ba 00 00 00 00       	mov    $0x0,%edx
+  80209c:	be 00 00 00 00       	mov    $0x0,%esi
+  8020a1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020a6:	48 b8 8a 17 80 00 00 	movabs $0x80178a,%rax
+  8020ad:	00 00 00 
+  8020b0:	ff d0                	call   *%rax
+  8020b2:	89 c3                	mov    %eax,%ebx
+  8020b4:	85 c0                	test   %eax,%eax
+  8020b6:	78 25                	js     8020dd <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8020b8:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8020bf:	00 00 00 
+  8020c2:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8020c8:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8020cf:	00 00 
+    return 0;
+  8020d1:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8020d6:	89 d8                	mov    %ebx,%eax
+  8020d8:	5b                   	pop    %rbx
+  8020d9:	41 5c                	pop    %r12
+  8020db:	5d                   	pop    %rbp
+  8020dc:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020dd:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020e2:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8020e7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020ec:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  8020f3:	00 00 00 
+  8020f6:	ff d0                	call   *%rax
+        return res;
+  8020f8:	eb dc                	jmp    8020d6 <fschan_setup+0xff>
+
+00000000008020fa <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8020fa:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802101:	00 00 00 
+  802104:	80 38 00             	cmpb   $0x0,(%rax)
+  802107:	74 55                	je     80215e <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802109:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802110:	00 00 00 
+  802113:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802119:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80211e:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802125:	00 00 00 
+  802128:	3b 0a                	cmp    (%rdx),%ecx
+  80212a:	75 01                	jne    80212d <fschan+0x33>
+}
+  80212c:	c3                   	ret
+fschan(void) {
+  80212d:	55                   	push   %rbp
+  80212e:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802131:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  802138:	00 00 00 
+  80213b:	ff d0                	call   *%rax
+  80213d:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80213f:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802144:	85 d2                	test   %edx,%edx
+  802146:	78 02                	js     80214a <fschan+0x50>
+}
+  802148:	5d                   	pop    %rbp
+  802149:	c3                   	ret
+        fschan_enabled = 0;
+  80214a:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802151:	00 00 00 
+  802154:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802157:	b8 00 00 00 00       	mov    $0x0,%eax
+  80215c:	eb ea                	jmp    802148 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80215e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802163:	c3                   	ret
+
+0000000000802164 <fbuf>:
+fbuf(struct Fd *fd) {
+  802164:	55                   	push   %rbp
+  802165:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802168:	48 b8 63 18 80 00 00 	movabs $0x801863,%rax
+  80216f:	00 00 00 
+  802172:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802174:	ba 00 00 00 00       	mov    $0x0,%edx
+  802179:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80217d:	77 12                	ja     802191 <fbuf+0x2d>
+  80217f:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802183:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80218a:	00 00 00 
+  80218d:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802191:	48 89 d0             	mov    %rdx,%rax
+  802194:	5d                   	pop    %rbp
+  802195:	c3                   	ret
+
+0000000000802196 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802196:	55                   	push   %rbp
+  802197:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80219a:	48 83 c7 40          	add    $0x40,%rdi
+  80219e:	48 b8 22 42 80 00 00 	movabs $0x804222,%rax
+  8021a5:	00 00 00 
+  8021a8:	ff d0                	call   *%rax
+  8021aa:	84 c0                	test   %al,%al
+  8021ac:	75 02                	jne    8021b0 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8021ae:	5d                   	pop    %rbp
+  8021af:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8021b0:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  8021b7:	00 00 00 
+  8021ba:	ff d0                	call   *%rax
+  8021bc:	89 c7                	mov    %eax,%edi
+  8021be:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021c4:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8021c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021ce:	be 0a 00 00 00       	mov    $0xa,%esi
+  8021d3:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8021da:	00 00 00 
+  8021dd:	ff d0                	call   *%rax
+}
+  8021df:	eb cd                	jmp    8021ae <fschan_publish+0x18>
+
+00000000008021e1 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8021e1:	55                   	push   %rbp
+  8021e2:	48 89 e5             	mov    %rsp,%rbp
+  8021e5:	41 57                	push   %r15
+  8021e7:	41 56                	push   %r14
+  8021e9:	41 55                	push   %r13
+  8021eb:	41 54                	push   %r12
+  8021ed:	53                   	push   %rbx
+  8021ee:	48 83 ec 48          	sub    $0x48,%rsp
+  8021f2:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8021f6:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8021fa:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8021fd:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802201:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802204:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80220b:	00 00 00 
+  80220e:	8b 02                	mov    (%rdx),%eax
+  802210:	83 c0 01             	add    $0x1,%eax
+  802213:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802218:	0f 44 c1             	cmove  %ecx,%eax
+  80221b:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80221d:	4d 85 c0             	test   %r8,%r8
+  802220:	74 2c                	je     80224e <fschan_rw+0x6d>
+  802222:	45 89 ce             	mov    %r9d,%r14d
+  802225:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80222c:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802230:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802236:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80223d:	00 
+  80223e:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802244:	b8 01 00 00 00       	mov    $0x1,%eax
+  802249:	e9 41 01 00 00       	jmp    80238f <fschan_rw+0x1ae>
+  80224e:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802252:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802256:	e9 9c 01 00 00       	jmp    8023f7 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80225b:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80225f:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802262:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802265:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802268:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80226c:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802270:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802274:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802278:	48 89 da             	mov    %rbx,%rdx
+  80227b:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  802282:	00 00 00 
+  802285:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802287:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80228b:	48 b8 96 21 80 00 00 	movabs $0x802196,%rax
+  802292:	00 00 00 
+  802295:	ff d0                	call   *%rax
+            queued += blk;
+  802297:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80229a:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80229e:	4d 39 fc             	cmp    %r15,%r12
+  8022a1:	73 6b                	jae    80230e <fschan_rw+0x12d>
+  8022a3:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022a7:	77 65                	ja     80230e <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8022a9:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022ad:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8022b1:	48 b8 fd 41 80 00 00 	movabs $0x8041fd,%rax
+  8022b8:	00 00 00 
+  8022bb:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8022bd:	4c 89 fb             	mov    %r15,%rbx
+  8022c0:	4c 29 e3             	sub    %r12,%rbx
+  8022c3:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8022c8:	48 39 d3             	cmp    %rdx,%rbx
+  8022cb:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8022cf:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8022d3:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8022d7:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8022db:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8022de:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8022e0:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8022e7:	00 00 00 
+  8022ea:	8b 09                	mov    (%rcx),%ecx
+  8022ec:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8022ef:	83 fe 03             	cmp    $0x3,%esi
+  8022f2:	0f 85 63 ff ff ff    	jne    80225b <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8022f8:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8022fc:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8022ff:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802302:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802305:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802309:	e9 79 ff ff ff       	jmp    802287 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80230e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802312:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802319:	48 89 df             	mov    %rbx,%rdi
+  80231c:	48 b8 c0 42 80 00 00 	movabs $0x8042c0,%rax
+  802323:	00 00 00 
+  802326:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802328:	48 89 df             	mov    %rbx,%rdi
+  80232b:	48 b8 4e 42 80 00 00 	movabs $0x80424e,%rax
+  802332:	00 00 00 
+  802335:	ff d0                	call   *%rax
+  802337:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80233b:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80233f:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802343:	75 25                	jne    80236a <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802345:	8b 40 04             	mov    0x4(%rax),%eax
+  802348:	85 c0                	test   %eax,%eax
+  80234a:	0f 88 86 00 00 00    	js     8023d6 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802350:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802354:	74 5b                	je     8023b1 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802356:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80235a:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80235e:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802362:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802366:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80236a:	48 89 df             	mov    %rbx,%rdi
+  80236d:	48 b8 75 42 80 00 00 	movabs $0x804275,%rax
+  802374:	00 00 00 
+  802377:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802379:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  80237d:	83 f0 01             	xor    $0x1,%eax
+  802380:	4d 39 fc             	cmp    %r15,%r12
+  802383:	0f 92 c2             	setb   %dl
+  802386:	84 c2                	test   %al,%dl
+  802388:	75 05                	jne    80238f <fschan_rw+0x1ae>
+  80238a:	45 85 ed             	test   %r13d,%r13d
+  80238d:	74 50                	je     8023df <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80238f:	4d 39 fc             	cmp    %r15,%r12
+  802392:	0f 92 c1             	setb   %cl
+  802395:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802399:	0f 96 c2             	setbe  %dl
+  80239c:	84 d1                	test   %dl,%cl
+  80239e:	0f 84 6a ff ff ff    	je     80230e <fschan_rw+0x12d>
+  8023a4:	84 c0                	test   %al,%al
+  8023a6:	0f 85 fd fe ff ff    	jne    8022a9 <fschan_rw+0xc8>
+  8023ac:	e9 5d ff ff ff       	jmp    80230e <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023b1:	48 63 d0             	movslq %eax,%rdx
+  8023b4:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8023b8:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8023bc:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8023c0:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8023c4:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8023c8:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  8023cf:	00 00 00 
+  8023d2:	ff d0                	call   *%rax
+  8023d4:	eb 80                	jmp    802356 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8023d6:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8023d9:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8023dd:	eb 8b                	jmp    80236a <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8023df:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8023e4:	0f 85 68 fe ff ff    	jne    802252 <fschan_rw+0x71>
+  8023ea:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8023ed:	85 c0                	test   %eax,%eax
+  8023ef:	0f 84 5d fe ff ff    	je     802252 <fschan_rw+0x71>
+  8023f5:	48 98                	cltq
+}
+  8023f7:	48 83 c4 48          	add    $0x48,%rsp
+  8023fb:	5b                   	pop    %rbx
+  8023fc:	41 5c                	pop    %r12
+  8023fe:	41 5d                	pop    %r13
+  802400:	41 5e                	pop    %r14
+  802402:	41 5f                	pop    %r15
+  802404:	5d                   	pop    %rbp
+  802405:	c3                   	ret
+
+0000000000802406 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802406:	55                   	push   %rbp
+  802407:	48 89 e5             	mov    %rsp,%rbp
+  80240a:	41 56                	push   %r14
+  80240c:	41 55                	push   %r13
+  80240e:	41 54                	push   %r12
+  802410:	53                   	push   %rbx
+  802411:	48 83 ec 10          	sub    $0x10,%rsp
+  802415:	49 89 fe             	mov    %rdi,%r14
+  802418:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80241b:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80241f:	48 29 f3             	sub    %rsi,%rbx
+  802422:	48 39 d3             	cmp    %rdx,%rbx
+  802425:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802429:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802430:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802431:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802436:	49 bd 7f 40 80 00 00 	movabs $0x80407f,%r13
+  80243d:	00 00 00 
+  802440:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802447:	76 1e                	jbe    802467 <mmap_fault+0x61>
+  802449:	4c 01 e7             	add    %r12,%rdi
+  80244c:	41 ff d5             	call   *%r13
+  80244f:	84 c0                	test   %al,%al
+  802451:	75 14                	jne    802467 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802453:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802457:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80245e:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802462:	48 39 df             	cmp    %rbx,%rdi
+  802465:	72 e2                	jb     802449 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802467:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80246e:	00 00 00 
+  802471:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802478:	00 00 00 
+  80247b:	4c 89 f0             	mov    %r14,%rax
+  80247e:	48 29 d0             	sub    %rdx,%rax
+  802481:	48 c1 f8 03          	sar    $0x3,%rax
+  802485:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80248c:	aa aa aa 
+  80248f:	48 0f af c2          	imul   %rdx,%rax
+  802493:	48 c1 e0 0c          	shl    $0xc,%rax
+  802497:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80249c:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8024a0:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8024a2:	44 89 e0             	mov    %r12d,%eax
+  8024a5:	41 03 46 10          	add    0x10(%r14),%eax
+  8024a9:	41 2b 06             	sub    (%r14),%eax
+  8024ac:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8024af:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024b3:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8024b7:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8024bb:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8024be:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  8024c5:	00 00 00 
+  8024c8:	ff d0                	call   *%rax
+  8024ca:	89 c7                	mov    %eax,%edi
+  8024cc:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8024d2:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8024d7:	48 89 da             	mov    %rbx,%rdx
+  8024da:	be 0f 00 00 00       	mov    $0xf,%esi
+  8024df:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8024e6:	00 00 00 
+  8024e9:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8024eb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8024f0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8024f4:	4c 89 e6             	mov    %r12,%rsi
+  8024f7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8024fc:	48 b8 8a 17 80 00 00 	movabs $0x80178a,%rax
+  802503:	00 00 00 
+  802506:	ff d0                	call   *%rax
+  802508:	48 98                	cltq
+}
+  80250a:	48 83 c4 10          	add    $0x10,%rsp
+  80250e:	5b                   	pop    %rbx
+  80250f:	41 5c                	pop    %r12
+  802511:	41 5d                	pop    %r13
+  802513:	41 5e                	pop    %r14
+  802515:	5d                   	pop    %rbp
+  802516:	c3                   	ret
+
+0000000000802517 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802517:	48 8b 37             	mov    (%rdi),%rsi
+  80251a:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802521:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802528:	00 00 00 
+  80252b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802530:	eb 0f                	jmp    802541 <mmap_pgfault+0x2a>
+  802532:	c3                   	ret
+  802533:	48 83 c1 01          	add    $0x1,%rcx
+  802537:	48 83 c2 18          	add    $0x18,%rdx
+  80253b:	48 83 f9 20          	cmp    $0x20,%rcx
+  80253f:	74 6e                	je     8025af <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802541:	48 8b 02             	mov    (%rdx),%rax
+  802544:	48 83 e8 01          	sub    $0x1,%rax
+  802548:	48 39 f0             	cmp    %rsi,%rax
+  80254b:	73 e6                	jae    802533 <mmap_pgfault+0x1c>
+  80254d:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802551:	73 e0                	jae    802533 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802553:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802557:	b8 00 00 00 00       	mov    $0x0,%eax
+  80255c:	f6 c2 01             	test   $0x1,%dl
+  80255f:	75 d1                	jne    802532 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802561:	f6 c2 02             	test   $0x2,%dl
+  802564:	74 1a                	je     802580 <mmap_pgfault+0x69>
+  802566:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80256a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80256f:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802576:	00 00 00 
+  802579:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80257e:	74 35                	je     8025b5 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802580:	55                   	push   %rbp
+  802581:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802584:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802588:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80258f:	00 00 00 
+  802592:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802596:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80259b:	48 b8 06 24 80 00 00 	movabs $0x802406,%rax
+  8025a2:	00 00 00 
+  8025a5:	ff d0                	call   *%rax
+  8025a7:	48 85 c0             	test   %rax,%rax
+  8025aa:	0f 9f c0             	setg   %al
+}
+  8025ad:	5d                   	pop    %rbp
+  8025ae:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025b4:	c3                   	ret
+}
+  8025b5:	c3                   	ret
+
+00000000008025b6 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8025b6:	55                   	push   %rbp
+  8025b7:	48 89 e5             	mov    %rsp,%rbp
+  8025ba:	41 54                	push   %r12
+  8025bc:	53                   	push   %rbx
+  8025bd:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025c0:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025c7:	00 00 00 
+  8025ca:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8025cf:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8025d3:	74 15                	je     8025ea <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8025d5:	48 83 c3 01          	add    $0x1,%rbx
+  8025d9:	48 83 c0 18          	add    $0x18,%rax
+  8025dd:	48 83 fb 20          	cmp    $0x20,%rbx
+  8025e1:	75 ec                	jne    8025cf <mmap_alloc+0x19>
+    return NULL;
+  8025e3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025e8:	eb 52                	jmp    80263c <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8025ea:	4c 89 e7             	mov    %r12,%rdi
+  8025ed:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  8025f4:	00 00 00 
+  8025f7:	ff d0                	call   *%rax
+  8025f9:	41 89 c1             	mov    %eax,%r9d
+  8025fc:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802603:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802607:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80260d:	ba 00 00 00 00       	mov    $0x0,%edx
+  802612:	4c 89 e6             	mov    %r12,%rsi
+  802615:	bf 00 00 00 00       	mov    $0x0,%edi
+  80261a:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  802621:	00 00 00 
+  802624:	ff d0                	call   *%rax
+  802626:	85 c0                	test   %eax,%eax
+  802628:	78 17                	js     802641 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80262a:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80262e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802635:	00 00 00 
+  802638:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80263c:	5b                   	pop    %rbx
+  80263d:	41 5c                	pop    %r12
+  80263f:	5d                   	pop    %rbp
+  802640:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802641:	b8 00 00 00 00       	mov    $0x0,%eax
+  802646:	eb f4                	jmp    80263c <mmap_alloc+0x86>
+
+0000000000802648 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802648:	55                   	push   %rbp
+  802649:	48 89 e5             	mov    %rsp,%rbp
+  80264c:	41 56                	push   %r14
+  80264e:	41 55                	push   %r13
+  802650:	41 54                	push   %r12
+  802652:	53                   	push   %rbx
+  802653:	48 83 ec 10          	sub    $0x10,%rsp
+  802657:	41 89 fc             	mov    %edi,%r12d
+  80265a:	49 89 f5             	mov    %rsi,%r13
+  80265d:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802660:	48 89 f0             	mov    %rsi,%rax
+  802663:	48 09 d0             	or     %rdx,%rax
+  802666:	75 0d                	jne    802675 <fsipc+0x2d>
+  802668:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80266b:	83 f8 04             	cmp    $0x4,%eax
+  80266e:	76 7d                	jbe    8026ed <fsipc+0xa5>
+  802670:	83 ff 0d             	cmp    $0xd,%edi
+  802673:	74 78                	je     8026ed <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802675:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  80267c:	00 00 00 
+  80267f:	ff d0                	call   *%rax
+  802681:	89 c7                	mov    %eax,%edi
+  802683:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80268a:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802691:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802698:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80269e:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8026a5:	00 00 00 
+  8026a8:	44 89 e6             	mov    %r12d,%esi
+  8026ab:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  8026b2:	00 00 00 
+  8026b5:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8026b7:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8026be:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8026bf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8026c4:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8026c8:	4c 89 ee             	mov    %r13,%rsi
+  8026cb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8026d0:	48 b8 8a 17 80 00 00 	movabs $0x80178a,%rax
+  8026d7:	00 00 00 
+  8026da:	ff d0                	call   *%rax
+  8026dc:	89 c3                	mov    %eax,%ebx
+}
+  8026de:	89 d8                	mov    %ebx,%eax
+  8026e0:	48 83 c4 10          	add    $0x10,%rsp
+  8026e4:	5b                   	pop    %rbx
+  8026e5:	41 5c                	pop    %r12
+  8026e7:	41 5d                	pop    %r13
+  8026e9:	41 5e                	pop    %r14
+  8026eb:	5d                   	pop    %rbp
+  8026ec:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026ed:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  8026f4:	00 00 00 
+  8026f7:	ff d0                	call   *%rax
+  8026f9:	49 89 c6             	mov    %rax,%r14
+  8026fc:	48 85 c0             	test   %rax,%rax
+  8026ff:	0f 84 70 ff ff ff    	je     802675 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802705:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802709:	48 b8 fd 41 80 00 00 	movabs $0x8041fd,%rax
+  802710:	00 00 00 
+  802713:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802715:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802718:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80271f:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802723:	ba 10 00 00 00       	mov    $0x10,%edx
+  802728:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80272f:	00 00 00 
+  802732:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  802739:	00 00 00 
+  80273c:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80273e:	4c 89 f7             	mov    %r14,%rdi
+  802741:	48 b8 96 21 80 00 00 	movabs $0x802196,%rax
+  802748:	00 00 00 
+  80274b:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80274d:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802754:	4c 89 f7             	mov    %r14,%rdi
+  802757:	48 b8 c0 42 80 00 00 	movabs $0x8042c0,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802763:	4c 89 f7             	mov    %r14,%rdi
+  802766:	48 b8 4e 42 80 00 00 	movabs $0x80424e,%rax
+  80276d:	00 00 00 
+  802770:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802772:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802775:	41 83 fc 05          	cmp    $0x5,%r12d
+  802779:	75 04                	jne    80277f <fsipc+0x137>
+  80277b:	85 db                	test   %ebx,%ebx
+  80277d:	79 14                	jns    802793 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80277f:	4c 89 f7             	mov    %r14,%rdi
+  802782:	48 b8 75 42 80 00 00 	movabs $0x804275,%rax
+  802789:	00 00 00 
+  80278c:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80278e:	e9 4b ff ff ff       	jmp    8026de <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802793:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802797:	ba 88 00 00 00       	mov    $0x88,%edx
+  80279c:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8027a3:	00 00 00 
+  8027a6:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  8027ad:	00 00 00 
+  8027b0:	ff d0                	call   *%rax
+  8027b2:	eb cb                	jmp    80277f <fsipc+0x137>
+
+00000000008027b4 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8027b4:	55                   	push   %rbp
+  8027b5:	48 89 e5             	mov    %rsp,%rbp
+  8027b8:	41 57                	push   %r15
+  8027ba:	41 56                	push   %r14
+  8027bc:	41 55                	push   %r13
+  8027be:	41 54                	push   %r12
+  8027c0:	53                   	push   %rbx
+  8027c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8027c5:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8027c9:	49 89 f6             	mov    %rsi,%r14
+  8027cc:	49 89 d4             	mov    %rdx,%r12
+  8027cf:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8027d2:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  8027d9:	00 00 00 
+  8027dc:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8027de:	48 85 c0             	test   %rax,%rax
+  8027e1:	0f 85 96 00 00 00    	jne    80287d <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8027e7:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8027ee:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8027ef:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8027f6:	00 00 00 
+    while (n) {
+  8027f9:	4d 85 e4             	test   %r12,%r12
+  8027fc:	74 79                	je     802877 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8027fe:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802803:	49 39 dc             	cmp    %rbx,%r12
+  802806:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  80280a:	48 89 da             	mov    %rbx,%rdx
+  80280d:	4c 89 f6             	mov    %r14,%rsi
+  802810:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802817:	00 00 00 
+  80281a:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  802821:	00 00 00 
+  802824:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802826:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80282a:	8b 40 0c             	mov    0xc(%rax),%eax
+  80282d:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802830:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802833:	44 01 e8             	add    %r13d,%eax
+  802836:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80283a:	41 0f 44 c5          	cmove  %r13d,%eax
+  80283e:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802842:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802846:	48 89 da             	mov    %rbx,%rdx
+  802849:	be 00 00 00 00       	mov    $0x0,%esi
+  80284e:	bf 04 00 00 00       	mov    $0x4,%edi
+  802853:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  80285a:	00 00 00 
+  80285d:	ff d0                	call   *%rax
+        if (res < 0)
+  80285f:	85 c0                	test   %eax,%eax
+  802861:	78 4a                	js     8028ad <devfile_write_direct+0xf9>
+        buf += res;
+  802863:	48 98                	cltq
+  802865:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802868:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80286c:	49 29 c4             	sub    %rax,%r12
+  80286f:	75 8d                	jne    8027fe <devfile_write_direct+0x4a>
+    return write;
+  802871:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802875:	eb 27                	jmp    80289e <devfile_write_direct+0xea>
+    size_t write = 0;
+  802877:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80287b:	eb f4                	jmp    802871 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80287d:	45 89 e9             	mov    %r13d,%r9d
+  802880:	4d 89 e0             	mov    %r12,%r8
+  802883:	4c 89 f1             	mov    %r14,%rcx
+  802886:	ba 04 00 00 00       	mov    $0x4,%edx
+  80288b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80288f:	48 89 c7             	mov    %rax,%rdi
+  802892:	48 b8 e1 21 80 00 00 	movabs $0x8021e1,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+}
+  80289e:	48 83 c4 18          	add    $0x18,%rsp
+  8028a2:	5b                   	pop    %rbx
+  8028a3:	41 5c                	pop    %r12
+  8028a5:	41 5d                	pop    %r13
+  8028a7:	41 5e                	pop    %r14
+  8028a9:	41 5f                	pop    %r15
+  8028ab:	5d                   	pop    %rbp
+  8028ac:	c3                   	ret
+            return res;
+  8028ad:	48 98                	cltq
+  8028af:	eb ed                	jmp    80289e <devfile_write_direct+0xea>
+
+00000000008028b1 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8028b1:	55                   	push   %rbp
+  8028b2:	48 89 e5             	mov    %rsp,%rbp
+  8028b5:	41 54                	push   %r12
+  8028b7:	53                   	push   %rbx
+  8028b8:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8028bb:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  8028c2:	00 00 00 
+  8028c5:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8028c7:	48 85 c0             	test   %rax,%rax
+  8028ca:	74 71                	je     80293d <fbuf_flush+0x8c>
+  8028cc:	48 89 c3             	mov    %rax,%rbx
+  8028cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8028d4:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8028d8:	75 05                	jne    8028df <fbuf_flush+0x2e>
+}
+  8028da:	5b                   	pop    %rbx
+  8028db:	41 5c                	pop    %r12
+  8028dd:	5d                   	pop    %rbp
+  8028de:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8028df:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8028e2:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8028e6:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8028ed:	00 00 00 
+  8028f0:	48 89 de             	mov    %rbx,%rsi
+  8028f3:	48 29 c6             	sub    %rax,%rsi
+  8028f6:	48 c1 fe 03          	sar    $0x3,%rsi
+  8028fa:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802901:	aa aa aa 
+  802904:	48 0f af f0          	imul   %rax,%rsi
+  802908:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80290c:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802911:	48 01 c6             	add    %rax,%rsi
+  802914:	4c 89 e7             	mov    %r12,%rdi
+  802917:	48 b8 b4 27 80 00 00 	movabs $0x8027b4,%rax
+  80291e:	00 00 00 
+  802921:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802923:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802927:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80292e:	00 
+    return res < 0 ? res : 0;
+  80292f:	48 85 c0             	test   %rax,%rax
+  802932:	ba 00 00 00 00       	mov    $0x0,%edx
+  802937:	48 0f 4f c2          	cmovg  %rdx,%rax
+  80293b:	eb 9d                	jmp    8028da <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80293d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802942:	eb 96                	jmp    8028da <fbuf_flush+0x29>
+
+0000000000802944 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802944:	55                   	push   %rbp
+  802945:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802948:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  80294f:	00 00 00 
+  802952:	ff d0                	call   *%rax
+}
+  802954:	5d                   	pop    %rbp
+  802955:	c3                   	ret
+
+0000000000802956 <devfile_write>:
+    if (!fd || !buf)
+  802956:	48 85 ff             	test   %rdi,%rdi
+  802959:	0f 84 d3 01 00 00    	je     802b32 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80295f:	55                   	push   %rbp
+  802960:	48 89 e5             	mov    %rsp,%rbp
+  802963:	41 57                	push   %r15
+  802965:	41 56                	push   %r14
+  802967:	41 55                	push   %r13
+  802969:	41 54                	push   %r12
+  80296b:	53                   	push   %rbx
+  80296c:	48 83 ec 08          	sub    $0x8,%rsp
+  802970:	49 89 fc             	mov    %rdi,%r12
+  802973:	49 89 f6             	mov    %rsi,%r14
+  802976:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802979:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  80297e:	48 85 f6             	test   %rsi,%rsi
+  802981:	0f 84 9c 01 00 00    	je     802b23 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802987:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  80298e:	00 00 00 
+  802991:	ff d0                	call   *%rax
+  802993:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802996:	48 85 c0             	test   %rax,%rax
+  802999:	0f 84 a2 00 00 00    	je     802a41 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80299f:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029a4:	4c 89 e7             	mov    %r12,%rdi
+  8029a7:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8029b3:	83 f8 02             	cmp    $0x2,%eax
+  8029b6:	0f 8f 85 00 00 00    	jg     802a41 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8029bc:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029c3:	00 00 00 
+  8029c6:	4d 89 ef             	mov    %r13,%r15
+  8029c9:	49 29 c7             	sub    %rax,%r15
+  8029cc:	49 c1 ff 03          	sar    $0x3,%r15
+  8029d0:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8029d7:	aa aa aa 
+  8029da:	4c 0f af f8          	imul   %rax,%r15
+  8029de:	49 c1 e7 0e          	shl    $0xe,%r15
+  8029e2:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8029e7:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  8029ea:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8029ef:	0f 84 d7 00 00 00    	je     802acc <devfile_write+0x176>
+  8029f5:	49 8b 45 10          	mov    0x10(%r13),%rax
+  8029f9:	89 c2                	mov    %eax,%edx
+  8029fb:	41 03 55 0c          	add    0xc(%r13),%edx
+  8029ff:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a04:	75 0f                	jne    802a15 <devfile_write+0xbf>
+  802a06:	48 01 d8             	add    %rbx,%rax
+  802a09:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a0f:	0f 86 92 00 00 00    	jbe    802aa7 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a15:	4c 89 e7             	mov    %r12,%rdi
+  802a18:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  802a1f:	00 00 00 
+  802a22:	ff d0                	call   *%rax
+  802a24:	85 c0                	test   %eax,%eax
+  802a26:	78 52                	js     802a7a <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a28:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a2f:	77 7f                	ja     802ab0 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802a31:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a36:	0f 85 c2 00 00 00    	jne    802afe <devfile_write+0x1a8>
+  802a3c:	e9 94 00 00 00       	jmp    802ad5 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802a41:	4c 89 e7             	mov    %r12,%rdi
+  802a44:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  802a4b:	00 00 00 
+  802a4e:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a50:	85 c0                	test   %eax,%eax
+  802a52:	79 07                	jns    802a5b <devfile_write+0x105>
+  802a54:	48 98                	cltq
+  802a56:	e9 c8 00 00 00       	jmp    802b23 <devfile_write+0x1cd>
+  802a5b:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802a60:	48 89 da             	mov    %rbx,%rdx
+  802a63:	4c 89 f6             	mov    %r14,%rsi
+  802a66:	4c 89 e7             	mov    %r12,%rdi
+  802a69:	48 b8 b4 27 80 00 00 	movabs $0x8027b4,%rax
+  802a70:	00 00 00 
+  802a73:	ff d0                	call   *%rax
+  802a75:	e9 a9 00 00 00       	jmp    802b23 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a7a:	48 98                	cltq
+  802a7c:	e9 a2 00 00 00       	jmp    802b23 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802a81:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802a86:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802a8b:	4c 89 fe             	mov    %r15,%rsi
+  802a8e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a93:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802a9f:	85 c0                	test   %eax,%eax
+  802aa1:	79 45                	jns    802ae8 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802aa3:	48 98                	cltq
+  802aa5:	eb 7c                	jmp    802b23 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802aa7:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802aae:	76 4e                	jbe    802afe <devfile_write+0x1a8>
+  802ab0:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ab5:	48 89 da             	mov    %rbx,%rdx
+  802ab8:	4c 89 f6             	mov    %r14,%rsi
+  802abb:	4c 89 e7             	mov    %r12,%rdi
+  802abe:	48 b8 b4 27 80 00 00 	movabs $0x8027b4,%rax
+  802ac5:	00 00 00 
+  802ac8:	ff d0                	call   *%rax
+  802aca:	eb 57                	jmp    802b23 <devfile_write+0x1cd>
+  802acc:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ad3:	77 db                	ja     802ab0 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802ad5:	4c 89 ff             	mov    %r15,%rdi
+  802ad8:	48 b8 7f 40 80 00 00 	movabs $0x80407f,%rax
+  802adf:	00 00 00 
+  802ae2:	ff d0                	call   *%rax
+  802ae4:	84 c0                	test   %al,%al
+  802ae6:	74 99                	je     802a81 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802ae8:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802aed:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802af2:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802af6:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802afd:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802afe:	4c 89 ff             	mov    %r15,%rdi
+  802b01:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b05:	48 89 da             	mov    %rbx,%rdx
+  802b08:	4c 89 f6             	mov    %r14,%rsi
+  802b0b:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b17:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b1b:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b20:	48 89 d8             	mov    %rbx,%rax
+}
+  802b23:	48 83 c4 08          	add    $0x8,%rsp
+  802b27:	5b                   	pop    %rbx
+  802b28:	41 5c                	pop    %r12
+  802b2a:	41 5d                	pop    %r13
+  802b2c:	41 5e                	pop    %r14
+  802b2e:	41 5f                	pop    %r15
+  802b30:	5d                   	pop    %rbp
+  802b31:	c3                   	ret
+        return E_INVAL;
+  802b32:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802b37:	c3                   	ret
+
+0000000000802b38 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b38:	55                   	push   %rbp
+  802b39:	48 89 e5             	mov    %rsp,%rbp
+  802b3c:	41 54                	push   %r12
+  802b3e:	53                   	push   %rbx
+  802b3f:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802b42:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  802b49:	00 00 00 
+  802b4c:	ff d0                	call   *%rax
+  802b4e:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802b51:	48 89 df             	mov    %rbx,%rdi
+  802b54:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  802b5b:	00 00 00 
+  802b5e:	ff d0                	call   *%rax
+  802b60:	48 85 c0             	test   %rax,%rax
+  802b63:	74 17                	je     802b7c <devfile_flush+0x44>
+  802b65:	48 89 df             	mov    %rbx,%rdi
+  802b68:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  802b6f:	00 00 00 
+  802b72:	ff d0                	call   *%rax
+  802b74:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802b7b:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802b7c:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802b7f:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802b86:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802b88:	ba 00 00 00 00       	mov    $0x0,%edx
+  802b8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802b92:	bf 06 00 00 00       	mov    $0x6,%edi
+  802b97:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  802b9e:	00 00 00 
+  802ba1:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802ba3:	45 85 e4             	test   %r12d,%r12d
+  802ba6:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802baa:	5b                   	pop    %rbx
+  802bab:	41 5c                	pop    %r12
+  802bad:	5d                   	pop    %rbp
+  802bae:	c3                   	ret
+
+0000000000802baf <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802baf:	55                   	push   %rbp
+  802bb0:	48 89 e5             	mov    %rsp,%rbp
+  802bb3:	41 57                	push   %r15
+  802bb5:	41 56                	push   %r14
+  802bb7:	41 55                	push   %r13
+  802bb9:	41 54                	push   %r12
+  802bbb:	53                   	push   %rbx
+  802bbc:	48 83 ec 38          	sub    $0x38,%rsp
+  802bc0:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802bc4:	49 89 f7             	mov    %rsi,%r15
+  802bc7:	48 89 d3             	mov    %rdx,%rbx
+  802bca:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802bcd:	48 b8 fa 20 80 00 00 	movabs $0x8020fa,%rax
+  802bd4:	00 00 00 
+  802bd7:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802bd9:	48 85 c0             	test   %rax,%rax
+  802bdc:	75 20                	jne    802bfe <devfile_read_direct+0x4f>
+    bool map = 1;
+  802bde:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802be3:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802bea:	00 
+    while (n) {
+  802beb:	48 85 db             	test   %rbx,%rbx
+  802bee:	0f 85 df 00 00 00    	jne    802cd3 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802bf4:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802bf8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802bfc:	eb 21                	jmp    802c1f <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802bfe:	45 89 f1             	mov    %r14d,%r9d
+  802c01:	49 89 d8             	mov    %rbx,%r8
+  802c04:	4c 89 f9             	mov    %r15,%rcx
+  802c07:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c0c:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c10:	48 89 c7             	mov    %rax,%rdi
+  802c13:	48 b8 e1 21 80 00 00 	movabs $0x8021e1,%rax
+  802c1a:	00 00 00 
+  802c1d:	ff d0                	call   *%rax
+}
+  802c1f:	48 83 c4 38          	add    $0x38,%rsp
+  802c23:	5b                   	pop    %rbx
+  802c24:	41 5c                	pop    %r12
+  802c26:	41 5d                	pop    %r13
+  802c28:	41 5e                	pop    %r14
+  802c2a:	41 5f                	pop    %r15
+  802c2c:	5d                   	pop    %rbp
+  802c2d:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c2e:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c32:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c38:	75 1e                	jne    802c58 <devfile_read_direct+0xa9>
+  802c3a:	e9 e2 00 00 00       	jmp    802d21 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802c3f:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c43:	eb da                	jmp    802c1f <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802c45:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802c49:	0f 85 d0 01 00 00    	jne    802e1f <devfile_read_direct+0x270>
+            map = 0;
+  802c4f:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c53:	eb 03                	jmp    802c58 <devfile_read_direct+0xa9>
+  802c55:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802c58:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802c5d:	48 39 d3             	cmp    %rdx,%rbx
+  802c60:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802c64:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c68:	8b 40 0c             	mov    0xc(%rax),%eax
+  802c6b:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802c72:	00 00 00 
+  802c75:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802c77:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802c7b:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802c7f:	be 00 00 00 00       	mov    $0x0,%esi
+  802c84:	bf 03 00 00 00       	mov    $0x3,%edi
+  802c89:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  802c90:	00 00 00 
+  802c93:	ff d0                	call   *%rax
+        if (res <= 0)
+  802c95:	85 c0                	test   %eax,%eax
+  802c97:	0f 8e 63 01 00 00    	jle    802e00 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802c9d:	4c 63 e0             	movslq %eax,%r12
+  802ca0:	4c 89 e2             	mov    %r12,%rdx
+  802ca3:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802caa:	00 00 00 
+  802cad:	4c 89 ff             	mov    %r15,%rdi
+  802cb0:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  802cb7:	00 00 00 
+  802cba:	ff d0                	call   *%rax
+        buf += res;
+  802cbc:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802cbf:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802cc2:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802cc6:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802cca:	48 85 db             	test   %rbx,%rbx
+  802ccd:	0f 84 25 ff ff ff    	je     802bf8 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802cd3:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802cd6:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802cda:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802cde:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802ce2:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ce9:	0f 97 c2             	seta   %dl
+  802cec:	20 c2                	and    %al,%dl
+  802cee:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802cf1:	0f 84 5e ff ff ff    	je     802c55 <devfile_read_direct+0xa6>
+  802cf7:	4c 89 fa             	mov    %r15,%rdx
+  802cfa:	4d 89 fd             	mov    %r15,%r13
+  802cfd:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d04:	0f 85 4e ff ff ff    	jne    802c58 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d0a:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d0e:	0f 84 1a ff ff ff    	je     802c2e <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d14:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d1b:	0f 85 37 ff ff ff    	jne    802c58 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d21:	48 89 d8             	mov    %rbx,%rax
+  802d24:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d2a:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d2f:	48 39 c8             	cmp    %rcx,%rax
+  802d32:	48 0f 47 c1          	cmova  %rcx,%rax
+  802d36:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802d3a:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802d3e:	49 89 d4             	mov    %rdx,%r12
+  802d41:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802d45:	48 b8 20 40 80 00 00 	movabs $0x804020,%rax
+  802d4c:	00 00 00 
+  802d4f:	ff d0                	call   *%rax
+  802d51:	a8 40                	test   $0x40,%al
+  802d53:	0f 85 b9 00 00 00    	jne    802e12 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802d59:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802d60:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802d64:	49 39 c5             	cmp    %rax,%r13
+  802d67:	72 d8                	jb     802d41 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d69:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802d6d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802d74:	00 00 00 
+  802d77:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d7b:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802d7e:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802d80:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802d84:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802d88:	48 b8 95 1f 80 00 00 	movabs $0x801f95,%rax
+  802d8f:	00 00 00 
+  802d92:	ff d0                	call   *%rax
+  802d94:	89 c7                	mov    %eax,%edi
+  802d96:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802d9c:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802da1:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802da8:	00 00 00 
+  802dab:	be 0e 00 00 00       	mov    $0xe,%esi
+  802db0:	48 b8 ae 17 80 00 00 	movabs $0x8017ae,%rax
+  802db7:	00 00 00 
+  802dba:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802dbc:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802dc1:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802dc5:	4c 89 fe             	mov    %r15,%rsi
+  802dc8:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dcd:	48 b8 8a 17 80 00 00 	movabs $0x80178a,%rax
+  802dd4:	00 00 00 
+  802dd7:	ff d0                	call   *%rax
+  802dd9:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ddc:	48 85 d2             	test   %rdx,%rdx
+  802ddf:	0f 84 5a fe ff ff    	je     802c3f <devfile_read_direct+0x90>
+            if (res > 0) {
+  802de5:	0f 8e 5a fe ff ff    	jle    802c45 <devfile_read_direct+0x96>
+                buf += res;
+  802deb:	48 98                	cltq
+  802ded:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802df0:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802df3:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802df7:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802dfb:	e9 ca fe ff ff       	jmp    802cca <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e00:	41 89 c5             	mov    %eax,%r13d
+  802e03:	48 98                	cltq
+  802e05:	45 85 ed             	test   %r13d,%r13d
+  802e08:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e0d:	e9 0d fe ff ff       	jmp    802c1f <devfile_read_direct+0x70>
+            map = 0;
+  802e12:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e16:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e1a:	e9 39 fe ff ff       	jmp    802c58 <devfile_read_direct+0xa9>
+  802e1f:	48 89 d0             	mov    %rdx,%rax
+  802e22:	e9 f8 fd ff ff       	jmp    802c1f <devfile_read_direct+0x70>
+
+0000000000802e27 <devfile_read>:
+    if (!fd || !buf)
+  802e27:	48 85 ff             	test   %rdi,%rdi
+  802e2a:	0f 84 21 02 00 00    	je     803051 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e30:	55                   	push   %rbp
+  802e31:	48 89 e5             	mov    %rsp,%rbp
+  802e34:	41 57                	push   %r15
+  802e36:	41 56                	push   %r14
+  802e38:	41 55                	push   %r13
+  802e3a:	41 54                	push   %r12
+  802e3c:	53                   	push   %rbx
+  802e3d:	48 83 ec 28          	sub    $0x28,%rsp
+  802e41:	48 89 fb             	mov    %rdi,%rbx
+  802e44:	49 89 f4             	mov    %rsi,%r12
+  802e47:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802e4a:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e4f:	48 85 f6             	test   %rsi,%rsi
+  802e52:	74 4b                	je     802e9f <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802e54:	48 b8 64 21 80 00 00 	movabs $0x802164,%rax
+  802e5b:	00 00 00 
+  802e5e:	ff d0                	call   *%rax
+  802e60:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e63:	48 85 c0             	test   %rax,%rax
+  802e66:	74 22                	je     802e8a <devfile_read+0x63>
+  802e68:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802e6f:	77 19                	ja     802e8a <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802e71:	be 00 10 00 00       	mov    $0x1000,%esi
+  802e76:	48 89 df             	mov    %rbx,%rdi
+  802e79:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  802e80:	00 00 00 
+  802e83:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802e85:	83 f8 02             	cmp    $0x2,%eax
+  802e88:	7e 40                	jle    802eca <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802e8a:	48 89 df             	mov    %rbx,%rdi
+  802e8d:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  802e94:	00 00 00 
+  802e97:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802e99:	85 c0                	test   %eax,%eax
+  802e9b:	79 11                	jns    802eae <devfile_read+0x87>
+  802e9d:	48 98                	cltq
+}
+  802e9f:	48 83 c4 28          	add    $0x28,%rsp
+  802ea3:	5b                   	pop    %rbx
+  802ea4:	41 5c                	pop    %r12
+  802ea6:	41 5d                	pop    %r13
+  802ea8:	41 5e                	pop    %r14
+  802eaa:	41 5f                	pop    %r15
+  802eac:	5d                   	pop    %rbp
+  802ead:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802eae:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802eb3:	4c 89 ea             	mov    %r13,%rdx
+  802eb6:	4c 89 e6             	mov    %r12,%rsi
+  802eb9:	48 89 df             	mov    %rbx,%rdi
+  802ebc:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  802ec3:	00 00 00 
+  802ec6:	ff d0                	call   *%rax
+  802ec8:	eb d5                	jmp    802e9f <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802eca:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802ece:	48 89 df             	mov    %rbx,%rdi
+  802ed1:	48 b8 b1 28 80 00 00 	movabs $0x8028b1,%rax
+  802ed8:	00 00 00 
+  802edb:	ff d0                	call   *%rax
+  802edd:	85 c0                	test   %eax,%eax
+  802edf:	0f 88 33 01 00 00    	js     803018 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802ee5:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802eec:	00 00 00 
+  802eef:	4c 89 f0             	mov    %r14,%rax
+  802ef2:	48 29 d0             	sub    %rdx,%rax
+  802ef5:	48 c1 f8 03          	sar    $0x3,%rax
+  802ef9:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f00:	aa aa aa 
+  802f03:	48 0f af c2          	imul   %rdx,%rax
+  802f07:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f0b:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f0f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f12:	41 39 06             	cmp    %eax,(%r14)
+  802f15:	75 0d                	jne    802f24 <devfile_read+0xfd>
+  802f17:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f1a:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f1e:	0f 84 fb 00 00 00    	je     80301f <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f24:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f29:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f2d:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802f30:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f34:	48 89 c7             	mov    %rax,%rdi
+  802f37:	48 b8 7f 40 80 00 00 	movabs $0x80407f,%rax
+  802f3e:	00 00 00 
+  802f41:	ff d0                	call   *%rax
+  802f43:	84 c0                	test   %al,%al
+  802f45:	75 27                	jne    802f6e <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f47:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f4c:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f51:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f55:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f5a:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  802f61:	00 00 00 
+  802f64:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802f66:	85 c0                	test   %eax,%eax
+  802f68:	0f 88 dc 00 00 00    	js     80304a <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802f6e:	44 89 f8             	mov    %r15d,%eax
+  802f71:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802f76:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802f78:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802f7f:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802f80:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f83:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802f87:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802f8a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f8f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802f93:	48 89 df             	mov    %rbx,%rdi
+  802f96:	48 b8 af 2b 80 00 00 	movabs $0x802baf,%rax
+  802f9d:	00 00 00 
+  802fa0:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802fa2:	48 85 c0             	test   %rax,%rax
+  802fa5:	0f 88 f4 fe ff ff    	js     802e9f <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802fab:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802fae:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802fb1:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802fb4:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802fb8:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802fbc:	48 63 d1             	movslq %ecx,%rdx
+  802fbf:	48 01 d0             	add    %rdx,%rax
+  802fc2:	4d 63 ff             	movslq %r15d,%r15
+  802fc5:	4c 29 f8             	sub    %r15,%rax
+  802fc8:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fcd:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802fd1:	48 85 c0             	test   %rax,%rax
+  802fd4:	0f 8e c5 fe ff ff    	jle    802e9f <devfile_read+0x78>
+    n = MIN(n, res);
+  802fda:	4c 39 e8             	cmp    %r13,%rax
+  802fdd:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802fe1:	8b 73 04             	mov    0x4(%rbx),%esi
+  802fe4:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802fe8:	48 63 f6             	movslq %esi,%rsi
+  802feb:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ff0:	48 01 c6             	add    %rax,%rsi
+  802ff3:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802ff7:	48 01 c6             	add    %rax,%rsi
+  802ffa:	4c 89 ea             	mov    %r13,%rdx
+  802ffd:	4c 89 e7             	mov    %r12,%rdi
+  803000:	48 b8 4b 0e 80 00 00 	movabs $0x800e4b,%rax
+  803007:	00 00 00 
+  80300a:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80300c:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803010:	4c 89 e8             	mov    %r13,%rax
+  803013:	e9 87 fe ff ff       	jmp    802e9f <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803018:	48 98                	cltq
+  80301a:	e9 80 fe ff ff       	jmp    802e9f <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80301f:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803023:	41 39 d7             	cmp    %edx,%r15d
+  803026:	0f 8c f8 fe ff ff    	jl     802f24 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80302c:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803030:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803033:	41 39 cf             	cmp    %ecx,%r15d
+  803036:	0f 8d e8 fe ff ff    	jge    802f24 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80303c:	4d 63 ff             	movslq %r15d,%r15
+  80303f:	4c 29 f8             	sub    %r15,%rax
+  803042:	48 63 d2             	movslq %edx,%rdx
+  803045:	48 01 d0             	add    %rdx,%rax
+  803048:	eb 87                	jmp    802fd1 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80304a:	48 98                	cltq
+  80304c:	e9 4e fe ff ff       	jmp    802e9f <devfile_read+0x78>
+        return E_INVAL;
+  803051:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803056:	c3                   	ret
+
+0000000000803057 <fs_channel>:
+fs_channel(bool enable) {
+  803057:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803059:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803060:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803062:	ba 00 00 00 00       	mov    $0x0,%edx
+  803067:	40 84 ff             	test   %dil,%dil
+  80306a:	74 47                	je     8030b3 <fs_channel+0x5c>
+  80306c:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803073:	00 00 00 
+  803076:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80307c:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803083:	00 00 00 
+  803086:	3b 08                	cmp    (%rax),%ecx
+  803088:	74 29                	je     8030b3 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80308a:	55                   	push   %rbp
+  80308b:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80308e:	48 b8 d7 1f 80 00 00 	movabs $0x801fd7,%rax
+  803095:	00 00 00 
+  803098:	ff d0                	call   *%rax
+  80309a:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80309c:	85 c0                	test   %eax,%eax
+  80309e:	78 04                	js     8030a4 <fs_channel+0x4d>
+}
+  8030a0:	89 d0                	mov    %edx,%eax
+  8030a2:	5d                   	pop    %rbp
+  8030a3:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8030a4:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8030ab:	00 00 00 
+  8030ae:	c6 00 00             	movb   $0x0,(%rax)
+  8030b1:	eb ed                	jmp    8030a0 <fs_channel+0x49>
+}
+  8030b3:	89 d0                	mov    %edx,%eax
+  8030b5:	c3                   	ret
+
+00000000008030b6 <open>:
+open(const char *path, int mode) {
+  8030b6:	55                   	push   %rbp
+  8030b7:	48 89 e5             	mov    %rsp,%rbp
+  8030ba:	41 55                	push   %r13
+  8030bc:	41 54                	push   %r12
+  8030be:	53                   	push   %rbx
+  8030bf:	48 83 ec 18          	sub    $0x18,%rsp
+  8030c3:	49 89 fc             	mov    %rdi,%r12
+  8030c6:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8030c9:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  8030d0:	00 00 00 
+  8030d3:	ff d0                	call   *%rax
+  8030d5:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8030db:	0f 87 8f 00 00 00    	ja     803170 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8030e1:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8030e5:	48 b8 91 18 80 00 00 	movabs $0x801891,%rax
+  8030ec:	00 00 00 
+  8030ef:	ff d0                	call   *%rax
+  8030f1:	89 c3                	mov    %eax,%ebx
+  8030f3:	85 c0                	test   %eax,%eax
+  8030f5:	78 55                	js     80314c <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8030f7:	4c 89 e6             	mov    %r12,%rsi
+  8030fa:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803101:	00 00 00 
+  803104:	48 89 df             	mov    %rbx,%rdi
+  803107:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  80310e:	00 00 00 
+  803111:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803113:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80311a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80311f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803123:	bf 01 00 00 00       	mov    $0x1,%edi
+  803128:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  80312f:	00 00 00 
+  803132:	ff d0                	call   *%rax
+  803134:	89 c3                	mov    %eax,%ebx
+  803136:	85 c0                	test   %eax,%eax
+  803138:	78 1f                	js     803159 <open+0xa3>
+    return fd2num(fd);
+  80313a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80313e:	48 b8 63 18 80 00 00 	movabs $0x801863,%rax
+  803145:	00 00 00 
+  803148:	ff d0                	call   *%rax
+  80314a:	89 c3                	mov    %eax,%ebx
+}
+  80314c:	89 d8                	mov    %ebx,%eax
+  80314e:	48 83 c4 18          	add    $0x18,%rsp
+  803152:	5b                   	pop    %rbx
+  803153:	41 5c                	pop    %r12
+  803155:	41 5d                	pop    %r13
+  803157:	5d                   	pop    %rbp
+  803158:	c3                   	ret
+        fd_close(fd, 0);
+  803159:	be 00 00 00 00       	mov    $0x0,%esi
+  80315e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803162:	48 b8 ac 19 80 00 00 	movabs $0x8019ac,%rax
+  803169:	00 00 00 
+  80316c:	ff d0                	call   *%rax
+        return res;
+  80316e:	eb dc                	jmp    80314c <open+0x96>
+        return -E_BAD_PATH;
+  803170:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803175:	eb d5                	jmp    80314c <open+0x96>
+
+0000000000803177 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803177:	55                   	push   %rbp
+  803178:	48 89 e5             	mov    %rsp,%rbp
+  80317b:	41 56                	push   %r14
+  80317d:	41 55                	push   %r13
+  80317f:	41 54                	push   %r12
+  803181:	53                   	push   %rbx
+  803182:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803186:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80318d:	00 00 00 
+  803190:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803195:	49 bd f1 18 80 00 00 	movabs $0x8018f1,%r13
+  80319c:	00 00 00 
+  80319f:	49 be b1 28 80 00 00 	movabs $0x8028b1,%r14
+  8031a6:	00 00 00 
+  8031a9:	eb 0c                	jmp    8031b7 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8031ab:	83 c3 01             	add    $0x1,%ebx
+  8031ae:	49 83 c4 18          	add    $0x18,%r12
+  8031b2:	83 fb 20             	cmp    $0x20,%ebx
+  8031b5:	74 1d                	je     8031d4 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031b7:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8031bc:	74 ed                	je     8031ab <file_flush_buffers+0x34>
+  8031be:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8031c2:	89 df                	mov    %ebx,%edi
+  8031c4:	41 ff d5             	call   *%r13
+  8031c7:	85 c0                	test   %eax,%eax
+  8031c9:	78 e0                	js     8031ab <file_flush_buffers+0x34>
+  8031cb:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031cf:	41 ff d6             	call   *%r14
+  8031d2:	eb d7                	jmp    8031ab <file_flush_buffers+0x34>
+}
+  8031d4:	48 83 c4 10          	add    $0x10,%rsp
+  8031d8:	5b                   	pop    %rbx
+  8031d9:	41 5c                	pop    %r12
+  8031db:	41 5d                	pop    %r13
+  8031dd:	41 5e                	pop    %r14
+  8031df:	5d                   	pop    %rbp
+  8031e0:	c3                   	ret
+
+00000000008031e1 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8031e1:	55                   	push   %rbp
+  8031e2:	48 89 e5             	mov    %rsp,%rbp
+  8031e5:	41 54                	push   %r12
+  8031e7:	53                   	push   %rbx
+  8031e8:	49 89 fc             	mov    %rdi,%r12
+  8031eb:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8031ed:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  8031f4:	00 00 00 
+  8031f7:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8031f9:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803200:	00 00 00 
+  803203:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803208:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  80320a:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80320d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803212:	be 00 00 00 00       	mov    $0x0,%esi
+  803217:	bf 02 00 00 00       	mov    $0x2,%edi
+  80321c:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  803223:	00 00 00 
+  803226:	ff d0                	call   *%rax
+}
+  803228:	5b                   	pop    %rbx
+  803229:	41 5c                	pop    %r12
+  80322b:	5d                   	pop    %rbp
+  80322c:	c3                   	ret
+
+000000000080322d <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80322d:	55                   	push   %rbp
+  80322e:	48 89 e5             	mov    %rsp,%rbp
+  803231:	41 54                	push   %r12
+  803233:	53                   	push   %rbx
+  803234:	49 89 fc             	mov    %rdi,%r12
+  803237:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80323a:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  803241:	00 00 00 
+  803244:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803246:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80324b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803252:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803254:	ba 00 00 00 00       	mov    $0x0,%edx
+  803259:	be 00 00 00 00       	mov    $0x0,%esi
+  80325e:	bf 05 00 00 00       	mov    $0x5,%edi
+  803263:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  80326a:	00 00 00 
+  80326d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80326f:	85 c0                	test   %eax,%eax
+  803271:	78 3d                	js     8032b0 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803273:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80327a:	00 00 00 
+  80327d:	4c 89 e6             	mov    %r12,%rsi
+  803280:	48 89 df             	mov    %rbx,%rdi
+  803283:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  80328a:	00 00 00 
+  80328d:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80328f:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803296:	00 
+  803297:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80329d:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8032a4:	00 
+  8032a5:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8032ab:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032b0:	5b                   	pop    %rbx
+  8032b1:	41 5c                	pop    %r12
+  8032b3:	5d                   	pop    %rbp
+  8032b4:	c3                   	ret
+
+00000000008032b5 <remove>:
+remove(const char *path) {
+  8032b5:	55                   	push   %rbp
+  8032b6:	48 89 e5             	mov    %rsp,%rbp
+  8032b9:	53                   	push   %rbx
+  8032ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8032be:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8032c1:	48 b8 ac 0b 80 00 00 	movabs $0x800bac,%rax
+  8032c8:	00 00 00 
+  8032cb:	ff d0                	call   *%rax
+  8032cd:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8032d3:	77 3a                	ja     80330f <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8032d5:	48 89 de             	mov    %rbx,%rsi
+  8032d8:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8032df:	00 00 00 
+  8032e2:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  8032e9:	00 00 00 
+  8032ec:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8032ee:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032f3:	be 00 00 00 00       	mov    $0x0,%esi
+  8032f8:	bf 07 00 00 00       	mov    $0x7,%edi
+  8032fd:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  803304:	00 00 00 
+  803307:	ff d0                	call   *%rax
+}
+  803309:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80330d:	c9                   	leave
+  80330e:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80330f:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803314:	eb f3                	jmp    803309 <remove+0x54>
+
+0000000000803316 <sync>:
+sync(void) {
+  803316:	55                   	push   %rbp
+  803317:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80331a:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803326:	ba 00 00 00 00       	mov    $0x0,%edx
+  80332b:	be 00 00 00 00       	mov    $0x0,%esi
+  803330:	bf 08 00 00 00       	mov    $0x8,%edi
+  803335:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  80333c:	00 00 00 
+  80333f:	ff d0                	call   *%rax
+}
+  803341:	5d                   	pop    %rbp
+  803342:	c3                   	ret
+
+0000000000803343 <fsync>:
+fsync(int fdnum) {
+  803343:	55                   	push   %rbp
+  803344:	48 89 e5             	mov    %rsp,%rbp
+  803347:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80334b:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80334f:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80335b:	85 c0                	test   %eax,%eax
+  80335d:	78 4b                	js     8033aa <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80335f:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803363:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80336a:	00 00 00 
+  80336d:	8b 00                	mov    (%rax),%eax
+  80336f:	39 02                	cmp    %eax,(%rdx)
+  803371:	75 39                	jne    8033ac <fsync+0x69>
+    file_flush_buffers();
+  803373:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  80337a:	00 00 00 
+  80337d:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80337f:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803383:	8b 40 0c             	mov    0xc(%rax),%eax
+  803386:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80338d:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80338f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803394:	be 00 00 00 00       	mov    $0x0,%esi
+  803399:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80339e:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  8033a5:	00 00 00 
+  8033a8:	ff d0                	call   *%rax
+}
+  8033aa:	c9                   	leave
+  8033ab:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033ac:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033b1:	eb f7                	jmp    8033aa <fsync+0x67>
+
+00000000008033b3 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8033b3:	55                   	push   %rbp
+  8033b4:	48 89 e5             	mov    %rsp,%rbp
+  8033b7:	53                   	push   %rbx
+  8033b8:	48 83 ec 08          	sub    $0x8,%rsp
+  8033bc:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8033bf:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033c4:	be 00 00 00 00       	mov    $0x0,%esi
+  8033c9:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8033ce:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  8033d5:	00 00 00 
+  8033d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033da:	85 c0                	test   %eax,%eax
+  8033dc:	78 2d                	js     80340b <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8033de:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8033e5:	00 00 00 
+  8033e8:	48 8b 10             	mov    (%rax),%rdx
+  8033eb:	48 89 13             	mov    %rdx,(%rbx)
+  8033ee:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8033f2:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8033f6:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8033fa:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8033fe:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803402:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803406:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80340b:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80340f:	c9                   	leave
+  803410:	c3                   	ret
+
+0000000000803411 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803411:	55                   	push   %rbp
+  803412:	48 89 e5             	mov    %rsp,%rbp
+  803415:	53                   	push   %rbx
+  803416:	48 83 ec 08          	sub    $0x8,%rsp
+  80341a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80341d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803422:	be 00 00 00 00       	mov    $0x0,%esi
+  803427:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80342c:	48 b8 48 26 80 00 00 	movabs $0x802648,%rax
+  803433:	00 00 00 
+  803436:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803438:	85 c0                	test   %eax,%eax
+  80343a:	78 3d                	js     803479 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80343c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803443:	00 00 00 
+  803446:	48 8b 10             	mov    (%rax),%rdx
+  803449:	48 89 13             	mov    %rdx,(%rbx)
+  80344c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803450:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803454:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803458:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80345c:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803460:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803464:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803468:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80346c:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803470:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803474:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803479:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80347d:	c9                   	leave
+  80347e:	c3                   	ret
+
+000000000080347f <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80347f:	55                   	push   %rbp
+  803480:	48 89 e5             	mov    %rsp,%rbp
+  803483:	41 57                	push   %r15
+  803485:	41 56                	push   %r14
+  803487:	41 55                	push   %r13
+  803489:	41 54                	push   %r12
+  80348b:	53                   	push   %rbx
+  80348c:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803490:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803497:	00 
+  803498:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80349f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034a5:	0f 85 43 01 00 00    	jne    8035ee <munmap+0x16f>
+  8034ab:	49 89 ff             	mov    %rdi,%r15
+  8034ae:	4c 39 f7             	cmp    %r14,%rdi
+  8034b1:	0f 87 37 01 00 00    	ja     8035ee <munmap+0x16f>
+  8034b7:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8034be:	00 00 00 
+  8034c1:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8034c7:	eb 2c                	jmp    8034f5 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8034c9:	4c 39 f8             	cmp    %r15,%rax
+  8034cc:	0f 83 85 00 00 00    	jae    803557 <munmap+0xd8>
+            m->mm_end = start;
+  8034d2:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8034d7:	48 83 c3 18          	add    $0x18,%rbx
+  8034db:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8034e2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8034e9:	00 00 00 
+  8034ec:	48 39 c3             	cmp    %rax,%rbx
+  8034ef:	0f 84 d0 00 00 00    	je     8035c5 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8034f5:	49 89 dc             	mov    %rbx,%r12
+  8034f8:	48 8b 03             	mov    (%rbx),%rax
+  8034fb:	4c 39 f0             	cmp    %r14,%rax
+  8034fe:	73 d7                	jae    8034d7 <munmap+0x58>
+  803500:	48 85 c0             	test   %rax,%rax
+  803503:	74 d2                	je     8034d7 <munmap+0x58>
+  803505:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803509:	49 39 d7             	cmp    %rdx,%r15
+  80350c:	73 c9                	jae    8034d7 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80350e:	49 39 d6             	cmp    %rdx,%r14
+  803511:	73 b6                	jae    8034c9 <munmap+0x4a>
+  803513:	49 39 c7             	cmp    %rax,%r15
+  803516:	76 b1                	jbe    8034c9 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803518:	4c 89 ef             	mov    %r13,%rdi
+  80351b:	48 b8 b6 25 80 00 00 	movabs $0x8025b6,%rax
+  803522:	00 00 00 
+  803525:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803527:	48 85 c0             	test   %rax,%rax
+  80352a:	0f 84 c5 00 00 00    	je     8035f5 <munmap+0x176>
+            *tail = *m;
+  803530:	48 8b 13             	mov    (%rbx),%rdx
+  803533:	48 89 10             	mov    %rdx,(%rax)
+  803536:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80353a:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80353e:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803542:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803546:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803549:	44 89 f2             	mov    %r14d,%edx
+  80354c:	2b 13                	sub    (%rbx),%edx
+  80354e:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803551:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803555:	eb 80                	jmp    8034d7 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803557:	49 39 d6             	cmp    %rdx,%r14
+  80355a:	73 18                	jae    803574 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80355c:	44 89 f2             	mov    %r14d,%edx
+  80355f:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803564:	29 c2                	sub    %eax,%edx
+  803566:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80356b:	4d 89 34 24          	mov    %r14,(%r12)
+  80356f:	e9 63 ff ff ff       	jmp    8034d7 <munmap+0x58>
+    m->mm_start = 0;
+  803574:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80357b:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80357c:	4c 89 e6             	mov    %r12,%rsi
+  80357f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803586:	00 00 00 
+  803589:	48 29 c6             	sub    %rax,%rsi
+  80358c:	48 c1 fe 03          	sar    $0x3,%rsi
+  803590:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803597:	aa aa aa 
+  80359a:	48 0f af f0          	imul   %rax,%rsi
+  80359e:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8035a2:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8035a7:	48 01 c6             	add    %rax,%rsi
+  8035aa:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035af:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035b4:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  8035bb:	00 00 00 
+  8035be:	ff d0                	call   *%rax
+}
+  8035c0:	e9 12 ff ff ff       	jmp    8034d7 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8035c5:	4c 89 f2             	mov    %r14,%rdx
+  8035c8:	4c 29 fa             	sub    %r15,%rdx
+  8035cb:	4c 89 fe             	mov    %r15,%rsi
+  8035ce:	bf 00 00 00 00       	mov    $0x0,%edi
+  8035d3:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  8035da:	00 00 00 
+  8035dd:	ff d0                	call   *%rax
+}
+  8035df:	48 83 c4 08          	add    $0x8,%rsp
+  8035e3:	5b                   	pop    %rbx
+  8035e4:	41 5c                	pop    %r12
+  8035e6:	41 5d                	pop    %r13
+  8035e8:	41 5e                	pop    %r14
+  8035ea:	41 5f                	pop    %r15
+  8035ec:	5d                   	pop    %rbp
+  8035ed:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8035ee:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8035f3:	eb ea                	jmp    8035df <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8035f5:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8035fa:	eb e3                	jmp    8035df <munmap+0x160>
+
+00000000008035fc <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8035fc:	55                   	push   %rbp
+  8035fd:	48 89 e5             	mov    %rsp,%rbp
+  803600:	41 57                	push   %r15
+  803602:	41 56                	push   %r14
+  803604:	41 55                	push   %r13
+  803606:	41 54                	push   %r12
+  803608:	53                   	push   %rbx
+  803609:	48 83 ec 28          	sub    $0x28,%rsp
+  80360d:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803611:	49 89 f5             	mov    %rsi,%r13
+  803614:	41 89 d6             	mov    %edx,%r14d
+  803617:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80361a:	41 89 cc             	mov    %ecx,%r12d
+  80361d:	44 89 c7             	mov    %r8d,%edi
+  803620:	44 89 cb             	mov    %r9d,%ebx
+  803623:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803627:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80362b:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  803632:	00 00 00 
+  803635:	ff d0                	call   *%rax
+  803637:	41 89 c7             	mov    %eax,%r15d
+  80363a:	85 c0                	test   %eax,%eax
+  80363c:	0f 88 ae 01 00 00    	js     8037f0 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803642:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803646:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80364d:	00 00 00 
+  803650:	8b 32                	mov    (%rdx),%esi
+  803652:	39 30                	cmp    %esi,(%rax)
+  803654:	0f 85 7a 02 00 00    	jne    8038d4 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80365a:	8b 40 08             	mov    0x8(%rax),%eax
+  80365d:	83 e0 03             	and    $0x3,%eax
+  803660:	83 f8 01             	cmp    $0x1,%eax
+  803663:	0f 84 76 02 00 00    	je     8038df <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803669:	4d 85 ed             	test   %r13,%r13
+  80366c:	0f 84 78 02 00 00    	je     8038ea <mmap+0x2ee>
+  803672:	85 db                	test   %ebx,%ebx
+  803674:	0f 88 70 02 00 00    	js     8038ea <mmap+0x2ee>
+  80367a:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803680:	41 89 df             	mov    %ebx,%r15d
+  803683:	0f 85 6c 02 00 00    	jne    8038f5 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803689:	44 89 f0             	mov    %r14d,%eax
+  80368c:	83 e0 fd             	and    $0xfffffffd,%eax
+  80368f:	83 f8 04             	cmp    $0x4,%eax
+  803692:	0f 85 68 02 00 00    	jne    803900 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803698:	44 89 e1             	mov    %r12d,%ecx
+  80369b:	83 e1 01             	and    $0x1,%ecx
+  80369e:	0f 95 c2             	setne  %dl
+  8036a1:	44 89 e0             	mov    %r12d,%eax
+  8036a4:	d1 e8                	shr    %eax
+  8036a6:	83 f0 01             	xor    $0x1,%eax
+  8036a9:	83 e0 01             	and    $0x1,%eax
+  8036ac:	38 c2                	cmp    %al,%dl
+  8036ae:	0f 85 57 02 00 00    	jne    80390b <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8036b4:	85 c9                	test   %ecx,%ecx
+  8036b6:	74 0a                	je     8036c2 <mmap+0xc6>
+  8036b8:	41 f6 c6 02          	test   $0x2,%r14b
+  8036bc:	0f 85 54 02 00 00    	jne    803916 <mmap+0x31a>
+    file_flush_buffers();
+  8036c2:	48 b8 77 31 80 00 00 	movabs $0x803177,%rax
+  8036c9:	00 00 00 
+  8036cc:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8036ce:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8036d5:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8036dc:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8036e0:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8036e3:	41 f6 c4 04          	test   $0x4,%r12b
+  8036e7:	0f 84 15 01 00 00    	je     803802 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8036ed:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8036f0:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8036f6:	0f 85 25 02 00 00    	jne    803921 <mmap+0x325>
+  8036fc:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  803700:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803707:	00 00 00 
+  80370a:	48 39 c2             	cmp    %rax,%rdx
+  80370d:	0f 82 19 02 00 00    	jb     80392c <mmap+0x330>
+  803713:	48 39 c7             	cmp    %rax,%rdi
+  803716:	0f 87 10 02 00 00    	ja     80392c <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80371c:	4c 89 ee             	mov    %r13,%rsi
+  80371f:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  803726:	00 00 00 
+  803729:	ff d0                	call   *%rax
+  80372b:	85 c0                	test   %eax,%eax
+  80372d:	0f 88 04 02 00 00    	js     803937 <mmap+0x33b>
+    if (!handler) {
+  803733:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80373a:	00 00 00 
+  80373d:	80 38 00             	cmpb   $0x0,(%rax)
+  803740:	75 2b                	jne    80376d <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803742:	48 bf 17 25 80 00 00 	movabs $0x802517,%rdi
+  803749:	00 00 00 
+  80374c:	48 b8 7b 46 80 00 00 	movabs $0x80467b,%rax
+  803753:	00 00 00 
+  803756:	ff d0                	call   *%rax
+  803758:	85 c0                	test   %eax,%eax
+  80375a:	0f 88 ea 01 00 00    	js     80394a <mmap+0x34e>
+        handler = 1;
+  803760:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803767:	00 00 00 
+  80376a:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  80376d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803771:	48 b8 b6 25 80 00 00 	movabs $0x8025b6,%rax
+  803778:	00 00 00 
+  80377b:	ff d0                	call   *%rax
+  80377d:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803780:	48 85 c0             	test   %rax,%rax
+  803783:	0f 84 c9 01 00 00    	je     803952 <mmap+0x356>
+    m->mm_start = va;
+  803789:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80378c:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803790:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803794:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803797:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80379b:	44 89 e0             	mov    %r12d,%eax
+  80379e:	c1 e0 06             	shl    $0x6,%eax
+  8037a1:	25 80 00 00 00       	and    $0x80,%eax
+  8037a6:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8037a9:	09 f0                	or     %esi,%eax
+  8037ab:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8037af:	41 f6 c4 08          	test   $0x8,%r12b
+  8037b3:	74 31                	je     8037e6 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037b5:	48 39 d3             	cmp    %rdx,%rbx
+  8037b8:	73 2c                	jae    8037e6 <mmap+0x1ea>
+  8037ba:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8037bf:	48 89 de             	mov    %rbx,%rsi
+  8037c2:	4c 89 f7             	mov    %r14,%rdi
+  8037c5:	48 b8 06 24 80 00 00 	movabs $0x802406,%rax
+  8037cc:	00 00 00 
+  8037cf:	ff d0                	call   *%rax
+  8037d1:	49 89 c4             	mov    %rax,%r12
+  8037d4:	48 85 c0             	test   %rax,%rax
+  8037d7:	0f 8e d7 00 00 00    	jle    8038b4 <mmap+0x2b8>
+            va += n;
+  8037dd:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8037e0:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8037e4:	72 d4                	jb     8037ba <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8037e6:	49 8b 06             	mov    (%r14),%rax
+  8037e9:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8037ed:	48 89 06             	mov    %rax,(%rsi)
+}
+  8037f0:	44 89 f8             	mov    %r15d,%eax
+  8037f3:	48 83 c4 28          	add    $0x28,%rsp
+  8037f7:	5b                   	pop    %rbx
+  8037f8:	41 5c                	pop    %r12
+  8037fa:	41 5d                	pop    %r13
+  8037fc:	41 5e                	pop    %r14
+  8037fe:	41 5f                	pop    %r15
+  803800:	5d                   	pop    %rbp
+  803801:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803802:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803809:	00 00 00 
+  80380c:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80380f:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803816:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803819:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80381e:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803825:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803828:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80382f:	00 00 00 
+  803832:	48 39 d7             	cmp    %rdx,%rdi
+  803835:	73 1c                	jae    803853 <mmap+0x257>
+        return -E_NO_MEM;
+  803837:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80383d:	eb b1                	jmp    8037f0 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80383f:	48 83 c0 01          	add    $0x1,%rax
+  803843:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803847:	77 3f                	ja     803888 <mmap+0x28c>
+  803849:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80384e:	48 39 d7             	cmp    %rdx,%rdi
+  803851:	72 2a                	jb     80387d <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803853:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803857:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80385b:	48 39 d1             	cmp    %rdx,%rcx
+  80385e:	73 df                	jae    80383f <mmap+0x243>
+  803860:	48 85 c9             	test   %rcx,%rcx
+  803863:	74 da                	je     80383f <mmap+0x243>
+  803865:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803869:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80386e:	48 39 d3             	cmp    %rdx,%rbx
+  803871:	73 cc                	jae    80383f <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803873:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803876:	b8 00 00 00 00       	mov    $0x0,%eax
+  80387b:	eb cc                	jmp    803849 <mmap+0x24d>
+        return -E_NO_MEM;
+  80387d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803883:	e9 68 ff ff ff       	jmp    8037f0 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803888:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80388d:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803894:	00 00 00 
+  803897:	48 39 c2             	cmp    %rax,%rdx
+  80389a:	0f 82 9f 00 00 00    	jb     80393f <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8038a0:	48 85 db             	test   %rbx,%rbx
+  8038a3:	0f 85 8a fe ff ff    	jne    803733 <mmap+0x137>
+        return -E_NO_MEM;
+  8038a9:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038af:	e9 3c ff ff ff       	jmp    8037f0 <mmap+0x1f4>
+        if (n < 0) {
+  8038b4:	0f 89 2c ff ff ff    	jns    8037e6 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8038ba:	49 8b 3e             	mov    (%r14),%rdi
+  8038bd:	4c 89 ee             	mov    %r13,%rsi
+  8038c0:	48 b8 7f 34 80 00 00 	movabs $0x80347f,%rax
+  8038c7:	00 00 00 
+  8038ca:	ff d0                	call   *%rax
+            return n;
+  8038cc:	45 89 e7             	mov    %r12d,%r15d
+  8038cf:	e9 1c ff ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8038d4:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038da:	e9 11 ff ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8038df:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038e5:	e9 06 ff ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8038ea:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038f0:	e9 fb fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+  8038f5:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8038fb:	e9 f0 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803900:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803906:	e9 e5 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80390b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803911:	e9 da fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803916:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80391c:	e9 cf fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803921:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803927:	e9 c4 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+  80392c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803932:	e9 b9 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803937:	41 89 c7             	mov    %eax,%r15d
+  80393a:	e9 b1 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+        return -E_NO_MEM;
+  80393f:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803945:	e9 a6 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80394a:	41 89 c7             	mov    %eax,%r15d
+  80394d:	e9 9e fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803952:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803958:	e9 93 fe ff ff       	jmp    8037f0 <mmap+0x1f4>
+
+000000000080395d <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  80395d:	55                   	push   %rbp
+  80395e:	48 89 e5             	mov    %rsp,%rbp
+  803961:	41 54                	push   %r12
+  803963:	53                   	push   %rbx
+  803964:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803967:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  80396e:	00 00 00 
+  803971:	ff d0                	call   *%rax
+  803973:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803976:	48 be 80 4f 80 00 00 	movabs $0x804f80,%rsi
+  80397d:	00 00 00 
+  803980:	48 89 df             	mov    %rbx,%rdi
+  803983:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  80398a:	00 00 00 
+  80398d:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80398f:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803994:	41 2b 04 24          	sub    (%r12),%eax
+  803998:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80399e:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039a5:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039a8:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039af:	00 00 00 
+  8039b2:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  8039b9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8039be:	5b                   	pop    %rbx
+  8039bf:	41 5c                	pop    %r12
+  8039c1:	5d                   	pop    %rbp
+  8039c2:	c3                   	ret
+
+00000000008039c3 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039c3:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8039c6:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  8039cc:	8b 17                	mov    (%rdi),%edx
+  8039ce:	85 d2                	test   %edx,%edx
+  8039d0:	75 01                	jne    8039d3 <pipe_wakeup+0x10>
+  8039d2:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  8039d3:	55                   	push   %rbp
+  8039d4:	48 89 e5             	mov    %rsp,%rbp
+  8039d7:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  8039da:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  8039e0:	be 00 04 00 00       	mov    $0x400,%esi
+  8039e5:	48 b8 d5 14 80 00 00 	movabs $0x8014d5,%rax
+  8039ec:	00 00 00 
+  8039ef:	ff d0                	call   *%rax
+}
+  8039f1:	5d                   	pop    %rbp
+  8039f2:	c3                   	ret
+
+00000000008039f3 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  8039f3:	55                   	push   %rbp
+  8039f4:	48 89 e5             	mov    %rsp,%rbp
+  8039f7:	41 55                	push   %r13
+  8039f9:	41 54                	push   %r12
+  8039fb:	53                   	push   %rbx
+  8039fc:	48 83 ec 08          	sub    $0x8,%rsp
+  803a00:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a03:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803a0a:	00 00 00 
+  803a0d:	ff d0                	call   *%rax
+  803a0f:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a12:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a17:	4c 89 e6             	mov    %r12,%rsi
+  803a1a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a1f:	49 bc ef 11 80 00 00 	movabs $0x8011ef,%r12
+  803a26:	00 00 00 
+  803a29:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a2c:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a30:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a34:	49 bd c3 39 80 00 00 	movabs $0x8039c3,%r13
+  803a3b:	00 00 00 
+  803a3e:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a41:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a45:	48 89 de             	mov    %rbx,%rsi
+  803a48:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803a4b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a50:	48 89 de             	mov    %rbx,%rsi
+  803a53:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a58:	41 ff d4             	call   *%r12
+  803a5b:	48 83 c4 08          	add    $0x8,%rsp
+  803a5f:	5b                   	pop    %rbx
+  803a60:	41 5c                	pop    %r12
+  803a62:	41 5d                	pop    %r13
+  803a64:	5d                   	pop    %rbp
+  803a65:	c3                   	ret
+
+0000000000803a66 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803a66:	55                   	push   %rbp
+  803a67:	48 89 e5             	mov    %rsp,%rbp
+  803a6a:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803a6d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803a72:	be 00 10 00 00       	mov    $0x1000,%esi
+  803a77:	48 b8 32 11 80 00 00 	movabs $0x801132,%rax
+  803a7e:	00 00 00 
+  803a81:	ff d0                	call   *%rax
+  803a83:	85 c0                	test   %eax,%eax
+  803a85:	0f 94 c0             	sete   %al
+  803a88:	0f b6 c0             	movzbl %al,%eax
+}
+  803a8b:	5d                   	pop    %rbp
+  803a8c:	c3                   	ret
+
+0000000000803a8d <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803a8d:	55                   	push   %rbp
+  803a8e:	48 89 e5             	mov    %rsp,%rbp
+  803a91:	41 57                	push   %r15
+  803a93:	41 56                	push   %r14
+  803a95:	41 55                	push   %r13
+  803a97:	41 54                	push   %r12
+  803a99:	53                   	push   %rbx
+  803a9a:	48 83 ec 38          	sub    $0x38,%rsp
+  803a9e:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803aa2:	49 89 f4             	mov    %rsi,%r12
+  803aa5:	49 89 d7             	mov    %rdx,%r15
+  803aa8:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803aac:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803ab3:	00 00 00 
+  803ab6:	ff d0                	call   *%rax
+  803ab8:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803abb:	4d 85 ff             	test   %r15,%r15
+  803abe:	0f 84 f1 00 00 00    	je     803bb5 <devpipe_write+0x128>
+  803ac4:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803ac8:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803acc:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803ad0:	49 bd 66 3a 80 00 00 	movabs $0x803a66,%r13
+  803ad7:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ada:	49 bf c3 39 80 00 00 	movabs $0x8039c3,%r15
+  803ae1:	00 00 00 
+  803ae4:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803ae8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803aec:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803af0:	8b 73 04             	mov    0x4(%rbx),%esi
+  803af3:	48 63 ce             	movslq %esi,%rcx
+  803af6:	48 63 03             	movslq (%rbx),%rax
+  803af9:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803aff:	48 39 c1             	cmp    %rax,%rcx
+  803b02:	72 64                	jb     803b68 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b04:	48 89 de             	mov    %rbx,%rsi
+  803b07:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b0b:	41 ff d5             	call   *%r13
+  803b0e:	85 c0                	test   %eax,%eax
+  803b10:	0f 85 b9 00 00 00    	jne    803bcf <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b16:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b1a:	4c 89 f7             	mov    %r14,%rdi
+  803b1d:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b20:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b23:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b2a:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b31:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b37:	8b 03                	mov    (%rbx),%eax
+  803b39:	41 39 c4             	cmp    %eax,%r12d
+  803b3c:	75 b2                	jne    803af0 <devpipe_write+0x63>
+  803b3e:	48 89 de             	mov    %rbx,%rsi
+  803b41:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b45:	41 ff d5             	call   *%r13
+  803b48:	85 c0                	test   %eax,%eax
+  803b4a:	75 a0                	jne    803aec <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b4c:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b51:	44 89 e6             	mov    %r12d,%esi
+  803b54:	48 89 df             	mov    %rbx,%rdi
+  803b57:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  803b5e:	00 00 00 
+  803b61:	ff d0                	call   *%rax
+  803b63:	e9 7c ff ff ff       	jmp    803ae4 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803b68:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803b6c:	41 0f b6 38          	movzbl (%r8),%edi
+  803b70:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803b77:	80 80 80 
+  803b7a:	48 89 c8             	mov    %rcx,%rax
+  803b7d:	48 f7 e2             	mul    %rdx
+  803b80:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803b84:	48 89 d0             	mov    %rdx,%rax
+  803b87:	48 c1 e0 08          	shl    $0x8,%rax
+  803b8b:	48 29 d0             	sub    %rdx,%rax
+  803b8e:	48 c1 e0 04          	shl    $0x4,%rax
+  803b92:	48 29 c1             	sub    %rax,%rcx
+  803b95:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803b9a:	83 c6 01             	add    $0x1,%esi
+  803b9d:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ba0:	49 83 c0 01          	add    $0x1,%r8
+  803ba4:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803ba8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803bac:	49 39 c0             	cmp    %rax,%r8
+  803baf:	0f 85 2f ff ff ff    	jne    803ae4 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803bb5:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803bb9:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803bbd:	48 b8 c3 39 80 00 00 	movabs $0x8039c3,%rax
+  803bc4:	00 00 00 
+  803bc7:	ff d0                	call   *%rax
+    return n;
+  803bc9:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803bcd:	eb 05                	jmp    803bd4 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bcf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803bd4:	48 83 c4 38          	add    $0x38,%rsp
+  803bd8:	5b                   	pop    %rbx
+  803bd9:	41 5c                	pop    %r12
+  803bdb:	41 5d                	pop    %r13
+  803bdd:	41 5e                	pop    %r14
+  803bdf:	41 5f                	pop    %r15
+  803be1:	5d                   	pop    %rbp
+  803be2:	c3                   	ret
+
+0000000000803be3 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803be3:	55                   	push   %rbp
+  803be4:	48 89 e5             	mov    %rsp,%rbp
+  803be7:	41 57                	push   %r15
+  803be9:	41 56                	push   %r14
+  803beb:	41 55                	push   %r13
+  803bed:	41 54                	push   %r12
+  803bef:	53                   	push   %rbx
+  803bf0:	48 83 ec 28          	sub    $0x28,%rsp
+  803bf4:	49 89 fd             	mov    %rdi,%r13
+  803bf7:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803bfb:	49 89 d4             	mov    %rdx,%r12
+  803bfe:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c02:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803c09:	00 00 00 
+  803c0c:	ff d0                	call   *%rax
+  803c0e:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c11:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c17:	49 bf 66 3a 80 00 00 	movabs $0x803a66,%r15
+  803c1e:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c21:	4d 85 e4             	test   %r12,%r12
+  803c24:	0f 84 d5 00 00 00    	je     803cff <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c2a:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c2e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c32:	8b 03                	mov    (%rbx),%eax
+  803c34:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c37:	75 7a                	jne    803cb3 <devpipe_read+0xd0>
+            if (i > 0) {
+  803c39:	4d 85 f6             	test   %r14,%r14
+  803c3c:	75 50                	jne    803c8e <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c3e:	48 89 de             	mov    %rbx,%rsi
+  803c41:	4c 89 ef             	mov    %r13,%rdi
+  803c44:	41 ff d7             	call   *%r15
+  803c47:	85 c0                	test   %eax,%eax
+  803c49:	0f 85 c9 00 00 00    	jne    803d18 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c4f:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803c52:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c59:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c5f:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c62:	41 39 c4             	cmp    %eax,%r12d
+  803c65:	75 cb                	jne    803c32 <devpipe_read+0x4f>
+  803c67:	48 89 de             	mov    %rbx,%rsi
+  803c6a:	4c 89 ef             	mov    %r13,%rdi
+  803c6d:	41 ff d7             	call   *%r15
+  803c70:	85 c0                	test   %eax,%eax
+  803c72:	75 be                	jne    803c32 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c74:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c79:	44 89 e6             	mov    %r12d,%esi
+  803c7c:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c80:	48 b8 b7 14 80 00 00 	movabs $0x8014b7,%rax
+  803c87:	00 00 00 
+  803c8a:	ff d0                	call   *%rax
+  803c8c:	eb a4                	jmp    803c32 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803c8e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803c92:	48 89 de             	mov    %rbx,%rsi
+  803c95:	48 b8 c3 39 80 00 00 	movabs $0x8039c3,%rax
+  803c9c:	00 00 00 
+  803c9f:	ff d0                	call   *%rax
+                return i;
+  803ca1:	4c 89 f0             	mov    %r14,%rax
+}
+  803ca4:	48 83 c4 28          	add    $0x28,%rsp
+  803ca8:	5b                   	pop    %rbx
+  803ca9:	41 5c                	pop    %r12
+  803cab:	41 5d                	pop    %r13
+  803cad:	41 5e                	pop    %r14
+  803caf:	41 5f                	pop    %r15
+  803cb1:	5d                   	pop    %rbp
+  803cb2:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803cb3:	48 63 c8             	movslq %eax,%rcx
+  803cb6:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803cbd:	80 80 80 
+  803cc0:	48 89 c8             	mov    %rcx,%rax
+  803cc3:	48 f7 e2             	mul    %rdx
+  803cc6:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803cca:	48 89 d0             	mov    %rdx,%rax
+  803ccd:	48 c1 e0 08          	shl    $0x8,%rax
+  803cd1:	48 29 d0             	sub    %rdx,%rax
+  803cd4:	48 c1 e0 04          	shl    $0x4,%rax
+  803cd8:	48 89 c2             	mov    %rax,%rdx
+  803cdb:	48 89 c8             	mov    %rcx,%rax
+  803cde:	48 29 d0             	sub    %rdx,%rax
+  803ce1:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803ce6:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803cea:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803cee:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803cf1:	49 83 c6 01          	add    $0x1,%r14
+  803cf5:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803cf9:	0f 85 2b ff ff ff    	jne    803c2a <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803cff:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d03:	48 89 de             	mov    %rbx,%rsi
+  803d06:	48 b8 c3 39 80 00 00 	movabs $0x8039c3,%rax
+  803d0d:	00 00 00 
+  803d10:	ff d0                	call   *%rax
+    return n;
+  803d12:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d16:	eb 8c                	jmp    803ca4 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d18:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d1d:	eb 85                	jmp    803ca4 <devpipe_read+0xc1>
+
+0000000000803d1f <pipe>:
+pipe(int pfd[2]) {
+  803d1f:	55                   	push   %rbp
+  803d20:	48 89 e5             	mov    %rsp,%rbp
+  803d23:	41 55                	push   %r13
+  803d25:	41 54                	push   %r12
+  803d27:	53                   	push   %rbx
+  803d28:	48 83 ec 18          	sub    $0x18,%rsp
+  803d2c:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d2f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d33:	48 b8 91 18 80 00 00 	movabs $0x801891,%rax
+  803d3a:	00 00 00 
+  803d3d:	ff d0                	call   *%rax
+  803d3f:	89 c3                	mov    %eax,%ebx
+  803d41:	85 c0                	test   %eax,%eax
+  803d43:	0f 88 a0 01 00 00    	js     803ee9 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d49:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d53:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5c:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+  803d68:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d6a:	85 c0                	test   %eax,%eax
+  803d6c:	0f 88 77 01 00 00    	js     803ee9 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803d72:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803d76:	48 b8 91 18 80 00 00 	movabs $0x801891,%rax
+  803d7d:	00 00 00 
+  803d80:	ff d0                	call   *%rax
+  803d82:	89 c3                	mov    %eax,%ebx
+  803d84:	85 c0                	test   %eax,%eax
+  803d86:	0f 88 43 01 00 00    	js     803ecf <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803d8c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d91:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d96:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d9a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d9f:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  803da6:	00 00 00 
+  803da9:	ff d0                	call   *%rax
+  803dab:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dad:	85 c0                	test   %eax,%eax
+  803daf:	0f 88 1a 01 00 00    	js     803ecf <pipe+0x1b0>
+    va = fd2data(fd0);
+  803db5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803db9:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803dc0:	00 00 00 
+  803dc3:	ff d0                	call   *%rax
+  803dc5:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803dc8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803dcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803dd2:	48 89 c6             	mov    %rax,%rsi
+  803dd5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803dda:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  803de1:	00 00 00 
+  803de4:	ff d0                	call   *%rax
+  803de6:	89 c3                	mov    %eax,%ebx
+  803de8:	85 c0                	test   %eax,%eax
+  803dea:	0f 88 c5 00 00 00    	js     803eb5 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803df0:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803df4:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803dfb:	00 00 00 
+  803dfe:	ff d0                	call   *%rax
+  803e00:	48 89 c1             	mov    %rax,%rcx
+  803e03:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e09:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e0f:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e14:	4c 89 ee             	mov    %r13,%rsi
+  803e17:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e1c:	48 b8 9f 11 80 00 00 	movabs $0x80119f,%rax
+  803e23:	00 00 00 
+  803e26:	ff d0                	call   *%rax
+  803e28:	89 c3                	mov    %eax,%ebx
+  803e2a:	85 c0                	test   %eax,%eax
+  803e2c:	78 6e                	js     803e9c <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e2e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e33:	4c 89 ef             	mov    %r13,%rdi
+  803e36:	48 b8 0e 11 80 00 00 	movabs $0x80110e,%rax
+  803e3d:	00 00 00 
+  803e40:	ff d0                	call   *%rax
+  803e42:	83 f8 02             	cmp    $0x2,%eax
+  803e45:	0f 85 ab 00 00 00    	jne    803ef6 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e4b:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803e52:	00 00 
+  803e54:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e58:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803e5a:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803e5e:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803e65:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803e69:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803e6b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803e6f:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803e76:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e7a:	48 bb 63 18 80 00 00 	movabs $0x801863,%rbx
+  803e81:	00 00 00 
+  803e84:	ff d3                	call   *%rbx
+  803e86:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803e8a:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e8e:	ff d3                	call   *%rbx
+  803e90:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803e95:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803e9a:	eb 4d                	jmp    803ee9 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803e9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ea1:	4c 89 ee             	mov    %r13,%rsi
+  803ea4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ea9:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  803eb0:	00 00 00 
+  803eb3:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803eb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eba:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803ebe:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec3:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  803eca:	00 00 00 
+  803ecd:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803ecf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ed4:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803ed8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803edd:	48 b8 ef 11 80 00 00 	movabs $0x8011ef,%rax
+  803ee4:	00 00 00 
+  803ee7:	ff d0                	call   *%rax
+}
+  803ee9:	89 d8                	mov    %ebx,%eax
+  803eeb:	48 83 c4 18          	add    $0x18,%rsp
+  803eef:	5b                   	pop    %rbx
+  803ef0:	41 5c                	pop    %r12
+  803ef2:	41 5d                	pop    %r13
+  803ef4:	5d                   	pop    %rbp
+  803ef5:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803ef6:	48 b9 b0 4f 80 00 00 	movabs $0x804fb0,%rcx
+  803efd:	00 00 00 
+  803f00:	48 ba 87 4f 80 00 00 	movabs $0x804f87,%rdx
+  803f07:	00 00 00 
+  803f0a:	be 50 00 00 00       	mov    $0x50,%esi
+  803f0f:	48 bf 9c 4f 80 00 00 	movabs $0x804f9c,%rdi
+  803f16:	00 00 00 
+  803f19:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f1e:	49 b8 4e 45 80 00 00 	movabs $0x80454e,%r8
+  803f25:	00 00 00 
+  803f28:	41 ff d0             	call   *%r8
+
+0000000000803f2b <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f2b:	55                   	push   %rbp
+  803f2c:	48 89 e5             	mov    %rsp,%rbp
+  803f2f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f33:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f37:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  803f3e:	00 00 00 
+  803f41:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f43:	85 c0                	test   %eax,%eax
+  803f45:	78 23                	js     803f6a <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f47:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f4b:	48 b8 75 18 80 00 00 	movabs $0x801875,%rax
+  803f52:	00 00 00 
+  803f55:	ff d0                	call   *%rax
+  803f57:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803f5a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f5e:	48 b8 66 3a 80 00 00 	movabs $0x803a66,%rax
+  803f65:	00 00 00 
+  803f68:	ff d0                	call   *%rax
+}
+  803f6a:	c9                   	leave
+  803f6b:	c3                   	ret
+
+0000000000803f6c <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803f6c:	48 89 f8             	mov    %rdi,%rax
+  803f6f:	48 c1 e8 27          	shr    $0x27,%rax
+  803f73:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803f7a:	01 00 00 
+  803f7d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f81:	f6 c2 01             	test   $0x1,%dl
+  803f84:	74 6d                	je     803ff3 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803f86:	48 89 f8             	mov    %rdi,%rax
+  803f89:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803f8d:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803f94:	01 00 00 
+  803f97:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803f9b:	f6 c2 01             	test   $0x1,%dl
+  803f9e:	74 62                	je     804002 <get_uvpt_entry+0x96>
+  803fa0:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fa7:	01 00 00 
+  803faa:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fae:	f6 c2 80             	test   $0x80,%dl
+  803fb1:	75 4f                	jne    804002 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803fb3:	48 89 f8             	mov    %rdi,%rax
+  803fb6:	48 c1 e8 15          	shr    $0x15,%rax
+  803fba:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fc1:	01 00 00 
+  803fc4:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fc8:	f6 c2 01             	test   $0x1,%dl
+  803fcb:	74 44                	je     804011 <get_uvpt_entry+0xa5>
+  803fcd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803fd4:	01 00 00 
+  803fd7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fdb:	f6 c2 80             	test   $0x80,%dl
+  803fde:	75 31                	jne    804011 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803fe0:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803fe4:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803feb:	01 00 00 
+  803fee:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803ff2:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803ff3:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803ffa:	01 00 00 
+  803ffd:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804001:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804002:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804009:	01 00 00 
+  80400c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804010:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804011:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804018:	01 00 00 
+  80401b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80401f:	c3                   	ret
+
+0000000000804020 <get_prot>:
+
+int
+get_prot(void *va) {
+  804020:	55                   	push   %rbp
+  804021:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804024:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  80402b:	00 00 00 
+  80402e:	ff d0                	call   *%rax
+  804030:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804033:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804038:	89 c1                	mov    %eax,%ecx
+  80403a:	83 c9 04             	or     $0x4,%ecx
+  80403d:	f6 c2 01             	test   $0x1,%dl
+  804040:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804043:	89 c1                	mov    %eax,%ecx
+  804045:	83 c9 02             	or     $0x2,%ecx
+  804048:	f6 c2 02             	test   $0x2,%dl
+  80404b:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80404e:	89 c1                	mov    %eax,%ecx
+  804050:	83 c9 01             	or     $0x1,%ecx
+  804053:	48 85 d2             	test   %rdx,%rdx
+  804056:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804059:	89 c1                	mov    %eax,%ecx
+  80405b:	83 c9 40             	or     $0x40,%ecx
+  80405e:	f6 c6 04             	test   $0x4,%dh
+  804061:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804064:	5d                   	pop    %rbp
+  804065:	c3                   	ret
+
+0000000000804066 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804066:	55                   	push   %rbp
+  804067:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80406a:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  804071:	00 00 00 
+  804074:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804076:	48 c1 e8 06          	shr    $0x6,%rax
+  80407a:	83 e0 01             	and    $0x1,%eax
+}
+  80407d:	5d                   	pop    %rbp
+  80407e:	c3                   	ret
+
+000000000080407f <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80407f:	55                   	push   %rbp
+  804080:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804083:	48 b8 6c 3f 80 00 00 	movabs $0x803f6c,%rax
+  80408a:	00 00 00 
+  80408d:	ff d0                	call   *%rax
+  80408f:	83 e0 01             	and    $0x1,%eax
+}
+  804092:	5d                   	pop    %rbp
+  804093:	c3                   	ret
+
+0000000000804094 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804094:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80409b:	01 00 00 
+  80409e:	a8 01                	test   $0x1,%al
+  8040a0:	75 06                	jne    8040a8 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8040a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040a7:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040a8:	55                   	push   %rbp
+  8040a9:	48 89 e5             	mov    %rsp,%rbp
+  8040ac:	41 57                	push   %r15
+  8040ae:	41 56                	push   %r14
+  8040b0:	41 55                	push   %r13
+  8040b2:	41 54                	push   %r12
+  8040b4:	53                   	push   %rbx
+  8040b5:	48 83 ec 28          	sub    $0x28,%rsp
+  8040b9:	49 89 fe             	mov    %rdi,%r14
+  8040bc:	49 89 f7             	mov    %rsi,%r15
+  8040bf:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8040c6:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040c7:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8040ce:	01 00 00 
+  8040d1:	e9 ae 00 00 00       	jmp    804184 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8040d6:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8040dd:	49 83 ec 01          	sub    $0x1,%r12
+  8040e1:	74 2d                	je     804110 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8040e3:	48 89 d8             	mov    %rbx,%rax
+  8040e6:	48 c1 e8 0c          	shr    $0xc,%rax
+  8040ea:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8040ef:	f6 c2 01             	test   $0x1,%dl
+  8040f2:	74 e2                	je     8040d6 <foreach_shared_region+0x42>
+  8040f4:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8040f9:	f6 c4 04             	test   $0x4,%ah
+  8040fc:	74 d8                	je     8040d6 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8040fe:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804105:	4c 89 fa             	mov    %r15,%rdx
+  804108:	48 89 df             	mov    %rbx,%rdi
+  80410b:	41 ff d6             	call   *%r14
+  80410e:	eb c6                	jmp    8040d6 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804110:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804117:	00 
+  804118:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80411d:	74 4a                	je     804169 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80411f:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804123:	48 c1 e8 15          	shr    $0x15,%rax
+  804127:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80412e:	01 00 00 
+  804131:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804135:	a8 01                	test   $0x1,%al
+  804137:	74 d7                	je     804110 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804139:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80413d:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804144:	48 39 c3             	cmp    %rax,%rbx
+  804147:	73 c7                	jae    804110 <foreach_shared_region+0x7c>
+  804149:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804150:	48 39 d0             	cmp    %rdx,%rax
+  804153:	4d 19 e4             	sbb    %r12,%r12
+  804156:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  80415d:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804164:	e9 7a ff ff ff       	jmp    8040e3 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804169:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804170:	40 
+  804171:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804175:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80417c:	00 00 00 
+  80417f:	48 39 c1             	cmp    %rax,%rcx
+  804182:	74 50                	je     8041d4 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804184:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804188:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80418c:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804193:	01 00 00 
+  804196:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80419a:	a8 01                	test   $0x1,%al
+  80419c:	74 cb                	je     804169 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80419e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041a2:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8041a9:	48 39 c1             	cmp    %rax,%rcx
+  8041ac:	73 bb                	jae    804169 <foreach_shared_region+0xd5>
+  8041ae:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8041b5:	48 39 d0             	cmp    %rdx,%rax
+  8041b8:	48 19 c0             	sbb    %rax,%rax
+  8041bb:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8041c1:	48 05 00 02 00 00    	add    $0x200,%rax
+  8041c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8041cb:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8041cf:	e9 4b ff ff ff       	jmp    80411f <foreach_shared_region+0x8b>
+  8041d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041d9:	48 83 c4 28          	add    $0x28,%rsp
+  8041dd:	5b                   	pop    %rbx
+  8041de:	41 5c                	pop    %r12
+  8041e0:	41 5d                	pop    %r13
+  8041e2:	41 5e                	pop    %r14
+  8041e4:	41 5f                	pop    %r15
+  8041e6:	5d                   	pop    %rbp
+  8041e7:	c3                   	ret
+
+00000000008041e8 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8041e8:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8041ee:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8041f5:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8041fc:	c3                   	ret
+
+00000000008041fd <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8041fd:	8b 47 40             	mov    0x40(%rdi),%eax
+  804200:	8b 17                	mov    (%rdi),%edx
+  804202:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804204:	83 f8 0f             	cmp    $0xf,%eax
+  804207:	77 13                	ja     80421c <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804209:	8b 47 40             	mov    0x40(%rdi),%eax
+  80420c:	83 e0 0f             	and    $0xf,%eax
+  80420f:	48 c1 e0 09          	shl    $0x9,%rax
+  804213:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80421a:	00 
+  80421b:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80421c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804221:	c3                   	ret
+
+0000000000804222 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804222:	8b 47 40             	mov    0x40(%rdi),%eax
+  804225:	83 c0 01             	add    $0x1,%eax
+  804228:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80422b:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804231:	8b 57 04             	mov    0x4(%rdi),%edx
+  804234:	b8 00 00 00 00       	mov    $0x0,%eax
+  804239:	85 d2                	test   %edx,%edx
+  80423b:	75 04                	jne    804241 <chan_publish+0x1f>
+  80423d:	83 e0 01             	and    $0x1,%eax
+}
+  804240:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804241:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804244:	85 c0                	test   %eax,%eax
+  804246:	0f 95 c0             	setne  %al
+  804249:	0f b6 c0             	movzbl %al,%eax
+  80424c:	eb ef                	jmp    80423d <chan_publish+0x1b>
+
+000000000080424e <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80424e:	8b 47 40             	mov    0x40(%rdi),%eax
+  804251:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804253:	29 d0                	sub    %edx,%eax
+  804255:	83 e8 01             	sub    $0x1,%eax
+  804258:	83 f8 0f             	cmp    $0xf,%eax
+  80425b:	77 12                	ja     80426f <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  80425d:	8b 07                	mov    (%rdi),%eax
+  80425f:	83 e0 0f             	and    $0xf,%eax
+  804262:	48 c1 e0 09          	shl    $0x9,%rax
+  804266:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80426d:	00 
+  80426e:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80426f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804274:	c3                   	ret
+
+0000000000804275 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804275:	8b 07                	mov    (%rdi),%eax
+  804277:	83 c0 01             	add    $0x1,%eax
+  80427a:	89 07                	mov    %eax,(%rdi)
+}
+  80427c:	c3                   	ret
+
+000000000080427d <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  80427d:	55                   	push   %rbp
+  80427e:	48 89 e5             	mov    %rsp,%rbp
+  804281:	53                   	push   %rbx
+  804282:	48 83 ec 08          	sub    $0x8,%rsp
+  804286:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804289:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804290:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804296:	48 b8 4e 42 80 00 00 	movabs $0x80424e,%rax
+  80429d:	00 00 00 
+  8042a0:	ff d0                	call   *%rax
+  8042a2:	48 85 c0             	test   %rax,%rax
+  8042a5:	74 12                	je     8042b9 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8042a7:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8042ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042b3:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042b7:	c9                   	leave
+  8042b8:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8042b9:	b8 01 00 00 00       	mov    $0x1,%eax
+  8042be:	eb f3                	jmp    8042b3 <chan_arm+0x36>
+
+00000000008042c0 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8042c0:	55                   	push   %rbp
+  8042c1:	48 89 e5             	mov    %rsp,%rbp
+  8042c4:	41 56                	push   %r14
+  8042c6:	41 55                	push   %r13
+  8042c8:	41 54                	push   %r12
+  8042ca:	53                   	push   %rbx
+  8042cb:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8042ce:	49 bc 7d 42 80 00 00 	movabs $0x80427d,%r12
+  8042d5:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042d8:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8042dc:	49 bd b7 14 80 00 00 	movabs $0x8014b7,%r13
+  8042e3:	00 00 00 
+    while (chan_arm(r))
+  8042e6:	eb 0d                	jmp    8042f5 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8042e8:	8b 33                	mov    (%rbx),%esi
+  8042ea:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042ef:	4c 89 f7             	mov    %r14,%rdi
+  8042f2:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8042f5:	48 89 df             	mov    %rbx,%rdi
+  8042f8:	41 ff d4             	call   *%r12
+  8042fb:	84 c0                	test   %al,%al
+  8042fd:	75 e9                	jne    8042e8 <chan_wait+0x28>
+}
+  8042ff:	5b                   	pop    %rbx
+  804300:	41 5c                	pop    %r12
+  804302:	41 5d                	pop    %r13
+  804304:	41 5e                	pop    %r14
+  804306:	5d                   	pop    %rbp
+  804307:	c3                   	ret
+
+0000000000804308 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804308:	55                   	push   %rbp
+  804309:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80430c:	48 83 c7 40          	add    $0x40,%rdi
+  804310:	be 01 00 00 00       	mov    $0x1,%esi
+  804315:	48 b8 d5 14 80 00 00 	movabs $0x8014d5,%rax
+  80431c:	00 00 00 
+  80431f:	ff d0                	call   *%rax
+}
+  804321:	5d                   	pop    %rbp
+  804322:	c3                   	ret
+
+0000000000804323 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804323:	b8 00 00 00 00       	mov    $0x0,%eax
+  804328:	c3                   	ret
+
+0000000000804329 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804329:	55                   	push   %rbp
+  80432a:	48 89 e5             	mov    %rsp,%rbp
+  80432d:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804330:	48 be d4 4f 80 00 00 	movabs $0x804fd4,%rsi
+  804337:	00 00 00 
+  80433a:	48 b8 ea 0b 80 00 00 	movabs $0x800bea,%rax
+  804341:	00 00 00 
+  804344:	ff d0                	call   *%rax
+    return 0;
+}
+  804346:	b8 00 00 00 00       	mov    $0x0,%eax
+  80434b:	5d                   	pop    %rbp
+  80434c:	c3                   	ret
+
+000000000080434d <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80434d:	55                   	push   %rbp
+  80434e:	48 89 e5             	mov    %rsp,%rbp
+  804351:	41 57                	push   %r15
+  804353:	41 56                	push   %r14
+  804355:	41 55                	push   %r13
+  804357:	41 54                	push   %r12
+  804359:	53                   	push   %rbx
+  80435a:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804361:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804368:	48 85 d2             	test   %rdx,%rdx
+  80436b:	74 7a                	je     8043e7 <devcons_write+0x9a>
+  80436d:	49 89 d6             	mov    %rdx,%r14
+  804370:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804376:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80437b:	49 bf e4 0d 80 00 00 	movabs $0x800de4,%r15
+  804382:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804385:	4c 89 f3             	mov    %r14,%rbx
+  804388:	48 29 f3             	sub    %rsi,%rbx
+  80438b:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804390:	48 39 c3             	cmp    %rax,%rbx
+  804393:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804397:	4c 63 eb             	movslq %ebx,%r13
+  80439a:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8043a1:	48 01 c6             	add    %rax,%rsi
+  8043a4:	4c 89 ea             	mov    %r13,%rdx
+  8043a7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043ae:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8043b1:	4c 89 ee             	mov    %r13,%rsi
+  8043b4:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043bb:	48 b8 11 10 80 00 00 	movabs $0x801011,%rax
+  8043c2:	00 00 00 
+  8043c5:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8043c7:	41 01 dc             	add    %ebx,%r12d
+  8043ca:	49 63 f4             	movslq %r12d,%rsi
+  8043cd:	4c 39 f6             	cmp    %r14,%rsi
+  8043d0:	72 b3                	jb     804385 <devcons_write+0x38>
+    return res;
+  8043d2:	49 63 c4             	movslq %r12d,%rax
+}
+  8043d5:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8043dc:	5b                   	pop    %rbx
+  8043dd:	41 5c                	pop    %r12
+  8043df:	41 5d                	pop    %r13
+  8043e1:	41 5e                	pop    %r14
+  8043e3:	41 5f                	pop    %r15
+  8043e5:	5d                   	pop    %rbp
+  8043e6:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8043e7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043ed:	eb e3                	jmp    8043d2 <devcons_write+0x85>
+
+00000000008043ef <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043ef:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8043f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043f7:	48 85 c0             	test   %rax,%rax
+  8043fa:	74 55                	je     804451 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8043fc:	55                   	push   %rbp
+  8043fd:	48 89 e5             	mov    %rsp,%rbp
+  804400:	41 55                	push   %r13
+  804402:	41 54                	push   %r12
+  804404:	53                   	push   %rbx
+  804405:	48 83 ec 08          	sub    $0x8,%rsp
+  804409:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80440c:	48 bb 30 10 80 00 00 	movabs $0x801030,%rbx
+  804413:	00 00 00 
+  804416:	49 bc e5 10 80 00 00 	movabs $0x8010e5,%r12
+  80441d:	00 00 00 
+  804420:	eb 03                	jmp    804425 <devcons_read+0x36>
+  804422:	41 ff d4             	call   *%r12
+  804425:	ff d3                	call   *%rbx
+  804427:	85 c0                	test   %eax,%eax
+  804429:	74 f7                	je     804422 <devcons_read+0x33>
+    if (c < 0) return c;
+  80442b:	48 63 d0             	movslq %eax,%rdx
+  80442e:	78 13                	js     804443 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804430:	ba 00 00 00 00       	mov    $0x0,%edx
+  804435:	83 f8 04             	cmp    $0x4,%eax
+  804438:	74 09                	je     804443 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80443a:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80443e:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804443:	48 89 d0             	mov    %rdx,%rax
+  804446:	48 83 c4 08          	add    $0x8,%rsp
+  80444a:	5b                   	pop    %rbx
+  80444b:	41 5c                	pop    %r12
+  80444d:	41 5d                	pop    %r13
+  80444f:	5d                   	pop    %rbp
+  804450:	c3                   	ret
+  804451:	48 89 d0             	mov    %rdx,%rax
+  804454:	c3                   	ret
+
+0000000000804455 <cputchar>:
+cputchar(int ch) {
+  804455:	55                   	push   %rbp
+  804456:	48 89 e5             	mov    %rsp,%rbp
+  804459:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  80445d:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804461:	be 01 00 00 00       	mov    $0x1,%esi
+  804466:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80446a:	48 b8 11 10 80 00 00 	movabs $0x801011,%rax
+  804471:	00 00 00 
+  804474:	ff d0                	call   *%rax
+}
+  804476:	c9                   	leave
+  804477:	c3                   	ret
+
+0000000000804478 <getchar>:
+getchar(void) {
+  804478:	55                   	push   %rbp
+  804479:	48 89 e5             	mov    %rsp,%rbp
+  80447c:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804480:	ba 01 00 00 00       	mov    $0x1,%edx
+  804485:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804489:	bf 00 00 00 00       	mov    $0x0,%edi
+  80448e:	48 b8 d4 1b 80 00 00 	movabs $0x801bd4,%rax
+  804495:	00 00 00 
+  804498:	ff d0                	call   *%rax
+  80449a:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80449c:	85 c0                	test   %eax,%eax
+  80449e:	78 06                	js     8044a6 <getchar+0x2e>
+  8044a0:	74 08                	je     8044aa <getchar+0x32>
+  8044a2:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8044a6:	89 d0                	mov    %edx,%eax
+  8044a8:	c9                   	leave
+  8044a9:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8044aa:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8044af:	eb f5                	jmp    8044a6 <getchar+0x2e>
+
+00000000008044b1 <iscons>:
+iscons(int fdnum) {
+  8044b1:	55                   	push   %rbp
+  8044b2:	48 89 e5             	mov    %rsp,%rbp
+  8044b5:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8044b9:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8044bd:	48 b8 f1 18 80 00 00 	movabs $0x8018f1,%rax
+  8044c4:	00 00 00 
+  8044c7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8044c9:	85 c0                	test   %eax,%eax
+  8044cb:	78 18                	js     8044e5 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8044cd:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8044d1:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8044d8:	00 00 00 
+  8044db:	8b 00                	mov    (%rax),%eax
+  8044dd:	39 02                	cmp    %eax,(%rdx)
+  8044df:	0f 94 c0             	sete   %al
+  8044e2:	0f b6 c0             	movzbl %al,%eax
+}
+  8044e5:	c9                   	leave
+  8044e6:	c3                   	ret
+
+00000000008044e7 <opencons>:
+opencons(void) {
+  8044e7:	55                   	push   %rbp
+  8044e8:	48 89 e5             	mov    %rsp,%rbp
+  8044eb:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8044ef:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8044f3:	48 b8 91 18 80 00 00 	movabs $0x801891,%rax
+  8044fa:	00 00 00 
+  8044fd:	ff d0                	call   *%rax
+  8044ff:	85 c0                	test   %eax,%eax
+  804501:	78 49                	js     80454c <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804503:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804508:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80450d:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804511:	bf 00 00 00 00       	mov    $0x0,%edi
+  804516:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  80451d:	00 00 00 
+  804520:	ff d0                	call   *%rax
+  804522:	85 c0                	test   %eax,%eax
+  804524:	78 26                	js     80454c <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804526:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80452a:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804531:	00 00 
+  804533:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804535:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804539:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804540:	48 b8 63 18 80 00 00 	movabs $0x801863,%rax
+  804547:	00 00 00 
+  80454a:	ff d0                	call   *%rax
+}
+  80454c:	c9                   	leave
+  80454d:	c3                   	ret
+
+000000000080454e <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80454e:	55                   	push   %rbp
+  80454f:	48 89 e5             	mov    %rsp,%rbp
+  804552:	41 56                	push   %r14
+  804554:	41 55                	push   %r13
+  804556:	41 54                	push   %r12
+  804558:	53                   	push   %rbx
+  804559:	48 83 ec 50          	sub    $0x50,%rsp
+  80455d:	49 89 fc             	mov    %rdi,%r12
+  804560:	41 89 f5             	mov    %esi,%r13d
+  804563:	48 89 d3             	mov    %rdx,%rbx
+  804566:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80456a:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80456e:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  804572:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  804579:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80457d:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804581:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804585:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804589:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  804590:	00 00 00 
+  804593:	4c 8b 30             	mov    (%rax),%r14
+  804596:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  80459d:	00 00 00 
+  8045a0:	ff d0                	call   *%rax
+  8045a2:	89 c6                	mov    %eax,%esi
+  8045a4:	45 89 e8             	mov    %r13d,%r8d
+  8045a7:	4c 89 e1             	mov    %r12,%rcx
+  8045aa:	4c 89 f2             	mov    %r14,%rdx
+  8045ad:	48 bf e0 4f 80 00 00 	movabs $0x804fe0,%rdi
+  8045b4:	00 00 00 
+  8045b7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045bc:	49 bc c5 02 80 00 00 	movabs $0x8002c5,%r12
+  8045c3:	00 00 00 
+  8045c6:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8045c9:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8045cd:	48 89 df             	mov    %rbx,%rdi
+  8045d0:	48 b8 61 02 80 00 00 	movabs $0x800261,%rax
+  8045d7:	00 00 00 
+  8045da:	ff d0                	call   *%rax
+    cprintf("\n");
+  8045dc:	48 bf 2b 4f 80 00 00 	movabs $0x804f2b,%rdi
+  8045e3:	00 00 00 
+  8045e6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8045eb:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8045ee:	cc                   	int3
+  8045ef:	eb fd                	jmp    8045ee <_panic+0xa0>
+
+00000000008045f1 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  8045f1:	55                   	push   %rbp
+  8045f2:	48 89 e5             	mov    %rsp,%rbp
+  8045f5:	41 56                	push   %r14
+  8045f7:	41 55                	push   %r13
+  8045f9:	41 54                	push   %r12
+  8045fb:	53                   	push   %rbx
+  8045fc:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8045ff:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804606:	00 00 00 
+  804609:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80460d:	74 27                	je     804636 <_handle_vectored_pagefault+0x45>
+  80460f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804614:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80461b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80461e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804621:	4c 89 e7             	mov    %r12,%rdi
+  804624:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804629:	84 c0                	test   %al,%al
+  80462b:	75 45                	jne    804672 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80462d:	48 83 c3 01          	add    $0x1,%rbx
+  804631:	49 3b 1e             	cmp    (%r14),%rbx
+  804634:	72 eb                	jb     804621 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804636:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80463d:	00 
+  80463e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804643:	4d 8b 04 24          	mov    (%r12),%r8
+  804647:	48 ba 08 50 80 00 00 	movabs $0x805008,%rdx
+  80464e:	00 00 00 
+  804651:	be 1d 00 00 00       	mov    $0x1d,%esi
+  804656:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  80465d:	00 00 00 
+  804660:	b8 00 00 00 00       	mov    $0x0,%eax
+  804665:	49 ba 4e 45 80 00 00 	movabs $0x80454e,%r10
+  80466c:	00 00 00 
+  80466f:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  804672:	5b                   	pop    %rbx
+  804673:	41 5c                	pop    %r12
+  804675:	41 5d                	pop    %r13
+  804677:	41 5e                	pop    %r14
+  804679:	5d                   	pop    %rbp
+  80467a:	c3                   	ret
+
+000000000080467b <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  80467b:	55                   	push   %rbp
+  80467c:	48 89 e5             	mov    %rsp,%rbp
+  80467f:	53                   	push   %rbx
+  804680:	48 83 ec 08          	sub    $0x8,%rsp
+  804684:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804687:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80468e:	00 00 00 
+  804691:	80 38 00             	cmpb   $0x0,(%rax)
+  804694:	0f 84 84 00 00 00    	je     80471e <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80469a:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046a1:	00 00 00 
+  8046a4:	48 8b 10             	mov    (%rax),%rdx
+  8046a7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046ac:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8046b3:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046b6:	48 85 d2             	test   %rdx,%rdx
+  8046b9:	74 19                	je     8046d4 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046bb:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  8046bf:	0f 84 e8 00 00 00    	je     8047ad <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046c5:	48 83 c0 01          	add    $0x1,%rax
+  8046c9:	48 39 d0             	cmp    %rdx,%rax
+  8046cc:	75 ed                	jne    8046bb <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  8046ce:	48 83 fa 08          	cmp    $0x8,%rdx
+  8046d2:	74 1c                	je     8046f0 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8046d4:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  8046d8:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  8046df:	00 00 00 
+  8046e2:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046e9:	00 00 00 
+  8046ec:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  8046f0:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  8046f7:	00 00 00 
+  8046fa:	ff d0                	call   *%rax
+  8046fc:	89 c7                	mov    %eax,%edi
+  8046fe:	48 be 73 48 80 00 00 	movabs $0x804873,%rsi
+  804705:	00 00 00 
+  804708:	48 b8 07 13 80 00 00 	movabs $0x801307,%rax
+  80470f:	00 00 00 
+  804712:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804714:	85 c0                	test   %eax,%eax
+  804716:	78 68                	js     804780 <add_pgfault_handler+0x105>
+    return res;
+}
+  804718:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80471c:	c9                   	leave
+  80471d:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80471e:	48 b8 bc 10 80 00 00 	movabs $0x8010bc,%rax
+  804725:	00 00 00 
+  804728:	ff d0                	call   *%rax
+  80472a:	89 c7                	mov    %eax,%edi
+  80472c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804731:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804736:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80473d:	00 00 00 
+  804740:	48 b8 49 11 80 00 00 	movabs $0x801149,%rax
+  804747:	00 00 00 
+  80474a:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80474c:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  804753:	00 00 00 
+  804756:	48 8b 02             	mov    (%rdx),%rax
+  804759:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  80475d:	48 89 0a             	mov    %rcx,(%rdx)
+  804760:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804767:	00 00 00 
+  80476a:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  80476e:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804775:	00 00 00 
+  804778:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  80477b:	e9 70 ff ff ff       	jmp    8046f0 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804780:	89 c1                	mov    %eax,%ecx
+  804782:	48 ba 46 50 80 00 00 	movabs $0x805046,%rdx
+  804789:	00 00 00 
+  80478c:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804791:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  804798:	00 00 00 
+  80479b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047a0:	49 b8 4e 45 80 00 00 	movabs $0x80454e,%r8
+  8047a7:	00 00 00 
+  8047aa:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047ad:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047b2:	e9 61 ff ff ff       	jmp    804718 <add_pgfault_handler+0x9d>
+
+00000000008047b7 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  8047b7:	55                   	push   %rbp
+  8047b8:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  8047bb:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047c2:	00 00 00 
+  8047c5:	80 38 00             	cmpb   $0x0,(%rax)
+  8047c8:	74 33                	je     8047fd <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047ca:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  8047d1:	00 00 00 
+  8047d4:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  8047d9:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047e0:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047e3:	48 85 c0             	test   %rax,%rax
+  8047e6:	0f 84 85 00 00 00    	je     804871 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  8047ec:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  8047f0:	74 40                	je     804832 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  8047f2:	48 83 c1 01          	add    $0x1,%rcx
+  8047f6:	48 39 c1             	cmp    %rax,%rcx
+  8047f9:	75 f1                	jne    8047ec <remove_pgfault_handler+0x35>
+  8047fb:	eb 74                	jmp    804871 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  8047fd:	48 b9 5e 50 80 00 00 	movabs $0x80505e,%rcx
+  804804:	00 00 00 
+  804807:	48 ba 87 4f 80 00 00 	movabs $0x804f87,%rdx
+  80480e:	00 00 00 
+  804811:	be 43 00 00 00       	mov    $0x43,%esi
+  804816:	48 bf 38 50 80 00 00 	movabs $0x805038,%rdi
+  80481d:	00 00 00 
+  804820:	b8 00 00 00 00       	mov    $0x0,%eax
+  804825:	49 b8 4e 45 80 00 00 	movabs $0x80454e,%r8
+  80482c:	00 00 00 
+  80482f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804832:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804839:	00 
+  80483a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80483e:	48 29 ca             	sub    %rcx,%rdx
+  804841:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804848:	00 00 00 
+  80484b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80484f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  804854:	48 89 ce             	mov    %rcx,%rsi
+  804857:	48 b8 e4 0d 80 00 00 	movabs $0x800de4,%rax
+  80485e:	00 00 00 
+  804861:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  804863:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80486a:	00 00 00 
+  80486d:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  804871:	5d                   	pop    %rbp
+  804872:	c3                   	ret
+
+0000000000804873 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  804873:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  804876:	48 b8 f1 45 80 00 00 	movabs $0x8045f1,%rax
+  80487d:	00 00 00 
+    call *%rax
+  804880:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804882:	41 5f                	pop    %r15
+	popq %r15
+  804884:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804886:	41 5f                	pop    %r15
+	popq %r14
+  804888:	41 5e                	pop    %r14
+	popq %r13
+  80488a:	41 5d                	pop    %r13
+	popq %r12
+  80488c:	41 5c                	pop    %r12
+	popq %r11
+  80488e:	41 5b                	pop    %r11
+	popq %r10
+  804890:	41 5a                	pop    %r10
+	popq %r9
+  804892:	41 59                	pop    %r9
+	popq %r8
+  804894:	41 58                	pop    %r8
+	popq %rsi
+  804896:	5e                   	pop    %rsi
+	popq %rdi
+  804897:	5f                   	pop    %rdi
+	popq %rbp
+  804898:	5d                   	pop    %rbp
+	popq %rdx
+  804899:	5a                   	pop    %rdx
+	popq %rcx
+  80489a:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80489b:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8048a0:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8048a5:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8048a9:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8048ac:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8048b1:	5b                   	pop    %rbx
+	popq %rax
+  8048b2:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8048b3:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  8048b7:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  8048b8:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  8048bd:	c3                   	ret
+  8048be:	66 90                	xchg   %ax,%ax
+
+00000000008048c0 <__rodata_start>:
+  8048c0:	70 69                	jo     80492b <__rodata_start+0x6b>
+  8048c2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c3:	67 70 6f             	addr32 jo 804935 <__rodata_start+0x75>
+  8048c6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8048c7:	67 62 65 6e 63 68    	(bad)
+  8048cd:	3a 20                	cmp    (%rax),%ah
+  8048cf:	25 64 20 72 6f       	and    $0x6f722064,%eax
+  8048d4:	75 6e                	jne    804944 <__rodata_start+0x84>
+  8048d6:	64 20 74 72 69       	and    %dh,%fs:0x69(%rdx,%rsi,2)
+  8048db:	70 73                	jo     804950 <__rodata_start+0x90>
+  8048dd:	2c 20                	sub    $0x20,%al
+  8048df:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  8048e4:	79 63                	jns    804949 <__rodata_start+0x89>
+  8048e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8048e7:	65 73 20             	gs jae 80490a <__rodata_start+0x4a>
+  8048ea:	70 65                	jo     804951 <__rodata_start+0x91>
+  8048ec:	72 20                	jb     80490e <__rodata_start+0x4e>
+  8048ee:	72 6f                	jb     80495f <__rodata_start+0x9f>
+  8048f0:	75 6e                	jne    804960 <__rodata_start+0xa0>
+  8048f2:	64 20 74 72 69       	and    %dh,%fs:0x69(%rdx,%rsi,2)
+  8048f7:	70 0a                	jo     804903 <__rodata_start+0x43>
+  8048f9:	00 3c 75 6e 6b 6e 6f 	add    %bh,0x6f6e6b6e(,%rsi,2)
+  804900:	77 6e                	ja     804970 <__rodata_start+0xb0>
+  804902:	3e 00 30             	ds add %dh,(%rax)
+  804905:	31 32                	xor    %esi,(%rdx)
+  804907:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80490e:	41                   	rex.B
+  80490f:	42                   	rex.X
+  804910:	43                   	rex.XB
+  804911:	44                   	rex.R
+  804912:	45                   	rex.RB
+  804913:	46 00 30             	rex.RX add %r14b,(%rax)
+  804916:	31 32                	xor    %esi,(%rdx)
+  804918:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80491f:	61                   	(bad)
+  804920:	62 63 64 65 66       	(bad)
+  804925:	00 28                	add    %ch,(%rax)
+  804927:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804928:	75 6c                	jne    804996 <__rodata_start+0xd6>
+  80492a:	6c                   	insb   (%dx),%es:(%rdi)
+  80492b:	29 00                	sub    %eax,(%rax)
+  80492d:	65 72 72             	gs jb  8049a2 <__rodata_start+0xe2>
+  804930:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804931:	72 20                	jb     804953 <__rodata_start+0x93>
+  804933:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804938:	73 70                	jae    8049aa <__rodata_start+0xea>
+  80493a:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80493e:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804945:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804946:	72 00                	jb     804948 <__rodata_start+0x88>
+  804948:	62 61 64 20 65       	(bad)
+  80494d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80494e:	76 69                	jbe    8049b9 <__rodata_start+0xf9>
+  804950:	72 6f                	jb     8049c1 <__rodata_start+0x101>
+  804952:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804953:	6d                   	insl   (%dx),%es:(%rdi)
+  804954:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804956:	74 00                	je     804958 <__rodata_start+0x98>
+  804958:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80495f:	20 70 61             	and    %dh,0x61(%rax)
+  804962:	72 61                	jb     8049c5 <__rodata_start+0x105>
+  804964:	6d                   	insl   (%dx),%es:(%rdi)
+  804965:	65 74 65             	gs je  8049cd <__rodata_start+0x10d>
+  804968:	72 00                	jb     80496a <__rodata_start+0xaa>
+  80496a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80496b:	75 74                	jne    8049e1 <__rodata_start+0x121>
+  80496d:	20 6f 66             	and    %ch,0x66(%rdi)
+  804970:	20 6d 65             	and    %ch,0x65(%rbp)
+  804973:	6d                   	insl   (%dx),%es:(%rdi)
+  804974:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804975:	72 79                	jb     8049f0 <__rodata_start+0x130>
+  804977:	00 6f 75             	add    %ch,0x75(%rdi)
+  80497a:	74 20                	je     80499c <__rodata_start+0xdc>
+  80497c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80497d:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804981:	76 69                	jbe    8049ec <__rodata_start+0x12c>
+  804983:	72 6f                	jb     8049f4 <__rodata_start+0x134>
+  804985:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804986:	6d                   	insl   (%dx),%es:(%rdi)
+  804987:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804989:	74 73                	je     8049fe <__rodata_start+0x13e>
+  80498b:	00 63 6f             	add    %ah,0x6f(%rbx)
+  80498e:	72 72                	jb     804a02 <__rodata_start+0x142>
+  804990:	75 70                	jne    804a02 <__rodata_start+0x142>
+  804992:	74 65                	je     8049f9 <__rodata_start+0x139>
+  804994:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804999:	75 67                	jne    804a02 <__rodata_start+0x142>
+  80499b:	20 69 6e             	and    %ch,0x6e(%rcx)
+  80499e:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049a0:	00 73 65             	add    %dh,0x65(%rbx)
+  8049a3:	67 6d                	insl   (%dx),%es:(%edi)
+  8049a5:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049a7:	74 61                	je     804a0a <__rodata_start+0x14a>
+  8049a9:	74 69                	je     804a14 <__rodata_start+0x154>
+  8049ab:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ac:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ad:	20 66 61             	and    %ah,0x61(%rsi)
+  8049b0:	75 6c                	jne    804a1e <__rodata_start+0x15e>
+  8049b2:	74 00                	je     8049b4 <__rodata_start+0xf4>
+  8049b4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049bb:	20 45 4c             	and    %al,0x4c(%rbp)
+  8049be:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  8049c2:	61                   	(bad)
+  8049c3:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  8049c8:	20 73 75             	and    %dh,0x75(%rbx)
+  8049cb:	63 68 20             	movsxd 0x20(%rax),%ebp
+  8049ce:	73 79                	jae    804a49 <__rodata_start+0x189>
+  8049d0:	73 74                	jae    804a46 <__rodata_start+0x186>
+  8049d2:	65 6d                	gs insl (%dx),%es:(%rdi)
+  8049d4:	20 63 61             	and    %ah,0x61(%rbx)
+  8049d7:	6c                   	insb   (%dx),%es:(%rdi)
+  8049d8:	6c                   	insb   (%dx),%es:(%rdi)
+  8049d9:	00 65 6e             	add    %ah,0x6e(%rbp)
+  8049dc:	74 72                	je     804a50 <__rodata_start+0x190>
+  8049de:	79 20                	jns    804a00 <__rodata_start+0x140>
+  8049e0:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049e1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e2:	74 20                	je     804a04 <__rodata_start+0x144>
+  8049e4:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049e6:	75 6e                	jne    804a56 <__rodata_start+0x196>
+  8049e8:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  8049ec:	76 20                	jbe    804a0e <__rodata_start+0x14e>
+  8049ee:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  8049f5:	72 65                	jb     804a5c <__rodata_start+0x19c>
+  8049f7:	63 76 69             	movsxd 0x69(%rsi),%esi
+  8049fa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049fb:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  8049ff:	65 78 70             	gs js  804a72 <__rodata_start+0x1b2>
+  804a02:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a07:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a0a:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a0e:	20 66 69             	and    %ah,0x69(%rsi)
+  804a11:	6c                   	insb   (%dx),%es:(%rdi)
+  804a12:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a16:	20 66 72             	and    %ah,0x72(%rsi)
+  804a19:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a1e:	61                   	(bad)
+  804a1f:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a22:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a23:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a24:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a28:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a2c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a2d:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a30:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a31:	79 20                	jns    804a53 <__rodata_start+0x193>
+  804a33:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a3a:	72 65                	jb     804aa1 <__rodata_start+0x1e1>
+  804a3c:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a3f:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a41:	00 66 69             	add    %ah,0x69(%rsi)
+  804a44:	6c                   	insb   (%dx),%es:(%rdi)
+  804a45:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a49:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a4c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a4d:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a50:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a51:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a52:	74 20                	je     804a74 <__rodata_start+0x1b4>
+  804a54:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a56:	75 6e                	jne    804ac6 <__rodata_start+0x206>
+  804a58:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804a5c:	76 61                	jbe    804abf <__rodata_start+0x1ff>
+  804a5e:	6c                   	insb   (%dx),%es:(%rdi)
+  804a5f:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804a66:	00 
+  804a67:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804a6e:	72 65                	jb     804ad5 <__rodata_start+0x215>
+  804a70:	61                   	(bad)
+  804a71:	64 79 20             	fs jns 804a94 <__rodata_start+0x1d4>
+  804a74:	65 78 69             	gs js  804ae0 <__rodata_start+0x220>
+  804a77:	73 74                	jae    804aed <__rodata_start+0x22d>
+  804a79:	73 00                	jae    804a7b <__rodata_start+0x1bb>
+  804a7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a7c:	70 65                	jo     804ae3 <__rodata_start+0x223>
+  804a7e:	72 61                	jb     804ae1 <__rodata_start+0x221>
+  804a80:	74 69                	je     804aeb <__rodata_start+0x22b>
+  804a82:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a83:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a84:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804a87:	74 20                	je     804aa9 <__rodata_start+0x1e9>
+  804a89:	73 75                	jae    804b00 <__rodata_start+0x240>
+  804a8b:	70 70                	jo     804afd <__rodata_start+0x23d>
+  804a8d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8e:	72 74                	jb     804b04 <__rodata_start+0x244>
+  804a90:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804a96:	20 61 67             	and    %ah,0x67(%rcx)
+  804a99:	61                   	(bad)
+  804a9a:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804aa1:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804aa5:	74 00                	je     804aa7 <__rodata_start+0x1e7>
+  804aa7:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804aae:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804ab1:	20 75 73             	and    %dh,0x73(%rbp)
+  804ab4:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804ab8:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804abf:	00 
+  804ac0:	b2 04                	mov    $0x4,%dl
+  804ac2:	80 00 00             	addb   $0x0,(%rax)
+  804ac5:	00 00                	add    %al,(%rax)
+  804ac7:	00 f3                	add    %dh,%bl
+  804ac9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804acf:	00 e3                	add    %ah,%bl
+  804ad1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ad7:	00 f3                	add    %dh,%bl
+  804ad9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804adf:	00 f3                	add    %dh,%bl
+  804ae1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ae7:	00 f3                	add    %dh,%bl
+  804ae9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804aef:	00 f3                	add    %dh,%bl
+  804af1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804af7:	00 d1                	add    %dl,%cl
+  804af9:	04 80                	add    $0x80,%al
+  804afb:	00 00                	add    %al,(%rax)
+  804afd:	00 00                	add    %al,(%rax)
+  804aff:	00 f3                	add    %dh,%bl
+  804b01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b07:	00 f3                	add    %dh,%bl
+  804b09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b0f:	00 c5                	add    %al,%ch
+  804b11:	04 80                	add    $0x80,%al
+  804b13:	00 00                	add    %al,(%rax)
+  804b15:	00 00                	add    %al,(%rax)
+  804b17:	00 3f                	add    %bh,(%rdi)
+  804b19:	05 80 00 00 00       	add    $0x80,%eax
+  804b1e:	00 00                	add    %al,(%rax)
+  804b20:	f3 0a 80 00 00 00 00 	repz or 0x0(%rax),%al
+  804b27:	00 c5                	add    %al,%ch
+  804b29:	04 80                	add    $0x80,%al
+  804b2b:	00 00                	add    %al,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 0b                	add    %cl,(%rbx)
+  804b31:	05 80 00 00 00       	add    $0x80,%eax
+  804b36:	00 00                	add    %al,(%rax)
+  804b38:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bbe <__rodata_start+0x2fe>
+  804b3e:	00 00                	add    %al,(%rax)
+  804b40:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bc6 <__rodata_start+0x306>
+  804b46:	00 00                	add    %al,(%rax)
+  804b48:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bce <__rodata_start+0x30e>
+  804b4e:	00 00                	add    %al,(%rax)
+  804b50:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bd6 <__rodata_start+0x316>
+  804b56:	00 00                	add    %al,(%rax)
+  804b58:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bde <__rodata_start+0x31e>
+  804b5e:	00 00                	add    %al,(%rax)
+  804b60:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804be6 <__rodata_start+0x326>
+  804b66:	00 00                	add    %al,(%rax)
+  804b68:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bee <__rodata_start+0x32e>
+  804b6e:	00 00                	add    %al,(%rax)
+  804b70:	0b 05 80 00 00 00    	or     0x80(%rip),%eax        # 804bf6 <__rodata_start+0x336>
+  804b76:	00 00                	add    %al,(%rax)
+  804b78:	f3 0a 80 00 00 00 00 	repz or 0x0(%rax),%al
+  804b7f:	00 f3                	add    %dh,%bl
+  804b81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b87:	00 f3                	add    %dh,%bl
+  804b89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b8f:	00 f3                	add    %dh,%bl
+  804b91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b97:	00 f3                	add    %dh,%bl
+  804b99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804b9f:	00 f3                	add    %dh,%bl
+  804ba1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ba7:	00 f3                	add    %dh,%bl
+  804ba9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804baf:	00 f3                	add    %dh,%bl
+  804bb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bb7:	00 f3                	add    %dh,%bl
+  804bb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bbf:	00 f3                	add    %dh,%bl
+  804bc1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bc7:	00 f3                	add    %dh,%bl
+  804bc9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bcf:	00 f3                	add    %dh,%bl
+  804bd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bd7:	00 f3                	add    %dh,%bl
+  804bd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bdf:	00 f3                	add    %dh,%bl
+  804be1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804be7:	00 f3                	add    %dh,%bl
+  804be9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bef:	00 f3                	add    %dh,%bl
+  804bf1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bf7:	00 f3                	add    %dh,%bl
+  804bf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804bff:	00 f3                	add    %dh,%bl
+  804c01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c07:	00 f3                	add    %dh,%bl
+  804c09:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c0f:	00 f3                	add    %dh,%bl
+  804c11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c17:	00 f3                	add    %dh,%bl
+  804c19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c1f:	00 f3                	add    %dh,%bl
+  804c21:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c27:	00 f3                	add    %dh,%bl
+  804c29:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c2f:	00 f3                	add    %dh,%bl
+  804c31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c37:	00 f3                	add    %dh,%bl
+  804c39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c3f:	00 f3                	add    %dh,%bl
+  804c41:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c47:	00 f3                	add    %dh,%bl
+  804c49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c4f:	00 f3                	add    %dh,%bl
+  804c51:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c57:	00 f3                	add    %dh,%bl
+  804c59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c5f:	00 f3                	add    %dh,%bl
+  804c61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c67:	00 16                	add    %dl,(%rsi)
+  804c69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c6f:	00 f3                	add    %dh,%bl
+  804c71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c77:	00 f3                	add    %dh,%bl
+  804c79:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c7f:	00 f3                	add    %dh,%bl
+  804c81:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c87:	00 f3                	add    %dh,%bl
+  804c89:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c8f:	00 f3                	add    %dh,%bl
+  804c91:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c97:	00 f3                	add    %dh,%bl
+  804c99:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804c9f:	00 f3                	add    %dh,%bl
+  804ca1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ca7:	00 f3                	add    %dh,%bl
+  804ca9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804caf:	00 f3                	add    %dh,%bl
+  804cb1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cb7:	00 f3                	add    %dh,%bl
+  804cb9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cbf:	00 62 05             	add    %ah,0x5(%rdx)
+  804cc2:	80 00 00             	addb   $0x0,(%rax)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 31                	add    %dh,(%rcx)
+  804cc9:	07                   	(bad)
+  804cca:	80 00 00             	addb   $0x0,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 f3                	add    %dh,%bl
+  804cd1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cd7:	00 f3                	add    %dh,%bl
+  804cd9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cdf:	00 f3                	add    %dh,%bl
+  804ce1:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804ce7:	00 f3                	add    %dh,%bl
+  804ce9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cef:	00 91 05 80 00 00    	add    %dl,0x8005(%rcx)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 f3                	add    %dh,%bl
+  804cf9:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804cff:	00 f3                	add    %dh,%bl
+  804d01:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d07:	00 57 05             	add    %dl,0x5(%rdi)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 f3                	add    %dh,%bl
+  804d11:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d17:	00 f3                	add    %dh,%bl
+  804d19:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d1f:	00 d9                	add    %bl,%cl
+  804d21:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804d27:	00 a3 09 80 00 00    	add    %ah,0x8009(%rbx)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 f3                	add    %dh,%bl
+  804d31:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d37:	00 f3                	add    %dh,%bl
+  804d39:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d3f:	00 28                	add    %ch,(%rax)
+  804d41:	06                   	(bad)
+  804d42:	80 00 00             	addb   $0x0,(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 f3                	add    %dh,%bl
+  804d49:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d4f:	00 05 08 80 00 00    	add    %al,0x8008(%rip)        # 80cd5d <__ctors_end+0x6c7d>
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 f3                	add    %dh,%bl
+  804d59:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d5f:	00 f3                	add    %dh,%bl
+  804d61:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d67:	00 16                	add    %dl,(%rsi)
+  804d69:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d6f:	00 f3                	add    %dh,%bl
+  804d71:	0a 80 00 00 00 00    	or     0x0(%rax),%al
+  804d77:	00 bb 04 80 00 00    	add    %bh,0x8004(%rbx)
+  804d7d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804d80 <error_string>:
+	...
+  804d88:	36 49 80 00 00 00 00 00 48 49 80 00 00 00 00 00     6I......HI......
+  804d98:	58 49 80 00 00 00 00 00 6a 49 80 00 00 00 00 00     XI......jI......
+  804da8:	78 49 80 00 00 00 00 00 8c 49 80 00 00 00 00 00     xI.......I......
+  804db8:	a1 49 80 00 00 00 00 00 b4 49 80 00 00 00 00 00     .I.......I......
+  804dc8:	c6 49 80 00 00 00 00 00 da 49 80 00 00 00 00 00     .I.......I......
+  804dd8:	ea 49 80 00 00 00 00 00 fd 49 80 00 00 00 00 00     .I.......I......
+  804de8:	14 4a 80 00 00 00 00 00 2a 4a 80 00 00 00 00 00     .J......*J......
+  804df8:	42 4a 80 00 00 00 00 00 5a 4a 80 00 00 00 00 00     BJ......ZJ......
+  804e08:	67 4a 80 00 00 00 00 00 38 4e 80 00 00 00 00 00     gJ......8N......
+  804e18:	7b 4a 80 00 00 00 00 00 93 4a 80 00 00 00 00 00     {J.......J......
+  804e28:	9d 4a 80 00 00 00 00 00 a7 4a 80 00 00 00 00 00     .J.......J......
+  804e38:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e48:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e58:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804e68:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804e78:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804e88:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804e98:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804ea8:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804eb8:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804ec8:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  804ed8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804ee8:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804ef8:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804f08:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804f18:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f28:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f38:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804f48:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f58:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f60 <devtab>:
+  804f60:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f70:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804f80:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804f90:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804fa0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804fb0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804fc0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804fd0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  804fe0:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  804ff0:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805000:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  805010:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805020:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805030:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805040:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805050:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805060:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805070:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  805080:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805090:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8050f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805100:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805110:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805120:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805130:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805140:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805150:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805160:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805170:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805180:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805190:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805200:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805210:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805220:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805230:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805240:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805250:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805260:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805270:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805280:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805290:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805300:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805310:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805320:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805330:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805340:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805350:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805360:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805370:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805380:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805390:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805400:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805410:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805420:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805430:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805440:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805450:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805460:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805470:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805480:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805490:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805500:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805510:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805520:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805530:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805540:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805550:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805560:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805570:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805580:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805590:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805600:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805610:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805620:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805630:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805640:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805650:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805660:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805670:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805680:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805690:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805700:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805710:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805720:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805730:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805740:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805750:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805760:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805770:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805780:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805790:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805800:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805810:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805820:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805830:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805840:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805850:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805860:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805870:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805880:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805890:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805900:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805910:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805920:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805930:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805940:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805950:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805960:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805970:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805980:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805990:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805aa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ab0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ac0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ad0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ae0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805af0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ba0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805be0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ca0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ce0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805da0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805db0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805de0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805df0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ea0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805eb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ec0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ed0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ee0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ef0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fa0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fe0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ff0:	66 2e 0f 1f 84 00 00 00 00 00 66 0f 1f 44 00 00     f.........f..D..
@@ -0,0 +1,8657 @@
+
+obj/user/pingpongs:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 6d 01 00 00       	call   800190 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <umain>:
+#include <inc/lib.h>
+
+uint32_t val;
+
+void
+umain(int argc, char **argv) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    envid_t who;
+
+    if ((who = sfork()) != 0) {
+  800036:	48 b8 bc 16 80 00 00 	movabs $0x8016bc,%rax
+  80003d:	00 00 00 
+  800040:	ff d0                	call   *%rax
+  800042:	89 45 cc             	mov    %eax,-0x34(%rbp)
+  800045:	85 c0                	test   %eax,%eax
+  800047:	0f 85 c3 00 00 00    	jne    800110 <umain+0xeb>
+        ipc_send(who, 0, 0, 0, 0);
+    }
+
+    while (1) {
+        ipc_recv(&who, 0, 0, 0);
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  80004d:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  800054:	00 00 00 
+        ipc_recv(&who, 0, 0, 0);
+  800057:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80005c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800061:	be 00 00 00 00       	mov    $0x0,%esi
+  800066:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  80006a:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  800071:	00 00 00 
+  800074:	ff d0                	call   *%rax
+        cprintf("%x got %d from %x (thisenv is %p %x)\n", sys_getenvid(), val, who, thisenv, thisenv->env_id);
+  800076:	48 b8 08 00 81 00 00 	movabs $0x810008,%rax
+  80007d:	00 00 00 
+  800080:	4c 8b 20             	mov    (%rax),%r12
+  800083:	45 8b bc 24 c8 00 00 	mov    0xc8(%r12),%r15d
+  80008a:	00 
+  80008b:	44 8b 75 cc          	mov    -0x34(%rbp),%r14d
+  80008f:	44 8b 2b             	mov    (%rbx),%r13d
+  800092:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  800099:	00 00 00 
+  80009c:	ff d0                	call   *%rax
+  80009e:	89 c6                	mov    %eax,%esi
+  8000a0:	45 89 f9             	mov    %r15d,%r9d
+  8000a3:	4d 89 e0             	mov    %r12,%r8
+  8000a6:	44 89 f1             	mov    %r14d,%ecx
+  8000a9:	44 89 ea             	mov    %r13d,%edx
+  8000ac:	48 bf 40 49 80 00 00 	movabs $0x804940,%rdi
+  8000b3:	00 00 00 
+  8000b6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000bb:	49 ba 13 03 80 00 00 	movabs $0x800313,%r10
+  8000c2:	00 00 00 
+  8000c5:	41 ff d2             	call   *%r10
+        if (val == 10) return;
+  8000c8:	8b 03                	mov    (%rbx),%eax
+  8000ca:	83 f8 0a             	cmp    $0xa,%eax
+  8000cd:	74 32                	je     800101 <umain+0xdc>
+        ++val;
+  8000cf:	83 c0 01             	add    $0x1,%eax
+  8000d2:	89 03                	mov    %eax,(%rbx)
+        ipc_send(who, 0, 0, 0, 0);
+  8000d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000da:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000df:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e4:	be 00 00 00 00       	mov    $0x0,%esi
+  8000e9:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  8000ec:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8000f3:	00 00 00 
+  8000f6:	ff d0                	call   *%rax
+        if (val == 10) return;
+  8000f8:	83 3b 0a             	cmpl   $0xa,(%rbx)
+  8000fb:	0f 85 56 ff ff ff    	jne    800057 <umain+0x32>
+    }
+}
+  800101:	48 83 c4 18          	add    $0x18,%rsp
+  800105:	5b                   	pop    %rbx
+  800106:	41 5c                	pop    %r12
+  800108:	41 5d                	pop    %r13
+  80010a:	41 5e                	pop    %r14
+  80010c:	41 5f                	pop    %r15
+  80010e:	5d                   	pop    %rbp
+  80010f:	c3                   	ret
+        cprintf("i am %08x; thisenv is %p\n", sys_getenvid(), thisenv);
+  800110:	48 b8 08 00 81 00 00 	movabs $0x810008,%rax
+  800117:	00 00 00 
+  80011a:	48 8b 18             	mov    (%rax),%rbx
+  80011d:	49 bc 0a 11 80 00 00 	movabs $0x80110a,%r12
+  800124:	00 00 00 
+  800127:	41 ff d4             	call   *%r12
+  80012a:	89 c6                	mov    %eax,%esi
+  80012c:	48 89 da             	mov    %rbx,%rdx
+  80012f:	48 bf 10 49 80 00 00 	movabs $0x804910,%rdi
+  800136:	00 00 00 
+  800139:	b8 00 00 00 00       	mov    $0x0,%eax
+  80013e:	48 bb 13 03 80 00 00 	movabs $0x800313,%rbx
+  800145:	00 00 00 
+  800148:	ff d3                	call   *%rbx
+        cprintf("send 0 from %x to %x\n", sys_getenvid(), who);
+  80014a:	44 8b 6d cc          	mov    -0x34(%rbp),%r13d
+  80014e:	41 ff d4             	call   *%r12
+  800151:	89 c6                	mov    %eax,%esi
+  800153:	44 89 ea             	mov    %r13d,%edx
+  800156:	48 bf 2a 49 80 00 00 	movabs $0x80492a,%rdi
+  80015d:	00 00 00 
+  800160:	b8 00 00 00 00       	mov    $0x0,%eax
+  800165:	ff d3                	call   *%rbx
+        ipc_send(who, 0, 0, 0, 0);
+  800167:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80016d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800172:	ba 00 00 00 00       	mov    $0x0,%edx
+  800177:	be 00 00 00 00       	mov    $0x0,%esi
+  80017c:	8b 7d cc             	mov    -0x34(%rbp),%edi
+  80017f:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+  80018b:	e9 bd fe ff ff       	jmp    80004d <umain+0x28>
+
+0000000000800190 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800190:	55                   	push   %rbp
+  800191:	48 89 e5             	mov    %rsp,%rbp
+  800194:	41 56                	push   %r14
+  800196:	41 55                	push   %r13
+  800198:	41 54                	push   %r12
+  80019a:	53                   	push   %rbx
+  80019b:	41 89 fd             	mov    %edi,%r13d
+  80019e:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001a1:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8001a8:	00 00 00 
+  8001ab:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8001b2:	00 00 00 
+  8001b5:	48 39 c2             	cmp    %rax,%rdx
+  8001b8:	73 17                	jae    8001d1 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001ba:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001bd:	49 89 c4             	mov    %rax,%r12
+  8001c0:	48 83 c3 08          	add    $0x8,%rbx
+  8001c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c9:	ff 53 f8             	call   *-0x8(%rbx)
+  8001cc:	4c 39 e3             	cmp    %r12,%rbx
+  8001cf:	72 ef                	jb     8001c0 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001d1:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  8001d8:	00 00 00 
+  8001db:	ff d0                	call   *%rax
+  8001dd:	89 c2                	mov    %eax,%edx
+  8001df:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001e5:	48 89 d0             	mov    %rdx,%rax
+  8001e8:	48 c1 e0 04          	shl    $0x4,%rax
+  8001ec:	48 29 d0             	sub    %rdx,%rax
+  8001ef:	48 c1 e0 05          	shl    $0x5,%rax
+  8001f3:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001fa:	00 00 00 
+  8001fd:	48 01 d0             	add    %rdx,%rax
+  800200:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  800207:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  80020a:	45 85 ed             	test   %r13d,%r13d
+  80020d:	7e 0d                	jle    80021c <libmain+0x8c>
+  80020f:	49 8b 06             	mov    (%r14),%rax
+  800212:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800219:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  80021c:	4c 89 f6             	mov    %r14,%rsi
+  80021f:	44 89 ef             	mov    %r13d,%edi
+  800222:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800229:	00 00 00 
+  80022c:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  80022e:	48 b8 43 02 80 00 00 	movabs $0x800243,%rax
+  800235:	00 00 00 
+  800238:	ff d0                	call   *%rax
+#endif
+}
+  80023a:	5b                   	pop    %rbx
+  80023b:	41 5c                	pop    %r12
+  80023d:	41 5d                	pop    %r13
+  80023f:	41 5e                	pop    %r14
+  800241:	5d                   	pop    %rbp
+  800242:	c3                   	ret
+
+0000000000800243 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800243:	55                   	push   %rbp
+  800244:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800247:	48 b8 d7 1a 80 00 00 	movabs $0x801ad7,%rax
+  80024e:	00 00 00 
+  800251:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800253:	bf 00 00 00 00       	mov    $0x0,%edi
+  800258:	48 b8 a7 10 80 00 00 	movabs $0x8010a7,%rax
+  80025f:	00 00 00 
+  800262:	ff d0                	call   *%rax
+}
+  800264:	5d                   	pop    %rbp
+  800265:	c3                   	ret
+
+0000000000800266 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800266:	55                   	push   %rbp
+  800267:	48 89 e5             	mov    %rsp,%rbp
+  80026a:	53                   	push   %rbx
+  80026b:	48 83 ec 08          	sub    $0x8,%rsp
+  80026f:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800272:	8b 06                	mov    (%rsi),%eax
+  800274:	8d 50 01             	lea    0x1(%rax),%edx
+  800277:	89 16                	mov    %edx,(%rsi)
+  800279:	48 98                	cltq
+  80027b:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800280:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800286:	74 0a                	je     800292 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800288:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80028c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800290:	c9                   	leave
+  800291:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800292:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800296:	be ff 00 00 00       	mov    $0xff,%esi
+  80029b:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+        state->offset = 0;
+  8002a7:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002ad:	eb d9                	jmp    800288 <putch+0x22>
+
+00000000008002af <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002af:	55                   	push   %rbp
+  8002b0:	48 89 e5             	mov    %rsp,%rbp
+  8002b3:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002ba:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002bd:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002c4:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002ce:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002d1:	48 89 f1             	mov    %rsi,%rcx
+  8002d4:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002db:	48 bf 66 02 80 00 00 	movabs $0x800266,%rdi
+  8002e2:	00 00 00 
+  8002e5:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  8002ec:	00 00 00 
+  8002ef:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002f1:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002f8:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002ff:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  800306:	00 00 00 
+  800309:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  80030b:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800311:	c9                   	leave
+  800312:	c3                   	ret
+
+0000000000800313 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800313:	55                   	push   %rbp
+  800314:	48 89 e5             	mov    %rsp,%rbp
+  800317:	48 83 ec 50          	sub    $0x50,%rsp
+  80031b:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80031f:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800323:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800327:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80032b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80032f:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800336:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80033a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80033e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800342:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800346:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  80034a:	48 b8 af 02 80 00 00 	movabs $0x8002af,%rax
+  800351:	00 00 00 
+  800354:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800356:	c9                   	leave
+  800357:	c3                   	ret
+
+0000000000800358 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800358:	55                   	push   %rbp
+  800359:	48 89 e5             	mov    %rsp,%rbp
+  80035c:	41 57                	push   %r15
+  80035e:	41 56                	push   %r14
+  800360:	41 55                	push   %r13
+  800362:	41 54                	push   %r12
+  800364:	53                   	push   %rbx
+  800365:	48 83 ec 18          	sub    $0x18,%rsp
+  800369:	49 89 fc             	mov    %rdi,%r12
+  80036c:	49 89 f5             	mov    %rsi,%r13
+  80036f:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800373:	8b 45 10             	mov    0x10(%rbp),%eax
+  800376:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800379:	41 89 cf             	mov    %ecx,%r15d
+  80037c:	4c 39 fa             	cmp    %r15,%rdx
+  80037f:	73 5b                	jae    8003dc <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800381:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800385:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800389:	85 db                	test   %ebx,%ebx
+  80038b:	7e 0e                	jle    80039b <print_num+0x43>
+            putch(padc, put_arg);
+  80038d:	4c 89 ee             	mov    %r13,%rsi
+  800390:	44 89 f7             	mov    %r14d,%edi
+  800393:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800396:	83 eb 01             	sub    $0x1,%ebx
+  800399:	75 f2                	jne    80038d <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  80039b:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80039f:	48 b9 81 49 80 00 00 	movabs $0x804981,%rcx
+  8003a6:	00 00 00 
+  8003a9:	48 b8 70 49 80 00 00 	movabs $0x804970,%rax
+  8003b0:	00 00 00 
+  8003b3:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003b7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003c0:	49 f7 f7             	div    %r15
+  8003c3:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003c7:	4c 89 ee             	mov    %r13,%rsi
+  8003ca:	41 ff d4             	call   *%r12
+}
+  8003cd:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003d1:	5b                   	pop    %rbx
+  8003d2:	41 5c                	pop    %r12
+  8003d4:	41 5d                	pop    %r13
+  8003d6:	41 5e                	pop    %r14
+  8003d8:	41 5f                	pop    %r15
+  8003da:	5d                   	pop    %rbp
+  8003db:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003dc:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003e5:	49 f7 f7             	div    %r15
+  8003e8:	48 83 ec 08          	sub    $0x8,%rsp
+  8003ec:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003f0:	52                   	push   %rdx
+  8003f1:	45 0f be c9          	movsbl %r9b,%r9d
+  8003f5:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003f9:	48 89 c2             	mov    %rax,%rdx
+  8003fc:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  800403:	00 00 00 
+  800406:	ff d0                	call   *%rax
+  800408:	48 83 c4 10          	add    $0x10,%rsp
+  80040c:	eb 8d                	jmp    80039b <print_num+0x43>
+
+000000000080040e <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80040e:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800412:	48 8b 06             	mov    (%rsi),%rax
+  800415:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800419:	73 0a                	jae    800425 <sprintputch+0x17>
+        *state->start++ = ch;
+  80041b:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80041f:	48 89 16             	mov    %rdx,(%rsi)
+  800422:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800425:	c3                   	ret
+
+0000000000800426 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800426:	55                   	push   %rbp
+  800427:	48 89 e5             	mov    %rsp,%rbp
+  80042a:	48 83 ec 50          	sub    $0x50,%rsp
+  80042e:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800432:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800436:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  80043a:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800441:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800445:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800449:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80044d:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800451:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800455:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  80045c:	00 00 00 
+  80045f:	ff d0                	call   *%rax
+}
+  800461:	c9                   	leave
+  800462:	c3                   	ret
+
+0000000000800463 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800463:	55                   	push   %rbp
+  800464:	48 89 e5             	mov    %rsp,%rbp
+  800467:	41 57                	push   %r15
+  800469:	41 56                	push   %r14
+  80046b:	41 55                	push   %r13
+  80046d:	41 54                	push   %r12
+  80046f:	53                   	push   %rbx
+  800470:	48 83 ec 38          	sub    $0x38,%rsp
+  800474:	49 89 fe             	mov    %rdi,%r14
+  800477:	49 89 f5             	mov    %rsi,%r13
+  80047a:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80047d:	48 8b 01             	mov    (%rcx),%rax
+  800480:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800484:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800488:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80048c:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800490:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800494:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800498:	0f b6 3b             	movzbl (%rbx),%edi
+  80049b:	40 80 ff 25          	cmp    $0x25,%dil
+  80049f:	74 18                	je     8004b9 <vprintfmt+0x56>
+            if (!ch) return;
+  8004a1:	40 84 ff             	test   %dil,%dil
+  8004a4:	0f 84 b1 06 00 00    	je     800b5b <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004aa:	40 0f b6 ff          	movzbl %dil,%edi
+  8004ae:	4c 89 ee             	mov    %r13,%rsi
+  8004b1:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004b4:	4c 89 e3             	mov    %r12,%rbx
+  8004b7:	eb db                	jmp    800494 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004b9:	be 00 00 00 00       	mov    $0x0,%esi
+  8004be:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004c2:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004c7:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004cd:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004d4:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d8:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004dd:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004e2:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004e5:	83 e8 23             	sub    $0x23,%eax
+  8004e8:	3c 57                	cmp    $0x57,%al
+  8004ea:	0f 87 51 06 00 00    	ja     800b41 <vprintfmt+0x6de>
+  8004f0:	0f b6 c0             	movzbl %al,%eax
+  8004f3:	48 b9 40 4b 80 00 00 	movabs $0x804b40,%rcx
+  8004fa:	00 00 00 
+  8004fd:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800500:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800503:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800507:	eb cf                	jmp    8004d8 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800509:	49 89 dc             	mov    %rbx,%r12
+  80050c:	be 01 00 00 00       	mov    $0x1,%esi
+  800511:	eb c5                	jmp    8004d8 <vprintfmt+0x75>
+            padc = ch;
+  800513:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800517:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  80051a:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80051d:	eb b9                	jmp    8004d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80051f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800522:	83 f8 2f             	cmp    $0x2f,%eax
+  800525:	77 24                	ja     80054b <vprintfmt+0xe8>
+  800527:	89 c1                	mov    %eax,%ecx
+  800529:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  80052d:	83 c0 08             	add    $0x8,%eax
+  800530:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800533:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800536:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800539:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80053d:	79 99                	jns    8004d8 <vprintfmt+0x75>
+                width = precision;
+  80053f:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800543:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800549:	eb 8d                	jmp    8004d8 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80054b:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  80054f:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800553:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800557:	eb da                	jmp    800533 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800559:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  80055e:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800562:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800568:	3c 39                	cmp    $0x39,%al
+  80056a:	77 1c                	ja     800588 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80056c:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800570:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800574:	0f b6 c0             	movzbl %al,%eax
+  800577:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80057c:	0f b6 03             	movzbl (%rbx),%eax
+  80057f:	3c 39                	cmp    $0x39,%al
+  800581:	76 e9                	jbe    80056c <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800583:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800586:	eb b1                	jmp    800539 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800588:	49 89 dc             	mov    %rbx,%r12
+  80058b:	eb ac                	jmp    800539 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80058d:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800590:	85 c9                	test   %ecx,%ecx
+  800592:	b8 00 00 00 00       	mov    $0x0,%eax
+  800597:	0f 49 c1             	cmovns %ecx,%eax
+  80059a:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80059d:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a0:	e9 33 ff ff ff       	jmp    8004d8 <vprintfmt+0x75>
+            lflag++;
+  8005a5:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005a8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005ab:	e9 28 ff ff ff       	jmp    8004d8 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005b0:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005b3:	83 f8 2f             	cmp    $0x2f,%eax
+  8005b6:	77 19                	ja     8005d1 <vprintfmt+0x16e>
+  8005b8:	89 c2                	mov    %eax,%edx
+  8005ba:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005be:	83 c0 08             	add    $0x8,%eax
+  8005c1:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005c4:	8b 3a                	mov    (%rdx),%edi
+  8005c6:	4c 89 ee             	mov    %r13,%rsi
+  8005c9:	41 ff d6             	call   *%r14
+            break;
+  8005cc:	e9 c3 fe ff ff       	jmp    800494 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005dd:	eb e5                	jmp    8005c4 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8005e5:	77 5a                	ja     800641 <vprintfmt+0x1de>
+  8005e7:	89 c2                	mov    %eax,%edx
+  8005e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005ed:	83 c0 08             	add    $0x8,%eax
+  8005f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005f3:	8b 02                	mov    (%rdx),%eax
+  8005f5:	89 c1                	mov    %eax,%ecx
+  8005f7:	f7 d9                	neg    %ecx
+  8005f9:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005fc:	83 f9 16             	cmp    $0x16,%ecx
+  8005ff:	7f 4e                	jg     80064f <vprintfmt+0x1ec>
+  800601:	48 63 c1             	movslq %ecx,%rax
+  800604:	48 ba 00 4e 80 00 00 	movabs $0x804e00,%rdx
+  80060b:	00 00 00 
+  80060e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800612:	48 85 c0             	test   %rax,%rax
+  800615:	74 38                	je     80064f <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800617:	48 89 c1             	mov    %rax,%rcx
+  80061a:	48 ba 19 50 80 00 00 	movabs $0x805019,%rdx
+  800621:	00 00 00 
+  800624:	4c 89 ee             	mov    %r13,%rsi
+  800627:	4c 89 f7             	mov    %r14,%rdi
+  80062a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80062f:	49 b8 26 04 80 00 00 	movabs $0x800426,%r8
+  800636:	00 00 00 
+  800639:	41 ff d0             	call   *%r8
+  80063c:	e9 53 fe ff ff       	jmp    800494 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800641:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800645:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800649:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80064d:	eb a4                	jmp    8005f3 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  80064f:	48 ba 99 49 80 00 00 	movabs $0x804999,%rdx
+  800656:	00 00 00 
+  800659:	4c 89 ee             	mov    %r13,%rsi
+  80065c:	4c 89 f7             	mov    %r14,%rdi
+  80065f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800664:	49 b8 26 04 80 00 00 	movabs $0x800426,%r8
+  80066b:	00 00 00 
+  80066e:	41 ff d0             	call   *%r8
+  800671:	e9 1e fe ff ff       	jmp    800494 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800676:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800679:	83 f8 2f             	cmp    $0x2f,%eax
+  80067c:	77 6c                	ja     8006ea <vprintfmt+0x287>
+  80067e:	89 c2                	mov    %eax,%edx
+  800680:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800684:	83 c0 08             	add    $0x8,%eax
+  800687:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80068a:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80068d:	48 85 d2             	test   %rdx,%rdx
+  800690:	48 b8 92 49 80 00 00 	movabs $0x804992,%rax
+  800697:	00 00 00 
+  80069a:	48 0f 45 c2          	cmovne %rdx,%rax
+  80069e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  8006a2:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8006a6:	7e 06                	jle    8006ae <vprintfmt+0x24b>
+  8006a8:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006ac:	75 4a                	jne    8006f8 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006ae:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006b2:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006b6:	0f b6 00             	movzbl (%rax),%eax
+  8006b9:	84 c0                	test   %al,%al
+  8006bb:	0f 85 9a 00 00 00    	jne    80075b <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006c1:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006c4:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006c8:	85 c0                	test   %eax,%eax
+  8006ca:	0f 8e c4 fd ff ff    	jle    800494 <vprintfmt+0x31>
+  8006d0:	4c 89 ee             	mov    %r13,%rsi
+  8006d3:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d8:	41 ff d6             	call   *%r14
+  8006db:	41 83 ec 01          	sub    $0x1,%r12d
+  8006df:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006e3:	75 eb                	jne    8006d0 <vprintfmt+0x26d>
+  8006e5:	e9 aa fd ff ff       	jmp    800494 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006ea:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006ee:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006f2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f6:	eb 92                	jmp    80068a <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006f8:	49 63 f7             	movslq %r15d,%rsi
+  8006fb:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006ff:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  800706:	00 00 00 
+  800709:	ff d0                	call   *%rax
+  80070b:	48 89 c2             	mov    %rax,%rdx
+  80070e:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800711:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  800713:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800716:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800719:	85 c0                	test   %eax,%eax
+  80071b:	7e 91                	jle    8006ae <vprintfmt+0x24b>
+  80071d:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  800722:	4c 89 ee             	mov    %r13,%rsi
+  800725:	44 89 e7             	mov    %r12d,%edi
+  800728:	41 ff d6             	call   *%r14
+  80072b:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80072f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800732:	83 f8 ff             	cmp    $0xffffffff,%eax
+  800735:	75 eb                	jne    800722 <vprintfmt+0x2bf>
+  800737:	e9 72 ff ff ff       	jmp    8006ae <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80073c:	0f b6 f8             	movzbl %al,%edi
+  80073f:	4c 89 ee             	mov    %r13,%rsi
+  800742:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  800745:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800749:	49 83 c4 01          	add    $0x1,%r12
+  80074d:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  800753:	84 c0                	test   %al,%al
+  800755:	0f 84 66 ff ff ff    	je     8006c1 <vprintfmt+0x25e>
+  80075b:	45 85 ff             	test   %r15d,%r15d
+  80075e:	78 0a                	js     80076a <vprintfmt+0x307>
+  800760:	41 83 ef 01          	sub    $0x1,%r15d
+  800764:	0f 88 57 ff ff ff    	js     8006c1 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80076a:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80076e:	74 cc                	je     80073c <vprintfmt+0x2d9>
+  800770:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800773:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800778:	80 fa 5e             	cmp    $0x5e,%dl
+  80077b:	77 c2                	ja     80073f <vprintfmt+0x2dc>
+  80077d:	eb bd                	jmp    80073c <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80077f:	40 84 f6             	test   %sil,%sil
+  800782:	75 26                	jne    8007aa <vprintfmt+0x347>
+    switch (lflag) {
+  800784:	85 d2                	test   %edx,%edx
+  800786:	74 59                	je     8007e1 <vprintfmt+0x37e>
+  800788:	83 fa 01             	cmp    $0x1,%edx
+  80078b:	74 7b                	je     800808 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80078d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800790:	83 f8 2f             	cmp    $0x2f,%eax
+  800793:	0f 87 96 00 00 00    	ja     80082f <vprintfmt+0x3cc>
+  800799:	89 c2                	mov    %eax,%edx
+  80079b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80079f:	83 c0 08             	add    $0x8,%eax
+  8007a2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007a5:	4c 8b 22             	mov    (%rdx),%r12
+  8007a8:	eb 17                	jmp    8007c1 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007aa:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007ad:	83 f8 2f             	cmp    $0x2f,%eax
+  8007b0:	77 21                	ja     8007d3 <vprintfmt+0x370>
+  8007b2:	89 c2                	mov    %eax,%edx
+  8007b4:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b8:	83 c0 08             	add    $0x8,%eax
+  8007bb:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007be:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007c1:	4d 85 e4             	test   %r12,%r12
+  8007c4:	78 7a                	js     800840 <vprintfmt+0x3dd>
+            num = i;
+  8007c6:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007c9:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007ce:	e9 50 02 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007d3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007d7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007db:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007df:	eb dd                	jmp    8007be <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007e1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007e4:	83 f8 2f             	cmp    $0x2f,%eax
+  8007e7:	77 11                	ja     8007fa <vprintfmt+0x397>
+  8007e9:	89 c2                	mov    %eax,%edx
+  8007eb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007ef:	83 c0 08             	add    $0x8,%eax
+  8007f2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007f5:	4c 63 22             	movslq (%rdx),%r12
+  8007f8:	eb c7                	jmp    8007c1 <vprintfmt+0x35e>
+  8007fa:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007fe:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800802:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800806:	eb ed                	jmp    8007f5 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800808:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80080b:	83 f8 2f             	cmp    $0x2f,%eax
+  80080e:	77 11                	ja     800821 <vprintfmt+0x3be>
+  800810:	89 c2                	mov    %eax,%edx
+  800812:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800816:	83 c0 08             	add    $0x8,%eax
+  800819:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80081c:	4c 8b 22             	mov    (%rdx),%r12
+  80081f:	eb a0                	jmp    8007c1 <vprintfmt+0x35e>
+  800821:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800825:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800829:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80082d:	eb ed                	jmp    80081c <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  80082f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800833:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800837:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80083b:	e9 65 ff ff ff       	jmp    8007a5 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800840:	4c 89 ee             	mov    %r13,%rsi
+  800843:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800848:	41 ff d6             	call   *%r14
+                i = -i;
+  80084b:	49 f7 dc             	neg    %r12
+  80084e:	e9 73 ff ff ff       	jmp    8007c6 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800853:	40 84 f6             	test   %sil,%sil
+  800856:	75 32                	jne    80088a <vprintfmt+0x427>
+    switch (lflag) {
+  800858:	85 d2                	test   %edx,%edx
+  80085a:	74 5d                	je     8008b9 <vprintfmt+0x456>
+  80085c:	83 fa 01             	cmp    $0x1,%edx
+  80085f:	0f 84 82 00 00 00    	je     8008e7 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800865:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800868:	83 f8 2f             	cmp    $0x2f,%eax
+  80086b:	0f 87 a5 00 00 00    	ja     800916 <vprintfmt+0x4b3>
+  800871:	89 c2                	mov    %eax,%edx
+  800873:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800877:	83 c0 08             	add    $0x8,%eax
+  80087a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80087d:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800880:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800885:	e9 99 01 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80088a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80088d:	83 f8 2f             	cmp    $0x2f,%eax
+  800890:	77 19                	ja     8008ab <vprintfmt+0x448>
+  800892:	89 c2                	mov    %eax,%edx
+  800894:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800898:	83 c0 08             	add    $0x8,%eax
+  80089b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80089e:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008a1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  8008a6:	e9 78 01 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+  8008ab:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008af:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b7:	eb e5                	jmp    80089e <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008b9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008bc:	83 f8 2f             	cmp    $0x2f,%eax
+  8008bf:	77 18                	ja     8008d9 <vprintfmt+0x476>
+  8008c1:	89 c2                	mov    %eax,%edx
+  8008c3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008c7:	83 c0 08             	add    $0x8,%eax
+  8008ca:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008cd:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008cf:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008d4:	e9 4a 01 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+  8008d9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008dd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008e1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008e5:	eb e6                	jmp    8008cd <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008e7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008ea:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ed:	77 19                	ja     800908 <vprintfmt+0x4a5>
+  8008ef:	89 c2                	mov    %eax,%edx
+  8008f1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f5:	83 c0 08             	add    $0x8,%eax
+  8008f8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008fb:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008fe:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800903:	e9 1b 01 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+  800908:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80090c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800910:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800914:	eb e5                	jmp    8008fb <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800916:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80091a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80091e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800922:	e9 56 ff ff ff       	jmp    80087d <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800927:	40 84 f6             	test   %sil,%sil
+  80092a:	75 2e                	jne    80095a <vprintfmt+0x4f7>
+    switch (lflag) {
+  80092c:	85 d2                	test   %edx,%edx
+  80092e:	74 59                	je     800989 <vprintfmt+0x526>
+  800930:	83 fa 01             	cmp    $0x1,%edx
+  800933:	74 7f                	je     8009b4 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800935:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800938:	83 f8 2f             	cmp    $0x2f,%eax
+  80093b:	0f 87 9f 00 00 00    	ja     8009e0 <vprintfmt+0x57d>
+  800941:	89 c2                	mov    %eax,%edx
+  800943:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800947:	83 c0 08             	add    $0x8,%eax
+  80094a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80094d:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800950:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800955:	e9 c9 00 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80095a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095d:	83 f8 2f             	cmp    $0x2f,%eax
+  800960:	77 19                	ja     80097b <vprintfmt+0x518>
+  800962:	89 c2                	mov    %eax,%edx
+  800964:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800968:	83 c0 08             	add    $0x8,%eax
+  80096b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800971:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800976:	e9 a8 00 00 00       	jmp    800a23 <vprintfmt+0x5c0>
+  80097b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800983:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800987:	eb e5                	jmp    80096e <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800989:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80098c:	83 f8 2f             	cmp    $0x2f,%eax
+  80098f:	77 15                	ja     8009a6 <vprintfmt+0x543>
+  800991:	89 c2                	mov    %eax,%edx
+  800993:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800997:	83 c0 08             	add    $0x8,%eax
+  80099a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80099d:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  80099f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  8009a4:	eb 7d                	jmp    800a23 <vprintfmt+0x5c0>
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb e9                	jmp    80099d <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009b4:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009b7:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ba:	77 16                	ja     8009d2 <vprintfmt+0x56f>
+  8009bc:	89 c2                	mov    %eax,%edx
+  8009be:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009c2:	83 c0 08             	add    $0x8,%eax
+  8009c5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009cb:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009d0:	eb 51                	jmp    800a23 <vprintfmt+0x5c0>
+  8009d2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009d6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009da:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009de:	eb e8                	jmp    8009c8 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009e0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009e4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009ec:	e9 5c ff ff ff       	jmp    80094d <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009f1:	4c 89 ee             	mov    %r13,%rsi
+  8009f4:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009f9:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009fc:	4c 89 ee             	mov    %r13,%rsi
+  8009ff:	bf 78 00 00 00       	mov    $0x78,%edi
+  800a04:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800a07:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a0a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a0d:	77 47                	ja     800a56 <vprintfmt+0x5f3>
+  800a0f:	89 c2                	mov    %eax,%edx
+  800a11:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a15:	83 c0 08             	add    $0x8,%eax
+  800a18:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a1b:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a1e:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a23:	48 83 ec 08          	sub    $0x8,%rsp
+  800a27:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a2b:	0f 94 c0             	sete   %al
+  800a2e:	0f b6 c0             	movzbl %al,%eax
+  800a31:	50                   	push   %rax
+  800a32:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a37:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a3b:	4c 89 ee             	mov    %r13,%rsi
+  800a3e:	4c 89 f7             	mov    %r14,%rdi
+  800a41:	48 b8 58 03 80 00 00 	movabs $0x800358,%rax
+  800a48:	00 00 00 
+  800a4b:	ff d0                	call   *%rax
+            break;
+  800a4d:	48 83 c4 10          	add    $0x10,%rsp
+  800a51:	e9 3e fa ff ff       	jmp    800494 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a56:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a5a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a5e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a62:	eb b7                	jmp    800a1b <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a64:	40 84 f6             	test   %sil,%sil
+  800a67:	75 2b                	jne    800a94 <vprintfmt+0x631>
+    switch (lflag) {
+  800a69:	85 d2                	test   %edx,%edx
+  800a6b:	74 56                	je     800ac3 <vprintfmt+0x660>
+  800a6d:	83 fa 01             	cmp    $0x1,%edx
+  800a70:	74 7f                	je     800af1 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a72:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a75:	83 f8 2f             	cmp    $0x2f,%eax
+  800a78:	0f 87 a2 00 00 00    	ja     800b20 <vprintfmt+0x6bd>
+  800a7e:	89 c2                	mov    %eax,%edx
+  800a80:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a84:	83 c0 08             	add    $0x8,%eax
+  800a87:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a8a:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a8d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a92:	eb 8f                	jmp    800a23 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a94:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a97:	83 f8 2f             	cmp    $0x2f,%eax
+  800a9a:	77 19                	ja     800ab5 <vprintfmt+0x652>
+  800a9c:	89 c2                	mov    %eax,%edx
+  800a9e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aa2:	83 c0 08             	add    $0x8,%eax
+  800aa5:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa8:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aab:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800ab0:	e9 6e ff ff ff       	jmp    800a23 <vprintfmt+0x5c0>
+  800ab5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800abd:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ac1:	eb e5                	jmp    800aa8 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800ac3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ac6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac9:	77 18                	ja     800ae3 <vprintfmt+0x680>
+  800acb:	89 c2                	mov    %eax,%edx
+  800acd:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ad1:	83 c0 08             	add    $0x8,%eax
+  800ad4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ad7:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ad9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ade:	e9 40 ff ff ff       	jmp    800a23 <vprintfmt+0x5c0>
+  800ae3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ae7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aeb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aef:	eb e6                	jmp    800ad7 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800af1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af4:	83 f8 2f             	cmp    $0x2f,%eax
+  800af7:	77 19                	ja     800b12 <vprintfmt+0x6af>
+  800af9:	89 c2                	mov    %eax,%edx
+  800afb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800aff:	83 c0 08             	add    $0x8,%eax
+  800b02:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b05:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b08:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b0d:	e9 11 ff ff ff       	jmp    800a23 <vprintfmt+0x5c0>
+  800b12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b1e:	eb e5                	jmp    800b05 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b20:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b24:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b28:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b2c:	e9 59 ff ff ff       	jmp    800a8a <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b31:	4c 89 ee             	mov    %r13,%rsi
+  800b34:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b39:	41 ff d6             	call   *%r14
+            break;
+  800b3c:	e9 53 f9 ff ff       	jmp    800494 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b41:	4c 89 ee             	mov    %r13,%rsi
+  800b44:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b49:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b4c:	48 83 eb 01          	sub    $0x1,%rbx
+  800b50:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b54:	75 f6                	jne    800b4c <vprintfmt+0x6e9>
+  800b56:	e9 39 f9 ff ff       	jmp    800494 <vprintfmt+0x31>
+}
+  800b5b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b5f:	5b                   	pop    %rbx
+  800b60:	41 5c                	pop    %r12
+  800b62:	41 5d                	pop    %r13
+  800b64:	41 5e                	pop    %r14
+  800b66:	41 5f                	pop    %r15
+  800b68:	5d                   	pop    %rbp
+  800b69:	c3                   	ret
+
+0000000000800b6a <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b6a:	55                   	push   %rbp
+  800b6b:	48 89 e5             	mov    %rsp,%rbp
+  800b6e:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b72:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b76:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b7b:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b7f:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b86:	48 85 ff             	test   %rdi,%rdi
+  800b89:	74 2b                	je     800bb6 <vsnprintf+0x4c>
+  800b8b:	48 85 f6             	test   %rsi,%rsi
+  800b8e:	74 26                	je     800bb6 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b90:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b94:	48 bf 0e 04 80 00 00 	movabs $0x80040e,%rdi
+  800b9b:	00 00 00 
+  800b9e:	48 b8 63 04 80 00 00 	movabs $0x800463,%rax
+  800ba5:	00 00 00 
+  800ba8:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800baa:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800bae:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800bb1:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bb4:	c9                   	leave
+  800bb5:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bb6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bbb:	eb f7                	jmp    800bb4 <vsnprintf+0x4a>
+
+0000000000800bbd <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bbd:	55                   	push   %rbp
+  800bbe:	48 89 e5             	mov    %rsp,%rbp
+  800bc1:	48 83 ec 50          	sub    $0x50,%rsp
+  800bc5:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bc9:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bcd:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bd1:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bd8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bdc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800be0:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800be4:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800be8:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800bec:	48 b8 6a 0b 80 00 00 	movabs $0x800b6a,%rax
+  800bf3:	00 00 00 
+  800bf6:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bf8:	c9                   	leave
+  800bf9:	c3                   	ret
+
+0000000000800bfa <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bfa:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bfd:	74 10                	je     800c0f <strlen+0x15>
+    size_t n = 0;
+  800bff:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800c04:	48 83 c0 01          	add    $0x1,%rax
+  800c08:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c0c:	75 f6                	jne    800c04 <strlen+0xa>
+  800c0e:	c3                   	ret
+    size_t n = 0;
+  800c0f:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c14:	c3                   	ret
+
+0000000000800c15 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c15:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c18:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c1d:	48 85 f6             	test   %rsi,%rsi
+  800c20:	74 11                	je     800c33 <strnlen+0x1e>
+  800c22:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c26:	74 0c                	je     800c34 <strnlen+0x1f>
+  800c28:	48 83 c2 01          	add    $0x1,%rdx
+  800c2c:	48 39 d0             	cmp    %rdx,%rax
+  800c2f:	75 f1                	jne    800c22 <strnlen+0xd>
+  800c31:	eb 04                	jmp    800c37 <strnlen+0x22>
+  800c33:	c3                   	ret
+  800c34:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c37:	c3                   	ret
+
+0000000000800c38 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c38:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c3b:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c40:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c44:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c47:	48 83 c2 01          	add    $0x1,%rdx
+  800c4b:	84 c9                	test   %cl,%cl
+  800c4d:	75 f1                	jne    800c40 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c4f:	c3                   	ret
+
+0000000000800c50 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c50:	55                   	push   %rbp
+  800c51:	48 89 e5             	mov    %rsp,%rbp
+  800c54:	41 54                	push   %r12
+  800c56:	53                   	push   %rbx
+  800c57:	48 89 fb             	mov    %rdi,%rbx
+  800c5a:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c5d:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  800c64:	00 00 00 
+  800c67:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c69:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c6d:	4c 89 e6             	mov    %r12,%rsi
+  800c70:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  800c77:	00 00 00 
+  800c7a:	ff d0                	call   *%rax
+    return dst;
+}
+  800c7c:	48 89 d8             	mov    %rbx,%rax
+  800c7f:	5b                   	pop    %rbx
+  800c80:	41 5c                	pop    %r12
+  800c82:	5d                   	pop    %rbp
+  800c83:	c3                   	ret
+
+0000000000800c84 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c84:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c87:	48 85 d2             	test   %rdx,%rdx
+  800c8a:	74 1f                	je     800cab <strncpy+0x27>
+  800c8c:	48 01 fa             	add    %rdi,%rdx
+  800c8f:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c92:	48 83 c1 01          	add    $0x1,%rcx
+  800c96:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c9a:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c9e:	41 80 f8 01          	cmp    $0x1,%r8b
+  800ca2:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800ca6:	48 39 ca             	cmp    %rcx,%rdx
+  800ca9:	75 e7                	jne    800c92 <strncpy+0xe>
+    }
+    return ret;
+}
+  800cab:	c3                   	ret
+
+0000000000800cac <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800cac:	48 89 f8             	mov    %rdi,%rax
+  800caf:	48 85 d2             	test   %rdx,%rdx
+  800cb2:	74 24                	je     800cd8 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cb4:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb8:	74 1b                	je     800cd5 <strlcpy+0x29>
+  800cba:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cbe:	0f b6 16             	movzbl (%rsi),%edx
+  800cc1:	84 d2                	test   %dl,%dl
+  800cc3:	74 10                	je     800cd5 <strlcpy+0x29>
+            *dst++ = *src++;
+  800cc5:	48 83 c6 01          	add    $0x1,%rsi
+  800cc9:	48 83 c0 01          	add    $0x1,%rax
+  800ccd:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cd0:	48 39 c8             	cmp    %rcx,%rax
+  800cd3:	75 e9                	jne    800cbe <strlcpy+0x12>
+        *dst = '\0';
+  800cd5:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cd8:	48 29 f8             	sub    %rdi,%rax
+}
+  800cdb:	c3                   	ret
+
+0000000000800cdc <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cdc:	0f b6 07             	movzbl (%rdi),%eax
+  800cdf:	84 c0                	test   %al,%al
+  800ce1:	74 13                	je     800cf6 <strcmp+0x1a>
+  800ce3:	38 06                	cmp    %al,(%rsi)
+  800ce5:	75 0f                	jne    800cf6 <strcmp+0x1a>
+  800ce7:	48 83 c7 01          	add    $0x1,%rdi
+  800ceb:	48 83 c6 01          	add    $0x1,%rsi
+  800cef:	0f b6 07             	movzbl (%rdi),%eax
+  800cf2:	84 c0                	test   %al,%al
+  800cf4:	75 ed                	jne    800ce3 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cf6:	0f b6 c0             	movzbl %al,%eax
+  800cf9:	0f b6 16             	movzbl (%rsi),%edx
+  800cfc:	29 d0                	sub    %edx,%eax
+}
+  800cfe:	c3                   	ret
+
+0000000000800cff <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cff:	48 85 d2             	test   %rdx,%rdx
+  800d02:	74 1f                	je     800d23 <strncmp+0x24>
+  800d04:	0f b6 07             	movzbl (%rdi),%eax
+  800d07:	84 c0                	test   %al,%al
+  800d09:	74 1e                	je     800d29 <strncmp+0x2a>
+  800d0b:	3a 06                	cmp    (%rsi),%al
+  800d0d:	75 1a                	jne    800d29 <strncmp+0x2a>
+  800d0f:	48 83 c7 01          	add    $0x1,%rdi
+  800d13:	48 83 c6 01          	add    $0x1,%rsi
+  800d17:	48 83 ea 01          	sub    $0x1,%rdx
+  800d1b:	75 e7                	jne    800d04 <strncmp+0x5>
+
+    if (!n) return 0;
+  800d1d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d22:	c3                   	ret
+  800d23:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d28:	c3                   	ret
+  800d29:	48 85 d2             	test   %rdx,%rdx
+  800d2c:	74 09                	je     800d37 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d2e:	0f b6 07             	movzbl (%rdi),%eax
+  800d31:	0f b6 16             	movzbl (%rsi),%edx
+  800d34:	29 d0                	sub    %edx,%eax
+  800d36:	c3                   	ret
+    if (!n) return 0;
+  800d37:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d3c:	c3                   	ret
+
+0000000000800d3d <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d3d:	0f b6 17             	movzbl (%rdi),%edx
+  800d40:	84 d2                	test   %dl,%dl
+  800d42:	74 18                	je     800d5c <strchr+0x1f>
+        if (*str == c) {
+  800d44:	0f be d2             	movsbl %dl,%edx
+  800d47:	39 f2                	cmp    %esi,%edx
+  800d49:	74 17                	je     800d62 <strchr+0x25>
+    for (; *str; str++) {
+  800d4b:	48 83 c7 01          	add    $0x1,%rdi
+  800d4f:	0f b6 17             	movzbl (%rdi),%edx
+  800d52:	84 d2                	test   %dl,%dl
+  800d54:	75 ee                	jne    800d44 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d5b:	c3                   	ret
+  800d5c:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d61:	c3                   	ret
+  800d62:	48 89 f8             	mov    %rdi,%rax
+}
+  800d65:	c3                   	ret
+
+0000000000800d66 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d66:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d69:	0f b6 17             	movzbl (%rdi),%edx
+  800d6c:	84 d2                	test   %dl,%dl
+  800d6e:	74 13                	je     800d83 <strfind+0x1d>
+  800d70:	0f be d2             	movsbl %dl,%edx
+  800d73:	39 f2                	cmp    %esi,%edx
+  800d75:	74 0b                	je     800d82 <strfind+0x1c>
+  800d77:	48 83 c0 01          	add    $0x1,%rax
+  800d7b:	0f b6 10             	movzbl (%rax),%edx
+  800d7e:	84 d2                	test   %dl,%dl
+  800d80:	75 ee                	jne    800d70 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d82:	c3                   	ret
+  800d83:	c3                   	ret
+
+0000000000800d84 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d84:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d87:	48 89 f8             	mov    %rdi,%rax
+  800d8a:	48 f7 d8             	neg    %rax
+  800d8d:	83 e0 07             	and    $0x7,%eax
+  800d90:	49 89 d1             	mov    %rdx,%r9
+  800d93:	49 29 c1             	sub    %rax,%r9
+  800d96:	78 36                	js     800dce <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d98:	40 0f b6 c6          	movzbl %sil,%eax
+  800d9c:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800da3:	01 01 01 
+  800da6:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800daa:	40 f6 c7 07          	test   $0x7,%dil
+  800dae:	75 38                	jne    800de8 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800db0:	4c 89 c9             	mov    %r9,%rcx
+  800db3:	48 c1 f9 03          	sar    $0x3,%rcx
+  800db7:	74 0c                	je     800dc5 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800db9:	fc                   	cld
+  800dba:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800dbd:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800dc1:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dc5:	4d 85 c9             	test   %r9,%r9
+  800dc8:	75 45                	jne    800e0f <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dca:	4c 89 c0             	mov    %r8,%rax
+  800dcd:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dce:	48 85 d2             	test   %rdx,%rdx
+  800dd1:	74 f7                	je     800dca <memset+0x46>
+  800dd3:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dd6:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dd9:	48 83 c0 01          	add    $0x1,%rax
+  800ddd:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800de1:	48 39 c2             	cmp    %rax,%rdx
+  800de4:	75 f3                	jne    800dd9 <memset+0x55>
+  800de6:	eb e2                	jmp    800dca <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800de8:	40 f6 c7 01          	test   $0x1,%dil
+  800dec:	74 06                	je     800df4 <memset+0x70>
+  800dee:	88 07                	mov    %al,(%rdi)
+  800df0:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800df4:	40 f6 c7 02          	test   $0x2,%dil
+  800df8:	74 07                	je     800e01 <memset+0x7d>
+  800dfa:	66 89 07             	mov    %ax,(%rdi)
+  800dfd:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e01:	40 f6 c7 04          	test   $0x4,%dil
+  800e05:	74 a9                	je     800db0 <memset+0x2c>
+  800e07:	89 07                	mov    %eax,(%rdi)
+  800e09:	48 83 c7 04          	add    $0x4,%rdi
+  800e0d:	eb a1                	jmp    800db0 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e0f:	41 f6 c1 04          	test   $0x4,%r9b
+  800e13:	74 06                	je     800e1b <memset+0x97>
+  800e15:	89 07                	mov    %eax,(%rdi)
+  800e17:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e1b:	41 f6 c1 02          	test   $0x2,%r9b
+  800e1f:	74 07                	je     800e28 <memset+0xa4>
+  800e21:	66 89 07             	mov    %ax,(%rdi)
+  800e24:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e28:	41 f6 c1 01          	test   $0x1,%r9b
+  800e2c:	74 9c                	je     800dca <memset+0x46>
+  800e2e:	88 07                	mov    %al,(%rdi)
+  800e30:	eb 98                	jmp    800dca <memset+0x46>
+
+0000000000800e32 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e32:	48 89 f8             	mov    %rdi,%rax
+  800e35:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e38:	48 39 fe             	cmp    %rdi,%rsi
+  800e3b:	73 3b                	jae    800e78 <memmove+0x46>
+  800e3d:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e41:	48 39 d7             	cmp    %rdx,%rdi
+  800e44:	73 32                	jae    800e78 <memmove+0x46>
+        s += n;
+        d += n;
+  800e46:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e4a:	48 89 d6             	mov    %rdx,%rsi
+  800e4d:	48 09 fe             	or     %rdi,%rsi
+  800e50:	48 09 ce             	or     %rcx,%rsi
+  800e53:	40 f6 c6 07          	test   $0x7,%sil
+  800e57:	75 12                	jne    800e6b <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e59:	48 83 ef 08          	sub    $0x8,%rdi
+  800e5d:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e61:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e65:	fd                   	std
+  800e66:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e69:	fc                   	cld
+  800e6a:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e6b:	48 83 ef 01          	sub    $0x1,%rdi
+  800e6f:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e73:	fd                   	std
+  800e74:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e76:	eb f1                	jmp    800e69 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e78:	48 89 f2             	mov    %rsi,%rdx
+  800e7b:	48 09 c2             	or     %rax,%rdx
+  800e7e:	48 09 ca             	or     %rcx,%rdx
+  800e81:	f6 c2 07             	test   $0x7,%dl
+  800e84:	75 0c                	jne    800e92 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e86:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e8a:	48 89 c7             	mov    %rax,%rdi
+  800e8d:	fc                   	cld
+  800e8e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e91:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e92:	48 89 c7             	mov    %rax,%rdi
+  800e95:	fc                   	cld
+  800e96:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e98:	c3                   	ret
+
+0000000000800e99 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e99:	55                   	push   %rbp
+  800e9a:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e9d:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  800ea4:	00 00 00 
+  800ea7:	ff d0                	call   *%rax
+}
+  800ea9:	5d                   	pop    %rbp
+  800eaa:	c3                   	ret
+
+0000000000800eab <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800eab:	55                   	push   %rbp
+  800eac:	48 89 e5             	mov    %rsp,%rbp
+  800eaf:	41 57                	push   %r15
+  800eb1:	41 56                	push   %r14
+  800eb3:	41 55                	push   %r13
+  800eb5:	41 54                	push   %r12
+  800eb7:	53                   	push   %rbx
+  800eb8:	48 83 ec 08          	sub    $0x8,%rsp
+  800ebc:	49 89 fe             	mov    %rdi,%r14
+  800ebf:	49 89 f7             	mov    %rsi,%r15
+  800ec2:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ec5:	48 89 f7             	mov    %rsi,%rdi
+  800ec8:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  800ecf:	00 00 00 
+  800ed2:	ff d0                	call   *%rax
+  800ed4:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ed7:	48 89 de             	mov    %rbx,%rsi
+  800eda:	4c 89 f7             	mov    %r14,%rdi
+  800edd:	48 b8 15 0c 80 00 00 	movabs $0x800c15,%rax
+  800ee4:	00 00 00 
+  800ee7:	ff d0                	call   *%rax
+  800ee9:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800eec:	48 39 c3             	cmp    %rax,%rbx
+  800eef:	74 36                	je     800f27 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ef1:	48 89 d8             	mov    %rbx,%rax
+  800ef4:	4c 29 e8             	sub    %r13,%rax
+  800ef7:	49 39 c4             	cmp    %rax,%r12
+  800efa:	73 31                	jae    800f2d <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800efc:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f01:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f05:	4c 89 fe             	mov    %r15,%rsi
+  800f08:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  800f0f:	00 00 00 
+  800f12:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f14:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f18:	48 83 c4 08          	add    $0x8,%rsp
+  800f1c:	5b                   	pop    %rbx
+  800f1d:	41 5c                	pop    %r12
+  800f1f:	41 5d                	pop    %r13
+  800f21:	41 5e                	pop    %r14
+  800f23:	41 5f                	pop    %r15
+  800f25:	5d                   	pop    %rbp
+  800f26:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f27:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f2b:	eb eb                	jmp    800f18 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f2d:	48 83 eb 01          	sub    $0x1,%rbx
+  800f31:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f35:	48 89 da             	mov    %rbx,%rdx
+  800f38:	4c 89 fe             	mov    %r15,%rsi
+  800f3b:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  800f42:	00 00 00 
+  800f45:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f47:	49 01 de             	add    %rbx,%r14
+  800f4a:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f4f:	eb c3                	jmp    800f14 <strlcat+0x69>
+
+0000000000800f51 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f51:	48 85 d2             	test   %rdx,%rdx
+  800f54:	74 2d                	je     800f83 <memcmp+0x32>
+  800f56:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f5b:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f5f:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f64:	44 38 c1             	cmp    %r8b,%cl
+  800f67:	75 0f                	jne    800f78 <memcmp+0x27>
+    while (n-- > 0) {
+  800f69:	48 83 c0 01          	add    $0x1,%rax
+  800f6d:	48 39 c2             	cmp    %rax,%rdx
+  800f70:	75 e9                	jne    800f5b <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f72:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f77:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f78:	0f b6 c1             	movzbl %cl,%eax
+  800f7b:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f7f:	44 29 c0             	sub    %r8d,%eax
+  800f82:	c3                   	ret
+    return 0;
+  800f83:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f88:	c3                   	ret
+
+0000000000800f89 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f89:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f8d:	48 39 c7             	cmp    %rax,%rdi
+  800f90:	73 0f                	jae    800fa1 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f92:	40 38 37             	cmp    %sil,(%rdi)
+  800f95:	74 0e                	je     800fa5 <memfind+0x1c>
+    for (; src < end; src++) {
+  800f97:	48 83 c7 01          	add    $0x1,%rdi
+  800f9b:	48 39 f8             	cmp    %rdi,%rax
+  800f9e:	75 f2                	jne    800f92 <memfind+0x9>
+  800fa0:	c3                   	ret
+  800fa1:	48 89 f8             	mov    %rdi,%rax
+  800fa4:	c3                   	ret
+  800fa5:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fa9:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fac:	0f b6 37             	movzbl (%rdi),%esi
+  800faf:	40 80 fe 20          	cmp    $0x20,%sil
+  800fb3:	74 06                	je     800fbb <strtol+0x12>
+  800fb5:	40 80 fe 09          	cmp    $0x9,%sil
+  800fb9:	75 13                	jne    800fce <strtol+0x25>
+  800fbb:	48 83 c7 01          	add    $0x1,%rdi
+  800fbf:	0f b6 37             	movzbl (%rdi),%esi
+  800fc2:	40 80 fe 20          	cmp    $0x20,%sil
+  800fc6:	74 f3                	je     800fbb <strtol+0x12>
+  800fc8:	40 80 fe 09          	cmp    $0x9,%sil
+  800fcc:	74 ed                	je     800fbb <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fce:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fd1:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fd4:	3c 01                	cmp    $0x1,%al
+  800fd6:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fda:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fe0:	75 0f                	jne    800ff1 <strtol+0x48>
+  800fe2:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fe5:	74 14                	je     800ffb <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fe7:	85 d2                	test   %edx,%edx
+  800fe9:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fee:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800ff1:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800ff6:	4c 63 ca             	movslq %edx,%r9
+  800ff9:	eb 36                	jmp    801031 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ffb:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800fff:	74 0f                	je     801010 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  801001:	85 d2                	test   %edx,%edx
+  801003:	75 ec                	jne    800ff1 <strtol+0x48>
+        s++;
+  801005:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801009:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80100e:	eb e1                	jmp    800ff1 <strtol+0x48>
+        s += 2;
+  801010:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801014:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801019:	eb d6                	jmp    800ff1 <strtol+0x48>
+            dig -= '0';
+  80101b:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80101e:	44 0f b6 c1          	movzbl %cl,%r8d
+  801022:	41 39 d0             	cmp    %edx,%r8d
+  801025:	7d 21                	jge    801048 <strtol+0x9f>
+        val = val * base + dig;
+  801027:	49 0f af c1          	imul   %r9,%rax
+  80102b:	0f b6 c9             	movzbl %cl,%ecx
+  80102e:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801031:	48 83 c7 01          	add    $0x1,%rdi
+  801035:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801039:	80 f9 39             	cmp    $0x39,%cl
+  80103c:	76 dd                	jbe    80101b <strtol+0x72>
+        else if (dig - 'a' < 27)
+  80103e:	80 f9 7b             	cmp    $0x7b,%cl
+  801041:	77 05                	ja     801048 <strtol+0x9f>
+            dig -= 'a' - 10;
+  801043:	83 e9 57             	sub    $0x57,%ecx
+  801046:	eb d6                	jmp    80101e <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801048:	4d 85 d2             	test   %r10,%r10
+  80104b:	74 03                	je     801050 <strtol+0xa7>
+  80104d:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801050:	48 89 c2             	mov    %rax,%rdx
+  801053:	48 f7 da             	neg    %rdx
+  801056:	40 80 fe 2d          	cmp    $0x2d,%sil
+  80105a:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  80105e:	c3                   	ret
+
+000000000080105f <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  80105f:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801064:	ba 00 00 00 00       	mov    $0x0,%edx
+  801069:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80106f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801075:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  80107b:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80107d:	c3                   	ret
+
+000000000080107e <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80107e:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801083:	bf 00 00 00 00       	mov    $0x0,%edi
+  801088:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80108d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801092:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801098:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80109e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010a4:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  8010a6:	c3                   	ret
+
+00000000008010a7 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  8010a7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010aa:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010af:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b9:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010c5:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010cb:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010cd:	48 85 c0             	test   %rax,%rax
+  8010d0:	7f 01                	jg     8010d3 <sys_env_destroy+0x2c>
+}
+  8010d2:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8010d3:	55                   	push   %rbp
+  8010d4:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010d7:	49 89 c0             	mov    %rax,%r8
+  8010da:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010df:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  8010e6:	00 00 00 
+  8010e9:	be 29 00 00 00       	mov    $0x29,%esi
+  8010ee:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  8010f5:	00 00 00 
+  8010f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010fd:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  801104:	00 00 00 
+  801107:	41 ff d1             	call   *%r9
+
+000000000080110a <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  80110a:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80110f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801114:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801119:	ba 00 00 00 00       	mov    $0x0,%edx
+  80111e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801124:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80112a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801130:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801132:	c3                   	ret
+
+0000000000801133 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801133:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801138:	bf 00 00 00 00       	mov    $0x0,%edi
+  80113d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801142:	ba 00 00 00 00       	mov    $0x0,%edx
+  801147:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80114d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801153:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801159:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  80115b:	c3                   	ret
+
+000000000080115c <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  80115c:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801161:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801168:	00 00 00 
+  80116b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801171:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801177:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80117d:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80117f:	c3                   	ret
+
+0000000000801180 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801180:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801183:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801188:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80118e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801194:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801196:	c3                   	ret
+
+0000000000801197 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801197:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80119a:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80119f:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ae:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011b0:	48 85 c0             	test   %rax,%rax
+  8011b3:	7f 01                	jg     8011b6 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011b5:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011b6:	55                   	push   %rbp
+  8011b7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011ba:	49 89 c0             	mov    %rax,%r8
+  8011bd:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011c2:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  8011c9:	00 00 00 
+  8011cc:	be 29 00 00 00       	mov    $0x29,%esi
+  8011d1:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  8011d8:	00 00 00 
+  8011db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e0:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  8011e7:	00 00 00 
+  8011ea:	41 ff d1             	call   *%r9
+
+00000000008011ed <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011ed:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011f0:	48 63 d2             	movslq %edx,%rdx
+  8011f3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011f6:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011fb:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011fe:	0f 05                	syscall
+    if (check && ret > 0) {
+  801200:	48 85 c0             	test   %rax,%rax
+  801203:	7f 01                	jg     801206 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801205:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801206:	55                   	push   %rbp
+  801207:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80120a:	49 89 c0             	mov    %rax,%r8
+  80120d:	b9 05 00 00 00       	mov    $0x5,%ecx
+  801212:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  801219:	00 00 00 
+  80121c:	be 29 00 00 00       	mov    $0x29,%esi
+  801221:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  801228:	00 00 00 
+  80122b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801230:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  801237:	00 00 00 
+  80123a:	41 ff d1             	call   *%r9
+
+000000000080123d <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  80123d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801240:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801245:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80124b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801251:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801257:	0f 05                	syscall
+    if (check && ret > 0) {
+  801259:	48 85 c0             	test   %rax,%rax
+  80125c:	7f 01                	jg     80125f <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  80125e:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  80125f:	55                   	push   %rbp
+  801260:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801263:	49 89 c0             	mov    %rax,%r8
+  801266:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80126b:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  801272:	00 00 00 
+  801275:	be 29 00 00 00       	mov    $0x29,%esi
+  80127a:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  801281:	00 00 00 
+  801284:	b8 00 00 00 00       	mov    $0x0,%eax
+  801289:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  801290:	00 00 00 
+  801293:	41 ff d1             	call   *%r9
+
+0000000000801296 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801296:	48 63 f6             	movslq %esi,%rsi
+  801299:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80129c:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012a1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012a6:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012ac:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012b2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012b8:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012ba:	48 85 c0             	test   %rax,%rax
+  8012bd:	7f 01                	jg     8012c0 <sys_env_set_status+0x2a>
+}
+  8012bf:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8012c0:	55                   	push   %rbp
+  8012c1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012c4:	49 89 c0             	mov    %rax,%r8
+  8012c7:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012cc:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  8012d3:	00 00 00 
+  8012d6:	be 29 00 00 00       	mov    $0x29,%esi
+  8012db:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  8012e2:	00 00 00 
+  8012e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ea:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  8012f1:	00 00 00 
+  8012f4:	41 ff d1             	call   *%r9
+
+00000000008012f7 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8012f7:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012fa:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801304:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80130a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801310:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801316:	0f 05                	syscall
+    if (check && ret > 0) {
+  801318:	48 85 c0             	test   %rax,%rax
+  80131b:	7f 01                	jg     80131e <sys_env_set_trapframe+0x27>
+}
+  80131d:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80131e:	55                   	push   %rbp
+  80131f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801322:	49 89 c0             	mov    %rax,%r8
+  801325:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  80132a:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  801331:	00 00 00 
+  801334:	be 29 00 00 00       	mov    $0x29,%esi
+  801339:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  801340:	00 00 00 
+  801343:	b8 00 00 00 00       	mov    $0x0,%eax
+  801348:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  80134f:	00 00 00 
+  801352:	41 ff d1             	call   *%r9
+
+0000000000801355 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  801355:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801358:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80135d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801362:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801368:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80136e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801374:	0f 05                	syscall
+    if (check && ret > 0) {
+  801376:	48 85 c0             	test   %rax,%rax
+  801379:	7f 01                	jg     80137c <sys_env_set_pgfault_upcall+0x27>
+}
+  80137b:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80137c:	55                   	push   %rbp
+  80137d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801380:	49 89 c0             	mov    %rax,%r8
+  801383:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801388:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  80138f:	00 00 00 
+  801392:	be 29 00 00 00       	mov    $0x29,%esi
+  801397:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  80139e:	00 00 00 
+  8013a1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013a6:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  8013ad:	00 00 00 
+  8013b0:	41 ff d1             	call   *%r9
+
+00000000008013b3 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013b3:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013b6:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013b9:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013be:	4d 63 c0             	movslq %r8d,%r8
+  8013c1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c7:	0f 05                	syscall
+}
+  8013c9:	c3                   	ret
+
+00000000008013ca <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ca:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013cd:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013d0:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013d5:	4d 63 c0             	movslq %r8d,%r8
+  8013d8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013de:	0f 05                	syscall
+}
+  8013e0:	c3                   	ret
+
+00000000008013e1 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013e1:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013e6:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e9:	45 89 c0             	mov    %r8d,%r8d
+  8013ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013f2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013f4:	48 85 c0             	test   %rax,%rax
+  8013f7:	7f 01                	jg     8013fa <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8013f9:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013fa:	55                   	push   %rbp
+  8013fb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013fe:	49 89 c0             	mov    %rax,%r8
+  801401:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801406:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  80140d:	00 00 00 
+  801410:	be 29 00 00 00       	mov    $0x29,%esi
+  801415:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  80141c:	00 00 00 
+  80141f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801424:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  80142b:	00 00 00 
+  80142e:	41 ff d1             	call   *%r9
+
+0000000000801431 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801431:	55                   	push   %rbp
+  801432:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  801435:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80143b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801440:	ba 00 00 00 00       	mov    $0x0,%edx
+  801445:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  80144c:	00 00 00 
+  80144f:	ff d0                	call   *%rax
+}
+  801451:	5d                   	pop    %rbp
+  801452:	c3                   	ret
+
+0000000000801453 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  801453:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801458:	bf 00 00 00 00       	mov    $0x0,%edi
+  80145d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801462:	ba 00 00 00 00       	mov    $0x0,%edx
+  801467:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80146d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801473:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801479:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  80147b:	c3                   	ret
+
+000000000080147c <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80147c:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801481:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801486:	ba 00 00 00 00       	mov    $0x0,%edx
+  80148b:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801491:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801497:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80149d:	0f 05                	syscall
+    if (check && ret > 0) {
+  80149f:	48 85 c0             	test   %rax,%rax
+  8014a2:	7f 01                	jg     8014a5 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8014a4:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8014a5:	55                   	push   %rbp
+  8014a6:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a9:	49 89 c0             	mov    %rax,%r8
+  8014ac:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014b1:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  8014b8:	00 00 00 
+  8014bb:	be 29 00 00 00       	mov    $0x29,%esi
+  8014c0:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  8014c7:	00 00 00 
+  8014ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014cf:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  8014d6:	00 00 00 
+  8014d9:	41 ff d1             	call   *%r9
+
+00000000008014dc <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014dc:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014e1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014e6:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801502:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801504:	c3                   	ret
+
+0000000000801505 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801505:	89 d2                	mov    %edx,%edx
+  801507:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801509:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80150e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801514:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801520:	0f 05                	syscall
+}
+  801522:	c3                   	ret
+
+0000000000801523 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  801523:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801526:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80152b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801530:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801536:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80153c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801542:	0f 05                	syscall
+}
+  801544:	c3                   	ret
+
+0000000000801545 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  801545:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801548:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80154d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801552:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801558:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80155e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801564:	0f 05                	syscall
+}
+  801566:	c3                   	ret
+
+0000000000801567 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801567:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80156a:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80156f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801574:	ba 00 00 00 00       	mov    $0x0,%edx
+  801579:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80157f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801585:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80158b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80158d:	48 85 c0             	test   %rax,%rax
+  801590:	7f 01                	jg     801593 <sys_irq_ack+0x2c>
+}
+  801592:	c3                   	ret
+sys_irq_ack(int irq) {
+  801593:	55                   	push   %rbp
+  801594:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801597:	49 89 c0             	mov    %rax,%r8
+  80159a:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80159f:	48 ba d8 4e 80 00 00 	movabs $0x804ed8,%rdx
+  8015a6:	00 00 00 
+  8015a9:	be 29 00 00 00       	mov    $0x29,%esi
+  8015ae:	48 bf f7 4e 80 00 00 	movabs $0x804ef7,%rdi
+  8015b5:	00 00 00 
+  8015b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015bd:	49 b9 9c 45 80 00 00 	movabs $0x80459c,%r9
+  8015c4:	00 00 00 
+  8015c7:	41 ff d1             	call   *%r9
+
+00000000008015ca <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8015ca:	55                   	push   %rbp
+  8015cb:	48 89 e5             	mov    %rsp,%rbp
+  8015ce:	41 54                	push   %r12
+  8015d0:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  8015d1:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  8015d8:	00 00 00 
+  8015db:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8015dd:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015e2:	0f 05                	syscall
+  8015e4:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8015e7:	85 c0                	test   %eax,%eax
+  8015e9:	78 7e                	js     801669 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8015eb:	0f 84 80 00 00 00    	je     801671 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8015f1:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8015f7:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015fe:	00 00 00 
+  801601:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801606:	89 c2                	mov    %eax,%edx
+  801608:	be 00 00 00 00       	mov    $0x0,%esi
+  80160d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801612:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  801619:	00 00 00 
+  80161c:	ff d0                	call   *%rax
+  80161e:	85 c0                	test   %eax,%eax
+  801620:	0f 88 86 00 00 00    	js     8016ac <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801626:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80162d:	00 00 00 
+  801630:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  801637:	44 89 e7             	mov    %r12d,%edi
+  80163a:	48 b8 55 13 80 00 00 	movabs $0x801355,%rax
+  801641:	00 00 00 
+  801644:	ff d0                	call   *%rax
+  801646:	85 c0                	test   %eax,%eax
+  801648:	78 6a                	js     8016b4 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  80164a:	be 02 00 00 00       	mov    $0x2,%esi
+  80164f:	44 89 e7             	mov    %r12d,%edi
+  801652:	48 b8 96 12 80 00 00 	movabs $0x801296,%rax
+  801659:	00 00 00 
+  80165c:	ff d0                	call   *%rax
+		return -1;
+  80165e:	85 c0                	test   %eax,%eax
+  801660:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801665:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801669:	44 89 e0             	mov    %r12d,%eax
+  80166c:	5b                   	pop    %rbx
+  80166d:	41 5c                	pop    %r12
+  80166f:	5d                   	pop    %rbp
+  801670:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801671:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  801678:	00 00 00 
+  80167b:	ff d0                	call   *%rax
+  80167d:	89 c2                	mov    %eax,%edx
+  80167f:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801685:	48 89 d0             	mov    %rdx,%rax
+  801688:	48 c1 e0 04          	shl    $0x4,%rax
+  80168c:	48 29 d0             	sub    %rdx,%rax
+  80168f:	48 c1 e0 05          	shl    $0x5,%rax
+  801693:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  80169a:	00 00 00 
+  80169d:	48 01 d0             	add    %rdx,%rax
+  8016a0:	48 a3 08 00 81 00 00 	movabs %rax,0x810008
+  8016a7:	00 00 00 
+        return 0;
+  8016aa:	eb bd                	jmp    801669 <fork+0x9f>
+		return -1;
+  8016ac:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016b2:	eb b5                	jmp    801669 <fork+0x9f>
+		return -1;
+  8016b4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016ba:	eb ad                	jmp    801669 <fork+0x9f>
+
+00000000008016bc <sfork>:
+
+envid_t
+sfork() {
+  8016bc:	55                   	push   %rbp
+  8016bd:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016c0:	48 ba 05 4f 80 00 00 	movabs $0x804f05,%rdx
+  8016c7:	00 00 00 
+  8016ca:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8016cf:	48 bf 20 4f 80 00 00 	movabs $0x804f20,%rdi
+  8016d6:	00 00 00 
+  8016d9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016de:	48 b9 9c 45 80 00 00 	movabs $0x80459c,%rcx
+  8016e5:	00 00 00 
+  8016e8:	ff d1                	call   *%rcx
+
+00000000008016ea <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8016ea:	55                   	push   %rbp
+  8016eb:	48 89 e5             	mov    %rsp,%rbp
+  8016ee:	41 55                	push   %r13
+  8016f0:	41 54                	push   %r12
+  8016f2:	53                   	push   %rbx
+  8016f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8016f7:	49 89 fd             	mov    %rdi,%r13
+  8016fa:	48 89 f7             	mov    %rsi,%rdi
+  8016fd:	48 89 d3             	mov    %rdx,%rbx
+  801700:	49 89 cc             	mov    %rcx,%r12
+  801703:	4c 89 c2             	mov    %r8,%rdx
+  801706:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801709:	48 85 f6             	test   %rsi,%rsi
+  80170c:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  801713:	00 00 00 
+  801716:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80171a:	be 00 10 00 00       	mov    $0x1000,%esi
+  80171f:	48 85 db             	test   %rbx,%rbx
+  801722:	74 03                	je     801727 <ipc_recv_futex+0x3d>
+  801724:	48 8b 33             	mov    (%rbx),%rsi
+  801727:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80172b:	48 b8 e1 13 80 00 00 	movabs $0x8013e1,%rax
+  801732:	00 00 00 
+  801735:	ff d0                	call   *%rax
+    if (res < 0) {
+  801737:	85 c0                	test   %eax,%eax
+  801739:	78 75                	js     8017b0 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80173b:	4d 85 ed             	test   %r13,%r13
+  80173e:	74 14                	je     801754 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  801740:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801747:	00 00 00 
+  80174a:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  801750:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  801754:	4d 85 e4             	test   %r12,%r12
+  801757:	74 14                	je     80176d <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  801759:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801760:	00 00 00 
+  801763:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  801769:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80176d:	48 85 db             	test   %rbx,%rbx
+  801770:	74 23                	je     801795 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801772:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801779:	00 00 00 
+  80177c:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801782:	ba 00 00 00 00       	mov    $0x0,%edx
+  801787:	85 c9                	test   %ecx,%ecx
+  801789:	74 07                	je     801792 <ipc_recv_futex+0xa8>
+  80178b:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801792:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801795:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80179c:	00 00 00 
+  80179f:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8017a5:	48 83 c4 08          	add    $0x8,%rsp
+  8017a9:	5b                   	pop    %rbx
+  8017aa:	41 5c                	pop    %r12
+  8017ac:	41 5d                	pop    %r13
+  8017ae:	5d                   	pop    %rbp
+  8017af:	c3                   	ret
+        if (from_env_store != NULL) {
+  8017b0:	4d 85 ed             	test   %r13,%r13
+  8017b3:	74 08                	je     8017bd <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8017b5:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8017bc:	00 
+        if (perm_store != NULL) {
+  8017bd:	4d 85 e4             	test   %r12,%r12
+  8017c0:	74 08                	je     8017ca <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8017c2:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8017c9:	00 
+        if (size != NULL) {
+  8017ca:	48 85 db             	test   %rbx,%rbx
+  8017cd:	74 d6                	je     8017a5 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8017cf:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8017d6:	eb cd                	jmp    8017a5 <ipc_recv_futex+0xbb>
+
+00000000008017d8 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8017d8:	55                   	push   %rbp
+  8017d9:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  8017dc:	48 83 ec 08          	sub    $0x8,%rsp
+  8017e0:	6a 00                	push   $0x0
+  8017e2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8017e8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ee:	48 b8 ea 16 80 00 00 	movabs $0x8016ea,%rax
+  8017f5:	00 00 00 
+  8017f8:	ff d0                	call   *%rax
+}
+  8017fa:	c9                   	leave
+  8017fb:	c3                   	ret
+
+00000000008017fc <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  8017fc:	55                   	push   %rbp
+  8017fd:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  801800:	48 85 d2             	test   %rdx,%rdx
+  801803:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80180a:	00 00 00 
+  80180d:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  801811:	89 f6                	mov    %esi,%esi
+  801813:	48 b8 ca 13 80 00 00 	movabs $0x8013ca,%rax
+  80181a:	00 00 00 
+  80181d:	ff d0                	call   *%rax
+    if (res < 0) {
+  80181f:	85 c0                	test   %eax,%eax
+  801821:	78 02                	js     801825 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  801823:	5d                   	pop    %rbp
+  801824:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  801825:	89 c1                	mov    %eax,%ecx
+  801827:	48 ba 2b 4f 80 00 00 	movabs $0x804f2b,%rdx
+  80182e:	00 00 00 
+  801831:	be 50 00 00 00       	mov    $0x50,%esi
+  801836:	48 bf 3f 4f 80 00 00 	movabs $0x804f3f,%rdi
+  80183d:	00 00 00 
+  801840:	b8 00 00 00 00       	mov    $0x0,%eax
+  801845:	49 b8 9c 45 80 00 00 	movabs $0x80459c,%r8
+  80184c:	00 00 00 
+  80184f:	41 ff d0             	call   *%r8
+
+0000000000801852 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  801852:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  801857:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80185e:	00 00 00 
+  801861:	48 89 d0             	mov    %rdx,%rax
+  801864:	48 c1 e0 04          	shl    $0x4,%rax
+  801868:	48 29 d0             	sub    %rdx,%rax
+  80186b:	48 c1 e0 05          	shl    $0x5,%rax
+  80186f:	48 01 c8             	add    %rcx,%rax
+  801872:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801878:	39 f8                	cmp    %edi,%eax
+  80187a:	74 13                	je     80188f <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80187c:	48 83 c2 01          	add    $0x1,%rdx
+  801880:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801887:	75 d8                	jne    801861 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801889:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80188e:	c3                   	ret
+            return envs[i].env_id;
+  80188f:	48 89 d0             	mov    %rdx,%rax
+  801892:	48 c1 e0 04          	shl    $0x4,%rax
+  801896:	48 29 d0             	sub    %rdx,%rax
+  801899:	48 c1 e0 05          	shl    $0x5,%rax
+  80189d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8018a4:	00 00 00 
+  8018a7:	48 01 d0             	add    %rdx,%rax
+  8018aa:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8018b0:	c3                   	ret
+
+00000000008018b1 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018b1:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018b8:	ff ff ff 
+  8018bb:	48 01 f8             	add    %rdi,%rax
+  8018be:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8018c2:	c3                   	ret
+
+00000000008018c3 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8018c3:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8018ca:	ff ff ff 
+  8018cd:	48 01 f8             	add    %rdi,%rax
+  8018d0:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8018d4:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8018da:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8018de:	c3                   	ret
+
+00000000008018df <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8018df:	55                   	push   %rbp
+  8018e0:	48 89 e5             	mov    %rsp,%rbp
+  8018e3:	41 57                	push   %r15
+  8018e5:	41 56                	push   %r14
+  8018e7:	41 55                	push   %r13
+  8018e9:	41 54                	push   %r12
+  8018eb:	53                   	push   %rbx
+  8018ec:	48 83 ec 08          	sub    $0x8,%rsp
+  8018f0:	49 89 ff             	mov    %rdi,%r15
+  8018f3:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8018f8:	49 bd 6e 40 80 00 00 	movabs $0x80406e,%r13
+  8018ff:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801902:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801908:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80190b:	48 89 df             	mov    %rbx,%rdi
+  80190e:	41 ff d5             	call   *%r13
+  801911:	83 e0 04             	and    $0x4,%eax
+  801914:	74 17                	je     80192d <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801916:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80191d:	4c 39 f3             	cmp    %r14,%rbx
+  801920:	75 e6                	jne    801908 <fd_alloc+0x29>
+  801922:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801928:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80192d:	4d 89 27             	mov    %r12,(%r15)
+}
+  801930:	48 83 c4 08          	add    $0x8,%rsp
+  801934:	5b                   	pop    %rbx
+  801935:	41 5c                	pop    %r12
+  801937:	41 5d                	pop    %r13
+  801939:	41 5e                	pop    %r14
+  80193b:	41 5f                	pop    %r15
+  80193d:	5d                   	pop    %rbp
+  80193e:	c3                   	ret
+
+000000000080193f <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80193f:	83 ff 1f             	cmp    $0x1f,%edi
+  801942:	77 39                	ja     80197d <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801944:	55                   	push   %rbp
+  801945:	48 89 e5             	mov    %rsp,%rbp
+  801948:	41 54                	push   %r12
+  80194a:	53                   	push   %rbx
+  80194b:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80194e:	48 63 df             	movslq %edi,%rbx
+  801951:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801958:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80195c:	48 89 df             	mov    %rbx,%rdi
+  80195f:	48 b8 6e 40 80 00 00 	movabs $0x80406e,%rax
+  801966:	00 00 00 
+  801969:	ff d0                	call   *%rax
+  80196b:	a8 04                	test   $0x4,%al
+  80196d:	74 14                	je     801983 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80196f:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801973:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801978:	5b                   	pop    %rbx
+  801979:	41 5c                	pop    %r12
+  80197b:	5d                   	pop    %rbp
+  80197c:	c3                   	ret
+        return -E_INVAL;
+  80197d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801982:	c3                   	ret
+        return -E_INVAL;
+  801983:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801988:	eb ee                	jmp    801978 <fd_lookup+0x39>
+
+000000000080198a <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  80198a:	55                   	push   %rbp
+  80198b:	48 89 e5             	mov    %rsp,%rbp
+  80198e:	41 54                	push   %r12
+  801990:	53                   	push   %rbx
+  801991:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801994:	48 b8 e0 4f 80 00 00 	movabs $0x804fe0,%rax
+  80199b:	00 00 00 
+  80199e:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8019a5:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8019a8:	39 3b                	cmp    %edi,(%rbx)
+  8019aa:	74 47                	je     8019f3 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8019ac:	48 83 c0 08          	add    $0x8,%rax
+  8019b0:	48 8b 18             	mov    (%rax),%rbx
+  8019b3:	48 85 db             	test   %rbx,%rbx
+  8019b6:	75 f0                	jne    8019a8 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8019b8:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8019bf:	00 00 00 
+  8019c2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8019c8:	89 fa                	mov    %edi,%edx
+  8019ca:	48 bf 50 4f 80 00 00 	movabs $0x804f50,%rdi
+  8019d1:	00 00 00 
+  8019d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019d9:	48 b9 13 03 80 00 00 	movabs $0x800313,%rcx
+  8019e0:	00 00 00 
+  8019e3:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8019e5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8019ea:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8019ee:	5b                   	pop    %rbx
+  8019ef:	41 5c                	pop    %r12
+  8019f1:	5d                   	pop    %rbp
+  8019f2:	c3                   	ret
+            return 0;
+  8019f3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8019f8:	eb f0                	jmp    8019ea <dev_lookup+0x60>
+
+00000000008019fa <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8019fa:	55                   	push   %rbp
+  8019fb:	48 89 e5             	mov    %rsp,%rbp
+  8019fe:	41 55                	push   %r13
+  801a00:	41 54                	push   %r12
+  801a02:	53                   	push   %rbx
+  801a03:	48 83 ec 18          	sub    $0x18,%rsp
+  801a07:	48 89 fb             	mov    %rdi,%rbx
+  801a0a:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801a0d:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801a14:	ff ff ff 
+  801a17:	48 01 df             	add    %rbx,%rdi
+  801a1a:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801a1e:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a22:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801a29:	00 00 00 
+  801a2c:	ff d0                	call   *%rax
+  801a2e:	41 89 c5             	mov    %eax,%r13d
+  801a31:	85 c0                	test   %eax,%eax
+  801a33:	78 06                	js     801a3b <fd_close+0x41>
+  801a35:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801a39:	74 1a                	je     801a55 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801a3b:	45 84 e4             	test   %r12b,%r12b
+  801a3e:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a43:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801a47:	44 89 e8             	mov    %r13d,%eax
+  801a4a:	48 83 c4 18          	add    $0x18,%rsp
+  801a4e:	5b                   	pop    %rbx
+  801a4f:	41 5c                	pop    %r12
+  801a51:	41 5d                	pop    %r13
+  801a53:	5d                   	pop    %rbp
+  801a54:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801a55:	8b 3b                	mov    (%rbx),%edi
+  801a57:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a5b:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801a62:	00 00 00 
+  801a65:	ff d0                	call   *%rax
+  801a67:	41 89 c5             	mov    %eax,%r13d
+  801a6a:	85 c0                	test   %eax,%eax
+  801a6c:	78 1b                	js     801a89 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801a6e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801a72:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801a76:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801a7c:	48 85 c0             	test   %rax,%rax
+  801a7f:	74 08                	je     801a89 <fd_close+0x8f>
+  801a81:	48 89 df             	mov    %rbx,%rdi
+  801a84:	ff d0                	call   *%rax
+  801a86:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801a89:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a8e:	48 89 de             	mov    %rbx,%rsi
+  801a91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a96:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  801a9d:	00 00 00 
+  801aa0:	ff d0                	call   *%rax
+    return res;
+  801aa2:	eb a3                	jmp    801a47 <fd_close+0x4d>
+
+0000000000801aa4 <close>:
+
+int
+close(int fdnum) {
+  801aa4:	55                   	push   %rbp
+  801aa5:	48 89 e5             	mov    %rsp,%rbp
+  801aa8:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801aac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801ab0:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801ab7:	00 00 00 
+  801aba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801abc:	85 c0                	test   %eax,%eax
+  801abe:	78 15                	js     801ad5 <close+0x31>
+
+    return fd_close(fd, 1);
+  801ac0:	be 01 00 00 00       	mov    $0x1,%esi
+  801ac5:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801ac9:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  801ad0:	00 00 00 
+  801ad3:	ff d0                	call   *%rax
+}
+  801ad5:	c9                   	leave
+  801ad6:	c3                   	ret
+
+0000000000801ad7 <close_all>:
+
+void
+close_all(void) {
+  801ad7:	55                   	push   %rbp
+  801ad8:	48 89 e5             	mov    %rsp,%rbp
+  801adb:	41 54                	push   %r12
+  801add:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801ade:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ae3:	49 bc a4 1a 80 00 00 	movabs $0x801aa4,%r12
+  801aea:	00 00 00 
+  801aed:	89 df                	mov    %ebx,%edi
+  801aef:	41 ff d4             	call   *%r12
+  801af2:	83 c3 01             	add    $0x1,%ebx
+  801af5:	83 fb 20             	cmp    $0x20,%ebx
+  801af8:	75 f3                	jne    801aed <close_all+0x16>
+}
+  801afa:	5b                   	pop    %rbx
+  801afb:	41 5c                	pop    %r12
+  801afd:	5d                   	pop    %rbp
+  801afe:	c3                   	ret
+
+0000000000801aff <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801aff:	55                   	push   %rbp
+  801b00:	48 89 e5             	mov    %rsp,%rbp
+  801b03:	41 57                	push   %r15
+  801b05:	41 56                	push   %r14
+  801b07:	41 55                	push   %r13
+  801b09:	41 54                	push   %r12
+  801b0b:	53                   	push   %rbx
+  801b0c:	48 83 ec 18          	sub    $0x18,%rsp
+  801b10:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801b13:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801b17:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801b1e:	00 00 00 
+  801b21:	ff d0                	call   *%rax
+  801b23:	89 c3                	mov    %eax,%ebx
+  801b25:	85 c0                	test   %eax,%eax
+  801b27:	0f 88 b8 00 00 00    	js     801be5 <dup+0xe6>
+    close(newfdnum);
+  801b2d:	44 89 e7             	mov    %r12d,%edi
+  801b30:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801b37:	00 00 00 
+  801b3a:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801b3c:	4d 63 ec             	movslq %r12d,%r13
+  801b3f:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801b46:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801b4a:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801b4e:	4c 89 ff             	mov    %r15,%rdi
+  801b51:	49 be c3 18 80 00 00 	movabs $0x8018c3,%r14
+  801b58:	00 00 00 
+  801b5b:	41 ff d6             	call   *%r14
+  801b5e:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801b61:	4c 89 ef             	mov    %r13,%rdi
+  801b64:	41 ff d6             	call   *%r14
+  801b67:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801b6a:	48 89 df             	mov    %rbx,%rdi
+  801b6d:	48 b8 6e 40 80 00 00 	movabs $0x80406e,%rax
+  801b74:	00 00 00 
+  801b77:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801b79:	a8 04                	test   $0x4,%al
+  801b7b:	74 2b                	je     801ba8 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801b7d:	41 89 c1             	mov    %eax,%r9d
+  801b80:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801b86:	4c 89 f1             	mov    %r14,%rcx
+  801b89:	ba 00 00 00 00       	mov    $0x0,%edx
+  801b8e:	48 89 de             	mov    %rbx,%rsi
+  801b91:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b96:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  801b9d:	00 00 00 
+  801ba0:	ff d0                	call   *%rax
+  801ba2:	89 c3                	mov    %eax,%ebx
+  801ba4:	85 c0                	test   %eax,%eax
+  801ba6:	78 4e                	js     801bf6 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801ba8:	4c 89 ff             	mov    %r15,%rdi
+  801bab:	48 b8 6e 40 80 00 00 	movabs $0x80406e,%rax
+  801bb2:	00 00 00 
+  801bb5:	ff d0                	call   *%rax
+  801bb7:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801bba:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801bc0:	4c 89 e9             	mov    %r13,%rcx
+  801bc3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801bc8:	4c 89 fe             	mov    %r15,%rsi
+  801bcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  801bd0:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  801bd7:	00 00 00 
+  801bda:	ff d0                	call   *%rax
+  801bdc:	89 c3                	mov    %eax,%ebx
+  801bde:	85 c0                	test   %eax,%eax
+  801be0:	78 14                	js     801bf6 <dup+0xf7>
+
+    return newfdnum;
+  801be2:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801be5:	89 d8                	mov    %ebx,%eax
+  801be7:	48 83 c4 18          	add    $0x18,%rsp
+  801beb:	5b                   	pop    %rbx
+  801bec:	41 5c                	pop    %r12
+  801bee:	41 5d                	pop    %r13
+  801bf0:	41 5e                	pop    %r14
+  801bf2:	41 5f                	pop    %r15
+  801bf4:	5d                   	pop    %rbp
+  801bf5:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801bf6:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801bfb:	4c 89 ee             	mov    %r13,%rsi
+  801bfe:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c03:	49 bc 3d 12 80 00 00 	movabs $0x80123d,%r12
+  801c0a:	00 00 00 
+  801c0d:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801c10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c15:	4c 89 f6             	mov    %r14,%rsi
+  801c18:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c1d:	41 ff d4             	call   *%r12
+    return res;
+  801c20:	eb c3                	jmp    801be5 <dup+0xe6>
+
+0000000000801c22 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801c22:	55                   	push   %rbp
+  801c23:	48 89 e5             	mov    %rsp,%rbp
+  801c26:	41 56                	push   %r14
+  801c28:	41 55                	push   %r13
+  801c2a:	41 54                	push   %r12
+  801c2c:	53                   	push   %rbx
+  801c2d:	48 83 ec 10          	sub    $0x10,%rsp
+  801c31:	89 fb                	mov    %edi,%ebx
+  801c33:	49 89 f4             	mov    %rsi,%r12
+  801c36:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c39:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801c3d:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801c44:	00 00 00 
+  801c47:	ff d0                	call   *%rax
+  801c49:	85 c0                	test   %eax,%eax
+  801c4b:	78 4c                	js     801c99 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c4d:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801c51:	41 8b 3e             	mov    (%r14),%edi
+  801c54:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801c58:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801c5f:	00 00 00 
+  801c62:	ff d0                	call   *%rax
+  801c64:	85 c0                	test   %eax,%eax
+  801c66:	78 35                	js     801c9d <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801c68:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801c6c:	83 e0 03             	and    $0x3,%eax
+  801c6f:	83 f8 01             	cmp    $0x1,%eax
+  801c72:	74 2d                	je     801ca1 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801c74:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801c78:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801c7c:	48 85 c0             	test   %rax,%rax
+  801c7f:	74 56                	je     801cd7 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801c81:	4c 89 ea             	mov    %r13,%rdx
+  801c84:	4c 89 e6             	mov    %r12,%rsi
+  801c87:	4c 89 f7             	mov    %r14,%rdi
+  801c8a:	ff d0                	call   *%rax
+}
+  801c8c:	48 83 c4 10          	add    $0x10,%rsp
+  801c90:	5b                   	pop    %rbx
+  801c91:	41 5c                	pop    %r12
+  801c93:	41 5d                	pop    %r13
+  801c95:	41 5e                	pop    %r14
+  801c97:	5d                   	pop    %rbp
+  801c98:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c99:	48 98                	cltq
+  801c9b:	eb ef                	jmp    801c8c <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c9d:	48 98                	cltq
+  801c9f:	eb eb                	jmp    801c8c <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ca1:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801ca8:	00 00 00 
+  801cab:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801cb1:	89 da                	mov    %ebx,%edx
+  801cb3:	48 bf 91 4f 80 00 00 	movabs $0x804f91,%rdi
+  801cba:	00 00 00 
+  801cbd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801cc2:	48 b9 13 03 80 00 00 	movabs $0x800313,%rcx
+  801cc9:	00 00 00 
+  801ccc:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801cce:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801cd5:	eb b5                	jmp    801c8c <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801cd7:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801cde:	eb ac                	jmp    801c8c <read+0x6a>
+
+0000000000801ce0 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801ce0:	55                   	push   %rbp
+  801ce1:	48 89 e5             	mov    %rsp,%rbp
+  801ce4:	41 57                	push   %r15
+  801ce6:	41 56                	push   %r14
+  801ce8:	41 55                	push   %r13
+  801cea:	41 54                	push   %r12
+  801cec:	53                   	push   %rbx
+  801ced:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801cf1:	48 85 d2             	test   %rdx,%rdx
+  801cf4:	74 54                	je     801d4a <readn+0x6a>
+  801cf6:	41 89 fd             	mov    %edi,%r13d
+  801cf9:	49 89 f6             	mov    %rsi,%r14
+  801cfc:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801cff:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801d04:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801d09:	49 bf 22 1c 80 00 00 	movabs $0x801c22,%r15
+  801d10:	00 00 00 
+  801d13:	4c 89 e2             	mov    %r12,%rdx
+  801d16:	48 29 f2             	sub    %rsi,%rdx
+  801d19:	4c 01 f6             	add    %r14,%rsi
+  801d1c:	44 89 ef             	mov    %r13d,%edi
+  801d1f:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801d22:	85 c0                	test   %eax,%eax
+  801d24:	78 20                	js     801d46 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801d26:	01 c3                	add    %eax,%ebx
+  801d28:	85 c0                	test   %eax,%eax
+  801d2a:	74 08                	je     801d34 <readn+0x54>
+  801d2c:	48 63 f3             	movslq %ebx,%rsi
+  801d2f:	4c 39 e6             	cmp    %r12,%rsi
+  801d32:	72 df                	jb     801d13 <readn+0x33>
+    }
+    return res;
+  801d34:	48 63 c3             	movslq %ebx,%rax
+}
+  801d37:	48 83 c4 08          	add    $0x8,%rsp
+  801d3b:	5b                   	pop    %rbx
+  801d3c:	41 5c                	pop    %r12
+  801d3e:	41 5d                	pop    %r13
+  801d40:	41 5e                	pop    %r14
+  801d42:	41 5f                	pop    %r15
+  801d44:	5d                   	pop    %rbp
+  801d45:	c3                   	ret
+        if (inc < 0) return inc;
+  801d46:	48 98                	cltq
+  801d48:	eb ed                	jmp    801d37 <readn+0x57>
+    int inc = 1, res = 0;
+  801d4a:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801d4f:	eb e3                	jmp    801d34 <readn+0x54>
+
+0000000000801d51 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801d51:	55                   	push   %rbp
+  801d52:	48 89 e5             	mov    %rsp,%rbp
+  801d55:	41 56                	push   %r14
+  801d57:	41 55                	push   %r13
+  801d59:	41 54                	push   %r12
+  801d5b:	53                   	push   %rbx
+  801d5c:	48 83 ec 10          	sub    $0x10,%rsp
+  801d60:	89 fb                	mov    %edi,%ebx
+  801d62:	49 89 f4             	mov    %rsi,%r12
+  801d65:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d68:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d6c:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801d73:	00 00 00 
+  801d76:	ff d0                	call   *%rax
+  801d78:	85 c0                	test   %eax,%eax
+  801d7a:	78 47                	js     801dc3 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d7c:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801d80:	41 8b 3e             	mov    (%r14),%edi
+  801d83:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801d87:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801d8e:	00 00 00 
+  801d91:	ff d0                	call   *%rax
+  801d93:	85 c0                	test   %eax,%eax
+  801d95:	78 30                	js     801dc7 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801d97:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801d9c:	74 2d                	je     801dcb <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801d9e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801da2:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801da6:	48 85 c0             	test   %rax,%rax
+  801da9:	74 56                	je     801e01 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801dab:	4c 89 ea             	mov    %r13,%rdx
+  801dae:	4c 89 e6             	mov    %r12,%rsi
+  801db1:	4c 89 f7             	mov    %r14,%rdi
+  801db4:	ff d0                	call   *%rax
+}
+  801db6:	48 83 c4 10          	add    $0x10,%rsp
+  801dba:	5b                   	pop    %rbx
+  801dbb:	41 5c                	pop    %r12
+  801dbd:	41 5d                	pop    %r13
+  801dbf:	41 5e                	pop    %r14
+  801dc1:	5d                   	pop    %rbp
+  801dc2:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801dc3:	48 98                	cltq
+  801dc5:	eb ef                	jmp    801db6 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801dc7:	48 98                	cltq
+  801dc9:	eb eb                	jmp    801db6 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801dcb:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801dd2:	00 00 00 
+  801dd5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ddb:	89 da                	mov    %ebx,%edx
+  801ddd:	48 bf ad 4f 80 00 00 	movabs $0x804fad,%rdi
+  801de4:	00 00 00 
+  801de7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801dec:	48 b9 13 03 80 00 00 	movabs $0x800313,%rcx
+  801df3:	00 00 00 
+  801df6:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801df8:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801dff:	eb b5                	jmp    801db6 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e01:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801e08:	eb ac                	jmp    801db6 <write+0x65>
+
+0000000000801e0a <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801e0a:	55                   	push   %rbp
+  801e0b:	48 89 e5             	mov    %rsp,%rbp
+  801e0e:	41 54                	push   %r12
+  801e10:	53                   	push   %rbx
+  801e11:	48 83 ec 10          	sub    $0x10,%rsp
+  801e15:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e17:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801e1b:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801e22:	00 00 00 
+  801e25:	ff d0                	call   *%rax
+  801e27:	85 c0                	test   %eax,%eax
+  801e29:	78 3e                	js     801e69 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e2b:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801e2f:	41 8b 3c 24          	mov    (%r12),%edi
+  801e33:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801e37:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801e3e:	00 00 00 
+  801e41:	ff d0                	call   *%rax
+  801e43:	85 c0                	test   %eax,%eax
+  801e45:	78 22                	js     801e69 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801e47:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801e4b:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801e4f:	48 85 c0             	test   %rax,%rax
+  801e52:	74 0b                	je     801e5f <seek+0x55>
+  801e54:	89 de                	mov    %ebx,%esi
+  801e56:	4c 89 e7             	mov    %r12,%rdi
+  801e59:	ff d0                	call   *%rax
+  801e5b:	85 c0                	test   %eax,%eax
+  801e5d:	78 0a                	js     801e69 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801e5f:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801e64:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801e69:	48 83 c4 10          	add    $0x10,%rsp
+  801e6d:	5b                   	pop    %rbx
+  801e6e:	41 5c                	pop    %r12
+  801e70:	5d                   	pop    %rbp
+  801e71:	c3                   	ret
+
+0000000000801e72 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801e72:	55                   	push   %rbp
+  801e73:	48 89 e5             	mov    %rsp,%rbp
+  801e76:	41 55                	push   %r13
+  801e78:	41 54                	push   %r12
+  801e7a:	53                   	push   %rbx
+  801e7b:	48 83 ec 18          	sub    $0x18,%rsp
+  801e7f:	89 fb                	mov    %edi,%ebx
+  801e81:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e84:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e88:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+  801e94:	85 c0                	test   %eax,%eax
+  801e96:	78 38                	js     801ed0 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e98:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801e9c:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801ea0:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801ea4:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801eab:	00 00 00 
+  801eae:	ff d0                	call   *%rax
+  801eb0:	85 c0                	test   %eax,%eax
+  801eb2:	78 1c                	js     801ed0 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801eb4:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801eb9:	74 20                	je     801edb <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801ebb:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801ebf:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801ec3:	48 85 c0             	test   %rax,%rax
+  801ec6:	74 47                	je     801f0f <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801ec8:	44 89 e6             	mov    %r12d,%esi
+  801ecb:	4c 89 ef             	mov    %r13,%rdi
+  801ece:	ff d0                	call   *%rax
+}
+  801ed0:	48 83 c4 18          	add    $0x18,%rsp
+  801ed4:	5b                   	pop    %rbx
+  801ed5:	41 5c                	pop    %r12
+  801ed7:	41 5d                	pop    %r13
+  801ed9:	5d                   	pop    %rbp
+  801eda:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801edb:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  801ee2:	00 00 00 
+  801ee5:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801eeb:	89 da                	mov    %ebx,%edx
+  801eed:	48 bf 70 4f 80 00 00 	movabs $0x804f70,%rdi
+  801ef4:	00 00 00 
+  801ef7:	b8 00 00 00 00       	mov    $0x0,%eax
+  801efc:	48 b9 13 03 80 00 00 	movabs $0x800313,%rcx
+  801f03:	00 00 00 
+  801f06:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801f08:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801f0d:	eb c1                	jmp    801ed0 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f0f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f14:	eb ba                	jmp    801ed0 <ftruncate+0x5e>
+
+0000000000801f16 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801f16:	55                   	push   %rbp
+  801f17:	48 89 e5             	mov    %rsp,%rbp
+  801f1a:	41 54                	push   %r12
+  801f1c:	53                   	push   %rbx
+  801f1d:	48 83 ec 10          	sub    $0x10,%rsp
+  801f21:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f24:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801f28:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  801f2f:	00 00 00 
+  801f32:	ff d0                	call   *%rax
+  801f34:	85 c0                	test   %eax,%eax
+  801f36:	78 4e                	js     801f86 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f38:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801f3c:	41 8b 3c 24          	mov    (%r12),%edi
+  801f40:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801f44:	48 b8 8a 19 80 00 00 	movabs $0x80198a,%rax
+  801f4b:	00 00 00 
+  801f4e:	ff d0                	call   *%rax
+  801f50:	85 c0                	test   %eax,%eax
+  801f52:	78 32                	js     801f86 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f54:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801f58:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801f5d:	74 30                	je     801f8f <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801f5f:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801f62:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801f69:	00 00 00 
+    stat->st_isdir = 0;
+  801f6c:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801f73:	00 00 00 
+    stat->st_dev = dev;
+  801f76:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801f7d:	48 89 de             	mov    %rbx,%rsi
+  801f80:	4c 89 e7             	mov    %r12,%rdi
+  801f83:	ff 50 28             	call   *0x28(%rax)
+}
+  801f86:	48 83 c4 10          	add    $0x10,%rsp
+  801f8a:	5b                   	pop    %rbx
+  801f8b:	41 5c                	pop    %r12
+  801f8d:	5d                   	pop    %rbp
+  801f8e:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801f8f:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801f94:	eb f0                	jmp    801f86 <fstat+0x70>
+
+0000000000801f96 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801f96:	55                   	push   %rbp
+  801f97:	48 89 e5             	mov    %rsp,%rbp
+  801f9a:	41 54                	push   %r12
+  801f9c:	53                   	push   %rbx
+  801f9d:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801fa0:	be 00 00 00 00       	mov    $0x0,%esi
+  801fa5:	48 b8 04 31 80 00 00 	movabs $0x803104,%rax
+  801fac:	00 00 00 
+  801faf:	ff d0                	call   *%rax
+  801fb1:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801fb3:	85 c0                	test   %eax,%eax
+  801fb5:	78 25                	js     801fdc <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801fb7:	4c 89 e6             	mov    %r12,%rsi
+  801fba:	89 c7                	mov    %eax,%edi
+  801fbc:	48 b8 16 1f 80 00 00 	movabs $0x801f16,%rax
+  801fc3:	00 00 00 
+  801fc6:	ff d0                	call   *%rax
+  801fc8:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801fcb:	89 df                	mov    %ebx,%edi
+  801fcd:	48 b8 a4 1a 80 00 00 	movabs $0x801aa4,%rax
+  801fd4:	00 00 00 
+  801fd7:	ff d0                	call   *%rax
+
+    return res;
+  801fd9:	44 89 e3             	mov    %r12d,%ebx
+}
+  801fdc:	89 d8                	mov    %ebx,%eax
+  801fde:	5b                   	pop    %rbx
+  801fdf:	41 5c                	pop    %r12
+  801fe1:	5d                   	pop    %rbp
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801fe3:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801fea:	00 00 00 
+  801fed:	83 38 00             	cmpl   $0x0,(%rax)
+  801ff0:	74 0a                	je     801ffc <fsenv+0x19>
+    return envid;
+}
+  801ff2:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801ff9:	00 00 
+  801ffb:	c3                   	ret
+fsenv(void) {
+  801ffc:	55                   	push   %rbp
+  801ffd:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802000:	bf 03 00 00 00       	mov    $0x3,%edi
+  802005:	48 b8 52 18 80 00 00 	movabs $0x801852,%rax
+  80200c:	00 00 00 
+  80200f:	ff d0                	call   *%rax
+  802011:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802018:	00 00 
+}
+  80201a:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802021:	00 00 
+  802023:	5d                   	pop    %rbp
+  802024:	c3                   	ret
+
+0000000000802025 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802025:	55                   	push   %rbp
+  802026:	48 89 e5             	mov    %rsp,%rbp
+  802029:	41 54                	push   %r12
+  80202b:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80202c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802031:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802036:	48 89 de             	mov    %rbx,%rsi
+  802039:	bf 00 00 00 00       	mov    $0x0,%edi
+  80203e:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  802045:	00 00 00 
+  802048:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  80204a:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802051:	00 00 00 
+  802054:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  80205a:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80205f:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802064:	48 89 de             	mov    %rbx,%rsi
+  802067:	bf 00 00 00 00       	mov    $0x0,%edi
+  80206c:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  802073:	00 00 00 
+  802076:	ff d0                	call   *%rax
+  802078:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80207a:	85 c0                	test   %eax,%eax
+  80207c:	0f 88 a2 00 00 00    	js     802124 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802082:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  802089:	00 00 00 
+  80208c:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802092:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802097:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802099:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80209e:	49 bc 36 42 80 00 00 	movabs $0x804236,%r12
+  8020a5:	00 00 00 
+  8020a8:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  8020ab:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  8020b0:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020b3:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8020ba:	00 00 00 
+  8020bd:	ff d0                	call   *%rax
+  8020bf:	89 c7                	mov    %eax,%edi
+  8020c1:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  8020c7:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  8020cc:	48 89 da             	mov    %rbx,%rdx
+  8020cf:	be 09 00 00 00       	mov    $0x9,%esi
+  8020d4:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  8020db:	00 00 00 
+  8020de:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  8020e0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8020e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020ea:	be 00 00 00 00       	mov    $0x0,%esi
+  8020ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020f4:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  8020fb:	00 00 00 
+  8020fe:	ff d0                	call   *%rax
+  802100:	89 c3                	mov    %eax,%ebx
+  802102:	85 c0                	test   %eax,%eax
+  802104:	78 25                	js     80212b <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802106:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80210d:	00 00 00 
+  802110:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802116:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  80211d:	00 00 
+    return 0;
+  80211f:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802124:	89 d8                	mov    %ebx,%eax
+  802126:	5b                   	pop    %rbx
+  802127:	41 5c                	pop    %r12
+  802129:	5d                   	pop    %rbp
+  80212a:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  80212b:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802130:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802135:	bf 00 00 00 00       	mov    $0x0,%edi
+  80213a:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  802141:	00 00 00 
+  802144:	ff d0                	call   *%rax
+        return res;
+  802146:	eb dc                	jmp    802124 <fschan_setup+0xff>
+
+0000000000802148 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802148:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80214f:	00 00 00 
+  802152:	80 38 00             	cmpb   $0x0,(%rax)
+  802155:	74 55                	je     8021ac <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802157:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  80215e:	00 00 00 
+  802161:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802167:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80216c:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802173:	00 00 00 
+  802176:	3b 0a                	cmp    (%rdx),%ecx
+  802178:	75 01                	jne    80217b <fschan+0x33>
+}
+  80217a:	c3                   	ret
+fschan(void) {
+  80217b:	55                   	push   %rbp
+  80217c:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80217f:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  802186:	00 00 00 
+  802189:	ff d0                	call   *%rax
+  80218b:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80218d:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802192:	85 d2                	test   %edx,%edx
+  802194:	78 02                	js     802198 <fschan+0x50>
+}
+  802196:	5d                   	pop    %rbp
+  802197:	c3                   	ret
+        fschan_enabled = 0;
+  802198:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80219f:	00 00 00 
+  8021a2:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  8021a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021aa:	eb ea                	jmp    802196 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  8021ac:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021b1:	c3                   	ret
+
+00000000008021b2 <fbuf>:
+fbuf(struct Fd *fd) {
+  8021b2:	55                   	push   %rbp
+  8021b3:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  8021b6:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  8021bd:	00 00 00 
+  8021c0:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  8021c2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8021c7:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8021cb:	77 12                	ja     8021df <fbuf+0x2d>
+  8021cd:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8021d1:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8021d8:	00 00 00 
+  8021db:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  8021df:	48 89 d0             	mov    %rdx,%rax
+  8021e2:	5d                   	pop    %rbp
+  8021e3:	c3                   	ret
+
+00000000008021e4 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  8021e4:	55                   	push   %rbp
+  8021e5:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  8021e8:	48 83 c7 40          	add    $0x40,%rdi
+  8021ec:	48 b8 70 42 80 00 00 	movabs $0x804270,%rax
+  8021f3:	00 00 00 
+  8021f6:	ff d0                	call   *%rax
+  8021f8:	84 c0                	test   %al,%al
+  8021fa:	75 02                	jne    8021fe <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8021fc:	5d                   	pop    %rbp
+  8021fd:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8021fe:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802205:	00 00 00 
+  802208:	ff d0                	call   *%rax
+  80220a:	89 c7                	mov    %eax,%edi
+  80220c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802212:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802217:	ba 00 00 00 00       	mov    $0x0,%edx
+  80221c:	be 0a 00 00 00       	mov    $0xa,%esi
+  802221:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  802228:	00 00 00 
+  80222b:	ff d0                	call   *%rax
+}
+  80222d:	eb cd                	jmp    8021fc <fschan_publish+0x18>
+
+000000000080222f <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80222f:	55                   	push   %rbp
+  802230:	48 89 e5             	mov    %rsp,%rbp
+  802233:	41 57                	push   %r15
+  802235:	41 56                	push   %r14
+  802237:	41 55                	push   %r13
+  802239:	41 54                	push   %r12
+  80223b:	53                   	push   %rbx
+  80223c:	48 83 ec 48          	sub    $0x48,%rsp
+  802240:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802244:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802248:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80224b:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80224f:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802252:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  802259:	00 00 00 
+  80225c:	8b 02                	mov    (%rdx),%eax
+  80225e:	83 c0 01             	add    $0x1,%eax
+  802261:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802266:	0f 44 c1             	cmove  %ecx,%eax
+  802269:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80226b:	4d 85 c0             	test   %r8,%r8
+  80226e:	74 2c                	je     80229c <fschan_rw+0x6d>
+  802270:	45 89 ce             	mov    %r9d,%r14d
+  802273:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80227a:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80227e:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802284:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  80228b:	00 
+  80228c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802292:	b8 01 00 00 00       	mov    $0x1,%eax
+  802297:	e9 41 01 00 00       	jmp    8023dd <fschan_rw+0x1ae>
+  80229c:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8022a0:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8022a4:	e9 9c 01 00 00       	jmp    802445 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8022a9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8022ad:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8022b0:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8022b3:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8022b6:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8022ba:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8022be:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8022c2:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8022c6:	48 89 da             	mov    %rbx,%rdx
+  8022c9:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  8022d0:	00 00 00 
+  8022d3:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8022d5:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8022d9:	48 b8 e4 21 80 00 00 	movabs $0x8021e4,%rax
+  8022e0:	00 00 00 
+  8022e3:	ff d0                	call   *%rax
+            queued += blk;
+  8022e5:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8022e8:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8022ec:	4d 39 fc             	cmp    %r15,%r12
+  8022ef:	73 6b                	jae    80235c <fschan_rw+0x12d>
+  8022f1:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8022f5:	77 65                	ja     80235c <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8022f7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8022fb:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8022ff:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  802306:	00 00 00 
+  802309:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80230b:	4c 89 fb             	mov    %r15,%rbx
+  80230e:	4c 29 e3             	sub    %r12,%rbx
+  802311:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802316:	48 39 d3             	cmp    %rdx,%rbx
+  802319:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80231d:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802321:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802325:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  802329:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80232c:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80232e:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802335:	00 00 00 
+  802338:	8b 09                	mov    (%rcx),%ecx
+  80233a:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80233d:	83 fe 03             	cmp    $0x3,%esi
+  802340:	0f 85 63 ff ff ff    	jne    8022a9 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802346:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80234a:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80234d:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802350:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802353:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802357:	e9 79 ff ff ff       	jmp    8022d5 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80235c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802360:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802367:	48 89 df             	mov    %rbx,%rdi
+  80236a:	48 b8 0e 43 80 00 00 	movabs $0x80430e,%rax
+  802371:	00 00 00 
+  802374:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802376:	48 89 df             	mov    %rbx,%rdi
+  802379:	48 b8 9c 42 80 00 00 	movabs $0x80429c,%rax
+  802380:	00 00 00 
+  802383:	ff d0                	call   *%rax
+  802385:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802389:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80238d:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802391:	75 25                	jne    8023b8 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802393:	8b 40 04             	mov    0x4(%rax),%eax
+  802396:	85 c0                	test   %eax,%eax
+  802398:	0f 88 86 00 00 00    	js     802424 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80239e:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8023a2:	74 5b                	je     8023ff <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8023a4:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8023a8:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8023ac:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8023b0:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8023b4:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8023b8:	48 89 df             	mov    %rbx,%rdi
+  8023bb:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  8023c2:	00 00 00 
+  8023c5:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8023c7:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8023cb:	83 f0 01             	xor    $0x1,%eax
+  8023ce:	4d 39 fc             	cmp    %r15,%r12
+  8023d1:	0f 92 c2             	setb   %dl
+  8023d4:	84 c2                	test   %al,%dl
+  8023d6:	75 05                	jne    8023dd <fschan_rw+0x1ae>
+  8023d8:	45 85 ed             	test   %r13d,%r13d
+  8023db:	74 50                	je     80242d <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8023dd:	4d 39 fc             	cmp    %r15,%r12
+  8023e0:	0f 92 c1             	setb   %cl
+  8023e3:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8023e7:	0f 96 c2             	setbe  %dl
+  8023ea:	84 d1                	test   %dl,%cl
+  8023ec:	0f 84 6a ff ff ff    	je     80235c <fschan_rw+0x12d>
+  8023f2:	84 c0                	test   %al,%al
+  8023f4:	0f 85 fd fe ff ff    	jne    8022f7 <fschan_rw+0xc8>
+  8023fa:	e9 5d ff ff ff       	jmp    80235c <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8023ff:	48 63 d0             	movslq %eax,%rdx
+  802402:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802406:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80240a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80240e:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802412:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802416:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  80241d:	00 00 00 
+  802420:	ff d0                	call   *%rax
+  802422:	eb 80                	jmp    8023a4 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802424:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802427:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80242b:	eb 8b                	jmp    8023b8 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80242d:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802432:	0f 85 68 fe ff ff    	jne    8022a0 <fschan_rw+0x71>
+  802438:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	0f 84 5d fe ff ff    	je     8022a0 <fschan_rw+0x71>
+  802443:	48 98                	cltq
+}
+  802445:	48 83 c4 48          	add    $0x48,%rsp
+  802449:	5b                   	pop    %rbx
+  80244a:	41 5c                	pop    %r12
+  80244c:	41 5d                	pop    %r13
+  80244e:	41 5e                	pop    %r14
+  802450:	41 5f                	pop    %r15
+  802452:	5d                   	pop    %rbp
+  802453:	c3                   	ret
+
+0000000000802454 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802454:	55                   	push   %rbp
+  802455:	48 89 e5             	mov    %rsp,%rbp
+  802458:	41 56                	push   %r14
+  80245a:	41 55                	push   %r13
+  80245c:	41 54                	push   %r12
+  80245e:	53                   	push   %rbx
+  80245f:	48 83 ec 10          	sub    $0x10,%rsp
+  802463:	49 89 fe             	mov    %rdi,%r14
+  802466:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802469:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80246d:	48 29 f3             	sub    %rsi,%rbx
+  802470:	48 39 d3             	cmp    %rdx,%rbx
+  802473:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802477:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80247e:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80247f:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802484:	49 bd cd 40 80 00 00 	movabs $0x8040cd,%r13
+  80248b:	00 00 00 
+  80248e:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802495:	76 1e                	jbe    8024b5 <mmap_fault+0x61>
+  802497:	4c 01 e7             	add    %r12,%rdi
+  80249a:	41 ff d5             	call   *%r13
+  80249d:	84 c0                	test   %al,%al
+  80249f:	75 14                	jne    8024b5 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8024a1:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8024a5:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8024ac:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8024b0:	48 39 df             	cmp    %rbx,%rdi
+  8024b3:	72 e2                	jb     802497 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8024b5:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8024bc:	00 00 00 
+  8024bf:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8024c6:	00 00 00 
+  8024c9:	4c 89 f0             	mov    %r14,%rax
+  8024cc:	48 29 d0             	sub    %rdx,%rax
+  8024cf:	48 c1 f8 03          	sar    $0x3,%rax
+  8024d3:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8024da:	aa aa aa 
+  8024dd:	48 0f af c2          	imul   %rdx,%rax
+  8024e1:	48 c1 e0 0c          	shl    $0xc,%rax
+  8024e5:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8024ea:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8024ee:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8024f0:	44 89 e0             	mov    %r12d,%eax
+  8024f3:	41 03 46 10          	add    0x10(%r14),%eax
+  8024f7:	41 2b 06             	sub    (%r14),%eax
+  8024fa:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8024fd:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802501:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802505:	41 8b 46 14          	mov    0x14(%r14),%eax
+  802509:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80250c:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802513:	00 00 00 
+  802516:	ff d0                	call   *%rax
+  802518:	89 c7                	mov    %eax,%edi
+  80251a:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802520:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802525:	48 89 da             	mov    %rbx,%rdx
+  802528:	be 0f 00 00 00       	mov    $0xf,%esi
+  80252d:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  802534:	00 00 00 
+  802537:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  802539:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80253e:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802542:	4c 89 e6             	mov    %r12,%rsi
+  802545:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254a:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  802551:	00 00 00 
+  802554:	ff d0                	call   *%rax
+  802556:	48 98                	cltq
+}
+  802558:	48 83 c4 10          	add    $0x10,%rsp
+  80255c:	5b                   	pop    %rbx
+  80255d:	41 5c                	pop    %r12
+  80255f:	41 5d                	pop    %r13
+  802561:	41 5e                	pop    %r14
+  802563:	5d                   	pop    %rbp
+  802564:	c3                   	ret
+
+0000000000802565 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802565:	48 8b 37             	mov    (%rdi),%rsi
+  802568:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80256f:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802576:	00 00 00 
+  802579:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80257e:	eb 0f                	jmp    80258f <mmap_pgfault+0x2a>
+  802580:	c3                   	ret
+  802581:	48 83 c1 01          	add    $0x1,%rcx
+  802585:	48 83 c2 18          	add    $0x18,%rdx
+  802589:	48 83 f9 20          	cmp    $0x20,%rcx
+  80258d:	74 6e                	je     8025fd <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80258f:	48 8b 02             	mov    (%rdx),%rax
+  802592:	48 83 e8 01          	sub    $0x1,%rax
+  802596:	48 39 f0             	cmp    %rsi,%rax
+  802599:	73 e6                	jae    802581 <mmap_pgfault+0x1c>
+  80259b:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80259f:	73 e0                	jae    802581 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025a1:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8025a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025aa:	f6 c2 01             	test   $0x1,%dl
+  8025ad:	75 d1                	jne    802580 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8025af:	f6 c2 02             	test   $0x2,%dl
+  8025b2:	74 1a                	je     8025ce <mmap_pgfault+0x69>
+  8025b4:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025b8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8025bd:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8025c4:	00 00 00 
+  8025c7:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8025cc:	74 35                	je     802603 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8025ce:	55                   	push   %rbp
+  8025cf:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8025d2:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8025d6:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8025dd:	00 00 00 
+  8025e0:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8025e4:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8025e9:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  8025f0:	00 00 00 
+  8025f3:	ff d0                	call   *%rax
+  8025f5:	48 85 c0             	test   %rax,%rax
+  8025f8:	0f 9f c0             	setg   %al
+}
+  8025fb:	5d                   	pop    %rbp
+  8025fc:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8025fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  802602:	c3                   	ret
+}
+  802603:	c3                   	ret
+
+0000000000802604 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802604:	55                   	push   %rbp
+  802605:	48 89 e5             	mov    %rsp,%rbp
+  802608:	41 54                	push   %r12
+  80260a:	53                   	push   %rbx
+  80260b:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80260e:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802615:	00 00 00 
+  802618:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80261d:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802621:	74 15                	je     802638 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802623:	48 83 c3 01          	add    $0x1,%rbx
+  802627:	48 83 c0 18          	add    $0x18,%rax
+  80262b:	48 83 fb 20          	cmp    $0x20,%rbx
+  80262f:	75 ec                	jne    80261d <mmap_alloc+0x19>
+    return NULL;
+  802631:	b8 00 00 00 00       	mov    $0x0,%eax
+  802636:	eb 52                	jmp    80268a <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802638:	4c 89 e7             	mov    %r12,%rdi
+  80263b:	48 b8 6e 40 80 00 00 	movabs $0x80406e,%rax
+  802642:	00 00 00 
+  802645:	ff d0                	call   *%rax
+  802647:	41 89 c1             	mov    %eax,%r9d
+  80264a:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802651:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802655:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80265b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802660:	4c 89 e6             	mov    %r12,%rsi
+  802663:	bf 00 00 00 00       	mov    $0x0,%edi
+  802668:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  80266f:	00 00 00 
+  802672:	ff d0                	call   *%rax
+  802674:	85 c0                	test   %eax,%eax
+  802676:	78 17                	js     80268f <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802678:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80267c:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802683:	00 00 00 
+  802686:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80268a:	5b                   	pop    %rbx
+  80268b:	41 5c                	pop    %r12
+  80268d:	5d                   	pop    %rbp
+  80268e:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80268f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802694:	eb f4                	jmp    80268a <mmap_alloc+0x86>
+
+0000000000802696 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802696:	55                   	push   %rbp
+  802697:	48 89 e5             	mov    %rsp,%rbp
+  80269a:	41 56                	push   %r14
+  80269c:	41 55                	push   %r13
+  80269e:	41 54                	push   %r12
+  8026a0:	53                   	push   %rbx
+  8026a1:	48 83 ec 10          	sub    $0x10,%rsp
+  8026a5:	41 89 fc             	mov    %edi,%r12d
+  8026a8:	49 89 f5             	mov    %rsi,%r13
+  8026ab:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8026ae:	48 89 f0             	mov    %rsi,%rax
+  8026b1:	48 09 d0             	or     %rdx,%rax
+  8026b4:	75 0d                	jne    8026c3 <fsipc+0x2d>
+  8026b6:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8026b9:	83 f8 04             	cmp    $0x4,%eax
+  8026bc:	76 7d                	jbe    80273b <fsipc+0xa5>
+  8026be:	83 ff 0d             	cmp    $0xd,%edi
+  8026c1:	74 78                	je     80273b <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8026c3:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8026ca:	00 00 00 
+  8026cd:	ff d0                	call   *%rax
+  8026cf:	89 c7                	mov    %eax,%edi
+  8026d1:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8026d8:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8026df:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8026e6:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8026ec:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8026f3:	00 00 00 
+  8026f6:	44 89 e6             	mov    %r12d,%esi
+  8026f9:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  802700:	00 00 00 
+  802703:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802705:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80270c:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80270d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802712:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802716:	4c 89 ee             	mov    %r13,%rsi
+  802719:	bf 00 00 00 00       	mov    $0x0,%edi
+  80271e:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  802725:	00 00 00 
+  802728:	ff d0                	call   *%rax
+  80272a:	89 c3                	mov    %eax,%ebx
+}
+  80272c:	89 d8                	mov    %ebx,%eax
+  80272e:	48 83 c4 10          	add    $0x10,%rsp
+  802732:	5b                   	pop    %rbx
+  802733:	41 5c                	pop    %r12
+  802735:	41 5d                	pop    %r13
+  802737:	41 5e                	pop    %r14
+  802739:	5d                   	pop    %rbp
+  80273a:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80273b:	48 b8 48 21 80 00 00 	movabs $0x802148,%rax
+  802742:	00 00 00 
+  802745:	ff d0                	call   *%rax
+  802747:	49 89 c6             	mov    %rax,%r14
+  80274a:	48 85 c0             	test   %rax,%rax
+  80274d:	0f 84 70 ff ff ff    	je     8026c3 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802753:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802757:	48 b8 4b 42 80 00 00 	movabs $0x80424b,%rax
+  80275e:	00 00 00 
+  802761:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802763:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802766:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80276d:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802771:	ba 10 00 00 00       	mov    $0x10,%edx
+  802776:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80277d:	00 00 00 
+  802780:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  802787:	00 00 00 
+  80278a:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80278c:	4c 89 f7             	mov    %r14,%rdi
+  80278f:	48 b8 e4 21 80 00 00 	movabs $0x8021e4,%rax
+  802796:	00 00 00 
+  802799:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  80279b:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8027a2:	4c 89 f7             	mov    %r14,%rdi
+  8027a5:	48 b8 0e 43 80 00 00 	movabs $0x80430e,%rax
+  8027ac:	00 00 00 
+  8027af:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8027b1:	4c 89 f7             	mov    %r14,%rdi
+  8027b4:	48 b8 9c 42 80 00 00 	movabs $0x80429c,%rax
+  8027bb:	00 00 00 
+  8027be:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8027c0:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8027c3:	41 83 fc 05          	cmp    $0x5,%r12d
+  8027c7:	75 04                	jne    8027cd <fsipc+0x137>
+  8027c9:	85 db                	test   %ebx,%ebx
+  8027cb:	79 14                	jns    8027e1 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8027cd:	4c 89 f7             	mov    %r14,%rdi
+  8027d0:	48 b8 c3 42 80 00 00 	movabs $0x8042c3,%rax
+  8027d7:	00 00 00 
+  8027da:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8027dc:	e9 4b ff ff ff       	jmp    80272c <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8027e1:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8027e5:	ba 88 00 00 00       	mov    $0x88,%edx
+  8027ea:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8027f1:	00 00 00 
+  8027f4:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  8027fb:	00 00 00 
+  8027fe:	ff d0                	call   *%rax
+  802800:	eb cb                	jmp    8027cd <fsipc+0x137>
+
+0000000000802802 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802802:	55                   	push   %rbp
+  802803:	48 89 e5             	mov    %rsp,%rbp
+  802806:	41 57                	push   %r15
+  802808:	41 56                	push   %r14
+  80280a:	41 55                	push   %r13
+  80280c:	41 54                	push   %r12
+  80280e:	53                   	push   %rbx
+  80280f:	48 83 ec 18          	sub    $0x18,%rsp
+  802813:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802817:	49 89 f6             	mov    %rsi,%r14
+  80281a:	49 89 d4             	mov    %rdx,%r12
+  80281d:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802820:	48 b8 48 21 80 00 00 	movabs $0x802148,%rax
+  802827:	00 00 00 
+  80282a:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80282c:	48 85 c0             	test   %rax,%rax
+  80282f:	0f 85 96 00 00 00    	jne    8028cb <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802835:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80283c:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80283d:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802844:	00 00 00 
+    while (n) {
+  802847:	4d 85 e4             	test   %r12,%r12
+  80284a:	74 79                	je     8028c5 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80284c:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802851:	49 39 dc             	cmp    %rbx,%r12
+  802854:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802858:	48 89 da             	mov    %rbx,%rdx
+  80285b:	4c 89 f6             	mov    %r14,%rsi
+  80285e:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802865:	00 00 00 
+  802868:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  80286f:	00 00 00 
+  802872:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802874:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802878:	8b 40 0c             	mov    0xc(%rax),%eax
+  80287b:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80287e:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802881:	44 01 e8             	add    %r13d,%eax
+  802884:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802888:	41 0f 44 c5          	cmove  %r13d,%eax
+  80288c:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802890:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802894:	48 89 da             	mov    %rbx,%rdx
+  802897:	be 00 00 00 00       	mov    $0x0,%esi
+  80289c:	bf 04 00 00 00       	mov    $0x4,%edi
+  8028a1:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  8028a8:	00 00 00 
+  8028ab:	ff d0                	call   *%rax
+        if (res < 0)
+  8028ad:	85 c0                	test   %eax,%eax
+  8028af:	78 4a                	js     8028fb <devfile_write_direct+0xf9>
+        buf += res;
+  8028b1:	48 98                	cltq
+  8028b3:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8028b6:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8028ba:	49 29 c4             	sub    %rax,%r12
+  8028bd:	75 8d                	jne    80284c <devfile_write_direct+0x4a>
+    return write;
+  8028bf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8028c3:	eb 27                	jmp    8028ec <devfile_write_direct+0xea>
+    size_t write = 0;
+  8028c5:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8028c9:	eb f4                	jmp    8028bf <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028cb:	45 89 e9             	mov    %r13d,%r9d
+  8028ce:	4d 89 e0             	mov    %r12,%r8
+  8028d1:	4c 89 f1             	mov    %r14,%rcx
+  8028d4:	ba 04 00 00 00       	mov    $0x4,%edx
+  8028d9:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8028dd:	48 89 c7             	mov    %rax,%rdi
+  8028e0:	48 b8 2f 22 80 00 00 	movabs $0x80222f,%rax
+  8028e7:	00 00 00 
+  8028ea:	ff d0                	call   *%rax
+}
+  8028ec:	48 83 c4 18          	add    $0x18,%rsp
+  8028f0:	5b                   	pop    %rbx
+  8028f1:	41 5c                	pop    %r12
+  8028f3:	41 5d                	pop    %r13
+  8028f5:	41 5e                	pop    %r14
+  8028f7:	41 5f                	pop    %r15
+  8028f9:	5d                   	pop    %rbp
+  8028fa:	c3                   	ret
+            return res;
+  8028fb:	48 98                	cltq
+  8028fd:	eb ed                	jmp    8028ec <devfile_write_direct+0xea>
+
+00000000008028ff <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8028ff:	55                   	push   %rbp
+  802900:	48 89 e5             	mov    %rsp,%rbp
+  802903:	41 54                	push   %r12
+  802905:	53                   	push   %rbx
+  802906:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  802909:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  802910:	00 00 00 
+  802913:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802915:	48 85 c0             	test   %rax,%rax
+  802918:	74 71                	je     80298b <fbuf_flush+0x8c>
+  80291a:	48 89 c3             	mov    %rax,%rbx
+  80291d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802922:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802926:	75 05                	jne    80292d <fbuf_flush+0x2e>
+}
+  802928:	5b                   	pop    %rbx
+  802929:	41 5c                	pop    %r12
+  80292b:	5d                   	pop    %rbp
+  80292c:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80292d:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802930:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802934:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80293b:	00 00 00 
+  80293e:	48 89 de             	mov    %rbx,%rsi
+  802941:	48 29 c6             	sub    %rax,%rsi
+  802944:	48 c1 fe 03          	sar    $0x3,%rsi
+  802948:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80294f:	aa aa aa 
+  802952:	48 0f af f0          	imul   %rax,%rsi
+  802956:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80295a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80295f:	48 01 c6             	add    %rax,%rsi
+  802962:	4c 89 e7             	mov    %r12,%rdi
+  802965:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  80296c:	00 00 00 
+  80296f:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802971:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802975:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  80297c:	00 
+    return res < 0 ? res : 0;
+  80297d:	48 85 c0             	test   %rax,%rax
+  802980:	ba 00 00 00 00       	mov    $0x0,%edx
+  802985:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802989:	eb 9d                	jmp    802928 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  80298b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802990:	eb 96                	jmp    802928 <fbuf_flush+0x29>
+
+0000000000802992 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802992:	55                   	push   %rbp
+  802993:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802996:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  80299d:	00 00 00 
+  8029a0:	ff d0                	call   *%rax
+}
+  8029a2:	5d                   	pop    %rbp
+  8029a3:	c3                   	ret
+
+00000000008029a4 <devfile_write>:
+    if (!fd || !buf)
+  8029a4:	48 85 ff             	test   %rdi,%rdi
+  8029a7:	0f 84 d3 01 00 00    	je     802b80 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8029ad:	55                   	push   %rbp
+  8029ae:	48 89 e5             	mov    %rsp,%rbp
+  8029b1:	41 57                	push   %r15
+  8029b3:	41 56                	push   %r14
+  8029b5:	41 55                	push   %r13
+  8029b7:	41 54                	push   %r12
+  8029b9:	53                   	push   %rbx
+  8029ba:	48 83 ec 08          	sub    $0x8,%rsp
+  8029be:	49 89 fc             	mov    %rdi,%r12
+  8029c1:	49 89 f6             	mov    %rsi,%r14
+  8029c4:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8029c7:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8029cc:	48 85 f6             	test   %rsi,%rsi
+  8029cf:	0f 84 9c 01 00 00    	je     802b71 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8029d5:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  8029dc:	00 00 00 
+  8029df:	ff d0                	call   *%rax
+  8029e1:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8029e4:	48 85 c0             	test   %rax,%rax
+  8029e7:	0f 84 a2 00 00 00    	je     802a8f <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8029ed:	be 00 10 00 00       	mov    $0x1000,%esi
+  8029f2:	4c 89 e7             	mov    %r12,%rdi
+  8029f5:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  8029fc:	00 00 00 
+  8029ff:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a01:	83 f8 02             	cmp    $0x2,%eax
+  802a04:	0f 8f 85 00 00 00    	jg     802a8f <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802a0a:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802a11:	00 00 00 
+  802a14:	4d 89 ef             	mov    %r13,%r15
+  802a17:	49 29 c7             	sub    %rax,%r15
+  802a1a:	49 c1 ff 03          	sar    $0x3,%r15
+  802a1e:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802a25:	aa aa aa 
+  802a28:	4c 0f af f8          	imul   %rax,%r15
+  802a2c:	49 c1 e7 0e          	shl    $0xe,%r15
+  802a30:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a35:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802a38:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a3d:	0f 84 d7 00 00 00    	je     802b1a <devfile_write+0x176>
+  802a43:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802a47:	89 c2                	mov    %eax,%edx
+  802a49:	41 03 55 0c          	add    0xc(%r13),%edx
+  802a4d:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802a52:	75 0f                	jne    802a63 <devfile_write+0xbf>
+  802a54:	48 01 d8             	add    %rbx,%rax
+  802a57:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802a5d:	0f 86 92 00 00 00    	jbe    802af5 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802a63:	4c 89 e7             	mov    %r12,%rdi
+  802a66:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  802a6d:	00 00 00 
+  802a70:	ff d0                	call   *%rax
+  802a72:	85 c0                	test   %eax,%eax
+  802a74:	78 52                	js     802ac8 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a76:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802a7d:	77 7f                	ja     802afe <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802a7f:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802a84:	0f 85 c2 00 00 00    	jne    802b4c <devfile_write+0x1a8>
+  802a8a:	e9 94 00 00 00       	jmp    802b23 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802a8f:	4c 89 e7             	mov    %r12,%rdi
+  802a92:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802a9e:	85 c0                	test   %eax,%eax
+  802aa0:	79 07                	jns    802aa9 <devfile_write+0x105>
+  802aa2:	48 98                	cltq
+  802aa4:	e9 c8 00 00 00       	jmp    802b71 <devfile_write+0x1cd>
+  802aa9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802aae:	48 89 da             	mov    %rbx,%rdx
+  802ab1:	4c 89 f6             	mov    %r14,%rsi
+  802ab4:	4c 89 e7             	mov    %r12,%rdi
+  802ab7:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802abe:	00 00 00 
+  802ac1:	ff d0                	call   *%rax
+  802ac3:	e9 a9 00 00 00       	jmp    802b71 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802ac8:	48 98                	cltq
+  802aca:	e9 a2 00 00 00       	jmp    802b71 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802acf:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802ad4:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802ad9:	4c 89 fe             	mov    %r15,%rsi
+  802adc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ae1:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  802ae8:	00 00 00 
+  802aeb:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802aed:	85 c0                	test   %eax,%eax
+  802aef:	79 45                	jns    802b36 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802af1:	48 98                	cltq
+  802af3:	eb 7c                	jmp    802b71 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802af5:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802afc:	76 4e                	jbe    802b4c <devfile_write+0x1a8>
+  802afe:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b03:	48 89 da             	mov    %rbx,%rdx
+  802b06:	4c 89 f6             	mov    %r14,%rsi
+  802b09:	4c 89 e7             	mov    %r12,%rdi
+  802b0c:	48 b8 02 28 80 00 00 	movabs $0x802802,%rax
+  802b13:	00 00 00 
+  802b16:	ff d0                	call   *%rax
+  802b18:	eb 57                	jmp    802b71 <devfile_write+0x1cd>
+  802b1a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b21:	77 db                	ja     802afe <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802b23:	4c 89 ff             	mov    %r15,%rdi
+  802b26:	48 b8 cd 40 80 00 00 	movabs $0x8040cd,%rax
+  802b2d:	00 00 00 
+  802b30:	ff d0                	call   *%rax
+  802b32:	84 c0                	test   %al,%al
+  802b34:	74 99                	je     802acf <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802b36:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802b3b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802b40:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802b44:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802b4b:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802b4c:	4c 89 ff             	mov    %r15,%rdi
+  802b4f:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802b53:	48 89 da             	mov    %rbx,%rdx
+  802b56:	4c 89 f6             	mov    %r14,%rsi
+  802b59:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802b65:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802b69:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802b6e:	48 89 d8             	mov    %rbx,%rax
+}
+  802b71:	48 83 c4 08          	add    $0x8,%rsp
+  802b75:	5b                   	pop    %rbx
+  802b76:	41 5c                	pop    %r12
+  802b78:	41 5d                	pop    %r13
+  802b7a:	41 5e                	pop    %r14
+  802b7c:	41 5f                	pop    %r15
+  802b7e:	5d                   	pop    %rbp
+  802b7f:	c3                   	ret
+        return E_INVAL;
+  802b80:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802b85:	c3                   	ret
+
+0000000000802b86 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802b86:	55                   	push   %rbp
+  802b87:	48 89 e5             	mov    %rsp,%rbp
+  802b8a:	41 54                	push   %r12
+  802b8c:	53                   	push   %rbx
+  802b8d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802b90:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  802b97:	00 00 00 
+  802b9a:	ff d0                	call   *%rax
+  802b9c:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802b9f:	48 89 df             	mov    %rbx,%rdi
+  802ba2:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  802ba9:	00 00 00 
+  802bac:	ff d0                	call   *%rax
+  802bae:	48 85 c0             	test   %rax,%rax
+  802bb1:	74 17                	je     802bca <devfile_flush+0x44>
+  802bb3:	48 89 df             	mov    %rbx,%rdi
+  802bb6:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  802bbd:	00 00 00 
+  802bc0:	ff d0                	call   *%rax
+  802bc2:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802bc9:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802bca:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802bcd:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802bd4:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802bd6:	ba 00 00 00 00       	mov    $0x0,%edx
+  802bdb:	be 00 00 00 00       	mov    $0x0,%esi
+  802be0:	bf 06 00 00 00       	mov    $0x6,%edi
+  802be5:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  802bec:	00 00 00 
+  802bef:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802bf1:	45 85 e4             	test   %r12d,%r12d
+  802bf4:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802bf8:	5b                   	pop    %rbx
+  802bf9:	41 5c                	pop    %r12
+  802bfb:	5d                   	pop    %rbp
+  802bfc:	c3                   	ret
+
+0000000000802bfd <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802bfd:	55                   	push   %rbp
+  802bfe:	48 89 e5             	mov    %rsp,%rbp
+  802c01:	41 57                	push   %r15
+  802c03:	41 56                	push   %r14
+  802c05:	41 55                	push   %r13
+  802c07:	41 54                	push   %r12
+  802c09:	53                   	push   %rbx
+  802c0a:	48 83 ec 38          	sub    $0x38,%rsp
+  802c0e:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802c12:	49 89 f7             	mov    %rsi,%r15
+  802c15:	48 89 d3             	mov    %rdx,%rbx
+  802c18:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802c1b:	48 b8 48 21 80 00 00 	movabs $0x802148,%rax
+  802c22:	00 00 00 
+  802c25:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c27:	48 85 c0             	test   %rax,%rax
+  802c2a:	75 20                	jne    802c4c <devfile_read_direct+0x4f>
+    bool map = 1;
+  802c2c:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802c31:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802c38:	00 
+    while (n) {
+  802c39:	48 85 db             	test   %rbx,%rbx
+  802c3c:	0f 85 df 00 00 00    	jne    802d21 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802c42:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802c46:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c4a:	eb 21                	jmp    802c6d <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802c4c:	45 89 f1             	mov    %r14d,%r9d
+  802c4f:	49 89 d8             	mov    %rbx,%r8
+  802c52:	4c 89 f9             	mov    %r15,%rcx
+  802c55:	ba 03 00 00 00       	mov    $0x3,%edx
+  802c5a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802c5e:	48 89 c7             	mov    %rax,%rdi
+  802c61:	48 b8 2f 22 80 00 00 	movabs $0x80222f,%rax
+  802c68:	00 00 00 
+  802c6b:	ff d0                	call   *%rax
+}
+  802c6d:	48 83 c4 38          	add    $0x38,%rsp
+  802c71:	5b                   	pop    %rbx
+  802c72:	41 5c                	pop    %r12
+  802c74:	41 5d                	pop    %r13
+  802c76:	41 5e                	pop    %r14
+  802c78:	41 5f                	pop    %r15
+  802c7a:	5d                   	pop    %rbp
+  802c7b:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802c7c:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802c80:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802c86:	75 1e                	jne    802ca6 <devfile_read_direct+0xa9>
+  802c88:	e9 e2 00 00 00       	jmp    802d6f <devfile_read_direct+0x172>
+            if (!res) return read;
+  802c8d:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802c91:	eb da                	jmp    802c6d <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802c93:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802c97:	0f 85 d0 01 00 00    	jne    802e6d <devfile_read_direct+0x270>
+            map = 0;
+  802c9d:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ca1:	eb 03                	jmp    802ca6 <devfile_read_direct+0xa9>
+  802ca3:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802ca6:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802cab:	48 39 d3             	cmp    %rdx,%rbx
+  802cae:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802cb2:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802cb6:	8b 40 0c             	mov    0xc(%rax),%eax
+  802cb9:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802cc0:	00 00 00 
+  802cc3:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802cc5:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802cc9:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802ccd:	be 00 00 00 00       	mov    $0x0,%esi
+  802cd2:	bf 03 00 00 00       	mov    $0x3,%edi
+  802cd7:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  802cde:	00 00 00 
+  802ce1:	ff d0                	call   *%rax
+        if (res <= 0)
+  802ce3:	85 c0                	test   %eax,%eax
+  802ce5:	0f 8e 63 01 00 00    	jle    802e4e <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802ceb:	4c 63 e0             	movslq %eax,%r12
+  802cee:	4c 89 e2             	mov    %r12,%rdx
+  802cf1:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802cf8:	00 00 00 
+  802cfb:	4c 89 ff             	mov    %r15,%rdi
+  802cfe:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  802d05:	00 00 00 
+  802d08:	ff d0                	call   *%rax
+        buf += res;
+  802d0a:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802d0d:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802d10:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802d14:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802d18:	48 85 db             	test   %rbx,%rbx
+  802d1b:	0f 84 25 ff ff ff    	je     802c46 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802d21:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802d24:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802d28:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802d2c:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d30:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802d37:	0f 97 c2             	seta   %dl
+  802d3a:	20 c2                	and    %al,%dl
+  802d3c:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802d3f:	0f 84 5e ff ff ff    	je     802ca3 <devfile_read_direct+0xa6>
+  802d45:	4c 89 fa             	mov    %r15,%rdx
+  802d48:	4d 89 fd             	mov    %r15,%r13
+  802d4b:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802d52:	0f 85 4e ff ff ff    	jne    802ca6 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802d58:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802d5c:	0f 84 1a ff ff ff    	je     802c7c <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d62:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802d69:	0f 85 37 ff ff ff    	jne    802ca6 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802d6f:	48 89 d8             	mov    %rbx,%rax
+  802d72:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802d78:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802d7d:	48 39 c8             	cmp    %rcx,%rax
+  802d80:	48 0f 47 c1          	cmova  %rcx,%rax
+  802d84:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802d88:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802d8c:	49 89 d4             	mov    %rdx,%r12
+  802d8f:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802d93:	48 b8 6e 40 80 00 00 	movabs $0x80406e,%rax
+  802d9a:	00 00 00 
+  802d9d:	ff d0                	call   *%rax
+  802d9f:	a8 40                	test   $0x40,%al
+  802da1:	0f 85 b9 00 00 00    	jne    802e60 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802da7:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802dae:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802db2:	49 39 c5             	cmp    %rax,%r13
+  802db5:	72 d8                	jb     802d8f <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802db7:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802dbb:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802dc2:	00 00 00 
+  802dc5:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802dc9:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802dcc:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802dce:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802dd2:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802dd6:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802ddd:	00 00 00 
+  802de0:	ff d0                	call   *%rax
+  802de2:	89 c7                	mov    %eax,%edi
+  802de4:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802dea:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802def:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802df6:	00 00 00 
+  802df9:	be 0e 00 00 00       	mov    $0xe,%esi
+  802dfe:	48 b8 fc 17 80 00 00 	movabs $0x8017fc,%rax
+  802e05:	00 00 00 
+  802e08:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802e0a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802e0f:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802e13:	4c 89 fe             	mov    %r15,%rsi
+  802e16:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e1b:	48 b8 d8 17 80 00 00 	movabs $0x8017d8,%rax
+  802e22:	00 00 00 
+  802e25:	ff d0                	call   *%rax
+  802e27:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802e2a:	48 85 d2             	test   %rdx,%rdx
+  802e2d:	0f 84 5a fe ff ff    	je     802c8d <devfile_read_direct+0x90>
+            if (res > 0) {
+  802e33:	0f 8e 5a fe ff ff    	jle    802c93 <devfile_read_direct+0x96>
+                buf += res;
+  802e39:	48 98                	cltq
+  802e3b:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802e3e:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802e41:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802e45:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802e49:	e9 ca fe ff ff       	jmp    802d18 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802e4e:	41 89 c5             	mov    %eax,%r13d
+  802e51:	48 98                	cltq
+  802e53:	45 85 ed             	test   %r13d,%r13d
+  802e56:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802e5b:	e9 0d fe ff ff       	jmp    802c6d <devfile_read_direct+0x70>
+            map = 0;
+  802e60:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e64:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802e68:	e9 39 fe ff ff       	jmp    802ca6 <devfile_read_direct+0xa9>
+  802e6d:	48 89 d0             	mov    %rdx,%rax
+  802e70:	e9 f8 fd ff ff       	jmp    802c6d <devfile_read_direct+0x70>
+
+0000000000802e75 <devfile_read>:
+    if (!fd || !buf)
+  802e75:	48 85 ff             	test   %rdi,%rdi
+  802e78:	0f 84 21 02 00 00    	je     80309f <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802e7e:	55                   	push   %rbp
+  802e7f:	48 89 e5             	mov    %rsp,%rbp
+  802e82:	41 57                	push   %r15
+  802e84:	41 56                	push   %r14
+  802e86:	41 55                	push   %r13
+  802e88:	41 54                	push   %r12
+  802e8a:	53                   	push   %rbx
+  802e8b:	48 83 ec 28          	sub    $0x28,%rsp
+  802e8f:	48 89 fb             	mov    %rdi,%rbx
+  802e92:	49 89 f4             	mov    %rsi,%r12
+  802e95:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802e98:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802e9d:	48 85 f6             	test   %rsi,%rsi
+  802ea0:	74 4b                	je     802eed <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802ea2:	48 b8 b2 21 80 00 00 	movabs $0x8021b2,%rax
+  802ea9:	00 00 00 
+  802eac:	ff d0                	call   *%rax
+  802eae:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802eb1:	48 85 c0             	test   %rax,%rax
+  802eb4:	74 22                	je     802ed8 <devfile_read+0x63>
+  802eb6:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802ebd:	77 19                	ja     802ed8 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802ebf:	be 00 10 00 00       	mov    $0x1000,%esi
+  802ec4:	48 89 df             	mov    %rbx,%rdi
+  802ec7:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  802ece:	00 00 00 
+  802ed1:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ed3:	83 f8 02             	cmp    $0x2,%eax
+  802ed6:	7e 40                	jle    802f18 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802ed8:	48 89 df             	mov    %rbx,%rdi
+  802edb:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  802ee2:	00 00 00 
+  802ee5:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802ee7:	85 c0                	test   %eax,%eax
+  802ee9:	79 11                	jns    802efc <devfile_read+0x87>
+  802eeb:	48 98                	cltq
+}
+  802eed:	48 83 c4 28          	add    $0x28,%rsp
+  802ef1:	5b                   	pop    %rbx
+  802ef2:	41 5c                	pop    %r12
+  802ef4:	41 5d                	pop    %r13
+  802ef6:	41 5e                	pop    %r14
+  802ef8:	41 5f                	pop    %r15
+  802efa:	5d                   	pop    %rbp
+  802efb:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802efc:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f01:	4c 89 ea             	mov    %r13,%rdx
+  802f04:	4c 89 e6             	mov    %r12,%rsi
+  802f07:	48 89 df             	mov    %rbx,%rdi
+  802f0a:	48 b8 fd 2b 80 00 00 	movabs $0x802bfd,%rax
+  802f11:	00 00 00 
+  802f14:	ff d0                	call   *%rax
+  802f16:	eb d5                	jmp    802eed <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802f18:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802f1c:	48 89 df             	mov    %rbx,%rdi
+  802f1f:	48 b8 ff 28 80 00 00 	movabs $0x8028ff,%rax
+  802f26:	00 00 00 
+  802f29:	ff d0                	call   *%rax
+  802f2b:	85 c0                	test   %eax,%eax
+  802f2d:	0f 88 33 01 00 00    	js     803066 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802f33:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802f3a:	00 00 00 
+  802f3d:	4c 89 f0             	mov    %r14,%rax
+  802f40:	48 29 d0             	sub    %rdx,%rax
+  802f43:	48 c1 f8 03          	sar    $0x3,%rax
+  802f47:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802f4e:	aa aa aa 
+  802f51:	48 0f af c2          	imul   %rdx,%rax
+  802f55:	48 c1 e0 0e          	shl    $0xe,%rax
+  802f59:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802f5d:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802f60:	41 39 06             	cmp    %eax,(%r14)
+  802f63:	75 0d                	jne    802f72 <devfile_read+0xfd>
+  802f65:	8b 43 10             	mov    0x10(%rbx),%eax
+  802f68:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802f6c:	0f 84 fb 00 00 00    	je     80306d <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802f72:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802f77:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802f7b:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802f7e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802f82:	48 89 c7             	mov    %rax,%rdi
+  802f85:	48 b8 cd 40 80 00 00 	movabs $0x8040cd,%rax
+  802f8c:	00 00 00 
+  802f8f:	ff d0                	call   *%rax
+  802f91:	84 c0                	test   %al,%al
+  802f93:	75 27                	jne    802fbc <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802f95:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802f9a:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802f9f:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fa3:	bf 00 00 00 00       	mov    $0x0,%edi
+  802fa8:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802fb4:	85 c0                	test   %eax,%eax
+  802fb6:	0f 88 dc 00 00 00    	js     803098 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802fbc:	44 89 f8             	mov    %r15d,%eax
+  802fbf:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802fc4:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802fc6:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802fcd:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802fce:	8b 43 10             	mov    0x10(%rbx),%eax
+  802fd1:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802fd5:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802fd8:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802fdd:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802fe1:	48 89 df             	mov    %rbx,%rdi
+  802fe4:	48 b8 fd 2b 80 00 00 	movabs $0x802bfd,%rax
+  802feb:	00 00 00 
+  802fee:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802ff0:	48 85 c0             	test   %rax,%rax
+  802ff3:	0f 88 f4 fe ff ff    	js     802eed <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802ff9:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802ffc:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802fff:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803002:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803006:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  80300a:	48 63 d1             	movslq %ecx,%rdx
+  80300d:	48 01 d0             	add    %rdx,%rax
+  803010:	4d 63 ff             	movslq %r15d,%r15
+  803013:	4c 29 f8             	sub    %r15,%rax
+  803016:	ba 00 00 00 00       	mov    $0x0,%edx
+  80301b:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  80301f:	48 85 c0             	test   %rax,%rax
+  803022:	0f 8e c5 fe ff ff    	jle    802eed <devfile_read+0x78>
+    n = MIN(n, res);
+  803028:	4c 39 e8             	cmp    %r13,%rax
+  80302b:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  80302f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803032:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803036:	48 63 f6             	movslq %esi,%rsi
+  803039:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80303e:	48 01 c6             	add    %rax,%rsi
+  803041:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803045:	48 01 c6             	add    %rax,%rsi
+  803048:	4c 89 ea             	mov    %r13,%rdx
+  80304b:	4c 89 e7             	mov    %r12,%rdi
+  80304e:	48 b8 99 0e 80 00 00 	movabs $0x800e99,%rax
+  803055:	00 00 00 
+  803058:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  80305a:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  80305e:	4c 89 e8             	mov    %r13,%rax
+  803061:	e9 87 fe ff ff       	jmp    802eed <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803066:	48 98                	cltq
+  803068:	e9 80 fe ff ff       	jmp    802eed <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80306d:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803071:	41 39 d7             	cmp    %edx,%r15d
+  803074:	0f 8c f8 fe ff ff    	jl     802f72 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80307a:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80307e:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803081:	41 39 cf             	cmp    %ecx,%r15d
+  803084:	0f 8d e8 fe ff ff    	jge    802f72 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80308a:	4d 63 ff             	movslq %r15d,%r15
+  80308d:	4c 29 f8             	sub    %r15,%rax
+  803090:	48 63 d2             	movslq %edx,%rdx
+  803093:	48 01 d0             	add    %rdx,%rax
+  803096:	eb 87                	jmp    80301f <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803098:	48 98                	cltq
+  80309a:	e9 4e fe ff ff       	jmp    802eed <devfile_read+0x78>
+        return E_INVAL;
+  80309f:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8030a4:	c3                   	ret
+
+00000000008030a5 <fs_channel>:
+fs_channel(bool enable) {
+  8030a5:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  8030a7:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  8030ae:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  8030b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b5:	40 84 ff             	test   %dil,%dil
+  8030b8:	74 47                	je     803101 <fs_channel+0x5c>
+  8030ba:	48 a1 08 00 81 00 00 	movabs 0x810008,%rax
+  8030c1:	00 00 00 
+  8030c4:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  8030ca:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8030d1:	00 00 00 
+  8030d4:	3b 08                	cmp    (%rax),%ecx
+  8030d6:	74 29                	je     803101 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  8030d8:	55                   	push   %rbp
+  8030d9:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  8030dc:	48 b8 25 20 80 00 00 	movabs $0x802025,%rax
+  8030e3:	00 00 00 
+  8030e6:	ff d0                	call   *%rax
+  8030e8:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  8030ea:	85 c0                	test   %eax,%eax
+  8030ec:	78 04                	js     8030f2 <fs_channel+0x4d>
+}
+  8030ee:	89 d0                	mov    %edx,%eax
+  8030f0:	5d                   	pop    %rbp
+  8030f1:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  8030f2:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8030f9:	00 00 00 
+  8030fc:	c6 00 00             	movb   $0x0,(%rax)
+  8030ff:	eb ed                	jmp    8030ee <fs_channel+0x49>
+}
+  803101:	89 d0                	mov    %edx,%eax
+  803103:	c3                   	ret
+
+0000000000803104 <open>:
+open(const char *path, int mode) {
+  803104:	55                   	push   %rbp
+  803105:	48 89 e5             	mov    %rsp,%rbp
+  803108:	41 55                	push   %r13
+  80310a:	41 54                	push   %r12
+  80310c:	53                   	push   %rbx
+  80310d:	48 83 ec 18          	sub    $0x18,%rsp
+  803111:	49 89 fc             	mov    %rdi,%r12
+  803114:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803117:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  80311e:	00 00 00 
+  803121:	ff d0                	call   *%rax
+  803123:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803129:	0f 87 8f 00 00 00    	ja     8031be <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80312f:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803133:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  80313a:	00 00 00 
+  80313d:	ff d0                	call   *%rax
+  80313f:	89 c3                	mov    %eax,%ebx
+  803141:	85 c0                	test   %eax,%eax
+  803143:	78 55                	js     80319a <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803145:	4c 89 e6             	mov    %r12,%rsi
+  803148:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  80314f:	00 00 00 
+  803152:	48 89 df             	mov    %rbx,%rdi
+  803155:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  80315c:	00 00 00 
+  80315f:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803161:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803168:	ba 00 00 00 00       	mov    $0x0,%edx
+  80316d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803171:	bf 01 00 00 00       	mov    $0x1,%edi
+  803176:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  80317d:	00 00 00 
+  803180:	ff d0                	call   *%rax
+  803182:	89 c3                	mov    %eax,%ebx
+  803184:	85 c0                	test   %eax,%eax
+  803186:	78 1f                	js     8031a7 <open+0xa3>
+    return fd2num(fd);
+  803188:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80318c:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  803193:	00 00 00 
+  803196:	ff d0                	call   *%rax
+  803198:	89 c3                	mov    %eax,%ebx
+}
+  80319a:	89 d8                	mov    %ebx,%eax
+  80319c:	48 83 c4 18          	add    $0x18,%rsp
+  8031a0:	5b                   	pop    %rbx
+  8031a1:	41 5c                	pop    %r12
+  8031a3:	41 5d                	pop    %r13
+  8031a5:	5d                   	pop    %rbp
+  8031a6:	c3                   	ret
+        fd_close(fd, 0);
+  8031a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8031ac:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8031b0:	48 b8 fa 19 80 00 00 	movabs $0x8019fa,%rax
+  8031b7:	00 00 00 
+  8031ba:	ff d0                	call   *%rax
+        return res;
+  8031bc:	eb dc                	jmp    80319a <open+0x96>
+        return -E_BAD_PATH;
+  8031be:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  8031c3:	eb d5                	jmp    80319a <open+0x96>
+
+00000000008031c5 <file_flush_buffers>:
+file_flush_buffers(void) {
+  8031c5:	55                   	push   %rbp
+  8031c6:	48 89 e5             	mov    %rsp,%rbp
+  8031c9:	41 56                	push   %r14
+  8031cb:	41 55                	push   %r13
+  8031cd:	41 54                	push   %r12
+  8031cf:	53                   	push   %rbx
+  8031d0:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  8031d4:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  8031db:	00 00 00 
+  8031de:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8031e3:	49 bd 3f 19 80 00 00 	movabs $0x80193f,%r13
+  8031ea:	00 00 00 
+  8031ed:	49 be ff 28 80 00 00 	movabs $0x8028ff,%r14
+  8031f4:	00 00 00 
+  8031f7:	eb 0c                	jmp    803205 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  8031f9:	83 c3 01             	add    $0x1,%ebx
+  8031fc:	49 83 c4 18          	add    $0x18,%r12
+  803200:	83 fb 20             	cmp    $0x20,%ebx
+  803203:	74 1d                	je     803222 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803205:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80320a:	74 ed                	je     8031f9 <file_flush_buffers+0x34>
+  80320c:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803210:	89 df                	mov    %ebx,%edi
+  803212:	41 ff d5             	call   *%r13
+  803215:	85 c0                	test   %eax,%eax
+  803217:	78 e0                	js     8031f9 <file_flush_buffers+0x34>
+  803219:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80321d:	41 ff d6             	call   *%r14
+  803220:	eb d7                	jmp    8031f9 <file_flush_buffers+0x34>
+}
+  803222:	48 83 c4 10          	add    $0x10,%rsp
+  803226:	5b                   	pop    %rbx
+  803227:	41 5c                	pop    %r12
+  803229:	41 5d                	pop    %r13
+  80322b:	41 5e                	pop    %r14
+  80322d:	5d                   	pop    %rbp
+  80322e:	c3                   	ret
+
+000000000080322f <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80322f:	55                   	push   %rbp
+  803230:	48 89 e5             	mov    %rsp,%rbp
+  803233:	41 54                	push   %r12
+  803235:	53                   	push   %rbx
+  803236:	49 89 fc             	mov    %rdi,%r12
+  803239:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80323b:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  803242:	00 00 00 
+  803245:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803247:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80324e:	00 00 00 
+  803251:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803256:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803258:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80325b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803260:	be 00 00 00 00       	mov    $0x0,%esi
+  803265:	bf 02 00 00 00       	mov    $0x2,%edi
+  80326a:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  803271:	00 00 00 
+  803274:	ff d0                	call   *%rax
+}
+  803276:	5b                   	pop    %rbx
+  803277:	41 5c                	pop    %r12
+  803279:	5d                   	pop    %rbp
+  80327a:	c3                   	ret
+
+000000000080327b <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  80327b:	55                   	push   %rbp
+  80327c:	48 89 e5             	mov    %rsp,%rbp
+  80327f:	41 54                	push   %r12
+  803281:	53                   	push   %rbx
+  803282:	49 89 fc             	mov    %rdi,%r12
+  803285:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803288:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80328f:	00 00 00 
+  803292:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803294:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803299:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8032a0:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8032a2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a7:	be 00 00 00 00       	mov    $0x0,%esi
+  8032ac:	bf 05 00 00 00       	mov    $0x5,%edi
+  8032b1:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  8032b8:	00 00 00 
+  8032bb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032bd:	85 c0                	test   %eax,%eax
+  8032bf:	78 3d                	js     8032fe <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8032c1:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8032c8:	00 00 00 
+  8032cb:	4c 89 e6             	mov    %r12,%rsi
+  8032ce:	48 89 df             	mov    %rbx,%rdi
+  8032d1:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  8032d8:	00 00 00 
+  8032db:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8032dd:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8032e4:	00 
+  8032e5:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8032eb:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8032f2:	00 
+  8032f3:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8032f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032fe:	5b                   	pop    %rbx
+  8032ff:	41 5c                	pop    %r12
+  803301:	5d                   	pop    %rbp
+  803302:	c3                   	ret
+
+0000000000803303 <remove>:
+remove(const char *path) {
+  803303:	55                   	push   %rbp
+  803304:	48 89 e5             	mov    %rsp,%rbp
+  803307:	53                   	push   %rbx
+  803308:	48 83 ec 08          	sub    $0x8,%rsp
+  80330c:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80330f:	48 b8 fa 0b 80 00 00 	movabs $0x800bfa,%rax
+  803316:	00 00 00 
+  803319:	ff d0                	call   *%rax
+  80331b:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803321:	77 3a                	ja     80335d <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803323:	48 89 de             	mov    %rbx,%rsi
+  803326:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80332d:	00 00 00 
+  803330:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  803337:	00 00 00 
+  80333a:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80333c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803341:	be 00 00 00 00       	mov    $0x0,%esi
+  803346:	bf 07 00 00 00       	mov    $0x7,%edi
+  80334b:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  803352:	00 00 00 
+  803355:	ff d0                	call   *%rax
+}
+  803357:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80335b:	c9                   	leave
+  80335c:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80335d:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803362:	eb f3                	jmp    803357 <remove+0x54>
+
+0000000000803364 <sync>:
+sync(void) {
+  803364:	55                   	push   %rbp
+  803365:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803368:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  80336f:	00 00 00 
+  803372:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803374:	ba 00 00 00 00       	mov    $0x0,%edx
+  803379:	be 00 00 00 00       	mov    $0x0,%esi
+  80337e:	bf 08 00 00 00       	mov    $0x8,%edi
+  803383:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  80338a:	00 00 00 
+  80338d:	ff d0                	call   *%rax
+}
+  80338f:	5d                   	pop    %rbp
+  803390:	c3                   	ret
+
+0000000000803391 <fsync>:
+fsync(int fdnum) {
+  803391:	55                   	push   %rbp
+  803392:	48 89 e5             	mov    %rsp,%rbp
+  803395:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803399:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80339d:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  8033a4:	00 00 00 
+  8033a7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8033a9:	85 c0                	test   %eax,%eax
+  8033ab:	78 4b                	js     8033f8 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033ad:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8033b1:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8033b8:	00 00 00 
+  8033bb:	8b 00                	mov    (%rax),%eax
+  8033bd:	39 02                	cmp    %eax,(%rdx)
+  8033bf:	75 39                	jne    8033fa <fsync+0x69>
+    file_flush_buffers();
+  8033c1:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  8033c8:	00 00 00 
+  8033cb:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8033cd:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8033d1:	8b 40 0c             	mov    0xc(%rax),%eax
+  8033d4:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8033db:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8033dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e2:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e7:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8033ec:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  8033f3:	00 00 00 
+  8033f6:	ff d0                	call   *%rax
+}
+  8033f8:	c9                   	leave
+  8033f9:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8033fa:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8033ff:	eb f7                	jmp    8033f8 <fsync+0x67>
+
+0000000000803401 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803401:	55                   	push   %rbp
+  803402:	48 89 e5             	mov    %rsp,%rbp
+  803405:	53                   	push   %rbx
+  803406:	48 83 ec 08          	sub    $0x8,%rsp
+  80340a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80340d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803412:	be 00 00 00 00       	mov    $0x0,%esi
+  803417:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80341c:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  803423:	00 00 00 
+  803426:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803428:	85 c0                	test   %eax,%eax
+  80342a:	78 2d                	js     803459 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80342c:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803433:	00 00 00 
+  803436:	48 8b 10             	mov    (%rax),%rdx
+  803439:	48 89 13             	mov    %rdx,(%rbx)
+  80343c:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803440:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803444:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803448:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80344c:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803450:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803454:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803459:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80345d:	c9                   	leave
+  80345e:	c3                   	ret
+
+000000000080345f <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80345f:	55                   	push   %rbp
+  803460:	48 89 e5             	mov    %rsp,%rbp
+  803463:	53                   	push   %rbx
+  803464:	48 83 ec 08          	sub    $0x8,%rsp
+  803468:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80346b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803470:	be 00 00 00 00       	mov    $0x0,%esi
+  803475:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80347a:	48 b8 96 26 80 00 00 	movabs $0x802696,%rax
+  803481:	00 00 00 
+  803484:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803486:	85 c0                	test   %eax,%eax
+  803488:	78 3d                	js     8034c7 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80348a:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803491:	00 00 00 
+  803494:	48 8b 10             	mov    (%rax),%rdx
+  803497:	48 89 13             	mov    %rdx,(%rbx)
+  80349a:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80349e:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034a2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034a6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034aa:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8034ae:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8034b2:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8034b6:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8034ba:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8034be:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8034c2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034c7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034cb:	c9                   	leave
+  8034cc:	c3                   	ret
+
+00000000008034cd <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8034cd:	55                   	push   %rbp
+  8034ce:	48 89 e5             	mov    %rsp,%rbp
+  8034d1:	41 57                	push   %r15
+  8034d3:	41 56                	push   %r14
+  8034d5:	41 55                	push   %r13
+  8034d7:	41 54                	push   %r12
+  8034d9:	53                   	push   %rbx
+  8034da:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8034de:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8034e5:	00 
+  8034e6:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8034ed:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8034f3:	0f 85 43 01 00 00    	jne    80363c <munmap+0x16f>
+  8034f9:	49 89 ff             	mov    %rdi,%r15
+  8034fc:	4c 39 f7             	cmp    %r14,%rdi
+  8034ff:	0f 87 37 01 00 00    	ja     80363c <munmap+0x16f>
+  803505:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80350c:	00 00 00 
+  80350f:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803515:	eb 2c                	jmp    803543 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803517:	4c 39 f8             	cmp    %r15,%rax
+  80351a:	0f 83 85 00 00 00    	jae    8035a5 <munmap+0xd8>
+            m->mm_end = start;
+  803520:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803525:	48 83 c3 18          	add    $0x18,%rbx
+  803529:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803530:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803537:	00 00 00 
+  80353a:	48 39 c3             	cmp    %rax,%rbx
+  80353d:	0f 84 d0 00 00 00    	je     803613 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803543:	49 89 dc             	mov    %rbx,%r12
+  803546:	48 8b 03             	mov    (%rbx),%rax
+  803549:	4c 39 f0             	cmp    %r14,%rax
+  80354c:	73 d7                	jae    803525 <munmap+0x58>
+  80354e:	48 85 c0             	test   %rax,%rax
+  803551:	74 d2                	je     803525 <munmap+0x58>
+  803553:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803557:	49 39 d7             	cmp    %rdx,%r15
+  80355a:	73 c9                	jae    803525 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80355c:	49 39 d6             	cmp    %rdx,%r14
+  80355f:	73 b6                	jae    803517 <munmap+0x4a>
+  803561:	49 39 c7             	cmp    %rax,%r15
+  803564:	76 b1                	jbe    803517 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803566:	4c 89 ef             	mov    %r13,%rdi
+  803569:	48 b8 04 26 80 00 00 	movabs $0x802604,%rax
+  803570:	00 00 00 
+  803573:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803575:	48 85 c0             	test   %rax,%rax
+  803578:	0f 84 c5 00 00 00    	je     803643 <munmap+0x176>
+            *tail = *m;
+  80357e:	48 8b 13             	mov    (%rbx),%rdx
+  803581:	48 89 10             	mov    %rdx,(%rax)
+  803584:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803588:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80358c:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803590:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803594:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803597:	44 89 f2             	mov    %r14d,%edx
+  80359a:	2b 13                	sub    (%rbx),%edx
+  80359c:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80359f:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8035a3:	eb 80                	jmp    803525 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8035a5:	49 39 d6             	cmp    %rdx,%r14
+  8035a8:	73 18                	jae    8035c2 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8035aa:	44 89 f2             	mov    %r14d,%edx
+  8035ad:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8035b2:	29 c2                	sub    %eax,%edx
+  8035b4:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8035b9:	4d 89 34 24          	mov    %r14,(%r12)
+  8035bd:	e9 63 ff ff ff       	jmp    803525 <munmap+0x58>
+    m->mm_start = 0;
+  8035c2:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8035c9:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8035ca:	4c 89 e6             	mov    %r12,%rsi
+  8035cd:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8035d4:	00 00 00 
+  8035d7:	48 29 c6             	sub    %rax,%rsi
+  8035da:	48 c1 fe 03          	sar    $0x3,%rsi
+  8035de:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8035e5:	aa aa aa 
+  8035e8:	48 0f af f0          	imul   %rax,%rsi
+  8035ec:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8035f0:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8035f5:	48 01 c6             	add    %rax,%rsi
+  8035f8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8035fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  803602:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  803609:	00 00 00 
+  80360c:	ff d0                	call   *%rax
+}
+  80360e:	e9 12 ff ff ff       	jmp    803525 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803613:	4c 89 f2             	mov    %r14,%rdx
+  803616:	4c 29 fa             	sub    %r15,%rdx
+  803619:	4c 89 fe             	mov    %r15,%rsi
+  80361c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803621:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  803628:	00 00 00 
+  80362b:	ff d0                	call   *%rax
+}
+  80362d:	48 83 c4 08          	add    $0x8,%rsp
+  803631:	5b                   	pop    %rbx
+  803632:	41 5c                	pop    %r12
+  803634:	41 5d                	pop    %r13
+  803636:	41 5e                	pop    %r14
+  803638:	41 5f                	pop    %r15
+  80363a:	5d                   	pop    %rbp
+  80363b:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80363c:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803641:	eb ea                	jmp    80362d <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803643:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803648:	eb e3                	jmp    80362d <munmap+0x160>
+
+000000000080364a <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80364a:	55                   	push   %rbp
+  80364b:	48 89 e5             	mov    %rsp,%rbp
+  80364e:	41 57                	push   %r15
+  803650:	41 56                	push   %r14
+  803652:	41 55                	push   %r13
+  803654:	41 54                	push   %r12
+  803656:	53                   	push   %rbx
+  803657:	48 83 ec 28          	sub    $0x28,%rsp
+  80365b:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80365f:	49 89 f5             	mov    %rsi,%r13
+  803662:	41 89 d6             	mov    %edx,%r14d
+  803665:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803668:	41 89 cc             	mov    %ecx,%r12d
+  80366b:	44 89 c7             	mov    %r8d,%edi
+  80366e:	44 89 cb             	mov    %r9d,%ebx
+  803671:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803675:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803679:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  803680:	00 00 00 
+  803683:	ff d0                	call   *%rax
+  803685:	41 89 c7             	mov    %eax,%r15d
+  803688:	85 c0                	test   %eax,%eax
+  80368a:	0f 88 ae 01 00 00    	js     80383e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803690:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803694:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  80369b:	00 00 00 
+  80369e:	8b 32                	mov    (%rdx),%esi
+  8036a0:	39 30                	cmp    %esi,(%rax)
+  8036a2:	0f 85 7a 02 00 00    	jne    803922 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8036a8:	8b 40 08             	mov    0x8(%rax),%eax
+  8036ab:	83 e0 03             	and    $0x3,%eax
+  8036ae:	83 f8 01             	cmp    $0x1,%eax
+  8036b1:	0f 84 76 02 00 00    	je     80392d <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8036b7:	4d 85 ed             	test   %r13,%r13
+  8036ba:	0f 84 78 02 00 00    	je     803938 <mmap+0x2ee>
+  8036c0:	85 db                	test   %ebx,%ebx
+  8036c2:	0f 88 70 02 00 00    	js     803938 <mmap+0x2ee>
+  8036c8:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8036ce:	41 89 df             	mov    %ebx,%r15d
+  8036d1:	0f 85 6c 02 00 00    	jne    803943 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8036d7:	44 89 f0             	mov    %r14d,%eax
+  8036da:	83 e0 fd             	and    $0xfffffffd,%eax
+  8036dd:	83 f8 04             	cmp    $0x4,%eax
+  8036e0:	0f 85 68 02 00 00    	jne    80394e <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8036e6:	44 89 e1             	mov    %r12d,%ecx
+  8036e9:	83 e1 01             	and    $0x1,%ecx
+  8036ec:	0f 95 c2             	setne  %dl
+  8036ef:	44 89 e0             	mov    %r12d,%eax
+  8036f2:	d1 e8                	shr    %eax
+  8036f4:	83 f0 01             	xor    $0x1,%eax
+  8036f7:	83 e0 01             	and    $0x1,%eax
+  8036fa:	38 c2                	cmp    %al,%dl
+  8036fc:	0f 85 57 02 00 00    	jne    803959 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803702:	85 c9                	test   %ecx,%ecx
+  803704:	74 0a                	je     803710 <mmap+0xc6>
+  803706:	41 f6 c6 02          	test   $0x2,%r14b
+  80370a:	0f 85 54 02 00 00    	jne    803964 <mmap+0x31a>
+    file_flush_buffers();
+  803710:	48 b8 c5 31 80 00 00 	movabs $0x8031c5,%rax
+  803717:	00 00 00 
+  80371a:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80371c:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803723:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80372a:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80372e:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803731:	41 f6 c4 04          	test   $0x4,%r12b
+  803735:	0f 84 15 01 00 00    	je     803850 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80373b:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80373e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803744:	0f 85 25 02 00 00    	jne    80396f <mmap+0x325>
+  80374a:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80374e:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803755:	00 00 00 
+  803758:	48 39 c2             	cmp    %rax,%rdx
+  80375b:	0f 82 19 02 00 00    	jb     80397a <mmap+0x330>
+  803761:	48 39 c7             	cmp    %rax,%rdi
+  803764:	0f 87 10 02 00 00    	ja     80397a <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80376a:	4c 89 ee             	mov    %r13,%rsi
+  80376d:	48 b8 cd 34 80 00 00 	movabs $0x8034cd,%rax
+  803774:	00 00 00 
+  803777:	ff d0                	call   *%rax
+  803779:	85 c0                	test   %eax,%eax
+  80377b:	0f 88 04 02 00 00    	js     803985 <mmap+0x33b>
+    if (!handler) {
+  803781:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803788:	00 00 00 
+  80378b:	80 38 00             	cmpb   $0x0,(%rax)
+  80378e:	75 2b                	jne    8037bb <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803790:	48 bf 65 25 80 00 00 	movabs $0x802565,%rdi
+  803797:	00 00 00 
+  80379a:	48 b8 c9 46 80 00 00 	movabs $0x8046c9,%rax
+  8037a1:	00 00 00 
+  8037a4:	ff d0                	call   *%rax
+  8037a6:	85 c0                	test   %eax,%eax
+  8037a8:	0f 88 ea 01 00 00    	js     803998 <mmap+0x34e>
+        handler = 1;
+  8037ae:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8037b5:	00 00 00 
+  8037b8:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8037bb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8037bf:	48 b8 04 26 80 00 00 	movabs $0x802604,%rax
+  8037c6:	00 00 00 
+  8037c9:	ff d0                	call   *%rax
+  8037cb:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8037ce:	48 85 c0             	test   %rax,%rax
+  8037d1:	0f 84 c9 01 00 00    	je     8039a0 <mmap+0x356>
+    m->mm_start = va;
+  8037d7:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8037da:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8037de:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8037e2:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8037e5:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8037e9:	44 89 e0             	mov    %r12d,%eax
+  8037ec:	c1 e0 06             	shl    $0x6,%eax
+  8037ef:	25 80 00 00 00       	and    $0x80,%eax
+  8037f4:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8037f7:	09 f0                	or     %esi,%eax
+  8037f9:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8037fd:	41 f6 c4 08          	test   $0x8,%r12b
+  803801:	74 31                	je     803834 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803803:	48 39 d3             	cmp    %rdx,%rbx
+  803806:	73 2c                	jae    803834 <mmap+0x1ea>
+  803808:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80380d:	48 89 de             	mov    %rbx,%rsi
+  803810:	4c 89 f7             	mov    %r14,%rdi
+  803813:	48 b8 54 24 80 00 00 	movabs $0x802454,%rax
+  80381a:	00 00 00 
+  80381d:	ff d0                	call   *%rax
+  80381f:	49 89 c4             	mov    %rax,%r12
+  803822:	48 85 c0             	test   %rax,%rax
+  803825:	0f 8e d7 00 00 00    	jle    803902 <mmap+0x2b8>
+            va += n;
+  80382b:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80382e:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803832:	72 d4                	jb     803808 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803834:	49 8b 06             	mov    (%r14),%rax
+  803837:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80383b:	48 89 06             	mov    %rax,(%rsi)
+}
+  80383e:	44 89 f8             	mov    %r15d,%eax
+  803841:	48 83 c4 28          	add    $0x28,%rsp
+  803845:	5b                   	pop    %rbx
+  803846:	41 5c                	pop    %r12
+  803848:	41 5d                	pop    %r13
+  80384a:	41 5e                	pop    %r14
+  80384c:	41 5f                	pop    %r15
+  80384e:	5d                   	pop    %rbp
+  80384f:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803850:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803857:	00 00 00 
+  80385a:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80385d:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803864:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803867:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80386c:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803873:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803876:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80387d:	00 00 00 
+  803880:	48 39 d7             	cmp    %rdx,%rdi
+  803883:	73 1c                	jae    8038a1 <mmap+0x257>
+        return -E_NO_MEM;
+  803885:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80388b:	eb b1                	jmp    80383e <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80388d:	48 83 c0 01          	add    $0x1,%rax
+  803891:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803895:	77 3f                	ja     8038d6 <mmap+0x28c>
+  803897:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80389c:	48 39 d7             	cmp    %rdx,%rdi
+  80389f:	72 2a                	jb     8038cb <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8038a1:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8038a5:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8038a9:	48 39 d1             	cmp    %rdx,%rcx
+  8038ac:	73 df                	jae    80388d <mmap+0x243>
+  8038ae:	48 85 c9             	test   %rcx,%rcx
+  8038b1:	74 da                	je     80388d <mmap+0x243>
+  8038b3:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8038b7:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8038bc:	48 39 d3             	cmp    %rdx,%rbx
+  8038bf:	73 cc                	jae    80388d <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8038c1:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038c4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8038c9:	eb cc                	jmp    803897 <mmap+0x24d>
+        return -E_NO_MEM;
+  8038cb:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038d1:	e9 68 ff ff ff       	jmp    80383e <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8038d6:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8038db:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8038e2:	00 00 00 
+  8038e5:	48 39 c2             	cmp    %rax,%rdx
+  8038e8:	0f 82 9f 00 00 00    	jb     80398d <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8038ee:	48 85 db             	test   %rbx,%rbx
+  8038f1:	0f 85 8a fe ff ff    	jne    803781 <mmap+0x137>
+        return -E_NO_MEM;
+  8038f7:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8038fd:	e9 3c ff ff ff       	jmp    80383e <mmap+0x1f4>
+        if (n < 0) {
+  803902:	0f 89 2c ff ff ff    	jns    803834 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803908:	49 8b 3e             	mov    (%r14),%rdi
+  80390b:	4c 89 ee             	mov    %r13,%rsi
+  80390e:	48 b8 cd 34 80 00 00 	movabs $0x8034cd,%rax
+  803915:	00 00 00 
+  803918:	ff d0                	call   *%rax
+            return n;
+  80391a:	45 89 e7             	mov    %r12d,%r15d
+  80391d:	e9 1c ff ff ff       	jmp    80383e <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803922:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803928:	e9 11 ff ff ff       	jmp    80383e <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80392d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803933:	e9 06 ff ff ff       	jmp    80383e <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803938:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80393e:	e9 fb fe ff ff       	jmp    80383e <mmap+0x1f4>
+  803943:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803949:	e9 f0 fe ff ff       	jmp    80383e <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80394e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803954:	e9 e5 fe ff ff       	jmp    80383e <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803959:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80395f:	e9 da fe ff ff       	jmp    80383e <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803964:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80396a:	e9 cf fe ff ff       	jmp    80383e <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80396f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803975:	e9 c4 fe ff ff       	jmp    80383e <mmap+0x1f4>
+  80397a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803980:	e9 b9 fe ff ff       	jmp    80383e <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803985:	41 89 c7             	mov    %eax,%r15d
+  803988:	e9 b1 fe ff ff       	jmp    80383e <mmap+0x1f4>
+        return -E_NO_MEM;
+  80398d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803993:	e9 a6 fe ff ff       	jmp    80383e <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803998:	41 89 c7             	mov    %eax,%r15d
+  80399b:	e9 9e fe ff ff       	jmp    80383e <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8039a0:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039a6:	e9 93 fe ff ff       	jmp    80383e <mmap+0x1f4>
+
+00000000008039ab <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8039ab:	55                   	push   %rbp
+  8039ac:	48 89 e5             	mov    %rsp,%rbp
+  8039af:	41 54                	push   %r12
+  8039b1:	53                   	push   %rbx
+  8039b2:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8039b5:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  8039bc:	00 00 00 
+  8039bf:	ff d0                	call   *%rax
+  8039c1:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8039c4:	48 be 00 50 80 00 00 	movabs $0x805000,%rsi
+  8039cb:	00 00 00 
+  8039ce:	48 89 df             	mov    %rbx,%rdi
+  8039d1:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  8039d8:	00 00 00 
+  8039db:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  8039dd:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  8039e2:	41 2b 04 24          	sub    (%r12),%eax
+  8039e6:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  8039ec:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  8039f3:	00 00 00 
+    stat->st_dev = &devpipe;
+  8039f6:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  8039fd:	00 00 00 
+  803a00:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803a07:	b8 00 00 00 00       	mov    $0x0,%eax
+  803a0c:	5b                   	pop    %rbx
+  803a0d:	41 5c                	pop    %r12
+  803a0f:	5d                   	pop    %rbp
+  803a10:	c3                   	ret
+
+0000000000803a11 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a11:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803a14:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803a1a:	8b 17                	mov    (%rdi),%edx
+  803a1c:	85 d2                	test   %edx,%edx
+  803a1e:	75 01                	jne    803a21 <pipe_wakeup+0x10>
+  803a20:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803a21:	55                   	push   %rbp
+  803a22:	48 89 e5             	mov    %rsp,%rbp
+  803a25:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803a28:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803a2e:	be 00 04 00 00       	mov    $0x400,%esi
+  803a33:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  803a3a:	00 00 00 
+  803a3d:	ff d0                	call   *%rax
+}
+  803a3f:	5d                   	pop    %rbp
+  803a40:	c3                   	ret
+
+0000000000803a41 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803a41:	55                   	push   %rbp
+  803a42:	48 89 e5             	mov    %rsp,%rbp
+  803a45:	41 55                	push   %r13
+  803a47:	41 54                	push   %r12
+  803a49:	53                   	push   %rbx
+  803a4a:	48 83 ec 08          	sub    $0x8,%rsp
+  803a4e:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a51:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803a58:	00 00 00 
+  803a5b:	ff d0                	call   *%rax
+  803a5d:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803a60:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a65:	4c 89 e6             	mov    %r12,%rsi
+  803a68:	bf 00 00 00 00       	mov    $0x0,%edi
+  803a6d:	49 bc 3d 12 80 00 00 	movabs $0x80123d,%r12
+  803a74:	00 00 00 
+  803a77:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a7a:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a7e:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a82:	49 bd 11 3a 80 00 00 	movabs $0x803a11,%r13
+  803a89:	00 00 00 
+  803a8c:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803a8f:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803a93:	48 89 de             	mov    %rbx,%rsi
+  803a96:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803a99:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803a9e:	48 89 de             	mov    %rbx,%rsi
+  803aa1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803aa6:	41 ff d4             	call   *%r12
+  803aa9:	48 83 c4 08          	add    $0x8,%rsp
+  803aad:	5b                   	pop    %rbx
+  803aae:	41 5c                	pop    %r12
+  803ab0:	41 5d                	pop    %r13
+  803ab2:	5d                   	pop    %rbp
+  803ab3:	c3                   	ret
+
+0000000000803ab4 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803ab4:	55                   	push   %rbp
+  803ab5:	48 89 e5             	mov    %rsp,%rbp
+  803ab8:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803abb:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803ac0:	be 00 10 00 00       	mov    $0x1000,%esi
+  803ac5:	48 b8 80 11 80 00 00 	movabs $0x801180,%rax
+  803acc:	00 00 00 
+  803acf:	ff d0                	call   *%rax
+  803ad1:	85 c0                	test   %eax,%eax
+  803ad3:	0f 94 c0             	sete   %al
+  803ad6:	0f b6 c0             	movzbl %al,%eax
+}
+  803ad9:	5d                   	pop    %rbp
+  803ada:	c3                   	ret
+
+0000000000803adb <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803adb:	55                   	push   %rbp
+  803adc:	48 89 e5             	mov    %rsp,%rbp
+  803adf:	41 57                	push   %r15
+  803ae1:	41 56                	push   %r14
+  803ae3:	41 55                	push   %r13
+  803ae5:	41 54                	push   %r12
+  803ae7:	53                   	push   %rbx
+  803ae8:	48 83 ec 38          	sub    $0x38,%rsp
+  803aec:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803af0:	49 89 f4             	mov    %rsi,%r12
+  803af3:	49 89 d7             	mov    %rdx,%r15
+  803af6:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803afa:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803b01:	00 00 00 
+  803b04:	ff d0                	call   *%rax
+  803b06:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803b09:	4d 85 ff             	test   %r15,%r15
+  803b0c:	0f 84 f1 00 00 00    	je     803c03 <devpipe_write+0x128>
+  803b12:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803b16:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803b1a:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803b1e:	49 bd b4 3a 80 00 00 	movabs $0x803ab4,%r13
+  803b25:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b28:	49 bf 11 3a 80 00 00 	movabs $0x803a11,%r15
+  803b2f:	00 00 00 
+  803b32:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803b36:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803b3a:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803b3e:	8b 73 04             	mov    0x4(%rbx),%esi
+  803b41:	48 63 ce             	movslq %esi,%rcx
+  803b44:	48 63 03             	movslq (%rbx),%rax
+  803b47:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803b4d:	48 39 c1             	cmp    %rax,%rcx
+  803b50:	72 64                	jb     803bb6 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b52:	48 89 de             	mov    %rbx,%rsi
+  803b55:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b59:	41 ff d5             	call   *%r13
+  803b5c:	85 c0                	test   %eax,%eax
+  803b5e:	0f 85 b9 00 00 00    	jne    803c1d <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b64:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803b68:	4c 89 f7             	mov    %r14,%rdi
+  803b6b:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803b6e:	8b 43 04             	mov    0x4(%rbx),%eax
+  803b71:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803b78:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803b7f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803b85:	8b 03                	mov    (%rbx),%eax
+  803b87:	41 39 c4             	cmp    %eax,%r12d
+  803b8a:	75 b2                	jne    803b3e <devpipe_write+0x63>
+  803b8c:	48 89 de             	mov    %rbx,%rsi
+  803b8f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803b93:	41 ff d5             	call   *%r13
+  803b96:	85 c0                	test   %eax,%eax
+  803b98:	75 a0                	jne    803b3a <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803b9a:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803b9f:	44 89 e6             	mov    %r12d,%esi
+  803ba2:	48 89 df             	mov    %rbx,%rdi
+  803ba5:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  803bac:	00 00 00 
+  803baf:	ff d0                	call   *%rax
+  803bb1:	e9 7c ff ff ff       	jmp    803b32 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803bb6:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803bba:	41 0f b6 38          	movzbl (%r8),%edi
+  803bbe:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803bc5:	80 80 80 
+  803bc8:	48 89 c8             	mov    %rcx,%rax
+  803bcb:	48 f7 e2             	mul    %rdx
+  803bce:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803bd2:	48 89 d0             	mov    %rdx,%rax
+  803bd5:	48 c1 e0 08          	shl    $0x8,%rax
+  803bd9:	48 29 d0             	sub    %rdx,%rax
+  803bdc:	48 c1 e0 04          	shl    $0x4,%rax
+  803be0:	48 29 c1             	sub    %rax,%rcx
+  803be3:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803be8:	83 c6 01             	add    $0x1,%esi
+  803beb:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803bee:	49 83 c0 01          	add    $0x1,%r8
+  803bf2:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803bf6:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803bfa:	49 39 c0             	cmp    %rax,%r8
+  803bfd:	0f 85 2f ff ff ff    	jne    803b32 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c03:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803c07:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803c0b:	48 b8 11 3a 80 00 00 	movabs $0x803a11,%rax
+  803c12:	00 00 00 
+  803c15:	ff d0                	call   *%rax
+    return n;
+  803c17:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803c1b:	eb 05                	jmp    803c22 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c1d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803c22:	48 83 c4 38          	add    $0x38,%rsp
+  803c26:	5b                   	pop    %rbx
+  803c27:	41 5c                	pop    %r12
+  803c29:	41 5d                	pop    %r13
+  803c2b:	41 5e                	pop    %r14
+  803c2d:	41 5f                	pop    %r15
+  803c2f:	5d                   	pop    %rbp
+  803c30:	c3                   	ret
+
+0000000000803c31 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803c31:	55                   	push   %rbp
+  803c32:	48 89 e5             	mov    %rsp,%rbp
+  803c35:	41 57                	push   %r15
+  803c37:	41 56                	push   %r14
+  803c39:	41 55                	push   %r13
+  803c3b:	41 54                	push   %r12
+  803c3d:	53                   	push   %rbx
+  803c3e:	48 83 ec 28          	sub    $0x28,%rsp
+  803c42:	49 89 fd             	mov    %rdi,%r13
+  803c45:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803c49:	49 89 d4             	mov    %rdx,%r12
+  803c4c:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803c50:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803c57:	00 00 00 
+  803c5a:	ff d0                	call   *%rax
+  803c5c:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803c5f:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803c65:	49 bf b4 3a 80 00 00 	movabs $0x803ab4,%r15
+  803c6c:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803c6f:	4d 85 e4             	test   %r12,%r12
+  803c72:	0f 84 d5 00 00 00    	je     803d4d <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c78:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803c7c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803c80:	8b 03                	mov    (%rbx),%eax
+  803c82:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803c85:	75 7a                	jne    803d01 <devpipe_read+0xd0>
+            if (i > 0) {
+  803c87:	4d 85 f6             	test   %r14,%r14
+  803c8a:	75 50                	jne    803cdc <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803c8c:	48 89 de             	mov    %rbx,%rsi
+  803c8f:	4c 89 ef             	mov    %r13,%rdi
+  803c92:	41 ff d7             	call   *%r15
+  803c95:	85 c0                	test   %eax,%eax
+  803c97:	0f 85 c9 00 00 00    	jne    803d66 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803c9d:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803ca0:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ca7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803cad:	8b 43 04             	mov    0x4(%rbx),%eax
+  803cb0:	41 39 c4             	cmp    %eax,%r12d
+  803cb3:	75 cb                	jne    803c80 <devpipe_read+0x4f>
+  803cb5:	48 89 de             	mov    %rbx,%rsi
+  803cb8:	4c 89 ef             	mov    %r13,%rdi
+  803cbb:	41 ff d7             	call   *%r15
+  803cbe:	85 c0                	test   %eax,%eax
+  803cc0:	75 be                	jne    803c80 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803cc2:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803cc7:	44 89 e6             	mov    %r12d,%esi
+  803cca:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803cce:	48 b8 05 15 80 00 00 	movabs $0x801505,%rax
+  803cd5:	00 00 00 
+  803cd8:	ff d0                	call   *%rax
+  803cda:	eb a4                	jmp    803c80 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803cdc:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803ce0:	48 89 de             	mov    %rbx,%rsi
+  803ce3:	48 b8 11 3a 80 00 00 	movabs $0x803a11,%rax
+  803cea:	00 00 00 
+  803ced:	ff d0                	call   *%rax
+                return i;
+  803cef:	4c 89 f0             	mov    %r14,%rax
+}
+  803cf2:	48 83 c4 28          	add    $0x28,%rsp
+  803cf6:	5b                   	pop    %rbx
+  803cf7:	41 5c                	pop    %r12
+  803cf9:	41 5d                	pop    %r13
+  803cfb:	41 5e                	pop    %r14
+  803cfd:	41 5f                	pop    %r15
+  803cff:	5d                   	pop    %rbp
+  803d00:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d01:	48 63 c8             	movslq %eax,%rcx
+  803d04:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803d0b:	80 80 80 
+  803d0e:	48 89 c8             	mov    %rcx,%rax
+  803d11:	48 f7 e2             	mul    %rdx
+  803d14:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803d18:	48 89 d0             	mov    %rdx,%rax
+  803d1b:	48 c1 e0 08          	shl    $0x8,%rax
+  803d1f:	48 29 d0             	sub    %rdx,%rax
+  803d22:	48 c1 e0 04          	shl    $0x4,%rax
+  803d26:	48 89 c2             	mov    %rax,%rdx
+  803d29:	48 89 c8             	mov    %rcx,%rax
+  803d2c:	48 29 d0             	sub    %rdx,%rax
+  803d2f:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803d34:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803d38:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803d3c:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803d3f:	49 83 c6 01          	add    $0x1,%r14
+  803d43:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803d47:	0f 85 2b ff ff ff    	jne    803c78 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d4d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d51:	48 89 de             	mov    %rbx,%rsi
+  803d54:	48 b8 11 3a 80 00 00 	movabs $0x803a11,%rax
+  803d5b:	00 00 00 
+  803d5e:	ff d0                	call   *%rax
+    return n;
+  803d60:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803d64:	eb 8c                	jmp    803cf2 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d66:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d6b:	eb 85                	jmp    803cf2 <devpipe_read+0xc1>
+
+0000000000803d6d <pipe>:
+pipe(int pfd[2]) {
+  803d6d:	55                   	push   %rbp
+  803d6e:	48 89 e5             	mov    %rsp,%rbp
+  803d71:	41 55                	push   %r13
+  803d73:	41 54                	push   %r12
+  803d75:	53                   	push   %rbx
+  803d76:	48 83 ec 18          	sub    $0x18,%rsp
+  803d7a:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803d7d:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803d81:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+  803d8d:	89 c3                	mov    %eax,%ebx
+  803d8f:	85 c0                	test   %eax,%eax
+  803d91:	0f 88 a0 01 00 00    	js     803f37 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803d97:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803d9c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803da1:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803da5:	bf 00 00 00 00       	mov    $0x0,%edi
+  803daa:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  803db1:	00 00 00 
+  803db4:	ff d0                	call   *%rax
+  803db6:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803db8:	85 c0                	test   %eax,%eax
+  803dba:	0f 88 77 01 00 00    	js     803f37 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dc0:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803dc4:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  803dcb:	00 00 00 
+  803dce:	ff d0                	call   *%rax
+  803dd0:	89 c3                	mov    %eax,%ebx
+  803dd2:	85 c0                	test   %eax,%eax
+  803dd4:	0f 88 43 01 00 00    	js     803f1d <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803dda:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ddf:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803de4:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803de8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ded:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  803df4:	00 00 00 
+  803df7:	ff d0                	call   *%rax
+  803df9:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803dfb:	85 c0                	test   %eax,%eax
+  803dfd:	0f 88 1a 01 00 00    	js     803f1d <pipe+0x1b0>
+    va = fd2data(fd0);
+  803e03:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803e07:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803e0e:	00 00 00 
+  803e11:	ff d0                	call   *%rax
+  803e13:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803e16:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e20:	48 89 c6             	mov    %rax,%rsi
+  803e23:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e28:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  803e2f:	00 00 00 
+  803e32:	ff d0                	call   *%rax
+  803e34:	89 c3                	mov    %eax,%ebx
+  803e36:	85 c0                	test   %eax,%eax
+  803e38:	0f 88 c5 00 00 00    	js     803f03 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803e3e:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803e42:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803e49:	00 00 00 
+  803e4c:	ff d0                	call   *%rax
+  803e4e:	48 89 c1             	mov    %rax,%rcx
+  803e51:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803e57:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803e5d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e62:	4c 89 ee             	mov    %r13,%rsi
+  803e65:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e6a:	48 b8 ed 11 80 00 00 	movabs $0x8011ed,%rax
+  803e71:	00 00 00 
+  803e74:	ff d0                	call   *%rax
+  803e76:	89 c3                	mov    %eax,%ebx
+  803e78:	85 c0                	test   %eax,%eax
+  803e7a:	78 6e                	js     803eea <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803e7c:	be 00 10 00 00       	mov    $0x1000,%esi
+  803e81:	4c 89 ef             	mov    %r13,%rdi
+  803e84:	48 b8 5c 11 80 00 00 	movabs $0x80115c,%rax
+  803e8b:	00 00 00 
+  803e8e:	ff d0                	call   *%rax
+  803e90:	83 f8 02             	cmp    $0x2,%eax
+  803e93:	0f 85 ab 00 00 00    	jne    803f44 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803e99:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803ea0:	00 00 
+  803ea2:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803ea6:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803ea8:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803eac:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803eb3:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803eb7:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803eb9:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803ebd:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803ec4:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ec8:	48 bb b1 18 80 00 00 	movabs $0x8018b1,%rbx
+  803ecf:	00 00 00 
+  803ed2:	ff d3                	call   *%rbx
+  803ed4:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803ed8:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803edc:	ff d3                	call   *%rbx
+  803ede:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803ee3:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803ee8:	eb 4d                	jmp    803f37 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803eea:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803eef:	4c 89 ee             	mov    %r13,%rsi
+  803ef2:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ef7:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  803efe:	00 00 00 
+  803f01:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803f03:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f08:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803f0c:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f11:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  803f18:	00 00 00 
+  803f1b:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803f1d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f22:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f26:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f2b:	48 b8 3d 12 80 00 00 	movabs $0x80123d,%rax
+  803f32:	00 00 00 
+  803f35:	ff d0                	call   *%rax
+}
+  803f37:	89 d8                	mov    %ebx,%eax
+  803f39:	48 83 c4 18          	add    $0x18,%rsp
+  803f3d:	5b                   	pop    %rbx
+  803f3e:	41 5c                	pop    %r12
+  803f40:	41 5d                	pop    %r13
+  803f42:	5d                   	pop    %rbp
+  803f43:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f44:	48 b9 30 50 80 00 00 	movabs $0x805030,%rcx
+  803f4b:	00 00 00 
+  803f4e:	48 ba 07 50 80 00 00 	movabs $0x805007,%rdx
+  803f55:	00 00 00 
+  803f58:	be 50 00 00 00       	mov    $0x50,%esi
+  803f5d:	48 bf 1c 50 80 00 00 	movabs $0x80501c,%rdi
+  803f64:	00 00 00 
+  803f67:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f6c:	49 b8 9c 45 80 00 00 	movabs $0x80459c,%r8
+  803f73:	00 00 00 
+  803f76:	41 ff d0             	call   *%r8
+
+0000000000803f79 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803f79:	55                   	push   %rbp
+  803f7a:	48 89 e5             	mov    %rsp,%rbp
+  803f7d:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803f81:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803f85:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  803f8c:	00 00 00 
+  803f8f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803f91:	85 c0                	test   %eax,%eax
+  803f93:	78 23                	js     803fb8 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803f95:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803f99:	48 b8 c3 18 80 00 00 	movabs $0x8018c3,%rax
+  803fa0:	00 00 00 
+  803fa3:	ff d0                	call   *%rax
+  803fa5:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803fa8:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803fac:	48 b8 b4 3a 80 00 00 	movabs $0x803ab4,%rax
+  803fb3:	00 00 00 
+  803fb6:	ff d0                	call   *%rax
+}
+  803fb8:	c9                   	leave
+  803fb9:	c3                   	ret
+
+0000000000803fba <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803fba:	48 89 f8             	mov    %rdi,%rax
+  803fbd:	48 c1 e8 27          	shr    $0x27,%rax
+  803fc1:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803fc8:	01 00 00 
+  803fcb:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fcf:	f6 c2 01             	test   $0x1,%dl
+  803fd2:	74 6d                	je     804041 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803fd4:	48 89 f8             	mov    %rdi,%rax
+  803fd7:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803fdb:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803fe2:	01 00 00 
+  803fe5:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803fe9:	f6 c2 01             	test   $0x1,%dl
+  803fec:	74 62                	je     804050 <get_uvpt_entry+0x96>
+  803fee:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803ff5:	01 00 00 
+  803ff8:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803ffc:	f6 c2 80             	test   $0x80,%dl
+  803fff:	75 4f                	jne    804050 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804001:	48 89 f8             	mov    %rdi,%rax
+  804004:	48 c1 e8 15          	shr    $0x15,%rax
+  804008:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80400f:	01 00 00 
+  804012:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804016:	f6 c2 01             	test   $0x1,%dl
+  804019:	74 44                	je     80405f <get_uvpt_entry+0xa5>
+  80401b:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804022:	01 00 00 
+  804025:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804029:	f6 c2 80             	test   $0x80,%dl
+  80402c:	75 31                	jne    80405f <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  80402e:	48 c1 ef 0c          	shr    $0xc,%rdi
+  804032:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  804039:	01 00 00 
+  80403c:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  804040:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804041:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804048:	01 00 00 
+  80404b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80404f:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804050:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804057:	01 00 00 
+  80405a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80405e:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80405f:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804066:	01 00 00 
+  804069:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80406d:	c3                   	ret
+
+000000000080406e <get_prot>:
+
+int
+get_prot(void *va) {
+  80406e:	55                   	push   %rbp
+  80406f:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804072:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  804079:	00 00 00 
+  80407c:	ff d0                	call   *%rax
+  80407e:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804081:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804086:	89 c1                	mov    %eax,%ecx
+  804088:	83 c9 04             	or     $0x4,%ecx
+  80408b:	f6 c2 01             	test   $0x1,%dl
+  80408e:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804091:	89 c1                	mov    %eax,%ecx
+  804093:	83 c9 02             	or     $0x2,%ecx
+  804096:	f6 c2 02             	test   $0x2,%dl
+  804099:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80409c:	89 c1                	mov    %eax,%ecx
+  80409e:	83 c9 01             	or     $0x1,%ecx
+  8040a1:	48 85 d2             	test   %rdx,%rdx
+  8040a4:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8040a7:	89 c1                	mov    %eax,%ecx
+  8040a9:	83 c9 40             	or     $0x40,%ecx
+  8040ac:	f6 c6 04             	test   $0x4,%dh
+  8040af:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8040b2:	5d                   	pop    %rbp
+  8040b3:	c3                   	ret
+
+00000000008040b4 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8040b4:	55                   	push   %rbp
+  8040b5:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8040b8:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  8040bf:	00 00 00 
+  8040c2:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  8040c4:	48 c1 e8 06          	shr    $0x6,%rax
+  8040c8:	83 e0 01             	and    $0x1,%eax
+}
+  8040cb:	5d                   	pop    %rbp
+  8040cc:	c3                   	ret
+
+00000000008040cd <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  8040cd:	55                   	push   %rbp
+  8040ce:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  8040d1:	48 b8 ba 3f 80 00 00 	movabs $0x803fba,%rax
+  8040d8:	00 00 00 
+  8040db:	ff d0                	call   *%rax
+  8040dd:	83 e0 01             	and    $0x1,%eax
+}
+  8040e0:	5d                   	pop    %rbp
+  8040e1:	c3                   	ret
+
+00000000008040e2 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  8040e2:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  8040e9:	01 00 00 
+  8040ec:	a8 01                	test   $0x1,%al
+  8040ee:	75 06                	jne    8040f6 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  8040f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040f5:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  8040f6:	55                   	push   %rbp
+  8040f7:	48 89 e5             	mov    %rsp,%rbp
+  8040fa:	41 57                	push   %r15
+  8040fc:	41 56                	push   %r14
+  8040fe:	41 55                	push   %r13
+  804100:	41 54                	push   %r12
+  804102:	53                   	push   %rbx
+  804103:	48 83 ec 28          	sub    $0x28,%rsp
+  804107:	49 89 fe             	mov    %rdi,%r14
+  80410a:	49 89 f7             	mov    %rsi,%r15
+  80410d:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  804114:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804115:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  80411c:	01 00 00 
+  80411f:	e9 ae 00 00 00       	jmp    8041d2 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804124:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80412b:	49 83 ec 01          	sub    $0x1,%r12
+  80412f:	74 2d                	je     80415e <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  804131:	48 89 d8             	mov    %rbx,%rax
+  804134:	48 c1 e8 0c          	shr    $0xc,%rax
+  804138:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  80413d:	f6 c2 01             	test   $0x1,%dl
+  804140:	74 e2                	je     804124 <foreach_shared_region+0x42>
+  804142:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  804147:	f6 c4 04             	test   $0x4,%ah
+  80414a:	74 d8                	je     804124 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  80414c:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  804153:	4c 89 fa             	mov    %r15,%rdx
+  804156:	48 89 df             	mov    %rbx,%rdi
+  804159:	41 ff d6             	call   *%r14
+  80415c:	eb c6                	jmp    804124 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80415e:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804165:	00 
+  804166:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  80416b:	74 4a                	je     8041b7 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80416d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804171:	48 c1 e8 15          	shr    $0x15,%rax
+  804175:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80417c:	01 00 00 
+  80417f:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804183:	a8 01                	test   $0x1,%al
+  804185:	74 d7                	je     80415e <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804187:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  80418b:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804192:	48 39 c3             	cmp    %rax,%rbx
+  804195:	73 c7                	jae    80415e <foreach_shared_region+0x7c>
+  804197:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80419e:	48 39 d0             	cmp    %rdx,%rax
+  8041a1:	4d 19 e4             	sbb    %r12,%r12
+  8041a4:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  8041ab:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  8041b2:	e9 7a ff ff ff       	jmp    804131 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  8041b7:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  8041be:	40 
+  8041bf:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041c3:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8041ca:	00 00 00 
+  8041cd:	48 39 c1             	cmp    %rax,%rcx
+  8041d0:	74 50                	je     804222 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  8041d2:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8041d6:	48 c1 e8 1e          	shr    $0x1e,%rax
+  8041da:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  8041e1:	01 00 00 
+  8041e4:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  8041e8:	a8 01                	test   $0x1,%al
+  8041ea:	74 cb                	je     8041b7 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8041ec:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8041f0:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  8041f7:	48 39 c1             	cmp    %rax,%rcx
+  8041fa:	73 bb                	jae    8041b7 <foreach_shared_region+0xd5>
+  8041fc:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804203:	48 39 d0             	cmp    %rdx,%rax
+  804206:	48 19 c0             	sbb    %rax,%rax
+  804209:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  80420f:	48 05 00 02 00 00    	add    $0x200,%rax
+  804215:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  804219:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80421d:	e9 4b ff ff ff       	jmp    80416d <foreach_shared_region+0x8b>
+  804222:	b8 00 00 00 00       	mov    $0x0,%eax
+  804227:	48 83 c4 28          	add    $0x28,%rsp
+  80422b:	5b                   	pop    %rbx
+  80422c:	41 5c                	pop    %r12
+  80422e:	41 5d                	pop    %r13
+  804230:	41 5e                	pop    %r14
+  804232:	41 5f                	pop    %r15
+  804234:	5d                   	pop    %rbp
+  804235:	c3                   	ret
+
+0000000000804236 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804236:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80423c:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804243:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80424a:	c3                   	ret
+
+000000000080424b <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80424b:	8b 47 40             	mov    0x40(%rdi),%eax
+  80424e:	8b 17                	mov    (%rdi),%edx
+  804250:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804252:	83 f8 0f             	cmp    $0xf,%eax
+  804255:	77 13                	ja     80426a <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804257:	8b 47 40             	mov    0x40(%rdi),%eax
+  80425a:	83 e0 0f             	and    $0xf,%eax
+  80425d:	48 c1 e0 09          	shl    $0x9,%rax
+  804261:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804268:	00 
+  804269:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80426a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80426f:	c3                   	ret
+
+0000000000804270 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804270:	8b 47 40             	mov    0x40(%rdi),%eax
+  804273:	83 c0 01             	add    $0x1,%eax
+  804276:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804279:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80427f:	8b 57 04             	mov    0x4(%rdi),%edx
+  804282:	b8 00 00 00 00       	mov    $0x0,%eax
+  804287:	85 d2                	test   %edx,%edx
+  804289:	75 04                	jne    80428f <chan_publish+0x1f>
+  80428b:	83 e0 01             	and    $0x1,%eax
+}
+  80428e:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80428f:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804292:	85 c0                	test   %eax,%eax
+  804294:	0f 95 c0             	setne  %al
+  804297:	0f b6 c0             	movzbl %al,%eax
+  80429a:	eb ef                	jmp    80428b <chan_publish+0x1b>
+
+000000000080429c <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80429c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80429f:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042a1:	29 d0                	sub    %edx,%eax
+  8042a3:	83 e8 01             	sub    $0x1,%eax
+  8042a6:	83 f8 0f             	cmp    $0xf,%eax
+  8042a9:	77 12                	ja     8042bd <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8042ab:	8b 07                	mov    (%rdi),%eax
+  8042ad:	83 e0 0f             	and    $0xf,%eax
+  8042b0:	48 c1 e0 09          	shl    $0x9,%rax
+  8042b4:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8042bb:	00 
+  8042bc:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8042bd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042c2:	c3                   	ret
+
+00000000008042c3 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8042c3:	8b 07                	mov    (%rdi),%eax
+  8042c5:	83 c0 01             	add    $0x1,%eax
+  8042c8:	89 07                	mov    %eax,(%rdi)
+}
+  8042ca:	c3                   	ret
+
+00000000008042cb <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8042cb:	55                   	push   %rbp
+  8042cc:	48 89 e5             	mov    %rsp,%rbp
+  8042cf:	53                   	push   %rbx
+  8042d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8042d4:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  8042d7:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8042de:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  8042e4:	48 b8 9c 42 80 00 00 	movabs $0x80429c,%rax
+  8042eb:	00 00 00 
+  8042ee:	ff d0                	call   *%rax
+  8042f0:	48 85 c0             	test   %rax,%rax
+  8042f3:	74 12                	je     804307 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  8042f5:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8042fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804301:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804305:	c9                   	leave
+  804306:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804307:	b8 01 00 00 00       	mov    $0x1,%eax
+  80430c:	eb f3                	jmp    804301 <chan_arm+0x36>
+
+000000000080430e <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80430e:	55                   	push   %rbp
+  80430f:	48 89 e5             	mov    %rsp,%rbp
+  804312:	41 56                	push   %r14
+  804314:	41 55                	push   %r13
+  804316:	41 54                	push   %r12
+  804318:	53                   	push   %rbx
+  804319:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80431c:	49 bc cb 42 80 00 00 	movabs $0x8042cb,%r12
+  804323:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804326:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80432a:	49 bd 05 15 80 00 00 	movabs $0x801505,%r13
+  804331:	00 00 00 
+    while (chan_arm(r))
+  804334:	eb 0d                	jmp    804343 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804336:	8b 33                	mov    (%rbx),%esi
+  804338:	ba 00 00 00 00       	mov    $0x0,%edx
+  80433d:	4c 89 f7             	mov    %r14,%rdi
+  804340:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804343:	48 89 df             	mov    %rbx,%rdi
+  804346:	41 ff d4             	call   *%r12
+  804349:	84 c0                	test   %al,%al
+  80434b:	75 e9                	jne    804336 <chan_wait+0x28>
+}
+  80434d:	5b                   	pop    %rbx
+  80434e:	41 5c                	pop    %r12
+  804350:	41 5d                	pop    %r13
+  804352:	41 5e                	pop    %r14
+  804354:	5d                   	pop    %rbp
+  804355:	c3                   	ret
+
+0000000000804356 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804356:	55                   	push   %rbp
+  804357:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80435a:	48 83 c7 40          	add    $0x40,%rdi
+  80435e:	be 01 00 00 00       	mov    $0x1,%esi
+  804363:	48 b8 23 15 80 00 00 	movabs $0x801523,%rax
+  80436a:	00 00 00 
+  80436d:	ff d0                	call   *%rax
+}
+  80436f:	5d                   	pop    %rbp
+  804370:	c3                   	ret
+
+0000000000804371 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804371:	b8 00 00 00 00       	mov    $0x0,%eax
+  804376:	c3                   	ret
+
+0000000000804377 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804377:	55                   	push   %rbp
+  804378:	48 89 e5             	mov    %rsp,%rbp
+  80437b:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80437e:	48 be 54 50 80 00 00 	movabs $0x805054,%rsi
+  804385:	00 00 00 
+  804388:	48 b8 38 0c 80 00 00 	movabs $0x800c38,%rax
+  80438f:	00 00 00 
+  804392:	ff d0                	call   *%rax
+    return 0;
+}
+  804394:	b8 00 00 00 00       	mov    $0x0,%eax
+  804399:	5d                   	pop    %rbp
+  80439a:	c3                   	ret
+
+000000000080439b <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80439b:	55                   	push   %rbp
+  80439c:	48 89 e5             	mov    %rsp,%rbp
+  80439f:	41 57                	push   %r15
+  8043a1:	41 56                	push   %r14
+  8043a3:	41 55                	push   %r13
+  8043a5:	41 54                	push   %r12
+  8043a7:	53                   	push   %rbx
+  8043a8:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8043af:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8043b6:	48 85 d2             	test   %rdx,%rdx
+  8043b9:	74 7a                	je     804435 <devcons_write+0x9a>
+  8043bb:	49 89 d6             	mov    %rdx,%r14
+  8043be:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8043c4:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8043c9:	49 bf 32 0e 80 00 00 	movabs $0x800e32,%r15
+  8043d0:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8043d3:	4c 89 f3             	mov    %r14,%rbx
+  8043d6:	48 29 f3             	sub    %rsi,%rbx
+  8043d9:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8043de:	48 39 c3             	cmp    %rax,%rbx
+  8043e1:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8043e5:	4c 63 eb             	movslq %ebx,%r13
+  8043e8:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  8043ef:	48 01 c6             	add    %rax,%rsi
+  8043f2:	4c 89 ea             	mov    %r13,%rdx
+  8043f5:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8043fc:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8043ff:	4c 89 ee             	mov    %r13,%rsi
+  804402:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  804409:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  804410:	00 00 00 
+  804413:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804415:	41 01 dc             	add    %ebx,%r12d
+  804418:	49 63 f4             	movslq %r12d,%rsi
+  80441b:	4c 39 f6             	cmp    %r14,%rsi
+  80441e:	72 b3                	jb     8043d3 <devcons_write+0x38>
+    return res;
+  804420:	49 63 c4             	movslq %r12d,%rax
+}
+  804423:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80442a:	5b                   	pop    %rbx
+  80442b:	41 5c                	pop    %r12
+  80442d:	41 5d                	pop    %r13
+  80442f:	41 5e                	pop    %r14
+  804431:	41 5f                	pop    %r15
+  804433:	5d                   	pop    %rbp
+  804434:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804435:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80443b:	eb e3                	jmp    804420 <devcons_write+0x85>
+
+000000000080443d <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80443d:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804440:	ba 00 00 00 00       	mov    $0x0,%edx
+  804445:	48 85 c0             	test   %rax,%rax
+  804448:	74 55                	je     80449f <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80444a:	55                   	push   %rbp
+  80444b:	48 89 e5             	mov    %rsp,%rbp
+  80444e:	41 55                	push   %r13
+  804450:	41 54                	push   %r12
+  804452:	53                   	push   %rbx
+  804453:	48 83 ec 08          	sub    $0x8,%rsp
+  804457:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80445a:	48 bb 7e 10 80 00 00 	movabs $0x80107e,%rbx
+  804461:	00 00 00 
+  804464:	49 bc 33 11 80 00 00 	movabs $0x801133,%r12
+  80446b:	00 00 00 
+  80446e:	eb 03                	jmp    804473 <devcons_read+0x36>
+  804470:	41 ff d4             	call   *%r12
+  804473:	ff d3                	call   *%rbx
+  804475:	85 c0                	test   %eax,%eax
+  804477:	74 f7                	je     804470 <devcons_read+0x33>
+    if (c < 0) return c;
+  804479:	48 63 d0             	movslq %eax,%rdx
+  80447c:	78 13                	js     804491 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80447e:	ba 00 00 00 00       	mov    $0x0,%edx
+  804483:	83 f8 04             	cmp    $0x4,%eax
+  804486:	74 09                	je     804491 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804488:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80448c:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804491:	48 89 d0             	mov    %rdx,%rax
+  804494:	48 83 c4 08          	add    $0x8,%rsp
+  804498:	5b                   	pop    %rbx
+  804499:	41 5c                	pop    %r12
+  80449b:	41 5d                	pop    %r13
+  80449d:	5d                   	pop    %rbp
+  80449e:	c3                   	ret
+  80449f:	48 89 d0             	mov    %rdx,%rax
+  8044a2:	c3                   	ret
+
+00000000008044a3 <cputchar>:
+cputchar(int ch) {
+  8044a3:	55                   	push   %rbp
+  8044a4:	48 89 e5             	mov    %rsp,%rbp
+  8044a7:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8044ab:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8044af:	be 01 00 00 00       	mov    $0x1,%esi
+  8044b4:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8044b8:	48 b8 5f 10 80 00 00 	movabs $0x80105f,%rax
+  8044bf:	00 00 00 
+  8044c2:	ff d0                	call   *%rax
+}
+  8044c4:	c9                   	leave
+  8044c5:	c3                   	ret
+
+00000000008044c6 <getchar>:
+getchar(void) {
+  8044c6:	55                   	push   %rbp
+  8044c7:	48 89 e5             	mov    %rsp,%rbp
+  8044ca:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8044ce:	ba 01 00 00 00       	mov    $0x1,%edx
+  8044d3:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8044d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8044dc:	48 b8 22 1c 80 00 00 	movabs $0x801c22,%rax
+  8044e3:	00 00 00 
+  8044e6:	ff d0                	call   *%rax
+  8044e8:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8044ea:	85 c0                	test   %eax,%eax
+  8044ec:	78 06                	js     8044f4 <getchar+0x2e>
+  8044ee:	74 08                	je     8044f8 <getchar+0x32>
+  8044f0:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  8044f4:	89 d0                	mov    %edx,%eax
+  8044f6:	c9                   	leave
+  8044f7:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  8044f8:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8044fd:	eb f5                	jmp    8044f4 <getchar+0x2e>
+
+00000000008044ff <iscons>:
+iscons(int fdnum) {
+  8044ff:	55                   	push   %rbp
+  804500:	48 89 e5             	mov    %rsp,%rbp
+  804503:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804507:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80450b:	48 b8 3f 19 80 00 00 	movabs $0x80193f,%rax
+  804512:	00 00 00 
+  804515:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804517:	85 c0                	test   %eax,%eax
+  804519:	78 18                	js     804533 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80451b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80451f:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804526:	00 00 00 
+  804529:	8b 00                	mov    (%rax),%eax
+  80452b:	39 02                	cmp    %eax,(%rdx)
+  80452d:	0f 94 c0             	sete   %al
+  804530:	0f b6 c0             	movzbl %al,%eax
+}
+  804533:	c9                   	leave
+  804534:	c3                   	ret
+
+0000000000804535 <opencons>:
+opencons(void) {
+  804535:	55                   	push   %rbp
+  804536:	48 89 e5             	mov    %rsp,%rbp
+  804539:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80453d:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804541:	48 b8 df 18 80 00 00 	movabs $0x8018df,%rax
+  804548:	00 00 00 
+  80454b:	ff d0                	call   *%rax
+  80454d:	85 c0                	test   %eax,%eax
+  80454f:	78 49                	js     80459a <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804551:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804556:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80455b:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  80455f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804564:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  80456b:	00 00 00 
+  80456e:	ff d0                	call   *%rax
+  804570:	85 c0                	test   %eax,%eax
+  804572:	78 26                	js     80459a <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804574:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804578:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80457f:	00 00 
+  804581:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804583:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804587:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80458e:	48 b8 b1 18 80 00 00 	movabs $0x8018b1,%rax
+  804595:	00 00 00 
+  804598:	ff d0                	call   *%rax
+}
+  80459a:	c9                   	leave
+  80459b:	c3                   	ret
+
+000000000080459c <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80459c:	55                   	push   %rbp
+  80459d:	48 89 e5             	mov    %rsp,%rbp
+  8045a0:	41 56                	push   %r14
+  8045a2:	41 55                	push   %r13
+  8045a4:	41 54                	push   %r12
+  8045a6:	53                   	push   %rbx
+  8045a7:	48 83 ec 50          	sub    $0x50,%rsp
+  8045ab:	49 89 fc             	mov    %rdi,%r12
+  8045ae:	41 89 f5             	mov    %esi,%r13d
+  8045b1:	48 89 d3             	mov    %rdx,%rbx
+  8045b4:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8045b8:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8045bc:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8045c0:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8045c7:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8045cb:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  8045cf:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  8045d3:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  8045d7:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8045de:	00 00 00 
+  8045e1:	4c 8b 30             	mov    (%rax),%r14
+  8045e4:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  8045eb:	00 00 00 
+  8045ee:	ff d0                	call   *%rax
+  8045f0:	89 c6                	mov    %eax,%esi
+  8045f2:	45 89 e8             	mov    %r13d,%r8d
+  8045f5:	4c 89 e1             	mov    %r12,%rcx
+  8045f8:	4c 89 f2             	mov    %r14,%rdx
+  8045fb:	48 bf 60 50 80 00 00 	movabs $0x805060,%rdi
+  804602:	00 00 00 
+  804605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80460a:	49 bc 13 03 80 00 00 	movabs $0x800313,%r12
+  804611:	00 00 00 
+  804614:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804617:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80461b:	48 89 df             	mov    %rbx,%rdi
+  80461e:	48 b8 af 02 80 00 00 	movabs $0x8002af,%rax
+  804625:	00 00 00 
+  804628:	ff d0                	call   *%rax
+    cprintf("\n");
+  80462a:	48 bf ab 4f 80 00 00 	movabs $0x804fab,%rdi
+  804631:	00 00 00 
+  804634:	b8 00 00 00 00       	mov    $0x0,%eax
+  804639:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80463c:	cc                   	int3
+  80463d:	eb fd                	jmp    80463c <_panic+0xa0>
+
+000000000080463f <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80463f:	55                   	push   %rbp
+  804640:	48 89 e5             	mov    %rsp,%rbp
+  804643:	41 56                	push   %r14
+  804645:	41 55                	push   %r13
+  804647:	41 54                	push   %r12
+  804649:	53                   	push   %rbx
+  80464a:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80464d:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804654:	00 00 00 
+  804657:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80465b:	74 27                	je     804684 <_handle_vectored_pagefault+0x45>
+  80465d:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804662:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804669:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80466c:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80466f:	4c 89 e7             	mov    %r12,%rdi
+  804672:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804677:	84 c0                	test   %al,%al
+  804679:	75 45                	jne    8046c0 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80467b:	48 83 c3 01          	add    $0x1,%rbx
+  80467f:	49 3b 1e             	cmp    (%r14),%rbx
+  804682:	72 eb                	jb     80466f <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804684:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80468b:	00 
+  80468c:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804691:	4d 8b 04 24          	mov    (%r12),%r8
+  804695:	48 ba 88 50 80 00 00 	movabs $0x805088,%rdx
+  80469c:	00 00 00 
+  80469f:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8046a4:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8046ab:	00 00 00 
+  8046ae:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b3:	49 ba 9c 45 80 00 00 	movabs $0x80459c,%r10
+  8046ba:	00 00 00 
+  8046bd:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046c0:	5b                   	pop    %rbx
+  8046c1:	41 5c                	pop    %r12
+  8046c3:	41 5d                	pop    %r13
+  8046c5:	41 5e                	pop    %r14
+  8046c7:	5d                   	pop    %rbp
+  8046c8:	c3                   	ret
+
+00000000008046c9 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046c9:	55                   	push   %rbp
+  8046ca:	48 89 e5             	mov    %rsp,%rbp
+  8046cd:	53                   	push   %rbx
+  8046ce:	48 83 ec 08          	sub    $0x8,%rsp
+  8046d2:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046d5:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046dc:	00 00 00 
+  8046df:	80 38 00             	cmpb   $0x0,(%rax)
+  8046e2:	0f 84 84 00 00 00    	je     80476c <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046e8:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046ef:	00 00 00 
+  8046f2:	48 8b 10             	mov    (%rax),%rdx
+  8046f5:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046fa:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804701:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804704:	48 85 d2             	test   %rdx,%rdx
+  804707:	74 19                	je     804722 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804709:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80470d:	0f 84 e8 00 00 00    	je     8047fb <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804713:	48 83 c0 01          	add    $0x1,%rax
+  804717:	48 39 d0             	cmp    %rdx,%rax
+  80471a:	75 ed                	jne    804709 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80471c:	48 83 fa 08          	cmp    $0x8,%rdx
+  804720:	74 1c                	je     80473e <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804722:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804726:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80472d:	00 00 00 
+  804730:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804737:	00 00 00 
+  80473a:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80473e:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  804745:	00 00 00 
+  804748:	ff d0                	call   *%rax
+  80474a:	89 c7                	mov    %eax,%edi
+  80474c:	48 be c1 48 80 00 00 	movabs $0x8048c1,%rsi
+  804753:	00 00 00 
+  804756:	48 b8 55 13 80 00 00 	movabs $0x801355,%rax
+  80475d:	00 00 00 
+  804760:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804762:	85 c0                	test   %eax,%eax
+  804764:	78 68                	js     8047ce <add_pgfault_handler+0x105>
+    return res;
+}
+  804766:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80476a:	c9                   	leave
+  80476b:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80476c:	48 b8 0a 11 80 00 00 	movabs $0x80110a,%rax
+  804773:	00 00 00 
+  804776:	ff d0                	call   *%rax
+  804778:	89 c7                	mov    %eax,%edi
+  80477a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80477f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804784:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80478b:	00 00 00 
+  80478e:	48 b8 97 11 80 00 00 	movabs $0x801197,%rax
+  804795:	00 00 00 
+  804798:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80479a:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8047a1:	00 00 00 
+  8047a4:	48 8b 02             	mov    (%rdx),%rax
+  8047a7:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047ab:	48 89 0a             	mov    %rcx,(%rdx)
+  8047ae:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047b5:	00 00 00 
+  8047b8:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047bc:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047c3:	00 00 00 
+  8047c6:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047c9:	e9 70 ff ff ff       	jmp    80473e <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047ce:	89 c1                	mov    %eax,%ecx
+  8047d0:	48 ba c6 50 80 00 00 	movabs $0x8050c6,%rdx
+  8047d7:	00 00 00 
+  8047da:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047df:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  8047e6:	00 00 00 
+  8047e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047ee:	49 b8 9c 45 80 00 00 	movabs $0x80459c,%r8
+  8047f5:	00 00 00 
+  8047f8:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047fb:	b8 00 00 00 00       	mov    $0x0,%eax
+  804800:	e9 61 ff ff ff       	jmp    804766 <add_pgfault_handler+0x9d>
+
+0000000000804805 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804805:	55                   	push   %rbp
+  804806:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804809:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804810:	00 00 00 
+  804813:	80 38 00             	cmpb   $0x0,(%rax)
+  804816:	74 33                	je     80484b <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804818:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80481f:	00 00 00 
+  804822:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804827:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80482e:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804831:	48 85 c0             	test   %rax,%rax
+  804834:	0f 84 85 00 00 00    	je     8048bf <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80483a:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80483e:	74 40                	je     804880 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804840:	48 83 c1 01          	add    $0x1,%rcx
+  804844:	48 39 c1             	cmp    %rax,%rcx
+  804847:	75 f1                	jne    80483a <remove_pgfault_handler+0x35>
+  804849:	eb 74                	jmp    8048bf <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80484b:	48 b9 de 50 80 00 00 	movabs $0x8050de,%rcx
+  804852:	00 00 00 
+  804855:	48 ba 07 50 80 00 00 	movabs $0x805007,%rdx
+  80485c:	00 00 00 
+  80485f:	be 43 00 00 00       	mov    $0x43,%esi
+  804864:	48 bf b8 50 80 00 00 	movabs $0x8050b8,%rdi
+  80486b:	00 00 00 
+  80486e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804873:	49 b8 9c 45 80 00 00 	movabs $0x80459c,%r8
+  80487a:	00 00 00 
+  80487d:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804880:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804887:	00 
+  804888:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80488c:	48 29 ca             	sub    %rcx,%rdx
+  80488f:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804896:	00 00 00 
+  804899:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80489d:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8048a2:	48 89 ce             	mov    %rcx,%rsi
+  8048a5:	48 b8 32 0e 80 00 00 	movabs $0x800e32,%rax
+  8048ac:	00 00 00 
+  8048af:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048b1:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048b8:	00 00 00 
+  8048bb:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048bf:	5d                   	pop    %rbp
+  8048c0:	c3                   	ret
+
+00000000008048c1 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048c1:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048c4:	48 b8 3f 46 80 00 00 	movabs $0x80463f,%rax
+  8048cb:	00 00 00 
+    call *%rax
+  8048ce:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048d0:	41 5f                	pop    %r15
+	popq %r15
+  8048d2:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048d4:	41 5f                	pop    %r15
+	popq %r14
+  8048d6:	41 5e                	pop    %r14
+	popq %r13
+  8048d8:	41 5d                	pop    %r13
+	popq %r12
+  8048da:	41 5c                	pop    %r12
+	popq %r11
+  8048dc:	41 5b                	pop    %r11
+	popq %r10
+  8048de:	41 5a                	pop    %r10
+	popq %r9
+  8048e0:	41 59                	pop    %r9
+	popq %r8
+  8048e2:	41 58                	pop    %r8
+	popq %rsi
+  8048e4:	5e                   	pop    %rsi
+	popq %rdi
+  8048e5:	5f                   	pop    %rdi
+	popq %rbp
+  8048e6:	5d                   	pop    %rbp
+	popq %rdx
+  8048e7:	5a                   	pop    %rdx
+	popq %rcx
+  8048e8:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8048e9:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8048ee:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8048f3:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8048f7:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8048fa:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8048ff:	5b                   	pop    %rbx
+	popq %rax
+  804900:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804901:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804905:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804906:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80490b:	c3                   	ret
+  80490c:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804910 <__rodata_start>:
+  804910:	69 20 61 6d 20 25    	imul   $0x25206d61,(%rax),%esp
+  804916:	30 38                	xor    %bh,(%rax)
+  804918:	78 3b                	js     804955 <__rodata_start+0x45>
+  80491a:	20 74 68 69          	and    %dh,0x69(%rax,%rbp,2)
+  80491e:	73 65                	jae    804985 <__rodata_start+0x75>
+  804920:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804921:	76 20                	jbe    804943 <__rodata_start+0x33>
+  804923:	69 73 20 25 70 0a 00 	imul   $0xa7025,0x20(%rbx),%esi
+  80492a:	73 65                	jae    804991 <__rodata_start+0x81>
+  80492c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80492d:	64 20 30             	and    %dh,%fs:(%rax)
+  804930:	20 66 72             	and    %ah,0x72(%rsi)
+  804933:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804934:	6d                   	insl   (%dx),%es:(%rdi)
+  804935:	20 25 78 20 74 6f    	and    %ah,0x6f742078(%rip)        # 6ff469b3 <__bss_end+0x6f7049b3>
+  80493b:	20 25 78 0a 00 25    	and    %ah,0x25000a78(%rip)        # 258053b9 <__bss_end+0x24fc33b9>
+  804941:	78 20                	js     804963 <__rodata_start+0x53>
+  804943:	67 6f                	outsl  %ds:(%esi),(%dx)
+  804945:	74 20                	je     804967 <__rodata_start+0x57>
+  804947:	25 64 20 66 72       	and    $0x72662064,%eax
+  80494c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80494d:	6d                   	insl   (%dx),%es:(%rdi)
+  80494e:	20 25 78 20 28 74    	and    %ah,0x74282078(%rip)        # 74a869cc <__bss_end+0x742449cc>
+  804954:	68 69 73 65 6e       	push   $0x6e657369
+  804959:	76 20                	jbe    80497b <__rodata_start+0x6b>
+  80495b:	69 73 20 25 70 20 25 	imul   $0x25207025,0x20(%rbx),%esi
+  804962:	78 29                	js     80498d <__rodata_start+0x7d>
+  804964:	0a 00                	or     (%rax),%al
+  804966:	3c 75                	cmp    $0x75,%al
+  804968:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804969:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80496d:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80496e:	3e 00 30             	ds add %dh,(%rax)
+  804971:	31 32                	xor    %esi,(%rdx)
+  804973:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80497a:	41                   	rex.B
+  80497b:	42                   	rex.X
+  80497c:	43                   	rex.XB
+  80497d:	44                   	rex.R
+  80497e:	45                   	rex.RB
+  80497f:	46 00 30             	rex.RX add %r14b,(%rax)
+  804982:	31 32                	xor    %esi,(%rdx)
+  804984:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80498b:	61                   	(bad)
+  80498c:	62 63 64 65 66       	(bad)
+  804991:	00 28                	add    %ch,(%rax)
+  804993:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804994:	75 6c                	jne    804a02 <__rodata_start+0xf2>
+  804996:	6c                   	insb   (%dx),%es:(%rdi)
+  804997:	29 00                	sub    %eax,(%rax)
+  804999:	65 72 72             	gs jb  804a0e <__rodata_start+0xfe>
+  80499c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80499d:	72 20                	jb     8049bf <__rodata_start+0xaf>
+  80499f:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  8049a4:	73 70                	jae    804a16 <__rodata_start+0x106>
+  8049a6:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  8049aa:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  8049b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b2:	72 00                	jb     8049b4 <__rodata_start+0xa4>
+  8049b4:	62 61 64 20 65       	(bad)
+  8049b9:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049ba:	76 69                	jbe    804a25 <__rodata_start+0x115>
+  8049bc:	72 6f                	jb     804a2d <__rodata_start+0x11d>
+  8049be:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049bf:	6d                   	insl   (%dx),%es:(%rdi)
+  8049c0:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049c2:	74 00                	je     8049c4 <__rodata_start+0xb4>
+  8049c4:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049cb:	20 70 61             	and    %dh,0x61(%rax)
+  8049ce:	72 61                	jb     804a31 <__rodata_start+0x121>
+  8049d0:	6d                   	insl   (%dx),%es:(%rdi)
+  8049d1:	65 74 65             	gs je  804a39 <__rodata_start+0x129>
+  8049d4:	72 00                	jb     8049d6 <__rodata_start+0xc6>
+  8049d6:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049d7:	75 74                	jne    804a4d <__rodata_start+0x13d>
+  8049d9:	20 6f 66             	and    %ch,0x66(%rdi)
+  8049dc:	20 6d 65             	and    %ch,0x65(%rbp)
+  8049df:	6d                   	insl   (%dx),%es:(%rdi)
+  8049e0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e1:	72 79                	jb     804a5c <__rodata_start+0x14c>
+  8049e3:	00 6f 75             	add    %ch,0x75(%rdi)
+  8049e6:	74 20                	je     804a08 <__rodata_start+0xf8>
+  8049e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049e9:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8049ed:	76 69                	jbe    804a58 <__rodata_start+0x148>
+  8049ef:	72 6f                	jb     804a60 <__rodata_start+0x150>
+  8049f1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049f2:	6d                   	insl   (%dx),%es:(%rdi)
+  8049f3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049f5:	74 73                	je     804a6a <__rodata_start+0x15a>
+  8049f7:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8049fa:	72 72                	jb     804a6e <__rodata_start+0x15e>
+  8049fc:	75 70                	jne    804a6e <__rodata_start+0x15e>
+  8049fe:	74 65                	je     804a65 <__rodata_start+0x155>
+  804a00:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804a05:	75 67                	jne    804a6e <__rodata_start+0x15e>
+  804a07:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804a0a:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a0c:	00 73 65             	add    %dh,0x65(%rbx)
+  804a0f:	67 6d                	insl   (%dx),%es:(%edi)
+  804a11:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a13:	74 61                	je     804a76 <__rodata_start+0x166>
+  804a15:	74 69                	je     804a80 <__rodata_start+0x170>
+  804a17:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a18:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a19:	20 66 61             	and    %ah,0x61(%rsi)
+  804a1c:	75 6c                	jne    804a8a <__rodata_start+0x17a>
+  804a1e:	74 00                	je     804a20 <__rodata_start+0x110>
+  804a20:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a27:	20 45 4c             	and    %al,0x4c(%rbp)
+  804a2a:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804a2e:	61                   	(bad)
+  804a2f:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804a34:	20 73 75             	and    %dh,0x75(%rbx)
+  804a37:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804a3a:	73 79                	jae    804ab5 <__rodata_start+0x1a5>
+  804a3c:	73 74                	jae    804ab2 <__rodata_start+0x1a2>
+  804a3e:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804a40:	20 63 61             	and    %ah,0x61(%rbx)
+  804a43:	6c                   	insb   (%dx),%es:(%rdi)
+  804a44:	6c                   	insb   (%dx),%es:(%rdi)
+  804a45:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804a48:	74 72                	je     804abc <__rodata_start+0x1ac>
+  804a4a:	79 20                	jns    804a6c <__rodata_start+0x15c>
+  804a4c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a4d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a4e:	74 20                	je     804a70 <__rodata_start+0x160>
+  804a50:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a52:	75 6e                	jne    804ac2 <__rodata_start+0x1b2>
+  804a54:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804a58:	76 20                	jbe    804a7a <__rodata_start+0x16a>
+  804a5a:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804a61:	72 65                	jb     804ac8 <__rodata_start+0x1b8>
+  804a63:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804a66:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a67:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804a6b:	65 78 70             	gs js  804ade <__rodata_start+0x1ce>
+  804a6e:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a73:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a76:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a7a:	20 66 69             	and    %ah,0x69(%rsi)
+  804a7d:	6c                   	insb   (%dx),%es:(%rdi)
+  804a7e:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a82:	20 66 72             	and    %ah,0x72(%rsi)
+  804a85:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a8a:	61                   	(bad)
+  804a8b:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a8e:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a90:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a94:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a97:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a99:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a9c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a9d:	79 20                	jns    804abf <__rodata_start+0x1af>
+  804a9f:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804aa6:	72 65                	jb     804b0d <__rodata_start+0x1fd>
+  804aa8:	20 6f 70             	and    %ch,0x70(%rdi)
+  804aab:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804aad:	00 66 69             	add    %ah,0x69(%rsi)
+  804ab0:	6c                   	insb   (%dx),%es:(%rdi)
+  804ab1:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804ab5:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804ab8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ab9:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804abc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804abd:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804abe:	74 20                	je     804ae0 <__rodata_start+0x1d0>
+  804ac0:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804ac2:	75 6e                	jne    804b32 <__rodata_start+0x222>
+  804ac4:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804ac8:	76 61                	jbe    804b2b <__rodata_start+0x21b>
+  804aca:	6c                   	insb   (%dx),%es:(%rdi)
+  804acb:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804ad2:	00 
+  804ad3:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804ada:	72 65                	jb     804b41 <__rodata_start+0x231>
+  804adc:	61                   	(bad)
+  804add:	64 79 20             	fs jns 804b00 <__rodata_start+0x1f0>
+  804ae0:	65 78 69             	gs js  804b4c <__rodata_start+0x23c>
+  804ae3:	73 74                	jae    804b59 <__rodata_start+0x249>
+  804ae5:	73 00                	jae    804ae7 <__rodata_start+0x1d7>
+  804ae7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ae8:	70 65                	jo     804b4f <__rodata_start+0x23f>
+  804aea:	72 61                	jb     804b4d <__rodata_start+0x23d>
+  804aec:	74 69                	je     804b57 <__rodata_start+0x247>
+  804aee:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aef:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804af0:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804af3:	74 20                	je     804b15 <__rodata_start+0x205>
+  804af5:	73 75                	jae    804b6c <__rodata_start+0x25c>
+  804af7:	70 70                	jo     804b69 <__rodata_start+0x259>
+  804af9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804afa:	72 74                	jb     804b70 <__rodata_start+0x260>
+  804afc:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804b02:	20 61 67             	and    %ah,0x67(%rcx)
+  804b05:	61                   	(bad)
+  804b06:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804b0d:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804b11:	74 00                	je     804b13 <__rodata_start+0x203>
+  804b13:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804b1a:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804b1d:	20 75 73             	and    %dh,0x73(%rbp)
+  804b20:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804b24:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804b2b:	00 
+  804b2c:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b33:	00 00 00 
+  804b36:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b3d:	00 00 00 
+  804b40:	00 05 80 00 00 00    	add    %al,0x80(%rip)        # 804bc6 <__rodata_start+0x2b6>
+  804b46:	00 00                	add    %al,(%rax)
+  804b48:	41 0b 80 00 00 00 00 	or     0x0(%r8),%eax
+  804b4f:	00 31                	add    %dh,(%rcx)
+  804b51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b57:	00 41 0b             	add    %al,0xb(%rcx)
+  804b5a:	80 00 00             	addb   $0x0,(%rax)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 41 0b             	add    %al,0xb(%rcx)
+  804b62:	80 00 00             	addb   $0x0,(%rax)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 41 0b             	add    %al,0xb(%rcx)
+  804b6a:	80 00 00             	addb   $0x0,(%rax)
+  804b6d:	00 00                	add    %al,(%rax)
+  804b6f:	00 41 0b             	add    %al,0xb(%rcx)
+  804b72:	80 00 00             	addb   $0x0,(%rax)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 1f                	add    %bl,(%rdi)
+  804b79:	05 80 00 00 00       	add    $0x80,%eax
+  804b7e:	00 00                	add    %al,(%rax)
+  804b80:	41 0b 80 00 00 00 00 	or     0x0(%r8),%eax
+  804b87:	00 41 0b             	add    %al,0xb(%rcx)
+  804b8a:	80 00 00             	addb   $0x0,(%rax)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 13                	add    %dl,(%rbx)
+  804b91:	05 80 00 00 00       	add    $0x80,%eax
+  804b96:	00 00                	add    %al,(%rax)
+  804b98:	8d 05 80 00 00 00    	lea    0x80(%rip),%eax        # 804c1e <__rodata_start+0x30e>
+  804b9e:	00 00                	add    %al,(%rax)
+  804ba0:	41 0b 80 00 00 00 00 	or     0x0(%r8),%eax
+  804ba7:	00 13                	add    %dl,(%rbx)
+  804ba9:	05 80 00 00 00       	add    $0x80,%eax
+  804bae:	00 00                	add    %al,(%rax)
+  804bb0:	59                   	pop    %rcx
+  804bb1:	05 80 00 00 00       	add    $0x80,%eax
+  804bb6:	00 00                	add    %al,(%rax)
+  804bb8:	59                   	pop    %rcx
+  804bb9:	05 80 00 00 00       	add    $0x80,%eax
+  804bbe:	00 00                	add    %al,(%rax)
+  804bc0:	59                   	pop    %rcx
+  804bc1:	05 80 00 00 00       	add    $0x80,%eax
+  804bc6:	00 00                	add    %al,(%rax)
+  804bc8:	59                   	pop    %rcx
+  804bc9:	05 80 00 00 00       	add    $0x80,%eax
+  804bce:	00 00                	add    %al,(%rax)
+  804bd0:	59                   	pop    %rcx
+  804bd1:	05 80 00 00 00       	add    $0x80,%eax
+  804bd6:	00 00                	add    %al,(%rax)
+  804bd8:	59                   	pop    %rcx
+  804bd9:	05 80 00 00 00       	add    $0x80,%eax
+  804bde:	00 00                	add    %al,(%rax)
+  804be0:	59                   	pop    %rcx
+  804be1:	05 80 00 00 00       	add    $0x80,%eax
+  804be6:	00 00                	add    %al,(%rax)
+  804be8:	59                   	pop    %rcx
+  804be9:	05 80 00 00 00       	add    $0x80,%eax
+  804bee:	00 00                	add    %al,(%rax)
+  804bf0:	59                   	pop    %rcx
+  804bf1:	05 80 00 00 00       	add    $0x80,%eax
+  804bf6:	00 00                	add    %al,(%rax)
+  804bf8:	41 0b 80 00 00 00 00 	or     0x0(%r8),%eax
+  804bff:	00 41 0b             	add    %al,0xb(%rcx)
+  804c02:	80 00 00             	addb   $0x0,(%rax)
+  804c05:	00 00                	add    %al,(%rax)
+  804c07:	00 41 0b             	add    %al,0xb(%rcx)
+  804c0a:	80 00 00             	addb   $0x0,(%rax)
+  804c0d:	00 00                	add    %al,(%rax)
+  804c0f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c12:	80 00 00             	addb   $0x0,(%rax)
+  804c15:	00 00                	add    %al,(%rax)
+  804c17:	00 41 0b             	add    %al,0xb(%rcx)
+  804c1a:	80 00 00             	addb   $0x0,(%rax)
+  804c1d:	00 00                	add    %al,(%rax)
+  804c1f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c22:	80 00 00             	addb   $0x0,(%rax)
+  804c25:	00 00                	add    %al,(%rax)
+  804c27:	00 41 0b             	add    %al,0xb(%rcx)
+  804c2a:	80 00 00             	addb   $0x0,(%rax)
+  804c2d:	00 00                	add    %al,(%rax)
+  804c2f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c32:	80 00 00             	addb   $0x0,(%rax)
+  804c35:	00 00                	add    %al,(%rax)
+  804c37:	00 41 0b             	add    %al,0xb(%rcx)
+  804c3a:	80 00 00             	addb   $0x0,(%rax)
+  804c3d:	00 00                	add    %al,(%rax)
+  804c3f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c42:	80 00 00             	addb   $0x0,(%rax)
+  804c45:	00 00                	add    %al,(%rax)
+  804c47:	00 41 0b             	add    %al,0xb(%rcx)
+  804c4a:	80 00 00             	addb   $0x0,(%rax)
+  804c4d:	00 00                	add    %al,(%rax)
+  804c4f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c52:	80 00 00             	addb   $0x0,(%rax)
+  804c55:	00 00                	add    %al,(%rax)
+  804c57:	00 41 0b             	add    %al,0xb(%rcx)
+  804c5a:	80 00 00             	addb   $0x0,(%rax)
+  804c5d:	00 00                	add    %al,(%rax)
+  804c5f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c62:	80 00 00             	addb   $0x0,(%rax)
+  804c65:	00 00                	add    %al,(%rax)
+  804c67:	00 41 0b             	add    %al,0xb(%rcx)
+  804c6a:	80 00 00             	addb   $0x0,(%rax)
+  804c6d:	00 00                	add    %al,(%rax)
+  804c6f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c72:	80 00 00             	addb   $0x0,(%rax)
+  804c75:	00 00                	add    %al,(%rax)
+  804c77:	00 41 0b             	add    %al,0xb(%rcx)
+  804c7a:	80 00 00             	addb   $0x0,(%rax)
+  804c7d:	00 00                	add    %al,(%rax)
+  804c7f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c82:	80 00 00             	addb   $0x0,(%rax)
+  804c85:	00 00                	add    %al,(%rax)
+  804c87:	00 41 0b             	add    %al,0xb(%rcx)
+  804c8a:	80 00 00             	addb   $0x0,(%rax)
+  804c8d:	00 00                	add    %al,(%rax)
+  804c8f:	00 41 0b             	add    %al,0xb(%rcx)
+  804c92:	80 00 00             	addb   $0x0,(%rax)
+  804c95:	00 00                	add    %al,(%rax)
+  804c97:	00 41 0b             	add    %al,0xb(%rcx)
+  804c9a:	80 00 00             	addb   $0x0,(%rax)
+  804c9d:	00 00                	add    %al,(%rax)
+  804c9f:	00 41 0b             	add    %al,0xb(%rcx)
+  804ca2:	80 00 00             	addb   $0x0,(%rax)
+  804ca5:	00 00                	add    %al,(%rax)
+  804ca7:	00 41 0b             	add    %al,0xb(%rcx)
+  804caa:	80 00 00             	addb   $0x0,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 41 0b             	add    %al,0xb(%rcx)
+  804cb2:	80 00 00             	addb   $0x0,(%rax)
+  804cb5:	00 00                	add    %al,(%rax)
+  804cb7:	00 41 0b             	add    %al,0xb(%rcx)
+  804cba:	80 00 00             	addb   $0x0,(%rax)
+  804cbd:	00 00                	add    %al,(%rax)
+  804cbf:	00 41 0b             	add    %al,0xb(%rcx)
+  804cc2:	80 00 00             	addb   $0x0,(%rax)
+  804cc5:	00 00                	add    %al,(%rax)
+  804cc7:	00 41 0b             	add    %al,0xb(%rcx)
+  804cca:	80 00 00             	addb   $0x0,(%rax)
+  804ccd:	00 00                	add    %al,(%rax)
+  804ccf:	00 41 0b             	add    %al,0xb(%rcx)
+  804cd2:	80 00 00             	addb   $0x0,(%rax)
+  804cd5:	00 00                	add    %al,(%rax)
+  804cd7:	00 41 0b             	add    %al,0xb(%rcx)
+  804cda:	80 00 00             	addb   $0x0,(%rax)
+  804cdd:	00 00                	add    %al,(%rax)
+  804cdf:	00 41 0b             	add    %al,0xb(%rcx)
+  804ce2:	80 00 00             	addb   $0x0,(%rax)
+  804ce5:	00 00                	add    %al,(%rax)
+  804ce7:	00 64 0a 80          	add    %ah,-0x80(%rdx,%rcx,1)
+  804ceb:	00 00                	add    %al,(%rax)
+  804ced:	00 00                	add    %al,(%rax)
+  804cef:	00 41 0b             	add    %al,0xb(%rcx)
+  804cf2:	80 00 00             	addb   $0x0,(%rax)
+  804cf5:	00 00                	add    %al,(%rax)
+  804cf7:	00 41 0b             	add    %al,0xb(%rcx)
+  804cfa:	80 00 00             	addb   $0x0,(%rax)
+  804cfd:	00 00                	add    %al,(%rax)
+  804cff:	00 41 0b             	add    %al,0xb(%rcx)
+  804d02:	80 00 00             	addb   $0x0,(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 41 0b             	add    %al,0xb(%rcx)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d12:	80 00 00             	addb   $0x0,(%rax)
+  804d15:	00 00                	add    %al,(%rax)
+  804d17:	00 41 0b             	add    %al,0xb(%rcx)
+  804d1a:	80 00 00             	addb   $0x0,(%rax)
+  804d1d:	00 00                	add    %al,(%rax)
+  804d1f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 41 0b             	add    %al,0xb(%rcx)
+  804d2a:	80 00 00             	addb   $0x0,(%rax)
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d32:	80 00 00             	addb   $0x0,(%rax)
+  804d35:	00 00                	add    %al,(%rax)
+  804d37:	00 41 0b             	add    %al,0xb(%rcx)
+  804d3a:	80 00 00             	addb   $0x0,(%rax)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 b0 05 80 00 00    	add    %dh,0x8005(%rax)
+  804d45:	00 00                	add    %al,(%rax)
+  804d47:	00 7f 07             	add    %bh,0x7(%rdi)
+  804d4a:	80 00 00             	addb   $0x0,(%rax)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d52:	80 00 00             	addb   $0x0,(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 41 0b             	add    %al,0xb(%rcx)
+  804d5a:	80 00 00             	addb   $0x0,(%rax)
+  804d5d:	00 00                	add    %al,(%rax)
+  804d5f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d62:	80 00 00             	addb   $0x0,(%rax)
+  804d65:	00 00                	add    %al,(%rax)
+  804d67:	00 41 0b             	add    %al,0xb(%rcx)
+  804d6a:	80 00 00             	addb   $0x0,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 df                	add    %bl,%bh
+  804d71:	05 80 00 00 00       	add    $0x80,%eax
+  804d76:	00 00                	add    %al,(%rax)
+  804d78:	41 0b 80 00 00 00 00 	or     0x0(%r8),%eax
+  804d7f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d82:	80 00 00             	addb   $0x0,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 a5 05 80 00 00    	add    %ah,0x8005(%rbp)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 41 0b             	add    %al,0xb(%rcx)
+  804d92:	80 00 00             	addb   $0x0,(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 41 0b             	add    %al,0xb(%rcx)
+  804d9a:	80 00 00             	addb   $0x0,(%rax)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 27                	add    %ah,(%rdi)
+  804da1:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804da7:	00 f1                	add    %dh,%cl
+  804da9:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804daf:	00 41 0b             	add    %al,0xb(%rcx)
+  804db2:	80 00 00             	addb   $0x0,(%rax)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 41 0b             	add    %al,0xb(%rcx)
+  804dba:	80 00 00             	addb   $0x0,(%rax)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 76 06             	add    %dh,0x6(%rsi)
+  804dc2:	80 00 00             	addb   $0x0,(%rax)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 41 0b             	add    %al,0xb(%rcx)
+  804dca:	80 00 00             	addb   $0x0,(%rax)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 53 08             	add    %dl,0x8(%rbx)
+  804dd2:	80 00 00             	addb   $0x0,(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 41 0b             	add    %al,0xb(%rcx)
+  804dda:	80 00 00             	addb   $0x0,(%rax)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 41 0b             	add    %al,0xb(%rcx)
+  804de2:	80 00 00             	addb   $0x0,(%rax)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 64 0a 80          	add    %ah,-0x80(%rdx,%rcx,1)
+  804deb:	00 00                	add    %al,(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 41 0b             	add    %al,0xb(%rcx)
+  804df2:	80 00 00             	addb   $0x0,(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 09                	add    %cl,(%rcx)
+  804df9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804e00 <error_string>:
+	...
+  804e08:	a2 49 80 00 00 00 00 00 b4 49 80 00 00 00 00 00     .I.......I......
+  804e18:	c4 49 80 00 00 00 00 00 d6 49 80 00 00 00 00 00     .I.......I......
+  804e28:	e4 49 80 00 00 00 00 00 f8 49 80 00 00 00 00 00     .I.......I......
+  804e38:	0d 4a 80 00 00 00 00 00 20 4a 80 00 00 00 00 00     .J...... J......
+  804e48:	32 4a 80 00 00 00 00 00 46 4a 80 00 00 00 00 00     2J......FJ......
+  804e58:	56 4a 80 00 00 00 00 00 69 4a 80 00 00 00 00 00     VJ......iJ......
+  804e68:	80 4a 80 00 00 00 00 00 96 4a 80 00 00 00 00 00     .J.......J......
+  804e78:	ae 4a 80 00 00 00 00 00 c6 4a 80 00 00 00 00 00     .J.......J......
+  804e88:	d3 4a 80 00 00 00 00 00 b8 4e 80 00 00 00 00 00     .J.......N......
+  804e98:	e7 4a 80 00 00 00 00 00 ff 4a 80 00 00 00 00 00     .J.......J......
+  804ea8:	09 4b 80 00 00 00 00 00 13 4b 80 00 00 00 00 00     .K.......K......
+  804eb8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804ec8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804ed8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804ee8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804ef8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804f08:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804f18:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804f28:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804f38:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804f48:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  804f58:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804f68:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804f78:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804f88:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804f98:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804fa8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804fb8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804fc8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fd8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804fe0 <devtab>:
+  804fe0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804ff0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805000:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805010:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805020:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805030:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805040:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805050:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805060:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805070:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805080:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  805090:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  8050a0:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8050b0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8050c0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8050d0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8050e0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8050f0:	61 6c 6c 69 7a 65 64 00 66 2e 0f 1f 84 00 00 00     allized.f.......
+  805100:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805110:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805120:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805130:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805140:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805150:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805160:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805170:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805180:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805190:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805200:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805210:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805220:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805230:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805240:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805250:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805260:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805270:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805280:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805290:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805300:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805310:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805320:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805330:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805340:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805350:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805360:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805370:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805380:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805390:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805400:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805410:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805420:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805430:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805440:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805450:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805460:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805470:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805480:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805490:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805500:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805510:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805520:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805530:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805540:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805550:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805560:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805570:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805580:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805590:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805600:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805610:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805620:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805630:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805640:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805650:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805660:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805670:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805680:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805690:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805700:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805710:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805720:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805730:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805740:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805750:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805760:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805770:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805780:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805790:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805800:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805810:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805820:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805830:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805840:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805850:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805860:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805870:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805880:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805890:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805900:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805910:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805920:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805930:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805940:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805950:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805960:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805970:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805980:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805990:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805aa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ab0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ac0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ad0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ae0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805af0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ba0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805be0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ca0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ce0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805da0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805db0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805de0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805df0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ea0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805eb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ec0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ed0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ee0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ef0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fa0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fe0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ff0:	0f 1f 84 00 00 00 00 00 0f 1f 84 00 00 00 00 00     ................
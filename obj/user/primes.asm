@@ -0,0 +1,8622 @@
+
+obj/user/primes:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 68 01 00 00       	call   80018b <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(void) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+    int i, id, p;
+    envid_t envid;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    p = ipc_recv(&envid, 0, 0, 0);
+  800036:	49 bf 76 18 80 00 00 	movabs $0x801876,%r15
+  80003d:	00 00 00 
+    cprintf("%d ", p);
+  800040:	49 be b1 03 80 00 00 	movabs $0x8003b1,%r14
+  800047:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((id = fork()) < 0)
+  80004a:	49 bd 68 16 80 00 00 	movabs $0x801668,%r13
+  800051:	00 00 00 
+    p = ipc_recv(&envid, 0, 0, 0);
+  800054:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800059:	ba 00 00 00 00       	mov    $0x0,%edx
+  80005e:	be 00 00 00 00       	mov    $0x0,%esi
+  800063:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  800067:	41 ff d7             	call   *%r15
+  80006a:	89 c3                	mov    %eax,%ebx
+    cprintf("%d ", p);
+  80006c:	89 c6                	mov    %eax,%esi
+  80006e:	48 bf 08 49 80 00 00 	movabs $0x804908,%rdi
+  800075:	00 00 00 
+  800078:	b8 00 00 00 00       	mov    $0x0,%eax
+  80007d:	41 ff d6             	call   *%r14
+    if ((id = fork()) < 0)
+  800080:	41 ff d5             	call   *%r13
+  800083:	41 89 c4             	mov    %eax,%r12d
+  800086:	85 c0                	test   %eax,%eax
+  800088:	78 4d                	js     8000d7 <primeproc+0xb2>
+        panic("fork: %i", id);
+    if (id == 0)
+  80008a:	74 c8                	je     800054 <primeproc+0x2f>
+        goto top;
+
+    /* Filter out multiples of our prime */
+    while (1) {
+        i = ipc_recv(&envid, 0, 0, 0);
+  80008c:	49 bd 76 18 80 00 00 	movabs $0x801876,%r13
+  800093:	00 00 00 
+        if (i % p)
+            ipc_send(id, i, 0, 0, 0);
+  800096:	49 be 9a 18 80 00 00 	movabs $0x80189a,%r14
+  80009d:	00 00 00 
+        i = ipc_recv(&envid, 0, 0, 0);
+  8000a0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8000af:	48 8d 7d cc          	lea    -0x34(%rbp),%rdi
+  8000b3:	41 ff d5             	call   *%r13
+  8000b6:	89 c6                	mov    %eax,%esi
+        if (i % p)
+  8000b8:	99                   	cltd
+  8000b9:	f7 fb                	idiv   %ebx
+  8000bb:	85 d2                	test   %edx,%edx
+  8000bd:	74 e1                	je     8000a0 <primeproc+0x7b>
+            ipc_send(id, i, 0, 0, 0);
+  8000bf:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c5:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8000ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000cf:	44 89 e7             	mov    %r12d,%edi
+  8000d2:	41 ff d6             	call   *%r14
+  8000d5:	eb c9                	jmp    8000a0 <primeproc+0x7b>
+        panic("fork: %i", id);
+  8000d7:	89 c1                	mov    %eax,%ecx
+  8000d9:	48 ba 0c 49 80 00 00 	movabs $0x80490c,%rdx
+  8000e0:	00 00 00 
+  8000e3:	be 19 00 00 00       	mov    $0x19,%esi
+  8000e8:	48 bf 15 49 80 00 00 	movabs $0x804915,%rdi
+  8000ef:	00 00 00 
+  8000f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000f7:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  8000fe:	00 00 00 
+  800101:	41 ff d0             	call   *%r8
+
+0000000000800104 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800104:	55                   	push   %rbp
+  800105:	48 89 e5             	mov    %rsp,%rbp
+  800108:	41 55                	push   %r13
+  80010a:	41 54                	push   %r12
+  80010c:	53                   	push   %rbx
+  80010d:	48 83 ec 08          	sub    $0x8,%rsp
+    int id;
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  800111:	48 b8 68 16 80 00 00 	movabs $0x801668,%rax
+  800118:	00 00 00 
+  80011b:	ff d0                	call   *%rax
+  80011d:	41 89 c4             	mov    %eax,%r12d
+  800120:	85 c0                	test   %eax,%eax
+  800122:	78 2e                	js     800152 <umain+0x4e>
+        panic("fork: %i", id);
+    if (id == 0)
+        primeproc();
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+  800124:	bb 02 00 00 00       	mov    $0x2,%ebx
+        ipc_send(id, i, 0, 0, 0);
+  800129:	49 bd 9a 18 80 00 00 	movabs $0x80189a,%r13
+  800130:	00 00 00 
+    if (id == 0)
+  800133:	74 4a                	je     80017f <umain+0x7b>
+        ipc_send(id, i, 0, 0, 0);
+  800135:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80013b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  800140:	ba 00 00 00 00       	mov    $0x0,%edx
+  800145:	89 de                	mov    %ebx,%esi
+  800147:	44 89 e7             	mov    %r12d,%edi
+  80014a:	41 ff d5             	call   *%r13
+    for (int i = 2;; i++)
+  80014d:	83 c3 01             	add    $0x1,%ebx
+  800150:	eb e3                	jmp    800135 <umain+0x31>
+        panic("fork: %i", id);
+  800152:	89 c1                	mov    %eax,%ecx
+  800154:	48 ba 0c 49 80 00 00 	movabs $0x80490c,%rdx
+  80015b:	00 00 00 
+  80015e:	be 2b 00 00 00       	mov    $0x2b,%esi
+  800163:	48 bf 15 49 80 00 00 	movabs $0x804915,%rdi
+  80016a:	00 00 00 
+  80016d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800172:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  800179:	00 00 00 
+  80017c:	41 ff d0             	call   *%r8
+        primeproc();
+  80017f:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800186:	00 00 00 
+  800189:	ff d0                	call   *%rax
+
+000000000080018b <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  80018b:	55                   	push   %rbp
+  80018c:	48 89 e5             	mov    %rsp,%rbp
+  80018f:	41 56                	push   %r14
+  800191:	41 55                	push   %r13
+  800193:	41 54                	push   %r12
+  800195:	53                   	push   %rbx
+  800196:	41 89 fd             	mov    %edi,%r13d
+  800199:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80019c:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8001a3:	00 00 00 
+  8001a6:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8001ad:	00 00 00 
+  8001b0:	48 39 c2             	cmp    %rax,%rdx
+  8001b3:	73 17                	jae    8001cc <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b5:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b8:	49 89 c4             	mov    %rax,%r12
+  8001bb:	48 83 c3 08          	add    $0x8,%rbx
+  8001bf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c4:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c7:	4c 39 e3             	cmp    %r12,%rbx
+  8001ca:	72 ef                	jb     8001bb <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001cc:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  8001d3:	00 00 00 
+  8001d6:	ff d0                	call   *%rax
+  8001d8:	89 c2                	mov    %eax,%edx
+  8001da:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001e0:	48 89 d0             	mov    %rdx,%rax
+  8001e3:	48 c1 e0 04          	shl    $0x4,%rax
+  8001e7:	48 29 d0             	sub    %rdx,%rax
+  8001ea:	48 c1 e0 05          	shl    $0x5,%rax
+  8001ee:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f5:	00 00 00 
+  8001f8:	48 01 d0             	add    %rdx,%rax
+  8001fb:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  800202:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800205:	45 85 ed             	test   %r13d,%r13d
+  800208:	7e 0d                	jle    800217 <libmain+0x8c>
+  80020a:	49 8b 06             	mov    (%r14),%rax
+  80020d:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800214:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800217:	4c 89 f6             	mov    %r14,%rsi
+  80021a:	44 89 ef             	mov    %r13d,%edi
+  80021d:	48 b8 04 01 80 00 00 	movabs $0x800104,%rax
+  800224:	00 00 00 
+  800227:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800229:	48 b8 3e 02 80 00 00 	movabs $0x80023e,%rax
+  800230:	00 00 00 
+  800233:	ff d0                	call   *%rax
+#endif
+}
+  800235:	5b                   	pop    %rbx
+  800236:	41 5c                	pop    %r12
+  800238:	41 5d                	pop    %r13
+  80023a:	41 5e                	pop    %r14
+  80023c:	5d                   	pop    %rbp
+  80023d:	c3                   	ret
+
+000000000080023e <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80023e:	55                   	push   %rbp
+  80023f:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800242:	48 b8 75 1b 80 00 00 	movabs $0x801b75,%rax
+  800249:	00 00 00 
+  80024c:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80024e:	bf 00 00 00 00       	mov    $0x0,%edi
+  800253:	48 b8 45 11 80 00 00 	movabs $0x801145,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+}
+  80025f:	5d                   	pop    %rbp
+  800260:	c3                   	ret
+
+0000000000800261 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800261:	55                   	push   %rbp
+  800262:	48 89 e5             	mov    %rsp,%rbp
+  800265:	41 56                	push   %r14
+  800267:	41 55                	push   %r13
+  800269:	41 54                	push   %r12
+  80026b:	53                   	push   %rbx
+  80026c:	48 83 ec 50          	sub    $0x50,%rsp
+  800270:	49 89 fc             	mov    %rdi,%r12
+  800273:	41 89 f5             	mov    %esi,%r13d
+  800276:	48 89 d3             	mov    %rdx,%rbx
+  800279:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80027d:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800281:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800285:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80028c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800290:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800294:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800298:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80029c:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  8002a3:	00 00 00 
+  8002a6:	4c 8b 30             	mov    (%rax),%r14
+  8002a9:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  8002b0:	00 00 00 
+  8002b3:	ff d0                	call   *%rax
+  8002b5:	89 c6                	mov    %eax,%esi
+  8002b7:	45 89 e8             	mov    %r13d,%r8d
+  8002ba:	4c 89 e1             	mov    %r12,%rcx
+  8002bd:	4c 89 f2             	mov    %r14,%rdx
+  8002c0:	48 bf 30 49 80 00 00 	movabs $0x804930,%rdi
+  8002c7:	00 00 00 
+  8002ca:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002cf:	49 bc b1 03 80 00 00 	movabs $0x8003b1,%r12
+  8002d6:	00 00 00 
+  8002d9:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8002dc:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8002e0:	48 89 df             	mov    %rbx,%rdi
+  8002e3:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  8002ea:	00 00 00 
+  8002ed:	ff d0                	call   *%rax
+    cprintf("\n");
+  8002ef:	48 bf 8b 4f 80 00 00 	movabs $0x804f8b,%rdi
+  8002f6:	00 00 00 
+  8002f9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002fe:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800301:	cc                   	int3
+  800302:	eb fd                	jmp    800301 <_panic+0xa0>
+
+0000000000800304 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800304:	55                   	push   %rbp
+  800305:	48 89 e5             	mov    %rsp,%rbp
+  800308:	53                   	push   %rbx
+  800309:	48 83 ec 08          	sub    $0x8,%rsp
+  80030d:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800310:	8b 06                	mov    (%rsi),%eax
+  800312:	8d 50 01             	lea    0x1(%rax),%edx
+  800315:	89 16                	mov    %edx,(%rsi)
+  800317:	48 98                	cltq
+  800319:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  80031e:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800324:	74 0a                	je     800330 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800326:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  80032a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80032e:	c9                   	leave
+  80032f:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800330:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800334:	be ff 00 00 00       	mov    $0xff,%esi
+  800339:	48 b8 fd 10 80 00 00 	movabs $0x8010fd,%rax
+  800340:	00 00 00 
+  800343:	ff d0                	call   *%rax
+        state->offset = 0;
+  800345:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  80034b:	eb d9                	jmp    800326 <putch+0x22>
+
+000000000080034d <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80034d:	55                   	push   %rbp
+  80034e:	48 89 e5             	mov    %rsp,%rbp
+  800351:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800358:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  80035b:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800362:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800367:	b8 00 00 00 00       	mov    $0x0,%eax
+  80036c:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80036f:	48 89 f1             	mov    %rsi,%rcx
+  800372:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800379:	48 bf 04 03 80 00 00 	movabs $0x800304,%rdi
+  800380:	00 00 00 
+  800383:	48 b8 01 05 80 00 00 	movabs $0x800501,%rax
+  80038a:	00 00 00 
+  80038d:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80038f:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800396:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80039d:	48 b8 fd 10 80 00 00 	movabs $0x8010fd,%rax
+  8003a4:	00 00 00 
+  8003a7:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  8003a9:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  8003af:	c9                   	leave
+  8003b0:	c3                   	ret
+
+00000000008003b1 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  8003b1:	55                   	push   %rbp
+  8003b2:	48 89 e5             	mov    %rsp,%rbp
+  8003b5:	48 83 ec 50          	sub    $0x50,%rsp
+  8003b9:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8003bd:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8003c1:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8003c5:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8003c9:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  8003cd:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8003d4:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8003d8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8003dc:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8003e0:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8003e4:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8003e8:	48 b8 4d 03 80 00 00 	movabs $0x80034d,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8003f4:	c9                   	leave
+  8003f5:	c3                   	ret
+
+00000000008003f6 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8003f6:	55                   	push   %rbp
+  8003f7:	48 89 e5             	mov    %rsp,%rbp
+  8003fa:	41 57                	push   %r15
+  8003fc:	41 56                	push   %r14
+  8003fe:	41 55                	push   %r13
+  800400:	41 54                	push   %r12
+  800402:	53                   	push   %rbx
+  800403:	48 83 ec 18          	sub    $0x18,%rsp
+  800407:	49 89 fc             	mov    %rdi,%r12
+  80040a:	49 89 f5             	mov    %rsi,%r13
+  80040d:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800411:	8b 45 10             	mov    0x10(%rbp),%eax
+  800414:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800417:	41 89 cf             	mov    %ecx,%r15d
+  80041a:	4c 39 fa             	cmp    %r15,%rdx
+  80041d:	73 5b                	jae    80047a <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  80041f:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800423:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800427:	85 db                	test   %ebx,%ebx
+  800429:	7e 0e                	jle    800439 <print_num+0x43>
+            putch(padc, put_arg);
+  80042b:	4c 89 ee             	mov    %r13,%rsi
+  80042e:	44 89 f7             	mov    %r14d,%edi
+  800431:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800434:	83 eb 01             	sub    $0x1,%ebx
+  800437:	75 f2                	jne    80042b <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800439:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80043d:	48 b9 64 49 80 00 00 	movabs $0x804964,%rcx
+  800444:	00 00 00 
+  800447:	48 b8 53 49 80 00 00 	movabs $0x804953,%rax
+  80044e:	00 00 00 
+  800451:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800455:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800459:	ba 00 00 00 00       	mov    $0x0,%edx
+  80045e:	49 f7 f7             	div    %r15
+  800461:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800465:	4c 89 ee             	mov    %r13,%rsi
+  800468:	41 ff d4             	call   *%r12
+}
+  80046b:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80046f:	5b                   	pop    %rbx
+  800470:	41 5c                	pop    %r12
+  800472:	41 5d                	pop    %r13
+  800474:	41 5e                	pop    %r14
+  800476:	41 5f                	pop    %r15
+  800478:	5d                   	pop    %rbp
+  800479:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  80047a:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80047e:	ba 00 00 00 00       	mov    $0x0,%edx
+  800483:	49 f7 f7             	div    %r15
+  800486:	48 83 ec 08          	sub    $0x8,%rsp
+  80048a:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80048e:	52                   	push   %rdx
+  80048f:	45 0f be c9          	movsbl %r9b,%r9d
+  800493:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800497:	48 89 c2             	mov    %rax,%rdx
+  80049a:	48 b8 f6 03 80 00 00 	movabs $0x8003f6,%rax
+  8004a1:	00 00 00 
+  8004a4:	ff d0                	call   *%rax
+  8004a6:	48 83 c4 10          	add    $0x10,%rsp
+  8004aa:	eb 8d                	jmp    800439 <print_num+0x43>
+
+00000000008004ac <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  8004ac:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  8004b0:	48 8b 06             	mov    (%rsi),%rax
+  8004b3:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  8004b7:	73 0a                	jae    8004c3 <sprintputch+0x17>
+        *state->start++ = ch;
+  8004b9:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  8004bd:	48 89 16             	mov    %rdx,(%rsi)
+  8004c0:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  8004c3:	c3                   	ret
+
+00000000008004c4 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  8004c4:	55                   	push   %rbp
+  8004c5:	48 89 e5             	mov    %rsp,%rbp
+  8004c8:	48 83 ec 50          	sub    $0x50,%rsp
+  8004cc:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8004d0:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8004d4:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8004d8:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8004df:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8004e3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8004e7:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8004eb:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8004ef:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8004f3:	48 b8 01 05 80 00 00 	movabs $0x800501,%rax
+  8004fa:	00 00 00 
+  8004fd:	ff d0                	call   *%rax
+}
+  8004ff:	c9                   	leave
+  800500:	c3                   	ret
+
+0000000000800501 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800501:	55                   	push   %rbp
+  800502:	48 89 e5             	mov    %rsp,%rbp
+  800505:	41 57                	push   %r15
+  800507:	41 56                	push   %r14
+  800509:	41 55                	push   %r13
+  80050b:	41 54                	push   %r12
+  80050d:	53                   	push   %rbx
+  80050e:	48 83 ec 38          	sub    $0x38,%rsp
+  800512:	49 89 fe             	mov    %rdi,%r14
+  800515:	49 89 f5             	mov    %rsi,%r13
+  800518:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  80051b:	48 8b 01             	mov    (%rcx),%rax
+  80051e:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800522:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800526:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80052a:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  80052e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800532:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800536:	0f b6 3b             	movzbl (%rbx),%edi
+  800539:	40 80 ff 25          	cmp    $0x25,%dil
+  80053d:	74 18                	je     800557 <vprintfmt+0x56>
+            if (!ch) return;
+  80053f:	40 84 ff             	test   %dil,%dil
+  800542:	0f 84 b1 06 00 00    	je     800bf9 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800548:	40 0f b6 ff          	movzbl %dil,%edi
+  80054c:	4c 89 ee             	mov    %r13,%rsi
+  80054f:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800552:	4c 89 e3             	mov    %r12,%rbx
+  800555:	eb db                	jmp    800532 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800557:	be 00 00 00 00       	mov    $0x0,%esi
+  80055c:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800560:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800565:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  80056b:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800572:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800576:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  80057b:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800580:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800583:	83 e8 23             	sub    $0x23,%eax
+  800586:	3c 57                	cmp    $0x57,%al
+  800588:	0f 87 51 06 00 00    	ja     800bdf <vprintfmt+0x6de>
+  80058e:	0f b6 c0             	movzbl %al,%eax
+  800591:	48 b9 20 4b 80 00 00 	movabs $0x804b20,%rcx
+  800598:	00 00 00 
+  80059b:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80059e:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8005a1:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8005a5:	eb cf                	jmp    800576 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  8005a7:	49 89 dc             	mov    %rbx,%r12
+  8005aa:	be 01 00 00 00       	mov    $0x1,%esi
+  8005af:	eb c5                	jmp    800576 <vprintfmt+0x75>
+            padc = ch;
+  8005b1:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  8005b5:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8005b8:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005bb:	eb b9                	jmp    800576 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005bd:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005c0:	83 f8 2f             	cmp    $0x2f,%eax
+  8005c3:	77 24                	ja     8005e9 <vprintfmt+0xe8>
+  8005c5:	89 c1                	mov    %eax,%ecx
+  8005c7:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  8005cb:	83 c0 08             	add    $0x8,%eax
+  8005ce:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005d1:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8005d4:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8005d7:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8005db:	79 99                	jns    800576 <vprintfmt+0x75>
+                width = precision;
+  8005dd:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8005e1:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8005e7:	eb 8d                	jmp    800576 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8005e9:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8005ed:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8005f1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005f5:	eb da                	jmp    8005d1 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8005f7:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8005fc:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800600:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800606:	3c 39                	cmp    $0x39,%al
+  800608:	77 1c                	ja     800626 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  80060a:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  80060e:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800612:	0f b6 c0             	movzbl %al,%eax
+  800615:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80061a:	0f b6 03             	movzbl (%rbx),%eax
+  80061d:	3c 39                	cmp    $0x39,%al
+  80061f:	76 e9                	jbe    80060a <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800621:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800624:	eb b1                	jmp    8005d7 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800626:	49 89 dc             	mov    %rbx,%r12
+  800629:	eb ac                	jmp    8005d7 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  80062b:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  80062e:	85 c9                	test   %ecx,%ecx
+  800630:	b8 00 00 00 00       	mov    $0x0,%eax
+  800635:	0f 49 c1             	cmovns %ecx,%eax
+  800638:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  80063b:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80063e:	e9 33 ff ff ff       	jmp    800576 <vprintfmt+0x75>
+            lflag++;
+  800643:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800646:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800649:	e9 28 ff ff ff       	jmp    800576 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80064e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800651:	83 f8 2f             	cmp    $0x2f,%eax
+  800654:	77 19                	ja     80066f <vprintfmt+0x16e>
+  800656:	89 c2                	mov    %eax,%edx
+  800658:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80065c:	83 c0 08             	add    $0x8,%eax
+  80065f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800662:	8b 3a                	mov    (%rdx),%edi
+  800664:	4c 89 ee             	mov    %r13,%rsi
+  800667:	41 ff d6             	call   *%r14
+            break;
+  80066a:	e9 c3 fe ff ff       	jmp    800532 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80066f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800673:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800677:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80067b:	eb e5                	jmp    800662 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80067d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800680:	83 f8 2f             	cmp    $0x2f,%eax
+  800683:	77 5a                	ja     8006df <vprintfmt+0x1de>
+  800685:	89 c2                	mov    %eax,%edx
+  800687:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80068b:	83 c0 08             	add    $0x8,%eax
+  80068e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800691:	8b 02                	mov    (%rdx),%eax
+  800693:	89 c1                	mov    %eax,%ecx
+  800695:	f7 d9                	neg    %ecx
+  800697:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  80069a:	83 f9 16             	cmp    $0x16,%ecx
+  80069d:	7f 4e                	jg     8006ed <vprintfmt+0x1ec>
+  80069f:	48 63 c1             	movslq %ecx,%rax
+  8006a2:	48 ba e0 4d 80 00 00 	movabs $0x804de0,%rdx
+  8006a9:	00 00 00 
+  8006ac:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8006b0:	48 85 c0             	test   %rax,%rax
+  8006b3:	74 38                	je     8006ed <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  8006b5:	48 89 c1             	mov    %rax,%rcx
+  8006b8:	48 ba f9 4f 80 00 00 	movabs $0x804ff9,%rdx
+  8006bf:	00 00 00 
+  8006c2:	4c 89 ee             	mov    %r13,%rsi
+  8006c5:	4c 89 f7             	mov    %r14,%rdi
+  8006c8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8006cd:	49 b8 c4 04 80 00 00 	movabs $0x8004c4,%r8
+  8006d4:	00 00 00 
+  8006d7:	41 ff d0             	call   *%r8
+  8006da:	e9 53 fe ff ff       	jmp    800532 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8006df:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006e7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006eb:	eb a4                	jmp    800691 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8006ed:	48 ba 7c 49 80 00 00 	movabs $0x80497c,%rdx
+  8006f4:	00 00 00 
+  8006f7:	4c 89 ee             	mov    %r13,%rsi
+  8006fa:	4c 89 f7             	mov    %r14,%rdi
+  8006fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  800702:	49 b8 c4 04 80 00 00 	movabs $0x8004c4,%r8
+  800709:	00 00 00 
+  80070c:	41 ff d0             	call   *%r8
+  80070f:	e9 1e fe ff ff       	jmp    800532 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800714:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800717:	83 f8 2f             	cmp    $0x2f,%eax
+  80071a:	77 6c                	ja     800788 <vprintfmt+0x287>
+  80071c:	89 c2                	mov    %eax,%edx
+  80071e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800722:	83 c0 08             	add    $0x8,%eax
+  800725:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800728:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  80072b:	48 85 d2             	test   %rdx,%rdx
+  80072e:	48 b8 75 49 80 00 00 	movabs $0x804975,%rax
+  800735:	00 00 00 
+  800738:	48 0f 45 c2          	cmovne %rdx,%rax
+  80073c:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  800740:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800744:	7e 06                	jle    80074c <vprintfmt+0x24b>
+  800746:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  80074a:	75 4a                	jne    800796 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80074c:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800750:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800754:	0f b6 00             	movzbl (%rax),%eax
+  800757:	84 c0                	test   %al,%al
+  800759:	0f 85 9a 00 00 00    	jne    8007f9 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80075f:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800762:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800766:	85 c0                	test   %eax,%eax
+  800768:	0f 8e c4 fd ff ff    	jle    800532 <vprintfmt+0x31>
+  80076e:	4c 89 ee             	mov    %r13,%rsi
+  800771:	bf 20 00 00 00       	mov    $0x20,%edi
+  800776:	41 ff d6             	call   *%r14
+  800779:	41 83 ec 01          	sub    $0x1,%r12d
+  80077d:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  800781:	75 eb                	jne    80076e <vprintfmt+0x26d>
+  800783:	e9 aa fd ff ff       	jmp    800532 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800788:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80078c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800790:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800794:	eb 92                	jmp    800728 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800796:	49 63 f7             	movslq %r15d,%rsi
+  800799:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80079d:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  8007a4:	00 00 00 
+  8007a7:	ff d0                	call   *%rax
+  8007a9:	48 89 c2             	mov    %rax,%rdx
+  8007ac:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007af:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8007b1:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8007b4:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8007b7:	85 c0                	test   %eax,%eax
+  8007b9:	7e 91                	jle    80074c <vprintfmt+0x24b>
+  8007bb:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8007c0:	4c 89 ee             	mov    %r13,%rsi
+  8007c3:	44 89 e7             	mov    %r12d,%edi
+  8007c6:	41 ff d6             	call   *%r14
+  8007c9:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007cd:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8007d0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8007d3:	75 eb                	jne    8007c0 <vprintfmt+0x2bf>
+  8007d5:	e9 72 ff ff ff       	jmp    80074c <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8007da:	0f b6 f8             	movzbl %al,%edi
+  8007dd:	4c 89 ee             	mov    %r13,%rsi
+  8007e0:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8007e3:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8007e7:	49 83 c4 01          	add    $0x1,%r12
+  8007eb:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8007f1:	84 c0                	test   %al,%al
+  8007f3:	0f 84 66 ff ff ff    	je     80075f <vprintfmt+0x25e>
+  8007f9:	45 85 ff             	test   %r15d,%r15d
+  8007fc:	78 0a                	js     800808 <vprintfmt+0x307>
+  8007fe:	41 83 ef 01          	sub    $0x1,%r15d
+  800802:	0f 88 57 ff ff ff    	js     80075f <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800808:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  80080c:	74 cc                	je     8007da <vprintfmt+0x2d9>
+  80080e:	8d 50 e0             	lea    -0x20(%rax),%edx
+  800811:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800816:	80 fa 5e             	cmp    $0x5e,%dl
+  800819:	77 c2                	ja     8007dd <vprintfmt+0x2dc>
+  80081b:	eb bd                	jmp    8007da <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  80081d:	40 84 f6             	test   %sil,%sil
+  800820:	75 26                	jne    800848 <vprintfmt+0x347>
+    switch (lflag) {
+  800822:	85 d2                	test   %edx,%edx
+  800824:	74 59                	je     80087f <vprintfmt+0x37e>
+  800826:	83 fa 01             	cmp    $0x1,%edx
+  800829:	74 7b                	je     8008a6 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  80082b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80082e:	83 f8 2f             	cmp    $0x2f,%eax
+  800831:	0f 87 96 00 00 00    	ja     8008cd <vprintfmt+0x3cc>
+  800837:	89 c2                	mov    %eax,%edx
+  800839:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80083d:	83 c0 08             	add    $0x8,%eax
+  800840:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800843:	4c 8b 22             	mov    (%rdx),%r12
+  800846:	eb 17                	jmp    80085f <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800848:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084b:	83 f8 2f             	cmp    $0x2f,%eax
+  80084e:	77 21                	ja     800871 <vprintfmt+0x370>
+  800850:	89 c2                	mov    %eax,%edx
+  800852:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800856:	83 c0 08             	add    $0x8,%eax
+  800859:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80085c:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  80085f:	4d 85 e4             	test   %r12,%r12
+  800862:	78 7a                	js     8008de <vprintfmt+0x3dd>
+            num = i;
+  800864:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800867:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  80086c:	e9 50 02 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800871:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800875:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800879:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80087d:	eb dd                	jmp    80085c <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  80087f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800882:	83 f8 2f             	cmp    $0x2f,%eax
+  800885:	77 11                	ja     800898 <vprintfmt+0x397>
+  800887:	89 c2                	mov    %eax,%edx
+  800889:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80088d:	83 c0 08             	add    $0x8,%eax
+  800890:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800893:	4c 63 22             	movslq (%rdx),%r12
+  800896:	eb c7                	jmp    80085f <vprintfmt+0x35e>
+  800898:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80089c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008a4:	eb ed                	jmp    800893 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8008a6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008a9:	83 f8 2f             	cmp    $0x2f,%eax
+  8008ac:	77 11                	ja     8008bf <vprintfmt+0x3be>
+  8008ae:	89 c2                	mov    %eax,%edx
+  8008b0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008b4:	83 c0 08             	add    $0x8,%eax
+  8008b7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008ba:	4c 8b 22             	mov    (%rdx),%r12
+  8008bd:	eb a0                	jmp    80085f <vprintfmt+0x35e>
+  8008bf:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008c3:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008c7:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008cb:	eb ed                	jmp    8008ba <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8008cd:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008d9:	e9 65 ff ff ff       	jmp    800843 <vprintfmt+0x342>
+                putch('-', put_arg);
+  8008de:	4c 89 ee             	mov    %r13,%rsi
+  8008e1:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  8008e6:	41 ff d6             	call   *%r14
+                i = -i;
+  8008e9:	49 f7 dc             	neg    %r12
+  8008ec:	e9 73 ff ff ff       	jmp    800864 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  8008f1:	40 84 f6             	test   %sil,%sil
+  8008f4:	75 32                	jne    800928 <vprintfmt+0x427>
+    switch (lflag) {
+  8008f6:	85 d2                	test   %edx,%edx
+  8008f8:	74 5d                	je     800957 <vprintfmt+0x456>
+  8008fa:	83 fa 01             	cmp    $0x1,%edx
+  8008fd:	0f 84 82 00 00 00    	je     800985 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800903:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800906:	83 f8 2f             	cmp    $0x2f,%eax
+  800909:	0f 87 a5 00 00 00    	ja     8009b4 <vprintfmt+0x4b3>
+  80090f:	89 c2                	mov    %eax,%edx
+  800911:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800915:	83 c0 08             	add    $0x8,%eax
+  800918:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80091b:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80091e:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800923:	e9 99 01 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800928:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80092b:	83 f8 2f             	cmp    $0x2f,%eax
+  80092e:	77 19                	ja     800949 <vprintfmt+0x448>
+  800930:	89 c2                	mov    %eax,%edx
+  800932:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800936:	83 c0 08             	add    $0x8,%eax
+  800939:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80093c:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80093f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800944:	e9 78 01 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+  800949:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80094d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800951:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800955:	eb e5                	jmp    80093c <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800957:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80095a:	83 f8 2f             	cmp    $0x2f,%eax
+  80095d:	77 18                	ja     800977 <vprintfmt+0x476>
+  80095f:	89 c2                	mov    %eax,%edx
+  800961:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800965:	83 c0 08             	add    $0x8,%eax
+  800968:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80096b:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  80096d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800972:	e9 4a 01 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+  800977:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80097b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800983:	eb e6                	jmp    80096b <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800985:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800988:	83 f8 2f             	cmp    $0x2f,%eax
+  80098b:	77 19                	ja     8009a6 <vprintfmt+0x4a5>
+  80098d:	89 c2                	mov    %eax,%edx
+  80098f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800993:	83 c0 08             	add    $0x8,%eax
+  800996:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800999:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  80099c:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8009a1:	e9 1b 01 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+  8009a6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009aa:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009ae:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009b2:	eb e5                	jmp    800999 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8009b4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009b8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009bc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009c0:	e9 56 ff ff ff       	jmp    80091b <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8009c5:	40 84 f6             	test   %sil,%sil
+  8009c8:	75 2e                	jne    8009f8 <vprintfmt+0x4f7>
+    switch (lflag) {
+  8009ca:	85 d2                	test   %edx,%edx
+  8009cc:	74 59                	je     800a27 <vprintfmt+0x526>
+  8009ce:	83 fa 01             	cmp    $0x1,%edx
+  8009d1:	74 7f                	je     800a52 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8009d3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009d6:	83 f8 2f             	cmp    $0x2f,%eax
+  8009d9:	0f 87 9f 00 00 00    	ja     800a7e <vprintfmt+0x57d>
+  8009df:	89 c2                	mov    %eax,%edx
+  8009e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009e5:	83 c0 08             	add    $0x8,%eax
+  8009e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009eb:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009ee:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  8009f3:	e9 c9 00 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8009f8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fb:	83 f8 2f             	cmp    $0x2f,%eax
+  8009fe:	77 19                	ja     800a19 <vprintfmt+0x518>
+  800a00:	89 c2                	mov    %eax,%edx
+  800a02:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a06:	83 c0 08             	add    $0x8,%eax
+  800a09:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a0c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a0f:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800a14:	e9 a8 00 00 00       	jmp    800ac1 <vprintfmt+0x5c0>
+  800a19:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a1d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a21:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a25:	eb e5                	jmp    800a0c <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800a27:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a2a:	83 f8 2f             	cmp    $0x2f,%eax
+  800a2d:	77 15                	ja     800a44 <vprintfmt+0x543>
+  800a2f:	89 c2                	mov    %eax,%edx
+  800a31:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a35:	83 c0 08             	add    $0x8,%eax
+  800a38:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a3b:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800a3d:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800a42:	eb 7d                	jmp    800ac1 <vprintfmt+0x5c0>
+  800a44:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a48:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a50:	eb e9                	jmp    800a3b <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800a52:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a55:	83 f8 2f             	cmp    $0x2f,%eax
+  800a58:	77 16                	ja     800a70 <vprintfmt+0x56f>
+  800a5a:	89 c2                	mov    %eax,%edx
+  800a5c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a60:	83 c0 08             	add    $0x8,%eax
+  800a63:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a66:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800a69:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800a6e:	eb 51                	jmp    800ac1 <vprintfmt+0x5c0>
+  800a70:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a74:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a78:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a7c:	eb e8                	jmp    800a66 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800a7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a8a:	e9 5c ff ff ff       	jmp    8009eb <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800a8f:	4c 89 ee             	mov    %r13,%rsi
+  800a92:	bf 30 00 00 00       	mov    $0x30,%edi
+  800a97:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800a9a:	4c 89 ee             	mov    %r13,%rsi
+  800a9d:	bf 78 00 00 00       	mov    $0x78,%edi
+  800aa2:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800aa5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aa8:	83 f8 2f             	cmp    $0x2f,%eax
+  800aab:	77 47                	ja     800af4 <vprintfmt+0x5f3>
+  800aad:	89 c2                	mov    %eax,%edx
+  800aaf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ab3:	83 c0 08             	add    $0x8,%eax
+  800ab6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ab9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800abc:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800ac1:	48 83 ec 08          	sub    $0x8,%rsp
+  800ac5:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800ac9:	0f 94 c0             	sete   %al
+  800acc:	0f b6 c0             	movzbl %al,%eax
+  800acf:	50                   	push   %rax
+  800ad0:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ad5:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ad9:	4c 89 ee             	mov    %r13,%rsi
+  800adc:	4c 89 f7             	mov    %r14,%rdi
+  800adf:	48 b8 f6 03 80 00 00 	movabs $0x8003f6,%rax
+  800ae6:	00 00 00 
+  800ae9:	ff d0                	call   *%rax
+            break;
+  800aeb:	48 83 c4 10          	add    $0x10,%rsp
+  800aef:	e9 3e fa ff ff       	jmp    800532 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800af4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800af8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800afc:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b00:	eb b7                	jmp    800ab9 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800b02:	40 84 f6             	test   %sil,%sil
+  800b05:	75 2b                	jne    800b32 <vprintfmt+0x631>
+    switch (lflag) {
+  800b07:	85 d2                	test   %edx,%edx
+  800b09:	74 56                	je     800b61 <vprintfmt+0x660>
+  800b0b:	83 fa 01             	cmp    $0x1,%edx
+  800b0e:	74 7f                	je     800b8f <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800b10:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b13:	83 f8 2f             	cmp    $0x2f,%eax
+  800b16:	0f 87 a2 00 00 00    	ja     800bbe <vprintfmt+0x6bd>
+  800b1c:	89 c2                	mov    %eax,%edx
+  800b1e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b22:	83 c0 08             	add    $0x8,%eax
+  800b25:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b28:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b2b:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800b30:	eb 8f                	jmp    800ac1 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800b32:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b35:	83 f8 2f             	cmp    $0x2f,%eax
+  800b38:	77 19                	ja     800b53 <vprintfmt+0x652>
+  800b3a:	89 c2                	mov    %eax,%edx
+  800b3c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b40:	83 c0 08             	add    $0x8,%eax
+  800b43:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b46:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b49:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b4e:	e9 6e ff ff ff       	jmp    800ac1 <vprintfmt+0x5c0>
+  800b53:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b57:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b5b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b5f:	eb e5                	jmp    800b46 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800b61:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b64:	83 f8 2f             	cmp    $0x2f,%eax
+  800b67:	77 18                	ja     800b81 <vprintfmt+0x680>
+  800b69:	89 c2                	mov    %eax,%edx
+  800b6b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b6f:	83 c0 08             	add    $0x8,%eax
+  800b72:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b75:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800b77:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800b7c:	e9 40 ff ff ff       	jmp    800ac1 <vprintfmt+0x5c0>
+  800b81:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b85:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b89:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8d:	eb e6                	jmp    800b75 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800b8f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b92:	83 f8 2f             	cmp    $0x2f,%eax
+  800b95:	77 19                	ja     800bb0 <vprintfmt+0x6af>
+  800b97:	89 c2                	mov    %eax,%edx
+  800b99:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b9d:	83 c0 08             	add    $0x8,%eax
+  800ba0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ba3:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800ba6:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800bab:	e9 11 ff ff ff       	jmp    800ac1 <vprintfmt+0x5c0>
+  800bb0:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bb4:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bb8:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bbc:	eb e5                	jmp    800ba3 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800bbe:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800bc2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bc6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bca:	e9 59 ff ff ff       	jmp    800b28 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800bcf:	4c 89 ee             	mov    %r13,%rsi
+  800bd2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800bd7:	41 ff d6             	call   *%r14
+            break;
+  800bda:	e9 53 f9 ff ff       	jmp    800532 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800bdf:	4c 89 ee             	mov    %r13,%rsi
+  800be2:	bf 25 00 00 00       	mov    $0x25,%edi
+  800be7:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800bea:	48 83 eb 01          	sub    $0x1,%rbx
+  800bee:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800bf2:	75 f6                	jne    800bea <vprintfmt+0x6e9>
+  800bf4:	e9 39 f9 ff ff       	jmp    800532 <vprintfmt+0x31>
+}
+  800bf9:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800bfd:	5b                   	pop    %rbx
+  800bfe:	41 5c                	pop    %r12
+  800c00:	41 5d                	pop    %r13
+  800c02:	41 5e                	pop    %r14
+  800c04:	41 5f                	pop    %r15
+  800c06:	5d                   	pop    %rbp
+  800c07:	c3                   	ret
+
+0000000000800c08 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800c08:	55                   	push   %rbp
+  800c09:	48 89 e5             	mov    %rsp,%rbp
+  800c0c:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800c10:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800c14:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800c19:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800c1d:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800c24:	48 85 ff             	test   %rdi,%rdi
+  800c27:	74 2b                	je     800c54 <vsnprintf+0x4c>
+  800c29:	48 85 f6             	test   %rsi,%rsi
+  800c2c:	74 26                	je     800c54 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800c2e:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800c32:	48 bf ac 04 80 00 00 	movabs $0x8004ac,%rdi
+  800c39:	00 00 00 
+  800c3c:	48 b8 01 05 80 00 00 	movabs $0x800501,%rax
+  800c43:	00 00 00 
+  800c46:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800c48:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800c4c:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800c4f:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800c52:	c9                   	leave
+  800c53:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800c54:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800c59:	eb f7                	jmp    800c52 <vsnprintf+0x4a>
+
+0000000000800c5b <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800c5b:	55                   	push   %rbp
+  800c5c:	48 89 e5             	mov    %rsp,%rbp
+  800c5f:	48 83 ec 50          	sub    $0x50,%rsp
+  800c63:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800c67:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800c6b:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800c6f:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800c76:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800c7a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c7e:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800c82:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800c86:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800c8a:	48 b8 08 0c 80 00 00 	movabs $0x800c08,%rax
+  800c91:	00 00 00 
+  800c94:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800c96:	c9                   	leave
+  800c97:	c3                   	ret
+
+0000000000800c98 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800c98:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800c9b:	74 10                	je     800cad <strlen+0x15>
+    size_t n = 0;
+  800c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800ca2:	48 83 c0 01          	add    $0x1,%rax
+  800ca6:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800caa:	75 f6                	jne    800ca2 <strlen+0xa>
+  800cac:	c3                   	ret
+    size_t n = 0;
+  800cad:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800cb2:	c3                   	ret
+
+0000000000800cb3 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800cb3:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800cb6:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800cbb:	48 85 f6             	test   %rsi,%rsi
+  800cbe:	74 11                	je     800cd1 <strnlen+0x1e>
+  800cc0:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800cc4:	74 0c                	je     800cd2 <strnlen+0x1f>
+  800cc6:	48 83 c2 01          	add    $0x1,%rdx
+  800cca:	48 39 d0             	cmp    %rdx,%rax
+  800ccd:	75 f1                	jne    800cc0 <strnlen+0xd>
+  800ccf:	eb 04                	jmp    800cd5 <strnlen+0x22>
+  800cd1:	c3                   	ret
+  800cd2:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800cd5:	c3                   	ret
+
+0000000000800cd6 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800cd6:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800cd9:	ba 00 00 00 00       	mov    $0x0,%edx
+  800cde:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800ce2:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800ce5:	48 83 c2 01          	add    $0x1,%rdx
+  800ce9:	84 c9                	test   %cl,%cl
+  800ceb:	75 f1                	jne    800cde <strcpy+0x8>
+        ;
+    return res;
+}
+  800ced:	c3                   	ret
+
+0000000000800cee <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800cee:	55                   	push   %rbp
+  800cef:	48 89 e5             	mov    %rsp,%rbp
+  800cf2:	41 54                	push   %r12
+  800cf4:	53                   	push   %rbx
+  800cf5:	48 89 fb             	mov    %rdi,%rbx
+  800cf8:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800cfb:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  800d02:	00 00 00 
+  800d05:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800d07:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800d0b:	4c 89 e6             	mov    %r12,%rsi
+  800d0e:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  800d15:	00 00 00 
+  800d18:	ff d0                	call   *%rax
+    return dst;
+}
+  800d1a:	48 89 d8             	mov    %rbx,%rax
+  800d1d:	5b                   	pop    %rbx
+  800d1e:	41 5c                	pop    %r12
+  800d20:	5d                   	pop    %rbp
+  800d21:	c3                   	ret
+
+0000000000800d22 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800d22:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800d25:	48 85 d2             	test   %rdx,%rdx
+  800d28:	74 1f                	je     800d49 <strncpy+0x27>
+  800d2a:	48 01 fa             	add    %rdi,%rdx
+  800d2d:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800d30:	48 83 c1 01          	add    $0x1,%rcx
+  800d34:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800d38:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800d3c:	41 80 f8 01          	cmp    $0x1,%r8b
+  800d40:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800d44:	48 39 ca             	cmp    %rcx,%rdx
+  800d47:	75 e7                	jne    800d30 <strncpy+0xe>
+    }
+    return ret;
+}
+  800d49:	c3                   	ret
+
+0000000000800d4a <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800d4a:	48 89 f8             	mov    %rdi,%rax
+  800d4d:	48 85 d2             	test   %rdx,%rdx
+  800d50:	74 24                	je     800d76 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800d52:	48 83 ea 01          	sub    $0x1,%rdx
+  800d56:	74 1b                	je     800d73 <strlcpy+0x29>
+  800d58:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800d5c:	0f b6 16             	movzbl (%rsi),%edx
+  800d5f:	84 d2                	test   %dl,%dl
+  800d61:	74 10                	je     800d73 <strlcpy+0x29>
+            *dst++ = *src++;
+  800d63:	48 83 c6 01          	add    $0x1,%rsi
+  800d67:	48 83 c0 01          	add    $0x1,%rax
+  800d6b:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800d6e:	48 39 c8             	cmp    %rcx,%rax
+  800d71:	75 e9                	jne    800d5c <strlcpy+0x12>
+        *dst = '\0';
+  800d73:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800d76:	48 29 f8             	sub    %rdi,%rax
+}
+  800d79:	c3                   	ret
+
+0000000000800d7a <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800d7a:	0f b6 07             	movzbl (%rdi),%eax
+  800d7d:	84 c0                	test   %al,%al
+  800d7f:	74 13                	je     800d94 <strcmp+0x1a>
+  800d81:	38 06                	cmp    %al,(%rsi)
+  800d83:	75 0f                	jne    800d94 <strcmp+0x1a>
+  800d85:	48 83 c7 01          	add    $0x1,%rdi
+  800d89:	48 83 c6 01          	add    $0x1,%rsi
+  800d8d:	0f b6 07             	movzbl (%rdi),%eax
+  800d90:	84 c0                	test   %al,%al
+  800d92:	75 ed                	jne    800d81 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d94:	0f b6 c0             	movzbl %al,%eax
+  800d97:	0f b6 16             	movzbl (%rsi),%edx
+  800d9a:	29 d0                	sub    %edx,%eax
+}
+  800d9c:	c3                   	ret
+
+0000000000800d9d <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800d9d:	48 85 d2             	test   %rdx,%rdx
+  800da0:	74 1f                	je     800dc1 <strncmp+0x24>
+  800da2:	0f b6 07             	movzbl (%rdi),%eax
+  800da5:	84 c0                	test   %al,%al
+  800da7:	74 1e                	je     800dc7 <strncmp+0x2a>
+  800da9:	3a 06                	cmp    (%rsi),%al
+  800dab:	75 1a                	jne    800dc7 <strncmp+0x2a>
+  800dad:	48 83 c7 01          	add    $0x1,%rdi
+  800db1:	48 83 c6 01          	add    $0x1,%rsi
+  800db5:	48 83 ea 01          	sub    $0x1,%rdx
+  800db9:	75 e7                	jne    800da2 <strncmp+0x5>
+
+    if (!n) return 0;
+  800dbb:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc0:	c3                   	ret
+  800dc1:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dc6:	c3                   	ret
+  800dc7:	48 85 d2             	test   %rdx,%rdx
+  800dca:	74 09                	je     800dd5 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800dcc:	0f b6 07             	movzbl (%rdi),%eax
+  800dcf:	0f b6 16             	movzbl (%rsi),%edx
+  800dd2:	29 d0                	sub    %edx,%eax
+  800dd4:	c3                   	ret
+    if (!n) return 0;
+  800dd5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800dda:	c3                   	ret
+
+0000000000800ddb <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800ddb:	0f b6 17             	movzbl (%rdi),%edx
+  800dde:	84 d2                	test   %dl,%dl
+  800de0:	74 18                	je     800dfa <strchr+0x1f>
+        if (*str == c) {
+  800de2:	0f be d2             	movsbl %dl,%edx
+  800de5:	39 f2                	cmp    %esi,%edx
+  800de7:	74 17                	je     800e00 <strchr+0x25>
+    for (; *str; str++) {
+  800de9:	48 83 c7 01          	add    $0x1,%rdi
+  800ded:	0f b6 17             	movzbl (%rdi),%edx
+  800df0:	84 d2                	test   %dl,%dl
+  800df2:	75 ee                	jne    800de2 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800df4:	b8 00 00 00 00       	mov    $0x0,%eax
+  800df9:	c3                   	ret
+  800dfa:	b8 00 00 00 00       	mov    $0x0,%eax
+  800dff:	c3                   	ret
+  800e00:	48 89 f8             	mov    %rdi,%rax
+}
+  800e03:	c3                   	ret
+
+0000000000800e04 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800e04:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800e07:	0f b6 17             	movzbl (%rdi),%edx
+  800e0a:	84 d2                	test   %dl,%dl
+  800e0c:	74 13                	je     800e21 <strfind+0x1d>
+  800e0e:	0f be d2             	movsbl %dl,%edx
+  800e11:	39 f2                	cmp    %esi,%edx
+  800e13:	74 0b                	je     800e20 <strfind+0x1c>
+  800e15:	48 83 c0 01          	add    $0x1,%rax
+  800e19:	0f b6 10             	movzbl (%rax),%edx
+  800e1c:	84 d2                	test   %dl,%dl
+  800e1e:	75 ee                	jne    800e0e <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800e20:	c3                   	ret
+  800e21:	c3                   	ret
+
+0000000000800e22 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800e22:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800e25:	48 89 f8             	mov    %rdi,%rax
+  800e28:	48 f7 d8             	neg    %rax
+  800e2b:	83 e0 07             	and    $0x7,%eax
+  800e2e:	49 89 d1             	mov    %rdx,%r9
+  800e31:	49 29 c1             	sub    %rax,%r9
+  800e34:	78 36                	js     800e6c <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800e36:	40 0f b6 c6          	movzbl %sil,%eax
+  800e3a:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800e41:	01 01 01 
+  800e44:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800e48:	40 f6 c7 07          	test   $0x7,%dil
+  800e4c:	75 38                	jne    800e86 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800e4e:	4c 89 c9             	mov    %r9,%rcx
+  800e51:	48 c1 f9 03          	sar    $0x3,%rcx
+  800e55:	74 0c                	je     800e63 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800e57:	fc                   	cld
+  800e58:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800e5b:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800e5f:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800e63:	4d 85 c9             	test   %r9,%r9
+  800e66:	75 45                	jne    800ead <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800e68:	4c 89 c0             	mov    %r8,%rax
+  800e6b:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800e6c:	48 85 d2             	test   %rdx,%rdx
+  800e6f:	74 f7                	je     800e68 <memset+0x46>
+  800e71:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800e74:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800e77:	48 83 c0 01          	add    $0x1,%rax
+  800e7b:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800e7f:	48 39 c2             	cmp    %rax,%rdx
+  800e82:	75 f3                	jne    800e77 <memset+0x55>
+  800e84:	eb e2                	jmp    800e68 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800e86:	40 f6 c7 01          	test   $0x1,%dil
+  800e8a:	74 06                	je     800e92 <memset+0x70>
+  800e8c:	88 07                	mov    %al,(%rdi)
+  800e8e:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e92:	40 f6 c7 02          	test   $0x2,%dil
+  800e96:	74 07                	je     800e9f <memset+0x7d>
+  800e98:	66 89 07             	mov    %ax,(%rdi)
+  800e9b:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e9f:	40 f6 c7 04          	test   $0x4,%dil
+  800ea3:	74 a9                	je     800e4e <memset+0x2c>
+  800ea5:	89 07                	mov    %eax,(%rdi)
+  800ea7:	48 83 c7 04          	add    $0x4,%rdi
+  800eab:	eb a1                	jmp    800e4e <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800ead:	41 f6 c1 04          	test   $0x4,%r9b
+  800eb1:	74 06                	je     800eb9 <memset+0x97>
+  800eb3:	89 07                	mov    %eax,(%rdi)
+  800eb5:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800eb9:	41 f6 c1 02          	test   $0x2,%r9b
+  800ebd:	74 07                	je     800ec6 <memset+0xa4>
+  800ebf:	66 89 07             	mov    %ax,(%rdi)
+  800ec2:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800ec6:	41 f6 c1 01          	test   $0x1,%r9b
+  800eca:	74 9c                	je     800e68 <memset+0x46>
+  800ecc:	88 07                	mov    %al,(%rdi)
+  800ece:	eb 98                	jmp    800e68 <memset+0x46>
+
+0000000000800ed0 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800ed0:	48 89 f8             	mov    %rdi,%rax
+  800ed3:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800ed6:	48 39 fe             	cmp    %rdi,%rsi
+  800ed9:	73 3b                	jae    800f16 <memmove+0x46>
+  800edb:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800edf:	48 39 d7             	cmp    %rdx,%rdi
+  800ee2:	73 32                	jae    800f16 <memmove+0x46>
+        s += n;
+        d += n;
+  800ee4:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800ee8:	48 89 d6             	mov    %rdx,%rsi
+  800eeb:	48 09 fe             	or     %rdi,%rsi
+  800eee:	48 09 ce             	or     %rcx,%rsi
+  800ef1:	40 f6 c6 07          	test   $0x7,%sil
+  800ef5:	75 12                	jne    800f09 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800ef7:	48 83 ef 08          	sub    $0x8,%rdi
+  800efb:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800eff:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f03:	fd                   	std
+  800f04:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800f07:	fc                   	cld
+  800f08:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800f09:	48 83 ef 01          	sub    $0x1,%rdi
+  800f0d:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800f11:	fd                   	std
+  800f12:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800f14:	eb f1                	jmp    800f07 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800f16:	48 89 f2             	mov    %rsi,%rdx
+  800f19:	48 09 c2             	or     %rax,%rdx
+  800f1c:	48 09 ca             	or     %rcx,%rdx
+  800f1f:	f6 c2 07             	test   $0x7,%dl
+  800f22:	75 0c                	jne    800f30 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800f24:	48 c1 e9 03          	shr    $0x3,%rcx
+  800f28:	48 89 c7             	mov    %rax,%rdi
+  800f2b:	fc                   	cld
+  800f2c:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800f2f:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800f30:	48 89 c7             	mov    %rax,%rdi
+  800f33:	fc                   	cld
+  800f34:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800f36:	c3                   	ret
+
+0000000000800f37 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800f37:	55                   	push   %rbp
+  800f38:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800f3b:	48 b8 d0 0e 80 00 00 	movabs $0x800ed0,%rax
+  800f42:	00 00 00 
+  800f45:	ff d0                	call   *%rax
+}
+  800f47:	5d                   	pop    %rbp
+  800f48:	c3                   	ret
+
+0000000000800f49 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800f49:	55                   	push   %rbp
+  800f4a:	48 89 e5             	mov    %rsp,%rbp
+  800f4d:	41 57                	push   %r15
+  800f4f:	41 56                	push   %r14
+  800f51:	41 55                	push   %r13
+  800f53:	41 54                	push   %r12
+  800f55:	53                   	push   %rbx
+  800f56:	48 83 ec 08          	sub    $0x8,%rsp
+  800f5a:	49 89 fe             	mov    %rdi,%r14
+  800f5d:	49 89 f7             	mov    %rsi,%r15
+  800f60:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800f63:	48 89 f7             	mov    %rsi,%rdi
+  800f66:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  800f6d:	00 00 00 
+  800f70:	ff d0                	call   *%rax
+  800f72:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800f75:	48 89 de             	mov    %rbx,%rsi
+  800f78:	4c 89 f7             	mov    %r14,%rdi
+  800f7b:	48 b8 b3 0c 80 00 00 	movabs $0x800cb3,%rax
+  800f82:	00 00 00 
+  800f85:	ff d0                	call   *%rax
+  800f87:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f8a:	48 39 c3             	cmp    %rax,%rbx
+  800f8d:	74 36                	je     800fc5 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800f8f:	48 89 d8             	mov    %rbx,%rax
+  800f92:	4c 29 e8             	sub    %r13,%rax
+  800f95:	49 39 c4             	cmp    %rax,%r12
+  800f98:	73 31                	jae    800fcb <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800f9a:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800f9f:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fa3:	4c 89 fe             	mov    %r15,%rsi
+  800fa6:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  800fad:	00 00 00 
+  800fb0:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800fb2:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800fb6:	48 83 c4 08          	add    $0x8,%rsp
+  800fba:	5b                   	pop    %rbx
+  800fbb:	41 5c                	pop    %r12
+  800fbd:	41 5d                	pop    %r13
+  800fbf:	41 5e                	pop    %r14
+  800fc1:	41 5f                	pop    %r15
+  800fc3:	5d                   	pop    %rbp
+  800fc4:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800fc5:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800fc9:	eb eb                	jmp    800fb6 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800fcb:	48 83 eb 01          	sub    $0x1,%rbx
+  800fcf:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800fd3:	48 89 da             	mov    %rbx,%rdx
+  800fd6:	4c 89 fe             	mov    %r15,%rsi
+  800fd9:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  800fe0:	00 00 00 
+  800fe3:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800fe5:	49 01 de             	add    %rbx,%r14
+  800fe8:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800fed:	eb c3                	jmp    800fb2 <strlcat+0x69>
+
+0000000000800fef <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800fef:	48 85 d2             	test   %rdx,%rdx
+  800ff2:	74 2d                	je     801021 <memcmp+0x32>
+  800ff4:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800ff9:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800ffd:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801002:	44 38 c1             	cmp    %r8b,%cl
+  801005:	75 0f                	jne    801016 <memcmp+0x27>
+    while (n-- > 0) {
+  801007:	48 83 c0 01          	add    $0x1,%rax
+  80100b:	48 39 c2             	cmp    %rax,%rdx
+  80100e:	75 e9                	jne    800ff9 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801010:	b8 00 00 00 00       	mov    $0x0,%eax
+  801015:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  801016:	0f b6 c1             	movzbl %cl,%eax
+  801019:	45 0f b6 c0          	movzbl %r8b,%r8d
+  80101d:	44 29 c0             	sub    %r8d,%eax
+  801020:	c3                   	ret
+    return 0;
+  801021:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801026:	c3                   	ret
+
+0000000000801027 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  801027:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  80102b:	48 39 c7             	cmp    %rax,%rdi
+  80102e:	73 0f                	jae    80103f <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801030:	40 38 37             	cmp    %sil,(%rdi)
+  801033:	74 0e                	je     801043 <memfind+0x1c>
+    for (; src < end; src++) {
+  801035:	48 83 c7 01          	add    $0x1,%rdi
+  801039:	48 39 f8             	cmp    %rdi,%rax
+  80103c:	75 f2                	jne    801030 <memfind+0x9>
+  80103e:	c3                   	ret
+  80103f:	48 89 f8             	mov    %rdi,%rax
+  801042:	c3                   	ret
+  801043:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801046:	c3                   	ret
+
+0000000000801047 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801047:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  80104a:	0f b6 37             	movzbl (%rdi),%esi
+  80104d:	40 80 fe 20          	cmp    $0x20,%sil
+  801051:	74 06                	je     801059 <strtol+0x12>
+  801053:	40 80 fe 09          	cmp    $0x9,%sil
+  801057:	75 13                	jne    80106c <strtol+0x25>
+  801059:	48 83 c7 01          	add    $0x1,%rdi
+  80105d:	0f b6 37             	movzbl (%rdi),%esi
+  801060:	40 80 fe 20          	cmp    $0x20,%sil
+  801064:	74 f3                	je     801059 <strtol+0x12>
+  801066:	40 80 fe 09          	cmp    $0x9,%sil
+  80106a:	74 ed                	je     801059 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80106c:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80106f:	83 e0 fd             	and    $0xfffffffd,%eax
+  801072:	3c 01                	cmp    $0x1,%al
+  801074:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801078:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80107e:	75 0f                	jne    80108f <strtol+0x48>
+  801080:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801083:	74 14                	je     801099 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801085:	85 d2                	test   %edx,%edx
+  801087:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80108c:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80108f:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801094:	4c 63 ca             	movslq %edx,%r9
+  801097:	eb 36                	jmp    8010cf <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801099:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80109d:	74 0f                	je     8010ae <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80109f:	85 d2                	test   %edx,%edx
+  8010a1:	75 ec                	jne    80108f <strtol+0x48>
+        s++;
+  8010a3:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8010a7:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8010ac:	eb e1                	jmp    80108f <strtol+0x48>
+        s += 2;
+  8010ae:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8010b2:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8010b7:	eb d6                	jmp    80108f <strtol+0x48>
+            dig -= '0';
+  8010b9:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8010bc:	44 0f b6 c1          	movzbl %cl,%r8d
+  8010c0:	41 39 d0             	cmp    %edx,%r8d
+  8010c3:	7d 21                	jge    8010e6 <strtol+0x9f>
+        val = val * base + dig;
+  8010c5:	49 0f af c1          	imul   %r9,%rax
+  8010c9:	0f b6 c9             	movzbl %cl,%ecx
+  8010cc:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8010cf:	48 83 c7 01          	add    $0x1,%rdi
+  8010d3:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8010d7:	80 f9 39             	cmp    $0x39,%cl
+  8010da:	76 dd                	jbe    8010b9 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8010dc:	80 f9 7b             	cmp    $0x7b,%cl
+  8010df:	77 05                	ja     8010e6 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8010e1:	83 e9 57             	sub    $0x57,%ecx
+  8010e4:	eb d6                	jmp    8010bc <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8010e6:	4d 85 d2             	test   %r10,%r10
+  8010e9:	74 03                	je     8010ee <strtol+0xa7>
+  8010eb:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8010ee:	48 89 c2             	mov    %rax,%rdx
+  8010f1:	48 f7 da             	neg    %rdx
+  8010f4:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8010f8:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8010fc:	c3                   	ret
+
+00000000008010fd <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8010fd:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801102:	ba 00 00 00 00       	mov    $0x0,%edx
+  801107:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80110d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801113:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801119:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  80111b:	c3                   	ret
+
+000000000080111c <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  80111c:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801121:	bf 00 00 00 00       	mov    $0x0,%edi
+  801126:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80112b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801130:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801136:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80113c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801142:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801144:	c3                   	ret
+
+0000000000801145 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801145:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801148:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80114d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801152:	ba 00 00 00 00       	mov    $0x0,%edx
+  801157:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80115d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801163:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801169:	0f 05                	syscall
+    if (check && ret > 0) {
+  80116b:	48 85 c0             	test   %rax,%rax
+  80116e:	7f 01                	jg     801171 <sys_env_destroy+0x2c>
+}
+  801170:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801171:	55                   	push   %rbp
+  801172:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801175:	49 89 c0             	mov    %rax,%r8
+  801178:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80117d:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801184:	00 00 00 
+  801187:	be 29 00 00 00       	mov    $0x29,%esi
+  80118c:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  801193:	00 00 00 
+  801196:	b8 00 00 00 00       	mov    $0x0,%eax
+  80119b:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  8011a2:	00 00 00 
+  8011a5:	41 ff d1             	call   *%r9
+
+00000000008011a8 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011a8:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011ad:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011b2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011b7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011bc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011c8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011ce:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011d0:	c3                   	ret
+
+00000000008011d1 <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011d1:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8011d6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8011db:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8011e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011f7:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8011f9:	c3                   	ret
+
+00000000008011fa <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8011fa:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8011ff:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801206:	00 00 00 
+  801209:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80120f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801215:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80121b:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  80121d:	c3                   	ret
+
+000000000080121e <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  80121e:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801221:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801226:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80122c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801232:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801234:	c3                   	ret
+
+0000000000801235 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801235:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80123d:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801240:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801246:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80124c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80124e:	48 85 c0             	test   %rax,%rax
+  801251:	7f 01                	jg     801254 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801253:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801254:	55                   	push   %rbp
+  801255:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801258:	49 89 c0             	mov    %rax,%r8
+  80125b:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801260:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801267:	00 00 00 
+  80126a:	be 29 00 00 00       	mov    $0x29,%esi
+  80126f:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  801276:	00 00 00 
+  801279:	b8 00 00 00 00       	mov    $0x0,%eax
+  80127e:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  801285:	00 00 00 
+  801288:	41 ff d1             	call   *%r9
+
+000000000080128b <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  80128b:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80128e:	48 63 d2             	movslq %edx,%rdx
+  801291:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801294:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801299:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80129c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80129e:	48 85 c0             	test   %rax,%rax
+  8012a1:	7f 01                	jg     8012a4 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8012a3:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8012a4:	55                   	push   %rbp
+  8012a5:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012a8:	49 89 c0             	mov    %rax,%r8
+  8012ab:	b9 05 00 00 00       	mov    $0x5,%ecx
+  8012b0:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  8012b7:	00 00 00 
+  8012ba:	be 29 00 00 00       	mov    $0x29,%esi
+  8012bf:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  8012c6:	00 00 00 
+  8012c9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012ce:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  8012d5:	00 00 00 
+  8012d8:	41 ff d1             	call   *%r9
+
+00000000008012db <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8012db:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012de:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012e3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012e9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012ef:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012f5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012f7:	48 85 c0             	test   %rax,%rax
+  8012fa:	7f 01                	jg     8012fd <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8012fc:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8012fd:	55                   	push   %rbp
+  8012fe:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801301:	49 89 c0             	mov    %rax,%r8
+  801304:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801309:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801310:	00 00 00 
+  801313:	be 29 00 00 00       	mov    $0x29,%esi
+  801318:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  80131f:	00 00 00 
+  801322:	b8 00 00 00 00       	mov    $0x0,%eax
+  801327:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  80132e:	00 00 00 
+  801331:	41 ff d1             	call   *%r9
+
+0000000000801334 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801334:	48 63 f6             	movslq %esi,%rsi
+  801337:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80133a:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80133f:	ba 00 00 00 00       	mov    $0x0,%edx
+  801344:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80134a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801350:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801356:	0f 05                	syscall
+    if (check && ret > 0) {
+  801358:	48 85 c0             	test   %rax,%rax
+  80135b:	7f 01                	jg     80135e <sys_env_set_status+0x2a>
+}
+  80135d:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80135e:	55                   	push   %rbp
+  80135f:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801362:	49 89 c0             	mov    %rax,%r8
+  801365:	b9 09 00 00 00       	mov    $0x9,%ecx
+  80136a:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801371:	00 00 00 
+  801374:	be 29 00 00 00       	mov    $0x29,%esi
+  801379:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  801380:	00 00 00 
+  801383:	b8 00 00 00 00       	mov    $0x0,%eax
+  801388:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  80138f:	00 00 00 
+  801392:	41 ff d1             	call   *%r9
+
+0000000000801395 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801395:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801398:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80139d:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013a2:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013a8:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013ae:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013b4:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013b6:	48 85 c0             	test   %rax,%rax
+  8013b9:	7f 01                	jg     8013bc <sys_env_set_trapframe+0x27>
+}
+  8013bb:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  8013bc:	55                   	push   %rbp
+  8013bd:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013c0:	49 89 c0             	mov    %rax,%r8
+  8013c3:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  8013c8:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  8013cf:	00 00 00 
+  8013d2:	be 29 00 00 00       	mov    $0x29,%esi
+  8013d7:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  8013de:	00 00 00 
+  8013e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8013e6:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  8013ed:	00 00 00 
+  8013f0:	41 ff d1             	call   *%r9
+
+00000000008013f3 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8013f3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013f6:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013fb:	ba 00 00 00 00       	mov    $0x0,%edx
+  801400:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801406:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80140c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801412:	0f 05                	syscall
+    if (check && ret > 0) {
+  801414:	48 85 c0             	test   %rax,%rax
+  801417:	7f 01                	jg     80141a <sys_env_set_pgfault_upcall+0x27>
+}
+  801419:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  80141a:	55                   	push   %rbp
+  80141b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80141e:	49 89 c0             	mov    %rax,%r8
+  801421:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801426:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  80142d:	00 00 00 
+  801430:	be 29 00 00 00       	mov    $0x29,%esi
+  801435:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  80143c:	00 00 00 
+  80143f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801444:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  80144b:	00 00 00 
+  80144e:	41 ff d1             	call   *%r9
+
+0000000000801451 <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801451:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801454:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801457:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80145c:	4d 63 c0             	movslq %r8d,%r8
+  80145f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801465:	0f 05                	syscall
+}
+  801467:	c3                   	ret
+
+0000000000801468 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801468:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  80146b:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80146e:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801473:	4d 63 c0             	movslq %r8d,%r8
+  801476:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80147c:	0f 05                	syscall
+}
+  80147e:	c3                   	ret
+
+000000000080147f <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80147f:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801484:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801487:	45 89 c0             	mov    %r8d,%r8d
+  80148a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801490:	0f 05                	syscall
+    if (check && ret > 0) {
+  801492:	48 85 c0             	test   %rax,%rax
+  801495:	7f 01                	jg     801498 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801497:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801498:	55                   	push   %rbp
+  801499:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80149c:	49 89 c0             	mov    %rax,%r8
+  80149f:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8014a4:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  8014ab:	00 00 00 
+  8014ae:	be 29 00 00 00       	mov    $0x29,%esi
+  8014b3:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  8014ba:	00 00 00 
+  8014bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c2:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  8014c9:	00 00 00 
+  8014cc:	41 ff d1             	call   *%r9
+
+00000000008014cf <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  8014cf:	55                   	push   %rbp
+  8014d0:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8014d3:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014d9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8014de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e3:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  8014ea:	00 00 00 
+  8014ed:	ff d0                	call   *%rax
+}
+  8014ef:	5d                   	pop    %rbp
+  8014f0:	c3                   	ret
+
+00000000008014f1 <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014f1:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014f6:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014fb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801500:	ba 00 00 00 00       	mov    $0x0,%edx
+  801505:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80150b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801511:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801517:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801519:	c3                   	ret
+
+000000000080151a <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  80151a:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80151f:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801524:	ba 00 00 00 00       	mov    $0x0,%edx
+  801529:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801535:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80153b:	0f 05                	syscall
+    if (check && ret > 0) {
+  80153d:	48 85 c0             	test   %rax,%rax
+  801540:	7f 01                	jg     801543 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801542:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801543:	55                   	push   %rbp
+  801544:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801547:	49 89 c0             	mov    %rax,%r8
+  80154a:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80154f:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801556:	00 00 00 
+  801559:	be 29 00 00 00       	mov    $0x29,%esi
+  80155e:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  801565:	00 00 00 
+  801568:	b8 00 00 00 00       	mov    $0x0,%eax
+  80156d:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  801574:	00 00 00 
+  801577:	41 ff d1             	call   *%r9
+
+000000000080157a <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  80157a:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80157f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801584:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801589:	ba 00 00 00 00       	mov    $0x0,%edx
+  80158e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801594:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80159a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015a0:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8015a2:	c3                   	ret
+
+00000000008015a3 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8015a3:	89 d2                	mov    %edx,%edx
+  8015a5:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  8015a7:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015ac:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015b2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015b8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015be:	0f 05                	syscall
+}
+  8015c0:	c3                   	ret
+
+00000000008015c1 <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  8015c1:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c4:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e0:	0f 05                	syscall
+}
+  8015e2:	c3                   	ret
+
+00000000008015e3 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8015e3:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8015e6:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015eb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015f0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015f6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015fc:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801602:	0f 05                	syscall
+}
+  801604:	c3                   	ret
+
+0000000000801605 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  801605:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801608:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80160d:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801612:	ba 00 00 00 00       	mov    $0x0,%edx
+  801617:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80161d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801623:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801629:	0f 05                	syscall
+    if (check && ret > 0) {
+  80162b:	48 85 c0             	test   %rax,%rax
+  80162e:	7f 01                	jg     801631 <sys_irq_ack+0x2c>
+}
+  801630:	c3                   	ret
+sys_irq_ack(int irq) {
+  801631:	55                   	push   %rbp
+  801632:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801635:	49 89 c0             	mov    %rax,%r8
+  801638:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80163d:	48 ba b8 4e 80 00 00 	movabs $0x804eb8,%rdx
+  801644:	00 00 00 
+  801647:	be 29 00 00 00       	mov    $0x29,%esi
+  80164c:	48 bf d7 4e 80 00 00 	movabs $0x804ed7,%rdi
+  801653:	00 00 00 
+  801656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80165b:	49 b9 61 02 80 00 00 	movabs $0x800261,%r9
+  801662:	00 00 00 
+  801665:	41 ff d1             	call   *%r9
+
+0000000000801668 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801668:	55                   	push   %rbp
+  801669:	48 89 e5             	mov    %rsp,%rbp
+  80166c:	41 54                	push   %r12
+  80166e:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80166f:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  801676:	00 00 00 
+  801679:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  80167b:	b8 08 00 00 00       	mov    $0x8,%eax
+  801680:	0f 05                	syscall
+  801682:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801685:	85 c0                	test   %eax,%eax
+  801687:	78 7e                	js     801707 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801689:	0f 84 80 00 00 00    	je     80170f <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80168f:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801695:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80169c:	00 00 00 
+  80169f:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016a4:	89 c2                	mov    %eax,%edx
+  8016a6:	be 00 00 00 00       	mov    $0x0,%esi
+  8016ab:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016b0:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  8016b7:	00 00 00 
+  8016ba:	ff d0                	call   *%rax
+  8016bc:	85 c0                	test   %eax,%eax
+  8016be:	0f 88 86 00 00 00    	js     80174a <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  8016c4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8016cb:	00 00 00 
+  8016ce:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8016d5:	44 89 e7             	mov    %r12d,%edi
+  8016d8:	48 b8 f3 13 80 00 00 	movabs $0x8013f3,%rax
+  8016df:	00 00 00 
+  8016e2:	ff d0                	call   *%rax
+  8016e4:	85 c0                	test   %eax,%eax
+  8016e6:	78 6a                	js     801752 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8016e8:	be 02 00 00 00       	mov    $0x2,%esi
+  8016ed:	44 89 e7             	mov    %r12d,%edi
+  8016f0:	48 b8 34 13 80 00 00 	movabs $0x801334,%rax
+  8016f7:	00 00 00 
+  8016fa:	ff d0                	call   *%rax
+		return -1;
+  8016fc:	85 c0                	test   %eax,%eax
+  8016fe:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  801703:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801707:	44 89 e0             	mov    %r12d,%eax
+  80170a:	5b                   	pop    %rbx
+  80170b:	41 5c                	pop    %r12
+  80170d:	5d                   	pop    %rbp
+  80170e:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  80170f:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  801716:	00 00 00 
+  801719:	ff d0                	call   *%rax
+  80171b:	89 c2                	mov    %eax,%edx
+  80171d:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  801723:	48 89 d0             	mov    %rdx,%rax
+  801726:	48 c1 e0 04          	shl    $0x4,%rax
+  80172a:	48 29 d0             	sub    %rdx,%rax
+  80172d:	48 c1 e0 05          	shl    $0x5,%rax
+  801731:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801738:	00 00 00 
+  80173b:	48 01 d0             	add    %rdx,%rax
+  80173e:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801745:	00 00 00 
+        return 0;
+  801748:	eb bd                	jmp    801707 <fork+0x9f>
+		return -1;
+  80174a:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801750:	eb b5                	jmp    801707 <fork+0x9f>
+		return -1;
+  801752:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801758:	eb ad                	jmp    801707 <fork+0x9f>
+
+000000000080175a <sfork>:
+
+envid_t
+sfork() {
+  80175a:	55                   	push   %rbp
+  80175b:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80175e:	48 ba e5 4e 80 00 00 	movabs $0x804ee5,%rdx
+  801765:	00 00 00 
+  801768:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80176d:	48 bf 00 4f 80 00 00 	movabs $0x804f00,%rdi
+  801774:	00 00 00 
+  801777:	b8 00 00 00 00       	mov    $0x0,%eax
+  80177c:	48 b9 61 02 80 00 00 	movabs $0x800261,%rcx
+  801783:	00 00 00 
+  801786:	ff d1                	call   *%rcx
+
+0000000000801788 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801788:	55                   	push   %rbp
+  801789:	48 89 e5             	mov    %rsp,%rbp
+  80178c:	41 55                	push   %r13
+  80178e:	41 54                	push   %r12
+  801790:	53                   	push   %rbx
+  801791:	48 83 ec 08          	sub    $0x8,%rsp
+  801795:	49 89 fd             	mov    %rdi,%r13
+  801798:	48 89 f7             	mov    %rsi,%rdi
+  80179b:	48 89 d3             	mov    %rdx,%rbx
+  80179e:	49 89 cc             	mov    %rcx,%r12
+  8017a1:	4c 89 c2             	mov    %r8,%rdx
+  8017a4:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  8017a7:	48 85 f6             	test   %rsi,%rsi
+  8017aa:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8017b1:	00 00 00 
+  8017b4:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  8017b8:	be 00 10 00 00       	mov    $0x1000,%esi
+  8017bd:	48 85 db             	test   %rbx,%rbx
+  8017c0:	74 03                	je     8017c5 <ipc_recv_futex+0x3d>
+  8017c2:	48 8b 33             	mov    (%rbx),%rsi
+  8017c5:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  8017c9:	48 b8 7f 14 80 00 00 	movabs $0x80147f,%rax
+  8017d0:	00 00 00 
+  8017d3:	ff d0                	call   *%rax
+    if (res < 0) {
+  8017d5:	85 c0                	test   %eax,%eax
+  8017d7:	78 75                	js     80184e <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  8017d9:	4d 85 ed             	test   %r13,%r13
+  8017dc:	74 14                	je     8017f2 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  8017de:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8017e5:	00 00 00 
+  8017e8:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8017ee:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8017f2:	4d 85 e4             	test   %r12,%r12
+  8017f5:	74 14                	je     80180b <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8017f7:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8017fe:	00 00 00 
+  801801:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  801807:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80180b:	48 85 db             	test   %rbx,%rbx
+  80180e:	74 23                	je     801833 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  801810:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801817:	00 00 00 
+  80181a:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  801820:	ba 00 00 00 00       	mov    $0x0,%edx
+  801825:	85 c9                	test   %ecx,%ecx
+  801827:	74 07                	je     801830 <ipc_recv_futex+0xa8>
+  801829:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  801830:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  801833:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80183a:	00 00 00 
+  80183d:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  801843:	48 83 c4 08          	add    $0x8,%rsp
+  801847:	5b                   	pop    %rbx
+  801848:	41 5c                	pop    %r12
+  80184a:	41 5d                	pop    %r13
+  80184c:	5d                   	pop    %rbp
+  80184d:	c3                   	ret
+        if (from_env_store != NULL) {
+  80184e:	4d 85 ed             	test   %r13,%r13
+  801851:	74 08                	je     80185b <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  801853:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80185a:	00 
+        if (perm_store != NULL) {
+  80185b:	4d 85 e4             	test   %r12,%r12
+  80185e:	74 08                	je     801868 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  801860:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  801867:	00 
+        if (size != NULL) {
+  801868:	48 85 db             	test   %rbx,%rbx
+  80186b:	74 d6                	je     801843 <ipc_recv_futex+0xbb>
+            *size = 0;
+  80186d:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  801874:	eb cd                	jmp    801843 <ipc_recv_futex+0xbb>
+
+0000000000801876 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  801876:	55                   	push   %rbp
+  801877:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80187a:	48 83 ec 08          	sub    $0x8,%rsp
+  80187e:	6a 00                	push   $0x0
+  801880:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  801886:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80188c:	48 b8 88 17 80 00 00 	movabs $0x801788,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+}
+  801898:	c9                   	leave
+  801899:	c3                   	ret
+
+000000000080189a <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80189a:	55                   	push   %rbp
+  80189b:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80189e:	48 85 d2             	test   %rdx,%rdx
+  8018a1:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  8018a8:	00 00 00 
+  8018ab:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  8018af:	89 f6                	mov    %esi,%esi
+  8018b1:	48 b8 68 14 80 00 00 	movabs $0x801468,%rax
+  8018b8:	00 00 00 
+  8018bb:	ff d0                	call   *%rax
+    if (res < 0) {
+  8018bd:	85 c0                	test   %eax,%eax
+  8018bf:	78 02                	js     8018c3 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  8018c1:	5d                   	pop    %rbp
+  8018c2:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  8018c3:	89 c1                	mov    %eax,%ecx
+  8018c5:	48 ba 0b 4f 80 00 00 	movabs $0x804f0b,%rdx
+  8018cc:	00 00 00 
+  8018cf:	be 50 00 00 00       	mov    $0x50,%esi
+  8018d4:	48 bf 1f 4f 80 00 00 	movabs $0x804f1f,%rdi
+  8018db:	00 00 00 
+  8018de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8018e3:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  8018ea:	00 00 00 
+  8018ed:	41 ff d0             	call   *%r8
+
+00000000008018f0 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8018f0:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8018f5:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8018fc:	00 00 00 
+  8018ff:	48 89 d0             	mov    %rdx,%rax
+  801902:	48 c1 e0 04          	shl    $0x4,%rax
+  801906:	48 29 d0             	sub    %rdx,%rax
+  801909:	48 c1 e0 05          	shl    $0x5,%rax
+  80190d:	48 01 c8             	add    %rcx,%rax
+  801910:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  801916:	39 f8                	cmp    %edi,%eax
+  801918:	74 13                	je     80192d <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  80191a:	48 83 c2 01          	add    $0x1,%rdx
+  80191e:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  801925:	75 d8                	jne    8018ff <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  801927:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80192c:	c3                   	ret
+            return envs[i].env_id;
+  80192d:	48 89 d0             	mov    %rdx,%rax
+  801930:	48 c1 e0 04          	shl    $0x4,%rax
+  801934:	48 29 d0             	sub    %rdx,%rax
+  801937:	48 c1 e0 05          	shl    $0x5,%rax
+  80193b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801942:	00 00 00 
+  801945:	48 01 d0             	add    %rdx,%rax
+  801948:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  80194e:	c3                   	ret
+
+000000000080194f <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80194f:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801956:	ff ff ff 
+  801959:	48 01 f8             	add    %rdi,%rax
+  80195c:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801960:	c3                   	ret
+
+0000000000801961 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801961:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  801968:	ff ff ff 
+  80196b:	48 01 f8             	add    %rdi,%rax
+  80196e:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801972:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  801978:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80197c:	c3                   	ret
+
+000000000080197d <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  80197d:	55                   	push   %rbp
+  80197e:	48 89 e5             	mov    %rsp,%rbp
+  801981:	41 57                	push   %r15
+  801983:	41 56                	push   %r14
+  801985:	41 55                	push   %r13
+  801987:	41 54                	push   %r12
+  801989:	53                   	push   %rbx
+  80198a:	48 83 ec 08          	sub    $0x8,%rsp
+  80198e:	49 89 ff             	mov    %rdi,%r15
+  801991:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801996:	49 bd 0c 41 80 00 00 	movabs $0x80410c,%r13
+  80199d:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019a0:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019a6:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019a9:	48 89 df             	mov    %rbx,%rdi
+  8019ac:	41 ff d5             	call   *%r13
+  8019af:	83 e0 04             	and    $0x4,%eax
+  8019b2:	74 17                	je     8019cb <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019b4:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019bb:	4c 39 f3             	cmp    %r14,%rbx
+  8019be:	75 e6                	jne    8019a6 <fd_alloc+0x29>
+  8019c0:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019c6:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019cb:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019ce:	48 83 c4 08          	add    $0x8,%rsp
+  8019d2:	5b                   	pop    %rbx
+  8019d3:	41 5c                	pop    %r12
+  8019d5:	41 5d                	pop    %r13
+  8019d7:	41 5e                	pop    %r14
+  8019d9:	41 5f                	pop    %r15
+  8019db:	5d                   	pop    %rbp
+  8019dc:	c3                   	ret
+
+00000000008019dd <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019dd:	83 ff 1f             	cmp    $0x1f,%edi
+  8019e0:	77 39                	ja     801a1b <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019e2:	55                   	push   %rbp
+  8019e3:	48 89 e5             	mov    %rsp,%rbp
+  8019e6:	41 54                	push   %r12
+  8019e8:	53                   	push   %rbx
+  8019e9:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019ec:	48 63 df             	movslq %edi,%rbx
+  8019ef:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019f6:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  8019fa:	48 89 df             	mov    %rbx,%rdi
+  8019fd:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  801a04:	00 00 00 
+  801a07:	ff d0                	call   *%rax
+  801a09:	a8 04                	test   $0x4,%al
+  801a0b:	74 14                	je     801a21 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a0d:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a11:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a16:	5b                   	pop    %rbx
+  801a17:	41 5c                	pop    %r12
+  801a19:	5d                   	pop    %rbp
+  801a1a:	c3                   	ret
+        return -E_INVAL;
+  801a1b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a20:	c3                   	ret
+        return -E_INVAL;
+  801a21:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a26:	eb ee                	jmp    801a16 <fd_lookup+0x39>
+
+0000000000801a28 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a28:	55                   	push   %rbp
+  801a29:	48 89 e5             	mov    %rsp,%rbp
+  801a2c:	41 54                	push   %r12
+  801a2e:	53                   	push   %rbx
+  801a2f:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a32:	48 b8 c0 4f 80 00 00 	movabs $0x804fc0,%rax
+  801a39:	00 00 00 
+  801a3c:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801a43:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a46:	39 3b                	cmp    %edi,(%rbx)
+  801a48:	74 47                	je     801a91 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a4a:	48 83 c0 08          	add    $0x8,%rax
+  801a4e:	48 8b 18             	mov    (%rax),%rbx
+  801a51:	48 85 db             	test   %rbx,%rbx
+  801a54:	75 f0                	jne    801a46 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a56:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a5d:	00 00 00 
+  801a60:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a66:	89 fa                	mov    %edi,%edx
+  801a68:	48 bf 30 4f 80 00 00 	movabs $0x804f30,%rdi
+  801a6f:	00 00 00 
+  801a72:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a77:	48 b9 b1 03 80 00 00 	movabs $0x8003b1,%rcx
+  801a7e:	00 00 00 
+  801a81:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a83:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a88:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a8c:	5b                   	pop    %rbx
+  801a8d:	41 5c                	pop    %r12
+  801a8f:	5d                   	pop    %rbp
+  801a90:	c3                   	ret
+            return 0;
+  801a91:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a96:	eb f0                	jmp    801a88 <dev_lookup+0x60>
+
+0000000000801a98 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a98:	55                   	push   %rbp
+  801a99:	48 89 e5             	mov    %rsp,%rbp
+  801a9c:	41 55                	push   %r13
+  801a9e:	41 54                	push   %r12
+  801aa0:	53                   	push   %rbx
+  801aa1:	48 83 ec 18          	sub    $0x18,%rsp
+  801aa5:	48 89 fb             	mov    %rdi,%rbx
+  801aa8:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801aab:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ab2:	ff ff ff 
+  801ab5:	48 01 df             	add    %rbx,%rdi
+  801ab8:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801abc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ac0:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801ac7:	00 00 00 
+  801aca:	ff d0                	call   *%rax
+  801acc:	41 89 c5             	mov    %eax,%r13d
+  801acf:	85 c0                	test   %eax,%eax
+  801ad1:	78 06                	js     801ad9 <fd_close+0x41>
+  801ad3:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ad7:	74 1a                	je     801af3 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ad9:	45 84 e4             	test   %r12b,%r12b
+  801adc:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae1:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801ae5:	44 89 e8             	mov    %r13d,%eax
+  801ae8:	48 83 c4 18          	add    $0x18,%rsp
+  801aec:	5b                   	pop    %rbx
+  801aed:	41 5c                	pop    %r12
+  801aef:	41 5d                	pop    %r13
+  801af1:	5d                   	pop    %rbp
+  801af2:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801af3:	8b 3b                	mov    (%rbx),%edi
+  801af5:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801af9:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801b00:	00 00 00 
+  801b03:	ff d0                	call   *%rax
+  801b05:	41 89 c5             	mov    %eax,%r13d
+  801b08:	85 c0                	test   %eax,%eax
+  801b0a:	78 1b                	js     801b27 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b0c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b10:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b14:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b1a:	48 85 c0             	test   %rax,%rax
+  801b1d:	74 08                	je     801b27 <fd_close+0x8f>
+  801b1f:	48 89 df             	mov    %rbx,%rdi
+  801b22:	ff d0                	call   *%rax
+  801b24:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b2c:	48 89 de             	mov    %rbx,%rsi
+  801b2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b34:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  801b3b:	00 00 00 
+  801b3e:	ff d0                	call   *%rax
+    return res;
+  801b40:	eb a3                	jmp    801ae5 <fd_close+0x4d>
+
+0000000000801b42 <close>:
+
+int
+close(int fdnum) {
+  801b42:	55                   	push   %rbp
+  801b43:	48 89 e5             	mov    %rsp,%rbp
+  801b46:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b4a:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b4e:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801b55:	00 00 00 
+  801b58:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b5a:	85 c0                	test   %eax,%eax
+  801b5c:	78 15                	js     801b73 <close+0x31>
+
+    return fd_close(fd, 1);
+  801b5e:	be 01 00 00 00       	mov    $0x1,%esi
+  801b63:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b67:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  801b6e:	00 00 00 
+  801b71:	ff d0                	call   *%rax
+}
+  801b73:	c9                   	leave
+  801b74:	c3                   	ret
+
+0000000000801b75 <close_all>:
+
+void
+close_all(void) {
+  801b75:	55                   	push   %rbp
+  801b76:	48 89 e5             	mov    %rsp,%rbp
+  801b79:	41 54                	push   %r12
+  801b7b:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b7c:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b81:	49 bc 42 1b 80 00 00 	movabs $0x801b42,%r12
+  801b88:	00 00 00 
+  801b8b:	89 df                	mov    %ebx,%edi
+  801b8d:	41 ff d4             	call   *%r12
+  801b90:	83 c3 01             	add    $0x1,%ebx
+  801b93:	83 fb 20             	cmp    $0x20,%ebx
+  801b96:	75 f3                	jne    801b8b <close_all+0x16>
+}
+  801b98:	5b                   	pop    %rbx
+  801b99:	41 5c                	pop    %r12
+  801b9b:	5d                   	pop    %rbp
+  801b9c:	c3                   	ret
+
+0000000000801b9d <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801b9d:	55                   	push   %rbp
+  801b9e:	48 89 e5             	mov    %rsp,%rbp
+  801ba1:	41 57                	push   %r15
+  801ba3:	41 56                	push   %r14
+  801ba5:	41 55                	push   %r13
+  801ba7:	41 54                	push   %r12
+  801ba9:	53                   	push   %rbx
+  801baa:	48 83 ec 18          	sub    $0x18,%rsp
+  801bae:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bb1:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bb5:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801bbc:	00 00 00 
+  801bbf:	ff d0                	call   *%rax
+  801bc1:	89 c3                	mov    %eax,%ebx
+  801bc3:	85 c0                	test   %eax,%eax
+  801bc5:	0f 88 b8 00 00 00    	js     801c83 <dup+0xe6>
+    close(newfdnum);
+  801bcb:	44 89 e7             	mov    %r12d,%edi
+  801bce:	48 b8 42 1b 80 00 00 	movabs $0x801b42,%rax
+  801bd5:	00 00 00 
+  801bd8:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801bda:	4d 63 ec             	movslq %r12d,%r13
+  801bdd:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801be4:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801be8:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bec:	4c 89 ff             	mov    %r15,%rdi
+  801bef:	49 be 61 19 80 00 00 	movabs $0x801961,%r14
+  801bf6:	00 00 00 
+  801bf9:	41 ff d6             	call   *%r14
+  801bfc:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801bff:	4c 89 ef             	mov    %r13,%rdi
+  801c02:	41 ff d6             	call   *%r14
+  801c05:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c08:	48 89 df             	mov    %rbx,%rdi
+  801c0b:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  801c12:	00 00 00 
+  801c15:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c17:	a8 04                	test   $0x4,%al
+  801c19:	74 2b                	je     801c46 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c1b:	41 89 c1             	mov    %eax,%r9d
+  801c1e:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c24:	4c 89 f1             	mov    %r14,%rcx
+  801c27:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c2c:	48 89 de             	mov    %rbx,%rsi
+  801c2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c34:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801c3b:	00 00 00 
+  801c3e:	ff d0                	call   *%rax
+  801c40:	89 c3                	mov    %eax,%ebx
+  801c42:	85 c0                	test   %eax,%eax
+  801c44:	78 4e                	js     801c94 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c46:	4c 89 ff             	mov    %r15,%rdi
+  801c49:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  801c50:	00 00 00 
+  801c53:	ff d0                	call   *%rax
+  801c55:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c58:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c5e:	4c 89 e9             	mov    %r13,%rcx
+  801c61:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c66:	4c 89 fe             	mov    %r15,%rsi
+  801c69:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c6e:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  801c75:	00 00 00 
+  801c78:	ff d0                	call   *%rax
+  801c7a:	89 c3                	mov    %eax,%ebx
+  801c7c:	85 c0                	test   %eax,%eax
+  801c7e:	78 14                	js     801c94 <dup+0xf7>
+
+    return newfdnum;
+  801c80:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c83:	89 d8                	mov    %ebx,%eax
+  801c85:	48 83 c4 18          	add    $0x18,%rsp
+  801c89:	5b                   	pop    %rbx
+  801c8a:	41 5c                	pop    %r12
+  801c8c:	41 5d                	pop    %r13
+  801c8e:	41 5e                	pop    %r14
+  801c90:	41 5f                	pop    %r15
+  801c92:	5d                   	pop    %rbp
+  801c93:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c94:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801c99:	4c 89 ee             	mov    %r13,%rsi
+  801c9c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca1:	49 bc db 12 80 00 00 	movabs $0x8012db,%r12
+  801ca8:	00 00 00 
+  801cab:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cae:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cb3:	4c 89 f6             	mov    %r14,%rsi
+  801cb6:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cbb:	41 ff d4             	call   *%r12
+    return res;
+  801cbe:	eb c3                	jmp    801c83 <dup+0xe6>
+
+0000000000801cc0 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cc0:	55                   	push   %rbp
+  801cc1:	48 89 e5             	mov    %rsp,%rbp
+  801cc4:	41 56                	push   %r14
+  801cc6:	41 55                	push   %r13
+  801cc8:	41 54                	push   %r12
+  801cca:	53                   	push   %rbx
+  801ccb:	48 83 ec 10          	sub    $0x10,%rsp
+  801ccf:	89 fb                	mov    %edi,%ebx
+  801cd1:	49 89 f4             	mov    %rsi,%r12
+  801cd4:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cd7:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cdb:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801ce2:	00 00 00 
+  801ce5:	ff d0                	call   *%rax
+  801ce7:	85 c0                	test   %eax,%eax
+  801ce9:	78 4c                	js     801d37 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ceb:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cef:	41 8b 3e             	mov    (%r14),%edi
+  801cf2:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cf6:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801cfd:	00 00 00 
+  801d00:	ff d0                	call   *%rax
+  801d02:	85 c0                	test   %eax,%eax
+  801d04:	78 35                	js     801d3b <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d06:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d0a:	83 e0 03             	and    $0x3,%eax
+  801d0d:	83 f8 01             	cmp    $0x1,%eax
+  801d10:	74 2d                	je     801d3f <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d12:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d16:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d1a:	48 85 c0             	test   %rax,%rax
+  801d1d:	74 56                	je     801d75 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d1f:	4c 89 ea             	mov    %r13,%rdx
+  801d22:	4c 89 e6             	mov    %r12,%rsi
+  801d25:	4c 89 f7             	mov    %r14,%rdi
+  801d28:	ff d0                	call   *%rax
+}
+  801d2a:	48 83 c4 10          	add    $0x10,%rsp
+  801d2e:	5b                   	pop    %rbx
+  801d2f:	41 5c                	pop    %r12
+  801d31:	41 5d                	pop    %r13
+  801d33:	41 5e                	pop    %r14
+  801d35:	5d                   	pop    %rbp
+  801d36:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d37:	48 98                	cltq
+  801d39:	eb ef                	jmp    801d2a <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d3b:	48 98                	cltq
+  801d3d:	eb eb                	jmp    801d2a <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d3f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d46:	00 00 00 
+  801d49:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d4f:	89 da                	mov    %ebx,%edx
+  801d51:	48 bf 71 4f 80 00 00 	movabs $0x804f71,%rdi
+  801d58:	00 00 00 
+  801d5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d60:	48 b9 b1 03 80 00 00 	movabs $0x8003b1,%rcx
+  801d67:	00 00 00 
+  801d6a:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d6c:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d73:	eb b5                	jmp    801d2a <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d75:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d7c:	eb ac                	jmp    801d2a <read+0x6a>
+
+0000000000801d7e <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d7e:	55                   	push   %rbp
+  801d7f:	48 89 e5             	mov    %rsp,%rbp
+  801d82:	41 57                	push   %r15
+  801d84:	41 56                	push   %r14
+  801d86:	41 55                	push   %r13
+  801d88:	41 54                	push   %r12
+  801d8a:	53                   	push   %rbx
+  801d8b:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d8f:	48 85 d2             	test   %rdx,%rdx
+  801d92:	74 54                	je     801de8 <readn+0x6a>
+  801d94:	41 89 fd             	mov    %edi,%r13d
+  801d97:	49 89 f6             	mov    %rsi,%r14
+  801d9a:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801d9d:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801da2:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801da7:	49 bf c0 1c 80 00 00 	movabs $0x801cc0,%r15
+  801dae:	00 00 00 
+  801db1:	4c 89 e2             	mov    %r12,%rdx
+  801db4:	48 29 f2             	sub    %rsi,%rdx
+  801db7:	4c 01 f6             	add    %r14,%rsi
+  801dba:	44 89 ef             	mov    %r13d,%edi
+  801dbd:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	78 20                	js     801de4 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dc4:	01 c3                	add    %eax,%ebx
+  801dc6:	85 c0                	test   %eax,%eax
+  801dc8:	74 08                	je     801dd2 <readn+0x54>
+  801dca:	48 63 f3             	movslq %ebx,%rsi
+  801dcd:	4c 39 e6             	cmp    %r12,%rsi
+  801dd0:	72 df                	jb     801db1 <readn+0x33>
+    }
+    return res;
+  801dd2:	48 63 c3             	movslq %ebx,%rax
+}
+  801dd5:	48 83 c4 08          	add    $0x8,%rsp
+  801dd9:	5b                   	pop    %rbx
+  801dda:	41 5c                	pop    %r12
+  801ddc:	41 5d                	pop    %r13
+  801dde:	41 5e                	pop    %r14
+  801de0:	41 5f                	pop    %r15
+  801de2:	5d                   	pop    %rbp
+  801de3:	c3                   	ret
+        if (inc < 0) return inc;
+  801de4:	48 98                	cltq
+  801de6:	eb ed                	jmp    801dd5 <readn+0x57>
+    int inc = 1, res = 0;
+  801de8:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801ded:	eb e3                	jmp    801dd2 <readn+0x54>
+
+0000000000801def <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801def:	55                   	push   %rbp
+  801df0:	48 89 e5             	mov    %rsp,%rbp
+  801df3:	41 56                	push   %r14
+  801df5:	41 55                	push   %r13
+  801df7:	41 54                	push   %r12
+  801df9:	53                   	push   %rbx
+  801dfa:	48 83 ec 10          	sub    $0x10,%rsp
+  801dfe:	89 fb                	mov    %edi,%ebx
+  801e00:	49 89 f4             	mov    %rsi,%r12
+  801e03:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e06:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e0a:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801e11:	00 00 00 
+  801e14:	ff d0                	call   *%rax
+  801e16:	85 c0                	test   %eax,%eax
+  801e18:	78 47                	js     801e61 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e1a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e1e:	41 8b 3e             	mov    (%r14),%edi
+  801e21:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e25:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801e2c:	00 00 00 
+  801e2f:	ff d0                	call   *%rax
+  801e31:	85 c0                	test   %eax,%eax
+  801e33:	78 30                	js     801e65 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e35:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e3a:	74 2d                	je     801e69 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e3c:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e40:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e44:	48 85 c0             	test   %rax,%rax
+  801e47:	74 56                	je     801e9f <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e49:	4c 89 ea             	mov    %r13,%rdx
+  801e4c:	4c 89 e6             	mov    %r12,%rsi
+  801e4f:	4c 89 f7             	mov    %r14,%rdi
+  801e52:	ff d0                	call   *%rax
+}
+  801e54:	48 83 c4 10          	add    $0x10,%rsp
+  801e58:	5b                   	pop    %rbx
+  801e59:	41 5c                	pop    %r12
+  801e5b:	41 5d                	pop    %r13
+  801e5d:	41 5e                	pop    %r14
+  801e5f:	5d                   	pop    %rbp
+  801e60:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e61:	48 98                	cltq
+  801e63:	eb ef                	jmp    801e54 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e65:	48 98                	cltq
+  801e67:	eb eb                	jmp    801e54 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e69:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e70:	00 00 00 
+  801e73:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e79:	89 da                	mov    %ebx,%edx
+  801e7b:	48 bf 8d 4f 80 00 00 	movabs $0x804f8d,%rdi
+  801e82:	00 00 00 
+  801e85:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e8a:	48 b9 b1 03 80 00 00 	movabs $0x8003b1,%rcx
+  801e91:	00 00 00 
+  801e94:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e96:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801e9d:	eb b5                	jmp    801e54 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e9f:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ea6:	eb ac                	jmp    801e54 <write+0x65>
+
+0000000000801ea8 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801ea8:	55                   	push   %rbp
+  801ea9:	48 89 e5             	mov    %rsp,%rbp
+  801eac:	41 54                	push   %r12
+  801eae:	53                   	push   %rbx
+  801eaf:	48 83 ec 10          	sub    $0x10,%rsp
+  801eb3:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801eb5:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801eb9:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801ec0:	00 00 00 
+  801ec3:	ff d0                	call   *%rax
+  801ec5:	85 c0                	test   %eax,%eax
+  801ec7:	78 3e                	js     801f07 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ec9:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ecd:	41 8b 3c 24          	mov    (%r12),%edi
+  801ed1:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801ed5:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801edc:	00 00 00 
+  801edf:	ff d0                	call   *%rax
+  801ee1:	85 c0                	test   %eax,%eax
+  801ee3:	78 22                	js     801f07 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801ee5:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ee9:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801eed:	48 85 c0             	test   %rax,%rax
+  801ef0:	74 0b                	je     801efd <seek+0x55>
+  801ef2:	89 de                	mov    %ebx,%esi
+  801ef4:	4c 89 e7             	mov    %r12,%rdi
+  801ef7:	ff d0                	call   *%rax
+  801ef9:	85 c0                	test   %eax,%eax
+  801efb:	78 0a                	js     801f07 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801efd:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801f02:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f07:	48 83 c4 10          	add    $0x10,%rsp
+  801f0b:	5b                   	pop    %rbx
+  801f0c:	41 5c                	pop    %r12
+  801f0e:	5d                   	pop    %rbp
+  801f0f:	c3                   	ret
+
+0000000000801f10 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f10:	55                   	push   %rbp
+  801f11:	48 89 e5             	mov    %rsp,%rbp
+  801f14:	41 55                	push   %r13
+  801f16:	41 54                	push   %r12
+  801f18:	53                   	push   %rbx
+  801f19:	48 83 ec 18          	sub    $0x18,%rsp
+  801f1d:	89 fb                	mov    %edi,%ebx
+  801f1f:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f22:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f26:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801f2d:	00 00 00 
+  801f30:	ff d0                	call   *%rax
+  801f32:	85 c0                	test   %eax,%eax
+  801f34:	78 38                	js     801f6e <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f36:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f3a:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f3e:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f42:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801f49:	00 00 00 
+  801f4c:	ff d0                	call   *%rax
+  801f4e:	85 c0                	test   %eax,%eax
+  801f50:	78 1c                	js     801f6e <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f52:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f57:	74 20                	je     801f79 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f59:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f5d:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f61:	48 85 c0             	test   %rax,%rax
+  801f64:	74 47                	je     801fad <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f66:	44 89 e6             	mov    %r12d,%esi
+  801f69:	4c 89 ef             	mov    %r13,%rdi
+  801f6c:	ff d0                	call   *%rax
+}
+  801f6e:	48 83 c4 18          	add    $0x18,%rsp
+  801f72:	5b                   	pop    %rbx
+  801f73:	41 5c                	pop    %r12
+  801f75:	41 5d                	pop    %r13
+  801f77:	5d                   	pop    %rbp
+  801f78:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f79:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f80:	00 00 00 
+  801f83:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f89:	89 da                	mov    %ebx,%edx
+  801f8b:	48 bf 50 4f 80 00 00 	movabs $0x804f50,%rdi
+  801f92:	00 00 00 
+  801f95:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f9a:	48 b9 b1 03 80 00 00 	movabs $0x8003b1,%rcx
+  801fa1:	00 00 00 
+  801fa4:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fa6:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fab:	eb c1                	jmp    801f6e <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fad:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb2:	eb ba                	jmp    801f6e <ftruncate+0x5e>
+
+0000000000801fb4 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fb4:	55                   	push   %rbp
+  801fb5:	48 89 e5             	mov    %rsp,%rbp
+  801fb8:	41 54                	push   %r12
+  801fba:	53                   	push   %rbx
+  801fbb:	48 83 ec 10          	sub    $0x10,%rsp
+  801fbf:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc2:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fc6:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  801fcd:	00 00 00 
+  801fd0:	ff d0                	call   *%rax
+  801fd2:	85 c0                	test   %eax,%eax
+  801fd4:	78 4e                	js     802024 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fd6:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fda:	41 8b 3c 24          	mov    (%r12),%edi
+  801fde:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fe2:	48 b8 28 1a 80 00 00 	movabs $0x801a28,%rax
+  801fe9:	00 00 00 
+  801fec:	ff d0                	call   *%rax
+  801fee:	85 c0                	test   %eax,%eax
+  801ff0:	78 32                	js     802024 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ff2:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ff6:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801ffb:	74 30                	je     80202d <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801ffd:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802000:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802007:	00 00 00 
+    stat->st_isdir = 0;
+  80200a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802011:	00 00 00 
+    stat->st_dev = dev;
+  802014:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  80201b:	48 89 de             	mov    %rbx,%rsi
+  80201e:	4c 89 e7             	mov    %r12,%rdi
+  802021:	ff 50 28             	call   *0x28(%rax)
+}
+  802024:	48 83 c4 10          	add    $0x10,%rsp
+  802028:	5b                   	pop    %rbx
+  802029:	41 5c                	pop    %r12
+  80202b:	5d                   	pop    %rbp
+  80202c:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  80202d:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802032:	eb f0                	jmp    802024 <fstat+0x70>
+
+0000000000802034 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802034:	55                   	push   %rbp
+  802035:	48 89 e5             	mov    %rsp,%rbp
+  802038:	41 54                	push   %r12
+  80203a:	53                   	push   %rbx
+  80203b:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  80203e:	be 00 00 00 00       	mov    $0x0,%esi
+  802043:	48 b8 a2 31 80 00 00 	movabs $0x8031a2,%rax
+  80204a:	00 00 00 
+  80204d:	ff d0                	call   *%rax
+  80204f:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802051:	85 c0                	test   %eax,%eax
+  802053:	78 25                	js     80207a <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802055:	4c 89 e6             	mov    %r12,%rsi
+  802058:	89 c7                	mov    %eax,%edi
+  80205a:	48 b8 b4 1f 80 00 00 	movabs $0x801fb4,%rax
+  802061:	00 00 00 
+  802064:	ff d0                	call   *%rax
+  802066:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802069:	89 df                	mov    %ebx,%edi
+  80206b:	48 b8 42 1b 80 00 00 	movabs $0x801b42,%rax
+  802072:	00 00 00 
+  802075:	ff d0                	call   *%rax
+
+    return res;
+  802077:	44 89 e3             	mov    %r12d,%ebx
+}
+  80207a:	89 d8                	mov    %ebx,%eax
+  80207c:	5b                   	pop    %rbx
+  80207d:	41 5c                	pop    %r12
+  80207f:	5d                   	pop    %rbp
+  802080:	c3                   	ret
+
+0000000000802081 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802081:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802088:	00 00 00 
+  80208b:	83 38 00             	cmpl   $0x0,(%rax)
+  80208e:	74 0a                	je     80209a <fsenv+0x19>
+    return envid;
+}
+  802090:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802097:	00 00 
+  802099:	c3                   	ret
+fsenv(void) {
+  80209a:	55                   	push   %rbp
+  80209b:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  80209e:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020a3:	48 b8 f0 18 80 00 00 	movabs $0x8018f0,%rax
+  8020aa:	00 00 00 
+  8020ad:	ff d0                	call   *%rax
+  8020af:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8020b6:	00 00 
+}
+  8020b8:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020bf:	00 00 
+  8020c1:	5d                   	pop    %rbp
+  8020c2:	c3                   	ret
+
+00000000008020c3 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8020c3:	55                   	push   %rbp
+  8020c4:	48 89 e5             	mov    %rsp,%rbp
+  8020c7:	41 54                	push   %r12
+  8020c9:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020ca:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020cf:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020d4:	48 89 de             	mov    %rbx,%rsi
+  8020d7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020dc:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  8020e3:	00 00 00 
+  8020e6:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8020e8:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8020ef:	00 00 00 
+  8020f2:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020f8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8020fd:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802102:	48 89 de             	mov    %rbx,%rsi
+  802105:	bf 00 00 00 00       	mov    $0x0,%edi
+  80210a:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  802111:	00 00 00 
+  802114:	ff d0                	call   *%rax
+  802116:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802118:	85 c0                	test   %eax,%eax
+  80211a:	0f 88 a2 00 00 00    	js     8021c2 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802120:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802127:	00 00 00 
+  80212a:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802130:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802135:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802137:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  80213c:	49 bc d4 42 80 00 00 	movabs $0x8042d4,%r12
+  802143:	00 00 00 
+  802146:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802149:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  80214e:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802151:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  802158:	00 00 00 
+  80215b:	ff d0                	call   *%rax
+  80215d:	89 c7                	mov    %eax,%edi
+  80215f:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802165:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  80216a:	48 89 da             	mov    %rbx,%rdx
+  80216d:	be 09 00 00 00       	mov    $0x9,%esi
+  802172:	48 b8 9a 18 80 00 00 	movabs $0x80189a,%rax
+  802179:	00 00 00 
+  80217c:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  80217e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802183:	ba 00 00 00 00       	mov    $0x0,%edx
+  802188:	be 00 00 00 00       	mov    $0x0,%esi
+  80218d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802192:	48 b8 76 18 80 00 00 	movabs $0x801876,%rax
+  802199:	00 00 00 
+  80219c:	ff d0                	call   *%rax
+  80219e:	89 c3                	mov    %eax,%ebx
+  8021a0:	85 c0                	test   %eax,%eax
+  8021a2:	78 25                	js     8021c9 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8021a4:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021ab:	00 00 00 
+  8021ae:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021b4:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8021bb:	00 00 
+    return 0;
+  8021bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8021c2:	89 d8                	mov    %ebx,%eax
+  8021c4:	5b                   	pop    %rbx
+  8021c5:	41 5c                	pop    %r12
+  8021c7:	5d                   	pop    %rbp
+  8021c8:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021c9:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021ce:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8021d3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021d8:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  8021df:	00 00 00 
+  8021e2:	ff d0                	call   *%rax
+        return res;
+  8021e4:	eb dc                	jmp    8021c2 <fschan_setup+0xff>
+
+00000000008021e6 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8021e6:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021ed:	00 00 00 
+  8021f0:	80 38 00             	cmpb   $0x0,(%rax)
+  8021f3:	74 55                	je     80224a <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021f5:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021fc:	00 00 00 
+  8021ff:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802205:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80220a:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802211:	00 00 00 
+  802214:	3b 0a                	cmp    (%rdx),%ecx
+  802216:	75 01                	jne    802219 <fschan+0x33>
+}
+  802218:	c3                   	ret
+fschan(void) {
+  802219:	55                   	push   %rbp
+  80221a:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  80221d:	48 b8 c3 20 80 00 00 	movabs $0x8020c3,%rax
+  802224:	00 00 00 
+  802227:	ff d0                	call   *%rax
+  802229:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  80222b:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802230:	85 d2                	test   %edx,%edx
+  802232:	78 02                	js     802236 <fschan+0x50>
+}
+  802234:	5d                   	pop    %rbp
+  802235:	c3                   	ret
+        fschan_enabled = 0;
+  802236:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80223d:	00 00 00 
+  802240:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802243:	b8 00 00 00 00       	mov    $0x0,%eax
+  802248:	eb ea                	jmp    802234 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  80224a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224f:	c3                   	ret
+
+0000000000802250 <fbuf>:
+fbuf(struct Fd *fd) {
+  802250:	55                   	push   %rbp
+  802251:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802254:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  80225b:	00 00 00 
+  80225e:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802260:	ba 00 00 00 00       	mov    $0x0,%edx
+  802265:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802269:	77 12                	ja     80227d <fbuf+0x2d>
+  80226b:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80226f:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802276:	00 00 00 
+  802279:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  80227d:	48 89 d0             	mov    %rdx,%rax
+  802280:	5d                   	pop    %rbp
+  802281:	c3                   	ret
+
+0000000000802282 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802282:	55                   	push   %rbp
+  802283:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802286:	48 83 c7 40          	add    $0x40,%rdi
+  80228a:	48 b8 0e 43 80 00 00 	movabs $0x80430e,%rax
+  802291:	00 00 00 
+  802294:	ff d0                	call   *%rax
+  802296:	84 c0                	test   %al,%al
+  802298:	75 02                	jne    80229c <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80229a:	5d                   	pop    %rbp
+  80229b:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80229c:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  8022a3:	00 00 00 
+  8022a6:	ff d0                	call   *%rax
+  8022a8:	89 c7                	mov    %eax,%edi
+  8022aa:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022b0:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022b5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022ba:	be 0a 00 00 00       	mov    $0xa,%esi
+  8022bf:	48 b8 9a 18 80 00 00 	movabs $0x80189a,%rax
+  8022c6:	00 00 00 
+  8022c9:	ff d0                	call   *%rax
+}
+  8022cb:	eb cd                	jmp    80229a <fschan_publish+0x18>
+
+00000000008022cd <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8022cd:	55                   	push   %rbp
+  8022ce:	48 89 e5             	mov    %rsp,%rbp
+  8022d1:	41 57                	push   %r15
+  8022d3:	41 56                	push   %r14
+  8022d5:	41 55                	push   %r13
+  8022d7:	41 54                	push   %r12
+  8022d9:	53                   	push   %rbx
+  8022da:	48 83 ec 48          	sub    $0x48,%rsp
+  8022de:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022e2:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8022e6:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8022e9:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8022ed:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8022f0:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8022f7:	00 00 00 
+  8022fa:	8b 02                	mov    (%rdx),%eax
+  8022fc:	83 c0 01             	add    $0x1,%eax
+  8022ff:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802304:	0f 44 c1             	cmove  %ecx,%eax
+  802307:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802309:	4d 85 c0             	test   %r8,%r8
+  80230c:	74 2c                	je     80233a <fschan_rw+0x6d>
+  80230e:	45 89 ce             	mov    %r9d,%r14d
+  802311:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  802318:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80231c:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802322:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802329:	00 
+  80232a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802330:	b8 01 00 00 00       	mov    $0x1,%eax
+  802335:	e9 41 01 00 00       	jmp    80247b <fschan_rw+0x1ae>
+  80233a:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80233e:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802342:	e9 9c 01 00 00       	jmp    8024e3 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  802347:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80234b:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80234e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802351:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  802354:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  802358:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  80235c:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802360:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  802364:	48 89 da             	mov    %rbx,%rdx
+  802367:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  80236e:	00 00 00 
+  802371:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802373:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  802377:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  80237e:	00 00 00 
+  802381:	ff d0                	call   *%rax
+            queued += blk;
+  802383:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802386:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80238a:	4d 39 fc             	cmp    %r15,%r12
+  80238d:	73 6b                	jae    8023fa <fschan_rw+0x12d>
+  80238f:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802393:	77 65                	ja     8023fa <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802395:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802399:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  80239d:	48 b8 e9 42 80 00 00 	movabs $0x8042e9,%rax
+  8023a4:	00 00 00 
+  8023a7:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8023a9:	4c 89 fb             	mov    %r15,%rbx
+  8023ac:	4c 29 e3             	sub    %r12,%rbx
+  8023af:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8023b4:	48 39 d3             	cmp    %rdx,%rbx
+  8023b7:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8023bb:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8023bf:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8023c3:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8023c7:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8023ca:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8023cc:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8023d3:	00 00 00 
+  8023d6:	8b 09                	mov    (%rcx),%ecx
+  8023d8:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8023db:	83 fe 03             	cmp    $0x3,%esi
+  8023de:	0f 85 63 ff ff ff    	jne    802347 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8023e4:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8023e8:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8023eb:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8023ee:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8023f1:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8023f5:	e9 79 ff ff ff       	jmp    802373 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  8023fa:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023fe:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802405:	48 89 df             	mov    %rbx,%rdi
+  802408:	48 b8 ac 43 80 00 00 	movabs $0x8043ac,%rax
+  80240f:	00 00 00 
+  802412:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802414:	48 89 df             	mov    %rbx,%rdi
+  802417:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  80241e:	00 00 00 
+  802421:	ff d0                	call   *%rax
+  802423:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  802427:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80242b:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80242f:	75 25                	jne    802456 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802431:	8b 40 04             	mov    0x4(%rax),%eax
+  802434:	85 c0                	test   %eax,%eax
+  802436:	0f 88 86 00 00 00    	js     8024c2 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80243c:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802440:	74 5b                	je     80249d <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802442:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  802446:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  80244a:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80244e:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802452:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  802456:	48 89 df             	mov    %rbx,%rdi
+  802459:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  802460:	00 00 00 
+  802463:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  802465:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802469:	83 f0 01             	xor    $0x1,%eax
+  80246c:	4d 39 fc             	cmp    %r15,%r12
+  80246f:	0f 92 c2             	setb   %dl
+  802472:	84 c2                	test   %al,%dl
+  802474:	75 05                	jne    80247b <fschan_rw+0x1ae>
+  802476:	45 85 ed             	test   %r13d,%r13d
+  802479:	74 50                	je     8024cb <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80247b:	4d 39 fc             	cmp    %r15,%r12
+  80247e:	0f 92 c1             	setb   %cl
+  802481:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802485:	0f 96 c2             	setbe  %dl
+  802488:	84 d1                	test   %dl,%cl
+  80248a:	0f 84 6a ff ff ff    	je     8023fa <fschan_rw+0x12d>
+  802490:	84 c0                	test   %al,%al
+  802492:	0f 85 fd fe ff ff    	jne    802395 <fschan_rw+0xc8>
+  802498:	e9 5d ff ff ff       	jmp    8023fa <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80249d:	48 63 d0             	movslq %eax,%rdx
+  8024a0:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024a4:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8024a8:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8024ac:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8024b0:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8024b4:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  8024bb:	00 00 00 
+  8024be:	ff d0                	call   *%rax
+  8024c0:	eb 80                	jmp    802442 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8024c2:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8024c5:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8024c9:	eb 8b                	jmp    802456 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8024cb:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8024d0:	0f 85 68 fe ff ff    	jne    80233e <fschan_rw+0x71>
+  8024d6:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8024d9:	85 c0                	test   %eax,%eax
+  8024db:	0f 84 5d fe ff ff    	je     80233e <fschan_rw+0x71>
+  8024e1:	48 98                	cltq
+}
+  8024e3:	48 83 c4 48          	add    $0x48,%rsp
+  8024e7:	5b                   	pop    %rbx
+  8024e8:	41 5c                	pop    %r12
+  8024ea:	41 5d                	pop    %r13
+  8024ec:	41 5e                	pop    %r14
+  8024ee:	41 5f                	pop    %r15
+  8024f0:	5d                   	pop    %rbp
+  8024f1:	c3                   	ret
+
+00000000008024f2 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8024f2:	55                   	push   %rbp
+  8024f3:	48 89 e5             	mov    %rsp,%rbp
+  8024f6:	41 56                	push   %r14
+  8024f8:	41 55                	push   %r13
+  8024fa:	41 54                	push   %r12
+  8024fc:	53                   	push   %rbx
+  8024fd:	48 83 ec 10          	sub    $0x10,%rsp
+  802501:	49 89 fe             	mov    %rdi,%r14
+  802504:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  802507:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80250b:	48 29 f3             	sub    %rsi,%rbx
+  80250e:	48 39 d3             	cmp    %rdx,%rbx
+  802511:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  802515:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80251c:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80251d:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802522:	49 bd 6b 41 80 00 00 	movabs $0x80416b,%r13
+  802529:	00 00 00 
+  80252c:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  802533:	76 1e                	jbe    802553 <mmap_fault+0x61>
+  802535:	4c 01 e7             	add    %r12,%rdi
+  802538:	41 ff d5             	call   *%r13
+  80253b:	84 c0                	test   %al,%al
+  80253d:	75 14                	jne    802553 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80253f:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802543:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  80254a:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80254e:	48 39 df             	cmp    %rbx,%rdi
+  802551:	72 e2                	jb     802535 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  802553:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  80255a:	00 00 00 
+  80255d:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802564:	00 00 00 
+  802567:	4c 89 f0             	mov    %r14,%rax
+  80256a:	48 29 d0             	sub    %rdx,%rax
+  80256d:	48 c1 f8 03          	sar    $0x3,%rax
+  802571:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802578:	aa aa aa 
+  80257b:	48 0f af c2          	imul   %rdx,%rax
+  80257f:	48 c1 e0 0c          	shl    $0xc,%rax
+  802583:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  802588:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80258c:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  80258e:	44 89 e0             	mov    %r12d,%eax
+  802591:	41 03 46 10          	add    0x10(%r14),%eax
+  802595:	41 2b 06             	sub    (%r14),%eax
+  802598:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80259b:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80259f:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8025a3:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8025a7:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8025aa:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  8025b1:	00 00 00 
+  8025b4:	ff d0                	call   *%rax
+  8025b6:	89 c7                	mov    %eax,%edi
+  8025b8:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025be:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025c3:	48 89 da             	mov    %rbx,%rdx
+  8025c6:	be 0f 00 00 00       	mov    $0xf,%esi
+  8025cb:	48 b8 9a 18 80 00 00 	movabs $0x80189a,%rax
+  8025d2:	00 00 00 
+  8025d5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8025d7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025dc:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8025e0:	4c 89 e6             	mov    %r12,%rsi
+  8025e3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025e8:	48 b8 76 18 80 00 00 	movabs $0x801876,%rax
+  8025ef:	00 00 00 
+  8025f2:	ff d0                	call   *%rax
+  8025f4:	48 98                	cltq
+}
+  8025f6:	48 83 c4 10          	add    $0x10,%rsp
+  8025fa:	5b                   	pop    %rbx
+  8025fb:	41 5c                	pop    %r12
+  8025fd:	41 5d                	pop    %r13
+  8025ff:	41 5e                	pop    %r14
+  802601:	5d                   	pop    %rbp
+  802602:	c3                   	ret
+
+0000000000802603 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802603:	48 8b 37             	mov    (%rdi),%rsi
+  802606:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80260d:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  802614:	00 00 00 
+  802617:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80261c:	eb 0f                	jmp    80262d <mmap_pgfault+0x2a>
+  80261e:	c3                   	ret
+  80261f:	48 83 c1 01          	add    $0x1,%rcx
+  802623:	48 83 c2 18          	add    $0x18,%rdx
+  802627:	48 83 f9 20          	cmp    $0x20,%rcx
+  80262b:	74 6e                	je     80269b <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80262d:	48 8b 02             	mov    (%rdx),%rax
+  802630:	48 83 e8 01          	sub    $0x1,%rax
+  802634:	48 39 f0             	cmp    %rsi,%rax
+  802637:	73 e6                	jae    80261f <mmap_pgfault+0x1c>
+  802639:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80263d:	73 e0                	jae    80261f <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80263f:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802643:	b8 00 00 00 00       	mov    $0x0,%eax
+  802648:	f6 c2 01             	test   $0x1,%dl
+  80264b:	75 d1                	jne    80261e <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80264d:	f6 c2 02             	test   $0x2,%dl
+  802650:	74 1a                	je     80266c <mmap_pgfault+0x69>
+  802652:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802656:	b8 00 00 00 00       	mov    $0x0,%eax
+  80265b:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802662:	00 00 00 
+  802665:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  80266a:	74 35                	je     8026a1 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  80266c:	55                   	push   %rbp
+  80266d:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802670:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802674:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80267b:	00 00 00 
+  80267e:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802682:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802687:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  80268e:	00 00 00 
+  802691:	ff d0                	call   *%rax
+  802693:	48 85 c0             	test   %rax,%rax
+  802696:	0f 9f c0             	setg   %al
+}
+  802699:	5d                   	pop    %rbp
+  80269a:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80269b:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a0:	c3                   	ret
+}
+  8026a1:	c3                   	ret
+
+00000000008026a2 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8026a2:	55                   	push   %rbp
+  8026a3:	48 89 e5             	mov    %rsp,%rbp
+  8026a6:	41 54                	push   %r12
+  8026a8:	53                   	push   %rbx
+  8026a9:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026ac:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026b3:	00 00 00 
+  8026b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8026bb:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8026bf:	74 15                	je     8026d6 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026c1:	48 83 c3 01          	add    $0x1,%rbx
+  8026c5:	48 83 c0 18          	add    $0x18,%rax
+  8026c9:	48 83 fb 20          	cmp    $0x20,%rbx
+  8026cd:	75 ec                	jne    8026bb <mmap_alloc+0x19>
+    return NULL;
+  8026cf:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026d4:	eb 52                	jmp    802728 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026d6:	4c 89 e7             	mov    %r12,%rdi
+  8026d9:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  8026e0:	00 00 00 
+  8026e3:	ff d0                	call   *%rax
+  8026e5:	41 89 c1             	mov    %eax,%r9d
+  8026e8:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8026ef:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8026f3:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8026f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8026fe:	4c 89 e6             	mov    %r12,%rsi
+  802701:	bf 00 00 00 00       	mov    $0x0,%edi
+  802706:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  80270d:	00 00 00 
+  802710:	ff d0                	call   *%rax
+  802712:	85 c0                	test   %eax,%eax
+  802714:	78 17                	js     80272d <mmap_alloc+0x8b>
+        return &mmaps[i];
+  802716:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  80271a:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802721:	00 00 00 
+  802724:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  802728:	5b                   	pop    %rbx
+  802729:	41 5c                	pop    %r12
+  80272b:	5d                   	pop    %rbp
+  80272c:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80272d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802732:	eb f4                	jmp    802728 <mmap_alloc+0x86>
+
+0000000000802734 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  802734:	55                   	push   %rbp
+  802735:	48 89 e5             	mov    %rsp,%rbp
+  802738:	41 56                	push   %r14
+  80273a:	41 55                	push   %r13
+  80273c:	41 54                	push   %r12
+  80273e:	53                   	push   %rbx
+  80273f:	48 83 ec 10          	sub    $0x10,%rsp
+  802743:	41 89 fc             	mov    %edi,%r12d
+  802746:	49 89 f5             	mov    %rsi,%r13
+  802749:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80274c:	48 89 f0             	mov    %rsi,%rax
+  80274f:	48 09 d0             	or     %rdx,%rax
+  802752:	75 0d                	jne    802761 <fsipc+0x2d>
+  802754:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  802757:	83 f8 04             	cmp    $0x4,%eax
+  80275a:	76 7d                	jbe    8027d9 <fsipc+0xa5>
+  80275c:	83 ff 0d             	cmp    $0xd,%edi
+  80275f:	74 78                	je     8027d9 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802761:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  802768:	00 00 00 
+  80276b:	ff d0                	call   *%rax
+  80276d:	89 c7                	mov    %eax,%edi
+  80276f:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802776:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  80277d:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802784:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80278a:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802791:	00 00 00 
+  802794:	44 89 e6             	mov    %r12d,%esi
+  802797:	48 b8 9a 18 80 00 00 	movabs $0x80189a,%rax
+  80279e:	00 00 00 
+  8027a1:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8027a3:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8027aa:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8027ab:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b0:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027b4:	4c 89 ee             	mov    %r13,%rsi
+  8027b7:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027bc:	48 b8 76 18 80 00 00 	movabs $0x801876,%rax
+  8027c3:	00 00 00 
+  8027c6:	ff d0                	call   *%rax
+  8027c8:	89 c3                	mov    %eax,%ebx
+}
+  8027ca:	89 d8                	mov    %ebx,%eax
+  8027cc:	48 83 c4 10          	add    $0x10,%rsp
+  8027d0:	5b                   	pop    %rbx
+  8027d1:	41 5c                	pop    %r12
+  8027d3:	41 5d                	pop    %r13
+  8027d5:	41 5e                	pop    %r14
+  8027d7:	5d                   	pop    %rbp
+  8027d8:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027d9:	48 b8 e6 21 80 00 00 	movabs $0x8021e6,%rax
+  8027e0:	00 00 00 
+  8027e3:	ff d0                	call   *%rax
+  8027e5:	49 89 c6             	mov    %rax,%r14
+  8027e8:	48 85 c0             	test   %rax,%rax
+  8027eb:	0f 84 70 ff ff ff    	je     802761 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8027f1:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8027f5:	48 b8 e9 42 80 00 00 	movabs $0x8042e9,%rax
+  8027fc:	00 00 00 
+  8027ff:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802801:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802804:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80280b:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80280f:	ba 10 00 00 00       	mov    $0x10,%edx
+  802814:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80281b:	00 00 00 
+  80281e:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802825:	00 00 00 
+  802828:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  80282a:	4c 89 f7             	mov    %r14,%rdi
+  80282d:	48 b8 82 22 80 00 00 	movabs $0x802282,%rax
+  802834:	00 00 00 
+  802837:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802839:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802840:	4c 89 f7             	mov    %r14,%rdi
+  802843:	48 b8 ac 43 80 00 00 	movabs $0x8043ac,%rax
+  80284a:	00 00 00 
+  80284d:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80284f:	4c 89 f7             	mov    %r14,%rdi
+  802852:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  802859:	00 00 00 
+  80285c:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  80285e:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802861:	41 83 fc 05          	cmp    $0x5,%r12d
+  802865:	75 04                	jne    80286b <fsipc+0x137>
+  802867:	85 db                	test   %ebx,%ebx
+  802869:	79 14                	jns    80287f <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  80286b:	4c 89 f7             	mov    %r14,%rdi
+  80286e:	48 b8 61 43 80 00 00 	movabs $0x804361,%rax
+  802875:	00 00 00 
+  802878:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80287a:	e9 4b ff ff ff       	jmp    8027ca <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  80287f:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802883:	ba 88 00 00 00       	mov    $0x88,%edx
+  802888:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80288f:	00 00 00 
+  802892:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802899:	00 00 00 
+  80289c:	ff d0                	call   *%rax
+  80289e:	eb cb                	jmp    80286b <fsipc+0x137>
+
+00000000008028a0 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028a0:	55                   	push   %rbp
+  8028a1:	48 89 e5             	mov    %rsp,%rbp
+  8028a4:	41 57                	push   %r15
+  8028a6:	41 56                	push   %r14
+  8028a8:	41 55                	push   %r13
+  8028aa:	41 54                	push   %r12
+  8028ac:	53                   	push   %rbx
+  8028ad:	48 83 ec 18          	sub    $0x18,%rsp
+  8028b1:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8028b5:	49 89 f6             	mov    %rsi,%r14
+  8028b8:	49 89 d4             	mov    %rdx,%r12
+  8028bb:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8028be:	48 b8 e6 21 80 00 00 	movabs $0x8021e6,%rax
+  8028c5:	00 00 00 
+  8028c8:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028ca:	48 85 c0             	test   %rax,%rax
+  8028cd:	0f 85 96 00 00 00    	jne    802969 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8028d3:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8028da:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028db:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8028e2:	00 00 00 
+    while (n) {
+  8028e5:	4d 85 e4             	test   %r12,%r12
+  8028e8:	74 79                	je     802963 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8028ea:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8028ef:	49 39 dc             	cmp    %rbx,%r12
+  8028f2:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8028f6:	48 89 da             	mov    %rbx,%rdx
+  8028f9:	4c 89 f6             	mov    %r14,%rsi
+  8028fc:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802903:	00 00 00 
+  802906:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  80290d:	00 00 00 
+  802910:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802912:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  802916:	8b 40 0c             	mov    0xc(%rax),%eax
+  802919:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80291c:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80291f:	44 01 e8             	add    %r13d,%eax
+  802922:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  802926:	41 0f 44 c5          	cmove  %r13d,%eax
+  80292a:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80292e:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802932:	48 89 da             	mov    %rbx,%rdx
+  802935:	be 00 00 00 00       	mov    $0x0,%esi
+  80293a:	bf 04 00 00 00       	mov    $0x4,%edi
+  80293f:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  802946:	00 00 00 
+  802949:	ff d0                	call   *%rax
+        if (res < 0)
+  80294b:	85 c0                	test   %eax,%eax
+  80294d:	78 4a                	js     802999 <devfile_write_direct+0xf9>
+        buf += res;
+  80294f:	48 98                	cltq
+  802951:	49 01 c6             	add    %rax,%r14
+        write += res;
+  802954:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  802958:	49 29 c4             	sub    %rax,%r12
+  80295b:	75 8d                	jne    8028ea <devfile_write_direct+0x4a>
+    return write;
+  80295d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802961:	eb 27                	jmp    80298a <devfile_write_direct+0xea>
+    size_t write = 0;
+  802963:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  802967:	eb f4                	jmp    80295d <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802969:	45 89 e9             	mov    %r13d,%r9d
+  80296c:	4d 89 e0             	mov    %r12,%r8
+  80296f:	4c 89 f1             	mov    %r14,%rcx
+  802972:	ba 04 00 00 00       	mov    $0x4,%edx
+  802977:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80297b:	48 89 c7             	mov    %rax,%rdi
+  80297e:	48 b8 cd 22 80 00 00 	movabs $0x8022cd,%rax
+  802985:	00 00 00 
+  802988:	ff d0                	call   *%rax
+}
+  80298a:	48 83 c4 18          	add    $0x18,%rsp
+  80298e:	5b                   	pop    %rbx
+  80298f:	41 5c                	pop    %r12
+  802991:	41 5d                	pop    %r13
+  802993:	41 5e                	pop    %r14
+  802995:	41 5f                	pop    %r15
+  802997:	5d                   	pop    %rbp
+  802998:	c3                   	ret
+            return res;
+  802999:	48 98                	cltq
+  80299b:	eb ed                	jmp    80298a <devfile_write_direct+0xea>
+
+000000000080299d <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  80299d:	55                   	push   %rbp
+  80299e:	48 89 e5             	mov    %rsp,%rbp
+  8029a1:	41 54                	push   %r12
+  8029a3:	53                   	push   %rbx
+  8029a4:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8029a7:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  8029ae:	00 00 00 
+  8029b1:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8029b3:	48 85 c0             	test   %rax,%rax
+  8029b6:	74 71                	je     802a29 <fbuf_flush+0x8c>
+  8029b8:	48 89 c3             	mov    %rax,%rbx
+  8029bb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c0:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8029c4:	75 05                	jne    8029cb <fbuf_flush+0x2e>
+}
+  8029c6:	5b                   	pop    %rbx
+  8029c7:	41 5c                	pop    %r12
+  8029c9:	5d                   	pop    %rbp
+  8029ca:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8029cb:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8029ce:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8029d2:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029d9:	00 00 00 
+  8029dc:	48 89 de             	mov    %rbx,%rsi
+  8029df:	48 29 c6             	sub    %rax,%rsi
+  8029e2:	48 c1 fe 03          	sar    $0x3,%rsi
+  8029e6:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8029ed:	aa aa aa 
+  8029f0:	48 0f af f0          	imul   %rax,%rsi
+  8029f4:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8029f8:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8029fd:	48 01 c6             	add    %rax,%rsi
+  802a00:	4c 89 e7             	mov    %r12,%rdi
+  802a03:	48 b8 a0 28 80 00 00 	movabs $0x8028a0,%rax
+  802a0a:	00 00 00 
+  802a0d:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802a0f:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802a13:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802a1a:	00 
+    return res < 0 ? res : 0;
+  802a1b:	48 85 c0             	test   %rax,%rax
+  802a1e:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a23:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802a27:	eb 9d                	jmp    8029c6 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802a29:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a2e:	eb 96                	jmp    8029c6 <fbuf_flush+0x29>
+
+0000000000802a30 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802a30:	55                   	push   %rbp
+  802a31:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802a34:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802a3b:	00 00 00 
+  802a3e:	ff d0                	call   *%rax
+}
+  802a40:	5d                   	pop    %rbp
+  802a41:	c3                   	ret
+
+0000000000802a42 <devfile_write>:
+    if (!fd || !buf)
+  802a42:	48 85 ff             	test   %rdi,%rdi
+  802a45:	0f 84 d3 01 00 00    	je     802c1e <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802a4b:	55                   	push   %rbp
+  802a4c:	48 89 e5             	mov    %rsp,%rbp
+  802a4f:	41 57                	push   %r15
+  802a51:	41 56                	push   %r14
+  802a53:	41 55                	push   %r13
+  802a55:	41 54                	push   %r12
+  802a57:	53                   	push   %rbx
+  802a58:	48 83 ec 08          	sub    $0x8,%rsp
+  802a5c:	49 89 fc             	mov    %rdi,%r12
+  802a5f:	49 89 f6             	mov    %rsi,%r14
+  802a62:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802a65:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a6a:	48 85 f6             	test   %rsi,%rsi
+  802a6d:	0f 84 9c 01 00 00    	je     802c0f <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a73:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  802a7a:	00 00 00 
+  802a7d:	ff d0                	call   *%rax
+  802a7f:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a82:	48 85 c0             	test   %rax,%rax
+  802a85:	0f 84 a2 00 00 00    	je     802b2d <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a8b:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a90:	4c 89 e7             	mov    %r12,%rdi
+  802a93:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  802a9a:	00 00 00 
+  802a9d:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802a9f:	83 f8 02             	cmp    $0x2,%eax
+  802aa2:	0f 8f 85 00 00 00    	jg     802b2d <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802aa8:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802aaf:	00 00 00 
+  802ab2:	4d 89 ef             	mov    %r13,%r15
+  802ab5:	49 29 c7             	sub    %rax,%r15
+  802ab8:	49 c1 ff 03          	sar    $0x3,%r15
+  802abc:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802ac3:	aa aa aa 
+  802ac6:	4c 0f af f8          	imul   %rax,%r15
+  802aca:	49 c1 e7 0e          	shl    $0xe,%r15
+  802ace:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ad3:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802ad6:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802adb:	0f 84 d7 00 00 00    	je     802bb8 <devfile_write+0x176>
+  802ae1:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802ae5:	89 c2                	mov    %eax,%edx
+  802ae7:	41 03 55 0c          	add    0xc(%r13),%edx
+  802aeb:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802af0:	75 0f                	jne    802b01 <devfile_write+0xbf>
+  802af2:	48 01 d8             	add    %rbx,%rax
+  802af5:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802afb:	0f 86 92 00 00 00    	jbe    802b93 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b01:	4c 89 e7             	mov    %r12,%rdi
+  802b04:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802b0b:	00 00 00 
+  802b0e:	ff d0                	call   *%rax
+  802b10:	85 c0                	test   %eax,%eax
+  802b12:	78 52                	js     802b66 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b14:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b1b:	77 7f                	ja     802b9c <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802b1d:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b22:	0f 85 c2 00 00 00    	jne    802bea <devfile_write+0x1a8>
+  802b28:	e9 94 00 00 00       	jmp    802bc1 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802b2d:	4c 89 e7             	mov    %r12,%rdi
+  802b30:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802b37:	00 00 00 
+  802b3a:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b3c:	85 c0                	test   %eax,%eax
+  802b3e:	79 07                	jns    802b47 <devfile_write+0x105>
+  802b40:	48 98                	cltq
+  802b42:	e9 c8 00 00 00       	jmp    802c0f <devfile_write+0x1cd>
+  802b47:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b4c:	48 89 da             	mov    %rbx,%rdx
+  802b4f:	4c 89 f6             	mov    %r14,%rsi
+  802b52:	4c 89 e7             	mov    %r12,%rdi
+  802b55:	48 b8 a0 28 80 00 00 	movabs $0x8028a0,%rax
+  802b5c:	00 00 00 
+  802b5f:	ff d0                	call   *%rax
+  802b61:	e9 a9 00 00 00       	jmp    802c0f <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b66:	48 98                	cltq
+  802b68:	e9 a2 00 00 00       	jmp    802c0f <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b6d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b72:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b77:	4c 89 fe             	mov    %r15,%rsi
+  802b7a:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b7f:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  802b86:	00 00 00 
+  802b89:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b8b:	85 c0                	test   %eax,%eax
+  802b8d:	79 45                	jns    802bd4 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b8f:	48 98                	cltq
+  802b91:	eb 7c                	jmp    802c0f <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b93:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b9a:	76 4e                	jbe    802bea <devfile_write+0x1a8>
+  802b9c:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ba1:	48 89 da             	mov    %rbx,%rdx
+  802ba4:	4c 89 f6             	mov    %r14,%rsi
+  802ba7:	4c 89 e7             	mov    %r12,%rdi
+  802baa:	48 b8 a0 28 80 00 00 	movabs $0x8028a0,%rax
+  802bb1:	00 00 00 
+  802bb4:	ff d0                	call   *%rax
+  802bb6:	eb 57                	jmp    802c0f <devfile_write+0x1cd>
+  802bb8:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bbf:	77 db                	ja     802b9c <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802bc1:	4c 89 ff             	mov    %r15,%rdi
+  802bc4:	48 b8 6b 41 80 00 00 	movabs $0x80416b,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+  802bd0:	84 c0                	test   %al,%al
+  802bd2:	74 99                	je     802b6d <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802bd4:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802bd9:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802bde:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802be2:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802be9:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802bea:	4c 89 ff             	mov    %r15,%rdi
+  802bed:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802bf1:	48 89 da             	mov    %rbx,%rdx
+  802bf4:	4c 89 f6             	mov    %r14,%rsi
+  802bf7:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802bfe:	00 00 00 
+  802c01:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802c03:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802c07:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802c0c:	48 89 d8             	mov    %rbx,%rax
+}
+  802c0f:	48 83 c4 08          	add    $0x8,%rsp
+  802c13:	5b                   	pop    %rbx
+  802c14:	41 5c                	pop    %r12
+  802c16:	41 5d                	pop    %r13
+  802c18:	41 5e                	pop    %r14
+  802c1a:	41 5f                	pop    %r15
+  802c1c:	5d                   	pop    %rbp
+  802c1d:	c3                   	ret
+        return E_INVAL;
+  802c1e:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c23:	c3                   	ret
+
+0000000000802c24 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c24:	55                   	push   %rbp
+  802c25:	48 89 e5             	mov    %rsp,%rbp
+  802c28:	41 54                	push   %r12
+  802c2a:	53                   	push   %rbx
+  802c2b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802c2e:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802c35:	00 00 00 
+  802c38:	ff d0                	call   *%rax
+  802c3a:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802c3d:	48 89 df             	mov    %rbx,%rdi
+  802c40:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  802c47:	00 00 00 
+  802c4a:	ff d0                	call   *%rax
+  802c4c:	48 85 c0             	test   %rax,%rax
+  802c4f:	74 17                	je     802c68 <devfile_flush+0x44>
+  802c51:	48 89 df             	mov    %rbx,%rdi
+  802c54:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  802c5b:	00 00 00 
+  802c5e:	ff d0                	call   *%rax
+  802c60:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802c67:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c68:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c6b:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c72:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c74:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c79:	be 00 00 00 00       	mov    $0x0,%esi
+  802c7e:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c83:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  802c8a:	00 00 00 
+  802c8d:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c8f:	45 85 e4             	test   %r12d,%r12d
+  802c92:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c96:	5b                   	pop    %rbx
+  802c97:	41 5c                	pop    %r12
+  802c99:	5d                   	pop    %rbp
+  802c9a:	c3                   	ret
+
+0000000000802c9b <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802c9b:	55                   	push   %rbp
+  802c9c:	48 89 e5             	mov    %rsp,%rbp
+  802c9f:	41 57                	push   %r15
+  802ca1:	41 56                	push   %r14
+  802ca3:	41 55                	push   %r13
+  802ca5:	41 54                	push   %r12
+  802ca7:	53                   	push   %rbx
+  802ca8:	48 83 ec 38          	sub    $0x38,%rsp
+  802cac:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802cb0:	49 89 f7             	mov    %rsi,%r15
+  802cb3:	48 89 d3             	mov    %rdx,%rbx
+  802cb6:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802cb9:	48 b8 e6 21 80 00 00 	movabs $0x8021e6,%rax
+  802cc0:	00 00 00 
+  802cc3:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802cc5:	48 85 c0             	test   %rax,%rax
+  802cc8:	75 20                	jne    802cea <devfile_read_direct+0x4f>
+    bool map = 1;
+  802cca:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802ccf:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802cd6:	00 
+    while (n) {
+  802cd7:	48 85 db             	test   %rbx,%rbx
+  802cda:	0f 85 df 00 00 00    	jne    802dbf <devfile_read_direct+0x124>
+    size_t read = 0;
+  802ce0:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802ce4:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ce8:	eb 21                	jmp    802d0b <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802cea:	45 89 f1             	mov    %r14d,%r9d
+  802ced:	49 89 d8             	mov    %rbx,%r8
+  802cf0:	4c 89 f9             	mov    %r15,%rcx
+  802cf3:	ba 03 00 00 00       	mov    $0x3,%edx
+  802cf8:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802cfc:	48 89 c7             	mov    %rax,%rdi
+  802cff:	48 b8 cd 22 80 00 00 	movabs $0x8022cd,%rax
+  802d06:	00 00 00 
+  802d09:	ff d0                	call   *%rax
+}
+  802d0b:	48 83 c4 38          	add    $0x38,%rsp
+  802d0f:	5b                   	pop    %rbx
+  802d10:	41 5c                	pop    %r12
+  802d12:	41 5d                	pop    %r13
+  802d14:	41 5e                	pop    %r14
+  802d16:	41 5f                	pop    %r15
+  802d18:	5d                   	pop    %rbp
+  802d19:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d1a:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d1e:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d24:	75 1e                	jne    802d44 <devfile_read_direct+0xa9>
+  802d26:	e9 e2 00 00 00       	jmp    802e0d <devfile_read_direct+0x172>
+            if (!res) return read;
+  802d2b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d2f:	eb da                	jmp    802d0b <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802d31:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802d35:	0f 85 d0 01 00 00    	jne    802f0b <devfile_read_direct+0x270>
+            map = 0;
+  802d3b:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d3f:	eb 03                	jmp    802d44 <devfile_read_direct+0xa9>
+  802d41:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802d44:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802d49:	48 39 d3             	cmp    %rdx,%rbx
+  802d4c:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d50:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d54:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d57:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802d5e:	00 00 00 
+  802d61:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802d63:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802d67:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d6b:	be 00 00 00 00       	mov    $0x0,%esi
+  802d70:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d75:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  802d7c:	00 00 00 
+  802d7f:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d81:	85 c0                	test   %eax,%eax
+  802d83:	0f 8e 63 01 00 00    	jle    802eec <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d89:	4c 63 e0             	movslq %eax,%r12
+  802d8c:	4c 89 e2             	mov    %r12,%rdx
+  802d8f:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d96:	00 00 00 
+  802d99:	4c 89 ff             	mov    %r15,%rdi
+  802d9c:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  802da3:	00 00 00 
+  802da6:	ff d0                	call   *%rax
+        buf += res;
+  802da8:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802dab:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802dae:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802db2:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802db6:	48 85 db             	test   %rbx,%rbx
+  802db9:	0f 84 25 ff ff ff    	je     802ce4 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802dbf:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802dc2:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802dc6:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802dca:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802dce:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802dd5:	0f 97 c2             	seta   %dl
+  802dd8:	20 c2                	and    %al,%dl
+  802dda:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802ddd:	0f 84 5e ff ff ff    	je     802d41 <devfile_read_direct+0xa6>
+  802de3:	4c 89 fa             	mov    %r15,%rdx
+  802de6:	4d 89 fd             	mov    %r15,%r13
+  802de9:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802df0:	0f 85 4e ff ff ff    	jne    802d44 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802df6:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802dfa:	0f 84 1a ff ff ff    	je     802d1a <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e00:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e07:	0f 85 37 ff ff ff    	jne    802d44 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802e0d:	48 89 d8             	mov    %rbx,%rax
+  802e10:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e16:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802e1b:	48 39 c8             	cmp    %rcx,%rax
+  802e1e:	48 0f 47 c1          	cmova  %rcx,%rax
+  802e22:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802e26:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802e2a:	49 89 d4             	mov    %rdx,%r12
+  802e2d:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802e31:	48 b8 0c 41 80 00 00 	movabs $0x80410c,%rax
+  802e38:	00 00 00 
+  802e3b:	ff d0                	call   *%rax
+  802e3d:	a8 40                	test   $0x40,%al
+  802e3f:	0f 85 b9 00 00 00    	jne    802efe <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802e45:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802e4c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e50:	49 39 c5             	cmp    %rax,%r13
+  802e53:	72 d8                	jb     802e2d <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e55:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e59:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e60:	00 00 00 
+  802e63:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e67:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802e6a:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e6c:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e70:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e74:	48 b8 81 20 80 00 00 	movabs $0x802081,%rax
+  802e7b:	00 00 00 
+  802e7e:	ff d0                	call   *%rax
+  802e80:	89 c7                	mov    %eax,%edi
+  802e82:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e88:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e8d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e94:	00 00 00 
+  802e97:	be 0e 00 00 00       	mov    $0xe,%esi
+  802e9c:	48 b8 9a 18 80 00 00 	movabs $0x80189a,%rax
+  802ea3:	00 00 00 
+  802ea6:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802ea8:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ead:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802eb1:	4c 89 fe             	mov    %r15,%rsi
+  802eb4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802eb9:	48 b8 76 18 80 00 00 	movabs $0x801876,%rax
+  802ec0:	00 00 00 
+  802ec3:	ff d0                	call   *%rax
+  802ec5:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ec8:	48 85 d2             	test   %rdx,%rdx
+  802ecb:	0f 84 5a fe ff ff    	je     802d2b <devfile_read_direct+0x90>
+            if (res > 0) {
+  802ed1:	0f 8e 5a fe ff ff    	jle    802d31 <devfile_read_direct+0x96>
+                buf += res;
+  802ed7:	48 98                	cltq
+  802ed9:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802edc:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802edf:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802ee3:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802ee7:	e9 ca fe ff ff       	jmp    802db6 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802eec:	41 89 c5             	mov    %eax,%r13d
+  802eef:	48 98                	cltq
+  802ef1:	45 85 ed             	test   %r13d,%r13d
+  802ef4:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802ef9:	e9 0d fe ff ff       	jmp    802d0b <devfile_read_direct+0x70>
+            map = 0;
+  802efe:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f02:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f06:	e9 39 fe ff ff       	jmp    802d44 <devfile_read_direct+0xa9>
+  802f0b:	48 89 d0             	mov    %rdx,%rax
+  802f0e:	e9 f8 fd ff ff       	jmp    802d0b <devfile_read_direct+0x70>
+
+0000000000802f13 <devfile_read>:
+    if (!fd || !buf)
+  802f13:	48 85 ff             	test   %rdi,%rdi
+  802f16:	0f 84 21 02 00 00    	je     80313d <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f1c:	55                   	push   %rbp
+  802f1d:	48 89 e5             	mov    %rsp,%rbp
+  802f20:	41 57                	push   %r15
+  802f22:	41 56                	push   %r14
+  802f24:	41 55                	push   %r13
+  802f26:	41 54                	push   %r12
+  802f28:	53                   	push   %rbx
+  802f29:	48 83 ec 28          	sub    $0x28,%rsp
+  802f2d:	48 89 fb             	mov    %rdi,%rbx
+  802f30:	49 89 f4             	mov    %rsi,%r12
+  802f33:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802f36:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802f3b:	48 85 f6             	test   %rsi,%rsi
+  802f3e:	74 4b                	je     802f8b <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802f40:	48 b8 50 22 80 00 00 	movabs $0x802250,%rax
+  802f47:	00 00 00 
+  802f4a:	ff d0                	call   *%rax
+  802f4c:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f4f:	48 85 c0             	test   %rax,%rax
+  802f52:	74 22                	je     802f76 <devfile_read+0x63>
+  802f54:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802f5b:	77 19                	ja     802f76 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802f5d:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f62:	48 89 df             	mov    %rbx,%rdi
+  802f65:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  802f6c:	00 00 00 
+  802f6f:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f71:	83 f8 02             	cmp    $0x2,%eax
+  802f74:	7e 40                	jle    802fb6 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f76:	48 89 df             	mov    %rbx,%rdi
+  802f79:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802f80:	00 00 00 
+  802f83:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f85:	85 c0                	test   %eax,%eax
+  802f87:	79 11                	jns    802f9a <devfile_read+0x87>
+  802f89:	48 98                	cltq
+}
+  802f8b:	48 83 c4 28          	add    $0x28,%rsp
+  802f8f:	5b                   	pop    %rbx
+  802f90:	41 5c                	pop    %r12
+  802f92:	41 5d                	pop    %r13
+  802f94:	41 5e                	pop    %r14
+  802f96:	41 5f                	pop    %r15
+  802f98:	5d                   	pop    %rbp
+  802f99:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f9a:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802f9f:	4c 89 ea             	mov    %r13,%rdx
+  802fa2:	4c 89 e6             	mov    %r12,%rsi
+  802fa5:	48 89 df             	mov    %rbx,%rdi
+  802fa8:	48 b8 9b 2c 80 00 00 	movabs $0x802c9b,%rax
+  802faf:	00 00 00 
+  802fb2:	ff d0                	call   *%rax
+  802fb4:	eb d5                	jmp    802f8b <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802fb6:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802fba:	48 89 df             	mov    %rbx,%rdi
+  802fbd:	48 b8 9d 29 80 00 00 	movabs $0x80299d,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+  802fc9:	85 c0                	test   %eax,%eax
+  802fcb:	0f 88 33 01 00 00    	js     803104 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802fd1:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802fd8:	00 00 00 
+  802fdb:	4c 89 f0             	mov    %r14,%rax
+  802fde:	48 29 d0             	sub    %rdx,%rax
+  802fe1:	48 c1 f8 03          	sar    $0x3,%rax
+  802fe5:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802fec:	aa aa aa 
+  802fef:	48 0f af c2          	imul   %rdx,%rax
+  802ff3:	48 c1 e0 0e          	shl    $0xe,%rax
+  802ff7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ffb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802ffe:	41 39 06             	cmp    %eax,(%r14)
+  803001:	75 0d                	jne    803010 <devfile_read+0xfd>
+  803003:	8b 43 10             	mov    0x10(%rbx),%eax
+  803006:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  80300a:	0f 84 fb 00 00 00    	je     80310b <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803010:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803015:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803019:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  80301c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803020:	48 89 c7             	mov    %rax,%rdi
+  803023:	48 b8 6b 41 80 00 00 	movabs $0x80416b,%rax
+  80302a:	00 00 00 
+  80302d:	ff d0                	call   *%rax
+  80302f:	84 c0                	test   %al,%al
+  803031:	75 27                	jne    80305a <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803033:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803038:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80303d:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803041:	bf 00 00 00 00       	mov    $0x0,%edi
+  803046:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  80304d:	00 00 00 
+  803050:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803052:	85 c0                	test   %eax,%eax
+  803054:	0f 88 dc 00 00 00    	js     803136 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  80305a:	44 89 f8             	mov    %r15d,%eax
+  80305d:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803062:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803064:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  80306b:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  80306c:	8b 43 10             	mov    0x10(%rbx),%eax
+  80306f:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803073:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803076:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80307b:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80307f:	48 89 df             	mov    %rbx,%rdi
+  803082:	48 b8 9b 2c 80 00 00 	movabs $0x802c9b,%rax
+  803089:	00 00 00 
+  80308c:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  80308e:	48 85 c0             	test   %rax,%rax
+  803091:	0f 88 f4 fe ff ff    	js     802f8b <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803097:	8b 53 0c             	mov    0xc(%rbx),%edx
+  80309a:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  80309d:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8030a0:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8030a4:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8030a8:	48 63 d1             	movslq %ecx,%rdx
+  8030ab:	48 01 d0             	add    %rdx,%rax
+  8030ae:	4d 63 ff             	movslq %r15d,%r15
+  8030b1:	4c 29 f8             	sub    %r15,%rax
+  8030b4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030b9:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8030bd:	48 85 c0             	test   %rax,%rax
+  8030c0:	0f 8e c5 fe ff ff    	jle    802f8b <devfile_read+0x78>
+    n = MIN(n, res);
+  8030c6:	4c 39 e8             	cmp    %r13,%rax
+  8030c9:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  8030cd:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030d0:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8030d4:	48 63 f6             	movslq %esi,%rsi
+  8030d7:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030dc:	48 01 c6             	add    %rax,%rsi
+  8030df:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e3:	48 01 c6             	add    %rax,%rsi
+  8030e6:	4c 89 ea             	mov    %r13,%rdx
+  8030e9:	4c 89 e7             	mov    %r12,%rdi
+  8030ec:	48 b8 37 0f 80 00 00 	movabs $0x800f37,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8030f8:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  8030fc:	4c 89 e8             	mov    %r13,%rax
+  8030ff:	e9 87 fe ff ff       	jmp    802f8b <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803104:	48 98                	cltq
+  803106:	e9 80 fe ff ff       	jmp    802f8b <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80310b:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  80310f:	41 39 d7             	cmp    %edx,%r15d
+  803112:	0f 8c f8 fe ff ff    	jl     803010 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803118:	49 8b 46 10          	mov    0x10(%r14),%rax
+  80311c:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  80311f:	41 39 cf             	cmp    %ecx,%r15d
+  803122:	0f 8d e8 fe ff ff    	jge    803010 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803128:	4d 63 ff             	movslq %r15d,%r15
+  80312b:	4c 29 f8             	sub    %r15,%rax
+  80312e:	48 63 d2             	movslq %edx,%rdx
+  803131:	48 01 d0             	add    %rdx,%rax
+  803134:	eb 87                	jmp    8030bd <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803136:	48 98                	cltq
+  803138:	e9 4e fe ff ff       	jmp    802f8b <devfile_read+0x78>
+        return E_INVAL;
+  80313d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803142:	c3                   	ret
+
+0000000000803143 <fs_channel>:
+fs_channel(bool enable) {
+  803143:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803145:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  80314c:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  80314e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803153:	40 84 ff             	test   %dil,%dil
+  803156:	74 47                	je     80319f <fs_channel+0x5c>
+  803158:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80315f:	00 00 00 
+  803162:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803168:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  80316f:	00 00 00 
+  803172:	3b 08                	cmp    (%rax),%ecx
+  803174:	74 29                	je     80319f <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803176:	55                   	push   %rbp
+  803177:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  80317a:	48 b8 c3 20 80 00 00 	movabs $0x8020c3,%rax
+  803181:	00 00 00 
+  803184:	ff d0                	call   *%rax
+  803186:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803188:	85 c0                	test   %eax,%eax
+  80318a:	78 04                	js     803190 <fs_channel+0x4d>
+}
+  80318c:	89 d0                	mov    %edx,%eax
+  80318e:	5d                   	pop    %rbp
+  80318f:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803190:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803197:	00 00 00 
+  80319a:	c6 00 00             	movb   $0x0,(%rax)
+  80319d:	eb ed                	jmp    80318c <fs_channel+0x49>
+}
+  80319f:	89 d0                	mov    %edx,%eax
+  8031a1:	c3                   	ret
+
+00000000008031a2 <open>:
+open(const char *path, int mode) {
+  8031a2:	55                   	push   %rbp
+  8031a3:	48 89 e5             	mov    %rsp,%rbp
+  8031a6:	41 55                	push   %r13
+  8031a8:	41 54                	push   %r12
+  8031aa:	53                   	push   %rbx
+  8031ab:	48 83 ec 18          	sub    $0x18,%rsp
+  8031af:	49 89 fc             	mov    %rdi,%r12
+  8031b2:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031b5:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  8031bc:	00 00 00 
+  8031bf:	ff d0                	call   *%rax
+  8031c1:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031c7:	0f 87 8f 00 00 00    	ja     80325c <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031cd:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031d1:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8031d8:	00 00 00 
+  8031db:	ff d0                	call   *%rax
+  8031dd:	89 c3                	mov    %eax,%ebx
+  8031df:	85 c0                	test   %eax,%eax
+  8031e1:	78 55                	js     803238 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8031e3:	4c 89 e6             	mov    %r12,%rsi
+  8031e6:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8031ed:	00 00 00 
+  8031f0:	48 89 df             	mov    %rbx,%rdi
+  8031f3:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  8031fa:	00 00 00 
+  8031fd:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  8031ff:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803206:	ba 00 00 00 00       	mov    $0x0,%edx
+  80320b:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  80320f:	bf 01 00 00 00       	mov    $0x1,%edi
+  803214:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  80321b:	00 00 00 
+  80321e:	ff d0                	call   *%rax
+  803220:	89 c3                	mov    %eax,%ebx
+  803222:	85 c0                	test   %eax,%eax
+  803224:	78 1f                	js     803245 <open+0xa3>
+    return fd2num(fd);
+  803226:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80322a:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  803231:	00 00 00 
+  803234:	ff d0                	call   *%rax
+  803236:	89 c3                	mov    %eax,%ebx
+}
+  803238:	89 d8                	mov    %ebx,%eax
+  80323a:	48 83 c4 18          	add    $0x18,%rsp
+  80323e:	5b                   	pop    %rbx
+  80323f:	41 5c                	pop    %r12
+  803241:	41 5d                	pop    %r13
+  803243:	5d                   	pop    %rbp
+  803244:	c3                   	ret
+        fd_close(fd, 0);
+  803245:	be 00 00 00 00       	mov    $0x0,%esi
+  80324a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80324e:	48 b8 98 1a 80 00 00 	movabs $0x801a98,%rax
+  803255:	00 00 00 
+  803258:	ff d0                	call   *%rax
+        return res;
+  80325a:	eb dc                	jmp    803238 <open+0x96>
+        return -E_BAD_PATH;
+  80325c:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803261:	eb d5                	jmp    803238 <open+0x96>
+
+0000000000803263 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803263:	55                   	push   %rbp
+  803264:	48 89 e5             	mov    %rsp,%rbp
+  803267:	41 56                	push   %r14
+  803269:	41 55                	push   %r13
+  80326b:	41 54                	push   %r12
+  80326d:	53                   	push   %rbx
+  80326e:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803272:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803279:	00 00 00 
+  80327c:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803281:	49 bd dd 19 80 00 00 	movabs $0x8019dd,%r13
+  803288:	00 00 00 
+  80328b:	49 be 9d 29 80 00 00 	movabs $0x80299d,%r14
+  803292:	00 00 00 
+  803295:	eb 0c                	jmp    8032a3 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803297:	83 c3 01             	add    $0x1,%ebx
+  80329a:	49 83 c4 18          	add    $0x18,%r12
+  80329e:	83 fb 20             	cmp    $0x20,%ebx
+  8032a1:	74 1d                	je     8032c0 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032a3:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8032a8:	74 ed                	je     803297 <file_flush_buffers+0x34>
+  8032aa:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032ae:	89 df                	mov    %ebx,%edi
+  8032b0:	41 ff d5             	call   *%r13
+  8032b3:	85 c0                	test   %eax,%eax
+  8032b5:	78 e0                	js     803297 <file_flush_buffers+0x34>
+  8032b7:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032bb:	41 ff d6             	call   *%r14
+  8032be:	eb d7                	jmp    803297 <file_flush_buffers+0x34>
+}
+  8032c0:	48 83 c4 10          	add    $0x10,%rsp
+  8032c4:	5b                   	pop    %rbx
+  8032c5:	41 5c                	pop    %r12
+  8032c7:	41 5d                	pop    %r13
+  8032c9:	41 5e                	pop    %r14
+  8032cb:	5d                   	pop    %rbp
+  8032cc:	c3                   	ret
+
+00000000008032cd <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8032cd:	55                   	push   %rbp
+  8032ce:	48 89 e5             	mov    %rsp,%rbp
+  8032d1:	41 54                	push   %r12
+  8032d3:	53                   	push   %rbx
+  8032d4:	49 89 fc             	mov    %rdi,%r12
+  8032d7:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8032d9:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  8032e0:	00 00 00 
+  8032e3:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8032e5:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032ec:	00 00 00 
+  8032ef:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8032f4:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8032f6:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  8032f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032fe:	be 00 00 00 00       	mov    $0x0,%esi
+  803303:	bf 02 00 00 00       	mov    $0x2,%edi
+  803308:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  80330f:	00 00 00 
+  803312:	ff d0                	call   *%rax
+}
+  803314:	5b                   	pop    %rbx
+  803315:	41 5c                	pop    %r12
+  803317:	5d                   	pop    %rbp
+  803318:	c3                   	ret
+
+0000000000803319 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803319:	55                   	push   %rbp
+  80331a:	48 89 e5             	mov    %rsp,%rbp
+  80331d:	41 54                	push   %r12
+  80331f:	53                   	push   %rbx
+  803320:	49 89 fc             	mov    %rdi,%r12
+  803323:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  803326:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  80332d:	00 00 00 
+  803330:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803332:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  803337:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80333e:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803340:	ba 00 00 00 00       	mov    $0x0,%edx
+  803345:	be 00 00 00 00       	mov    $0x0,%esi
+  80334a:	bf 05 00 00 00       	mov    $0x5,%edi
+  80334f:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  803356:	00 00 00 
+  803359:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80335b:	85 c0                	test   %eax,%eax
+  80335d:	78 3d                	js     80339c <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  80335f:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  803366:	00 00 00 
+  803369:	4c 89 e6             	mov    %r12,%rsi
+  80336c:	48 89 df             	mov    %rbx,%rdi
+  80336f:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  803376:	00 00 00 
+  803379:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80337b:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803382:	00 
+  803383:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803389:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803390:	00 
+  803391:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  803397:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80339c:	5b                   	pop    %rbx
+  80339d:	41 5c                	pop    %r12
+  80339f:	5d                   	pop    %rbp
+  8033a0:	c3                   	ret
+
+00000000008033a1 <remove>:
+remove(const char *path) {
+  8033a1:	55                   	push   %rbp
+  8033a2:	48 89 e5             	mov    %rsp,%rbp
+  8033a5:	53                   	push   %rbx
+  8033a6:	48 83 ec 08          	sub    $0x8,%rsp
+  8033aa:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8033ad:	48 b8 98 0c 80 00 00 	movabs $0x800c98,%rax
+  8033b4:	00 00 00 
+  8033b7:	ff d0                	call   *%rax
+  8033b9:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033bf:	77 3a                	ja     8033fb <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8033c1:	48 89 de             	mov    %rbx,%rsi
+  8033c4:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033cb:	00 00 00 
+  8033ce:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  8033d5:	00 00 00 
+  8033d8:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8033da:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033df:	be 00 00 00 00       	mov    $0x0,%esi
+  8033e4:	bf 07 00 00 00       	mov    $0x7,%edi
+  8033e9:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  8033f0:	00 00 00 
+  8033f3:	ff d0                	call   *%rax
+}
+  8033f5:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8033f9:	c9                   	leave
+  8033fa:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8033fb:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803400:	eb f3                	jmp    8033f5 <remove+0x54>
+
+0000000000803402 <sync>:
+sync(void) {
+  803402:	55                   	push   %rbp
+  803403:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803406:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  80340d:	00 00 00 
+  803410:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803412:	ba 00 00 00 00       	mov    $0x0,%edx
+  803417:	be 00 00 00 00       	mov    $0x0,%esi
+  80341c:	bf 08 00 00 00       	mov    $0x8,%edi
+  803421:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  803428:	00 00 00 
+  80342b:	ff d0                	call   *%rax
+}
+  80342d:	5d                   	pop    %rbp
+  80342e:	c3                   	ret
+
+000000000080342f <fsync>:
+fsync(int fdnum) {
+  80342f:	55                   	push   %rbp
+  803430:	48 89 e5             	mov    %rsp,%rbp
+  803433:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803437:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80343b:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  803442:	00 00 00 
+  803445:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803447:	85 c0                	test   %eax,%eax
+  803449:	78 4b                	js     803496 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80344b:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80344f:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  803456:	00 00 00 
+  803459:	8b 00                	mov    (%rax),%eax
+  80345b:	39 02                	cmp    %eax,(%rdx)
+  80345d:	75 39                	jne    803498 <fsync+0x69>
+    file_flush_buffers();
+  80345f:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  803466:	00 00 00 
+  803469:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  80346b:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  80346f:	8b 40 0c             	mov    0xc(%rax),%eax
+  803472:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803479:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80347b:	ba 00 00 00 00       	mov    $0x0,%edx
+  803480:	be 00 00 00 00       	mov    $0x0,%esi
+  803485:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80348a:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  803491:	00 00 00 
+  803494:	ff d0                	call   *%rax
+}
+  803496:	c9                   	leave
+  803497:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803498:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80349d:	eb f7                	jmp    803496 <fsync+0x67>
+
+000000000080349f <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  80349f:	55                   	push   %rbp
+  8034a0:	48 89 e5             	mov    %rsp,%rbp
+  8034a3:	53                   	push   %rbx
+  8034a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8034a8:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8034ab:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034b0:	be 00 00 00 00       	mov    $0x0,%esi
+  8034b5:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034ba:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  8034c1:	00 00 00 
+  8034c4:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034c6:	85 c0                	test   %eax,%eax
+  8034c8:	78 2d                	js     8034f7 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8034ca:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034d1:	00 00 00 
+  8034d4:	48 8b 10             	mov    (%rax),%rdx
+  8034d7:	48 89 13             	mov    %rdx,(%rbx)
+  8034da:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034de:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034e2:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034e6:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034ea:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8034ee:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8034f2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034f7:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8034fb:	c9                   	leave
+  8034fc:	c3                   	ret
+
+00000000008034fd <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  8034fd:	55                   	push   %rbp
+  8034fe:	48 89 e5             	mov    %rsp,%rbp
+  803501:	53                   	push   %rbx
+  803502:	48 83 ec 08          	sub    $0x8,%rsp
+  803506:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803509:	ba 00 00 00 00       	mov    $0x0,%edx
+  80350e:	be 00 00 00 00       	mov    $0x0,%esi
+  803513:	bf 0c 00 00 00       	mov    $0xc,%edi
+  803518:	48 b8 34 27 80 00 00 	movabs $0x802734,%rax
+  80351f:	00 00 00 
+  803522:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803524:	85 c0                	test   %eax,%eax
+  803526:	78 3d                	js     803565 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  803528:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80352f:	00 00 00 
+  803532:	48 8b 10             	mov    (%rax),%rdx
+  803535:	48 89 13             	mov    %rdx,(%rbx)
+  803538:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80353c:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803540:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803544:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  803548:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80354c:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803550:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  803554:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  803558:	48 8b 40 28          	mov    0x28(%rax),%rax
+  80355c:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803560:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803565:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803569:	c9                   	leave
+  80356a:	c3                   	ret
+
+000000000080356b <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  80356b:	55                   	push   %rbp
+  80356c:	48 89 e5             	mov    %rsp,%rbp
+  80356f:	41 57                	push   %r15
+  803571:	41 56                	push   %r14
+  803573:	41 55                	push   %r13
+  803575:	41 54                	push   %r12
+  803577:	53                   	push   %rbx
+  803578:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80357c:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803583:	00 
+  803584:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80358b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803591:	0f 85 43 01 00 00    	jne    8036da <munmap+0x16f>
+  803597:	49 89 ff             	mov    %rdi,%r15
+  80359a:	4c 39 f7             	cmp    %r14,%rdi
+  80359d:	0f 87 37 01 00 00    	ja     8036da <munmap+0x16f>
+  8035a3:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8035aa:	00 00 00 
+  8035ad:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8035b3:	eb 2c                	jmp    8035e1 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8035b5:	4c 39 f8             	cmp    %r15,%rax
+  8035b8:	0f 83 85 00 00 00    	jae    803643 <munmap+0xd8>
+            m->mm_end = start;
+  8035be:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8035c3:	48 83 c3 18          	add    $0x18,%rbx
+  8035c7:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8035ce:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035d5:	00 00 00 
+  8035d8:	48 39 c3             	cmp    %rax,%rbx
+  8035db:	0f 84 d0 00 00 00    	je     8036b1 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8035e1:	49 89 dc             	mov    %rbx,%r12
+  8035e4:	48 8b 03             	mov    (%rbx),%rax
+  8035e7:	4c 39 f0             	cmp    %r14,%rax
+  8035ea:	73 d7                	jae    8035c3 <munmap+0x58>
+  8035ec:	48 85 c0             	test   %rax,%rax
+  8035ef:	74 d2                	je     8035c3 <munmap+0x58>
+  8035f1:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035f5:	49 39 d7             	cmp    %rdx,%r15
+  8035f8:	73 c9                	jae    8035c3 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  8035fa:	49 39 d6             	cmp    %rdx,%r14
+  8035fd:	73 b6                	jae    8035b5 <munmap+0x4a>
+  8035ff:	49 39 c7             	cmp    %rax,%r15
+  803602:	76 b1                	jbe    8035b5 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803604:	4c 89 ef             	mov    %r13,%rdi
+  803607:	48 b8 a2 26 80 00 00 	movabs $0x8026a2,%rax
+  80360e:	00 00 00 
+  803611:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  803613:	48 85 c0             	test   %rax,%rax
+  803616:	0f 84 c5 00 00 00    	je     8036e1 <munmap+0x176>
+            *tail = *m;
+  80361c:	48 8b 13             	mov    (%rbx),%rdx
+  80361f:	48 89 10             	mov    %rdx,(%rax)
+  803622:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803626:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  80362a:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80362e:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803632:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  803635:	44 89 f2             	mov    %r14d,%edx
+  803638:	2b 13                	sub    (%rbx),%edx
+  80363a:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80363d:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803641:	eb 80                	jmp    8035c3 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  803643:	49 39 d6             	cmp    %rdx,%r14
+  803646:	73 18                	jae    803660 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  803648:	44 89 f2             	mov    %r14d,%edx
+  80364b:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803650:	29 c2                	sub    %eax,%edx
+  803652:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  803657:	4d 89 34 24          	mov    %r14,(%r12)
+  80365b:	e9 63 ff ff ff       	jmp    8035c3 <munmap+0x58>
+    m->mm_start = 0;
+  803660:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  803667:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  803668:	4c 89 e6             	mov    %r12,%rsi
+  80366b:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803672:	00 00 00 
+  803675:	48 29 c6             	sub    %rax,%rsi
+  803678:	48 c1 fe 03          	sar    $0x3,%rsi
+  80367c:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803683:	aa aa aa 
+  803686:	48 0f af f0          	imul   %rax,%rsi
+  80368a:	48 c1 e6 0c          	shl    $0xc,%rsi
+  80368e:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803693:	48 01 c6             	add    %rax,%rsi
+  803696:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80369b:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a0:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  8036a7:	00 00 00 
+  8036aa:	ff d0                	call   *%rax
+}
+  8036ac:	e9 12 ff ff ff       	jmp    8035c3 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8036b1:	4c 89 f2             	mov    %r14,%rdx
+  8036b4:	4c 29 fa             	sub    %r15,%rdx
+  8036b7:	4c 89 fe             	mov    %r15,%rsi
+  8036ba:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036bf:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  8036c6:	00 00 00 
+  8036c9:	ff d0                	call   *%rax
+}
+  8036cb:	48 83 c4 08          	add    $0x8,%rsp
+  8036cf:	5b                   	pop    %rbx
+  8036d0:	41 5c                	pop    %r12
+  8036d2:	41 5d                	pop    %r13
+  8036d4:	41 5e                	pop    %r14
+  8036d6:	41 5f                	pop    %r15
+  8036d8:	5d                   	pop    %rbp
+  8036d9:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036da:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036df:	eb ea                	jmp    8036cb <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8036e1:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036e6:	eb e3                	jmp    8036cb <munmap+0x160>
+
+00000000008036e8 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8036e8:	55                   	push   %rbp
+  8036e9:	48 89 e5             	mov    %rsp,%rbp
+  8036ec:	41 57                	push   %r15
+  8036ee:	41 56                	push   %r14
+  8036f0:	41 55                	push   %r13
+  8036f2:	41 54                	push   %r12
+  8036f4:	53                   	push   %rbx
+  8036f5:	48 83 ec 28          	sub    $0x28,%rsp
+  8036f9:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  8036fd:	49 89 f5             	mov    %rsi,%r13
+  803700:	41 89 d6             	mov    %edx,%r14d
+  803703:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803706:	41 89 cc             	mov    %ecx,%r12d
+  803709:	44 89 c7             	mov    %r8d,%edi
+  80370c:	44 89 cb             	mov    %r9d,%ebx
+  80370f:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  803713:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  803717:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  80371e:	00 00 00 
+  803721:	ff d0                	call   *%rax
+  803723:	41 89 c7             	mov    %eax,%r15d
+  803726:	85 c0                	test   %eax,%eax
+  803728:	0f 88 ae 01 00 00    	js     8038dc <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80372e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803732:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803739:	00 00 00 
+  80373c:	8b 32                	mov    (%rdx),%esi
+  80373e:	39 30                	cmp    %esi,(%rax)
+  803740:	0f 85 7a 02 00 00    	jne    8039c0 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  803746:	8b 40 08             	mov    0x8(%rax),%eax
+  803749:	83 e0 03             	and    $0x3,%eax
+  80374c:	83 f8 01             	cmp    $0x1,%eax
+  80374f:	0f 84 76 02 00 00    	je     8039cb <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803755:	4d 85 ed             	test   %r13,%r13
+  803758:	0f 84 78 02 00 00    	je     8039d6 <mmap+0x2ee>
+  80375e:	85 db                	test   %ebx,%ebx
+  803760:	0f 88 70 02 00 00    	js     8039d6 <mmap+0x2ee>
+  803766:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  80376c:	41 89 df             	mov    %ebx,%r15d
+  80376f:	0f 85 6c 02 00 00    	jne    8039e1 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803775:	44 89 f0             	mov    %r14d,%eax
+  803778:	83 e0 fd             	and    $0xfffffffd,%eax
+  80377b:	83 f8 04             	cmp    $0x4,%eax
+  80377e:	0f 85 68 02 00 00    	jne    8039ec <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803784:	44 89 e1             	mov    %r12d,%ecx
+  803787:	83 e1 01             	and    $0x1,%ecx
+  80378a:	0f 95 c2             	setne  %dl
+  80378d:	44 89 e0             	mov    %r12d,%eax
+  803790:	d1 e8                	shr    %eax
+  803792:	83 f0 01             	xor    $0x1,%eax
+  803795:	83 e0 01             	and    $0x1,%eax
+  803798:	38 c2                	cmp    %al,%dl
+  80379a:	0f 85 57 02 00 00    	jne    8039f7 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037a0:	85 c9                	test   %ecx,%ecx
+  8037a2:	74 0a                	je     8037ae <mmap+0xc6>
+  8037a4:	41 f6 c6 02          	test   $0x2,%r14b
+  8037a8:	0f 85 54 02 00 00    	jne    803a02 <mmap+0x31a>
+    file_flush_buffers();
+  8037ae:	48 b8 63 32 80 00 00 	movabs $0x803263,%rax
+  8037b5:	00 00 00 
+  8037b8:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8037ba:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8037c1:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8037c8:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8037cc:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8037cf:	41 f6 c4 04          	test   $0x4,%r12b
+  8037d3:	0f 84 15 01 00 00    	je     8038ee <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8037d9:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037dc:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8037e2:	0f 85 25 02 00 00    	jne    803a0d <mmap+0x325>
+  8037e8:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8037ec:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8037f3:	00 00 00 
+  8037f6:	48 39 c2             	cmp    %rax,%rdx
+  8037f9:	0f 82 19 02 00 00    	jb     803a18 <mmap+0x330>
+  8037ff:	48 39 c7             	cmp    %rax,%rdi
+  803802:	0f 87 10 02 00 00    	ja     803a18 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803808:	4c 89 ee             	mov    %r13,%rsi
+  80380b:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  803812:	00 00 00 
+  803815:	ff d0                	call   *%rax
+  803817:	85 c0                	test   %eax,%eax
+  803819:	0f 88 04 02 00 00    	js     803a23 <mmap+0x33b>
+    if (!handler) {
+  80381f:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803826:	00 00 00 
+  803829:	80 38 00             	cmpb   $0x0,(%rax)
+  80382c:	75 2b                	jne    803859 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80382e:	48 bf 03 26 80 00 00 	movabs $0x802603,%rdi
+  803835:	00 00 00 
+  803838:	48 b8 c4 46 80 00 00 	movabs $0x8046c4,%rax
+  80383f:	00 00 00 
+  803842:	ff d0                	call   *%rax
+  803844:	85 c0                	test   %eax,%eax
+  803846:	0f 88 ea 01 00 00    	js     803a36 <mmap+0x34e>
+        handler = 1;
+  80384c:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  803853:	00 00 00 
+  803856:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803859:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80385d:	48 b8 a2 26 80 00 00 	movabs $0x8026a2,%rax
+  803864:	00 00 00 
+  803867:	ff d0                	call   *%rax
+  803869:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  80386c:	48 85 c0             	test   %rax,%rax
+  80386f:	0f 84 c9 01 00 00    	je     803a3e <mmap+0x356>
+    m->mm_start = va;
+  803875:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  803878:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80387c:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803880:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803883:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  803887:	44 89 e0             	mov    %r12d,%eax
+  80388a:	c1 e0 06             	shl    $0x6,%eax
+  80388d:	25 80 00 00 00       	and    $0x80,%eax
+  803892:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803895:	09 f0                	or     %esi,%eax
+  803897:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80389b:	41 f6 c4 08          	test   $0x8,%r12b
+  80389f:	74 31                	je     8038d2 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038a1:	48 39 d3             	cmp    %rdx,%rbx
+  8038a4:	73 2c                	jae    8038d2 <mmap+0x1ea>
+  8038a6:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8038ab:	48 89 de             	mov    %rbx,%rsi
+  8038ae:	4c 89 f7             	mov    %r14,%rdi
+  8038b1:	48 b8 f2 24 80 00 00 	movabs $0x8024f2,%rax
+  8038b8:	00 00 00 
+  8038bb:	ff d0                	call   *%rax
+  8038bd:	49 89 c4             	mov    %rax,%r12
+  8038c0:	48 85 c0             	test   %rax,%rax
+  8038c3:	0f 8e d7 00 00 00    	jle    8039a0 <mmap+0x2b8>
+            va += n;
+  8038c9:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038cc:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8038d0:	72 d4                	jb     8038a6 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8038d2:	49 8b 06             	mov    (%r14),%rax
+  8038d5:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8038d9:	48 89 06             	mov    %rax,(%rsi)
+}
+  8038dc:	44 89 f8             	mov    %r15d,%eax
+  8038df:	48 83 c4 28          	add    $0x28,%rsp
+  8038e3:	5b                   	pop    %rbx
+  8038e4:	41 5c                	pop    %r12
+  8038e6:	41 5d                	pop    %r13
+  8038e8:	41 5e                	pop    %r14
+  8038ea:	41 5f                	pop    %r15
+  8038ec:	5d                   	pop    %rbp
+  8038ed:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038ee:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8038f5:	00 00 00 
+  8038f8:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  8038fb:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803902:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803905:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80390a:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803911:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803914:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80391b:	00 00 00 
+  80391e:	48 39 d7             	cmp    %rdx,%rdi
+  803921:	73 1c                	jae    80393f <mmap+0x257>
+        return -E_NO_MEM;
+  803923:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803929:	eb b1                	jmp    8038dc <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80392b:	48 83 c0 01          	add    $0x1,%rax
+  80392f:	48 83 f8 1f          	cmp    $0x1f,%rax
+  803933:	77 3f                	ja     803974 <mmap+0x28c>
+  803935:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  80393a:	48 39 d7             	cmp    %rdx,%rdi
+  80393d:	72 2a                	jb     803969 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80393f:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  803943:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  803947:	48 39 d1             	cmp    %rdx,%rcx
+  80394a:	73 df                	jae    80392b <mmap+0x243>
+  80394c:	48 85 c9             	test   %rcx,%rcx
+  80394f:	74 da                	je     80392b <mmap+0x243>
+  803951:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  803955:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  80395a:	48 39 d3             	cmp    %rdx,%rbx
+  80395d:	73 cc                	jae    80392b <mmap+0x243>
+            va = mmaps[i].mm_end;
+  80395f:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803962:	b8 00 00 00 00       	mov    $0x0,%eax
+  803967:	eb cc                	jmp    803935 <mmap+0x24d>
+        return -E_NO_MEM;
+  803969:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80396f:	e9 68 ff ff ff       	jmp    8038dc <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803974:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803979:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803980:	00 00 00 
+  803983:	48 39 c2             	cmp    %rax,%rdx
+  803986:	0f 82 9f 00 00 00    	jb     803a2b <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80398c:	48 85 db             	test   %rbx,%rbx
+  80398f:	0f 85 8a fe ff ff    	jne    80381f <mmap+0x137>
+        return -E_NO_MEM;
+  803995:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80399b:	e9 3c ff ff ff       	jmp    8038dc <mmap+0x1f4>
+        if (n < 0) {
+  8039a0:	0f 89 2c ff ff ff    	jns    8038d2 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8039a6:	49 8b 3e             	mov    (%r14),%rdi
+  8039a9:	4c 89 ee             	mov    %r13,%rsi
+  8039ac:	48 b8 6b 35 80 00 00 	movabs $0x80356b,%rax
+  8039b3:	00 00 00 
+  8039b6:	ff d0                	call   *%rax
+            return n;
+  8039b8:	45 89 e7             	mov    %r12d,%r15d
+  8039bb:	e9 1c ff ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8039c0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039c6:	e9 11 ff ff ff       	jmp    8038dc <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039cb:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039d1:	e9 06 ff ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039d6:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039dc:	e9 fb fe ff ff       	jmp    8038dc <mmap+0x1f4>
+  8039e1:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039e7:	e9 f0 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8039ec:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039f2:	e9 e5 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8039f7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039fd:	e9 da fe ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a02:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803a08:	e9 cf fe ff ff       	jmp    8038dc <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a0d:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a13:	e9 c4 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+  803a18:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a1e:	e9 b9 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a23:	41 89 c7             	mov    %eax,%r15d
+  803a26:	e9 b1 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+        return -E_NO_MEM;
+  803a2b:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a31:	e9 a6 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a36:	41 89 c7             	mov    %eax,%r15d
+  803a39:	e9 9e fe ff ff       	jmp    8038dc <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803a3e:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a44:	e9 93 fe ff ff       	jmp    8038dc <mmap+0x1f4>
+
+0000000000803a49 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a49:	55                   	push   %rbp
+  803a4a:	48 89 e5             	mov    %rsp,%rbp
+  803a4d:	41 54                	push   %r12
+  803a4f:	53                   	push   %rbx
+  803a50:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a53:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803a5a:	00 00 00 
+  803a5d:	ff d0                	call   *%rax
+  803a5f:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a62:	48 be e0 4f 80 00 00 	movabs $0x804fe0,%rsi
+  803a69:	00 00 00 
+  803a6c:	48 89 df             	mov    %rbx,%rdi
+  803a6f:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  803a76:	00 00 00 
+  803a79:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a7b:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a80:	41 2b 04 24          	sub    (%r12),%eax
+  803a84:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a8a:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a91:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a94:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803a9b:	00 00 00 
+  803a9e:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803aa5:	b8 00 00 00 00       	mov    $0x0,%eax
+  803aaa:	5b                   	pop    %rbx
+  803aab:	41 5c                	pop    %r12
+  803aad:	5d                   	pop    %rbp
+  803aae:	c3                   	ret
+
+0000000000803aaf <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803aaf:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ab2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803ab8:	8b 17                	mov    (%rdi),%edx
+  803aba:	85 d2                	test   %edx,%edx
+  803abc:	75 01                	jne    803abf <pipe_wakeup+0x10>
+  803abe:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803abf:	55                   	push   %rbp
+  803ac0:	48 89 e5             	mov    %rsp,%rbp
+  803ac3:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803ac6:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803acc:	be 00 04 00 00       	mov    $0x400,%esi
+  803ad1:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  803ad8:	00 00 00 
+  803adb:	ff d0                	call   *%rax
+}
+  803add:	5d                   	pop    %rbp
+  803ade:	c3                   	ret
+
+0000000000803adf <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803adf:	55                   	push   %rbp
+  803ae0:	48 89 e5             	mov    %rsp,%rbp
+  803ae3:	41 55                	push   %r13
+  803ae5:	41 54                	push   %r12
+  803ae7:	53                   	push   %rbx
+  803ae8:	48 83 ec 08          	sub    $0x8,%rsp
+  803aec:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803aef:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803af6:	00 00 00 
+  803af9:	ff d0                	call   *%rax
+  803afb:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803afe:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b03:	4c 89 e6             	mov    %r12,%rsi
+  803b06:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b0b:	49 bc db 12 80 00 00 	movabs $0x8012db,%r12
+  803b12:	00 00 00 
+  803b15:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b18:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b1c:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b20:	49 bd af 3a 80 00 00 	movabs $0x803aaf,%r13
+  803b27:	00 00 00 
+  803b2a:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b2d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b31:	48 89 de             	mov    %rbx,%rsi
+  803b34:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803b37:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b3c:	48 89 de             	mov    %rbx,%rsi
+  803b3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b44:	41 ff d4             	call   *%r12
+  803b47:	48 83 c4 08          	add    $0x8,%rsp
+  803b4b:	5b                   	pop    %rbx
+  803b4c:	41 5c                	pop    %r12
+  803b4e:	41 5d                	pop    %r13
+  803b50:	5d                   	pop    %rbp
+  803b51:	c3                   	ret
+
+0000000000803b52 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803b52:	55                   	push   %rbp
+  803b53:	48 89 e5             	mov    %rsp,%rbp
+  803b56:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b59:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b5e:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b63:	48 b8 1e 12 80 00 00 	movabs $0x80121e,%rax
+  803b6a:	00 00 00 
+  803b6d:	ff d0                	call   *%rax
+  803b6f:	85 c0                	test   %eax,%eax
+  803b71:	0f 94 c0             	sete   %al
+  803b74:	0f b6 c0             	movzbl %al,%eax
+}
+  803b77:	5d                   	pop    %rbp
+  803b78:	c3                   	ret
+
+0000000000803b79 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b79:	55                   	push   %rbp
+  803b7a:	48 89 e5             	mov    %rsp,%rbp
+  803b7d:	41 57                	push   %r15
+  803b7f:	41 56                	push   %r14
+  803b81:	41 55                	push   %r13
+  803b83:	41 54                	push   %r12
+  803b85:	53                   	push   %rbx
+  803b86:	48 83 ec 38          	sub    $0x38,%rsp
+  803b8a:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b8e:	49 89 f4             	mov    %rsi,%r12
+  803b91:	49 89 d7             	mov    %rdx,%r15
+  803b94:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b98:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803b9f:	00 00 00 
+  803ba2:	ff d0                	call   *%rax
+  803ba4:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803ba7:	4d 85 ff             	test   %r15,%r15
+  803baa:	0f 84 f1 00 00 00    	je     803ca1 <devpipe_write+0x128>
+  803bb0:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803bb4:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803bb8:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803bbc:	49 bd 52 3b 80 00 00 	movabs $0x803b52,%r13
+  803bc3:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803bc6:	49 bf af 3a 80 00 00 	movabs $0x803aaf,%r15
+  803bcd:	00 00 00 
+  803bd0:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803bd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bd8:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803bdc:	8b 73 04             	mov    0x4(%rbx),%esi
+  803bdf:	48 63 ce             	movslq %esi,%rcx
+  803be2:	48 63 03             	movslq (%rbx),%rax
+  803be5:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803beb:	48 39 c1             	cmp    %rax,%rcx
+  803bee:	72 64                	jb     803c54 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bf0:	48 89 de             	mov    %rbx,%rsi
+  803bf3:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bf7:	41 ff d5             	call   *%r13
+  803bfa:	85 c0                	test   %eax,%eax
+  803bfc:	0f 85 b9 00 00 00    	jne    803cbb <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c02:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c06:	4c 89 f7             	mov    %r14,%rdi
+  803c09:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803c0c:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c0f:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803c16:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c1d:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c23:	8b 03                	mov    (%rbx),%eax
+  803c25:	41 39 c4             	cmp    %eax,%r12d
+  803c28:	75 b2                	jne    803bdc <devpipe_write+0x63>
+  803c2a:	48 89 de             	mov    %rbx,%rsi
+  803c2d:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c31:	41 ff d5             	call   *%r13
+  803c34:	85 c0                	test   %eax,%eax
+  803c36:	75 a0                	jne    803bd8 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c38:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c3d:	44 89 e6             	mov    %r12d,%esi
+  803c40:	48 89 df             	mov    %rbx,%rdi
+  803c43:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  803c4a:	00 00 00 
+  803c4d:	ff d0                	call   *%rax
+  803c4f:	e9 7c ff ff ff       	jmp    803bd0 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c54:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803c58:	41 0f b6 38          	movzbl (%r8),%edi
+  803c5c:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c63:	80 80 80 
+  803c66:	48 89 c8             	mov    %rcx,%rax
+  803c69:	48 f7 e2             	mul    %rdx
+  803c6c:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c70:	48 89 d0             	mov    %rdx,%rax
+  803c73:	48 c1 e0 08          	shl    $0x8,%rax
+  803c77:	48 29 d0             	sub    %rdx,%rax
+  803c7a:	48 c1 e0 04          	shl    $0x4,%rax
+  803c7e:	48 29 c1             	sub    %rax,%rcx
+  803c81:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c86:	83 c6 01             	add    $0x1,%esi
+  803c89:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c8c:	49 83 c0 01          	add    $0x1,%r8
+  803c90:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c94:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c98:	49 39 c0             	cmp    %rax,%r8
+  803c9b:	0f 85 2f ff ff ff    	jne    803bd0 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ca1:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803ca5:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803ca9:	48 b8 af 3a 80 00 00 	movabs $0x803aaf,%rax
+  803cb0:	00 00 00 
+  803cb3:	ff d0                	call   *%rax
+    return n;
+  803cb5:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cb9:	eb 05                	jmp    803cc0 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cbb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc0:	48 83 c4 38          	add    $0x38,%rsp
+  803cc4:	5b                   	pop    %rbx
+  803cc5:	41 5c                	pop    %r12
+  803cc7:	41 5d                	pop    %r13
+  803cc9:	41 5e                	pop    %r14
+  803ccb:	41 5f                	pop    %r15
+  803ccd:	5d                   	pop    %rbp
+  803cce:	c3                   	ret
+
+0000000000803ccf <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803ccf:	55                   	push   %rbp
+  803cd0:	48 89 e5             	mov    %rsp,%rbp
+  803cd3:	41 57                	push   %r15
+  803cd5:	41 56                	push   %r14
+  803cd7:	41 55                	push   %r13
+  803cd9:	41 54                	push   %r12
+  803cdb:	53                   	push   %rbx
+  803cdc:	48 83 ec 28          	sub    $0x28,%rsp
+  803ce0:	49 89 fd             	mov    %rdi,%r13
+  803ce3:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803ce7:	49 89 d4             	mov    %rdx,%r12
+  803cea:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cee:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803cf5:	00 00 00 
+  803cf8:	ff d0                	call   *%rax
+  803cfa:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803cfd:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803d03:	49 bf 52 3b 80 00 00 	movabs $0x803b52,%r15
+  803d0a:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803d0d:	4d 85 e4             	test   %r12,%r12
+  803d10:	0f 84 d5 00 00 00    	je     803deb <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d16:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d1a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803d1e:	8b 03                	mov    (%rbx),%eax
+  803d20:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803d23:	75 7a                	jne    803d9f <devpipe_read+0xd0>
+            if (i > 0) {
+  803d25:	4d 85 f6             	test   %r14,%r14
+  803d28:	75 50                	jne    803d7a <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d2a:	48 89 de             	mov    %rbx,%rsi
+  803d2d:	4c 89 ef             	mov    %r13,%rdi
+  803d30:	41 ff d7             	call   *%r15
+  803d33:	85 c0                	test   %eax,%eax
+  803d35:	0f 85 c9 00 00 00    	jne    803e04 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d3b:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803d3e:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d45:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803d4b:	8b 43 04             	mov    0x4(%rbx),%eax
+  803d4e:	41 39 c4             	cmp    %eax,%r12d
+  803d51:	75 cb                	jne    803d1e <devpipe_read+0x4f>
+  803d53:	48 89 de             	mov    %rbx,%rsi
+  803d56:	4c 89 ef             	mov    %r13,%rdi
+  803d59:	41 ff d7             	call   *%r15
+  803d5c:	85 c0                	test   %eax,%eax
+  803d5e:	75 be                	jne    803d1e <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d60:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d65:	44 89 e6             	mov    %r12d,%esi
+  803d68:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d6c:	48 b8 a3 15 80 00 00 	movabs $0x8015a3,%rax
+  803d73:	00 00 00 
+  803d76:	ff d0                	call   *%rax
+  803d78:	eb a4                	jmp    803d1e <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d7a:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d7e:	48 89 de             	mov    %rbx,%rsi
+  803d81:	48 b8 af 3a 80 00 00 	movabs $0x803aaf,%rax
+  803d88:	00 00 00 
+  803d8b:	ff d0                	call   *%rax
+                return i;
+  803d8d:	4c 89 f0             	mov    %r14,%rax
+}
+  803d90:	48 83 c4 28          	add    $0x28,%rsp
+  803d94:	5b                   	pop    %rbx
+  803d95:	41 5c                	pop    %r12
+  803d97:	41 5d                	pop    %r13
+  803d99:	41 5e                	pop    %r14
+  803d9b:	41 5f                	pop    %r15
+  803d9d:	5d                   	pop    %rbp
+  803d9e:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803d9f:	48 63 c8             	movslq %eax,%rcx
+  803da2:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803da9:	80 80 80 
+  803dac:	48 89 c8             	mov    %rcx,%rax
+  803daf:	48 f7 e2             	mul    %rdx
+  803db2:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803db6:	48 89 d0             	mov    %rdx,%rax
+  803db9:	48 c1 e0 08          	shl    $0x8,%rax
+  803dbd:	48 29 d0             	sub    %rdx,%rax
+  803dc0:	48 c1 e0 04          	shl    $0x4,%rax
+  803dc4:	48 89 c2             	mov    %rax,%rdx
+  803dc7:	48 89 c8             	mov    %rcx,%rax
+  803dca:	48 29 d0             	sub    %rdx,%rax
+  803dcd:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803dd2:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803dd6:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803dda:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803ddd:	49 83 c6 01          	add    $0x1,%r14
+  803de1:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803de5:	0f 85 2b ff ff ff    	jne    803d16 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803deb:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803def:	48 89 de             	mov    %rbx,%rsi
+  803df2:	48 b8 af 3a 80 00 00 	movabs $0x803aaf,%rax
+  803df9:	00 00 00 
+  803dfc:	ff d0                	call   *%rax
+    return n;
+  803dfe:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e02:	eb 8c                	jmp    803d90 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e04:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e09:	eb 85                	jmp    803d90 <devpipe_read+0xc1>
+
+0000000000803e0b <pipe>:
+pipe(int pfd[2]) {
+  803e0b:	55                   	push   %rbp
+  803e0c:	48 89 e5             	mov    %rsp,%rbp
+  803e0f:	41 55                	push   %r13
+  803e11:	41 54                	push   %r12
+  803e13:	53                   	push   %rbx
+  803e14:	48 83 ec 18          	sub    $0x18,%rsp
+  803e18:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e1b:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e1f:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  803e26:	00 00 00 
+  803e29:	ff d0                	call   *%rax
+  803e2b:	89 c3                	mov    %eax,%ebx
+  803e2d:	85 c0                	test   %eax,%eax
+  803e2f:	0f 88 a0 01 00 00    	js     803fd5 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803e35:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e3a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e3f:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e43:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e48:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803e4f:	00 00 00 
+  803e52:	ff d0                	call   *%rax
+  803e54:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e56:	85 c0                	test   %eax,%eax
+  803e58:	0f 88 77 01 00 00    	js     803fd5 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e5e:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803e62:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  803e69:	00 00 00 
+  803e6c:	ff d0                	call   *%rax
+  803e6e:	89 c3                	mov    %eax,%ebx
+  803e70:	85 c0                	test   %eax,%eax
+  803e72:	0f 88 43 01 00 00    	js     803fbb <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e78:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e7d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e82:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e86:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e8b:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803e92:	00 00 00 
+  803e95:	ff d0                	call   *%rax
+  803e97:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e99:	85 c0                	test   %eax,%eax
+  803e9b:	0f 88 1a 01 00 00    	js     803fbb <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ea1:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803ea5:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803eac:	00 00 00 
+  803eaf:	ff d0                	call   *%rax
+  803eb1:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803eb4:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803eb9:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ebe:	48 89 c6             	mov    %rax,%rsi
+  803ec1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ec6:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803ecd:	00 00 00 
+  803ed0:	ff d0                	call   *%rax
+  803ed2:	89 c3                	mov    %eax,%ebx
+  803ed4:	85 c0                	test   %eax,%eax
+  803ed6:	0f 88 c5 00 00 00    	js     803fa1 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803edc:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ee0:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  803ee7:	00 00 00 
+  803eea:	ff d0                	call   *%rax
+  803eec:	48 89 c1             	mov    %rax,%rcx
+  803eef:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803ef5:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803efb:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f00:	4c 89 ee             	mov    %r13,%rsi
+  803f03:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f08:	48 b8 8b 12 80 00 00 	movabs $0x80128b,%rax
+  803f0f:	00 00 00 
+  803f12:	ff d0                	call   *%rax
+  803f14:	89 c3                	mov    %eax,%ebx
+  803f16:	85 c0                	test   %eax,%eax
+  803f18:	78 6e                	js     803f88 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f1a:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f1f:	4c 89 ef             	mov    %r13,%rdi
+  803f22:	48 b8 fa 11 80 00 00 	movabs $0x8011fa,%rax
+  803f29:	00 00 00 
+  803f2c:	ff d0                	call   *%rax
+  803f2e:	83 f8 02             	cmp    $0x2,%eax
+  803f31:	0f 85 ab 00 00 00    	jne    803fe2 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803f37:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803f3e:	00 00 
+  803f40:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f44:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803f46:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f4a:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803f51:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f55:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803f57:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f5b:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803f62:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f66:	48 bb 4f 19 80 00 00 	movabs $0x80194f,%rbx
+  803f6d:	00 00 00 
+  803f70:	ff d3                	call   *%rbx
+  803f72:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f76:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f7a:	ff d3                	call   *%rbx
+  803f7c:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f81:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f86:	eb 4d                	jmp    803fd5 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f88:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f8d:	4c 89 ee             	mov    %r13,%rsi
+  803f90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f95:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  803f9c:	00 00 00 
+  803f9f:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803fa1:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fa6:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803faa:	bf 00 00 00 00       	mov    $0x0,%edi
+  803faf:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  803fb6:	00 00 00 
+  803fb9:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803fbb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc0:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fc4:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fc9:	48 b8 db 12 80 00 00 	movabs $0x8012db,%rax
+  803fd0:	00 00 00 
+  803fd3:	ff d0                	call   *%rax
+}
+  803fd5:	89 d8                	mov    %ebx,%eax
+  803fd7:	48 83 c4 18          	add    $0x18,%rsp
+  803fdb:	5b                   	pop    %rbx
+  803fdc:	41 5c                	pop    %r12
+  803fde:	41 5d                	pop    %r13
+  803fe0:	5d                   	pop    %rbp
+  803fe1:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fe2:	48 b9 10 50 80 00 00 	movabs $0x805010,%rcx
+  803fe9:	00 00 00 
+  803fec:	48 ba e7 4f 80 00 00 	movabs $0x804fe7,%rdx
+  803ff3:	00 00 00 
+  803ff6:	be 50 00 00 00       	mov    $0x50,%esi
+  803ffb:	48 bf fc 4f 80 00 00 	movabs $0x804ffc,%rdi
+  804002:	00 00 00 
+  804005:	b8 00 00 00 00       	mov    $0x0,%eax
+  80400a:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  804011:	00 00 00 
+  804014:	41 ff d0             	call   *%r8
+
+0000000000804017 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  804017:	55                   	push   %rbp
+  804018:	48 89 e5             	mov    %rsp,%rbp
+  80401b:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80401f:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  804023:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  80402a:	00 00 00 
+  80402d:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80402f:	85 c0                	test   %eax,%eax
+  804031:	78 23                	js     804056 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  804033:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804037:	48 b8 61 19 80 00 00 	movabs $0x801961,%rax
+  80403e:	00 00 00 
+  804041:	ff d0                	call   *%rax
+  804043:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  804046:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80404a:	48 b8 52 3b 80 00 00 	movabs $0x803b52,%rax
+  804051:	00 00 00 
+  804054:	ff d0                	call   *%rax
+}
+  804056:	c9                   	leave
+  804057:	c3                   	ret
+
+0000000000804058 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  804058:	48 89 f8             	mov    %rdi,%rax
+  80405b:	48 c1 e8 27          	shr    $0x27,%rax
+  80405f:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  804066:	01 00 00 
+  804069:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80406d:	f6 c2 01             	test   $0x1,%dl
+  804070:	74 6d                	je     8040df <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804072:	48 89 f8             	mov    %rdi,%rax
+  804075:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804079:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804080:	01 00 00 
+  804083:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804087:	f6 c2 01             	test   $0x1,%dl
+  80408a:	74 62                	je     8040ee <get_uvpt_entry+0x96>
+  80408c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804093:	01 00 00 
+  804096:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80409a:	f6 c2 80             	test   $0x80,%dl
+  80409d:	75 4f                	jne    8040ee <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80409f:	48 89 f8             	mov    %rdi,%rax
+  8040a2:	48 c1 e8 15          	shr    $0x15,%rax
+  8040a6:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040ad:	01 00 00 
+  8040b0:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040b4:	f6 c2 01             	test   $0x1,%dl
+  8040b7:	74 44                	je     8040fd <get_uvpt_entry+0xa5>
+  8040b9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040c0:	01 00 00 
+  8040c3:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040c7:	f6 c2 80             	test   $0x80,%dl
+  8040ca:	75 31                	jne    8040fd <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8040cc:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8040d0:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8040d7:	01 00 00 
+  8040da:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8040de:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8040df:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8040e6:	01 00 00 
+  8040e9:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040ed:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8040ee:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040f5:	01 00 00 
+  8040f8:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040fc:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8040fd:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  804104:	01 00 00 
+  804107:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80410b:	c3                   	ret
+
+000000000080410c <get_prot>:
+
+int
+get_prot(void *va) {
+  80410c:	55                   	push   %rbp
+  80410d:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804110:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  804117:	00 00 00 
+  80411a:	ff d0                	call   *%rax
+  80411c:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  80411f:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  804124:	89 c1                	mov    %eax,%ecx
+  804126:	83 c9 04             	or     $0x4,%ecx
+  804129:	f6 c2 01             	test   $0x1,%dl
+  80412c:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  80412f:	89 c1                	mov    %eax,%ecx
+  804131:	83 c9 02             	or     $0x2,%ecx
+  804134:	f6 c2 02             	test   $0x2,%dl
+  804137:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  80413a:	89 c1                	mov    %eax,%ecx
+  80413c:	83 c9 01             	or     $0x1,%ecx
+  80413f:	48 85 d2             	test   %rdx,%rdx
+  804142:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  804145:	89 c1                	mov    %eax,%ecx
+  804147:	83 c9 40             	or     $0x40,%ecx
+  80414a:	f6 c6 04             	test   $0x4,%dh
+  80414d:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804150:	5d                   	pop    %rbp
+  804151:	c3                   	ret
+
+0000000000804152 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804152:	55                   	push   %rbp
+  804153:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804156:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  80415d:	00 00 00 
+  804160:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804162:	48 c1 e8 06          	shr    $0x6,%rax
+  804166:	83 e0 01             	and    $0x1,%eax
+}
+  804169:	5d                   	pop    %rbp
+  80416a:	c3                   	ret
+
+000000000080416b <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  80416b:	55                   	push   %rbp
+  80416c:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  80416f:	48 b8 58 40 80 00 00 	movabs $0x804058,%rax
+  804176:	00 00 00 
+  804179:	ff d0                	call   *%rax
+  80417b:	83 e0 01             	and    $0x1,%eax
+}
+  80417e:	5d                   	pop    %rbp
+  80417f:	c3                   	ret
+
+0000000000804180 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804180:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  804187:	01 00 00 
+  80418a:	a8 01                	test   $0x1,%al
+  80418c:	75 06                	jne    804194 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  80418e:	b8 00 00 00 00       	mov    $0x0,%eax
+  804193:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  804194:	55                   	push   %rbp
+  804195:	48 89 e5             	mov    %rsp,%rbp
+  804198:	41 57                	push   %r15
+  80419a:	41 56                	push   %r14
+  80419c:	41 55                	push   %r13
+  80419e:	41 54                	push   %r12
+  8041a0:	53                   	push   %rbx
+  8041a1:	48 83 ec 28          	sub    $0x28,%rsp
+  8041a5:	49 89 fe             	mov    %rdi,%r14
+  8041a8:	49 89 f7             	mov    %rsi,%r15
+  8041ab:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8041b2:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041b3:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8041ba:	01 00 00 
+  8041bd:	e9 ae 00 00 00       	jmp    804270 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041c2:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041c9:	49 83 ec 01          	sub    $0x1,%r12
+  8041cd:	74 2d                	je     8041fc <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041cf:	48 89 d8             	mov    %rbx,%rax
+  8041d2:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041d6:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8041db:	f6 c2 01             	test   $0x1,%dl
+  8041de:	74 e2                	je     8041c2 <foreach_shared_region+0x42>
+  8041e0:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8041e5:	f6 c4 04             	test   $0x4,%ah
+  8041e8:	74 d8                	je     8041c2 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8041ea:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8041f1:	4c 89 fa             	mov    %r15,%rdx
+  8041f4:	48 89 df             	mov    %rbx,%rdi
+  8041f7:	41 ff d6             	call   *%r14
+  8041fa:	eb c6                	jmp    8041c2 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  8041fc:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  804203:	00 
+  804204:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804209:	74 4a                	je     804255 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  80420b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80420f:	48 c1 e8 15          	shr    $0x15,%rax
+  804213:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  80421a:	01 00 00 
+  80421d:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804221:	a8 01                	test   $0x1,%al
+  804223:	74 d7                	je     8041fc <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  804225:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804229:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804230:	48 39 c3             	cmp    %rax,%rbx
+  804233:	73 c7                	jae    8041fc <foreach_shared_region+0x7c>
+  804235:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  80423c:	48 39 d0             	cmp    %rdx,%rax
+  80423f:	4d 19 e4             	sbb    %r12,%r12
+  804242:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804249:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804250:	e9 7a ff ff ff       	jmp    8041cf <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  804255:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  80425c:	40 
+  80425d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804261:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804268:	00 00 00 
+  80426b:	48 39 c1             	cmp    %rax,%rcx
+  80426e:	74 50                	je     8042c0 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804270:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804274:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804278:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  80427f:	01 00 00 
+  804282:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804286:	a8 01                	test   $0x1,%al
+  804288:	74 cb                	je     804255 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80428a:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80428e:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804295:	48 39 c1             	cmp    %rax,%rcx
+  804298:	73 bb                	jae    804255 <foreach_shared_region+0xd5>
+  80429a:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8042a1:	48 39 d0             	cmp    %rdx,%rax
+  8042a4:	48 19 c0             	sbb    %rax,%rax
+  8042a7:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8042ad:	48 05 00 02 00 00    	add    $0x200,%rax
+  8042b3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042b7:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8042bb:	e9 4b ff ff ff       	jmp    80420b <foreach_shared_region+0x8b>
+  8042c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042c5:	48 83 c4 28          	add    $0x28,%rsp
+  8042c9:	5b                   	pop    %rbx
+  8042ca:	41 5c                	pop    %r12
+  8042cc:	41 5d                	pop    %r13
+  8042ce:	41 5e                	pop    %r14
+  8042d0:	41 5f                	pop    %r15
+  8042d2:	5d                   	pop    %rbp
+  8042d3:	c3                   	ret
+
+00000000008042d4 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8042d4:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8042da:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8042e1:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8042e8:	c3                   	ret
+
+00000000008042e9 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8042e9:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042ec:	8b 17                	mov    (%rdi),%edx
+  8042ee:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8042f0:	83 f8 0f             	cmp    $0xf,%eax
+  8042f3:	77 13                	ja     804308 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8042f5:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042f8:	83 e0 0f             	and    $0xf,%eax
+  8042fb:	48 c1 e0 09          	shl    $0x9,%rax
+  8042ff:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804306:	00 
+  804307:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804308:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80430d:	c3                   	ret
+
+000000000080430e <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  80430e:	8b 47 40             	mov    0x40(%rdi),%eax
+  804311:	83 c0 01             	add    $0x1,%eax
+  804314:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804317:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80431d:	8b 57 04             	mov    0x4(%rdi),%edx
+  804320:	b8 00 00 00 00       	mov    $0x0,%eax
+  804325:	85 d2                	test   %edx,%edx
+  804327:	75 04                	jne    80432d <chan_publish+0x1f>
+  804329:	83 e0 01             	and    $0x1,%eax
+}
+  80432c:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  80432d:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804330:	85 c0                	test   %eax,%eax
+  804332:	0f 95 c0             	setne  %al
+  804335:	0f b6 c0             	movzbl %al,%eax
+  804338:	eb ef                	jmp    804329 <chan_publish+0x1b>
+
+000000000080433a <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  80433a:	8b 47 40             	mov    0x40(%rdi),%eax
+  80433d:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80433f:	29 d0                	sub    %edx,%eax
+  804341:	83 e8 01             	sub    $0x1,%eax
+  804344:	83 f8 0f             	cmp    $0xf,%eax
+  804347:	77 12                	ja     80435b <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804349:	8b 07                	mov    (%rdi),%eax
+  80434b:	83 e0 0f             	and    $0xf,%eax
+  80434e:	48 c1 e0 09          	shl    $0x9,%rax
+  804352:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804359:	00 
+  80435a:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  80435b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804360:	c3                   	ret
+
+0000000000804361 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804361:	8b 07                	mov    (%rdi),%eax
+  804363:	83 c0 01             	add    $0x1,%eax
+  804366:	89 07                	mov    %eax,(%rdi)
+}
+  804368:	c3                   	ret
+
+0000000000804369 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804369:	55                   	push   %rbp
+  80436a:	48 89 e5             	mov    %rsp,%rbp
+  80436d:	53                   	push   %rbx
+  80436e:	48 83 ec 08          	sub    $0x8,%rsp
+  804372:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804375:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80437c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804382:	48 b8 3a 43 80 00 00 	movabs $0x80433a,%rax
+  804389:	00 00 00 
+  80438c:	ff d0                	call   *%rax
+  80438e:	48 85 c0             	test   %rax,%rax
+  804391:	74 12                	je     8043a5 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804393:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80439a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80439f:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043a3:	c9                   	leave
+  8043a4:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8043a5:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043aa:	eb f3                	jmp    80439f <chan_arm+0x36>
+
+00000000008043ac <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8043ac:	55                   	push   %rbp
+  8043ad:	48 89 e5             	mov    %rsp,%rbp
+  8043b0:	41 56                	push   %r14
+  8043b2:	41 55                	push   %r13
+  8043b4:	41 54                	push   %r12
+  8043b6:	53                   	push   %rbx
+  8043b7:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8043ba:	49 bc 69 43 80 00 00 	movabs $0x804369,%r12
+  8043c1:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043c4:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8043c8:	49 bd a3 15 80 00 00 	movabs $0x8015a3,%r13
+  8043cf:	00 00 00 
+    while (chan_arm(r))
+  8043d2:	eb 0d                	jmp    8043e1 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043d4:	8b 33                	mov    (%rbx),%esi
+  8043d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043db:	4c 89 f7             	mov    %r14,%rdi
+  8043de:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8043e1:	48 89 df             	mov    %rbx,%rdi
+  8043e4:	41 ff d4             	call   *%r12
+  8043e7:	84 c0                	test   %al,%al
+  8043e9:	75 e9                	jne    8043d4 <chan_wait+0x28>
+}
+  8043eb:	5b                   	pop    %rbx
+  8043ec:	41 5c                	pop    %r12
+  8043ee:	41 5d                	pop    %r13
+  8043f0:	41 5e                	pop    %r14
+  8043f2:	5d                   	pop    %rbp
+  8043f3:	c3                   	ret
+
+00000000008043f4 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8043f4:	55                   	push   %rbp
+  8043f5:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8043f8:	48 83 c7 40          	add    $0x40,%rdi
+  8043fc:	be 01 00 00 00       	mov    $0x1,%esi
+  804401:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  804408:	00 00 00 
+  80440b:	ff d0                	call   *%rax
+}
+  80440d:	5d                   	pop    %rbp
+  80440e:	c3                   	ret
+
+000000000080440f <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  80440f:	b8 00 00 00 00       	mov    $0x0,%eax
+  804414:	c3                   	ret
+
+0000000000804415 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  804415:	55                   	push   %rbp
+  804416:	48 89 e5             	mov    %rsp,%rbp
+  804419:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  80441c:	48 be 34 50 80 00 00 	movabs $0x805034,%rsi
+  804423:	00 00 00 
+  804426:	48 b8 d6 0c 80 00 00 	movabs $0x800cd6,%rax
+  80442d:	00 00 00 
+  804430:	ff d0                	call   *%rax
+    return 0;
+}
+  804432:	b8 00 00 00 00       	mov    $0x0,%eax
+  804437:	5d                   	pop    %rbp
+  804438:	c3                   	ret
+
+0000000000804439 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804439:	55                   	push   %rbp
+  80443a:	48 89 e5             	mov    %rsp,%rbp
+  80443d:	41 57                	push   %r15
+  80443f:	41 56                	push   %r14
+  804441:	41 55                	push   %r13
+  804443:	41 54                	push   %r12
+  804445:	53                   	push   %rbx
+  804446:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  80444d:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  804454:	48 85 d2             	test   %rdx,%rdx
+  804457:	74 7a                	je     8044d3 <devcons_write+0x9a>
+  804459:	49 89 d6             	mov    %rdx,%r14
+  80445c:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804462:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  804467:	49 bf d0 0e 80 00 00 	movabs $0x800ed0,%r15
+  80446e:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804471:	4c 89 f3             	mov    %r14,%rbx
+  804474:	48 29 f3             	sub    %rsi,%rbx
+  804477:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80447c:	48 39 c3             	cmp    %rax,%rbx
+  80447f:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804483:	4c 63 eb             	movslq %ebx,%r13
+  804486:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  80448d:	48 01 c6             	add    %rax,%rsi
+  804490:	4c 89 ea             	mov    %r13,%rdx
+  804493:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80449a:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  80449d:	4c 89 ee             	mov    %r13,%rsi
+  8044a0:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044a7:	48 b8 fd 10 80 00 00 	movabs $0x8010fd,%rax
+  8044ae:	00 00 00 
+  8044b1:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8044b3:	41 01 dc             	add    %ebx,%r12d
+  8044b6:	49 63 f4             	movslq %r12d,%rsi
+  8044b9:	4c 39 f6             	cmp    %r14,%rsi
+  8044bc:	72 b3                	jb     804471 <devcons_write+0x38>
+    return res;
+  8044be:	49 63 c4             	movslq %r12d,%rax
+}
+  8044c1:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8044c8:	5b                   	pop    %rbx
+  8044c9:	41 5c                	pop    %r12
+  8044cb:	41 5d                	pop    %r13
+  8044cd:	41 5e                	pop    %r14
+  8044cf:	41 5f                	pop    %r15
+  8044d1:	5d                   	pop    %rbp
+  8044d2:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8044d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044d9:	eb e3                	jmp    8044be <devcons_write+0x85>
+
+00000000008044db <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044db:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8044de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044e3:	48 85 c0             	test   %rax,%rax
+  8044e6:	74 55                	je     80453d <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044e8:	55                   	push   %rbp
+  8044e9:	48 89 e5             	mov    %rsp,%rbp
+  8044ec:	41 55                	push   %r13
+  8044ee:	41 54                	push   %r12
+  8044f0:	53                   	push   %rbx
+  8044f1:	48 83 ec 08          	sub    $0x8,%rsp
+  8044f5:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8044f8:	48 bb 1c 11 80 00 00 	movabs $0x80111c,%rbx
+  8044ff:	00 00 00 
+  804502:	49 bc d1 11 80 00 00 	movabs $0x8011d1,%r12
+  804509:	00 00 00 
+  80450c:	eb 03                	jmp    804511 <devcons_read+0x36>
+  80450e:	41 ff d4             	call   *%r12
+  804511:	ff d3                	call   *%rbx
+  804513:	85 c0                	test   %eax,%eax
+  804515:	74 f7                	je     80450e <devcons_read+0x33>
+    if (c < 0) return c;
+  804517:	48 63 d0             	movslq %eax,%rdx
+  80451a:	78 13                	js     80452f <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  80451c:	ba 00 00 00 00       	mov    $0x0,%edx
+  804521:	83 f8 04             	cmp    $0x4,%eax
+  804524:	74 09                	je     80452f <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  804526:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  80452a:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  80452f:	48 89 d0             	mov    %rdx,%rax
+  804532:	48 83 c4 08          	add    $0x8,%rsp
+  804536:	5b                   	pop    %rbx
+  804537:	41 5c                	pop    %r12
+  804539:	41 5d                	pop    %r13
+  80453b:	5d                   	pop    %rbp
+  80453c:	c3                   	ret
+  80453d:	48 89 d0             	mov    %rdx,%rax
+  804540:	c3                   	ret
+
+0000000000804541 <cputchar>:
+cputchar(int ch) {
+  804541:	55                   	push   %rbp
+  804542:	48 89 e5             	mov    %rsp,%rbp
+  804545:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804549:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  80454d:	be 01 00 00 00       	mov    $0x1,%esi
+  804552:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  804556:	48 b8 fd 10 80 00 00 	movabs $0x8010fd,%rax
+  80455d:	00 00 00 
+  804560:	ff d0                	call   *%rax
+}
+  804562:	c9                   	leave
+  804563:	c3                   	ret
+
+0000000000804564 <getchar>:
+getchar(void) {
+  804564:	55                   	push   %rbp
+  804565:	48 89 e5             	mov    %rsp,%rbp
+  804568:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  80456c:	ba 01 00 00 00       	mov    $0x1,%edx
+  804571:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804575:	bf 00 00 00 00       	mov    $0x0,%edi
+  80457a:	48 b8 c0 1c 80 00 00 	movabs $0x801cc0,%rax
+  804581:	00 00 00 
+  804584:	ff d0                	call   *%rax
+  804586:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  804588:	85 c0                	test   %eax,%eax
+  80458a:	78 06                	js     804592 <getchar+0x2e>
+  80458c:	74 08                	je     804596 <getchar+0x32>
+  80458e:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804592:	89 d0                	mov    %edx,%eax
+  804594:	c9                   	leave
+  804595:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804596:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80459b:	eb f5                	jmp    804592 <getchar+0x2e>
+
+000000000080459d <iscons>:
+iscons(int fdnum) {
+  80459d:	55                   	push   %rbp
+  80459e:	48 89 e5             	mov    %rsp,%rbp
+  8045a1:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045a5:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045a9:	48 b8 dd 19 80 00 00 	movabs $0x8019dd,%rax
+  8045b0:	00 00 00 
+  8045b3:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045b5:	85 c0                	test   %eax,%eax
+  8045b7:	78 18                	js     8045d1 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8045b9:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045bd:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8045c4:	00 00 00 
+  8045c7:	8b 00                	mov    (%rax),%eax
+  8045c9:	39 02                	cmp    %eax,(%rdx)
+  8045cb:	0f 94 c0             	sete   %al
+  8045ce:	0f b6 c0             	movzbl %al,%eax
+}
+  8045d1:	c9                   	leave
+  8045d2:	c3                   	ret
+
+00000000008045d3 <opencons>:
+opencons(void) {
+  8045d3:	55                   	push   %rbp
+  8045d4:	48 89 e5             	mov    %rsp,%rbp
+  8045d7:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8045db:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8045df:	48 b8 7d 19 80 00 00 	movabs $0x80197d,%rax
+  8045e6:	00 00 00 
+  8045e9:	ff d0                	call   *%rax
+  8045eb:	85 c0                	test   %eax,%eax
+  8045ed:	78 49                	js     804638 <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8045ef:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045f4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045f9:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  8045fd:	bf 00 00 00 00       	mov    $0x0,%edi
+  804602:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  804609:	00 00 00 
+  80460c:	ff d0                	call   *%rax
+  80460e:	85 c0                	test   %eax,%eax
+  804610:	78 26                	js     804638 <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804612:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804616:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  80461d:	00 00 
+  80461f:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804621:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804625:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  80462c:	48 b8 4f 19 80 00 00 	movabs $0x80194f,%rax
+  804633:	00 00 00 
+  804636:	ff d0                	call   *%rax
+}
+  804638:	c9                   	leave
+  804639:	c3                   	ret
+
+000000000080463a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  80463a:	55                   	push   %rbp
+  80463b:	48 89 e5             	mov    %rsp,%rbp
+  80463e:	41 56                	push   %r14
+  804640:	41 55                	push   %r13
+  804642:	41 54                	push   %r12
+  804644:	53                   	push   %rbx
+  804645:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804648:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  80464f:	00 00 00 
+  804652:	48 83 38 00          	cmpq   $0x0,(%rax)
+  804656:	74 27                	je     80467f <_handle_vectored_pagefault+0x45>
+  804658:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  80465d:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  804664:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804667:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  80466a:	4c 89 e7             	mov    %r12,%rdi
+  80466d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804672:	84 c0                	test   %al,%al
+  804674:	75 45                	jne    8046bb <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804676:	48 83 c3 01          	add    $0x1,%rbx
+  80467a:	49 3b 1e             	cmp    (%r14),%rbx
+  80467d:	72 eb                	jb     80466a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  80467f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  804686:	00 
+  804687:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  80468c:	4d 8b 04 24          	mov    (%r12),%r8
+  804690:	48 ba 40 50 80 00 00 	movabs $0x805040,%rdx
+  804697:	00 00 00 
+  80469a:	be 1d 00 00 00       	mov    $0x1d,%esi
+  80469f:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8046a6:	00 00 00 
+  8046a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046ae:	49 ba 61 02 80 00 00 	movabs $0x800261,%r10
+  8046b5:	00 00 00 
+  8046b8:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046bb:	5b                   	pop    %rbx
+  8046bc:	41 5c                	pop    %r12
+  8046be:	41 5d                	pop    %r13
+  8046c0:	41 5e                	pop    %r14
+  8046c2:	5d                   	pop    %rbp
+  8046c3:	c3                   	ret
+
+00000000008046c4 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046c4:	55                   	push   %rbp
+  8046c5:	48 89 e5             	mov    %rsp,%rbp
+  8046c8:	53                   	push   %rbx
+  8046c9:	48 83 ec 08          	sub    $0x8,%rsp
+  8046cd:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046d0:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046d7:	00 00 00 
+  8046da:	80 38 00             	cmpb   $0x0,(%rax)
+  8046dd:	0f 84 84 00 00 00    	je     804767 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046e3:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046ea:	00 00 00 
+  8046ed:	48 8b 10             	mov    (%rax),%rdx
+  8046f0:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046f5:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  8046fc:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046ff:	48 85 d2             	test   %rdx,%rdx
+  804702:	74 19                	je     80471d <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  804704:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  804708:	0f 84 e8 00 00 00    	je     8047f6 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80470e:	48 83 c0 01          	add    $0x1,%rax
+  804712:	48 39 d0             	cmp    %rdx,%rax
+  804715:	75 ed                	jne    804704 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  804717:	48 83 fa 08          	cmp    $0x8,%rdx
+  80471b:	74 1c                	je     804739 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80471d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804721:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  804728:	00 00 00 
+  80472b:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804732:	00 00 00 
+  804735:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804739:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  804740:	00 00 00 
+  804743:	ff d0                	call   *%rax
+  804745:	89 c7                	mov    %eax,%edi
+  804747:	48 be bc 48 80 00 00 	movabs $0x8048bc,%rsi
+  80474e:	00 00 00 
+  804751:	48 b8 f3 13 80 00 00 	movabs $0x8013f3,%rax
+  804758:	00 00 00 
+  80475b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80475d:	85 c0                	test   %eax,%eax
+  80475f:	78 68                	js     8047c9 <add_pgfault_handler+0x105>
+    return res;
+}
+  804761:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804765:	c9                   	leave
+  804766:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  804767:	48 b8 a8 11 80 00 00 	movabs $0x8011a8,%rax
+  80476e:	00 00 00 
+  804771:	ff d0                	call   *%rax
+  804773:	89 c7                	mov    %eax,%edi
+  804775:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80477a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80477f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  804786:	00 00 00 
+  804789:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  804790:	00 00 00 
+  804793:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804795:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  80479c:	00 00 00 
+  80479f:	48 8b 02             	mov    (%rdx),%rax
+  8047a2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047a6:	48 89 0a             	mov    %rcx,(%rdx)
+  8047a9:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047b0:	00 00 00 
+  8047b3:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047b7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047be:	00 00 00 
+  8047c1:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047c4:	e9 70 ff ff ff       	jmp    804739 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047c9:	89 c1                	mov    %eax,%ecx
+  8047cb:	48 ba 7e 50 80 00 00 	movabs $0x80507e,%rdx
+  8047d2:	00 00 00 
+  8047d5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047da:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  8047e1:	00 00 00 
+  8047e4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047e9:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  8047f0:	00 00 00 
+  8047f3:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047f6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047fb:	e9 61 ff ff ff       	jmp    804761 <add_pgfault_handler+0x9d>
+
+0000000000804800 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804800:	55                   	push   %rbp
+  804801:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  804804:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80480b:	00 00 00 
+  80480e:	80 38 00             	cmpb   $0x0,(%rax)
+  804811:	74 33                	je     804846 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804813:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  80481a:	00 00 00 
+  80481d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804822:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804829:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80482c:	48 85 c0             	test   %rax,%rax
+  80482f:	0f 84 85 00 00 00    	je     8048ba <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  804835:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804839:	74 40                	je     80487b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80483b:	48 83 c1 01          	add    $0x1,%rcx
+  80483f:	48 39 c1             	cmp    %rax,%rcx
+  804842:	75 f1                	jne    804835 <remove_pgfault_handler+0x35>
+  804844:	eb 74                	jmp    8048ba <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  804846:	48 b9 96 50 80 00 00 	movabs $0x805096,%rcx
+  80484d:	00 00 00 
+  804850:	48 ba e7 4f 80 00 00 	movabs $0x804fe7,%rdx
+  804857:	00 00 00 
+  80485a:	be 43 00 00 00       	mov    $0x43,%esi
+  80485f:	48 bf 70 50 80 00 00 	movabs $0x805070,%rdi
+  804866:	00 00 00 
+  804869:	b8 00 00 00 00       	mov    $0x0,%eax
+  80486e:	49 b8 61 02 80 00 00 	movabs $0x800261,%r8
+  804875:	00 00 00 
+  804878:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80487b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804882:	00 
+  804883:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  804887:	48 29 ca             	sub    %rcx,%rdx
+  80488a:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804891:	00 00 00 
+  804894:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  804898:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  80489d:	48 89 ce             	mov    %rcx,%rsi
+  8048a0:	48 b8 d0 0e 80 00 00 	movabs $0x800ed0,%rax
+  8048a7:	00 00 00 
+  8048aa:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048ac:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048b3:	00 00 00 
+  8048b6:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048ba:	5d                   	pop    %rbp
+  8048bb:	c3                   	ret
+
+00000000008048bc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048bc:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048bf:	48 b8 3a 46 80 00 00 	movabs $0x80463a,%rax
+  8048c6:	00 00 00 
+    call *%rax
+  8048c9:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048cb:	41 5f                	pop    %r15
+	popq %r15
+  8048cd:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048cf:	41 5f                	pop    %r15
+	popq %r14
+  8048d1:	41 5e                	pop    %r14
+	popq %r13
+  8048d3:	41 5d                	pop    %r13
+	popq %r12
+  8048d5:	41 5c                	pop    %r12
+	popq %r11
+  8048d7:	41 5b                	pop    %r11
+	popq %r10
+  8048d9:	41 5a                	pop    %r10
+	popq %r9
+  8048db:	41 59                	pop    %r9
+	popq %r8
+  8048dd:	41 58                	pop    %r8
+	popq %rsi
+  8048df:	5e                   	pop    %rsi
+	popq %rdi
+  8048e0:	5f                   	pop    %rdi
+	popq %rbp
+  8048e1:	5d                   	pop    %rbp
+	popq %rdx
+  8048e2:	5a                   	pop    %rdx
+	popq %rcx
+  8048e3:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8048e4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8048e9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8048ee:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8048f2:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8048f5:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  8048fa:	5b                   	pop    %rbx
+	popq %rax
+  8048fb:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  8048fc:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804900:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804901:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  804906:	c3                   	ret
+  804907:	90                   	nop
+
+0000000000804908 <__rodata_start>:
+  804908:	25 64 20 00 66       	and    $0x66002064,%eax
+  80490d:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80490e:	72 6b                	jb     80497b <__rodata_start+0x73>
+  804910:	3a 20                	cmp    (%rax),%ah
+  804912:	25 69 00 75 73       	and    $0x73750069,%eax
+  804917:	65 72 2f             	gs jb  804949 <__rodata_start+0x41>
+  80491a:	70 72                	jo     80498e <__rodata_start+0x86>
+  80491c:	69 6d 65 73 2e 63 00 	imul   $0x632e73,0x65(%rbp),%ebp
+  804923:	3c 75                	cmp    $0x75,%al
+  804925:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804926:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80492a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80492b:	3e 00 0f             	ds add %cl,(%rdi)
+  80492e:	1f                   	(bad)
+  80492f:	00 5b 25             	add    %bl,0x25(%rbx)
+  804932:	30 38                	xor    %bh,(%rax)
+  804934:	78 5d                	js     804993 <__rodata_start+0x8b>
+  804936:	20 75 73             	and    %dh,0x73(%rbp)
+  804939:	65 72 20             	gs jb  80495c <__rodata_start+0x54>
+  80493c:	70 61                	jo     80499f <__rodata_start+0x97>
+  80493e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80493f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804946:	73 20                	jae    804968 <__rodata_start+0x60>
+  804948:	61                   	(bad)
+  804949:	74 20                	je     80496b <__rodata_start+0x63>
+  80494b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804950:	3a 20                	cmp    (%rax),%ah
+  804952:	00 30                	add    %dh,(%rax)
+  804954:	31 32                	xor    %esi,(%rdx)
+  804956:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80495d:	41                   	rex.B
+  80495e:	42                   	rex.X
+  80495f:	43                   	rex.XB
+  804960:	44                   	rex.R
+  804961:	45                   	rex.RB
+  804962:	46 00 30             	rex.RX add %r14b,(%rax)
+  804965:	31 32                	xor    %esi,(%rdx)
+  804967:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80496e:	61                   	(bad)
+  80496f:	62 63 64 65 66       	(bad)
+  804974:	00 28                	add    %ch,(%rax)
+  804976:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804977:	75 6c                	jne    8049e5 <__rodata_start+0xdd>
+  804979:	6c                   	insb   (%dx),%es:(%rdi)
+  80497a:	29 00                	sub    %eax,(%rax)
+  80497c:	65 72 72             	gs jb  8049f1 <__rodata_start+0xe9>
+  80497f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804980:	72 20                	jb     8049a2 <__rodata_start+0x9a>
+  804982:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804987:	73 70                	jae    8049f9 <__rodata_start+0xf1>
+  804989:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80498d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804994:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804995:	72 00                	jb     804997 <__rodata_start+0x8f>
+  804997:	62 61 64 20 65       	(bad)
+  80499c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499d:	76 69                	jbe    804a08 <__rodata_start+0x100>
+  80499f:	72 6f                	jb     804a10 <__rodata_start+0x108>
+  8049a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8049a3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049a5:	74 00                	je     8049a7 <__rodata_start+0x9f>
+  8049a7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049ae:	20 70 61             	and    %dh,0x61(%rax)
+  8049b1:	72 61                	jb     804a14 <__rodata_start+0x10c>
+  8049b3:	6d                   	insl   (%dx),%es:(%rdi)
+  8049b4:	65 74 65             	gs je  804a1c <__rodata_start+0x114>
+  8049b7:	72 00                	jb     8049b9 <__rodata_start+0xb1>
+  8049b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049ba:	75 74                	jne    804a30 <__rodata_start+0x128>
+  8049bc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8049bf:	20 6d 65             	and    %ch,0x65(%rbp)
+  8049c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8049c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049c4:	72 79                	jb     804a3f <__rodata_start+0x137>
+  8049c6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8049c9:	74 20                	je     8049eb <__rodata_start+0xe3>
+  8049cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049cc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8049d0:	76 69                	jbe    804a3b <__rodata_start+0x133>
+  8049d2:	72 6f                	jb     804a43 <__rodata_start+0x13b>
+  8049d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049d5:	6d                   	insl   (%dx),%es:(%rdi)
+  8049d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049d8:	74 73                	je     804a4d <__rodata_start+0x145>
+  8049da:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8049dd:	72 72                	jb     804a51 <__rodata_start+0x149>
+  8049df:	75 70                	jne    804a51 <__rodata_start+0x149>
+  8049e1:	74 65                	je     804a48 <__rodata_start+0x140>
+  8049e3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8049e8:	75 67                	jne    804a51 <__rodata_start+0x149>
+  8049ea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049ed:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049ef:	00 73 65             	add    %dh,0x65(%rbx)
+  8049f2:	67 6d                	insl   (%dx),%es:(%edi)
+  8049f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049f6:	74 61                	je     804a59 <__rodata_start+0x151>
+  8049f8:	74 69                	je     804a63 <__rodata_start+0x15b>
+  8049fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049fc:	20 66 61             	and    %ah,0x61(%rsi)
+  8049ff:	75 6c                	jne    804a6d <__rodata_start+0x165>
+  804a01:	74 00                	je     804a03 <__rodata_start+0xfb>
+  804a03:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a0a:	20 45 4c             	and    %al,0x4c(%rbp)
+  804a0d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804a11:	61                   	(bad)
+  804a12:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804a17:	20 73 75             	and    %dh,0x75(%rbx)
+  804a1a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804a1d:	73 79                	jae    804a98 <__rodata_start+0x190>
+  804a1f:	73 74                	jae    804a95 <__rodata_start+0x18d>
+  804a21:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804a23:	20 63 61             	and    %ah,0x61(%rbx)
+  804a26:	6c                   	insb   (%dx),%es:(%rdi)
+  804a27:	6c                   	insb   (%dx),%es:(%rdi)
+  804a28:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804a2b:	74 72                	je     804a9f <__rodata_start+0x197>
+  804a2d:	79 20                	jns    804a4f <__rodata_start+0x147>
+  804a2f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a30:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a31:	74 20                	je     804a53 <__rodata_start+0x14b>
+  804a33:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a35:	75 6e                	jne    804aa5 <__rodata_start+0x19d>
+  804a37:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804a3b:	76 20                	jbe    804a5d <__rodata_start+0x155>
+  804a3d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804a44:	72 65                	jb     804aab <__rodata_start+0x1a3>
+  804a46:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804a49:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a4a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804a4e:	65 78 70             	gs js  804ac1 <__rodata_start+0x1b9>
+  804a51:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a56:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a59:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a5d:	20 66 69             	and    %ah,0x69(%rsi)
+  804a60:	6c                   	insb   (%dx),%es:(%rdi)
+  804a61:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a65:	20 66 72             	and    %ah,0x72(%rsi)
+  804a68:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a6d:	61                   	(bad)
+  804a6e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a71:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a73:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a77:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a7a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a7b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a7c:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a7f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a80:	79 20                	jns    804aa2 <__rodata_start+0x19a>
+  804a82:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a89:	72 65                	jb     804af0 <__rodata_start+0x1e8>
+  804a8b:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a8e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a90:	00 66 69             	add    %ah,0x69(%rsi)
+  804a93:	6c                   	insb   (%dx),%es:(%rdi)
+  804a94:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a98:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a9b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a9c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a9f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804aa0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aa1:	74 20                	je     804ac3 <__rodata_start+0x1bb>
+  804aa3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804aa5:	75 6e                	jne    804b15 <__rodata_start+0x20d>
+  804aa7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804aab:	76 61                	jbe    804b0e <__rodata_start+0x206>
+  804aad:	6c                   	insb   (%dx),%es:(%rdi)
+  804aae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804ab5:	00 
+  804ab6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804abd:	72 65                	jb     804b24 <__rodata_start+0x21c>
+  804abf:	61                   	(bad)
+  804ac0:	64 79 20             	fs jns 804ae3 <__rodata_start+0x1db>
+  804ac3:	65 78 69             	gs js  804b2f <__rodata_start+0x227>
+  804ac6:	73 74                	jae    804b3c <__rodata_start+0x234>
+  804ac8:	73 00                	jae    804aca <__rodata_start+0x1c2>
+  804aca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804acb:	70 65                	jo     804b32 <__rodata_start+0x22a>
+  804acd:	72 61                	jb     804b30 <__rodata_start+0x228>
+  804acf:	74 69                	je     804b3a <__rodata_start+0x232>
+  804ad1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ad2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ad3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804ad6:	74 20                	je     804af8 <__rodata_start+0x1f0>
+  804ad8:	73 75                	jae    804b4f <__rodata_start+0x247>
+  804ada:	70 70                	jo     804b4c <__rodata_start+0x244>
+  804adc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804add:	72 74                	jb     804b53 <__rodata_start+0x24b>
+  804adf:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804ae5:	20 61 67             	and    %ah,0x67(%rcx)
+  804ae8:	61                   	(bad)
+  804ae9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804af0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804af4:	74 00                	je     804af6 <__rodata_start+0x1ee>
+  804af6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804afd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804b00:	20 75 73             	and    %dh,0x73(%rbp)
+  804b03:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804b07:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804b0e:	00 
+  804b0f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  804b16:	00 00 00 
+  804b19:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  804b20:	9e                   	sahf
+  804b21:	05 80 00 00 00       	add    $0x80,%eax
+  804b26:	00 00                	add    %al,(%rax)
+  804b28:	df 0b                	fisttps (%rbx)
+  804b2a:	80 00 00             	addb   $0x0,(%rax)
+  804b2d:	00 00                	add    %al,(%rax)
+  804b2f:	00 cf                	add    %cl,%bh
+  804b31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b37:	00 df                	add    %bl,%bh
+  804b39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b3f:	00 df                	add    %bl,%bh
+  804b41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b47:	00 df                	add    %bl,%bh
+  804b49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b4f:	00 df                	add    %bl,%bh
+  804b51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b57:	00 bd 05 80 00 00    	add    %bh,0x8005(%rbp)
+  804b5d:	00 00                	add    %al,(%rax)
+  804b5f:	00 df                	add    %bl,%bh
+  804b61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b67:	00 df                	add    %bl,%bh
+  804b69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b6f:	00 b1 05 80 00 00    	add    %dh,0x8005(%rcx)
+  804b75:	00 00                	add    %al,(%rax)
+  804b77:	00 2b                	add    %ch,(%rbx)
+  804b79:	06                   	(bad)
+  804b7a:	80 00 00             	addb   $0x0,(%rax)
+  804b7d:	00 00                	add    %al,(%rax)
+  804b7f:	00 df                	add    %bl,%bh
+  804b81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b87:	00 b1 05 80 00 00    	add    %dh,0x8005(%rcx)
+  804b8d:	00 00                	add    %al,(%rax)
+  804b8f:	00 f7                	add    %dh,%bh
+  804b91:	05 80 00 00 00       	add    $0x80,%eax
+  804b96:	00 00                	add    %al,(%rax)
+  804b98:	f7 05 80 00 00 00 00 	testl  $0x5f70000,0x80(%rip)        # 804c22 <__rodata_start+0x31a>
+  804b9f:	00 f7 05 
+  804ba2:	80 00 00             	addb   $0x0,(%rax)
+  804ba5:	00 00                	add    %al,(%rax)
+  804ba7:	00 f7                	add    %dh,%bh
+  804ba9:	05 80 00 00 00       	add    $0x80,%eax
+  804bae:	00 00                	add    %al,(%rax)
+  804bb0:	f7 05 80 00 00 00 00 	testl  $0x5f70000,0x80(%rip)        # 804c3a <__rodata_start+0x332>
+  804bb7:	00 f7 05 
+  804bba:	80 00 00             	addb   $0x0,(%rax)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 f7                	add    %dh,%bh
+  804bc1:	05 80 00 00 00       	add    $0x80,%eax
+  804bc6:	00 00                	add    %al,(%rax)
+  804bc8:	f7 05 80 00 00 00 00 	testl  $0x5f70000,0x80(%rip)        # 804c52 <__rodata_start+0x34a>
+  804bcf:	00 f7 05 
+  804bd2:	80 00 00             	addb   $0x0,(%rax)
+  804bd5:	00 00                	add    %al,(%rax)
+  804bd7:	00 df                	add    %bl,%bh
+  804bd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bdf:	00 df                	add    %bl,%bh
+  804be1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804be7:	00 df                	add    %bl,%bh
+  804be9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bef:	00 df                	add    %bl,%bh
+  804bf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bf7:	00 df                	add    %bl,%bh
+  804bf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bff:	00 df                	add    %bl,%bh
+  804c01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c07:	00 df                	add    %bl,%bh
+  804c09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c0f:	00 df                	add    %bl,%bh
+  804c11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c17:	00 df                	add    %bl,%bh
+  804c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c1f:	00 df                	add    %bl,%bh
+  804c21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c27:	00 df                	add    %bl,%bh
+  804c29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c2f:	00 df                	add    %bl,%bh
+  804c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c37:	00 df                	add    %bl,%bh
+  804c39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c3f:	00 df                	add    %bl,%bh
+  804c41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c47:	00 df                	add    %bl,%bh
+  804c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c4f:	00 df                	add    %bl,%bh
+  804c51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c57:	00 df                	add    %bl,%bh
+  804c59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c5f:	00 df                	add    %bl,%bh
+  804c61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c67:	00 df                	add    %bl,%bh
+  804c69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c6f:	00 df                	add    %bl,%bh
+  804c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c77:	00 df                	add    %bl,%bh
+  804c79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c7f:	00 df                	add    %bl,%bh
+  804c81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c87:	00 df                	add    %bl,%bh
+  804c89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c8f:	00 df                	add    %bl,%bh
+  804c91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c97:	00 df                	add    %bl,%bh
+  804c99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c9f:	00 df                	add    %bl,%bh
+  804ca1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ca7:	00 df                	add    %bl,%bh
+  804ca9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804caf:	00 df                	add    %bl,%bh
+  804cb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cb7:	00 df                	add    %bl,%bh
+  804cb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cbf:	00 df                	add    %bl,%bh
+  804cc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cc7:	00 02                	add    %al,(%rdx)
+  804cc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ccf:	00 df                	add    %bl,%bh
+  804cd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cd7:	00 df                	add    %bl,%bh
+  804cd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cdf:	00 df                	add    %bl,%bh
+  804ce1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ce7:	00 df                	add    %bl,%bh
+  804ce9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cef:	00 df                	add    %bl,%bh
+  804cf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cf7:	00 df                	add    %bl,%bh
+  804cf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cff:	00 df                	add    %bl,%bh
+  804d01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d07:	00 df                	add    %bl,%bh
+  804d09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d0f:	00 df                	add    %bl,%bh
+  804d11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d17:	00 df                	add    %bl,%bh
+  804d19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d1f:	00 4e 06             	add    %cl,0x6(%rsi)
+  804d22:	80 00 00             	addb   $0x0,(%rax)
+  804d25:	00 00                	add    %al,(%rax)
+  804d27:	00 1d 08 80 00 00    	add    %bl,0x8008(%rip)        # 80cd35 <__ctors_end+0x6c55>
+  804d2d:	00 00                	add    %al,(%rax)
+  804d2f:	00 df                	add    %bl,%bh
+  804d31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d37:	00 df                	add    %bl,%bh
+  804d39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d3f:	00 df                	add    %bl,%bh
+  804d41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d47:	00 df                	add    %bl,%bh
+  804d49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d4f:	00 7d 06             	add    %bh,0x6(%rbp)
+  804d52:	80 00 00             	addb   $0x0,(%rax)
+  804d55:	00 00                	add    %al,(%rax)
+  804d57:	00 df                	add    %bl,%bh
+  804d59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d5f:	00 df                	add    %bl,%bh
+  804d61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d67:	00 43 06             	add    %al,0x6(%rbx)
+  804d6a:	80 00 00             	addb   $0x0,(%rax)
+  804d6d:	00 00                	add    %al,(%rax)
+  804d6f:	00 df                	add    %bl,%bh
+  804d71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d77:	00 df                	add    %bl,%bh
+  804d79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d7f:	00 c5                	add    %al,%ch
+  804d81:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804d87:	00 8f 0a 80 00 00    	add    %cl,0x800a(%rdi)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 df                	add    %bl,%bh
+  804d91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d97:	00 df                	add    %bl,%bh
+  804d99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d9f:	00 14 07             	add    %dl,(%rdi,%rax,1)
+  804da2:	80 00 00             	addb   $0x0,(%rax)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 df                	add    %bl,%bh
+  804da9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804daf:	00 f1                	add    %dh,%cl
+  804db1:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804db7:	00 df                	add    %bl,%bh
+  804db9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dbf:	00 df                	add    %bl,%bh
+  804dc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dc7:	00 02                	add    %al,(%rdx)
+  804dc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dcf:	00 df                	add    %bl,%bh
+  804dd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804dd7:	00 a7 05 80 00 00    	add    %ah,0x8005(%rdi)
+  804ddd:	00 00                	add    %al,(%rax)
+	...
+
+0000000000804de0 <error_string>:
+	...
+  804de8:	85 49 80 00 00 00 00 00 97 49 80 00 00 00 00 00     .I.......I......
+  804df8:	a7 49 80 00 00 00 00 00 b9 49 80 00 00 00 00 00     .I.......I......
+  804e08:	c7 49 80 00 00 00 00 00 db 49 80 00 00 00 00 00     .I.......I......
+  804e18:	f0 49 80 00 00 00 00 00 03 4a 80 00 00 00 00 00     .I.......J......
+  804e28:	15 4a 80 00 00 00 00 00 29 4a 80 00 00 00 00 00     .J......)J......
+  804e38:	39 4a 80 00 00 00 00 00 4c 4a 80 00 00 00 00 00     9J......LJ......
+  804e48:	63 4a 80 00 00 00 00 00 79 4a 80 00 00 00 00 00     cJ......yJ......
+  804e58:	91 4a 80 00 00 00 00 00 a9 4a 80 00 00 00 00 00     .J.......J......
+  804e68:	b6 4a 80 00 00 00 00 00 98 4e 80 00 00 00 00 00     .J.......N......
+  804e78:	ca 4a 80 00 00 00 00 00 e2 4a 80 00 00 00 00 00     .J.......J......
+  804e88:	ec 4a 80 00 00 00 00 00 f6 4a 80 00 00 00 00 00     .J.......J......
+  804e98:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804ea8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804eb8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804ec8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804ed8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804ee8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804ef8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804f08:	2e 63 00 69 70 63 5f 73 65 6e 64 20 65 72 72 6f     .c.ipc_send erro
+  804f18:	72 3a 20 25 69 0a 00 6c 69 62 2f 69 70 63 2e 63     r: %i..lib/ipc.c
+  804f28:	00 0f 1f 80 00 00 00 00 5b 25 30 38 78 5d 20 75     ........[%08x] u
+  804f38:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804f48:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804f58:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804f68:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804f78:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f88:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f98:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804fa8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804fb8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804fc0 <devtab>:
+  804fc0:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804fd0:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804fe0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804ff0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805000:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  805010:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  805020:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  805030:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805040:	55 73 65 72 73 70 61 63 65 20 70 61 67 65 20 66     Userspace page f
+  805050:	61 75 6c 74 20 72 69 70 3d 25 30 38 6c 58 20 76     ault rip=%08lX v
+  805060:	61 3d 25 30 38 6c 58 20 65 72 72 3d 25 78 0a 00     a=%08lX err=%x..
+  805070:	6c 69 62 2f 70 67 66 61 75 6c 74 2e 63 00 73 65     lib/pgfault.c.se
+  805080:	74 5f 70 67 66 61 75 6c 74 5f 68 61 6e 64 6c 65     t_pgfault_handle
+  805090:	72 3a 20 25 69 00 5f 70 66 68 61 6e 64 6c 65 72     r: %i._pfhandler
+  8050a0:	5f 69 6e 69 74 69 74 69 61 6c 6c 69 7a 65 64 00     _inititiallized.
+  8050b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8050f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805100:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805110:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805120:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805130:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805140:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805150:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805160:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805170:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805180:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805190:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805200:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805210:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805220:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805230:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805240:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805250:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805260:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805270:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805280:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805290:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805300:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805310:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805320:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805330:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805340:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805350:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805360:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805370:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805380:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805390:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805400:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805410:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805420:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805430:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805440:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805450:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805460:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805470:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805480:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805490:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805500:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805510:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805520:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805530:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805540:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805550:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805560:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805570:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805580:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805590:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805600:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805610:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805620:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805630:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805640:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805650:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805660:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805670:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805680:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805690:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805700:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805710:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805720:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805730:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805740:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805750:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805760:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805770:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805780:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805790:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805800:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805810:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805820:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805830:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805840:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805850:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805860:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805870:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805880:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805890:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805900:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805910:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805920:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805930:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805940:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805950:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805960:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805970:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805980:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805990:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805aa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ab0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ac0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ad0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ae0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805af0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ba0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805be0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ca0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ce0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cf0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805da0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805db0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
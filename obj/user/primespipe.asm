@@ -0,0 +1,8778 @@
+
+obj/user/primespipe:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 36 03 00 00       	call   800359 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <primeproc>:
+ * of main and user/idle. */
+
+#include <inc/lib.h>
+
+unsigned
+primeproc(int fd) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 57                	push   %r15
+  80002b:	41 56                	push   %r14
+  80002d:	41 55                	push   %r13
+  80002f:	41 54                	push   %r12
+  800031:	53                   	push   %rbx
+  800032:	48 83 ec 18          	sub    $0x18,%rsp
+  800036:	89 fb                	mov    %edi,%ebx
+    int id, p, pfd[2], wfd, r;
+
+    /* Fetch a prime from our left neighbor */
+top:
+    if ((r = readn(fd, &p, 4)) != 4)
+  800038:	49 bc 85 1d 80 00 00 	movabs $0x801d85,%r12
+  80003f:	00 00 00 
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+
+    cprintf("%d\n", p);
+  800042:	49 bf 19 4b 80 00 00 	movabs $0x804b19,%r15
+  800049:	00 00 00 
+  80004c:	49 be 7f 05 80 00 00 	movabs $0x80057f,%r14
+  800053:	00 00 00 
+
+    /* Fork a right neighbor to continue the chain */
+    if ((r = pipe(pfd)) < 0)
+  800056:	49 bd 12 3e 80 00 00 	movabs $0x803e12,%r13
+  80005d:	00 00 00 
+    if ((r = readn(fd, &p, 4)) != 4)
+  800060:	ba 04 00 00 00       	mov    $0x4,%edx
+  800065:	48 8d 75 cc          	lea    -0x34(%rbp),%rsi
+  800069:	89 df                	mov    %ebx,%edi
+  80006b:	41 ff d4             	call   *%r12
+  80006e:	89 c1                	mov    %eax,%ecx
+  800070:	83 f8 04             	cmp    $0x4,%eax
+  800073:	75 4b                	jne    8000c0 <primeproc+0x9b>
+    cprintf("%d\n", p);
+  800075:	8b 75 cc             	mov    -0x34(%rbp),%esi
+  800078:	4c 89 ff             	mov    %r15,%rdi
+  80007b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800080:	41 ff d6             	call   *%r14
+    if ((r = pipe(pfd)) < 0)
+  800083:	48 8d 7d c4          	lea    -0x3c(%rbp),%rdi
+  800087:	41 ff d5             	call   *%r13
+  80008a:	85 c0                	test   %eax,%eax
+  80008c:	78 69                	js     8000f7 <primeproc+0xd2>
+        panic("pipe: %i", r);
+    if ((id = fork()) < 0)
+  80008e:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  800095:	00 00 00 
+  800098:	ff d0                	call   *%rax
+  80009a:	85 c0                	test   %eax,%eax
+  80009c:	0f 88 82 00 00 00    	js     800124 <primeproc+0xff>
+        panic("fork: %i", id);
+    if (id == 0) {
+  8000a2:	0f 85 a9 00 00 00    	jne    800151 <primeproc+0x12c>
+        close(fd);
+  8000a8:	89 df                	mov    %ebx,%edi
+  8000aa:	48 bb 49 1b 80 00 00 	movabs $0x801b49,%rbx
+  8000b1:	00 00 00 
+  8000b4:	ff d3                	call   *%rbx
+        close(pfd[1]);
+  8000b6:	8b 7d c8             	mov    -0x38(%rbp),%edi
+  8000b9:	ff d3                	call   *%rbx
+        fd = pfd[0];
+  8000bb:	8b 5d c4             	mov    -0x3c(%rbp),%ebx
+        goto top;
+  8000be:	eb a0                	jmp    800060 <primeproc+0x3b>
+        panic("primeproc could not read initial prime: %d, %i", r, r >= 0 ? 0 : r);
+  8000c0:	85 c0                	test   %eax,%eax
+  8000c2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8000c8:	44 0f 4e c0          	cmovle %eax,%r8d
+  8000cc:	48 ba d8 4a 80 00 00 	movabs $0x804ad8,%rdx
+  8000d3:	00 00 00 
+  8000d6:	be 14 00 00 00       	mov    $0x14,%esi
+  8000db:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  8000e2:	00 00 00 
+  8000e5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000ea:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  8000f1:	00 00 00 
+  8000f4:	41 ff d1             	call   *%r9
+        panic("pipe: %i", r);
+  8000f7:	89 c1                	mov    %eax,%ecx
+  8000f9:	48 ba 1d 4b 80 00 00 	movabs $0x804b1d,%rdx
+  800100:	00 00 00 
+  800103:	be 1a 00 00 00       	mov    $0x1a,%esi
+  800108:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  80010f:	00 00 00 
+  800112:	b8 00 00 00 00       	mov    $0x0,%eax
+  800117:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  80011e:	00 00 00 
+  800121:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  800124:	89 c1                	mov    %eax,%ecx
+  800126:	48 ba 26 4b 80 00 00 	movabs $0x804b26,%rdx
+  80012d:	00 00 00 
+  800130:	be 1c 00 00 00       	mov    $0x1c,%esi
+  800135:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  80013c:	00 00 00 
+  80013f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800144:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  80014b:	00 00 00 
+  80014e:	41 ff d0             	call   *%r8
+    }
+
+    close(pfd[0]);
+  800151:	8b 7d c4             	mov    -0x3c(%rbp),%edi
+  800154:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  80015b:	00 00 00 
+  80015e:	ff d0                	call   *%rax
+    wfd = pfd[1];
+  800160:	44 8b 6d c8          	mov    -0x38(%rbp),%r13d
+
+    /* Filter out multiples of our prime */
+    for (int i;;) {
+        if ((r = readn(fd, &i, 4)) != 4)
+  800164:	49 bc 85 1d 80 00 00 	movabs $0x801d85,%r12
+  80016b:	00 00 00 
+  80016e:	ba 04 00 00 00       	mov    $0x4,%edx
+  800173:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800177:	89 df                	mov    %ebx,%edi
+  800179:	41 ff d4             	call   *%r12
+  80017c:	83 f8 04             	cmp    $0x4,%eax
+  80017f:	75 65                	jne    8001e6 <primeproc+0x1c1>
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+        if (i % p)
+  800181:	8b 45 c0             	mov    -0x40(%rbp),%eax
+  800184:	99                   	cltd
+  800185:	f7 7d cc             	idivl  -0x34(%rbp)
+  800188:	85 d2                	test   %edx,%edx
+  80018a:	74 e2                	je     80016e <primeproc+0x149>
+            if ((r = write(wfd, &i, 4)) != 4)
+  80018c:	ba 04 00 00 00       	mov    $0x4,%edx
+  800191:	48 8d 75 c0          	lea    -0x40(%rbp),%rsi
+  800195:	44 89 ef             	mov    %r13d,%edi
+  800198:	48 b8 f6 1d 80 00 00 	movabs $0x801df6,%rax
+  80019f:	00 00 00 
+  8001a2:	ff d0                	call   *%rax
+  8001a4:	83 f8 04             	cmp    $0x4,%eax
+  8001a7:	74 c5                	je     80016e <primeproc+0x149>
+                panic("primeproc %d write: %d %i", p, r, r >= 0 ? 0 : r);
+  8001a9:	85 c0                	test   %eax,%eax
+  8001ab:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  8001b1:	44 0f 4e c8          	cmovle %eax,%r9d
+  8001b5:	41 89 c0             	mov    %eax,%r8d
+  8001b8:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001bb:	48 ba 4b 4b 80 00 00 	movabs $0x804b4b,%rdx
+  8001c2:	00 00 00 
+  8001c5:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8001ca:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  8001d1:	00 00 00 
+  8001d4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001d9:	49 ba 2f 04 80 00 00 	movabs $0x80042f,%r10
+  8001e0:	00 00 00 
+  8001e3:	41 ff d2             	call   *%r10
+            panic("primeproc %d readn %d %d %i", p, fd, r, r >= 0 ? 0 : r);
+  8001e6:	48 83 ec 08          	sub    $0x8,%rsp
+  8001ea:	85 c0                	test   %eax,%eax
+  8001ec:	ba 00 00 00 00       	mov    $0x0,%edx
+  8001f1:	0f 4e d0             	cmovle %eax,%edx
+  8001f4:	52                   	push   %rdx
+  8001f5:	41 89 c1             	mov    %eax,%r9d
+  8001f8:	41 89 d8             	mov    %ebx,%r8d
+  8001fb:	8b 4d cc             	mov    -0x34(%rbp),%ecx
+  8001fe:	48 ba 2f 4b 80 00 00 	movabs $0x804b2f,%rdx
+  800205:	00 00 00 
+  800208:	be 2a 00 00 00       	mov    $0x2a,%esi
+  80020d:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  800214:	00 00 00 
+  800217:	b8 00 00 00 00       	mov    $0x0,%eax
+  80021c:	49 ba 2f 04 80 00 00 	movabs $0x80042f,%r10
+  800223:	00 00 00 
+  800226:	41 ff d2             	call   *%r10
+
+0000000000800229 <umain>:
+    }
+}
+
+void
+umain(int argc, char **argv) {
+  800229:	55                   	push   %rbp
+  80022a:	48 89 e5             	mov    %rsp,%rbp
+  80022d:	53                   	push   %rbx
+  80022e:	48 83 ec 18          	sub    $0x18,%rsp
+    int id, p[2], r;
+
+    binaryname = "primespipe";
+  800232:	48 b8 65 4b 80 00 00 	movabs $0x804b65,%rax
+  800239:	00 00 00 
+  80023c:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800243:	00 00 00 
+
+    if ((r = pipe(p)) < 0)
+  800246:	48 8d 7d e8          	lea    -0x18(%rbp),%rdi
+  80024a:	48 b8 12 3e 80 00 00 	movabs $0x803e12,%rax
+  800251:	00 00 00 
+  800254:	ff d0                	call   *%rax
+  800256:	85 c0                	test   %eax,%eax
+  800258:	78 30                	js     80028a <umain+0x61>
+        panic("pipe: %i", r);
+
+    /* Fork the first prime process in the chain */
+    if ((id = fork()) < 0)
+  80025a:	48 b8 36 18 80 00 00 	movabs $0x801836,%rax
+  800261:	00 00 00 
+  800264:	ff d0                	call   *%rax
+  800266:	85 c0                	test   %eax,%eax
+  800268:	78 4d                	js     8002b7 <umain+0x8e>
+        panic("fork: %i", id);
+
+    if (id == 0) {
+  80026a:	75 78                	jne    8002e4 <umain+0xbb>
+        close(p[1]);
+  80026c:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  80026f:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  800276:	00 00 00 
+  800279:	ff d0                	call   *%rax
+        primeproc(p[0]);
+  80027b:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  80027e:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800285:	00 00 00 
+  800288:	ff d0                	call   *%rax
+        panic("pipe: %i", r);
+  80028a:	89 c1                	mov    %eax,%ecx
+  80028c:	48 ba 1d 4b 80 00 00 	movabs $0x804b1d,%rdx
+  800293:	00 00 00 
+  800296:	be 38 00 00 00       	mov    $0x38,%esi
+  80029b:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  8002a2:	00 00 00 
+  8002a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002aa:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  8002b1:	00 00 00 
+  8002b4:	41 ff d0             	call   *%r8
+        panic("fork: %i", id);
+  8002b7:	89 c1                	mov    %eax,%ecx
+  8002b9:	48 ba 26 4b 80 00 00 	movabs $0x804b26,%rdx
+  8002c0:	00 00 00 
+  8002c3:	be 3c 00 00 00       	mov    $0x3c,%esi
+  8002c8:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  8002cf:	00 00 00 
+  8002d2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002d7:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  8002de:	00 00 00 
+  8002e1:	41 ff d0             	call   *%r8
+    }
+
+    close(p[0]);
+  8002e4:	8b 7d e8             	mov    -0x18(%rbp),%edi
+  8002e7:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  8002ee:	00 00 00 
+  8002f1:	ff d0                	call   *%rax
+  8002f3:	b8 02 00 00 00       	mov    $0x2,%eax
+
+    /* Feed all the integers through */
+    for (int i = 2;; i++)
+        if ((r = write(p[1], &i, 4)) != 4)
+  8002f8:	48 bb f6 1d 80 00 00 	movabs $0x801df6,%rbx
+  8002ff:	00 00 00 
+  800302:	eb 06                	jmp    80030a <umain+0xe1>
+    for (int i = 2;; i++)
+  800304:	8b 45 e4             	mov    -0x1c(%rbp),%eax
+  800307:	83 c0 01             	add    $0x1,%eax
+  80030a:	89 45 e4             	mov    %eax,-0x1c(%rbp)
+        if ((r = write(p[1], &i, 4)) != 4)
+  80030d:	ba 04 00 00 00       	mov    $0x4,%edx
+  800312:	48 8d 75 e4          	lea    -0x1c(%rbp),%rsi
+  800316:	8b 7d ec             	mov    -0x14(%rbp),%edi
+  800319:	ff d3                	call   *%rbx
+  80031b:	89 c1                	mov    %eax,%ecx
+  80031d:	83 f8 04             	cmp    $0x4,%eax
+  800320:	74 e2                	je     800304 <umain+0xdb>
+            panic("generator write: %d, %i", r, r >= 0 ? 0 : r);
+  800322:	85 c0                	test   %eax,%eax
+  800324:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80032a:	44 0f 4e c0          	cmovle %eax,%r8d
+  80032e:	48 ba 70 4b 80 00 00 	movabs $0x804b70,%rdx
+  800335:	00 00 00 
+  800338:	be 48 00 00 00       	mov    $0x48,%esi
+  80033d:	48 bf 07 4b 80 00 00 	movabs $0x804b07,%rdi
+  800344:	00 00 00 
+  800347:	b8 00 00 00 00       	mov    $0x0,%eax
+  80034c:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  800353:	00 00 00 
+  800356:	41 ff d1             	call   *%r9
+
+0000000000800359 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800359:	55                   	push   %rbp
+  80035a:	48 89 e5             	mov    %rsp,%rbp
+  80035d:	41 56                	push   %r14
+  80035f:	41 55                	push   %r13
+  800361:	41 54                	push   %r12
+  800363:	53                   	push   %rbx
+  800364:	41 89 fd             	mov    %edi,%r13d
+  800367:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  80036a:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  800371:	00 00 00 
+  800374:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  80037b:	00 00 00 
+  80037e:	48 39 c2             	cmp    %rax,%rdx
+  800381:	73 17                	jae    80039a <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800383:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800386:	49 89 c4             	mov    %rax,%r12
+  800389:	48 83 c3 08          	add    $0x8,%rbx
+  80038d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800392:	ff 53 f8             	call   *-0x8(%rbx)
+  800395:	4c 39 e3             	cmp    %r12,%rbx
+  800398:	72 ef                	jb     800389 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  80039a:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  8003a1:	00 00 00 
+  8003a4:	ff d0                	call   *%rax
+  8003a6:	89 c2                	mov    %eax,%edx
+  8003a8:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8003ae:	48 89 d0             	mov    %rdx,%rax
+  8003b1:	48 c1 e0 04          	shl    $0x4,%rax
+  8003b5:	48 29 d0             	sub    %rdx,%rax
+  8003b8:	48 c1 e0 05          	shl    $0x5,%rax
+  8003bc:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8003c3:	00 00 00 
+  8003c6:	48 01 d0             	add    %rdx,%rax
+  8003c9:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  8003d0:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  8003d3:	45 85 ed             	test   %r13d,%r13d
+  8003d6:	7e 0d                	jle    8003e5 <libmain+0x8c>
+  8003d8:	49 8b 06             	mov    (%r14),%rax
+  8003db:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  8003e2:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  8003e5:	4c 89 f6             	mov    %r14,%rsi
+  8003e8:	44 89 ef             	mov    %r13d,%edi
+  8003eb:	48 b8 29 02 80 00 00 	movabs $0x800229,%rax
+  8003f2:	00 00 00 
+  8003f5:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  8003f7:	48 b8 0c 04 80 00 00 	movabs $0x80040c,%rax
+  8003fe:	00 00 00 
+  800401:	ff d0                	call   *%rax
+#endif
+}
+  800403:	5b                   	pop    %rbx
+  800404:	41 5c                	pop    %r12
+  800406:	41 5d                	pop    %r13
+  800408:	41 5e                	pop    %r14
+  80040a:	5d                   	pop    %rbp
+  80040b:	c3                   	ret
+
+000000000080040c <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80040c:	55                   	push   %rbp
+  80040d:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800410:	48 b8 7c 1b 80 00 00 	movabs $0x801b7c,%rax
+  800417:	00 00 00 
+  80041a:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80041c:	bf 00 00 00 00       	mov    $0x0,%edi
+  800421:	48 b8 13 13 80 00 00 	movabs $0x801313,%rax
+  800428:	00 00 00 
+  80042b:	ff d0                	call   *%rax
+}
+  80042d:	5d                   	pop    %rbp
+  80042e:	c3                   	ret
+
+000000000080042f <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  80042f:	55                   	push   %rbp
+  800430:	48 89 e5             	mov    %rsp,%rbp
+  800433:	41 56                	push   %r14
+  800435:	41 55                	push   %r13
+  800437:	41 54                	push   %r12
+  800439:	53                   	push   %rbx
+  80043a:	48 83 ec 50          	sub    $0x50,%rsp
+  80043e:	49 89 fc             	mov    %rdi,%r12
+  800441:	41 89 f5             	mov    %esi,%r13d
+  800444:	48 89 d3             	mov    %rdx,%rbx
+  800447:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80044b:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  80044f:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800453:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  80045a:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80045e:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800462:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800466:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  80046a:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  800471:	00 00 00 
+  800474:	4c 8b 30             	mov    (%rax),%r14
+  800477:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  80047e:	00 00 00 
+  800481:	ff d0                	call   *%rax
+  800483:	89 c6                	mov    %eax,%esi
+  800485:	45 89 e8             	mov    %r13d,%r8d
+  800488:	4c 89 e1             	mov    %r12,%rcx
+  80048b:	4c 89 f2             	mov    %r14,%rdx
+  80048e:	48 bf 98 4b 80 00 00 	movabs $0x804b98,%rdi
+  800495:	00 00 00 
+  800498:	b8 00 00 00 00       	mov    $0x0,%eax
+  80049d:	49 bc 7f 05 80 00 00 	movabs $0x80057f,%r12
+  8004a4:	00 00 00 
+  8004a7:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  8004aa:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  8004ae:	48 89 df             	mov    %rbx,%rdi
+  8004b1:	48 b8 1b 05 80 00 00 	movabs $0x80051b,%rax
+  8004b8:	00 00 00 
+  8004bb:	ff d0                	call   *%rax
+    cprintf("\n");
+  8004bd:	48 bf 1b 4b 80 00 00 	movabs $0x804b1b,%rdi
+  8004c4:	00 00 00 
+  8004c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8004cc:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  8004cf:	cc                   	int3
+  8004d0:	eb fd                	jmp    8004cf <_panic+0xa0>
+
+00000000008004d2 <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  8004d2:	55                   	push   %rbp
+  8004d3:	48 89 e5             	mov    %rsp,%rbp
+  8004d6:	53                   	push   %rbx
+  8004d7:	48 83 ec 08          	sub    $0x8,%rsp
+  8004db:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  8004de:	8b 06                	mov    (%rsi),%eax
+  8004e0:	8d 50 01             	lea    0x1(%rax),%edx
+  8004e3:	89 16                	mov    %edx,(%rsi)
+  8004e5:	48 98                	cltq
+  8004e7:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  8004ec:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  8004f2:	74 0a                	je     8004fe <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  8004f4:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  8004f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8004fc:	c9                   	leave
+  8004fd:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  8004fe:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800502:	be ff 00 00 00       	mov    $0xff,%esi
+  800507:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  80050e:	00 00 00 
+  800511:	ff d0                	call   *%rax
+        state->offset = 0;
+  800513:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800519:	eb d9                	jmp    8004f4 <putch+0x22>
+
+000000000080051b <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  80051b:	55                   	push   %rbp
+  80051c:	48 89 e5             	mov    %rsp,%rbp
+  80051f:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800526:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800529:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800530:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800535:	b8 00 00 00 00       	mov    $0x0,%eax
+  80053a:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  80053d:	48 89 f1             	mov    %rsi,%rcx
+  800540:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800547:	48 bf d2 04 80 00 00 	movabs $0x8004d2,%rdi
+  80054e:	00 00 00 
+  800551:	48 b8 cf 06 80 00 00 	movabs $0x8006cf,%rax
+  800558:	00 00 00 
+  80055b:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  80055d:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800564:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  80056b:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  800572:	00 00 00 
+  800575:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800577:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  80057d:	c9                   	leave
+  80057e:	c3                   	ret
+
+000000000080057f <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80057f:	55                   	push   %rbp
+  800580:	48 89 e5             	mov    %rsp,%rbp
+  800583:	48 83 ec 50          	sub    $0x50,%rsp
+  800587:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  80058b:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80058f:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800593:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800597:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  80059b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  8005a2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8005a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005aa:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8005ae:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  8005b2:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  8005b6:	48 b8 1b 05 80 00 00 	movabs $0x80051b,%rax
+  8005bd:	00 00 00 
+  8005c0:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  8005c2:	c9                   	leave
+  8005c3:	c3                   	ret
+
+00000000008005c4 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  8005c4:	55                   	push   %rbp
+  8005c5:	48 89 e5             	mov    %rsp,%rbp
+  8005c8:	41 57                	push   %r15
+  8005ca:	41 56                	push   %r14
+  8005cc:	41 55                	push   %r13
+  8005ce:	41 54                	push   %r12
+  8005d0:	53                   	push   %rbx
+  8005d1:	48 83 ec 18          	sub    $0x18,%rsp
+  8005d5:	49 89 fc             	mov    %rdi,%r12
+  8005d8:	49 89 f5             	mov    %rsi,%r13
+  8005db:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  8005df:	8b 45 10             	mov    0x10(%rbp),%eax
+  8005e2:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  8005e5:	41 89 cf             	mov    %ecx,%r15d
+  8005e8:	4c 39 fa             	cmp    %r15,%rdx
+  8005eb:	73 5b                	jae    800648 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  8005ed:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  8005f1:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  8005f5:	85 db                	test   %ebx,%ebx
+  8005f7:	7e 0e                	jle    800607 <print_num+0x43>
+            putch(padc, put_arg);
+  8005f9:	4c 89 ee             	mov    %r13,%rsi
+  8005fc:	44 89 f7             	mov    %r14d,%edi
+  8005ff:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800602:	83 eb 01             	sub    $0x1,%ebx
+  800605:	75 f2                	jne    8005f9 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800607:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  80060b:	48 b9 cc 4b 80 00 00 	movabs $0x804bcc,%rcx
+  800612:	00 00 00 
+  800615:	48 b8 bb 4b 80 00 00 	movabs $0x804bbb,%rax
+  80061c:	00 00 00 
+  80061f:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800623:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800627:	ba 00 00 00 00       	mov    $0x0,%edx
+  80062c:	49 f7 f7             	div    %r15
+  80062f:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800633:	4c 89 ee             	mov    %r13,%rsi
+  800636:	41 ff d4             	call   *%r12
+}
+  800639:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  80063d:	5b                   	pop    %rbx
+  80063e:	41 5c                	pop    %r12
+  800640:	41 5d                	pop    %r13
+  800642:	41 5e                	pop    %r14
+  800644:	41 5f                	pop    %r15
+  800646:	5d                   	pop    %rbp
+  800647:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800648:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80064c:	ba 00 00 00 00       	mov    $0x0,%edx
+  800651:	49 f7 f7             	div    %r15
+  800654:	48 83 ec 08          	sub    $0x8,%rsp
+  800658:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  80065c:	52                   	push   %rdx
+  80065d:	45 0f be c9          	movsbl %r9b,%r9d
+  800661:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800665:	48 89 c2             	mov    %rax,%rdx
+  800668:	48 b8 c4 05 80 00 00 	movabs $0x8005c4,%rax
+  80066f:	00 00 00 
+  800672:	ff d0                	call   *%rax
+  800674:	48 83 c4 10          	add    $0x10,%rsp
+  800678:	eb 8d                	jmp    800607 <print_num+0x43>
+
+000000000080067a <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  80067a:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80067e:	48 8b 06             	mov    (%rsi),%rax
+  800681:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800685:	73 0a                	jae    800691 <sprintputch+0x17>
+        *state->start++ = ch;
+  800687:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  80068b:	48 89 16             	mov    %rdx,(%rsi)
+  80068e:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800691:	c3                   	ret
+
+0000000000800692 <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800692:	55                   	push   %rbp
+  800693:	48 89 e5             	mov    %rsp,%rbp
+  800696:	48 83 ec 50          	sub    $0x50,%rsp
+  80069a:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80069e:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8006a2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  8006a6:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  8006ad:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8006b1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006b5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8006b9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  8006bd:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8006c1:	48 b8 cf 06 80 00 00 	movabs $0x8006cf,%rax
+  8006c8:	00 00 00 
+  8006cb:	ff d0                	call   *%rax
+}
+  8006cd:	c9                   	leave
+  8006ce:	c3                   	ret
+
+00000000008006cf <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  8006cf:	55                   	push   %rbp
+  8006d0:	48 89 e5             	mov    %rsp,%rbp
+  8006d3:	41 57                	push   %r15
+  8006d5:	41 56                	push   %r14
+  8006d7:	41 55                	push   %r13
+  8006d9:	41 54                	push   %r12
+  8006db:	53                   	push   %rbx
+  8006dc:	48 83 ec 38          	sub    $0x38,%rsp
+  8006e0:	49 89 fe             	mov    %rdi,%r14
+  8006e3:	49 89 f5             	mov    %rsi,%r13
+  8006e6:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  8006e9:	48 8b 01             	mov    (%rcx),%rax
+  8006ec:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  8006f0:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  8006f4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006f8:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  8006fc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800700:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800704:	0f b6 3b             	movzbl (%rbx),%edi
+  800707:	40 80 ff 25          	cmp    $0x25,%dil
+  80070b:	74 18                	je     800725 <vprintfmt+0x56>
+            if (!ch) return;
+  80070d:	40 84 ff             	test   %dil,%dil
+  800710:	0f 84 b1 06 00 00    	je     800dc7 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800716:	40 0f b6 ff          	movzbl %dil,%edi
+  80071a:	4c 89 ee             	mov    %r13,%rsi
+  80071d:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800720:	4c 89 e3             	mov    %r12,%rbx
+  800723:	eb db                	jmp    800700 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800725:	be 00 00 00 00       	mov    $0x0,%esi
+  80072a:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  80072e:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800733:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800739:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800740:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800744:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800749:	41 0f b6 04 24       	movzbl (%r12),%eax
+  80074e:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800751:	83 e8 23             	sub    $0x23,%eax
+  800754:	3c 57                	cmp    $0x57,%al
+  800756:	0f 87 51 06 00 00    	ja     800dad <vprintfmt+0x6de>
+  80075c:	0f b6 c0             	movzbl %al,%eax
+  80075f:	48 b9 80 4d 80 00 00 	movabs $0x804d80,%rcx
+  800766:	00 00 00 
+  800769:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  80076c:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  80076f:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800773:	eb cf                	jmp    800744 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800775:	49 89 dc             	mov    %rbx,%r12
+  800778:	be 01 00 00 00       	mov    $0x1,%esi
+  80077d:	eb c5                	jmp    800744 <vprintfmt+0x75>
+            padc = ch;
+  80077f:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800783:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800786:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800789:	eb b9                	jmp    800744 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  80078b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80078e:	83 f8 2f             	cmp    $0x2f,%eax
+  800791:	77 24                	ja     8007b7 <vprintfmt+0xe8>
+  800793:	89 c1                	mov    %eax,%ecx
+  800795:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800799:	83 c0 08             	add    $0x8,%eax
+  80079c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079f:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  8007a2:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  8007a5:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  8007a9:	79 99                	jns    800744 <vprintfmt+0x75>
+                width = precision;
+  8007ab:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  8007af:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8007b5:	eb 8d                	jmp    800744 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  8007b7:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8007bb:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  8007bf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007c3:	eb da                	jmp    80079f <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  8007c5:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  8007ca:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007ce:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  8007d4:	3c 39                	cmp    $0x39,%al
+  8007d6:	77 1c                	ja     8007f4 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  8007d8:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  8007dc:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  8007e0:	0f b6 c0             	movzbl %al,%eax
+  8007e3:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  8007e8:	0f b6 03             	movzbl (%rbx),%eax
+  8007eb:	3c 39                	cmp    $0x39,%al
+  8007ed:	76 e9                	jbe    8007d8 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  8007ef:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  8007f2:	eb b1                	jmp    8007a5 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  8007f4:	49 89 dc             	mov    %rbx,%r12
+  8007f7:	eb ac                	jmp    8007a5 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  8007f9:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  8007fc:	85 c9                	test   %ecx,%ecx
+  8007fe:	b8 00 00 00 00       	mov    $0x0,%eax
+  800803:	0f 49 c1             	cmovns %ecx,%eax
+  800806:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800809:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  80080c:	e9 33 ff ff ff       	jmp    800744 <vprintfmt+0x75>
+            lflag++;
+  800811:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800814:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800817:	e9 28 ff ff ff       	jmp    800744 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  80081c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80081f:	83 f8 2f             	cmp    $0x2f,%eax
+  800822:	77 19                	ja     80083d <vprintfmt+0x16e>
+  800824:	89 c2                	mov    %eax,%edx
+  800826:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80082a:	83 c0 08             	add    $0x8,%eax
+  80082d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800830:	8b 3a                	mov    (%rdx),%edi
+  800832:	4c 89 ee             	mov    %r13,%rsi
+  800835:	41 ff d6             	call   *%r14
+            break;
+  800838:	e9 c3 fe ff ff       	jmp    800700 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  80083d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800841:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800845:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800849:	eb e5                	jmp    800830 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  80084b:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80084e:	83 f8 2f             	cmp    $0x2f,%eax
+  800851:	77 5a                	ja     8008ad <vprintfmt+0x1de>
+  800853:	89 c2                	mov    %eax,%edx
+  800855:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800859:	83 c0 08             	add    $0x8,%eax
+  80085c:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  80085f:	8b 02                	mov    (%rdx),%eax
+  800861:	89 c1                	mov    %eax,%ecx
+  800863:	f7 d9                	neg    %ecx
+  800865:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800868:	83 f9 16             	cmp    $0x16,%ecx
+  80086b:	7f 4e                	jg     8008bb <vprintfmt+0x1ec>
+  80086d:	48 63 c1             	movslq %ecx,%rax
+  800870:	48 ba 40 50 80 00 00 	movabs $0x805040,%rdx
+  800877:	00 00 00 
+  80087a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80087e:	48 85 c0             	test   %rax,%rax
+  800881:	74 38                	je     8008bb <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800883:	48 89 c1             	mov    %rax,%rcx
+  800886:	48 ba 39 52 80 00 00 	movabs $0x805239,%rdx
+  80088d:	00 00 00 
+  800890:	4c 89 ee             	mov    %r13,%rsi
+  800893:	4c 89 f7             	mov    %r14,%rdi
+  800896:	b8 00 00 00 00       	mov    $0x0,%eax
+  80089b:	49 b8 92 06 80 00 00 	movabs $0x800692,%r8
+  8008a2:	00 00 00 
+  8008a5:	41 ff d0             	call   *%r8
+  8008a8:	e9 53 fe ff ff       	jmp    800700 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  8008ad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008b1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008b5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008b9:	eb a4                	jmp    80085f <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  8008bb:	48 ba e4 4b 80 00 00 	movabs $0x804be4,%rdx
+  8008c2:	00 00 00 
+  8008c5:	4c 89 ee             	mov    %r13,%rsi
+  8008c8:	4c 89 f7             	mov    %r14,%rdi
+  8008cb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008d0:	49 b8 92 06 80 00 00 	movabs $0x800692,%r8
+  8008d7:	00 00 00 
+  8008da:	41 ff d0             	call   *%r8
+  8008dd:	e9 1e fe ff ff       	jmp    800700 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8008e2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e5:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e8:	77 6c                	ja     800956 <vprintfmt+0x287>
+  8008ea:	89 c2                	mov    %eax,%edx
+  8008ec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008f0:	83 c0 08             	add    $0x8,%eax
+  8008f3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f6:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  8008f9:	48 85 d2             	test   %rdx,%rdx
+  8008fc:	48 b8 dd 4b 80 00 00 	movabs $0x804bdd,%rax
+  800903:	00 00 00 
+  800906:	48 0f 45 c2          	cmovne %rdx,%rax
+  80090a:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80090e:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800912:	7e 06                	jle    80091a <vprintfmt+0x24b>
+  800914:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  800918:	75 4a                	jne    800964 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80091a:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  80091e:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  800922:	0f b6 00             	movzbl (%rax),%eax
+  800925:	84 c0                	test   %al,%al
+  800927:	0f 85 9a 00 00 00    	jne    8009c7 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  80092d:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800930:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  800934:	85 c0                	test   %eax,%eax
+  800936:	0f 8e c4 fd ff ff    	jle    800700 <vprintfmt+0x31>
+  80093c:	4c 89 ee             	mov    %r13,%rsi
+  80093f:	bf 20 00 00 00       	mov    $0x20,%edi
+  800944:	41 ff d6             	call   *%r14
+  800947:	41 83 ec 01          	sub    $0x1,%r12d
+  80094b:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  80094f:	75 eb                	jne    80093c <vprintfmt+0x26d>
+  800951:	e9 aa fd ff ff       	jmp    800700 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  800956:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80095a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80095e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800962:	eb 92                	jmp    8008f6 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  800964:	49 63 f7             	movslq %r15d,%rsi
+  800967:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  80096b:	48 b8 81 0e 80 00 00 	movabs $0x800e81,%rax
+  800972:	00 00 00 
+  800975:	ff d0                	call   *%rax
+  800977:	48 89 c2             	mov    %rax,%rdx
+  80097a:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80097d:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80097f:	8d 70 ff             	lea    -0x1(%rax),%esi
+  800982:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800985:	85 c0                	test   %eax,%eax
+  800987:	7e 91                	jle    80091a <vprintfmt+0x24b>
+  800989:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80098e:	4c 89 ee             	mov    %r13,%rsi
+  800991:	44 89 e7             	mov    %r12d,%edi
+  800994:	41 ff d6             	call   *%r14
+  800997:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80099b:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80099e:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8009a1:	75 eb                	jne    80098e <vprintfmt+0x2bf>
+  8009a3:	e9 72 ff ff ff       	jmp    80091a <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009a8:	0f b6 f8             	movzbl %al,%edi
+  8009ab:	4c 89 ee             	mov    %r13,%rsi
+  8009ae:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8009b1:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8009b5:	49 83 c4 01          	add    $0x1,%r12
+  8009b9:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  8009bf:	84 c0                	test   %al,%al
+  8009c1:	0f 84 66 ff ff ff    	je     80092d <vprintfmt+0x25e>
+  8009c7:	45 85 ff             	test   %r15d,%r15d
+  8009ca:	78 0a                	js     8009d6 <vprintfmt+0x307>
+  8009cc:	41 83 ef 01          	sub    $0x1,%r15d
+  8009d0:	0f 88 57 ff ff ff    	js     80092d <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  8009d6:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  8009da:	74 cc                	je     8009a8 <vprintfmt+0x2d9>
+  8009dc:	8d 50 e0             	lea    -0x20(%rax),%edx
+  8009df:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  8009e4:	80 fa 5e             	cmp    $0x5e,%dl
+  8009e7:	77 c2                	ja     8009ab <vprintfmt+0x2dc>
+  8009e9:	eb bd                	jmp    8009a8 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  8009eb:	40 84 f6             	test   %sil,%sil
+  8009ee:	75 26                	jne    800a16 <vprintfmt+0x347>
+    switch (lflag) {
+  8009f0:	85 d2                	test   %edx,%edx
+  8009f2:	74 59                	je     800a4d <vprintfmt+0x37e>
+  8009f4:	83 fa 01             	cmp    $0x1,%edx
+  8009f7:	74 7b                	je     800a74 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  8009f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8009ff:	0f 87 96 00 00 00    	ja     800a9b <vprintfmt+0x3cc>
+  800a05:	89 c2                	mov    %eax,%edx
+  800a07:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0b:	83 c0 08             	add    $0x8,%eax
+  800a0e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a11:	4c 8b 22             	mov    (%rdx),%r12
+  800a14:	eb 17                	jmp    800a2d <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  800a16:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a19:	83 f8 2f             	cmp    $0x2f,%eax
+  800a1c:	77 21                	ja     800a3f <vprintfmt+0x370>
+  800a1e:	89 c2                	mov    %eax,%edx
+  800a20:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a24:	83 c0 08             	add    $0x8,%eax
+  800a27:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a2a:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  800a2d:	4d 85 e4             	test   %r12,%r12
+  800a30:	78 7a                	js     800aac <vprintfmt+0x3dd>
+            num = i;
+  800a32:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  800a35:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  800a3a:	e9 50 02 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a3f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a43:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a47:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a4b:	eb dd                	jmp    800a2a <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  800a4d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a50:	83 f8 2f             	cmp    $0x2f,%eax
+  800a53:	77 11                	ja     800a66 <vprintfmt+0x397>
+  800a55:	89 c2                	mov    %eax,%edx
+  800a57:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a5b:	83 c0 08             	add    $0x8,%eax
+  800a5e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a61:	4c 63 22             	movslq (%rdx),%r12
+  800a64:	eb c7                	jmp    800a2d <vprintfmt+0x35e>
+  800a66:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a6a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a6e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a72:	eb ed                	jmp    800a61 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800a74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a77:	83 f8 2f             	cmp    $0x2f,%eax
+  800a7a:	77 11                	ja     800a8d <vprintfmt+0x3be>
+  800a7c:	89 c2                	mov    %eax,%edx
+  800a7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a82:	83 c0 08             	add    $0x8,%eax
+  800a85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a88:	4c 8b 22             	mov    (%rdx),%r12
+  800a8b:	eb a0                	jmp    800a2d <vprintfmt+0x35e>
+  800a8d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a91:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a95:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a99:	eb ed                	jmp    800a88 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800a9b:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a9f:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800aa3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800aa7:	e9 65 ff ff ff       	jmp    800a11 <vprintfmt+0x342>
+                putch('-', put_arg);
+  800aac:	4c 89 ee             	mov    %r13,%rsi
+  800aaf:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800ab4:	41 ff d6             	call   *%r14
+                i = -i;
+  800ab7:	49 f7 dc             	neg    %r12
+  800aba:	e9 73 ff ff ff       	jmp    800a32 <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  800abf:	40 84 f6             	test   %sil,%sil
+  800ac2:	75 32                	jne    800af6 <vprintfmt+0x427>
+    switch (lflag) {
+  800ac4:	85 d2                	test   %edx,%edx
+  800ac6:	74 5d                	je     800b25 <vprintfmt+0x456>
+  800ac8:	83 fa 01             	cmp    $0x1,%edx
+  800acb:	0f 84 82 00 00 00    	je     800b53 <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  800ad1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ad4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ad7:	0f 87 a5 00 00 00    	ja     800b82 <vprintfmt+0x4b3>
+  800add:	89 c2                	mov    %eax,%edx
+  800adf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ae3:	83 c0 08             	add    $0x8,%eax
+  800ae6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ae9:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800aec:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  800af1:	e9 99 01 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800af6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800af9:	83 f8 2f             	cmp    $0x2f,%eax
+  800afc:	77 19                	ja     800b17 <vprintfmt+0x448>
+  800afe:	89 c2                	mov    %eax,%edx
+  800b00:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b04:	83 c0 08             	add    $0x8,%eax
+  800b07:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b0a:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b0d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800b12:	e9 78 01 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+  800b17:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b1f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b23:	eb e5                	jmp    800b0a <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  800b25:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b28:	83 f8 2f             	cmp    $0x2f,%eax
+  800b2b:	77 18                	ja     800b45 <vprintfmt+0x476>
+  800b2d:	89 c2                	mov    %eax,%edx
+  800b2f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b33:	83 c0 08             	add    $0x8,%eax
+  800b36:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b39:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  800b3b:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  800b40:	e9 4a 01 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+  800b45:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b49:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b4d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b51:	eb e6                	jmp    800b39 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  800b53:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800b56:	83 f8 2f             	cmp    $0x2f,%eax
+  800b59:	77 19                	ja     800b74 <vprintfmt+0x4a5>
+  800b5b:	89 c2                	mov    %eax,%edx
+  800b5d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800b61:	83 c0 08             	add    $0x8,%eax
+  800b64:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800b67:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800b6a:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  800b6f:	e9 1b 01 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+  800b74:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b78:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b7c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b80:	eb e5                	jmp    800b67 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  800b82:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b86:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b8a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b8e:	e9 56 ff ff ff       	jmp    800ae9 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  800b93:	40 84 f6             	test   %sil,%sil
+  800b96:	75 2e                	jne    800bc6 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800b98:	85 d2                	test   %edx,%edx
+  800b9a:	74 59                	je     800bf5 <vprintfmt+0x526>
+  800b9c:	83 fa 01             	cmp    $0x1,%edx
+  800b9f:	74 7f                	je     800c20 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  800ba1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ba4:	83 f8 2f             	cmp    $0x2f,%eax
+  800ba7:	0f 87 9f 00 00 00    	ja     800c4c <vprintfmt+0x57d>
+  800bad:	89 c2                	mov    %eax,%edx
+  800baf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bb3:	83 c0 08             	add    $0x8,%eax
+  800bb6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bb9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bbc:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  800bc1:	e9 c9 00 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800bc6:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bc9:	83 f8 2f             	cmp    $0x2f,%eax
+  800bcc:	77 19                	ja     800be7 <vprintfmt+0x518>
+  800bce:	89 c2                	mov    %eax,%edx
+  800bd0:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800bd4:	83 c0 08             	add    $0x8,%eax
+  800bd7:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800bda:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800bdd:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800be2:	e9 a8 00 00 00       	jmp    800c8f <vprintfmt+0x5c0>
+  800be7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800beb:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800bef:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bf3:	eb e5                	jmp    800bda <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800bf5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800bf8:	83 f8 2f             	cmp    $0x2f,%eax
+  800bfb:	77 15                	ja     800c12 <vprintfmt+0x543>
+  800bfd:	89 c2                	mov    %eax,%edx
+  800bff:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c03:	83 c0 08             	add    $0x8,%eax
+  800c06:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c09:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800c0b:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  800c10:	eb 7d                	jmp    800c8f <vprintfmt+0x5c0>
+  800c12:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c16:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c1a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c1e:	eb e9                	jmp    800c09 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  800c20:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c23:	83 f8 2f             	cmp    $0x2f,%eax
+  800c26:	77 16                	ja     800c3e <vprintfmt+0x56f>
+  800c28:	89 c2                	mov    %eax,%edx
+  800c2a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c2e:	83 c0 08             	add    $0x8,%eax
+  800c31:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c34:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800c37:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  800c3c:	eb 51                	jmp    800c8f <vprintfmt+0x5c0>
+  800c3e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c42:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c46:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c4a:	eb e8                	jmp    800c34 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  800c4c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800c50:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800c54:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800c58:	e9 5c ff ff ff       	jmp    800bb9 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  800c5d:	4c 89 ee             	mov    %r13,%rsi
+  800c60:	bf 30 00 00 00       	mov    $0x30,%edi
+  800c65:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  800c68:	4c 89 ee             	mov    %r13,%rsi
+  800c6b:	bf 78 00 00 00       	mov    $0x78,%edi
+  800c70:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  800c73:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800c76:	83 f8 2f             	cmp    $0x2f,%eax
+  800c79:	77 47                	ja     800cc2 <vprintfmt+0x5f3>
+  800c7b:	89 c2                	mov    %eax,%edx
+  800c7d:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800c81:	83 c0 08             	add    $0x8,%eax
+  800c84:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800c87:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800c8a:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800c8f:	48 83 ec 08          	sub    $0x8,%rsp
+  800c93:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800c97:	0f 94 c0             	sete   %al
+  800c9a:	0f b6 c0             	movzbl %al,%eax
+  800c9d:	50                   	push   %rax
+  800c9e:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800ca3:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800ca7:	4c 89 ee             	mov    %r13,%rsi
+  800caa:	4c 89 f7             	mov    %r14,%rdi
+  800cad:	48 b8 c4 05 80 00 00 	movabs $0x8005c4,%rax
+  800cb4:	00 00 00 
+  800cb7:	ff d0                	call   *%rax
+            break;
+  800cb9:	48 83 c4 10          	add    $0x10,%rsp
+  800cbd:	e9 3e fa ff ff       	jmp    800700 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800cc2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800cc6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800cca:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800cce:	eb b7                	jmp    800c87 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800cd0:	40 84 f6             	test   %sil,%sil
+  800cd3:	75 2b                	jne    800d00 <vprintfmt+0x631>
+    switch (lflag) {
+  800cd5:	85 d2                	test   %edx,%edx
+  800cd7:	74 56                	je     800d2f <vprintfmt+0x660>
+  800cd9:	83 fa 01             	cmp    $0x1,%edx
+  800cdc:	74 7f                	je     800d5d <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800cde:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ce1:	83 f8 2f             	cmp    $0x2f,%eax
+  800ce4:	0f 87 a2 00 00 00    	ja     800d8c <vprintfmt+0x6bd>
+  800cea:	89 c2                	mov    %eax,%edx
+  800cec:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800cf0:	83 c0 08             	add    $0x8,%eax
+  800cf3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800cf6:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800cf9:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800cfe:	eb 8f                	jmp    800c8f <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800d00:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d03:	83 f8 2f             	cmp    $0x2f,%eax
+  800d06:	77 19                	ja     800d21 <vprintfmt+0x652>
+  800d08:	89 c2                	mov    %eax,%edx
+  800d0a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d0e:	83 c0 08             	add    $0x8,%eax
+  800d11:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d14:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d17:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800d1c:	e9 6e ff ff ff       	jmp    800c8f <vprintfmt+0x5c0>
+  800d21:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d25:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d29:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d2d:	eb e5                	jmp    800d14 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800d2f:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d32:	83 f8 2f             	cmp    $0x2f,%eax
+  800d35:	77 18                	ja     800d4f <vprintfmt+0x680>
+  800d37:	89 c2                	mov    %eax,%edx
+  800d39:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d3d:	83 c0 08             	add    $0x8,%eax
+  800d40:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d43:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800d45:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800d4a:	e9 40 ff ff ff       	jmp    800c8f <vprintfmt+0x5c0>
+  800d4f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d53:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d57:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d5b:	eb e6                	jmp    800d43 <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800d5d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800d60:	83 f8 2f             	cmp    $0x2f,%eax
+  800d63:	77 19                	ja     800d7e <vprintfmt+0x6af>
+  800d65:	89 c2                	mov    %eax,%edx
+  800d67:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800d6b:	83 c0 08             	add    $0x8,%eax
+  800d6e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800d71:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800d74:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800d79:	e9 11 ff ff ff       	jmp    800c8f <vprintfmt+0x5c0>
+  800d7e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d82:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d86:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d8a:	eb e5                	jmp    800d71 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800d8c:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800d90:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800d94:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d98:	e9 59 ff ff ff       	jmp    800cf6 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800d9d:	4c 89 ee             	mov    %r13,%rsi
+  800da0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800da5:	41 ff d6             	call   *%r14
+            break;
+  800da8:	e9 53 f9 ff ff       	jmp    800700 <vprintfmt+0x31>
+            putch('%', put_arg);
+  800dad:	4c 89 ee             	mov    %r13,%rsi
+  800db0:	bf 25 00 00 00       	mov    $0x25,%edi
+  800db5:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800db8:	48 83 eb 01          	sub    $0x1,%rbx
+  800dbc:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800dc0:	75 f6                	jne    800db8 <vprintfmt+0x6e9>
+  800dc2:	e9 39 f9 ff ff       	jmp    800700 <vprintfmt+0x31>
+}
+  800dc7:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800dcb:	5b                   	pop    %rbx
+  800dcc:	41 5c                	pop    %r12
+  800dce:	41 5d                	pop    %r13
+  800dd0:	41 5e                	pop    %r14
+  800dd2:	41 5f                	pop    %r15
+  800dd4:	5d                   	pop    %rbp
+  800dd5:	c3                   	ret
+
+0000000000800dd6 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800dd6:	55                   	push   %rbp
+  800dd7:	48 89 e5             	mov    %rsp,%rbp
+  800dda:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800dde:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800de2:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800de7:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800deb:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800df2:	48 85 ff             	test   %rdi,%rdi
+  800df5:	74 2b                	je     800e22 <vsnprintf+0x4c>
+  800df7:	48 85 f6             	test   %rsi,%rsi
+  800dfa:	74 26                	je     800e22 <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800dfc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800e00:	48 bf 7a 06 80 00 00 	movabs $0x80067a,%rdi
+  800e07:	00 00 00 
+  800e0a:	48 b8 cf 06 80 00 00 	movabs $0x8006cf,%rax
+  800e11:	00 00 00 
+  800e14:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800e16:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800e1a:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800e1d:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800e20:	c9                   	leave
+  800e21:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800e22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800e27:	eb f7                	jmp    800e20 <vsnprintf+0x4a>
+
+0000000000800e29 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800e29:	55                   	push   %rbp
+  800e2a:	48 89 e5             	mov    %rsp,%rbp
+  800e2d:	48 83 ec 50          	sub    $0x50,%rsp
+  800e31:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800e35:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800e39:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800e3d:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e44:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e48:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e4c:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e50:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800e54:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e58:	48 b8 d6 0d 80 00 00 	movabs $0x800dd6,%rax
+  800e5f:	00 00 00 
+  800e62:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800e64:	c9                   	leave
+  800e65:	c3                   	ret
+
+0000000000800e66 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800e66:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800e69:	74 10                	je     800e7b <strlen+0x15>
+    size_t n = 0;
+  800e6b:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800e70:	48 83 c0 01          	add    $0x1,%rax
+  800e74:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800e78:	75 f6                	jne    800e70 <strlen+0xa>
+  800e7a:	c3                   	ret
+    size_t n = 0;
+  800e7b:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800e80:	c3                   	ret
+
+0000000000800e81 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800e81:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800e84:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800e89:	48 85 f6             	test   %rsi,%rsi
+  800e8c:	74 11                	je     800e9f <strnlen+0x1e>
+  800e8e:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800e92:	74 0c                	je     800ea0 <strnlen+0x1f>
+  800e94:	48 83 c2 01          	add    $0x1,%rdx
+  800e98:	48 39 d0             	cmp    %rdx,%rax
+  800e9b:	75 f1                	jne    800e8e <strnlen+0xd>
+  800e9d:	eb 04                	jmp    800ea3 <strnlen+0x22>
+  800e9f:	c3                   	ret
+  800ea0:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800ea3:	c3                   	ret
+
+0000000000800ea4 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800ea4:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800ea7:	ba 00 00 00 00       	mov    $0x0,%edx
+  800eac:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800eb0:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800eb3:	48 83 c2 01          	add    $0x1,%rdx
+  800eb7:	84 c9                	test   %cl,%cl
+  800eb9:	75 f1                	jne    800eac <strcpy+0x8>
+        ;
+    return res;
+}
+  800ebb:	c3                   	ret
+
+0000000000800ebc <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800ebc:	55                   	push   %rbp
+  800ebd:	48 89 e5             	mov    %rsp,%rbp
+  800ec0:	41 54                	push   %r12
+  800ec2:	53                   	push   %rbx
+  800ec3:	48 89 fb             	mov    %rdi,%rbx
+  800ec6:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800ec9:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  800ed0:	00 00 00 
+  800ed3:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800ed5:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800ed9:	4c 89 e6             	mov    %r12,%rsi
+  800edc:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  800ee3:	00 00 00 
+  800ee6:	ff d0                	call   *%rax
+    return dst;
+}
+  800ee8:	48 89 d8             	mov    %rbx,%rax
+  800eeb:	5b                   	pop    %rbx
+  800eec:	41 5c                	pop    %r12
+  800eee:	5d                   	pop    %rbp
+  800eef:	c3                   	ret
+
+0000000000800ef0 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800ef0:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800ef3:	48 85 d2             	test   %rdx,%rdx
+  800ef6:	74 1f                	je     800f17 <strncpy+0x27>
+  800ef8:	48 01 fa             	add    %rdi,%rdx
+  800efb:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800efe:	48 83 c1 01          	add    $0x1,%rcx
+  800f02:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800f06:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800f0a:	41 80 f8 01          	cmp    $0x1,%r8b
+  800f0e:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800f12:	48 39 ca             	cmp    %rcx,%rdx
+  800f15:	75 e7                	jne    800efe <strncpy+0xe>
+    }
+    return ret;
+}
+  800f17:	c3                   	ret
+
+0000000000800f18 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800f18:	48 89 f8             	mov    %rdi,%rax
+  800f1b:	48 85 d2             	test   %rdx,%rdx
+  800f1e:	74 24                	je     800f44 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800f20:	48 83 ea 01          	sub    $0x1,%rdx
+  800f24:	74 1b                	je     800f41 <strlcpy+0x29>
+  800f26:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800f2a:	0f b6 16             	movzbl (%rsi),%edx
+  800f2d:	84 d2                	test   %dl,%dl
+  800f2f:	74 10                	je     800f41 <strlcpy+0x29>
+            *dst++ = *src++;
+  800f31:	48 83 c6 01          	add    $0x1,%rsi
+  800f35:	48 83 c0 01          	add    $0x1,%rax
+  800f39:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800f3c:	48 39 c8             	cmp    %rcx,%rax
+  800f3f:	75 e9                	jne    800f2a <strlcpy+0x12>
+        *dst = '\0';
+  800f41:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800f44:	48 29 f8             	sub    %rdi,%rax
+}
+  800f47:	c3                   	ret
+
+0000000000800f48 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800f48:	0f b6 07             	movzbl (%rdi),%eax
+  800f4b:	84 c0                	test   %al,%al
+  800f4d:	74 13                	je     800f62 <strcmp+0x1a>
+  800f4f:	38 06                	cmp    %al,(%rsi)
+  800f51:	75 0f                	jne    800f62 <strcmp+0x1a>
+  800f53:	48 83 c7 01          	add    $0x1,%rdi
+  800f57:	48 83 c6 01          	add    $0x1,%rsi
+  800f5b:	0f b6 07             	movzbl (%rdi),%eax
+  800f5e:	84 c0                	test   %al,%al
+  800f60:	75 ed                	jne    800f4f <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f62:	0f b6 c0             	movzbl %al,%eax
+  800f65:	0f b6 16             	movzbl (%rsi),%edx
+  800f68:	29 d0                	sub    %edx,%eax
+}
+  800f6a:	c3                   	ret
+
+0000000000800f6b <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800f6b:	48 85 d2             	test   %rdx,%rdx
+  800f6e:	74 1f                	je     800f8f <strncmp+0x24>
+  800f70:	0f b6 07             	movzbl (%rdi),%eax
+  800f73:	84 c0                	test   %al,%al
+  800f75:	74 1e                	je     800f95 <strncmp+0x2a>
+  800f77:	3a 06                	cmp    (%rsi),%al
+  800f79:	75 1a                	jne    800f95 <strncmp+0x2a>
+  800f7b:	48 83 c7 01          	add    $0x1,%rdi
+  800f7f:	48 83 c6 01          	add    $0x1,%rsi
+  800f83:	48 83 ea 01          	sub    $0x1,%rdx
+  800f87:	75 e7                	jne    800f70 <strncmp+0x5>
+
+    if (!n) return 0;
+  800f89:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f8e:	c3                   	ret
+  800f8f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f94:	c3                   	ret
+  800f95:	48 85 d2             	test   %rdx,%rdx
+  800f98:	74 09                	je     800fa3 <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800f9a:	0f b6 07             	movzbl (%rdi),%eax
+  800f9d:	0f b6 16             	movzbl (%rsi),%edx
+  800fa0:	29 d0                	sub    %edx,%eax
+  800fa2:	c3                   	ret
+    if (!n) return 0;
+  800fa3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800fa8:	c3                   	ret
+
+0000000000800fa9 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800fa9:	0f b6 17             	movzbl (%rdi),%edx
+  800fac:	84 d2                	test   %dl,%dl
+  800fae:	74 18                	je     800fc8 <strchr+0x1f>
+        if (*str == c) {
+  800fb0:	0f be d2             	movsbl %dl,%edx
+  800fb3:	39 f2                	cmp    %esi,%edx
+  800fb5:	74 17                	je     800fce <strchr+0x25>
+    for (; *str; str++) {
+  800fb7:	48 83 c7 01          	add    $0x1,%rdi
+  800fbb:	0f b6 17             	movzbl (%rdi),%edx
+  800fbe:	84 d2                	test   %dl,%dl
+  800fc0:	75 ee                	jne    800fb0 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800fc2:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fc7:	c3                   	ret
+  800fc8:	b8 00 00 00 00       	mov    $0x0,%eax
+  800fcd:	c3                   	ret
+  800fce:	48 89 f8             	mov    %rdi,%rax
+}
+  800fd1:	c3                   	ret
+
+0000000000800fd2 <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800fd2:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800fd5:	0f b6 17             	movzbl (%rdi),%edx
+  800fd8:	84 d2                	test   %dl,%dl
+  800fda:	74 13                	je     800fef <strfind+0x1d>
+  800fdc:	0f be d2             	movsbl %dl,%edx
+  800fdf:	39 f2                	cmp    %esi,%edx
+  800fe1:	74 0b                	je     800fee <strfind+0x1c>
+  800fe3:	48 83 c0 01          	add    $0x1,%rax
+  800fe7:	0f b6 10             	movzbl (%rax),%edx
+  800fea:	84 d2                	test   %dl,%dl
+  800fec:	75 ee                	jne    800fdc <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800fee:	c3                   	ret
+  800fef:	c3                   	ret
+
+0000000000800ff0 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800ff0:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800ff3:	48 89 f8             	mov    %rdi,%rax
+  800ff6:	48 f7 d8             	neg    %rax
+  800ff9:	83 e0 07             	and    $0x7,%eax
+  800ffc:	49 89 d1             	mov    %rdx,%r9
+  800fff:	49 29 c1             	sub    %rax,%r9
+  801002:	78 36                	js     80103a <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  801004:	40 0f b6 c6          	movzbl %sil,%eax
+  801008:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  80100f:	01 01 01 
+  801012:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  801016:	40 f6 c7 07          	test   $0x7,%dil
+  80101a:	75 38                	jne    801054 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  80101c:	4c 89 c9             	mov    %r9,%rcx
+  80101f:	48 c1 f9 03          	sar    $0x3,%rcx
+  801023:	74 0c                	je     801031 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  801025:	fc                   	cld
+  801026:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801029:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  80102d:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801031:	4d 85 c9             	test   %r9,%r9
+  801034:	75 45                	jne    80107b <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  801036:	4c 89 c0             	mov    %r8,%rax
+  801039:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  80103a:	48 85 d2             	test   %rdx,%rdx
+  80103d:	74 f7                	je     801036 <memset+0x46>
+  80103f:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  801042:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  801045:	48 83 c0 01          	add    $0x1,%rax
+  801049:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  80104d:	48 39 c2             	cmp    %rax,%rdx
+  801050:	75 f3                	jne    801045 <memset+0x55>
+  801052:	eb e2                	jmp    801036 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  801054:	40 f6 c7 01          	test   $0x1,%dil
+  801058:	74 06                	je     801060 <memset+0x70>
+  80105a:	88 07                	mov    %al,(%rdi)
+  80105c:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801060:	40 f6 c7 02          	test   $0x2,%dil
+  801064:	74 07                	je     80106d <memset+0x7d>
+  801066:	66 89 07             	mov    %ax,(%rdi)
+  801069:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80106d:	40 f6 c7 04          	test   $0x4,%dil
+  801071:	74 a9                	je     80101c <memset+0x2c>
+  801073:	89 07                	mov    %eax,(%rdi)
+  801075:	48 83 c7 04          	add    $0x4,%rdi
+  801079:	eb a1                	jmp    80101c <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  80107b:	41 f6 c1 04          	test   $0x4,%r9b
+  80107f:	74 06                	je     801087 <memset+0x97>
+  801081:	89 07                	mov    %eax,(%rdi)
+  801083:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  801087:	41 f6 c1 02          	test   $0x2,%r9b
+  80108b:	74 07                	je     801094 <memset+0xa4>
+  80108d:	66 89 07             	mov    %ax,(%rdi)
+  801090:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  801094:	41 f6 c1 01          	test   $0x1,%r9b
+  801098:	74 9c                	je     801036 <memset+0x46>
+  80109a:	88 07                	mov    %al,(%rdi)
+  80109c:	eb 98                	jmp    801036 <memset+0x46>
+
+000000000080109e <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  80109e:	48 89 f8             	mov    %rdi,%rax
+  8010a1:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8010a4:	48 39 fe             	cmp    %rdi,%rsi
+  8010a7:	73 3b                	jae    8010e4 <memmove+0x46>
+  8010a9:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  8010ad:	48 39 d7             	cmp    %rdx,%rdi
+  8010b0:	73 32                	jae    8010e4 <memmove+0x46>
+        s += n;
+        d += n;
+  8010b2:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010b6:	48 89 d6             	mov    %rdx,%rsi
+  8010b9:	48 09 fe             	or     %rdi,%rsi
+  8010bc:	48 09 ce             	or     %rcx,%rsi
+  8010bf:	40 f6 c6 07          	test   $0x7,%sil
+  8010c3:	75 12                	jne    8010d7 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  8010c5:	48 83 ef 08          	sub    $0x8,%rdi
+  8010c9:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  8010cd:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010d1:	fd                   	std
+  8010d2:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  8010d5:	fc                   	cld
+  8010d6:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  8010d7:	48 83 ef 01          	sub    $0x1,%rdi
+  8010db:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  8010df:	fd                   	std
+  8010e0:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  8010e2:	eb f1                	jmp    8010d5 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  8010e4:	48 89 f2             	mov    %rsi,%rdx
+  8010e7:	48 09 c2             	or     %rax,%rdx
+  8010ea:	48 09 ca             	or     %rcx,%rdx
+  8010ed:	f6 c2 07             	test   $0x7,%dl
+  8010f0:	75 0c                	jne    8010fe <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  8010f2:	48 c1 e9 03          	shr    $0x3,%rcx
+  8010f6:	48 89 c7             	mov    %rax,%rdi
+  8010f9:	fc                   	cld
+  8010fa:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  8010fd:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  8010fe:	48 89 c7             	mov    %rax,%rdi
+  801101:	fc                   	cld
+  801102:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  801104:	c3                   	ret
+
+0000000000801105 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  801105:	55                   	push   %rbp
+  801106:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801109:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  801110:	00 00 00 
+  801113:	ff d0                	call   *%rax
+}
+  801115:	5d                   	pop    %rbp
+  801116:	c3                   	ret
+
+0000000000801117 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  801117:	55                   	push   %rbp
+  801118:	48 89 e5             	mov    %rsp,%rbp
+  80111b:	41 57                	push   %r15
+  80111d:	41 56                	push   %r14
+  80111f:	41 55                	push   %r13
+  801121:	41 54                	push   %r12
+  801123:	53                   	push   %rbx
+  801124:	48 83 ec 08          	sub    $0x8,%rsp
+  801128:	49 89 fe             	mov    %rdi,%r14
+  80112b:	49 89 f7             	mov    %rsi,%r15
+  80112e:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801131:	48 89 f7             	mov    %rsi,%rdi
+  801134:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  80113b:	00 00 00 
+  80113e:	ff d0                	call   *%rax
+  801140:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  801143:	48 89 de             	mov    %rbx,%rsi
+  801146:	4c 89 f7             	mov    %r14,%rdi
+  801149:	48 b8 81 0e 80 00 00 	movabs $0x800e81,%rax
+  801150:	00 00 00 
+  801153:	ff d0                	call   *%rax
+  801155:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  801158:	48 39 c3             	cmp    %rax,%rbx
+  80115b:	74 36                	je     801193 <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  80115d:	48 89 d8             	mov    %rbx,%rax
+  801160:	4c 29 e8             	sub    %r13,%rax
+  801163:	49 39 c4             	cmp    %rax,%r12
+  801166:	73 31                	jae    801199 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  801168:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  80116d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  801171:	4c 89 fe             	mov    %r15,%rsi
+  801174:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  80117b:	00 00 00 
+  80117e:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  801180:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  801184:	48 83 c4 08          	add    $0x8,%rsp
+  801188:	5b                   	pop    %rbx
+  801189:	41 5c                	pop    %r12
+  80118b:	41 5d                	pop    %r13
+  80118d:	41 5e                	pop    %r14
+  80118f:	41 5f                	pop    %r15
+  801191:	5d                   	pop    %rbp
+  801192:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  801193:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  801197:	eb eb                	jmp    801184 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  801199:	48 83 eb 01          	sub    $0x1,%rbx
+  80119d:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8011a1:	48 89 da             	mov    %rbx,%rdx
+  8011a4:	4c 89 fe             	mov    %r15,%rsi
+  8011a7:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8011ae:	00 00 00 
+  8011b1:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  8011b3:	49 01 de             	add    %rbx,%r14
+  8011b6:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  8011bb:	eb c3                	jmp    801180 <strlcat+0x69>
+
+00000000008011bd <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  8011bd:	48 85 d2             	test   %rdx,%rdx
+  8011c0:	74 2d                	je     8011ef <memcmp+0x32>
+  8011c2:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  8011c7:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  8011cb:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  8011d0:	44 38 c1             	cmp    %r8b,%cl
+  8011d3:	75 0f                	jne    8011e4 <memcmp+0x27>
+    while (n-- > 0) {
+  8011d5:	48 83 c0 01          	add    $0x1,%rax
+  8011d9:	48 39 c2             	cmp    %rax,%rdx
+  8011dc:	75 e9                	jne    8011c7 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  8011de:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011e3:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  8011e4:	0f b6 c1             	movzbl %cl,%eax
+  8011e7:	45 0f b6 c0          	movzbl %r8b,%r8d
+  8011eb:	44 29 c0             	sub    %r8d,%eax
+  8011ee:	c3                   	ret
+    return 0;
+  8011ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8011f4:	c3                   	ret
+
+00000000008011f5 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  8011f5:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  8011f9:	48 39 c7             	cmp    %rax,%rdi
+  8011fc:	73 0f                	jae    80120d <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  8011fe:	40 38 37             	cmp    %sil,(%rdi)
+  801201:	74 0e                	je     801211 <memfind+0x1c>
+    for (; src < end; src++) {
+  801203:	48 83 c7 01          	add    $0x1,%rdi
+  801207:	48 39 f8             	cmp    %rdi,%rax
+  80120a:	75 f2                	jne    8011fe <memfind+0x9>
+  80120c:	c3                   	ret
+  80120d:	48 89 f8             	mov    %rdi,%rax
+  801210:	c3                   	ret
+  801211:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  801214:	c3                   	ret
+
+0000000000801215 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  801215:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801218:	0f b6 37             	movzbl (%rdi),%esi
+  80121b:	40 80 fe 20          	cmp    $0x20,%sil
+  80121f:	74 06                	je     801227 <strtol+0x12>
+  801221:	40 80 fe 09          	cmp    $0x9,%sil
+  801225:	75 13                	jne    80123a <strtol+0x25>
+  801227:	48 83 c7 01          	add    $0x1,%rdi
+  80122b:	0f b6 37             	movzbl (%rdi),%esi
+  80122e:	40 80 fe 20          	cmp    $0x20,%sil
+  801232:	74 f3                	je     801227 <strtol+0x12>
+  801234:	40 80 fe 09          	cmp    $0x9,%sil
+  801238:	74 ed                	je     801227 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  80123a:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  80123d:	83 e0 fd             	and    $0xfffffffd,%eax
+  801240:	3c 01                	cmp    $0x1,%al
+  801242:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801246:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  80124c:	75 0f                	jne    80125d <strtol+0x48>
+  80124e:	80 3f 30             	cmpb   $0x30,(%rdi)
+  801251:	74 14                	je     801267 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  801253:	85 d2                	test   %edx,%edx
+  801255:	b8 0a 00 00 00       	mov    $0xa,%eax
+  80125a:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  80125d:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  801262:	4c 63 ca             	movslq %edx,%r9
+  801265:	eb 36                	jmp    80129d <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  801267:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  80126b:	74 0f                	je     80127c <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  80126d:	85 d2                	test   %edx,%edx
+  80126f:	75 ec                	jne    80125d <strtol+0x48>
+        s++;
+  801271:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801275:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  80127a:	eb e1                	jmp    80125d <strtol+0x48>
+        s += 2;
+  80127c:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  801280:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801285:	eb d6                	jmp    80125d <strtol+0x48>
+            dig -= '0';
+  801287:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  80128a:	44 0f b6 c1          	movzbl %cl,%r8d
+  80128e:	41 39 d0             	cmp    %edx,%r8d
+  801291:	7d 21                	jge    8012b4 <strtol+0x9f>
+        val = val * base + dig;
+  801293:	49 0f af c1          	imul   %r9,%rax
+  801297:	0f b6 c9             	movzbl %cl,%ecx
+  80129a:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  80129d:	48 83 c7 01          	add    $0x1,%rdi
+  8012a1:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8012a5:	80 f9 39             	cmp    $0x39,%cl
+  8012a8:	76 dd                	jbe    801287 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  8012aa:	80 f9 7b             	cmp    $0x7b,%cl
+  8012ad:	77 05                	ja     8012b4 <strtol+0x9f>
+            dig -= 'a' - 10;
+  8012af:	83 e9 57             	sub    $0x57,%ecx
+  8012b2:	eb d6                	jmp    80128a <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  8012b4:	4d 85 d2             	test   %r10,%r10
+  8012b7:	74 03                	je     8012bc <strtol+0xa7>
+  8012b9:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  8012bc:	48 89 c2             	mov    %rax,%rdx
+  8012bf:	48 f7 da             	neg    %rdx
+  8012c2:	40 80 fe 2d          	cmp    $0x2d,%sil
+  8012c6:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  8012ca:	c3                   	ret
+
+00000000008012cb <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  8012cb:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012d0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012d5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012db:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012e1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  8012e7:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  8012e9:	c3                   	ret
+
+00000000008012ea <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  8012ea:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8012ef:	bf 00 00 00 00       	mov    $0x0,%edi
+  8012f4:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012f9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fe:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801304:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80130a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801310:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801312:	c3                   	ret
+
+0000000000801313 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801313:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801316:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80131b:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801320:	ba 00 00 00 00       	mov    $0x0,%edx
+  801325:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80132b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801331:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801337:	0f 05                	syscall
+    if (check && ret > 0) {
+  801339:	48 85 c0             	test   %rax,%rax
+  80133c:	7f 01                	jg     80133f <sys_env_destroy+0x2c>
+}
+  80133e:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  80133f:	55                   	push   %rbp
+  801340:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801343:	49 89 c0             	mov    %rax,%r8
+  801346:	b9 03 00 00 00       	mov    $0x3,%ecx
+  80134b:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801352:	00 00 00 
+  801355:	be 29 00 00 00       	mov    $0x29,%esi
+  80135a:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801361:	00 00 00 
+  801364:	b8 00 00 00 00       	mov    $0x0,%eax
+  801369:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801370:	00 00 00 
+  801373:	41 ff d1             	call   *%r9
+
+0000000000801376 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801376:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80137b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801380:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801385:	ba 00 00 00 00       	mov    $0x0,%edx
+  80138a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801390:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801396:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80139c:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80139e:	c3                   	ret
+
+000000000080139f <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80139f:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8013a4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8013a9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8013b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013c5:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  8013c7:	c3                   	ret
+
+00000000008013c8 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013c8:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013cd:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8013d4:	00 00 00 
+  8013d7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013dd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013e3:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013e9:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  8013eb:	c3                   	ret
+
+00000000008013ec <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  8013ec:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  8013ef:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013f4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8013fa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801400:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801402:	c3                   	ret
+
+0000000000801403 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801403:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801406:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80140b:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80140e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801414:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80141a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80141c:	48 85 c0             	test   %rax,%rax
+  80141f:	7f 01                	jg     801422 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801421:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801422:	55                   	push   %rbp
+  801423:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801426:	49 89 c0             	mov    %rax,%r8
+  801429:	b9 04 00 00 00       	mov    $0x4,%ecx
+  80142e:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801435:	00 00 00 
+  801438:	be 29 00 00 00       	mov    $0x29,%esi
+  80143d:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801444:	00 00 00 
+  801447:	b8 00 00 00 00       	mov    $0x0,%eax
+  80144c:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801453:	00 00 00 
+  801456:	41 ff d1             	call   *%r9
+
+0000000000801459 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801459:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80145c:	48 63 d2             	movslq %edx,%rdx
+  80145f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801462:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801467:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  80146a:	0f 05                	syscall
+    if (check && ret > 0) {
+  80146c:	48 85 c0             	test   %rax,%rax
+  80146f:	7f 01                	jg     801472 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  801471:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  801472:	55                   	push   %rbp
+  801473:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801476:	49 89 c0             	mov    %rax,%r8
+  801479:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80147e:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801485:	00 00 00 
+  801488:	be 29 00 00 00       	mov    $0x29,%esi
+  80148d:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801494:	00 00 00 
+  801497:	b8 00 00 00 00       	mov    $0x0,%eax
+  80149c:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  8014a3:	00 00 00 
+  8014a6:	41 ff d1             	call   *%r9
+
+00000000008014a9 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  8014a9:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8014ac:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014c3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8014c5:	48 85 c0             	test   %rax,%rax
+  8014c8:	7f 01                	jg     8014cb <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  8014ca:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  8014cb:	55                   	push   %rbp
+  8014cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014cf:	49 89 c0             	mov    %rax,%r8
+  8014d2:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8014d7:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  8014de:	00 00 00 
+  8014e1:	be 29 00 00 00       	mov    $0x29,%esi
+  8014e6:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  8014ed:	00 00 00 
+  8014f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014f5:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  8014fc:	00 00 00 
+  8014ff:	41 ff d1             	call   *%r9
+
+0000000000801502 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  801502:	48 63 f6             	movslq %esi,%rsi
+  801505:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801508:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80150d:	ba 00 00 00 00       	mov    $0x0,%edx
+  801512:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801518:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80151e:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801524:	0f 05                	syscall
+    if (check && ret > 0) {
+  801526:	48 85 c0             	test   %rax,%rax
+  801529:	7f 01                	jg     80152c <sys_env_set_status+0x2a>
+}
+  80152b:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  80152c:	55                   	push   %rbp
+  80152d:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801530:	49 89 c0             	mov    %rax,%r8
+  801533:	b9 09 00 00 00       	mov    $0x9,%ecx
+  801538:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  80153f:	00 00 00 
+  801542:	be 29 00 00 00       	mov    $0x29,%esi
+  801547:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  80154e:	00 00 00 
+  801551:	b8 00 00 00 00       	mov    $0x0,%eax
+  801556:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  80155d:	00 00 00 
+  801560:	41 ff d1             	call   *%r9
+
+0000000000801563 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  801563:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801566:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156b:	ba 00 00 00 00       	mov    $0x0,%edx
+  801570:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801576:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80157c:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801582:	0f 05                	syscall
+    if (check && ret > 0) {
+  801584:	48 85 c0             	test   %rax,%rax
+  801587:	7f 01                	jg     80158a <sys_env_set_trapframe+0x27>
+}
+  801589:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  80158a:	55                   	push   %rbp
+  80158b:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158e:	49 89 c0             	mov    %rax,%r8
+  801591:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801596:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  80159d:	00 00 00 
+  8015a0:	be 29 00 00 00       	mov    $0x29,%esi
+  8015a5:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  8015ac:	00 00 00 
+  8015af:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b4:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  8015bb:	00 00 00 
+  8015be:	41 ff d1             	call   *%r9
+
+00000000008015c1 <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  8015c1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8015c4:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8015c9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8015ce:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8015d4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8015da:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8015e0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8015e2:	48 85 c0             	test   %rax,%rax
+  8015e5:	7f 01                	jg     8015e8 <sys_env_set_pgfault_upcall+0x27>
+}
+  8015e7:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8015e8:	55                   	push   %rbp
+  8015e9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8015ec:	49 89 c0             	mov    %rax,%r8
+  8015ef:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8015f4:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  8015fb:	00 00 00 
+  8015fe:	be 29 00 00 00       	mov    $0x29,%esi
+  801603:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  80160a:	00 00 00 
+  80160d:	b8 00 00 00 00       	mov    $0x0,%eax
+  801612:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801619:	00 00 00 
+  80161c:	41 ff d1             	call   *%r9
+
+000000000080161f <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  80161f:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801622:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801625:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80162a:	4d 63 c0             	movslq %r8d,%r8
+  80162d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801633:	0f 05                	syscall
+}
+  801635:	c3                   	ret
+
+0000000000801636 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  801636:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  801639:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80163c:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801641:	4d 63 c0             	movslq %r8d,%r8
+  801644:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80164a:	0f 05                	syscall
+}
+  80164c:	c3                   	ret
+
+000000000080164d <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80164d:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801652:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801655:	45 89 c0             	mov    %r8d,%r8d
+  801658:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80165e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801660:	48 85 c0             	test   %rax,%rax
+  801663:	7f 01                	jg     801666 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  801665:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  801666:	55                   	push   %rbp
+  801667:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80166a:	49 89 c0             	mov    %rax,%r8
+  80166d:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  801672:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801679:	00 00 00 
+  80167c:	be 29 00 00 00       	mov    $0x29,%esi
+  801681:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801688:	00 00 00 
+  80168b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801690:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801697:	00 00 00 
+  80169a:	41 ff d1             	call   *%r9
+
+000000000080169d <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80169d:	55                   	push   %rbp
+  80169e:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  8016a1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016a7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8016ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016b1:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  8016b8:	00 00 00 
+  8016bb:	ff d0                	call   *%rax
+}
+  8016bd:	5d                   	pop    %rbp
+  8016be:	c3                   	ret
+
+00000000008016bf <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016c4:	bf 00 00 00 00       	mov    $0x0,%edi
+  8016c9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016ce:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016d3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016d9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8016df:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8016e5:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8016e7:	c3                   	ret
+
+00000000008016e8 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8016e8:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8016ed:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8016f2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8016f7:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8016fd:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801703:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801709:	0f 05                	syscall
+    if (check && ret > 0) {
+  80170b:	48 85 c0             	test   %rax,%rax
+  80170e:	7f 01                	jg     801711 <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  801710:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  801711:	55                   	push   %rbp
+  801712:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801715:	49 89 c0             	mov    %rax,%r8
+  801718:	b9 10 00 00 00       	mov    $0x10,%ecx
+  80171d:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801724:	00 00 00 
+  801727:	be 29 00 00 00       	mov    $0x29,%esi
+  80172c:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801733:	00 00 00 
+  801736:	b8 00 00 00 00       	mov    $0x0,%eax
+  80173b:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801742:	00 00 00 
+  801745:	41 ff d1             	call   *%r9
+
+0000000000801748 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  801748:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80174d:	bf 00 00 00 00       	mov    $0x0,%edi
+  801752:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801757:	ba 00 00 00 00       	mov    $0x0,%edx
+  80175c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801762:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801768:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80176e:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  801770:	c3                   	ret
+
+0000000000801771 <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  801771:	89 d2                	mov    %edx,%edx
+  801773:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801775:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80177a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801780:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801786:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80178c:	0f 05                	syscall
+}
+  80178e:	c3                   	ret
+
+000000000080178f <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80178f:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801792:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801797:	ba 00 00 00 00       	mov    $0x0,%edx
+  80179c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017ae:	0f 05                	syscall
+}
+  8017b0:	c3                   	ret
+
+00000000008017b1 <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  8017b1:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  8017b4:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017b9:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017be:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017c4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017ca:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017d0:	0f 05                	syscall
+}
+  8017d2:	c3                   	ret
+
+00000000008017d3 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8017d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8017d6:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8017db:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8017e0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8017e5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8017eb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8017f1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8017f7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8017f9:	48 85 c0             	test   %rax,%rax
+  8017fc:	7f 01                	jg     8017ff <sys_irq_ack+0x2c>
+}
+  8017fe:	c3                   	ret
+sys_irq_ack(int irq) {
+  8017ff:	55                   	push   %rbp
+  801800:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801803:	49 89 c0             	mov    %rax,%r8
+  801806:	b9 16 00 00 00       	mov    $0x16,%ecx
+  80180b:	48 ba 18 51 80 00 00 	movabs $0x805118,%rdx
+  801812:	00 00 00 
+  801815:	be 29 00 00 00       	mov    $0x29,%esi
+  80181a:	48 bf 37 51 80 00 00 	movabs $0x805137,%rdi
+  801821:	00 00 00 
+  801824:	b8 00 00 00 00       	mov    $0x0,%eax
+  801829:	49 b9 2f 04 80 00 00 	movabs $0x80042f,%r9
+  801830:	00 00 00 
+  801833:	41 ff d1             	call   *%r9
+
+0000000000801836 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  801836:	55                   	push   %rbp
+  801837:	48 89 e5             	mov    %rsp,%rbp
+  80183a:	41 54                	push   %r12
+  80183c:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80183d:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  801844:	00 00 00 
+  801847:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  801849:	b8 08 00 00 00       	mov    $0x8,%eax
+  80184e:	0f 05                	syscall
+  801850:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  801853:	85 c0                	test   %eax,%eax
+  801855:	78 7e                	js     8018d5 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  801857:	0f 84 80 00 00 00    	je     8018dd <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80185d:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  801863:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  80186a:	00 00 00 
+  80186d:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801872:	89 c2                	mov    %eax,%edx
+  801874:	be 00 00 00 00       	mov    $0x0,%esi
+  801879:	bf 00 00 00 00       	mov    $0x0,%edi
+  80187e:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801885:	00 00 00 
+  801888:	ff d0                	call   *%rax
+  80188a:	85 c0                	test   %eax,%eax
+  80188c:	0f 88 86 00 00 00    	js     801918 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  801892:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801899:	00 00 00 
+  80189c:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  8018a3:	44 89 e7             	mov    %r12d,%edi
+  8018a6:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  8018ad:	00 00 00 
+  8018b0:	ff d0                	call   *%rax
+  8018b2:	85 c0                	test   %eax,%eax
+  8018b4:	78 6a                	js     801920 <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  8018b6:	be 02 00 00 00       	mov    $0x2,%esi
+  8018bb:	44 89 e7             	mov    %r12d,%edi
+  8018be:	48 b8 02 15 80 00 00 	movabs $0x801502,%rax
+  8018c5:	00 00 00 
+  8018c8:	ff d0                	call   *%rax
+		return -1;
+  8018ca:	85 c0                	test   %eax,%eax
+  8018cc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  8018d1:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8018d5:	44 89 e0             	mov    %r12d,%eax
+  8018d8:	5b                   	pop    %rbx
+  8018d9:	41 5c                	pop    %r12
+  8018db:	5d                   	pop    %rbp
+  8018dc:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8018dd:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  8018e4:	00 00 00 
+  8018e7:	ff d0                	call   *%rax
+  8018e9:	89 c2                	mov    %eax,%edx
+  8018eb:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8018f1:	48 89 d0             	mov    %rdx,%rax
+  8018f4:	48 c1 e0 04          	shl    $0x4,%rax
+  8018f8:	48 29 d0             	sub    %rdx,%rax
+  8018fb:	48 c1 e0 05          	shl    $0x5,%rax
+  8018ff:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801906:	00 00 00 
+  801909:	48 01 d0             	add    %rdx,%rax
+  80190c:	48 a3 00 00 81 00 00 	movabs %rax,0x810000
+  801913:	00 00 00 
+        return 0;
+  801916:	eb bd                	jmp    8018d5 <fork+0x9f>
+		return -1;
+  801918:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  80191e:	eb b5                	jmp    8018d5 <fork+0x9f>
+		return -1;
+  801920:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  801926:	eb ad                	jmp    8018d5 <fork+0x9f>
+
+0000000000801928 <sfork>:
+
+envid_t
+sfork() {
+  801928:	55                   	push   %rbp
+  801929:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  80192c:	48 ba 45 51 80 00 00 	movabs $0x805145,%rdx
+  801933:	00 00 00 
+  801936:	be 2d 00 00 00       	mov    $0x2d,%esi
+  80193b:	48 bf 60 51 80 00 00 	movabs $0x805160,%rdi
+  801942:	00 00 00 
+  801945:	b8 00 00 00 00       	mov    $0x0,%eax
+  80194a:	48 b9 2f 04 80 00 00 	movabs $0x80042f,%rcx
+  801951:	00 00 00 
+  801954:	ff d1                	call   *%rcx
+
+0000000000801956 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801956:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80195d:	ff ff ff 
+  801960:	48 01 f8             	add    %rdi,%rax
+  801963:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  801967:	c3                   	ret
+
+0000000000801968 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801968:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  80196f:	ff ff ff 
+  801972:	48 01 f8             	add    %rdi,%rax
+  801975:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801979:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80197f:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  801983:	c3                   	ret
+
+0000000000801984 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801984:	55                   	push   %rbp
+  801985:	48 89 e5             	mov    %rsp,%rbp
+  801988:	41 57                	push   %r15
+  80198a:	41 56                	push   %r14
+  80198c:	41 55                	push   %r13
+  80198e:	41 54                	push   %r12
+  801990:	53                   	push   %rbx
+  801991:	48 83 ec 08          	sub    $0x8,%rsp
+  801995:	49 89 ff             	mov    %rdi,%r15
+  801998:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  80199d:	49 bd 13 41 80 00 00 	movabs $0x804113,%r13
+  8019a4:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8019a7:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8019ad:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8019b0:	48 89 df             	mov    %rbx,%rdi
+  8019b3:	41 ff d5             	call   *%r13
+  8019b6:	83 e0 04             	and    $0x4,%eax
+  8019b9:	74 17                	je     8019d2 <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  8019bb:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8019c2:	4c 39 f3             	cmp    %r14,%rbx
+  8019c5:	75 e6                	jne    8019ad <fd_alloc+0x29>
+  8019c7:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  8019cd:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  8019d2:	4d 89 27             	mov    %r12,(%r15)
+}
+  8019d5:	48 83 c4 08          	add    $0x8,%rsp
+  8019d9:	5b                   	pop    %rbx
+  8019da:	41 5c                	pop    %r12
+  8019dc:	41 5d                	pop    %r13
+  8019de:	41 5e                	pop    %r14
+  8019e0:	41 5f                	pop    %r15
+  8019e2:	5d                   	pop    %rbp
+  8019e3:	c3                   	ret
+
+00000000008019e4 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  8019e4:	83 ff 1f             	cmp    $0x1f,%edi
+  8019e7:	77 39                	ja     801a22 <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  8019e9:	55                   	push   %rbp
+  8019ea:	48 89 e5             	mov    %rsp,%rbp
+  8019ed:	41 54                	push   %r12
+  8019ef:	53                   	push   %rbx
+  8019f0:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  8019f3:	48 63 df             	movslq %edi,%rbx
+  8019f6:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  8019fd:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  801a01:	48 89 df             	mov    %rbx,%rdi
+  801a04:	48 b8 13 41 80 00 00 	movabs $0x804113,%rax
+  801a0b:	00 00 00 
+  801a0e:	ff d0                	call   *%rax
+  801a10:	a8 04                	test   $0x4,%al
+  801a12:	74 14                	je     801a28 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  801a14:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  801a18:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801a1d:	5b                   	pop    %rbx
+  801a1e:	41 5c                	pop    %r12
+  801a20:	5d                   	pop    %rbp
+  801a21:	c3                   	ret
+        return -E_INVAL;
+  801a22:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  801a27:	c3                   	ret
+        return -E_INVAL;
+  801a28:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801a2d:	eb ee                	jmp    801a1d <fd_lookup+0x39>
+
+0000000000801a2f <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  801a2f:	55                   	push   %rbp
+  801a30:	48 89 e5             	mov    %rsp,%rbp
+  801a33:	41 54                	push   %r12
+  801a35:	53                   	push   %rbx
+  801a36:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  801a39:	48 b8 00 52 80 00 00 	movabs $0x805200,%rax
+  801a40:	00 00 00 
+  801a43:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  801a4a:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  801a4d:	39 3b                	cmp    %edi,(%rbx)
+  801a4f:	74 47                	je     801a98 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  801a51:	48 83 c0 08          	add    $0x8,%rax
+  801a55:	48 8b 18             	mov    (%rax),%rbx
+  801a58:	48 85 db             	test   %rbx,%rbx
+  801a5b:	75 f0                	jne    801a4d <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  801a5d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801a64:	00 00 00 
+  801a67:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801a6d:	89 fa                	mov    %edi,%edx
+  801a6f:	48 bf 70 51 80 00 00 	movabs $0x805170,%rdi
+  801a76:	00 00 00 
+  801a79:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a7e:	48 b9 7f 05 80 00 00 	movabs $0x80057f,%rcx
+  801a85:	00 00 00 
+  801a88:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801a8a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  801a8f:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  801a93:	5b                   	pop    %rbx
+  801a94:	41 5c                	pop    %r12
+  801a96:	5d                   	pop    %rbp
+  801a97:	c3                   	ret
+            return 0;
+  801a98:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a9d:	eb f0                	jmp    801a8f <dev_lookup+0x60>
+
+0000000000801a9f <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  801a9f:	55                   	push   %rbp
+  801aa0:	48 89 e5             	mov    %rsp,%rbp
+  801aa3:	41 55                	push   %r13
+  801aa5:	41 54                	push   %r12
+  801aa7:	53                   	push   %rbx
+  801aa8:	48 83 ec 18          	sub    $0x18,%rsp
+  801aac:	48 89 fb             	mov    %rdi,%rbx
+  801aaf:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  801ab2:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801ab9:	ff ff ff 
+  801abc:	48 01 df             	add    %rbx,%rdi
+  801abf:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  801ac3:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ac7:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801ace:	00 00 00 
+  801ad1:	ff d0                	call   *%rax
+  801ad3:	41 89 c5             	mov    %eax,%r13d
+  801ad6:	85 c0                	test   %eax,%eax
+  801ad8:	78 06                	js     801ae0 <fd_close+0x41>
+  801ada:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  801ade:	74 1a                	je     801afa <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  801ae0:	45 84 e4             	test   %r12b,%r12b
+  801ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ae8:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801aec:	44 89 e8             	mov    %r13d,%eax
+  801aef:	48 83 c4 18          	add    $0x18,%rsp
+  801af3:	5b                   	pop    %rbx
+  801af4:	41 5c                	pop    %r12
+  801af6:	41 5d                	pop    %r13
+  801af8:	5d                   	pop    %rbp
+  801af9:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801afa:	8b 3b                	mov    (%rbx),%edi
+  801afc:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801b00:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801b07:	00 00 00 
+  801b0a:	ff d0                	call   *%rax
+  801b0c:	41 89 c5             	mov    %eax,%r13d
+  801b0f:	85 c0                	test   %eax,%eax
+  801b11:	78 1b                	js     801b2e <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  801b13:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801b17:	48 8b 40 20          	mov    0x20(%rax),%rax
+  801b1b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  801b21:	48 85 c0             	test   %rax,%rax
+  801b24:	74 08                	je     801b2e <fd_close+0x8f>
+  801b26:	48 89 df             	mov    %rbx,%rdi
+  801b29:	ff d0                	call   *%rax
+  801b2b:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  801b2e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801b33:	48 89 de             	mov    %rbx,%rsi
+  801b36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801b3b:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  801b42:	00 00 00 
+  801b45:	ff d0                	call   *%rax
+    return res;
+  801b47:	eb a3                	jmp    801aec <fd_close+0x4d>
+
+0000000000801b49 <close>:
+
+int
+close(int fdnum) {
+  801b49:	55                   	push   %rbp
+  801b4a:	48 89 e5             	mov    %rsp,%rbp
+  801b4d:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  801b51:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  801b55:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801b5c:	00 00 00 
+  801b5f:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  801b61:	85 c0                	test   %eax,%eax
+  801b63:	78 15                	js     801b7a <close+0x31>
+
+    return fd_close(fd, 1);
+  801b65:	be 01 00 00 00       	mov    $0x1,%esi
+  801b6a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  801b6e:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  801b75:	00 00 00 
+  801b78:	ff d0                	call   *%rax
+}
+  801b7a:	c9                   	leave
+  801b7b:	c3                   	ret
+
+0000000000801b7c <close_all>:
+
+void
+close_all(void) {
+  801b7c:	55                   	push   %rbp
+  801b7d:	48 89 e5             	mov    %rsp,%rbp
+  801b80:	41 54                	push   %r12
+  801b82:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  801b83:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b88:	49 bc 49 1b 80 00 00 	movabs $0x801b49,%r12
+  801b8f:	00 00 00 
+  801b92:	89 df                	mov    %ebx,%edi
+  801b94:	41 ff d4             	call   *%r12
+  801b97:	83 c3 01             	add    $0x1,%ebx
+  801b9a:	83 fb 20             	cmp    $0x20,%ebx
+  801b9d:	75 f3                	jne    801b92 <close_all+0x16>
+}
+  801b9f:	5b                   	pop    %rbx
+  801ba0:	41 5c                	pop    %r12
+  801ba2:	5d                   	pop    %rbp
+  801ba3:	c3                   	ret
+
+0000000000801ba4 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801ba4:	55                   	push   %rbp
+  801ba5:	48 89 e5             	mov    %rsp,%rbp
+  801ba8:	41 57                	push   %r15
+  801baa:	41 56                	push   %r14
+  801bac:	41 55                	push   %r13
+  801bae:	41 54                	push   %r12
+  801bb0:	53                   	push   %rbx
+  801bb1:	48 83 ec 18          	sub    $0x18,%rsp
+  801bb5:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801bb8:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801bbc:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801bc3:	00 00 00 
+  801bc6:	ff d0                	call   *%rax
+  801bc8:	89 c3                	mov    %eax,%ebx
+  801bca:	85 c0                	test   %eax,%eax
+  801bcc:	0f 88 b8 00 00 00    	js     801c8a <dup+0xe6>
+    close(newfdnum);
+  801bd2:	44 89 e7             	mov    %r12d,%edi
+  801bd5:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  801bdc:	00 00 00 
+  801bdf:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  801be1:	4d 63 ec             	movslq %r12d,%r13
+  801be4:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801beb:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  801bef:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  801bf3:	4c 89 ff             	mov    %r15,%rdi
+  801bf6:	49 be 68 19 80 00 00 	movabs $0x801968,%r14
+  801bfd:	00 00 00 
+  801c00:	41 ff d6             	call   *%r14
+  801c03:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801c06:	4c 89 ef             	mov    %r13,%rdi
+  801c09:	41 ff d6             	call   *%r14
+  801c0c:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  801c0f:	48 89 df             	mov    %rbx,%rdi
+  801c12:	48 b8 13 41 80 00 00 	movabs $0x804113,%rax
+  801c19:	00 00 00 
+  801c1c:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  801c1e:	a8 04                	test   $0x4,%al
+  801c20:	74 2b                	je     801c4d <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  801c22:	41 89 c1             	mov    %eax,%r9d
+  801c25:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c2b:	4c 89 f1             	mov    %r14,%rcx
+  801c2e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c33:	48 89 de             	mov    %rbx,%rsi
+  801c36:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c3b:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801c42:	00 00 00 
+  801c45:	ff d0                	call   *%rax
+  801c47:	89 c3                	mov    %eax,%ebx
+  801c49:	85 c0                	test   %eax,%eax
+  801c4b:	78 4e                	js     801c9b <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  801c4d:	4c 89 ff             	mov    %r15,%rdi
+  801c50:	48 b8 13 41 80 00 00 	movabs $0x804113,%rax
+  801c57:	00 00 00 
+  801c5a:	ff d0                	call   *%rax
+  801c5c:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  801c5f:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  801c65:	4c 89 e9             	mov    %r13,%rcx
+  801c68:	ba 00 00 00 00       	mov    $0x0,%edx
+  801c6d:	4c 89 fe             	mov    %r15,%rsi
+  801c70:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c75:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  801c7c:	00 00 00 
+  801c7f:	ff d0                	call   *%rax
+  801c81:	89 c3                	mov    %eax,%ebx
+  801c83:	85 c0                	test   %eax,%eax
+  801c85:	78 14                	js     801c9b <dup+0xf7>
+
+    return newfdnum;
+  801c87:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801c8a:	89 d8                	mov    %ebx,%eax
+  801c8c:	48 83 c4 18          	add    $0x18,%rsp
+  801c90:	5b                   	pop    %rbx
+  801c91:	41 5c                	pop    %r12
+  801c93:	41 5d                	pop    %r13
+  801c95:	41 5e                	pop    %r14
+  801c97:	41 5f                	pop    %r15
+  801c99:	5d                   	pop    %rbp
+  801c9a:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801c9b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801ca0:	4c 89 ee             	mov    %r13,%rsi
+  801ca3:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ca8:	49 bc a9 14 80 00 00 	movabs $0x8014a9,%r12
+  801caf:	00 00 00 
+  801cb2:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801cb5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801cba:	4c 89 f6             	mov    %r14,%rsi
+  801cbd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801cc2:	41 ff d4             	call   *%r12
+    return res;
+  801cc5:	eb c3                	jmp    801c8a <dup+0xe6>
+
+0000000000801cc7 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801cc7:	55                   	push   %rbp
+  801cc8:	48 89 e5             	mov    %rsp,%rbp
+  801ccb:	41 56                	push   %r14
+  801ccd:	41 55                	push   %r13
+  801ccf:	41 54                	push   %r12
+  801cd1:	53                   	push   %rbx
+  801cd2:	48 83 ec 10          	sub    $0x10,%rsp
+  801cd6:	89 fb                	mov    %edi,%ebx
+  801cd8:	49 89 f4             	mov    %rsi,%r12
+  801cdb:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cde:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce2:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801ce9:	00 00 00 
+  801cec:	ff d0                	call   *%rax
+  801cee:	85 c0                	test   %eax,%eax
+  801cf0:	78 4c                	js     801d3e <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cf2:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801cf6:	41 8b 3e             	mov    (%r14),%edi
+  801cf9:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cfd:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801d04:	00 00 00 
+  801d07:	ff d0                	call   *%rax
+  801d09:	85 c0                	test   %eax,%eax
+  801d0b:	78 35                	js     801d42 <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801d0d:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801d11:	83 e0 03             	and    $0x3,%eax
+  801d14:	83 f8 01             	cmp    $0x1,%eax
+  801d17:	74 2d                	je     801d46 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d19:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801d1d:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801d21:	48 85 c0             	test   %rax,%rax
+  801d24:	74 56                	je     801d7c <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801d26:	4c 89 ea             	mov    %r13,%rdx
+  801d29:	4c 89 e6             	mov    %r12,%rsi
+  801d2c:	4c 89 f7             	mov    %r14,%rdi
+  801d2f:	ff d0                	call   *%rax
+}
+  801d31:	48 83 c4 10          	add    $0x10,%rsp
+  801d35:	5b                   	pop    %rbx
+  801d36:	41 5c                	pop    %r12
+  801d38:	41 5d                	pop    %r13
+  801d3a:	41 5e                	pop    %r14
+  801d3c:	5d                   	pop    %rbp
+  801d3d:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d3e:	48 98                	cltq
+  801d40:	eb ef                	jmp    801d31 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d42:	48 98                	cltq
+  801d44:	eb eb                	jmp    801d31 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801d46:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801d4d:	00 00 00 
+  801d50:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801d56:	89 da                	mov    %ebx,%edx
+  801d58:	48 bf b1 51 80 00 00 	movabs $0x8051b1,%rdi
+  801d5f:	00 00 00 
+  801d62:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d67:	48 b9 7f 05 80 00 00 	movabs $0x80057f,%rcx
+  801d6e:	00 00 00 
+  801d71:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d73:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801d7a:	eb b5                	jmp    801d31 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801d7c:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801d83:	eb ac                	jmp    801d31 <read+0x6a>
+
+0000000000801d85 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801d85:	55                   	push   %rbp
+  801d86:	48 89 e5             	mov    %rsp,%rbp
+  801d89:	41 57                	push   %r15
+  801d8b:	41 56                	push   %r14
+  801d8d:	41 55                	push   %r13
+  801d8f:	41 54                	push   %r12
+  801d91:	53                   	push   %rbx
+  801d92:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801d96:	48 85 d2             	test   %rdx,%rdx
+  801d99:	74 54                	je     801def <readn+0x6a>
+  801d9b:	41 89 fd             	mov    %edi,%r13d
+  801d9e:	49 89 f6             	mov    %rsi,%r14
+  801da1:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801da4:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801da9:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801dae:	49 bf c7 1c 80 00 00 	movabs $0x801cc7,%r15
+  801db5:	00 00 00 
+  801db8:	4c 89 e2             	mov    %r12,%rdx
+  801dbb:	48 29 f2             	sub    %rsi,%rdx
+  801dbe:	4c 01 f6             	add    %r14,%rsi
+  801dc1:	44 89 ef             	mov    %r13d,%edi
+  801dc4:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801dc7:	85 c0                	test   %eax,%eax
+  801dc9:	78 20                	js     801deb <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801dcb:	01 c3                	add    %eax,%ebx
+  801dcd:	85 c0                	test   %eax,%eax
+  801dcf:	74 08                	je     801dd9 <readn+0x54>
+  801dd1:	48 63 f3             	movslq %ebx,%rsi
+  801dd4:	4c 39 e6             	cmp    %r12,%rsi
+  801dd7:	72 df                	jb     801db8 <readn+0x33>
+    }
+    return res;
+  801dd9:	48 63 c3             	movslq %ebx,%rax
+}
+  801ddc:	48 83 c4 08          	add    $0x8,%rsp
+  801de0:	5b                   	pop    %rbx
+  801de1:	41 5c                	pop    %r12
+  801de3:	41 5d                	pop    %r13
+  801de5:	41 5e                	pop    %r14
+  801de7:	41 5f                	pop    %r15
+  801de9:	5d                   	pop    %rbp
+  801dea:	c3                   	ret
+        if (inc < 0) return inc;
+  801deb:	48 98                	cltq
+  801ded:	eb ed                	jmp    801ddc <readn+0x57>
+    int inc = 1, res = 0;
+  801def:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801df4:	eb e3                	jmp    801dd9 <readn+0x54>
+
+0000000000801df6 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801df6:	55                   	push   %rbp
+  801df7:	48 89 e5             	mov    %rsp,%rbp
+  801dfa:	41 56                	push   %r14
+  801dfc:	41 55                	push   %r13
+  801dfe:	41 54                	push   %r12
+  801e00:	53                   	push   %rbx
+  801e01:	48 83 ec 10          	sub    $0x10,%rsp
+  801e05:	89 fb                	mov    %edi,%ebx
+  801e07:	49 89 f4             	mov    %rsi,%r12
+  801e0a:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e0d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e11:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801e18:	00 00 00 
+  801e1b:	ff d0                	call   *%rax
+  801e1d:	85 c0                	test   %eax,%eax
+  801e1f:	78 47                	js     801e68 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e21:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801e25:	41 8b 3e             	mov    (%r14),%edi
+  801e28:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801e2c:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801e33:	00 00 00 
+  801e36:	ff d0                	call   *%rax
+  801e38:	85 c0                	test   %eax,%eax
+  801e3a:	78 30                	js     801e6c <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801e3c:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801e41:	74 2d                	je     801e70 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801e43:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801e47:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801e4b:	48 85 c0             	test   %rax,%rax
+  801e4e:	74 56                	je     801ea6 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801e50:	4c 89 ea             	mov    %r13,%rdx
+  801e53:	4c 89 e6             	mov    %r12,%rsi
+  801e56:	4c 89 f7             	mov    %r14,%rdi
+  801e59:	ff d0                	call   *%rax
+}
+  801e5b:	48 83 c4 10          	add    $0x10,%rsp
+  801e5f:	5b                   	pop    %rbx
+  801e60:	41 5c                	pop    %r12
+  801e62:	41 5d                	pop    %r13
+  801e64:	41 5e                	pop    %r14
+  801e66:	5d                   	pop    %rbp
+  801e67:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801e68:	48 98                	cltq
+  801e6a:	eb ef                	jmp    801e5b <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801e6c:	48 98                	cltq
+  801e6e:	eb eb                	jmp    801e5b <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801e70:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801e77:	00 00 00 
+  801e7a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801e80:	89 da                	mov    %ebx,%edx
+  801e82:	48 bf cd 51 80 00 00 	movabs $0x8051cd,%rdi
+  801e89:	00 00 00 
+  801e8c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801e91:	48 b9 7f 05 80 00 00 	movabs $0x80057f,%rcx
+  801e98:	00 00 00 
+  801e9b:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801e9d:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801ea4:	eb b5                	jmp    801e5b <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801ea6:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801ead:	eb ac                	jmp    801e5b <write+0x65>
+
+0000000000801eaf <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801eaf:	55                   	push   %rbp
+  801eb0:	48 89 e5             	mov    %rsp,%rbp
+  801eb3:	41 54                	push   %r12
+  801eb5:	53                   	push   %rbx
+  801eb6:	48 83 ec 10          	sub    $0x10,%rsp
+  801eba:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801ebc:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801ec0:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801ec7:	00 00 00 
+  801eca:	ff d0                	call   *%rax
+  801ecc:	85 c0                	test   %eax,%eax
+  801ece:	78 3e                	js     801f0e <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ed0:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801ed4:	41 8b 3c 24          	mov    (%r12),%edi
+  801ed8:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801edc:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801ee3:	00 00 00 
+  801ee6:	ff d0                	call   *%rax
+  801ee8:	85 c0                	test   %eax,%eax
+  801eea:	78 22                	js     801f0e <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801eec:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ef0:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801ef4:	48 85 c0             	test   %rax,%rax
+  801ef7:	74 0b                	je     801f04 <seek+0x55>
+  801ef9:	89 de                	mov    %ebx,%esi
+  801efb:	4c 89 e7             	mov    %r12,%rdi
+  801efe:	ff d0                	call   *%rax
+  801f00:	85 c0                	test   %eax,%eax
+  801f02:	78 0a                	js     801f0e <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801f04:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801f09:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801f0e:	48 83 c4 10          	add    $0x10,%rsp
+  801f12:	5b                   	pop    %rbx
+  801f13:	41 5c                	pop    %r12
+  801f15:	5d                   	pop    %rbp
+  801f16:	c3                   	ret
+
+0000000000801f17 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801f17:	55                   	push   %rbp
+  801f18:	48 89 e5             	mov    %rsp,%rbp
+  801f1b:	41 55                	push   %r13
+  801f1d:	41 54                	push   %r12
+  801f1f:	53                   	push   %rbx
+  801f20:	48 83 ec 18          	sub    $0x18,%rsp
+  801f24:	89 fb                	mov    %edi,%ebx
+  801f26:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801f29:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801f2d:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801f34:	00 00 00 
+  801f37:	ff d0                	call   *%rax
+  801f39:	85 c0                	test   %eax,%eax
+  801f3b:	78 38                	js     801f75 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801f3d:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801f41:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801f45:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801f49:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801f50:	00 00 00 
+  801f53:	ff d0                	call   *%rax
+  801f55:	85 c0                	test   %eax,%eax
+  801f57:	78 1c                	js     801f75 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801f59:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801f5e:	74 20                	je     801f80 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801f60:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801f64:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801f68:	48 85 c0             	test   %rax,%rax
+  801f6b:	74 47                	je     801fb4 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801f6d:	44 89 e6             	mov    %r12d,%esi
+  801f70:	4c 89 ef             	mov    %r13,%rdi
+  801f73:	ff d0                	call   *%rax
+}
+  801f75:	48 83 c4 18          	add    $0x18,%rsp
+  801f79:	5b                   	pop    %rbx
+  801f7a:	41 5c                	pop    %r12
+  801f7c:	41 5d                	pop    %r13
+  801f7e:	5d                   	pop    %rbp
+  801f7f:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801f80:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  801f87:	00 00 00 
+  801f8a:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801f90:	89 da                	mov    %ebx,%edx
+  801f92:	48 bf 90 51 80 00 00 	movabs $0x805190,%rdi
+  801f99:	00 00 00 
+  801f9c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fa1:	48 b9 7f 05 80 00 00 	movabs $0x80057f,%rcx
+  801fa8:	00 00 00 
+  801fab:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801fad:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801fb2:	eb c1                	jmp    801f75 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801fb4:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801fb9:	eb ba                	jmp    801f75 <ftruncate+0x5e>
+
+0000000000801fbb <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801fbb:	55                   	push   %rbp
+  801fbc:	48 89 e5             	mov    %rsp,%rbp
+  801fbf:	41 54                	push   %r12
+  801fc1:	53                   	push   %rbx
+  801fc2:	48 83 ec 10          	sub    $0x10,%rsp
+  801fc6:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801fc9:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801fcd:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  801fd4:	00 00 00 
+  801fd7:	ff d0                	call   *%rax
+  801fd9:	85 c0                	test   %eax,%eax
+  801fdb:	78 4e                	js     80202b <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801fdd:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801fe1:	41 8b 3c 24          	mov    (%r12),%edi
+  801fe5:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801fe9:	48 b8 2f 1a 80 00 00 	movabs $0x801a2f,%rax
+  801ff0:	00 00 00 
+  801ff3:	ff d0                	call   *%rax
+  801ff5:	85 c0                	test   %eax,%eax
+  801ff7:	78 32                	js     80202b <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801ff9:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801ffd:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802002:	74 30                	je     802034 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802004:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802007:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  80200e:	00 00 00 
+    stat->st_isdir = 0;
+  802011:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802018:	00 00 00 
+    stat->st_dev = dev;
+  80201b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802022:	48 89 de             	mov    %rbx,%rsi
+  802025:	4c 89 e7             	mov    %r12,%rdi
+  802028:	ff 50 28             	call   *0x28(%rax)
+}
+  80202b:	48 83 c4 10          	add    $0x10,%rsp
+  80202f:	5b                   	pop    %rbx
+  802030:	41 5c                	pop    %r12
+  802032:	5d                   	pop    %rbp
+  802033:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802034:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802039:	eb f0                	jmp    80202b <fstat+0x70>
+
+000000000080203b <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  80203b:	55                   	push   %rbp
+  80203c:	48 89 e5             	mov    %rsp,%rbp
+  80203f:	41 54                	push   %r12
+  802041:	53                   	push   %rbx
+  802042:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802045:	be 00 00 00 00       	mov    $0x0,%esi
+  80204a:	48 b8 a9 31 80 00 00 	movabs $0x8031a9,%rax
+  802051:	00 00 00 
+  802054:	ff d0                	call   *%rax
+  802056:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802058:	85 c0                	test   %eax,%eax
+  80205a:	78 25                	js     802081 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  80205c:	4c 89 e6             	mov    %r12,%rsi
+  80205f:	89 c7                	mov    %eax,%edi
+  802061:	48 b8 bb 1f 80 00 00 	movabs $0x801fbb,%rax
+  802068:	00 00 00 
+  80206b:	ff d0                	call   *%rax
+  80206d:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802070:	89 df                	mov    %ebx,%edi
+  802072:	48 b8 49 1b 80 00 00 	movabs $0x801b49,%rax
+  802079:	00 00 00 
+  80207c:	ff d0                	call   *%rax
+
+    return res;
+  80207e:	44 89 e3             	mov    %r12d,%ebx
+}
+  802081:	89 d8                	mov    %ebx,%eax
+  802083:	5b                   	pop    %rbx
+  802084:	41 5c                	pop    %r12
+  802086:	5d                   	pop    %rbp
+  802087:	c3                   	ret
+
+0000000000802088 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802088:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  80208f:	00 00 00 
+  802092:	83 38 00             	cmpl   $0x0,(%rax)
+  802095:	74 0a                	je     8020a1 <fsenv+0x19>
+    return envid;
+}
+  802097:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  80209e:	00 00 
+  8020a0:	c3                   	ret
+fsenv(void) {
+  8020a1:	55                   	push   %rbp
+  8020a2:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  8020a5:	bf 03 00 00 00       	mov    $0x3,%edi
+  8020aa:	48 b8 76 4a 80 00 00 	movabs $0x804a76,%rax
+  8020b1:	00 00 00 
+  8020b4:	ff d0                	call   *%rax
+  8020b6:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  8020bd:	00 00 
+}
+  8020bf:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  8020c6:	00 00 
+  8020c8:	5d                   	pop    %rbp
+  8020c9:	c3                   	ret
+
+00000000008020ca <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  8020ca:	55                   	push   %rbp
+  8020cb:	48 89 e5             	mov    %rsp,%rbp
+  8020ce:	41 54                	push   %r12
+  8020d0:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8020d1:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8020d6:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  8020db:	48 89 de             	mov    %rbx,%rsi
+  8020de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8020e3:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8020ea:	00 00 00 
+  8020ed:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  8020ef:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  8020f6:	00 00 00 
+  8020f9:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  8020ff:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802104:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802109:	48 89 de             	mov    %rbx,%rsi
+  80210c:	bf 00 00 00 00       	mov    $0x0,%edi
+  802111:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  802118:	00 00 00 
+  80211b:	ff d0                	call   *%rax
+  80211d:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  80211f:	85 c0                	test   %eax,%eax
+  802121:	0f 88 a2 00 00 00    	js     8021c9 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802127:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80212e:	00 00 00 
+  802131:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802137:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  80213c:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  80213e:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802143:	49 bc db 42 80 00 00 	movabs $0x8042db,%r12
+  80214a:	00 00 00 
+  80214d:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802150:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802155:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802158:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  80215f:	00 00 00 
+  802162:	ff d0                	call   *%rax
+  802164:	89 c7                	mov    %eax,%edi
+  802166:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  80216c:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802171:	48 89 da             	mov    %rbx,%rdx
+  802174:	be 09 00 00 00       	mov    $0x9,%esi
+  802179:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  802180:	00 00 00 
+  802183:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802185:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80218a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80218f:	be 00 00 00 00       	mov    $0x0,%esi
+  802194:	bf 00 00 00 00       	mov    $0x0,%edi
+  802199:	48 b8 fc 49 80 00 00 	movabs $0x8049fc,%rax
+  8021a0:	00 00 00 
+  8021a3:	ff d0                	call   *%rax
+  8021a5:	89 c3                	mov    %eax,%ebx
+  8021a7:	85 c0                	test   %eax,%eax
+  8021a9:	78 25                	js     8021d0 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  8021ab:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8021b2:	00 00 00 
+  8021b5:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8021bb:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  8021c2:	00 00 
+    return 0;
+  8021c4:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  8021c9:	89 d8                	mov    %ebx,%eax
+  8021cb:	5b                   	pop    %rbx
+  8021cc:	41 5c                	pop    %r12
+  8021ce:	5d                   	pop    %rbp
+  8021cf:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  8021d0:	ba 00 50 00 00       	mov    $0x5000,%edx
+  8021d5:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  8021da:	bf 00 00 00 00       	mov    $0x0,%edi
+  8021df:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8021e6:	00 00 00 
+  8021e9:	ff d0                	call   *%rax
+        return res;
+  8021eb:	eb dc                	jmp    8021c9 <fschan_setup+0xff>
+
+00000000008021ed <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  8021ed:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  8021f4:	00 00 00 
+  8021f7:	80 38 00             	cmpb   $0x0,(%rax)
+  8021fa:	74 55                	je     802251 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  8021fc:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  802203:	00 00 00 
+  802206:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  80220c:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802211:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802218:	00 00 00 
+  80221b:	3b 0a                	cmp    (%rdx),%ecx
+  80221d:	75 01                	jne    802220 <fschan+0x33>
+}
+  80221f:	c3                   	ret
+fschan(void) {
+  802220:	55                   	push   %rbp
+  802221:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802224:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  80222b:	00 00 00 
+  80222e:	ff d0                	call   *%rax
+  802230:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802232:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802237:	85 d2                	test   %edx,%edx
+  802239:	78 02                	js     80223d <fschan+0x50>
+}
+  80223b:	5d                   	pop    %rbp
+  80223c:	c3                   	ret
+        fschan_enabled = 0;
+  80223d:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802244:	00 00 00 
+  802247:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  80224a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80224f:	eb ea                	jmp    80223b <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802251:	b8 00 00 00 00       	mov    $0x0,%eax
+  802256:	c3                   	ret
+
+0000000000802257 <fbuf>:
+fbuf(struct Fd *fd) {
+  802257:	55                   	push   %rbp
+  802258:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  80225b:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  802262:	00 00 00 
+  802265:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802267:	ba 00 00 00 00       	mov    $0x0,%edx
+  80226c:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802270:	77 12                	ja     802284 <fbuf+0x2d>
+  802272:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802276:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80227d:	00 00 00 
+  802280:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802284:	48 89 d0             	mov    %rdx,%rax
+  802287:	5d                   	pop    %rbp
+  802288:	c3                   	ret
+
+0000000000802289 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802289:	55                   	push   %rbp
+  80228a:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  80228d:	48 83 c7 40          	add    $0x40,%rdi
+  802291:	48 b8 15 43 80 00 00 	movabs $0x804315,%rax
+  802298:	00 00 00 
+  80229b:	ff d0                	call   *%rax
+  80229d:	84 c0                	test   %al,%al
+  80229f:	75 02                	jne    8022a3 <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  8022a1:	5d                   	pop    %rbp
+  8022a2:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  8022a3:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8022aa:	00 00 00 
+  8022ad:	ff d0                	call   *%rax
+  8022af:	89 c7                	mov    %eax,%edi
+  8022b1:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022b7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8022bc:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c1:	be 0a 00 00 00       	mov    $0xa,%esi
+  8022c6:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  8022cd:	00 00 00 
+  8022d0:	ff d0                	call   *%rax
+}
+  8022d2:	eb cd                	jmp    8022a1 <fschan_publish+0x18>
+
+00000000008022d4 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  8022d4:	55                   	push   %rbp
+  8022d5:	48 89 e5             	mov    %rsp,%rbp
+  8022d8:	41 57                	push   %r15
+  8022da:	41 56                	push   %r14
+  8022dc:	41 55                	push   %r13
+  8022de:	41 54                	push   %r12
+  8022e0:	53                   	push   %rbx
+  8022e1:	48 83 ec 48          	sub    $0x48,%rsp
+  8022e5:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  8022e9:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  8022ed:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  8022f0:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  8022f4:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  8022f7:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  8022fe:	00 00 00 
+  802301:	8b 02                	mov    (%rdx),%eax
+  802303:	83 c0 01             	add    $0x1,%eax
+  802306:	b9 01 00 00 00       	mov    $0x1,%ecx
+  80230b:	0f 44 c1             	cmove  %ecx,%eax
+  80230e:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  802310:	4d 85 c0             	test   %r8,%r8
+  802313:	74 2c                	je     802341 <fschan_rw+0x6d>
+  802315:	45 89 ce             	mov    %r9d,%r14d
+  802318:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  80231f:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  802323:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802329:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  802330:	00 
+  802331:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  802337:	b8 01 00 00 00       	mov    $0x1,%eax
+  80233c:	e9 41 01 00 00       	jmp    802482 <fschan_rw+0x1ae>
+  802341:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  802345:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  802349:	e9 9c 01 00 00       	jmp    8024ea <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  80234e:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  802352:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  802355:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  802358:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  80235b:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  80235f:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  802363:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  802367:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  80236b:	48 89 da             	mov    %rbx,%rdx
+  80236e:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  802375:	00 00 00 
+  802378:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  80237a:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80237e:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  802385:	00 00 00 
+  802388:	ff d0                	call   *%rax
+            queued += blk;
+  80238a:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  80238d:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802391:	4d 39 fc             	cmp    %r15,%r12
+  802394:	73 6b                	jae    802401 <fschan_rw+0x12d>
+  802396:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80239a:	77 65                	ja     802401 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  80239c:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8023a0:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8023a4:	48 b8 f0 42 80 00 00 	movabs $0x8042f0,%rax
+  8023ab:	00 00 00 
+  8023ae:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8023b0:	4c 89 fb             	mov    %r15,%rbx
+  8023b3:	4c 29 e3             	sub    %r12,%rbx
+  8023b6:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  8023bb:	48 39 d3             	cmp    %rdx,%rbx
+  8023be:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  8023c2:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  8023c6:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  8023ca:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  8023ce:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  8023d1:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  8023d3:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  8023da:	00 00 00 
+  8023dd:	8b 09                	mov    (%rcx),%ecx
+  8023df:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  8023e2:	83 fe 03             	cmp    $0x3,%esi
+  8023e5:	0f 85 63 ff ff ff    	jne    80234e <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  8023eb:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  8023ef:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  8023f2:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  8023f5:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  8023f8:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  8023fc:	e9 79 ff ff ff       	jmp    80237a <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  802401:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802405:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  80240c:	48 89 df             	mov    %rbx,%rdi
+  80240f:	48 b8 b3 43 80 00 00 	movabs $0x8043b3,%rax
+  802416:	00 00 00 
+  802419:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80241b:	48 89 df             	mov    %rbx,%rdi
+  80241e:	48 b8 41 43 80 00 00 	movabs $0x804341,%rax
+  802425:	00 00 00 
+  802428:	ff d0                	call   *%rax
+  80242a:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  80242e:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  802432:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  802436:	75 25                	jne    80245d <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  802438:	8b 40 04             	mov    0x4(%rax),%eax
+  80243b:	85 c0                	test   %eax,%eax
+  80243d:	0f 88 86 00 00 00    	js     8024c9 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802443:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  802447:	74 5b                	je     8024a4 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  802449:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  80244d:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  802451:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  802455:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  802459:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  80245d:	48 89 df             	mov    %rbx,%rdi
+  802460:	48 b8 68 43 80 00 00 	movabs $0x804368,%rax
+  802467:	00 00 00 
+  80246a:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  80246c:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  802470:	83 f0 01             	xor    $0x1,%eax
+  802473:	4d 39 fc             	cmp    %r15,%r12
+  802476:	0f 92 c2             	setb   %dl
+  802479:	84 c2                	test   %al,%dl
+  80247b:	75 05                	jne    802482 <fschan_rw+0x1ae>
+  80247d:	45 85 ed             	test   %r13d,%r13d
+  802480:	74 50                	je     8024d2 <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  802482:	4d 39 fc             	cmp    %r15,%r12
+  802485:	0f 92 c1             	setb   %cl
+  802488:	41 83 fd 0f          	cmp    $0xf,%r13d
+  80248c:	0f 96 c2             	setbe  %dl
+  80248f:	84 d1                	test   %dl,%cl
+  802491:	0f 84 6a ff ff ff    	je     802401 <fschan_rw+0x12d>
+  802497:	84 c0                	test   %al,%al
+  802499:	0f 85 fd fe ff ff    	jne    80239c <fschan_rw+0xc8>
+  80249f:	e9 5d ff ff ff       	jmp    802401 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8024a4:	48 63 d0             	movslq %eax,%rdx
+  8024a7:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8024ab:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8024af:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8024b3:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8024b7:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  8024bb:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8024c2:	00 00 00 
+  8024c5:	ff d0                	call   *%rax
+  8024c7:	eb 80                	jmp    802449 <fschan_rw+0x175>
+                err = msg->fm_res;
+  8024c9:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  8024cc:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  8024d0:	eb 8b                	jmp    80245d <fschan_rw+0x189>
+    return done || !err ? done : err;
+  8024d2:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  8024d7:	0f 85 68 fe ff ff    	jne    802345 <fschan_rw+0x71>
+  8024dd:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  8024e0:	85 c0                	test   %eax,%eax
+  8024e2:	0f 84 5d fe ff ff    	je     802345 <fschan_rw+0x71>
+  8024e8:	48 98                	cltq
+}
+  8024ea:	48 83 c4 48          	add    $0x48,%rsp
+  8024ee:	5b                   	pop    %rbx
+  8024ef:	41 5c                	pop    %r12
+  8024f1:	41 5d                	pop    %r13
+  8024f3:	41 5e                	pop    %r14
+  8024f5:	41 5f                	pop    %r15
+  8024f7:	5d                   	pop    %rbp
+  8024f8:	c3                   	ret
+
+00000000008024f9 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  8024f9:	55                   	push   %rbp
+  8024fa:	48 89 e5             	mov    %rsp,%rbp
+  8024fd:	41 56                	push   %r14
+  8024ff:	41 55                	push   %r13
+  802501:	41 54                	push   %r12
+  802503:	53                   	push   %rbx
+  802504:	48 83 ec 10          	sub    $0x10,%rsp
+  802508:	49 89 fe             	mov    %rdi,%r14
+  80250b:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80250e:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  802512:	48 29 f3             	sub    %rsi,%rbx
+  802515:	48 39 d3             	cmp    %rdx,%rbx
+  802518:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  80251c:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  802523:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  802524:	bf 00 10 00 00       	mov    $0x1000,%edi
+  802529:	49 bd 72 41 80 00 00 	movabs $0x804172,%r13
+  802530:	00 00 00 
+  802533:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  80253a:	76 1e                	jbe    80255a <mmap_fault+0x61>
+  80253c:	4c 01 e7             	add    %r12,%rdi
+  80253f:	41 ff d5             	call   *%r13
+  802542:	84 c0                	test   %al,%al
+  802544:	75 14                	jne    80255a <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  802546:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  80254a:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  802551:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  802555:	48 39 df             	cmp    %rbx,%rdi
+  802558:	72 e2                	jb     80253c <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  80255a:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  802561:	00 00 00 
+  802564:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80256b:	00 00 00 
+  80256e:	4c 89 f0             	mov    %r14,%rax
+  802571:	48 29 d0             	sub    %rdx,%rax
+  802574:	48 c1 f8 03          	sar    $0x3,%rax
+  802578:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80257f:	aa aa aa 
+  802582:	48 0f af c2          	imul   %rdx,%rax
+  802586:	48 c1 e0 0c          	shl    $0xc,%rax
+  80258a:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80258f:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  802593:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802595:	44 89 e0             	mov    %r12d,%eax
+  802598:	41 03 46 10          	add    0x10(%r14),%eax
+  80259c:	41 2b 06             	sub    (%r14),%eax
+  80259f:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8025a2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8025a6:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8025aa:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8025ae:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8025b1:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  8025b8:	00 00 00 
+  8025bb:	ff d0                	call   *%rax
+  8025bd:	89 c7                	mov    %eax,%edi
+  8025bf:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8025c5:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8025ca:	48 89 da             	mov    %rbx,%rdx
+  8025cd:	be 0f 00 00 00       	mov    $0xf,%esi
+  8025d2:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  8025d9:	00 00 00 
+  8025dc:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  8025de:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8025e3:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8025e7:	4c 89 e6             	mov    %r12,%rsi
+  8025ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8025ef:	48 b8 fc 49 80 00 00 	movabs $0x8049fc,%rax
+  8025f6:	00 00 00 
+  8025f9:	ff d0                	call   *%rax
+  8025fb:	48 98                	cltq
+}
+  8025fd:	48 83 c4 10          	add    $0x10,%rsp
+  802601:	5b                   	pop    %rbx
+  802602:	41 5c                	pop    %r12
+  802604:	41 5d                	pop    %r13
+  802606:	41 5e                	pop    %r14
+  802608:	5d                   	pop    %rbp
+  802609:	c3                   	ret
+
+000000000080260a <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  80260a:	48 8b 37             	mov    (%rdi),%rsi
+  80260d:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  802614:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  80261b:	00 00 00 
+  80261e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802623:	eb 0f                	jmp    802634 <mmap_pgfault+0x2a>
+  802625:	c3                   	ret
+  802626:	48 83 c1 01          	add    $0x1,%rcx
+  80262a:	48 83 c2 18          	add    $0x18,%rdx
+  80262e:	48 83 f9 20          	cmp    $0x20,%rcx
+  802632:	74 6e                	je     8026a2 <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802634:	48 8b 02             	mov    (%rdx),%rax
+  802637:	48 83 e8 01          	sub    $0x1,%rax
+  80263b:	48 39 f0             	cmp    %rsi,%rax
+  80263e:	73 e6                	jae    802626 <mmap_pgfault+0x1c>
+  802640:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  802644:	73 e0                	jae    802626 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  802646:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  80264a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80264f:	f6 c2 01             	test   $0x1,%dl
+  802652:	75 d1                	jne    802625 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  802654:	f6 c2 02             	test   $0x2,%dl
+  802657:	74 1a                	je     802673 <mmap_pgfault+0x69>
+  802659:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80265d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802662:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  802669:	00 00 00 
+  80266c:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  802671:	74 35                	je     8026a8 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  802673:	55                   	push   %rbp
+  802674:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802677:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  80267b:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802682:	00 00 00 
+  802685:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802689:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80268e:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  802695:	00 00 00 
+  802698:	ff d0                	call   *%rax
+  80269a:	48 85 c0             	test   %rax,%rax
+  80269d:	0f 9f c0             	setg   %al
+}
+  8026a0:	5d                   	pop    %rbp
+  8026a1:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8026a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026a7:	c3                   	ret
+}
+  8026a8:	c3                   	ret
+
+00000000008026a9 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8026a9:	55                   	push   %rbp
+  8026aa:	48 89 e5             	mov    %rsp,%rbp
+  8026ad:	41 54                	push   %r12
+  8026af:	53                   	push   %rbx
+  8026b0:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026b3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8026ba:	00 00 00 
+  8026bd:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  8026c2:	48 83 38 00          	cmpq   $0x0,(%rax)
+  8026c6:	74 15                	je     8026dd <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8026c8:	48 83 c3 01          	add    $0x1,%rbx
+  8026cc:	48 83 c0 18          	add    $0x18,%rax
+  8026d0:	48 83 fb 20          	cmp    $0x20,%rbx
+  8026d4:	75 ec                	jne    8026c2 <mmap_alloc+0x19>
+    return NULL;
+  8026d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8026db:	eb 52                	jmp    80272f <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8026dd:	4c 89 e7             	mov    %r12,%rdi
+  8026e0:	48 b8 13 41 80 00 00 	movabs $0x804113,%rax
+  8026e7:	00 00 00 
+  8026ea:	ff d0                	call   *%rax
+  8026ec:	41 89 c1             	mov    %eax,%r9d
+  8026ef:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  8026f6:	48 c1 e1 0c          	shl    $0xc,%rcx
+  8026fa:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802700:	ba 00 00 00 00       	mov    $0x0,%edx
+  802705:	4c 89 e6             	mov    %r12,%rsi
+  802708:	bf 00 00 00 00       	mov    $0x0,%edi
+  80270d:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  802714:	00 00 00 
+  802717:	ff d0                	call   *%rax
+  802719:	85 c0                	test   %eax,%eax
+  80271b:	78 17                	js     802734 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  80271d:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  802721:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802728:	00 00 00 
+  80272b:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  80272f:	5b                   	pop    %rbx
+  802730:	41 5c                	pop    %r12
+  802732:	5d                   	pop    %rbp
+  802733:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802734:	b8 00 00 00 00       	mov    $0x0,%eax
+  802739:	eb f4                	jmp    80272f <mmap_alloc+0x86>
+
+000000000080273b <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  80273b:	55                   	push   %rbp
+  80273c:	48 89 e5             	mov    %rsp,%rbp
+  80273f:	41 56                	push   %r14
+  802741:	41 55                	push   %r13
+  802743:	41 54                	push   %r12
+  802745:	53                   	push   %rbx
+  802746:	48 83 ec 10          	sub    $0x10,%rsp
+  80274a:	41 89 fc             	mov    %edi,%r12d
+  80274d:	49 89 f5             	mov    %rsi,%r13
+  802750:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  802753:	48 89 f0             	mov    %rsi,%rax
+  802756:	48 09 d0             	or     %rdx,%rax
+  802759:	75 0d                	jne    802768 <fsipc+0x2d>
+  80275b:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  80275e:	83 f8 04             	cmp    $0x4,%eax
+  802761:	76 7d                	jbe    8027e0 <fsipc+0xa5>
+  802763:	83 ff 0d             	cmp    $0xd,%edi
+  802766:	74 78                	je     8027e0 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  802768:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  80276f:	00 00 00 
+  802772:	ff d0                	call   *%rax
+  802774:	89 c7                	mov    %eax,%edi
+  802776:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  80277d:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802784:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  80278b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802791:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802798:	00 00 00 
+  80279b:	44 89 e6             	mov    %r12d,%esi
+  80279e:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  8027a5:	00 00 00 
+  8027a8:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8027aa:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8027b1:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8027b2:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8027b7:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  8027bb:	4c 89 ee             	mov    %r13,%rsi
+  8027be:	bf 00 00 00 00       	mov    $0x0,%edi
+  8027c3:	48 b8 fc 49 80 00 00 	movabs $0x8049fc,%rax
+  8027ca:	00 00 00 
+  8027cd:	ff d0                	call   *%rax
+  8027cf:	89 c3                	mov    %eax,%ebx
+}
+  8027d1:	89 d8                	mov    %ebx,%eax
+  8027d3:	48 83 c4 10          	add    $0x10,%rsp
+  8027d7:	5b                   	pop    %rbx
+  8027d8:	41 5c                	pop    %r12
+  8027da:	41 5d                	pop    %r13
+  8027dc:	41 5e                	pop    %r14
+  8027de:	5d                   	pop    %rbp
+  8027df:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8027e0:	48 b8 ed 21 80 00 00 	movabs $0x8021ed,%rax
+  8027e7:	00 00 00 
+  8027ea:	ff d0                	call   *%rax
+  8027ec:	49 89 c6             	mov    %rax,%r14
+  8027ef:	48 85 c0             	test   %rax,%rax
+  8027f2:	0f 84 70 ff ff ff    	je     802768 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8027f8:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8027fc:	48 b8 f0 42 80 00 00 	movabs $0x8042f0,%rax
+  802803:	00 00 00 
+  802806:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802808:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  80280b:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  802812:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  802816:	ba 10 00 00 00       	mov    $0x10,%edx
+  80281b:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  802822:	00 00 00 
+  802825:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  80282c:	00 00 00 
+  80282f:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  802831:	4c 89 f7             	mov    %r14,%rdi
+  802834:	48 b8 89 22 80 00 00 	movabs $0x802289,%rax
+  80283b:	00 00 00 
+  80283e:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  802840:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  802847:	4c 89 f7             	mov    %r14,%rdi
+  80284a:	48 b8 b3 43 80 00 00 	movabs $0x8043b3,%rax
+  802851:	00 00 00 
+  802854:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  802856:	4c 89 f7             	mov    %r14,%rdi
+  802859:	48 b8 41 43 80 00 00 	movabs $0x804341,%rax
+  802860:	00 00 00 
+  802863:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  802865:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  802868:	41 83 fc 05          	cmp    $0x5,%r12d
+  80286c:	75 04                	jne    802872 <fsipc+0x137>
+  80286e:	85 db                	test   %ebx,%ebx
+  802870:	79 14                	jns    802886 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  802872:	4c 89 f7             	mov    %r14,%rdi
+  802875:	48 b8 68 43 80 00 00 	movabs $0x804368,%rax
+  80287c:	00 00 00 
+  80287f:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  802881:	e9 4b ff ff ff       	jmp    8027d1 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802886:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80288a:	ba 88 00 00 00       	mov    $0x88,%edx
+  80288f:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802896:	00 00 00 
+  802899:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8028a0:	00 00 00 
+  8028a3:	ff d0                	call   *%rax
+  8028a5:	eb cb                	jmp    802872 <fsipc+0x137>
+
+00000000008028a7 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8028a7:	55                   	push   %rbp
+  8028a8:	48 89 e5             	mov    %rsp,%rbp
+  8028ab:	41 57                	push   %r15
+  8028ad:	41 56                	push   %r14
+  8028af:	41 55                	push   %r13
+  8028b1:	41 54                	push   %r12
+  8028b3:	53                   	push   %rbx
+  8028b4:	48 83 ec 18          	sub    $0x18,%rsp
+  8028b8:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  8028bc:	49 89 f6             	mov    %rsi,%r14
+  8028bf:	49 89 d4             	mov    %rdx,%r12
+  8028c2:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  8028c5:	48 b8 ed 21 80 00 00 	movabs $0x8021ed,%rax
+  8028cc:	00 00 00 
+  8028cf:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8028d1:	48 85 c0             	test   %rax,%rax
+  8028d4:	0f 85 96 00 00 00    	jne    802970 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  8028da:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  8028e1:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8028e2:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  8028e9:	00 00 00 
+    while (n) {
+  8028ec:	4d 85 e4             	test   %r12,%r12
+  8028ef:	74 79                	je     80296a <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  8028f1:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  8028f6:	49 39 dc             	cmp    %rbx,%r12
+  8028f9:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  8028fd:	48 89 da             	mov    %rbx,%rdx
+  802900:	4c 89 f6             	mov    %r14,%rsi
+  802903:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  80290a:	00 00 00 
+  80290d:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  802914:	00 00 00 
+  802917:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  802919:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  80291d:	8b 40 0c             	mov    0xc(%rax),%eax
+  802920:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  802923:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  802926:	44 01 e8             	add    %r13d,%eax
+  802929:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  80292d:	41 0f 44 c5          	cmove  %r13d,%eax
+  802931:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  802935:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  802939:	48 89 da             	mov    %rbx,%rdx
+  80293c:	be 00 00 00 00       	mov    $0x0,%esi
+  802941:	bf 04 00 00 00       	mov    $0x4,%edi
+  802946:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  80294d:	00 00 00 
+  802950:	ff d0                	call   *%rax
+        if (res < 0)
+  802952:	85 c0                	test   %eax,%eax
+  802954:	78 4a                	js     8029a0 <devfile_write_direct+0xf9>
+        buf += res;
+  802956:	48 98                	cltq
+  802958:	49 01 c6             	add    %rax,%r14
+        write += res;
+  80295b:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  80295f:	49 29 c4             	sub    %rax,%r12
+  802962:	75 8d                	jne    8028f1 <devfile_write_direct+0x4a>
+    return write;
+  802964:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802968:	eb 27                	jmp    802991 <devfile_write_direct+0xea>
+    size_t write = 0;
+  80296a:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  80296e:	eb f4                	jmp    802964 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  802970:	45 89 e9             	mov    %r13d,%r9d
+  802973:	4d 89 e0             	mov    %r12,%r8
+  802976:	4c 89 f1             	mov    %r14,%rcx
+  802979:	ba 04 00 00 00       	mov    $0x4,%edx
+  80297e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802982:	48 89 c7             	mov    %rax,%rdi
+  802985:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  80298c:	00 00 00 
+  80298f:	ff d0                	call   *%rax
+}
+  802991:	48 83 c4 18          	add    $0x18,%rsp
+  802995:	5b                   	pop    %rbx
+  802996:	41 5c                	pop    %r12
+  802998:	41 5d                	pop    %r13
+  80299a:	41 5e                	pop    %r14
+  80299c:	41 5f                	pop    %r15
+  80299e:	5d                   	pop    %rbp
+  80299f:	c3                   	ret
+            return res;
+  8029a0:	48 98                	cltq
+  8029a2:	eb ed                	jmp    802991 <devfile_write_direct+0xea>
+
+00000000008029a4 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8029a4:	55                   	push   %rbp
+  8029a5:	48 89 e5             	mov    %rsp,%rbp
+  8029a8:	41 54                	push   %r12
+  8029aa:	53                   	push   %rbx
+  8029ab:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8029ae:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  8029b5:	00 00 00 
+  8029b8:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  8029ba:	48 85 c0             	test   %rax,%rax
+  8029bd:	74 71                	je     802a30 <fbuf_flush+0x8c>
+  8029bf:	48 89 c3             	mov    %rax,%rbx
+  8029c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8029c7:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  8029cb:	75 05                	jne    8029d2 <fbuf_flush+0x2e>
+}
+  8029cd:	5b                   	pop    %rbx
+  8029ce:	41 5c                	pop    %r12
+  8029d0:	5d                   	pop    %rbp
+  8029d1:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  8029d2:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  8029d5:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8029d9:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8029e0:	00 00 00 
+  8029e3:	48 89 de             	mov    %rbx,%rsi
+  8029e6:	48 29 c6             	sub    %rax,%rsi
+  8029e9:	48 c1 fe 03          	sar    $0x3,%rsi
+  8029ed:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8029f4:	aa aa aa 
+  8029f7:	48 0f af f0          	imul   %rax,%rsi
+  8029fb:	48 c1 e6 0e          	shl    $0xe,%rsi
+  8029ff:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802a04:	48 01 c6             	add    %rax,%rsi
+  802a07:	4c 89 e7             	mov    %r12,%rdi
+  802a0a:	48 b8 a7 28 80 00 00 	movabs $0x8028a7,%rax
+  802a11:	00 00 00 
+  802a14:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  802a16:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  802a1a:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  802a21:	00 
+    return res < 0 ? res : 0;
+  802a22:	48 85 c0             	test   %rax,%rax
+  802a25:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a2a:	48 0f 4f c2          	cmovg  %rdx,%rax
+  802a2e:	eb 9d                	jmp    8029cd <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  802a30:	b8 00 00 00 00       	mov    $0x0,%eax
+  802a35:	eb 96                	jmp    8029cd <fbuf_flush+0x29>
+
+0000000000802a37 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  802a37:	55                   	push   %rbp
+  802a38:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  802a3b:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802a42:	00 00 00 
+  802a45:	ff d0                	call   *%rax
+}
+  802a47:	5d                   	pop    %rbp
+  802a48:	c3                   	ret
+
+0000000000802a49 <devfile_write>:
+    if (!fd || !buf)
+  802a49:	48 85 ff             	test   %rdi,%rdi
+  802a4c:	0f 84 d3 01 00 00    	je     802c25 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  802a52:	55                   	push   %rbp
+  802a53:	48 89 e5             	mov    %rsp,%rbp
+  802a56:	41 57                	push   %r15
+  802a58:	41 56                	push   %r14
+  802a5a:	41 55                	push   %r13
+  802a5c:	41 54                	push   %r12
+  802a5e:	53                   	push   %rbx
+  802a5f:	48 83 ec 08          	sub    $0x8,%rsp
+  802a63:	49 89 fc             	mov    %rdi,%r12
+  802a66:	49 89 f6             	mov    %rsi,%r14
+  802a69:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  802a6c:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802a71:	48 85 f6             	test   %rsi,%rsi
+  802a74:	0f 84 9c 01 00 00    	je     802c16 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802a7a:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  802a81:	00 00 00 
+  802a84:	ff d0                	call   *%rax
+  802a86:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802a89:	48 85 c0             	test   %rax,%rax
+  802a8c:	0f 84 a2 00 00 00    	je     802b34 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802a92:	be 00 10 00 00       	mov    $0x1000,%esi
+  802a97:	4c 89 e7             	mov    %r12,%rdi
+  802a9a:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  802aa1:	00 00 00 
+  802aa4:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802aa6:	83 f8 02             	cmp    $0x2,%eax
+  802aa9:	0f 8f 85 00 00 00    	jg     802b34 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  802aaf:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802ab6:	00 00 00 
+  802ab9:	4d 89 ef             	mov    %r13,%r15
+  802abc:	49 29 c7             	sub    %rax,%r15
+  802abf:	49 c1 ff 03          	sar    $0x3,%r15
+  802ac3:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802aca:	aa aa aa 
+  802acd:	4c 0f af f8          	imul   %rax,%r15
+  802ad1:	49 c1 e7 0e          	shl    $0xe,%r15
+  802ad5:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802ada:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802add:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802ae2:	0f 84 d7 00 00 00    	je     802bbf <devfile_write+0x176>
+  802ae8:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802aec:	89 c2                	mov    %eax,%edx
+  802aee:	41 03 55 0c          	add    0xc(%r13),%edx
+  802af2:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802af7:	75 0f                	jne    802b08 <devfile_write+0xbf>
+  802af9:	48 01 d8             	add    %rbx,%rax
+  802afc:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  802b02:	0f 86 92 00 00 00    	jbe    802b9a <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b08:	4c 89 e7             	mov    %r12,%rdi
+  802b0b:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802b12:	00 00 00 
+  802b15:	ff d0                	call   *%rax
+  802b17:	85 c0                	test   %eax,%eax
+  802b19:	78 52                	js     802b6d <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b1b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802b22:	77 7f                	ja     802ba3 <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  802b24:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  802b29:	0f 85 c2 00 00 00    	jne    802bf1 <devfile_write+0x1a8>
+  802b2f:	e9 94 00 00 00       	jmp    802bc8 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  802b34:	4c 89 e7             	mov    %r12,%rdi
+  802b37:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802b3e:	00 00 00 
+  802b41:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b43:	85 c0                	test   %eax,%eax
+  802b45:	79 07                	jns    802b4e <devfile_write+0x105>
+  802b47:	48 98                	cltq
+  802b49:	e9 c8 00 00 00       	jmp    802c16 <devfile_write+0x1cd>
+  802b4e:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802b53:	48 89 da             	mov    %rbx,%rdx
+  802b56:	4c 89 f6             	mov    %r14,%rsi
+  802b59:	4c 89 e7             	mov    %r12,%rdi
+  802b5c:	48 b8 a7 28 80 00 00 	movabs $0x8028a7,%rax
+  802b63:	00 00 00 
+  802b66:	ff d0                	call   *%rax
+  802b68:	e9 a9 00 00 00       	jmp    802c16 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802b6d:	48 98                	cltq
+  802b6f:	e9 a2 00 00 00       	jmp    802c16 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b74:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802b79:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802b7e:	4c 89 fe             	mov    %r15,%rsi
+  802b81:	bf 00 00 00 00       	mov    $0x0,%edi
+  802b86:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  802b8d:	00 00 00 
+  802b90:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  802b92:	85 c0                	test   %eax,%eax
+  802b94:	79 45                	jns    802bdb <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802b96:	48 98                	cltq
+  802b98:	eb 7c                	jmp    802c16 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802b9a:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802ba1:	76 4e                	jbe    802bf1 <devfile_write+0x1a8>
+  802ba3:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802ba8:	48 89 da             	mov    %rbx,%rdx
+  802bab:	4c 89 f6             	mov    %r14,%rsi
+  802bae:	4c 89 e7             	mov    %r12,%rdi
+  802bb1:	48 b8 a7 28 80 00 00 	movabs $0x8028a7,%rax
+  802bb8:	00 00 00 
+  802bbb:	ff d0                	call   *%rax
+  802bbd:	eb 57                	jmp    802c16 <devfile_write+0x1cd>
+  802bbf:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802bc6:	77 db                	ja     802ba3 <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802bc8:	4c 89 ff             	mov    %r15,%rdi
+  802bcb:	48 b8 72 41 80 00 00 	movabs $0x804172,%rax
+  802bd2:	00 00 00 
+  802bd5:	ff d0                	call   *%rax
+  802bd7:	84 c0                	test   %al,%al
+  802bd9:	74 99                	je     802b74 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802bdb:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  802be0:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802be5:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802be9:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  802bf0:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  802bf1:	4c 89 ff             	mov    %r15,%rdi
+  802bf4:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802bf8:	48 89 da             	mov    %rbx,%rdx
+  802bfb:	4c 89 f6             	mov    %r14,%rsi
+  802bfe:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  802c05:	00 00 00 
+  802c08:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802c0a:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  802c0e:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  802c13:	48 89 d8             	mov    %rbx,%rax
+}
+  802c16:	48 83 c4 08          	add    $0x8,%rsp
+  802c1a:	5b                   	pop    %rbx
+  802c1b:	41 5c                	pop    %r12
+  802c1d:	41 5d                	pop    %r13
+  802c1f:	41 5e                	pop    %r14
+  802c21:	41 5f                	pop    %r15
+  802c23:	5d                   	pop    %rbp
+  802c24:	c3                   	ret
+        return E_INVAL;
+  802c25:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802c2a:	c3                   	ret
+
+0000000000802c2b <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  802c2b:	55                   	push   %rbp
+  802c2c:	48 89 e5             	mov    %rsp,%rbp
+  802c2f:	41 54                	push   %r12
+  802c31:	53                   	push   %rbx
+  802c32:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  802c35:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802c3c:	00 00 00 
+  802c3f:	ff d0                	call   *%rax
+  802c41:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  802c44:	48 89 df             	mov    %rbx,%rdi
+  802c47:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  802c4e:	00 00 00 
+  802c51:	ff d0                	call   *%rax
+  802c53:	48 85 c0             	test   %rax,%rax
+  802c56:	74 17                	je     802c6f <devfile_flush+0x44>
+  802c58:	48 89 df             	mov    %rbx,%rdi
+  802c5b:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  802c62:	00 00 00 
+  802c65:	ff d0                	call   *%rax
+  802c67:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  802c6e:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  802c6f:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802c72:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802c79:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802c7b:	ba 00 00 00 00       	mov    $0x0,%edx
+  802c80:	be 00 00 00 00       	mov    $0x0,%esi
+  802c85:	bf 06 00 00 00       	mov    $0x6,%edi
+  802c8a:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  802c91:	00 00 00 
+  802c94:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802c96:	45 85 e4             	test   %r12d,%r12d
+  802c99:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802c9d:	5b                   	pop    %rbx
+  802c9e:	41 5c                	pop    %r12
+  802ca0:	5d                   	pop    %rbp
+  802ca1:	c3                   	ret
+
+0000000000802ca2 <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802ca2:	55                   	push   %rbp
+  802ca3:	48 89 e5             	mov    %rsp,%rbp
+  802ca6:	41 57                	push   %r15
+  802ca8:	41 56                	push   %r14
+  802caa:	41 55                	push   %r13
+  802cac:	41 54                	push   %r12
+  802cae:	53                   	push   %rbx
+  802caf:	48 83 ec 38          	sub    $0x38,%rsp
+  802cb3:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802cb7:	49 89 f7             	mov    %rsi,%r15
+  802cba:	48 89 d3             	mov    %rdx,%rbx
+  802cbd:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802cc0:	48 b8 ed 21 80 00 00 	movabs $0x8021ed,%rax
+  802cc7:	00 00 00 
+  802cca:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802ccc:	48 85 c0             	test   %rax,%rax
+  802ccf:	75 20                	jne    802cf1 <devfile_read_direct+0x4f>
+    bool map = 1;
+  802cd1:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802cd6:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802cdd:	00 
+    while (n) {
+  802cde:	48 85 db             	test   %rbx,%rbx
+  802ce1:	0f 85 df 00 00 00    	jne    802dc6 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802ce7:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802ceb:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802cef:	eb 21                	jmp    802d12 <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802cf1:	45 89 f1             	mov    %r14d,%r9d
+  802cf4:	49 89 d8             	mov    %rbx,%r8
+  802cf7:	4c 89 f9             	mov    %r15,%rcx
+  802cfa:	ba 03 00 00 00       	mov    $0x3,%edx
+  802cff:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802d03:	48 89 c7             	mov    %rax,%rdi
+  802d06:	48 b8 d4 22 80 00 00 	movabs $0x8022d4,%rax
+  802d0d:	00 00 00 
+  802d10:	ff d0                	call   *%rax
+}
+  802d12:	48 83 c4 38          	add    $0x38,%rsp
+  802d16:	5b                   	pop    %rbx
+  802d17:	41 5c                	pop    %r12
+  802d19:	41 5d                	pop    %r13
+  802d1b:	41 5e                	pop    %r14
+  802d1d:	41 5f                	pop    %r15
+  802d1f:	5d                   	pop    %rbp
+  802d20:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802d21:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d25:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802d2b:	75 1e                	jne    802d4b <devfile_read_direct+0xa9>
+  802d2d:	e9 e2 00 00 00       	jmp    802e14 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802d32:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802d36:	eb da                	jmp    802d12 <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802d38:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802d3c:	0f 85 d0 01 00 00    	jne    802f12 <devfile_read_direct+0x270>
+            map = 0;
+  802d42:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802d46:	eb 03                	jmp    802d4b <devfile_read_direct+0xa9>
+  802d48:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802d4b:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802d50:	48 39 d3             	cmp    %rdx,%rbx
+  802d53:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802d57:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802d5b:	8b 40 0c             	mov    0xc(%rax),%eax
+  802d5e:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802d65:	00 00 00 
+  802d68:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802d6a:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802d6e:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802d72:	be 00 00 00 00       	mov    $0x0,%esi
+  802d77:	bf 03 00 00 00       	mov    $0x3,%edi
+  802d7c:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  802d83:	00 00 00 
+  802d86:	ff d0                	call   *%rax
+        if (res <= 0)
+  802d88:	85 c0                	test   %eax,%eax
+  802d8a:	0f 8e 63 01 00 00    	jle    802ef3 <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802d90:	4c 63 e0             	movslq %eax,%r12
+  802d93:	4c 89 e2             	mov    %r12,%rdx
+  802d96:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802d9d:	00 00 00 
+  802da0:	4c 89 ff             	mov    %r15,%rdi
+  802da3:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  802daa:	00 00 00 
+  802dad:	ff d0                	call   *%rax
+        buf += res;
+  802daf:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802db2:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802db5:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802db9:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802dbd:	48 85 db             	test   %rbx,%rbx
+  802dc0:	0f 84 25 ff ff ff    	je     802ceb <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802dc6:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802dc9:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802dcd:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802dd1:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802dd5:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802ddc:	0f 97 c2             	seta   %dl
+  802ddf:	20 c2                	and    %al,%dl
+  802de1:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802de4:	0f 84 5e ff ff ff    	je     802d48 <devfile_read_direct+0xa6>
+  802dea:	4c 89 fa             	mov    %r15,%rdx
+  802ded:	4d 89 fd             	mov    %r15,%r13
+  802df0:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802df7:	0f 85 4e ff ff ff    	jne    802d4b <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802dfd:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802e01:	0f 84 1a ff ff ff    	je     802d21 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802e07:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802e0e:	0f 85 37 ff ff ff    	jne    802d4b <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802e14:	48 89 d8             	mov    %rbx,%rax
+  802e17:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802e1d:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802e22:	48 39 c8             	cmp    %rcx,%rax
+  802e25:	48 0f 47 c1          	cmova  %rcx,%rax
+  802e29:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802e2d:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802e31:	49 89 d4             	mov    %rdx,%r12
+  802e34:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802e38:	48 b8 13 41 80 00 00 	movabs $0x804113,%rax
+  802e3f:	00 00 00 
+  802e42:	ff d0                	call   *%rax
+  802e44:	a8 40                	test   $0x40,%al
+  802e46:	0f 85 b9 00 00 00    	jne    802f05 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802e4c:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802e53:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e57:	49 39 c5             	cmp    %rax,%r13
+  802e5a:	72 d8                	jb     802e34 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802e5c:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802e60:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e67:	00 00 00 
+  802e6a:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802e6e:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802e71:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802e73:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802e77:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802e7b:	48 b8 88 20 80 00 00 	movabs $0x802088,%rax
+  802e82:	00 00 00 
+  802e85:	ff d0                	call   *%rax
+  802e87:	89 c7                	mov    %eax,%edi
+  802e89:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802e8f:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802e94:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802e9b:	00 00 00 
+  802e9e:	be 0e 00 00 00       	mov    $0xe,%esi
+  802ea3:	48 b8 20 4a 80 00 00 	movabs $0x804a20,%rax
+  802eaa:	00 00 00 
+  802ead:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802eaf:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802eb4:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802eb8:	4c 89 fe             	mov    %r15,%rsi
+  802ebb:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ec0:	48 b8 fc 49 80 00 00 	movabs $0x8049fc,%rax
+  802ec7:	00 00 00 
+  802eca:	ff d0                	call   *%rax
+  802ecc:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802ecf:	48 85 d2             	test   %rdx,%rdx
+  802ed2:	0f 84 5a fe ff ff    	je     802d32 <devfile_read_direct+0x90>
+            if (res > 0) {
+  802ed8:	0f 8e 5a fe ff ff    	jle    802d38 <devfile_read_direct+0x96>
+                buf += res;
+  802ede:	48 98                	cltq
+  802ee0:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802ee3:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802ee6:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802eea:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802eee:	e9 ca fe ff ff       	jmp    802dbd <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802ef3:	41 89 c5             	mov    %eax,%r13d
+  802ef6:	48 98                	cltq
+  802ef8:	45 85 ed             	test   %r13d,%r13d
+  802efb:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802f00:	e9 0d fe ff ff       	jmp    802d12 <devfile_read_direct+0x70>
+            map = 0;
+  802f05:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802f09:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802f0d:	e9 39 fe ff ff       	jmp    802d4b <devfile_read_direct+0xa9>
+  802f12:	48 89 d0             	mov    %rdx,%rax
+  802f15:	e9 f8 fd ff ff       	jmp    802d12 <devfile_read_direct+0x70>
+
+0000000000802f1a <devfile_read>:
+    if (!fd || !buf)
+  802f1a:	48 85 ff             	test   %rdi,%rdi
+  802f1d:	0f 84 21 02 00 00    	je     803144 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802f23:	55                   	push   %rbp
+  802f24:	48 89 e5             	mov    %rsp,%rbp
+  802f27:	41 57                	push   %r15
+  802f29:	41 56                	push   %r14
+  802f2b:	41 55                	push   %r13
+  802f2d:	41 54                	push   %r12
+  802f2f:	53                   	push   %rbx
+  802f30:	48 83 ec 28          	sub    $0x28,%rsp
+  802f34:	48 89 fb             	mov    %rdi,%rbx
+  802f37:	49 89 f4             	mov    %rsi,%r12
+  802f3a:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802f3d:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802f42:	48 85 f6             	test   %rsi,%rsi
+  802f45:	74 4b                	je     802f92 <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802f47:	48 b8 57 22 80 00 00 	movabs $0x802257,%rax
+  802f4e:	00 00 00 
+  802f51:	ff d0                	call   *%rax
+  802f53:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f56:	48 85 c0             	test   %rax,%rax
+  802f59:	74 22                	je     802f7d <devfile_read+0x63>
+  802f5b:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802f62:	77 19                	ja     802f7d <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802f64:	be 00 10 00 00       	mov    $0x1000,%esi
+  802f69:	48 89 df             	mov    %rbx,%rdi
+  802f6c:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802f78:	83 f8 02             	cmp    $0x2,%eax
+  802f7b:	7e 40                	jle    802fbd <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802f7d:	48 89 df             	mov    %rbx,%rdi
+  802f80:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802f87:	00 00 00 
+  802f8a:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802f8c:	85 c0                	test   %eax,%eax
+  802f8e:	79 11                	jns    802fa1 <devfile_read+0x87>
+  802f90:	48 98                	cltq
+}
+  802f92:	48 83 c4 28          	add    $0x28,%rsp
+  802f96:	5b                   	pop    %rbx
+  802f97:	41 5c                	pop    %r12
+  802f99:	41 5d                	pop    %r13
+  802f9b:	41 5e                	pop    %r14
+  802f9d:	41 5f                	pop    %r15
+  802f9f:	5d                   	pop    %rbp
+  802fa0:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802fa1:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802fa6:	4c 89 ea             	mov    %r13,%rdx
+  802fa9:	4c 89 e6             	mov    %r12,%rsi
+  802fac:	48 89 df             	mov    %rbx,%rdi
+  802faf:	48 b8 a2 2c 80 00 00 	movabs $0x802ca2,%rax
+  802fb6:	00 00 00 
+  802fb9:	ff d0                	call   *%rax
+  802fbb:	eb d5                	jmp    802f92 <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802fbd:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802fc1:	48 89 df             	mov    %rbx,%rdi
+  802fc4:	48 b8 a4 29 80 00 00 	movabs $0x8029a4,%rax
+  802fcb:	00 00 00 
+  802fce:	ff d0                	call   *%rax
+  802fd0:	85 c0                	test   %eax,%eax
+  802fd2:	0f 88 33 01 00 00    	js     80310b <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802fd8:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802fdf:	00 00 00 
+  802fe2:	4c 89 f0             	mov    %r14,%rax
+  802fe5:	48 29 d0             	sub    %rdx,%rax
+  802fe8:	48 c1 f8 03          	sar    $0x3,%rax
+  802fec:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802ff3:	aa aa aa 
+  802ff6:	48 0f af c2          	imul   %rdx,%rax
+  802ffa:	48 c1 e0 0e          	shl    $0xe,%rax
+  802ffe:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803002:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803005:	41 39 06             	cmp    %eax,(%r14)
+  803008:	75 0d                	jne    803017 <devfile_read+0xfd>
+  80300a:	8b 43 10             	mov    0x10(%rbx),%eax
+  80300d:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803011:	0f 84 fb 00 00 00    	je     803112 <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803017:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80301c:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803020:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803023:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803027:	48 89 c7             	mov    %rax,%rdi
+  80302a:	48 b8 72 41 80 00 00 	movabs $0x804172,%rax
+  803031:	00 00 00 
+  803034:	ff d0                	call   *%rax
+  803036:	84 c0                	test   %al,%al
+  803038:	75 27                	jne    803061 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80303a:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80303f:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803044:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803048:	bf 00 00 00 00       	mov    $0x0,%edi
+  80304d:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803054:	00 00 00 
+  803057:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803059:	85 c0                	test   %eax,%eax
+  80305b:	0f 88 dc 00 00 00    	js     80313d <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803061:	44 89 f8             	mov    %r15d,%eax
+  803064:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803069:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  80306b:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803072:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803073:	8b 43 10             	mov    0x10(%rbx),%eax
+  803076:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  80307a:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  80307d:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803082:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803086:	48 89 df             	mov    %rbx,%rdi
+  803089:	48 b8 a2 2c 80 00 00 	movabs $0x802ca2,%rax
+  803090:	00 00 00 
+  803093:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803095:	48 85 c0             	test   %rax,%rax
+  803098:	0f 88 f4 fe ff ff    	js     802f92 <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  80309e:	8b 53 0c             	mov    0xc(%rbx),%edx
+  8030a1:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  8030a4:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  8030a7:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  8030ab:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  8030af:	48 63 d1             	movslq %ecx,%rdx
+  8030b2:	48 01 d0             	add    %rdx,%rax
+  8030b5:	4d 63 ff             	movslq %r15d,%r15
+  8030b8:	4c 29 f8             	sub    %r15,%rax
+  8030bb:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030c0:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  8030c4:	48 85 c0             	test   %rax,%rax
+  8030c7:	0f 8e c5 fe ff ff    	jle    802f92 <devfile_read+0x78>
+    n = MIN(n, res);
+  8030cd:	4c 39 e8             	cmp    %r13,%rax
+  8030d0:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  8030d4:	8b 73 04             	mov    0x4(%rbx),%esi
+  8030d7:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  8030db:	48 63 f6             	movslq %esi,%rsi
+  8030de:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  8030e3:	48 01 c6             	add    %rax,%rsi
+  8030e6:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030ea:	48 01 c6             	add    %rax,%rsi
+  8030ed:	4c 89 ea             	mov    %r13,%rdx
+  8030f0:	4c 89 e7             	mov    %r12,%rdi
+  8030f3:	48 b8 05 11 80 00 00 	movabs $0x801105,%rax
+  8030fa:	00 00 00 
+  8030fd:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  8030ff:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803103:	4c 89 e8             	mov    %r13,%rax
+  803106:	e9 87 fe ff ff       	jmp    802f92 <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  80310b:	48 98                	cltq
+  80310d:	e9 80 fe ff ff       	jmp    802f92 <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803112:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803116:	41 39 d7             	cmp    %edx,%r15d
+  803119:	0f 8c f8 fe ff ff    	jl     803017 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  80311f:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803123:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803126:	41 39 cf             	cmp    %ecx,%r15d
+  803129:	0f 8d e8 fe ff ff    	jge    803017 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  80312f:	4d 63 ff             	movslq %r15d,%r15
+  803132:	4c 29 f8             	sub    %r15,%rax
+  803135:	48 63 d2             	movslq %edx,%rdx
+  803138:	48 01 d0             	add    %rdx,%rax
+  80313b:	eb 87                	jmp    8030c4 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  80313d:	48 98                	cltq
+  80313f:	e9 4e fe ff ff       	jmp    802f92 <devfile_read+0x78>
+        return E_INVAL;
+  803144:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803149:	c3                   	ret
+
+000000000080314a <fs_channel>:
+fs_channel(bool enable) {
+  80314a:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  80314c:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803153:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803155:	ba 00 00 00 00       	mov    $0x0,%edx
+  80315a:	40 84 ff             	test   %dil,%dil
+  80315d:	74 47                	je     8031a6 <fs_channel+0x5c>
+  80315f:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  803166:	00 00 00 
+  803169:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  80316f:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803176:	00 00 00 
+  803179:	3b 08                	cmp    (%rax),%ecx
+  80317b:	74 29                	je     8031a6 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  80317d:	55                   	push   %rbp
+  80317e:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803181:	48 b8 ca 20 80 00 00 	movabs $0x8020ca,%rax
+  803188:	00 00 00 
+  80318b:	ff d0                	call   *%rax
+  80318d:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  80318f:	85 c0                	test   %eax,%eax
+  803191:	78 04                	js     803197 <fs_channel+0x4d>
+}
+  803193:	89 d0                	mov    %edx,%eax
+  803195:	5d                   	pop    %rbp
+  803196:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803197:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  80319e:	00 00 00 
+  8031a1:	c6 00 00             	movb   $0x0,(%rax)
+  8031a4:	eb ed                	jmp    803193 <fs_channel+0x49>
+}
+  8031a6:	89 d0                	mov    %edx,%eax
+  8031a8:	c3                   	ret
+
+00000000008031a9 <open>:
+open(const char *path, int mode) {
+  8031a9:	55                   	push   %rbp
+  8031aa:	48 89 e5             	mov    %rsp,%rbp
+  8031ad:	41 55                	push   %r13
+  8031af:	41 54                	push   %r12
+  8031b1:	53                   	push   %rbx
+  8031b2:	48 83 ec 18          	sub    $0x18,%rsp
+  8031b6:	49 89 fc             	mov    %rdi,%r12
+  8031b9:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  8031bc:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  8031c3:	00 00 00 
+  8031c6:	ff d0                	call   *%rax
+  8031c8:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8031ce:	0f 87 8f 00 00 00    	ja     803263 <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8031d4:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8031d8:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  8031df:	00 00 00 
+  8031e2:	ff d0                	call   *%rax
+  8031e4:	89 c3                	mov    %eax,%ebx
+  8031e6:	85 c0                	test   %eax,%eax
+  8031e8:	78 55                	js     80323f <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  8031ea:	4c 89 e6             	mov    %r12,%rsi
+  8031ed:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  8031f4:	00 00 00 
+  8031f7:	48 89 df             	mov    %rbx,%rdi
+  8031fa:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  803201:	00 00 00 
+  803204:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803206:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  80320d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803212:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803216:	bf 01 00 00 00       	mov    $0x1,%edi
+  80321b:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  803222:	00 00 00 
+  803225:	ff d0                	call   *%rax
+  803227:	89 c3                	mov    %eax,%ebx
+  803229:	85 c0                	test   %eax,%eax
+  80322b:	78 1f                	js     80324c <open+0xa3>
+    return fd2num(fd);
+  80322d:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803231:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  803238:	00 00 00 
+  80323b:	ff d0                	call   *%rax
+  80323d:	89 c3                	mov    %eax,%ebx
+}
+  80323f:	89 d8                	mov    %ebx,%eax
+  803241:	48 83 c4 18          	add    $0x18,%rsp
+  803245:	5b                   	pop    %rbx
+  803246:	41 5c                	pop    %r12
+  803248:	41 5d                	pop    %r13
+  80324a:	5d                   	pop    %rbp
+  80324b:	c3                   	ret
+        fd_close(fd, 0);
+  80324c:	be 00 00 00 00       	mov    $0x0,%esi
+  803251:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803255:	48 b8 9f 1a 80 00 00 	movabs $0x801a9f,%rax
+  80325c:	00 00 00 
+  80325f:	ff d0                	call   *%rax
+        return res;
+  803261:	eb dc                	jmp    80323f <open+0x96>
+        return -E_BAD_PATH;
+  803263:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803268:	eb d5                	jmp    80323f <open+0x96>
+
+000000000080326a <file_flush_buffers>:
+file_flush_buffers(void) {
+  80326a:	55                   	push   %rbp
+  80326b:	48 89 e5             	mov    %rsp,%rbp
+  80326e:	41 56                	push   %r14
+  803270:	41 55                	push   %r13
+  803272:	41 54                	push   %r12
+  803274:	53                   	push   %rbx
+  803275:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803279:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803280:	00 00 00 
+  803283:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803288:	49 bd e4 19 80 00 00 	movabs $0x8019e4,%r13
+  80328f:	00 00 00 
+  803292:	49 be a4 29 80 00 00 	movabs $0x8029a4,%r14
+  803299:	00 00 00 
+  80329c:	eb 0c                	jmp    8032aa <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80329e:	83 c3 01             	add    $0x1,%ebx
+  8032a1:	49 83 c4 18          	add    $0x18,%r12
+  8032a5:	83 fb 20             	cmp    $0x20,%ebx
+  8032a8:	74 1d                	je     8032c7 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  8032aa:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  8032af:	74 ed                	je     80329e <file_flush_buffers+0x34>
+  8032b1:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  8032b5:	89 df                	mov    %ebx,%edi
+  8032b7:	41 ff d5             	call   *%r13
+  8032ba:	85 c0                	test   %eax,%eax
+  8032bc:	78 e0                	js     80329e <file_flush_buffers+0x34>
+  8032be:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  8032c2:	41 ff d6             	call   *%r14
+  8032c5:	eb d7                	jmp    80329e <file_flush_buffers+0x34>
+}
+  8032c7:	48 83 c4 10          	add    $0x10,%rsp
+  8032cb:	5b                   	pop    %rbx
+  8032cc:	41 5c                	pop    %r12
+  8032ce:	41 5d                	pop    %r13
+  8032d0:	41 5e                	pop    %r14
+  8032d2:	5d                   	pop    %rbp
+  8032d3:	c3                   	ret
+
+00000000008032d4 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  8032d4:	55                   	push   %rbp
+  8032d5:	48 89 e5             	mov    %rsp,%rbp
+  8032d8:	41 54                	push   %r12
+  8032da:	53                   	push   %rbx
+  8032db:	49 89 fc             	mov    %rdi,%r12
+  8032de:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  8032e0:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  8032e7:	00 00 00 
+  8032ea:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  8032ec:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032f3:	00 00 00 
+  8032f6:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  8032fb:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  8032fd:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  803300:	ba 00 00 00 00       	mov    $0x0,%edx
+  803305:	be 00 00 00 00       	mov    $0x0,%esi
+  80330a:	bf 02 00 00 00       	mov    $0x2,%edi
+  80330f:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  803316:	00 00 00 
+  803319:	ff d0                	call   *%rax
+}
+  80331b:	5b                   	pop    %rbx
+  80331c:	41 5c                	pop    %r12
+  80331e:	5d                   	pop    %rbp
+  80331f:	c3                   	ret
+
+0000000000803320 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  803320:	55                   	push   %rbp
+  803321:	48 89 e5             	mov    %rsp,%rbp
+  803324:	41 54                	push   %r12
+  803326:	53                   	push   %rbx
+  803327:	49 89 fc             	mov    %rdi,%r12
+  80332a:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  80332d:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  803334:	00 00 00 
+  803337:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  803339:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  80333e:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803345:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  803347:	ba 00 00 00 00       	mov    $0x0,%edx
+  80334c:	be 00 00 00 00       	mov    $0x0,%esi
+  803351:	bf 05 00 00 00       	mov    $0x5,%edi
+  803356:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  80335d:	00 00 00 
+  803360:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803362:	85 c0                	test   %eax,%eax
+  803364:	78 3d                	js     8033a3 <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  803366:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  80336d:	00 00 00 
+  803370:	4c 89 e6             	mov    %r12,%rsi
+  803373:	48 89 df             	mov    %rbx,%rdi
+  803376:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  80337d:	00 00 00 
+  803380:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  803382:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803389:	00 
+  80338a:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  803390:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803397:	00 
+  803398:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80339e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8033a3:	5b                   	pop    %rbx
+  8033a4:	41 5c                	pop    %r12
+  8033a6:	5d                   	pop    %rbp
+  8033a7:	c3                   	ret
+
+00000000008033a8 <remove>:
+remove(const char *path) {
+  8033a8:	55                   	push   %rbp
+  8033a9:	48 89 e5             	mov    %rsp,%rbp
+  8033ac:	53                   	push   %rbx
+  8033ad:	48 83 ec 08          	sub    $0x8,%rsp
+  8033b1:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8033b4:	48 b8 66 0e 80 00 00 	movabs $0x800e66,%rax
+  8033bb:	00 00 00 
+  8033be:	ff d0                	call   *%rax
+  8033c0:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  8033c6:	77 3a                	ja     803402 <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  8033c8:	48 89 de             	mov    %rbx,%rsi
+  8033cb:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8033d2:	00 00 00 
+  8033d5:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  8033dc:	00 00 00 
+  8033df:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  8033e1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8033e6:	be 00 00 00 00       	mov    $0x0,%esi
+  8033eb:	bf 07 00 00 00       	mov    $0x7,%edi
+  8033f0:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  8033f7:	00 00 00 
+  8033fa:	ff d0                	call   *%rax
+}
+  8033fc:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803400:	c9                   	leave
+  803401:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803402:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803407:	eb f3                	jmp    8033fc <remove+0x54>
+
+0000000000803409 <sync>:
+sync(void) {
+  803409:	55                   	push   %rbp
+  80340a:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  80340d:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  803414:	00 00 00 
+  803417:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  803419:	ba 00 00 00 00       	mov    $0x0,%edx
+  80341e:	be 00 00 00 00       	mov    $0x0,%esi
+  803423:	bf 08 00 00 00       	mov    $0x8,%edi
+  803428:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  80342f:	00 00 00 
+  803432:	ff d0                	call   *%rax
+}
+  803434:	5d                   	pop    %rbp
+  803435:	c3                   	ret
+
+0000000000803436 <fsync>:
+fsync(int fdnum) {
+  803436:	55                   	push   %rbp
+  803437:	48 89 e5             	mov    %rsp,%rbp
+  80343a:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  80343e:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803442:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  803449:	00 00 00 
+  80344c:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80344e:	85 c0                	test   %eax,%eax
+  803450:	78 4b                	js     80349d <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803452:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  803456:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  80345d:	00 00 00 
+  803460:	8b 00                	mov    (%rax),%eax
+  803462:	39 02                	cmp    %eax,(%rdx)
+  803464:	75 39                	jne    80349f <fsync+0x69>
+    file_flush_buffers();
+  803466:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  80346d:	00 00 00 
+  803470:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  803472:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803476:	8b 40 0c             	mov    0xc(%rax),%eax
+  803479:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  803480:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  803482:	ba 00 00 00 00       	mov    $0x0,%edx
+  803487:	be 00 00 00 00       	mov    $0x0,%esi
+  80348c:	bf 0d 00 00 00       	mov    $0xd,%edi
+  803491:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  803498:	00 00 00 
+  80349b:	ff d0                	call   *%rax
+}
+  80349d:	c9                   	leave
+  80349e:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80349f:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8034a4:	eb f7                	jmp    80349d <fsync+0x67>
+
+00000000008034a6 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8034a6:	55                   	push   %rbp
+  8034a7:	48 89 e5             	mov    %rsp,%rbp
+  8034aa:	53                   	push   %rbx
+  8034ab:	48 83 ec 08          	sub    $0x8,%rsp
+  8034af:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8034b2:	ba 00 00 00 00       	mov    $0x0,%edx
+  8034b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8034bc:	bf 0b 00 00 00       	mov    $0xb,%edi
+  8034c1:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  8034c8:	00 00 00 
+  8034cb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8034cd:	85 c0                	test   %eax,%eax
+  8034cf:	78 2d                	js     8034fe <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  8034d1:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8034d8:	00 00 00 
+  8034db:	48 8b 10             	mov    (%rax),%rdx
+  8034de:	48 89 13             	mov    %rdx,(%rbx)
+  8034e1:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8034e5:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8034e9:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8034ed:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8034f1:	48 8b 40 18          	mov    0x18(%rax),%rax
+  8034f5:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  8034f9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8034fe:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803502:	c9                   	leave
+  803503:	c3                   	ret
+
+0000000000803504 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803504:	55                   	push   %rbp
+  803505:	48 89 e5             	mov    %rsp,%rbp
+  803508:	53                   	push   %rbx
+  803509:	48 83 ec 08          	sub    $0x8,%rsp
+  80350d:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  803510:	ba 00 00 00 00       	mov    $0x0,%edx
+  803515:	be 00 00 00 00       	mov    $0x0,%esi
+  80351a:	bf 0c 00 00 00       	mov    $0xc,%edi
+  80351f:	48 b8 3b 27 80 00 00 	movabs $0x80273b,%rax
+  803526:	00 00 00 
+  803529:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  80352b:	85 c0                	test   %eax,%eax
+  80352d:	78 3d                	js     80356c <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  80352f:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803536:	00 00 00 
+  803539:	48 8b 10             	mov    (%rax),%rdx
+  80353c:	48 89 13             	mov    %rdx,(%rbx)
+  80353f:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803543:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803547:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  80354b:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80354f:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  803553:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  803557:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  80355b:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  80355f:	48 8b 40 28          	mov    0x28(%rax),%rax
+  803563:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  803567:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80356c:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  803570:	c9                   	leave
+  803571:	c3                   	ret
+
+0000000000803572 <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  803572:	55                   	push   %rbp
+  803573:	48 89 e5             	mov    %rsp,%rbp
+  803576:	41 57                	push   %r15
+  803578:	41 56                	push   %r14
+  80357a:	41 55                	push   %r13
+  80357c:	41 54                	push   %r12
+  80357e:	53                   	push   %rbx
+  80357f:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  803583:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  80358a:	00 
+  80358b:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  803592:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803598:	0f 85 43 01 00 00    	jne    8036e1 <munmap+0x16f>
+  80359e:	49 89 ff             	mov    %rdi,%r15
+  8035a1:	4c 39 f7             	cmp    %r14,%rdi
+  8035a4:	0f 87 37 01 00 00    	ja     8036e1 <munmap+0x16f>
+  8035aa:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8035b1:	00 00 00 
+  8035b4:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  8035ba:	eb 2c                	jmp    8035e8 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  8035bc:	4c 39 f8             	cmp    %r15,%rax
+  8035bf:	0f 83 85 00 00 00    	jae    80364a <munmap+0xd8>
+            m->mm_end = start;
+  8035c5:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8035ca:	48 83 c3 18          	add    $0x18,%rbx
+  8035ce:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  8035d5:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8035dc:	00 00 00 
+  8035df:	48 39 c3             	cmp    %rax,%rbx
+  8035e2:	0f 84 d0 00 00 00    	je     8036b8 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  8035e8:	49 89 dc             	mov    %rbx,%r12
+  8035eb:	48 8b 03             	mov    (%rbx),%rax
+  8035ee:	4c 39 f0             	cmp    %r14,%rax
+  8035f1:	73 d7                	jae    8035ca <munmap+0x58>
+  8035f3:	48 85 c0             	test   %rax,%rax
+  8035f6:	74 d2                	je     8035ca <munmap+0x58>
+  8035f8:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8035fc:	49 39 d7             	cmp    %rdx,%r15
+  8035ff:	73 c9                	jae    8035ca <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  803601:	49 39 d6             	cmp    %rdx,%r14
+  803604:	73 b6                	jae    8035bc <munmap+0x4a>
+  803606:	49 39 c7             	cmp    %rax,%r15
+  803609:	76 b1                	jbe    8035bc <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  80360b:	4c 89 ef             	mov    %r13,%rdi
+  80360e:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  803615:	00 00 00 
+  803618:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  80361a:	48 85 c0             	test   %rax,%rax
+  80361d:	0f 84 c5 00 00 00    	je     8036e8 <munmap+0x176>
+            *tail = *m;
+  803623:	48 8b 13             	mov    (%rbx),%rdx
+  803626:	48 89 10             	mov    %rdx,(%rax)
+  803629:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  80362d:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  803631:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803635:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  803639:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  80363c:	44 89 f2             	mov    %r14d,%edx
+  80363f:	2b 13                	sub    (%rbx),%edx
+  803641:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  803644:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  803648:	eb 80                	jmp    8035ca <munmap+0x58>
+        } else if (m->mm_end > end) {
+  80364a:	49 39 d6             	cmp    %rdx,%r14
+  80364d:	73 18                	jae    803667 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  80364f:	44 89 f2             	mov    %r14d,%edx
+  803652:	41 03 54 24 10       	add    0x10(%r12),%edx
+  803657:	29 c2                	sub    %eax,%edx
+  803659:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  80365e:	4d 89 34 24          	mov    %r14,(%r12)
+  803662:	e9 63 ff ff ff       	jmp    8035ca <munmap+0x58>
+    m->mm_start = 0;
+  803667:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  80366e:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  80366f:	4c 89 e6             	mov    %r12,%rsi
+  803672:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803679:	00 00 00 
+  80367c:	48 29 c6             	sub    %rax,%rsi
+  80367f:	48 c1 fe 03          	sar    $0x3,%rsi
+  803683:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80368a:	aa aa aa 
+  80368d:	48 0f af f0          	imul   %rax,%rsi
+  803691:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803695:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  80369a:	48 01 c6             	add    %rax,%rsi
+  80369d:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8036a2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036a7:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8036ae:	00 00 00 
+  8036b1:	ff d0                	call   *%rax
+}
+  8036b3:	e9 12 ff ff ff       	jmp    8035ca <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  8036b8:	4c 89 f2             	mov    %r14,%rdx
+  8036bb:	4c 29 fa             	sub    %r15,%rdx
+  8036be:	4c 89 fe             	mov    %r15,%rsi
+  8036c1:	bf 00 00 00 00       	mov    $0x0,%edi
+  8036c6:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  8036cd:	00 00 00 
+  8036d0:	ff d0                	call   *%rax
+}
+  8036d2:	48 83 c4 08          	add    $0x8,%rsp
+  8036d6:	5b                   	pop    %rbx
+  8036d7:	41 5c                	pop    %r12
+  8036d9:	41 5d                	pop    %r13
+  8036db:	41 5e                	pop    %r14
+  8036dd:	41 5f                	pop    %r15
+  8036df:	5d                   	pop    %rbp
+  8036e0:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8036e1:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8036e6:	eb ea                	jmp    8036d2 <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  8036e8:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  8036ed:	eb e3                	jmp    8036d2 <munmap+0x160>
+
+00000000008036ef <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  8036ef:	55                   	push   %rbp
+  8036f0:	48 89 e5             	mov    %rsp,%rbp
+  8036f3:	41 57                	push   %r15
+  8036f5:	41 56                	push   %r14
+  8036f7:	41 55                	push   %r13
+  8036f9:	41 54                	push   %r12
+  8036fb:	53                   	push   %rbx
+  8036fc:	48 83 ec 28          	sub    $0x28,%rsp
+  803700:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803704:	49 89 f5             	mov    %rsi,%r13
+  803707:	41 89 d6             	mov    %edx,%r14d
+  80370a:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  80370d:	41 89 cc             	mov    %ecx,%r12d
+  803710:	44 89 c7             	mov    %r8d,%edi
+  803713:	44 89 cb             	mov    %r9d,%ebx
+  803716:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  80371a:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  80371e:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  803725:	00 00 00 
+  803728:	ff d0                	call   *%rax
+  80372a:	41 89 c7             	mov    %eax,%r15d
+  80372d:	85 c0                	test   %eax,%eax
+  80372f:	0f 88 ae 01 00 00    	js     8038e3 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803735:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803739:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  803740:	00 00 00 
+  803743:	8b 32                	mov    (%rdx),%esi
+  803745:	39 30                	cmp    %esi,(%rax)
+  803747:	0f 85 7a 02 00 00    	jne    8039c7 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80374d:	8b 40 08             	mov    0x8(%rax),%eax
+  803750:	83 e0 03             	and    $0x3,%eax
+  803753:	83 f8 01             	cmp    $0x1,%eax
+  803756:	0f 84 76 02 00 00    	je     8039d2 <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  80375c:	4d 85 ed             	test   %r13,%r13
+  80375f:	0f 84 78 02 00 00    	je     8039dd <mmap+0x2ee>
+  803765:	85 db                	test   %ebx,%ebx
+  803767:	0f 88 70 02 00 00    	js     8039dd <mmap+0x2ee>
+  80376d:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  803773:	41 89 df             	mov    %ebx,%r15d
+  803776:	0f 85 6c 02 00 00    	jne    8039e8 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80377c:	44 89 f0             	mov    %r14d,%eax
+  80377f:	83 e0 fd             	and    $0xfffffffd,%eax
+  803782:	83 f8 04             	cmp    $0x4,%eax
+  803785:	0f 85 68 02 00 00    	jne    8039f3 <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80378b:	44 89 e1             	mov    %r12d,%ecx
+  80378e:	83 e1 01             	and    $0x1,%ecx
+  803791:	0f 95 c2             	setne  %dl
+  803794:	44 89 e0             	mov    %r12d,%eax
+  803797:	d1 e8                	shr    %eax
+  803799:	83 f0 01             	xor    $0x1,%eax
+  80379c:	83 e0 01             	and    $0x1,%eax
+  80379f:	38 c2                	cmp    %al,%dl
+  8037a1:	0f 85 57 02 00 00    	jne    8039fe <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8037a7:	85 c9                	test   %ecx,%ecx
+  8037a9:	74 0a                	je     8037b5 <mmap+0xc6>
+  8037ab:	41 f6 c6 02          	test   $0x2,%r14b
+  8037af:	0f 85 54 02 00 00    	jne    803a09 <mmap+0x31a>
+    file_flush_buffers();
+  8037b5:	48 b8 6a 32 80 00 00 	movabs $0x80326a,%rax
+  8037bc:	00 00 00 
+  8037bf:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  8037c1:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  8037c8:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  8037cf:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  8037d3:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  8037d6:	41 f6 c4 04          	test   $0x4,%r12b
+  8037da:	0f 84 15 01 00 00    	je     8038f5 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  8037e0:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037e3:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8037e9:	0f 85 25 02 00 00    	jne    803a14 <mmap+0x325>
+  8037ef:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  8037f3:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  8037fa:	00 00 00 
+  8037fd:	48 39 c2             	cmp    %rax,%rdx
+  803800:	0f 82 19 02 00 00    	jb     803a1f <mmap+0x330>
+  803806:	48 39 c7             	cmp    %rax,%rdi
+  803809:	0f 87 10 02 00 00    	ja     803a1f <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80380f:	4c 89 ee             	mov    %r13,%rsi
+  803812:	48 b8 72 35 80 00 00 	movabs $0x803572,%rax
+  803819:	00 00 00 
+  80381c:	ff d0                	call   *%rax
+  80381e:	85 c0                	test   %eax,%eax
+  803820:	0f 88 04 02 00 00    	js     803a2a <mmap+0x33b>
+    if (!handler) {
+  803826:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80382d:	00 00 00 
+  803830:	80 38 00             	cmpb   $0x0,(%rax)
+  803833:	75 2b                	jne    803860 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803835:	48 bf 0a 26 80 00 00 	movabs $0x80260a,%rdi
+  80383c:	00 00 00 
+  80383f:	48 b8 cb 46 80 00 00 	movabs $0x8046cb,%rax
+  803846:	00 00 00 
+  803849:	ff d0                	call   *%rax
+  80384b:	85 c0                	test   %eax,%eax
+  80384d:	0f 88 ea 01 00 00    	js     803a3d <mmap+0x34e>
+        handler = 1;
+  803853:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  80385a:	00 00 00 
+  80385d:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  803860:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803864:	48 b8 a9 26 80 00 00 	movabs $0x8026a9,%rax
+  80386b:	00 00 00 
+  80386e:	ff d0                	call   *%rax
+  803870:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  803873:	48 85 c0             	test   %rax,%rax
+  803876:	0f 84 c9 01 00 00    	je     803a45 <mmap+0x356>
+    m->mm_start = va;
+  80387c:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80387f:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  803883:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803887:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  80388a:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80388e:	44 89 e0             	mov    %r12d,%eax
+  803891:	c1 e0 06             	shl    $0x6,%eax
+  803894:	25 80 00 00 00       	and    $0x80,%eax
+  803899:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  80389c:	09 f0                	or     %esi,%eax
+  80389e:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8038a2:	41 f6 c4 08          	test   $0x8,%r12b
+  8038a6:	74 31                	je     8038d9 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038a8:	48 39 d3             	cmp    %rdx,%rbx
+  8038ab:	73 2c                	jae    8038d9 <mmap+0x1ea>
+  8038ad:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8038b2:	48 89 de             	mov    %rbx,%rsi
+  8038b5:	4c 89 f7             	mov    %r14,%rdi
+  8038b8:	48 b8 f9 24 80 00 00 	movabs $0x8024f9,%rax
+  8038bf:	00 00 00 
+  8038c2:	ff d0                	call   *%rax
+  8038c4:	49 89 c4             	mov    %rax,%r12
+  8038c7:	48 85 c0             	test   %rax,%rax
+  8038ca:	0f 8e d7 00 00 00    	jle    8039a7 <mmap+0x2b8>
+            va += n;
+  8038d0:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8038d3:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  8038d7:	72 d4                	jb     8038ad <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  8038d9:	49 8b 06             	mov    (%r14),%rax
+  8038dc:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  8038e0:	48 89 06             	mov    %rax,(%rsi)
+}
+  8038e3:	44 89 f8             	mov    %r15d,%eax
+  8038e6:	48 83 c4 28          	add    $0x28,%rsp
+  8038ea:	5b                   	pop    %rbx
+  8038eb:	41 5c                	pop    %r12
+  8038ed:	41 5d                	pop    %r13
+  8038ef:	41 5e                	pop    %r14
+  8038f1:	41 5f                	pop    %r15
+  8038f3:	5d                   	pop    %rbp
+  8038f4:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8038f5:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  8038fc:	00 00 00 
+  8038ff:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  803902:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803909:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80390c:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803911:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  803918:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80391b:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  803922:	00 00 00 
+  803925:	48 39 d7             	cmp    %rdx,%rdi
+  803928:	73 1c                	jae    803946 <mmap+0x257>
+        return -E_NO_MEM;
+  80392a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803930:	eb b1                	jmp    8038e3 <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803932:	48 83 c0 01          	add    $0x1,%rax
+  803936:	48 83 f8 1f          	cmp    $0x1f,%rax
+  80393a:	77 3f                	ja     80397b <mmap+0x28c>
+  80393c:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  803941:	48 39 d7             	cmp    %rdx,%rdi
+  803944:	72 2a                	jb     803970 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  803946:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  80394a:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  80394e:	48 39 d1             	cmp    %rdx,%rcx
+  803951:	73 df                	jae    803932 <mmap+0x243>
+  803953:	48 85 c9             	test   %rcx,%rcx
+  803956:	74 da                	je     803932 <mmap+0x243>
+  803958:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  80395c:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  803961:	48 39 d3             	cmp    %rdx,%rbx
+  803964:	73 cc                	jae    803932 <mmap+0x243>
+            va = mmaps[i].mm_end;
+  803966:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803969:	b8 00 00 00 00       	mov    $0x0,%eax
+  80396e:	eb cc                	jmp    80393c <mmap+0x24d>
+        return -E_NO_MEM;
+  803970:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803976:	e9 68 ff ff ff       	jmp    8038e3 <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  80397b:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  803980:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803987:	00 00 00 
+  80398a:	48 39 c2             	cmp    %rax,%rdx
+  80398d:	0f 82 9f 00 00 00    	jb     803a32 <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  803993:	48 85 db             	test   %rbx,%rbx
+  803996:	0f 85 8a fe ff ff    	jne    803826 <mmap+0x137>
+        return -E_NO_MEM;
+  80399c:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8039a2:	e9 3c ff ff ff       	jmp    8038e3 <mmap+0x1f4>
+        if (n < 0) {
+  8039a7:	0f 89 2c ff ff ff    	jns    8038d9 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8039ad:	49 8b 3e             	mov    (%r14),%rdi
+  8039b0:	4c 89 ee             	mov    %r13,%rsi
+  8039b3:	48 b8 72 35 80 00 00 	movabs $0x803572,%rax
+  8039ba:	00 00 00 
+  8039bd:	ff d0                	call   *%rax
+            return n;
+  8039bf:	45 89 e7             	mov    %r12d,%r15d
+  8039c2:	e9 1c ff ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8039c7:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039cd:	e9 11 ff ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8039d2:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039d8:	e9 06 ff ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8039dd:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039e3:	e9 fb fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+  8039e8:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039ee:	e9 f0 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8039f3:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8039f9:	e9 e5 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8039fe:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a04:	e9 da fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803a09:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  803a0f:	e9 cf fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  803a14:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a1a:	e9 c4 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+  803a1f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803a25:	e9 b9 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  803a2a:	41 89 c7             	mov    %eax,%r15d
+  803a2d:	e9 b1 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+        return -E_NO_MEM;
+  803a32:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a38:	e9 a6 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  803a3d:	41 89 c7             	mov    %eax,%r15d
+  803a40:	e9 9e fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  803a45:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803a4b:	e9 93 fe ff ff       	jmp    8038e3 <mmap+0x1f4>
+
+0000000000803a50 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  803a50:	55                   	push   %rbp
+  803a51:	48 89 e5             	mov    %rsp,%rbp
+  803a54:	41 54                	push   %r12
+  803a56:	53                   	push   %rbx
+  803a57:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a5a:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803a61:	00 00 00 
+  803a64:	ff d0                	call   *%rax
+  803a66:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  803a69:	48 be 20 52 80 00 00 	movabs $0x805220,%rsi
+  803a70:	00 00 00 
+  803a73:	48 89 df             	mov    %rbx,%rdi
+  803a76:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  803a7d:	00 00 00 
+  803a80:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  803a82:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803a87:	41 2b 04 24          	sub    (%r12),%eax
+  803a8b:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  803a91:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803a98:	00 00 00 
+    stat->st_dev = &devpipe;
+  803a9b:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  803aa2:	00 00 00 
+  803aa5:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803aac:	b8 00 00 00 00       	mov    $0x0,%eax
+  803ab1:	5b                   	pop    %rbx
+  803ab2:	41 5c                	pop    %r12
+  803ab4:	5d                   	pop    %rbp
+  803ab5:	c3                   	ret
+
+0000000000803ab6 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ab6:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ab9:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  803abf:	8b 17                	mov    (%rdi),%edx
+  803ac1:	85 d2                	test   %edx,%edx
+  803ac3:	75 01                	jne    803ac6 <pipe_wakeup+0x10>
+  803ac5:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803ac6:	55                   	push   %rbp
+  803ac7:	48 89 e5             	mov    %rsp,%rbp
+  803aca:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803acd:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  803ad3:	be 00 04 00 00       	mov    $0x400,%esi
+  803ad8:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  803adf:	00 00 00 
+  803ae2:	ff d0                	call   *%rax
+}
+  803ae4:	5d                   	pop    %rbp
+  803ae5:	c3                   	ret
+
+0000000000803ae6 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803ae6:	55                   	push   %rbp
+  803ae7:	48 89 e5             	mov    %rsp,%rbp
+  803aea:	41 55                	push   %r13
+  803aec:	41 54                	push   %r12
+  803aee:	53                   	push   %rbx
+  803aef:	48 83 ec 08          	sub    $0x8,%rsp
+  803af3:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803af6:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803afd:	00 00 00 
+  803b00:	ff d0                	call   *%rax
+  803b02:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803b05:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b0a:	4c 89 e6             	mov    %r12,%rsi
+  803b0d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b12:	49 bc a9 14 80 00 00 	movabs $0x8014a9,%r12
+  803b19:	00 00 00 
+  803b1c:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803b1f:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803b23:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803b27:	49 bd b6 3a 80 00 00 	movabs $0x803ab6,%r13
+  803b2e:	00 00 00 
+  803b31:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b34:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b38:	48 89 de             	mov    %rbx,%rsi
+  803b3b:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  803b3e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803b43:	48 89 de             	mov    %rbx,%rsi
+  803b46:	bf 00 00 00 00       	mov    $0x0,%edi
+  803b4b:	41 ff d4             	call   *%r12
+  803b4e:	48 83 c4 08          	add    $0x8,%rsp
+  803b52:	5b                   	pop    %rbx
+  803b53:	41 5c                	pop    %r12
+  803b55:	41 5d                	pop    %r13
+  803b57:	5d                   	pop    %rbp
+  803b58:	c3                   	ret
+
+0000000000803b59 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  803b59:	55                   	push   %rbp
+  803b5a:	48 89 e5             	mov    %rsp,%rbp
+  803b5d:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  803b60:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803b65:	be 00 10 00 00       	mov    $0x1000,%esi
+  803b6a:	48 b8 ec 13 80 00 00 	movabs $0x8013ec,%rax
+  803b71:	00 00 00 
+  803b74:	ff d0                	call   *%rax
+  803b76:	85 c0                	test   %eax,%eax
+  803b78:	0f 94 c0             	sete   %al
+  803b7b:	0f b6 c0             	movzbl %al,%eax
+}
+  803b7e:	5d                   	pop    %rbp
+  803b7f:	c3                   	ret
+
+0000000000803b80 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  803b80:	55                   	push   %rbp
+  803b81:	48 89 e5             	mov    %rsp,%rbp
+  803b84:	41 57                	push   %r15
+  803b86:	41 56                	push   %r14
+  803b88:	41 55                	push   %r13
+  803b8a:	41 54                	push   %r12
+  803b8c:	53                   	push   %rbx
+  803b8d:	48 83 ec 38          	sub    $0x38,%rsp
+  803b91:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803b95:	49 89 f4             	mov    %rsi,%r12
+  803b98:	49 89 d7             	mov    %rdx,%r15
+  803b9b:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803b9f:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803ba6:	00 00 00 
+  803ba9:	ff d0                	call   *%rax
+  803bab:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803bae:	4d 85 ff             	test   %r15,%r15
+  803bb1:	0f 84 f1 00 00 00    	je     803ca8 <devpipe_write+0x128>
+  803bb7:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803bbb:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  803bbf:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  803bc3:	49 bd 59 3b 80 00 00 	movabs $0x803b59,%r13
+  803bca:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803bcd:	49 bf b6 3a 80 00 00 	movabs $0x803ab6,%r15
+  803bd4:	00 00 00 
+  803bd7:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803bdb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803bdf:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  803be3:	8b 73 04             	mov    0x4(%rbx),%esi
+  803be6:	48 63 ce             	movslq %esi,%rcx
+  803be9:	48 63 03             	movslq (%rbx),%rax
+  803bec:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  803bf2:	48 39 c1             	cmp    %rax,%rcx
+  803bf5:	72 64                	jb     803c5b <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803bf7:	48 89 de             	mov    %rbx,%rsi
+  803bfa:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803bfe:	41 ff d5             	call   *%r13
+  803c01:	85 c0                	test   %eax,%eax
+  803c03:	0f 85 b9 00 00 00    	jne    803cc2 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803c09:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803c0d:	4c 89 f7             	mov    %r14,%rdi
+  803c10:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  803c13:	8b 43 04             	mov    0x4(%rbx),%eax
+  803c16:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  803c1d:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803c24:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803c2a:	8b 03                	mov    (%rbx),%eax
+  803c2c:	41 39 c4             	cmp    %eax,%r12d
+  803c2f:	75 b2                	jne    803be3 <devpipe_write+0x63>
+  803c31:	48 89 de             	mov    %rbx,%rsi
+  803c34:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803c38:	41 ff d5             	call   *%r13
+  803c3b:	85 c0                	test   %eax,%eax
+  803c3d:	75 a0                	jne    803bdf <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803c3f:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803c44:	44 89 e6             	mov    %r12d,%esi
+  803c47:	48 89 df             	mov    %rbx,%rdi
+  803c4a:	48 b8 71 17 80 00 00 	movabs $0x801771,%rax
+  803c51:	00 00 00 
+  803c54:	ff d0                	call   *%rax
+  803c56:	e9 7c ff ff ff       	jmp    803bd7 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  803c5b:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  803c5f:	41 0f b6 38          	movzbl (%r8),%edi
+  803c63:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803c6a:	80 80 80 
+  803c6d:	48 89 c8             	mov    %rcx,%rax
+  803c70:	48 f7 e2             	mul    %rdx
+  803c73:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803c77:	48 89 d0             	mov    %rdx,%rax
+  803c7a:	48 c1 e0 08          	shl    $0x8,%rax
+  803c7e:	48 29 d0             	sub    %rdx,%rax
+  803c81:	48 c1 e0 04          	shl    $0x4,%rax
+  803c85:	48 29 c1             	sub    %rax,%rcx
+  803c88:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803c8d:	83 c6 01             	add    $0x1,%esi
+  803c90:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803c93:	49 83 c0 01          	add    $0x1,%r8
+  803c97:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803c9b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803c9f:	49 39 c0             	cmp    %rax,%r8
+  803ca2:	0f 85 2f ff ff ff    	jne    803bd7 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803ca8:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803cac:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803cb0:	48 b8 b6 3a 80 00 00 	movabs $0x803ab6,%rax
+  803cb7:	00 00 00 
+  803cba:	ff d0                	call   *%rax
+    return n;
+  803cbc:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803cc0:	eb 05                	jmp    803cc7 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803cc2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803cc7:	48 83 c4 38          	add    $0x38,%rsp
+  803ccb:	5b                   	pop    %rbx
+  803ccc:	41 5c                	pop    %r12
+  803cce:	41 5d                	pop    %r13
+  803cd0:	41 5e                	pop    %r14
+  803cd2:	41 5f                	pop    %r15
+  803cd4:	5d                   	pop    %rbp
+  803cd5:	c3                   	ret
+
+0000000000803cd6 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803cd6:	55                   	push   %rbp
+  803cd7:	48 89 e5             	mov    %rsp,%rbp
+  803cda:	41 57                	push   %r15
+  803cdc:	41 56                	push   %r14
+  803cde:	41 55                	push   %r13
+  803ce0:	41 54                	push   %r12
+  803ce2:	53                   	push   %rbx
+  803ce3:	48 83 ec 28          	sub    $0x28,%rsp
+  803ce7:	49 89 fd             	mov    %rdi,%r13
+  803cea:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803cee:	49 89 d4             	mov    %rdx,%r12
+  803cf1:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803cf5:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803cfc:	00 00 00 
+  803cff:	ff d0                	call   *%rax
+  803d01:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803d04:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803d0a:	49 bf 59 3b 80 00 00 	movabs $0x803b59,%r15
+  803d11:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803d14:	4d 85 e4             	test   %r12,%r12
+  803d17:	0f 84 d5 00 00 00    	je     803df2 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d1d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803d21:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803d25:	8b 03                	mov    (%rbx),%eax
+  803d27:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803d2a:	75 7a                	jne    803da6 <devpipe_read+0xd0>
+            if (i > 0) {
+  803d2c:	4d 85 f6             	test   %r14,%r14
+  803d2f:	75 50                	jne    803d81 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803d31:	48 89 de             	mov    %rbx,%rsi
+  803d34:	4c 89 ef             	mov    %r13,%rdi
+  803d37:	41 ff d7             	call   *%r15
+  803d3a:	85 c0                	test   %eax,%eax
+  803d3c:	0f 85 c9 00 00 00    	jne    803e0b <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803d42:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803d45:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803d4c:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803d52:	8b 43 04             	mov    0x4(%rbx),%eax
+  803d55:	41 39 c4             	cmp    %eax,%r12d
+  803d58:	75 cb                	jne    803d25 <devpipe_read+0x4f>
+  803d5a:	48 89 de             	mov    %rbx,%rsi
+  803d5d:	4c 89 ef             	mov    %r13,%rdi
+  803d60:	41 ff d7             	call   *%r15
+  803d63:	85 c0                	test   %eax,%eax
+  803d65:	75 be                	jne    803d25 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803d67:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803d6c:	44 89 e6             	mov    %r12d,%esi
+  803d6f:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803d73:	48 b8 71 17 80 00 00 	movabs $0x801771,%rax
+  803d7a:	00 00 00 
+  803d7d:	ff d0                	call   *%rax
+  803d7f:	eb a4                	jmp    803d25 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803d81:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803d85:	48 89 de             	mov    %rbx,%rsi
+  803d88:	48 b8 b6 3a 80 00 00 	movabs $0x803ab6,%rax
+  803d8f:	00 00 00 
+  803d92:	ff d0                	call   *%rax
+                return i;
+  803d94:	4c 89 f0             	mov    %r14,%rax
+}
+  803d97:	48 83 c4 28          	add    $0x28,%rsp
+  803d9b:	5b                   	pop    %rbx
+  803d9c:	41 5c                	pop    %r12
+  803d9e:	41 5d                	pop    %r13
+  803da0:	41 5e                	pop    %r14
+  803da2:	41 5f                	pop    %r15
+  803da4:	5d                   	pop    %rbp
+  803da5:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803da6:	48 63 c8             	movslq %eax,%rcx
+  803da9:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803db0:	80 80 80 
+  803db3:	48 89 c8             	mov    %rcx,%rax
+  803db6:	48 f7 e2             	mul    %rdx
+  803db9:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803dbd:	48 89 d0             	mov    %rdx,%rax
+  803dc0:	48 c1 e0 08          	shl    $0x8,%rax
+  803dc4:	48 29 d0             	sub    %rdx,%rax
+  803dc7:	48 c1 e0 04          	shl    $0x4,%rax
+  803dcb:	48 89 c2             	mov    %rax,%rdx
+  803dce:	48 89 c8             	mov    %rcx,%rax
+  803dd1:	48 29 d0             	sub    %rdx,%rax
+  803dd4:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803dd9:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ddd:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803de1:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803de4:	49 83 c6 01          	add    $0x1,%r14
+  803de8:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803dec:	0f 85 2b ff ff ff    	jne    803d1d <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803df2:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803df6:	48 89 de             	mov    %rbx,%rsi
+  803df9:	48 b8 b6 3a 80 00 00 	movabs $0x803ab6,%rax
+  803e00:	00 00 00 
+  803e03:	ff d0                	call   *%rax
+    return n;
+  803e05:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803e09:	eb 8c                	jmp    803d97 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803e0b:	b8 00 00 00 00       	mov    $0x0,%eax
+  803e10:	eb 85                	jmp    803d97 <devpipe_read+0xc1>
+
+0000000000803e12 <pipe>:
+pipe(int pfd[2]) {
+  803e12:	55                   	push   %rbp
+  803e13:	48 89 e5             	mov    %rsp,%rbp
+  803e16:	41 55                	push   %r13
+  803e18:	41 54                	push   %r12
+  803e1a:	53                   	push   %rbx
+  803e1b:	48 83 ec 18          	sub    $0x18,%rsp
+  803e1f:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e22:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803e26:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803e2d:	00 00 00 
+  803e30:	ff d0                	call   *%rax
+  803e32:	89 c3                	mov    %eax,%ebx
+  803e34:	85 c0                	test   %eax,%eax
+  803e36:	0f 88 a0 01 00 00    	js     803fdc <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803e3c:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e46:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803e4a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e4f:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803e56:	00 00 00 
+  803e59:	ff d0                	call   *%rax
+  803e5b:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803e5d:	85 c0                	test   %eax,%eax
+  803e5f:	0f 88 77 01 00 00    	js     803fdc <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803e65:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803e69:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  803e70:	00 00 00 
+  803e73:	ff d0                	call   *%rax
+  803e75:	89 c3                	mov    %eax,%ebx
+  803e77:	85 c0                	test   %eax,%eax
+  803e79:	0f 88 43 01 00 00    	js     803fc2 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803e7f:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803e84:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803e89:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803e8d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803e92:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803e99:	00 00 00 
+  803e9c:	ff d0                	call   *%rax
+  803e9e:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803ea0:	85 c0                	test   %eax,%eax
+  803ea2:	0f 88 1a 01 00 00    	js     803fc2 <pipe+0x1b0>
+    va = fd2data(fd0);
+  803ea8:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803eac:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803eb3:	00 00 00 
+  803eb6:	ff d0                	call   *%rax
+  803eb8:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803ebb:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803ec0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803ec5:	48 89 c6             	mov    %rax,%rsi
+  803ec8:	bf 00 00 00 00       	mov    $0x0,%edi
+  803ecd:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  803ed4:	00 00 00 
+  803ed7:	ff d0                	call   *%rax
+  803ed9:	89 c3                	mov    %eax,%ebx
+  803edb:	85 c0                	test   %eax,%eax
+  803edd:	0f 88 c5 00 00 00    	js     803fa8 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803ee3:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803ee7:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  803eee:	00 00 00 
+  803ef1:	ff d0                	call   *%rax
+  803ef3:	48 89 c1             	mov    %rax,%rcx
+  803ef6:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803efc:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803f02:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f07:	4c 89 ee             	mov    %r13,%rsi
+  803f0a:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f0f:	48 b8 59 14 80 00 00 	movabs $0x801459,%rax
+  803f16:	00 00 00 
+  803f19:	ff d0                	call   *%rax
+  803f1b:	89 c3                	mov    %eax,%ebx
+  803f1d:	85 c0                	test   %eax,%eax
+  803f1f:	78 6e                	js     803f8f <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803f21:	be 00 10 00 00       	mov    $0x1000,%esi
+  803f26:	4c 89 ef             	mov    %r13,%rdi
+  803f29:	48 b8 c8 13 80 00 00 	movabs $0x8013c8,%rax
+  803f30:	00 00 00 
+  803f33:	ff d0                	call   *%rax
+  803f35:	83 f8 02             	cmp    $0x2,%eax
+  803f38:	0f 85 ab 00 00 00    	jne    803fe9 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803f3e:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803f45:	00 00 
+  803f47:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f4b:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803f4d:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803f51:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803f58:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803f5c:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803f5e:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803f62:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803f69:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f6d:	48 bb 56 19 80 00 00 	movabs $0x801956,%rbx
+  803f74:	00 00 00 
+  803f77:	ff d3                	call   *%rbx
+  803f79:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803f7d:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803f81:	ff d3                	call   *%rbx
+  803f83:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803f88:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803f8d:	eb 4d                	jmp    803fdc <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803f8f:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803f94:	4c 89 ee             	mov    %r13,%rsi
+  803f97:	bf 00 00 00 00       	mov    $0x0,%edi
+  803f9c:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803fa3:	00 00 00 
+  803fa6:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803fa8:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fad:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803fb1:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fb6:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803fbd:	00 00 00 
+  803fc0:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803fc2:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803fc7:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803fcb:	bf 00 00 00 00       	mov    $0x0,%edi
+  803fd0:	48 b8 a9 14 80 00 00 	movabs $0x8014a9,%rax
+  803fd7:	00 00 00 
+  803fda:	ff d0                	call   *%rax
+}
+  803fdc:	89 d8                	mov    %ebx,%eax
+  803fde:	48 83 c4 18          	add    $0x18,%rsp
+  803fe2:	5b                   	pop    %rbx
+  803fe3:	41 5c                	pop    %r12
+  803fe5:	41 5d                	pop    %r13
+  803fe7:	5d                   	pop    %rbp
+  803fe8:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803fe9:	48 b9 48 52 80 00 00 	movabs $0x805248,%rcx
+  803ff0:	00 00 00 
+  803ff3:	48 ba 27 52 80 00 00 	movabs $0x805227,%rdx
+  803ffa:	00 00 00 
+  803ffd:	be 50 00 00 00       	mov    $0x50,%esi
+  804002:	48 bf 3c 52 80 00 00 	movabs $0x80523c,%rdi
+  804009:	00 00 00 
+  80400c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804011:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  804018:	00 00 00 
+  80401b:	41 ff d0             	call   *%r8
+
+000000000080401e <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  80401e:	55                   	push   %rbp
+  80401f:	48 89 e5             	mov    %rsp,%rbp
+  804022:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804026:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80402a:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  804031:	00 00 00 
+  804034:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804036:	85 c0                	test   %eax,%eax
+  804038:	78 23                	js     80405d <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  80403a:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80403e:	48 b8 68 19 80 00 00 	movabs $0x801968,%rax
+  804045:	00 00 00 
+  804048:	ff d0                	call   *%rax
+  80404a:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  80404d:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  804051:	48 b8 59 3b 80 00 00 	movabs $0x803b59,%rax
+  804058:	00 00 00 
+  80405b:	ff d0                	call   *%rax
+}
+  80405d:	c9                   	leave
+  80405e:	c3                   	ret
+
+000000000080405f <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80405f:	48 89 f8             	mov    %rdi,%rax
+  804062:	48 c1 e8 27          	shr    $0x27,%rax
+  804066:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  80406d:	01 00 00 
+  804070:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  804074:	f6 c2 01             	test   $0x1,%dl
+  804077:	74 6d                	je     8040e6 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  804079:	48 89 f8             	mov    %rdi,%rax
+  80407c:	48 c1 e8 1e          	shr    $0x1e,%rax
+  804080:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  804087:	01 00 00 
+  80408a:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  80408e:	f6 c2 01             	test   $0x1,%dl
+  804091:	74 62                	je     8040f5 <get_uvpt_entry+0x96>
+  804093:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80409a:	01 00 00 
+  80409d:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040a1:	f6 c2 80             	test   $0x80,%dl
+  8040a4:	75 4f                	jne    8040f5 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8040a6:	48 89 f8             	mov    %rdi,%rax
+  8040a9:	48 c1 e8 15          	shr    $0x15,%rax
+  8040ad:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040b4:	01 00 00 
+  8040b7:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040bb:	f6 c2 01             	test   $0x1,%dl
+  8040be:	74 44                	je     804104 <get_uvpt_entry+0xa5>
+  8040c0:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8040c7:	01 00 00 
+  8040ca:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  8040ce:	f6 c2 80             	test   $0x80,%dl
+  8040d1:	75 31                	jne    804104 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  8040d3:	48 c1 ef 0c          	shr    $0xc,%rdi
+  8040d7:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  8040de:	01 00 00 
+  8040e1:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  8040e5:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  8040e6:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  8040ed:	01 00 00 
+  8040f0:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8040f4:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  8040f5:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8040fc:	01 00 00 
+  8040ff:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804103:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  804104:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80410b:	01 00 00 
+  80410e:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  804112:	c3                   	ret
+
+0000000000804113 <get_prot>:
+
+int
+get_prot(void *va) {
+  804113:	55                   	push   %rbp
+  804114:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  804117:	48 b8 5f 40 80 00 00 	movabs $0x80405f,%rax
+  80411e:	00 00 00 
+  804121:	ff d0                	call   *%rax
+  804123:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  804126:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  80412b:	89 c1                	mov    %eax,%ecx
+  80412d:	83 c9 04             	or     $0x4,%ecx
+  804130:	f6 c2 01             	test   $0x1,%dl
+  804133:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  804136:	89 c1                	mov    %eax,%ecx
+  804138:	83 c9 02             	or     $0x2,%ecx
+  80413b:	f6 c2 02             	test   $0x2,%dl
+  80413e:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  804141:	89 c1                	mov    %eax,%ecx
+  804143:	83 c9 01             	or     $0x1,%ecx
+  804146:	48 85 d2             	test   %rdx,%rdx
+  804149:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  80414c:	89 c1                	mov    %eax,%ecx
+  80414e:	83 c9 40             	or     $0x40,%ecx
+  804151:	f6 c6 04             	test   $0x4,%dh
+  804154:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  804157:	5d                   	pop    %rbp
+  804158:	c3                   	ret
+
+0000000000804159 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  804159:	55                   	push   %rbp
+  80415a:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  80415d:	48 b8 5f 40 80 00 00 	movabs $0x80405f,%rax
+  804164:	00 00 00 
+  804167:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  804169:	48 c1 e8 06          	shr    $0x6,%rax
+  80416d:	83 e0 01             	and    $0x1,%eax
+}
+  804170:	5d                   	pop    %rbp
+  804171:	c3                   	ret
+
+0000000000804172 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  804172:	55                   	push   %rbp
+  804173:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  804176:	48 b8 5f 40 80 00 00 	movabs $0x80405f,%rax
+  80417d:	00 00 00 
+  804180:	ff d0                	call   *%rax
+  804182:	83 e0 01             	and    $0x1,%eax
+}
+  804185:	5d                   	pop    %rbp
+  804186:	c3                   	ret
+
+0000000000804187 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  804187:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  80418e:	01 00 00 
+  804191:	a8 01                	test   $0x1,%al
+  804193:	75 06                	jne    80419b <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  804195:	b8 00 00 00 00       	mov    $0x0,%eax
+  80419a:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  80419b:	55                   	push   %rbp
+  80419c:	48 89 e5             	mov    %rsp,%rbp
+  80419f:	41 57                	push   %r15
+  8041a1:	41 56                	push   %r14
+  8041a3:	41 55                	push   %r13
+  8041a5:	41 54                	push   %r12
+  8041a7:	53                   	push   %rbx
+  8041a8:	48 83 ec 28          	sub    $0x28,%rsp
+  8041ac:	49 89 fe             	mov    %rdi,%r14
+  8041af:	49 89 f7             	mov    %rsi,%r15
+  8041b2:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  8041b9:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041ba:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  8041c1:	01 00 00 
+  8041c4:	e9 ae 00 00 00       	jmp    804277 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  8041c9:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  8041d0:	49 83 ec 01          	sub    $0x1,%r12
+  8041d4:	74 2d                	je     804203 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  8041d6:	48 89 d8             	mov    %rbx,%rax
+  8041d9:	48 c1 e8 0c          	shr    $0xc,%rax
+  8041dd:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  8041e2:	f6 c2 01             	test   $0x1,%dl
+  8041e5:	74 e2                	je     8041c9 <foreach_shared_region+0x42>
+  8041e7:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  8041ec:	f6 c4 04             	test   $0x4,%ah
+  8041ef:	74 d8                	je     8041c9 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  8041f1:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  8041f8:	4c 89 fa             	mov    %r15,%rdx
+  8041fb:	48 89 df             	mov    %rbx,%rdi
+  8041fe:	41 ff d6             	call   *%r14
+  804201:	eb c6                	jmp    8041c9 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804203:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  80420a:	00 
+  80420b:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  804210:	74 4a                	je     80425c <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  804212:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804216:	48 c1 e8 15          	shr    $0x15,%rax
+  80421a:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  804221:	01 00 00 
+  804224:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804228:	a8 01                	test   $0x1,%al
+  80422a:	74 d7                	je     804203 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  80422c:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  804230:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  804237:	48 39 c3             	cmp    %rax,%rbx
+  80423a:	73 c7                	jae    804203 <foreach_shared_region+0x7c>
+  80423c:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  804243:	48 39 d0             	cmp    %rdx,%rax
+  804246:	4d 19 e4             	sbb    %r12,%r12
+  804249:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  804250:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  804257:	e9 7a ff ff ff       	jmp    8041d6 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  80425c:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  804263:	40 
+  804264:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804268:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80426f:	00 00 00 
+  804272:	48 39 c1             	cmp    %rax,%rcx
+  804275:	74 50                	je     8042c7 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804277:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80427b:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80427f:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804286:	01 00 00 
+  804289:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  80428d:	a8 01                	test   $0x1,%al
+  80428f:	74 cb                	je     80425c <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  804291:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804295:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  80429c:	48 39 c1             	cmp    %rax,%rcx
+  80429f:	73 bb                	jae    80425c <foreach_shared_region+0xd5>
+  8042a1:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  8042a8:	48 39 d0             	cmp    %rdx,%rax
+  8042ab:	48 19 c0             	sbb    %rax,%rax
+  8042ae:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  8042b4:	48 05 00 02 00 00    	add    $0x200,%rax
+  8042ba:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8042be:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8042c2:	e9 4b ff ff ff       	jmp    804212 <foreach_shared_region+0x8b>
+  8042c7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8042cc:	48 83 c4 28          	add    $0x28,%rsp
+  8042d0:	5b                   	pop    %rbx
+  8042d1:	41 5c                	pop    %r12
+  8042d3:	41 5d                	pop    %r13
+  8042d5:	41 5e                	pop    %r14
+  8042d7:	41 5f                	pop    %r15
+  8042d9:	5d                   	pop    %rbp
+  8042da:	c3                   	ret
+
+00000000008042db <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  8042db:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  8042e1:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  8042e8:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  8042ef:	c3                   	ret
+
+00000000008042f0 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  8042f0:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042f3:	8b 17                	mov    (%rdi),%edx
+  8042f5:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  8042f7:	83 f8 0f             	cmp    $0xf,%eax
+  8042fa:	77 13                	ja     80430f <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  8042fc:	8b 47 40             	mov    0x40(%rdi),%eax
+  8042ff:	83 e0 0f             	and    $0xf,%eax
+  804302:	48 c1 e0 09          	shl    $0x9,%rax
+  804306:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  80430d:	00 
+  80430e:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80430f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804314:	c3                   	ret
+
+0000000000804315 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  804315:	8b 47 40             	mov    0x40(%rdi),%eax
+  804318:	83 c0 01             	add    $0x1,%eax
+  80431b:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80431e:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804324:	8b 57 04             	mov    0x4(%rdi),%edx
+  804327:	b8 00 00 00 00       	mov    $0x0,%eax
+  80432c:	85 d2                	test   %edx,%edx
+  80432e:	75 04                	jne    804334 <chan_publish+0x1f>
+  804330:	83 e0 01             	and    $0x1,%eax
+}
+  804333:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  804334:	87 47 04             	xchg   %eax,0x4(%rdi)
+  804337:	85 c0                	test   %eax,%eax
+  804339:	0f 95 c0             	setne  %al
+  80433c:	0f b6 c0             	movzbl %al,%eax
+  80433f:	eb ef                	jmp    804330 <chan_publish+0x1b>
+
+0000000000804341 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  804341:	8b 47 40             	mov    0x40(%rdi),%eax
+  804344:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804346:	29 d0                	sub    %edx,%eax
+  804348:	83 e8 01             	sub    $0x1,%eax
+  80434b:	83 f8 0f             	cmp    $0xf,%eax
+  80434e:	77 12                	ja     804362 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  804350:	8b 07                	mov    (%rdi),%eax
+  804352:	83 e0 0f             	and    $0xf,%eax
+  804355:	48 c1 e0 09          	shl    $0x9,%rax
+  804359:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804360:	00 
+  804361:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  804362:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804367:	c3                   	ret
+
+0000000000804368 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  804368:	8b 07                	mov    (%rdi),%eax
+  80436a:	83 c0 01             	add    $0x1,%eax
+  80436d:	89 07                	mov    %eax,(%rdi)
+}
+  80436f:	c3                   	ret
+
+0000000000804370 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  804370:	55                   	push   %rbp
+  804371:	48 89 e5             	mov    %rsp,%rbp
+  804374:	53                   	push   %rbx
+  804375:	48 83 ec 08          	sub    $0x8,%rsp
+  804379:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  80437c:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  804383:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804389:	48 b8 41 43 80 00 00 	movabs $0x804341,%rax
+  804390:	00 00 00 
+  804393:	ff d0                	call   *%rax
+  804395:	48 85 c0             	test   %rax,%rax
+  804398:	74 12                	je     8043ac <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  80439a:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  8043a1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8043a6:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8043aa:	c9                   	leave
+  8043ab:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  8043ac:	b8 01 00 00 00       	mov    $0x1,%eax
+  8043b1:	eb f3                	jmp    8043a6 <chan_arm+0x36>
+
+00000000008043b3 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  8043b3:	55                   	push   %rbp
+  8043b4:	48 89 e5             	mov    %rsp,%rbp
+  8043b7:	41 56                	push   %r14
+  8043b9:	41 55                	push   %r13
+  8043bb:	41 54                	push   %r12
+  8043bd:	53                   	push   %rbx
+  8043be:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  8043c1:	49 bc 70 43 80 00 00 	movabs $0x804370,%r12
+  8043c8:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043cb:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  8043cf:	49 bd 71 17 80 00 00 	movabs $0x801771,%r13
+  8043d6:	00 00 00 
+    while (chan_arm(r))
+  8043d9:	eb 0d                	jmp    8043e8 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  8043db:	8b 33                	mov    (%rbx),%esi
+  8043dd:	ba 00 00 00 00       	mov    $0x0,%edx
+  8043e2:	4c 89 f7             	mov    %r14,%rdi
+  8043e5:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  8043e8:	48 89 df             	mov    %rbx,%rdi
+  8043eb:	41 ff d4             	call   *%r12
+  8043ee:	84 c0                	test   %al,%al
+  8043f0:	75 e9                	jne    8043db <chan_wait+0x28>
+}
+  8043f2:	5b                   	pop    %rbx
+  8043f3:	41 5c                	pop    %r12
+  8043f5:	41 5d                	pop    %r13
+  8043f7:	41 5e                	pop    %r14
+  8043f9:	5d                   	pop    %rbp
+  8043fa:	c3                   	ret
+
+00000000008043fb <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  8043fb:	55                   	push   %rbp
+  8043fc:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  8043ff:	48 83 c7 40          	add    $0x40,%rdi
+  804403:	be 01 00 00 00       	mov    $0x1,%esi
+  804408:	48 b8 8f 17 80 00 00 	movabs $0x80178f,%rax
+  80440f:	00 00 00 
+  804412:	ff d0                	call   *%rax
+}
+  804414:	5d                   	pop    %rbp
+  804415:	c3                   	ret
+
+0000000000804416 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  804416:	b8 00 00 00 00       	mov    $0x0,%eax
+  80441b:	c3                   	ret
+
+000000000080441c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80441c:	55                   	push   %rbp
+  80441d:	48 89 e5             	mov    %rsp,%rbp
+  804420:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  804423:	48 be 6c 52 80 00 00 	movabs $0x80526c,%rsi
+  80442a:	00 00 00 
+  80442d:	48 b8 a4 0e 80 00 00 	movabs $0x800ea4,%rax
+  804434:	00 00 00 
+  804437:	ff d0                	call   *%rax
+    return 0;
+}
+  804439:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443e:	5d                   	pop    %rbp
+  80443f:	c3                   	ret
+
+0000000000804440 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  804440:	55                   	push   %rbp
+  804441:	48 89 e5             	mov    %rsp,%rbp
+  804444:	41 57                	push   %r15
+  804446:	41 56                	push   %r14
+  804448:	41 55                	push   %r13
+  80444a:	41 54                	push   %r12
+  80444c:	53                   	push   %rbx
+  80444d:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  804454:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  80445b:	48 85 d2             	test   %rdx,%rdx
+  80445e:	74 7a                	je     8044da <devcons_write+0x9a>
+  804460:	49 89 d6             	mov    %rdx,%r14
+  804463:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  804469:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  80446e:	49 bf 9e 10 80 00 00 	movabs $0x80109e,%r15
+  804475:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804478:	4c 89 f3             	mov    %r14,%rbx
+  80447b:	48 29 f3             	sub    %rsi,%rbx
+  80447e:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  804483:	48 39 c3             	cmp    %rax,%rbx
+  804486:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  80448a:	4c 63 eb             	movslq %ebx,%r13
+  80448d:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804494:	48 01 c6             	add    %rax,%rsi
+  804497:	4c 89 ea             	mov    %r13,%rdx
+  80449a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044a1:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  8044a4:	4c 89 ee             	mov    %r13,%rsi
+  8044a7:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  8044ae:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  8044b5:	00 00 00 
+  8044b8:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  8044ba:	41 01 dc             	add    %ebx,%r12d
+  8044bd:	49 63 f4             	movslq %r12d,%rsi
+  8044c0:	4c 39 f6             	cmp    %r14,%rsi
+  8044c3:	72 b3                	jb     804478 <devcons_write+0x38>
+    return res;
+  8044c5:	49 63 c4             	movslq %r12d,%rax
+}
+  8044c8:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  8044cf:	5b                   	pop    %rbx
+  8044d0:	41 5c                	pop    %r12
+  8044d2:	41 5d                	pop    %r13
+  8044d4:	41 5e                	pop    %r14
+  8044d6:	41 5f                	pop    %r15
+  8044d8:	5d                   	pop    %rbp
+  8044d9:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  8044da:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8044e0:	eb e3                	jmp    8044c5 <devcons_write+0x85>
+
+00000000008044e2 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044e2:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  8044e5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8044ea:	48 85 c0             	test   %rax,%rax
+  8044ed:	74 55                	je     804544 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  8044ef:	55                   	push   %rbp
+  8044f0:	48 89 e5             	mov    %rsp,%rbp
+  8044f3:	41 55                	push   %r13
+  8044f5:	41 54                	push   %r12
+  8044f7:	53                   	push   %rbx
+  8044f8:	48 83 ec 08          	sub    $0x8,%rsp
+  8044fc:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  8044ff:	48 bb ea 12 80 00 00 	movabs $0x8012ea,%rbx
+  804506:	00 00 00 
+  804509:	49 bc 9f 13 80 00 00 	movabs $0x80139f,%r12
+  804510:	00 00 00 
+  804513:	eb 03                	jmp    804518 <devcons_read+0x36>
+  804515:	41 ff d4             	call   *%r12
+  804518:	ff d3                	call   *%rbx
+  80451a:	85 c0                	test   %eax,%eax
+  80451c:	74 f7                	je     804515 <devcons_read+0x33>
+    if (c < 0) return c;
+  80451e:	48 63 d0             	movslq %eax,%rdx
+  804521:	78 13                	js     804536 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  804523:	ba 00 00 00 00       	mov    $0x0,%edx
+  804528:	83 f8 04             	cmp    $0x4,%eax
+  80452b:	74 09                	je     804536 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80452d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  804531:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  804536:	48 89 d0             	mov    %rdx,%rax
+  804539:	48 83 c4 08          	add    $0x8,%rsp
+  80453d:	5b                   	pop    %rbx
+  80453e:	41 5c                	pop    %r12
+  804540:	41 5d                	pop    %r13
+  804542:	5d                   	pop    %rbp
+  804543:	c3                   	ret
+  804544:	48 89 d0             	mov    %rdx,%rax
+  804547:	c3                   	ret
+
+0000000000804548 <cputchar>:
+cputchar(int ch) {
+  804548:	55                   	push   %rbp
+  804549:	48 89 e5             	mov    %rsp,%rbp
+  80454c:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  804550:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  804554:	be 01 00 00 00       	mov    $0x1,%esi
+  804559:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  80455d:	48 b8 cb 12 80 00 00 	movabs $0x8012cb,%rax
+  804564:	00 00 00 
+  804567:	ff d0                	call   *%rax
+}
+  804569:	c9                   	leave
+  80456a:	c3                   	ret
+
+000000000080456b <getchar>:
+getchar(void) {
+  80456b:	55                   	push   %rbp
+  80456c:	48 89 e5             	mov    %rsp,%rbp
+  80456f:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  804573:	ba 01 00 00 00       	mov    $0x1,%edx
+  804578:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  80457c:	bf 00 00 00 00       	mov    $0x0,%edi
+  804581:	48 b8 c7 1c 80 00 00 	movabs $0x801cc7,%rax
+  804588:	00 00 00 
+  80458b:	ff d0                	call   *%rax
+  80458d:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80458f:	85 c0                	test   %eax,%eax
+  804591:	78 06                	js     804599 <getchar+0x2e>
+  804593:	74 08                	je     80459d <getchar+0x32>
+  804595:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804599:	89 d0                	mov    %edx,%eax
+  80459b:	c9                   	leave
+  80459c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  80459d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  8045a2:	eb f5                	jmp    804599 <getchar+0x2e>
+
+00000000008045a4 <iscons>:
+iscons(int fdnum) {
+  8045a4:	55                   	push   %rbp
+  8045a5:	48 89 e5             	mov    %rsp,%rbp
+  8045a8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8045ac:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8045b0:	48 b8 e4 19 80 00 00 	movabs $0x8019e4,%rax
+  8045b7:	00 00 00 
+  8045ba:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8045bc:	85 c0                	test   %eax,%eax
+  8045be:	78 18                	js     8045d8 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  8045c0:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8045c4:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  8045cb:	00 00 00 
+  8045ce:	8b 00                	mov    (%rax),%eax
+  8045d0:	39 02                	cmp    %eax,(%rdx)
+  8045d2:	0f 94 c0             	sete   %al
+  8045d5:	0f b6 c0             	movzbl %al,%eax
+}
+  8045d8:	c9                   	leave
+  8045d9:	c3                   	ret
+
+00000000008045da <opencons>:
+opencons(void) {
+  8045da:	55                   	push   %rbp
+  8045db:	48 89 e5             	mov    %rsp,%rbp
+  8045de:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  8045e2:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  8045e6:	48 b8 84 19 80 00 00 	movabs $0x801984,%rax
+  8045ed:	00 00 00 
+  8045f0:	ff d0                	call   *%rax
+  8045f2:	85 c0                	test   %eax,%eax
+  8045f4:	78 49                	js     80463f <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  8045f6:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8045fb:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804600:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804604:	bf 00 00 00 00       	mov    $0x0,%edi
+  804609:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  804610:	00 00 00 
+  804613:	ff d0                	call   *%rax
+  804615:	85 c0                	test   %eax,%eax
+  804617:	78 26                	js     80463f <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  804619:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80461d:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  804624:	00 00 
+  804626:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  804628:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  80462c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  804633:	48 b8 56 19 80 00 00 	movabs $0x801956,%rax
+  80463a:	00 00 00 
+  80463d:	ff d0                	call   *%rax
+}
+  80463f:	c9                   	leave
+  804640:	c3                   	ret
+
+0000000000804641 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804641:	55                   	push   %rbp
+  804642:	48 89 e5             	mov    %rsp,%rbp
+  804645:	41 56                	push   %r14
+  804647:	41 55                	push   %r13
+  804649:	41 54                	push   %r12
+  80464b:	53                   	push   %rbx
+  80464c:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80464f:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804656:	00 00 00 
+  804659:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80465d:	74 27                	je     804686 <_handle_vectored_pagefault+0x45>
+  80465f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804664:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80466b:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80466e:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  804671:	4c 89 e7             	mov    %r12,%rdi
+  804674:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  804679:	84 c0                	test   %al,%al
+  80467b:	75 45                	jne    8046c2 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80467d:	48 83 c3 01          	add    $0x1,%rbx
+  804681:	49 3b 1e             	cmp    (%r14),%rbx
+  804684:	72 eb                	jb     804671 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  804686:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  80468d:	00 
+  80468e:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  804693:	4d 8b 04 24          	mov    (%r12),%r8
+  804697:	48 ba 78 52 80 00 00 	movabs $0x805278,%rdx
+  80469e:	00 00 00 
+  8046a1:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8046a6:	48 bf a8 52 80 00 00 	movabs $0x8052a8,%rdi
+  8046ad:	00 00 00 
+  8046b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b5:	49 ba 2f 04 80 00 00 	movabs $0x80042f,%r10
+  8046bc:	00 00 00 
+  8046bf:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8046c2:	5b                   	pop    %rbx
+  8046c3:	41 5c                	pop    %r12
+  8046c5:	41 5d                	pop    %r13
+  8046c7:	41 5e                	pop    %r14
+  8046c9:	5d                   	pop    %rbp
+  8046ca:	c3                   	ret
+
+00000000008046cb <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8046cb:	55                   	push   %rbp
+  8046cc:	48 89 e5             	mov    %rsp,%rbp
+  8046cf:	53                   	push   %rbx
+  8046d0:	48 83 ec 08          	sub    $0x8,%rsp
+  8046d4:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  8046d7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8046de:	00 00 00 
+  8046e1:	80 38 00             	cmpb   $0x0,(%rax)
+  8046e4:	0f 84 84 00 00 00    	je     80476e <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8046ea:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046f1:	00 00 00 
+  8046f4:	48 8b 10             	mov    (%rax),%rdx
+  8046f7:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  8046fc:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804703:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804706:	48 85 d2             	test   %rdx,%rdx
+  804709:	74 19                	je     804724 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80470b:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80470f:	0f 84 e8 00 00 00    	je     8047fd <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804715:	48 83 c0 01          	add    $0x1,%rax
+  804719:	48 39 d0             	cmp    %rdx,%rax
+  80471c:	75 ed                	jne    80470b <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80471e:	48 83 fa 08          	cmp    $0x8,%rdx
+  804722:	74 1c                	je     804740 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804724:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804728:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80472f:	00 00 00 
+  804732:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804739:	00 00 00 
+  80473c:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  804740:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  804747:	00 00 00 
+  80474a:	ff d0                	call   *%rax
+  80474c:	89 c7                	mov    %eax,%edi
+  80474e:	48 be c3 48 80 00 00 	movabs $0x8048c3,%rsi
+  804755:	00 00 00 
+  804758:	48 b8 c1 15 80 00 00 	movabs $0x8015c1,%rax
+  80475f:	00 00 00 
+  804762:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804764:	85 c0                	test   %eax,%eax
+  804766:	78 68                	js     8047d0 <add_pgfault_handler+0x105>
+    return res;
+}
+  804768:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80476c:	c9                   	leave
+  80476d:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80476e:	48 b8 76 13 80 00 00 	movabs $0x801376,%rax
+  804775:	00 00 00 
+  804778:	ff d0                	call   *%rax
+  80477a:	89 c7                	mov    %eax,%edi
+  80477c:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804781:	ba 00 10 00 00       	mov    $0x1000,%edx
+  804786:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  80478d:	00 00 00 
+  804790:	48 b8 03 14 80 00 00 	movabs $0x801403,%rax
+  804797:	00 00 00 
+  80479a:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80479c:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8047a3:	00 00 00 
+  8047a6:	48 8b 02             	mov    (%rdx),%rax
+  8047a9:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8047ad:	48 89 0a             	mov    %rcx,(%rdx)
+  8047b0:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8047b7:	00 00 00 
+  8047ba:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8047be:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8047c5:	00 00 00 
+  8047c8:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8047cb:	e9 70 ff ff ff       	jmp    804740 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8047d0:	89 c1                	mov    %eax,%ecx
+  8047d2:	48 ba b6 52 80 00 00 	movabs $0x8052b6,%rdx
+  8047d9:	00 00 00 
+  8047dc:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8047e1:	48 bf a8 52 80 00 00 	movabs $0x8052a8,%rdi
+  8047e8:	00 00 00 
+  8047eb:	b8 00 00 00 00       	mov    $0x0,%eax
+  8047f0:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  8047f7:	00 00 00 
+  8047fa:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  8047fd:	b8 00 00 00 00       	mov    $0x0,%eax
+  804802:	e9 61 ff ff ff       	jmp    804768 <add_pgfault_handler+0x9d>
+
+0000000000804807 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804807:	55                   	push   %rbp
+  804808:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80480b:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804812:	00 00 00 
+  804815:	80 38 00             	cmpb   $0x0,(%rax)
+  804818:	74 33                	je     80484d <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80481a:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804821:	00 00 00 
+  804824:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804829:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  804830:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804833:	48 85 c0             	test   %rax,%rax
+  804836:	0f 84 85 00 00 00    	je     8048c1 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80483c:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  804840:	74 40                	je     804882 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804842:	48 83 c1 01          	add    $0x1,%rcx
+  804846:	48 39 c1             	cmp    %rax,%rcx
+  804849:	75 f1                	jne    80483c <remove_pgfault_handler+0x35>
+  80484b:	eb 74                	jmp    8048c1 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80484d:	48 b9 ce 52 80 00 00 	movabs $0x8052ce,%rcx
+  804854:	00 00 00 
+  804857:	48 ba 27 52 80 00 00 	movabs $0x805227,%rdx
+  80485e:	00 00 00 
+  804861:	be 43 00 00 00       	mov    $0x43,%esi
+  804866:	48 bf a8 52 80 00 00 	movabs $0x8052a8,%rdi
+  80486d:	00 00 00 
+  804870:	b8 00 00 00 00       	mov    $0x0,%eax
+  804875:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  80487c:	00 00 00 
+  80487f:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  804882:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  804889:	00 
+  80488a:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  80488e:	48 29 ca             	sub    %rcx,%rdx
+  804891:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804898:	00 00 00 
+  80489b:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  80489f:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8048a4:	48 89 ce             	mov    %rcx,%rsi
+  8048a7:	48 b8 9e 10 80 00 00 	movabs $0x80109e,%rax
+  8048ae:	00 00 00 
+  8048b1:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8048b3:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8048ba:	00 00 00 
+  8048bd:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8048c1:	5d                   	pop    %rbp
+  8048c2:	c3                   	ret
+
+00000000008048c3 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8048c3:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8048c6:	48 b8 41 46 80 00 00 	movabs $0x804641,%rax
+  8048cd:	00 00 00 
+    call *%rax
+  8048d0:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8048d2:	41 5f                	pop    %r15
+	popq %r15
+  8048d4:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8048d6:	41 5f                	pop    %r15
+	popq %r14
+  8048d8:	41 5e                	pop    %r14
+	popq %r13
+  8048da:	41 5d                	pop    %r13
+	popq %r12
+  8048dc:	41 5c                	pop    %r12
+	popq %r11
+  8048de:	41 5b                	pop    %r11
+	popq %r10
+  8048e0:	41 5a                	pop    %r10
+	popq %r9
+  8048e2:	41 59                	pop    %r9
+	popq %r8
+  8048e4:	41 58                	pop    %r8
+	popq %rsi
+  8048e6:	5e                   	pop    %rsi
+	popq %rdi
+  8048e7:	5f                   	pop    %rdi
+	popq %rbp
+  8048e8:	5d                   	pop    %rbp
+	popq %rdx
+  8048e9:	5a                   	pop    %rdx
+	popq %rcx
+  8048ea:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8048eb:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8048f0:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8048f5:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  8048f9:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  8048fc:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804901:	5b                   	pop    %rbx
+	popq %rax
+  804902:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804903:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804907:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804908:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80490d:	c3                   	ret
+
+000000000080490e <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80490e:	55                   	push   %rbp
+  80490f:	48 89 e5             	mov    %rsp,%rbp
+  804912:	41 55                	push   %r13
+  804914:	41 54                	push   %r12
+  804916:	53                   	push   %rbx
+  804917:	48 83 ec 08          	sub    $0x8,%rsp
+  80491b:	49 89 fd             	mov    %rdi,%r13
+  80491e:	48 89 f7             	mov    %rsi,%rdi
+  804921:	48 89 d3             	mov    %rdx,%rbx
+  804924:	49 89 cc             	mov    %rcx,%r12
+  804927:	4c 89 c2             	mov    %r8,%rdx
+  80492a:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80492d:	48 85 f6             	test   %rsi,%rsi
+  804930:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804937:	00 00 00 
+  80493a:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80493e:	be 00 10 00 00       	mov    $0x1000,%esi
+  804943:	48 85 db             	test   %rbx,%rbx
+  804946:	74 03                	je     80494b <ipc_recv_futex+0x3d>
+  804948:	48 8b 33             	mov    (%rbx),%rsi
+  80494b:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80494f:	48 b8 4d 16 80 00 00 	movabs $0x80164d,%rax
+  804956:	00 00 00 
+  804959:	ff d0                	call   *%rax
+    if (res < 0) {
+  80495b:	85 c0                	test   %eax,%eax
+  80495d:	78 75                	js     8049d4 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80495f:	4d 85 ed             	test   %r13,%r13
+  804962:	74 14                	je     804978 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804964:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80496b:	00 00 00 
+  80496e:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  804974:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  804978:	4d 85 e4             	test   %r12,%r12
+  80497b:	74 14                	je     804991 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  80497d:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  804984:	00 00 00 
+  804987:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  80498d:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  804991:	48 85 db             	test   %rbx,%rbx
+  804994:	74 23                	je     8049b9 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  804996:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  80499d:	00 00 00 
+  8049a0:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8049a6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8049ab:	85 c9                	test   %ecx,%ecx
+  8049ad:	74 07                	je     8049b6 <ipc_recv_futex+0xa8>
+  8049af:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8049b6:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8049b9:	48 a1 00 00 81 00 00 	movabs 0x810000,%rax
+  8049c0:	00 00 00 
+  8049c3:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8049c9:	48 83 c4 08          	add    $0x8,%rsp
+  8049cd:	5b                   	pop    %rbx
+  8049ce:	41 5c                	pop    %r12
+  8049d0:	41 5d                	pop    %r13
+  8049d2:	5d                   	pop    %rbp
+  8049d3:	c3                   	ret
+        if (from_env_store != NULL) {
+  8049d4:	4d 85 ed             	test   %r13,%r13
+  8049d7:	74 08                	je     8049e1 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8049d9:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8049e0:	00 
+        if (perm_store != NULL) {
+  8049e1:	4d 85 e4             	test   %r12,%r12
+  8049e4:	74 08                	je     8049ee <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8049e6:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8049ed:	00 
+        if (size != NULL) {
+  8049ee:	48 85 db             	test   %rbx,%rbx
+  8049f1:	74 d6                	je     8049c9 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8049f3:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  8049fa:	eb cd                	jmp    8049c9 <ipc_recv_futex+0xbb>
+
+00000000008049fc <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  8049fc:	55                   	push   %rbp
+  8049fd:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  804a00:	48 83 ec 08          	sub    $0x8,%rsp
+  804a04:	6a 00                	push   $0x0
+  804a06:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  804a0c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804a12:	48 b8 0e 49 80 00 00 	movabs $0x80490e,%rax
+  804a19:	00 00 00 
+  804a1c:	ff d0                	call   *%rax
+}
+  804a1e:	c9                   	leave
+  804a1f:	c3                   	ret
+
+0000000000804a20 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  804a20:	55                   	push   %rbp
+  804a21:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804a24:	48 85 d2             	test   %rdx,%rdx
+  804a27:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804a2e:	00 00 00 
+  804a31:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804a35:	89 f6                	mov    %esi,%esi
+  804a37:	48 b8 36 16 80 00 00 	movabs $0x801636,%rax
+  804a3e:	00 00 00 
+  804a41:	ff d0                	call   *%rax
+    if (res < 0) {
+  804a43:	85 c0                	test   %eax,%eax
+  804a45:	78 02                	js     804a49 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804a47:	5d                   	pop    %rbp
+  804a48:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804a49:	89 c1                	mov    %eax,%ecx
+  804a4b:	48 ba e8 52 80 00 00 	movabs $0x8052e8,%rdx
+  804a52:	00 00 00 
+  804a55:	be 50 00 00 00       	mov    $0x50,%esi
+  804a5a:	48 bf fc 52 80 00 00 	movabs $0x8052fc,%rdi
+  804a61:	00 00 00 
+  804a64:	b8 00 00 00 00       	mov    $0x0,%eax
+  804a69:	49 b8 2f 04 80 00 00 	movabs $0x80042f,%r8
+  804a70:	00 00 00 
+  804a73:	41 ff d0             	call   *%r8
+
+0000000000804a76 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  804a76:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  804a7b:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  804a82:	00 00 00 
+  804a85:	48 89 d0             	mov    %rdx,%rax
+  804a88:	48 c1 e0 04          	shl    $0x4,%rax
+  804a8c:	48 29 d0             	sub    %rdx,%rax
+  804a8f:	48 c1 e0 05          	shl    $0x5,%rax
+  804a93:	48 01 c8             	add    %rcx,%rax
+  804a96:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  804a9c:	39 f8                	cmp    %edi,%eax
+  804a9e:	74 13                	je     804ab3 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  804aa0:	48 83 c2 01          	add    $0x1,%rdx
+  804aa4:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  804aab:	75 d8                	jne    804a85 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  804aad:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804ab2:	c3                   	ret
+            return envs[i].env_id;
+  804ab3:	48 89 d0             	mov    %rdx,%rax
+  804ab6:	48 c1 e0 04          	shl    $0x4,%rax
+  804aba:	48 29 d0             	sub    %rdx,%rax
+  804abd:	48 c1 e0 05          	shl    $0x5,%rax
+  804ac1:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  804ac8:	00 00 00 
+  804acb:	48 01 d0             	add    %rdx,%rax
+  804ace:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804ad4:	c3                   	ret
+  804ad5:	0f 1f 00             	nopl   (%rax)
+
+0000000000804ad8 <__rodata_start>:
+  804ad8:	70 72                	jo     804b4c <__rodata_start+0x74>
+  804ada:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  804ae1:	20 63 6f             	and    %ah,0x6f(%rbx)
+  804ae4:	75 6c                	jne    804b52 <__rodata_start+0x7a>
+  804ae6:	64 20 6e 6f          	and    %ch,%fs:0x6f(%rsi)
+  804aea:	74 20                	je     804b0c <__rodata_start+0x34>
+  804aec:	72 65                	jb     804b53 <__rodata_start+0x7b>
+  804aee:	61                   	(bad)
+  804aef:	64 20 69 6e          	and    %ch,%fs:0x6e(%rcx)
+  804af3:	69 74 69 61 6c 20 70 	imul   $0x7270206c,0x61(%rcx,%rbp,2),%esi
+  804afa:	72 
+  804afb:	69 6d 65 3a 20 25 64 	imul   $0x6425203a,0x65(%rbp),%ebp
+  804b02:	2c 20                	sub    $0x20,%al
+  804b04:	25 69 00 75 73       	and    $0x73750069,%eax
+  804b09:	65 72 2f             	gs jb  804b3b <__rodata_start+0x63>
+  804b0c:	70 72                	jo     804b80 <__rodata_start+0xa8>
+  804b0e:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  804b15:	65 2e 63 00          	gs movsxd %gs:(%rax),%eax
+  804b19:	25 64 0a 00 70       	and    $0x70000a64,%eax
+  804b1e:	69 70 65 3a 20 25 69 	imul   $0x6925203a,0x65(%rax),%esi
+  804b25:	00 66 6f             	add    %ah,0x6f(%rsi)
+  804b28:	72 6b                	jb     804b95 <__rodata_start+0xbd>
+  804b2a:	3a 20                	cmp    (%rax),%ah
+  804b2c:	25 69 00 70 72       	and    $0x72700069,%eax
+  804b31:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  804b38:	20 25 64 20 72 65    	and    %ah,0x65722064(%rip)        # 65f26ba2 <__bss_end+0x656e4ba2>
+  804b3e:	61                   	(bad)
+  804b3f:	64 6e                	outsb  %fs:(%rsi),(%dx)
+  804b41:	20 25 64 20 25 64    	and    %ah,0x64252064(%rip)        # 64a56bab <__bss_end+0x64214bab>
+  804b47:	20 25 69 00 70 72    	and    %ah,0x72700069(%rip)        # 72f04bb6 <__bss_end+0x726c2bb6>
+  804b4d:	69 6d 65 70 72 6f 63 	imul   $0x636f7270,0x65(%rbp),%ebp
+  804b54:	20 25 64 20 77 72    	and    %ah,0x72772064(%rip)        # 72f76bbe <__bss_end+0x72734bbe>
+  804b5a:	69 74 65 3a 20 25 64 	imul   $0x20642520,0x3a(%rbp,%riz,2),%esi
+  804b61:	20 
+  804b62:	25 69 00 70 72       	and    $0x72700069,%eax
+  804b67:	69 6d 65 73 70 69 70 	imul   $0x70697073,0x65(%rbp),%ebp
+  804b6e:	65 00 67 65          	add    %ah,%gs:0x65(%rdi)
+  804b72:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b73:	65 72 61             	gs jb  804bd7 <__rodata_start+0xff>
+  804b76:	74 6f                	je     804be7 <__rodata_start+0x10f>
+  804b78:	72 20                	jb     804b9a <__rodata_start+0xc2>
+  804b7a:	77 72                	ja     804bee <__rodata_start+0x116>
+  804b7c:	69 74 65 3a 20 25 64 	imul   $0x2c642520,0x3a(%rbp,%riz,2),%esi
+  804b83:	2c 
+  804b84:	20 25 69 00 3c 75    	and    %ah,0x753c0069(%rip)        # 75bc4bf3 <__bss_end+0x75382bf3>
+  804b8a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b8b:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804b8f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804b90:	3e 00 66 0f          	ds add %ah,0xf(%rsi)
+  804b94:	1f                   	(bad)
+  804b95:	44 00 00             	add    %r8b,(%rax)
+  804b98:	5b                   	pop    %rbx
+  804b99:	25 30 38 78 5d       	and    $0x5d783830,%eax
+  804b9e:	20 75 73             	and    %dh,0x73(%rbp)
+  804ba1:	65 72 20             	gs jb  804bc4 <__rodata_start+0xec>
+  804ba4:	70 61                	jo     804c07 <__rodata_start+0x12f>
+  804ba6:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ba7:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  804bae:	73 20                	jae    804bd0 <__rodata_start+0xf8>
+  804bb0:	61                   	(bad)
+  804bb1:	74 20                	je     804bd3 <__rodata_start+0xfb>
+  804bb3:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  804bb8:	3a 20                	cmp    (%rax),%ah
+  804bba:	00 30                	add    %dh,(%rax)
+  804bbc:	31 32                	xor    %esi,(%rdx)
+  804bbe:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804bc5:	41                   	rex.B
+  804bc6:	42                   	rex.X
+  804bc7:	43                   	rex.XB
+  804bc8:	44                   	rex.R
+  804bc9:	45                   	rex.RB
+  804bca:	46 00 30             	rex.RX add %r14b,(%rax)
+  804bcd:	31 32                	xor    %esi,(%rdx)
+  804bcf:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804bd6:	61                   	(bad)
+  804bd7:	62 63 64 65 66       	(bad)
+  804bdc:	00 28                	add    %ch,(%rax)
+  804bde:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804bdf:	75 6c                	jne    804c4d <__rodata_start+0x175>
+  804be1:	6c                   	insb   (%dx),%es:(%rdi)
+  804be2:	29 00                	sub    %eax,(%rax)
+  804be4:	65 72 72             	gs jb  804c59 <__rodata_start+0x181>
+  804be7:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804be8:	72 20                	jb     804c0a <__rodata_start+0x132>
+  804bea:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  804bef:	73 70                	jae    804c61 <__rodata_start+0x189>
+  804bf1:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804bf5:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  804bfc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804bfd:	72 00                	jb     804bff <__rodata_start+0x127>
+  804bff:	62 61 64 20 65       	(bad)
+  804c04:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c05:	76 69                	jbe    804c70 <__rodata_start+0x198>
+  804c07:	72 6f                	jb     804c78 <__rodata_start+0x1a0>
+  804c09:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c0a:	6d                   	insl   (%dx),%es:(%rdi)
+  804c0b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c0d:	74 00                	je     804c0f <__rodata_start+0x137>
+  804c0f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c16:	20 70 61             	and    %dh,0x61(%rax)
+  804c19:	72 61                	jb     804c7c <__rodata_start+0x1a4>
+  804c1b:	6d                   	insl   (%dx),%es:(%rdi)
+  804c1c:	65 74 65             	gs je  804c84 <__rodata_start+0x1ac>
+  804c1f:	72 00                	jb     804c21 <__rodata_start+0x149>
+  804c21:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c22:	75 74                	jne    804c98 <__rodata_start+0x1c0>
+  804c24:	20 6f 66             	and    %ch,0x66(%rdi)
+  804c27:	20 6d 65             	and    %ch,0x65(%rbp)
+  804c2a:	6d                   	insl   (%dx),%es:(%rdi)
+  804c2b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c2c:	72 79                	jb     804ca7 <__rodata_start+0x1cf>
+  804c2e:	00 6f 75             	add    %ch,0x75(%rdi)
+  804c31:	74 20                	je     804c53 <__rodata_start+0x17b>
+  804c33:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c34:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  804c38:	76 69                	jbe    804ca3 <__rodata_start+0x1cb>
+  804c3a:	72 6f                	jb     804cab <__rodata_start+0x1d3>
+  804c3c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c3d:	6d                   	insl   (%dx),%es:(%rdi)
+  804c3e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c40:	74 73                	je     804cb5 <__rodata_start+0x1dd>
+  804c42:	00 63 6f             	add    %ah,0x6f(%rbx)
+  804c45:	72 72                	jb     804cb9 <__rodata_start+0x1e1>
+  804c47:	75 70                	jne    804cb9 <__rodata_start+0x1e1>
+  804c49:	74 65                	je     804cb0 <__rodata_start+0x1d8>
+  804c4b:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  804c50:	75 67                	jne    804cb9 <__rodata_start+0x1e1>
+  804c52:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804c55:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c57:	00 73 65             	add    %dh,0x65(%rbx)
+  804c5a:	67 6d                	insl   (%dx),%es:(%edi)
+  804c5c:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804c5e:	74 61                	je     804cc1 <__rodata_start+0x1e9>
+  804c60:	74 69                	je     804ccb <__rodata_start+0x1f3>
+  804c62:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c63:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c64:	20 66 61             	and    %ah,0x61(%rsi)
+  804c67:	75 6c                	jne    804cd5 <__rodata_start+0x1fd>
+  804c69:	74 00                	je     804c6b <__rodata_start+0x193>
+  804c6b:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804c72:	20 45 4c             	and    %al,0x4c(%rbp)
+  804c75:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804c79:	61                   	(bad)
+  804c7a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804c7f:	20 73 75             	and    %dh,0x75(%rbx)
+  804c82:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804c85:	73 79                	jae    804d00 <__rodata_start+0x228>
+  804c87:	73 74                	jae    804cfd <__rodata_start+0x225>
+  804c89:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804c8b:	20 63 61             	and    %ah,0x61(%rbx)
+  804c8e:	6c                   	insb   (%dx),%es:(%rdi)
+  804c8f:	6c                   	insb   (%dx),%es:(%rdi)
+  804c90:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804c93:	74 72                	je     804d07 <__rodata_start+0x22f>
+  804c95:	79 20                	jns    804cb7 <__rodata_start+0x1df>
+  804c97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804c98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804c99:	74 20                	je     804cbb <__rodata_start+0x1e3>
+  804c9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804c9d:	75 6e                	jne    804d0d <__rodata_start+0x235>
+  804c9f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804ca3:	76 20                	jbe    804cc5 <__rodata_start+0x1ed>
+  804ca5:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804cac:	72 65                	jb     804d13 <__rodata_start+0x23b>
+  804cae:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804cb1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cb2:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804cb6:	65 78 70             	gs js  804d29 <__rodata_start+0x251>
+  804cb9:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804cbe:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804cc1:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804cc5:	20 66 69             	and    %ah,0x69(%rsi)
+  804cc8:	6c                   	insb   (%dx),%es:(%rdi)
+  804cc9:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804ccd:	20 66 72             	and    %ah,0x72(%rsi)
+  804cd0:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804cd5:	61                   	(bad)
+  804cd6:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804cd9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804cda:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804cdb:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804cdf:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804ce2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ce3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ce4:	20 6d 61             	and    %ch,0x61(%rbp)
+  804ce7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804ce8:	79 20                	jns    804d0a <__rodata_start+0x232>
+  804cea:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804cf1:	72 65                	jb     804d58 <__rodata_start+0x280>
+  804cf3:	20 6f 70             	and    %ch,0x70(%rdi)
+  804cf6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804cf8:	00 66 69             	add    %ah,0x69(%rsi)
+  804cfb:	6c                   	insb   (%dx),%es:(%rdi)
+  804cfc:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804d00:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804d03:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d04:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804d07:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d08:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d09:	74 20                	je     804d2b <__rodata_start+0x253>
+  804d0b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804d0d:	75 6e                	jne    804d7d <__rodata_start+0x2a5>
+  804d0f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804d13:	76 61                	jbe    804d76 <__rodata_start+0x29e>
+  804d15:	6c                   	insb   (%dx),%es:(%rdi)
+  804d16:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804d1d:	00 
+  804d1e:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804d25:	72 65                	jb     804d8c <__rodata_start+0x2b4>
+  804d27:	61                   	(bad)
+  804d28:	64 79 20             	fs jns 804d4b <__rodata_start+0x273>
+  804d2b:	65 78 69             	gs js  804d97 <__rodata_start+0x2bf>
+  804d2e:	73 74                	jae    804da4 <__rodata_start+0x2cc>
+  804d30:	73 00                	jae    804d32 <__rodata_start+0x25a>
+  804d32:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d33:	70 65                	jo     804d9a <__rodata_start+0x2c2>
+  804d35:	72 61                	jb     804d98 <__rodata_start+0x2c0>
+  804d37:	74 69                	je     804da2 <__rodata_start+0x2ca>
+  804d39:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d3a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804d3b:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804d3e:	74 20                	je     804d60 <__rodata_start+0x288>
+  804d40:	73 75                	jae    804db7 <__rodata_start+0x2df>
+  804d42:	70 70                	jo     804db4 <__rodata_start+0x2dc>
+  804d44:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804d45:	72 74                	jb     804dbb <__rodata_start+0x2e3>
+  804d47:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804d4d:	20 61 67             	and    %ah,0x67(%rcx)
+  804d50:	61                   	(bad)
+  804d51:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804d58:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804d5c:	74 00                	je     804d5e <__rodata_start+0x286>
+  804d5e:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804d65:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804d68:	20 75 73             	and    %dh,0x73(%rbp)
+  804d6b:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  804d6f:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  804d76:	00 
+  804d77:	66 0f 1f 84 00 00 00 	nopw   0x0(%rax,%rax,1)
+  804d7e:	00 00 
+  804d80:	6c                   	insb   (%dx),%es:(%rdi)
+  804d81:	07                   	(bad)
+  804d82:	80 00 00             	addb   $0x0,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804d8d:	00 00                	add    %al,(%rax)
+  804d8f:	00 9d 0d 80 00 00    	add    %bl,0x800d(%rbp)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804d9d:	00 00                	add    %al,(%rax)
+  804d9f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804da5:	00 00                	add    %al,(%rax)
+  804da7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804db5:	00 00                	add    %al,(%rax)
+  804db7:	00 8b 07 80 00 00    	add    %cl,0x8007(%rbx)
+  804dbd:	00 00                	add    %al,(%rax)
+  804dbf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804dc5:	00 00                	add    %al,(%rax)
+  804dc7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804dcd:	00 00                	add    %al,(%rax)
+  804dcf:	00 7f 07             	add    %bh,0x7(%rdi)
+  804dd2:	80 00 00             	addb   $0x0,(%rax)
+  804dd5:	00 00                	add    %al,(%rax)
+  804dd7:	00 f9                	add    %bh,%cl
+  804dd9:	07                   	(bad)
+  804dda:	80 00 00             	addb   $0x0,(%rax)
+  804ddd:	00 00                	add    %al,(%rax)
+  804ddf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804de5:	00 00                	add    %al,(%rax)
+  804de7:	00 7f 07             	add    %bh,0x7(%rdi)
+  804dea:	80 00 00             	addb   $0x0,(%rax)
+  804ded:	00 00                	add    %al,(%rax)
+  804def:	00 c5                	add    %al,%ch
+  804df1:	07                   	(bad)
+  804df2:	80 00 00             	addb   $0x0,(%rax)
+  804df5:	00 00                	add    %al,(%rax)
+  804df7:	00 c5                	add    %al,%ch
+  804df9:	07                   	(bad)
+  804dfa:	80 00 00             	addb   $0x0,(%rax)
+  804dfd:	00 00                	add    %al,(%rax)
+  804dff:	00 c5                	add    %al,%ch
+  804e01:	07                   	(bad)
+  804e02:	80 00 00             	addb   $0x0,(%rax)
+  804e05:	00 00                	add    %al,(%rax)
+  804e07:	00 c5                	add    %al,%ch
+  804e09:	07                   	(bad)
+  804e0a:	80 00 00             	addb   $0x0,(%rax)
+  804e0d:	00 00                	add    %al,(%rax)
+  804e0f:	00 c5                	add    %al,%ch
+  804e11:	07                   	(bad)
+  804e12:	80 00 00             	addb   $0x0,(%rax)
+  804e15:	00 00                	add    %al,(%rax)
+  804e17:	00 c5                	add    %al,%ch
+  804e19:	07                   	(bad)
+  804e1a:	80 00 00             	addb   $0x0,(%rax)
+  804e1d:	00 00                	add    %al,(%rax)
+  804e1f:	00 c5                	add    %al,%ch
+  804e21:	07                   	(bad)
+  804e22:	80 00 00             	addb   $0x0,(%rax)
+  804e25:	00 00                	add    %al,(%rax)
+  804e27:	00 c5                	add    %al,%ch
+  804e29:	07                   	(bad)
+  804e2a:	80 00 00             	addb   $0x0,(%rax)
+  804e2d:	00 00                	add    %al,(%rax)
+  804e2f:	00 c5                	add    %al,%ch
+  804e31:	07                   	(bad)
+  804e32:	80 00 00             	addb   $0x0,(%rax)
+  804e35:	00 00                	add    %al,(%rax)
+  804e37:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e3d:	00 00                	add    %al,(%rax)
+  804e3f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e45:	00 00                	add    %al,(%rax)
+  804e47:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e4d:	00 00                	add    %al,(%rax)
+  804e4f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e55:	00 00                	add    %al,(%rax)
+  804e57:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e5d:	00 00                	add    %al,(%rax)
+  804e5f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e65:	00 00                	add    %al,(%rax)
+  804e67:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e6d:	00 00                	add    %al,(%rax)
+  804e6f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e75:	00 00                	add    %al,(%rax)
+  804e77:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e7d:	00 00                	add    %al,(%rax)
+  804e7f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e85:	00 00                	add    %al,(%rax)
+  804e87:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e8d:	00 00                	add    %al,(%rax)
+  804e8f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e95:	00 00                	add    %al,(%rax)
+  804e97:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804e9d:	00 00                	add    %al,(%rax)
+  804e9f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ea5:	00 00                	add    %al,(%rax)
+  804ea7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ead:	00 00                	add    %al,(%rax)
+  804eaf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804eb5:	00 00                	add    %al,(%rax)
+  804eb7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ebd:	00 00                	add    %al,(%rax)
+  804ebf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ec5:	00 00                	add    %al,(%rax)
+  804ec7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ecd:	00 00                	add    %al,(%rax)
+  804ecf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ed5:	00 00                	add    %al,(%rax)
+  804ed7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804edd:	00 00                	add    %al,(%rax)
+  804edf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ee5:	00 00                	add    %al,(%rax)
+  804ee7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804eed:	00 00                	add    %al,(%rax)
+  804eef:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ef5:	00 00                	add    %al,(%rax)
+  804ef7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804efd:	00 00                	add    %al,(%rax)
+  804eff:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f05:	00 00                	add    %al,(%rax)
+  804f07:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f0d:	00 00                	add    %al,(%rax)
+  804f0f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f15:	00 00                	add    %al,(%rax)
+  804f17:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f1d:	00 00                	add    %al,(%rax)
+  804f1f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f25:	00 00                	add    %al,(%rax)
+  804f27:	00 d0                	add    %dl,%al
+  804f29:	0c 80                	or     $0x80,%al
+  804f2b:	00 00                	add    %al,(%rax)
+  804f2d:	00 00                	add    %al,(%rax)
+  804f2f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f35:	00 00                	add    %al,(%rax)
+  804f37:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f3d:	00 00                	add    %al,(%rax)
+  804f3f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f45:	00 00                	add    %al,(%rax)
+  804f47:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f4d:	00 00                	add    %al,(%rax)
+  804f4f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f55:	00 00                	add    %al,(%rax)
+  804f57:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f5d:	00 00                	add    %al,(%rax)
+  804f5f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f65:	00 00                	add    %al,(%rax)
+  804f67:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f6d:	00 00                	add    %al,(%rax)
+  804f6f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f75:	00 00                	add    %al,(%rax)
+  804f77:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f7d:	00 00                	add    %al,(%rax)
+  804f7f:	00 1c 08             	add    %bl,(%rax,%rcx,1)
+  804f82:	80 00 00             	addb   $0x0,(%rax)
+  804f85:	00 00                	add    %al,(%rax)
+  804f87:	00 eb                	add    %ch,%bl
+  804f89:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804f8f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f95:	00 00                	add    %al,(%rax)
+  804f97:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804f9d:	00 00                	add    %al,(%rax)
+  804f9f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fa5:	00 00                	add    %al,(%rax)
+  804fa7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fad:	00 00                	add    %al,(%rax)
+  804faf:	00 4b 08             	add    %cl,0x8(%rbx)
+  804fb2:	80 00 00             	addb   $0x0,(%rax)
+  804fb5:	00 00                	add    %al,(%rax)
+  804fb7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fbd:	00 00                	add    %al,(%rax)
+  804fbf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fc5:	00 00                	add    %al,(%rax)
+  804fc7:	00 11                	add    %dl,(%rcx)
+  804fc9:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  804fcf:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fd5:	00 00                	add    %al,(%rax)
+  804fd7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804fdd:	00 00                	add    %al,(%rax)
+  804fdf:	00 93 0b 80 00 00    	add    %dl,0x800b(%rbx)
+  804fe5:	00 00                	add    %al,(%rax)
+  804fe7:	00 5d 0c             	add    %bl,0xc(%rbp)
+  804fea:	80 00 00             	addb   $0x0,(%rax)
+  804fed:	00 00                	add    %al,(%rax)
+  804fef:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ff5:	00 00                	add    %al,(%rax)
+  804ff7:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  804ffd:	00 00                	add    %al,(%rax)
+  804fff:	00 e2                	add    %ah,%dl
+  805001:	08 80 00 00 00 00    	or     %al,0x0(%rax)
+  805007:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  80500d:	00 00                	add    %al,(%rax)
+  80500f:	00 bf 0a 80 00 00    	add    %bh,0x800a(%rdi)
+  805015:	00 00                	add    %al,(%rax)
+  805017:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  80501d:	00 00                	add    %al,(%rax)
+  80501f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  805025:	00 00                	add    %al,(%rax)
+  805027:	00 d0                	add    %dl,%al
+  805029:	0c 80                	or     $0x80,%al
+  80502b:	00 00                	add    %al,(%rax)
+  80502d:	00 00                	add    %al,(%rax)
+  80502f:	00 ad 0d 80 00 00    	add    %ch,0x800d(%rbp)
+  805035:	00 00                	add    %al,(%rax)
+  805037:	00 75 07             	add    %dh,0x7(%rbp)
+  80503a:	80 00 00             	addb   $0x0,(%rax)
+  80503d:	00 00                	add    %al,(%rax)
+	...
+
+0000000000805040 <error_string>:
+	...
+  805048:	ed 4b 80 00 00 00 00 00 ff 4b 80 00 00 00 00 00     .K.......K......
+  805058:	0f 4c 80 00 00 00 00 00 21 4c 80 00 00 00 00 00     .L......!L......
+  805068:	2f 4c 80 00 00 00 00 00 43 4c 80 00 00 00 00 00     /L......CL......
+  805078:	58 4c 80 00 00 00 00 00 6b 4c 80 00 00 00 00 00     XL......kL......
+  805088:	7d 4c 80 00 00 00 00 00 91 4c 80 00 00 00 00 00     }L.......L......
+  805098:	a1 4c 80 00 00 00 00 00 b4 4c 80 00 00 00 00 00     .L.......L......
+  8050a8:	cb 4c 80 00 00 00 00 00 e1 4c 80 00 00 00 00 00     .L.......L......
+  8050b8:	f9 4c 80 00 00 00 00 00 11 4d 80 00 00 00 00 00     .L.......M......
+  8050c8:	1e 4d 80 00 00 00 00 00 f8 50 80 00 00 00 00 00     .M.......P......
+  8050d8:	32 4d 80 00 00 00 00 00 4a 4d 80 00 00 00 00 00     2M......JM......
+  8050e8:	54 4d 80 00 00 00 00 00 5e 4d 80 00 00 00 00 00     TM......^M......
+  8050f8:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  805108:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  805118:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  805128:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  805138:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  805148:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  805158:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  805168:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  805178:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  805188:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  805198:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  8051a8:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  8051b8:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  8051c8:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  8051d8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  8051e8:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051f8:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000805200 <devtab>:
+  805200:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  805210:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  805220:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  805230:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  805240:	70 69 70 65 2e 63 00 90 73 79 73 5f 72 65 67 69     pipe.c..sys_regi
+  805250:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  805260:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 3c 63 6f 6e     _SIZE) == 2.<con
+  805270:	73 3e 00 63 6f 6e 73 00 55 73 65 72 73 70 61 63     s>.cons.Userspac
+  805280:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805290:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  8052a0:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  8052b0:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  8052c0:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  8052d0:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  8052e0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8052f0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  805300:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  805310:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805320:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805330:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805340:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805350:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805360:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805370:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805380:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805390:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805400:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805410:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805420:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805430:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805440:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805450:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805460:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805470:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805480:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805490:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805500:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805510:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805520:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805530:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805540:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805550:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805560:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805570:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805580:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805590:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805600:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805610:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805620:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805630:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805640:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805650:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805660:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805670:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805680:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805690:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805700:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805710:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805720:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805730:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805740:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805750:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805760:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805770:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805780:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805790:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805800:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805810:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805820:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805830:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805840:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805850:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805860:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805870:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805880:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805890:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805900:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805910:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805920:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805930:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805940:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805950:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805960:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805970:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805980:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805990:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805aa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ab0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ac0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ad0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ae0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805af0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ba0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805bb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bc0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805be0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bf0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ca0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805cb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ce0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cf0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805da0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805db0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805dc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805dd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805de0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805df0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ea0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805eb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ec0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ed0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ee0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ef0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fa0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fb0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fe0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ff0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 90     ....f.........f.
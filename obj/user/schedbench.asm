@@ -0,0 +1,8644 @@
+
+obj/user/schedbench:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 65 01 00 00       	call   800188 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <bench>:
+#define NWARMUP 3
+
+static envid_t kids[1000];
+
+static void
+bench(int nenvs) {
+  800025:	55                   	push   %rbp
+  800026:	48 89 e5             	mov    %rsp,%rbp
+  800029:	41 56                	push   %r14
+  80002b:	41 55                	push   %r13
+  80002d:	41 54                	push   %r12
+  80002f:	53                   	push   %rbx
+    int i, nkids;
+
+    /* We are runnable ourselves */
+    for (nkids = 0; nkids < nenvs - 1; nkids++) {
+  800030:	83 ff 01             	cmp    $0x1,%edi
+  800033:	0f 8e 16 01 00 00    	jle    80014f <bench+0x12a>
+  800039:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  800040:	00 00 00 
+  800043:	44 8d 67 ff          	lea    -0x1(%rdi),%r12d
+  800047:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+        envid_t id = fork();
+  80004d:	49 be c2 15 80 00 00 	movabs $0x8015c2,%r14
+  800054:	00 00 00 
+  800057:	41 ff d6             	call   *%r14
+        if (id < 0) break;
+  80005a:	85 c0                	test   %eax,%eax
+  80005c:	78 18                	js     800076 <bench+0x51>
+        if (!id)
+  80005e:	0f 84 dd 00 00 00    	je     800141 <bench+0x11c>
+            for (;;) sys_yield();
+        kids[nkids] = id;
+  800064:	89 03                	mov    %eax,(%rbx)
+    for (nkids = 0; nkids < nenvs - 1; nkids++) {
+  800066:	41 83 c5 01          	add    $0x1,%r13d
+  80006a:	48 83 c3 04          	add    $0x4,%rbx
+  80006e:	45 39 e5             	cmp    %r12d,%r13d
+  800071:	75 e4                	jne    800057 <bench+0x32>
+  800073:	45 89 e5             	mov    %r12d,%r13d
+    }
+
+    /* Let children fault in their stacks */
+    for (i = 0; i < NWARMUP; i++)
+        sys_yield();
+  800076:	48 bb 2b 11 80 00 00 	movabs $0x80112b,%rbx
+  80007d:	00 00 00 
+  800080:	ff d3                	call   *%rbx
+  800082:	ff d3                	call   *%rbx
+  800084:	ff d3                	call   *%rbx
+}
+
+static inline uint64_t __attribute__((always_inline))
+read_tsc(void) {
+    uint32_t lo, hi;
+    asm volatile("rdtsc"
+  800086:	0f 31                	rdtsc
+                 : "=a"(lo), "=d"(hi));
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  800088:	48 c1 e2 20          	shl    $0x20,%rdx
+  80008c:	89 c0                	mov    %eax,%eax
+  80008e:	48 09 c2             	or     %rax,%rdx
+  800091:	49 89 d6             	mov    %rdx,%r14
+  800094:	bb 64 00 00 00       	mov    $0x64,%ebx
+
+    uint64_t start = read_tsc();
+    for (i = 0; i < NROUNDS; i++)
+        sys_yield();
+  800099:	49 bc 2b 11 80 00 00 	movabs $0x80112b,%r12
+  8000a0:	00 00 00 
+  8000a3:	41 ff d4             	call   *%r12
+    for (i = 0; i < NROUNDS; i++)
+  8000a6:	83 eb 01             	sub    $0x1,%ebx
+  8000a9:	75 f8                	jne    8000a3 <bench+0x7e>
+    asm volatile("rdtsc"
+  8000ab:	0f 31                	rdtsc
+    return (uint64_t)lo | ((uint64_t)hi << 32);
+  8000ad:	48 c1 e2 20          	shl    $0x20,%rdx
+  8000b1:	89 c0                	mov    %eax,%eax
+  8000b3:	48 09 c2             	or     %rax,%rdx
+    uint64_t cycles = read_tsc() - start;
+  8000b6:	4c 29 f2             	sub    %r14,%rdx
+
+    /* Every yield of ours lets each of the children yield once */
+    cprintf("schedbench: %d envs: %lu cycles/round, %lu cycles/yield\n",
+            nkids + 1, (unsigned long)(cycles / NROUNDS),
+            (unsigned long)(cycles / NROUNDS / (nkids + 1)));
+  8000b9:	48 c1 ea 02          	shr    $0x2,%rdx
+  8000bd:	48 b9 c3 f5 28 5c 8f 	movabs $0x28f5c28f5c28f5c3,%rcx
+  8000c4:	c2 f5 28 
+  8000c7:	48 89 d0             	mov    %rdx,%rax
+  8000ca:	48 f7 e1             	mul    %rcx
+  8000cd:	48 89 d6             	mov    %rdx,%rsi
+  8000d0:	48 c1 ee 02          	shr    $0x2,%rsi
+  8000d4:	41 8d 7d 01          	lea    0x1(%r13),%edi
+  8000d8:	48 63 cf             	movslq %edi,%rcx
+  8000db:	48 89 f0             	mov    %rsi,%rax
+  8000de:	ba 00 00 00 00       	mov    $0x0,%edx
+  8000e3:	48 f7 f1             	div    %rcx
+  8000e6:	48 89 c1             	mov    %rax,%rcx
+    cprintf("schedbench: %d envs: %lu cycles/round, %lu cycles/yield\n",
+  8000e9:	48 89 f2             	mov    %rsi,%rdx
+  8000ec:	89 fe                	mov    %edi,%esi
+  8000ee:	48 bf 08 49 80 00 00 	movabs $0x804908,%rdi
+  8000f5:	00 00 00 
+  8000f8:	b8 00 00 00 00       	mov    $0x0,%eax
+  8000fd:	49 b8 0b 03 80 00 00 	movabs $0x80030b,%r8
+  800104:	00 00 00 
+  800107:	41 ff d0             	call   *%r8
+
+    for (i = 0; i < nkids; i++)
+  80010a:	45 85 ed             	test   %r13d,%r13d
+  80010d:	7e 29                	jle    800138 <bench+0x113>
+  80010f:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  800116:	00 00 00 
+  800119:	4d 63 ed             	movslq %r13d,%r13
+  80011c:	4e 8d 2c ab          	lea    (%rbx,%r13,4),%r13
+        sys_env_destroy(kids[i]);
+  800120:	49 bc 9f 10 80 00 00 	movabs $0x80109f,%r12
+  800127:	00 00 00 
+  80012a:	8b 3b                	mov    (%rbx),%edi
+  80012c:	41 ff d4             	call   *%r12
+    for (i = 0; i < nkids; i++)
+  80012f:	48 83 c3 04          	add    $0x4,%rbx
+  800133:	49 39 dd             	cmp    %rbx,%r13
+  800136:	75 f2                	jne    80012a <bench+0x105>
+}
+  800138:	5b                   	pop    %rbx
+  800139:	41 5c                	pop    %r12
+  80013b:	41 5d                	pop    %r13
+  80013d:	41 5e                	pop    %r14
+  80013f:	5d                   	pop    %rbp
+  800140:	c3                   	ret
+            for (;;) sys_yield();
+  800141:	48 bb 2b 11 80 00 00 	movabs $0x80112b,%rbx
+  800148:	00 00 00 
+  80014b:	ff d3                	call   *%rbx
+  80014d:	eb fc                	jmp    80014b <bench+0x126>
+    for (nkids = 0; nkids < nenvs - 1; nkids++) {
+  80014f:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  800155:	e9 1c ff ff ff       	jmp    800076 <bench+0x51>
+
+000000000080015a <umain>:
+
+void
+umain(int argc, char **argv) {
+  80015a:	55                   	push   %rbp
+  80015b:	48 89 e5             	mov    %rsp,%rbp
+  80015e:	53                   	push   %rbx
+  80015f:	48 83 ec 08          	sub    $0x8,%rsp
+    bench(10);
+  800163:	bf 0a 00 00 00       	mov    $0xa,%edi
+  800168:	48 bb 25 00 80 00 00 	movabs $0x800025,%rbx
+  80016f:	00 00 00 
+  800172:	ff d3                	call   *%rbx
+    bench(100);
+  800174:	bf 64 00 00 00       	mov    $0x64,%edi
+  800179:	ff d3                	call   *%rbx
+    bench(1000);
+  80017b:	bf e8 03 00 00       	mov    $0x3e8,%edi
+  800180:	ff d3                	call   *%rbx
+}
+  800182:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800186:	c9                   	leave
+  800187:	c3                   	ret
+
+0000000000800188 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800188:	55                   	push   %rbp
+  800189:	48 89 e5             	mov    %rsp,%rbp
+  80018c:	41 56                	push   %r14
+  80018e:	41 55                	push   %r13
+  800190:	41 54                	push   %r12
+  800192:	53                   	push   %rbx
+  800193:	41 89 fd             	mov    %edi,%r13d
+  800196:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800199:	48 ba e0 60 80 00 00 	movabs $0x8060e0,%rdx
+  8001a0:	00 00 00 
+  8001a3:	48 b8 e0 60 80 00 00 	movabs $0x8060e0,%rax
+  8001aa:	00 00 00 
+  8001ad:	48 39 c2             	cmp    %rax,%rdx
+  8001b0:	73 17                	jae    8001c9 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  8001b2:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  8001b5:	49 89 c4             	mov    %rax,%r12
+  8001b8:	48 83 c3 08          	add    $0x8,%rbx
+  8001bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8001c1:	ff 53 f8             	call   *-0x8(%rbx)
+  8001c4:	4c 39 e3             	cmp    %r12,%rbx
+  8001c7:	72 ef                	jb     8001b8 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  8001c9:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  8001d0:	00 00 00 
+  8001d3:	ff d0                	call   *%rax
+  8001d5:	89 c2                	mov    %eax,%edx
+  8001d7:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8001dd:	48 89 d0             	mov    %rdx,%rax
+  8001e0:	48 c1 e0 04          	shl    $0x4,%rax
+  8001e4:	48 29 d0             	sub    %rdx,%rax
+  8001e7:	48 c1 e0 05          	shl    $0x5,%rax
+  8001eb:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8001f2:	00 00 00 
+  8001f5:	48 01 d0             	add    %rdx,%rax
+  8001f8:	48 a3 a0 0f 81 00 00 	movabs %rax,0x810fa0
+  8001ff:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800202:	45 85 ed             	test   %r13d,%r13d
+  800205:	7e 0d                	jle    800214 <libmain+0x8c>
+  800207:	49 8b 06             	mov    (%r14),%rax
+  80020a:	48 a3 00 60 80 00 00 	movabs %rax,0x806000
+  800211:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800214:	4c 89 f6             	mov    %r14,%rsi
+  800217:	44 89 ef             	mov    %r13d,%edi
+  80021a:	48 b8 5a 01 80 00 00 	movabs $0x80015a,%rax
+  800221:	00 00 00 
+  800224:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800226:	48 b8 3b 02 80 00 00 	movabs $0x80023b,%rax
+  80022d:	00 00 00 
+  800230:	ff d0                	call   *%rax
+#endif
+}
+  800232:	5b                   	pop    %rbx
+  800233:	41 5c                	pop    %r12
+  800235:	41 5d                	pop    %r13
+  800237:	41 5e                	pop    %r14
+  800239:	5d                   	pop    %rbp
+  80023a:	c3                   	ret
+
+000000000080023b <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  80023b:	55                   	push   %rbp
+  80023c:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  80023f:	48 b8 08 19 80 00 00 	movabs $0x801908,%rax
+  800246:	00 00 00 
+  800249:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  80024b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800250:	48 b8 9f 10 80 00 00 	movabs $0x80109f,%rax
+  800257:	00 00 00 
+  80025a:	ff d0                	call   *%rax
+}
+  80025c:	5d                   	pop    %rbp
+  80025d:	c3                   	ret
+
+000000000080025e <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  80025e:	55                   	push   %rbp
+  80025f:	48 89 e5             	mov    %rsp,%rbp
+  800262:	53                   	push   %rbx
+  800263:	48 83 ec 08          	sub    $0x8,%rsp
+  800267:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  80026a:	8b 06                	mov    (%rsi),%eax
+  80026c:	8d 50 01             	lea    0x1(%rax),%edx
+  80026f:	89 16                	mov    %edx,(%rsi)
+  800271:	48 98                	cltq
+  800273:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800278:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  80027e:	74 0a                	je     80028a <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800280:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800284:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800288:	c9                   	leave
+  800289:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  80028a:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  80028e:	be ff 00 00 00       	mov    $0xff,%esi
+  800293:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  80029a:	00 00 00 
+  80029d:	ff d0                	call   *%rax
+        state->offset = 0;
+  80029f:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  8002a5:	eb d9                	jmp    800280 <putch+0x22>
+
+00000000008002a7 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  8002a7:	55                   	push   %rbp
+  8002a8:	48 89 e5             	mov    %rsp,%rbp
+  8002ab:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  8002b2:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  8002b5:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  8002bc:	b9 21 00 00 00       	mov    $0x21,%ecx
+  8002c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8002c6:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  8002c9:	48 89 f1             	mov    %rsi,%rcx
+  8002cc:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  8002d3:	48 bf 5e 02 80 00 00 	movabs $0x80025e,%rdi
+  8002da:	00 00 00 
+  8002dd:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  8002e4:	00 00 00 
+  8002e7:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  8002e9:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  8002f0:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  8002f7:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  8002fe:	00 00 00 
+  800301:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800303:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800309:	c9                   	leave
+  80030a:	c3                   	ret
+
+000000000080030b <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  80030b:	55                   	push   %rbp
+  80030c:	48 89 e5             	mov    %rsp,%rbp
+  80030f:	48 83 ec 50          	sub    $0x50,%rsp
+  800313:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800317:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  80031b:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80031f:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800323:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800327:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  80032e:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800332:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800336:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80033a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  80033e:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800342:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  800349:	00 00 00 
+  80034c:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  80034e:	c9                   	leave
+  80034f:	c3                   	ret
+
+0000000000800350 <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800350:	55                   	push   %rbp
+  800351:	48 89 e5             	mov    %rsp,%rbp
+  800354:	41 57                	push   %r15
+  800356:	41 56                	push   %r14
+  800358:	41 55                	push   %r13
+  80035a:	41 54                	push   %r12
+  80035c:	53                   	push   %rbx
+  80035d:	48 83 ec 18          	sub    $0x18,%rsp
+  800361:	49 89 fc             	mov    %rdi,%r12
+  800364:	49 89 f5             	mov    %rsi,%r13
+  800367:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  80036b:	8b 45 10             	mov    0x10(%rbp),%eax
+  80036e:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800371:	41 89 cf             	mov    %ecx,%r15d
+  800374:	4c 39 fa             	cmp    %r15,%rdx
+  800377:	73 5b                	jae    8003d4 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800379:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  80037d:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800381:	85 db                	test   %ebx,%ebx
+  800383:	7e 0e                	jle    800393 <print_num+0x43>
+            putch(padc, put_arg);
+  800385:	4c 89 ee             	mov    %r13,%rsi
+  800388:	44 89 f7             	mov    %r14d,%edi
+  80038b:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  80038e:	83 eb 01             	sub    $0x1,%ebx
+  800391:	75 f2                	jne    800385 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800393:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800397:	48 b9 5c 49 80 00 00 	movabs $0x80495c,%rcx
+  80039e:	00 00 00 
+  8003a1:	48 b8 4b 49 80 00 00 	movabs $0x80494b,%rax
+  8003a8:	00 00 00 
+  8003ab:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  8003af:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003b3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003b8:	49 f7 f7             	div    %r15
+  8003bb:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  8003bf:	4c 89 ee             	mov    %r13,%rsi
+  8003c2:	41 ff d4             	call   *%r12
+}
+  8003c5:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  8003c9:	5b                   	pop    %rbx
+  8003ca:	41 5c                	pop    %r12
+  8003cc:	41 5d                	pop    %r13
+  8003ce:	41 5e                	pop    %r14
+  8003d0:	41 5f                	pop    %r15
+  8003d2:	5d                   	pop    %rbp
+  8003d3:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  8003d4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8003d8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8003dd:	49 f7 f7             	div    %r15
+  8003e0:	48 83 ec 08          	sub    $0x8,%rsp
+  8003e4:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  8003e8:	52                   	push   %rdx
+  8003e9:	45 0f be c9          	movsbl %r9b,%r9d
+  8003ed:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  8003f1:	48 89 c2             	mov    %rax,%rdx
+  8003f4:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  8003fb:	00 00 00 
+  8003fe:	ff d0                	call   *%rax
+  800400:	48 83 c4 10          	add    $0x10,%rsp
+  800404:	eb 8d                	jmp    800393 <print_num+0x43>
+
+0000000000800406 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800406:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  80040a:	48 8b 06             	mov    (%rsi),%rax
+  80040d:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800411:	73 0a                	jae    80041d <sprintputch+0x17>
+        *state->start++ = ch;
+  800413:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800417:	48 89 16             	mov    %rdx,(%rsi)
+  80041a:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  80041d:	c3                   	ret
+
+000000000080041e <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  80041e:	55                   	push   %rbp
+  80041f:	48 89 e5             	mov    %rsp,%rbp
+  800422:	48 83 ec 50          	sub    $0x50,%rsp
+  800426:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80042a:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  80042e:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800432:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800439:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80043d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800441:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800445:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800449:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  80044d:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  800454:	00 00 00 
+  800457:	ff d0                	call   *%rax
+}
+  800459:	c9                   	leave
+  80045a:	c3                   	ret
+
+000000000080045b <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  80045b:	55                   	push   %rbp
+  80045c:	48 89 e5             	mov    %rsp,%rbp
+  80045f:	41 57                	push   %r15
+  800461:	41 56                	push   %r14
+  800463:	41 55                	push   %r13
+  800465:	41 54                	push   %r12
+  800467:	53                   	push   %rbx
+  800468:	48 83 ec 38          	sub    $0x38,%rsp
+  80046c:	49 89 fe             	mov    %rdi,%r14
+  80046f:	49 89 f5             	mov    %rsi,%r13
+  800472:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800475:	48 8b 01             	mov    (%rcx),%rax
+  800478:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  80047c:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800480:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800484:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800488:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  80048c:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800490:	0f b6 3b             	movzbl (%rbx),%edi
+  800493:	40 80 ff 25          	cmp    $0x25,%dil
+  800497:	74 18                	je     8004b1 <vprintfmt+0x56>
+            if (!ch) return;
+  800499:	40 84 ff             	test   %dil,%dil
+  80049c:	0f 84 b1 06 00 00    	je     800b53 <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  8004a2:	40 0f b6 ff          	movzbl %dil,%edi
+  8004a6:	4c 89 ee             	mov    %r13,%rsi
+  8004a9:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  8004ac:	4c 89 e3             	mov    %r12,%rbx
+  8004af:	eb db                	jmp    80048c <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  8004b1:	be 00 00 00 00       	mov    $0x0,%esi
+  8004b6:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  8004ba:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  8004bf:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  8004c5:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  8004cc:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  8004d0:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  8004d5:	41 0f b6 04 24       	movzbl (%r12),%eax
+  8004da:	88 45 a0             	mov    %al,-0x60(%rbp)
+  8004dd:	83 e8 23             	sub    $0x23,%eax
+  8004e0:	3c 57                	cmp    $0x57,%al
+  8004e2:	0f 87 51 06 00 00    	ja     800b39 <vprintfmt+0x6de>
+  8004e8:	0f b6 c0             	movzbl %al,%eax
+  8004eb:	48 b9 00 4b 80 00 00 	movabs $0x804b00,%rcx
+  8004f2:	00 00 00 
+  8004f5:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  8004f8:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  8004fb:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  8004ff:	eb cf                	jmp    8004d0 <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800501:	49 89 dc             	mov    %rbx,%r12
+  800504:	be 01 00 00 00       	mov    $0x1,%esi
+  800509:	eb c5                	jmp    8004d0 <vprintfmt+0x75>
+            padc = ch;
+  80050b:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  80050f:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800512:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800515:	eb b9                	jmp    8004d0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800517:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80051a:	83 f8 2f             	cmp    $0x2f,%eax
+  80051d:	77 24                	ja     800543 <vprintfmt+0xe8>
+  80051f:	89 c1                	mov    %eax,%ecx
+  800521:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800525:	83 c0 08             	add    $0x8,%eax
+  800528:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80052b:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  80052e:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800531:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800535:	79 99                	jns    8004d0 <vprintfmt+0x75>
+                width = precision;
+  800537:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  80053b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800541:	eb 8d                	jmp    8004d0 <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800543:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800547:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  80054b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80054f:	eb da                	jmp    80052b <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800551:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800556:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  80055a:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800560:	3c 39                	cmp    $0x39,%al
+  800562:	77 1c                	ja     800580 <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800564:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800568:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  80056c:	0f b6 c0             	movzbl %al,%eax
+  80056f:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800574:	0f b6 03             	movzbl (%rbx),%eax
+  800577:	3c 39                	cmp    $0x39,%al
+  800579:	76 e9                	jbe    800564 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  80057b:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  80057e:	eb b1                	jmp    800531 <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800580:	49 89 dc             	mov    %rbx,%r12
+  800583:	eb ac                	jmp    800531 <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800585:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800588:	85 c9                	test   %ecx,%ecx
+  80058a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80058f:	0f 49 c1             	cmovns %ecx,%eax
+  800592:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800595:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800598:	e9 33 ff ff ff       	jmp    8004d0 <vprintfmt+0x75>
+            lflag++;
+  80059d:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  8005a0:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  8005a3:	e9 28 ff ff ff       	jmp    8004d0 <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  8005a8:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005ab:	83 f8 2f             	cmp    $0x2f,%eax
+  8005ae:	77 19                	ja     8005c9 <vprintfmt+0x16e>
+  8005b0:	89 c2                	mov    %eax,%edx
+  8005b2:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005b6:	83 c0 08             	add    $0x8,%eax
+  8005b9:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8005bc:	8b 3a                	mov    (%rdx),%edi
+  8005be:	4c 89 ee             	mov    %r13,%rsi
+  8005c1:	41 ff d6             	call   *%r14
+            break;
+  8005c4:	e9 c3 fe ff ff       	jmp    80048c <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  8005c9:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8005cd:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8005d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8005d5:	eb e5                	jmp    8005bc <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  8005d7:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8005da:	83 f8 2f             	cmp    $0x2f,%eax
+  8005dd:	77 5a                	ja     800639 <vprintfmt+0x1de>
+  8005df:	89 c2                	mov    %eax,%edx
+  8005e1:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8005e5:	83 c0 08             	add    $0x8,%eax
+  8005e8:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  8005eb:	8b 02                	mov    (%rdx),%eax
+  8005ed:	89 c1                	mov    %eax,%ecx
+  8005ef:	f7 d9                	neg    %ecx
+  8005f1:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  8005f4:	83 f9 16             	cmp    $0x16,%ecx
+  8005f7:	7f 4e                	jg     800647 <vprintfmt+0x1ec>
+  8005f9:	48 63 c1             	movslq %ecx,%rax
+  8005fc:	48 ba c0 4d 80 00 00 	movabs $0x804dc0,%rdx
+  800603:	00 00 00 
+  800606:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  80060a:	48 85 c0             	test   %rax,%rax
+  80060d:	74 38                	je     800647 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  80060f:	48 89 c1             	mov    %rax,%rcx
+  800612:	48 ba b9 4f 80 00 00 	movabs $0x804fb9,%rdx
+  800619:	00 00 00 
+  80061c:	4c 89 ee             	mov    %r13,%rsi
+  80061f:	4c 89 f7             	mov    %r14,%rdi
+  800622:	b8 00 00 00 00       	mov    $0x0,%eax
+  800627:	49 b8 1e 04 80 00 00 	movabs $0x80041e,%r8
+  80062e:	00 00 00 
+  800631:	41 ff d0             	call   *%r8
+  800634:	e9 53 fe ff ff       	jmp    80048c <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  800639:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80063d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800641:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800645:	eb a4                	jmp    8005eb <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  800647:	48 ba 74 49 80 00 00 	movabs $0x804974,%rdx
+  80064e:	00 00 00 
+  800651:	4c 89 ee             	mov    %r13,%rsi
+  800654:	4c 89 f7             	mov    %r14,%rdi
+  800657:	b8 00 00 00 00       	mov    $0x0,%eax
+  80065c:	49 b8 1e 04 80 00 00 	movabs $0x80041e,%r8
+  800663:	00 00 00 
+  800666:	41 ff d0             	call   *%r8
+  800669:	e9 1e fe ff ff       	jmp    80048c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80066e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800671:	83 f8 2f             	cmp    $0x2f,%eax
+  800674:	77 6c                	ja     8006e2 <vprintfmt+0x287>
+  800676:	89 c2                	mov    %eax,%edx
+  800678:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80067c:	83 c0 08             	add    $0x8,%eax
+  80067f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800682:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  800685:	48 85 d2             	test   %rdx,%rdx
+  800688:	48 b8 6d 49 80 00 00 	movabs $0x80496d,%rax
+  80068f:	00 00 00 
+  800692:	48 0f 45 c2          	cmovne %rdx,%rax
+  800696:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  80069a:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80069e:	7e 06                	jle    8006a6 <vprintfmt+0x24b>
+  8006a0:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  8006a4:	75 4a                	jne    8006f0 <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  8006a6:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8006aa:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  8006ae:	0f b6 00             	movzbl (%rax),%eax
+  8006b1:	84 c0                	test   %al,%al
+  8006b3:	0f 85 9a 00 00 00    	jne    800753 <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  8006b9:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8006bc:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  8006c0:	85 c0                	test   %eax,%eax
+  8006c2:	0f 8e c4 fd ff ff    	jle    80048c <vprintfmt+0x31>
+  8006c8:	4c 89 ee             	mov    %r13,%rsi
+  8006cb:	bf 20 00 00 00       	mov    $0x20,%edi
+  8006d0:	41 ff d6             	call   *%r14
+  8006d3:	41 83 ec 01          	sub    $0x1,%r12d
+  8006d7:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8006db:	75 eb                	jne    8006c8 <vprintfmt+0x26d>
+  8006dd:	e9 aa fd ff ff       	jmp    80048c <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8006e2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8006e6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8006ea:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8006ee:	eb 92                	jmp    800682 <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8006f0:	49 63 f7             	movslq %r15d,%rsi
+  8006f3:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8006f7:	48 b8 0d 0c 80 00 00 	movabs $0x800c0d,%rax
+  8006fe:	00 00 00 
+  800701:	ff d0                	call   *%rax
+  800703:	48 89 c2             	mov    %rax,%rdx
+  800706:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  800709:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  80070b:	8d 70 ff             	lea    -0x1(%rax),%esi
+  80070e:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  800711:	85 c0                	test   %eax,%eax
+  800713:	7e 91                	jle    8006a6 <vprintfmt+0x24b>
+  800715:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  80071a:	4c 89 ee             	mov    %r13,%rsi
+  80071d:	44 89 e7             	mov    %r12d,%edi
+  800720:	41 ff d6             	call   *%r14
+  800723:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800727:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  80072a:	83 f8 ff             	cmp    $0xffffffff,%eax
+  80072d:	75 eb                	jne    80071a <vprintfmt+0x2bf>
+  80072f:	e9 72 ff ff ff       	jmp    8006a6 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800734:	0f b6 f8             	movzbl %al,%edi
+  800737:	4c 89 ee             	mov    %r13,%rsi
+  80073a:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  80073d:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  800741:	49 83 c4 01          	add    $0x1,%r12
+  800745:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  80074b:	84 c0                	test   %al,%al
+  80074d:	0f 84 66 ff ff ff    	je     8006b9 <vprintfmt+0x25e>
+  800753:	45 85 ff             	test   %r15d,%r15d
+  800756:	78 0a                	js     800762 <vprintfmt+0x307>
+  800758:	41 83 ef 01          	sub    $0x1,%r15d
+  80075c:	0f 88 57 ff ff ff    	js     8006b9 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  800762:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  800766:	74 cc                	je     800734 <vprintfmt+0x2d9>
+  800768:	8d 50 e0             	lea    -0x20(%rax),%edx
+  80076b:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  800770:	80 fa 5e             	cmp    $0x5e,%dl
+  800773:	77 c2                	ja     800737 <vprintfmt+0x2dc>
+  800775:	eb bd                	jmp    800734 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  800777:	40 84 f6             	test   %sil,%sil
+  80077a:	75 26                	jne    8007a2 <vprintfmt+0x347>
+    switch (lflag) {
+  80077c:	85 d2                	test   %edx,%edx
+  80077e:	74 59                	je     8007d9 <vprintfmt+0x37e>
+  800780:	83 fa 01             	cmp    $0x1,%edx
+  800783:	74 7b                	je     800800 <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  800785:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800788:	83 f8 2f             	cmp    $0x2f,%eax
+  80078b:	0f 87 96 00 00 00    	ja     800827 <vprintfmt+0x3cc>
+  800791:	89 c2                	mov    %eax,%edx
+  800793:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800797:	83 c0 08             	add    $0x8,%eax
+  80079a:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80079d:	4c 8b 22             	mov    (%rdx),%r12
+  8007a0:	eb 17                	jmp    8007b9 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  8007a2:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007a5:	83 f8 2f             	cmp    $0x2f,%eax
+  8007a8:	77 21                	ja     8007cb <vprintfmt+0x370>
+  8007aa:	89 c2                	mov    %eax,%edx
+  8007ac:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007b0:	83 c0 08             	add    $0x8,%eax
+  8007b3:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007b6:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  8007b9:	4d 85 e4             	test   %r12,%r12
+  8007bc:	78 7a                	js     800838 <vprintfmt+0x3dd>
+            num = i;
+  8007be:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  8007c1:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  8007c6:	e9 50 02 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  8007cb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007cf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007d3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007d7:	eb dd                	jmp    8007b6 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8007d9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8007dc:	83 f8 2f             	cmp    $0x2f,%eax
+  8007df:	77 11                	ja     8007f2 <vprintfmt+0x397>
+  8007e1:	89 c2                	mov    %eax,%edx
+  8007e3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8007e7:	83 c0 08             	add    $0x8,%eax
+  8007ea:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8007ed:	4c 63 22             	movslq (%rdx),%r12
+  8007f0:	eb c7                	jmp    8007b9 <vprintfmt+0x35e>
+  8007f2:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8007f6:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8007fa:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8007fe:	eb ed                	jmp    8007ed <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  800800:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800803:	83 f8 2f             	cmp    $0x2f,%eax
+  800806:	77 11                	ja     800819 <vprintfmt+0x3be>
+  800808:	89 c2                	mov    %eax,%edx
+  80080a:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80080e:	83 c0 08             	add    $0x8,%eax
+  800811:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800814:	4c 8b 22             	mov    (%rdx),%r12
+  800817:	eb a0                	jmp    8007b9 <vprintfmt+0x35e>
+  800819:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80081d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800821:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800825:	eb ed                	jmp    800814 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  800827:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80082b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80082f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800833:	e9 65 ff ff ff       	jmp    80079d <vprintfmt+0x342>
+                putch('-', put_arg);
+  800838:	4c 89 ee             	mov    %r13,%rsi
+  80083b:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  800840:	41 ff d6             	call   *%r14
+                i = -i;
+  800843:	49 f7 dc             	neg    %r12
+  800846:	e9 73 ff ff ff       	jmp    8007be <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  80084b:	40 84 f6             	test   %sil,%sil
+  80084e:	75 32                	jne    800882 <vprintfmt+0x427>
+    switch (lflag) {
+  800850:	85 d2                	test   %edx,%edx
+  800852:	74 5d                	je     8008b1 <vprintfmt+0x456>
+  800854:	83 fa 01             	cmp    $0x1,%edx
+  800857:	0f 84 82 00 00 00    	je     8008df <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  80085d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800860:	83 f8 2f             	cmp    $0x2f,%eax
+  800863:	0f 87 a5 00 00 00    	ja     80090e <vprintfmt+0x4b3>
+  800869:	89 c2                	mov    %eax,%edx
+  80086b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80086f:	83 c0 08             	add    $0x8,%eax
+  800872:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800875:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800878:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  80087d:	e9 99 01 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800882:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800885:	83 f8 2f             	cmp    $0x2f,%eax
+  800888:	77 19                	ja     8008a3 <vprintfmt+0x448>
+  80088a:	89 c2                	mov    %eax,%edx
+  80088c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800890:	83 c0 08             	add    $0x8,%eax
+  800893:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800896:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  800899:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80089e:	e9 78 01 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+  8008a3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008a7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008ab:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008af:	eb e5                	jmp    800896 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  8008b1:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008b4:	83 f8 2f             	cmp    $0x2f,%eax
+  8008b7:	77 18                	ja     8008d1 <vprintfmt+0x476>
+  8008b9:	89 c2                	mov    %eax,%edx
+  8008bb:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008bf:	83 c0 08             	add    $0x8,%eax
+  8008c2:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008c5:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  8008c7:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  8008cc:	e9 4a 01 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+  8008d1:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8008d5:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8008d9:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8008dd:	eb e6                	jmp    8008c5 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8008df:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8008e2:	83 f8 2f             	cmp    $0x2f,%eax
+  8008e5:	77 19                	ja     800900 <vprintfmt+0x4a5>
+  8008e7:	89 c2                	mov    %eax,%edx
+  8008e9:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8008ed:	83 c0 08             	add    $0x8,%eax
+  8008f0:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8008f3:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8008f6:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8008fb:	e9 1b 01 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+  800900:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800904:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800908:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80090c:	eb e5                	jmp    8008f3 <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  80090e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800912:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80091a:	e9 56 ff ff ff       	jmp    800875 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  80091f:	40 84 f6             	test   %sil,%sil
+  800922:	75 2e                	jne    800952 <vprintfmt+0x4f7>
+    switch (lflag) {
+  800924:	85 d2                	test   %edx,%edx
+  800926:	74 59                	je     800981 <vprintfmt+0x526>
+  800928:	83 fa 01             	cmp    $0x1,%edx
+  80092b:	74 7f                	je     8009ac <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  80092d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800930:	83 f8 2f             	cmp    $0x2f,%eax
+  800933:	0f 87 9f 00 00 00    	ja     8009d8 <vprintfmt+0x57d>
+  800939:	89 c2                	mov    %eax,%edx
+  80093b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80093f:	83 c0 08             	add    $0x8,%eax
+  800942:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800945:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800948:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  80094d:	e9 c9 00 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800952:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800955:	83 f8 2f             	cmp    $0x2f,%eax
+  800958:	77 19                	ja     800973 <vprintfmt+0x518>
+  80095a:	89 c2                	mov    %eax,%edx
+  80095c:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800960:	83 c0 08             	add    $0x8,%eax
+  800963:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800966:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  800969:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80096e:	e9 a8 00 00 00       	jmp    800a1b <vprintfmt+0x5c0>
+  800973:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800977:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80097b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80097f:	eb e5                	jmp    800966 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  800981:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800984:	83 f8 2f             	cmp    $0x2f,%eax
+  800987:	77 15                	ja     80099e <vprintfmt+0x543>
+  800989:	89 c2                	mov    %eax,%edx
+  80098b:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80098f:	83 c0 08             	add    $0x8,%eax
+  800992:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800995:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  800997:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  80099c:	eb 7d                	jmp    800a1b <vprintfmt+0x5c0>
+  80099e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009a2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009a6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009aa:	eb e9                	jmp    800995 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  8009ac:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8009af:	83 f8 2f             	cmp    $0x2f,%eax
+  8009b2:	77 16                	ja     8009ca <vprintfmt+0x56f>
+  8009b4:	89 c2                	mov    %eax,%edx
+  8009b6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8009ba:	83 c0 08             	add    $0x8,%eax
+  8009bd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8009c0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  8009c3:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  8009c8:	eb 51                	jmp    800a1b <vprintfmt+0x5c0>
+  8009ca:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009ce:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009d2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009d6:	eb e8                	jmp    8009c0 <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8009d8:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8009dc:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8009e0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8009e4:	e9 5c ff ff ff       	jmp    800945 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8009e9:	4c 89 ee             	mov    %r13,%rsi
+  8009ec:	bf 30 00 00 00       	mov    $0x30,%edi
+  8009f1:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8009f4:	4c 89 ee             	mov    %r13,%rsi
+  8009f7:	bf 78 00 00 00       	mov    $0x78,%edi
+  8009fc:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8009ff:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a02:	83 f8 2f             	cmp    $0x2f,%eax
+  800a05:	77 47                	ja     800a4e <vprintfmt+0x5f3>
+  800a07:	89 c2                	mov    %eax,%edx
+  800a09:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a0d:	83 c0 08             	add    $0x8,%eax
+  800a10:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a13:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a16:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  800a1b:	48 83 ec 08          	sub    $0x8,%rsp
+  800a1f:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  800a23:	0f 94 c0             	sete   %al
+  800a26:	0f b6 c0             	movzbl %al,%eax
+  800a29:	50                   	push   %rax
+  800a2a:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  800a2f:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  800a33:	4c 89 ee             	mov    %r13,%rsi
+  800a36:	4c 89 f7             	mov    %r14,%rdi
+  800a39:	48 b8 50 03 80 00 00 	movabs $0x800350,%rax
+  800a40:	00 00 00 
+  800a43:	ff d0                	call   *%rax
+            break;
+  800a45:	48 83 c4 10          	add    $0x10,%rsp
+  800a49:	e9 3e fa ff ff       	jmp    80048c <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  800a4e:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800a52:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800a56:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800a5a:	eb b7                	jmp    800a13 <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  800a5c:	40 84 f6             	test   %sil,%sil
+  800a5f:	75 2b                	jne    800a8c <vprintfmt+0x631>
+    switch (lflag) {
+  800a61:	85 d2                	test   %edx,%edx
+  800a63:	74 56                	je     800abb <vprintfmt+0x660>
+  800a65:	83 fa 01             	cmp    $0x1,%edx
+  800a68:	74 7f                	je     800ae9 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  800a6a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a6d:	83 f8 2f             	cmp    $0x2f,%eax
+  800a70:	0f 87 a2 00 00 00    	ja     800b18 <vprintfmt+0x6bd>
+  800a76:	89 c2                	mov    %eax,%edx
+  800a78:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a7c:	83 c0 08             	add    $0x8,%eax
+  800a7f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800a82:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800a85:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  800a8a:	eb 8f                	jmp    800a1b <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  800a8c:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800a8f:	83 f8 2f             	cmp    $0x2f,%eax
+  800a92:	77 19                	ja     800aad <vprintfmt+0x652>
+  800a94:	89 c2                	mov    %eax,%edx
+  800a96:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800a9a:	83 c0 08             	add    $0x8,%eax
+  800a9d:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800aa0:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800aa3:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  800aa8:	e9 6e ff ff ff       	jmp    800a1b <vprintfmt+0x5c0>
+  800aad:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800ab1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ab5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ab9:	eb e5                	jmp    800aa0 <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  800abb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800abe:	83 f8 2f             	cmp    $0x2f,%eax
+  800ac1:	77 18                	ja     800adb <vprintfmt+0x680>
+  800ac3:	89 c2                	mov    %eax,%edx
+  800ac5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800ac9:	83 c0 08             	add    $0x8,%eax
+  800acc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800acf:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  800ad1:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  800ad6:	e9 40 ff ff ff       	jmp    800a1b <vprintfmt+0x5c0>
+  800adb:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800adf:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800ae3:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800ae7:	eb e6                	jmp    800acf <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  800ae9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800aec:	83 f8 2f             	cmp    $0x2f,%eax
+  800aef:	77 19                	ja     800b0a <vprintfmt+0x6af>
+  800af1:	89 c2                	mov    %eax,%edx
+  800af3:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800af7:	83 c0 08             	add    $0x8,%eax
+  800afa:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800afd:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  800b00:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  800b05:	e9 11 ff ff ff       	jmp    800a1b <vprintfmt+0x5c0>
+  800b0a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b0e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b12:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b16:	eb e5                	jmp    800afd <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  800b18:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800b1c:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800b20:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800b24:	e9 59 ff ff ff       	jmp    800a82 <vprintfmt+0x627>
+            putch(ch, put_arg);
+  800b29:	4c 89 ee             	mov    %r13,%rsi
+  800b2c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b31:	41 ff d6             	call   *%r14
+            break;
+  800b34:	e9 53 f9 ff ff       	jmp    80048c <vprintfmt+0x31>
+            putch('%', put_arg);
+  800b39:	4c 89 ee             	mov    %r13,%rsi
+  800b3c:	bf 25 00 00 00       	mov    $0x25,%edi
+  800b41:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  800b44:	48 83 eb 01          	sub    $0x1,%rbx
+  800b48:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  800b4c:	75 f6                	jne    800b44 <vprintfmt+0x6e9>
+  800b4e:	e9 39 f9 ff ff       	jmp    80048c <vprintfmt+0x31>
+}
+  800b53:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800b57:	5b                   	pop    %rbx
+  800b58:	41 5c                	pop    %r12
+  800b5a:	41 5d                	pop    %r13
+  800b5c:	41 5e                	pop    %r14
+  800b5e:	41 5f                	pop    %r15
+  800b60:	5d                   	pop    %rbp
+  800b61:	c3                   	ret
+
+0000000000800b62 <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  800b62:	55                   	push   %rbp
+  800b63:	48 89 e5             	mov    %rsp,%rbp
+  800b66:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  800b6a:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  800b6e:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  800b73:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  800b77:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  800b7e:	48 85 ff             	test   %rdi,%rdi
+  800b81:	74 2b                	je     800bae <vsnprintf+0x4c>
+  800b83:	48 85 f6             	test   %rsi,%rsi
+  800b86:	74 26                	je     800bae <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  800b88:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  800b8c:	48 bf 06 04 80 00 00 	movabs $0x800406,%rdi
+  800b93:	00 00 00 
+  800b96:	48 b8 5b 04 80 00 00 	movabs $0x80045b,%rax
+  800b9d:	00 00 00 
+  800ba0:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  800ba2:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  800ba6:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  800ba9:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  800bac:	c9                   	leave
+  800bad:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  800bae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  800bb3:	eb f7                	jmp    800bac <vsnprintf+0x4a>
+
+0000000000800bb5 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  800bb5:	55                   	push   %rbp
+  800bb6:	48 89 e5             	mov    %rsp,%rbp
+  800bb9:	48 83 ec 50          	sub    $0x50,%rsp
+  800bbd:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800bc1:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800bc5:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bc9:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800bd0:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bd4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800bd8:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800bdc:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  800be0:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800be4:	48 b8 62 0b 80 00 00 	movabs $0x800b62,%rax
+  800beb:	00 00 00 
+  800bee:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  800bf0:	c9                   	leave
+  800bf1:	c3                   	ret
+
+0000000000800bf2 <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  800bf2:	80 3f 00             	cmpb   $0x0,(%rdi)
+  800bf5:	74 10                	je     800c07 <strlen+0x15>
+    size_t n = 0;
+  800bf7:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  800bfc:	48 83 c0 01          	add    $0x1,%rax
+  800c00:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  800c04:	75 f6                	jne    800bfc <strlen+0xa>
+  800c06:	c3                   	ret
+    size_t n = 0;
+  800c07:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  800c0c:	c3                   	ret
+
+0000000000800c0d <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  800c0d:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  800c10:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  800c15:	48 85 f6             	test   %rsi,%rsi
+  800c18:	74 11                	je     800c2b <strnlen+0x1e>
+  800c1a:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  800c1e:	74 0c                	je     800c2c <strnlen+0x1f>
+  800c20:	48 83 c2 01          	add    $0x1,%rdx
+  800c24:	48 39 d0             	cmp    %rdx,%rax
+  800c27:	75 f1                	jne    800c1a <strnlen+0xd>
+  800c29:	eb 04                	jmp    800c2f <strnlen+0x22>
+  800c2b:	c3                   	ret
+  800c2c:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  800c2f:	c3                   	ret
+
+0000000000800c30 <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  800c30:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  800c33:	ba 00 00 00 00       	mov    $0x0,%edx
+  800c38:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  800c3c:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  800c3f:	48 83 c2 01          	add    $0x1,%rdx
+  800c43:	84 c9                	test   %cl,%cl
+  800c45:	75 f1                	jne    800c38 <strcpy+0x8>
+        ;
+    return res;
+}
+  800c47:	c3                   	ret
+
+0000000000800c48 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  800c48:	55                   	push   %rbp
+  800c49:	48 89 e5             	mov    %rsp,%rbp
+  800c4c:	41 54                	push   %r12
+  800c4e:	53                   	push   %rbx
+  800c4f:	48 89 fb             	mov    %rdi,%rbx
+  800c52:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  800c55:	48 b8 f2 0b 80 00 00 	movabs $0x800bf2,%rax
+  800c5c:	00 00 00 
+  800c5f:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  800c61:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  800c65:	4c 89 e6             	mov    %r12,%rsi
+  800c68:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  800c6f:	00 00 00 
+  800c72:	ff d0                	call   *%rax
+    return dst;
+}
+  800c74:	48 89 d8             	mov    %rbx,%rax
+  800c77:	5b                   	pop    %rbx
+  800c78:	41 5c                	pop    %r12
+  800c7a:	5d                   	pop    %rbp
+  800c7b:	c3                   	ret
+
+0000000000800c7c <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  800c7c:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  800c7f:	48 85 d2             	test   %rdx,%rdx
+  800c82:	74 1f                	je     800ca3 <strncpy+0x27>
+  800c84:	48 01 fa             	add    %rdi,%rdx
+  800c87:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  800c8a:	48 83 c1 01          	add    $0x1,%rcx
+  800c8e:	44 0f b6 06          	movzbl (%rsi),%r8d
+  800c92:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  800c96:	41 80 f8 01          	cmp    $0x1,%r8b
+  800c9a:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  800c9e:	48 39 ca             	cmp    %rcx,%rdx
+  800ca1:	75 e7                	jne    800c8a <strncpy+0xe>
+    }
+    return ret;
+}
+  800ca3:	c3                   	ret
+
+0000000000800ca4 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  800ca4:	48 89 f8             	mov    %rdi,%rax
+  800ca7:	48 85 d2             	test   %rdx,%rdx
+  800caa:	74 24                	je     800cd0 <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  800cac:	48 83 ea 01          	sub    $0x1,%rdx
+  800cb0:	74 1b                	je     800ccd <strlcpy+0x29>
+  800cb2:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  800cb6:	0f b6 16             	movzbl (%rsi),%edx
+  800cb9:	84 d2                	test   %dl,%dl
+  800cbb:	74 10                	je     800ccd <strlcpy+0x29>
+            *dst++ = *src++;
+  800cbd:	48 83 c6 01          	add    $0x1,%rsi
+  800cc1:	48 83 c0 01          	add    $0x1,%rax
+  800cc5:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  800cc8:	48 39 c8             	cmp    %rcx,%rax
+  800ccb:	75 e9                	jne    800cb6 <strlcpy+0x12>
+        *dst = '\0';
+  800ccd:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  800cd0:	48 29 f8             	sub    %rdi,%rax
+}
+  800cd3:	c3                   	ret
+
+0000000000800cd4 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  800cd4:	0f b6 07             	movzbl (%rdi),%eax
+  800cd7:	84 c0                	test   %al,%al
+  800cd9:	74 13                	je     800cee <strcmp+0x1a>
+  800cdb:	38 06                	cmp    %al,(%rsi)
+  800cdd:	75 0f                	jne    800cee <strcmp+0x1a>
+  800cdf:	48 83 c7 01          	add    $0x1,%rdi
+  800ce3:	48 83 c6 01          	add    $0x1,%rsi
+  800ce7:	0f b6 07             	movzbl (%rdi),%eax
+  800cea:	84 c0                	test   %al,%al
+  800cec:	75 ed                	jne    800cdb <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800cee:	0f b6 c0             	movzbl %al,%eax
+  800cf1:	0f b6 16             	movzbl (%rsi),%edx
+  800cf4:	29 d0                	sub    %edx,%eax
+}
+  800cf6:	c3                   	ret
+
+0000000000800cf7 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  800cf7:	48 85 d2             	test   %rdx,%rdx
+  800cfa:	74 1f                	je     800d1b <strncmp+0x24>
+  800cfc:	0f b6 07             	movzbl (%rdi),%eax
+  800cff:	84 c0                	test   %al,%al
+  800d01:	74 1e                	je     800d21 <strncmp+0x2a>
+  800d03:	3a 06                	cmp    (%rsi),%al
+  800d05:	75 1a                	jne    800d21 <strncmp+0x2a>
+  800d07:	48 83 c7 01          	add    $0x1,%rdi
+  800d0b:	48 83 c6 01          	add    $0x1,%rsi
+  800d0f:	48 83 ea 01          	sub    $0x1,%rdx
+  800d13:	75 e7                	jne    800cfc <strncmp+0x5>
+
+    if (!n) return 0;
+  800d15:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d1a:	c3                   	ret
+  800d1b:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d20:	c3                   	ret
+  800d21:	48 85 d2             	test   %rdx,%rdx
+  800d24:	74 09                	je     800d2f <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  800d26:	0f b6 07             	movzbl (%rdi),%eax
+  800d29:	0f b6 16             	movzbl (%rsi),%edx
+  800d2c:	29 d0                	sub    %edx,%eax
+  800d2e:	c3                   	ret
+    if (!n) return 0;
+  800d2f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800d34:	c3                   	ret
+
+0000000000800d35 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  800d35:	0f b6 17             	movzbl (%rdi),%edx
+  800d38:	84 d2                	test   %dl,%dl
+  800d3a:	74 18                	je     800d54 <strchr+0x1f>
+        if (*str == c) {
+  800d3c:	0f be d2             	movsbl %dl,%edx
+  800d3f:	39 f2                	cmp    %esi,%edx
+  800d41:	74 17                	je     800d5a <strchr+0x25>
+    for (; *str; str++) {
+  800d43:	48 83 c7 01          	add    $0x1,%rdi
+  800d47:	0f b6 17             	movzbl (%rdi),%edx
+  800d4a:	84 d2                	test   %dl,%dl
+  800d4c:	75 ee                	jne    800d3c <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  800d4e:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d53:	c3                   	ret
+  800d54:	b8 00 00 00 00       	mov    $0x0,%eax
+  800d59:	c3                   	ret
+  800d5a:	48 89 f8             	mov    %rdi,%rax
+}
+  800d5d:	c3                   	ret
+
+0000000000800d5e <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  800d5e:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  800d61:	0f b6 17             	movzbl (%rdi),%edx
+  800d64:	84 d2                	test   %dl,%dl
+  800d66:	74 13                	je     800d7b <strfind+0x1d>
+  800d68:	0f be d2             	movsbl %dl,%edx
+  800d6b:	39 f2                	cmp    %esi,%edx
+  800d6d:	74 0b                	je     800d7a <strfind+0x1c>
+  800d6f:	48 83 c0 01          	add    $0x1,%rax
+  800d73:	0f b6 10             	movzbl (%rax),%edx
+  800d76:	84 d2                	test   %dl,%dl
+  800d78:	75 ee                	jne    800d68 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  800d7a:	c3                   	ret
+  800d7b:	c3                   	ret
+
+0000000000800d7c <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  800d7c:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  800d7f:	48 89 f8             	mov    %rdi,%rax
+  800d82:	48 f7 d8             	neg    %rax
+  800d85:	83 e0 07             	and    $0x7,%eax
+  800d88:	49 89 d1             	mov    %rdx,%r9
+  800d8b:	49 29 c1             	sub    %rax,%r9
+  800d8e:	78 36                	js     800dc6 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  800d90:	40 0f b6 c6          	movzbl %sil,%eax
+  800d94:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  800d9b:	01 01 01 
+  800d9e:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  800da2:	40 f6 c7 07          	test   $0x7,%dil
+  800da6:	75 38                	jne    800de0 <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  800da8:	4c 89 c9             	mov    %r9,%rcx
+  800dab:	48 c1 f9 03          	sar    $0x3,%rcx
+  800daf:	74 0c                	je     800dbd <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  800db1:	fc                   	cld
+  800db2:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  800db5:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  800db9:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  800dbd:	4d 85 c9             	test   %r9,%r9
+  800dc0:	75 45                	jne    800e07 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  800dc2:	4c 89 c0             	mov    %r8,%rax
+  800dc5:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  800dc6:	48 85 d2             	test   %rdx,%rdx
+  800dc9:	74 f7                	je     800dc2 <memset+0x46>
+  800dcb:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  800dce:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  800dd1:	48 83 c0 01          	add    $0x1,%rax
+  800dd5:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  800dd9:	48 39 c2             	cmp    %rax,%rdx
+  800ddc:	75 f3                	jne    800dd1 <memset+0x55>
+  800dde:	eb e2                	jmp    800dc2 <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  800de0:	40 f6 c7 01          	test   $0x1,%dil
+  800de4:	74 06                	je     800dec <memset+0x70>
+  800de6:	88 07                	mov    %al,(%rdi)
+  800de8:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800dec:	40 f6 c7 02          	test   $0x2,%dil
+  800df0:	74 07                	je     800df9 <memset+0x7d>
+  800df2:	66 89 07             	mov    %ax,(%rdi)
+  800df5:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800df9:	40 f6 c7 04          	test   $0x4,%dil
+  800dfd:	74 a9                	je     800da8 <memset+0x2c>
+  800dff:	89 07                	mov    %eax,(%rdi)
+  800e01:	48 83 c7 04          	add    $0x4,%rdi
+  800e05:	eb a1                	jmp    800da8 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  800e07:	41 f6 c1 04          	test   $0x4,%r9b
+  800e0b:	74 06                	je     800e13 <memset+0x97>
+  800e0d:	89 07                	mov    %eax,(%rdi)
+  800e0f:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  800e13:	41 f6 c1 02          	test   $0x2,%r9b
+  800e17:	74 07                	je     800e20 <memset+0xa4>
+  800e19:	66 89 07             	mov    %ax,(%rdi)
+  800e1c:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  800e20:	41 f6 c1 01          	test   $0x1,%r9b
+  800e24:	74 9c                	je     800dc2 <memset+0x46>
+  800e26:	88 07                	mov    %al,(%rdi)
+  800e28:	eb 98                	jmp    800dc2 <memset+0x46>
+
+0000000000800e2a <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  800e2a:	48 89 f8             	mov    %rdi,%rax
+  800e2d:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  800e30:	48 39 fe             	cmp    %rdi,%rsi
+  800e33:	73 3b                	jae    800e70 <memmove+0x46>
+  800e35:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  800e39:	48 39 d7             	cmp    %rdx,%rdi
+  800e3c:	73 32                	jae    800e70 <memmove+0x46>
+        s += n;
+        d += n;
+  800e3e:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e42:	48 89 d6             	mov    %rdx,%rsi
+  800e45:	48 09 fe             	or     %rdi,%rsi
+  800e48:	48 09 ce             	or     %rcx,%rsi
+  800e4b:	40 f6 c6 07          	test   $0x7,%sil
+  800e4f:	75 12                	jne    800e63 <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  800e51:	48 83 ef 08          	sub    $0x8,%rdi
+  800e55:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  800e59:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e5d:	fd                   	std
+  800e5e:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  800e61:	fc                   	cld
+  800e62:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  800e63:	48 83 ef 01          	sub    $0x1,%rdi
+  800e67:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  800e6b:	fd                   	std
+  800e6c:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  800e6e:	eb f1                	jmp    800e61 <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  800e70:	48 89 f2             	mov    %rsi,%rdx
+  800e73:	48 09 c2             	or     %rax,%rdx
+  800e76:	48 09 ca             	or     %rcx,%rdx
+  800e79:	f6 c2 07             	test   $0x7,%dl
+  800e7c:	75 0c                	jne    800e8a <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  800e7e:	48 c1 e9 03          	shr    $0x3,%rcx
+  800e82:	48 89 c7             	mov    %rax,%rdi
+  800e85:	fc                   	cld
+  800e86:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  800e89:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  800e8a:	48 89 c7             	mov    %rax,%rdi
+  800e8d:	fc                   	cld
+  800e8e:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  800e90:	c3                   	ret
+
+0000000000800e91 <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  800e91:	55                   	push   %rbp
+  800e92:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  800e95:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  800e9c:	00 00 00 
+  800e9f:	ff d0                	call   *%rax
+}
+  800ea1:	5d                   	pop    %rbp
+  800ea2:	c3                   	ret
+
+0000000000800ea3 <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  800ea3:	55                   	push   %rbp
+  800ea4:	48 89 e5             	mov    %rsp,%rbp
+  800ea7:	41 57                	push   %r15
+  800ea9:	41 56                	push   %r14
+  800eab:	41 55                	push   %r13
+  800ead:	41 54                	push   %r12
+  800eaf:	53                   	push   %rbx
+  800eb0:	48 83 ec 08          	sub    $0x8,%rsp
+  800eb4:	49 89 fe             	mov    %rdi,%r14
+  800eb7:	49 89 f7             	mov    %rsi,%r15
+  800eba:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  800ebd:	48 89 f7             	mov    %rsi,%rdi
+  800ec0:	48 b8 f2 0b 80 00 00 	movabs $0x800bf2,%rax
+  800ec7:	00 00 00 
+  800eca:	ff d0                	call   *%rax
+  800ecc:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  800ecf:	48 89 de             	mov    %rbx,%rsi
+  800ed2:	4c 89 f7             	mov    %r14,%rdi
+  800ed5:	48 b8 0d 0c 80 00 00 	movabs $0x800c0d,%rax
+  800edc:	00 00 00 
+  800edf:	ff d0                	call   *%rax
+  800ee1:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  800ee4:	48 39 c3             	cmp    %rax,%rbx
+  800ee7:	74 36                	je     800f1f <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  800ee9:	48 89 d8             	mov    %rbx,%rax
+  800eec:	4c 29 e8             	sub    %r13,%rax
+  800eef:	49 39 c4             	cmp    %rax,%r12
+  800ef2:	73 31                	jae    800f25 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  800ef4:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  800ef9:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800efd:	4c 89 fe             	mov    %r15,%rsi
+  800f00:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  800f07:	00 00 00 
+  800f0a:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  800f0c:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  800f10:	48 83 c4 08          	add    $0x8,%rsp
+  800f14:	5b                   	pop    %rbx
+  800f15:	41 5c                	pop    %r12
+  800f17:	41 5d                	pop    %r13
+  800f19:	41 5e                	pop    %r14
+  800f1b:	41 5f                	pop    %r15
+  800f1d:	5d                   	pop    %rbp
+  800f1e:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  800f1f:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  800f23:	eb eb                	jmp    800f10 <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  800f25:	48 83 eb 01          	sub    $0x1,%rbx
+  800f29:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  800f2d:	48 89 da             	mov    %rbx,%rdx
+  800f30:	4c 89 fe             	mov    %r15,%rsi
+  800f33:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  800f3a:	00 00 00 
+  800f3d:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  800f3f:	49 01 de             	add    %rbx,%r14
+  800f42:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  800f47:	eb c3                	jmp    800f0c <strlcat+0x69>
+
+0000000000800f49 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  800f49:	48 85 d2             	test   %rdx,%rdx
+  800f4c:	74 2d                	je     800f7b <memcmp+0x32>
+  800f4e:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  800f53:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  800f57:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  800f5c:	44 38 c1             	cmp    %r8b,%cl
+  800f5f:	75 0f                	jne    800f70 <memcmp+0x27>
+    while (n-- > 0) {
+  800f61:	48 83 c0 01          	add    $0x1,%rax
+  800f65:	48 39 c2             	cmp    %rax,%rdx
+  800f68:	75 e9                	jne    800f53 <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  800f6a:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f6f:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  800f70:	0f b6 c1             	movzbl %cl,%eax
+  800f73:	45 0f b6 c0          	movzbl %r8b,%r8d
+  800f77:	44 29 c0             	sub    %r8d,%eax
+  800f7a:	c3                   	ret
+    return 0;
+  800f7b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800f80:	c3                   	ret
+
+0000000000800f81 <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  800f81:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  800f85:	48 39 c7             	cmp    %rax,%rdi
+  800f88:	73 0f                	jae    800f99 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  800f8a:	40 38 37             	cmp    %sil,(%rdi)
+  800f8d:	74 0e                	je     800f9d <memfind+0x1c>
+    for (; src < end; src++) {
+  800f8f:	48 83 c7 01          	add    $0x1,%rdi
+  800f93:	48 39 f8             	cmp    %rdi,%rax
+  800f96:	75 f2                	jne    800f8a <memfind+0x9>
+  800f98:	c3                   	ret
+  800f99:	48 89 f8             	mov    %rdi,%rax
+  800f9c:	c3                   	ret
+  800f9d:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  800fa0:	c3                   	ret
+
+0000000000800fa1 <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  800fa1:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  800fa4:	0f b6 37             	movzbl (%rdi),%esi
+  800fa7:	40 80 fe 20          	cmp    $0x20,%sil
+  800fab:	74 06                	je     800fb3 <strtol+0x12>
+  800fad:	40 80 fe 09          	cmp    $0x9,%sil
+  800fb1:	75 13                	jne    800fc6 <strtol+0x25>
+  800fb3:	48 83 c7 01          	add    $0x1,%rdi
+  800fb7:	0f b6 37             	movzbl (%rdi),%esi
+  800fba:	40 80 fe 20          	cmp    $0x20,%sil
+  800fbe:	74 f3                	je     800fb3 <strtol+0x12>
+  800fc0:	40 80 fe 09          	cmp    $0x9,%sil
+  800fc4:	74 ed                	je     800fb3 <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  800fc6:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  800fc9:	83 e0 fd             	and    $0xfffffffd,%eax
+  800fcc:	3c 01                	cmp    $0x1,%al
+  800fce:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800fd2:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  800fd8:	75 0f                	jne    800fe9 <strtol+0x48>
+  800fda:	80 3f 30             	cmpb   $0x30,(%rdi)
+  800fdd:	74 14                	je     800ff3 <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  800fdf:	85 d2                	test   %edx,%edx
+  800fe1:	b8 0a 00 00 00       	mov    $0xa,%eax
+  800fe6:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  800fe9:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  800fee:	4c 63 ca             	movslq %edx,%r9
+  800ff1:	eb 36                	jmp    801029 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  800ff3:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  800ff7:	74 0f                	je     801008 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  800ff9:	85 d2                	test   %edx,%edx
+  800ffb:	75 ec                	jne    800fe9 <strtol+0x48>
+        s++;
+  800ffd:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  801001:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  801006:	eb e1                	jmp    800fe9 <strtol+0x48>
+        s += 2;
+  801008:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  80100c:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  801011:	eb d6                	jmp    800fe9 <strtol+0x48>
+            dig -= '0';
+  801013:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  801016:	44 0f b6 c1          	movzbl %cl,%r8d
+  80101a:	41 39 d0             	cmp    %edx,%r8d
+  80101d:	7d 21                	jge    801040 <strtol+0x9f>
+        val = val * base + dig;
+  80101f:	49 0f af c1          	imul   %r9,%rax
+  801023:	0f b6 c9             	movzbl %cl,%ecx
+  801026:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  801029:	48 83 c7 01          	add    $0x1,%rdi
+  80102d:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  801031:	80 f9 39             	cmp    $0x39,%cl
+  801034:	76 dd                	jbe    801013 <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801036:	80 f9 7b             	cmp    $0x7b,%cl
+  801039:	77 05                	ja     801040 <strtol+0x9f>
+            dig -= 'a' - 10;
+  80103b:	83 e9 57             	sub    $0x57,%ecx
+  80103e:	eb d6                	jmp    801016 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801040:	4d 85 d2             	test   %r10,%r10
+  801043:	74 03                	je     801048 <strtol+0xa7>
+  801045:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801048:	48 89 c2             	mov    %rax,%rdx
+  80104b:	48 f7 da             	neg    %rdx
+  80104e:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801052:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801056:	c3                   	ret
+
+0000000000801057 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801057:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80105c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801061:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801067:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80106d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801073:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801075:	c3                   	ret
+
+0000000000801076 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801076:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80107b:	bf 00 00 00 00       	mov    $0x0,%edi
+  801080:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801085:	ba 00 00 00 00       	mov    $0x0,%edx
+  80108a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801090:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801096:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80109c:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  80109e:	c3                   	ret
+
+000000000080109f <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  80109f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8010a2:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8010a7:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8010ac:	ba 00 00 00 00       	mov    $0x0,%edx
+  8010b1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8010b7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8010bd:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8010c3:	0f 05                	syscall
+    if (check && ret > 0) {
+  8010c5:	48 85 c0             	test   %rax,%rax
+  8010c8:	7f 01                	jg     8010cb <sys_env_destroy+0x2c>
+}
+  8010ca:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  8010cb:	55                   	push   %rbp
+  8010cc:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8010cf:	49 89 c0             	mov    %rax,%r8
+  8010d2:	b9 03 00 00 00       	mov    $0x3,%ecx
+  8010d7:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8010de:	00 00 00 
+  8010e1:	be 29 00 00 00       	mov    $0x29,%esi
+  8010e6:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8010ed:	00 00 00 
+  8010f0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8010f5:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8010fc:	00 00 00 
+  8010ff:	41 ff d1             	call   *%r9
+
+0000000000801102 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801102:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801107:	bf 00 00 00 00       	mov    $0x0,%edi
+  80110c:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801111:	ba 00 00 00 00       	mov    $0x0,%edx
+  801116:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80111c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801122:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801128:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  80112a:	c3                   	ret
+
+000000000080112b <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  80112b:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801130:	bf 00 00 00 00       	mov    $0x0,%edi
+  801135:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80113a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80113f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801145:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80114b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801151:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801153:	c3                   	ret
+
+0000000000801154 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801154:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801159:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801160:	00 00 00 
+  801163:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801169:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80116f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801175:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801177:	c3                   	ret
+
+0000000000801178 <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801178:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  80117b:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801180:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801186:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80118c:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  80118e:	c3                   	ret
+
+000000000080118f <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  80118f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801192:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801197:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80119a:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8011a0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8011a6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011a8:	48 85 c0             	test   %rax,%rax
+  8011ab:	7f 01                	jg     8011ae <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  8011ad:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  8011ae:	55                   	push   %rbp
+  8011af:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8011b2:	49 89 c0             	mov    %rax,%r8
+  8011b5:	b9 04 00 00 00       	mov    $0x4,%ecx
+  8011ba:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8011c1:	00 00 00 
+  8011c4:	be 29 00 00 00       	mov    $0x29,%esi
+  8011c9:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8011d0:	00 00 00 
+  8011d3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8011d8:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8011df:	00 00 00 
+  8011e2:	41 ff d1             	call   *%r9
+
+00000000008011e5 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011e5:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  8011e8:	48 63 d2             	movslq %edx,%rdx
+  8011eb:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8011ee:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8011f3:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  8011f6:	0f 05                	syscall
+    if (check && ret > 0) {
+  8011f8:	48 85 c0             	test   %rax,%rax
+  8011fb:	7f 01                	jg     8011fe <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  8011fd:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  8011fe:	55                   	push   %rbp
+  8011ff:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801202:	49 89 c0             	mov    %rax,%r8
+  801205:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80120a:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801211:	00 00 00 
+  801214:	be 29 00 00 00       	mov    $0x29,%esi
+  801219:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801220:	00 00 00 
+  801223:	b8 00 00 00 00       	mov    $0x0,%eax
+  801228:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  80122f:	00 00 00 
+  801232:	41 ff d1             	call   *%r9
+
+0000000000801235 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  801235:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801238:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80123d:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801243:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801249:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80124f:	0f 05                	syscall
+    if (check && ret > 0) {
+  801251:	48 85 c0             	test   %rax,%rax
+  801254:	7f 01                	jg     801257 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  801256:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  801257:	55                   	push   %rbp
+  801258:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80125b:	49 89 c0             	mov    %rax,%r8
+  80125e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  801263:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80126a:	00 00 00 
+  80126d:	be 29 00 00 00       	mov    $0x29,%esi
+  801272:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801279:	00 00 00 
+  80127c:	b8 00 00 00 00       	mov    $0x0,%eax
+  801281:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  801288:	00 00 00 
+  80128b:	41 ff d1             	call   *%r9
+
+000000000080128e <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  80128e:	48 63 f6             	movslq %esi,%rsi
+  801291:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801294:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801299:	ba 00 00 00 00       	mov    $0x0,%edx
+  80129e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8012a4:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8012aa:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8012b0:	0f 05                	syscall
+    if (check && ret > 0) {
+  8012b2:	48 85 c0             	test   %rax,%rax
+  8012b5:	7f 01                	jg     8012b8 <sys_env_set_status+0x2a>
+}
+  8012b7:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8012b8:	55                   	push   %rbp
+  8012b9:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8012bc:	49 89 c0             	mov    %rax,%r8
+  8012bf:	b9 09 00 00 00       	mov    $0x9,%ecx
+  8012c4:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8012cb:	00 00 00 
+  8012ce:	be 29 00 00 00       	mov    $0x29,%esi
+  8012d3:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8012da:	00 00 00 
+  8012dd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8012e2:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8012e9:	00 00 00 
+  8012ec:	41 ff d1             	call   *%r9
+
+00000000008012ef <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  8012ef:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8012f2:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8012f7:	ba 00 00 00 00       	mov    $0x0,%edx
+  8012fc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801302:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801308:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80130e:	0f 05                	syscall
+    if (check && ret > 0) {
+  801310:	48 85 c0             	test   %rax,%rax
+  801313:	7f 01                	jg     801316 <sys_env_set_trapframe+0x27>
+}
+  801315:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  801316:	55                   	push   %rbp
+  801317:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80131a:	49 89 c0             	mov    %rax,%r8
+  80131d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  801322:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801329:	00 00 00 
+  80132c:	be 29 00 00 00       	mov    $0x29,%esi
+  801331:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801338:	00 00 00 
+  80133b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801340:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  801347:	00 00 00 
+  80134a:	41 ff d1             	call   *%r9
+
+000000000080134d <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80134d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801350:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801355:	ba 00 00 00 00       	mov    $0x0,%edx
+  80135a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801360:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801366:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80136c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80136e:	48 85 c0             	test   %rax,%rax
+  801371:	7f 01                	jg     801374 <sys_env_set_pgfault_upcall+0x27>
+}
+  801373:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  801374:	55                   	push   %rbp
+  801375:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801378:	49 89 c0             	mov    %rax,%r8
+  80137b:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  801380:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801387:	00 00 00 
+  80138a:	be 29 00 00 00       	mov    $0x29,%esi
+  80138f:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801396:	00 00 00 
+  801399:	b8 00 00 00 00       	mov    $0x0,%eax
+  80139e:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8013a5:	00 00 00 
+  8013a8:	41 ff d1             	call   *%r9
+
+00000000008013ab <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013ab:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013ae:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013b1:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013b6:	4d 63 c0             	movslq %r8d,%r8
+  8013b9:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013bf:	0f 05                	syscall
+}
+  8013c1:	c3                   	ret
+
+00000000008013c2 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8013c2:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8013c5:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8013c8:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013cd:	4d 63 c0             	movslq %r8d,%r8
+  8013d0:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013d6:	0f 05                	syscall
+}
+  8013d8:	c3                   	ret
+
+00000000008013d9 <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  8013d9:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8013de:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8013e1:	45 89 c0             	mov    %r8d,%r8d
+  8013e4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8013ea:	0f 05                	syscall
+    if (check && ret > 0) {
+  8013ec:	48 85 c0             	test   %rax,%rax
+  8013ef:	7f 01                	jg     8013f2 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  8013f1:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  8013f2:	55                   	push   %rbp
+  8013f3:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8013f6:	49 89 c0             	mov    %rax,%r8
+  8013f9:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  8013fe:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  801405:	00 00 00 
+  801408:	be 29 00 00 00       	mov    $0x29,%esi
+  80140d:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  801414:	00 00 00 
+  801417:	b8 00 00 00 00       	mov    $0x0,%eax
+  80141c:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  801423:	00 00 00 
+  801426:	41 ff d1             	call   *%r9
+
+0000000000801429 <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  801429:	55                   	push   %rbp
+  80142a:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80142d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801433:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801438:	ba 00 00 00 00       	mov    $0x0,%edx
+  80143d:	48 b8 d9 13 80 00 00 	movabs $0x8013d9,%rax
+  801444:	00 00 00 
+  801447:	ff d0                	call   *%rax
+}
+  801449:	5d                   	pop    %rbp
+  80144a:	c3                   	ret
+
+000000000080144b <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80144b:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801450:	bf 00 00 00 00       	mov    $0x0,%edi
+  801455:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80145a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80145f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801465:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80146b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801471:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  801473:	c3                   	ret
+
+0000000000801474 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  801474:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801479:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80147e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801483:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801489:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80148f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801495:	0f 05                	syscall
+    if (check && ret > 0) {
+  801497:	48 85 c0             	test   %rax,%rax
+  80149a:	7f 01                	jg     80149d <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  80149c:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  80149d:	55                   	push   %rbp
+  80149e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8014a1:	49 89 c0             	mov    %rax,%r8
+  8014a4:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8014a9:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  8014b0:	00 00 00 
+  8014b3:	be 29 00 00 00       	mov    $0x29,%esi
+  8014b8:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8014bf:	00 00 00 
+  8014c2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8014c7:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8014ce:	00 00 00 
+  8014d1:	41 ff d1             	call   *%r9
+
+00000000008014d4 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  8014d4:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8014d9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8014de:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8014e3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8014e8:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8014ee:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8014f4:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8014fa:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  8014fc:	c3                   	ret
+
+00000000008014fd <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  8014fd:	89 d2                	mov    %edx,%edx
+  8014ff:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  801501:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801506:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80150c:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801512:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801518:	0f 05                	syscall
+}
+  80151a:	c3                   	ret
+
+000000000080151b <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80151b:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  80151e:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801523:	ba 00 00 00 00       	mov    $0x0,%edx
+  801528:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80152e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801534:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80153a:	0f 05                	syscall
+}
+  80153c:	c3                   	ret
+
+000000000080153d <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80153d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  801540:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801545:	ba 00 00 00 00       	mov    $0x0,%edx
+  80154a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801550:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801556:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80155c:	0f 05                	syscall
+}
+  80155e:	c3                   	ret
+
+000000000080155f <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  80155f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801562:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801567:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80156c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801571:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801577:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80157d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801583:	0f 05                	syscall
+    if (check && ret > 0) {
+  801585:	48 85 c0             	test   %rax,%rax
+  801588:	7f 01                	jg     80158b <sys_irq_ack+0x2c>
+}
+  80158a:	c3                   	ret
+sys_irq_ack(int irq) {
+  80158b:	55                   	push   %rbp
+  80158c:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80158f:	49 89 c0             	mov    %rax,%r8
+  801592:	b9 16 00 00 00       	mov    $0x16,%ecx
+  801597:	48 ba 98 4e 80 00 00 	movabs $0x804e98,%rdx
+  80159e:	00 00 00 
+  8015a1:	be 29 00 00 00       	mov    $0x29,%esi
+  8015a6:	48 bf b7 4e 80 00 00 	movabs $0x804eb7,%rdi
+  8015ad:	00 00 00 
+  8015b0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8015b5:	49 b9 cd 43 80 00 00 	movabs $0x8043cd,%r9
+  8015bc:	00 00 00 
+  8015bf:	41 ff d1             	call   *%r9
+
+00000000008015c2 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  8015c2:	55                   	push   %rbp
+  8015c3:	48 89 e5             	mov    %rsp,%rbp
+  8015c6:	41 54                	push   %r12
+  8015c8:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  8015c9:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  8015d0:	00 00 00 
+  8015d3:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  8015d5:	b8 08 00 00 00       	mov    $0x8,%eax
+  8015da:	0f 05                	syscall
+  8015dc:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  8015df:	85 c0                	test   %eax,%eax
+  8015e1:	78 7e                	js     801661 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  8015e3:	0f 84 80 00 00 00    	je     801669 <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  8015e9:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  8015ef:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  8015f6:	00 00 00 
+  8015f9:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8015fe:	89 c2                	mov    %eax,%edx
+  801600:	be 00 00 00 00       	mov    $0x0,%esi
+  801605:	bf 00 00 00 00       	mov    $0x0,%edi
+  80160a:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  801611:	00 00 00 
+  801614:	ff d0                	call   *%rax
+  801616:	85 c0                	test   %eax,%eax
+  801618:	0f 88 86 00 00 00    	js     8016a4 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  80161e:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801625:	00 00 00 
+  801628:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  80162f:	44 89 e7             	mov    %r12d,%edi
+  801632:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  801639:	00 00 00 
+  80163c:	ff d0                	call   *%rax
+  80163e:	85 c0                	test   %eax,%eax
+  801640:	78 6a                	js     8016ac <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  801642:	be 02 00 00 00       	mov    $0x2,%esi
+  801647:	44 89 e7             	mov    %r12d,%edi
+  80164a:	48 b8 8e 12 80 00 00 	movabs $0x80128e,%rax
+  801651:	00 00 00 
+  801654:	ff d0                	call   *%rax
+		return -1;
+  801656:	85 c0                	test   %eax,%eax
+  801658:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80165d:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  801661:	44 89 e0             	mov    %r12d,%eax
+  801664:	5b                   	pop    %rbx
+  801665:	41 5c                	pop    %r12
+  801667:	5d                   	pop    %rbp
+  801668:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  801669:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  801670:	00 00 00 
+  801673:	ff d0                	call   *%rax
+  801675:	89 c2                	mov    %eax,%edx
+  801677:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  80167d:	48 89 d0             	mov    %rdx,%rax
+  801680:	48 c1 e0 04          	shl    $0x4,%rax
+  801684:	48 29 d0             	sub    %rdx,%rax
+  801687:	48 c1 e0 05          	shl    $0x5,%rax
+  80168b:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  801692:	00 00 00 
+  801695:	48 01 d0             	add    %rdx,%rax
+  801698:	48 a3 a0 0f 81 00 00 	movabs %rax,0x810fa0
+  80169f:	00 00 00 
+        return 0;
+  8016a2:	eb bd                	jmp    801661 <fork+0x9f>
+		return -1;
+  8016a4:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016aa:	eb b5                	jmp    801661 <fork+0x9f>
+		return -1;
+  8016ac:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8016b2:	eb ad                	jmp    801661 <fork+0x9f>
+
+00000000008016b4 <sfork>:
+
+envid_t
+sfork() {
+  8016b4:	55                   	push   %rbp
+  8016b5:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8016b8:	48 ba c5 4e 80 00 00 	movabs $0x804ec5,%rdx
+  8016bf:	00 00 00 
+  8016c2:	be 2d 00 00 00       	mov    $0x2d,%esi
+  8016c7:	48 bf e0 4e 80 00 00 	movabs $0x804ee0,%rdi
+  8016ce:	00 00 00 
+  8016d1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016d6:	48 b9 cd 43 80 00 00 	movabs $0x8043cd,%rcx
+  8016dd:	00 00 00 
+  8016e0:	ff d1                	call   *%rcx
+
+00000000008016e2 <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016e2:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016e9:	ff ff ff 
+  8016ec:	48 01 f8             	add    %rdi,%rax
+  8016ef:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8016f3:	c3                   	ret
+
+00000000008016f4 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8016f4:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8016fb:	ff ff ff 
+  8016fe:	48 01 f8             	add    %rdi,%rax
+  801701:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  801705:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  80170b:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  80170f:	c3                   	ret
+
+0000000000801710 <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  801710:	55                   	push   %rbp
+  801711:	48 89 e5             	mov    %rsp,%rbp
+  801714:	41 57                	push   %r15
+  801716:	41 56                	push   %r14
+  801718:	41 55                	push   %r13
+  80171a:	41 54                	push   %r12
+  80171c:	53                   	push   %rbx
+  80171d:	48 83 ec 08          	sub    $0x8,%rsp
+  801721:	49 89 ff             	mov    %rdi,%r15
+  801724:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  801729:	49 bd 9f 3e 80 00 00 	movabs $0x803e9f,%r13
+  801730:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  801733:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  801739:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  80173c:	48 89 df             	mov    %rbx,%rdi
+  80173f:	41 ff d5             	call   *%r13
+  801742:	83 e0 04             	and    $0x4,%eax
+  801745:	74 17                	je     80175e <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  801747:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80174e:	4c 39 f3             	cmp    %r14,%rbx
+  801751:	75 e6                	jne    801739 <fd_alloc+0x29>
+  801753:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  801759:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80175e:	4d 89 27             	mov    %r12,(%r15)
+}
+  801761:	48 83 c4 08          	add    $0x8,%rsp
+  801765:	5b                   	pop    %rbx
+  801766:	41 5c                	pop    %r12
+  801768:	41 5d                	pop    %r13
+  80176a:	41 5e                	pop    %r14
+  80176c:	41 5f                	pop    %r15
+  80176e:	5d                   	pop    %rbp
+  80176f:	c3                   	ret
+
+0000000000801770 <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  801770:	83 ff 1f             	cmp    $0x1f,%edi
+  801773:	77 39                	ja     8017ae <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  801775:	55                   	push   %rbp
+  801776:	48 89 e5             	mov    %rsp,%rbp
+  801779:	41 54                	push   %r12
+  80177b:	53                   	push   %rbx
+  80177c:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80177f:	48 63 df             	movslq %edi,%rbx
+  801782:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  801789:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  80178d:	48 89 df             	mov    %rbx,%rdi
+  801790:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  801797:	00 00 00 
+  80179a:	ff d0                	call   *%rax
+  80179c:	a8 04                	test   $0x4,%al
+  80179e:	74 14                	je     8017b4 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  8017a0:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  8017a4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8017a9:	5b                   	pop    %rbx
+  8017aa:	41 5c                	pop    %r12
+  8017ac:	5d                   	pop    %rbp
+  8017ad:	c3                   	ret
+        return -E_INVAL;
+  8017ae:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  8017b3:	c3                   	ret
+        return -E_INVAL;
+  8017b4:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8017b9:	eb ee                	jmp    8017a9 <fd_lookup+0x39>
+
+00000000008017bb <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  8017bb:	55                   	push   %rbp
+  8017bc:	48 89 e5             	mov    %rsp,%rbp
+  8017bf:	41 54                	push   %r12
+  8017c1:	53                   	push   %rbx
+  8017c2:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  8017c5:	48 b8 80 4f 80 00 00 	movabs $0x804f80,%rax
+  8017cc:	00 00 00 
+  8017cf:	48 bb 20 60 80 00 00 	movabs $0x806020,%rbx
+  8017d6:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  8017d9:	39 3b                	cmp    %edi,(%rbx)
+  8017db:	74 47                	je     801824 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  8017dd:	48 83 c0 08          	add    $0x8,%rax
+  8017e1:	48 8b 18             	mov    (%rax),%rbx
+  8017e4:	48 85 db             	test   %rbx,%rbx
+  8017e7:	75 f0                	jne    8017d9 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8017e9:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  8017f0:	00 00 00 
+  8017f3:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8017f9:	89 fa                	mov    %edi,%edx
+  8017fb:	48 bf f0 4e 80 00 00 	movabs $0x804ef0,%rdi
+  801802:	00 00 00 
+  801805:	b8 00 00 00 00       	mov    $0x0,%eax
+  80180a:	48 b9 0b 03 80 00 00 	movabs $0x80030b,%rcx
+  801811:	00 00 00 
+  801814:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  801816:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  80181b:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  80181f:	5b                   	pop    %rbx
+  801820:	41 5c                	pop    %r12
+  801822:	5d                   	pop    %rbp
+  801823:	c3                   	ret
+            return 0;
+  801824:	b8 00 00 00 00       	mov    $0x0,%eax
+  801829:	eb f0                	jmp    80181b <dev_lookup+0x60>
+
+000000000080182b <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  80182b:	55                   	push   %rbp
+  80182c:	48 89 e5             	mov    %rsp,%rbp
+  80182f:	41 55                	push   %r13
+  801831:	41 54                	push   %r12
+  801833:	53                   	push   %rbx
+  801834:	48 83 ec 18          	sub    $0x18,%rsp
+  801838:	48 89 fb             	mov    %rdi,%rbx
+  80183b:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80183e:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  801845:	ff ff ff 
+  801848:	48 01 df             	add    %rbx,%rdi
+  80184b:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80184f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801853:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  80185a:	00 00 00 
+  80185d:	ff d0                	call   *%rax
+  80185f:	41 89 c5             	mov    %eax,%r13d
+  801862:	85 c0                	test   %eax,%eax
+  801864:	78 06                	js     80186c <fd_close+0x41>
+  801866:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  80186a:	74 1a                	je     801886 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  80186c:	45 84 e4             	test   %r12b,%r12b
+  80186f:	b8 00 00 00 00       	mov    $0x0,%eax
+  801874:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  801878:	44 89 e8             	mov    %r13d,%eax
+  80187b:	48 83 c4 18          	add    $0x18,%rsp
+  80187f:	5b                   	pop    %rbx
+  801880:	41 5c                	pop    %r12
+  801882:	41 5d                	pop    %r13
+  801884:	5d                   	pop    %rbp
+  801885:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  801886:	8b 3b                	mov    (%rbx),%edi
+  801888:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  80188c:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+  801898:	41 89 c5             	mov    %eax,%r13d
+  80189b:	85 c0                	test   %eax,%eax
+  80189d:	78 1b                	js     8018ba <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80189f:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  8018a3:	48 8b 40 20          	mov    0x20(%rax),%rax
+  8018a7:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8018ad:	48 85 c0             	test   %rax,%rax
+  8018b0:	74 08                	je     8018ba <fd_close+0x8f>
+  8018b2:	48 89 df             	mov    %rbx,%rdi
+  8018b5:	ff d0                	call   *%rax
+  8018b7:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8018ba:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8018bf:	48 89 de             	mov    %rbx,%rsi
+  8018c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8018c7:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  8018ce:	00 00 00 
+  8018d1:	ff d0                	call   *%rax
+    return res;
+  8018d3:	eb a3                	jmp    801878 <fd_close+0x4d>
+
+00000000008018d5 <close>:
+
+int
+close(int fdnum) {
+  8018d5:	55                   	push   %rbp
+  8018d6:	48 89 e5             	mov    %rsp,%rbp
+  8018d9:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  8018dd:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8018e1:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  8018e8:	00 00 00 
+  8018eb:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8018ed:	85 c0                	test   %eax,%eax
+  8018ef:	78 15                	js     801906 <close+0x31>
+
+    return fd_close(fd, 1);
+  8018f1:	be 01 00 00 00       	mov    $0x1,%esi
+  8018f6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8018fa:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  801901:	00 00 00 
+  801904:	ff d0                	call   *%rax
+}
+  801906:	c9                   	leave
+  801907:	c3                   	ret
+
+0000000000801908 <close_all>:
+
+void
+close_all(void) {
+  801908:	55                   	push   %rbp
+  801909:	48 89 e5             	mov    %rsp,%rbp
+  80190c:	41 54                	push   %r12
+  80190e:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  80190f:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801914:	49 bc d5 18 80 00 00 	movabs $0x8018d5,%r12
+  80191b:	00 00 00 
+  80191e:	89 df                	mov    %ebx,%edi
+  801920:	41 ff d4             	call   *%r12
+  801923:	83 c3 01             	add    $0x1,%ebx
+  801926:	83 fb 20             	cmp    $0x20,%ebx
+  801929:	75 f3                	jne    80191e <close_all+0x16>
+}
+  80192b:	5b                   	pop    %rbx
+  80192c:	41 5c                	pop    %r12
+  80192e:	5d                   	pop    %rbp
+  80192f:	c3                   	ret
+
+0000000000801930 <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  801930:	55                   	push   %rbp
+  801931:	48 89 e5             	mov    %rsp,%rbp
+  801934:	41 57                	push   %r15
+  801936:	41 56                	push   %r14
+  801938:	41 55                	push   %r13
+  80193a:	41 54                	push   %r12
+  80193c:	53                   	push   %rbx
+  80193d:	48 83 ec 18          	sub    $0x18,%rsp
+  801941:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  801944:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  801948:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  80194f:	00 00 00 
+  801952:	ff d0                	call   *%rax
+  801954:	89 c3                	mov    %eax,%ebx
+  801956:	85 c0                	test   %eax,%eax
+  801958:	0f 88 b8 00 00 00    	js     801a16 <dup+0xe6>
+    close(newfdnum);
+  80195e:	44 89 e7             	mov    %r12d,%edi
+  801961:	48 b8 d5 18 80 00 00 	movabs $0x8018d5,%rax
+  801968:	00 00 00 
+  80196b:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  80196d:	4d 63 ec             	movslq %r12d,%r13
+  801970:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  801977:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  80197b:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80197f:	4c 89 ff             	mov    %r15,%rdi
+  801982:	49 be f4 16 80 00 00 	movabs $0x8016f4,%r14
+  801989:	00 00 00 
+  80198c:	41 ff d6             	call   *%r14
+  80198f:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  801992:	4c 89 ef             	mov    %r13,%rdi
+  801995:	41 ff d6             	call   *%r14
+  801998:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  80199b:	48 89 df             	mov    %rbx,%rdi
+  80199e:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  8019a5:	00 00 00 
+  8019a8:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  8019aa:	a8 04                	test   $0x4,%al
+  8019ac:	74 2b                	je     8019d9 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  8019ae:	41 89 c1             	mov    %eax,%r9d
+  8019b1:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019b7:	4c 89 f1             	mov    %r14,%rcx
+  8019ba:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019bf:	48 89 de             	mov    %rbx,%rsi
+  8019c2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8019c7:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  8019ce:	00 00 00 
+  8019d1:	ff d0                	call   *%rax
+  8019d3:	89 c3                	mov    %eax,%ebx
+  8019d5:	85 c0                	test   %eax,%eax
+  8019d7:	78 4e                	js     801a27 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  8019d9:	4c 89 ff             	mov    %r15,%rdi
+  8019dc:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  8019e3:	00 00 00 
+  8019e6:	ff d0                	call   *%rax
+  8019e8:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8019eb:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8019f1:	4c 89 e9             	mov    %r13,%rcx
+  8019f4:	ba 00 00 00 00       	mov    $0x0,%edx
+  8019f9:	4c 89 fe             	mov    %r15,%rsi
+  8019fc:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a01:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  801a08:	00 00 00 
+  801a0b:	ff d0                	call   *%rax
+  801a0d:	89 c3                	mov    %eax,%ebx
+  801a0f:	85 c0                	test   %eax,%eax
+  801a11:	78 14                	js     801a27 <dup+0xf7>
+
+    return newfdnum;
+  801a13:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  801a16:	89 d8                	mov    %ebx,%eax
+  801a18:	48 83 c4 18          	add    $0x18,%rsp
+  801a1c:	5b                   	pop    %rbx
+  801a1d:	41 5c                	pop    %r12
+  801a1f:	41 5d                	pop    %r13
+  801a21:	41 5e                	pop    %r14
+  801a23:	41 5f                	pop    %r15
+  801a25:	5d                   	pop    %rbp
+  801a26:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  801a27:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a2c:	4c 89 ee             	mov    %r13,%rsi
+  801a2f:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a34:	49 bc 35 12 80 00 00 	movabs $0x801235,%r12
+  801a3b:	00 00 00 
+  801a3e:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  801a41:	ba 00 10 00 00       	mov    $0x1000,%edx
+  801a46:	4c 89 f6             	mov    %r14,%rsi
+  801a49:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a4e:	41 ff d4             	call   *%r12
+    return res;
+  801a51:	eb c3                	jmp    801a16 <dup+0xe6>
+
+0000000000801a53 <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  801a53:	55                   	push   %rbp
+  801a54:	48 89 e5             	mov    %rsp,%rbp
+  801a57:	41 56                	push   %r14
+  801a59:	41 55                	push   %r13
+  801a5b:	41 54                	push   %r12
+  801a5d:	53                   	push   %rbx
+  801a5e:	48 83 ec 10          	sub    $0x10,%rsp
+  801a62:	89 fb                	mov    %edi,%ebx
+  801a64:	49 89 f4             	mov    %rsi,%r12
+  801a67:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801a6a:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801a6e:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  801a75:	00 00 00 
+  801a78:	ff d0                	call   *%rax
+  801a7a:	85 c0                	test   %eax,%eax
+  801a7c:	78 4c                	js     801aca <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801a7e:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801a82:	41 8b 3e             	mov    (%r14),%edi
+  801a85:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801a89:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801a90:	00 00 00 
+  801a93:	ff d0                	call   *%rax
+  801a95:	85 c0                	test   %eax,%eax
+  801a97:	78 35                	js     801ace <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  801a99:	41 8b 46 08          	mov    0x8(%r14),%eax
+  801a9d:	83 e0 03             	and    $0x3,%eax
+  801aa0:	83 f8 01             	cmp    $0x1,%eax
+  801aa3:	74 2d                	je     801ad2 <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801aa5:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801aa9:	48 8b 40 10          	mov    0x10(%rax),%rax
+  801aad:	48 85 c0             	test   %rax,%rax
+  801ab0:	74 56                	je     801b08 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  801ab2:	4c 89 ea             	mov    %r13,%rdx
+  801ab5:	4c 89 e6             	mov    %r12,%rsi
+  801ab8:	4c 89 f7             	mov    %r14,%rdi
+  801abb:	ff d0                	call   *%rax
+}
+  801abd:	48 83 c4 10          	add    $0x10,%rsp
+  801ac1:	5b                   	pop    %rbx
+  801ac2:	41 5c                	pop    %r12
+  801ac4:	41 5d                	pop    %r13
+  801ac6:	41 5e                	pop    %r14
+  801ac8:	5d                   	pop    %rbp
+  801ac9:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801aca:	48 98                	cltq
+  801acc:	eb ef                	jmp    801abd <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801ace:	48 98                	cltq
+  801ad0:	eb eb                	jmp    801abd <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  801ad2:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801ad9:	00 00 00 
+  801adc:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801ae2:	89 da                	mov    %ebx,%edx
+  801ae4:	48 bf 31 4f 80 00 00 	movabs $0x804f31,%rdi
+  801aeb:	00 00 00 
+  801aee:	b8 00 00 00 00       	mov    $0x0,%eax
+  801af3:	48 b9 0b 03 80 00 00 	movabs $0x80030b,%rcx
+  801afa:	00 00 00 
+  801afd:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801aff:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801b06:	eb b5                	jmp    801abd <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  801b08:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801b0f:	eb ac                	jmp    801abd <read+0x6a>
+
+0000000000801b11 <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  801b11:	55                   	push   %rbp
+  801b12:	48 89 e5             	mov    %rsp,%rbp
+  801b15:	41 57                	push   %r15
+  801b17:	41 56                	push   %r14
+  801b19:	41 55                	push   %r13
+  801b1b:	41 54                	push   %r12
+  801b1d:	53                   	push   %rbx
+  801b1e:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  801b22:	48 85 d2             	test   %rdx,%rdx
+  801b25:	74 54                	je     801b7b <readn+0x6a>
+  801b27:	41 89 fd             	mov    %edi,%r13d
+  801b2a:	49 89 f6             	mov    %rsi,%r14
+  801b2d:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  801b30:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  801b35:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  801b3a:	49 bf 53 1a 80 00 00 	movabs $0x801a53,%r15
+  801b41:	00 00 00 
+  801b44:	4c 89 e2             	mov    %r12,%rdx
+  801b47:	48 29 f2             	sub    %rsi,%rdx
+  801b4a:	4c 01 f6             	add    %r14,%rsi
+  801b4d:	44 89 ef             	mov    %r13d,%edi
+  801b50:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  801b53:	85 c0                	test   %eax,%eax
+  801b55:	78 20                	js     801b77 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  801b57:	01 c3                	add    %eax,%ebx
+  801b59:	85 c0                	test   %eax,%eax
+  801b5b:	74 08                	je     801b65 <readn+0x54>
+  801b5d:	48 63 f3             	movslq %ebx,%rsi
+  801b60:	4c 39 e6             	cmp    %r12,%rsi
+  801b63:	72 df                	jb     801b44 <readn+0x33>
+    }
+    return res;
+  801b65:	48 63 c3             	movslq %ebx,%rax
+}
+  801b68:	48 83 c4 08          	add    $0x8,%rsp
+  801b6c:	5b                   	pop    %rbx
+  801b6d:	41 5c                	pop    %r12
+  801b6f:	41 5d                	pop    %r13
+  801b71:	41 5e                	pop    %r14
+  801b73:	41 5f                	pop    %r15
+  801b75:	5d                   	pop    %rbp
+  801b76:	c3                   	ret
+        if (inc < 0) return inc;
+  801b77:	48 98                	cltq
+  801b79:	eb ed                	jmp    801b68 <readn+0x57>
+    int inc = 1, res = 0;
+  801b7b:	bb 00 00 00 00       	mov    $0x0,%ebx
+  801b80:	eb e3                	jmp    801b65 <readn+0x54>
+
+0000000000801b82 <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  801b82:	55                   	push   %rbp
+  801b83:	48 89 e5             	mov    %rsp,%rbp
+  801b86:	41 56                	push   %r14
+  801b88:	41 55                	push   %r13
+  801b8a:	41 54                	push   %r12
+  801b8c:	53                   	push   %rbx
+  801b8d:	48 83 ec 10          	sub    $0x10,%rsp
+  801b91:	89 fb                	mov    %edi,%ebx
+  801b93:	49 89 f4             	mov    %rsi,%r12
+  801b96:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801b99:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801b9d:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  801ba4:	00 00 00 
+  801ba7:	ff d0                	call   *%rax
+  801ba9:	85 c0                	test   %eax,%eax
+  801bab:	78 47                	js     801bf4 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bad:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  801bb1:	41 8b 3e             	mov    (%r14),%edi
+  801bb4:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801bb8:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801bbf:	00 00 00 
+  801bc2:	ff d0                	call   *%rax
+  801bc4:	85 c0                	test   %eax,%eax
+  801bc6:	78 30                	js     801bf8 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801bc8:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  801bcd:	74 2d                	je     801bfc <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801bcf:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801bd3:	48 8b 40 18          	mov    0x18(%rax),%rax
+  801bd7:	48 85 c0             	test   %rax,%rax
+  801bda:	74 56                	je     801c32 <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  801bdc:	4c 89 ea             	mov    %r13,%rdx
+  801bdf:	4c 89 e6             	mov    %r12,%rsi
+  801be2:	4c 89 f7             	mov    %r14,%rdi
+  801be5:	ff d0                	call   *%rax
+}
+  801be7:	48 83 c4 10          	add    $0x10,%rsp
+  801beb:	5b                   	pop    %rbx
+  801bec:	41 5c                	pop    %r12
+  801bee:	41 5d                	pop    %r13
+  801bf0:	41 5e                	pop    %r14
+  801bf2:	5d                   	pop    %rbp
+  801bf3:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801bf4:	48 98                	cltq
+  801bf6:	eb ef                	jmp    801be7 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801bf8:	48 98                	cltq
+  801bfa:	eb eb                	jmp    801be7 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  801bfc:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801c03:	00 00 00 
+  801c06:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  801c0c:	89 da                	mov    %ebx,%edx
+  801c0e:	48 bf 4d 4f 80 00 00 	movabs $0x804f4d,%rdi
+  801c15:	00 00 00 
+  801c18:	b8 00 00 00 00       	mov    $0x0,%eax
+  801c1d:	48 b9 0b 03 80 00 00 	movabs $0x80030b,%rcx
+  801c24:	00 00 00 
+  801c27:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801c29:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  801c30:	eb b5                	jmp    801be7 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  801c32:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  801c39:	eb ac                	jmp    801be7 <write+0x65>
+
+0000000000801c3b <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  801c3b:	55                   	push   %rbp
+  801c3c:	48 89 e5             	mov    %rsp,%rbp
+  801c3f:	41 54                	push   %r12
+  801c41:	53                   	push   %rbx
+  801c42:	48 83 ec 10          	sub    $0x10,%rsp
+  801c46:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801c48:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801c4c:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  801c53:	00 00 00 
+  801c56:	ff d0                	call   *%rax
+  801c58:	85 c0                	test   %eax,%eax
+  801c5a:	78 3e                	js     801c9a <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801c5c:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801c60:	41 8b 3c 24          	mov    (%r12),%edi
+  801c64:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801c68:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801c6f:	00 00 00 
+  801c72:	ff d0                	call   *%rax
+  801c74:	85 c0                	test   %eax,%eax
+  801c76:	78 22                	js     801c9a <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  801c78:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801c7c:	48 8b 40 38          	mov    0x38(%rax),%rax
+  801c80:	48 85 c0             	test   %rax,%rax
+  801c83:	74 0b                	je     801c90 <seek+0x55>
+  801c85:	89 de                	mov    %ebx,%esi
+  801c87:	4c 89 e7             	mov    %r12,%rdi
+  801c8a:	ff d0                	call   *%rax
+  801c8c:	85 c0                	test   %eax,%eax
+  801c8e:	78 0a                	js     801c9a <seek+0x5f>
+
+    fd->fd_offset = offset;
+  801c90:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  801c95:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801c9a:	48 83 c4 10          	add    $0x10,%rsp
+  801c9e:	5b                   	pop    %rbx
+  801c9f:	41 5c                	pop    %r12
+  801ca1:	5d                   	pop    %rbp
+  801ca2:	c3                   	ret
+
+0000000000801ca3 <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  801ca3:	55                   	push   %rbp
+  801ca4:	48 89 e5             	mov    %rsp,%rbp
+  801ca7:	41 55                	push   %r13
+  801ca9:	41 54                	push   %r12
+  801cab:	53                   	push   %rbx
+  801cac:	48 83 ec 18          	sub    $0x18,%rsp
+  801cb0:	89 fb                	mov    %edi,%ebx
+  801cb2:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801cb5:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801cb9:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  801cc0:	00 00 00 
+  801cc3:	ff d0                	call   *%rax
+  801cc5:	85 c0                	test   %eax,%eax
+  801cc7:	78 38                	js     801d01 <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801cc9:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  801ccd:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  801cd1:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  801cd5:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801cdc:	00 00 00 
+  801cdf:	ff d0                	call   *%rax
+  801ce1:	85 c0                	test   %eax,%eax
+  801ce3:	78 1c                	js     801d01 <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  801ce5:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  801cea:	74 20                	je     801d0c <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801cec:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  801cf0:	48 8b 40 30          	mov    0x30(%rax),%rax
+  801cf4:	48 85 c0             	test   %rax,%rax
+  801cf7:	74 47                	je     801d40 <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  801cf9:	44 89 e6             	mov    %r12d,%esi
+  801cfc:	4c 89 ef             	mov    %r13,%rdi
+  801cff:	ff d0                	call   *%rax
+}
+  801d01:	48 83 c4 18          	add    $0x18,%rsp
+  801d05:	5b                   	pop    %rbx
+  801d06:	41 5c                	pop    %r12
+  801d08:	41 5d                	pop    %r13
+  801d0a:	5d                   	pop    %rbp
+  801d0b:	c3                   	ret
+                thisenv->env_id, fdnum);
+  801d0c:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801d13:	00 00 00 
+  801d16:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  801d1c:	89 da                	mov    %ebx,%edx
+  801d1e:	48 bf 10 4f 80 00 00 	movabs $0x804f10,%rdi
+  801d25:	00 00 00 
+  801d28:	b8 00 00 00 00       	mov    $0x0,%eax
+  801d2d:	48 b9 0b 03 80 00 00 	movabs $0x80030b,%rcx
+  801d34:	00 00 00 
+  801d37:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  801d39:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  801d3e:	eb c1                	jmp    801d01 <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  801d40:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801d45:	eb ba                	jmp    801d01 <ftruncate+0x5e>
+
+0000000000801d47 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  801d47:	55                   	push   %rbp
+  801d48:	48 89 e5             	mov    %rsp,%rbp
+  801d4b:	41 54                	push   %r12
+  801d4d:	53                   	push   %rbx
+  801d4e:	48 83 ec 10          	sub    $0x10,%rsp
+  801d52:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  801d55:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801d59:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  801d60:	00 00 00 
+  801d63:	ff d0                	call   *%rax
+  801d65:	85 c0                	test   %eax,%eax
+  801d67:	78 4e                	js     801db7 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  801d69:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  801d6d:	41 8b 3c 24          	mov    (%r12),%edi
+  801d71:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  801d75:	48 b8 bb 17 80 00 00 	movabs $0x8017bb,%rax
+  801d7c:	00 00 00 
+  801d7f:	ff d0                	call   *%rax
+  801d81:	85 c0                	test   %eax,%eax
+  801d83:	78 32                	js     801db7 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801d85:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  801d89:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  801d8e:	74 30                	je     801dc0 <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  801d90:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  801d93:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  801d9a:	00 00 00 
+    stat->st_isdir = 0;
+  801d9d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  801da4:	00 00 00 
+    stat->st_dev = dev;
+  801da7:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  801dae:	48 89 de             	mov    %rbx,%rsi
+  801db1:	4c 89 e7             	mov    %r12,%rdi
+  801db4:	ff 50 28             	call   *0x28(%rax)
+}
+  801db7:	48 83 c4 10          	add    $0x10,%rsp
+  801dbb:	5b                   	pop    %rbx
+  801dbc:	41 5c                	pop    %r12
+  801dbe:	5d                   	pop    %rbp
+  801dbf:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  801dc0:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  801dc5:	eb f0                	jmp    801db7 <fstat+0x70>
+
+0000000000801dc7 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  801dc7:	55                   	push   %rbp
+  801dc8:	48 89 e5             	mov    %rsp,%rbp
+  801dcb:	41 54                	push   %r12
+  801dcd:	53                   	push   %rbx
+  801dce:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  801dd1:	be 00 00 00 00       	mov    $0x0,%esi
+  801dd6:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  801ddd:	00 00 00 
+  801de0:	ff d0                	call   *%rax
+  801de2:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  801de4:	85 c0                	test   %eax,%eax
+  801de6:	78 25                	js     801e0d <stat+0x46>
+
+    int res = fstat(fd, stat);
+  801de8:	4c 89 e6             	mov    %r12,%rsi
+  801deb:	89 c7                	mov    %eax,%edi
+  801ded:	48 b8 47 1d 80 00 00 	movabs $0x801d47,%rax
+  801df4:	00 00 00 
+  801df7:	ff d0                	call   *%rax
+  801df9:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  801dfc:	89 df                	mov    %ebx,%edi
+  801dfe:	48 b8 d5 18 80 00 00 	movabs $0x8018d5,%rax
+  801e05:	00 00 00 
+  801e08:	ff d0                	call   *%rax
+
+    return res;
+  801e0a:	44 89 e3             	mov    %r12d,%ebx
+}
+  801e0d:	89 d8                	mov    %ebx,%eax
+  801e0f:	5b                   	pop    %rbx
+  801e10:	41 5c                	pop    %r12
+  801e12:	5d                   	pop    %rbp
+  801e13:	c3                   	ret
+
+0000000000801e14 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e14:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  801e1b:	00 00 00 
+  801e1e:	83 38 00             	cmpl   $0x0,(%rax)
+  801e21:	74 0a                	je     801e2d <fsenv+0x19>
+    return envid;
+}
+  801e23:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e2a:	00 00 
+  801e2c:	c3                   	ret
+fsenv(void) {
+  801e2d:	55                   	push   %rbp
+  801e2e:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  801e31:	bf 03 00 00 00       	mov    $0x3,%edi
+  801e36:	48 b8 a5 48 80 00 00 	movabs $0x8048a5,%rax
+  801e3d:	00 00 00 
+  801e40:	ff d0                	call   *%rax
+  801e42:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  801e49:	00 00 
+}
+  801e4b:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  801e52:	00 00 
+  801e54:	5d                   	pop    %rbp
+  801e55:	c3                   	ret
+
+0000000000801e56 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  801e56:	55                   	push   %rbp
+  801e57:	48 89 e5             	mov    %rsp,%rbp
+  801e5a:	41 54                	push   %r12
+  801e5c:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801e5d:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e62:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801e67:	48 89 de             	mov    %rbx,%rsi
+  801e6a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e6f:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  801e76:	00 00 00 
+  801e79:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  801e7b:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  801e82:	00 00 00 
+  801e85:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801e8b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  801e90:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801e95:	48 89 de             	mov    %rbx,%rsi
+  801e98:	bf 00 00 00 00       	mov    $0x0,%edi
+  801e9d:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  801ea4:	00 00 00 
+  801ea7:	ff d0                	call   *%rax
+  801ea9:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  801eab:	85 c0                	test   %eax,%eax
+  801ead:	0f 88 a2 00 00 00    	js     801f55 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  801eb3:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801eba:	00 00 00 
+  801ebd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801ec3:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  801ec8:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  801eca:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  801ecf:	49 bc 67 40 80 00 00 	movabs $0x804067,%r12
+  801ed6:	00 00 00 
+  801ed9:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  801edc:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  801ee1:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  801ee4:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  801eeb:	00 00 00 
+  801eee:	ff d0                	call   *%rax
+  801ef0:	89 c7                	mov    %eax,%edi
+  801ef2:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  801ef8:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  801efd:	48 89 da             	mov    %rbx,%rdx
+  801f00:	be 09 00 00 00       	mov    $0x9,%esi
+  801f05:	48 b8 4f 48 80 00 00 	movabs $0x80484f,%rax
+  801f0c:	00 00 00 
+  801f0f:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  801f11:	b9 00 00 00 00       	mov    $0x0,%ecx
+  801f16:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f1b:	be 00 00 00 00       	mov    $0x0,%esi
+  801f20:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f25:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  801f2c:	00 00 00 
+  801f2f:	ff d0                	call   *%rax
+  801f31:	89 c3                	mov    %eax,%ebx
+  801f33:	85 c0                	test   %eax,%eax
+  801f35:	78 25                	js     801f5c <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  801f37:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801f3e:	00 00 00 
+  801f41:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  801f47:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  801f4e:	00 00 
+    return 0;
+  801f50:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  801f55:	89 d8                	mov    %ebx,%eax
+  801f57:	5b                   	pop    %rbx
+  801f58:	41 5c                	pop    %r12
+  801f5a:	5d                   	pop    %rbp
+  801f5b:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  801f5c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  801f61:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  801f66:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f6b:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  801f72:	00 00 00 
+  801f75:	ff d0                	call   *%rax
+        return res;
+  801f77:	eb dc                	jmp    801f55 <fschan_setup+0xff>
+
+0000000000801f79 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  801f79:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801f80:	00 00 00 
+  801f83:	80 38 00             	cmpb   $0x0,(%rax)
+  801f86:	74 55                	je     801fdd <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f88:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  801f8f:	00 00 00 
+  801f92:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  801f98:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801f9d:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  801fa4:	00 00 00 
+  801fa7:	3b 0a                	cmp    (%rdx),%ecx
+  801fa9:	75 01                	jne    801fac <fschan+0x33>
+}
+  801fab:	c3                   	ret
+fschan(void) {
+  801fac:	55                   	push   %rbp
+  801fad:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fb0:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  801fb7:	00 00 00 
+  801fba:	ff d0                	call   *%rax
+  801fbc:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  801fbe:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  801fc3:	85 d2                	test   %edx,%edx
+  801fc5:	78 02                	js     801fc9 <fschan+0x50>
+}
+  801fc7:	5d                   	pop    %rbp
+  801fc8:	c3                   	ret
+        fschan_enabled = 0;
+  801fc9:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  801fd0:	00 00 00 
+  801fd3:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  801fd6:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fdb:	eb ea                	jmp    801fc7 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  801fdd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801fe2:	c3                   	ret
+
+0000000000801fe3 <fbuf>:
+fbuf(struct Fd *fd) {
+  801fe3:	55                   	push   %rbp
+  801fe4:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  801fe7:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  801fee:	00 00 00 
+  801ff1:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  801ff3:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ff8:	48 83 f8 1f          	cmp    $0x1f,%rax
+  801ffc:	77 12                	ja     802010 <fbuf+0x2d>
+  801ffe:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802002:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802009:	00 00 00 
+  80200c:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802010:	48 89 d0             	mov    %rdx,%rax
+  802013:	5d                   	pop    %rbp
+  802014:	c3                   	ret
+
+0000000000802015 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802015:	55                   	push   %rbp
+  802016:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802019:	48 83 c7 40          	add    $0x40,%rdi
+  80201d:	48 b8 a1 40 80 00 00 	movabs $0x8040a1,%rax
+  802024:	00 00 00 
+  802027:	ff d0                	call   *%rax
+  802029:	84 c0                	test   %al,%al
+  80202b:	75 02                	jne    80202f <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  80202d:	5d                   	pop    %rbp
+  80202e:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  80202f:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  802036:	00 00 00 
+  802039:	ff d0                	call   *%rax
+  80203b:	89 c7                	mov    %eax,%edi
+  80203d:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802043:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802048:	ba 00 00 00 00       	mov    $0x0,%edx
+  80204d:	be 0a 00 00 00       	mov    $0xa,%esi
+  802052:	48 b8 4f 48 80 00 00 	movabs $0x80484f,%rax
+  802059:	00 00 00 
+  80205c:	ff d0                	call   *%rax
+}
+  80205e:	eb cd                	jmp    80202d <fschan_publish+0x18>
+
+0000000000802060 <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  802060:	55                   	push   %rbp
+  802061:	48 89 e5             	mov    %rsp,%rbp
+  802064:	41 57                	push   %r15
+  802066:	41 56                	push   %r14
+  802068:	41 55                	push   %r13
+  80206a:	41 54                	push   %r12
+  80206c:	53                   	push   %rbx
+  80206d:	48 83 ec 48          	sub    $0x48,%rsp
+  802071:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  802075:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  802079:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  80207c:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  802080:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  802083:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  80208a:	00 00 00 
+  80208d:	8b 02                	mov    (%rdx),%eax
+  80208f:	83 c0 01             	add    $0x1,%eax
+  802092:	b9 01 00 00 00       	mov    $0x1,%ecx
+  802097:	0f 44 c1             	cmove  %ecx,%eax
+  80209a:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  80209c:	4d 85 c0             	test   %r8,%r8
+  80209f:	74 2c                	je     8020cd <fschan_rw+0x6d>
+  8020a1:	45 89 ce             	mov    %r9d,%r14d
+  8020a4:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  8020ab:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  8020af:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  8020b5:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  8020bc:	00 
+  8020bd:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8020c3:	b8 01 00 00 00       	mov    $0x1,%eax
+  8020c8:	e9 41 01 00 00       	jmp    80220e <fschan_rw+0x1ae>
+  8020cd:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  8020d1:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  8020d5:	e9 9c 01 00 00       	jmp    802276 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  8020da:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  8020de:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  8020e1:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8020e4:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8020e7:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8020eb:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8020ef:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8020f3:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8020f7:	48 89 da             	mov    %rbx,%rdx
+  8020fa:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  802101:	00 00 00 
+  802104:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  802106:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80210a:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  802111:	00 00 00 
+  802114:	ff d0                	call   *%rax
+            queued += blk;
+  802116:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  802119:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80211d:	4d 39 fc             	cmp    %r15,%r12
+  802120:	73 6b                	jae    80218d <fschan_rw+0x12d>
+  802122:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802126:	77 65                	ja     80218d <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802128:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80212c:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802130:	48 b8 7c 40 80 00 00 	movabs $0x80407c,%rax
+  802137:	00 00 00 
+  80213a:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  80213c:	4c 89 fb             	mov    %r15,%rbx
+  80213f:	4c 29 e3             	sub    %r12,%rbx
+  802142:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  802147:	48 39 d3             	cmp    %rdx,%rbx
+  80214a:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80214e:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  802152:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802156:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  80215a:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  80215d:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80215f:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  802166:	00 00 00 
+  802169:	8b 09                	mov    (%rcx),%ecx
+  80216b:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80216e:	83 fe 03             	cmp    $0x3,%esi
+  802171:	0f 85 63 ff ff ff    	jne    8020da <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  802177:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  80217b:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80217e:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  802181:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  802184:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  802188:	e9 79 ff ff ff       	jmp    802106 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  80218d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802191:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  802198:	48 89 df             	mov    %rbx,%rdi
+  80219b:	48 b8 3f 41 80 00 00 	movabs $0x80413f,%rax
+  8021a2:	00 00 00 
+  8021a5:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8021a7:	48 89 df             	mov    %rbx,%rdi
+  8021aa:	48 b8 cd 40 80 00 00 	movabs $0x8040cd,%rax
+  8021b1:	00 00 00 
+  8021b4:	ff d0                	call   *%rax
+  8021b6:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  8021ba:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  8021be:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  8021c2:	75 25                	jne    8021e9 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  8021c4:	8b 40 04             	mov    0x4(%rax),%eax
+  8021c7:	85 c0                	test   %eax,%eax
+  8021c9:	0f 88 86 00 00 00    	js     802255 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8021cf:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  8021d3:	74 5b                	je     802230 <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  8021d5:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  8021d9:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  8021dd:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  8021e1:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8021e5:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8021e9:	48 89 df             	mov    %rbx,%rdi
+  8021ec:	48 b8 f4 40 80 00 00 	movabs $0x8040f4,%rax
+  8021f3:	00 00 00 
+  8021f6:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8021f8:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8021fc:	83 f0 01             	xor    $0x1,%eax
+  8021ff:	4d 39 fc             	cmp    %r15,%r12
+  802202:	0f 92 c2             	setb   %dl
+  802205:	84 c2                	test   %al,%dl
+  802207:	75 05                	jne    80220e <fschan_rw+0x1ae>
+  802209:	45 85 ed             	test   %r13d,%r13d
+  80220c:	74 50                	je     80225e <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  80220e:	4d 39 fc             	cmp    %r15,%r12
+  802211:	0f 92 c1             	setb   %cl
+  802214:	41 83 fd 0f          	cmp    $0xf,%r13d
+  802218:	0f 96 c2             	setbe  %dl
+  80221b:	84 d1                	test   %dl,%cl
+  80221d:	0f 84 6a ff ff ff    	je     80218d <fschan_rw+0x12d>
+  802223:	84 c0                	test   %al,%al
+  802225:	0f 85 fd fe ff ff    	jne    802128 <fschan_rw+0xc8>
+  80222b:	e9 5d ff ff ff       	jmp    80218d <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  802230:	48 63 d0             	movslq %eax,%rdx
+  802233:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802237:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  80223b:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  80223f:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  802243:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  802247:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  80224e:	00 00 00 
+  802251:	ff d0                	call   *%rax
+  802253:	eb 80                	jmp    8021d5 <fschan_rw+0x175>
+                err = msg->fm_res;
+  802255:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  802258:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  80225c:	eb 8b                	jmp    8021e9 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80225e:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  802263:	0f 85 68 fe ff ff    	jne    8020d1 <fschan_rw+0x71>
+  802269:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  80226c:	85 c0                	test   %eax,%eax
+  80226e:	0f 84 5d fe ff ff    	je     8020d1 <fschan_rw+0x71>
+  802274:	48 98                	cltq
+}
+  802276:	48 83 c4 48          	add    $0x48,%rsp
+  80227a:	5b                   	pop    %rbx
+  80227b:	41 5c                	pop    %r12
+  80227d:	41 5d                	pop    %r13
+  80227f:	41 5e                	pop    %r14
+  802281:	41 5f                	pop    %r15
+  802283:	5d                   	pop    %rbp
+  802284:	c3                   	ret
+
+0000000000802285 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  802285:	55                   	push   %rbp
+  802286:	48 89 e5             	mov    %rsp,%rbp
+  802289:	41 56                	push   %r14
+  80228b:	41 55                	push   %r13
+  80228d:	41 54                	push   %r12
+  80228f:	53                   	push   %rbx
+  802290:	48 83 ec 10          	sub    $0x10,%rsp
+  802294:	49 89 fe             	mov    %rdi,%r14
+  802297:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  80229a:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80229e:	48 29 f3             	sub    %rsi,%rbx
+  8022a1:	48 39 d3             	cmp    %rdx,%rbx
+  8022a4:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  8022a8:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8022af:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  8022b0:	bf 00 10 00 00       	mov    $0x1000,%edi
+  8022b5:	49 bd fe 3e 80 00 00 	movabs $0x803efe,%r13
+  8022bc:	00 00 00 
+  8022bf:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  8022c6:	76 1e                	jbe    8022e6 <mmap_fault+0x61>
+  8022c8:	4c 01 e7             	add    %r12,%rdi
+  8022cb:	41 ff d5             	call   *%r13
+  8022ce:	84 c0                	test   %al,%al
+  8022d0:	75 14                	jne    8022e6 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  8022d2:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8022d6:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  8022dd:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  8022e1:	48 39 df             	cmp    %rbx,%rdi
+  8022e4:	72 e2                	jb     8022c8 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8022e6:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8022ed:	00 00 00 
+  8022f0:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8022f7:	00 00 00 
+  8022fa:	4c 89 f0             	mov    %r14,%rax
+  8022fd:	48 29 d0             	sub    %rdx,%rax
+  802300:	48 c1 f8 03          	sar    $0x3,%rax
+  802304:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  80230b:	aa aa aa 
+  80230e:	48 0f af c2          	imul   %rdx,%rax
+  802312:	48 c1 e0 0c          	shl    $0xc,%rax
+  802316:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  80231b:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  80231f:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  802321:	44 89 e0             	mov    %r12d,%eax
+  802324:	41 03 46 10          	add    0x10(%r14),%eax
+  802328:	41 2b 06             	sub    (%r14),%eax
+  80232b:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  80232e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  802332:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  802336:	41 8b 46 14          	mov    0x14(%r14),%eax
+  80233a:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  80233d:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  802344:	00 00 00 
+  802347:	ff d0                	call   *%rax
+  802349:	89 c7                	mov    %eax,%edi
+  80234b:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802351:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802356:	48 89 da             	mov    %rbx,%rdx
+  802359:	be 0f 00 00 00       	mov    $0xf,%esi
+  80235e:	48 b8 4f 48 80 00 00 	movabs $0x80484f,%rax
+  802365:	00 00 00 
+  802368:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  80236a:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80236f:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802373:	4c 89 e6             	mov    %r12,%rsi
+  802376:	bf 00 00 00 00       	mov    $0x0,%edi
+  80237b:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  802382:	00 00 00 
+  802385:	ff d0                	call   *%rax
+  802387:	48 98                	cltq
+}
+  802389:	48 83 c4 10          	add    $0x10,%rsp
+  80238d:	5b                   	pop    %rbx
+  80238e:	41 5c                	pop    %r12
+  802390:	41 5d                	pop    %r13
+  802392:	41 5e                	pop    %r14
+  802394:	5d                   	pop    %rbp
+  802395:	c3                   	ret
+
+0000000000802396 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  802396:	48 8b 37             	mov    (%rdi),%rsi
+  802399:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  8023a0:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8023a7:	00 00 00 
+  8023aa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8023af:	eb 0f                	jmp    8023c0 <mmap_pgfault+0x2a>
+  8023b1:	c3                   	ret
+  8023b2:	48 83 c1 01          	add    $0x1,%rcx
+  8023b6:	48 83 c2 18          	add    $0x18,%rdx
+  8023ba:	48 83 f9 20          	cmp    $0x20,%rcx
+  8023be:	74 6e                	je     80242e <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8023c0:	48 8b 02             	mov    (%rdx),%rax
+  8023c3:	48 83 e8 01          	sub    $0x1,%rax
+  8023c7:	48 39 f0             	cmp    %rsi,%rax
+  8023ca:	73 e6                	jae    8023b2 <mmap_pgfault+0x1c>
+  8023cc:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  8023d0:	73 e0                	jae    8023b2 <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8023d2:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  8023d6:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023db:	f6 c2 01             	test   $0x1,%dl
+  8023de:	75 d1                	jne    8023b1 <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  8023e0:	f6 c2 02             	test   $0x2,%dl
+  8023e3:	74 1a                	je     8023ff <mmap_pgfault+0x69>
+  8023e5:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8023e9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023ee:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8023f5:	00 00 00 
+  8023f8:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8023fd:	74 35                	je     802434 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8023ff:	55                   	push   %rbp
+  802400:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  802403:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  802407:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  80240e:	00 00 00 
+  802411:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  802415:	ba 00 00 01 00       	mov    $0x10000,%edx
+  80241a:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  802421:	00 00 00 
+  802424:	ff d0                	call   *%rax
+  802426:	48 85 c0             	test   %rax,%rax
+  802429:	0f 9f c0             	setg   %al
+}
+  80242c:	5d                   	pop    %rbp
+  80242d:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80242e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802433:	c3                   	ret
+}
+  802434:	c3                   	ret
+
+0000000000802435 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  802435:	55                   	push   %rbp
+  802436:	48 89 e5             	mov    %rsp,%rbp
+  802439:	41 54                	push   %r12
+  80243b:	53                   	push   %rbx
+  80243c:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  80243f:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  802446:	00 00 00 
+  802449:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80244e:	48 83 38 00          	cmpq   $0x0,(%rax)
+  802452:	74 15                	je     802469 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  802454:	48 83 c3 01          	add    $0x1,%rbx
+  802458:	48 83 c0 18          	add    $0x18,%rax
+  80245c:	48 83 fb 20          	cmp    $0x20,%rbx
+  802460:	75 ec                	jne    80244e <mmap_alloc+0x19>
+    return NULL;
+  802462:	b8 00 00 00 00       	mov    $0x0,%eax
+  802467:	eb 52                	jmp    8024bb <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  802469:	4c 89 e7             	mov    %r12,%rdi
+  80246c:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  802473:	00 00 00 
+  802476:	ff d0                	call   *%rax
+  802478:	41 89 c1             	mov    %eax,%r9d
+  80247b:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  802482:	48 c1 e1 0c          	shl    $0xc,%rcx
+  802486:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  80248c:	ba 00 00 00 00       	mov    $0x0,%edx
+  802491:	4c 89 e6             	mov    %r12,%rsi
+  802494:	bf 00 00 00 00       	mov    $0x0,%edi
+  802499:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  8024a0:	00 00 00 
+  8024a3:	ff d0                	call   *%rax
+  8024a5:	85 c0                	test   %eax,%eax
+  8024a7:	78 17                	js     8024c0 <mmap_alloc+0x8b>
+        return &mmaps[i];
+  8024a9:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  8024ad:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8024b4:	00 00 00 
+  8024b7:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  8024bb:	5b                   	pop    %rbx
+  8024bc:	41 5c                	pop    %r12
+  8024be:	5d                   	pop    %rbp
+  8024bf:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  8024c0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8024c5:	eb f4                	jmp    8024bb <mmap_alloc+0x86>
+
+00000000008024c7 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  8024c7:	55                   	push   %rbp
+  8024c8:	48 89 e5             	mov    %rsp,%rbp
+  8024cb:	41 56                	push   %r14
+  8024cd:	41 55                	push   %r13
+  8024cf:	41 54                	push   %r12
+  8024d1:	53                   	push   %rbx
+  8024d2:	48 83 ec 10          	sub    $0x10,%rsp
+  8024d6:	41 89 fc             	mov    %edi,%r12d
+  8024d9:	49 89 f5             	mov    %rsi,%r13
+  8024dc:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  8024df:	48 89 f0             	mov    %rsi,%rax
+  8024e2:	48 09 d0             	or     %rdx,%rax
+  8024e5:	75 0d                	jne    8024f4 <fsipc+0x2d>
+  8024e7:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8024ea:	83 f8 04             	cmp    $0x4,%eax
+  8024ed:	76 7d                	jbe    80256c <fsipc+0xa5>
+  8024ef:	83 ff 0d             	cmp    $0xd,%edi
+  8024f2:	74 78                	je     80256c <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8024f4:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  8024fb:	00 00 00 
+  8024fe:	ff d0                	call   *%rax
+  802500:	89 c7                	mov    %eax,%edi
+  802502:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  802509:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  802510:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  802517:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80251d:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802524:	00 00 00 
+  802527:	44 89 e6             	mov    %r12d,%esi
+  80252a:	48 b8 4f 48 80 00 00 	movabs $0x80484f,%rax
+  802531:	00 00 00 
+  802534:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  802536:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80253d:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  80253e:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802543:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  802547:	4c 89 ee             	mov    %r13,%rsi
+  80254a:	bf 00 00 00 00       	mov    $0x0,%edi
+  80254f:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  802556:	00 00 00 
+  802559:	ff d0                	call   *%rax
+  80255b:	89 c3                	mov    %eax,%ebx
+}
+  80255d:	89 d8                	mov    %ebx,%eax
+  80255f:	48 83 c4 10          	add    $0x10,%rsp
+  802563:	5b                   	pop    %rbx
+  802564:	41 5c                	pop    %r12
+  802566:	41 5d                	pop    %r13
+  802568:	41 5e                	pop    %r14
+  80256a:	5d                   	pop    %rbp
+  80256b:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80256c:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  802573:	00 00 00 
+  802576:	ff d0                	call   *%rax
+  802578:	49 89 c6             	mov    %rax,%r14
+  80257b:	48 85 c0             	test   %rax,%rax
+  80257e:	0f 84 70 ff ff ff    	je     8024f4 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  802584:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  802588:	48 b8 7c 40 80 00 00 	movabs $0x80407c,%rax
+  80258f:	00 00 00 
+  802592:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  802594:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  802597:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80259e:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  8025a2:	ba 10 00 00 00       	mov    $0x10,%edx
+  8025a7:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  8025ae:	00 00 00 
+  8025b1:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  8025b8:	00 00 00 
+  8025bb:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  8025bd:	4c 89 f7             	mov    %r14,%rdi
+  8025c0:	48 b8 15 20 80 00 00 	movabs $0x802015,%rax
+  8025c7:	00 00 00 
+  8025ca:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  8025cc:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  8025d3:	4c 89 f7             	mov    %r14,%rdi
+  8025d6:	48 b8 3f 41 80 00 00 	movabs $0x80413f,%rax
+  8025dd:	00 00 00 
+  8025e0:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  8025e2:	4c 89 f7             	mov    %r14,%rdi
+  8025e5:	48 b8 cd 40 80 00 00 	movabs $0x8040cd,%rax
+  8025ec:	00 00 00 
+  8025ef:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8025f1:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8025f4:	41 83 fc 05          	cmp    $0x5,%r12d
+  8025f8:	75 04                	jne    8025fe <fsipc+0x137>
+  8025fa:	85 db                	test   %ebx,%ebx
+  8025fc:	79 14                	jns    802612 <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8025fe:	4c 89 f7             	mov    %r14,%rdi
+  802601:	48 b8 f4 40 80 00 00 	movabs $0x8040f4,%rax
+  802608:	00 00 00 
+  80260b:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  80260d:	e9 4b ff ff ff       	jmp    80255d <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  802612:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  802616:	ba 88 00 00 00       	mov    $0x88,%edx
+  80261b:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  802622:	00 00 00 
+  802625:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  80262c:	00 00 00 
+  80262f:	ff d0                	call   *%rax
+  802631:	eb cb                	jmp    8025fe <fsipc+0x137>
+
+0000000000802633 <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  802633:	55                   	push   %rbp
+  802634:	48 89 e5             	mov    %rsp,%rbp
+  802637:	41 57                	push   %r15
+  802639:	41 56                	push   %r14
+  80263b:	41 55                	push   %r13
+  80263d:	41 54                	push   %r12
+  80263f:	53                   	push   %rbx
+  802640:	48 83 ec 18          	sub    $0x18,%rsp
+  802644:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  802648:	49 89 f6             	mov    %rsi,%r14
+  80264b:	49 89 d4             	mov    %rdx,%r12
+  80264e:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  802651:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  802658:	00 00 00 
+  80265b:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  80265d:	48 85 c0             	test   %rax,%rax
+  802660:	0f 85 96 00 00 00    	jne    8026fc <devfile_write_direct+0xc9>
+    size_t write = 0;
+  802666:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  80266d:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80266e:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  802675:	00 00 00 
+    while (n) {
+  802678:	4d 85 e4             	test   %r12,%r12
+  80267b:	74 79                	je     8026f6 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  80267d:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  802682:	49 39 dc             	cmp    %rbx,%r12
+  802685:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  802689:	48 89 da             	mov    %rbx,%rdx
+  80268c:	4c 89 f6             	mov    %r14,%rsi
+  80268f:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  802696:	00 00 00 
+  802699:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  8026a0:	00 00 00 
+  8026a3:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  8026a5:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8026a9:	8b 40 0c             	mov    0xc(%rax),%eax
+  8026ac:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  8026af:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  8026b2:	44 01 e8             	add    %r13d,%eax
+  8026b5:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  8026b9:	41 0f 44 c5          	cmove  %r13d,%eax
+  8026bd:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  8026c1:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  8026c5:	48 89 da             	mov    %rbx,%rdx
+  8026c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8026cd:	bf 04 00 00 00       	mov    $0x4,%edi
+  8026d2:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8026d9:	00 00 00 
+  8026dc:	ff d0                	call   *%rax
+        if (res < 0)
+  8026de:	85 c0                	test   %eax,%eax
+  8026e0:	78 4a                	js     80272c <devfile_write_direct+0xf9>
+        buf += res;
+  8026e2:	48 98                	cltq
+  8026e4:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8026e7:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8026eb:	49 29 c4             	sub    %rax,%r12
+  8026ee:	75 8d                	jne    80267d <devfile_write_direct+0x4a>
+    return write;
+  8026f0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8026f4:	eb 27                	jmp    80271d <devfile_write_direct+0xea>
+    size_t write = 0;
+  8026f6:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8026fa:	eb f4                	jmp    8026f0 <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8026fc:	45 89 e9             	mov    %r13d,%r9d
+  8026ff:	4d 89 e0             	mov    %r12,%r8
+  802702:	4c 89 f1             	mov    %r14,%rcx
+  802705:	ba 04 00 00 00       	mov    $0x4,%edx
+  80270a:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  80270e:	48 89 c7             	mov    %rax,%rdi
+  802711:	48 b8 60 20 80 00 00 	movabs $0x802060,%rax
+  802718:	00 00 00 
+  80271b:	ff d0                	call   *%rax
+}
+  80271d:	48 83 c4 18          	add    $0x18,%rsp
+  802721:	5b                   	pop    %rbx
+  802722:	41 5c                	pop    %r12
+  802724:	41 5d                	pop    %r13
+  802726:	41 5e                	pop    %r14
+  802728:	41 5f                	pop    %r15
+  80272a:	5d                   	pop    %rbp
+  80272b:	c3                   	ret
+            return res;
+  80272c:	48 98                	cltq
+  80272e:	eb ed                	jmp    80271d <devfile_write_direct+0xea>
+
+0000000000802730 <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  802730:	55                   	push   %rbp
+  802731:	48 89 e5             	mov    %rsp,%rbp
+  802734:	41 54                	push   %r12
+  802736:	53                   	push   %rbx
+  802737:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  80273a:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802741:	00 00 00 
+  802744:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  802746:	48 85 c0             	test   %rax,%rax
+  802749:	74 71                	je     8027bc <fbuf_flush+0x8c>
+  80274b:	48 89 c3             	mov    %rax,%rbx
+  80274e:	b8 00 00 00 00       	mov    $0x0,%eax
+  802753:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  802757:	75 05                	jne    80275e <fbuf_flush+0x2e>
+}
+  802759:	5b                   	pop    %rbx
+  80275a:	41 5c                	pop    %r12
+  80275c:	5d                   	pop    %rbp
+  80275d:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80275e:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  802761:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  802765:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  80276c:	00 00 00 
+  80276f:	48 89 de             	mov    %rbx,%rsi
+  802772:	48 29 c6             	sub    %rax,%rsi
+  802775:	48 c1 fe 03          	sar    $0x3,%rsi
+  802779:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802780:	aa aa aa 
+  802783:	48 0f af f0          	imul   %rax,%rsi
+  802787:	48 c1 e6 0e          	shl    $0xe,%rsi
+  80278b:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802790:	48 01 c6             	add    %rax,%rsi
+  802793:	4c 89 e7             	mov    %r12,%rdi
+  802796:	48 b8 33 26 80 00 00 	movabs $0x802633,%rax
+  80279d:	00 00 00 
+  8027a0:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  8027a2:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  8027a6:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8027ad:	00 
+    return res < 0 ? res : 0;
+  8027ae:	48 85 c0             	test   %rax,%rax
+  8027b1:	ba 00 00 00 00       	mov    $0x0,%edx
+  8027b6:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8027ba:	eb 9d                	jmp    802759 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  8027bc:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c1:	eb 96                	jmp    802759 <fbuf_flush+0x29>
+
+00000000008027c3 <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  8027c3:	55                   	push   %rbp
+  8027c4:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  8027c7:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  8027ce:	00 00 00 
+  8027d1:	ff d0                	call   *%rax
+}
+  8027d3:	5d                   	pop    %rbp
+  8027d4:	c3                   	ret
+
+00000000008027d5 <devfile_write>:
+    if (!fd || !buf)
+  8027d5:	48 85 ff             	test   %rdi,%rdi
+  8027d8:	0f 84 d3 01 00 00    	je     8029b1 <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  8027de:	55                   	push   %rbp
+  8027df:	48 89 e5             	mov    %rsp,%rbp
+  8027e2:	41 57                	push   %r15
+  8027e4:	41 56                	push   %r14
+  8027e6:	41 55                	push   %r13
+  8027e8:	41 54                	push   %r12
+  8027ea:	53                   	push   %rbx
+  8027eb:	48 83 ec 08          	sub    $0x8,%rsp
+  8027ef:	49 89 fc             	mov    %rdi,%r12
+  8027f2:	49 89 f6             	mov    %rsi,%r14
+  8027f5:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8027f8:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8027fd:	48 85 f6             	test   %rsi,%rsi
+  802800:	0f 84 9c 01 00 00    	je     8029a2 <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  802806:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  80280d:	00 00 00 
+  802810:	ff d0                	call   *%rax
+  802812:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  802815:	48 85 c0             	test   %rax,%rax
+  802818:	0f 84 a2 00 00 00    	je     8028c0 <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  80281e:	be 00 10 00 00       	mov    $0x1000,%esi
+  802823:	4c 89 e7             	mov    %r12,%rdi
+  802826:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  80282d:	00 00 00 
+  802830:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  802832:	83 f8 02             	cmp    $0x2,%eax
+  802835:	0f 8f 85 00 00 00    	jg     8028c0 <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  80283b:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802842:	00 00 00 
+  802845:	4d 89 ef             	mov    %r13,%r15
+  802848:	49 29 c7             	sub    %rax,%r15
+  80284b:	49 c1 ff 03          	sar    $0x3,%r15
+  80284f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  802856:	aa aa aa 
+  802859:	4c 0f af f8          	imul   %rax,%r15
+  80285d:	49 c1 e7 0e          	shl    $0xe,%r15
+  802861:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802866:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  802869:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80286e:	0f 84 d7 00 00 00    	je     80294b <devfile_write+0x176>
+  802874:	49 8b 45 10          	mov    0x10(%r13),%rax
+  802878:	89 c2                	mov    %eax,%edx
+  80287a:	41 03 55 0c          	add    0xc(%r13),%edx
+  80287e:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  802883:	75 0f                	jne    802894 <devfile_write+0xbf>
+  802885:	48 01 d8             	add    %rbx,%rax
+  802888:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80288e:	0f 86 92 00 00 00    	jbe    802926 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  802894:	4c 89 e7             	mov    %r12,%rdi
+  802897:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  80289e:	00 00 00 
+  8028a1:	ff d0                	call   *%rax
+  8028a3:	85 c0                	test   %eax,%eax
+  8028a5:	78 52                	js     8028f9 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028a7:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8028ae:	77 7f                	ja     80292f <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  8028b0:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  8028b5:	0f 85 c2 00 00 00    	jne    80297d <devfile_write+0x1a8>
+  8028bb:	e9 94 00 00 00       	jmp    802954 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  8028c0:	4c 89 e7             	mov    %r12,%rdi
+  8028c3:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  8028ca:	00 00 00 
+  8028cd:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8028cf:	85 c0                	test   %eax,%eax
+  8028d1:	79 07                	jns    8028da <devfile_write+0x105>
+  8028d3:	48 98                	cltq
+  8028d5:	e9 c8 00 00 00       	jmp    8029a2 <devfile_write+0x1cd>
+  8028da:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8028df:	48 89 da             	mov    %rbx,%rdx
+  8028e2:	4c 89 f6             	mov    %r14,%rsi
+  8028e5:	4c 89 e7             	mov    %r12,%rdi
+  8028e8:	48 b8 33 26 80 00 00 	movabs $0x802633,%rax
+  8028ef:	00 00 00 
+  8028f2:	ff d0                	call   *%rax
+  8028f4:	e9 a9 00 00 00       	jmp    8029a2 <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8028f9:	48 98                	cltq
+  8028fb:	e9 a2 00 00 00       	jmp    8029a2 <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802900:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802905:	ba 00 40 00 00       	mov    $0x4000,%edx
+  80290a:	4c 89 fe             	mov    %r15,%rsi
+  80290d:	bf 00 00 00 00       	mov    $0x0,%edi
+  802912:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  802919:	00 00 00 
+  80291c:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  80291e:	85 c0                	test   %eax,%eax
+  802920:	79 45                	jns    802967 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802922:	48 98                	cltq
+  802924:	eb 7c                	jmp    8029a2 <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802926:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80292d:	76 4e                	jbe    80297d <devfile_write+0x1a8>
+  80292f:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802934:	48 89 da             	mov    %rbx,%rdx
+  802937:	4c 89 f6             	mov    %r14,%rsi
+  80293a:	4c 89 e7             	mov    %r12,%rdi
+  80293d:	48 b8 33 26 80 00 00 	movabs $0x802633,%rax
+  802944:	00 00 00 
+  802947:	ff d0                	call   *%rax
+  802949:	eb 57                	jmp    8029a2 <devfile_write+0x1cd>
+  80294b:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  802952:	77 db                	ja     80292f <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  802954:	4c 89 ff             	mov    %r15,%rdi
+  802957:	48 b8 fe 3e 80 00 00 	movabs $0x803efe,%rax
+  80295e:	00 00 00 
+  802961:	ff d0                	call   *%rax
+  802963:	84 c0                	test   %al,%al
+  802965:	74 99                	je     802900 <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  802967:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  80296c:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  802971:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  802975:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  80297c:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  80297d:	4c 89 ff             	mov    %r15,%rdi
+  802980:	49 03 7d 10          	add    0x10(%r13),%rdi
+  802984:	48 89 da             	mov    %rbx,%rdx
+  802987:	4c 89 f6             	mov    %r14,%rsi
+  80298a:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  802991:	00 00 00 
+  802994:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  802996:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  80299a:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80299f:	48 89 d8             	mov    %rbx,%rax
+}
+  8029a2:	48 83 c4 08          	add    $0x8,%rsp
+  8029a6:	5b                   	pop    %rbx
+  8029a7:	41 5c                	pop    %r12
+  8029a9:	41 5d                	pop    %r13
+  8029ab:	41 5e                	pop    %r14
+  8029ad:	41 5f                	pop    %r15
+  8029af:	5d                   	pop    %rbp
+  8029b0:	c3                   	ret
+        return E_INVAL;
+  8029b1:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  8029b6:	c3                   	ret
+
+00000000008029b7 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  8029b7:	55                   	push   %rbp
+  8029b8:	48 89 e5             	mov    %rsp,%rbp
+  8029bb:	41 54                	push   %r12
+  8029bd:	53                   	push   %rbx
+  8029be:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  8029c1:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  8029c8:	00 00 00 
+  8029cb:	ff d0                	call   *%rax
+  8029cd:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  8029d0:	48 89 df             	mov    %rbx,%rdi
+  8029d3:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8029da:	00 00 00 
+  8029dd:	ff d0                	call   *%rax
+  8029df:	48 85 c0             	test   %rax,%rax
+  8029e2:	74 17                	je     8029fb <devfile_flush+0x44>
+  8029e4:	48 89 df             	mov    %rbx,%rdi
+  8029e7:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  8029ee:	00 00 00 
+  8029f1:	ff d0                	call   *%rax
+  8029f3:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8029fa:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8029fb:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8029fe:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  802a05:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  802a07:	ba 00 00 00 00       	mov    $0x0,%edx
+  802a0c:	be 00 00 00 00       	mov    $0x0,%esi
+  802a11:	bf 06 00 00 00       	mov    $0x6,%edi
+  802a16:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802a1d:	00 00 00 
+  802a20:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  802a22:	45 85 e4             	test   %r12d,%r12d
+  802a25:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  802a29:	5b                   	pop    %rbx
+  802a2a:	41 5c                	pop    %r12
+  802a2c:	5d                   	pop    %rbp
+  802a2d:	c3                   	ret
+
+0000000000802a2e <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  802a2e:	55                   	push   %rbp
+  802a2f:	48 89 e5             	mov    %rsp,%rbp
+  802a32:	41 57                	push   %r15
+  802a34:	41 56                	push   %r14
+  802a36:	41 55                	push   %r13
+  802a38:	41 54                	push   %r12
+  802a3a:	53                   	push   %rbx
+  802a3b:	48 83 ec 38          	sub    $0x38,%rsp
+  802a3f:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  802a43:	49 89 f7             	mov    %rsi,%r15
+  802a46:	48 89 d3             	mov    %rdx,%rbx
+  802a49:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  802a4c:	48 b8 79 1f 80 00 00 	movabs $0x801f79,%rax
+  802a53:	00 00 00 
+  802a56:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a58:	48 85 c0             	test   %rax,%rax
+  802a5b:	75 20                	jne    802a7d <devfile_read_direct+0x4f>
+    bool map = 1;
+  802a5d:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  802a62:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  802a69:	00 
+    while (n) {
+  802a6a:	48 85 db             	test   %rbx,%rbx
+  802a6d:	0f 85 df 00 00 00    	jne    802b52 <devfile_read_direct+0x124>
+    size_t read = 0;
+  802a73:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  802a77:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802a7b:	eb 21                	jmp    802a9e <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  802a7d:	45 89 f1             	mov    %r14d,%r9d
+  802a80:	49 89 d8             	mov    %rbx,%r8
+  802a83:	4c 89 f9             	mov    %r15,%rcx
+  802a86:	ba 03 00 00 00       	mov    $0x3,%edx
+  802a8b:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802a8f:	48 89 c7             	mov    %rax,%rdi
+  802a92:	48 b8 60 20 80 00 00 	movabs $0x802060,%rax
+  802a99:	00 00 00 
+  802a9c:	ff d0                	call   *%rax
+}
+  802a9e:	48 83 c4 38          	add    $0x38,%rsp
+  802aa2:	5b                   	pop    %rbx
+  802aa3:	41 5c                	pop    %r12
+  802aa5:	41 5d                	pop    %r13
+  802aa7:	41 5e                	pop    %r14
+  802aa9:	41 5f                	pop    %r15
+  802aab:	5d                   	pop    %rbp
+  802aac:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802aad:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ab1:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  802ab7:	75 1e                	jne    802ad7 <devfile_read_direct+0xa9>
+  802ab9:	e9 e2 00 00 00       	jmp    802ba0 <devfile_read_direct+0x172>
+            if (!res) return read;
+  802abe:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  802ac2:	eb da                	jmp    802a9e <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  802ac4:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  802ac8:	0f 85 d0 01 00 00    	jne    802c9e <devfile_read_direct+0x270>
+            map = 0;
+  802ace:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802ad2:	eb 03                	jmp    802ad7 <devfile_read_direct+0xa9>
+  802ad4:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  802ad7:	ba 00 00 01 00       	mov    $0x10000,%edx
+  802adc:	48 39 d3             	cmp    %rdx,%rbx
+  802adf:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802ae3:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  802ae7:	8b 40 0c             	mov    0xc(%rax),%eax
+  802aea:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  802af1:	00 00 00 
+  802af4:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  802af6:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  802afa:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  802afe:	be 00 00 00 00       	mov    $0x0,%esi
+  802b03:	bf 03 00 00 00       	mov    $0x3,%edi
+  802b08:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802b0f:	00 00 00 
+  802b12:	ff d0                	call   *%rax
+        if (res <= 0)
+  802b14:	85 c0                	test   %eax,%eax
+  802b16:	0f 8e 63 01 00 00    	jle    802c7f <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  802b1c:	4c 63 e0             	movslq %eax,%r12
+  802b1f:	4c 89 e2             	mov    %r12,%rdx
+  802b22:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  802b29:	00 00 00 
+  802b2c:	4c 89 ff             	mov    %r15,%rdi
+  802b2f:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  802b36:	00 00 00 
+  802b39:	ff d0                	call   *%rax
+        buf += res;
+  802b3b:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  802b3e:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  802b41:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  802b45:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  802b49:	48 85 db             	test   %rbx,%rbx
+  802b4c:	0f 84 25 ff ff ff    	je     802a77 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  802b52:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  802b55:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  802b59:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  802b5d:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b61:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  802b68:	0f 97 c2             	seta   %dl
+  802b6b:	20 c2                	and    %al,%dl
+  802b6d:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  802b70:	0f 84 5e ff ff ff    	je     802ad4 <devfile_read_direct+0xa6>
+  802b76:	4c 89 fa             	mov    %r15,%rdx
+  802b79:	4d 89 fd             	mov    %r15,%r13
+  802b7c:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  802b83:	0f 85 4e ff ff ff    	jne    802ad7 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  802b89:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  802b8d:	0f 84 1a ff ff ff    	je     802aad <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  802b93:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  802b9a:	0f 85 37 ff ff ff    	jne    802ad7 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  802ba0:	48 89 d8             	mov    %rbx,%rax
+  802ba3:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  802ba9:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  802bae:	48 39 c8             	cmp    %rcx,%rax
+  802bb1:	48 0f 47 c1          	cmova  %rcx,%rax
+  802bb5:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  802bb9:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  802bbd:	49 89 d4             	mov    %rdx,%r12
+  802bc0:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  802bc4:	48 b8 9f 3e 80 00 00 	movabs $0x803e9f,%rax
+  802bcb:	00 00 00 
+  802bce:	ff d0                	call   *%rax
+  802bd0:	a8 40                	test   $0x40,%al
+  802bd2:	0f 85 b9 00 00 00    	jne    802c91 <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  802bd8:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  802bdf:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802be3:	49 39 c5             	cmp    %rax,%r13
+  802be6:	72 d8                	jb     802bc0 <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  802be8:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802bec:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802bf3:	00 00 00 
+  802bf6:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  802bfa:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  802bfd:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  802bff:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  802c03:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  802c07:	48 b8 14 1e 80 00 00 	movabs $0x801e14,%rax
+  802c0e:	00 00 00 
+  802c11:	ff d0                	call   *%rax
+  802c13:	89 c7                	mov    %eax,%edi
+  802c15:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  802c1b:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  802c20:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  802c27:	00 00 00 
+  802c2a:	be 0e 00 00 00       	mov    $0xe,%esi
+  802c2f:	48 b8 4f 48 80 00 00 	movabs $0x80484f,%rax
+  802c36:	00 00 00 
+  802c39:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  802c3b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802c40:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  802c44:	4c 89 fe             	mov    %r15,%rsi
+  802c47:	bf 00 00 00 00       	mov    $0x0,%edi
+  802c4c:	48 b8 2b 48 80 00 00 	movabs $0x80482b,%rax
+  802c53:	00 00 00 
+  802c56:	ff d0                	call   *%rax
+  802c58:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  802c5b:	48 85 d2             	test   %rdx,%rdx
+  802c5e:	0f 84 5a fe ff ff    	je     802abe <devfile_read_direct+0x90>
+            if (res > 0) {
+  802c64:	0f 8e 5a fe ff ff    	jle    802ac4 <devfile_read_direct+0x96>
+                buf += res;
+  802c6a:	48 98                	cltq
+  802c6c:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  802c6f:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  802c72:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  802c76:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  802c7a:	e9 ca fe ff ff       	jmp    802b49 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  802c7f:	41 89 c5             	mov    %eax,%r13d
+  802c82:	48 98                	cltq
+  802c84:	45 85 ed             	test   %r13d,%r13d
+  802c87:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  802c8c:	e9 0d fe ff ff       	jmp    802a9e <devfile_read_direct+0x70>
+            map = 0;
+  802c91:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  802c95:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  802c99:	e9 39 fe ff ff       	jmp    802ad7 <devfile_read_direct+0xa9>
+  802c9e:	48 89 d0             	mov    %rdx,%rax
+  802ca1:	e9 f8 fd ff ff       	jmp    802a9e <devfile_read_direct+0x70>
+
+0000000000802ca6 <devfile_read>:
+    if (!fd || !buf)
+  802ca6:	48 85 ff             	test   %rdi,%rdi
+  802ca9:	0f 84 21 02 00 00    	je     802ed0 <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  802caf:	55                   	push   %rbp
+  802cb0:	48 89 e5             	mov    %rsp,%rbp
+  802cb3:	41 57                	push   %r15
+  802cb5:	41 56                	push   %r14
+  802cb7:	41 55                	push   %r13
+  802cb9:	41 54                	push   %r12
+  802cbb:	53                   	push   %rbx
+  802cbc:	48 83 ec 28          	sub    $0x28,%rsp
+  802cc0:	48 89 fb             	mov    %rdi,%rbx
+  802cc3:	49 89 f4             	mov    %rsi,%r12
+  802cc6:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  802cc9:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  802cce:	48 85 f6             	test   %rsi,%rsi
+  802cd1:	74 4b                	je     802d1e <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  802cd3:	48 b8 e3 1f 80 00 00 	movabs $0x801fe3,%rax
+  802cda:	00 00 00 
+  802cdd:	ff d0                	call   *%rax
+  802cdf:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802ce2:	48 85 c0             	test   %rax,%rax
+  802ce5:	74 22                	je     802d09 <devfile_read+0x63>
+  802ce7:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  802cee:	77 19                	ja     802d09 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  802cf0:	be 00 10 00 00       	mov    $0x1000,%esi
+  802cf5:	48 89 df             	mov    %rbx,%rdi
+  802cf8:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  802cff:	00 00 00 
+  802d02:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  802d04:	83 f8 02             	cmp    $0x2,%eax
+  802d07:	7e 40                	jle    802d49 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  802d09:	48 89 df             	mov    %rbx,%rdi
+  802d0c:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  802d13:	00 00 00 
+  802d16:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d18:	85 c0                	test   %eax,%eax
+  802d1a:	79 11                	jns    802d2d <devfile_read+0x87>
+  802d1c:	48 98                	cltq
+}
+  802d1e:	48 83 c4 28          	add    $0x28,%rsp
+  802d22:	5b                   	pop    %rbx
+  802d23:	41 5c                	pop    %r12
+  802d25:	41 5d                	pop    %r13
+  802d27:	41 5e                	pop    %r14
+  802d29:	41 5f                	pop    %r15
+  802d2b:	5d                   	pop    %rbp
+  802d2c:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  802d2d:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  802d32:	4c 89 ea             	mov    %r13,%rdx
+  802d35:	4c 89 e6             	mov    %r12,%rsi
+  802d38:	48 89 df             	mov    %rbx,%rdi
+  802d3b:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  802d42:	00 00 00 
+  802d45:	ff d0                	call   *%rax
+  802d47:	eb d5                	jmp    802d1e <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  802d49:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802d4d:	48 89 df             	mov    %rbx,%rdi
+  802d50:	48 b8 30 27 80 00 00 	movabs $0x802730,%rax
+  802d57:	00 00 00 
+  802d5a:	ff d0                	call   *%rax
+  802d5c:	85 c0                	test   %eax,%eax
+  802d5e:	0f 88 33 01 00 00    	js     802e97 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  802d64:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  802d6b:	00 00 00 
+  802d6e:	4c 89 f0             	mov    %r14,%rax
+  802d71:	48 29 d0             	sub    %rdx,%rax
+  802d74:	48 c1 f8 03          	sar    $0x3,%rax
+  802d78:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  802d7f:	aa aa aa 
+  802d82:	48 0f af c2          	imul   %rdx,%rax
+  802d86:	48 c1 e0 0e          	shl    $0xe,%rax
+  802d8a:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802d8e:	8b 43 0c             	mov    0xc(%rbx),%eax
+  802d91:	41 39 06             	cmp    %eax,(%r14)
+  802d94:	75 0d                	jne    802da3 <devfile_read+0xfd>
+  802d96:	8b 43 10             	mov    0x10(%rbx),%eax
+  802d99:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  802d9d:	0f 84 fb 00 00 00    	je     802e9e <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  802da3:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802da8:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  802dac:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  802daf:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  802db3:	48 89 c7             	mov    %rax,%rdi
+  802db6:	48 b8 fe 3e 80 00 00 	movabs $0x803efe,%rax
+  802dbd:	00 00 00 
+  802dc0:	ff d0                	call   *%rax
+  802dc2:	84 c0                	test   %al,%al
+  802dc4:	75 27                	jne    802ded <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802dc6:	b9 06 00 00 00       	mov    $0x6,%ecx
+  802dcb:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802dd0:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802dd4:	bf 00 00 00 00       	mov    $0x0,%edi
+  802dd9:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  802de0:	00 00 00 
+  802de3:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  802de5:	85 c0                	test   %eax,%eax
+  802de7:	0f 88 dc 00 00 00    	js     802ec9 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  802ded:	44 89 f8             	mov    %r15d,%eax
+  802df0:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  802df5:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  802df7:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  802dfe:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  802dff:	8b 43 10             	mov    0x10(%rbx),%eax
+  802e02:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  802e06:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  802e09:	ba 00 40 00 00       	mov    $0x4000,%edx
+  802e0e:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  802e12:	48 89 df             	mov    %rbx,%rdi
+  802e15:	48 b8 2e 2a 80 00 00 	movabs $0x802a2e,%rax
+  802e1c:	00 00 00 
+  802e1f:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  802e21:	48 85 c0             	test   %rax,%rax
+  802e24:	0f 88 f4 fe ff ff    	js     802d1e <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  802e2a:	8b 53 0c             	mov    0xc(%rbx),%edx
+  802e2d:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  802e30:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  802e33:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  802e37:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  802e3b:	48 63 d1             	movslq %ecx,%rdx
+  802e3e:	48 01 d0             	add    %rdx,%rax
+  802e41:	4d 63 ff             	movslq %r15d,%r15
+  802e44:	4c 29 f8             	sub    %r15,%rax
+  802e47:	ba 00 00 00 00       	mov    $0x0,%edx
+  802e4c:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  802e50:	48 85 c0             	test   %rax,%rax
+  802e53:	0f 8e c5 fe ff ff    	jle    802d1e <devfile_read+0x78>
+    n = MIN(n, res);
+  802e59:	4c 39 e8             	cmp    %r13,%rax
+  802e5c:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  802e60:	8b 73 04             	mov    0x4(%rbx),%esi
+  802e63:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  802e67:	48 63 f6             	movslq %esi,%rsi
+  802e6a:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  802e6f:	48 01 c6             	add    %rax,%rsi
+  802e72:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  802e76:	48 01 c6             	add    %rax,%rsi
+  802e79:	4c 89 ea             	mov    %r13,%rdx
+  802e7c:	4c 89 e7             	mov    %r12,%rdi
+  802e7f:	48 b8 91 0e 80 00 00 	movabs $0x800e91,%rax
+  802e86:	00 00 00 
+  802e89:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  802e8b:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  802e8f:	4c 89 e8             	mov    %r13,%rax
+  802e92:	e9 87 fe ff ff       	jmp    802d1e <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  802e97:	48 98                	cltq
+  802e99:	e9 80 fe ff ff       	jmp    802d1e <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802e9e:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  802ea2:	41 39 d7             	cmp    %edx,%r15d
+  802ea5:	0f 8c f8 fe ff ff    	jl     802da3 <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  802eab:	49 8b 46 10          	mov    0x10(%r14),%rax
+  802eaf:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  802eb2:	41 39 cf             	cmp    %ecx,%r15d
+  802eb5:	0f 8d e8 fe ff ff    	jge    802da3 <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  802ebb:	4d 63 ff             	movslq %r15d,%r15
+  802ebe:	4c 29 f8             	sub    %r15,%rax
+  802ec1:	48 63 d2             	movslq %edx,%rdx
+  802ec4:	48 01 d0             	add    %rdx,%rax
+  802ec7:	eb 87                	jmp    802e50 <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  802ec9:	48 98                	cltq
+  802ecb:	e9 4e fe ff ff       	jmp    802d1e <devfile_read+0x78>
+        return E_INVAL;
+  802ed0:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  802ed5:	c3                   	ret
+
+0000000000802ed6 <fs_channel>:
+fs_channel(bool enable) {
+  802ed6:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  802ed8:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  802edf:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  802ee1:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ee6:	40 84 ff             	test   %dil,%dil
+  802ee9:	74 47                	je     802f32 <fs_channel+0x5c>
+  802eeb:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  802ef2:	00 00 00 
+  802ef5:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  802efb:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802f02:	00 00 00 
+  802f05:	3b 08                	cmp    (%rax),%ecx
+  802f07:	74 29                	je     802f32 <fs_channel+0x5c>
+fs_channel(bool enable) {
+  802f09:	55                   	push   %rbp
+  802f0a:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  802f0d:	48 b8 56 1e 80 00 00 	movabs $0x801e56,%rax
+  802f14:	00 00 00 
+  802f17:	ff d0                	call   *%rax
+  802f19:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  802f1b:	85 c0                	test   %eax,%eax
+  802f1d:	78 04                	js     802f23 <fs_channel+0x4d>
+}
+  802f1f:	89 d0                	mov    %edx,%eax
+  802f21:	5d                   	pop    %rbp
+  802f22:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  802f23:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f2a:	00 00 00 
+  802f2d:	c6 00 00             	movb   $0x0,(%rax)
+  802f30:	eb ed                	jmp    802f1f <fs_channel+0x49>
+}
+  802f32:	89 d0                	mov    %edx,%eax
+  802f34:	c3                   	ret
+
+0000000000802f35 <open>:
+open(const char *path, int mode) {
+  802f35:	55                   	push   %rbp
+  802f36:	48 89 e5             	mov    %rsp,%rbp
+  802f39:	41 55                	push   %r13
+  802f3b:	41 54                	push   %r12
+  802f3d:	53                   	push   %rbx
+  802f3e:	48 83 ec 18          	sub    $0x18,%rsp
+  802f42:	49 89 fc             	mov    %rdi,%r12
+  802f45:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  802f48:	48 b8 f2 0b 80 00 00 	movabs $0x800bf2,%rax
+  802f4f:	00 00 00 
+  802f52:	ff d0                	call   *%rax
+  802f54:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  802f5a:	0f 87 8f 00 00 00    	ja     802fef <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  802f60:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  802f64:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  802f6b:	00 00 00 
+  802f6e:	ff d0                	call   *%rax
+  802f70:	89 c3                	mov    %eax,%ebx
+  802f72:	85 c0                	test   %eax,%eax
+  802f74:	78 55                	js     802fcb <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  802f76:	4c 89 e6             	mov    %r12,%rsi
+  802f79:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  802f80:	00 00 00 
+  802f83:	48 89 df             	mov    %rbx,%rdi
+  802f86:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  802f8d:	00 00 00 
+  802f90:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  802f92:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  802f99:	ba 00 00 00 00       	mov    $0x0,%edx
+  802f9e:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  802fa2:	bf 01 00 00 00       	mov    $0x1,%edi
+  802fa7:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  802fae:	00 00 00 
+  802fb1:	ff d0                	call   *%rax
+  802fb3:	89 c3                	mov    %eax,%ebx
+  802fb5:	85 c0                	test   %eax,%eax
+  802fb7:	78 1f                	js     802fd8 <open+0xa3>
+    return fd2num(fd);
+  802fb9:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fbd:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  802fc4:	00 00 00 
+  802fc7:	ff d0                	call   *%rax
+  802fc9:	89 c3                	mov    %eax,%ebx
+}
+  802fcb:	89 d8                	mov    %ebx,%eax
+  802fcd:	48 83 c4 18          	add    $0x18,%rsp
+  802fd1:	5b                   	pop    %rbx
+  802fd2:	41 5c                	pop    %r12
+  802fd4:	41 5d                	pop    %r13
+  802fd6:	5d                   	pop    %rbp
+  802fd7:	c3                   	ret
+        fd_close(fd, 0);
+  802fd8:	be 00 00 00 00       	mov    $0x0,%esi
+  802fdd:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  802fe1:	48 b8 2b 18 80 00 00 	movabs $0x80182b,%rax
+  802fe8:	00 00 00 
+  802feb:	ff d0                	call   *%rax
+        return res;
+  802fed:	eb dc                	jmp    802fcb <open+0x96>
+        return -E_BAD_PATH;
+  802fef:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  802ff4:	eb d5                	jmp    802fcb <open+0x96>
+
+0000000000802ff6 <file_flush_buffers>:
+file_flush_buffers(void) {
+  802ff6:	55                   	push   %rbp
+  802ff7:	48 89 e5             	mov    %rsp,%rbp
+  802ffa:	41 56                	push   %r14
+  802ffc:	41 55                	push   %r13
+  802ffe:	41 54                	push   %r12
+  803000:	53                   	push   %rbx
+  803001:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803005:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  80300c:	00 00 00 
+  80300f:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803014:	49 bd 70 17 80 00 00 	movabs $0x801770,%r13
+  80301b:	00 00 00 
+  80301e:	49 be 30 27 80 00 00 	movabs $0x802730,%r14
+  803025:	00 00 00 
+  803028:	eb 0c                	jmp    803036 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  80302a:	83 c3 01             	add    $0x1,%ebx
+  80302d:	49 83 c4 18          	add    $0x18,%r12
+  803031:	83 fb 20             	cmp    $0x20,%ebx
+  803034:	74 1d                	je     803053 <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803036:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  80303b:	74 ed                	je     80302a <file_flush_buffers+0x34>
+  80303d:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803041:	89 df                	mov    %ebx,%edi
+  803043:	41 ff d5             	call   *%r13
+  803046:	85 c0                	test   %eax,%eax
+  803048:	78 e0                	js     80302a <file_flush_buffers+0x34>
+  80304a:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80304e:	41 ff d6             	call   *%r14
+  803051:	eb d7                	jmp    80302a <file_flush_buffers+0x34>
+}
+  803053:	48 83 c4 10          	add    $0x10,%rsp
+  803057:	5b                   	pop    %rbx
+  803058:	41 5c                	pop    %r12
+  80305a:	41 5d                	pop    %r13
+  80305c:	41 5e                	pop    %r14
+  80305e:	5d                   	pop    %rbp
+  80305f:	c3                   	ret
+
+0000000000803060 <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  803060:	55                   	push   %rbp
+  803061:	48 89 e5             	mov    %rsp,%rbp
+  803064:	41 54                	push   %r12
+  803066:	53                   	push   %rbx
+  803067:	49 89 fc             	mov    %rdi,%r12
+  80306a:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  80306c:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  803073:	00 00 00 
+  803076:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  803078:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80307f:	00 00 00 
+  803082:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  803087:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  803089:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  80308c:	ba 00 00 00 00       	mov    $0x0,%edx
+  803091:	be 00 00 00 00       	mov    $0x0,%esi
+  803096:	bf 02 00 00 00       	mov    $0x2,%edi
+  80309b:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8030a2:	00 00 00 
+  8030a5:	ff d0                	call   *%rax
+}
+  8030a7:	5b                   	pop    %rbx
+  8030a8:	41 5c                	pop    %r12
+  8030aa:	5d                   	pop    %rbp
+  8030ab:	c3                   	ret
+
+00000000008030ac <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  8030ac:	55                   	push   %rbp
+  8030ad:	48 89 e5             	mov    %rsp,%rbp
+  8030b0:	41 54                	push   %r12
+  8030b2:	53                   	push   %rbx
+  8030b3:	49 89 fc             	mov    %rdi,%r12
+  8030b6:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  8030b9:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  8030c0:	00 00 00 
+  8030c3:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  8030c5:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  8030ca:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8030d1:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  8030d3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8030d8:	be 00 00 00 00       	mov    $0x0,%esi
+  8030dd:	bf 05 00 00 00       	mov    $0x5,%edi
+  8030e2:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8030e9:	00 00 00 
+  8030ec:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8030ee:	85 c0                	test   %eax,%eax
+  8030f0:	78 3d                	js     80312f <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8030f2:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8030f9:	00 00 00 
+  8030fc:	4c 89 e6             	mov    %r12,%rsi
+  8030ff:	48 89 df             	mov    %rbx,%rdi
+  803102:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  803109:	00 00 00 
+  80310c:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  80310e:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  803115:	00 
+  803116:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  80311c:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  803123:	00 
+  803124:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  80312a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80312f:	5b                   	pop    %rbx
+  803130:	41 5c                	pop    %r12
+  803132:	5d                   	pop    %rbp
+  803133:	c3                   	ret
+
+0000000000803134 <remove>:
+remove(const char *path) {
+  803134:	55                   	push   %rbp
+  803135:	48 89 e5             	mov    %rsp,%rbp
+  803138:	53                   	push   %rbx
+  803139:	48 83 ec 08          	sub    $0x8,%rsp
+  80313d:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  803140:	48 b8 f2 0b 80 00 00 	movabs $0x800bf2,%rax
+  803147:	00 00 00 
+  80314a:	ff d0                	call   *%rax
+  80314c:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803152:	77 3a                	ja     80318e <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  803154:	48 89 de             	mov    %rbx,%rsi
+  803157:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80315e:	00 00 00 
+  803161:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  803168:	00 00 00 
+  80316b:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  80316d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803172:	be 00 00 00 00       	mov    $0x0,%esi
+  803177:	bf 07 00 00 00       	mov    $0x7,%edi
+  80317c:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  803183:	00 00 00 
+  803186:	ff d0                	call   *%rax
+}
+  803188:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80318c:	c9                   	leave
+  80318d:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80318e:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  803193:	eb f3                	jmp    803188 <remove+0x54>
+
+0000000000803195 <sync>:
+sync(void) {
+  803195:	55                   	push   %rbp
+  803196:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  803199:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  8031a0:	00 00 00 
+  8031a3:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  8031a5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8031aa:	be 00 00 00 00       	mov    $0x0,%esi
+  8031af:	bf 08 00 00 00       	mov    $0x8,%edi
+  8031b4:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8031bb:	00 00 00 
+  8031be:	ff d0                	call   *%rax
+}
+  8031c0:	5d                   	pop    %rbp
+  8031c1:	c3                   	ret
+
+00000000008031c2 <fsync>:
+fsync(int fdnum) {
+  8031c2:	55                   	push   %rbp
+  8031c3:	48 89 e5             	mov    %rsp,%rbp
+  8031c6:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8031ca:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8031ce:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  8031d5:	00 00 00 
+  8031d8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8031da:	85 c0                	test   %eax,%eax
+  8031dc:	78 4b                	js     803229 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8031de:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8031e2:	48 b8 20 60 80 00 00 	movabs $0x806020,%rax
+  8031e9:	00 00 00 
+  8031ec:	8b 00                	mov    (%rax),%eax
+  8031ee:	39 02                	cmp    %eax,(%rdx)
+  8031f0:	75 39                	jne    80322b <fsync+0x69>
+    file_flush_buffers();
+  8031f2:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  8031f9:	00 00 00 
+  8031fc:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8031fe:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  803202:	8b 40 0c             	mov    0xc(%rax),%eax
+  803205:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80320c:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  80320e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803213:	be 00 00 00 00       	mov    $0x0,%esi
+  803218:	bf 0d 00 00 00       	mov    $0xd,%edi
+  80321d:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  803224:	00 00 00 
+  803227:	ff d0                	call   *%rax
+}
+  803229:	c9                   	leave
+  80322a:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80322b:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803230:	eb f7                	jmp    803229 <fsync+0x67>
+
+0000000000803232 <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  803232:	55                   	push   %rbp
+  803233:	48 89 e5             	mov    %rsp,%rbp
+  803236:	53                   	push   %rbx
+  803237:	48 83 ec 08          	sub    $0x8,%rsp
+  80323b:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  80323e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803243:	be 00 00 00 00       	mov    $0x0,%esi
+  803248:	bf 0b 00 00 00       	mov    $0xb,%edi
+  80324d:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  803254:	00 00 00 
+  803257:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803259:	85 c0                	test   %eax,%eax
+  80325b:	78 2d                	js     80328a <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  80325d:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  803264:	00 00 00 
+  803267:	48 8b 10             	mov    (%rax),%rdx
+  80326a:	48 89 13             	mov    %rdx,(%rbx)
+  80326d:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  803271:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  803275:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  803279:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  80327d:	48 8b 40 18          	mov    0x18(%rax),%rax
+  803281:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  803285:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80328a:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80328e:	c9                   	leave
+  80328f:	c3                   	ret
+
+0000000000803290 <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  803290:	55                   	push   %rbp
+  803291:	48 89 e5             	mov    %rsp,%rbp
+  803294:	53                   	push   %rbx
+  803295:	48 83 ec 08          	sub    $0x8,%rsp
+  803299:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  80329c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8032a1:	be 00 00 00 00       	mov    $0x0,%esi
+  8032a6:	bf 0c 00 00 00       	mov    $0xc,%edi
+  8032ab:	48 b8 c7 24 80 00 00 	movabs $0x8024c7,%rax
+  8032b2:	00 00 00 
+  8032b5:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8032b7:	85 c0                	test   %eax,%eax
+  8032b9:	78 3d                	js     8032f8 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  8032bb:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  8032c2:	00 00 00 
+  8032c5:	48 8b 10             	mov    (%rax),%rdx
+  8032c8:	48 89 13             	mov    %rdx,(%rbx)
+  8032cb:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  8032cf:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  8032d3:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  8032d7:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  8032db:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  8032df:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  8032e3:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8032e7:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8032eb:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8032ef:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8032f3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8032f8:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8032fc:	c9                   	leave
+  8032fd:	c3                   	ret
+
+00000000008032fe <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8032fe:	55                   	push   %rbp
+  8032ff:	48 89 e5             	mov    %rsp,%rbp
+  803302:	41 57                	push   %r15
+  803304:	41 56                	push   %r14
+  803306:	41 55                	push   %r13
+  803308:	41 54                	push   %r12
+  80330a:	53                   	push   %rbx
+  80330b:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  80330f:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  803316:	00 
+  803317:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80331e:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803324:	0f 85 43 01 00 00    	jne    80346d <munmap+0x16f>
+  80332a:	49 89 ff             	mov    %rdi,%r15
+  80332d:	4c 39 f7             	cmp    %r14,%rdi
+  803330:	0f 87 37 01 00 00    	ja     80346d <munmap+0x16f>
+  803336:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  80333d:	00 00 00 
+  803340:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  803346:	eb 2c                	jmp    803374 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  803348:	4c 39 f8             	cmp    %r15,%rax
+  80334b:	0f 83 85 00 00 00    	jae    8033d6 <munmap+0xd8>
+            m->mm_end = start;
+  803351:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803356:	48 83 c3 18          	add    $0x18,%rbx
+  80335a:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803361:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803368:	00 00 00 
+  80336b:	48 39 c3             	cmp    %rax,%rbx
+  80336e:	0f 84 d0 00 00 00    	je     803444 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  803374:	49 89 dc             	mov    %rbx,%r12
+  803377:	48 8b 03             	mov    (%rbx),%rax
+  80337a:	4c 39 f0             	cmp    %r14,%rax
+  80337d:	73 d7                	jae    803356 <munmap+0x58>
+  80337f:	48 85 c0             	test   %rax,%rax
+  803382:	74 d2                	je     803356 <munmap+0x58>
+  803384:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  803388:	49 39 d7             	cmp    %rdx,%r15
+  80338b:	73 c9                	jae    803356 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  80338d:	49 39 d6             	cmp    %rdx,%r14
+  803390:	73 b6                	jae    803348 <munmap+0x4a>
+  803392:	49 39 c7             	cmp    %rax,%r15
+  803395:	76 b1                	jbe    803348 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  803397:	4c 89 ef             	mov    %r13,%rdi
+  80339a:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  8033a1:	00 00 00 
+  8033a4:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  8033a6:	48 85 c0             	test   %rax,%rax
+  8033a9:	0f 84 c5 00 00 00    	je     803474 <munmap+0x176>
+            *tail = *m;
+  8033af:	48 8b 13             	mov    (%rbx),%rdx
+  8033b2:	48 89 10             	mov    %rdx,(%rax)
+  8033b5:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  8033b9:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  8033bd:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  8033c1:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  8033c5:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  8033c8:	44 89 f2             	mov    %r14d,%edx
+  8033cb:	2b 13                	sub    (%rbx),%edx
+  8033cd:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  8033d0:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  8033d4:	eb 80                	jmp    803356 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  8033d6:	49 39 d6             	cmp    %rdx,%r14
+  8033d9:	73 18                	jae    8033f3 <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  8033db:	44 89 f2             	mov    %r14d,%edx
+  8033de:	41 03 54 24 10       	add    0x10(%r12),%edx
+  8033e3:	29 c2                	sub    %eax,%edx
+  8033e5:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8033ea:	4d 89 34 24          	mov    %r14,(%r12)
+  8033ee:	e9 63 ff ff ff       	jmp    803356 <munmap+0x58>
+    m->mm_start = 0;
+  8033f3:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8033fa:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8033fb:	4c 89 e6             	mov    %r12,%rsi
+  8033fe:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803405:	00 00 00 
+  803408:	48 29 c6             	sub    %rax,%rsi
+  80340b:	48 c1 fe 03          	sar    $0x3,%rsi
+  80340f:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803416:	aa aa aa 
+  803419:	48 0f af f0          	imul   %rax,%rsi
+  80341d:	48 c1 e6 0c          	shl    $0xc,%rsi
+  803421:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  803426:	48 01 c6             	add    %rax,%rsi
+  803429:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80342e:	bf 00 00 00 00       	mov    $0x0,%edi
+  803433:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  80343a:	00 00 00 
+  80343d:	ff d0                	call   *%rax
+}
+  80343f:	e9 12 ff ff ff       	jmp    803356 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  803444:	4c 89 f2             	mov    %r14,%rdx
+  803447:	4c 29 fa             	sub    %r15,%rdx
+  80344a:	4c 89 fe             	mov    %r15,%rsi
+  80344d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803452:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803459:	00 00 00 
+  80345c:	ff d0                	call   *%rax
+}
+  80345e:	48 83 c4 08          	add    $0x8,%rsp
+  803462:	5b                   	pop    %rbx
+  803463:	41 5c                	pop    %r12
+  803465:	41 5d                	pop    %r13
+  803467:	41 5e                	pop    %r14
+  803469:	41 5f                	pop    %r15
+  80346b:	5d                   	pop    %rbp
+  80346c:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  80346d:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  803472:	eb ea                	jmp    80345e <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  803474:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  803479:	eb e3                	jmp    80345e <munmap+0x160>
+
+000000000080347b <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  80347b:	55                   	push   %rbp
+  80347c:	48 89 e5             	mov    %rsp,%rbp
+  80347f:	41 57                	push   %r15
+  803481:	41 56                	push   %r14
+  803483:	41 55                	push   %r13
+  803485:	41 54                	push   %r12
+  803487:	53                   	push   %rbx
+  803488:	48 83 ec 28          	sub    $0x28,%rsp
+  80348c:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  803490:	49 89 f5             	mov    %rsi,%r13
+  803493:	41 89 d6             	mov    %edx,%r14d
+  803496:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  803499:	41 89 cc             	mov    %ecx,%r12d
+  80349c:	44 89 c7             	mov    %r8d,%edi
+  80349f:	44 89 cb             	mov    %r9d,%ebx
+  8034a2:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  8034a6:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  8034aa:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  8034b1:	00 00 00 
+  8034b4:	ff d0                	call   *%rax
+  8034b6:	41 89 c7             	mov    %eax,%r15d
+  8034b9:	85 c0                	test   %eax,%eax
+  8034bb:	0f 88 ae 01 00 00    	js     80366f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8034c1:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8034c5:	48 ba 20 60 80 00 00 	movabs $0x806020,%rdx
+  8034cc:	00 00 00 
+  8034cf:	8b 32                	mov    (%rdx),%esi
+  8034d1:	39 30                	cmp    %esi,(%rax)
+  8034d3:	0f 85 7a 02 00 00    	jne    803753 <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  8034d9:	8b 40 08             	mov    0x8(%rax),%eax
+  8034dc:	83 e0 03             	and    $0x3,%eax
+  8034df:	83 f8 01             	cmp    $0x1,%eax
+  8034e2:	0f 84 76 02 00 00    	je     80375e <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8034e8:	4d 85 ed             	test   %r13,%r13
+  8034eb:	0f 84 78 02 00 00    	je     803769 <mmap+0x2ee>
+  8034f1:	85 db                	test   %ebx,%ebx
+  8034f3:	0f 88 70 02 00 00    	js     803769 <mmap+0x2ee>
+  8034f9:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8034ff:	41 89 df             	mov    %ebx,%r15d
+  803502:	0f 85 6c 02 00 00    	jne    803774 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  803508:	44 89 f0             	mov    %r14d,%eax
+  80350b:	83 e0 fd             	and    $0xfffffffd,%eax
+  80350e:	83 f8 04             	cmp    $0x4,%eax
+  803511:	0f 85 68 02 00 00    	jne    80377f <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  803517:	44 89 e1             	mov    %r12d,%ecx
+  80351a:	83 e1 01             	and    $0x1,%ecx
+  80351d:	0f 95 c2             	setne  %dl
+  803520:	44 89 e0             	mov    %r12d,%eax
+  803523:	d1 e8                	shr    %eax
+  803525:	83 f0 01             	xor    $0x1,%eax
+  803528:	83 e0 01             	and    $0x1,%eax
+  80352b:	38 c2                	cmp    %al,%dl
+  80352d:	0f 85 57 02 00 00    	jne    80378a <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803533:	85 c9                	test   %ecx,%ecx
+  803535:	74 0a                	je     803541 <mmap+0xc6>
+  803537:	41 f6 c6 02          	test   $0x2,%r14b
+  80353b:	0f 85 54 02 00 00    	jne    803795 <mmap+0x31a>
+    file_flush_buffers();
+  803541:	48 b8 f6 2f 80 00 00 	movabs $0x802ff6,%rax
+  803548:	00 00 00 
+  80354b:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  80354d:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  803554:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  80355b:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80355f:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  803562:	41 f6 c4 04          	test   $0x4,%r12b
+  803566:	0f 84 15 01 00 00    	je     803681 <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  80356c:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80356f:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  803575:	0f 85 25 02 00 00    	jne    8037a0 <mmap+0x325>
+  80357b:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80357f:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  803586:	00 00 00 
+  803589:	48 39 c2             	cmp    %rax,%rdx
+  80358c:	0f 82 19 02 00 00    	jb     8037ab <mmap+0x330>
+  803592:	48 39 c7             	cmp    %rax,%rdi
+  803595:	0f 87 10 02 00 00    	ja     8037ab <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  80359b:	4c 89 ee             	mov    %r13,%rsi
+  80359e:	48 b8 fe 32 80 00 00 	movabs $0x8032fe,%rax
+  8035a5:	00 00 00 
+  8035a8:	ff d0                	call   *%rax
+  8035aa:	85 c0                	test   %eax,%eax
+  8035ac:	0f 88 04 02 00 00    	js     8037b6 <mmap+0x33b>
+    if (!handler) {
+  8035b2:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035b9:	00 00 00 
+  8035bc:	80 38 00             	cmpb   $0x0,(%rax)
+  8035bf:	75 2b                	jne    8035ec <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8035c1:	48 bf 96 23 80 00 00 	movabs $0x802396,%rdi
+  8035c8:	00 00 00 
+  8035cb:	48 b8 fa 44 80 00 00 	movabs $0x8044fa,%rax
+  8035d2:	00 00 00 
+  8035d5:	ff d0                	call   *%rax
+  8035d7:	85 c0                	test   %eax,%eax
+  8035d9:	0f 88 ea 01 00 00    	js     8037c9 <mmap+0x34e>
+        handler = 1;
+  8035df:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8035e6:	00 00 00 
+  8035e9:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8035ec:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8035f0:	48 b8 35 24 80 00 00 	movabs $0x802435,%rax
+  8035f7:	00 00 00 
+  8035fa:	ff d0                	call   *%rax
+  8035fc:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8035ff:	48 85 c0             	test   %rax,%rax
+  803602:	0f 84 c9 01 00 00    	je     8037d1 <mmap+0x356>
+    m->mm_start = va;
+  803608:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  80360b:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  80360f:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  803613:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  803616:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  80361a:	44 89 e0             	mov    %r12d,%eax
+  80361d:	c1 e0 06             	shl    $0x6,%eax
+  803620:	25 80 00 00 00       	and    $0x80,%eax
+  803625:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  803628:	09 f0                	or     %esi,%eax
+  80362a:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  80362e:	41 f6 c4 08          	test   $0x8,%r12b
+  803632:	74 31                	je     803665 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  803634:	48 39 d3             	cmp    %rdx,%rbx
+  803637:	73 2c                	jae    803665 <mmap+0x1ea>
+  803639:	ba 00 00 04 00       	mov    $0x40000,%edx
+  80363e:	48 89 de             	mov    %rbx,%rsi
+  803641:	4c 89 f7             	mov    %r14,%rdi
+  803644:	48 b8 85 22 80 00 00 	movabs $0x802285,%rax
+  80364b:	00 00 00 
+  80364e:	ff d0                	call   *%rax
+  803650:	49 89 c4             	mov    %rax,%r12
+  803653:	48 85 c0             	test   %rax,%rax
+  803656:	0f 8e d7 00 00 00    	jle    803733 <mmap+0x2b8>
+            va += n;
+  80365c:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80365f:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  803663:	72 d4                	jb     803639 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  803665:	49 8b 06             	mov    (%r14),%rax
+  803668:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  80366c:	48 89 06             	mov    %rax,(%rsi)
+}
+  80366f:	44 89 f8             	mov    %r15d,%eax
+  803672:	48 83 c4 28          	add    $0x28,%rsp
+  803676:	5b                   	pop    %rbx
+  803677:	41 5c                	pop    %r12
+  803679:	41 5d                	pop    %r13
+  80367b:	41 5e                	pop    %r14
+  80367d:	41 5f                	pop    %r15
+  80367f:	5d                   	pop    %rbp
+  803680:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803681:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  803688:	00 00 00 
+  80368b:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80368e:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  803695:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  803698:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80369d:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  8036a4:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036a7:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  8036ae:	00 00 00 
+  8036b1:	48 39 d7             	cmp    %rdx,%rdi
+  8036b4:	73 1c                	jae    8036d2 <mmap+0x257>
+        return -E_NO_MEM;
+  8036b6:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8036bc:	eb b1                	jmp    80366f <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036be:	48 83 c0 01          	add    $0x1,%rax
+  8036c2:	48 83 f8 1f          	cmp    $0x1f,%rax
+  8036c6:	77 3f                	ja     803707 <mmap+0x28c>
+  8036c8:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  8036cd:	48 39 d7             	cmp    %rdx,%rdi
+  8036d0:	72 2a                	jb     8036fc <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  8036d2:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  8036d6:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  8036da:	48 39 d1             	cmp    %rdx,%rcx
+  8036dd:	73 df                	jae    8036be <mmap+0x243>
+  8036df:	48 85 c9             	test   %rcx,%rcx
+  8036e2:	74 da                	je     8036be <mmap+0x243>
+  8036e4:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8036e8:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8036ed:	48 39 d3             	cmp    %rdx,%rbx
+  8036f0:	73 cc                	jae    8036be <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8036f2:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8036f5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8036fa:	eb cc                	jmp    8036c8 <mmap+0x24d>
+        return -E_NO_MEM;
+  8036fc:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  803702:	e9 68 ff ff ff       	jmp    80366f <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  803707:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  80370c:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  803713:	00 00 00 
+  803716:	48 39 c2             	cmp    %rax,%rdx
+  803719:	0f 82 9f 00 00 00    	jb     8037be <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  80371f:	48 85 db             	test   %rbx,%rbx
+  803722:	0f 85 8a fe ff ff    	jne    8035b2 <mmap+0x137>
+        return -E_NO_MEM;
+  803728:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  80372e:	e9 3c ff ff ff       	jmp    80366f <mmap+0x1f4>
+        if (n < 0) {
+  803733:	0f 89 2c ff ff ff    	jns    803665 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  803739:	49 8b 3e             	mov    (%r14),%rdi
+  80373c:	4c 89 ee             	mov    %r13,%rsi
+  80373f:	48 b8 fe 32 80 00 00 	movabs $0x8032fe,%rax
+  803746:	00 00 00 
+  803749:	ff d0                	call   *%rax
+            return n;
+  80374b:	45 89 e7             	mov    %r12d,%r15d
+  80374e:	e9 1c ff ff ff       	jmp    80366f <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  803753:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803759:	e9 11 ff ff ff       	jmp    80366f <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80375e:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803764:	e9 06 ff ff ff       	jmp    80366f <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  803769:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80376f:	e9 fb fe ff ff       	jmp    80366f <mmap+0x1f4>
+  803774:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80377a:	e9 f0 fe ff ff       	jmp    80366f <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80377f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803785:	e9 e5 fe ff ff       	jmp    80366f <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  80378a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  803790:	e9 da fe ff ff       	jmp    80366f <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  803795:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  80379b:	e9 cf fe ff ff       	jmp    80366f <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  8037a0:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037a6:	e9 c4 fe ff ff       	jmp    80366f <mmap+0x1f4>
+  8037ab:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  8037b1:	e9 b9 fe ff ff       	jmp    80366f <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  8037b6:	41 89 c7             	mov    %eax,%r15d
+  8037b9:	e9 b1 fe ff ff       	jmp    80366f <mmap+0x1f4>
+        return -E_NO_MEM;
+  8037be:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037c4:	e9 a6 fe ff ff       	jmp    80366f <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  8037c9:	41 89 c7             	mov    %eax,%r15d
+  8037cc:	e9 9e fe ff ff       	jmp    80366f <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  8037d1:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8037d7:	e9 93 fe ff ff       	jmp    80366f <mmap+0x1f4>
+
+00000000008037dc <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8037dc:	55                   	push   %rbp
+  8037dd:	48 89 e5             	mov    %rsp,%rbp
+  8037e0:	41 54                	push   %r12
+  8037e2:	53                   	push   %rbx
+  8037e3:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  8037e6:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  8037ed:	00 00 00 
+  8037f0:	ff d0                	call   *%rax
+  8037f2:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  8037f5:	48 be a0 4f 80 00 00 	movabs $0x804fa0,%rsi
+  8037fc:	00 00 00 
+  8037ff:	48 89 df             	mov    %rbx,%rdi
+  803802:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  803809:	00 00 00 
+  80380c:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  80380e:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  803813:	41 2b 04 24          	sub    (%r12),%eax
+  803817:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  80381d:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  803824:	00 00 00 
+    stat->st_dev = &devpipe;
+  803827:	48 b8 60 60 80 00 00 	movabs $0x806060,%rax
+  80382e:	00 00 00 
+  803831:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  803838:	b8 00 00 00 00       	mov    $0x0,%eax
+  80383d:	5b                   	pop    %rbx
+  80383e:	41 5c                	pop    %r12
+  803840:	5d                   	pop    %rbp
+  803841:	c3                   	ret
+
+0000000000803842 <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803842:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803845:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  80384b:	8b 17                	mov    (%rdi),%edx
+  80384d:	85 d2                	test   %edx,%edx
+  80384f:	75 01                	jne    803852 <pipe_wakeup+0x10>
+  803851:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  803852:	55                   	push   %rbp
+  803853:	48 89 e5             	mov    %rsp,%rbp
+  803856:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  803859:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  80385f:	be 00 04 00 00       	mov    $0x400,%esi
+  803864:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  80386b:	00 00 00 
+  80386e:	ff d0                	call   *%rax
+}
+  803870:	5d                   	pop    %rbp
+  803871:	c3                   	ret
+
+0000000000803872 <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  803872:	55                   	push   %rbp
+  803873:	48 89 e5             	mov    %rsp,%rbp
+  803876:	41 55                	push   %r13
+  803878:	41 54                	push   %r12
+  80387a:	53                   	push   %rbx
+  80387b:	48 83 ec 08          	sub    $0x8,%rsp
+  80387f:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803882:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803889:	00 00 00 
+  80388c:	ff d0                	call   *%rax
+  80388e:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  803891:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803896:	4c 89 e6             	mov    %r12,%rsi
+  803899:	bf 00 00 00 00       	mov    $0x0,%edi
+  80389e:	49 bc 35 12 80 00 00 	movabs $0x801235,%r12
+  8038a5:	00 00 00 
+  8038a8:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8038ab:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8038af:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8038b3:	49 bd 42 38 80 00 00 	movabs $0x803842,%r13
+  8038ba:	00 00 00 
+  8038bd:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8038c0:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8038c4:	48 89 de             	mov    %rbx,%rsi
+  8038c7:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8038ca:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8038cf:	48 89 de             	mov    %rbx,%rsi
+  8038d2:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038d7:	41 ff d4             	call   *%r12
+  8038da:	48 83 c4 08          	add    $0x8,%rsp
+  8038de:	5b                   	pop    %rbx
+  8038df:	41 5c                	pop    %r12
+  8038e1:	41 5d                	pop    %r13
+  8038e3:	5d                   	pop    %rbp
+  8038e4:	c3                   	ret
+
+00000000008038e5 <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8038e5:	55                   	push   %rbp
+  8038e6:	48 89 e5             	mov    %rsp,%rbp
+  8038e9:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  8038ec:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  8038f1:	be 00 10 00 00       	mov    $0x1000,%esi
+  8038f6:	48 b8 78 11 80 00 00 	movabs $0x801178,%rax
+  8038fd:	00 00 00 
+  803900:	ff d0                	call   *%rax
+  803902:	85 c0                	test   %eax,%eax
+  803904:	0f 94 c0             	sete   %al
+  803907:	0f b6 c0             	movzbl %al,%eax
+}
+  80390a:	5d                   	pop    %rbp
+  80390b:	c3                   	ret
+
+000000000080390c <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  80390c:	55                   	push   %rbp
+  80390d:	48 89 e5             	mov    %rsp,%rbp
+  803910:	41 57                	push   %r15
+  803912:	41 56                	push   %r14
+  803914:	41 55                	push   %r13
+  803916:	41 54                	push   %r12
+  803918:	53                   	push   %rbx
+  803919:	48 83 ec 38          	sub    $0x38,%rsp
+  80391d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803921:	49 89 f4             	mov    %rsi,%r12
+  803924:	49 89 d7             	mov    %rdx,%r15
+  803927:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80392b:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803932:	00 00 00 
+  803935:	ff d0                	call   *%rax
+  803937:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  80393a:	4d 85 ff             	test   %r15,%r15
+  80393d:	0f 84 f1 00 00 00    	je     803a34 <devpipe_write+0x128>
+  803943:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  803947:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  80394b:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  80394f:	49 bd e5 38 80 00 00 	movabs $0x8038e5,%r13
+  803956:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803959:	49 bf 42 38 80 00 00 	movabs $0x803842,%r15
+  803960:	00 00 00 
+  803963:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803967:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80396b:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  80396f:	8b 73 04             	mov    0x4(%rbx),%esi
+  803972:	48 63 ce             	movslq %esi,%rcx
+  803975:	48 63 03             	movslq (%rbx),%rax
+  803978:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  80397e:	48 39 c1             	cmp    %rax,%rcx
+  803981:	72 64                	jb     8039e7 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  803983:	48 89 de             	mov    %rbx,%rsi
+  803986:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  80398a:	41 ff d5             	call   *%r13
+  80398d:	85 c0                	test   %eax,%eax
+  80398f:	0f 85 b9 00 00 00    	jne    803a4e <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803995:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803999:	4c 89 f7             	mov    %r14,%rdi
+  80399c:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  80399f:	8b 43 04             	mov    0x4(%rbx),%eax
+  8039a2:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8039a9:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8039b0:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8039b6:	8b 03                	mov    (%rbx),%eax
+  8039b8:	41 39 c4             	cmp    %eax,%r12d
+  8039bb:	75 b2                	jne    80396f <devpipe_write+0x63>
+  8039bd:	48 89 de             	mov    %rbx,%rsi
+  8039c0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8039c4:	41 ff d5             	call   *%r13
+  8039c7:	85 c0                	test   %eax,%eax
+  8039c9:	75 a0                	jne    80396b <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8039cb:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8039d0:	44 89 e6             	mov    %r12d,%esi
+  8039d3:	48 89 df             	mov    %rbx,%rdi
+  8039d6:	48 b8 fd 14 80 00 00 	movabs $0x8014fd,%rax
+  8039dd:	00 00 00 
+  8039e0:	ff d0                	call   *%rax
+  8039e2:	e9 7c ff ff ff       	jmp    803963 <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  8039e7:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  8039eb:	41 0f b6 38          	movzbl (%r8),%edi
+  8039ef:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  8039f6:	80 80 80 
+  8039f9:	48 89 c8             	mov    %rcx,%rax
+  8039fc:	48 f7 e2             	mul    %rdx
+  8039ff:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803a03:	48 89 d0             	mov    %rdx,%rax
+  803a06:	48 c1 e0 08          	shl    $0x8,%rax
+  803a0a:	48 29 d0             	sub    %rdx,%rax
+  803a0d:	48 c1 e0 04          	shl    $0x4,%rax
+  803a11:	48 29 c1             	sub    %rax,%rcx
+  803a14:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  803a19:	83 c6 01             	add    $0x1,%esi
+  803a1c:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803a1f:	49 83 c0 01          	add    $0x1,%r8
+  803a23:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  803a27:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a2b:	49 39 c0             	cmp    %rax,%r8
+  803a2e:	0f 85 2f ff ff ff    	jne    803963 <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  803a34:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  803a38:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  803a3c:	48 b8 42 38 80 00 00 	movabs $0x803842,%rax
+  803a43:	00 00 00 
+  803a46:	ff d0                	call   *%rax
+    return n;
+  803a48:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a4c:	eb 05                	jmp    803a53 <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  803a4e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  803a53:	48 83 c4 38          	add    $0x38,%rsp
+  803a57:	5b                   	pop    %rbx
+  803a58:	41 5c                	pop    %r12
+  803a5a:	41 5d                	pop    %r13
+  803a5c:	41 5e                	pop    %r14
+  803a5e:	41 5f                	pop    %r15
+  803a60:	5d                   	pop    %rbp
+  803a61:	c3                   	ret
+
+0000000000803a62 <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  803a62:	55                   	push   %rbp
+  803a63:	48 89 e5             	mov    %rsp,%rbp
+  803a66:	41 57                	push   %r15
+  803a68:	41 56                	push   %r14
+  803a6a:	41 55                	push   %r13
+  803a6c:	41 54                	push   %r12
+  803a6e:	53                   	push   %rbx
+  803a6f:	48 83 ec 28          	sub    $0x28,%rsp
+  803a73:	49 89 fd             	mov    %rdi,%r13
+  803a76:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803a7a:	49 89 d4             	mov    %rdx,%r12
+  803a7d:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  803a81:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803a88:	00 00 00 
+  803a8b:	ff d0                	call   *%rax
+  803a8d:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  803a90:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  803a96:	49 bf e5 38 80 00 00 	movabs $0x8038e5,%r15
+  803a9d:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  803aa0:	4d 85 e4             	test   %r12,%r12
+  803aa3:	0f 84 d5 00 00 00    	je     803b7e <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803aa9:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  803aad:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  803ab1:	8b 03                	mov    (%rbx),%eax
+  803ab3:	3b 43 04             	cmp    0x4(%rbx),%eax
+  803ab6:	75 7a                	jne    803b32 <devpipe_read+0xd0>
+            if (i > 0) {
+  803ab8:	4d 85 f6             	test   %r14,%r14
+  803abb:	75 50                	jne    803b0d <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  803abd:	48 89 de             	mov    %rbx,%rsi
+  803ac0:	4c 89 ef             	mov    %r13,%rdi
+  803ac3:	41 ff d7             	call   *%r15
+  803ac6:	85 c0                	test   %eax,%eax
+  803ac8:	0f 85 c9 00 00 00    	jne    803b97 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  803ace:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  803ad1:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  803ad8:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  803ade:	8b 43 04             	mov    0x4(%rbx),%eax
+  803ae1:	41 39 c4             	cmp    %eax,%r12d
+  803ae4:	75 cb                	jne    803ab1 <devpipe_read+0x4f>
+  803ae6:	48 89 de             	mov    %rbx,%rsi
+  803ae9:	4c 89 ef             	mov    %r13,%rdi
+  803aec:	41 ff d7             	call   *%r15
+  803aef:	85 c0                	test   %eax,%eax
+  803af1:	75 be                	jne    803ab1 <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  803af3:	ba 0a 00 00 00       	mov    $0xa,%edx
+  803af8:	44 89 e6             	mov    %r12d,%esi
+  803afb:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  803aff:	48 b8 fd 14 80 00 00 	movabs $0x8014fd,%rax
+  803b06:	00 00 00 
+  803b09:	ff d0                	call   *%rax
+  803b0b:	eb a4                	jmp    803ab1 <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b0d:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b11:	48 89 de             	mov    %rbx,%rsi
+  803b14:	48 b8 42 38 80 00 00 	movabs $0x803842,%rax
+  803b1b:	00 00 00 
+  803b1e:	ff d0                	call   *%rax
+                return i;
+  803b20:	4c 89 f0             	mov    %r14,%rax
+}
+  803b23:	48 83 c4 28          	add    $0x28,%rsp
+  803b27:	5b                   	pop    %rbx
+  803b28:	41 5c                	pop    %r12
+  803b2a:	41 5d                	pop    %r13
+  803b2c:	41 5e                	pop    %r14
+  803b2e:	41 5f                	pop    %r15
+  803b30:	5d                   	pop    %rbp
+  803b31:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  803b32:	48 63 c8             	movslq %eax,%rcx
+  803b35:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  803b3c:	80 80 80 
+  803b3f:	48 89 c8             	mov    %rcx,%rax
+  803b42:	48 f7 e2             	mul    %rdx
+  803b45:	48 c1 ea 0b          	shr    $0xb,%rdx
+  803b49:	48 89 d0             	mov    %rdx,%rax
+  803b4c:	48 c1 e0 08          	shl    $0x8,%rax
+  803b50:	48 29 d0             	sub    %rdx,%rax
+  803b53:	48 c1 e0 04          	shl    $0x4,%rax
+  803b57:	48 89 c2             	mov    %rax,%rdx
+  803b5a:	48 89 c8             	mov    %rcx,%rax
+  803b5d:	48 29 d0             	sub    %rdx,%rax
+  803b60:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  803b65:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803b69:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  803b6d:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  803b70:	49 83 c6 01          	add    $0x1,%r14
+  803b74:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  803b78:	0f 85 2b ff ff ff    	jne    803aa9 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  803b7e:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  803b82:	48 89 de             	mov    %rbx,%rsi
+  803b85:	48 b8 42 38 80 00 00 	movabs $0x803842,%rax
+  803b8c:	00 00 00 
+  803b8f:	ff d0                	call   *%rax
+    return n;
+  803b91:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803b95:	eb 8c                	jmp    803b23 <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  803b97:	b8 00 00 00 00       	mov    $0x0,%eax
+  803b9c:	eb 85                	jmp    803b23 <devpipe_read+0xc1>
+
+0000000000803b9e <pipe>:
+pipe(int pfd[2]) {
+  803b9e:	55                   	push   %rbp
+  803b9f:	48 89 e5             	mov    %rsp,%rbp
+  803ba2:	41 55                	push   %r13
+  803ba4:	41 54                	push   %r12
+  803ba6:	53                   	push   %rbx
+  803ba7:	48 83 ec 18          	sub    $0x18,%rsp
+  803bab:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803bae:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803bb2:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  803bb9:	00 00 00 
+  803bbc:	ff d0                	call   *%rax
+  803bbe:	89 c3                	mov    %eax,%ebx
+  803bc0:	85 c0                	test   %eax,%eax
+  803bc2:	0f 88 a0 01 00 00    	js     803d68 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  803bc8:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803bcd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803bd2:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803bd6:	bf 00 00 00 00       	mov    $0x0,%edi
+  803bdb:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  803be2:	00 00 00 
+  803be5:	ff d0                	call   *%rax
+  803be7:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  803be9:	85 c0                	test   %eax,%eax
+  803beb:	0f 88 77 01 00 00    	js     803d68 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803bf1:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  803bf5:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  803bfc:	00 00 00 
+  803bff:	ff d0                	call   *%rax
+  803c01:	89 c3                	mov    %eax,%ebx
+  803c03:	85 c0                	test   %eax,%eax
+  803c05:	0f 88 43 01 00 00    	js     803d4e <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  803c0b:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c10:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c15:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803c19:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c1e:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  803c25:	00 00 00 
+  803c28:	ff d0                	call   *%rax
+  803c2a:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  803c2c:	85 c0                	test   %eax,%eax
+  803c2e:	0f 88 1a 01 00 00    	js     803d4e <pipe+0x1b0>
+    va = fd2data(fd0);
+  803c34:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803c38:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803c3f:	00 00 00 
+  803c42:	ff d0                	call   *%rax
+  803c44:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  803c47:	b9 46 00 00 00       	mov    $0x46,%ecx
+  803c4c:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803c51:	48 89 c6             	mov    %rax,%rsi
+  803c54:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c59:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  803c60:	00 00 00 
+  803c63:	ff d0                	call   *%rax
+  803c65:	89 c3                	mov    %eax,%ebx
+  803c67:	85 c0                	test   %eax,%eax
+  803c69:	0f 88 c5 00 00 00    	js     803d34 <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  803c6f:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803c73:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803c7a:	00 00 00 
+  803c7d:	ff d0                	call   *%rax
+  803c7f:	48 89 c1             	mov    %rax,%rcx
+  803c82:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  803c88:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803c8e:	ba 00 00 00 00       	mov    $0x0,%edx
+  803c93:	4c 89 ee             	mov    %r13,%rsi
+  803c96:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c9b:	48 b8 e5 11 80 00 00 	movabs $0x8011e5,%rax
+  803ca2:	00 00 00 
+  803ca5:	ff d0                	call   *%rax
+  803ca7:	89 c3                	mov    %eax,%ebx
+  803ca9:	85 c0                	test   %eax,%eax
+  803cab:	78 6e                	js     803d1b <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803cad:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cb2:	4c 89 ef             	mov    %r13,%rdi
+  803cb5:	48 b8 54 11 80 00 00 	movabs $0x801154,%rax
+  803cbc:	00 00 00 
+  803cbf:	ff d0                	call   *%rax
+  803cc1:	83 f8 02             	cmp    $0x2,%eax
+  803cc4:	0f 85 ab 00 00 00    	jne    803d75 <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  803cca:	a1 60 60 80 00 00 00 	movabs 0x806060,%eax
+  803cd1:	00 00 
+  803cd3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cd7:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  803cd9:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  803cdd:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  803ce4:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  803ce8:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  803cea:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  803cee:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  803cf5:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803cf9:	48 bb e2 16 80 00 00 	movabs $0x8016e2,%rbx
+  803d00:	00 00 00 
+  803d03:	ff d3                	call   *%rbx
+  803d05:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  803d09:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  803d0d:	ff d3                	call   *%rbx
+  803d0f:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  803d14:	bb 00 00 00 00       	mov    $0x0,%ebx
+  803d19:	eb 4d                	jmp    803d68 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  803d1b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d20:	4c 89 ee             	mov    %r13,%rsi
+  803d23:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d28:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803d2f:	00 00 00 
+  803d32:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  803d34:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d39:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  803d3d:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d42:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803d49:	00 00 00 
+  803d4c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  803d4e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  803d53:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803d57:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d5c:	48 b8 35 12 80 00 00 	movabs $0x801235,%rax
+  803d63:	00 00 00 
+  803d66:	ff d0                	call   *%rax
+}
+  803d68:	89 d8                	mov    %ebx,%eax
+  803d6a:	48 83 c4 18          	add    $0x18,%rsp
+  803d6e:	5b                   	pop    %rbx
+  803d6f:	41 5c                	pop    %r12
+  803d71:	41 5d                	pop    %r13
+  803d73:	5d                   	pop    %rbp
+  803d74:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  803d75:	48 b9 d0 4f 80 00 00 	movabs $0x804fd0,%rcx
+  803d7c:	00 00 00 
+  803d7f:	48 ba a7 4f 80 00 00 	movabs $0x804fa7,%rdx
+  803d86:	00 00 00 
+  803d89:	be 50 00 00 00       	mov    $0x50,%esi
+  803d8e:	48 bf bc 4f 80 00 00 	movabs $0x804fbc,%rdi
+  803d95:	00 00 00 
+  803d98:	b8 00 00 00 00       	mov    $0x0,%eax
+  803d9d:	49 b8 cd 43 80 00 00 	movabs $0x8043cd,%r8
+  803da4:	00 00 00 
+  803da7:	41 ff d0             	call   *%r8
+
+0000000000803daa <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  803daa:	55                   	push   %rbp
+  803dab:	48 89 e5             	mov    %rsp,%rbp
+  803dae:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  803db2:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  803db6:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  803dbd:	00 00 00 
+  803dc0:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  803dc2:	85 c0                	test   %eax,%eax
+  803dc4:	78 23                	js     803de9 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  803dc6:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803dca:	48 b8 f4 16 80 00 00 	movabs $0x8016f4,%rax
+  803dd1:	00 00 00 
+  803dd4:	ff d0                	call   *%rax
+  803dd6:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  803dd9:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  803ddd:	48 b8 e5 38 80 00 00 	movabs $0x8038e5,%rax
+  803de4:	00 00 00 
+  803de7:	ff d0                	call   *%rax
+}
+  803de9:	c9                   	leave
+  803dea:	c3                   	ret
+
+0000000000803deb <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803deb:	48 89 f8             	mov    %rdi,%rax
+  803dee:	48 c1 e8 27          	shr    $0x27,%rax
+  803df2:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803df9:	01 00 00 
+  803dfc:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e00:	f6 c2 01             	test   $0x1,%dl
+  803e03:	74 6d                	je     803e72 <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e05:	48 89 f8             	mov    %rdi,%rax
+  803e08:	48 c1 e8 1e          	shr    $0x1e,%rax
+  803e0c:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e13:	01 00 00 
+  803e16:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e1a:	f6 c2 01             	test   $0x1,%dl
+  803e1d:	74 62                	je     803e81 <get_uvpt_entry+0x96>
+  803e1f:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e26:	01 00 00 
+  803e29:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e2d:	f6 c2 80             	test   $0x80,%dl
+  803e30:	75 4f                	jne    803e81 <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e32:	48 89 f8             	mov    %rdi,%rax
+  803e35:	48 c1 e8 15          	shr    $0x15,%rax
+  803e39:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e40:	01 00 00 
+  803e43:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e47:	f6 c2 01             	test   $0x1,%dl
+  803e4a:	74 44                	je     803e90 <get_uvpt_entry+0xa5>
+  803e4c:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e53:	01 00 00 
+  803e56:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  803e5a:	f6 c2 80             	test   $0x80,%dl
+  803e5d:	75 31                	jne    803e90 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  803e5f:	48 c1 ef 0c          	shr    $0xc,%rdi
+  803e63:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  803e6a:	01 00 00 
+  803e6d:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  803e71:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  803e72:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  803e79:	01 00 00 
+  803e7c:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e80:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  803e81:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  803e88:	01 00 00 
+  803e8b:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e8f:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  803e90:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  803e97:	01 00 00 
+  803e9a:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  803e9e:	c3                   	ret
+
+0000000000803e9f <get_prot>:
+
+int
+get_prot(void *va) {
+  803e9f:	55                   	push   %rbp
+  803ea0:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ea3:	48 b8 eb 3d 80 00 00 	movabs $0x803deb,%rax
+  803eaa:	00 00 00 
+  803ead:	ff d0                	call   *%rax
+  803eaf:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  803eb2:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  803eb7:	89 c1                	mov    %eax,%ecx
+  803eb9:	83 c9 04             	or     $0x4,%ecx
+  803ebc:	f6 c2 01             	test   $0x1,%dl
+  803ebf:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  803ec2:	89 c1                	mov    %eax,%ecx
+  803ec4:	83 c9 02             	or     $0x2,%ecx
+  803ec7:	f6 c2 02             	test   $0x2,%dl
+  803eca:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  803ecd:	89 c1                	mov    %eax,%ecx
+  803ecf:	83 c9 01             	or     $0x1,%ecx
+  803ed2:	48 85 d2             	test   %rdx,%rdx
+  803ed5:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  803ed8:	89 c1                	mov    %eax,%ecx
+  803eda:	83 c9 40             	or     $0x40,%ecx
+  803edd:	f6 c6 04             	test   $0x4,%dh
+  803ee0:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  803ee3:	5d                   	pop    %rbp
+  803ee4:	c3                   	ret
+
+0000000000803ee5 <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  803ee5:	55                   	push   %rbp
+  803ee6:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  803ee9:	48 b8 eb 3d 80 00 00 	movabs $0x803deb,%rax
+  803ef0:	00 00 00 
+  803ef3:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  803ef5:	48 c1 e8 06          	shr    $0x6,%rax
+  803ef9:	83 e0 01             	and    $0x1,%eax
+}
+  803efc:	5d                   	pop    %rbp
+  803efd:	c3                   	ret
+
+0000000000803efe <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  803efe:	55                   	push   %rbp
+  803eff:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  803f02:	48 b8 eb 3d 80 00 00 	movabs $0x803deb,%rax
+  803f09:	00 00 00 
+  803f0c:	ff d0                	call   *%rax
+  803f0e:	83 e0 01             	and    $0x1,%eax
+}
+  803f11:	5d                   	pop    %rbp
+  803f12:	c3                   	ret
+
+0000000000803f13 <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  803f13:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  803f1a:	01 00 00 
+  803f1d:	a8 01                	test   $0x1,%al
+  803f1f:	75 06                	jne    803f27 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  803f21:	b8 00 00 00 00       	mov    $0x0,%eax
+  803f26:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  803f27:	55                   	push   %rbp
+  803f28:	48 89 e5             	mov    %rsp,%rbp
+  803f2b:	41 57                	push   %r15
+  803f2d:	41 56                	push   %r14
+  803f2f:	41 55                	push   %r13
+  803f31:	41 54                	push   %r12
+  803f33:	53                   	push   %rbx
+  803f34:	48 83 ec 28          	sub    $0x28,%rsp
+  803f38:	49 89 fe             	mov    %rdi,%r14
+  803f3b:	49 89 f7             	mov    %rsi,%r15
+  803f3e:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  803f45:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803f46:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  803f4d:	01 00 00 
+  803f50:	e9 ae 00 00 00       	jmp    804003 <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803f55:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  803f5c:	49 83 ec 01          	sub    $0x1,%r12
+  803f60:	74 2d                	je     803f8f <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  803f62:	48 89 d8             	mov    %rbx,%rax
+  803f65:	48 c1 e8 0c          	shr    $0xc,%rax
+  803f69:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  803f6e:	f6 c2 01             	test   $0x1,%dl
+  803f71:	74 e2                	je     803f55 <foreach_shared_region+0x42>
+  803f73:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  803f78:	f6 c4 04             	test   $0x4,%ah
+  803f7b:	74 d8                	je     803f55 <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  803f7d:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  803f84:	4c 89 fa             	mov    %r15,%rdx
+  803f87:	48 89 df             	mov    %rbx,%rdi
+  803f8a:	41 ff d6             	call   *%r14
+  803f8d:	eb c6                	jmp    803f55 <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  803f8f:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  803f96:	00 
+  803f97:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  803f9c:	74 4a                	je     803fe8 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  803f9e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803fa2:	48 c1 e8 15          	shr    $0x15,%rax
+  803fa6:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  803fad:	01 00 00 
+  803fb0:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  803fb4:	a8 01                	test   $0x1,%al
+  803fb6:	74 d7                	je     803f8f <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  803fb8:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  803fbc:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  803fc3:	48 39 c3             	cmp    %rax,%rbx
+  803fc6:	73 c7                	jae    803f8f <foreach_shared_region+0x7c>
+  803fc8:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  803fcf:	48 39 d0             	cmp    %rdx,%rax
+  803fd2:	4d 19 e4             	sbb    %r12,%r12
+  803fd5:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  803fdc:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  803fe3:	e9 7a ff ff ff       	jmp    803f62 <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  803fe8:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  803fef:	40 
+  803ff0:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  803ff4:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  803ffb:	00 00 00 
+  803ffe:	48 39 c1             	cmp    %rax,%rcx
+  804001:	74 50                	je     804053 <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  804003:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  804007:	48 c1 e8 1e          	shr    $0x1e,%rax
+  80400b:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  804012:	01 00 00 
+  804015:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  804019:	a8 01                	test   $0x1,%al
+  80401b:	74 cb                	je     803fe8 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  80401d:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  804021:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  804028:	48 39 c1             	cmp    %rax,%rcx
+  80402b:	73 bb                	jae    803fe8 <foreach_shared_region+0xd5>
+  80402d:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  804034:	48 39 d0             	cmp    %rdx,%rax
+  804037:	48 19 c0             	sbb    %rax,%rax
+  80403a:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  804040:	48 05 00 02 00 00    	add    $0x200,%rax
+  804046:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80404a:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  80404e:	e9 4b ff ff ff       	jmp    803f9e <foreach_shared_region+0x8b>
+  804053:	b8 00 00 00 00       	mov    $0x0,%eax
+  804058:	48 83 c4 28          	add    $0x28,%rsp
+  80405c:	5b                   	pop    %rbx
+  80405d:	41 5c                	pop    %r12
+  80405f:	41 5d                	pop    %r13
+  804061:	41 5e                	pop    %r14
+  804063:	41 5f                	pop    %r15
+  804065:	5d                   	pop    %rbp
+  804066:	c3                   	ret
+
+0000000000804067 <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  804067:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  80406d:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  804074:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  80407b:	c3                   	ret
+
+000000000080407c <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  80407c:	8b 47 40             	mov    0x40(%rdi),%eax
+  80407f:	8b 17                	mov    (%rdi),%edx
+  804081:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  804083:	83 f8 0f             	cmp    $0xf,%eax
+  804086:	77 13                	ja     80409b <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  804088:	8b 47 40             	mov    0x40(%rdi),%eax
+  80408b:	83 e0 0f             	and    $0xf,%eax
+  80408e:	48 c1 e0 09          	shl    $0x9,%rax
+  804092:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  804099:	00 
+  80409a:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  80409b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040a0:	c3                   	ret
+
+00000000008040a1 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  8040a1:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040a4:	83 c0 01             	add    $0x1,%eax
+  8040a7:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8040aa:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8040b0:	8b 57 04             	mov    0x4(%rdi),%edx
+  8040b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8040b8:	85 d2                	test   %edx,%edx
+  8040ba:	75 04                	jne    8040c0 <chan_publish+0x1f>
+  8040bc:	83 e0 01             	and    $0x1,%eax
+}
+  8040bf:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  8040c0:	87 47 04             	xchg   %eax,0x4(%rdi)
+  8040c3:	85 c0                	test   %eax,%eax
+  8040c5:	0f 95 c0             	setne  %al
+  8040c8:	0f b6 c0             	movzbl %al,%eax
+  8040cb:	eb ef                	jmp    8040bc <chan_publish+0x1b>
+
+00000000008040cd <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  8040cd:	8b 47 40             	mov    0x40(%rdi),%eax
+  8040d0:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8040d2:	29 d0                	sub    %edx,%eax
+  8040d4:	83 e8 01             	sub    $0x1,%eax
+  8040d7:	83 f8 0f             	cmp    $0xf,%eax
+  8040da:	77 12                	ja     8040ee <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  8040dc:	8b 07                	mov    (%rdi),%eax
+  8040de:	83 e0 0f             	and    $0xf,%eax
+  8040e1:	48 c1 e0 09          	shl    $0x9,%rax
+  8040e5:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  8040ec:	00 
+  8040ed:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  8040ee:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040f3:	c3                   	ret
+
+00000000008040f4 <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  8040f4:	8b 07                	mov    (%rdi),%eax
+  8040f6:	83 c0 01             	add    $0x1,%eax
+  8040f9:	89 07                	mov    %eax,(%rdi)
+}
+  8040fb:	c3                   	ret
+
+00000000008040fc <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  8040fc:	55                   	push   %rbp
+  8040fd:	48 89 e5             	mov    %rsp,%rbp
+  804100:	53                   	push   %rbx
+  804101:	48 83 ec 08          	sub    $0x8,%rsp
+  804105:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  804108:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80410f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  804115:	48 b8 cd 40 80 00 00 	movabs $0x8040cd,%rax
+  80411c:	00 00 00 
+  80411f:	ff d0                	call   *%rax
+  804121:	48 85 c0             	test   %rax,%rax
+  804124:	74 12                	je     804138 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  804126:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  80412d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804132:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804136:	c9                   	leave
+  804137:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  804138:	b8 01 00 00 00       	mov    $0x1,%eax
+  80413d:	eb f3                	jmp    804132 <chan_arm+0x36>
+
+000000000080413f <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  80413f:	55                   	push   %rbp
+  804140:	48 89 e5             	mov    %rsp,%rbp
+  804143:	41 56                	push   %r14
+  804145:	41 55                	push   %r13
+  804147:	41 54                	push   %r12
+  804149:	53                   	push   %rbx
+  80414a:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  80414d:	49 bc fc 40 80 00 00 	movabs $0x8040fc,%r12
+  804154:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804157:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  80415b:	49 bd fd 14 80 00 00 	movabs $0x8014fd,%r13
+  804162:	00 00 00 
+    while (chan_arm(r))
+  804165:	eb 0d                	jmp    804174 <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  804167:	8b 33                	mov    (%rbx),%esi
+  804169:	ba 00 00 00 00       	mov    $0x0,%edx
+  80416e:	4c 89 f7             	mov    %r14,%rdi
+  804171:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  804174:	48 89 df             	mov    %rbx,%rdi
+  804177:	41 ff d4             	call   *%r12
+  80417a:	84 c0                	test   %al,%al
+  80417c:	75 e9                	jne    804167 <chan_wait+0x28>
+}
+  80417e:	5b                   	pop    %rbx
+  80417f:	41 5c                	pop    %r12
+  804181:	41 5d                	pop    %r13
+  804183:	41 5e                	pop    %r14
+  804185:	5d                   	pop    %rbp
+  804186:	c3                   	ret
+
+0000000000804187 <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  804187:	55                   	push   %rbp
+  804188:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  80418b:	48 83 c7 40          	add    $0x40,%rdi
+  80418f:	be 01 00 00 00       	mov    $0x1,%esi
+  804194:	48 b8 1b 15 80 00 00 	movabs $0x80151b,%rax
+  80419b:	00 00 00 
+  80419e:	ff d0                	call   *%rax
+}
+  8041a0:	5d                   	pop    %rbp
+  8041a1:	c3                   	ret
+
+00000000008041a2 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  8041a2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041a7:	c3                   	ret
+
+00000000008041a8 <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  8041a8:	55                   	push   %rbp
+  8041a9:	48 89 e5             	mov    %rsp,%rbp
+  8041ac:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  8041af:	48 be f4 4f 80 00 00 	movabs $0x804ff4,%rsi
+  8041b6:	00 00 00 
+  8041b9:	48 b8 30 0c 80 00 00 	movabs $0x800c30,%rax
+  8041c0:	00 00 00 
+  8041c3:	ff d0                	call   *%rax
+    return 0;
+}
+  8041c5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8041ca:	5d                   	pop    %rbp
+  8041cb:	c3                   	ret
+
+00000000008041cc <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8041cc:	55                   	push   %rbp
+  8041cd:	48 89 e5             	mov    %rsp,%rbp
+  8041d0:	41 57                	push   %r15
+  8041d2:	41 56                	push   %r14
+  8041d4:	41 55                	push   %r13
+  8041d6:	41 54                	push   %r12
+  8041d8:	53                   	push   %rbx
+  8041d9:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8041e0:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8041e7:	48 85 d2             	test   %rdx,%rdx
+  8041ea:	74 7a                	je     804266 <devcons_write+0x9a>
+  8041ec:	49 89 d6             	mov    %rdx,%r14
+  8041ef:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8041f5:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8041fa:	49 bf 2a 0e 80 00 00 	movabs $0x800e2a,%r15
+  804201:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  804204:	4c 89 f3             	mov    %r14,%rbx
+  804207:	48 29 f3             	sub    %rsi,%rbx
+  80420a:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  80420f:	48 39 c3             	cmp    %rax,%rbx
+  804212:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  804216:	4c 63 eb             	movslq %ebx,%r13
+  804219:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  804220:	48 01 c6             	add    %rax,%rsi
+  804223:	4c 89 ea             	mov    %r13,%rdx
+  804226:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80422d:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  804230:	4c 89 ee             	mov    %r13,%rsi
+  804233:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80423a:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  804241:	00 00 00 
+  804244:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  804246:	41 01 dc             	add    %ebx,%r12d
+  804249:	49 63 f4             	movslq %r12d,%rsi
+  80424c:	4c 39 f6             	cmp    %r14,%rsi
+  80424f:	72 b3                	jb     804204 <devcons_write+0x38>
+    return res;
+  804251:	49 63 c4             	movslq %r12d,%rax
+}
+  804254:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80425b:	5b                   	pop    %rbx
+  80425c:	41 5c                	pop    %r12
+  80425e:	41 5d                	pop    %r13
+  804260:	41 5e                	pop    %r14
+  804262:	41 5f                	pop    %r15
+  804264:	5d                   	pop    %rbp
+  804265:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  804266:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80426c:	eb e3                	jmp    804251 <devcons_write+0x85>
+
+000000000080426e <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80426e:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  804271:	ba 00 00 00 00       	mov    $0x0,%edx
+  804276:	48 85 c0             	test   %rax,%rax
+  804279:	74 55                	je     8042d0 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80427b:	55                   	push   %rbp
+  80427c:	48 89 e5             	mov    %rsp,%rbp
+  80427f:	41 55                	push   %r13
+  804281:	41 54                	push   %r12
+  804283:	53                   	push   %rbx
+  804284:	48 83 ec 08          	sub    $0x8,%rsp
+  804288:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80428b:	48 bb 76 10 80 00 00 	movabs $0x801076,%rbx
+  804292:	00 00 00 
+  804295:	49 bc 2b 11 80 00 00 	movabs $0x80112b,%r12
+  80429c:	00 00 00 
+  80429f:	eb 03                	jmp    8042a4 <devcons_read+0x36>
+  8042a1:	41 ff d4             	call   *%r12
+  8042a4:	ff d3                	call   *%rbx
+  8042a6:	85 c0                	test   %eax,%eax
+  8042a8:	74 f7                	je     8042a1 <devcons_read+0x33>
+    if (c < 0) return c;
+  8042aa:	48 63 d0             	movslq %eax,%rdx
+  8042ad:	78 13                	js     8042c2 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  8042af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8042b4:	83 f8 04             	cmp    $0x4,%eax
+  8042b7:	74 09                	je     8042c2 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  8042b9:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8042bd:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8042c2:	48 89 d0             	mov    %rdx,%rax
+  8042c5:	48 83 c4 08          	add    $0x8,%rsp
+  8042c9:	5b                   	pop    %rbx
+  8042ca:	41 5c                	pop    %r12
+  8042cc:	41 5d                	pop    %r13
+  8042ce:	5d                   	pop    %rbp
+  8042cf:	c3                   	ret
+  8042d0:	48 89 d0             	mov    %rdx,%rax
+  8042d3:	c3                   	ret
+
+00000000008042d4 <cputchar>:
+cputchar(int ch) {
+  8042d4:	55                   	push   %rbp
+  8042d5:	48 89 e5             	mov    %rsp,%rbp
+  8042d8:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8042dc:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8042e0:	be 01 00 00 00       	mov    $0x1,%esi
+  8042e5:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8042e9:	48 b8 57 10 80 00 00 	movabs $0x801057,%rax
+  8042f0:	00 00 00 
+  8042f3:	ff d0                	call   *%rax
+}
+  8042f5:	c9                   	leave
+  8042f6:	c3                   	ret
+
+00000000008042f7 <getchar>:
+getchar(void) {
+  8042f7:	55                   	push   %rbp
+  8042f8:	48 89 e5             	mov    %rsp,%rbp
+  8042fb:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8042ff:	ba 01 00 00 00       	mov    $0x1,%edx
+  804304:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  804308:	bf 00 00 00 00       	mov    $0x0,%edi
+  80430d:	48 b8 53 1a 80 00 00 	movabs $0x801a53,%rax
+  804314:	00 00 00 
+  804317:	ff d0                	call   *%rax
+  804319:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  80431b:	85 c0                	test   %eax,%eax
+  80431d:	78 06                	js     804325 <getchar+0x2e>
+  80431f:	74 08                	je     804329 <getchar+0x32>
+  804321:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  804325:	89 d0                	mov    %edx,%eax
+  804327:	c9                   	leave
+  804328:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  804329:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  80432e:	eb f5                	jmp    804325 <getchar+0x2e>
+
+0000000000804330 <iscons>:
+iscons(int fdnum) {
+  804330:	55                   	push   %rbp
+  804331:	48 89 e5             	mov    %rsp,%rbp
+  804334:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804338:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80433c:	48 b8 70 17 80 00 00 	movabs $0x801770,%rax
+  804343:	00 00 00 
+  804346:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804348:	85 c0                	test   %eax,%eax
+  80434a:	78 18                	js     804364 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  80434c:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  804350:	48 b8 a0 60 80 00 00 	movabs $0x8060a0,%rax
+  804357:	00 00 00 
+  80435a:	8b 00                	mov    (%rax),%eax
+  80435c:	39 02                	cmp    %eax,(%rdx)
+  80435e:	0f 94 c0             	sete   %al
+  804361:	0f b6 c0             	movzbl %al,%eax
+}
+  804364:	c9                   	leave
+  804365:	c3                   	ret
+
+0000000000804366 <opencons>:
+opencons(void) {
+  804366:	55                   	push   %rbp
+  804367:	48 89 e5             	mov    %rsp,%rbp
+  80436a:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  80436e:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  804372:	48 b8 10 17 80 00 00 	movabs $0x801710,%rax
+  804379:	00 00 00 
+  80437c:	ff d0                	call   *%rax
+  80437e:	85 c0                	test   %eax,%eax
+  804380:	78 49                	js     8043cb <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  804382:	b9 46 00 00 00       	mov    $0x46,%ecx
+  804387:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80438c:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  804390:	bf 00 00 00 00       	mov    $0x0,%edi
+  804395:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  80439c:	00 00 00 
+  80439f:	ff d0                	call   *%rax
+  8043a1:	85 c0                	test   %eax,%eax
+  8043a3:	78 26                	js     8043cb <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  8043a5:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  8043a9:	a1 a0 60 80 00 00 00 	movabs 0x8060a0,%eax
+  8043b0:	00 00 
+  8043b2:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  8043b4:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8043b8:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  8043bf:	48 b8 e2 16 80 00 00 	movabs $0x8016e2,%rax
+  8043c6:	00 00 00 
+  8043c9:	ff d0                	call   *%rax
+}
+  8043cb:	c9                   	leave
+  8043cc:	c3                   	ret
+
+00000000008043cd <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  8043cd:	55                   	push   %rbp
+  8043ce:	48 89 e5             	mov    %rsp,%rbp
+  8043d1:	41 56                	push   %r14
+  8043d3:	41 55                	push   %r13
+  8043d5:	41 54                	push   %r12
+  8043d7:	53                   	push   %rbx
+  8043d8:	48 83 ec 50          	sub    $0x50,%rsp
+  8043dc:	49 89 fc             	mov    %rdi,%r12
+  8043df:	41 89 f5             	mov    %esi,%r13d
+  8043e2:	48 89 d3             	mov    %rdx,%rbx
+  8043e5:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  8043e9:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  8043ed:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  8043f1:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  8043f8:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8043fc:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  804400:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  804404:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  804408:	48 b8 00 60 80 00 00 	movabs $0x806000,%rax
+  80440f:	00 00 00 
+  804412:	4c 8b 30             	mov    (%rax),%r14
+  804415:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  80441c:	00 00 00 
+  80441f:	ff d0                	call   *%rax
+  804421:	89 c6                	mov    %eax,%esi
+  804423:	45 89 e8             	mov    %r13d,%r8d
+  804426:	4c 89 e1             	mov    %r12,%rcx
+  804429:	4c 89 f2             	mov    %r14,%rdx
+  80442c:	48 bf 00 50 80 00 00 	movabs $0x805000,%rdi
+  804433:	00 00 00 
+  804436:	b8 00 00 00 00       	mov    $0x0,%eax
+  80443b:	49 bc 0b 03 80 00 00 	movabs $0x80030b,%r12
+  804442:	00 00 00 
+  804445:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  804448:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  80444c:	48 89 df             	mov    %rbx,%rdi
+  80444f:	48 b8 a7 02 80 00 00 	movabs $0x8002a7,%rax
+  804456:	00 00 00 
+  804459:	ff d0                	call   *%rax
+    cprintf("\n");
+  80445b:	48 bf 4b 4f 80 00 00 	movabs $0x804f4b,%rdi
+  804462:	00 00 00 
+  804465:	b8 00 00 00 00       	mov    $0x0,%eax
+  80446a:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  80446d:	cc                   	int3
+  80446e:	eb fd                	jmp    80446d <_panic+0xa0>
+
+0000000000804470 <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  804470:	55                   	push   %rbp
+  804471:	48 89 e5             	mov    %rsp,%rbp
+  804474:	41 56                	push   %r14
+  804476:	41 55                	push   %r13
+  804478:	41 54                	push   %r12
+  80447a:	53                   	push   %rbx
+  80447b:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80447e:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804485:	00 00 00 
+  804488:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80448c:	74 27                	je     8044b5 <_handle_vectored_pagefault+0x45>
+  80448e:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  804493:	49 bd 00 10 84 00 00 	movabs $0x841000,%r13
+  80449a:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80449d:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  8044a0:	4c 89 e7             	mov    %r12,%rdi
+  8044a3:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  8044a8:	84 c0                	test   %al,%al
+  8044aa:	75 45                	jne    8044f1 <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  8044ac:	48 83 c3 01          	add    $0x1,%rbx
+  8044b0:	49 3b 1e             	cmp    (%r14),%rbx
+  8044b3:	72 eb                	jb     8044a0 <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  8044b5:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  8044bc:	00 
+  8044bd:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  8044c2:	4d 8b 04 24          	mov    (%r12),%r8
+  8044c6:	48 ba 28 50 80 00 00 	movabs $0x805028,%rdx
+  8044cd:	00 00 00 
+  8044d0:	be 1d 00 00 00       	mov    $0x1d,%esi
+  8044d5:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  8044dc:	00 00 00 
+  8044df:	b8 00 00 00 00       	mov    $0x0,%eax
+  8044e4:	49 ba cd 43 80 00 00 	movabs $0x8043cd,%r10
+  8044eb:	00 00 00 
+  8044ee:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  8044f1:	5b                   	pop    %rbx
+  8044f2:	41 5c                	pop    %r12
+  8044f4:	41 5d                	pop    %r13
+  8044f6:	41 5e                	pop    %r14
+  8044f8:	5d                   	pop    %rbp
+  8044f9:	c3                   	ret
+
+00000000008044fa <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  8044fa:	55                   	push   %rbp
+  8044fb:	48 89 e5             	mov    %rsp,%rbp
+  8044fe:	53                   	push   %rbx
+  8044ff:	48 83 ec 08          	sub    $0x8,%rsp
+  804503:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  804506:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  80450d:	00 00 00 
+  804510:	80 38 00             	cmpb   $0x0,(%rax)
+  804513:	0f 84 84 00 00 00    	je     80459d <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804519:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  804520:	00 00 00 
+  804523:	48 8b 10             	mov    (%rax),%rdx
+  804526:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  80452b:	48 b9 00 10 84 00 00 	movabs $0x841000,%rcx
+  804532:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804535:	48 85 d2             	test   %rdx,%rdx
+  804538:	74 19                	je     804553 <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  80453a:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  80453e:	0f 84 e8 00 00 00    	je     80462c <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  804544:	48 83 c0 01          	add    $0x1,%rax
+  804548:	48 39 d0             	cmp    %rdx,%rax
+  80454b:	75 ed                	jne    80453a <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  80454d:	48 83 fa 08          	cmp    $0x8,%rdx
+  804551:	74 1c                	je     80456f <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  804553:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  804557:	48 a3 48 10 84 00 00 	movabs %rax,0x841048
+  80455e:	00 00 00 
+  804561:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  804568:	00 00 00 
+  80456b:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  80456f:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  804576:	00 00 00 
+  804579:	ff d0                	call   *%rax
+  80457b:	89 c7                	mov    %eax,%edi
+  80457d:	48 be f2 46 80 00 00 	movabs $0x8046f2,%rsi
+  804584:	00 00 00 
+  804587:	48 b8 4d 13 80 00 00 	movabs $0x80134d,%rax
+  80458e:	00 00 00 
+  804591:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  804593:	85 c0                	test   %eax,%eax
+  804595:	78 68                	js     8045ff <add_pgfault_handler+0x105>
+    return res;
+}
+  804597:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80459b:	c9                   	leave
+  80459c:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  80459d:	48 b8 02 11 80 00 00 	movabs $0x801102,%rax
+  8045a4:	00 00 00 
+  8045a7:	ff d0                	call   *%rax
+  8045a9:	89 c7                	mov    %eax,%edi
+  8045ab:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8045b0:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8045b5:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  8045bc:	00 00 00 
+  8045bf:	48 b8 8f 11 80 00 00 	movabs $0x80118f,%rax
+  8045c6:	00 00 00 
+  8045c9:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8045cb:	48 ba 48 10 84 00 00 	movabs $0x841048,%rdx
+  8045d2:	00 00 00 
+  8045d5:	48 8b 02             	mov    (%rdx),%rax
+  8045d8:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8045dc:	48 89 0a             	mov    %rcx,(%rdx)
+  8045df:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  8045e6:	00 00 00 
+  8045e9:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8045ed:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  8045f4:	00 00 00 
+  8045f7:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8045fa:	e9 70 ff ff ff       	jmp    80456f <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8045ff:	89 c1                	mov    %eax,%ecx
+  804601:	48 ba 66 50 80 00 00 	movabs $0x805066,%rdx
+  804608:	00 00 00 
+  80460b:	be 3d 00 00 00       	mov    $0x3d,%esi
+  804610:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  804617:	00 00 00 
+  80461a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80461f:	49 b8 cd 43 80 00 00 	movabs $0x8043cd,%r8
+  804626:	00 00 00 
+  804629:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  80462c:	b8 00 00 00 00       	mov    $0x0,%eax
+  804631:	e9 61 ff ff ff       	jmp    804597 <add_pgfault_handler+0x9d>
+
+0000000000804636 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  804636:	55                   	push   %rbp
+  804637:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  80463a:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  804641:	00 00 00 
+  804644:	80 38 00             	cmpb   $0x0,(%rax)
+  804647:	74 33                	je     80467c <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804649:	48 a1 48 10 84 00 00 	movabs 0x841048,%rax
+  804650:	00 00 00 
+  804653:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  804658:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  80465f:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804662:	48 85 c0             	test   %rax,%rax
+  804665:	0f 84 85 00 00 00    	je     8046f0 <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  80466b:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  80466f:	74 40                	je     8046b1 <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  804671:	48 83 c1 01          	add    $0x1,%rcx
+  804675:	48 39 c1             	cmp    %rax,%rcx
+  804678:	75 f1                	jne    80466b <remove_pgfault_handler+0x35>
+  80467a:	eb 74                	jmp    8046f0 <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  80467c:	48 b9 7e 50 80 00 00 	movabs $0x80507e,%rcx
+  804683:	00 00 00 
+  804686:	48 ba a7 4f 80 00 00 	movabs $0x804fa7,%rdx
+  80468d:	00 00 00 
+  804690:	be 43 00 00 00       	mov    $0x43,%esi
+  804695:	48 bf 58 50 80 00 00 	movabs $0x805058,%rdi
+  80469c:	00 00 00 
+  80469f:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046a4:	49 b8 cd 43 80 00 00 	movabs $0x8043cd,%r8
+  8046ab:	00 00 00 
+  8046ae:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  8046b1:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  8046b8:	00 
+  8046b9:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  8046bd:	48 29 ca             	sub    %rcx,%rdx
+  8046c0:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  8046c7:	00 00 00 
+  8046ca:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8046ce:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8046d3:	48 89 ce             	mov    %rcx,%rsi
+  8046d6:	48 b8 2a 0e 80 00 00 	movabs $0x800e2a,%rax
+  8046dd:	00 00 00 
+  8046e0:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8046e2:	48 b8 48 10 84 00 00 	movabs $0x841048,%rax
+  8046e9:	00 00 00 
+  8046ec:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8046f0:	5d                   	pop    %rbp
+  8046f1:	c3                   	ret
+
+00000000008046f2 <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8046f2:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8046f5:	48 b8 70 44 80 00 00 	movabs $0x804470,%rax
+  8046fc:	00 00 00 
+    call *%rax
+  8046ff:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  804701:	41 5f                	pop    %r15
+	popq %r15
+  804703:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  804705:	41 5f                	pop    %r15
+	popq %r14
+  804707:	41 5e                	pop    %r14
+	popq %r13
+  804709:	41 5d                	pop    %r13
+	popq %r12
+  80470b:	41 5c                	pop    %r12
+	popq %r11
+  80470d:	41 5b                	pop    %r11
+	popq %r10
+  80470f:	41 5a                	pop    %r10
+	popq %r9
+  804711:	41 59                	pop    %r9
+	popq %r8
+  804713:	41 58                	pop    %r8
+	popq %rsi
+  804715:	5e                   	pop    %rsi
+	popq %rdi
+  804716:	5f                   	pop    %rdi
+	popq %rbp
+  804717:	5d                   	pop    %rbp
+	popq %rdx
+  804718:	5a                   	pop    %rdx
+	popq %rcx
+  804719:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  80471a:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  80471f:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  804724:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  804728:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  80472b:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  804730:	5b                   	pop    %rbx
+	popq %rax
+  804731:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  804732:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  804736:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  804737:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  80473c:	c3                   	ret
+
+000000000080473d <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  80473d:	55                   	push   %rbp
+  80473e:	48 89 e5             	mov    %rsp,%rbp
+  804741:	41 55                	push   %r13
+  804743:	41 54                	push   %r12
+  804745:	53                   	push   %rbx
+  804746:	48 83 ec 08          	sub    $0x8,%rsp
+  80474a:	49 89 fd             	mov    %rdi,%r13
+  80474d:	48 89 f7             	mov    %rsi,%rdi
+  804750:	48 89 d3             	mov    %rdx,%rbx
+  804753:	49 89 cc             	mov    %rcx,%r12
+  804756:	4c 89 c2             	mov    %r8,%rdx
+  804759:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80475c:	48 85 f6             	test   %rsi,%rsi
+  80475f:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  804766:	00 00 00 
+  804769:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  80476d:	be 00 10 00 00       	mov    $0x1000,%esi
+  804772:	48 85 db             	test   %rbx,%rbx
+  804775:	74 03                	je     80477a <ipc_recv_futex+0x3d>
+  804777:	48 8b 33             	mov    (%rbx),%rsi
+  80477a:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  80477e:	48 b8 d9 13 80 00 00 	movabs $0x8013d9,%rax
+  804785:	00 00 00 
+  804788:	ff d0                	call   *%rax
+    if (res < 0) {
+  80478a:	85 c0                	test   %eax,%eax
+  80478c:	78 75                	js     804803 <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  80478e:	4d 85 ed             	test   %r13,%r13
+  804791:	74 14                	je     8047a7 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  804793:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  80479a:	00 00 00 
+  80479d:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  8047a3:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  8047a7:	4d 85 e4             	test   %r12,%r12
+  8047aa:	74 14                	je     8047c0 <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  8047ac:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  8047b3:	00 00 00 
+  8047b6:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  8047bc:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  8047c0:	48 85 db             	test   %rbx,%rbx
+  8047c3:	74 23                	je     8047e8 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  8047c5:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  8047cc:	00 00 00 
+  8047cf:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8047d5:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047da:	85 c9                	test   %ecx,%ecx
+  8047dc:	74 07                	je     8047e5 <ipc_recv_futex+0xa8>
+  8047de:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8047e5:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8047e8:	48 a1 a0 0f 81 00 00 	movabs 0x810fa0,%rax
+  8047ef:	00 00 00 
+  8047f2:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8047f8:	48 83 c4 08          	add    $0x8,%rsp
+  8047fc:	5b                   	pop    %rbx
+  8047fd:	41 5c                	pop    %r12
+  8047ff:	41 5d                	pop    %r13
+  804801:	5d                   	pop    %rbp
+  804802:	c3                   	ret
+        if (from_env_store != NULL) {
+  804803:	4d 85 ed             	test   %r13,%r13
+  804806:	74 08                	je     804810 <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  804808:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  80480f:	00 
+        if (perm_store != NULL) {
+  804810:	4d 85 e4             	test   %r12,%r12
+  804813:	74 08                	je     80481d <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  804815:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  80481c:	00 
+        if (size != NULL) {
+  80481d:	48 85 db             	test   %rbx,%rbx
+  804820:	74 d6                	je     8047f8 <ipc_recv_futex+0xbb>
+            *size = 0;
+  804822:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  804829:	eb cd                	jmp    8047f8 <ipc_recv_futex+0xbb>
+
+000000000080482b <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  80482b:	55                   	push   %rbp
+  80482c:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  80482f:	48 83 ec 08          	sub    $0x8,%rsp
+  804833:	6a 00                	push   $0x0
+  804835:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  80483b:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  804841:	48 b8 3d 47 80 00 00 	movabs $0x80473d,%rax
+  804848:	00 00 00 
+  80484b:	ff d0                	call   *%rax
+}
+  80484d:	c9                   	leave
+  80484e:	c3                   	ret
+
+000000000080484f <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  80484f:	55                   	push   %rbp
+  804850:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  804853:	48 85 d2             	test   %rdx,%rdx
+  804856:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  80485d:	00 00 00 
+  804860:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  804864:	89 f6                	mov    %esi,%esi
+  804866:	48 b8 c2 13 80 00 00 	movabs $0x8013c2,%rax
+  80486d:	00 00 00 
+  804870:	ff d0                	call   *%rax
+    if (res < 0) {
+  804872:	85 c0                	test   %eax,%eax
+  804874:	78 02                	js     804878 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  804876:	5d                   	pop    %rbp
+  804877:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  804878:	89 c1                	mov    %eax,%ecx
+  80487a:	48 ba 98 50 80 00 00 	movabs $0x805098,%rdx
+  804881:	00 00 00 
+  804884:	be 50 00 00 00       	mov    $0x50,%esi
+  804889:	48 bf ac 50 80 00 00 	movabs $0x8050ac,%rdi
+  804890:	00 00 00 
+  804893:	b8 00 00 00 00       	mov    $0x0,%eax
+  804898:	49 b8 cd 43 80 00 00 	movabs $0x8043cd,%r8
+  80489f:	00 00 00 
+  8048a2:	41 ff d0             	call   *%r8
+
+00000000008048a5 <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  8048a5:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  8048aa:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  8048b1:	00 00 00 
+  8048b4:	48 89 d0             	mov    %rdx,%rax
+  8048b7:	48 c1 e0 04          	shl    $0x4,%rax
+  8048bb:	48 29 d0             	sub    %rdx,%rax
+  8048be:	48 c1 e0 05          	shl    $0x5,%rax
+  8048c2:	48 01 c8             	add    %rcx,%rax
+  8048c5:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8048cb:	39 f8                	cmp    %edi,%eax
+  8048cd:	74 13                	je     8048e2 <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8048cf:	48 83 c2 01          	add    $0x1,%rdx
+  8048d3:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8048da:	75 d8                	jne    8048b4 <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8048dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8048e1:	c3                   	ret
+            return envs[i].env_id;
+  8048e2:	48 89 d0             	mov    %rdx,%rax
+  8048e5:	48 c1 e0 04          	shl    $0x4,%rax
+  8048e9:	48 29 d0             	sub    %rdx,%rax
+  8048ec:	48 c1 e0 05          	shl    $0x5,%rax
+  8048f0:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8048f7:	00 00 00 
+  8048fa:	48 01 d0             	add    %rdx,%rax
+  8048fd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  804903:	c3                   	ret
+  804904:	0f 1f 40 00          	nopl   0x0(%rax)
+
+0000000000804908 <__rodata_start>:
+  804908:	73 63                	jae    80496d <__rodata_start+0x65>
+  80490a:	68 65 64 62 65       	push   $0x65626465
+  80490f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804910:	63 68 3a             	movsxd 0x3a(%rax),%ebp
+  804913:	20 25 64 20 65 6e    	and    %ah,0x6e652064(%rip)        # 6ee5697d <__bss_end+0x6e61497d>
+  804919:	76 73                	jbe    80498e <__rodata_start+0x86>
+  80491b:	3a 20                	cmp    (%rax),%ah
+  80491d:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  804922:	79 63                	jns    804987 <__rodata_start+0x7f>
+  804924:	6c                   	insb   (%dx),%es:(%rdi)
+  804925:	65 73 2f             	gs jae 804957 <__rodata_start+0x4f>
+  804928:	72 6f                	jb     804999 <__rodata_start+0x91>
+  80492a:	75 6e                	jne    80499a <__rodata_start+0x92>
+  80492c:	64 2c 20             	fs sub $0x20,%al
+  80492f:	25 6c 75 20 63       	and    $0x6320756c,%eax
+  804934:	79 63                	jns    804999 <__rodata_start+0x91>
+  804936:	6c                   	insb   (%dx),%es:(%rdi)
+  804937:	65 73 2f             	gs jae 804969 <__rodata_start+0x61>
+  80493a:	79 69                	jns    8049a5 <__rodata_start+0x9d>
+  80493c:	65 6c                	gs insb (%dx),%es:(%rdi)
+  80493e:	64 0a 00             	or     %fs:(%rax),%al
+  804941:	3c 75                	cmp    $0x75,%al
+  804943:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804944:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  804948:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804949:	3e 00 30             	ds add %dh,(%rax)
+  80494c:	31 32                	xor    %esi,(%rdx)
+  80494e:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804955:	41                   	rex.B
+  804956:	42                   	rex.X
+  804957:	43                   	rex.XB
+  804958:	44                   	rex.R
+  804959:	45                   	rex.RB
+  80495a:	46 00 30             	rex.RX add %r14b,(%rax)
+  80495d:	31 32                	xor    %esi,(%rdx)
+  80495f:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  804966:	61                   	(bad)
+  804967:	62 63 64 65 66       	(bad)
+  80496c:	00 28                	add    %ch,(%rax)
+  80496e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80496f:	75 6c                	jne    8049dd <__rodata_start+0xd5>
+  804971:	6c                   	insb   (%dx),%es:(%rdi)
+  804972:	29 00                	sub    %eax,(%rax)
+  804974:	65 72 72             	gs jb  8049e9 <__rodata_start+0xe1>
+  804977:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804978:	72 20                	jb     80499a <__rodata_start+0x92>
+  80497a:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  80497f:	73 70                	jae    8049f1 <__rodata_start+0xe9>
+  804981:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  804985:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  80498c:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80498d:	72 00                	jb     80498f <__rodata_start+0x87>
+  80498f:	62 61 64 20 65       	(bad)
+  804994:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804995:	76 69                	jbe    804a00 <__rodata_start+0xf8>
+  804997:	72 6f                	jb     804a08 <__rodata_start+0x100>
+  804999:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80499a:	6d                   	insl   (%dx),%es:(%rdi)
+  80499b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80499d:	74 00                	je     80499f <__rodata_start+0x97>
+  80499f:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8049a6:	20 70 61             	and    %dh,0x61(%rax)
+  8049a9:	72 61                	jb     804a0c <__rodata_start+0x104>
+  8049ab:	6d                   	insl   (%dx),%es:(%rdi)
+  8049ac:	65 74 65             	gs je  804a14 <__rodata_start+0x10c>
+  8049af:	72 00                	jb     8049b1 <__rodata_start+0xa9>
+  8049b1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049b2:	75 74                	jne    804a28 <__rodata_start+0x120>
+  8049b4:	20 6f 66             	and    %ch,0x66(%rdi)
+  8049b7:	20 6d 65             	and    %ch,0x65(%rbp)
+  8049ba:	6d                   	insl   (%dx),%es:(%rdi)
+  8049bb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049bc:	72 79                	jb     804a37 <__rodata_start+0x12f>
+  8049be:	00 6f 75             	add    %ch,0x75(%rdi)
+  8049c1:	74 20                	je     8049e3 <__rodata_start+0xdb>
+  8049c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049c4:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8049c8:	76 69                	jbe    804a33 <__rodata_start+0x12b>
+  8049ca:	72 6f                	jb     804a3b <__rodata_start+0x133>
+  8049cc:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049cd:	6d                   	insl   (%dx),%es:(%rdi)
+  8049ce:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049d0:	74 73                	je     804a45 <__rodata_start+0x13d>
+  8049d2:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8049d5:	72 72                	jb     804a49 <__rodata_start+0x141>
+  8049d7:	75 70                	jne    804a49 <__rodata_start+0x141>
+  8049d9:	74 65                	je     804a40 <__rodata_start+0x138>
+  8049db:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8049e0:	75 67                	jne    804a49 <__rodata_start+0x141>
+  8049e2:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8049e5:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8049e7:	00 73 65             	add    %dh,0x65(%rbx)
+  8049ea:	67 6d                	insl   (%dx),%es:(%edi)
+  8049ec:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8049ee:	74 61                	je     804a51 <__rodata_start+0x149>
+  8049f0:	74 69                	je     804a5b <__rodata_start+0x153>
+  8049f2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8049f3:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8049f4:	20 66 61             	and    %ah,0x61(%rsi)
+  8049f7:	75 6c                	jne    804a65 <__rodata_start+0x15d>
+  8049f9:	74 00                	je     8049fb <__rodata_start+0xf3>
+  8049fb:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  804a02:	20 45 4c             	and    %al,0x4c(%rbp)
+  804a05:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  804a09:	61                   	(bad)
+  804a0a:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  804a0f:	20 73 75             	and    %dh,0x75(%rbx)
+  804a12:	63 68 20             	movsxd 0x20(%rax),%ebp
+  804a15:	73 79                	jae    804a90 <__rodata_start+0x188>
+  804a17:	73 74                	jae    804a8d <__rodata_start+0x185>
+  804a19:	65 6d                	gs insl (%dx),%es:(%rdi)
+  804a1b:	20 63 61             	and    %ah,0x61(%rbx)
+  804a1e:	6c                   	insb   (%dx),%es:(%rdi)
+  804a1f:	6c                   	insb   (%dx),%es:(%rdi)
+  804a20:	00 65 6e             	add    %ah,0x6e(%rbp)
+  804a23:	74 72                	je     804a97 <__rodata_start+0x18f>
+  804a25:	79 20                	jns    804a47 <__rodata_start+0x13f>
+  804a27:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a28:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a29:	74 20                	je     804a4b <__rodata_start+0x143>
+  804a2b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a2d:	75 6e                	jne    804a9d <__rodata_start+0x195>
+  804a2f:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  804a33:	76 20                	jbe    804a55 <__rodata_start+0x14d>
+  804a35:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  804a3c:	72 65                	jb     804aa3 <__rodata_start+0x19b>
+  804a3e:	63 76 69             	movsxd 0x69(%rsi),%esi
+  804a41:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a42:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  804a46:	65 78 70             	gs js  804ab9 <__rodata_start+0x1b1>
+  804a49:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  804a4e:	20 65 6e             	and    %ah,0x6e(%rbp)
+  804a51:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  804a55:	20 66 69             	and    %ah,0x69(%rsi)
+  804a58:	6c                   	insb   (%dx),%es:(%rdi)
+  804a59:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  804a5d:	20 66 72             	and    %ah,0x72(%rsi)
+  804a60:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  804a65:	61                   	(bad)
+  804a66:	63 65 20             	movsxd 0x20(%rbp),%esp
+  804a69:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a6a:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a6b:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  804a6f:	6b 00 74             	imul   $0x74,(%rax),%eax
+  804a72:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a73:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a74:	20 6d 61             	and    %ch,0x61(%rbp)
+  804a77:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a78:	79 20                	jns    804a9a <__rodata_start+0x192>
+  804a7a:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  804a81:	72 65                	jb     804ae8 <__rodata_start+0x1e0>
+  804a83:	20 6f 70             	and    %ch,0x70(%rdi)
+  804a86:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  804a88:	00 66 69             	add    %ah,0x69(%rsi)
+  804a8b:	6c                   	insb   (%dx),%es:(%rdi)
+  804a8c:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  804a90:	20 62 6c             	and    %ah,0x6c(%rdx)
+  804a93:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a94:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  804a97:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804a98:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804a99:	74 20                	je     804abb <__rodata_start+0x1b3>
+  804a9b:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  804a9d:	75 6e                	jne    804b0d <__rodata_start+0x205>
+  804a9f:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  804aa3:	76 61                	jbe    804b06 <__rodata_start+0x1fe>
+  804aa5:	6c                   	insb   (%dx),%es:(%rdi)
+  804aa6:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  804aad:	00 
+  804aae:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  804ab5:	72 65                	jb     804b1c <__rodata_start+0x214>
+  804ab7:	61                   	(bad)
+  804ab8:	64 79 20             	fs jns 804adb <__rodata_start+0x1d3>
+  804abb:	65 78 69             	gs js  804b27 <__rodata_start+0x21f>
+  804abe:	73 74                	jae    804b34 <__rodata_start+0x22c>
+  804ac0:	73 00                	jae    804ac2 <__rodata_start+0x1ba>
+  804ac2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ac3:	70 65                	jo     804b2a <__rodata_start+0x222>
+  804ac5:	72 61                	jb     804b28 <__rodata_start+0x220>
+  804ac7:	74 69                	je     804b32 <__rodata_start+0x22a>
+  804ac9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804aca:	6e                   	outsb  %ds:(%rsi),(%dx)
+  804acb:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  804ace:	74 20                	je     804af0 <__rodata_start+0x1e8>
+  804ad0:	73 75                	jae    804b47 <__rodata_start+0x23f>
+  804ad2:	70 70                	jo     804b44 <__rodata_start+0x23c>
+  804ad4:	6f                   	outsl  %ds:(%rsi),(%dx)
+  804ad5:	72 74                	jb     804b4b <__rodata_start+0x243>
+  804ad7:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  804add:	20 61 67             	and    %ah,0x67(%rcx)
+  804ae0:	61                   	(bad)
+  804ae1:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  804ae8:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  804aec:	74 00                	je     804aee <__rodata_start+0x1e6>
+  804aee:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  804af5:	20 69 6e             	and    %ch,0x6e(%rcx)
+  804af8:	20 75 73             	and    %dh,0x73(%rbp)
+  804afb:	65 00 0f             	add    %cl,%gs:(%rdi)
+  804afe:	1f                   	(bad)
+  804aff:	00 f8                	add    %bh,%al
+  804b01:	04 80                	add    $0x80,%al
+  804b03:	00 00                	add    %al,(%rax)
+  804b05:	00 00                	add    %al,(%rax)
+  804b07:	00 39                	add    %bh,(%rcx)
+  804b09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b0f:	00 29                	add    %ch,(%rcx)
+  804b11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b17:	00 39                	add    %bh,(%rcx)
+  804b19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b1f:	00 39                	add    %bh,(%rcx)
+  804b21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b27:	00 39                	add    %bh,(%rcx)
+  804b29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b2f:	00 39                	add    %bh,(%rcx)
+  804b31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b37:	00 17                	add    %dl,(%rdi)
+  804b39:	05 80 00 00 00       	add    $0x80,%eax
+  804b3e:	00 00                	add    %al,(%rax)
+  804b40:	39 0b                	cmp    %ecx,(%rbx)
+  804b42:	80 00 00             	addb   $0x0,(%rax)
+  804b45:	00 00                	add    %al,(%rax)
+  804b47:	00 39                	add    %bh,(%rcx)
+  804b49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804b4f:	00 0b                	add    %cl,(%rbx)
+  804b51:	05 80 00 00 00       	add    $0x80,%eax
+  804b56:	00 00                	add    %al,(%rax)
+  804b58:	85 05 80 00 00 00    	test   %eax,0x80(%rip)        # 804bde <__rodata_start+0x2d6>
+  804b5e:	00 00                	add    %al,(%rax)
+  804b60:	39 0b                	cmp    %ecx,(%rbx)
+  804b62:	80 00 00             	addb   $0x0,(%rax)
+  804b65:	00 00                	add    %al,(%rax)
+  804b67:	00 0b                	add    %cl,(%rbx)
+  804b69:	05 80 00 00 00       	add    $0x80,%eax
+  804b6e:	00 00                	add    %al,(%rax)
+  804b70:	51                   	push   %rcx
+  804b71:	05 80 00 00 00       	add    $0x80,%eax
+  804b76:	00 00                	add    %al,(%rax)
+  804b78:	51                   	push   %rcx
+  804b79:	05 80 00 00 00       	add    $0x80,%eax
+  804b7e:	00 00                	add    %al,(%rax)
+  804b80:	51                   	push   %rcx
+  804b81:	05 80 00 00 00       	add    $0x80,%eax
+  804b86:	00 00                	add    %al,(%rax)
+  804b88:	51                   	push   %rcx
+  804b89:	05 80 00 00 00       	add    $0x80,%eax
+  804b8e:	00 00                	add    %al,(%rax)
+  804b90:	51                   	push   %rcx
+  804b91:	05 80 00 00 00       	add    $0x80,%eax
+  804b96:	00 00                	add    %al,(%rax)
+  804b98:	51                   	push   %rcx
+  804b99:	05 80 00 00 00       	add    $0x80,%eax
+  804b9e:	00 00                	add    %al,(%rax)
+  804ba0:	51                   	push   %rcx
+  804ba1:	05 80 00 00 00       	add    $0x80,%eax
+  804ba6:	00 00                	add    %al,(%rax)
+  804ba8:	51                   	push   %rcx
+  804ba9:	05 80 00 00 00       	add    $0x80,%eax
+  804bae:	00 00                	add    %al,(%rax)
+  804bb0:	51                   	push   %rcx
+  804bb1:	05 80 00 00 00       	add    $0x80,%eax
+  804bb6:	00 00                	add    %al,(%rax)
+  804bb8:	39 0b                	cmp    %ecx,(%rbx)
+  804bba:	80 00 00             	addb   $0x0,(%rax)
+  804bbd:	00 00                	add    %al,(%rax)
+  804bbf:	00 39                	add    %bh,(%rcx)
+  804bc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bc7:	00 39                	add    %bh,(%rcx)
+  804bc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bcf:	00 39                	add    %bh,(%rcx)
+  804bd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bd7:	00 39                	add    %bh,(%rcx)
+  804bd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bdf:	00 39                	add    %bh,(%rcx)
+  804be1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804be7:	00 39                	add    %bh,(%rcx)
+  804be9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bef:	00 39                	add    %bh,(%rcx)
+  804bf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bf7:	00 39                	add    %bh,(%rcx)
+  804bf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804bff:	00 39                	add    %bh,(%rcx)
+  804c01:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c07:	00 39                	add    %bh,(%rcx)
+  804c09:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c0f:	00 39                	add    %bh,(%rcx)
+  804c11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c17:	00 39                	add    %bh,(%rcx)
+  804c19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c1f:	00 39                	add    %bh,(%rcx)
+  804c21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c27:	00 39                	add    %bh,(%rcx)
+  804c29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c2f:	00 39                	add    %bh,(%rcx)
+  804c31:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c37:	00 39                	add    %bh,(%rcx)
+  804c39:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c3f:	00 39                	add    %bh,(%rcx)
+  804c41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c47:	00 39                	add    %bh,(%rcx)
+  804c49:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c4f:	00 39                	add    %bh,(%rcx)
+  804c51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c57:	00 39                	add    %bh,(%rcx)
+  804c59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c5f:	00 39                	add    %bh,(%rcx)
+  804c61:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c67:	00 39                	add    %bh,(%rcx)
+  804c69:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c6f:	00 39                	add    %bh,(%rcx)
+  804c71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c77:	00 39                	add    %bh,(%rcx)
+  804c79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c7f:	00 39                	add    %bh,(%rcx)
+  804c81:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c87:	00 39                	add    %bh,(%rcx)
+  804c89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c8f:	00 39                	add    %bh,(%rcx)
+  804c91:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c97:	00 39                	add    %bh,(%rcx)
+  804c99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804c9f:	00 39                	add    %bh,(%rcx)
+  804ca1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ca7:	00 5c 0a 80          	add    %bl,-0x80(%rdx,%rcx,1)
+  804cab:	00 00                	add    %al,(%rax)
+  804cad:	00 00                	add    %al,(%rax)
+  804caf:	00 39                	add    %bh,(%rcx)
+  804cb1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cb7:	00 39                	add    %bh,(%rcx)
+  804cb9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cbf:	00 39                	add    %bh,(%rcx)
+  804cc1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cc7:	00 39                	add    %bh,(%rcx)
+  804cc9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ccf:	00 39                	add    %bh,(%rcx)
+  804cd1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cd7:	00 39                	add    %bh,(%rcx)
+  804cd9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cdf:	00 39                	add    %bh,(%rcx)
+  804ce1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804ce7:	00 39                	add    %bh,(%rcx)
+  804ce9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cef:	00 39                	add    %bh,(%rcx)
+  804cf1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cf7:	00 39                	add    %bh,(%rcx)
+  804cf9:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804cff:	00 a8 05 80 00 00    	add    %ch,0x8005(%rax)
+  804d05:	00 00                	add    %al,(%rax)
+  804d07:	00 77 07             	add    %dh,0x7(%rdi)
+  804d0a:	80 00 00             	addb   $0x0,(%rax)
+  804d0d:	00 00                	add    %al,(%rax)
+  804d0f:	00 39                	add    %bh,(%rcx)
+  804d11:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d17:	00 39                	add    %bh,(%rcx)
+  804d19:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d1f:	00 39                	add    %bh,(%rcx)
+  804d21:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d27:	00 39                	add    %bh,(%rcx)
+  804d29:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d2f:	00 d7                	add    %dl,%bh
+  804d31:	05 80 00 00 00       	add    $0x80,%eax
+  804d36:	00 00                	add    %al,(%rax)
+  804d38:	39 0b                	cmp    %ecx,(%rbx)
+  804d3a:	80 00 00             	addb   $0x0,(%rax)
+  804d3d:	00 00                	add    %al,(%rax)
+  804d3f:	00 39                	add    %bh,(%rcx)
+  804d41:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d47:	00 9d 05 80 00 00    	add    %bl,0x8005(%rbp)
+  804d4d:	00 00                	add    %al,(%rax)
+  804d4f:	00 39                	add    %bh,(%rcx)
+  804d51:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d57:	00 39                	add    %bh,(%rcx)
+  804d59:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d5f:	00 1f                	add    %bl,(%rdi)
+  804d61:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804d67:	00 e9                	add    %ch,%cl
+  804d69:	09 80 00 00 00 00    	or     %eax,0x0(%rax)
+  804d6f:	00 39                	add    %bh,(%rcx)
+  804d71:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d77:	00 39                	add    %bh,(%rcx)
+  804d79:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d7f:	00 6e 06             	add    %ch,0x6(%rsi)
+  804d82:	80 00 00             	addb   $0x0,(%rax)
+  804d85:	00 00                	add    %al,(%rax)
+  804d87:	00 39                	add    %bh,(%rcx)
+  804d89:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d8f:	00 4b 08             	add    %cl,0x8(%rbx)
+  804d92:	80 00 00             	addb   $0x0,(%rax)
+  804d95:	00 00                	add    %al,(%rax)
+  804d97:	00 39                	add    %bh,(%rcx)
+  804d99:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804d9f:	00 39                	add    %bh,(%rcx)
+  804da1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804da7:	00 5c 0a 80          	add    %bl,-0x80(%rdx,%rcx,1)
+  804dab:	00 00                	add    %al,(%rax)
+  804dad:	00 00                	add    %al,(%rax)
+  804daf:	00 39                	add    %bh,(%rcx)
+  804db1:	0b 80 00 00 00 00    	or     0x0(%rax),%eax
+  804db7:	00 01                	add    %al,(%rcx)
+  804db9:	05 80 00 00 00       	add    $0x80,%eax
+	...
+
+0000000000804dc0 <error_string>:
+	...
+  804dc8:	7d 49 80 00 00 00 00 00 8f 49 80 00 00 00 00 00     }I.......I......
+  804dd8:	9f 49 80 00 00 00 00 00 b1 49 80 00 00 00 00 00     .I.......I......
+  804de8:	bf 49 80 00 00 00 00 00 d3 49 80 00 00 00 00 00     .I.......I......
+  804df8:	e8 49 80 00 00 00 00 00 fb 49 80 00 00 00 00 00     .I.......I......
+  804e08:	0d 4a 80 00 00 00 00 00 21 4a 80 00 00 00 00 00     .J......!J......
+  804e18:	31 4a 80 00 00 00 00 00 44 4a 80 00 00 00 00 00     1J......DJ......
+  804e28:	5b 4a 80 00 00 00 00 00 71 4a 80 00 00 00 00 00     [J......qJ......
+  804e38:	89 4a 80 00 00 00 00 00 a1 4a 80 00 00 00 00 00     .J.......J......
+  804e48:	ae 4a 80 00 00 00 00 00 78 4e 80 00 00 00 00 00     .J......xN......
+  804e58:	c2 4a 80 00 00 00 00 00 da 4a 80 00 00 00 00 00     .J.......J......
+  804e68:	e4 4a 80 00 00 00 00 00 ee 4a 80 00 00 00 00 00     .J.......J......
+  804e78:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  804e88:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 90     lid executable..
+  804e98:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  804ea8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  804eb8:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  804ec8:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  804ed8:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  804ee8:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  804ef8:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  804f08:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  804f18:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  804f28:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  804f38:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  804f48:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  804f58:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  804f68:	0a 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  804f78:	84 00 00 00 00 00 66 90                             ......f.
+
+0000000000804f80 <devtab>:
+  804f80:	20 60 80 00 00 00 00 00 60 60 80 00 00 00 00 00      `......``......
+  804f90:	a0 60 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .`..............
+  804fa0:	3c 70 69 70 65 3e 00 61 73 73 65 72 74 69 6f 6e     <pipe>.assertion
+  804fb0:	20 66 61 69 6c 65 64 3a 20 25 73 00 6c 69 62 2f      failed: %s.lib/
+  804fc0:	70 69 70 65 2e 63 00 70 69 70 65 00 0f 1f 40 00     pipe.c.pipe...@.
+  804fd0:	73 79 73 5f 72 65 67 69 6f 6e 5f 72 65 66 73 28     sys_region_refs(
+  804fe0:	76 61 2c 20 50 41 47 45 5f 53 49 5a 45 29 20 3d     va, PAGE_SIZE) =
+  804ff0:	3d 20 32 00 3c 63 6f 6e 73 3e 00 63 6f 6e 73 00     = 2.<cons>.cons.
+  805000:	5b 25 30 38 78 5d 20 75 73 65 72 20 70 61 6e 69     [%08x] user pani
+  805010:	63 20 69 6e 20 25 73 20 61 74 20 25 73 3a 25 64     c in %s at %s:%d
+  805020:	3a 20 00 0f 1f 44 00 00 55 73 65 72 73 70 61 63     : ...D..Userspac
+  805030:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  805040:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  805050:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  805060:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  805070:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  805080:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  805090:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  8050a0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  8050b0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  8050c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8050d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8050e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8050f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805100:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805110:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805120:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805130:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805140:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805150:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805160:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805170:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805180:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805190:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8051b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8051c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8051d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8051e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8051f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805200:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805210:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805220:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805230:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805240:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805250:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805260:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805270:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805280:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805290:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8052b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8052c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8052d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8052e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8052f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805300:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805310:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805320:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805330:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805340:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805350:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805360:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805370:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805380:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805390:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8053b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8053c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8053d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8053e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8053f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805400:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805410:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805420:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805430:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805440:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805450:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805460:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805470:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805480:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805490:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8054b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8054c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8054d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8054e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8054f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805500:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805510:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805520:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805530:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805540:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805550:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805560:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805570:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805580:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805590:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055a0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8055b0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8055c0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8055d0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8055e0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8055f0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805600:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805610:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805620:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805630:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805640:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805650:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805660:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805670:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805680:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805690:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056a0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8056b0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8056c0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8056d0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8056e0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8056f0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805700:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805710:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805720:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805730:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805740:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805750:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805760:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805770:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805780:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805790:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057a0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8057b0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8057c0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8057d0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8057e0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8057f0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805800:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805810:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805820:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805830:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805840:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805850:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805860:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805870:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805880:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805890:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058a0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8058b0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8058c0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8058d0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8058e0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8058f0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805900:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805910:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805920:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805930:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805940:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805950:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805960:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805970:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805980:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805990:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059a0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  8059b0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  8059c0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  8059d0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  8059e0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  8059f0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805a50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805a60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805a70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805a80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805a90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805aa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ab0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ac0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ad0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ae0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805af0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805b50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805b60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805b70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805b80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805b90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ba0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805bb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805bc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805bd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805be0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805bf0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c00:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c10:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c20:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c30:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c40:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805c50:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805c60:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805c70:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805c80:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805c90:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ca0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805cb0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805cc0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805cd0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ce0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805cf0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d00:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d10:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d20:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d30:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d40:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805d50:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805d60:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805d70:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805d80:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805d90:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805da0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805db0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805dc0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805dd0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805de0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805df0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e00:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e10:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e20:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e30:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e40:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805e50:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805e60:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805e70:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805e80:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805e90:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ea0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805eb0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805ec0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805ed0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805ee0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805ef0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805f50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805f60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805f70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805f80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805f90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805fa0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  805fb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  805fc0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  805fd0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  805fe0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  805ff0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 0f 1f 40 00     ..f...........@.
@@ -0,0 +1,11130 @@
+
+obj/user/sh:     file format elf64-x86-64
+
+
+Disassembly of section .text:
+
+0000000000800000 <__text_start>:
+.globl _start
+_start:
+    # See if we were started with arguments on the stack
+
+#ifndef CONFIG_KSPACE
+    movabs $USER_STACK_TOP, %rax
+  800000:	48 b8 00 70 ff ff 7f 	movabs $0x7fffff7000,%rax
+  800007:	00 00 00 
+    cmpq %rax, %rsp
+  80000a:	48 39 c4             	cmp    %rax,%rsp
+    jne args_exist
+  80000d:	75 04                	jne    800013 <args_exist>
+
+    # If not, push dummy argc/argv arguments.
+    # This happens when we are loaded by the kernel,
+    # because the kernel does not know about passing arguments.
+    # Marking argc and argv as zero.
+    pushq $0
+  80000f:	6a 00                	push   $0x0
+    pushq $0
+  800011:	6a 00                	push   $0x0
+
+0000000000800013 <args_exist>:
+
+args_exist:
+    movq 8(%rsp), %rsi
+  800013:	48 8b 74 24 08       	mov    0x8(%rsp),%rsi
+    movq (%rsp), %rdi
+  800018:	48 8b 3c 24          	mov    (%rsp),%rdi
+    xorl %ebp, %ebp
+  80001c:	31 ed                	xor    %ebp,%ebp
+    call libmain
+  80001e:	e8 8e 0a 00 00       	call   800ab1 <libmain>
+    jmp .
+  800023:	eb fe                	jmp    800023 <args_exist+0x10>
+
+0000000000800025 <_gettoken>:
+
+int
+_gettoken(char *s, char **p1, char **p2) {
+    int t;
+
+    if (s == 0) {
+  800025:	48 85 ff             	test   %rdi,%rdi
+  800028:	0f 84 e3 00 00 00    	je     800111 <_gettoken+0xec>
+_gettoken(char *s, char **p1, char **p2) {
+  80002e:	55                   	push   %rbp
+  80002f:	48 89 e5             	mov    %rsp,%rbp
+  800032:	41 57                	push   %r15
+  800034:	41 56                	push   %r14
+  800036:	41 55                	push   %r13
+  800038:	41 54                	push   %r12
+  80003a:	53                   	push   %rbx
+  80003b:	48 83 ec 08          	sub    $0x8,%rsp
+  80003f:	48 89 fb             	mov    %rdi,%rbx
+  800042:	49 89 f7             	mov    %rsi,%r15
+  800045:	49 89 d6             	mov    %rdx,%r14
+    }
+
+    if (debug > 1)
+        cprintf("GETTOKEN: %s\n", s);
+
+    *p1 = 0;
+  800048:	48 c7 06 00 00 00 00 	movq   $0x0,(%rsi)
+    *p2 = 0;
+  80004f:	48 c7 02 00 00 00 00 	movq   $0x0,(%rdx)
+
+    while (strchr(WHITESPACE, *s))
+  800056:	49 bd e0 63 80 00 00 	movabs $0x8063e0,%r13
+  80005d:	00 00 00 
+  800060:	49 bc 01 17 80 00 00 	movabs $0x801701,%r12
+  800067:	00 00 00 
+  80006a:	eb 08                	jmp    800074 <_gettoken+0x4f>
+        *s++ = 0;
+  80006c:	48 83 c3 01          	add    $0x1,%rbx
+  800070:	c6 43 ff 00          	movb   $0x0,-0x1(%rbx)
+    while (strchr(WHITESPACE, *s))
+  800074:	0f be 33             	movsbl (%rbx),%esi
+  800077:	4c 89 ef             	mov    %r13,%rdi
+  80007a:	41 ff d4             	call   *%r12
+  80007d:	48 85 c0             	test   %rax,%rax
+  800080:	75 ea                	jne    80006c <_gettoken+0x47>
+    if (*s == 0) {
+  800082:	0f b6 33             	movzbl (%rbx),%esi
+  800085:	40 84 f6             	test   %sil,%sil
+  800088:	75 0f                	jne    800099 <_gettoken+0x74>
+        **p2 = 0;
+        cprintf("WORD: %s\n", *p1);
+        **p2 = t;
+    }
+    return 'w';
+}
+  80008a:	48 83 c4 08          	add    $0x8,%rsp
+  80008e:	5b                   	pop    %rbx
+  80008f:	41 5c                	pop    %r12
+  800091:	41 5d                	pop    %r13
+  800093:	41 5e                	pop    %r14
+  800095:	41 5f                	pop    %r15
+  800097:	5d                   	pop    %rbp
+  800098:	c3                   	ret
+    if (strchr(SYMBOLS, *s)) {
+  800099:	40 0f be f6          	movsbl %sil,%esi
+  80009d:	48 bf e9 63 80 00 00 	movabs $0x8063e9,%rdi
+  8000a4:	00 00 00 
+  8000a7:	48 b8 01 17 80 00 00 	movabs $0x801701,%rax
+  8000ae:	00 00 00 
+  8000b1:	ff d0                	call   *%rax
+  8000b3:	48 85 c0             	test   %rax,%rax
+  8000b6:	74 12                	je     8000ca <_gettoken+0xa5>
+        t = *s;
+  8000b8:	0f be 03             	movsbl (%rbx),%eax
+        *p1 = s;
+  8000bb:	49 89 1f             	mov    %rbx,(%r15)
+        *s++ = 0;
+  8000be:	c6 03 00             	movb   $0x0,(%rbx)
+  8000c1:	48 83 c3 01          	add    $0x1,%rbx
+  8000c5:	49 89 1e             	mov    %rbx,(%r14)
+        return t;
+  8000c8:	eb c0                	jmp    80008a <_gettoken+0x65>
+    *p1 = s;
+  8000ca:	49 89 1f             	mov    %rbx,(%r15)
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000cd:	0f b6 33             	movzbl (%rbx),%esi
+  8000d0:	49 bd e5 63 80 00 00 	movabs $0x8063e5,%r13
+  8000d7:	00 00 00 
+  8000da:	49 bc 01 17 80 00 00 	movabs $0x801701,%r12
+  8000e1:	00 00 00 
+  8000e4:	40 84 f6             	test   %sil,%sil
+  8000e7:	74 1b                	je     800104 <_gettoken+0xdf>
+  8000e9:	40 0f be f6          	movsbl %sil,%esi
+  8000ed:	4c 89 ef             	mov    %r13,%rdi
+  8000f0:	41 ff d4             	call   *%r12
+  8000f3:	48 85 c0             	test   %rax,%rax
+  8000f6:	75 0c                	jne    800104 <_gettoken+0xdf>
+        s++;
+  8000f8:	48 83 c3 01          	add    $0x1,%rbx
+    while (*s && !strchr(WHITESPACE SYMBOLS, *s))
+  8000fc:	0f b6 33             	movzbl (%rbx),%esi
+  8000ff:	40 84 f6             	test   %sil,%sil
+  800102:	75 e5                	jne    8000e9 <_gettoken+0xc4>
+    *p2 = s;
+  800104:	49 89 1e             	mov    %rbx,(%r14)
+    return 'w';
+  800107:	b8 77 00 00 00       	mov    $0x77,%eax
+  80010c:	e9 79 ff ff ff       	jmp    80008a <_gettoken+0x65>
+        return 0;
+  800111:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  800116:	c3                   	ret
+
+0000000000800117 <gettoken>:
+
+int
+gettoken(char *s, char **p1) {
+  800117:	55                   	push   %rbp
+  800118:	48 89 e5             	mov    %rsp,%rbp
+  80011b:	41 54                	push   %r12
+  80011d:	53                   	push   %rbx
+    static int c, nc;
+    static char *np1, *np2;
+
+    if (s) {
+  80011e:	48 85 ff             	test   %rdi,%rdi
+  800121:	74 33                	je     800156 <gettoken+0x3f>
+        nc = _gettoken(s, &np1, &np2);
+  800123:	48 ba 08 00 81 00 00 	movabs $0x810008,%rdx
+  80012a:	00 00 00 
+  80012d:	48 be 10 00 81 00 00 	movabs $0x810010,%rsi
+  800134:	00 00 00 
+  800137:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  80013e:	00 00 00 
+  800141:	ff d0                	call   *%rax
+  800143:	a3 04 00 81 00 00 00 	movabs %eax,0x810004
+  80014a:	00 00 
+        return 0;
+  80014c:	b8 00 00 00 00       	mov    $0x0,%eax
+    }
+    c = nc;
+    *p1 = np1;
+    nc = _gettoken(np2, &np1, &np2);
+    return c;
+}
+  800151:	5b                   	pop    %rbx
+  800152:	41 5c                	pop    %r12
+  800154:	5d                   	pop    %rbp
+  800155:	c3                   	ret
+    c = nc;
+  800156:	48 bb 00 00 81 00 00 	movabs $0x810000,%rbx
+  80015d:	00 00 00 
+  800160:	49 bc 04 00 81 00 00 	movabs $0x810004,%r12
+  800167:	00 00 00 
+  80016a:	41 8b 04 24          	mov    (%r12),%eax
+  80016e:	89 03                	mov    %eax,(%rbx)
+    *p1 = np1;
+  800170:	48 b8 10 00 81 00 00 	movabs $0x810010,%rax
+  800177:	00 00 00 
+  80017a:	48 8b 10             	mov    (%rax),%rdx
+  80017d:	48 89 16             	mov    %rdx,(%rsi)
+    nc = _gettoken(np2, &np1, &np2);
+  800180:	48 ba 08 00 81 00 00 	movabs $0x810008,%rdx
+  800187:	00 00 00 
+  80018a:	48 8b 3a             	mov    (%rdx),%rdi
+  80018d:	48 89 c6             	mov    %rax,%rsi
+  800190:	48 b8 25 00 80 00 00 	movabs $0x800025,%rax
+  800197:	00 00 00 
+  80019a:	ff d0                	call   *%rax
+  80019c:	41 89 04 24          	mov    %eax,(%r12)
+    return c;
+  8001a0:	8b 03                	mov    (%rbx),%eax
+  8001a2:	eb ad                	jmp    800151 <gettoken+0x3a>
+
+00000000008001a4 <runcmd>:
+runcmd(char *s) {
+  8001a4:	55                   	push   %rbp
+  8001a5:	48 89 e5             	mov    %rsp,%rbp
+  8001a8:	41 56                	push   %r14
+  8001aa:	41 55                	push   %r13
+  8001ac:	41 54                	push   %r12
+  8001ae:	53                   	push   %rbx
+  8001af:	48 81 ec 90 04 00 00 	sub    $0x490,%rsp
+    gettoken(s, 0);
+  8001b6:	be 00 00 00 00       	mov    $0x0,%esi
+  8001bb:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  8001c2:	00 00 00 
+  8001c5:	ff d0                	call   *%rax
+        switch ((c = gettoken(0, &t))) {
+  8001c7:	49 bd 17 01 80 00 00 	movabs $0x800117,%r13
+  8001ce:	00 00 00 
+    argc = 0;
+  8001d1:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        switch ((c = gettoken(0, &t))) {
+  8001d7:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  8001de:	bf 00 00 00 00       	mov    $0x0,%edi
+  8001e3:	41 ff d5             	call   *%r13
+  8001e6:	89 c3                	mov    %eax,%ebx
+  8001e8:	83 f8 3e             	cmp    $0x3e,%eax
+  8001eb:	0f 84 93 01 00 00    	je     800384 <runcmd+0x1e0>
+  8001f1:	7f 7f                	jg     800272 <runcmd+0xce>
+  8001f3:	85 c0                	test   %eax,%eax
+  8001f5:	0f 84 c5 02 00 00    	je     8004c0 <runcmd+0x31c>
+  8001fb:	83 f8 3c             	cmp    $0x3c,%eax
+  8001fe:	0f 85 94 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if (gettoken(0, &t) != 'w') {
+  800204:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80020b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800210:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800217:	00 00 00 
+  80021a:	ff d0                	call   *%rax
+  80021c:	83 f8 77             	cmp    $0x77,%eax
+  80021f:	0f 85 02 01 00 00    	jne    800327 <runcmd+0x183>
+            fd = open(t, O_RDONLY);
+  800225:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  80022c:	be 00 00 00 00       	mov    $0x0,%esi
+  800231:	4c 89 f7             	mov    %r14,%rdi
+  800234:	48 b8 f1 3e 80 00 00 	movabs $0x803ef1,%rax
+  80023b:	00 00 00 
+  80023e:	ff d0                	call   *%rax
+  800240:	89 c3                	mov    %eax,%ebx
+            if (fd < 0) {
+  800242:	85 c0                	test   %eax,%eax
+  800244:	0f 88 09 01 00 00    	js     800353 <runcmd+0x1af>
+            } else if (fd != 0) {
+  80024a:	74 8b                	je     8001d7 <runcmd+0x33>
+                dup(fd, 0);
+  80024c:	be 00 00 00 00       	mov    $0x0,%esi
+  800251:	89 c7                	mov    %eax,%edi
+  800253:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  80025a:	00 00 00 
+  80025d:	ff d0                	call   *%rax
+                close(fd);
+  80025f:	89 df                	mov    %ebx,%edi
+  800261:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  800268:	00 00 00 
+  80026b:	ff d0                	call   *%rax
+  80026d:	e9 65 ff ff ff       	jmp    8001d7 <runcmd+0x33>
+        switch ((c = gettoken(0, &t))) {
+  800272:	83 f8 77             	cmp    $0x77,%eax
+  800275:	74 65                	je     8002dc <runcmd+0x138>
+  800277:	83 f8 7c             	cmp    $0x7c,%eax
+  80027a:	0f 85 18 03 00 00    	jne    800598 <runcmd+0x3f4>
+            if ((r = pipe(p)) < 0) {
+  800280:	48 8d bd 50 fb ff ff 	lea    -0x4b0(%rbp),%rdi
+  800287:	48 b8 b8 55 80 00 00 	movabs $0x8055b8,%rax
+  80028e:	00 00 00 
+  800291:	ff d0                	call   *%rax
+  800293:	85 c0                	test   %eax,%eax
+  800295:	0f 88 ad 01 00 00    	js     800448 <runcmd+0x2a4>
+            if ((r = fork()) < 0) {
+  80029b:	48 b8 04 24 80 00 00 	movabs $0x802404,%rax
+  8002a2:	00 00 00 
+  8002a5:	ff d0                	call   *%rax
+  8002a7:	89 c3                	mov    %eax,%ebx
+  8002a9:	85 c0                	test   %eax,%eax
+  8002ab:	0f 88 c5 01 00 00    	js     800476 <runcmd+0x2d2>
+            if (r == 0) {
+  8002b1:	0f 85 e8 01 00 00    	jne    80049f <runcmd+0x2fb>
+                if (p[0] != 0) {
+  8002b7:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  8002bd:	85 ff                	test   %edi,%edi
+  8002bf:	0f 85 83 02 00 00    	jne    800548 <runcmd+0x3a4>
+                close(p[1]);
+  8002c5:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8002cb:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  8002d2:	00 00 00 
+  8002d5:	ff d0                	call   *%rax
+                goto again;
+  8002d7:	e9 f5 fe ff ff       	jmp    8001d1 <runcmd+0x2d>
+            if (argc == MAXARGS) {
+  8002dc:	41 83 fc 10          	cmp    $0x10,%r12d
+  8002e0:	74 1c                	je     8002fe <runcmd+0x15a>
+            argv[argc++] = t;
+  8002e2:	49 63 c4             	movslq %r12d,%rax
+  8002e5:	48 8b 95 58 ff ff ff 	mov    -0xa8(%rbp),%rdx
+  8002ec:	48 89 94 c5 60 ff ff 	mov    %rdx,-0xa0(%rbp,%rax,8)
+  8002f3:	ff 
+  8002f4:	45 8d 64 24 01       	lea    0x1(%r12),%r12d
+            break;
+  8002f9:	e9 d9 fe ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("too many arguments\n");
+  8002fe:	48 bf f1 63 80 00 00 	movabs $0x8063f1,%rdi
+  800305:	00 00 00 
+  800308:	b8 00 00 00 00       	mov    $0x0,%eax
+  80030d:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  800314:	00 00 00 
+  800317:	ff d2                	call   *%rdx
+                exit();
+  800319:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800320:	00 00 00 
+  800323:	ff d0                	call   *%rax
+  800325:	eb bb                	jmp    8002e2 <runcmd+0x13e>
+                cprintf("syntax error: < not followed by word\n");
+  800327:	48 bf a8 64 80 00 00 	movabs $0x8064a8,%rdi
+  80032e:	00 00 00 
+  800331:	b8 00 00 00 00       	mov    $0x0,%eax
+  800336:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  80033d:	00 00 00 
+  800340:	ff d2                	call   *%rdx
+                exit();
+  800342:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800349:	00 00 00 
+  80034c:	ff d0                	call   *%rax
+  80034e:	e9 d2 fe ff ff       	jmp    800225 <runcmd+0x81>
+                cprintf("open %s for read %i", t, fd);
+  800353:	89 c2                	mov    %eax,%edx
+  800355:	4c 89 f6             	mov    %r14,%rsi
+  800358:	48 bf 05 64 80 00 00 	movabs $0x806405,%rdi
+  80035f:	00 00 00 
+  800362:	b8 00 00 00 00       	mov    $0x0,%eax
+  800367:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  80036e:	00 00 00 
+  800371:	ff d1                	call   *%rcx
+                exit();
+  800373:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  80037a:	00 00 00 
+  80037d:	ff d0                	call   *%rax
+  80037f:	e9 53 fe ff ff       	jmp    8001d7 <runcmd+0x33>
+            if (gettoken(0, &t) != 'w') {
+  800384:	48 8d b5 58 ff ff ff 	lea    -0xa8(%rbp),%rsi
+  80038b:	bf 00 00 00 00       	mov    $0x0,%edi
+  800390:	48 b8 17 01 80 00 00 	movabs $0x800117,%rax
+  800397:	00 00 00 
+  80039a:	ff d0                	call   *%rax
+  80039c:	83 f8 77             	cmp    $0x77,%eax
+  80039f:	75 2c                	jne    8003cd <runcmd+0x229>
+            if ((fd = open(t, O_WRONLY | O_CREAT | O_TRUNC)) < 0) {
+  8003a1:	4c 8b b5 58 ff ff ff 	mov    -0xa8(%rbp),%r14
+  8003a8:	be 01 03 00 00       	mov    $0x301,%esi
+  8003ad:	4c 89 f7             	mov    %r14,%rdi
+  8003b0:	48 b8 f1 3e 80 00 00 	movabs $0x803ef1,%rax
+  8003b7:	00 00 00 
+  8003ba:	ff d0                	call   *%rax
+  8003bc:	89 c3                	mov    %eax,%ebx
+  8003be:	85 c0                	test   %eax,%eax
+  8003c0:	78 34                	js     8003f6 <runcmd+0x252>
+            if (fd != 1) {
+  8003c2:	83 f8 01             	cmp    $0x1,%eax
+  8003c5:	0f 84 0c fe ff ff    	je     8001d7 <runcmd+0x33>
+  8003cb:	eb 55                	jmp    800422 <runcmd+0x27e>
+                cprintf("syntax error: > not followed by word\n");
+  8003cd:	48 bf d0 64 80 00 00 	movabs $0x8064d0,%rdi
+  8003d4:	00 00 00 
+  8003d7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8003dc:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  8003e3:	00 00 00 
+  8003e6:	ff d2                	call   *%rdx
+                exit();
+  8003e8:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  8003ef:	00 00 00 
+  8003f2:	ff d0                	call   *%rax
+  8003f4:	eb ab                	jmp    8003a1 <runcmd+0x1fd>
+                cprintf("open %s for write: %i", t, fd);
+  8003f6:	89 c2                	mov    %eax,%edx
+  8003f8:	4c 89 f6             	mov    %r14,%rsi
+  8003fb:	48 bf 19 64 80 00 00 	movabs $0x806419,%rdi
+  800402:	00 00 00 
+  800405:	b8 00 00 00 00       	mov    $0x0,%eax
+  80040a:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  800411:	00 00 00 
+  800414:	ff d1                	call   *%rcx
+                exit();
+  800416:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  80041d:	00 00 00 
+  800420:	ff d0                	call   *%rax
+                dup(fd, 1);
+  800422:	be 01 00 00 00       	mov    $0x1,%esi
+  800427:	89 df                	mov    %ebx,%edi
+  800429:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  800430:	00 00 00 
+  800433:	ff d0                	call   *%rax
+                close(fd);
+  800435:	89 df                	mov    %ebx,%edi
+  800437:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  80043e:	00 00 00 
+  800441:	ff d0                	call   *%rax
+  800443:	e9 8f fd ff ff       	jmp    8001d7 <runcmd+0x33>
+                cprintf("pipe: %i", r);
+  800448:	89 c6                	mov    %eax,%esi
+  80044a:	48 bf 2f 64 80 00 00 	movabs $0x80642f,%rdi
+  800451:	00 00 00 
+  800454:	b8 00 00 00 00       	mov    $0x0,%eax
+  800459:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  800460:	00 00 00 
+  800463:	ff d2                	call   *%rdx
+                exit();
+  800465:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  80046c:	00 00 00 
+  80046f:	ff d0                	call   *%rax
+  800471:	e9 25 fe ff ff       	jmp    80029b <runcmd+0xf7>
+                cprintf("fork: %i", r);
+  800476:	89 c6                	mov    %eax,%esi
+  800478:	48 bf 38 64 80 00 00 	movabs $0x806438,%rdi
+  80047f:	00 00 00 
+  800482:	b8 00 00 00 00       	mov    $0x0,%eax
+  800487:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  80048e:	00 00 00 
+  800491:	ff d2                	call   *%rdx
+                exit();
+  800493:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  80049a:	00 00 00 
+  80049d:	ff d0                	call   *%rax
+                if (p[1] != 1) {
+  80049f:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  8004a5:	83 ff 01             	cmp    $0x1,%edi
+  8004a8:	0f 85 c2 00 00 00    	jne    800570 <runcmd+0x3cc>
+                close(p[0]);
+  8004ae:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  8004b4:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  8004bb:	00 00 00 
+  8004be:	ff d0                	call   *%rax
+    if (argc == 0) {
+  8004c0:	45 85 e4             	test   %r12d,%r12d
+  8004c3:	74 73                	je     800538 <runcmd+0x394>
+    if (argv[0][0] != '/') {
+  8004c5:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8004cc:	80 3e 2f             	cmpb   $0x2f,(%rsi)
+  8004cf:	0f 85 f0 00 00 00    	jne    8005c5 <runcmd+0x421>
+    argv[argc] = 0;
+  8004d5:	4d 63 e4             	movslq %r12d,%r12
+  8004d8:	4a c7 84 e5 60 ff ff 	movq   $0x0,-0xa0(%rbp,%r12,8)
+  8004df:	ff 00 00 00 00 
+    if ((r = spawn(argv[0], (const char **)argv)) < 0)
+  8004e4:	48 8d b5 60 ff ff ff 	lea    -0xa0(%rbp),%rsi
+  8004eb:	48 8b bd 60 ff ff ff 	mov    -0xa0(%rbp),%rdi
+  8004f2:	48 b8 91 49 80 00 00 	movabs $0x804991,%rax
+  8004f9:	00 00 00 
+  8004fc:	ff d0                	call   *%rax
+  8004fe:	41 89 c4             	mov    %eax,%r12d
+  800501:	85 c0                	test   %eax,%eax
+  800503:	0f 88 e9 00 00 00    	js     8005f2 <runcmd+0x44e>
+    close_all();
+  800509:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  800510:	00 00 00 
+  800513:	ff d0                	call   *%rax
+        wait(r);
+  800515:	44 89 e7             	mov    %r12d,%edi
+  800518:	48 b8 05 58 80 00 00 	movabs $0x805805,%rax
+  80051f:	00 00 00 
+  800522:	ff d0                	call   *%rax
+    if (pipe_child) {
+  800524:	85 db                	test   %ebx,%ebx
+  800526:	0f 85 fb 00 00 00    	jne    800627 <runcmd+0x483>
+    exit();
+  80052c:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800533:	00 00 00 
+  800536:	ff d0                	call   *%rax
+}
+  800538:	48 81 c4 90 04 00 00 	add    $0x490,%rsp
+  80053f:	5b                   	pop    %rbx
+  800540:	41 5c                	pop    %r12
+  800542:	41 5d                	pop    %r13
+  800544:	41 5e                	pop    %r14
+  800546:	5d                   	pop    %rbp
+  800547:	c3                   	ret
+                    dup(p[0], 0);
+  800548:	be 00 00 00 00       	mov    $0x0,%esi
+  80054d:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  800554:	00 00 00 
+  800557:	ff d0                	call   *%rax
+                    close(p[0]);
+  800559:	8b bd 50 fb ff ff    	mov    -0x4b0(%rbp),%edi
+  80055f:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  800566:	00 00 00 
+  800569:	ff d0                	call   *%rax
+  80056b:	e9 55 fd ff ff       	jmp    8002c5 <runcmd+0x121>
+                    dup(p[1], 1);
+  800570:	be 01 00 00 00       	mov    $0x1,%esi
+  800575:	48 b8 ec 28 80 00 00 	movabs $0x8028ec,%rax
+  80057c:	00 00 00 
+  80057f:	ff d0                	call   *%rax
+                    close(p[1]);
+  800581:	8b bd 54 fb ff ff    	mov    -0x4ac(%rbp),%edi
+  800587:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  80058e:	00 00 00 
+  800591:	ff d0                	call   *%rax
+  800593:	e9 16 ff ff ff       	jmp    8004ae <runcmd+0x30a>
+            panic("bad return %d from gettoken", c);
+  800598:	89 d9                	mov    %ebx,%ecx
+  80059a:	48 ba 41 64 80 00 00 	movabs $0x806441,%rdx
+  8005a1:	00 00 00 
+  8005a4:	be 70 00 00 00       	mov    $0x70,%esi
+  8005a9:	48 bf 5d 64 80 00 00 	movabs $0x80645d,%rdi
+  8005b0:	00 00 00 
+  8005b3:	b8 00 00 00 00       	mov    $0x0,%eax
+  8005b8:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  8005bf:	00 00 00 
+  8005c2:	41 ff d0             	call   *%r8
+        argv0buf[0] = '/';
+  8005c5:	c6 85 58 fb ff ff 2f 	movb   $0x2f,-0x4a8(%rbp)
+        strcpy(argv0buf + 1, argv[0]);
+  8005cc:	4c 8d ad 58 fb ff ff 	lea    -0x4a8(%rbp),%r13
+  8005d3:	48 8d bd 59 fb ff ff 	lea    -0x4a7(%rbp),%rdi
+  8005da:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  8005e1:	00 00 00 
+  8005e4:	ff d0                	call   *%rax
+        argv[0] = argv0buf;
+  8005e6:	4c 89 ad 60 ff ff ff 	mov    %r13,-0xa0(%rbp)
+  8005ed:	e9 e3 fe ff ff       	jmp    8004d5 <runcmd+0x331>
+        cprintf("spawn %s: %i\n", argv[0], r);
+  8005f2:	89 c2                	mov    %eax,%edx
+  8005f4:	48 8b b5 60 ff ff ff 	mov    -0xa0(%rbp),%rsi
+  8005fb:	48 bf 67 64 80 00 00 	movabs $0x806467,%rdi
+  800602:	00 00 00 
+  800605:	b8 00 00 00 00       	mov    $0x0,%eax
+  80060a:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  800611:	00 00 00 
+  800614:	ff d1                	call   *%rcx
+    close_all();
+  800616:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  80061d:	00 00 00 
+  800620:	ff d0                	call   *%rax
+    if (r >= 0) {
+  800622:	e9 fd fe ff ff       	jmp    800524 <runcmd+0x380>
+        wait(pipe_child);
+  800627:	89 df                	mov    %ebx,%edi
+  800629:	48 b8 05 58 80 00 00 	movabs $0x805805,%rax
+  800630:	00 00 00 
+  800633:	ff d0                	call   *%rax
+        if (debug) cprintf("[%08x] wait finished\n", thisenv->env_id);
+  800635:	e9 f2 fe ff ff       	jmp    80052c <runcmd+0x388>
+
+000000000080063a <usage>:
+
+void
+usage(void) {
+  80063a:	55                   	push   %rbp
+  80063b:	48 89 e5             	mov    %rsp,%rbp
+    cprintf("usage: sh [-dix] [command-file]\n");
+  80063e:	48 bf f8 64 80 00 00 	movabs $0x8064f8,%rdi
+  800645:	00 00 00 
+  800648:	b8 00 00 00 00       	mov    $0x0,%eax
+  80064d:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  800654:	00 00 00 
+  800657:	ff d2                	call   *%rdx
+    exit();
+  800659:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800660:	00 00 00 
+  800663:	ff d0                	call   *%rax
+}
+  800665:	5d                   	pop    %rbp
+  800666:	c3                   	ret
+
+0000000000800667 <umain>:
+
+void
+umain(int argc, char **argv) {
+  800667:	55                   	push   %rbp
+  800668:	48 89 e5             	mov    %rsp,%rbp
+  80066b:	41 57                	push   %r15
+  80066d:	41 56                	push   %r14
+  80066f:	41 55                	push   %r13
+  800671:	41 54                	push   %r12
+  800673:	53                   	push   %rbx
+  800674:	48 83 ec 38          	sub    $0x38,%rsp
+  800678:	89 7d ac             	mov    %edi,-0x54(%rbp)
+  80067b:	48 89 75 a0          	mov    %rsi,-0x60(%rbp)
+    int r, interactive, echocmds;
+    struct Argstate args;
+
+    interactive = '?';
+    echocmds = 0;
+    argstart(&argc, argv, &args);
+  80067f:	48 8d 55 b0          	lea    -0x50(%rbp),%rdx
+  800683:	48 8d 7d ac          	lea    -0x54(%rbp),%rdi
+  800687:	48 b8 24 25 80 00 00 	movabs $0x802524,%rax
+  80068e:	00 00 00 
+  800691:	ff d0                	call   *%rax
+    echocmds = 0;
+  800693:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+    interactive = '?';
+  800699:	41 be 3f 00 00 00    	mov    $0x3f,%r14d
+    while ((r = argnext(&args)) >= 0) {
+  80069f:	48 bb 51 25 80 00 00 	movabs $0x802551,%rbx
+  8006a6:	00 00 00 
+        switch (r) {
+  8006a9:	41 bc 01 00 00 00    	mov    $0x1,%r12d
+            break;
+        case 'x':
+            echocmds = 1;
+            break;
+        default:
+            usage();
+  8006af:	49 bf 3a 06 80 00 00 	movabs $0x80063a,%r15
+  8006b6:	00 00 00 
+    while ((r = argnext(&args)) >= 0) {
+  8006b9:	eb 08                	jmp    8006c3 <umain+0x5c>
+        switch (r) {
+  8006bb:	45 89 e6             	mov    %r12d,%r14d
+  8006be:	eb 03                	jmp    8006c3 <umain+0x5c>
+            echocmds = 1;
+  8006c0:	45 89 e5             	mov    %r12d,%r13d
+    while ((r = argnext(&args)) >= 0) {
+  8006c3:	48 8d 7d b0          	lea    -0x50(%rbp),%rdi
+  8006c7:	ff d3                	call   *%rbx
+  8006c9:	85 c0                	test   %eax,%eax
+  8006cb:	78 14                	js     8006e1 <umain+0x7a>
+        switch (r) {
+  8006cd:	83 f8 69             	cmp    $0x69,%eax
+  8006d0:	74 e9                	je     8006bb <umain+0x54>
+  8006d2:	83 f8 78             	cmp    $0x78,%eax
+  8006d5:	74 e9                	je     8006c0 <umain+0x59>
+  8006d7:	83 f8 64             	cmp    $0x64,%eax
+  8006da:	74 e7                	je     8006c3 <umain+0x5c>
+            usage();
+  8006dc:	41 ff d7             	call   *%r15
+  8006df:	eb e2                	jmp    8006c3 <umain+0x5c>
+        }
+    }
+
+    if (argc > 2)
+  8006e1:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006e5:	7f 3f                	jg     800726 <umain+0xbf>
+        usage();
+    if (argc == 2) {
+  8006e7:	83 7d ac 02          	cmpl   $0x2,-0x54(%rbp)
+  8006eb:	74 47                	je     800734 <umain+0xcd>
+        close(0);
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+            panic("open %s: %i", argv[1], r);
+        assert(r == 0);
+    }
+    if (interactive == '?')
+  8006ed:	41 83 fe 3f          	cmp    $0x3f,%r14d
+  8006f1:	0f 84 d8 00 00 00    	je     8007cf <umain+0x168>
+  8006f7:	45 85 f6             	test   %r14d,%r14d
+  8006fa:	49 bc 9d 64 80 00 00 	movabs $0x80649d,%r12
+  800701:	00 00 00 
+  800704:	b8 00 00 00 00       	mov    $0x0,%eax
+  800709:	4c 0f 44 e0          	cmove  %rax,%r12
+        interactive = iscons(0);
+
+    while (1) {
+        char *buf;
+
+        buf = readline(interactive ? "$ " : NULL);
+  80070d:	49 be 23 1a 80 00 00 	movabs $0x801a23,%r14
+  800714:	00 00 00 
+        if (buf == NULL) {
+            if (debug) cprintf("EXITING\n");
+            exit(); /* end of file */
+  800717:	49 bf 64 0b 80 00 00 	movabs $0x800b64,%r15
+  80071e:	00 00 00 
+  800721:	e9 22 01 00 00       	jmp    800848 <umain+0x1e1>
+        usage();
+  800726:	48 b8 3a 06 80 00 00 	movabs $0x80063a,%rax
+  80072d:	00 00 00 
+  800730:	ff d0                	call   *%rax
+  800732:	eb b3                	jmp    8006e7 <umain+0x80>
+        close(0);
+  800734:	bf 00 00 00 00       	mov    $0x0,%edi
+  800739:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  800740:	00 00 00 
+  800743:	ff d0                	call   *%rax
+        if ((r = open(argv[1], O_RDONLY)) < 0)
+  800745:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  800749:	48 8b 78 08          	mov    0x8(%rax),%rdi
+  80074d:	be 00 00 00 00       	mov    $0x0,%esi
+  800752:	48 b8 f1 3e 80 00 00 	movabs $0x803ef1,%rax
+  800759:	00 00 00 
+  80075c:	ff d0                	call   *%rax
+  80075e:	85 c0                	test   %eax,%eax
+  800760:	78 37                	js     800799 <umain+0x132>
+        assert(r == 0);
+  800762:	74 89                	je     8006ed <umain+0x86>
+  800764:	48 b9 81 64 80 00 00 	movabs $0x806481,%rcx
+  80076b:	00 00 00 
+  80076e:	48 ba 88 64 80 00 00 	movabs $0x806488,%rdx
+  800775:	00 00 00 
+  800778:	be 16 01 00 00       	mov    $0x116,%esi
+  80077d:	48 bf 5d 64 80 00 00 	movabs $0x80645d,%rdi
+  800784:	00 00 00 
+  800787:	b8 00 00 00 00       	mov    $0x0,%eax
+  80078c:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  800793:	00 00 00 
+  800796:	41 ff d0             	call   *%r8
+            panic("open %s: %i", argv[1], r);
+  800799:	48 8b 55 a0          	mov    -0x60(%rbp),%rdx
+  80079d:	48 8b 4a 08          	mov    0x8(%rdx),%rcx
+  8007a1:	41 89 c0             	mov    %eax,%r8d
+  8007a4:	48 ba 75 64 80 00 00 	movabs $0x806475,%rdx
+  8007ab:	00 00 00 
+  8007ae:	be 15 01 00 00       	mov    $0x115,%esi
+  8007b3:	48 bf 5d 64 80 00 00 	movabs $0x80645d,%rdi
+  8007ba:	00 00 00 
+  8007bd:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007c2:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  8007c9:	00 00 00 
+  8007cc:	41 ff d1             	call   *%r9
+        interactive = iscons(0);
+  8007cf:	bf 00 00 00 00       	mov    $0x0,%edi
+  8007d4:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  8007db:	00 00 00 
+  8007de:	ff d0                	call   *%rax
+  8007e0:	41 89 c6             	mov    %eax,%r14d
+  8007e3:	e9 0f ff ff ff       	jmp    8006f7 <umain+0x90>
+            exit(); /* end of file */
+  8007e8:	41 ff d7             	call   *%r15
+  8007eb:	eb 69                	jmp    800856 <umain+0x1ef>
+        }
+        if (debug) cprintf("LINE: %s\n", buf);
+        if (buf[0] == '#') continue;
+        if (echocmds) printf("# %s\n", buf);
+  8007ed:	48 89 de             	mov    %rbx,%rsi
+  8007f0:	48 bf a0 64 80 00 00 	movabs $0x8064a0,%rdi
+  8007f7:	00 00 00 
+  8007fa:	b8 00 00 00 00       	mov    $0x0,%eax
+  8007ff:	48 b9 ef 48 80 00 00 	movabs $0x8048ef,%rcx
+  800806:	00 00 00 
+  800809:	ff d1                	call   *%rcx
+  80080b:	eb 53                	jmp    800860 <umain+0x1f9>
+        if (debug) cprintf("BEFORE FORK\n");
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  80080d:	89 c1                	mov    %eax,%ecx
+  80080f:	48 ba 38 64 80 00 00 	movabs $0x806438,%rdx
+  800816:	00 00 00 
+  800819:	be 27 01 00 00       	mov    $0x127,%esi
+  80081e:	48 bf 5d 64 80 00 00 	movabs $0x80645d,%rdi
+  800825:	00 00 00 
+  800828:	b8 00 00 00 00       	mov    $0x0,%eax
+  80082d:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  800834:	00 00 00 
+  800837:	41 ff d0             	call   *%r8
+        if (debug) cprintf("FORK: %d\n", r);
+        if (r == 0) {
+            runcmd(buf);
+            exit();
+        } else
+            wait(r);
+  80083a:	89 c7                	mov    %eax,%edi
+  80083c:	48 b8 05 58 80 00 00 	movabs $0x805805,%rax
+  800843:	00 00 00 
+  800846:	ff d0                	call   *%rax
+        buf = readline(interactive ? "$ " : NULL);
+  800848:	4c 89 e7             	mov    %r12,%rdi
+  80084b:	41 ff d6             	call   *%r14
+  80084e:	48 89 c3             	mov    %rax,%rbx
+        if (buf == NULL) {
+  800851:	48 85 c0             	test   %rax,%rax
+  800854:	74 92                	je     8007e8 <umain+0x181>
+        if (buf[0] == '#') continue;
+  800856:	80 3b 23             	cmpb   $0x23,(%rbx)
+  800859:	74 ed                	je     800848 <umain+0x1e1>
+        if (echocmds) printf("# %s\n", buf);
+  80085b:	45 85 ed             	test   %r13d,%r13d
+  80085e:	75 8d                	jne    8007ed <umain+0x186>
+        if ((r = fork()) < 0) panic("fork: %i", r);
+  800860:	48 b8 04 24 80 00 00 	movabs $0x802404,%rax
+  800867:	00 00 00 
+  80086a:	ff d0                	call   *%rax
+  80086c:	85 c0                	test   %eax,%eax
+  80086e:	78 9d                	js     80080d <umain+0x1a6>
+        if (r == 0) {
+  800870:	75 c8                	jne    80083a <umain+0x1d3>
+            runcmd(buf);
+  800872:	48 89 df             	mov    %rbx,%rdi
+  800875:	48 b8 a4 01 80 00 00 	movabs $0x8001a4,%rax
+  80087c:	00 00 00 
+  80087f:	ff d0                	call   *%rax
+            exit();
+  800881:	41 ff d7             	call   *%r15
+  800884:	eb c2                	jmp    800848 <umain+0x1e1>
+
+0000000000800886 <devcons_close>:
+static int
+devcons_close(struct Fd *fd) {
+    USED(fd);
+
+    return 0;
+}
+  800886:	b8 00 00 00 00       	mov    $0x0,%eax
+  80088b:	c3                   	ret
+
+000000000080088c <devcons_stat>:
+
+static int
+devcons_stat(struct Fd *fd, struct Stat *stat) {
+  80088c:	55                   	push   %rbp
+  80088d:	48 89 e5             	mov    %rsp,%rbp
+  800890:	48 89 f7             	mov    %rsi,%rdi
+    strcpy(stat->st_name, "<cons>");
+  800893:	48 be 19 65 80 00 00 	movabs $0x806519,%rsi
+  80089a:	00 00 00 
+  80089d:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  8008a4:	00 00 00 
+  8008a7:	ff d0                	call   *%rax
+    return 0;
+}
+  8008a9:	b8 00 00 00 00       	mov    $0x0,%eax
+  8008ae:	5d                   	pop    %rbp
+  8008af:	c3                   	ret
+
+00000000008008b0 <devcons_write>:
+devcons_write(struct Fd *fd, const void *vbuf, size_t n) {
+  8008b0:	55                   	push   %rbp
+  8008b1:	48 89 e5             	mov    %rsp,%rbp
+  8008b4:	41 57                	push   %r15
+  8008b6:	41 56                	push   %r14
+  8008b8:	41 55                	push   %r13
+  8008ba:	41 54                	push   %r12
+  8008bc:	53                   	push   %rbx
+  8008bd:	48 81 ec 98 00 00 00 	sub    $0x98,%rsp
+  8008c4:	48 89 b5 48 ff ff ff 	mov    %rsi,-0xb8(%rbp)
+    for (res = 0; res < n; res += inc) {
+  8008cb:	48 85 d2             	test   %rdx,%rdx
+  8008ce:	74 7a                	je     80094a <devcons_write+0x9a>
+  8008d0:	49 89 d6             	mov    %rdx,%r14
+  8008d3:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  8008d9:	be 00 00 00 00       	mov    $0x0,%esi
+        memmove(buf, (char *)vbuf + res, inc);
+  8008de:	49 bf f6 17 80 00 00 	movabs $0x8017f6,%r15
+  8008e5:	00 00 00 
+        inc = MIN(n - res, WRITEBUFSZ - 1);
+  8008e8:	4c 89 f3             	mov    %r14,%rbx
+  8008eb:	48 29 f3             	sub    %rsi,%rbx
+  8008ee:	b8 7f 00 00 00       	mov    $0x7f,%eax
+  8008f3:	48 39 c3             	cmp    %rax,%rbx
+  8008f6:	48 0f 47 d8          	cmova  %rax,%rbx
+        memmove(buf, (char *)vbuf + res, inc);
+  8008fa:	4c 63 eb             	movslq %ebx,%r13
+  8008fd:	48 8b 85 48 ff ff ff 	mov    -0xb8(%rbp),%rax
+  800904:	48 01 c6             	add    %rax,%rsi
+  800907:	4c 89 ea             	mov    %r13,%rdx
+  80090a:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  800911:	41 ff d7             	call   *%r15
+        sys_cputs(buf, inc);
+  800914:	4c 89 ee             	mov    %r13,%rsi
+  800917:	48 8d bd 50 ff ff ff 	lea    -0xb0(%rbp),%rdi
+  80091e:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  800925:	00 00 00 
+  800928:	ff d0                	call   *%rax
+    for (res = 0; res < n; res += inc) {
+  80092a:	41 01 dc             	add    %ebx,%r12d
+  80092d:	49 63 f4             	movslq %r12d,%rsi
+  800930:	4c 39 f6             	cmp    %r14,%rsi
+  800933:	72 b3                	jb     8008e8 <devcons_write+0x38>
+    return res;
+  800935:	49 63 c4             	movslq %r12d,%rax
+}
+  800938:	48 81 c4 98 00 00 00 	add    $0x98,%rsp
+  80093f:	5b                   	pop    %rbx
+  800940:	41 5c                	pop    %r12
+  800942:	41 5d                	pop    %r13
+  800944:	41 5e                	pop    %r14
+  800946:	41 5f                	pop    %r15
+  800948:	5d                   	pop    %rbp
+  800949:	c3                   	ret
+    for (res = 0; res < n; res += inc) {
+  80094a:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  800950:	eb e3                	jmp    800935 <devcons_write+0x85>
+
+0000000000800952 <devcons_read>:
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  800952:	48 89 d0             	mov    %rdx,%rax
+    if (!n) return 0;
+  800955:	ba 00 00 00 00       	mov    $0x0,%edx
+  80095a:	48 85 c0             	test   %rax,%rax
+  80095d:	74 55                	je     8009b4 <devcons_read+0x62>
+devcons_read(struct Fd *fd, void *vbuf, size_t n) {
+  80095f:	55                   	push   %rbp
+  800960:	48 89 e5             	mov    %rsp,%rbp
+  800963:	41 55                	push   %r13
+  800965:	41 54                	push   %r12
+  800967:	53                   	push   %rbx
+  800968:	48 83 ec 08          	sub    $0x8,%rsp
+  80096c:	49 89 f5             	mov    %rsi,%r13
+    while (!(c = sys_cgetc())) sys_yield();
+  80096f:	48 bb b8 1e 80 00 00 	movabs $0x801eb8,%rbx
+  800976:	00 00 00 
+  800979:	49 bc 6d 1f 80 00 00 	movabs $0x801f6d,%r12
+  800980:	00 00 00 
+  800983:	eb 03                	jmp    800988 <devcons_read+0x36>
+  800985:	41 ff d4             	call   *%r12
+  800988:	ff d3                	call   *%rbx
+  80098a:	85 c0                	test   %eax,%eax
+  80098c:	74 f7                	je     800985 <devcons_read+0x33>
+    if (c < 0) return c;
+  80098e:	48 63 d0             	movslq %eax,%rdx
+  800991:	78 13                	js     8009a6 <devcons_read+0x54>
+    if (c == 0x04) return 0;
+  800993:	ba 00 00 00 00       	mov    $0x0,%edx
+  800998:	83 f8 04             	cmp    $0x4,%eax
+  80099b:	74 09                	je     8009a6 <devcons_read+0x54>
+    *(char *)vbuf = (char)c;
+  80099d:	41 88 45 00          	mov    %al,0x0(%r13)
+    return 1;
+  8009a1:	ba 01 00 00 00       	mov    $0x1,%edx
+}
+  8009a6:	48 89 d0             	mov    %rdx,%rax
+  8009a9:	48 83 c4 08          	add    $0x8,%rsp
+  8009ad:	5b                   	pop    %rbx
+  8009ae:	41 5c                	pop    %r12
+  8009b0:	41 5d                	pop    %r13
+  8009b2:	5d                   	pop    %rbp
+  8009b3:	c3                   	ret
+  8009b4:	48 89 d0             	mov    %rdx,%rax
+  8009b7:	c3                   	ret
+
+00000000008009b8 <cputchar>:
+cputchar(int ch) {
+  8009b8:	55                   	push   %rbp
+  8009b9:	48 89 e5             	mov    %rsp,%rbp
+  8009bc:	48 83 ec 10          	sub    $0x10,%rsp
+    char c = (char)ch;
+  8009c0:	40 88 7d ff          	mov    %dil,-0x1(%rbp)
+    sys_cputs(&c, 1);
+  8009c4:	be 01 00 00 00       	mov    $0x1,%esi
+  8009c9:	48 8d 7d ff          	lea    -0x1(%rbp),%rdi
+  8009cd:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  8009d4:	00 00 00 
+  8009d7:	ff d0                	call   *%rax
+}
+  8009d9:	c9                   	leave
+  8009da:	c3                   	ret
+
+00000000008009db <getchar>:
+getchar(void) {
+  8009db:	55                   	push   %rbp
+  8009dc:	48 89 e5             	mov    %rsp,%rbp
+  8009df:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = read(0, &c, 1);
+  8009e3:	ba 01 00 00 00       	mov    $0x1,%edx
+  8009e8:	48 8d 75 ff          	lea    -0x1(%rbp),%rsi
+  8009ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8009f1:	48 b8 0f 2a 80 00 00 	movabs $0x802a0f,%rax
+  8009f8:	00 00 00 
+  8009fb:	ff d0                	call   *%rax
+  8009fd:	89 c2                	mov    %eax,%edx
+    return res < 0 ? res : res ? c :
+  8009ff:	85 c0                	test   %eax,%eax
+  800a01:	78 06                	js     800a09 <getchar+0x2e>
+  800a03:	74 08                	je     800a0d <getchar+0x32>
+  800a05:	0f b6 55 ff          	movzbl -0x1(%rbp),%edx
+}
+  800a09:	89 d0                	mov    %edx,%eax
+  800a0b:	c9                   	leave
+  800a0c:	c3                   	ret
+    return res < 0 ? res : res ? c :
+  800a0d:	ba f4 ff ff ff       	mov    $0xfffffff4,%edx
+  800a12:	eb f5                	jmp    800a09 <getchar+0x2e>
+
+0000000000800a14 <iscons>:
+iscons(int fdnum) {
+  800a14:	55                   	push   %rbp
+  800a15:	48 89 e5             	mov    %rsp,%rbp
+  800a18:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  800a1c:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  800a20:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  800a27:	00 00 00 
+  800a2a:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  800a2c:	85 c0                	test   %eax,%eax
+  800a2e:	78 18                	js     800a48 <iscons+0x34>
+    return fd->fd_dev_id == devcons.dev_id;
+  800a30:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a34:	48 b8 00 70 80 00 00 	movabs $0x807000,%rax
+  800a3b:	00 00 00 
+  800a3e:	8b 00                	mov    (%rax),%eax
+  800a40:	39 02                	cmp    %eax,(%rdx)
+  800a42:	0f 94 c0             	sete   %al
+  800a45:	0f b6 c0             	movzbl %al,%eax
+}
+  800a48:	c9                   	leave
+  800a49:	c3                   	ret
+
+0000000000800a4a <opencons>:
+opencons(void) {
+  800a4a:	55                   	push   %rbp
+  800a4b:	48 89 e5             	mov    %rsp,%rbp
+  800a4e:	48 83 ec 10          	sub    $0x10,%rsp
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  800a52:	48 8d 7d f8          	lea    -0x8(%rbp),%rdi
+  800a56:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  800a5d:	00 00 00 
+  800a60:	ff d0                	call   *%rax
+  800a62:	85 c0                	test   %eax,%eax
+  800a64:	78 49                	js     800aaf <opencons+0x65>
+    if ((res = sys_alloc_region(0, fd, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) return res;
+  800a66:	b9 46 00 00 00       	mov    $0x46,%ecx
+  800a6b:	ba 00 10 00 00       	mov    $0x1000,%edx
+  800a70:	48 8b 75 f8          	mov    -0x8(%rbp),%rsi
+  800a74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800a79:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  800a80:	00 00 00 
+  800a83:	ff d0                	call   *%rax
+  800a85:	85 c0                	test   %eax,%eax
+  800a87:	78 26                	js     800aaf <opencons+0x65>
+    fd->fd_dev_id = devcons.dev_id;
+  800a89:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  800a8d:	a1 00 70 80 00 00 00 	movabs 0x807000,%eax
+  800a94:	00 00 
+  800a96:	89 02                	mov    %eax,(%rdx)
+    fd->fd_omode = O_RDWR;
+  800a98:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  800a9c:	c7 47 08 02 00 00 00 	movl   $0x2,0x8(%rdi)
+    return fd2num(fd);
+  800aa3:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  800aaa:	00 00 00 
+  800aad:	ff d0                	call   *%rax
+}
+  800aaf:	c9                   	leave
+  800ab0:	c3                   	ret
+
+0000000000800ab1 <libmain>:
+#ifdef JOS_PROG
+void (*volatile sys_exit)(void);
+#endif
+
+void
+libmain(int argc, char **argv) {
+  800ab1:	55                   	push   %rbp
+  800ab2:	48 89 e5             	mov    %rsp,%rbp
+  800ab5:	41 56                	push   %r14
+  800ab7:	41 55                	push   %r13
+  800ab9:	41 54                	push   %r12
+  800abb:	53                   	push   %rbx
+  800abc:	41 89 fd             	mov    %edi,%r13d
+  800abf:	49 89 f6             	mov    %rsi,%r14
+    /* Perform global constructor initialisation (e.g. asan)
+    * This must be done as early as possible */
+    extern void (*__ctors_start)(), (*__ctors_end)();
+    void (**ctor)() = &__ctors_start;
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ac2:	48 ba e0 70 80 00 00 	movabs $0x8070e0,%rdx
+  800ac9:	00 00 00 
+  800acc:	48 b8 e0 70 80 00 00 	movabs $0x8070e0,%rax
+  800ad3:	00 00 00 
+  800ad6:	48 39 c2             	cmp    %rax,%rdx
+  800ad9:	73 17                	jae    800af2 <libmain+0x41>
+    void (**ctor)() = &__ctors_start;
+  800adb:	48 89 d3             	mov    %rdx,%rbx
+    while (ctor < &__ctors_end) (*ctor++)();
+  800ade:	49 89 c4             	mov    %rax,%r12
+  800ae1:	48 83 c3 08          	add    $0x8,%rbx
+  800ae5:	b8 00 00 00 00       	mov    $0x0,%eax
+  800aea:	ff 53 f8             	call   *-0x8(%rbx)
+  800aed:	4c 39 e3             	cmp    %r12,%rbx
+  800af0:	72 ef                	jb     800ae1 <libmain+0x30>
+
+    /* Set thisenv to point at our Env structure in envs[]. */
+    // LAB 8: Your code here
+	thisenv = &envs[ENVX(sys_getenvid())];
+  800af2:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  800af9:	00 00 00 
+  800afc:	ff d0                	call   *%rax
+  800afe:	89 c2                	mov    %eax,%edx
+  800b00:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  800b06:	48 89 d0             	mov    %rdx,%rax
+  800b09:	48 c1 e0 04          	shl    $0x4,%rax
+  800b0d:	48 29 d0             	sub    %rdx,%rax
+  800b10:	48 c1 e0 05          	shl    $0x5,%rax
+  800b14:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  800b1b:	00 00 00 
+  800b1e:	48 01 d0             	add    %rdx,%rax
+  800b21:	48 a3 18 00 81 00 00 	movabs %rax,0x810018
+  800b28:	00 00 00 
+	
+    /* Save the name of the program so that panic() can use it */
+    if (argc > 0) binaryname = argv[0];
+  800b2b:	45 85 ed             	test   %r13d,%r13d
+  800b2e:	7e 0d                	jle    800b3d <libmain+0x8c>
+  800b30:	49 8b 06             	mov    (%r14),%rax
+  800b33:	48 a3 40 70 80 00 00 	movabs %rax,0x807040
+  800b3a:	00 00 00 
+
+    /* Call user main routine */
+    umain(argc, argv);
+  800b3d:	4c 89 f6             	mov    %r14,%rsi
+  800b40:	44 89 ef             	mov    %r13d,%edi
+  800b43:	48 b8 67 06 80 00 00 	movabs $0x800667,%rax
+  800b4a:	00 00 00 
+  800b4d:	ff d0                	call   *%rax
+
+#ifdef JOS_PROG
+    sys_exit();
+#else
+    exit();
+  800b4f:	48 b8 64 0b 80 00 00 	movabs $0x800b64,%rax
+  800b56:	00 00 00 
+  800b59:	ff d0                	call   *%rax
+#endif
+}
+  800b5b:	5b                   	pop    %rbx
+  800b5c:	41 5c                	pop    %r12
+  800b5e:	41 5d                	pop    %r13
+  800b60:	41 5e                	pop    %r14
+  800b62:	5d                   	pop    %rbp
+  800b63:	c3                   	ret
+
+0000000000800b64 <exit>:
+
+#include <inc/lib.h>
+
+void
+exit(void) {
+  800b64:	55                   	push   %rbp
+  800b65:	48 89 e5             	mov    %rsp,%rbp
+    close_all();
+  800b68:	48 b8 c4 28 80 00 00 	movabs $0x8028c4,%rax
+  800b6f:	00 00 00 
+  800b72:	ff d0                	call   *%rax
+    sys_env_destroy(0);
+  800b74:	bf 00 00 00 00       	mov    $0x0,%edi
+  800b79:	48 b8 e1 1e 80 00 00 	movabs $0x801ee1,%rax
+  800b80:	00 00 00 
+  800b83:	ff d0                	call   *%rax
+}
+  800b85:	5d                   	pop    %rbp
+  800b86:	c3                   	ret
+
+0000000000800b87 <_panic>:
+
+/* Panic is called on unresolvable fatal errors.
+ * It prints "panic: <message>", then causes a breakpoint exception,
+ * which causes JOS to enter the JOS kernel monitor. */
+void
+_panic(const char *file, int line, const char *fmt, ...) {
+  800b87:	55                   	push   %rbp
+  800b88:	48 89 e5             	mov    %rsp,%rbp
+  800b8b:	41 56                	push   %r14
+  800b8d:	41 55                	push   %r13
+  800b8f:	41 54                	push   %r12
+  800b91:	53                   	push   %rbx
+  800b92:	48 83 ec 50          	sub    $0x50,%rsp
+  800b96:	49 89 fc             	mov    %rdi,%r12
+  800b99:	41 89 f5             	mov    %esi,%r13d
+  800b9c:	48 89 d3             	mov    %rdx,%rbx
+  800b9f:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  800ba3:	4c 89 45 d0          	mov    %r8,-0x30(%rbp)
+  800ba7:	4c 89 4d d8          	mov    %r9,-0x28(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  800bab:	c7 45 98 18 00 00 00 	movl   $0x18,-0x68(%rbp)
+  800bb2:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800bb6:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+  800bba:	48 8d 45 b0          	lea    -0x50(%rbp),%rax
+  800bbe:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+
+    /* Print the panic message */
+    cprintf("[%08x] user panic in %s at %s:%d: ",
+  800bc2:	48 b8 40 70 80 00 00 	movabs $0x807040,%rax
+  800bc9:	00 00 00 
+  800bcc:	4c 8b 30             	mov    (%rax),%r14
+  800bcf:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  800bd6:	00 00 00 
+  800bd9:	ff d0                	call   *%rax
+  800bdb:	89 c6                	mov    %eax,%esi
+  800bdd:	45 89 e8             	mov    %r13d,%r8d
+  800be0:	4c 89 e1             	mov    %r12,%rcx
+  800be3:	4c 89 f2             	mov    %r14,%rdx
+  800be6:	48 bf 30 65 80 00 00 	movabs $0x806530,%rdi
+  800bed:	00 00 00 
+  800bf0:	b8 00 00 00 00       	mov    $0x0,%eax
+  800bf5:	49 bc d7 0c 80 00 00 	movabs $0x800cd7,%r12
+  800bfc:	00 00 00 
+  800bff:	41 ff d4             	call   *%r12
+            sys_getenvid(), binaryname, file, line);
+    vcprintf(fmt, ap);
+  800c02:	48 8d 75 98          	lea    -0x68(%rbp),%rsi
+  800c06:	48 89 df             	mov    %rbx,%rdi
+  800c09:	48 b8 73 0c 80 00 00 	movabs $0x800c73,%rax
+  800c10:	00 00 00 
+  800c13:	ff d0                	call   *%rax
+    cprintf("\n");
+  800c15:	48 bf e3 63 80 00 00 	movabs $0x8063e3,%rdi
+  800c1c:	00 00 00 
+  800c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c24:	41 ff d4             	call   *%r12
+
+    /* Cause a breakpoint exception */
+    for (;;) asm volatile("int3");
+  800c27:	cc                   	int3
+  800c28:	eb fd                	jmp    800c27 <_panic+0xa0>
+
+0000000000800c2a <putch>:
+    int count;  /* total bytes printed so far */
+    char buf[PRINTBUFSZ];
+};
+
+static void
+putch(int ch, struct printbuf *state) {
+  800c2a:	55                   	push   %rbp
+  800c2b:	48 89 e5             	mov    %rsp,%rbp
+  800c2e:	53                   	push   %rbx
+  800c2f:	48 83 ec 08          	sub    $0x8,%rsp
+  800c33:	48 89 f3             	mov    %rsi,%rbx
+    state->buf[state->offset++] = (char)ch;
+  800c36:	8b 06                	mov    (%rsi),%eax
+  800c38:	8d 50 01             	lea    0x1(%rax),%edx
+  800c3b:	89 16                	mov    %edx,(%rsi)
+  800c3d:	48 98                	cltq
+  800c3f:	40 88 7c 06 08       	mov    %dil,0x8(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ - 1) {
+  800c44:	81 fa ff 00 00 00    	cmp    $0xff,%edx
+  800c4a:	74 0a                	je     800c56 <putch+0x2c>
+        sys_cputs(state->buf, state->offset);
+        state->offset = 0;
+    }
+    state->count++;
+  800c4c:	83 43 04 01          	addl   $0x1,0x4(%rbx)
+}
+  800c50:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  800c54:	c9                   	leave
+  800c55:	c3                   	ret
+        sys_cputs(state->buf, state->offset);
+  800c56:	48 8d 7e 08          	lea    0x8(%rsi),%rdi
+  800c5a:	be ff 00 00 00       	mov    $0xff,%esi
+  800c5f:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  800c66:	00 00 00 
+  800c69:	ff d0                	call   *%rax
+        state->offset = 0;
+  800c6b:	c7 03 00 00 00 00    	movl   $0x0,(%rbx)
+  800c71:	eb d9                	jmp    800c4c <putch+0x22>
+
+0000000000800c73 <vcprintf>:
+
+int
+vcprintf(const char *fmt, va_list ap) {
+  800c73:	55                   	push   %rbp
+  800c74:	48 89 e5             	mov    %rsp,%rbp
+  800c77:	48 81 ec 10 01 00 00 	sub    $0x110,%rsp
+  800c7e:	48 89 fa             	mov    %rdi,%rdx
+    struct printbuf state = {0};
+  800c81:	48 8d bd f8 fe ff ff 	lea    -0x108(%rbp),%rdi
+  800c88:	b9 21 00 00 00       	mov    $0x21,%ecx
+  800c8d:	b8 00 00 00 00       	mov    $0x0,%eax
+  800c92:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+
+    vprintfmt((void *)putch, &state, fmt, ap);
+  800c95:	48 89 f1             	mov    %rsi,%rcx
+  800c98:	48 8d b5 f8 fe ff ff 	lea    -0x108(%rbp),%rsi
+  800c9f:	48 bf 2a 0c 80 00 00 	movabs $0x800c2a,%rdi
+  800ca6:	00 00 00 
+  800ca9:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  800cb0:	00 00 00 
+  800cb3:	ff d0                	call   *%rax
+    sys_cputs(state.buf, state.offset);
+  800cb5:	48 63 b5 f8 fe ff ff 	movslq -0x108(%rbp),%rsi
+  800cbc:	48 8d bd 00 ff ff ff 	lea    -0x100(%rbp),%rdi
+  800cc3:	48 b8 99 1e 80 00 00 	movabs $0x801e99,%rax
+  800cca:	00 00 00 
+  800ccd:	ff d0                	call   *%rax
+
+    return state.count;
+}
+  800ccf:	8b 85 fc fe ff ff    	mov    -0x104(%rbp),%eax
+  800cd5:	c9                   	leave
+  800cd6:	c3                   	ret
+
+0000000000800cd7 <cprintf>:
+
+int
+cprintf(const char *fmt, ...) {
+  800cd7:	55                   	push   %rbp
+  800cd8:	48 89 e5             	mov    %rsp,%rbp
+  800cdb:	48 83 ec 50          	sub    $0x50,%rsp
+  800cdf:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  800ce3:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  800ce7:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800ceb:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800cef:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    int count;
+
+    va_start(ap, fmt);
+  800cf3:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  800cfa:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800cfe:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800d02:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800d06:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    count = vcprintf(fmt, ap);
+  800d0a:	48 8d 75 b8          	lea    -0x48(%rbp),%rsi
+  800d0e:	48 b8 73 0c 80 00 00 	movabs $0x800c73,%rax
+  800d15:	00 00 00 
+  800d18:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return count;
+}
+  800d1a:	c9                   	leave
+  800d1b:	c3                   	ret
+
+0000000000800d1c <print_num>:
+ * Print a number (base <= 16) in reverse order,
+ * using specified putch function and associated pointer putdat.
+ */
+static void
+print_num(void (*putch)(int, void *), void *put_arg,
+          uintmax_t num, unsigned base, int width, char padc, bool capital) {
+  800d1c:	55                   	push   %rbp
+  800d1d:	48 89 e5             	mov    %rsp,%rbp
+  800d20:	41 57                	push   %r15
+  800d22:	41 56                	push   %r14
+  800d24:	41 55                	push   %r13
+  800d26:	41 54                	push   %r12
+  800d28:	53                   	push   %rbx
+  800d29:	48 83 ec 18          	sub    $0x18,%rsp
+  800d2d:	49 89 fc             	mov    %rdi,%r12
+  800d30:	49 89 f5             	mov    %rsi,%r13
+  800d33:	48 89 55 c8          	mov    %rdx,-0x38(%rbp)
+  800d37:	8b 45 10             	mov    0x10(%rbp),%eax
+  800d3a:	89 45 c4             	mov    %eax,-0x3c(%rbp)
+    /* First recursively print all preceding (more significant) digits */
+    if (num >= base) {
+  800d3d:	41 89 cf             	mov    %ecx,%r15d
+  800d40:	4c 39 fa             	cmp    %r15,%rdx
+  800d43:	73 5b                	jae    800da0 <print_num+0x84>
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+    } else {
+        /* Print any needed pad characters before first digit */
+        while (--width > 0) {
+  800d45:	41 8d 58 ff          	lea    -0x1(%r8),%ebx
+            putch(padc, put_arg);
+  800d49:	45 0f be f1          	movsbl %r9b,%r14d
+        while (--width > 0) {
+  800d4d:	85 db                	test   %ebx,%ebx
+  800d4f:	7e 0e                	jle    800d5f <print_num+0x43>
+            putch(padc, put_arg);
+  800d51:	4c 89 ee             	mov    %r13,%rsi
+  800d54:	44 89 f7             	mov    %r14d,%edi
+  800d57:	41 ff d4             	call   *%r12
+        while (--width > 0) {
+  800d5a:	83 eb 01             	sub    $0x1,%ebx
+  800d5d:	75 f2                	jne    800d51 <print_num+0x35>
+        }
+    }
+
+    const char *dig = capital ? "0123456789ABCDEF" : "0123456789abcdef";
+  800d5f:	80 7d c4 00          	cmpb   $0x0,-0x3c(%rbp)
+  800d63:	48 b9 64 65 80 00 00 	movabs $0x806564,%rcx
+  800d6a:	00 00 00 
+  800d6d:	48 b8 53 65 80 00 00 	movabs $0x806553,%rax
+  800d74:	00 00 00 
+  800d77:	48 0f 45 c8          	cmovne %rax,%rcx
+
+    /* Then print this (the least significant) digit */
+    putch(dig[num % base], put_arg);
+  800d7b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800d7f:	ba 00 00 00 00       	mov    $0x0,%edx
+  800d84:	49 f7 f7             	div    %r15
+  800d87:	0f be 3c 11          	movsbl (%rcx,%rdx,1),%edi
+  800d8b:	4c 89 ee             	mov    %r13,%rsi
+  800d8e:	41 ff d4             	call   *%r12
+}
+  800d91:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  800d95:	5b                   	pop    %rbx
+  800d96:	41 5c                	pop    %r12
+  800d98:	41 5d                	pop    %r13
+  800d9a:	41 5e                	pop    %r14
+  800d9c:	41 5f                	pop    %r15
+  800d9e:	5d                   	pop    %rbp
+  800d9f:	c3                   	ret
+        print_num(putch, put_arg, num / base, base, width - 1, padc, capital);
+  800da0:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  800da4:	ba 00 00 00 00       	mov    $0x0,%edx
+  800da9:	49 f7 f7             	div    %r15
+  800dac:	48 83 ec 08          	sub    $0x8,%rsp
+  800db0:	0f b6 55 c4          	movzbl -0x3c(%rbp),%edx
+  800db4:	52                   	push   %rdx
+  800db5:	45 0f be c9          	movsbl %r9b,%r9d
+  800db9:	45 8d 40 ff          	lea    -0x1(%r8),%r8d
+  800dbd:	48 89 c2             	mov    %rax,%rdx
+  800dc0:	48 b8 1c 0d 80 00 00 	movabs $0x800d1c,%rax
+  800dc7:	00 00 00 
+  800dca:	ff d0                	call   *%rax
+  800dcc:	48 83 c4 10          	add    $0x10,%rsp
+  800dd0:	eb 8d                	jmp    800d5f <print_num+0x43>
+
+0000000000800dd2 <sprintputch>:
+    int count;
+};
+
+static void
+sprintputch(int ch, struct sprintbuf *state) {
+    state->count++;
+  800dd2:	83 46 10 01          	addl   $0x1,0x10(%rsi)
+    if (state->start < state->end) {
+  800dd6:	48 8b 06             	mov    (%rsi),%rax
+  800dd9:	48 3b 46 08          	cmp    0x8(%rsi),%rax
+  800ddd:	73 0a                	jae    800de9 <sprintputch+0x17>
+        *state->start++ = ch;
+  800ddf:	48 8d 50 01          	lea    0x1(%rax),%rdx
+  800de3:	48 89 16             	mov    %rdx,(%rsi)
+  800de6:	40 88 38             	mov    %dil,(%rax)
+    }
+}
+  800de9:	c3                   	ret
+
+0000000000800dea <printfmt>:
+printfmt(void (*putch)(int, void *), void *putdat, const char *fmt, ...) {
+  800dea:	55                   	push   %rbp
+  800deb:	48 89 e5             	mov    %rsp,%rbp
+  800dee:	48 83 ec 50          	sub    $0x50,%rsp
+  800df2:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  800df6:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  800dfa:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(ap, fmt);
+  800dfe:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  800e05:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  800e09:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e0d:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  800e11:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    vprintfmt(putch, putdat, fmt, ap);
+  800e15:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  800e19:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  800e20:	00 00 00 
+  800e23:	ff d0                	call   *%rax
+}
+  800e25:	c9                   	leave
+  800e26:	c3                   	ret
+
+0000000000800e27 <vprintfmt>:
+vprintfmt(void (*putch)(int, void *), void *put_arg, const char *fmt, va_list ap) {
+  800e27:	55                   	push   %rbp
+  800e28:	48 89 e5             	mov    %rsp,%rbp
+  800e2b:	41 57                	push   %r15
+  800e2d:	41 56                	push   %r14
+  800e2f:	41 55                	push   %r13
+  800e31:	41 54                	push   %r12
+  800e33:	53                   	push   %rbx
+  800e34:	48 83 ec 38          	sub    $0x38,%rsp
+  800e38:	49 89 fe             	mov    %rdi,%r14
+  800e3b:	49 89 f5             	mov    %rsi,%r13
+  800e3e:	48 89 d3             	mov    %rdx,%rbx
+    va_copy(aq, ap);
+  800e41:	48 8b 01             	mov    (%rcx),%rax
+  800e44:	48 89 45 b8          	mov    %rax,-0x48(%rbp)
+  800e48:	48 8b 41 08          	mov    0x8(%rcx),%rax
+  800e4c:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800e50:	48 8b 41 10          	mov    0x10(%rcx),%rax
+  800e54:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while ((ch = *ufmt++) != '%') {
+  800e58:	4c 8d 63 01          	lea    0x1(%rbx),%r12
+  800e5c:	0f b6 3b             	movzbl (%rbx),%edi
+  800e5f:	40 80 ff 25          	cmp    $0x25,%dil
+  800e63:	74 18                	je     800e7d <vprintfmt+0x56>
+            if (!ch) return;
+  800e65:	40 84 ff             	test   %dil,%dil
+  800e68:	0f 84 b1 06 00 00    	je     80151f <vprintfmt+0x6f8>
+            putch(ch, put_arg);
+  800e6e:	40 0f b6 ff          	movzbl %dil,%edi
+  800e72:	4c 89 ee             	mov    %r13,%rsi
+  800e75:	41 ff d6             	call   *%r14
+        while ((ch = *ufmt++) != '%') {
+  800e78:	4c 89 e3             	mov    %r12,%rbx
+  800e7b:	eb db                	jmp    800e58 <vprintfmt+0x31>
+        bool altflag = 0, zflag = 0;
+  800e7d:	be 00 00 00 00       	mov    $0x0,%esi
+  800e82:	c6 45 ab 00          	movb   $0x0,-0x55(%rbp)
+        unsigned lflag = 0, base = 10;
+  800e86:	ba 00 00 00 00       	mov    $0x0,%edx
+        int width = -1, precision = -1;
+  800e8b:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800e91:	c7 45 ac ff ff ff ff 	movl   $0xffffffff,-0x54(%rbp)
+        char padc = ' ';
+  800e98:	c6 45 aa 20          	movb   $0x20,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800e9c:	49 8d 5c 24 01       	lea    0x1(%r12),%rbx
+  800ea1:	41 0f b6 04 24       	movzbl (%r12),%eax
+  800ea6:	88 45 a0             	mov    %al,-0x60(%rbp)
+  800ea9:	83 e8 23             	sub    $0x23,%eax
+  800eac:	3c 57                	cmp    $0x57,%al
+  800eae:	0f 87 51 06 00 00    	ja     801505 <vprintfmt+0x6de>
+  800eb4:	0f b6 c0             	movzbl %al,%eax
+  800eb7:	48 b9 20 67 80 00 00 	movabs $0x806720,%rcx
+  800ebe:	00 00 00 
+  800ec1:	ff 24 c1             	jmp    *(%rcx,%rax,8)
+  800ec4:	49 89 dc             	mov    %rbx,%r12
+            altflag = 1;
+  800ec7:	c6 45 ab 01          	movb   $0x1,-0x55(%rbp)
+  800ecb:	eb cf                	jmp    800e9c <vprintfmt+0x75>
+        switch (ch = *ufmt++) {
+  800ecd:	49 89 dc             	mov    %rbx,%r12
+  800ed0:	be 01 00 00 00       	mov    $0x1,%esi
+  800ed5:	eb c5                	jmp    800e9c <vprintfmt+0x75>
+            padc = ch;
+  800ed7:	0f b6 45 a0          	movzbl -0x60(%rbp),%eax
+  800edb:	88 45 aa             	mov    %al,-0x56(%rbp)
+        switch (ch = *ufmt++) {
+  800ede:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800ee1:	eb b9                	jmp    800e9c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800ee3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800ee6:	83 f8 2f             	cmp    $0x2f,%eax
+  800ee9:	77 24                	ja     800f0f <vprintfmt+0xe8>
+  800eeb:	89 c1                	mov    %eax,%ecx
+  800eed:	48 03 4d c8          	add    -0x38(%rbp),%rcx
+  800ef1:	83 c0 08             	add    $0x8,%eax
+  800ef4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800ef7:	44 8b 39             	mov    (%rcx),%r15d
+        switch (ch = *ufmt++) {
+  800efa:	49 89 dc             	mov    %rbx,%r12
+            if (width < 0) {
+  800efd:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  800f01:	79 99                	jns    800e9c <vprintfmt+0x75>
+                width = precision;
+  800f03:	44 89 7d ac          	mov    %r15d,-0x54(%rbp)
+                precision = -1;
+  800f07:	41 bf ff ff ff ff    	mov    $0xffffffff,%r15d
+  800f0d:	eb 8d                	jmp    800e9c <vprintfmt+0x75>
+            precision = va_arg(aq, int);
+  800f0f:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  800f13:	48 8d 41 08          	lea    0x8(%rcx),%rax
+  800f17:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800f1b:	eb da                	jmp    800ef7 <vprintfmt+0xd0>
+        switch (ch = *ufmt++) {
+  800f1d:	44 0f b6 7d a0       	movzbl -0x60(%rbp),%r15d
+                precision = precision * 10 + ch - '0';
+  800f22:	41 83 ef 30          	sub    $0x30,%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f26:	41 0f b6 44 24 01    	movzbl 0x1(%r12),%eax
+  800f2c:	3c 39                	cmp    $0x39,%al
+  800f2e:	77 1c                	ja     800f4c <vprintfmt+0x125>
+            for (precision = 0;; ++ufmt) {
+  800f30:	48 83 c3 01          	add    $0x1,%rbx
+                precision = precision * 10 + ch - '0';
+  800f34:	43 8d 0c bf          	lea    (%r15,%r15,4),%ecx
+  800f38:	0f b6 c0             	movzbl %al,%eax
+  800f3b:	44 8d 7c 48 d0       	lea    -0x30(%rax,%rcx,2),%r15d
+                if ((ch = *ufmt) - '0' > 9) break;
+  800f40:	0f b6 03             	movzbl (%rbx),%eax
+  800f43:	3c 39                	cmp    $0x39,%al
+  800f45:	76 e9                	jbe    800f30 <vprintfmt+0x109>
+            for (precision = 0;; ++ufmt) {
+  800f47:	49 89 dc             	mov    %rbx,%r12
+        process_precision:
+  800f4a:	eb b1                	jmp    800efd <vprintfmt+0xd6>
+        switch (ch = *ufmt++) {
+  800f4c:	49 89 dc             	mov    %rbx,%r12
+  800f4f:	eb ac                	jmp    800efd <vprintfmt+0xd6>
+            width = MAX(0, width);
+  800f51:	8b 4d ac             	mov    -0x54(%rbp),%ecx
+  800f54:	85 c9                	test   %ecx,%ecx
+  800f56:	b8 00 00 00 00       	mov    $0x0,%eax
+  800f5b:	0f 49 c1             	cmovns %ecx,%eax
+  800f5e:	89 45 ac             	mov    %eax,-0x54(%rbp)
+        switch (ch = *ufmt++) {
+  800f61:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f64:	e9 33 ff ff ff       	jmp    800e9c <vprintfmt+0x75>
+            lflag++;
+  800f69:	83 c2 01             	add    $0x1,%edx
+        switch (ch = *ufmt++) {
+  800f6c:	49 89 dc             	mov    %rbx,%r12
+            goto reswitch;
+  800f6f:	e9 28 ff ff ff       	jmp    800e9c <vprintfmt+0x75>
+            putch(va_arg(aq, int), put_arg);
+  800f74:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800f77:	83 f8 2f             	cmp    $0x2f,%eax
+  800f7a:	77 19                	ja     800f95 <vprintfmt+0x16e>
+  800f7c:	89 c2                	mov    %eax,%edx
+  800f7e:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800f82:	83 c0 08             	add    $0x8,%eax
+  800f85:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  800f88:	8b 3a                	mov    (%rdx),%edi
+  800f8a:	4c 89 ee             	mov    %r13,%rsi
+  800f8d:	41 ff d6             	call   *%r14
+            break;
+  800f90:	e9 c3 fe ff ff       	jmp    800e58 <vprintfmt+0x31>
+            putch(va_arg(aq, int), put_arg);
+  800f95:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  800f99:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  800f9d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  800fa1:	eb e5                	jmp    800f88 <vprintfmt+0x161>
+            int err = va_arg(aq, int);
+  800fa3:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  800fa6:	83 f8 2f             	cmp    $0x2f,%eax
+  800fa9:	77 5a                	ja     801005 <vprintfmt+0x1de>
+  800fab:	89 c2                	mov    %eax,%edx
+  800fad:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  800fb1:	83 c0 08             	add    $0x8,%eax
+  800fb4:	89 45 b8             	mov    %eax,-0x48(%rbp)
+            if (err < 0) err = -err;
+  800fb7:	8b 02                	mov    (%rdx),%eax
+  800fb9:	89 c1                	mov    %eax,%ecx
+  800fbb:	f7 d9                	neg    %ecx
+  800fbd:	0f 48 c8             	cmovs  %eax,%ecx
+            if (err >= MAXERROR || !(strerr = error_string[err])) {
+  800fc0:	83 f9 16             	cmp    $0x16,%ecx
+  800fc3:	7f 4e                	jg     801013 <vprintfmt+0x1ec>
+  800fc5:	48 63 c1             	movslq %ecx,%rax
+  800fc8:	48 ba e0 69 80 00 00 	movabs $0x8069e0,%rdx
+  800fcf:	00 00 00 
+  800fd2:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  800fd6:	48 85 c0             	test   %rax,%rax
+  800fd9:	74 38                	je     801013 <vprintfmt+0x1ec>
+                printfmt(putch, put_arg, "%s", strerr);
+  800fdb:	48 89 c1             	mov    %rax,%rcx
+  800fde:	48 ba 9a 64 80 00 00 	movabs $0x80649a,%rdx
+  800fe5:	00 00 00 
+  800fe8:	4c 89 ee             	mov    %r13,%rsi
+  800feb:	4c 89 f7             	mov    %r14,%rdi
+  800fee:	b8 00 00 00 00       	mov    $0x0,%eax
+  800ff3:	49 b8 ea 0d 80 00 00 	movabs $0x800dea,%r8
+  800ffa:	00 00 00 
+  800ffd:	41 ff d0             	call   *%r8
+  801000:	e9 53 fe ff ff       	jmp    800e58 <vprintfmt+0x31>
+            int err = va_arg(aq, int);
+  801005:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801009:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80100d:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801011:	eb a4                	jmp    800fb7 <vprintfmt+0x190>
+                printfmt(putch, put_arg, "error %d", err);
+  801013:	48 ba 7c 65 80 00 00 	movabs $0x80657c,%rdx
+  80101a:	00 00 00 
+  80101d:	4c 89 ee             	mov    %r13,%rsi
+  801020:	4c 89 f7             	mov    %r14,%rdi
+  801023:	b8 00 00 00 00       	mov    $0x0,%eax
+  801028:	49 b8 ea 0d 80 00 00 	movabs $0x800dea,%r8
+  80102f:	00 00 00 
+  801032:	41 ff d0             	call   *%r8
+  801035:	e9 1e fe ff ff       	jmp    800e58 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  80103a:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80103d:	83 f8 2f             	cmp    $0x2f,%eax
+  801040:	77 6c                	ja     8010ae <vprintfmt+0x287>
+  801042:	89 c2                	mov    %eax,%edx
+  801044:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801048:	83 c0 08             	add    $0x8,%eax
+  80104b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80104e:	48 8b 12             	mov    (%rdx),%rdx
+            if (!ptr) ptr = "(null)";
+  801051:	48 85 d2             	test   %rdx,%rdx
+  801054:	48 b8 75 65 80 00 00 	movabs $0x806575,%rax
+  80105b:	00 00 00 
+  80105e:	48 0f 45 c2          	cmovne %rdx,%rax
+  801062:	48 89 45 a0          	mov    %rax,-0x60(%rbp)
+            if (width > 0 && padc != '-') {
+  801066:	83 7d ac 00          	cmpl   $0x0,-0x54(%rbp)
+  80106a:	7e 06                	jle    801072 <vprintfmt+0x24b>
+  80106c:	80 7d aa 2d          	cmpb   $0x2d,-0x56(%rbp)
+  801070:	75 4a                	jne    8010bc <vprintfmt+0x295>
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801072:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  801076:	4c 8d 60 01          	lea    0x1(%rax),%r12
+  80107a:	0f b6 00             	movzbl (%rax),%eax
+  80107d:	84 c0                	test   %al,%al
+  80107f:	0f 85 9a 00 00 00    	jne    80111f <vprintfmt+0x2f8>
+            while (width-- > 0) putch(' ', put_arg);
+  801085:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  801088:	44 8d 60 ff          	lea    -0x1(%rax),%r12d
+  80108c:	85 c0                	test   %eax,%eax
+  80108e:	0f 8e c4 fd ff ff    	jle    800e58 <vprintfmt+0x31>
+  801094:	4c 89 ee             	mov    %r13,%rsi
+  801097:	bf 20 00 00 00       	mov    $0x20,%edi
+  80109c:	41 ff d6             	call   *%r14
+  80109f:	41 83 ec 01          	sub    $0x1,%r12d
+  8010a3:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  8010a7:	75 eb                	jne    801094 <vprintfmt+0x26d>
+  8010a9:	e9 aa fd ff ff       	jmp    800e58 <vprintfmt+0x31>
+            const char *ptr = va_arg(aq, char *);
+  8010ae:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8010b2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8010b6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8010ba:	eb 92                	jmp    80104e <vprintfmt+0x227>
+                width -= strnlen(ptr, precision);
+  8010bc:	49 63 f7             	movslq %r15d,%rsi
+  8010bf:	48 8b 7d a0          	mov    -0x60(%rbp),%rdi
+  8010c3:	48 b8 d9 15 80 00 00 	movabs $0x8015d9,%rax
+  8010ca:	00 00 00 
+  8010cd:	ff d0                	call   *%rax
+  8010cf:	48 89 c2             	mov    %rax,%rdx
+  8010d2:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010d5:	29 d0                	sub    %edx,%eax
+                while (width-- > 0) putch(padc, put_arg);
+  8010d7:	8d 70 ff             	lea    -0x1(%rax),%esi
+  8010da:	89 75 ac             	mov    %esi,-0x54(%rbp)
+  8010dd:	85 c0                	test   %eax,%eax
+  8010df:	7e 91                	jle    801072 <vprintfmt+0x24b>
+  8010e1:	44 0f be 65 aa       	movsbl -0x56(%rbp),%r12d
+  8010e6:	4c 89 ee             	mov    %r13,%rsi
+  8010e9:	44 89 e7             	mov    %r12d,%edi
+  8010ec:	41 ff d6             	call   *%r14
+  8010ef:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  8010f3:	8b 45 ac             	mov    -0x54(%rbp),%eax
+  8010f6:	83 f8 ff             	cmp    $0xffffffff,%eax
+  8010f9:	75 eb                	jne    8010e6 <vprintfmt+0x2bf>
+  8010fb:	e9 72 ff ff ff       	jmp    801072 <vprintfmt+0x24b>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  801100:	0f b6 f8             	movzbl %al,%edi
+  801103:	4c 89 ee             	mov    %r13,%rsi
+  801106:	41 ff d6             	call   *%r14
+            for (; (ch = *ptr++) && (precision < 0 || --precision >= 0); width--) {
+  801109:	83 6d ac 01          	subl   $0x1,-0x54(%rbp)
+  80110d:	49 83 c4 01          	add    $0x1,%r12
+  801111:	41 0f b6 44 24 ff    	movzbl -0x1(%r12),%eax
+  801117:	84 c0                	test   %al,%al
+  801119:	0f 84 66 ff ff ff    	je     801085 <vprintfmt+0x25e>
+  80111f:	45 85 ff             	test   %r15d,%r15d
+  801122:	78 0a                	js     80112e <vprintfmt+0x307>
+  801124:	41 83 ef 01          	sub    $0x1,%r15d
+  801128:	0f 88 57 ff ff ff    	js     801085 <vprintfmt+0x25e>
+                putch(altflag && (ch < ' ' || ch > '~') ? '?' : ch, put_arg);
+  80112e:	80 7d ab 00          	cmpb   $0x0,-0x55(%rbp)
+  801132:	74 cc                	je     801100 <vprintfmt+0x2d9>
+  801134:	8d 50 e0             	lea    -0x20(%rax),%edx
+  801137:	bf 3f 00 00 00       	mov    $0x3f,%edi
+  80113c:	80 fa 5e             	cmp    $0x5e,%dl
+  80113f:	77 c2                	ja     801103 <vprintfmt+0x2dc>
+  801141:	eb bd                	jmp    801100 <vprintfmt+0x2d9>
+    if (zflag) return va_arg(*ap, size_t);
+  801143:	40 84 f6             	test   %sil,%sil
+  801146:	75 26                	jne    80116e <vprintfmt+0x347>
+    switch (lflag) {
+  801148:	85 d2                	test   %edx,%edx
+  80114a:	74 59                	je     8011a5 <vprintfmt+0x37e>
+  80114c:	83 fa 01             	cmp    $0x1,%edx
+  80114f:	74 7b                	je     8011cc <vprintfmt+0x3a5>
+        return va_arg(*ap, long long);
+  801151:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801154:	83 f8 2f             	cmp    $0x2f,%eax
+  801157:	0f 87 96 00 00 00    	ja     8011f3 <vprintfmt+0x3cc>
+  80115d:	89 c2                	mov    %eax,%edx
+  80115f:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801163:	83 c0 08             	add    $0x8,%eax
+  801166:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801169:	4c 8b 22             	mov    (%rdx),%r12
+  80116c:	eb 17                	jmp    801185 <vprintfmt+0x35e>
+    if (zflag) return va_arg(*ap, size_t);
+  80116e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801171:	83 f8 2f             	cmp    $0x2f,%eax
+  801174:	77 21                	ja     801197 <vprintfmt+0x370>
+  801176:	89 c2                	mov    %eax,%edx
+  801178:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80117c:	83 c0 08             	add    $0x8,%eax
+  80117f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801182:	4c 8b 22             	mov    (%rdx),%r12
+            if (i < 0) {
+  801185:	4d 85 e4             	test   %r12,%r12
+  801188:	78 7a                	js     801204 <vprintfmt+0x3dd>
+            num = i;
+  80118a:	4c 89 e2             	mov    %r12,%rdx
+        unsigned lflag = 0, base = 10;
+  80118d:	b9 0a 00 00 00       	mov    $0xa,%ecx
+            goto number;
+  801192:	e9 50 02 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801197:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80119b:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80119f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011a3:	eb dd                	jmp    801182 <vprintfmt+0x35b>
+        return va_arg(*ap, int);
+  8011a5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011a8:	83 f8 2f             	cmp    $0x2f,%eax
+  8011ab:	77 11                	ja     8011be <vprintfmt+0x397>
+  8011ad:	89 c2                	mov    %eax,%edx
+  8011af:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011b3:	83 c0 08             	add    $0x8,%eax
+  8011b6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011b9:	4c 63 22             	movslq (%rdx),%r12
+  8011bc:	eb c7                	jmp    801185 <vprintfmt+0x35e>
+  8011be:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011c2:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011c6:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ca:	eb ed                	jmp    8011b9 <vprintfmt+0x392>
+        return va_arg(*ap, long);
+  8011cc:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8011cf:	83 f8 2f             	cmp    $0x2f,%eax
+  8011d2:	77 11                	ja     8011e5 <vprintfmt+0x3be>
+  8011d4:	89 c2                	mov    %eax,%edx
+  8011d6:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8011da:	83 c0 08             	add    $0x8,%eax
+  8011dd:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8011e0:	4c 8b 22             	mov    (%rdx),%r12
+  8011e3:	eb a0                	jmp    801185 <vprintfmt+0x35e>
+  8011e5:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011e9:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011ed:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011f1:	eb ed                	jmp    8011e0 <vprintfmt+0x3b9>
+        return va_arg(*ap, long long);
+  8011f3:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8011f7:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8011fb:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8011ff:	e9 65 ff ff ff       	jmp    801169 <vprintfmt+0x342>
+                putch('-', put_arg);
+  801204:	4c 89 ee             	mov    %r13,%rsi
+  801207:	bf 2d 00 00 00       	mov    $0x2d,%edi
+  80120c:	41 ff d6             	call   *%r14
+                i = -i;
+  80120f:	49 f7 dc             	neg    %r12
+  801212:	e9 73 ff ff ff       	jmp    80118a <vprintfmt+0x363>
+    if (zflag) return va_arg(*ap, size_t);
+  801217:	40 84 f6             	test   %sil,%sil
+  80121a:	75 32                	jne    80124e <vprintfmt+0x427>
+    switch (lflag) {
+  80121c:	85 d2                	test   %edx,%edx
+  80121e:	74 5d                	je     80127d <vprintfmt+0x456>
+  801220:	83 fa 01             	cmp    $0x1,%edx
+  801223:	0f 84 82 00 00 00    	je     8012ab <vprintfmt+0x484>
+        return va_arg(*ap, unsigned long long);
+  801229:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80122c:	83 f8 2f             	cmp    $0x2f,%eax
+  80122f:	0f 87 a5 00 00 00    	ja     8012da <vprintfmt+0x4b3>
+  801235:	89 c2                	mov    %eax,%edx
+  801237:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80123b:	83 c0 08             	add    $0x8,%eax
+  80123e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801241:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801244:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long long);
+  801249:	e9 99 01 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80124e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801251:	83 f8 2f             	cmp    $0x2f,%eax
+  801254:	77 19                	ja     80126f <vprintfmt+0x448>
+  801256:	89 c2                	mov    %eax,%edx
+  801258:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80125c:	83 c0 08             	add    $0x8,%eax
+  80125f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801262:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  801265:	b9 0a 00 00 00       	mov    $0xa,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80126a:	e9 78 01 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+  80126f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801273:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801277:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80127b:	eb e5                	jmp    801262 <vprintfmt+0x43b>
+        return va_arg(*ap, unsigned int);
+  80127d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801280:	83 f8 2f             	cmp    $0x2f,%eax
+  801283:	77 18                	ja     80129d <vprintfmt+0x476>
+  801285:	89 c2                	mov    %eax,%edx
+  801287:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80128b:	83 c0 08             	add    $0x8,%eax
+  80128e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801291:	8b 12                	mov    (%rdx),%edx
+        unsigned lflag = 0, base = 10;
+  801293:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned int);
+  801298:	e9 4a 01 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+  80129d:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012a1:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012a5:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012a9:	eb e6                	jmp    801291 <vprintfmt+0x46a>
+        return va_arg(*ap, unsigned long);
+  8012ab:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012ae:	83 f8 2f             	cmp    $0x2f,%eax
+  8012b1:	77 19                	ja     8012cc <vprintfmt+0x4a5>
+  8012b3:	89 c2                	mov    %eax,%edx
+  8012b5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8012b9:	83 c0 08             	add    $0x8,%eax
+  8012bc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8012bf:	48 8b 12             	mov    (%rdx),%rdx
+        unsigned lflag = 0, base = 10;
+  8012c2:	b9 0a 00 00 00       	mov    $0xa,%ecx
+        return va_arg(*ap, unsigned long);
+  8012c7:	e9 1b 01 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+  8012cc:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012d0:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012d4:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012d8:	eb e5                	jmp    8012bf <vprintfmt+0x498>
+        return va_arg(*ap, unsigned long long);
+  8012da:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8012de:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8012e2:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8012e6:	e9 56 ff ff ff       	jmp    801241 <vprintfmt+0x41a>
+    if (zflag) return va_arg(*ap, size_t);
+  8012eb:	40 84 f6             	test   %sil,%sil
+  8012ee:	75 2e                	jne    80131e <vprintfmt+0x4f7>
+    switch (lflag) {
+  8012f0:	85 d2                	test   %edx,%edx
+  8012f2:	74 59                	je     80134d <vprintfmt+0x526>
+  8012f4:	83 fa 01             	cmp    $0x1,%edx
+  8012f7:	74 7f                	je     801378 <vprintfmt+0x551>
+        return va_arg(*ap, unsigned long long);
+  8012f9:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8012fc:	83 f8 2f             	cmp    $0x2f,%eax
+  8012ff:	0f 87 9f 00 00 00    	ja     8013a4 <vprintfmt+0x57d>
+  801305:	89 c2                	mov    %eax,%edx
+  801307:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80130b:	83 c0 08             	add    $0x8,%eax
+  80130e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801311:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801314:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long long);
+  801319:	e9 c9 00 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  80131e:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801321:	83 f8 2f             	cmp    $0x2f,%eax
+  801324:	77 19                	ja     80133f <vprintfmt+0x518>
+  801326:	89 c2                	mov    %eax,%edx
+  801328:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80132c:	83 c0 08             	add    $0x8,%eax
+  80132f:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801332:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  801335:	b9 08 00 00 00       	mov    $0x8,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  80133a:	e9 a8 00 00 00       	jmp    8013e7 <vprintfmt+0x5c0>
+  80133f:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  801343:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801347:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80134b:	eb e5                	jmp    801332 <vprintfmt+0x50b>
+        return va_arg(*ap, unsigned int);
+  80134d:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801350:	83 f8 2f             	cmp    $0x2f,%eax
+  801353:	77 15                	ja     80136a <vprintfmt+0x543>
+  801355:	89 c2                	mov    %eax,%edx
+  801357:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  80135b:	83 c0 08             	add    $0x8,%eax
+  80135e:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  801361:	8b 12                	mov    (%rdx),%edx
+            base = 8;
+  801363:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned int);
+  801368:	eb 7d                	jmp    8013e7 <vprintfmt+0x5c0>
+  80136a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80136e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801372:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801376:	eb e9                	jmp    801361 <vprintfmt+0x53a>
+        return va_arg(*ap, unsigned long);
+  801378:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80137b:	83 f8 2f             	cmp    $0x2f,%eax
+  80137e:	77 16                	ja     801396 <vprintfmt+0x56f>
+  801380:	89 c2                	mov    %eax,%edx
+  801382:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801386:	83 c0 08             	add    $0x8,%eax
+  801389:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80138c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 8;
+  80138f:	b9 08 00 00 00       	mov    $0x8,%ecx
+        return va_arg(*ap, unsigned long);
+  801394:	eb 51                	jmp    8013e7 <vprintfmt+0x5c0>
+  801396:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80139a:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80139e:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013a2:	eb e8                	jmp    80138c <vprintfmt+0x565>
+        return va_arg(*ap, unsigned long long);
+  8013a4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8013a8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8013ac:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8013b0:	e9 5c ff ff ff       	jmp    801311 <vprintfmt+0x4ea>
+            putch('0', put_arg);
+  8013b5:	4c 89 ee             	mov    %r13,%rsi
+  8013b8:	bf 30 00 00 00       	mov    $0x30,%edi
+  8013bd:	41 ff d6             	call   *%r14
+            putch('x', put_arg);
+  8013c0:	4c 89 ee             	mov    %r13,%rsi
+  8013c3:	bf 78 00 00 00       	mov    $0x78,%edi
+  8013c8:	41 ff d6             	call   *%r14
+            num = (uintptr_t)va_arg(aq, void *);
+  8013cb:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8013ce:	83 f8 2f             	cmp    $0x2f,%eax
+  8013d1:	77 47                	ja     80141a <vprintfmt+0x5f3>
+  8013d3:	89 c2                	mov    %eax,%edx
+  8013d5:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8013d9:	83 c0 08             	add    $0x8,%eax
+  8013dc:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8013df:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8013e2:	b9 10 00 00 00       	mov    $0x10,%ecx
+            print_num(putch, put_arg, num, base, width, padc, ch == 'X');
+  8013e7:	48 83 ec 08          	sub    $0x8,%rsp
+  8013eb:	80 7d a0 58          	cmpb   $0x58,-0x60(%rbp)
+  8013ef:	0f 94 c0             	sete   %al
+  8013f2:	0f b6 c0             	movzbl %al,%eax
+  8013f5:	50                   	push   %rax
+  8013f6:	44 0f be 4d aa       	movsbl -0x56(%rbp),%r9d
+  8013fb:	44 8b 45 ac          	mov    -0x54(%rbp),%r8d
+  8013ff:	4c 89 ee             	mov    %r13,%rsi
+  801402:	4c 89 f7             	mov    %r14,%rdi
+  801405:	48 b8 1c 0d 80 00 00 	movabs $0x800d1c,%rax
+  80140c:	00 00 00 
+  80140f:	ff d0                	call   *%rax
+            break;
+  801411:	48 83 c4 10          	add    $0x10,%rsp
+  801415:	e9 3e fa ff ff       	jmp    800e58 <vprintfmt+0x31>
+            num = (uintptr_t)va_arg(aq, void *);
+  80141a:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80141e:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801422:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801426:	eb b7                	jmp    8013df <vprintfmt+0x5b8>
+    if (zflag) return va_arg(*ap, size_t);
+  801428:	40 84 f6             	test   %sil,%sil
+  80142b:	75 2b                	jne    801458 <vprintfmt+0x631>
+    switch (lflag) {
+  80142d:	85 d2                	test   %edx,%edx
+  80142f:	74 56                	je     801487 <vprintfmt+0x660>
+  801431:	83 fa 01             	cmp    $0x1,%edx
+  801434:	74 7f                	je     8014b5 <vprintfmt+0x68e>
+        return va_arg(*ap, unsigned long long);
+  801436:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  801439:	83 f8 2f             	cmp    $0x2f,%eax
+  80143c:	0f 87 a2 00 00 00    	ja     8014e4 <vprintfmt+0x6bd>
+  801442:	89 c2                	mov    %eax,%edx
+  801444:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801448:	83 c0 08             	add    $0x8,%eax
+  80144b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80144e:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  801451:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long long);
+  801456:	eb 8f                	jmp    8013e7 <vprintfmt+0x5c0>
+    if (zflag) return va_arg(*ap, size_t);
+  801458:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80145b:	83 f8 2f             	cmp    $0x2f,%eax
+  80145e:	77 19                	ja     801479 <vprintfmt+0x652>
+  801460:	89 c2                	mov    %eax,%edx
+  801462:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801466:	83 c0 08             	add    $0x8,%eax
+  801469:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80146c:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  80146f:	b9 10 00 00 00       	mov    $0x10,%ecx
+    if (zflag) return va_arg(*ap, size_t);
+  801474:	e9 6e ff ff ff       	jmp    8013e7 <vprintfmt+0x5c0>
+  801479:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  80147d:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  801481:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  801485:	eb e5                	jmp    80146c <vprintfmt+0x645>
+        return va_arg(*ap, unsigned int);
+  801487:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80148a:	83 f8 2f             	cmp    $0x2f,%eax
+  80148d:	77 18                	ja     8014a7 <vprintfmt+0x680>
+  80148f:	89 c2                	mov    %eax,%edx
+  801491:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  801495:	83 c0 08             	add    $0x8,%eax
+  801498:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80149b:	8b 12                	mov    (%rdx),%edx
+            base = 16;
+  80149d:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned int);
+  8014a2:	e9 40 ff ff ff       	jmp    8013e7 <vprintfmt+0x5c0>
+  8014a7:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014ab:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014af:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014b3:	eb e6                	jmp    80149b <vprintfmt+0x674>
+        return va_arg(*ap, unsigned long);
+  8014b5:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  8014b8:	83 f8 2f             	cmp    $0x2f,%eax
+  8014bb:	77 19                	ja     8014d6 <vprintfmt+0x6af>
+  8014bd:	89 c2                	mov    %eax,%edx
+  8014bf:	48 03 55 c8          	add    -0x38(%rbp),%rdx
+  8014c3:	83 c0 08             	add    $0x8,%eax
+  8014c6:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  8014c9:	48 8b 12             	mov    (%rdx),%rdx
+            base = 16;
+  8014cc:	b9 10 00 00 00       	mov    $0x10,%ecx
+        return va_arg(*ap, unsigned long);
+  8014d1:	e9 11 ff ff ff       	jmp    8013e7 <vprintfmt+0x5c0>
+  8014d6:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014da:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014de:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014e2:	eb e5                	jmp    8014c9 <vprintfmt+0x6a2>
+        return va_arg(*ap, unsigned long long);
+  8014e4:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  8014e8:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  8014ec:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8014f0:	e9 59 ff ff ff       	jmp    80144e <vprintfmt+0x627>
+            putch(ch, put_arg);
+  8014f5:	4c 89 ee             	mov    %r13,%rsi
+  8014f8:	bf 25 00 00 00       	mov    $0x25,%edi
+  8014fd:	41 ff d6             	call   *%r14
+            break;
+  801500:	e9 53 f9 ff ff       	jmp    800e58 <vprintfmt+0x31>
+            putch('%', put_arg);
+  801505:	4c 89 ee             	mov    %r13,%rsi
+  801508:	bf 25 00 00 00       	mov    $0x25,%edi
+  80150d:	41 ff d6             	call   *%r14
+            while ((--ufmt)[-1] != '%') /* nothing */
+  801510:	48 83 eb 01          	sub    $0x1,%rbx
+  801514:	80 7b ff 25          	cmpb   $0x25,-0x1(%rbx)
+  801518:	75 f6                	jne    801510 <vprintfmt+0x6e9>
+  80151a:	e9 39 f9 ff ff       	jmp    800e58 <vprintfmt+0x31>
+}
+  80151f:	48 8d 65 d8          	lea    -0x28(%rbp),%rsp
+  801523:	5b                   	pop    %rbx
+  801524:	41 5c                	pop    %r12
+  801526:	41 5d                	pop    %r13
+  801528:	41 5e                	pop    %r14
+  80152a:	41 5f                	pop    %r15
+  80152c:	5d                   	pop    %rbp
+  80152d:	c3                   	ret
+
+000000000080152e <vsnprintf>:
+
+int
+vsnprintf(char *buf, size_t n, const char *fmt, va_list ap) {
+  80152e:	55                   	push   %rbp
+  80152f:	48 89 e5             	mov    %rsp,%rbp
+  801532:	48 83 ec 20          	sub    $0x20,%rsp
+    struct sprintbuf state = {buf, buf + n - 1, 0};
+  801536:	48 89 7d e8          	mov    %rdi,-0x18(%rbp)
+  80153a:	48 8d 44 37 ff       	lea    -0x1(%rdi,%rsi,1),%rax
+  80153f:	48 89 45 f0          	mov    %rax,-0x10(%rbp)
+  801543:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%rbp)
+
+    if (!buf || n < 1) return -E_INVAL;
+  80154a:	48 85 ff             	test   %rdi,%rdi
+  80154d:	74 2b                	je     80157a <vsnprintf+0x4c>
+  80154f:	48 85 f6             	test   %rsi,%rsi
+  801552:	74 26                	je     80157a <vsnprintf+0x4c>
+
+    /* Print the string to the buffer */
+    vprintfmt((void *)sprintputch, &state, fmt, ap);
+  801554:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  801558:	48 bf d2 0d 80 00 00 	movabs $0x800dd2,%rdi
+  80155f:	00 00 00 
+  801562:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  801569:	00 00 00 
+  80156c:	ff d0                	call   *%rax
+
+    /* Null terminate the buffer */
+    *state.start = '\0';
+  80156e:	48 8b 45 e8          	mov    -0x18(%rbp),%rax
+  801572:	c6 00 00             	movb   $0x0,(%rax)
+
+    return state.count;
+  801575:	8b 45 f8             	mov    -0x8(%rbp),%eax
+}
+  801578:	c9                   	leave
+  801579:	c3                   	ret
+    if (!buf || n < 1) return -E_INVAL;
+  80157a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80157f:	eb f7                	jmp    801578 <vsnprintf+0x4a>
+
+0000000000801581 <snprintf>:
+
+int
+snprintf(char *buf, size_t n, const char *fmt, ...) {
+  801581:	55                   	push   %rbp
+  801582:	48 89 e5             	mov    %rsp,%rbp
+  801585:	48 83 ec 50          	sub    $0x50,%rsp
+  801589:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  80158d:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  801591:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+
+    va_start(ap, fmt);
+  801595:	c7 45 b8 18 00 00 00 	movl   $0x18,-0x48(%rbp)
+  80159c:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8015a0:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8015a4:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8015a8:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int rc = vsnprintf(buf, n, fmt, ap);
+  8015ac:	48 8d 4d b8          	lea    -0x48(%rbp),%rcx
+  8015b0:	48 b8 2e 15 80 00 00 	movabs $0x80152e,%rax
+  8015b7:	00 00 00 
+  8015ba:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return rc;
+}
+  8015bc:	c9                   	leave
+  8015bd:	c3                   	ret
+
+00000000008015be <strlen>:
+#define ASM 1
+
+size_t
+strlen(const char *s) {
+    size_t n = 0;
+    while (*s++) n++;
+  8015be:	80 3f 00             	cmpb   $0x0,(%rdi)
+  8015c1:	74 10                	je     8015d3 <strlen+0x15>
+    size_t n = 0;
+  8015c3:	b8 00 00 00 00       	mov    $0x0,%eax
+    while (*s++) n++;
+  8015c8:	48 83 c0 01          	add    $0x1,%rax
+  8015cc:	80 3c 07 00          	cmpb   $0x0,(%rdi,%rax,1)
+  8015d0:	75 f6                	jne    8015c8 <strlen+0xa>
+  8015d2:	c3                   	ret
+    size_t n = 0;
+  8015d3:	b8 00 00 00 00       	mov    $0x0,%eax
+    return n;
+}
+  8015d8:	c3                   	ret
+
+00000000008015d9 <strnlen>:
+
+size_t
+strnlen(const char *s, size_t size) {
+  8015d9:	48 89 f0             	mov    %rsi,%rax
+    size_t n = 0;
+  8015dc:	ba 00 00 00 00       	mov    $0x0,%edx
+    while (n < size && *s++) n++;
+  8015e1:	48 85 f6             	test   %rsi,%rsi
+  8015e4:	74 11                	je     8015f7 <strnlen+0x1e>
+  8015e6:	80 3c 17 00          	cmpb   $0x0,(%rdi,%rdx,1)
+  8015ea:	74 0c                	je     8015f8 <strnlen+0x1f>
+  8015ec:	48 83 c2 01          	add    $0x1,%rdx
+  8015f0:	48 39 d0             	cmp    %rdx,%rax
+  8015f3:	75 f1                	jne    8015e6 <strnlen+0xd>
+  8015f5:	eb 04                	jmp    8015fb <strnlen+0x22>
+  8015f7:	c3                   	ret
+  8015f8:	48 89 d0             	mov    %rdx,%rax
+    return n;
+}
+  8015fb:	c3                   	ret
+
+00000000008015fc <strcpy>:
+
+char *
+strcpy(char *dst, const char *src) {
+  8015fc:	48 89 f8             	mov    %rdi,%rax
+    char *res = dst;
+    while ((*dst++ = *src++)) /* nothing */
+  8015ff:	ba 00 00 00 00       	mov    $0x0,%edx
+  801604:	0f b6 0c 16          	movzbl (%rsi,%rdx,1),%ecx
+  801608:	88 0c 10             	mov    %cl,(%rax,%rdx,1)
+  80160b:	48 83 c2 01          	add    $0x1,%rdx
+  80160f:	84 c9                	test   %cl,%cl
+  801611:	75 f1                	jne    801604 <strcpy+0x8>
+        ;
+    return res;
+}
+  801613:	c3                   	ret
+
+0000000000801614 <strcat>:
+
+char *
+strcat(char *dst, const char *src) {
+  801614:	55                   	push   %rbp
+  801615:	48 89 e5             	mov    %rsp,%rbp
+  801618:	41 54                	push   %r12
+  80161a:	53                   	push   %rbx
+  80161b:	48 89 fb             	mov    %rdi,%rbx
+  80161e:	49 89 f4             	mov    %rsi,%r12
+    size_t len = strlen(dst);
+  801621:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  801628:	00 00 00 
+  80162b:	ff d0                	call   *%rax
+    strcpy(dst + len, src);
+  80162d:	48 8d 3c 03          	lea    (%rbx,%rax,1),%rdi
+  801631:	4c 89 e6             	mov    %r12,%rsi
+  801634:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  80163b:	00 00 00 
+  80163e:	ff d0                	call   *%rax
+    return dst;
+}
+  801640:	48 89 d8             	mov    %rbx,%rax
+  801643:	5b                   	pop    %rbx
+  801644:	41 5c                	pop    %r12
+  801646:	5d                   	pop    %rbp
+  801647:	c3                   	ret
+
+0000000000801648 <strncpy>:
+
+char *
+strncpy(char *dst, const char *src, size_t size) {
+  801648:	48 89 f8             	mov    %rdi,%rax
+    char *ret = dst;
+    while (size-- > 0) {
+  80164b:	48 85 d2             	test   %rdx,%rdx
+  80164e:	74 1f                	je     80166f <strncpy+0x27>
+  801650:	48 01 fa             	add    %rdi,%rdx
+  801653:	48 89 f9             	mov    %rdi,%rcx
+        *dst++ = *src;
+  801656:	48 83 c1 01          	add    $0x1,%rcx
+  80165a:	44 0f b6 06          	movzbl (%rsi),%r8d
+  80165e:	44 88 41 ff          	mov    %r8b,-0x1(%rcx)
+        /* If strlen(src) < size, null-pad
+         * 'dst' out to 'size' chars */
+        if (*src) src++;
+  801662:	41 80 f8 01          	cmp    $0x1,%r8b
+  801666:	48 83 de ff          	sbb    $0xffffffffffffffff,%rsi
+    while (size-- > 0) {
+  80166a:	48 39 ca             	cmp    %rcx,%rdx
+  80166d:	75 e7                	jne    801656 <strncpy+0xe>
+    }
+    return ret;
+}
+  80166f:	c3                   	ret
+
+0000000000801670 <strlcpy>:
+
+size_t
+strlcpy(char *dst, const char *src, size_t size) {
+    char *dst_in = dst;
+    if (size) {
+  801670:	48 89 f8             	mov    %rdi,%rax
+  801673:	48 85 d2             	test   %rdx,%rdx
+  801676:	74 24                	je     80169c <strlcpy+0x2c>
+        while (--size > 0 && *src)
+  801678:	48 83 ea 01          	sub    $0x1,%rdx
+  80167c:	74 1b                	je     801699 <strlcpy+0x29>
+  80167e:	48 8d 0c 17          	lea    (%rdi,%rdx,1),%rcx
+  801682:	0f b6 16             	movzbl (%rsi),%edx
+  801685:	84 d2                	test   %dl,%dl
+  801687:	74 10                	je     801699 <strlcpy+0x29>
+            *dst++ = *src++;
+  801689:	48 83 c6 01          	add    $0x1,%rsi
+  80168d:	48 83 c0 01          	add    $0x1,%rax
+  801691:	88 50 ff             	mov    %dl,-0x1(%rax)
+        while (--size > 0 && *src)
+  801694:	48 39 c8             	cmp    %rcx,%rax
+  801697:	75 e9                	jne    801682 <strlcpy+0x12>
+        *dst = '\0';
+  801699:	c6 00 00             	movb   $0x0,(%rax)
+    }
+    return dst - dst_in;
+  80169c:	48 29 f8             	sub    %rdi,%rax
+}
+  80169f:	c3                   	ret
+
+00000000008016a0 <strcmp>:
+    return dstlen + srclen;
+}
+
+int
+strcmp(const char *p, const char *q) {
+    while (*p && *p == *q) p++, q++;
+  8016a0:	0f b6 07             	movzbl (%rdi),%eax
+  8016a3:	84 c0                	test   %al,%al
+  8016a5:	74 13                	je     8016ba <strcmp+0x1a>
+  8016a7:	38 06                	cmp    %al,(%rsi)
+  8016a9:	75 0f                	jne    8016ba <strcmp+0x1a>
+  8016ab:	48 83 c7 01          	add    $0x1,%rdi
+  8016af:	48 83 c6 01          	add    $0x1,%rsi
+  8016b3:	0f b6 07             	movzbl (%rdi),%eax
+  8016b6:	84 c0                	test   %al,%al
+  8016b8:	75 ed                	jne    8016a7 <strcmp+0x7>
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016ba:	0f b6 c0             	movzbl %al,%eax
+  8016bd:	0f b6 16             	movzbl (%rsi),%edx
+  8016c0:	29 d0                	sub    %edx,%eax
+}
+  8016c2:	c3                   	ret
+
+00000000008016c3 <strncmp>:
+
+int
+strncmp(const char *p, const char *q, size_t n) {
+    while (n && *p && *p == *q) n--, p++, q++;
+  8016c3:	48 85 d2             	test   %rdx,%rdx
+  8016c6:	74 1f                	je     8016e7 <strncmp+0x24>
+  8016c8:	0f b6 07             	movzbl (%rdi),%eax
+  8016cb:	84 c0                	test   %al,%al
+  8016cd:	74 1e                	je     8016ed <strncmp+0x2a>
+  8016cf:	3a 06                	cmp    (%rsi),%al
+  8016d1:	75 1a                	jne    8016ed <strncmp+0x2a>
+  8016d3:	48 83 c7 01          	add    $0x1,%rdi
+  8016d7:	48 83 c6 01          	add    $0x1,%rsi
+  8016db:	48 83 ea 01          	sub    $0x1,%rdx
+  8016df:	75 e7                	jne    8016c8 <strncmp+0x5>
+
+    if (!n) return 0;
+  8016e1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016e6:	c3                   	ret
+  8016e7:	b8 00 00 00 00       	mov    $0x0,%eax
+  8016ec:	c3                   	ret
+  8016ed:	48 85 d2             	test   %rdx,%rdx
+  8016f0:	74 09                	je     8016fb <strncmp+0x38>
+
+    return (int)((unsigned char)*p - (unsigned char)*q);
+  8016f2:	0f b6 07             	movzbl (%rdi),%eax
+  8016f5:	0f b6 16             	movzbl (%rsi),%edx
+  8016f8:	29 d0                	sub    %edx,%eax
+  8016fa:	c3                   	ret
+    if (!n) return 0;
+  8016fb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  801700:	c3                   	ret
+
+0000000000801701 <strchr>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a null pointer if the string has no 'c' */
+char *
+strchr(const char *str, int c) {
+    for (; *str; str++) {
+  801701:	0f b6 17             	movzbl (%rdi),%edx
+  801704:	84 d2                	test   %dl,%dl
+  801706:	74 18                	je     801720 <strchr+0x1f>
+        if (*str == c) {
+  801708:	0f be d2             	movsbl %dl,%edx
+  80170b:	39 f2                	cmp    %esi,%edx
+  80170d:	74 17                	je     801726 <strchr+0x25>
+    for (; *str; str++) {
+  80170f:	48 83 c7 01          	add    $0x1,%rdi
+  801713:	0f b6 17             	movzbl (%rdi),%edx
+  801716:	84 d2                	test   %dl,%dl
+  801718:	75 ee                	jne    801708 <strchr+0x7>
+            return (char *)str;
+        }
+    }
+    return NULL;
+  80171a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80171f:	c3                   	ret
+  801720:	b8 00 00 00 00       	mov    $0x0,%eax
+  801725:	c3                   	ret
+  801726:	48 89 f8             	mov    %rdi,%rax
+}
+  801729:	c3                   	ret
+
+000000000080172a <strfind>:
+
+/* Return a pointer to the first occurrence of 'c' in 's',
+ *  * or a pointer to the string-ending null character if the string has no 'c' */
+char *
+strfind(const char *str, int ch) {
+  80172a:	48 89 f8             	mov    %rdi,%rax
+    for (; *str && *str != ch; str++) /* nothing */
+  80172d:	0f b6 17             	movzbl (%rdi),%edx
+  801730:	84 d2                	test   %dl,%dl
+  801732:	74 13                	je     801747 <strfind+0x1d>
+  801734:	0f be d2             	movsbl %dl,%edx
+  801737:	39 f2                	cmp    %esi,%edx
+  801739:	74 0b                	je     801746 <strfind+0x1c>
+  80173b:	48 83 c0 01          	add    $0x1,%rax
+  80173f:	0f b6 10             	movzbl (%rax),%edx
+  801742:	84 d2                	test   %dl,%dl
+  801744:	75 ee                	jne    801734 <strfind+0xa>
+        ;
+    return (char *)str;
+}
+  801746:	c3                   	ret
+  801747:	c3                   	ret
+
+0000000000801748 <memset>:
+
+
+#if ASM
+void *
+memset(void *v, int c, size_t n) {
+  801748:	49 89 f8             	mov    %rdi,%r8
+    uint8_t *ptr = v;
+    ssize_t ni = n;
+
+    if (__builtin_expect((ni -= ((8 - ((uintptr_t)v & 7))) & 7) < 0, 0)) {
+  80174b:	48 89 f8             	mov    %rdi,%rax
+  80174e:	48 f7 d8             	neg    %rax
+  801751:	83 e0 07             	and    $0x7,%eax
+  801754:	49 89 d1             	mov    %rdx,%r9
+  801757:	49 29 c1             	sub    %rax,%r9
+  80175a:	78 36                	js     801792 <memset+0x4a>
+        while (n-- > 0) *ptr++ = c;
+        return v;
+    }
+
+    uint64_t k = 0x101010101010101ULL * (c & 0xFFU);
+  80175c:	40 0f b6 c6          	movzbl %sil,%eax
+  801760:	48 b9 01 01 01 01 01 	movabs $0x101010101010101,%rcx
+  801767:	01 01 01 
+  80176a:	48 0f af c1          	imul   %rcx,%rax
+
+    if (__builtin_expect((uintptr_t)ptr & 7, 0)) {
+  80176e:	40 f6 c7 07          	test   $0x7,%dil
+  801772:	75 38                	jne    8017ac <memset+0x64>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+    }
+
+    if (__builtin_expect(ni >> 3, 1)) {
+  801774:	4c 89 c9             	mov    %r9,%rcx
+  801777:	48 c1 f9 03          	sar    $0x3,%rcx
+  80177b:	74 0c                	je     801789 <memset+0x41>
+        asm volatile("cld; rep stosq\n" ::"D"(ptr), "a"(k), "c"(ni >> 3)
+  80177d:	fc                   	cld
+  80177e:	f3 48 ab             	rep stos %rax,%es:(%rdi)
+                     : "cc", "memory");
+        ni &= 7;
+  801781:	4d 8d 0c 10          	lea    (%r8,%rdx,1),%r9
+  801785:	41 83 e1 07          	and    $0x7,%r9d
+    }
+
+    if (__builtin_expect(ni, 0)) {
+  801789:	4d 85 c9             	test   %r9,%r9
+  80178c:	75 45                	jne    8017d3 <memset+0x8b>
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+        if (ni & 1) *ptr = k;
+    }
+
+    return v;
+}
+  80178e:	4c 89 c0             	mov    %r8,%rax
+  801791:	c3                   	ret
+        while (n-- > 0) *ptr++ = c;
+  801792:	48 85 d2             	test   %rdx,%rdx
+  801795:	74 f7                	je     80178e <memset+0x46>
+  801797:	48 01 fa             	add    %rdi,%rdx
+    uint8_t *ptr = v;
+  80179a:	48 89 f8             	mov    %rdi,%rax
+        while (n-- > 0) *ptr++ = c;
+  80179d:	48 83 c0 01          	add    $0x1,%rax
+  8017a1:	40 88 70 ff          	mov    %sil,-0x1(%rax)
+  8017a5:	48 39 c2             	cmp    %rax,%rdx
+  8017a8:	75 f3                	jne    80179d <memset+0x55>
+  8017aa:	eb e2                	jmp    80178e <memset+0x46>
+        if ((uintptr_t)ptr & 1) *ptr = k, ptr += 1;
+  8017ac:	40 f6 c7 01          	test   $0x1,%dil
+  8017b0:	74 06                	je     8017b8 <memset+0x70>
+  8017b2:	88 07                	mov    %al,(%rdi)
+  8017b4:	48 8d 7f 01          	lea    0x1(%rdi),%rdi
+        if ((uintptr_t)ptr & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017b8:	40 f6 c7 02          	test   $0x2,%dil
+  8017bc:	74 07                	je     8017c5 <memset+0x7d>
+  8017be:	66 89 07             	mov    %ax,(%rdi)
+  8017c1:	48 83 c7 02          	add    $0x2,%rdi
+        if ((uintptr_t)ptr & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017c5:	40 f6 c7 04          	test   $0x4,%dil
+  8017c9:	74 a9                	je     801774 <memset+0x2c>
+  8017cb:	89 07                	mov    %eax,(%rdi)
+  8017cd:	48 83 c7 04          	add    $0x4,%rdi
+  8017d1:	eb a1                	jmp    801774 <memset+0x2c>
+        if (ni & 4) *(uint32_t *)ptr = k, ptr += 4;
+  8017d3:	41 f6 c1 04          	test   $0x4,%r9b
+  8017d7:	74 06                	je     8017df <memset+0x97>
+  8017d9:	89 07                	mov    %eax,(%rdi)
+  8017db:	48 83 c7 04          	add    $0x4,%rdi
+        if (ni & 2) *(uint16_t *)ptr = k, ptr += 2;
+  8017df:	41 f6 c1 02          	test   $0x2,%r9b
+  8017e3:	74 07                	je     8017ec <memset+0xa4>
+  8017e5:	66 89 07             	mov    %ax,(%rdi)
+  8017e8:	48 83 c7 02          	add    $0x2,%rdi
+        if (ni & 1) *ptr = k;
+  8017ec:	41 f6 c1 01          	test   $0x1,%r9b
+  8017f0:	74 9c                	je     80178e <memset+0x46>
+  8017f2:	88 07                	mov    %al,(%rdi)
+  8017f4:	eb 98                	jmp    80178e <memset+0x46>
+
+00000000008017f6 <memmove>:
+
+void *
+memmove(void *dst, const void *src, size_t n) {
+  8017f6:	48 89 f8             	mov    %rdi,%rax
+  8017f9:	48 89 d1             	mov    %rdx,%rcx
+    const char *s = src;
+    char *d = dst;
+
+    if (s < d && s + n > d) {
+  8017fc:	48 39 fe             	cmp    %rdi,%rsi
+  8017ff:	73 3b                	jae    80183c <memmove+0x46>
+  801801:	48 8d 14 16          	lea    (%rsi,%rdx,1),%rdx
+  801805:	48 39 d7             	cmp    %rdx,%rdi
+  801808:	73 32                	jae    80183c <memmove+0x46>
+        s += n;
+        d += n;
+  80180a:	48 8d 3c 0f          	lea    (%rdi,%rcx,1),%rdi
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80180e:	48 89 d6             	mov    %rdx,%rsi
+  801811:	48 09 fe             	or     %rdi,%rsi
+  801814:	48 09 ce             	or     %rcx,%rsi
+  801817:	40 f6 c6 07          	test   $0x7,%sil
+  80181b:	75 12                	jne    80182f <memmove+0x39>
+            asm volatile("std; rep movsq\n" ::"D"(d - 8), "S"(s - 8), "c"(n / 8)
+  80181d:	48 83 ef 08          	sub    $0x8,%rdi
+  801821:	48 8d 72 f8          	lea    -0x8(%rdx),%rsi
+  801825:	48 c1 e9 03          	shr    $0x3,%rcx
+  801829:	fd                   	std
+  80182a:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+        } else {
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+                         : "cc", "memory");
+        }
+        /* Some versions of GCC rely on DF being clear */
+        asm volatile("cld" ::
+  80182d:	fc                   	cld
+  80182e:	c3                   	ret
+            asm volatile("std; rep movsb\n" ::"D"(d - 1), "S"(s - 1), "c"(n)
+  80182f:	48 83 ef 01          	sub    $0x1,%rdi
+  801833:	48 8d 72 ff          	lea    -0x1(%rdx),%rsi
+  801837:	fd                   	std
+  801838:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+  80183a:	eb f1                	jmp    80182d <memmove+0x37>
+                             : "cc");
+    } else {
+        if (!(((intptr_t)s & 7) | ((intptr_t)d & 7) | (n & 7))) {
+  80183c:	48 89 f2             	mov    %rsi,%rdx
+  80183f:	48 09 c2             	or     %rax,%rdx
+  801842:	48 09 ca             	or     %rcx,%rdx
+  801845:	f6 c2 07             	test   $0x7,%dl
+  801848:	75 0c                	jne    801856 <memmove+0x60>
+            asm volatile("cld; rep movsq\n" ::"D"(d), "S"(s), "c"(n / 8)
+  80184a:	48 c1 e9 03          	shr    $0x3,%rcx
+  80184e:	48 89 c7             	mov    %rax,%rdi
+  801851:	fc                   	cld
+  801852:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+  801855:	c3                   	ret
+                         : "cc", "memory");
+        } else {
+            asm volatile("cld; rep movsb\n" ::"D"(d), "S"(s), "c"(n)
+  801856:	48 89 c7             	mov    %rax,%rdi
+  801859:	fc                   	cld
+  80185a:	f3 a4                	rep movsb %ds:(%rsi),%es:(%rdi)
+                         : "cc", "memory");
+        }
+    }
+    return dst;
+}
+  80185c:	c3                   	ret
+
+000000000080185d <memcpy>:
+    return dst;
+}
+#endif
+
+void *
+memcpy(void *dst, const void *src, size_t n) {
+  80185d:	55                   	push   %rbp
+  80185e:	48 89 e5             	mov    %rsp,%rbp
+    return memmove(dst, src, n);
+  801861:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  801868:	00 00 00 
+  80186b:	ff d0                	call   *%rax
+}
+  80186d:	5d                   	pop    %rbp
+  80186e:	c3                   	ret
+
+000000000080186f <strlcat>:
+strlcat(char *restrict dst, const char *restrict src, size_t maxlen) {
+  80186f:	55                   	push   %rbp
+  801870:	48 89 e5             	mov    %rsp,%rbp
+  801873:	41 57                	push   %r15
+  801875:	41 56                	push   %r14
+  801877:	41 55                	push   %r13
+  801879:	41 54                	push   %r12
+  80187b:	53                   	push   %rbx
+  80187c:	48 83 ec 08          	sub    $0x8,%rsp
+  801880:	49 89 fe             	mov    %rdi,%r14
+  801883:	49 89 f7             	mov    %rsi,%r15
+  801886:	48 89 d3             	mov    %rdx,%rbx
+    const size_t srclen = strlen(src);
+  801889:	48 89 f7             	mov    %rsi,%rdi
+  80188c:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  801893:	00 00 00 
+  801896:	ff d0                	call   *%rax
+  801898:	49 89 c4             	mov    %rax,%r12
+    const size_t dstlen = strnlen(dst, maxlen);
+  80189b:	48 89 de             	mov    %rbx,%rsi
+  80189e:	4c 89 f7             	mov    %r14,%rdi
+  8018a1:	48 b8 d9 15 80 00 00 	movabs $0x8015d9,%rax
+  8018a8:	00 00 00 
+  8018ab:	ff d0                	call   *%rax
+  8018ad:	49 89 c5             	mov    %rax,%r13
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018b0:	48 39 c3             	cmp    %rax,%rbx
+  8018b3:	74 36                	je     8018eb <strlcat+0x7c>
+    if (srclen < maxlen - dstlen) {
+  8018b5:	48 89 d8             	mov    %rbx,%rax
+  8018b8:	4c 29 e8             	sub    %r13,%rax
+  8018bb:	49 39 c4             	cmp    %rax,%r12
+  8018be:	73 31                	jae    8018f1 <strlcat+0x82>
+        memcpy(dst + dstlen, src, srclen + 1);
+  8018c0:	49 8d 54 24 01       	lea    0x1(%r12),%rdx
+  8018c5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018c9:	4c 89 fe             	mov    %r15,%rsi
+  8018cc:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8018d3:	00 00 00 
+  8018d6:	ff d0                	call   *%rax
+    return dstlen + srclen;
+  8018d8:	4b 8d 04 2c          	lea    (%r12,%r13,1),%rax
+}
+  8018dc:	48 83 c4 08          	add    $0x8,%rsp
+  8018e0:	5b                   	pop    %rbx
+  8018e1:	41 5c                	pop    %r12
+  8018e3:	41 5d                	pop    %r13
+  8018e5:	41 5e                	pop    %r14
+  8018e7:	41 5f                	pop    %r15
+  8018e9:	5d                   	pop    %rbp
+  8018ea:	c3                   	ret
+    if (dstlen == maxlen) return maxlen + srclen;
+  8018eb:	49 8d 04 04          	lea    (%r12,%rax,1),%rax
+  8018ef:	eb eb                	jmp    8018dc <strlcat+0x6d>
+        memcpy(dst + dstlen, src, maxlen - 1);
+  8018f1:	48 83 eb 01          	sub    $0x1,%rbx
+  8018f5:	4b 8d 3c 2e          	lea    (%r14,%r13,1),%rdi
+  8018f9:	48 89 da             	mov    %rbx,%rdx
+  8018fc:	4c 89 fe             	mov    %r15,%rsi
+  8018ff:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801906:	00 00 00 
+  801909:	ff d0                	call   *%rax
+        dst[dstlen + maxlen - 1] = '\0';
+  80190b:	49 01 de             	add    %rbx,%r14
+  80190e:	43 c6 04 2e 00       	movb   $0x0,(%r14,%r13,1)
+  801913:	eb c3                	jmp    8018d8 <strlcat+0x69>
+
+0000000000801915 <memcmp>:
+int
+memcmp(const void *v1, const void *v2, size_t n) {
+    const uint8_t *s1 = (const uint8_t *)v1;
+    const uint8_t *s2 = (const uint8_t *)v2;
+
+    while (n-- > 0) {
+  801915:	48 85 d2             	test   %rdx,%rdx
+  801918:	74 2d                	je     801947 <memcmp+0x32>
+  80191a:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (*s1 != *s2) {
+  80191f:	0f b6 0c 07          	movzbl (%rdi,%rax,1),%ecx
+  801923:	44 0f b6 04 06       	movzbl (%rsi,%rax,1),%r8d
+  801928:	44 38 c1             	cmp    %r8b,%cl
+  80192b:	75 0f                	jne    80193c <memcmp+0x27>
+    while (n-- > 0) {
+  80192d:	48 83 c0 01          	add    $0x1,%rax
+  801931:	48 39 c2             	cmp    %rax,%rdx
+  801934:	75 e9                	jne    80191f <memcmp+0xa>
+            return (int)*s1 - (int)*s2;
+        }
+        s1++, s2++;
+    }
+
+    return 0;
+  801936:	b8 00 00 00 00       	mov    $0x0,%eax
+  80193b:	c3                   	ret
+            return (int)*s1 - (int)*s2;
+  80193c:	0f b6 c1             	movzbl %cl,%eax
+  80193f:	45 0f b6 c0          	movzbl %r8b,%r8d
+  801943:	44 29 c0             	sub    %r8d,%eax
+  801946:	c3                   	ret
+    return 0;
+  801947:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80194c:	c3                   	ret
+
+000000000080194d <memfind>:
+
+void *
+memfind(const void *src, int c, size_t n) {
+    const void *end = (const char *)src + n;
+  80194d:	48 8d 04 17          	lea    (%rdi,%rdx,1),%rax
+    for (; src < end; src++) {
+  801951:	48 39 c7             	cmp    %rax,%rdi
+  801954:	73 0f                	jae    801965 <memfind+0x18>
+        if (*(const unsigned char *)src == (unsigned char)c) break;
+  801956:	40 38 37             	cmp    %sil,(%rdi)
+  801959:	74 0e                	je     801969 <memfind+0x1c>
+    for (; src < end; src++) {
+  80195b:	48 83 c7 01          	add    $0x1,%rdi
+  80195f:	48 39 f8             	cmp    %rdi,%rax
+  801962:	75 f2                	jne    801956 <memfind+0x9>
+  801964:	c3                   	ret
+  801965:	48 89 f8             	mov    %rdi,%rax
+  801968:	c3                   	ret
+  801969:	48 89 f8             	mov    %rdi,%rax
+    }
+    return (void *)src;
+}
+  80196c:	c3                   	ret
+
+000000000080196d <strtol>:
+
+long
+strtol(const char *s, char **endptr, int base) {
+  80196d:	49 89 f2             	mov    %rsi,%r10
+    /* Gobble initial whitespace */
+    while (*s == ' ' || *s == '\t') s++;
+  801970:	0f b6 37             	movzbl (%rdi),%esi
+  801973:	40 80 fe 20          	cmp    $0x20,%sil
+  801977:	74 06                	je     80197f <strtol+0x12>
+  801979:	40 80 fe 09          	cmp    $0x9,%sil
+  80197d:	75 13                	jne    801992 <strtol+0x25>
+  80197f:	48 83 c7 01          	add    $0x1,%rdi
+  801983:	0f b6 37             	movzbl (%rdi),%esi
+  801986:	40 80 fe 20          	cmp    $0x20,%sil
+  80198a:	74 f3                	je     80197f <strtol+0x12>
+  80198c:	40 80 fe 09          	cmp    $0x9,%sil
+  801990:	74 ed                	je     80197f <strtol+0x12>
+
+    bool neg = *s == '-';
+
+    /* Plus/minus sign */
+    if (*s == '+' || *s == '-') s++;
+  801992:	8d 46 d5             	lea    -0x2b(%rsi),%eax
+  801995:	83 e0 fd             	and    $0xfffffffd,%eax
+  801998:	3c 01                	cmp    $0x1,%al
+  80199a:	48 83 d7 00          	adc    $0x0,%rdi
+
+    /* Hex or octal base prefix */
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  80199e:	f7 c2 ef ff ff ff    	test   $0xffffffef,%edx
+  8019a4:	75 0f                	jne    8019b5 <strtol+0x48>
+  8019a6:	80 3f 30             	cmpb   $0x30,(%rdi)
+  8019a9:	74 14                	je     8019bf <strtol+0x52>
+        s += 2;
+    } else if (!base && s[0] == '0') {
+        base = 8;
+        s++;
+    } else if (!base) {
+        base = 10;
+  8019ab:	85 d2                	test   %edx,%edx
+  8019ad:	b8 0a 00 00 00       	mov    $0xa,%eax
+  8019b2:	0f 44 d0             	cmove  %eax,%edx
+    }
+
+    /* Digits */
+    long val = 0;
+  8019b5:	b8 00 00 00 00       	mov    $0x0,%eax
+            break;
+
+        if (dig >= base) break;
+
+        /* We don't properly detect overflow! */
+        val = val * base + dig;
+  8019ba:	4c 63 ca             	movslq %edx,%r9
+  8019bd:	eb 36                	jmp    8019f5 <strtol+0x88>
+    if ((!base || base == 16) && (s[0] == '0' && s[1] == 'x')) {
+  8019bf:	80 7f 01 78          	cmpb   $0x78,0x1(%rdi)
+  8019c3:	74 0f                	je     8019d4 <strtol+0x67>
+    } else if (!base && s[0] == '0') {
+  8019c5:	85 d2                	test   %edx,%edx
+  8019c7:	75 ec                	jne    8019b5 <strtol+0x48>
+        s++;
+  8019c9:	48 83 c7 01          	add    $0x1,%rdi
+        base = 8;
+  8019cd:	ba 08 00 00 00       	mov    $0x8,%edx
+        s++;
+  8019d2:	eb e1                	jmp    8019b5 <strtol+0x48>
+        s += 2;
+  8019d4:	48 83 c7 02          	add    $0x2,%rdi
+        base = 16;
+  8019d8:	ba 10 00 00 00       	mov    $0x10,%edx
+        s += 2;
+  8019dd:	eb d6                	jmp    8019b5 <strtol+0x48>
+            dig -= '0';
+  8019df:	83 e9 30             	sub    $0x30,%ecx
+        if (dig >= base) break;
+  8019e2:	44 0f b6 c1          	movzbl %cl,%r8d
+  8019e6:	41 39 d0             	cmp    %edx,%r8d
+  8019e9:	7d 21                	jge    801a0c <strtol+0x9f>
+        val = val * base + dig;
+  8019eb:	49 0f af c1          	imul   %r9,%rax
+  8019ef:	0f b6 c9             	movzbl %cl,%ecx
+  8019f2:	48 01 c8             	add    %rcx,%rax
+        uint8_t dig = *s++;
+  8019f5:	48 83 c7 01          	add    $0x1,%rdi
+  8019f9:	0f b6 4f ff          	movzbl -0x1(%rdi),%ecx
+        if (dig - '0' < 10)
+  8019fd:	80 f9 39             	cmp    $0x39,%cl
+  801a00:	76 dd                	jbe    8019df <strtol+0x72>
+        else if (dig - 'a' < 27)
+  801a02:	80 f9 7b             	cmp    $0x7b,%cl
+  801a05:	77 05                	ja     801a0c <strtol+0x9f>
+            dig -= 'a' - 10;
+  801a07:	83 e9 57             	sub    $0x57,%ecx
+  801a0a:	eb d6                	jmp    8019e2 <strtol+0x75>
+    }
+
+    if (endptr) *endptr = (char *)s;
+  801a0c:	4d 85 d2             	test   %r10,%r10
+  801a0f:	74 03                	je     801a14 <strtol+0xa7>
+  801a11:	49 89 3a             	mov    %rdi,(%r10)
+
+    return (neg ? -val : val);
+  801a14:	48 89 c2             	mov    %rax,%rdx
+  801a17:	48 f7 da             	neg    %rdx
+  801a1a:	40 80 fe 2d          	cmp    $0x2d,%sil
+  801a1e:	48 0f 44 c2          	cmove  %rdx,%rax
+}
+  801a22:	c3                   	ret
+
+0000000000801a23 <readline>:
+#define BUFLEN 1024
+
+static char buf[BUFLEN];
+
+char *
+readline(const char *prompt) {
+  801a23:	55                   	push   %rbp
+  801a24:	48 89 e5             	mov    %rsp,%rbp
+  801a27:	41 57                	push   %r15
+  801a29:	41 56                	push   %r14
+  801a2b:	41 55                	push   %r13
+  801a2d:	41 54                	push   %r12
+  801a2f:	53                   	push   %rbx
+  801a30:	48 83 ec 08          	sub    $0x8,%rsp
+    if (prompt) {
+  801a34:	48 85 ff             	test   %rdi,%rdi
+  801a37:	74 23                	je     801a5c <readline+0x39>
+#if JOS_KERNEL
+        cprintf("%s", prompt);
+#else
+        fprintf(1, "%s", prompt);
+  801a39:	48 89 fa             	mov    %rdi,%rdx
+  801a3c:	48 be 9a 64 80 00 00 	movabs $0x80649a,%rsi
+  801a43:	00 00 00 
+  801a46:	bf 01 00 00 00       	mov    $0x1,%edi
+  801a4b:	b8 00 00 00 00       	mov    $0x0,%eax
+  801a50:	48 b9 ae 48 80 00 00 	movabs $0x8048ae,%rcx
+  801a57:	00 00 00 
+  801a5a:	ff d1                	call   *%rcx
+#endif
+    }
+
+    bool echo = iscons(0);
+  801a5c:	bf 00 00 00 00       	mov    $0x0,%edi
+  801a61:	48 b8 14 0a 80 00 00 	movabs $0x800a14,%rax
+  801a68:	00 00 00 
+  801a6b:	ff d0                	call   *%rax
+  801a6d:	41 89 c6             	mov    %eax,%r14d
+
+    for (size_t i = 0;;) {
+  801a70:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+        int c = getchar();
+  801a76:	49 bd db 09 80 00 00 	movabs $0x8009db,%r13
+  801a7d:	00 00 00 
+                cprintf("read error: %i\n", c);
+            return NULL;
+        } else if ((c == '\b' || c == '\x7F')) {
+            if (i) {
+                if (echo) {
+                    cputchar('\b');
+  801a80:	49 bf b8 09 80 00 00 	movabs $0x8009b8,%r15
+  801a87:	00 00 00 
+  801a8a:	eb 46                	jmp    801ad2 <readline+0xaf>
+            return NULL;
+  801a8c:	b8 00 00 00 00       	mov    $0x0,%eax
+            if (c != -E_EOF)
+  801a91:	83 fb f4             	cmp    $0xfffffff4,%ebx
+  801a94:	75 0f                	jne    801aa5 <readline+0x82>
+            }
+            buf[i] = 0;
+            return buf;
+        }
+    }
+}
+  801a96:	48 83 c4 08          	add    $0x8,%rsp
+  801a9a:	5b                   	pop    %rbx
+  801a9b:	41 5c                	pop    %r12
+  801a9d:	41 5d                	pop    %r13
+  801a9f:	41 5e                	pop    %r14
+  801aa1:	41 5f                	pop    %r15
+  801aa3:	5d                   	pop    %rbp
+  801aa4:	c3                   	ret
+                cprintf("read error: %i\n", c);
+  801aa5:	89 de                	mov    %ebx,%esi
+  801aa7:	48 bf b7 6a 80 00 00 	movabs $0x806ab7,%rdi
+  801aae:	00 00 00 
+  801ab1:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  801ab8:	00 00 00 
+  801abb:	ff d2                	call   *%rdx
+            return NULL;
+  801abd:	b8 00 00 00 00       	mov    $0x0,%eax
+  801ac2:	eb d2                	jmp    801a96 <readline+0x73>
+            if (i) {
+  801ac4:	4d 85 e4             	test   %r12,%r12
+  801ac7:	74 09                	je     801ad2 <readline+0xaf>
+                if (echo) {
+  801ac9:	45 85 f6             	test   %r14d,%r14d
+  801acc:	75 3f                	jne    801b0d <readline+0xea>
+                i--;
+  801ace:	49 83 ec 01          	sub    $0x1,%r12
+        int c = getchar();
+  801ad2:	41 ff d5             	call   *%r13
+  801ad5:	89 c3                	mov    %eax,%ebx
+        if (c < 0) {
+  801ad7:	85 c0                	test   %eax,%eax
+  801ad9:	78 b1                	js     801a8c <readline+0x69>
+        } else if ((c == '\b' || c == '\x7F')) {
+  801adb:	83 f8 08             	cmp    $0x8,%eax
+  801ade:	74 e4                	je     801ac4 <readline+0xa1>
+  801ae0:	83 f8 7f             	cmp    $0x7f,%eax
+  801ae3:	74 df                	je     801ac4 <readline+0xa1>
+        } else if (c >= ' ') {
+  801ae5:	83 f8 1f             	cmp    $0x1f,%eax
+  801ae8:	7e 4d                	jle    801b37 <readline+0x114>
+            if (i < BUFLEN - 1) {
+  801aea:	49 81 fc fe 03 00 00 	cmp    $0x3fe,%r12
+  801af1:	77 df                	ja     801ad2 <readline+0xaf>
+                if (echo) {
+  801af3:	45 85 f6             	test   %r14d,%r14d
+  801af6:	75 2f                	jne    801b27 <readline+0x104>
+                buf[i++] = (char)c;
+  801af8:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801aff:	00 00 00 
+  801b02:	42 88 1c 20          	mov    %bl,(%rax,%r12,1)
+  801b06:	4d 8d 64 24 01       	lea    0x1(%r12),%r12
+  801b0b:	eb c5                	jmp    801ad2 <readline+0xaf>
+                    cputchar('\b');
+  801b0d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801b12:	41 ff d7             	call   *%r15
+                    cputchar(' ');
+  801b15:	bf 20 00 00 00       	mov    $0x20,%edi
+  801b1a:	41 ff d7             	call   *%r15
+                    cputchar('\b');
+  801b1d:	bf 08 00 00 00       	mov    $0x8,%edi
+  801b22:	41 ff d7             	call   *%r15
+  801b25:	eb a7                	jmp    801ace <readline+0xab>
+                    cputchar(c);
+  801b27:	89 c7                	mov    %eax,%edi
+  801b29:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801b30:	00 00 00 
+  801b33:	ff d0                	call   *%rax
+  801b35:	eb c1                	jmp    801af8 <readline+0xd5>
+        } else if (c == '\n' || c == '\r') {
+  801b37:	83 f8 0a             	cmp    $0xa,%eax
+  801b3a:	74 05                	je     801b41 <readline+0x11e>
+  801b3c:	83 f8 0d             	cmp    $0xd,%eax
+  801b3f:	75 91                	jne    801ad2 <readline+0xaf>
+            if (echo) {
+  801b41:	45 85 f6             	test   %r14d,%r14d
+  801b44:	75 14                	jne    801b5a <readline+0x137>
+            buf[i] = 0;
+  801b46:	48 b8 20 00 81 00 00 	movabs $0x810020,%rax
+  801b4d:	00 00 00 
+  801b50:	42 c6 04 20 00       	movb   $0x0,(%rax,%r12,1)
+            return buf;
+  801b55:	e9 3c ff ff ff       	jmp    801a96 <readline+0x73>
+                cputchar('\n');
+  801b5a:	bf 0a 00 00 00       	mov    $0xa,%edi
+  801b5f:	48 b8 b8 09 80 00 00 	movabs $0x8009b8,%rax
+  801b66:	00 00 00 
+  801b69:	ff d0                	call   *%rax
+  801b6b:	eb d9                	jmp    801b46 <readline+0x123>
+
+0000000000801b6d <s2lld>:
+    return result;
+}
+*/
+
+long long
+s2lld(const char* s) {
+  801b6d:	55                   	push   %rbp
+  801b6e:	48 89 e5             	mov    %rsp,%rbp
+  801b71:	53                   	push   %rbx
+  801b72:	48 83 ec 08          	sub    $0x8,%rsp
+  801b76:	48 89 fb             	mov    %rdi,%rbx
+    long long result = 0;
+    int n = strlen(s);
+  801b79:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  801b80:	00 00 00 
+  801b83:	ff d0                	call   *%rax
+    int sign = 1;
+  801b85:	80 3b 2d             	cmpb   $0x2d,(%rbx)
+  801b88:	41 0f 95 c1          	setne  %r9b
+  801b8c:	45 0f b6 c9          	movzbl %r9b,%r9d
+  801b90:	47 8d 4c 09 ff       	lea    -0x1(%r9,%r9,1),%r9d
+    if (s[0] == '-') {
+        sign = -1;
+    }
+    for (int i = 0; i < n; i++) {
+  801b95:	85 c0                	test   %eax,%eax
+  801b97:	7e 3a                	jle    801bd3 <s2lld+0x66>
+  801b99:	48 89 d9             	mov    %rbx,%rcx
+  801b9c:	8d 40 ff             	lea    -0x1(%rax),%eax
+  801b9f:	4c 8d 44 03 01       	lea    0x1(%rbx,%rax,1),%r8
+    long long result = 0;
+  801ba4:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ba9:	eb 09                	jmp    801bb4 <s2lld+0x47>
+    for (int i = 0; i < n; i++) {
+  801bab:	48 83 c1 01          	add    $0x1,%rcx
+  801baf:	4c 39 c1             	cmp    %r8,%rcx
+  801bb2:	74 24                	je     801bd8 <s2lld+0x6b>
+        if ((s[i] >= '0') && (s[i] <= '9')) {
+  801bb4:	0f b6 11             	movzbl (%rcx),%edx
+  801bb7:	8d 72 d0             	lea    -0x30(%rdx),%esi
+  801bba:	40 80 fe 09          	cmp    $0x9,%sil
+  801bbe:	77 eb                	ja     801bab <s2lld+0x3e>
+            result *= 10;
+  801bc0:	48 8d 34 bf          	lea    (%rdi,%rdi,4),%rsi
+            result += s[i] - '0';
+  801bc4:	0f be d2             	movsbl %dl,%edx
+  801bc7:	83 ea 30             	sub    $0x30,%edx
+  801bca:	48 63 d2             	movslq %edx,%rdx
+  801bcd:	48 8d 3c 72          	lea    (%rdx,%rsi,2),%rdi
+  801bd1:	eb d8                	jmp    801bab <s2lld+0x3e>
+    long long result = 0;
+  801bd3:	bf 00 00 00 00       	mov    $0x0,%edi
+        }
+    }
+    return sign * result;
+  801bd8:	49 63 c1             	movslq %r9d,%rax
+  801bdb:	48 0f af c7          	imul   %rdi,%rax
+}
+  801bdf:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801be3:	c9                   	leave
+  801be4:	c3                   	ret
+
+0000000000801be5 <s2llu>:
+
+unsigned long long
+s2llu(const char* s) {
+  801be5:	55                   	push   %rbp
+  801be6:	48 89 e5             	mov    %rsp,%rbp
+  801be9:	53                   	push   %rbx
+  801bea:	48 83 ec 08          	sub    $0x8,%rsp
+  801bee:	48 89 fb             	mov    %rdi,%rbx
+    unsigned long long result = 0;
+    int n = strlen(s);
+  801bf1:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  801bf8:	00 00 00 
+  801bfb:	ff d0                	call   *%rax
+    for (int i = 0; i < n; i++) {
+  801bfd:	85 c0                	test   %eax,%eax
+  801bff:	7e 38                	jle    801c39 <s2llu+0x54>
+  801c01:	48 89 da             	mov    %rbx,%rdx
+  801c04:	8d 40 ff             	lea    -0x1(%rax),%eax
+  801c07:	48 8d 7c 03 01       	lea    0x1(%rbx,%rax,1),%rdi
+    unsigned long long result = 0;
+  801c0c:	be 00 00 00 00       	mov    $0x0,%esi
+  801c11:	eb 09                	jmp    801c1c <s2llu+0x37>
+    for (int i = 0; i < n; i++) {
+  801c13:	48 83 c2 01          	add    $0x1,%rdx
+  801c17:	48 39 fa             	cmp    %rdi,%rdx
+  801c1a:	74 22                	je     801c3e <s2llu+0x59>
+        if ((s[i] >= '0') && (s[i] <= '9')) {
+  801c1c:	0f b6 02             	movzbl (%rdx),%eax
+  801c1f:	8d 48 d0             	lea    -0x30(%rax),%ecx
+  801c22:	80 f9 09             	cmp    $0x9,%cl
+  801c25:	77 ec                	ja     801c13 <s2llu+0x2e>
+            result *= 10;
+  801c27:	48 8d 0c b6          	lea    (%rsi,%rsi,4),%rcx
+            result += s[i] - '0';
+  801c2b:	0f be c0             	movsbl %al,%eax
+  801c2e:	83 e8 30             	sub    $0x30,%eax
+  801c31:	48 98                	cltq
+  801c33:	48 8d 34 48          	lea    (%rax,%rcx,2),%rsi
+  801c37:	eb da                	jmp    801c13 <s2llu+0x2e>
+    unsigned long long result = 0;
+  801c39:	be 00 00 00 00       	mov    $0x0,%esi
+        }
+    }
+    return result;
+}
+  801c3e:	48 89 f0             	mov    %rsi,%rax
+  801c41:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  801c45:	c9                   	leave
+  801c46:	c3                   	ret
+
+0000000000801c47 <readvalue>:
+    return sign * result;
+}
+*/
+
+void
+readvalue(const char* format, void* value) {
+  801c47:	55                   	push   %rbp
+  801c48:	48 89 e5             	mov    %rsp,%rbp
+  801c4b:	41 55                	push   %r13
+  801c4d:	41 54                	push   %r12
+  801c4f:	53                   	push   %rbx
+  801c50:	48 83 ec 18          	sub    $0x18,%rsp
+  801c54:	48 89 fb             	mov    %rdi,%rbx
+  801c57:	49 89 f4             	mov    %rsi,%r12
+    char* buf = readline(NULL);
+  801c5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  801c5f:	48 b8 23 1a 80 00 00 	movabs $0x801a23,%rax
+  801c66:	00 00 00 
+  801c69:	ff d0                	call   *%rax
+  801c6b:	49 89 c5             	mov    %rax,%r13
+    if (strcmp(format, "%s") == 0) {
+  801c6e:	48 be 9a 64 80 00 00 	movabs $0x80649a,%rsi
+  801c75:	00 00 00 
+  801c78:	48 89 df             	mov    %rbx,%rdi
+  801c7b:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801c82:	00 00 00 
+  801c85:	ff d0                	call   *%rax
+  801c87:	85 c0                	test   %eax,%eax
+  801c89:	75 1d                	jne    801ca8 <readvalue+0x61>
+        strcpy(value, buf);
+  801c8b:	4c 89 ee             	mov    %r13,%rsi
+  801c8e:	4c 89 e7             	mov    %r12,%rdi
+  801c91:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  801c98:	00 00 00 
+  801c9b:	ff d0                	call   *%rax
+        //memcpy(value, &result, sizeof(result));
+    } else if (strcmp(format, "%c") == 0) {
+        char result = buf[0];
+        memcpy(value, &result, sizeof(result));
+    }
+  801c9d:	48 83 c4 18          	add    $0x18,%rsp
+  801ca1:	5b                   	pop    %rbx
+  801ca2:	41 5c                	pop    %r12
+  801ca4:	41 5d                	pop    %r13
+  801ca6:	5d                   	pop    %rbp
+  801ca7:	c3                   	ret
+    } else if (strcmp(format, "%d") == 0) {
+  801ca8:	48 be 82 65 80 00 00 	movabs $0x806582,%rsi
+  801caf:	00 00 00 
+  801cb2:	48 89 df             	mov    %rbx,%rdi
+  801cb5:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801cbc:	00 00 00 
+  801cbf:	ff d0                	call   *%rax
+  801cc1:	85 c0                	test   %eax,%eax
+  801cc3:	75 2c                	jne    801cf1 <readvalue+0xaa>
+        int result = s2lld(buf);
+  801cc5:	4c 89 ef             	mov    %r13,%rdi
+  801cc8:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  801ccf:	00 00 00 
+  801cd2:	ff d0                	call   *%rax
+  801cd4:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801cd7:	ba 04 00 00 00       	mov    $0x4,%edx
+  801cdc:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801ce0:	4c 89 e7             	mov    %r12,%rdi
+  801ce3:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801cea:	00 00 00 
+  801ced:	ff d0                	call   *%rax
+  801cef:	eb ac                	jmp    801c9d <readvalue+0x56>
+    } else if ((strcmp(format, "%ld") == 0) || (strcmp(format, "%lld") == 0)) {
+  801cf1:	48 be c7 6a 80 00 00 	movabs $0x806ac7,%rsi
+  801cf8:	00 00 00 
+  801cfb:	48 89 df             	mov    %rbx,%rdi
+  801cfe:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801d05:	00 00 00 
+  801d08:	ff d0                	call   *%rax
+  801d0a:	85 c0                	test   %eax,%eax
+  801d0c:	74 1d                	je     801d2b <readvalue+0xe4>
+  801d0e:	48 be cb 6a 80 00 00 	movabs $0x806acb,%rsi
+  801d15:	00 00 00 
+  801d18:	48 89 df             	mov    %rbx,%rdi
+  801d1b:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801d22:	00 00 00 
+  801d25:	ff d0                	call   *%rax
+  801d27:	85 c0                	test   %eax,%eax
+  801d29:	75 30                	jne    801d5b <readvalue+0x114>
+        long long result = s2lld(buf);
+  801d2b:	4c 89 ef             	mov    %r13,%rdi
+  801d2e:	48 b8 6d 1b 80 00 00 	movabs $0x801b6d,%rax
+  801d35:	00 00 00 
+  801d38:	ff d0                	call   *%rax
+  801d3a:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801d3e:	ba 08 00 00 00       	mov    $0x8,%edx
+  801d43:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d47:	4c 89 e7             	mov    %r12,%rdi
+  801d4a:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801d51:	00 00 00 
+  801d54:	ff d0                	call   *%rax
+    } else if ((strcmp(format, "%ld") == 0) || (strcmp(format, "%lld") == 0)) {
+  801d56:	e9 42 ff ff ff       	jmp    801c9d <readvalue+0x56>
+    } else if (strcmp(format, "%u") == 0) {
+  801d5b:	48 be d0 6a 80 00 00 	movabs $0x806ad0,%rsi
+  801d62:	00 00 00 
+  801d65:	48 89 df             	mov    %rbx,%rdi
+  801d68:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801d6f:	00 00 00 
+  801d72:	ff d0                	call   *%rax
+  801d74:	85 c0                	test   %eax,%eax
+  801d76:	75 2f                	jne    801da7 <readvalue+0x160>
+        unsigned result = s2llu(buf);
+  801d78:	4c 89 ef             	mov    %r13,%rdi
+  801d7b:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  801d82:	00 00 00 
+  801d85:	ff d0                	call   *%rax
+  801d87:	89 45 d8             	mov    %eax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801d8a:	ba 04 00 00 00       	mov    $0x4,%edx
+  801d8f:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801d93:	4c 89 e7             	mov    %r12,%rdi
+  801d96:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801d9d:	00 00 00 
+  801da0:	ff d0                	call   *%rax
+  801da2:	e9 f6 fe ff ff       	jmp    801c9d <readvalue+0x56>
+    } else if ((strcmp(format, "%lu") == 0) || (strcmp(format, "%llu") == 0)) {
+  801da7:	48 be d3 6a 80 00 00 	movabs $0x806ad3,%rsi
+  801dae:	00 00 00 
+  801db1:	48 89 df             	mov    %rbx,%rdi
+  801db4:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801dbb:	00 00 00 
+  801dbe:	ff d0                	call   *%rax
+  801dc0:	85 c0                	test   %eax,%eax
+  801dc2:	74 1d                	je     801de1 <readvalue+0x19a>
+  801dc4:	48 be d7 6a 80 00 00 	movabs $0x806ad7,%rsi
+  801dcb:	00 00 00 
+  801dce:	48 89 df             	mov    %rbx,%rdi
+  801dd1:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801dd8:	00 00 00 
+  801ddb:	ff d0                	call   *%rax
+  801ddd:	85 c0                	test   %eax,%eax
+  801ddf:	75 30                	jne    801e11 <readvalue+0x1ca>
+        unsigned long long result = s2llu(buf);
+  801de1:	4c 89 ef             	mov    %r13,%rdi
+  801de4:	48 b8 e5 1b 80 00 00 	movabs $0x801be5,%rax
+  801deb:	00 00 00 
+  801dee:	ff d0                	call   *%rax
+  801df0:	48 89 45 d8          	mov    %rax,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801df4:	ba 08 00 00 00       	mov    $0x8,%edx
+  801df9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801dfd:	4c 89 e7             	mov    %r12,%rdi
+  801e00:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801e07:	00 00 00 
+  801e0a:	ff d0                	call   *%rax
+    } else if ((strcmp(format, "%lu") == 0) || (strcmp(format, "%llu") == 0)) {
+  801e0c:	e9 8c fe ff ff       	jmp    801c9d <readvalue+0x56>
+    } else if (strcmp(format, "%f") == 0) {
+  801e11:	48 be dc 6a 80 00 00 	movabs $0x806adc,%rsi
+  801e18:	00 00 00 
+  801e1b:	48 89 df             	mov    %rbx,%rdi
+  801e1e:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801e25:	00 00 00 
+  801e28:	ff d0                	call   *%rax
+  801e2a:	85 c0                	test   %eax,%eax
+  801e2c:	0f 84 6b fe ff ff    	je     801c9d <readvalue+0x56>
+    } else if (strcmp(format, "%lf") == 0) {
+  801e32:	48 be df 6a 80 00 00 	movabs $0x806adf,%rsi
+  801e39:	00 00 00 
+  801e3c:	48 89 df             	mov    %rbx,%rdi
+  801e3f:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801e46:	00 00 00 
+  801e49:	ff d0                	call   *%rax
+  801e4b:	85 c0                	test   %eax,%eax
+  801e4d:	0f 84 4a fe ff ff    	je     801c9d <readvalue+0x56>
+    } else if (strcmp(format, "%c") == 0) {
+  801e53:	48 be e3 6a 80 00 00 	movabs $0x806ae3,%rsi
+  801e5a:	00 00 00 
+  801e5d:	48 89 df             	mov    %rbx,%rdi
+  801e60:	48 b8 a0 16 80 00 00 	movabs $0x8016a0,%rax
+  801e67:	00 00 00 
+  801e6a:	ff d0                	call   *%rax
+  801e6c:	85 c0                	test   %eax,%eax
+  801e6e:	0f 85 29 fe ff ff    	jne    801c9d <readvalue+0x56>
+        char result = buf[0];
+  801e74:	41 0f b6 45 00       	movzbl 0x0(%r13),%eax
+  801e79:	88 45 d8             	mov    %al,-0x28(%rbp)
+        memcpy(value, &result, sizeof(result));
+  801e7c:	ba 01 00 00 00       	mov    $0x1,%edx
+  801e81:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  801e85:	4c 89 e7             	mov    %r12,%rdi
+  801e88:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  801e8f:	00 00 00 
+  801e92:	ff d0                	call   *%rax
+  801e94:	e9 04 fe ff ff       	jmp    801c9d <readvalue+0x56>
+
+0000000000801e99 <sys_cputs>:
+     * Up to six parameters in RDI, RSI, RDX, R10, R8 and R9.
+     * 
+     * Registers are assigned using GCC externsion
+     */
+
+    register uintptr_t _a0 asm("rax") = num,
+  801e99:	b8 00 00 00 00       	mov    $0x0,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801e9e:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ea3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ea9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eaf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+     * are not preserved by the kernel, so all of them are outputs too.
+     * The last clause tells the assembler that this can
+     * potentially change the condition codes and arbitrary
+     * memory locations. */
+
+    asm volatile("syscall\n"
+  801eb5:	0f 05                	syscall
+}
+
+void
+sys_cputs(const char *s, size_t len) {
+    syscall(SYS_cputs, 0, (uintptr_t)s, len, 0, 0, 0, 0);
+}
+  801eb7:	c3                   	ret
+
+0000000000801eb8 <sys_cgetc>:
+    register uintptr_t _a0 asm("rax") = num,
+  801eb8:	b8 01 00 00 00       	mov    $0x1,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801ebd:	bf 00 00 00 00       	mov    $0x0,%edi
+  801ec2:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801ec7:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ecc:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ed2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801ed8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801ede:	0f 05                	syscall
+
+int
+sys_cgetc(void) {
+    return syscall(SYS_cgetc, 0, 0, 0, 0, 0, 0, 0);
+}
+  801ee0:	c3                   	ret
+
+0000000000801ee1 <sys_env_destroy>:
+
+int
+sys_env_destroy(envid_t envid) {
+    return syscall(SYS_env_destroy, 1, envid, 0, 0, 0, 0, 0);
+  801ee1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801ee4:	b8 03 00 00 00       	mov    $0x3,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801ee9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801eee:	ba 00 00 00 00       	mov    $0x0,%edx
+  801ef3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801ef9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801eff:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f05:	0f 05                	syscall
+    if (check && ret > 0) {
+  801f07:	48 85 c0             	test   %rax,%rax
+  801f0a:	7f 01                	jg     801f0d <sys_env_destroy+0x2c>
+}
+  801f0c:	c3                   	ret
+sys_env_destroy(envid_t envid) {
+  801f0d:	55                   	push   %rbp
+  801f0e:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801f11:	49 89 c0             	mov    %rax,%r8
+  801f14:	b9 03 00 00 00       	mov    $0x3,%ecx
+  801f19:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  801f20:	00 00 00 
+  801f23:	be 29 00 00 00       	mov    $0x29,%esi
+  801f28:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  801f2f:	00 00 00 
+  801f32:	b8 00 00 00 00       	mov    $0x0,%eax
+  801f37:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  801f3e:	00 00 00 
+  801f41:	41 ff d1             	call   *%r9
+
+0000000000801f44 <sys_getenvid>:
+    register uintptr_t _a0 asm("rax") = num,
+  801f44:	b8 02 00 00 00       	mov    $0x2,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801f49:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f4e:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801f53:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f58:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801f5e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f64:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f6a:	0f 05                	syscall
+
+envid_t
+sys_getenvid(void) {
+    return syscall(SYS_getenvid, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f6c:	c3                   	ret
+
+0000000000801f6d <sys_yield>:
+    register uintptr_t _a0 asm("rax") = num,
+  801f6d:	b8 0c 00 00 00       	mov    $0xc,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  801f72:	bf 00 00 00 00       	mov    $0x0,%edi
+  801f77:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801f7c:	ba 00 00 00 00       	mov    $0x0,%edx
+  801f81:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801f87:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801f8d:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801f93:	0f 05                	syscall
+
+void
+sys_yield(void) {
+    syscall(SYS_yield, 0, 0, 0, 0, 0, 0, 0);
+}
+  801f95:	c3                   	ret
+
+0000000000801f96 <sys_region_refs>:
+    register uintptr_t _a0 asm("rax") = num,
+  801f96:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801f9b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  801fa2:	00 00 00 
+  801fa5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fab:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fb1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fb7:	0f 05                	syscall
+
+int
+sys_region_refs(void *va, size_t size) {
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, MAX_USER_ADDRESS, 0, 0, 0);
+}
+  801fb9:	c3                   	ret
+
+0000000000801fba <sys_region_refs2>:
+
+int
+sys_region_refs2(void *va, size_t size, void *va2, size_t size2) {
+  801fba:	49 89 ca             	mov    %rcx,%r10
+    register uintptr_t _a0 asm("rax") = num,
+  801fbd:	b8 07 00 00 00       	mov    $0x7,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fc2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fc8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fce:	0f 05                	syscall
+    return syscall(SYS_region_refs, 0, (uintptr_t)va, size, (uintptr_t)va2, size2, 0, 0);
+}
+  801fd0:	c3                   	ret
+
+0000000000801fd1 <sys_alloc_region>:
+
+int
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+    int res = syscall(SYS_alloc_region, 1, envid, (uintptr_t)va, size, perm, 0, 0);
+  801fd1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  801fd4:	b8 04 00 00 00       	mov    $0x4,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  801fd9:	4c 63 d1             	movslq %ecx,%r10
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  801fdc:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  801fe2:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  801fe8:	0f 05                	syscall
+    if (check && ret > 0) {
+  801fea:	48 85 c0             	test   %rax,%rax
+  801fed:	7f 01                	jg     801ff0 <sys_alloc_region+0x1f>
+        platform_asan_unpoison(va, size);
+    }
+#endif
+
+    return res;
+}
+  801fef:	c3                   	ret
+sys_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  801ff0:	55                   	push   %rbp
+  801ff1:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  801ff4:	49 89 c0             	mov    %rax,%r8
+  801ff7:	b9 04 00 00 00       	mov    $0x4,%ecx
+  801ffc:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802003:	00 00 00 
+  802006:	be 29 00 00 00       	mov    $0x29,%esi
+  80200b:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802012:	00 00 00 
+  802015:	b8 00 00 00 00       	mov    $0x0,%eax
+  80201a:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  802021:	00 00 00 
+  802024:	41 ff d1             	call   *%r9
+
+0000000000802027 <sys_map_region>:
+
+int
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802027:	49 89 ca             	mov    %rcx,%r10
+    int res = syscall(SYS_map_region, 1, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  80202a:	48 63 d2             	movslq %edx,%rdx
+  80202d:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802030:	b8 05 00 00 00       	mov    $0x5,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802035:	4d 63 c9             	movslq %r9d,%r9
+    asm volatile("syscall\n"
+  802038:	0f 05                	syscall
+    if (check && ret > 0) {
+  80203a:	48 85 c0             	test   %rax,%rax
+  80203d:	7f 01                	jg     802040 <sys_map_region+0x19>
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res && dstenv == CURENVID)
+        platform_asan_unpoison(dstva, size);
+#endif
+    return res;
+}
+  80203f:	c3                   	ret
+sys_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  802040:	55                   	push   %rbp
+  802041:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802044:	49 89 c0             	mov    %rax,%r8
+  802047:	b9 05 00 00 00       	mov    $0x5,%ecx
+  80204c:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802053:	00 00 00 
+  802056:	be 29 00 00 00       	mov    $0x29,%esi
+  80205b:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802062:	00 00 00 
+  802065:	b8 00 00 00 00       	mov    $0x0,%eax
+  80206a:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  802071:	00 00 00 
+  802074:	41 ff d1             	call   *%r9
+
+0000000000802077 <sys_unmap_region>:
+
+int
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+    int res = syscall(SYS_unmap_region, 1, envid, (uintptr_t)va, size, 0, 0, 0);
+  802077:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80207a:	b8 06 00 00 00       	mov    $0x6,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80207f:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802085:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80208b:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802091:	0f 05                	syscall
+    if (check && ret > 0) {
+  802093:	48 85 c0             	test   %rax,%rax
+  802096:	7f 01                	jg     802099 <sys_unmap_region+0x22>
+                 (uintptr_t)va >= SANITIZE_USER_SHADOW_SIZE + SANITIZE_USER_SHADOW_BASE)) {
+        platform_asan_poison(va, size);
+    }
+#endif
+    return res;
+}
+  802098:	c3                   	ret
+sys_unmap_region(envid_t envid, void *va, size_t size) {
+  802099:	55                   	push   %rbp
+  80209a:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80209d:	49 89 c0             	mov    %rax,%r8
+  8020a0:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8020a5:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8020ac:	00 00 00 
+  8020af:	be 29 00 00 00       	mov    $0x29,%esi
+  8020b4:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  8020bb:	00 00 00 
+  8020be:	b8 00 00 00 00       	mov    $0x0,%eax
+  8020c3:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  8020ca:	00 00 00 
+  8020cd:	41 ff d1             	call   *%r9
+
+00000000008020d0 <sys_env_set_status>:
+
+/* sys_exofork is inlined in lib.h */
+
+int
+sys_env_set_status(envid_t envid, int status) {
+    return syscall(SYS_env_set_status, 1, envid, status, 0, 0, 0, 0);
+  8020d0:	48 63 f6             	movslq %esi,%rsi
+  8020d3:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8020d6:	b8 09 00 00 00       	mov    $0x9,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8020db:	ba 00 00 00 00       	mov    $0x0,%edx
+  8020e0:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8020e6:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8020ec:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8020f2:	0f 05                	syscall
+    if (check && ret > 0) {
+  8020f4:	48 85 c0             	test   %rax,%rax
+  8020f7:	7f 01                	jg     8020fa <sys_env_set_status+0x2a>
+}
+  8020f9:	c3                   	ret
+sys_env_set_status(envid_t envid, int status) {
+  8020fa:	55                   	push   %rbp
+  8020fb:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8020fe:	49 89 c0             	mov    %rax,%r8
+  802101:	b9 09 00 00 00       	mov    $0x9,%ecx
+  802106:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  80210d:	00 00 00 
+  802110:	be 29 00 00 00       	mov    $0x29,%esi
+  802115:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  80211c:	00 00 00 
+  80211f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802124:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  80212b:	00 00 00 
+  80212e:	41 ff d1             	call   *%r9
+
+0000000000802131 <sys_env_set_trapframe>:
+
+int
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+    return syscall(SYS_env_set_trapframe, 1, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  802131:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802134:	b8 0a 00 00 00       	mov    $0xa,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802139:	ba 00 00 00 00       	mov    $0x0,%edx
+  80213e:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802144:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80214a:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802150:	0f 05                	syscall
+    if (check && ret > 0) {
+  802152:	48 85 c0             	test   %rax,%rax
+  802155:	7f 01                	jg     802158 <sys_env_set_trapframe+0x27>
+}
+  802157:	c3                   	ret
+sys_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  802158:	55                   	push   %rbp
+  802159:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  80215c:	49 89 c0             	mov    %rax,%r8
+  80215f:	b9 0a 00 00 00       	mov    $0xa,%ecx
+  802164:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  80216b:	00 00 00 
+  80216e:	be 29 00 00 00       	mov    $0x29,%esi
+  802173:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  80217a:	00 00 00 
+  80217d:	b8 00 00 00 00       	mov    $0x0,%eax
+  802182:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  802189:	00 00 00 
+  80218c:	41 ff d1             	call   *%r9
+
+000000000080218f <sys_env_set_pgfault_upcall>:
+
+int
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+    return syscall(SYS_env_set_pgfault_upcall, 1, envid, (uintptr_t)upcall, 0, 0, 0, 0);
+  80218f:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  802192:	b8 0b 00 00 00       	mov    $0xb,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802197:	ba 00 00 00 00       	mov    $0x0,%edx
+  80219c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8021a2:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8021a8:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8021ae:	0f 05                	syscall
+    if (check && ret > 0) {
+  8021b0:	48 85 c0             	test   %rax,%rax
+  8021b3:	7f 01                	jg     8021b6 <sys_env_set_pgfault_upcall+0x27>
+}
+  8021b5:	c3                   	ret
+sys_env_set_pgfault_upcall(envid_t envid, void *upcall) {
+  8021b6:	55                   	push   %rbp
+  8021b7:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8021ba:	49 89 c0             	mov    %rax,%r8
+  8021bd:	b9 0b 00 00 00       	mov    $0xb,%ecx
+  8021c2:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8021c9:	00 00 00 
+  8021cc:	be 29 00 00 00       	mov    $0x29,%esi
+  8021d1:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  8021d8:	00 00 00 
+  8021db:	b8 00 00 00 00       	mov    $0x0,%eax
+  8021e0:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  8021e7:	00 00 00 
+  8021ea:	41 ff d1             	call   *%r9
+
+00000000008021ed <sys_ipc_try_send>:
+
+int
+sys_ipc_try_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  8021ed:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_try_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  8021f0:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8021f3:	b8 0d 00 00 00       	mov    $0xd,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8021f8:	4d 63 c0             	movslq %r8d,%r8
+  8021fb:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802201:	0f 05                	syscall
+}
+  802203:	c3                   	ret
+
+0000000000802204 <sys_ipc_send>:
+
+int
+sys_ipc_send(envid_t envid, uintptr_t value, void *srcva, size_t size, int perm) {
+  802204:	49 89 ca             	mov    %rcx,%r10
+    return syscall(SYS_ipc_send, 0, envid, value, (uintptr_t)srcva, size, perm, 0);
+  802207:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  80220a:	b8 14 00 00 00       	mov    $0x14,%eax
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80220f:	4d 63 c0             	movslq %r8d,%r8
+  802212:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  802218:	0f 05                	syscall
+}
+  80221a:	c3                   	ret
+
+000000000080221b <sys_ipc_recv_futex>:
+    register uintptr_t _a0 asm("rax") = num,
+  80221b:	b8 0e 00 00 00       	mov    $0xe,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802220:	41 89 ca             	mov    %ecx,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802223:	45 89 c0             	mov    %r8d,%r8d
+  802226:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80222c:	0f 05                	syscall
+    if (check && ret > 0) {
+  80222e:	48 85 c0             	test   %rax,%rax
+  802231:	7f 01                	jg     802234 <sys_ipc_recv_futex+0x19>
+    int res = syscall(SYS_ipc_recv, 1, (uintptr_t)dstva, size, (uintptr_t)addr, expected, timeout, 0);
+#ifdef SANITIZE_USER_SHADOW_BASE
+    if (!res) platform_asan_unpoison(dstva, thisenv->env_ipc_maxsz);
+#endif
+    return res;
+}
+  802233:	c3                   	ret
+sys_ipc_recv_futex(void *dstva, size_t size, const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  802234:	55                   	push   %rbp
+  802235:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  802238:	49 89 c0             	mov    %rax,%r8
+  80223b:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  802240:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  802247:	00 00 00 
+  80224a:	be 29 00 00 00       	mov    $0x29,%esi
+  80224f:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802256:	00 00 00 
+  802259:	b8 00 00 00 00       	mov    $0x0,%eax
+  80225e:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  802265:	00 00 00 
+  802268:	41 ff d1             	call   *%r9
+
+000000000080226b <sys_ipc_recv>:
+sys_ipc_recv(void *dstva, size_t size) {
+  80226b:	55                   	push   %rbp
+  80226c:	48 89 e5             	mov    %rsp,%rbp
+    return sys_ipc_recv_futex(dstva, size, NULL, 0, 0);
+  80226f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802275:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80227a:	ba 00 00 00 00       	mov    $0x0,%edx
+  80227f:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  802286:	00 00 00 
+  802289:	ff d0                	call   *%rax
+}
+  80228b:	5d                   	pop    %rbp
+  80228c:	c3                   	ret
+
+000000000080228d <sys_gettime>:
+    register uintptr_t _a0 asm("rax") = num,
+  80228d:	b8 0f 00 00 00       	mov    $0xf,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  802292:	bf 00 00 00 00       	mov    $0x0,%edi
+  802297:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  80229c:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022a1:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8022a7:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022ad:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8022b3:	0f 05                	syscall
+
+int
+sys_gettime(void) {
+    return syscall(SYS_gettime, 0, 0, 0, 0, 0, 0, 0);
+}
+  8022b5:	c3                   	ret
+
+00000000008022b6 <sys_ring_register>:
+    register uintptr_t _a0 asm("rax") = num,
+  8022b6:	b8 10 00 00 00       	mov    $0x10,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8022bb:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8022c0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8022c5:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8022cb:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8022d1:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8022d7:	0f 05                	syscall
+    if (check && ret > 0) {
+  8022d9:	48 85 c0             	test   %rax,%rax
+  8022dc:	7f 01                	jg     8022df <sys_ring_register+0x29>
+
+int
+sys_ring_register(struct SyscallRing *ring) {
+    return syscall(SYS_ring_register, 1, (uintptr_t)ring, 0, 0, 0, 0, 0);
+}
+  8022de:	c3                   	ret
+sys_ring_register(struct SyscallRing *ring) {
+  8022df:	55                   	push   %rbp
+  8022e0:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8022e3:	49 89 c0             	mov    %rax,%r8
+  8022e6:	b9 10 00 00 00       	mov    $0x10,%ecx
+  8022eb:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8022f2:	00 00 00 
+  8022f5:	be 29 00 00 00       	mov    $0x29,%esi
+  8022fa:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  802301:	00 00 00 
+  802304:	b8 00 00 00 00       	mov    $0x0,%eax
+  802309:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  802310:	00 00 00 
+  802313:	41 ff d1             	call   *%r9
+
+0000000000802316 <sys_ring_enter>:
+    register uintptr_t _a0 asm("rax") = num,
+  802316:	b8 11 00 00 00       	mov    $0x11,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  80231b:	bf 00 00 00 00       	mov    $0x0,%edi
+  802320:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802325:	ba 00 00 00 00       	mov    $0x0,%edx
+  80232a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802330:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802336:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80233c:	0f 05                	syscall
+
+int
+sys_ring_enter(void) {
+    return syscall(SYS_ring_enter, 0, 0, 0, 0, 0, 0, 0);
+}
+  80233e:	c3                   	ret
+
+000000000080233f <sys_futex_wait>:
+
+int
+sys_futex_wait(const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+    return syscall(SYS_futex_wait, 0, (uintptr_t)addr, expected, timeout, 0, 0, 0);
+  80233f:	89 d2                	mov    %edx,%edx
+  802341:	89 f6                	mov    %esi,%esi
+    register uintptr_t _a0 asm("rax") = num,
+  802343:	b8 12 00 00 00       	mov    $0x12,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802348:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  80234e:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802354:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80235a:	0f 05                	syscall
+}
+  80235c:	c3                   	ret
+
+000000000080235d <sys_futex_wake>:
+
+int
+sys_futex_wake(const volatile uint32_t *addr, int n) {
+    return syscall(SYS_futex_wake, 0, (uintptr_t)addr, n, 0, 0, 0, 0);
+  80235d:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802360:	b8 13 00 00 00       	mov    $0x13,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802365:	ba 00 00 00 00       	mov    $0x0,%edx
+  80236a:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802370:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802376:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80237c:	0f 05                	syscall
+}
+  80237e:	c3                   	ret
+
+000000000080237f <sys_region_pa>:
+
+int64_t
+sys_region_pa(void *va, int perm) {
+    return syscall(SYS_region_pa, 0, (uintptr_t)va, perm, 0, 0, 0, 0);
+  80237f:	48 63 f6             	movslq %esi,%rsi
+    register uintptr_t _a0 asm("rax") = num,
+  802382:	b8 15 00 00 00       	mov    $0x15,%eax
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  802387:	ba 00 00 00 00       	mov    $0x0,%edx
+  80238c:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  802392:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802398:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  80239e:	0f 05                	syscall
+}
+  8023a0:	c3                   	ret
+
+00000000008023a1 <sys_irq_ack>:
+
+int
+sys_irq_ack(int irq) {
+    return syscall(SYS_irq_ack, 1, irq, 0, 0, 0, 0, 0);
+  8023a1:	48 63 ff             	movslq %edi,%rdi
+    register uintptr_t _a0 asm("rax") = num,
+  8023a4:	b8 16 00 00 00       	mov    $0x16,%eax
+                           _a1 asm("rdi") = a1, _a2 asm("rsi") = a2,
+  8023a9:	be 00 00 00 00       	mov    $0x0,%esi
+                           _a3 asm("rdx") = a3, _a4 asm("r10") = a4,
+  8023ae:	ba 00 00 00 00       	mov    $0x0,%edx
+  8023b3:	41 ba 00 00 00 00    	mov    $0x0,%r10d
+                           _a5 asm("r8") = a5, _a6 asm("r9") = a6;
+  8023b9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  8023bf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+    asm volatile("syscall\n"
+  8023c5:	0f 05                	syscall
+    if (check && ret > 0) {
+  8023c7:	48 85 c0             	test   %rax,%rax
+  8023ca:	7f 01                	jg     8023cd <sys_irq_ack+0x2c>
+}
+  8023cc:	c3                   	ret
+sys_irq_ack(int irq) {
+  8023cd:	55                   	push   %rbp
+  8023ce:	48 89 e5             	mov    %rsp,%rbp
+        panic("syscall %zd returned %zd (> 0)", num, ret);
+  8023d1:	49 89 c0             	mov    %rax,%r8
+  8023d4:	b9 16 00 00 00       	mov    $0x16,%ecx
+  8023d9:	48 ba e8 6a 80 00 00 	movabs $0x806ae8,%rdx
+  8023e0:	00 00 00 
+  8023e3:	be 29 00 00 00       	mov    $0x29,%esi
+  8023e8:	48 bf 07 6b 80 00 00 	movabs $0x806b07,%rdi
+  8023ef:	00 00 00 
+  8023f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8023f7:	49 b9 87 0b 80 00 00 	movabs $0x800b87,%r9
+  8023fe:	00 00 00 
+  802401:	41 ff d1             	call   *%r9
+
+0000000000802404 <fork>:
+ * Hint:
+ *   Use sys_map_region, it can perform address space copying in one call
+ *   Remember to fix "thisenv" in the child process.
+ */
+envid_t
+fork(void) {
+  802404:	55                   	push   %rbp
+  802405:	48 89 e5             	mov    %rsp,%rbp
+  802408:	41 54                	push   %r12
+  80240a:	53                   	push   %rbx
+    // LAB 9: Your code here
+    /* The child would write them out once more */
+    file_flush_buffers();
+  80240b:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  802412:	00 00 00 
+  802415:	ff d0                	call   *%rax
+
+/* This must be inlined. Exercise for reader: why? */
+static inline envid_t __attribute__((always_inline))
+sys_exofork(void) {
+    envid_t ret;
+    asm volatile("syscall"
+  802417:	b8 08 00 00 00       	mov    $0x8,%eax
+  80241c:	0f 05                	syscall
+  80241e:	41 89 c4             	mov    %eax,%r12d
+
+	envid_t envid = sys_exofork();
+    if (envid < 0)
+  802421:	85 c0                	test   %eax,%eax
+  802423:	78 7e                	js     8024a3 <fork+0x9f>
+        return envid;
+    if (envid == 0) {
+  802425:	0f 84 80 00 00 00    	je     8024ab <fork+0xa7>
+        thisenv = &envs[ENVX(sys_getenvid())];
+        return 0;
+    }
+    if (sys_map_region(0, NULL, envid, NULL, MAX_USER_ADDRESS, PROT_ALL | PROT_LAZY | PROT_COMBINE) < 0) {
+  80242b:	41 b9 df 01 00 00    	mov    $0x1df,%r9d
+  802431:	49 b8 00 00 00 00 80 	movabs $0x8000000000,%r8
+  802438:	00 00 00 
+  80243b:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802440:	89 c2                	mov    %eax,%edx
+  802442:	be 00 00 00 00       	mov    $0x0,%esi
+  802447:	bf 00 00 00 00       	mov    $0x0,%edi
+  80244c:	48 b8 27 20 80 00 00 	movabs $0x802027,%rax
+  802453:	00 00 00 
+  802456:	ff d0                	call   *%rax
+  802458:	85 c0                	test   %eax,%eax
+  80245a:	0f 88 86 00 00 00    	js     8024e6 <fork+0xe2>
+		return -1;
+	}
+    if (sys_env_set_pgfault_upcall(envid, thisenv->env_pgfault_upcall) < 0) {
+  802460:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802467:	00 00 00 
+  80246a:	48 8b b0 28 01 00 00 	mov    0x128(%rax),%rsi
+  802471:	44 89 e7             	mov    %r12d,%edi
+  802474:	48 b8 8f 21 80 00 00 	movabs $0x80218f,%rax
+  80247b:	00 00 00 
+  80247e:	ff d0                	call   *%rax
+  802480:	85 c0                	test   %eax,%eax
+  802482:	78 6a                	js     8024ee <fork+0xea>
+		return -1;
+	}
+    if (sys_env_set_status(envid, ENV_RUNNABLE) < 0) {
+  802484:	be 02 00 00 00       	mov    $0x2,%esi
+  802489:	44 89 e7             	mov    %r12d,%edi
+  80248c:	48 b8 d0 20 80 00 00 	movabs $0x8020d0,%rax
+  802493:	00 00 00 
+  802496:	ff d0                	call   *%rax
+		return -1;
+  802498:	85 c0                	test   %eax,%eax
+  80249a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+  80249f:	44 0f 48 e0          	cmovs  %eax,%r12d
+	}
+    return envid;
+}
+  8024a3:	44 89 e0             	mov    %r12d,%eax
+  8024a6:	5b                   	pop    %rbx
+  8024a7:	41 5c                	pop    %r12
+  8024a9:	5d                   	pop    %rbp
+  8024aa:	c3                   	ret
+        thisenv = &envs[ENVX(sys_getenvid())];
+  8024ab:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  8024b2:	00 00 00 
+  8024b5:	ff d0                	call   *%rax
+  8024b7:	89 c2                	mov    %eax,%edx
+  8024b9:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  8024bf:	48 89 d0             	mov    %rdx,%rax
+  8024c2:	48 c1 e0 04          	shl    $0x4,%rax
+  8024c6:	48 29 d0             	sub    %rdx,%rax
+  8024c9:	48 c1 e0 05          	shl    $0x5,%rax
+  8024cd:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8024d4:	00 00 00 
+  8024d7:	48 01 d0             	add    %rdx,%rax
+  8024da:	48 a3 18 00 81 00 00 	movabs %rax,0x810018
+  8024e1:	00 00 00 
+        return 0;
+  8024e4:	eb bd                	jmp    8024a3 <fork+0x9f>
+		return -1;
+  8024e6:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8024ec:	eb b5                	jmp    8024a3 <fork+0x9f>
+		return -1;
+  8024ee:	41 bc ff ff ff ff    	mov    $0xffffffff,%r12d
+  8024f4:	eb ad                	jmp    8024a3 <fork+0x9f>
+
+00000000008024f6 <sfork>:
+
+envid_t
+sfork() {
+  8024f6:	55                   	push   %rbp
+  8024f7:	48 89 e5             	mov    %rsp,%rbp
+    panic("sfork() is not implemented");
+  8024fa:	48 ba 15 6b 80 00 00 	movabs $0x806b15,%rdx
+  802501:	00 00 00 
+  802504:	be 2d 00 00 00       	mov    $0x2d,%esi
+  802509:	48 bf 30 6b 80 00 00 	movabs $0x806b30,%rdi
+  802510:	00 00 00 
+  802513:	b8 00 00 00 00       	mov    $0x0,%eax
+  802518:	48 b9 87 0b 80 00 00 	movabs $0x800b87,%rcx
+  80251f:	00 00 00 
+  802522:	ff d1                	call   *%rcx
+
+0000000000802524 <argstart>:
+#include <inc/args.h>
+#include <inc/string.h>
+
+void
+argstart(int *argc, char **argv, struct Argstate *args) {
+    args->argc = argc;
+  802524:	48 89 3a             	mov    %rdi,(%rdx)
+    args->argv = (const char **)argv;
+  802527:	48 89 72 08          	mov    %rsi,0x8(%rdx)
+    args->curarg = (*argc > 1 && argv ? "" : NULL);
+  80252b:	83 3f 01             	cmpl   $0x1,(%rdi)
+  80252e:	7e 0f                	jle    80253f <argstart+0x1b>
+  802530:	48 b8 e4 63 80 00 00 	movabs $0x8063e4,%rax
+  802537:	00 00 00 
+  80253a:	48 85 f6             	test   %rsi,%rsi
+  80253d:	75 05                	jne    802544 <argstart+0x20>
+  80253f:	b8 00 00 00 00       	mov    $0x0,%eax
+  802544:	48 89 42 10          	mov    %rax,0x10(%rdx)
+    args->argvalue = 0;
+  802548:	48 c7 42 18 00 00 00 	movq   $0x0,0x18(%rdx)
+  80254f:	00 
+}
+  802550:	c3                   	ret
+
+0000000000802551 <argnext>:
+
+int
+argnext(struct Argstate *args) {
+    int arg;
+
+    args->argvalue = 0;
+  802551:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802558:	00 
+
+    /* Done processing arguments if args->curarg == 0 */
+    if (args->curarg == 0) return -1;
+  802559:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  80255d:	48 85 c0             	test   %rax,%rax
+  802560:	0f 84 8f 00 00 00    	je     8025f5 <argnext+0xa4>
+argnext(struct Argstate *args) {
+  802566:	55                   	push   %rbp
+  802567:	48 89 e5             	mov    %rsp,%rbp
+  80256a:	53                   	push   %rbx
+  80256b:	48 83 ec 08          	sub    $0x8,%rsp
+  80256f:	48 89 fb             	mov    %rdi,%rbx
+
+    if (!*args->curarg) {
+  802572:	80 38 00             	cmpb   $0x0,(%rax)
+  802575:	75 52                	jne    8025c9 <argnext+0x78>
+        /* Need to process the next argument
+         * Check for end of argument list */
+        if (*args->argc == 1 ||
+  802577:	48 8b 17             	mov    (%rdi),%rdx
+  80257a:	83 3a 01             	cmpl   $0x1,(%rdx)
+  80257d:	74 67                	je     8025e6 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80257f:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802583:	48 8b 47 08          	mov    0x8(%rdi),%rax
+        if (*args->argc == 1 ||
+  802587:	80 38 2d             	cmpb   $0x2d,(%rax)
+  80258a:	75 5a                	jne    8025e6 <argnext+0x95>
+            args->argv[1][0] != '-' ||
+  80258c:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  802590:	74 54                	je     8025e6 <argnext+0x95>
+            args->argv[1][1] == '\0') goto endofargs;
+
+        /* Shift arguments down one */
+        args->curarg = args->argv[1] + 1;
+  802592:	48 83 c0 01          	add    $0x1,%rax
+  802596:	48 89 43 10          	mov    %rax,0x10(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  80259a:	8b 12                	mov    (%rdx),%edx
+  80259c:	83 ea 01             	sub    $0x1,%edx
+  80259f:	48 63 d2             	movslq %edx,%rdx
+  8025a2:	48 c1 e2 03          	shl    $0x3,%rdx
+  8025a6:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  8025aa:	48 83 c7 08          	add    $0x8,%rdi
+  8025ae:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  8025b5:	00 00 00 
+  8025b8:	ff d0                	call   *%rax
+
+        (*args->argc)--;
+  8025ba:	48 8b 03             	mov    (%rbx),%rax
+  8025bd:	83 28 01             	subl   $0x1,(%rax)
+
+        /* Check for "--": end of argument list */
+        if (args->curarg[0] == '-' &&
+  8025c0:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8025c4:	80 38 2d             	cmpb   $0x2d,(%rax)
+  8025c7:	74 17                	je     8025e0 <argnext+0x8f>
+            args->curarg[1] == '\0') goto endofargs;
+    }
+
+    arg = (unsigned char)*args->curarg;
+  8025c9:	48 8b 43 10          	mov    0x10(%rbx),%rax
+  8025cd:	0f b6 10             	movzbl (%rax),%edx
+    args->curarg++;
+  8025d0:	48 83 c0 01          	add    $0x1,%rax
+  8025d4:	48 89 43 10          	mov    %rax,0x10(%rbx)
+    return arg;
+
+endofargs:
+    args->curarg = 0;
+    return -1;
+}
+  8025d8:	89 d0                	mov    %edx,%eax
+  8025da:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8025de:	c9                   	leave
+  8025df:	c3                   	ret
+        if (args->curarg[0] == '-' &&
+  8025e0:	80 78 01 00          	cmpb   $0x0,0x1(%rax)
+  8025e4:	75 e3                	jne    8025c9 <argnext+0x78>
+    args->curarg = 0;
+  8025e6:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  8025ed:	00 
+    return -1;
+  8025ee:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+  8025f3:	eb e3                	jmp    8025d8 <argnext+0x87>
+    if (args->curarg == 0) return -1;
+  8025f5:	ba ff ff ff ff       	mov    $0xffffffff,%edx
+}
+  8025fa:	89 d0                	mov    %edx,%eax
+  8025fc:	c3                   	ret
+
+00000000008025fd <argnextvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+}
+
+char *
+argnextvalue(struct Argstate *args) {
+    if (!args->curarg) return 0;
+  8025fd:	48 8b 47 10          	mov    0x10(%rdi),%rax
+  802601:	48 85 c0             	test   %rax,%rax
+  802604:	74 7b                	je     802681 <argnextvalue+0x84>
+argnextvalue(struct Argstate *args) {
+  802606:	55                   	push   %rbp
+  802607:	48 89 e5             	mov    %rsp,%rbp
+  80260a:	53                   	push   %rbx
+  80260b:	48 83 ec 08          	sub    $0x8,%rsp
+  80260f:	48 89 fb             	mov    %rdi,%rbx
+
+    if (*args->curarg) {
+  802612:	80 38 00             	cmpb   $0x0,(%rax)
+  802615:	74 1c                	je     802633 <argnextvalue+0x36>
+        args->argvalue = args->curarg;
+  802617:	48 89 47 18          	mov    %rax,0x18(%rdi)
+        args->curarg = "";
+  80261b:	48 b8 e4 63 80 00 00 	movabs $0x8063e4,%rax
+  802622:	00 00 00 
+  802625:	48 89 47 10          	mov    %rax,0x10(%rdi)
+    } else {
+        args->argvalue = 0;
+        args->curarg = 0;
+    }
+
+    return (char *)args->argvalue;
+  802629:	48 8b 43 18          	mov    0x18(%rbx),%rax
+}
+  80262d:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  802631:	c9                   	leave
+  802632:	c3                   	ret
+    } else if (*args->argc > 1) {
+  802633:	48 8b 07             	mov    (%rdi),%rax
+  802636:	83 38 01             	cmpl   $0x1,(%rax)
+  802639:	7f 12                	jg     80264d <argnextvalue+0x50>
+        args->argvalue = 0;
+  80263b:	48 c7 47 18 00 00 00 	movq   $0x0,0x18(%rdi)
+  802642:	00 
+        args->curarg = 0;
+  802643:	48 c7 47 10 00 00 00 	movq   $0x0,0x10(%rdi)
+  80264a:	00 
+  80264b:	eb dc                	jmp    802629 <argnextvalue+0x2c>
+        args->argvalue = args->argv[1];
+  80264d:	48 8b 7f 08          	mov    0x8(%rdi),%rdi
+  802651:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  802655:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+        memmove(args->argv + 1, args->argv + 2, sizeof(*args->argv) * (*args->argc - 1));
+  802659:	8b 10                	mov    (%rax),%edx
+  80265b:	83 ea 01             	sub    $0x1,%edx
+  80265e:	48 63 d2             	movslq %edx,%rdx
+  802661:	48 c1 e2 03          	shl    $0x3,%rdx
+  802665:	48 8d 77 10          	lea    0x10(%rdi),%rsi
+  802669:	48 83 c7 08          	add    $0x8,%rdi
+  80266d:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  802674:	00 00 00 
+  802677:	ff d0                	call   *%rax
+        (*args->argc)--;
+  802679:	48 8b 03             	mov    (%rbx),%rax
+  80267c:	83 28 01             	subl   $0x1,(%rax)
+  80267f:	eb a8                	jmp    802629 <argnextvalue+0x2c>
+}
+  802681:	c3                   	ret
+
+0000000000802682 <argvalue>:
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802682:	48 8b 47 18          	mov    0x18(%rdi),%rax
+  802686:	48 85 c0             	test   %rax,%rax
+  802689:	74 01                	je     80268c <argvalue+0xa>
+}
+  80268b:	c3                   	ret
+argvalue(struct Argstate *args) {
+  80268c:	55                   	push   %rbp
+  80268d:	48 89 e5             	mov    %rsp,%rbp
+    return (char *)(args->argvalue ? args->argvalue : argnextvalue(args));
+  802690:	48 b8 fd 25 80 00 00 	movabs $0x8025fd,%rax
+  802697:	00 00 00 
+  80269a:	ff d0                	call   *%rax
+}
+  80269c:	5d                   	pop    %rbp
+  80269d:	c3                   	ret
+
+000000000080269e <fd2num>:
+
+/********************File descriptor manipulators***********************/
+
+uint64_t
+fd2num(struct Fd *fd) {
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  80269e:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8026a5:	ff ff ff 
+  8026a8:	48 01 f8             	add    %rdi,%rax
+  8026ab:	48 c1 e8 0c          	shr    $0xc,%rax
+}
+  8026af:	c3                   	ret
+
+00000000008026b0 <fd2data>:
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8026b0:	48 b8 00 00 00 30 ff 	movabs $0xffffffff30000000,%rax
+  8026b7:	ff ff ff 
+  8026ba:	48 01 f8             	add    %rdi,%rax
+  8026bd:	48 c1 e8 0c          	shr    $0xc,%rax
+
+char *
+fd2data(struct Fd *fd) {
+    return INDEX2DATA(fd2num(fd));
+  8026c1:	48 05 20 00 0d 00    	add    $0xd0020,%rax
+  8026c7:	48 c1 e0 0c          	shl    $0xc,%rax
+}
+  8026cb:	c3                   	ret
+
+00000000008026cc <fd_alloc>:
+ *
+ * Returns 0 on success, < 0 on error.  Errors are:
+ *  -E_MAX_FD: no more file descriptors
+ * On error, *fd_store is set to 0. */
+int
+fd_alloc(struct Fd **fd_store) {
+  8026cc:	55                   	push   %rbp
+  8026cd:	48 89 e5             	mov    %rsp,%rbp
+  8026d0:	41 57                	push   %r15
+  8026d2:	41 56                	push   %r14
+  8026d4:	41 55                	push   %r13
+  8026d6:	41 54                	push   %r12
+  8026d8:	53                   	push   %rbx
+  8026d9:	48 83 ec 08          	sub    $0x8,%rsp
+  8026dd:	49 89 ff             	mov    %rdi,%r15
+  8026e0:	bb 00 00 00 d0       	mov    $0xd0000000,%ebx
+    for (int i = 0; i < MAXFD; i++) {
+        struct Fd *fd = INDEX2FD(i);
+        if (!(get_prot(fd) & PROT_R)) {
+  8026e5:	49 bd b8 59 80 00 00 	movabs $0x8059b8,%r13
+  8026ec:	00 00 00 
+    for (int i = 0; i < MAXFD; i++) {
+  8026ef:	41 be 00 00 02 d0    	mov    $0xd0020000,%r14d
+        struct Fd *fd = INDEX2FD(i);
+  8026f5:	49 89 dc             	mov    %rbx,%r12
+        if (!(get_prot(fd) & PROT_R)) {
+  8026f8:	48 89 df             	mov    %rbx,%rdi
+  8026fb:	41 ff d5             	call   *%r13
+  8026fe:	83 e0 04             	and    $0x4,%eax
+  802701:	74 17                	je     80271a <fd_alloc+0x4e>
+    for (int i = 0; i < MAXFD; i++) {
+  802703:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  80270a:	4c 39 f3             	cmp    %r14,%rbx
+  80270d:	75 e6                	jne    8026f5 <fd_alloc+0x29>
+  80270f:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+            *fd_store = fd;
+            return 0;
+        }
+    }
+    *fd_store = 0;
+    return -E_MAX_OPEN;
+  802715:	b8 f2 ff ff ff       	mov    $0xfffffff2,%eax
+            *fd_store = fd;
+  80271a:	4d 89 27             	mov    %r12,(%r15)
+}
+  80271d:	48 83 c4 08          	add    $0x8,%rsp
+  802721:	5b                   	pop    %rbx
+  802722:	41 5c                	pop    %r12
+  802724:	41 5d                	pop    %r13
+  802726:	41 5e                	pop    %r14
+  802728:	41 5f                	pop    %r15
+  80272a:	5d                   	pop    %rbp
+  80272b:	c3                   	ret
+
+000000000080272c <fd_lookup>:
+ * Returns 0 on success (the page is in range and mapped), < 0 on error.
+ * Errors are:
+ *  -E_INVAL: fdnum was either not in range or not mapped. */
+int
+fd_lookup(int fdnum, struct Fd **fd_store) {
+    if (fdnum < 0 || fdnum >= MAXFD) {
+  80272c:	83 ff 1f             	cmp    $0x1f,%edi
+  80272f:	77 39                	ja     80276a <fd_lookup+0x3e>
+fd_lookup(int fdnum, struct Fd **fd_store) {
+  802731:	55                   	push   %rbp
+  802732:	48 89 e5             	mov    %rsp,%rbp
+  802735:	41 54                	push   %r12
+  802737:	53                   	push   %rbx
+  802738:	49 89 f4             	mov    %rsi,%r12
+        if (debug) cprintf("[%08x] bad fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    struct Fd *fd = INDEX2FD(fdnum);
+  80273b:	48 63 df             	movslq %edi,%rbx
+  80273e:	48 81 c3 00 00 0d 00 	add    $0xd0000,%rbx
+  802745:	48 c1 e3 0c          	shl    $0xc,%rbx
+
+    if (!(get_prot(fd) & PROT_R)) {
+  802749:	48 89 df             	mov    %rbx,%rdi
+  80274c:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  802753:	00 00 00 
+  802756:	ff d0                	call   *%rax
+  802758:	a8 04                	test   $0x4,%al
+  80275a:	74 14                	je     802770 <fd_lookup+0x44>
+        if (debug) cprintf("[%08x] closed fd %d\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    *fd_store = fd;
+  80275c:	49 89 1c 24          	mov    %rbx,(%r12)
+    return 0;
+  802760:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802765:	5b                   	pop    %rbx
+  802766:	41 5c                	pop    %r12
+  802768:	5d                   	pop    %rbp
+  802769:	c3                   	ret
+        return -E_INVAL;
+  80276a:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+}
+  80276f:	c3                   	ret
+        return -E_INVAL;
+  802770:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802775:	eb ee                	jmp    802765 <fd_lookup+0x39>
+
+0000000000802777 <dev_lookup>:
+        &devpipe,
+        &devcons,
+        NULL};
+
+int
+dev_lookup(int dev_id, struct Dev **dev) {
+  802777:	55                   	push   %rbp
+  802778:	48 89 e5             	mov    %rsp,%rbp
+  80277b:	41 54                	push   %r12
+  80277d:	53                   	push   %rbx
+  80277e:	49 89 f4             	mov    %rsi,%r12
+    for (size_t i = 0; devtab[i]; i++) {
+  802781:	48 b8 c0 6b 80 00 00 	movabs $0x806bc0,%rax
+  802788:	00 00 00 
+  80278b:	48 bb 60 70 80 00 00 	movabs $0x807060,%rbx
+  802792:	00 00 00 
+        if (devtab[i]->dev_id == dev_id) {
+  802795:	39 3b                	cmp    %edi,(%rbx)
+  802797:	74 47                	je     8027e0 <dev_lookup+0x69>
+    for (size_t i = 0; devtab[i]; i++) {
+  802799:	48 83 c0 08          	add    $0x8,%rax
+  80279d:	48 8b 18             	mov    (%rax),%rbx
+  8027a0:	48 85 db             	test   %rbx,%rbx
+  8027a3:	75 f0                	jne    802795 <dev_lookup+0x1e>
+            *dev = devtab[i];
+            return 0;
+        }
+    }
+    cprintf("[%08x] unknown device type %d\n", thisenv->env_id, dev_id);
+  8027a5:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  8027ac:	00 00 00 
+  8027af:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  8027b5:	89 fa                	mov    %edi,%edx
+  8027b7:	48 bf 40 6b 80 00 00 	movabs $0x806b40,%rdi
+  8027be:	00 00 00 
+  8027c1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027c6:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  8027cd:	00 00 00 
+  8027d0:	ff d1                	call   *%rcx
+    *dev = 0;
+    return -E_INVAL;
+  8027d2:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+            *dev = devtab[i];
+  8027d7:	49 89 1c 24          	mov    %rbx,(%r12)
+}
+  8027db:	5b                   	pop    %rbx
+  8027dc:	41 5c                	pop    %r12
+  8027de:	5d                   	pop    %rbp
+  8027df:	c3                   	ret
+            return 0;
+  8027e0:	b8 00 00 00 00       	mov    $0x0,%eax
+  8027e5:	eb f0                	jmp    8027d7 <dev_lookup+0x60>
+
+00000000008027e7 <fd_close>:
+fd_close(struct Fd *fd, bool must_exist) {
+  8027e7:	55                   	push   %rbp
+  8027e8:	48 89 e5             	mov    %rsp,%rbp
+  8027eb:	41 55                	push   %r13
+  8027ed:	41 54                	push   %r12
+  8027ef:	53                   	push   %rbx
+  8027f0:	48 83 ec 18          	sub    $0x18,%rsp
+  8027f4:	48 89 fb             	mov    %rdi,%rbx
+  8027f7:	41 89 f4             	mov    %esi,%r12d
+    return ((uintptr_t)fd - FDTABLE) / PAGE_SIZE;
+  8027fa:	48 bf 00 00 00 30 ff 	movabs $0xffffffff30000000,%rdi
+  802801:	ff ff ff 
+  802804:	48 01 df             	add    %rbx,%rdi
+  802807:	48 c1 ef 0c          	shr    $0xc,%rdi
+    if ((res = fd_lookup(fd2num(fd), &fd2)) < 0 || fd != fd2) {
+  80280b:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  80280f:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802816:	00 00 00 
+  802819:	ff d0                	call   *%rax
+  80281b:	41 89 c5             	mov    %eax,%r13d
+  80281e:	85 c0                	test   %eax,%eax
+  802820:	78 06                	js     802828 <fd_close+0x41>
+  802822:	48 39 5d d8          	cmp    %rbx,-0x28(%rbp)
+  802826:	74 1a                	je     802842 <fd_close+0x5b>
+        return (must_exist ? res : 0);
+  802828:	45 84 e4             	test   %r12b,%r12b
+  80282b:	b8 00 00 00 00       	mov    $0x0,%eax
+  802830:	44 0f 44 e8          	cmove  %eax,%r13d
+}
+  802834:	44 89 e8             	mov    %r13d,%eax
+  802837:	48 83 c4 18          	add    $0x18,%rsp
+  80283b:	5b                   	pop    %rbx
+  80283c:	41 5c                	pop    %r12
+  80283e:	41 5d                	pop    %r13
+  802840:	5d                   	pop    %rbp
+  802841:	c3                   	ret
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) >= 0) {
+  802842:	8b 3b                	mov    (%rbx),%edi
+  802844:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802848:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  80284f:	00 00 00 
+  802852:	ff d0                	call   *%rax
+  802854:	41 89 c5             	mov    %eax,%r13d
+  802857:	85 c0                	test   %eax,%eax
+  802859:	78 1b                	js     802876 <fd_close+0x8f>
+        res = dev->dev_close ? (*dev->dev_close)(fd) : 0;
+  80285b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  80285f:	48 8b 40 20          	mov    0x20(%rax),%rax
+  802863:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  802869:	48 85 c0             	test   %rax,%rax
+  80286c:	74 08                	je     802876 <fd_close+0x8f>
+  80286e:	48 89 df             	mov    %rbx,%rdi
+  802871:	ff d0                	call   *%rax
+  802873:	41 89 c5             	mov    %eax,%r13d
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  802876:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80287b:	48 89 de             	mov    %rbx,%rsi
+  80287e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802883:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  80288a:	00 00 00 
+  80288d:	ff d0                	call   *%rax
+    return res;
+  80288f:	eb a3                	jmp    802834 <fd_close+0x4d>
+
+0000000000802891 <close>:
+
+int
+close(int fdnum) {
+  802891:	55                   	push   %rbp
+  802892:	48 89 e5             	mov    %rsp,%rbp
+  802895:	48 83 ec 10          	sub    $0x10,%rsp
+    struct Fd *fd;
+    int res = fd_lookup(fdnum, &fd);
+  802899:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80289d:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8028a4:	00 00 00 
+  8028a7:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8028a9:	85 c0                	test   %eax,%eax
+  8028ab:	78 15                	js     8028c2 <close+0x31>
+
+    return fd_close(fd, 1);
+  8028ad:	be 01 00 00 00       	mov    $0x1,%esi
+  8028b2:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8028b6:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  8028bd:	00 00 00 
+  8028c0:	ff d0                	call   *%rax
+}
+  8028c2:	c9                   	leave
+  8028c3:	c3                   	ret
+
+00000000008028c4 <close_all>:
+
+void
+close_all(void) {
+  8028c4:	55                   	push   %rbp
+  8028c5:	48 89 e5             	mov    %rsp,%rbp
+  8028c8:	41 54                	push   %r12
+  8028ca:	53                   	push   %rbx
+    for (int i = 0; i < MAXFD; i++) close(i);
+  8028cb:	bb 00 00 00 00       	mov    $0x0,%ebx
+  8028d0:	49 bc 91 28 80 00 00 	movabs $0x802891,%r12
+  8028d7:	00 00 00 
+  8028da:	89 df                	mov    %ebx,%edi
+  8028dc:	41 ff d4             	call   *%r12
+  8028df:	83 c3 01             	add    $0x1,%ebx
+  8028e2:	83 fb 20             	cmp    $0x20,%ebx
+  8028e5:	75 f3                	jne    8028da <close_all+0x16>
+}
+  8028e7:	5b                   	pop    %rbx
+  8028e8:	41 5c                	pop    %r12
+  8028ea:	5d                   	pop    %rbp
+  8028eb:	c3                   	ret
+
+00000000008028ec <dup>:
+ * For instance, writing onto either file descriptor will affect the
+ * file and the file offset of the other.
+ * Closes any previously open file descriptor at 'newfdnum'.
+ * This is implemented using virtual memory tricks (of course!). */
+int
+dup(int oldfdnum, int newfdnum) {
+  8028ec:	55                   	push   %rbp
+  8028ed:	48 89 e5             	mov    %rsp,%rbp
+  8028f0:	41 57                	push   %r15
+  8028f2:	41 56                	push   %r14
+  8028f4:	41 55                	push   %r13
+  8028f6:	41 54                	push   %r12
+  8028f8:	53                   	push   %rbx
+  8028f9:	48 83 ec 18          	sub    $0x18,%rsp
+  8028fd:	41 89 f4             	mov    %esi,%r12d
+    struct Fd *oldfd, *newfd;
+
+    int res;
+    if ((res = fd_lookup(oldfdnum, &oldfd)) < 0) return res;
+  802900:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  802904:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  80290b:	00 00 00 
+  80290e:	ff d0                	call   *%rax
+  802910:	89 c3                	mov    %eax,%ebx
+  802912:	85 c0                	test   %eax,%eax
+  802914:	0f 88 b8 00 00 00    	js     8029d2 <dup+0xe6>
+    close(newfdnum);
+  80291a:	44 89 e7             	mov    %r12d,%edi
+  80291d:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  802924:	00 00 00 
+  802927:	ff d0                	call   *%rax
+
+    newfd = INDEX2FD(newfdnum);
+  802929:	4d 63 ec             	movslq %r12d,%r13
+  80292c:	49 81 c5 00 00 0d 00 	add    $0xd0000,%r13
+  802933:	49 c1 e5 0c          	shl    $0xc,%r13
+    char *oldva = fd2data(oldfd);
+  802937:	4c 8b 7d c8          	mov    -0x38(%rbp),%r15
+  80293b:	4c 89 ff             	mov    %r15,%rdi
+  80293e:	49 be b0 26 80 00 00 	movabs $0x8026b0,%r14
+  802945:	00 00 00 
+  802948:	41 ff d6             	call   *%r14
+  80294b:	48 89 c3             	mov    %rax,%rbx
+    char *newva = fd2data(newfd);
+  80294e:	4c 89 ef             	mov    %r13,%rdi
+  802951:	41 ff d6             	call   *%r14
+  802954:	49 89 c6             	mov    %rax,%r14
+
+    int prot = get_prot(oldva);
+  802957:	48 89 df             	mov    %rbx,%rdi
+  80295a:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  802961:	00 00 00 
+  802964:	ff d0                	call   *%rax
+    if (prot & PROT_R) {
+  802966:	a8 04                	test   $0x4,%al
+  802968:	74 2b                	je     802995 <dup+0xa9>
+        if ((res = sys_map_region(0, oldva, 0, newva, PAGE_SIZE, prot)) < 0) goto err;
+  80296a:	41 89 c1             	mov    %eax,%r9d
+  80296d:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  802973:	4c 89 f1             	mov    %r14,%rcx
+  802976:	ba 00 00 00 00       	mov    $0x0,%edx
+  80297b:	48 89 de             	mov    %rbx,%rsi
+  80297e:	bf 00 00 00 00       	mov    $0x0,%edi
+  802983:	48 b8 27 20 80 00 00 	movabs $0x802027,%rax
+  80298a:	00 00 00 
+  80298d:	ff d0                	call   *%rax
+  80298f:	89 c3                	mov    %eax,%ebx
+  802991:	85 c0                	test   %eax,%eax
+  802993:	78 4e                	js     8029e3 <dup+0xf7>
+    }
+    prot = get_prot(oldfd);
+  802995:	4c 89 ff             	mov    %r15,%rdi
+  802998:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  80299f:	00 00 00 
+  8029a2:	ff d0                	call   *%rax
+  8029a4:	41 89 c1             	mov    %eax,%r9d
+    if ((res = sys_map_region(0, oldfd, 0, newfd, PAGE_SIZE, prot)) < 0) goto err;
+  8029a7:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8029ad:	4c 89 e9             	mov    %r13,%rcx
+  8029b0:	ba 00 00 00 00       	mov    $0x0,%edx
+  8029b5:	4c 89 fe             	mov    %r15,%rsi
+  8029b8:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029bd:	48 b8 27 20 80 00 00 	movabs $0x802027,%rax
+  8029c4:	00 00 00 
+  8029c7:	ff d0                	call   *%rax
+  8029c9:	89 c3                	mov    %eax,%ebx
+  8029cb:	85 c0                	test   %eax,%eax
+  8029cd:	78 14                	js     8029e3 <dup+0xf7>
+
+    return newfdnum;
+  8029cf:	44 89 e3             	mov    %r12d,%ebx
+
+err:
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+    sys_unmap_region(0, newva, PAGE_SIZE);
+    return res;
+}
+  8029d2:	89 d8                	mov    %ebx,%eax
+  8029d4:	48 83 c4 18          	add    $0x18,%rsp
+  8029d8:	5b                   	pop    %rbx
+  8029d9:	41 5c                	pop    %r12
+  8029db:	41 5d                	pop    %r13
+  8029dd:	41 5e                	pop    %r14
+  8029df:	41 5f                	pop    %r15
+  8029e1:	5d                   	pop    %rbp
+  8029e2:	c3                   	ret
+    sys_unmap_region(0, newfd, PAGE_SIZE);
+  8029e3:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8029e8:	4c 89 ee             	mov    %r13,%rsi
+  8029eb:	bf 00 00 00 00       	mov    $0x0,%edi
+  8029f0:	49 bc 77 20 80 00 00 	movabs $0x802077,%r12
+  8029f7:	00 00 00 
+  8029fa:	41 ff d4             	call   *%r12
+    sys_unmap_region(0, newva, PAGE_SIZE);
+  8029fd:	ba 00 10 00 00       	mov    $0x1000,%edx
+  802a02:	4c 89 f6             	mov    %r14,%rsi
+  802a05:	bf 00 00 00 00       	mov    $0x0,%edi
+  802a0a:	41 ff d4             	call   *%r12
+    return res;
+  802a0d:	eb c3                	jmp    8029d2 <dup+0xe6>
+
+0000000000802a0f <read>:
+
+ssize_t
+read(int fdnum, void *buf, size_t n) {
+  802a0f:	55                   	push   %rbp
+  802a10:	48 89 e5             	mov    %rsp,%rbp
+  802a13:	41 56                	push   %r14
+  802a15:	41 55                	push   %r13
+  802a17:	41 54                	push   %r12
+  802a19:	53                   	push   %rbx
+  802a1a:	48 83 ec 10          	sub    $0x10,%rsp
+  802a1e:	89 fb                	mov    %edi,%ebx
+  802a20:	49 89 f4             	mov    %rsi,%r12
+  802a23:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a26:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802a2a:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802a31:	00 00 00 
+  802a34:	ff d0                	call   *%rax
+  802a36:	85 c0                	test   %eax,%eax
+  802a38:	78 4c                	js     802a86 <read+0x77>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a3a:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802a3e:	41 8b 3e             	mov    (%r14),%edi
+  802a41:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802a45:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  802a4c:	00 00 00 
+  802a4f:	ff d0                	call   *%rax
+  802a51:	85 c0                	test   %eax,%eax
+  802a53:	78 35                	js     802a8a <read+0x7b>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) {
+  802a55:	41 8b 46 08          	mov    0x8(%r14),%eax
+  802a59:	83 e0 03             	and    $0x3,%eax
+  802a5c:	83 f8 01             	cmp    $0x1,%eax
+  802a5f:	74 2d                	je     802a8e <read+0x7f>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802a61:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802a65:	48 8b 40 10          	mov    0x10(%rax),%rax
+  802a69:	48 85 c0             	test   %rax,%rax
+  802a6c:	74 56                	je     802ac4 <read+0xb5>
+
+    return (*dev->dev_read)(fd, buf, n);
+  802a6e:	4c 89 ea             	mov    %r13,%rdx
+  802a71:	4c 89 e6             	mov    %r12,%rsi
+  802a74:	4c 89 f7             	mov    %r14,%rdi
+  802a77:	ff d0                	call   *%rax
+}
+  802a79:	48 83 c4 10          	add    $0x10,%rsp
+  802a7d:	5b                   	pop    %rbx
+  802a7e:	41 5c                	pop    %r12
+  802a80:	41 5d                	pop    %r13
+  802a82:	41 5e                	pop    %r14
+  802a84:	5d                   	pop    %rbp
+  802a85:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802a86:	48 98                	cltq
+  802a88:	eb ef                	jmp    802a79 <read+0x6a>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802a8a:	48 98                	cltq
+  802a8c:	eb eb                	jmp    802a79 <read+0x6a>
+        cprintf("[%08x] read %d -- bad mode\n", thisenv->env_id, fdnum);
+  802a8e:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802a95:	00 00 00 
+  802a98:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802a9e:	89 da                	mov    %ebx,%edx
+  802aa0:	48 bf 81 6b 80 00 00 	movabs $0x806b81,%rdi
+  802aa7:	00 00 00 
+  802aaa:	b8 00 00 00 00       	mov    $0x0,%eax
+  802aaf:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  802ab6:	00 00 00 
+  802ab9:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802abb:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802ac2:	eb b5                	jmp    802a79 <read+0x6a>
+    if (!dev->dev_read) return -E_NOT_SUPP;
+  802ac4:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802acb:	eb ac                	jmp    802a79 <read+0x6a>
+
+0000000000802acd <readn>:
+
+ssize_t
+readn(int fdnum, void *buf, size_t n) {
+  802acd:	55                   	push   %rbp
+  802ace:	48 89 e5             	mov    %rsp,%rbp
+  802ad1:	41 57                	push   %r15
+  802ad3:	41 56                	push   %r14
+  802ad5:	41 55                	push   %r13
+  802ad7:	41 54                	push   %r12
+  802ad9:	53                   	push   %rbx
+  802ada:	48 83 ec 08          	sub    $0x8,%rsp
+    int inc = 1, res = 0;
+    for (; inc && res < n; res += inc) {
+  802ade:	48 85 d2             	test   %rdx,%rdx
+  802ae1:	74 54                	je     802b37 <readn+0x6a>
+  802ae3:	41 89 fd             	mov    %edi,%r13d
+  802ae6:	49 89 f6             	mov    %rsi,%r14
+  802ae9:	49 89 d4             	mov    %rdx,%r12
+    int inc = 1, res = 0;
+  802aec:	bb 00 00 00 00       	mov    $0x0,%ebx
+    for (; inc && res < n; res += inc) {
+  802af1:	be 00 00 00 00       	mov    $0x0,%esi
+        inc = read(fdnum, (char *)buf + res, n - res);
+  802af6:	49 bf 0f 2a 80 00 00 	movabs $0x802a0f,%r15
+  802afd:	00 00 00 
+  802b00:	4c 89 e2             	mov    %r12,%rdx
+  802b03:	48 29 f2             	sub    %rsi,%rdx
+  802b06:	4c 01 f6             	add    %r14,%rsi
+  802b09:	44 89 ef             	mov    %r13d,%edi
+  802b0c:	41 ff d7             	call   *%r15
+        if (inc < 0) return inc;
+  802b0f:	85 c0                	test   %eax,%eax
+  802b11:	78 20                	js     802b33 <readn+0x66>
+    for (; inc && res < n; res += inc) {
+  802b13:	01 c3                	add    %eax,%ebx
+  802b15:	85 c0                	test   %eax,%eax
+  802b17:	74 08                	je     802b21 <readn+0x54>
+  802b19:	48 63 f3             	movslq %ebx,%rsi
+  802b1c:	4c 39 e6             	cmp    %r12,%rsi
+  802b1f:	72 df                	jb     802b00 <readn+0x33>
+    }
+    return res;
+  802b21:	48 63 c3             	movslq %ebx,%rax
+}
+  802b24:	48 83 c4 08          	add    $0x8,%rsp
+  802b28:	5b                   	pop    %rbx
+  802b29:	41 5c                	pop    %r12
+  802b2b:	41 5d                	pop    %r13
+  802b2d:	41 5e                	pop    %r14
+  802b2f:	41 5f                	pop    %r15
+  802b31:	5d                   	pop    %rbp
+  802b32:	c3                   	ret
+        if (inc < 0) return inc;
+  802b33:	48 98                	cltq
+  802b35:	eb ed                	jmp    802b24 <readn+0x57>
+    int inc = 1, res = 0;
+  802b37:	bb 00 00 00 00       	mov    $0x0,%ebx
+  802b3c:	eb e3                	jmp    802b21 <readn+0x54>
+
+0000000000802b3e <write>:
+
+ssize_t
+write(int fdnum, const void *buf, size_t n) {
+  802b3e:	55                   	push   %rbp
+  802b3f:	48 89 e5             	mov    %rsp,%rbp
+  802b42:	41 56                	push   %r14
+  802b44:	41 55                	push   %r13
+  802b46:	41 54                	push   %r12
+  802b48:	53                   	push   %rbx
+  802b49:	48 83 ec 10          	sub    $0x10,%rsp
+  802b4d:	89 fb                	mov    %edi,%ebx
+  802b4f:	49 89 f4             	mov    %rsi,%r12
+  802b52:	49 89 d5             	mov    %rdx,%r13
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802b55:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802b59:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802b60:	00 00 00 
+  802b63:	ff d0                	call   *%rax
+  802b65:	85 c0                	test   %eax,%eax
+  802b67:	78 47                	js     802bb0 <write+0x72>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802b69:	4c 8b 75 d8          	mov    -0x28(%rbp),%r14
+  802b6d:	41 8b 3e             	mov    (%r14),%edi
+  802b70:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802b74:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  802b7b:	00 00 00 
+  802b7e:	ff d0                	call   *%rax
+  802b80:	85 c0                	test   %eax,%eax
+  802b82:	78 30                	js     802bb4 <write+0x76>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802b84:	41 f6 46 08 03       	testb  $0x3,0x8(%r14)
+  802b89:	74 2d                	je     802bb8 <write+0x7a>
+    if (debug) {
+        cprintf("write %d %p %lu via dev %s\n",
+                fdnum, buf, (unsigned long)n, dev->dev_name);
+    }
+
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802b8b:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802b8f:	48 8b 40 18          	mov    0x18(%rax),%rax
+  802b93:	48 85 c0             	test   %rax,%rax
+  802b96:	74 56                	je     802bee <write+0xb0>
+
+    return (*dev->dev_write)(fd, buf, n);
+  802b98:	4c 89 ea             	mov    %r13,%rdx
+  802b9b:	4c 89 e6             	mov    %r12,%rsi
+  802b9e:	4c 89 f7             	mov    %r14,%rdi
+  802ba1:	ff d0                	call   *%rax
+}
+  802ba3:	48 83 c4 10          	add    $0x10,%rsp
+  802ba7:	5b                   	pop    %rbx
+  802ba8:	41 5c                	pop    %r12
+  802baa:	41 5d                	pop    %r13
+  802bac:	41 5e                	pop    %r14
+  802bae:	5d                   	pop    %rbp
+  802baf:	c3                   	ret
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802bb0:	48 98                	cltq
+  802bb2:	eb ef                	jmp    802ba3 <write+0x65>
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802bb4:	48 98                	cltq
+  802bb6:	eb eb                	jmp    802ba3 <write+0x65>
+        cprintf("[%08x] write %d -- bad mode\n", thisenv->env_id, fdnum);
+  802bb8:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802bbf:	00 00 00 
+  802bc2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+  802bc8:	89 da                	mov    %ebx,%edx
+  802bca:	48 bf 9d 6b 80 00 00 	movabs $0x806b9d,%rdi
+  802bd1:	00 00 00 
+  802bd4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802bd9:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  802be0:	00 00 00 
+  802be3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802be5:	48 c7 c0 fd ff ff ff 	mov    $0xfffffffffffffffd,%rax
+  802bec:	eb b5                	jmp    802ba3 <write+0x65>
+    if (!dev->dev_write) return -E_NOT_SUPP;
+  802bee:	48 c7 c0 ed ff ff ff 	mov    $0xffffffffffffffed,%rax
+  802bf5:	eb ac                	jmp    802ba3 <write+0x65>
+
+0000000000802bf7 <seek>:
+
+int
+seek(int fdnum, off_t offset) {
+  802bf7:	55                   	push   %rbp
+  802bf8:	48 89 e5             	mov    %rsp,%rbp
+  802bfb:	41 54                	push   %r12
+  802bfd:	53                   	push   %rbx
+  802bfe:	48 83 ec 10          	sub    $0x10,%rsp
+  802c02:	89 f3                	mov    %esi,%ebx
+    int res;
+    struct Fd *fd;
+
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c04:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802c08:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802c0f:	00 00 00 
+  802c12:	ff d0                	call   *%rax
+  802c14:	85 c0                	test   %eax,%eax
+  802c16:	78 3e                	js     802c56 <seek+0x5f>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c18:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802c1c:	41 8b 3c 24          	mov    (%r12),%edi
+  802c20:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802c24:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  802c2b:	00 00 00 
+  802c2e:	ff d0                	call   *%rax
+  802c30:	85 c0                	test   %eax,%eax
+  802c32:	78 22                	js     802c56 <seek+0x5f>
+    if (dev->dev_seek && (res = (*dev->dev_seek)(fd, offset)) < 0) return res;
+  802c34:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802c38:	48 8b 40 38          	mov    0x38(%rax),%rax
+  802c3c:	48 85 c0             	test   %rax,%rax
+  802c3f:	74 0b                	je     802c4c <seek+0x55>
+  802c41:	89 de                	mov    %ebx,%esi
+  802c43:	4c 89 e7             	mov    %r12,%rdi
+  802c46:	ff d0                	call   *%rax
+  802c48:	85 c0                	test   %eax,%eax
+  802c4a:	78 0a                	js     802c56 <seek+0x5f>
+
+    fd->fd_offset = offset;
+  802c4c:	41 89 5c 24 04       	mov    %ebx,0x4(%r12)
+    return 0;
+  802c51:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  802c56:	48 83 c4 10          	add    $0x10,%rsp
+  802c5a:	5b                   	pop    %rbx
+  802c5b:	41 5c                	pop    %r12
+  802c5d:	5d                   	pop    %rbp
+  802c5e:	c3                   	ret
+
+0000000000802c5f <ftruncate>:
+
+int
+ftruncate(int fdnum, off_t newsize) {
+  802c5f:	55                   	push   %rbp
+  802c60:	48 89 e5             	mov    %rsp,%rbp
+  802c63:	41 55                	push   %r13
+  802c65:	41 54                	push   %r12
+  802c67:	53                   	push   %rbx
+  802c68:	48 83 ec 18          	sub    $0x18,%rsp
+  802c6c:	89 fb                	mov    %edi,%ebx
+  802c6e:	41 89 f4             	mov    %esi,%r12d
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802c71:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  802c75:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802c7c:	00 00 00 
+  802c7f:	ff d0                	call   *%rax
+  802c81:	85 c0                	test   %eax,%eax
+  802c83:	78 38                	js     802cbd <ftruncate+0x5e>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802c85:	4c 8b 6d d8          	mov    -0x28(%rbp),%r13
+  802c89:	41 8b 7d 00          	mov    0x0(%r13),%edi
+  802c8d:	48 8d 75 d0          	lea    -0x30(%rbp),%rsi
+  802c91:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  802c98:	00 00 00 
+  802c9b:	ff d0                	call   *%rax
+  802c9d:	85 c0                	test   %eax,%eax
+  802c9f:	78 1c                	js     802cbd <ftruncate+0x5e>
+
+    if ((fd->fd_omode & O_ACCMODE) == O_RDONLY) {
+  802ca1:	41 f6 45 08 03       	testb  $0x3,0x8(%r13)
+  802ca6:	74 20                	je     802cc8 <ftruncate+0x69>
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+                thisenv->env_id, fdnum);
+        return -E_INVAL;
+    }
+
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802ca8:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  802cac:	48 8b 40 30          	mov    0x30(%rax),%rax
+  802cb0:	48 85 c0             	test   %rax,%rax
+  802cb3:	74 47                	je     802cfc <ftruncate+0x9d>
+
+    return (*dev->dev_trunc)(fd, newsize);
+  802cb5:	44 89 e6             	mov    %r12d,%esi
+  802cb8:	4c 89 ef             	mov    %r13,%rdi
+  802cbb:	ff d0                	call   *%rax
+}
+  802cbd:	48 83 c4 18          	add    $0x18,%rsp
+  802cc1:	5b                   	pop    %rbx
+  802cc2:	41 5c                	pop    %r12
+  802cc4:	41 5d                	pop    %r13
+  802cc6:	5d                   	pop    %rbp
+  802cc7:	c3                   	ret
+                thisenv->env_id, fdnum);
+  802cc8:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802ccf:	00 00 00 
+  802cd2:	8b b0 c8 00 00 00    	mov    0xc8(%rax),%esi
+        cprintf("[%08x] ftruncate %d -- bad mode\n",
+  802cd8:	89 da                	mov    %ebx,%edx
+  802cda:	48 bf 60 6b 80 00 00 	movabs $0x806b60,%rdi
+  802ce1:	00 00 00 
+  802ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  802ce9:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  802cf0:	00 00 00 
+  802cf3:	ff d1                	call   *%rcx
+        return -E_INVAL;
+  802cf5:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  802cfa:	eb c1                	jmp    802cbd <ftruncate+0x5e>
+    if (!dev->dev_trunc) return -E_NOT_SUPP;
+  802cfc:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d01:	eb ba                	jmp    802cbd <ftruncate+0x5e>
+
+0000000000802d03 <fstat>:
+
+int
+fstat(int fdnum, struct Stat *stat) {
+  802d03:	55                   	push   %rbp
+  802d04:	48 89 e5             	mov    %rsp,%rbp
+  802d07:	41 54                	push   %r12
+  802d09:	53                   	push   %rbx
+  802d0a:	48 83 ec 10          	sub    $0x10,%rsp
+  802d0e:	48 89 f3             	mov    %rsi,%rbx
+    int res;
+
+    struct Fd *fd;
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  802d11:	48 8d 75 e8          	lea    -0x18(%rbp),%rsi
+  802d15:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  802d1c:	00 00 00 
+  802d1f:	ff d0                	call   *%rax
+  802d21:	85 c0                	test   %eax,%eax
+  802d23:	78 4e                	js     802d73 <fstat+0x70>
+
+    struct Dev *dev;
+    if ((res = dev_lookup(fd->fd_dev_id, &dev)) < 0) return res;
+  802d25:	4c 8b 65 e8          	mov    -0x18(%rbp),%r12
+  802d29:	41 8b 3c 24          	mov    (%r12),%edi
+  802d2d:	48 8d 75 e0          	lea    -0x20(%rbp),%rsi
+  802d31:	48 b8 77 27 80 00 00 	movabs $0x802777,%rax
+  802d38:	00 00 00 
+  802d3b:	ff d0                	call   *%rax
+  802d3d:	85 c0                	test   %eax,%eax
+  802d3f:	78 32                	js     802d73 <fstat+0x70>
+
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d41:	48 8b 45 e0          	mov    -0x20(%rbp),%rax
+  802d45:	48 83 78 28 00       	cmpq   $0x0,0x28(%rax)
+  802d4a:	74 30                	je     802d7c <fstat+0x79>
+
+    stat->st_name[0] = 0;
+  802d4c:	c6 03 00             	movb   $0x0,(%rbx)
+    stat->st_size = 0;
+  802d4f:	c7 83 80 00 00 00 00 	movl   $0x0,0x80(%rbx)
+  802d56:	00 00 00 
+    stat->st_isdir = 0;
+  802d59:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  802d60:	00 00 00 
+    stat->st_dev = dev;
+  802d63:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+
+    return (*dev->dev_stat)(fd, stat);
+  802d6a:	48 89 de             	mov    %rbx,%rsi
+  802d6d:	4c 89 e7             	mov    %r12,%rdi
+  802d70:	ff 50 28             	call   *0x28(%rax)
+}
+  802d73:	48 83 c4 10          	add    $0x10,%rsp
+  802d77:	5b                   	pop    %rbx
+  802d78:	41 5c                	pop    %r12
+  802d7a:	5d                   	pop    %rbp
+  802d7b:	c3                   	ret
+    if (!dev->dev_stat) return -E_NOT_SUPP;
+  802d7c:	b8 ed ff ff ff       	mov    $0xffffffed,%eax
+  802d81:	eb f0                	jmp    802d73 <fstat+0x70>
+
+0000000000802d83 <stat>:
+
+int
+stat(const char *path, struct Stat *stat) {
+  802d83:	55                   	push   %rbp
+  802d84:	48 89 e5             	mov    %rsp,%rbp
+  802d87:	41 54                	push   %r12
+  802d89:	53                   	push   %rbx
+  802d8a:	49 89 f4             	mov    %rsi,%r12
+    int fd = open(path, O_RDONLY);
+  802d8d:	be 00 00 00 00       	mov    $0x0,%esi
+  802d92:	48 b8 f1 3e 80 00 00 	movabs $0x803ef1,%rax
+  802d99:	00 00 00 
+  802d9c:	ff d0                	call   *%rax
+  802d9e:	89 c3                	mov    %eax,%ebx
+    if (fd < 0) return fd;
+  802da0:	85 c0                	test   %eax,%eax
+  802da2:	78 25                	js     802dc9 <stat+0x46>
+
+    int res = fstat(fd, stat);
+  802da4:	4c 89 e6             	mov    %r12,%rsi
+  802da7:	89 c7                	mov    %eax,%edi
+  802da9:	48 b8 03 2d 80 00 00 	movabs $0x802d03,%rax
+  802db0:	00 00 00 
+  802db3:	ff d0                	call   *%rax
+  802db5:	41 89 c4             	mov    %eax,%r12d
+    close(fd);
+  802db8:	89 df                	mov    %ebx,%edi
+  802dba:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  802dc1:	00 00 00 
+  802dc4:	ff d0                	call   *%rax
+
+    return res;
+  802dc6:	44 89 e3             	mov    %r12d,%ebx
+}
+  802dc9:	89 d8                	mov    %ebx,%eax
+  802dcb:	5b                   	pop    %rbx
+  802dcc:	41 5c                	pop    %r12
+  802dce:	5d                   	pop    %rbp
+  802dcf:	c3                   	ret
+
+0000000000802dd0 <fsenv>:
+
+static envid_t
+fsenv(void) {
+    static envid_t envid;
+
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802dd0:	48 b8 08 00 82 00 00 	movabs $0x820008,%rax
+  802dd7:	00 00 00 
+  802dda:	83 38 00             	cmpl   $0x0,(%rax)
+  802ddd:	74 0a                	je     802de9 <fsenv+0x19>
+    return envid;
+}
+  802ddf:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802de6:	00 00 
+  802de8:	c3                   	ret
+fsenv(void) {
+  802de9:	55                   	push   %rbp
+  802dea:	48 89 e5             	mov    %rsp,%rbp
+    if (!envid) envid = ipc_find_env(ENV_TYPE_FS);
+  802ded:	bf 03 00 00 00       	mov    $0x3,%edi
+  802df2:	48 b8 7f 63 80 00 00 	movabs $0x80637f,%rax
+  802df9:	00 00 00 
+  802dfc:	ff d0                	call   *%rax
+  802dfe:	a3 08 00 82 00 00 00 	movabs %eax,0x820008
+  802e05:	00 00 
+}
+  802e07:	a1 08 00 82 00 00 00 	movabs 0x820008,%eax
+  802e0e:	00 00 
+  802e10:	5d                   	pop    %rbp
+  802e11:	c3                   	ret
+
+0000000000802e12 <fschan_setup>:
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+}
+
+/* Map a new channel and hand it to the file server */
+static int
+fschan_setup(void) {
+  802e12:	55                   	push   %rbp
+  802e13:	48 89 e5             	mov    %rsp,%rbp
+  802e16:	41 54                	push   %r12
+  802e18:	53                   	push   %rbx
+    int res;
+
+    /* Drop the channel inherited from the parent, if any */
+    sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802e19:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802e1e:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802e23:	48 89 de             	mov    %rbx,%rsi
+  802e26:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e2b:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802e32:	00 00 00 
+  802e35:	ff d0                	call   *%rax
+    fschan_owner = 0;
+  802e37:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  802e3e:	00 00 00 
+  802e41:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+
+    res = sys_alloc_region(0, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802e47:	b9 46 00 00 00       	mov    $0x46,%ecx
+  802e4c:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802e51:	48 89 de             	mov    %rbx,%rsi
+  802e54:	bf 00 00 00 00       	mov    $0x0,%edi
+  802e59:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  802e60:	00 00 00 
+  802e63:	ff d0                	call   *%rax
+  802e65:	89 c3                	mov    %eax,%ebx
+    if (res < 0) return res;
+  802e67:	85 c0                	test   %eax,%eax
+  802e69:	0f 88 a2 00 00 00    	js     802f11 <fschan_setup+0xff>
+
+    FSCHAN->fc_client = thisenv->env_id;
+  802e6f:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802e76:	00 00 00 
+  802e79:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802e7f:	bb 00 00 f0 cf       	mov    $0xcff00000,%ebx
+  802e84:	89 03                	mov    %eax,(%rbx)
+    chan_init(&FSCHAN->fc_req);
+  802e86:	bf 40 00 f0 cf       	mov    $0xcff00040,%edi
+  802e8b:	49 bc 0f 5e 80 00 00 	movabs $0x805e0f,%r12
+  802e92:	00 00 00 
+  802e95:	41 ff d4             	call   *%r12
+    chan_init(&FSCHAN->fc_resp);
+  802e98:	bf c0 20 f0 cf       	mov    $0xcff020c0,%edi
+  802e9d:	41 ff d4             	call   *%r12
+
+    ipc_send(fsenv(), FSREQ_CHANNEL, FSCHAN, FSCHAN_SIZE, PROT_RW | PROT_SHARE);
+  802ea0:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  802ea7:	00 00 00 
+  802eaa:	ff d0                	call   *%rax
+  802eac:	89 c7                	mov    %eax,%edi
+  802eae:	41 b8 46 00 00 00    	mov    $0x46,%r8d
+  802eb4:	b9 00 50 00 00       	mov    $0x5000,%ecx
+  802eb9:	48 89 da             	mov    %rbx,%rdx
+  802ebc:	be 09 00 00 00       	mov    $0x9,%esi
+  802ec1:	48 b8 29 63 80 00 00 	movabs $0x806329,%rax
+  802ec8:	00 00 00 
+  802ecb:	ff d0                	call   *%rax
+    if ((res = ipc_recv(NULL, NULL, NULL, NULL)) < 0) {
+  802ecd:	b9 00 00 00 00       	mov    $0x0,%ecx
+  802ed2:	ba 00 00 00 00       	mov    $0x0,%edx
+  802ed7:	be 00 00 00 00       	mov    $0x0,%esi
+  802edc:	bf 00 00 00 00       	mov    $0x0,%edi
+  802ee1:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  802ee8:	00 00 00 
+  802eeb:	ff d0                	call   *%rax
+  802eed:	89 c3                	mov    %eax,%ebx
+  802eef:	85 c0                	test   %eax,%eax
+  802ef1:	78 25                	js     802f18 <fschan_setup+0x106>
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+        return res;
+    }
+
+    fschan_owner = thisenv->env_id;
+  802ef3:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802efa:	00 00 00 
+  802efd:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  802f03:	a3 00 26 82 00 00 00 	movabs %eax,0x822600
+  802f0a:	00 00 
+    return 0;
+  802f0c:	bb 00 00 00 00       	mov    $0x0,%ebx
+}
+  802f11:	89 d8                	mov    %ebx,%eax
+  802f13:	5b                   	pop    %rbx
+  802f14:	41 5c                	pop    %r12
+  802f16:	5d                   	pop    %rbp
+  802f17:	c3                   	ret
+        sys_unmap_region(0, FSCHAN, FSCHAN_SIZE);
+  802f18:	ba 00 50 00 00       	mov    $0x5000,%edx
+  802f1d:	be 00 00 f0 cf       	mov    $0xcff00000,%esi
+  802f22:	bf 00 00 00 00       	mov    $0x0,%edi
+  802f27:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  802f2e:	00 00 00 
+  802f31:	ff d0                	call   *%rax
+        return res;
+  802f33:	eb dc                	jmp    802f11 <fschan_setup+0xff>
+
+0000000000802f35 <fschan>:
+
+/* Channel to use for the next request, NULL for IPC */
+static struct FsChannel *
+fschan(void) {
+    if (!fschan_enabled) return NULL;
+  802f35:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f3c:	00 00 00 
+  802f3f:	80 38 00             	cmpb   $0x0,(%rax)
+  802f42:	74 55                	je     802f99 <fschan+0x64>
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802f44:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  802f4b:	00 00 00 
+  802f4e:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+        fschan_enabled = 0;
+        return NULL;
+    }
+    return FSCHAN;
+  802f54:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802f59:	48 ba 00 26 82 00 00 	movabs $0x822600,%rdx
+  802f60:	00 00 00 
+  802f63:	3b 0a                	cmp    (%rdx),%ecx
+  802f65:	75 01                	jne    802f68 <fschan+0x33>
+}
+  802f67:	c3                   	ret
+fschan(void) {
+  802f68:	55                   	push   %rbp
+  802f69:	48 89 e5             	mov    %rsp,%rbp
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802f6c:	48 b8 12 2e 80 00 00 	movabs $0x802e12,%rax
+  802f73:	00 00 00 
+  802f76:	ff d0                	call   *%rax
+  802f78:	89 c2                	mov    %eax,%edx
+    return FSCHAN;
+  802f7a:	b8 00 00 f0 cf       	mov    $0xcff00000,%eax
+    if (fschan_owner != thisenv->env_id && fschan_setup() < 0) {
+  802f7f:	85 d2                	test   %edx,%edx
+  802f81:	78 02                	js     802f85 <fschan+0x50>
+}
+  802f83:	5d                   	pop    %rbp
+  802f84:	c3                   	ret
+        fschan_enabled = 0;
+  802f85:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  802f8c:	00 00 00 
+  802f8f:	c6 00 00             	movb   $0x0,(%rax)
+        return NULL;
+  802f92:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f97:	eb ea                	jmp    802f83 <fschan+0x4e>
+    if (!fschan_enabled) return NULL;
+  802f99:	b8 00 00 00 00       	mov    $0x0,%eax
+  802f9e:	c3                   	ret
+
+0000000000802f9f <fbuf>:
+fbuf(struct Fd *fd) {
+  802f9f:	55                   	push   %rbp
+  802fa0:	48 89 e5             	mov    %rsp,%rbp
+    uint64_t i = fd2num(fd);
+  802fa3:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  802faa:	00 00 00 
+  802fad:	ff d0                	call   *%rax
+    return i < MAXFD ? &fbufs[i] : NULL;
+  802faf:	ba 00 00 00 00       	mov    $0x0,%edx
+  802fb4:	48 83 f8 1f          	cmp    $0x1f,%rax
+  802fb8:	77 12                	ja     802fcc <fbuf+0x2d>
+  802fba:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  802fbe:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  802fc5:	00 00 00 
+  802fc8:	48 8d 14 d0          	lea    (%rax,%rdx,8),%rdx
+}
+  802fcc:	48 89 d0             	mov    %rdx,%rax
+  802fcf:	5d                   	pop    %rbp
+  802fd0:	c3                   	ret
+
+0000000000802fd1 <fschan_publish>:
+    return res;
+}
+
+/* Make the last prepared request visible to the server */
+static void
+fschan_publish(struct FsChannel *ch) {
+  802fd1:	55                   	push   %rbp
+  802fd2:	48 89 e5             	mov    %rsp,%rbp
+    if (chan_publish(&ch->fc_req))
+  802fd5:	48 83 c7 40          	add    $0x40,%rdi
+  802fd9:	48 b8 49 5e 80 00 00 	movabs $0x805e49,%rax
+  802fe0:	00 00 00 
+  802fe3:	ff d0                	call   *%rax
+  802fe5:	84 c0                	test   %al,%al
+  802fe7:	75 02                	jne    802feb <fschan_publish+0x1a>
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+}
+  802fe9:	5d                   	pop    %rbp
+  802fea:	c3                   	ret
+        ipc_send(fsenv(), FSREQ_DOORBELL, NULL, 0, 0);
+  802feb:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  802ff2:	00 00 00 
+  802ff5:	ff d0                	call   *%rax
+  802ff7:	89 c7                	mov    %eax,%edi
+  802ff9:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  802fff:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803004:	ba 00 00 00 00       	mov    $0x0,%edx
+  803009:	be 0a 00 00 00       	mov    $0xa,%esi
+  80300e:	48 b8 29 63 80 00 00 	movabs $0x806329,%rax
+  803015:	00 00 00 
+  803018:	ff d0                	call   *%rax
+}
+  80301a:	eb cd                	jmp    802fe9 <fschan_publish+0x18>
+
+000000000080301c <fschan_rw>:
+ * requests in flight. The pieces form a chain: the server refuses
+ * the ones queued after a piece that fails or comes back short, so
+ * the result is the same as with one request at a time and no data
+ * lands past the failed piece */
+static ssize_t
+fschan_rw(struct FsChannel *ch, struct Fd *fd, unsigned type, void *buf, size_t n, off_t offset) {
+  80301c:	55                   	push   %rbp
+  80301d:	48 89 e5             	mov    %rsp,%rbp
+  803020:	41 57                	push   %r15
+  803022:	41 56                	push   %r14
+  803024:	41 55                	push   %r13
+  803026:	41 54                	push   %r12
+  803028:	53                   	push   %rbx
+  803029:	48 83 ec 48          	sub    $0x48,%rsp
+  80302d:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  803031:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  803035:	89 55 c4             	mov    %edx,-0x3c(%rbp)
+  803038:	48 89 4d b0          	mov    %rcx,-0x50(%rbp)
+  80303c:	4d 89 c7             	mov    %r8,%r15
+    size_t queued = 0, done = 0;
+    unsigned inflight = 0;
+    bool stop = 0;
+    int err = 0;
+
+    if (!++chain) chain++;
+  80303f:	48 ba 04 00 82 00 00 	movabs $0x820004,%rdx
+  803046:	00 00 00 
+  803049:	8b 02                	mov    (%rdx),%eax
+  80304b:	83 c0 01             	add    $0x1,%eax
+  80304e:	b9 01 00 00 00       	mov    $0x1,%ecx
+  803053:	0f 44 c1             	cmove  %ecx,%eax
+  803056:	89 02                	mov    %eax,(%rdx)
+
+    while ((!stop && queued < n) || inflight) {
+  803058:	4d 85 c0             	test   %r8,%r8
+  80305b:	74 2c                	je     803089 <fschan_rw+0x6d>
+  80305d:	45 89 ce             	mov    %r9d,%r14d
+  803060:	c7 45 9c 00 00 00 00 	movl   $0x0,-0x64(%rbp)
+  803067:	c6 45 c3 00          	movb   $0x0,-0x3d(%rbp)
+  80306b:	41 bd 00 00 00 00    	mov    $0x0,%r13d
+  803071:	48 c7 45 a0 00 00 00 	movq   $0x0,-0x60(%rbp)
+  803078:	00 
+  803079:	41 bc 00 00 00 00    	mov    $0x0,%r12d
+  80307f:	b8 01 00 00 00       	mov    $0x1,%eax
+  803084:	e9 41 01 00 00       	jmp    8031ca <fschan_rw+0x1ae>
+  803089:	4c 89 45 a0          	mov    %r8,-0x60(%rbp)
+            }
+        }
+        chan_release(&ch->fc_resp);
+    }
+
+    return done || !err ? done : err;
+  80308d:	48 8b 45 a0          	mov    -0x60(%rbp),%rax
+  803091:	e9 9c 01 00 00       	jmp    803232 <fschan_rw+0x216>
+                msg->fm_req.write.req_fileid = fd->fd_file.id;
+  803096:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  80309a:	8b 49 0c             	mov    0xc(%rcx),%ecx
+  80309d:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.write.req_offset = pos;
+  8030a0:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.write.req_n = blk;
+  8030a3:	48 89 58 18          	mov    %rbx,0x18(%rax)
+                memcpy(msg->fm_data, buf + queued, blk);
+  8030a7:	48 8b 7d b0          	mov    -0x50(%rbp),%rdi
+  8030ab:	4a 8d 34 27          	lea    (%rdi,%r12,1),%rsi
+  8030af:	48 8d 78 20          	lea    0x20(%rax),%rdi
+  8030b3:	48 89 da             	mov    %rbx,%rdx
+  8030b6:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8030bd:	00 00 00 
+  8030c0:	ff d0                	call   *%rax
+            fschan_publish(ch);
+  8030c2:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8030c6:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  8030cd:	00 00 00 
+  8030d0:	ff d0                	call   *%rax
+            queued += blk;
+  8030d2:	49 01 dc             	add    %rbx,%r12
+            inflight++;
+  8030d5:	41 83 c5 01          	add    $0x1,%r13d
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8030d9:	4d 39 fc             	cmp    %r15,%r12
+  8030dc:	73 6b                	jae    803149 <fschan_rw+0x12d>
+  8030de:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8030e2:	77 65                	ja     803149 <fschan_rw+0x12d>
+            struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  8030e4:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8030e8:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  8030ec:	48 b8 24 5e 80 00 00 	movabs $0x805e24,%rax
+  8030f3:	00 00 00 
+  8030f6:	ff d0                	call   *%rax
+            size_t blk = MIN(n - queued, FSCHAN_DATA_SIZE);
+  8030f8:	4c 89 fb             	mov    %r15,%rbx
+  8030fb:	4c 29 e3             	sub    %r12,%rbx
+  8030fe:	ba e0 01 00 00       	mov    $0x1e0,%edx
+  803103:	48 39 d3             	cmp    %rdx,%rbx
+  803106:	48 0f 47 da          	cmova  %rdx,%rbx
+            off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)queued;
+  80310a:	43 8d 14 26          	lea    (%r14,%r12,1),%edx
+  80310e:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803112:	41 0f 44 d6          	cmove  %r14d,%edx
+            msg->fm_type = type;
+  803116:	8b 75 c4             	mov    -0x3c(%rbp),%esi
+  803119:	89 30                	mov    %esi,(%rax)
+            msg->fm_chain = chain;
+  80311b:	48 b9 04 00 82 00 00 	movabs $0x820004,%rcx
+  803122:	00 00 00 
+  803125:	8b 09                	mov    (%rcx),%ecx
+  803127:	89 48 08             	mov    %ecx,0x8(%rax)
+            if (type == FSREQ_READ) {
+  80312a:	83 fe 03             	cmp    $0x3,%esi
+  80312d:	0f 85 63 ff ff ff    	jne    803096 <fschan_rw+0x7a>
+                msg->fm_req.read.req_fileid = fd->fd_file.id;
+  803133:	48 8b 7d b8          	mov    -0x48(%rbp),%rdi
+  803137:	8b 4f 0c             	mov    0xc(%rdi),%ecx
+  80313a:	89 48 10             	mov    %ecx,0x10(%rax)
+                msg->fm_req.read.req_offset = pos;
+  80313d:	89 50 14             	mov    %edx,0x14(%rax)
+                msg->fm_req.read.req_n = blk;
+  803140:	48 89 58 18          	mov    %rbx,0x18(%rax)
+  803144:	e9 79 ff ff ff       	jmp    8030c2 <fschan_rw+0xa6>
+    chan_wait(&ch->fc_resp);
+  803149:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  80314d:	48 8d 98 c0 20 00 00 	lea    0x20c0(%rax),%rbx
+  803154:	48 89 df             	mov    %rbx,%rdi
+  803157:	48 b8 e7 5e 80 00 00 	movabs $0x805ee7,%rax
+  80315e:	00 00 00 
+  803161:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  803163:	48 89 df             	mov    %rbx,%rdi
+  803166:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  80316d:	00 00 00 
+  803170:	ff d0                	call   *%rax
+  803172:	48 89 45 a8          	mov    %rax,-0x58(%rbp)
+        inflight--;
+  803176:	41 83 ed 01          	sub    $0x1,%r13d
+        if (!stop) {
+  80317a:	80 7d c3 00          	cmpb   $0x0,-0x3d(%rbp)
+  80317e:	75 25                	jne    8031a5 <fschan_rw+0x189>
+            if (msg->fm_res < 0) {
+  803180:	8b 40 04             	mov    0x4(%rax),%eax
+  803183:	85 c0                	test   %eax,%eax
+  803185:	0f 88 86 00 00 00    	js     803211 <fschan_rw+0x1f5>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  80318b:	83 7d c4 03          	cmpl   $0x3,-0x3c(%rbp)
+  80318f:	74 5b                	je     8031ec <fschan_rw+0x1d0>
+                done += msg->fm_res;
+  803191:	48 8b 4d a8          	mov    -0x58(%rbp),%rcx
+  803195:	48 63 41 04          	movslq 0x4(%rcx),%rax
+  803199:	48 01 45 a0          	add    %rax,-0x60(%rbp)
+                if (msg->fm_res < msg->fm_req.read.req_n) stop = 1;
+  80319d:	48 3b 41 18          	cmp    0x18(%rcx),%rax
+  8031a1:	0f 92 45 c3          	setb   -0x3d(%rbp)
+        chan_release(&ch->fc_resp);
+  8031a5:	48 89 df             	mov    %rbx,%rdi
+  8031a8:	48 b8 9c 5e 80 00 00 	movabs $0x805e9c,%rax
+  8031af:	00 00 00 
+  8031b2:	ff d0                	call   *%rax
+    while ((!stop && queued < n) || inflight) {
+  8031b4:	0f b6 45 c3          	movzbl -0x3d(%rbp),%eax
+  8031b8:	83 f0 01             	xor    $0x1,%eax
+  8031bb:	4d 39 fc             	cmp    %r15,%r12
+  8031be:	0f 92 c2             	setb   %dl
+  8031c1:	84 c2                	test   %al,%dl
+  8031c3:	75 05                	jne    8031ca <fschan_rw+0x1ae>
+  8031c5:	45 85 ed             	test   %r13d,%r13d
+  8031c8:	74 50                	je     80321a <fschan_rw+0x1fe>
+        while (!stop && queued < n && inflight < CHAN_NSLOTS) {
+  8031ca:	4d 39 fc             	cmp    %r15,%r12
+  8031cd:	0f 92 c1             	setb   %cl
+  8031d0:	41 83 fd 0f          	cmp    $0xf,%r13d
+  8031d4:	0f 96 c2             	setbe  %dl
+  8031d7:	84 d1                	test   %dl,%cl
+  8031d9:	0f 84 6a ff ff ff    	je     803149 <fschan_rw+0x12d>
+  8031df:	84 c0                	test   %al,%al
+  8031e1:	0f 85 fd fe ff ff    	jne    8030e4 <fschan_rw+0xc8>
+  8031e7:	e9 5d ff ff ff       	jmp    803149 <fschan_rw+0x12d>
+                if (type == FSREQ_READ) memcpy(buf + done, msg->fm_data, msg->fm_res);
+  8031ec:	48 63 d0             	movslq %eax,%rdx
+  8031ef:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  8031f3:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8031f7:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  8031fb:	48 8b 4d a0          	mov    -0x60(%rbp),%rcx
+  8031ff:	48 8d 3c 08          	lea    (%rax,%rcx,1),%rdi
+  803203:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  80320a:	00 00 00 
+  80320d:	ff d0                	call   *%rax
+  80320f:	eb 80                	jmp    803191 <fschan_rw+0x175>
+                err = msg->fm_res;
+  803211:	89 45 9c             	mov    %eax,-0x64(%rbp)
+                stop = 1;
+  803214:	c6 45 c3 01          	movb   $0x1,-0x3d(%rbp)
+  803218:	eb 8b                	jmp    8031a5 <fschan_rw+0x189>
+    return done || !err ? done : err;
+  80321a:	48 83 7d a0 00       	cmpq   $0x0,-0x60(%rbp)
+  80321f:	0f 85 68 fe ff ff    	jne    80308d <fschan_rw+0x71>
+  803225:	8b 45 9c             	mov    -0x64(%rbp),%eax
+  803228:	85 c0                	test   %eax,%eax
+  80322a:	0f 84 5d fe ff ff    	je     80308d <fschan_rw+0x71>
+  803230:	48 98                	cltq
+}
+  803232:	48 83 c4 48          	add    $0x48,%rsp
+  803236:	5b                   	pop    %rbx
+  803237:	41 5c                	pop    %r12
+  803239:	41 5d                	pop    %r13
+  80323b:	41 5e                	pop    %r14
+  80323d:	41 5f                	pop    %r15
+  80323f:	5d                   	pop    %rbp
+  803240:	c3                   	ret
+
+0000000000803241 <mmap_fault>:
+
+/* Ask the file server for the pages of m from va on, at most size bytes,
+ * stopping at the first page which is already mapped. Returns the number
+ * of bytes mapped, 0 past the end of the file */
+static ssize_t
+mmap_fault(struct Mmap *m, uintptr_t va, size_t size) {
+  803241:	55                   	push   %rbp
+  803242:	48 89 e5             	mov    %rsp,%rbp
+  803245:	41 56                	push   %r14
+  803247:	41 55                	push   %r13
+  803249:	41 54                	push   %r12
+  80324b:	53                   	push   %rbx
+  80324c:	48 83 ec 10          	sub    $0x10,%rsp
+  803250:	49 89 fe             	mov    %rdi,%r14
+  803253:	49 89 f4             	mov    %rsi,%r12
+    size = MIN(size, m->mm_end - va);
+  803256:	48 8b 5f 08          	mov    0x8(%rdi),%rbx
+  80325a:	48 29 f3             	sub    %rsi,%rbx
+  80325d:	48 39 d3             	cmp    %rdx,%rbx
+  803260:	48 0f 47 da          	cmova  %rdx,%rbx
+    size_t n = PAGE_SIZE;
+  803264:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  80326b:	00 
+    while (n < size && !is_page_present((void *)va + n))
+  80326c:	bf 00 10 00 00       	mov    $0x1000,%edi
+  803271:	49 bd 17 5a 80 00 00 	movabs $0x805a17,%r13
+  803278:	00 00 00 
+  80327b:	48 81 fb 00 10 00 00 	cmp    $0x1000,%rbx
+  803282:	76 1e                	jbe    8032a2 <mmap_fault+0x61>
+  803284:	4c 01 e7             	add    %r12,%rdi
+  803287:	41 ff d5             	call   *%r13
+  80328a:	84 c0                	test   %al,%al
+  80328c:	75 14                	jne    8032a2 <mmap_fault+0x61>
+        n += PAGE_SIZE;
+  80328e:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  803292:	48 8d b8 00 10 00 00 	lea    0x1000(%rax),%rdi
+  803299:	48 89 7d d8          	mov    %rdi,-0x28(%rbp)
+    while (n < size && !is_page_present((void *)va + n))
+  80329d:	48 39 df             	cmp    %rbx,%rdi
+  8032a0:	72 e2                	jb     803284 <mmap_fault+0x43>
+
+    mmapbuf.map.req_fileid = MMAP_FD(m - mmaps)->fd_file.id;
+  8032a2:	48 bb 00 10 82 00 00 	movabs $0x821000,%rbx
+  8032a9:	00 00 00 
+  8032ac:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  8032b3:	00 00 00 
+  8032b6:	4c 89 f0             	mov    %r14,%rax
+  8032b9:	48 29 d0             	sub    %rdx,%rax
+  8032bc:	48 c1 f8 03          	sar    $0x3,%rax
+  8032c0:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  8032c7:	aa aa aa 
+  8032ca:	48 0f af c2          	imul   %rdx,%rax
+  8032ce:	48 c1 e0 0c          	shl    $0xc,%rax
+  8032d2:	ba 00 00 40 d0       	mov    $0xd0400000,%edx
+  8032d7:	8b 44 10 0c          	mov    0xc(%rax,%rdx,1),%eax
+  8032db:	89 03                	mov    %eax,(%rbx)
+    mmapbuf.map.req_offset = m->mm_offset + (va - m->mm_start);
+  8032dd:	44 89 e0             	mov    %r12d,%eax
+  8032e0:	41 03 46 10          	add    0x10(%r14),%eax
+  8032e4:	41 2b 06             	sub    (%r14),%eax
+  8032e7:	89 43 04             	mov    %eax,0x4(%rbx)
+    mmapbuf.map.req_n = n;
+  8032ea:	48 8b 45 d8          	mov    -0x28(%rbp),%rax
+  8032ee:	48 89 43 08          	mov    %rax,0x8(%rbx)
+    mmapbuf.map.req_perm = m->mm_perm;
+  8032f2:	41 8b 46 14          	mov    0x14(%r14),%eax
+  8032f6:	89 43 10             	mov    %eax,0x10(%rbx)
+
+    ipc_send(fsenv(), FSREQ_MAP, &mmapbuf, PAGE_SIZE, PROT_RW);
+  8032f9:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  803300:	00 00 00 
+  803303:	ff d0                	call   *%rax
+  803305:	89 c7                	mov    %eax,%edi
+  803307:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  80330d:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803312:	48 89 da             	mov    %rbx,%rdx
+  803315:	be 0f 00 00 00       	mov    $0xf,%esi
+  80331a:	48 b8 29 63 80 00 00 	movabs $0x806329,%rax
+  803321:	00 00 00 
+  803324:	ff d0                	call   *%rax
+    return ipc_recv(NULL, (void *)va, &n, NULL);
+  803326:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80332b:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  80332f:	4c 89 e6             	mov    %r12,%rsi
+  803332:	bf 00 00 00 00       	mov    $0x0,%edi
+  803337:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  80333e:	00 00 00 
+  803341:	ff d0                	call   *%rax
+  803343:	48 98                	cltq
+}
+  803345:	48 83 c4 10          	add    $0x10,%rsp
+  803349:	5b                   	pop    %rbx
+  80334a:	41 5c                	pop    %r12
+  80334c:	41 5d                	pop    %r13
+  80334e:	41 5e                	pop    %r14
+  803350:	5d                   	pop    %rbp
+  803351:	c3                   	ret
+
+0000000000803352 <mmap_pgfault>:
+
+static bool
+mmap_pgfault(struct UTrapframe *utf) {
+    uintptr_t va = ROUNDDOWN(utf->utf_fault_va, PAGE_SIZE);
+  803352:	48 8b 37             	mov    (%rdi),%rsi
+  803355:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+    for (size_t i = 0; i < MMAP_MAX; i++)
+  80335c:	48 ba 00 20 82 00 00 	movabs $0x822000,%rdx
+  803363:	00 00 00 
+  803366:	b9 00 00 00 00       	mov    $0x0,%ecx
+  80336b:	eb 0f                	jmp    80337c <mmap_pgfault+0x2a>
+  80336d:	c3                   	ret
+  80336e:	48 83 c1 01          	add    $0x1,%rcx
+  803372:	48 83 c2 18          	add    $0x18,%rdx
+  803376:	48 83 f9 20          	cmp    $0x20,%rcx
+  80337a:	74 6e                	je     8033ea <mmap_pgfault+0x98>
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  80337c:	48 8b 02             	mov    (%rdx),%rax
+  80337f:	48 83 e8 01          	sub    $0x1,%rax
+  803383:	48 39 f0             	cmp    %rsi,%rax
+  803386:	73 e6                	jae    80336e <mmap_pgfault+0x1c>
+  803388:	48 3b 72 08          	cmp    0x8(%rdx),%rsi
+  80338c:	73 e0                	jae    80336e <mmap_pgfault+0x1c>
+    struct Mmap *m = mmap_find(va);
+
+    /* Only pages which are not mapped yet are ours */
+    if (!m || utf->utf_err & FEC_P) return 0;
+  80338e:	48 8b 57 08          	mov    0x8(%rdi),%rdx
+  803392:	b8 00 00 00 00       	mov    $0x0,%eax
+  803397:	f6 c2 01             	test   $0x1,%dl
+  80339a:	75 d1                	jne    80336d <mmap_pgfault+0x1b>
+    if (utf->utf_err & FEC_W && !(m->mm_perm & PROT_W)) return 0;
+  80339c:	f6 c2 02             	test   $0x2,%dl
+  80339f:	74 1a                	je     8033bb <mmap_pgfault+0x69>
+  8033a1:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8033a5:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033aa:	48 bf 00 20 82 00 00 	movabs $0x822000,%rdi
+  8033b1:	00 00 00 
+  8033b4:	f6 44 d7 14 02       	testb  $0x2,0x14(%rdi,%rdx,8)
+  8033b9:	74 35                	je     8033f0 <mmap_pgfault+0x9e>
+mmap_pgfault(struct UTrapframe *utf) {
+  8033bb:	55                   	push   %rbp
+  8033bc:	48 89 e5             	mov    %rsp,%rbp
+        if (mmaps[i].mm_start && va >= mmaps[i].mm_start && va < mmaps[i].mm_end) return &mmaps[i];
+  8033bf:	48 8d 14 49          	lea    (%rcx,%rcx,2),%rdx
+  8033c3:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8033ca:	00 00 00 
+  8033cd:	48 8d 3c d0          	lea    (%rax,%rdx,8),%rdi
+
+    return mmap_fault(m, va, MMAP_FAULT_AROUND) > 0;
+  8033d1:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8033d6:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  8033dd:	00 00 00 
+  8033e0:	ff d0                	call   *%rax
+  8033e2:	48 85 c0             	test   %rax,%rax
+  8033e5:	0f 9f c0             	setg   %al
+}
+  8033e8:	5d                   	pop    %rbp
+  8033e9:	c3                   	ret
+    if (!m || utf->utf_err & FEC_P) return 0;
+  8033ea:	b8 00 00 00 00       	mov    $0x0,%eax
+  8033ef:	c3                   	ret
+}
+  8033f0:	c3                   	ret
+
+00000000008033f1 <mmap_alloc>:
+mmap_alloc(struct Fd *fd) {
+  8033f1:	55                   	push   %rbp
+  8033f2:	48 89 e5             	mov    %rsp,%rbp
+  8033f5:	41 54                	push   %r12
+  8033f7:	53                   	push   %rbx
+  8033f8:	49 89 fc             	mov    %rdi,%r12
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  8033fb:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803402:	00 00 00 
+  803405:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (mmaps[i].mm_start) continue;
+  80340a:	48 83 38 00          	cmpq   $0x0,(%rax)
+  80340e:	74 15                	je     803425 <mmap_alloc+0x34>
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  803410:	48 83 c3 01          	add    $0x1,%rbx
+  803414:	48 83 c0 18          	add    $0x18,%rax
+  803418:	48 83 fb 20          	cmp    $0x20,%rbx
+  80341c:	75 ec                	jne    80340a <mmap_alloc+0x19>
+    return NULL;
+  80341e:	b8 00 00 00 00       	mov    $0x0,%eax
+  803423:	eb 52                	jmp    803477 <mmap_alloc+0x86>
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  803425:	4c 89 e7             	mov    %r12,%rdi
+  803428:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  80342f:	00 00 00 
+  803432:	ff d0                	call   *%rax
+  803434:	41 89 c1             	mov    %eax,%r9d
+  803437:	48 8d 8b 00 04 0d 00 	lea    0xd0400(%rbx),%rcx
+  80343e:	48 c1 e1 0c          	shl    $0xc,%rcx
+  803442:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  803448:	ba 00 00 00 00       	mov    $0x0,%edx
+  80344d:	4c 89 e6             	mov    %r12,%rsi
+  803450:	bf 00 00 00 00       	mov    $0x0,%edi
+  803455:	48 b8 27 20 80 00 00 	movabs $0x802027,%rax
+  80345c:	00 00 00 
+  80345f:	ff d0                	call   *%rax
+  803461:	85 c0                	test   %eax,%eax
+  803463:	78 17                	js     80347c <mmap_alloc+0x8b>
+        return &mmaps[i];
+  803465:	48 8d 14 5b          	lea    (%rbx,%rbx,2),%rdx
+  803469:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  803470:	00 00 00 
+  803473:	48 8d 04 d0          	lea    (%rax,%rdx,8),%rax
+}
+  803477:	5b                   	pop    %rbx
+  803478:	41 5c                	pop    %r12
+  80347a:	5d                   	pop    %rbp
+  80347b:	c3                   	ret
+        if (sys_map_region(0, fd, 0, MMAP_FD(i), PAGE_SIZE, get_prot(fd)) < 0) return NULL;
+  80347c:	b8 00 00 00 00       	mov    $0x0,%eax
+  803481:	eb f4                	jmp    803477 <mmap_alloc+0x86>
+
+0000000000803483 <fsipc>:
+fsipc(unsigned type, void *dstva, size_t datasz) {
+  803483:	55                   	push   %rbp
+  803484:	48 89 e5             	mov    %rsp,%rbp
+  803487:	41 56                	push   %r14
+  803489:	41 55                	push   %r13
+  80348b:	41 54                	push   %r12
+  80348d:	53                   	push   %rbx
+  80348e:	48 83 ec 10          	sub    $0x10,%rsp
+  803492:	41 89 fc             	mov    %edi,%r12d
+  803495:	49 89 f5             	mov    %rsi,%r13
+  803498:	48 89 d3             	mov    %rdx,%rbx
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  80349b:	48 89 f0             	mov    %rsi,%rax
+  80349e:	48 09 d0             	or     %rdx,%rax
+  8034a1:	75 0d                	jne    8034b0 <fsipc+0x2d>
+  8034a3:	8d 47 fe             	lea    -0x2(%rdi),%eax
+  8034a6:	83 f8 04             	cmp    $0x4,%eax
+  8034a9:	76 7d                	jbe    803528 <fsipc+0xa5>
+  8034ab:	83 ff 0d             	cmp    $0xd,%edi
+  8034ae:	74 78                	je     803528 <fsipc+0xa5>
+    ipc_send(fsenv(), type, &fsipcarea, PAGE_SIZE + ROUNDUP(datasz, PAGE_SIZE), PROT_RW);
+  8034b0:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  8034b7:	00 00 00 
+  8034ba:	ff d0                	call   *%rax
+  8034bc:	89 c7                	mov    %eax,%edi
+  8034be:	48 8d 8b ff 0f 00 00 	lea    0xfff(%rbx),%rcx
+  8034c5:	48 81 e1 00 f0 ff ff 	and    $0xfffffffffffff000,%rcx
+  8034cc:	48 8d 89 00 10 00 00 	lea    0x1000(%rcx),%rcx
+  8034d3:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  8034d9:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  8034e0:	00 00 00 
+  8034e3:	44 89 e6             	mov    %r12d,%esi
+  8034e6:	48 b8 29 63 80 00 00 	movabs $0x806329,%rax
+  8034ed:	00 00 00 
+  8034f0:	ff d0                	call   *%rax
+    size_t maxsz = PAGE_SIZE;
+  8034f2:	48 c7 45 d8 00 10 00 	movq   $0x1000,-0x28(%rbp)
+  8034f9:	00 
+    return ipc_recv(NULL, dstva, &maxsz, NULL);
+  8034fa:	b9 00 00 00 00       	mov    $0x0,%ecx
+  8034ff:	48 8d 55 d8          	lea    -0x28(%rbp),%rdx
+  803503:	4c 89 ee             	mov    %r13,%rsi
+  803506:	bf 00 00 00 00       	mov    $0x0,%edi
+  80350b:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  803512:	00 00 00 
+  803515:	ff d0                	call   *%rax
+  803517:	89 c3                	mov    %eax,%ebx
+}
+  803519:	89 d8                	mov    %ebx,%eax
+  80351b:	48 83 c4 10          	add    $0x10,%rsp
+  80351f:	5b                   	pop    %rbx
+  803520:	41 5c                	pop    %r12
+  803522:	41 5d                	pop    %r13
+  803524:	41 5e                	pop    %r14
+  803526:	5d                   	pop    %rbp
+  803527:	c3                   	ret
+    if (!dstva && !datasz && FSCHAN_TYPE(type) && (ch = fschan()))
+  803528:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  80352f:	00 00 00 
+  803532:	ff d0                	call   *%rax
+  803534:	49 89 c6             	mov    %rax,%r14
+  803537:	48 85 c0             	test   %rax,%rax
+  80353a:	0f 84 70 ff ff ff    	je     8034b0 <fsipc+0x2d>
+    struct Fsmsg *msg = chan_prepare(&ch->fc_req);
+  803540:	48 8d 78 40          	lea    0x40(%rax),%rdi
+  803544:	48 b8 24 5e 80 00 00 	movabs $0x805e24,%rax
+  80354b:	00 00 00 
+  80354e:	ff d0                	call   *%rax
+    msg->fm_type = type;
+  803550:	44 89 20             	mov    %r12d,(%rax)
+    msg->fm_chain = 0;
+  803553:	c7 40 08 00 00 00 00 	movl   $0x0,0x8(%rax)
+    memcpy(&msg->fm_req, &fsipcbuf, sizeof(msg->fm_req));
+  80355a:	48 8d 78 10          	lea    0x10(%rax),%rdi
+  80355e:	ba 10 00 00 00       	mov    $0x10,%edx
+  803563:	48 be 00 00 83 00 00 	movabs $0x830000,%rsi
+  80356a:	00 00 00 
+  80356d:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  803574:	00 00 00 
+  803577:	ff d0                	call   *%rax
+    fschan_publish(ch);
+  803579:	4c 89 f7             	mov    %r14,%rdi
+  80357c:	48 b8 d1 2f 80 00 00 	movabs $0x802fd1,%rax
+  803583:	00 00 00 
+  803586:	ff d0                	call   *%rax
+    chan_wait(&ch->fc_resp);
+  803588:	49 81 c6 c0 20 00 00 	add    $0x20c0,%r14
+  80358f:	4c 89 f7             	mov    %r14,%rdi
+  803592:	48 b8 e7 5e 80 00 00 	movabs $0x805ee7,%rax
+  803599:	00 00 00 
+  80359c:	ff d0                	call   *%rax
+    return chan_peek(&ch->fc_resp);
+  80359e:	4c 89 f7             	mov    %r14,%rdi
+  8035a1:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  8035a8:	00 00 00 
+  8035ab:	ff d0                	call   *%rax
+    int res = msg->fm_res;
+  8035ad:	8b 58 04             	mov    0x4(%rax),%ebx
+    if (type == FSREQ_STAT && res >= 0)
+  8035b0:	41 83 fc 05          	cmp    $0x5,%r12d
+  8035b4:	75 04                	jne    8035ba <fsipc+0x137>
+  8035b6:	85 db                	test   %ebx,%ebx
+  8035b8:	79 14                	jns    8035ce <fsipc+0x14b>
+    chan_release(&ch->fc_resp);
+  8035ba:	4c 89 f7             	mov    %r14,%rdi
+  8035bd:	48 b8 9c 5e 80 00 00 	movabs $0x805e9c,%rax
+  8035c4:	00 00 00 
+  8035c7:	ff d0                	call   *%rax
+        return fschan_call(ch, type);
+  8035c9:	e9 4b ff ff ff       	jmp    803519 <fsipc+0x96>
+        memcpy(&fsipcbuf.statRet, msg->fm_data, sizeof(fsipcbuf.statRet));
+  8035ce:	48 8d 70 20          	lea    0x20(%rax),%rsi
+  8035d2:	ba 88 00 00 00       	mov    $0x88,%edx
+  8035d7:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  8035de:	00 00 00 
+  8035e1:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  8035e8:	00 00 00 
+  8035eb:	ff d0                	call   *%rax
+  8035ed:	eb cb                	jmp    8035ba <fsipc+0x137>
+
+00000000008035ef <devfile_write_direct>:
+devfile_write_direct(struct Fd *fd, const void *buf, size_t n, off_t offset) {
+  8035ef:	55                   	push   %rbp
+  8035f0:	48 89 e5             	mov    %rsp,%rbp
+  8035f3:	41 57                	push   %r15
+  8035f5:	41 56                	push   %r14
+  8035f7:	41 55                	push   %r13
+  8035f9:	41 54                	push   %r12
+  8035fb:	53                   	push   %rbx
+  8035fc:	48 83 ec 18          	sub    $0x18,%rsp
+  803600:	48 89 7d c0          	mov    %rdi,-0x40(%rbp)
+  803604:	49 89 f6             	mov    %rsi,%r14
+  803607:	49 89 d4             	mov    %rdx,%r12
+  80360a:	41 89 cd             	mov    %ecx,%r13d
+    struct FsChannel *ch = fschan();
+  80360d:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  803614:	00 00 00 
+  803617:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  803619:	48 85 c0             	test   %rax,%rax
+  80361c:	0f 85 96 00 00 00    	jne    8036b8 <devfile_write_direct+0xc9>
+    size_t write = 0;
+  803622:	48 c7 45 c8 00 00 00 	movq   $0x0,-0x38(%rbp)
+  803629:	00 
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  80362a:	49 bf 00 00 83 00 00 	movabs $0x830000,%r15
+  803631:	00 00 00 
+    while (n) {
+  803634:	4d 85 e4             	test   %r12,%r12
+  803637:	74 79                	je     8036b2 <devfile_write_direct+0xc3>
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  803639:	bb 00 00 01 00       	mov    $0x10000,%ebx
+  80363e:	49 39 dc             	cmp    %rbx,%r12
+  803641:	49 0f 46 dc          	cmovbe %r12,%rbx
+        memcpy(fsipcarea.data, buf, blk);
+  803645:	48 89 da             	mov    %rbx,%rdx
+  803648:	4c 89 f6             	mov    %r14,%rsi
+  80364b:	48 bf 00 10 83 00 00 	movabs $0x831000,%rdi
+  803652:	00 00 00 
+  803655:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  80365c:	00 00 00 
+  80365f:	ff d0                	call   *%rax
+        fsipcbuf.write.req_fileid = fd->fd_file.id;
+  803661:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  803665:	8b 40 0c             	mov    0xc(%rax),%eax
+  803668:	41 89 07             	mov    %eax,(%r15)
+        fsipcbuf.write.req_offset = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)write;
+  80366b:	8b 45 c8             	mov    -0x38(%rbp),%eax
+  80366e:	44 01 e8             	add    %r13d,%eax
+  803671:	41 83 fd ff          	cmp    $0xffffffff,%r13d
+  803675:	41 0f 44 c5          	cmove  %r13d,%eax
+  803679:	41 89 47 04          	mov    %eax,0x4(%r15)
+        fsipcbuf.write.req_n = blk;
+  80367d:	49 89 5f 08          	mov    %rbx,0x8(%r15)
+        int res = fsipc(FSREQ_WRITE, NULL, blk);
+  803681:	48 89 da             	mov    %rbx,%rdx
+  803684:	be 00 00 00 00       	mov    $0x0,%esi
+  803689:	bf 04 00 00 00       	mov    $0x4,%edi
+  80368e:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  803695:	00 00 00 
+  803698:	ff d0                	call   *%rax
+        if (res < 0)
+  80369a:	85 c0                	test   %eax,%eax
+  80369c:	78 4a                	js     8036e8 <devfile_write_direct+0xf9>
+        buf += res;
+  80369e:	48 98                	cltq
+  8036a0:	49 01 c6             	add    %rax,%r14
+        write += res;
+  8036a3:	48 01 45 c8          	add    %rax,-0x38(%rbp)
+    while (n) {
+  8036a7:	49 29 c4             	sub    %rax,%r12
+  8036aa:	75 8d                	jne    803639 <devfile_write_direct+0x4a>
+    return write;
+  8036ac:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  8036b0:	eb 27                	jmp    8036d9 <devfile_write_direct+0xea>
+    size_t write = 0;
+  8036b2:	4c 89 65 c8          	mov    %r12,-0x38(%rbp)
+  8036b6:	eb f4                	jmp    8036ac <devfile_write_direct+0xbd>
+    if (ch) return fschan_rw(ch, fd, FSREQ_WRITE, (void *)buf, n, offset);
+  8036b8:	45 89 e9             	mov    %r13d,%r9d
+  8036bb:	4d 89 e0             	mov    %r12,%r8
+  8036be:	4c 89 f1             	mov    %r14,%rcx
+  8036c1:	ba 04 00 00 00       	mov    $0x4,%edx
+  8036c6:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8036ca:	48 89 c7             	mov    %rax,%rdi
+  8036cd:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  8036d4:	00 00 00 
+  8036d7:	ff d0                	call   *%rax
+}
+  8036d9:	48 83 c4 18          	add    $0x18,%rsp
+  8036dd:	5b                   	pop    %rbx
+  8036de:	41 5c                	pop    %r12
+  8036e0:	41 5d                	pop    %r13
+  8036e2:	41 5e                	pop    %r14
+  8036e4:	41 5f                	pop    %r15
+  8036e6:	5d                   	pop    %rbp
+  8036e7:	c3                   	ret
+            return res;
+  8036e8:	48 98                	cltq
+  8036ea:	eb ed                	jmp    8036d9 <devfile_write_direct+0xea>
+
+00000000008036ec <fbuf_flush>:
+fbuf_flush(struct Fd *fd) {
+  8036ec:	55                   	push   %rbp
+  8036ed:	48 89 e5             	mov    %rsp,%rbp
+  8036f0:	41 54                	push   %r12
+  8036f2:	53                   	push   %rbx
+  8036f3:	49 89 fc             	mov    %rdi,%r12
+    struct Fbuf *fb = fbuf(fd);
+  8036f6:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8036fd:	00 00 00 
+  803700:	ff d0                	call   *%rax
+    if (!fb || !fb->fb_dirty) return 0;
+  803702:	48 85 c0             	test   %rax,%rax
+  803705:	74 71                	je     803778 <fbuf_flush+0x8c>
+  803707:	48 89 c3             	mov    %rax,%rbx
+  80370a:	b8 00 00 00 00       	mov    $0x0,%eax
+  80370f:	80 7b 08 00          	cmpb   $0x0,0x8(%rbx)
+  803713:	75 05                	jne    80371a <fbuf_flush+0x2e>
+}
+  803715:	5b                   	pop    %rbx
+  803716:	41 5c                	pop    %r12
+  803718:	5d                   	pop    %rbp
+  803719:	c3                   	ret
+    ssize_t res = devfile_write_direct(fd, FBUF(fb - fbufs), fb->fb_len, fb->fb_start);
+  80371a:	8b 4b 0c             	mov    0xc(%rbx),%ecx
+  80371d:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  803721:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  803728:	00 00 00 
+  80372b:	48 89 de             	mov    %rbx,%rsi
+  80372e:	48 29 c6             	sub    %rax,%rsi
+  803731:	48 c1 fe 03          	sar    $0x3,%rsi
+  803735:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  80373c:	aa aa aa 
+  80373f:	48 0f af f0          	imul   %rax,%rsi
+  803743:	48 c1 e6 0e          	shl    $0xe,%rsi
+  803747:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  80374c:	48 01 c6             	add    %rax,%rsi
+  80374f:	4c 89 e7             	mov    %r12,%rdi
+  803752:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803759:	00 00 00 
+  80375c:	ff d0                	call   *%rax
+    fb->fb_dirty = 0;
+  80375e:	c6 43 08 00          	movb   $0x0,0x8(%rbx)
+    fb->fb_len = 0;
+  803762:	48 c7 43 10 00 00 00 	movq   $0x0,0x10(%rbx)
+  803769:	00 
+    return res < 0 ? res : 0;
+  80376a:	48 85 c0             	test   %rax,%rax
+  80376d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803772:	48 0f 4f c2          	cmovg  %rdx,%rax
+  803776:	eb 9d                	jmp    803715 <fbuf_flush+0x29>
+    if (!fb || !fb->fb_dirty) return 0;
+  803778:	b8 00 00 00 00       	mov    $0x0,%eax
+  80377d:	eb 96                	jmp    803715 <fbuf_flush+0x29>
+
+000000000080377f <devfile_seek>:
+devfile_seek(struct Fd *fd, off_t offset) {
+  80377f:	55                   	push   %rbp
+  803780:	48 89 e5             	mov    %rsp,%rbp
+    return fbuf_flush(fd);
+  803783:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  80378a:	00 00 00 
+  80378d:	ff d0                	call   *%rax
+}
+  80378f:	5d                   	pop    %rbp
+  803790:	c3                   	ret
+
+0000000000803791 <devfile_write>:
+    if (!fd || !buf)
+  803791:	48 85 ff             	test   %rdi,%rdi
+  803794:	0f 84 d3 01 00 00    	je     80396d <devfile_write+0x1dc>
+devfile_write(struct Fd *fd, const void *buf, size_t n) {
+  80379a:	55                   	push   %rbp
+  80379b:	48 89 e5             	mov    %rsp,%rbp
+  80379e:	41 57                	push   %r15
+  8037a0:	41 56                	push   %r14
+  8037a2:	41 55                	push   %r13
+  8037a4:	41 54                	push   %r12
+  8037a6:	53                   	push   %rbx
+  8037a7:	48 83 ec 08          	sub    $0x8,%rsp
+  8037ab:	49 89 fc             	mov    %rdi,%r12
+  8037ae:	49 89 f6             	mov    %rsi,%r14
+  8037b1:	48 89 d3             	mov    %rdx,%rbx
+        return E_INVAL;
+  8037b4:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  8037b9:	48 85 f6             	test   %rsi,%rsi
+  8037bc:	0f 84 9c 01 00 00    	je     80395e <devfile_write+0x1cd>
+    struct Fbuf *fb = fbuf(fd);
+  8037c2:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8037c9:	00 00 00 
+  8037cc:	ff d0                	call   *%rax
+  8037ce:	49 89 c5             	mov    %rax,%r13
+    if (!fb || fbuf_shared(fd)) {
+  8037d1:	48 85 c0             	test   %rax,%rax
+  8037d4:	0f 84 a2 00 00 00    	je     80387c <devfile_write+0xeb>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  8037da:	be 00 10 00 00       	mov    $0x1000,%esi
+  8037df:	4c 89 e7             	mov    %r12,%rdi
+  8037e2:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  8037e9:	00 00 00 
+  8037ec:	ff d0                	call   *%rax
+    if (!fb || fbuf_shared(fd)) {
+  8037ee:	83 f8 02             	cmp    $0x2,%eax
+  8037f1:	0f 8f 85 00 00 00    	jg     80387c <devfile_write+0xeb>
+    char *data = FBUF(fb - fbufs);
+  8037f7:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  8037fe:	00 00 00 
+  803801:	4d 89 ef             	mov    %r13,%r15
+  803804:	49 29 c7             	sub    %rax,%r15
+  803807:	49 c1 ff 03          	sar    $0x3,%r15
+  80380b:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  803812:	aa aa aa 
+  803815:	4c 0f af f8          	imul   %rax,%r15
+  803819:	49 c1 e7 0e          	shl    $0xe,%r15
+  80381d:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803822:	49 01 c7             	add    %rax,%r15
+    if (fb->fb_dirty && (fd->fd_offset != fb->fb_start + (off_t)fb->fb_len || fb->fb_len + n > FBUF_SIZE))
+  803825:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  80382a:	0f 84 d7 00 00 00    	je     803907 <devfile_write+0x176>
+  803830:	49 8b 45 10          	mov    0x10(%r13),%rax
+  803834:	89 c2                	mov    %eax,%edx
+  803836:	41 03 55 0c          	add    0xc(%r13),%edx
+  80383a:	41 39 54 24 04       	cmp    %edx,0x4(%r12)
+  80383f:	75 0f                	jne    803850 <devfile_write+0xbf>
+  803841:	48 01 d8             	add    %rbx,%rax
+  803844:	48 3d 00 40 00 00    	cmp    $0x4000,%rax
+  80384a:	0f 86 92 00 00 00    	jbe    8038e2 <devfile_write+0x151>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  803850:	4c 89 e7             	mov    %r12,%rdi
+  803853:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  80385a:	00 00 00 
+  80385d:	ff d0                	call   *%rax
+  80385f:	85 c0                	test   %eax,%eax
+  803861:	78 52                	js     8038b5 <devfile_write+0x124>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803863:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80386a:	77 7f                	ja     8038eb <devfile_write+0x15a>
+    if (!fb->fb_dirty) {
+  80386c:	41 80 7d 08 00       	cmpb   $0x0,0x8(%r13)
+  803871:	0f 85 c2 00 00 00    	jne    803939 <devfile_write+0x1a8>
+  803877:	e9 94 00 00 00       	jmp    803910 <devfile_write+0x17f>
+        int res = fbuf_flush(fd);
+  80387c:	4c 89 e7             	mov    %r12,%rdi
+  80387f:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  803886:	00 00 00 
+  803889:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  80388b:	85 c0                	test   %eax,%eax
+  80388d:	79 07                	jns    803896 <devfile_write+0x105>
+  80388f:	48 98                	cltq
+  803891:	e9 c8 00 00 00       	jmp    80395e <devfile_write+0x1cd>
+  803896:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  80389b:	48 89 da             	mov    %rbx,%rdx
+  80389e:	4c 89 f6             	mov    %r14,%rsi
+  8038a1:	4c 89 e7             	mov    %r12,%rdi
+  8038a4:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  8038ab:	00 00 00 
+  8038ae:	ff d0                	call   *%rax
+  8038b0:	e9 a9 00 00 00       	jmp    80395e <devfile_write+0x1cd>
+        if ((res = fbuf_flush(fd)) < 0) return res;
+  8038b5:	48 98                	cltq
+  8038b7:	e9 a2 00 00 00       	jmp    80395e <devfile_write+0x1cd>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8038bc:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8038c1:	ba 00 40 00 00       	mov    $0x4000,%edx
+  8038c6:	4c 89 fe             	mov    %r15,%rsi
+  8038c9:	bf 00 00 00 00       	mov    $0x0,%edi
+  8038ce:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8038d5:	00 00 00 
+  8038d8:	ff d0                	call   *%rax
+        if (!is_page_present(data) &&
+  8038da:	85 c0                	test   %eax,%eax
+  8038dc:	79 45                	jns    803923 <devfile_write+0x192>
+            (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  8038de:	48 98                	cltq
+  8038e0:	eb 7c                	jmp    80395e <devfile_write+0x1cd>
+    if (n >= FBUF_SIZE) return devfile_write_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  8038e2:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  8038e9:	76 4e                	jbe    803939 <devfile_write+0x1a8>
+  8038eb:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  8038f0:	48 89 da             	mov    %rbx,%rdx
+  8038f3:	4c 89 f6             	mov    %r14,%rsi
+  8038f6:	4c 89 e7             	mov    %r12,%rdi
+  8038f9:	48 b8 ef 35 80 00 00 	movabs $0x8035ef,%rax
+  803900:	00 00 00 
+  803903:	ff d0                	call   *%rax
+  803905:	eb 57                	jmp    80395e <devfile_write+0x1cd>
+  803907:	48 81 fb ff 3f 00 00 	cmp    $0x3fff,%rbx
+  80390e:	77 db                	ja     8038eb <devfile_write+0x15a>
+        if (!is_page_present(data) &&
+  803910:	4c 89 ff             	mov    %r15,%rdi
+  803913:	48 b8 17 5a 80 00 00 	movabs $0x805a17,%rax
+  80391a:	00 00 00 
+  80391d:	ff d0                	call   *%rax
+  80391f:	84 c0                	test   %al,%al
+  803921:	74 99                	je     8038bc <devfile_write+0x12b>
+        fb->fb_dirty = 1;
+  803923:	41 c6 45 08 01       	movb   $0x1,0x8(%r13)
+        fb->fb_start = fd->fd_offset;
+  803928:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80392d:	41 89 45 0c          	mov    %eax,0xc(%r13)
+        fb->fb_len = 0;
+  803931:	49 c7 45 10 00 00 00 	movq   $0x0,0x10(%r13)
+  803938:	00 
+    memcpy(data + fb->fb_len, buf, n);
+  803939:	4c 89 ff             	mov    %r15,%rdi
+  80393c:	49 03 7d 10          	add    0x10(%r13),%rdi
+  803940:	48 89 da             	mov    %rbx,%rdx
+  803943:	4c 89 f6             	mov    %r14,%rsi
+  803946:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  80394d:	00 00 00 
+  803950:	ff d0                	call   *%rax
+    fb->fb_len += n;
+  803952:	49 01 5d 10          	add    %rbx,0x10(%r13)
+    fd->fd_offset += n;
+  803956:	41 01 5c 24 04       	add    %ebx,0x4(%r12)
+    return n;
+  80395b:	48 89 d8             	mov    %rbx,%rax
+}
+  80395e:	48 83 c4 08          	add    $0x8,%rsp
+  803962:	5b                   	pop    %rbx
+  803963:	41 5c                	pop    %r12
+  803965:	41 5d                	pop    %r13
+  803967:	41 5e                	pop    %r14
+  803969:	41 5f                	pop    %r15
+  80396b:	5d                   	pop    %rbp
+  80396c:	c3                   	ret
+        return E_INVAL;
+  80396d:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803972:	c3                   	ret
+
+0000000000803973 <devfile_flush>:
+devfile_flush(struct Fd *fd) {
+  803973:	55                   	push   %rbp
+  803974:	48 89 e5             	mov    %rsp,%rbp
+  803977:	41 54                	push   %r12
+  803979:	53                   	push   %rbx
+  80397a:	48 89 fb             	mov    %rdi,%rbx
+    int res = fbuf_flush(fd);
+  80397d:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  803984:	00 00 00 
+  803987:	ff d0                	call   *%rax
+  803989:	41 89 c4             	mov    %eax,%r12d
+    if (fbuf(fd)) fbuf(fd)->fb_len = 0;
+  80398c:	48 89 df             	mov    %rbx,%rdi
+  80398f:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  803996:	00 00 00 
+  803999:	ff d0                	call   *%rax
+  80399b:	48 85 c0             	test   %rax,%rax
+  80399e:	74 17                	je     8039b7 <devfile_flush+0x44>
+  8039a0:	48 89 df             	mov    %rbx,%rdi
+  8039a3:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  8039aa:	00 00 00 
+  8039ad:	ff d0                	call   *%rax
+  8039af:	48 c7 40 10 00 00 00 	movq   $0x0,0x10(%rax)
+  8039b6:	00 
+    fsipcbuf.flush.req_fileid = fd->fd_file.id;
+  8039b7:	8b 43 0c             	mov    0xc(%rbx),%eax
+  8039ba:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8039c1:	00 00 
+    int res2 = fsipc(FSREQ_FLUSH, NULL, 0);
+  8039c3:	ba 00 00 00 00       	mov    $0x0,%edx
+  8039c8:	be 00 00 00 00       	mov    $0x0,%esi
+  8039cd:	bf 06 00 00 00       	mov    $0x6,%edi
+  8039d2:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  8039d9:	00 00 00 
+  8039dc:	ff d0                	call   *%rax
+    return res < 0 ? res : res2;
+  8039de:	45 85 e4             	test   %r12d,%r12d
+  8039e1:	41 0f 48 c4          	cmovs  %r12d,%eax
+}
+  8039e5:	5b                   	pop    %rbx
+  8039e6:	41 5c                	pop    %r12
+  8039e8:	5d                   	pop    %rbp
+  8039e9:	c3                   	ret
+
+00000000008039ea <devfile_read_direct>:
+devfile_read_direct(struct Fd *fd, void *buf, size_t n, off_t offset) {
+  8039ea:	55                   	push   %rbp
+  8039eb:	48 89 e5             	mov    %rsp,%rbp
+  8039ee:	41 57                	push   %r15
+  8039f0:	41 56                	push   %r14
+  8039f2:	41 55                	push   %r13
+  8039f4:	41 54                	push   %r12
+  8039f6:	53                   	push   %rbx
+  8039f7:	48 83 ec 38          	sub    $0x38,%rsp
+  8039fb:	48 89 7d a8          	mov    %rdi,-0x58(%rbp)
+  8039ff:	49 89 f7             	mov    %rsi,%r15
+  803a02:	48 89 d3             	mov    %rdx,%rbx
+  803a05:	41 89 ce             	mov    %ecx,%r14d
+    struct FsChannel *ch = fschan();
+  803a08:	48 b8 35 2f 80 00 00 	movabs $0x802f35,%rax
+  803a0f:	00 00 00 
+  803a12:	ff d0                	call   *%rax
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803a14:	48 85 c0             	test   %rax,%rax
+  803a17:	75 20                	jne    803a39 <devfile_read_direct+0x4f>
+    bool map = 1;
+  803a19:	b8 01 00 00 00       	mov    $0x1,%eax
+    size_t read = 0;
+  803a1e:	48 c7 45 b0 00 00 00 	movq   $0x0,-0x50(%rbp)
+  803a25:	00 
+    while (n) {
+  803a26:	48 85 db             	test   %rbx,%rbx
+  803a29:	0f 85 df 00 00 00    	jne    803b0e <devfile_read_direct+0x124>
+    size_t read = 0;
+  803a2f:	48 89 5d b0          	mov    %rbx,-0x50(%rbp)
+    return read;
+  803a33:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a37:	eb 21                	jmp    803a5a <devfile_read_direct+0x70>
+    if (ch) return fschan_rw(ch, fd, FSREQ_READ, buf, n, offset);
+  803a39:	45 89 f1             	mov    %r14d,%r9d
+  803a3c:	49 89 d8             	mov    %rbx,%r8
+  803a3f:	4c 89 f9             	mov    %r15,%rcx
+  803a42:	ba 03 00 00 00       	mov    $0x3,%edx
+  803a47:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803a4b:	48 89 c7             	mov    %rax,%rdi
+  803a4e:	48 b8 1c 30 80 00 00 	movabs $0x80301c,%rax
+  803a55:	00 00 00 
+  803a58:	ff d0                	call   *%rax
+}
+  803a5a:	48 83 c4 38          	add    $0x38,%rsp
+  803a5e:	5b                   	pop    %rbx
+  803a5f:	41 5c                	pop    %r12
+  803a61:	41 5d                	pop    %r13
+  803a63:	41 5e                	pop    %r14
+  803a65:	41 5f                	pop    %r15
+  803a67:	5d                   	pop    %rbp
+  803a68:	c3                   	ret
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803a69:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803a6d:	66 f7 40 04 ff 0f    	testw  $0xfff,0x4(%rax)
+  803a73:	75 1e                	jne    803a93 <devfile_read_direct+0xa9>
+  803a75:	e9 e2 00 00 00       	jmp    803b5c <devfile_read_direct+0x172>
+            if (!res) return read;
+  803a7a:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  803a7e:	eb da                	jmp    803a5a <devfile_read_direct+0x70>
+            if (res != -E_NOT_SUPP) return res;
+  803a80:	48 83 fa ed          	cmp    $0xffffffffffffffed,%rdx
+  803a84:	0f 85 d0 01 00 00    	jne    803c5a <devfile_read_direct+0x270>
+            map = 0;
+  803a8a:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803a8e:	eb 03                	jmp    803a93 <devfile_read_direct+0xa9>
+  803a90:	88 45 bf             	mov    %al,-0x41(%rbp)
+        size_t blk = MIN(n, FSIPC_DATA_SIZE);
+  803a93:	ba 00 00 01 00       	mov    $0x10000,%edx
+  803a98:	48 39 d3             	cmp    %rdx,%rbx
+  803a9b:	48 0f 46 d3          	cmovbe %rbx,%rdx
+        fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803a9f:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  803aa3:	8b 40 0c             	mov    0xc(%rax),%eax
+  803aa6:	48 b9 00 00 83 00 00 	movabs $0x830000,%rcx
+  803aad:	00 00 00 
+  803ab0:	89 01                	mov    %eax,(%rcx)
+        fsipcbuf.read.req_offset = pos;
+  803ab2:	44 89 61 04          	mov    %r12d,0x4(%rcx)
+        fsipcbuf.read.req_n = blk;
+  803ab6:	48 89 51 08          	mov    %rdx,0x8(%rcx)
+        int res = fsipc(FSREQ_READ, NULL, blk);
+  803aba:	be 00 00 00 00       	mov    $0x0,%esi
+  803abf:	bf 03 00 00 00       	mov    $0x3,%edi
+  803ac4:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  803acb:	00 00 00 
+  803ace:	ff d0                	call   *%rax
+        if (res <= 0)
+  803ad0:	85 c0                	test   %eax,%eax
+  803ad2:	0f 8e 63 01 00 00    	jle    803c3b <devfile_read_direct+0x251>
+        memcpy(buf, fsipcarea.data, res);
+  803ad8:	4c 63 e0             	movslq %eax,%r12
+  803adb:	4c 89 e2             	mov    %r12,%rdx
+  803ade:	48 be 00 10 83 00 00 	movabs $0x831000,%rsi
+  803ae5:	00 00 00 
+  803ae8:	4c 89 ff             	mov    %r15,%rdi
+  803aeb:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  803af2:	00 00 00 
+  803af5:	ff d0                	call   *%rax
+        buf += res;
+  803af7:	4d 01 e7             	add    %r12,%r15
+        n -= res;
+  803afa:	4c 29 e3             	sub    %r12,%rbx
+        read += res;
+  803afd:	4c 01 65 b0          	add    %r12,-0x50(%rbp)
+  803b01:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+    while (n) {
+  803b05:	48 85 db             	test   %rbx,%rbx
+  803b08:	0f 84 25 ff ff ff    	je     803a33 <devfile_read_direct+0x49>
+        off_t pos = offset == FSREQ_OFFSET_CUR ? FSREQ_OFFSET_CUR : offset + (off_t)read;
+  803b0e:	8b 75 b0             	mov    -0x50(%rbp),%esi
+  803b11:	45 8d 24 36          	lea    (%r14,%rsi,1),%r12d
+  803b15:	41 83 fe ff          	cmp    $0xffffffff,%r14d
+  803b19:	45 0f 44 e6          	cmove  %r14d,%r12d
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803b1d:	48 81 fb ff 0f 00 00 	cmp    $0xfff,%rbx
+  803b24:	0f 97 c2             	seta   %dl
+  803b27:	20 c2                	and    %al,%dl
+  803b29:	88 55 bf             	mov    %dl,-0x41(%rbp)
+  803b2c:	0f 84 5e ff ff ff    	je     803a90 <devfile_read_direct+0xa6>
+  803b32:	4c 89 fa             	mov    %r15,%rdx
+  803b35:	4d 89 fd             	mov    %r15,%r13
+  803b38:	41 81 e5 ff 0f 00 00 	and    $0xfff,%r13d
+  803b3f:	0f 85 4e ff ff ff    	jne    803a93 <devfile_read_direct+0xa9>
+            !((pos == FSREQ_OFFSET_CUR ? fd->fd_offset : pos) % BLKSIZE)) {
+  803b45:	41 83 fc ff          	cmp    $0xffffffff,%r12d
+  803b49:	0f 84 1a ff ff ff    	je     803a69 <devfile_read_direct+0x7f>
+        if (map && n >= PAGE_SIZE && !PAGE_OFFSET(buf) &&
+  803b4f:	41 f7 c4 ff 0f 00 00 	test   $0xfff,%r12d
+  803b56:	0f 85 37 ff ff ff    	jne    803a93 <devfile_read_direct+0xa9>
+            ssize_t res = devfile_read_map(fd, buf, MIN(ROUNDDOWN(n, PAGE_SIZE), FSMAP_MAX_SIZE), pos);
+  803b5c:	48 89 d8             	mov    %rbx,%rax
+  803b5f:	48 25 00 f0 ff ff    	and    $0xfffffffffffff000,%rax
+  803b65:	b9 00 00 04 00       	mov    $0x40000,%ecx
+  803b6a:	48 39 c8             	cmp    %rcx,%rax
+  803b6d:	48 0f 47 c1          	cmova  %rcx,%rax
+  803b71:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        if (get_prot(buf + i) & PROT_SHARE) return -E_NOT_SUPP;
+  803b75:	44 89 65 b8          	mov    %r12d,-0x48(%rbp)
+  803b79:	49 89 d4             	mov    %rdx,%r12
+  803b7c:	4b 8d 3c 2c          	lea    (%r12,%r13,1),%rdi
+  803b80:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  803b87:	00 00 00 
+  803b8a:	ff d0                	call   *%rax
+  803b8c:	a8 40                	test   $0x40,%al
+  803b8e:	0f 85 b9 00 00 00    	jne    803c4d <devfile_read_direct+0x263>
+    for (size_t i = 0; i < n; i += PAGE_SIZE)
+  803b94:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  803b9b:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803b9f:	49 39 c5             	cmp    %rax,%r13
+  803ba2:	72 d8                	jb     803b7c <devfile_read_direct+0x192>
+    fsipcbuf.read.req_fileid = fd->fd_file.id;
+  803ba4:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803ba8:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803baf:	00 00 00 
+  803bb2:	48 8b 75 a8          	mov    -0x58(%rbp),%rsi
+  803bb6:	8b 4e 0c             	mov    0xc(%rsi),%ecx
+  803bb9:	89 0a                	mov    %ecx,(%rdx)
+    fsipcbuf.read.req_offset = offset;
+  803bbb:	44 89 62 04          	mov    %r12d,0x4(%rdx)
+    fsipcbuf.read.req_n = n;
+  803bbf:	48 89 42 08          	mov    %rax,0x8(%rdx)
+    ipc_send(fsenv(), FSREQ_READ_MAP, &fsipcarea, PAGE_SIZE, PROT_RW);
+  803bc3:	48 b8 d0 2d 80 00 00 	movabs $0x802dd0,%rax
+  803bca:	00 00 00 
+  803bcd:	ff d0                	call   *%rax
+  803bcf:	89 c7                	mov    %eax,%edi
+  803bd1:	41 b8 06 00 00 00    	mov    $0x6,%r8d
+  803bd7:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  803bdc:	48 ba 00 00 83 00 00 	movabs $0x830000,%rdx
+  803be3:	00 00 00 
+  803be6:	be 0e 00 00 00       	mov    $0xe,%esi
+  803beb:	48 b8 29 63 80 00 00 	movabs $0x806329,%rax
+  803bf2:	00 00 00 
+  803bf5:	ff d0                	call   *%rax
+    return ipc_recv(NULL, buf, &n, NULL);
+  803bf7:	b9 00 00 00 00       	mov    $0x0,%ecx
+  803bfc:	48 8d 55 c8          	lea    -0x38(%rbp),%rdx
+  803c00:	4c 89 fe             	mov    %r15,%rsi
+  803c03:	bf 00 00 00 00       	mov    $0x0,%edi
+  803c08:	48 b8 05 63 80 00 00 	movabs $0x806305,%rax
+  803c0f:	00 00 00 
+  803c12:	ff d0                	call   *%rax
+  803c14:	48 63 d0             	movslq %eax,%rdx
+            if (!res) return read;
+  803c17:	48 85 d2             	test   %rdx,%rdx
+  803c1a:	0f 84 5a fe ff ff    	je     803a7a <devfile_read_direct+0x90>
+            if (res > 0) {
+  803c20:	0f 8e 5a fe ff ff    	jle    803a80 <devfile_read_direct+0x96>
+                buf += res;
+  803c26:	48 98                	cltq
+  803c28:	49 01 c7             	add    %rax,%r15
+                n -= res;
+  803c2b:	48 29 c3             	sub    %rax,%rbx
+                read += res;
+  803c2e:	48 01 45 b0          	add    %rax,-0x50(%rbp)
+                continue;
+  803c32:	0f b6 45 bf          	movzbl -0x41(%rbp),%eax
+  803c36:	e9 ca fe ff ff       	jmp    803b05 <devfile_read_direct+0x11b>
+            return res ? res : read;
+  803c3b:	41 89 c5             	mov    %eax,%r13d
+  803c3e:	48 98                	cltq
+  803c40:	45 85 ed             	test   %r13d,%r13d
+  803c43:	48 0f 44 45 b0       	cmove  -0x50(%rbp),%rax
+  803c48:	e9 0d fe ff ff       	jmp    803a5a <devfile_read_direct+0x70>
+            map = 0;
+  803c4d:	44 8b 65 b8          	mov    -0x48(%rbp),%r12d
+  803c51:	c6 45 bf 00          	movb   $0x0,-0x41(%rbp)
+  803c55:	e9 39 fe ff ff       	jmp    803a93 <devfile_read_direct+0xa9>
+  803c5a:	48 89 d0             	mov    %rdx,%rax
+  803c5d:	e9 f8 fd ff ff       	jmp    803a5a <devfile_read_direct+0x70>
+
+0000000000803c62 <devfile_read>:
+    if (!fd || !buf)
+  803c62:	48 85 ff             	test   %rdi,%rdi
+  803c65:	0f 84 21 02 00 00    	je     803e8c <devfile_read+0x22a>
+devfile_read(struct Fd *fd, void *buf, size_t n) {
+  803c6b:	55                   	push   %rbp
+  803c6c:	48 89 e5             	mov    %rsp,%rbp
+  803c6f:	41 57                	push   %r15
+  803c71:	41 56                	push   %r14
+  803c73:	41 55                	push   %r13
+  803c75:	41 54                	push   %r12
+  803c77:	53                   	push   %rbx
+  803c78:	48 83 ec 28          	sub    $0x28,%rsp
+  803c7c:	48 89 fb             	mov    %rdi,%rbx
+  803c7f:	49 89 f4             	mov    %rsi,%r12
+  803c82:	49 89 d5             	mov    %rdx,%r13
+        return E_INVAL;
+  803c85:	b8 03 00 00 00       	mov    $0x3,%eax
+    if (!fd || !buf)
+  803c8a:	48 85 f6             	test   %rsi,%rsi
+  803c8d:	74 4b                	je     803cda <devfile_read+0x78>
+    struct Fbuf *fb = fbuf(fd);
+  803c8f:	48 b8 9f 2f 80 00 00 	movabs $0x802f9f,%rax
+  803c96:	00 00 00 
+  803c99:	ff d0                	call   *%rax
+  803c9b:	49 89 c6             	mov    %rax,%r14
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803c9e:	48 85 c0             	test   %rax,%rax
+  803ca1:	74 22                	je     803cc5 <devfile_read+0x63>
+  803ca3:	49 81 fd ff 3f 00 00 	cmp    $0x3fff,%r13
+  803caa:	77 19                	ja     803cc5 <devfile_read+0x63>
+    return sys_region_refs(fd, PAGE_SIZE) > 2;
+  803cac:	be 00 10 00 00       	mov    $0x1000,%esi
+  803cb1:	48 89 df             	mov    %rbx,%rdi
+  803cb4:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  803cbb:	00 00 00 
+  803cbe:	ff d0                	call   *%rax
+    if (!fb || n >= FBUF_SIZE || fbuf_shared(fd)) {
+  803cc0:	83 f8 02             	cmp    $0x2,%eax
+  803cc3:	7e 40                	jle    803d05 <devfile_read+0xa3>
+        int res = fbuf_flush(fd);
+  803cc5:	48 89 df             	mov    %rbx,%rdi
+  803cc8:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  803ccf:	00 00 00 
+  803cd2:	ff d0                	call   *%rax
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803cd4:	85 c0                	test   %eax,%eax
+  803cd6:	79 11                	jns    803ce9 <devfile_read+0x87>
+  803cd8:	48 98                	cltq
+}
+  803cda:	48 83 c4 28          	add    $0x28,%rsp
+  803cde:	5b                   	pop    %rbx
+  803cdf:	41 5c                	pop    %r12
+  803ce1:	41 5d                	pop    %r13
+  803ce3:	41 5e                	pop    %r14
+  803ce5:	41 5f                	pop    %r15
+  803ce7:	5d                   	pop    %rbp
+  803ce8:	c3                   	ret
+        return res < 0 ? res : devfile_read_direct(fd, buf, n, FSREQ_OFFSET_CUR);
+  803ce9:	b9 ff ff ff ff       	mov    $0xffffffff,%ecx
+  803cee:	4c 89 ea             	mov    %r13,%rdx
+  803cf1:	4c 89 e6             	mov    %r12,%rsi
+  803cf4:	48 89 df             	mov    %rbx,%rdi
+  803cf7:	48 b8 ea 39 80 00 00 	movabs $0x8039ea,%rax
+  803cfe:	00 00 00 
+  803d01:	ff d0                	call   *%rax
+  803d03:	eb d5                	jmp    803cda <devfile_read+0x78>
+    off_t pos = fd->fd_offset;
+  803d05:	44 8b 7b 04          	mov    0x4(%rbx),%r15d
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803d09:	48 89 df             	mov    %rbx,%rdi
+  803d0c:	48 b8 ec 36 80 00 00 	movabs $0x8036ec,%rax
+  803d13:	00 00 00 
+  803d16:	ff d0                	call   *%rax
+  803d18:	85 c0                	test   %eax,%eax
+  803d1a:	0f 88 33 01 00 00    	js     803e53 <devfile_read+0x1f1>
+    char *data = FBUF(fb - fbufs);
+  803d20:	48 ba 00 23 82 00 00 	movabs $0x822300,%rdx
+  803d27:	00 00 00 
+  803d2a:	4c 89 f0             	mov    %r14,%rax
+  803d2d:	48 29 d0             	sub    %rdx,%rax
+  803d30:	48 c1 f8 03          	sar    $0x3,%rax
+  803d34:	48 ba ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rdx
+  803d3b:	aa aa aa 
+  803d3e:	48 0f af c2          	imul   %rdx,%rax
+  803d42:	48 c1 e0 0e          	shl    $0xe,%rax
+  803d46:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803d4a:	8b 43 0c             	mov    0xc(%rbx),%eax
+  803d4d:	41 39 06             	cmp    %eax,(%r14)
+  803d50:	75 0d                	jne    803d5f <devfile_read+0xfd>
+  803d52:	8b 43 10             	mov    0x10(%rbx),%eax
+  803d55:	41 39 46 04          	cmp    %eax,0x4(%r14)
+  803d59:	0f 84 fb 00 00 00    	je     803e5a <devfile_read+0x1f8>
+    char *data = FBUF(fb - fbufs);
+  803d5f:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803d64:	48 8b 4d c8          	mov    -0x38(%rbp),%rcx
+  803d68:	48 01 c8             	add    %rcx,%rax
+    if (!is_page_present(data) &&
+  803d6b:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  803d6f:	48 89 c7             	mov    %rax,%rdi
+  803d72:	48 b8 17 5a 80 00 00 	movabs $0x805a17,%rax
+  803d79:	00 00 00 
+  803d7c:	ff d0                	call   *%rax
+  803d7e:	84 c0                	test   %al,%al
+  803d80:	75 27                	jne    803da9 <devfile_read+0x147>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803d82:	b9 06 00 00 00       	mov    $0x6,%ecx
+  803d87:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803d8c:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803d90:	bf 00 00 00 00       	mov    $0x0,%edi
+  803d95:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  803d9c:	00 00 00 
+  803d9f:	ff d0                	call   *%rax
+    if (!is_page_present(data) &&
+  803da1:	85 c0                	test   %eax,%eax
+  803da3:	0f 88 dc 00 00 00    	js     803e85 <devfile_read+0x223>
+    off_t start = ROUNDDOWN(pos, BLKSIZE);
+  803da9:	44 89 f8             	mov    %r15d,%eax
+  803dac:	25 00 f0 ff ff       	and    $0xfffff000,%eax
+  803db1:	89 c1                	mov    %eax,%ecx
+    fb->fb_len = 0;
+  803db3:	49 c7 46 10 00 00 00 	movq   $0x0,0x10(%r14)
+  803dba:	00 
+    fb->fb_gen = fd->fd_file.gen;
+  803dbb:	8b 43 10             	mov    0x10(%rbx),%eax
+  803dbe:	41 89 46 04          	mov    %eax,0x4(%r14)
+    ssize_t n = devfile_read_direct(fd, data, FBUF_SIZE, start);
+  803dc2:	89 4d bc             	mov    %ecx,-0x44(%rbp)
+  803dc5:	ba 00 40 00 00       	mov    $0x4000,%edx
+  803dca:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  803dce:	48 89 df             	mov    %rbx,%rdi
+  803dd1:	48 b8 ea 39 80 00 00 	movabs $0x8039ea,%rax
+  803dd8:	00 00 00 
+  803ddb:	ff d0                	call   *%rax
+    if (n < 0) return n;
+  803ddd:	48 85 c0             	test   %rax,%rax
+  803de0:	0f 88 f4 fe ff ff    	js     803cda <devfile_read+0x78>
+    fb->fb_id = fd->fd_file.id;
+  803de6:	8b 53 0c             	mov    0xc(%rbx),%edx
+  803de9:	41 89 16             	mov    %edx,(%r14)
+    fb->fb_start = start;
+  803dec:	8b 4d bc             	mov    -0x44(%rbp),%ecx
+  803def:	41 89 4e 0c          	mov    %ecx,0xc(%r14)
+    fb->fb_len = n;
+  803df3:	49 89 46 10          	mov    %rax,0x10(%r14)
+    return MAX(start + n - pos, 0);
+  803df7:	48 63 d1             	movslq %ecx,%rdx
+  803dfa:	48 01 d0             	add    %rdx,%rax
+  803dfd:	4d 63 ff             	movslq %r15d,%r15
+  803e00:	4c 29 f8             	sub    %r15,%rax
+  803e03:	ba 00 00 00 00       	mov    $0x0,%edx
+  803e08:	48 0f 48 c2          	cmovs  %rdx,%rax
+    if (res <= 0) return res;
+  803e0c:	48 85 c0             	test   %rax,%rax
+  803e0f:	0f 8e c5 fe ff ff    	jle    803cda <devfile_read+0x78>
+    n = MIN(n, res);
+  803e15:	4c 39 e8             	cmp    %r13,%rax
+  803e18:	4c 0f 46 e8          	cmovbe %rax,%r13
+    memcpy(buf, FBUF(fb - fbufs) + (fd->fd_offset - fb->fb_start), n);
+  803e1c:	8b 73 04             	mov    0x4(%rbx),%esi
+  803e1f:	41 2b 76 0c          	sub    0xc(%r14),%esi
+  803e23:	48 63 f6             	movslq %esi,%rsi
+  803e26:	b8 00 00 00 d1       	mov    $0xd1000000,%eax
+  803e2b:	48 01 c6             	add    %rax,%rsi
+  803e2e:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  803e32:	48 01 c6             	add    %rax,%rsi
+  803e35:	4c 89 ea             	mov    %r13,%rdx
+  803e38:	4c 89 e7             	mov    %r12,%rdi
+  803e3b:	48 b8 5d 18 80 00 00 	movabs $0x80185d,%rax
+  803e42:	00 00 00 
+  803e45:	ff d0                	call   *%rax
+    fd->fd_offset += n;
+  803e47:	44 01 6b 04          	add    %r13d,0x4(%rbx)
+    return n;
+  803e4b:	4c 89 e8             	mov    %r13,%rax
+  803e4e:	e9 87 fe ff ff       	jmp    803cda <devfile_read+0x78>
+    if ((res = fbuf_flush(fd)) < 0) return res;
+  803e53:	48 98                	cltq
+  803e55:	e9 80 fe ff ff       	jmp    803cda <devfile_read+0x78>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803e5a:	41 8b 56 0c          	mov    0xc(%r14),%edx
+    if (fb->fb_id == fd->fd_file.id && fb->fb_gen == fd->fd_file.gen &&
+  803e5e:	41 39 d7             	cmp    %edx,%r15d
+  803e61:	0f 8c f8 fe ff ff    	jl     803d5f <devfile_read+0xfd>
+        pos >= fb->fb_start && pos < fb->fb_start + (off_t)fb->fb_len)
+  803e67:	49 8b 46 10          	mov    0x10(%r14),%rax
+  803e6b:	8d 0c 02             	lea    (%rdx,%rax,1),%ecx
+  803e6e:	41 39 cf             	cmp    %ecx,%r15d
+  803e71:	0f 8d e8 fe ff ff    	jge    803d5f <devfile_read+0xfd>
+        return fb->fb_start + fb->fb_len - pos;
+  803e77:	4d 63 ff             	movslq %r15d,%r15
+  803e7a:	4c 29 f8             	sub    %r15,%rax
+  803e7d:	48 63 d2             	movslq %edx,%rdx
+  803e80:	48 01 d0             	add    %rdx,%rax
+  803e83:	eb 87                	jmp    803e0c <devfile_read+0x1aa>
+        (res = sys_alloc_region(0, data, FBUF_SIZE, PROT_RW)) < 0) return res;
+  803e85:	48 98                	cltq
+  803e87:	e9 4e fe ff ff       	jmp    803cda <devfile_read+0x78>
+        return E_INVAL;
+  803e8c:	b8 03 00 00 00       	mov    $0x3,%eax
+}
+  803e91:	c3                   	ret
+
+0000000000803e92 <fs_channel>:
+fs_channel(bool enable) {
+  803e92:	89 f8                	mov    %edi,%eax
+    fschan_enabled = enable;
+  803e94:	a2 04 26 82 00 00 00 	movabs %al,0x822604
+  803e9b:	00 00 
+    if (!enable || fschan_owner == thisenv->env_id) return 0;
+  803e9d:	ba 00 00 00 00       	mov    $0x0,%edx
+  803ea2:	40 84 ff             	test   %dil,%dil
+  803ea5:	74 47                	je     803eee <fs_channel+0x5c>
+  803ea7:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  803eae:	00 00 00 
+  803eb1:	8b 88 c8 00 00 00    	mov    0xc8(%rax),%ecx
+  803eb7:	48 b8 00 26 82 00 00 	movabs $0x822600,%rax
+  803ebe:	00 00 00 
+  803ec1:	3b 08                	cmp    (%rax),%ecx
+  803ec3:	74 29                	je     803eee <fs_channel+0x5c>
+fs_channel(bool enable) {
+  803ec5:	55                   	push   %rbp
+  803ec6:	48 89 e5             	mov    %rsp,%rbp
+    int res = fschan_setup();
+  803ec9:	48 b8 12 2e 80 00 00 	movabs $0x802e12,%rax
+  803ed0:	00 00 00 
+  803ed3:	ff d0                	call   *%rax
+  803ed5:	89 c2                	mov    %eax,%edx
+    if (res < 0) fschan_enabled = 0;
+  803ed7:	85 c0                	test   %eax,%eax
+  803ed9:	78 04                	js     803edf <fs_channel+0x4d>
+}
+  803edb:	89 d0                	mov    %edx,%eax
+  803edd:	5d                   	pop    %rbp
+  803ede:	c3                   	ret
+    if (res < 0) fschan_enabled = 0;
+  803edf:	48 b8 04 26 82 00 00 	movabs $0x822604,%rax
+  803ee6:	00 00 00 
+  803ee9:	c6 00 00             	movb   $0x0,(%rax)
+  803eec:	eb ed                	jmp    803edb <fs_channel+0x49>
+}
+  803eee:	89 d0                	mov    %edx,%eax
+  803ef0:	c3                   	ret
+
+0000000000803ef1 <open>:
+open(const char *path, int mode) {
+  803ef1:	55                   	push   %rbp
+  803ef2:	48 89 e5             	mov    %rsp,%rbp
+  803ef5:	41 55                	push   %r13
+  803ef7:	41 54                	push   %r12
+  803ef9:	53                   	push   %rbx
+  803efa:	48 83 ec 18          	sub    $0x18,%rsp
+  803efe:	49 89 fc             	mov    %rdi,%r12
+  803f01:	41 89 f5             	mov    %esi,%r13d
+    if (strlen(path) >= MAXPATHLEN)
+  803f04:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  803f0b:	00 00 00 
+  803f0e:	ff d0                	call   *%rax
+  803f10:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  803f16:	0f 87 8f 00 00 00    	ja     803fab <open+0xba>
+    if ((res = fd_alloc(&fd)) < 0) return res;
+  803f1c:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  803f20:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  803f27:	00 00 00 
+  803f2a:	ff d0                	call   *%rax
+  803f2c:	89 c3                	mov    %eax,%ebx
+  803f2e:	85 c0                	test   %eax,%eax
+  803f30:	78 55                	js     803f87 <open+0x96>
+    strcpy(fsipcbuf.open.req_path, path);
+  803f32:	4c 89 e6             	mov    %r12,%rsi
+  803f35:	48 bb 00 00 83 00 00 	movabs $0x830000,%rbx
+  803f3c:	00 00 00 
+  803f3f:	48 89 df             	mov    %rbx,%rdi
+  803f42:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  803f49:	00 00 00 
+  803f4c:	ff d0                	call   *%rax
+    fsipcbuf.open.req_omode = mode;
+  803f4e:	44 89 ab 00 04 00 00 	mov    %r13d,0x400(%rbx)
+    if ((res = fsipc(FSREQ_OPEN, fd, 0)) < 0) {
+  803f55:	ba 00 00 00 00       	mov    $0x0,%edx
+  803f5a:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  803f5e:	bf 01 00 00 00       	mov    $0x1,%edi
+  803f63:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  803f6a:	00 00 00 
+  803f6d:	ff d0                	call   *%rax
+  803f6f:	89 c3                	mov    %eax,%ebx
+  803f71:	85 c0                	test   %eax,%eax
+  803f73:	78 1f                	js     803f94 <open+0xa3>
+    return fd2num(fd);
+  803f75:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f79:	48 b8 9e 26 80 00 00 	movabs $0x80269e,%rax
+  803f80:	00 00 00 
+  803f83:	ff d0                	call   *%rax
+  803f85:	89 c3                	mov    %eax,%ebx
+}
+  803f87:	89 d8                	mov    %ebx,%eax
+  803f89:	48 83 c4 18          	add    $0x18,%rsp
+  803f8d:	5b                   	pop    %rbx
+  803f8e:	41 5c                	pop    %r12
+  803f90:	41 5d                	pop    %r13
+  803f92:	5d                   	pop    %rbp
+  803f93:	c3                   	ret
+        fd_close(fd, 0);
+  803f94:	be 00 00 00 00       	mov    $0x0,%esi
+  803f99:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  803f9d:	48 b8 e7 27 80 00 00 	movabs $0x8027e7,%rax
+  803fa4:	00 00 00 
+  803fa7:	ff d0                	call   *%rax
+        return res;
+  803fa9:	eb dc                	jmp    803f87 <open+0x96>
+        return -E_BAD_PATH;
+  803fab:	bb f0 ff ff ff       	mov    $0xfffffff0,%ebx
+  803fb0:	eb d5                	jmp    803f87 <open+0x96>
+
+0000000000803fb2 <file_flush_buffers>:
+file_flush_buffers(void) {
+  803fb2:	55                   	push   %rbp
+  803fb3:	48 89 e5             	mov    %rsp,%rbp
+  803fb6:	41 56                	push   %r14
+  803fb8:	41 55                	push   %r13
+  803fba:	41 54                	push   %r12
+  803fbc:	53                   	push   %rbx
+  803fbd:	48 83 ec 10          	sub    $0x10,%rsp
+    for (int i = 0; i < MAXFD; i++)
+  803fc1:	49 bc 08 23 82 00 00 	movabs $0x822308,%r12
+  803fc8:	00 00 00 
+  803fcb:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803fd0:	49 bd 2c 27 80 00 00 	movabs $0x80272c,%r13
+  803fd7:	00 00 00 
+  803fda:	49 be ec 36 80 00 00 	movabs $0x8036ec,%r14
+  803fe1:	00 00 00 
+  803fe4:	eb 0c                	jmp    803ff2 <file_flush_buffers+0x40>
+    for (int i = 0; i < MAXFD; i++)
+  803fe6:	83 c3 01             	add    $0x1,%ebx
+  803fe9:	49 83 c4 18          	add    $0x18,%r12
+  803fed:	83 fb 20             	cmp    $0x20,%ebx
+  803ff0:	74 1d                	je     80400f <file_flush_buffers+0x5d>
+        if (fbufs[i].fb_dirty && fd_lookup(i, &fd) >= 0) fbuf_flush(fd);
+  803ff2:	41 80 3c 24 00       	cmpb   $0x0,(%r12)
+  803ff7:	74 ed                	je     803fe6 <file_flush_buffers+0x34>
+  803ff9:	48 8d 75 d8          	lea    -0x28(%rbp),%rsi
+  803ffd:	89 df                	mov    %ebx,%edi
+  803fff:	41 ff d5             	call   *%r13
+  804002:	85 c0                	test   %eax,%eax
+  804004:	78 e0                	js     803fe6 <file_flush_buffers+0x34>
+  804006:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  80400a:	41 ff d6             	call   *%r14
+  80400d:	eb d7                	jmp    803fe6 <file_flush_buffers+0x34>
+}
+  80400f:	48 83 c4 10          	add    $0x10,%rsp
+  804013:	5b                   	pop    %rbx
+  804014:	41 5c                	pop    %r12
+  804016:	41 5d                	pop    %r13
+  804018:	41 5e                	pop    %r14
+  80401a:	5d                   	pop    %rbp
+  80401b:	c3                   	ret
+
+000000000080401c <devfile_trunc>:
+devfile_trunc(struct Fd *fd, off_t newsize) {
+  80401c:	55                   	push   %rbp
+  80401d:	48 89 e5             	mov    %rsp,%rbp
+  804020:	41 54                	push   %r12
+  804022:	53                   	push   %rbx
+  804023:	49 89 fc             	mov    %rdi,%r12
+  804026:	89 f3                	mov    %esi,%ebx
+    file_flush_buffers();
+  804028:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80402f:	00 00 00 
+  804032:	ff d0                	call   *%rax
+    fsipcbuf.set_size.req_fileid = fd->fd_file.id;
+  804034:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80403b:	00 00 00 
+  80403e:	41 8b 54 24 0c       	mov    0xc(%r12),%edx
+  804043:	89 10                	mov    %edx,(%rax)
+    fsipcbuf.set_size.req_size = newsize;
+  804045:	89 58 04             	mov    %ebx,0x4(%rax)
+    return fsipc(FSREQ_SET_SIZE, NULL, 0);
+  804048:	ba 00 00 00 00       	mov    $0x0,%edx
+  80404d:	be 00 00 00 00       	mov    $0x0,%esi
+  804052:	bf 02 00 00 00       	mov    $0x2,%edi
+  804057:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  80405e:	00 00 00 
+  804061:	ff d0                	call   *%rax
+}
+  804063:	5b                   	pop    %rbx
+  804064:	41 5c                	pop    %r12
+  804066:	5d                   	pop    %rbp
+  804067:	c3                   	ret
+
+0000000000804068 <devfile_stat>:
+devfile_stat(struct Fd *fd, struct Stat *st) {
+  804068:	55                   	push   %rbp
+  804069:	48 89 e5             	mov    %rsp,%rbp
+  80406c:	41 54                	push   %r12
+  80406e:	53                   	push   %rbx
+  80406f:	49 89 fc             	mov    %rdi,%r12
+  804072:	48 89 f3             	mov    %rsi,%rbx
+    file_flush_buffers();
+  804075:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80407c:	00 00 00 
+  80407f:	ff d0                	call   *%rax
+    fsipcbuf.stat.req_fileid = fd->fd_file.id;
+  804081:	41 8b 44 24 0c       	mov    0xc(%r12),%eax
+  804086:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  80408d:	00 00 
+    int res = fsipc(FSREQ_STAT, NULL, 0);
+  80408f:	ba 00 00 00 00       	mov    $0x0,%edx
+  804094:	be 00 00 00 00       	mov    $0x0,%esi
+  804099:	bf 05 00 00 00       	mov    $0x5,%edi
+  80409e:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  8040a5:	00 00 00 
+  8040a8:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8040aa:	85 c0                	test   %eax,%eax
+  8040ac:	78 3d                	js     8040eb <devfile_stat+0x83>
+    strcpy(st->st_name, fsipcbuf.statRet.ret_name);
+  8040ae:	49 bc 00 00 83 00 00 	movabs $0x830000,%r12
+  8040b5:	00 00 00 
+  8040b8:	4c 89 e6             	mov    %r12,%rsi
+  8040bb:	48 89 df             	mov    %rbx,%rdi
+  8040be:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  8040c5:	00 00 00 
+  8040c8:	ff d0                	call   *%rax
+    st->st_size = fsipcbuf.statRet.ret_size;
+  8040ca:	41 8b 84 24 80 00 00 	mov    0x80(%r12),%eax
+  8040d1:	00 
+  8040d2:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    st->st_isdir = fsipcbuf.statRet.ret_isdir;
+  8040d8:	41 8b 84 24 84 00 00 	mov    0x84(%r12),%eax
+  8040df:	00 
+  8040e0:	89 83 84 00 00 00    	mov    %eax,0x84(%rbx)
+    return 0;
+  8040e6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8040eb:	5b                   	pop    %rbx
+  8040ec:	41 5c                	pop    %r12
+  8040ee:	5d                   	pop    %rbp
+  8040ef:	c3                   	ret
+
+00000000008040f0 <remove>:
+remove(const char *path) {
+  8040f0:	55                   	push   %rbp
+  8040f1:	48 89 e5             	mov    %rsp,%rbp
+  8040f4:	53                   	push   %rbx
+  8040f5:	48 83 ec 08          	sub    $0x8,%rsp
+  8040f9:	48 89 fb             	mov    %rdi,%rbx
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  8040fc:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  804103:	00 00 00 
+  804106:	ff d0                	call   *%rax
+  804108:	48 3d ff 03 00 00    	cmp    $0x3ff,%rax
+  80410e:	77 3a                	ja     80414a <remove+0x5a>
+    strcpy(fsipcbuf.remove.req_path, path);
+  804110:	48 89 de             	mov    %rbx,%rsi
+  804113:	48 bf 00 00 83 00 00 	movabs $0x830000,%rdi
+  80411a:	00 00 00 
+  80411d:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  804124:	00 00 00 
+  804127:	ff d0                	call   *%rax
+    return fsipc(FSREQ_REMOVE, NULL, 0);
+  804129:	ba 00 00 00 00       	mov    $0x0,%edx
+  80412e:	be 00 00 00 00       	mov    $0x0,%esi
+  804133:	bf 07 00 00 00       	mov    $0x7,%edi
+  804138:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  80413f:	00 00 00 
+  804142:	ff d0                	call   *%rax
+}
+  804144:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804148:	c9                   	leave
+  804149:	c3                   	ret
+    if (strlen(path) >= MAXPATHLEN) return -E_BAD_PATH;
+  80414a:	b8 f0 ff ff ff       	mov    $0xfffffff0,%eax
+  80414f:	eb f3                	jmp    804144 <remove+0x54>
+
+0000000000804151 <sync>:
+sync(void) {
+  804151:	55                   	push   %rbp
+  804152:	48 89 e5             	mov    %rsp,%rbp
+    file_flush_buffers();
+  804155:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  80415c:	00 00 00 
+  80415f:	ff d0                	call   *%rax
+    return fsipc(FSREQ_SYNC, NULL, 0);
+  804161:	ba 00 00 00 00       	mov    $0x0,%edx
+  804166:	be 00 00 00 00       	mov    $0x0,%esi
+  80416b:	bf 08 00 00 00       	mov    $0x8,%edi
+  804170:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  804177:	00 00 00 
+  80417a:	ff d0                	call   *%rax
+}
+  80417c:	5d                   	pop    %rbp
+  80417d:	c3                   	ret
+
+000000000080417e <fsync>:
+fsync(int fdnum) {
+  80417e:	55                   	push   %rbp
+  80417f:	48 89 e5             	mov    %rsp,%rbp
+  804182:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  804186:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  80418a:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  804191:	00 00 00 
+  804194:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804196:	85 c0                	test   %eax,%eax
+  804198:	78 4b                	js     8041e5 <fsync+0x67>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80419a:	48 8b 55 f8          	mov    -0x8(%rbp),%rdx
+  80419e:	48 b8 60 70 80 00 00 	movabs $0x807060,%rax
+  8041a5:	00 00 00 
+  8041a8:	8b 00                	mov    (%rax),%eax
+  8041aa:	39 02                	cmp    %eax,(%rdx)
+  8041ac:	75 39                	jne    8041e7 <fsync+0x69>
+    file_flush_buffers();
+  8041ae:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  8041b5:	00 00 00 
+  8041b8:	ff d0                	call   *%rax
+    fsipcbuf.fsync.req_fileid = fd->fd_file.id;
+  8041ba:	48 8b 45 f8          	mov    -0x8(%rbp),%rax
+  8041be:	8b 40 0c             	mov    0xc(%rax),%eax
+  8041c1:	a3 00 00 83 00 00 00 	movabs %eax,0x830000
+  8041c8:	00 00 
+    return fsipc(FSREQ_FSYNC, NULL, 0);
+  8041ca:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041cf:	be 00 00 00 00       	mov    $0x0,%esi
+  8041d4:	bf 0d 00 00 00       	mov    $0xd,%edi
+  8041d9:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  8041e0:	00 00 00 
+  8041e3:	ff d0                	call   *%rax
+}
+  8041e5:	c9                   	leave
+  8041e6:	c3                   	ret
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  8041e7:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  8041ec:	eb f7                	jmp    8041e5 <fsync+0x67>
+
+00000000008041ee <disk_stat>:
+disk_stat(struct DiskStat *st) {
+  8041ee:	55                   	push   %rbp
+  8041ef:	48 89 e5             	mov    %rsp,%rbp
+  8041f2:	53                   	push   %rbx
+  8041f3:	48 83 ec 08          	sub    $0x8,%rsp
+  8041f7:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_DISKSTAT, NULL, 0);
+  8041fa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8041ff:	be 00 00 00 00       	mov    $0x0,%esi
+  804204:	bf 0b 00 00 00       	mov    $0xb,%edi
+  804209:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  804210:	00 00 00 
+  804213:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804215:	85 c0                	test   %eax,%eax
+  804217:	78 2d                	js     804246 <disk_stat+0x58>
+    *st = fsipcbuf.diskstatRet;
+  804219:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  804220:	00 00 00 
+  804223:	48 8b 10             	mov    (%rax),%rdx
+  804226:	48 89 13             	mov    %rdx,(%rbx)
+  804229:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80422d:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  804231:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804235:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804239:	48 8b 40 18          	mov    0x18(%rax),%rax
+  80423d:	48 89 43 18          	mov    %rax,0x18(%rbx)
+    return 0;
+  804241:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  804246:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  80424a:	c9                   	leave
+  80424b:	c3                   	ret
+
+000000000080424c <cache_stat>:
+cache_stat(struct CacheStat *st) {
+  80424c:	55                   	push   %rbp
+  80424d:	48 89 e5             	mov    %rsp,%rbp
+  804250:	53                   	push   %rbx
+  804251:	48 83 ec 08          	sub    $0x8,%rsp
+  804255:	48 89 fb             	mov    %rdi,%rbx
+    int res = fsipc(FSREQ_CACHESTAT, NULL, 0);
+  804258:	ba 00 00 00 00       	mov    $0x0,%edx
+  80425d:	be 00 00 00 00       	mov    $0x0,%esi
+  804262:	bf 0c 00 00 00       	mov    $0xc,%edi
+  804267:	48 b8 83 34 80 00 00 	movabs $0x803483,%rax
+  80426e:	00 00 00 
+  804271:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  804273:	85 c0                	test   %eax,%eax
+  804275:	78 3d                	js     8042b4 <cache_stat+0x68>
+    *st = fsipcbuf.cachestatRet;
+  804277:	48 b8 00 00 83 00 00 	movabs $0x830000,%rax
+  80427e:	00 00 00 
+  804281:	48 8b 10             	mov    (%rax),%rdx
+  804284:	48 89 13             	mov    %rdx,(%rbx)
+  804287:	48 8b 50 08          	mov    0x8(%rax),%rdx
+  80428b:	48 89 53 08          	mov    %rdx,0x8(%rbx)
+  80428f:	48 8b 50 10          	mov    0x10(%rax),%rdx
+  804293:	48 89 53 10          	mov    %rdx,0x10(%rbx)
+  804297:	48 8b 50 18          	mov    0x18(%rax),%rdx
+  80429b:	48 89 53 18          	mov    %rdx,0x18(%rbx)
+  80429f:	48 8b 50 20          	mov    0x20(%rax),%rdx
+  8042a3:	48 89 53 20          	mov    %rdx,0x20(%rbx)
+  8042a7:	48 8b 40 28          	mov    0x28(%rax),%rax
+  8042ab:	48 89 43 28          	mov    %rax,0x28(%rbx)
+    return 0;
+  8042af:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8042b4:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8042b8:	c9                   	leave
+  8042b9:	c3                   	ret
+
+00000000008042ba <munmap>:
+}
+
+/* Unmap the pages of [addr, addr + len), which
+ * may cover mappings partially or not at all */
+int
+munmap(void *addr, size_t len) {
+  8042ba:	55                   	push   %rbp
+  8042bb:	48 89 e5             	mov    %rsp,%rbp
+  8042be:	41 57                	push   %r15
+  8042c0:	41 56                	push   %r14
+  8042c2:	41 55                	push   %r13
+  8042c4:	41 54                	push   %r12
+  8042c6:	53                   	push   %rbx
+  8042c7:	48 83 ec 08          	sub    $0x8,%rsp
+    uintptr_t start = (uintptr_t)addr;
+    uintptr_t end = ROUNDUP(start + len, PAGE_SIZE);
+  8042cb:	4c 8d b4 37 ff 0f 00 	lea    0xfff(%rdi,%rsi,1),%r14
+  8042d2:	00 
+  8042d3:	49 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%r14
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  8042da:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  8042e0:	0f 85 43 01 00 00    	jne    804429 <munmap+0x16f>
+  8042e6:	49 89 ff             	mov    %rdi,%r15
+  8042e9:	4c 39 f7             	cmp    %r14,%rdi
+  8042ec:	0f 87 37 01 00 00    	ja     804429 <munmap+0x16f>
+  8042f2:	48 bb 00 20 82 00 00 	movabs $0x822000,%rbx
+  8042f9:	00 00 00 
+  8042fc:	41 bd 00 00 40 d0    	mov    $0xd0400000,%r13d
+  804302:	eb 2c                	jmp    804330 <munmap+0x76>
+            if (!tail) return -E_NO_MEM;
+            *tail = *m;
+            tail->mm_start = end;
+            tail->mm_offset += end - m->mm_start;
+            m->mm_end = start;
+        } else if (m->mm_start < start) {
+  804304:	4c 39 f8             	cmp    %r15,%rax
+  804307:	0f 83 85 00 00 00    	jae    804392 <munmap+0xd8>
+            m->mm_end = start;
+  80430d:	4d 89 7c 24 08       	mov    %r15,0x8(%r12)
+    for (size_t i = 0; i < MMAP_MAX; i++) {
+  804312:	48 83 c3 18          	add    $0x18,%rbx
+  804316:	49 81 c5 00 10 00 00 	add    $0x1000,%r13
+  80431d:	48 b8 00 23 82 00 00 	movabs $0x822300,%rax
+  804324:	00 00 00 
+  804327:	48 39 c3             	cmp    %rax,%rbx
+  80432a:	0f 84 d0 00 00 00    	je     804400 <munmap+0x146>
+        if (!m->mm_start || m->mm_start >= end || m->mm_end <= start) continue;
+  804330:	49 89 dc             	mov    %rbx,%r12
+  804333:	48 8b 03             	mov    (%rbx),%rax
+  804336:	4c 39 f0             	cmp    %r14,%rax
+  804339:	73 d7                	jae    804312 <munmap+0x58>
+  80433b:	48 85 c0             	test   %rax,%rax
+  80433e:	74 d2                	je     804312 <munmap+0x58>
+  804340:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804344:	49 39 d7             	cmp    %rdx,%r15
+  804347:	73 c9                	jae    804312 <munmap+0x58>
+        if (m->mm_start < start && m->mm_end > end) {
+  804349:	49 39 d6             	cmp    %rdx,%r14
+  80434c:	73 b6                	jae    804304 <munmap+0x4a>
+  80434e:	49 39 c7             	cmp    %rax,%r15
+  804351:	76 b1                	jbe    804304 <munmap+0x4a>
+            struct Mmap *tail = mmap_alloc(MMAP_FD(i));
+  804353:	4c 89 ef             	mov    %r13,%rdi
+  804356:	48 b8 f1 33 80 00 00 	movabs $0x8033f1,%rax
+  80435d:	00 00 00 
+  804360:	ff d0                	call   *%rax
+            if (!tail) return -E_NO_MEM;
+  804362:	48 85 c0             	test   %rax,%rax
+  804365:	0f 84 c5 00 00 00    	je     804430 <munmap+0x176>
+            *tail = *m;
+  80436b:	48 8b 13             	mov    (%rbx),%rdx
+  80436e:	48 89 10             	mov    %rdx,(%rax)
+  804371:	48 8b 53 08          	mov    0x8(%rbx),%rdx
+  804375:	48 89 50 08          	mov    %rdx,0x8(%rax)
+  804379:	48 8b 53 10          	mov    0x10(%rbx),%rdx
+  80437d:	48 89 50 10          	mov    %rdx,0x10(%rax)
+            tail->mm_start = end;
+  804381:	4c 89 30             	mov    %r14,(%rax)
+            tail->mm_offset += end - m->mm_start;
+  804384:	44 89 f2             	mov    %r14d,%edx
+  804387:	2b 13                	sub    (%rbx),%edx
+  804389:	01 50 10             	add    %edx,0x10(%rax)
+            m->mm_end = start;
+  80438c:	4c 89 7b 08          	mov    %r15,0x8(%rbx)
+        if (m->mm_start < start && m->mm_end > end) {
+  804390:	eb 80                	jmp    804312 <munmap+0x58>
+        } else if (m->mm_end > end) {
+  804392:	49 39 d6             	cmp    %rdx,%r14
+  804395:	73 18                	jae    8043af <munmap+0xf5>
+            m->mm_offset += end - m->mm_start;
+  804397:	44 89 f2             	mov    %r14d,%edx
+  80439a:	41 03 54 24 10       	add    0x10(%r12),%edx
+  80439f:	29 c2                	sub    %eax,%edx
+  8043a1:	41 89 54 24 10       	mov    %edx,0x10(%r12)
+            m->mm_start = end;
+  8043a6:	4d 89 34 24          	mov    %r14,(%r12)
+  8043aa:	e9 63 ff ff ff       	jmp    804312 <munmap+0x58>
+    m->mm_start = 0;
+  8043af:	49 c7 04 24 00 00 00 	movq   $0x0,(%r12)
+  8043b6:	00 
+    sys_unmap_region(0, MMAP_FD(m - mmaps), PAGE_SIZE);
+  8043b7:	4c 89 e6             	mov    %r12,%rsi
+  8043ba:	48 b8 00 20 82 00 00 	movabs $0x822000,%rax
+  8043c1:	00 00 00 
+  8043c4:	48 29 c6             	sub    %rax,%rsi
+  8043c7:	48 c1 fe 03          	sar    $0x3,%rsi
+  8043cb:	48 b8 ab aa aa aa aa 	movabs $0xaaaaaaaaaaaaaaab,%rax
+  8043d2:	aa aa aa 
+  8043d5:	48 0f af f0          	imul   %rax,%rsi
+  8043d9:	48 c1 e6 0c          	shl    $0xc,%rsi
+  8043dd:	b8 00 00 40 d0       	mov    $0xd0400000,%eax
+  8043e2:	48 01 c6             	add    %rax,%rsi
+  8043e5:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8043ea:	bf 00 00 00 00       	mov    $0x0,%edi
+  8043ef:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  8043f6:	00 00 00 
+  8043f9:	ff d0                	call   *%rax
+}
+  8043fb:	e9 12 ff ff ff       	jmp    804312 <munmap+0x58>
+        } else {
+            mmap_free(m);
+        }
+    }
+
+    return sys_unmap_region(0, addr, end - start);
+  804400:	4c 89 f2             	mov    %r14,%rdx
+  804403:	4c 29 fa             	sub    %r15,%rdx
+  804406:	4c 89 fe             	mov    %r15,%rsi
+  804409:	bf 00 00 00 00       	mov    $0x0,%edi
+  80440e:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  804415:	00 00 00 
+  804418:	ff d0                	call   *%rax
+}
+  80441a:	48 83 c4 08          	add    $0x8,%rsp
+  80441e:	5b                   	pop    %rbx
+  80441f:	41 5c                	pop    %r12
+  804421:	41 5d                	pop    %r13
+  804423:	41 5e                	pop    %r14
+  804425:	41 5f                	pop    %r15
+  804427:	5d                   	pop    %rbp
+  804428:	c3                   	ret
+    if (PAGE_OFFSET(start) || end < start) return -E_INVAL;
+  804429:	b8 fd ff ff ff       	mov    $0xfffffffd,%eax
+  80442e:	eb ea                	jmp    80441a <munmap+0x160>
+            if (!tail) return -E_NO_MEM;
+  804430:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+  804435:	eb e3                	jmp    80441a <munmap+0x160>
+
+0000000000804437 <mmap>:
+mmap(void **addr, size_t len, int prot, int flags, int fdnum, off_t offset) {
+  804437:	55                   	push   %rbp
+  804438:	48 89 e5             	mov    %rsp,%rbp
+  80443b:	41 57                	push   %r15
+  80443d:	41 56                	push   %r14
+  80443f:	41 55                	push   %r13
+  804441:	41 54                	push   %r12
+  804443:	53                   	push   %rbx
+  804444:	48 83 ec 28          	sub    $0x28,%rsp
+  804448:	48 89 7d b8          	mov    %rdi,-0x48(%rbp)
+  80444c:	49 89 f5             	mov    %rsi,%r13
+  80444f:	41 89 d6             	mov    %edx,%r14d
+  804452:	89 55 b4             	mov    %edx,-0x4c(%rbp)
+  804455:	41 89 cc             	mov    %ecx,%r12d
+  804458:	44 89 c7             	mov    %r8d,%edi
+  80445b:	44 89 cb             	mov    %r9d,%ebx
+  80445e:	44 89 4d b0          	mov    %r9d,-0x50(%rbp)
+    if ((res = fd_lookup(fdnum, &fd)) < 0) return res;
+  804462:	48 8d 75 c8          	lea    -0x38(%rbp),%rsi
+  804466:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  80446d:	00 00 00 
+  804470:	ff d0                	call   *%rax
+  804472:	41 89 c7             	mov    %eax,%r15d
+  804475:	85 c0                	test   %eax,%eax
+  804477:	0f 88 ae 01 00 00    	js     80462b <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80447d:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  804481:	48 ba 60 70 80 00 00 	movabs $0x807060,%rdx
+  804488:	00 00 00 
+  80448b:	8b 32                	mov    (%rdx),%esi
+  80448d:	39 30                	cmp    %esi,(%rax)
+  80448f:	0f 85 7a 02 00 00    	jne    80470f <mmap+0x2d8>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  804495:	8b 40 08             	mov    0x8(%rax),%eax
+  804498:	83 e0 03             	and    $0x3,%eax
+  80449b:	83 f8 01             	cmp    $0x1,%eax
+  80449e:	0f 84 76 02 00 00    	je     80471a <mmap+0x2e3>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  8044a4:	4d 85 ed             	test   %r13,%r13
+  8044a7:	0f 84 78 02 00 00    	je     804725 <mmap+0x2ee>
+  8044ad:	85 db                	test   %ebx,%ebx
+  8044af:	0f 88 70 02 00 00    	js     804725 <mmap+0x2ee>
+  8044b5:	81 e3 ff 0f 00 00    	and    $0xfff,%ebx
+  8044bb:	41 89 df             	mov    %ebx,%r15d
+  8044be:	0f 85 6c 02 00 00    	jne    804730 <mmap+0x2f9>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  8044c4:	44 89 f0             	mov    %r14d,%eax
+  8044c7:	83 e0 fd             	and    $0xfffffffd,%eax
+  8044ca:	83 f8 04             	cmp    $0x4,%eax
+  8044cd:	0f 85 68 02 00 00    	jne    80473b <mmap+0x304>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  8044d3:	44 89 e1             	mov    %r12d,%ecx
+  8044d6:	83 e1 01             	and    $0x1,%ecx
+  8044d9:	0f 95 c2             	setne  %dl
+  8044dc:	44 89 e0             	mov    %r12d,%eax
+  8044df:	d1 e8                	shr    %eax
+  8044e1:	83 f0 01             	xor    $0x1,%eax
+  8044e4:	83 e0 01             	and    $0x1,%eax
+  8044e7:	38 c2                	cmp    %al,%dl
+  8044e9:	0f 85 57 02 00 00    	jne    804746 <mmap+0x30f>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  8044ef:	85 c9                	test   %ecx,%ecx
+  8044f1:	74 0a                	je     8044fd <mmap+0xc6>
+  8044f3:	41 f6 c6 02          	test   $0x2,%r14b
+  8044f7:	0f 85 54 02 00 00    	jne    804751 <mmap+0x31a>
+    file_flush_buffers();
+  8044fd:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  804504:	00 00 00 
+  804507:	ff d0                	call   *%rax
+    len = ROUNDUP(len, PAGE_SIZE);
+  804509:	49 81 c5 ff 0f 00 00 	add    $0xfff,%r13
+  804510:	49 81 e5 00 f0 ff ff 	and    $0xfffffffffffff000,%r13
+    uintptr_t va = (uintptr_t)*addr;
+  804517:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  80451b:	48 8b 38             	mov    (%rax),%rdi
+    if (flags & MAP_FIXED) {
+  80451e:	41 f6 c4 04          	test   $0x4,%r12b
+  804522:	0f 84 15 01 00 00    	je     80463d <mmap+0x206>
+    uintptr_t va = (uintptr_t)*addr;
+  804528:	48 89 fb             	mov    %rdi,%rbx
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80452b:	f7 c7 ff 0f 00 00    	test   $0xfff,%edi
+  804531:	0f 85 25 02 00 00    	jne    80475c <mmap+0x325>
+  804537:	4a 8d 04 2f          	lea    (%rdi,%r13,1),%rax
+  80453b:	48 ba 00 00 00 00 80 	movabs $0x8000000000,%rdx
+  804542:	00 00 00 
+  804545:	48 39 c2             	cmp    %rax,%rdx
+  804548:	0f 82 19 02 00 00    	jb     804767 <mmap+0x330>
+  80454e:	48 39 c7             	cmp    %rax,%rdi
+  804551:	0f 87 10 02 00 00    	ja     804767 <mmap+0x330>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  804557:	4c 89 ee             	mov    %r13,%rsi
+  80455a:	48 b8 ba 42 80 00 00 	movabs $0x8042ba,%rax
+  804561:	00 00 00 
+  804564:	ff d0                	call   *%rax
+  804566:	85 c0                	test   %eax,%eax
+  804568:	0f 88 04 02 00 00    	js     804772 <mmap+0x33b>
+    if (!handler) {
+  80456e:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  804575:	00 00 00 
+  804578:	80 38 00             	cmpb   $0x0,(%rax)
+  80457b:	75 2b                	jne    8045a8 <mmap+0x171>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  80457d:	48 bf 52 33 80 00 00 	movabs $0x803352,%rdi
+  804584:	00 00 00 
+  804587:	48 b8 d4 5f 80 00 00 	movabs $0x805fd4,%rax
+  80458e:	00 00 00 
+  804591:	ff d0                	call   *%rax
+  804593:	85 c0                	test   %eax,%eax
+  804595:	0f 88 ea 01 00 00    	js     804785 <mmap+0x34e>
+        handler = 1;
+  80459b:	48 b8 00 00 82 00 00 	movabs $0x820000,%rax
+  8045a2:	00 00 00 
+  8045a5:	c6 00 01             	movb   $0x1,(%rax)
+    struct Mmap *m = mmap_alloc(fd);
+  8045a8:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8045ac:	48 b8 f1 33 80 00 00 	movabs $0x8033f1,%rax
+  8045b3:	00 00 00 
+  8045b6:	ff d0                	call   *%rax
+  8045b8:	49 89 c6             	mov    %rax,%r14
+    if (!m) return -E_NO_MEM;
+  8045bb:	48 85 c0             	test   %rax,%rax
+  8045be:	0f 84 c9 01 00 00    	je     80478d <mmap+0x356>
+    m->mm_start = va;
+  8045c4:	48 89 18             	mov    %rbx,(%rax)
+    m->mm_end = va + len;
+  8045c7:	4a 8d 14 2b          	lea    (%rbx,%r13,1),%rdx
+  8045cb:	48 89 50 08          	mov    %rdx,0x8(%rax)
+    m->mm_offset = offset;
+  8045cf:	8b 45 b0             	mov    -0x50(%rbp),%eax
+  8045d2:	41 89 46 10          	mov    %eax,0x10(%r14)
+    m->mm_perm = prot | (flags & MAP_PRIVATE ? PROT_LAZY : 0);
+  8045d6:	44 89 e0             	mov    %r12d,%eax
+  8045d9:	c1 e0 06             	shl    $0x6,%eax
+  8045dc:	25 80 00 00 00       	and    $0x80,%eax
+  8045e1:	8b 75 b4             	mov    -0x4c(%rbp),%esi
+  8045e4:	09 f0                	or     %esi,%eax
+  8045e6:	41 89 46 14          	mov    %eax,0x14(%r14)
+    if (flags & MAP_POPULATE) {
+  8045ea:	41 f6 c4 08          	test   $0x8,%r12b
+  8045ee:	74 31                	je     804621 <mmap+0x1ea>
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  8045f0:	48 39 d3             	cmp    %rdx,%rbx
+  8045f3:	73 2c                	jae    804621 <mmap+0x1ea>
+  8045f5:	ba 00 00 04 00       	mov    $0x40000,%edx
+  8045fa:	48 89 de             	mov    %rbx,%rsi
+  8045fd:	4c 89 f7             	mov    %r14,%rdi
+  804600:	48 b8 41 32 80 00 00 	movabs $0x803241,%rax
+  804607:	00 00 00 
+  80460a:	ff d0                	call   *%rax
+  80460c:	49 89 c4             	mov    %rax,%r12
+  80460f:	48 85 c0             	test   %rax,%rax
+  804612:	0f 8e d7 00 00 00    	jle    8046ef <mmap+0x2b8>
+            va += n;
+  804618:	4c 01 e3             	add    %r12,%rbx
+        while (va < m->mm_end && (n = mmap_fault(m, va, FSMAP_MAX_SIZE)) > 0)
+  80461b:	49 3b 5e 08          	cmp    0x8(%r14),%rbx
+  80461f:	72 d4                	jb     8045f5 <mmap+0x1be>
+    *addr = (void *)m->mm_start;
+  804621:	49 8b 06             	mov    (%r14),%rax
+  804624:	48 8b 75 b8          	mov    -0x48(%rbp),%rsi
+  804628:	48 89 06             	mov    %rax,(%rsi)
+}
+  80462b:	44 89 f8             	mov    %r15d,%eax
+  80462e:	48 83 c4 28          	add    $0x28,%rsp
+  804632:	5b                   	pop    %rbx
+  804633:	41 5c                	pop    %r12
+  804635:	41 5d                	pop    %r13
+  804637:	41 5e                	pop    %r14
+  804639:	41 5f                	pop    %r15
+  80463b:	5d                   	pop    %rbp
+  80463c:	c3                   	ret
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80463d:	48 ba 00 00 00 00 60 	movabs $0x6000000000,%rdx
+  804644:	00 00 00 
+  804647:	4c 01 ea             	add    %r13,%rdx
+    uintptr_t va = MMAP_VA;
+  80464a:	48 bb 00 00 00 00 60 	movabs $0x6000000000,%rbx
+  804651:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804654:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  804659:	48 be 00 20 82 00 00 	movabs $0x822000,%rsi
+  804660:	00 00 00 
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  804663:	48 bf 00 00 00 00 70 	movabs $0x7000000000,%rdi
+  80466a:	00 00 00 
+  80466d:	48 39 d7             	cmp    %rdx,%rdi
+  804670:	73 1c                	jae    80468e <mmap+0x257>
+        return -E_NO_MEM;
+  804672:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804678:	eb b1                	jmp    80462b <mmap+0x1f4>
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  80467a:	48 83 c0 01          	add    $0x1,%rax
+  80467e:	48 83 f8 1f          	cmp    $0x1f,%rax
+  804682:	77 3f                	ja     8046c3 <mmap+0x28c>
+  804684:	49 8d 54 1d 00       	lea    0x0(%r13,%rbx,1),%rdx
+  804689:	48 39 d7             	cmp    %rdx,%rdi
+  80468c:	72 2a                	jb     8046b8 <mmap+0x281>
+        if (mmaps[i].mm_start && mmaps[i].mm_start < va + len && mmaps[i].mm_end > va) {
+  80468e:	48 8d 0c 40          	lea    (%rax,%rax,2),%rcx
+  804692:	48 8b 0c ce          	mov    (%rsi,%rcx,8),%rcx
+  804696:	48 39 d1             	cmp    %rdx,%rcx
+  804699:	73 df                	jae    80467a <mmap+0x243>
+  80469b:	48 85 c9             	test   %rcx,%rcx
+  80469e:	74 da                	je     80467a <mmap+0x243>
+  8046a0:	48 8d 14 40          	lea    (%rax,%rax,2),%rdx
+  8046a4:	48 8b 54 d6 08       	mov    0x8(%rsi,%rdx,8),%rdx
+  8046a9:	48 39 d3             	cmp    %rdx,%rbx
+  8046ac:	73 cc                	jae    80467a <mmap+0x243>
+            va = mmaps[i].mm_end;
+  8046ae:	48 89 d3             	mov    %rdx,%rbx
+    for (size_t i = 0; i < MMAP_MAX && va + len <= MMAP_VA + MMAP_SIZE; i++) {
+  8046b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8046b6:	eb cc                	jmp    804684 <mmap+0x24d>
+        return -E_NO_MEM;
+  8046b8:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8046be:	e9 68 ff ff ff       	jmp    80462b <mmap+0x1f4>
+    return va + len <= MMAP_VA + MMAP_SIZE ? va : 0;
+  8046c3:	49 8d 44 1d 00       	lea    0x0(%r13,%rbx,1),%rax
+  8046c8:	48 ba 00 00 00 00 70 	movabs $0x7000000000,%rdx
+  8046cf:	00 00 00 
+  8046d2:	48 39 c2             	cmp    %rax,%rdx
+  8046d5:	0f 82 9f 00 00 00    	jb     80477a <mmap+0x343>
+    } else if (!(va = mmap_place(len))) {
+  8046db:	48 85 db             	test   %rbx,%rbx
+  8046de:	0f 85 8a fe ff ff    	jne    80456e <mmap+0x137>
+        return -E_NO_MEM;
+  8046e4:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  8046ea:	e9 3c ff ff ff       	jmp    80462b <mmap+0x1f4>
+        if (n < 0) {
+  8046ef:	0f 89 2c ff ff ff    	jns    804621 <mmap+0x1ea>
+            munmap((void *)m->mm_start, len);
+  8046f5:	49 8b 3e             	mov    (%r14),%rdi
+  8046f8:	4c 89 ee             	mov    %r13,%rsi
+  8046fb:	48 b8 ba 42 80 00 00 	movabs $0x8042ba,%rax
+  804702:	00 00 00 
+  804705:	ff d0                	call   *%rax
+            return n;
+  804707:	45 89 e7             	mov    %r12d,%r15d
+  80470a:	e9 1c ff ff ff       	jmp    80462b <mmap+0x1f4>
+    if (fd->fd_dev_id != devfile.dev_id) return -E_INVAL;
+  80470f:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804715:	e9 11 ff ff ff       	jmp    80462b <mmap+0x1f4>
+    if ((fd->fd_omode & O_ACCMODE) == O_WRONLY) return -E_INVAL;
+  80471a:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804720:	e9 06 ff ff ff       	jmp    80462b <mmap+0x1f4>
+    if (!len || offset < 0 || PAGE_OFFSET(offset)) return -E_INVAL;
+  804725:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80472b:	e9 fb fe ff ff       	jmp    80462b <mmap+0x1f4>
+  804730:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804736:	e9 f0 fe ff ff       	jmp    80462b <mmap+0x1f4>
+    if (!(prot & PROT_R) || prot & ~PROT_RW) return -E_INVAL;
+  80473b:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804741:	e9 e5 fe ff ff       	jmp    80462b <mmap+0x1f4>
+    if (!(flags & MAP_SHARED) == !(flags & MAP_PRIVATE)) return -E_INVAL;
+  804746:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80474c:	e9 da fe ff ff       	jmp    80462b <mmap+0x1f4>
+    if (flags & MAP_SHARED && prot & PROT_W) return -E_NOT_SUPP;
+  804751:	41 bf ed ff ff ff    	mov    $0xffffffed,%r15d
+  804757:	e9 cf fe ff ff       	jmp    80462b <mmap+0x1f4>
+        if (PAGE_OFFSET(va) || va + len > MAX_USER_ADDRESS || va + len < va) return -E_INVAL;
+  80475c:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  804762:	e9 c4 fe ff ff       	jmp    80462b <mmap+0x1f4>
+  804767:	41 bf fd ff ff ff    	mov    $0xfffffffd,%r15d
+  80476d:	e9 b9 fe ff ff       	jmp    80462b <mmap+0x1f4>
+        if ((res = munmap(*addr, len)) < 0) return res;
+  804772:	41 89 c7             	mov    %eax,%r15d
+  804775:	e9 b1 fe ff ff       	jmp    80462b <mmap+0x1f4>
+        return -E_NO_MEM;
+  80477a:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804780:	e9 a6 fe ff ff       	jmp    80462b <mmap+0x1f4>
+        if ((res = add_pgfault_handler(mmap_pgfault)) < 0) return res;
+  804785:	41 89 c7             	mov    %eax,%r15d
+  804788:	e9 9e fe ff ff       	jmp    80462b <mmap+0x1f4>
+    if (!m) return -E_NO_MEM;
+  80478d:	41 bf fc ff ff ff    	mov    $0xfffffffc,%r15d
+  804793:	e9 93 fe ff ff       	jmp    80462b <mmap+0x1f4>
+
+0000000000804798 <writebuf>:
+    char buf[PRINTBUFSZ];
+};
+
+static void
+writebuf(struct printbuf *state) {
+    if (state->error > 0) {
+  804798:	83 7f 10 00          	cmpl   $0x0,0x10(%rdi)
+  80479c:	7f 01                	jg     80479f <writebuf+0x7>
+  80479e:	c3                   	ret
+writebuf(struct printbuf *state) {
+  80479f:	55                   	push   %rbp
+  8047a0:	48 89 e5             	mov    %rsp,%rbp
+  8047a3:	53                   	push   %rbx
+  8047a4:	48 83 ec 08          	sub    $0x8,%rsp
+  8047a8:	48 89 fb             	mov    %rdi,%rbx
+        ssize_t result = write(state->fd, state->buf, state->offset);
+  8047ab:	48 63 57 04          	movslq 0x4(%rdi),%rdx
+  8047af:	48 8d 77 14          	lea    0x14(%rdi),%rsi
+  8047b3:	8b 3f                	mov    (%rdi),%edi
+  8047b5:	48 b8 3e 2b 80 00 00 	movabs $0x802b3e,%rax
+  8047bc:	00 00 00 
+  8047bf:	ff d0                	call   *%rax
+        if (result > 0) state->result += result;
+  8047c1:	48 85 c0             	test   %rax,%rax
+  8047c4:	7e 04                	jle    8047ca <writebuf+0x32>
+  8047c6:	48 01 43 08          	add    %rax,0x8(%rbx)
+
+        /* Error, or wrote less than supplied */
+        if (result != state->offset)
+  8047ca:	48 63 53 04          	movslq 0x4(%rbx),%rdx
+  8047ce:	48 39 c2             	cmp    %rax,%rdx
+  8047d1:	74 0f                	je     8047e2 <writebuf+0x4a>
+            state->error = MIN(0, result);
+  8047d3:	48 85 c0             	test   %rax,%rax
+  8047d6:	ba 00 00 00 00       	mov    $0x0,%edx
+  8047db:	48 0f 4f c2          	cmovg  %rdx,%rax
+  8047df:	89 43 10             	mov    %eax,0x10(%rbx)
+    }
+}
+  8047e2:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  8047e6:	c9                   	leave
+  8047e7:	c3                   	ret
+
+00000000008047e8 <putch>:
+
+static void
+putch(int ch, void *arg) {
+    struct printbuf *state = (struct printbuf *)arg;
+    state->buf[state->offset++] = ch;
+  8047e8:	8b 46 04             	mov    0x4(%rsi),%eax
+  8047eb:	8d 50 01             	lea    0x1(%rax),%edx
+  8047ee:	89 56 04             	mov    %edx,0x4(%rsi)
+  8047f1:	48 98                	cltq
+  8047f3:	40 88 7c 06 14       	mov    %dil,0x14(%rsi,%rax,1)
+    if (state->offset == PRINTBUFSZ) {
+  8047f8:	81 fa 00 01 00 00    	cmp    $0x100,%edx
+  8047fe:	74 01                	je     804801 <putch+0x19>
+  804800:	c3                   	ret
+putch(int ch, void *arg) {
+  804801:	55                   	push   %rbp
+  804802:	48 89 e5             	mov    %rsp,%rbp
+  804805:	53                   	push   %rbx
+  804806:	48 83 ec 08          	sub    $0x8,%rsp
+  80480a:	48 89 f3             	mov    %rsi,%rbx
+        writebuf(state);
+  80480d:	48 89 f7             	mov    %rsi,%rdi
+  804810:	48 b8 98 47 80 00 00 	movabs $0x804798,%rax
+  804817:	00 00 00 
+  80481a:	ff d0                	call   *%rax
+        state->offset = 0;
+  80481c:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    }
+}
+  804823:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  804827:	c9                   	leave
+  804828:	c3                   	ret
+
+0000000000804829 <vfprintf>:
+
+int
+vfprintf(int fd, const char *fmt, va_list ap) {
+  804829:	55                   	push   %rbp
+  80482a:	48 89 e5             	mov    %rsp,%rbp
+  80482d:	48 81 ec 20 01 00 00 	sub    $0x120,%rsp
+  804834:	48 89 d1             	mov    %rdx,%rcx
+    struct printbuf state;
+    state.fd = fd;
+  804837:	89 bd e8 fe ff ff    	mov    %edi,-0x118(%rbp)
+    state.offset = 0;
+  80483d:	c7 85 ec fe ff ff 00 	movl   $0x0,-0x114(%rbp)
+  804844:	00 00 00 
+    state.result = 0;
+  804847:	48 c7 85 f0 fe ff ff 	movq   $0x0,-0x110(%rbp)
+  80484e:	00 00 00 00 
+    state.error = 1;
+  804852:	c7 85 f8 fe ff ff 01 	movl   $0x1,-0x108(%rbp)
+  804859:	00 00 00 
+
+    vprintfmt(putch, &state, fmt, ap);
+  80485c:	48 89 f2             	mov    %rsi,%rdx
+  80485f:	48 8d b5 e8 fe ff ff 	lea    -0x118(%rbp),%rsi
+  804866:	48 bf e8 47 80 00 00 	movabs $0x8047e8,%rdi
+  80486d:	00 00 00 
+  804870:	48 b8 27 0e 80 00 00 	movabs $0x800e27,%rax
+  804877:	00 00 00 
+  80487a:	ff d0                	call   *%rax
+    if (state.offset > 0) writebuf(&state);
+  80487c:	83 bd ec fe ff ff 00 	cmpl   $0x0,-0x114(%rbp)
+  804883:	7f 14                	jg     804899 <vfprintf+0x70>
+
+    return (state.result ? state.result : state.error);
+  804885:	48 8b 85 f0 fe ff ff 	mov    -0x110(%rbp),%rax
+  80488c:	48 85 c0             	test   %rax,%rax
+  80488f:	75 06                	jne    804897 <vfprintf+0x6e>
+  804891:	8b 85 f8 fe ff ff    	mov    -0x108(%rbp),%eax
+}
+  804897:	c9                   	leave
+  804898:	c3                   	ret
+    if (state.offset > 0) writebuf(&state);
+  804899:	48 8d bd e8 fe ff ff 	lea    -0x118(%rbp),%rdi
+  8048a0:	48 b8 98 47 80 00 00 	movabs $0x804798,%rax
+  8048a7:	00 00 00 
+  8048aa:	ff d0                	call   *%rax
+  8048ac:	eb d7                	jmp    804885 <vfprintf+0x5c>
+
+00000000008048ae <fprintf>:
+
+int
+fprintf(int fd, const char *fmt, ...) {
+  8048ae:	55                   	push   %rbp
+  8048af:	48 89 e5             	mov    %rsp,%rbp
+  8048b2:	48 83 ec 50          	sub    $0x50,%rsp
+  8048b6:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8048ba:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8048be:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  8048c2:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  8048c6:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  8048cd:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  8048d1:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  8048d5:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  8048d9:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(fd, fmt, ap);
+  8048dd:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  8048e1:	48 b8 29 48 80 00 00 	movabs $0x804829,%rax
+  8048e8:	00 00 00 
+  8048eb:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  8048ed:	c9                   	leave
+  8048ee:	c3                   	ret
+
+00000000008048ef <printf>:
+
+int
+printf(const char *fmt, ...) {
+  8048ef:	55                   	push   %rbp
+  8048f0:	48 89 e5             	mov    %rsp,%rbp
+  8048f3:	48 83 ec 50          	sub    $0x50,%rsp
+  8048f7:	48 89 75 d8          	mov    %rsi,-0x28(%rbp)
+  8048fb:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8048ff:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  804903:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  804907:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_list ap;
+    va_start(ap, fmt);
+  80490b:	c7 45 b8 08 00 00 00 	movl   $0x8,-0x48(%rbp)
+  804912:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  804916:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80491a:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80491e:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int res = vfprintf(1, fmt, ap);
+  804922:	48 8d 55 b8          	lea    -0x48(%rbp),%rdx
+  804926:	48 89 fe             	mov    %rdi,%rsi
+  804929:	bf 01 00 00 00       	mov    $0x1,%edi
+  80492e:	48 b8 29 48 80 00 00 	movabs $0x804829,%rax
+  804935:	00 00 00 
+  804938:	ff d0                	call   *%rax
+    va_end(ap);
+
+    return res;
+}
+  80493a:	c9                   	leave
+  80493b:	c3                   	ret
+
+000000000080493c <copy_shared_region>:
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+    return 0;
+}
+
+static int
+copy_shared_region(void *start, void *end, void *arg) {
+  80493c:	55                   	push   %rbp
+  80493d:	48 89 e5             	mov    %rsp,%rbp
+  804940:	41 55                	push   %r13
+  804942:	41 54                	push   %r12
+  804944:	53                   	push   %rbx
+  804945:	48 83 ec 08          	sub    $0x8,%rsp
+  804949:	48 89 fb             	mov    %rdi,%rbx
+  80494c:	49 89 f4             	mov    %rsi,%r12
+    envid_t child = *(envid_t *)arg;
+  80494f:	44 8b 2a             	mov    (%rdx),%r13d
+    scring_map_region(0, start, child, start, end - start, get_prot(start));
+  804952:	48 b8 b8 59 80 00 00 	movabs $0x8059b8,%rax
+  804959:	00 00 00 
+  80495c:	ff d0                	call   *%rax
+  80495e:	41 89 c1             	mov    %eax,%r9d
+  804961:	4d 89 e0             	mov    %r12,%r8
+  804964:	49 29 d8             	sub    %rbx,%r8
+  804967:	48 89 d9             	mov    %rbx,%rcx
+  80496a:	44 89 ea             	mov    %r13d,%edx
+  80496d:	48 89 de             	mov    %rbx,%rsi
+  804970:	bf 00 00 00 00       	mov    $0x0,%edi
+  804975:	48 b8 2d 5d 80 00 00 	movabs $0x805d2d,%rax
+  80497c:	00 00 00 
+  80497f:	ff d0                	call   *%rax
+    return 0;
+}
+  804981:	b8 00 00 00 00       	mov    $0x0,%eax
+  804986:	48 83 c4 08          	add    $0x8,%rsp
+  80498a:	5b                   	pop    %rbx
+  80498b:	41 5c                	pop    %r12
+  80498d:	41 5d                	pop    %r13
+  80498f:	5d                   	pop    %rbp
+  804990:	c3                   	ret
+
+0000000000804991 <spawn>:
+spawn(const char *prog, const char **argv) {
+  804991:	55                   	push   %rbp
+  804992:	48 89 e5             	mov    %rsp,%rbp
+  804995:	41 57                	push   %r15
+  804997:	41 56                	push   %r14
+  804999:	41 55                	push   %r13
+  80499b:	41 54                	push   %r12
+  80499d:	53                   	push   %rbx
+  80499e:	48 81 ec 08 03 00 00 	sub    $0x308,%rsp
+  8049a5:	48 89 fb             	mov    %rdi,%rbx
+  8049a8:	49 89 f4             	mov    %rsi,%r12
+    file_flush_buffers();
+  8049ab:	48 b8 b2 3f 80 00 00 	movabs $0x803fb2,%rax
+  8049b2:	00 00 00 
+  8049b5:	ff d0                	call   *%rax
+    int fd = open(prog, O_RDONLY);
+  8049b7:	be 00 00 00 00       	mov    $0x0,%esi
+  8049bc:	48 89 df             	mov    %rbx,%rdi
+  8049bf:	48 b8 f1 3e 80 00 00 	movabs $0x803ef1,%rax
+  8049c6:	00 00 00 
+  8049c9:	ff d0                	call   *%rax
+  8049cb:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+    if (fd < 0) return fd;
+  8049d1:	85 c0                	test   %eax,%eax
+  8049d3:	0f 88 06 04 00 00    	js     804ddf <spawn+0x44e>
+  8049d9:	89 c7                	mov    %eax,%edi
+    res = readn(fd, elf_buf, sizeof(elf_buf));
+  8049db:	ba 00 02 00 00       	mov    $0x200,%edx
+  8049e0:	48 8d b5 d0 fd ff ff 	lea    -0x230(%rbp),%rsi
+  8049e7:	48 b8 cd 2a 80 00 00 	movabs $0x802acd,%rax
+  8049ee:	00 00 00 
+  8049f1:	ff d0                	call   *%rax
+  8049f3:	89 c6                	mov    %eax,%esi
+    if (res != sizeof(elf_buf)) {
+  8049f5:	3d 00 02 00 00       	cmp    $0x200,%eax
+  8049fa:	0f 85 93 02 00 00    	jne    804c93 <spawn+0x302>
+        elf->e_elf[1] != 1 /* little endian */ ||
+  804a00:	48 b8 ff ff ff ff ff 	movabs $0xffffffffffffff,%rax
+  804a07:	ff ff 00 
+  804a0a:	48 23 85 d0 fd ff ff 	and    -0x230(%rbp),%rax
+    if (elf->e_magic != ELF_MAGIC ||
+  804a11:	48 ba 7f 45 4c 46 02 	movabs $0x10102464c457f,%rdx
+  804a18:	01 01 00 
+  804a1b:	48 39 d0             	cmp    %rdx,%rax
+  804a1e:	0f 85 ab 02 00 00    	jne    804ccf <spawn+0x33e>
+        elf->e_type != ET_EXEC /* executable */ ||
+  804a24:	81 bd e0 fd ff ff 02 	cmpl   $0x3e0002,-0x220(%rbp)
+  804a2b:	00 3e 00 
+  804a2e:	0f 85 9b 02 00 00    	jne    804ccf <spawn+0x33e>
+  804a34:	b8 08 00 00 00       	mov    $0x8,%eax
+  804a39:	0f 05                	syscall
+  804a3b:	41 89 c6             	mov    %eax,%r14d
+  804a3e:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if ((int)(res = sys_exofork()) < 0) goto error2;
+  804a44:	85 c0                	test   %eax,%eax
+  804a46:	0f 88 75 03 00 00    	js     804dc1 <spawn+0x430>
+    envid_t child = res;
+  804a4c:	89 85 cc fd ff ff    	mov    %eax,-0x234(%rbp)
+    struct Trapframe child_tf = envs[ENVX(child)].env_tf;
+  804a52:	89 c2                	mov    %eax,%edx
+  804a54:	81 e2 ff 03 00 00    	and    $0x3ff,%edx
+  804a5a:	48 89 d0             	mov    %rdx,%rax
+  804a5d:	48 c1 e0 04          	shl    $0x4,%rax
+  804a61:	48 29 d0             	sub    %rdx,%rax
+  804a64:	48 c1 e0 05          	shl    $0x5,%rax
+  804a68:	48 be 00 00 c0 1f 80 	movabs $0x801fc00000,%rsi
+  804a6f:	00 00 00 
+  804a72:	48 01 c6             	add    %rax,%rsi
+  804a75:	48 8b 06             	mov    (%rsi),%rax
+  804a78:	48 89 85 0c fd ff ff 	mov    %rax,-0x2f4(%rbp)
+  804a7f:	48 8b 86 b8 00 00 00 	mov    0xb8(%rsi),%rax
+  804a86:	48 89 85 c4 fd ff ff 	mov    %rax,-0x23c(%rbp)
+  804a8d:	48 8d bd 10 fd ff ff 	lea    -0x2f0(%rbp),%rdi
+  804a94:	48 c7 c1 fc ff ff ff 	mov    $0xfffffffffffffffc,%rcx
+  804a9b:	48 29 ce             	sub    %rcx,%rsi
+  804a9e:	81 c1 c0 00 00 00    	add    $0xc0,%ecx
+  804aa4:	c1 e9 03             	shr    $0x3,%ecx
+  804aa7:	89 c9                	mov    %ecx,%ecx
+  804aa9:	f3 48 a5             	rep movsq %ds:(%rsi),%es:(%rdi)
+    child_tf.tf_rip = elf->e_entry;
+  804aac:	48 8b 85 e8 fd ff ff 	mov    -0x218(%rbp),%rax
+  804ab3:	48 89 85 a4 fd ff ff 	mov    %rax,-0x25c(%rbp)
+    for (argc = 0; argv[argc] != 0; argc++)
+  804aba:	49 8b 3c 24          	mov    (%r12),%rdi
+  804abe:	48 85 ff             	test   %rdi,%rdi
+  804ac1:	0f 84 d6 05 00 00    	je     80509d <spawn+0x70c>
+  804ac7:	41 bd 01 00 00 00    	mov    $0x1,%r13d
+    string_size = 0;
+  804acd:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+        string_size += strlen(argv[argc]) + 1;
+  804ad3:	48 bb be 15 80 00 00 	movabs $0x8015be,%rbx
+  804ada:	00 00 00 
+  804add:	ff d3                	call   *%rbx
+  804adf:	4c 01 f8             	add    %r15,%rax
+  804ae2:	4c 8d 78 01          	lea    0x1(%rax),%r15
+    for (argc = 0; argv[argc] != 0; argc++)
+  804ae6:	4c 89 ea             	mov    %r13,%rdx
+  804ae9:	49 83 c5 01          	add    $0x1,%r13
+  804aed:	4b 8b 7c ec f8       	mov    -0x8(%r12,%r13,8),%rdi
+  804af2:	48 85 ff             	test   %rdi,%rdi
+  804af5:	75 e6                	jne    804add <spawn+0x14c>
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  804af7:	49 89 d5             	mov    %rdx,%r13
+  804afa:	48 89 95 f8 fc ff ff 	mov    %rdx,-0x308(%rbp)
+  804b01:	48 f7 d0             	not    %rax
+  804b04:	48 8d 98 00 00 41 00 	lea    0x410000(%rax),%rbx
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  804b0b:	49 89 df             	mov    %rbx,%r15
+  804b0e:	49 83 e7 f8          	and    $0xfffffffffffffff8,%r15
+  804b12:	4c 89 bd e8 fc ff ff 	mov    %r15,-0x318(%rbp)
+  804b19:	89 d0                	mov    %edx,%eax
+  804b1b:	83 c0 01             	add    $0x1,%eax
+  804b1e:	48 98                	cltq
+  804b20:	48 c1 e0 03          	shl    $0x3,%rax
+  804b24:	49 29 c7             	sub    %rax,%r15
+  804b27:	4c 89 bd f0 fc ff ff 	mov    %r15,-0x310(%rbp)
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  804b2e:	49 8d 47 f0          	lea    -0x10(%r15),%rax
+  804b32:	48 3d ff ff 3f 00    	cmp    $0x3fffff,%rax
+  804b38:	0f 86 4f 05 00 00    	jbe    80508d <spawn+0x6fc>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  804b3e:	b9 06 00 00 00       	mov    $0x6,%ecx
+  804b43:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804b48:	be 00 00 40 00       	mov    $0x400000,%esi
+  804b4d:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  804b54:	00 00 00 
+  804b57:	ff d0                	call   *%rax
+  804b59:	85 c0                	test   %eax,%eax
+  804b5b:	0f 88 31 05 00 00    	js     805092 <spawn+0x701>
+    for (i = 0; i < argc; i++) {
+  804b61:	4c 89 e8             	mov    %r13,%rax
+  804b64:	45 85 ed             	test   %r13d,%r13d
+  804b67:	7e 65                	jle    804bce <spawn+0x23d>
+  804b69:	4d 89 fd             	mov    %r15,%r13
+  804b6c:	48 98                	cltq
+  804b6e:	49 8d 04 c7          	lea    (%r15,%rax,8),%rax
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804b72:	49 bf 00 70 fe ff 7f 	movabs $0x7ffffe7000,%r15
+  804b79:	00 00 00 
+        string_store += strlen(argv[i]) + 1;
+  804b7c:	44 89 b5 e0 fc ff ff 	mov    %r14d,-0x320(%rbp)
+  804b83:	49 89 c6             	mov    %rax,%r14
+        argv_store[i] = UTEMP2USTACK(string_store);
+  804b86:	4a 8d 84 3b 00 00 c0 	lea    -0x400000(%rbx,%r15,1),%rax
+  804b8d:	ff 
+  804b8e:	49 89 45 00          	mov    %rax,0x0(%r13)
+        strcpy(string_store, argv[i]);
+  804b92:	49 8b 34 24          	mov    (%r12),%rsi
+  804b96:	48 89 df             	mov    %rbx,%rdi
+  804b99:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  804ba0:	00 00 00 
+  804ba3:	ff d0                	call   *%rax
+        string_store += strlen(argv[i]) + 1;
+  804ba5:	49 8b 3c 24          	mov    (%r12),%rdi
+  804ba9:	48 b8 be 15 80 00 00 	movabs $0x8015be,%rax
+  804bb0:	00 00 00 
+  804bb3:	ff d0                	call   *%rax
+  804bb5:	48 8d 5c 03 01       	lea    0x1(%rbx,%rax,1),%rbx
+    for (i = 0; i < argc; i++) {
+  804bba:	49 83 c5 08          	add    $0x8,%r13
+  804bbe:	49 83 c4 08          	add    $0x8,%r12
+  804bc2:	4d 39 ee             	cmp    %r13,%r14
+  804bc5:	75 bf                	jne    804b86 <spawn+0x1f5>
+  804bc7:	44 8b b5 e0 fc ff ff 	mov    -0x320(%rbp),%r14d
+    argv_store[argc] = 0;
+  804bce:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804bd5:	48 c7 40 f8 00 00 00 	movq   $0x0,-0x8(%rax)
+  804bdc:	00 
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  804bdd:	48 81 fb 00 00 41 00 	cmp    $0x410000,%rbx
+  804be4:	0f 85 2c 01 00 00    	jne    804d16 <spawn+0x385>
+    argv_store[-1] = UTEMP2USTACK(argv_store);
+  804bea:	48 b9 00 70 fe ff 7f 	movabs $0x7ffffe7000,%rcx
+  804bf1:	00 00 00 
+  804bf4:	48 8b 9d f0 fc ff ff 	mov    -0x310(%rbp),%rbx
+  804bfb:	48 8d 84 0b 00 00 c0 	lea    -0x400000(%rbx,%rcx,1),%rax
+  804c02:	ff 
+  804c03:	48 89 43 f8          	mov    %rax,-0x8(%rbx)
+    argv_store[-2] = argc;
+  804c07:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804c0e:	48 89 43 f0          	mov    %rax,-0x10(%rbx)
+    tf->tf_rsp = UTEMP2USTACK(&argv_store[-2]);
+  804c12:	48 b8 f0 6f fe ff 7f 	movabs $0x7ffffe6ff0,%rax
+  804c19:	00 00 00 
+  804c1c:	48 8d 84 03 00 00 c0 	lea    -0x400000(%rbx,%rax,1),%rax
+  804c23:	ff 
+  804c24:	48 89 85 bc fd ff ff 	mov    %rax,-0x244(%rbp)
+    scring_map_region(0, UTEMP, child, (void *)(USER_STACK_TOP - USER_STACK_SIZE),
+  804c2b:	41 b9 06 00 00 00    	mov    $0x6,%r9d
+  804c31:	41 b8 00 00 01 00    	mov    $0x10000,%r8d
+  804c37:	44 89 f2             	mov    %r14d,%edx
+  804c3a:	be 00 00 40 00       	mov    $0x400000,%esi
+  804c3f:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c44:	48 b8 2d 5d 80 00 00 	movabs $0x805d2d,%rax
+  804c4b:	00 00 00 
+  804c4e:	ff d0                	call   *%rax
+    scring_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  804c50:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804c55:	be 00 00 40 00       	mov    $0x400000,%esi
+  804c5a:	bf 00 00 00 00       	mov    $0x0,%edi
+  804c5f:	48 b8 66 5d 80 00 00 	movabs $0x805d66,%rax
+  804c66:	00 00 00 
+  804c69:	ff d0                	call   *%rax
+    struct Proghdr *ph = (struct Proghdr *)(elf_buf + elf->e_phoff);
+  804c6b:	48 8b 85 f0 fd ff ff 	mov    -0x210(%rbp),%rax
+  804c72:	4c 8d ac 05 d0 fd ff 	lea    -0x230(%rbp,%rax,1),%r13
+  804c79:	ff 
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804c7a:	66 83 bd 08 fe ff ff 	cmpw   $0x0,-0x1f8(%rbp)
+  804c81:	00 
+  804c82:	0f 84 5d 03 00 00    	je     804fe5 <spawn+0x654>
+  804c88:	41 bf 00 00 00 00    	mov    $0x0,%r15d
+  804c8e:	e9 1b 02 00 00       	jmp    804eae <spawn+0x51d>
+        cprintf("Wrong ELF header size or read error: %i\n", res);
+  804c93:	48 bf e0 6b 80 00 00 	movabs $0x806be0,%rdi
+  804c9a:	00 00 00 
+  804c9d:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ca2:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  804ca9:	00 00 00 
+  804cac:	ff d2                	call   *%rdx
+        close(fd);
+  804cae:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804cb4:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  804cbb:	00 00 00 
+  804cbe:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804cc0:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  804cc7:	ff ff ff 
+  804cca:	e9 10 01 00 00       	jmp    804ddf <spawn+0x44e>
+        cprintf("Elf magic %08x want %08x\n", elf->e_magic, ELF_MAGIC);
+  804ccf:	ba 7f 45 4c 46       	mov    $0x464c457f,%edx
+  804cd4:	8b b5 d0 fd ff ff    	mov    -0x230(%rbp),%esi
+  804cda:	48 bf 97 6c 80 00 00 	movabs $0x806c97,%rdi
+  804ce1:	00 00 00 
+  804ce4:	b8 00 00 00 00       	mov    $0x0,%eax
+  804ce9:	48 b9 d7 0c 80 00 00 	movabs $0x800cd7,%rcx
+  804cf0:	00 00 00 
+  804cf3:	ff d1                	call   *%rcx
+        close(fd);
+  804cf5:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804cfb:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  804d02:	00 00 00 
+  804d05:	ff d0                	call   *%rax
+        return -E_NOT_EXEC;
+  804d07:	c7 85 e4 fc ff ff ee 	movl   $0xffffffee,-0x31c(%rbp)
+  804d0e:	ff ff ff 
+  804d11:	e9 c9 00 00 00       	jmp    804ddf <spawn+0x44e>
+    assert(string_store == (char *)UTEMP + USER_STACK_SIZE);
+  804d16:	48 b9 10 6c 80 00 00 	movabs $0x806c10,%rcx
+  804d1d:	00 00 00 
+  804d20:	48 ba 88 64 80 00 00 	movabs $0x806488,%rdx
+  804d27:	00 00 00 
+  804d2a:	be f9 00 00 00       	mov    $0xf9,%esi
+  804d2f:	48 bf b1 6c 80 00 00 	movabs $0x806cb1,%rdi
+  804d36:	00 00 00 
+  804d39:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d3e:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  804d45:	00 00 00 
+  804d48:	41 ff d0             	call   *%r8
+    /* Map them to child */
+    /* Unmap them from parent */
+    size_t datasz = filesz;
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+    if (memsz > filesz)
+        scring_alloc_region(child, (void *)va + filesz, memsz - filesz, perm);
+  804d4b:	49 8d 14 06          	lea    (%r14,%rax,1),%rdx
+  804d4f:	48 29 f2             	sub    %rsi,%rdx
+  804d52:	89 d9                	mov    %ebx,%ecx
+  804d54:	8b bd dc fc ff ff    	mov    -0x324(%rbp),%edi
+  804d5a:	48 b8 f7 5c 80 00 00 	movabs $0x805cf7,%rax
+  804d61:	00 00 00 
+  804d64:	ff d0                	call   *%rax
+  804d66:	e9 f0 01 00 00       	jmp    804f5b <spawn+0x5ca>
+
+    /* Everything queued so far (including the unmap of
+     * the previous segment) has to be executed first */
+    res = scring_submit();
+    if (res < 0) {
+        cprintf("map_segment.sys_alloc_region failed: %i\n", res);
+  804d6b:	89 c6                	mov    %eax,%esi
+  804d6d:	48 bf 40 6c 80 00 00 	movabs $0x806c40,%rdi
+  804d74:	00 00 00 
+  804d77:	b8 00 00 00 00       	mov    $0x0,%eax
+  804d7c:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  804d83:	00 00 00 
+  804d86:	ff d2                	call   *%rdx
+    scring_discard();
+  804d88:	48 b8 d7 5c 80 00 00 	movabs $0x805cd7,%rax
+  804d8f:	00 00 00 
+  804d92:	ff d0                	call   *%rax
+    sys_unmap_region(0, UTEMP, USER_STACK_SIZE);
+  804d94:	ba 00 00 01 00       	mov    $0x10000,%edx
+  804d99:	be 00 00 40 00       	mov    $0x400000,%esi
+  804d9e:	bf 00 00 00 00       	mov    $0x0,%edi
+  804da3:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  804daa:	00 00 00 
+  804dad:	ff d0                	call   *%rax
+    sys_env_destroy(child);
+  804daf:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  804db5:	48 b8 e1 1e 80 00 00 	movabs $0x801ee1,%rax
+  804dbc:	00 00 00 
+  804dbf:	ff d0                	call   *%rax
+    close(fd);
+  804dc1:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804dc7:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  804dce:	00 00 00 
+  804dd1:	ff d0                	call   *%rax
+    return res;
+  804dd3:	8b 85 f0 fc ff ff    	mov    -0x310(%rbp),%eax
+  804dd9:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+}
+  804ddf:	8b 85 e4 fc ff ff    	mov    -0x31c(%rbp),%eax
+  804de5:	48 81 c4 08 03 00 00 	add    $0x308,%rsp
+  804dec:	5b                   	pop    %rbx
+  804ded:	41 5c                	pop    %r12
+  804def:	41 5d                	pop    %r13
+  804df1:	41 5e                	pop    %r14
+  804df3:	41 5f                	pop    %r15
+  804df5:	5d                   	pop    %rbp
+  804df6:	c3                   	ret
+    /* Text pages stay shared with the block cache
+     * and with other instances of the program */
+    void *addr = UTEMP;
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+    if (res < 0) {
+        cprintf("map_segment.mmap failed: %i\n", res);
+  804df7:	89 c6                	mov    %eax,%esi
+  804df9:	48 bf bd 6c 80 00 00 	movabs $0x806cbd,%rdi
+  804e00:	00 00 00 
+  804e03:	b8 00 00 00 00       	mov    $0x0,%eax
+  804e08:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  804e0f:	00 00 00 
+  804e12:	ff d2                	call   *%rdx
+        return res;
+  804e14:	e9 6f ff ff ff       	jmp    804d88 <spawn+0x3f7>
+    }
+
+    /* The rest of the last page belongs to bss */
+    if (memsz > datasz && filesz > datasz)
+        memset(UTEMP + datasz, 0, filesz - datasz);
+  804e19:	4c 89 e2             	mov    %r12,%rdx
+  804e1c:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804e23:	48 29 c2             	sub    %rax,%rdx
+  804e26:	48 8d b8 00 00 40 00 	lea    0x400000(%rax),%rdi
+  804e2d:	be 00 00 00 00       	mov    $0x0,%esi
+  804e32:	48 b8 48 17 80 00 00 	movabs $0x801748,%rax
+  804e39:	00 00 00 
+  804e3c:	ff d0                	call   *%rax
+
+    scring_map_region(CURENVID, UTEMP, child, (void *)va, filesz, perm | PROT_LAZY);
+  804e3e:	80 cb 80             	or     $0x80,%bl
+  804e41:	41 89 d9             	mov    %ebx,%r9d
+  804e44:	4d 89 e0             	mov    %r12,%r8
+  804e47:	4c 89 f1             	mov    %r14,%rcx
+  804e4a:	8b 95 dc fc ff ff    	mov    -0x324(%rbp),%edx
+  804e50:	be 00 00 40 00       	mov    $0x400000,%esi
+  804e55:	bf 00 00 00 00       	mov    $0x0,%edi
+  804e5a:	48 b8 2d 5d 80 00 00 	movabs $0x805d2d,%rax
+  804e61:	00 00 00 
+  804e64:	ff d0                	call   *%rax
+    res = scring_submit();
+  804e66:	48 b8 8b 5c 80 00 00 	movabs $0x805c8b,%rax
+  804e6d:	00 00 00 
+  804e70:	ff d0                	call   *%rax
+  804e72:	89 c3                	mov    %eax,%ebx
+  804e74:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    munmap(UTEMP, filesz);
+  804e7a:	4c 89 e6             	mov    %r12,%rsi
+  804e7d:	bf 00 00 40 00       	mov    $0x400000,%edi
+  804e82:	48 b8 ba 42 80 00 00 	movabs $0x8042ba,%rax
+  804e89:	00 00 00 
+  804e8c:	ff d0                	call   *%rax
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804e8e:	85 db                	test   %ebx,%ebx
+  804e90:	0f 88 f2 fe ff ff    	js     804d88 <spawn+0x3f7>
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  804e96:	49 83 c7 01          	add    $0x1,%r15
+  804e9a:	49 83 c5 38          	add    $0x38,%r13
+  804e9e:	0f b7 85 08 fe ff ff 	movzwl -0x1f8(%rbp),%eax
+  804ea5:	49 39 c7             	cmp    %rax,%r15
+  804ea8:	0f 83 37 01 00 00    	jae    804fe5 <spawn+0x654>
+        if (ph->p_type != ELF_PROG_LOAD) continue;
+  804eae:	41 83 7d 00 01       	cmpl   $0x1,0x0(%r13)
+  804eb3:	75 e1                	jne    804e96 <spawn+0x505>
+        if (ph->p_flags & ELF_PROG_FLAG_WRITE) perm |= PROT_W;
+  804eb5:	41 8b 45 04          	mov    0x4(%r13),%eax
+  804eb9:	89 c3                	mov    %eax,%ebx
+  804ebb:	83 e3 02             	and    $0x2,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_READ) perm |= PROT_R;
+  804ebe:	89 da                	mov    %ebx,%edx
+  804ec0:	83 ca 04             	or     $0x4,%edx
+  804ec3:	a8 04                	test   $0x4,%al
+  804ec5:	0f 45 da             	cmovne %edx,%ebx
+        if (ph->p_flags & ELF_PROG_FLAG_EXEC) perm |= PROT_X;
+  804ec8:	89 da                	mov    %ebx,%edx
+  804eca:	83 ca 01             	or     $0x1,%edx
+  804ecd:	a8 01                	test   $0x1,%al
+  804ecf:	0f 45 da             	cmovne %edx,%ebx
+        if ((res = map_segment(child, ph->p_va, ph->p_memsz,
+  804ed2:	49 8b 45 08          	mov    0x8(%r13),%rax
+  804ed6:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+  804edc:	49 8b 75 20          	mov    0x20(%r13),%rsi
+  804ee0:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+  804ee7:	49 8b 7d 28          	mov    0x28(%r13),%rdi
+  804eeb:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+  804ef2:	4d 8b 75 10          	mov    0x10(%r13),%r14
+  804ef6:	8b 8d cc fd ff ff    	mov    -0x234(%rbp),%ecx
+  804efc:	89 8d dc fc ff ff    	mov    %ecx,-0x324(%rbp)
+    if (res) {
+  804f02:	44 89 f2             	mov    %r14d,%edx
+  804f05:	81 e2 ff 0f 00 00    	and    $0xfff,%edx
+  804f0b:	74 22                	je     804f2f <spawn+0x59e>
+        va -= res;
+  804f0d:	48 63 ca             	movslq %edx,%rcx
+  804f10:	49 29 ce             	sub    %rcx,%r14
+        memsz += res;
+  804f13:	48 01 cf             	add    %rcx,%rdi
+  804f16:	48 89 bd f8 fc ff ff 	mov    %rdi,-0x308(%rbp)
+        filesz += res;
+  804f1d:	48 01 ce             	add    %rcx,%rsi
+  804f20:	48 89 b5 e8 fc ff ff 	mov    %rsi,-0x318(%rbp)
+        fileoffset -= res;
+  804f27:	29 d0                	sub    %edx,%eax
+  804f29:	89 85 e0 fc ff ff    	mov    %eax,-0x320(%rbp)
+    filesz = ROUNDUP(va + filesz, PAGE_SIZE) - va;
+  804f2f:	48 8b 85 e8 fc ff ff 	mov    -0x318(%rbp),%rax
+  804f36:	4a 8d b4 30 ff 0f 00 	lea    0xfff(%rax,%r14,1),%rsi
+  804f3d:	00 
+  804f3e:	48 81 e6 00 f0 ff ff 	and    $0xfffffffffffff000,%rsi
+  804f45:	49 89 f4             	mov    %rsi,%r12
+  804f48:	4d 29 f4             	sub    %r14,%r12
+    if (memsz > filesz)
+  804f4b:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804f52:	49 39 c4             	cmp    %rax,%r12
+  804f55:	0f 82 f0 fd ff ff    	jb     804d4b <spawn+0x3ba>
+    res = scring_submit();
+  804f5b:	48 b8 8b 5c 80 00 00 	movabs $0x805c8b,%rax
+  804f62:	00 00 00 
+  804f65:	ff d0                	call   *%rax
+  804f67:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  804f6d:	85 c0                	test   %eax,%eax
+  804f6f:	0f 88 f6 fd ff ff    	js     804d6b <spawn+0x3da>
+    if (!filesz) return 0;
+  804f75:	4d 85 e4             	test   %r12,%r12
+  804f78:	0f 84 18 ff ff ff    	je     804e96 <spawn+0x505>
+    void *addr = UTEMP;
+  804f7e:	48 c7 85 00 fd ff ff 	movq   $0x400000,-0x300(%rbp)
+  804f85:	00 00 40 00 
+    res = mmap(&addr, filesz, PROT_RW, MAP_PRIVATE | MAP_FIXED | MAP_POPULATE, fd, fileoffset);
+  804f89:	44 8b 8d e0 fc ff ff 	mov    -0x320(%rbp),%r9d
+  804f90:	44 8b 85 e4 fc ff ff 	mov    -0x31c(%rbp),%r8d
+  804f97:	b9 0e 00 00 00       	mov    $0xe,%ecx
+  804f9c:	ba 06 00 00 00       	mov    $0x6,%edx
+  804fa1:	4c 89 e6             	mov    %r12,%rsi
+  804fa4:	48 8d bd 00 fd ff ff 	lea    -0x300(%rbp),%rdi
+  804fab:	48 b8 37 44 80 00 00 	movabs $0x804437,%rax
+  804fb2:	00 00 00 
+  804fb5:	ff d0                	call   *%rax
+  804fb7:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+    if (res < 0) {
+  804fbd:	85 c0                	test   %eax,%eax
+  804fbf:	0f 88 32 fe ff ff    	js     804df7 <spawn+0x466>
+    if (memsz > datasz && filesz > datasz)
+  804fc5:	48 8b 85 f8 fc ff ff 	mov    -0x308(%rbp),%rax
+  804fcc:	49 39 c4             	cmp    %rax,%r12
+  804fcf:	49 0f 46 c4          	cmovbe %r12,%rax
+  804fd3:	48 39 85 e8 fc ff ff 	cmp    %rax,-0x318(%rbp)
+  804fda:	0f 83 5e fe ff ff    	jae    804e3e <spawn+0x4ad>
+  804fe0:	e9 34 fe ff ff       	jmp    804e19 <spawn+0x488>
+    close(fd);
+  804fe5:	8b bd e4 fc ff ff    	mov    -0x31c(%rbp),%edi
+  804feb:	48 b8 91 28 80 00 00 	movabs $0x802891,%rax
+  804ff2:	00 00 00 
+  804ff5:	ff d0                	call   *%rax
+    foreach_shared_region(copy_shared_region, &child);
+  804ff7:	48 8d b5 cc fd ff ff 	lea    -0x234(%rbp),%rsi
+  804ffe:	48 bf 3c 49 80 00 00 	movabs $0x80493c,%rdi
+  805005:	00 00 00 
+  805008:	48 b8 2c 5a 80 00 00 	movabs $0x805a2c,%rax
+  80500f:	00 00 00 
+  805012:	ff d0                	call   *%rax
+    scring_env_set_trapframe(child, &child_tf);
+  805014:	48 8d b5 0c fd ff ff 	lea    -0x2f4(%rbp),%rsi
+  80501b:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  805021:	48 b8 d7 5d 80 00 00 	movabs $0x805dd7,%rax
+  805028:	00 00 00 
+  80502b:	ff d0                	call   *%rax
+    scring_env_set_status(child, ENV_RUNNABLE);
+  80502d:	be 02 00 00 00       	mov    $0x2,%esi
+  805032:	8b bd cc fd ff ff    	mov    -0x234(%rbp),%edi
+  805038:	48 b8 9f 5d 80 00 00 	movabs $0x805d9f,%rax
+  80503f:	00 00 00 
+  805042:	ff d0                	call   *%rax
+    if ((res = scring_submit()) < 0) {
+  805044:	48 b8 8b 5c 80 00 00 	movabs $0x805c8b,%rax
+  80504b:	00 00 00 
+  80504e:	ff d0                	call   *%rax
+  805050:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  805056:	85 c0                	test   %eax,%eax
+  805058:	78 11                	js     80506b <spawn+0x6da>
+    return child;
+  80505a:	8b 85 cc fd ff ff    	mov    -0x234(%rbp),%eax
+  805060:	89 85 e4 fc ff ff    	mov    %eax,-0x31c(%rbp)
+  805066:	e9 74 fd ff ff       	jmp    804ddf <spawn+0x44e>
+        cprintf("spawn: batched system call failed: %i\n", res);
+  80506b:	89 c6                	mov    %eax,%esi
+  80506d:	48 bf 70 6c 80 00 00 	movabs $0x806c70,%rdi
+  805074:	00 00 00 
+  805077:	b8 00 00 00 00       	mov    $0x0,%eax
+  80507c:	48 ba d7 0c 80 00 00 	movabs $0x800cd7,%rdx
+  805083:	00 00 00 
+  805086:	ff d2                	call   *%rdx
+        goto error;
+  805088:	e9 fb fc ff ff       	jmp    804d88 <spawn+0x3f7>
+    if ((void *)(argv_store - 2) < (void *)UTEMP) return -E_NO_MEM;
+  80508d:	b8 fc ff ff ff       	mov    $0xfffffffc,%eax
+    for (size_t i = 0; i < elf->e_phnum; i++, ph++) {
+  805092:	89 85 f0 fc ff ff    	mov    %eax,-0x310(%rbp)
+  805098:	e9 eb fc ff ff       	jmp    804d88 <spawn+0x3f7>
+    if ((res = sys_alloc_region(0, UTEMP, USER_STACK_SIZE, PROT_RW)) < 0) return res;
+  80509d:	b9 06 00 00 00       	mov    $0x6,%ecx
+  8050a2:	ba 00 00 01 00       	mov    $0x10000,%edx
+  8050a7:	be 00 00 40 00       	mov    $0x400000,%esi
+  8050ac:	bf 00 00 00 00       	mov    $0x0,%edi
+  8050b1:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8050b8:	00 00 00 
+  8050bb:	ff d0                	call   *%rax
+  8050bd:	85 c0                	test   %eax,%eax
+  8050bf:	78 d1                	js     805092 <spawn+0x701>
+    for (argc = 0; argv[argc] != 0; argc++)
+  8050c1:	48 c7 85 f8 fc ff ff 	movq   $0x0,-0x308(%rbp)
+  8050c8:	00 00 00 00 
+    argv_store = (uintptr_t *)(ROUNDDOWN(string_store, sizeof(uintptr_t)) - sizeof(uintptr_t) * (argc + 1));
+  8050cc:	48 c7 85 f0 fc ff ff 	movq   $0x40fff8,-0x310(%rbp)
+  8050d3:	f8 ff 40 00 
+  8050d7:	48 c7 85 e8 fc ff ff 	movq   $0x410000,-0x318(%rbp)
+  8050de:	00 00 41 00 
+    string_store = (char *)UTEMP + USER_STACK_SIZE - string_size;
+  8050e2:	bb 00 00 41 00       	mov    $0x410000,%ebx
+  8050e7:	e9 e2 fa ff ff       	jmp    804bce <spawn+0x23d>
+
+00000000008050ec <spawnl>:
+spawnl(const char *prog, const char *arg0, ...) {
+  8050ec:	55                   	push   %rbp
+  8050ed:	48 89 e5             	mov    %rsp,%rbp
+  8050f0:	48 83 ec 50          	sub    $0x50,%rsp
+  8050f4:	48 89 55 e0          	mov    %rdx,-0x20(%rbp)
+  8050f8:	48 89 4d e8          	mov    %rcx,-0x18(%rbp)
+  8050fc:	4c 89 45 f0          	mov    %r8,-0x10(%rbp)
+  805100:	4c 89 4d f8          	mov    %r9,-0x8(%rbp)
+    va_start(vl, arg0);
+  805104:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  80510b:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  80510f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805113:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  805117:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    int argc = 0;
+  80511b:	b9 00 00 00 00       	mov    $0x0,%ecx
+    while (va_arg(vl, void *) != NULL) argc++;
+  805120:	eb 15                	jmp    805137 <spawnl+0x4b>
+  805122:	48 8b 55 c0          	mov    -0x40(%rbp),%rdx
+  805126:	48 8d 42 08          	lea    0x8(%rdx),%rax
+  80512a:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  80512e:	48 83 3a 00          	cmpq   $0x0,(%rdx)
+  805132:	74 1c                	je     805150 <spawnl+0x64>
+  805134:	83 c1 01             	add    $0x1,%ecx
+  805137:	8b 45 b8             	mov    -0x48(%rbp),%eax
+  80513a:	83 f8 2f             	cmp    $0x2f,%eax
+  80513d:	77 e3                	ja     805122 <spawnl+0x36>
+  80513f:	89 c2                	mov    %eax,%edx
+  805141:	4c 8d 55 d0          	lea    -0x30(%rbp),%r10
+  805145:	4c 01 d2             	add    %r10,%rdx
+  805148:	83 c0 08             	add    $0x8,%eax
+  80514b:	89 45 b8             	mov    %eax,-0x48(%rbp)
+  80514e:	eb de                	jmp    80512e <spawnl+0x42>
+    const char *argv[argc + 2];
+  805150:	8d 41 02             	lea    0x2(%rcx),%eax
+  805153:	48 98                	cltq
+  805155:	48 8d 04 c5 0f 00 00 	lea    0xf(,%rax,8),%rax
+  80515c:	00 
+  80515d:	48 83 e0 f0          	and    $0xfffffffffffffff0,%rax
+  805161:	48 29 c4             	sub    %rax,%rsp
+  805164:	4c 8d 44 24 07       	lea    0x7(%rsp),%r8
+  805169:	4c 89 c0             	mov    %r8,%rax
+  80516c:	48 c1 e8 03          	shr    $0x3,%rax
+  805170:	49 83 e0 f8          	and    $0xfffffffffffffff8,%r8
+    argv[0] = arg0;
+  805174:	48 89 34 c5 00 00 00 	mov    %rsi,0x0(,%rax,8)
+  80517b:	00 
+    argv[argc + 1] = NULL;
+  80517c:	8d 41 01             	lea    0x1(%rcx),%eax
+  80517f:	48 98                	cltq
+  805181:	49 c7 04 c0 00 00 00 	movq   $0x0,(%r8,%rax,8)
+  805188:	00 
+    va_start(vl, arg0);
+  805189:	c7 45 b8 10 00 00 00 	movl   $0x10,-0x48(%rbp)
+  805190:	48 8d 45 10          	lea    0x10(%rbp),%rax
+  805194:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805198:	48 8d 45 d0          	lea    -0x30(%rbp),%rax
+  80519c:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+    for (i = 0; i < argc; i++) {
+  8051a0:	85 c9                	test   %ecx,%ecx
+  8051a2:	74 41                	je     8051e5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8051a4:	49 89 c1             	mov    %rax,%r9
+  8051a7:	49 8d 40 08          	lea    0x8(%r8),%rax
+  8051ab:	8d 51 ff             	lea    -0x1(%rcx),%edx
+  8051ae:	49 8d 74 d0 10       	lea    0x10(%r8,%rdx,8),%rsi
+  8051b3:	eb 1b                	jmp    8051d0 <spawnl+0xe4>
+  8051b5:	48 8b 4d c0          	mov    -0x40(%rbp),%rcx
+  8051b9:	48 8d 51 08          	lea    0x8(%rcx),%rdx
+  8051bd:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+  8051c1:	48 8b 11             	mov    (%rcx),%rdx
+  8051c4:	48 89 10             	mov    %rdx,(%rax)
+    for (i = 0; i < argc; i++) {
+  8051c7:	48 83 c0 08          	add    $0x8,%rax
+  8051cb:	48 39 f0             	cmp    %rsi,%rax
+  8051ce:	74 15                	je     8051e5 <spawnl+0xf9>
+        argv[i + 1] = va_arg(vl, const char *);
+  8051d0:	8b 55 b8             	mov    -0x48(%rbp),%edx
+  8051d3:	83 fa 2f             	cmp    $0x2f,%edx
+  8051d6:	77 dd                	ja     8051b5 <spawnl+0xc9>
+  8051d8:	89 d1                	mov    %edx,%ecx
+  8051da:	4c 01 c9             	add    %r9,%rcx
+  8051dd:	83 c2 08             	add    $0x8,%edx
+  8051e0:	89 55 b8             	mov    %edx,-0x48(%rbp)
+  8051e3:	eb dc                	jmp    8051c1 <spawnl+0xd5>
+    return spawn(prog, argv);
+  8051e5:	4c 89 c6             	mov    %r8,%rsi
+  8051e8:	48 b8 91 49 80 00 00 	movabs $0x804991,%rax
+  8051ef:	00 00 00 
+  8051f2:	ff d0                	call   *%rax
+}
+  8051f4:	c9                   	leave
+  8051f5:	c3                   	ret
+
+00000000008051f6 <devpipe_stat>:
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+    return n;
+}
+
+static int
+devpipe_stat(struct Fd *fd, struct Stat *stat) {
+  8051f6:	55                   	push   %rbp
+  8051f7:	48 89 e5             	mov    %rsp,%rbp
+  8051fa:	41 54                	push   %r12
+  8051fc:	53                   	push   %rbx
+  8051fd:	48 89 f3             	mov    %rsi,%rbx
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805200:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  805207:	00 00 00 
+  80520a:	ff d0                	call   *%rax
+  80520c:	49 89 c4             	mov    %rax,%r12
+    strcpy(stat->st_name, "<pipe>");
+  80520f:	48 be da 6c 80 00 00 	movabs $0x806cda,%rsi
+  805216:	00 00 00 
+  805219:	48 89 df             	mov    %rbx,%rdi
+  80521c:	48 b8 fc 15 80 00 00 	movabs $0x8015fc,%rax
+  805223:	00 00 00 
+  805226:	ff d0                	call   *%rax
+    stat->st_size = p->p_wpos - p->p_rpos;
+  805228:	41 8b 44 24 04       	mov    0x4(%r12),%eax
+  80522d:	41 2b 04 24          	sub    (%r12),%eax
+  805231:	89 83 80 00 00 00    	mov    %eax,0x80(%rbx)
+    stat->st_isdir = 0;
+  805237:	c7 83 84 00 00 00 00 	movl   $0x0,0x84(%rbx)
+  80523e:	00 00 00 
+    stat->st_dev = &devpipe;
+  805241:	48 b8 a0 70 80 00 00 	movabs $0x8070a0,%rax
+  805248:	00 00 00 
+  80524b:	48 89 83 88 00 00 00 	mov    %rax,0x88(%rbx)
+    return 0;
+}
+  805252:	b8 00 00 00 00       	mov    $0x0,%eax
+  805257:	5b                   	pop    %rbx
+  805258:	41 5c                	pop    %r12
+  80525a:	5d                   	pop    %rbp
+  80525b:	c3                   	ret
+
+000000000080525c <pipe_wakeup>:
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80525c:	48 89 f8             	mov    %rdi,%rax
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  80525f:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*waiting) {
+  805265:	8b 17                	mov    (%rdi),%edx
+  805267:	85 d2                	test   %edx,%edx
+  805269:	75 01                	jne    80526c <pipe_wakeup+0x10>
+  80526b:	c3                   	ret
+pipe_wakeup(volatile uint32_t *waiting, off_t *pos) {
+  80526c:	55                   	push   %rbp
+  80526d:	48 89 e5             	mov    %rsp,%rbp
+  805270:	48 89 f7             	mov    %rsi,%rdi
+        *waiting = 0;
+  805273:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+        sys_futex_wake(POS_WORD(*pos), NENV);
+  805279:	be 00 04 00 00       	mov    $0x400,%esi
+  80527e:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  805285:	00 00 00 
+  805288:	ff d0                	call   *%rax
+}
+  80528a:	5d                   	pop    %rbp
+  80528b:	c3                   	ret
+
+000000000080528c <devpipe_close>:
+
+static int
+devpipe_close(struct Fd *fd) {
+  80528c:	55                   	push   %rbp
+  80528d:	48 89 e5             	mov    %rsp,%rbp
+  805290:	41 55                	push   %r13
+  805292:	41 54                	push   %r12
+  805294:	53                   	push   %rbx
+  805295:	48 83 ec 08          	sub    $0x8,%rsp
+  805299:	49 89 fc             	mov    %rdi,%r12
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80529c:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  8052a3:	00 00 00 
+  8052a6:	ff d0                	call   *%rax
+  8052a8:	48 89 c3             	mov    %rax,%rbx
+
+    USED(sys_unmap_region(0, fd, PAGE_SIZE));
+  8052ab:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052b0:	4c 89 e6             	mov    %r12,%rsi
+  8052b3:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052b8:	49 bc 77 20 80 00 00 	movabs $0x802077,%r12
+  8052bf:	00 00 00 
+  8052c2:	41 ff d4             	call   *%r12
+    /* The other end may sleep waiting for us */
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8052c5:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  8052c9:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  8052cd:	49 bd 5c 52 80 00 00 	movabs $0x80525c,%r13
+  8052d4:	00 00 00 
+  8052d7:	41 ff d5             	call   *%r13
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  8052da:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  8052de:	48 89 de             	mov    %rbx,%rsi
+  8052e1:	41 ff d5             	call   *%r13
+    return sys_unmap_region(0, p, PAGE_SIZE);
+  8052e4:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8052e9:	48 89 de             	mov    %rbx,%rsi
+  8052ec:	bf 00 00 00 00       	mov    $0x0,%edi
+  8052f1:	41 ff d4             	call   *%r12
+  8052f4:	48 83 c4 08          	add    $0x8,%rsp
+  8052f8:	5b                   	pop    %rbx
+  8052f9:	41 5c                	pop    %r12
+  8052fb:	41 5d                	pop    %r13
+  8052fd:	5d                   	pop    %rbp
+  8052fe:	c3                   	ret
+
+00000000008052ff <_pipeisclosed>:
+_pipeisclosed(struct Fd *fd, struct Pipe *p) {
+  8052ff:	55                   	push   %rbp
+  805300:	48 89 e5             	mov    %rsp,%rbp
+  805303:	48 89 f2             	mov    %rsi,%rdx
+    return !sys_region_refs2(fd, PAGE_SIZE, p, PAGE_SIZE);
+  805306:	b9 00 10 00 00       	mov    $0x1000,%ecx
+  80530b:	be 00 10 00 00       	mov    $0x1000,%esi
+  805310:	48 b8 ba 1f 80 00 00 	movabs $0x801fba,%rax
+  805317:	00 00 00 
+  80531a:	ff d0                	call   *%rax
+  80531c:	85 c0                	test   %eax,%eax
+  80531e:	0f 94 c0             	sete   %al
+  805321:	0f b6 c0             	movzbl %al,%eax
+}
+  805324:	5d                   	pop    %rbp
+  805325:	c3                   	ret
+
+0000000000805326 <devpipe_write>:
+devpipe_write(struct Fd *fd, const void *vbuf, size_t n) {
+  805326:	55                   	push   %rbp
+  805327:	48 89 e5             	mov    %rsp,%rbp
+  80532a:	41 57                	push   %r15
+  80532c:	41 56                	push   %r14
+  80532e:	41 55                	push   %r13
+  805330:	41 54                	push   %r12
+  805332:	53                   	push   %rbx
+  805333:	48 83 ec 38          	sub    $0x38,%rsp
+  805337:	48 89 7d c8          	mov    %rdi,-0x38(%rbp)
+  80533b:	49 89 f4             	mov    %rsi,%r12
+  80533e:	49 89 d7             	mov    %rdx,%r15
+  805341:	48 89 55 a8          	mov    %rdx,-0x58(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  805345:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  80534c:	00 00 00 
+  80534f:	ff d0                	call   *%rax
+  805351:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  805354:	4d 85 ff             	test   %r15,%r15
+  805357:	0f 84 f1 00 00 00    	je     80544e <devpipe_write+0x128>
+  80535d:	4c 89 65 b8          	mov    %r12,-0x48(%rbp)
+  805361:	4b 8d 04 3c          	lea    (%r12,%r15,1),%rax
+  805365:	48 89 45 b0          	mov    %rax,-0x50(%rbp)
+            if (_pipeisclosed(fd, p)) return 0;
+  805369:	49 bd ff 52 80 00 00 	movabs $0x8052ff,%r13
+  805370:	00 00 00 
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  805373:	49 bf 5c 52 80 00 00 	movabs $0x80525c,%r15
+  80537a:	00 00 00 
+  80537d:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  805381:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805385:	4c 8d 73 08          	lea    0x8(%rbx),%r14
+        while (p->p_wpos >= p->p_rpos + sizeof(p->p_buf)) /* pipe is full */ {
+  805389:	8b 73 04             	mov    0x4(%rbx),%esi
+  80538c:	48 63 ce             	movslq %esi,%rcx
+  80538f:	48 63 03             	movslq (%rbx),%rax
+  805392:	48 05 f0 0f 00 00    	add    $0xff0,%rax
+  805398:	48 39 c1             	cmp    %rax,%rcx
+  80539b:	72 64                	jb     805401 <devpipe_write+0xdb>
+            if (_pipeisclosed(fd, p)) return 0;
+  80539d:	48 89 de             	mov    %rbx,%rsi
+  8053a0:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8053a4:	41 ff d5             	call   *%r13
+  8053a7:	85 c0                	test   %eax,%eax
+  8053a9:	0f 85 b9 00 00 00    	jne    805468 <devpipe_write+0x142>
+            pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  8053af:	48 8b 75 c0          	mov    -0x40(%rbp),%rsi
+  8053b3:	4c 89 f7             	mov    %r14,%rdi
+  8053b6:	41 ff d7             	call   *%r15
+            pipe_sleep(fd, p, &p->p_wwaiting, &p->p_rpos, p->p_wpos - sizeof(p->p_buf));
+  8053b9:	8b 43 04             	mov    0x4(%rbx),%eax
+  8053bc:	44 8d a0 10 f0 ff ff 	lea    -0xff0(%rax),%r12d
+    *waiting = 1;
+  8053c3:	c7 43 0c 01 00 00 00 	movl   $0x1,0xc(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8053ca:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8053d0:	8b 03                	mov    (%rbx),%eax
+  8053d2:	41 39 c4             	cmp    %eax,%r12d
+  8053d5:	75 b2                	jne    805389 <devpipe_write+0x63>
+  8053d7:	48 89 de             	mov    %rbx,%rsi
+  8053da:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  8053de:	41 ff d5             	call   *%r13
+  8053e1:	85 c0                	test   %eax,%eax
+  8053e3:	75 a0                	jne    805385 <devpipe_write+0x5f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  8053e5:	ba 0a 00 00 00       	mov    $0xa,%edx
+  8053ea:	44 89 e6             	mov    %r12d,%esi
+  8053ed:	48 89 df             	mov    %rbx,%rdi
+  8053f0:	48 b8 3f 23 80 00 00 	movabs $0x80233f,%rax
+  8053f7:	00 00 00 
+  8053fa:	ff d0                	call   *%rax
+  8053fc:	e9 7c ff ff ff       	jmp    80537d <devpipe_write+0x57>
+        p->p_buf[p->p_wpos % PIPEBUFSIZ] = buf[i];
+  805401:	4c 8b 45 b8          	mov    -0x48(%rbp),%r8
+  805405:	41 0f b6 38          	movzbl (%r8),%edi
+  805409:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  805410:	80 80 80 
+  805413:	48 89 c8             	mov    %rcx,%rax
+  805416:	48 f7 e2             	mul    %rdx
+  805419:	48 c1 ea 0b          	shr    $0xb,%rdx
+  80541d:	48 89 d0             	mov    %rdx,%rax
+  805420:	48 c1 e0 08          	shl    $0x8,%rax
+  805424:	48 29 d0             	sub    %rdx,%rax
+  805427:	48 c1 e0 04          	shl    $0x4,%rax
+  80542b:	48 29 c1             	sub    %rax,%rcx
+  80542e:	40 88 7c 0b 10       	mov    %dil,0x10(%rbx,%rcx,1)
+        p->p_wpos++;
+  805433:	83 c6 01             	add    $0x1,%esi
+  805436:	89 73 04             	mov    %esi,0x4(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  805439:	49 83 c0 01          	add    $0x1,%r8
+  80543d:	4c 89 45 b8          	mov    %r8,-0x48(%rbp)
+  805441:	48 8b 45 b0          	mov    -0x50(%rbp),%rax
+  805445:	49 39 c0             	cmp    %rax,%r8
+  805448:	0f 85 2f ff ff ff    	jne    80537d <devpipe_write+0x57>
+    pipe_wakeup(&p->p_rwaiting, &p->p_wpos);
+  80544e:	48 8d 73 04          	lea    0x4(%rbx),%rsi
+  805452:	48 8d 7b 08          	lea    0x8(%rbx),%rdi
+  805456:	48 b8 5c 52 80 00 00 	movabs $0x80525c,%rax
+  80545d:	00 00 00 
+  805460:	ff d0                	call   *%rax
+    return n;
+  805462:	48 8b 45 a8          	mov    -0x58(%rbp),%rax
+  805466:	eb 05                	jmp    80546d <devpipe_write+0x147>
+            if (_pipeisclosed(fd, p)) return 0;
+  805468:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  80546d:	48 83 c4 38          	add    $0x38,%rsp
+  805471:	5b                   	pop    %rbx
+  805472:	41 5c                	pop    %r12
+  805474:	41 5d                	pop    %r13
+  805476:	41 5e                	pop    %r14
+  805478:	41 5f                	pop    %r15
+  80547a:	5d                   	pop    %rbp
+  80547b:	c3                   	ret
+
+000000000080547c <devpipe_read>:
+devpipe_read(struct Fd *fd, void *vbuf, size_t n) {
+  80547c:	55                   	push   %rbp
+  80547d:	48 89 e5             	mov    %rsp,%rbp
+  805480:	41 57                	push   %r15
+  805482:	41 56                	push   %r14
+  805484:	41 55                	push   %r13
+  805486:	41 54                	push   %r12
+  805488:	53                   	push   %rbx
+  805489:	48 83 ec 28          	sub    $0x28,%rsp
+  80548d:	49 89 fd             	mov    %rdi,%r13
+  805490:	48 89 75 b8          	mov    %rsi,-0x48(%rbp)
+  805494:	49 89 d4             	mov    %rdx,%r12
+  805497:	48 89 55 c0          	mov    %rdx,-0x40(%rbp)
+    struct Pipe *p = (struct Pipe *)fd2data(fd);
+  80549b:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  8054a2:	00 00 00 
+  8054a5:	ff d0                	call   *%rax
+  8054a7:	48 89 c3             	mov    %rax,%rbx
+    for (size_t i = 0; i < n; i++) {
+  8054aa:	41 be 00 00 00 00    	mov    $0x0,%r14d
+            if (_pipeisclosed(fd, p)) return 0;
+  8054b0:	49 bf ff 52 80 00 00 	movabs $0x8052ff,%r15
+  8054b7:	00 00 00 
+    for (size_t i = 0; i < n; i++) {
+  8054ba:	4d 85 e4             	test   %r12,%r12
+  8054bd:	0f 84 d5 00 00 00    	je     805598 <devpipe_read+0x11c>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8054c3:	48 8d 43 04          	lea    0x4(%rbx),%rax
+  8054c7:	48 89 45 c8          	mov    %rax,-0x38(%rbp)
+        while (p->p_rpos == p->p_wpos) /* pipe is empty */ {
+  8054cb:	8b 03                	mov    (%rbx),%eax
+  8054cd:	3b 43 04             	cmp    0x4(%rbx),%eax
+  8054d0:	75 7a                	jne    80554c <devpipe_read+0xd0>
+            if (i > 0) {
+  8054d2:	4d 85 f6             	test   %r14,%r14
+  8054d5:	75 50                	jne    805527 <devpipe_read+0xab>
+            if (_pipeisclosed(fd, p)) return 0;
+  8054d7:	48 89 de             	mov    %rbx,%rsi
+  8054da:	4c 89 ef             	mov    %r13,%rdi
+  8054dd:	41 ff d7             	call   *%r15
+  8054e0:	85 c0                	test   %eax,%eax
+  8054e2:	0f 85 c9 00 00 00    	jne    8055b1 <devpipe_read+0x135>
+            pipe_sleep(fd, p, &p->p_rwaiting, &p->p_wpos, p->p_rpos);
+  8054e8:	44 8b 23             	mov    (%rbx),%r12d
+    *waiting = 1;
+  8054eb:	c7 43 08 01 00 00 00 	movl   $0x1,0x8(%rbx)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  8054f2:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (*(volatile off_t *)pos != seen || _pipeisclosed(fd, p)) return;
+  8054f8:	8b 43 04             	mov    0x4(%rbx),%eax
+  8054fb:	41 39 c4             	cmp    %eax,%r12d
+  8054fe:	75 cb                	jne    8054cb <devpipe_read+0x4f>
+  805500:	48 89 de             	mov    %rbx,%rsi
+  805503:	4c 89 ef             	mov    %r13,%rdi
+  805506:	41 ff d7             	call   *%r15
+  805509:	85 c0                	test   %eax,%eax
+  80550b:	75 be                	jne    8054cb <devpipe_read+0x4f>
+    sys_futex_wait(POS_WORD(*pos), (uint32_t)seen, PIPE_WAIT_TIMEOUT);
+  80550d:	ba 0a 00 00 00       	mov    $0xa,%edx
+  805512:	44 89 e6             	mov    %r12d,%esi
+  805515:	48 8b 7d c8          	mov    -0x38(%rbp),%rdi
+  805519:	48 b8 3f 23 80 00 00 	movabs $0x80233f,%rax
+  805520:	00 00 00 
+  805523:	ff d0                	call   *%rax
+  805525:	eb a4                	jmp    8054cb <devpipe_read+0x4f>
+                pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  805527:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80552b:	48 89 de             	mov    %rbx,%rsi
+  80552e:	48 b8 5c 52 80 00 00 	movabs $0x80525c,%rax
+  805535:	00 00 00 
+  805538:	ff d0                	call   *%rax
+                return i;
+  80553a:	4c 89 f0             	mov    %r14,%rax
+}
+  80553d:	48 83 c4 28          	add    $0x28,%rsp
+  805541:	5b                   	pop    %rbx
+  805542:	41 5c                	pop    %r12
+  805544:	41 5d                	pop    %r13
+  805546:	41 5e                	pop    %r14
+  805548:	41 5f                	pop    %r15
+  80554a:	5d                   	pop    %rbp
+  80554b:	c3                   	ret
+        buf[i] = p->p_buf[p->p_rpos % PIPEBUFSIZ];
+  80554c:	48 63 c8             	movslq %eax,%rcx
+  80554f:	48 ba 81 80 80 80 80 	movabs $0x8080808080808081,%rdx
+  805556:	80 80 80 
+  805559:	48 89 c8             	mov    %rcx,%rax
+  80555c:	48 f7 e2             	mul    %rdx
+  80555f:	48 c1 ea 0b          	shr    $0xb,%rdx
+  805563:	48 89 d0             	mov    %rdx,%rax
+  805566:	48 c1 e0 08          	shl    $0x8,%rax
+  80556a:	48 29 d0             	sub    %rdx,%rax
+  80556d:	48 c1 e0 04          	shl    $0x4,%rax
+  805571:	48 89 c2             	mov    %rax,%rdx
+  805574:	48 89 c8             	mov    %rcx,%rax
+  805577:	48 29 d0             	sub    %rdx,%rax
+  80557a:	0f b6 44 03 10       	movzbl 0x10(%rbx,%rax,1),%eax
+  80557f:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  805583:	42 88 04 31          	mov    %al,(%rcx,%r14,1)
+        p->p_rpos++;
+  805587:	83 03 01             	addl   $0x1,(%rbx)
+    for (size_t i = 0; i < n; i++) {
+  80558a:	49 83 c6 01          	add    $0x1,%r14
+  80558e:	4c 39 75 c0          	cmp    %r14,-0x40(%rbp)
+  805592:	0f 85 2b ff ff ff    	jne    8054c3 <devpipe_read+0x47>
+    pipe_wakeup(&p->p_wwaiting, &p->p_rpos);
+  805598:	48 8d 7b 0c          	lea    0xc(%rbx),%rdi
+  80559c:	48 89 de             	mov    %rbx,%rsi
+  80559f:	48 b8 5c 52 80 00 00 	movabs $0x80525c,%rax
+  8055a6:	00 00 00 
+  8055a9:	ff d0                	call   *%rax
+    return n;
+  8055ab:	48 8b 45 c0          	mov    -0x40(%rbp),%rax
+  8055af:	eb 8c                	jmp    80553d <devpipe_read+0xc1>
+            if (_pipeisclosed(fd, p)) return 0;
+  8055b1:	b8 00 00 00 00       	mov    $0x0,%eax
+  8055b6:	eb 85                	jmp    80553d <devpipe_read+0xc1>
+
+00000000008055b8 <pipe>:
+pipe(int pfd[2]) {
+  8055b8:	55                   	push   %rbp
+  8055b9:	48 89 e5             	mov    %rsp,%rbp
+  8055bc:	41 55                	push   %r13
+  8055be:	41 54                	push   %r12
+  8055c0:	53                   	push   %rbx
+  8055c1:	48 83 ec 18          	sub    $0x18,%rsp
+  8055c5:	49 89 fc             	mov    %rdi,%r12
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  8055c8:	48 8d 7d d8          	lea    -0x28(%rbp),%rdi
+  8055cc:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  8055d3:	00 00 00 
+  8055d6:	ff d0                	call   *%rax
+  8055d8:	89 c3                	mov    %eax,%ebx
+  8055da:	85 c0                	test   %eax,%eax
+  8055dc:	0f 88 a0 01 00 00    	js     805782 <pipe+0x1ca>
+        (res = sys_alloc_region(0, fd0, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err;
+  8055e2:	b9 46 00 00 00       	mov    $0x46,%ecx
+  8055e7:	ba 00 10 00 00       	mov    $0x1000,%edx
+  8055ec:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  8055f0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8055f5:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8055fc:	00 00 00 
+  8055ff:	ff d0                	call   *%rax
+  805601:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd0)) < 0 ||
+  805603:	85 c0                	test   %eax,%eax
+  805605:	0f 88 77 01 00 00    	js     805782 <pipe+0x1ca>
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  80560b:	48 8d 7d d0          	lea    -0x30(%rbp),%rdi
+  80560f:	48 b8 cc 26 80 00 00 	movabs $0x8026cc,%rax
+  805616:	00 00 00 
+  805619:	ff d0                	call   *%rax
+  80561b:	89 c3                	mov    %eax,%ebx
+  80561d:	85 c0                	test   %eax,%eax
+  80561f:	0f 88 43 01 00 00    	js     805768 <pipe+0x1b0>
+        (res = sys_alloc_region(0, fd1, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err1;
+  805625:	b9 46 00 00 00       	mov    $0x46,%ecx
+  80562a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80562f:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805633:	bf 00 00 00 00       	mov    $0x0,%edi
+  805638:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  80563f:	00 00 00 
+  805642:	ff d0                	call   *%rax
+  805644:	89 c3                	mov    %eax,%ebx
+    if ((res = fd_alloc(&fd1)) < 0 ||
+  805646:	85 c0                	test   %eax,%eax
+  805648:	0f 88 1a 01 00 00    	js     805768 <pipe+0x1b0>
+    va = fd2data(fd0);
+  80564e:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805652:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  805659:	00 00 00 
+  80565c:	ff d0                	call   *%rax
+  80565e:	49 89 c5             	mov    %rax,%r13
+    if ((res = sys_alloc_region(0, va, PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err2;
+  805661:	b9 46 00 00 00       	mov    $0x46,%ecx
+  805666:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80566b:	48 89 c6             	mov    %rax,%rsi
+  80566e:	bf 00 00 00 00       	mov    $0x0,%edi
+  805673:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  80567a:	00 00 00 
+  80567d:	ff d0                	call   *%rax
+  80567f:	89 c3                	mov    %eax,%ebx
+  805681:	85 c0                	test   %eax,%eax
+  805683:	0f 88 c5 00 00 00    	js     80574e <pipe+0x196>
+    if ((res = sys_map_region(0, va, 0, fd2data(fd1), PAGE_SIZE, PROT_RW | PROT_SHARE)) < 0) goto err3;
+  805689:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  80568d:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  805694:	00 00 00 
+  805697:	ff d0                	call   *%rax
+  805699:	48 89 c1             	mov    %rax,%rcx
+  80569c:	41 b9 46 00 00 00    	mov    $0x46,%r9d
+  8056a2:	41 b8 00 10 00 00    	mov    $0x1000,%r8d
+  8056a8:	ba 00 00 00 00       	mov    $0x0,%edx
+  8056ad:	4c 89 ee             	mov    %r13,%rsi
+  8056b0:	bf 00 00 00 00       	mov    $0x0,%edi
+  8056b5:	48 b8 27 20 80 00 00 	movabs $0x802027,%rax
+  8056bc:	00 00 00 
+  8056bf:	ff d0                	call   *%rax
+  8056c1:	89 c3                	mov    %eax,%ebx
+  8056c3:	85 c0                	test   %eax,%eax
+  8056c5:	78 6e                	js     805735 <pipe+0x17d>
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  8056c7:	be 00 10 00 00       	mov    $0x1000,%esi
+  8056cc:	4c 89 ef             	mov    %r13,%rdi
+  8056cf:	48 b8 96 1f 80 00 00 	movabs $0x801f96,%rax
+  8056d6:	00 00 00 
+  8056d9:	ff d0                	call   *%rax
+  8056db:	83 f8 02             	cmp    $0x2,%eax
+  8056de:	0f 85 ab 00 00 00    	jne    80578f <pipe+0x1d7>
+    fd0->fd_dev_id = devpipe.dev_id;
+  8056e4:	a1 a0 70 80 00 00 00 	movabs 0x8070a0,%eax
+  8056eb:	00 00 
+  8056ed:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056f1:	89 02                	mov    %eax,(%rdx)
+    fd0->fd_omode = O_RDONLY;
+  8056f3:	48 8b 55 d8          	mov    -0x28(%rbp),%rdx
+  8056f7:	c7 42 08 00 00 00 00 	movl   $0x0,0x8(%rdx)
+    fd1->fd_dev_id = devpipe.dev_id;
+  8056fe:	48 8b 55 d0          	mov    -0x30(%rbp),%rdx
+  805702:	89 02                	mov    %eax,(%rdx)
+    fd1->fd_omode = O_WRONLY;
+  805704:	48 8b 45 d0          	mov    -0x30(%rbp),%rax
+  805708:	c7 40 08 01 00 00 00 	movl   $0x1,0x8(%rax)
+    pfd[0] = fd2num(fd0);
+  80570f:	48 8b 7d d8          	mov    -0x28(%rbp),%rdi
+  805713:	48 bb 9e 26 80 00 00 	movabs $0x80269e,%rbx
+  80571a:	00 00 00 
+  80571d:	ff d3                	call   *%rbx
+  80571f:	41 89 04 24          	mov    %eax,(%r12)
+    pfd[1] = fd2num(fd1);
+  805723:	48 8b 7d d0          	mov    -0x30(%rbp),%rdi
+  805727:	ff d3                	call   *%rbx
+  805729:	41 89 44 24 04       	mov    %eax,0x4(%r12)
+    return 0;
+  80572e:	bb 00 00 00 00       	mov    $0x0,%ebx
+  805733:	eb 4d                	jmp    805782 <pipe+0x1ca>
+    sys_unmap_region(0, va, PAGE_SIZE);
+  805735:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80573a:	4c 89 ee             	mov    %r13,%rsi
+  80573d:	bf 00 00 00 00       	mov    $0x0,%edi
+  805742:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  805749:	00 00 00 
+  80574c:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd1, PAGE_SIZE);
+  80574e:	ba 00 10 00 00       	mov    $0x1000,%edx
+  805753:	48 8b 75 d0          	mov    -0x30(%rbp),%rsi
+  805757:	bf 00 00 00 00       	mov    $0x0,%edi
+  80575c:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  805763:	00 00 00 
+  805766:	ff d0                	call   *%rax
+    sys_unmap_region(0, fd0, PAGE_SIZE);
+  805768:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80576d:	48 8b 75 d8          	mov    -0x28(%rbp),%rsi
+  805771:	bf 00 00 00 00       	mov    $0x0,%edi
+  805776:	48 b8 77 20 80 00 00 	movabs $0x802077,%rax
+  80577d:	00 00 00 
+  805780:	ff d0                	call   *%rax
+}
+  805782:	89 d8                	mov    %ebx,%eax
+  805784:	48 83 c4 18          	add    $0x18,%rsp
+  805788:	5b                   	pop    %rbx
+  805789:	41 5c                	pop    %r12
+  80578b:	41 5d                	pop    %r13
+  80578d:	5d                   	pop    %rbp
+  80578e:	c3                   	ret
+    assert(sys_region_refs(va, PAGE_SIZE) == 2);
+  80578f:	48 b9 f8 6c 80 00 00 	movabs $0x806cf8,%rcx
+  805796:	00 00 00 
+  805799:	48 ba 88 64 80 00 00 	movabs $0x806488,%rdx
+  8057a0:	00 00 00 
+  8057a3:	be 50 00 00 00       	mov    $0x50,%esi
+  8057a8:	48 bf e1 6c 80 00 00 	movabs $0x806ce1,%rdi
+  8057af:	00 00 00 
+  8057b2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8057b7:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  8057be:	00 00 00 
+  8057c1:	41 ff d0             	call   *%r8
+
+00000000008057c4 <pipeisclosed>:
+pipeisclosed(int fdnum) {
+  8057c4:	55                   	push   %rbp
+  8057c5:	48 89 e5             	mov    %rsp,%rbp
+  8057c8:	48 83 ec 10          	sub    $0x10,%rsp
+    int res = fd_lookup(fdnum, &fd);
+  8057cc:	48 8d 75 f8          	lea    -0x8(%rbp),%rsi
+  8057d0:	48 b8 2c 27 80 00 00 	movabs $0x80272c,%rax
+  8057d7:	00 00 00 
+  8057da:	ff d0                	call   *%rax
+    if (res < 0) return res;
+  8057dc:	85 c0                	test   %eax,%eax
+  8057de:	78 23                	js     805803 <pipeisclosed+0x3f>
+    struct Pipe *pip = (struct Pipe *)fd2data(fd);
+  8057e0:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8057e4:	48 b8 b0 26 80 00 00 	movabs $0x8026b0,%rax
+  8057eb:	00 00 00 
+  8057ee:	ff d0                	call   *%rax
+  8057f0:	48 89 c6             	mov    %rax,%rsi
+    return _pipeisclosed(fd, pip);
+  8057f3:	48 8b 7d f8          	mov    -0x8(%rbp),%rdi
+  8057f7:	48 b8 ff 52 80 00 00 	movabs $0x8052ff,%rax
+  8057fe:	00 00 00 
+  805801:	ff d0                	call   *%rax
+}
+  805803:	c9                   	leave
+  805804:	c3                   	ret
+
+0000000000805805 <wait>:
+#include <inc/lib.h>
+
+/* Waits until 'envid' exits. */
+void
+wait(envid_t envid) {
+  805805:	55                   	push   %rbp
+  805806:	48 89 e5             	mov    %rsp,%rbp
+  805809:	41 56                	push   %r14
+  80580b:	41 55                	push   %r13
+  80580d:	41 54                	push   %r12
+  80580f:	53                   	push   %rbx
+    assert(envid != 0);
+  805810:	85 ff                	test   %edi,%edi
+  805812:	0f 84 b7 00 00 00    	je     8058cf <wait+0xca>
+  805818:	41 89 fc             	mov    %edi,%r12d
+
+    const volatile struct Env *env = &envs[ENVX(envid)];
+  80581b:	89 f9                	mov    %edi,%ecx
+  80581d:	81 e1 ff 03 00 00    	and    $0x3ff,%ecx
+
+    for (;;) {
+        uint32_t seq = env->env_wait_seq;
+  805823:	48 bf 00 00 c0 1f 80 	movabs $0x801fc00000,%rdi
+  80582a:	00 00 00 
+  80582d:	45 89 e0             	mov    %r12d,%r8d
+  805830:	41 81 e0 ff 03 00 00 	and    $0x3ff,%r8d
+  805837:	4c 89 c0             	mov    %r8,%rax
+  80583a:	48 c1 e0 04          	shl    $0x4,%rax
+  80583e:	48 89 c2             	mov    %rax,%rdx
+  805841:	4c 29 c2             	sub    %r8,%rdx
+  805844:	48 c1 e2 05          	shl    $0x5,%rdx
+  805848:	48 01 fa             	add    %rdi,%rdx
+  80584b:	8b b2 b8 01 00 00    	mov    0x1b8(%rdx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  805851:	8b 82 c8 00 00 00    	mov    0xc8(%rdx),%eax
+  805857:	41 39 c4             	cmp    %eax,%r12d
+  80585a:	75 6a                	jne    8058c6 <wait+0xc1>
+
+        /* The kernel wakes us up when the environment is freed */
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  80585c:	48 63 d1             	movslq %ecx,%rdx
+  80585f:	48 89 d0             	mov    %rdx,%rax
+  805862:	48 c1 e0 04          	shl    $0x4,%rax
+  805866:	48 29 d0             	sub    %rdx,%rax
+  805869:	48 c1 e0 05          	shl    $0x5,%rax
+  80586d:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  805874:	00 00 00 
+  805877:	4c 8d b4 02 b8 01 00 	lea    0x1b8(%rdx,%rax,1),%r14
+  80587e:	00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  80587f:	48 63 c9             	movslq %ecx,%rcx
+  805882:	48 89 c8             	mov    %rcx,%rax
+  805885:	48 c1 e0 04          	shl    $0x4,%rax
+  805889:	48 29 c8             	sub    %rcx,%rax
+  80588c:	48 c1 e0 05          	shl    $0x5,%rax
+  805890:	48 89 d3             	mov    %rdx,%rbx
+  805893:	48 01 c3             	add    %rax,%rbx
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  805896:	49 bd 3f 23 80 00 00 	movabs $0x80233f,%r13
+  80589d:	00 00 00 
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8058a0:	8b 83 d4 00 00 00    	mov    0xd4(%rbx),%eax
+  8058a6:	85 c0                	test   %eax,%eax
+  8058a8:	74 1c                	je     8058c6 <wait+0xc1>
+        sys_futex_wait(&env->env_wait_seq, seq, 0);
+  8058aa:	ba 00 00 00 00       	mov    $0x0,%edx
+  8058af:	4c 89 f7             	mov    %r14,%rdi
+  8058b2:	41 ff d5             	call   *%r13
+        uint32_t seq = env->env_wait_seq;
+  8058b5:	8b b3 b8 01 00 00    	mov    0x1b8(%rbx),%esi
+        if (env->env_id != envid || env->env_status == ENV_FREE) break;
+  8058bb:	8b 83 c8 00 00 00    	mov    0xc8(%rbx),%eax
+  8058c1:	44 39 e0             	cmp    %r12d,%eax
+  8058c4:	74 da                	je     8058a0 <wait+0x9b>
+    }
+}
+  8058c6:	5b                   	pop    %rbx
+  8058c7:	41 5c                	pop    %r12
+  8058c9:	41 5d                	pop    %r13
+  8058cb:	41 5e                	pop    %r14
+  8058cd:	5d                   	pop    %rbp
+  8058ce:	c3                   	ret
+    assert(envid != 0);
+  8058cf:	48 b9 1c 6d 80 00 00 	movabs $0x806d1c,%rcx
+  8058d6:	00 00 00 
+  8058d9:	48 ba 88 64 80 00 00 	movabs $0x806488,%rdx
+  8058e0:	00 00 00 
+  8058e3:	be 06 00 00 00       	mov    $0x6,%esi
+  8058e8:	48 bf 27 6d 80 00 00 	movabs $0x806d27,%rdi
+  8058ef:	00 00 00 
+  8058f2:	b8 00 00 00 00       	mov    $0x0,%eax
+  8058f7:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  8058fe:	00 00 00 
+  805901:	41 ff d0             	call   *%r8
+
+0000000000805904 <get_uvpt_entry>:
+extern volatile pdpe_t uvpdp[];   /* VA of current page directory pointer */
+extern volatile pml4e_t uvpml4[]; /* VA of current page map level 4 */
+
+pte_t
+get_uvpt_entry(void *va) {
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  805904:	48 89 f8             	mov    %rdi,%rax
+  805907:	48 c1 e8 27          	shr    $0x27,%rax
+  80590b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805912:	01 00 00 
+  805915:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805919:	f6 c2 01             	test   $0x1,%dl
+  80591c:	74 6d                	je     80598b <get_uvpt_entry+0x87>
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80591e:	48 89 f8             	mov    %rdi,%rax
+  805921:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805925:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80592c:	01 00 00 
+  80592f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805933:	f6 c2 01             	test   $0x1,%dl
+  805936:	74 62                	je     80599a <get_uvpt_entry+0x96>
+  805938:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  80593f:	01 00 00 
+  805942:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805946:	f6 c2 80             	test   $0x80,%dl
+  805949:	75 4f                	jne    80599a <get_uvpt_entry+0x96>
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  80594b:	48 89 f8             	mov    %rdi,%rax
+  80594e:	48 c1 e8 15          	shr    $0x15,%rax
+  805952:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  805959:	01 00 00 
+  80595c:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805960:	f6 c2 01             	test   $0x1,%dl
+  805963:	74 44                	je     8059a9 <get_uvpt_entry+0xa5>
+  805965:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  80596c:	01 00 00 
+  80596f:	48 8b 14 c2          	mov    (%rdx,%rax,8),%rdx
+  805973:	f6 c2 80             	test   $0x80,%dl
+  805976:	75 31                	jne    8059a9 <get_uvpt_entry+0xa5>
+    return uvpt[VPT(va)];
+  805978:	48 c1 ef 0c          	shr    $0xc,%rdi
+  80597c:	48 b8 00 00 00 00 00 	movabs $0x10000000000,%rax
+  805983:	01 00 00 
+  805986:	48 8b 04 f8          	mov    (%rax,%rdi,8),%rax
+}
+  80598a:	c3                   	ret
+    if (!(uvpml4[VPML4(va)] & PTE_P)) return uvpml4[VPML4(va)];
+  80598b:	48 ba 00 20 40 80 00 	movabs $0x10080402000,%rdx
+  805992:	01 00 00 
+  805995:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  805999:	c3                   	ret
+    if (!(uvpdp[VPDP(va)] & PTE_P) || (uvpdp[VPDP(va)] & PTE_PS)) return uvpdp[VPDP(va)];
+  80599a:	48 ba 00 00 40 80 00 	movabs $0x10080400000,%rdx
+  8059a1:	01 00 00 
+  8059a4:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8059a8:	c3                   	ret
+    if (!(uvpd[VPD(va)] & PTE_P) || (uvpd[VPD(va)] & PTE_PS)) return uvpd[VPD(va)];
+  8059a9:	48 ba 00 00 00 80 00 	movabs $0x10080000000,%rdx
+  8059b0:	01 00 00 
+  8059b3:	48 8b 04 c2          	mov    (%rdx,%rax,8),%rax
+  8059b7:	c3                   	ret
+
+00000000008059b8 <get_prot>:
+
+int
+get_prot(void *va) {
+  8059b8:	55                   	push   %rbp
+  8059b9:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  8059bc:	48 b8 04 59 80 00 00 	movabs $0x805904,%rax
+  8059c3:	00 00 00 
+  8059c6:	ff d0                	call   *%rax
+  8059c8:	48 89 c2             	mov    %rax,%rdx
+    int prot = pte & PTE_AVAIL & ~PTE_SHARE;
+  8059cb:	25 00 0a 00 00       	and    $0xa00,%eax
+    if (pte & PTE_P) prot |= PROT_R;
+  8059d0:	89 c1                	mov    %eax,%ecx
+  8059d2:	83 c9 04             	or     $0x4,%ecx
+  8059d5:	f6 c2 01             	test   $0x1,%dl
+  8059d8:	0f 45 c1             	cmovne %ecx,%eax
+    if (pte & PTE_W) prot |= PROT_W;
+  8059db:	89 c1                	mov    %eax,%ecx
+  8059dd:	83 c9 02             	or     $0x2,%ecx
+  8059e0:	f6 c2 02             	test   $0x2,%dl
+  8059e3:	0f 45 c1             	cmovne %ecx,%eax
+    if (!(pte & PTE_NX)) prot |= PROT_X;
+  8059e6:	89 c1                	mov    %eax,%ecx
+  8059e8:	83 c9 01             	or     $0x1,%ecx
+  8059eb:	48 85 d2             	test   %rdx,%rdx
+  8059ee:	0f 49 c1             	cmovns %ecx,%eax
+    if (pte & PTE_SHARE) prot |= PROT_SHARE;
+  8059f1:	89 c1                	mov    %eax,%ecx
+  8059f3:	83 c9 40             	or     $0x40,%ecx
+  8059f6:	f6 c6 04             	test   $0x4,%dh
+  8059f9:	0f 45 c1             	cmovne %ecx,%eax
+    return prot;
+}
+  8059fc:	5d                   	pop    %rbp
+  8059fd:	c3                   	ret
+
+00000000008059fe <is_page_dirty>:
+
+bool
+is_page_dirty(void *va) {
+  8059fe:	55                   	push   %rbp
+  8059ff:	48 89 e5             	mov    %rsp,%rbp
+    pte_t pte = get_uvpt_entry(va);
+  805a02:	48 b8 04 59 80 00 00 	movabs $0x805904,%rax
+  805a09:	00 00 00 
+  805a0c:	ff d0                	call   *%rax
+    return pte & PTE_D;
+  805a0e:	48 c1 e8 06          	shr    $0x6,%rax
+  805a12:	83 e0 01             	and    $0x1,%eax
+}
+  805a15:	5d                   	pop    %rbp
+  805a16:	c3                   	ret
+
+0000000000805a17 <is_page_present>:
+
+bool
+is_page_present(void *va) {
+  805a17:	55                   	push   %rbp
+  805a18:	48 89 e5             	mov    %rsp,%rbp
+    return get_uvpt_entry(va) & PTE_P;
+  805a1b:	48 b8 04 59 80 00 00 	movabs $0x805904,%rax
+  805a22:	00 00 00 
+  805a25:	ff d0                	call   *%rax
+  805a27:	83 e0 01             	and    $0x1,%eax
+}
+  805a2a:	5d                   	pop    %rbp
+  805a2b:	c3                   	ret
+
+0000000000805a2c <foreach_shared_region>:
+int
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+    /* Calls fun() for every shared region */
+    // LAB 11: Your code here
+    for (uintptr_t i = 0; i < MAX_USER_ADDRESS; i += (1LL << PML4_SHIFT)) {
+        if (uvpml4[VPML4(i)] & PTE_P) {
+  805a2c:	48 a1 00 20 40 80 00 	movabs 0x10080402000,%rax
+  805a33:	01 00 00 
+  805a36:	a8 01                	test   $0x1,%al
+  805a38:	75 06                	jne    805a40 <foreach_shared_region+0x14>
+                }
+            }
+        }
+    }
+    return 0;
+  805a3a:	b8 00 00 00 00       	mov    $0x0,%eax
+  805a3f:	c3                   	ret
+foreach_shared_region(int (*fun)(void *start, void *end, void *arg), void *arg) {
+  805a40:	55                   	push   %rbp
+  805a41:	48 89 e5             	mov    %rsp,%rbp
+  805a44:	41 57                	push   %r15
+  805a46:	41 56                	push   %r14
+  805a48:	41 55                	push   %r13
+  805a4a:	41 54                	push   %r12
+  805a4c:	53                   	push   %rbx
+  805a4d:	48 83 ec 28          	sub    $0x28,%rsp
+  805a51:	49 89 fe             	mov    %rdi,%r14
+  805a54:	49 89 f7             	mov    %rsi,%r15
+  805a57:	48 c7 45 b8 00 00 00 	movq   $0x0,-0x48(%rbp)
+  805a5e:	00 
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  805a5f:	49 bd 00 00 00 00 00 	movabs $0x10000000000,%r13
+  805a66:	01 00 00 
+  805a69:	e9 ae 00 00 00       	jmp    805b1c <foreach_shared_region+0xf0>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  805a6e:	48 81 c3 00 10 00 00 	add    $0x1000,%rbx
+  805a75:	49 83 ec 01          	sub    $0x1,%r12
+  805a79:	74 2d                	je     805aa8 <foreach_shared_region+0x7c>
+                                if (uvpt[VPT(addr)] & PTE_P && uvpt[VPT(addr)] & PTE_SHARE) {
+  805a7b:	48 89 d8             	mov    %rbx,%rax
+  805a7e:	48 c1 e8 0c          	shr    $0xc,%rax
+  805a82:	49 8b 54 c5 00       	mov    0x0(%r13,%rax,8),%rdx
+  805a87:	f6 c2 01             	test   $0x1,%dl
+  805a8a:	74 e2                	je     805a6e <foreach_shared_region+0x42>
+  805a8c:	49 8b 44 c5 00       	mov    0x0(%r13,%rax,8),%rax
+  805a91:	f6 c4 04             	test   $0x4,%ah
+  805a94:	74 d8                	je     805a6e <foreach_shared_region+0x42>
+                                    fun((void *)addr, (void *)(addr + PAGE_SIZE), arg);
+  805a96:	48 8d b3 00 10 00 00 	lea    0x1000(%rbx),%rsi
+  805a9d:	4c 89 fa             	mov    %r15,%rdx
+  805aa0:	48 89 df             	mov    %rbx,%rdi
+  805aa3:	41 ff d6             	call   *%r14
+  805aa6:	eb c6                	jmp    805a6e <foreach_shared_region+0x42>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  805aa8:	48 81 45 c8 00 00 20 	addq   $0x200000,-0x38(%rbp)
+  805aaf:	00 
+  805ab0:	48 83 6d c0 01       	subq   $0x1,-0x40(%rbp)
+  805ab5:	74 4a                	je     805b01 <foreach_shared_region+0xd5>
+                        if (uvpd[VPD(k)] & PTE_P) {
+  805ab7:	48 8b 45 c8          	mov    -0x38(%rbp),%rax
+  805abb:	48 c1 e8 15          	shr    $0x15,%rax
+  805abf:	48 b9 00 00 00 80 00 	movabs $0x10080000000,%rcx
+  805ac6:	01 00 00 
+  805ac9:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  805acd:	a8 01                	test   $0x1,%al
+  805acf:	74 d7                	je     805aa8 <foreach_shared_region+0x7c>
+                            for (uintptr_t addr = k; addr < k + (1LL << PD_SHIFT); addr += (1LL << PT_SHIFT)) {
+  805ad1:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  805ad5:	48 8d 83 00 00 20 00 	lea    0x200000(%rbx),%rax
+  805adc:	48 39 c3             	cmp    %rax,%rbx
+  805adf:	73 c7                	jae    805aa8 <foreach_shared_region+0x7c>
+  805ae1:	48 8d 93 00 10 00 00 	lea    0x1000(%rbx),%rdx
+  805ae8:	48 39 d0             	cmp    %rdx,%rax
+  805aeb:	4d 19 e4             	sbb    %r12,%r12
+  805aee:	49 81 e4 01 fe ff ff 	and    $0xfffffffffffffe01,%r12
+  805af5:	49 81 c4 00 02 00 00 	add    $0x200,%r12
+  805afc:	e9 7a ff ff ff       	jmp    805a7b <foreach_shared_region+0x4f>
+            for (uintptr_t j = i; j < i + (1LL << PML4_SHIFT); j += (1LL << PDP_SHIFT)) {
+  805b01:	48 81 45 b8 00 00 00 	addq   $0x40000000,-0x48(%rbp)
+  805b08:	40 
+  805b09:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  805b0d:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  805b14:	00 00 00 
+  805b17:	48 39 c1             	cmp    %rax,%rcx
+  805b1a:	74 50                	je     805b6c <foreach_shared_region+0x140>
+                if (uvpdp[VPDP(j)] & PTE_P) {
+  805b1c:	48 8b 45 b8          	mov    -0x48(%rbp),%rax
+  805b20:	48 c1 e8 1e          	shr    $0x1e,%rax
+  805b24:	48 b9 00 00 40 80 00 	movabs $0x10080400000,%rcx
+  805b2b:	01 00 00 
+  805b2e:	48 8b 04 c1          	mov    (%rcx,%rax,8),%rax
+  805b32:	a8 01                	test   $0x1,%al
+  805b34:	74 cb                	je     805b01 <foreach_shared_region+0xd5>
+                    for (uintptr_t k = j; k < j + (1LL << PDP_SHIFT); k += (1LL << PD_SHIFT)) {
+  805b36:	48 8b 4d b8          	mov    -0x48(%rbp),%rcx
+  805b3a:	48 8d 81 00 00 00 40 	lea    0x40000000(%rcx),%rax
+  805b41:	48 39 c1             	cmp    %rax,%rcx
+  805b44:	73 bb                	jae    805b01 <foreach_shared_region+0xd5>
+  805b46:	48 8d 91 00 00 20 00 	lea    0x200000(%rcx),%rdx
+  805b4d:	48 39 d0             	cmp    %rdx,%rax
+  805b50:	48 19 c0             	sbb    %rax,%rax
+  805b53:	48 25 01 fe ff ff    	and    $0xfffffffffffffe01,%rax
+  805b59:	48 05 00 02 00 00    	add    $0x200,%rax
+  805b5f:	48 89 45 c0          	mov    %rax,-0x40(%rbp)
+  805b63:	48 89 4d c8          	mov    %rcx,-0x38(%rbp)
+  805b67:	e9 4b ff ff ff       	jmp    805ab7 <foreach_shared_region+0x8b>
+  805b6c:	b8 00 00 00 00       	mov    $0x0,%eax
+  805b71:	48 83 c4 28          	add    $0x28,%rsp
+  805b75:	5b                   	pop    %rbx
+  805b76:	41 5c                	pop    %r12
+  805b78:	41 5d                	pop    %r13
+  805b7a:	41 5e                	pop    %r14
+  805b7c:	41 5f                	pop    %r15
+  805b7e:	5d                   	pop    %rbp
+  805b7f:	c3                   	ret
+
+0000000000805b80 <ring_enter>:
+    }
+}
+#endif
+
+static int
+ring_enter(void) {
+  805b80:	55                   	push   %rbp
+  805b81:	48 89 e5             	mov    %rsp,%rbp
+    int res;
+
+    /* Forked children inherit the ring but not its registration */
+    if (thisenv->env_sc_ring != &ring &&
+  805b84:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  805b8b:	00 00 00 
+  805b8e:	48 8b 90 c0 01 00 00 	mov    0x1c0(%rax),%rdx
+  805b95:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  805b9c:	00 00 00 
+  805b9f:	48 39 c2             	cmp    %rax,%rdx
+  805ba2:	74 13                	je     805bb7 <ring_enter+0x37>
+        (res = sys_ring_register(&ring)) < 0) goto out;
+  805ba4:	48 89 c7             	mov    %rax,%rdi
+  805ba7:	48 b8 b6 22 80 00 00 	movabs $0x8022b6,%rax
+  805bae:	00 00 00 
+  805bb1:	ff d0                	call   *%rax
+    if (thisenv->env_sc_ring != &ring &&
+  805bb3:	85 c0                	test   %eax,%eax
+  805bb5:	78 0c                	js     805bc3 <ring_enter+0x43>
+
+#ifdef SANITIZE_USER_SHADOW_BASE
+    uint32_t head = ring.sr_head;
+#endif
+
+    res = sys_ring_enter();
+  805bb7:	48 b8 16 23 80 00 00 	movabs $0x802316,%rax
+  805bbe:	00 00 00 
+  805bc1:	ff d0                	call   *%rax
+    }
+#endif
+
+out:
+    /* Calls queued after the failed one are dropped */
+    ring.sr_tail = ring.sr_head;
+  805bc3:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  805bca:	00 00 00 
+  805bcd:	8b 0a                	mov    (%rdx),%ecx
+  805bcf:	89 4a 04             	mov    %ecx,0x4(%rdx)
+    return res;
+}
+  805bd2:	5d                   	pop    %rbp
+  805bd3:	c3                   	ret
+
+0000000000805bd4 <scring_push>:
+
+/* Queue system call num, the ring is submitted
+ * automatically when it is full. Errors are reported
+ * by scring_submit(), calls queued after an error are dropped */
+void
+scring_push(uintptr_t num, uintptr_t a1, uintptr_t a2, uintptr_t a3, uintptr_t a4, uintptr_t a5, uintptr_t a6) {
+  805bd4:	55                   	push   %rbp
+  805bd5:	48 89 e5             	mov    %rsp,%rbp
+  805bd8:	41 57                	push   %r15
+  805bda:	41 56                	push   %r14
+  805bdc:	41 55                	push   %r13
+  805bde:	41 54                	push   %r12
+  805be0:	53                   	push   %rbx
+  805be1:	48 83 ec 18          	sub    $0x18,%rsp
+  805be5:	4c 89 4d c8          	mov    %r9,-0x38(%rbp)
+    if (pending_error) return;
+  805be9:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  805bf0:	00 00 00 
+  805bf3:	83 38 00             	cmpl   $0x0,(%rax)
+  805bf6:	75 69                	jne    805c61 <scring_push+0x8d>
+  805bf8:	49 89 ff             	mov    %rdi,%r15
+  805bfb:	49 89 f6             	mov    %rsi,%r14
+  805bfe:	49 89 d5             	mov    %rdx,%r13
+  805c01:	49 89 cc             	mov    %rcx,%r12
+  805c04:	4c 89 c3             	mov    %r8,%rbx
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  805c07:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  805c0e:	00 00 00 
+  805c11:	8b 42 04             	mov    0x4(%rdx),%eax
+  805c14:	8b 12                	mov    (%rdx),%edx
+  805c16:	29 d0                	sub    %edx,%eax
+  805c18:	83 f8 20             	cmp    $0x20,%eax
+  805c1b:	74 53                	je     805c70 <scring_push+0x9c>
+        (pending_error = ring_enter()) < 0) return;
+
+    struct SyscallDesc *sd = &ring.sr_desc[ring.sr_tail % SCRING_SIZE];
+  805c1d:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  805c24:	00 00 00 
+  805c27:	8b 42 04             	mov    0x4(%rdx),%eax
+    sd->sd_num = num;
+  805c2a:	83 e0 1f             	and    $0x1f,%eax
+  805c2d:	48 c1 e0 06          	shl    $0x6,%rax
+  805c31:	48 01 d0             	add    %rdx,%rax
+  805c34:	4c 89 78 08          	mov    %r15,0x8(%rax)
+    sd->sd_args[0] = a1;
+  805c38:	4c 89 70 10          	mov    %r14,0x10(%rax)
+    sd->sd_args[1] = a2;
+  805c3c:	4c 89 68 18          	mov    %r13,0x18(%rax)
+    sd->sd_args[2] = a3;
+  805c40:	4c 89 60 20          	mov    %r12,0x20(%rax)
+    sd->sd_args[3] = a4;
+  805c44:	48 89 58 28          	mov    %rbx,0x28(%rax)
+    sd->sd_args[4] = a5;
+  805c48:	48 8b 5d c8          	mov    -0x38(%rbp),%rbx
+  805c4c:	48 89 58 30          	mov    %rbx,0x30(%rax)
+    sd->sd_args[5] = a6;
+  805c50:	48 8b 4d 10          	mov    0x10(%rbp),%rcx
+  805c54:	48 89 48 38          	mov    %rcx,0x38(%rax)
+    ring.sr_tail++;
+  805c58:	8b 42 04             	mov    0x4(%rdx),%eax
+  805c5b:	83 c0 01             	add    $0x1,%eax
+  805c5e:	89 42 04             	mov    %eax,0x4(%rdx)
+}
+  805c61:	48 83 c4 18          	add    $0x18,%rsp
+  805c65:	5b                   	pop    %rbx
+  805c66:	41 5c                	pop    %r12
+  805c68:	41 5d                	pop    %r13
+  805c6a:	41 5e                	pop    %r14
+  805c6c:	41 5f                	pop    %r15
+  805c6e:	5d                   	pop    %rbp
+  805c6f:	c3                   	ret
+        (pending_error = ring_enter()) < 0) return;
+  805c70:	48 b8 80 5b 80 00 00 	movabs $0x805b80,%rax
+  805c77:	00 00 00 
+  805c7a:	ff d0                	call   *%rax
+  805c7c:	a3 00 10 84 00 00 00 	movabs %eax,0x841000
+  805c83:	00 00 
+    if (ring.sr_tail - ring.sr_head == SCRING_SIZE &&
+  805c85:	85 c0                	test   %eax,%eax
+  805c87:	79 94                	jns    805c1d <scring_push+0x49>
+  805c89:	eb d6                	jmp    805c61 <scring_push+0x8d>
+
+0000000000805c8b <scring_submit>:
+
+/* Execute all queued calls.
+ * Returns 0 on success or the error of the first failed call */
+int
+scring_submit(void) {
+    int res = pending_error;
+  805c8b:	48 ba 00 10 84 00 00 	movabs $0x841000,%rdx
+  805c92:	00 00 00 
+  805c95:	8b 02                	mov    (%rdx),%eax
+    pending_error = 0;
+  805c97:	c7 02 00 00 00 00    	movl   $0x0,(%rdx)
+
+    if (res < 0)
+  805c9d:	85 c0                	test   %eax,%eax
+  805c9f:	78 14                	js     805cb5 <scring_submit+0x2a>
+        ring.sr_tail = ring.sr_head;
+    else if (ring.sr_tail != ring.sr_head)
+  805ca1:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  805ca8:	00 00 00 
+  805cab:	8b 4a 04             	mov    0x4(%rdx),%ecx
+  805cae:	8b 12                	mov    (%rdx),%edx
+  805cb0:	39 d1                	cmp    %edx,%ecx
+  805cb2:	75 11                	jne    805cc5 <scring_submit+0x3a>
+        res = ring_enter();
+
+    return res;
+}
+  805cb4:	c3                   	ret
+        ring.sr_tail = ring.sr_head;
+  805cb5:	48 ba 40 10 84 00 00 	movabs $0x841040,%rdx
+  805cbc:	00 00 00 
+  805cbf:	8b 0a                	mov    (%rdx),%ecx
+  805cc1:	89 4a 04             	mov    %ecx,0x4(%rdx)
+  805cc4:	c3                   	ret
+scring_submit(void) {
+  805cc5:	55                   	push   %rbp
+  805cc6:	48 89 e5             	mov    %rsp,%rbp
+        res = ring_enter();
+  805cc9:	48 b8 80 5b 80 00 00 	movabs $0x805b80,%rax
+  805cd0:	00 00 00 
+  805cd3:	ff d0                	call   *%rax
+}
+  805cd5:	5d                   	pop    %rbp
+  805cd6:	c3                   	ret
+
+0000000000805cd7 <scring_discard>:
+
+/* Drop all queued calls without executing them,
+ * along with an error scring_submit() would report */
+void
+scring_discard(void) {
+    pending_error = 0;
+  805cd7:	48 b8 00 10 84 00 00 	movabs $0x841000,%rax
+  805cde:	00 00 00 
+  805ce1:	c7 00 00 00 00 00    	movl   $0x0,(%rax)
+    ring.sr_tail = ring.sr_head;
+  805ce7:	48 b8 40 10 84 00 00 	movabs $0x841040,%rax
+  805cee:	00 00 00 
+  805cf1:	8b 10                	mov    (%rax),%edx
+  805cf3:	89 50 04             	mov    %edx,0x4(%rax)
+}
+  805cf6:	c3                   	ret
+
+0000000000805cf7 <scring_alloc_region>:
+
+void
+scring_alloc_region(envid_t envid, void *va, size_t size, int perm) {
+  805cf7:	55                   	push   %rbp
+  805cf8:	48 89 e5             	mov    %rsp,%rbp
+  805cfb:	48 89 f0             	mov    %rsi,%rax
+    scring_push(SYS_alloc_region, envid, (uintptr_t)va, size, perm, 0, 0);
+  805cfe:	48 63 f7             	movslq %edi,%rsi
+  805d01:	48 83 ec 08          	sub    $0x8,%rsp
+  805d05:	6a 00                	push   $0x0
+  805d07:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805d0d:	4c 63 c1             	movslq %ecx,%r8
+  805d10:	48 89 d1             	mov    %rdx,%rcx
+  805d13:	48 89 c2             	mov    %rax,%rdx
+  805d16:	bf 04 00 00 00       	mov    $0x4,%edi
+  805d1b:	48 b8 d4 5b 80 00 00 	movabs $0x805bd4,%rax
+  805d22:	00 00 00 
+  805d25:	ff d0                	call   *%rax
+}
+  805d27:	48 83 c4 10          	add    $0x10,%rsp
+  805d2b:	c9                   	leave
+  805d2c:	c3                   	ret
+
+0000000000805d2d <scring_map_region>:
+
+void
+scring_map_region(envid_t srcenv, void *srcva, envid_t dstenv, void *dstva, size_t size, int perm) {
+  805d2d:	55                   	push   %rbp
+  805d2e:	48 89 e5             	mov    %rsp,%rbp
+  805d31:	48 89 f0             	mov    %rsi,%rax
+  805d34:	49 89 ca             	mov    %rcx,%r10
+    scring_push(SYS_map_region, srcenv, (uintptr_t)srcva, dstenv, (uintptr_t)dstva, size, perm);
+  805d37:	48 63 ca             	movslq %edx,%rcx
+  805d3a:	48 63 f7             	movslq %edi,%rsi
+  805d3d:	48 83 ec 08          	sub    $0x8,%rsp
+  805d41:	4d 63 c9             	movslq %r9d,%r9
+  805d44:	41 51                	push   %r9
+  805d46:	4d 89 c1             	mov    %r8,%r9
+  805d49:	4d 89 d0             	mov    %r10,%r8
+  805d4c:	48 89 c2             	mov    %rax,%rdx
+  805d4f:	bf 05 00 00 00       	mov    $0x5,%edi
+  805d54:	48 b8 d4 5b 80 00 00 	movabs $0x805bd4,%rax
+  805d5b:	00 00 00 
+  805d5e:	ff d0                	call   *%rax
+}
+  805d60:	48 83 c4 10          	add    $0x10,%rsp
+  805d64:	c9                   	leave
+  805d65:	c3                   	ret
+
+0000000000805d66 <scring_unmap_region>:
+
+void
+scring_unmap_region(envid_t envid, void *va, size_t size) {
+  805d66:	55                   	push   %rbp
+  805d67:	48 89 e5             	mov    %rsp,%rbp
+  805d6a:	48 89 f0             	mov    %rsi,%rax
+  805d6d:	48 89 d1             	mov    %rdx,%rcx
+    scring_push(SYS_unmap_region, envid, (uintptr_t)va, size, 0, 0, 0);
+  805d70:	48 63 f7             	movslq %edi,%rsi
+  805d73:	48 83 ec 08          	sub    $0x8,%rsp
+  805d77:	6a 00                	push   $0x0
+  805d79:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805d7f:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805d85:	48 89 c2             	mov    %rax,%rdx
+  805d88:	bf 06 00 00 00       	mov    $0x6,%edi
+  805d8d:	48 b8 d4 5b 80 00 00 	movabs $0x805bd4,%rax
+  805d94:	00 00 00 
+  805d97:	ff d0                	call   *%rax
+}
+  805d99:	48 83 c4 10          	add    $0x10,%rsp
+  805d9d:	c9                   	leave
+  805d9e:	c3                   	ret
+
+0000000000805d9f <scring_env_set_status>:
+
+void
+scring_env_set_status(envid_t envid, int status) {
+  805d9f:	55                   	push   %rbp
+  805da0:	48 89 e5             	mov    %rsp,%rbp
+    scring_push(SYS_env_set_status, envid, status, 0, 0, 0, 0);
+  805da3:	48 63 d6             	movslq %esi,%rdx
+  805da6:	48 63 f7             	movslq %edi,%rsi
+  805da9:	48 83 ec 08          	sub    $0x8,%rsp
+  805dad:	6a 00                	push   $0x0
+  805daf:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805db5:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805dbb:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805dc0:	bf 09 00 00 00       	mov    $0x9,%edi
+  805dc5:	48 b8 d4 5b 80 00 00 	movabs $0x805bd4,%rax
+  805dcc:	00 00 00 
+  805dcf:	ff d0                	call   *%rax
+}
+  805dd1:	48 83 c4 10          	add    $0x10,%rsp
+  805dd5:	c9                   	leave
+  805dd6:	c3                   	ret
+
+0000000000805dd7 <scring_env_set_trapframe>:
+
+void
+scring_env_set_trapframe(envid_t envid, struct Trapframe *tf) {
+  805dd7:	55                   	push   %rbp
+  805dd8:	48 89 e5             	mov    %rsp,%rbp
+  805ddb:	48 89 f2             	mov    %rsi,%rdx
+    scring_push(SYS_env_set_trapframe, envid, (uintptr_t)tf, 0, 0, 0, 0);
+  805dde:	48 63 f7             	movslq %edi,%rsi
+  805de1:	48 83 ec 08          	sub    $0x8,%rsp
+  805de5:	6a 00                	push   $0x0
+  805de7:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  805ded:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  805df3:	b9 00 00 00 00       	mov    $0x0,%ecx
+  805df8:	bf 0a 00 00 00       	mov    $0xa,%edi
+  805dfd:	48 b8 d4 5b 80 00 00 	movabs $0x805bd4,%rax
+  805e04:	00 00 00 
+  805e07:	ff d0                	call   *%rax
+}
+  805e09:	48 83 c4 10          	add    $0x10,%rsp
+  805e0d:	c9                   	leave
+  805e0e:	c3                   	ret
+
+0000000000805e0f <chan_init>:
+
+#include <inc/lib.h>
+
+void
+chan_init(struct ChanRing *r) {
+    r->cr_head = 0;
+  805e0f:	c7 07 00 00 00 00    	movl   $0x0,(%rdi)
+    r->cr_waiting = 0;
+  805e15:	c7 47 04 00 00 00 00 	movl   $0x0,0x4(%rdi)
+    r->cr_tail = 0;
+  805e1c:	c7 47 40 00 00 00 00 	movl   $0x0,0x40(%rdi)
+}
+  805e23:	c3                   	ret
+
+0000000000805e24 <chan_prepare>:
+
+/* Number of messages in the ring, the other side
+ * is not trusted so the result is checked by callers */
+static uint32_t
+chan_count(struct ChanRing *r) {
+    return r->cr_tail - r->cr_head;
+  805e24:	8b 47 40             	mov    0x40(%rdi),%eax
+  805e27:	8b 17                	mov    (%rdi),%edx
+  805e29:	29 d0                	sub    %edx,%eax
+}
+
+/* Producer: slot for the next message, NULL if the ring is full */
+void *
+chan_prepare(struct ChanRing *r) {
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805e2b:	83 f8 0f             	cmp    $0xf,%eax
+  805e2e:	77 13                	ja     805e43 <chan_prepare+0x1f>
+    return r->cr_slots[r->cr_tail % CHAN_NSLOTS];
+  805e30:	8b 47 40             	mov    0x40(%rdi),%eax
+  805e33:	83 e0 0f             	and    $0xf,%eax
+  805e36:	48 c1 e0 09          	shl    $0x9,%rax
+  805e3a:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805e41:	00 
+  805e42:	c3                   	ret
+    if (chan_count(r) >= CHAN_NSLOTS) return NULL;
+  805e43:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e48:	c3                   	ret
+
+0000000000805e49 <chan_publish>:
+ * visible to the consumer. Returns true if the consumer is waiting
+ * and the caller has to ring the doorbell */
+bool
+chan_publish(struct ChanRing *r) {
+    /* Stores are not reordered on x86, only the compiler has to be stopped */
+    __atomic_store_n(&r->cr_tail, r->cr_tail + 1, __ATOMIC_RELEASE);
+  805e49:	8b 47 40             	mov    0x40(%rdi),%eax
+  805e4c:	83 c0 01             	add    $0x1,%eax
+  805e4f:	89 47 40             	mov    %eax,0x40(%rdi)
+
+    /* Order the tail store before the cr_waiting load, pairs with chan_arm() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805e52:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  805e58:	8b 57 04             	mov    0x4(%rdi),%edx
+  805e5b:	b8 00 00 00 00       	mov    $0x0,%eax
+  805e60:	85 d2                	test   %edx,%edx
+  805e62:	75 04                	jne    805e68 <chan_publish+0x1f>
+  805e64:	83 e0 01             	and    $0x1,%eax
+}
+  805e67:	c3                   	ret
+    return r->cr_waiting && __atomic_exchange_n(&r->cr_waiting, 0, __ATOMIC_SEQ_CST);
+  805e68:	87 47 04             	xchg   %eax,0x4(%rdi)
+  805e6b:	85 c0                	test   %eax,%eax
+  805e6d:	0f 95 c0             	setne  %al
+  805e70:	0f b6 c0             	movzbl %al,%eax
+  805e73:	eb ef                	jmp    805e64 <chan_publish+0x1b>
+
+0000000000805e75 <chan_peek>:
+
+/* Consumer: next message, NULL if the ring is empty */
+void *
+chan_peek(struct ChanRing *r) {
+    uint32_t count = __atomic_load_n(&r->cr_tail, __ATOMIC_ACQUIRE) - r->cr_head;
+  805e75:	8b 47 40             	mov    0x40(%rdi),%eax
+  805e78:	8b 17                	mov    (%rdi),%edx
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  805e7a:	29 d0                	sub    %edx,%eax
+  805e7c:	83 e8 01             	sub    $0x1,%eax
+  805e7f:	83 f8 0f             	cmp    $0xf,%eax
+  805e82:	77 12                	ja     805e96 <chan_peek+0x21>
+    return r->cr_slots[r->cr_head % CHAN_NSLOTS];
+  805e84:	8b 07                	mov    (%rdi),%eax
+  805e86:	83 e0 0f             	and    $0xf,%eax
+  805e89:	48 c1 e0 09          	shl    $0x9,%rax
+  805e8d:	48 8d 84 07 80 00 00 	lea    0x80(%rdi,%rax,1),%rax
+  805e94:	00 
+  805e95:	c3                   	ret
+    if (!count || count > CHAN_NSLOTS) return NULL;
+  805e96:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805e9b:	c3                   	ret
+
+0000000000805e9c <chan_release>:
+
+/* Consumer: free the slot of the message returned by chan_peek() */
+void
+chan_release(struct ChanRing *r) {
+    __atomic_store_n(&r->cr_head, r->cr_head + 1, __ATOMIC_RELEASE);
+  805e9c:	8b 07                	mov    (%rdi),%eax
+  805e9e:	83 c0 01             	add    $0x1,%eax
+  805ea1:	89 07                	mov    %eax,(%rdi)
+}
+  805ea3:	c3                   	ret
+
+0000000000805ea4 <chan_arm>:
+
+/* Consumer: ask for a doorbell. Returns true if the ring
+ * is still empty, so the consumer may go to sleep */
+bool
+chan_arm(struct ChanRing *r) {
+  805ea4:	55                   	push   %rbp
+  805ea5:	48 89 e5             	mov    %rsp,%rbp
+  805ea8:	53                   	push   %rbx
+  805ea9:	48 83 ec 08          	sub    $0x8,%rsp
+  805ead:	48 89 fb             	mov    %rdi,%rbx
+    r->cr_waiting = 1;
+  805eb0:	c7 47 04 01 00 00 00 	movl   $0x1,0x4(%rdi)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  805eb7:	f0 48 83 0c 24 00    	lock orq $0x0,(%rsp)
+    if (!chan_peek(r)) return 1;
+  805ebd:	48 b8 75 5e 80 00 00 	movabs $0x805e75,%rax
+  805ec4:	00 00 00 
+  805ec7:	ff d0                	call   *%rax
+  805ec9:	48 85 c0             	test   %rax,%rax
+  805ecc:	74 12                	je     805ee0 <chan_arm+0x3c>
+
+    r->cr_waiting = 0;
+  805ece:	c7 43 04 00 00 00 00 	movl   $0x0,0x4(%rbx)
+    return 0;
+  805ed5:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  805eda:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  805ede:	c9                   	leave
+  805edf:	c3                   	ret
+    if (!chan_peek(r)) return 1;
+  805ee0:	b8 01 00 00 00       	mov    $0x1,%eax
+  805ee5:	eb f3                	jmp    805eda <chan_arm+0x36>
+
+0000000000805ee7 <chan_wait>:
+
+/* Consumer: sleep until there is a message.
+ * The doorbell is chan_notify() */
+void
+chan_wait(struct ChanRing *r) {
+  805ee7:	55                   	push   %rbp
+  805ee8:	48 89 e5             	mov    %rsp,%rbp
+  805eeb:	41 56                	push   %r14
+  805eed:	41 55                	push   %r13
+  805eef:	41 54                	push   %r12
+  805ef1:	53                   	push   %rbx
+  805ef2:	48 89 fb             	mov    %rdi,%rbx
+    while (chan_arm(r))
+  805ef5:	49 bc a4 5e 80 00 00 	movabs $0x805ea4,%r12
+  805efc:	00 00 00 
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805eff:	4c 8d 77 40          	lea    0x40(%rdi),%r14
+  805f03:	49 bd 3f 23 80 00 00 	movabs $0x80233f,%r13
+  805f0a:	00 00 00 
+    while (chan_arm(r))
+  805f0d:	eb 0d                	jmp    805f1c <chan_wait+0x35>
+        sys_futex_wait(&r->cr_tail, r->cr_head, 0);
+  805f0f:	8b 33                	mov    (%rbx),%esi
+  805f11:	ba 00 00 00 00       	mov    $0x0,%edx
+  805f16:	4c 89 f7             	mov    %r14,%rdi
+  805f19:	41 ff d5             	call   *%r13
+    while (chan_arm(r))
+  805f1c:	48 89 df             	mov    %rbx,%rdi
+  805f1f:	41 ff d4             	call   *%r12
+  805f22:	84 c0                	test   %al,%al
+  805f24:	75 e9                	jne    805f0f <chan_wait+0x28>
+}
+  805f26:	5b                   	pop    %rbx
+  805f27:	41 5c                	pop    %r12
+  805f29:	41 5d                	pop    %r13
+  805f2b:	41 5e                	pop    %r14
+  805f2d:	5d                   	pop    %rbp
+  805f2e:	c3                   	ret
+
+0000000000805f2f <chan_notify>:
+
+/* Producer: wake up the consumer sleeping in chan_wait() */
+void
+chan_notify(struct ChanRing *r) {
+  805f2f:	55                   	push   %rbp
+  805f30:	48 89 e5             	mov    %rsp,%rbp
+    sys_futex_wake(&r->cr_tail, 1);
+  805f33:	48 83 c7 40          	add    $0x40,%rdi
+  805f37:	be 01 00 00 00       	mov    $0x1,%esi
+  805f3c:	48 b8 5d 23 80 00 00 	movabs $0x80235d,%rax
+  805f43:	00 00 00 
+  805f46:	ff d0                	call   *%rax
+}
+  805f48:	5d                   	pop    %rbp
+  805f49:	c3                   	ret
+
+0000000000805f4a <_handle_vectored_pagefault>:
+/* Vector size */
+static size_t _pfhandler_off = 0;
+static bool _pfhandler_inititiallized = 0;
+
+void
+_handle_vectored_pagefault(struct UTrapframe *utf) {
+  805f4a:	55                   	push   %rbp
+  805f4b:	48 89 e5             	mov    %rsp,%rbp
+  805f4e:	41 56                	push   %r14
+  805f50:	41 55                	push   %r13
+  805f52:	41 54                	push   %r12
+  805f54:	53                   	push   %rbx
+  805f55:	49 89 fc             	mov    %rdi,%r12
+    /* This trying to handle pagefault until
+     * some handler returns 1, that indicates
+     * successfully handled exception */
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f58:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805f5f:	00 00 00 
+  805f62:	48 83 38 00          	cmpq   $0x0,(%rax)
+  805f66:	74 27                	je     805f8f <_handle_vectored_pagefault+0x45>
+  805f68:	bb 00 00 00 00       	mov    $0x0,%ebx
+        if (_pfhandler_vec[i](utf)) return;
+  805f6d:	49 bd 60 18 84 00 00 	movabs $0x841860,%r13
+  805f74:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f77:	49 89 c6             	mov    %rax,%r14
+        if (_pfhandler_vec[i](utf)) return;
+  805f7a:	4c 89 e7             	mov    %r12,%rdi
+  805f7d:	41 ff 54 dd 00       	call   *0x0(%r13,%rbx,8)
+  805f82:	84 c0                	test   %al,%al
+  805f84:	75 45                	jne    805fcb <_handle_vectored_pagefault+0x81>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805f86:	48 83 c3 01          	add    $0x1,%rbx
+  805f8a:	49 3b 1e             	cmp    (%r14),%rbx
+  805f8d:	72 eb                	jb     805f7a <_handle_vectored_pagefault+0x30>
+
+    /* Unhandled exceptions just cause panic */
+    panic("Userspace page fault rip=%08lX va=%08lX err=%x\n",
+  805f8f:	49 8b 8c 24 88 00 00 	mov    0x88(%r12),%rcx
+  805f96:	00 
+  805f97:	45 8b 4c 24 08       	mov    0x8(%r12),%r9d
+  805f9c:	4d 8b 04 24          	mov    (%r12),%r8
+  805fa0:	48 ba 38 6d 80 00 00 	movabs $0x806d38,%rdx
+  805fa7:	00 00 00 
+  805faa:	be 1d 00 00 00       	mov    $0x1d,%esi
+  805faf:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  805fb6:	00 00 00 
+  805fb9:	b8 00 00 00 00       	mov    $0x0,%eax
+  805fbe:	49 ba 87 0b 80 00 00 	movabs $0x800b87,%r10
+  805fc5:	00 00 00 
+  805fc8:	41 ff d2             	call   *%r10
+          utf->utf_rip, utf->utf_fault_va, (int)utf->utf_err);
+}
+  805fcb:	5b                   	pop    %rbx
+  805fcc:	41 5c                	pop    %r12
+  805fce:	41 5d                	pop    %r13
+  805fd0:	41 5e                	pop    %r14
+  805fd2:	5d                   	pop    %rbp
+  805fd3:	c3                   	ret
+
+0000000000805fd4 <add_pgfault_handler>:
+ * The first time we register a handler, we need to
+ * allocate an exception stack (one page of memory with its top
+ * at USER_EXCEPTION_STACK_TOP), and tell the kernel to call the assembly-language
+ * _pgfault_upcall routine when a page fault occurs. */
+int
+add_pgfault_handler(pf_handler_t handler) {
+  805fd4:	55                   	push   %rbp
+  805fd5:	48 89 e5             	mov    %rsp,%rbp
+  805fd8:	53                   	push   %rbx
+  805fd9:	48 83 ec 08          	sub    $0x8,%rsp
+  805fdd:	48 89 fb             	mov    %rdi,%rbx
+    int res = 0;
+    if (!_pfhandler_inititiallized) {
+  805fe0:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  805fe7:	00 00 00 
+  805fea:	80 38 00             	cmpb   $0x0,(%rax)
+  805fed:	0f 84 84 00 00 00    	je     806077 <add_pgfault_handler+0xa3>
+        _pfhandler_vec[_pfhandler_off++] = handler;
+        _pfhandler_inititiallized = 1;
+        goto end;
+    }
+
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  805ff3:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  805ffa:	00 00 00 
+  805ffd:	48 8b 10             	mov    (%rax),%rdx
+  806000:	b8 00 00 00 00       	mov    $0x0,%eax
+        if (handler == _pfhandler_vec[i]) return 0;
+  806005:	48 b9 60 18 84 00 00 	movabs $0x841860,%rcx
+  80600c:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80600f:	48 85 d2             	test   %rdx,%rdx
+  806012:	74 19                	je     80602d <add_pgfault_handler+0x59>
+        if (handler == _pfhandler_vec[i]) return 0;
+  806014:	48 39 1c c1          	cmp    %rbx,(%rcx,%rax,8)
+  806018:	0f 84 e8 00 00 00    	je     806106 <add_pgfault_handler+0x132>
+    for (size_t i = 0; i < _pfhandler_off; i++)
+  80601e:	48 83 c0 01          	add    $0x1,%rax
+  806022:	48 39 d0             	cmp    %rdx,%rax
+  806025:	75 ed                	jne    806014 <add_pgfault_handler+0x40>
+
+    if (_pfhandler_off == MAX_PFHANDLER)
+  806027:	48 83 fa 08          	cmp    $0x8,%rdx
+  80602b:	74 1c                	je     806049 <add_pgfault_handler+0x75>
+        res = -E_INVAL;
+    else
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  80602d:	48 8d 42 01          	lea    0x1(%rdx),%rax
+  806031:	48 a3 a8 18 84 00 00 	movabs %rax,0x8418a8
+  806038:	00 00 00 
+  80603b:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  806042:	00 00 00 
+  806045:	48 89 1c d0          	mov    %rbx,(%rax,%rdx,8)
+
+end:
+	res = sys_env_set_pgfault_upcall(sys_getenvid(), _pgfault_upcall);
+  806049:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  806050:	00 00 00 
+  806053:	ff d0                	call   *%rax
+  806055:	89 c7                	mov    %eax,%edi
+  806057:	48 be cc 61 80 00 00 	movabs $0x8061cc,%rsi
+  80605e:	00 00 00 
+  806061:	48 b8 8f 21 80 00 00 	movabs $0x80218f,%rax
+  806068:	00 00 00 
+  80606b:	ff d0                	call   *%rax
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  80606d:	85 c0                	test   %eax,%eax
+  80606f:	78 68                	js     8060d9 <add_pgfault_handler+0x105>
+    return res;
+}
+  806071:	48 8b 5d f8          	mov    -0x8(%rbp),%rbx
+  806075:	c9                   	leave
+  806076:	c3                   	ret
+        res = sys_alloc_region(sys_getenvid(), (void*)(USER_EXCEPTION_STACK_TOP - PAGE_SIZE), PAGE_SIZE, PROT_RW);
+  806077:	48 b8 44 1f 80 00 00 	movabs $0x801f44,%rax
+  80607e:	00 00 00 
+  806081:	ff d0                	call   *%rax
+  806083:	89 c7                	mov    %eax,%edi
+  806085:	b9 06 00 00 00       	mov    $0x6,%ecx
+  80608a:	ba 00 10 00 00       	mov    $0x1000,%edx
+  80608f:	48 be 00 f0 ff ff 7f 	movabs $0x7ffffff000,%rsi
+  806096:	00 00 00 
+  806099:	48 b8 d1 1f 80 00 00 	movabs $0x801fd1,%rax
+  8060a0:	00 00 00 
+  8060a3:	ff d0                	call   *%rax
+        _pfhandler_vec[_pfhandler_off++] = handler;
+  8060a5:	48 ba a8 18 84 00 00 	movabs $0x8418a8,%rdx
+  8060ac:	00 00 00 
+  8060af:	48 8b 02             	mov    (%rdx),%rax
+  8060b2:	48 8d 48 01          	lea    0x1(%rax),%rcx
+  8060b6:	48 89 0a             	mov    %rcx,(%rdx)
+  8060b9:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  8060c0:	00 00 00 
+  8060c3:	48 89 1c c2          	mov    %rbx,(%rdx,%rax,8)
+        _pfhandler_inititiallized = 1;
+  8060c7:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  8060ce:	00 00 00 
+  8060d1:	c6 00 01             	movb   $0x1,(%rax)
+        goto end;
+  8060d4:	e9 70 ff ff ff       	jmp    806049 <add_pgfault_handler+0x75>
+    if (res < 0) panic("set_pgfault_handler: %i", res);
+  8060d9:	89 c1                	mov    %eax,%ecx
+  8060db:	48 ba 76 6d 80 00 00 	movabs $0x806d76,%rdx
+  8060e2:	00 00 00 
+  8060e5:	be 3d 00 00 00       	mov    $0x3d,%esi
+  8060ea:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  8060f1:	00 00 00 
+  8060f4:	b8 00 00 00 00       	mov    $0x0,%eax
+  8060f9:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  806100:	00 00 00 
+  806103:	41 ff d0             	call   *%r8
+        if (handler == _pfhandler_vec[i]) return 0;
+  806106:	b8 00 00 00 00       	mov    $0x0,%eax
+  80610b:	e9 61 ff ff ff       	jmp    806071 <add_pgfault_handler+0x9d>
+
+0000000000806110 <remove_pgfault_handler>:
+
+void
+remove_pgfault_handler(pf_handler_t handler) {
+  806110:	55                   	push   %rbp
+  806111:	48 89 e5             	mov    %rsp,%rbp
+    assert(_pfhandler_inititiallized);
+  806114:	48 b8 a0 18 84 00 00 	movabs $0x8418a0,%rax
+  80611b:	00 00 00 
+  80611e:	80 38 00             	cmpb   $0x0,(%rax)
+  806121:	74 33                	je     806156 <remove_pgfault_handler+0x46>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  806123:	48 a1 a8 18 84 00 00 	movabs 0x8418a8,%rax
+  80612a:	00 00 00 
+  80612d:	b9 00 00 00 00       	mov    $0x0,%ecx
+        if (_pfhandler_vec[i] == handler) {
+  806132:	48 ba 60 18 84 00 00 	movabs $0x841860,%rdx
+  806139:	00 00 00 
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80613c:	48 85 c0             	test   %rax,%rax
+  80613f:	0f 84 85 00 00 00    	je     8061ca <remove_pgfault_handler+0xba>
+        if (_pfhandler_vec[i] == handler) {
+  806145:	48 39 3c ca          	cmp    %rdi,(%rdx,%rcx,8)
+  806149:	74 40                	je     80618b <remove_pgfault_handler+0x7b>
+    for (size_t i = 0; i < _pfhandler_off; i++) {
+  80614b:	48 83 c1 01          	add    $0x1,%rcx
+  80614f:	48 39 c1             	cmp    %rax,%rcx
+  806152:	75 f1                	jne    806145 <remove_pgfault_handler+0x35>
+  806154:	eb 74                	jmp    8061ca <remove_pgfault_handler+0xba>
+    assert(_pfhandler_inititiallized);
+  806156:	48 b9 8e 6d 80 00 00 	movabs $0x806d8e,%rcx
+  80615d:	00 00 00 
+  806160:	48 ba 88 64 80 00 00 	movabs $0x806488,%rdx
+  806167:	00 00 00 
+  80616a:	be 43 00 00 00       	mov    $0x43,%esi
+  80616f:	48 bf 68 6d 80 00 00 	movabs $0x806d68,%rdi
+  806176:	00 00 00 
+  806179:	b8 00 00 00 00       	mov    $0x0,%eax
+  80617e:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  806185:	00 00 00 
+  806188:	41 ff d0             	call   *%r8
+            memmove(_pfhandler_vec + i, _pfhandler_vec + i + 1, (_pfhandler_off - i - 1) * sizeof(*handler));
+  80618b:	48 8d 34 cd 08 00 00 	lea    0x8(,%rcx,8),%rsi
+  806192:	00 
+  806193:	48 8d 50 ff          	lea    -0x1(%rax),%rdx
+  806197:	48 29 ca             	sub    %rcx,%rdx
+  80619a:	48 b8 60 18 84 00 00 	movabs $0x841860,%rax
+  8061a1:	00 00 00 
+  8061a4:	48 8d 0c 06          	lea    (%rsi,%rax,1),%rcx
+  8061a8:	48 8d 7c 30 f8       	lea    -0x8(%rax,%rsi,1),%rdi
+  8061ad:	48 89 ce             	mov    %rcx,%rsi
+  8061b0:	48 b8 f6 17 80 00 00 	movabs $0x8017f6,%rax
+  8061b7:	00 00 00 
+  8061ba:	ff d0                	call   *%rax
+            _pfhandler_off--;
+  8061bc:	48 b8 a8 18 84 00 00 	movabs $0x8418a8,%rax
+  8061c3:	00 00 00 
+  8061c6:	48 83 28 01          	subq   $0x1,(%rax)
+            return;
+        }
+    }
+}
+  8061ca:	5d                   	pop    %rbp
+  8061cb:	c3                   	ret
+
+00000000008061cc <_pgfault_upcall>:
+
+.text
+.globl _pgfault_upcall
+_pgfault_upcall:
+    # Call the C page fault handler.
+    movq  %rsp,%rdi # passing the function argument in rdi
+  8061cc:	48 89 e7             	mov    %rsp,%rdi
+    movabs $_handle_vectored_pagefault, %rax
+  8061cf:	48 b8 4a 5f 80 00 00 	movabs $0x805f4a,%rax
+  8061d6:	00 00 00 
+    call *%rax
+  8061d9:	ff d0                	call   *%rax
+    # registers are available for intermediate calculations.  You
+    # may find that you have to rearrange your code in non-obvious
+    # ways as registers become unavailable as scratch space.
+
+    # LAB 9: Your code here
+	popq %r15
+  8061db:	41 5f                	pop    %r15
+	popq %r15
+  8061dd:	41 5f                	pop    %r15
+    # Restore the trap-time registers.  After you do this, you
+    # can no longer modify any general-purpose registers (POPA).
+    # LAB 9: Your code here
+	popq %r15
+  8061df:	41 5f                	pop    %r15
+	popq %r14
+  8061e1:	41 5e                	pop    %r14
+	popq %r13
+  8061e3:	41 5d                	pop    %r13
+	popq %r12
+  8061e5:	41 5c                	pop    %r12
+	popq %r11
+  8061e7:	41 5b                	pop    %r11
+	popq %r10
+  8061e9:	41 5a                	pop    %r10
+	popq %r9
+  8061eb:	41 59                	pop    %r9
+	popq %r8
+  8061ed:	41 58                	pop    %r8
+	popq %rsi
+  8061ef:	5e                   	pop    %rsi
+	popq %rdi
+  8061f0:	5f                   	pop    %rdi
+	popq %rbp
+  8061f1:	5d                   	pop    %rbp
+	popq %rdx
+  8061f2:	5a                   	pop    %rdx
+	popq %rcx
+  8061f3:	59                   	pop    %rcx
+	movq 32(%rsp), %rbx
+  8061f4:	48 8b 5c 24 20       	mov    0x20(%rsp),%rbx
+	movq 16(%rsp), %rax
+  8061f9:	48 8b 44 24 10       	mov    0x10(%rsp),%rax
+	subq $8, %rbx
+  8061fe:	48 83 eb 08          	sub    $0x8,%rbx
+	movq %rax, (%rbx)
+  806202:	48 89 03             	mov    %rax,(%rbx)
+	movq %rbx, 32(%rsp)
+  806205:	48 89 5c 24 20       	mov    %rbx,0x20(%rsp)
+	popq %rbx
+  80620a:	5b                   	pop    %rbx
+	popq %rax
+  80620b:	58                   	pop    %rax
+    # Restore rflags from the stack.  After you do this, you can
+    # no longer use arithmetic operations or anything else that
+    # modifies rflags.
+    # LAB 9: Your code here
+	pushq 8(%rsp)
+  80620c:	ff 74 24 08          	push   0x8(%rsp)
+	popfq
+  806210:	9d                   	popf
+    # Switch back to the adjusted trap-time stack.
+    # LAB 9: Your code here
+	movq 16(%rsp), %rsp
+  806211:	48 8b 64 24 10       	mov    0x10(%rsp),%rsp
+    # Return to re-execute the instruction that faulted.
+    ret
+  806216:	c3                   	ret
+
+0000000000806217 <ipc_recv_futex>:
+/* Same as ipc_recv(), but also returns -E_AGAIN when the futex 'addr'
+ * is woken up and -E_TIMEOUT after 'timeout' milliseconds (0 means
+ * no timeout), see sys_futex_wait(). No futex if 'addr' is null */
+int32_t
+ipc_recv_futex(envid_t *from_env_store, void *pg, size_t *size, int *perm_store,
+               const volatile uint32_t *addr, uint32_t expected, unsigned timeout) {
+  806217:	55                   	push   %rbp
+  806218:	48 89 e5             	mov    %rsp,%rbp
+  80621b:	41 55                	push   %r13
+  80621d:	41 54                	push   %r12
+  80621f:	53                   	push   %rbx
+  806220:	48 83 ec 08          	sub    $0x8,%rsp
+  806224:	49 89 fd             	mov    %rdi,%r13
+  806227:	48 89 f7             	mov    %rsi,%rdi
+  80622a:	48 89 d3             	mov    %rdx,%rbx
+  80622d:	49 89 cc             	mov    %rcx,%r12
+  806230:	4c 89 c2             	mov    %r8,%rdx
+  806233:	44 89 c9             	mov    %r9d,%ecx
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  806236:	48 85 f6             	test   %rsi,%rsi
+  806239:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806240:	00 00 00 
+  806243:	48 0f 44 f8          	cmove  %rax,%rdi
+    }
+    int res = sys_ipc_recv_futex(pg, size ? *size : PAGE_SIZE, addr, expected, timeout);
+  806247:	be 00 10 00 00       	mov    $0x1000,%esi
+  80624c:	48 85 db             	test   %rbx,%rbx
+  80624f:	74 03                	je     806254 <ipc_recv_futex+0x3d>
+  806251:	48 8b 33             	mov    (%rbx),%rsi
+  806254:	44 8b 45 10          	mov    0x10(%rbp),%r8d
+  806258:	48 b8 1b 22 80 00 00 	movabs $0x80221b,%rax
+  80625f:	00 00 00 
+  806262:	ff d0                	call   *%rax
+    if (res < 0) {
+  806264:	85 c0                	test   %eax,%eax
+  806266:	78 75                	js     8062dd <ipc_recv_futex+0xc6>
+        if (size != NULL) {
+            *size = 0;
+        }
+        return res;
+    } else {
+        if (from_env_store != NULL) {
+  806268:	4d 85 ed             	test   %r13,%r13
+  80626b:	74 14                	je     806281 <ipc_recv_futex+0x6a>
+            *from_env_store = thisenv->env_ipc_from;
+  80626d:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  806274:	00 00 00 
+  806277:	8b 80 4c 01 00 00    	mov    0x14c(%rax),%eax
+  80627d:	41 89 45 00          	mov    %eax,0x0(%r13)
+        }
+        if (perm_store != NULL) {
+  806281:	4d 85 e4             	test   %r12,%r12
+  806284:	74 14                	je     80629a <ipc_recv_futex+0x83>
+            *perm_store = thisenv->env_ipc_perm;
+  806286:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  80628d:	00 00 00 
+  806290:	8b 80 50 01 00 00    	mov    0x150(%rax),%eax
+  806296:	41 89 04 24          	mov    %eax,(%r12)
+        }
+        if (size != NULL) {
+  80629a:	48 85 db             	test   %rbx,%rbx
+  80629d:	74 23                	je     8062c2 <ipc_recv_futex+0xab>
+            *size = thisenv->env_ipc_perm ? thisenv->env_ipc_maxsz : 0;
+  80629f:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  8062a6:	00 00 00 
+  8062a9:	8b 88 50 01 00 00    	mov    0x150(%rax),%ecx
+  8062af:	ba 00 00 00 00       	mov    $0x0,%edx
+  8062b4:	85 c9                	test   %ecx,%ecx
+  8062b6:	74 07                	je     8062bf <ipc_recv_futex+0xa8>
+  8062b8:	48 8b 90 40 01 00 00 	mov    0x140(%rax),%rdx
+  8062bf:	48 89 13             	mov    %rdx,(%rbx)
+        }
+        return thisenv->env_ipc_value;
+  8062c2:	48 a1 18 00 81 00 00 	movabs 0x810018,%rax
+  8062c9:	00 00 00 
+  8062cc:	8b 80 48 01 00 00    	mov    0x148(%rax),%eax
+    }
+    return -1;
+}
+  8062d2:	48 83 c4 08          	add    $0x8,%rsp
+  8062d6:	5b                   	pop    %rbx
+  8062d7:	41 5c                	pop    %r12
+  8062d9:	41 5d                	pop    %r13
+  8062db:	5d                   	pop    %rbp
+  8062dc:	c3                   	ret
+        if (from_env_store != NULL) {
+  8062dd:	4d 85 ed             	test   %r13,%r13
+  8062e0:	74 08                	je     8062ea <ipc_recv_futex+0xd3>
+            *from_env_store = 0;
+  8062e2:	41 c7 45 00 00 00 00 	movl   $0x0,0x0(%r13)
+  8062e9:	00 
+        if (perm_store != NULL) {
+  8062ea:	4d 85 e4             	test   %r12,%r12
+  8062ed:	74 08                	je     8062f7 <ipc_recv_futex+0xe0>
+            *perm_store = 0;
+  8062ef:	41 c7 04 24 00 00 00 	movl   $0x0,(%r12)
+  8062f6:	00 
+        if (size != NULL) {
+  8062f7:	48 85 db             	test   %rbx,%rbx
+  8062fa:	74 d6                	je     8062d2 <ipc_recv_futex+0xbb>
+            *size = 0;
+  8062fc:	48 c7 03 00 00 00 00 	movq   $0x0,(%rbx)
+  806303:	eb cd                	jmp    8062d2 <ipc_recv_futex+0xbb>
+
+0000000000806305 <ipc_recv>:
+ipc_recv(envid_t *from_env_store, void *pg, size_t *size, int *perm_store) {
+  806305:	55                   	push   %rbp
+  806306:	48 89 e5             	mov    %rsp,%rbp
+    return ipc_recv_futex(from_env_store, pg, size, perm_store, NULL, 0, 0);
+  806309:	48 83 ec 08          	sub    $0x8,%rsp
+  80630d:	6a 00                	push   $0x0
+  80630f:	41 b9 00 00 00 00    	mov    $0x0,%r9d
+  806315:	41 b8 00 00 00 00    	mov    $0x0,%r8d
+  80631b:	48 b8 17 62 80 00 00 	movabs $0x806217,%rax
+  806322:	00 00 00 
+  806325:	ff d0                	call   *%rax
+}
+  806327:	c9                   	leave
+  806328:	c3                   	ret
+
+0000000000806329 <ipc_send>:
+ *
+ * Hint:
+ *   If 'pg' is null, pass sys_ipc_recv a value that it will understand
+ *   as meaning "no page".  (Zero is not the right value.) */
+void
+ipc_send(envid_t to_env, uint32_t val, void *pg, size_t size, int perm) {
+  806329:	55                   	push   %rbp
+  80632a:	48 89 e5             	mov    %rsp,%rbp
+    // LAB 9: Your code here:
+    if (pg == NULL) {
+        pg = (void *)MAX_USER_ADDRESS;
+  80632d:	48 85 d2             	test   %rdx,%rdx
+  806330:	48 b8 00 00 00 00 80 	movabs $0x8000000000,%rax
+  806337:	00 00 00 
+  80633a:	48 0f 44 d0          	cmove  %rax,%rdx
+    }
+    int res = sys_ipc_send(to_env, val, pg, size, perm);
+  80633e:	89 f6                	mov    %esi,%esi
+  806340:	48 b8 04 22 80 00 00 	movabs $0x802204,%rax
+  806347:	00 00 00 
+  80634a:	ff d0                	call   *%rax
+    if (res < 0) {
+  80634c:	85 c0                	test   %eax,%eax
+  80634e:	78 02                	js     806352 <ipc_send+0x29>
+        panic("ipc_send error: %i\n", res);
+    }
+}
+  806350:	5d                   	pop    %rbp
+  806351:	c3                   	ret
+        panic("ipc_send error: %i\n", res);
+  806352:	89 c1                	mov    %eax,%ecx
+  806354:	48 ba a8 6d 80 00 00 	movabs $0x806da8,%rdx
+  80635b:	00 00 00 
+  80635e:	be 50 00 00 00       	mov    $0x50,%esi
+  806363:	48 bf bc 6d 80 00 00 	movabs $0x806dbc,%rdi
+  80636a:	00 00 00 
+  80636d:	b8 00 00 00 00       	mov    $0x0,%eax
+  806372:	49 b8 87 0b 80 00 00 	movabs $0x800b87,%r8
+  806379:	00 00 00 
+  80637c:	41 ff d0             	call   *%r8
+
+000000000080637f <ipc_find_env>:
+/* Find the first environment of the given type.  We'll use this to
+ * find special environments.
+ * Returns 0 if no such environment exists. */
+envid_t
+ipc_find_env(enum EnvType type) {
+    for (size_t i = 0; i < NENV; i++)
+  80637f:	ba 00 00 00 00       	mov    $0x0,%edx
+        if (envs[i].env_type == type)
+  806384:	48 b9 00 00 c0 1f 80 	movabs $0x801fc00000,%rcx
+  80638b:	00 00 00 
+  80638e:	48 89 d0             	mov    %rdx,%rax
+  806391:	48 c1 e0 04          	shl    $0x4,%rax
+  806395:	48 29 d0             	sub    %rdx,%rax
+  806398:	48 c1 e0 05          	shl    $0x5,%rax
+  80639c:	48 01 c8             	add    %rcx,%rax
+  80639f:	8b 80 d0 00 00 00    	mov    0xd0(%rax),%eax
+  8063a5:	39 f8                	cmp    %edi,%eax
+  8063a7:	74 13                	je     8063bc <ipc_find_env+0x3d>
+    for (size_t i = 0; i < NENV; i++)
+  8063a9:	48 83 c2 01          	add    $0x1,%rdx
+  8063ad:	48 81 fa 00 04 00 00 	cmp    $0x400,%rdx
+  8063b4:	75 d8                	jne    80638e <ipc_find_env+0xf>
+            return envs[i].env_id;
+    return 0;
+  8063b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+  8063bb:	c3                   	ret
+            return envs[i].env_id;
+  8063bc:	48 89 d0             	mov    %rdx,%rax
+  8063bf:	48 c1 e0 04          	shl    $0x4,%rax
+  8063c3:	48 29 d0             	sub    %rdx,%rax
+  8063c6:	48 c1 e0 05          	shl    $0x5,%rax
+  8063ca:	48 ba 00 00 c0 1f 80 	movabs $0x801fc00000,%rdx
+  8063d1:	00 00 00 
+  8063d4:	48 01 d0             	add    %rdx,%rax
+  8063d7:	8b 80 c8 00 00 00    	mov    0xc8(%rax),%eax
+  8063dd:	c3                   	ret
+  8063de:	66 90                	xchg   %ax,%ax
+
+00000000008063e0 <__rodata_start>:
+  8063e0:	20 09                	and    %cl,(%rcx)
+  8063e2:	0d 0a 00 20 09       	or     $0x920000a,%eax
+  8063e7:	0d 0a 3c 7c 3e       	or     $0x3e7c3c0a,%eax
+  8063ec:	26 3b 28             	es cmp (%rax),%ebp
+  8063ef:	29 00                	sub    %eax,(%rax)
+  8063f1:	74 6f                	je     806462 <__rodata_start+0x82>
+  8063f3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8063f4:	20 6d 61             	and    %ch,0x61(%rbp)
+  8063f7:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8063f8:	79 20                	jns    80641a <__rodata_start+0x3a>
+  8063fa:	61                   	(bad)
+  8063fb:	72 67                	jb     806464 <__rodata_start+0x84>
+  8063fd:	75 6d                	jne    80646c <__rodata_start+0x8c>
+  8063ff:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  806401:	74 73                	je     806476 <__rodata_start+0x96>
+  806403:	0a 00                	or     (%rax),%al
+  806405:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806406:	70 65                	jo     80646d <__rodata_start+0x8d>
+  806408:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806409:	20 25 73 20 66 6f    	and    %ah,0x6f662073(%rip)        # 6fe68482 <__bss_end+0x6f626482>
+  80640f:	72 20                	jb     806431 <__rodata_start+0x51>
+  806411:	72 65                	jb     806478 <__rodata_start+0x98>
+  806413:	61                   	(bad)
+  806414:	64 20 25 69 00 6f 70 	and    %ah,%fs:0x706f0069(%rip)        # 70ef6484 <__bss_end+0x706b4484>
+  80641b:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  80641d:	20 25 73 20 66 6f    	and    %ah,0x6f662073(%rip)        # 6fe68496 <__bss_end+0x6f626496>
+  806423:	72 20                	jb     806445 <__rodata_start+0x65>
+  806425:	77 72                	ja     806499 <__rodata_start+0xb9>
+  806427:	69 74 65 3a 20 25 69 	imul   $0x692520,0x3a(%rbp,%riz,2),%esi
+  80642e:	00 
+  80642f:	70 69                	jo     80649a <__rodata_start+0xba>
+  806431:	70 65                	jo     806498 <__rodata_start+0xb8>
+  806433:	3a 20                	cmp    (%rax),%ah
+  806435:	25 69 00 66 6f       	and    $0x6f660069,%eax
+  80643a:	72 6b                	jb     8064a7 <__rodata_start+0xc7>
+  80643c:	3a 20                	cmp    (%rax),%ah
+  80643e:	25 69 00 62 61       	and    $0x61620069,%eax
+  806443:	64 20 72 65          	and    %dh,%fs:0x65(%rdx)
+  806447:	74 75                	je     8064be <__rodata_start+0xde>
+  806449:	72 6e                	jb     8064b9 <__rodata_start+0xd9>
+  80644b:	20 25 64 20 66 72    	and    %ah,0x72662064(%rip)        # 72e684b5 <__bss_end+0x726264b5>
+  806451:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806452:	6d                   	insl   (%dx),%es:(%rdi)
+  806453:	20 67 65             	and    %ah,0x65(%rdi)
+  806456:	74 74                	je     8064cc <__rodata_start+0xec>
+  806458:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806459:	6b 65 6e 00          	imul   $0x0,0x6e(%rbp),%esp
+  80645d:	75 73                	jne    8064d2 <__rodata_start+0xf2>
+  80645f:	65 72 2f             	gs jb  806491 <__rodata_start+0xb1>
+  806462:	73 68                	jae    8064cc <__rodata_start+0xec>
+  806464:	2e 63 00             	cs movsxd (%rax),%eax
+  806467:	73 70                	jae    8064d9 <__rodata_start+0xf9>
+  806469:	61                   	(bad)
+  80646a:	77 6e                	ja     8064da <__rodata_start+0xfa>
+  80646c:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a09ee5 <__bss_end+0x251c7ee5>
+  806472:	69 0a 00 6f 70 65    	imul   $0x65706f00,(%rdx),%ecx
+  806478:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806479:	20 25 73 3a 20 25    	and    %ah,0x25203a73(%rip)        # 25a09ef2 <__bss_end+0x251c7ef2>
+  80647f:	69 00 72 20 3d 3d    	imul   $0x3d3d2072,(%rax),%eax
+  806485:	20 30                	and    %dh,(%rax)
+  806487:	00 61 73             	add    %ah,0x73(%rcx)
+  80648a:	73 65                	jae    8064f1 <__rodata_start+0x111>
+  80648c:	72 74                	jb     806502 <__rodata_start+0x122>
+  80648e:	69 6f 6e 20 66 61 69 	imul   $0x69616620,0x6e(%rdi),%ebp
+  806495:	6c                   	insb   (%dx),%es:(%rdi)
+  806496:	65 64 3a 20          	gs cmp %fs:(%rax),%ah
+  80649a:	25 73 00 24 20       	and    $0x20240073,%eax
+  80649f:	00 23                	add    %ah,(%rbx)
+  8064a1:	20 25 73 0a 00 66    	and    %ah,0x66000a73(%rip)        # 66806f1a <__bss_end+0x65fc4f1a>
+  8064a7:	90                   	nop
+  8064a8:	73 79                	jae    806523 <__rodata_start+0x143>
+  8064aa:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8064ab:	74 61                	je     80650e <__rodata_start+0x12e>
+  8064ad:	78 20                	js     8064cf <__rodata_start+0xef>
+  8064af:	65 72 72             	gs jb  806524 <__rodata_start+0x144>
+  8064b2:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8064b3:	72 3a                	jb     8064ef <__rodata_start+0x10f>
+  8064b5:	20 3c 20             	and    %bh,(%rax,%riz,1)
+  8064b8:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8064b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8064ba:	74 20                	je     8064dc <__rodata_start+0xfc>
+  8064bc:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8064be:	6c                   	insb   (%dx),%es:(%rdi)
+  8064bf:	6c                   	insb   (%dx),%es:(%rdi)
+  8064c0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8064c1:	77 65                	ja     806528 <__rodata_start+0x148>
+  8064c3:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  8064c7:	20 77 6f             	and    %dh,0x6f(%rdi)
+  8064ca:	72 64                	jb     806530 <__rodata_start+0x150>
+  8064cc:	0a 00                	or     (%rax),%al
+  8064ce:	00 00                	add    %al,(%rax)
+  8064d0:	73 79                	jae    80654b <__rodata_start+0x16b>
+  8064d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8064d3:	74 61                	je     806536 <__rodata_start+0x156>
+  8064d5:	78 20                	js     8064f7 <__rodata_start+0x117>
+  8064d7:	65 72 72             	gs jb  80654c <__rodata_start+0x16c>
+  8064da:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8064db:	72 3a                	jb     806517 <__rodata_start+0x137>
+  8064dd:	20 3e                	and    %bh,(%rsi)
+  8064df:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8064e2:	74 20                	je     806504 <__rodata_start+0x124>
+  8064e4:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8064e6:	6c                   	insb   (%dx),%es:(%rdi)
+  8064e7:	6c                   	insb   (%dx),%es:(%rdi)
+  8064e8:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8064e9:	77 65                	ja     806550 <__rodata_start+0x170>
+  8064eb:	64 20 62 79          	and    %ah,%fs:0x79(%rdx)
+  8064ef:	20 77 6f             	and    %dh,0x6f(%rdi)
+  8064f2:	72 64                	jb     806558 <__rodata_start+0x178>
+  8064f4:	0a 00                	or     (%rax),%al
+  8064f6:	00 00                	add    %al,(%rax)
+  8064f8:	75 73                	jne    80656d <__rodata_start+0x18d>
+  8064fa:	61                   	(bad)
+  8064fb:	67 65 3a 20          	cmp    %gs:(%eax),%ah
+  8064ff:	73 68                	jae    806569 <__rodata_start+0x189>
+  806501:	20 5b 2d             	and    %bl,0x2d(%rbx)
+  806504:	64 69 78 5d 20 5b 63 	imul   $0x6f635b20,%fs:0x5d(%rax),%edi
+  80650b:	6f 
+  80650c:	6d                   	insl   (%dx),%es:(%rdi)
+  80650d:	6d                   	insl   (%dx),%es:(%rdi)
+  80650e:	61                   	(bad)
+  80650f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806510:	64 2d 66 69 6c 65    	fs sub $0x656c6966,%eax
+  806516:	5d                   	pop    %rbp
+  806517:	0a 00                	or     (%rax),%al
+  806519:	3c 63                	cmp    $0x63,%al
+  80651b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80651c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80651d:	73 3e                	jae    80655d <__rodata_start+0x17d>
+  80651f:	00 63 6f             	add    %ah,0x6f(%rbx)
+  806522:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806523:	73 00                	jae    806525 <__rodata_start+0x145>
+  806525:	3c 75                	cmp    $0x75,%al
+  806527:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806528:	6b 6e 6f 77          	imul   $0x77,0x6f(%rsi),%ebp
+  80652c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80652d:	3e 00 90 5b 25 30 38 	ds add %dl,0x3830255b(%rax)
+  806534:	78 5d                	js     806593 <__rodata_start+0x1b3>
+  806536:	20 75 73             	and    %dh,0x73(%rbp)
+  806539:	65 72 20             	gs jb  80655c <__rodata_start+0x17c>
+  80653c:	70 61                	jo     80659f <__rodata_start+0x1bf>
+  80653e:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80653f:	69 63 20 69 6e 20 25 	imul   $0x25206e69,0x20(%rbx),%esp
+  806546:	73 20                	jae    806568 <__rodata_start+0x188>
+  806548:	61                   	(bad)
+  806549:	74 20                	je     80656b <__rodata_start+0x18b>
+  80654b:	25 73 3a 25 64       	and    $0x64253a73,%eax
+  806550:	3a 20                	cmp    (%rax),%ah
+  806552:	00 30                	add    %dh,(%rax)
+  806554:	31 32                	xor    %esi,(%rdx)
+  806556:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80655d:	41                   	rex.B
+  80655e:	42                   	rex.X
+  80655f:	43                   	rex.XB
+  806560:	44                   	rex.R
+  806561:	45                   	rex.RB
+  806562:	46 00 30             	rex.RX add %r14b,(%rax)
+  806565:	31 32                	xor    %esi,(%rdx)
+  806567:	33 34 35 36 37 38 39 	xor    0x39383736(,%rsi,1),%esi
+  80656e:	61                   	(bad)
+  80656f:	62 63 64 65 66       	(bad)
+  806574:	00 28                	add    %ch,(%rax)
+  806576:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806577:	75 6c                	jne    8065e5 <__rodata_start+0x205>
+  806579:	6c                   	insb   (%dx),%es:(%rdi)
+  80657a:	29 00                	sub    %eax,(%rax)
+  80657c:	65 72 72             	gs jb  8065f1 <__rodata_start+0x211>
+  80657f:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806580:	72 20                	jb     8065a2 <__rodata_start+0x1c2>
+  806582:	25 64 00 75 6e       	and    $0x6e750064,%eax
+  806587:	73 70                	jae    8065f9 <__rodata_start+0x219>
+  806589:	65 63 69 66          	movsxd %gs:0x66(%rcx),%ebp
+  80658d:	69 65 64 20 65 72 72 	imul   $0x72726520,0x64(%rbp),%esp
+  806594:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806595:	72 00                	jb     806597 <__rodata_start+0x1b7>
+  806597:	62 61 64 20 65       	(bad)
+  80659c:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80659d:	76 69                	jbe    806608 <__rodata_start+0x228>
+  80659f:	72 6f                	jb     806610 <__rodata_start+0x230>
+  8065a1:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8065a2:	6d                   	insl   (%dx),%es:(%rdi)
+  8065a3:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8065a5:	74 00                	je     8065a7 <__rodata_start+0x1c7>
+  8065a7:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  8065ae:	20 70 61             	and    %dh,0x61(%rax)
+  8065b1:	72 61                	jb     806614 <__rodata_start+0x234>
+  8065b3:	6d                   	insl   (%dx),%es:(%rdi)
+  8065b4:	65 74 65             	gs je  80661c <__rodata_start+0x23c>
+  8065b7:	72 00                	jb     8065b9 <__rodata_start+0x1d9>
+  8065b9:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8065ba:	75 74                	jne    806630 <__rodata_start+0x250>
+  8065bc:	20 6f 66             	and    %ch,0x66(%rdi)
+  8065bf:	20 6d 65             	and    %ch,0x65(%rbp)
+  8065c2:	6d                   	insl   (%dx),%es:(%rdi)
+  8065c3:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8065c4:	72 79                	jb     80663f <__rodata_start+0x25f>
+  8065c6:	00 6f 75             	add    %ch,0x75(%rdi)
+  8065c9:	74 20                	je     8065eb <__rodata_start+0x20b>
+  8065cb:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8065cc:	66 20 65 6e          	data16 and %ah,0x6e(%rbp)
+  8065d0:	76 69                	jbe    80663b <__rodata_start+0x25b>
+  8065d2:	72 6f                	jb     806643 <__rodata_start+0x263>
+  8065d4:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8065d5:	6d                   	insl   (%dx),%es:(%rdi)
+  8065d6:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8065d8:	74 73                	je     80664d <__rodata_start+0x26d>
+  8065da:	00 63 6f             	add    %ah,0x6f(%rbx)
+  8065dd:	72 72                	jb     806651 <__rodata_start+0x271>
+  8065df:	75 70                	jne    806651 <__rodata_start+0x271>
+  8065e1:	74 65                	je     806648 <__rodata_start+0x268>
+  8065e3:	64 20 64 65 62       	and    %ah,%fs:0x62(%rbp,%riz,2)
+  8065e8:	75 67                	jne    806651 <__rodata_start+0x271>
+  8065ea:	20 69 6e             	and    %ch,0x6e(%rcx)
+  8065ed:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8065ef:	00 73 65             	add    %dh,0x65(%rbx)
+  8065f2:	67 6d                	insl   (%dx),%es:(%edi)
+  8065f4:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  8065f6:	74 61                	je     806659 <__rodata_start+0x279>
+  8065f8:	74 69                	je     806663 <__rodata_start+0x283>
+  8065fa:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8065fb:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8065fc:	20 66 61             	and    %ah,0x61(%rsi)
+  8065ff:	75 6c                	jne    80666d <__rodata_start+0x28d>
+  806601:	74 00                	je     806603 <__rodata_start+0x223>
+  806603:	69 6e 76 61 6c 69 64 	imul   $0x64696c61,0x76(%rsi),%ebp
+  80660a:	20 45 4c             	and    %al,0x4c(%rbp)
+  80660d:	46 20 69 6d          	rex.RX and %r13b,0x6d(%rcx)
+  806611:	61                   	(bad)
+  806612:	67 65 00 6e 6f       	add    %ch,%gs:0x6f(%esi)
+  806617:	20 73 75             	and    %dh,0x75(%rbx)
+  80661a:	63 68 20             	movsxd 0x20(%rax),%ebp
+  80661d:	73 79                	jae    806698 <__rodata_start+0x2b8>
+  80661f:	73 74                	jae    806695 <__rodata_start+0x2b5>
+  806621:	65 6d                	gs insl (%dx),%es:(%rdi)
+  806623:	20 63 61             	and    %ah,0x61(%rbx)
+  806626:	6c                   	insb   (%dx),%es:(%rdi)
+  806627:	6c                   	insb   (%dx),%es:(%rdi)
+  806628:	00 65 6e             	add    %ah,0x6e(%rbp)
+  80662b:	74 72                	je     80669f <__rodata_start+0x2bf>
+  80662d:	79 20                	jns    80664f <__rodata_start+0x26f>
+  80662f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806630:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806631:	74 20                	je     806653 <__rodata_start+0x273>
+  806633:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  806635:	75 6e                	jne    8066a5 <__rodata_start+0x2c5>
+  806637:	64 00 65 6e          	add    %ah,%fs:0x6e(%rbp)
+  80663b:	76 20                	jbe    80665d <__rodata_start+0x27d>
+  80663d:	69 73 20 6e 6f 74 20 	imul   $0x20746f6e,0x20(%rbx),%esi
+  806644:	72 65                	jb     8066ab <__rodata_start+0x2cb>
+  806646:	63 76 69             	movsxd 0x69(%rsi),%esi
+  806649:	6e                   	outsb  %ds:(%rsi),(%dx)
+  80664a:	67 00 75 6e          	add    %dh,0x6e(%ebp)
+  80664e:	65 78 70             	gs js  8066c1 <__rodata_start+0x2e1>
+  806651:	65 63 74 65 64       	movsxd %gs:0x64(%rbp,%riz,2),%esi
+  806656:	20 65 6e             	and    %ah,0x6e(%rbp)
+  806659:	64 20 6f 66          	and    %ch,%fs:0x66(%rdi)
+  80665d:	20 66 69             	and    %ah,0x69(%rsi)
+  806660:	6c                   	insb   (%dx),%es:(%rdi)
+  806661:	65 00 6e 6f          	add    %ch,%gs:0x6f(%rsi)
+  806665:	20 66 72             	and    %ah,0x72(%rsi)
+  806668:	65 65 20 73 70       	gs and %dh,%gs:0x70(%rbx)
+  80666d:	61                   	(bad)
+  80666e:	63 65 20             	movsxd 0x20(%rbp),%esp
+  806671:	6f                   	outsl  %ds:(%rsi),(%dx)
+  806672:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806673:	20 64 69 73          	and    %ah,0x73(%rcx,%rbp,2)
+  806677:	6b 00 74             	imul   $0x74,(%rax),%eax
+  80667a:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80667b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80667c:	20 6d 61             	and    %ch,0x61(%rbp)
+  80667f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  806680:	79 20                	jns    8066a2 <__rodata_start+0x2c2>
+  806682:	66 69 6c 65 73 20 61 	imul   $0x6120,0x73(%rbp,%riz,2),%bp
+  806689:	72 65                	jb     8066f0 <__rodata_start+0x310>
+  80668b:	20 6f 70             	and    %ch,0x70(%rdi)
+  80668e:	65 6e                	outsb  %gs:(%rsi),(%dx)
+  806690:	00 66 69             	add    %ah,0x69(%rsi)
+  806693:	6c                   	insb   (%dx),%es:(%rdi)
+  806694:	65 20 6f 72          	and    %ch,%gs:0x72(%rdi)
+  806698:	20 62 6c             	and    %ah,0x6c(%rdx)
+  80669b:	6f                   	outsl  %ds:(%rsi),(%dx)
+  80669c:	63 6b 20             	movsxd 0x20(%rbx),%ebp
+  80669f:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8066a0:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8066a1:	74 20                	je     8066c3 <__rodata_start+0x2e3>
+  8066a3:	66 6f                	outsw  %ds:(%rsi),(%dx)
+  8066a5:	75 6e                	jne    806715 <__rodata_start+0x335>
+  8066a7:	64 00 69 6e          	add    %ch,%fs:0x6e(%rcx)
+  8066ab:	76 61                	jbe    80670e <__rodata_start+0x32e>
+  8066ad:	6c                   	insb   (%dx),%es:(%rdi)
+  8066ae:	69 64 20 70 61 74 68 	imul   $0x687461,0x70(%rax,%riz,1),%esp
+  8066b5:	00 
+  8066b6:	66 69 6c 65 20 61 6c 	imul   $0x6c61,0x20(%rbp,%riz,2),%bp
+  8066bd:	72 65                	jb     806724 <__rodata_start+0x344>
+  8066bf:	61                   	(bad)
+  8066c0:	64 79 20             	fs jns 8066e3 <__rodata_start+0x303>
+  8066c3:	65 78 69             	gs js  80672f <__rodata_start+0x34f>
+  8066c6:	73 74                	jae    80673c <__rodata_start+0x35c>
+  8066c8:	73 00                	jae    8066ca <__rodata_start+0x2ea>
+  8066ca:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8066cb:	70 65                	jo     806732 <__rodata_start+0x352>
+  8066cd:	72 61                	jb     806730 <__rodata_start+0x350>
+  8066cf:	74 69                	je     80673a <__rodata_start+0x35a>
+  8066d1:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8066d2:	6e                   	outsb  %ds:(%rsi),(%dx)
+  8066d3:	20 6e 6f             	and    %ch,0x6f(%rsi)
+  8066d6:	74 20                	je     8066f8 <__rodata_start+0x318>
+  8066d8:	73 75                	jae    80674f <__rodata_start+0x36f>
+  8066da:	70 70                	jo     80674c <__rodata_start+0x36c>
+  8066dc:	6f                   	outsl  %ds:(%rsi),(%dx)
+  8066dd:	72 74                	jb     806753 <__rodata_start+0x373>
+  8066df:	65 64 00 74 72 79    	gs add %dh,%fs:0x79(%rdx,%rsi,2)
+  8066e5:	20 61 67             	and    %ah,0x67(%rcx)
+  8066e8:	61                   	(bad)
+  8066e9:	69 6e 00 74 69 6d 65 	imul   $0x656d6974,0x0(%rsi),%ebp
+  8066f0:	64 20 6f 75          	and    %ch,%fs:0x75(%rdi)
+  8066f4:	74 00                	je     8066f6 <__rodata_start+0x316>
+  8066f6:	66 69 6c 65 20 69 73 	imul   $0x7369,0x20(%rbp,%riz,2),%bp
+  8066fd:	20 69 6e             	and    %ch,0x6e(%rcx)
+  806700:	20 75 73             	and    %dh,0x73(%rbp)
+  806703:	65 00 66 2e          	add    %ah,%gs:0x2e(%rsi)
+  806707:	0f 1f 84 00 00 00 00 	nopl   0x0(%rax,%rax,1)
+  80670e:	00 
+  80670f:	66 2e 0f 1f 84 00 00 	cs nopw 0x0(%rax,%rax,1)
+  806716:	00 00 00 
+  806719:	0f 1f 80 00 00 00 00 	nopl   0x0(%rax)
+  806720:	c4                   	(bad)
+  806721:	0e                   	(bad)
+  806722:	80 00 00             	addb   $0x0,(%rax)
+  806725:	00 00                	add    %al,(%rax)
+  806727:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e742 <__ctors_end+0x7662>
+  80672d:	00 00                	add    %al,(%rax)
+  80672f:	00 f5                	add    %dh,%ch
+  806731:	14 80                	adc    $0x80,%al
+  806733:	00 00                	add    %al,(%rax)
+  806735:	00 00                	add    %al,(%rax)
+  806737:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e752 <__ctors_end+0x7672>
+  80673d:	00 00                	add    %al,(%rax)
+  80673f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e75a <__ctors_end+0x767a>
+  806745:	00 00                	add    %al,(%rax)
+  806747:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e762 <__ctors_end+0x7682>
+  80674d:	00 00                	add    %al,(%rax)
+  80674f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e76a <__ctors_end+0x768a>
+  806755:	00 00                	add    %al,(%rax)
+  806757:	00 e3                	add    %ah,%bl
+  806759:	0e                   	(bad)
+  80675a:	80 00 00             	addb   $0x0,(%rax)
+  80675d:	00 00                	add    %al,(%rax)
+  80675f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e77a <__ctors_end+0x769a>
+  806765:	00 00                	add    %al,(%rax)
+  806767:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e782 <__ctors_end+0x76a2>
+  80676d:	00 00                	add    %al,(%rax)
+  80676f:	00 d7                	add    %dl,%bh
+  806771:	0e                   	(bad)
+  806772:	80 00 00             	addb   $0x0,(%rax)
+  806775:	00 00                	add    %al,(%rax)
+  806777:	00 51 0f             	add    %dl,0xf(%rcx)
+  80677a:	80 00 00             	addb   $0x0,(%rax)
+  80677d:	00 00                	add    %al,(%rax)
+  80677f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e79a <__ctors_end+0x76ba>
+  806785:	00 00                	add    %al,(%rax)
+  806787:	00 d7                	add    %dl,%bh
+  806789:	0e                   	(bad)
+  80678a:	80 00 00             	addb   $0x0,(%rax)
+  80678d:	00 00                	add    %al,(%rax)
+  80678f:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7a4 <__ctors_end+0x76c4>
+  806795:	00 00                	add    %al,(%rax)
+  806797:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7ac <__ctors_end+0x76cc>
+  80679d:	00 00                	add    %al,(%rax)
+  80679f:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7b4 <__ctors_end+0x76d4>
+  8067a5:	00 00                	add    %al,(%rax)
+  8067a7:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7bc <__ctors_end+0x76dc>
+  8067ad:	00 00                	add    %al,(%rax)
+  8067af:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7c4 <__ctors_end+0x76e4>
+  8067b5:	00 00                	add    %al,(%rax)
+  8067b7:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7cc <__ctors_end+0x76ec>
+  8067bd:	00 00                	add    %al,(%rax)
+  8067bf:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7d4 <__ctors_end+0x76f4>
+  8067c5:	00 00                	add    %al,(%rax)
+  8067c7:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7dc <__ctors_end+0x76fc>
+  8067cd:	00 00                	add    %al,(%rax)
+  8067cf:	00 1d 0f 80 00 00    	add    %bl,0x800f(%rip)        # 80e7e4 <__ctors_end+0x7704>
+  8067d5:	00 00                	add    %al,(%rax)
+  8067d7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e7f2 <__ctors_end+0x7712>
+  8067dd:	00 00                	add    %al,(%rax)
+  8067df:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e7fa <__ctors_end+0x771a>
+  8067e5:	00 00                	add    %al,(%rax)
+  8067e7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e802 <__ctors_end+0x7722>
+  8067ed:	00 00                	add    %al,(%rax)
+  8067ef:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e80a <__ctors_end+0x772a>
+  8067f5:	00 00                	add    %al,(%rax)
+  8067f7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e812 <__ctors_end+0x7732>
+  8067fd:	00 00                	add    %al,(%rax)
+  8067ff:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e81a <__ctors_end+0x773a>
+  806805:	00 00                	add    %al,(%rax)
+  806807:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e822 <__ctors_end+0x7742>
+  80680d:	00 00                	add    %al,(%rax)
+  80680f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e82a <__ctors_end+0x774a>
+  806815:	00 00                	add    %al,(%rax)
+  806817:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e832 <__ctors_end+0x7752>
+  80681d:	00 00                	add    %al,(%rax)
+  80681f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e83a <__ctors_end+0x775a>
+  806825:	00 00                	add    %al,(%rax)
+  806827:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e842 <__ctors_end+0x7762>
+  80682d:	00 00                	add    %al,(%rax)
+  80682f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e84a <__ctors_end+0x776a>
+  806835:	00 00                	add    %al,(%rax)
+  806837:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e852 <__ctors_end+0x7772>
+  80683d:	00 00                	add    %al,(%rax)
+  80683f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e85a <__ctors_end+0x777a>
+  806845:	00 00                	add    %al,(%rax)
+  806847:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e862 <__ctors_end+0x7782>
+  80684d:	00 00                	add    %al,(%rax)
+  80684f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e86a <__ctors_end+0x778a>
+  806855:	00 00                	add    %al,(%rax)
+  806857:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e872 <__ctors_end+0x7792>
+  80685d:	00 00                	add    %al,(%rax)
+  80685f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e87a <__ctors_end+0x779a>
+  806865:	00 00                	add    %al,(%rax)
+  806867:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e882 <__ctors_end+0x77a2>
+  80686d:	00 00                	add    %al,(%rax)
+  80686f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e88a <__ctors_end+0x77aa>
+  806875:	00 00                	add    %al,(%rax)
+  806877:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e892 <__ctors_end+0x77b2>
+  80687d:	00 00                	add    %al,(%rax)
+  80687f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e89a <__ctors_end+0x77ba>
+  806885:	00 00                	add    %al,(%rax)
+  806887:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8a2 <__ctors_end+0x77c2>
+  80688d:	00 00                	add    %al,(%rax)
+  80688f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8aa <__ctors_end+0x77ca>
+  806895:	00 00                	add    %al,(%rax)
+  806897:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8b2 <__ctors_end+0x77d2>
+  80689d:	00 00                	add    %al,(%rax)
+  80689f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8ba <__ctors_end+0x77da>
+  8068a5:	00 00                	add    %al,(%rax)
+  8068a7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8c2 <__ctors_end+0x77e2>
+  8068ad:	00 00                	add    %al,(%rax)
+  8068af:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8ca <__ctors_end+0x77ea>
+  8068b5:	00 00                	add    %al,(%rax)
+  8068b7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8d2 <__ctors_end+0x77f2>
+  8068bd:	00 00                	add    %al,(%rax)
+  8068bf:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8da <__ctors_end+0x77fa>
+  8068c5:	00 00                	add    %al,(%rax)
+  8068c7:	00 28                	add    %ch,(%rax)
+  8068c9:	14 80                	adc    $0x80,%al
+  8068cb:	00 00                	add    %al,(%rax)
+  8068cd:	00 00                	add    %al,(%rax)
+  8068cf:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8ea <__ctors_end+0x780a>
+  8068d5:	00 00                	add    %al,(%rax)
+  8068d7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8f2 <__ctors_end+0x7812>
+  8068dd:	00 00                	add    %al,(%rax)
+  8068df:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e8fa <__ctors_end+0x781a>
+  8068e5:	00 00                	add    %al,(%rax)
+  8068e7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e902 <__ctors_end+0x7822>
+  8068ed:	00 00                	add    %al,(%rax)
+  8068ef:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e90a <__ctors_end+0x782a>
+  8068f5:	00 00                	add    %al,(%rax)
+  8068f7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e912 <__ctors_end+0x7832>
+  8068fd:	00 00                	add    %al,(%rax)
+  8068ff:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e91a <__ctors_end+0x783a>
+  806905:	00 00                	add    %al,(%rax)
+  806907:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e922 <__ctors_end+0x7842>
+  80690d:	00 00                	add    %al,(%rax)
+  80690f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e92a <__ctors_end+0x784a>
+  806915:	00 00                	add    %al,(%rax)
+  806917:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e932 <__ctors_end+0x7852>
+  80691d:	00 00                	add    %al,(%rax)
+  80691f:	00 74 0f 80          	add    %dh,-0x80(%rdi,%rcx,1)
+  806923:	00 00                	add    %al,(%rax)
+  806925:	00 00                	add    %al,(%rax)
+  806927:	00 43 11             	add    %al,0x11(%rbx)
+  80692a:	80 00 00             	addb   $0x0,(%rax)
+  80692d:	00 00                	add    %al,(%rax)
+  80692f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e94a <__ctors_end+0x786a>
+  806935:	00 00                	add    %al,(%rax)
+  806937:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e952 <__ctors_end+0x7872>
+  80693d:	00 00                	add    %al,(%rax)
+  80693f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e95a <__ctors_end+0x787a>
+  806945:	00 00                	add    %al,(%rax)
+  806947:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e962 <__ctors_end+0x7882>
+  80694d:	00 00                	add    %al,(%rax)
+  80694f:	00 a3 0f 80 00 00    	add    %ah,0x800f(%rbx)
+  806955:	00 00                	add    %al,(%rax)
+  806957:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e972 <__ctors_end+0x7892>
+  80695d:	00 00                	add    %al,(%rax)
+  80695f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e97a <__ctors_end+0x789a>
+  806965:	00 00                	add    %al,(%rax)
+  806967:	00 69 0f             	add    %ch,0xf(%rcx)
+  80696a:	80 00 00             	addb   $0x0,(%rax)
+  80696d:	00 00                	add    %al,(%rax)
+  80696f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e98a <__ctors_end+0x78aa>
+  806975:	00 00                	add    %al,(%rax)
+  806977:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e992 <__ctors_end+0x78b2>
+  80697d:	00 00                	add    %al,(%rax)
+  80697f:	00 eb                	add    %ch,%bl
+  806981:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  806987:	00 b5 13 80 00 00    	add    %dh,0x8013(%rbp)
+  80698d:	00 00                	add    %al,(%rax)
+  80698f:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9aa <__ctors_end+0x78ca>
+  806995:	00 00                	add    %al,(%rax)
+  806997:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9b2 <__ctors_end+0x78d2>
+  80699d:	00 00                	add    %al,(%rax)
+  80699f:	00 3a                	add    %bh,(%rdx)
+  8069a1:	10 80 00 00 00 00    	adc    %al,0x0(%rax)
+  8069a7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9c2 <__ctors_end+0x78e2>
+  8069ad:	00 00                	add    %al,(%rax)
+  8069af:	00 17                	add    %dl,(%rdi)
+  8069b1:	12 80 00 00 00 00    	adc    0x0(%rax),%al
+  8069b7:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9d2 <__ctors_end+0x78f2>
+  8069bd:	00 00                	add    %al,(%rax)
+  8069bf:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9da <__ctors_end+0x78fa>
+  8069c5:	00 00                	add    %al,(%rax)
+  8069c7:	00 28                	add    %ch,(%rax)
+  8069c9:	14 80                	adc    $0x80,%al
+  8069cb:	00 00                	add    %al,(%rax)
+  8069cd:	00 00                	add    %al,(%rax)
+  8069cf:	00 05 15 80 00 00    	add    %al,0x8015(%rip)        # 80e9ea <__ctors_end+0x790a>
+  8069d5:	00 00                	add    %al,(%rax)
+  8069d7:	00 cd                	add    %cl,%ch
+  8069d9:	0e                   	(bad)
+  8069da:	80 00 00             	addb   $0x0,(%rax)
+  8069dd:	00 00                	add    %al,(%rax)
+	...
+
+00000000008069e0 <error_string>:
+	...
+  8069e8:	85 65 80 00 00 00 00 00 97 65 80 00 00 00 00 00     .e.......e......
+  8069f8:	a7 65 80 00 00 00 00 00 b9 65 80 00 00 00 00 00     .e.......e......
+  806a08:	c7 65 80 00 00 00 00 00 db 65 80 00 00 00 00 00     .e.......e......
+  806a18:	f0 65 80 00 00 00 00 00 03 66 80 00 00 00 00 00     .e.......f......
+  806a28:	15 66 80 00 00 00 00 00 29 66 80 00 00 00 00 00     .f......)f......
+  806a38:	39 66 80 00 00 00 00 00 4c 66 80 00 00 00 00 00     9f......Lf......
+  806a48:	63 66 80 00 00 00 00 00 79 66 80 00 00 00 00 00     cf......yf......
+  806a58:	91 66 80 00 00 00 00 00 a9 66 80 00 00 00 00 00     .f.......f......
+  806a68:	b6 66 80 00 00 00 00 00 98 6a 80 00 00 00 00 00     .f.......j......
+  806a78:	ca 66 80 00 00 00 00 00 e2 66 80 00 00 00 00 00     .f.......f......
+  806a88:	ec 66 80 00 00 00 00 00 f6 66 80 00 00 00 00 00     .f.......f......
+  806a98:	66 69 6c 65 20 69 73 20 6e 6f 74 20 61 20 76 61     file is not a va
+  806aa8:	6c 69 64 20 65 78 65 63 75 74 61 62 6c 65 00 72     lid executable.r
+  806ab8:	65 61 64 20 65 72 72 6f 72 3a 20 25 69 0a 00 25     ead error: %i..%
+  806ac8:	6c 64 00 25 6c 6c 64 00 25 75 00 25 6c 75 00 25     ld.%lld.%u.%lu.%
+  806ad8:	6c 6c 75 00 25 66 00 25 6c 66 00 25 63 00 66 90     llu.%f.%lf.%c.f.
+  806ae8:	73 79 73 63 61 6c 6c 20 25 7a 64 20 72 65 74 75     syscall %zd retu
+  806af8:	72 6e 65 64 20 25 7a 64 20 28 3e 20 30 29 00 6c     rned %zd (> 0).l
+  806b08:	69 62 2f 73 79 73 63 61 6c 6c 2e 63 00 73 66 6f     ib/syscall.c.sfo
+  806b18:	72 6b 28 29 20 69 73 20 6e 6f 74 20 69 6d 70 6c     rk() is not impl
+  806b28:	65 6d 65 6e 74 65 64 00 6c 69 62 2f 66 6f 72 6b     emented.lib/fork
+  806b38:	2e 63 00 0f 1f 44 00 00 5b 25 30 38 78 5d 20 75     .c...D..[%08x] u
+  806b48:	6e 6b 6e 6f 77 6e 20 64 65 76 69 63 65 20 74 79     nknown device ty
+  806b58:	70 65 20 25 64 0a 00 00 5b 25 30 38 78 5d 20 66     pe %d...[%08x] f
+  806b68:	74 72 75 6e 63 61 74 65 20 25 64 20 2d 2d 20 62     truncate %d -- b
+  806b78:	61 64 20 6d 6f 64 65 0a 00 5b 25 30 38 78 5d 20     ad mode..[%08x] 
+  806b88:	72 65 61 64 20 25 64 20 2d 2d 20 62 61 64 20 6d     read %d -- bad m
+  806b98:	6f 64 65 0a 00 5b 25 30 38 78 5d 20 77 72 69 74     ode..[%08x] writ
+  806ba8:	65 20 25 64 20 2d 2d 20 62 61 64 20 6d 6f 64 65     e %d -- bad mode
+  806bb8:	0a 00 66 0f 1f 44 00 00                             ..f..D..
+
+0000000000806bc0 <devtab>:
+  806bc0:	60 70 80 00 00 00 00 00 a0 70 80 00 00 00 00 00     `p.......p......
+  806bd0:	00 70 80 00 00 00 00 00 00 00 00 00 00 00 00 00     .p..............
+  806be0:	57 72 6f 6e 67 20 45 4c 46 20 68 65 61 64 65 72     Wrong ELF header
+  806bf0:	20 73 69 7a 65 20 6f 72 20 72 65 61 64 20 65 72      size or read er
+  806c00:	72 6f 72 3a 20 25 69 0a 00 00 00 00 00 00 00 00     ror: %i.........
+  806c10:	73 74 72 69 6e 67 5f 73 74 6f 72 65 20 3d 3d 20     string_store == 
+  806c20:	28 63 68 61 72 20 2a 29 55 54 45 4d 50 20 2b 20     (char *)UTEMP + 
+  806c30:	55 53 45 52 5f 53 54 41 43 4b 5f 53 49 5a 45 00     USER_STACK_SIZE.
+  806c40:	6d 61 70 5f 73 65 67 6d 65 6e 74 2e 73 79 73 5f     map_segment.sys_
+  806c50:	61 6c 6c 6f 63 5f 72 65 67 69 6f 6e 20 66 61 69     alloc_region fai
+  806c60:	6c 65 64 3a 20 25 69 0a 00 00 00 00 00 00 00 00     led: %i.........
+  806c70:	73 70 61 77 6e 3a 20 62 61 74 63 68 65 64 20 73     spawn: batched s
+  806c80:	79 73 74 65 6d 20 63 61 6c 6c 20 66 61 69 6c 65     ystem call faile
+  806c90:	64 3a 20 25 69 0a 00 45 6c 66 20 6d 61 67 69 63     d: %i..Elf magic
+  806ca0:	20 25 30 38 78 20 77 61 6e 74 20 25 30 38 78 0a      %08x want %08x.
+  806cb0:	00 6c 69 62 2f 73 70 61 77 6e 2e 63 00 6d 61 70     .lib/spawn.c.map
+  806cc0:	5f 73 65 67 6d 65 6e 74 2e 6d 6d 61 70 20 66 61     _segment.mmap fa
+  806cd0:	69 6c 65 64 3a 20 25 69 0a 00 3c 70 69 70 65 3e     iled: %i..<pipe>
+  806ce0:	00 6c 69 62 2f 70 69 70 65 2e 63 00 70 69 70 65     .lib/pipe.c.pipe
+  806cf0:	00 0f 1f 80 00 00 00 00 73 79 73 5f 72 65 67 69     ........sys_regi
+  806d00:	6f 6e 5f 72 65 66 73 28 76 61 2c 20 50 41 47 45     on_refs(va, PAGE
+  806d10:	5f 53 49 5a 45 29 20 3d 3d 20 32 00 65 6e 76 69     _SIZE) == 2.envi
+  806d20:	64 20 21 3d 20 30 00 6c 69 62 2f 77 61 69 74 2e     d != 0.lib/wait.
+  806d30:	63 00 66 0f 1f 44 00 00 55 73 65 72 73 70 61 63     c.f..D..Userspac
+  806d40:	65 20 70 61 67 65 20 66 61 75 6c 74 20 72 69 70     e page fault rip
+  806d50:	3d 25 30 38 6c 58 20 76 61 3d 25 30 38 6c 58 20     =%08lX va=%08lX 
+  806d60:	65 72 72 3d 25 78 0a 00 6c 69 62 2f 70 67 66 61     err=%x..lib/pgfa
+  806d70:	75 6c 74 2e 63 00 73 65 74 5f 70 67 66 61 75 6c     ult.c.set_pgfaul
+  806d80:	74 5f 68 61 6e 64 6c 65 72 3a 20 25 69 00 5f 70     t_handler: %i._p
+  806d90:	66 68 61 6e 64 6c 65 72 5f 69 6e 69 74 69 74 69     fhandler_inititi
+  806da0:	61 6c 6c 69 7a 65 64 00 69 70 63 5f 73 65 6e 64     allized.ipc_send
+  806db0:	20 65 72 72 6f 72 3a 20 25 69 0a 00 6c 69 62 2f      error: %i..lib/
+  806dc0:	69 70 63 2e 63 00 66 2e 0f 1f 84 00 00 00 00 00     ipc.c.f.........
+  806dd0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806de0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806df0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e00:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e10:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e20:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e30:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e40:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806e50:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806e60:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806e70:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806e80:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806e90:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ea0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806eb0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806ec0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806ed0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806ee0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806ef0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f00:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f10:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f20:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f30:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f40:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806f50:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806f60:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806f70:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806f80:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806f90:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806fa0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........
+  806fb0:	66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00     f.........f.....
+  806fc0:	00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e     ....f.........f.
+  806fd0:	0f 1f 84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00     ........f.......
+  806fe0:	00 00 66 2e 0f 1f 84 00 00 00 00 00 66 2e 0f 1f     ..f.........f...
+  806ff0:	84 00 00 00 00 00 66 2e 0f 1f 84 00 00 00 00 00     ......f.........